@@ -331,6 +331,13 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
 // File operations
 // --------------------------------------------------------------
 
+// Mark f as modified.
+static void
+file_touch(struct File *f)
+{
+	f->f_version = ++super->s_version;
+}
+
 // Create "path".  On success set *pf to point at the file and return 0.
 // On error return < 0.
 int
@@ -347,6 +354,7 @@ file_create(const char *path, struct File **pf)
 	if ((r = dir_alloc_file(dir, &f)) < 0)
 		return r;
 	strcpy(f->f_name, name);
+	file_touch(f);
 	*pf = f;
 	file_flush(dir);
 	return 0;
@@ -411,6 +419,7 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset)
 		pos += bn;
 		buf += bn;
 	}
+	file_touch(f);
 
 	return count;
 }
@@ -466,6 +475,7 @@ file_set_size(struct File *f, off_t newsize)
 	if (f->f_size > newsize)
 		file_truncate_blocks(f, newsize);
 	f->f_size = newsize;
+	file_touch(f);
 	flush_block(f);
 	return 0;
 }
@@ -504,6 +514,7 @@ file_remove(const char *path)
 	file_truncate_blocks(f, 0);
 	f->f_name[0] = '\0';
 	f->f_size = 0;
+	file_touch(f);
 	flush_block(f);
 
 	return 0;
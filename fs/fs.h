@@ -4,13 +4,6 @@
 #define SECTSIZE	512			// bytes per disk sector
 #define BLKSECTS	(BLKSIZE / SECTSIZE)	// sectors per block
 
-/* Disk block n, when in memory, is mapped into the file system
- * server's address space at DISKMAP + (n*BLKSIZE). */
-#define DISKMAP		0x10000000
-
-/* Maximum disk size we can handle (3GB) */
-#define DISKSIZE	0xC0000000
-
 struct Super *super;		// superblock
 uint32_t *bitmap;		// bitmap blocks mapped in memory
 
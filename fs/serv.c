@@ -39,6 +39,9 @@ struct OpenFile {
 // Max number of open files in the file system at once
 #define MAXOPEN		1024
 #define FILEVA		0xD0000000
+// Where FSREQ_MAP lines up the block pages it returns, which are
+// scattered over DISKMAP, so they can go out in one IPC
+#define MAPVA		(FILEVA + MAXOPEN * PGSIZE)
 
 // initialize to force into data section
 struct OpenFile opentab[MAXOPEN] = {
@@ -271,6 +274,7 @@ serve_stat(envid_t envid, union Fsipc *ipc)
 	strcpy(ret->ret_name, o->o_file->f_name);
 	ret->ret_size = o->o_file->f_size;
 	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+	ret->ret_version = o->o_file->f_version;
 	return 0;
 }
 
@@ -311,6 +315,45 @@ serve_remove(envid_t envid, struct Fsreq_remove *req)
 	return file_remove(path);
 }
 
+// Map the block cache pages holding req->req_offset and on, up to
+// req->req_npages of them, side by side at MAPVA, and store how many in
+// *npages_store.  Returns the number of file bytes they hold, counted
+// from the start of the first page.
+int
+serve_map(envid_t envid, struct Fsreq_map *req, int *npages_store)
+{
+	struct OpenFile *o;
+	char *blk;
+	off_t pos, size;
+	int i, n, r;
+
+	if (debug)
+		cprintf("serve_map %08x %08x %08x %d\n", envid, req->req_fileid,
+			req->req_offset, req->req_npages);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (req->req_offset < 0 || req->req_npages < 0)
+		return -E_INVAL;
+	pos = ROUNDDOWN(req->req_offset, BLKSIZE);
+	size = o->o_file->f_size;
+	if (pos >= size)
+		return 0;
+	n = MIN(MIN(req->req_npages, FSMAP_PAGES),
+		ROUNDUP(size - pos, BLKSIZE) / BLKSIZE);
+	for (i = 0; i < n; i++) {
+		if ((r = file_get_block(o->o_file, pos / BLKSIZE + i, &blk)) < 0)
+			return r;
+		// Fault the block in from disk before mapping it.
+		*(volatile char *) blk;
+		if ((r = sys_page_map(0, blk, 0, (void *) (MAPVA + i * PGSIZE),
+				      PTE_P|PTE_U)) < 0)
+			return r;
+	}
+	*npages_store = n;
+	return MIN(n * BLKSIZE, size - pos);
+}
+
 // Sync the file system.
 int
 serve_sync(envid_t envid, union Fsipc *req)
@@ -338,7 +381,7 @@ void
 serve(void)
 {
 	uint32_t req, whom;
-	int perm, r;
+	int perm, npages, r, i;
 	void *pg;
 
 	while (1) {
@@ -358,6 +401,22 @@ serve(void)
 		pg = NULL;
 		if (req == FSREQ_OPEN) {
 			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req == FSREQ_MAP) {
+			npages = 0;
+			r = serve_map(whom, &fsreq->map, &npages);
+			if (r > 0) {
+				// Not ipc_send_pages, which panics if the
+				// client did not make room for the pages.
+				i = ipc_try_send_pages(whom, r, (void *) MAPVA,
+						       npages, PTE_P|PTE_U);
+				if (i < 0)
+					ipc_send(whom, i, 0, 0);
+				for (i = 0; i < npages; i++)
+					sys_page_unmap(0, (void *) (MAPVA + i * PGSIZE));
+			} else
+				ipc_send(whom, r, 0, 0);
+			sys_page_unmap(0, fsreq);
+			continue;
 		} else if (req < NHANDLERS && handlers[req]) {
 			r = handlers[req](whom, fsreq);
 		} else {
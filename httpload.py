@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+"""Load generator for the JOS web server (user/httpd).
+
+Opens CONNS keep-alive connections to the server, each in its own
+thread, and on each one sends PIPELINE requests at a time before reading
+the answers, for DURATION seconds.  Prints requests per second and
+latency percentiles, where a request's latency runs from sending its
+batch to receiving the last byte of its own response.
+
+Run the server with "make run-httpd" (or run-httpd-nox), then, from
+another terminal:
+
+    python httpload.py [-c CONNS] [-p PIPELINE] [-d DURATION] [-z SKEW] [URL...]
+
+URL defaults to /index.html on the port QEMU forwards to port 80.
+/data1k, /data64k and /data1m measure static files of those sizes.
+Given several URLs, each request picks one at random, the i'th (from 1)
+with weight 1/i**SKEW: SKEW 0 is uniform, and around 1 a few files get
+most of the requests, which is what httpd's response cache is for.
+"""
+
+import bisect
+import optparse
+import random
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+
+def default_port():
+    # Same forwarding as GNUmakefile: port 80 is reached at
+    # GDBPORT + 2.
+    try:
+        out = subprocess.check_output(["make", "-s", "--no-print-directory",
+                                       "print-gdbport"])
+        return int(out.strip()) + 2
+    except Exception:
+        return 26002
+
+
+class Worker(threading.Thread):
+    def __init__(self, host, port, paths, skew, pipeline, deadline):
+        threading.Thread.__init__(self)
+        self.daemon = True
+        self.addr = (host, port)
+        self.requests = [("GET %s HTTP/1.1\r\nHost: %s\r\n\r\n"
+                          % (path, host)).encode() for path in paths]
+        self.cumweights = []
+        total = 0.0
+        for i in range(len(paths)):
+            total += 1.0 / (i + 1) ** skew
+            self.cumweights.append(total)
+        self.pipeline = pipeline
+        self.deadline = deadline
+        self.latencies = []
+        self.errors = 0
+        self.bytes = 0
+        self.buf = b""
+
+    def read_response(self, sock):
+        # Headers, then Content-Length bytes of body.
+        while b"\r\n\r\n" not in self.buf:
+            self.fill(sock)
+        head, self.buf = self.buf.split(b"\r\n\r\n", 1)
+        length = 0
+        status = head.split(b"\r\n", 1)[0]
+        for line in head.split(b"\r\n")[1:]:
+            name, _, value = line.partition(b":")
+            if name.strip().lower() == b"content-length":
+                length = int(value)
+        while len(self.buf) < length:
+            self.fill(sock)
+        self.buf = self.buf[length:]
+        self.bytes += length
+        return b" 200 " in status
+
+    def pick(self):
+        x = random.random() * self.cumweights[-1]
+        i = bisect.bisect(self.cumweights, x)
+        return self.requests[min(i, len(self.requests) - 1)]
+
+    def fill(self, sock):
+        data = sock.recv(65536)
+        if not data:
+            raise socket.error("connection closed")
+        self.buf += data
+
+    def run(self):
+        sock = None
+        while time.time() < self.deadline:
+            try:
+                if sock is None:
+                    sock = socket.create_connection(self.addr, 10)
+                    self.buf = b""
+                start = time.time()
+                sock.sendall(b"".join(self.pick()
+                                      for i in range(self.pipeline)))
+                for i in range(self.pipeline):
+                    if not self.read_response(sock):
+                        self.errors += 1
+                    self.latencies.append(time.time() - start)
+            except (socket.error, ValueError):
+                self.errors += 1
+                if sock:
+                    sock.close()
+                sock = None
+        if sock:
+            sock.close()
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0.0
+    i = min(len(sorted_values) - 1, int(len(sorted_values) * p / 100.0))
+    return sorted_values[i]
+
+
+def run(host, port, paths, skew, conns, pipeline, duration):
+    """Run the load and return (requests, errors, body bytes, seconds,
+    latencies)."""
+    deadline = time.time() + duration
+    workers = [Worker(host, port, paths, skew, pipeline, deadline)
+               for i in range(conns)]
+    start = time.time()
+    for w in workers:
+        w.start()
+    for w in workers:
+        w.join(duration + 30)
+    elapsed = time.time() - start
+    latencies = sorted(l for w in workers for l in w.latencies)
+    return (len(latencies), sum(w.errors for w in workers),
+            sum(w.bytes for w in workers), elapsed, latencies)
+
+
+def main():
+    parser = optparse.OptionParser(usage="%prog [options] [URL]")
+    parser.add_option("-c", dest="conns", type="int", default=16,
+                      help="concurrent connections (default 16)")
+    parser.add_option("-p", dest="pipeline", type="int", default=4,
+                      help="requests in flight per connection (default 4)")
+    parser.add_option("-d", dest="duration", type="float", default=10,
+                      help="seconds to run (default 10)")
+    parser.add_option("-z", dest="skew", type="float", default=1.0,
+                      help="skew of the URL distribution (default 1)")
+    parser.add_option("--host", default="127.0.0.1")
+    parser.add_option("--port", type="int", default=0)
+    opts, args = parser.parse_args()
+    paths = args or ["/index.html"]
+    port = opts.port or default_port()
+
+    n, errors, nbytes, elapsed, lat = run(opts.host, port, paths, opts.skew,
+                                          opts.conns, opts.pipeline,
+                                          opts.duration)
+    print("%d requests in %.1f s, %.1f requests/s, %.2f MB/s, %d errors"
+          % (n, elapsed, n / elapsed, nbytes / elapsed / 1e6, errors))
+    print("latency ms: p50 %.1f  p90 %.1f  p99 %.1f  max %.1f"
+          % tuple(1000 * percentile(lat, p) for p in (50, 90, 99, 100)))
+    return 0 if n and not errors else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
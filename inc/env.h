@@ -29,6 +29,9 @@ typedef int32_t envid_t;
 #define NENV			(1 << LOG2NENV)
 #define ENVX(envid)		((envid) & (NENV - 1))
 
+// Most pages one IPC message can carry.
+#define IPC_MAXPAGES		32
+
 // Values of env_status in struct Env
 enum {
 	ENV_FREE = 0,
@@ -44,6 +47,7 @@ enum EnvType {
 	ENV_TYPE_IDLE,
 	ENV_TYPE_FS,		// File system server
 	ENV_TYPE_NS,		// Network server
+	ENV_TYPE_NS_HELPER,	// Forked by it: its other shards and helpers
 };
 
 struct Env {
@@ -54,13 +58,18 @@ struct Env {
 	enum EnvType env_type;		// Indicates special system environments
 	unsigned env_status;		// Status of the environment
 	uint32_t env_runs;		// Number of times environment has run
+	uint32_t env_syscalls;		// Number of system calls it has made
+	uint64_t env_cycles;		// TSC cycles its CPUs spent on it
 	int env_cpunum;			// The CPU that the env is running on
+	int env_netq;			// Network receive queue it is bound to
 
 	// Address space
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
+	int env_batch_done;		// Ops completed by last sys_page_batch
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	uintptr_t env_uxstacktop;	// Top of its user exception stack
 
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
@@ -68,6 +77,21 @@ struct Env {
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
+	int env_ipc_maxpages;		// Pages we are willing to receive
+	int env_ipc_npages;		// Pages actually received
+	uint32_t env_ipc_nrecv;		// Calls to sys_ipc_recv so far; senders
+					// sys_futex_wait on it (see ipc_send)
+
+	// Alarm (see sys_alarm)
+	uint32_t env_alarm;		// When it goes off next, or 0 if unset
+	uint32_t env_alarm_period;	// Interval of a periodic alarm, or 0
+	uint32_t env_alarm_value;	// IPC value it delivers
+	bool env_alarm_pending;		// Went off while not receiving
+
+	// Futex wait (see sys_futex_wait)
+	physaddr_t env_futex_pa;	// Word it sleeps on, or 0
+	uint32_t env_futex_deadline;	// When it stops waiting, or ~0
+	struct Env *env_futex_link;	// Next in its futex hash chain
 };
 
 #endif // !JOS_INC_ENV_H
@@ -26,6 +26,12 @@ enum {
 	E_NOT_EXEC	= 14,	// File not a valid executable
 	E_NOT_SUPP	= 15,	// Operation not supported
 
+	// Network error codes -- only seen in user-level
+	E_AGAIN		= 16,	// Nonblocking operation would have blocked
+
+	E_TIMEOUT	= 17,	// Wait timed out
+	E_BUSY		= 18,	// Resource already in use by another env
+
 	MAXERROR
 };
 
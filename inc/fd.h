@@ -21,6 +21,22 @@ struct Dev {
 	int (*dev_close)(struct Fd *fd);
 	int (*dev_stat)(struct Fd *fd, struct Stat *stat);
 	int (*dev_trunc)(struct Fd *fd, off_t length);
+	// Which of 'events' (POLL*) fd is ready for right now, without
+	// blocking.  Devices without one are always ready.
+	int (*dev_poll)(struct Fd *fd, int events);
+};
+
+// poll() events
+#define POLLIN		0x001	// Data to read, or a connection to accept
+#define POLLOUT		0x004	// Room to write
+#define POLLERR		0x008	// Returned only
+#define POLLHUP		0x010	// Returned only: the other end is gone
+#define POLLNVAL	0x020	// Returned only: fd is not open
+
+struct pollfd {
+	int fd;
+	short events;		// POLL* to wait for
+	short revents;		// POLL* that happened
 };
 
 struct FdFile {
@@ -47,6 +63,7 @@ struct Stat {
 	char st_name[MAXNAMELEN];
 	off_t st_size;
 	int st_isdir;
+	uint32_t st_version;	// Changes when the file does; 0 if not a file
 	struct Dev *st_dev;
 };
 
@@ -26,6 +26,14 @@
 
 #define MAXFILESIZE	((NDIRECT + NINDIRECT) * BLKSIZE)
 
+/* Disk block n, when in memory, is mapped into the file system
+ * server's address space at DISKMAP + (n*BLKSIZE).  The kernel
+ * drops clean blocks from this region under memory pressure. */
+#define DISKMAP		0x10000000
+
+/* Maximum disk size we can handle (3GB) */
+#define DISKSIZE	0xC0000000
+
 struct File {
 	char f_name[MAXNAMELEN];	// filename
 	off_t f_size;			// file size in bytes
@@ -36,9 +44,13 @@ struct File {
 	uint32_t f_direct[NDIRECT];	// direct blocks
 	uint32_t f_indirect;		// indirect block
 
+	// Changed each time the file is created, written, truncated or
+	// removed, to one no file has had before (Super.s_version)
+	uint32_t f_version;
+
 	// Pad out to 256 bytes; must do arithmetic in case we're compiling
 	// fsformat on a 64-bit machine.
-	uint8_t f_pad[256 - MAXNAMELEN - 8 - 4*NDIRECT - 4];
+	uint8_t f_pad[256 - MAXNAMELEN - 8 - 4*NDIRECT - 4 - 4];
 } __attribute__((packed));	// required only on some 64-bit machines
 
 // An inode block contains exactly BLKFILES 'struct File's
@@ -57,6 +69,7 @@ struct Super {
 	uint32_t s_magic;		// Magic number: FS_MAGIC
 	uint32_t s_nblocks;		// Total number of blocks on disk
 	struct File s_root;		// Root directory node
+	uint32_t s_version;		// Last f_version handed out
 };
 
 // Definitions for requests from clients to file system
@@ -70,9 +83,15 @@ enum {
 	FSREQ_STAT,
 	FSREQ_FLUSH,
 	FSREQ_REMOVE,
-	FSREQ_SYNC
+	FSREQ_SYNC,
+	// Map replies with the file's block cache pages themselves,
+	// read-only, instead of a copy of their contents
+	FSREQ_MAP
 };
 
+// Most block pages one FSREQ_MAP returns
+#define FSMAP_PAGES	16
+
 union Fsipc {
 	struct Fsreq_open {
 		char req_path[MAXPATHLEN];
@@ -101,6 +120,7 @@ union Fsipc {
 		char ret_name[MAXNAMELEN];
 		off_t ret_size;
 		int ret_isdir;
+		uint32_t ret_version;
 	} statRet;
 	struct Fsreq_flush {
 		int req_fileid;
@@ -108,6 +128,11 @@ union Fsipc {
 	struct Fsreq_remove {
 		char req_path[MAXPATHLEN];
 	} remove;
+	struct Fsreq_map {
+		int req_fileid;
+		off_t req_offset;
+		int req_npages;
+	} map;
 
 	// Ensure Fsipc is one page
 	char _pad[PGSIZE];
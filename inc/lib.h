@@ -22,6 +22,7 @@
 #include <inc/args.h>
 #include <inc/malloc.h>
 #include <inc/ns.h>
+#include <inc/x86.h>
 
 #define USED(x)		(void)(x)
 
@@ -30,7 +31,7 @@ void	umain(int argc, char **argv);
 
 // libmain.c or entry.S
 extern const char *binaryname;
-extern const volatile struct Env *thisenv;
+extern const volatile struct Env *thread_envs[NTHREADS];
 extern const volatile struct Env envs[NENV];
 extern const volatile struct Page pages[];
 
@@ -59,10 +60,26 @@ int	sys_page_map(envid_t src_env, void *src_pg,
 int	sys_page_unmap(envid_t env, void *pg);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_ipc_try_send_pages(envid_t to_env, uint32_t value, void *pg, int perm,
+			       int npages);
+int	sys_ipc_recv_pages(void *rcv_pg, int maxpages);
 unsigned int sys_time_msec(void);
 int sys_net_transmit(void *src, size_t len);
 int sys_net_receive(void *dst);
 int sys_get_mac(uint32_t *low, uint32_t *high);
+int	sys_page_batch(struct PageOp *ops, int n);
+int	sys_tlb_stats(struct TlbStats *ts);
+int	sys_net_recv_pages(void *va, int n);
+int	sys_net_stats(struct NetStats *ns);
+int	sys_net_transmit_sg(struct NetFrag *frags, int nfrag,
+			    struct NetOffload *off);
+int	sys_net_transmit_batch(struct NetFrag *frames, int n);
+int	sys_net_set_queue(int q);
+int	sys_net_listen(uint16_t port, bool on);
+int	sys_alarm(uint32_t msec, uint32_t period, uint32_t value);
+int	sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec);
+int	sys_futex_wake(volatile uint32_t *addr, int n);
+envid_t	sys_exofork_shared(void *eip, void *esp, void *uxstacktop);
 
 // This must be inlined.  Exercise for reader: why?
 static __inline envid_t __attribute__((always_inline))
@@ -80,18 +97,58 @@ sys_exofork(void)
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+void	ipc_send_pages(envid_t to_env, uint32_t value, void *pg, int npages,
+		       int perm);
+int32_t ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+		       int *perm_store, int *npages_store);
+int	ipc_try_send_pages(envid_t to_env, uint32_t value, void *pg,
+			   int npages, int perm);
 envid_t	ipc_find_env(enum EnvType type);
 
+// pgbatch.c
+#define PGBATCH_MAX	32
+struct PageBatch {
+	int pb_n;
+	struct PageOp pb_ops[PGBATCH_MAX];
+};
+void	pgbatch_init(struct PageBatch *pb);
+int	pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm);
+int	pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+		    envid_t dst_env, void *dst_pg, int perm);
+int	pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg);
+int	pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm);
+int	pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+			envid_t dst_env, int cowbits);
+int	pgbatch_flush(struct PageBatch *pb);
+
 // fork.c
-#define	PTE_SHARE	0x400
+// PTE_COW marks copy-on-write page table entries.
+// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
+#define PTE_COW		0x800
+
 envid_t	fork(void);
-envid_t	sfork(void);	// Challenge!
+envid_t	sfork(void (*fn)(void *), void *arg);
+extern bool sforked;
+
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+
+	return slot < NTHREADS ? slot : 0;
+}
+
+// Our Env: each thread sharing the address space has its own.
+#define thisenv		(thread_envs[thread_slot()])
 
 // fd.c
 int	close(int fd);
 ssize_t	read(int fd, void *buf, size_t nbytes);
 ssize_t	write(int fd, const void *buf, size_t nbytes);
 int	seek(int fd, off_t offset);
+int	fcntl(int fd, int cmd, int arg);
 void	close_all(void);
 ssize_t	readn(int fd, void *buf, size_t nbytes);
 int	dup(int oldfd, int newfd);
@@ -103,20 +160,40 @@ int	open(const char *path, int mode);
 int	ftruncate(int fd, off_t size);
 int	remove(const char *path);
 int	sync(void);
+int	fmap(int fd, off_t offset, void *dstva, int maxpages);
 
 // pageref.c
 int	pageref(void *addr);
 
 // sockets.c
+struct iovec {
+	void *iov_base;
+	size_t iov_len;
+};
+
+struct msghdr {
+	void *msg_name;			// Unused: the socket must be connected
+	socklen_t msg_namelen;
+	struct iovec *msg_iov;		// Buffers to gather or scatter
+	int msg_iovlen;
+	int msg_flags;			// Set to 0 by recvmsg
+};
+
 int     accept(int s, struct sockaddr *addr, socklen_t *addrlen);
 int     bind(int s, struct sockaddr *name, socklen_t namelen);
 int     shutdown(int s, int how);
 int     connect(int s, const struct sockaddr *name, socklen_t namelen);
 int     listen(int s, int backlog);
 int     socket(int domain, int type, int protocol);
+ssize_t	sendmsg(int s, const struct msghdr *msg, int flags);
+ssize_t	recvmsg(int s, struct msghdr *msg, int flags);
+ssize_t	sendfile(int s, int fd, off_t offset, size_t len);
+int	evctl(int s, int events);
+int	evwait(struct pollfd *evs, int maxevents, int timeout);
 
 // nsipc.c
-int     nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen);
+int     nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+		     unsigned int flags);
 int     nsipc_bind(int s, struct sockaddr *name, socklen_t namelen);
 int     nsipc_shutdown(int s, int how);
 int     nsipc_close(int s);
@@ -124,7 +201,22 @@ int     nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen);
 int     nsipc_listen(int s, int backlog);
 int     nsipc_recv(int s, void *mem, int len, unsigned int flags);
 int     nsipc_send(int s, const void *buf, int size, unsigned int flags);
+int     nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags);
+int     nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags);
+int     nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags);
+int     nsipc_select(int nfds, fd_set *readset, fd_set *writeset,
+		     fd_set *exceptset, int msec);
+int     nsipc_evctl(int s, int events, int data);
+int     nsipc_evwait(struct pollfd *evs, int max, int timeout);
 int     nsipc_socket(int domain, int type, int protocol);
+int     nsipc_offload(int flags);
+int     nsipc_shard(int shard);
+int     nsipc_memstats(struct Nsret_memstats *st);
+
+// poll.c
+int	poll(struct pollfd *fds, int nfds, int timeout);
+int	select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	       struct timeval *timeout);
 
 // spawn.c
 envid_t	spawn(const char *program, const char **argv);
@@ -140,6 +232,26 @@ int	opencons(void);
 int	pipe(int pipefds[2]);
 int	pipeisclosed(int pipefd);
 
+// sync.c: mutexes and condition variables for envs that share the
+// page they are in (PTE_SHARE, or an sfork'ed address space).
+// All zeros is a free mutex and a condition nobody waits on.
+struct mutex {
+	volatile uint32_t m_state;	// 0 free, 1 held, 2 held and waited for
+};
+struct cond {
+	volatile uint32_t c_seq;	// Signals and broadcasts so far
+	volatile uint32_t c_nwait;	// Envs in cond_wait
+};
+void	mutex_init(struct mutex *m);
+void	mutex_lock(struct mutex *m);
+bool	mutex_trylock(struct mutex *m);
+void	mutex_unlock(struct mutex *m);
+void	cond_init(struct cond *c);
+void	cond_wait(struct cond *c, struct mutex *m);
+int	cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec);
+void	cond_signal(struct cond *c);
+void	cond_broadcast(struct cond *c);
+
 // wait.c
 void	wait(envid_t env);
 
@@ -153,5 +265,11 @@ void	wait(envid_t env);
 #define	O_TRUNC		0x0200		/* truncate to zero length */
 #define	O_EXCL		0x0400		/* error if already exists */
 #define O_MKDIR		0x0800		/* create directory, not regular file */
+#undef	O_NONBLOCK			/* lwIP's, for its own sockets */
+#define	O_NONBLOCK	0x1000		/* return -E_AGAIN instead of waiting */
+
+/* fcntl commands */
+#define	F_GETFL		3		/* get open mode */
+#define	F_SETFL		4		/* set O_NONBLOCK */
 
 #endif	// !JOS_INC_LIB_H
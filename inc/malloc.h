@@ -1,7 +1,33 @@
 #ifndef JOS_INC_MALLOC_H
 #define JOS_INC_MALLOC_H 1
 
+struct mstats {
+	size_t ms_arena;	// Bytes of pages the heap has mapped
+	size_t ms_inuse;	// ... handed out, rounded up to size classes
+	size_t ms_slabs;	// Pages cut up into small objects
+	size_t ms_slabfree;	// Bytes of free objects in those pages
+	size_t ms_spanfree;	// Bytes of free pages kept for reuse
+	size_t ms_cached;	// Bytes of free objects in thread caches
+	uint32_t ms_nmalloc;	// Calls to malloc
+	uint32_t ms_cachehits;	// ... that a thread cache answered
+};
+
+// Free small objects kept for one thread; see lib/malloc.c.
+#define MCACHE_NCLASS	22	// Size classes
+#define MCACHE_MAX	16	// Objects kept per class, at most
+
+struct mcache {
+	void *mc_free[MCACHE_NCLASS];
+	uint8_t mc_n[MCACHE_NCLASS];
+};
+
+extern struct mcache *mcache_cur;	// The running thread's, or NULL
+
 void *malloc(size_t size);
+void *calloc(size_t nmemb, size_t size);
+void *realloc(void *addr, size_t size);
 void free(void *addr);
+void malloc_stats(struct mstats *st);
+void mcache_flush(struct mcache *mc);
 
 #endif
@@ -124,6 +124,11 @@
 // Next page left invalid to guard against exception stack overflow; then:
 // Top of normal user stack
 #define USTACKTOP	(UTOP - 2*PGSIZE)
+// Threads (see sfork) get TSTACKSIZE of stack space each: slot i ends
+// i*TSTACKSIZE below UTOP, and is laid out like the top of the first
+// thread's, which is slot 0.  The slots take NTHREADS*TSTACKSIZE.
+#define TSTACKSIZE	(8*PGSIZE)
+#define NTHREADS	32
 
 // Where user programs generally begin
 #define UTEXT		(2*PTSIZE)
@@ -188,6 +193,13 @@ struct Page {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// Reverse mappings: the page table entries that map this page
+	// (see kern/pmap.c).  Only meaningful inside the kernel.
+	struct Rmap *pp_rmap;
+
+	// tlb_round when the page was last freed (see page_alloc).
+	uint32_t pp_free_round;
 };
 
 #endif /* !__ASSEMBLER__ */
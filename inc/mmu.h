@@ -69,6 +69,11 @@
 // hardware, so user processes are allowed to set them arbitrarily.
 #define PTE_AVAIL	0xE00	// Available for software use
 
+// User processes mark pages that fork and spawn should share, rather
+// than copy, with PTE_SHARE.  The kernel relies on it only to decide
+// which entries may stay writable in a shared page table.
+#define PTE_SHARE	0x400
+
 // Flags in PTE_SYSCALL may be used in system calls.  (Others may not.)
 #define PTE_SYSCALL	(PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
@@ -89,6 +94,7 @@
 #define CR0_PG		0x80000000	// Paging
 
 #define CR4_PCE		0x00000100	// Performance counter enable
+#define CR4_PGE		0x00000080	// Page Global Enable
 #define CR4_MCE		0x00000040	// Machine Check Enable
 #define CR4_PSE		0x00000010	// Page Size Extensions
 #define CR4_DE		0x00000008	// Debugging Extensions
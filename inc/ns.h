@@ -5,10 +5,20 @@
 
 #include <inc/types.h>
 #include <inc/mmu.h>
+#include <inc/fd.h>
+#include <inc/malloc.h>
 #include <lwip/sockets.h>
 
+// Data pages that can follow a NSREQ_SENDMSG or NSREQ_RECVMSG request
+#define NSBULK_PAGES	16
+
+// recvmsg flag: after the first buffer, also return whatever else is
+// already queued on the socket, up to the length asked for.
+#define MSG_BATCH	0x100
+
 struct jif_pkt {
 	int jp_len;
+	int jp_flags;		// JP_* in kern/e1000.h, for received packets
 	char jp_data[0];
 };
 
@@ -26,6 +36,34 @@ enum {
 	NSREQ_RECV,
 	NSREQ_SEND,
 	NSREQ_SOCKET,
+	// Offload sets the checksum and segmentation offloads (NETOFF_*)
+	// the server asks of the card, and returns the old ones.
+	NSREQ_OFFLOAD,
+	// Shard returns the env id of network server shard req_shard.
+	// There is one shard per network receive queue; shard 0 is the
+	// ENV_TYPE_NS env, and only it answers.
+	NSREQ_SHARD,
+	// Sendmsg and recvmsg carry up to NSBULK_PAGES pages of data right
+	// after the request page, so large transfers are mapped, not copied.
+	// Sendmsg's data starts req_off bytes into them, and may be the
+	// client's own pages, mapped read-only.
+	NSREQ_SENDMSG,
+	NSREQ_RECVMSG,
+	// Select waits, up to req_timeout msec (forever if < 0), for any of
+	// the sockets in the sets to become ready, as lwip_select does, and
+	// returns the ready ones in the sets on the request page.
+	NSREQ_SELECT,
+	// Evctl registers a socket with the sender's readiness queue, and
+	// evwait drains the queue into an array of struct pollfd on the
+	// request page, waiting up to req_timeout msec for the first event.
+	NSREQ_EVCTL,
+	NSREQ_EVWAIT,
+	// Sendfile is sendmsg for data pages the client got read-only from
+	// the file server: it sends req_size bytes from req_off into them.
+	NSREQ_SENDFILE,
+	// Memstats returns how much memory the server uses: its heap, and
+	// every page it has mapped.
+	NSREQ_MEMSTATS,
 
 	// The following two messages pass a page containing a struct jif_pkt
 	NSREQ_INPUT,
@@ -33,13 +71,15 @@ enum {
 	// network server, to the output environment
 	NSREQ_OUTPUT,
 
-	// The following message passes no page
+	// The following message passes no page.  It is the value of the
+	// kernel alarm (sys_alarm) that wakes the server for its timers.
 	NSREQ_TIMER,
 };
 
 union Nsipc {
 	struct Nsreq_accept {
 		int req_s;
+		unsigned int req_flags;		// MSG_DONTWAIT or 0
 	} accept;
 
 	struct Nsret_accept {
@@ -90,12 +130,68 @@ union Nsipc {
 		char req_buf[0];
 	} send;
 
+	struct Nsreq_sendmsg {
+		int req_s;
+		int req_off;
+		int req_size;
+		unsigned int req_flags;
+	} sendmsg;
+
+	struct Nsreq_sendfile {
+		int req_s;
+		int req_off;
+		int req_size;
+		unsigned int req_flags;
+	} sendfile;
+
+	struct Nsreq_recvmsg {
+		int req_s;
+		int req_len;
+		unsigned int req_flags;
+	} recvmsg;
+
+	struct Nsreq_select {
+		int req_nfds;
+		fd_set req_readset;
+		fd_set req_writeset;
+		fd_set req_exceptset;
+		int req_timeout;
+	} select;
+
+	struct Nsreq_evctl {
+		int req_s;
+		int req_events;		// POLLIN | POLLOUT, or 0 to stop
+		int req_data;		// Returned in pollfd.fd
+	} evctl;
+
+	struct Nsreq_evwait {
+		int req_max;
+		int req_timeout;
+	} evwait;
+
+	struct Nsret_evwait {
+		struct pollfd ret_ev[0];
+	} evwaitRet;
+
 	struct Nsreq_socket {
 		int req_domain;
 		int req_type;
 		int req_protocol;
 	} socket;
 
+	struct Nsreq_offload {
+		int req_flags;
+	} offload;
+
+	struct Nsreq_shard {
+		int req_shard;
+	} shard;
+
+	struct Nsret_memstats {
+		struct mstats ret_malloc;
+		int ret_pages;
+	} memstatsRet;
+
 	struct jif_pkt pkt;
 
 	// Ensure Nsipc is one page
@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
 	SYS_cputs = 0,
@@ -21,7 +23,116 @@ enum {
 	SYS_net_transmit,
 	SYS_net_receive,
 	SYS_get_mac,
+	SYS_page_batch,
+	SYS_tlb_stats,
+	SYS_net_recv_pages,
+	SYS_net_stats,
+	SYS_net_transmit_sg,
+	SYS_net_transmit_batch,
+	SYS_net_set_queue,
+	SYS_net_listen,
+	SYS_alarm,
+	SYS_futex_wait,
+	SYS_futex_wake,
+	SYS_exofork_shared,
 	NSYSCALLS
 };
 
+// Operations accepted by SYS_page_batch
+enum {
+	PAGEOP_ALLOC = 1,	// sys_page_alloc(po_dstenv, po_dstva, po_perm)
+	PAGEOP_MAP,		// sys_page_map(po_srcenv, po_srcva,
+				//	po_dstenv, po_dstva, po_perm)
+	PAGEOP_UNMAP,		// sys_page_unmap(po_dstenv, po_dstva)
+	PAGEOP_PROTECT,		// change perm of the page at po_dstva
+	PAGEOP_SHAREPT,		// share the page table at po_srcva in
+				// po_srcenv with po_dstenv; writable pages
+				// become read-only with the PTE_AVAIL bits
+				// in po_perm set (see pgdir_share)
+};
+
+// One entry of a SYS_page_batch request.
+struct PageOp {
+	int po_op;
+	int32_t po_srcenv;
+	void *po_srcva;
+	int32_t po_dstenv;
+	void *po_dstva;
+	int po_perm;
+};
+
+// TLB shootdown counters returned by SYS_tlb_stats
+struct TlbStats {
+	uint32_t ts_queued;	// Remote invalidations requested
+	uint32_t ts_full;	// ... turned into full flushes
+	uint32_t ts_rounds;	// Shootdown rounds that sent IPIs
+	uint32_t ts_ipis;	// IPIs sent
+	uint32_t ts_cr3loads;	// Address space switches that reloaded CR3
+};
+
+// Most receive queues the network driver steers packets to
+// (see SYS_net_set_queue)
+#define NETQ_MAX	4
+
+// Network driver counters returned by SYS_net_stats
+struct NetStats {
+	uint32_t ns_rx_packets;	// Packets received
+	uint32_t ns_rx_bytes;	// ... and their total length
+	uint32_t ns_rx_copies;	// Packets the kernel copied out of the ring
+	uint32_t ns_tx_packets;	// Packets transmitted
+	uint32_t ns_tx_bytes;	// ... and their total length
+	uint32_t ns_tx_copies;	// Packets the kernel copied into the ring
+	uint32_t ns_rx_missed;	// Packets dropped for want of a descriptor
+	uint32_t ns_tx_ring;	// Transmit descriptors in the ring
+	uint32_t ns_tx_inuse;	// ... posted and not yet reclaimed
+	uint32_t ns_tx_inuse_max; // ... the most seen so far
+	uint32_t ns_rx_ring;	// Receive descriptors in the ring
+	uint32_t ns_rx_ready;	// ... holding packets not yet read
+	uint32_t ns_rx_ready_max; // ... the most seen so far
+	uint32_t ns_tx_csum;	// Packets the card checksummed for us
+	uint32_t ns_tx_tso;	// ... and cut into segments
+	uint32_t ns_rx_csum_ok;	// Packets whose checksums the card verified
+	uint32_t ns_rx_csum_bad; // ... and found wrong
+	uint32_t ns_rx_queues;	// Receive queues packets are steered to
+	uint32_t ns_rxq_packets[NETQ_MAX]; // Packets steered to each queue
+	uint32_t ns_rxq_drops;	// Packets dropped because their queue was full
+};
+
+// One fragment of a packet passed to SYS_net_transmit_sg
+struct NetFrag {
+	void *nf_va;
+	uint32_t nf_len;
+};
+
+// Maximum number of fragments in one SYS_net_transmit_sg request
+#define NETFRAG_MAX	16
+
+// Work SYS_net_transmit_sg may hand to the card for an IPv4 packet.
+// Offsets are from the start of the frame.  For checksums, the IP
+// checksum field must be 0 and the TCP/UDP one must hold the sum of
+// the pseudo-header; for TSO, that sum leaves out the length.
+struct NetOffload {
+	uint8_t no_flags;	// NETOFF_* below
+	uint8_t no_l3off;	// Start of the IP header
+	uint8_t no_l4off;	// Start of the TCP or UDP header
+	uint8_t no_hdrlen;	// TSO: length of all headers
+	uint16_t no_mss;	// TSO: payload bytes per segment
+};
+
+#define NETOFF_IPCSUM	0x1	// Fill in the IP header checksum
+#define NETOFF_TCPCSUM	0x2	// Fill in the TCP checksum
+#define NETOFF_UDPCSUM	0x4	// Fill in the UDP checksum
+#define NETOFF_TSO	0x8	// Cut a TCP packet into no_mss segments
+#define NETOFF_ALL	0xf
+
+// Largest packet SYS_net_transmit_sg accepts with NETOFF_TSO
+#define NETTSO_MAX	0xffff
+
+// Maximum number of packets in one SYS_net_transmit_batch or
+// SYS_net_recv_pages request
+#define NETBATCH_MAX	32
+
+// Maximum number of entries in one SYS_page_batch request
+#define PAGEOP_MAX	256
+
 #endif /* !JOS_INC_SYSCALL_H */
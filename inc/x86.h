@@ -293,4 +293,29 @@ xchg(volatile uint32_t *addr, uint32_t newval)
 	return result;
 }
 
+// Atomically set *addr to 'newval' if it is 'oldval'.  Returns the value
+// *addr had, which is 'oldval' if the swap happened.
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+			"=a" (result), "+m" (*addr) :
+			"r" (newval), "0" (oldval) :
+			"cc");
+	return result;
+}
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+			"+r" (n), "+m" (*addr) :
+			:
+			"cc");
+	return n;
+}
+
 #endif /* !JOS_INC_X86_H */
@@ -16,12 +16,25 @@ enum {
 	CPU_STARTED,
 };
 
+// Addresses queued for a TLB shootdown before falling back to a full flush
+#define TLB_BATCH	16
+#define TLB_FLUSH_ALL	(TLB_BATCH + 1)
+
 // Per-CPU state
 struct Cpu {
 	uint8_t cpu_id;                 // Local APIC ID; index into cpus[] below
 	volatile unsigned cpu_status;   // The status of the CPU
 	struct Env *cpu_env;            // The currently-running environment.
+	uint64_t cpu_charged;           // TSC when cpu_env was last charged
 	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+
+	// TLB shootdown state (see kern/tlb.c)
+	pde_t *volatile cpu_pgdir;      // Page directory loaded in CR3
+	volatile bool cpu_tlb_locking;  // Trapped, waiting for the kernel lock
+	volatile uint32_t cpu_tlb_gen;  // Shootdowns posted to this CPU
+	volatile uint32_t cpu_tlb_done; // Shootdowns it has carried out
+	int cpu_tlb_n;                  // Queued addresses, or TLB_FLUSH_ALL
+	uintptr_t cpu_tlb_va[TLB_BATCH];
 };
 
 // Initialized in mpconfig.c
@@ -41,5 +54,6 @@ void lapic_init(void);
 void lapic_startap(uint8_t apicid, uint32_t addr);
 void lapic_eoi(void);
 void lapic_ipi(int vector);
+void lapic_ipi_cpu(int apicid, int vector);
 
 #endif
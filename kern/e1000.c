@@ -1,16 +1,450 @@
 #include <inc/memlayout.h>
 #include <inc/string.h>
+#include <inc/error.h>
+#include <inc/syscall.h>
 
 #include <kern/e1000.h>
 #include <kern/pci.h>
 #include <kern/pmap.h>
+#include <kern/env.h>
+#include <kern/picirq.h>
+#include <kern/cpu.h>
 
 // LAB 6: Your driver code here
 extern pde_t *kern_pgdir;
-struct tx_desc tx_fifo[TX_SIZE]__attribute__((aligned(16)));
-struct rx_desc rx_fifo[RX_SIZE]__attribute__((aligned(16)));
-uint8_t *tx_buffer[TX_SIZE * MAX_PACKET_SIZE];
-uint8_t *rx_buffer[RX_SIZE * BUFFER_SIZE]; // 2048 bytes buffer for per rx descriptor
+int ntx, nrx;			// Ring sizes chosen by attach_e1000
+struct tx_desc *tx_fifo;	// One page each, allocated at attach time
+struct rx_desc *rx_fifo;
+static struct Page *tx_bufs[RING_MAX / 2]; // Copy buffers, two per page
+struct Page *rx_pages[RING_MAX];	// Page each rx descriptor receives into
+struct NetStats e1000_stats;
+uint8_t e1000_irq;
+static int rx_next;		// Next rx descriptor the card will fill
+static int tx_clean;			// Oldest descriptor not yet reclaimed
+static struct Page *tx_pages[RING_MAX];	// Page held by each sg descriptor
+static uint8_t tx_sg_queue[RING_MAX];	// ... and the queue of its sender
+static uint32_t tx_sg_done[NETQ_MAX];	// Sg packets sent, not yet reported,
+					// by queue of their sender
+
+// Copy buffer of transmit descriptor 'i'
+static void *
+tx_buffer(int i)
+{
+	return page2kva(tx_bufs[i / 2]) + (i % 2) * BUFFER_SIZE;
+}
+
+// Fill in transmit descriptor 'i'.  Only every TX_RS_EVERY'th
+// descriptor asks the card to report completion.  Extended (DEXT)
+// descriptors take the checksum options in 'popts'.
+static void
+tx_post(int i, physaddr_t addr, uint16_t len, uint8_t cmd, uint8_t popts)
+{
+	if (i % TX_RS_EVERY == TX_RS_EVERY - 1)
+		cmd |= E1000_TXD_CMD_RS;
+	tx_fifo[i].addr = addr;
+	tx_fifo[i].length = len;
+	tx_fifo[i].cso = (cmd & E1000_TXD_CMD_DEXT) ? E1000_TXD_DTYP_D : 0;
+	tx_fifo[i].cmd = cmd;
+	tx_fifo[i].status = 0;
+	tx_fifo[i].css = popts;
+	tx_fifo[i].special = 0;
+}
+
+// The context the card last loaded.  It keeps it across packets, so
+// a packet that needs the same one does not pay for another descriptor.
+static struct tx_ctx_desc tx_ctx;
+
+// Build the context for a 'total'-byte packet with offloads 'off'.
+static void
+tx_ctx_build(struct tx_ctx_desc *c, const struct NetOffload *off, size_t total)
+{
+	memset(c, 0, sizeof(*c));
+	c->ipcss = off->no_l3off;
+	c->ipcso = off->no_l3off + 10;
+	c->ipcse = off->no_l4off - 1;
+	c->tucss = off->no_l4off;
+	c->tucso = off->no_l4off + ((off->no_flags & NETOFF_UDPCSUM) ? 6 : 16);
+	c->paylen = E1000_TXD_TUCMD_DEXT | E1000_TXD_TUCMD_IP;
+	if (!(off->no_flags & NETOFF_UDPCSUM))
+		c->paylen |= E1000_TXD_TUCMD_TCP;
+	if (off->no_flags & NETOFF_TSO) {
+		c->paylen |= E1000_TXD_TUCMD_TSE | (total - off->no_hdrlen);
+		c->hdrlen = off->no_hdrlen;
+		c->mss = off->no_mss;
+	}
+}
+
+// Check that 'off' describes something the card can do for a
+// 'total'-byte packet.
+static int
+tx_offload_check(const struct NetOffload *off, size_t total)
+{
+	if (off->no_flags & ~NETOFF_ALL)
+		return -E_INVAL;
+	if ((off->no_flags & NETOFF_TCPCSUM) && (off->no_flags & NETOFF_UDPCSUM))
+		return -E_INVAL;
+	if (off->no_l4off < off->no_l3off + 20 || off->no_l4off + 8 > total)
+		return -E_INVAL;
+	if (!(off->no_flags & NETOFF_TSO))
+		return total <= MAX_PACKET_SIZE ? 0 : -E_INVAL;
+	if ((off->no_flags & (NETOFF_IPCSUM | NETOFF_TCPCSUM))
+	    != (NETOFF_IPCSUM | NETOFF_TCPCSUM))
+		return -E_INVAL;
+	if (off->no_hdrlen < off->no_l4off + 20 || off->no_hdrlen >= total
+	    || off->no_mss == 0 || off->no_hdrlen + off->no_mss > MAX_PACKET_SIZE)
+		return -E_INVAL;
+	return total <= NETTSO_MAX ? 0 : -E_INVAL;
+}
+
+// Release the pages of the descriptors the card has finished with.
+// Since only some descriptors report completion, a finished RS
+// descriptor also accounts for all descriptors before it.
+static void
+tx_reclaim(void)
+{
+	int tail = e100[E1000_TDT/sizeof(uint32_t)];
+	int rs;
+
+	while (tx_clean != tail) {
+		for (rs = tx_clean; rs != tail; rs = (rs + 1) % ntx)
+			if (tx_fifo[rs].cmd & E1000_TXD_CMD_RS)
+				break;
+		if (rs == tail || !(tx_fifo[rs].status & E1000_TXD_STAT_DD))
+			break;
+		for (;;) {
+			if (tx_pages[tx_clean]) {
+				page_decref(tx_pages[tx_clean]);
+				tx_pages[tx_clean] = NULL;
+				if (tx_fifo[tx_clean].cmd & E1000_TXD_CMD_EOP)
+					tx_sg_done[tx_sg_queue[tx_clean]]++;
+			}
+			if (tx_clean == rs)
+				break;
+			tx_clean = (tx_clean + 1) % ntx;
+		}
+		tx_clean = (rs + 1) % ntx;
+	}
+}
+
+// Number of descriptors we may post (one stays empty, since
+// head == tail means an empty ring).
+static int
+tx_free(void)
+{
+	int tail = e100[E1000_TDT/sizeof(uint32_t)];
+
+	return (tx_clean - tail - 1 + ntx) % ntx;
+}
+
+// Number of received packets waiting in the ring.
+static int
+rx_ready(void)
+{
+	int i, n = 0;
+
+	for (i = rx_next; n < nrx - 1 && (rx_fifo[i].status & E1000_RXD_STAT_DD);
+	     i = (i + 1) % nrx)
+		n++;
+	return n;
+}
+
+// JP_CSUM_* flags for the packet in 'd': which of its checksums the
+// card found right.  Wrong ones are left to the network stack to drop.
+static int
+rx_csum_flags(struct rx_desc *d)
+{
+	int flags = 0;
+
+	if (d->status & E1000_RXD_STAT_IXSM)
+		return 0;
+	if ((d->status & E1000_RXD_STAT_IPCS) && !(d->errors & E1000_RXD_ERR_IPE))
+		flags |= JP_CSUM_IP;
+	if ((d->status & E1000_RXD_STAT_TCPCS) && !(d->errors & E1000_RXD_ERR_TCPE))
+		flags |= JP_CSUM_L4;
+	if (d->errors & (E1000_RXD_ERR_IPE | E1000_RXD_ERR_TCPE))
+		e1000_stats.ns_rx_csum_bad++;
+	else if (flags)
+		e1000_stats.ns_rx_csum_ok++;
+	return flags;
+}
+
+// Software receive queues.  Packets are moved from the ring to the
+// queue of the env that will process them as soon as the driver sees
+// them, and the ring slot gets a spare page in exchange.
+struct rx_queue {
+	struct Page *rq_pages[RXQ_SIZE];	// Packets, oldest first
+	int rq_head, rq_n;
+	envid_t rq_waiter;		// Env blocked on this queue, if any
+	uint16_t rq_lport[RXQ_LPORTS];	// TCP ports listened on ...
+	uint8_t rq_lref[RXQ_LPORTS];	// ... and by how many sockets
+};
+int e1000_nq = 1;		// One per CPU once attach_e1000 has run
+static struct rx_queue rx_queues[NETQ_MAX];
+static struct Page *rx_spare[RING_MAX];	// Pages to refill the ring with
+static int rx_nspare;
+
+#define RXQ_ALL		(-1)	// rx_classify: every queue gets a copy
+
+// Flows whose queue is known because one of the queue's envs has sent
+// packets on them, such as connections it opened.  Entries are keyed
+// by the tuple of the packets received on the flow, looked up by its
+// hash, and replaced least recently used first.
+#define FLOW_SETS	64
+#define FLOW_WAYS	4
+struct rx_flow {
+	uint8_t rf_tuple[12];	// Source and destination address and port
+	uint8_t rf_queue;
+	uint32_t rf_used;	// 0 if the entry is free
+};
+static struct rx_flow rx_flows[FLOW_SETS][FLOW_WAYS];
+static uint32_t rx_flow_clock;
+
+// The key Microsoft's RSS specification uses with the Toeplitz hash.
+static const uint8_t rss_key[40] = {
+	0x6d, 0x5a, 0x56, 0xda, 0x25, 0x5b, 0x0e, 0xc2,
+	0x41, 0x67, 0x25, 0x3d, 0x43, 0xa3, 0x8f, 0xb0,
+	0xd0, 0xca, 0x2b, 0xcb, 0xae, 0x7b, 0x30, 0xb4,
+	0x77, 0xcb, 0x2d, 0xa3, 0x80, 0x30, 0xf2, 0x0c,
+	0x6a, 0x42, 0xb7, 0x3b, 0xbe, 0xac, 0x01, 0xfa,
+};
+
+// Toeplitz hash of a 12-byte tuple, the hash RSS cards compute.
+static uint32_t
+rss_hash(const uint8_t *tuple)
+{
+	uint32_t key, h = 0;
+	int i, b;
+
+	key = (rss_key[0] << 24) | (rss_key[1] << 16)
+		| (rss_key[2] << 8) | rss_key[3];
+	for (i = 0; i < 12; i++)
+		for (b = 7; b >= 0; b--) {
+			if (tuple[i] & (1 << b))
+				h ^= key;
+			key = (key << 1) | ((rss_key[i + 4] >> b) & 1);
+		}
+	return h;
+}
+
+// Find the TCP or UDP header of the IPv4 packet in 'frame' and fill in
+// its tuple: source and destination address, then port.
+// Returns the IP protocol, 0 if the packet is IPv4 but neither TCP nor
+// UDP (or a fragment), or -1 if it is not IPv4.
+static int
+frame_tuple(const uint8_t *frame, size_t len, uint8_t *tuple)
+{
+	const uint8_t *ip = frame + 14;
+	int hlen;
+
+	if (len < 14 + 20 || frame[12] != 0x08 || frame[13] != 0x00)
+		return -1;
+	hlen = (ip[0] & 0xf) * 4;
+	if ((ip[9] != 6 && ip[9] != 17) || len < 14 + hlen + 4
+	    || (((ip[6] << 8) | ip[7]) & 0x3fff))
+		return 0;
+	memmove(tuple, ip + 12, 8);
+	memmove(tuple + 8, ip + hlen, 4);
+	return ip[9];
+}
+
+static struct rx_flow *
+flow_lookup(const uint8_t *tuple, uint32_t h)
+{
+	struct rx_flow *f = rx_flows[h % FLOW_SETS];
+	int i;
+
+	for (i = 0; i < FLOW_WAYS; i++)
+		if (f[i].rf_used && memcmp(f[i].rf_tuple, tuple, 12) == 0)
+			return &f[i];
+	return NULL;
+}
+
+// Note that env's sending the packet in 'frame' means packets coming
+// back on its flow belong to queue 'q'.
+static void
+tx_learn(int q, const uint8_t *frame, size_t len)
+{
+	uint8_t out[12], tuple[12];
+	struct rx_flow *f, *set;
+	uint32_t h;
+	int i;
+
+	if (e1000_nq == 1 || frame_tuple(frame, len, out) <= 0)
+		return;
+	// Packets coming back have source and destination swapped.
+	memmove(tuple, out + 4, 4);
+	memmove(tuple + 4, out, 4);
+	memmove(tuple + 8, out + 10, 2);
+	memmove(tuple + 10, out + 8, 2);
+	h = rss_hash(tuple);
+	if (!(f = flow_lookup(tuple, h))) {
+		set = rx_flows[h % FLOW_SETS];
+		for (f = set, i = 1; i < FLOW_WAYS; i++)
+			if (set[i].rf_used < f->rf_used)
+				f = &set[i];
+		memmove(f->rf_tuple, tuple, 12);
+	}
+	f->rf_queue = q;
+	f->rf_used = ++rx_flow_clock;
+}
+
+static bool
+rxq_listening(int q, uint16_t port)
+{
+	int i;
+
+	for (i = 0; i < RXQ_LPORTS; i++)
+		if (rx_queues[q].rq_lref[i] && rx_queues[q].rq_lport[i] == port)
+			return 1;
+	return 0;
+}
+
+// Pick the queue for the received 'frame'.  Flows some queue has sent
+// on go back to it.  New TCP flows are spread by their hash over the
+// queues listening on their port, as an RSS card would over all its
+// queues.  Everything else goes to queue 0, except non-IP frames such
+// as ARP, which every queue needs to see.
+static int
+rx_classify(const uint8_t *frame, size_t len)
+{
+	uint8_t tuple[12];
+	int q, n, proto, cand[NETQ_MAX];
+	struct rx_flow *f;
+	uint16_t port;
+	uint32_t h;
+
+	if (e1000_nq == 1)
+		return 0;
+	if ((proto = frame_tuple(frame, len, tuple)) < 0)
+		return RXQ_ALL;
+	if (proto == 0)
+		return 0;
+	h = rss_hash(tuple);
+	if ((f = flow_lookup(tuple, h))) {
+		f->rf_used = ++rx_flow_clock;
+		return f->rf_queue;
+	}
+	if (proto != 6)
+		return 0;
+	port = (tuple[10] << 8) | tuple[11];
+	for (q = n = 0; q < e1000_nq; q++)
+		if (rxq_listening(q, port))
+			cand[n++] = q;
+	return n ? cand[h % n] : 0;
+}
+
+// A page to put in the ring, or NULL if we are out of memory.
+static struct Page *
+rx_page_get(void)
+{
+	struct Page *pp;
+
+	if (rx_nspare > 0)
+		return rx_spare[--rx_nspare];
+	if ((pp = page_alloc(ALLOC_ZERO)))
+		pp->pp_ref++;
+	return pp;
+}
+
+// Keep 'pp', which the driver holds the only reference to, for the ring.
+static void
+rx_page_put(struct Page *pp)
+{
+	if (rx_nspare < RING_MAX)
+		rx_spare[rx_nspare++] = pp;
+	else
+		page_decref(pp);
+}
+
+static void
+rxq_put(int q, struct Page *pp)
+{
+	struct rx_queue *rq = &rx_queues[q];
+
+	rq->rq_pages[(rq->rq_head + rq->rq_n) % RXQ_SIZE] = pp;
+	rq->rq_n++;
+	e1000_stats.ns_rxq_packets[q]++;
+}
+
+// Give queues 1 and up a copy of the packet in 'pp'.
+static void
+rxq_copy_all(struct Page *pp, int len)
+{
+	struct Page *cp;
+	int q;
+
+	for (q = 1; q < e1000_nq; q++) {
+		if (rx_queues[q].rq_n == RXQ_SIZE || !(cp = rx_page_get())) {
+			e1000_stats.ns_rxq_drops++;
+			continue;
+		}
+		memmove(page2kva(cp), page2kva(pp), RX_PKT_OFFSET + len);
+		e1000_stats.ns_rx_copies++;
+		rxq_put(q, cp);
+	}
+}
+
+// Move the packets the card has received from the ring to their
+// receive queues, giving the card a fresh page for each.  A packet
+// whose queue is full, or for which there is no fresh page, is dropped
+// and its page stays in the ring.
+static void
+rx_steer(void)
+{
+	struct rx_desc *d;
+	struct Page *pp, *np;
+	int tail = rx_next, q, len;
+
+	while ((d = &rx_fifo[tail])->status & E1000_RXD_STAT_DD) {
+		pp = rx_pages[tail];
+		len = d->length;
+		((int *) page2kva(pp))[0] = len;
+		((int *) page2kva(pp))[1] = rx_csum_flags(d);
+		e1000_stats.ns_rx_packets++;
+		e1000_stats.ns_rx_bytes += len;
+
+		q = rx_classify(page2kva(pp) + RX_PKT_OFFSET, len);
+		if (q == RXQ_ALL) {
+			rxq_copy_all(pp, len);
+			q = 0;
+		}
+		if (rx_queues[q].rq_n < RXQ_SIZE && (np = rx_page_get())) {
+			rxq_put(q, pp);
+			rx_pages[tail] = np;
+			d->addr = page2pa(np) + RX_PKT_OFFSET;
+		} else
+			e1000_stats.ns_rxq_drops++;
+		d->status = 0;
+		tail = (tail + 1) % nrx;
+	}
+	if (tail != rx_next) {
+		// Hand the descriptors back to the card.
+		e100[E1000_RDT/sizeof(uint32_t)] = (tail - 1 + nrx) % nrx;
+		rx_next = tail;
+	}
+}
+
+// Round a requested ring size to what the card and we support.
+static int
+ring_size(int n)
+{
+	n = MIN(n, RING_MAX);
+	n = ROUNDDOWN(n, 8);
+	return MAX(n, 8);
+}
+
+// Allocate a zeroed page for the driver, for good.
+static struct Page *
+e1000_page(void)
+{
+	struct Page *pp;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		panic("attach_e1000: out of memory");
+	pp->pp_ref++;
+	return pp;
+}
+
 int attach_e1000(struct pci_func *pcif)
 {
 	uintptr_t addr;
@@ -29,13 +463,22 @@ int attach_e1000(struct pci_func *pcif)
 	e100 = (uint32_t *)KSTACKTOP;
 	cprintf("e1000 status register: %x\n", e100[E1000_STATUS/sizeof(uint32_t)]);
 
+	// Choose the ring sizes and allocate the descriptor rings.
+	ntx = ring_size(E1000_NTXDESC);
+	nrx = ring_size(E1000_NRXDESC);
+	tx_fifo = page2kva(e1000_page());
+	rx_fifo = page2kva(e1000_page());
+	cprintf("e1000: %d tx and %d rx descriptors\n", ntx, nrx);
+	e1000_nq = MIN(ncpu, NETQ_MAX);
+	cprintf("e1000: %d receive queues\n", e1000_nq);
+
 	// transmit initialization
 	// Program the Transmit Descriptor Base Address Registers
 	e100[E1000_TDBAL/sizeof(uint32_t)] = PADDR((void*)tx_fifo);
 	e100[E1000_TDBAH/sizeof(uint32_t)] = 0x0;
 	
 	// Set the Transmit Descriptor Length Register
-	e100[E1000_TDLEN/sizeof(uint32_t)] = TX_SIZE * sizeof(struct tx_desc);
+	e100[E1000_TDLEN/sizeof(uint32_t)] = ntx * sizeof(struct tx_desc);
 	
 	// Set the Transmit Descriptor Head and Tail Registers
 	e100[E1000_TDH/sizeof(uint32_t)] = 0;
@@ -62,13 +505,10 @@ int attach_e1000(struct pci_func *pcif)
 	e100[E1000_TIPG/sizeof(uint32_t)] |= 6 << E1000_IPGR2_SHIFT; //IPGR2
 	e100[E1000_TIPG/sizeof(uint32_t)] |= 0 << E1000_RS_SHIFT;
 	
-	// Initialize tx_fifo and packet buffer array
-	memset((void*)tx_fifo, 0x0, TX_SIZE * sizeof(struct tx_desc));
-	memset(tx_buffer, 0x0, TX_SIZE * MAX_PACKET_SIZE);
-	for ( i = 0; i < TX_SIZE; i++) {
-		tx_fifo[i].status |= E1000_TXD_STAT_DD;
-		tx_fifo[i].addr = PADDR(tx_buffer + i * MAX_PACKET_SIZE);
-	}
+	// Allocate the copy buffers; descriptors are filled in as
+	// packets are posted.
+	for (i = 0; i < ntx / 2; i++)
+		tx_bufs[i] = e1000_page();
 
 	// receive initialization
 	
@@ -77,11 +517,7 @@ int attach_e1000(struct pci_func *pcif)
 	e100[E1000_RDBAH / sizeof(uint32_t)] = 0x0;
 	
 	// Set the Receive Descriptor Length Register
-	e100[E1000_RDLEN / sizeof(uint32_t)] = RX_SIZE * sizeof(struct rx_desc);
-	
-	// Set the Receive Descriptor Head and Tail Registers
-	e100[E1000_RDH / sizeof(uint32_t)] = 0x0;
-	e100[E1000_RDT / sizeof(uint32_t)] = 0x0;
+	e100[E1000_RDLEN / sizeof(uint32_t)] = nrx * sizeof(struct rx_desc);
 	
 	// configure NIC MAC Address 52:54:00:12:34:56
 	// 52:54:00:12:34:56 is from lowest-order byte to highest-order
@@ -116,9 +552,15 @@ int attach_e1000(struct pci_func *pcif)
 	//initialize Multicast Table Array to 0b, total 4096 bit in MTA.
 	memset(((uint8_t*)e100) + E1000_MTA, 0, 4096/8);
 	
-	//mask all interrupts 
-	//e100[E1000_IMC/sizeof(uint32_t)] |= 0xFFFFFFFF;
-	
+	// Interrupt only on receive events, and no more often than
+	// every E1000_ITR_INTERVAL.
+	e100[E1000_IMC/sizeof(uint32_t)] = 0xFFFFFFFF;
+	e100[E1000_ITR/sizeof(uint32_t)] = E1000_ITR_INTERVAL;
+	(void) e100[E1000_ICR/sizeof(uint32_t)];
+	e100[E1000_IMS/sizeof(uint32_t)] = E1000_IMS_RX;
+	e1000_irq = pcif->irq_line;
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << e1000_irq));
+
 	
 	// Buffer Size 2048, because largest possible standard Ethernet 
 	// packet (1518 bytes), we use one descriptor  for one packet. 
@@ -126,12 +568,19 @@ int attach_e1000(struct pci_func *pcif)
 	e100[E1000_RCTL/sizeof(uint32_t)] |= E1000_RCTL_SECRC; /* Strip Ethernet CRC */
 	e100[E1000_RCTL/sizeof(uint32_t)] |= E1000_RCTL_SZ_2048;
 	
-	// Initialize rx_fifo and packet buffer array
-	memset((void*)rx_fifo, 0x0, RX_SIZE * sizeof(struct tx_desc));
-	memset(rx_buffer, 0x0, RX_SIZE * BUFFER_SIZE);
-	for (i = 0; i < RX_SIZE; i++) {
-		rx_fifo[i].addr = PADDR(rx_buffer + i * BUFFER_SIZE);
+	// Initialize rx_fifo with one page per descriptor.  Pages are
+	// later swapped for pages donated by sys_net_recv_pages.
+	for (i = 0; i < nrx; i++) {
+		rx_pages[i] = e1000_page();
+		rx_fifo[i].addr = page2pa(rx_pages[i]) + RX_PKT_OFFSET;
 	}	
+
+	// Set the Receive Descriptor Head and Tail Registers: the card
+	// owns every descriptor from head up to, not including, tail.
+	// Giving it all but one leaves tail != head.
+	rx_next = 0;
+	e100[E1000_RDH / sizeof(uint32_t)] = 0x0;
+	e100[E1000_RDT / sizeof(uint32_t)] = nrx - 1;
 	
 	//Initialize the Receive Control Register
 	e100[E1000_RCTL/sizeof(uint32_t)] &= ~E1000_RCTL_LPE; // Long Packet Reception disable
@@ -144,6 +593,8 @@ int attach_e1000(struct pci_func *pcif)
 	//it is best to leave the Ethernet controller receive logic disabled (RCTL.EN = 0b) 
 	//until after the receive descriptor ring has been initialized and software is ready 
 	//to process received packets --by 8254x manual
+	// Have the card check IP, TCP and UDP checksums.
+	e100[E1000_RXCSUM/sizeof(uint32_t)] = E1000_RXCSUM_IPOFL | E1000_RXCSUM_TUOFL;
 	e100[E1000_RCTL/sizeof(uint32_t)] |= E1000_RCTL_EN;  //enable receiver
 	return 0;
 }
@@ -157,33 +608,315 @@ transmit_e1000(void* src, size_t len)
 	if (len > MAX_PACKET_SIZE)
 		return -E_OUT_BUFF;
 	// Check if next tx desc is free
-	if (tx_fifo[next].status & E1000_TXD_STAT_DD) {
-		memmove(tx_buffer + MAX_PACKET_SIZE * next, src, len);
-		tx_fifo[next].length = len; 
-		
-		tx_fifo[next].status &= ~E1000_TXD_STAT_DD;
-		tx_fifo[next].cmd |=  E1000_TXD_CMD_RS;
-		tx_fifo[next].cmd |= E1000_TXD_CMD_EOP;
+	tx_reclaim();
+	if (tx_free() > 0) {
+		memmove(tx_buffer(next), src, len);
+		tx_post(next, PADDR(tx_buffer(next)), len, E1000_TXD_CMD_EOP, 0);
+		tx_learn(curenv->env_netq, tx_buffer(next), len);
+		e1000_stats.ns_tx_packets++;
+		e1000_stats.ns_tx_bytes += len;
+		e1000_stats.ns_tx_copies++;
 		
-		e100[E1000_TDT/sizeof(uint32_t)] = (next + 1) % TX_SIZE;
+		e100[E1000_TDT/sizeof(uint32_t)] = (next + 1) % ntx;
 		return 0;
 	} else {
 		return -E_DESC_FULL;
 	}	
 }
+
+// Transmit the packet made of the 'nfrag' fragments in 'frags', which
+// are in e's address space, without copying it: each fragment (split
+// at page boundaries) gets its own descriptor, and the card reads it
+// straight from the env's pages.  The pages are held until the card
+// is done with them, but the env must not modify the fragments until
+// a later call reports the packet as sent.
+// If 'off' is not NULL, the card also does the checksums and TSO it
+// asks for, loading a new context descriptor first if need be.
+// Returns the number of earlier packets sent this way by envs on e's
+// receive queue that the card has finished with since the last
+// successful call from that queue, or
+//	-E_INVAL if the packet is too long or has too many fragments,
+//		or 'off' is not something the card can do,
+//	-E_FAULT if a fragment is not readable by 'e',
+//	-E_DESC_FULL if the ring has no room for the packet right now.
+// With nfrag == 0, only reports finished packets.
+int
+transmit_e1000_sg(struct Env *e, struct NetFrag *frags, int nfrag,
+		  const struct NetOffload *off)
+{
+	struct Page *pp[RING_MAX];
+	physaddr_t pa[RING_MAX];
+	uint16_t len[RING_MAX];
+	struct tx_ctx_desc ctx;
+	uintptr_t va;
+	size_t n, total = 0;
+	int i, next, nchunk = 0, nctx = 0, r;
+	uint8_t cmd = 0, popts = 0;
+	uint32_t done;
+
+	for (i = 0; i < nfrag; i++) {
+		va = (uintptr_t) frags[i].nf_va;
+		n = frags[i].nf_len;
+		total += n;
+		if (total > (off ? NETTSO_MAX : MAX_PACKET_SIZE))
+			return -E_INVAL;
+		if (user_mem_check(e, (void *) va, n, PTE_U | PTE_P) < 0)
+			return -E_FAULT;
+		while (n > 0) {
+			if (nchunk == ntx - 2)
+				return -E_INVAL;
+			pp[nchunk] = page_lookup(e->env_pgdir, (void *) va, 0);
+			pa[nchunk] = page2pa(pp[nchunk]) + PGOFF(va);
+			len[nchunk] = MIN(n, PGSIZE - PGOFF(va));
+			va += len[nchunk];
+			n -= len[nchunk];
+			nchunk++;
+		}
+	}
+
+	if (off && nchunk > 0) {
+		if ((r = tx_offload_check(off, total)) < 0)
+			return r;
+		tx_ctx_build(&ctx, off, total);
+		nctx = memcmp(&ctx, &tx_ctx, sizeof(ctx)) != 0;
+		cmd = E1000_TXD_CMD_DEXT;
+		if (off->no_flags & NETOFF_TSO)
+			cmd |= E1000_TXD_CMD_TSE;
+		if (off->no_flags & NETOFF_IPCSUM)
+			popts |= E1000_TXD_POPTS_IXSM;
+		if (off->no_flags & (NETOFF_TCPCSUM | NETOFF_UDPCSUM))
+			popts |= E1000_TXD_POPTS_TXSM;
+	}
+
+	tx_reclaim();
+	if (nctx + nchunk > tx_free())
+		return -E_DESC_FULL;
+
+	next = e100[E1000_TDT/sizeof(uint32_t)];
+	if (nctx) {
+		tx_ctx = ctx;
+		*(struct tx_ctx_desc *) &tx_fifo[next] = ctx;
+		if (next % TX_RS_EVERY == TX_RS_EVERY - 1)
+			tx_fifo[next].cmd |= E1000_TXD_CMD_RS;
+		next = (next + 1) % ntx;
+	}
+	for (i = 0; i < nchunk; i++) {
+		pp[i]->pp_ref++;
+		tx_pages[next] = pp[i];
+		tx_sg_queue[next] = e->env_netq;
+		// Always report the end of a packet, so that its pages
+		// are given back promptly.
+		tx_post(next, pa[i], len[i], i == nchunk - 1 ?
+			cmd | E1000_TXD_CMD_EOP | E1000_TXD_CMD_RS : cmd, popts);
+		next = (next + 1) % ntx;
+	}
+	if (nchunk > 0) {
+		e100[E1000_TDT/sizeof(uint32_t)] = next;
+		tx_learn(e->env_netq, frags[0].nf_va, frags[0].nf_len);
+		e1000_stats.ns_tx_packets++;
+		e1000_stats.ns_tx_bytes += total;
+		if (popts)
+			e1000_stats.ns_tx_csum++;
+		if (cmd & E1000_TXD_CMD_TSE)
+			e1000_stats.ns_tx_tso++;
+	}
+
+	done = tx_sg_done[e->env_netq];
+	tx_sg_done[e->env_netq] = 0;
+	return done;
+}
+// Copy the next packet of the current env's receive queue into 'dst'.
+// Returns its length, or -E_DESC_EMPTY if there is none.
 int 
 receive_e1000(void* dst)
 {
+	struct rx_queue *rq = &rx_queues[curenv->env_netq];
+	struct Page *pp;
 	int len;
-	int tail = e100[E1000_RDT/sizeof(uint32_t)];
-	if (rx_fifo[tail].status & E1000_RXD_STAT_DD) {
-			len = rx_fifo[tail].length;
-			memmove(dst, rx_buffer + BUFFER_SIZE * tail, len);
-			rx_fifo[tail].status &= ~E1000_RXD_STAT_DD;
-			rx_fifo[tail].status &= ~E1000_RXD_STAT_EOP;
-			e100[E1000_RDT/sizeof(uint32_t)] = (tail + 1) % RX_SIZE;
-			return len;
-	} else {
-		return -E_DESC_EMPTY; 
+
+	rx_steer();
+	if (rq->rq_n == 0)
+		return -E_DESC_EMPTY;
+	pp = rq->rq_pages[rq->rq_head];
+	len = ((int *) page2kva(pp))[0];
+	memmove(dst, page2kva(pp) + RX_PKT_OFFSET, len);
+	e1000_stats.ns_rx_copies++;
+	rq->rq_head = (rq->rq_head + 1) % RXQ_SIZE;
+	rq->rq_n--;
+	rx_page_put(pp);
+	return len;
+}
+
+// Receive up to 'n' packets from e's receive queue without copying
+// them.  For each packet, the page that 'e' has mapped at the next of
+// va, va+PGSIZE, ... is donated to the driver, and the page holding
+// the packet, laid out as a struct jif_pkt, is mapped in its place.
+// A donated page must be writable and mapped nowhere else, or the
+// card would overwrite memory someone is still using.
+// Returns the number of packets received, or
+//	-E_DESC_EMPTY if no packet has arrived,
+//	-E_INVAL if the first page is unsuitable,
+//	-E_NO_MEM if there's no memory to map the first packet.
+int
+receive_e1000_pages(struct Env *e, void *va, int n)
+{
+	struct rx_queue *rq = &rx_queues[e->env_netq];
+	struct Page *pp, *rxpp;
+	pte_t *pte;
+	int i, r = -E_DESC_EMPTY;
+
+	rx_steer();
+	for (i = 0; i < n && rq->rq_n > 0; i++, va += PGSIZE) {
+		if (!(pp = page_lookup(e->env_pgdir, va, &pte))
+		    || !(*pte & PTE_W) || pp->pp_ref != 1) {
+			r = -E_INVAL;
+			break;
+		}
+		rxpp = rq->rq_pages[rq->rq_head];
+
+		// Move the queue's reference from rxpp to pp.
+		pp->pp_ref++;
+		if ((r = page_insert(e->env_pgdir, rxpp, va, PTE_P | PTE_U | PTE_W)) < 0) {
+			pp->pp_ref--;
+			break;
+		}
+		rxpp->pp_ref--;
+		rx_page_put(pp);
+		rq->rq_head = (rq->rq_head + 1) % RXQ_SIZE;
+		rq->rq_n--;
+	}
+	return i ? i : r;
+}
+
+// Have receive queue 'q' take (if 'on') or no longer take a share of
+// the new TCP connections to 'port'.  Calls nest.
+// Returns 0 on success, or
+//	-E_NO_MEM if the queue already listens on RXQ_LPORTS ports,
+//	-E_INVAL if the queue was not listening on 'port'.
+int
+e1000_listen(int q, uint16_t port, bool on)
+{
+	struct rx_queue *rq = &rx_queues[q];
+	int i, free = -1;
+
+	for (i = 0; i < RXQ_LPORTS; i++) {
+		if (rq->rq_lref[i] && rq->rq_lport[i] == port) {
+			rq->rq_lref[i] += on ? 1 : -1;
+			return 0;
+		}
+		if (!rq->rq_lref[i] && free < 0)
+			free = i;
+	}
+	if (!on)
+		return -E_INVAL;
+	if (free < 0)
+		return -E_NO_MEM;
+	rq->rq_lport[free] = port;
+	rq->rq_lref[free] = 1;
+	return 0;
+}
+
+// Copy up to 'n' packets, each given by one entry of 'frames' in e's
+// address space, into the transmit ring, and tell the card about all
+// of them with a single tail update.
+// Returns the number of packets queued, or
+//	-E_DESC_FULL if the ring has no room at all,
+//	-E_INVAL if the first packet is too long,
+//	-E_FAULT if the first packet is not readable by 'e'.
+int
+transmit_e1000_batch(struct Env *e, struct NetFrag *frames, int n)
+{
+	int i, next, nfree;
+	size_t len;
+
+	tx_reclaim();
+	nfree = tx_free();
+	next = e100[E1000_TDT/sizeof(uint32_t)];
+	for (i = 0; i < n && i < nfree; i++) {
+		len = frames[i].nf_len;
+		if (len > MAX_PACKET_SIZE) {
+			if (i == 0)
+				return -E_INVAL;
+			break;
+		}
+		if (user_mem_check(e, frames[i].nf_va, len, PTE_U | PTE_P) < 0) {
+			if (i == 0)
+				return -E_FAULT;
+			break;
+		}
+		memmove(tx_buffer(next), frames[i].nf_va, len);
+		tx_post(next, PADDR(tx_buffer(next)), len, E1000_TXD_CMD_EOP, 0);
+		tx_learn(e->env_netq, tx_buffer(next), len);
+		e1000_stats.ns_tx_packets++;
+		e1000_stats.ns_tx_bytes += len;
+		e1000_stats.ns_tx_copies++;
+		next = (next + 1) % ntx;
 	}
+	if (i == 0)
+		return -E_DESC_FULL;
+	e100[E1000_TDT/sizeof(uint32_t)] = next;
+	return i;
+}
+
+// Block 'e' until a packet arrives on its receive queue.  On success
+// the caller must not return to 'e': when the env runs again it
+// re-executes the system call that blocked it.
+// Returns 0 on success, -E_BUSY if another env is already blocked on
+// the queue (each queue wakes only one).
+int
+e1000_rx_wait(struct Env *e)
+{
+	struct rx_queue *rq = &rx_queues[e->env_netq];
+	struct Env *w;
+
+	if (rq->rq_waiter && rq->rq_waiter != e->env_id
+	    && envid2env(rq->rq_waiter, &w, 0) == 0
+	    && w->env_status == ENV_NOT_RUNNABLE)
+		return -E_BUSY;
+	rq->rq_waiter = e->env_id;
+	e->env_status = ENV_NOT_RUNNABLE;
+	e->env_tf.tf_eip -= 2;		// size of "int $T_SYSCALL"
+	return 0;
+}
+
+// Handle an E1000 interrupt: steer the packets received to their
+// queues and wake up the envs waiting on the queues that got some.
+void
+e1000_intr(void)
+{
+	struct rx_queue *rq;
+	struct Env *e;
+	uint32_t icr;
+
+	icr = e100[E1000_ICR/sizeof(uint32_t)];	// reading acknowledges
+	if (!(icr & E1000_IMS_RX))
+		return;
+	e1000_stats.ns_rx_ready_max = MAX(e1000_stats.ns_rx_ready_max, rx_ready());
+	rx_steer();
+	for (rq = rx_queues; rq < rx_queues + e1000_nq; rq++) {
+		if (!rq->rq_waiter || rq->rq_n == 0)
+			continue;
+		if (envid2env(rq->rq_waiter, &e, 0) == 0
+		    && e->env_status == ENV_NOT_RUNNABLE)
+			e->env_status = ENV_RUNNABLE;
+		rq->rq_waiter = 0;
+	}
+}
+
+// Fill in 'ns' with the driver's counters and the current ring state.
+void
+e1000_get_stats(struct NetStats *ns)
+{
+	int tx_inuse;
+
+	tx_reclaim();
+	tx_inuse = ntx - 1 - tx_free();
+	e1000_stats.ns_tx_inuse_max = MAX(e1000_stats.ns_tx_inuse_max, tx_inuse);
+	e1000_stats.ns_rx_missed += e100[E1000_MPC/sizeof(uint32_t)];
+	*ns = e1000_stats;
+	ns->ns_tx_ring = ntx;
+	ns->ns_rx_ring = nrx;
+	ns->ns_tx_inuse = tx_inuse;
+	ns->ns_rx_ready = rx_ready();
+	ns->ns_rx_queues = e1000_nq;
 }
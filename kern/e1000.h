@@ -45,10 +45,59 @@ struct tx_desc
 #define E1000_TXD_STAT_DD    0x00000001 /* Descriptor Done */
 #define E1000_TXD_CMD_RS     0x00000008 /* Report Status */
 #define E1000_TXD_CMD_EOP    0x00000001 /* End of Packet */
-#define TX_SIZE 32 // total 32 tx_desc in transmit fifo
-#define RX_SIZE 32 // total 32 rx_desc in receive fifo
+#define E1000_TXD_CMD_TSE    0x00000004 /* TCP Seg enable */
+#define E1000_TXD_CMD_DEXT   0x00000020 /* Descriptor extension (0 = legacy) */
+#define E1000_TXD_DTYP_D     0x10       /* Data descriptor, in cso */
+#define E1000_TXD_POPTS_IXSM 0x01       /* Insert IP checksum, in css */
+#define E1000_TXD_POPTS_TXSM 0x02       /* Insert TCP/UDP checksum */
+
+// Transmit context descriptor: where the checksums of the packets
+// that follow go and, for TSO, how to cut them into segments.  It
+// takes a slot of the ring like any other descriptor.
+struct tx_ctx_desc
+{
+	uint8_t ipcss;		// IP header start
+	uint8_t ipcso;		// ... offset of its checksum
+	uint16_t ipcse;		// ... its last byte
+	uint8_t tucss;		// TCP/UDP header start
+	uint8_t tucso;		// ... offset of its checksum
+	uint16_t tucse;		// ... last byte summed, 0 for the end
+	uint32_t paylen;	// TSO payload length, DTYP (0) and TUCMD
+	uint8_t status;
+	uint8_t hdrlen;		// TSO: length of the headers
+	uint16_t mss;		// TSO: payload bytes per segment
+}__attribute__((__packed__));
+#define E1000_TXD_TUCMD_TCP  0x01000000 /* TCP, not UDP */
+#define E1000_TXD_TUCMD_IP   0x02000000 /* IPv4, not IPv6 */
+#define E1000_TXD_TUCMD_TSE  0x04000000 /* TCP Seg enable */
+#define E1000_TXD_TUCMD_DEXT 0x20000000 /* Must be set */
+// Descriptor ring sizes.  attach_e1000 rounds these down to a multiple
+// of 8 (the hardware wants ring lengths in 128-byte units) and caps
+// them at RING_MAX, the number of descriptors one page holds.
+#ifndef E1000_NTXDESC
+#define E1000_NTXDESC 256
+#endif
+#ifndef E1000_NRXDESC
+#define E1000_NRXDESC 256
+#endif
+#define RING_MAX (PGSIZE / 16)
+// Ask for a status write-back (RS) on every TX_RS_EVERY'th transmit
+// descriptor only; the card finishes descriptors in order.
+#define TX_RS_EVERY 8
 #define MAX_PACKET_SIZE 1518 // maximum size of an Ethernet packet is 1518 bytes
 #define BUFFER_SIZE 2048
+// Receive buffers are whole pages laid out as a struct jif_pkt:
+// the card writes the frame at jp_data, the driver fills in jp_len
+// and jp_flags.
+#define RX_PKT_OFFSET 8	// offsetof(struct jif_pkt, jp_data)
+#define JP_CSUM_IP	0x1	// jp_flags: the card verified the IP checksum
+#define JP_CSUM_L4	0x2	// ... and the TCP or UDP checksum
+// The card has a single receive ring, so the driver itself steers
+// received packets to up to NETQ_MAX software receive queues, one per
+// CPU.  Each holds at most RXQ_SIZE packets and can have TCP listeners
+// on RXQ_LPORTS different ports.
+#define RXQ_SIZE	64
+#define RXQ_LPORTS	8
 
 struct rx_desc
 {
@@ -63,17 +112,38 @@ struct rx_desc
 #define E1000_RAH       0x05404  /* Receive Address - RW Array */
 #define E1000_RAH_AV  0x80000000 /* Receive descriptor valid */
 #define E1000_MTA      0x05200  /* Multicast Table Array - RW Array */
+#define E1000_ICR      0x000C0  /* Interrupt Cause Read - R/clr */
+#define E1000_ITR      0x000C4  /* Interrupt Throttling Rate - RW */
+#define E1000_IMS      0x000D0  /* Interrupt Mask Set - RW */
 #define E1000_IMC      0x000D8  /* Interrupt Mask Clear - WO */
+#define E1000_MPC      0x04010  /* Missed Packet Count - R/clr */
 #define E1000_EERD     0x00014  /* EEPROM Read - RW */
 #define E1000_EEPROM_RW_REG_DONE   0x10 /* Offset to READ/WRITE done bit */
 #define E1000_EEPROM_RW_REG_START  1    /* First bit for telling part to start operation */
 #define E1000_EEPROM_RW_REG_DATA   16   /* Offset to data in EEPROM read/write registers */
 #define E1000_EEPROM_RW_ADDR_SHIFT 8    /* Shift to the address bits */
 
+/* Interrupt Cause Read */
+#define E1000_ICR_RXDMT0     0x00000010 /* rx desc min. threshold (0) */
+#define E1000_ICR_RXO        0x00000040 /* rx overrun */
+#define E1000_ICR_RXT0       0x00000080 /* rx timer intr (ring 0) */
+#define E1000_IMS_RX (E1000_ICR_RXDMT0 | E1000_ICR_RXO | E1000_ICR_RXT0)
+
+// Minimum interval between interrupts, in 256ns units: at most
+// about 10000 interrupts per second.
+#define E1000_ITR_INTERVAL 390
+
 /* Receive Descriptor bit definitions */
 #define E1000_RXD_STAT_DD       0x01    /* Descriptor Done */
 #define E1000_RXD_STAT_EOP      0x02    /* End of Packet */
 #define E1000_RXD_STAT_IXSM     0x04    /* Ignore checksum */
+#define E1000_RXD_STAT_TCPCS    0x20    /* TCP/UDP checksum calculated */
+#define E1000_RXD_STAT_IPCS     0x40    /* IP checksum calculated */
+#define E1000_RXD_ERR_TCPE      0x20    /* TCP/UDP checksum error */
+#define E1000_RXD_ERR_IPE       0x40    /* IP checksum error */
+#define E1000_RXCSUM   0x05000  /* RX Checksum Control - RW */
+#define E1000_RXCSUM_IPOFL 0x00000100 /* IPv4 checksum offload */
+#define E1000_RXCSUM_TUOFL 0x00000200 /* TCP/UDP checksum offload */
 
 #define E1000_RCTL     0x00100  /* RX Control - RW */
 #define E1000_RDBAL    0x02800  /* RX Descriptor Base Address Low - RW */
@@ -99,6 +169,23 @@ struct rx_desc
 int attach_e1000(struct pci_func *pcif);
 int transmit_e1000(void *src, size_t len);
 int receive_e1000(void *dst);
+struct Env;
+struct NetFrag;
+struct NetStats;
+struct NetOffload;
+int receive_e1000_pages(struct Env *e, void *va, int n);
+int transmit_e1000_batch(struct Env *e, struct NetFrag *frames, int n);
+int transmit_e1000_sg(struct Env *e, struct NetFrag *frags, int nfrag,
+		      const struct NetOffload *off);
+int e1000_listen(int q, uint16_t port, bool on);
+int e1000_rx_wait(struct Env *e);
+void e1000_intr(void);
+void e1000_get_stats(struct NetStats *ns);
+
+// IRQ line of the E1000, or 0 if there is none
+extern uint8_t e1000_irq;
+extern struct NetStats e1000_stats;
+extern int e1000_nq;		// Number of receive queues
 
 // MMIO address to access E1000 BAR
 volatile uint32_t *e100;
@@ -14,6 +14,8 @@
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/tlb.h>
+#include <kern/futex.h>
 
 struct Env *envs = NULL;		// All environments
 static struct Env *env_free_list;	// Free environment list
@@ -97,9 +99,11 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	// Check that the calling environment has legitimate permission
 	// to manipulate the specified environment.
 	// If checkperm is set, the specified environment
-	// must be either the current environment
-	// or an immediate child of the current environment.
-	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+	// must be either the current environment,
+	// an immediate child of the current environment,
+	// or a thread sharing its address space (see sys_exofork_shared).
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id
+	    && e->env_pgdir != curenv->env_pgdir) {
 		*env_store = 0;
 		return -E_BAD_ENV;
 	}
@@ -159,15 +163,25 @@ env_init_percpu(void)
 // Do NOT (yet) map anything into the user portion
 // of the environment's virtual address space.
 //
+// If 'share' is not null, e shares that page directory instead, and
+// with it the whole address space of the envs already using it.  The
+// page directory's pp_ref counts those envs.
+//
 // Returns 0 on success, < 0 on error.  Errors include:
 //	-E_NO_MEM if page directory or table could not be allocated.
 //
 static int
-env_setup_vm(struct Env *e)
+env_setup_vm(struct Env *e, pde_t *share)
 {
 	int i;
 	struct Page *p = NULL;
 
+	if (share) {
+		pa2page(PADDR(share))->pp_ref++;
+		e->env_pgdir = share;
+		return 0;
+	}
+
 	// Allocate a page for the page directory
 	if (!(p = page_alloc(ALLOC_ZERO)))
 		return -E_NO_MEM;
@@ -219,6 +233,16 @@ env_setup_vm(struct Env *e)
 //
 int
 env_alloc(struct Env **newenv_store, envid_t parent_id)
+{
+	return env_alloc_vm(newenv_store, parent_id, NULL);
+}
+
+//
+// Like env_alloc, but the new environment uses page directory 'pgdir'
+// (see env_setup_vm) if it is not null.
+//
+int
+env_alloc_vm(struct Env **newenv_store, envid_t parent_id, pde_t *pgdir)
 {
 	int32_t generation;
 	int r;
@@ -228,7 +252,7 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 		return -E_NO_FREE_ENV;
 
 	// Allocate and set up the page directory for this environment.
-	if ((r = env_setup_vm(e)) < 0)
+	if ((r = env_setup_vm(e, pgdir)) < 0)
 		return r;
 	// Generate an env_id for this environment.
 	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
@@ -241,6 +265,13 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	e->env_type = ENV_TYPE_USER;
 	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
+	e->env_syscalls = 0;
+	e->env_cycles = 0;
+	e->env_alarm = 0;
+	e->env_alarm_pending = 0;
+	e->env_futex_pa = 0;
+	e->env_futex_link = NULL;
+	e->env_netq = 0;
 
 	// Clear out all the saved register state,
 	// to prevent the register values
@@ -269,6 +300,7 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
+	e->env_uxstacktop = UXSTACKTOP;
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
@@ -299,7 +331,6 @@ region_alloc(struct Env *e, void *va, size_t len)
 	//   You should round va down, and round (va + len) up.
 	//   (Watch out for corner-cases!)
 	struct Page *p;
-	pte_t *pte;
 	assert((uintptr_t)va < KERNBASE);
 	if((uintptr_t)va + len < (uintptr_t)va) 
 		panic("len too large");
@@ -313,15 +344,9 @@ region_alloc(struct Env *e, void *va, size_t len)
 		if(p == NULL)
 			panic("page_alloc failed: %e", p);
 		assert(p != NULL);
-//can use page_insert(e->env_pgdir, va, PTE_U | PTE_W)
-		p->pp_ref++;
-//		boot_map_region(e->env_pgdir, va, PGSIZE, page2pa(p), PTE_U | PTE_W | PTE_P);
-//		can use page_insert
-		pte = pgdir_walk(e->env_pgdir, va, 1);
-		if(pte == NULL) 
-			panic("pgdir_walk failed");
-		*pte = page2pa(p) | PTE_U | PTE_W | PTE_P;
-		tlb_invalidate(e->env_pgdir, va);
+		// page_insert records the reverse mapping as well.
+		if(page_insert(e->env_pgdir, p, va, PTE_U | PTE_W) < 0)
+			panic("page_insert failed");
 		va += PGSIZE;
 	}	
 }
@@ -428,7 +453,7 @@ load_icode(struct Env *e, uint8_t *binary, size_t size)
 	elf = (struct Elf *) binary;
 	ph = (struct Proghdr *)((uint8_t*)binary + elf->e_phoff);
 	eph = ph + elf->e_phnum;
-	lcr3(PADDR(e->env_pgdir));
+	tlb_load_pgdir(e->env_pgdir);
 	for(; ph < eph; ph++) {
 		if(ph->p_type != ELF_PROG_LOAD)
 			continue;
@@ -452,7 +477,7 @@ load_icode(struct Env *e, uint8_t *binary, size_t size)
 	*/
 	region_alloc(e, (void*)(USTACKTOP-PGSIZE), PGSIZE);
 //	memset((void*)(USTACKTOP-PGSIZE), 0, PGSIZE);
-	lcr3(PADDR(kern_pgdir));
+	tlb_load_pgdir(kern_pgdir);
 }
 
 //
@@ -486,44 +511,42 @@ env_create(uint8_t *binary, size_t size, enum EnvType type)
 void
 env_free(struct Env *e)
 {
-	pte_t *pt;
-	uint32_t pdeno, pteno;
+	uint32_t pdeno;
 	physaddr_t pa;
 
 	// If freeing the current environment, switch to kern_pgdir
 	// before freeing the page directory, just in case the page
 	// gets reused.
 	if (e == curenv)
-		lcr3(PADDR(kern_pgdir));
+		tlb_load_pgdir(kern_pgdir);
+
+	// Stop any futex wait, which keeps e on a hash chain, and wake
+	// the senders waiting for e to receive, to find it gone.
+	futex_cancel(e);
+	e->env_ipc_nrecv++;
+	futex_wake_pa(PADDR(&e->env_ipc_nrecv), NENV);
 
 	// Note the environment's demise.
 	// cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
-	// Flush all mapped pages in the user portion of the address space
+	// Flush all mapped pages in the user portion of the address space,
+	// unless other envs still share it (see env_setup_vm).
 	static_assert(UTOP % PTSIZE == 0);
+	pa = PADDR(e->env_pgdir);
 	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+		if (pa2page(pa)->pp_ref > 1)
+			break;
 
 		// only look at mapped page tables
 		if (!(e->env_pgdir[pdeno] & PTE_P))
 			continue;
 
-		// find the pa and va of the page table
-		pa = PTE_ADDR(e->env_pgdir[pdeno]);
-		pt = (pte_t*) KADDR(pa);
-
-		// unmap all PTEs in this page table
-		for (pteno = 0; pteno <= PTX(~0); pteno++) {
-			if (pt[pteno] & PTE_P)
-				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
-		}
-
-		// free the page table itself
-		e->env_pgdir[pdeno] = 0;
-		page_decref(pa2page(pa));
+		// unmap all PTEs in this page table and free the page
+		// table itself, unless other envs still share it
+		pgdir_release(e->env_pgdir, PGADDR(pdeno, 0, 0));
 	}
 
 	// free the page directory
-	pa = PADDR(e->env_pgdir);
 	e->env_pgdir = 0;
 	page_decref(pa2page(pa));
 
@@ -607,6 +630,13 @@ env_run(struct Env *e)
 	//	e->env_tf to sensible values.
 
 	// LAB 3: Your code here.
+	uint64_t now = read_tsc();
+
+	// Charge the time since the last switch on this CPU, in user
+	// mode and in the kernel on its behalf, to the env that had it.
+	if(curenv != NULL)
+		curenv->env_cycles += now - thiscpu->cpu_charged;
+	thiscpu->cpu_charged = now;
 	if(curenv != NULL) {
 		if(curenv->env_status == ENV_RUNNING)
 			curenv->env_status = ENV_RUNNABLE;
@@ -614,7 +644,10 @@ env_run(struct Env *e)
 	curenv = e;
 	curenv->env_status = ENV_RUNNING;
 	curenv->env_runs++;
-	lcr3(PADDR(curenv->env_pgdir));	
+	tlb_load_pgdir(curenv->env_pgdir);
+	// Other CPUs must drop stale translations before we let them
+	// back into the kernel or run the envs we just modified.
+	tlb_shootdown();
 	unlock_kernel();
 	env_pop_tf(&(curenv->env_tf));
 
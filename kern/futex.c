@@ -0,0 +1,181 @@
+// Sleeping on a word of user memory (sys_futex_wait and sys_futex_wake).
+//
+// A waiter is keyed by the physical address of its word, so envs that
+// share a page (PTE_SHARE) wait and wake on the same key wherever each
+// has it mapped.  Waiting envs sit in hash chains by the page the word
+// is in, linked through env_futex_link.
+//
+// Every wait can end early: besides timeouts, dropping any mapping of a
+// page that has waiters (page_decref) wakes them all, so that an env
+// sleeping on a pipe notices when the other end goes away.  Callers
+// check their condition again when sys_futex_wait returns.
+//
+// Besides user pages, an env may wait on a word of the read-only envs
+// array at UENVS: ipc_send sleeps on its receiver's env_ipc_nrecv,
+// which the kernel bumps and wakes in sys_ipc_recv.
+
+#include <inc/error.h>
+#include <inc/mmu.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/futex.h>
+#include <kern/time.h>
+
+#define FUTEX_HASH	64
+
+static struct Env *futex_hash[FUTEX_HASH];
+static uint32_t futex_next = ~0;	// No wait times out before this
+int futex_nwait;			// Envs in futex_hash
+
+static struct Env **
+futex_chain(physaddr_t pa)
+{
+	return &futex_hash[(pa >> PGSHIFT) % FUTEX_HASH];
+}
+
+// Take 'e' off its hash chain and make it runnable, with 'ret' as the
+// return value of its sys_futex_wait.
+static void
+futex_wakeup(struct Env **pe, int ret)
+{
+	struct Env *e = *pe;
+
+	*pe = e->env_futex_link;
+	e->env_futex_link = NULL;
+	e->env_futex_pa = 0;
+	e->env_tf.tf_regs.reg_eax = ret;
+	e->env_status = ENV_RUNNABLE;
+	futex_nwait--;
+}
+
+// The physical address of the word at 'va' in e's address space, or 0
+// if 'va' is not an aligned word on a user page or in the envs array.
+static physaddr_t
+futex_pa(struct Env *e, uintptr_t va)
+{
+	struct Page *pp;
+	pte_t *pte;
+
+	if (va % sizeof(uint32_t))
+		return 0;
+	if (va >= UENVS && va < UENVS + NENV * sizeof(struct Env))
+		return PADDR(envs) + (va - UENVS);
+	if (va >= UTOP)
+		return 0;
+	if (!(pp = page_lookup(e->env_pgdir, (void *) va, &pte))
+	    || !(*pte & PTE_U))
+		return 0;
+	return page2pa(pp) + PGOFF(va);
+}
+
+// Put 'e' to sleep on the word at 'va' if it still holds 'val', until
+// futex_wake or time 'msec' (never, if ~0).  Returns 0 once 'e' sleeps,
+// or < 0 without sleeping:
+//	-E_INVAL if 'va' is not an aligned word on a user page or in envs.
+//	-E_AGAIN if the word is not 'val'.
+//	-E_TIMEOUT if time 'msec' has passed.
+int
+futex_wait(struct Env *e, uintptr_t va, uint32_t val, uint32_t msec)
+{
+	physaddr_t pa;
+	struct Env **chain;
+
+	if (!(pa = futex_pa(e, va)))
+		return -E_INVAL;
+	if (*(volatile uint32_t *) KADDR(pa) != val)
+		return -E_AGAIN;
+	if (msec <= time_msec())
+		return -E_TIMEOUT;
+
+	chain = futex_chain(pa);
+	e->env_futex_pa = pa;
+	e->env_futex_deadline = msec;
+	e->env_futex_link = *chain;
+	*chain = e;
+	e->env_status = ENV_NOT_RUNNABLE;
+	futex_nwait++;
+	if (msec < futex_next)
+		futex_next = msec;
+	return 0;
+}
+
+// Wake up to 'n' envs sleeping on the word at 'va' in e's address space.
+// Returns how many woke, or -E_INVAL if 'va' is not an aligned word on a
+// user page.
+int
+futex_wake(struct Env *e, uintptr_t va, int n)
+{
+	physaddr_t pa;
+
+	if (!(pa = futex_pa(e, va)))
+		return -E_INVAL;
+	return futex_wake_pa(pa, n);
+}
+
+// Wake up to 'n' envs sleeping on the word at physical address 'pa',
+// and return how many woke.
+int
+futex_wake_pa(physaddr_t pa, int n)
+{
+	struct Env **pe;
+	int woken = 0;
+
+	if (!futex_nwait)
+		return 0;
+	for (pe = futex_chain(pa); *pe && woken < n; )
+		if ((*pe)->env_futex_pa == pa) {
+			futex_wakeup(pe, 0);
+			woken++;
+		} else
+			pe = &(*pe)->env_futex_link;
+	return woken;
+}
+
+// Wake every env sleeping on a word in the page at 'pa'.
+void
+futex_wake_page(physaddr_t pa)
+{
+	struct Env **pe;
+
+	pa = ROUNDDOWN(pa, PGSIZE);
+	for (pe = futex_chain(pa); *pe; )
+		if (ROUNDDOWN((*pe)->env_futex_pa, PGSIZE) == pa)
+			futex_wakeup(pe, 0);
+		else
+			pe = &(*pe)->env_futex_link;
+}
+
+// Stop 'e' waiting, if it is, as when it is destroyed.
+void
+futex_cancel(struct Env *e)
+{
+	struct Env **pe;
+
+	if (!e->env_futex_pa)
+		return;
+	for (pe = futex_chain(e->env_futex_pa); *pe != e; )
+		pe = &(*pe)->env_futex_link;
+	futex_wakeup(pe, 0);
+}
+
+// Wake the envs whose waits have timed out by 'now'.
+void
+futex_timeouts(uint32_t now)
+{
+	struct Env **pe;
+	uint32_t next = ~0;
+	int i;
+
+	if (now < futex_next)
+		return;
+	for (i = 0; i < FUTEX_HASH; i++)
+		for (pe = &futex_hash[i]; *pe; )
+			if ((*pe)->env_futex_deadline <= now)
+				futex_wakeup(pe, -E_TIMEOUT);
+			else {
+				next = MIN(next, (*pe)->env_futex_deadline);
+				pe = &(*pe)->env_futex_link;
+			}
+	futex_next = next;
+}
@@ -0,0 +1,22 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_FUTEX_H
+#define JOS_KERN_FUTEX_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+
+extern int futex_nwait;
+
+int	futex_wait(struct Env *e, uintptr_t va, uint32_t val, uint32_t msec);
+int	futex_wake(struct Env *e, uintptr_t va, int n);
+int	futex_wake_pa(physaddr_t pa, int n);
+void	futex_wake_page(physaddr_t pa);
+void	futex_cancel(struct Env *e);
+void	futex_timeouts(uint32_t now);
+
+#endif	// !JOS_KERN_FUTEX_H
@@ -15,6 +15,7 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/tlb.h>
 #include <kern/pci.h>
 
 #include <kern/e1000.h>
@@ -150,6 +151,7 @@ mp_main(void)
 {
 	// We are in high EIP now, safe to switch to kern_pgdir 
 	lcr3(PADDR(kern_pgdir));
+	tlb_init_percpu();
 	cprintf("SMP: CPU %d starting\n", cpunum());
 
 	lapic_init();
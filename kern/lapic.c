@@ -175,3 +175,13 @@ lapic_ipi(int vector)
 	while (lapic[ICRLO] & DELIVS)
 		;
 }
+
+// Send 'vector' to the single CPU whose local APIC ID is 'apicid'.
+void
+lapic_ipi_cpu(int apicid, int vector)
+{
+	lapicw(ICRHI, apicid << 24);
+	lapicw(ICRLO, FIXED | vector);
+	while (lapic[ICRLO] & DELIVS)
+		;
+}
@@ -5,11 +5,14 @@
 #include <inc/error.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/fs.h>
 
 #include <kern/pmap.h>
 #include <kern/kclock.h>
 #include <kern/env.h>
 #include <kern/cpu.h>
+#include <kern/tlb.h>
+#include <kern/futex.h>
 
 // These variables are set by i386_detect_memory()
 size_t npages;			// Amount of physical memory (in pages)
@@ -19,6 +22,8 @@ static size_t npages_basemem;	// Amount of base memory (in pages)
 pde_t *kern_pgdir;		// Kernel's initial page directory
 struct Page *pages;		// Physical page state array
 static struct Page *page_free_list;	// Free list of physical pages
+static struct Rmap *rmap_free_list;	// Free list of reverse mappings
+static size_t reclaim_hand;		// Next page page_reclaim looks at
 
 
 // --------------------------------------------------------------
@@ -155,7 +160,17 @@ mem_init(void)
 	// array.  'npages' is the number of physical pages in memory.
 	// Your code goes here:
 	pages = (struct Page *)boot_alloc(npages * sizeof(struct Page));
-
+	memset(pages, 0, npages * sizeof(struct Page));
+
+	// Reserve RMAP_PER_PAGE reverse mappings per physical page,
+	// all on rmap_free_list.
+	struct Rmap *rmaps;
+	n = npages * RMAP_PER_PAGE;
+	rmaps = (struct Rmap *)boot_alloc(n * sizeof(struct Rmap));
+	while (n-- > 0) {
+		rmaps[n].rm_next = rmap_free_list;
+		rmap_free_list = &rmaps[n];
+	}
 
 
 	//////////////////////////////////////////////////////////////////////
@@ -186,7 +201,7 @@ mem_init(void)
 	//    - pages itself -- kernel RW, user NONE
 	// Your code goes here:
 	size_t size = ROUNDUP(npages*sizeof(struct Page), PGSIZE);
-	boot_map_region(kern_pgdir, (uintptr_t)UPAGES, size, PADDR(pages), PTE_U | PTE_P);
+	boot_map_region(kern_pgdir, (uintptr_t)UPAGES, size, PADDR(pages), PTE_U | PTE_P | PTE_G);
 
 
 	//////////////////////////////////////////////////////////////////////
@@ -197,7 +212,7 @@ mem_init(void)
 	//    - envs itself -- kernel RW, user NONE
 	// LAB 3: Your code here.
 	size = ROUNDUP(NENV*sizeof(struct Env), PGSIZE);
-	boot_map_region(kern_pgdir, (uintptr_t)UENVS, size, PADDR(envs), PTE_U | PTE_P);
+	boot_map_region(kern_pgdir, (uintptr_t)UENVS, size, PADDR(envs), PTE_U | PTE_P | PTE_G);
 
 	//////////////////////////////////////////////////////////////////////
 	// Use the physical memory that 'bootstack' refers to as the kernel
@@ -210,7 +225,7 @@ mem_init(void)
 	//       overwrite memory.  Known as a "guard page".
 	//     Permissions: kernel RW, user NONE
 	// Your code goes here:
-	boot_map_region(kern_pgdir, KSTACKTOP-KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W | PTE_P);
+	boot_map_region(kern_pgdir, KSTACKTOP-KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W | PTE_P | PTE_G);
 
 
 	//////////////////////////////////////////////////////////////////////
@@ -221,10 +236,12 @@ mem_init(void)
 	// we just set up the mapping anyway.
 	// Permissions: kernel RW, user NONE
 	// Your code goes here:
-
-
+	//
+	// Everything above UTOP except UVPT is mapped identically in every
+	// address space, so those mappings are global (PTE_G): they stay in
+	// the TLB across env switches once tlb_init_percpu enables CR4_PGE.
 	size = 0xffffffff - KERNBASE + 1;
-	boot_map_region(kern_pgdir, (uintptr_t)KERNBASE, size, 0, PTE_W | PTE_P);
+	boot_map_region(kern_pgdir, (uintptr_t)KERNBASE, size, 0, PTE_W | PTE_P | PTE_G);
 	
 	// Initialize the SMP-related parts of the memory map
 	mem_init_mp();
@@ -239,6 +256,7 @@ mem_init(void)
 	// If the machine reboots at this point, you've probably set up your
 	// kern_pgdir wrong.
 	lcr3(PADDR(kern_pgdir));
+	tlb_init_percpu();
 
 	check_page_free_list(0);
 
@@ -263,7 +281,7 @@ mem_init_mp(void)
 {
 	// Create a direct mapping at the top of virtual address space starting
 	// at IOMEMBASE for accessing the LAPIC unit using memory-mapped I/O.
-	boot_map_region(kern_pgdir, IOMEMBASE, -IOMEMBASE, IOMEM_PADDR, PTE_W);
+	boot_map_region(kern_pgdir, IOMEMBASE, -IOMEMBASE, IOMEM_PADDR, PTE_W | PTE_G);
 
 	// Map per-CPU stacks starting at KSTACKTOP, for up to 'NCPU' CPUs.
 	//
@@ -284,7 +302,7 @@ mem_init_mp(void)
 	int i;
 	for(i = 0; i < NCPU; i++) {
 		uintptr_t kstacktop_i = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
-		boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W | PTE_P);
+		boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W | PTE_P | PTE_G);
 	}
 }
 
@@ -364,7 +382,8 @@ page_init(void)
 
 //
 // Allocates a physical page.  If (alloc_flags & ALLOC_ZERO), fills the entire
-// returned physical page with '\0' bytes.  Does NOT increment the reference
+// returned physical page with '\0' bytes.  If (alloc_flags & ALLOC_RECLAIM)
+// and no page is free, reclaims one.  Does NOT increment the reference
 // count of the page - the caller must do these if necessary (either explicitly
 // or via page_insert).
 //
@@ -376,8 +395,15 @@ page_alloc(int alloc_flags)
 {
 	// Fill this function in
 	struct Page *result;
+	if(page_free_list == NULL && (alloc_flags & ALLOC_RECLAIM))
+		page_reclaim(1);
 	if(page_free_list != NULL) {
 		result = page_free_list;
+		// No CPU may still cache a translation for a page we hand
+		// out.  The invalidations for one freed before the last
+		// shootdown round have all been carried out.
+		if(result->pp_free_round == tlb_round)
+			tlb_shootdown();
 		result->pp_ref = 0;
 		page_free_list = page_free_list->pp_link;
 		if(alloc_flags & ALLOC_ZERO)
@@ -396,10 +422,68 @@ page_free(struct Page *pp)
 {
 	// Fill this function in
 	assert(pp->pp_ref == 0);
+	pp->pp_free_round = tlb_round;
 	pp->pp_link = page_free_list;
 	page_free_list = pp;
 }
 
+//
+// Record that the entry for 'va' in page table 'pt' maps 'pp'.
+// Returns 0 on success, -E_NO_MEM if no reverse mapping is left.
+//
+static int
+rmap_add(struct Page *pp, struct Page *pt, const void *va)
+{
+	struct Rmap *rm;
+
+	if ((rm = rmap_free_list) == NULL)
+		return -E_NO_MEM;
+	rmap_free_list = rm->rm_next;
+	rm->rm_pt = pt;
+	rm->rm_va = (uintptr_t) ROUNDDOWN(va, PGSIZE);
+	rm->rm_next = pp->pp_rmap;
+	pp->pp_rmap = rm;
+	return 0;
+}
+
+//
+// Forget the mapping of 'pp' at 'va' in page table 'pt', if it was recorded.
+//
+static void
+rmap_remove(struct Page *pp, struct Page *pt, const void *va)
+{
+	struct Rmap **prm, *rm;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	for (prm = &pp->pp_rmap; (rm = *prm) != NULL; prm = &rm->rm_next)
+		if (rm->rm_pt == pt && rm->rm_va == (uintptr_t) va) {
+			*prm = rm->rm_next;
+			rm->rm_next = rmap_free_list;
+			rmap_free_list = rm;
+			return;
+		}
+}
+
+//
+// Return the page table entry 'rm' describes.
+//
+static pte_t *
+rmap_pte(struct Rmap *rm)
+{
+	return (pte_t *) page2kva(rm->rm_pt) + PTX(rm->rm_va);
+}
+
+//
+// Return the page table page covering 'va' in 'pgdir', or NULL.
+//
+static struct Page *
+pgdir_pt(pde_t *pgdir, const void *va)
+{
+	if (!(pgdir[PDX(va)] & PTE_P))
+		return NULL;
+	return pa2page(PTE_ADDR(pgdir[PDX(va)]));
+}
+
 //
 // Decrement the reference count on a page,
 // freeing it if there are no more refs.
@@ -407,6 +491,12 @@ page_free(struct Page *pp)
 void
 page_decref(struct Page* pp)
 {
+	// Sleepers on the page may be waiting for this mapping to go,
+	// like a pipe reader for the last writer.  If it was the last
+	// one, wake them before the page is reused: a wait keyed by its
+	// address would otherwise be woken by whoever gets it next.
+	if (futex_nwait)
+		futex_wake_page(page2pa(pp));
 	if (--pp->pp_ref == 0)
 		page_free(pp);
 }
@@ -457,6 +547,138 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 //	return NULL;
 }
 
+//
+// Page tables below UTOP may be shared between address spaces that
+// map a range identically (see pgdir_share).  A shared page table page
+// has pp_ref > 1, one reference per page directory pointing at it, and
+// each page it maps carries one reference per such page directory.
+// Nothing may modify a shared page table: call pgdir_unshare first.
+//
+// If the page table covering 'va' in 'pgdir' is shared, give 'pgdir'
+// a private copy of it.
+//
+// Returns 0 on success, -E_NO_MEM if out of memory.
+//
+int
+pgdir_unshare(pde_t *pgdir, const void *va)
+{
+	struct Page *pt, *npt, *pp;
+	pte_t *ptes, *nptes;
+	uintptr_t base;
+	int i;
+
+	if ((uintptr_t) va >= UTOP || (pt = pgdir_pt(pgdir, va)) == NULL
+	    || pt->pp_ref == 1)
+		return 0;
+	if ((npt = page_alloc(0)) == NULL)
+		return -E_NO_MEM;
+	ptes = page2kva(pt);
+	nptes = page2kva(npt);
+	memmove(nptes, ptes, PGSIZE);
+
+	// The pages keep the reference they had through the shared table,
+	// but their entries in the copy need reverse mappings of their own.
+	base = ROUNDDOWN((uintptr_t) va, PTSIZE);
+	for (i = 0; i < NPTENTRIES; i++) {
+		if (!(ptes[i] & PTE_P))
+			continue;
+		pp = pa2page(PTE_ADDR(ptes[i]));
+		if (rmap_add(pp, npt, (void *) (base + i * PGSIZE)) < 0)
+			goto nomem;
+	}
+	npt->pp_ref = 1;
+	pt->pp_ref--;
+	pgdir[PDX(va)] = page2pa(npt) | (pgdir[PDX(va)] & 0xFFF);
+	return 0;
+
+nomem:
+	while (--i >= 0)
+		if (ptes[i] & PTE_P)
+			rmap_remove(pa2page(PTE_ADDR(ptes[i])), npt,
+				    (void *) (base + i * PGSIZE));
+	page_free(npt);
+	return -E_NO_MEM;
+}
+
+//
+// Make 'dstpgdir' use the page table covering 'va' in 'srcpgdir',
+// so both address spaces map that PTSIZE range identically until one
+// of them changes it.  'dstpgdir' must not have a page table there.
+// Entries that are writable and not PTE_SHARE are first made read-only
+// in the source, with the PTE_AVAIL bits in 'cowbits' set (fork passes
+// PTE_COW), so that neither side can write through the shared table.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if va is not below UTOP, or there is nothing to share,
+//	or 'dstpgdir' already has a page table there
+//   -E_NO_MEM, if the source table had to be unshared and that failed
+//
+int
+pgdir_share(pde_t *srcpgdir, pde_t *dstpgdir, const void *va, int cowbits)
+{
+	struct Page *pt;
+	pte_t *ptes;
+	bool flush = 0;
+	int i, r;
+
+	if ((uintptr_t) va >= UTOP || (cowbits & ~PTE_AVAIL)
+	    || (dstpgdir[PDX(va)] & PTE_P) || !(srcpgdir[PDX(va)] & PTE_P))
+		return -E_INVAL;
+
+	// Write-protect the source's private entries.
+	ptes = page2kva(pgdir_pt(srcpgdir, va));
+	for (i = 0; i < NPTENTRIES; i++)
+		if ((ptes[i] & (PTE_P | PTE_W | PTE_SHARE)) == (PTE_P | PTE_W)) {
+			if (!flush && (r = pgdir_unshare(srcpgdir, va)) < 0)
+				return r;
+			ptes = page2kva(pgdir_pt(srcpgdir, va));
+			ptes[i] = (ptes[i] & ~PTE_W) | cowbits;
+			flush = 1;
+		}
+	if (flush)
+		tlb_invalidate_all(srcpgdir);
+
+	// One more page directory refers to the table and its pages.
+	pt = pgdir_pt(srcpgdir, va);
+	pt->pp_ref++;
+	for (i = 0; i < NPTENTRIES; i++)
+		if (ptes[i] & PTE_P)
+			pa2page(PTE_ADDR(ptes[i]))->pp_ref++;
+	dstpgdir[PDX(va)] = srcpgdir[PDX(va)];
+	return 0;
+}
+
+//
+// Drop 'pgdir's reference to the page table covering 'va', and to the
+// pages it maps, and clear the page directory entry.
+// If 'pgdir' was the last user of the table, its entries are
+// page_remove()d and the table is freed.
+//
+void
+pgdir_release(pde_t *pgdir, const void *va)
+{
+	struct Page *pt;
+	pte_t *ptes;
+	uintptr_t base;
+	int i;
+
+	if ((pt = pgdir_pt(pgdir, va)) == NULL)
+		return;
+	ptes = page2kva(pt);
+	base = ROUNDDOWN((uintptr_t) va, PTSIZE);
+	for (i = 0; i < NPTENTRIES; i++) {
+		if (!(ptes[i] & PTE_P))
+			continue;
+		if (pt->pp_ref == 1)
+			page_remove(pgdir, (void *) (base + i * PGSIZE));
+		else
+			page_decref(pa2page(PTE_ADDR(ptes[i])));
+	}
+	pgdir[PDX(va)] = 0;
+	page_decref(pt);
+}
+
 //
 // Map [va, va+size) of virtual address space to physical [pa, pa+size)
 // in the page table rooted at pgdir.  Size is a multiple of PGSIZE.
@@ -515,6 +737,8 @@ page_insert(pde_t *pgdir, struct Page *pp, void *va, int perm)
 {
 	// Fill this function in
 	pte_t *pte;
+	if(pgdir_unshare(pgdir, va) < 0)
+		return -E_NO_MEM;
 	pte = pgdir_walk(pgdir, va, 1);
 	if(pte == NULL) 
 		return -E_NO_MEM;
@@ -523,8 +747,12 @@ page_insert(pde_t *pgdir, struct Page *pp, void *va, int perm)
 	// page_remove, because if put after page_remove, 
 	// when the same pp is re_inserted, the pp maybe free in page_remove.
 	// then we pp->ref++, so the the free pp have pp_ref > 0. this wrong.
-	if(*pte | PTE_P)
+	if(*pte & PTE_P)
 		page_remove(pgdir, va);
+	if(rmap_add(pp, pgdir_pt(pgdir, va), va) < 0) {
+		page_decref(pp);
+		return -E_NO_MEM;
+	}
     *pte = page2pa(pp) | perm | PTE_P;
 	tlb_invalidate(pgdir, va);
 	return 0;
@@ -547,7 +775,7 @@ page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
 	// Fill this function in
 	pte_t *pte;
 	pte = pgdir_walk(pgdir, va, 0);
-	if(pte != NULL) {
+	if(pte != NULL && (*pte & PTE_P)) {
 		if(pte_store != NULL)
 			*pte_store = pte;
 		return pa2page(PTE_ADDR(*pte));
@@ -577,24 +805,91 @@ page_remove(pde_t *pgdir, void *va)
 	// Fill this function in
 	struct Page *pg;
 	pte_t *pte;
+	if(pgdir_unshare(pgdir, va) < 0)
+		panic("page_remove: cannot unshare page table");
 	pg = page_lookup(pgdir, va, &pte);
 	if(pg != NULL) {
+		rmap_remove(pg, pgdir_pt(pgdir, va), va);
+		*pte = 0;
+		// Queue the invalidation before the page can be freed, so
+		// that page_alloc sees it pending (see pp_free_round).
+		tlb_invalidate(pgdir, va);
 		page_decref(pg);
-    *pte = 0;
-	tlb_invalidate(pgdir, va);
 	}	
 }
 
 //
-// Invalidate a TLB entry, but only if the page tables being
-// edited are the ones currently in use by the processor.
+// Can the mapping described by 'rm' be dropped and later recovered
+// by its owner?  That is the case for clean pages in the file system
+// server's block cache: its page fault handler reads them back in
+// from disk.  Mappings in an env running on another CPU are left alone,
+// since that CPU may dirty the page behind our back.
 //
-void
-tlb_invalidate(pde_t *pgdir, void *va)
+static bool
+rmap_reclaimable(struct Rmap *rm, struct Env *fsenv)
+{
+	if (rm->rm_va < DISKMAP || rm->rm_va >= DISKMAP + DISKSIZE)
+		return 0;
+	if (pgdir_pt(fsenv->env_pgdir, (void *) rm->rm_va) != rm->rm_pt
+	    || rm->rm_pt->pp_ref != 1)
+		return 0;
+	if (fsenv->env_status == ENV_RUNNING && fsenv->env_cpunum != cpunum())
+		return 0;
+	return !(*rmap_pte(rm) & PTE_D);
+}
+
+//
+// Try to free 'n' pages under memory pressure by dropping every
+// mapping of pages whose mappings are all reclaimable (see above).
+// The pages array is swept with a clock hand: a page whose mappings
+// were accessed since the last sweep gets its PTE_A bits cleared and
+// a second chance.
+//
+// Returns the number of pages freed.
+//
+int
+page_reclaim(int n)
 {
-	// Flush the entry only if we're modifying the current address space.
-	if (!curenv || curenv->env_pgdir == pgdir)
-		invlpg(va);
+	struct Env *fsenv = NULL;
+	struct Page *pp;
+	struct Rmap *rm;
+	pte_t *pte;
+	int i, nmap, accessed, freed = 0;
+
+	for (i = 0; i < NENV; i++)
+		if (envs[i].env_type == ENV_TYPE_FS
+		    && envs[i].env_status != ENV_FREE
+		    && envs[i].env_status != ENV_DYING)
+			fsenv = &envs[i];
+	if (!fsenv)
+		return 0;
+
+	for (i = 0; i < 2 * npages && freed < n; i++) {
+		pp = &pages[reclaim_hand];
+		reclaim_hand = (reclaim_hand + 1) % npages;
+		if (pp->pp_ref == 0 || pp->pp_rmap == NULL)
+			continue;
+
+		// Every reference must come from a reclaimable mapping.
+		nmap = accessed = 0;
+		for (rm = pp->pp_rmap; rm; rm = rm->rm_next, nmap++) {
+			if (!rmap_reclaimable(rm, fsenv))
+				break;
+			pte = rmap_pte(rm);
+			if (*pte & PTE_A) {
+				*pte &= ~PTE_A;
+				tlb_invalidate(fsenv->env_pgdir, (void *) rm->rm_va);
+				accessed = 1;
+			}
+		}
+		if (rm || nmap != pp->pp_ref || accessed)
+			continue;
+
+		while ((rm = pp->pp_rmap) != NULL)
+			page_remove(fsenv->env_pgdir, (void *) rm->rm_va);
+		freed++;
+	}
+	return freed;
 }
 
 static uintptr_t user_mem_check_addr;
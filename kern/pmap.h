@@ -49,8 +49,26 @@ _kaddr(const char *file, int line, physaddr_t pa)
 enum {
 	// For page_alloc, zero the returned physical page.
 	ALLOC_ZERO = 1<<0,
+	// For page_alloc, reclaim pages if none are free (see
+	// page_reclaim).  Reclaim frees pages that nobody has a reference
+	// on besides their mappings, so the caller must not be holding a
+	// struct Page it has not yet taken a reference on.
+	ALLOC_RECLAIM = 1<<1,
 };
 
+// One reverse mapping: page_insert records, for every page table entry
+// it points at a page, where that entry lives.  page_remove drops it.
+// A page table shared by several page directories holds one entry, and
+// so one reverse mapping, for all of them.
+struct Rmap {
+	struct Rmap *rm_next;	// Next mapping of the same page
+	struct Page *rm_pt;	// Page table holding the mapping
+	uintptr_t rm_va;	// Virtual address the page is mapped at
+};
+
+// Number of reverse mappings reserved per physical page at boot.
+#define RMAP_PER_PAGE	2
+
 void	mem_init(void);
 void	boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
 
@@ -61,6 +79,11 @@ int	page_insert(pde_t *pgdir, struct Page *pp, void *va, int perm);
 void	page_remove(pde_t *pgdir, void *va);
 struct Page *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
 void	page_decref(struct Page *pp);
+int	page_reclaim(int n);
+
+int	pgdir_share(pde_t *srcpgdir, pde_t *dstpgdir, const void *va, int cowbits);
+int	pgdir_unshare(pde_t *pgdir, const void *va);
+void	pgdir_release(pde_t *pgdir, const void *va);
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
 
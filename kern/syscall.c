@@ -13,6 +13,8 @@
 #include <kern/sched.h>
 #include <kern/time.h>
 #include <kern/e1000.h>
+#include <kern/tlb.h>
+#include <kern/futex.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -69,6 +71,13 @@ sys_yield(void)
 	sched_yield();
 }
 
+// Is 'e' the network server, or one of the shards and helpers it forked?
+static bool
+env_is_ns(struct Env *e)
+{
+	return e->env_type == ENV_TYPE_NS || e->env_type == ENV_TYPE_NS_HELPER;
+}
+
 // Allocate a new environment.
 // Returns envid of new environment, or < 0 on error.  Errors are:
 //	-E_NO_FREE_ENV if no free environment is available.
@@ -90,10 +99,45 @@ sys_exofork(void)
 	child->env_status = ENV_NOT_RUNNABLE;
 	memmove(&child->env_tf, &curenv->env_tf, sizeof(curenv->env_tf));
 	child->env_tf.tf_regs.reg_eax = 0;
+	child->env_netq = curenv->env_netq;
+	// The network server's shards and helpers are forked from it.
+	// They may use the driver too, but only the server itself is
+	// ENV_TYPE_NS, the env clients find with ipc_find_env.
+	if (env_is_ns(curenv))
+		child->env_type = ENV_TYPE_NS_HELPER;
 	return child->env_id;
 //	panic("sys_exofork not implemented");
 }
 
+// Create a new environment that shares the current one's address space,
+// for a thread.  It starts at 'eip' with stack pointer 'esp', takes page
+// faults on the exception stack ending at 'uxstacktop', with the same
+// upcall as us, and is left ENV_NOT_RUNNABLE.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_INVAL if uxstacktop is above UTOP or not page-aligned.
+static envid_t
+sys_exofork_shared(uintptr_t eip, uintptr_t esp, uintptr_t uxstacktop)
+{
+	struct Env *child;
+	int ret;
+
+	if (uxstacktop > UTOP || uxstacktop < PGSIZE || PGOFF(uxstacktop))
+		return -E_INVAL;
+	if ((ret = env_alloc_vm(&child, curenv->env_id, curenv->env_pgdir)) < 0)
+		return ret;
+	child->env_status = ENV_NOT_RUNNABLE;
+	child->env_tf.tf_eip = eip;
+	child->env_tf.tf_esp = esp;
+	child->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	child->env_uxstacktop = uxstacktop;
+	child->env_netq = curenv->env_netq;
+	if (env_is_ns(curenv))
+		child->env_type = ENV_TYPE_NS_HELPER;
+	return child->env_id;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -116,6 +160,7 @@ sys_env_set_status(envid_t envid, int status)
 		return -E_INVAL;
 	if((ret = envid2env(envid, &env, 1))< 0)
 		return ret;
+	futex_cancel(env);
 	env->env_status = status;	
 	return 0;
 //	panic("sys_env_set_status not implemented");
@@ -206,10 +251,15 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 		return -E_INVAL;
 	if((ret = envid2env(envid, &env, 1)) < 0)
 		return ret;
-	if((pp = page_alloc(ALLOC_ZERO)) == NULL)
+	// The one allocation user memory pressure goes through, and it
+	// holds no other page yet, so it may reclaim.
+	if((pp = page_alloc(ALLOC_ZERO | ALLOC_RECLAIM)) == NULL)
 		return -E_NO_MEM;
-	if((ret = page_insert(env->env_pgdir, pp, va, perm)) < 0);
+	if((ret = page_insert(env->env_pgdir, pp, va, perm)) < 0) {
+		page_free(pp);
 		return ret;
+	}
+	return 0;
 
 //	panic("sys_page_alloc not implemented");
 }
@@ -260,7 +310,7 @@ sys_page_map(envid_t srcenvid, void *srcva,
 		return -E_INVAL;
 	if((perm & PTE_W) && !(*src_pte & PTE_W))
 		return -E_INVAL;
-	if((ret = page_insert(dstenv->env_pgdir, pp, dstva, perm)) < 0);
+	if((ret = page_insert(dstenv->env_pgdir, pp, dstva, perm)) < 0)
 		return ret;
 	return 0;
 //	panic("sys_page_map not implemented");
@@ -287,11 +337,149 @@ sys_page_unmap(envid_t envid, void *va)
 		return -E_INVAL;
 	if((ret = envid2env(envid, &env, 1)) < 0)
 		return ret;
+	if(pgdir_unshare(env->env_pgdir, va) < 0)
+		return -E_NO_MEM;
 	page_remove(env->env_pgdir, va);
 	return 0;
 //	panic("sys_page_unmap not implemented");
 }
 
+// Change the permissions of the page mapped at 'va' in envid's address
+// space to 'perm', without touching the page's reference count.
+// Perm has the same restrictions as in sys_page_map: write access
+// may only be kept, never granted to a read-only page.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_INVAL if no page is mapped at va.
+//	-E_INVAL if perm is inappropriate (see sys_page_map).
+//	-E_NO_MEM if the page table had to be unshared and that failed.
+static int
+sys_page_protect(envid_t envid, void *va, int perm)
+{
+	int ret;
+	pte_t *pte;
+	struct Env *env;
+	if((uintptr_t)va >= UTOP || (uintptr_t)va % PGSIZE)
+		return -E_INVAL;
+	if((perm & ~PTE_SYSCALL) || !(perm & PTE_P) || !(perm & PTE_U))
+		return -E_INVAL;
+	if((ret = envid2env(envid, &env, 1)) < 0)
+		return ret;
+	if((pte = pgdir_walk(env->env_pgdir, va, 0)) == NULL || !(*pte & PTE_P))
+		return -E_INVAL;
+	if((perm & PTE_W) && !(*pte & PTE_W))
+		return -E_INVAL;
+	if(pgdir_unshare(env->env_pgdir, va) < 0)
+		return -E_NO_MEM;
+	pte = pgdir_walk(env->env_pgdir, va, 0);
+	*pte = PTE_ADDR(*pte) | perm;
+	tlb_invalidate(env->env_pgdir, va);
+	return 0;
+}
+
+// Share srcenvid's page table for the PTSIZE-aligned range at 'va'
+// with dstenvid, which then sees the same mappings there.
+// Writable pages without PTE_SHARE are made read-only in both, with
+// the PTE_AVAIL bits in 'perm' set.  Either env changing a mapping in
+// the range later gets a private copy of the page table first.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist,
+//		or the caller doesn't have permission to change one of them.
+//	-E_INVAL if va >= UTOP or va is not PTSIZE-aligned.
+//	-E_INVAL if srcenvid has no page table at va, or dstenvid has one.
+//	-E_INVAL if perm has bits outside PTE_AVAIL.
+//	-E_NO_MEM if srcenvid's page table had to be unshared and that failed.
+static int
+sys_page_sharept(envid_t srcenvid, void *va, envid_t dstenvid, int perm)
+{
+	int ret;
+	struct Env *srcenv, *dstenv;
+	if((uintptr_t)va >= UTOP || (uintptr_t)va % PTSIZE)
+		return -E_INVAL;
+	if((ret = envid2env(srcenvid, &srcenv, 1)) < 0)
+		return ret;
+	if((ret = envid2env(dstenvid, &dstenv, 1)) < 0)
+		return ret;
+	return pgdir_share(srcenv->env_pgdir, dstenv->env_pgdir, va, perm);
+}
+
+// Execute the 'n' page operations in 'ops' in order, under a single
+// kernel entry.  Each entry behaves exactly like the corresponding
+// sys_page_alloc, sys_page_map, sys_page_unmap, sys_page_protect or
+// sys_page_sharept call (see struct PageOp in inc/syscall.h).
+//
+// Entries are copied into the kernel a chunk at a time before being
+// executed, so a batch may safely unmap or write-protect the pages
+// holding its own array.
+//
+// Execution stops at the first entry that fails.  The number of
+// entries that completed is stored in curenv->env_batch_done either way.
+//
+// Returns 0 if all entries succeeded, < 0 on error.  Errors are:
+//	-E_INVAL if n < 0 or n > PAGEOP_MAX.
+//	-E_FAULT if the array is not readable by the caller.
+//	the error of the first failing entry, or -E_INVAL for an
+//		unknown po_op.
+static int
+sys_page_batch(struct PageOp *ops, int n)
+{
+	struct PageOp chunk[16], *po;
+	int i, j, m, ret;
+
+	curenv->env_batch_done = 0;
+	if(n < 0 || n > PAGEOP_MAX)
+		return -E_INVAL;
+	for(i = 0; i < n; i += m) {
+		m = MIN(n - i, (int) (sizeof(chunk) / sizeof(chunk[0])));
+		if(user_mem_check(curenv, ops + i, m * sizeof(struct PageOp), PTE_U) < 0)
+			return -E_FAULT;
+		memmove(chunk, ops + i, m * sizeof(struct PageOp));
+		for(j = 0; j < m; j++) {
+			po = &chunk[j];
+			switch(po->po_op) {
+			case PAGEOP_ALLOC:
+				ret = sys_page_alloc(po->po_dstenv, po->po_dstva, po->po_perm);
+				break;
+			case PAGEOP_MAP:
+				ret = sys_page_map(po->po_srcenv, po->po_srcva,
+						   po->po_dstenv, po->po_dstva, po->po_perm);
+				break;
+			case PAGEOP_UNMAP:
+				ret = sys_page_unmap(po->po_dstenv, po->po_dstva);
+				break;
+			case PAGEOP_PROTECT:
+				ret = sys_page_protect(po->po_dstenv, po->po_dstva, po->po_perm);
+				break;
+			case PAGEOP_SHAREPT:
+				ret = sys_page_sharept(po->po_srcenv, po->po_srcva,
+						       po->po_dstenv, po->po_perm);
+				break;
+			default:
+				ret = -E_INVAL;
+				break;
+			}
+			if(ret < 0)
+				return ret;
+			curenv->env_batch_done++;
+		}
+	}
+	return 0;
+}
+
+// Copy the kernel's TLB shootdown counters to 'ts'.
+// Destroys the environment if 'ts' is not writable.
+static int
+sys_tlb_stats(struct TlbStats *ts)
+{
+	user_mem_assert(curenv, ts, sizeof(*ts), PTE_P | PTE_U | PTE_W);
+	*ts = tlb_stats;
+	return 0;
+}
+
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
@@ -330,14 +518,21 @@ sys_page_unmap(envid_t envid, void *va)
 //		current environment's address space.
 //	-E_NO_MEM if there's not enough memory to map srcva in envid's
 //		address space.
+//
+// 'npages' consecutive pages starting at srcva are sent (0 means 1), and
+// land at consecutive addresses from the receiver's dstva.  Sending more
+// pages than the receiver asked for is -E_INVAL; every page is checked
+// before any of them is mapped.
 static int
-sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+		 int npages)
 {
 	// LAB 4: Your code here.
 	struct Env* dstenv;
-	int ret;
+	int ret, i;
 	pte_t *pte;
 	uintptr_t dstva;
+	struct Page *pages[IPC_MAXPAGES];
 	if((ret = envid2env(envid, &dstenv, 0)) < 0) 
 		return ret;
 	if(dstenv->env_ipc_recving == 0)
@@ -346,14 +541,22 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 		return -E_INVAL;
 	if(PGOFF((uintptr_t)srcva))
 		return -E_INVAL;
+	if(npages == 0)
+		npages = 1;
 	
+	dstenv->env_ipc_npages = 0;
 	if((uintptr_t)srcva != USTACKTOP) {
 		if((perm & ~PTE_SYSCALL) || !(perm & PTE_P) || !(perm & PTE_U))
 			return -E_INVAL;
-		if((pte = pgdir_walk(curenv->env_pgdir, srcva, 0)) == NULL)
-			return -E_INVAL;
-		if((perm & PTE_W) && !(*pte & PTE_W))
+		if(npages < 0 || npages > IPC_MAXPAGES
+		   || (uintptr_t)srcva + npages * PGSIZE > UTOP)
 			return -E_INVAL;
+		for(i = 0; i < npages; i++) {
+			if((pte = pgdir_walk(curenv->env_pgdir, srcva + i * PGSIZE, 0)) == NULL)
+				return -E_INVAL;
+			if((perm & PTE_W) && !(*pte & PTE_W))
+				return -E_INVAL;
+		}
 		dstva = (uintptr_t)dstenv->env_ipc_dstva;
 		if(dstva != USTACKTOP) {
 /*			if((ret = sys_page_map(0, srcva, envid, (void*)dstva, perm)) < 0)  
@@ -362,12 +565,22 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
  * the child of current env. sys_page_map require envid is current env or the
  * child of current env;
  */			
-			struct Page *page;
-			if ((page = page_lookup(curenv->env_pgdir, srcva, NULL)) == NULL)
+			if(npages > dstenv->env_ipc_maxpages)
 				return -E_INVAL;
-			if (page_insert(dstenv->env_pgdir, page, (void*)dstva, perm) < 0)
-				return -E_NO_MEM;
+			for(i = 0; i < npages; i++)
+				if ((pages[i] = page_lookup(curenv->env_pgdir, srcva + i * PGSIZE, NULL)) == NULL)
+					return -E_INVAL;
+			for(i = 0; i < npages; i++)
+				if (page_insert(dstenv->env_pgdir, pages[i], (void*)(dstva + i * PGSIZE), perm) < 0) {
+					// Send all of them or none: the receiver
+					// is still waiting, and a retry maps them
+					// again.
+					while (--i >= 0)
+						page_remove(dstenv->env_pgdir, (void*)(dstva + i * PGSIZE));
+					return -E_NO_MEM;
+				}
 			dstenv->env_ipc_perm = perm;
+			dstenv->env_ipc_npages = npages;
 		} else {
 			dstenv->env_ipc_perm = 0;
 		}
@@ -389,13 +602,15 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 //
 // If 'dstva' is < UTOP, then you are willing to receive a page of data.
 // 'dstva' is the virtual address at which the sent page should be mapped.
+// Up to 'maxpages' pages (0 means 1) may arrive, mapped from dstva on;
+// env_ipc_npages says how many did.
 //
 // This function only returns on error, but the system call will eventually
 // return 0 on success.
 // Return < 0 on error.  Errors are:
 //	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
 static int
-sys_ipc_recv(void *dstva)
+sys_ipc_recv(void *dstva, int maxpages)
 {
 	// LAB 4: Your code here.
 //	panic("sys_ipc_recv not implemented");
@@ -403,13 +618,75 @@ sys_ipc_recv(void *dstva)
 		return -E_INVAL;
 	if(PGOFF((uintptr_t)dstva))
 		return -E_INVAL;
+	if(maxpages == 0)
+		maxpages = 1;
+	if(maxpages < 0 || maxpages > IPC_MAXPAGES
+	   || (dstva != (void*)USTACKTOP && (uintptr_t)dstva + maxpages * PGSIZE > UTOP))
+		return -E_INVAL;
+	if (curenv->env_alarm_pending) {
+		// An alarm went off before we got here: it is the message.
+		curenv->env_alarm_pending = 0;
+		curenv->env_ipc_from = 0;
+		curenv->env_ipc_value = curenv->env_alarm_value;
+		curenv->env_ipc_perm = 0;
+		curenv->env_ipc_npages = 0;
+		return 0;
+	}
 	curenv->env_ipc_dstva = dstva;
+	curenv->env_ipc_maxpages = maxpages;
 	curenv->env_ipc_recving = 1;	
 	curenv->env_status = ENV_NOT_RUNNABLE;
+	// Wake the senders that found us not receiving.
+	curenv->env_ipc_nrecv++;
+	futex_wake_pa(PADDR(&curenv->env_ipc_nrecv), NENV);
 	sched_yield();
 	return 0;
 }
 
+// Have the kernel send the current environment an IPC with value
+// 'value' at time 'msec' (as returned by sys_time_msec), and then every
+// 'period' ms if 'period' is not 0.  The IPC comes from envid 0 and
+// carries no page.  If the env is not in sys_ipc_recv when the alarm
+// goes off, its next sys_ipc_recv returns the alarm right away; an
+// alarm going off again meanwhile is merged with it.
+// Replaces any alarm set before.  An msec of 0 cancels the alarm.
+// Returns 0.
+static int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+	time_set_alarm(curenv, msec, period, value);
+	return 0;
+}
+
+// Sleep until another env calls sys_futex_wake on the word at 'addr',
+// if it holds 'val', or until time 'msec' (never, if ~0).  The word is
+// named by its physical address, so envs sharing its page can use it
+// wherever each has it mapped.  The wait may also end early, as when
+// a mapping of the page is removed, so callers should check their
+// condition again.
+// Returns 0 when woken, < 0 on error.  Errors are:
+//	-E_INVAL if 'addr' is not an aligned word on a mapped user page.
+//	-E_AGAIN if the word is not 'val'.
+//	-E_TIMEOUT if time 'msec' has passed.
+static int
+sys_futex_wait(uint32_t *addr, uint32_t val, uint32_t msec)
+{
+	int r;
+
+	if ((r = futex_wait(curenv, (uintptr_t) addr, val, msec)) < 0)
+		return r;
+	sched_yield();
+}
+
+// Wake up to 'n' envs waiting on the word at 'addr'.
+// Returns how many woke, or -E_INVAL if 'addr' is not an aligned word on
+// a mapped user page.
+static int
+sys_futex_wake(uint32_t *addr, int n)
+{
+	return futex_wake(curenv, (uintptr_t) addr, n);
+}
+
 // Return the current time.
 static int
 sys_time_msec(void)
@@ -424,13 +701,134 @@ sys_net_transmit(void *src, size_t len)
 	user_mem_assert(curenv, src, len, PTE_P | PTE_U);
 	return transmit_e1000(src, len);
 }
+// Receive a packet into 'dst', which must have room for
+// MAX_PACKET_SIZE bytes.  Blocks until a packet is available.
+// Returns the packet length, or -E_BUSY if another env is already
+// blocked on the caller's receive queue.
 static int
 sys_net_receive(void* dst)
 {
-	if((uintptr_t)dst >= UTOP)
+	int r;
+
+	user_mem_assert(curenv, dst, MAX_PACKET_SIZE, PTE_P | PTE_U | PTE_W);
+	if ((r = receive_e1000(dst)) != -E_DESC_EMPTY)
+		return r;
+	if ((r = e1000_rx_wait(curenv)) < 0)
+		return r;
+	sched_yield();
+}
+// Receive up to 'n' packets from the caller's receive queue without
+// copying them.  The caller donates
+// the pages mapped at va, va+PGSIZE, ..., va+(n-1)*PGSIZE to the
+// receive ring, and gets a page holding a packet (laid out as a
+// struct jif_pkt) mapped in place of each page it donated.
+// Blocks until at least one packet is available.
+// Returns the number of packets received, < 0 on error.  Errors are:
+//	-E_INVAL if va >= UTOP, va is not page-aligned,
+//		or n < 1 or n > NETBATCH_MAX.
+//	-E_INVAL if no writable page is mapped at va, or if the page is
+//		mapped anywhere else (the card would overwrite it).
+//	-E_NO_MEM if there's no memory to map the packet.
+//	-E_BUSY if another env is already blocked on the receive queue.
+static int
+sys_net_recv_pages(void *va, int n)
+{
+	int r;
+
+	if ((uintptr_t) va >= UTOP || PGOFF(va)
+	    || n < 1 || n > NETBATCH_MAX || (uintptr_t) va + n * PGSIZE > UTOP)
+		return -E_INVAL;
+	if ((r = receive_e1000_pages(curenv, va, n)) != -E_DESC_EMPTY)
+		return r;
+	if ((r = e1000_rx_wait(curenv)) < 0)
+		return r;
+	sched_yield();
+}
+
+// Transmit up to 'n' packets, one per entry of 'frames', with one
+// doorbell write.  The packets are copied.
+// Returns the number of packets queued, < 0 on error.  Errors are:
+//	-E_INVAL if n < 1 or n > NETBATCH_MAX.
+//	see transmit_e1000_batch for the others.
+static int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+	struct NetFrag kframes[NETBATCH_MAX];
+
+	if (n < 1 || n > NETBATCH_MAX)
+		return -E_INVAL;
+	user_mem_assert(curenv, frames, n * sizeof(*frames), PTE_P | PTE_U);
+	memmove(kframes, frames, n * sizeof(*frames));
+	return transmit_e1000_batch(curenv, kframes, n);
+}
+
+// Transmit the packet made of 'nfrag' fragments without copying it,
+// with the checksum and segmentation offloads in 'off', if not NULL.
+// See transmit_e1000_sg for the return values.  Also returns
+// -E_INVAL if nfrag < 0 or nfrag > NETFRAG_MAX, and -E_BAD_ENV if the
+// caller is not part of the network server: completions are counted
+// by receive queue, and must only go back to that queue's shard.
+static int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+	struct NetFrag kfrags[NETFRAG_MAX];
+	struct NetOffload koff;
+
+	if (!env_is_ns(curenv))
+		return -E_BAD_ENV;
+	if (nfrag < 0 || nfrag > NETFRAG_MAX)
 		return -E_INVAL;
-	return receive_e1000(dst);
+	user_mem_assert(curenv, frags, nfrag * sizeof(*frags), PTE_P | PTE_U);
+	memmove(kfrags, frags, nfrag * sizeof(*frags));
+	if (off) {
+		user_mem_assert(curenv, off, sizeof(*off), PTE_P | PTE_U);
+		koff = *off;
+	}
+	return transmit_e1000_sg(curenv, kfrags, nfrag, off ? &koff : NULL);
 }
+
+// Copy the network driver's counters to 'ns'.
+// Destroys the environment if 'ns' is not writable.
+static int
+sys_net_stats(struct NetStats *ns)
+{
+	user_mem_assert(curenv, ns, sizeof(*ns), PTE_P | PTE_U | PTE_W);
+	e1000_get_stats(ns);
+	return 0;
+}
+
+// Bind the current environment to network receive queue 'q':
+// sys_net_recv_pages and sys_net_receive take packets from it, and
+// packets coming back on flows the env sends on are steered to it.
+// Environments it creates later start out bound to the same queue.
+// Returns the number of receive queues, < 0 on error.  Errors are:
+//	-E_BAD_ENV if the caller is not the network server.
+//	-E_INVAL if q is not a queue the driver has.
+static int
+sys_net_set_queue(int q)
+{
+	if (!env_is_ns(curenv))
+		return -E_BAD_ENV;
+	if (q < 0 || q >= e1000_nq)
+		return -E_INVAL;
+	curenv->env_netq = q;
+	return e1000_nq;
+}
+
+// Have the current environment's receive queue take (if 'on') or stop
+// taking a share of the new TCP connections to 'port'.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if the caller is not the network server.
+//	-E_NO_MEM if the queue listens on too many ports already.
+//	-E_INVAL if 'on' is 0 and the queue was not listening on 'port'.
+static int
+sys_net_listen(uint16_t port, bool on)
+{
+	if (!env_is_ns(curenv))
+		return -E_BAD_ENV;
+	return e1000_listen(curenv->env_netq, port, on);
+}
+
 static int
 sys_get_mac(uint32_t *low, uint32_t *high)
 {
@@ -447,6 +845,7 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	// Call the function corresponding to the 'syscallno' parameter.
 	// Return any appropriate return value.
 	// LAB 3: Your code here.
+	curenv->env_syscalls++;
 	switch(syscallno) {
 		case SYS_cputs: 
 			sys_cputs((char*)a1, a2);
@@ -473,9 +872,9 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		case SYS_env_set_pgfault_upcall:
 			 return sys_env_set_pgfault_upcall(a1, (void*)a2);
 		case SYS_ipc_try_send:
-			 return sys_ipc_try_send(a1, a2, (void*)a3, a4);
+			 return sys_ipc_try_send(a1, a2, (void*)a3, a4, a5);
 		case SYS_ipc_recv:
-			 return sys_ipc_recv((void*)a1);
+			 return sys_ipc_recv((void*)a1, a2);
 		case SYS_env_set_trapframe:
 			 return sys_env_set_trapframe(a1, (void*)a2);
 		case SYS_time_msec:
@@ -486,6 +885,30 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 			 return sys_net_receive((void*)a1);
 		case SYS_get_mac:
 			 return sys_get_mac((void*)a1, (void*)a2);
+		case SYS_page_batch:
+			 return sys_page_batch((void*)a1, a2);
+		case SYS_tlb_stats:
+			 return sys_tlb_stats((void*)a1);
+		case SYS_net_recv_pages:
+			 return sys_net_recv_pages((void*)a1, a2);
+		case SYS_net_transmit_batch:
+			 return sys_net_transmit_batch((void*)a1, a2);
+		case SYS_net_stats:
+			 return sys_net_stats((void*)a1);
+		case SYS_alarm:
+			 return sys_alarm(a1, a2, a3);
+		case SYS_futex_wait:
+			 return sys_futex_wait((uint32_t*)a1, a2, a3);
+		case SYS_futex_wake:
+			 return sys_futex_wake((uint32_t*)a1, a2);
+		case SYS_exofork_shared:
+			 return sys_exofork_shared(a1, a2, a3);
+		case SYS_net_set_queue:
+			 return sys_net_set_queue(a1);
+		case SYS_net_listen:
+			 return sys_net_listen(a1, a2);
+		case SYS_net_transmit_sg:
+			 return sys_net_transmit_sg((void*)a1, a2, (void*)a3);
 		default:
 			return -E_INVAL;
 	}
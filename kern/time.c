@@ -1,7 +1,12 @@
 #include <kern/time.h>
+#include <kern/env.h>
+#include <kern/futex.h>
 #include <inc/assert.h>
 
 static unsigned int ticks;
+static uint32_t alarm_next = ~0;	// No alarm goes off before this
+
+static void time_alarms(void);
 
 void
 time_init(void)
@@ -17,6 +22,8 @@ time_tick(void)
 	ticks++;
 	if (ticks * 10 < ticks)
 		panic("time_tick: time overflowed");
+	time_alarms();
+	futex_timeouts(time_msec());
 }
 
 unsigned int
@@ -24,3 +31,59 @@ time_msec(void)
 {
 	return ticks * 10;
 }
+
+// Set e's alarm to go off at time 'msec', then every 'period' ms if
+// 'period' is not 0.  An msec of 0 clears it.
+void
+time_set_alarm(struct Env *e, uint32_t msec, uint32_t period, uint32_t value)
+{
+	e->env_alarm = msec;
+	e->env_alarm_period = period;
+	e->env_alarm_value = value;
+	e->env_alarm_pending = 0;
+	if (msec && msec < alarm_next)
+		alarm_next = msec;
+}
+
+// Deliver e's alarm as an IPC from envid 0, or keep it for e's next
+// sys_ipc_recv if e is not receiving.
+static void
+alarm_fire(struct Env *e)
+{
+	if (!e->env_ipc_recving) {
+		e->env_alarm_pending = 1;
+		return;
+	}
+	e->env_ipc_recving = 0;
+	e->env_ipc_from = 0;
+	e->env_ipc_value = e->env_alarm_value;
+	e->env_ipc_perm = 0;
+	e->env_ipc_npages = 0;
+	e->env_tf.tf_regs.reg_eax = 0;
+	e->env_status = ENV_RUNNABLE;
+}
+
+// Deliver the alarms that are due and rearm the periodic ones.
+static void
+time_alarms(void)
+{
+	uint32_t now = time_msec(), next = ~0;
+	struct Env *e;
+
+	if (now < alarm_next)
+		return;
+	for (e = envs; e < envs + NENV; e++) {
+		if (!e->env_alarm || e->env_status == ENV_FREE)
+			continue;
+		if (e->env_alarm <= now) {
+			alarm_fire(e);
+			if (!e->env_alarm_period)
+				e->env_alarm = 0;
+			else if ((e->env_alarm += e->env_alarm_period) <= now)
+				e->env_alarm = now + e->env_alarm_period;
+		}
+		if (e->env_alarm)
+			next = MIN(next, e->env_alarm);
+	}
+	alarm_next = next;
+}
@@ -4,8 +4,14 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/types.h>
+
 void time_init(void);
 void time_tick(void);
 unsigned int time_msec(void);
 
+struct Env;
+void time_set_alarm(struct Env *e, uint32_t msec, uint32_t period,
+		    uint32_t value);
+
 #endif /* JOS_KERN_TIME_H */
@@ -0,0 +1,172 @@
+// Batched TLB shootdown.
+//
+// A page table change must reach every CPU that may cache the old
+// translation.  The CPUs that may cache an address space are those
+// whose cpu_pgdir is that page directory: this is the address space's
+// CPU mask, and loading another pgdir flushes a CPU's entries for it.
+//
+// tlb_invalidate() flushes the local TLB right away, but for other
+// CPUs it only queues the address (up to TLB_BATCH of them, after
+// which the CPU gets a full flush instead).  tlb_shootdown() then
+// signals all CPUs with queued work using one IPI each and waits
+// until they have flushed.  It runs before the kernel lock is
+// released, and before page_alloc hands out a page freed since the
+// last round (tlb_round), whose stale translations may still be queued.
+//
+// Each CPU counts posted (cpu_tlb_gen) and completed (cpu_tlb_done)
+// shootdowns.  A CPU that has trapped and is spinning on the kernel
+// lock cannot take the IPI, but it does not touch user memory until it
+// holds the lock either, so we do not wait for it: it carries out its
+// deferred flush as soon as it acquires the lock.
+
+#include <inc/x86.h>
+#include <inc/trap.h>
+
+#include <kern/cpu.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/tlb.h>
+
+#define CPUID_PGE	(1 << 13)	// CPUID.1:EDX, global pages supported
+
+struct TlbStats tlb_stats;
+uint32_t tlb_round;		// Shootdown rounds so far
+static uint32_t tlb_pending;	// CPUs with queued, unsignalled work
+
+// Queue 'va' (or a full flush if 'va' is 0) for CPU 'c'.
+static void
+tlb_queue(struct Cpu *c, uintptr_t va)
+{
+	tlb_stats.ts_queued++;
+	if (c->cpu_tlb_n == TLB_FLUSH_ALL)
+		return;
+	if (va == 0 || c->cpu_tlb_n == TLB_BATCH) {
+		c->cpu_tlb_n = TLB_FLUSH_ALL;
+		tlb_stats.ts_full++;
+	} else
+		c->cpu_tlb_va[c->cpu_tlb_n++] = va;
+	tlb_pending |= 1 << (c - cpus);
+}
+
+// Queue 'va' in 'pgdir' for every other CPU in the address space's mask.
+static void
+tlb_queue_pgdir(pde_t *pgdir, uintptr_t va)
+{
+	struct Cpu *c;
+
+	for (c = cpus; c < cpus + ncpu; c++)
+		if (c != thiscpu && c->cpu_pgdir == pgdir)
+			tlb_queue(c, va);
+}
+
+//
+// Invalidate a TLB entry for 'va' in 'pgdir' on every CPU that may
+// cache it.  The local flush happens now; the others at the next
+// tlb_shootdown().
+//
+void
+tlb_invalidate(pde_t *pgdir, void *va)
+{
+	// Flush the entry only if we're modifying the current address space.
+	if (!curenv || rcr3() == PADDR(pgdir))
+		invlpg(va);
+	tlb_queue_pgdir(pgdir, (uintptr_t) ROUNDDOWN(va, PGSIZE) | 1);
+}
+
+//
+// Like tlb_invalidate, for changes too large to flush page by page.
+//
+void
+tlb_invalidate_all(pde_t *pgdir)
+{
+	if (rcr3() == PADDR(pgdir))
+		lcr3(PADDR(pgdir));
+	tlb_queue_pgdir(pgdir, 0);
+}
+
+//
+// Enable global pages on this CPU, so that kernel mappings (those
+// with PTE_G) are not flushed when CR3 is reloaded.
+//
+void
+tlb_init_percpu(void)
+{
+	uint32_t eax, ebx, ecx, edx;
+
+	cpuid(1, &eax, &ebx, &ecx, &edx);
+	if (edx & CPUID_PGE)
+		lcr4(rcr4() | CR4_PGE);
+}
+
+//
+// Switch this CPU to 'pgdir'.  Loading CR3 flushes the whole
+// (non-global) TLB, which also completes any shootdown queued for us.
+// Returning to the address space that is already loaded, as every
+// system call does, keeps the TLB: local changes were flushed as they
+// were made and remote ones are queued for us.
+//
+void
+tlb_load_pgdir(pde_t *pgdir)
+{
+	if (rcr3() == PADDR(pgdir)) {
+		tlb_flush_pending();
+		thiscpu->cpu_pgdir = pgdir;
+		return;
+	}
+	tlb_stats.ts_cr3loads++;
+	lcr3(PADDR(pgdir));
+	thiscpu->cpu_pgdir = pgdir;
+	thiscpu->cpu_tlb_n = 0;
+	thiscpu->cpu_tlb_done = thiscpu->cpu_tlb_gen;
+}
+
+//
+// Carry out the shootdowns posted to this CPU.  Runs from the
+// T_TLBFLUSH IPI, and after acquiring the kernel lock.
+//
+void
+tlb_flush_pending(void)
+{
+	struct Cpu *c = thiscpu;
+	uint32_t gen = c->cpu_tlb_gen;
+	int i;
+
+	if (c->cpu_tlb_done == gen)
+		return;
+	if (c->cpu_tlb_n == TLB_FLUSH_ALL)
+		lcr3(rcr3());
+	else
+		for (i = 0; i < c->cpu_tlb_n; i++)
+			invlpg((void *) (c->cpu_tlb_va[i] & ~1));
+	c->cpu_tlb_n = 0;
+	c->cpu_tlb_done = gen;
+}
+
+//
+// Signal every CPU with queued invalidations and wait until each has
+// flushed, or is waiting for the kernel lock and will flush when it
+// gets it.  Must be called with the kernel lock held.
+//
+void
+tlb_shootdown(void)
+{
+	uint32_t mask, gen[NCPU];
+	int i;
+
+	if ((mask = tlb_pending) == 0)
+		return;
+	tlb_pending = 0;
+	tlb_round++;
+	tlb_stats.ts_rounds++;
+	for (i = 0; i < ncpu; i++)
+		if (mask & (1 << i)) {
+			gen[i] = ++cpus[i].cpu_tlb_gen;
+			lapic_ipi_cpu(cpus[i].cpu_id, T_TLBFLUSH);
+			tlb_stats.ts_ipis++;
+		}
+	for (i = 0; i < ncpu; i++)
+		if (mask & (1 << i))
+			while (cpus[i].cpu_tlb_done != gen[i]
+			       && !cpus[i].cpu_tlb_locking)
+				asm volatile("pause");
+}
@@ -0,0 +1,21 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_TLB_H
+#define JOS_KERN_TLB_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/memlayout.h>
+#include <inc/syscall.h>
+
+extern struct TlbStats tlb_stats;
+extern uint32_t tlb_round;
+
+void	tlb_init_percpu(void);
+void	tlb_load_pgdir(pde_t *pgdir);
+void	tlb_invalidate_all(pde_t *pgdir);
+void	tlb_shootdown(void);
+void	tlb_flush_pending(void);
+
+#endif	// !JOS_KERN_TLB_H
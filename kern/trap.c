@@ -14,6 +14,8 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/tlb.h>
+#include <kern/e1000.h>
 
 static struct Taskstate ts;
 
@@ -237,6 +239,13 @@ trap_dispatch(struct Trapframe *tf)
 		return;
 	}
 
+	// Handle network card interrupts.
+	if (e1000_irq && tf->tf_trapno == IRQ_OFFSET + e1000_irq) {
+		e1000_intr();
+		irq_eoi();
+		return;
+	}
+
 	// Handle processor exceptions.
 	// LAB 3: Your code here.
 	switch(tf->tf_trapno) {
@@ -281,12 +290,23 @@ trap(struct Trapframe *tf)
 	// the interrupt path.
 	assert(!(read_eflags() & FL_IF));
 
+	// TLB shootdowns are handled without the kernel lock: the
+	// sender holds it while it waits for us.
+	if (tf->tf_trapno == T_TLBFLUSH) {
+		tlb_flush_pending();
+		lapic_eoi();
+		env_pop_tf(tf);
+	}
+
 	if ((tf->tf_cs & 3) == 3) {
 		// Trapped from user mode.
 		// Acquire the big kernel lock before doing any
 		// serious kernel work.
 		// LAB 4: Your code here.
+		thiscpu->cpu_tlb_locking = 1;
 		lock_kernel();
+		tlb_flush_pending();
+		thiscpu->cpu_tlb_locking = 0;
 		assert(curenv);
 
 		// Garbage collect if current enviroment is a zombie
@@ -370,12 +390,14 @@ page_fault_handler(struct Trapframe *tf)
 	//   (the 'tf' variable points at 'curenv->env_tf').
 
 	// LAB 4: Your code here.
-	uintptr_t esp;
+	// Envs sharing an address space (see sys_exofork_shared) each have
+	// an exception stack of their own, ending at env_uxstacktop.
+	uintptr_t esp, xtop = curenv->env_uxstacktop;
 	if(curenv->env_pgfault_upcall) {
-		if(tf->tf_esp >= UXSTACKTOP - PGSIZE && tf->tf_esp <= UXSTACKTOP - 1) {
+		if(tf->tf_esp >= xtop - PGSIZE && tf->tf_esp <= xtop - 1) {
 			esp = tf->tf_esp - 4 - sizeof(struct UTrapframe);
 		} else {
-			esp = UXSTACKTOP - sizeof(struct UTrapframe);
+			esp = xtop - sizeof(struct UTrapframe);
 		}
 		user_mem_assert(curenv, (void*)esp, sizeof(struct UTrapframe), PTE_P|PTE_U|PTE_W);
 		struct UTrapframe *utf = (struct UTrapframe*) esp;
@@ -38,6 +38,7 @@ static ssize_t devcons_read(struct Fd*, void*, size_t);
 static ssize_t devcons_write(struct Fd*, const void*, size_t);
 static int devcons_close(struct Fd*);
 static int devcons_stat(struct Fd*, struct Stat*);
+static int devcons_poll(struct Fd*, int);
 
 struct Dev devcons =
 {
@@ -46,9 +47,13 @@ struct Dev devcons =
 	.dev_read =	devcons_read,
 	.dev_write =	devcons_write,
 	.dev_close =	devcons_close,
-	.dev_stat =	devcons_stat
+	.dev_stat =	devcons_stat,
+	.dev_poll =	devcons_poll
 };
 
+// A character devcons_poll took from the console, for devcons_read
+static int cons_peek;
+
 int
 iscons(int fdnum)
 {
@@ -83,7 +88,9 @@ devcons_read(struct Fd *fd, void *vbuf, size_t n)
 	if (n == 0)
 		return 0;
 
-	while ((c = sys_cgetc()) == 0)
+	c = cons_peek;
+	cons_peek = 0;
+	while (c == 0 && (c = sys_cgetc()) == 0)
 		sys_yield();
 	if (c < 0)
 		return c;
@@ -93,6 +100,14 @@ devcons_read(struct Fd *fd, void *vbuf, size_t n)
 	return 1;
 }
 
+static int
+devcons_poll(struct Fd *fd, int events)
+{
+	if (cons_peek == 0)
+		cons_peek = sys_cgetc();
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+}
+
 static ssize_t
 devcons_write(struct Fd *fd, const void *vbuf, size_t n)
 {
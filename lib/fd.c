@@ -3,7 +3,7 @@
 #define debug		0
 
 // Maximum number of file descriptors a program may hold open concurrently
-#define MAXFD		32
+#define MAXFD		512
 // Bottom of file descriptor area
 #define FDTABLE		0xD0000000
 // Bottom of file data area.  We reserve one data page for each FD,
@@ -269,6 +269,27 @@ seek(int fdnum, off_t offset)
 	return 0;
 }
 
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	switch (cmd) {
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+		return 0;
+	default:
+		return -E_INVAL;
+	}
+}
+
 int
 ftruncate(int fdnum, off_t newsize)
 {
@@ -303,6 +324,7 @@ fstat(int fdnum, struct Stat *stat)
 	stat->st_name[0] = 0;
 	stat->st_size = 0;
 	stat->st_isdir = 0;
+	stat->st_version = 0;
 	stat->st_dev = dev;
 	return (*dev->dev_stat)(fd, stat);
 }
@@ -5,6 +5,7 @@
 #define debug 0
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
+static envid_t fsenv;
 
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
@@ -15,7 +16,6 @@ union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 static int
 fsipc(unsigned type, void *dstva)
 {
-	static envid_t fsenv;
 	if (fsenv == 0)
 		fsenv = ipc_find_env(ENV_TYPE_FS);
 
@@ -161,6 +161,7 @@ devfile_stat(struct Fd *fd, struct Stat *st)
 	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
 	st->st_size = fsipcbuf.statRet.ret_size;
 	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+	st->st_version = fsipcbuf.statRet.ret_version;
 	return 0;
 }
 
@@ -173,6 +174,33 @@ devfile_trunc(struct Fd *fd, off_t newsize)
 	return fsipc(FSREQ_SET_SIZE, NULL);
 }
 
+// Map the block cache pages of file 'fdnum' that hold byte 'offset'
+// and on, up to 'maxpages' of them, read-only at 'dstva'.  The pages
+// are the file server's own, so nothing is copied.
+//
+// Returns:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+		return -E_INVAL;
+	if (fsenv == 0)
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+	fsipcbuf.map.req_offset = offset;
+	fsipcbuf.map.req_npages = maxpages;
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+}
+
 // Delete a file
 int
 remove(const char *path)
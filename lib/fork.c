@@ -3,9 +3,13 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
+// Threads (see sfork) make their copy-on-write copies under these
+// locks, one per page number modulo NCOWLOCKS.  sfork puts them on a
+// PTE_SHARE page, which fork leaves writable, so taking one in pgfault
+// never faults.
+#define COWLOCKVA	0xE1000000
+#define NCOWLOCKS	(PGSIZE / sizeof(struct mutex))
+static struct mutex *const cow_locks = (struct mutex *) COWLOCKVA;
 
 //
 // Custom page fault handler - if faulting page is copy-on-write,
@@ -16,6 +20,8 @@ pgfault(struct UTrapframe *utf)
 {
 	void *addr = (void *) utf->utf_fault_va;
 	uint32_t err = utf->utf_err;
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+	struct mutex *m = NULL;
 	int r;
 
 	// Check that the faulting access was (1) a write, and (2) to a
@@ -25,7 +31,18 @@ pgfault(struct UTrapframe *utf)
 	//   (see <inc/memlayout.h>).
 
 	// LAB 4: Your code here.
-	if(!(err & FEC_WR) || !(vpt[(uintptr_t)addr >> PGSHIFT] & PTE_COW))
+	// Threads can fault on the same page at once.  The first to get
+	// the page's lock copies it; the others find it writable and
+	// return, since copying it again would drop the first one's writes.
+	if(sforked && (err & FEC_WR)) {
+		m = &cow_locks[pn % NCOWLOCKS];
+		mutex_lock(m);
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+			mutex_unlock(m);
+			return;
+		}
+	}
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
 		panic("pgfault: not write or not cow");
 
 	// Allocate a new page, map it at a temporary location (PFTEMP),
@@ -36,57 +53,55 @@ pgfault(struct UTrapframe *utf)
 	//   No need to explicitly delete the old page's mapping.
 
 	// LAB 4: Your code here.
+	// Threads (see sfork) fault at once, so each copies through a
+	// scratch page of its own.
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
 	int ret;
-	if((ret = sys_page_alloc(0, (void*)PFTEMP, PTE_U|PTE_W|PTE_P)) < 0)
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
 		panic("sys_page_alloc: %e", ret);
-	memmove((void*)PFTEMP, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
-	if((ret = sys_page_map(0, (void*)PFTEMP, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
 		panic("sys_page_map: %e", ret);
-	if((ret = sys_page_unmap(0, (void*)PFTEMP)) < 0)
+	if((ret = sys_page_unmap(0, tmp)) < 0)
 		panic("sys_page_unmap: %e", ret);
+	if(m)
+		mutex_unlock(m);
 
 //	panic("pgfault not implemented");
 }
 
 //
-// Map our virtual page pn (address pn*PGSIZE) into the target envid
-// at the same virtual address.  If the page is writable or copy-on-write,
+// Queue the mapping of our virtual page pn (address pn*PGSIZE) into the
+// target envid at the same virtual address on the batch 'pb'.  If the page is writable or copy-on-write,
 // the new mapping must be created copy-on-write, and then our mapping must be
 // marked copy-on-write as well.  (Exercise: Why do we need to mark ours
 // copy-on-write again if it was already copy-on-write at the beginning of
 // this function?)
 //
+// The batch keeps the child mapping ahead of our own copy-on-write
+// remapping, and both are executed by the kernel in one go.
+//
 // Returns: 0 on success, < 0 on error.
 // It is also OK to panic on error.
 //
 static int
-duppage(envid_t envid, unsigned pn)
+duppage(struct PageBatch *pb, envid_t envid, unsigned pn)
 {
-	int r;
-
 	// LAB 4: Your code here.
 	uintptr_t addr = pn * PGSIZE;
 	int perm = 0;
 	int ret;
 	perm = PTE_P | PTE_U;
-	if (vpt[pn] & PTE_SHARE) {
-		if ((ret = sys_page_map(0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
-			panic("sys_page_map: %e", ret);
-		return 0;
-	}
+	if (vpt[pn] & PTE_SHARE)
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
 	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
 		perm |= PTE_COW;
-		if((ret = sys_page_map(0, (void*)addr, envid, (void*)addr, perm)) < 0)
-			panic("sys_page_map: %e", ret);
-		if((ret = sys_page_map(0, (void*)addr, 0, (void*)addr, perm)) < 0)
-			panic("sys_page_map: %e", ret);
-		return 0;
-	} else {
-		if((ret = sys_page_map(0, (void*)addr, envid, (void*)addr, perm)) < 0)
-			panic("sys_page_map: %e", ret);
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+			return ret;
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
 	}
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
 //	panic("duppage not implemented");
-	return 0;
 }
 
 //
@@ -105,19 +120,33 @@ duppage(envid_t envid, unsigned pn)
 //   Neither user exception stack should ever be marked copy-on-write,
 //   so you must allocate a new page for the child's user exception stack.
 //
+// In a program with threads, fork marks the pages of all of them
+// copy-on-write, so it first makes sure they all take page faults with
+// pgfault.  The child has only the forking thread, and takes its faults
+// on the first thread's exception stack.
+//
+static void thread_fork_prepare(void);
+static void thread_fork_child(void);
+
 envid_t
 fork(void)
 {
 	// LAB 4: Your code here.
+	// Static: the batch is too big for our single stack page.
+	static struct PageBatch pb;
 	envid_t envid;
 	int pn, pd, i, ret;
 	uintptr_t addr;
 	set_pgfault_handler(pgfault);
+	if(sforked)
+		thread_fork_prepare();
 	envid = sys_exofork();
 	if(envid < 0) 
 		panic("sys_exofork: %e", envid);
 	if(envid == 0) {
 		thisenv = &envs[ENVX(sys_getenvid())];
+		if(sforked)
+			thread_fork_child();
 		return 0;
 	} 
 /*	
@@ -134,16 +163,33 @@ fork(void)
 			}
 		}
 	} */
+	pgbatch_init(&pb);
 	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
 		pd = PDX(addr);
-		if(vpd[pd] & PTE_P) {
-			pn = addr >> PGSHIFT;
-			if(vpt[pn] & PTE_P)
-				duppage(envid, pn);
+		if(!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+			continue;
+		}
+		// Hand whole page tables to the child, copy-on-write.  The
+		// one holding the stacks is duplicated page by page, since
+		// the child needs its own exception stack there anyway.
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+				panic("pgbatch_sharept: %e", ret);
+			addr += PTSIZE - PGSIZE;
+			continue;
 		}
+		// Threads' exception stacks (see sfork) are not copied.
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+			continue;
+		pn = addr >> PGSHIFT;
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+			panic("duppage: %e", ret);
 	}
-	if((ret = sys_page_alloc(envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
-		panic("sys_page_alloc: %e", ret);
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+	   || (ret = pgbatch_flush(&pb)) < 0)
+		panic("fork: page batch: %e", ret);
 	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
 		panic("sys_env_pgfault_upcall: %e", ret);
 	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
@@ -152,10 +198,146 @@ fork(void)
 //	panic("fork not implemented");
 }
 
-// Challenge!
-int
-sfork(void)
+// Threads: envs that share one address space, each running on its own
+// stacks in one of the slots below UTOP (see TSTACKSIZE).  A thread
+// ends when its function returns, and wait() waits for one to end.
+//
+// Threads share everything in memory, file descriptors included, so a
+// thread must not exit(), which would close them for all.  malloc
+// takes a lock once a program has threads, but the rest of the library
+// does not: fork and spawn use fixed scratch addresses, as do the file
+// and network calls, so only one thread at a time should use them.
+//
+// Any thread may fork.  fork marks the whole shared address space
+// copy-on-write, so every thread takes copy-on-write faults afterwards:
+// fork installs its handler on all of them, and each copies through its
+// own scratch page.  Threads that fault on the same page at once copy
+// it only once, under a lock for the page (see pgfault).  The
+// child of fork has only the thread that called it, which takes page
+// faults on slot 0's exception stack, so both slots' thisenv are its
+// own Env.  Threads are plain envs to the kernel, which schedules them
+// on all CPUs.
+
+#define TSTACKPAGES	4	// Normal stack pages per thread
+
+// Set before the first thread starts and never cleared.
+bool sforked;
+
+static struct mutex sfork_lock;
+static envid_t thread_ids[NTHREADS];	// Thread in each slot, if any
+
+static void
+thread_main(void (*fn)(void *), void *arg)
+{
+	fn(arg);
+	sys_env_destroy(0);
+}
+
+static bool
+thread_alive(envid_t id)
 {
-	panic("sfork not implemented");
-	return -E_INVAL;
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+}
+
+// Before fork marks our pages copy-on-write: give every thread the page
+// fault upcall, which those started before set_pgfault_handler lack.
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+	for (i = 0; i < NTHREADS; i++)
+		if (thread_alive(thread_ids[i])
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall: %e", r);
+	mutex_unlock(&sfork_lock);
+}
+
+// In the child of fork: we are the only thread, in whatever slot the
+// forking thread had, and we take page faults on slot 0's exception
+// stack (see fork).
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+	thread_ids[slot] = sys_getenvid();
+	thread_envs[0] = thread_envs[slot];
+	mutex_init(&sfork_lock);
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+}
+
+//
+// Start a thread that runs fn(arg), sharing our address space.
+// It has a stack and an exception stack of its own, and its own
+// thisenv; it also takes page faults with our handler.
+//
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+	static struct PageBatch pb;
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+		goto out;
+	}
+
+	// Fresh exception and normal stacks, laid out like slot 0's, and
+	// with the first thread, the copy-on-write locks.
+	top = UTOP - i * TSTACKSIZE;
+	pgbatch_init(&pb);
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+					   PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		goto out;
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+			       PTE_P|PTE_U|PTE_W)) < 0)
+		goto out;
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+				       PTE_P|PTE_U|PTE_W)) < 0)
+			goto out;
+	if ((r = pgbatch_flush(&pb)) < 0)
+		goto out;
+
+	// Call thread_main(fn, arg), with a return address of 0.
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+	sp[0] = 0;
+	sp[1] = (uint32_t) fn;
+	sp[2] = (uint32_t) arg;
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+		r = id;
+		goto out;
+	}
+	thread_ids[i] = id;
+	thread_envs[i] = &envs[ENVX(id)];
+	sforked = 1;
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+	return r;
 }
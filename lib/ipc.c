@@ -58,20 +58,74 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 {
 	// LAB 4: Your code here.
 	int ret;
-	uintptr_t addr;
-	if(pg == NULL)
-		addr = USTACKTOP;
-	else 
-		addr = (uintptr_t)pg;
 
-	while((ret = sys_ipc_try_send(to_env, val, (void*)addr, perm)) == -E_IPC_NOT_RECV) {
-		sys_yield();
-	}
-	if(ret < 0)
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
 		panic("sys_ipc_try_send: %e", ret);
 //	panic("ipc_send not implemented");
 }
 
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+		if (from_env_store)
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+		*from_env_store = thisenv->env_ipc_from;
+	if (perm_store)
+		*perm_store = thisenv->env_ipc_perm;
+	if (npages_store)
+		*npages_store = thisenv->env_ipc_npages;
+	return thisenv->env_ipc_value;
+}
+
+// Like ipc_send, but send the 'npages' consecutive pages at 'pg'.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, int npages, int perm)
+{
+	int ret;
+
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+		panic("sys_ipc_try_send_pages: %e", ret);
+}
+
+// Send as ipc_send_pages does, but return errors other than the
+// receiver not receiving yet: 0 on success, < 0 on error.
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+	while (1) {
+		n = *nrecv;
+		ret = sys_ipc_try_send_pages(to_env, val,
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+			sys_yield();
+	}
+}
+
 // Find the first environment of the given type.  We'll use this to
 // find special environments.
 // Returns 0 if no such environment exists.
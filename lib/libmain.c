@@ -5,7 +5,8 @@
 
 extern void umain(int argc, char **argv);
 
-const volatile struct Env *thisenv;
+// Each thread's Env, by stack slot; thisenv looks up the running one's.
+const volatile struct Env *thread_envs[NTHREADS];
 const char *binaryname = "<unknown>";
 
 void
@@ -1,31 +1,108 @@
-
 #include <inc/lib.h>
 
 /*
- * Simple malloc/free.
+ * malloc/free with size classes.
+ *
+ * The heap is one arena of pages, from mbegin up to mtop, cut into
+ * spans: runs of whole pages, each starting with a struct mspan.  The
+ * arena grows MGROW pages at a time, with one batch of system calls,
+ * and gives pages back when a large free span ends up at its top.
+ *
+ * Small requests (up to SMALL_MAX bytes) are rounded up to one of the
+ * size classes in mclass_size and come from slabs: one-page spans cut
+ * into objects of one class, with a list of the free ones.  Each class
+ * keeps a list of its slabs that have free objects; a slab that empties
+ * goes back to the span allocator, unless it is the class's only one.
+ *
+ * Larger requests get spans of their own.  Free spans sit on lists by
+ * size, and merge with free neighbours: mp_npages finds the next span,
+ * and mp_prevpages the one before.  A free span of MTRIM pages or more
+ * at the top of the arena is cut back to MGROW pages.
+ *
+ * Every block starts in the first page of its span, so rounding a
+ * pointer down to a page finds its span header.
  *
- * Uses the address space to do most of the hard work.
- * The address space from mbegin to mend is scanned
- * in order.  Pages are allocated, used to fill successive
- * malloc requests, and then left alone.  Free decrements
- * a ref count maintained in the page; the page is freed
- * when the ref count hits zero.
+ * Programs with user-level threads can give each thread a struct
+ * mcache and point mcache_cur at the running one: free then keeps a
+ * few small objects of each class there, and malloc hands them back
+ * to the same thread without touching the slabs.  Threads that only
+ * switch at calls they make need no lock around any of this.
  *
- * If we need to allocate a large amount (more than a page)
- * we can't put a ref count at the end of each page,
- * so we mark the pte entry with the bit PTE_CONTINUED.
+ * Threads made with sfork run at the same time, so once there are any,
+ * every call takes mlock.  They cannot use mcaches: mcache_cur is
+ * shared by all of them.
  */
-enum
-{
-	MAXMALLOC = 1024*1024	/* max size of one allocated chunk */
+
+#define MSPAN_MAGIC	0x4D53504E	// "MSPN"
+#define MGROW		16		// Pages the arena grows by at least
+#define MTRIM		32		// Free pages at the top worth returning
+#define MBINS		32		// Free span lists: 1..MBINS-1 pages, more
+#define SMALL_MAX	2032
+#define MCACHE_BYTES	2048		// Bytes an mcache keeps per class
+
+enum { MS_FREE, MS_LARGE, MS_SLAB };
+
+struct mspan {
+	uint32_t mp_magic;
+	uint16_t mp_npages;		// Pages in this span
+	uint16_t mp_prevpages;		// Pages in the span below, 0 if none
+	uint8_t mp_kind;		// MS_*
+	uint8_t mp_class;		// Slab: index into mclass_size
+	uint16_t mp_nfree;		// Slab: free objects
+	void *mp_free;			// Slab: free objects, linked through
+					// their first word
+	struct mspan *mp_next;		// Free span list, or class slab list
+	struct mspan *mp_prev;
+	size_t mp_size;			// Large: bytes asked for
+	uint32_t mp_pad;
 };
 
-#define PTE_CONTINUED 0x400
+#define MHDR	sizeof(struct mspan)
+
+// Object sizes, chosen so that each wastes little of a slab page.
+static const uint16_t mclass_size[] = {
+	16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384,
+	448, 512, 576, 672, 800, 1008, 1344, SMALL_MAX
+};
+#define NCLASS	(sizeof(mclass_size) / sizeof(mclass_size[0]))
 
 static uint8_t *mbegin = (uint8_t*) 0x08000000;
 static uint8_t *mend   = (uint8_t*) 0x10000000;
-static uint8_t *mptr;
+static uint8_t *mtop;			// End of the arena
+static struct mspan *mlast;		// Highest span in the arena
+static struct mspan *mbins[MBINS];	// Free spans, by size
+static struct mspan *mslabs[NCLASS];	// Slabs with free objects
+static uint8_t mclass_of[SMALL_MAX / 16 + 1];	// Class for (n + 15) / 16
+static uint8_t mcache_max[NCLASS];	// Objects an mcache keeps per class
+static struct mstats mstat;
+static struct PageBatch mbatch;
+static struct mutex mlock;
+
+struct mcache *mcache_cur;
+
+static void
+list_push(struct mspan **head, struct mspan *mp)
+{
+	mp->mp_prev = NULL;
+	mp->mp_next = *head;
+	if (*head)
+		(*head)->mp_prev = mp;
+	*head = mp;
+}
 
+static void
+list_remove(struct mspan **head, struct mspan *mp)
+{
+	if (mp->mp_prev)
+		mp->mp_prev->mp_next = mp->mp_next;
+	else
+		*head = mp->mp_next;
+	if (mp->mp_next)
+		mp->mp_next->mp_prev = mp->mp_prev;
+}
+
+// Is nothing mapped at [v, v + n) yet?  Servers receive requests in
+// the top of the heap's address range.
 static int
 isfree(void *v, size_t n)
 {
@@ -38,103 +115,428 @@ isfree(void *v, size_t n)
 	return 1;
 }
 
-void*
-malloc(size_t n)
+static struct mspan **
+bin_of(int npages)
 {
-	int i, cont;
-	int nwrap;
-	uint32_t *ref;
-	void *v;
+	return &mbins[MIN(npages, MBINS - 1)];
+}
 
-	if (mptr == 0)
-		mptr = mbegin;
+static struct mspan *
+span_next(struct mspan *mp)
+{
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
 
-	n = ROUNDUP(n, 4);
+	return next < mtop ? (struct mspan *) next : NULL;
+}
 
-	if (n >= MAXMALLOC)
-		return 0;
+static struct mspan *
+span_prev(struct mspan *mp)
+{
+	if (mp->mp_prevpages == 0)
+		return NULL;
+	return (struct mspan *) ((uint8_t *) mp - mp->mp_prevpages * PGSIZE);
+}
 
-	if ((uintptr_t) mptr % PGSIZE){
-		/*
-		 * we're in the middle of a partially
-		 * allocated page - can we add this chunk?
-		 * the +4 below is for the ref count.
-		 */
-		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
-		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
-			(*ref)++;
-			v = mptr;
-			mptr += n;
-			return v;
-		}
-		/*
-		 * stop working on this page and move on.
-		 */
-		free(mptr);	/* drop reference to this page */
-		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+// Make 'mp' a span of 'npages', and tell the span above.
+static void
+span_set(struct mspan *mp, int npages, int kind)
+{
+	struct mspan *next;
+
+	mp->mp_magic = MSPAN_MAGIC;
+	mp->mp_npages = npages;
+	mp->mp_kind = kind;
+	if ((next = span_next(mp)))
+		next->mp_prevpages = npages;
+	else
+		mlast = mp;
+}
+
+// Merge span 'mp' with any free neighbours into one free span, which
+// is not on a free list yet.
+static struct mspan *
+span_merge(struct mspan *mp)
+{
+	struct mspan *other;
+
+	if ((other = span_next(mp)) && other->mp_kind == MS_FREE) {
+		list_remove(bin_of(other->mp_npages), other);
+		span_set(mp, mp->mp_npages + other->mp_npages, MS_FREE);
+	}
+	if ((other = span_prev(mp)) && other->mp_kind == MS_FREE) {
+		list_remove(bin_of(other->mp_npages), other);
+		span_set(other, other->mp_npages + mp->mp_npages, MS_FREE);
+		mp = other;
 	}
+	mp->mp_kind = MS_FREE;
+	return mp;
+}
+
+// Put 'mp' on the free lists, merged with any free neighbours, and
+// give the arena's top back to the kernel if enough of it is free.
+static void
+span_free(struct mspan *mp)
+{
+	int i;
 
-	/*
-	 * now we need to find some address space for this chunk.
-	 * if it's less than a page we leave it open for allocation.
-	 * runs of more than a page can't have ref counts so we
-	 * flag the PTE entries instead.
-	 */
-	nwrap = 0;
+	mp = span_merge(mp);
+	if (mp == mlast && mp->mp_npages >= MTRIM) {
+		pgbatch_init(&mbatch);
+		for (i = MGROW; i < mp->mp_npages; i++)
+			pgbatch_unmap(&mbatch, 0, (uint8_t *) mp + i * PGSIZE);
+		pgbatch_flush(&mbatch);
+		mstat.ms_arena -= (mp->mp_npages - MGROW) * PGSIZE;
+		mtop = (uint8_t *) mp + MGROW * PGSIZE;
+		mp->mp_npages = MGROW;
+	}
+	list_push(bin_of(mp->mp_npages), mp);
+}
+
+// Map at least 'npages' more pages at the top of the arena, as one
+// free span.  Returns 0, or < 0 if out of memory or address space.
+static int
+arena_grow(int npages)
+{
+	struct mspan *mp;
+	int i, r;
+
+	npages = ROUNDUP(MAX(npages, MGROW), MGROW);
+	if (npages > 0xFFFF || !isfree(mtop, npages * PGSIZE))
+		return -E_NO_MEM;
+	pgbatch_init(&mbatch);
+	for (i = 0; i < npages; i++)
+		if ((r = pgbatch_alloc(&mbatch, 0, mtop + i * PGSIZE,
+				       PTE_P|PTE_U|PTE_W)) < 0)
+			break;
+	if (i < npages || (r = pgbatch_flush(&mbatch)) < 0) {
+		pgbatch_init(&mbatch);
+		for (i = 0; i < npages; i++)
+			pgbatch_unmap(&mbatch, 0, mtop + i * PGSIZE);
+		pgbatch_flush(&mbatch);
+		return r < 0 ? r : -E_NO_MEM;
+	}
+
+	mp = (struct mspan *) mtop;
+	mp->mp_prevpages = mlast ? mlast->mp_npages : 0;
+	mtop += npages * PGSIZE;
+	mstat.ms_arena += npages * PGSIZE;
+	span_set(mp, npages, MS_FREE);
+	mp = span_merge(mp);
+	list_push(bin_of(mp->mp_npages), mp);
+	return 0;
+}
+
+// Take a span of 'npages' off the free lists, growing the arena if
+// need be, and split off what is left over.
+static struct mspan *
+span_alloc(int npages, int kind)
+{
+	struct mspan *mp, *rest, **bin;
+	int b;
+
+	if (npages > 0xFFFF)
+		return NULL;
 	while (1) {
-		if (isfree(mptr, n + 4))
+		mp = NULL;
+		for (b = MIN(npages, MBINS - 1); b < MBINS && !mp; b++)
+			for (mp = mbins[b]; mp; mp = mp->mp_next)
+				if (mp->mp_npages >= npages)
+					break;
+		if (mp)
 			break;
-		mptr += PGSIZE;
-		if (mptr == mend) {
-			mptr = mbegin;
-			if (++nwrap == 2)
-				return 0;	/* out of address space */
+		if (arena_grow(npages) < 0)
+			return NULL;
+	}
+
+	bin = bin_of(mp->mp_npages);
+	list_remove(bin, mp);
+	if (mp->mp_npages > npages) {
+		rest = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+		rest->mp_prevpages = npages;
+		span_set(rest, mp->mp_npages - npages, MS_FREE);
+		list_push(bin_of(rest->mp_npages), rest);
+	}
+	span_set(mp, npages, kind);
+	return mp;
+}
+
+static void
+malloc_init(void)
+{
+	int c, i;
+
+	static_assert(NCLASS == MCACHE_NCLASS);
+	mtop = mbegin;
+	for (c = 0, i = 0; i <= SMALL_MAX / 16; i++) {
+		while (mclass_size[c] < i * 16)
+			c++;
+		mclass_of[i] = c;
+	}
+	for (c = 0; c < NCLASS; c++)
+		mcache_max[c] = MIN(MCACHE_MAX,
+				    MAX(1, MCACHE_BYTES / mclass_size[c]));
+}
+
+static void *
+slab_alloc(int c)
+{
+	struct mspan *mp;
+	uint8_t *obj;
+	int i, size = mclass_size[c];
+
+	if (!(mp = mslabs[c])) {
+		if (!(mp = span_alloc(1, MS_SLAB)))
+			return NULL;
+		mp->mp_class = c;
+		mp->mp_free = NULL;
+		mp->mp_nfree = 0;
+		for (i = (PGSIZE - MHDR) / size - 1; i >= 0; i--) {
+			obj = (uint8_t *) mp + MHDR + i * size;
+			*(void **) obj = mp->mp_free;
+			mp->mp_free = obj;
+			mp->mp_nfree++;
+		}
+		list_push(&mslabs[c], mp);
+		mstat.ms_slabs++;
+	}
+	obj = mp->mp_free;
+	mp->mp_free = *(void **) obj;
+	if (--mp->mp_nfree == 0)
+		list_remove(&mslabs[c], mp);
+	mstat.ms_inuse += size;
+	return obj;
+}
+
+static void
+slab_free(struct mspan *mp, void *v)
+{
+	int c = mp->mp_class;
+
+	*(void **) v = mp->mp_free;
+	mp->mp_free = v;
+	mstat.ms_inuse -= mclass_size[c];
+	if (mp->mp_nfree++ == 0)
+		list_push(&mslabs[c], mp);
+	// Give an empty slab back, unless it is all this class has.
+	if (mp->mp_nfree == (PGSIZE - MHDR) / mclass_size[c]
+	    && (mp->mp_prev || mp->mp_next)) {
+		list_remove(&mslabs[c], mp);
+		mstat.ms_slabs--;
+		span_free(mp);
+	}
+}
+
+// The span that 'v', a pointer malloc returned, belongs to.
+static struct mspan *
+span_of(void *v)
+{
+	struct mspan *mp = ROUNDDOWN(v, PGSIZE);
+
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mtop);
+	assert(mp->mp_magic == MSPAN_MAGIC && mp->mp_kind != MS_FREE);
+	return mp;
+}
+
+static void *
+malloc_locked(size_t n)
+{
+	struct mspan *mp;
+	struct mcache *mc = mcache_cur;
+	void *v;
+	int c;
+
+	if (mtop == 0)
+		malloc_init();
+	mstat.ms_nmalloc++;
+	if (n <= SMALL_MAX) {
+		c = mclass_of[(n + 15) / 16];
+		if (mc && (v = mc->mc_free[c])) {
+			mc->mc_free[c] = *(void **) v;
+			mc->mc_n[c]--;
+			mstat.ms_cachehits++;
+			mstat.ms_cached -= mclass_size[c];
+			mstat.ms_inuse += mclass_size[c];
+			return v;
 		}
+		return slab_alloc(c);
 	}
+	if (n > (size_t) (mend - mbegin))
+		return 0;
+	if (!(mp = span_alloc(ROUNDUP(n + MHDR, PGSIZE) / PGSIZE, MS_LARGE)))
+		return 0;
+	mp->mp_size = n;
+	mstat.ms_inuse += n;
+	return (uint8_t *) mp + MHDR;
+}
 
-	/*
-	 * allocate at mptr - the +4 makes sure we allocate a ref count.
-	 */
-	for (i = 0; i < n + 4; i += PGSIZE){
-		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
-		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
-			for (; i >= 0; i -= PGSIZE)
-				sys_page_unmap(0, mptr + i);
-			return 0;	/* out of physical memory */
+static void
+free_locked(void *v)
+{
+	struct mspan *mp;
+	struct mcache *mc = mcache_cur;
+	int c;
+
+	if (v == 0)
+		return;
+	mp = span_of(v);
+	if (mp->mp_kind == MS_SLAB) {
+		c = mp->mp_class;
+		if (mc && mc->mc_n[c] < mcache_max[c]) {
+			*(void **) v = mc->mc_free[c];
+			mc->mc_free[c] = v;
+			mc->mc_n[c]++;
+			mstat.ms_cached += mclass_size[c];
+			mstat.ms_inuse -= mclass_size[c];
+			return;
 		}
+		slab_free(mp, v);
+		return;
 	}
+	mstat.ms_inuse -= mp->mp_size;
+	span_free(mp);
+}
+
+static void
+mlock_acquire(void)
+{
+	if (sforked)
+		mutex_lock(&mlock);
+}
+
+static void
+mlock_release(void)
+{
+	if (sforked)
+		mutex_unlock(&mlock);
+}
+
+void *
+malloc(size_t n)
+{
+	void *v;
 
-	ref = (uint32_t*) (mptr + i - 4);
-	*ref = 2;	/* reference for mptr, reference for returned block */
-	v = mptr;
-	mptr += n;
+	mlock_acquire();
+	v = malloc_locked(n);
+	mlock_release();
 	return v;
 }
 
 void
 free(void *v)
 {
-	uint8_t *c;
-	uint32_t *ref;
+	mlock_acquire();
+	free_locked(v);
+	mlock_release();
+}
 
-	if (v == 0)
-		return;
-	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+// Give the objects in 'mc' back to their slabs, as a thread that owns
+// it does before it goes away.
+void
+mcache_flush(struct mcache *mc)
+{
+	void *v;
+	int c;
+
+	mlock_acquire();
+	for (c = 0; c < NCLASS; c++)
+		while ((v = mc->mc_free[c])) {
+			mc->mc_free[c] = *(void **) v;
+			mc->mc_n[c]--;
+			mstat.ms_cached -= mclass_size[c];
+			mstat.ms_inuse += mclass_size[c];
+			slab_free(span_of(v), v);
+		}
+	mlock_release();
+}
 
-	c = ROUNDDOWN(v, PGSIZE);
+void *
+calloc(size_t nmemb, size_t size)
+{
+	void *v;
+
+	if (size && nmemb > (size_t) -1 / size)
+		return 0;
+	if ((v = malloc(nmemb * size)))
+		memset(v, 0, nmemb * size);
+	return v;
+}
+
+static void *
+realloc_locked(void *v, size_t n)
+{
+	struct mspan *mp, *next;
+	size_t have;
+	int npages;
+	void *nv;
 
-	while (vpt[PGNUM(c)] & PTE_CONTINUED) {
-		sys_page_unmap(0, c);
-		c += PGSIZE;
-		assert(mbegin <= c && c < mend);
+	if (v == 0)
+		return malloc_locked(n);
+	if (n == 0) {
+		free_locked(v);
+		return 0;
+	}
+	mp = span_of(v);
+	if (mp->mp_kind == MS_SLAB) {
+		have = mclass_size[mp->mp_class];
+		if (n <= SMALL_MAX && mclass_of[(n + 15) / 16] == mp->mp_class)
+			return v;
+	} else {
+		// Grow or shrink a large block in place if its span, maybe
+		// with the free span above it, is the right size for it.
+		npages = ROUNDUP(n + MHDR, PGSIZE) / PGSIZE;
+		next = span_next(mp);
+		if (n > SMALL_MAX && npages > mp->mp_npages && next
+		    && next->mp_kind == MS_FREE
+		    && mp->mp_npages + next->mp_npages >= npages) {
+			list_remove(bin_of(next->mp_npages), next);
+			span_set(mp, mp->mp_npages + next->mp_npages, MS_LARGE);
+		}
+		if (n > SMALL_MAX && npages <= mp->mp_npages) {
+			if (npages < mp->mp_npages) {
+				next = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+				next->mp_prevpages = npages;
+				span_set(next, mp->mp_npages - npages, MS_FREE);
+				span_set(mp, npages, MS_LARGE);
+				span_free(next);
+			}
+			mstat.ms_inuse += n - mp->mp_size;
+			mp->mp_size = n;
+			return v;
+		}
+		have = mp->mp_size;
 	}
 
-	/*
-	 * c is just a piece of this page, so dec the ref count
-	 * and maybe free the page.
-	 */
-	ref = (uint32_t*) (c + PGSIZE - 4);
-	if (--(*ref) == 0)
-		sys_page_unmap(0, c);
+	if (!(nv = malloc_locked(n)))
+		return 0;
+	memmove(nv, v, MIN(have, n));
+	free_locked(v);
+	return nv;
+}
+
+void *
+realloc(void *v, size_t n)
+{
+	mlock_acquire();
+	v = realloc_locked(v, n);
+	mlock_release();
+	return v;
 }
 
+// Fill in 'st' with how the heap is used.
+void
+malloc_stats(struct mstats *st)
+{
+	struct mspan *mp;
+	int c;
+
+	mlock_acquire();
+	*st = mstat;
+	st->ms_slabfree = st->ms_spanfree = 0;
+	for (c = 0; c < NCLASS; c++)
+		for (mp = mslabs[c]; mp; mp = mp->mp_next)
+			st->ms_slabfree += mp->mp_nfree * mclass_size[c];
+	for (c = 0; c < MBINS; c++)
+		for (mp = mbins[c]; mp; mp = mp->mp_next)
+			st->ms_spanfree += mp->mp_npages * PGSIZE;
+	mlock_release();
+}
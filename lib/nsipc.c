@@ -8,6 +8,30 @@
 #define REQVA		0x0ffff000
 union Nsipc nsipcbuf __attribute__((aligned(PGSIZE)));
 
+// Staging area for sendmsg and recvmsg: a request page followed by
+// NSBULK_PAGES data pages, all sent to the server in one IPC.  Mapped
+// on first use, so that programs that never call them pay nothing.
+#define NSBULKVA	0xE0000000
+#define nsbulkreq	((union Nsipc *) NSBULKVA)
+#define nsbulkdata	((char *) NSBULKVA + PGSIZE)
+#define NSBULK_SIZE	(NSBULK_PAGES * PGSIZE)
+
+static bool nsbulk_mapped;
+// Data pages that sendmsg left mapped from the caller's buffers, one
+// bit each, to be replaced by fresh pages before we write to them.
+static uint32_t nsbulk_lent;
+
+// Staging area for sendfile: a request page followed by room for the
+// file server's block pages, which are passed on as they arrive.
+#define SENDFILEVA	(NSBULKVA + (1 + NSBULK_PAGES) * PGSIZE)
+#define sendfilereq	((union Nsipc *) SENDFILEVA)
+#define sendfiledata	((char *) SENDFILEVA + PGSIZE)
+
+static bool sendfile_mapped;
+
+// The network server shard this env's sockets live in
+static envid_t nsenv;
+
 // Send an IP request to the network server, and wait for a reply.
 // The request body should be in nsipcbuf, and parts of the response
 // may be written back to nsipcbuf.
@@ -16,7 +40,6 @@ union Nsipc nsipcbuf __attribute__((aligned(PGSIZE)));
 static int
 nsipc(unsigned type)
 {
-	static envid_t nsenv;
 	if (nsenv == 0)
 		nsenv = ipc_find_env(ENV_TYPE_NS);
 
@@ -29,12 +52,70 @@ nsipc(unsigned type)
 	return ipc_recv(NULL, NULL, NULL);
 }
 
+// Send the staging area's request page and the data pages holding its
+// first 'len' bytes of data to the network server with permission
+// 'perm', and wait for a reply.  If they are to be writable, the pages
+// are written first, so that none of them is still copy-on-write from
+// a fork when they are mapped writable for the server.
+static int
+nsipc_bulk(unsigned type, int len, int perm)
+{
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+
+	if (nsenv == 0)
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+
+	if (debug)
+		cprintf("[%08x] nsipc %d, %d pages\n", thisenv->env_id, type,
+			npages);
+
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+	return ipc_recv(NULL, NULL, NULL);
+}
+
+// Make data pages [first, first+npages) of the staging area our own
+// again where sendmsg left the caller's pages.
+static int
+nsbulk_own(int first, int npages)
+{
+	int i, r;
+
+	static_assert(NSBULK_PAGES <= 32);
+	for (i = first; i < first + npages; i++)
+		if (nsbulk_lent & (1 << i)) {
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+						PTE_P|PTE_W|PTE_U)) < 0)
+				return r;
+			nsbulk_lent &= ~(1 << i);
+		}
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+	int i, r;
+
+	if (nsbulk_mapped)
+		return 0;
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+	return 0;
+}
+
 int
-nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
 {
 	int r;
 
 	nsipcbuf.accept.req_s = s;
+	nsipcbuf.accept.req_flags = flags;
 	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
 		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
 		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
@@ -112,6 +193,178 @@ nsipc_send(int s, const void *buf, int size, unsigned int flags)
 	return nsipc(NSREQ_SEND);
 }
 
+// Send the 'iovcnt' buffers in 'iov' as one stream of data, up to
+// NSBULK_SIZE bytes per request.  A request's data starts at the offset
+// of its first byte in its page, so the pages of a buffer line up with
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+		return r;
+	i = 0;
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+		pgbatch_init(&pb);
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+				m = ROUNDDOWN(m, PGSIZE);
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+				}
+			} else {
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+					return sent ? sent : r;
+				memmove(nsbulkdata + n, src, m);
+			}
+			if ((off += m) == iov[i].iov_len)
+				i++, off = 0;
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			return sent ? sent : r;
+		nsbulkreq->sendmsg.req_s = s;
+		nsbulkreq->sendmsg.req_off = skip;
+		nsbulkreq->sendmsg.req_size = n - skip;
+		nsbulkreq->sendmsg.req_flags = flags;
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+
+// Send 'len' bytes of file 'fd' from 'offset' on, without reading
+// them: the file server maps its block pages here, up to NSBULK_PAGES
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+		skip = (offset + sent) % PGSIZE;
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+		sendfilereq->sendfile.req_s = s;
+		sendfilereq->sendfile.req_off = skip;
+		sendfilereq->sendfile.req_size = n;
+		sendfilereq->sendfile.req_flags = flags;
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+			return sent ? sent : r;
+		sent += r;
+		if (r < n)
+			break;
+	}
+	return sent;
+}
+
+// Receive into the 'iovcnt' buffers in 'iov' with a single request of
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+	nsbulkreq->recvmsg.req_len = len;
+	nsbulkreq->recvmsg.req_flags = flags;
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+		return r;
+	assert(r <= len);
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+		n += m;
+	}
+	return r;
+}
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+	nsipcbuf.select.req_readset = *readset;
+	nsipcbuf.select.req_writeset = *writeset;
+	nsipcbuf.select.req_exceptset = *exceptset;
+	nsipcbuf.select.req_timeout = msec;
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+		*readset = nsipcbuf.select.req_readset;
+		*writeset = nsipcbuf.select.req_writeset;
+		*exceptset = nsipcbuf.select.req_exceptset;
+	}
+	return r;
+}
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+	nsipcbuf.evctl.req_s = s;
+	nsipcbuf.evctl.req_events = events;
+	nsipcbuf.evctl.req_data = data;
+	return nsipc(NSREQ_EVCTL);
+}
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+	nsipcbuf.evwait.req_timeout = timeout;
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+		assert(r <= max);
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+	}
+	return r;
+}
+
 int
 nsipc_socket(int domain, int type, int protocol)
 {
@@ -120,3 +373,38 @@ nsipc_socket(int domain, int type, int protocol)
 	nsipcbuf.socket.req_protocol = protocol;
 	return nsipc(NSREQ_SOCKET);
 }
+
+int
+nsipc_offload(int flags)
+{
+	nsipcbuf.offload.req_flags = flags;
+	return nsipc(NSREQ_OFFLOAD);
+}
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+		*st = nsipcbuf.memstatsRet;
+	return r;
+}
+
+// Talk to network server shard 'shard' from now on.  Connections the
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+	nsipcbuf.shard.req_shard = shard;
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+		return r;
+	nsenv = r;
+	return 0;
+}
@@ -0,0 +1,119 @@
+// Client side of SYS_page_batch.
+// Page operations are queued in a struct PageBatch and handed to the
+// kernel in one system call when the batch fills up or is flushed.
+// Operations are executed in the order they were queued.
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+	pb->pb_n = 0;
+}
+
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+	int r;
+
+	if (pb->pb_n == 0)
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+	memset(*po, 0, sizeof(**po));
+	return 0;
+}
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+	po->po_dstenv = env;
+	po->po_dstva = pg;
+	po->po_perm = perm;
+	return 0;
+}
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+		return r;
+	po->po_op = PAGEOP_MAP;
+	po->po_srcenv = src_env;
+	po->po_srcva = src_pg;
+	po->po_dstenv = dst_env;
+	po->po_dstva = dst_pg;
+	po->po_perm = perm;
+	return 0;
+}
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+	po->po_dstenv = env;
+	po->po_dstva = pg;
+	return 0;
+}
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+	po->po_dstenv = env;
+	po->po_dstva = pg;
+	po->po_perm = perm;
+	return 0;
+}
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+	po->po_srcenv = src_env;
+	po->po_srcva = va;
+	po->po_dstenv = dst_env;
+	po->po_perm = cowbits;
+	return 0;
+}
@@ -1,4 +1,5 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 #define debug 0
 
@@ -6,6 +7,7 @@ static ssize_t devpipe_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devpipe_write(struct Fd *fd, const void *buf, size_t n);
 static int devpipe_stat(struct Fd *fd, struct Stat *stat);
 static int devpipe_close(struct Fd *fd);
+static int devpipe_poll(struct Fd *fd, int events);
 
 struct Dev devpipe =
 {
@@ -15,16 +17,51 @@ struct Dev devpipe =
 	.dev_write =	devpipe_write,
 	.dev_close =	devpipe_close,
 	.dev_stat =	devpipe_stat,
+	.dev_poll =	devpipe_poll,
 };
 
-#define PIPEBUFSIZ 32		// small to provoke races
+// The pipe is a ring buffer filling the rest of its page.  p_rpos and
+// p_wpos count bytes modulo 2 * PIPEBUFSIZ, so that a full ring can be
+// told from an empty one.  A reader with nothing to read sleeps on
+// p_wpos (sys_futex_wait) until the writer moves it, and a writer with
+// no room sleeps on p_rpos; each end wakes the other only when the
+// other has said it is waiting, in p_rwait or p_wwait.  Closing either
+// end unmaps the page, which wakes everyone sleeping on it.
+#define PIPEBUFSIZ	(PGSIZE - 4 * sizeof(uint32_t))
 
 struct Pipe {
-	off_t p_rpos;		// read position
-	off_t p_wpos;		// write position
+	volatile uint32_t p_rpos;	// read position
+	volatile uint32_t p_wpos;	// write position
+	volatile uint32_t p_rwait;	// a reader sleeps on p_wpos
+	volatile uint32_t p_wwait;	// a writer sleeps on p_rpos
 	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
 };
 
+// Bytes in the pipe.
+static size_t
+pipe_count(struct Pipe *p)
+{
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+}
+
+// Sleep until *pos is no longer 'val', or the page goes away under us.
+static void
+pipe_wait(volatile uint32_t *pos, uint32_t val, volatile uint32_t *waiting)
+{
+	// Tell the other end first: if it moves *pos after this, it
+	// wakes us; if before, the kernel sees *pos != val.
+	xchg(waiting, 1);
+	sys_futex_wait(pos, val, ~0);
+}
+
+// We just moved *pos: wake the other end if it is waiting for that.
+static void
+pipe_notify(volatile uint32_t *pos, volatile uint32_t *waiting)
+{
+	if (xchg(waiting, 0))
+		sys_futex_wake(pos, NENV);
+}
+
 int
 pipe(int pfd[2])
 {
@@ -105,7 +142,8 @@ static ssize_t
 devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 {
 	uint8_t *buf;
-	size_t i;
+	size_t i, k;
+	uint32_t wpos;
 	struct Pipe *p;
 
 	p = (struct Pipe*)fd2data(fd);
@@ -113,34 +151,36 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
 			thisenv->env_id, vpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
-	buf = vbuf;
-	for (i = 0; i < n; i++) {
-		while (p->p_rpos == p->p_wpos) {
-			// pipe is empty
-			// if we got any data, return it
-			if (i > 0)
-				return i;
-			// if all the writers are gone, note eof
-			if (_pipeisclosed(fd, p))
-				return 0;
-			// yield and see what happens
-			if (debug)
-				cprintf("devpipe_read yield\n");
-			sys_yield();
-		}
-		// there's a byte.  take it.
-		// wait to increment rpos until the byte is taken!
-		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
-		p->p_rpos++;
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+		// pipe is empty
+		// if all the writers are gone, note eof
+		if (_pipeisclosed(fd, p))
+			return 0;
+		// sleep until the writer moves p_wpos
+		if (debug)
+			cprintf("devpipe_read wait\n");
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
 	}
-	return i;
+
+	// take what is there, in at most two pieces if it wraps around,
+	// and only then move rpos, to let the writer reuse the space
+	buf = vbuf;
+	n = MIN(n, pipe_count(p));
+	i = p->p_rpos % PIPEBUFSIZ;
+	k = MIN(n, PIPEBUFSIZ - i);
+	memmove(buf, &p->p_buf[i], k);
+	memmove(buf + k, p->p_buf, n - k);
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+	pipe_notify(&p->p_rpos, &p->p_wwait);
+	return n;
 }
 
 static ssize_t
 devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 {
 	const uint8_t *buf;
-	size_t i;
+	size_t i, j, k, m;
+	uint32_t rpos;
 	struct Pipe *p;
 
 	p = (struct Pipe*) fd2data(fd);
@@ -149,34 +189,55 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 			thisenv->env_id, vpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
 	buf = vbuf;
-	for (i = 0; i < n; i++) {
-		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+	for (i = 0; i < n; i += m) {
+		while (pipe_count(p) == PIPEBUFSIZ) {
 			// pipe is full
 			// if all the readers are gone
 			// (it's only writers like us now),
 			// note eof
 			if (_pipeisclosed(fd, p))
 				return 0;
-			// yield and see what happens
+			// sleep until the reader moves p_rpos
 			if (debug)
-				cprintf("devpipe_write yield\n");
-			sys_yield();
+				cprintf("devpipe_write wait\n");
+			rpos = p->p_rpos;
+			if (pipe_count(p) == PIPEBUFSIZ)
+				pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
 		}
-		// there's room for a byte.  store it.
-		// wait to increment wpos until the byte is stored!
-		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
-		p->p_wpos++;
+		// fill what room there is, and only then move wpos
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+		j = p->p_wpos % PIPEBUFSIZ;
+		k = MIN(m, PIPEBUFSIZ - j);
+		memmove(&p->p_buf[j], buf + i, k);
+		memmove(p->p_buf, buf + i + k, m - k);
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+		pipe_notify(&p->p_wpos, &p->p_rwait);
 	}
 
 	return i;
 }
 
+static int
+devpipe_poll(struct Fd *fd, int events)
+{
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+	int revents = 0;
+
+	if ((events & POLLIN) && pipe_count(p) > 0)
+		revents |= POLLIN;
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+		revents |= POLLOUT;
+	if (_pipeisclosed(fd, p))
+		revents |= POLLHUP;
+	return revents;
+}
+
 static int
 devpipe_stat(struct Fd *fd, struct Stat *stat)
 {
 	struct Pipe *p = (struct Pipe*) fd2data(fd);
 	strcpy(stat->st_name, "<pipe>");
-	stat->st_size = p->p_wpos - p->p_rpos;
+	stat->st_size = pipe_count(p);
 	stat->st_isdir = 0;
 	stat->st_dev = &devpipe;
 	return 0;
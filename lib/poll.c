@@ -0,0 +1,151 @@
+// Wait for any of several file descriptors to become ready.
+//
+// Sockets are checked, and waited for, by the network server in a single
+// NSREQ_SELECT request, so a process waiting only on sockets sleeps until
+// lwIP reports an event.  Pipes and the console are checked here with
+// their dev_poll; while one of them is being waited for, the server is
+// asked to wait at most POLL_SLICE msec, or, with no sockets, we sleep
+// in the kernel for that long, and then look again.  Files are always
+// ready.
+
+#include <inc/lib.h>
+
+#define POLL_SLICE	10	// msec between looks at pipes and the console
+
+// Sleep in the kernel for 'msec' milliseconds, as a futex wait on a
+// word nobody wakes, which leaves the caller's alarm and IPCs alone.
+static void
+poll_sleep(int msec)
+{
+	static volatile uint32_t nap;
+
+	if (sys_futex_wait(&nap, 0, sys_time_msec() + msec) != -E_TIMEOUT)
+		sys_yield();
+}
+
+// Which of 'events' the socket 'sockid' is ready for, after select
+// returned 'rset', 'wset' and 'eset'.
+static int
+sock_revents(int sockid, int events, fd_set *rset, fd_set *wset, fd_set *eset)
+{
+	int revents = 0;
+
+	if ((events & POLLIN) && FD_ISSET(sockid, rset))
+		revents |= POLLIN;
+	if ((events & POLLOUT) && FD_ISSET(sockid, wset))
+		revents |= POLLOUT;
+	if (FD_ISSET(sockid, eset))
+		revents |= POLLERR;
+	return revents;
+}
+
+// Wait until one of the 'nfds' descriptors in 'fds' is ready for one of
+// its events, or for 'timeout' msec (forever if < 0).  Sets each
+// revents, and returns how many are nonzero, or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, int timeout)
+{
+	fd_set rset, wset, eset;
+	struct pollfd *p;
+	struct Fd *fd;
+	struct Dev *dev;
+	unsigned start = sys_time_msec();
+	int r, n, wait, maxsock, pending;
+
+	while (1) {
+		FD_ZERO(&rset);
+		FD_ZERO(&wset);
+		FD_ZERO(&eset);
+		n = pending = 0;
+		maxsock = -1;
+		for (p = fds; p < fds + nfds; p++) {
+			p->revents = 0;
+			if (p->fd < 0)
+				continue;
+			if (fd_lookup(p->fd, &fd) < 0
+			    || dev_lookup(fd->fd_dev_id, &dev) < 0)
+				p->revents = POLLNVAL;
+			else if (dev == &devsock) {
+				if (p->events & POLLIN)
+					FD_SET(fd->fd_sock.sockid, &rset);
+				if (p->events & POLLOUT)
+					FD_SET(fd->fd_sock.sockid, &wset);
+				FD_SET(fd->fd_sock.sockid, &eset);
+				maxsock = MAX(maxsock, fd->fd_sock.sockid);
+			} else if (dev->dev_poll) {
+				p->revents = dev->dev_poll(fd, p->events);
+				pending += !p->revents;
+			} else
+				p->revents = p->events & (POLLIN | POLLOUT);
+			if (p->revents)
+				n++;
+		}
+
+		if (n)
+			wait = 0;
+		else if (timeout < 0)
+			wait = -1;
+		else
+			wait = MAX(0, timeout - (int) (sys_time_msec() - start));
+		if (pending && (wait < 0 || wait > POLL_SLICE))
+			wait = POLL_SLICE;
+
+		if (maxsock >= 0) {
+			if ((r = nsipc_select(maxsock + 1, &rset, &wset, &eset,
+					      wait)) < 0)
+				return r;
+			for (p = fds; r > 0 && p < fds + nfds; p++)
+				if (p->fd >= 0 && fd_lookup(p->fd, &fd) == 0
+				    && fd->fd_dev_id == devsock.dev_id
+				    && (p->revents = sock_revents(fd->fd_sock.sockid,
+					p->events, &rset, &wset, &eset)))
+					n++;
+		} else if (wait != 0)
+			poll_sleep(wait < 0 ? POLL_SLICE : wait);
+
+		if (n || (timeout >= 0 && sys_time_msec() - start >= timeout))
+			return n;
+	}
+}
+
+// select() on top of poll().  Returns the number of bits left set in
+// the three sets.
+int
+select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+       struct timeval *timeout)
+{
+	static struct pollfd fds[FD_SETSIZE];
+	int i, r, n = 0;
+
+	if (nfds < 0 || nfds > FD_SETSIZE)
+		return -E_INVAL;
+	for (i = 0; i < nfds; i++) {
+		fds[i].fd = -1;
+		fds[i].events = 0;
+		if (readset && FD_ISSET(i, readset))
+			fds[i].events |= POLLIN;
+		if (writeset && FD_ISSET(i, writeset))
+			fds[i].events |= POLLOUT;
+		if (fds[i].events || (exceptset && FD_ISSET(i, exceptset)))
+			fds[i].fd = i;
+	}
+	if ((r = poll(fds, nfds, timeout ? timeout->tv_sec * 1000
+		      + timeout->tv_usec / 1000 : -1)) < 0)
+		return r;
+
+	for (i = 0; i < nfds; i++) {
+		if (readset && FD_ISSET(i, readset)
+		    && !(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+			FD_CLR(i, readset);
+		if (writeset && FD_ISSET(i, writeset)
+		    && !(fds[i].revents & (POLLOUT | POLLERR)))
+			FD_CLR(i, writeset);
+		if (exceptset && FD_ISSET(i, exceptset)
+		    && !(fds[i].revents & (POLLERR | POLLNVAL)))
+			FD_CLR(i, exceptset);
+		n += (readset && FD_ISSET(i, readset))
+			+ (writeset && FD_ISSET(i, writeset))
+			+ (exceptset && FD_ISSET(i, exceptset));
+	}
+	return n;
+}
@@ -29,6 +29,17 @@ fd2sockid(int fd)
 	return sfd->fd_sock.sockid;
 }
 
+// Flags that make a request on socket fd 's' behave as its mode says
+static unsigned int
+sock_flags(int s)
+{
+	struct Fd *sfd;
+
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+		return 0;
+	return MSG_DONTWAIT;
+}
+
 static int
 alloc_sockfd(int sockid)
 {
@@ -53,7 +64,7 @@ accept(int s, struct sockaddr *addr, socklen_t *addrlen)
 	int r;
 	if ((r = fd2sockid(s)) < 0)
 		return r;
-	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
 		return r;
 	return alloc_sockfd(r);
 }
@@ -103,16 +114,87 @@ listen(int s, int backlog)
 	return nsipc_listen(r, backlog);
 }
 
+// Reads and writes larger than this go through the multi-page
+// sendmsg/recvmsg requests instead of the single request page.
+#define SOCK_INLINE_MAX	1500
+
 static ssize_t
 devsock_read(struct Fd *fd, void *buf, size_t n)
 {
-	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+	struct iovec iov = { buf, n };
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+
+	if (n > SOCK_INLINE_MAX)
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
 }
 
 static ssize_t
 devsock_write(struct Fd *fd, const void *buf, size_t n)
 {
-	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+	struct iovec iov = { (void *) buf, n };
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+
+	if (n > SOCK_INLINE_MAX)
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+}
+
+ssize_t
+sendmsg(int s, const struct msghdr *msg, int flags)
+{
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+		return r;
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+			     flags | sock_flags(s));
+}
+
+ssize_t
+recvmsg(int s, struct msghdr *msg, int flags)
+{
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+		return r;
+	msg->msg_namelen = 0;
+	msg->msg_flags = 0;
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+			     flags | sock_flags(s));
+}
+
+// Send 'len' bytes of file 'fd', starting at 'offset', on socket 's'.
+// The data goes from the file server's block cache to the network
+// server by page mapping, never through this environment's memory.
+// The file's seek position is left alone.  Returns the number of bytes
+// sent, short at end of file or when a nonblocking socket is full.
+ssize_t
+sendfile(int s, int fd, off_t offset, size_t len)
+{
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+		return r;
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+}
+
+// Report POLLIN and POLLOUT edges of socket 's' to evwait; events 0
+// stops them.  Meant for nonblocking sockets: after an event, read,
+// accept or write until -E_AGAIN before waiting again.
+int
+evctl(int s, int events)
+{
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+		return r;
+	return nsipc_evctl(r, events, s);
+}
+
+// Wait up to 'timeout' msec (forever if < 0) for events on the sockets
+// given to evctl, and store up to 'maxevents' of them in 'evs', the
+// socket in fd and what happened in revents.  Returns how many.
+int
+evwait(struct pollfd *evs, int maxevents, int timeout)
+{
+	return nsipc_evwait(evs, maxevents, timeout);
 }
 
 static int
@@ -259,12 +259,15 @@ error:
 	return r;
 }
 
+// Number of file pages map_segment reads per page batch.
+#define SEG_CHUNK	16
+
 static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
 	int fd, size_t filesz, off_t fileoffset, int perm)
 {
-	int i, r;
-	void *blk;
+	static struct PageBatch pb;
+	int i, j, n, r;
 
 	//cprintf("map_segment %x+%x\n", va, memsz);
 
@@ -275,45 +278,92 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
 		fileoffset -= i;
 	}
 
-	for (i = 0; i < memsz; i += PGSIZE) {
-		if (i >= filesz) {
-			// allocate a blank page
-			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
-				return r;
-		} else {
-			// from file
-			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
-				return r;
-			if ((r = seek(fd, fileoffset + i)) < 0)
+	// Pages backed by the file are read into temporary pages at
+	// UTEMP, SEG_CHUNK at a time, which are then moved into the child
+	// with a single batch.
+	pgbatch_init(&pb);
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+		for (j = 0; j < n; j++)
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
 				return r;
-			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
-				return r;
-			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
-				panic("spawn: sys_page_map data: %e", r);
-			sys_page_unmap(0, UTEMP);
+		if ((r = pgbatch_flush(&pb)) < 0)
+			goto error;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+			goto error;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+			goto error;
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
 		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
 	}
-	return 0;
+
+	// allocate the blank pages
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+			return r;
+	return pgbatch_flush(&pb);
+
+error:
+	for (j = 0; j < n; j++)
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+	return r;
+}
+
+// Does the page table covering addr hold only PTE_SHARE pages?
+static bool
+pt_all_shared(uintptr_t addr)
+{
+	uint32_t pn, n = 0;
+
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+		if (vpt[pn] & PTE_P) {
+			if (!(vpt[pn] & PTE_SHARE))
+				return 0;
+			n++;
+		}
+	return n > 0;
 }
 
 // Copy the mappings for shared pages into the child address space.
+// Page tables holding nothing but shared pages are shared outright,
+// unless the child already has a page table in that range.
 static int
 copy_shared_pages(envid_t child)
 {
 	// LAB 7: Your code here.
+	static struct PageBatch pb;
 	uintptr_t addr;
 	uint32_t pn, pd;
 	int r;
+	pgbatch_init(&pb);
 	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
 		pd = PDX(addr);
-		if (vpd[pd] & PTE_P) {
-			pn = addr >> PGSHIFT;
-			if(vpt[pn] & PTE_SHARE) {
-				if ((r = sys_page_map(0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
-					panic("sys_page_map: %e", r);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+			if ((r = pgbatch_flush(&pb)) < 0)
+				panic("sys_page_batch: %e", r);
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+			if ((r = pgbatch_flush(&pb)) == 0) {
+				addr += PTSIZE - PGSIZE;
+				continue;
 			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+		if(vpt[pn] & PTE_SHARE) {
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+				panic("sys_page_batch: %e", r);
 		}
 	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+		panic("sys_page_batch: %e", r);
 	return 0;
 }
-
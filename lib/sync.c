@@ -0,0 +1,97 @@
+// Mutexes and condition variables on sys_futex_wait/sys_futex_wake.
+//
+// A mutex is one word: 0 when free, 1 when held, and 2 when held and
+// someone may be asleep waiting for it.  Taking a free mutex and
+// releasing one nobody waits for make no system calls.  A condition
+// variable is a counter of signals, which a waiter sleeps on until it
+// changes, and a count of waiters, so that signals nobody waits for
+// make no system calls either.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+	m->m_state = 0;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, ~0);
+		c = xchg(&m->m_state, 2);
+	}
+}
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+	if (xchg(&m->m_state, 0) == 2)
+		sys_futex_wake(&m->m_state, 1);
+}
+
+void
+cond_init(struct cond *c)
+{
+	c->c_seq = 0;
+	c->c_nwait = 0;
+}
+
+// Release 'm', wait for cond_signal or cond_broadcast on 'c' or until
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+	uint32_t seq = c->c_seq;
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+	return r == -E_TIMEOUT ? r : 0;
+}
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+	cond_timedwait(c, m, ~0);
+}
+
+void
+cond_signal(struct cond *c)
+{
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+		sys_futex_wake(&c->c_seq, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+		sys_futex_wake(&c->c_seq, NENV);
+}
@@ -117,6 +117,19 @@ sys_ipc_recv(void *dstva)
 	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
 }
 
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+
 unsigned int
 sys_time_msec(void)
 {
@@ -137,3 +150,77 @@ int sys_get_mac(uint32_t *low, uint32_t *high)
 {
 	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
 }
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+
+int
+sys_net_set_queue(int q)
+{
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+}
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
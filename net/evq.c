@@ -0,0 +1,212 @@
+/*
+ * Readiness queues: edge-triggered socket events for clients that
+ * drive many nonblocking sockets at once.
+ *
+ * A client registers each socket it cares about (NSREQ_EVCTL) with the
+ * events it wants and a value to hand back, usually its fd number.
+ * lwIP's event callback then appends the socket to its client's queue
+ * each time new data, a new connection or send room arrives, unless the
+ * socket is already queued.  NSREQ_EVWAIT takes everything queued in one
+ * request.  As the events are edges, a client must read, accept or
+ * write until it gets -E_AGAIN before it waits again.
+ */
+
+#include <inc/lib.h>
+
+#include <lwip/sockets.h>
+#include <lwip/sys.h>
+
+#include "ns.h"
+
+#define EVQ_MAX		8	// Clients with a queue at once
+
+struct evq {
+	envid_t eq_env;			// Owner, or 0 if free
+	int eq_head;
+	int eq_n;
+	uint16_t eq_ring[MEMP_NUM_NETCONN];	// Queued sockets, in order
+	sys_sem_t eq_sem;		// Signalled when something is queued
+	int eq_waiters;
+};
+
+struct evsock {
+	struct evq *es_q;		// Queue it reports to, or NULL
+	int es_data;			// Handed back with its events
+	uint8_t es_events;		// POLLIN and POLLOUT it wants
+	uint8_t es_pending;		// ... that happened since last drained
+};
+
+static struct evq evqs[EVQ_MAX];
+static struct evsock evsocks[MEMP_NUM_NETCONN];
+
+static void
+evq_post(int s, int events)
+{
+	struct evsock *es = &evsocks[s];
+	struct evq *q = es->es_q;
+
+	if (!q || !(events &= es->es_events))
+		return;
+	if (!es->es_pending) {
+		q->eq_ring[(q->eq_head + q->eq_n++) % MEMP_NUM_NETCONN] = s;
+		if (q->eq_waiters)
+			sys_sem_signal(q->eq_sem);
+	}
+	es->es_pending |= events;
+}
+
+static void
+evq_event(int s, int readable, int writable)
+{
+	if (s >= 0 && s < MEMP_NUM_NETCONN)
+		evq_post(s, (readable ? POLLIN : 0) | (writable ? POLLOUT : 0));
+}
+
+void
+evq_init(void)
+{
+	int i;
+
+	for (i = 0; i < EVQ_MAX; i++)
+		if ((evqs[i].eq_sem = sys_sem_new(0)) == SYS_SEM_NULL)
+			panic("evq_init: out of semaphores");
+	lwip_event_hook = evq_event;
+}
+
+// Which of POLLIN and POLLOUT socket 's' is ready for right now.
+int
+evq_ready(int s)
+{
+	fd_set rset, wset, eset;
+	struct timeval tv = { 0, 0 };
+	int events = 0;
+
+	if (s < 0 || s >= MEMP_NUM_NETCONN)
+		return 0;
+	FD_ZERO(&rset);
+	FD_ZERO(&wset);
+	FD_ZERO(&eset);
+	FD_SET(s, &rset);
+	FD_SET(s, &wset);
+	if (lwip_select(s + 1, &rset, &wset, &eset, &tv) > 0) {
+		if (FD_ISSET(s, &rset))
+			events |= POLLIN;
+		if (FD_ISSET(s, &wset))
+			events |= POLLOUT;
+	}
+	return events;
+}
+
+// Take socket 's' out of its queue, if it is queued.
+static void
+evq_unqueue(int s)
+{
+	struct evq *q = evsocks[s].es_q;
+	int i, j, n;
+
+	if (!q || !evsocks[s].es_pending)
+		return;
+	for (i = j = 0, n = q->eq_n; i < n; i++) {
+		uint16_t t = q->eq_ring[(q->eq_head + i) % MEMP_NUM_NETCONN];
+		if (t != s)
+			q->eq_ring[(q->eq_head + j++) % MEMP_NUM_NETCONN] = t;
+	}
+	q->eq_n = j;
+	evsocks[s].es_pending = 0;
+}
+
+// The queue of 'env', allocated if 'create', reclaiming the queues of
+// envs that have exited.
+static struct evq *
+evq_lookup(envid_t env, bool create)
+{
+	struct evq *q, *spare = NULL;
+	int s;
+
+	for (q = evqs; q < evqs + EVQ_MAX; q++) {
+		if (q->eq_env == env)
+			return q;
+		if (q->eq_env && !q->eq_waiters
+		    && envs[ENVX(q->eq_env)].env_id != q->eq_env) {
+			for (s = 0; s < MEMP_NUM_NETCONN; s++)
+				if (evsocks[s].es_q == q)
+					evsocks[s].es_q = NULL;
+			q->eq_env = 0;
+		}
+		if (!q->eq_env && !spare)
+			spare = q;
+	}
+	if (!create || !spare)
+		return NULL;
+	spare->eq_env = env;
+	spare->eq_head = spare->eq_n = 0;
+	return spare;
+}
+
+// Report the 'events' of socket 's' to the queue of 'env', tagged with
+// 'data'.  Events 0 stops reporting.  A socket that is already ready is
+// queued at once.
+int
+evq_register(envid_t env, int s, int events, int data)
+{
+	struct evq *q;
+
+	if (s < 0 || s >= MEMP_NUM_NETCONN)
+		return -E_INVAL;
+	evq_unqueue(s);
+	evsocks[s].es_q = NULL;
+	if (!(events &= POLLIN | POLLOUT))
+		return 0;
+	if (!(q = evq_lookup(env, 1)))
+		return -E_NO_MEM;
+	evsocks[s].es_q = q;
+	evsocks[s].es_data = data;
+	evsocks[s].es_events = events;
+	evq_post(s, evq_ready(s));
+	return 0;
+}
+
+// Socket 's' is being closed.
+void
+evq_forget(int s)
+{
+	if (s < 0 || s >= MEMP_NUM_NETCONN)
+		return;
+	evq_unqueue(s);
+	evsocks[s].es_q = NULL;
+}
+
+// Move up to 'max' queued events of 'env' to 'evs', as the registered
+// data in fd and the events in revents.  If none are queued, wait up
+// to 'timeout' msec for one (forever if < 0).  Returns how many.
+int
+evq_drain(envid_t env, struct pollfd *evs, int max, int timeout)
+{
+	struct evq *q;
+	struct evsock *es;
+	u32_t waited;
+	int n;
+
+	if (!(q = evq_lookup(env, 0)))
+		return -E_INVAL;
+	// The semaphore may have been signalled for events that an earlier
+	// drain took, so check the queue again after every wakeup.
+	while (q->eq_n == 0 && timeout != 0) {
+		q->eq_waiters++;
+		waited = sys_arch_sem_wait(q->eq_sem, timeout < 0 ? 0 : timeout);
+		q->eq_waiters--;
+		if (waited == SYS_ARCH_TIMEOUT
+		    || (timeout > 0 && (timeout -= MAX(waited, 1)) <= 0))
+			break;
+	}
+	for (n = 0; n < max && q->eq_n > 0; n++) {
+		es = &evsocks[q->eq_ring[q->eq_head]];
+		q->eq_head = (q->eq_head + 1) % MEMP_NUM_NETCONN;
+		q->eq_n--;
+		evs[n].fd = es->es_data;
+		evs[n].events = 0;
+		evs[n].revents = es->es_pending;
+		es->es_pending = 0;
+	}
+	return n;
+}
@@ -2,7 +2,19 @@
 #include <inc/lib.h>
 #include <kern/e1000.h>
 
-extern union Nsipc nsipcbuf;
+// Packets to take from the card per system call
+#define RXBATCH	8
+
+// Is the pool page at 'va' ours alone, so the card may write into it?
+static bool
+rx_page_free(void *va)
+{
+	pte_t pte;
+
+	if (!(vpd[PDX(va)] & PTE_P) || !((pte = vpt[PGNUM(va)]) & PTE_P))
+		return 0;
+	return pages[PGNUM(PTE_ADDR(pte))].pp_ref == 1;
+}
 
 void
 input(envid_t ns_envid)
@@ -15,18 +27,29 @@ input(envid_t ns_envid)
 	// Hint: When you IPC a page to the network server, it will be
 	// reading from it for a while, so don't immediately receive
 	// another packet in to the same physical page.
-	int ret;
+	//
+	// The card receives straight into pages we donate, so the pages
+	// that come back from sys_net_recv_pages already hold a
+	// struct jif_pkt and go to the server as they are.  We donate
+	// each pool page again once the server has unmapped it.
+	int i, j, n, ret;
 	int perm = PTE_P | PTE_W | PTE_U;
-	uint8_t buf[BUFFER_SIZE];
-	while(1) {
-		if ((ret = sys_page_alloc(0, &nsipcbuf, perm)) < 0)
-			panic("sys_pape_alloc: %e", ret);
-		
-		while ((ret = sys_net_receive(buf)) == -E_DESC_EMPTY) {
-			sys_yield();
+	void *va;
+
+	for (i = 0; ; i = (i + n) % RXPOOL_SIZE) {
+		n = MIN(RXBATCH, RXPOOL_SIZE - i);
+		for (j = i; j < i + n; j++) {
+			va = (void *) (RXPOOL + j * PGSIZE);
+			if (!rx_page_free(va)
+			    && (ret = sys_page_alloc(0, va, perm)) < 0)
+				panic("sys_page_alloc: %e", ret);
 		}
-		memmove(nsipcbuf.pkt.jp_data, buf, ret);
-		nsipcbuf.pkt.jp_len = ret;
-		ipc_send(ns_envid, NSREQ_INPUT, &nsipcbuf, perm);
+
+		// Blocks until the card raises a receive interrupt.
+		if ((n = sys_net_recv_pages((void *) (RXPOOL + i * PGSIZE), n)) < 0)
+			panic("sys_net_recv_pages: %e", n);
+		for (j = i; j < i + n; j++)
+			ipc_send(ns_envid, NSREQ_INPUT,
+				 (void *) (RXPOOL + j * PGSIZE), perm);
 	}
 }
@@ -114,6 +114,7 @@ struct lwip_setgetsockopt_data {
 
 /** The global array of available sockets */
 static struct lwip_socket sockets[NUM_SOCKETS];
+void (*lwip_event_hook)(int s, int readable, int writable);
 /** The global list of tasks waiting for select */
 static struct lwip_select_cb *select_cb_list;
 
@@ -627,6 +628,18 @@ lwip_send(int s, const void *data, int size, unsigned int flags)
 #endif /* (LWIP_UDP || LWIP_RAW) */
   }
 
+  if (((flags & MSG_DONTWAIT) || (sock->flags & O_NONBLOCK)) && sock->conn->pcb.tcp) {
+    /* JOS: send only what fits in the send buffer now, so that
+       netconn_write does not have to wait for acks */
+    u16_t room = tcp_sndbuf(sock->conn->pcb.tcp);
+    if (room == 0) {
+      sock_set_errno(sock, EWOULDBLOCK);
+      return -1;
+    }
+    if (size > room)
+      size = room;
+  }
+
   err = netconn_write(sock->conn, data, size, NETCONN_COPY | ((flags & MSG_MORE)?NETCONN_MORE:0));
 
   LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_send(%d) err=%d size=%d\n", s, err, size));
@@ -1049,6 +1062,9 @@ event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len)
   }
   sys_sem_signal(selectsem);
 
+  if (lwip_event_hook && (evt == NETCONN_EVT_RCVPLUS || evt == NETCONN_EVT_SENDPLUS))
+    lwip_event_hook(s, evt == NETCONN_EVT_RCVPLUS, evt == NETCONN_EVT_SENDPLUS);
+
   /* Now decide if anyone is waiting for this socket */
   /* NOTE: This code is written this way to protect the select link list
      but to avoid a deadlock situation by releasing socksem before
@@ -152,6 +152,12 @@
 #if (MEM_LIBC_MALLOC && MEM_USE_POOLS)
   #error "MEM_LIBC_MALLOC and MEM_USE_POOLS may not both be simultaneously enabled in your lwipopts.h"
 #endif
+#if (MEMP_MEM_MALLOC && MEMP_OVERFLOW_CHECK)
+  #error "MEMP_OVERFLOW_CHECK is not available with MEMP_MEM_MALLOC in your lwipopts.h"
+#endif
+#if (MEMP_MEM_MALLOC && MEM_USE_POOLS)
+  #error "MEMP_MEM_MALLOC and MEM_USE_POOLS may not both be simultaneously enabled in your lwipopts.h"
+#endif
 #if (MEM_USE_POOLS && !MEMP_USE_CUSTOM_POOLS)
   #error "MEM_USE_POOLS requires custom pools (MEMP_USE_CUSTOM_POOLS) to be enabled in your lwipopts.h"
 #endif
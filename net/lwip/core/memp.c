@@ -41,6 +41,7 @@
 #include "lwip/opt.h"
 
 #include "lwip/memp.h"
+#include "lwip/mem.h"
 #include "lwip/pbuf.h"
 #include "lwip/udp.h"
 #include "lwip/raw.h"
@@ -132,11 +133,16 @@ static const char *memp_desc[MEMP_MAX] = {
 };
 #endif /* LWIP_DEBUG */
 
+#if MEMP_MEM_MALLOC
+/** This array holds the number of elements of each pool in use. */
+static u16_t memp_used[MEMP_MAX];
+#else /* MEMP_MEM_MALLOC */
 /** This is the actual memory used by the pools. */
 static u8_t memp_memory[MEM_ALIGNMENT - 1 
 #define LWIP_MEMPOOL(name,num,size,desc) + ( (num) * (MEMP_SIZE + MEMP_ALIGN_SIZE(size) ) )
 #include "lwip/memp_std.h"
 ];
+#endif /* MEMP_MEM_MALLOC */
 
 #if MEMP_SANITY_CHECK
 /**
@@ -249,6 +255,19 @@ memp_overflow_init(void)
 void
 memp_init(void)
 {
+#if MEMP_MEM_MALLOC
+  u16_t i;
+
+  for (i = 0; i < MEMP_MAX; ++i) {
+    MEMP_STATS_AVAIL(used, i, 0);
+    MEMP_STATS_AVAIL(max, i, 0);
+    MEMP_STATS_AVAIL(err, i, 0);
+    MEMP_STATS_AVAIL(avail, i, memp_num[i]);
+    /* elements come from mem_malloc as they are needed */
+    memp_tab[i] = NULL;
+    memp_used[i] = 0;
+  }
+#else /* MEMP_MEM_MALLOC */
   struct memp *memp;
   u16_t i, j;
 
@@ -275,6 +294,7 @@ memp_init(void)
   /* check everything a first time to see if it worked */
   memp_overflow_check_all();
 #endif /* MEMP_OVERFLOW_CHECK */
+#endif /* MEMP_MEM_MALLOC */
 }
 
 /**
@@ -305,10 +325,17 @@ memp_malloc_fn(memp_t type, const char* file, const int line)
   memp_overflow_check_all();
 #endif /* MEMP_OVERFLOW_CHECK >= 2 */
 
+#if MEMP_MEM_MALLOC
+  memp = NULL;
+  if (memp_used[type] < memp_num[type] &&
+      (memp = mem_malloc(MEMP_SIZE + memp_sizes[type])) != NULL) {
+    memp_used[type]++;
+#else /* MEMP_MEM_MALLOC */
   memp = memp_tab[type];
   
   if (memp != NULL) {    
     memp_tab[type] = memp->next;    
+#endif /* MEMP_MEM_MALLOC */
 #if MEMP_OVERFLOW_CHECK
     memp->next = NULL;
     memp->file = file;
@@ -359,8 +386,13 @@ memp_free(memp_t type, void *mem)
 
   MEMP_STATS_DEC(used, type); 
   
+#if MEMP_MEM_MALLOC
+  memp_used[type]--;
+  mem_free(memp);
+#else /* MEMP_MEM_MALLOC */
   memp->next = memp_tab[type]; 
   memp_tab[type] = memp;
+#endif /* MEMP_MEM_MALLOC */
 
 #if MEMP_SANITY_CHECK
   LWIP_ASSERT("memp sanity", memp_sanity());
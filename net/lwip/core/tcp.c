@@ -444,10 +444,10 @@ tcp_new_port(void)
 #define TCP_LOCAL_PORT_RANGE_START 4096
 #define TCP_LOCAL_PORT_RANGE_END   0x7fff
 #endif
-  static u16_t port = TCP_LOCAL_PORT_RANGE_START;
+  static u16_t port;
   
  again:
-  if (++port > TCP_LOCAL_PORT_RANGE_END) {
+  if (port < TCP_LOCAL_PORT_RANGE_START || ++port > TCP_LOCAL_PORT_RANGE_END) {
     port = TCP_LOCAL_PORT_RANGE_START;
   }
   
@@ -40,7 +40,7 @@ extern "C" {
 
 #if MEM_LIBC_MALLOC
 
-#include <stddef.h> /* for size_t */
+/* size_t comes from inc/types.h, which lwipopts.h includes */
 
 typedef size_t mem_size_t;
 
@@ -98,6 +98,16 @@
 #define MEM_LIBC_MALLOC                 0
 #endif
 
+/**
+ * MEMP_MEM_MALLOC==1: Use mem_malloc/mem_free instead of the lwip pool allocator.
+ * Especially useful with MEM_LIBC_MALLOC but handle with care regarding execution
+ * speed and usage from interrupts!  MEMP_NUM_* then only limit how many
+ * elements of each pool may be allocated at once.
+ */
+#ifndef MEMP_MEM_MALLOC
+#define MEMP_MEM_MALLOC                 0
+#endif
+
 /**
  * MEM_ALIGNMENT: should be set to the alignment of the CPU
  *    4 byte alignment -> #define MEM_ALIGNMENT 4
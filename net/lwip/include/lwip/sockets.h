@@ -322,6 +322,11 @@ int lwip_select(int maxfdp1, fd_set *readset, fd_set *writeset, fd_set *exceptse
                 struct timeval *timeout);
 int lwip_ioctl(int s, long cmd, void *argp);
 
+/** JOS: if set, called whenever socket s gets new data or a connection
+ *  to accept (readable) or room to send (writable), for the network
+ *  server's readiness queues. */
+extern void (*lwip_event_hook)(int s, int readable, int writable);
+
 #if LWIP_COMPAT_SOCKETS
 #define accept(a,b,c)         lwip_accept(a,b,c)
 #define bind(a,b,c)           lwip_bind(a,b,c)
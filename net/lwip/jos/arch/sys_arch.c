@@ -10,8 +10,9 @@
 
 #define debug 0
 
-#define NSEM		256
-#define NMBOX		128
+// Every netconn holds a receive mailbox (two semaphores) and a semaphore
+#define NSEM		2048
+#define NMBOX		640
 #define MBOXSLOTS	32
 
 struct sys_sem_entry {
@@ -49,6 +50,9 @@ struct sys_thread {
 enum { thread_hash_size = 257 };
 static LIST_HEAD(thread_list, sys_thread) threads[thread_hash_size];
 
+// First of the local ports this stack hands out (see lwipopts.h)
+uint16_t lwip_port_base = 4096;
+
 void
 sys_init(void)
 {
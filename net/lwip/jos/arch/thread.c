@@ -7,62 +7,200 @@
 static thread_id_t max_tid;
 static struct thread_context *cur_tc;
 
-static struct thread_queue thread_queue;
+static struct thread_queue thread_queue;	// Threads ready to run
 static struct thread_queue kill_queue;
 
+// Threads blocked in thread_wait.  They are not on thread_queue, so
+// only thread_wakeup or their deadline passing makes them run again.
+static LIST_HEAD(wait_list, thread_context) wait_list;
+
+// The waiting threads that have a deadline, in a binary heap ordered
+// by it.  There is room for every thread.
+static struct thread_context **timer_heap;
+static int timer_n, timer_max;
+static int nthreads;
+static volatile uint32_t thread_sleep;	// Futex word for thread_switch
+
 void
 thread_init(void) {
     threadq_init(&thread_queue);
+    LIST_INIT(&wait_list);
     max_tid = 0;
 }
 
+// Make 'tc' the running thread, along with its malloc cache.  Threads
+// only switch inside thread calls, never in the middle of malloc, so
+// they can share the heap without locks.
+static void
+thread_set_cur(struct thread_context *tc) {
+    cur_tc = tc;
+    mcache_cur = tc ? &tc->tc_mcache : NULL;
+}
+
 uint32_t
 thread_id(void) {
     return cur_tc->tc_tid;
 }
 
+static void
+heap_set(int i, struct thread_context *tc) {
+    timer_heap[i] = tc;
+    tc->tc_heap_idx = i;
+}
+
+static void
+heap_up(int i) {
+    struct thread_context *tc = timer_heap[i];
+
+    while (i > 0 && timer_heap[(i - 1) / 2]->tc_deadline > tc->tc_deadline) {
+	heap_set(i, timer_heap[(i - 1) / 2]);
+	i = (i - 1) / 2;
+    }
+    heap_set(i, tc);
+}
+
+static void
+heap_down(int i) {
+    struct thread_context *tc = timer_heap[i];
+    int c;
+
+    while ((c = 2 * i + 1) < timer_n) {
+	if (c + 1 < timer_n
+	    && timer_heap[c + 1]->tc_deadline < timer_heap[c]->tc_deadline)
+	    c++;
+	if (timer_heap[c]->tc_deadline >= tc->tc_deadline)
+	    break;
+	heap_set(i, timer_heap[c]);
+	i = c;
+    }
+    heap_set(i, tc);
+}
+
+static void
+heap_remove(struct thread_context *tc) {
+    struct thread_context *last;
+    int i = tc->tc_heap_idx;
+
+    tc->tc_heap_idx = -1;
+    if (--timer_n == i)
+	return;
+    last = timer_heap[timer_n];
+    heap_set(i, last);
+    heap_up(i);
+    heap_down(last->tc_heap_idx);
+}
+
+// Make room in the heap for 'n' threads.
+static int
+heap_reserve(int n) {
+    struct thread_context **h;
+
+    if (n <= timer_max)
+	return 0;
+    n = MAX(n, MAX(2 * timer_max, 16));
+    if (!(h = malloc(n * sizeof(*h))))
+	return -E_NO_MEM;
+    memmove(h, timer_heap, timer_n * sizeof(*h));
+    free(timer_heap);
+    timer_heap = h;
+    timer_max = n;
+    return 0;
+}
+
+// Move the waiting thread 'tc' to the ready queue.
+static void
+thread_ready(struct thread_context *tc) {
+    LIST_REMOVE(tc, tc_wait_link);
+    if (tc->tc_heap_idx >= 0)
+	heap_remove(tc);
+    tc->tc_wait_addr = 0;
+    threadq_push(&thread_queue, tc);
+}
+
 void
 thread_wakeup(volatile uint32_t *addr) {
-    struct thread_context *tc = thread_queue.tq_first;
-    while (tc) {
+    struct thread_context *tc, *next;
+
+    for (tc = LIST_FIRST(&wait_list); tc; tc = next) {
+	next = LIST_NEXT(tc, tc_wait_link);
 	if (tc->tc_wait_addr == addr)
-	    tc->tc_wakeup = 1;
-	tc = tc->tc_queue_link;
+	    thread_ready(tc);
     }
 }
 
+// Make the threads whose deadline has passed ready to run.
 void
-thread_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec) {
-    uint32_t s = sys_time_msec();
-    uint32_t p = s;
+thread_timers_run(void) {
+    uint32_t now;
 
-    cur_tc->tc_wait_addr = addr;
-    cur_tc->tc_wakeup = 0;
+    if (timer_n == 0)
+	return;
+    now = sys_time_msec();
+    while (timer_n > 0 && timer_heap[0]->tc_deadline <= now)
+	thread_ready(timer_heap[0]);
+}
 
-    while (p < msec) {
-	if (p < s)
-	    break;
-	if (addr && *addr != val)
-	    break;
-	if (cur_tc->tc_wakeup)
-	    break;
+// The earliest deadline of a waiting thread, or ~0 if none has one.
+uint32_t
+thread_next_deadline(void) {
+    return timer_n ? timer_heap[0]->tc_deadline : ~0;
+}
 
-	thread_yield();
-	p = sys_time_msec();
+// Run the next ready thread.  The current thread, if any, must already
+// be queued wherever it is to be found again.  While no thread is
+// ready, wait for the earliest deadline.  Returns when the current
+// thread runs again, or right away if it is halting and there is no
+// thread left to run.
+static void
+thread_switch(void) {
+    struct thread_context *next;
+
+    while (!(next = threadq_pop(&thread_queue))) {
+	if (timer_n == 0) {
+	    if (!cur_tc)
+		return;
+	    panic("thread_switch: every thread waits without a deadline");
+	}
+	// Only a deadline can make a thread ready now, so sleep until
+	// the first one: nothing wakes thread_sleep.
+	sys_futex_wait(&thread_sleep, 0, thread_next_deadline());
+	thread_timers_run();
     }
+    if (next == cur_tc)
+	return;
+    if (cur_tc && jos_setjmp(&cur_tc->tc_jb) != 0)
+	return;
+    thread_set_cur(next);
+    jos_longjmp(&cur_tc->tc_jb, 1);
+}
 
-    cur_tc->tc_wait_addr = 0;
-    cur_tc->tc_wakeup = 0;
+// Block until thread_wakeup(addr) or time 'msec', whichever is first;
+// msec ~0 means no deadline.  Returns at once if *addr != val.
+void
+thread_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec) {
+    if (addr && *addr != val)
+	return;
+    if (msec != (uint32_t) ~0 && msec <= sys_time_msec())
+	return;
+
+    cur_tc->tc_wait_addr = addr;
+    cur_tc->tc_deadline = msec;
+    LIST_INSERT_HEAD(&wait_list, cur_tc, tc_wait_link);
+    if (msec != (uint32_t) ~0) {
+	heap_set(timer_n++, cur_tc);
+	heap_up(cur_tc->tc_heap_idx);
+    }
+    thread_switch();
 }
 
+// Number of threads ready to run, besides the current one
 int
 thread_wakeups_pending(void)
 {
     struct thread_context *tc = thread_queue.tq_first;
     int n = 0;
     while (tc) {
-	if (tc->tc_wakeup)
-	    ++n;
+	++n;
 	tc = tc->tc_queue_link;
     }
     return n;
@@ -106,15 +244,18 @@ thread_create(thread_id_t *tid, const char *name,
 	return -E_NO_MEM;
 
     memset(tc, 0, sizeof(struct thread_context));
+    tc->tc_heap_idx = -1;
     
     thread_set_name(tc, name);
     tc->tc_tid = alloc_tid();
 
     tc->tc_stack_bottom = malloc(stack_size);
-    if (!tc->tc_stack_bottom) {
+    if (!tc->tc_stack_bottom || heap_reserve(nthreads + 1) < 0) {
+	free(tc->tc_stack_bottom);
 	free(tc);
 	return -E_NO_MEM;
     }
+    nthreads++;
 
     void *stacktop = tc->tc_stack_bottom + stack_size;
     // Terminate stack unwinding
@@ -141,8 +282,10 @@ thread_clean(struct thread_context *tc) {
     int i;
     for (i = 0; i < tc->tc_nonhalt; i++)
 	tc->tc_onhalt[i](tc->tc_tid);
+    mcache_flush(&tc->tc_mcache);
     free(tc->tc_stack_bottom);
     free(tc);
+    nthreads--;
 }
 
 void
@@ -152,10 +295,9 @@ thread_halt() {
     thread_clean(threadq_pop(&kill_queue));
 
     threadq_push(&kill_queue, cur_tc);
-    cur_tc = NULL;
-    thread_yield();
-    // WHAT IF THERE ARE NO MORE THREADS? HOW DO WE STOP?
-    // when yield has no thread to run, it will return here!
+    thread_set_cur(NULL);
+    thread_switch();
+    // thread_switch returns only when there is no thread left.
     exit();
 }
 
@@ -172,7 +314,7 @@ thread_yield(void) {
 	threadq_push(&thread_queue, cur_tc);
     }
 
-    cur_tc = next_tc;
+    thread_set_cur(next_tc);
     jos_longjmp(&cur_tc->tc_jb, 1);
 }
 
@@ -10,6 +10,8 @@ thread_id_t thread_id(void);
 void thread_wakeup(volatile uint32_t *addr);
 void thread_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec);
 int thread_wakeups_pending(void);
+void thread_timers_run(void);
+uint32_t thread_next_deadline(void);
 int thread_onhalt(void (*fun)(thread_id_t));
 int thread_create(thread_id_t *tid, const char *name, 
 		void (*entry)(uint32_t), uint32_t arg);
@@ -1,6 +1,8 @@
 #ifndef JOS_INC_THREADQ_H
 #define JOS_INC_THREADQ_H
 
+#include <inc/queue.h>
+#include <inc/malloc.h>
 #include <arch/thread.h>
 #include <arch/setjmp.h>
 
@@ -24,10 +26,13 @@ struct thread_context {
     uint32_t		tc_arg;
     struct jos_jmp_buf	tc_jb;
     volatile uint32_t	*tc_wait_addr;
-    volatile char	tc_wakeup;
+    uint32_t		tc_deadline;	// thread_wait's msec, or ~0
+    int			tc_heap_idx;	// Index in the timer heap, or -1
+    LIST_ENTRY(thread_context) tc_wait_link;	// In the list of waiters
     void		(*tc_onhalt[THREAD_NUM_ONHALT])(thread_id_t);
     int			tc_nonhalt;
     struct thread_context *tc_queue_link;
+    struct mcache	tc_mcache;	// Small objects this thread freed
 };
 
 static inline void 
@@ -34,6 +34,7 @@
 #include <inc/ns.h>
 
 #include <jif/jif.h>
+#include <kern/e1000.h>
 
 #include "lwip/opt.h"
 #include "lwip/def.h"
@@ -41,6 +42,10 @@
 #include "lwip/pbuf.h"
 #include "lwip/sys.h"
 #include <lwip/stats.h>
+#include "lwip/inet_chksum.h"
+#include "lwip/ip.h"
+#include "lwip/tcp.h"
+#include "lwip/udp.h"
 
 #include <netif/etharp.h>
 
@@ -82,15 +87,144 @@ low_level_init(struct netif *netif)
 }
 
 /*
- * low_level_output():
+ * Checksums and segmentation.
  *
- * Should do the actual transmission of the packet. The packet is
- * contained in the pbuf that is passed to the function. This pbuf
- * might be chained.
+ * lwIP is built without software checksums (see lwipopts.h).  On the
+ * way out, jif asks the card for the checksums jif_offload allows and
+ * computes the others itself; on the way in, it checks the ones the
+ * card has not verified.
+ */
+static int jif_offload = NETOFF_ALL;
+
+/* Where the headers of a frame are, if they are all in its first pbuf. */
+struct jif_frame {
+    struct ip_hdr *iph;		/* NULL if not an IPv4 packet */
+    struct tcp_hdr *tcph;	/* NULL if not a TCP segment */
+    u16_t *l4sum;		/* TCP or UDP checksum field, if any */
+    u8_t proto;
+    int want;			/* NETOFF_*CSUM the packet needs */
+    int l4off;			/* Offset of the TCP or UDP header */
+    int hdrlen;			/* Length of all headers */
+    int l4len;			/* Length of the IP payload */
+};
+
+static void
+jif_parse(struct pbuf *p, struct jif_frame *f)
+{
+    struct eth_hdr *ethhdr = p->payload;
+    struct ip_hdr *iph;
+    u16_t *sum = NULL;
+    int l4off, hdrlen;
+
+    memset(f, 0, sizeof(*f));
+    if (p->len < sizeof(struct eth_hdr) + IP_HLEN
+	|| htons(ethhdr->type) != ETHTYPE_IP)
+	return;
+    iph = (struct ip_hdr *)((u8_t *)p->payload + sizeof(struct eth_hdr));
+    hdrlen = l4off = sizeof(struct eth_hdr) + IPH_HL(iph) * 4;
+    if (IPH_HL(iph) * 4 < IP_HLEN || p->len < l4off)
+	return;
+    f->iph = iph;
+    f->want = NETOFF_IPCSUM;
+    f->proto = IPH_PROTO(iph);
+    f->l4off = f->hdrlen = l4off;
+    f->l4len = ntohs(IPH_LEN(iph)) - IPH_HL(iph) * 4;
+
+    /* The TCP or UDP checksum covers the whole datagram, so only
+     * unfragmented ones can have it filled in or checked here. */
+    if (ntohs(IPH_OFFSET(iph)) & (IP_MF | IP_OFFMASK))
+	return;
+    if (f->proto == IP_PROTO_TCP && p->len >= l4off + TCP_HLEN) {
+	struct tcp_hdr *tcph = (struct tcp_hdr *)((u8_t *)p->payload + l4off);
+	hdrlen = l4off + TCPH_HDRLEN(tcph) * 4;
+	if (p->len < hdrlen)
+	    return;
+	f->tcph = tcph;
+	sum = &tcph->chksum;
+	f->want |= NETOFF_TCPCSUM;
+    } else if (f->proto == IP_PROTO_UDP && p->len >= l4off + UDP_HLEN) {
+	struct udp_hdr *udph = (struct udp_hdr *)((u8_t *)p->payload + l4off);
+	hdrlen = l4off + UDP_HLEN;
+	sum = &udph->chksum;
+	f->want |= NETOFF_UDPCSUM;
+    } else
+	return;
+    f->l4sum = sum;
+    f->hdrlen = hdrlen;
+}
+
+/* Folded, uncomplemented sum of the TCP/UDP pseudo-header, which is
+ * what the card expects to find in the checksum field. */
+static u16_t
+pseudo_sum(struct ip_hdr *iph, u8_t proto, u16_t len)
+{
+    u32_t acc;
+
+    acc = (iph->src.addr & 0xffff) + (iph->src.addr >> 16) +
+	(iph->dest.addr & 0xffff) + (iph->dest.addr >> 16) +
+	htons(proto) + htons(len);
+    while (acc >> 16)
+	acc = (acc & 0xffffUL) + (acc >> 16);
+    return acc;
+}
+
+/* Sum of the pseudo-header and the first 'len' bytes from the TCP or
+ * UDP header of p on, complemented: the checksum to send, or 0 if the
+ * checksum field of a received packet is right. */
+static u16_t
+l4_chksum(struct pbuf *p, struct jif_frame *f, u16_t len)
+{
+    void *payload = p->payload;
+    u16_t plen = p->len, tot_len = p->tot_len, sum;
+
+    p->payload = (u8_t *)p->payload + f->l4off;
+    p->len -= f->l4off;
+    p->tot_len -= f->l4off;
+    sum = inet_chksum_pseudo_partial(p, &f->iph->src, &f->iph->dest,
+				     f->proto, len, len);
+    p->payload = payload;
+    p->len = plen;
+    p->tot_len = tot_len;
+    return sum;
+}
+
+/* Fill in the checksums 'which' of outgoing frame p in software. */
+static void
+csum_sw(struct pbuf *p, struct jif_frame *f, int which)
+{
+    if (which & NETOFF_IPCSUM) {
+	IPH_CHKSUM_SET(f->iph, 0);
+	IPH_CHKSUM_SET(f->iph,
+		       inet_chksum(f->iph, f->l4off - sizeof(struct eth_hdr)));
+    }
+    if (which & (NETOFF_TCPCSUM | NETOFF_UDPCSUM)) {
+	*f->l4sum = 0;
+	*f->l4sum = l4_chksum(p, f, f->l4len);
+	if (*f->l4sum == 0 && f->proto == IP_PROTO_UDP)
+	    *f->l4sum = 0xffff;
+    }
+}
+
+/* Prepare the checksum fields 'which' for the card to fill in. */
+static void
+csum_hw(struct jif_frame *f, int which, int tso)
+{
+    if (which & NETOFF_IPCSUM)
+	IPH_CHKSUM_SET(f->iph, 0);
+    if (which & (NETOFF_TCPCSUM | NETOFF_UDPCSUM))
+	*f->l4sum = pseudo_sum(f->iph, f->proto, tso ? 0 : f->l4len);
+}
+
+/*
+ * low_level_output_copy():
+ *
+ * Copies the pbuf chain into a page and sends it to the output
+ * environment.  Used for packets the driver cannot send in place.
+ * Checksums are all done in software on the copy.
  *
  */
 static err_t
-low_level_output(struct netif *netif, struct pbuf *p)
+low_level_output_copy(struct netif *netif, struct pbuf *p)
 {
     int r = sys_page_alloc(0, (void *)PKTMAP, PTE_U|PTE_W|PTE_P);
     if (r < 0)
@@ -114,6 +248,16 @@ low_level_output(struct netif *netif, struct pbuf *p)
 	txsize += q->len;
     }
 
+    struct pbuf flat;
+    struct jif_frame f;
+    memset(&flat, 0, sizeof(flat));
+    flat.payload = txbuf;
+    flat.tot_len = flat.len = txsize;
+    flat.type = PBUF_REF;
+    flat.ref = 1;
+    jif_parse(&flat, &f);
+    csum_sw(&flat, &f, f.want);
+
     pkt->jp_len = txsize;
 
     ipc_send(jif->envid, NSREQ_OUTPUT, (void *)pkt, PTE_P|PTE_W|PTE_U);
@@ -122,6 +266,271 @@ low_level_output(struct netif *netif, struct pbuf *p)
     return ERR_OK;
 }
 
+/* Packets the card is sending straight out of their pbufs, oldest
+ * first.  Each holds a reference on its pbuf chains until the driver
+ * reports it sent, so lwIP does not reuse the memory under the card.
+ * A TSO packet is made of several chains; txq_npbuf gives the number
+ * at the first one of each packet. */
+#define TXQ_SIZE 64
+static struct pbuf *txq[TXQ_SIZE];
+static u8_t txq_npbuf[TXQ_SIZE];
+static int txq_head, txq_len;
+
+static void
+txq_release(int n)
+{
+    int k;
+
+    while (n-- > 0 && txq_len > 0) {
+	for (k = txq_npbuf[txq_head]; k > 0; k--) {
+	    pbuf_free(txq[txq_head]);
+	    txq_head = (txq_head + 1) % TXQ_SIZE;
+	    txq_len--;
+	}
+    }
+}
+
+/* Append the pbuf chain p to 'frags', leaving out its first 'skip'
+ * bytes.  Returns -1 if there are not enough fragments. */
+static int
+frags_add(struct NetFrag *frags, int *nfrag, struct pbuf *p, int skip)
+{
+    int n = *nfrag;
+
+    for (; p != NULL; p = p->next) {
+	if (skip >= p->len) {
+	    skip -= p->len;
+	    continue;
+	}
+	if (n == NETFRAG_MAX)
+	    return -1;
+	frags[n].nf_va = (u8_t *)p->payload + skip;
+	frags[n].nf_len = p->len - skip;
+	n++;
+	skip = 0;
+    }
+    *nfrag = n;
+    return 0;
+}
+
+/* Have the card send the packet made of the 'n' pbuf chains in 'ps'
+ * in place.  On success, the transmit queue takes over the caller's
+ * references on them. */
+static int
+send_sg(struct pbuf **ps, int n, struct NetFrag *frags, int nfrag,
+	struct NetOffload *off)
+{
+    int i, r;
+
+    if (txq_len + n > TXQ_SIZE && (r = sys_net_transmit_sg(0, 0, 0)) > 0)
+	txq_release(r);
+    if (txq_len + n > TXQ_SIZE)
+	return -E_NO_MEM;
+    while ((r = sys_net_transmit_sg(frags, nfrag, off)) == -E_DESC_FULL)
+	sys_yield();
+    if (r < 0)
+	return r;
+
+    txq_release(r);
+    txq_npbuf[(txq_head + txq_len) % TXQ_SIZE] = n;
+    for (i = 0; i < n; i++)
+	txq[(txq_head + txq_len++) % TXQ_SIZE] = ps[i];
+    return 0;
+}
+
+/*
+ * low_level_send():
+ *
+ * Sends one frame.  Each pbuf of the chain becomes one fragment of a
+ * scatter-gather transmit, so the packet is never copied.
+ *
+ */
+static err_t
+low_level_send(struct netif *netif, struct pbuf *p, struct jif_frame *f)
+{
+    struct NetFrag frags[NETFRAG_MAX];
+    struct NetOffload off, *offp = NULL;
+    int n = 0, hw;
+
+    if (frags_add(frags, &n, p, 0) < 0)
+	return low_level_output_copy(netif, p);
+
+    hw = f->want & jif_offload & ~NETOFF_TSO;
+    csum_sw(p, f, f->want & ~hw);
+    if (hw) {
+	csum_hw(f, hw, 0);
+	memset(&off, 0, sizeof(off));
+	off.no_flags = hw;
+	off.no_l3off = sizeof(struct eth_hdr);
+	off.no_l4off = f->l4off;
+	offp = &off;
+    }
+
+    pbuf_ref(p);
+    if (send_sg(&p, 1, frags, n, offp) < 0) {
+	pbuf_free(p);
+	return low_level_output_copy(netif, p);
+    }
+    return ERR_OK;
+}
+
+/* Full-sized TCP segments lwIP sent back to back, held to go out as
+ * one TSO packet: the first one with its headers, then the payload of
+ * the others.  The card cuts it back into the same segments.  They go
+ * when a segment that does not follow on comes along, when there is
+ * no room for more, or at jif_flush(). */
+static struct {
+    struct pbuf *segs[NETFRAG_MAX];
+    int nseg;
+    struct jif_frame f;		/* Headers of the first segment */
+    struct NetFrag frags[NETFRAG_MAX];
+    int nfrag;
+    int len;			/* Length of the whole frame */
+    int mss;			/* Payload of the first segment */
+    int lastlen;		/* ... and of the last one */
+    u16_t lastflags;
+    u32_t nextseq;		/* Sequence number the next one needs */
+} tso;
+
+/* Add segment p to the held ones, if it can join them.  Returns 1 if
+ * it did. */
+static int
+tso_add(struct pbuf *p, struct jif_frame *f)
+{
+    struct tcp_hdr *h = f->tcph, *h0 = tso.f.tcph;
+    int paylen, nfrag = tso.nfrag;
+
+    if (!(jif_offload & NETOFF_TSO) || !h || TCPH_FLAGS(h) & ~(TCP_ACK | TCP_PSH))
+	return 0;
+    paylen = f->l4len - (f->hdrlen - f->l4off);
+    if (paylen <= 0 || f->l4off + f->l4len != p->tot_len)
+	return 0;
+
+    if (tso.nseg == 0) {
+	/* A pushed segment ends a burst: nothing would follow it. */
+	if (TCPH_FLAGS(h) & TCP_PSH)
+	    return 0;
+	nfrag = 0;
+	if (frags_add(tso.frags, &nfrag, p, 0) < 0)
+	    return 0;
+	tso.f = *f;
+	tso.len = p->tot_len;
+	tso.mss = paylen;
+    } else {
+	if (tso.nseg == NETFRAG_MAX || tso.lastlen != tso.mss
+	    || (tso.lastflags & TCP_PSH) || paylen > tso.mss
+	    || tso.len + paylen > NETTSO_MAX
+	    || f->hdrlen != tso.f.hdrlen
+	    || f->iph->src.addr != tso.f.iph->src.addr
+	    || f->iph->dest.addr != tso.f.iph->dest.addr
+	    || h->src != h0->src || h->dest != h0->dest
+	    || ntohl(h->seqno) != tso.nextseq
+	    || h->ackno != h0->ackno || h->wnd != h0->wnd)
+	    return 0;
+	if (frags_add(tso.frags, &nfrag, p, f->hdrlen) < 0)
+	    return 0;
+	tso.len += paylen;
+    }
+
+    pbuf_ref(p);
+    tso.segs[tso.nseg++] = p;
+    tso.nfrag = nfrag;
+    tso.lastlen = paylen;
+    tso.lastflags = TCPH_FLAGS(h);
+    tso.nextseq = ntohl(h->seqno) + paylen;
+    return 1;
+}
+
+/*
+ * jif_flush():
+ *
+ * Sends the segments held for TSO.  The network server calls this
+ * before it waits for requests, so nothing is held for long.
+ *
+ */
+void
+jif_flush(struct netif *netif)
+{
+    struct NetOffload off;
+    struct jif_frame f;
+    struct tcp_hdr *h = tso.f.tcph;
+    u16_t flags;
+    int i;
+
+    if (tso.nseg == 0)
+	return;
+    if (tso.nseg == 1) {
+	low_level_send(netif, tso.segs[0], &tso.f);
+	pbuf_free(tso.segs[0]);
+	tso.nseg = 0;
+	return;
+    }
+
+    /* The card copies the first header into every segment, and keeps
+     * PSH for the last one only. */
+    flags = TCPH_FLAGS(h);
+    TCPH_SET_FLAG(h, tso.lastflags & TCP_PSH);
+    csum_hw(&tso.f, NETOFF_IPCSUM | NETOFF_TCPCSUM, 1);
+    memset(&off, 0, sizeof(off));
+    off.no_flags = NETOFF_IPCSUM | NETOFF_TCPCSUM | NETOFF_TSO;
+    off.no_l3off = sizeof(struct eth_hdr);
+    off.no_l4off = tso.f.l4off;
+    off.no_hdrlen = tso.f.hdrlen;
+    off.no_mss = tso.mss;
+    if (send_sg(tso.segs, tso.nseg, tso.frags, tso.nfrag, &off) < 0) {
+	/* Send them one by one instead. */
+	TCPH_FLAGS_SET(h, flags);
+	for (i = 0; i < tso.nseg; i++) {
+	    jif_parse(tso.segs[i], &f);
+	    low_level_send(netif, tso.segs[i], &f);
+	    pbuf_free(tso.segs[i]);
+	}
+    }
+    tso.nseg = 0;
+}
+
+/*
+ * jif_set_offload():
+ *
+ * Sets which NETOFF_* offloads to ask of the card; the rest is done
+ * in software.  Returns the ones that were in use.
+ *
+ */
+int
+jif_set_offload(struct netif *netif, int flags)
+{
+    int old = jif_offload;
+
+    jif_flush(netif);
+    jif_offload = flags & NETOFF_ALL;
+    return old;
+}
+
+/*
+ * low_level_output():
+ *
+ * Should do the actual transmission of the packet. The packet is
+ * contained in the pbuf that is passed to the function. This pbuf
+ * might be chained.
+ *
+ * TCP segments that can go out as one TSO packet are held back until
+ * the run of them ends.
+ *
+ */
+static err_t
+low_level_output(struct netif *netif, struct pbuf *p)
+{
+    struct jif_frame f;
+
+    jif_parse(p, &f);
+    if (tso.nseg > 0 && tso_add(p, &f))
+	return ERR_OK;
+    jif_flush(netif);
+    if (tso_add(p, &f))
+	return ERR_OK;
+    return low_level_send(netif, p, &f);
+}
+
 /*
  * low_level_input():
  *
@@ -157,6 +566,31 @@ low_level_input(void *va)
 
     return p;
 }
+
+/*
+ * low_level_csum_ok():
+ *
+ * Checks the checksums of a received packet that the card did not
+ * vouch for in 'flags' (JP_CSUM_*).  Returns 0 if it is to be dropped.
+ *
+ */
+static int
+low_level_csum_ok(struct pbuf *p, int flags)
+{
+    struct jif_frame f;
+
+    jif_parse(p, &f);
+    if (f.iph == NULL)
+	return 1;
+    if (!(flags & JP_CSUM_IP)
+	&& inet_chksum(f.iph, f.l4off - sizeof(struct eth_hdr)) != 0)
+	return 0;
+    if (f.l4sum == NULL || (flags & JP_CSUM_L4))
+	return 1;
+    if (f.proto == IP_PROTO_UDP && *f.l4sum == 0)
+	return 1;	/* sent without a checksum */
+    return p->tot_len >= f.l4off + f.l4len && l4_chksum(p, &f, f.l4len) == 0;
+}
 /*
  * jif_output():
  *
@@ -198,6 +632,10 @@ jif_input(struct netif *netif, void *va)
 
     /* no packet could be read, silently ignore this */
     if (p == NULL) return;
+    if (!low_level_csum_ok(p, ((struct jif_pkt *)va)->jp_flags)) {
+	pbuf_free(p);
+	return;
+    }
     /* points to packet payload, which starts with an Ethernet header */
     ethhdr = p->payload;
 
@@ -22,18 +22,28 @@ void *memcpy(void *dst, const void *src, size_t n);
 
 #define MEM_ALIGNMENT		4
 
+// lwIP's heap and pools come from malloc (lib/malloc.c), which gives
+// each thread a cache of small objects, so the network server's memory
+// grows and shrinks with its connections instead of being reserved up
+// front.  The MEMP_NUM_* counts below only cap how many of each there
+// may be at once.  pbuf_realloc relies on mem_realloc shrinking a block
+// where it is, so it keeps the whole block.
+#define MEM_LIBC_MALLOC		1
+#define MEMP_MEM_MALLOC		1
+#define mem_realloc(mem, size)	(mem)
+void *malloc(size_t size);
+void *calloc(size_t nmemb, size_t size);
+void free(void *addr);
+
 #define MEMP_NUM_PBUF		64
 #define MEMP_NUM_UDP_PCB	8
-#define MEMP_NUM_TCP_PCB	32
+#define MEMP_NUM_TCP_PCB	512
 #define MEMP_NUM_TCP_PCB_LISTEN	16
 #define MEMP_NUM_TCP_SEG	TCP_SND_QUEUELEN// at least as big as TCP_SND_QUEUELEN
 #define MEMP_NUM_NETBUF		128
-#define MEMP_NUM_NETCONN	32
+#define MEMP_NUM_NETCONN	512	// Also FD_SETSIZE, which covers MAXFD
 #define MEMP_NUM_SYS_TIMEOUT    6
 
-#define PER_TCP_PCB_BUFFER	(16 * 4096)
-#define MEM_SIZE		(PER_TCP_PCB_BUFFER*MEMP_NUM_TCP_SEG + 4096*MEMP_NUM_TCP_SEG)
-
 #define PBUF_POOL_SIZE		512
 #define PBUF_POOL_BUFSIZE	2000
 
@@ -45,6 +55,23 @@ void *memcpy(void *dst, const void *src, size_t n);
 #define TCP_SND_QUEUELEN	(2 * TCP_SND_BUF/TCP_MSS)
 //#define TCP_SND_QUEUELEN	16
 
+// jif fills in and checks all checksums, on the E1000 when it can
+// (see jif_set_offload), so lwIP does not compute them itself.
+#define CHECKSUM_GEN_IP		0
+#define CHECKSUM_GEN_UDP	0
+#define CHECKSUM_GEN_TCP	0
+#define CHECKSUM_CHECK_IP	0
+#define CHECKSUM_CHECK_UDP	0
+#define CHECKSUM_CHECK_TCP	0
+
+// Each network server shard picks local ports from its own range
+// (see net/serv.c), so that no two shards open the same connection.
+extern uint16_t lwip_port_base;
+#define TCP_LOCAL_PORT_RANGE_START	lwip_port_base
+#define TCP_LOCAL_PORT_RANGE_END	(lwip_port_base + 0x0fff)
+#define UDP_LOCAL_PORT_RANGE_START	lwip_port_base
+#define UDP_LOCAL_PORT_RANGE_END	(lwip_port_base + 0x0fff)
+
 // Print error messages when we run out of memory
 #define LWIP_DEBUG	1
 //#define TCP_DEBUG	LWIP_DBG_ON
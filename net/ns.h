@@ -5,14 +5,22 @@
 #define MASK "255.255.255.0"
 #define DEFAULT "10.0.2.2"
 
-#define TIMER_INTERVAL 250
-
 // Virtual address at which to receive page mappings containing client requests.
+// Each slot is the request page followed by room for its data pages.
 #define QUEUE_SIZE	20
-#define REQVA		(0x0ffff000 - QUEUE_SIZE * PGSIZE)
+#define REQSLOT_PAGES	(1 + NSBULK_PAGES)
+#define REQVA		(0x0ffff000 - QUEUE_SIZE * REQSLOT_PAGES * PGSIZE)
+
+// Pages the input environment cycles through the NIC receive ring.
+#define RXPOOL_SIZE	32
+#define RXPOOL		(REQVA - RXPOOL_SIZE * PGSIZE)
 
-/* timer.c */
-void timer(envid_t ns_envid, uint32_t initial_to);
+/* evq.c */
+void evq_init(void);
+int evq_ready(int s);
+int evq_register(envid_t env, int s, int events, int data);
+void evq_forget(int s);
+int evq_drain(envid_t env, struct pollfd *evs, int max, int timeout);
 
 /* input.c */
 void input(envid_t ns_envid);
@@ -43,7 +43,20 @@ static struct timer_thread t_arp;
 static struct timer_thread t_tcpf;
 static struct timer_thread t_tcps;
 
-static envid_t timer_envid;
+// The network server runs one shard per network receive queue, so
+// that each CPU can process its share of the traffic.  A shard is a
+// complete lwIP stack with the same addresses, bound to its own queue
+// and with its own timer, input and output envs; the kernel steers the
+// packets of each connection to the queue of one shard.
+static int nshard;
+static int shard;			// This env's shard
+static envid_t shard_envid[NETQ_MAX];	// Known to shard 0 only
+
+// TCP port each socket listens on, if the kernel steers connections
+// to it to this shard
+static uint16_t listen_port[MEMP_NUM_NETCONN];
+
+static uint32_t alarm_at;		// When our alarm goes off, or 0
 static envid_t input_envid;
 static envid_t output_envid;
 
@@ -64,7 +77,7 @@ get_buffer(void) {
 		return 0;
 	}
 
-	va = (void *)(REQVA + i * PGSIZE);
+	va = (void *)(REQVA + i * REQSLOT_PAGES * PGSIZE);
 	buse[i] = 1;
 
 	return va;
@@ -72,7 +85,7 @@ get_buffer(void) {
 
 static void
 put_buffer(void *va) {
-	int i = ((uint32_t)va - REQVA) / PGSIZE;
+	int i = ((uint32_t)va - REQVA) / (REQSLOT_PAGES * PGSIZE);
 	buse[i] = 0;
 }
 
@@ -143,6 +156,7 @@ serve_init(uint32_t ipaddr, uint32_t netmask, uint32_t gw)
 	lwip_core_lock();
 
 	lwip_init(&nif, &output_envid, ipaddr, netmask, gw);
+	evq_init();
 
 	start_timer(&t_arp, &etharp_tmr, "arp timer", ARP_TMR_INTERVAL);
 	start_timer(&t_tcpf, &tcp_fasttmr, "tcp f timer", TCP_FAST_INTERVAL);
@@ -160,39 +174,118 @@ serve_init(uint32_t ipaddr, uint32_t netmask, uint32_t gw)
 	cprintf("NS: TCP/IP initialized.\n");
 }
 
+// Run the threads whose deadlines have passed and every other thread
+// that is ready, until all of them are waiting again.
 static void
-process_timer(envid_t envid) {
-	uint32_t start, now, to;
+run_threads(void)
+{
+	int i;
+
+	thread_timers_run();
+	// We limit the number of yields in case there's a rogue thread.
+	for (i = 0; thread_wakeups_pending() && i < 32; ++i)
+		thread_yield();
+}
+
+// Have the kernel's alarm wake us with an NSREQ_TIMER when the next
+// thread's deadline is due.
+static void
+set_alarm(void)
+{
+	uint32_t next = thread_next_deadline();
 
-	if (envid != timer_envid) {
-		cprintf("NS: received timer interrupt from envid %x not timer env\n", envid);
+	if (next == (uint32_t) ~0)
+		next = 0;
+	if (next == alarm_at)
 		return;
-	}
+	alarm_at = next;
+	sys_alarm(next, 0, NSREQ_TIMER);
+}
 
-	start = sys_time_msec();
-	thread_yield();
-	now = sys_time_msec();
+// Have the kernel send this shard its share of the new connections to
+// the port socket 's' listens on, or stop doing so when 's' is closed.
+static void
+listen_steer(int s, bool on)
+{
+	struct sockaddr_in sin;
+	socklen_t len = sizeof(sin);
 
-	to = TIMER_INTERVAL - (now - start);
-	ipc_send(envid, to, 0, 0);
+	if (s < 0 || s >= MEMP_NUM_NETCONN)
+		return;
+	if (!on) {
+		if (listen_port[s])
+			sys_net_listen(listen_port[s], 0);
+		listen_port[s] = 0;
+		return;
+	}
+	if (listen_port[s]
+	    || lwip_getsockname(s, (struct sockaddr *) &sin, &len) < 0
+	    || sys_net_listen(ntohs(sin.sin_port), 1) < 0)
+		return;
+	listen_port[s] = ntohs(sin.sin_port);
 }
 
 struct st_args {
 	int32_t reqno;
 	uint32_t whom;
 	union Nsipc *req;
+	int perm;
+	int npages;		// Pages mapped at req
 };
 
+// Receive up to 'len' bytes from 's' into 'buf'.  With MSG_BATCH, once
+// the first buffer is in, keep taking whatever else is already queued.
+// lwip_recv keeps its offsets in 16 bits, hence the 0xffff cap.
+static int
+serve_recvmsg(int s, char *buf, int len, unsigned int flags)
+{
+	unsigned int f = flags & ~MSG_BATCH;
+	int r, n = 0;
+
+	if (flags & MSG_PEEK)
+		flags &= ~MSG_BATCH;
+	do {
+		if ((r = lwip_recv(s, buf + n, MIN(len - n, 0xffff), f)) <= 0)
+			break;
+		n += r;
+		f |= MSG_DONTWAIT;
+	} while ((flags & MSG_BATCH) && n < len);
+	return n ? n : r;
+}
+
+// Pages mapped in this environment below UTOP.
+static int
+count_pages(void)
+{
+	uintptr_t va;
+	int n = 0;
+
+	for (va = 0; va < UTOP; va += PGSIZE) {
+		if (!(vpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+			continue;
+		}
+		if (vpt[PGNUM(va)] & PTE_P)
+			n++;
+	}
+	return n;
+}
+
 static void
 serve_thread(uint32_t a) {
 	struct st_args *args = (struct st_args *)a;
 	union Nsipc *req = args->req;
-	int r;
+	int r, i;
 
 	switch (args->reqno) {
 	case NSREQ_ACCEPT:
 	{
 		struct Nsret_accept ret;
+		if ((req->accept.req_flags & MSG_DONTWAIT)
+		    && !(evq_ready(req->accept.req_s) & POLLIN)) {
+			r = -E_AGAIN;
+			break;
+		}
 		r = lwip_accept(req->accept.req_s, &ret.ret_addr,
 				&ret.ret_addrlen);
 		memmove(req, &ret, sizeof ret);
@@ -206,6 +299,8 @@ serve_thread(uint32_t a) {
 		r = lwip_shutdown(req->shutdown.req_s, req->shutdown.req_how);
 		break;
 	case NSREQ_CLOSE:
+		listen_steer(req->close.req_s, 0);
+		evq_forget(req->close.req_s);
 		r = lwip_close(req->close.req_s);
 		break;
 	case NSREQ_CONNECT:
@@ -214,6 +309,8 @@ serve_thread(uint32_t a) {
 		break;
 	case NSREQ_LISTEN:
 		r = lwip_listen(req->listen.req_s, req->listen.req_backlog);
+		if (r == 0)
+			listen_steer(req->listen.req_s, 1);
 		break;
 	case NSREQ_RECV:
 		// Note that we read the request fields before we
@@ -225,10 +322,80 @@ serve_thread(uint32_t a) {
 		r = lwip_send(req->send.req_s, &req->send.req_buf,
 			      req->send.req_size, req->send.req_flags);
 		break;
+	case NSREQ_SENDMSG:
+		r = -E_INVAL;
+		if (req->sendmsg.req_off >= 0 && req->sendmsg.req_size >= 0
+		    && req->sendmsg.req_off + req->sendmsg.req_size
+		       <= (args->npages - 1) * PGSIZE)
+			r = lwip_send(req->sendmsg.req_s,
+				      (char *) req + PGSIZE + req->sendmsg.req_off,
+				      req->sendmsg.req_size,
+				      req->sendmsg.req_flags);
+		break;
+	case NSREQ_SENDFILE:
+		r = -E_INVAL;
+		if (req->sendfile.req_off >= 0 && req->sendfile.req_size >= 0
+		    && req->sendfile.req_off + req->sendfile.req_size
+		       <= (args->npages - 1) * PGSIZE)
+			r = lwip_send(req->sendfile.req_s,
+				      (char *) req + PGSIZE + req->sendfile.req_off,
+				      req->sendfile.req_size,
+				      req->sendfile.req_flags);
+		break;
+	case NSREQ_RECVMSG:
+		r = -E_INVAL;
+		if ((args->perm & PTE_W) && req->recvmsg.req_len >= 0
+		    && req->recvmsg.req_len <= (args->npages - 1) * PGSIZE)
+			r = serve_recvmsg(req->recvmsg.req_s,
+					  (char *) req + PGSIZE,
+					  req->recvmsg.req_len,
+					  req->recvmsg.req_flags);
+		break;
+	case NSREQ_SELECT:
+	{
+		struct timeval tv, *tvp = NULL;
+		if (req->select.req_timeout >= 0) {
+			tv.tv_sec = req->select.req_timeout / 1000;
+			tv.tv_usec = req->select.req_timeout % 1000 * 1000;
+			tvp = &tv;
+		}
+		r = lwip_select(req->select.req_nfds, &req->select.req_readset,
+				&req->select.req_writeset,
+				&req->select.req_exceptset, tvp);
+		break;
+	}
+	case NSREQ_EVCTL:
+		r = evq_register(args->whom, req->evctl.req_s,
+				 req->evctl.req_events, req->evctl.req_data);
+		break;
+	case NSREQ_EVWAIT:
+	{
+		int max = MIN(req->evwait.req_max,
+			      PGSIZE / sizeof(struct pollfd));
+		r = evq_drain(args->whom, req->evwaitRet.ret_ev, max,
+			      req->evwait.req_timeout);
+		break;
+	}
 	case NSREQ_SOCKET:
 		r = lwip_socket(req->socket.req_domain, req->socket.req_type,
 				req->socket.req_protocol);
 		break;
+	case NSREQ_OFFLOAD:
+		lwip_core_lock();
+		r = jif_set_offload(&nif, req->offload.req_flags);
+		lwip_core_unlock();
+		break;
+	case NSREQ_SHARD:
+		r = -E_INVAL;
+		if (shard == 0 && req->shard.req_shard >= 0
+		    && req->shard.req_shard < nshard)
+			r = shard_envid[req->shard.req_shard];
+		break;
+	case NSREQ_MEMSTATS:
+		malloc_stats(&req->memstatsRet.ret_malloc);
+		req->memstatsRet.ret_pages = count_pages();
+		r = 0;
+		break;
 	case NSREQ_INPUT:
 		jif_input(&nif, (void *)&req->pkt);
 		r = 0;
@@ -239,6 +406,10 @@ serve_thread(uint32_t a) {
 		break;
 	}
 
+	// A nonblocking call that found nothing to do
+	if (r == -1 && errno == EWOULDBLOCK)
+		r = -E_AGAIN;
+
 	if (r == -1) {
 		char buf[100];
 		snprintf(buf, sizeof buf, "ns req type %d", args->reqno);
@@ -248,8 +419,9 @@ serve_thread(uint32_t a) {
 	if (args->reqno != NSREQ_INPUT)
 		ipc_send(args->whom, r, 0, 0);
 
+	for (i = 0; i < args->npages; i++)
+		sys_page_unmap(0, (char *) args->req + i * PGSIZE);
 	put_buffer(args->req);
-	sys_page_unmap(0, (void*) args->req);
 	free(args);
 }
 
@@ -257,26 +429,29 @@ void
 serve(void) {
 	int32_t reqno;
 	uint32_t whom;
-	int i, perm;
+	int perm, npages;
 	void *va;
 
 	while (1) {
 		// ipc_recv will block the entire process, so we flush
-		// all pending work from other threads.  We limit the
-		// number of yields in case there's a rogue thread.
-		for (i = 0; thread_wakeups_pending() && i < 32; ++i)
-			thread_yield();
+		// all pending work from other threads.
+		run_threads();
+		set_alarm();
+		// Nor should packets held for TSO wait for the next request.
+		jif_flush(&nif);
 
 		perm = 0;
 		va = get_buffer();
-		reqno = ipc_recv((int32_t *) &whom, (void *) va, &perm);
+		reqno = ipc_recv_pages((int32_t *) &whom, (void *) va,
+				       REQSLOT_PAGES, &perm, &npages);
 		if (debug) {
 			cprintf("ns req %d from %08x\n", reqno, whom);
 		}
 
 		// first take care of requests that do not contain an argument page
-		if (reqno == NSREQ_TIMER) {
-			process_timer(whom);
+		if (reqno == NSREQ_TIMER && whom == 0) {
+			// Our alarm went off; run_threads does the rest.
+			alarm_at = 0;
 			put_buffer(va);
 			continue;
 		}
@@ -296,6 +471,8 @@ serve(void) {
 		args->reqno = reqno;
 		args->whom = whom;
 		args->req = va;
+		args->perm = perm;
+		args->npages = npages;
 
 		thread_create(0, "serve_thread", serve_thread, (uint32_t)args);
 		thread_yield(); // let the thread created run
@@ -313,18 +490,28 @@ tmain(uint32_t arg) {
 void
 umain(int argc, char **argv)
 {
-	envid_t ns_envid = sys_getenvid();
+	envid_t ns_envid;
+	int r;
 
 	binaryname = "ns";
 
-	// fork off the timer thread which will send us periodic messages
-	timer_envid = fork();
-	if (timer_envid < 0)
-		panic("error forking");
-	else if (timer_envid == 0) {
-		timer(ns_envid, TIMER_INTERVAL);
-		return;
+	// fork off the other shards, one per receive queue
+	if ((nshard = sys_net_set_queue(0)) < 0)
+		panic("sys_net_set_queue: %e", nshard);
+	shard_envid[0] = sys_getenvid();
+	for (shard = 1; shard < nshard; shard++) {
+		if ((r = fork()) < 0)
+			panic("error forking");
+		if (r == 0)
+			break;
+		shard_envid[shard] = r;
 	}
+	if (shard == nshard)
+		shard = 0;
+	if ((r = sys_net_set_queue(shard)) < 0)
+		panic("sys_net_set_queue: %e", r);
+	lwip_port_base = 4096 + shard * 0x1000;
+	ns_envid = sys_getenvid();
 
 	// fork off the input thread which will poll the NIC driver for input
 	// packets
@@ -0,0 +1,11108 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f4 1b 00 00       	call   801c25 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <ide_wait_ready>:
+
+static int diskno = 1;
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	89 c3                	mov    %eax,%ebx
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80003b:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800040:	ec                   	in     (%dx),%al
+	int r;
+
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  800041:	89 c1                	mov    %eax,%ecx
+  800043:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800046:	80 f9 40             	cmp    $0x40,%cl
+  800049:	75 f5                	jne    800040 <ide_wait_ready+0xb>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  80004b:	85 db                	test   %ebx,%ebx
+  80004d:	74 0a                	je     800059 <ide_wait_ready+0x24>
+  80004f:	a8 21                	test   $0x21,%al
+  800051:	0f 95 c3             	setne  %bl
+  800054:	0f b6 db             	movzbl %bl,%ebx
+  800057:	f7 db                	neg    %ebx
+		return -1;
+	return 0;
+}
+  800059:	89 d8                	mov    %ebx,%eax
+  80005b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80005e:	c9                   	leave
+  80005f:	c3                   	ret
+
+00800060 <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	53                   	push   %ebx
+  800064:	83 ec 04             	sub    $0x4,%esp
+	int r, x;
+
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	e8 c4 ff ff ff       	call   800035 <ide_wait_ready>
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800071:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800076:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80007b:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80007c:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800081:	ec                   	in     (%dx),%al
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800082:	a8 a1                	test   $0xa1,%al
+  800084:	74 41                	je     8000c7 <ide_probe_disk1+0x67>
+	for (x = 0;
+  800086:	b9 00 00 00 00       	mov    $0x0,%ecx
+	     x++)
+  80008b:	83 c1 01             	add    $0x1,%ecx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  80008e:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800094:	74 05                	je     80009b <ide_probe_disk1+0x3b>
+  800096:	ec                   	in     (%dx),%al
+  800097:	a8 a1                	test   $0xa1,%al
+  800099:	75 f0                	jne    80008b <ide_probe_disk1+0x2b>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80009b:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  8000a0:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000a5:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  8000a6:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000ac:	0f 9e c3             	setle  %bl
+  8000af:	0f b6 db             	movzbl %bl,%ebx
+  8000b2:	83 ec 08             	sub    $0x8,%esp
+  8000b5:	53                   	push   %ebx
+  8000b6:	68 c0 56 80 00       	push   $0x8056c0
+  8000bb:	e8 e7 1c 00 00       	call   801da7 <cprintf>
+	return (x < 1000);
+}
+  8000c0:	89 d8                	mov    %ebx,%eax
+  8000c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000c5:	c9                   	leave
+  8000c6:	c3                   	ret
+	for (x = 0;
+  8000c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000cc:	eb cd                	jmp    80009b <ide_probe_disk1+0x3b>
+
+008000ce <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d != 0 && d != 1)
+  8000d7:	83 f8 01             	cmp    $0x1,%eax
+  8000da:	77 07                	ja     8000e3 <ide_set_disk+0x15>
+		panic("bad disk number");
+	diskno = d;
+  8000dc:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+		panic("bad disk number");
+  8000e3:	83 ec 04             	sub    $0x4,%esp
+  8000e6:	68 d7 56 80 00       	push   $0x8056d7
+  8000eb:	6a 3a                	push   $0x3a
+  8000ed:	68 e7 56 80 00       	push   $0x8056e7
+  8000f2:	e8 d5 1b 00 00       	call   801ccc <_panic>
+
+008000f7 <ide_read>:
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  8000f7:	55                   	push   %ebp
+  8000f8:	89 e5                	mov    %esp,%ebp
+  8000fa:	57                   	push   %edi
+  8000fb:	56                   	push   %esi
+  8000fc:	53                   	push   %ebx
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800103:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800106:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	assert(nsecs <= 256);
+  800109:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  80010f:	0f 87 96 00 00 00    	ja     8001ab <ide_read+0xb4>
+
+	ide_wait_ready(0);
+  800115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011a:	e8 16 ff ff ff       	call   800035 <ide_wait_ready>
+  80011f:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800124:	89 f0                	mov    %esi,%eax
+  800126:	ee                   	out    %al,(%dx)
+  800127:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  80012c:	89 f8                	mov    %edi,%eax
+  80012e:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  80012f:	89 f8                	mov    %edi,%eax
+  800131:	c1 e8 08             	shr    $0x8,%eax
+  800134:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800139:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  80013a:	89 f8                	mov    %edi,%eax
+  80013c:	c1 e8 10             	shr    $0x10,%eax
+  80013f:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800144:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800145:	0f b6 05 00 70 80 00 	movzbl 0x807000,%eax
+  80014c:	c1 e0 04             	shl    $0x4,%eax
+  80014f:	83 e0 10             	and    $0x10,%eax
+  800152:	c1 ef 18             	shr    $0x18,%edi
+  800155:	83 e7 0f             	and    $0xf,%edi
+  800158:	09 f8                	or     %edi,%eax
+  80015a:	83 c8 e0             	or     $0xffffffe0,%eax
+  80015d:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800162:	ee                   	out    %al,(%dx)
+  800163:	b8 20 00 00 00       	mov    $0x20,%eax
+  800168:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80016d:	ee                   	out    %al,(%dx)
+	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80016e:	85 f6                	test   %esi,%esi
+  800170:	74 4f                	je     8001c1 <ide_read+0xca>
+  800172:	c1 e6 09             	shl    $0x9,%esi
+  800175:	01 de                	add    %ebx,%esi
+		if ((r = ide_wait_ready(1)) < 0)
+  800177:	b8 01 00 00 00       	mov    $0x1,%eax
+  80017c:	e8 b4 fe ff ff       	call   800035 <ide_wait_ready>
+  800181:	85 c0                	test   %eax,%eax
+  800183:	78 1e                	js     8001a3 <ide_read+0xac>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+  800185:	89 df                	mov    %ebx,%edi
+  800187:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80018c:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800191:	fc                   	cld
+  800192:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800194:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  80019a:	39 de                	cmp    %ebx,%esi
+  80019c:	75 d9                	jne    800177 <ide_read+0x80>
+			return r;
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+
+	return 0;
+  80019e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a6:	5b                   	pop    %ebx
+  8001a7:	5e                   	pop    %esi
+  8001a8:	5f                   	pop    %edi
+  8001a9:	5d                   	pop    %ebp
+  8001aa:	c3                   	ret
+	assert(nsecs <= 256);
+  8001ab:	68 f0 56 80 00       	push   $0x8056f0
+  8001b0:	68 fd 56 80 00       	push   $0x8056fd
+  8001b5:	6a 43                	push   $0x43
+  8001b7:	68 e7 56 80 00       	push   $0x8056e7
+  8001bc:	e8 0b 1b 00 00       	call   801ccc <_panic>
+	return 0;
+  8001c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c6:	eb db                	jmp    8001a3 <ide_read+0xac>
+
+008001c8 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  8001c8:	55                   	push   %ebp
+  8001c9:	89 e5                	mov    %esp,%ebp
+  8001cb:	57                   	push   %edi
+  8001cc:	56                   	push   %esi
+  8001cd:	53                   	push   %ebx
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001d7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int r;
+
+	assert(nsecs <= 256);
+  8001da:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  8001e0:	0f 87 96 00 00 00    	ja     80027c <ide_write+0xb4>
+
+	ide_wait_ready(0);
+  8001e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001eb:	e8 45 fe ff ff       	call   800035 <ide_wait_ready>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8001f0:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  8001f5:	89 f8                	mov    %edi,%eax
+  8001f7:	ee                   	out    %al,(%dx)
+  8001f8:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  8001fd:	89 f0                	mov    %esi,%eax
+  8001ff:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  800200:	89 f0                	mov    %esi,%eax
+  800202:	c1 e8 08             	shr    $0x8,%eax
+  800205:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  80020a:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  80020b:	89 f0                	mov    %esi,%eax
+  80020d:	c1 e8 10             	shr    $0x10,%eax
+  800210:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800215:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800216:	0f b6 05 00 70 80 00 	movzbl 0x807000,%eax
+  80021d:	c1 e0 04             	shl    $0x4,%eax
+  800220:	83 e0 10             	and    $0x10,%eax
+  800223:	c1 ee 18             	shr    $0x18,%esi
+  800226:	83 e6 0f             	and    $0xf,%esi
+  800229:	09 f0                	or     %esi,%eax
+  80022b:	83 c8 e0             	or     $0xffffffe0,%eax
+  80022e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800233:	ee                   	out    %al,(%dx)
+  800234:	b8 30 00 00 00       	mov    $0x30,%eax
+  800239:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80023e:	ee                   	out    %al,(%dx)
+	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  80023f:	85 ff                	test   %edi,%edi
+  800241:	74 4f                	je     800292 <ide_write+0xca>
+  800243:	c1 e7 09             	shl    $0x9,%edi
+  800246:	01 df                	add    %ebx,%edi
+		if ((r = ide_wait_ready(1)) < 0)
+  800248:	b8 01 00 00 00       	mov    $0x1,%eax
+  80024d:	e8 e3 fd ff ff       	call   800035 <ide_wait_ready>
+  800252:	85 c0                	test   %eax,%eax
+  800254:	78 1e                	js     800274 <ide_write+0xac>
+}
+
+static __inline void
+outsl(int port, const void *addr, int cnt)
+{
+	__asm __volatile("cld\n\trepne\n\toutsl"		:
+  800256:	89 de                	mov    %ebx,%esi
+  800258:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80025d:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800262:	fc                   	cld
+  800263:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800265:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  80026b:	39 df                	cmp    %ebx,%edi
+  80026d:	75 d9                	jne    800248 <ide_write+0x80>
+			return r;
+		outsl(0x1F0, src, SECTSIZE/4);
+	}
+
+	return 0;
+  80026f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800277:	5b                   	pop    %ebx
+  800278:	5e                   	pop    %esi
+  800279:	5f                   	pop    %edi
+  80027a:	5d                   	pop    %ebp
+  80027b:	c3                   	ret
+	assert(nsecs <= 256);
+  80027c:	68 f0 56 80 00       	push   $0x8056f0
+  800281:	68 fd 56 80 00       	push   $0x8056fd
+  800286:	6a 5c                	push   $0x5c
+  800288:	68 e7 56 80 00       	push   $0x8056e7
+  80028d:	e8 3a 1a 00 00       	call   801ccc <_panic>
+	return 0;
+  800292:	b8 00 00 00 00       	mov    $0x0,%eax
+  800297:	eb db                	jmp    800274 <ide_write+0xac>
+
+00800299 <bc_pgfault>:
+// Fault any disk block that is read or written in to memory by
+// loading it from disk.
+// Hint: Use ide_read and BLKSECTS.
+static void
+bc_pgfault(struct UTrapframe *utf)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	56                   	push   %esi
+  80029d:	53                   	push   %ebx
+  80029e:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8002a1:	8b 1a                	mov    (%edx),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8002a3:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+  8002a9:	89 c6                	mov    %eax,%esi
+  8002ab:	c1 ee 0c             	shr    $0xc,%esi
+	int r;
+
+	// Check that the fault was within the block cache region
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8002ae:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8002b3:	77 78                	ja     80032d <bc_pgfault+0x94>
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+		      utf->utf_eip, addr, utf->utf_err);
+
+	// Sanity check the block number.
+	if (super && blockno >= super->s_nblocks)
+  8002b5:	a1 3c c3 80 00       	mov    0x80c33c,%eax
+  8002ba:	85 c0                	test   %eax,%eax
+  8002bc:	74 09                	je     8002c7 <bc_pgfault+0x2e>
+  8002be:	3b 70 04             	cmp    0x4(%eax),%esi
+  8002c1:	0f 83 81 00 00 00    	jae    800348 <bc_pgfault+0xaf>
+	// page not-dirty (since reading the data from disk will mark
+	// the page dirty).
+	//
+	// LAB 5: Your code here
+	//int perm;
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8002c7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8002cd:	83 ec 04             	sub    $0x4,%esp
+  8002d0:	6a 07                	push   $0x7
+  8002d2:	53                   	push   %ebx
+  8002d3:	6a 00                	push   $0x0
+  8002d5:	e8 f8 25 00 00       	call   8028d2 <sys_page_alloc>
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	85 c0                	test   %eax,%eax
+  8002df:	78 79                	js     80035a <bc_pgfault+0xc1>
+		panic("sys_page_alloc: %e", r);
+	ide_read(blockno * BLKSECTS, ROUNDDOWN(addr, PGSIZE), BLKSECTS);
+  8002e1:	83 ec 04             	sub    $0x4,%esp
+  8002e4:	6a 08                	push   $0x8
+  8002e6:	53                   	push   %ebx
+  8002e7:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+  8002ee:	50                   	push   %eax
+  8002ef:	e8 03 fe ff ff       	call   8000f7 <ide_read>
+	//perm = vpt[PGNUM(addr)] & (PGSIZE - 1);
+	//perm &= ~PTE_D;
+	if ((r = sys_page_map(0, ROUNDDOWN(addr, PGSIZE), 0, ROUNDDOWN(addr, PGSIZE), PTE_SYSCALL)) < 0)
+  8002f4:	c7 04 24 07 0e 00 00 	movl   $0xe07,(%esp)
+  8002fb:	53                   	push   %ebx
+  8002fc:	6a 00                	push   $0x0
+  8002fe:	53                   	push   %ebx
+  8002ff:	6a 00                	push   $0x0
+  800301:	e8 0f 26 00 00       	call   802915 <sys_page_map>
+  800306:	83 c4 20             	add    $0x20,%esp
+  800309:	85 c0                	test   %eax,%eax
+  80030b:	78 5f                	js     80036c <bc_pgfault+0xd3>
+//	panic("bc_pgfault not implemented");
+
+	// Check that the block we read was allocated. (exercise for
+	// the reader: why do we do this *after* reading the block
+	// in?)
+	if (bitmap && block_is_free(blockno))
+  80030d:	83 3d 38 c3 80 00 00 	cmpl   $0x0,0x80c338
+  800314:	74 10                	je     800326 <bc_pgfault+0x8d>
+  800316:	83 ec 0c             	sub    $0xc,%esp
+  800319:	56                   	push   %esi
+  80031a:	e8 a8 03 00 00       	call   8006c7 <block_is_free>
+  80031f:	83 c4 10             	add    $0x10,%esp
+  800322:	85 c0                	test   %eax,%eax
+  800324:	75 58                	jne    80037e <bc_pgfault+0xe5>
+		panic("reading free block %08x\n", blockno);
+}
+  800326:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800329:	5b                   	pop    %ebx
+  80032a:	5e                   	pop    %esi
+  80032b:	5d                   	pop    %ebp
+  80032c:	c3                   	ret
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+  80032d:	83 ec 08             	sub    $0x8,%esp
+  800330:	ff 72 04             	push   0x4(%edx)
+  800333:	53                   	push   %ebx
+  800334:	ff 72 28             	push   0x28(%edx)
+  800337:	68 14 57 80 00       	push   $0x805714
+  80033c:	6a 27                	push   $0x27
+  80033e:	68 b0 57 80 00       	push   $0x8057b0
+  800343:	e8 84 19 00 00       	call   801ccc <_panic>
+		panic("reading non-existent block %08x\n", blockno);
+  800348:	56                   	push   %esi
+  800349:	68 44 57 80 00       	push   $0x805744
+  80034e:	6a 2c                	push   $0x2c
+  800350:	68 b0 57 80 00       	push   $0x8057b0
+  800355:	e8 72 19 00 00       	call   801ccc <_panic>
+		panic("sys_page_alloc: %e", r);
+  80035a:	50                   	push   %eax
+  80035b:	68 b8 57 80 00       	push   $0x8057b8
+  800360:	6a 36                	push   $0x36
+  800362:	68 b0 57 80 00       	push   $0x8057b0
+  800367:	e8 60 19 00 00       	call   801ccc <_panic>
+		panic("sys_page_map: %e", r);
+  80036c:	50                   	push   %eax
+  80036d:	68 cb 57 80 00       	push   $0x8057cb
+  800372:	6a 3b                	push   $0x3b
+  800374:	68 b0 57 80 00       	push   $0x8057b0
+  800379:	e8 4e 19 00 00       	call   801ccc <_panic>
+		panic("reading free block %08x\n", blockno);
+  80037e:	56                   	push   %esi
+  80037f:	68 dc 57 80 00       	push   $0x8057dc
+  800384:	6a 43                	push   $0x43
+  800386:	68 b0 57 80 00       	push   $0x8057b0
+  80038b:	e8 3c 19 00 00       	call   801ccc <_panic>
+
+00800390 <diskaddr>:
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	83 ec 08             	sub    $0x8,%esp
+  800396:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  800399:	85 c0                	test   %eax,%eax
+  80039b:	74 19                	je     8003b6 <diskaddr+0x26>
+  80039d:	8b 15 3c c3 80 00    	mov    0x80c33c,%edx
+  8003a3:	85 d2                	test   %edx,%edx
+  8003a5:	74 05                	je     8003ac <diskaddr+0x1c>
+  8003a7:	3b 42 04             	cmp    0x4(%edx),%eax
+  8003aa:	73 0a                	jae    8003b6 <diskaddr+0x26>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8003ac:	05 00 00 01 00       	add    $0x10000,%eax
+  8003b1:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8003b4:	c9                   	leave
+  8003b5:	c3                   	ret
+		panic("bad block number %08x in diskaddr", blockno);
+  8003b6:	50                   	push   %eax
+  8003b7:	68 68 57 80 00       	push   $0x805768
+  8003bc:	6a 09                	push   $0x9
+  8003be:	68 b0 57 80 00       	push   $0x8057b0
+  8003c3:	e8 04 19 00 00       	call   801ccc <_panic>
+
+008003c8 <va_is_mapped>:
+{
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (vpd[PDX(va)] & PTE_P) && (vpt[PGNUM(va)] & PTE_P);
+  8003ce:	89 d0                	mov    %edx,%eax
+  8003d0:	c1 e8 16             	shr    $0x16,%eax
+  8003d3:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8003da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003df:	f6 c1 01             	test   $0x1,%cl
+  8003e2:	74 0d                	je     8003f1 <va_is_mapped+0x29>
+  8003e4:	c1 ea 0c             	shr    $0xc,%edx
+  8003e7:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8003ee:	83 e0 01             	and    $0x1,%eax
+}
+  8003f1:	5d                   	pop    %ebp
+  8003f2:	c3                   	ret
+
+008003f3 <va_is_dirty>:
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+	return (vpt[PGNUM(va)] & PTE_D) != 0;
+  8003f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f9:	c1 e8 0c             	shr    $0xc,%eax
+  8003fc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800403:	c1 e8 06             	shr    $0x6,%eax
+  800406:	83 e0 01             	and    $0x1,%eax
+}
+  800409:	5d                   	pop    %ebp
+  80040a:	c3                   	ret
+
+0080040b <flush_block>:
+// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
+// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+// Hint: Don't forget to round addr down.
+void
+flush_block(void *addr)
+{
+  80040b:	55                   	push   %ebp
+  80040c:	89 e5                	mov    %esp,%ebp
+  80040e:	56                   	push   %esi
+  80040f:	53                   	push   %ebx
+  800410:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800413:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  800419:	81 fe ff ff ff bf    	cmp    $0xbfffffff,%esi
+  80041f:	77 17                	ja     800438 <flush_block+0x2d>
+		panic("flush_block of bad va %08x", addr);
+	// LAB 5: Your code here.
+	int r;
+	if (va_is_mapped(addr) && va_is_dirty(addr)) {
+  800421:	83 ec 0c             	sub    $0xc,%esp
+  800424:	53                   	push   %ebx
+  800425:	e8 9e ff ff ff       	call   8003c8 <va_is_mapped>
+  80042a:	83 c4 10             	add    $0x10,%esp
+  80042d:	85 c0                	test   %eax,%eax
+  80042f:	75 19                	jne    80044a <flush_block+0x3f>
+			ROUNDDOWN(addr, PGSIZE), PTE_SYSCALL);	
+		if (r < 0)
+			panic("sys_page_map: %e", r);
+	}
+//	panic("flush_block not implemented");
+}
+  800431:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800434:	5b                   	pop    %ebx
+  800435:	5e                   	pop    %esi
+  800436:	5d                   	pop    %ebp
+  800437:	c3                   	ret
+		panic("flush_block of bad va %08x", addr);
+  800438:	53                   	push   %ebx
+  800439:	68 f5 57 80 00       	push   $0x8057f5
+  80043e:	6a 53                	push   $0x53
+  800440:	68 b0 57 80 00       	push   $0x8057b0
+  800445:	e8 82 18 00 00       	call   801ccc <_panic>
+	if (va_is_mapped(addr) && va_is_dirty(addr)) {
+  80044a:	83 ec 0c             	sub    $0xc,%esp
+  80044d:	53                   	push   %ebx
+  80044e:	e8 a0 ff ff ff       	call   8003f3 <va_is_dirty>
+  800453:	83 c4 10             	add    $0x10,%esp
+  800456:	85 c0                	test   %eax,%eax
+  800458:	74 d7                	je     800431 <flush_block+0x26>
+		if ((r = ide_write(blockno * BLKSECTS, ROUNDDOWN(addr, PGSIZE), BLKSECTS)) < 0)
+  80045a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  800460:	83 ec 04             	sub    $0x4,%esp
+  800463:	6a 08                	push   $0x8
+  800465:	53                   	push   %ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800466:	c1 ee 0c             	shr    $0xc,%esi
+		if ((r = ide_write(blockno * BLKSECTS, ROUNDDOWN(addr, PGSIZE), BLKSECTS)) < 0)
+  800469:	c1 e6 03             	shl    $0x3,%esi
+  80046c:	56                   	push   %esi
+  80046d:	e8 56 fd ff ff       	call   8001c8 <ide_write>
+  800472:	83 c4 10             	add    $0x10,%esp
+  800475:	85 c0                	test   %eax,%eax
+  800477:	78 2c                	js     8004a5 <flush_block+0x9a>
+		r = sys_page_map(0, ROUNDDOWN(addr, PGSIZE), 0, 
+  800479:	83 ec 0c             	sub    $0xc,%esp
+  80047c:	68 07 0e 00 00       	push   $0xe07
+  800481:	53                   	push   %ebx
+  800482:	6a 00                	push   $0x0
+  800484:	53                   	push   %ebx
+  800485:	6a 00                	push   $0x0
+  800487:	e8 89 24 00 00       	call   802915 <sys_page_map>
+		if (r < 0)
+  80048c:	83 c4 20             	add    $0x20,%esp
+  80048f:	85 c0                	test   %eax,%eax
+  800491:	79 9e                	jns    800431 <flush_block+0x26>
+			panic("sys_page_map: %e", r);
+  800493:	50                   	push   %eax
+  800494:	68 cb 57 80 00       	push   $0x8057cb
+  800499:	6a 5c                	push   $0x5c
+  80049b:	68 b0 57 80 00       	push   $0x8057b0
+  8004a0:	e8 27 18 00 00       	call   801ccc <_panic>
+			panic("ide_write: %e",r);
+  8004a5:	50                   	push   %eax
+  8004a6:	68 10 58 80 00       	push   $0x805810
+  8004ab:	6a 58                	push   $0x58
+  8004ad:	68 b0 57 80 00       	push   $0x8057b0
+  8004b2:	e8 15 18 00 00       	call   801ccc <_panic>
+
+008004b7 <check_bc>:
+
+// Test that the block cache works, by smashing the superblock and
+// reading it back.
+static void
+check_bc(void)
+{
+  8004b7:	55                   	push   %ebp
+  8004b8:	89 e5                	mov    %esp,%ebp
+  8004ba:	81 ec 24 01 00 00    	sub    $0x124,%esp
+	struct Super backup;
+
+	// back up super block
+	memmove(&backup, diskaddr(1), sizeof backup);
+  8004c0:	6a 01                	push   $0x1
+  8004c2:	e8 c9 fe ff ff       	call   800390 <diskaddr>
+  8004c7:	83 c4 0c             	add    $0xc,%esp
+  8004ca:	68 0c 01 00 00       	push   $0x10c
+  8004cf:	50                   	push   %eax
+  8004d0:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+  8004d6:	50                   	push   %eax
+  8004d7:	e8 72 21 00 00       	call   80264e <memmove>
+
+	// smash it
+	strcpy(diskaddr(1), "OOPS!\n");
+  8004dc:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8004e3:	e8 a8 fe ff ff       	call   800390 <diskaddr>
+  8004e8:	83 c4 08             	add    $0x8,%esp
+  8004eb:	68 1e 58 80 00       	push   $0x80581e
+  8004f0:	50                   	push   %eax
+  8004f1:	e8 a8 1f 00 00       	call   80249e <strcpy>
+	flush_block(diskaddr(1));
+  8004f6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8004fd:	e8 8e fe ff ff       	call   800390 <diskaddr>
+  800502:	89 04 24             	mov    %eax,(%esp)
+  800505:	e8 01 ff ff ff       	call   80040b <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  80050a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800511:	e8 7a fe ff ff       	call   800390 <diskaddr>
+  800516:	89 04 24             	mov    %eax,(%esp)
+  800519:	e8 aa fe ff ff       	call   8003c8 <va_is_mapped>
+  80051e:	83 c4 10             	add    $0x10,%esp
+  800521:	85 c0                	test   %eax,%eax
+  800523:	0f 84 b8 00 00 00    	je     8005e1 <check_bc+0x12a>
+	assert(!va_is_dirty(diskaddr(1)));
+  800529:	83 ec 0c             	sub    $0xc,%esp
+  80052c:	6a 01                	push   $0x1
+  80052e:	e8 5d fe ff ff       	call   800390 <diskaddr>
+  800533:	89 04 24             	mov    %eax,(%esp)
+  800536:	e8 b8 fe ff ff       	call   8003f3 <va_is_dirty>
+  80053b:	83 c4 10             	add    $0x10,%esp
+  80053e:	85 c0                	test   %eax,%eax
+  800540:	0f 85 b1 00 00 00    	jne    8005f7 <check_bc+0x140>
+
+	// clear it out
+	sys_page_unmap(0, diskaddr(1));
+  800546:	83 ec 0c             	sub    $0xc,%esp
+  800549:	6a 01                	push   $0x1
+  80054b:	e8 40 fe ff ff       	call   800390 <diskaddr>
+  800550:	83 c4 08             	add    $0x8,%esp
+  800553:	50                   	push   %eax
+  800554:	6a 00                	push   $0x0
+  800556:	e8 fc 23 00 00       	call   802957 <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  80055b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800562:	e8 29 fe ff ff       	call   800390 <diskaddr>
+  800567:	89 04 24             	mov    %eax,(%esp)
+  80056a:	e8 59 fe ff ff       	call   8003c8 <va_is_mapped>
+  80056f:	83 c4 10             	add    $0x10,%esp
+  800572:	85 c0                	test   %eax,%eax
+  800574:	0f 85 93 00 00 00    	jne    80060d <check_bc+0x156>
+
+	// read it back in
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  80057a:	83 ec 0c             	sub    $0xc,%esp
+  80057d:	6a 01                	push   $0x1
+  80057f:	e8 0c fe ff ff       	call   800390 <diskaddr>
+  800584:	83 c4 08             	add    $0x8,%esp
+  800587:	68 1e 58 80 00       	push   $0x80581e
+  80058c:	50                   	push   %eax
+  80058d:	e8 bc 1f 00 00       	call   80254e <strcmp>
+  800592:	83 c4 10             	add    $0x10,%esp
+  800595:	85 c0                	test   %eax,%eax
+  800597:	0f 85 86 00 00 00    	jne    800623 <check_bc+0x16c>
+
+	// fix it
+	memmove(diskaddr(1), &backup, sizeof backup);
+  80059d:	83 ec 0c             	sub    $0xc,%esp
+  8005a0:	6a 01                	push   $0x1
+  8005a2:	e8 e9 fd ff ff       	call   800390 <diskaddr>
+  8005a7:	83 c4 0c             	add    $0xc,%esp
+  8005aa:	68 0c 01 00 00       	push   $0x10c
+  8005af:	8d 95 ec fe ff ff    	lea    -0x114(%ebp),%edx
+  8005b5:	52                   	push   %edx
+  8005b6:	50                   	push   %eax
+  8005b7:	e8 92 20 00 00       	call   80264e <memmove>
+	flush_block(diskaddr(1));
+  8005bc:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8005c3:	e8 c8 fd ff ff       	call   800390 <diskaddr>
+  8005c8:	89 04 24             	mov    %eax,(%esp)
+  8005cb:	e8 3b fe ff ff       	call   80040b <flush_block>
+
+	cprintf("block cache is good\n");
+  8005d0:	c7 04 24 5a 58 80 00 	movl   $0x80585a,(%esp)
+  8005d7:	e8 cb 17 00 00       	call   801da7 <cprintf>
+}
+  8005dc:	83 c4 10             	add    $0x10,%esp
+  8005df:	c9                   	leave
+  8005e0:	c3                   	ret
+	assert(va_is_mapped(diskaddr(1)));
+  8005e1:	68 40 58 80 00       	push   $0x805840
+  8005e6:	68 fd 56 80 00       	push   $0x8056fd
+  8005eb:	6a 6e                	push   $0x6e
+  8005ed:	68 b0 57 80 00       	push   $0x8057b0
+  8005f2:	e8 d5 16 00 00       	call   801ccc <_panic>
+	assert(!va_is_dirty(diskaddr(1)));
+  8005f7:	68 25 58 80 00       	push   $0x805825
+  8005fc:	68 fd 56 80 00       	push   $0x8056fd
+  800601:	6a 6f                	push   $0x6f
+  800603:	68 b0 57 80 00       	push   $0x8057b0
+  800608:	e8 bf 16 00 00       	call   801ccc <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  80060d:	68 3f 58 80 00       	push   $0x80583f
+  800612:	68 fd 56 80 00       	push   $0x8056fd
+  800617:	6a 73                	push   $0x73
+  800619:	68 b0 57 80 00       	push   $0x8057b0
+  80061e:	e8 a9 16 00 00       	call   801ccc <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  800623:	68 8c 57 80 00       	push   $0x80578c
+  800628:	68 fd 56 80 00       	push   $0x8056fd
+  80062d:	6a 76                	push   $0x76
+  80062f:	68 b0 57 80 00       	push   $0x8057b0
+  800634:	e8 93 16 00 00       	call   801ccc <_panic>
+
+00800639 <bc_init>:
+
+void
+bc_init(void)
+{
+  800639:	55                   	push   %ebp
+  80063a:	89 e5                	mov    %esp,%ebp
+  80063c:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(bc_pgfault);
+  80063f:	68 99 02 80 00       	push   $0x800299
+  800644:	e8 ec 26 00 00       	call   802d35 <set_pgfault_handler>
+	check_bc();
+  800649:	e8 69 fe ff ff       	call   8004b7 <check_bc>
+}
+  80064e:	83 c4 10             	add    $0x10,%esp
+  800651:	c9                   	leave
+  800652:	c3                   	ret
+
+00800653 <file_touch>:
+// --------------------------------------------------------------
+
+// Mark f as modified.
+static void
+file_touch(struct File *f)
+{
+  800653:	89 c1                	mov    %eax,%ecx
+	f->f_version = ++super->s_version;
+  800655:	8b 15 3c c3 80 00    	mov    0x80c33c,%edx
+  80065b:	8b 82 08 01 00 00    	mov    0x108(%edx),%eax
+  800661:	83 c0 01             	add    $0x1,%eax
+  800664:	89 82 08 01 00 00    	mov    %eax,0x108(%edx)
+  80066a:	89 81 b4 00 00 00    	mov    %eax,0xb4(%ecx)
+}
+  800670:	c3                   	ret
+
+00800671 <check_super>:
+{
+  800671:	55                   	push   %ebp
+  800672:	89 e5                	mov    %esp,%ebp
+  800674:	83 ec 08             	sub    $0x8,%esp
+	if (super->s_magic != FS_MAGIC)
+  800677:	a1 3c c3 80 00       	mov    0x80c33c,%eax
+  80067c:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  800682:	75 1b                	jne    80069f <check_super+0x2e>
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  800684:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  80068b:	77 26                	ja     8006b3 <check_super+0x42>
+	cprintf("superblock is good\n");
+  80068d:	83 ec 0c             	sub    $0xc,%esp
+  800690:	68 ad 58 80 00       	push   $0x8058ad
+  800695:	e8 0d 17 00 00       	call   801da7 <cprintf>
+}
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	c9                   	leave
+  80069e:	c3                   	ret
+		panic("bad file system magic number");
+  80069f:	83 ec 04             	sub    $0x4,%esp
+  8006a2:	68 6f 58 80 00       	push   $0x80586f
+  8006a7:	6a 0e                	push   $0xe
+  8006a9:	68 8c 58 80 00       	push   $0x80588c
+  8006ae:	e8 19 16 00 00       	call   801ccc <_panic>
+		panic("file system is too large");
+  8006b3:	83 ec 04             	sub    $0x4,%esp
+  8006b6:	68 94 58 80 00       	push   $0x805894
+  8006bb:	6a 11                	push   $0x11
+  8006bd:	68 8c 58 80 00       	push   $0x80588c
+  8006c2:	e8 05 16 00 00       	call   801ccc <_panic>
+
+008006c7 <block_is_free>:
+{
+  8006c7:	55                   	push   %ebp
+  8006c8:	89 e5                	mov    %esp,%ebp
+  8006ca:	53                   	push   %ebx
+  8006cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (super == 0 || blockno >= super->s_nblocks)
+  8006ce:	a1 3c c3 80 00       	mov    0x80c33c,%eax
+  8006d3:	85 c0                	test   %eax,%eax
+  8006d5:	74 2c                	je     800703 <block_is_free+0x3c>
+		return 0;
+  8006d7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (super == 0 || blockno >= super->s_nblocks)
+  8006dc:	3b 48 04             	cmp    0x4(%eax),%ecx
+  8006df:	73 1b                	jae    8006fc <block_is_free+0x35>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  8006e1:	89 cb                	mov    %ecx,%ebx
+  8006e3:	c1 eb 05             	shr    $0x5,%ebx
+  8006e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006eb:	d3 e0                	shl    %cl,%eax
+  8006ed:	8b 15 38 c3 80 00    	mov    0x80c338,%edx
+  8006f3:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  8006f6:	0f 95 c2             	setne  %dl
+  8006f9:	0f b6 d2             	movzbl %dl,%edx
+}
+  8006fc:	89 d0                	mov    %edx,%eax
+  8006fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800701:	c9                   	leave
+  800702:	c3                   	ret
+		return 0;
+  800703:	ba 00 00 00 00       	mov    $0x0,%edx
+  800708:	eb f2                	jmp    8006fc <block_is_free+0x35>
+
+0080070a <free_block>:
+{
+  80070a:	55                   	push   %ebp
+  80070b:	89 e5                	mov    %esp,%ebp
+  80070d:	53                   	push   %ebx
+  80070e:	83 ec 04             	sub    $0x4,%esp
+  800711:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (blockno == 0)
+  800714:	85 c9                	test   %ecx,%ecx
+  800716:	74 1a                	je     800732 <free_block+0x28>
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  800718:	89 cb                	mov    %ecx,%ebx
+  80071a:	c1 eb 05             	shr    $0x5,%ebx
+  80071d:	8b 15 38 c3 80 00    	mov    0x80c338,%edx
+  800723:	b8 01 00 00 00       	mov    $0x1,%eax
+  800728:	d3 e0                	shl    %cl,%eax
+  80072a:	09 04 9a             	or     %eax,(%edx,%ebx,4)
+}
+  80072d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800730:	c9                   	leave
+  800731:	c3                   	ret
+		panic("attempt to free zero block");
+  800732:	83 ec 04             	sub    $0x4,%esp
+  800735:	68 c1 58 80 00       	push   $0x8058c1
+  80073a:	6a 2c                	push   $0x2c
+  80073c:	68 8c 58 80 00       	push   $0x80588c
+  800741:	e8 86 15 00 00       	call   801ccc <_panic>
+
+00800746 <alloc_block>:
+{
+  800746:	55                   	push   %ebp
+  800747:	89 e5                	mov    %esp,%ebp
+  800749:	56                   	push   %esi
+  80074a:	53                   	push   %ebx
+	for (blockno = 0; blockno < super->s_nblocks; blockno++) {
+  80074b:	a1 3c c3 80 00       	mov    0x80c33c,%eax
+  800750:	8b 70 04             	mov    0x4(%eax),%esi
+  800753:	85 f6                	test   %esi,%esi
+  800755:	74 5f                	je     8007b6 <alloc_block+0x70>
+  800757:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (block_is_free(blockno)) {
+  80075c:	83 ec 0c             	sub    $0xc,%esp
+  80075f:	53                   	push   %ebx
+  800760:	e8 62 ff ff ff       	call   8006c7 <block_is_free>
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	85 c0                	test   %eax,%eax
+  80076a:	75 0e                	jne    80077a <alloc_block+0x34>
+	for (blockno = 0; blockno < super->s_nblocks; blockno++) {
+  80076c:	83 c3 01             	add    $0x1,%ebx
+  80076f:	39 f3                	cmp    %esi,%ebx
+  800771:	75 e9                	jne    80075c <alloc_block+0x16>
+	return -E_NO_DISK;
+  800773:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  800778:	eb 35                	jmp    8007af <alloc_block+0x69>
+			bitmap[blockno/32] ^= 1<<(blockno%32);
+  80077a:	89 de                	mov    %ebx,%esi
+  80077c:	c1 ee 05             	shr    $0x5,%esi
+  80077f:	8b 15 38 c3 80 00    	mov    0x80c338,%edx
+  800785:	b8 01 00 00 00       	mov    $0x1,%eax
+  80078a:	89 d9                	mov    %ebx,%ecx
+  80078c:	d3 e0                	shl    %cl,%eax
+  80078e:	31 04 b2             	xor    %eax,(%edx,%esi,4)
+			flush_block(diskaddr(bi));
+  800791:	83 ec 0c             	sub    $0xc,%esp
+			bi = blockno / BLKBITSIZE + 2;
+  800794:	89 d8                	mov    %ebx,%eax
+  800796:	c1 e8 0f             	shr    $0xf,%eax
+  800799:	83 c0 02             	add    $0x2,%eax
+			flush_block(diskaddr(bi));
+  80079c:	50                   	push   %eax
+  80079d:	e8 ee fb ff ff       	call   800390 <diskaddr>
+  8007a2:	89 04 24             	mov    %eax,(%esp)
+  8007a5:	e8 61 fc ff ff       	call   80040b <flush_block>
+			return blockno;
+  8007aa:	89 d8                	mov    %ebx,%eax
+  8007ac:	83 c4 10             	add    $0x10,%esp
+}
+  8007af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8007b2:	5b                   	pop    %ebx
+  8007b3:	5e                   	pop    %esi
+  8007b4:	5d                   	pop    %ebp
+  8007b5:	c3                   	ret
+	return -E_NO_DISK;
+  8007b6:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8007bb:	eb f2                	jmp    8007af <alloc_block+0x69>
+
+008007bd <file_block_walk>:
+{
+  8007bd:	55                   	push   %ebp
+  8007be:	89 e5                	mov    %esp,%ebp
+  8007c0:	57                   	push   %edi
+  8007c1:	56                   	push   %esi
+  8007c2:	53                   	push   %ebx
+  8007c3:	83 ec 1c             	sub    $0x1c,%esp
+  8007c6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if(filebno >= NDIRECT + NINDIRECT)
+  8007c9:	81 fa 09 04 00 00    	cmp    $0x409,%edx
+  8007cf:	0f 87 a6 00 00 00    	ja     80087b <file_block_walk+0xbe>
+  8007d5:	89 c6                	mov    %eax,%esi
+  8007d7:	89 d3                	mov    %edx,%ebx
+	if (filebno < NDIRECT) {
+  8007d9:	83 fa 09             	cmp    $0x9,%edx
+  8007dc:	76 71                	jbe    80084f <file_block_walk+0x92>
+		if (f->f_indirect) {
+  8007de:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+  8007e4:	85 c0                	test   %eax,%eax
+  8007e6:	75 77                	jne    80085f <file_block_walk+0xa2>
+		} else if (alloc) {
+  8007e8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8007ec:	0f 84 90 00 00 00    	je     800882 <file_block_walk+0xc5>
+			if ((blockno = alloc_block()) < 0)
+  8007f2:	e8 4f ff ff ff       	call   800746 <alloc_block>
+  8007f7:	89 c7                	mov    %eax,%edi
+			f->f_indirect = blockno;
+  8007f9:	89 86 b0 00 00 00    	mov    %eax,0xb0(%esi)
+			memset(diskaddr(blockno), 0, BLKSIZE);
+  8007ff:	83 ec 0c             	sub    $0xc,%esp
+  800802:	50                   	push   %eax
+  800803:	e8 88 fb ff ff       	call   800390 <diskaddr>
+  800808:	83 c4 0c             	add    $0xc,%esp
+  80080b:	68 00 10 00 00       	push   $0x1000
+  800810:	6a 00                	push   $0x0
+  800812:	50                   	push   %eax
+  800813:	e8 01 1e 00 00       	call   802619 <memset>
+			flush_block(diskaddr(blockno));
+  800818:	89 3c 24             	mov    %edi,(%esp)
+  80081b:	e8 70 fb ff ff       	call   800390 <diskaddr>
+  800820:	89 04 24             	mov    %eax,(%esp)
+  800823:	e8 e3 fb ff ff       	call   80040b <flush_block>
+			indirect = diskaddr(f->f_indirect);
+  800828:	83 c4 04             	add    $0x4,%esp
+  80082b:	ff b6 b0 00 00 00    	push   0xb0(%esi)
+  800831:	e8 5a fb ff ff       	call   800390 <diskaddr>
+			*ppdiskbno = &indirect[filebno - NDIRECT];
+  800836:	8d 44 98 d8          	lea    -0x28(%eax,%ebx,4),%eax
+  80083a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80083d:	89 07                	mov    %eax,(%edi)
+			return 0;
+  80083f:	83 c4 10             	add    $0x10,%esp
+  800842:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800847:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80084a:	5b                   	pop    %ebx
+  80084b:	5e                   	pop    %esi
+  80084c:	5f                   	pop    %edi
+  80084d:	5d                   	pop    %ebp
+  80084e:	c3                   	ret
+			*ppdiskbno = &f->f_direct[filebno];
+  80084f:	8d 84 90 88 00 00 00 	lea    0x88(%eax,%edx,4),%eax
+  800856:	89 01                	mov    %eax,(%ecx)
+			return 0;
+  800858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085d:	eb e8                	jmp    800847 <file_block_walk+0x8a>
+			indirect = diskaddr(f->f_indirect);
+  80085f:	83 ec 0c             	sub    $0xc,%esp
+  800862:	50                   	push   %eax
+  800863:	e8 28 fb ff ff       	call   800390 <diskaddr>
+			*ppdiskbno = &indirect[filebno - NDIRECT];
+  800868:	8d 44 98 d8          	lea    -0x28(%eax,%ebx,4),%eax
+  80086c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80086f:	89 02                	mov    %eax,(%edx)
+			return 0;
+  800871:	83 c4 10             	add    $0x10,%esp
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	eb cc                	jmp    800847 <file_block_walk+0x8a>
+		return -E_INVAL;
+  80087b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800880:	eb c5                	jmp    800847 <file_block_walk+0x8a>
+			return -E_NOT_FOUND;
+  800882:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  800887:	eb be                	jmp    800847 <file_block_walk+0x8a>
+
+00800889 <file_truncate_blocks>:
+// (Remember to clear the f->f_indirect pointer so you'll know
+// whether it's valid!)
+// Do not change f->f_size.
+static void
+file_truncate_blocks(struct File *f, off_t newsize)
+{
+  800889:	55                   	push   %ebp
+  80088a:	89 e5                	mov    %esp,%ebp
+  80088c:	57                   	push   %edi
+  80088d:	56                   	push   %esi
+  80088e:	53                   	push   %ebx
+  80088f:	83 ec 2c             	sub    $0x2c,%esp
+  800892:	89 c6                	mov    %eax,%esi
+  800894:	89 d0                	mov    %edx,%eax
+	int r;
+	uint32_t bno, old_nblocks, new_nblocks;
+
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  800896:	8b 8e 80 00 00 00    	mov    0x80(%esi),%ecx
+  80089c:	8d 91 fe 1f 00 00    	lea    0x1ffe(%ecx),%edx
+  8008a2:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+  8008a8:	0f 49 d1             	cmovns %ecx,%edx
+  8008ab:	c1 fa 0c             	sar    $0xc,%edx
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  8008ae:	8d b8 fe 1f 00 00    	lea    0x1ffe(%eax),%edi
+  8008b4:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8008b9:	0f 49 f8             	cmovns %eax,%edi
+  8008bc:	c1 ff 0c             	sar    $0xc,%edi
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  8008bf:	39 d7                	cmp    %edx,%edi
+  8008c1:	73 12                	jae    8008d5 <file_truncate_blocks+0x4c>
+  8008c3:	89 fb                	mov    %edi,%ebx
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+  8008c5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8008c8:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  8008cb:	89 d7                	mov    %edx,%edi
+  8008cd:	eb 4d                	jmp    80091c <file_truncate_blocks+0x93>
+  8008cf:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8008d2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+		if ((r = file_free_block(f, bno)) < 0)
+			cprintf("warning: file_free_block: %e", r);
+
+	if (new_nblocks <= NDIRECT && f->f_indirect) {
+  8008d5:	83 ff 0a             	cmp    $0xa,%edi
+  8008d8:	77 0a                	ja     8008e4 <file_truncate_blocks+0x5b>
+  8008da:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  8008e0:	85 c0                	test   %eax,%eax
+  8008e2:	75 08                	jne    8008ec <file_truncate_blocks+0x63>
+		free_block(f->f_indirect);
+		f->f_indirect = 0;
+	}
+}
+  8008e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008e7:	5b                   	pop    %ebx
+  8008e8:	5e                   	pop    %esi
+  8008e9:	5f                   	pop    %edi
+  8008ea:	5d                   	pop    %ebp
+  8008eb:	c3                   	ret
+		free_block(f->f_indirect);
+  8008ec:	83 ec 0c             	sub    $0xc,%esp
+  8008ef:	50                   	push   %eax
+  8008f0:	e8 15 fe ff ff       	call   80070a <free_block>
+		f->f_indirect = 0;
+  8008f5:	c7 86 b0 00 00 00 00 	movl   $0x0,0xb0(%esi)
+  8008fc:	00 00 00 
+  8008ff:	83 c4 10             	add    $0x10,%esp
+}
+  800902:	eb e0                	jmp    8008e4 <file_truncate_blocks+0x5b>
+			cprintf("warning: file_free_block: %e", r);
+  800904:	83 ec 08             	sub    $0x8,%esp
+  800907:	50                   	push   %eax
+  800908:	68 dc 58 80 00       	push   $0x8058dc
+  80090d:	e8 95 14 00 00       	call   801da7 <cprintf>
+  800912:	83 c4 10             	add    $0x10,%esp
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  800915:	83 c3 01             	add    $0x1,%ebx
+  800918:	39 fb                	cmp    %edi,%ebx
+  80091a:	73 b3                	jae    8008cf <file_truncate_blocks+0x46>
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+  80091c:	83 ec 0c             	sub    $0xc,%esp
+  80091f:	6a 00                	push   $0x0
+  800921:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  800924:	89 da                	mov    %ebx,%edx
+  800926:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800929:	e8 8f fe ff ff       	call   8007bd <file_block_walk>
+  80092e:	83 c4 10             	add    $0x10,%esp
+  800931:	85 c0                	test   %eax,%eax
+  800933:	78 cf                	js     800904 <file_truncate_blocks+0x7b>
+	if (*ptr) {
+  800935:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800938:	8b 06                	mov    (%esi),%eax
+  80093a:	85 c0                	test   %eax,%eax
+  80093c:	74 d7                	je     800915 <file_truncate_blocks+0x8c>
+		free_block(*ptr);
+  80093e:	83 ec 0c             	sub    $0xc,%esp
+  800941:	50                   	push   %eax
+  800942:	e8 c3 fd ff ff       	call   80070a <free_block>
+		*ptr = 0;
+  800947:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  80094d:	83 c4 10             	add    $0x10,%esp
+  800950:	eb c3                	jmp    800915 <file_truncate_blocks+0x8c>
+
+00800952 <check_bitmap>:
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	56                   	push   %esi
+  800956:	53                   	push   %ebx
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800957:	a1 3c c3 80 00       	mov    0x80c33c,%eax
+  80095c:	8b 70 04             	mov    0x4(%eax),%esi
+  80095f:	85 f6                	test   %esi,%esi
+  800961:	74 24                	je     800987 <check_bitmap+0x35>
+  800963:	bb 00 00 00 00       	mov    $0x0,%ebx
+		assert(!block_is_free(2+i));
+  800968:	83 ec 0c             	sub    $0xc,%esp
+  80096b:	8d 43 02             	lea    0x2(%ebx),%eax
+  80096e:	50                   	push   %eax
+  80096f:	e8 53 fd ff ff       	call   8006c7 <block_is_free>
+  800974:	83 c4 10             	add    $0x10,%esp
+  800977:	85 c0                	test   %eax,%eax
+  800979:	75 45                	jne    8009c0 <check_bitmap+0x6e>
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  80097b:	83 c3 01             	add    $0x1,%ebx
+  80097e:	89 d8                	mov    %ebx,%eax
+  800980:	c1 e0 0f             	shl    $0xf,%eax
+  800983:	39 f0                	cmp    %esi,%eax
+  800985:	72 e1                	jb     800968 <check_bitmap+0x16>
+	assert(!block_is_free(0));
+  800987:	83 ec 0c             	sub    $0xc,%esp
+  80098a:	6a 00                	push   $0x0
+  80098c:	e8 36 fd ff ff       	call   8006c7 <block_is_free>
+  800991:	83 c4 10             	add    $0x10,%esp
+  800994:	85 c0                	test   %eax,%eax
+  800996:	75 3e                	jne    8009d6 <check_bitmap+0x84>
+	assert(!block_is_free(1));
+  800998:	83 ec 0c             	sub    $0xc,%esp
+  80099b:	6a 01                	push   $0x1
+  80099d:	e8 25 fd ff ff       	call   8006c7 <block_is_free>
+  8009a2:	83 c4 10             	add    $0x10,%esp
+  8009a5:	85 c0                	test   %eax,%eax
+  8009a7:	75 43                	jne    8009ec <check_bitmap+0x9a>
+	cprintf("bitmap is good\n");
+  8009a9:	83 ec 0c             	sub    $0xc,%esp
+  8009ac:	68 31 59 80 00       	push   $0x805931
+  8009b1:	e8 f1 13 00 00       	call   801da7 <cprintf>
+}
+  8009b6:	83 c4 10             	add    $0x10,%esp
+  8009b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009bc:	5b                   	pop    %ebx
+  8009bd:	5e                   	pop    %esi
+  8009be:	5d                   	pop    %ebp
+  8009bf:	c3                   	ret
+		assert(!block_is_free(2+i));
+  8009c0:	68 f9 58 80 00       	push   $0x8058f9
+  8009c5:	68 fd 56 80 00       	push   $0x8056fd
+  8009ca:	6a 59                	push   $0x59
+  8009cc:	68 8c 58 80 00       	push   $0x80588c
+  8009d1:	e8 f6 12 00 00       	call   801ccc <_panic>
+	assert(!block_is_free(0));
+  8009d6:	68 0d 59 80 00       	push   $0x80590d
+  8009db:	68 fd 56 80 00       	push   $0x8056fd
+  8009e0:	6a 5c                	push   $0x5c
+  8009e2:	68 8c 58 80 00       	push   $0x80588c
+  8009e7:	e8 e0 12 00 00       	call   801ccc <_panic>
+	assert(!block_is_free(1));
+  8009ec:	68 1f 59 80 00       	push   $0x80591f
+  8009f1:	68 fd 56 80 00       	push   $0x8056fd
+  8009f6:	6a 5d                	push   $0x5d
+  8009f8:	68 8c 58 80 00       	push   $0x80588c
+  8009fd:	e8 ca 12 00 00       	call   801ccc <_panic>
+
+00800a02 <fs_init>:
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	83 ec 08             	sub    $0x8,%esp
+	if (ide_probe_disk1())
+  800a08:	e8 53 f6 ff ff       	call   800060 <ide_probe_disk1>
+  800a0d:	85 c0                	test   %eax,%eax
+  800a0f:	74 41                	je     800a52 <fs_init+0x50>
+		ide_set_disk(1);
+  800a11:	83 ec 0c             	sub    $0xc,%esp
+  800a14:	6a 01                	push   $0x1
+  800a16:	e8 b3 f6 ff ff       	call   8000ce <ide_set_disk>
+  800a1b:	83 c4 10             	add    $0x10,%esp
+	bc_init();
+  800a1e:	e8 16 fc ff ff       	call   800639 <bc_init>
+	super = diskaddr(1);
+  800a23:	83 ec 0c             	sub    $0xc,%esp
+  800a26:	6a 01                	push   $0x1
+  800a28:	e8 63 f9 ff ff       	call   800390 <diskaddr>
+  800a2d:	a3 3c c3 80 00       	mov    %eax,0x80c33c
+	bitmap = diskaddr(2);
+  800a32:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  800a39:	e8 52 f9 ff ff       	call   800390 <diskaddr>
+  800a3e:	a3 38 c3 80 00       	mov    %eax,0x80c338
+	check_super();
+  800a43:	e8 29 fc ff ff       	call   800671 <check_super>
+	check_bitmap();
+  800a48:	e8 05 ff ff ff       	call   800952 <check_bitmap>
+}
+  800a4d:	83 c4 10             	add    $0x10,%esp
+  800a50:	c9                   	leave
+  800a51:	c3                   	ret
+		ide_set_disk(0);
+  800a52:	83 ec 0c             	sub    $0xc,%esp
+  800a55:	6a 00                	push   $0x0
+  800a57:	e8 72 f6 ff ff       	call   8000ce <ide_set_disk>
+  800a5c:	83 c4 10             	add    $0x10,%esp
+  800a5f:	eb bd                	jmp    800a1e <fs_init+0x1c>
+
+00800a61 <file_get_block>:
+{
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	56                   	push   %esi
+  800a65:	53                   	push   %ebx
+  800a66:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 1)) < 0)
+  800a69:	6a 01                	push   $0x1
+  800a6b:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800a6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a74:	e8 44 fd ff ff       	call   8007bd <file_block_walk>
+	if (!*ppdiskbno) {
+  800a79:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  800a7c:	8b 06                	mov    (%esi),%eax
+  800a7e:	83 c4 10             	add    $0x10,%esp
+  800a81:	85 c0                	test   %eax,%eax
+  800a83:	75 4e                	jne    800ad3 <file_get_block+0x72>
+		if ((r = alloc_block()) < 0)
+  800a85:	e8 bc fc ff ff       	call   800746 <alloc_block>
+  800a8a:	89 c3                	mov    %eax,%ebx
+		*ppdiskbno = r;
+  800a8c:	89 06                	mov    %eax,(%esi)
+		memset(diskaddr(r), 0, BLKSIZE);
+  800a8e:	83 ec 0c             	sub    $0xc,%esp
+  800a91:	50                   	push   %eax
+  800a92:	e8 f9 f8 ff ff       	call   800390 <diskaddr>
+  800a97:	83 c4 0c             	add    $0xc,%esp
+  800a9a:	68 00 10 00 00       	push   $0x1000
+  800a9f:	6a 00                	push   $0x0
+  800aa1:	50                   	push   %eax
+  800aa2:	e8 72 1b 00 00       	call   802619 <memset>
+		flush_block(diskaddr(r));
+  800aa7:	89 1c 24             	mov    %ebx,(%esp)
+  800aaa:	e8 e1 f8 ff ff       	call   800390 <diskaddr>
+  800aaf:	89 04 24             	mov    %eax,(%esp)
+  800ab2:	e8 54 f9 ff ff       	call   80040b <flush_block>
+		*blk = diskaddr(r);
+  800ab7:	89 1c 24             	mov    %ebx,(%esp)
+  800aba:	e8 d1 f8 ff ff       	call   800390 <diskaddr>
+		return 0;
+  800abf:	83 c4 10             	add    $0x10,%esp
+		*blk = diskaddr(*ppdiskbno);
+  800ac2:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ac5:	89 02                	mov    %eax,(%edx)
+}
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800acf:	5b                   	pop    %ebx
+  800ad0:	5e                   	pop    %esi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+		*blk = diskaddr(*ppdiskbno);
+  800ad3:	83 ec 0c             	sub    $0xc,%esp
+  800ad6:	50                   	push   %eax
+  800ad7:	e8 b4 f8 ff ff       	call   800390 <diskaddr>
+		return 0;
+  800adc:	83 c4 10             	add    $0x10,%esp
+  800adf:	eb e1                	jmp    800ac2 <file_get_block+0x61>
+
+00800ae1 <walk_path>:
+{
+  800ae1:	55                   	push   %ebp
+  800ae2:	89 e5                	mov    %esp,%ebp
+  800ae4:	57                   	push   %edi
+  800ae5:	56                   	push   %esi
+  800ae6:	53                   	push   %ebx
+  800ae7:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  800aed:	89 95 44 ff ff ff    	mov    %edx,-0xbc(%ebp)
+  800af3:	89 8d 40 ff ff ff    	mov    %ecx,-0xc0(%ebp)
+	while (*p == '/')
+  800af9:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800afc:	75 08                	jne    800b06 <walk_path+0x25>
+		p++;
+  800afe:	83 c0 01             	add    $0x1,%eax
+	while (*p == '/')
+  800b01:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800b04:	74 f8                	je     800afe <walk_path+0x1d>
+	f = &super->s_root;
+  800b06:	8b 0d 3c c3 80 00    	mov    0x80c33c,%ecx
+  800b0c:	83 c1 08             	add    $0x8,%ecx
+  800b0f:	89 8d 50 ff ff ff    	mov    %ecx,-0xb0(%ebp)
+	name[0] = 0;
+  800b15:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+	if (pdir)
+  800b1c:	8b 8d 44 ff ff ff    	mov    -0xbc(%ebp),%ecx
+  800b22:	85 c9                	test   %ecx,%ecx
+  800b24:	74 06                	je     800b2c <walk_path+0x4b>
+		*pdir = 0;
+  800b26:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	*pf = 0;
+  800b2c:	8b 8d 40 ff ff ff    	mov    -0xc0(%ebp),%ecx
+  800b32:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	dir = 0;
+  800b38:	b9 00 00 00 00       	mov    $0x0,%ecx
+		memmove(name, p, path - p);
+  800b3d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	while (*path != '\0') {
+  800b43:	e9 bd 00 00 00       	jmp    800c05 <walk_path+0x124>
+		while (*path != '/' && *path != '\0')
+  800b48:	89 c6                	mov    %eax,%esi
+		if (path - p >= MAXNAMELEN)
+  800b4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b4f:	e9 db 00 00 00       	jmp    800c2f <walk_path+0x14e>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800b54:	68 41 59 80 00       	push   $0x805941
+  800b59:	68 fd 56 80 00       	push   $0x8056fd
+  800b5e:	68 dc 00 00 00       	push   $0xdc
+  800b63:	68 8c 58 80 00       	push   $0x80588c
+  800b68:	e8 5f 11 00 00       	call   801ccc <_panic>
+  800b6d:	8b b5 48 ff ff ff    	mov    -0xb8(%ebp),%esi
+  800b73:	89 c3                	mov    %eax,%ebx
+			if (r == -E_NOT_FOUND && *path == '\0') {
+  800b75:	83 fb f5             	cmp    $0xfffffff5,%ebx
+  800b78:	75 5f                	jne    800bd9 <walk_path+0xf8>
+  800b7a:	80 3e 00             	cmpb   $0x0,(%esi)
+  800b7d:	75 5a                	jne    800bd9 <walk_path+0xf8>
+				if (pdir)
+  800b7f:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+  800b85:	85 c0                	test   %eax,%eax
+  800b87:	74 08                	je     800b91 <walk_path+0xb0>
+					*pdir = dir;
+  800b89:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800b8f:	89 08                	mov    %ecx,(%eax)
+				if (lastelem)
+  800b91:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800b95:	74 15                	je     800bac <walk_path+0xcb>
+					strcpy(lastelem, name);
+  800b97:	83 ec 08             	sub    $0x8,%esp
+  800b9a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800ba0:	50                   	push   %eax
+  800ba1:	ff 75 08             	push   0x8(%ebp)
+  800ba4:	e8 f5 18 00 00       	call   80249e <strcpy>
+  800ba9:	83 c4 10             	add    $0x10,%esp
+				*pf = 0;
+  800bac:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800bb2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  800bb8:	eb 1f                	jmp    800bd9 <walk_path+0xf8>
+	if (pdir)
+  800bba:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+  800bc0:	85 c0                	test   %eax,%eax
+  800bc2:	74 02                	je     800bc6 <walk_path+0xe5>
+		*pdir = dir;
+  800bc4:	89 08                	mov    %ecx,(%eax)
+	*pf = f;
+  800bc6:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800bcc:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800bd2:	89 08                	mov    %ecx,(%eax)
+	return 0;
+  800bd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800bd9:	89 d8                	mov    %ebx,%eax
+  800bdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+			return -E_BAD_PATH;
+  800be3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800be8:	eb ef                	jmp    800bd9 <walk_path+0xf8>
+			return -E_NOT_FOUND;
+  800bea:	bb f5 ff ff ff       	mov    $0xfffffff5,%ebx
+  800bef:	eb e8                	jmp    800bd9 <walk_path+0xf8>
+  800bf1:	8b b5 48 ff ff ff    	mov    -0xb8(%ebp),%esi
+  800bf7:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+			if (strcmp(f[j].f_name, name) == 0) {
+  800bfd:	89 9d 50 ff ff ff    	mov    %ebx,-0xb0(%ebp)
+  800c03:	89 f0                	mov    %esi,%eax
+	while (*path != '\0') {
+  800c05:	0f b6 10             	movzbl (%eax),%edx
+  800c08:	84 d2                	test   %dl,%dl
+  800c0a:	74 ae                	je     800bba <walk_path+0xd9>
+		while (*path != '/' && *path != '\0')
+  800c0c:	80 fa 2f             	cmp    $0x2f,%dl
+  800c0f:	0f 84 33 ff ff ff    	je     800b48 <walk_path+0x67>
+  800c15:	89 c6                	mov    %eax,%esi
+			path++;
+  800c17:	83 c6 01             	add    $0x1,%esi
+		while (*path != '/' && *path != '\0')
+  800c1a:	0f b6 16             	movzbl (%esi),%edx
+  800c1d:	80 fa 2f             	cmp    $0x2f,%dl
+  800c20:	74 04                	je     800c26 <walk_path+0x145>
+  800c22:	84 d2                	test   %dl,%dl
+  800c24:	75 f1                	jne    800c17 <walk_path+0x136>
+		if (path - p >= MAXNAMELEN)
+  800c26:	89 f3                	mov    %esi,%ebx
+  800c28:	29 c3                	sub    %eax,%ebx
+  800c2a:	83 fb 7f             	cmp    $0x7f,%ebx
+  800c2d:	7f b4                	jg     800be3 <walk_path+0x102>
+		memmove(name, p, path - p);
+  800c2f:	83 ec 04             	sub    $0x4,%esp
+  800c32:	53                   	push   %ebx
+  800c33:	50                   	push   %eax
+  800c34:	57                   	push   %edi
+  800c35:	e8 14 1a 00 00       	call   80264e <memmove>
+		name[path - p] = '\0';
+  800c3a:	c6 84 1d 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%ebx,1)
+  800c41:	00 
+	while (*p == '/')
+  800c42:	83 c4 10             	add    $0x10,%esp
+  800c45:	80 3e 2f             	cmpb   $0x2f,(%esi)
+  800c48:	75 08                	jne    800c52 <walk_path+0x171>
+		p++;
+  800c4a:	83 c6 01             	add    $0x1,%esi
+	while (*p == '/')
+  800c4d:	80 3e 2f             	cmpb   $0x2f,(%esi)
+  800c50:	74 f8                	je     800c4a <walk_path+0x169>
+		if (dir->f_type != FTYPE_DIR)
+  800c52:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  800c58:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  800c5f:	75 89                	jne    800bea <walk_path+0x109>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800c61:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  800c67:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  800c6d:	0f 85 e1 fe ff ff    	jne    800b54 <walk_path+0x73>
+	nblock = dir->f_size / BLKSIZE;
+  800c73:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  800c79:	85 d2                	test   %edx,%edx
+  800c7b:	0f 49 c2             	cmovns %edx,%eax
+	for (i = 0; i < nblock; i++) {
+  800c7e:	c1 f8 0c             	sar    $0xc,%eax
+  800c81:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800c87:	74 7c                	je     800d05 <walk_path+0x224>
+  800c89:	c7 85 54 ff ff ff 00 	movl   $0x0,-0xac(%ebp)
+  800c90:	00 00 00 
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  800c93:	89 b5 48 ff ff ff    	mov    %esi,-0xb8(%ebp)
+  800c99:	83 ec 04             	sub    $0x4,%esp
+  800c9c:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  800ca2:	50                   	push   %eax
+  800ca3:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  800ca9:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  800caf:	e8 ad fd ff ff       	call   800a61 <file_get_block>
+  800cb4:	83 c4 10             	add    $0x10,%esp
+  800cb7:	85 c0                	test   %eax,%eax
+  800cb9:	0f 88 ae fe ff ff    	js     800b6d <walk_path+0x8c>
+		for (j = 0; j < BLKFILES; j++)
+  800cbf:	8b 9d 64 ff ff ff    	mov    -0x9c(%ebp),%ebx
+  800cc5:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+			if (strcmp(f[j].f_name, name) == 0) {
+  800ccb:	83 ec 08             	sub    $0x8,%esp
+  800cce:	57                   	push   %edi
+  800ccf:	53                   	push   %ebx
+  800cd0:	e8 79 18 00 00       	call   80254e <strcmp>
+  800cd5:	83 c4 10             	add    $0x10,%esp
+  800cd8:	85 c0                	test   %eax,%eax
+  800cda:	0f 84 11 ff ff ff    	je     800bf1 <walk_path+0x110>
+		for (j = 0; j < BLKFILES; j++)
+  800ce0:	81 c3 00 01 00 00    	add    $0x100,%ebx
+  800ce6:	39 f3                	cmp    %esi,%ebx
+  800ce8:	75 e1                	jne    800ccb <walk_path+0x1ea>
+	for (i = 0; i < nblock; i++) {
+  800cea:	83 85 54 ff ff ff 01 	addl   $0x1,-0xac(%ebp)
+  800cf1:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  800cf7:	39 85 4c ff ff ff    	cmp    %eax,-0xb4(%ebp)
+  800cfd:	75 9a                	jne    800c99 <walk_path+0x1b8>
+  800cff:	8b b5 48 ff ff ff    	mov    -0xb8(%ebp),%esi
+  800d05:	bb f5 ff ff ff       	mov    $0xfffffff5,%ebx
+  800d0a:	e9 66 fe ff ff       	jmp    800b75 <walk_path+0x94>
+
+00800d0f <file_open>:
+{
+  800d0f:	55                   	push   %ebp
+  800d10:	89 e5                	mov    %esp,%ebp
+  800d12:	83 ec 14             	sub    $0x14,%esp
+	return walk_path(path, 0, pf, 0);
+  800d15:	6a 00                	push   $0x0
+  800d17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d22:	e8 ba fd ff ff       	call   800ae1 <walk_path>
+}
+  800d27:	c9                   	leave
+  800d28:	c3                   	ret
+
+00800d29 <file_read>:
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+  800d2f:	83 ec 2c             	sub    $0x2c,%esp
+  800d32:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800d38:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset >= f->f_size)
+  800d3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3e:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+		return 0;
+  800d44:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (offset >= f->f_size)
+  800d49:	39 da                	cmp    %ebx,%edx
+  800d4b:	0f 8e 85 00 00 00    	jle    800dd6 <file_read+0xad>
+	count = MIN(count, f->f_size - offset);
+  800d51:	29 da                	sub    %ebx,%edx
+  800d53:	39 ca                	cmp    %ecx,%edx
+  800d55:	0f 46 ca             	cmovbe %edx,%ecx
+  800d58:	89 ce                	mov    %ecx,%esi
+	for (pos = offset; pos < offset + count; ) {
+  800d5a:	8d 0c 19             	lea    (%ecx,%ebx,1),%ecx
+  800d5d:	39 cb                	cmp    %ecx,%ebx
+  800d5f:	73 73                	jae    800dd4 <file_read+0xab>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800d61:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  800d64:	89 de                	mov    %ebx,%esi
+  800d66:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800d69:	83 ec 04             	sub    $0x4,%esp
+  800d6c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800d6f:	50                   	push   %eax
+  800d70:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800d76:	85 db                	test   %ebx,%ebx
+  800d78:	0f 49 c3             	cmovns %ebx,%eax
+  800d7b:	c1 f8 0c             	sar    $0xc,%eax
+  800d7e:	50                   	push   %eax
+  800d7f:	ff 75 08             	push   0x8(%ebp)
+  800d82:	e8 da fc ff ff       	call   800a61 <file_get_block>
+  800d87:	83 c4 10             	add    $0x10,%esp
+  800d8a:	85 c0                	test   %eax,%eax
+  800d8c:	78 48                	js     800dd6 <file_read+0xad>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800d8e:	89 da                	mov    %ebx,%edx
+  800d90:	c1 fa 1f             	sar    $0x1f,%edx
+  800d93:	c1 ea 14             	shr    $0x14,%edx
+  800d96:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800d99:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800d9e:	29 d0                	sub    %edx,%eax
+  800da0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800da5:	29 c1                	sub    %eax,%ecx
+  800da7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800daa:	29 f2                	sub    %esi,%edx
+  800dac:	39 d1                	cmp    %edx,%ecx
+  800dae:	89 d6                	mov    %edx,%esi
+  800db0:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(buf, blk + pos % BLKSIZE, bn);
+  800db3:	83 ec 04             	sub    $0x4,%esp
+  800db6:	56                   	push   %esi
+  800db7:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800dba:	50                   	push   %eax
+  800dbb:	57                   	push   %edi
+  800dbc:	e8 8d 18 00 00       	call   80264e <memmove>
+		pos += bn;
+  800dc1:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  800dc3:	01 f7                	add    %esi,%edi
+	for (pos = offset; pos < offset + count; ) {
+  800dc5:	89 de                	mov    %ebx,%esi
+  800dc7:	83 c4 10             	add    $0x10,%esp
+  800dca:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800dcd:	39 d3                	cmp    %edx,%ebx
+  800dcf:	72 98                	jb     800d69 <file_read+0x40>
+  800dd1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+	return count;
+  800dd4:	89 f0                	mov    %esi,%eax
+}
+  800dd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd9:	5b                   	pop    %ebx
+  800dda:	5e                   	pop    %esi
+  800ddb:	5f                   	pop    %edi
+  800ddc:	5d                   	pop    %ebp
+  800ddd:	c3                   	ret
+
+00800dde <file_set_size>:
+
+// Set the size of file f, truncating or extending as necessary.
+int
+file_set_size(struct File *f, off_t newsize)
+{
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	56                   	push   %esi
+  800de2:	53                   	push   %ebx
+  800de3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800de6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (f->f_size > newsize)
+  800de9:	39 b3 80 00 00 00    	cmp    %esi,0x80(%ebx)
+  800def:	7f 22                	jg     800e13 <file_set_size+0x35>
+		file_truncate_blocks(f, newsize);
+	f->f_size = newsize;
+  800df1:	89 b3 80 00 00 00    	mov    %esi,0x80(%ebx)
+	file_touch(f);
+  800df7:	89 d8                	mov    %ebx,%eax
+  800df9:	e8 55 f8 ff ff       	call   800653 <file_touch>
+	flush_block(f);
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+  800e01:	53                   	push   %ebx
+  800e02:	e8 04 f6 ff ff       	call   80040b <flush_block>
+	return 0;
+}
+  800e07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+		file_truncate_blocks(f, newsize);
+  800e13:	89 f2                	mov    %esi,%edx
+  800e15:	89 d8                	mov    %ebx,%eax
+  800e17:	e8 6d fa ff ff       	call   800889 <file_truncate_blocks>
+  800e1c:	eb d3                	jmp    800df1 <file_set_size+0x13>
+
+00800e1e <file_write>:
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	57                   	push   %edi
+  800e22:	56                   	push   %esi
+  800e23:	53                   	push   %ebx
+  800e24:	83 ec 2c             	sub    $0x2c,%esp
+  800e27:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset + count > f->f_size)
+  800e2a:	89 de                	mov    %ebx,%esi
+  800e2c:	89 df                	mov    %ebx,%edi
+  800e2e:	03 7d 10             	add    0x10(%ebp),%edi
+  800e31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e34:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  800e3a:	0f 82 85 00 00 00    	jb     800ec5 <file_write+0xa7>
+	for (pos = offset; pos < offset + count; ) {
+  800e40:	39 fe                	cmp    %edi,%esi
+  800e42:	73 6e                	jae    800eb2 <file_write+0x94>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800e44:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  800e47:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800e4a:	83 ec 04             	sub    $0x4,%esp
+  800e4d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800e50:	50                   	push   %eax
+  800e51:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800e57:	85 db                	test   %ebx,%ebx
+  800e59:	0f 49 c3             	cmovns %ebx,%eax
+  800e5c:	c1 f8 0c             	sar    $0xc,%eax
+  800e5f:	50                   	push   %eax
+  800e60:	ff 75 08             	push   0x8(%ebp)
+  800e63:	e8 f9 fb ff ff       	call   800a61 <file_get_block>
+  800e68:	83 c4 10             	add    $0x10,%esp
+  800e6b:	85 c0                	test   %eax,%eax
+  800e6d:	78 4e                	js     800ebd <file_write+0x9f>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800e6f:	89 da                	mov    %ebx,%edx
+  800e71:	c1 fa 1f             	sar    $0x1f,%edx
+  800e74:	c1 ea 14             	shr    $0x14,%edx
+  800e77:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800e7a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800e7f:	29 d0                	sub    %edx,%eax
+  800e81:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e86:	29 c1                	sub    %eax,%ecx
+  800e88:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800e8b:	29 f2                	sub    %esi,%edx
+  800e8d:	39 d1                	cmp    %edx,%ecx
+  800e8f:	89 d6                	mov    %edx,%esi
+  800e91:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  800e94:	83 ec 04             	sub    $0x4,%esp
+  800e97:	56                   	push   %esi
+  800e98:	57                   	push   %edi
+  800e99:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800e9c:	50                   	push   %eax
+  800e9d:	e8 ac 17 00 00       	call   80264e <memmove>
+		pos += bn;
+  800ea2:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  800ea4:	01 f7                	add    %esi,%edi
+	for (pos = offset; pos < offset + count; ) {
+  800ea6:	89 de                	mov    %ebx,%esi
+  800ea8:	83 c4 10             	add    $0x10,%esp
+  800eab:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800eae:	39 d3                	cmp    %edx,%ebx
+  800eb0:	72 98                	jb     800e4a <file_write+0x2c>
+	file_touch(f);
+  800eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb5:	e8 99 f7 ff ff       	call   800653 <file_touch>
+	return count;
+  800eba:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  800ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+		if ((r = file_set_size(f, offset + count)) < 0)
+  800ec5:	83 ec 08             	sub    $0x8,%esp
+  800ec8:	57                   	push   %edi
+  800ec9:	50                   	push   %eax
+  800eca:	e8 0f ff ff ff       	call   800dde <file_set_size>
+  800ecf:	83 c4 10             	add    $0x10,%esp
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	0f 89 66 ff ff ff    	jns    800e40 <file_write+0x22>
+  800eda:	eb e1                	jmp    800ebd <file_write+0x9f>
+
+00800edc <file_flush>:
+// Loop over all the blocks in file.
+// Translate the file block number into a disk block number
+// and then check whether that disk block is dirty.  If so, write it out.
+void
+file_flush(struct File *f)
+{
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	56                   	push   %esi
+  800ee0:	53                   	push   %ebx
+  800ee1:	83 ec 10             	sub    $0x10,%esp
+  800ee4:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i;
+	uint32_t *pdiskbno;
+
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
+  800ee7:	83 be 80 00 00 00 00 	cmpl   $0x0,0x80(%esi)
+  800eee:	7e 61                	jle    800f51 <file_flush+0x75>
+  800ef0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef5:	eb 1f                	jmp    800f16 <file_flush+0x3a>
+  800ef7:	83 c3 01             	add    $0x1,%ebx
+  800efa:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+  800f00:	8d 82 fe 1f 00 00    	lea    0x1ffe(%edx),%eax
+  800f06:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  800f0c:	0f 49 c2             	cmovns %edx,%eax
+  800f0f:	c1 f8 0c             	sar    $0xc,%eax
+  800f12:	39 d8                	cmp    %ebx,%eax
+  800f14:	7e 3b                	jle    800f51 <file_flush+0x75>
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+  800f19:	6a 00                	push   $0x0
+  800f1b:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800f1e:	89 da                	mov    %ebx,%edx
+  800f20:	89 f0                	mov    %esi,%eax
+  800f22:	e8 96 f8 ff ff       	call   8007bd <file_block_walk>
+  800f27:	83 c4 10             	add    $0x10,%esp
+  800f2a:	85 c0                	test   %eax,%eax
+  800f2c:	78 c9                	js     800ef7 <file_flush+0x1b>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  800f2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	74 c2                	je     800ef7 <file_flush+0x1b>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  800f35:	8b 00                	mov    (%eax),%eax
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	74 bc                	je     800ef7 <file_flush+0x1b>
+			continue;
+		flush_block(diskaddr(*pdiskbno));
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+  800f3e:	50                   	push   %eax
+  800f3f:	e8 4c f4 ff ff       	call   800390 <diskaddr>
+  800f44:	89 04 24             	mov    %eax,(%esp)
+  800f47:	e8 bf f4 ff ff       	call   80040b <flush_block>
+  800f4c:	83 c4 10             	add    $0x10,%esp
+  800f4f:	eb a6                	jmp    800ef7 <file_flush+0x1b>
+	}
+	flush_block(f);
+  800f51:	83 ec 0c             	sub    $0xc,%esp
+  800f54:	56                   	push   %esi
+  800f55:	e8 b1 f4 ff ff       	call   80040b <flush_block>
+	if (f->f_indirect)
+  800f5a:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  800f60:	83 c4 10             	add    $0x10,%esp
+  800f63:	85 c0                	test   %eax,%eax
+  800f65:	75 07                	jne    800f6e <file_flush+0x92>
+		flush_block(diskaddr(f->f_indirect));
+}
+  800f67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f6a:	5b                   	pop    %ebx
+  800f6b:	5e                   	pop    %esi
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+		flush_block(diskaddr(f->f_indirect));
+  800f6e:	83 ec 0c             	sub    $0xc,%esp
+  800f71:	50                   	push   %eax
+  800f72:	e8 19 f4 ff ff       	call   800390 <diskaddr>
+  800f77:	89 04 24             	mov    %eax,(%esp)
+  800f7a:	e8 8c f4 ff ff       	call   80040b <flush_block>
+  800f7f:	83 c4 10             	add    $0x10,%esp
+}
+  800f82:	eb e3                	jmp    800f67 <file_flush+0x8b>
+
+00800f84 <file_create>:
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  800f8a:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  800f90:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800f96:	50                   	push   %eax
+  800f97:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  800f9d:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  800fa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa6:	e8 36 fb ff ff       	call   800ae1 <walk_path>
+  800fab:	83 c4 10             	add    $0x10,%esp
+  800fae:	85 c0                	test   %eax,%eax
+  800fb0:	0f 84 d2 00 00 00    	je     801088 <file_create+0x104>
+  800fb6:	89 c3                	mov    %eax,%ebx
+	if (r != -E_NOT_FOUND || dir == 0)
+  800fb8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  800fbb:	0f 85 fd 00 00 00    	jne    8010be <file_create+0x13a>
+  800fc1:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  800fc7:	85 ff                	test   %edi,%edi
+  800fc9:	0f 84 ef 00 00 00    	je     8010be <file_create+0x13a>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800fcf:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  800fd5:	89 c3                	mov    %eax,%ebx
+  800fd7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  800fdd:	75 5a                	jne    801039 <file_create+0xb5>
+	nblock = dir->f_size / BLKSIZE;
+  800fdf:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800fe5:	85 c0                	test   %eax,%eax
+  800fe7:	0f 48 c2             	cmovs  %edx,%eax
+	for (i = 0; i < nblock; i++) {
+  800fea:	c1 f8 0c             	sar    $0xc,%eax
+  800fed:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  800ff3:	74 5d                	je     801052 <file_create+0xce>
+  800ff5:	be 00 00 00 00       	mov    $0x0,%esi
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  800ffa:	83 ec 04             	sub    $0x4,%esp
+  800ffd:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  801003:	50                   	push   %eax
+  801004:	56                   	push   %esi
+  801005:	57                   	push   %edi
+  801006:	e8 56 fa ff ff       	call   800a61 <file_get_block>
+  80100b:	83 c4 10             	add    $0x10,%esp
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	78 72                	js     801084 <file_create+0x100>
+		for (j = 0; j < BLKFILES; j++)
+  801012:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  801018:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+			if (f[j].f_name[0] == '\0') {
+  80101e:	80 38 00             	cmpb   $0x0,(%eax)
+  801021:	74 6c                	je     80108f <file_create+0x10b>
+		for (j = 0; j < BLKFILES; j++)
+  801023:	05 00 01 00 00       	add    $0x100,%eax
+  801028:	39 d0                	cmp    %edx,%eax
+  80102a:	75 f2                	jne    80101e <file_create+0x9a>
+	for (i = 0; i < nblock; i++) {
+  80102c:	83 c6 01             	add    $0x1,%esi
+  80102f:	39 b5 54 ff ff ff    	cmp    %esi,-0xac(%ebp)
+  801035:	75 c3                	jne    800ffa <file_create+0x76>
+  801037:	eb 21                	jmp    80105a <file_create+0xd6>
+	assert((dir->f_size % BLKSIZE) == 0);
+  801039:	68 41 59 80 00       	push   $0x805941
+  80103e:	68 fd 56 80 00       	push   $0x8056fd
+  801043:	68 f5 00 00 00       	push   $0xf5
+  801048:	68 8c 58 80 00       	push   $0x80588c
+  80104d:	e8 7a 0c 00 00       	call   801ccc <_panic>
+	for (i = 0; i < nblock; i++) {
+  801052:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  801058:	89 c6                	mov    %eax,%esi
+	dir->f_size += BLKSIZE;
+  80105a:	81 87 80 00 00 00 00 	addl   $0x1000,0x80(%edi)
+  801061:	10 00 00 
+	if ((r = file_get_block(dir, i, &blk)) < 0)
+  801064:	83 ec 04             	sub    $0x4,%esp
+  801067:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80106d:	50                   	push   %eax
+  80106e:	56                   	push   %esi
+  80106f:	57                   	push   %edi
+  801070:	e8 ec f9 ff ff       	call   800a61 <file_get_block>
+  801075:	83 c4 10             	add    $0x10,%esp
+  801078:	85 c0                	test   %eax,%eax
+  80107a:	78 4c                	js     8010c8 <file_create+0x144>
+	f = (struct File*) blk;
+  80107c:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+	return 0;
+  801082:	eb 0d                	jmp    801091 <file_create+0x10d>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  801084:	89 c3                	mov    %eax,%ebx
+  801086:	eb 36                	jmp    8010be <file_create+0x13a>
+		return -E_FILE_EXISTS;
+  801088:	bb f3 ff ff ff       	mov    $0xfffffff3,%ebx
+  80108d:	eb 2f                	jmp    8010be <file_create+0x13a>
+  80108f:	89 c6                	mov    %eax,%esi
+	*file = &f[0];
+  801091:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+	strcpy(f->f_name, name);
+  801097:	83 ec 08             	sub    $0x8,%esp
+  80109a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8010a0:	50                   	push   %eax
+  8010a1:	56                   	push   %esi
+  8010a2:	e8 f7 13 00 00       	call   80249e <strcpy>
+	file_touch(f);
+  8010a7:	89 f0                	mov    %esi,%eax
+  8010a9:	e8 a5 f5 ff ff       	call   800653 <file_touch>
+	*pf = f;
+  8010ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010b1:	89 30                	mov    %esi,(%eax)
+	file_flush(dir);
+  8010b3:	89 3c 24             	mov    %edi,(%esp)
+  8010b6:	e8 21 fe ff ff       	call   800edc <file_flush>
+	return 0;
+  8010bb:	83 c4 10             	add    $0x10,%esp
+}
+  8010be:	89 d8                	mov    %ebx,%eax
+  8010c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c3:	5b                   	pop    %ebx
+  8010c4:	5e                   	pop    %esi
+  8010c5:	5f                   	pop    %edi
+  8010c6:	5d                   	pop    %ebp
+  8010c7:	c3                   	ret
+		return r;
+  8010c8:	89 c3                	mov    %eax,%ebx
+  8010ca:	eb f2                	jmp    8010be <file_create+0x13a>
+
+008010cc <file_remove>:
+
+// Remove a file by truncating it and then zeroing the name.
+int
+file_remove(const char *path)
+{
+  8010cc:	55                   	push   %ebp
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	53                   	push   %ebx
+  8010d0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct File *f;
+
+	if ((r = walk_path(path, 0, &f, 0)) < 0)
+  8010d3:	6a 00                	push   $0x0
+  8010d5:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8010d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e0:	e8 fc f9 ff ff       	call   800ae1 <walk_path>
+  8010e5:	83 c4 10             	add    $0x10,%esp
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	78 34                	js     801120 <file_remove+0x54>
+		return r;
+
+	file_truncate_blocks(f, 0);
+  8010ec:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  8010ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f4:	89 d8                	mov    %ebx,%eax
+  8010f6:	e8 8e f7 ff ff       	call   800889 <file_truncate_blocks>
+	f->f_name[0] = '\0';
+  8010fb:	c6 03 00             	movb   $0x0,(%ebx)
+	f->f_size = 0;
+  8010fe:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801105:	00 00 00 
+	file_touch(f);
+  801108:	89 d8                	mov    %ebx,%eax
+  80110a:	e8 44 f5 ff ff       	call   800653 <file_touch>
+	flush_block(f);
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+  801112:	53                   	push   %ebx
+  801113:	e8 f3 f2 ff ff       	call   80040b <flush_block>
+
+	return 0;
+  801118:	83 c4 10             	add    $0x10,%esp
+  80111b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801123:	c9                   	leave
+  801124:	c3                   	ret
+
+00801125 <fs_sync>:
+// Sync the entire file system.  A big hammer.
+void
+fs_sync(void)
+{
+	int i;
+	for (i = 1; i < super->s_nblocks; i++)
+  801125:	a1 3c c3 80 00       	mov    0x80c33c,%eax
+  80112a:	83 78 04 01          	cmpl   $0x1,0x4(%eax)
+  80112e:	76 32                	jbe    801162 <fs_sync+0x3d>
+{
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	53                   	push   %ebx
+  801134:	83 ec 04             	sub    $0x4,%esp
+	for (i = 1; i < super->s_nblocks; i++)
+  801137:	bb 01 00 00 00       	mov    $0x1,%ebx
+		flush_block(diskaddr(i));
+  80113c:	83 ec 0c             	sub    $0xc,%esp
+  80113f:	53                   	push   %ebx
+  801140:	e8 4b f2 ff ff       	call   800390 <diskaddr>
+  801145:	89 04 24             	mov    %eax,(%esp)
+  801148:	e8 be f2 ff ff       	call   80040b <flush_block>
+	for (i = 1; i < super->s_nblocks; i++)
+  80114d:	83 c3 01             	add    $0x1,%ebx
+  801150:	83 c4 10             	add    $0x10,%esp
+  801153:	a1 3c c3 80 00       	mov    0x80c33c,%eax
+  801158:	3b 58 04             	cmp    0x4(%eax),%ebx
+  80115b:	72 df                	jb     80113c <fs_sync+0x17>
+}
+  80115d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801160:	c9                   	leave
+  801161:	c3                   	ret
+  801162:	c3                   	ret
+
+00801163 <serve_remove>:
+}
+
+// Remove the file req->req_path.
+int
+serve_remove(envid_t envid, struct Fsreq_remove *req)
+{
+  801163:	55                   	push   %ebp
+  801164:	89 e5                	mov    %esp,%ebp
+  801166:	53                   	push   %ebx
+  801167:	81 ec 08 04 00 00    	sub    $0x408,%esp
+
+	// Delete the named file.
+	// Note: This request doesn't refer to an open file.
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+  80116d:	68 00 04 00 00       	push   $0x400
+  801172:	ff 75 0c             	push   0xc(%ebp)
+  801175:	8d 9d f8 fb ff ff    	lea    -0x408(%ebp),%ebx
+  80117b:	53                   	push   %ebx
+  80117c:	e8 cd 14 00 00       	call   80264e <memmove>
+	path[MAXPATHLEN-1] = 0;
+  801181:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+
+	// Delete the specified file
+	return file_remove(path);
+  801185:	89 1c 24             	mov    %ebx,(%esp)
+  801188:	e8 3f ff ff ff       	call   8010cc <file_remove>
+}
+  80118d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801190:	c9                   	leave
+  801191:	c3                   	ret
+
+00801192 <serve_sync>:
+}
+
+// Sync the file system.
+int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	83 ec 08             	sub    $0x8,%esp
+	fs_sync();
+  801198:	e8 88 ff ff ff       	call   801125 <fs_sync>
+	return 0;
+}
+  80119d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a2:	c9                   	leave
+  8011a3:	c3                   	ret
+
+008011a4 <serve_init>:
+	for (i = 0; i < MAXOPEN; i++) {
+  8011a4:	ba 60 70 80 00       	mov    $0x807060,%edx
+	uintptr_t va = FILEVA;
+  8011a9:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+	for (i = 0; i < MAXOPEN; i++) {
+  8011ae:	b8 00 00 00 00       	mov    $0x0,%eax
+		opentab[i].o_fileid = i;
+  8011b3:	89 02                	mov    %eax,(%edx)
+		opentab[i].o_fd = (struct Fd*) va;
+  8011b5:	89 4a 0c             	mov    %ecx,0xc(%edx)
+		va += PGSIZE;
+  8011b8:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+	for (i = 0; i < MAXOPEN; i++) {
+  8011be:	83 c0 01             	add    $0x1,%eax
+  8011c1:	83 c2 10             	add    $0x10,%edx
+  8011c4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8011c9:	75 e8                	jne    8011b3 <serve_init+0xf>
+}
+  8011cb:	c3                   	ret
+
+008011cc <openfile_alloc>:
+{
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	57                   	push   %edi
+  8011d0:	56                   	push   %esi
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 0c             	sub    $0xc,%esp
+  8011d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (i = 0; i < MAXOPEN; i++) {
+  8011d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch (pageref(opentab[i].o_fd)) {
+  8011dd:	89 de                	mov    %ebx,%esi
+  8011df:	c1 e6 04             	shl    $0x4,%esi
+  8011e2:	83 ec 0c             	sub    $0xc,%esp
+  8011e5:	ff b6 6c 70 80 00    	push   0x80706c(%esi)
+  8011eb:	e8 53 28 00 00       	call   803a43 <pageref>
+  8011f0:	83 c4 10             	add    $0x10,%esp
+  8011f3:	85 c0                	test   %eax,%eax
+  8011f5:	74 17                	je     80120e <openfile_alloc+0x42>
+  8011f7:	83 f8 01             	cmp    $0x1,%eax
+  8011fa:	74 33                	je     80122f <openfile_alloc+0x63>
+	for (i = 0; i < MAXOPEN; i++) {
+  8011fc:	83 c3 01             	add    $0x1,%ebx
+  8011ff:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  801205:	75 d6                	jne    8011dd <openfile_alloc+0x11>
+	return -E_MAX_OPEN;
+  801207:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80120c:	eb 52                	jmp    801260 <openfile_alloc+0x94>
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80120e:	83 ec 04             	sub    $0x4,%esp
+  801211:	68 07 04 00 00       	push   $0x407
+  801216:	89 d8                	mov    %ebx,%eax
+  801218:	c1 e0 04             	shl    $0x4,%eax
+  80121b:	ff b0 6c 70 80 00    	push   0x80706c(%eax)
+  801221:	6a 00                	push   $0x0
+  801223:	e8 aa 16 00 00       	call   8028d2 <sys_page_alloc>
+  801228:	83 c4 10             	add    $0x10,%esp
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	78 31                	js     801260 <openfile_alloc+0x94>
+			opentab[i].o_fileid += MAXOPEN;
+  80122f:	c1 e3 04             	shl    $0x4,%ebx
+  801232:	81 83 60 70 80 00 00 	addl   $0x400,0x807060(%ebx)
+  801239:	04 00 00 
+			*o = &opentab[i];
+  80123c:	81 c6 60 70 80 00    	add    $0x807060,%esi
+  801242:	89 37                	mov    %esi,(%edi)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  801244:	83 ec 04             	sub    $0x4,%esp
+  801247:	68 00 10 00 00       	push   $0x1000
+  80124c:	6a 00                	push   $0x0
+  80124e:	ff b3 6c 70 80 00    	push   0x80706c(%ebx)
+  801254:	e8 c0 13 00 00       	call   802619 <memset>
+			return (*o)->o_fileid;
+  801259:	8b 07                	mov    (%edi),%eax
+  80125b:	8b 00                	mov    (%eax),%eax
+  80125d:	83 c4 10             	add    $0x10,%esp
+}
+  801260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801263:	5b                   	pop    %ebx
+  801264:	5e                   	pop    %esi
+  801265:	5f                   	pop    %edi
+  801266:	5d                   	pop    %ebp
+  801267:	c3                   	ret
+
+00801268 <openfile_lookup>:
+{
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+  80126e:	83 ec 18             	sub    $0x18,%esp
+  801271:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	o = &opentab[fileid % MAXOPEN];
+  801274:	89 fb                	mov    %edi,%ebx
+  801276:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80127c:	89 de                	mov    %ebx,%esi
+  80127e:	c1 e6 04             	shl    $0x4,%esi
+	if (pageref(o->o_fd) == 1 || o->o_fileid != fileid)
+  801281:	ff b6 6c 70 80 00    	push   0x80706c(%esi)
+	o = &opentab[fileid % MAXOPEN];
+  801287:	81 c6 60 70 80 00    	add    $0x807060,%esi
+	if (pageref(o->o_fd) == 1 || o->o_fileid != fileid)
+  80128d:	e8 b1 27 00 00       	call   803a43 <pageref>
+  801292:	83 c4 10             	add    $0x10,%esp
+  801295:	83 f8 01             	cmp    $0x1,%eax
+  801298:	74 1d                	je     8012b7 <openfile_lookup+0x4f>
+  80129a:	c1 e3 04             	shl    $0x4,%ebx
+  80129d:	39 bb 60 70 80 00    	cmp    %edi,0x807060(%ebx)
+  8012a3:	75 19                	jne    8012be <openfile_lookup+0x56>
+	*po = o;
+  8012a5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8012a8:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8012aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b2:	5b                   	pop    %ebx
+  8012b3:	5e                   	pop    %esi
+  8012b4:	5f                   	pop    %edi
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+		return -E_INVAL;
+  8012b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012bc:	eb f1                	jmp    8012af <openfile_lookup+0x47>
+  8012be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012c3:	eb ea                	jmp    8012af <openfile_lookup+0x47>
+
+008012c5 <serve_set_size>:
+{
+  8012c5:	55                   	push   %ebp
+  8012c6:	89 e5                	mov    %esp,%ebp
+  8012c8:	53                   	push   %ebx
+  8012c9:	83 ec 18             	sub    $0x18,%esp
+  8012cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8012cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012d2:	50                   	push   %eax
+  8012d3:	ff 33                	push   (%ebx)
+  8012d5:	ff 75 08             	push   0x8(%ebp)
+  8012d8:	e8 8b ff ff ff       	call   801268 <openfile_lookup>
+  8012dd:	83 c4 10             	add    $0x10,%esp
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	78 14                	js     8012f8 <serve_set_size+0x33>
+	return file_set_size(o->o_file, req->req_size);
+  8012e4:	83 ec 08             	sub    $0x8,%esp
+  8012e7:	ff 73 04             	push   0x4(%ebx)
+  8012ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012ed:	ff 70 04             	push   0x4(%eax)
+  8012f0:	e8 e9 fa ff ff       	call   800dde <file_set_size>
+  8012f5:	83 c4 10             	add    $0x10,%esp
+}
+  8012f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012fb:	c9                   	leave
+  8012fc:	c3                   	ret
+
+008012fd <serve_read>:
+{
+  8012fd:	55                   	push   %ebp
+  8012fe:	89 e5                	mov    %esp,%ebp
+  801300:	56                   	push   %esi
+  801301:	53                   	push   %ebx
+  801302:	83 ec 14             	sub    $0x14,%esp
+  801305:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801308:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80130b:	50                   	push   %eax
+  80130c:	ff 33                	push   (%ebx)
+  80130e:	ff 75 08             	push   0x8(%ebp)
+  801311:	e8 52 ff ff ff       	call   801268 <openfile_lookup>
+  801316:	83 c4 10             	add    $0x10,%esp
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	78 2d                	js     80134a <serve_read+0x4d>
+	if((r = file_read(o->o_file, ret->ret_buf, count, o->o_fd->fd_offset)) < 0)
+  80131d:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801320:	8b 46 0c             	mov    0xc(%esi),%eax
+  801323:	ff 70 04             	push   0x4(%eax)
+	count = (req->req_n > PGSIZE) ? PGSIZE : req->req_n; 
+  801326:	8b 43 04             	mov    0x4(%ebx),%eax
+  801329:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80132e:	39 d0                	cmp    %edx,%eax
+  801330:	0f 47 c2             	cmova  %edx,%eax
+	if((r = file_read(o->o_file, ret->ret_buf, count, o->o_fd->fd_offset)) < 0)
+  801333:	50                   	push   %eax
+  801334:	53                   	push   %ebx
+  801335:	ff 76 04             	push   0x4(%esi)
+  801338:	e8 ec f9 ff ff       	call   800d29 <file_read>
+  80133d:	83 c4 10             	add    $0x10,%esp
+  801340:	85 c0                	test   %eax,%eax
+  801342:	78 06                	js     80134a <serve_read+0x4d>
+	o->o_fd->fd_offset += r;
+  801344:	8b 56 0c             	mov    0xc(%esi),%edx
+  801347:	01 42 04             	add    %eax,0x4(%edx)
+}
+  80134a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+
+00801351 <serve_write>:
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	57                   	push   %edi
+  801355:	56                   	push   %esi
+  801356:	53                   	push   %ebx
+  801357:	83 ec 20             	sub    $0x20,%esp
+  80135a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80135d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801360:	50                   	push   %eax
+  801361:	ff 33                	push   (%ebx)
+  801363:	ff 75 08             	push   0x8(%ebp)
+  801366:	e8 fd fe ff ff       	call   801268 <openfile_lookup>
+  80136b:	83 c4 10             	add    $0x10,%esp
+  80136e:	85 c0                	test   %eax,%eax
+  801370:	78 26                	js     801398 <serve_write+0x47>
+	count = req->req_n;
+  801372:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if((r = file_write(o->o_file, req->req_buf, count, o->o_fd->fd_offset)) < 0)
+  801375:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801378:	8b 46 0c             	mov    0xc(%esi),%eax
+  80137b:	ff 70 04             	push   0x4(%eax)
+  80137e:	57                   	push   %edi
+  80137f:	83 c3 08             	add    $0x8,%ebx
+  801382:	53                   	push   %ebx
+  801383:	ff 76 04             	push   0x4(%esi)
+  801386:	e8 93 fa ff ff       	call   800e1e <file_write>
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	78 06                	js     801398 <serve_write+0x47>
+	o->o_fd->fd_offset += count;
+  801392:	8b 56 0c             	mov    0xc(%esi),%edx
+  801395:	01 7a 04             	add    %edi,0x4(%edx)
+}
+  801398:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139b:	5b                   	pop    %ebx
+  80139c:	5e                   	pop    %esi
+  80139d:	5f                   	pop    %edi
+  80139e:	5d                   	pop    %ebp
+  80139f:	c3                   	ret
+
+008013a0 <serve_stat>:
+{
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	56                   	push   %esi
+  8013a4:	53                   	push   %ebx
+  8013a5:	83 ec 14             	sub    $0x14,%esp
+  8013a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8013ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ae:	50                   	push   %eax
+  8013af:	ff 33                	push   (%ebx)
+  8013b1:	ff 75 08             	push   0x8(%ebp)
+  8013b4:	e8 af fe ff ff       	call   801268 <openfile_lookup>
+  8013b9:	83 c4 10             	add    $0x10,%esp
+  8013bc:	85 c0                	test   %eax,%eax
+  8013be:	78 4b                	js     80140b <serve_stat+0x6b>
+	strcpy(ret->ret_name, o->o_file->f_name);
+  8013c0:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8013c3:	83 ec 08             	sub    $0x8,%esp
+  8013c6:	ff 76 04             	push   0x4(%esi)
+  8013c9:	53                   	push   %ebx
+  8013ca:	e8 cf 10 00 00       	call   80249e <strcpy>
+	ret->ret_size = o->o_file->f_size;
+  8013cf:	8b 46 04             	mov    0x4(%esi),%eax
+  8013d2:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8013d8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  8013de:	8b 46 04             	mov    0x4(%esi),%eax
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  8013eb:	0f 94 c0             	sete   %al
+  8013ee:	0f b6 c0             	movzbl %al,%eax
+  8013f1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	ret->ret_version = o->o_file->f_version;
+  8013f7:	8b 46 04             	mov    0x4(%esi),%eax
+  8013fa:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+  801400:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801406:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80140b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80140e:	5b                   	pop    %ebx
+  80140f:	5e                   	pop    %esi
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+
+00801412 <serve_flush>:
+{
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801418:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80141b:	50                   	push   %eax
+  80141c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80141f:	ff 30                	push   (%eax)
+  801421:	ff 75 08             	push   0x8(%ebp)
+  801424:	e8 3f fe ff ff       	call   801268 <openfile_lookup>
+  801429:	83 c4 10             	add    $0x10,%esp
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	78 16                	js     801446 <serve_flush+0x34>
+	file_flush(o->o_file);
+  801430:	83 ec 0c             	sub    $0xc,%esp
+  801433:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801436:	ff 70 04             	push   0x4(%eax)
+  801439:	e8 9e fa ff ff       	call   800edc <file_flush>
+	return 0;
+  80143e:	83 c4 10             	add    $0x10,%esp
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+
+00801448 <serve_open>:
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	53                   	push   %ebx
+  80144c:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  801452:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	memmove(path, req->req_path, MAXPATHLEN);
+  801455:	68 00 04 00 00       	push   $0x400
+  80145a:	53                   	push   %ebx
+  80145b:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  801461:	50                   	push   %eax
+  801462:	e8 e7 11 00 00       	call   80264e <memmove>
+	path[MAXPATHLEN-1] = 0;
+  801467:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = openfile_alloc(&o)) < 0) {
+  80146b:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  801471:	89 04 24             	mov    %eax,(%esp)
+  801474:	e8 53 fd ff ff       	call   8011cc <openfile_alloc>
+  801479:	83 c4 10             	add    $0x10,%esp
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	0f 88 aa 00 00 00    	js     80152e <serve_open+0xe6>
+	if (req->req_omode & O_CREAT) {
+  801484:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%ebx)
+  80148b:	74 2b                	je     8014b8 <serve_open+0x70>
+		if ((r = file_create(path, &f)) < 0) {
+  80148d:	83 ec 08             	sub    $0x8,%esp
+  801490:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  801496:	50                   	push   %eax
+  801497:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80149d:	50                   	push   %eax
+  80149e:	e8 e1 fa ff ff       	call   800f84 <file_create>
+  8014a3:	83 c4 10             	add    $0x10,%esp
+  8014a6:	85 c0                	test   %eax,%eax
+  8014a8:	79 2b                	jns    8014d5 <serve_open+0x8d>
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  8014aa:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  8014b1:	75 7b                	jne    80152e <serve_open+0xe6>
+  8014b3:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  8014b6:	75 76                	jne    80152e <serve_open+0xe6>
+		if ((r = file_open(path, &f)) < 0) {
+  8014b8:	83 ec 08             	sub    $0x8,%esp
+  8014bb:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8014c1:	50                   	push   %eax
+  8014c2:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8014c8:	50                   	push   %eax
+  8014c9:	e8 41 f8 ff ff       	call   800d0f <file_open>
+  8014ce:	83 c4 10             	add    $0x10,%esp
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	78 59                	js     80152e <serve_open+0xe6>
+	if (req->req_omode & O_TRUNC) {
+  8014d5:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  8014dc:	75 55                	jne    801533 <serve_open+0xeb>
+	o->o_file = f;
+  8014de:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  8014e4:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  8014ea:	89 50 04             	mov    %edx,0x4(%eax)
+	o->o_fd->fd_file.id = o->o_fileid;
+  8014ed:	8b 50 0c             	mov    0xc(%eax),%edx
+  8014f0:	8b 08                	mov    (%eax),%ecx
+  8014f2:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  8014f5:	8b 48 0c             	mov    0xc(%eax),%ecx
+  8014f8:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  8014fe:	83 e2 03             	and    $0x3,%edx
+  801501:	89 51 08             	mov    %edx,0x8(%ecx)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  801504:	8b 50 0c             	mov    0xc(%eax),%edx
+  801507:	8b 0d 80 b0 80 00    	mov    0x80b080,%ecx
+  80150d:	89 0a                	mov    %ecx,(%edx)
+	o->o_mode = req->req_omode;
+  80150f:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  801515:	89 50 08             	mov    %edx,0x8(%eax)
+	*pg_store = o->o_fd;
+  801518:	8b 50 0c             	mov    0xc(%eax),%edx
+  80151b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80151e:	89 10                	mov    %edx,(%eax)
+	*perm_store = PTE_P | PTE_U | PTE_W | PTE_SHARE;
+  801520:	8b 45 14             	mov    0x14(%ebp),%eax
+  801523:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	return 0;
+  801529:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80152e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801531:	c9                   	leave
+  801532:	c3                   	ret
+		if ((r = file_set_size(f, 0)) < 0) {
+  801533:	83 ec 08             	sub    $0x8,%esp
+  801536:	6a 00                	push   $0x0
+  801538:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  80153e:	e8 9b f8 ff ff       	call   800dde <file_set_size>
+  801543:	83 c4 10             	add    $0x10,%esp
+  801546:	85 c0                	test   %eax,%eax
+  801548:	79 94                	jns    8014de <serve_open+0x96>
+  80154a:	eb e2                	jmp    80152e <serve_open+0xe6>
+
+0080154c <serve_map>:
+{
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+  80154f:	57                   	push   %edi
+  801550:	56                   	push   %esi
+  801551:	53                   	push   %ebx
+  801552:	83 ec 30             	sub    $0x30,%esp
+  801555:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801558:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80155b:	50                   	push   %eax
+  80155c:	ff 36                	push   (%esi)
+  80155e:	ff 75 08             	push   0x8(%ebp)
+  801561:	e8 02 fd ff ff       	call   801268 <openfile_lookup>
+  801566:	83 c4 10             	add    $0x10,%esp
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	0f 88 c6 00 00 00    	js     801637 <serve_map+0xeb>
+	if (req->req_offset < 0 || req->req_npages < 0)
+  801571:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801574:	85 db                	test   %ebx,%ebx
+  801576:	0f 88 c3 00 00 00    	js     80163f <serve_map+0xf3>
+  80157c:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80157f:	85 c9                	test   %ecx,%ecx
+  801581:	0f 88 bf 00 00 00    	js     801646 <serve_map+0xfa>
+	pos = ROUNDDOWN(req->req_offset, BLKSIZE);
+  801587:	89 de                	mov    %ebx,%esi
+  801589:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	size = o->o_file->f_size;
+  80158f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801592:	8b 42 04             	mov    0x4(%edx),%eax
+  801595:	8b b8 80 00 00 00    	mov    0x80(%eax),%edi
+		return 0;
+  80159b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pos >= size)
+  8015a0:	39 fe                	cmp    %edi,%esi
+  8015a2:	0f 8d 8f 00 00 00    	jge    801637 <serve_map+0xeb>
+	n = MIN(MIN(req->req_npages, FSMAP_PAGES),
+  8015a8:	29 f7                	sub    %esi,%edi
+  8015aa:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  8015ad:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8015b3:	c1 f8 0c             	sar    $0xc,%eax
+  8015b6:	be 10 00 00 00       	mov    $0x10,%esi
+  8015bb:	39 f1                	cmp    %esi,%ecx
+  8015bd:	0f 4f ce             	cmovg  %esi,%ecx
+  8015c0:	39 c8                	cmp    %ecx,%eax
+  8015c2:	0f 4e c8             	cmovle %eax,%ecx
+	for (i = 0; i < n; i++) {
+  8015c5:	85 c9                	test   %ecx,%ecx
+  8015c7:	7e 5e                	jle    801627 <serve_map+0xdb>
+		if ((r = file_get_block(o->o_file, pos / BLKSIZE + i, &blk)) < 0)
+  8015c9:	c1 fb 0c             	sar    $0xc,%ebx
+  8015cc:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+  8015cf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8015d2:	be 00 00 40 d0       	mov    $0xd0400000,%esi
+  8015d7:	8d 7d e0             	lea    -0x20(%ebp),%edi
+  8015da:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8015dd:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8015e0:	83 ec 04             	sub    $0x4,%esp
+  8015e3:	57                   	push   %edi
+  8015e4:	53                   	push   %ebx
+  8015e5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8015e8:	ff 70 04             	push   0x4(%eax)
+  8015eb:	e8 71 f4 ff ff       	call   800a61 <file_get_block>
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	85 c0                	test   %eax,%eax
+  8015f5:	78 40                	js     801637 <serve_map+0xeb>
+		*(volatile char *) blk;
+  8015f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015fa:	0f b6 10             	movzbl (%eax),%edx
+		if ((r = sys_page_map(0, blk, 0, (void *) (MAPVA + i * PGSIZE),
+  8015fd:	83 ec 0c             	sub    $0xc,%esp
+  801600:	6a 05                	push   $0x5
+  801602:	56                   	push   %esi
+  801603:	6a 00                	push   $0x0
+  801605:	50                   	push   %eax
+  801606:	6a 00                	push   $0x0
+  801608:	e8 08 13 00 00       	call   802915 <sys_page_map>
+  80160d:	83 c4 20             	add    $0x20,%esp
+  801610:	85 c0                	test   %eax,%eax
+  801612:	78 23                	js     801637 <serve_map+0xeb>
+	for (i = 0; i < n; i++) {
+  801614:	83 c3 01             	add    $0x1,%ebx
+  801617:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80161d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801620:	39 c3                	cmp    %eax,%ebx
+  801622:	75 bc                	jne    8015e0 <serve_map+0x94>
+  801624:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+	*npages_store = n;
+  801627:	8b 45 10             	mov    0x10(%ebp),%eax
+  80162a:	89 08                	mov    %ecx,(%eax)
+	return MIN(n * BLKSIZE, size - pos);
+  80162c:	c1 e1 0c             	shl    $0xc,%ecx
+  80162f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801632:	39 c1                	cmp    %eax,%ecx
+  801634:	0f 4e c1             	cmovle %ecx,%eax
+}
+  801637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5f                   	pop    %edi
+  80163d:	5d                   	pop    %ebp
+  80163e:	c3                   	ret
+		return -E_INVAL;
+  80163f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801644:	eb f1                	jmp    801637 <serve_map+0xeb>
+  801646:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164b:	eb ea                	jmp    801637 <serve_map+0xeb>
+
+0080164d <serve>:
+};
+#define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
+
+void
+serve(void)
+{
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	57                   	push   %edi
+  801651:	56                   	push   %esi
+  801652:	53                   	push   %ebx
+  801653:	83 ec 2c             	sub    $0x2c,%esp
+	int perm, npages, r, i;
+	void *pg;
+
+	while (1) {
+		perm = 0;
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  801656:	8d 5d e0             	lea    -0x20(%ebp),%ebx
+  801659:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80165c:	eb 13                	jmp    801671 <serve+0x24>
+			cprintf("fs req %d from %08x [page %08x: %s]\n",
+				req, whom, vpt[PGNUM(fsreq)], fsreq);
+
+		// All requests must contain an argument page
+		if (!(perm & PTE_P)) {
+			cprintf("Invalid request from %08x: no argument page\n",
+  80165e:	83 ec 08             	sub    $0x8,%esp
+  801661:	ff 75 e4             	push   -0x1c(%ebp)
+  801664:	68 60 59 80 00       	push   $0x805960
+  801669:	e8 39 07 00 00       	call   801da7 <cprintf>
+				whom);
+			continue; // just leave it hanging...
+  80166e:	83 c4 10             	add    $0x10,%esp
+		perm = 0;
+  801671:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  801678:	83 ec 04             	sub    $0x4,%esp
+  80167b:	53                   	push   %ebx
+  80167c:	ff 35 44 70 80 00    	push   0x807044
+  801682:	56                   	push   %esi
+  801683:	e8 11 17 00 00       	call   802d99 <ipc_recv>
+		if (!(perm & PTE_P)) {
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	f6 45 e0 01          	testb  $0x1,-0x20(%ebp)
+  80168f:	74 cd                	je     80165e <serve+0x11>
+		}
+
+		pg = NULL;
+  801691:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		if (req == FSREQ_OPEN) {
+  801698:	83 f8 01             	cmp    $0x1,%eax
+  80169b:	74 33                	je     8016d0 <serve+0x83>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req == FSREQ_MAP) {
+  80169d:	83 f8 09             	cmp    $0x9,%eax
+  8016a0:	74 49                	je     8016eb <serve+0x9e>
+					sys_page_unmap(0, (void *) (MAPVA + i * PGSIZE));
+			} else
+				ipc_send(whom, r, 0, 0);
+			sys_page_unmap(0, fsreq);
+			continue;
+		} else if (req < NHANDLERS && handlers[req]) {
+  8016a2:	83 f8 08             	cmp    $0x8,%eax
+  8016a5:	0f 87 eb 00 00 00    	ja     801796 <serve+0x149>
+  8016ab:	8b 14 85 20 70 80 00 	mov    0x807020(,%eax,4),%edx
+  8016b2:	85 d2                	test   %edx,%edx
+  8016b4:	0f 84 dc 00 00 00    	je     801796 <serve+0x149>
+			r = handlers[req](whom, fsreq);
+  8016ba:	83 ec 08             	sub    $0x8,%esp
+  8016bd:	ff 35 44 70 80 00    	push   0x807044
+  8016c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8016c6:	ff d2                	call   *%edx
+  8016c8:	83 c4 10             	add    $0x10,%esp
+  8016cb:	e9 df 00 00 00       	jmp    8017af <serve+0x162>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+  8016d0:	53                   	push   %ebx
+  8016d1:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8016d4:	50                   	push   %eax
+  8016d5:	ff 35 44 70 80 00    	push   0x807044
+  8016db:	ff 75 e4             	push   -0x1c(%ebp)
+  8016de:	e8 65 fd ff ff       	call   801448 <serve_open>
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	e9 c4 00 00 00       	jmp    8017af <serve+0x162>
+			npages = 0;
+  8016eb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+			r = serve_map(whom, &fsreq->map, &npages);
+  8016f2:	83 ec 04             	sub    $0x4,%esp
+  8016f5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8016f8:	50                   	push   %eax
+  8016f9:	ff 35 44 70 80 00    	push   0x807044
+  8016ff:	ff 75 e4             	push   -0x1c(%ebp)
+  801702:	e8 45 fe ff ff       	call   80154c <serve_map>
+			if (r > 0) {
+  801707:	83 c4 10             	add    $0x10,%esp
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	7f 28                	jg     801736 <serve+0xe9>
+				ipc_send(whom, r, 0, 0);
+  80170e:	6a 00                	push   $0x0
+  801710:	6a 00                	push   $0x0
+  801712:	50                   	push   %eax
+  801713:	ff 75 e4             	push   -0x1c(%ebp)
+  801716:	e8 0e 19 00 00       	call   803029 <ipc_send>
+  80171b:	83 c4 10             	add    $0x10,%esp
+			sys_page_unmap(0, fsreq);
+  80171e:	83 ec 08             	sub    $0x8,%esp
+  801721:	ff 35 44 70 80 00    	push   0x807044
+  801727:	6a 00                	push   $0x0
+  801729:	e8 29 12 00 00       	call   802957 <sys_page_unmap>
+			continue;
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	e9 3b ff ff ff       	jmp    801671 <serve+0x24>
+				i = ipc_try_send_pages(whom, r, (void *) MAPVA,
+  801736:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801739:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80173c:	83 ec 0c             	sub    $0xc,%esp
+  80173f:	6a 05                	push   $0x5
+  801741:	51                   	push   %ecx
+  801742:	68 00 00 40 d0       	push   $0xd0400000
+  801747:	50                   	push   %eax
+  801748:	ff 75 e4             	push   -0x1c(%ebp)
+  80174b:	e8 23 18 00 00       	call   802f73 <ipc_try_send_pages>
+				if (i < 0)
+  801750:	83 c4 20             	add    $0x20,%esp
+  801753:	85 c0                	test   %eax,%eax
+  801755:	78 2d                	js     801784 <serve+0x137>
+				for (i = 0; i < npages; i++)
+  801757:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80175b:	7e c1                	jle    80171e <serve+0xd1>
+  80175d:	bf 00 00 00 00       	mov    $0x0,%edi
+					sys_page_unmap(0, (void *) (MAPVA + i * PGSIZE));
+  801762:	83 ec 08             	sub    $0x8,%esp
+  801765:	89 f8                	mov    %edi,%eax
+  801767:	c1 e0 0c             	shl    $0xc,%eax
+  80176a:	2d 00 00 c0 2f       	sub    $0x2fc00000,%eax
+  80176f:	50                   	push   %eax
+  801770:	6a 00                	push   $0x0
+  801772:	e8 e0 11 00 00       	call   802957 <sys_page_unmap>
+				for (i = 0; i < npages; i++)
+  801777:	83 c7 01             	add    $0x1,%edi
+  80177a:	83 c4 10             	add    $0x10,%esp
+  80177d:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+  801780:	75 e0                	jne    801762 <serve+0x115>
+  801782:	eb 9a                	jmp    80171e <serve+0xd1>
+					ipc_send(whom, i, 0, 0);
+  801784:	6a 00                	push   $0x0
+  801786:	6a 00                	push   $0x0
+  801788:	50                   	push   %eax
+  801789:	ff 75 e4             	push   -0x1c(%ebp)
+  80178c:	e8 98 18 00 00       	call   803029 <ipc_send>
+  801791:	83 c4 10             	add    $0x10,%esp
+  801794:	eb c1                	jmp    801757 <serve+0x10a>
+		} else {
+			cprintf("Invalid request code %d from %08x\n", whom, req);
+  801796:	83 ec 04             	sub    $0x4,%esp
+  801799:	50                   	push   %eax
+  80179a:	ff 75 e4             	push   -0x1c(%ebp)
+  80179d:	68 90 59 80 00       	push   $0x805990
+  8017a2:	e8 00 06 00 00       	call   801da7 <cprintf>
+  8017a7:	83 c4 10             	add    $0x10,%esp
+			r = -E_INVAL;
+  8017aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+		}
+		ipc_send(whom, r, pg, perm);
+  8017af:	ff 75 e0             	push   -0x20(%ebp)
+  8017b2:	ff 75 d8             	push   -0x28(%ebp)
+  8017b5:	50                   	push   %eax
+  8017b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8017b9:	e8 6b 18 00 00       	call   803029 <ipc_send>
+		sys_page_unmap(0, fsreq);
+  8017be:	83 c4 08             	add    $0x8,%esp
+  8017c1:	ff 35 44 70 80 00    	push   0x807044
+  8017c7:	6a 00                	push   $0x0
+  8017c9:	e8 89 11 00 00       	call   802957 <sys_page_unmap>
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	e9 9b fe ff ff       	jmp    801671 <serve+0x24>
+
+008017d6 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	83 ec 14             	sub    $0x14,%esp
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  8017dc:	c7 05 60 b0 80 00 b3 	movl   $0x8059b3,0x80b060
+  8017e3:	59 80 00 
+	cprintf("FS is running\n");
+  8017e6:	68 b6 59 80 00       	push   $0x8059b6
+  8017eb:	e8 b7 05 00 00       	call   801da7 <cprintf>
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  8017f0:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  8017f5:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  8017fa:	66 ef                	out    %ax,(%dx)
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  8017fc:	c7 04 24 c5 59 80 00 	movl   $0x8059c5,(%esp)
+  801803:	e8 9f 05 00 00       	call   801da7 <cprintf>
+
+	serve_init();
+  801808:	e8 97 f9 ff ff       	call   8011a4 <serve_init>
+	fs_init();
+  80180d:	e8 f0 f1 ff ff       	call   800a02 <fs_init>
+	serve();
+  801812:	e8 36 fe ff ff       	call   80164d <serve>
+
+00801817 <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	char *blk;
+	uint32_t *bits;
+
+	// back up bitmap
+	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  80181d:	6a 07                	push   $0x7
+  80181f:	68 00 10 00 00       	push   $0x1000
+  801824:	6a 00                	push   $0x0
+  801826:	e8 a7 10 00 00       	call   8028d2 <sys_page_alloc>
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	0f 88 52 02 00 00    	js     801a88 <fs_test+0x271>
+		panic("sys_page_alloc: %e", r);
+	bits = (uint32_t*) PGSIZE;
+	memmove(bits, bitmap, PGSIZE);
+  801836:	83 ec 04             	sub    $0x4,%esp
+  801839:	68 00 10 00 00       	push   $0x1000
+  80183e:	ff 35 38 c3 80 00    	push   0x80c338
+  801844:	68 00 10 00 00       	push   $0x1000
+  801849:	e8 00 0e 00 00       	call   80264e <memmove>
+	// allocate block
+	if ((r = alloc_block()) < 0)
+  80184e:	e8 f3 ee ff ff       	call   800746 <alloc_block>
+  801853:	89 c1                	mov    %eax,%ecx
+  801855:	83 c4 10             	add    $0x10,%esp
+  801858:	85 c0                	test   %eax,%eax
+  80185a:	0f 88 3a 02 00 00    	js     801a9a <fs_test+0x283>
+		panic("alloc_block: %e", r);
+	// check that block was free
+	assert(bits[r/32] & (1 << (r%32)));
+  801860:	8d 40 1f             	lea    0x1f(%eax),%eax
+  801863:	0f 49 c1             	cmovns %ecx,%eax
+  801866:	c1 f8 05             	sar    $0x5,%eax
+  801869:	ba 01 00 00 00       	mov    $0x1,%edx
+  80186e:	d3 e2                	shl    %cl,%edx
+  801870:	89 d1                	mov    %edx,%ecx
+  801872:	23 0c 85 00 10 00 00 	and    0x1000(,%eax,4),%ecx
+  801879:	0f 84 2d 02 00 00    	je     801aac <fs_test+0x295>
+	// and is not free any more
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  80187f:	8b 0d 38 c3 80 00    	mov    0x80c338,%ecx
+  801885:	23 14 81             	and    (%ecx,%eax,4),%edx
+  801888:	0f 85 34 02 00 00    	jne    801ac2 <fs_test+0x2ab>
+	cprintf("alloc_block is good\n");
+  80188e:	83 ec 0c             	sub    $0xc,%esp
+  801891:	68 09 5a 80 00       	push   $0x805a09
+  801896:	e8 0c 05 00 00       	call   801da7 <cprintf>
+
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  80189b:	83 c4 08             	add    $0x8,%esp
+  80189e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a1:	50                   	push   %eax
+  8018a2:	68 1e 5a 80 00       	push   $0x805a1e
+  8018a7:	e8 63 f4 ff ff       	call   800d0f <file_open>
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	0f 88 21 02 00 00    	js     801ad8 <fs_test+0x2c1>
+		panic("file_open /not-found: %e", r);
+	else if (r == 0)
+  8018b7:	0f 84 36 02 00 00    	je     801af3 <fs_test+0x2dc>
+		panic("file_open /not-found succeeded!");
+	if ((r = file_open("/newmotd", &f)) < 0)
+  8018bd:	83 ec 08             	sub    $0x8,%esp
+  8018c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	68 42 5a 80 00       	push   $0x805a42
+  8018c9:	e8 41 f4 ff ff       	call   800d0f <file_open>
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	85 c0                	test   %eax,%eax
+  8018d3:	0f 88 2e 02 00 00    	js     801b07 <fs_test+0x2f0>
+		panic("file_open /newmotd: %e", r);
+	cprintf("file_open is good\n");
+  8018d9:	83 ec 0c             	sub    $0xc,%esp
+  8018dc:	68 62 5a 80 00       	push   $0x805a62
+  8018e1:	e8 c1 04 00 00       	call   801da7 <cprintf>
+
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  8018e6:	83 c4 0c             	add    $0xc,%esp
+  8018e9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ec:	50                   	push   %eax
+  8018ed:	6a 00                	push   $0x0
+  8018ef:	ff 75 f4             	push   -0xc(%ebp)
+  8018f2:	e8 6a f1 ff ff       	call   800a61 <file_get_block>
+  8018f7:	83 c4 10             	add    $0x10,%esp
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	0f 88 17 02 00 00    	js     801b19 <fs_test+0x302>
+		panic("file_get_block: %e", r);
+	if (strcmp(blk, msg) != 0)
+  801902:	83 ec 08             	sub    $0x8,%esp
+  801905:	68 a4 5b 80 00       	push   $0x805ba4
+  80190a:	ff 75 f0             	push   -0x10(%ebp)
+  80190d:	e8 3c 0c 00 00       	call   80254e <strcmp>
+  801912:	83 c4 10             	add    $0x10,%esp
+  801915:	85 c0                	test   %eax,%eax
+  801917:	0f 85 0e 02 00 00    	jne    801b2b <fs_test+0x314>
+		panic("file_get_block returned wrong data");
+	cprintf("file_get_block is good\n");
+  80191d:	83 ec 0c             	sub    $0xc,%esp
+  801920:	68 88 5a 80 00       	push   $0x805a88
+  801925:	e8 7d 04 00 00       	call   801da7 <cprintf>
+
+	*(volatile char*)blk = *(volatile char*)blk;
+  80192a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80192d:	0f b6 10             	movzbl (%eax),%edx
+  801930:	88 10                	mov    %dl,(%eax)
+	assert((vpt[PGNUM(blk)] & PTE_D));
+  801932:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801935:	c1 e8 0c             	shr    $0xc,%eax
+  801938:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	a8 40                	test   $0x40,%al
+  801944:	0f 84 f5 01 00 00    	je     801b3f <fs_test+0x328>
+	file_flush(f);
+  80194a:	83 ec 0c             	sub    $0xc,%esp
+  80194d:	ff 75 f4             	push   -0xc(%ebp)
+  801950:	e8 87 f5 ff ff       	call   800edc <file_flush>
+	assert(!(vpt[PGNUM(blk)] & PTE_D));
+  801955:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801958:	c1 e8 0c             	shr    $0xc,%eax
+  80195b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801962:	83 c4 10             	add    $0x10,%esp
+  801965:	a8 40                	test   $0x40,%al
+  801967:	0f 85 e8 01 00 00    	jne    801b55 <fs_test+0x33e>
+	cprintf("file_flush is good\n");
+  80196d:	83 ec 0c             	sub    $0xc,%esp
+  801970:	68 bb 5a 80 00       	push   $0x805abb
+  801975:	e8 2d 04 00 00       	call   801da7 <cprintf>
+
+	if ((r = file_set_size(f, 0)) < 0)
+  80197a:	83 c4 08             	add    $0x8,%esp
+  80197d:	6a 00                	push   $0x0
+  80197f:	ff 75 f4             	push   -0xc(%ebp)
+  801982:	e8 57 f4 ff ff       	call   800dde <file_set_size>
+  801987:	83 c4 10             	add    $0x10,%esp
+  80198a:	85 c0                	test   %eax,%eax
+  80198c:	0f 88 d9 01 00 00    	js     801b6b <fs_test+0x354>
+		panic("file_set_size: %e", r);
+	assert(f->f_direct[0] == 0);
+  801992:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801995:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  80199c:	0f 85 db 01 00 00    	jne    801b7d <fs_test+0x366>
+	assert(!(vpt[PGNUM(f)] & PTE_D));
+  8019a2:	c1 e8 0c             	shr    $0xc,%eax
+  8019a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019ac:	a8 40                	test   $0x40,%al
+  8019ae:	0f 85 df 01 00 00    	jne    801b93 <fs_test+0x37c>
+	cprintf("file_truncate is good\n");
+  8019b4:	83 ec 0c             	sub    $0xc,%esp
+  8019b7:	68 0e 5b 80 00       	push   $0x805b0e
+  8019bc:	e8 e6 03 00 00       	call   801da7 <cprintf>
+
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  8019c1:	c7 04 24 a4 5b 80 00 	movl   $0x805ba4,(%esp)
+  8019c8:	e8 85 0a 00 00       	call   802452 <strlen>
+  8019cd:	83 c4 08             	add    $0x8,%esp
+  8019d0:	50                   	push   %eax
+  8019d1:	ff 75 f4             	push   -0xc(%ebp)
+  8019d4:	e8 05 f4 ff ff       	call   800dde <file_set_size>
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	0f 88 c5 01 00 00    	js     801ba9 <fs_test+0x392>
+		panic("file_set_size 2: %e", r);
+	assert(!(vpt[PGNUM(f)] & PTE_D));
+  8019e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e7:	89 c2                	mov    %eax,%edx
+  8019e9:	c1 ea 0c             	shr    $0xc,%edx
+  8019ec:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019f3:	f6 c2 40             	test   $0x40,%dl
+  8019f6:	0f 85 bf 01 00 00    	jne    801bbb <fs_test+0x3a4>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  8019fc:	83 ec 04             	sub    $0x4,%esp
+  8019ff:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  801a02:	52                   	push   %edx
+  801a03:	6a 00                	push   $0x0
+  801a05:	50                   	push   %eax
+  801a06:	e8 56 f0 ff ff       	call   800a61 <file_get_block>
+  801a0b:	83 c4 10             	add    $0x10,%esp
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	0f 88 bb 01 00 00    	js     801bd1 <fs_test+0x3ba>
+		panic("file_get_block 2: %e", r);
+	strcpy(blk, msg);
+  801a16:	83 ec 08             	sub    $0x8,%esp
+  801a19:	68 a4 5b 80 00       	push   $0x805ba4
+  801a1e:	ff 75 f0             	push   -0x10(%ebp)
+  801a21:	e8 78 0a 00 00       	call   80249e <strcpy>
+	assert((vpt[PGNUM(blk)] & PTE_D));
+  801a26:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801a29:	c1 e8 0c             	shr    $0xc,%eax
+  801a2c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a33:	83 c4 10             	add    $0x10,%esp
+  801a36:	a8 40                	test   $0x40,%al
+  801a38:	0f 84 a5 01 00 00    	je     801be3 <fs_test+0x3cc>
+	file_flush(f);
+  801a3e:	83 ec 0c             	sub    $0xc,%esp
+  801a41:	ff 75 f4             	push   -0xc(%ebp)
+  801a44:	e8 93 f4 ff ff       	call   800edc <file_flush>
+	assert(!(vpt[PGNUM(blk)] & PTE_D));
+  801a49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801a4c:	c1 e8 0c             	shr    $0xc,%eax
+  801a4f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a56:	83 c4 10             	add    $0x10,%esp
+  801a59:	a8 40                	test   $0x40,%al
+  801a5b:	0f 85 98 01 00 00    	jne    801bf9 <fs_test+0x3e2>
+	assert(!(vpt[PGNUM(f)] & PTE_D));
+  801a61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a64:	c1 e8 0c             	shr    $0xc,%eax
+  801a67:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a6e:	a8 40                	test   $0x40,%al
+  801a70:	0f 85 99 01 00 00    	jne    801c0f <fs_test+0x3f8>
+	cprintf("file rewrite is good\n");
+  801a76:	83 ec 0c             	sub    $0xc,%esp
+  801a79:	68 4e 5b 80 00       	push   $0x805b4e
+  801a7e:	e8 24 03 00 00       	call   801da7 <cprintf>
+}
+  801a83:	83 c4 10             	add    $0x10,%esp
+  801a86:	c9                   	leave
+  801a87:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  801a88:	50                   	push   %eax
+  801a89:	68 b8 57 80 00       	push   $0x8057b8
+  801a8e:	6a 13                	push   $0x13
+  801a90:	68 d4 59 80 00       	push   $0x8059d4
+  801a95:	e8 32 02 00 00       	call   801ccc <_panic>
+		panic("alloc_block: %e", r);
+  801a9a:	50                   	push   %eax
+  801a9b:	68 de 59 80 00       	push   $0x8059de
+  801aa0:	6a 18                	push   $0x18
+  801aa2:	68 d4 59 80 00       	push   $0x8059d4
+  801aa7:	e8 20 02 00 00       	call   801ccc <_panic>
+	assert(bits[r/32] & (1 << (r%32)));
+  801aac:	68 ee 59 80 00       	push   $0x8059ee
+  801ab1:	68 fd 56 80 00       	push   $0x8056fd
+  801ab6:	6a 1a                	push   $0x1a
+  801ab8:	68 d4 59 80 00       	push   $0x8059d4
+  801abd:	e8 0a 02 00 00       	call   801ccc <_panic>
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  801ac2:	68 64 5b 80 00       	push   $0x805b64
+  801ac7:	68 fd 56 80 00       	push   $0x8056fd
+  801acc:	6a 1c                	push   $0x1c
+  801ace:	68 d4 59 80 00       	push   $0x8059d4
+  801ad3:	e8 f4 01 00 00       	call   801ccc <_panic>
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  801ad8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801adb:	0f 84 dc fd ff ff    	je     8018bd <fs_test+0xa6>
+		panic("file_open /not-found: %e", r);
+  801ae1:	50                   	push   %eax
+  801ae2:	68 29 5a 80 00       	push   $0x805a29
+  801ae7:	6a 20                	push   $0x20
+  801ae9:	68 d4 59 80 00       	push   $0x8059d4
+  801aee:	e8 d9 01 00 00       	call   801ccc <_panic>
+		panic("file_open /not-found succeeded!");
+  801af3:	83 ec 04             	sub    $0x4,%esp
+  801af6:	68 84 5b 80 00       	push   $0x805b84
+  801afb:	6a 22                	push   $0x22
+  801afd:	68 d4 59 80 00       	push   $0x8059d4
+  801b02:	e8 c5 01 00 00       	call   801ccc <_panic>
+		panic("file_open /newmotd: %e", r);
+  801b07:	50                   	push   %eax
+  801b08:	68 4b 5a 80 00       	push   $0x805a4b
+  801b0d:	6a 24                	push   $0x24
+  801b0f:	68 d4 59 80 00       	push   $0x8059d4
+  801b14:	e8 b3 01 00 00       	call   801ccc <_panic>
+		panic("file_get_block: %e", r);
+  801b19:	50                   	push   %eax
+  801b1a:	68 75 5a 80 00       	push   $0x805a75
+  801b1f:	6a 28                	push   $0x28
+  801b21:	68 d4 59 80 00       	push   $0x8059d4
+  801b26:	e8 a1 01 00 00       	call   801ccc <_panic>
+		panic("file_get_block returned wrong data");
+  801b2b:	83 ec 04             	sub    $0x4,%esp
+  801b2e:	68 cc 5b 80 00       	push   $0x805bcc
+  801b33:	6a 2a                	push   $0x2a
+  801b35:	68 d4 59 80 00       	push   $0x8059d4
+  801b3a:	e8 8d 01 00 00       	call   801ccc <_panic>
+	assert((vpt[PGNUM(blk)] & PTE_D));
+  801b3f:	68 a1 5a 80 00       	push   $0x805aa1
+  801b44:	68 fd 56 80 00       	push   $0x8056fd
+  801b49:	6a 2e                	push   $0x2e
+  801b4b:	68 d4 59 80 00       	push   $0x8059d4
+  801b50:	e8 77 01 00 00       	call   801ccc <_panic>
+	assert(!(vpt[PGNUM(blk)] & PTE_D));
+  801b55:	68 a0 5a 80 00       	push   $0x805aa0
+  801b5a:	68 fd 56 80 00       	push   $0x8056fd
+  801b5f:	6a 30                	push   $0x30
+  801b61:	68 d4 59 80 00       	push   $0x8059d4
+  801b66:	e8 61 01 00 00       	call   801ccc <_panic>
+		panic("file_set_size: %e", r);
+  801b6b:	50                   	push   %eax
+  801b6c:	68 cf 5a 80 00       	push   $0x805acf
+  801b71:	6a 34                	push   $0x34
+  801b73:	68 d4 59 80 00       	push   $0x8059d4
+  801b78:	e8 4f 01 00 00       	call   801ccc <_panic>
+	assert(f->f_direct[0] == 0);
+  801b7d:	68 e1 5a 80 00       	push   $0x805ae1
+  801b82:	68 fd 56 80 00       	push   $0x8056fd
+  801b87:	6a 35                	push   $0x35
+  801b89:	68 d4 59 80 00       	push   $0x8059d4
+  801b8e:	e8 39 01 00 00       	call   801ccc <_panic>
+	assert(!(vpt[PGNUM(f)] & PTE_D));
+  801b93:	68 f5 5a 80 00       	push   $0x805af5
+  801b98:	68 fd 56 80 00       	push   $0x8056fd
+  801b9d:	6a 36                	push   $0x36
+  801b9f:	68 d4 59 80 00       	push   $0x8059d4
+  801ba4:	e8 23 01 00 00       	call   801ccc <_panic>
+		panic("file_set_size 2: %e", r);
+  801ba9:	50                   	push   %eax
+  801baa:	68 25 5b 80 00       	push   $0x805b25
+  801baf:	6a 3a                	push   $0x3a
+  801bb1:	68 d4 59 80 00       	push   $0x8059d4
+  801bb6:	e8 11 01 00 00       	call   801ccc <_panic>
+	assert(!(vpt[PGNUM(f)] & PTE_D));
+  801bbb:	68 f5 5a 80 00       	push   $0x805af5
+  801bc0:	68 fd 56 80 00       	push   $0x8056fd
+  801bc5:	6a 3b                	push   $0x3b
+  801bc7:	68 d4 59 80 00       	push   $0x8059d4
+  801bcc:	e8 fb 00 00 00       	call   801ccc <_panic>
+		panic("file_get_block 2: %e", r);
+  801bd1:	50                   	push   %eax
+  801bd2:	68 39 5b 80 00       	push   $0x805b39
+  801bd7:	6a 3d                	push   $0x3d
+  801bd9:	68 d4 59 80 00       	push   $0x8059d4
+  801bde:	e8 e9 00 00 00       	call   801ccc <_panic>
+	assert((vpt[PGNUM(blk)] & PTE_D));
+  801be3:	68 a1 5a 80 00       	push   $0x805aa1
+  801be8:	68 fd 56 80 00       	push   $0x8056fd
+  801bed:	6a 3f                	push   $0x3f
+  801bef:	68 d4 59 80 00       	push   $0x8059d4
+  801bf4:	e8 d3 00 00 00       	call   801ccc <_panic>
+	assert(!(vpt[PGNUM(blk)] & PTE_D));
+  801bf9:	68 a0 5a 80 00       	push   $0x805aa0
+  801bfe:	68 fd 56 80 00       	push   $0x8056fd
+  801c03:	6a 41                	push   $0x41
+  801c05:	68 d4 59 80 00       	push   $0x8059d4
+  801c0a:	e8 bd 00 00 00       	call   801ccc <_panic>
+	assert(!(vpt[PGNUM(f)] & PTE_D));
+  801c0f:	68 f5 5a 80 00       	push   $0x805af5
+  801c14:	68 fd 56 80 00       	push   $0x8056fd
+  801c19:	6a 42                	push   $0x42
+  801c1b:	68 d4 59 80 00       	push   $0x8059d4
+  801c20:	e8 a7 00 00 00       	call   801ccc <_panic>
+
+00801c25 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	56                   	push   %esi
+  801c29:	53                   	push   %ebx
+  801c2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c2d:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801c30:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801c32:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c37:	29 d0                	sub    %edx,%eax
+  801c39:	89 c2                	mov    %eax,%edx
+  801c3b:	c1 ea 0f             	shr    $0xf,%edx
+  801c3e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c48:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  801c4b:	c7 04 85 40 c3 80 00 	movl   $0x0,0x80c340(,%eax,4)
+  801c52:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  801c56:	e8 39 0c 00 00       	call   802894 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  801c5b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c60:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801c66:	89 e1                	mov    %esp,%ecx
+  801c68:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801c6d:	29 ca                	sub    %ecx,%edx
+  801c6f:	89 d1                	mov    %edx,%ecx
+  801c71:	c1 e9 0f             	shr    $0xf,%ecx
+  801c74:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7f:	0f 42 d1             	cmovb  %ecx,%edx
+  801c82:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c87:	89 04 95 40 c3 80 00 	mov    %eax,0x80c340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  801c8e:	85 db                	test   %ebx,%ebx
+  801c90:	7e 07                	jle    801c99 <libmain+0x74>
+		binaryname = argv[0];
+  801c92:	8b 06                	mov    (%esi),%eax
+  801c94:	a3 60 b0 80 00       	mov    %eax,0x80b060
+
+	// call user main routine
+	umain(argc, argv);
+  801c99:	83 ec 08             	sub    $0x8,%esp
+  801c9c:	56                   	push   %esi
+  801c9d:	53                   	push   %ebx
+  801c9e:	e8 33 fb ff ff       	call   8017d6 <umain>
+
+	// exit gracefully
+	exit();
+  801ca3:	e8 0a 00 00 00       	call   801cb2 <exit>
+}
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cae:	5b                   	pop    %ebx
+  801caf:	5e                   	pop    %esi
+  801cb0:	5d                   	pop    %ebp
+  801cb1:	c3                   	ret
+
+00801cb2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  801cb8:	e8 fd 15 00 00       	call   8032ba <close_all>
+	sys_env_destroy(0);
+  801cbd:	83 ec 0c             	sub    $0xc,%esp
+  801cc0:	6a 00                	push   $0x0
+  801cc2:	e8 8c 0b 00 00       	call   802853 <sys_env_destroy>
+}
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+
+00801ccc <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	56                   	push   %esi
+  801cd0:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801cd1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801cd4:	8b 35 60 b0 80 00    	mov    0x80b060,%esi
+  801cda:	e8 b5 0b 00 00       	call   802894 <sys_getenvid>
+  801cdf:	83 ec 0c             	sub    $0xc,%esp
+  801ce2:	ff 75 0c             	push   0xc(%ebp)
+  801ce5:	ff 75 08             	push   0x8(%ebp)
+  801ce8:	56                   	push   %esi
+  801ce9:	50                   	push   %eax
+  801cea:	68 fc 5b 80 00       	push   $0x805bfc
+  801cef:	e8 b3 00 00 00       	call   801da7 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801cf4:	83 c4 18             	add    $0x18,%esp
+  801cf7:	53                   	push   %ebx
+  801cf8:	ff 75 10             	push   0x10(%ebp)
+  801cfb:	e8 56 00 00 00       	call   801d56 <vcprintf>
+	cprintf("\n");
+  801d00:	c7 04 24 23 58 80 00 	movl   $0x805823,(%esp)
+  801d07:	e8 9b 00 00 00       	call   801da7 <cprintf>
+  801d0c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801d0f:	cc                   	int3
+	while (1)
+  801d10:	eb fd                	jmp    801d0f <_panic+0x43>
+
+00801d12 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801d12:	55                   	push   %ebp
+  801d13:	89 e5                	mov    %esp,%ebp
+  801d15:	53                   	push   %ebx
+  801d16:	83 ec 04             	sub    $0x4,%esp
+  801d19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801d1c:	8b 13                	mov    (%ebx),%edx
+  801d1e:	8d 42 01             	lea    0x1(%edx),%eax
+  801d21:	89 03                	mov    %eax,(%ebx)
+  801d23:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d26:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801d2a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801d2f:	74 09                	je     801d3a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801d31:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801d35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d38:	c9                   	leave
+  801d39:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801d3a:	83 ec 08             	sub    $0x8,%esp
+  801d3d:	68 ff 00 00 00       	push   $0xff
+  801d42:	8d 43 08             	lea    0x8(%ebx),%eax
+  801d45:	50                   	push   %eax
+  801d46:	e8 cb 0a 00 00       	call   802816 <sys_cputs>
+		b->idx = 0;
+  801d4b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801d51:	83 c4 10             	add    $0x10,%esp
+  801d54:	eb db                	jmp    801d31 <putch+0x1f>
+
+00801d56 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+  801d59:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  801d5f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801d66:	00 00 00 
+	b.cnt = 0;
+  801d69:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  801d70:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801d73:	ff 75 0c             	push   0xc(%ebp)
+  801d76:	ff 75 08             	push   0x8(%ebp)
+  801d79:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801d7f:	50                   	push   %eax
+  801d80:	68 12 1d 80 00       	push   $0x801d12
+  801d85:	e8 1c 01 00 00       	call   801ea6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801d8a:	83 c4 08             	add    $0x8,%esp
+  801d8d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801d93:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801d99:	50                   	push   %eax
+  801d9a:	e8 77 0a 00 00       	call   802816 <sys_cputs>
+
+	return b.cnt;
+}
+  801d9f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801da5:	c9                   	leave
+  801da6:	c3                   	ret
+
+00801da7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801da7:	55                   	push   %ebp
+  801da8:	89 e5                	mov    %esp,%ebp
+  801daa:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801dad:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801db0:	50                   	push   %eax
+  801db1:	ff 75 08             	push   0x8(%ebp)
+  801db4:	e8 9d ff ff ff       	call   801d56 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+
+00801dbb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	57                   	push   %edi
+  801dbf:	56                   	push   %esi
+  801dc0:	53                   	push   %ebx
+  801dc1:	83 ec 1c             	sub    $0x1c,%esp
+  801dc4:	89 c3                	mov    %eax,%ebx
+  801dc6:	89 d6                	mov    %edx,%esi
+  801dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dce:	89 d1                	mov    %edx,%ecx
+  801dd0:	89 c2                	mov    %eax,%edx
+  801dd2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801dd5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801dd8:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801ddb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801dde:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801de5:	39 c2                	cmp    %eax,%edx
+  801de7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801dea:	73 4b                	jae    801e37 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  801dec:	8b 45 14             	mov    0x14(%ebp),%eax
+  801def:	8d 78 ff             	lea    -0x1(%eax),%edi
+  801df2:	85 ff                	test   %edi,%edi
+  801df4:	7e 11                	jle    801e07 <printnum+0x4c>
+			putch(padc, putdat);
+  801df6:	83 ec 08             	sub    $0x8,%esp
+  801df9:	56                   	push   %esi
+  801dfa:	ff 75 18             	push   0x18(%ebp)
+  801dfd:	ff d3                	call   *%ebx
+		while (--width > 0)
+  801dff:	83 c4 10             	add    $0x10,%esp
+  801e02:	83 ef 01             	sub    $0x1,%edi
+  801e05:	75 ef                	jne    801df6 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801e07:	83 ec 08             	sub    $0x8,%esp
+  801e0a:	56                   	push   %esi
+  801e0b:	83 ec 04             	sub    $0x4,%esp
+  801e0e:	ff 75 e4             	push   -0x1c(%ebp)
+  801e11:	ff 75 e0             	push   -0x20(%ebp)
+  801e14:	ff 75 dc             	push   -0x24(%ebp)
+  801e17:	ff 75 d8             	push   -0x28(%ebp)
+  801e1a:	e8 8e 37 00 00       	call   8055ad <__umoddi3>
+  801e1f:	83 c4 14             	add    $0x14,%esp
+  801e22:	0f be 80 1f 5c 80 00 	movsbl 0x805c1f(%eax),%eax
+  801e29:	50                   	push   %eax
+  801e2a:	ff d3                	call   *%ebx
+}
+  801e2c:	83 c4 10             	add    $0x10,%esp
+  801e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e32:	5b                   	pop    %ebx
+  801e33:	5e                   	pop    %esi
+  801e34:	5f                   	pop    %edi
+  801e35:	5d                   	pop    %ebp
+  801e36:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801e37:	83 ec 0c             	sub    $0xc,%esp
+  801e3a:	ff 75 18             	push   0x18(%ebp)
+  801e3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e40:	8d 57 ff             	lea    -0x1(%edi),%edx
+  801e43:	52                   	push   %edx
+  801e44:	50                   	push   %eax
+  801e45:	83 ec 08             	sub    $0x8,%esp
+  801e48:	ff 75 e4             	push   -0x1c(%ebp)
+  801e4b:	ff 75 e0             	push   -0x20(%ebp)
+  801e4e:	ff 75 dc             	push   -0x24(%ebp)
+  801e51:	ff 75 d8             	push   -0x28(%ebp)
+  801e54:	e8 8e 36 00 00       	call   8054e7 <__udivdi3>
+  801e59:	83 c4 18             	add    $0x18,%esp
+  801e5c:	52                   	push   %edx
+  801e5d:	50                   	push   %eax
+  801e5e:	89 f2                	mov    %esi,%edx
+  801e60:	89 d8                	mov    %ebx,%eax
+  801e62:	e8 54 ff ff ff       	call   801dbb <printnum>
+  801e67:	83 c4 20             	add    $0x20,%esp
+  801e6a:	eb 9b                	jmp    801e07 <printnum+0x4c>
+
+00801e6c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801e6c:	55                   	push   %ebp
+  801e6d:	89 e5                	mov    %esp,%ebp
+  801e6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801e72:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801e76:	8b 10                	mov    (%eax),%edx
+  801e78:	3b 50 04             	cmp    0x4(%eax),%edx
+  801e7b:	73 0a                	jae    801e87 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801e7d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801e80:	89 08                	mov    %ecx,(%eax)
+  801e82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e85:	88 02                	mov    %al,(%edx)
+}
+  801e87:	5d                   	pop    %ebp
+  801e88:	c3                   	ret
+
+00801e89 <printfmt>:
+{
+  801e89:	55                   	push   %ebp
+  801e8a:	89 e5                	mov    %esp,%ebp
+  801e8c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801e8f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801e92:	50                   	push   %eax
+  801e93:	ff 75 10             	push   0x10(%ebp)
+  801e96:	ff 75 0c             	push   0xc(%ebp)
+  801e99:	ff 75 08             	push   0x8(%ebp)
+  801e9c:	e8 05 00 00 00       	call   801ea6 <vprintfmt>
+}
+  801ea1:	83 c4 10             	add    $0x10,%esp
+  801ea4:	c9                   	leave
+  801ea5:	c3                   	ret
+
+00801ea6 <vprintfmt>:
+{
+  801ea6:	55                   	push   %ebp
+  801ea7:	89 e5                	mov    %esp,%ebp
+  801ea9:	57                   	push   %edi
+  801eaa:	56                   	push   %esi
+  801eab:	53                   	push   %ebx
+  801eac:	83 ec 2c             	sub    $0x2c,%esp
+  801eaf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801eb2:	89 df                	mov    %ebx,%edi
+  801eb4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801eb7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801eba:	8d 70 01             	lea    0x1(%eax),%esi
+  801ebd:	0f b6 00             	movzbl (%eax),%eax
+  801ec0:	83 f8 25             	cmp    $0x25,%eax
+  801ec3:	74 1e                	je     801ee3 <vprintfmt+0x3d>
+			if (ch == '\0')
+  801ec5:	85 c0                	test   %eax,%eax
+  801ec7:	0f 84 15 05 00 00    	je     8023e2 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  801ecd:	83 ec 08             	sub    $0x8,%esp
+  801ed0:	53                   	push   %ebx
+  801ed1:	50                   	push   %eax
+  801ed2:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ed4:	83 c6 01             	add    $0x1,%esi
+  801ed7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801edb:	83 c4 10             	add    $0x10,%esp
+  801ede:	83 f8 25             	cmp    $0x25,%eax
+  801ee1:	75 e2                	jne    801ec5 <vprintfmt+0x1f>
+		padc = ' ';
+  801ee3:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  801ee7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801eee:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  801ef5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  801efc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f01:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801f04:	8d 56 01             	lea    0x1(%esi),%edx
+  801f07:	0f b6 0e             	movzbl (%esi),%ecx
+  801f0a:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  801f0d:	3c 55                	cmp    $0x55,%al
+  801f0f:	0f 87 3b 04 00 00    	ja     802350 <vprintfmt+0x4aa>
+  801f15:	0f b6 c0             	movzbl %al,%eax
+  801f18:	ff 24 85 80 5d 80 00 	jmp    *0x805d80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801f1f:	89 75 10             	mov    %esi,0x10(%ebp)
+  801f22:	eb 93                	jmp    801eb7 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  801f24:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  801f26:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  801f2a:	eb d8                	jmp    801f04 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  801f2c:	89 d6                	mov    %edx,%esi
+  801f2e:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  801f32:	eb d0                	jmp    801f04 <vprintfmt+0x5e>
+  801f34:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  801f37:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  801f3a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  801f3d:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  801f41:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  801f44:	83 f9 09             	cmp    $0x9,%ecx
+  801f47:	77 6f                	ja     801fb8 <vprintfmt+0x112>
+  801f49:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  801f4c:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  801f4f:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  801f52:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  801f56:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  801f59:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801f5c:	83 fe 09             	cmp    $0x9,%esi
+  801f5f:	76 eb                	jbe    801f4c <vprintfmt+0xa6>
+  801f61:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  801f64:	89 d6                	mov    %edx,%esi
+  801f66:	eb 13                	jmp    801f7b <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  801f68:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f6b:	8b 00                	mov    (%eax),%eax
+  801f6d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f70:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f73:	8d 40 04             	lea    0x4(%eax),%eax
+  801f76:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801f79:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  801f7b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801f7f:	79 83                	jns    801f04 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  801f81:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f84:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f87:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  801f8e:	e9 71 ff ff ff       	jmp    801f04 <vprintfmt+0x5e>
+			if (width < 0)
+  801f93:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f96:	85 c9                	test   %ecx,%ecx
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	0f 49 c1             	cmovns %ecx,%eax
+  801fa0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801fa3:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  801fa5:	e9 5a ff ff ff       	jmp    801f04 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  801faa:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  801fac:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801fb3:	e9 4c ff ff ff       	jmp    801f04 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  801fb8:	89 d6                	mov    %edx,%esi
+  801fba:	eb bf                	jmp    801f7b <vprintfmt+0xd5>
+			lflag++;
+  801fbc:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801fc0:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  801fc2:	e9 3d ff ff ff       	jmp    801f04 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  801fc7:	89 55 10             	mov    %edx,0x10(%ebp)
+  801fca:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fcd:	8d 70 04             	lea    0x4(%eax),%esi
+  801fd0:	83 ec 08             	sub    $0x8,%esp
+  801fd3:	53                   	push   %ebx
+  801fd4:	ff 30                	push   (%eax)
+  801fd6:	ff d7                	call   *%edi
+			break;
+  801fd8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801fdb:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  801fde:	e9 d4 fe ff ff       	jmp    801eb7 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  801fe3:	89 55 10             	mov    %edx,0x10(%ebp)
+  801fe6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fe9:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  801fec:	8b 10                	mov    (%eax),%edx
+  801fee:	89 d0                	mov    %edx,%eax
+  801ff0:	f7 d8                	neg    %eax
+  801ff2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801ff5:	83 f8 12             	cmp    $0x12,%eax
+  801ff8:	7f 23                	jg     80201d <vprintfmt+0x177>
+  801ffa:	8b 14 85 e0 5e 80 00 	mov    0x805ee0(,%eax,4),%edx
+  802001:	85 d2                	test   %edx,%edx
+  802003:	74 18                	je     80201d <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802005:	52                   	push   %edx
+  802006:	68 0f 57 80 00       	push   $0x80570f
+  80200b:	53                   	push   %ebx
+  80200c:	57                   	push   %edi
+  80200d:	e8 77 fe ff ff       	call   801e89 <printfmt>
+  802012:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802015:	89 75 14             	mov    %esi,0x14(%ebp)
+  802018:	e9 9a fe ff ff       	jmp    801eb7 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80201d:	50                   	push   %eax
+  80201e:	68 37 5c 80 00       	push   $0x805c37
+  802023:	53                   	push   %ebx
+  802024:	57                   	push   %edi
+  802025:	e8 5f fe ff ff       	call   801e89 <printfmt>
+  80202a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80202d:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802030:	e9 82 fe ff ff       	jmp    801eb7 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802035:	89 55 10             	mov    %edx,0x10(%ebp)
+  802038:	8b 45 14             	mov    0x14(%ebp),%eax
+  80203b:	83 c0 04             	add    $0x4,%eax
+  80203e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802041:	8b 45 14             	mov    0x14(%ebp),%eax
+  802044:	8b 00                	mov    (%eax),%eax
+  802046:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	0f 84 61 03 00 00    	je     8023b2 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802051:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802055:	7e 06                	jle    80205d <vprintfmt+0x1b7>
+  802057:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80205b:	75 29                	jne    802086 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80205d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802060:	8d 70 01             	lea    0x1(%eax),%esi
+  802063:	0f b6 00             	movzbl (%eax),%eax
+  802066:	0f be d0             	movsbl %al,%edx
+  802069:	85 d2                	test   %edx,%edx
+  80206b:	0f 84 bb 00 00 00    	je     80212c <vprintfmt+0x286>
+  802071:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802074:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802077:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80207a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80207d:	eb 7a                	jmp    8020f9 <vprintfmt+0x253>
+				p = "(null)";
+  80207f:	c7 45 d0 30 5c 80 00 	movl   $0x805c30,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802086:	83 ec 08             	sub    $0x8,%esp
+  802089:	ff 75 d4             	push   -0x2c(%ebp)
+  80208c:	ff 75 d0             	push   -0x30(%ebp)
+  80208f:	e8 e0 03 00 00       	call   802474 <strnlen>
+  802094:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802097:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80209a:	83 c4 10             	add    $0x10,%esp
+  80209d:	85 d2                	test   %edx,%edx
+  80209f:	0f 8e d6 02 00 00    	jle    80237b <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8020a5:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8020a9:	83 ec 08             	sub    $0x8,%esp
+  8020ac:	53                   	push   %ebx
+  8020ad:	56                   	push   %esi
+  8020ae:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8020b7:	75 f0                	jne    8020a9 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8020b9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8020bc:	8d 70 01             	lea    0x1(%eax),%esi
+  8020bf:	0f b6 00             	movzbl (%eax),%eax
+  8020c2:	0f be d0             	movsbl %al,%edx
+  8020c5:	85 d2                	test   %edx,%edx
+  8020c7:	0f 84 da 02 00 00    	je     8023a7 <vprintfmt+0x501>
+  8020cd:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8020d0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8020d3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8020d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8020d9:	eb 1e                	jmp    8020f9 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8020db:	83 ec 08             	sub    $0x8,%esp
+  8020de:	ff 75 0c             	push   0xc(%ebp)
+  8020e1:	52                   	push   %edx
+  8020e2:	ff 55 08             	call   *0x8(%ebp)
+  8020e5:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8020e8:	83 eb 01             	sub    $0x1,%ebx
+  8020eb:	83 c6 01             	add    $0x1,%esi
+  8020ee:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8020f2:	0f be d0             	movsbl %al,%edx
+  8020f5:	85 d2                	test   %edx,%edx
+  8020f7:	74 2a                	je     802123 <vprintfmt+0x27d>
+  8020f9:	85 ff                	test   %edi,%edi
+  8020fb:	78 05                	js     802102 <vprintfmt+0x25c>
+  8020fd:	83 ef 01             	sub    $0x1,%edi
+  802100:	78 59                	js     80215b <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802102:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802106:	74 d3                	je     8020db <vprintfmt+0x235>
+  802108:	0f be c0             	movsbl %al,%eax
+  80210b:	83 e8 20             	sub    $0x20,%eax
+  80210e:	83 f8 5e             	cmp    $0x5e,%eax
+  802111:	76 c8                	jbe    8020db <vprintfmt+0x235>
+					putch('?', putdat);
+  802113:	83 ec 08             	sub    $0x8,%esp
+  802116:	ff 75 0c             	push   0xc(%ebp)
+  802119:	6a 3f                	push   $0x3f
+  80211b:	ff 55 08             	call   *0x8(%ebp)
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	eb c5                	jmp    8020e8 <vprintfmt+0x242>
+  802123:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802126:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80212c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80212f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802133:	7e 1b                	jle    802150 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802135:	83 ec 08             	sub    $0x8,%esp
+  802138:	53                   	push   %ebx
+  802139:	6a 20                	push   $0x20
+  80213b:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	83 ee 01             	sub    $0x1,%esi
+  802143:	75 f0                	jne    802135 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802145:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802148:	89 45 14             	mov    %eax,0x14(%ebp)
+  80214b:	e9 67 fd ff ff       	jmp    801eb7 <vprintfmt+0x11>
+  802150:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802153:	89 45 14             	mov    %eax,0x14(%ebp)
+  802156:	e9 5c fd ff ff       	jmp    801eb7 <vprintfmt+0x11>
+  80215b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80215e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802161:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802164:	eb c6                	jmp    80212c <vprintfmt+0x286>
+	if (lflag >= 2)
+  802166:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802169:	89 55 10             	mov    %edx,0x10(%ebp)
+  80216c:	83 f9 01             	cmp    $0x1,%ecx
+  80216f:	7f 1f                	jg     802190 <vprintfmt+0x2ea>
+	else if (lflag)
+  802171:	85 c9                	test   %ecx,%ecx
+  802173:	74 67                	je     8021dc <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802175:	8b 45 14             	mov    0x14(%ebp),%eax
+  802178:	8b 30                	mov    (%eax),%esi
+  80217a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80217d:	89 f0                	mov    %esi,%eax
+  80217f:	c1 f8 1f             	sar    $0x1f,%eax
+  802182:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802185:	8b 45 14             	mov    0x14(%ebp),%eax
+  802188:	8d 40 04             	lea    0x4(%eax),%eax
+  80218b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80218e:	eb 17                	jmp    8021a7 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802190:	8b 45 14             	mov    0x14(%ebp),%eax
+  802193:	8b 50 04             	mov    0x4(%eax),%edx
+  802196:	8b 00                	mov    (%eax),%eax
+  802198:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80219b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80219e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021a1:	8d 40 08             	lea    0x8(%eax),%eax
+  8021a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8021a7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8021aa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8021ad:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8021b2:	85 c9                	test   %ecx,%ecx
+  8021b4:	0f 89 12 01 00 00    	jns    8022cc <vprintfmt+0x426>
+				putch('-', putdat);
+  8021ba:	83 ec 08             	sub    $0x8,%esp
+  8021bd:	53                   	push   %ebx
+  8021be:	6a 2d                	push   $0x2d
+  8021c0:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8021c2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8021c5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8021c8:	f7 da                	neg    %edx
+  8021ca:	83 d1 00             	adc    $0x0,%ecx
+  8021cd:	f7 d9                	neg    %ecx
+  8021cf:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8021d2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8021d7:	e9 f0 00 00 00       	jmp    8022cc <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8021dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021df:	8b 30                	mov    (%eax),%esi
+  8021e1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8021e4:	89 f0                	mov    %esi,%eax
+  8021e6:	c1 f8 1f             	sar    $0x1f,%eax
+  8021e9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8021ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8021f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8021f5:	eb b0                	jmp    8021a7 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8021f7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8021fa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8021fd:	83 f9 01             	cmp    $0x1,%ecx
+  802200:	7f 1e                	jg     802220 <vprintfmt+0x37a>
+	else if (lflag)
+  802202:	85 c9                	test   %ecx,%ecx
+  802204:	74 32                	je     802238 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802206:	8b 45 14             	mov    0x14(%ebp),%eax
+  802209:	8b 10                	mov    (%eax),%edx
+  80220b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802210:	8d 40 04             	lea    0x4(%eax),%eax
+  802213:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802216:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80221b:	e9 ac 00 00 00       	jmp    8022cc <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802220:	8b 45 14             	mov    0x14(%ebp),%eax
+  802223:	8b 10                	mov    (%eax),%edx
+  802225:	8b 48 04             	mov    0x4(%eax),%ecx
+  802228:	8d 40 08             	lea    0x8(%eax),%eax
+  80222b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80222e:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802233:	e9 94 00 00 00       	jmp    8022cc <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802238:	8b 45 14             	mov    0x14(%ebp),%eax
+  80223b:	8b 10                	mov    (%eax),%edx
+  80223d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802242:	8d 40 04             	lea    0x4(%eax),%eax
+  802245:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802248:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80224d:	eb 7d                	jmp    8022cc <vprintfmt+0x426>
+	if (lflag >= 2)
+  80224f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802252:	89 55 10             	mov    %edx,0x10(%ebp)
+  802255:	83 f9 01             	cmp    $0x1,%ecx
+  802258:	7f 1b                	jg     802275 <vprintfmt+0x3cf>
+	else if (lflag)
+  80225a:	85 c9                	test   %ecx,%ecx
+  80225c:	74 2c                	je     80228a <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80225e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802261:	8b 10                	mov    (%eax),%edx
+  802263:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802268:	8d 40 04             	lea    0x4(%eax),%eax
+  80226b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80226e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802273:	eb 57                	jmp    8022cc <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802275:	8b 45 14             	mov    0x14(%ebp),%eax
+  802278:	8b 10                	mov    (%eax),%edx
+  80227a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80227d:	8d 40 08             	lea    0x8(%eax),%eax
+  802280:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802283:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802288:	eb 42                	jmp    8022cc <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80228a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80228d:	8b 10                	mov    (%eax),%edx
+  80228f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802294:	8d 40 04             	lea    0x4(%eax),%eax
+  802297:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80229a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80229f:	eb 2b                	jmp    8022cc <vprintfmt+0x426>
+			putch('0', putdat);
+  8022a1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8022a4:	83 ec 08             	sub    $0x8,%esp
+  8022a7:	53                   	push   %ebx
+  8022a8:	6a 30                	push   $0x30
+  8022aa:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8022ac:	83 c4 08             	add    $0x8,%esp
+  8022af:	53                   	push   %ebx
+  8022b0:	6a 78                	push   $0x78
+  8022b2:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8022b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022b7:	8b 10                	mov    (%eax),%edx
+  8022b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8022be:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8022c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8022c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8022c7:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8022cc:	83 ec 0c             	sub    $0xc,%esp
+  8022cf:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8022d3:	50                   	push   %eax
+  8022d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8022d7:	56                   	push   %esi
+  8022d8:	51                   	push   %ecx
+  8022d9:	52                   	push   %edx
+  8022da:	89 da                	mov    %ebx,%edx
+  8022dc:	89 f8                	mov    %edi,%eax
+  8022de:	e8 d8 fa ff ff       	call   801dbb <printnum>
+			break;
+  8022e3:	83 c4 20             	add    $0x20,%esp
+  8022e6:	e9 cc fb ff ff       	jmp    801eb7 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8022eb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8022ee:	89 55 10             	mov    %edx,0x10(%ebp)
+  8022f1:	83 f9 01             	cmp    $0x1,%ecx
+  8022f4:	7f 1b                	jg     802311 <vprintfmt+0x46b>
+	else if (lflag)
+  8022f6:	85 c9                	test   %ecx,%ecx
+  8022f8:	74 2c                	je     802326 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8022fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022fd:	8b 10                	mov    (%eax),%edx
+  8022ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802304:	8d 40 04             	lea    0x4(%eax),%eax
+  802307:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80230a:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80230f:	eb bb                	jmp    8022cc <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802311:	8b 45 14             	mov    0x14(%ebp),%eax
+  802314:	8b 10                	mov    (%eax),%edx
+  802316:	8b 48 04             	mov    0x4(%eax),%ecx
+  802319:	8d 40 08             	lea    0x8(%eax),%eax
+  80231c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80231f:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  802324:	eb a6                	jmp    8022cc <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802326:	8b 45 14             	mov    0x14(%ebp),%eax
+  802329:	8b 10                	mov    (%eax),%edx
+  80232b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802330:	8d 40 04             	lea    0x4(%eax),%eax
+  802333:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802336:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80233b:	eb 8f                	jmp    8022cc <vprintfmt+0x426>
+			putch(ch, putdat);
+  80233d:	89 55 10             	mov    %edx,0x10(%ebp)
+  802340:	83 ec 08             	sub    $0x8,%esp
+  802343:	53                   	push   %ebx
+  802344:	6a 25                	push   $0x25
+  802346:	ff d7                	call   *%edi
+			break;
+  802348:	83 c4 10             	add    $0x10,%esp
+  80234b:	e9 67 fb ff ff       	jmp    801eb7 <vprintfmt+0x11>
+			putch('%', putdat);
+  802350:	83 ec 08             	sub    $0x8,%esp
+  802353:	53                   	push   %ebx
+  802354:	6a 25                	push   $0x25
+  802356:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802358:	83 c4 10             	add    $0x10,%esp
+  80235b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80235f:	0f 84 ba fb ff ff    	je     801f1f <vprintfmt+0x79>
+  802365:	89 75 10             	mov    %esi,0x10(%ebp)
+  802368:	89 f0                	mov    %esi,%eax
+  80236a:	83 e8 01             	sub    $0x1,%eax
+  80236d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802371:	75 f7                	jne    80236a <vprintfmt+0x4c4>
+  802373:	89 45 10             	mov    %eax,0x10(%ebp)
+  802376:	e9 3c fb ff ff       	jmp    801eb7 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80237b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80237e:	8d 70 01             	lea    0x1(%eax),%esi
+  802381:	0f b6 00             	movzbl (%eax),%eax
+  802384:	0f be d0             	movsbl %al,%edx
+  802387:	85 d2                	test   %edx,%edx
+  802389:	74 11                	je     80239c <vprintfmt+0x4f6>
+  80238b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80238e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802391:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802394:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802397:	e9 5d fd ff ff       	jmp    8020f9 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80239c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80239f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8023a2:	e9 10 fb ff ff       	jmp    801eb7 <vprintfmt+0x11>
+  8023a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8023aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8023ad:	e9 05 fb ff ff       	jmp    801eb7 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8023b2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8023b6:	7e 0a                	jle    8023c2 <vprintfmt+0x51c>
+  8023b8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8023bc:	0f 85 bd fc ff ff    	jne    80207f <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8023c2:	ba 28 00 00 00       	mov    $0x28,%edx
+  8023c7:	b8 28 00 00 00       	mov    $0x28,%eax
+  8023cc:	be 31 5c 80 00       	mov    $0x805c31,%esi
+  8023d1:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8023d4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8023d7:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8023da:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023dd:	e9 17 fd ff ff       	jmp    8020f9 <vprintfmt+0x253>
+}
+  8023e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e5:	5b                   	pop    %ebx
+  8023e6:	5e                   	pop    %esi
+  8023e7:	5f                   	pop    %edi
+  8023e8:	5d                   	pop    %ebp
+  8023e9:	c3                   	ret
+
+008023ea <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	83 ec 18             	sub    $0x18,%esp
+  8023f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8023f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8023f9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8023fd:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802400:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802407:	85 c0                	test   %eax,%eax
+  802409:	74 26                	je     802431 <vsnprintf+0x47>
+  80240b:	85 d2                	test   %edx,%edx
+  80240d:	7e 22                	jle    802431 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80240f:	ff 75 14             	push   0x14(%ebp)
+  802412:	ff 75 10             	push   0x10(%ebp)
+  802415:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802418:	50                   	push   %eax
+  802419:	68 6c 1e 80 00       	push   $0x801e6c
+  80241e:	e8 83 fa ff ff       	call   801ea6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802423:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802426:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242c:	83 c4 10             	add    $0x10,%esp
+}
+  80242f:	c9                   	leave
+  802430:	c3                   	ret
+		return -E_INVAL;
+  802431:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802436:	eb f7                	jmp    80242f <vsnprintf+0x45>
+
+00802438 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802438:	55                   	push   %ebp
+  802439:	89 e5                	mov    %esp,%ebp
+  80243b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80243e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802441:	50                   	push   %eax
+  802442:	ff 75 10             	push   0x10(%ebp)
+  802445:	ff 75 0c             	push   0xc(%ebp)
+  802448:	ff 75 08             	push   0x8(%ebp)
+  80244b:	e8 9a ff ff ff       	call   8023ea <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802450:	c9                   	leave
+  802451:	c3                   	ret
+
+00802452 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802458:	80 3a 00             	cmpb   $0x0,(%edx)
+  80245b:	74 10                	je     80246d <strlen+0x1b>
+  80245d:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  802462:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802465:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802469:	75 f7                	jne    802462 <strlen+0x10>
+	return n;
+}
+  80246b:	5d                   	pop    %ebp
+  80246c:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80246d:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  802472:	eb f7                	jmp    80246b <strlen+0x19>
+
+00802474 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80247a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80247d:	85 d2                	test   %edx,%edx
+  80247f:	74 16                	je     802497 <strnlen+0x23>
+  802481:	b8 00 00 00 00       	mov    $0x0,%eax
+  802486:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80248a:	74 09                	je     802495 <strnlen+0x21>
+		n++;
+  80248c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80248f:	39 d0                	cmp    %edx,%eax
+  802491:	75 f3                	jne    802486 <strnlen+0x12>
+		n++;
+  802493:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  802495:	5d                   	pop    %ebp
+  802496:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249c:	eb f7                	jmp    802495 <strnlen+0x21>
+
+0080249e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80249e:	55                   	push   %ebp
+  80249f:	89 e5                	mov    %esp,%ebp
+  8024a1:	53                   	push   %ebx
+  8024a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8024a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8024a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ad:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8024b1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8024b4:	83 c0 01             	add    $0x1,%eax
+  8024b7:	84 d2                	test   %dl,%dl
+  8024b9:	75 f2                	jne    8024ad <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8024bb:	89 c8                	mov    %ecx,%eax
+  8024bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c0:	c9                   	leave
+  8024c1:	c3                   	ret
+
+008024c2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8024c2:	55                   	push   %ebp
+  8024c3:	89 e5                	mov    %esp,%ebp
+  8024c5:	53                   	push   %ebx
+  8024c6:	83 ec 10             	sub    $0x10,%esp
+  8024c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8024cc:	53                   	push   %ebx
+  8024cd:	e8 80 ff ff ff       	call   802452 <strlen>
+  8024d2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8024d5:	ff 75 0c             	push   0xc(%ebp)
+  8024d8:	01 d8                	add    %ebx,%eax
+  8024da:	50                   	push   %eax
+  8024db:	e8 be ff ff ff       	call   80249e <strcpy>
+	return dst;
+}
+  8024e0:	89 d8                	mov    %ebx,%eax
+  8024e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+
+008024e7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	56                   	push   %esi
+  8024eb:	53                   	push   %ebx
+  8024ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8024f5:	85 db                	test   %ebx,%ebx
+  8024f7:	74 17                	je     802510 <strncpy+0x29>
+  8024f9:	01 f3                	add    %esi,%ebx
+  8024fb:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8024fd:	83 c0 01             	add    $0x1,%eax
+  802500:	0f b6 0a             	movzbl (%edx),%ecx
+  802503:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802506:	80 f9 01             	cmp    $0x1,%cl
+  802509:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80250c:	39 c3                	cmp    %eax,%ebx
+  80250e:	75 ed                	jne    8024fd <strncpy+0x16>
+	}
+	return ret;
+}
+  802510:	89 f0                	mov    %esi,%eax
+  802512:	5b                   	pop    %ebx
+  802513:	5e                   	pop    %esi
+  802514:	5d                   	pop    %ebp
+  802515:	c3                   	ret
+
+00802516 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802516:	55                   	push   %ebp
+  802517:	89 e5                	mov    %esp,%ebp
+  802519:	56                   	push   %esi
+  80251a:	53                   	push   %ebx
+  80251b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80251e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802521:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802524:	89 f0                	mov    %esi,%eax
+  802526:	85 db                	test   %ebx,%ebx
+  802528:	74 1e                	je     802548 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  80252a:	83 eb 01             	sub    $0x1,%ebx
+  80252d:	74 16                	je     802545 <strlcpy+0x2f>
+  80252f:	01 f3                	add    %esi,%ebx
+  802531:	0f b6 0a             	movzbl (%edx),%ecx
+  802534:	84 c9                	test   %cl,%cl
+  802536:	74 0d                	je     802545 <strlcpy+0x2f>
+			*dst++ = *src++;
+  802538:	83 c2 01             	add    $0x1,%edx
+  80253b:	83 c0 01             	add    $0x1,%eax
+  80253e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  802541:	39 d8                	cmp    %ebx,%eax
+  802543:	75 ec                	jne    802531 <strlcpy+0x1b>
+		*dst = '\0';
+  802545:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802548:	29 f0                	sub    %esi,%eax
+}
+  80254a:	5b                   	pop    %ebx
+  80254b:	5e                   	pop    %esi
+  80254c:	5d                   	pop    %ebp
+  80254d:	c3                   	ret
+
+0080254e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80254e:	55                   	push   %ebp
+  80254f:	89 e5                	mov    %esp,%ebp
+  802551:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802554:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802557:	0f b6 01             	movzbl (%ecx),%eax
+  80255a:	84 c0                	test   %al,%al
+  80255c:	74 11                	je     80256f <strcmp+0x21>
+  80255e:	38 02                	cmp    %al,(%edx)
+  802560:	75 0d                	jne    80256f <strcmp+0x21>
+		p++, q++;
+  802562:	83 c1 01             	add    $0x1,%ecx
+  802565:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802568:	0f b6 01             	movzbl (%ecx),%eax
+  80256b:	84 c0                	test   %al,%al
+  80256d:	75 ef                	jne    80255e <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80256f:	0f b6 c0             	movzbl %al,%eax
+  802572:	0f b6 12             	movzbl (%edx),%edx
+  802575:	29 d0                	sub    %edx,%eax
+}
+  802577:	5d                   	pop    %ebp
+  802578:	c3                   	ret
+
+00802579 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802579:	55                   	push   %ebp
+  80257a:	89 e5                	mov    %esp,%ebp
+  80257c:	53                   	push   %ebx
+  80257d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802580:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802583:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  802586:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  80258b:	85 d2                	test   %edx,%edx
+  80258d:	74 2e                	je     8025bd <strncmp+0x44>
+  80258f:	0f b6 01             	movzbl (%ecx),%eax
+  802592:	84 c0                	test   %al,%al
+  802594:	74 16                	je     8025ac <strncmp+0x33>
+  802596:	3a 03                	cmp    (%ebx),%al
+  802598:	75 12                	jne    8025ac <strncmp+0x33>
+		n--, p++, q++;
+  80259a:	83 c1 01             	add    $0x1,%ecx
+  80259d:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8025a0:	83 ea 01             	sub    $0x1,%edx
+  8025a3:	75 ea                	jne    80258f <strncmp+0x16>
+		return 0;
+  8025a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025aa:	eb 11                	jmp    8025bd <strncmp+0x44>
+  8025ac:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8025b1:	85 d2                	test   %edx,%edx
+  8025b3:	74 08                	je     8025bd <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8025b5:	0f b6 01             	movzbl (%ecx),%eax
+  8025b8:	0f b6 13             	movzbl (%ebx),%edx
+  8025bb:	29 d0                	sub    %edx,%eax
+}
+  8025bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025c0:	c9                   	leave
+  8025c1:	c3                   	ret
+
+008025c2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+  8025c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8025cc:	0f b6 10             	movzbl (%eax),%edx
+  8025cf:	84 d2                	test   %dl,%dl
+  8025d1:	74 15                	je     8025e8 <strchr+0x26>
+		if (*s == c)
+  8025d3:	38 d1                	cmp    %dl,%cl
+  8025d5:	74 0f                	je     8025e6 <strchr+0x24>
+	for (; *s; s++)
+  8025d7:	83 c0 01             	add    $0x1,%eax
+  8025da:	0f b6 10             	movzbl (%eax),%edx
+  8025dd:	84 d2                	test   %dl,%dl
+  8025df:	75 f2                	jne    8025d3 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8025e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e6:	5d                   	pop    %ebp
+  8025e7:	c3                   	ret
+	return 0;
+  8025e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ed:	eb f7                	jmp    8025e6 <strchr+0x24>
+
+008025ef <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8025ef:	55                   	push   %ebp
+  8025f0:	89 e5                	mov    %esp,%ebp
+  8025f2:	53                   	push   %ebx
+  8025f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  8025f9:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  8025fc:	38 d3                	cmp    %dl,%bl
+  8025fe:	74 14                	je     802614 <strfind+0x25>
+  802600:	89 d1                	mov    %edx,%ecx
+  802602:	84 db                	test   %bl,%bl
+  802604:	74 0e                	je     802614 <strfind+0x25>
+	for (; *s; s++)
+  802606:	83 c0 01             	add    $0x1,%eax
+  802609:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80260c:	38 ca                	cmp    %cl,%dl
+  80260e:	74 04                	je     802614 <strfind+0x25>
+  802610:	84 d2                	test   %dl,%dl
+  802612:	75 f2                	jne    802606 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  802614:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802617:	c9                   	leave
+  802618:	c3                   	ret
+
+00802619 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+  80261c:	57                   	push   %edi
+  80261d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802620:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802623:	85 c9                	test   %ecx,%ecx
+  802625:	74 20                	je     802647 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802627:	89 f8                	mov    %edi,%eax
+  802629:	09 c8                	or     %ecx,%eax
+  80262b:	a8 03                	test   $0x3,%al
+  80262d:	75 12                	jne    802641 <memset+0x28>
+		c &= 0xFF;
+  80262f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802633:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802639:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80263c:	fc                   	cld
+  80263d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80263f:	eb 06                	jmp    802647 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802641:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802644:	fc                   	cld
+  802645:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802647:	89 f8                	mov    %edi,%eax
+  802649:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80264c:	c9                   	leave
+  80264d:	c3                   	ret
+
+0080264e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80264e:	55                   	push   %ebp
+  80264f:	89 e5                	mov    %esp,%ebp
+  802651:	57                   	push   %edi
+  802652:	56                   	push   %esi
+  802653:	8b 45 08             	mov    0x8(%ebp),%eax
+  802656:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802659:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80265c:	39 c6                	cmp    %eax,%esi
+  80265e:	73 32                	jae    802692 <memmove+0x44>
+  802660:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802663:	39 d0                	cmp    %edx,%eax
+  802665:	73 2b                	jae    802692 <memmove+0x44>
+		s += n;
+		d += n;
+  802667:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80266a:	89 d6                	mov    %edx,%esi
+  80266c:	09 fe                	or     %edi,%esi
+  80266e:	09 ce                	or     %ecx,%esi
+  802670:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802676:	75 0e                	jne    802686 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802678:	83 ef 04             	sub    $0x4,%edi
+  80267b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80267e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802681:	fd                   	std
+  802682:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802684:	eb 09                	jmp    80268f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802686:	83 ef 01             	sub    $0x1,%edi
+  802689:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80268c:	fd                   	std
+  80268d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80268f:	fc                   	cld
+  802690:	eb 1a                	jmp    8026ac <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802692:	89 f2                	mov    %esi,%edx
+  802694:	09 c2                	or     %eax,%edx
+  802696:	09 ca                	or     %ecx,%edx
+  802698:	f6 c2 03             	test   $0x3,%dl
+  80269b:	75 0a                	jne    8026a7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80269d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8026a0:	89 c7                	mov    %eax,%edi
+  8026a2:	fc                   	cld
+  8026a3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8026a5:	eb 05                	jmp    8026ac <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8026a7:	89 c7                	mov    %eax,%edi
+  8026a9:	fc                   	cld
+  8026aa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8026ac:	5e                   	pop    %esi
+  8026ad:	5f                   	pop    %edi
+  8026ae:	5d                   	pop    %ebp
+  8026af:	c3                   	ret
+
+008026b0 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8026b0:	55                   	push   %ebp
+  8026b1:	89 e5                	mov    %esp,%ebp
+  8026b3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8026b6:	ff 75 10             	push   0x10(%ebp)
+  8026b9:	ff 75 0c             	push   0xc(%ebp)
+  8026bc:	ff 75 08             	push   0x8(%ebp)
+  8026bf:	e8 8a ff ff ff       	call   80264e <memmove>
+}
+  8026c4:	c9                   	leave
+  8026c5:	c3                   	ret
+
+008026c6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	56                   	push   %esi
+  8026ca:	53                   	push   %ebx
+  8026cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026d1:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8026d4:	85 f6                	test   %esi,%esi
+  8026d6:	74 29                	je     802701 <memcmp+0x3b>
+  8026d8:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8026da:	0f b6 08             	movzbl (%eax),%ecx
+  8026dd:	0f b6 1a             	movzbl (%edx),%ebx
+  8026e0:	38 d9                	cmp    %bl,%cl
+  8026e2:	75 11                	jne    8026f5 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8026e4:	83 c0 01             	add    $0x1,%eax
+  8026e7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8026ea:	39 c6                	cmp    %eax,%esi
+  8026ec:	75 ec                	jne    8026da <memcmp+0x14>
+	}
+
+	return 0;
+  8026ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f3:	eb 08                	jmp    8026fd <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  8026f5:	0f b6 c1             	movzbl %cl,%eax
+  8026f8:	0f b6 db             	movzbl %bl,%ebx
+  8026fb:	29 d8                	sub    %ebx,%eax
+}
+  8026fd:	5b                   	pop    %ebx
+  8026fe:	5e                   	pop    %esi
+  8026ff:	5d                   	pop    %ebp
+  802700:	c3                   	ret
+	return 0;
+  802701:	b8 00 00 00 00       	mov    $0x0,%eax
+  802706:	eb f5                	jmp    8026fd <memcmp+0x37>
+
+00802708 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802708:	55                   	push   %ebp
+  802709:	89 e5                	mov    %esp,%ebp
+  80270b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80270e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802711:	89 c2                	mov    %eax,%edx
+  802713:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802716:	39 d0                	cmp    %edx,%eax
+  802718:	73 0d                	jae    802727 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80271a:	38 08                	cmp    %cl,(%eax)
+  80271c:	74 0d                	je     80272b <memfind+0x23>
+	for (; s < ends; s++)
+  80271e:	83 c0 01             	add    $0x1,%eax
+  802721:	39 c2                	cmp    %eax,%edx
+  802723:	75 f5                	jne    80271a <memfind+0x12>
+  802725:	eb 06                	jmp    80272d <memfind+0x25>
+  802727:	89 c2                	mov    %eax,%edx
+  802729:	eb 02                	jmp    80272d <memfind+0x25>
+  80272b:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  80272d:	89 d0                	mov    %edx,%eax
+  80272f:	5d                   	pop    %ebp
+  802730:	c3                   	ret
+
+00802731 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802731:	55                   	push   %ebp
+  802732:	89 e5                	mov    %esp,%ebp
+  802734:	57                   	push   %edi
+  802735:	56                   	push   %esi
+  802736:	53                   	push   %ebx
+  802737:	8b 55 08             	mov    0x8(%ebp),%edx
+  80273a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80273d:	0f b6 02             	movzbl (%edx),%eax
+  802740:	3c 20                	cmp    $0x20,%al
+  802742:	74 04                	je     802748 <strtol+0x17>
+  802744:	3c 09                	cmp    $0x9,%al
+  802746:	75 0e                	jne    802756 <strtol+0x25>
+		s++;
+  802748:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80274b:	0f b6 02             	movzbl (%edx),%eax
+  80274e:	3c 20                	cmp    $0x20,%al
+  802750:	74 f6                	je     802748 <strtol+0x17>
+  802752:	3c 09                	cmp    $0x9,%al
+  802754:	74 f2                	je     802748 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  802756:	3c 2b                	cmp    $0x2b,%al
+  802758:	74 2a                	je     802784 <strtol+0x53>
+	int neg = 0;
+  80275a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80275f:	3c 2d                	cmp    $0x2d,%al
+  802761:	74 2b                	je     80278e <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802763:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802769:	75 0f                	jne    80277a <strtol+0x49>
+  80276b:	80 3a 30             	cmpb   $0x30,(%edx)
+  80276e:	74 28                	je     802798 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802770:	85 db                	test   %ebx,%ebx
+  802772:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802777:	0f 44 d8             	cmove  %eax,%ebx
+  80277a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80277f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802782:	eb 46                	jmp    8027ca <strtol+0x99>
+		s++;
+  802784:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802787:	bf 00 00 00 00       	mov    $0x0,%edi
+  80278c:	eb d5                	jmp    802763 <strtol+0x32>
+		s++, neg = 1;
+  80278e:	83 c2 01             	add    $0x1,%edx
+  802791:	bf 01 00 00 00       	mov    $0x1,%edi
+  802796:	eb cb                	jmp    802763 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802798:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80279c:	74 0e                	je     8027ac <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  80279e:	85 db                	test   %ebx,%ebx
+  8027a0:	75 d8                	jne    80277a <strtol+0x49>
+		s++, base = 8;
+  8027a2:	83 c2 01             	add    $0x1,%edx
+  8027a5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8027aa:	eb ce                	jmp    80277a <strtol+0x49>
+		s += 2, base = 16;
+  8027ac:	83 c2 02             	add    $0x2,%edx
+  8027af:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8027b4:	eb c4                	jmp    80277a <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8027b6:	0f be c0             	movsbl %al,%eax
+  8027b9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8027bc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8027bf:	7d 3a                	jge    8027fb <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8027c1:	83 c2 01             	add    $0x1,%edx
+  8027c4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8027c8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8027ca:	0f b6 02             	movzbl (%edx),%eax
+  8027cd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8027d0:	89 f3                	mov    %esi,%ebx
+  8027d2:	80 fb 09             	cmp    $0x9,%bl
+  8027d5:	76 df                	jbe    8027b6 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8027d7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8027da:	89 f3                	mov    %esi,%ebx
+  8027dc:	80 fb 19             	cmp    $0x19,%bl
+  8027df:	77 08                	ja     8027e9 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8027e1:	0f be c0             	movsbl %al,%eax
+  8027e4:	83 e8 57             	sub    $0x57,%eax
+  8027e7:	eb d3                	jmp    8027bc <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8027e9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8027ec:	89 f3                	mov    %esi,%ebx
+  8027ee:	80 fb 19             	cmp    $0x19,%bl
+  8027f1:	77 08                	ja     8027fb <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8027f3:	0f be c0             	movsbl %al,%eax
+  8027f6:	83 e8 37             	sub    $0x37,%eax
+  8027f9:	eb c1                	jmp    8027bc <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8027fb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8027ff:	74 05                	je     802806 <strtol+0xd5>
+		*endptr = (char *) s;
+  802801:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802804:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802806:	89 c8                	mov    %ecx,%eax
+  802808:	f7 d8                	neg    %eax
+  80280a:	85 ff                	test   %edi,%edi
+  80280c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80280f:	89 c8                	mov    %ecx,%eax
+  802811:	5b                   	pop    %ebx
+  802812:	5e                   	pop    %esi
+  802813:	5f                   	pop    %edi
+  802814:	5d                   	pop    %ebp
+  802815:	c3                   	ret
+
+00802816 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	57                   	push   %edi
+  80281a:	56                   	push   %esi
+  80281b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80281c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802821:	8b 55 08             	mov    0x8(%ebp),%edx
+  802824:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802827:	89 c3                	mov    %eax,%ebx
+  802829:	89 c7                	mov    %eax,%edi
+  80282b:	89 c6                	mov    %eax,%esi
+  80282d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80282f:	5b                   	pop    %ebx
+  802830:	5e                   	pop    %esi
+  802831:	5f                   	pop    %edi
+  802832:	5d                   	pop    %ebp
+  802833:	c3                   	ret
+
+00802834 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802834:	55                   	push   %ebp
+  802835:	89 e5                	mov    %esp,%ebp
+  802837:	57                   	push   %edi
+  802838:	56                   	push   %esi
+  802839:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80283a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802844:	89 d1                	mov    %edx,%ecx
+  802846:	89 d3                	mov    %edx,%ebx
+  802848:	89 d7                	mov    %edx,%edi
+  80284a:	89 d6                	mov    %edx,%esi
+  80284c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80284e:	5b                   	pop    %ebx
+  80284f:	5e                   	pop    %esi
+  802850:	5f                   	pop    %edi
+  802851:	5d                   	pop    %ebp
+  802852:	c3                   	ret
+
+00802853 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802853:	55                   	push   %ebp
+  802854:	89 e5                	mov    %esp,%ebp
+  802856:	57                   	push   %edi
+  802857:	56                   	push   %esi
+  802858:	53                   	push   %ebx
+  802859:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80285c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802861:	8b 55 08             	mov    0x8(%ebp),%edx
+  802864:	b8 03 00 00 00       	mov    $0x3,%eax
+  802869:	89 cb                	mov    %ecx,%ebx
+  80286b:	89 cf                	mov    %ecx,%edi
+  80286d:	89 ce                	mov    %ecx,%esi
+  80286f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802871:	85 c0                	test   %eax,%eax
+  802873:	7f 08                	jg     80287d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  802875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802878:	5b                   	pop    %ebx
+  802879:	5e                   	pop    %esi
+  80287a:	5f                   	pop    %edi
+  80287b:	5d                   	pop    %ebp
+  80287c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80287d:	83 ec 0c             	sub    $0xc,%esp
+  802880:	50                   	push   %eax
+  802881:	6a 03                	push   $0x3
+  802883:	68 4b 5f 80 00       	push   $0x805f4b
+  802888:	6a 23                	push   $0x23
+  80288a:	68 68 5f 80 00       	push   $0x805f68
+  80288f:	e8 38 f4 ff ff       	call   801ccc <_panic>
+
+00802894 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	57                   	push   %edi
+  802898:	56                   	push   %esi
+  802899:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80289a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80289f:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028a4:	89 d1                	mov    %edx,%ecx
+  8028a6:	89 d3                	mov    %edx,%ebx
+  8028a8:	89 d7                	mov    %edx,%edi
+  8028aa:	89 d6                	mov    %edx,%esi
+  8028ac:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8028ae:	5b                   	pop    %ebx
+  8028af:	5e                   	pop    %esi
+  8028b0:	5f                   	pop    %edi
+  8028b1:	5d                   	pop    %ebp
+  8028b2:	c3                   	ret
+
+008028b3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8028b3:	55                   	push   %ebp
+  8028b4:	89 e5                	mov    %esp,%ebp
+  8028b6:	57                   	push   %edi
+  8028b7:	56                   	push   %esi
+  8028b8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8028b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028be:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8028c3:	89 d1                	mov    %edx,%ecx
+  8028c5:	89 d3                	mov    %edx,%ebx
+  8028c7:	89 d7                	mov    %edx,%edi
+  8028c9:	89 d6                	mov    %edx,%esi
+  8028cb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8028cd:	5b                   	pop    %ebx
+  8028ce:	5e                   	pop    %esi
+  8028cf:	5f                   	pop    %edi
+  8028d0:	5d                   	pop    %ebp
+  8028d1:	c3                   	ret
+
+008028d2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8028d2:	55                   	push   %ebp
+  8028d3:	89 e5                	mov    %esp,%ebp
+  8028d5:	57                   	push   %edi
+  8028d6:	56                   	push   %esi
+  8028d7:	53                   	push   %ebx
+  8028d8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8028db:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028e6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028ee:	89 f7                	mov    %esi,%edi
+  8028f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	7f 08                	jg     8028fe <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8028f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f9:	5b                   	pop    %ebx
+  8028fa:	5e                   	pop    %esi
+  8028fb:	5f                   	pop    %edi
+  8028fc:	5d                   	pop    %ebp
+  8028fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8028fe:	83 ec 0c             	sub    $0xc,%esp
+  802901:	50                   	push   %eax
+  802902:	6a 04                	push   $0x4
+  802904:	68 4b 5f 80 00       	push   $0x805f4b
+  802909:	6a 23                	push   $0x23
+  80290b:	68 68 5f 80 00       	push   $0x805f68
+  802910:	e8 b7 f3 ff ff       	call   801ccc <_panic>
+
+00802915 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802915:	55                   	push   %ebp
+  802916:	89 e5                	mov    %esp,%ebp
+  802918:	57                   	push   %edi
+  802919:	56                   	push   %esi
+  80291a:	53                   	push   %ebx
+  80291b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80291e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802921:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802924:	b8 05 00 00 00       	mov    $0x5,%eax
+  802929:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80292c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80292f:	8b 75 18             	mov    0x18(%ebp),%esi
+  802932:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802934:	85 c0                	test   %eax,%eax
+  802936:	7f 08                	jg     802940 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  802938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80293b:	5b                   	pop    %ebx
+  80293c:	5e                   	pop    %esi
+  80293d:	5f                   	pop    %edi
+  80293e:	5d                   	pop    %ebp
+  80293f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802940:	83 ec 0c             	sub    $0xc,%esp
+  802943:	50                   	push   %eax
+  802944:	6a 05                	push   $0x5
+  802946:	68 4b 5f 80 00       	push   $0x805f4b
+  80294b:	6a 23                	push   $0x23
+  80294d:	68 68 5f 80 00       	push   $0x805f68
+  802952:	e8 75 f3 ff ff       	call   801ccc <_panic>
+
+00802957 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	57                   	push   %edi
+  80295b:	56                   	push   %esi
+  80295c:	53                   	push   %ebx
+  80295d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802960:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802965:	8b 55 08             	mov    0x8(%ebp),%edx
+  802968:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80296b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802970:	89 df                	mov    %ebx,%edi
+  802972:	89 de                	mov    %ebx,%esi
+  802974:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802976:	85 c0                	test   %eax,%eax
+  802978:	7f 08                	jg     802982 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80297a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80297d:	5b                   	pop    %ebx
+  80297e:	5e                   	pop    %esi
+  80297f:	5f                   	pop    %edi
+  802980:	5d                   	pop    %ebp
+  802981:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802982:	83 ec 0c             	sub    $0xc,%esp
+  802985:	50                   	push   %eax
+  802986:	6a 06                	push   $0x6
+  802988:	68 4b 5f 80 00       	push   $0x805f4b
+  80298d:	6a 23                	push   $0x23
+  80298f:	68 68 5f 80 00       	push   $0x805f68
+  802994:	e8 33 f3 ff ff       	call   801ccc <_panic>
+
+00802999 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802999:	55                   	push   %ebp
+  80299a:	89 e5                	mov    %esp,%ebp
+  80299c:	57                   	push   %edi
+  80299d:	56                   	push   %esi
+  80299e:	53                   	push   %ebx
+  80299f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8029a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029ad:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029b2:	89 df                	mov    %ebx,%edi
+  8029b4:	89 de                	mov    %ebx,%esi
+  8029b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8029b8:	85 c0                	test   %eax,%eax
+  8029ba:	7f 08                	jg     8029c4 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8029bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029bf:	5b                   	pop    %ebx
+  8029c0:	5e                   	pop    %esi
+  8029c1:	5f                   	pop    %edi
+  8029c2:	5d                   	pop    %ebp
+  8029c3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8029c4:	83 ec 0c             	sub    $0xc,%esp
+  8029c7:	50                   	push   %eax
+  8029c8:	6a 08                	push   $0x8
+  8029ca:	68 4b 5f 80 00       	push   $0x805f4b
+  8029cf:	6a 23                	push   $0x23
+  8029d1:	68 68 5f 80 00       	push   $0x805f68
+  8029d6:	e8 f1 f2 ff ff       	call   801ccc <_panic>
+
+008029db <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8029db:	55                   	push   %ebp
+  8029dc:	89 e5                	mov    %esp,%ebp
+  8029de:	57                   	push   %edi
+  8029df:	56                   	push   %esi
+  8029e0:	53                   	push   %ebx
+  8029e1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8029e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029ef:	b8 09 00 00 00       	mov    $0x9,%eax
+  8029f4:	89 df                	mov    %ebx,%edi
+  8029f6:	89 de                	mov    %ebx,%esi
+  8029f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	7f 08                	jg     802a06 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8029fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a01:	5b                   	pop    %ebx
+  802a02:	5e                   	pop    %esi
+  802a03:	5f                   	pop    %edi
+  802a04:	5d                   	pop    %ebp
+  802a05:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802a06:	83 ec 0c             	sub    $0xc,%esp
+  802a09:	50                   	push   %eax
+  802a0a:	6a 09                	push   $0x9
+  802a0c:	68 4b 5f 80 00       	push   $0x805f4b
+  802a11:	6a 23                	push   $0x23
+  802a13:	68 68 5f 80 00       	push   $0x805f68
+  802a18:	e8 af f2 ff ff       	call   801ccc <_panic>
+
+00802a1d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802a1d:	55                   	push   %ebp
+  802a1e:	89 e5                	mov    %esp,%ebp
+  802a20:	57                   	push   %edi
+  802a21:	56                   	push   %esi
+  802a22:	53                   	push   %ebx
+  802a23:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802a26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a31:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a36:	89 df                	mov    %ebx,%edi
+  802a38:	89 de                	mov    %ebx,%esi
+  802a3a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802a3c:	85 c0                	test   %eax,%eax
+  802a3e:	7f 08                	jg     802a48 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  802a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a43:	5b                   	pop    %ebx
+  802a44:	5e                   	pop    %esi
+  802a45:	5f                   	pop    %edi
+  802a46:	5d                   	pop    %ebp
+  802a47:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802a48:	83 ec 0c             	sub    $0xc,%esp
+  802a4b:	50                   	push   %eax
+  802a4c:	6a 0a                	push   $0xa
+  802a4e:	68 4b 5f 80 00       	push   $0x805f4b
+  802a53:	6a 23                	push   $0x23
+  802a55:	68 68 5f 80 00       	push   $0x805f68
+  802a5a:	e8 6d f2 ff ff       	call   801ccc <_panic>
+
+00802a5f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	57                   	push   %edi
+  802a63:	56                   	push   %esi
+  802a64:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802a65:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a6b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802a70:	be 00 00 00 00       	mov    $0x0,%esi
+  802a75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a78:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802a7b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  802a7d:	5b                   	pop    %ebx
+  802a7e:	5e                   	pop    %esi
+  802a7f:	5f                   	pop    %edi
+  802a80:	5d                   	pop    %ebp
+  802a81:	c3                   	ret
+
+00802a82 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802a82:	55                   	push   %ebp
+  802a83:	89 e5                	mov    %esp,%ebp
+  802a85:	57                   	push   %edi
+  802a86:	56                   	push   %esi
+  802a87:	53                   	push   %ebx
+  802a88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802a8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a90:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a93:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802a98:	89 cb                	mov    %ecx,%ebx
+  802a9a:	89 cf                	mov    %ecx,%edi
+  802a9c:	89 ce                	mov    %ecx,%esi
+  802a9e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	7f 08                	jg     802aac <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  802aa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aa7:	5b                   	pop    %ebx
+  802aa8:	5e                   	pop    %esi
+  802aa9:	5f                   	pop    %edi
+  802aaa:	5d                   	pop    %ebp
+  802aab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802aac:	83 ec 0c             	sub    $0xc,%esp
+  802aaf:	50                   	push   %eax
+  802ab0:	6a 0d                	push   $0xd
+  802ab2:	68 4b 5f 80 00       	push   $0x805f4b
+  802ab7:	6a 23                	push   $0x23
+  802ab9:	68 68 5f 80 00       	push   $0x805f68
+  802abe:	e8 09 f2 ff ff       	call   801ccc <_panic>
+
+00802ac3 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  802ac3:	55                   	push   %ebp
+  802ac4:	89 e5                	mov    %esp,%ebp
+  802ac6:	57                   	push   %edi
+  802ac7:	56                   	push   %esi
+  802ac8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802ac9:	8b 55 08             	mov    0x8(%ebp),%edx
+  802acc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802acf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802ad4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ad7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802ada:	8b 75 18             	mov    0x18(%ebp),%esi
+  802add:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  802adf:	5b                   	pop    %ebx
+  802ae0:	5e                   	pop    %esi
+  802ae1:	5f                   	pop    %edi
+  802ae2:	5d                   	pop    %ebp
+  802ae3:	c3                   	ret
+
+00802ae4 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  802ae4:	55                   	push   %ebp
+  802ae5:	89 e5                	mov    %esp,%ebp
+  802ae7:	57                   	push   %edi
+  802ae8:	56                   	push   %esi
+  802ae9:	53                   	push   %ebx
+  802aea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802aed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802af2:	8b 55 08             	mov    0x8(%ebp),%edx
+  802af5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802af8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802afd:	89 df                	mov    %ebx,%edi
+  802aff:	89 de                	mov    %ebx,%esi
+  802b01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802b03:	85 c0                	test   %eax,%eax
+  802b05:	7f 08                	jg     802b0f <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  802b07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b0a:	5b                   	pop    %ebx
+  802b0b:	5e                   	pop    %esi
+  802b0c:	5f                   	pop    %edi
+  802b0d:	5d                   	pop    %ebp
+  802b0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802b0f:	83 ec 0c             	sub    $0xc,%esp
+  802b12:	50                   	push   %eax
+  802b13:	6a 0d                	push   $0xd
+  802b15:	68 4b 5f 80 00       	push   $0x805f4b
+  802b1a:	6a 23                	push   $0x23
+  802b1c:	68 68 5f 80 00       	push   $0x805f68
+  802b21:	e8 a6 f1 ff ff       	call   801ccc <_panic>
+
+00802b26 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	57                   	push   %edi
+  802b2a:	56                   	push   %esi
+  802b2b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802b2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b31:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802b36:	89 d1                	mov    %edx,%ecx
+  802b38:	89 d3                	mov    %edx,%ebx
+  802b3a:	89 d7                	mov    %edx,%edi
+  802b3c:	89 d6                	mov    %edx,%esi
+  802b3e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  802b40:	5b                   	pop    %ebx
+  802b41:	5e                   	pop    %esi
+  802b42:	5f                   	pop    %edi
+  802b43:	5d                   	pop    %ebp
+  802b44:	c3                   	ret
+
+00802b45 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  802b45:	55                   	push   %ebp
+  802b46:	89 e5                	mov    %esp,%ebp
+  802b48:	57                   	push   %edi
+  802b49:	56                   	push   %esi
+  802b4a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802b4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b50:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b56:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802b5b:	89 df                	mov    %ebx,%edi
+  802b5d:	89 de                	mov    %ebx,%esi
+  802b5f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  802b61:	5b                   	pop    %ebx
+  802b62:	5e                   	pop    %esi
+  802b63:	5f                   	pop    %edi
+  802b64:	5d                   	pop    %ebp
+  802b65:	c3                   	ret
+
+00802b66 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  802b66:	55                   	push   %ebp
+  802b67:	89 e5                	mov    %esp,%ebp
+  802b69:	57                   	push   %edi
+  802b6a:	56                   	push   %esi
+  802b6b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802b6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b71:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b74:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b79:	89 cb                	mov    %ecx,%ebx
+  802b7b:	89 cf                	mov    %ecx,%edi
+  802b7d:	89 ce                	mov    %ecx,%esi
+  802b7f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  802b81:	5b                   	pop    %ebx
+  802b82:	5e                   	pop    %esi
+  802b83:	5f                   	pop    %edi
+  802b84:	5d                   	pop    %ebp
+  802b85:	c3                   	ret
+
+00802b86 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  802b86:	55                   	push   %ebp
+  802b87:	89 e5                	mov    %esp,%ebp
+  802b89:	57                   	push   %edi
+  802b8a:	56                   	push   %esi
+  802b8b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802b8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b91:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b97:	b8 11 00 00 00       	mov    $0x11,%eax
+  802b9c:	89 df                	mov    %ebx,%edi
+  802b9e:	89 de                	mov    %ebx,%esi
+  802ba0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  802ba2:	5b                   	pop    %ebx
+  802ba3:	5e                   	pop    %esi
+  802ba4:	5f                   	pop    %edi
+  802ba5:	5d                   	pop    %ebp
+  802ba6:	c3                   	ret
+
+00802ba7 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  802ba7:	55                   	push   %ebp
+  802ba8:	89 e5                	mov    %esp,%ebp
+  802baa:	57                   	push   %edi
+  802bab:	56                   	push   %esi
+  802bac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802bad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bb8:	b8 12 00 00 00       	mov    $0x12,%eax
+  802bbd:	89 df                	mov    %ebx,%edi
+  802bbf:	89 de                	mov    %ebx,%esi
+  802bc1:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  802bc3:	5b                   	pop    %ebx
+  802bc4:	5e                   	pop    %esi
+  802bc5:	5f                   	pop    %edi
+  802bc6:	5d                   	pop    %ebp
+  802bc7:	c3                   	ret
+
+00802bc8 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  802bc8:	55                   	push   %ebp
+  802bc9:	89 e5                	mov    %esp,%ebp
+  802bcb:	57                   	push   %edi
+  802bcc:	56                   	push   %esi
+  802bcd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802bce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bd6:	b8 13 00 00 00       	mov    $0x13,%eax
+  802bdb:	89 cb                	mov    %ecx,%ebx
+  802bdd:	89 cf                	mov    %ecx,%edi
+  802bdf:	89 ce                	mov    %ecx,%esi
+  802be1:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  802be3:	5b                   	pop    %ebx
+  802be4:	5e                   	pop    %esi
+  802be5:	5f                   	pop    %edi
+  802be6:	5d                   	pop    %ebp
+  802be7:	c3                   	ret
+
+00802be8 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  802be8:	55                   	push   %ebp
+  802be9:	89 e5                	mov    %esp,%ebp
+  802beb:	57                   	push   %edi
+  802bec:	56                   	push   %esi
+  802bed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802bee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bf3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bf6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bf9:	b8 14 00 00 00       	mov    $0x14,%eax
+  802bfe:	89 df                	mov    %ebx,%edi
+  802c00:	89 de                	mov    %ebx,%esi
+  802c02:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  802c04:	5b                   	pop    %ebx
+  802c05:	5e                   	pop    %esi
+  802c06:	5f                   	pop    %edi
+  802c07:	5d                   	pop    %ebp
+  802c08:	c3                   	ret
+
+00802c09 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  802c09:	55                   	push   %ebp
+  802c0a:	89 e5                	mov    %esp,%ebp
+  802c0c:	57                   	push   %edi
+  802c0d:	56                   	push   %esi
+  802c0e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802c0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c14:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c17:	b8 15 00 00 00       	mov    $0x15,%eax
+  802c1c:	89 cb                	mov    %ecx,%ebx
+  802c1e:	89 cf                	mov    %ecx,%edi
+  802c20:	89 ce                	mov    %ecx,%esi
+  802c22:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  802c24:	5b                   	pop    %ebx
+  802c25:	5e                   	pop    %esi
+  802c26:	5f                   	pop    %edi
+  802c27:	5d                   	pop    %ebp
+  802c28:	c3                   	ret
+
+00802c29 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  802c29:	55                   	push   %ebp
+  802c2a:	89 e5                	mov    %esp,%ebp
+  802c2c:	57                   	push   %edi
+  802c2d:	56                   	push   %esi
+  802c2e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802c2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c3a:	b8 16 00 00 00       	mov    $0x16,%eax
+  802c3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c42:	89 f7                	mov    %esi,%edi
+  802c44:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  802c46:	5b                   	pop    %ebx
+  802c47:	5e                   	pop    %esi
+  802c48:	5f                   	pop    %edi
+  802c49:	5d                   	pop    %ebp
+  802c4a:	c3                   	ret
+
+00802c4b <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  802c4b:	55                   	push   %ebp
+  802c4c:	89 e5                	mov    %esp,%ebp
+  802c4e:	57                   	push   %edi
+  802c4f:	56                   	push   %esi
+  802c50:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802c51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c56:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c5c:	b8 17 00 00 00       	mov    $0x17,%eax
+  802c61:	89 df                	mov    %ebx,%edi
+  802c63:	89 de                	mov    %ebx,%esi
+  802c65:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  802c67:	5b                   	pop    %ebx
+  802c68:	5e                   	pop    %esi
+  802c69:	5f                   	pop    %edi
+  802c6a:	5d                   	pop    %ebp
+  802c6b:	c3                   	ret
+
+00802c6c <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  802c6c:	55                   	push   %ebp
+  802c6d:	89 e5                	mov    %esp,%ebp
+  802c6f:	57                   	push   %edi
+  802c70:	56                   	push   %esi
+  802c71:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802c72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c77:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c7a:	b8 18 00 00 00       	mov    $0x18,%eax
+  802c7f:	89 cb                	mov    %ecx,%ebx
+  802c81:	89 cf                	mov    %ecx,%edi
+  802c83:	89 ce                	mov    %ecx,%esi
+  802c85:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  802c87:	5b                   	pop    %ebx
+  802c88:	5e                   	pop    %esi
+  802c89:	5f                   	pop    %edi
+  802c8a:	5d                   	pop    %ebp
+  802c8b:	c3                   	ret
+
+00802c8c <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  802c8c:	55                   	push   %ebp
+  802c8d:	89 e5                	mov    %esp,%ebp
+  802c8f:	57                   	push   %edi
+  802c90:	56                   	push   %esi
+  802c91:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  802c92:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  802c96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c9e:	b8 19 00 00 00       	mov    $0x19,%eax
+  802ca3:	89 df                	mov    %ebx,%edi
+  802ca5:	89 de                	mov    %ebx,%esi
+  802ca7:	cd 30                	int    $0x30
+}
+  802ca9:	5b                   	pop    %ebx
+  802caa:	5e                   	pop    %esi
+  802cab:	5f                   	pop    %edi
+  802cac:	5d                   	pop    %ebp
+  802cad:	c3                   	ret
+
+00802cae <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	57                   	push   %edi
+  802cb2:	56                   	push   %esi
+  802cb3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802cb4:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cbf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  802cc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cc7:	89 f7                	mov    %esi,%edi
+  802cc9:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  802ccb:	5b                   	pop    %ebx
+  802ccc:	5e                   	pop    %esi
+  802ccd:	5f                   	pop    %edi
+  802cce:	5d                   	pop    %ebp
+  802ccf:	c3                   	ret
+
+00802cd0 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  802cd0:	55                   	push   %ebp
+  802cd1:	89 e5                	mov    %esp,%ebp
+  802cd3:	57                   	push   %edi
+  802cd4:	56                   	push   %esi
+  802cd5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802cd6:	be 00 00 00 00       	mov    $0x0,%esi
+  802cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ce1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  802ce6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ce9:	89 f7                	mov    %esi,%edi
+  802ceb:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  802ced:	5b                   	pop    %ebx
+  802cee:	5e                   	pop    %esi
+  802cef:	5f                   	pop    %edi
+  802cf0:	5d                   	pop    %ebp
+  802cf1:	c3                   	ret
+
+00802cf2 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802cf2:	55                   	push   %ebp
+  802cf3:	89 e5                	mov    %esp,%ebp
+  802cf5:	57                   	push   %edi
+  802cf6:	56                   	push   %esi
+  802cf7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802cf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d03:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  802d08:	89 df                	mov    %ebx,%edi
+  802d0a:	89 de                	mov    %ebx,%esi
+  802d0c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802d0e:	5b                   	pop    %ebx
+  802d0f:	5e                   	pop    %esi
+  802d10:	5f                   	pop    %edi
+  802d11:	5d                   	pop    %ebp
+  802d12:	c3                   	ret
+
+00802d13 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  802d13:	55                   	push   %ebp
+  802d14:	89 e5                	mov    %esp,%ebp
+  802d16:	57                   	push   %edi
+  802d17:	56                   	push   %esi
+  802d18:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802d19:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d24:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  802d29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d2c:	89 f7                	mov    %esi,%edi
+  802d2e:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  802d30:	5b                   	pop    %ebx
+  802d31:	5e                   	pop    %esi
+  802d32:	5f                   	pop    %edi
+  802d33:	5d                   	pop    %ebp
+  802d34:	c3                   	ret
+
+00802d35 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802d35:	55                   	push   %ebp
+  802d36:	89 e5                	mov    %esp,%ebp
+  802d38:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802d3b:	83 3d c0 c3 80 00 00 	cmpl   $0x0,0x80c3c0
+  802d42:	74 0a                	je     802d4e <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802d44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d47:	a3 c0 c3 80 00       	mov    %eax,0x80c3c0
+}
+  802d4c:	c9                   	leave
+  802d4d:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  802d4e:	83 ec 04             	sub    $0x4,%esp
+  802d51:	6a 07                	push   $0x7
+  802d53:	68 00 f0 bf ee       	push   $0xeebff000
+  802d58:	6a 00                	push   $0x0
+  802d5a:	e8 73 fb ff ff       	call   8028d2 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802d5f:	83 c4 08             	add    $0x8,%esp
+  802d62:	68 73 2d 80 00       	push   $0x802d73
+  802d67:	6a 00                	push   $0x0
+  802d69:	e8 af fc ff ff       	call   802a1d <sys_env_set_pgfault_upcall>
+  802d6e:	83 c4 10             	add    $0x10,%esp
+  802d71:	eb d1                	jmp    802d44 <set_pgfault_handler+0xf>
+
+00802d73 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802d73:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802d74:	a1 c0 c3 80 00       	mov    0x80c3c0,%eax
+	call *%eax
+  802d79:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802d7b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  802d7e:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802d82:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  802d85:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  802d89:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  802d8b:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802d8f:	83 c4 08             	add    $0x8,%esp
+	popal;
+  802d92:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802d93:	83 c4 04             	add    $0x4,%esp
+	popf
+  802d96:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  802d97:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  802d98:	c3                   	ret
+
+00802d99 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802d99:	55                   	push   %ebp
+  802d9a:	89 e5                	mov    %esp,%ebp
+  802d9c:	56                   	push   %esi
+  802d9d:	53                   	push   %ebx
+  802d9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802da1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  802da7:	85 c0                	test   %eax,%eax
+  802da9:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802dae:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  802db1:	83 ec 0c             	sub    $0xc,%esp
+  802db4:	50                   	push   %eax
+  802db5:	e8 c8 fc ff ff       	call   802a82 <sys_ipc_recv>
+  802dba:	83 c4 10             	add    $0x10,%esp
+  802dbd:	85 c0                	test   %eax,%eax
+  802dbf:	0f 88 8b 00 00 00    	js     802e50 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  802dc5:	85 f6                	test   %esi,%esi
+  802dc7:	74 2a                	je     802df3 <ipc_recv+0x5a>
+  802dc9:	89 e2                	mov    %esp,%edx
+  802dcb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802dd0:	29 d0                	sub    %edx,%eax
+  802dd2:	89 c2                	mov    %eax,%edx
+  802dd4:	c1 ea 0f             	shr    $0xf,%edx
+  802dd7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de1:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  802de4:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802deb:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802df1:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  802df3:	85 db                	test   %ebx,%ebx
+  802df5:	74 2a                	je     802e21 <ipc_recv+0x88>
+  802df7:	89 e2                	mov    %esp,%edx
+  802df9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802dfe:	29 d0                	sub    %edx,%eax
+  802e00:	89 c2                	mov    %eax,%edx
+  802e02:	c1 ea 0f             	shr    $0xf,%edx
+  802e05:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0f:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  802e12:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802e19:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802e1f:	89 03                	mov    %eax,(%ebx)
+  802e21:	89 e2                	mov    %esp,%edx
+  802e23:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802e28:	29 d0                	sub    %edx,%eax
+  802e2a:	89 c2                	mov    %eax,%edx
+  802e2c:	c1 ea 0f             	shr    $0xf,%edx
+  802e2f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e39:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  802e3c:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802e43:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  802e49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e4c:	5b                   	pop    %ebx
+  802e4d:	5e                   	pop    %esi
+  802e4e:	5d                   	pop    %ebp
+  802e4f:	c3                   	ret
+		if(from_env_store != NULL)
+  802e50:	85 f6                	test   %esi,%esi
+  802e52:	74 06                	je     802e5a <ipc_recv+0xc1>
+			*from_env_store = 0;
+  802e54:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  802e5a:	85 db                	test   %ebx,%ebx
+  802e5c:	74 eb                	je     802e49 <ipc_recv+0xb0>
+			*perm_store = 0;
+  802e5e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802e64:	eb e3                	jmp    802e49 <ipc_recv+0xb0>
+
+00802e66 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  802e66:	55                   	push   %ebp
+  802e67:	89 e5                	mov    %esp,%ebp
+  802e69:	57                   	push   %edi
+  802e6a:	56                   	push   %esi
+  802e6b:	53                   	push   %ebx
+  802e6c:	83 ec 14             	sub    $0x14,%esp
+  802e6f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e75:	8b 75 14             	mov    0x14(%ebp),%esi
+  802e78:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  802e7b:	85 c0                	test   %eax,%eax
+  802e7d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802e82:	0f 44 c2             	cmove  %edx,%eax
+  802e85:	ff 75 10             	push   0x10(%ebp)
+  802e88:	50                   	push   %eax
+  802e89:	e8 56 fc ff ff       	call   802ae4 <sys_ipc_recv_pages>
+  802e8e:	83 c4 10             	add    $0x10,%esp
+  802e91:	85 c0                	test   %eax,%eax
+  802e93:	0f 88 ba 00 00 00    	js     802f53 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  802e99:	85 ff                	test   %edi,%edi
+  802e9b:	74 2a                	je     802ec7 <ipc_recv_pages+0x61>
+  802e9d:	89 e2                	mov    %esp,%edx
+  802e9f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802ea4:	29 d0                	sub    %edx,%eax
+  802ea6:	89 c2                	mov    %eax,%edx
+  802ea8:	c1 ea 0f             	shr    $0xf,%edx
+  802eab:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb5:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  802eb8:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802ebf:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802ec5:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802ec7:	85 f6                	test   %esi,%esi
+  802ec9:	74 2a                	je     802ef5 <ipc_recv_pages+0x8f>
+  802ecb:	89 e2                	mov    %esp,%edx
+  802ecd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802ed2:	29 d0                	sub    %edx,%eax
+  802ed4:	89 c2                	mov    %eax,%edx
+  802ed6:	c1 ea 0f             	shr    $0xf,%edx
+  802ed9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802ede:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee3:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  802ee6:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802eed:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802ef3:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  802ef5:	85 db                	test   %ebx,%ebx
+  802ef7:	74 2a                	je     802f23 <ipc_recv_pages+0xbd>
+  802ef9:	89 e2                	mov    %esp,%edx
+  802efb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802f00:	29 d0                	sub    %edx,%eax
+  802f02:	89 c2                	mov    %eax,%edx
+  802f04:	c1 ea 0f             	shr    $0xf,%edx
+  802f07:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f11:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  802f14:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802f1b:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802f21:	89 03                	mov    %eax,(%ebx)
+  802f23:	89 e2                	mov    %esp,%edx
+  802f25:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802f2a:	29 d0                	sub    %edx,%eax
+  802f2c:	89 c2                	mov    %eax,%edx
+  802f2e:	c1 ea 0f             	shr    $0xf,%edx
+  802f31:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3b:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  802f3e:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802f45:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  802f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f4e:	5b                   	pop    %ebx
+  802f4f:	5e                   	pop    %esi
+  802f50:	5f                   	pop    %edi
+  802f51:	5d                   	pop    %ebp
+  802f52:	c3                   	ret
+		if (from_env_store)
+  802f53:	85 ff                	test   %edi,%edi
+  802f55:	74 06                	je     802f5d <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  802f57:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802f5d:	85 f6                	test   %esi,%esi
+  802f5f:	74 06                	je     802f67 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  802f61:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  802f67:	85 db                	test   %ebx,%ebx
+  802f69:	74 e0                	je     802f4b <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  802f6b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802f71:	eb d8                	jmp    802f4b <ipc_recv_pages+0xe5>
+
+00802f73 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  802f73:	55                   	push   %ebp
+  802f74:	89 e5                	mov    %esp,%ebp
+  802f76:	57                   	push   %edi
+  802f77:	56                   	push   %esi
+  802f78:	53                   	push   %ebx
+  802f79:	83 ec 1c             	sub    $0x1c,%esp
+  802f7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  802f7f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f82:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  802f88:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  802f8c:	75 2b                	jne    802fb9 <ipc_try_send_pages+0x46>
+  802f8e:	89 e2                	mov    %esp,%edx
+  802f90:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802f95:	29 d0                	sub    %edx,%eax
+  802f97:	89 c2                	mov    %eax,%edx
+  802f99:	c1 ea 0f             	shr    $0xf,%edx
+  802f9c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa6:	0f 42 c2             	cmovb  %edx,%eax
+  802fa9:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  802fb0:	8b 70 48             	mov    0x48(%eax),%esi
+  802fb3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  802fb9:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  802fbf:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  802fc4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fc7:	85 ff                	test   %edi,%edi
+  802fc9:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  802fce:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  802fd1:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  802fd7:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802fdd:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  802fe3:	83 ec 0c             	sub    $0xc,%esp
+  802fe6:	ff 75 14             	push   0x14(%ebp)
+  802fe9:	ff 75 18             	push   0x18(%ebp)
+  802fec:	57                   	push   %edi
+  802fed:	ff 75 0c             	push   0xc(%ebp)
+  802ff0:	ff 75 08             	push   0x8(%ebp)
+  802ff3:	e8 cb fa ff ff       	call   802ac3 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  802ff8:	83 c4 20             	add    $0x20,%esp
+  802ffb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ffe:	75 21                	jne    803021 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803000:	83 ec 04             	sub    $0x4,%esp
+  803003:	6a ff                	push   $0xffffffff
+  803005:	53                   	push   %ebx
+  803006:	ff 75 e4             	push   -0x1c(%ebp)
+  803009:	e8 c2 fc ff ff       	call   802cd0 <sys_futex_wait>
+  80300e:	83 c4 10             	add    $0x10,%esp
+  803011:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803014:	74 c7                	je     802fdd <ipc_try_send_pages+0x6a>
+  803016:	85 c0                	test   %eax,%eax
+  803018:	79 c3                	jns    802fdd <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80301a:	e8 94 f8 ff ff       	call   8028b3 <sys_yield>
+  80301f:	eb bc                	jmp    802fdd <ipc_try_send_pages+0x6a>
+	}
+}
+  803021:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803024:	5b                   	pop    %ebx
+  803025:	5e                   	pop    %esi
+  803026:	5f                   	pop    %edi
+  803027:	5d                   	pop    %ebp
+  803028:	c3                   	ret
+
+00803029 <ipc_send>:
+{
+  803029:	55                   	push   %ebp
+  80302a:	89 e5                	mov    %esp,%ebp
+  80302c:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80302f:	ff 75 14             	push   0x14(%ebp)
+  803032:	6a 01                	push   $0x1
+  803034:	ff 75 10             	push   0x10(%ebp)
+  803037:	ff 75 0c             	push   0xc(%ebp)
+  80303a:	ff 75 08             	push   0x8(%ebp)
+  80303d:	e8 31 ff ff ff       	call   802f73 <ipc_try_send_pages>
+  803042:	83 c4 20             	add    $0x20,%esp
+  803045:	85 c0                	test   %eax,%eax
+  803047:	78 02                	js     80304b <ipc_send+0x22>
+}
+  803049:	c9                   	leave
+  80304a:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80304b:	50                   	push   %eax
+  80304c:	68 76 5f 80 00       	push   $0x805f76
+  803051:	6a 3f                	push   $0x3f
+  803053:	68 8b 5f 80 00       	push   $0x805f8b
+  803058:	e8 6f ec ff ff       	call   801ccc <_panic>
+
+0080305d <ipc_send_pages>:
+{
+  80305d:	55                   	push   %ebp
+  80305e:	89 e5                	mov    %esp,%ebp
+  803060:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803063:	ff 75 18             	push   0x18(%ebp)
+  803066:	ff 75 14             	push   0x14(%ebp)
+  803069:	ff 75 10             	push   0x10(%ebp)
+  80306c:	ff 75 0c             	push   0xc(%ebp)
+  80306f:	ff 75 08             	push   0x8(%ebp)
+  803072:	e8 fc fe ff ff       	call   802f73 <ipc_try_send_pages>
+  803077:	83 c4 20             	add    $0x20,%esp
+  80307a:	85 c0                	test   %eax,%eax
+  80307c:	78 02                	js     803080 <ipc_send_pages+0x23>
+}
+  80307e:	c9                   	leave
+  80307f:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803080:	50                   	push   %eax
+  803081:	68 95 5f 80 00       	push   $0x805f95
+  803086:	6a 64                	push   $0x64
+  803088:	68 8b 5f 80 00       	push   $0x805f8b
+  80308d:	e8 3a ec ff ff       	call   801ccc <_panic>
+
+00803092 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803092:	55                   	push   %ebp
+  803093:	89 e5                	mov    %esp,%ebp
+  803095:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803098:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80309d:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8030a3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8030a9:	8b 52 50             	mov    0x50(%edx),%edx
+  8030ac:	39 ca                	cmp    %ecx,%edx
+  8030ae:	74 11                	je     8030c1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8030b0:	83 c0 01             	add    $0x1,%eax
+  8030b3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8030b8:	75 e3                	jne    80309d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8030ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bf:	eb 0e                	jmp    8030cf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8030c1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8030c7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030cc:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8030cf:	5d                   	pop    %ebp
+  8030d0:	c3                   	ret
+
+008030d1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8030d1:	55                   	push   %ebp
+  8030d2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8030d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8030dc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8030df:	5d                   	pop    %ebp
+  8030e0:	c3                   	ret
+
+008030e1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8030e1:	55                   	push   %ebp
+  8030e2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8030e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8030ec:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8030f1:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8030f6:	5d                   	pop    %ebp
+  8030f7:	c3                   	ret
+
+008030f8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8030f8:	55                   	push   %ebp
+  8030f9:	89 e5                	mov    %esp,%ebp
+  8030fb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  803100:	89 c2                	mov    %eax,%edx
+  803102:	c1 ea 16             	shr    $0x16,%edx
+  803105:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80310c:	f6 c2 01             	test   $0x1,%dl
+  80310f:	74 29                	je     80313a <fd_alloc+0x42>
+  803111:	89 c2                	mov    %eax,%edx
+  803113:	c1 ea 0c             	shr    $0xc,%edx
+  803116:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80311d:	f6 c2 01             	test   $0x1,%dl
+  803120:	74 18                	je     80313a <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  803122:	05 00 10 00 00       	add    $0x1000,%eax
+  803127:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80312c:	75 d2                	jne    803100 <fd_alloc+0x8>
+  80312e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  803133:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  803138:	eb 05                	jmp    80313f <fd_alloc+0x47>
+			return 0;
+  80313a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80313f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803142:	89 02                	mov    %eax,(%edx)
+}
+  803144:	89 c8                	mov    %ecx,%eax
+  803146:	5d                   	pop    %ebp
+  803147:	c3                   	ret
+
+00803148 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803148:	55                   	push   %ebp
+  803149:	89 e5                	mov    %esp,%ebp
+  80314b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80314e:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  803153:	77 30                	ja     803185 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  803155:	c1 e0 0c             	shl    $0xc,%eax
+  803158:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80315d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  803163:	f6 c2 01             	test   $0x1,%dl
+  803166:	74 24                	je     80318c <fd_lookup+0x44>
+  803168:	89 c2                	mov    %eax,%edx
+  80316a:	c1 ea 0c             	shr    $0xc,%edx
+  80316d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803174:	f6 c2 01             	test   $0x1,%dl
+  803177:	74 1a                	je     803193 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  803179:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80317c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80317e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803183:	5d                   	pop    %ebp
+  803184:	c3                   	ret
+		return -E_INVAL;
+  803185:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80318a:	eb f7                	jmp    803183 <fd_lookup+0x3b>
+		return -E_INVAL;
+  80318c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803191:	eb f0                	jmp    803183 <fd_lookup+0x3b>
+  803193:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803198:	eb e9                	jmp    803183 <fd_lookup+0x3b>
+
+0080319a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80319a:	55                   	push   %ebp
+  80319b:	89 e5                	mov    %esp,%ebp
+  80319d:	53                   	push   %ebx
+  80319e:	83 ec 04             	sub    $0x4,%esp
+  8031a1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8031a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a9:	bb 80 b0 80 00       	mov    $0x80b080,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8031ae:	39 13                	cmp    %edx,(%ebx)
+  8031b0:	74 54                	je     803206 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8031b2:	83 c0 01             	add    $0x1,%eax
+  8031b5:	8b 1c 85 2c 60 80 00 	mov    0x80602c(,%eax,4),%ebx
+  8031bc:	85 db                	test   %ebx,%ebx
+  8031be:	75 ee                	jne    8031ae <dev_lookup+0x14>
+  8031c0:	89 e1                	mov    %esp,%ecx
+  8031c2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8031c7:	29 c8                	sub    %ecx,%eax
+  8031c9:	89 c1                	mov    %eax,%ecx
+  8031cb:	c1 e9 0f             	shr    $0xf,%ecx
+  8031ce:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d8:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8031db:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  8031e2:	8b 40 48             	mov    0x48(%eax),%eax
+  8031e5:	83 ec 04             	sub    $0x4,%esp
+  8031e8:	52                   	push   %edx
+  8031e9:	50                   	push   %eax
+  8031ea:	68 b0 5f 80 00       	push   $0x805fb0
+  8031ef:	e8 b3 eb ff ff       	call   801da7 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8031f4:	83 c4 10             	add    $0x10,%esp
+  8031f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8031fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031ff:	89 1a                	mov    %ebx,(%edx)
+}
+  803201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803204:	c9                   	leave
+  803205:	c3                   	ret
+			return 0;
+  803206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320b:	eb ef                	jmp    8031fc <dev_lookup+0x62>
+
+0080320d <fd_close>:
+{
+  80320d:	55                   	push   %ebp
+  80320e:	89 e5                	mov    %esp,%ebp
+  803210:	57                   	push   %edi
+  803211:	56                   	push   %esi
+  803212:	53                   	push   %ebx
+  803213:	83 ec 24             	sub    $0x24,%esp
+  803216:	8b 75 08             	mov    0x8(%ebp),%esi
+  803219:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80321c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80321f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803220:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  803226:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803229:	50                   	push   %eax
+  80322a:	e8 19 ff ff ff       	call   803148 <fd_lookup>
+  80322f:	89 c3                	mov    %eax,%ebx
+  803231:	83 c4 10             	add    $0x10,%esp
+  803234:	85 c0                	test   %eax,%eax
+  803236:	78 05                	js     80323d <fd_close+0x30>
+	    || fd != fd2)
+  803238:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80323b:	74 0f                	je     80324c <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80323d:	85 ff                	test   %edi,%edi
+  80323f:	0f 44 df             	cmove  %edi,%ebx
+}
+  803242:	89 d8                	mov    %ebx,%eax
+  803244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803247:	5b                   	pop    %ebx
+  803248:	5e                   	pop    %esi
+  803249:	5f                   	pop    %edi
+  80324a:	5d                   	pop    %ebp
+  80324b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80324c:	83 ec 08             	sub    $0x8,%esp
+  80324f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  803252:	50                   	push   %eax
+  803253:	ff 36                	push   (%esi)
+  803255:	e8 40 ff ff ff       	call   80319a <dev_lookup>
+  80325a:	89 c3                	mov    %eax,%ebx
+  80325c:	83 c4 10             	add    $0x10,%esp
+  80325f:	85 c0                	test   %eax,%eax
+  803261:	78 1a                	js     80327d <fd_close+0x70>
+		if (dev->dev_close)
+  803263:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803266:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  803269:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80326e:	85 c0                	test   %eax,%eax
+  803270:	74 0b                	je     80327d <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  803272:	83 ec 0c             	sub    $0xc,%esp
+  803275:	56                   	push   %esi
+  803276:	ff d0                	call   *%eax
+  803278:	89 c3                	mov    %eax,%ebx
+  80327a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80327d:	83 ec 08             	sub    $0x8,%esp
+  803280:	56                   	push   %esi
+  803281:	6a 00                	push   $0x0
+  803283:	e8 cf f6 ff ff       	call   802957 <sys_page_unmap>
+	return r;
+  803288:	83 c4 10             	add    $0x10,%esp
+  80328b:	eb b5                	jmp    803242 <fd_close+0x35>
+
+0080328d <close>:
+
+int
+close(int fdnum)
+{
+  80328d:	55                   	push   %ebp
+  80328e:	89 e5                	mov    %esp,%ebp
+  803290:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803293:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803296:	50                   	push   %eax
+  803297:	ff 75 08             	push   0x8(%ebp)
+  80329a:	e8 a9 fe ff ff       	call   803148 <fd_lookup>
+  80329f:	83 c4 10             	add    $0x10,%esp
+  8032a2:	85 c0                	test   %eax,%eax
+  8032a4:	79 02                	jns    8032a8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8032a6:	c9                   	leave
+  8032a7:	c3                   	ret
+		return fd_close(fd, 1);
+  8032a8:	83 ec 08             	sub    $0x8,%esp
+  8032ab:	6a 01                	push   $0x1
+  8032ad:	ff 75 f4             	push   -0xc(%ebp)
+  8032b0:	e8 58 ff ff ff       	call   80320d <fd_close>
+  8032b5:	83 c4 10             	add    $0x10,%esp
+  8032b8:	eb ec                	jmp    8032a6 <close+0x19>
+
+008032ba <close_all>:
+
+void
+close_all(void)
+{
+  8032ba:	55                   	push   %ebp
+  8032bb:	89 e5                	mov    %esp,%ebp
+  8032bd:	53                   	push   %ebx
+  8032be:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8032c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8032c6:	83 ec 0c             	sub    $0xc,%esp
+  8032c9:	53                   	push   %ebx
+  8032ca:	e8 be ff ff ff       	call   80328d <close>
+	for (i = 0; i < MAXFD; i++)
+  8032cf:	83 c3 01             	add    $0x1,%ebx
+  8032d2:	83 c4 10             	add    $0x10,%esp
+  8032d5:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8032db:	75 e9                	jne    8032c6 <close_all+0xc>
+}
+  8032dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032e0:	c9                   	leave
+  8032e1:	c3                   	ret
+
+008032e2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8032e2:	55                   	push   %ebp
+  8032e3:	89 e5                	mov    %esp,%ebp
+  8032e5:	57                   	push   %edi
+  8032e6:	56                   	push   %esi
+  8032e7:	53                   	push   %ebx
+  8032e8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8032eb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8032ee:	50                   	push   %eax
+  8032ef:	ff 75 08             	push   0x8(%ebp)
+  8032f2:	e8 51 fe ff ff       	call   803148 <fd_lookup>
+  8032f7:	89 c3                	mov    %eax,%ebx
+  8032f9:	83 c4 10             	add    $0x10,%esp
+  8032fc:	85 c0                	test   %eax,%eax
+  8032fe:	78 7f                	js     80337f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  803300:	83 ec 0c             	sub    $0xc,%esp
+  803303:	ff 75 0c             	push   0xc(%ebp)
+  803306:	e8 82 ff ff ff       	call   80328d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80330b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80330e:	c1 e6 0c             	shl    $0xc,%esi
+  803311:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  803317:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80331a:	89 3c 24             	mov    %edi,(%esp)
+  80331d:	e8 bf fd ff ff       	call   8030e1 <fd2data>
+  803322:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  803324:	89 34 24             	mov    %esi,(%esp)
+  803327:	e8 b5 fd ff ff       	call   8030e1 <fd2data>
+  80332c:	83 c4 10             	add    $0x10,%esp
+  80332f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  803332:	89 d8                	mov    %ebx,%eax
+  803334:	c1 e8 16             	shr    $0x16,%eax
+  803337:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80333e:	a8 01                	test   $0x1,%al
+  803340:	74 11                	je     803353 <dup+0x71>
+  803342:	89 d8                	mov    %ebx,%eax
+  803344:	c1 e8 0c             	shr    $0xc,%eax
+  803347:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80334e:	f6 c2 01             	test   $0x1,%dl
+  803351:	75 36                	jne    803389 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803353:	89 f8                	mov    %edi,%eax
+  803355:	c1 e8 0c             	shr    $0xc,%eax
+  803358:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80335f:	83 ec 0c             	sub    $0xc,%esp
+  803362:	25 07 0e 00 00       	and    $0xe07,%eax
+  803367:	50                   	push   %eax
+  803368:	56                   	push   %esi
+  803369:	6a 00                	push   $0x0
+  80336b:	57                   	push   %edi
+  80336c:	6a 00                	push   $0x0
+  80336e:	e8 a2 f5 ff ff       	call   802915 <sys_page_map>
+  803373:	89 c3                	mov    %eax,%ebx
+  803375:	83 c4 20             	add    $0x20,%esp
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	78 33                	js     8033af <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80337c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80337f:	89 d8                	mov    %ebx,%eax
+  803381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803384:	5b                   	pop    %ebx
+  803385:	5e                   	pop    %esi
+  803386:	5f                   	pop    %edi
+  803387:	5d                   	pop    %ebp
+  803388:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803389:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803390:	83 ec 0c             	sub    $0xc,%esp
+  803393:	25 07 0e 00 00       	and    $0xe07,%eax
+  803398:	50                   	push   %eax
+  803399:	ff 75 d4             	push   -0x2c(%ebp)
+  80339c:	6a 00                	push   $0x0
+  80339e:	53                   	push   %ebx
+  80339f:	6a 00                	push   $0x0
+  8033a1:	e8 6f f5 ff ff       	call   802915 <sys_page_map>
+  8033a6:	89 c3                	mov    %eax,%ebx
+  8033a8:	83 c4 20             	add    $0x20,%esp
+  8033ab:	85 c0                	test   %eax,%eax
+  8033ad:	79 a4                	jns    803353 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8033af:	83 ec 08             	sub    $0x8,%esp
+  8033b2:	56                   	push   %esi
+  8033b3:	6a 00                	push   $0x0
+  8033b5:	e8 9d f5 ff ff       	call   802957 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8033ba:	83 c4 08             	add    $0x8,%esp
+  8033bd:	ff 75 d4             	push   -0x2c(%ebp)
+  8033c0:	6a 00                	push   $0x0
+  8033c2:	e8 90 f5 ff ff       	call   802957 <sys_page_unmap>
+	return r;
+  8033c7:	83 c4 10             	add    $0x10,%esp
+  8033ca:	eb b3                	jmp    80337f <dup+0x9d>
+
+008033cc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8033cc:	55                   	push   %ebp
+  8033cd:	89 e5                	mov    %esp,%ebp
+  8033cf:	56                   	push   %esi
+  8033d0:	53                   	push   %ebx
+  8033d1:	83 ec 18             	sub    $0x18,%esp
+  8033d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8033d7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8033da:	50                   	push   %eax
+  8033db:	53                   	push   %ebx
+  8033dc:	e8 67 fd ff ff       	call   803148 <fd_lookup>
+  8033e1:	83 c4 10             	add    $0x10,%esp
+  8033e4:	85 c0                	test   %eax,%eax
+  8033e6:	78 3c                	js     803424 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8033e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8033eb:	83 ec 08             	sub    $0x8,%esp
+  8033ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033f1:	50                   	push   %eax
+  8033f2:	ff 36                	push   (%esi)
+  8033f4:	e8 a1 fd ff ff       	call   80319a <dev_lookup>
+  8033f9:	83 c4 10             	add    $0x10,%esp
+  8033fc:	85 c0                	test   %eax,%eax
+  8033fe:	78 24                	js     803424 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803400:	8b 46 08             	mov    0x8(%esi),%eax
+  803403:	83 e0 03             	and    $0x3,%eax
+  803406:	83 f8 01             	cmp    $0x1,%eax
+  803409:	74 20                	je     80342b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80340b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80340e:	8b 40 08             	mov    0x8(%eax),%eax
+  803411:	85 c0                	test   %eax,%eax
+  803413:	74 54                	je     803469 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  803415:	83 ec 04             	sub    $0x4,%esp
+  803418:	ff 75 10             	push   0x10(%ebp)
+  80341b:	ff 75 0c             	push   0xc(%ebp)
+  80341e:	56                   	push   %esi
+  80341f:	ff d0                	call   *%eax
+  803421:	83 c4 10             	add    $0x10,%esp
+}
+  803424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803427:	5b                   	pop    %ebx
+  803428:	5e                   	pop    %esi
+  803429:	5d                   	pop    %ebp
+  80342a:	c3                   	ret
+  80342b:	89 e2                	mov    %esp,%edx
+  80342d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803432:	29 d0                	sub    %edx,%eax
+  803434:	89 c2                	mov    %eax,%edx
+  803436:	c1 ea 0f             	shr    $0xf,%edx
+  803439:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80343e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803443:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803446:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  80344d:	8b 40 48             	mov    0x48(%eax),%eax
+  803450:	83 ec 04             	sub    $0x4,%esp
+  803453:	53                   	push   %ebx
+  803454:	50                   	push   %eax
+  803455:	68 f1 5f 80 00       	push   $0x805ff1
+  80345a:	e8 48 e9 ff ff       	call   801da7 <cprintf>
+		return -E_INVAL;
+  80345f:	83 c4 10             	add    $0x10,%esp
+  803462:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803467:	eb bb                	jmp    803424 <read+0x58>
+		return -E_NOT_SUPP;
+  803469:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80346e:	eb b4                	jmp    803424 <read+0x58>
+
+00803470 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803470:	55                   	push   %ebp
+  803471:	89 e5                	mov    %esp,%ebp
+  803473:	57                   	push   %edi
+  803474:	56                   	push   %esi
+  803475:	53                   	push   %ebx
+  803476:	83 ec 0c             	sub    $0xc,%esp
+  803479:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80347c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80347f:	85 f6                	test   %esi,%esi
+  803481:	74 30                	je     8034b3 <readn+0x43>
+  803483:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803488:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80348d:	83 ec 04             	sub    $0x4,%esp
+  803490:	89 f2                	mov    %esi,%edx
+  803492:	29 c2                	sub    %eax,%edx
+  803494:	52                   	push   %edx
+  803495:	01 f8                	add    %edi,%eax
+  803497:	50                   	push   %eax
+  803498:	ff 75 08             	push   0x8(%ebp)
+  80349b:	e8 2c ff ff ff       	call   8033cc <read>
+		if (m < 0)
+  8034a0:	83 c4 10             	add    $0x10,%esp
+  8034a3:	85 c0                	test   %eax,%eax
+  8034a5:	78 15                	js     8034bc <readn+0x4c>
+			return m;
+		if (m == 0)
+  8034a7:	74 11                	je     8034ba <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8034a9:	01 c3                	add    %eax,%ebx
+  8034ab:	89 d8                	mov    %ebx,%eax
+  8034ad:	39 f3                	cmp    %esi,%ebx
+  8034af:	72 dc                	jb     80348d <readn+0x1d>
+  8034b1:	eb 09                	jmp    8034bc <readn+0x4c>
+  8034b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b8:	eb 02                	jmp    8034bc <readn+0x4c>
+  8034ba:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8034bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034bf:	5b                   	pop    %ebx
+  8034c0:	5e                   	pop    %esi
+  8034c1:	5f                   	pop    %edi
+  8034c2:	5d                   	pop    %ebp
+  8034c3:	c3                   	ret
+
+008034c4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8034c4:	55                   	push   %ebp
+  8034c5:	89 e5                	mov    %esp,%ebp
+  8034c7:	56                   	push   %esi
+  8034c8:	53                   	push   %ebx
+  8034c9:	83 ec 18             	sub    $0x18,%esp
+  8034cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8034cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8034d2:	50                   	push   %eax
+  8034d3:	53                   	push   %ebx
+  8034d4:	e8 6f fc ff ff       	call   803148 <fd_lookup>
+  8034d9:	83 c4 10             	add    $0x10,%esp
+  8034dc:	85 c0                	test   %eax,%eax
+  8034de:	78 37                	js     803517 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8034e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8034e3:	83 ec 08             	sub    $0x8,%esp
+  8034e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034e9:	50                   	push   %eax
+  8034ea:	ff 36                	push   (%esi)
+  8034ec:	e8 a9 fc ff ff       	call   80319a <dev_lookup>
+  8034f1:	83 c4 10             	add    $0x10,%esp
+  8034f4:	85 c0                	test   %eax,%eax
+  8034f6:	78 1f                	js     803517 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8034f8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8034fc:	74 20                	je     80351e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8034fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803501:	8b 40 0c             	mov    0xc(%eax),%eax
+  803504:	85 c0                	test   %eax,%eax
+  803506:	74 54                	je     80355c <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  803508:	83 ec 04             	sub    $0x4,%esp
+  80350b:	ff 75 10             	push   0x10(%ebp)
+  80350e:	ff 75 0c             	push   0xc(%ebp)
+  803511:	56                   	push   %esi
+  803512:	ff d0                	call   *%eax
+  803514:	83 c4 10             	add    $0x10,%esp
+}
+  803517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80351a:	5b                   	pop    %ebx
+  80351b:	5e                   	pop    %esi
+  80351c:	5d                   	pop    %ebp
+  80351d:	c3                   	ret
+  80351e:	89 e2                	mov    %esp,%edx
+  803520:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803525:	29 d0                	sub    %edx,%eax
+  803527:	89 c2                	mov    %eax,%edx
+  803529:	c1 ea 0f             	shr    $0xf,%edx
+  80352c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803531:	b8 00 00 00 00       	mov    $0x0,%eax
+  803536:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803539:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  803540:	8b 40 48             	mov    0x48(%eax),%eax
+  803543:	83 ec 04             	sub    $0x4,%esp
+  803546:	53                   	push   %ebx
+  803547:	50                   	push   %eax
+  803548:	68 0d 60 80 00       	push   $0x80600d
+  80354d:	e8 55 e8 ff ff       	call   801da7 <cprintf>
+		return -E_INVAL;
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80355a:	eb bb                	jmp    803517 <write+0x53>
+		return -E_NOT_SUPP;
+  80355c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803561:	eb b4                	jmp    803517 <write+0x53>
+
+00803563 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803563:	55                   	push   %ebp
+  803564:	89 e5                	mov    %esp,%ebp
+  803566:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803569:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80356c:	50                   	push   %eax
+  80356d:	ff 75 08             	push   0x8(%ebp)
+  803570:	e8 d3 fb ff ff       	call   803148 <fd_lookup>
+  803575:	83 c4 10             	add    $0x10,%esp
+  803578:	85 c0                	test   %eax,%eax
+  80357a:	78 0e                	js     80358a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80357c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80357f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803582:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  803585:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80358a:	c9                   	leave
+  80358b:	c3                   	ret
+
+0080358c <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80358c:	55                   	push   %ebp
+  80358d:	89 e5                	mov    %esp,%ebp
+  80358f:	53                   	push   %ebx
+  803590:	83 ec 1c             	sub    $0x1c,%esp
+  803593:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803596:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803599:	50                   	push   %eax
+  80359a:	ff 75 08             	push   0x8(%ebp)
+  80359d:	e8 a6 fb ff ff       	call   803148 <fd_lookup>
+  8035a2:	83 c4 10             	add    $0x10,%esp
+  8035a5:	85 c0                	test   %eax,%eax
+  8035a7:	78 33                	js     8035dc <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8035a9:	83 fb 03             	cmp    $0x3,%ebx
+  8035ac:	74 28                	je     8035d6 <fcntl+0x4a>
+  8035ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035b3:	83 fb 04             	cmp    $0x4,%ebx
+  8035b6:	75 24                	jne    8035dc <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8035b8:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8035bb:	8b 41 08             	mov    0x8(%ecx),%eax
+  8035be:	80 e4 ef             	and    $0xef,%ah
+  8035c1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035c4:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8035ca:	09 d0                	or     %edx,%eax
+  8035cc:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8035cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d4:	eb 06                	jmp    8035dc <fcntl+0x50>
+		return fd->fd_omode;
+  8035d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035d9:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8035dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035df:	c9                   	leave
+  8035e0:	c3                   	ret
+
+008035e1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8035e1:	55                   	push   %ebp
+  8035e2:	89 e5                	mov    %esp,%ebp
+  8035e4:	56                   	push   %esi
+  8035e5:	53                   	push   %ebx
+  8035e6:	83 ec 18             	sub    $0x18,%esp
+  8035e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8035ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8035ef:	50                   	push   %eax
+  8035f0:	53                   	push   %ebx
+  8035f1:	e8 52 fb ff ff       	call   803148 <fd_lookup>
+  8035f6:	83 c4 10             	add    $0x10,%esp
+  8035f9:	85 c0                	test   %eax,%eax
+  8035fb:	78 34                	js     803631 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8035fd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803600:	83 ec 08             	sub    $0x8,%esp
+  803603:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803606:	50                   	push   %eax
+  803607:	ff 36                	push   (%esi)
+  803609:	e8 8c fb ff ff       	call   80319a <dev_lookup>
+  80360e:	83 c4 10             	add    $0x10,%esp
+  803611:	85 c0                	test   %eax,%eax
+  803613:	78 1c                	js     803631 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803615:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  803619:	74 1d                	je     803638 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80361b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80361e:	8b 40 18             	mov    0x18(%eax),%eax
+  803621:	85 c0                	test   %eax,%eax
+  803623:	74 51                	je     803676 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  803625:	83 ec 08             	sub    $0x8,%esp
+  803628:	ff 75 0c             	push   0xc(%ebp)
+  80362b:	56                   	push   %esi
+  80362c:	ff d0                	call   *%eax
+  80362e:	83 c4 10             	add    $0x10,%esp
+}
+  803631:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803634:	5b                   	pop    %ebx
+  803635:	5e                   	pop    %esi
+  803636:	5d                   	pop    %ebp
+  803637:	c3                   	ret
+  803638:	89 e2                	mov    %esp,%edx
+  80363a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80363f:	29 d0                	sub    %edx,%eax
+  803641:	89 c2                	mov    %eax,%edx
+  803643:	c1 ea 0f             	shr    $0xf,%edx
+  803646:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80364b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803650:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  803653:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  80365a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80365d:	83 ec 04             	sub    $0x4,%esp
+  803660:	53                   	push   %ebx
+  803661:	50                   	push   %eax
+  803662:	68 d0 5f 80 00       	push   $0x805fd0
+  803667:	e8 3b e7 ff ff       	call   801da7 <cprintf>
+		return -E_INVAL;
+  80366c:	83 c4 10             	add    $0x10,%esp
+  80366f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803674:	eb bb                	jmp    803631 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  803676:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80367b:	eb b4                	jmp    803631 <ftruncate+0x50>
+
+0080367d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80367d:	55                   	push   %ebp
+  80367e:	89 e5                	mov    %esp,%ebp
+  803680:	56                   	push   %esi
+  803681:	53                   	push   %ebx
+  803682:	83 ec 18             	sub    $0x18,%esp
+  803685:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803688:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80368b:	50                   	push   %eax
+  80368c:	ff 75 08             	push   0x8(%ebp)
+  80368f:	e8 b4 fa ff ff       	call   803148 <fd_lookup>
+  803694:	83 c4 10             	add    $0x10,%esp
+  803697:	85 c0                	test   %eax,%eax
+  803699:	78 53                	js     8036ee <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80369b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80369e:	83 ec 08             	sub    $0x8,%esp
+  8036a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036a4:	50                   	push   %eax
+  8036a5:	ff 36                	push   (%esi)
+  8036a7:	e8 ee fa ff ff       	call   80319a <dev_lookup>
+  8036ac:	83 c4 10             	add    $0x10,%esp
+  8036af:	85 c0                	test   %eax,%eax
+  8036b1:	78 3b                	js     8036ee <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8036b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036b6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8036ba:	74 39                	je     8036f5 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8036bc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8036bf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8036c6:	00 00 00 
+	stat->st_isdir = 0;
+  8036c9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8036d0:	00 00 00 
+	stat->st_version = 0;
+  8036d3:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8036da:	00 00 00 
+	stat->st_dev = dev;
+  8036dd:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8036e3:	83 ec 08             	sub    $0x8,%esp
+  8036e6:	53                   	push   %ebx
+  8036e7:	56                   	push   %esi
+  8036e8:	ff 50 14             	call   *0x14(%eax)
+  8036eb:	83 c4 10             	add    $0x10,%esp
+}
+  8036ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036f1:	5b                   	pop    %ebx
+  8036f2:	5e                   	pop    %esi
+  8036f3:	5d                   	pop    %ebp
+  8036f4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8036f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8036fa:	eb f2                	jmp    8036ee <fstat+0x71>
+
+008036fc <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8036fc:	55                   	push   %ebp
+  8036fd:	89 e5                	mov    %esp,%ebp
+  8036ff:	56                   	push   %esi
+  803700:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803701:	83 ec 08             	sub    $0x8,%esp
+  803704:	6a 00                	push   $0x0
+  803706:	ff 75 08             	push   0x8(%ebp)
+  803709:	e8 b7 01 00 00       	call   8038c5 <open>
+  80370e:	89 c3                	mov    %eax,%ebx
+  803710:	83 c4 10             	add    $0x10,%esp
+  803713:	85 c0                	test   %eax,%eax
+  803715:	78 1b                	js     803732 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  803717:	83 ec 08             	sub    $0x8,%esp
+  80371a:	ff 75 0c             	push   0xc(%ebp)
+  80371d:	50                   	push   %eax
+  80371e:	e8 5a ff ff ff       	call   80367d <fstat>
+  803723:	89 c6                	mov    %eax,%esi
+	close(fd);
+  803725:	89 1c 24             	mov    %ebx,(%esp)
+  803728:	e8 60 fb ff ff       	call   80328d <close>
+	return r;
+  80372d:	83 c4 10             	add    $0x10,%esp
+  803730:	89 f3                	mov    %esi,%ebx
+}
+  803732:	89 d8                	mov    %ebx,%eax
+  803734:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803737:	5b                   	pop    %ebx
+  803738:	5e                   	pop    %esi
+  803739:	5d                   	pop    %ebp
+  80373a:	c3                   	ret
+
+0080373b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80373b:	55                   	push   %ebp
+  80373c:	89 e5                	mov    %esp,%ebp
+  80373e:	56                   	push   %esi
+  80373f:	53                   	push   %ebx
+  803740:	89 c6                	mov    %eax,%esi
+  803742:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  803744:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  80374b:	74 27                	je     803774 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80374d:	6a 07                	push   $0x7
+  80374f:	68 00 d0 80 00       	push   $0x80d000
+  803754:	56                   	push   %esi
+  803755:	ff 35 00 c0 80 00    	push   0x80c000
+  80375b:	e8 c9 f8 ff ff       	call   803029 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  803760:	83 c4 0c             	add    $0xc,%esp
+  803763:	6a 00                	push   $0x0
+  803765:	53                   	push   %ebx
+  803766:	6a 00                	push   $0x0
+  803768:	e8 2c f6 ff ff       	call   802d99 <ipc_recv>
+}
+  80376d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803770:	5b                   	pop    %ebx
+  803771:	5e                   	pop    %esi
+  803772:	5d                   	pop    %ebp
+  803773:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803774:	83 ec 0c             	sub    $0xc,%esp
+  803777:	6a 02                	push   $0x2
+  803779:	e8 14 f9 ff ff       	call   803092 <ipc_find_env>
+  80377e:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  803783:	83 c4 10             	add    $0x10,%esp
+  803786:	eb c5                	jmp    80374d <fsipc+0x12>
+
+00803788 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803788:	55                   	push   %ebp
+  803789:	89 e5                	mov    %esp,%ebp
+  80378b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80378e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803791:	8b 40 0c             	mov    0xc(%eax),%eax
+  803794:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.set_size.req_size = newsize;
+  803799:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80379c:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8037a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037a6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8037ab:	e8 8b ff ff ff       	call   80373b <fsipc>
+}
+  8037b0:	c9                   	leave
+  8037b1:	c3                   	ret
+
+008037b2 <devfile_flush>:
+{
+  8037b2:	55                   	push   %ebp
+  8037b3:	89 e5                	mov    %esp,%ebp
+  8037b5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8037b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8037be:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8037c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8037cd:	e8 69 ff ff ff       	call   80373b <fsipc>
+}
+  8037d2:	c9                   	leave
+  8037d3:	c3                   	ret
+
+008037d4 <devfile_stat>:
+{
+  8037d4:	55                   	push   %ebp
+  8037d5:	89 e5                	mov    %esp,%ebp
+  8037d7:	53                   	push   %ebx
+  8037d8:	83 ec 04             	sub    $0x4,%esp
+  8037db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8037de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8037e4:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8037e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037ee:	b8 05 00 00 00       	mov    $0x5,%eax
+  8037f3:	e8 43 ff ff ff       	call   80373b <fsipc>
+  8037f8:	85 c0                	test   %eax,%eax
+  8037fa:	78 37                	js     803833 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8037fc:	83 ec 08             	sub    $0x8,%esp
+  8037ff:	68 00 d0 80 00       	push   $0x80d000
+  803804:	53                   	push   %ebx
+  803805:	e8 94 ec ff ff       	call   80249e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80380a:	a1 80 d0 80 00       	mov    0x80d080,%eax
+  80380f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803815:	a1 84 d0 80 00       	mov    0x80d084,%eax
+  80381a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  803820:	a1 88 d0 80 00       	mov    0x80d088,%eax
+  803825:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80382b:	83 c4 10             	add    $0x10,%esp
+  80382e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803836:	c9                   	leave
+  803837:	c3                   	ret
+
+00803838 <devfile_write>:
+{
+  803838:	55                   	push   %ebp
+  803839:	89 e5                	mov    %esp,%ebp
+  80383b:	83 ec 0c             	sub    $0xc,%esp
+  80383e:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  803841:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  803846:	39 d0                	cmp    %edx,%eax
+  803848:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80384b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80384e:	8b 52 0c             	mov    0xc(%edx),%edx
+  803851:	89 15 00 d0 80 00    	mov    %edx,0x80d000
+	fsipcbuf.write.req_n = count;
+  803857:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  80385c:	50                   	push   %eax
+  80385d:	ff 75 0c             	push   0xc(%ebp)
+  803860:	68 08 d0 80 00       	push   $0x80d008
+  803865:	e8 e4 ed ff ff       	call   80264e <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80386a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80386f:	b8 04 00 00 00       	mov    $0x4,%eax
+  803874:	e8 c2 fe ff ff       	call   80373b <fsipc>
+}
+  803879:	c9                   	leave
+  80387a:	c3                   	ret
+
+0080387b <devfile_read>:
+{
+  80387b:	55                   	push   %ebp
+  80387c:	89 e5                	mov    %esp,%ebp
+  80387e:	53                   	push   %ebx
+  80387f:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803882:	8b 45 08             	mov    0x8(%ebp),%eax
+  803885:	8b 40 0c             	mov    0xc(%eax),%eax
+  803888:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.read.req_n = n;
+  80388d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803890:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  803895:	ba 00 d0 80 00       	mov    $0x80d000,%edx
+  80389a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80389f:	e8 97 fe ff ff       	call   80373b <fsipc>
+  8038a4:	89 c3                	mov    %eax,%ebx
+  8038a6:	85 c0                	test   %eax,%eax
+  8038a8:	78 14                	js     8038be <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8038aa:	83 ec 04             	sub    $0x4,%esp
+  8038ad:	50                   	push   %eax
+  8038ae:	68 00 d0 80 00       	push   $0x80d000
+  8038b3:	ff 75 0c             	push   0xc(%ebp)
+  8038b6:	e8 93 ed ff ff       	call   80264e <memmove>
+	return r;
+  8038bb:	83 c4 10             	add    $0x10,%esp
+}
+  8038be:	89 d8                	mov    %ebx,%eax
+  8038c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038c3:	c9                   	leave
+  8038c4:	c3                   	ret
+
+008038c5 <open>:
+{
+  8038c5:	55                   	push   %ebp
+  8038c6:	89 e5                	mov    %esp,%ebp
+  8038c8:	53                   	push   %ebx
+  8038c9:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8038cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038cf:	50                   	push   %eax
+  8038d0:	e8 23 f8 ff ff       	call   8030f8 <fd_alloc>
+  8038d5:	89 c3                	mov    %eax,%ebx
+  8038d7:	83 c4 10             	add    $0x10,%esp
+  8038da:	85 c0                	test   %eax,%eax
+  8038dc:	78 2a                	js     803908 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8038de:	83 ec 0c             	sub    $0xc,%esp
+  8038e1:	ff 75 08             	push   0x8(%ebp)
+  8038e4:	e8 69 eb ff ff       	call   802452 <strlen>
+  8038e9:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8038ec:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8038f1:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038f6:	7e 17                	jle    80390f <open+0x4a>
+	fd_close(fd, 1);
+  8038f8:	83 ec 08             	sub    $0x8,%esp
+  8038fb:	6a 01                	push   $0x1
+  8038fd:	ff 75 f4             	push   -0xc(%ebp)
+  803900:	e8 08 f9 ff ff       	call   80320d <fd_close>
+	return r;
+  803905:	83 c4 10             	add    $0x10,%esp
+}
+  803908:	89 d8                	mov    %ebx,%eax
+  80390a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80390d:	c9                   	leave
+  80390e:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80390f:	83 ec 08             	sub    $0x8,%esp
+  803912:	ff 75 08             	push   0x8(%ebp)
+  803915:	68 00 d0 80 00       	push   $0x80d000
+  80391a:	e8 7f eb ff ff       	call   80249e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80391f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803922:	a3 00 d4 80 00       	mov    %eax,0x80d400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  803927:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80392a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80392f:	e8 07 fe ff ff       	call   80373b <fsipc>
+  803934:	89 c3                	mov    %eax,%ebx
+  803936:	83 c4 10             	add    $0x10,%esp
+  803939:	85 c0                	test   %eax,%eax
+  80393b:	78 bb                	js     8038f8 <open+0x33>
+	return fd2num(fd); 	
+  80393d:	83 ec 0c             	sub    $0xc,%esp
+  803940:	ff 75 f4             	push   -0xc(%ebp)
+  803943:	e8 89 f7 ff ff       	call   8030d1 <fd2num>
+  803948:	89 c3                	mov    %eax,%ebx
+  80394a:	83 c4 10             	add    $0x10,%esp
+  80394d:	eb b9                	jmp    803908 <open+0x43>
+
+0080394f <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  80394f:	55                   	push   %ebp
+  803950:	89 e5                	mov    %esp,%ebp
+  803952:	53                   	push   %ebx
+  803953:	83 ec 1c             	sub    $0x1c,%esp
+  803956:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803959:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80395c:	50                   	push   %eax
+  80395d:	ff 75 08             	push   0x8(%ebp)
+  803960:	e8 e3 f7 ff ff       	call   803148 <fd_lookup>
+  803965:	83 c4 10             	add    $0x10,%esp
+  803968:	85 c0                	test   %eax,%eax
+  80396a:	78 5a                	js     8039c6 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80396c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80396f:	8b 15 80 b0 80 00    	mov    0x80b080,%edx
+  803975:	39 10                	cmp    %edx,(%eax)
+  803977:	75 66                	jne    8039df <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  803979:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  803980:	74 49                	je     8039cb <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803982:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803985:	8b 40 0c             	mov    0xc(%eax),%eax
+  803988:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.map.req_offset = offset;
+  80398d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803990:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	fsipcbuf.map.req_npages = maxpages;
+  803995:	89 1d 08 d0 80 00    	mov    %ebx,0x80d008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80399b:	6a 07                	push   $0x7
+  80399d:	68 00 d0 80 00       	push   $0x80d000
+  8039a2:	6a 09                	push   $0x9
+  8039a4:	ff 35 00 c0 80 00    	push   0x80c000
+  8039aa:	e8 7a f6 ff ff       	call   803029 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8039af:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8039b6:	6a 00                	push   $0x0
+  8039b8:	53                   	push   %ebx
+  8039b9:	ff 75 10             	push   0x10(%ebp)
+  8039bc:	6a 00                	push   $0x0
+  8039be:	e8 a3 f4 ff ff       	call   802e66 <ipc_recv_pages>
+  8039c3:	83 c4 20             	add    $0x20,%esp
+}
+  8039c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c9:	c9                   	leave
+  8039ca:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039cb:	83 ec 0c             	sub    $0xc,%esp
+  8039ce:	6a 02                	push   $0x2
+  8039d0:	e8 bd f6 ff ff       	call   803092 <ipc_find_env>
+  8039d5:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  8039da:	83 c4 10             	add    $0x10,%esp
+  8039dd:	eb a3                	jmp    803982 <fmap+0x33>
+		return -E_INVAL;
+  8039df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039e4:	eb e0                	jmp    8039c6 <fmap+0x77>
+
+008039e6 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8039e6:	55                   	push   %ebp
+  8039e7:	89 e5                	mov    %esp,%ebp
+  8039e9:	53                   	push   %ebx
+  8039ea:	83 ec 10             	sub    $0x10,%esp
+  8039ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8039f0:	53                   	push   %ebx
+  8039f1:	e8 5c ea ff ff       	call   802452 <strlen>
+  8039f6:	83 c4 10             	add    $0x10,%esp
+  8039f9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8039fe:	7f 25                	jg     803a25 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  803a00:	83 ec 08             	sub    $0x8,%esp
+  803a03:	53                   	push   %ebx
+  803a04:	68 00 d0 80 00       	push   $0x80d000
+  803a09:	e8 90 ea ff ff       	call   80249e <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  803a0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a13:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a18:	e8 1e fd ff ff       	call   80373b <fsipc>
+  803a1d:	83 c4 10             	add    $0x10,%esp
+}
+  803a20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a23:	c9                   	leave
+  803a24:	c3                   	ret
+		return -E_BAD_PATH;
+  803a25:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  803a2a:	eb f4                	jmp    803a20 <remove+0x3a>
+
+00803a2c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803a2c:	55                   	push   %ebp
+  803a2d:	89 e5                	mov    %esp,%ebp
+  803a2f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  803a32:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a37:	b8 08 00 00 00       	mov    $0x8,%eax
+  803a3c:	e8 fa fc ff ff       	call   80373b <fsipc>
+}
+  803a41:	c9                   	leave
+  803a42:	c3                   	ret
+
+00803a43 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a43:	55                   	push   %ebp
+  803a44:	89 e5                	mov    %esp,%ebp
+  803a46:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a49:	89 c2                	mov    %eax,%edx
+  803a4b:	c1 ea 16             	shr    $0x16,%edx
+  803a4e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a55:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a5a:	f6 c1 01             	test   $0x1,%cl
+  803a5d:	74 1e                	je     803a7d <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803a5f:	c1 e8 0c             	shr    $0xc,%eax
+  803a62:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a69:	a8 01                	test   $0x1,%al
+  803a6b:	74 10                	je     803a7d <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a6d:	c1 e8 0c             	shr    $0xc,%eax
+  803a70:	c1 e0 04             	shl    $0x4,%eax
+  803a73:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803a7a:	0f b7 d2             	movzwl %dx,%edx
+}
+  803a7d:	89 d0                	mov    %edx,%eax
+  803a7f:	5d                   	pop    %ebp
+  803a80:	c3                   	ret
+
+00803a81 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803a81:	55                   	push   %ebp
+  803a82:	89 e5                	mov    %esp,%ebp
+  803a84:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803a87:	68 40 60 80 00       	push   $0x806040
+  803a8c:	ff 75 0c             	push   0xc(%ebp)
+  803a8f:	e8 0a ea ff ff       	call   80249e <strcpy>
+	return 0;
+}
+  803a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a99:	c9                   	leave
+  803a9a:	c3                   	ret
+
+00803a9b <devsock_close>:
+{
+  803a9b:	55                   	push   %ebp
+  803a9c:	89 e5                	mov    %esp,%ebp
+  803a9e:	53                   	push   %ebx
+  803a9f:	83 ec 10             	sub    $0x10,%esp
+  803aa2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803aa5:	53                   	push   %ebx
+  803aa6:	e8 98 ff ff ff       	call   803a43 <pageref>
+  803aab:	89 c2                	mov    %eax,%edx
+  803aad:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803ab5:	83 fa 01             	cmp    $0x1,%edx
+  803ab8:	74 05                	je     803abf <devsock_close+0x24>
+}
+  803aba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803abd:	c9                   	leave
+  803abe:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803abf:	83 ec 0c             	sub    $0xc,%esp
+  803ac2:	ff 73 0c             	push   0xc(%ebx)
+  803ac5:	e8 b0 05 00 00       	call   80407a <nsipc_close>
+  803aca:	83 c4 10             	add    $0x10,%esp
+  803acd:	eb eb                	jmp    803aba <devsock_close+0x1f>
+
+00803acf <devsock_write>:
+{
+  803acf:	55                   	push   %ebp
+  803ad0:	89 e5                	mov    %esp,%ebp
+  803ad2:	53                   	push   %ebx
+  803ad3:	83 ec 14             	sub    $0x14,%esp
+  803ad6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803ad9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803adc:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  803adf:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  803ae2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803ae5:	8b 41 08             	mov    0x8(%ecx),%eax
+  803ae8:	c1 f8 09             	sar    $0x9,%eax
+  803aeb:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  803aee:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803af4:	77 13                	ja     803b09 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  803af6:	50                   	push   %eax
+  803af7:	52                   	push   %edx
+  803af8:	53                   	push   %ebx
+  803af9:	ff 71 0c             	push   0xc(%ecx)
+  803afc:	e8 5c 06 00 00       	call   80415d <nsipc_send>
+  803b01:	83 c4 10             	add    $0x10,%esp
+}
+  803b04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b07:	c9                   	leave
+  803b08:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  803b09:	50                   	push   %eax
+  803b0a:	6a 01                	push   $0x1
+  803b0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b0f:	50                   	push   %eax
+  803b10:	ff 71 0c             	push   0xc(%ecx)
+  803b13:	e8 a6 06 00 00       	call   8041be <nsipc_sendmsg>
+  803b18:	83 c4 10             	add    $0x10,%esp
+  803b1b:	eb e7                	jmp    803b04 <devsock_write+0x35>
+
+00803b1d <devsock_read>:
+{
+  803b1d:	55                   	push   %ebp
+  803b1e:	89 e5                	mov    %esp,%ebp
+  803b20:	53                   	push   %ebx
+  803b21:	83 ec 14             	sub    $0x14,%esp
+  803b24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803b2a:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  803b2d:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  803b30:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803b33:	8b 41 08             	mov    0x8(%ecx),%eax
+  803b36:	c1 f8 09             	sar    $0x9,%eax
+  803b39:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  803b3c:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803b42:	77 13                	ja     803b57 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  803b44:	50                   	push   %eax
+  803b45:	52                   	push   %edx
+  803b46:	53                   	push   %ebx
+  803b47:	ff 71 0c             	push   0xc(%ecx)
+  803b4a:	e8 9c 05 00 00       	call   8040eb <nsipc_recv>
+  803b4f:	83 c4 10             	add    $0x10,%esp
+}
+  803b52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b55:	c9                   	leave
+  803b56:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  803b57:	50                   	push   %eax
+  803b58:	6a 01                	push   $0x1
+  803b5a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b5d:	50                   	push   %eax
+  803b5e:	ff 71 0c             	push   0xc(%ecx)
+  803b61:	e8 02 0a 00 00       	call   804568 <nsipc_recvmsg>
+  803b66:	83 c4 10             	add    $0x10,%esp
+  803b69:	eb e7                	jmp    803b52 <devsock_read+0x35>
+
+00803b6b <fd2sockid>:
+{
+  803b6b:	55                   	push   %ebp
+  803b6c:	89 e5                	mov    %esp,%ebp
+  803b6e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803b71:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803b74:	52                   	push   %edx
+  803b75:	50                   	push   %eax
+  803b76:	e8 cd f5 ff ff       	call   803148 <fd_lookup>
+  803b7b:	83 c4 10             	add    $0x10,%esp
+  803b7e:	85 c0                	test   %eax,%eax
+  803b80:	78 10                	js     803b92 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803b82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b85:	8b 0d a0 b0 80 00    	mov    0x80b0a0,%ecx
+  803b8b:	39 08                	cmp    %ecx,(%eax)
+  803b8d:	75 05                	jne    803b94 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803b8f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803b92:	c9                   	leave
+  803b93:	c3                   	ret
+		return -E_NOT_SUPP;
+  803b94:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803b99:	eb f7                	jmp    803b92 <fd2sockid+0x27>
+
+00803b9b <sock_flags>:
+{
+  803b9b:	55                   	push   %ebp
+  803b9c:	89 e5                	mov    %esp,%ebp
+  803b9e:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  803ba1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ba4:	52                   	push   %edx
+  803ba5:	50                   	push   %eax
+  803ba6:	e8 9d f5 ff ff       	call   803148 <fd_lookup>
+  803bab:	83 c4 10             	add    $0x10,%esp
+  803bae:	85 c0                	test   %eax,%eax
+  803bb0:	78 0e                	js     803bc0 <sock_flags+0x25>
+  803bb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bb5:	8b 40 08             	mov    0x8(%eax),%eax
+  803bb8:	c1 e8 09             	shr    $0x9,%eax
+  803bbb:	83 e0 08             	and    $0x8,%eax
+}
+  803bbe:	c9                   	leave
+  803bbf:	c3                   	ret
+		return 0;
+  803bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc5:	eb f7                	jmp    803bbe <sock_flags+0x23>
+
+00803bc7 <alloc_sockfd>:
+{
+  803bc7:	55                   	push   %ebp
+  803bc8:	89 e5                	mov    %esp,%ebp
+  803bca:	56                   	push   %esi
+  803bcb:	53                   	push   %ebx
+  803bcc:	83 ec 1c             	sub    $0x1c,%esp
+  803bcf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803bd1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bd4:	50                   	push   %eax
+  803bd5:	e8 1e f5 ff ff       	call   8030f8 <fd_alloc>
+  803bda:	89 c3                	mov    %eax,%ebx
+  803bdc:	83 c4 10             	add    $0x10,%esp
+  803bdf:	85 c0                	test   %eax,%eax
+  803be1:	78 43                	js     803c26 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803be3:	83 ec 04             	sub    $0x4,%esp
+  803be6:	68 07 04 00 00       	push   $0x407
+  803beb:	ff 75 f4             	push   -0xc(%ebp)
+  803bee:	6a 00                	push   $0x0
+  803bf0:	e8 dd ec ff ff       	call   8028d2 <sys_page_alloc>
+  803bf5:	89 c3                	mov    %eax,%ebx
+  803bf7:	83 c4 10             	add    $0x10,%esp
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	78 28                	js     803c26 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803bfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c01:	8b 15 a0 b0 80 00    	mov    0x80b0a0,%edx
+  803c07:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803c09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c0c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803c13:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803c16:	83 ec 0c             	sub    $0xc,%esp
+  803c19:	50                   	push   %eax
+  803c1a:	e8 b2 f4 ff ff       	call   8030d1 <fd2num>
+  803c1f:	89 c3                	mov    %eax,%ebx
+  803c21:	83 c4 10             	add    $0x10,%esp
+  803c24:	eb 0c                	jmp    803c32 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803c26:	83 ec 0c             	sub    $0xc,%esp
+  803c29:	56                   	push   %esi
+  803c2a:	e8 4b 04 00 00       	call   80407a <nsipc_close>
+		return r;
+  803c2f:	83 c4 10             	add    $0x10,%esp
+}
+  803c32:	89 d8                	mov    %ebx,%eax
+  803c34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c37:	5b                   	pop    %ebx
+  803c38:	5e                   	pop    %esi
+  803c39:	5d                   	pop    %ebp
+  803c3a:	c3                   	ret
+
+00803c3b <accept>:
+{
+  803c3b:	55                   	push   %ebp
+  803c3c:	89 e5                	mov    %esp,%ebp
+  803c3e:	56                   	push   %esi
+  803c3f:	53                   	push   %ebx
+  803c40:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803c43:	89 f0                	mov    %esi,%eax
+  803c45:	e8 21 ff ff ff       	call   803b6b <fd2sockid>
+  803c4a:	89 c3                	mov    %eax,%ebx
+  803c4c:	85 c0                	test   %eax,%eax
+  803c4e:	78 24                	js     803c74 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  803c50:	89 f0                	mov    %esi,%eax
+  803c52:	e8 44 ff ff ff       	call   803b9b <sock_flags>
+  803c57:	50                   	push   %eax
+  803c58:	ff 75 10             	push   0x10(%ebp)
+  803c5b:	ff 75 0c             	push   0xc(%ebp)
+  803c5e:	53                   	push   %ebx
+  803c5f:	e8 6b 03 00 00       	call   803fcf <nsipc_accept>
+  803c64:	89 c3                	mov    %eax,%ebx
+  803c66:	83 c4 10             	add    $0x10,%esp
+  803c69:	85 c0                	test   %eax,%eax
+  803c6b:	78 07                	js     803c74 <accept+0x39>
+	return alloc_sockfd(r);
+  803c6d:	e8 55 ff ff ff       	call   803bc7 <alloc_sockfd>
+  803c72:	89 c3                	mov    %eax,%ebx
+}
+  803c74:	89 d8                	mov    %ebx,%eax
+  803c76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c79:	5b                   	pop    %ebx
+  803c7a:	5e                   	pop    %esi
+  803c7b:	5d                   	pop    %ebp
+  803c7c:	c3                   	ret
+
+00803c7d <bind>:
+{
+  803c7d:	55                   	push   %ebp
+  803c7e:	89 e5                	mov    %esp,%ebp
+  803c80:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c86:	e8 e0 fe ff ff       	call   803b6b <fd2sockid>
+  803c8b:	85 c0                	test   %eax,%eax
+  803c8d:	78 12                	js     803ca1 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803c8f:	83 ec 04             	sub    $0x4,%esp
+  803c92:	ff 75 10             	push   0x10(%ebp)
+  803c95:	ff 75 0c             	push   0xc(%ebp)
+  803c98:	50                   	push   %eax
+  803c99:	e8 85 03 00 00       	call   804023 <nsipc_bind>
+  803c9e:	83 c4 10             	add    $0x10,%esp
+}
+  803ca1:	c9                   	leave
+  803ca2:	c3                   	ret
+
+00803ca3 <shutdown>:
+{
+  803ca3:	55                   	push   %ebp
+  803ca4:	89 e5                	mov    %esp,%ebp
+  803ca6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cac:	e8 ba fe ff ff       	call   803b6b <fd2sockid>
+  803cb1:	85 c0                	test   %eax,%eax
+  803cb3:	78 0f                	js     803cc4 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803cb5:	83 ec 08             	sub    $0x8,%esp
+  803cb8:	ff 75 0c             	push   0xc(%ebp)
+  803cbb:	50                   	push   %eax
+  803cbc:	e8 97 03 00 00       	call   804058 <nsipc_shutdown>
+  803cc1:	83 c4 10             	add    $0x10,%esp
+}
+  803cc4:	c9                   	leave
+  803cc5:	c3                   	ret
+
+00803cc6 <connect>:
+{
+  803cc6:	55                   	push   %ebp
+  803cc7:	89 e5                	mov    %esp,%ebp
+  803cc9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ccf:	e8 97 fe ff ff       	call   803b6b <fd2sockid>
+  803cd4:	85 c0                	test   %eax,%eax
+  803cd6:	78 12                	js     803cea <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803cd8:	83 ec 04             	sub    $0x4,%esp
+  803cdb:	ff 75 10             	push   0x10(%ebp)
+  803cde:	ff 75 0c             	push   0xc(%ebp)
+  803ce1:	50                   	push   %eax
+  803ce2:	e8 ad 03 00 00       	call   804094 <nsipc_connect>
+  803ce7:	83 c4 10             	add    $0x10,%esp
+}
+  803cea:	c9                   	leave
+  803ceb:	c3                   	ret
+
+00803cec <listen>:
+{
+  803cec:	55                   	push   %ebp
+  803ced:	89 e5                	mov    %esp,%ebp
+  803cef:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cf5:	e8 71 fe ff ff       	call   803b6b <fd2sockid>
+  803cfa:	85 c0                	test   %eax,%eax
+  803cfc:	78 0f                	js     803d0d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803cfe:	83 ec 08             	sub    $0x8,%esp
+  803d01:	ff 75 0c             	push   0xc(%ebp)
+  803d04:	50                   	push   %eax
+  803d05:	e8 bf 03 00 00       	call   8040c9 <nsipc_listen>
+  803d0a:	83 c4 10             	add    $0x10,%esp
+}
+  803d0d:	c9                   	leave
+  803d0e:	c3                   	ret
+
+00803d0f <sendmsg>:
+{
+  803d0f:	55                   	push   %ebp
+  803d10:	89 e5                	mov    %esp,%ebp
+  803d12:	57                   	push   %edi
+  803d13:	56                   	push   %esi
+  803d14:	53                   	push   %ebx
+  803d15:	83 ec 0c             	sub    $0xc,%esp
+  803d18:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d1b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  803d1e:	89 f0                	mov    %esi,%eax
+  803d20:	e8 46 fe ff ff       	call   803b6b <fd2sockid>
+  803d25:	89 c3                	mov    %eax,%ebx
+  803d27:	85 c0                	test   %eax,%eax
+  803d29:	78 1c                	js     803d47 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  803d2b:	89 f0                	mov    %esi,%eax
+  803d2d:	e8 69 fe ff ff       	call   803b9b <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  803d32:	0b 45 10             	or     0x10(%ebp),%eax
+  803d35:	50                   	push   %eax
+  803d36:	ff 77 0c             	push   0xc(%edi)
+  803d39:	ff 77 08             	push   0x8(%edi)
+  803d3c:	53                   	push   %ebx
+  803d3d:	e8 7c 04 00 00       	call   8041be <nsipc_sendmsg>
+  803d42:	89 c3                	mov    %eax,%ebx
+  803d44:	83 c4 10             	add    $0x10,%esp
+}
+  803d47:	89 d8                	mov    %ebx,%eax
+  803d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d4c:	5b                   	pop    %ebx
+  803d4d:	5e                   	pop    %esi
+  803d4e:	5f                   	pop    %edi
+  803d4f:	5d                   	pop    %ebp
+  803d50:	c3                   	ret
+
+00803d51 <recvmsg>:
+{
+  803d51:	55                   	push   %ebp
+  803d52:	89 e5                	mov    %esp,%ebp
+  803d54:	57                   	push   %edi
+  803d55:	56                   	push   %esi
+  803d56:	53                   	push   %ebx
+  803d57:	83 ec 0c             	sub    $0xc,%esp
+  803d5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d5d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803d60:	89 f8                	mov    %edi,%eax
+  803d62:	e8 04 fe ff ff       	call   803b6b <fd2sockid>
+  803d67:	89 c3                	mov    %eax,%ebx
+  803d69:	85 c0                	test   %eax,%eax
+  803d6b:	78 2a                	js     803d97 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  803d6d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  803d74:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  803d7b:	89 f8                	mov    %edi,%eax
+  803d7d:	e8 19 fe ff ff       	call   803b9b <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  803d82:	0b 45 10             	or     0x10(%ebp),%eax
+  803d85:	50                   	push   %eax
+  803d86:	ff 76 0c             	push   0xc(%esi)
+  803d89:	ff 76 08             	push   0x8(%esi)
+  803d8c:	53                   	push   %ebx
+  803d8d:	e8 d6 07 00 00       	call   804568 <nsipc_recvmsg>
+  803d92:	89 c3                	mov    %eax,%ebx
+  803d94:	83 c4 10             	add    $0x10,%esp
+}
+  803d97:	89 d8                	mov    %ebx,%eax
+  803d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d9c:	5b                   	pop    %ebx
+  803d9d:	5e                   	pop    %esi
+  803d9e:	5f                   	pop    %edi
+  803d9f:	5d                   	pop    %ebp
+  803da0:	c3                   	ret
+
+00803da1 <sendfile>:
+{
+  803da1:	55                   	push   %ebp
+  803da2:	89 e5                	mov    %esp,%ebp
+  803da4:	56                   	push   %esi
+  803da5:	53                   	push   %ebx
+  803da6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803da9:	89 f0                	mov    %esi,%eax
+  803dab:	e8 bb fd ff ff       	call   803b6b <fd2sockid>
+  803db0:	89 c3                	mov    %eax,%ebx
+  803db2:	85 c0                	test   %eax,%eax
+  803db4:	78 1f                	js     803dd5 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  803db6:	89 f0                	mov    %esi,%eax
+  803db8:	e8 de fd ff ff       	call   803b9b <sock_flags>
+  803dbd:	83 ec 0c             	sub    $0xc,%esp
+  803dc0:	50                   	push   %eax
+  803dc1:	ff 75 14             	push   0x14(%ebp)
+  803dc4:	ff 75 10             	push   0x10(%ebp)
+  803dc7:	ff 75 0c             	push   0xc(%ebp)
+  803dca:	53                   	push   %ebx
+  803dcb:	e8 64 06 00 00       	call   804434 <nsipc_sendfile>
+  803dd0:	89 c3                	mov    %eax,%ebx
+  803dd2:	83 c4 20             	add    $0x20,%esp
+}
+  803dd5:	89 d8                	mov    %ebx,%eax
+  803dd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dda:	5b                   	pop    %ebx
+  803ddb:	5e                   	pop    %esi
+  803ddc:	5d                   	pop    %ebp
+  803ddd:	c3                   	ret
+
+00803dde <evctl>:
+{
+  803dde:	55                   	push   %ebp
+  803ddf:	89 e5                	mov    %esp,%ebp
+  803de1:	53                   	push   %ebx
+  803de2:	83 ec 04             	sub    $0x4,%esp
+  803de5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  803de8:	89 d8                	mov    %ebx,%eax
+  803dea:	e8 7c fd ff ff       	call   803b6b <fd2sockid>
+  803def:	85 c0                	test   %eax,%eax
+  803df1:	78 10                	js     803e03 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  803df3:	83 ec 04             	sub    $0x4,%esp
+  803df6:	53                   	push   %ebx
+  803df7:	ff 75 0c             	push   0xc(%ebp)
+  803dfa:	50                   	push   %eax
+  803dfb:	e8 d2 0b 00 00       	call   8049d2 <nsipc_evctl>
+  803e00:	83 c4 10             	add    $0x10,%esp
+}
+  803e03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e06:	c9                   	leave
+  803e07:	c3                   	ret
+
+00803e08 <evwait>:
+{
+  803e08:	55                   	push   %ebp
+  803e09:	89 e5                	mov    %esp,%ebp
+  803e0b:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  803e0e:	ff 75 10             	push   0x10(%ebp)
+  803e11:	ff 75 0c             	push   0xc(%ebp)
+  803e14:	ff 75 08             	push   0x8(%ebp)
+  803e17:	e8 e0 0b 00 00       	call   8049fc <nsipc_evwait>
+}
+  803e1c:	c9                   	leave
+  803e1d:	c3                   	ret
+
+00803e1e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803e1e:	55                   	push   %ebp
+  803e1f:	89 e5                	mov    %esp,%ebp
+  803e21:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803e24:	ff 75 10             	push   0x10(%ebp)
+  803e27:	ff 75 0c             	push   0xc(%ebp)
+  803e2a:	ff 75 08             	push   0x8(%ebp)
+  803e2d:	e8 31 0c 00 00       	call   804a63 <nsipc_socket>
+  803e32:	83 c4 10             	add    $0x10,%esp
+  803e35:	85 c0                	test   %eax,%eax
+  803e37:	78 05                	js     803e3e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803e39:	e8 89 fd ff ff       	call   803bc7 <alloc_sockfd>
+}
+  803e3e:	c9                   	leave
+  803e3f:	c3                   	ret
+
+00803e40 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803e40:	55                   	push   %ebp
+  803e41:	89 e5                	mov    %esp,%ebp
+  803e43:	53                   	push   %ebx
+  803e44:	83 ec 04             	sub    $0x4,%esp
+  803e47:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  803e49:	83 3d 24 c3 80 00 00 	cmpl   $0x0,0x80c324
+  803e50:	74 26                	je     803e78 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803e52:	6a 07                	push   $0x7
+  803e54:	68 00 e0 80 00       	push   $0x80e000
+  803e59:	53                   	push   %ebx
+  803e5a:	ff 35 24 c3 80 00    	push   0x80c324
+  803e60:	e8 c4 f1 ff ff       	call   803029 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803e65:	83 c4 0c             	add    $0xc,%esp
+  803e68:	6a 00                	push   $0x0
+  803e6a:	6a 00                	push   $0x0
+  803e6c:	6a 00                	push   $0x0
+  803e6e:	e8 26 ef ff ff       	call   802d99 <ipc_recv>
+}
+  803e73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e76:	c9                   	leave
+  803e77:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803e78:	83 ec 0c             	sub    $0xc,%esp
+  803e7b:	6a 03                	push   $0x3
+  803e7d:	e8 10 f2 ff ff       	call   803092 <ipc_find_env>
+  803e82:	a3 24 c3 80 00       	mov    %eax,0x80c324
+  803e87:	83 c4 10             	add    $0x10,%esp
+  803e8a:	eb c6                	jmp    803e52 <nsipc+0x12>
+
+00803e8c <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  803e8c:	55                   	push   %ebp
+  803e8d:	89 e5                	mov    %esp,%ebp
+  803e8f:	56                   	push   %esi
+  803e90:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  803e91:	8b 35 30 c3 80 00    	mov    0x80c330,%esi
+		return 0;
+  803e97:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  803e9c:	85 f6                	test   %esi,%esi
+  803e9e:	75 33                	jne    803ed3 <nsbulk_map+0x47>
+  803ea0:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  803ea5:	83 ec 04             	sub    $0x4,%esp
+  803ea8:	6a 07                	push   $0x7
+  803eaa:	53                   	push   %ebx
+  803eab:	6a 00                	push   $0x0
+  803ead:	e8 20 ea ff ff       	call   8028d2 <sys_page_alloc>
+  803eb2:	83 c4 10             	add    $0x10,%esp
+  803eb5:	85 c0                	test   %eax,%eax
+  803eb7:	78 1a                	js     803ed3 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  803eb9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803ebf:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  803ec5:	75 de                	jne    803ea5 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  803ec7:	c7 05 30 c3 80 00 01 	movl   $0x1,0x80c330
+  803ece:	00 00 00 
+	return 0;
+  803ed1:	89 f0                	mov    %esi,%eax
+}
+  803ed3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ed6:	5b                   	pop    %ebx
+  803ed7:	5e                   	pop    %esi
+  803ed8:	5d                   	pop    %ebp
+  803ed9:	c3                   	ret
+
+00803eda <nsbulk_own>:
+{
+  803eda:	55                   	push   %ebp
+  803edb:	89 e5                	mov    %esp,%ebp
+  803edd:	57                   	push   %edi
+  803ede:	56                   	push   %esi
+  803edf:	53                   	push   %ebx
+  803ee0:	83 ec 0c             	sub    $0xc,%esp
+  803ee3:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  803ee5:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  803ee8:	85 d2                	test   %edx,%edx
+  803eea:	7f 0e                	jg     803efa <nsbulk_own+0x20>
+	return 0;
+  803eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef1:	eb 47                	jmp    803f3a <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  803ef3:	83 c3 01             	add    $0x1,%ebx
+  803ef6:	39 fb                	cmp    %edi,%ebx
+  803ef8:	7d 3b                	jge    803f35 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  803efa:	be 01 00 00 00       	mov    $0x1,%esi
+  803eff:	89 d9                	mov    %ebx,%ecx
+  803f01:	d3 e6                	shl    %cl,%esi
+  803f03:	89 f0                	mov    %esi,%eax
+  803f05:	23 05 2c c3 80 00    	and    0x80c32c,%eax
+  803f0b:	74 e6                	je     803ef3 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  803f0d:	83 ec 04             	sub    $0x4,%esp
+  803f10:	6a 07                	push   $0x7
+  803f12:	89 d8                	mov    %ebx,%eax
+  803f14:	c1 e0 0c             	shl    $0xc,%eax
+  803f17:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803f1c:	50                   	push   %eax
+  803f1d:	6a 00                	push   $0x0
+  803f1f:	e8 ae e9 ff ff       	call   8028d2 <sys_page_alloc>
+  803f24:	83 c4 10             	add    $0x10,%esp
+  803f27:	85 c0                	test   %eax,%eax
+  803f29:	78 0f                	js     803f3a <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  803f2b:	f7 d6                	not    %esi
+  803f2d:	21 35 2c c3 80 00    	and    %esi,0x80c32c
+  803f33:	eb be                	jmp    803ef3 <nsbulk_own+0x19>
+	return 0;
+  803f35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f3d:	5b                   	pop    %ebx
+  803f3e:	5e                   	pop    %esi
+  803f3f:	5f                   	pop    %edi
+  803f40:	5d                   	pop    %ebp
+  803f41:	c3                   	ret
+
+00803f42 <nsipc_bulk>:
+{
+  803f42:	55                   	push   %ebp
+  803f43:	89 e5                	mov    %esp,%ebp
+  803f45:	57                   	push   %edi
+  803f46:	56                   	push   %esi
+  803f47:	53                   	push   %ebx
+  803f48:	83 ec 1c             	sub    $0x1c,%esp
+  803f4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803f4e:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  803f50:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  803f56:	c1 fb 0c             	sar    $0xc,%ebx
+  803f59:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  803f5c:	83 3d 24 c3 80 00 00 	cmpl   $0x0,0x80c324
+  803f63:	74 56                	je     803fbb <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803f65:	85 ff                	test   %edi,%edi
+  803f67:	7e 24                	jle    803f8d <nsipc_bulk+0x4b>
+  803f69:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  803f6f:	74 1c                	je     803f8d <nsipc_bulk+0x4b>
+  803f71:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  803f77:	c1 e3 0c             	shl    $0xc,%ebx
+  803f7a:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  803f7f:	0f b6 10             	movzbl (%eax),%edx
+  803f82:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803f84:	05 00 10 00 00       	add    $0x1000,%eax
+  803f89:	39 d8                	cmp    %ebx,%eax
+  803f8b:	75 f2                	jne    803f7f <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  803f8d:	83 ec 0c             	sub    $0xc,%esp
+  803f90:	56                   	push   %esi
+  803f91:	57                   	push   %edi
+  803f92:	68 00 00 00 e0       	push   $0xe0000000
+  803f97:	ff 75 e4             	push   -0x1c(%ebp)
+  803f9a:	ff 35 24 c3 80 00    	push   0x80c324
+  803fa0:	e8 b8 f0 ff ff       	call   80305d <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  803fa5:	83 c4 1c             	add    $0x1c,%esp
+  803fa8:	6a 00                	push   $0x0
+  803faa:	6a 00                	push   $0x0
+  803fac:	6a 00                	push   $0x0
+  803fae:	e8 e6 ed ff ff       	call   802d99 <ipc_recv>
+}
+  803fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fb6:	5b                   	pop    %ebx
+  803fb7:	5e                   	pop    %esi
+  803fb8:	5f                   	pop    %edi
+  803fb9:	5d                   	pop    %ebp
+  803fba:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803fbb:	83 ec 0c             	sub    $0xc,%esp
+  803fbe:	6a 03                	push   $0x3
+  803fc0:	e8 cd f0 ff ff       	call   803092 <ipc_find_env>
+  803fc5:	a3 24 c3 80 00       	mov    %eax,0x80c324
+  803fca:	83 c4 10             	add    $0x10,%esp
+  803fcd:	eb 96                	jmp    803f65 <nsipc_bulk+0x23>
+
+00803fcf <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  803fcf:	55                   	push   %ebp
+  803fd0:	89 e5                	mov    %esp,%ebp
+  803fd2:	53                   	push   %ebx
+  803fd3:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fd9:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.accept.req_flags = flags;
+  803fde:	8b 45 14             	mov    0x14(%ebp),%eax
+  803fe1:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803fe6:	b8 01 00 00 00       	mov    $0x1,%eax
+  803feb:	e8 50 fe ff ff       	call   803e40 <nsipc>
+  803ff0:	89 c3                	mov    %eax,%ebx
+  803ff2:	85 c0                	test   %eax,%eax
+  803ff4:	79 07                	jns    803ffd <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803ff6:	89 d8                	mov    %ebx,%eax
+  803ff8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ffb:	c9                   	leave
+  803ffc:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803ffd:	83 ec 04             	sub    $0x4,%esp
+  804000:	ff 35 10 e0 80 00    	push   0x80e010
+  804006:	68 00 e0 80 00       	push   $0x80e000
+  80400b:	ff 75 0c             	push   0xc(%ebp)
+  80400e:	e8 3b e6 ff ff       	call   80264e <memmove>
+		*addrlen = ret->ret_addrlen;
+  804013:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  804019:	8b 45 10             	mov    0x10(%ebp),%eax
+  80401c:	89 10                	mov    %edx,(%eax)
+  80401e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  804021:	eb d3                	jmp    803ff6 <nsipc_accept+0x27>
+
+00804023 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804023:	55                   	push   %ebp
+  804024:	89 e5                	mov    %esp,%ebp
+  804026:	53                   	push   %ebx
+  804027:	83 ec 08             	sub    $0x8,%esp
+  80402a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80402d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804030:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804035:	53                   	push   %ebx
+  804036:	ff 75 0c             	push   0xc(%ebp)
+  804039:	68 04 e0 80 00       	push   $0x80e004
+  80403e:	e8 0b e6 ff ff       	call   80264e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  804043:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_BIND);
+  804049:	b8 02 00 00 00       	mov    $0x2,%eax
+  80404e:	e8 ed fd ff ff       	call   803e40 <nsipc>
+}
+  804053:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804056:	c9                   	leave
+  804057:	c3                   	ret
+
+00804058 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804058:	55                   	push   %ebp
+  804059:	89 e5                	mov    %esp,%ebp
+  80405b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80405e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804061:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.shutdown.req_how = how;
+  804066:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804069:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_SHUTDOWN);
+  80406e:	b8 03 00 00 00       	mov    $0x3,%eax
+  804073:	e8 c8 fd ff ff       	call   803e40 <nsipc>
+}
+  804078:	c9                   	leave
+  804079:	c3                   	ret
+
+0080407a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80407a:	55                   	push   %ebp
+  80407b:	89 e5                	mov    %esp,%ebp
+  80407d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  804080:	8b 45 08             	mov    0x8(%ebp),%eax
+  804083:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_CLOSE);
+  804088:	b8 04 00 00 00       	mov    $0x4,%eax
+  80408d:	e8 ae fd ff ff       	call   803e40 <nsipc>
+}
+  804092:	c9                   	leave
+  804093:	c3                   	ret
+
+00804094 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804094:	55                   	push   %ebp
+  804095:	89 e5                	mov    %esp,%ebp
+  804097:	53                   	push   %ebx
+  804098:	83 ec 08             	sub    $0x8,%esp
+  80409b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80409e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040a1:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8040a6:	53                   	push   %ebx
+  8040a7:	ff 75 0c             	push   0xc(%ebp)
+  8040aa:	68 04 e0 80 00       	push   $0x80e004
+  8040af:	e8 9a e5 ff ff       	call   80264e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8040b4:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_CONNECT);
+  8040ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8040bf:	e8 7c fd ff ff       	call   803e40 <nsipc>
+}
+  8040c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040c7:	c9                   	leave
+  8040c8:	c3                   	ret
+
+008040c9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8040c9:	55                   	push   %ebp
+  8040ca:	89 e5                	mov    %esp,%ebp
+  8040cc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8040cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040d2:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.listen.req_backlog = backlog;
+  8040d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8040da:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_LISTEN);
+  8040df:	b8 06 00 00 00       	mov    $0x6,%eax
+  8040e4:	e8 57 fd ff ff       	call   803e40 <nsipc>
+}
+  8040e9:	c9                   	leave
+  8040ea:	c3                   	ret
+
+008040eb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8040eb:	55                   	push   %ebp
+  8040ec:	89 e5                	mov    %esp,%ebp
+  8040ee:	56                   	push   %esi
+  8040ef:	53                   	push   %ebx
+  8040f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8040f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040f6:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.recv.req_len = len;
+  8040fb:	89 35 04 e0 80 00    	mov    %esi,0x80e004
+	nsipcbuf.recv.req_flags = flags;
+  804101:	8b 45 14             	mov    0x14(%ebp),%eax
+  804104:	a3 08 e0 80 00       	mov    %eax,0x80e008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804109:	b8 07 00 00 00       	mov    $0x7,%eax
+  80410e:	e8 2d fd ff ff       	call   803e40 <nsipc>
+  804113:	89 c3                	mov    %eax,%ebx
+  804115:	85 c0                	test   %eax,%eax
+  804117:	78 22                	js     80413b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  804119:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80411e:	39 c6                	cmp    %eax,%esi
+  804120:	0f 4e c6             	cmovle %esi,%eax
+  804123:	39 c3                	cmp    %eax,%ebx
+  804125:	7f 1d                	jg     804144 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804127:	83 ec 04             	sub    $0x4,%esp
+  80412a:	53                   	push   %ebx
+  80412b:	68 00 e0 80 00       	push   $0x80e000
+  804130:	ff 75 0c             	push   0xc(%ebp)
+  804133:	e8 16 e5 ff ff       	call   80264e <memmove>
+  804138:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80413b:	89 d8                	mov    %ebx,%eax
+  80413d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804140:	5b                   	pop    %ebx
+  804141:	5e                   	pop    %esi
+  804142:	5d                   	pop    %ebp
+  804143:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  804144:	68 4c 60 80 00       	push   $0x80604c
+  804149:	68 fd 56 80 00       	push   $0x8056fd
+  80414e:	68 b2 00 00 00       	push   $0xb2
+  804153:	68 61 60 80 00       	push   $0x806061
+  804158:	e8 6f db ff ff       	call   801ccc <_panic>
+
+0080415d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80415d:	55                   	push   %ebp
+  80415e:	89 e5                	mov    %esp,%ebp
+  804160:	53                   	push   %ebx
+  804161:	83 ec 04             	sub    $0x4,%esp
+  804164:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  804167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80416a:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	assert(size < 1600);
+  80416f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  804175:	7f 2e                	jg     8041a5 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  804177:	83 ec 04             	sub    $0x4,%esp
+  80417a:	53                   	push   %ebx
+  80417b:	ff 75 0c             	push   0xc(%ebp)
+  80417e:	68 0c e0 80 00       	push   $0x80e00c
+  804183:	e8 c6 e4 ff ff       	call   80264e <memmove>
+	nsipcbuf.send.req_size = size;
+  804188:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+	nsipcbuf.send.req_flags = flags;
+  80418e:	8b 45 14             	mov    0x14(%ebp),%eax
+  804191:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SEND);
+  804196:	b8 08 00 00 00       	mov    $0x8,%eax
+  80419b:	e8 a0 fc ff ff       	call   803e40 <nsipc>
+}
+  8041a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041a3:	c9                   	leave
+  8041a4:	c3                   	ret
+	assert(size < 1600);
+  8041a5:	68 6d 60 80 00       	push   $0x80606d
+  8041aa:	68 fd 56 80 00       	push   $0x8056fd
+  8041af:	68 bd 00 00 00       	push   $0xbd
+  8041b4:	68 61 60 80 00       	push   $0x806061
+  8041b9:	e8 0e db ff ff       	call   801ccc <_panic>
+
+008041be <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8041be:	55                   	push   %ebp
+  8041bf:	89 e5                	mov    %esp,%ebp
+  8041c1:	57                   	push   %edi
+  8041c2:	56                   	push   %esi
+  8041c3:	53                   	push   %ebx
+  8041c4:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8041c7:	e8 c0 fc ff ff       	call   803e8c <nsbulk_map>
+  8041cc:	85 c0                	test   %eax,%eax
+  8041ce:	78 55                	js     804225 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8041d0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8041d7:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8041de:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8041e5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8041e8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8041eb:	0f 8d 24 02 00 00    	jge    804415 <nsipc_sendmsg+0x257>
+  8041f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8041f4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8041f7:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8041fa:	89 d8                	mov    %ebx,%eax
+  8041fc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804201:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  804203:	83 ec 0c             	sub    $0xc,%esp
+  804206:	68 20 c0 80 00       	push   $0x80c020
+  80420b:	e8 5a 0f 00 00       	call   80516a <pgbatch_init>
+  804210:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  804213:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  804215:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  804218:	e9 82 00 00 00       	jmp    80429f <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80421d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  804220:	85 db                	test   %ebx,%ebx
+  804222:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  804225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804228:	5b                   	pop    %ebx
+  804229:	5e                   	pop    %esi
+  80422a:	5f                   	pop    %edi
+  80422b:	5d                   	pop    %ebp
+  80422c:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80422d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  804232:	29 c8                	sub    %ecx,%eax
+  804234:	39 d0                	cmp    %edx,%eax
+  804236:	0f 46 d0             	cmovbe %eax,%edx
+  804239:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80423b:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  804241:	85 ff                	test   %edi,%edi
+  804243:	0f 49 c7             	cmovns %edi,%eax
+  804246:	c1 f8 0c             	sar    $0xc,%eax
+  804249:	ba 01 00 00 00       	mov    $0x1,%edx
+  80424e:	e8 87 fc ff ff       	call   803eda <nsbulk_own>
+  804253:	85 c0                	test   %eax,%eax
+  804255:	0f 88 17 01 00 00    	js     804372 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80425b:	83 ec 04             	sub    $0x4,%esp
+  80425e:	56                   	push   %esi
+  80425f:	ff 75 e0             	push   -0x20(%ebp)
+  804262:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804265:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80426a:	50                   	push   %eax
+  80426b:	e8 de e3 ff ff       	call   80264e <memmove>
+  804270:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  804273:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  804276:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804279:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80427c:	0f 84 fd 00 00 00    	je     80437f <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  804282:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804285:	01 f7                	add    %esi,%edi
+  804287:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80428a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80428d:	0f 8d 01 01 00 00    	jge    804394 <nsipc_sendmsg+0x1d6>
+  804293:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  804299:	0f 8f f0 00 00 00    	jg     80438f <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80429f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042a2:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8042a5:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8042a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042ab:	89 c2                	mov    %eax,%edx
+  8042ad:	03 13                	add    (%ebx),%edx
+  8042af:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8042b2:	8b 73 04             	mov    0x4(%ebx),%esi
+  8042b5:	29 c6                	sub    %eax,%esi
+  8042b7:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8042bc:	29 f9                	sub    %edi,%ecx
+  8042be:	39 ce                	cmp    %ecx,%esi
+  8042c0:	89 ca                	mov    %ecx,%edx
+  8042c2:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8042c5:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8042c8:	89 f9                	mov    %edi,%ecx
+  8042ca:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8042d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8042d3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8042d8:	09 c8                	or     %ecx,%eax
+  8042da:	0f 85 4d ff ff ff    	jne    80422d <nsipc_sendmsg+0x6f>
+  8042e0:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8042e6:	0f 86 41 ff ff ff    	jbe    80422d <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8042ec:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8042f2:	85 ff                	test   %edi,%edi
+  8042f4:	0f 49 c7             	cmovns %edi,%eax
+  8042f7:	c1 f8 0c             	sar    $0xc,%eax
+  8042fa:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8042fc:	89 d1                	mov    %edx,%ecx
+  8042fe:	c1 e9 0c             	shr    $0xc,%ecx
+  804301:	01 c8                	add    %ecx,%eax
+  804303:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  804306:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804309:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80430b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80430e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  804313:	29 c8                	sub    %ecx,%eax
+  804315:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  804318:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80431b:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80431d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804322:	89 f9                	mov    %edi,%ecx
+  804324:	d3 e0                	shl    %cl,%eax
+  804326:	09 05 2c c3 80 00    	or     %eax,0x80c32c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80432c:	83 ec 08             	sub    $0x8,%esp
+  80432f:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  804331:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  804334:	50                   	push   %eax
+  804335:	6a 00                	push   $0x0
+  804337:	56                   	push   %esi
+  804338:	6a 00                	push   $0x0
+  80433a:	68 20 c0 80 00       	push   $0x80c020
+  80433f:	e8 e4 0e 00 00       	call   805228 <pgbatch_map>
+  804344:	83 c4 20             	add    $0x20,%esp
+  804347:	85 c0                	test   %eax,%eax
+  804349:	0f 88 ce fe ff ff    	js     80421d <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80434f:	83 c7 01             	add    $0x1,%edi
+  804352:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804358:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80435b:	39 c7                	cmp    %eax,%edi
+  80435d:	75 be                	jne    80431d <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80435f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804362:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  804365:	89 d6                	mov    %edx,%esi
+  804367:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80436d:	e9 01 ff ff ff       	jmp    804273 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  804372:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  804375:	85 db                	test   %ebx,%ebx
+  804377:	0f 45 c3             	cmovne %ebx,%eax
+  80437a:	e9 a6 fe ff ff       	jmp    804225 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80437f:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  804383:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80438a:	e9 f3 fe ff ff       	jmp    804282 <nsipc_sendmsg+0xc4>
+  80438f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  804392:	eb 03                	jmp    804397 <nsipc_sendmsg+0x1d9>
+  804394:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  804397:	83 ec 0c             	sub    $0xc,%esp
+  80439a:	68 20 c0 80 00       	push   $0x80c020
+  80439f:	e8 d4 0d 00 00       	call   805178 <pgbatch_flush>
+  8043a4:	83 c4 10             	add    $0x10,%esp
+  8043a7:	85 c0                	test   %eax,%eax
+  8043a9:	78 50                	js     8043fb <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8043ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043ae:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8043b3:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8043b9:	89 fb                	mov    %edi,%ebx
+  8043bb:	29 f3                	sub    %esi,%ebx
+  8043bd:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8043c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8043c6:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8043cb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8043d0:	89 fa                	mov    %edi,%edx
+  8043d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8043d7:	e8 66 fb ff ff       	call   803f42 <nsipc_bulk>
+  8043dc:	85 c0                	test   %eax,%eax
+  8043de:	78 28                	js     804408 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8043e0:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8043e3:	39 c3                	cmp    %eax,%ebx
+  8043e5:	75 0c                	jne    8043f3 <nsipc_sendmsg+0x235>
+  8043e7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8043ea:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8043ed:	0f 8f f2 fd ff ff    	jg     8041e5 <nsipc_sendmsg+0x27>
+		sent += r;
+  8043f3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8043f6:	e9 2a fe ff ff       	jmp    804225 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8043fb:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8043fe:	85 db                	test   %ebx,%ebx
+  804400:	0f 45 c3             	cmovne %ebx,%eax
+  804403:	e9 1d fe ff ff       	jmp    804225 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  804408:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80440b:	85 db                	test   %ebx,%ebx
+  80440d:	0f 45 c3             	cmovne %ebx,%eax
+  804410:	e9 10 fe ff ff       	jmp    804225 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  804415:	83 ec 0c             	sub    $0xc,%esp
+  804418:	68 20 c0 80 00       	push   $0x80c020
+  80441d:	e8 48 0d 00 00       	call   80516a <pgbatch_init>
+  804422:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  804425:	be 00 00 00 00       	mov    $0x0,%esi
+  80442a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80442f:	e9 63 ff ff ff       	jmp    804397 <nsipc_sendmsg+0x1d9>
+
+00804434 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  804434:	55                   	push   %ebp
+  804435:	89 e5                	mov    %esp,%ebp
+  804437:	57                   	push   %edi
+  804438:	56                   	push   %esi
+  804439:	53                   	push   %ebx
+  80443a:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80443d:	83 3d 28 c3 80 00 00 	cmpl   $0x0,0x80c328
+  804444:	0f 84 c8 00 00 00    	je     804512 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80444a:	83 3d 24 c3 80 00 00 	cmpl   $0x0,0x80c324
+  804451:	0f 84 e4 00 00 00    	je     80453b <nsipc_sendfile+0x107>
+{
+  804457:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80445c:	89 fb                	mov    %edi,%ebx
+  80445e:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  804461:	0f 83 f0 00 00 00    	jae    804557 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  804467:	89 fa                	mov    %edi,%edx
+  804469:	03 55 10             	add    0x10(%ebp),%edx
+  80446c:	89 d0                	mov    %edx,%eax
+  80446e:	c1 f8 1f             	sar    $0x1f,%eax
+  804471:	c1 e8 14             	shr    $0x14,%eax
+  804474:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  804477:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80447d:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80447f:	6a 10                	push   $0x10
+  804481:	68 00 20 01 e0       	push   $0xe0012000
+  804486:	52                   	push   %edx
+  804487:	ff 75 0c             	push   0xc(%ebp)
+  80448a:	e8 c0 f4 ff ff       	call   80394f <fmap>
+  80448f:	83 c4 10             	add    $0x10,%esp
+  804492:	85 c0                	test   %eax,%eax
+  804494:	0f 8e b8 00 00 00    	jle    804552 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80449a:	39 c6                	cmp    %eax,%esi
+  80449c:	0f 8d b5 00 00 00    	jge    804557 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8044a2:	29 f0                	sub    %esi,%eax
+  8044a4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8044a7:	29 da                	sub    %ebx,%edx
+  8044a9:	39 d0                	cmp    %edx,%eax
+  8044ab:	89 d3                	mov    %edx,%ebx
+  8044ad:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8044b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044b3:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8044b8:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8044be:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8044c4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8044c7:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8044cc:	83 ec 0c             	sub    $0xc,%esp
+  8044cf:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8044d1:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8044d8:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8044db:	83 c0 01             	add    $0x1,%eax
+  8044de:	50                   	push   %eax
+  8044df:	68 00 10 01 e0       	push   $0xe0011000
+  8044e4:	6a 11                	push   $0x11
+  8044e6:	ff 35 24 c3 80 00    	push   0x80c324
+  8044ec:	e8 6c eb ff ff       	call   80305d <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8044f1:	83 c4 1c             	add    $0x1c,%esp
+  8044f4:	6a 00                	push   $0x0
+  8044f6:	6a 00                	push   $0x0
+  8044f8:	6a 00                	push   $0x0
+  8044fa:	e8 9a e8 ff ff       	call   802d99 <ipc_recv>
+  8044ff:	83 c4 10             	add    $0x10,%esp
+  804502:	85 c0                	test   %eax,%eax
+  804504:	78 5b                	js     804561 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  804506:	01 c7                	add    %eax,%edi
+		if (r < n)
+  804508:	39 c3                	cmp    %eax,%ebx
+  80450a:	0f 8e 4c ff ff ff    	jle    80445c <nsipc_sendfile+0x28>
+  804510:	eb 45                	jmp    804557 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  804512:	83 ec 04             	sub    $0x4,%esp
+  804515:	6a 07                	push   $0x7
+  804517:	68 00 10 01 e0       	push   $0xe0011000
+  80451c:	6a 00                	push   $0x0
+  80451e:	e8 af e3 ff ff       	call   8028d2 <sys_page_alloc>
+  804523:	89 c7                	mov    %eax,%edi
+  804525:	83 c4 10             	add    $0x10,%esp
+  804528:	85 c0                	test   %eax,%eax
+  80452a:	78 2b                	js     804557 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80452c:	c7 05 28 c3 80 00 01 	movl   $0x1,0x80c328
+  804533:	00 00 00 
+  804536:	e9 0f ff ff ff       	jmp    80444a <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80453b:	83 ec 0c             	sub    $0xc,%esp
+  80453e:	6a 03                	push   $0x3
+  804540:	e8 4d eb ff ff       	call   803092 <ipc_find_env>
+  804545:	a3 24 c3 80 00       	mov    %eax,0x80c324
+  80454a:	83 c4 10             	add    $0x10,%esp
+  80454d:	e9 05 ff ff ff       	jmp    804457 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  804552:	85 ff                	test   %edi,%edi
+  804554:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  804557:	89 f8                	mov    %edi,%eax
+  804559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80455c:	5b                   	pop    %ebx
+  80455d:	5e                   	pop    %esi
+  80455e:	5f                   	pop    %edi
+  80455f:	5d                   	pop    %ebp
+  804560:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  804561:	85 ff                	test   %edi,%edi
+  804563:	0f 44 f8             	cmove  %eax,%edi
+  804566:	eb ef                	jmp    804557 <nsipc_sendfile+0x123>
+
+00804568 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  804568:	55                   	push   %ebp
+  804569:	89 e5                	mov    %esp,%ebp
+  80456b:	57                   	push   %edi
+  80456c:	56                   	push   %esi
+  80456d:	53                   	push   %ebx
+  80456e:	83 ec 1c             	sub    $0x1c,%esp
+  804571:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  804574:	e8 13 f9 ff ff       	call   803e8c <nsbulk_map>
+  804579:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80457c:	85 c0                	test   %eax,%eax
+  80457e:	0f 88 ba 00 00 00    	js     80463e <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  804584:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804588:	0f 8e bb 00 00 00    	jle    804649 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80458e:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  804593:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  804598:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80459d:	89 f8                	mov    %edi,%eax
+  80459f:	29 f0                	sub    %esi,%eax
+  8045a1:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8045a5:	39 c8                	cmp    %ecx,%eax
+  8045a7:	0f 47 c1             	cmova  %ecx,%eax
+  8045aa:	01 f0                	add    %esi,%eax
+  8045ac:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8045ae:	83 c2 01             	add    $0x1,%edx
+  8045b1:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8045b4:	7e 07                	jle    8045bd <nsipc_recvmsg+0x55>
+  8045b6:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8045bb:	7e e0                	jle    80459d <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8045bd:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8045c3:	c1 fa 0c             	sar    $0xc,%edx
+  8045c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045cb:	e8 0a f9 ff ff       	call   803eda <nsbulk_own>
+  8045d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8045d3:	85 c0                	test   %eax,%eax
+  8045d5:	78 67                	js     80463e <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8045d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045da:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8045df:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8045e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8045e8:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8045ed:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8045f2:	89 f2                	mov    %esi,%edx
+  8045f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8045f9:	e8 44 f9 ff ff       	call   803f42 <nsipc_bulk>
+  8045fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804601:	85 c0                	test   %eax,%eax
+  804603:	78 39                	js     80463e <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  804605:	39 f0                	cmp    %esi,%eax
+  804607:	7f 4a                	jg     804653 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  804609:	bf 00 00 00 00       	mov    $0x0,%edi
+  80460e:	85 c0                	test   %eax,%eax
+  804610:	7e 2c                	jle    80463e <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  804612:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804615:	29 fe                	sub    %edi,%esi
+  804617:	8b 43 04             	mov    0x4(%ebx),%eax
+  80461a:	39 c6                	cmp    %eax,%esi
+  80461c:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80461f:	83 ec 04             	sub    $0x4,%esp
+  804622:	56                   	push   %esi
+  804623:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  804629:	50                   	push   %eax
+  80462a:	ff 33                	push   (%ebx)
+  80462c:	e8 1d e0 ff ff       	call   80264e <memmove>
+		n += m;
+  804631:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  804633:	83 c3 08             	add    $0x8,%ebx
+  804636:	83 c4 10             	add    $0x10,%esp
+  804639:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80463c:	7f d4                	jg     804612 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80463e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804641:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804644:	5b                   	pop    %ebx
+  804645:	5e                   	pop    %esi
+  804646:	5f                   	pop    %edi
+  804647:	5d                   	pop    %ebp
+  804648:	c3                   	ret
+	int r, i, n, len = 0;
+  804649:	be 00 00 00 00       	mov    $0x0,%esi
+  80464e:	e9 6a ff ff ff       	jmp    8045bd <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  804653:	68 58 60 80 00       	push   $0x806058
+  804658:	68 fd 56 80 00       	push   $0x8056fd
+  80465d:	68 3b 01 00 00       	push   $0x13b
+  804662:	68 61 60 80 00       	push   $0x806061
+  804667:	e8 60 d6 ff ff       	call   801ccc <_panic>
+
+0080466c <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80466c:	55                   	push   %ebp
+  80466d:	89 e5                	mov    %esp,%ebp
+  80466f:	57                   	push   %edi
+  804670:	56                   	push   %esi
+  804671:	53                   	push   %ebx
+  804672:	83 ec 0c             	sub    $0xc,%esp
+  804675:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804678:	8b 75 10             	mov    0x10(%ebp),%esi
+  80467b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80467e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804681:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.select.req_readset = *readset;
+  804686:	8b 07                	mov    (%edi),%eax
+  804688:	a3 04 e0 80 00       	mov    %eax,0x80e004
+  80468d:	8b 47 04             	mov    0x4(%edi),%eax
+  804690:	a3 08 e0 80 00       	mov    %eax,0x80e008
+  804695:	8b 47 08             	mov    0x8(%edi),%eax
+  804698:	a3 0c e0 80 00       	mov    %eax,0x80e00c
+  80469d:	8b 47 0c             	mov    0xc(%edi),%eax
+  8046a0:	a3 10 e0 80 00       	mov    %eax,0x80e010
+  8046a5:	8b 47 10             	mov    0x10(%edi),%eax
+  8046a8:	a3 14 e0 80 00       	mov    %eax,0x80e014
+  8046ad:	8b 47 14             	mov    0x14(%edi),%eax
+  8046b0:	a3 18 e0 80 00       	mov    %eax,0x80e018
+  8046b5:	8b 47 18             	mov    0x18(%edi),%eax
+  8046b8:	a3 1c e0 80 00       	mov    %eax,0x80e01c
+  8046bd:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8046c0:	a3 20 e0 80 00       	mov    %eax,0x80e020
+  8046c5:	8b 47 20             	mov    0x20(%edi),%eax
+  8046c8:	a3 24 e0 80 00       	mov    %eax,0x80e024
+  8046cd:	8b 47 24             	mov    0x24(%edi),%eax
+  8046d0:	a3 28 e0 80 00       	mov    %eax,0x80e028
+  8046d5:	8b 47 28             	mov    0x28(%edi),%eax
+  8046d8:	a3 2c e0 80 00       	mov    %eax,0x80e02c
+  8046dd:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8046e0:	a3 30 e0 80 00       	mov    %eax,0x80e030
+  8046e5:	8b 47 30             	mov    0x30(%edi),%eax
+  8046e8:	a3 34 e0 80 00       	mov    %eax,0x80e034
+  8046ed:	8b 47 34             	mov    0x34(%edi),%eax
+  8046f0:	a3 38 e0 80 00       	mov    %eax,0x80e038
+  8046f5:	8b 47 38             	mov    0x38(%edi),%eax
+  8046f8:	a3 3c e0 80 00       	mov    %eax,0x80e03c
+  8046fd:	8b 47 3c             	mov    0x3c(%edi),%eax
+  804700:	a3 40 e0 80 00       	mov    %eax,0x80e040
+	nsipcbuf.select.req_writeset = *writeset;
+  804705:	8b 06                	mov    (%esi),%eax
+  804707:	a3 44 e0 80 00       	mov    %eax,0x80e044
+  80470c:	8b 46 04             	mov    0x4(%esi),%eax
+  80470f:	a3 48 e0 80 00       	mov    %eax,0x80e048
+  804714:	8b 46 08             	mov    0x8(%esi),%eax
+  804717:	a3 4c e0 80 00       	mov    %eax,0x80e04c
+  80471c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80471f:	a3 50 e0 80 00       	mov    %eax,0x80e050
+  804724:	8b 46 10             	mov    0x10(%esi),%eax
+  804727:	a3 54 e0 80 00       	mov    %eax,0x80e054
+  80472c:	8b 46 14             	mov    0x14(%esi),%eax
+  80472f:	a3 58 e0 80 00       	mov    %eax,0x80e058
+  804734:	8b 46 18             	mov    0x18(%esi),%eax
+  804737:	a3 5c e0 80 00       	mov    %eax,0x80e05c
+  80473c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80473f:	a3 60 e0 80 00       	mov    %eax,0x80e060
+  804744:	8b 46 20             	mov    0x20(%esi),%eax
+  804747:	a3 64 e0 80 00       	mov    %eax,0x80e064
+  80474c:	8b 46 24             	mov    0x24(%esi),%eax
+  80474f:	a3 68 e0 80 00       	mov    %eax,0x80e068
+  804754:	8b 46 28             	mov    0x28(%esi),%eax
+  804757:	a3 6c e0 80 00       	mov    %eax,0x80e06c
+  80475c:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80475f:	a3 70 e0 80 00       	mov    %eax,0x80e070
+  804764:	8b 46 30             	mov    0x30(%esi),%eax
+  804767:	a3 74 e0 80 00       	mov    %eax,0x80e074
+  80476c:	8b 46 34             	mov    0x34(%esi),%eax
+  80476f:	a3 78 e0 80 00       	mov    %eax,0x80e078
+  804774:	8b 46 38             	mov    0x38(%esi),%eax
+  804777:	a3 7c e0 80 00       	mov    %eax,0x80e07c
+  80477c:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80477f:	a3 80 e0 80 00       	mov    %eax,0x80e080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  804784:	8b 03                	mov    (%ebx),%eax
+  804786:	a3 84 e0 80 00       	mov    %eax,0x80e084
+  80478b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80478e:	a3 88 e0 80 00       	mov    %eax,0x80e088
+  804793:	8b 43 08             	mov    0x8(%ebx),%eax
+  804796:	a3 8c e0 80 00       	mov    %eax,0x80e08c
+  80479b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80479e:	a3 90 e0 80 00       	mov    %eax,0x80e090
+  8047a3:	8b 43 10             	mov    0x10(%ebx),%eax
+  8047a6:	a3 94 e0 80 00       	mov    %eax,0x80e094
+  8047ab:	8b 43 14             	mov    0x14(%ebx),%eax
+  8047ae:	a3 98 e0 80 00       	mov    %eax,0x80e098
+  8047b3:	8b 43 18             	mov    0x18(%ebx),%eax
+  8047b6:	a3 9c e0 80 00       	mov    %eax,0x80e09c
+  8047bb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8047be:	a3 a0 e0 80 00       	mov    %eax,0x80e0a0
+  8047c3:	8b 43 20             	mov    0x20(%ebx),%eax
+  8047c6:	a3 a4 e0 80 00       	mov    %eax,0x80e0a4
+  8047cb:	8b 43 24             	mov    0x24(%ebx),%eax
+  8047ce:	a3 a8 e0 80 00       	mov    %eax,0x80e0a8
+  8047d3:	8b 43 28             	mov    0x28(%ebx),%eax
+  8047d6:	a3 ac e0 80 00       	mov    %eax,0x80e0ac
+  8047db:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8047de:	a3 b0 e0 80 00       	mov    %eax,0x80e0b0
+  8047e3:	8b 43 30             	mov    0x30(%ebx),%eax
+  8047e6:	a3 b4 e0 80 00       	mov    %eax,0x80e0b4
+  8047eb:	8b 43 34             	mov    0x34(%ebx),%eax
+  8047ee:	a3 b8 e0 80 00       	mov    %eax,0x80e0b8
+  8047f3:	8b 43 38             	mov    0x38(%ebx),%eax
+  8047f6:	a3 bc e0 80 00       	mov    %eax,0x80e0bc
+  8047fb:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8047fe:	a3 c0 e0 80 00       	mov    %eax,0x80e0c0
+	nsipcbuf.select.req_timeout = msec;
+  804803:	8b 45 18             	mov    0x18(%ebp),%eax
+  804806:	a3 c4 e0 80 00       	mov    %eax,0x80e0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80480b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  804810:	e8 2b f6 ff ff       	call   803e40 <nsipc>
+  804815:	85 c0                	test   %eax,%eax
+  804817:	0f 88 ad 01 00 00    	js     8049ca <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80481d:	8b 15 04 e0 80 00    	mov    0x80e004,%edx
+  804823:	89 17                	mov    %edx,(%edi)
+  804825:	8b 15 08 e0 80 00    	mov    0x80e008,%edx
+  80482b:	89 57 04             	mov    %edx,0x4(%edi)
+  80482e:	8b 15 0c e0 80 00    	mov    0x80e00c,%edx
+  804834:	89 57 08             	mov    %edx,0x8(%edi)
+  804837:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  80483d:	89 57 0c             	mov    %edx,0xc(%edi)
+  804840:	8b 15 14 e0 80 00    	mov    0x80e014,%edx
+  804846:	89 57 10             	mov    %edx,0x10(%edi)
+  804849:	8b 15 18 e0 80 00    	mov    0x80e018,%edx
+  80484f:	89 57 14             	mov    %edx,0x14(%edi)
+  804852:	8b 15 1c e0 80 00    	mov    0x80e01c,%edx
+  804858:	89 57 18             	mov    %edx,0x18(%edi)
+  80485b:	8b 15 20 e0 80 00    	mov    0x80e020,%edx
+  804861:	89 57 1c             	mov    %edx,0x1c(%edi)
+  804864:	8b 15 24 e0 80 00    	mov    0x80e024,%edx
+  80486a:	89 57 20             	mov    %edx,0x20(%edi)
+  80486d:	8b 15 28 e0 80 00    	mov    0x80e028,%edx
+  804873:	89 57 24             	mov    %edx,0x24(%edi)
+  804876:	8b 15 2c e0 80 00    	mov    0x80e02c,%edx
+  80487c:	89 57 28             	mov    %edx,0x28(%edi)
+  80487f:	8b 15 30 e0 80 00    	mov    0x80e030,%edx
+  804885:	89 57 2c             	mov    %edx,0x2c(%edi)
+  804888:	8b 15 34 e0 80 00    	mov    0x80e034,%edx
+  80488e:	89 57 30             	mov    %edx,0x30(%edi)
+  804891:	8b 15 38 e0 80 00    	mov    0x80e038,%edx
+  804897:	89 57 34             	mov    %edx,0x34(%edi)
+  80489a:	8b 15 3c e0 80 00    	mov    0x80e03c,%edx
+  8048a0:	89 57 38             	mov    %edx,0x38(%edi)
+  8048a3:	8b 15 40 e0 80 00    	mov    0x80e040,%edx
+  8048a9:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8048ac:	8b 15 44 e0 80 00    	mov    0x80e044,%edx
+  8048b2:	89 16                	mov    %edx,(%esi)
+  8048b4:	8b 15 48 e0 80 00    	mov    0x80e048,%edx
+  8048ba:	89 56 04             	mov    %edx,0x4(%esi)
+  8048bd:	8b 15 4c e0 80 00    	mov    0x80e04c,%edx
+  8048c3:	89 56 08             	mov    %edx,0x8(%esi)
+  8048c6:	8b 15 50 e0 80 00    	mov    0x80e050,%edx
+  8048cc:	89 56 0c             	mov    %edx,0xc(%esi)
+  8048cf:	8b 15 54 e0 80 00    	mov    0x80e054,%edx
+  8048d5:	89 56 10             	mov    %edx,0x10(%esi)
+  8048d8:	8b 15 58 e0 80 00    	mov    0x80e058,%edx
+  8048de:	89 56 14             	mov    %edx,0x14(%esi)
+  8048e1:	8b 15 5c e0 80 00    	mov    0x80e05c,%edx
+  8048e7:	89 56 18             	mov    %edx,0x18(%esi)
+  8048ea:	8b 15 60 e0 80 00    	mov    0x80e060,%edx
+  8048f0:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8048f3:	8b 15 64 e0 80 00    	mov    0x80e064,%edx
+  8048f9:	89 56 20             	mov    %edx,0x20(%esi)
+  8048fc:	8b 15 68 e0 80 00    	mov    0x80e068,%edx
+  804902:	89 56 24             	mov    %edx,0x24(%esi)
+  804905:	8b 15 6c e0 80 00    	mov    0x80e06c,%edx
+  80490b:	89 56 28             	mov    %edx,0x28(%esi)
+  80490e:	8b 15 70 e0 80 00    	mov    0x80e070,%edx
+  804914:	89 56 2c             	mov    %edx,0x2c(%esi)
+  804917:	8b 15 74 e0 80 00    	mov    0x80e074,%edx
+  80491d:	89 56 30             	mov    %edx,0x30(%esi)
+  804920:	8b 15 78 e0 80 00    	mov    0x80e078,%edx
+  804926:	89 56 34             	mov    %edx,0x34(%esi)
+  804929:	8b 15 7c e0 80 00    	mov    0x80e07c,%edx
+  80492f:	89 56 38             	mov    %edx,0x38(%esi)
+  804932:	8b 15 80 e0 80 00    	mov    0x80e080,%edx
+  804938:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80493b:	8b 15 84 e0 80 00    	mov    0x80e084,%edx
+  804941:	89 13                	mov    %edx,(%ebx)
+  804943:	8b 15 88 e0 80 00    	mov    0x80e088,%edx
+  804949:	89 53 04             	mov    %edx,0x4(%ebx)
+  80494c:	8b 15 8c e0 80 00    	mov    0x80e08c,%edx
+  804952:	89 53 08             	mov    %edx,0x8(%ebx)
+  804955:	8b 15 90 e0 80 00    	mov    0x80e090,%edx
+  80495b:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80495e:	8b 15 94 e0 80 00    	mov    0x80e094,%edx
+  804964:	89 53 10             	mov    %edx,0x10(%ebx)
+  804967:	8b 15 98 e0 80 00    	mov    0x80e098,%edx
+  80496d:	89 53 14             	mov    %edx,0x14(%ebx)
+  804970:	8b 15 9c e0 80 00    	mov    0x80e09c,%edx
+  804976:	89 53 18             	mov    %edx,0x18(%ebx)
+  804979:	8b 15 a0 e0 80 00    	mov    0x80e0a0,%edx
+  80497f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  804982:	8b 15 a4 e0 80 00    	mov    0x80e0a4,%edx
+  804988:	89 53 20             	mov    %edx,0x20(%ebx)
+  80498b:	8b 15 a8 e0 80 00    	mov    0x80e0a8,%edx
+  804991:	89 53 24             	mov    %edx,0x24(%ebx)
+  804994:	8b 15 ac e0 80 00    	mov    0x80e0ac,%edx
+  80499a:	89 53 28             	mov    %edx,0x28(%ebx)
+  80499d:	8b 15 b0 e0 80 00    	mov    0x80e0b0,%edx
+  8049a3:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8049a6:	8b 15 b4 e0 80 00    	mov    0x80e0b4,%edx
+  8049ac:	89 53 30             	mov    %edx,0x30(%ebx)
+  8049af:	8b 15 b8 e0 80 00    	mov    0x80e0b8,%edx
+  8049b5:	89 53 34             	mov    %edx,0x34(%ebx)
+  8049b8:	8b 15 bc e0 80 00    	mov    0x80e0bc,%edx
+  8049be:	89 53 38             	mov    %edx,0x38(%ebx)
+  8049c1:	8b 15 c0 e0 80 00    	mov    0x80e0c0,%edx
+  8049c7:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8049ca:	83 c4 0c             	add    $0xc,%esp
+  8049cd:	5b                   	pop    %ebx
+  8049ce:	5e                   	pop    %esi
+  8049cf:	5f                   	pop    %edi
+  8049d0:	5d                   	pop    %ebp
+  8049d1:	c3                   	ret
+
+008049d2 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8049d2:	55                   	push   %ebp
+  8049d3:	89 e5                	mov    %esp,%ebp
+  8049d5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8049d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8049db:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.evctl.req_events = events;
+  8049e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8049e3:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.evctl.req_data = data;
+  8049e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8049eb:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_EVCTL);
+  8049f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8049f5:	e8 46 f4 ff ff       	call   803e40 <nsipc>
+}
+  8049fa:	c9                   	leave
+  8049fb:	c3                   	ret
+
+008049fc <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8049fc:	55                   	push   %ebp
+  8049fd:	89 e5                	mov    %esp,%ebp
+  8049ff:	56                   	push   %esi
+  804a00:	53                   	push   %ebx
+  804a01:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  804a04:	89 35 00 e0 80 00    	mov    %esi,0x80e000
+	nsipcbuf.evwait.req_timeout = timeout;
+  804a0a:	8b 45 10             	mov    0x10(%ebp),%eax
+  804a0d:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  804a12:	b8 10 00 00 00       	mov    $0x10,%eax
+  804a17:	e8 24 f4 ff ff       	call   803e40 <nsipc>
+  804a1c:	89 c3                	mov    %eax,%ebx
+  804a1e:	85 c0                	test   %eax,%eax
+  804a20:	7e 1f                	jle    804a41 <nsipc_evwait+0x45>
+		assert(r <= max);
+  804a22:	39 c6                	cmp    %eax,%esi
+  804a24:	7c 24                	jl     804a4a <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  804a26:	83 ec 04             	sub    $0x4,%esp
+  804a29:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  804a30:	50                   	push   %eax
+  804a31:	68 00 e0 80 00       	push   $0x80e000
+  804a36:	ff 75 08             	push   0x8(%ebp)
+  804a39:	e8 10 dc ff ff       	call   80264e <memmove>
+  804a3e:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  804a41:	89 d8                	mov    %ebx,%eax
+  804a43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804a46:	5b                   	pop    %ebx
+  804a47:	5e                   	pop    %esi
+  804a48:	5d                   	pop    %ebp
+  804a49:	c3                   	ret
+		assert(r <= max);
+  804a4a:	68 79 60 80 00       	push   $0x806079
+  804a4f:	68 fd 56 80 00       	push   $0x8056fd
+  804a54:	68 6a 01 00 00       	push   $0x16a
+  804a59:	68 61 60 80 00       	push   $0x806061
+  804a5e:	e8 69 d2 ff ff       	call   801ccc <_panic>
+
+00804a63 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804a63:	55                   	push   %ebp
+  804a64:	89 e5                	mov    %esp,%ebp
+  804a66:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  804a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a6c:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.socket.req_type = type;
+  804a71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804a74:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.socket.req_protocol = protocol;
+  804a79:	8b 45 10             	mov    0x10(%ebp),%eax
+  804a7c:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SOCKET);
+  804a81:	b8 09 00 00 00       	mov    $0x9,%eax
+  804a86:	e8 b5 f3 ff ff       	call   803e40 <nsipc>
+}
+  804a8b:	c9                   	leave
+  804a8c:	c3                   	ret
+
+00804a8d <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  804a8d:	55                   	push   %ebp
+  804a8e:	89 e5                	mov    %esp,%ebp
+  804a90:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  804a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a96:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_OFFLOAD);
+  804a9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  804aa0:	e8 9b f3 ff ff       	call   803e40 <nsipc>
+}
+  804aa5:	c9                   	leave
+  804aa6:	c3                   	ret
+
+00804aa7 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  804aa7:	55                   	push   %ebp
+  804aa8:	89 e5                	mov    %esp,%ebp
+  804aaa:	53                   	push   %ebx
+  804aab:	83 ec 04             	sub    $0x4,%esp
+  804aae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  804ab1:	b8 12 00 00 00       	mov    $0x12,%eax
+  804ab6:	e8 85 f3 ff ff       	call   803e40 <nsipc>
+  804abb:	85 c0                	test   %eax,%eax
+  804abd:	78 50                	js     804b0f <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  804abf:	8b 15 00 e0 80 00    	mov    0x80e000,%edx
+  804ac5:	89 13                	mov    %edx,(%ebx)
+  804ac7:	8b 15 04 e0 80 00    	mov    0x80e004,%edx
+  804acd:	89 53 04             	mov    %edx,0x4(%ebx)
+  804ad0:	8b 15 08 e0 80 00    	mov    0x80e008,%edx
+  804ad6:	89 53 08             	mov    %edx,0x8(%ebx)
+  804ad9:	8b 15 0c e0 80 00    	mov    0x80e00c,%edx
+  804adf:	89 53 0c             	mov    %edx,0xc(%ebx)
+  804ae2:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  804ae8:	89 53 10             	mov    %edx,0x10(%ebx)
+  804aeb:	8b 15 14 e0 80 00    	mov    0x80e014,%edx
+  804af1:	89 53 14             	mov    %edx,0x14(%ebx)
+  804af4:	8b 15 18 e0 80 00    	mov    0x80e018,%edx
+  804afa:	89 53 18             	mov    %edx,0x18(%ebx)
+  804afd:	8b 15 1c e0 80 00    	mov    0x80e01c,%edx
+  804b03:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  804b06:	8b 15 20 e0 80 00    	mov    0x80e020,%edx
+  804b0c:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  804b0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804b12:	c9                   	leave
+  804b13:	c3                   	ret
+
+00804b14 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  804b14:	55                   	push   %ebp
+  804b15:	89 e5                	mov    %esp,%ebp
+  804b17:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  804b1a:	6a 03                	push   $0x3
+  804b1c:	e8 71 e5 ff ff       	call   803092 <ipc_find_env>
+  804b21:	a3 24 c3 80 00       	mov    %eax,0x80c324
+	nsipcbuf.shard.req_shard = shard;
+  804b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b29:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  804b2e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  804b33:	e8 08 f3 ff ff       	call   803e40 <nsipc>
+  804b38:	83 c4 10             	add    $0x10,%esp
+  804b3b:	85 c0                	test   %eax,%eax
+  804b3d:	78 0a                	js     804b49 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  804b3f:	a3 24 c3 80 00       	mov    %eax,0x80c324
+	return 0;
+  804b44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b49:	c9                   	leave
+  804b4a:	c3                   	ret
+
+00804b4b <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804b4b:	55                   	push   %ebp
+  804b4c:	89 e5                	mov    %esp,%ebp
+  804b4e:	57                   	push   %edi
+  804b4f:	56                   	push   %esi
+  804b50:	53                   	push   %ebx
+  804b51:	83 ec 1c             	sub    $0x1c,%esp
+  804b54:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  804b57:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  804b5a:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  804b5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804b64:	89 e0                	mov    %esp,%eax
+  804b66:	89 f2                	mov    %esi,%edx
+  804b68:	29 c2                	sub    %eax,%edx
+  804b6a:	89 d0                	mov    %edx,%eax
+  804b6c:	c1 e8 0f             	shr    $0xf,%eax
+  804b6f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  804b75:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804b78:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  804b7f:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  804b82:	83 ec 0c             	sub    $0xc,%esp
+  804b85:	ff 75 e0             	push   -0x20(%ebp)
+  804b88:	e8 b6 ee ff ff       	call   803a43 <pageref>
+  804b8d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804b90:	83 c4 04             	add    $0x4,%esp
+  804b93:	ff 75 dc             	push   -0x24(%ebp)
+  804b96:	e8 a8 ee ff ff       	call   803a43 <pageref>
+  804b9b:	89 e2                	mov    %esp,%edx
+  804b9d:	89 f1                	mov    %esi,%ecx
+  804b9f:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  804ba1:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  804ba4:	89 ca                	mov    %ecx,%edx
+  804ba6:	c1 ea 0f             	shr    $0xf,%edx
+  804ba9:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  804baf:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  804bb2:	8b 14 95 40 c3 80 00 	mov    0x80c340(,%edx,4),%edx
+  804bb9:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  804bbc:	39 d7                	cmp    %edx,%edi
+  804bbe:	74 40                	je     804c00 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  804bc0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804bc3:	75 9f                	jne    804b64 <_pipeisclosed+0x19>
+  804bc5:	89 e2                	mov    %esp,%edx
+  804bc7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804bcc:	29 d0                	sub    %edx,%eax
+  804bce:	89 c2                	mov    %eax,%edx
+  804bd0:	c1 ea 0f             	shr    $0xf,%edx
+  804bd3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bdd:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804be0:	8b 04 85 40 c3 80 00 	mov    0x80c340(,%eax,4),%eax
+  804be7:	8b 40 58             	mov    0x58(%eax),%eax
+  804bea:	6a 01                	push   $0x1
+  804bec:	50                   	push   %eax
+  804bed:	57                   	push   %edi
+  804bee:	68 82 60 80 00       	push   $0x806082
+  804bf3:	e8 af d1 ff ff       	call   801da7 <cprintf>
+  804bf8:	83 c4 10             	add    $0x10,%esp
+  804bfb:	e9 5f ff ff ff       	jmp    804b5f <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  804c00:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804c03:	0f 94 c0             	sete   %al
+  804c06:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  804c09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c0c:	5b                   	pop    %ebx
+  804c0d:	5e                   	pop    %esi
+  804c0e:	5f                   	pop    %edi
+  804c0f:	5d                   	pop    %ebp
+  804c10:	c3                   	ret
+
+00804c11 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  804c11:	55                   	push   %ebp
+  804c12:	89 e5                	mov    %esp,%ebp
+  804c14:	53                   	push   %ebx
+  804c15:	83 ec 0c             	sub    $0xc,%esp
+  804c18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  804c1b:	53                   	push   %ebx
+  804c1c:	6a 00                	push   $0x0
+  804c1e:	e8 34 dd ff ff       	call   802957 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  804c23:	89 1c 24             	mov    %ebx,(%esp)
+  804c26:	e8 b6 e4 ff ff       	call   8030e1 <fd2data>
+  804c2b:	83 c4 08             	add    $0x8,%esp
+  804c2e:	50                   	push   %eax
+  804c2f:	6a 00                	push   $0x0
+  804c31:	e8 21 dd ff ff       	call   802957 <sys_page_unmap>
+}
+  804c36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804c39:	c9                   	leave
+  804c3a:	c3                   	ret
+
+00804c3b <devpipe_read>:
+{
+  804c3b:	55                   	push   %ebp
+  804c3c:	89 e5                	mov    %esp,%ebp
+  804c3e:	57                   	push   %edi
+  804c3f:	56                   	push   %esi
+  804c40:	53                   	push   %ebx
+  804c41:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  804c44:	ff 75 08             	push   0x8(%ebp)
+  804c47:	e8 95 e4 ff ff       	call   8030e1 <fd2data>
+  804c4c:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  804c4e:	8b 70 04             	mov    0x4(%eax),%esi
+  804c51:	8b 00                	mov    (%eax),%eax
+  804c53:	83 c4 10             	add    $0x10,%esp
+  804c56:	39 f0                	cmp    %esi,%eax
+  804c58:	75 36                	jne    804c90 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  804c5a:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  804c5d:	89 da                	mov    %ebx,%edx
+  804c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804c62:	e8 e4 fe ff ff       	call   804b4b <_pipeisclosed>
+  804c67:	85 c0                	test   %eax,%eax
+  804c69:	0f 85 d4 00 00 00    	jne    804d43 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  804c6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804c74:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  804c78:	83 ec 04             	sub    $0x4,%esp
+  804c7b:	6a ff                	push   $0xffffffff
+  804c7d:	56                   	push   %esi
+  804c7e:	57                   	push   %edi
+  804c7f:	e8 4c e0 ff ff       	call   802cd0 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  804c84:	8b 73 04             	mov    0x4(%ebx),%esi
+  804c87:	8b 03                	mov    (%ebx),%eax
+  804c89:	83 c4 10             	add    $0x10,%esp
+  804c8c:	39 c6                	cmp    %eax,%esi
+  804c8e:	74 cd                	je     804c5d <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804c90:	8b 73 04             	mov    0x4(%ebx),%esi
+  804c93:	8b 03                	mov    (%ebx),%eax
+  804c95:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804c9b:	29 c6                	sub    %eax,%esi
+  804c9d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804ca2:	f7 e6                	mul    %esi
+  804ca4:	c1 ea 0c             	shr    $0xc,%edx
+  804ca7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804cad:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  804caf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804cb2:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  804cb6:	8b 0b                	mov    (%ebx),%ecx
+  804cb8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804cbd:	f7 e1                	mul    %ecx
+  804cbf:	c1 ea 0b             	shr    $0xb,%edx
+  804cc2:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  804cc8:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  804cca:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  804ccf:	29 cf                	sub    %ecx,%edi
+  804cd1:	39 f7                	cmp    %esi,%edi
+  804cd3:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  804cd6:	83 ec 04             	sub    $0x4,%esp
+  804cd9:	57                   	push   %edi
+  804cda:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  804cde:	50                   	push   %eax
+  804cdf:	ff 75 0c             	push   0xc(%ebp)
+  804ce2:	e8 67 d9 ff ff       	call   80264e <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  804ce7:	83 c4 0c             	add    $0xc,%esp
+  804cea:	89 f0                	mov    %esi,%eax
+  804cec:	29 f8                	sub    %edi,%eax
+  804cee:	50                   	push   %eax
+  804cef:	8d 43 10             	lea    0x10(%ebx),%eax
+  804cf2:	50                   	push   %eax
+  804cf3:	89 f8                	mov    %edi,%eax
+  804cf5:	03 45 0c             	add    0xc(%ebp),%eax
+  804cf8:	50                   	push   %eax
+  804cf9:	e8 50 d9 ff ff       	call   80264e <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  804cfe:	8b 0b                	mov    (%ebx),%ecx
+  804d00:	01 f1                	add    %esi,%ecx
+  804d02:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804d07:	f7 e1                	mul    %ecx
+  804d09:	c1 ea 0c             	shr    $0xc,%edx
+  804d0c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  804d12:	29 c1                	sub    %eax,%ecx
+  804d14:	89 0b                	mov    %ecx,(%ebx)
+  804d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d1b:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  804d1f:	83 c4 10             	add    $0x10,%esp
+  804d22:	85 c0                	test   %eax,%eax
+  804d24:	75 0a                	jne    804d30 <devpipe_read+0xf5>
+	return n;
+  804d26:	89 f0                	mov    %esi,%eax
+}
+  804d28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d2b:	5b                   	pop    %ebx
+  804d2c:	5e                   	pop    %esi
+  804d2d:	5f                   	pop    %edi
+  804d2e:	5d                   	pop    %ebp
+  804d2f:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  804d30:	83 ec 08             	sub    $0x8,%esp
+  804d33:	68 00 04 00 00       	push   $0x400
+  804d38:	53                   	push   %ebx
+  804d39:	e8 b4 df ff ff       	call   802cf2 <sys_futex_wake>
+  804d3e:	83 c4 10             	add    $0x10,%esp
+  804d41:	eb e3                	jmp    804d26 <devpipe_read+0xeb>
+			return 0;
+  804d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d48:	eb de                	jmp    804d28 <devpipe_read+0xed>
+
+00804d4a <devpipe_write>:
+{
+  804d4a:	55                   	push   %ebp
+  804d4b:	89 e5                	mov    %esp,%ebp
+  804d4d:	57                   	push   %edi
+  804d4e:	56                   	push   %esi
+  804d4f:	53                   	push   %ebx
+  804d50:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  804d53:	ff 75 08             	push   0x8(%ebp)
+  804d56:	e8 86 e3 ff ff       	call   8030e1 <fd2data>
+  804d5b:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  804d5d:	83 c4 10             	add    $0x10,%esp
+  804d60:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804d67:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  804d6c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804d70:	0f 84 43 01 00 00    	je     804eb9 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804d76:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804d79:	8b 06                	mov    (%esi),%eax
+  804d7b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804d81:	29 c1                	sub    %eax,%ecx
+  804d83:	89 c8                	mov    %ecx,%eax
+  804d85:	f7 e7                	mul    %edi
+  804d87:	c1 ea 0c             	shr    $0xc,%edx
+  804d8a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804d90:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  804d92:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804d98:	75 52                	jne    804dec <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  804d9a:	89 f2                	mov    %esi,%edx
+  804d9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d9f:	e8 a7 fd ff ff       	call   804b4b <_pipeisclosed>
+  804da4:	85 c0                	test   %eax,%eax
+  804da6:	0f 85 28 01 00 00    	jne    804ed4 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  804dac:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804dae:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804db1:	8b 06                	mov    (%esi),%eax
+  804db3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804db9:	29 c1                	sub    %eax,%ecx
+  804dbb:	89 c8                	mov    %ecx,%eax
+  804dbd:	f7 e7                	mul    %edi
+  804dbf:	c1 ea 0c             	shr    $0xc,%edx
+  804dc2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804dc8:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  804dca:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804dd0:	75 a4                	jne    804d76 <devpipe_write+0x2c>
+  804dd2:	b8 01 00 00 00       	mov    $0x1,%eax
+  804dd7:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  804ddb:	83 ec 04             	sub    $0x4,%esp
+  804dde:	6a ff                	push   $0xffffffff
+  804de0:	53                   	push   %ebx
+  804de1:	56                   	push   %esi
+  804de2:	e8 e9 de ff ff       	call   802cd0 <sys_futex_wait>
+}
+  804de7:	83 c4 10             	add    $0x10,%esp
+  804dea:	eb 8a                	jmp    804d76 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804dec:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804def:	8b 06                	mov    (%esi),%eax
+  804df1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804df7:	29 c1                	sub    %eax,%ecx
+  804df9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804dfe:	f7 e1                	mul    %ecx
+  804e00:	c1 ea 0c             	shr    $0xc,%edx
+  804e03:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804e09:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  804e0b:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  804e10:	89 d8                	mov    %ebx,%eax
+  804e12:	29 c8                	sub    %ecx,%eax
+  804e14:	8b 55 10             	mov    0x10(%ebp),%edx
+  804e17:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804e1a:	29 ca                	sub    %ecx,%edx
+  804e1c:	39 d0                	cmp    %edx,%eax
+  804e1e:	0f 46 d0             	cmovbe %eax,%edx
+  804e21:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  804e24:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804e27:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804e2c:	f7 e1                	mul    %ecx
+  804e2e:	c1 ea 0b             	shr    $0xb,%edx
+  804e31:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  804e37:	89 ca                	mov    %ecx,%edx
+  804e39:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  804e3b:	29 d3                	sub    %edx,%ebx
+  804e3d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804e40:	39 c3                	cmp    %eax,%ebx
+  804e42:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  804e45:	83 ec 04             	sub    $0x4,%esp
+  804e48:	53                   	push   %ebx
+  804e49:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804e4c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  804e4f:	51                   	push   %ecx
+  804e50:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  804e54:	50                   	push   %eax
+  804e55:	e8 f4 d7 ff ff       	call   80264e <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  804e5a:	83 c4 0c             	add    $0xc,%esp
+  804e5d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804e60:	29 d8                	sub    %ebx,%eax
+  804e62:	50                   	push   %eax
+  804e63:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804e66:	01 cb                	add    %ecx,%ebx
+  804e68:	03 5d 0c             	add    0xc(%ebp),%ebx
+  804e6b:	53                   	push   %ebx
+  804e6c:	8d 46 10             	lea    0x10(%esi),%eax
+  804e6f:	50                   	push   %eax
+  804e70:	e8 d9 d7 ff ff       	call   80264e <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  804e75:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804e78:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804e7b:	01 c1                	add    %eax,%ecx
+  804e7d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804e82:	f7 e1                	mul    %ecx
+  804e84:	c1 ea 0c             	shr    $0xc,%edx
+  804e87:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  804e8d:	89 ca                	mov    %ecx,%edx
+  804e8f:	29 c2                	sub    %eax,%edx
+  804e91:	89 56 04             	mov    %edx,0x4(%esi)
+  804e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e99:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  804e9d:	83 c4 10             	add    $0x10,%esp
+  804ea0:	85 c0                	test   %eax,%eax
+  804ea2:	75 1a                	jne    804ebe <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  804ea4:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804ea7:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  804eaa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804ead:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804eb0:	0f 82 c0 fe ff ff    	jb     804d76 <devpipe_write+0x2c>
+  804eb6:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  804eb9:	8b 45 10             	mov    0x10(%ebp),%eax
+  804ebc:	eb 1b                	jmp    804ed9 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  804ebe:	83 ec 08             	sub    $0x8,%esp
+  804ec1:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  804ec6:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  804ec9:	50                   	push   %eax
+  804eca:	e8 23 de ff ff       	call   802cf2 <sys_futex_wake>
+  804ecf:	83 c4 10             	add    $0x10,%esp
+  804ed2:	eb d0                	jmp    804ea4 <devpipe_write+0x15a>
+				return 0;
+  804ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804edc:	5b                   	pop    %ebx
+  804edd:	5e                   	pop    %esi
+  804ede:	5f                   	pop    %edi
+  804edf:	5d                   	pop    %ebp
+  804ee0:	c3                   	ret
+
+00804ee1 <devpipe_stat>:
+{
+  804ee1:	55                   	push   %ebp
+  804ee2:	89 e5                	mov    %esp,%ebp
+  804ee4:	56                   	push   %esi
+  804ee5:	53                   	push   %ebx
+  804ee6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804ee9:	83 ec 0c             	sub    $0xc,%esp
+  804eec:	ff 75 08             	push   0x8(%ebp)
+  804eef:	e8 ed e1 ff ff       	call   8030e1 <fd2data>
+  804ef4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  804ef6:	83 c4 08             	add    $0x8,%esp
+  804ef9:	68 95 60 80 00       	push   $0x806095
+  804efe:	53                   	push   %ebx
+  804eff:	e8 9a d5 ff ff       	call   80249e <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804f04:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804f07:	8b 06                	mov    (%esi),%eax
+  804f09:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804f0f:	29 c1                	sub    %eax,%ecx
+  804f11:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804f16:	89 c8                	mov    %ecx,%eax
+  804f18:	f7 e2                	mul    %edx
+  804f1a:	c1 ea 0c             	shr    $0xc,%edx
+  804f1d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804f23:	29 d1                	sub    %edx,%ecx
+  804f25:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  804f2b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804f32:	00 00 00 
+	stat->st_dev = &devpipe;
+  804f35:	c7 83 8c 00 00 00 c0 	movl   $0x80b0c0,0x8c(%ebx)
+  804f3c:	b0 80 00 
+}
+  804f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804f47:	5b                   	pop    %ebx
+  804f48:	5e                   	pop    %esi
+  804f49:	5d                   	pop    %ebp
+  804f4a:	c3                   	ret
+
+00804f4b <devpipe_poll>:
+{
+  804f4b:	55                   	push   %ebp
+  804f4c:	89 e5                	mov    %esp,%ebp
+  804f4e:	57                   	push   %edi
+  804f4f:	56                   	push   %esi
+  804f50:	53                   	push   %ebx
+  804f51:	83 ec 18             	sub    $0x18,%esp
+  804f54:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804f57:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804f5a:	57                   	push   %edi
+  804f5b:	e8 81 e1 ff ff       	call   8030e1 <fd2data>
+  804f60:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  804f62:	83 c4 10             	add    $0x10,%esp
+  804f65:	89 f3                	mov    %esi,%ebx
+  804f67:	83 e3 01             	and    $0x1,%ebx
+  804f6a:	75 27                	jne    804f93 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  804f6c:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  804f72:	75 48                	jne    804fbc <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  804f74:	89 ca                	mov    %ecx,%edx
+  804f76:	89 f8                	mov    %edi,%eax
+  804f78:	e8 ce fb ff ff       	call   804b4b <_pipeisclosed>
+  804f7d:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  804f7f:	89 d8                	mov    %ebx,%eax
+  804f81:	83 c8 10             	or     $0x10,%eax
+  804f84:	85 d2                	test   %edx,%edx
+  804f86:	0f 45 d8             	cmovne %eax,%ebx
+}
+  804f89:	89 d8                	mov    %ebx,%eax
+  804f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f8e:	5b                   	pop    %ebx
+  804f8f:	5e                   	pop    %esi
+  804f90:	5f                   	pop    %edi
+  804f91:	5d                   	pop    %ebp
+  804f92:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804f93:	8b 58 04             	mov    0x4(%eax),%ebx
+  804f96:	8b 00                	mov    (%eax),%eax
+  804f98:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  804f9e:	29 c3                	sub    %eax,%ebx
+  804fa0:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804fa5:	89 d8                	mov    %ebx,%eax
+  804fa7:	f7 e2                	mul    %edx
+  804fa9:	c1 ea 0c             	shr    $0xc,%edx
+  804fac:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  804fb2:	39 d3                	cmp    %edx,%ebx
+  804fb4:	0f 95 c3             	setne  %bl
+  804fb7:	0f b6 db             	movzbl %bl,%ebx
+  804fba:	eb b0                	jmp    804f6c <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804fbc:	8b 71 04             	mov    0x4(%ecx),%esi
+  804fbf:	8b 01                	mov    (%ecx),%eax
+  804fc1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804fc7:	29 c6                	sub    %eax,%esi
+  804fc9:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804fce:	89 f0                	mov    %esi,%eax
+  804fd0:	f7 e2                	mul    %edx
+  804fd2:	c1 ea 0c             	shr    $0xc,%edx
+  804fd5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804fdb:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  804fdd:	89 d8                	mov    %ebx,%eax
+  804fdf:	83 c8 04             	or     $0x4,%eax
+  804fe2:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  804fe8:	0f 42 d8             	cmovb  %eax,%ebx
+  804feb:	eb 87                	jmp    804f74 <devpipe_poll+0x29>
+
+00804fed <pipe>:
+{
+  804fed:	55                   	push   %ebp
+  804fee:	89 e5                	mov    %esp,%ebp
+  804ff0:	56                   	push   %esi
+  804ff1:	53                   	push   %ebx
+  804ff2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804ff5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ff8:	50                   	push   %eax
+  804ff9:	e8 fa e0 ff ff       	call   8030f8 <fd_alloc>
+  804ffe:	89 c3                	mov    %eax,%ebx
+  805000:	83 c4 10             	add    $0x10,%esp
+  805003:	85 c0                	test   %eax,%eax
+  805005:	0f 88 23 01 00 00    	js     80512e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80500b:	83 ec 04             	sub    $0x4,%esp
+  80500e:	68 07 04 00 00       	push   $0x407
+  805013:	ff 75 f4             	push   -0xc(%ebp)
+  805016:	6a 00                	push   $0x0
+  805018:	e8 b5 d8 ff ff       	call   8028d2 <sys_page_alloc>
+  80501d:	89 c3                	mov    %eax,%ebx
+  80501f:	83 c4 10             	add    $0x10,%esp
+  805022:	85 c0                	test   %eax,%eax
+  805024:	0f 88 04 01 00 00    	js     80512e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80502a:	83 ec 0c             	sub    $0xc,%esp
+  80502d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  805030:	50                   	push   %eax
+  805031:	e8 c2 e0 ff ff       	call   8030f8 <fd_alloc>
+  805036:	89 c3                	mov    %eax,%ebx
+  805038:	83 c4 10             	add    $0x10,%esp
+  80503b:	85 c0                	test   %eax,%eax
+  80503d:	0f 88 db 00 00 00    	js     80511e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805043:	83 ec 04             	sub    $0x4,%esp
+  805046:	68 07 04 00 00       	push   $0x407
+  80504b:	ff 75 f0             	push   -0x10(%ebp)
+  80504e:	6a 00                	push   $0x0
+  805050:	e8 7d d8 ff ff       	call   8028d2 <sys_page_alloc>
+  805055:	89 c3                	mov    %eax,%ebx
+  805057:	83 c4 10             	add    $0x10,%esp
+  80505a:	85 c0                	test   %eax,%eax
+  80505c:	0f 88 bc 00 00 00    	js     80511e <pipe+0x131>
+	va = fd2data(fd0);
+  805062:	83 ec 0c             	sub    $0xc,%esp
+  805065:	ff 75 f4             	push   -0xc(%ebp)
+  805068:	e8 74 e0 ff ff       	call   8030e1 <fd2data>
+  80506d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80506f:	83 c4 0c             	add    $0xc,%esp
+  805072:	68 07 04 00 00       	push   $0x407
+  805077:	50                   	push   %eax
+  805078:	6a 00                	push   $0x0
+  80507a:	e8 53 d8 ff ff       	call   8028d2 <sys_page_alloc>
+  80507f:	89 c3                	mov    %eax,%ebx
+  805081:	83 c4 10             	add    $0x10,%esp
+  805084:	85 c0                	test   %eax,%eax
+  805086:	0f 88 82 00 00 00    	js     80510e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80508c:	83 ec 0c             	sub    $0xc,%esp
+  80508f:	ff 75 f0             	push   -0x10(%ebp)
+  805092:	e8 4a e0 ff ff       	call   8030e1 <fd2data>
+  805097:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80509e:	50                   	push   %eax
+  80509f:	6a 00                	push   $0x0
+  8050a1:	56                   	push   %esi
+  8050a2:	6a 00                	push   $0x0
+  8050a4:	e8 6c d8 ff ff       	call   802915 <sys_page_map>
+  8050a9:	89 c3                	mov    %eax,%ebx
+  8050ab:	83 c4 20             	add    $0x20,%esp
+  8050ae:	85 c0                	test   %eax,%eax
+  8050b0:	78 4e                	js     805100 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8050b2:	a1 c0 b0 80 00       	mov    0x80b0c0,%eax
+  8050b7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8050ba:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8050bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8050bf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8050c6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8050c9:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8050cb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8050ce:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8050d5:	83 ec 0c             	sub    $0xc,%esp
+  8050d8:	ff 75 f4             	push   -0xc(%ebp)
+  8050db:	e8 f1 df ff ff       	call   8030d1 <fd2num>
+  8050e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8050e3:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8050e5:	83 c4 04             	add    $0x4,%esp
+  8050e8:	ff 75 f0             	push   -0x10(%ebp)
+  8050eb:	e8 e1 df ff ff       	call   8030d1 <fd2num>
+  8050f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8050f3:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8050f6:	83 c4 10             	add    $0x10,%esp
+  8050f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8050fe:	eb 2e                	jmp    80512e <pipe+0x141>
+	sys_page_unmap(0, va);
+  805100:	83 ec 08             	sub    $0x8,%esp
+  805103:	56                   	push   %esi
+  805104:	6a 00                	push   $0x0
+  805106:	e8 4c d8 ff ff       	call   802957 <sys_page_unmap>
+  80510b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80510e:	83 ec 08             	sub    $0x8,%esp
+  805111:	ff 75 f0             	push   -0x10(%ebp)
+  805114:	6a 00                	push   $0x0
+  805116:	e8 3c d8 ff ff       	call   802957 <sys_page_unmap>
+  80511b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80511e:	83 ec 08             	sub    $0x8,%esp
+  805121:	ff 75 f4             	push   -0xc(%ebp)
+  805124:	6a 00                	push   $0x0
+  805126:	e8 2c d8 ff ff       	call   802957 <sys_page_unmap>
+  80512b:	83 c4 10             	add    $0x10,%esp
+}
+  80512e:	89 d8                	mov    %ebx,%eax
+  805130:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805133:	5b                   	pop    %ebx
+  805134:	5e                   	pop    %esi
+  805135:	5d                   	pop    %ebp
+  805136:	c3                   	ret
+
+00805137 <pipeisclosed>:
+{
+  805137:	55                   	push   %ebp
+  805138:	89 e5                	mov    %esp,%ebp
+  80513a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80513d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805140:	50                   	push   %eax
+  805141:	ff 75 08             	push   0x8(%ebp)
+  805144:	e8 ff df ff ff       	call   803148 <fd_lookup>
+  805149:	83 c4 10             	add    $0x10,%esp
+  80514c:	85 c0                	test   %eax,%eax
+  80514e:	78 18                	js     805168 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  805150:	83 ec 0c             	sub    $0xc,%esp
+  805153:	ff 75 f4             	push   -0xc(%ebp)
+  805156:	e8 86 df ff ff       	call   8030e1 <fd2data>
+  80515b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80515d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805160:	e8 e6 f9 ff ff       	call   804b4b <_pipeisclosed>
+  805165:	83 c4 10             	add    $0x10,%esp
+}
+  805168:	c9                   	leave
+  805169:	c3                   	ret
+
+0080516a <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80516a:	55                   	push   %ebp
+  80516b:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80516d:	8b 45 08             	mov    0x8(%ebp),%eax
+  805170:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  805176:	5d                   	pop    %ebp
+  805177:	c3                   	ret
+
+00805178 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  805178:	55                   	push   %ebp
+  805179:	89 e5                	mov    %esp,%ebp
+  80517b:	53                   	push   %ebx
+  80517c:	83 ec 04             	sub    $0x4,%esp
+  80517f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  805182:	8b 03                	mov    (%ebx),%eax
+  805184:	85 c0                	test   %eax,%eax
+  805186:	75 05                	jne    80518d <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  805188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80518b:	c9                   	leave
+  80518c:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80518d:	83 ec 08             	sub    $0x8,%esp
+  805190:	50                   	push   %eax
+  805191:	8d 43 04             	lea    0x4(%ebx),%eax
+  805194:	50                   	push   %eax
+  805195:	e8 0d da ff ff       	call   802ba7 <sys_page_batch>
+	pb->pb_n = 0;
+  80519a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8051a0:	83 c4 10             	add    $0x10,%esp
+  8051a3:	eb e3                	jmp    805188 <pgbatch_flush+0x10>
+
+008051a5 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8051a5:	55                   	push   %ebp
+  8051a6:	89 e5                	mov    %esp,%ebp
+  8051a8:	56                   	push   %esi
+  8051a9:	53                   	push   %ebx
+  8051aa:	89 c3                	mov    %eax,%ebx
+  8051ac:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8051ae:	83 38 20             	cmpl   $0x20,(%eax)
+  8051b1:	74 2c                	je     8051df <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8051b3:	8b 03                	mov    (%ebx),%eax
+  8051b5:	8d 50 01             	lea    0x1(%eax),%edx
+  8051b8:	89 13                	mov    %edx,(%ebx)
+  8051ba:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8051bd:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8051c1:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8051c3:	83 ec 04             	sub    $0x4,%esp
+  8051c6:	6a 18                	push   $0x18
+  8051c8:	6a 00                	push   $0x0
+  8051ca:	50                   	push   %eax
+  8051cb:	e8 49 d4 ff ff       	call   802619 <memset>
+	return 0;
+  8051d0:	83 c4 10             	add    $0x10,%esp
+  8051d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8051db:	5b                   	pop    %ebx
+  8051dc:	5e                   	pop    %esi
+  8051dd:	5d                   	pop    %ebp
+  8051de:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8051df:	83 ec 0c             	sub    $0xc,%esp
+  8051e2:	50                   	push   %eax
+  8051e3:	e8 90 ff ff ff       	call   805178 <pgbatch_flush>
+  8051e8:	83 c4 10             	add    $0x10,%esp
+  8051eb:	85 c0                	test   %eax,%eax
+  8051ed:	79 c4                	jns    8051b3 <pgbatch_slot+0xe>
+  8051ef:	eb e7                	jmp    8051d8 <pgbatch_slot+0x33>
+
+008051f1 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8051f1:	55                   	push   %ebp
+  8051f2:	89 e5                	mov    %esp,%ebp
+  8051f4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8051f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8051fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8051fd:	e8 a3 ff ff ff       	call   8051a5 <pgbatch_slot>
+  805202:	85 c0                	test   %eax,%eax
+  805204:	78 20                	js     805226 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  805206:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805209:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80520f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805212:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  805215:	8b 55 10             	mov    0x10(%ebp),%edx
+  805218:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80521b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80521e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805221:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805226:	c9                   	leave
+  805227:	c3                   	ret
+
+00805228 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  805228:	55                   	push   %ebp
+  805229:	89 e5                	mov    %esp,%ebp
+  80522b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80522e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805231:	8b 45 08             	mov    0x8(%ebp),%eax
+  805234:	e8 6c ff ff ff       	call   8051a5 <pgbatch_slot>
+  805239:	85 c0                	test   %eax,%eax
+  80523b:	78 2c                	js     805269 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80523d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805240:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  805246:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805249:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80524c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80524f:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  805252:	8b 55 14             	mov    0x14(%ebp),%edx
+  805255:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  805258:	8b 55 18             	mov    0x18(%ebp),%edx
+  80525b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80525e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  805261:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805264:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805269:	c9                   	leave
+  80526a:	c3                   	ret
+
+0080526b <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80526b:	55                   	push   %ebp
+  80526c:	89 e5                	mov    %esp,%ebp
+  80526e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805271:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805274:	8b 45 08             	mov    0x8(%ebp),%eax
+  805277:	e8 29 ff ff ff       	call   8051a5 <pgbatch_slot>
+  80527c:	85 c0                	test   %eax,%eax
+  80527e:	78 1a                	js     80529a <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  805280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805283:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  805289:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80528c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80528f:	8b 55 10             	mov    0x10(%ebp),%edx
+  805292:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  805295:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80529a:	c9                   	leave
+  80529b:	c3                   	ret
+
+0080529c <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80529c:	55                   	push   %ebp
+  80529d:	89 e5                	mov    %esp,%ebp
+  80529f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8052a2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8052a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8052a8:	e8 f8 fe ff ff       	call   8051a5 <pgbatch_slot>
+  8052ad:	85 c0                	test   %eax,%eax
+  8052af:	78 20                	js     8052d1 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8052b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8052b4:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8052ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8052bd:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8052c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8052c3:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8052c6:	8b 55 14             	mov    0x14(%ebp),%edx
+  8052c9:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8052cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052d1:	c9                   	leave
+  8052d2:	c3                   	ret
+
+008052d3 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8052d3:	55                   	push   %ebp
+  8052d4:	89 e5                	mov    %esp,%ebp
+  8052d6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8052d9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8052dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8052df:	e8 c1 fe ff ff       	call   8051a5 <pgbatch_slot>
+  8052e4:	85 c0                	test   %eax,%eax
+  8052e6:	78 26                	js     80530e <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8052e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8052eb:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8052f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8052f4:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8052f7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8052fa:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8052fd:	8b 55 14             	mov    0x14(%ebp),%edx
+  805300:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  805303:	8b 55 18             	mov    0x18(%ebp),%edx
+  805306:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805309:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80530e:	c9                   	leave
+  80530f:	c3                   	ret
+
+00805310 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  805310:	b8 00 00 00 00       	mov    $0x0,%eax
+  805315:	c3                   	ret
+
+00805316 <devcons_poll>:
+{
+  805316:	55                   	push   %ebp
+  805317:	89 e5                	mov    %esp,%ebp
+  805319:	53                   	push   %ebx
+  80531a:	83 ec 04             	sub    $0x4,%esp
+  80531d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  805320:	89 da                	mov    %ebx,%edx
+  805322:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  805325:	83 3d 34 c3 80 00 00 	cmpl   $0x0,0x80c334
+  80532c:	74 0c                	je     80533a <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80532e:	89 d8                	mov    %ebx,%eax
+  805330:	83 e0 01             	and    $0x1,%eax
+  805333:	09 d0                	or     %edx,%eax
+}
+  805335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805338:	c9                   	leave
+  805339:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80533a:	e8 f5 d4 ff ff       	call   802834 <sys_cgetc>
+  80533f:	a3 34 c3 80 00       	mov    %eax,0x80c334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  805344:	89 da                	mov    %ebx,%edx
+  805346:	83 e2 04             	and    $0x4,%edx
+  805349:	85 c0                	test   %eax,%eax
+  80534b:	74 e6                	je     805333 <devcons_poll+0x1d>
+  80534d:	eb df                	jmp    80532e <devcons_poll+0x18>
+
+0080534f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80534f:	55                   	push   %ebp
+  805350:	89 e5                	mov    %esp,%ebp
+  805352:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  805355:	68 a1 60 80 00       	push   $0x8060a1
+  80535a:	ff 75 0c             	push   0xc(%ebp)
+  80535d:	e8 3c d1 ff ff       	call   80249e <strcpy>
+	return 0;
+}
+  805362:	b8 00 00 00 00       	mov    $0x0,%eax
+  805367:	c9                   	leave
+  805368:	c3                   	ret
+
+00805369 <devcons_write>:
+{
+  805369:	55                   	push   %ebp
+  80536a:	89 e5                	mov    %esp,%ebp
+  80536c:	57                   	push   %edi
+  80536d:	56                   	push   %esi
+  80536e:	53                   	push   %ebx
+  80536f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  805375:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  805378:	85 ff                	test   %edi,%edi
+  80537a:	74 51                	je     8053cd <devcons_write+0x64>
+  80537c:	be 00 00 00 00       	mov    $0x0,%esi
+  805381:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  805386:	89 fb                	mov    %edi,%ebx
+  805388:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80538a:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80538f:	39 d3                	cmp    %edx,%ebx
+  805391:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  805394:	83 ec 04             	sub    $0x4,%esp
+  805397:	53                   	push   %ebx
+  805398:	03 45 0c             	add    0xc(%ebp),%eax
+  80539b:	50                   	push   %eax
+  80539c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8053a2:	50                   	push   %eax
+  8053a3:	e8 a6 d2 ff ff       	call   80264e <memmove>
+		sys_cputs(buf, m);
+  8053a8:	83 c4 08             	add    $0x8,%esp
+  8053ab:	53                   	push   %ebx
+  8053ac:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8053b2:	50                   	push   %eax
+  8053b3:	e8 5e d4 ff ff       	call   802816 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8053b8:	01 de                	add    %ebx,%esi
+  8053ba:	89 f0                	mov    %esi,%eax
+  8053bc:	83 c4 10             	add    $0x10,%esp
+  8053bf:	39 fe                	cmp    %edi,%esi
+  8053c1:	72 c3                	jb     805386 <devcons_write+0x1d>
+}
+  8053c3:	89 f0                	mov    %esi,%eax
+  8053c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8053c8:	5b                   	pop    %ebx
+  8053c9:	5e                   	pop    %esi
+  8053ca:	5f                   	pop    %edi
+  8053cb:	5d                   	pop    %ebp
+  8053cc:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8053cd:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8053d2:	eb ef                	jmp    8053c3 <devcons_write+0x5a>
+
+008053d4 <devcons_read>:
+{
+  8053d4:	55                   	push   %ebp
+  8053d5:	89 e5                	mov    %esp,%ebp
+  8053d7:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8053da:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8053df:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8053e3:	74 36                	je     80541b <devcons_read+0x47>
+	c = cons_peek;
+  8053e5:	a1 34 c3 80 00       	mov    0x80c334,%eax
+	cons_peek = 0;
+  8053ea:	c7 05 34 c3 80 00 00 	movl   $0x0,0x80c334
+  8053f1:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8053f4:	85 c0                	test   %eax,%eax
+  8053f6:	75 10                	jne    805408 <devcons_read+0x34>
+  8053f8:	e8 37 d4 ff ff       	call   802834 <sys_cgetc>
+  8053fd:	85 c0                	test   %eax,%eax
+  8053ff:	75 07                	jne    805408 <devcons_read+0x34>
+		sys_yield();
+  805401:	e8 ad d4 ff ff       	call   8028b3 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  805406:	eb f0                	jmp    8053f8 <devcons_read+0x24>
+	if (c < 0)
+  805408:	85 c0                	test   %eax,%eax
+  80540a:	78 0f                	js     80541b <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80540c:	83 f8 04             	cmp    $0x4,%eax
+  80540f:	74 0c                	je     80541d <devcons_read+0x49>
+	*(char*)vbuf = c;
+  805411:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805414:	88 02                	mov    %al,(%edx)
+	return 1;
+  805416:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80541b:	c9                   	leave
+  80541c:	c3                   	ret
+		return 0;
+  80541d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805422:	eb f7                	jmp    80541b <devcons_read+0x47>
+
+00805424 <cputchar>:
+{
+  805424:	55                   	push   %ebp
+  805425:	89 e5                	mov    %esp,%ebp
+  805427:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80542a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80542d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  805430:	6a 01                	push   $0x1
+  805432:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805435:	50                   	push   %eax
+  805436:	e8 db d3 ff ff       	call   802816 <sys_cputs>
+}
+  80543b:	83 c4 10             	add    $0x10,%esp
+  80543e:	c9                   	leave
+  80543f:	c3                   	ret
+
+00805440 <getchar>:
+{
+  805440:	55                   	push   %ebp
+  805441:	89 e5                	mov    %esp,%ebp
+  805443:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  805446:	6a 01                	push   $0x1
+  805448:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80544b:	50                   	push   %eax
+  80544c:	6a 00                	push   $0x0
+  80544e:	e8 79 df ff ff       	call   8033cc <read>
+	if (r < 0)
+  805453:	83 c4 10             	add    $0x10,%esp
+  805456:	85 c0                	test   %eax,%eax
+  805458:	78 06                	js     805460 <getchar+0x20>
+	if (r < 1)
+  80545a:	74 06                	je     805462 <getchar+0x22>
+	return c;
+  80545c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  805460:	c9                   	leave
+  805461:	c3                   	ret
+		return -E_EOF;
+  805462:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  805467:	eb f7                	jmp    805460 <getchar+0x20>
+
+00805469 <iscons>:
+{
+  805469:	55                   	push   %ebp
+  80546a:	89 e5                	mov    %esp,%ebp
+  80546c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80546f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805472:	50                   	push   %eax
+  805473:	ff 75 08             	push   0x8(%ebp)
+  805476:	e8 cd dc ff ff       	call   803148 <fd_lookup>
+  80547b:	83 c4 10             	add    $0x10,%esp
+  80547e:	85 c0                	test   %eax,%eax
+  805480:	78 11                	js     805493 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  805482:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805485:	8b 15 e0 b0 80 00    	mov    0x80b0e0,%edx
+  80548b:	39 10                	cmp    %edx,(%eax)
+  80548d:	0f 94 c0             	sete   %al
+  805490:	0f b6 c0             	movzbl %al,%eax
+}
+  805493:	c9                   	leave
+  805494:	c3                   	ret
+
+00805495 <opencons>:
+{
+  805495:	55                   	push   %ebp
+  805496:	89 e5                	mov    %esp,%ebp
+  805498:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80549b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80549e:	50                   	push   %eax
+  80549f:	e8 54 dc ff ff       	call   8030f8 <fd_alloc>
+  8054a4:	83 c4 10             	add    $0x10,%esp
+  8054a7:	85 c0                	test   %eax,%eax
+  8054a9:	78 3a                	js     8054e5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8054ab:	83 ec 04             	sub    $0x4,%esp
+  8054ae:	68 07 04 00 00       	push   $0x407
+  8054b3:	ff 75 f4             	push   -0xc(%ebp)
+  8054b6:	6a 00                	push   $0x0
+  8054b8:	e8 15 d4 ff ff       	call   8028d2 <sys_page_alloc>
+  8054bd:	83 c4 10             	add    $0x10,%esp
+  8054c0:	85 c0                	test   %eax,%eax
+  8054c2:	78 21                	js     8054e5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8054c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8054c7:	8b 15 e0 b0 80 00    	mov    0x80b0e0,%edx
+  8054cd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8054cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8054d2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8054d9:	83 ec 0c             	sub    $0xc,%esp
+  8054dc:	50                   	push   %eax
+  8054dd:	e8 ef db ff ff       	call   8030d1 <fd2num>
+  8054e2:	83 c4 10             	add    $0x10,%esp
+}
+  8054e5:	c9                   	leave
+  8054e6:	c3                   	ret
+
+008054e7 <__udivdi3>:
+  8054e7:	57                   	push   %edi
+  8054e8:	56                   	push   %esi
+  8054e9:	53                   	push   %ebx
+  8054ea:	83 ec 20             	sub    $0x20,%esp
+  8054ed:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8054f1:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8054f5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8054f9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8054fd:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805501:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805505:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805509:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80550d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805512:	b8 00 00 00 00       	mov    $0x0,%eax
+  805517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80551c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805523:	00 
+  805524:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80552b:	00 
+  80552c:	eb 08                	jmp    805536 <__udivdi3+0x4f>
+  80552e:	83 e9 01             	sub    $0x1,%ecx
+  805531:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805534:	74 68                	je     80559e <__udivdi3+0xb7>
+  805536:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80553a:	01 c0                	add    %eax,%eax
+  80553c:	89 c6                	mov    %eax,%esi
+  80553e:	89 d7                	mov    %edx,%edi
+  805540:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805544:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805548:	0f ad d0             	shrd   %cl,%edx,%eax
+  80554b:	d3 ea                	shr    %cl,%edx
+  80554d:	f6 c1 20             	test   $0x20,%cl
+  805550:	74 04                	je     805556 <__udivdi3+0x6f>
+  805552:	89 d0                	mov    %edx,%eax
+  805554:	31 d2                	xor    %edx,%edx
+  805556:	83 e0 01             	and    $0x1,%eax
+  805559:	89 04 24             	mov    %eax,(%esp)
+  80555c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805563:	00 
+  805564:	8b 04 24             	mov    (%esp),%eax
+  805567:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80556b:	09 f0                	or     %esi,%eax
+  80556d:	09 fa                	or     %edi,%edx
+  80556f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805573:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805577:	39 f0                	cmp    %esi,%eax
+  805579:	89 d3                	mov    %edx,%ebx
+  80557b:	19 fb                	sbb    %edi,%ebx
+  80557d:	72 af                	jb     80552e <__udivdi3+0x47>
+  80557f:	29 f0                	sub    %esi,%eax
+  805581:	19 fa                	sbb    %edi,%edx
+  805583:	89 cf                	mov    %ecx,%edi
+  805585:	c1 ef 05             	shr    $0x5,%edi
+  805588:	83 e7 01             	and    $0x1,%edi
+  80558b:	89 fe                	mov    %edi,%esi
+  80558d:	83 f6 01             	xor    $0x1,%esi
+  805590:	d3 e6                	shl    %cl,%esi
+  805592:	d3 e7                	shl    %cl,%edi
+  805594:	09 74 24 18          	or     %esi,0x18(%esp)
+  805598:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80559c:	eb 90                	jmp    80552e <__udivdi3+0x47>
+  80559e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8055a2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8055a6:	83 c4 20             	add    $0x20,%esp
+  8055a9:	5b                   	pop    %ebx
+  8055aa:	5e                   	pop    %esi
+  8055ab:	5f                   	pop    %edi
+  8055ac:	c3                   	ret
+
+008055ad <__umoddi3>:
+  8055ad:	57                   	push   %edi
+  8055ae:	56                   	push   %esi
+  8055af:	53                   	push   %ebx
+  8055b0:	83 ec 08             	sub    $0x8,%esp
+  8055b3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8055b7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8055bb:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8055bf:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8055c3:	57                   	push   %edi
+  8055c4:	56                   	push   %esi
+  8055c5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8055c9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8055cd:	52                   	push   %edx
+  8055ce:	50                   	push   %eax
+  8055cf:	e8 13 ff ff ff       	call   8054e7 <__udivdi3>
+  8055d4:	89 c3                	mov    %eax,%ebx
+  8055d6:	0f af d6             	imul   %esi,%edx
+  8055d9:	89 f9                	mov    %edi,%ecx
+  8055db:	0f af cb             	imul   %ebx,%ecx
+  8055de:	01 d1                	add    %edx,%ecx
+  8055e0:	89 d8                	mov    %ebx,%eax
+  8055e2:	f7 e6                	mul    %esi
+  8055e4:	89 c6                	mov    %eax,%esi
+  8055e6:	89 d7                	mov    %edx,%edi
+  8055e8:	01 cf                	add    %ecx,%edi
+  8055ea:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8055ee:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8055f2:	29 f0                	sub    %esi,%eax
+  8055f4:	19 fa                	sbb    %edi,%edx
+  8055f6:	83 c4 18             	add    $0x18,%esp
+  8055f9:	5b                   	pop    %ebx
+  8055fa:	5e                   	pop    %esi
+  8055fb:	5f                   	pop    %edi
+  8055fc:	c3                   	ret
+
+008055fd <__divdi3>:
+  8055fd:	53                   	push   %ebx
+  8055fe:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805602:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805606:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80560a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80560e:	85 d2                	test   %edx,%edx
+  805610:	78 12                	js     805624 <__divdi3+0x27>
+  805612:	85 db                	test   %ebx,%ebx
+  805614:	78 2e                	js     805644 <__divdi3+0x47>
+  805616:	53                   	push   %ebx
+  805617:	51                   	push   %ecx
+  805618:	52                   	push   %edx
+  805619:	50                   	push   %eax
+  80561a:	e8 c8 fe ff ff       	call   8054e7 <__udivdi3>
+  80561f:	83 c4 10             	add    $0x10,%esp
+  805622:	eb 1e                	jmp    805642 <__divdi3+0x45>
+  805624:	f7 d8                	neg    %eax
+  805626:	83 d2 00             	adc    $0x0,%edx
+  805629:	f7 da                	neg    %edx
+  80562b:	85 db                	test   %ebx,%ebx
+  80562d:	78 2a                	js     805659 <__divdi3+0x5c>
+  80562f:	53                   	push   %ebx
+  805630:	51                   	push   %ecx
+  805631:	52                   	push   %edx
+  805632:	50                   	push   %eax
+  805633:	e8 af fe ff ff       	call   8054e7 <__udivdi3>
+  805638:	83 c4 10             	add    $0x10,%esp
+  80563b:	f7 d8                	neg    %eax
+  80563d:	83 d2 00             	adc    $0x0,%edx
+  805640:	f7 da                	neg    %edx
+  805642:	5b                   	pop    %ebx
+  805643:	c3                   	ret
+  805644:	f7 d9                	neg    %ecx
+  805646:	83 d3 00             	adc    $0x0,%ebx
+  805649:	f7 db                	neg    %ebx
+  80564b:	53                   	push   %ebx
+  80564c:	51                   	push   %ecx
+  80564d:	52                   	push   %edx
+  80564e:	50                   	push   %eax
+  80564f:	e8 93 fe ff ff       	call   8054e7 <__udivdi3>
+  805654:	83 c4 10             	add    $0x10,%esp
+  805657:	eb e2                	jmp    80563b <__divdi3+0x3e>
+  805659:	f7 d9                	neg    %ecx
+  80565b:	83 d3 00             	adc    $0x0,%ebx
+  80565e:	f7 db                	neg    %ebx
+  805660:	53                   	push   %ebx
+  805661:	51                   	push   %ecx
+  805662:	52                   	push   %edx
+  805663:	50                   	push   %eax
+  805664:	e8 7e fe ff ff       	call   8054e7 <__udivdi3>
+  805669:	83 c4 10             	add    $0x10,%esp
+  80566c:	eb d4                	jmp    805642 <__divdi3+0x45>
+
+0080566e <__moddi3>:
+  80566e:	57                   	push   %edi
+  80566f:	56                   	push   %esi
+  805670:	53                   	push   %ebx
+  805671:	83 ec 08             	sub    $0x8,%esp
+  805674:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805678:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80567c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  805680:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  805684:	57                   	push   %edi
+  805685:	56                   	push   %esi
+  805686:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80568a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80568e:	52                   	push   %edx
+  80568f:	50                   	push   %eax
+  805690:	e8 68 ff ff ff       	call   8055fd <__divdi3>
+  805695:	89 c3                	mov    %eax,%ebx
+  805697:	0f af d6             	imul   %esi,%edx
+  80569a:	89 f9                	mov    %edi,%ecx
+  80569c:	0f af cb             	imul   %ebx,%ecx
+  80569f:	01 d1                	add    %edx,%ecx
+  8056a1:	89 d8                	mov    %ebx,%eax
+  8056a3:	f7 e6                	mul    %esi
+  8056a5:	89 c6                	mov    %eax,%esi
+  8056a7:	89 d7                	mov    %edx,%edi
+  8056a9:	01 cf                	add    %ecx,%edi
+  8056ab:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8056af:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8056b3:	29 f0                	sub    %esi,%eax
+  8056b5:	19 fa                	sbb    %edi,%edx
+  8056b7:	83 c4 18             	add    $0x18,%esp
+  8056ba:	5b                   	pop    %ebx
+  8056bb:	5e                   	pop    %esi
+  8056bc:	5f                   	pop    %edi
+  8056bd:	c3                   	ret
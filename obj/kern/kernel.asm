@@ -0,0 +1,19062 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# physical addresses [0, 4MB).  This 4MB region will be suffice
+	# until we set up our real page table in mem_init in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100015:	b8 00 60 11 00       	mov    $0x116000,%eax
+	movl	%eax, %cr3
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl	%cr0, %eax
+f010001d:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100020:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f0100025:	0f 22 c0             	mov    %eax,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f0100028:	b8 2f 00 10 f0       	mov    $0xf010002f,%eax
+	jmp	*%eax
+f010002d:	ff e0                	jmp    *%eax
+
+f010002f <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f010002f:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f0100034:	bc 00 60 11 f0       	mov    $0xf0116000,%esp
+
+	# now to C code
+	call	i386_init
+f0100039:	e8 61 00 00 00       	call   f010009f <i386_init>
+
+f010003e <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f010003e:	eb fe                	jmp    f010003e <spin>
+
+f0100040 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f0100040:	55                   	push   %ebp
+f0100041:	89 e5                	mov    %esp,%ebp
+f0100043:	53                   	push   %ebx
+f0100044:	83 ec 04             	sub    $0x4,%esp
+	va_list ap;
+
+	if (panicstr)
+f0100047:	83 3d e0 f3 92 f0 00 	cmpl   $0x0,0xf092f3e0
+f010004e:	74 0f                	je     f010005f <_panic+0x1f>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f0100050:	83 ec 0c             	sub    $0xc,%esp
+f0100053:	6a 00                	push   $0x0
+f0100055:	e8 b6 0e 00 00       	call   f0100f10 <monitor>
+f010005a:	83 c4 10             	add    $0x10,%esp
+f010005d:	eb f1                	jmp    f0100050 <_panic+0x10>
+	panicstr = fmt;
+f010005f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100062:	a3 e0 f3 92 f0       	mov    %eax,0xf092f3e0
+	__asm __volatile("cli; cld");
+f0100067:	fa                   	cli
+f0100068:	fc                   	cld
+	va_start(ap, fmt);
+f0100069:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f010006c:	e8 88 82 00 00       	call   f01082f9 <cpunum>
+f0100071:	ff 75 0c             	push   0xc(%ebp)
+f0100074:	ff 75 08             	push   0x8(%ebp)
+f0100077:	50                   	push   %eax
+f0100078:	68 a0 b0 10 f0       	push   $0xf010b0a0
+f010007d:	e8 6a 46 00 00       	call   f01046ec <cprintf>
+	vcprintf(fmt, ap);
+f0100082:	83 c4 08             	add    $0x8,%esp
+f0100085:	53                   	push   %ebx
+f0100086:	ff 75 10             	push   0x10(%ebp)
+f0100089:	e8 38 46 00 00       	call   f01046c6 <vcprintf>
+	cprintf("\n");
+f010008e:	c7 04 24 8b bb 10 f0 	movl   $0xf010bb8b,(%esp)
+f0100095:	e8 52 46 00 00       	call   f01046ec <cprintf>
+f010009a:	83 c4 10             	add    $0x10,%esp
+f010009d:	eb b1                	jmp    f0100050 <_panic+0x10>
+
+f010009f <i386_init>:
+{
+f010009f:	55                   	push   %ebp
+f01000a0:	89 e5                	mov    %esp,%ebp
+f01000a2:	53                   	push   %ebx
+f01000a3:	83 ec 08             	sub    $0x8,%esp
+	memset(edata, 0, end - edata);
+f01000a6:	b8 ac 14 97 f0       	mov    $0xf09714ac,%eax
+f01000ab:	2d e8 b0 92 f0       	sub    $0xf092b0e8,%eax
+f01000b0:	50                   	push   %eax
+f01000b1:	6a 00                	push   $0x0
+f01000b3:	68 e8 b0 92 f0       	push   $0xf092b0e8
+f01000b8:	e8 e1 7b 00 00       	call   f0107c9e <memset>
+	cons_init();
+f01000bd:	e8 0d 06 00 00       	call   f01006cf <cons_init>
+	cprintf("6828 decimal is %o octal!\n", 6828);
+f01000c2:	83 c4 08             	add    $0x8,%esp
+f01000c5:	68 ac 1a 00 00       	push   $0x1aac
+f01000ca:	68 0c b1 10 f0       	push   $0xf010b10c
+f01000cf:	e8 18 46 00 00       	call   f01046ec <cprintf>
+	mem_init();
+f01000d4:	e8 8d 20 00 00       	call   f0102166 <mem_init>
+	env_init();
+f01000d9:	e8 59 3d 00 00       	call   f0103e37 <env_init>
+	trap_init();
+f01000de:	e8 06 47 00 00       	call   f01047e9 <trap_init>
+	mp_init();
+f01000e3:	e8 dc 7e 00 00       	call   f0107fc4 <mp_init>
+	lapic_init();
+f01000e8:	e8 22 82 00 00       	call   f010830f <lapic_init>
+	pic_init();
+f01000ed:	e8 06 45 00 00       	call   f01045f8 <pic_init>
+	time_init();
+f01000f2:	e8 18 a9 00 00       	call   f010aa0f <time_init>
+	pci_init();
+f01000f7:	e8 f3 a8 00 00       	call   f010a9ef <pci_init>
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f01000fc:	c7 04 24 a0 87 11 f0 	movl   $0xf01187a0,(%esp)
+f0100103:	e8 8b 84 00 00       	call   f0108593 <spin_lock>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0100108:	83 c4 10             	add    $0x10,%esp
+f010010b:	83 3d ec f3 92 f0 07 	cmpl   $0x7,0xf092f3ec
+f0100112:	76 41                	jbe    f0100155 <i386_init+0xb6>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f0100114:	83 ec 04             	sub    $0x4,%esp
+f0100117:	b8 16 7f 10 f0       	mov    $0xf0107f16,%eax
+f010011c:	2d 9c 7e 10 f0       	sub    $0xf0107e9c,%eax
+f0100121:	50                   	push   %eax
+f0100122:	68 9c 7e 10 f0       	push   $0xf0107e9c
+f0100127:	68 00 70 00 f0       	push   $0xf0007000
+f010012c:	e8 a2 7b 00 00       	call   f0107cd3 <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0100131:	69 05 a4 06 93 f0 d0 	imul   $0xd0,0xf09306a4,%eax
+f0100138:	00 00 00 
+f010013b:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f0100140:	83 c4 10             	add    $0x10,%esp
+f0100143:	3d 20 00 93 f0       	cmp    $0xf0930020,%eax
+f0100148:	0f 86 89 00 00 00    	jbe    f01001d7 <i386_init+0x138>
+f010014e:	bb 20 00 93 f0       	mov    $0xf0930020,%ebx
+f0100153:	eb 32                	jmp    f0100187 <i386_init+0xe8>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100155:	68 00 70 00 00       	push   $0x7000
+f010015a:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f010015f:	68 82 00 00 00       	push   $0x82
+f0100164:	68 27 b1 10 f0       	push   $0xf010b127
+f0100169:	e8 d2 fe ff ff       	call   f0100040 <_panic>
+f010016e:	81 c3 d0 00 00 00    	add    $0xd0,%ebx
+f0100174:	69 05 a4 06 93 f0 d0 	imul   $0xd0,0xf09306a4,%eax
+f010017b:	00 00 00 
+f010017e:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f0100183:	39 c3                	cmp    %eax,%ebx
+f0100185:	73 50                	jae    f01001d7 <i386_init+0x138>
+		if (c == cpus + cpunum())  // We've started already.
+f0100187:	e8 6d 81 00 00       	call   f01082f9 <cpunum>
+f010018c:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0100192:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f0100197:	39 c3                	cmp    %eax,%ebx
+f0100199:	74 d3                	je     f010016e <i386_init+0xcf>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f010019b:	89 d8                	mov    %ebx,%eax
+f010019d:	2d 20 00 93 f0       	sub    $0xf0930020,%eax
+f01001a2:	c1 f8 04             	sar    $0x4,%eax
+f01001a5:	69 c0 c5 4e ec c4    	imul   $0xc4ec4ec5,%eax,%eax
+f01001ab:	c1 e0 0f             	shl    $0xf,%eax
+f01001ae:	8d 80 00 90 93 f0    	lea    -0xf6c7000(%eax),%eax
+f01001b4:	a3 e4 f3 92 f0       	mov    %eax,0xf092f3e4
+		lapic_startap(c->cpu_id, PADDR(code));
+f01001b9:	83 ec 08             	sub    $0x8,%esp
+f01001bc:	68 00 70 00 00       	push   $0x7000
+f01001c1:	0f b6 03             	movzbl (%ebx),%eax
+f01001c4:	50                   	push   %eax
+f01001c5:	e8 8b 82 00 00       	call   f0108455 <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f01001ca:	83 c4 10             	add    $0x10,%esp
+f01001cd:	8b 43 04             	mov    0x4(%ebx),%eax
+f01001d0:	83 f8 01             	cmp    $0x1,%eax
+f01001d3:	75 f8                	jne    f01001cd <i386_init+0x12e>
+f01001d5:	eb 97                	jmp    f010016e <i386_init+0xcf>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f01001d7:	bb 08 00 00 00       	mov    $0x8,%ebx
+		ENV_CREATE(user_idle, ENV_TYPE_IDLE);
+f01001dc:	83 ec 04             	sub    $0x4,%esp
+f01001df:	6a 01                	push   $0x1
+f01001e1:	68 b4 c0 01 00       	push   $0x1c0b4
+f01001e6:	68 e4 68 28 f0       	push   $0xf02868e4
+f01001eb:	e8 ea 3e 00 00       	call   f01040da <env_create>
+	for (i = 0; i < NCPU; i++)
+f01001f0:	83 c4 10             	add    $0x10,%esp
+f01001f3:	83 eb 01             	sub    $0x1,%ebx
+f01001f6:	75 e4                	jne    f01001dc <i386_init+0x13d>
+	ENV_CREATE(fs_fs, ENV_TYPE_FS);
+f01001f8:	83 ec 04             	sub    $0x4,%esp
+f01001fb:	6a 02                	push   $0x2
+f01001fd:	68 9c b0 02 00       	push   $0x2b09c
+f0100202:	68 34 7c 4e f0       	push   $0xf04e7c34
+f0100207:	e8 ce 3e 00 00       	call   f01040da <env_create>
+	ENV_CREATE(net_ns, ENV_TYPE_NS);
+f010020c:	83 c4 0c             	add    $0xc,%esp
+f010020f:	6a 03                	push   $0x3
+f0100211:	68 44 6f 07 00       	push   $0x76f44
+f0100216:	68 c0 24 72 f0       	push   $0xf07224c0
+f010021b:	e8 ba 3e 00 00       	call   f01040da <env_create>
+	ENV_CREATE(user_hello, ENV_TYPE_USER);
+f0100220:	83 c4 0c             	add    $0xc,%esp
+f0100223:	6a 00                	push   $0x0
+f0100225:	68 84 c6 01 00       	push   $0x1c684
+f010022a:	68 10 88 11 f0       	push   $0xf0118810
+f010022f:	e8 a6 3e 00 00       	call   f01040da <env_create>
+	kbd_intr();
+f0100234:	e8 42 04 00 00       	call   f010067b <kbd_intr>
+	sched_yield();
+f0100239:	e8 b4 58 00 00       	call   f0105af2 <sched_yield>
+
+f010023e <mp_main>:
+{
+f010023e:	55                   	push   %ebp
+f010023f:	89 e5                	mov    %esp,%ebp
+f0100241:	83 ec 08             	sub    $0x8,%esp
+	lcr3(PADDR(kern_pgdir));
+f0100244:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0100249:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010024e:	76 5a                	jbe    f01002aa <mp_main+0x6c>
+	return (physaddr_t)kva - KERNBASE;
+f0100250:	05 00 00 00 10       	add    $0x10000000,%eax
+}
+
+static __inline void
+lcr3(uint32_t val)
+{
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0100255:	0f 22 d8             	mov    %eax,%cr3
+	tlb_init_percpu();
+f0100258:	e8 64 86 00 00       	call   f01088c1 <tlb_init_percpu>
+	cprintf("SMP: CPU %d starting\n", cpunum());
+f010025d:	e8 97 80 00 00       	call   f01082f9 <cpunum>
+f0100262:	83 ec 08             	sub    $0x8,%esp
+f0100265:	50                   	push   %eax
+f0100266:	68 33 b1 10 f0       	push   $0xf010b133
+f010026b:	e8 7c 44 00 00       	call   f01046ec <cprintf>
+	lapic_init();
+f0100270:	e8 9a 80 00 00       	call   f010830f <lapic_init>
+	env_init_percpu();
+f0100275:	e8 91 3b 00 00       	call   f0103e0b <env_init_percpu>
+	trap_init_percpu();
+f010027a:	e8 81 44 00 00       	call   f0104700 <trap_init_percpu>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f010027f:	e8 75 80 00 00       	call   f01082f9 <cpunum>
+f0100284:	69 d0 d0 00 00 00    	imul   $0xd0,%eax,%edx
+f010028a:	83 c2 04             	add    $0x4,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+f010028d:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100292:	f0 87 82 20 00 93 f0 	lock xchg %eax,-0xf6cffe0(%edx)
+f0100299:	c7 04 24 a0 87 11 f0 	movl   $0xf01187a0,(%esp)
+f01002a0:	e8 ee 82 00 00       	call   f0108593 <spin_lock>
+	sched_yield();
+f01002a5:	e8 48 58 00 00       	call   f0105af2 <sched_yield>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01002aa:	50                   	push   %eax
+f01002ab:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01002b0:	68 99 00 00 00       	push   $0x99
+f01002b5:	68 27 b1 10 f0       	push   $0xf010b127
+f01002ba:	e8 81 fd ff ff       	call   f0100040 <_panic>
+
+f01002bf <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f01002bf:	55                   	push   %ebp
+f01002c0:	89 e5                	mov    %esp,%ebp
+f01002c2:	53                   	push   %ebx
+f01002c3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f01002c6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+f01002c9:	ff 75 0c             	push   0xc(%ebp)
+f01002cc:	ff 75 08             	push   0x8(%ebp)
+f01002cf:	68 49 b1 10 f0       	push   $0xf010b149
+f01002d4:	e8 13 44 00 00       	call   f01046ec <cprintf>
+	vcprintf(fmt, ap);
+f01002d9:	83 c4 08             	add    $0x8,%esp
+f01002dc:	53                   	push   %ebx
+f01002dd:	ff 75 10             	push   0x10(%ebp)
+f01002e0:	e8 e1 43 00 00       	call   f01046c6 <vcprintf>
+	cprintf("\n");
+f01002e5:	c7 04 24 8b bb 10 f0 	movl   $0xf010bb8b,(%esp)
+f01002ec:	e8 fb 43 00 00       	call   f01046ec <cprintf>
+	va_end(ap);
+}
+f01002f1:	83 c4 10             	add    $0x10,%esp
+f01002f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01002f7:	c9                   	leave
+f01002f8:	c3                   	ret
+
+f01002f9 <serial_proc_data>:
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01002f9:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01002fe:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f01002ff:	a8 01                	test   $0x1,%al
+f0100301:	74 0a                	je     f010030d <serial_proc_data+0x14>
+f0100303:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100308:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f0100309:	0f b6 c0             	movzbl %al,%eax
+f010030c:	c3                   	ret
+		return -1;
+f010030d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0100312:	c3                   	ret
+
+f0100313 <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f0100313:	55                   	push   %ebp
+f0100314:	89 e5                	mov    %esp,%ebp
+f0100316:	53                   	push   %ebx
+f0100317:	83 ec 04             	sub    $0x4,%esp
+f010031a:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+f010031c:	eb 23                	jmp    f0100341 <cons_intr+0x2e>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f010031e:	8b 0d 24 c2 92 f0    	mov    0xf092c224,%ecx
+f0100324:	8d 51 01             	lea    0x1(%ecx),%edx
+f0100327:	88 81 20 c0 92 f0    	mov    %al,-0xf6d3fe0(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+f010032d:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f0100333:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100338:	0f 44 d0             	cmove  %eax,%edx
+f010033b:	89 15 24 c2 92 f0    	mov    %edx,0xf092c224
+	while ((c = (*proc)()) != -1) {
+f0100341:	ff d3                	call   *%ebx
+f0100343:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0100346:	74 06                	je     f010034e <cons_intr+0x3b>
+		if (c == 0)
+f0100348:	85 c0                	test   %eax,%eax
+f010034a:	75 d2                	jne    f010031e <cons_intr+0xb>
+f010034c:	eb f3                	jmp    f0100341 <cons_intr+0x2e>
+	}
+}
+f010034e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100351:	c9                   	leave
+f0100352:	c3                   	ret
+
+f0100353 <kbd_proc_data>:
+{
+f0100353:	55                   	push   %ebp
+f0100354:	89 e5                	mov    %esp,%ebp
+f0100356:	53                   	push   %ebx
+f0100357:	83 ec 04             	sub    $0x4,%esp
+f010035a:	ba 64 00 00 00       	mov    $0x64,%edx
+f010035f:	ec                   	in     (%dx),%al
+	if ((inb(KBSTATP) & KBS_DIB) == 0)
+f0100360:	a8 01                	test   $0x1,%al
+f0100362:	0f 84 e6 00 00 00    	je     f010044e <kbd_proc_data+0xfb>
+f0100368:	ba 60 00 00 00       	mov    $0x60,%edx
+f010036d:	ec                   	in     (%dx),%al
+f010036e:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f0100370:	3c e0                	cmp    $0xe0,%al
+f0100372:	74 61                	je     f01003d5 <kbd_proc_data+0x82>
+	} else if (data & 0x80) {
+f0100374:	84 c0                	test   %al,%al
+f0100376:	78 70                	js     f01003e8 <kbd_proc_data+0x95>
+	} else if (shift & E0ESC) {
+f0100378:	8b 0d 00 c0 92 f0    	mov    0xf092c000,%ecx
+f010037e:	f6 c1 40             	test   $0x40,%cl
+f0100381:	74 0e                	je     f0100391 <kbd_proc_data+0x3e>
+		data |= 0x80;
+f0100383:	83 c8 80             	or     $0xffffff80,%eax
+f0100386:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f0100388:	83 e1 bf             	and    $0xffffffbf,%ecx
+f010038b:	89 0d 00 c0 92 f0    	mov    %ecx,0xf092c000
+	shift |= shiftcode[data];
+f0100391:	0f b6 d2             	movzbl %dl,%edx
+f0100394:	0f b6 82 c0 b2 10 f0 	movzbl -0xfef4d40(%edx),%eax
+f010039b:	0b 05 00 c0 92 f0    	or     0xf092c000,%eax
+	shift ^= togglecode[data];
+f01003a1:	0f b6 8a c0 b1 10 f0 	movzbl -0xfef4e40(%edx),%ecx
+f01003a8:	31 c8                	xor    %ecx,%eax
+f01003aa:	a3 00 c0 92 f0       	mov    %eax,0xf092c000
+	c = charcode[shift & (CTL | SHIFT)][data];
+f01003af:	89 c1                	mov    %eax,%ecx
+f01003b1:	83 e1 03             	and    $0x3,%ecx
+f01003b4:	8b 0c 8d a0 b1 10 f0 	mov    -0xfef4e60(,%ecx,4),%ecx
+f01003bb:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f01003bf:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+f01003c2:	a8 08                	test   $0x8,%al
+f01003c4:	74 5d                	je     f0100423 <kbd_proc_data+0xd0>
+		if ('a' <= c && c <= 'z')
+f01003c6:	89 da                	mov    %ebx,%edx
+f01003c8:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f01003cb:	83 f9 19             	cmp    $0x19,%ecx
+f01003ce:	77 47                	ja     f0100417 <kbd_proc_data+0xc4>
+			c += 'A' - 'a';
+f01003d0:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f01003d3:	eb 0c                	jmp    f01003e1 <kbd_proc_data+0x8e>
+		shift |= E0ESC;
+f01003d5:	83 0d 00 c0 92 f0 40 	orl    $0x40,0xf092c000
+		return 0;
+f01003dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f01003e1:	89 d8                	mov    %ebx,%eax
+f01003e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01003e6:	c9                   	leave
+f01003e7:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f01003e8:	8b 0d 00 c0 92 f0    	mov    0xf092c000,%ecx
+f01003ee:	83 e0 7f             	and    $0x7f,%eax
+f01003f1:	f6 c1 40             	test   $0x40,%cl
+f01003f4:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f01003f7:	0f b6 d2             	movzbl %dl,%edx
+f01003fa:	0f b6 82 c0 b2 10 f0 	movzbl -0xfef4d40(%edx),%eax
+f0100401:	83 c8 40             	or     $0x40,%eax
+f0100404:	0f b6 c0             	movzbl %al,%eax
+f0100407:	f7 d0                	not    %eax
+f0100409:	21 c8                	and    %ecx,%eax
+f010040b:	a3 00 c0 92 f0       	mov    %eax,0xf092c000
+		return 0;
+f0100410:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100415:	eb ca                	jmp    f01003e1 <kbd_proc_data+0x8e>
+		else if ('A' <= c && c <= 'Z')
+f0100417:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f010041a:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f010041d:	83 fa 1a             	cmp    $0x1a,%edx
+f0100420:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f0100423:	f7 d0                	not    %eax
+f0100425:	a8 06                	test   $0x6,%al
+f0100427:	75 b8                	jne    f01003e1 <kbd_proc_data+0x8e>
+f0100429:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f010042f:	75 b0                	jne    f01003e1 <kbd_proc_data+0x8e>
+		cprintf("Rebooting!\n");
+f0100431:	83 ec 0c             	sub    $0xc,%esp
+f0100434:	68 63 b1 10 f0       	push   $0xf010b163
+f0100439:	e8 ae 42 00 00       	call   f01046ec <cprintf>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010043e:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100443:	ba 92 00 00 00       	mov    $0x92,%edx
+f0100448:	ee                   	out    %al,(%dx)
+}
+f0100449:	83 c4 10             	add    $0x10,%esp
+f010044c:	eb 93                	jmp    f01003e1 <kbd_proc_data+0x8e>
+		return -1;
+f010044e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100453:	eb 8c                	jmp    f01003e1 <kbd_proc_data+0x8e>
+
+f0100455 <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f0100455:	55                   	push   %ebp
+f0100456:	89 e5                	mov    %esp,%ebp
+f0100458:	57                   	push   %edi
+f0100459:	56                   	push   %esi
+f010045a:	53                   	push   %ebx
+f010045b:	83 ec 1c             	sub    $0x1c,%esp
+f010045e:	89 c7                	mov    %eax,%edi
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100460:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100465:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f0100466:	a8 20                	test   $0x20,%al
+f0100468:	75 27                	jne    f0100491 <cons_putc+0x3c>
+	for (i = 0;
+f010046a:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010046f:	b9 84 00 00 00       	mov    $0x84,%ecx
+f0100474:	be fd 03 00 00       	mov    $0x3fd,%esi
+f0100479:	89 ca                	mov    %ecx,%edx
+f010047b:	ec                   	in     (%dx),%al
+f010047c:	ec                   	in     (%dx),%al
+f010047d:	ec                   	in     (%dx),%al
+f010047e:	ec                   	in     (%dx),%al
+	     i++)
+f010047f:	83 c3 01             	add    $0x1,%ebx
+f0100482:	89 f2                	mov    %esi,%edx
+f0100484:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f0100485:	a8 20                	test   $0x20,%al
+f0100487:	75 08                	jne    f0100491 <cons_putc+0x3c>
+f0100489:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f010048f:	7e e8                	jle    f0100479 <cons_putc+0x24>
+	outb(COM1 + COM_TX, c);
+f0100491:	89 f8                	mov    %edi,%eax
+f0100493:	88 45 e7             	mov    %al,-0x19(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100496:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010049b:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010049c:	ba 79 03 00 00       	mov    $0x379,%edx
+f01004a1:	ec                   	in     (%dx),%al
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f01004a2:	84 c0                	test   %al,%al
+f01004a4:	78 27                	js     f01004cd <cons_putc+0x78>
+f01004a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01004ab:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01004b0:	be 79 03 00 00       	mov    $0x379,%esi
+f01004b5:	89 ca                	mov    %ecx,%edx
+f01004b7:	ec                   	in     (%dx),%al
+f01004b8:	ec                   	in     (%dx),%al
+f01004b9:	ec                   	in     (%dx),%al
+f01004ba:	ec                   	in     (%dx),%al
+f01004bb:	83 c3 01             	add    $0x1,%ebx
+f01004be:	89 f2                	mov    %esi,%edx
+f01004c0:	ec                   	in     (%dx),%al
+f01004c1:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f01004c7:	7f 04                	jg     f01004cd <cons_putc+0x78>
+f01004c9:	84 c0                	test   %al,%al
+f01004cb:	79 e8                	jns    f01004b5 <cons_putc+0x60>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01004cd:	ba 78 03 00 00       	mov    $0x378,%edx
+f01004d2:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f01004d6:	ee                   	out    %al,(%dx)
+f01004d7:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f01004dc:	b8 0d 00 00 00       	mov    $0xd,%eax
+f01004e1:	ee                   	out    %al,(%dx)
+f01004e2:	b8 08 00 00 00       	mov    $0x8,%eax
+f01004e7:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+f01004e8:	89 f8                	mov    %edi,%eax
+f01004ea:	80 cc 07             	or     $0x7,%ah
+f01004ed:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f01004f3:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+f01004f6:	89 f8                	mov    %edi,%eax
+f01004f8:	0f b6 c0             	movzbl %al,%eax
+f01004fb:	89 fb                	mov    %edi,%ebx
+f01004fd:	80 fb 0a             	cmp    $0xa,%bl
+f0100500:	0f 84 e1 00 00 00    	je     f01005e7 <cons_putc+0x192>
+f0100506:	83 f8 0a             	cmp    $0xa,%eax
+f0100509:	7f 46                	jg     f0100551 <cons_putc+0xfc>
+f010050b:	83 f8 08             	cmp    $0x8,%eax
+f010050e:	0f 84 a7 00 00 00    	je     f01005bb <cons_putc+0x166>
+f0100514:	83 f8 09             	cmp    $0x9,%eax
+f0100517:	0f 85 d7 00 00 00    	jne    f01005f4 <cons_putc+0x19f>
+		cons_putc(' ');
+f010051d:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100522:	e8 2e ff ff ff       	call   f0100455 <cons_putc>
+		cons_putc(' ');
+f0100527:	b8 20 00 00 00       	mov    $0x20,%eax
+f010052c:	e8 24 ff ff ff       	call   f0100455 <cons_putc>
+		cons_putc(' ');
+f0100531:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100536:	e8 1a ff ff ff       	call   f0100455 <cons_putc>
+		cons_putc(' ');
+f010053b:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100540:	e8 10 ff ff ff       	call   f0100455 <cons_putc>
+		cons_putc(' ');
+f0100545:	b8 20 00 00 00       	mov    $0x20,%eax
+f010054a:	e8 06 ff ff ff       	call   f0100455 <cons_putc>
+		break;
+f010054f:	eb 25                	jmp    f0100576 <cons_putc+0x121>
+	switch (c & 0xff) {
+f0100551:	83 f8 0d             	cmp    $0xd,%eax
+f0100554:	0f 85 9a 00 00 00    	jne    f01005f4 <cons_putc+0x19f>
+		crt_pos -= (crt_pos % CRT_COLS);
+f010055a:	0f b7 05 28 c2 92 f0 	movzwl 0xf092c228,%eax
+f0100561:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100567:	c1 e8 16             	shr    $0x16,%eax
+f010056a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010056d:	c1 e0 04             	shl    $0x4,%eax
+f0100570:	66 a3 28 c2 92 f0    	mov    %ax,0xf092c228
+	if (crt_pos >= CRT_SIZE) {
+f0100576:	66 81 3d 28 c2 92 f0 	cmpw   $0x7cf,0xf092c228
+f010057d:	cf 07 
+f010057f:	0f 87 92 00 00 00    	ja     f0100617 <cons_putc+0x1c2>
+	outb(addr_6845, 14);
+f0100585:	8b 0d 30 c2 92 f0    	mov    0xf092c230,%ecx
+f010058b:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100590:	89 ca                	mov    %ecx,%edx
+f0100592:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f0100593:	0f b7 1d 28 c2 92 f0 	movzwl 0xf092c228,%ebx
+f010059a:	8d 71 01             	lea    0x1(%ecx),%esi
+f010059d:	89 d8                	mov    %ebx,%eax
+f010059f:	66 c1 e8 08          	shr    $0x8,%ax
+f01005a3:	89 f2                	mov    %esi,%edx
+f01005a5:	ee                   	out    %al,(%dx)
+f01005a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01005ab:	89 ca                	mov    %ecx,%edx
+f01005ad:	ee                   	out    %al,(%dx)
+f01005ae:	89 d8                	mov    %ebx,%eax
+f01005b0:	89 f2                	mov    %esi,%edx
+f01005b2:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+f01005b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01005b6:	5b                   	pop    %ebx
+f01005b7:	5e                   	pop    %esi
+f01005b8:	5f                   	pop    %edi
+f01005b9:	5d                   	pop    %ebp
+f01005ba:	c3                   	ret
+		if (crt_pos > 0) {
+f01005bb:	0f b7 05 28 c2 92 f0 	movzwl 0xf092c228,%eax
+f01005c2:	66 85 c0             	test   %ax,%ax
+f01005c5:	74 be                	je     f0100585 <cons_putc+0x130>
+			crt_pos--;
+f01005c7:	83 e8 01             	sub    $0x1,%eax
+f01005ca:	66 a3 28 c2 92 f0    	mov    %ax,0xf092c228
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f01005d0:	0f b7 c0             	movzwl %ax,%eax
+f01005d3:	66 81 e7 00 ff       	and    $0xff00,%di
+f01005d8:	83 cf 20             	or     $0x20,%edi
+f01005db:	8b 15 2c c2 92 f0    	mov    0xf092c22c,%edx
+f01005e1:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f01005e5:	eb 8f                	jmp    f0100576 <cons_putc+0x121>
+		crt_pos += CRT_COLS;
+f01005e7:	66 83 05 28 c2 92 f0 	addw   $0x50,0xf092c228
+f01005ee:	50 
+f01005ef:	e9 66 ff ff ff       	jmp    f010055a <cons_putc+0x105>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f01005f4:	0f b7 05 28 c2 92 f0 	movzwl 0xf092c228,%eax
+f01005fb:	8d 50 01             	lea    0x1(%eax),%edx
+f01005fe:	66 89 15 28 c2 92 f0 	mov    %dx,0xf092c228
+f0100605:	0f b7 c0             	movzwl %ax,%eax
+f0100608:	8b 15 2c c2 92 f0    	mov    0xf092c22c,%edx
+f010060e:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+f0100612:	e9 5f ff ff ff       	jmp    f0100576 <cons_putc+0x121>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f0100617:	a1 2c c2 92 f0       	mov    0xf092c22c,%eax
+f010061c:	83 ec 04             	sub    $0x4,%esp
+f010061f:	68 00 0f 00 00       	push   $0xf00
+f0100624:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f010062a:	52                   	push   %edx
+f010062b:	50                   	push   %eax
+f010062c:	e8 a2 76 00 00       	call   f0107cd3 <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+f0100631:	8b 15 2c c2 92 f0    	mov    0xf092c22c,%edx
+f0100637:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f010063d:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+f0100643:	83 c4 10             	add    $0x10,%esp
+f0100646:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f010064b:	83 c0 02             	add    $0x2,%eax
+f010064e:	39 d0                	cmp    %edx,%eax
+f0100650:	75 f4                	jne    f0100646 <cons_putc+0x1f1>
+		crt_pos -= CRT_COLS;
+f0100652:	66 83 2d 28 c2 92 f0 	subw   $0x50,0xf092c228
+f0100659:	50 
+f010065a:	e9 26 ff ff ff       	jmp    f0100585 <cons_putc+0x130>
+
+f010065f <serial_intr>:
+	if (serial_exists)
+f010065f:	83 3d 34 c2 92 f0 00 	cmpl   $0x0,0xf092c234
+f0100666:	75 01                	jne    f0100669 <serial_intr+0xa>
+f0100668:	c3                   	ret
+{
+f0100669:	55                   	push   %ebp
+f010066a:	89 e5                	mov    %esp,%ebp
+f010066c:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+f010066f:	b8 f9 02 10 f0       	mov    $0xf01002f9,%eax
+f0100674:	e8 9a fc ff ff       	call   f0100313 <cons_intr>
+}
+f0100679:	c9                   	leave
+f010067a:	c3                   	ret
+
+f010067b <kbd_intr>:
+{
+f010067b:	55                   	push   %ebp
+f010067c:	89 e5                	mov    %esp,%ebp
+f010067e:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+f0100681:	b8 53 03 10 f0       	mov    $0xf0100353,%eax
+f0100686:	e8 88 fc ff ff       	call   f0100313 <cons_intr>
+}
+f010068b:	c9                   	leave
+f010068c:	c3                   	ret
+
+f010068d <cons_getc>:
+{
+f010068d:	55                   	push   %ebp
+f010068e:	89 e5                	mov    %esp,%ebp
+f0100690:	83 ec 08             	sub    $0x8,%esp
+	serial_intr();
+f0100693:	e8 c7 ff ff ff       	call   f010065f <serial_intr>
+	kbd_intr();
+f0100698:	e8 de ff ff ff       	call   f010067b <kbd_intr>
+	if (cons.rpos != cons.wpos) {
+f010069d:	a1 20 c2 92 f0       	mov    0xf092c220,%eax
+	return 0;
+f01006a2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+f01006a7:	3b 05 24 c2 92 f0    	cmp    0xf092c224,%eax
+f01006ad:	74 1c                	je     f01006cb <cons_getc+0x3e>
+		c = cons.buf[cons.rpos++];
+f01006af:	8d 48 01             	lea    0x1(%eax),%ecx
+f01006b2:	0f b6 90 20 c0 92 f0 	movzbl -0xf6d3fe0(%eax),%edx
+			cons.rpos = 0;
+f01006b9:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f01006be:	b8 00 00 00 00       	mov    $0x0,%eax
+f01006c3:	0f 45 c1             	cmovne %ecx,%eax
+f01006c6:	a3 20 c2 92 f0       	mov    %eax,0xf092c220
+}
+f01006cb:	89 d0                	mov    %edx,%eax
+f01006cd:	c9                   	leave
+f01006ce:	c3                   	ret
+
+f01006cf <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f01006cf:	55                   	push   %ebp
+f01006d0:	89 e5                	mov    %esp,%ebp
+f01006d2:	57                   	push   %edi
+f01006d3:	56                   	push   %esi
+f01006d4:	53                   	push   %ebx
+f01006d5:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;
+f01006d8:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f01006df:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f01006e6:	5a a5 
+	if (*cp != 0xA55A) {
+f01006e8:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f01006ef:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f01006f4:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+	if (*cp != 0xA55A) {
+f01006f9:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f01006fd:	0f 84 d1 00 00 00    	je     f01007d4 <cons_init+0x105>
+		addr_6845 = MONO_BASE;
+f0100703:	89 1d 30 c2 92 f0    	mov    %ebx,0xf092c230
+f0100709:	b8 0e 00 00 00       	mov    $0xe,%eax
+f010070e:	89 da                	mov    %ebx,%edx
+f0100710:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f0100711:	8d 7b 01             	lea    0x1(%ebx),%edi
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100714:	89 fa                	mov    %edi,%edx
+f0100716:	ec                   	in     (%dx),%al
+f0100717:	0f b6 c8             	movzbl %al,%ecx
+f010071a:	c1 e1 08             	shl    $0x8,%ecx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010071d:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100722:	89 da                	mov    %ebx,%edx
+f0100724:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100725:	89 fa                	mov    %edi,%edx
+f0100727:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f0100728:	89 35 2c c2 92 f0    	mov    %esi,0xf092c22c
+	pos |= inb(addr_6845 + 1);
+f010072e:	0f b6 c0             	movzbl %al,%eax
+f0100731:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+f0100733:	66 a3 28 c2 92 f0    	mov    %ax,0xf092c228
+	kbd_intr();
+f0100739:	e8 3d ff ff ff       	call   f010067b <kbd_intr>
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<1));
+f010073e:	83 ec 0c             	sub    $0xc,%esp
+f0100741:	0f b7 05 88 83 11 f0 	movzwl 0xf0118388,%eax
+f0100748:	25 fd ff 00 00       	and    $0xfffd,%eax
+f010074d:	50                   	push   %eax
+f010074e:	e8 22 3e 00 00       	call   f0104575 <irq_setmask_8259A>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100753:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100758:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f010075d:	89 c8                	mov    %ecx,%eax
+f010075f:	89 da                	mov    %ebx,%edx
+f0100761:	ee                   	out    %al,(%dx)
+f0100762:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f0100767:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f010076c:	89 fa                	mov    %edi,%edx
+f010076e:	ee                   	out    %al,(%dx)
+f010076f:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100774:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100779:	ee                   	out    %al,(%dx)
+f010077a:	be f9 03 00 00       	mov    $0x3f9,%esi
+f010077f:	89 c8                	mov    %ecx,%eax
+f0100781:	89 f2                	mov    %esi,%edx
+f0100783:	ee                   	out    %al,(%dx)
+f0100784:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100789:	89 fa                	mov    %edi,%edx
+f010078b:	ee                   	out    %al,(%dx)
+f010078c:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f0100791:	89 c8                	mov    %ecx,%eax
+f0100793:	ee                   	out    %al,(%dx)
+f0100794:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100799:	89 f2                	mov    %esi,%edx
+f010079b:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010079c:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01007a1:	ec                   	in     (%dx),%al
+f01007a2:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f01007a4:	83 c4 10             	add    $0x10,%esp
+f01007a7:	3c ff                	cmp    $0xff,%al
+f01007a9:	0f 95 c0             	setne  %al
+f01007ac:	0f b6 c0             	movzbl %al,%eax
+f01007af:	a3 34 c2 92 f0       	mov    %eax,0xf092c234
+f01007b4:	89 da                	mov    %ebx,%edx
+f01007b6:	ec                   	in     (%dx),%al
+f01007b7:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01007bc:	ec                   	in     (%dx),%al
+	if (serial_exists)
+f01007bd:	80 f9 ff             	cmp    $0xff,%cl
+f01007c0:	75 28                	jne    f01007ea <cons_init+0x11b>
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+		cprintf("Serial port does not exist!\n");
+f01007c2:	83 ec 0c             	sub    $0xc,%esp
+f01007c5:	68 6f b1 10 f0       	push   $0xf010b16f
+f01007ca:	e8 1d 3f 00 00       	call   f01046ec <cprintf>
+f01007cf:	83 c4 10             	add    $0x10,%esp
+}
+f01007d2:	eb 37                	jmp    f010080b <cons_init+0x13c>
+		*cp = was;
+f01007d4:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f01007db:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f01007e0:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f01007e5:	e9 19 ff ff ff       	jmp    f0100703 <cons_init+0x34>
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<4));
+f01007ea:	83 ec 0c             	sub    $0xc,%esp
+f01007ed:	0f b7 05 88 83 11 f0 	movzwl 0xf0118388,%eax
+f01007f4:	25 ef ff 00 00       	and    $0xffef,%eax
+f01007f9:	50                   	push   %eax
+f01007fa:	e8 76 3d 00 00       	call   f0104575 <irq_setmask_8259A>
+	if (!serial_exists)
+f01007ff:	83 c4 10             	add    $0x10,%esp
+f0100802:	83 3d 34 c2 92 f0 00 	cmpl   $0x0,0xf092c234
+f0100809:	74 b7                	je     f01007c2 <cons_init+0xf3>
+}
+f010080b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010080e:	5b                   	pop    %ebx
+f010080f:	5e                   	pop    %esi
+f0100810:	5f                   	pop    %edi
+f0100811:	5d                   	pop    %ebp
+f0100812:	c3                   	ret
+
+f0100813 <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f0100813:	55                   	push   %ebp
+f0100814:	89 e5                	mov    %esp,%ebp
+f0100816:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+f0100819:	8b 45 08             	mov    0x8(%ebp),%eax
+f010081c:	e8 34 fc ff ff       	call   f0100455 <cons_putc>
+}
+f0100821:	c9                   	leave
+f0100822:	c3                   	ret
+
+f0100823 <getchar>:
+
+int
+getchar(void)
+{
+f0100823:	55                   	push   %ebp
+f0100824:	89 e5                	mov    %esp,%ebp
+f0100826:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f0100829:	e8 5f fe ff ff       	call   f010068d <cons_getc>
+f010082e:	85 c0                	test   %eax,%eax
+f0100830:	74 f7                	je     f0100829 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f0100832:	c9                   	leave
+f0100833:	c3                   	ret
+
+f0100834 <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f0100834:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100839:	c3                   	ret
+
+f010083a <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f010083a:	55                   	push   %ebp
+f010083b:	89 e5                	mov    %esp,%ebp
+f010083d:	56                   	push   %esi
+f010083e:	53                   	push   %ebx
+	int i;
+
+	for (i = 0; i < NCOMMANDS; i++)
+f010083f:	bb 60 b8 10 f0       	mov    $0xf010b860,%ebx
+f0100844:	be a8 b8 10 f0       	mov    $0xf010b8a8,%esi
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f0100849:	83 ec 04             	sub    $0x4,%esp
+f010084c:	ff 73 04             	push   0x4(%ebx)
+f010084f:	ff 33                	push   (%ebx)
+f0100851:	68 c0 b3 10 f0       	push   $0xf010b3c0
+f0100856:	e8 91 3e 00 00       	call   f01046ec <cprintf>
+	for (i = 0; i < NCOMMANDS; i++)
+f010085b:	83 c3 0c             	add    $0xc,%ebx
+f010085e:	83 c4 10             	add    $0x10,%esp
+f0100861:	39 f3                	cmp    %esi,%ebx
+f0100863:	75 e4                	jne    f0100849 <mon_help+0xf>
+	return 0;
+}
+f0100865:	b8 00 00 00 00       	mov    $0x0,%eax
+f010086a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010086d:	5b                   	pop    %ebx
+f010086e:	5e                   	pop    %esi
+f010086f:	5d                   	pop    %ebp
+f0100870:	c3                   	ret
+
+f0100871 <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f0100871:	55                   	push   %ebp
+f0100872:	89 e5                	mov    %esp,%ebp
+f0100874:	83 ec 14             	sub    $0x14,%esp
+	extern char entry[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+f0100877:	68 c9 b3 10 f0       	push   $0xf010b3c9
+f010087c:	e8 6b 3e 00 00       	call   f01046ec <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f0100881:	83 c4 0c             	add    $0xc,%esp
+f0100884:	68 0c 00 10 00       	push   $0x10000c
+f0100889:	68 0c 00 10 f0       	push   $0xf010000c
+f010088e:	68 74 b5 10 f0       	push   $0xf010b574
+f0100893:	e8 54 3e 00 00       	call   f01046ec <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f0100898:	83 c4 0c             	add    $0xc,%esp
+f010089b:	68 9a b0 10 00       	push   $0x10b09a
+f01008a0:	68 9a b0 10 f0       	push   $0xf010b09a
+f01008a5:	68 98 b5 10 f0       	push   $0xf010b598
+f01008aa:	e8 3d 3e 00 00       	call   f01046ec <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f01008af:	83 c4 0c             	add    $0xc,%esp
+f01008b2:	68 e8 b0 92 00       	push   $0x92b0e8
+f01008b7:	68 e8 b0 92 f0       	push   $0xf092b0e8
+f01008bc:	68 bc b5 10 f0       	push   $0xf010b5bc
+f01008c1:	e8 26 3e 00 00       	call   f01046ec <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f01008c6:	83 c4 0c             	add    $0xc,%esp
+f01008c9:	68 ac 14 97 00       	push   $0x9714ac
+f01008ce:	68 ac 14 97 f0       	push   $0xf09714ac
+f01008d3:	68 e0 b5 10 f0       	push   $0xf010b5e0
+f01008d8:	e8 0f 3e 00 00       	call   f01046ec <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008dd:	83 c4 08             	add    $0x8,%esp
+		(end-entry+1023)/1024);
+f01008e0:	ba ac 14 97 f0       	mov    $0xf09714ac,%edx
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008e5:	89 d0                	mov    %edx,%eax
+f01008e7:	2d 0e f8 0f f0       	sub    $0xf00ff80e,%eax
+f01008ec:	81 ea 0d fc 0f f0    	sub    $0xf00ffc0d,%edx
+f01008f2:	0f 49 c2             	cmovns %edx,%eax
+f01008f5:	c1 f8 0a             	sar    $0xa,%eax
+f01008f8:	50                   	push   %eax
+f01008f9:	68 04 b6 10 f0       	push   $0xf010b604
+f01008fe:	e8 e9 3d 00 00       	call   f01046ec <cprintf>
+	return 0;
+}
+f0100903:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100908:	c9                   	leave
+f0100909:	c3                   	ret
+
+f010090a <mon_backtrace>:
+
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+f010090a:	55                   	push   %ebp
+f010090b:	89 e5                	mov    %esp,%ebp
+f010090d:	56                   	push   %esi
+f010090e:	53                   	push   %ebx
+f010090f:	83 ec 3c             	sub    $0x3c,%esp
+	// Your code here.
+	uintptr_t *ebp, *eip;
+	int i;
+	struct Eipdebuginfo info;
+	uint32_t args[5];
+	cprintf("Stack backtrace:\n");
+f0100912:	68 e2 b3 10 f0       	push   $0xf010b3e2
+f0100917:	e8 d0 3d 00 00       	call   f01046ec <cprintf>
+        __asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f010091c:	89 e8                	mov    %ebp,%eax
+	ebp =(uintptr_t*) read_ebp();
+f010091e:	89 c3                	mov    %eax,%ebx
+	while(ebp != 0)
+f0100920:	83 c4 10             	add    $0x10,%esp
+		for(i = 0; i < 5; i++)
+			args[i] = *(ebp+2+i);
+		
+		cprintf(" ebp %08x eip %08x args %08x %08x %08x %08x %08x\n", ebp, *eip, 
+			args[0], args[1], args[2], args[3], args[4]);
+		debuginfo_eip(*eip, &info);
+f0100923:	8d 75 e0             	lea    -0x20(%ebp),%esi
+	while(ebp != 0)
+f0100926:	85 c0                	test   %eax,%eax
+f0100928:	75 5e                	jne    f0100988 <mon_backtrace+0x7e>
+		cprintf("     %s:%d: %.*s+%d\n",info.eip_file, info.eip_line,
+			info.eip_fn_namelen, info.eip_fn_name, (*eip)-info.eip_fn_addr);
+		ebp = (uintptr_t*)(*ebp);
+	}
+	return 0;
+}
+f010092a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010092f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100932:	5b                   	pop    %ebx
+f0100933:	5e                   	pop    %esi
+f0100934:	5d                   	pop    %ebp
+f0100935:	c3                   	ret
+		cprintf(" ebp %08x eip %08x args %08x %08x %08x %08x %08x\n", ebp, *eip, 
+f0100936:	ff 75 dc             	push   -0x24(%ebp)
+f0100939:	ff 75 d8             	push   -0x28(%ebp)
+f010093c:	ff 75 d4             	push   -0x2c(%ebp)
+f010093f:	ff 75 d0             	push   -0x30(%ebp)
+f0100942:	ff 75 cc             	push   -0x34(%ebp)
+f0100945:	ff 73 04             	push   0x4(%ebx)
+f0100948:	53                   	push   %ebx
+f0100949:	68 30 b6 10 f0       	push   $0xf010b630
+f010094e:	e8 99 3d 00 00       	call   f01046ec <cprintf>
+		debuginfo_eip(*eip, &info);
+f0100953:	83 c4 18             	add    $0x18,%esp
+f0100956:	56                   	push   %esi
+f0100957:	ff 73 04             	push   0x4(%ebx)
+f010095a:	e8 10 67 00 00       	call   f010706f <debuginfo_eip>
+		cprintf("     %s:%d: %.*s+%d\n",info.eip_file, info.eip_line,
+f010095f:	83 c4 08             	add    $0x8,%esp
+f0100962:	8b 43 04             	mov    0x4(%ebx),%eax
+f0100965:	2b 45 f0             	sub    -0x10(%ebp),%eax
+f0100968:	50                   	push   %eax
+f0100969:	ff 75 e8             	push   -0x18(%ebp)
+f010096c:	ff 75 ec             	push   -0x14(%ebp)
+f010096f:	ff 75 e4             	push   -0x1c(%ebp)
+f0100972:	ff 75 e0             	push   -0x20(%ebp)
+f0100975:	68 f4 b3 10 f0       	push   $0xf010b3f4
+f010097a:	e8 6d 3d 00 00       	call   f01046ec <cprintf>
+		ebp = (uintptr_t*)(*ebp);
+f010097f:	8b 1b                	mov    (%ebx),%ebx
+	while(ebp != 0)
+f0100981:	83 c4 20             	add    $0x20,%esp
+f0100984:	85 db                	test   %ebx,%ebx
+f0100986:	74 a2                	je     f010092a <mon_backtrace+0x20>
+		for(i = 0; i < 5; i++)
+f0100988:	b8 00 00 00 00       	mov    $0x0,%eax
+			args[i] = *(ebp+2+i);
+f010098d:	8b 54 83 08          	mov    0x8(%ebx,%eax,4),%edx
+f0100991:	89 54 85 cc          	mov    %edx,-0x34(%ebp,%eax,4)
+		for(i = 0; i < 5; i++)
+f0100995:	83 c0 01             	add    $0x1,%eax
+f0100998:	83 f8 05             	cmp    $0x5,%eax
+f010099b:	75 f0                	jne    f010098d <mon_backtrace+0x83>
+f010099d:	eb 97                	jmp    f0100936 <mon_backtrace+0x2c>
+
+f010099f <mon_chperm>:
+//set, clear, or change the permissions of any mapping in the current address space
+// Usage: chperm +/-perm addr. 
+// example chperm +w addr // KERNEL W/R
+// the addr should be mapped and aligned at 4kb.
+int mon_chperm(int argc, char **argv, struct Trapframe *tf)
+{
+f010099f:	55                   	push   %ebp
+f01009a0:	89 e5                	mov    %esp,%ebp
+f01009a2:	56                   	push   %esi
+f01009a3:	53                   	push   %ebx
+f01009a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	pte_t *pte;
+	uint32_t flag;
+	char *option = argv[1];
+f01009a7:	8b 70 04             	mov    0x4(%eax),%esi
+	uintptr_t va = strtol(argv[2], 0, 0);
+f01009aa:	83 ec 04             	sub    $0x4,%esp
+f01009ad:	6a 00                	push   $0x0
+f01009af:	6a 00                	push   $0x0
+f01009b1:	ff 70 08             	push   0x8(%eax)
+f01009b4:	e8 fd 73 00 00       	call   f0107db6 <strtol>
+#define CLEAR 0
+#define SET 1
+	if(argc != 3) {
+f01009b9:	83 c4 10             	add    $0x10,%esp
+f01009bc:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f01009c0:	75 40                	jne    f0100a02 <mon_chperm+0x63>
+		cprintf("Usage: chperm +/-perm addr\n");
+		return 0;
+	}
+	if(option[0] == '+') 
+f01009c2:	0f b6 16             	movzbl (%esi),%edx
+f01009c5:	80 fa 2b             	cmp    $0x2b,%dl
+f01009c8:	74 66                	je     f0100a30 <mon_chperm+0x91>
+		flag = SET;
+	else if(option[0] == '-')
+		flag = CLEAR;
+f01009ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if(option[0] == '-')
+f01009cf:	80 fa 2d             	cmp    $0x2d,%dl
+f01009d2:	75 4a                	jne    f0100a1e <mon_chperm+0x7f>
+		cprintf("Usage: chperm +/-perm addr\n");
+		return 0;
+	}
+		
+	option++;
+	if(PGOFF(va) != 0) {
+f01009d4:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f01009d9:	75 5c                	jne    f0100a37 <mon_chperm+0x98>
+		cprintf("addr shoud be aligned at 4KB\n");
+		return 0;
+	}
+	pte = pgdir_walk(kern_pgdir, (void*)va, 0);
+f01009db:	83 ec 04             	sub    $0x4,%esp
+f01009de:	6a 00                	push   $0x0
+f01009e0:	50                   	push   %eax
+f01009e1:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f01009e7:	e8 49 0f 00 00       	call   f0101935 <pgdir_walk>
+f01009ec:	89 c2                	mov    %eax,%edx
+	if(pte == NULL) 
+f01009ee:	83 c4 10             	add    $0x10,%esp
+f01009f1:	85 c0                	test   %eax,%eax
+f01009f3:	74 1d                	je     f0100a12 <mon_chperm+0x73>
+		return 0;
+
+	while(*option != '\0') {
+f01009f5:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+f01009f9:	84 c0                	test   %al,%al
+f01009fb:	74 15                	je     f0100a12 <mon_chperm+0x73>
+	option++;
+f01009fd:	83 c6 01             	add    $0x1,%esi
+f0100a00:	eb 59                	jmp    f0100a5b <mon_chperm+0xbc>
+		cprintf("Usage: chperm +/-perm addr\n");
+f0100a02:	83 ec 0c             	sub    $0xc,%esp
+f0100a05:	68 09 b4 10 f0       	push   $0xf010b409
+f0100a0a:	e8 dd 3c 00 00       	call   f01046ec <cprintf>
+		return 0;
+f0100a0f:	83 c4 10             	add    $0x10,%esp
+			break;
+		}
+		option++;
+	}
+	return 0;
+}
+f0100a12:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100a17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100a1a:	5b                   	pop    %ebx
+f0100a1b:	5e                   	pop    %esi
+f0100a1c:	5d                   	pop    %ebp
+f0100a1d:	c3                   	ret
+		cprintf("Usage: chperm +/-perm addr\n");
+f0100a1e:	83 ec 0c             	sub    $0xc,%esp
+f0100a21:	68 09 b4 10 f0       	push   $0xf010b409
+f0100a26:	e8 c1 3c 00 00       	call   f01046ec <cprintf>
+		return 0;
+f0100a2b:	83 c4 10             	add    $0x10,%esp
+f0100a2e:	eb e2                	jmp    f0100a12 <mon_chperm+0x73>
+		flag = SET;
+f0100a30:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0100a35:	eb 9d                	jmp    f01009d4 <mon_chperm+0x35>
+		cprintf("addr shoud be aligned at 4KB\n");
+f0100a37:	83 ec 0c             	sub    $0xc,%esp
+f0100a3a:	68 25 b4 10 f0       	push   $0xf010b425
+f0100a3f:	e8 a8 3c 00 00       	call   f01046ec <cprintf>
+		return 0;
+f0100a44:	83 c4 10             	add    $0x10,%esp
+f0100a47:	eb c9                	jmp    f0100a12 <mon_chperm+0x73>
+			if(flag == SET)
+f0100a49:	83 fb 01             	cmp    $0x1,%ebx
+f0100a4c:	74 1e                	je     f0100a6c <mon_chperm+0xcd>
+				*pte |= PTE_U;
+f0100a4e:	83 0a 04             	orl    $0x4,(%edx)
+		option++;
+f0100a51:	83 c6 01             	add    $0x1,%esi
+	while(*option != '\0') {
+f0100a54:	0f b6 06             	movzbl (%esi),%eax
+f0100a57:	84 c0                	test   %al,%al
+f0100a59:	74 b7                	je     f0100a12 <mon_chperm+0x73>
+		switch(*option) {
+f0100a5b:	83 e8 6b             	sub    $0x6b,%eax
+f0100a5e:	3c 0c                	cmp    $0xc,%al
+f0100a60:	77 ef                	ja     f0100a51 <mon_chperm+0xb2>
+f0100a62:	0f b6 c0             	movzbl %al,%eax
+f0100a65:	ff 24 85 20 b8 10 f0 	jmp    *-0xfef47e0(,%eax,4)
+				*pte &= ~PTE_U;
+f0100a6c:	83 22 fb             	andl   $0xfffffffb,(%edx)
+f0100a6f:	eb e0                	jmp    f0100a51 <mon_chperm+0xb2>
+			if(flag == SET)
+f0100a71:	83 fb 01             	cmp    $0x1,%ebx
+f0100a74:	74 05                	je     f0100a7b <mon_chperm+0xdc>
+				*pte &= ~PTE_U;
+f0100a76:	83 22 fb             	andl   $0xfffffffb,(%edx)
+f0100a79:	eb d6                	jmp    f0100a51 <mon_chperm+0xb2>
+				*pte |= PTE_U;
+f0100a7b:	83 0a 04             	orl    $0x4,(%edx)
+f0100a7e:	eb d1                	jmp    f0100a51 <mon_chperm+0xb2>
+			if(flag == SET)
+f0100a80:	83 fb 01             	cmp    $0x1,%ebx
+f0100a83:	74 05                	je     f0100a8a <mon_chperm+0xeb>
+				*pte &= ~PTE_P;
+f0100a85:	83 22 fe             	andl   $0xfffffffe,(%edx)
+f0100a88:	eb c7                	jmp    f0100a51 <mon_chperm+0xb2>
+				*pte |= PTE_P;
+f0100a8a:	83 0a 01             	orl    $0x1,(%edx)
+f0100a8d:	eb c2                	jmp    f0100a51 <mon_chperm+0xb2>
+			if(flag == SET)
+f0100a8f:	83 fb 01             	cmp    $0x1,%ebx
+f0100a92:	74 05                	je     f0100a99 <mon_chperm+0xfa>
+				*pte &= ~PTE_W;
+f0100a94:	83 22 fd             	andl   $0xfffffffd,(%edx)
+f0100a97:	eb b8                	jmp    f0100a51 <mon_chperm+0xb2>
+				*pte |= PTE_W;
+f0100a99:	83 0a 02             	orl    $0x2,(%edx)
+f0100a9c:	eb b3                	jmp    f0100a51 <mon_chperm+0xb2>
+			if(flag == SET)
+f0100a9e:	83 fb 01             	cmp    $0x1,%ebx
+f0100aa1:	74 05                	je     f0100aa8 <mon_chperm+0x109>
+				*pte |= PTE_W;
+f0100aa3:	83 0a 02             	orl    $0x2,(%edx)
+f0100aa6:	eb a9                	jmp    f0100a51 <mon_chperm+0xb2>
+				*pte &= ~PTE_W;
+f0100aa8:	83 22 fd             	andl   $0xfffffffd,(%edx)
+f0100aab:	eb a4                	jmp    f0100a51 <mon_chperm+0xb2>
+
+f0100aad <mon_dump>:
+//2014.9.30
+// dump the content of memory 
+// la,va can be virtual address or physical address
+// dump -p/v la size
+int mon_dump(int argc, char **argv, struct Trapframe *tf)
+{
+f0100aad:	55                   	push   %ebp
+f0100aae:	89 e5                	mov    %esp,%ebp
+f0100ab0:	57                   	push   %edi
+f0100ab1:	56                   	push   %esi
+f0100ab2:	53                   	push   %ebx
+f0100ab3:	83 ec 1c             	sub    $0x1c,%esp
+f0100ab6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uintptr_t la;
+	uint32_t size, i;
+	char flag;
+	if(argc != 4)
+f0100ab9:	83 7d 08 04          	cmpl   $0x4,0x8(%ebp)
+f0100abd:	74 41                	je     f0100b00 <mon_dump+0x53>
+	{
+		cprintf("Usage: dump -p/v la size\n");
+f0100abf:	83 ec 0c             	sub    $0xc,%esp
+f0100ac2:	68 43 b4 10 f0       	push   $0xf010b443
+f0100ac7:	e8 20 3c 00 00       	call   f01046ec <cprintf>
+		cprintf("-p specify la  physical address\n");
+f0100acc:	c7 04 24 64 b6 10 f0 	movl   $0xf010b664,(%esp)
+f0100ad3:	e8 14 3c 00 00       	call   f01046ec <cprintf>
+		cprintf("-v specify la  virtual address\n");
+f0100ad8:	c7 04 24 88 b6 10 f0 	movl   $0xf010b688,(%esp)
+f0100adf:	e8 08 3c 00 00       	call   f01046ec <cprintf>
+		cprintf("the range [la, la+size] shoud be mapped, otherwise crashed\n");
+f0100ae4:	c7 04 24 a8 b6 10 f0 	movl   $0xf010b6a8,(%esp)
+f0100aeb:	e8 fc 3b 00 00       	call   f01046ec <cprintf>
+		return 0;
+f0100af0:	83 c4 10             	add    $0x10,%esp
+		cprintf("%08x", *(uintptr_t*)(la));
+		la += 4;
+	}
+	cprintf("\n");
+	return 0;
+}
+f0100af3:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100afb:	5b                   	pop    %ebx
+f0100afc:	5e                   	pop    %esi
+f0100afd:	5f                   	pop    %edi
+f0100afe:	5d                   	pop    %ebp
+f0100aff:	c3                   	ret
+	la = strtol(argv[2], 0, 0);
+f0100b00:	83 ec 04             	sub    $0x4,%esp
+f0100b03:	6a 00                	push   $0x0
+f0100b05:	6a 00                	push   $0x0
+f0100b07:	ff 73 08             	push   0x8(%ebx)
+f0100b0a:	e8 a7 72 00 00       	call   f0107db6 <strtol>
+f0100b0f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	size = strtol(argv[3], 0, 0);
+f0100b12:	83 c4 0c             	add    $0xc,%esp
+f0100b15:	6a 00                	push   $0x0
+f0100b17:	6a 00                	push   $0x0
+f0100b19:	ff 73 0c             	push   0xc(%ebx)
+f0100b1c:	e8 95 72 00 00       	call   f0107db6 <strtol>
+f0100b21:	89 c7                	mov    %eax,%edi
+	if(*argv[1] != '-')
+f0100b23:	8b 43 04             	mov    0x4(%ebx),%eax
+f0100b26:	83 c4 10             	add    $0x10,%esp
+f0100b29:	80 38 2d             	cmpb   $0x2d,(%eax)
+f0100b2c:	75 39                	jne    f0100b67 <mon_dump+0xba>
+	la = strtol(argv[2], 0, 0);
+f0100b2e:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	flag = *(++argv[1]);
+f0100b31:	8d 50 01             	lea    0x1(%eax),%edx
+f0100b34:	89 53 04             	mov    %edx,0x4(%ebx)
+f0100b37:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+f0100b3b:	88 45 e7             	mov    %al,-0x19(%ebp)
+	if(flag == 'p') 
+f0100b3e:	3c 70                	cmp    $0x70,%al
+f0100b40:	74 52                	je     f0100b94 <mon_dump+0xe7>
+	if(la + size < la) {
+f0100b42:	89 f0                	mov    %esi,%eax
+f0100b44:	01 f8                	add    %edi,%eax
+f0100b46:	72 79                	jb     f0100bc1 <mon_dump+0x114>
+	for(i = 0; i < size; i++) {
+f0100b48:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100b4d:	85 ff                	test   %edi,%edi
+f0100b4f:	0f 85 d4 00 00 00    	jne    f0100c29 <mon_dump+0x17c>
+	cprintf("\n");
+f0100b55:	83 ec 0c             	sub    $0xc,%esp
+f0100b58:	68 8b bb 10 f0       	push   $0xf010bb8b
+f0100b5d:	e8 8a 3b 00 00       	call   f01046ec <cprintf>
+	return 0;
+f0100b62:	83 c4 10             	add    $0x10,%esp
+f0100b65:	eb 8c                	jmp    f0100af3 <mon_dump+0x46>
+		cprintf("Usage: dump -p/v la size\n");
+f0100b67:	83 ec 0c             	sub    $0xc,%esp
+f0100b6a:	68 43 b4 10 f0       	push   $0xf010b443
+f0100b6f:	e8 78 3b 00 00       	call   f01046ec <cprintf>
+		cprintf("-p specify la  physical address\n");
+f0100b74:	c7 04 24 64 b6 10 f0 	movl   $0xf010b664,(%esp)
+f0100b7b:	e8 6c 3b 00 00       	call   f01046ec <cprintf>
+		cprintf("-v specify la  virtual address\n");
+f0100b80:	c7 04 24 88 b6 10 f0 	movl   $0xf010b688,(%esp)
+f0100b87:	e8 60 3b 00 00       	call   f01046ec <cprintf>
+		return 0;
+f0100b8c:	83 c4 10             	add    $0x10,%esp
+f0100b8f:	e9 5f ff ff ff       	jmp    f0100af3 <mon_dump+0x46>
+	if (PGNUM(pa) >= npages)
+f0100b94:	89 f0                	mov    %esi,%eax
+f0100b96:	c1 e8 0c             	shr    $0xc,%eax
+f0100b99:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0100b9f:	73 0b                	jae    f0100bac <mon_dump+0xff>
+	return (void *)(pa + KERNBASE);
+f0100ba1:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0100ba4:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+f0100baa:	eb 96                	jmp    f0100b42 <mon_dump+0x95>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100bac:	56                   	push   %esi
+f0100bad:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0100bb2:	68 17 01 00 00       	push   $0x117
+f0100bb7:	68 5d b4 10 f0       	push   $0xf010b45d
+f0100bbc:	e8 7f f4 ff ff       	call   f0100040 <_panic>
+		cprintf("size too large\n");
+f0100bc1:	83 ec 0c             	sub    $0xc,%esp
+f0100bc4:	68 6c b4 10 f0       	push   $0xf010b46c
+f0100bc9:	e8 1e 3b 00 00       	call   f01046ec <cprintf>
+		return 0; 
+f0100bce:	83 c4 10             	add    $0x10,%esp
+f0100bd1:	e9 1d ff ff ff       	jmp    f0100af3 <mon_dump+0x46>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100bd6:	56                   	push   %esi
+f0100bd7:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0100bdc:	68 22 01 00 00       	push   $0x122
+f0100be1:	68 5d b4 10 f0       	push   $0xf010b45d
+f0100be6:	e8 55 f4 ff ff       	call   f0100040 <_panic>
+				cprintf("%08x:", la);
+f0100beb:	83 ec 08             	sub    $0x8,%esp
+f0100bee:	56                   	push   %esi
+f0100bef:	68 80 b4 10 f0       	push   $0xf010b480
+f0100bf4:	e8 f3 3a 00 00       	call   f01046ec <cprintf>
+f0100bf9:	83 c4 10             	add    $0x10,%esp
+		cprintf("  0x");
+f0100bfc:	83 ec 0c             	sub    $0xc,%esp
+f0100bff:	68 86 b4 10 f0       	push   $0xf010b486
+f0100c04:	e8 e3 3a 00 00       	call   f01046ec <cprintf>
+		cprintf("%08x", *(uintptr_t*)(la));
+f0100c09:	83 c4 08             	add    $0x8,%esp
+f0100c0c:	ff 36                	push   (%esi)
+f0100c0e:	68 1a c5 10 f0       	push   $0xf010c51a
+f0100c13:	e8 d4 3a 00 00       	call   f01046ec <cprintf>
+		la += 4;
+f0100c18:	83 c6 04             	add    $0x4,%esi
+	for(i = 0; i < size; i++) {
+f0100c1b:	83 c3 01             	add    $0x1,%ebx
+f0100c1e:	83 c4 10             	add    $0x10,%esp
+f0100c21:	39 df                	cmp    %ebx,%edi
+f0100c23:	0f 84 2c ff ff ff    	je     f0100b55 <mon_dump+0xa8>
+		if(i % 4 == 0) {	
+f0100c29:	f6 c3 03             	test   $0x3,%bl
+f0100c2c:	75 ce                	jne    f0100bfc <mon_dump+0x14f>
+			cprintf("\n0x");
+f0100c2e:	83 ec 0c             	sub    $0xc,%esp
+f0100c31:	68 7c b4 10 f0       	push   $0xf010b47c
+f0100c36:	e8 b1 3a 00 00       	call   f01046ec <cprintf>
+			if(flag == 'p')
+f0100c3b:	83 c4 10             	add    $0x10,%esp
+f0100c3e:	80 7d e7 70          	cmpb   $0x70,-0x19(%ebp)
+f0100c42:	75 a7                	jne    f0100beb <mon_dump+0x13e>
+	if ((uint32_t)kva < KERNBASE)
+f0100c44:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f0100c4a:	76 8a                	jbe    f0100bd6 <mon_dump+0x129>
+				cprintf("%08x:", PADDR((void*)la));
+f0100c4c:	83 ec 08             	sub    $0x8,%esp
+	return (physaddr_t)kva - KERNBASE;
+f0100c4f:	8d 86 00 00 00 10    	lea    0x10000000(%esi),%eax
+f0100c55:	50                   	push   %eax
+f0100c56:	68 80 b4 10 f0       	push   $0xf010b480
+f0100c5b:	e8 8c 3a 00 00       	call   f01046ec <cprintf>
+f0100c60:	83 c4 10             	add    $0x10,%esp
+f0100c63:	eb 97                	jmp    f0100bfc <mon_dump+0x14f>
+
+f0100c65 <showmappings>:
+{
+f0100c65:	55                   	push   %ebp
+f0100c66:	89 e5                	mov    %esp,%ebp
+f0100c68:	57                   	push   %edi
+f0100c69:	56                   	push   %esi
+f0100c6a:	53                   	push   %ebx
+f0100c6b:	83 ec 0c             	sub    $0xc,%esp
+f0100c6e:	8b 75 08             	mov    0x8(%ebp),%esi
+	while(lva <= uva) {
+f0100c71:	39 75 0c             	cmp    %esi,0xc(%ebp)
+f0100c74:	73 29                	jae    f0100c9f <showmappings+0x3a>
+}
+f0100c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100c79:	5b                   	pop    %ebx
+f0100c7a:	5e                   	pop    %esi
+f0100c7b:	5f                   	pop    %edi
+f0100c7c:	5d                   	pop    %ebp
+f0100c7d:	c3                   	ret
+			cprintf("not mapped\n");
+f0100c7e:	83 ec 0c             	sub    $0xc,%esp
+f0100c81:	68 96 b4 10 f0       	push   $0xf010b496
+f0100c86:	e8 61 3a 00 00       	call   f01046ec <cprintf>
+			lva += PGSIZE;
+f0100c8b:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+			continue;
+f0100c91:	83 c4 10             	add    $0x10,%esp
+	while(lva <= uva) {
+f0100c94:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0100c9a:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+f0100c9d:	72 d7                	jb     f0100c76 <showmappings+0x11>
+		cprintf("  0x%08x  ", lva);
+f0100c9f:	83 ec 08             	sub    $0x8,%esp
+f0100ca2:	56                   	push   %esi
+f0100ca3:	68 8b b4 10 f0       	push   $0xf010b48b
+f0100ca8:	e8 3f 3a 00 00       	call   f01046ec <cprintf>
+		pte = pgdir_walk(kern_pgdir, (void*)lva, 0);
+f0100cad:	83 c4 0c             	add    $0xc,%esp
+f0100cb0:	6a 00                	push   $0x0
+f0100cb2:	56                   	push   %esi
+f0100cb3:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0100cb9:	e8 77 0c 00 00       	call   f0101935 <pgdir_walk>
+f0100cbe:	89 c3                	mov    %eax,%ebx
+		if(pte == NULL || !(*pte & PTE_P)) {
+f0100cc0:	83 c4 10             	add    $0x10,%esp
+f0100cc3:	85 c0                	test   %eax,%eax
+f0100cc5:	74 b7                	je     f0100c7e <showmappings+0x19>
+f0100cc7:	8b 00                	mov    (%eax),%eax
+f0100cc9:	a8 01                	test   $0x1,%al
+f0100ccb:	74 b1                	je     f0100c7e <showmappings+0x19>
+		lva += PGSIZE;
+f0100ccd:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+		cprintf("  0x%08x", PTE_ADDR(*pte));
+f0100cd3:	83 ec 08             	sub    $0x8,%esp
+f0100cd6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100cdb:	50                   	push   %eax
+f0100cdc:	68 16 c5 10 f0       	push   $0xf010c516
+f0100ce1:	e8 06 3a 00 00       	call   f01046ec <cprintf>
+		if(*pte & PTE_G) 
+f0100ce6:	83 c4 10             	add    $0x10,%esp
+f0100ce9:	f7 03 00 01 00 00    	testl  $0x100,(%ebx)
+f0100cef:	0f 84 dd 00 00 00    	je     f0100dd2 <showmappings+0x16d>
+			cprintf("  G");
+f0100cf5:	83 ec 0c             	sub    $0xc,%esp
+f0100cf8:	68 a2 b4 10 f0       	push   $0xf010b4a2
+f0100cfd:	e8 ea 39 00 00       	call   f01046ec <cprintf>
+f0100d02:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_PS) 
+f0100d05:	f6 03 80             	testb  $0x80,(%ebx)
+f0100d08:	0f 84 d9 00 00 00    	je     f0100de7 <showmappings+0x182>
+			cprintf("S");
+f0100d0e:	83 ec 0c             	sub    $0xc,%esp
+f0100d11:	68 a2 c6 10 f0       	push   $0xf010c6a2
+f0100d16:	e8 d1 39 00 00       	call   f01046ec <cprintf>
+f0100d1b:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_D) 
+f0100d1e:	f6 03 40             	testb  $0x40,(%ebx)
+f0100d21:	0f 84 d5 00 00 00    	je     f0100dfc <showmappings+0x197>
+			cprintf("D");
+f0100d27:	83 ec 0c             	sub    $0xc,%esp
+f0100d2a:	68 aa b4 10 f0       	push   $0xf010b4aa
+f0100d2f:	e8 b8 39 00 00       	call   f01046ec <cprintf>
+f0100d34:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_A) 
+f0100d37:	f6 03 20             	testb  $0x20,(%ebx)
+f0100d3a:	0f 84 d1 00 00 00    	je     f0100e11 <showmappings+0x1ac>
+			cprintf("A");
+f0100d40:	83 ec 0c             	sub    $0xc,%esp
+f0100d43:	68 ac b4 10 f0       	push   $0xf010b4ac
+f0100d48:	e8 9f 39 00 00       	call   f01046ec <cprintf>
+f0100d4d:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_PCD) 
+f0100d50:	f6 03 10             	testb  $0x10,(%ebx)
+f0100d53:	0f 84 cd 00 00 00    	je     f0100e26 <showmappings+0x1c1>
+			cprintf("C");
+f0100d59:	83 ec 0c             	sub    $0xc,%esp
+f0100d5c:	68 ae b4 10 f0       	push   $0xf010b4ae
+f0100d61:	e8 86 39 00 00       	call   f01046ec <cprintf>
+f0100d66:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_PWT) 
+f0100d69:	f6 03 08             	testb  $0x8,(%ebx)
+f0100d6c:	0f 84 c9 00 00 00    	je     f0100e3b <showmappings+0x1d6>
+			cprintf("T");
+f0100d72:	83 ec 0c             	sub    $0xc,%esp
+f0100d75:	68 b0 b4 10 f0       	push   $0xf010b4b0
+f0100d7a:	e8 6d 39 00 00       	call   f01046ec <cprintf>
+f0100d7f:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_U) 
+f0100d82:	f6 03 04             	testb  $0x4,(%ebx)
+f0100d85:	0f 84 c5 00 00 00    	je     f0100e50 <showmappings+0x1eb>
+			cprintf("U");
+f0100d8b:	83 ec 0c             	sub    $0xc,%esp
+f0100d8e:	68 10 bb 10 f0       	push   $0xf010bb10
+f0100d93:	e8 54 39 00 00       	call   f01046ec <cprintf>
+f0100d98:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_W) 
+f0100d9b:	f6 03 02             	testb  $0x2,(%ebx)
+f0100d9e:	0f 84 c1 00 00 00    	je     f0100e65 <showmappings+0x200>
+			cprintf("W");
+f0100da4:	83 ec 0c             	sub    $0xc,%esp
+f0100da7:	68 c8 bb 10 f0       	push   $0xf010bbc8
+f0100dac:	e8 3b 39 00 00       	call   f01046ec <cprintf>
+f0100db1:	83 c4 10             	add    $0x10,%esp
+		if(*pte & PTE_P)	
+f0100db4:	f6 03 01             	testb  $0x1,(%ebx)
+f0100db7:	0f 84 bd 00 00 00    	je     f0100e7a <showmappings+0x215>
+			cprintf("P\n");
+f0100dbd:	83 ec 0c             	sub    $0xc,%esp
+f0100dc0:	68 b2 b4 10 f0       	push   $0xf010b4b2
+f0100dc5:	e8 22 39 00 00       	call   f01046ec <cprintf>
+f0100dca:	83 c4 10             	add    $0x10,%esp
+f0100dcd:	e9 c2 fe ff ff       	jmp    f0100c94 <showmappings+0x2f>
+			cprintf("  -");
+f0100dd2:	83 ec 0c             	sub    $0xc,%esp
+f0100dd5:	68 a6 b4 10 f0       	push   $0xf010b4a6
+f0100dda:	e8 0d 39 00 00       	call   f01046ec <cprintf>
+f0100ddf:	83 c4 10             	add    $0x10,%esp
+f0100de2:	e9 1e ff ff ff       	jmp    f0100d05 <showmappings+0xa0>
+			cprintf("-");
+f0100de7:	83 ec 0c             	sub    $0xc,%esp
+f0100dea:	68 a8 b4 10 f0       	push   $0xf010b4a8
+f0100def:	e8 f8 38 00 00       	call   f01046ec <cprintf>
+f0100df4:	83 c4 10             	add    $0x10,%esp
+f0100df7:	e9 22 ff ff ff       	jmp    f0100d1e <showmappings+0xb9>
+			cprintf("-");
+f0100dfc:	83 ec 0c             	sub    $0xc,%esp
+f0100dff:	68 a8 b4 10 f0       	push   $0xf010b4a8
+f0100e04:	e8 e3 38 00 00       	call   f01046ec <cprintf>
+f0100e09:	83 c4 10             	add    $0x10,%esp
+f0100e0c:	e9 26 ff ff ff       	jmp    f0100d37 <showmappings+0xd2>
+			cprintf("-");
+f0100e11:	83 ec 0c             	sub    $0xc,%esp
+f0100e14:	68 a8 b4 10 f0       	push   $0xf010b4a8
+f0100e19:	e8 ce 38 00 00       	call   f01046ec <cprintf>
+f0100e1e:	83 c4 10             	add    $0x10,%esp
+f0100e21:	e9 2a ff ff ff       	jmp    f0100d50 <showmappings+0xeb>
+			cprintf("-");
+f0100e26:	83 ec 0c             	sub    $0xc,%esp
+f0100e29:	68 a8 b4 10 f0       	push   $0xf010b4a8
+f0100e2e:	e8 b9 38 00 00       	call   f01046ec <cprintf>
+f0100e33:	83 c4 10             	add    $0x10,%esp
+f0100e36:	e9 2e ff ff ff       	jmp    f0100d69 <showmappings+0x104>
+			cprintf("-");
+f0100e3b:	83 ec 0c             	sub    $0xc,%esp
+f0100e3e:	68 a8 b4 10 f0       	push   $0xf010b4a8
+f0100e43:	e8 a4 38 00 00       	call   f01046ec <cprintf>
+f0100e48:	83 c4 10             	add    $0x10,%esp
+f0100e4b:	e9 32 ff ff ff       	jmp    f0100d82 <showmappings+0x11d>
+			cprintf("-");
+f0100e50:	83 ec 0c             	sub    $0xc,%esp
+f0100e53:	68 a8 b4 10 f0       	push   $0xf010b4a8
+f0100e58:	e8 8f 38 00 00       	call   f01046ec <cprintf>
+f0100e5d:	83 c4 10             	add    $0x10,%esp
+f0100e60:	e9 36 ff ff ff       	jmp    f0100d9b <showmappings+0x136>
+			cprintf("-");
+f0100e65:	83 ec 0c             	sub    $0xc,%esp
+f0100e68:	68 a8 b4 10 f0       	push   $0xf010b4a8
+f0100e6d:	e8 7a 38 00 00       	call   f01046ec <cprintf>
+f0100e72:	83 c4 10             	add    $0x10,%esp
+f0100e75:	e9 3a ff ff ff       	jmp    f0100db4 <showmappings+0x14f>
+			cprintf("-\n");
+f0100e7a:	83 ec 0c             	sub    $0xc,%esp
+f0100e7d:	68 b5 b4 10 f0       	push   $0xf010b4b5
+f0100e82:	e8 65 38 00 00       	call   f01046ec <cprintf>
+f0100e87:	83 c4 10             	add    $0x10,%esp
+f0100e8a:	e9 05 fe ff ff       	jmp    f0100c94 <showmappings+0x2f>
+
+f0100e8f <mon_showmappings>:
+{
+f0100e8f:	55                   	push   %ebp
+f0100e90:	89 e5                	mov    %esp,%ebp
+f0100e92:	53                   	push   %ebx
+f0100e93:	83 ec 04             	sub    $0x4,%esp
+	if(argc != 3) {
+f0100e96:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0100e9a:	74 26                	je     f0100ec2 <mon_showmappings+0x33>
+		cprintf("Usage: showmappings LOWADDR, UPPERADDR\n");
+f0100e9c:	83 ec 0c             	sub    $0xc,%esp
+f0100e9f:	68 e4 b6 10 f0       	push   $0xf010b6e4
+f0100ea4:	e8 43 38 00 00       	call   f01046ec <cprintf>
+		cprintf("Both address must be aligned in 4KB\n");
+f0100ea9:	c7 04 24 0c b7 10 f0 	movl   $0xf010b70c,(%esp)
+f0100eb0:	e8 37 38 00 00       	call   f01046ec <cprintf>
+		return 0;
+f0100eb5:	83 c4 10             	add    $0x10,%esp
+}
+f0100eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100ebd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100ec0:	c9                   	leave
+f0100ec1:	c3                   	ret
+	uintptr_t lva = strtol(argv[1], 0, 0);
+f0100ec2:	83 ec 04             	sub    $0x4,%esp
+f0100ec5:	6a 00                	push   $0x0
+f0100ec7:	6a 00                	push   $0x0
+f0100ec9:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100ecc:	ff 70 04             	push   0x4(%eax)
+f0100ecf:	e8 e2 6e 00 00       	call   f0107db6 <strtol>
+f0100ed4:	89 c3                	mov    %eax,%ebx
+	uintptr_t uva = strtol(argv[2], 0, 0);
+f0100ed6:	83 c4 0c             	add    $0xc,%esp
+f0100ed9:	6a 00                	push   $0x0
+f0100edb:	6a 00                	push   $0x0
+f0100edd:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100ee0:	ff 70 08             	push   0x8(%eax)
+f0100ee3:	e8 ce 6e 00 00       	call   f0107db6 <strtol>
+	if(lva > uva)	{
+f0100ee8:	83 c4 10             	add    $0x10,%esp
+f0100eeb:	39 d8                	cmp    %ebx,%eax
+f0100eed:	72 0f                	jb     f0100efe <mon_showmappings+0x6f>
+	showmappings(lva, uva);
+f0100eef:	83 ec 08             	sub    $0x8,%esp
+f0100ef2:	50                   	push   %eax
+f0100ef3:	53                   	push   %ebx
+f0100ef4:	e8 6c fd ff ff       	call   f0100c65 <showmappings>
+	return 0;
+f0100ef9:	83 c4 10             	add    $0x10,%esp
+f0100efc:	eb ba                	jmp    f0100eb8 <mon_showmappings+0x29>
+		cprintf("LOWADDR must be less than UPPERADDR\n");
+f0100efe:	83 ec 0c             	sub    $0xc,%esp
+f0100f01:	68 34 b7 10 f0       	push   $0xf010b734
+f0100f06:	e8 e1 37 00 00       	call   f01046ec <cprintf>
+		return 0;
+f0100f0b:	83 c4 10             	add    $0x10,%esp
+f0100f0e:	eb a8                	jmp    f0100eb8 <mon_showmappings+0x29>
+
+f0100f10 <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f0100f10:	55                   	push   %ebp
+f0100f11:	89 e5                	mov    %esp,%ebp
+f0100f13:	57                   	push   %edi
+f0100f14:	56                   	push   %esi
+f0100f15:	53                   	push   %ebx
+f0100f16:	83 ec 58             	sub    $0x58,%esp
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f0100f19:	68 5c b7 10 f0       	push   $0xf010b75c
+f0100f1e:	e8 c9 37 00 00       	call   f01046ec <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f0100f23:	c7 04 24 80 b7 10 f0 	movl   $0xf010b780,(%esp)
+f0100f2a:	e8 bd 37 00 00       	call   f01046ec <cprintf>
+
+	if (tf != NULL)
+f0100f2f:	83 c4 10             	add    $0x10,%esp
+f0100f32:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0100f36:	0f 84 d8 00 00 00    	je     f0101014 <monitor+0x104>
+		print_trapframe(tf);
+f0100f3c:	83 ec 0c             	sub    $0xc,%esp
+f0100f3f:	ff 75 08             	push   0x8(%ebp)
+f0100f42:	e8 d8 3a 00 00       	call   f0104a1f <print_trapframe>
+f0100f47:	83 c4 10             	add    $0x10,%esp
+f0100f4a:	e9 c5 00 00 00       	jmp    f0101014 <monitor+0x104>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100f4f:	83 ec 08             	sub    $0x8,%esp
+f0100f52:	0f be c0             	movsbl %al,%eax
+f0100f55:	50                   	push   %eax
+f0100f56:	68 bc b4 10 f0       	push   $0xf010b4bc
+f0100f5b:	e8 e7 6c 00 00       	call   f0107c47 <strchr>
+f0100f60:	83 c4 10             	add    $0x10,%esp
+f0100f63:	85 c0                	test   %eax,%eax
+f0100f65:	74 0a                	je     f0100f71 <monitor+0x61>
+			*buf++ = 0;
+f0100f67:	c6 03 00             	movb   $0x0,(%ebx)
+f0100f6a:	89 f7                	mov    %esi,%edi
+f0100f6c:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0100f6f:	eb 3e                	jmp    f0100faf <monitor+0x9f>
+		if (*buf == 0)
+f0100f71:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0100f74:	74 42                	je     f0100fb8 <monitor+0xa8>
+		if (argc == MAXARGS-1) {
+f0100f76:	83 fe 0f             	cmp    $0xf,%esi
+f0100f79:	0f 84 83 00 00 00    	je     f0101002 <monitor+0xf2>
+		argv[argc++] = buf;
+f0100f7f:	8d 7e 01             	lea    0x1(%esi),%edi
+f0100f82:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100f86:	0f b6 03             	movzbl (%ebx),%eax
+f0100f89:	84 c0                	test   %al,%al
+f0100f8b:	74 22                	je     f0100faf <monitor+0x9f>
+f0100f8d:	83 ec 08             	sub    $0x8,%esp
+f0100f90:	0f be c0             	movsbl %al,%eax
+f0100f93:	50                   	push   %eax
+f0100f94:	68 bc b4 10 f0       	push   $0xf010b4bc
+f0100f99:	e8 a9 6c 00 00       	call   f0107c47 <strchr>
+f0100f9e:	83 c4 10             	add    $0x10,%esp
+f0100fa1:	85 c0                	test   %eax,%eax
+f0100fa3:	75 0a                	jne    f0100faf <monitor+0x9f>
+			buf++;
+f0100fa5:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100fa8:	0f b6 03             	movzbl (%ebx),%eax
+f0100fab:	84 c0                	test   %al,%al
+f0100fad:	75 de                	jne    f0100f8d <monitor+0x7d>
+			*buf++ = 0;
+f0100faf:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100fb1:	0f b6 03             	movzbl (%ebx),%eax
+f0100fb4:	84 c0                	test   %al,%al
+f0100fb6:	75 97                	jne    f0100f4f <monitor+0x3f>
+	argv[argc] = 0;
+f0100fb8:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f0100fbf:	00 
+	if (argc == 0)
+f0100fc0:	85 f6                	test   %esi,%esi
+f0100fc2:	74 50                	je     f0101014 <monitor+0x104>
+	for (i = 0; i < NCOMMANDS; i++) {
+f0100fc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+f0100fc9:	83 ec 08             	sub    $0x8,%esp
+f0100fcc:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100fcf:	ff 34 85 60 b8 10 f0 	push   -0xfef47a0(,%eax,4)
+f0100fd6:	ff 75 a8             	push   -0x58(%ebp)
+f0100fd9:	e8 f5 6b 00 00       	call   f0107bd3 <strcmp>
+f0100fde:	83 c4 10             	add    $0x10,%esp
+f0100fe1:	85 c0                	test   %eax,%eax
+f0100fe3:	74 56                	je     f010103b <monitor+0x12b>
+	for (i = 0; i < NCOMMANDS; i++) {
+f0100fe5:	83 c3 01             	add    $0x1,%ebx
+f0100fe8:	83 fb 06             	cmp    $0x6,%ebx
+f0100feb:	75 dc                	jne    f0100fc9 <monitor+0xb9>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f0100fed:	83 ec 08             	sub    $0x8,%esp
+f0100ff0:	ff 75 a8             	push   -0x58(%ebp)
+f0100ff3:	68 de b4 10 f0       	push   $0xf010b4de
+f0100ff8:	e8 ef 36 00 00       	call   f01046ec <cprintf>
+	return 0;
+f0100ffd:	83 c4 10             	add    $0x10,%esp
+f0101000:	eb 12                	jmp    f0101014 <monitor+0x104>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0101002:	83 ec 08             	sub    $0x8,%esp
+f0101005:	6a 10                	push   $0x10
+f0101007:	68 c1 b4 10 f0       	push   $0xf010b4c1
+f010100c:	e8 db 36 00 00       	call   f01046ec <cprintf>
+			return 0;
+f0101011:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		buf = readline("K> ");
+f0101014:	83 ec 0c             	sub    $0xc,%esp
+f0101017:	68 b8 b4 10 f0       	push   $0xf010b4b8
+f010101c:	e8 c8 69 00 00       	call   f01079e9 <readline>
+f0101021:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+f0101023:	83 c4 10             	add    $0x10,%esp
+f0101026:	85 c0                	test   %eax,%eax
+f0101028:	74 ea                	je     f0101014 <monitor+0x104>
+	argv[argc] = 0;
+f010102a:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f0101031:	be 00 00 00 00       	mov    $0x0,%esi
+f0101036:	e9 76 ff ff ff       	jmp    f0100fb1 <monitor+0xa1>
+			return commands[i].func(argc, argv, tf);
+f010103b:	83 ec 04             	sub    $0x4,%esp
+f010103e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0101041:	ff 75 08             	push   0x8(%ebp)
+f0101044:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0101047:	52                   	push   %edx
+f0101048:	56                   	push   %esi
+f0101049:	ff 14 85 68 b8 10 f0 	call   *-0xfef4798(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f0101050:	83 c4 10             	add    $0x10,%esp
+f0101053:	85 c0                	test   %eax,%eax
+f0101055:	79 bd                	jns    f0101014 <monitor+0x104>
+				break;
+	}
+}
+f0101057:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010105a:	5b                   	pop    %ebx
+f010105b:	5e                   	pop    %esi
+f010105c:	5f                   	pop    %edi
+f010105d:	5d                   	pop    %ebp
+f010105e:	c3                   	ret
+
+f010105f <read_eip>:
+// putting at the end of the file seems to prevent inlining.
+unsigned
+read_eip()
+{
+	uint32_t callerpc;
+	__asm __volatile("movl 4(%%ebp), %0" : "=r" (callerpc));
+f010105f:	8b 45 04             	mov    0x4(%ebp),%eax
+	return callerpc;
+}
+f0101062:	c3                   	ret
+
+f0101063 <rmap_remove>:
+//
+// Forget the mapping of 'pp' at 'va' in page table 'pt', if it was recorded.
+//
+static void
+rmap_remove(struct Page *pp, struct Page *pt, const void *va)
+{
+f0101063:	55                   	push   %ebp
+f0101064:	89 e5                	mov    %esp,%ebp
+f0101066:	53                   	push   %ebx
+	struct Rmap **prm, *rm;
+
+	va = ROUNDDOWN(va, PGSIZE);
+f0101067:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (prm = &pp->pp_rmap; (rm = *prm) != NULL; prm = &rm->rm_next)
+f010106d:	8d 58 08             	lea    0x8(%eax),%ebx
+f0101070:	8b 40 08             	mov    0x8(%eax),%eax
+f0101073:	85 c0                	test   %eax,%eax
+f0101075:	75 0a                	jne    f0101081 <rmap_remove+0x1e>
+f0101077:	eb 23                	jmp    f010109c <rmap_remove+0x39>
+f0101079:	89 c3                	mov    %eax,%ebx
+f010107b:	8b 00                	mov    (%eax),%eax
+f010107d:	85 c0                	test   %eax,%eax
+f010107f:	74 1b                	je     f010109c <rmap_remove+0x39>
+		if (rm->rm_pt == pt && rm->rm_va == (uintptr_t) va) {
+f0101081:	39 50 04             	cmp    %edx,0x4(%eax)
+f0101084:	75 f3                	jne    f0101079 <rmap_remove+0x16>
+f0101086:	3b 48 08             	cmp    0x8(%eax),%ecx
+f0101089:	75 ee                	jne    f0101079 <rmap_remove+0x16>
+			*prm = rm->rm_next;
+f010108b:	8b 10                	mov    (%eax),%edx
+f010108d:	89 13                	mov    %edx,(%ebx)
+			rm->rm_next = rmap_free_list;
+f010108f:	8b 15 44 c2 92 f0    	mov    0xf092c244,%edx
+f0101095:	89 10                	mov    %edx,(%eax)
+			rmap_free_list = rm;
+f0101097:	a3 44 c2 92 f0       	mov    %eax,0xf092c244
+			return;
+		}
+}
+f010109c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010109f:	c9                   	leave
+f01010a0:	c3                   	ret
+
+f01010a1 <boot_alloc>:
+	if (!nextfree) {
+f01010a1:	83 3d 38 c2 92 f0 00 	cmpl   $0x0,0xf092c238
+f01010a8:	74 2b                	je     f01010d5 <boot_alloc+0x34>
+		return nextfree;
+f01010aa:	8b 15 38 c2 92 f0    	mov    0xf092c238,%edx
+	if(n == 0) 
+f01010b0:	85 c0                	test   %eax,%eax
+f01010b2:	74 1e                	je     f01010d2 <boot_alloc+0x31>
+    if((uint32_t)(nextfree + n) > KERNBASE + PTSIZE)
+f01010b4:	8b 15 38 c2 92 f0    	mov    0xf092c238,%edx
+f01010ba:	01 d0                	add    %edx,%eax
+f01010bc:	3d 00 00 40 f0       	cmp    $0xf0400000,%eax
+f01010c1:	77 25                	ja     f01010e8 <boot_alloc+0x47>
+		nextfree = ROUNDUP(nextfree, PGSIZE);
+f01010c3:	05 ff 0f 00 00       	add    $0xfff,%eax
+f01010c8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01010cd:	a3 38 c2 92 f0       	mov    %eax,0xf092c238
+}
+f01010d2:	89 d0                	mov    %edx,%eax
+f01010d4:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f01010d5:	ba ab 24 97 f0       	mov    $0xf09724ab,%edx
+f01010da:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01010e0:	89 15 38 c2 92 f0    	mov    %edx,0xf092c238
+f01010e6:	eb c2                	jmp    f01010aa <boot_alloc+0x9>
+{
+f01010e8:	55                   	push   %ebp
+f01010e9:	89 e5                	mov    %esp,%ebp
+f01010eb:	83 ec 0c             	sub    $0xc,%esp
+		panic("boo_alloc: out of memory\n");
+f01010ee:	68 a8 b8 10 f0       	push   $0xf010b8a8
+f01010f3:	6a 6f                	push   $0x6f
+f01010f5:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01010fa:	e8 41 ef ff ff       	call   f0100040 <_panic>
+
+f01010ff <check_va2pa>:
+static physaddr_t
+check_va2pa(pde_t *pgdir, uintptr_t va)
+{
+	pte_t *p;
+
+	pgdir = &pgdir[PDX(va)];
+f01010ff:	89 d1                	mov    %edx,%ecx
+f0101101:	c1 e9 16             	shr    $0x16,%ecx
+	if (!(*pgdir & PTE_P))
+f0101104:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0101107:	a8 01                	test   $0x1,%al
+f0101109:	74 51                	je     f010115c <check_va2pa+0x5d>
+		return ~0;
+	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
+f010110b:	89 c1                	mov    %eax,%ecx
+f010110d:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages)
+f0101113:	c1 e8 0c             	shr    $0xc,%eax
+f0101116:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f010111c:	73 23                	jae    f0101141 <check_va2pa+0x42>
+	if (!(p[PTX(va)] & PTE_P))
+f010111e:	c1 ea 0c             	shr    $0xc,%edx
+f0101121:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0101127:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+		return ~0;
+	return PTE_ADDR(p[PTX(va)]);
+f010112e:	89 d0                	mov    %edx,%eax
+f0101130:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101135:	f6 c2 01             	test   $0x1,%dl
+f0101138:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f010113d:	0f 44 c2             	cmove  %edx,%eax
+f0101140:	c3                   	ret
+{
+f0101141:	55                   	push   %ebp
+f0101142:	89 e5                	mov    %esp,%ebp
+f0101144:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101147:	51                   	push   %ecx
+f0101148:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f010114d:	68 a3 04 00 00       	push   $0x4a3
+f0101152:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101157:	e8 e4 ee ff ff       	call   f0100040 <_panic>
+		return ~0;
+f010115c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0101161:	c3                   	ret
+
+f0101162 <pgdir_pt>:
+	if (!(pgdir[PDX(va)] & PTE_P))
+f0101162:	c1 ea 16             	shr    $0x16,%edx
+f0101165:	8b 04 90             	mov    (%eax,%edx,4),%eax
+f0101168:	a8 01                	test   $0x1,%al
+f010116a:	74 2c                	je     f0101198 <pgdir_pt+0x36>
+}
+
+static inline struct Page*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f010116c:	c1 e8 0c             	shr    $0xc,%eax
+f010116f:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101175:	73 0a                	jae    f0101181 <pgdir_pt+0x1f>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f0101177:	c1 e0 04             	shl    $0x4,%eax
+f010117a:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+	return pa2page(PTE_ADDR(pgdir[PDX(va)]));
+f0101180:	c3                   	ret
+{
+f0101181:	55                   	push   %ebp
+f0101182:	89 e5                	mov    %esp,%ebp
+f0101184:	83 ec 0c             	sub    $0xc,%esp
+		panic("pa2page called with invalid pa");
+f0101187:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f010118c:	6a 67                	push   $0x67
+f010118e:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101193:	e8 a8 ee ff ff       	call   f0100040 <_panic>
+		return NULL;
+f0101198:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010119d:	c3                   	ret
+
+f010119e <rmap_pte>:
+	return (pp - pages) << PGSHIFT;
+f010119e:	8b 50 04             	mov    0x4(%eax),%edx
+f01011a1:	2b 15 f4 f3 92 f0    	sub    0xf092f3f4,%edx
+f01011a7:	c1 fa 04             	sar    $0x4,%edx
+f01011aa:	89 d1                	mov    %edx,%ecx
+f01011ac:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01011af:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f01011b5:	3b 15 ec f3 92 f0    	cmp    0xf092f3ec,%edx
+f01011bb:	73 13                	jae    f01011d0 <rmap_pte+0x32>
+	return (pte_t *) page2kva(rm->rm_pt) + PTX(rm->rm_va);
+f01011bd:	8b 40 08             	mov    0x8(%eax),%eax
+f01011c0:	c1 e8 0a             	shr    $0xa,%eax
+f01011c3:	25 fc 0f 00 00       	and    $0xffc,%eax
+f01011c8:	8d 84 01 00 00 00 f0 	lea    -0x10000000(%ecx,%eax,1),%eax
+}
+f01011cf:	c3                   	ret
+{
+f01011d0:	55                   	push   %ebp
+f01011d1:	89 e5                	mov    %esp,%ebp
+f01011d3:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01011d6:	51                   	push   %ecx
+f01011d7:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01011dc:	6a 6e                	push   $0x6e
+f01011de:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01011e3:	e8 58 ee ff ff       	call   f0100040 <_panic>
+
+f01011e8 <check_page_free_list>:
+{
+f01011e8:	55                   	push   %ebp
+f01011e9:	89 e5                	mov    %esp,%ebp
+f01011eb:	57                   	push   %edi
+f01011ec:	56                   	push   %esi
+f01011ed:	53                   	push   %ebx
+f01011ee:	83 ec 2c             	sub    $0x2c,%esp
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f01011f1:	85 c0                	test   %eax,%eax
+f01011f3:	0f 85 89 02 00 00    	jne    f0101482 <check_page_free_list+0x29a>
+	if (!page_free_list)
+f01011f9:	83 3d 48 c2 92 f0 00 	cmpl   $0x0,0xf092c248
+f0101200:	74 0d                	je     f010120f <check_page_free_list+0x27>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101202:	8b 1d 48 c2 92 f0    	mov    0xf092c248,%ebx
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0101208:	be 00 04 00 00       	mov    $0x400,%esi
+f010120d:	eb 2f                	jmp    f010123e <check_page_free_list+0x56>
+		panic("'page_free_list' is a null pointer!");
+f010120f:	83 ec 04             	sub    $0x4,%esp
+f0101212:	68 f8 bb 10 f0       	push   $0xf010bbf8
+f0101217:	68 d4 03 00 00       	push   $0x3d4
+f010121c:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101221:	e8 1a ee ff ff       	call   f0100040 <_panic>
+f0101226:	50                   	push   %eax
+f0101227:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f010122c:	6a 6e                	push   $0x6e
+f010122e:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101233:	e8 08 ee ff ff       	call   f0100040 <_panic>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101238:	8b 1b                	mov    (%ebx),%ebx
+f010123a:	85 db                	test   %ebx,%ebx
+f010123c:	74 41                	je     f010127f <check_page_free_list+0x97>
+	return (pp - pages) << PGSHIFT;
+f010123e:	89 d8                	mov    %ebx,%eax
+f0101240:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0101246:	c1 f8 04             	sar    $0x4,%eax
+f0101249:	c1 e0 0c             	shl    $0xc,%eax
+		if (PDX(page2pa(pp)) < pdx_limit)
+f010124c:	89 c2                	mov    %eax,%edx
+f010124e:	c1 ea 16             	shr    $0x16,%edx
+f0101251:	39 f2                	cmp    %esi,%edx
+f0101253:	73 e3                	jae    f0101238 <check_page_free_list+0x50>
+	if (PGNUM(pa) >= npages)
+f0101255:	89 c2                	mov    %eax,%edx
+f0101257:	c1 ea 0c             	shr    $0xc,%edx
+f010125a:	3b 15 ec f3 92 f0    	cmp    0xf092f3ec,%edx
+f0101260:	73 c4                	jae    f0101226 <check_page_free_list+0x3e>
+			memset(page2kva(pp), 0x97, 128);
+f0101262:	83 ec 04             	sub    $0x4,%esp
+f0101265:	68 80 00 00 00       	push   $0x80
+f010126a:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f010126f:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0101274:	50                   	push   %eax
+f0101275:	e8 24 6a 00 00       	call   f0107c9e <memset>
+f010127a:	83 c4 10             	add    $0x10,%esp
+f010127d:	eb b9                	jmp    f0101238 <check_page_free_list+0x50>
+	first_free_page = (char *) boot_alloc(0);
+f010127f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101284:	e8 18 fe ff ff       	call   f01010a1 <boot_alloc>
+f0101289:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f010128c:	8b 15 48 c2 92 f0    	mov    0xf092c248,%edx
+f0101292:	85 d2                	test   %edx,%edx
+f0101294:	0f 84 b6 01 00 00    	je     f0101450 <check_page_free_list+0x268>
+		assert(pp >= pages);
+f010129a:	8b 0d f4 f3 92 f0    	mov    0xf092f3f4,%ecx
+		assert(pp < pages + npages);
+f01012a0:	a1 ec f3 92 f0       	mov    0xf092f3ec,%eax
+f01012a5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01012a8:	89 c3                	mov    %eax,%ebx
+f01012aa:	c1 e3 04             	shl    $0x4,%ebx
+f01012ad:	01 cb                	add    %ecx,%ebx
+	int nfree_basemem = 0, nfree_extmem = 0;
+f01012af:	bf 00 00 00 00       	mov    $0x0,%edi
+f01012b4:	be 00 00 00 00       	mov    $0x0,%esi
+f01012b9:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f01012bc:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f01012bf:	e9 02 01 00 00       	jmp    f01013c6 <check_page_free_list+0x1de>
+		assert(pp >= pages);
+f01012c4:	68 dc b8 10 f0       	push   $0xf010b8dc
+f01012c9:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01012ce:	68 ee 03 00 00       	push   $0x3ee
+f01012d3:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01012d8:	e8 63 ed ff ff       	call   f0100040 <_panic>
+		assert(pp < pages + npages);
+f01012dd:	68 fd b8 10 f0       	push   $0xf010b8fd
+f01012e2:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01012e7:	68 ef 03 00 00       	push   $0x3ef
+f01012ec:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01012f1:	e8 4a ed ff ff       	call   f0100040 <_panic>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f01012f6:	68 1c bc 10 f0       	push   $0xf010bc1c
+f01012fb:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0101300:	68 f0 03 00 00       	push   $0x3f0
+f0101305:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010130a:	e8 31 ed ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != 0);
+f010130f:	68 11 b9 10 f0       	push   $0xf010b911
+f0101314:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0101319:	68 f3 03 00 00       	push   $0x3f3
+f010131e:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101323:	e8 18 ed ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != IOPHYSMEM);
+f0101328:	68 22 b9 10 f0       	push   $0xf010b922
+f010132d:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0101332:	68 f4 03 00 00       	push   $0x3f4
+f0101337:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010133c:	e8 ff ec ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0101341:	68 50 bc 10 f0       	push   $0xf010bc50
+f0101346:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010134b:	68 f5 03 00 00       	push   $0x3f5
+f0101350:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101355:	e8 e6 ec ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f010135a:	68 3b b9 10 f0       	push   $0xf010b93b
+f010135f:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0101364:	68 f6 03 00 00       	push   $0x3f6
+f0101369:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010136e:	e8 cd ec ff ff       	call   f0100040 <_panic>
+	if (PGNUM(pa) >= npages)
+f0101373:	89 c6                	mov    %eax,%esi
+f0101375:	c1 ee 0c             	shr    $0xc,%esi
+f0101378:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f010137b:	39 fe                	cmp    %edi,%esi
+f010137d:	73 12                	jae    f0101391 <check_page_free_list+0x1a9>
+	return (void *)(pa + KERNBASE);
+f010137f:	2d 00 00 00 10       	sub    $0x10000000,%eax
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0101384:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0101387:	39 f8                	cmp    %edi,%eax
+f0101389:	72 18                	jb     f01013a3 <check_page_free_list+0x1bb>
+			++nfree_extmem;
+f010138b:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f010138f:	eb 2f                	jmp    f01013c0 <check_page_free_list+0x1d8>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101391:	50                   	push   %eax
+f0101392:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0101397:	6a 6e                	push   $0x6e
+f0101399:	68 ce b8 10 f0       	push   $0xf010b8ce
+f010139e:	e8 9d ec ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f01013a3:	68 74 bc 10 f0       	push   $0xf010bc74
+f01013a8:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01013ad:	68 f7 03 00 00       	push   $0x3f7
+f01013b2:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01013b7:	e8 84 ec ff ff       	call   f0100040 <_panic>
+			++nfree_basemem;
+f01013bc:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f01013c0:	8b 12                	mov    (%edx),%edx
+f01013c2:	85 d2                	test   %edx,%edx
+f01013c4:	74 74                	je     f010143a <check_page_free_list+0x252>
+		assert(pp >= pages);
+f01013c6:	39 ca                	cmp    %ecx,%edx
+f01013c8:	0f 82 f6 fe ff ff    	jb     f01012c4 <check_page_free_list+0xdc>
+		assert(pp < pages + npages);
+f01013ce:	39 da                	cmp    %ebx,%edx
+f01013d0:	0f 83 07 ff ff ff    	jae    f01012dd <check_page_free_list+0xf5>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f01013d6:	89 d0                	mov    %edx,%eax
+f01013d8:	29 c8                	sub    %ecx,%eax
+f01013da:	a8 0f                	test   $0xf,%al
+f01013dc:	0f 85 14 ff ff ff    	jne    f01012f6 <check_page_free_list+0x10e>
+	return (pp - pages) << PGSHIFT;
+f01013e2:	c1 f8 04             	sar    $0x4,%eax
+		assert(page2pa(pp) != 0);
+f01013e5:	c1 e0 0c             	shl    $0xc,%eax
+f01013e8:	0f 84 21 ff ff ff    	je     f010130f <check_page_free_list+0x127>
+		assert(page2pa(pp) != IOPHYSMEM);
+f01013ee:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f01013f3:	0f 84 2f ff ff ff    	je     f0101328 <check_page_free_list+0x140>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f01013f9:	3d 00 f0 0f 00       	cmp    $0xff000,%eax
+f01013fe:	0f 84 3d ff ff ff    	je     f0101341 <check_page_free_list+0x159>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f0101404:	3d 00 00 10 00       	cmp    $0x100000,%eax
+f0101409:	0f 84 4b ff ff ff    	je     f010135a <check_page_free_list+0x172>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f010140f:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+f0101414:	0f 87 59 ff ff ff    	ja     f0101373 <check_page_free_list+0x18b>
+		assert(page2pa(pp) != MPENTRY_PADDR);
+f010141a:	3d 00 70 00 00       	cmp    $0x7000,%eax
+f010141f:	75 9b                	jne    f01013bc <check_page_free_list+0x1d4>
+f0101421:	68 55 b9 10 f0       	push   $0xf010b955
+f0101426:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010142b:	68 f9 03 00 00       	push   $0x3f9
+f0101430:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101435:	e8 06 ec ff ff       	call   f0100040 <_panic>
+	assert(nfree_basemem > 0);
+f010143a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f010143d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0101440:	85 f6                	test   %esi,%esi
+f0101442:	7e 0c                	jle    f0101450 <check_page_free_list+0x268>
+	assert(nfree_extmem > 0);
+f0101444:	85 ff                	test   %edi,%edi
+f0101446:	7e 21                	jle    f0101469 <check_page_free_list+0x281>
+}
+f0101448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010144b:	5b                   	pop    %ebx
+f010144c:	5e                   	pop    %esi
+f010144d:	5f                   	pop    %edi
+f010144e:	5d                   	pop    %ebp
+f010144f:	c3                   	ret
+	assert(nfree_basemem > 0);
+f0101450:	68 72 b9 10 f0       	push   $0xf010b972
+f0101455:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010145a:	68 01 04 00 00       	push   $0x401
+f010145f:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101464:	e8 d7 eb ff ff       	call   f0100040 <_panic>
+	assert(nfree_extmem > 0);
+f0101469:	68 84 b9 10 f0       	push   $0xf010b984
+f010146e:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0101473:	68 02 04 00 00       	push   $0x402
+f0101478:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010147d:	e8 be eb ff ff       	call   f0100040 <_panic>
+	if (!page_free_list)
+f0101482:	a1 48 c2 92 f0       	mov    0xf092c248,%eax
+f0101487:	85 c0                	test   %eax,%eax
+f0101489:	0f 84 80 fd ff ff    	je     f010120f <check_page_free_list+0x27>
+		struct Page **tp[2] = { &pp1, &pp2 };
+f010148f:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0101492:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0101495:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0101498:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010149b:	89 c2                	mov    %eax,%edx
+f010149d:	2b 15 f4 f3 92 f0    	sub    0xf092f3f4,%edx
+			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
+f01014a3:	f7 c2 00 c0 ff 00    	test   $0xffc000,%edx
+f01014a9:	0f 95 c2             	setne  %dl
+f01014ac:	0f b6 d2             	movzbl %dl,%edx
+			*tp[pagetype] = pp;
+f01014af:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f01014b3:	89 01                	mov    %eax,(%ecx)
+			tp[pagetype] = &pp->pp_link;
+f01014b5:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+		for (pp = page_free_list; pp; pp = pp->pp_link) {
+f01014b9:	8b 00                	mov    (%eax),%eax
+f01014bb:	85 c0                	test   %eax,%eax
+f01014bd:	75 dc                	jne    f010149b <check_page_free_list+0x2b3>
+		*tp[1] = 0;
+f01014bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01014c2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		*tp[0] = pp2;
+f01014c8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01014cb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01014ce:	89 10                	mov    %edx,(%eax)
+		page_free_list = pp1;
+f01014d0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01014d3:	a3 48 c2 92 f0       	mov    %eax,0xf092c248
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f01014d8:	89 c3                	mov    %eax,%ebx
+f01014da:	85 c0                	test   %eax,%eax
+f01014dc:	0f 84 9d fd ff ff    	je     f010127f <check_page_free_list+0x97>
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f01014e2:	be 01 00 00 00       	mov    $0x1,%esi
+f01014e7:	e9 52 fd ff ff       	jmp    f010123e <check_page_free_list+0x56>
+
+f01014ec <page_init>:
+	for(i = 0; i < npages; i++) {
+f01014ec:	83 3d ec f3 92 f0 00 	cmpl   $0x0,0xf092f3ec
+f01014f3:	0f 84 3a 01 00 00    	je     f0101633 <page_init+0x147>
+{
+f01014f9:	55                   	push   %ebp
+f01014fa:	89 e5                	mov    %esp,%ebp
+f01014fc:	57                   	push   %edi
+f01014fd:	56                   	push   %esi
+f01014fe:	53                   	push   %ebx
+f01014ff:	83 ec 1c             	sub    $0x1c,%esp
+		if(i < (PADDR(ROUNDUP((char*) end, PGSIZE)) / PGSIZE)) {
+f0101502:	b8 ab 24 97 f0       	mov    $0xf09724ab,%eax
+f0101507:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f010150c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f010150f:	8d b8 00 00 00 10    	lea    0x10000000(%eax),%edi
+f0101515:	c1 ef 0c             	shr    $0xc,%edi
+f0101518:	be 00 00 00 00       	mov    $0x0,%esi
+	for(i = 0; i < npages; i++) {
+f010151d:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101522:	eb 1e                	jmp    f0101542 <page_init+0x56>
+			pages[i].pp_ref = 0;
+f0101524:	a1 f4 f3 92 f0       	mov    0xf092f3f4,%eax
+f0101529:	66 c7 44 30 04 00 00 	movw   $0x0,0x4(%eax,%esi,1)
+	for(i = 0; i < npages; i++) {
+f0101530:	83 c3 01             	add    $0x1,%ebx
+f0101533:	83 c6 10             	add    $0x10,%esi
+f0101536:	3b 1d ec f3 92 f0    	cmp    0xf092f3ec,%ebx
+f010153c:	0f 83 e9 00 00 00    	jae    f010162b <page_init+0x13f>
+		if(i == 0 || i == MPENTRY_PADDR / PGSIZE ) {
+f0101542:	85 db                	test   %ebx,%ebx
+f0101544:	74 de                	je     f0101524 <page_init+0x38>
+f0101546:	83 fb 07             	cmp    $0x7,%ebx
+f0101549:	74 d9                	je     f0101524 <page_init+0x38>
+		if(i < IOPHYSMEM / PGSIZE) {
+f010154b:	81 fb 9f 00 00 00    	cmp    $0x9f,%ebx
+f0101551:	76 23                	jbe    f0101576 <page_init+0x8a>
+		if(i < EXTPHYSMEM / PGSIZE) {
+f0101553:	81 fb ff 00 00 00    	cmp    $0xff,%ebx
+f0101559:	76 40                	jbe    f010159b <page_init+0xaf>
+	if ((uint32_t)kva < KERNBASE)
+f010155b:	81 7d e4 ff ff ff ef 	cmpl   $0xefffffff,-0x1c(%ebp)
+f0101562:	76 45                	jbe    f01015a9 <page_init+0xbd>
+		if(i < (PADDR(ROUNDUP((char*) end, PGSIZE)) / PGSIZE)) {
+f0101564:	39 fb                	cmp    %edi,%ebx
+f0101566:	73 58                	jae    f01015c0 <page_init+0xd4>
+			pages[i].pp_ref = 0;
+f0101568:	a1 f4 f3 92 f0       	mov    0xf092f3f4,%eax
+f010156d:	66 c7 44 30 04 00 00 	movw   $0x0,0x4(%eax,%esi,1)
+			continue;
+f0101574:	eb ba                	jmp    f0101530 <page_init+0x44>
+			pages[i].pp_ref = 0;
+f0101576:	89 f0                	mov    %esi,%eax
+f0101578:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+f010157e:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+			pages[i].pp_link = page_free_list;
+f0101584:	8b 15 48 c2 92 f0    	mov    0xf092c248,%edx
+f010158a:	89 10                	mov    %edx,(%eax)
+			page_free_list = &pages[i];
+f010158c:	89 f0                	mov    %esi,%eax
+f010158e:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+f0101594:	a3 48 c2 92 f0       	mov    %eax,0xf092c248
+			continue;
+f0101599:	eb 95                	jmp    f0101530 <page_init+0x44>
+			pages[i].pp_ref = 0;
+f010159b:	a1 f4 f3 92 f0       	mov    0xf092f3f4,%eax
+f01015a0:	66 c7 44 30 04 00 00 	movw   $0x0,0x4(%eax,%esi,1)
+			continue;
+f01015a7:	eb 87                	jmp    f0101530 <page_init+0x44>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01015a9:	ff 75 e4             	push   -0x1c(%ebp)
+f01015ac:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01015b1:	68 71 01 00 00       	push   $0x171
+f01015b6:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01015bb:	e8 80 ea ff ff       	call   f0100040 <_panic>
+		if(i < PADDR(boot_alloc(0))/ PGSIZE) {
+f01015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+f01015c5:	e8 d7 fa ff ff       	call   f01010a1 <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f01015ca:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01015cf:	76 34                	jbe    f0101605 <page_init+0x119>
+	return (physaddr_t)kva - KERNBASE;
+f01015d1:	05 00 00 00 10       	add    $0x10000000,%eax
+f01015d6:	c1 e8 0c             	shr    $0xc,%eax
+f01015d9:	39 c3                	cmp    %eax,%ebx
+f01015db:	72 3d                	jb     f010161a <page_init+0x12e>
+		pages[i].pp_ref = 0;
+f01015dd:	89 f0                	mov    %esi,%eax
+f01015df:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+f01015e5:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+		pages[i].pp_link = page_free_list;
+f01015eb:	8b 15 48 c2 92 f0    	mov    0xf092c248,%edx
+f01015f1:	89 10                	mov    %edx,(%eax)
+		page_free_list = &pages[i];
+f01015f3:	89 f0                	mov    %esi,%eax
+f01015f5:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+f01015fb:	a3 48 c2 92 f0       	mov    %eax,0xf092c248
+f0101600:	e9 2b ff ff ff       	jmp    f0101530 <page_init+0x44>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101605:	50                   	push   %eax
+f0101606:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f010160b:	68 75 01 00 00       	push   $0x175
+f0101610:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101615:	e8 26 ea ff ff       	call   f0100040 <_panic>
+			pages[i].pp_ref = 0;
+f010161a:	a1 f4 f3 92 f0       	mov    0xf092f3f4,%eax
+f010161f:	66 c7 44 30 04 00 00 	movw   $0x0,0x4(%eax,%esi,1)
+			continue;
+f0101626:	e9 05 ff ff ff       	jmp    f0101530 <page_init+0x44>
+}
+f010162b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010162e:	5b                   	pop    %ebx
+f010162f:	5e                   	pop    %esi
+f0101630:	5f                   	pop    %edi
+f0101631:	5d                   	pop    %ebp
+f0101632:	c3                   	ret
+f0101633:	c3                   	ret
+
+f0101634 <page_free>:
+{
+f0101634:	55                   	push   %ebp
+f0101635:	89 e5                	mov    %esp,%ebp
+f0101637:	83 ec 08             	sub    $0x8,%esp
+f010163a:	8b 45 08             	mov    0x8(%ebp),%eax
+	assert(pp->pp_ref == 0);
+f010163d:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f0101642:	75 18                	jne    f010165c <page_free+0x28>
+	pp->pp_free_round = tlb_round;
+f0101644:	8b 15 04 10 97 f0    	mov    0xf0971004,%edx
+f010164a:	89 50 0c             	mov    %edx,0xc(%eax)
+	pp->pp_link = page_free_list;
+f010164d:	8b 15 48 c2 92 f0    	mov    0xf092c248,%edx
+f0101653:	89 10                	mov    %edx,(%eax)
+	page_free_list = pp;
+f0101655:	a3 48 c2 92 f0       	mov    %eax,0xf092c248
+}
+f010165a:	c9                   	leave
+f010165b:	c3                   	ret
+	assert(pp->pp_ref == 0);
+f010165c:	68 95 b9 10 f0       	push   $0xf010b995
+f0101661:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0101666:	68 a8 01 00 00       	push   $0x1a8
+f010166b:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101670:	e8 cb e9 ff ff       	call   f0100040 <_panic>
+
+f0101675 <page_decref>:
+{
+f0101675:	55                   	push   %ebp
+f0101676:	89 e5                	mov    %esp,%ebp
+f0101678:	53                   	push   %ebx
+f0101679:	83 ec 04             	sub    $0x4,%esp
+f010167c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (futex_nwait)
+f010167f:	83 3d a8 14 97 f0 00 	cmpl   $0x0,0xf09714a8
+f0101686:	75 15                	jne    f010169d <page_decref+0x28>
+	if (--pp->pp_ref == 0)
+f0101688:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+f010168c:	83 e8 01             	sub    $0x1,%eax
+f010168f:	66 89 43 04          	mov    %ax,0x4(%ebx)
+f0101693:	66 85 c0             	test   %ax,%ax
+f0101696:	74 21                	je     f01016b9 <page_decref+0x44>
+}
+f0101698:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010169b:	c9                   	leave
+f010169c:	c3                   	ret
+		futex_wake_page(page2pa(pp));
+f010169d:	83 ec 0c             	sub    $0xc,%esp
+	return (pp - pages) << PGSHIFT;
+f01016a0:	89 d8                	mov    %ebx,%eax
+f01016a2:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01016a8:	c1 f8 04             	sar    $0x4,%eax
+f01016ab:	c1 e0 0c             	shl    $0xc,%eax
+f01016ae:	50                   	push   %eax
+f01016af:	e8 fd 96 00 00       	call   f010adb1 <futex_wake_page>
+f01016b4:	83 c4 10             	add    $0x10,%esp
+f01016b7:	eb cf                	jmp    f0101688 <page_decref+0x13>
+		page_free(pp);
+f01016b9:	83 ec 0c             	sub    $0xc,%esp
+f01016bc:	53                   	push   %ebx
+f01016bd:	e8 72 ff ff ff       	call   f0101634 <page_free>
+f01016c2:	83 c4 10             	add    $0x10,%esp
+}
+f01016c5:	eb d1                	jmp    f0101698 <page_decref+0x23>
+
+f01016c7 <page_reclaim>:
+{
+f01016c7:	55                   	push   %ebp
+f01016c8:	89 e5                	mov    %esp,%ebp
+f01016ca:	57                   	push   %edi
+f01016cb:	56                   	push   %esi
+f01016cc:	53                   	push   %ebx
+f01016cd:	83 ec 2c             	sub    $0x2c,%esp
+	for (i = 0; i < NENV; i++)
+f01016d0:	a1 50 c2 92 f0       	mov    0xf092c250,%eax
+f01016d5:	8d 88 00 f0 02 00    	lea    0x2f000(%eax),%ecx
+	struct Env *fsenv = NULL;
+f01016db:	bf 00 00 00 00       	mov    $0x0,%edi
+f01016e0:	eb 09                	jmp    f01016eb <page_reclaim+0x24>
+	for (i = 0; i < NENV; i++)
+f01016e2:	05 bc 00 00 00       	add    $0xbc,%eax
+f01016e7:	39 c8                	cmp    %ecx,%eax
+f01016e9:	74 0f                	je     f01016fa <page_reclaim+0x33>
+		if (envs[i].env_type == ENV_TYPE_FS
+f01016eb:	83 78 50 02          	cmpl   $0x2,0x50(%eax)
+f01016ef:	75 f1                	jne    f01016e2 <page_reclaim+0x1b>
+			fsenv = &envs[i];
+f01016f1:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f01016f5:	0f 43 f8             	cmovae %eax,%edi
+f01016f8:	eb e8                	jmp    f01016e2 <page_reclaim+0x1b>
+	if (!fsenv)
+f01016fa:	85 ff                	test   %edi,%edi
+f01016fc:	0f 84 2a 01 00 00    	je     f010182c <page_reclaim+0x165>
+	for (i = 0; i < 2 * npages && freed < n; i++) {
+f0101702:	8b 1d ec f3 92 f0    	mov    0xf092f3ec,%ebx
+f0101708:	89 d8                	mov    %ebx,%eax
+f010170a:	01 c0                	add    %eax,%eax
+f010170c:	0f 84 2c 01 00 00    	je     f010183e <page_reclaim+0x177>
+f0101712:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0101716:	0f 8e 22 01 00 00    	jle    f010183e <page_reclaim+0x177>
+	int i, nmap, accessed, freed = 0;
+f010171c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+	for (i = 0; i < 2 * npages && freed < n; i++) {
+f0101723:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+				accessed = 1;
+f010172a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f010172d:	e9 81 00 00 00       	jmp    f01017b3 <page_reclaim+0xec>
+	if (pgdir_pt(fsenv->env_pgdir, (void *) rm->rm_va) != rm->rm_pt
+f0101732:	8b 47 70             	mov    0x70(%edi),%eax
+f0101735:	e8 28 fa ff ff       	call   f0101162 <pgdir_pt>
+f010173a:	89 c2                	mov    %eax,%edx
+f010173c:	8b 43 04             	mov    0x4(%ebx),%eax
+f010173f:	39 d0                	cmp    %edx,%eax
+f0101741:	75 4c                	jne    f010178f <page_reclaim+0xc8>
+	    || rm->rm_pt->pp_ref != 1)
+f0101743:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0101748:	75 45                	jne    f010178f <page_reclaim+0xc8>
+	if (fsenv->env_status == ENV_RUNNING && fsenv->env_cpunum != cpunum())
+f010174a:	83 7f 54 03          	cmpl   $0x3,0x54(%edi)
+f010174e:	0f 84 a1 00 00 00    	je     f01017f5 <page_reclaim+0x12e>
+	return !(*rmap_pte(rm) & PTE_D);
+f0101754:	89 d8                	mov    %ebx,%eax
+f0101756:	e8 43 fa ff ff       	call   f010119e <rmap_pte>
+			if (!rmap_reclaimable(rm, fsenv))
+f010175b:	f6 00 40             	testb  $0x40,(%eax)
+f010175e:	75 2f                	jne    f010178f <page_reclaim+0xc8>
+			pte = rmap_pte(rm);
+f0101760:	89 d8                	mov    %ebx,%eax
+f0101762:	e8 37 fa ff ff       	call   f010119e <rmap_pte>
+			if (*pte & PTE_A) {
+f0101767:	8b 10                	mov    (%eax),%edx
+f0101769:	f6 c2 20             	test   $0x20,%dl
+f010176c:	0f 85 98 00 00 00    	jne    f010180a <page_reclaim+0x143>
+		for (rm = pp->pp_rmap; rm; rm = rm->rm_next, nmap++) {
+f0101772:	8b 1b                	mov    (%ebx),%ebx
+f0101774:	83 c6 01             	add    $0x1,%esi
+f0101777:	85 db                	test   %ebx,%ebx
+f0101779:	0f 84 c8 00 00 00    	je     f0101847 <page_reclaim+0x180>
+	if (rm->rm_va < DISKMAP || rm->rm_va >= DISKMAP + DISKSIZE)
+f010177f:	8b 53 08             	mov    0x8(%ebx),%edx
+f0101782:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f0101788:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+f010178d:	76 a3                	jbe    f0101732 <page_reclaim+0x6b>
+	for (i = 0; i < 2 * npages && freed < n; i++) {
+f010178f:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+f0101793:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0101796:	8b 1d ec f3 92 f0    	mov    0xf092f3ec,%ebx
+f010179c:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+f010179f:	39 c6                	cmp    %eax,%esi
+f01017a1:	0f 83 8c 00 00 00    	jae    f0101833 <page_reclaim+0x16c>
+f01017a7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01017aa:	3b 45 08             	cmp    0x8(%ebp),%eax
+f01017ad:	0f 8d 80 00 00 00    	jge    f0101833 <page_reclaim+0x16c>
+		pp = &pages[reclaim_hand];
+f01017b3:	a1 40 c2 92 f0       	mov    0xf092c240,%eax
+f01017b8:	89 c7                	mov    %eax,%edi
+f01017ba:	c1 e7 04             	shl    $0x4,%edi
+f01017bd:	03 3d f4 f3 92 f0    	add    0xf092f3f4,%edi
+		reclaim_hand = (reclaim_hand + 1) % npages;
+f01017c3:	83 c0 01             	add    $0x1,%eax
+f01017c6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01017cb:	f7 f3                	div    %ebx
+f01017cd:	89 15 40 c2 92 f0    	mov    %edx,0xf092c240
+		if (pp->pp_ref == 0 || pp->pp_rmap == NULL)
+f01017d3:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f01017d8:	74 b5                	je     f010178f <page_reclaim+0xc8>
+f01017da:	8b 5f 08             	mov    0x8(%edi),%ebx
+f01017dd:	85 db                	test   %ebx,%ebx
+f01017df:	74 ae                	je     f010178f <page_reclaim+0xc8>
+		nmap = accessed = 0;
+f01017e1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f01017e8:	be 00 00 00 00       	mov    $0x0,%esi
+f01017ed:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f01017f0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f01017f3:	eb 8a                	jmp    f010177f <page_reclaim+0xb8>
+	if (fsenv->env_status == ENV_RUNNING && fsenv->env_cpunum != cpunum())
+f01017f5:	8b 47 68             	mov    0x68(%edi),%eax
+f01017f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01017fb:	e8 f9 6a 00 00       	call   f01082f9 <cpunum>
+f0101800:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+f0101803:	75 8a                	jne    f010178f <page_reclaim+0xc8>
+f0101805:	e9 4a ff ff ff       	jmp    f0101754 <page_reclaim+0x8d>
+				*pte &= ~PTE_A;
+f010180a:	83 e2 df             	and    $0xffffffdf,%edx
+f010180d:	89 10                	mov    %edx,(%eax)
+				tlb_invalidate(fsenv->env_pgdir, (void *) rm->rm_va);
+f010180f:	83 ec 08             	sub    $0x8,%esp
+f0101812:	ff 73 08             	push   0x8(%ebx)
+f0101815:	ff 77 70             	push   0x70(%edi)
+f0101818:	e8 02 70 00 00       	call   f010881f <tlb_invalidate>
+f010181d:	83 c4 10             	add    $0x10,%esp
+				accessed = 1;
+f0101820:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+f0101827:	e9 46 ff ff ff       	jmp    f0101772 <page_reclaim+0xab>
+		return 0;
+f010182c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+}
+f0101833:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0101836:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101839:	5b                   	pop    %ebx
+f010183a:	5e                   	pop    %esi
+f010183b:	5f                   	pop    %edi
+f010183c:	5d                   	pop    %ebp
+f010183d:	c3                   	ret
+	int i, nmap, accessed, freed = 0;
+f010183e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+f0101845:	eb ec                	jmp    f0101833 <page_reclaim+0x16c>
+f0101847:	8b 7d d8             	mov    -0x28(%ebp),%edi
+		if (rm || nmap != pp->pp_ref || accessed)
+f010184a:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+f010184e:	39 f0                	cmp    %esi,%eax
+f0101850:	0f 85 39 ff ff ff    	jne    f010178f <page_reclaim+0xc8>
+f0101856:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f010185a:	0f 85 2f ff ff ff    	jne    f010178f <page_reclaim+0xc8>
+		while ((rm = pp->pp_rmap) != NULL)
+f0101860:	8b 47 08             	mov    0x8(%edi),%eax
+f0101863:	85 c0                	test   %eax,%eax
+f0101865:	74 1b                	je     f0101882 <page_reclaim+0x1bb>
+f0101867:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+			page_remove(fsenv->env_pgdir, (void *) rm->rm_va);
+f010186a:	83 ec 08             	sub    $0x8,%esp
+f010186d:	ff 70 08             	push   0x8(%eax)
+f0101870:	ff 73 70             	push   0x70(%ebx)
+f0101873:	e8 a0 06 00 00       	call   f0101f18 <page_remove>
+		while ((rm = pp->pp_rmap) != NULL)
+f0101878:	8b 47 08             	mov    0x8(%edi),%eax
+f010187b:	83 c4 10             	add    $0x10,%esp
+f010187e:	85 c0                	test   %eax,%eax
+f0101880:	75 e8                	jne    f010186a <page_reclaim+0x1a3>
+		freed++;
+f0101882:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+f0101886:	e9 04 ff ff ff       	jmp    f010178f <page_reclaim+0xc8>
+
+f010188b <page_alloc>:
+{
+f010188b:	55                   	push   %ebp
+f010188c:	89 e5                	mov    %esp,%ebp
+f010188e:	53                   	push   %ebx
+f010188f:	83 ec 04             	sub    $0x4,%esp
+	if(page_free_list == NULL && (alloc_flags & ALLOC_RECLAIM))
+f0101892:	8b 1d 48 c2 92 f0    	mov    0xf092c248,%ebx
+f0101898:	85 db                	test   %ebx,%ebx
+f010189a:	74 29                	je     f01018c5 <page_alloc+0x3a>
+		if(result->pp_free_round == tlb_round)
+f010189c:	a1 04 10 97 f0       	mov    0xf0971004,%eax
+f01018a1:	39 43 0c             	cmp    %eax,0xc(%ebx)
+f01018a4:	74 3e                	je     f01018e4 <page_alloc+0x59>
+		result->pp_ref = 0;
+f01018a6:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+		page_free_list = page_free_list->pp_link;
+f01018ac:	a1 48 c2 92 f0       	mov    0xf092c248,%eax
+f01018b1:	8b 00                	mov    (%eax),%eax
+f01018b3:	a3 48 c2 92 f0       	mov    %eax,0xf092c248
+		if(alloc_flags & ALLOC_ZERO)
+f01018b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f01018bc:	75 2d                	jne    f01018eb <page_alloc+0x60>
+}
+f01018be:	89 d8                	mov    %ebx,%eax
+f01018c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01018c3:	c9                   	leave
+f01018c4:	c3                   	ret
+	if(page_free_list == NULL && (alloc_flags & ALLOC_RECLAIM))
+f01018c5:	f6 45 08 02          	testb  $0x2,0x8(%ebp)
+f01018c9:	74 f3                	je     f01018be <page_alloc+0x33>
+		page_reclaim(1);
+f01018cb:	83 ec 0c             	sub    $0xc,%esp
+f01018ce:	6a 01                	push   $0x1
+f01018d0:	e8 f2 fd ff ff       	call   f01016c7 <page_reclaim>
+	if(page_free_list != NULL) {
+f01018d5:	8b 1d 48 c2 92 f0    	mov    0xf092c248,%ebx
+f01018db:	83 c4 10             	add    $0x10,%esp
+f01018de:	85 db                	test   %ebx,%ebx
+f01018e0:	74 dc                	je     f01018be <page_alloc+0x33>
+f01018e2:	eb b8                	jmp    f010189c <page_alloc+0x11>
+			tlb_shootdown();
+f01018e4:	e8 28 71 00 00       	call   f0108a11 <tlb_shootdown>
+f01018e9:	eb bb                	jmp    f01018a6 <page_alloc+0x1b>
+f01018eb:	89 d8                	mov    %ebx,%eax
+f01018ed:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01018f3:	c1 f8 04             	sar    $0x4,%eax
+f01018f6:	89 c2                	mov    %eax,%edx
+f01018f8:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01018fb:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101900:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101906:	73 1b                	jae    f0101923 <page_alloc+0x98>
+			memset(page2kva(result), 0, PGSIZE);
+f0101908:	83 ec 04             	sub    $0x4,%esp
+f010190b:	68 00 10 00 00       	push   $0x1000
+f0101910:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f0101912:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101918:	52                   	push   %edx
+f0101919:	e8 80 63 00 00       	call   f0107c9e <memset>
+f010191e:	83 c4 10             	add    $0x10,%esp
+f0101921:	eb 9b                	jmp    f01018be <page_alloc+0x33>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101923:	52                   	push   %edx
+f0101924:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0101929:	6a 6e                	push   $0x6e
+f010192b:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101930:	e8 0b e7 ff ff       	call   f0100040 <_panic>
+
+f0101935 <pgdir_walk>:
+{
+f0101935:	55                   	push   %ebp
+f0101936:	89 e5                	mov    %esp,%ebp
+f0101938:	56                   	push   %esi
+f0101939:	53                   	push   %ebx
+f010193a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	pde = &pgdir[PDX(va)];
+f010193d:	89 f3                	mov    %esi,%ebx
+f010193f:	c1 eb 16             	shr    $0x16,%ebx
+f0101942:	c1 e3 02             	shl    $0x2,%ebx
+f0101945:	03 5d 08             	add    0x8(%ebp),%ebx
+	if(*pde & PTE_P) {
+f0101948:	8b 03                	mov    (%ebx),%eax
+f010194a:	a8 01                	test   $0x1,%al
+f010194c:	75 60                	jne    f01019ae <pgdir_walk+0x79>
+		if(create && (pginfo = page_alloc(ALLOC_ZERO))!= NULL) {
+f010194e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101952:	0f 84 b7 00 00 00    	je     f0101a0f <pgdir_walk+0xda>
+f0101958:	83 ec 0c             	sub    $0xc,%esp
+f010195b:	6a 01                	push   $0x1
+f010195d:	e8 29 ff ff ff       	call   f010188b <page_alloc>
+f0101962:	83 c4 10             	add    $0x10,%esp
+f0101965:	85 c0                	test   %eax,%eax
+f0101967:	74 3e                	je     f01019a7 <pgdir_walk+0x72>
+			pginfo->pp_ref++;
+f0101969:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f010196e:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0101974:	c1 f8 04             	sar    $0x4,%eax
+f0101977:	89 c2                	mov    %eax,%edx
+f0101979:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010197c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101981:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101987:	73 5f                	jae    f01019e8 <pgdir_walk+0xb3>
+	return (void *)(pa + KERNBASE);
+f0101989:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f010198f:	81 fa ff ff ff 0f    	cmp    $0xfffffff,%edx
+f0101995:	77 63                	ja     f01019fa <pgdir_walk+0xc5>
+			pgdir[PDX(va)] = PADDR(pgtab) | PTE_P | PTE_U | PTE_W;
+f0101997:	83 ca 07             	or     $0x7,%edx
+f010199a:	89 13                	mov    %edx,(%ebx)
+			return &pgtab[PTX(va)];
+f010199c:	c1 ee 0a             	shr    $0xa,%esi
+f010199f:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f01019a5:	01 f0                	add    %esi,%eax
+}
+f01019a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01019aa:	5b                   	pop    %ebx
+f01019ab:	5e                   	pop    %esi
+f01019ac:	5d                   	pop    %ebp
+f01019ad:	c3                   	ret
+		pgtab = (pte_t*)KADDR(PTE_ADDR(*pde));
+f01019ae:	89 c2                	mov    %eax,%edx
+f01019b0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f01019b6:	c1 e8 0c             	shr    $0xc,%eax
+f01019b9:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f01019bf:	73 12                	jae    f01019d3 <pgdir_walk+0x9e>
+		return &pgtab[PTX(va)];
+f01019c1:	c1 ee 0a             	shr    $0xa,%esi
+f01019c4:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f01019ca:	8d 84 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%eax
+f01019d1:	eb d4                	jmp    f01019a7 <pgdir_walk+0x72>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01019d3:	52                   	push   %edx
+f01019d4:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01019d9:	68 17 02 00 00       	push   $0x217
+f01019de:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01019e3:	e8 58 e6 ff ff       	call   f0100040 <_panic>
+f01019e8:	52                   	push   %edx
+f01019e9:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01019ee:	6a 6e                	push   $0x6e
+f01019f0:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01019f5:	e8 46 e6 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01019fa:	50                   	push   %eax
+f01019fb:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0101a00:	68 1d 02 00 00       	push   $0x21d
+f0101a05:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101a0a:	e8 31 e6 ff ff       	call   f0100040 <_panic>
+			return NULL;
+f0101a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101a14:	eb 91                	jmp    f01019a7 <pgdir_walk+0x72>
+
+f0101a16 <boot_map_region>:
+{
+f0101a16:	55                   	push   %ebp
+f0101a17:	89 e5                	mov    %esp,%ebp
+f0101a19:	57                   	push   %edi
+f0101a1a:	56                   	push   %esi
+f0101a1b:	53                   	push   %ebx
+f0101a1c:	83 ec 1c             	sub    $0x1c,%esp
+	va = ROUNDDOWN(va, PGSIZE);
+f0101a1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101a22:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101a27:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pa = ROUNDDOWN(pa, PGSIZE);
+f0101a2a:	8b 7d 14             	mov    0x14(%ebp),%edi
+f0101a2d:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	while(last < size) {
+f0101a33:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101a37:	74 35                	je     f0101a6e <boot_map_region+0x58>
+	last = 0;
+f0101a39:	be 00 00 00 00       	mov    $0x0,%esi
+f0101a3e:	8d 1c 37             	lea    (%edi,%esi,1),%ebx
+		pte = pgdir_walk(pgdir, (void*)va, 1);
+f0101a41:	83 ec 04             	sub    $0x4,%esp
+f0101a44:	6a 01                	push   $0x1
+f0101a46:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101a49:	01 f0                	add    %esi,%eax
+f0101a4b:	50                   	push   %eax
+f0101a4c:	ff 75 08             	push   0x8(%ebp)
+f0101a4f:	e8 e1 fe ff ff       	call   f0101935 <pgdir_walk>
+		assert(pte != NULL);
+f0101a54:	83 c4 10             	add    $0x10,%esp
+f0101a57:	85 c0                	test   %eax,%eax
+f0101a59:	74 1b                	je     f0101a76 <boot_map_region+0x60>
+		*pte = pa | perm | PTE_P;
+f0101a5b:	0b 5d 18             	or     0x18(%ebp),%ebx
+f0101a5e:	83 cb 01             	or     $0x1,%ebx
+f0101a61:	89 18                	mov    %ebx,(%eax)
+		last += PGSIZE;
+f0101a63:	81 c6 00 10 00 00    	add    $0x1000,%esi
+	while(last < size) {
+f0101a69:	3b 75 10             	cmp    0x10(%ebp),%esi
+f0101a6c:	72 d0                	jb     f0101a3e <boot_map_region+0x28>
+}
+f0101a6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101a71:	5b                   	pop    %ebx
+f0101a72:	5e                   	pop    %esi
+f0101a73:	5f                   	pop    %edi
+f0101a74:	5d                   	pop    %ebp
+f0101a75:	c3                   	ret
+		assert(pte != NULL);
+f0101a76:	68 a5 b9 10 f0       	push   $0xf010b9a5
+f0101a7b:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0101a80:	68 bf 02 00 00       	push   $0x2bf
+f0101a85:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101a8a:	e8 b1 e5 ff ff       	call   f0100040 <_panic>
+
+f0101a8f <page_lookup>:
+{
+f0101a8f:	55                   	push   %ebp
+f0101a90:	89 e5                	mov    %esp,%ebp
+f0101a92:	83 ec 0c             	sub    $0xc,%esp
+	pte = pgdir_walk(pgdir, va, 0);
+f0101a95:	6a 00                	push   $0x0
+f0101a97:	ff 75 0c             	push   0xc(%ebp)
+f0101a9a:	ff 75 08             	push   0x8(%ebp)
+f0101a9d:	e8 93 fe ff ff       	call   f0101935 <pgdir_walk>
+	if(pte != NULL && (*pte & PTE_P)) {
+f0101aa2:	83 c4 10             	add    $0x10,%esp
+f0101aa5:	85 c0                	test   %eax,%eax
+f0101aa7:	74 26                	je     f0101acf <page_lookup+0x40>
+f0101aa9:	f6 00 01             	testb  $0x1,(%eax)
+f0101aac:	74 37                	je     f0101ae5 <page_lookup+0x56>
+		if(pte_store != NULL)
+f0101aae:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101ab2:	74 05                	je     f0101ab9 <page_lookup+0x2a>
+			*pte_store = pte;
+f0101ab4:	8b 55 10             	mov    0x10(%ebp),%edx
+f0101ab7:	89 02                	mov    %eax,(%edx)
+	if (PGNUM(pa) >= npages)
+f0101ab9:	8b 00                	mov    (%eax),%eax
+f0101abb:	c1 e8 0c             	shr    $0xc,%eax
+f0101abe:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101ac4:	73 0b                	jae    f0101ad1 <page_lookup+0x42>
+	return &pages[PGNUM(pa)];
+f0101ac6:	c1 e0 04             	shl    $0x4,%eax
+f0101ac9:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+}
+f0101acf:	c9                   	leave
+f0101ad0:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0101ad1:	83 ec 04             	sub    $0x4,%esp
+f0101ad4:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f0101ad9:	6a 67                	push   $0x67
+f0101adb:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101ae0:	e8 5b e5 ff ff       	call   f0100040 <_panic>
+	return NULL;
+f0101ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101aea:	eb e3                	jmp    f0101acf <page_lookup+0x40>
+
+f0101aec <pgdir_unshare>:
+{
+f0101aec:	55                   	push   %ebp
+f0101aed:	89 e5                	mov    %esp,%ebp
+f0101aef:	57                   	push   %edi
+f0101af0:	56                   	push   %esi
+f0101af1:	53                   	push   %ebx
+f0101af2:	83 ec 2c             	sub    $0x2c,%esp
+		return 0;
+f0101af5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uintptr_t) va >= UTOP || (pt = pgdir_pt(pgdir, va)) == NULL
+f0101afa:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f0101b01:	76 08                	jbe    f0101b0b <pgdir_unshare+0x1f>
+}
+f0101b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101b06:	5b                   	pop    %ebx
+f0101b07:	5e                   	pop    %esi
+f0101b08:	5f                   	pop    %edi
+f0101b09:	5d                   	pop    %ebp
+f0101b0a:	c3                   	ret
+	if ((uintptr_t) va >= UTOP || (pt = pgdir_pt(pgdir, va)) == NULL
+f0101b0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0101b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101b11:	e8 4c f6 ff ff       	call   f0101162 <pgdir_pt>
+f0101b16:	89 c7                	mov    %eax,%edi
+f0101b18:	85 c0                	test   %eax,%eax
+f0101b1a:	0f 84 ec 01 00 00    	je     f0101d0c <pgdir_unshare+0x220>
+	    || pt->pp_ref == 1)
+f0101b20:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0101b25:	0f 84 eb 01 00 00    	je     f0101d16 <pgdir_unshare+0x22a>
+	if ((npt = page_alloc(0)) == NULL)
+f0101b2b:	83 ec 0c             	sub    $0xc,%esp
+f0101b2e:	6a 00                	push   $0x0
+f0101b30:	e8 56 fd ff ff       	call   f010188b <page_alloc>
+f0101b35:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101b38:	83 c4 10             	add    $0x10,%esp
+f0101b3b:	85 c0                	test   %eax,%eax
+f0101b3d:	0f 84 dd 01 00 00    	je     f0101d20 <pgdir_unshare+0x234>
+	return (pp - pages) << PGSHIFT;
+f0101b43:	8b 0d f4 f3 92 f0    	mov    0xf092f3f4,%ecx
+f0101b49:	89 f8                	mov    %edi,%eax
+f0101b4b:	29 c8                	sub    %ecx,%eax
+f0101b4d:	c1 f8 04             	sar    $0x4,%eax
+f0101b50:	89 c3                	mov    %eax,%ebx
+f0101b52:	c1 e3 0c             	shl    $0xc,%ebx
+	if (PGNUM(pa) >= npages)
+f0101b55:	8b 15 ec f3 92 f0    	mov    0xf092f3ec,%edx
+f0101b5b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101b60:	39 d0                	cmp    %edx,%eax
+f0101b62:	73 60                	jae    f0101bc4 <pgdir_unshare+0xd8>
+	return (void *)(pa + KERNBASE);
+f0101b64:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+f0101b6a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	return (pp - pages) << PGSHIFT;
+f0101b6d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101b70:	29 c8                	sub    %ecx,%eax
+f0101b72:	c1 f8 04             	sar    $0x4,%eax
+f0101b75:	89 c1                	mov    %eax,%ecx
+f0101b77:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101b7a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101b7f:	39 d0                	cmp    %edx,%eax
+f0101b81:	73 53                	jae    f0101bd6 <pgdir_unshare+0xea>
+	memmove(nptes, ptes, PGSIZE);
+f0101b83:	83 ec 04             	sub    $0x4,%esp
+f0101b86:	68 00 10 00 00       	push   $0x1000
+f0101b8b:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0101b8e:	53                   	push   %ebx
+	return (void *)(pa + KERNBASE);
+f0101b8f:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0101b95:	51                   	push   %ecx
+f0101b96:	e8 38 61 00 00       	call   f0107cd3 <memmove>
+	base = ROUNDDOWN((uintptr_t) va, PTSIZE);
+f0101b9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101b9e:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+	for (i = 0; i < NPTENTRIES; i++) {
+f0101ba3:	8b 0d 44 c2 92 f0    	mov    0xf092c244,%ecx
+f0101ba9:	83 c4 10             	add    $0x10,%esp
+	base = ROUNDDOWN((uintptr_t) va, PTSIZE);
+f0101bac:	89 c6                	mov    %eax,%esi
+f0101bae:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+	for (i = 0; i < NPTENTRIES; i++) {
+f0101bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+	pp->pp_rmap = rm;
+f0101bb7:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0101bba:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101bbf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101bc2:	eb 58                	jmp    f0101c1c <pgdir_unshare+0x130>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101bc4:	53                   	push   %ebx
+f0101bc5:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0101bca:	6a 6e                	push   $0x6e
+f0101bcc:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101bd1:	e8 6a e4 ff ff       	call   f0100040 <_panic>
+f0101bd6:	51                   	push   %ecx
+f0101bd7:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0101bdc:	6a 6e                	push   $0x6e
+f0101bde:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101be3:	e8 58 e4 ff ff       	call   f0100040 <_panic>
+f0101be8:	89 f8                	mov    %edi,%eax
+f0101bea:	84 c0                	test   %al,%al
+f0101bec:	74 06                	je     f0101bf4 <pgdir_unshare+0x108>
+f0101bee:	89 0d 44 c2 92 f0    	mov    %ecx,0xf092c244
+		panic("pa2page called with invalid pa");
+f0101bf4:	83 ec 04             	sub    $0x4,%esp
+f0101bf7:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f0101bfc:	6a 67                	push   $0x67
+f0101bfe:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101c03:	e8 38 e4 ff ff       	call   f0100040 <_panic>
+	for (i = 0; i < NPTENTRIES; i++) {
+f0101c08:	83 c2 01             	add    $0x1,%edx
+f0101c0b:	83 c3 04             	add    $0x4,%ebx
+f0101c0e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0101c14:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+f0101c1a:	74 42                	je     f0101c5e <pgdir_unshare+0x172>
+		if (!(ptes[i] & PTE_P))
+f0101c1c:	8b 03                	mov    (%ebx),%eax
+f0101c1e:	a8 01                	test   $0x1,%al
+f0101c20:	74 e6                	je     f0101c08 <pgdir_unshare+0x11c>
+	if (PGNUM(pa) >= npages)
+f0101c22:	c1 e8 0c             	shr    $0xc,%eax
+f0101c25:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101c2b:	73 bb                	jae    f0101be8 <pgdir_unshare+0xfc>
+	return &pages[PGNUM(pa)];
+f0101c2d:	c1 e0 04             	shl    $0x4,%eax
+f0101c30:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+	if ((rm = rmap_free_list) == NULL)
+f0101c36:	85 c9                	test   %ecx,%ecx
+f0101c38:	0f 84 ec 00 00 00    	je     f0101d2a <pgdir_unshare+0x23e>
+	rmap_free_list = rm->rm_next;
+f0101c3e:	8b 39                	mov    (%ecx),%edi
+f0101c40:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+	rm->rm_pt = pt;
+f0101c43:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0101c46:	89 79 04             	mov    %edi,0x4(%ecx)
+	rm->rm_va = (uintptr_t) ROUNDDOWN(va, PGSIZE);
+f0101c49:	89 71 08             	mov    %esi,0x8(%ecx)
+	rm->rm_next = pp->pp_rmap;
+f0101c4c:	8b 78 08             	mov    0x8(%eax),%edi
+f0101c4f:	89 39                	mov    %edi,(%ecx)
+	pp->pp_rmap = rm;
+f0101c51:	89 48 08             	mov    %ecx,0x8(%eax)
+	rmap_free_list = rm->rm_next;
+f0101c54:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+	pp->pp_rmap = rm;
+f0101c57:	bf 01 00 00 00       	mov    $0x1,%edi
+f0101c5c:	eb aa                	jmp    f0101c08 <pgdir_unshare+0x11c>
+f0101c5e:	89 f8                	mov    %edi,%eax
+f0101c60:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0101c63:	84 c0                	test   %al,%al
+f0101c65:	74 06                	je     f0101c6d <pgdir_unshare+0x181>
+f0101c67:	89 0d 44 c2 92 f0    	mov    %ecx,0xf092c244
+	npt->pp_ref = 1;
+f0101c6d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0101c70:	66 c7 46 04 01 00    	movw   $0x1,0x4(%esi)
+	pt->pp_ref--;
+f0101c76:	66 83 6f 04 01       	subw   $0x1,0x4(%edi)
+	pgdir[PDX(va)] = page2pa(npt) | (pgdir[PDX(va)] & 0xFFF);
+f0101c7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101c7e:	c1 e8 16             	shr    $0x16,%eax
+f0101c81:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101c84:	8d 14 82             	lea    (%edx,%eax,4),%edx
+	return (pp - pages) << PGSHIFT;
+f0101c87:	89 f0                	mov    %esi,%eax
+f0101c89:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0101c8f:	c1 f8 04             	sar    $0x4,%eax
+f0101c92:	c1 e0 0c             	shl    $0xc,%eax
+f0101c95:	8b 0a                	mov    (%edx),%ecx
+f0101c97:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f0101c9d:	09 c8                	or     %ecx,%eax
+f0101c9f:	89 02                	mov    %eax,(%edx)
+	return 0;
+f0101ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101ca6:	e9 58 fe ff ff       	jmp    f0101b03 <pgdir_unshare+0x17>
+	return &pages[PGNUM(pa)];
+f0101cab:	c1 e0 04             	shl    $0x4,%eax
+f0101cae:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+			rmap_remove(pa2page(PTE_ADDR(ptes[i])), npt,
+f0101cb4:	89 f9                	mov    %edi,%ecx
+f0101cb6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0101cb9:	e8 a5 f3 ff ff       	call   f0101063 <rmap_remove>
+	while (--i >= 0)
+f0101cbe:	83 eb 01             	sub    $0x1,%ebx
+f0101cc1:	83 ee 04             	sub    $0x4,%esi
+f0101cc4:	81 ef 00 10 00 00    	sub    $0x1000,%edi
+f0101cca:	83 fb ff             	cmp    $0xffffffff,%ebx
+f0101ccd:	74 25                	je     f0101cf4 <pgdir_unshare+0x208>
+		if (ptes[i] & PTE_P)
+f0101ccf:	8b 06                	mov    (%esi),%eax
+f0101cd1:	a8 01                	test   $0x1,%al
+f0101cd3:	74 e9                	je     f0101cbe <pgdir_unshare+0x1d2>
+	if (PGNUM(pa) >= npages)
+f0101cd5:	c1 e8 0c             	shr    $0xc,%eax
+f0101cd8:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101cde:	72 cb                	jb     f0101cab <pgdir_unshare+0x1bf>
+		panic("pa2page called with invalid pa");
+f0101ce0:	83 ec 04             	sub    $0x4,%esp
+f0101ce3:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f0101ce8:	6a 67                	push   $0x67
+f0101cea:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101cef:	e8 4c e3 ff ff       	call   f0100040 <_panic>
+	page_free(npt);
+f0101cf4:	83 ec 0c             	sub    $0xc,%esp
+f0101cf7:	ff 75 e0             	push   -0x20(%ebp)
+f0101cfa:	e8 35 f9 ff ff       	call   f0101634 <page_free>
+	return -E_NO_MEM;
+f0101cff:	83 c4 10             	add    $0x10,%esp
+f0101d02:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101d07:	e9 f7 fd ff ff       	jmp    f0101b03 <pgdir_unshare+0x17>
+		return 0;
+f0101d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101d11:	e9 ed fd ff ff       	jmp    f0101b03 <pgdir_unshare+0x17>
+f0101d16:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101d1b:	e9 e3 fd ff ff       	jmp    f0101b03 <pgdir_unshare+0x17>
+		return -E_NO_MEM;
+f0101d20:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101d25:	e9 d9 fd ff ff       	jmp    f0101b03 <pgdir_unshare+0x17>
+f0101d2a:	89 fb                	mov    %edi,%ebx
+f0101d2c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101d2f:	84 db                	test   %bl,%bl
+f0101d31:	74 0a                	je     f0101d3d <pgdir_unshare+0x251>
+f0101d33:	c7 05 44 c2 92 f0 00 	movl   $0x0,0xf092c244
+f0101d3a:	00 00 00 
+	while (--i >= 0)
+f0101d3d:	83 ea 01             	sub    $0x1,%edx
+f0101d40:	89 d3                	mov    %edx,%ebx
+f0101d42:	78 b0                	js     f0101cf4 <pgdir_unshare+0x208>
+f0101d44:	8b 75 dc             	mov    -0x24(%ebp),%esi
+f0101d47:	8d 34 9e             	lea    (%esi,%ebx,4),%esi
+f0101d4a:	89 df                	mov    %ebx,%edi
+f0101d4c:	c1 e7 0c             	shl    $0xc,%edi
+f0101d4f:	01 c7                	add    %eax,%edi
+f0101d51:	e9 79 ff ff ff       	jmp    f0101ccf <pgdir_unshare+0x1e3>
+
+f0101d56 <pgdir_share>:
+{
+f0101d56:	55                   	push   %ebp
+f0101d57:	89 e5                	mov    %esp,%ebp
+f0101d59:	57                   	push   %edi
+f0101d5a:	56                   	push   %esi
+f0101d5b:	53                   	push   %ebx
+f0101d5c:	83 ec 1c             	sub    $0x1c,%esp
+f0101d5f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if ((uintptr_t) va >= UTOP || (cowbits & ~PTE_AVAIL)
+f0101d62:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0101d68:	0f 87 8e 01 00 00    	ja     f0101efc <pgdir_share+0x1a6>
+f0101d6e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0101d71:	25 ff f1 ff ff       	and    $0xfffff1ff,%eax
+f0101d76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0101d79:	0f 85 84 01 00 00    	jne    f0101f03 <pgdir_share+0x1ad>
+	    || (dstpgdir[PDX(va)] & PTE_P) || !(srcpgdir[PDX(va)] & PTE_P))
+f0101d7f:	89 f8                	mov    %edi,%eax
+f0101d81:	c1 e8 16             	shr    $0x16,%eax
+f0101d84:	c1 e0 02             	shl    $0x2,%eax
+f0101d87:	89 c6                	mov    %eax,%esi
+f0101d89:	03 75 0c             	add    0xc(%ebp),%esi
+f0101d8c:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f0101d8f:	8b 36                	mov    (%esi),%esi
+f0101d91:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f0101d94:	89 f3                	mov    %esi,%ebx
+f0101d96:	83 e3 01             	and    $0x1,%ebx
+f0101d99:	0f 85 6b 01 00 00    	jne    f0101f0a <pgdir_share+0x1b4>
+f0101d9f:	03 45 08             	add    0x8(%ebp),%eax
+f0101da2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101da5:	f6 00 01             	testb  $0x1,(%eax)
+f0101da8:	0f 84 63 01 00 00    	je     f0101f11 <pgdir_share+0x1bb>
+	ptes = page2kva(pgdir_pt(srcpgdir, va));
+f0101dae:	89 fa                	mov    %edi,%edx
+f0101db0:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101db3:	e8 aa f3 ff ff       	call   f0101162 <pgdir_pt>
+	return (pp - pages) << PGSHIFT;
+f0101db8:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0101dbe:	c1 f8 04             	sar    $0x4,%eax
+f0101dc1:	89 c6                	mov    %eax,%esi
+f0101dc3:	c1 e6 0c             	shl    $0xc,%esi
+	if (PGNUM(pa) >= npages)
+f0101dc6:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101dcb:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101dd1:	73 12                	jae    f0101de5 <pgdir_share+0x8f>
+	return (void *)(pa + KERNBASE);
+f0101dd3:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+	bool flush = 0;
+f0101dd9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+			flush = 1;
+f0101ddc:	89 f1                	mov    %esi,%ecx
+f0101dde:	89 fe                	mov    %edi,%esi
+f0101de0:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0101de3:	eb 59                	jmp    f0101e3e <pgdir_share+0xe8>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101de5:	56                   	push   %esi
+f0101de6:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0101deb:	6a 6e                	push   $0x6e
+f0101ded:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101df2:	e8 49 e2 ff ff       	call   f0100040 <_panic>
+			ptes = page2kva(pgdir_pt(srcpgdir, va));
+f0101df7:	89 f2                	mov    %esi,%edx
+f0101df9:	89 f8                	mov    %edi,%eax
+f0101dfb:	e8 62 f3 ff ff       	call   f0101162 <pgdir_pt>
+	return (pp - pages) << PGSHIFT;
+f0101e00:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0101e06:	c1 f8 04             	sar    $0x4,%eax
+f0101e09:	89 c1                	mov    %eax,%ecx
+f0101e0b:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101e0e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101e13:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101e19:	73 4a                	jae    f0101e65 <pgdir_share+0x10f>
+	return (void *)(pa + KERNBASE);
+f0101e1b:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+			ptes[i] = (ptes[i] & ~PTE_W) | cowbits;
+f0101e21:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+f0101e24:	8b 02                	mov    (%edx),%eax
+f0101e26:	83 e0 fd             	and    $0xfffffffd,%eax
+f0101e29:	0b 45 14             	or     0x14(%ebp),%eax
+f0101e2c:	89 02                	mov    %eax,(%edx)
+			flush = 1;
+f0101e2e:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (i = 0; i < NPTENTRIES; i++)
+f0101e33:	83 c3 04             	add    $0x4,%ebx
+f0101e36:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+f0101e3c:	74 39                	je     f0101e77 <pgdir_share+0x121>
+		if ((ptes[i] & (PTE_P | PTE_W | PTE_SHARE)) == (PTE_P | PTE_W)) {
+f0101e3e:	8b 04 19             	mov    (%ecx,%ebx,1),%eax
+f0101e41:	25 03 04 00 00       	and    $0x403,%eax
+f0101e46:	83 f8 03             	cmp    $0x3,%eax
+f0101e49:	75 e8                	jne    f0101e33 <pgdir_share+0xdd>
+			if (!flush && (r = pgdir_unshare(srcpgdir, va)) < 0)
+f0101e4b:	85 d2                	test   %edx,%edx
+f0101e4d:	75 a8                	jne    f0101df7 <pgdir_share+0xa1>
+f0101e4f:	83 ec 08             	sub    $0x8,%esp
+f0101e52:	56                   	push   %esi
+f0101e53:	57                   	push   %edi
+f0101e54:	e8 93 fc ff ff       	call   f0101aec <pgdir_unshare>
+f0101e59:	83 c4 10             	add    $0x10,%esp
+f0101e5c:	85 c0                	test   %eax,%eax
+f0101e5e:	79 97                	jns    f0101df7 <pgdir_share+0xa1>
+f0101e60:	e9 8f 00 00 00       	jmp    f0101ef4 <pgdir_share+0x19e>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101e65:	51                   	push   %ecx
+f0101e66:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0101e6b:	6a 6e                	push   $0x6e
+f0101e6d:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101e72:	e8 c9 e1 ff ff       	call   f0100040 <_panic>
+	if (flush)
+f0101e77:	89 f7                	mov    %esi,%edi
+f0101e79:	89 ce                	mov    %ecx,%esi
+f0101e7b:	85 d2                	test   %edx,%edx
+f0101e7d:	75 25                	jne    f0101ea4 <pgdir_share+0x14e>
+	pt = pgdir_pt(srcpgdir, va);
+f0101e7f:	89 fa                	mov    %edi,%edx
+f0101e81:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101e84:	e8 d9 f2 ff ff       	call   f0101162 <pgdir_pt>
+	pt->pp_ref++;
+f0101e89:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	if (PGNUM(pa) >= npages)
+f0101e8e:	8b 1d ec f3 92 f0    	mov    0xf092f3ec,%ebx
+	return &pages[PGNUM(pa)];
+f0101e94:	8b 0d f4 f3 92 f0    	mov    0xf092f3f4,%ecx
+f0101e9a:	89 f2                	mov    %esi,%edx
+f0101e9c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0101ea2:	eb 2b                	jmp    f0101ecf <pgdir_share+0x179>
+		tlb_invalidate_all(srcpgdir);
+f0101ea4:	83 ec 0c             	sub    $0xc,%esp
+f0101ea7:	ff 75 08             	push   0x8(%ebp)
+f0101eaa:	e8 d2 69 00 00       	call   f0108881 <tlb_invalidate_all>
+f0101eaf:	83 c4 10             	add    $0x10,%esp
+f0101eb2:	eb cb                	jmp    f0101e7f <pgdir_share+0x129>
+		panic("pa2page called with invalid pa");
+f0101eb4:	83 ec 04             	sub    $0x4,%esp
+f0101eb7:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f0101ebc:	6a 67                	push   $0x67
+f0101ebe:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101ec3:	e8 78 e1 ff ff       	call   f0100040 <_panic>
+	for (i = 0; i < NPTENTRIES; i++)
+f0101ec8:	83 c2 04             	add    $0x4,%edx
+f0101ecb:	39 f2                	cmp    %esi,%edx
+f0101ecd:	74 18                	je     f0101ee7 <pgdir_share+0x191>
+		if (ptes[i] & PTE_P)
+f0101ecf:	8b 02                	mov    (%edx),%eax
+f0101ed1:	a8 01                	test   $0x1,%al
+f0101ed3:	74 f3                	je     f0101ec8 <pgdir_share+0x172>
+	if (PGNUM(pa) >= npages)
+f0101ed5:	c1 e8 0c             	shr    $0xc,%eax
+f0101ed8:	39 d8                	cmp    %ebx,%eax
+f0101eda:	73 d8                	jae    f0101eb4 <pgdir_share+0x15e>
+	return &pages[PGNUM(pa)];
+f0101edc:	c1 e0 04             	shl    $0x4,%eax
+			pa2page(PTE_ADDR(ptes[i]))->pp_ref++;
+f0101edf:	66 83 44 01 04 01    	addw   $0x1,0x4(%ecx,%eax,1)
+f0101ee5:	eb e1                	jmp    f0101ec8 <pgdir_share+0x172>
+	dstpgdir[PDX(va)] = srcpgdir[PDX(va)];
+f0101ee7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101eea:	8b 00                	mov    (%eax),%eax
+f0101eec:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f0101eef:	89 07                	mov    %eax,(%edi)
+	return 0;
+f0101ef1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+}
+f0101ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101ef7:	5b                   	pop    %ebx
+f0101ef8:	5e                   	pop    %esi
+f0101ef9:	5f                   	pop    %edi
+f0101efa:	5d                   	pop    %ebp
+f0101efb:	c3                   	ret
+		return -E_INVAL;
+f0101efc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101f01:	eb f1                	jmp    f0101ef4 <pgdir_share+0x19e>
+f0101f03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101f08:	eb ea                	jmp    f0101ef4 <pgdir_share+0x19e>
+f0101f0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101f0f:	eb e3                	jmp    f0101ef4 <pgdir_share+0x19e>
+f0101f11:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101f16:	eb dc                	jmp    f0101ef4 <pgdir_share+0x19e>
+
+f0101f18 <page_remove>:
+{
+f0101f18:	55                   	push   %ebp
+f0101f19:	89 e5                	mov    %esp,%ebp
+f0101f1b:	57                   	push   %edi
+f0101f1c:	56                   	push   %esi
+f0101f1d:	53                   	push   %ebx
+f0101f1e:	83 ec 24             	sub    $0x24,%esp
+f0101f21:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0101f24:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(pgdir_unshare(pgdir, va) < 0)
+f0101f27:	56                   	push   %esi
+f0101f28:	57                   	push   %edi
+f0101f29:	e8 be fb ff ff       	call   f0101aec <pgdir_unshare>
+f0101f2e:	83 c4 10             	add    $0x10,%esp
+f0101f31:	85 c0                	test   %eax,%eax
+f0101f33:	78 51                	js     f0101f86 <page_remove+0x6e>
+	pg = page_lookup(pgdir, va, &pte);
+f0101f35:	83 ec 04             	sub    $0x4,%esp
+f0101f38:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0101f3b:	50                   	push   %eax
+f0101f3c:	56                   	push   %esi
+f0101f3d:	57                   	push   %edi
+f0101f3e:	e8 4c fb ff ff       	call   f0101a8f <page_lookup>
+f0101f43:	89 c3                	mov    %eax,%ebx
+	if(pg != NULL) {
+f0101f45:	83 c4 10             	add    $0x10,%esp
+f0101f48:	85 c0                	test   %eax,%eax
+f0101f4a:	74 32                	je     f0101f7e <page_remove+0x66>
+		rmap_remove(pg, pgdir_pt(pgdir, va), va);
+f0101f4c:	89 f2                	mov    %esi,%edx
+f0101f4e:	89 f8                	mov    %edi,%eax
+f0101f50:	e8 0d f2 ff ff       	call   f0101162 <pgdir_pt>
+f0101f55:	89 c2                	mov    %eax,%edx
+f0101f57:	89 f1                	mov    %esi,%ecx
+f0101f59:	89 d8                	mov    %ebx,%eax
+f0101f5b:	e8 03 f1 ff ff       	call   f0101063 <rmap_remove>
+		*pte = 0;
+f0101f60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101f63:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		tlb_invalidate(pgdir, va);
+f0101f69:	83 ec 08             	sub    $0x8,%esp
+f0101f6c:	56                   	push   %esi
+f0101f6d:	57                   	push   %edi
+f0101f6e:	e8 ac 68 00 00       	call   f010881f <tlb_invalidate>
+		page_decref(pg);
+f0101f73:	89 1c 24             	mov    %ebx,(%esp)
+f0101f76:	e8 fa f6 ff ff       	call   f0101675 <page_decref>
+f0101f7b:	83 c4 10             	add    $0x10,%esp
+}
+f0101f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101f81:	5b                   	pop    %ebx
+f0101f82:	5e                   	pop    %esi
+f0101f83:	5f                   	pop    %edi
+f0101f84:	5d                   	pop    %ebp
+f0101f85:	c3                   	ret
+		panic("page_remove: cannot unshare page table");
+f0101f86:	83 ec 04             	sub    $0x4,%esp
+f0101f89:	68 bc bc 10 f0       	push   $0xf010bcbc
+f0101f8e:	68 29 03 00 00       	push   $0x329
+f0101f93:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0101f98:	e8 a3 e0 ff ff       	call   f0100040 <_panic>
+
+f0101f9d <pgdir_release>:
+{
+f0101f9d:	55                   	push   %ebp
+f0101f9e:	89 e5                	mov    %esp,%ebp
+f0101fa0:	57                   	push   %edi
+f0101fa1:	56                   	push   %esi
+f0101fa2:	53                   	push   %ebx
+f0101fa3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((pt = pgdir_pt(pgdir, va)) == NULL)
+f0101fa6:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0101fa9:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101fac:	e8 b1 f1 ff ff       	call   f0101162 <pgdir_pt>
+f0101fb1:	85 c0                	test   %eax,%eax
+f0101fb3:	0f 84 ca 00 00 00    	je     f0102083 <pgdir_release+0xe6>
+f0101fb9:	89 c2                	mov    %eax,%edx
+	return (pp - pages) << PGSHIFT;
+f0101fbb:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0101fc1:	c1 f8 04             	sar    $0x4,%eax
+f0101fc4:	89 c7                	mov    %eax,%edi
+f0101fc6:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f0101fc9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101fce:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0101fd4:	73 1a                	jae    f0101ff0 <pgdir_release+0x53>
+	return (void *)(pa + KERNBASE);
+f0101fd6:	8d 9f 00 00 00 f0    	lea    -0x10000000(%edi),%ebx
+	base = ROUNDDOWN((uintptr_t) va, PTSIZE);
+f0101fdc:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0101fdf:	81 e6 00 00 c0 ff    	and    $0xffc00000,%esi
+	for (i = 0; i < NPTENTRIES; i++) {
+f0101fe5:	81 ef 00 f0 ff 0f    	sub    $0xffff000,%edi
+f0101feb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101fee:	eb 2e                	jmp    f010201e <pgdir_release+0x81>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101ff0:	57                   	push   %edi
+f0101ff1:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0101ff6:	6a 6e                	push   $0x6e
+f0101ff8:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0101ffd:	e8 3e e0 ff ff       	call   f0100040 <_panic>
+			page_remove(pgdir, (void *) (base + i * PGSIZE));
+f0102002:	83 ec 08             	sub    $0x8,%esp
+f0102005:	56                   	push   %esi
+f0102006:	ff 75 08             	push   0x8(%ebp)
+f0102009:	e8 0a ff ff ff       	call   f0101f18 <page_remove>
+f010200e:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPTENTRIES; i++) {
+f0102011:	83 c3 04             	add    $0x4,%ebx
+f0102014:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010201a:	39 fb                	cmp    %edi,%ebx
+f010201c:	74 46                	je     f0102064 <pgdir_release+0xc7>
+		if (!(ptes[i] & PTE_P))
+f010201e:	8b 03                	mov    (%ebx),%eax
+f0102020:	a8 01                	test   $0x1,%al
+f0102022:	74 ed                	je     f0102011 <pgdir_release+0x74>
+		if (pt->pp_ref == 1)
+f0102024:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0102027:	66 83 79 04 01       	cmpw   $0x1,0x4(%ecx)
+f010202c:	74 d4                	je     f0102002 <pgdir_release+0x65>
+	if (PGNUM(pa) >= npages)
+f010202e:	c1 e8 0c             	shr    $0xc,%eax
+f0102031:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0102037:	73 17                	jae    f0102050 <pgdir_release+0xb3>
+			page_decref(pa2page(PTE_ADDR(ptes[i])));
+f0102039:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f010203c:	c1 e0 04             	shl    $0x4,%eax
+f010203f:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+f0102045:	50                   	push   %eax
+f0102046:	e8 2a f6 ff ff       	call   f0101675 <page_decref>
+f010204b:	83 c4 10             	add    $0x10,%esp
+f010204e:	eb c1                	jmp    f0102011 <pgdir_release+0x74>
+		panic("pa2page called with invalid pa");
+f0102050:	83 ec 04             	sub    $0x4,%esp
+f0102053:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f0102058:	6a 67                	push   $0x67
+f010205a:	68 ce b8 10 f0       	push   $0xf010b8ce
+f010205f:	e8 dc df ff ff       	call   f0100040 <_panic>
+	pgdir[PDX(va)] = 0;
+f0102064:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0102067:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010206a:	c1 e8 16             	shr    $0x16,%eax
+f010206d:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0102070:	c7 04 87 00 00 00 00 	movl   $0x0,(%edi,%eax,4)
+	page_decref(pt);
+f0102077:	83 ec 0c             	sub    $0xc,%esp
+f010207a:	52                   	push   %edx
+f010207b:	e8 f5 f5 ff ff       	call   f0101675 <page_decref>
+f0102080:	83 c4 10             	add    $0x10,%esp
+}
+f0102083:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102086:	5b                   	pop    %ebx
+f0102087:	5e                   	pop    %esi
+f0102088:	5f                   	pop    %edi
+f0102089:	5d                   	pop    %ebp
+f010208a:	c3                   	ret
+
+f010208b <page_insert>:
+{
+f010208b:	55                   	push   %ebp
+f010208c:	89 e5                	mov    %esp,%ebp
+f010208e:	57                   	push   %edi
+f010208f:	56                   	push   %esi
+f0102090:	53                   	push   %ebx
+f0102091:	83 ec 14             	sub    $0x14,%esp
+f0102094:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0102097:	8b 75 10             	mov    0x10(%ebp),%esi
+	if(pgdir_unshare(pgdir, va) < 0)
+f010209a:	56                   	push   %esi
+f010209b:	ff 75 08             	push   0x8(%ebp)
+f010209e:	e8 49 fa ff ff       	call   f0101aec <pgdir_unshare>
+f01020a3:	83 c4 10             	add    $0x10,%esp
+f01020a6:	85 c0                	test   %eax,%eax
+f01020a8:	0f 88 97 00 00 00    	js     f0102145 <page_insert+0xba>
+	pte = pgdir_walk(pgdir, va, 1);
+f01020ae:	83 ec 04             	sub    $0x4,%esp
+f01020b1:	6a 01                	push   $0x1
+f01020b3:	56                   	push   %esi
+f01020b4:	ff 75 08             	push   0x8(%ebp)
+f01020b7:	e8 79 f8 ff ff       	call   f0101935 <pgdir_walk>
+f01020bc:	89 c7                	mov    %eax,%edi
+	if(pte == NULL) 
+f01020be:	83 c4 10             	add    $0x10,%esp
+f01020c1:	85 c0                	test   %eax,%eax
+f01020c3:	0f 84 83 00 00 00    	je     f010214c <page_insert+0xc1>
+	pp->pp_ref++; // should be there, can not put this operation after 
+f01020c9:	66 83 43 04 01       	addw   $0x1,0x4(%ebx)
+	if(*pte & PTE_P)
+f01020ce:	f6 00 01             	testb  $0x1,(%eax)
+f01020d1:	75 61                	jne    f0102134 <page_insert+0xa9>
+	if(rmap_add(pp, pgdir_pt(pgdir, va), va) < 0) {
+f01020d3:	89 f2                	mov    %esi,%edx
+f01020d5:	8b 45 08             	mov    0x8(%ebp),%eax
+f01020d8:	e8 85 f0 ff ff       	call   f0101162 <pgdir_pt>
+	if ((rm = rmap_free_list) == NULL)
+f01020dd:	8b 15 44 c2 92 f0    	mov    0xf092c244,%edx
+f01020e3:	85 d2                	test   %edx,%edx
+f01020e5:	74 6c                	je     f0102153 <page_insert+0xc8>
+	rmap_free_list = rm->rm_next;
+f01020e7:	8b 0a                	mov    (%edx),%ecx
+f01020e9:	89 0d 44 c2 92 f0    	mov    %ecx,0xf092c244
+	rm->rm_pt = pt;
+f01020ef:	89 42 04             	mov    %eax,0x4(%edx)
+	rm->rm_va = (uintptr_t) ROUNDDOWN(va, PGSIZE);
+f01020f2:	89 f0                	mov    %esi,%eax
+f01020f4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01020f9:	89 42 08             	mov    %eax,0x8(%edx)
+	rm->rm_next = pp->pp_rmap;
+f01020fc:	8b 43 08             	mov    0x8(%ebx),%eax
+f01020ff:	89 02                	mov    %eax,(%edx)
+	pp->pp_rmap = rm;
+f0102101:	89 53 08             	mov    %edx,0x8(%ebx)
+	return (pp - pages) << PGSHIFT;
+f0102104:	2b 1d f4 f3 92 f0    	sub    0xf092f3f4,%ebx
+f010210a:	c1 fb 04             	sar    $0x4,%ebx
+f010210d:	c1 e3 0c             	shl    $0xc,%ebx
+    *pte = page2pa(pp) | perm | PTE_P;
+f0102110:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0102113:	83 cb 01             	or     $0x1,%ebx
+f0102116:	89 1f                	mov    %ebx,(%edi)
+	tlb_invalidate(pgdir, va);
+f0102118:	83 ec 08             	sub    $0x8,%esp
+f010211b:	56                   	push   %esi
+f010211c:	ff 75 08             	push   0x8(%ebp)
+f010211f:	e8 fb 66 00 00       	call   f010881f <tlb_invalidate>
+	return 0;
+f0102124:	83 c4 10             	add    $0x10,%esp
+f0102127:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010212c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010212f:	5b                   	pop    %ebx
+f0102130:	5e                   	pop    %esi
+f0102131:	5f                   	pop    %edi
+f0102132:	5d                   	pop    %ebp
+f0102133:	c3                   	ret
+		page_remove(pgdir, va);
+f0102134:	83 ec 08             	sub    $0x8,%esp
+f0102137:	56                   	push   %esi
+f0102138:	ff 75 08             	push   0x8(%ebp)
+f010213b:	e8 d8 fd ff ff       	call   f0101f18 <page_remove>
+f0102140:	83 c4 10             	add    $0x10,%esp
+f0102143:	eb 8e                	jmp    f01020d3 <page_insert+0x48>
+		return -E_NO_MEM;
+f0102145:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010214a:	eb e0                	jmp    f010212c <page_insert+0xa1>
+		return -E_NO_MEM;
+f010214c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0102151:	eb d9                	jmp    f010212c <page_insert+0xa1>
+		page_decref(pp);
+f0102153:	83 ec 0c             	sub    $0xc,%esp
+f0102156:	53                   	push   %ebx
+f0102157:	e8 19 f5 ff ff       	call   f0101675 <page_decref>
+		return -E_NO_MEM;
+f010215c:	83 c4 10             	add    $0x10,%esp
+f010215f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0102164:	eb c6                	jmp    f010212c <page_insert+0xa1>
+
+f0102166 <mem_init>:
+{
+f0102166:	55                   	push   %ebp
+f0102167:	89 e5                	mov    %esp,%ebp
+f0102169:	57                   	push   %edi
+f010216a:	56                   	push   %esi
+f010216b:	53                   	push   %ebx
+f010216c:	83 ec 48             	sub    $0x48,%esp
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f010216f:	6a 15                	push   $0x15
+f0102171:	e8 d1 23 00 00       	call   f0104547 <mc146818_read>
+f0102176:	89 c3                	mov    %eax,%ebx
+f0102178:	c7 04 24 16 00 00 00 	movl   $0x16,(%esp)
+f010217f:	e8 c3 23 00 00       	call   f0104547 <mc146818_read>
+f0102184:	c1 e0 08             	shl    $0x8,%eax
+f0102187:	09 d8                	or     %ebx,%eax
+	npages_basemem = (nvram_read(NVRAM_BASELO) * 1024) / PGSIZE;
+f0102189:	8d 50 03             	lea    0x3(%eax),%edx
+f010218c:	85 c0                	test   %eax,%eax
+f010218e:	0f 48 c2             	cmovs  %edx,%eax
+f0102191:	c1 f8 02             	sar    $0x2,%eax
+f0102194:	a3 4c c2 92 f0       	mov    %eax,0xf092c24c
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0102199:	c7 04 24 17 00 00 00 	movl   $0x17,(%esp)
+f01021a0:	e8 a2 23 00 00       	call   f0104547 <mc146818_read>
+f01021a5:	89 c3                	mov    %eax,%ebx
+f01021a7:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+f01021ae:	e8 94 23 00 00       	call   f0104547 <mc146818_read>
+f01021b3:	c1 e0 08             	shl    $0x8,%eax
+f01021b6:	89 c2                	mov    %eax,%edx
+f01021b8:	09 da                	or     %ebx,%edx
+	npages_extmem = (nvram_read(NVRAM_EXTLO) * 1024) / PGSIZE;
+f01021ba:	8d 42 03             	lea    0x3(%edx),%eax
+f01021bd:	83 c4 10             	add    $0x10,%esp
+f01021c0:	85 d2                	test   %edx,%edx
+f01021c2:	0f 49 c2             	cmovns %edx,%eax
+f01021c5:	c1 f8 02             	sar    $0x2,%eax
+		npages = (EXTPHYSMEM / PGSIZE) + npages_extmem;
+f01021c8:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+f01021ce:	0f 44 15 4c c2 92 f0 	cmove  0xf092c24c,%edx
+f01021d5:	89 15 ec f3 92 f0    	mov    %edx,0xf092f3ec
+		npages_extmem * PGSIZE / 1024);
+f01021db:	c1 e0 0c             	shl    $0xc,%eax
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f01021de:	c1 e8 0a             	shr    $0xa,%eax
+f01021e1:	50                   	push   %eax
+		npages_basemem * PGSIZE / 1024,
+f01021e2:	a1 4c c2 92 f0       	mov    0xf092c24c,%eax
+f01021e7:	c1 e0 0c             	shl    $0xc,%eax
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f01021ea:	c1 e8 0a             	shr    $0xa,%eax
+f01021ed:	50                   	push   %eax
+		npages * PGSIZE / 1024,
+f01021ee:	c1 e2 0c             	shl    $0xc,%edx
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f01021f1:	c1 ea 0a             	shr    $0xa,%edx
+f01021f4:	52                   	push   %edx
+f01021f5:	68 e4 bc 10 f0       	push   $0xf010bce4
+f01021fa:	e8 ed 24 00 00       	call   f01046ec <cprintf>
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f01021ff:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0102204:	e8 98 ee ff ff       	call   f01010a1 <boot_alloc>
+f0102209:	a3 f0 f3 92 f0       	mov    %eax,0xf092f3f0
+	memset(kern_pgdir, 0, PGSIZE);
+f010220e:	83 c4 0c             	add    $0xc,%esp
+f0102211:	68 00 10 00 00       	push   $0x1000
+f0102216:	6a 00                	push   $0x0
+f0102218:	50                   	push   %eax
+f0102219:	e8 80 5a 00 00       	call   f0107c9e <memset>
+	kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f010221e:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102223:	83 c4 10             	add    $0x10,%esp
+f0102226:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010222b:	0f 86 92 0a 00 00    	jbe    f0102cc3 <mem_init+0xb5d>
+	return (physaddr_t)kva - KERNBASE;
+f0102231:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0102237:	83 ca 05             	or     $0x5,%edx
+f010223a:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	pages = (struct Page *)boot_alloc(npages * sizeof(struct Page));
+f0102240:	a1 ec f3 92 f0       	mov    0xf092f3ec,%eax
+f0102245:	c1 e0 04             	shl    $0x4,%eax
+f0102248:	e8 54 ee ff ff       	call   f01010a1 <boot_alloc>
+f010224d:	a3 f4 f3 92 f0       	mov    %eax,0xf092f3f4
+	memset(pages, 0, npages * sizeof(struct Page));
+f0102252:	83 ec 04             	sub    $0x4,%esp
+f0102255:	8b 15 ec f3 92 f0    	mov    0xf092f3ec,%edx
+f010225b:	c1 e2 04             	shl    $0x4,%edx
+f010225e:	52                   	push   %edx
+f010225f:	6a 00                	push   $0x0
+f0102261:	50                   	push   %eax
+f0102262:	e8 37 5a 00 00       	call   f0107c9e <memset>
+	n = npages * RMAP_PER_PAGE;
+f0102267:	8b 1d ec f3 92 f0    	mov    0xf092f3ec,%ebx
+f010226d:	8d 3c 1b             	lea    (%ebx,%ebx,1),%edi
+	rmaps = (struct Rmap *)boot_alloc(n * sizeof(struct Rmap));
+f0102270:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+f0102273:	c1 e6 03             	shl    $0x3,%esi
+f0102276:	89 f0                	mov    %esi,%eax
+f0102278:	e8 24 ee ff ff       	call   f01010a1 <boot_alloc>
+f010227d:	89 c2                	mov    %eax,%edx
+	while (n-- > 0) {
+f010227f:	8d 4f ff             	lea    -0x1(%edi),%ecx
+f0102282:	83 c4 10             	add    $0x10,%esp
+f0102285:	85 ff                	test   %edi,%edi
+f0102287:	74 32                	je     f01022bb <mem_init+0x155>
+f0102289:	8b 3d 44 c2 92 f0    	mov    0xf092c244,%edi
+f010228f:	8d 44 30 f4          	lea    -0xc(%eax,%esi,1),%eax
+		rmaps[n].rm_next = rmap_free_list;
+f0102293:	89 fe                	mov    %edi,%esi
+f0102295:	89 c7                	mov    %eax,%edi
+f0102297:	89 30                	mov    %esi,(%eax)
+	while (n-- > 0) {
+f0102299:	83 e8 0c             	sub    $0xc,%eax
+f010229c:	39 d7                	cmp    %edx,%edi
+f010229e:	75 f3                	jne    f0102293 <mem_init+0x12d>
+		rmap_free_list = &rmaps[n];
+f01022a0:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+f01022a7:	29 c3                	sub    %eax,%ebx
+f01022a9:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+f01022ac:	c1 e0 02             	shl    $0x2,%eax
+f01022af:	8d 44 d8 0c          	lea    0xc(%eax,%ebx,8),%eax
+f01022b3:	01 c2                	add    %eax,%edx
+f01022b5:	89 15 44 c2 92 f0    	mov    %edx,0xf092c244
+	envs = (struct Env *)boot_alloc(NENV *sizeof(struct Env));
+f01022bb:	b8 00 f0 02 00       	mov    $0x2f000,%eax
+f01022c0:	e8 dc ed ff ff       	call   f01010a1 <boot_alloc>
+f01022c5:	a3 50 c2 92 f0       	mov    %eax,0xf092c250
+	page_init();
+f01022ca:	e8 1d f2 ff ff       	call   f01014ec <page_init>
+	check_page_free_list(1);
+f01022cf:	b8 01 00 00 00       	mov    $0x1,%eax
+f01022d4:	e8 0f ef ff ff       	call   f01011e8 <check_page_free_list>
+	if (!pages)
+f01022d9:	83 3d f4 f3 92 f0 00 	cmpl   $0x0,0xf092f3f4
+f01022e0:	0f 84 f2 09 00 00    	je     f0102cd8 <mem_init+0xb72>
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f01022e6:	a1 48 c2 92 f0       	mov    0xf092c248,%eax
+f01022eb:	85 c0                	test   %eax,%eax
+f01022ed:	0f 84 fc 09 00 00    	je     f0102cef <mem_init+0xb89>
+f01022f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		++nfree;
+f01022f8:	83 c3 01             	add    $0x1,%ebx
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f01022fb:	8b 00                	mov    (%eax),%eax
+f01022fd:	85 c0                	test   %eax,%eax
+f01022ff:	75 f7                	jne    f01022f8 <mem_init+0x192>
+	assert((pp0 = page_alloc(0)));
+f0102301:	83 ec 0c             	sub    $0xc,%esp
+f0102304:	6a 00                	push   $0x0
+f0102306:	e8 80 f5 ff ff       	call   f010188b <page_alloc>
+f010230b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010230e:	83 c4 10             	add    $0x10,%esp
+f0102311:	85 c0                	test   %eax,%eax
+f0102313:	0f 84 e0 09 00 00    	je     f0102cf9 <mem_init+0xb93>
+	assert((pp1 = page_alloc(0)));
+f0102319:	83 ec 0c             	sub    $0xc,%esp
+f010231c:	6a 00                	push   $0x0
+f010231e:	e8 68 f5 ff ff       	call   f010188b <page_alloc>
+f0102323:	89 c7                	mov    %eax,%edi
+f0102325:	83 c4 10             	add    $0x10,%esp
+f0102328:	85 c0                	test   %eax,%eax
+f010232a:	0f 84 e2 09 00 00    	je     f0102d12 <mem_init+0xbac>
+	assert((pp2 = page_alloc(0)));
+f0102330:	83 ec 0c             	sub    $0xc,%esp
+f0102333:	6a 00                	push   $0x0
+f0102335:	e8 51 f5 ff ff       	call   f010188b <page_alloc>
+f010233a:	89 c6                	mov    %eax,%esi
+f010233c:	83 c4 10             	add    $0x10,%esp
+f010233f:	85 c0                	test   %eax,%eax
+f0102341:	0f 84 e4 09 00 00    	je     f0102d2b <mem_init+0xbc5>
+	assert(pp1 && pp1 != pp0);
+f0102347:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f010234a:	0f 84 f4 09 00 00    	je     f0102d44 <mem_init+0xbde>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102350:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0102353:	0f 84 04 0a 00 00    	je     f0102d5d <mem_init+0xbf7>
+f0102359:	39 c7                	cmp    %eax,%edi
+f010235b:	0f 84 fc 09 00 00    	je     f0102d5d <mem_init+0xbf7>
+	return (pp - pages) << PGSHIFT;
+f0102361:	8b 0d f4 f3 92 f0    	mov    0xf092f3f4,%ecx
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0102367:	a1 ec f3 92 f0       	mov    0xf092f3ec,%eax
+f010236c:	c1 e0 0c             	shl    $0xc,%eax
+f010236f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0102372:	29 ca                	sub    %ecx,%edx
+f0102374:	c1 fa 04             	sar    $0x4,%edx
+f0102377:	c1 e2 0c             	shl    $0xc,%edx
+f010237a:	39 c2                	cmp    %eax,%edx
+f010237c:	0f 83 f4 09 00 00    	jae    f0102d76 <mem_init+0xc10>
+f0102382:	89 fa                	mov    %edi,%edx
+f0102384:	29 ca                	sub    %ecx,%edx
+f0102386:	c1 fa 04             	sar    $0x4,%edx
+f0102389:	c1 e2 0c             	shl    $0xc,%edx
+	assert(page2pa(pp1) < npages*PGSIZE);
+f010238c:	39 c2                	cmp    %eax,%edx
+f010238e:	0f 83 fb 09 00 00    	jae    f0102d8f <mem_init+0xc29>
+f0102394:	89 f2                	mov    %esi,%edx
+f0102396:	29 ca                	sub    %ecx,%edx
+f0102398:	c1 fa 04             	sar    $0x4,%edx
+f010239b:	c1 e2 0c             	shl    $0xc,%edx
+	assert(page2pa(pp2) < npages*PGSIZE);
+f010239e:	39 c2                	cmp    %eax,%edx
+f01023a0:	0f 83 02 0a 00 00    	jae    f0102da8 <mem_init+0xc42>
+	fl = page_free_list;
+f01023a6:	a1 48 c2 92 f0       	mov    0xf092c248,%eax
+f01023ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	page_free_list = 0;
+f01023ae:	c7 05 48 c2 92 f0 00 	movl   $0x0,0xf092c248
+f01023b5:	00 00 00 
+	assert(!page_alloc(0));
+f01023b8:	83 ec 0c             	sub    $0xc,%esp
+f01023bb:	6a 00                	push   $0x0
+f01023bd:	e8 c9 f4 ff ff       	call   f010188b <page_alloc>
+f01023c2:	83 c4 10             	add    $0x10,%esp
+f01023c5:	85 c0                	test   %eax,%eax
+f01023c7:	0f 85 f4 09 00 00    	jne    f0102dc1 <mem_init+0xc5b>
+	page_free(pp0);
+f01023cd:	83 ec 0c             	sub    $0xc,%esp
+f01023d0:	ff 75 d4             	push   -0x2c(%ebp)
+f01023d3:	e8 5c f2 ff ff       	call   f0101634 <page_free>
+	page_free(pp1);
+f01023d8:	89 3c 24             	mov    %edi,(%esp)
+f01023db:	e8 54 f2 ff ff       	call   f0101634 <page_free>
+	page_free(pp2);
+f01023e0:	89 34 24             	mov    %esi,(%esp)
+f01023e3:	e8 4c f2 ff ff       	call   f0101634 <page_free>
+	assert((pp0 = page_alloc(0)));
+f01023e8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f01023ef:	e8 97 f4 ff ff       	call   f010188b <page_alloc>
+f01023f4:	89 c6                	mov    %eax,%esi
+f01023f6:	83 c4 10             	add    $0x10,%esp
+f01023f9:	85 c0                	test   %eax,%eax
+f01023fb:	0f 84 d9 09 00 00    	je     f0102dda <mem_init+0xc74>
+	assert((pp1 = page_alloc(0)));
+f0102401:	83 ec 0c             	sub    $0xc,%esp
+f0102404:	6a 00                	push   $0x0
+f0102406:	e8 80 f4 ff ff       	call   f010188b <page_alloc>
+f010240b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010240e:	83 c4 10             	add    $0x10,%esp
+f0102411:	85 c0                	test   %eax,%eax
+f0102413:	0f 84 da 09 00 00    	je     f0102df3 <mem_init+0xc8d>
+	assert((pp2 = page_alloc(0)));
+f0102419:	83 ec 0c             	sub    $0xc,%esp
+f010241c:	6a 00                	push   $0x0
+f010241e:	e8 68 f4 ff ff       	call   f010188b <page_alloc>
+f0102423:	89 c7                	mov    %eax,%edi
+f0102425:	83 c4 10             	add    $0x10,%esp
+f0102428:	85 c0                	test   %eax,%eax
+f010242a:	0f 84 dc 09 00 00    	je     f0102e0c <mem_init+0xca6>
+	assert(pp1 && pp1 != pp0);
+f0102430:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102433:	39 c6                	cmp    %eax,%esi
+f0102435:	0f 84 ea 09 00 00    	je     f0102e25 <mem_init+0xcbf>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010243b:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f010243e:	0f 84 fa 09 00 00    	je     f0102e3e <mem_init+0xcd8>
+f0102444:	39 fe                	cmp    %edi,%esi
+f0102446:	0f 84 f2 09 00 00    	je     f0102e3e <mem_init+0xcd8>
+	assert(!page_alloc(0));
+f010244c:	83 ec 0c             	sub    $0xc,%esp
+f010244f:	6a 00                	push   $0x0
+f0102451:	e8 35 f4 ff ff       	call   f010188b <page_alloc>
+f0102456:	83 c4 10             	add    $0x10,%esp
+f0102459:	85 c0                	test   %eax,%eax
+f010245b:	0f 85 f6 09 00 00    	jne    f0102e57 <mem_init+0xcf1>
+f0102461:	89 f0                	mov    %esi,%eax
+f0102463:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0102469:	c1 f8 04             	sar    $0x4,%eax
+f010246c:	89 c2                	mov    %eax,%edx
+f010246e:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0102471:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102476:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f010247c:	0f 83 ee 09 00 00    	jae    f0102e70 <mem_init+0xd0a>
+	memset(page2kva(pp0), 1, PGSIZE);
+f0102482:	83 ec 04             	sub    $0x4,%esp
+f0102485:	68 00 10 00 00       	push   $0x1000
+f010248a:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f010248c:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0102492:	52                   	push   %edx
+f0102493:	e8 06 58 00 00       	call   f0107c9e <memset>
+	page_free(pp0);
+f0102498:	89 34 24             	mov    %esi,(%esp)
+f010249b:	e8 94 f1 ff ff       	call   f0101634 <page_free>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f01024a0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01024a7:	e8 df f3 ff ff       	call   f010188b <page_alloc>
+f01024ac:	83 c4 10             	add    $0x10,%esp
+f01024af:	85 c0                	test   %eax,%eax
+f01024b1:	0f 84 cb 09 00 00    	je     f0102e82 <mem_init+0xd1c>
+	assert(pp && pp0 == pp);
+f01024b7:	39 c6                	cmp    %eax,%esi
+f01024b9:	0f 85 dc 09 00 00    	jne    f0102e9b <mem_init+0xd35>
+	return (pp - pages) << PGSHIFT;
+f01024bf:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01024c5:	c1 f8 04             	sar    $0x4,%eax
+f01024c8:	89 c2                	mov    %eax,%edx
+f01024ca:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01024cd:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01024d2:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f01024d8:	0f 83 d6 09 00 00    	jae    f0102eb4 <mem_init+0xd4e>
+	return (void *)(pa + KERNBASE);
+f01024de:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+	for (i = 0; i < PGSIZE; i++)
+f01024e4:	81 ea 00 f0 ff 0f    	sub    $0xffff000,%edx
+		assert(c[i] == 0);
+f01024ea:	80 38 00             	cmpb   $0x0,(%eax)
+f01024ed:	0f 85 d3 09 00 00    	jne    f0102ec6 <mem_init+0xd60>
+	for (i = 0; i < PGSIZE; i++)
+f01024f3:	83 c0 01             	add    $0x1,%eax
+f01024f6:	39 d0                	cmp    %edx,%eax
+f01024f8:	75 f0                	jne    f01024ea <mem_init+0x384>
+	page_free_list = fl;
+f01024fa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01024fd:	a3 48 c2 92 f0       	mov    %eax,0xf092c248
+	page_free(pp0);
+f0102502:	83 ec 0c             	sub    $0xc,%esp
+f0102505:	56                   	push   %esi
+f0102506:	e8 29 f1 ff ff       	call   f0101634 <page_free>
+	page_free(pp1);
+f010250b:	83 c4 04             	add    $0x4,%esp
+f010250e:	ff 75 d4             	push   -0x2c(%ebp)
+f0102511:	e8 1e f1 ff ff       	call   f0101634 <page_free>
+	page_free(pp2);
+f0102516:	89 3c 24             	mov    %edi,(%esp)
+f0102519:	e8 16 f1 ff ff       	call   f0101634 <page_free>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f010251e:	a1 48 c2 92 f0       	mov    0xf092c248,%eax
+f0102523:	83 c4 10             	add    $0x10,%esp
+f0102526:	85 c0                	test   %eax,%eax
+f0102528:	74 09                	je     f0102533 <mem_init+0x3cd>
+		--nfree;
+f010252a:	83 eb 01             	sub    $0x1,%ebx
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f010252d:	8b 00                	mov    (%eax),%eax
+f010252f:	85 c0                	test   %eax,%eax
+f0102531:	75 f7                	jne    f010252a <mem_init+0x3c4>
+	assert(nfree == 0);
+f0102533:	85 db                	test   %ebx,%ebx
+f0102535:	0f 85 a4 09 00 00    	jne    f0102edf <mem_init+0xd79>
+	cprintf("check_page_alloc() succeeded!\n");
+f010253b:	83 ec 0c             	sub    $0xc,%esp
+f010253e:	68 40 bd 10 f0       	push   $0xf010bd40
+f0102543:	e8 a4 21 00 00       	call   f01046ec <cprintf>
+	int i;
+	extern pde_t entry_pgdir[];
+
+	// should be able to allocate three pages
+	pp0 = pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f0102548:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f010254f:	e8 37 f3 ff ff       	call   f010188b <page_alloc>
+f0102554:	89 c7                	mov    %eax,%edi
+f0102556:	83 c4 10             	add    $0x10,%esp
+f0102559:	85 c0                	test   %eax,%eax
+f010255b:	0f 84 97 09 00 00    	je     f0102ef8 <mem_init+0xd92>
+	assert((pp1 = page_alloc(0)));
+f0102561:	83 ec 0c             	sub    $0xc,%esp
+f0102564:	6a 00                	push   $0x0
+f0102566:	e8 20 f3 ff ff       	call   f010188b <page_alloc>
+f010256b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010256e:	83 c4 10             	add    $0x10,%esp
+f0102571:	85 c0                	test   %eax,%eax
+f0102573:	0f 84 98 09 00 00    	je     f0102f11 <mem_init+0xdab>
+	assert((pp2 = page_alloc(0)));
+f0102579:	83 ec 0c             	sub    $0xc,%esp
+f010257c:	6a 00                	push   $0x0
+f010257e:	e8 08 f3 ff ff       	call   f010188b <page_alloc>
+f0102583:	89 c3                	mov    %eax,%ebx
+f0102585:	83 c4 10             	add    $0x10,%esp
+f0102588:	85 c0                	test   %eax,%eax
+f010258a:	0f 84 9a 09 00 00    	je     f0102f2a <mem_init+0xdc4>
+
+	assert(pp0);
+	assert(pp1 && pp1 != pp0);
+f0102590:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102593:	39 c7                	cmp    %eax,%edi
+f0102595:	0f 84 a8 09 00 00    	je     f0102f43 <mem_init+0xddd>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010259b:	39 df                	cmp    %ebx,%edi
+f010259d:	0f 84 b9 09 00 00    	je     f0102f5c <mem_init+0xdf6>
+f01025a3:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+f01025a6:	0f 84 b0 09 00 00    	je     f0102f5c <mem_init+0xdf6>
+
+	// temporarily steal the rest of the free pages
+	fl = page_free_list;
+f01025ac:	a1 48 c2 92 f0       	mov    0xf092c248,%eax
+f01025b1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	page_free_list = 0;
+f01025b4:	c7 05 48 c2 92 f0 00 	movl   $0x0,0xf092c248
+f01025bb:	00 00 00 
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f01025be:	83 ec 0c             	sub    $0xc,%esp
+f01025c1:	6a 00                	push   $0x0
+f01025c3:	e8 c3 f2 ff ff       	call   f010188b <page_alloc>
+f01025c8:	83 c4 10             	add    $0x10,%esp
+f01025cb:	85 c0                	test   %eax,%eax
+f01025cd:	0f 85 a2 09 00 00    	jne    f0102f75 <mem_init+0xe0f>
+
+	// there is no page allocated at address 0
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f01025d3:	83 ec 04             	sub    $0x4,%esp
+f01025d6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01025d9:	50                   	push   %eax
+f01025da:	6a 00                	push   $0x0
+f01025dc:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f01025e2:	e8 a8 f4 ff ff       	call   f0101a8f <page_lookup>
+f01025e7:	83 c4 10             	add    $0x10,%esp
+f01025ea:	85 c0                	test   %eax,%eax
+f01025ec:	0f 85 9c 09 00 00    	jne    f0102f8e <mem_init+0xe28>
+
+	// there is no free memory, so we can't allocate a page table
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f01025f2:	6a 02                	push   $0x2
+f01025f4:	6a 00                	push   $0x0
+f01025f6:	ff 75 d4             	push   -0x2c(%ebp)
+f01025f9:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f01025ff:	e8 87 fa ff ff       	call   f010208b <page_insert>
+f0102604:	83 c4 10             	add    $0x10,%esp
+f0102607:	85 c0                	test   %eax,%eax
+f0102609:	0f 89 98 09 00 00    	jns    f0102fa7 <mem_init+0xe41>
+
+	// free pp0 and try again: pp0 should be used for page table
+	page_free(pp0);
+f010260f:	83 ec 0c             	sub    $0xc,%esp
+f0102612:	57                   	push   %edi
+f0102613:	e8 1c f0 ff ff       	call   f0101634 <page_free>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102618:	6a 02                	push   $0x2
+f010261a:	6a 00                	push   $0x0
+f010261c:	ff 75 d4             	push   -0x2c(%ebp)
+f010261f:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102625:	e8 61 fa ff ff       	call   f010208b <page_insert>
+f010262a:	83 c4 20             	add    $0x20,%esp
+f010262d:	85 c0                	test   %eax,%eax
+f010262f:	0f 85 8b 09 00 00    	jne    f0102fc0 <mem_init+0xe5a>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102635:	8b 35 f0 f3 92 f0    	mov    0xf092f3f0,%esi
+	return (pp - pages) << PGSHIFT;
+f010263b:	8b 0d f4 f3 92 f0    	mov    0xf092f3f4,%ecx
+f0102641:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f0102644:	8b 16                	mov    (%esi),%edx
+f0102646:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010264c:	89 f8                	mov    %edi,%eax
+f010264e:	29 c8                	sub    %ecx,%eax
+f0102650:	c1 f8 04             	sar    $0x4,%eax
+f0102653:	c1 e0 0c             	shl    $0xc,%eax
+f0102656:	39 c2                	cmp    %eax,%edx
+f0102658:	0f 85 7b 09 00 00    	jne    f0102fd9 <mem_init+0xe73>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f010265e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102663:	89 f0                	mov    %esi,%eax
+f0102665:	e8 95 ea ff ff       	call   f01010ff <check_va2pa>
+f010266a:	89 c2                	mov    %eax,%edx
+f010266c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010266f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0102672:	29 c8                	sub    %ecx,%eax
+f0102674:	c1 f8 04             	sar    $0x4,%eax
+f0102677:	c1 e0 0c             	shl    $0xc,%eax
+f010267a:	39 c2                	cmp    %eax,%edx
+f010267c:	0f 85 70 09 00 00    	jne    f0102ff2 <mem_init+0xe8c>
+	assert(pp1->pp_ref == 1);
+f0102682:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102685:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010268a:	0f 85 7b 09 00 00    	jne    f010300b <mem_init+0xea5>
+	assert(pp0->pp_ref == 1);
+f0102690:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102695:	0f 85 89 09 00 00    	jne    f0103024 <mem_init+0xebe>
+
+	// should be able to map pp2 at PGSIZE because pp0 is already allocated for page table
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f010269b:	6a 02                	push   $0x2
+f010269d:	68 00 10 00 00       	push   $0x1000
+f01026a2:	53                   	push   %ebx
+f01026a3:	56                   	push   %esi
+f01026a4:	e8 e2 f9 ff ff       	call   f010208b <page_insert>
+f01026a9:	83 c4 10             	add    $0x10,%esp
+f01026ac:	85 c0                	test   %eax,%eax
+f01026ae:	0f 85 89 09 00 00    	jne    f010303d <mem_init+0xed7>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01026b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01026b9:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+f01026be:	e8 3c ea ff ff       	call   f01010ff <check_va2pa>
+f01026c3:	89 c2                	mov    %eax,%edx
+f01026c5:	89 d8                	mov    %ebx,%eax
+f01026c7:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01026cd:	c1 f8 04             	sar    $0x4,%eax
+f01026d0:	c1 e0 0c             	shl    $0xc,%eax
+f01026d3:	39 c2                	cmp    %eax,%edx
+f01026d5:	0f 85 7b 09 00 00    	jne    f0103056 <mem_init+0xef0>
+	assert(pp2->pp_ref == 1);
+f01026db:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01026e0:	0f 85 89 09 00 00    	jne    f010306f <mem_init+0xf09>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f01026e6:	83 ec 0c             	sub    $0xc,%esp
+f01026e9:	6a 00                	push   $0x0
+f01026eb:	e8 9b f1 ff ff       	call   f010188b <page_alloc>
+f01026f0:	83 c4 10             	add    $0x10,%esp
+f01026f3:	85 c0                	test   %eax,%eax
+f01026f5:	0f 85 8d 09 00 00    	jne    f0103088 <mem_init+0xf22>
+
+	// should be able to map pp2 at PGSIZE because it's already there
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01026fb:	6a 02                	push   $0x2
+f01026fd:	68 00 10 00 00       	push   $0x1000
+f0102702:	53                   	push   %ebx
+f0102703:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102709:	e8 7d f9 ff ff       	call   f010208b <page_insert>
+f010270e:	83 c4 10             	add    $0x10,%esp
+f0102711:	85 c0                	test   %eax,%eax
+f0102713:	0f 85 88 09 00 00    	jne    f01030a1 <mem_init+0xf3b>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102719:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010271e:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+f0102723:	e8 d7 e9 ff ff       	call   f01010ff <check_va2pa>
+f0102728:	89 c2                	mov    %eax,%edx
+f010272a:	89 d8                	mov    %ebx,%eax
+f010272c:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0102732:	c1 f8 04             	sar    $0x4,%eax
+f0102735:	c1 e0 0c             	shl    $0xc,%eax
+f0102738:	39 c2                	cmp    %eax,%edx
+f010273a:	0f 85 7a 09 00 00    	jne    f01030ba <mem_init+0xf54>
+	assert(pp2->pp_ref == 1);
+f0102740:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0102745:	0f 85 88 09 00 00    	jne    f01030d3 <mem_init+0xf6d>
+
+	// pp2 should NOT be on the free list
+	// could happen in ref counts are handled sloppily in page_insert
+	assert(!page_alloc(0));
+f010274b:	83 ec 0c             	sub    $0xc,%esp
+f010274e:	6a 00                	push   $0x0
+f0102750:	e8 36 f1 ff ff       	call   f010188b <page_alloc>
+f0102755:	83 c4 10             	add    $0x10,%esp
+f0102758:	85 c0                	test   %eax,%eax
+f010275a:	0f 85 8c 09 00 00    	jne    f01030ec <mem_init+0xf86>
+
+	// check that pgdir_walk returns a pointer to the pte
+	ptep = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(PGSIZE)]));
+f0102760:	8b 15 f0 f3 92 f0    	mov    0xf092f3f0,%edx
+f0102766:	8b 02                	mov    (%edx),%eax
+f0102768:	89 c6                	mov    %eax,%esi
+f010276a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0102770:	c1 e8 0c             	shr    $0xc,%eax
+f0102773:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0102779:	0f 83 86 09 00 00    	jae    f0103105 <mem_init+0xf9f>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f010277f:	83 ec 04             	sub    $0x4,%esp
+f0102782:	6a 00                	push   $0x0
+f0102784:	68 00 10 00 00       	push   $0x1000
+f0102789:	52                   	push   %edx
+f010278a:	e8 a6 f1 ff ff       	call   f0101935 <pgdir_walk>
+f010278f:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0102795:	83 c4 10             	add    $0x10,%esp
+f0102798:	39 f0                	cmp    %esi,%eax
+f010279a:	0f 85 7a 09 00 00    	jne    f010311a <mem_init+0xfb4>
+
+	// should be able to change permissions too.
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f01027a0:	6a 06                	push   $0x6
+f01027a2:	68 00 10 00 00       	push   $0x1000
+f01027a7:	53                   	push   %ebx
+f01027a8:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f01027ae:	e8 d8 f8 ff ff       	call   f010208b <page_insert>
+f01027b3:	83 c4 10             	add    $0x10,%esp
+f01027b6:	85 c0                	test   %eax,%eax
+f01027b8:	0f 85 75 09 00 00    	jne    f0103133 <mem_init+0xfcd>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01027be:	8b 35 f0 f3 92 f0    	mov    0xf092f3f0,%esi
+f01027c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01027c9:	89 f0                	mov    %esi,%eax
+f01027cb:	e8 2f e9 ff ff       	call   f01010ff <check_va2pa>
+f01027d0:	89 c2                	mov    %eax,%edx
+	return (pp - pages) << PGSHIFT;
+f01027d2:	89 d8                	mov    %ebx,%eax
+f01027d4:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01027da:	c1 f8 04             	sar    $0x4,%eax
+f01027dd:	c1 e0 0c             	shl    $0xc,%eax
+f01027e0:	39 c2                	cmp    %eax,%edx
+f01027e2:	0f 85 64 09 00 00    	jne    f010314c <mem_init+0xfe6>
+	assert(pp2->pp_ref == 1);
+f01027e8:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01027ed:	0f 85 72 09 00 00    	jne    f0103165 <mem_init+0xfff>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f01027f3:	83 ec 04             	sub    $0x4,%esp
+f01027f6:	6a 00                	push   $0x0
+f01027f8:	68 00 10 00 00       	push   $0x1000
+f01027fd:	56                   	push   %esi
+f01027fe:	e8 32 f1 ff ff       	call   f0101935 <pgdir_walk>
+f0102803:	83 c4 10             	add    $0x10,%esp
+f0102806:	f6 00 04             	testb  $0x4,(%eax)
+f0102809:	0f 84 6f 09 00 00    	je     f010317e <mem_init+0x1018>
+	assert(kern_pgdir[0] & PTE_U);
+f010280f:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+f0102814:	f6 00 04             	testb  $0x4,(%eax)
+f0102817:	0f 84 7a 09 00 00    	je     f0103197 <mem_init+0x1031>
+
+	// should not be able to map at PTSIZE because need free page for page table
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f010281d:	6a 02                	push   $0x2
+f010281f:	68 00 00 40 00       	push   $0x400000
+f0102824:	57                   	push   %edi
+f0102825:	50                   	push   %eax
+f0102826:	e8 60 f8 ff ff       	call   f010208b <page_insert>
+f010282b:	83 c4 10             	add    $0x10,%esp
+f010282e:	85 c0                	test   %eax,%eax
+f0102830:	0f 89 7a 09 00 00    	jns    f01031b0 <mem_init+0x104a>
+
+	// insert pp1 at PGSIZE (replacing pp2)
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f0102836:	6a 02                	push   $0x2
+f0102838:	68 00 10 00 00       	push   $0x1000
+f010283d:	ff 75 d4             	push   -0x2c(%ebp)
+f0102840:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102846:	e8 40 f8 ff ff       	call   f010208b <page_insert>
+f010284b:	83 c4 10             	add    $0x10,%esp
+f010284e:	85 c0                	test   %eax,%eax
+f0102850:	0f 85 73 09 00 00    	jne    f01031c9 <mem_init+0x1063>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102856:	83 ec 04             	sub    $0x4,%esp
+f0102859:	6a 00                	push   $0x0
+f010285b:	68 00 10 00 00       	push   $0x1000
+f0102860:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102866:	e8 ca f0 ff ff       	call   f0101935 <pgdir_walk>
+f010286b:	83 c4 10             	add    $0x10,%esp
+f010286e:	f6 00 04             	testb  $0x4,(%eax)
+f0102871:	0f 85 6b 09 00 00    	jne    f01031e2 <mem_init+0x107c>
+
+	// should have pp1 at both 0 and PGSIZE, pp2 nowhere, ...
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0102877:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+f010287c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f010287f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102884:	e8 76 e8 ff ff       	call   f01010ff <check_va2pa>
+f0102889:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f010288c:	2b 35 f4 f3 92 f0    	sub    0xf092f3f4,%esi
+f0102892:	c1 fe 04             	sar    $0x4,%esi
+f0102895:	c1 e6 0c             	shl    $0xc,%esi
+f0102898:	39 f0                	cmp    %esi,%eax
+f010289a:	0f 85 5b 09 00 00    	jne    f01031fb <mem_init+0x1095>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f01028a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01028a5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01028a8:	e8 52 e8 ff ff       	call   f01010ff <check_va2pa>
+f01028ad:	39 c6                	cmp    %eax,%esi
+f01028af:	0f 85 5f 09 00 00    	jne    f0103214 <mem_init+0x10ae>
+	// ... and ref counts should reflect this
+	assert(pp1->pp_ref == 2);
+f01028b5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01028b8:	66 83 78 04 02       	cmpw   $0x2,0x4(%eax)
+f01028bd:	0f 85 6a 09 00 00    	jne    f010322d <mem_init+0x10c7>
+	assert(pp2->pp_ref == 0);
+f01028c3:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f01028c8:	0f 85 78 09 00 00    	jne    f0103246 <mem_init+0x10e0>
+
+	// pp2 should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp2);
+f01028ce:	83 ec 0c             	sub    $0xc,%esp
+f01028d1:	6a 00                	push   $0x0
+f01028d3:	e8 b3 ef ff ff       	call   f010188b <page_alloc>
+f01028d8:	83 c4 10             	add    $0x10,%esp
+f01028db:	85 c0                	test   %eax,%eax
+f01028dd:	0f 84 7c 09 00 00    	je     f010325f <mem_init+0x10f9>
+f01028e3:	39 c3                	cmp    %eax,%ebx
+f01028e5:	0f 85 74 09 00 00    	jne    f010325f <mem_init+0x10f9>
+
+	// unmapping pp1 at 0 should keep pp1 at PGSIZE
+	page_remove(kern_pgdir, 0x0);
+f01028eb:	83 ec 08             	sub    $0x8,%esp
+f01028ee:	6a 00                	push   $0x0
+f01028f0:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f01028f6:	e8 1d f6 ff ff       	call   f0101f18 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01028fb:	8b 35 f0 f3 92 f0    	mov    0xf092f3f0,%esi
+f0102901:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102906:	89 f0                	mov    %esi,%eax
+f0102908:	e8 f2 e7 ff ff       	call   f01010ff <check_va2pa>
+f010290d:	83 c4 10             	add    $0x10,%esp
+f0102910:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102913:	0f 85 5f 09 00 00    	jne    f0103278 <mem_init+0x1112>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102919:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010291e:	89 f0                	mov    %esi,%eax
+f0102920:	e8 da e7 ff ff       	call   f01010ff <check_va2pa>
+f0102925:	89 c2                	mov    %eax,%edx
+f0102927:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010292a:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0102930:	c1 f8 04             	sar    $0x4,%eax
+f0102933:	c1 e0 0c             	shl    $0xc,%eax
+f0102936:	39 c2                	cmp    %eax,%edx
+f0102938:	0f 85 53 09 00 00    	jne    f0103291 <mem_init+0x112b>
+	assert(pp1->pp_ref == 1);
+f010293e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102941:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0102946:	0f 85 5e 09 00 00    	jne    f01032aa <mem_init+0x1144>
+	assert(pp2->pp_ref == 0);
+f010294c:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102951:	0f 85 6c 09 00 00    	jne    f01032c3 <mem_init+0x115d>
+
+	// unmapping pp1 at PGSIZE should free it
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f0102957:	83 ec 08             	sub    $0x8,%esp
+f010295a:	68 00 10 00 00       	push   $0x1000
+f010295f:	56                   	push   %esi
+f0102960:	e8 b3 f5 ff ff       	call   f0101f18 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102965:	8b 35 f0 f3 92 f0    	mov    0xf092f3f0,%esi
+f010296b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102970:	89 f0                	mov    %esi,%eax
+f0102972:	e8 88 e7 ff ff       	call   f01010ff <check_va2pa>
+f0102977:	83 c4 10             	add    $0x10,%esp
+f010297a:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010297d:	0f 85 59 09 00 00    	jne    f01032dc <mem_init+0x1176>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102983:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102988:	89 f0                	mov    %esi,%eax
+f010298a:	e8 70 e7 ff ff       	call   f01010ff <check_va2pa>
+f010298f:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102992:	0f 85 5d 09 00 00    	jne    f01032f5 <mem_init+0x118f>
+	assert(pp1->pp_ref == 0);
+f0102998:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010299b:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f01029a0:	0f 85 68 09 00 00    	jne    f010330e <mem_init+0x11a8>
+	assert(pp2->pp_ref == 0);
+f01029a6:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f01029ab:	0f 85 76 09 00 00    	jne    f0103327 <mem_init+0x11c1>
+
+	// so it should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp1);
+f01029b1:	83 ec 0c             	sub    $0xc,%esp
+f01029b4:	6a 00                	push   $0x0
+f01029b6:	e8 d0 ee ff ff       	call   f010188b <page_alloc>
+f01029bb:	83 c4 10             	add    $0x10,%esp
+f01029be:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f01029c1:	0f 85 79 09 00 00    	jne    f0103340 <mem_init+0x11da>
+f01029c7:	85 c0                	test   %eax,%eax
+f01029c9:	0f 84 71 09 00 00    	je     f0103340 <mem_init+0x11da>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f01029cf:	83 ec 0c             	sub    $0xc,%esp
+f01029d2:	6a 00                	push   $0x0
+f01029d4:	e8 b2 ee ff ff       	call   f010188b <page_alloc>
+f01029d9:	83 c4 10             	add    $0x10,%esp
+f01029dc:	85 c0                	test   %eax,%eax
+f01029de:	0f 85 75 09 00 00    	jne    f0103359 <mem_init+0x11f3>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01029e4:	8b 0d f0 f3 92 f0    	mov    0xf092f3f0,%ecx
+f01029ea:	8b 11                	mov    (%ecx),%edx
+f01029ec:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01029f2:	89 f8                	mov    %edi,%eax
+f01029f4:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01029fa:	c1 f8 04             	sar    $0x4,%eax
+f01029fd:	c1 e0 0c             	shl    $0xc,%eax
+f0102a00:	39 c2                	cmp    %eax,%edx
+f0102a02:	0f 85 6a 09 00 00    	jne    f0103372 <mem_init+0x120c>
+	kern_pgdir[0] = 0;
+f0102a08:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f0102a0e:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102a13:	0f 85 72 09 00 00    	jne    f010338b <mem_init+0x1225>
+	pp0->pp_ref = 0;
+f0102a19:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+
+	// check pointer arithmetic in pgdir_walk
+	page_free(pp0);
+f0102a1f:	83 ec 0c             	sub    $0xc,%esp
+f0102a22:	57                   	push   %edi
+f0102a23:	e8 0c ec ff ff       	call   f0101634 <page_free>
+	va = (void*)(PGSIZE * NPDENTRIES + PGSIZE);
+	ptep = pgdir_walk(kern_pgdir, va, 1);
+f0102a28:	83 c4 0c             	add    $0xc,%esp
+f0102a2b:	6a 01                	push   $0x1
+f0102a2d:	68 00 10 40 00       	push   $0x401000
+f0102a32:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102a38:	e8 f8 ee ff ff       	call   f0101935 <pgdir_walk>
+f0102a3d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	ptep1 = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(va)]));
+f0102a40:	8b 0d f0 f3 92 f0    	mov    0xf092f3f0,%ecx
+f0102a46:	8b 41 04             	mov    0x4(%ecx),%eax
+f0102a49:	89 c6                	mov    %eax,%esi
+f0102a4b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0102a51:	8b 15 ec f3 92 f0    	mov    0xf092f3ec,%edx
+f0102a57:	c1 e8 0c             	shr    $0xc,%eax
+f0102a5a:	83 c4 10             	add    $0x10,%esp
+f0102a5d:	39 d0                	cmp    %edx,%eax
+f0102a5f:	0f 83 3f 09 00 00    	jae    f01033a4 <mem_init+0x123e>
+	assert(ptep == ptep1 + PTX(va));
+f0102a65:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0102a6b:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+f0102a6e:	0f 85 45 09 00 00    	jne    f01033b9 <mem_init+0x1253>
+	kern_pgdir[PDX(va)] = 0;
+f0102a74:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+	pp0->pp_ref = 0;
+f0102a7b:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+	return (pp - pages) << PGSHIFT;
+f0102a81:	89 f8                	mov    %edi,%eax
+f0102a83:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0102a89:	c1 f8 04             	sar    $0x4,%eax
+f0102a8c:	89 c1                	mov    %eax,%ecx
+f0102a8e:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102a91:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102a96:	39 d0                	cmp    %edx,%eax
+f0102a98:	0f 83 34 09 00 00    	jae    f01033d2 <mem_init+0x126c>
+
+	// check that new page tables get cleared
+	memset(page2kva(pp0), 0xFF, PGSIZE);
+f0102a9e:	83 ec 04             	sub    $0x4,%esp
+f0102aa1:	68 00 10 00 00       	push   $0x1000
+f0102aa6:	68 ff 00 00 00       	push   $0xff
+	return (void *)(pa + KERNBASE);
+f0102aab:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0102ab1:	51                   	push   %ecx
+f0102ab2:	e8 e7 51 00 00       	call   f0107c9e <memset>
+	page_free(pp0);
+f0102ab7:	89 3c 24             	mov    %edi,(%esp)
+f0102aba:	e8 75 eb ff ff       	call   f0101634 <page_free>
+	pgdir_walk(kern_pgdir, 0x0, 1);
+f0102abf:	83 c4 0c             	add    $0xc,%esp
+f0102ac2:	6a 01                	push   $0x1
+f0102ac4:	6a 00                	push   $0x0
+f0102ac6:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102acc:	e8 64 ee ff ff       	call   f0101935 <pgdir_walk>
+	return (pp - pages) << PGSHIFT;
+f0102ad1:	89 f8                	mov    %edi,%eax
+f0102ad3:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0102ad9:	c1 f8 04             	sar    $0x4,%eax
+f0102adc:	89 c2                	mov    %eax,%edx
+f0102ade:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0102ae1:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102ae6:	83 c4 10             	add    $0x10,%esp
+f0102ae9:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0102aef:	0f 83 ef 08 00 00    	jae    f01033e4 <mem_init+0x127e>
+	return (void *)(pa + KERNBASE);
+f0102af5:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+	ptep = (pte_t *) page2kva(pp0);
+	for(i=0; i<NPTENTRIES; i++)
+f0102afb:	81 ea 00 f0 ff 0f    	sub    $0xffff000,%edx
+		assert((ptep[i] & PTE_P) == 0);
+f0102b01:	8b 08                	mov    (%eax),%ecx
+f0102b03:	83 e1 01             	and    $0x1,%ecx
+f0102b06:	0f 85 ea 08 00 00    	jne    f01033f6 <mem_init+0x1290>
+	for(i=0; i<NPTENTRIES; i++)
+f0102b0c:	83 c0 04             	add    $0x4,%eax
+f0102b0f:	39 d0                	cmp    %edx,%eax
+f0102b11:	75 ee                	jne    f0102b01 <mem_init+0x99b>
+	kern_pgdir[0] = 0;
+f0102b13:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f0102b16:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+f0102b1b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	pp0->pp_ref = 0;
+f0102b21:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+
+	// give free list back
+	page_free_list = fl;
+f0102b27:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0102b2a:	a3 48 c2 92 f0       	mov    %eax,0xf092c248
+
+	// free the pages we took
+	page_free(pp0);
+f0102b2f:	83 ec 0c             	sub    $0xc,%esp
+f0102b32:	57                   	push   %edi
+f0102b33:	e8 fc ea ff ff       	call   f0101634 <page_free>
+	page_free(pp1);
+f0102b38:	83 c4 04             	add    $0x4,%esp
+f0102b3b:	ff 75 d4             	push   -0x2c(%ebp)
+f0102b3e:	e8 f1 ea ff ff       	call   f0101634 <page_free>
+	page_free(pp2);
+f0102b43:	89 1c 24             	mov    %ebx,(%esp)
+f0102b46:	e8 e9 ea ff ff       	call   f0101634 <page_free>
+
+	cprintf("check_page() succeeded!\n");
+f0102b4b:	c7 04 24 74 bb 10 f0 	movl   $0xf010bb74,(%esp)
+f0102b52:	e8 95 1b 00 00       	call   f01046ec <cprintf>
+	size_t size = ROUNDUP(npages*sizeof(struct Page), PGSIZE);
+f0102b57:	a1 ec f3 92 f0       	mov    0xf092f3ec,%eax
+f0102b5c:	c1 e0 04             	shl    $0x4,%eax
+f0102b5f:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0102b64:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	boot_map_region(kern_pgdir, (uintptr_t)UPAGES, size, PADDR(pages), PTE_U | PTE_P | PTE_G);
+f0102b69:	8b 15 f4 f3 92 f0    	mov    0xf092f3f4,%edx
+	if ((uint32_t)kva < KERNBASE)
+f0102b6f:	83 c4 10             	add    $0x10,%esp
+f0102b72:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0102b78:	0f 86 91 08 00 00    	jbe    f010340f <mem_init+0x12a9>
+f0102b7e:	83 ec 0c             	sub    $0xc,%esp
+f0102b81:	68 05 01 00 00       	push   $0x105
+	return (physaddr_t)kva - KERNBASE;
+f0102b86:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+f0102b8c:	52                   	push   %edx
+f0102b8d:	50                   	push   %eax
+f0102b8e:	68 00 00 00 ef       	push   $0xef000000
+f0102b93:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102b99:	e8 78 ee ff ff       	call   f0101a16 <boot_map_region>
+	boot_map_region(kern_pgdir, (uintptr_t)UENVS, size, PADDR(envs), PTE_U | PTE_P | PTE_G);
+f0102b9e:	a1 50 c2 92 f0       	mov    0xf092c250,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102ba3:	83 c4 20             	add    $0x20,%esp
+f0102ba6:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102bab:	0f 86 73 08 00 00    	jbe    f0103424 <mem_init+0x12be>
+f0102bb1:	83 ec 0c             	sub    $0xc,%esp
+f0102bb4:	68 05 01 00 00       	push   $0x105
+	return (physaddr_t)kva - KERNBASE;
+f0102bb9:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102bbe:	50                   	push   %eax
+f0102bbf:	68 00 f0 02 00       	push   $0x2f000
+f0102bc4:	68 00 00 c0 ee       	push   $0xeec00000
+f0102bc9:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102bcf:	e8 42 ee ff ff       	call   f0101a16 <boot_map_region>
+	if ((uint32_t)kva < KERNBASE)
+f0102bd4:	83 c4 20             	add    $0x20,%esp
+f0102bd7:	b8 00 e0 10 f0       	mov    $0xf010e000,%eax
+f0102bdc:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102be1:	0f 86 52 08 00 00    	jbe    f0103439 <mem_init+0x12d3>
+	boot_map_region(kern_pgdir, KSTACKTOP-KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W | PTE_P | PTE_G);
+f0102be7:	83 ec 0c             	sub    $0xc,%esp
+f0102bea:	68 03 01 00 00       	push   $0x103
+f0102bef:	68 00 e0 10 00       	push   $0x10e000
+f0102bf4:	68 00 80 00 00       	push   $0x8000
+f0102bf9:	68 00 80 bf ef       	push   $0xefbf8000
+f0102bfe:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102c04:	e8 0d ee ff ff       	call   f0101a16 <boot_map_region>
+	boot_map_region(kern_pgdir, (uintptr_t)KERNBASE, size, 0, PTE_W | PTE_P | PTE_G);
+f0102c09:	83 c4 14             	add    $0x14,%esp
+f0102c0c:	68 03 01 00 00       	push   $0x103
+f0102c11:	6a 00                	push   $0x0
+f0102c13:	68 00 00 00 10       	push   $0x10000000
+f0102c18:	68 00 00 00 f0       	push   $0xf0000000
+f0102c1d:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102c23:	e8 ee ed ff ff       	call   f0101a16 <boot_map_region>
+	boot_map_region(kern_pgdir, IOMEMBASE, -IOMEMBASE, IOMEM_PADDR, PTE_W | PTE_G);
+f0102c28:	83 c4 14             	add    $0x14,%esp
+f0102c2b:	68 02 01 00 00       	push   $0x102
+f0102c30:	68 00 00 00 fe       	push   $0xfe000000
+f0102c35:	68 00 00 00 02       	push   $0x2000000
+f0102c3a:	68 00 00 00 fe       	push   $0xfe000000
+f0102c3f:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102c45:	e8 cc ed ff ff       	call   f0101a16 <boot_map_region>
+f0102c4a:	b8 00 10 93 f0       	mov    $0xf0931000,%eax
+f0102c4f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102c52:	83 c4 20             	add    $0x20,%esp
+f0102c55:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102c5a:	0f 86 ee 07 00 00    	jbe    f010344e <mem_init+0x12e8>
+f0102c60:	be 00 90 96 f0       	mov    $0xf0969000,%esi
+f0102c65:	bb 00 10 93 f0       	mov    $0xf0931000,%ebx
+f0102c6a:	bf 00 80 bf ef       	mov    $0xefbf8000,%edi
+		boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W | PTE_P | PTE_G);
+f0102c6f:	83 ec 0c             	sub    $0xc,%esp
+f0102c72:	68 03 01 00 00       	push   $0x103
+	return (physaddr_t)kva - KERNBASE;
+f0102c77:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0102c7d:	50                   	push   %eax
+f0102c7e:	68 00 80 00 00       	push   $0x8000
+f0102c83:	57                   	push   %edi
+f0102c84:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0102c8a:	e8 87 ed ff ff       	call   f0101a16 <boot_map_region>
+	for(i = 0; i < NCPU; i++) {
+f0102c8f:	83 c4 20             	add    $0x20,%esp
+f0102c92:	39 f3                	cmp    %esi,%ebx
+f0102c94:	0f 84 be 07 00 00    	je     f0103458 <mem_init+0x12f2>
+		boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W | PTE_P | PTE_G);
+f0102c9a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+	if ((uint32_t)kva < KERNBASE)
+f0102ca0:	81 ef 00 00 01 00    	sub    $0x10000,%edi
+f0102ca6:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0102cac:	77 c1                	ja     f0102c6f <mem_init+0xb09>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102cae:	53                   	push   %ebx
+f0102caf:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0102cb4:	68 31 01 00 00       	push   $0x131
+f0102cb9:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102cbe:	e8 7d d3 ff ff       	call   f0100040 <_panic>
+f0102cc3:	50                   	push   %eax
+f0102cc4:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0102cc9:	68 9a 00 00 00       	push   $0x9a
+f0102cce:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102cd3:	e8 68 d3 ff ff       	call   f0100040 <_panic>
+		panic("'pages' is a null pointer!");
+f0102cd8:	83 ec 04             	sub    $0x4,%esp
+f0102cdb:	68 b1 b9 10 f0       	push   $0xf010b9b1
+f0102ce0:	68 13 04 00 00       	push   $0x413
+f0102ce5:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102cea:	e8 51 d3 ff ff       	call   f0100040 <_panic>
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0102cef:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0102cf4:	e9 08 f6 ff ff       	jmp    f0102301 <mem_init+0x19b>
+	assert((pp0 = page_alloc(0)));
+f0102cf9:	68 cc b9 10 f0       	push   $0xf010b9cc
+f0102cfe:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102d03:	68 1b 04 00 00       	push   $0x41b
+f0102d08:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102d0d:	e8 2e d3 ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102d12:	68 e2 b9 10 f0       	push   $0xf010b9e2
+f0102d17:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102d1c:	68 1c 04 00 00       	push   $0x41c
+f0102d21:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102d26:	e8 15 d3 ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0102d2b:	68 f8 b9 10 f0       	push   $0xf010b9f8
+f0102d30:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102d35:	68 1d 04 00 00       	push   $0x41d
+f0102d3a:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102d3f:	e8 fc d2 ff ff       	call   f0100040 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102d44:	68 0e ba 10 f0       	push   $0xf010ba0e
+f0102d49:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102d4e:	68 20 04 00 00       	push   $0x420
+f0102d53:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102d58:	e8 e3 d2 ff ff       	call   f0100040 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102d5d:	68 20 bd 10 f0       	push   $0xf010bd20
+f0102d62:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102d67:	68 21 04 00 00       	push   $0x421
+f0102d6c:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102d71:	e8 ca d2 ff ff       	call   f0100040 <_panic>
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0102d76:	68 20 ba 10 f0       	push   $0xf010ba20
+f0102d7b:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102d80:	68 22 04 00 00       	push   $0x422
+f0102d85:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102d8a:	e8 b1 d2 ff ff       	call   f0100040 <_panic>
+	assert(page2pa(pp1) < npages*PGSIZE);
+f0102d8f:	68 3d ba 10 f0       	push   $0xf010ba3d
+f0102d94:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102d99:	68 23 04 00 00       	push   $0x423
+f0102d9e:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102da3:	e8 98 d2 ff ff       	call   f0100040 <_panic>
+	assert(page2pa(pp2) < npages*PGSIZE);
+f0102da8:	68 5a ba 10 f0       	push   $0xf010ba5a
+f0102dad:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102db2:	68 24 04 00 00       	push   $0x424
+f0102db7:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102dbc:	e8 7f d2 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0102dc1:	68 77 ba 10 f0       	push   $0xf010ba77
+f0102dc6:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102dcb:	68 2b 04 00 00       	push   $0x42b
+f0102dd0:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102dd5:	e8 66 d2 ff ff       	call   f0100040 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0102dda:	68 cc b9 10 f0       	push   $0xf010b9cc
+f0102ddf:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102de4:	68 32 04 00 00       	push   $0x432
+f0102de9:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102dee:	e8 4d d2 ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102df3:	68 e2 b9 10 f0       	push   $0xf010b9e2
+f0102df8:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102dfd:	68 33 04 00 00       	push   $0x433
+f0102e02:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102e07:	e8 34 d2 ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0102e0c:	68 f8 b9 10 f0       	push   $0xf010b9f8
+f0102e11:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102e16:	68 34 04 00 00       	push   $0x434
+f0102e1b:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102e20:	e8 1b d2 ff ff       	call   f0100040 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102e25:	68 0e ba 10 f0       	push   $0xf010ba0e
+f0102e2a:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102e2f:	68 36 04 00 00       	push   $0x436
+f0102e34:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102e39:	e8 02 d2 ff ff       	call   f0100040 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102e3e:	68 20 bd 10 f0       	push   $0xf010bd20
+f0102e43:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102e48:	68 37 04 00 00       	push   $0x437
+f0102e4d:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102e52:	e8 e9 d1 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0102e57:	68 77 ba 10 f0       	push   $0xf010ba77
+f0102e5c:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102e61:	68 38 04 00 00       	push   $0x438
+f0102e66:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102e6b:	e8 d0 d1 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102e70:	52                   	push   %edx
+f0102e71:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0102e76:	6a 6e                	push   $0x6e
+f0102e78:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0102e7d:	e8 be d1 ff ff       	call   f0100040 <_panic>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f0102e82:	68 86 ba 10 f0       	push   $0xf010ba86
+f0102e87:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102e8c:	68 3d 04 00 00       	push   $0x43d
+f0102e91:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102e96:	e8 a5 d1 ff ff       	call   f0100040 <_panic>
+	assert(pp && pp0 == pp);
+f0102e9b:	68 a4 ba 10 f0       	push   $0xf010baa4
+f0102ea0:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102ea5:	68 3e 04 00 00       	push   $0x43e
+f0102eaa:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102eaf:	e8 8c d1 ff ff       	call   f0100040 <_panic>
+f0102eb4:	52                   	push   %edx
+f0102eb5:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0102eba:	6a 6e                	push   $0x6e
+f0102ebc:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0102ec1:	e8 7a d1 ff ff       	call   f0100040 <_panic>
+		assert(c[i] == 0);
+f0102ec6:	68 b4 ba 10 f0       	push   $0xf010bab4
+f0102ecb:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102ed0:	68 41 04 00 00       	push   $0x441
+f0102ed5:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102eda:	e8 61 d1 ff ff       	call   f0100040 <_panic>
+	assert(nfree == 0);
+f0102edf:	68 be ba 10 f0       	push   $0xf010babe
+f0102ee4:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102ee9:	68 4e 04 00 00       	push   $0x44e
+f0102eee:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102ef3:	e8 48 d1 ff ff       	call   f0100040 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0102ef8:	68 cc b9 10 f0       	push   $0xf010b9cc
+f0102efd:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102f02:	68 b7 04 00 00       	push   $0x4b7
+f0102f07:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102f0c:	e8 2f d1 ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102f11:	68 e2 b9 10 f0       	push   $0xf010b9e2
+f0102f16:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102f1b:	68 b8 04 00 00       	push   $0x4b8
+f0102f20:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102f25:	e8 16 d1 ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0102f2a:	68 f8 b9 10 f0       	push   $0xf010b9f8
+f0102f2f:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102f34:	68 b9 04 00 00       	push   $0x4b9
+f0102f39:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102f3e:	e8 fd d0 ff ff       	call   f0100040 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102f43:	68 0e ba 10 f0       	push   $0xf010ba0e
+f0102f48:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102f4d:	68 bc 04 00 00       	push   $0x4bc
+f0102f52:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102f57:	e8 e4 d0 ff ff       	call   f0100040 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102f5c:	68 20 bd 10 f0       	push   $0xf010bd20
+f0102f61:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102f66:	68 bd 04 00 00       	push   $0x4bd
+f0102f6b:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102f70:	e8 cb d0 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0102f75:	68 77 ba 10 f0       	push   $0xf010ba77
+f0102f7a:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102f7f:	68 c4 04 00 00       	push   $0x4c4
+f0102f84:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102f89:	e8 b2 d0 ff ff       	call   f0100040 <_panic>
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f0102f8e:	68 60 bd 10 f0       	push   $0xf010bd60
+f0102f93:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102f98:	68 c7 04 00 00       	push   $0x4c7
+f0102f9d:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102fa2:	e8 99 d0 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f0102fa7:	68 98 bd 10 f0       	push   $0xf010bd98
+f0102fac:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102fb1:	68 ca 04 00 00       	push   $0x4ca
+f0102fb6:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102fbb:	e8 80 d0 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102fc0:	68 c8 bd 10 f0       	push   $0xf010bdc8
+f0102fc5:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102fca:	68 ce 04 00 00       	push   $0x4ce
+f0102fcf:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102fd4:	e8 67 d0 ff ff       	call   f0100040 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102fd9:	68 f8 bd 10 f0       	push   $0xf010bdf8
+f0102fde:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102fe3:	68 cf 04 00 00       	push   $0x4cf
+f0102fe8:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0102fed:	e8 4e d0 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f0102ff2:	68 20 be 10 f0       	push   $0xf010be20
+f0102ff7:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0102ffc:	68 d0 04 00 00       	push   $0x4d0
+f0103001:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103006:	e8 35 d0 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 1);
+f010300b:	68 c9 ba 10 f0       	push   $0xf010bac9
+f0103010:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103015:	68 d1 04 00 00       	push   $0x4d1
+f010301a:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010301f:	e8 1c d0 ff ff       	call   f0100040 <_panic>
+	assert(pp0->pp_ref == 1);
+f0103024:	68 da ba 10 f0       	push   $0xf010bada
+f0103029:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010302e:	68 d2 04 00 00       	push   $0x4d2
+f0103033:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103038:	e8 03 d0 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f010303d:	68 50 be 10 f0       	push   $0xf010be50
+f0103042:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103047:	68 d5 04 00 00       	push   $0x4d5
+f010304c:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103051:	e8 ea cf ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0103056:	68 8c be 10 f0       	push   $0xf010be8c
+f010305b:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103060:	68 d6 04 00 00       	push   $0x4d6
+f0103065:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010306a:	e8 d1 cf ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f010306f:	68 eb ba 10 f0       	push   $0xf010baeb
+f0103074:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103079:	68 d7 04 00 00       	push   $0x4d7
+f010307e:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103083:	e8 b8 cf ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0103088:	68 77 ba 10 f0       	push   $0xf010ba77
+f010308d:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103092:	68 da 04 00 00       	push   $0x4da
+f0103097:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010309c:	e8 9f cf ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01030a1:	68 50 be 10 f0       	push   $0xf010be50
+f01030a6:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01030ab:	68 dd 04 00 00       	push   $0x4dd
+f01030b0:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01030b5:	e8 86 cf ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01030ba:	68 8c be 10 f0       	push   $0xf010be8c
+f01030bf:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01030c4:	68 de 04 00 00       	push   $0x4de
+f01030c9:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01030ce:	e8 6d cf ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f01030d3:	68 eb ba 10 f0       	push   $0xf010baeb
+f01030d8:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01030dd:	68 df 04 00 00       	push   $0x4df
+f01030e2:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01030e7:	e8 54 cf ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f01030ec:	68 77 ba 10 f0       	push   $0xf010ba77
+f01030f1:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01030f6:	68 e3 04 00 00       	push   $0x4e3
+f01030fb:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103100:	e8 3b cf ff ff       	call   f0100040 <_panic>
+f0103105:	56                   	push   %esi
+f0103106:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f010310b:	68 e6 04 00 00       	push   $0x4e6
+f0103110:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103115:	e8 26 cf ff ff       	call   f0100040 <_panic>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f010311a:	68 bc be 10 f0       	push   $0xf010bebc
+f010311f:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103124:	68 e7 04 00 00       	push   $0x4e7
+f0103129:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010312e:	e8 0d cf ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0103133:	68 fc be 10 f0       	push   $0xf010befc
+f0103138:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010313d:	68 ea 04 00 00       	push   $0x4ea
+f0103142:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103147:	e8 f4 ce ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010314c:	68 8c be 10 f0       	push   $0xf010be8c
+f0103151:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103156:	68 eb 04 00 00       	push   $0x4eb
+f010315b:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103160:	e8 db ce ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f0103165:	68 eb ba 10 f0       	push   $0xf010baeb
+f010316a:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010316f:	68 ec 04 00 00       	push   $0x4ec
+f0103174:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103179:	e8 c2 ce ff ff       	call   f0100040 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f010317e:	68 3c bf 10 f0       	push   $0xf010bf3c
+f0103183:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103188:	68 ed 04 00 00       	push   $0x4ed
+f010318d:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103192:	e8 a9 ce ff ff       	call   f0100040 <_panic>
+	assert(kern_pgdir[0] & PTE_U);
+f0103197:	68 fc ba 10 f0       	push   $0xf010bafc
+f010319c:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01031a1:	68 ee 04 00 00       	push   $0x4ee
+f01031a6:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01031ab:	e8 90 ce ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f01031b0:	68 70 bf 10 f0       	push   $0xf010bf70
+f01031b5:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01031ba:	68 f1 04 00 00       	push   $0x4f1
+f01031bf:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01031c4:	e8 77 ce ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f01031c9:	68 a8 bf 10 f0       	push   $0xf010bfa8
+f01031ce:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01031d3:	68 f4 04 00 00       	push   $0x4f4
+f01031d8:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01031dd:	e8 5e ce ff ff       	call   f0100040 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f01031e2:	68 e4 bf 10 f0       	push   $0xf010bfe4
+f01031e7:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01031ec:	68 f5 04 00 00       	push   $0x4f5
+f01031f1:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01031f6:	e8 45 ce ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f01031fb:	68 1c c0 10 f0       	push   $0xf010c01c
+f0103200:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103205:	68 f8 04 00 00       	push   $0x4f8
+f010320a:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010320f:	e8 2c ce ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0103214:	68 48 c0 10 f0       	push   $0xf010c048
+f0103219:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010321e:	68 f9 04 00 00       	push   $0x4f9
+f0103223:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103228:	e8 13 ce ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 2);
+f010322d:	68 12 bb 10 f0       	push   $0xf010bb12
+f0103232:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103237:	68 fb 04 00 00       	push   $0x4fb
+f010323c:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103241:	e8 fa cd ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f0103246:	68 23 bb 10 f0       	push   $0xf010bb23
+f010324b:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103250:	68 fc 04 00 00       	push   $0x4fc
+f0103255:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010325a:	e8 e1 cd ff ff       	call   f0100040 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp2);
+f010325f:	68 78 c0 10 f0       	push   $0xf010c078
+f0103264:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103269:	68 ff 04 00 00       	push   $0x4ff
+f010326e:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103273:	e8 c8 cd ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0103278:	68 9c c0 10 f0       	push   $0xf010c09c
+f010327d:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103282:	68 03 05 00 00       	push   $0x503
+f0103287:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010328c:	e8 af cd ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0103291:	68 48 c0 10 f0       	push   $0xf010c048
+f0103296:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010329b:	68 04 05 00 00       	push   $0x504
+f01032a0:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01032a5:	e8 96 cd ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 1);
+f01032aa:	68 c9 ba 10 f0       	push   $0xf010bac9
+f01032af:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01032b4:	68 05 05 00 00       	push   $0x505
+f01032b9:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01032be:	e8 7d cd ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f01032c3:	68 23 bb 10 f0       	push   $0xf010bb23
+f01032c8:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01032cd:	68 06 05 00 00       	push   $0x506
+f01032d2:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01032d7:	e8 64 cd ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01032dc:	68 9c c0 10 f0       	push   $0xf010c09c
+f01032e1:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01032e6:	68 0a 05 00 00       	push   $0x50a
+f01032eb:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01032f0:	e8 4b cd ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f01032f5:	68 c0 c0 10 f0       	push   $0xf010c0c0
+f01032fa:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01032ff:	68 0b 05 00 00       	push   $0x50b
+f0103304:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103309:	e8 32 cd ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 0);
+f010330e:	68 34 bb 10 f0       	push   $0xf010bb34
+f0103313:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103318:	68 0c 05 00 00       	push   $0x50c
+f010331d:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103322:	e8 19 cd ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f0103327:	68 23 bb 10 f0       	push   $0xf010bb23
+f010332c:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103331:	68 0d 05 00 00       	push   $0x50d
+f0103336:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010333b:	e8 00 cd ff ff       	call   f0100040 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp1);
+f0103340:	68 e8 c0 10 f0       	push   $0xf010c0e8
+f0103345:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010334a:	68 10 05 00 00       	push   $0x510
+f010334f:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103354:	e8 e7 cc ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0103359:	68 77 ba 10 f0       	push   $0xf010ba77
+f010335e:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103363:	68 13 05 00 00       	push   $0x513
+f0103368:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010336d:	e8 ce cc ff ff       	call   f0100040 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103372:	68 f8 bd 10 f0       	push   $0xf010bdf8
+f0103377:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010337c:	68 16 05 00 00       	push   $0x516
+f0103381:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103386:	e8 b5 cc ff ff       	call   f0100040 <_panic>
+	assert(pp0->pp_ref == 1);
+f010338b:	68 da ba 10 f0       	push   $0xf010bada
+f0103390:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103395:	68 18 05 00 00       	push   $0x518
+f010339a:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010339f:	e8 9c cc ff ff       	call   f0100040 <_panic>
+f01033a4:	56                   	push   %esi
+f01033a5:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01033aa:	68 1f 05 00 00       	push   $0x51f
+f01033af:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01033b4:	e8 87 cc ff ff       	call   f0100040 <_panic>
+	assert(ptep == ptep1 + PTX(va));
+f01033b9:	68 45 bb 10 f0       	push   $0xf010bb45
+f01033be:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01033c3:	68 20 05 00 00       	push   $0x520
+f01033c8:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01033cd:	e8 6e cc ff ff       	call   f0100040 <_panic>
+f01033d2:	51                   	push   %ecx
+f01033d3:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01033d8:	6a 6e                	push   $0x6e
+f01033da:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01033df:	e8 5c cc ff ff       	call   f0100040 <_panic>
+f01033e4:	52                   	push   %edx
+f01033e5:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01033ea:	6a 6e                	push   $0x6e
+f01033ec:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01033f1:	e8 4a cc ff ff       	call   f0100040 <_panic>
+		assert((ptep[i] & PTE_P) == 0);
+f01033f6:	68 5d bb 10 f0       	push   $0xf010bb5d
+f01033fb:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103400:	68 2a 05 00 00       	push   $0x52a
+f0103405:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010340a:	e8 31 cc ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010340f:	52                   	push   %edx
+f0103410:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0103415:	68 cc 00 00 00       	push   $0xcc
+f010341a:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010341f:	e8 1c cc ff ff       	call   f0100040 <_panic>
+f0103424:	50                   	push   %eax
+f0103425:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f010342a:	68 d7 00 00 00       	push   $0xd7
+f010342f:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103434:	e8 07 cc ff ff       	call   f0100040 <_panic>
+f0103439:	50                   	push   %eax
+f010343a:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f010343f:	68 e4 00 00 00       	push   $0xe4
+f0103444:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103449:	e8 f2 cb ff ff       	call   f0100040 <_panic>
+		boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W | PTE_P | PTE_G);
+f010344e:	bb 00 10 93 f0       	mov    $0xf0931000,%ebx
+f0103453:	e9 56 f8 ff ff       	jmp    f0102cae <mem_init+0xb48>
+	pgdir = kern_pgdir;
+f0103458:	8b 3d f0 f3 92 f0    	mov    0xf092f3f0,%edi
+	n = ROUNDUP(npages*sizeof(struct Page), PGSIZE);
+f010345e:	a1 ec f3 92 f0       	mov    0xf092f3ec,%eax
+f0103463:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0103466:	89 c2                	mov    %eax,%edx
+f0103468:	c1 e2 04             	shl    $0x4,%edx
+f010346b:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+	for (i = 0; i < n; i += PGSIZE)
+f0103471:	89 d0                	mov    %edx,%eax
+f0103473:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103478:	74 4c                	je     f01034c6 <mem_init+0x1360>
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f010347a:	8b 35 f4 f3 92 f0    	mov    0xf092f3f4,%esi
+	return (physaddr_t)kva - KERNBASE;
+f0103480:	8d 8e 00 00 00 10    	lea    0x10000000(%esi),%ecx
+	for (i = 0; i < n; i += PGSIZE)
+f0103486:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f0103489:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f010348c:	89 75 cc             	mov    %esi,-0x34(%ebp)
+f010348f:	89 c6                	mov    %eax,%esi
+f0103491:	89 cf                	mov    %ecx,%edi
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f0103493:	8d 93 00 00 00 ef    	lea    -0x11000000(%ebx),%edx
+f0103499:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010349c:	e8 5e dc ff ff       	call   f01010ff <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f01034a1:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f01034a8:	0f 86 ca 00 00 00    	jbe    f0103578 <mem_init+0x1412>
+f01034ae:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+f01034b1:	39 d0                	cmp    %edx,%eax
+f01034b3:	0f 85 d7 00 00 00    	jne    f0103590 <mem_init+0x142a>
+	for (i = 0; i < n; i += PGSIZE)
+f01034b9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01034bf:	39 f3                	cmp    %esi,%ebx
+f01034c1:	72 d0                	jb     f0103493 <mem_init+0x132d>
+f01034c3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f01034c6:	8b 35 50 c2 92 f0    	mov    0xf092c250,%esi
+f01034cc:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+f01034d1:	8d 86 00 00 40 21    	lea    0x21400000(%esi),%eax
+f01034d7:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f01034da:	89 c7                	mov    %eax,%edi
+f01034dc:	89 da                	mov    %ebx,%edx
+f01034de:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01034e1:	e8 19 dc ff ff       	call   f01010ff <check_va2pa>
+f01034e6:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f01034ec:	0f 86 b7 00 00 00    	jbe    f01035a9 <mem_init+0x1443>
+f01034f2:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+f01034f5:	39 d0                	cmp    %edx,%eax
+f01034f7:	0f 85 c1 00 00 00    	jne    f01035be <mem_init+0x1458>
+	for (i = 0; i < n; i += PGSIZE)
+f01034fd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103503:	81 fb 00 f0 c2 ee    	cmp    $0xeec2f000,%ebx
+f0103509:	75 d1                	jne    f01034dc <mem_init+0x1376>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f010350b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f010350e:	8b 75 c8             	mov    -0x38(%ebp),%esi
+f0103511:	c1 e6 0c             	shl    $0xc,%esi
+f0103514:	0f 84 d6 00 00 00    	je     f01035f0 <mem_init+0x148a>
+f010351a:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f010351d:	8d 93 00 00 00 f0    	lea    -0x10000000(%ebx),%edx
+f0103523:	89 f8                	mov    %edi,%eax
+f0103525:	e8 d5 db ff ff       	call   f01010ff <check_va2pa>
+f010352a:	39 c3                	cmp    %eax,%ebx
+f010352c:	0f 85 a5 00 00 00    	jne    f01035d7 <mem_init+0x1471>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f0103532:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103538:	39 f3                	cmp    %esi,%ebx
+f010353a:	72 e1                	jb     f010351d <mem_init+0x13b7>
+f010353c:	bb 00 00 00 fe       	mov    $0xfe000000,%ebx
+		assert(check_va2pa(pgdir, i) == i);
+f0103541:	89 da                	mov    %ebx,%edx
+f0103543:	89 f8                	mov    %edi,%eax
+f0103545:	e8 b5 db ff ff       	call   f01010ff <check_va2pa>
+f010354a:	39 c3                	cmp    %eax,%ebx
+f010354c:	0f 85 a8 00 00 00    	jne    f01035fa <mem_init+0x1494>
+	for (i = IOMEMBASE; i < -PGSIZE; i += PGSIZE)
+f0103552:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103558:	81 fb 00 f0 ff ff    	cmp    $0xfffff000,%ebx
+f010355e:	75 e1                	jne    f0103541 <mem_init+0x13db>
+f0103560:	c7 45 cc 00 10 d4 00 	movl   $0xd41000,-0x34(%ebp)
+f0103567:	c7 45 d0 00 00 c0 ef 	movl   $0xefc00000,-0x30(%ebp)
+f010356e:	b9 00 80 bf ef       	mov    $0xefbf8000,%ecx
+f0103573:	e9 09 01 00 00       	jmp    f0103681 <mem_init+0x151b>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103578:	8b 75 cc             	mov    -0x34(%ebp),%esi
+f010357b:	56                   	push   %esi
+f010357c:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0103581:	68 66 04 00 00       	push   $0x466
+f0103586:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010358b:	e8 b0 ca ff ff       	call   f0100040 <_panic>
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f0103590:	68 0c c1 10 f0       	push   $0xf010c10c
+f0103595:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010359a:	68 66 04 00 00       	push   $0x466
+f010359f:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01035a4:	e8 97 ca ff ff       	call   f0100040 <_panic>
+f01035a9:	56                   	push   %esi
+f01035aa:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01035af:	68 6b 04 00 00       	push   $0x46b
+f01035b4:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01035b9:	e8 82 ca ff ff       	call   f0100040 <_panic>
+		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f01035be:	68 40 c1 10 f0       	push   $0xf010c140
+f01035c3:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01035c8:	68 6b 04 00 00       	push   $0x46b
+f01035cd:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01035d2:	e8 69 ca ff ff       	call   f0100040 <_panic>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f01035d7:	68 74 c1 10 f0       	push   $0xf010c174
+f01035dc:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01035e1:	68 6f 04 00 00       	push   $0x46f
+f01035e6:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01035eb:	e8 50 ca ff ff       	call   f0100040 <_panic>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f01035f0:	bb 00 00 00 fe       	mov    $0xfe000000,%ebx
+f01035f5:	e9 47 ff ff ff       	jmp    f0103541 <mem_init+0x13db>
+		assert(check_va2pa(pgdir, i) == i);
+f01035fa:	68 8d bb 10 f0       	push   $0xf010bb8d
+f01035ff:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103604:	68 73 04 00 00       	push   $0x473
+f0103609:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010360e:	e8 2d ca ff ff       	call   f0100040 <_panic>
+f0103613:	ff 75 d4             	push   -0x2c(%ebp)
+f0103616:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f010361b:	68 7c 04 00 00       	push   $0x47c
+f0103620:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103625:	e8 16 ca ff ff       	call   f0100040 <_panic>
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f010362a:	68 9c c1 10 f0       	push   $0xf010c19c
+f010362f:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103634:	68 7b 04 00 00       	push   $0x47b
+f0103639:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010363e:	e8 fd c9 ff ff       	call   f0100040 <_panic>
+			assert(check_va2pa(pgdir, base + i) == ~0);
+f0103643:	68 e4 c1 10 f0       	push   $0xf010c1e4
+f0103648:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010364d:	68 7e 04 00 00       	push   $0x47e
+f0103652:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103657:	e8 e4 c9 ff ff       	call   f0100040 <_panic>
+	for (n = 0; n < NCPU; n++) {
+f010365c:	89 d9                	mov    %ebx,%ecx
+f010365e:	81 e9 00 00 01 00    	sub    $0x10000,%ecx
+f0103664:	81 6d d0 00 00 01 00 	subl   $0x10000,-0x30(%ebp)
+f010366b:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f0103672:	81 45 cc 00 80 01 00 	addl   $0x18000,-0x34(%ebp)
+f0103679:	81 f9 00 80 b7 ef    	cmp    $0xefb78000,%ecx
+f010367f:	74 6d                	je     f01036ee <mem_init+0x1588>
+		uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+f0103681:	8d b1 00 80 ff ff    	lea    -0x8000(%ecx),%esi
+f0103687:	89 cb                	mov    %ecx,%ebx
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0103689:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010368c:	05 00 80 ff 0f       	add    $0xfff8000,%eax
+f0103691:	89 75 c8             	mov    %esi,-0x38(%ebp)
+f0103694:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+f0103697:	89 c6                	mov    %eax,%esi
+f0103699:	89 da                	mov    %ebx,%edx
+f010369b:	89 f8                	mov    %edi,%eax
+f010369d:	e8 5d da ff ff       	call   f01010ff <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f01036a2:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f01036a9:	0f 86 64 ff ff ff    	jbe    f0103613 <mem_init+0x14ad>
+f01036af:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f01036b2:	39 d0                	cmp    %edx,%eax
+f01036b4:	0f 85 70 ff ff ff    	jne    f010362a <mem_init+0x14c4>
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f01036ba:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01036c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01036c3:	39 c3                	cmp    %eax,%ebx
+f01036c5:	75 d2                	jne    f0103699 <mem_init+0x1533>
+f01036c7:	8b 75 c8             	mov    -0x38(%ebp),%esi
+f01036ca:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+			assert(check_va2pa(pgdir, base + i) == ~0);
+f01036cd:	89 f2                	mov    %esi,%edx
+f01036cf:	89 f8                	mov    %edi,%eax
+f01036d1:	e8 29 da ff ff       	call   f01010ff <check_va2pa>
+f01036d6:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01036d9:	0f 85 64 ff ff ff    	jne    f0103643 <mem_init+0x14dd>
+		for (i = 0; i < KSTKGAP; i += PGSIZE)
+f01036df:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01036e5:	39 de                	cmp    %ebx,%esi
+f01036e7:	75 e4                	jne    f01036cd <mem_init+0x1567>
+f01036e9:	e9 6e ff ff ff       	jmp    f010365c <mem_init+0x14f6>
+f01036ee:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f01036f1:	eb 36                	jmp    f0103729 <mem_init+0x15c3>
+			assert(pgdir[i] & PTE_P);
+f01036f3:	f6 04 87 01          	testb  $0x1,(%edi,%eax,4)
+f01036f7:	75 48                	jne    f0103741 <mem_init+0x15db>
+f01036f9:	68 a8 bb 10 f0       	push   $0xf010bba8
+f01036fe:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103703:	68 88 04 00 00       	push   $0x488
+f0103708:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010370d:	e8 2e c9 ff ff       	call   f0100040 <_panic>
+				assert(pgdir[i] & PTE_P);
+f0103712:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f0103715:	f6 c2 01             	test   $0x1,%dl
+f0103718:	74 2c                	je     f0103746 <mem_init+0x15e0>
+				assert(pgdir[i] & PTE_W);
+f010371a:	f6 c2 02             	test   $0x2,%dl
+f010371d:	74 40                	je     f010375f <mem_init+0x15f9>
+	for (i = 0; i < NPDENTRIES; i++) {
+f010371f:	83 c0 01             	add    $0x1,%eax
+f0103722:	3d 00 04 00 00       	cmp    $0x400,%eax
+f0103727:	74 68                	je     f0103791 <mem_init+0x162b>
+		switch (i) {
+f0103729:	8d 90 45 fc ff ff    	lea    -0x3bb(%eax),%edx
+f010372f:	83 fa 03             	cmp    $0x3,%edx
+f0103732:	76 bf                	jbe    f01036f3 <mem_init+0x158d>
+			if (i >= PDX(KERNBASE)) {
+f0103734:	3d bf 03 00 00       	cmp    $0x3bf,%eax
+f0103739:	77 d7                	ja     f0103712 <mem_init+0x15ac>
+				assert(pgdir[i] == 0);
+f010373b:	83 3c 87 00          	cmpl   $0x0,(%edi,%eax,4)
+f010373f:	75 37                	jne    f0103778 <mem_init+0x1612>
+	for (i = 0; i < NPDENTRIES; i++) {
+f0103741:	83 c0 01             	add    $0x1,%eax
+f0103744:	eb e3                	jmp    f0103729 <mem_init+0x15c3>
+				assert(pgdir[i] & PTE_P);
+f0103746:	68 a8 bb 10 f0       	push   $0xf010bba8
+f010374b:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103750:	68 8c 04 00 00       	push   $0x48c
+f0103755:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010375a:	e8 e1 c8 ff ff       	call   f0100040 <_panic>
+				assert(pgdir[i] & PTE_W);
+f010375f:	68 b9 bb 10 f0       	push   $0xf010bbb9
+f0103764:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103769:	68 8d 04 00 00       	push   $0x48d
+f010376e:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103773:	e8 c8 c8 ff ff       	call   f0100040 <_panic>
+				assert(pgdir[i] == 0);
+f0103778:	68 ca bb 10 f0       	push   $0xf010bbca
+f010377d:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103782:	68 8f 04 00 00       	push   $0x48f
+f0103787:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f010378c:	e8 af c8 ff ff       	call   f0100040 <_panic>
+	cprintf("check_kern_pgdir() succeeded!\n");
+f0103791:	83 ec 0c             	sub    $0xc,%esp
+f0103794:	68 08 c2 10 f0       	push   $0xf010c208
+f0103799:	e8 4e 0f 00 00       	call   f01046ec <cprintf>
+	lcr3(PADDR(kern_pgdir));
+f010379e:	a1 f0 f3 92 f0       	mov    0xf092f3f0,%eax
+f01037a3:	83 c4 10             	add    $0x10,%esp
+f01037a6:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01037ab:	0f 86 08 02 00 00    	jbe    f01039b9 <mem_init+0x1853>
+	return (physaddr_t)kva - KERNBASE;
+f01037b1:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01037b6:	0f 22 d8             	mov    %eax,%cr3
+	tlb_init_percpu();
+f01037b9:	e8 03 51 00 00       	call   f01088c1 <tlb_init_percpu>
+	check_page_free_list(0);
+f01037be:	b8 00 00 00 00       	mov    $0x0,%eax
+f01037c3:	e8 20 da ff ff       	call   f01011e8 <check_page_free_list>
+	__asm __volatile("movl %%cr0,%0" : "=r" (val));
+f01037c8:	0f 20 c0             	mov    %cr0,%eax
+	cr0 &= ~(CR0_TS|CR0_EM);
+f01037cb:	83 e0 f3             	and    $0xfffffff3,%eax
+f01037ce:	0d 23 00 05 80       	or     $0x80050023,%eax
+	__asm __volatile("movl %0,%%cr0" : : "r" (val));
+f01037d3:	0f 22 c0             	mov    %eax,%cr0
+	uintptr_t va;
+	int i;
+
+	// check that we can read and write installed pages
+	pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f01037d6:	83 ec 0c             	sub    $0xc,%esp
+f01037d9:	6a 00                	push   $0x0
+f01037db:	e8 ab e0 ff ff       	call   f010188b <page_alloc>
+f01037e0:	89 c3                	mov    %eax,%ebx
+f01037e2:	83 c4 10             	add    $0x10,%esp
+f01037e5:	85 c0                	test   %eax,%eax
+f01037e7:	0f 84 e1 01 00 00    	je     f01039ce <mem_init+0x1868>
+	assert((pp1 = page_alloc(0)));
+f01037ed:	83 ec 0c             	sub    $0xc,%esp
+f01037f0:	6a 00                	push   $0x0
+f01037f2:	e8 94 e0 ff ff       	call   f010188b <page_alloc>
+f01037f7:	89 c7                	mov    %eax,%edi
+f01037f9:	83 c4 10             	add    $0x10,%esp
+f01037fc:	85 c0                	test   %eax,%eax
+f01037fe:	0f 84 e3 01 00 00    	je     f01039e7 <mem_init+0x1881>
+	assert((pp2 = page_alloc(0)));
+f0103804:	83 ec 0c             	sub    $0xc,%esp
+f0103807:	6a 00                	push   $0x0
+f0103809:	e8 7d e0 ff ff       	call   f010188b <page_alloc>
+f010380e:	89 c6                	mov    %eax,%esi
+f0103810:	83 c4 10             	add    $0x10,%esp
+f0103813:	85 c0                	test   %eax,%eax
+f0103815:	0f 84 e5 01 00 00    	je     f0103a00 <mem_init+0x189a>
+	page_free(pp0);
+f010381b:	83 ec 0c             	sub    $0xc,%esp
+f010381e:	53                   	push   %ebx
+f010381f:	e8 10 de ff ff       	call   f0101634 <page_free>
+	return (pp - pages) << PGSHIFT;
+f0103824:	89 f8                	mov    %edi,%eax
+f0103826:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f010382c:	c1 f8 04             	sar    $0x4,%eax
+f010382f:	89 c2                	mov    %eax,%edx
+f0103831:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103834:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103839:	83 c4 10             	add    $0x10,%esp
+f010383c:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0103842:	0f 83 d1 01 00 00    	jae    f0103a19 <mem_init+0x18b3>
+	memset(page2kva(pp1), 1, PGSIZE);
+f0103848:	83 ec 04             	sub    $0x4,%esp
+f010384b:	68 00 10 00 00       	push   $0x1000
+f0103850:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0103852:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103858:	52                   	push   %edx
+f0103859:	e8 40 44 00 00       	call   f0107c9e <memset>
+	return (pp - pages) << PGSHIFT;
+f010385e:	89 f0                	mov    %esi,%eax
+f0103860:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0103866:	c1 f8 04             	sar    $0x4,%eax
+f0103869:	89 c2                	mov    %eax,%edx
+f010386b:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010386e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103873:	83 c4 10             	add    $0x10,%esp
+f0103876:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f010387c:	0f 83 a9 01 00 00    	jae    f0103a2b <mem_init+0x18c5>
+	memset(page2kva(pp2), 2, PGSIZE);
+f0103882:	83 ec 04             	sub    $0x4,%esp
+f0103885:	68 00 10 00 00       	push   $0x1000
+f010388a:	6a 02                	push   $0x2
+	return (void *)(pa + KERNBASE);
+f010388c:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103892:	52                   	push   %edx
+f0103893:	e8 06 44 00 00       	call   f0107c9e <memset>
+	page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W);
+f0103898:	6a 02                	push   $0x2
+f010389a:	68 00 10 00 00       	push   $0x1000
+f010389f:	57                   	push   %edi
+f01038a0:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f01038a6:	e8 e0 e7 ff ff       	call   f010208b <page_insert>
+	assert(pp1->pp_ref == 1);
+f01038ab:	83 c4 20             	add    $0x20,%esp
+f01038ae:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f01038b3:	0f 85 84 01 00 00    	jne    f0103a3d <mem_init+0x18d7>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f01038b9:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f01038c0:	01 01 01 
+f01038c3:	0f 85 8d 01 00 00    	jne    f0103a56 <mem_init+0x18f0>
+	page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W);
+f01038c9:	6a 02                	push   $0x2
+f01038cb:	68 00 10 00 00       	push   $0x1000
+f01038d0:	56                   	push   %esi
+f01038d1:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f01038d7:	e8 af e7 ff ff       	call   f010208b <page_insert>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f01038dc:	83 c4 10             	add    $0x10,%esp
+f01038df:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f01038e6:	02 02 02 
+f01038e9:	0f 85 80 01 00 00    	jne    f0103a6f <mem_init+0x1909>
+	assert(pp2->pp_ref == 1);
+f01038ef:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f01038f4:	0f 85 8e 01 00 00    	jne    f0103a88 <mem_init+0x1922>
+	assert(pp1->pp_ref == 0);
+f01038fa:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f01038ff:	0f 85 9c 01 00 00    	jne    f0103aa1 <mem_init+0x193b>
+	*(uint32_t *)PGSIZE = 0x03030303U;
+f0103905:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f010390c:	03 03 03 
+	return (pp - pages) << PGSHIFT;
+f010390f:	89 f0                	mov    %esi,%eax
+f0103911:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0103917:	c1 f8 04             	sar    $0x4,%eax
+f010391a:	89 c2                	mov    %eax,%edx
+f010391c:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010391f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103924:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f010392a:	0f 83 8a 01 00 00    	jae    f0103aba <mem_init+0x1954>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f0103930:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0103937:	03 03 03 
+f010393a:	0f 85 8c 01 00 00    	jne    f0103acc <mem_init+0x1966>
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f0103940:	83 ec 08             	sub    $0x8,%esp
+f0103943:	68 00 10 00 00       	push   $0x1000
+f0103948:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f010394e:	e8 c5 e5 ff ff       	call   f0101f18 <page_remove>
+	assert(pp2->pp_ref == 0);
+f0103953:	83 c4 10             	add    $0x10,%esp
+f0103956:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f010395b:	0f 85 84 01 00 00    	jne    f0103ae5 <mem_init+0x197f>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103961:	8b 0d f0 f3 92 f0    	mov    0xf092f3f0,%ecx
+f0103967:	8b 11                	mov    (%ecx),%edx
+f0103969:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	return (pp - pages) << PGSHIFT;
+f010396f:	89 d8                	mov    %ebx,%eax
+f0103971:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0103977:	c1 f8 04             	sar    $0x4,%eax
+f010397a:	c1 e0 0c             	shl    $0xc,%eax
+f010397d:	39 c2                	cmp    %eax,%edx
+f010397f:	0f 85 79 01 00 00    	jne    f0103afe <mem_init+0x1998>
+	kern_pgdir[0] = 0;
+f0103985:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f010398b:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0103990:	0f 85 81 01 00 00    	jne    f0103b17 <mem_init+0x19b1>
+	pp0->pp_ref = 0;
+f0103996:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+
+	// free the pages we took
+	page_free(pp0);
+f010399c:	83 ec 0c             	sub    $0xc,%esp
+f010399f:	53                   	push   %ebx
+f01039a0:	e8 8f dc ff ff       	call   f0101634 <page_free>
+
+	cprintf("check_page_installed_pgdir() succeeded!\n");
+f01039a5:	c7 04 24 9c c2 10 f0 	movl   $0xf010c29c,(%esp)
+f01039ac:	e8 3b 0d 00 00       	call   f01046ec <cprintf>
+}
+f01039b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01039b4:	5b                   	pop    %ebx
+f01039b5:	5e                   	pop    %esi
+f01039b6:	5f                   	pop    %edi
+f01039b7:	5d                   	pop    %ebp
+f01039b8:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01039b9:	50                   	push   %eax
+f01039ba:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01039bf:	68 02 01 00 00       	push   $0x102
+f01039c4:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01039c9:	e8 72 c6 ff ff       	call   f0100040 <_panic>
+	assert((pp0 = page_alloc(0)));
+f01039ce:	68 cc b9 10 f0       	push   $0xf010b9cc
+f01039d3:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01039d8:	68 45 05 00 00       	push   $0x545
+f01039dd:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01039e2:	e8 59 c6 ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f01039e7:	68 e2 b9 10 f0       	push   $0xf010b9e2
+f01039ec:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f01039f1:	68 46 05 00 00       	push   $0x546
+f01039f6:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f01039fb:	e8 40 c6 ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0103a00:	68 f8 b9 10 f0       	push   $0xf010b9f8
+f0103a05:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103a0a:	68 47 05 00 00       	push   $0x547
+f0103a0f:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103a14:	e8 27 c6 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103a19:	52                   	push   %edx
+f0103a1a:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0103a1f:	6a 6e                	push   $0x6e
+f0103a21:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0103a26:	e8 15 c6 ff ff       	call   f0100040 <_panic>
+f0103a2b:	52                   	push   %edx
+f0103a2c:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0103a31:	6a 6e                	push   $0x6e
+f0103a33:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0103a38:	e8 03 c6 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 1);
+f0103a3d:	68 c9 ba 10 f0       	push   $0xf010bac9
+f0103a42:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103a47:	68 4c 05 00 00       	push   $0x54c
+f0103a4c:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103a51:	e8 ea c5 ff ff       	call   f0100040 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f0103a56:	68 28 c2 10 f0       	push   $0xf010c228
+f0103a5b:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103a60:	68 4d 05 00 00       	push   $0x54d
+f0103a65:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103a6a:	e8 d1 c5 ff ff       	call   f0100040 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f0103a6f:	68 4c c2 10 f0       	push   $0xf010c24c
+f0103a74:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103a79:	68 4f 05 00 00       	push   $0x54f
+f0103a7e:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103a83:	e8 b8 c5 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f0103a88:	68 eb ba 10 f0       	push   $0xf010baeb
+f0103a8d:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103a92:	68 50 05 00 00       	push   $0x550
+f0103a97:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103a9c:	e8 9f c5 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 0);
+f0103aa1:	68 34 bb 10 f0       	push   $0xf010bb34
+f0103aa6:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103aab:	68 51 05 00 00       	push   $0x551
+f0103ab0:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103ab5:	e8 86 c5 ff ff       	call   f0100040 <_panic>
+f0103aba:	52                   	push   %edx
+f0103abb:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0103ac0:	6a 6e                	push   $0x6e
+f0103ac2:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0103ac7:	e8 74 c5 ff ff       	call   f0100040 <_panic>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f0103acc:	68 70 c2 10 f0       	push   $0xf010c270
+f0103ad1:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103ad6:	68 53 05 00 00       	push   $0x553
+f0103adb:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103ae0:	e8 5b c5 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f0103ae5:	68 23 bb 10 f0       	push   $0xf010bb23
+f0103aea:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103aef:	68 55 05 00 00       	push   $0x555
+f0103af4:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103af9:	e8 42 c5 ff ff       	call   f0100040 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103afe:	68 f8 bd 10 f0       	push   $0xf010bdf8
+f0103b03:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103b08:	68 58 05 00 00       	push   $0x558
+f0103b0d:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103b12:	e8 29 c5 ff ff       	call   f0100040 <_panic>
+	assert(pp0->pp_ref == 1);
+f0103b17:	68 da ba 10 f0       	push   $0xf010bada
+f0103b1c:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103b21:	68 5a 05 00 00       	push   $0x55a
+f0103b26:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103b2b:	e8 10 c5 ff ff       	call   f0100040 <_panic>
+
+f0103b30 <user_mem_check>:
+{
+f0103b30:	55                   	push   %ebp
+f0103b31:	89 e5                	mov    %esp,%ebp
+f0103b33:	57                   	push   %edi
+f0103b34:	56                   	push   %esi
+f0103b35:	53                   	push   %ebx
+f0103b36:	83 ec 1c             	sub    $0x1c,%esp
+f0103b39:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0103b3c:	8b 55 10             	mov    0x10(%ebp),%edx
+	assert((uintptr_t)va < (uintptr_t)va + len);
+f0103b3f:	8d 04 16             	lea    (%esi,%edx,1),%eax
+f0103b42:	39 c6                	cmp    %eax,%esi
+f0103b44:	0f 83 82 00 00 00    	jae    f0103bcc <user_mem_check+0x9c>
+	low = (uint8_t*)ROUNDDOWN((uintptr_t)va, PGSIZE);
+f0103b4a:	89 f0                	mov    %esi,%eax
+f0103b4c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103b51:	89 c3                	mov    %eax,%ebx
+	upper = (uint8_t*)ROUNDUP((uintptr_t)upper, PGSIZE);
+f0103b53:	8d 94 16 ff 0f 00 00 	lea    0xfff(%esi,%edx,1),%edx
+f0103b5a:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0103b60:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	perm = perm | PTE_P;
+f0103b63:	8b 7d 14             	mov    0x14(%ebp),%edi
+f0103b66:	83 cf 01             	or     $0x1,%edi
+	for(; low < upper; low += PGSIZE){
+f0103b69:	39 d0                	cmp    %edx,%eax
+f0103b6b:	0f 83 95 00 00 00    	jae    f0103c06 <user_mem_check+0xd6>
+		if((uintptr_t)low > ULIM) {
+f0103b71:	3d 00 00 80 ef       	cmp    $0xef800000,%eax
+f0103b76:	77 41                	ja     f0103bb9 <user_mem_check+0x89>
+		pte = pgdir_walk(env->env_pgdir, low, 0);
+f0103b78:	83 ec 04             	sub    $0x4,%esp
+f0103b7b:	6a 00                	push   $0x0
+f0103b7d:	53                   	push   %ebx
+f0103b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103b81:	ff 70 70             	push   0x70(%eax)
+f0103b84:	e8 ac dd ff ff       	call   f0101935 <pgdir_walk>
+		if(pte == NULL) {
+f0103b89:	83 c4 10             	add    $0x10,%esp
+f0103b8c:	85 c0                	test   %eax,%eax
+f0103b8e:	74 55                	je     f0103be5 <user_mem_check+0xb5>
+		if(((*pte) & perm) != perm) { 
+f0103b90:	89 f9                	mov    %edi,%ecx
+f0103b92:	23 08                	and    (%eax),%ecx
+f0103b94:	39 cf                	cmp    %ecx,%edi
+f0103b96:	75 5a                	jne    f0103bf2 <user_mem_check+0xc2>
+			va = va - PGOFF(va) + PGSIZE;
+f0103b98:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0103b9e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+	for(; low < upper; low += PGSIZE){
+f0103ba4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103baa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103bad:	39 c3                	cmp    %eax,%ebx
+f0103baf:	73 4e                	jae    f0103bff <user_mem_check+0xcf>
+		if((uintptr_t)low > ULIM) {
+f0103bb1:	81 fb 00 00 80 ef    	cmp    $0xef800000,%ebx
+f0103bb7:	76 bf                	jbe    f0103b78 <user_mem_check+0x48>
+			user_mem_check_addr = (uintptr_t)va;
+f0103bb9:	89 35 3c c2 92 f0    	mov    %esi,0xf092c23c
+			return -E_FAULT;
+f0103bbf:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f0103bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103bc7:	5b                   	pop    %ebx
+f0103bc8:	5e                   	pop    %esi
+f0103bc9:	5f                   	pop    %edi
+f0103bca:	5d                   	pop    %ebp
+f0103bcb:	c3                   	ret
+	assert((uintptr_t)va < (uintptr_t)va + len);
+f0103bcc:	68 c8 c2 10 f0       	push   $0xf010c2c8
+f0103bd1:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103bd6:	68 98 03 00 00       	push   $0x398
+f0103bdb:	68 c2 b8 10 f0       	push   $0xf010b8c2
+f0103be0:	e8 5b c4 ff ff       	call   f0100040 <_panic>
+			user_mem_check_addr = (uintptr_t)va;
+f0103be5:	89 35 3c c2 92 f0    	mov    %esi,0xf092c23c
+			return -E_FAULT;
+f0103beb:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0103bf0:	eb d2                	jmp    f0103bc4 <user_mem_check+0x94>
+			user_mem_check_addr = (uintptr_t)va;
+f0103bf2:	89 35 3c c2 92 f0    	mov    %esi,0xf092c23c
+			return -E_FAULT;
+f0103bf8:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0103bfd:	eb c5                	jmp    f0103bc4 <user_mem_check+0x94>
+	return 0;
+f0103bff:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103c04:	eb be                	jmp    f0103bc4 <user_mem_check+0x94>
+f0103c06:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103c0b:	eb b7                	jmp    f0103bc4 <user_mem_check+0x94>
+
+f0103c0d <user_mem_assert>:
+{
+f0103c0d:	55                   	push   %ebp
+f0103c0e:	89 e5                	mov    %esp,%ebp
+f0103c10:	53                   	push   %ebx
+f0103c11:	83 ec 04             	sub    $0x4,%esp
+f0103c14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (user_mem_check(env, va, len, perm | PTE_U | PTE_P) < 0) {
+f0103c17:	8b 45 14             	mov    0x14(%ebp),%eax
+f0103c1a:	83 c8 05             	or     $0x5,%eax
+f0103c1d:	50                   	push   %eax
+f0103c1e:	ff 75 10             	push   0x10(%ebp)
+f0103c21:	ff 75 0c             	push   0xc(%ebp)
+f0103c24:	53                   	push   %ebx
+f0103c25:	e8 06 ff ff ff       	call   f0103b30 <user_mem_check>
+f0103c2a:	83 c4 10             	add    $0x10,%esp
+f0103c2d:	85 c0                	test   %eax,%eax
+f0103c2f:	78 05                	js     f0103c36 <user_mem_assert+0x29>
+}
+f0103c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103c34:	c9                   	leave
+f0103c35:	c3                   	ret
+		cprintf("[%08x] user_mem_check assertion failure for "
+f0103c36:	83 ec 04             	sub    $0x4,%esp
+f0103c39:	ff 35 3c c2 92 f0    	push   0xf092c23c
+f0103c3f:	ff 73 48             	push   0x48(%ebx)
+f0103c42:	68 ec c2 10 f0       	push   $0xf010c2ec
+f0103c47:	e8 a0 0a 00 00       	call   f01046ec <cprintf>
+		env_destroy(env);	// may not return
+f0103c4c:	89 1c 24             	mov    %ebx,(%esp)
+f0103c4f:	e8 f6 06 00 00       	call   f010434a <env_destroy>
+f0103c54:	83 c4 10             	add    $0x10,%esp
+}
+f0103c57:	eb d8                	jmp    f0103c31 <user_mem_assert+0x24>
+
+f0103c59 <region_alloc>:
+// Pages should be writable by user and kernel.
+// Panic if any allocation attempt fails.
+//
+static void
+region_alloc(struct Env *e, void *va, size_t len)
+{
+f0103c59:	55                   	push   %ebp
+f0103c5a:	89 e5                	mov    %esp,%ebp
+f0103c5c:	57                   	push   %edi
+f0103c5d:	56                   	push   %esi
+f0103c5e:	53                   	push   %ebx
+f0103c5f:	83 ec 0c             	sub    $0xc,%esp
+	// Hint: It is easier to use region_alloc if the caller can pass
+	//   'va' and 'len' values that are not page-aligned.
+	//   You should round va down, and round (va + len) up.
+	//   (Watch out for corner-cases!)
+	struct Page *p;
+	assert((uintptr_t)va < KERNBASE);
+f0103c62:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0103c68:	77 63                	ja     f0103ccd <region_alloc+0x74>
+f0103c6a:	89 c7                	mov    %eax,%edi
+f0103c6c:	89 d0                	mov    %edx,%eax
+	if((uintptr_t)va + len < (uintptr_t)va) 
+f0103c6e:	89 d6                	mov    %edx,%esi
+f0103c70:	01 ce                	add    %ecx,%esi
+f0103c72:	72 72                	jb     f0103ce6 <region_alloc+0x8d>
+		panic("len too large");
+	if(len <= 0)
+f0103c74:	85 c9                	test   %ecx,%ecx
+f0103c76:	74 4d                	je     f0103cc5 <region_alloc+0x6c>
+		return ;
+	uintptr_t upper = ROUNDUP((uintptr_t)va+len, PGSIZE);
+f0103c78:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+f0103c7e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	assert(upper <= KERNBASE);
+f0103c84:	81 fe 00 00 00 f0    	cmp    $0xf0000000,%esi
+f0103c8a:	77 71                	ja     f0103cfd <region_alloc+0xa4>
+	va = ROUNDDOWN(va, PGSIZE);
+f0103c8c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103c91:	89 c3                	mov    %eax,%ebx
+	while((uintptr_t)va < upper) {
+f0103c93:	39 f0                	cmp    %esi,%eax
+f0103c95:	73 2e                	jae    f0103cc5 <region_alloc+0x6c>
+		p = page_alloc(0);
+f0103c97:	83 ec 0c             	sub    $0xc,%esp
+f0103c9a:	6a 00                	push   $0x0
+f0103c9c:	e8 ea db ff ff       	call   f010188b <page_alloc>
+		if(p == NULL)
+f0103ca1:	83 c4 10             	add    $0x10,%esp
+f0103ca4:	85 c0                	test   %eax,%eax
+f0103ca6:	74 6e                	je     f0103d16 <region_alloc+0xbd>
+			panic("page_alloc failed: %e", p);
+		assert(p != NULL);
+		// page_insert records the reverse mapping as well.
+		if(page_insert(e->env_pgdir, p, va, PTE_U | PTE_W) < 0)
+f0103ca8:	6a 06                	push   $0x6
+f0103caa:	53                   	push   %ebx
+f0103cab:	50                   	push   %eax
+f0103cac:	ff 77 70             	push   0x70(%edi)
+f0103caf:	e8 d7 e3 ff ff       	call   f010208b <page_insert>
+f0103cb4:	83 c4 10             	add    $0x10,%esp
+f0103cb7:	85 c0                	test   %eax,%eax
+f0103cb9:	78 71                	js     f0103d2c <region_alloc+0xd3>
+			panic("page_insert failed");
+		va += PGSIZE;
+f0103cbb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	while((uintptr_t)va < upper) {
+f0103cc1:	39 f3                	cmp    %esi,%ebx
+f0103cc3:	72 d2                	jb     f0103c97 <region_alloc+0x3e>
+	}	
+}
+f0103cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103cc8:	5b                   	pop    %ebx
+f0103cc9:	5e                   	pop    %esi
+f0103cca:	5f                   	pop    %edi
+f0103ccb:	5d                   	pop    %ebp
+f0103ccc:	c3                   	ret
+	assert((uintptr_t)va < KERNBASE);
+f0103ccd:	68 21 c3 10 f0       	push   $0xf010c321
+f0103cd2:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103cd7:	68 4e 01 00 00       	push   $0x14e
+f0103cdc:	68 3a c3 10 f0       	push   $0xf010c33a
+f0103ce1:	e8 5a c3 ff ff       	call   f0100040 <_panic>
+		panic("len too large");
+f0103ce6:	83 ec 04             	sub    $0x4,%esp
+f0103ce9:	68 45 c3 10 f0       	push   $0xf010c345
+f0103cee:	68 50 01 00 00       	push   $0x150
+f0103cf3:	68 3a c3 10 f0       	push   $0xf010c33a
+f0103cf8:	e8 43 c3 ff ff       	call   f0100040 <_panic>
+	assert(upper <= KERNBASE);
+f0103cfd:	68 53 c3 10 f0       	push   $0xf010c353
+f0103d02:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0103d07:	68 54 01 00 00       	push   $0x154
+f0103d0c:	68 3a c3 10 f0       	push   $0xf010c33a
+f0103d11:	e8 2a c3 ff ff       	call   f0100040 <_panic>
+			panic("page_alloc failed: %e", p);
+f0103d16:	6a 00                	push   $0x0
+f0103d18:	68 65 c3 10 f0       	push   $0xf010c365
+f0103d1d:	68 59 01 00 00       	push   $0x159
+f0103d22:	68 3a c3 10 f0       	push   $0xf010c33a
+f0103d27:	e8 14 c3 ff ff       	call   f0100040 <_panic>
+			panic("page_insert failed");
+f0103d2c:	83 ec 04             	sub    $0x4,%esp
+f0103d2f:	68 7b c3 10 f0       	push   $0xf010c37b
+f0103d34:	68 5d 01 00 00       	push   $0x15d
+f0103d39:	68 3a c3 10 f0       	push   $0xf010c33a
+f0103d3e:	e8 fd c2 ff ff       	call   f0100040 <_panic>
+
+f0103d43 <envid2env>:
+{
+f0103d43:	55                   	push   %ebp
+f0103d44:	89 e5                	mov    %esp,%ebp
+f0103d46:	56                   	push   %esi
+f0103d47:	53                   	push   %ebx
+f0103d48:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (envid == 0) {
+f0103d4b:	85 f6                	test   %esi,%esi
+f0103d4d:	74 3b                	je     f0103d8a <envid2env+0x47>
+	e = &envs[ENVX(envid)];
+f0103d4f:	89 f3                	mov    %esi,%ebx
+f0103d51:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+f0103d57:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+f0103d5d:	03 1d 50 c2 92 f0    	add    0xf092c250,%ebx
+	if (e->env_status == ENV_FREE || e->env_id != envid) {
+f0103d63:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f0103d67:	0f 84 83 00 00 00    	je     f0103df0 <envid2env+0xad>
+f0103d6d:	39 73 48             	cmp    %esi,0x48(%ebx)
+f0103d70:	0f 85 86 00 00 00    	jne    f0103dfc <envid2env+0xb9>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id
+f0103d76:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0103d7a:	75 23                	jne    f0103d9f <envid2env+0x5c>
+	return 0;
+f0103d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+		*env_store = curenv;
+f0103d81:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0103d84:	89 1a                	mov    %ebx,(%edx)
+}
+f0103d86:	5b                   	pop    %ebx
+f0103d87:	5e                   	pop    %esi
+f0103d88:	5d                   	pop    %ebp
+f0103d89:	c3                   	ret
+		*env_store = curenv;
+f0103d8a:	e8 6a 45 00 00       	call   f01082f9 <cpunum>
+f0103d8f:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0103d95:	8b 98 28 00 93 f0    	mov    -0xf6cffd8(%eax),%ebx
+		return 0;
+f0103d9b:	89 f0                	mov    %esi,%eax
+f0103d9d:	eb e2                	jmp    f0103d81 <envid2env+0x3e>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id
+f0103d9f:	e8 55 45 00 00       	call   f01082f9 <cpunum>
+f0103da4:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0103daa:	39 98 28 00 93 f0    	cmp    %ebx,-0xf6cffd8(%eax)
+f0103db0:	74 ca                	je     f0103d7c <envid2env+0x39>
+f0103db2:	8b 73 4c             	mov    0x4c(%ebx),%esi
+f0103db5:	e8 3f 45 00 00       	call   f01082f9 <cpunum>
+f0103dba:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0103dc0:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0103dc6:	3b 70 48             	cmp    0x48(%eax),%esi
+f0103dc9:	74 b1                	je     f0103d7c <envid2env+0x39>
+	    && e->env_pgdir != curenv->env_pgdir) {
+f0103dcb:	8b 73 70             	mov    0x70(%ebx),%esi
+f0103dce:	e8 26 45 00 00       	call   f01082f9 <cpunum>
+f0103dd3:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0103dd9:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0103ddf:	3b 70 70             	cmp    0x70(%eax),%esi
+f0103de2:	74 98                	je     f0103d7c <envid2env+0x39>
+f0103de4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103de9:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103dee:	eb 91                	jmp    f0103d81 <envid2env+0x3e>
+f0103df0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103df5:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103dfa:	eb 85                	jmp    f0103d81 <envid2env+0x3e>
+f0103dfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103e01:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103e06:	e9 76 ff ff ff       	jmp    f0103d81 <envid2env+0x3e>
+
+f0103e0b <env_init_percpu>:
+	__asm __volatile("lgdt (%0)" : : "r" (p));
+f0103e0b:	b8 00 83 11 f0       	mov    $0xf0118300,%eax
+f0103e10:	0f 01 10             	lgdtl  (%eax)
+	asm volatile("movw %%ax,%%gs" :: "a" (GD_UD|3));
+f0103e13:	b8 23 00 00 00       	mov    $0x23,%eax
+f0103e18:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" :: "a" (GD_UD|3));
+f0103e1a:	8e e0                	mov    %eax,%fs
+	asm volatile("movw %%ax,%%es" :: "a" (GD_KD));
+f0103e1c:	b8 10 00 00 00       	mov    $0x10,%eax
+f0103e21:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" :: "a" (GD_KD));
+f0103e23:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" :: "a" (GD_KD));
+f0103e25:	8e d0                	mov    %eax,%ss
+	asm volatile("ljmp %0,$1f\n 1:\n" :: "i" (GD_KT));
+f0103e27:	ea 2e 3e 10 f0 08 00 	ljmp   $0x8,$0xf0103e2e
+	__asm __volatile("lldt %0" : : "r" (sel));
+f0103e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103e33:	0f 00 d0             	lldt   %ax
+}
+f0103e36:	c3                   	ret
+
+f0103e37 <env_init>:
+{
+f0103e37:	55                   	push   %ebp
+f0103e38:	89 e5                	mov    %esp,%ebp
+f0103e3a:	53                   	push   %ebx
+f0103e3b:	83 ec 04             	sub    $0x4,%esp
+		envs[i].env_status = ENV_FREE;
+f0103e3e:	8b 1d 50 c2 92 f0    	mov    0xf092c250,%ebx
+f0103e44:	8b 15 54 c2 92 f0    	mov    0xf092c254,%edx
+f0103e4a:	8d 83 44 ef 02 00    	lea    0x2ef44(%ebx),%eax
+f0103e50:	89 d1                	mov    %edx,%ecx
+f0103e52:	89 c2                	mov    %eax,%edx
+f0103e54:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+		envs[i].env_id = 0;
+f0103e5b:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+		envs[i].env_link = env_free_list;	
+f0103e62:	89 48 44             	mov    %ecx,0x44(%eax)
+	for(i = NENV - 1; i >= 0; i--) {
+f0103e65:	2d bc 00 00 00       	sub    $0xbc,%eax
+f0103e6a:	39 da                	cmp    %ebx,%edx
+f0103e6c:	75 e2                	jne    f0103e50 <env_init+0x19>
+f0103e6e:	89 1d 54 c2 92 f0    	mov    %ebx,0xf092c254
+	env_init_percpu();
+f0103e74:	e8 92 ff ff ff       	call   f0103e0b <env_init_percpu>
+}
+f0103e79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103e7c:	c9                   	leave
+f0103e7d:	c3                   	ret
+
+f0103e7e <env_alloc_vm>:
+{
+f0103e7e:	55                   	push   %ebp
+f0103e7f:	89 e5                	mov    %esp,%ebp
+f0103e81:	56                   	push   %esi
+f0103e82:	53                   	push   %ebx
+f0103e83:	8b 55 10             	mov    0x10(%ebp),%edx
+	if (!(e = env_free_list))
+f0103e86:	8b 1d 54 c2 92 f0    	mov    0xf092c254,%ebx
+f0103e8c:	85 db                	test   %ebx,%ebx
+f0103e8e:	0f 84 1d 02 00 00    	je     f01040b1 <env_alloc_vm+0x233>
+	if (share) {
+f0103e94:	85 d2                	test   %edx,%edx
+f0103e96:	0f 84 4c 01 00 00    	je     f0103fe8 <env_alloc_vm+0x16a>
+	if ((uint32_t)kva < KERNBASE)
+f0103e9c:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0103ea2:	0f 86 17 01 00 00    	jbe    f0103fbf <env_alloc_vm+0x141>
+	return (physaddr_t)kva - KERNBASE;
+f0103ea8:	8d 82 00 00 00 10    	lea    0x10000000(%edx),%eax
+	if (PGNUM(pa) >= npages)
+f0103eae:	c1 e8 0c             	shr    $0xc,%eax
+f0103eb1:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0103eb7:	0f 83 17 01 00 00    	jae    f0103fd4 <env_alloc_vm+0x156>
+	return &pages[PGNUM(pa)];
+f0103ebd:	c1 e0 04             	shl    $0x4,%eax
+f0103ec0:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+		pa2page(PADDR(share))->pp_ref++;
+f0103ec6:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+		e->env_pgdir = share;
+f0103ecb:	89 53 70             	mov    %edx,0x70(%ebx)
+	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0103ece:	8b 43 48             	mov    0x48(%ebx),%eax
+f0103ed1:	05 00 10 00 00       	add    $0x1000,%eax
+		generation = 1 << ENVGENSHIFT;
+f0103ed6:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+f0103edb:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103ee0:	0f 4e c2             	cmovle %edx,%eax
+	e->env_id = generation | (e - envs);
+f0103ee3:	89 da                	mov    %ebx,%edx
+f0103ee5:	2b 15 50 c2 92 f0    	sub    0xf092c250,%edx
+f0103eeb:	c1 fa 02             	sar    $0x2,%edx
+f0103eee:	69 d2 cf 46 7d 67    	imul   $0x677d46cf,%edx,%edx
+f0103ef4:	09 d0                	or     %edx,%eax
+f0103ef6:	89 43 48             	mov    %eax,0x48(%ebx)
+	e->env_parent_id = parent_id;
+f0103ef9:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103efc:	89 43 4c             	mov    %eax,0x4c(%ebx)
+	e->env_type = ENV_TYPE_USER;
+f0103eff:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f0103f06:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+	e->env_runs = 0;
+f0103f0d:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+	e->env_syscalls = 0;
+f0103f14:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+	e->env_cycles = 0;
+f0103f1b:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+f0103f22:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+	e->env_alarm = 0;
+f0103f29:	c7 83 a0 00 00 00 00 	movl   $0x0,0xa0(%ebx)
+f0103f30:	00 00 00 
+	e->env_alarm_pending = 0;
+f0103f33:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+f0103f3a:	00 00 00 
+	e->env_futex_pa = 0;
+f0103f3d:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+f0103f44:	00 00 00 
+	e->env_futex_link = NULL;
+f0103f47:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+f0103f4e:	00 00 00 
+	e->env_netq = 0;
+f0103f51:	c7 43 6c 00 00 00 00 	movl   $0x0,0x6c(%ebx)
+	memset(&(e->env_tf), 0, sizeof(e->env_tf));
+f0103f58:	83 ec 04             	sub    $0x4,%esp
+f0103f5b:	6a 44                	push   $0x44
+f0103f5d:	6a 00                	push   $0x0
+f0103f5f:	53                   	push   %ebx
+f0103f60:	e8 39 3d 00 00       	call   f0107c9e <memset>
+	e->env_tf.tf_ds = GD_UD | 3;
+f0103f65:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+	e->env_tf.tf_es = GD_UD | 3;
+f0103f6b:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+	e->env_tf.tf_ss = GD_UD | 3;
+f0103f71:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+	e->env_tf.tf_esp = USTACKTOP;
+f0103f77:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+	e->env_tf.tf_cs = GD_UT | 3;
+f0103f7e:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+	e->env_tf.tf_eflags |= FL_IF;
+f0103f84:	81 4b 38 00 02 00 00 	orl    $0x200,0x38(%ebx)
+	e->env_pgfault_upcall = 0;
+f0103f8b:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+	e->env_uxstacktop = UXSTACKTOP;
+f0103f92:	c7 43 7c 00 00 c0 ee 	movl   $0xeec00000,0x7c(%ebx)
+	e->env_ipc_recving = 0;
+f0103f99:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+f0103fa0:	00 00 00 
+	env_free_list = e->env_link;
+f0103fa3:	8b 43 44             	mov    0x44(%ebx),%eax
+f0103fa6:	a3 54 c2 92 f0       	mov    %eax,0xf092c254
+	*newenv_store = e;
+f0103fab:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103fae:	89 18                	mov    %ebx,(%eax)
+	return 0;
+f0103fb0:	83 c4 10             	add    $0x10,%esp
+f0103fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103fb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0103fbb:	5b                   	pop    %ebx
+f0103fbc:	5e                   	pop    %esi
+f0103fbd:	5d                   	pop    %ebp
+f0103fbe:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103fbf:	52                   	push   %edx
+f0103fc0:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0103fc5:	68 b4 00 00 00       	push   $0xb4
+f0103fca:	68 3a c3 10 f0       	push   $0xf010c33a
+f0103fcf:	e8 6c c0 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0103fd4:	83 ec 04             	sub    $0x4,%esp
+f0103fd7:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f0103fdc:	6a 67                	push   $0x67
+f0103fde:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0103fe3:	e8 58 c0 ff ff       	call   f0100040 <_panic>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f0103fe8:	83 ec 0c             	sub    $0xc,%esp
+f0103feb:	6a 01                	push   $0x1
+f0103fed:	e8 99 d8 ff ff       	call   f010188b <page_alloc>
+f0103ff2:	89 c6                	mov    %eax,%esi
+f0103ff4:	83 c4 10             	add    $0x10,%esp
+f0103ff7:	85 c0                	test   %eax,%eax
+f0103ff9:	0f 84 bc 00 00 00    	je     f01040bb <env_alloc_vm+0x23d>
+	p->pp_ref++;
+f0103fff:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	memmove(page2kva(p), kern_pgdir, PGSIZE);
+f0104004:	8b 15 f0 f3 92 f0    	mov    0xf092f3f0,%edx
+	return (pp - pages) << PGSHIFT;
+f010400a:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0104010:	c1 f8 04             	sar    $0x4,%eax
+f0104013:	89 c1                	mov    %eax,%ecx
+f0104015:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0104018:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010401d:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0104023:	73 53                	jae    f0104078 <env_alloc_vm+0x1fa>
+f0104025:	83 ec 04             	sub    $0x4,%esp
+f0104028:	68 00 10 00 00       	push   $0x1000
+f010402d:	52                   	push   %edx
+	return (void *)(pa + KERNBASE);
+f010402e:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0104034:	51                   	push   %ecx
+f0104035:	e8 99 3c 00 00       	call   f0107cd3 <memmove>
+	return (pp - pages) << PGSHIFT;
+f010403a:	2b 35 f4 f3 92 f0    	sub    0xf092f3f4,%esi
+f0104040:	c1 fe 04             	sar    $0x4,%esi
+f0104043:	89 f0                	mov    %esi,%eax
+f0104045:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f0104048:	81 e6 ff ff 0f 00    	and    $0xfffff,%esi
+f010404e:	83 c4 10             	add    $0x10,%esp
+f0104051:	3b 35 ec f3 92 f0    	cmp    0xf092f3ec,%esi
+f0104057:	73 31                	jae    f010408a <env_alloc_vm+0x20c>
+	return (void *)(pa + KERNBASE);
+f0104059:	8d 90 00 00 00 f0    	lea    -0x10000000(%eax),%edx
+	e->env_pgdir = (pde_t*)page2kva(p);
+f010405f:	89 53 70             	mov    %edx,0x70(%ebx)
+	if ((uint32_t)kva < KERNBASE)
+f0104062:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0104068:	76 32                	jbe    f010409c <env_alloc_vm+0x21e>
+	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f010406a:	83 c8 05             	or     $0x5,%eax
+f010406d:	89 82 f4 0e 00 00    	mov    %eax,0xef4(%edx)
+	return 0;
+f0104073:	e9 56 fe ff ff       	jmp    f0103ece <env_alloc_vm+0x50>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0104078:	51                   	push   %ecx
+f0104079:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f010407e:	6a 6e                	push   $0x6e
+f0104080:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0104085:	e8 b6 bf ff ff       	call   f0100040 <_panic>
+f010408a:	50                   	push   %eax
+f010408b:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0104090:	6a 6e                	push   $0x6e
+f0104092:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0104097:	e8 a4 bf ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010409c:	52                   	push   %edx
+f010409d:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01040a2:	68 dd 00 00 00       	push   $0xdd
+f01040a7:	68 3a c3 10 f0       	push   $0xf010c33a
+f01040ac:	e8 8f bf ff ff       	call   f0100040 <_panic>
+		return -E_NO_FREE_ENV;
+f01040b1:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f01040b6:	e9 fd fe ff ff       	jmp    f0103fb8 <env_alloc_vm+0x13a>
+		return -E_NO_MEM;
+f01040bb:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01040c0:	e9 f3 fe ff ff       	jmp    f0103fb8 <env_alloc_vm+0x13a>
+
+f01040c5 <env_alloc>:
+{
+f01040c5:	55                   	push   %ebp
+f01040c6:	89 e5                	mov    %esp,%ebp
+f01040c8:	83 ec 0c             	sub    $0xc,%esp
+	return env_alloc_vm(newenv_store, parent_id, NULL);
+f01040cb:	6a 00                	push   $0x0
+f01040cd:	ff 75 0c             	push   0xc(%ebp)
+f01040d0:	ff 75 08             	push   0x8(%ebp)
+f01040d3:	e8 a6 fd ff ff       	call   f0103e7e <env_alloc_vm>
+}
+f01040d8:	c9                   	leave
+f01040d9:	c3                   	ret
+
+f01040da <env_create>:
+// before running the first user-mode environment.
+// The new env's parent ID is set to 0.
+//
+void
+env_create(uint8_t *binary, size_t size, enum EnvType type)
+{
+f01040da:	55                   	push   %ebp
+f01040db:	89 e5                	mov    %esp,%ebp
+f01040dd:	57                   	push   %edi
+f01040de:	56                   	push   %esi
+f01040df:	53                   	push   %ebx
+f01040e0:	83 ec 34             	sub    $0x34,%esp
+f01040e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	// LAB 3: Your code here.
+	struct Env *e;
+	int32_t err;
+	err = env_alloc(&e,0);
+f01040e6:	6a 00                	push   $0x0
+f01040e8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01040eb:	50                   	push   %eax
+f01040ec:	e8 d4 ff ff ff       	call   f01040c5 <env_alloc>
+	if(err != 0)
+f01040f1:	83 c4 10             	add    $0x10,%esp
+f01040f4:	85 c0                	test   %eax,%eax
+f01040f6:	75 68                	jne    f0104160 <env_create+0x86>
+		panic("env_alloc failed: %e", err);
+	load_icode(e, binary, size);
+f01040f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01040fb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	ph = (struct Proghdr *)((uint8_t*)binary + elf->e_phoff);
+f01040fe:	89 fb                	mov    %edi,%ebx
+f0104100:	03 5f 1c             	add    0x1c(%edi),%ebx
+	eph = ph + elf->e_phnum;
+f0104103:	0f b7 77 2c          	movzwl 0x2c(%edi),%esi
+f0104107:	c1 e6 05             	shl    $0x5,%esi
+f010410a:	01 de                	add    %ebx,%esi
+	tlb_load_pgdir(e->env_pgdir);
+f010410c:	83 ec 0c             	sub    $0xc,%esp
+f010410f:	ff 70 70             	push   0x70(%eax)
+f0104112:	e8 58 48 00 00       	call   f010896f <tlb_load_pgdir>
+	for(; ph < eph; ph++) {
+f0104117:	83 c4 10             	add    $0x10,%esp
+f010411a:	39 f3                	cmp    %esi,%ebx
+f010411c:	72 77                	jb     f0104195 <env_create+0xbb>
+	e->env_tf.tf_eip = elf->e_entry;
+f010411e:	8b 47 18             	mov    0x18(%edi),%eax
+f0104121:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0104124:	89 47 30             	mov    %eax,0x30(%edi)
+	region_alloc(e, (void*)(USTACKTOP-PGSIZE), PGSIZE);
+f0104127:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f010412c:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+f0104131:	89 f8                	mov    %edi,%eax
+f0104133:	e8 21 fb ff ff       	call   f0103c59 <region_alloc>
+	tlb_load_pgdir(kern_pgdir);
+f0104138:	83 ec 0c             	sub    $0xc,%esp
+f010413b:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0104141:	e8 29 48 00 00       	call   f010896f <tlb_load_pgdir>
+	e->env_type = type; 
+f0104146:	8b 45 10             	mov    0x10(%ebp),%eax
+f0104149:	89 47 50             	mov    %eax,0x50(%edi)
+	if (type == ENV_TYPE_FS) {
+f010414c:	83 c4 10             	add    $0x10,%esp
+f010414f:	83 f8 02             	cmp    $0x2,%eax
+f0104152:	0f 84 85 00 00 00    	je     f01041dd <env_create+0x103>
+		e->env_tf.tf_eflags |= FL_IOPL_3;
+	}
+	// If this is the file server (type == ENV_TYPE_FS) give it I/O privileges.
+	// LAB 5: Your code here.
+}
+f0104158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010415b:	5b                   	pop    %ebx
+f010415c:	5e                   	pop    %esi
+f010415d:	5f                   	pop    %edi
+f010415e:	5d                   	pop    %ebp
+f010415f:	c3                   	ret
+		panic("env_alloc failed: %e", err);
+f0104160:	50                   	push   %eax
+f0104161:	68 8e c3 10 f0       	push   $0xf010c38e
+f0104166:	68 f2 01 00 00       	push   $0x1f2
+f010416b:	68 3a c3 10 f0       	push   $0xf010c33a
+f0104170:	e8 cb be ff ff       	call   f0100040 <_panic>
+		assert(ph->p_memsz >= ph->p_filesz);
+f0104175:	68 a3 c3 10 f0       	push   $0xf010c3a3
+f010417a:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010417f:	68 cc 01 00 00       	push   $0x1cc
+f0104184:	68 3a c3 10 f0       	push   $0xf010c33a
+f0104189:	e8 b2 be ff ff       	call   f0100040 <_panic>
+	for(; ph < eph; ph++) {
+f010418e:	83 c3 20             	add    $0x20,%ebx
+f0104191:	39 f3                	cmp    %esi,%ebx
+f0104193:	73 89                	jae    f010411e <env_create+0x44>
+		if(ph->p_type != ELF_PROG_LOAD)
+f0104195:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0104198:	75 f4                	jne    f010418e <env_create+0xb4>
+		assert(ph->p_memsz >= ph->p_filesz);
+f010419a:	8b 4b 14             	mov    0x14(%ebx),%ecx
+f010419d:	3b 4b 10             	cmp    0x10(%ebx),%ecx
+f01041a0:	72 d3                	jb     f0104175 <env_create+0x9b>
+		region_alloc(e, (void *)ph->p_va, ph->p_memsz);
+f01041a2:	8b 53 08             	mov    0x8(%ebx),%edx
+f01041a5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01041a8:	e8 ac fa ff ff       	call   f0103c59 <region_alloc>
+		memmove((uint8_t*)ph->p_va, (uint8_t*)binary+ph->p_offset, ph->p_filesz);
+f01041ad:	83 ec 04             	sub    $0x4,%esp
+f01041b0:	ff 73 10             	push   0x10(%ebx)
+f01041b3:	89 f8                	mov    %edi,%eax
+f01041b5:	03 43 04             	add    0x4(%ebx),%eax
+f01041b8:	50                   	push   %eax
+f01041b9:	ff 73 08             	push   0x8(%ebx)
+f01041bc:	e8 12 3b 00 00       	call   f0107cd3 <memmove>
+		memset((uint8_t*)ph->p_va + ph->p_filesz, 0, ph->p_memsz - ph->p_filesz);
+f01041c1:	8b 43 10             	mov    0x10(%ebx),%eax
+f01041c4:	83 c4 0c             	add    $0xc,%esp
+f01041c7:	8b 53 14             	mov    0x14(%ebx),%edx
+f01041ca:	29 c2                	sub    %eax,%edx
+f01041cc:	52                   	push   %edx
+f01041cd:	6a 00                	push   $0x0
+f01041cf:	03 43 08             	add    0x8(%ebx),%eax
+f01041d2:	50                   	push   %eax
+f01041d3:	e8 c6 3a 00 00       	call   f0107c9e <memset>
+f01041d8:	83 c4 10             	add    $0x10,%esp
+f01041db:	eb b1                	jmp    f010418e <env_create+0xb4>
+		e->env_tf.tf_eflags |= FL_IOPL_3;
+f01041dd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01041e0:	81 48 38 00 30 00 00 	orl    $0x3000,0x38(%eax)
+}
+f01041e7:	e9 6c ff ff ff       	jmp    f0104158 <env_create+0x7e>
+
+f01041ec <env_free>:
+//
+// Frees env e and all memory it uses.
+//
+void
+env_free(struct Env *e)
+{
+f01041ec:	55                   	push   %ebp
+f01041ed:	89 e5                	mov    %esp,%ebp
+f01041ef:	57                   	push   %edi
+f01041f0:	56                   	push   %esi
+f01041f1:	53                   	push   %ebx
+f01041f2:	83 ec 1c             	sub    $0x1c,%esp
+f01041f5:	8b 75 08             	mov    0x8(%ebp),%esi
+	physaddr_t pa;
+
+	// If freeing the current environment, switch to kern_pgdir
+	// before freeing the page directory, just in case the page
+	// gets reused.
+	if (e == curenv)
+f01041f8:	e8 fc 40 00 00       	call   f01082f9 <cpunum>
+f01041fd:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104203:	39 b0 28 00 93 f0    	cmp    %esi,-0xf6cffd8(%eax)
+f0104209:	74 59                	je     f0104264 <env_free+0x78>
+		tlb_load_pgdir(kern_pgdir);
+
+	// Stop any futex wait, which keeps e on a hash chain, and wake
+	// the senders waiting for e to receive, to find it gone.
+	futex_cancel(e);
+f010420b:	83 ec 0c             	sub    $0xc,%esp
+f010420e:	56                   	push   %esi
+f010420f:	e8 f3 6b 00 00       	call   f010ae07 <futex_cancel>
+	e->env_ipc_nrecv++;
+f0104214:	83 86 9c 00 00 00 01 	addl   $0x1,0x9c(%esi)
+	futex_wake_pa(PADDR(&e->env_ipc_nrecv), NENV);
+f010421b:	8d 86 9c 00 00 00    	lea    0x9c(%esi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104221:	83 c4 10             	add    $0x10,%esp
+f0104224:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104229:	76 4c                	jbe    f0104277 <env_free+0x8b>
+f010422b:	83 ec 08             	sub    $0x8,%esp
+f010422e:	68 00 04 00 00       	push   $0x400
+	return (physaddr_t)kva - KERNBASE;
+f0104233:	05 00 00 00 10       	add    $0x10000000,%eax
+f0104238:	50                   	push   %eax
+f0104239:	e8 d0 6a 00 00       	call   f010ad0e <futex_wake_pa>
+	// cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+
+	// Flush all mapped pages in the user portion of the address space,
+	// unless other envs still share it (see env_setup_vm).
+	static_assert(UTOP % PTSIZE == 0);
+	pa = PADDR(e->env_pgdir);
+f010423e:	8b 7e 70             	mov    0x70(%esi),%edi
+	if ((uint32_t)kva < KERNBASE)
+f0104241:	83 c4 10             	add    $0x10,%esp
+f0104244:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f010424a:	76 40                	jbe    f010428c <env_free+0xa0>
+	return (physaddr_t)kva - KERNBASE;
+f010424c:	81 c7 00 00 00 10    	add    $0x10000000,%edi
+	if (PGNUM(pa) >= npages)
+f0104252:	c1 ef 0c             	shr    $0xc,%edi
+	return &pages[PGNUM(pa)];
+f0104255:	89 f8                	mov    %edi,%eax
+f0104257:	c1 e0 04             	shl    $0x4,%eax
+f010425a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010425d:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104262:	eb 5c                	jmp    f01042c0 <env_free+0xd4>
+		tlb_load_pgdir(kern_pgdir);
+f0104264:	83 ec 0c             	sub    $0xc,%esp
+f0104267:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f010426d:	e8 fd 46 00 00       	call   f010896f <tlb_load_pgdir>
+f0104272:	83 c4 10             	add    $0x10,%esp
+f0104275:	eb 94                	jmp    f010420b <env_free+0x1f>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0104277:	50                   	push   %eax
+f0104278:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f010427d:	68 0f 02 00 00       	push   $0x20f
+f0104282:	68 3a c3 10 f0       	push   $0xf010c33a
+f0104287:	e8 b4 bd ff ff       	call   f0100040 <_panic>
+f010428c:	57                   	push   %edi
+f010428d:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0104292:	68 17 02 00 00       	push   $0x217
+f0104297:	68 3a c3 10 f0       	push   $0xf010c33a
+f010429c:	e8 9f bd ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f01042a1:	83 ec 04             	sub    $0x4,%esp
+f01042a4:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f01042a9:	6a 67                	push   $0x67
+f01042ab:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01042b0:	e8 8b bd ff ff       	call   f0100040 <_panic>
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f01042b5:	83 c3 04             	add    $0x4,%ebx
+f01042b8:	81 fb ec 0e 00 00    	cmp    $0xeec,%ebx
+f01042be:	74 35                	je     f01042f5 <env_free+0x109>
+	if (PGNUM(pa) >= npages)
+f01042c0:	3b 3d ec f3 92 f0    	cmp    0xf092f3ec,%edi
+f01042c6:	73 d9                	jae    f01042a1 <env_free+0xb5>
+		if (pa2page(pa)->pp_ref > 1)
+f01042c8:	a1 f4 f3 92 f0       	mov    0xf092f3f4,%eax
+f01042cd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01042d0:	66 83 7c 08 04 01    	cmpw   $0x1,0x4(%eax,%ecx,1)
+f01042d6:	77 1d                	ja     f01042f5 <env_free+0x109>
+			break;
+
+		// only look at mapped page tables
+		if (!(e->env_pgdir[pdeno] & PTE_P))
+f01042d8:	8b 46 70             	mov    0x70(%esi),%eax
+f01042db:	f6 04 18 01          	testb  $0x1,(%eax,%ebx,1)
+f01042df:	74 d4                	je     f01042b5 <env_free+0xc9>
+			continue;
+
+		// unmap all PTEs in this page table and free the page
+		// table itself, unless other envs still share it
+		pgdir_release(e->env_pgdir, PGADDR(pdeno, 0, 0));
+f01042e1:	83 ec 08             	sub    $0x8,%esp
+f01042e4:	89 da                	mov    %ebx,%edx
+f01042e6:	c1 e2 14             	shl    $0x14,%edx
+f01042e9:	52                   	push   %edx
+f01042ea:	50                   	push   %eax
+f01042eb:	e8 ad dc ff ff       	call   f0101f9d <pgdir_release>
+f01042f0:	83 c4 10             	add    $0x10,%esp
+f01042f3:	eb c0                	jmp    f01042b5 <env_free+0xc9>
+	}
+
+	// free the page directory
+	e->env_pgdir = 0;
+f01042f5:	c7 46 70 00 00 00 00 	movl   $0x0,0x70(%esi)
+f01042fc:	3b 3d ec f3 92 f0    	cmp    0xf092f3ec,%edi
+f0104302:	73 32                	jae    f0104336 <env_free+0x14a>
+	page_decref(pa2page(pa));
+f0104304:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0104307:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010430a:	03 05 f4 f3 92 f0    	add    0xf092f3f4,%eax
+f0104310:	50                   	push   %eax
+f0104311:	e8 5f d3 ff ff       	call   f0101675 <page_decref>
+
+	// return the environment to the free list
+	e->env_status = ENV_FREE;
+f0104316:	c7 46 54 00 00 00 00 	movl   $0x0,0x54(%esi)
+	e->env_link = env_free_list;
+f010431d:	a1 54 c2 92 f0       	mov    0xf092c254,%eax
+f0104322:	89 46 44             	mov    %eax,0x44(%esi)
+	env_free_list = e;
+f0104325:	89 35 54 c2 92 f0    	mov    %esi,0xf092c254
+}
+f010432b:	83 c4 10             	add    $0x10,%esp
+f010432e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104331:	5b                   	pop    %ebx
+f0104332:	5e                   	pop    %esi
+f0104333:	5f                   	pop    %edi
+f0104334:	5d                   	pop    %ebp
+f0104335:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0104336:	83 ec 04             	sub    $0x4,%esp
+f0104339:	68 d8 bb 10 f0       	push   $0xf010bbd8
+f010433e:	6a 67                	push   $0x67
+f0104340:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0104345:	e8 f6 bc ff ff       	call   f0100040 <_panic>
+
+f010434a <env_destroy>:
+// If e was the current env, then runs a new environment (and does not return
+// to the caller).
+//
+void
+env_destroy(struct Env *e)
+{
+f010434a:	55                   	push   %ebp
+f010434b:	89 e5                	mov    %esp,%ebp
+f010434d:	53                   	push   %ebx
+f010434e:	83 ec 04             	sub    $0x4,%esp
+f0104351:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// If e is currently running on other CPUs, we change its state to
+	// ENV_DYING. A zombie environment will be freed the next time
+	// it traps to the kernel.
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104354:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f0104358:	74 24                	je     f010437e <env_destroy+0x34>
+		e->env_status = ENV_DYING;
+		return;
+	}
+
+	env_free(e);
+f010435a:	83 ec 0c             	sub    $0xc,%esp
+f010435d:	53                   	push   %ebx
+f010435e:	e8 89 fe ff ff       	call   f01041ec <env_free>
+
+	if (curenv == e) {
+f0104363:	e8 91 3f 00 00       	call   f01082f9 <cpunum>
+f0104368:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010436e:	83 c4 10             	add    $0x10,%esp
+f0104371:	39 98 28 00 93 f0    	cmp    %ebx,-0xf6cffd8(%eax)
+f0104377:	74 21                	je     f010439a <env_destroy+0x50>
+		curenv = NULL;
+		sched_yield();
+	}
+}
+f0104379:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010437c:	c9                   	leave
+f010437d:	c3                   	ret
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f010437e:	e8 76 3f 00 00       	call   f01082f9 <cpunum>
+f0104383:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104389:	39 98 28 00 93 f0    	cmp    %ebx,-0xf6cffd8(%eax)
+f010438f:	74 c9                	je     f010435a <env_destroy+0x10>
+		e->env_status = ENV_DYING;
+f0104391:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+		return;
+f0104398:	eb df                	jmp    f0104379 <env_destroy+0x2f>
+		curenv = NULL;
+f010439a:	e8 5a 3f 00 00       	call   f01082f9 <cpunum>
+f010439f:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01043a5:	c7 80 28 00 93 f0 00 	movl   $0x0,-0xf6cffd8(%eax)
+f01043ac:	00 00 00 
+		sched_yield();
+f01043af:	e8 3e 17 00 00       	call   f0105af2 <sched_yield>
+
+f01043b4 <env_pop_tf>:
+//
+// This function does not return.
+//
+void
+env_pop_tf(struct Trapframe *tf)
+{
+f01043b4:	55                   	push   %ebp
+f01043b5:	89 e5                	mov    %esp,%ebp
+f01043b7:	53                   	push   %ebx
+f01043b8:	83 ec 04             	sub    $0x4,%esp
+	// Record the CPU we are running on for user-space debugging
+	curenv->env_cpunum = cpunum();
+f01043bb:	e8 39 3f 00 00       	call   f01082f9 <cpunum>
+f01043c0:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01043c6:	8b 98 28 00 93 f0    	mov    -0xf6cffd8(%eax),%ebx
+f01043cc:	e8 28 3f 00 00       	call   f01082f9 <cpunum>
+f01043d1:	89 43 68             	mov    %eax,0x68(%ebx)
+
+	__asm __volatile("movl %0,%%esp\n"
+f01043d4:	8b 65 08             	mov    0x8(%ebp),%esp
+f01043d7:	61                   	popa
+f01043d8:	07                   	pop    %es
+f01043d9:	1f                   	pop    %ds
+f01043da:	83 c4 08             	add    $0x8,%esp
+f01043dd:	cf                   	iret
+		"\tpopl %%es\n"
+		"\tpopl %%ds\n"
+		"\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+		"\tiret"
+		: : "g" (tf) : "memory");
+	panic("iret failed");  /* mostly to placate the compiler */
+f01043de:	83 ec 04             	sub    $0x4,%esp
+f01043e1:	68 bf c3 10 f0       	push   $0xf010c3bf
+f01043e6:	68 5b 02 00 00       	push   $0x25b
+f01043eb:	68 3a c3 10 f0       	push   $0xf010c33a
+f01043f0:	e8 4b bc ff ff       	call   f0100040 <_panic>
+
+f01043f5 <env_run>:
+//
+// This function does not return.
+//
+void
+env_run(struct Env *e)
+{
+f01043f5:	55                   	push   %ebp
+f01043f6:	89 e5                	mov    %esp,%ebp
+f01043f8:	57                   	push   %edi
+f01043f9:	56                   	push   %esi
+f01043fa:	83 ec 10             	sub    $0x10,%esp
+        __asm __volatile("rdtsc" : "=A" (tsc));
+f01043fd:	0f 31                	rdtsc
+f01043ff:	89 c6                	mov    %eax,%esi
+f0104401:	89 d7                	mov    %edx,%edi
+	// LAB 3: Your code here.
+	uint64_t now = read_tsc();
+
+	// Charge the time since the last switch on this CPU, in user
+	// mode and in the kernel on its behalf, to the env that had it.
+	if(curenv != NULL)
+f0104403:	e8 f1 3e 00 00       	call   f01082f9 <cpunum>
+f0104408:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010440e:	83 b8 28 00 93 f0 00 	cmpl   $0x0,-0xf6cffd8(%eax)
+f0104415:	74 44                	je     f010445b <env_run+0x66>
+		curenv->env_cycles += now - thiscpu->cpu_charged;
+f0104417:	e8 dd 3e 00 00       	call   f01082f9 <cpunum>
+f010441c:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104422:	8b 90 30 00 93 f0    	mov    -0xf6cffd0(%eax),%edx
+f0104428:	8b 80 2c 00 93 f0    	mov    -0xf6cffd4(%eax),%eax
+f010442e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0104431:	89 55 f4             	mov    %edx,-0xc(%ebp)
+f0104434:	e8 c0 3e 00 00       	call   f01082f9 <cpunum>
+f0104439:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010443f:	8b 88 28 00 93 f0    	mov    -0xf6cffd8(%eax),%ecx
+f0104445:	8b 41 60             	mov    0x60(%ecx),%eax
+f0104448:	8b 51 64             	mov    0x64(%ecx),%edx
+f010444b:	2b 45 f0             	sub    -0x10(%ebp),%eax
+f010444e:	1b 55 f4             	sbb    -0xc(%ebp),%edx
+f0104451:	01 f0                	add    %esi,%eax
+f0104453:	11 fa                	adc    %edi,%edx
+f0104455:	89 41 60             	mov    %eax,0x60(%ecx)
+f0104458:	89 51 64             	mov    %edx,0x64(%ecx)
+	thiscpu->cpu_charged = now;
+f010445b:	e8 99 3e 00 00       	call   f01082f9 <cpunum>
+f0104460:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104466:	89 b0 2c 00 93 f0    	mov    %esi,-0xf6cffd4(%eax)
+f010446c:	89 b8 30 00 93 f0    	mov    %edi,-0xf6cffd0(%eax)
+	if(curenv != NULL) {
+f0104472:	e8 82 3e 00 00       	call   f01082f9 <cpunum>
+f0104477:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010447d:	83 b8 28 00 93 f0 00 	cmpl   $0x0,-0xf6cffd8(%eax)
+f0104484:	74 1b                	je     f01044a1 <env_run+0xac>
+		if(curenv->env_status == ENV_RUNNING)
+f0104486:	e8 6e 3e 00 00       	call   f01082f9 <cpunum>
+f010448b:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104491:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104497:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f010449b:	0f 84 89 00 00 00    	je     f010452a <env_run+0x135>
+			curenv->env_status = ENV_RUNNABLE;
+	}
+	curenv = e;
+f01044a1:	e8 53 3e 00 00       	call   f01082f9 <cpunum>
+f01044a6:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01044ac:	8b 55 08             	mov    0x8(%ebp),%edx
+f01044af:	89 90 28 00 93 f0    	mov    %edx,-0xf6cffd8(%eax)
+	curenv->env_status = ENV_RUNNING;
+f01044b5:	e8 3f 3e 00 00       	call   f01082f9 <cpunum>
+f01044ba:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01044c0:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01044c6:	c7 40 54 03 00 00 00 	movl   $0x3,0x54(%eax)
+	curenv->env_runs++;
+f01044cd:	e8 27 3e 00 00       	call   f01082f9 <cpunum>
+f01044d2:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01044d8:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01044de:	83 40 58 01          	addl   $0x1,0x58(%eax)
+	tlb_load_pgdir(curenv->env_pgdir);
+f01044e2:	e8 12 3e 00 00       	call   f01082f9 <cpunum>
+f01044e7:	83 ec 0c             	sub    $0xc,%esp
+f01044ea:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01044f0:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01044f6:	ff 70 70             	push   0x70(%eax)
+f01044f9:	e8 71 44 00 00       	call   f010896f <tlb_load_pgdir>
+	// Other CPUs must drop stale translations before we let them
+	// back into the kernel or run the envs we just modified.
+	tlb_shootdown();
+f01044fe:	e8 0e 45 00 00       	call   f0108a11 <tlb_shootdown>
+}
+
+static inline void
+unlock_kernel(void)
+{
+	spin_unlock(&kernel_lock);
+f0104503:	c7 04 24 a0 87 11 f0 	movl   $0xf01187a0,(%esp)
+f010450a:	e8 58 41 00 00       	call   f0108667 <spin_unlock>
+
+	// Normally we wouldn't need to do this, but QEMU only runs
+	// one CPU at a time and has a long time-slice.  Without the
+	// pause, this CPU is likely to reacquire the lock before
+	// another CPU has even been given a chance to acquire it.
+	asm volatile("pause");
+f010450f:	f3 90                	pause
+	unlock_kernel();
+	env_pop_tf(&(curenv->env_tf));
+f0104511:	e8 e3 3d 00 00       	call   f01082f9 <cpunum>
+f0104516:	83 c4 04             	add    $0x4,%esp
+f0104519:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010451f:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0104525:	e8 8a fe ff ff       	call   f01043b4 <env_pop_tf>
+			curenv->env_status = ENV_RUNNABLE;
+f010452a:	e8 ca 3d 00 00       	call   f01082f9 <cpunum>
+f010452f:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104535:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f010453b:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0104542:	e9 5a ff ff ff       	jmp    f01044a1 <env_run+0xac>
+
+f0104547 <mc146818_read>:
+#include <kern/kclock.h>
+
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f0104547:	55                   	push   %ebp
+f0104548:	89 e5                	mov    %esp,%ebp
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010454a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010454d:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104552:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0104553:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104558:	ec                   	in     (%dx),%al
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+f0104559:	0f b6 c0             	movzbl %al,%eax
+}
+f010455c:	5d                   	pop    %ebp
+f010455d:	c3                   	ret
+
+f010455e <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f010455e:	55                   	push   %ebp
+f010455f:	89 e5                	mov    %esp,%ebp
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104561:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104564:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104569:	ee                   	out    %al,(%dx)
+f010456a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010456d:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104572:	ee                   	out    %al,(%dx)
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
+f0104573:	5d                   	pop    %ebp
+f0104574:	c3                   	ret
+
+f0104575 <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f0104575:	55                   	push   %ebp
+f0104576:	89 e5                	mov    %esp,%ebp
+f0104578:	56                   	push   %esi
+f0104579:	53                   	push   %ebx
+f010457a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f010457d:	66 89 0d 88 83 11 f0 	mov    %cx,0xf0118388
+	if (!didinit)
+f0104584:	83 3d 58 c2 92 f0 00 	cmpl   $0x0,0xf092c258
+f010458b:	75 07                	jne    f0104594 <irq_setmask_8259A+0x1f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & (1<<i))
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f010458d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104590:	5b                   	pop    %ebx
+f0104591:	5e                   	pop    %esi
+f0104592:	5d                   	pop    %ebp
+f0104593:	c3                   	ret
+f0104594:	89 ce                	mov    %ecx,%esi
+f0104596:	ba 21 00 00 00       	mov    $0x21,%edx
+f010459b:	89 c8                	mov    %ecx,%eax
+f010459d:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f010459e:	89 c8                	mov    %ecx,%eax
+f01045a0:	66 c1 e8 08          	shr    $0x8,%ax
+f01045a4:	ba a1 00 00 00       	mov    $0xa1,%edx
+f01045a9:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f01045aa:	83 ec 0c             	sub    $0xc,%esp
+f01045ad:	68 cb c3 10 f0       	push   $0xf010c3cb
+f01045b2:	e8 35 01 00 00       	call   f01046ec <cprintf>
+f01045b7:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f01045ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (~mask & (1<<i))
+f01045bf:	0f b7 f6             	movzwl %si,%esi
+f01045c2:	f7 d6                	not    %esi
+f01045c4:	eb 08                	jmp    f01045ce <irq_setmask_8259A+0x59>
+	for (i = 0; i < 16; i++)
+f01045c6:	83 c3 01             	add    $0x1,%ebx
+f01045c9:	83 fb 10             	cmp    $0x10,%ebx
+f01045cc:	74 18                	je     f01045e6 <irq_setmask_8259A+0x71>
+		if (~mask & (1<<i))
+f01045ce:	0f a3 de             	bt     %ebx,%esi
+f01045d1:	73 f3                	jae    f01045c6 <irq_setmask_8259A+0x51>
+			cprintf(" %d", i);
+f01045d3:	83 ec 08             	sub    $0x8,%esp
+f01045d6:	53                   	push   %ebx
+f01045d7:	68 07 c9 10 f0       	push   $0xf010c907
+f01045dc:	e8 0b 01 00 00       	call   f01046ec <cprintf>
+f01045e1:	83 c4 10             	add    $0x10,%esp
+f01045e4:	eb e0                	jmp    f01045c6 <irq_setmask_8259A+0x51>
+	cprintf("\n");
+f01045e6:	83 ec 0c             	sub    $0xc,%esp
+f01045e9:	68 8b bb 10 f0       	push   $0xf010bb8b
+f01045ee:	e8 f9 00 00 00       	call   f01046ec <cprintf>
+f01045f3:	83 c4 10             	add    $0x10,%esp
+f01045f6:	eb 95                	jmp    f010458d <irq_setmask_8259A+0x18>
+
+f01045f8 <pic_init>:
+{
+f01045f8:	55                   	push   %ebp
+f01045f9:	89 e5                	mov    %esp,%ebp
+f01045fb:	57                   	push   %edi
+f01045fc:	56                   	push   %esi
+f01045fd:	53                   	push   %ebx
+f01045fe:	83 ec 0c             	sub    $0xc,%esp
+	didinit = 1;
+f0104601:	c7 05 58 c2 92 f0 01 	movl   $0x1,0xf092c258
+f0104608:	00 00 00 
+f010460b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0104610:	bb 21 00 00 00       	mov    $0x21,%ebx
+f0104615:	89 da                	mov    %ebx,%edx
+f0104617:	ee                   	out    %al,(%dx)
+f0104618:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f010461d:	89 ca                	mov    %ecx,%edx
+f010461f:	ee                   	out    %al,(%dx)
+f0104620:	bf 11 00 00 00       	mov    $0x11,%edi
+f0104625:	be 20 00 00 00       	mov    $0x20,%esi
+f010462a:	89 f8                	mov    %edi,%eax
+f010462c:	89 f2                	mov    %esi,%edx
+f010462e:	ee                   	out    %al,(%dx)
+f010462f:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104634:	89 da                	mov    %ebx,%edx
+f0104636:	ee                   	out    %al,(%dx)
+f0104637:	b8 04 00 00 00       	mov    $0x4,%eax
+f010463c:	ee                   	out    %al,(%dx)
+f010463d:	b8 03 00 00 00       	mov    $0x3,%eax
+f0104642:	ee                   	out    %al,(%dx)
+f0104643:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f0104648:	89 f8                	mov    %edi,%eax
+f010464a:	89 da                	mov    %ebx,%edx
+f010464c:	ee                   	out    %al,(%dx)
+f010464d:	b8 28 00 00 00       	mov    $0x28,%eax
+f0104652:	89 ca                	mov    %ecx,%edx
+f0104654:	ee                   	out    %al,(%dx)
+f0104655:	b8 02 00 00 00       	mov    $0x2,%eax
+f010465a:	ee                   	out    %al,(%dx)
+f010465b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104660:	ee                   	out    %al,(%dx)
+f0104661:	bf 68 00 00 00       	mov    $0x68,%edi
+f0104666:	89 f8                	mov    %edi,%eax
+f0104668:	89 f2                	mov    %esi,%edx
+f010466a:	ee                   	out    %al,(%dx)
+f010466b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f0104670:	89 c8                	mov    %ecx,%eax
+f0104672:	ee                   	out    %al,(%dx)
+f0104673:	89 f8                	mov    %edi,%eax
+f0104675:	89 da                	mov    %ebx,%edx
+f0104677:	ee                   	out    %al,(%dx)
+f0104678:	89 c8                	mov    %ecx,%eax
+f010467a:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f010467b:	0f b7 05 88 83 11 f0 	movzwl 0xf0118388,%eax
+f0104682:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0104686:	75 08                	jne    f0104690 <pic_init+0x98>
+}
+f0104688:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010468b:	5b                   	pop    %ebx
+f010468c:	5e                   	pop    %esi
+f010468d:	5f                   	pop    %edi
+f010468e:	5d                   	pop    %ebp
+f010468f:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f0104690:	83 ec 0c             	sub    $0xc,%esp
+f0104693:	0f b7 c0             	movzwl %ax,%eax
+f0104696:	50                   	push   %eax
+f0104697:	e8 d9 fe ff ff       	call   f0104575 <irq_setmask_8259A>
+f010469c:	83 c4 10             	add    $0x10,%esp
+}
+f010469f:	eb e7                	jmp    f0104688 <pic_init+0x90>
+
+f01046a1 <irq_eoi>:
+f01046a1:	b8 20 00 00 00       	mov    $0x20,%eax
+f01046a6:	ba 20 00 00 00       	mov    $0x20,%edx
+f01046ab:	ee                   	out    %al,(%dx)
+f01046ac:	ba a0 00 00 00       	mov    $0xa0,%edx
+f01046b1:	ee                   	out    %al,(%dx)
+	//   s: specific
+	//   e: end-of-interrupt
+	// xxx: specific interrupt line
+	outb(IO_PIC1, 0x20);
+	outb(IO_PIC2, 0x20);
+}
+f01046b2:	c3                   	ret
+
+f01046b3 <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f01046b3:	55                   	push   %ebp
+f01046b4:	89 e5                	mov    %esp,%ebp
+f01046b6:	83 ec 14             	sub    $0x14,%esp
+	cputchar(ch);
+f01046b9:	ff 75 08             	push   0x8(%ebp)
+f01046bc:	e8 52 c1 ff ff       	call   f0100813 <cputchar>
+	*cnt++;
+}
+f01046c1:	83 c4 10             	add    $0x10,%esp
+f01046c4:	c9                   	leave
+f01046c5:	c3                   	ret
+
+f01046c6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f01046c6:	55                   	push   %ebp
+f01046c7:	89 e5                	mov    %esp,%ebp
+f01046c9:	83 ec 18             	sub    $0x18,%esp
+	int cnt = 0;
+f01046cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f01046d3:	ff 75 0c             	push   0xc(%ebp)
+f01046d6:	ff 75 08             	push   0x8(%ebp)
+f01046d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01046dc:	50                   	push   %eax
+f01046dd:	68 b3 46 10 f0       	push   $0xf01046b3
+f01046e2:	e8 56 2d 00 00       	call   f010743d <vprintfmt>
+	return cnt;
+}
+f01046e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01046ea:	c9                   	leave
+f01046eb:	c3                   	ret
+
+f01046ec <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f01046ec:	55                   	push   %ebp
+f01046ed:	89 e5                	mov    %esp,%ebp
+f01046ef:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f01046f2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f01046f5:	50                   	push   %eax
+f01046f6:	ff 75 08             	push   0x8(%ebp)
+f01046f9:	e8 c8 ff ff ff       	call   f01046c6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f01046fe:	c9                   	leave
+f01046ff:	c3                   	ret
+
+f0104700 <trap_init_percpu>:
+}
+
+// Initialize and load the per-CPU TSS and IDT
+void
+trap_init_percpu(void)
+{
+f0104700:	55                   	push   %ebp
+f0104701:	89 e5                	mov    %esp,%ebp
+f0104703:	57                   	push   %edi
+f0104704:	56                   	push   %esi
+f0104705:	53                   	push   %ebx
+f0104706:	83 ec 0c             	sub    $0xc,%esp
+	// get a triple fault.  If you set up an individual CPU's TSS
+	// wrong, you may not get a fault until you try to return from
+	// user space on that CPU.
+	//
+	// LAB 4: Your code here:
+	thiscpu->cpu_ts.ts_esp0 = (uintptr_t)percpu_kstacks[thiscpu->cpu_id];
+f0104709:	e8 eb 3b 00 00       	call   f01082f9 <cpunum>
+f010470e:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104714:	0f b6 98 20 00 93 f0 	movzbl -0xf6cffe0(%eax),%ebx
+f010471b:	c1 e3 0f             	shl    $0xf,%ebx
+f010471e:	81 c3 00 10 93 f0    	add    $0xf0931000,%ebx
+f0104724:	e8 d0 3b 00 00       	call   f01082f9 <cpunum>
+f0104729:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010472f:	89 98 38 00 93 f0    	mov    %ebx,-0xf6cffc8(%eax)
+	thiscpu->cpu_ts.ts_ss0 = GD_KD;
+f0104735:	e8 bf 3b 00 00       	call   f01082f9 <cpunum>
+f010473a:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104740:	66 c7 80 3c 00 93 f0 	movw   $0x10,-0xf6cffc4(%eax)
+f0104747:	10 00 
+	gdt[(GD_TSS0 >> 3) + cpunum()] = SEG16(STS_T32A, (uint32_t) &(thiscpu->cpu_ts), 
+f0104749:	e8 ab 3b 00 00       	call   f01082f9 <cpunum>
+f010474e:	8d 70 05             	lea    0x5(%eax),%esi
+f0104751:	e8 a3 3b 00 00       	call   f01082f9 <cpunum>
+f0104756:	89 c7                	mov    %eax,%edi
+f0104758:	e8 9c 3b 00 00       	call   f01082f9 <cpunum>
+f010475d:	89 c3                	mov    %eax,%ebx
+f010475f:	e8 95 3b 00 00       	call   f01082f9 <cpunum>
+f0104764:	66 c7 04 f5 20 83 11 	movw   $0x68,-0xfee7ce0(,%esi,8)
+f010476b:	f0 68 00 
+f010476e:	69 ff d0 00 00 00    	imul   $0xd0,%edi,%edi
+f0104774:	81 c7 34 00 93 f0    	add    $0xf0930034,%edi
+f010477a:	66 89 3c f5 22 83 11 	mov    %di,-0xfee7cde(,%esi,8)
+f0104781:	f0 
+f0104782:	69 db d0 00 00 00    	imul   $0xd0,%ebx,%ebx
+f0104788:	81 c3 34 00 93 f0    	add    $0xf0930034,%ebx
+f010478e:	c1 eb 10             	shr    $0x10,%ebx
+f0104791:	88 1c f5 24 83 11 f0 	mov    %bl,-0xfee7cdc(,%esi,8)
+f0104798:	c6 04 f5 25 83 11 f0 	movb   $0x99,-0xfee7cdb(,%esi,8)
+f010479f:	99 
+f01047a0:	c6 04 f5 26 83 11 f0 	movb   $0x40,-0xfee7cda(,%esi,8)
+f01047a7:	40 
+f01047a8:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01047ae:	05 34 00 93 f0       	add    $0xf0930034,%eax
+f01047b3:	c1 e8 18             	shr    $0x18,%eax
+f01047b6:	88 04 f5 27 83 11 f0 	mov    %al,-0xfee7cd9(,%esi,8)
+										sizeof(struct Taskstate), 0);
+	gdt[(GD_TSS0 >> 3) + cpunum()].sd_s = 0;
+f01047bd:	e8 37 3b 00 00       	call   f01082f9 <cpunum>
+f01047c2:	80 24 c5 4d 83 11 f0 	andb   $0xef,-0xfee7cb3(,%eax,8)
+f01047c9:	ef 
+	ltr(GD_TSS0 + (cpunum() << 3));
+f01047ca:	e8 2a 3b 00 00       	call   f01082f9 <cpunum>
+f01047cf:	8d 04 c5 28 00 00 00 	lea    0x28(,%eax,8),%eax
+	__asm __volatile("ltr %0" : : "r" (sel));
+f01047d6:	0f 00 d8             	ltr    %ax
+	__asm __volatile("lidt (%0)" : : "r" (p));
+f01047d9:	b8 8c 83 11 f0       	mov    $0xf011838c,%eax
+f01047de:	0f 01 18             	lidtl  (%eax)
+	ltr(GD_TSS0);
+
+	// Load the IDT
+	lidt(&idt_pd);
+	*/
+}
+f01047e1:	83 c4 0c             	add    $0xc,%esp
+f01047e4:	5b                   	pop    %ebx
+f01047e5:	5e                   	pop    %esi
+f01047e6:	5f                   	pop    %edi
+f01047e7:	5d                   	pop    %ebp
+f01047e8:	c3                   	ret
+
+f01047e9 <trap_init>:
+{
+f01047e9:	55                   	push   %ebp
+f01047ea:	89 e5                	mov    %esp,%ebp
+f01047ec:	83 ec 08             	sub    $0x8,%esp
+	for(i = 0; i < 256; i++)
+f01047ef:	b8 00 00 00 00       	mov    $0x0,%eax
+		SETGATE(idt[i], 0, GD_KT, vectors[i], 0);
+f01047f4:	8b 14 85 92 83 11 f0 	mov    -0xfee7c6e(,%eax,4),%edx
+f01047fb:	66 89 14 c5 60 c2 92 	mov    %dx,-0xf6d3da0(,%eax,8)
+f0104802:	f0 
+f0104803:	66 c7 04 c5 62 c2 92 	movw   $0x8,-0xf6d3d9e(,%eax,8)
+f010480a:	f0 08 00 
+f010480d:	c6 04 c5 64 c2 92 f0 	movb   $0x0,-0xf6d3d9c(,%eax,8)
+f0104814:	00 
+f0104815:	c6 04 c5 65 c2 92 f0 	movb   $0x8e,-0xf6d3d9b(,%eax,8)
+f010481c:	8e 
+f010481d:	c1 ea 10             	shr    $0x10,%edx
+f0104820:	66 89 14 c5 66 c2 92 	mov    %dx,-0xf6d3d9a(,%eax,8)
+f0104827:	f0 
+	for(i = 0; i < 256; i++)
+f0104828:	83 c0 01             	add    $0x1,%eax
+f010482b:	3d 00 01 00 00       	cmp    $0x100,%eax
+f0104830:	75 c2                	jne    f01047f4 <trap_init+0xb>
+	SETGATE(idt[T_BRKPT], 0, GD_KT, vectors[T_BRKPT], 3);
+f0104832:	a1 9e 83 11 f0       	mov    0xf011839e,%eax
+f0104837:	66 a3 78 c2 92 f0    	mov    %ax,0xf092c278
+f010483d:	66 c7 05 7a c2 92 f0 	movw   $0x8,0xf092c27a
+f0104844:	08 00 
+f0104846:	c6 05 7c c2 92 f0 00 	movb   $0x0,0xf092c27c
+f010484d:	c6 05 7d c2 92 f0 ee 	movb   $0xee,0xf092c27d
+f0104854:	c1 e8 10             	shr    $0x10,%eax
+f0104857:	66 a3 7e c2 92 f0    	mov    %ax,0xf092c27e
+	SETGATE(idt[T_SYSCALL], 0, GD_KT, vectors[T_SYSCALL], 3)
+f010485d:	a1 52 84 11 f0       	mov    0xf0118452,%eax
+f0104862:	66 a3 e0 c3 92 f0    	mov    %ax,0xf092c3e0
+f0104868:	66 c7 05 e2 c3 92 f0 	movw   $0x8,0xf092c3e2
+f010486f:	08 00 
+f0104871:	c6 05 e4 c3 92 f0 00 	movb   $0x0,0xf092c3e4
+f0104878:	c6 05 e5 c3 92 f0 ee 	movb   $0xee,0xf092c3e5
+f010487f:	c1 e8 10             	shr    $0x10,%eax
+f0104882:	66 a3 e6 c3 92 f0    	mov    %ax,0xf092c3e6
+	SETGATE(idt[entry], 0, GD_KT, vectors[entry], 0); 
+f0104888:	a1 12 84 11 f0       	mov    0xf0118412,%eax
+f010488d:	66 a3 60 c3 92 f0    	mov    %ax,0xf092c360
+f0104893:	66 c7 05 62 c3 92 f0 	movw   $0x8,0xf092c362
+f010489a:	08 00 
+f010489c:	c6 05 64 c3 92 f0 00 	movb   $0x0,0xf092c364
+f01048a3:	c6 05 65 c3 92 f0 8e 	movb   $0x8e,0xf092c365
+f01048aa:	c1 e8 10             	shr    $0x10,%eax
+f01048ad:	66 a3 66 c3 92 f0    	mov    %ax,0xf092c366
+	SETGATE(idt[entry], 0, GD_KT, vectors[entry], 0); 
+f01048b3:	a1 16 84 11 f0       	mov    0xf0118416,%eax
+f01048b8:	66 a3 68 c3 92 f0    	mov    %ax,0xf092c368
+f01048be:	66 c7 05 6a c3 92 f0 	movw   $0x8,0xf092c36a
+f01048c5:	08 00 
+f01048c7:	c6 05 6c c3 92 f0 00 	movb   $0x0,0xf092c36c
+f01048ce:	c6 05 6d c3 92 f0 8e 	movb   $0x8e,0xf092c36d
+f01048d5:	c1 e8 10             	shr    $0x10,%eax
+f01048d8:	66 a3 6e c3 92 f0    	mov    %ax,0xf092c36e
+	SETGATE(idt[entry], 0, GD_KT, vectors[entry], 0); 
+f01048de:	a1 22 84 11 f0       	mov    0xf0118422,%eax
+f01048e3:	66 a3 80 c3 92 f0    	mov    %ax,0xf092c380
+f01048e9:	66 c7 05 82 c3 92 f0 	movw   $0x8,0xf092c382
+f01048f0:	08 00 
+f01048f2:	c6 05 84 c3 92 f0 00 	movb   $0x0,0xf092c384
+f01048f9:	c6 05 85 c3 92 f0 8e 	movb   $0x8e,0xf092c385
+f0104900:	c1 e8 10             	shr    $0x10,%eax
+f0104903:	66 a3 86 c3 92 f0    	mov    %ax,0xf092c386
+	SETGATE(idt[entry], 0, GD_KT, vectors[entry], 0); 
+f0104909:	a1 2e 84 11 f0       	mov    0xf011842e,%eax
+f010490e:	66 a3 98 c3 92 f0    	mov    %ax,0xf092c398
+f0104914:	66 c7 05 9a c3 92 f0 	movw   $0x8,0xf092c39a
+f010491b:	08 00 
+f010491d:	c6 05 9c c3 92 f0 00 	movb   $0x0,0xf092c39c
+f0104924:	c6 05 9d c3 92 f0 8e 	movb   $0x8e,0xf092c39d
+f010492b:	c1 e8 10             	shr    $0x10,%eax
+f010492e:	66 a3 9e c3 92 f0    	mov    %ax,0xf092c39e
+	SETGATE(idt[entry], 0, GD_KT, vectors[entry], 0); 
+f0104934:	a1 4a 84 11 f0       	mov    0xf011844a,%eax
+f0104939:	66 a3 d0 c3 92 f0    	mov    %ax,0xf092c3d0
+f010493f:	66 c7 05 d2 c3 92 f0 	movw   $0x8,0xf092c3d2
+f0104946:	08 00 
+f0104948:	c6 05 d4 c3 92 f0 00 	movb   $0x0,0xf092c3d4
+f010494f:	c6 05 d5 c3 92 f0 8e 	movb   $0x8e,0xf092c3d5
+f0104956:	c1 e8 10             	shr    $0x10,%eax
+f0104959:	66 a3 d6 c3 92 f0    	mov    %ax,0xf092c3d6
+	SETGATE(idt[entry], 0, GD_KT, vectors[entry], 0); 
+f010495f:	a1 5e 84 11 f0       	mov    0xf011845e,%eax
+f0104964:	66 a3 f8 c3 92 f0    	mov    %ax,0xf092c3f8
+f010496a:	66 c7 05 fa c3 92 f0 	movw   $0x8,0xf092c3fa
+f0104971:	08 00 
+f0104973:	c6 05 fc c3 92 f0 00 	movb   $0x0,0xf092c3fc
+f010497a:	c6 05 fd c3 92 f0 8e 	movb   $0x8e,0xf092c3fd
+f0104981:	c1 e8 10             	shr    $0x10,%eax
+f0104984:	66 a3 fe c3 92 f0    	mov    %ax,0xf092c3fe
+	trap_init_percpu();
+f010498a:	e8 71 fd ff ff       	call   f0104700 <trap_init_percpu>
+}
+f010498f:	c9                   	leave
+f0104990:	c3                   	ret
+
+f0104991 <print_regs>:
+	}
+}
+
+void
+print_regs(struct PushRegs *regs)
+{
+f0104991:	55                   	push   %ebp
+f0104992:	89 e5                	mov    %esp,%ebp
+f0104994:	53                   	push   %ebx
+f0104995:	83 ec 0c             	sub    $0xc,%esp
+f0104998:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+f010499b:	ff 33                	push   (%ebx)
+f010499d:	68 df c3 10 f0       	push   $0xf010c3df
+f01049a2:	e8 45 fd ff ff       	call   f01046ec <cprintf>
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+f01049a7:	83 c4 08             	add    $0x8,%esp
+f01049aa:	ff 73 04             	push   0x4(%ebx)
+f01049ad:	68 ee c3 10 f0       	push   $0xf010c3ee
+f01049b2:	e8 35 fd ff ff       	call   f01046ec <cprintf>
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f01049b7:	83 c4 08             	add    $0x8,%esp
+f01049ba:	ff 73 08             	push   0x8(%ebx)
+f01049bd:	68 fd c3 10 f0       	push   $0xf010c3fd
+f01049c2:	e8 25 fd ff ff       	call   f01046ec <cprintf>
+	cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f01049c7:	83 c4 08             	add    $0x8,%esp
+f01049ca:	ff 73 0c             	push   0xc(%ebx)
+f01049cd:	68 0c c4 10 f0       	push   $0xf010c40c
+f01049d2:	e8 15 fd ff ff       	call   f01046ec <cprintf>
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f01049d7:	83 c4 08             	add    $0x8,%esp
+f01049da:	ff 73 10             	push   0x10(%ebx)
+f01049dd:	68 1b c4 10 f0       	push   $0xf010c41b
+f01049e2:	e8 05 fd ff ff       	call   f01046ec <cprintf>
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+f01049e7:	83 c4 08             	add    $0x8,%esp
+f01049ea:	ff 73 14             	push   0x14(%ebx)
+f01049ed:	68 2a c4 10 f0       	push   $0xf010c42a
+f01049f2:	e8 f5 fc ff ff       	call   f01046ec <cprintf>
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f01049f7:	83 c4 08             	add    $0x8,%esp
+f01049fa:	ff 73 18             	push   0x18(%ebx)
+f01049fd:	68 39 c4 10 f0       	push   $0xf010c439
+f0104a02:	e8 e5 fc ff ff       	call   f01046ec <cprintf>
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+f0104a07:	83 c4 08             	add    $0x8,%esp
+f0104a0a:	ff 73 1c             	push   0x1c(%ebx)
+f0104a0d:	68 48 c4 10 f0       	push   $0xf010c448
+f0104a12:	e8 d5 fc ff ff       	call   f01046ec <cprintf>
+}
+f0104a17:	83 c4 10             	add    $0x10,%esp
+f0104a1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104a1d:	c9                   	leave
+f0104a1e:	c3                   	ret
+
+f0104a1f <print_trapframe>:
+{
+f0104a1f:	55                   	push   %ebp
+f0104a20:	89 e5                	mov    %esp,%ebp
+f0104a22:	56                   	push   %esi
+f0104a23:	53                   	push   %ebx
+f0104a24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f0104a27:	e8 cd 38 00 00       	call   f01082f9 <cpunum>
+f0104a2c:	83 ec 04             	sub    $0x4,%esp
+f0104a2f:	50                   	push   %eax
+f0104a30:	53                   	push   %ebx
+f0104a31:	68 ac c4 10 f0       	push   $0xf010c4ac
+f0104a36:	e8 b1 fc ff ff       	call   f01046ec <cprintf>
+	print_regs(&tf->tf_regs);
+f0104a3b:	89 1c 24             	mov    %ebx,(%esp)
+f0104a3e:	e8 4e ff ff ff       	call   f0104991 <print_regs>
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+f0104a43:	83 c4 08             	add    $0x8,%esp
+f0104a46:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f0104a4a:	50                   	push   %eax
+f0104a4b:	68 ca c4 10 f0       	push   $0xf010c4ca
+f0104a50:	e8 97 fc ff ff       	call   f01046ec <cprintf>
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f0104a55:	83 c4 08             	add    $0x8,%esp
+f0104a58:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f0104a5c:	50                   	push   %eax
+f0104a5d:	68 dd c4 10 f0       	push   $0xf010c4dd
+f0104a62:	e8 85 fc ff ff       	call   f01046ec <cprintf>
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104a67:	8b 43 28             	mov    0x28(%ebx),%eax
+	if (trapno < sizeof(excnames)/sizeof(excnames[0]))
+f0104a6a:	83 c4 10             	add    $0x10,%esp
+f0104a6d:	83 f8 13             	cmp    $0x13,%eax
+f0104a70:	0f 86 da 00 00 00    	jbe    f0104b50 <print_trapframe+0x131>
+		return "System call";
+f0104a76:	ba 57 c4 10 f0       	mov    $0xf010c457,%edx
+	if (trapno == T_SYSCALL)
+f0104a7b:	83 f8 30             	cmp    $0x30,%eax
+f0104a7e:	74 13                	je     f0104a93 <print_trapframe+0x74>
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f0104a80:	8d 50 e0             	lea    -0x20(%eax),%edx
+	return "(unknown trap)";
+f0104a83:	83 fa 10             	cmp    $0x10,%edx
+f0104a86:	ba 72 c4 10 f0       	mov    $0xf010c472,%edx
+f0104a8b:	b9 63 c4 10 f0       	mov    $0xf010c463,%ecx
+f0104a90:	0f 43 d1             	cmovae %ecx,%edx
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104a93:	83 ec 04             	sub    $0x4,%esp
+f0104a96:	52                   	push   %edx
+f0104a97:	50                   	push   %eax
+f0104a98:	68 f0 c4 10 f0       	push   $0xf010c4f0
+f0104a9d:	e8 4a fc ff ff       	call   f01046ec <cprintf>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104aa2:	83 c4 10             	add    $0x10,%esp
+f0104aa5:	39 1d 60 ca 92 f0    	cmp    %ebx,0xf092ca60
+f0104aab:	0f 84 ab 00 00 00    	je     f0104b5c <print_trapframe+0x13d>
+	cprintf("  err  0x%08x", tf->tf_err);
+f0104ab1:	83 ec 08             	sub    $0x8,%esp
+f0104ab4:	ff 73 2c             	push   0x2c(%ebx)
+f0104ab7:	68 11 c5 10 f0       	push   $0xf010c511
+f0104abc:	e8 2b fc ff ff       	call   f01046ec <cprintf>
+	if (tf->tf_trapno == T_PGFLT)
+f0104ac1:	83 c4 10             	add    $0x10,%esp
+f0104ac4:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104ac8:	0f 85 b1 00 00 00    	jne    f0104b7f <print_trapframe+0x160>
+			tf->tf_err & 1 ? "protection" : "not-present");
+f0104ace:	8b 43 2c             	mov    0x2c(%ebx),%eax
+		cprintf(" [%s, %s, %s]\n",
+f0104ad1:	a8 01                	test   $0x1,%al
+f0104ad3:	b9 90 c4 10 f0       	mov    $0xf010c490,%ecx
+f0104ad8:	ba 85 c4 10 f0       	mov    $0xf010c485,%edx
+f0104add:	0f 45 ca             	cmovne %edx,%ecx
+f0104ae0:	a8 02                	test   $0x2,%al
+f0104ae2:	ba a2 c4 10 f0       	mov    $0xf010c4a2,%edx
+f0104ae7:	be 9c c4 10 f0       	mov    $0xf010c49c,%esi
+f0104aec:	0f 45 d6             	cmovne %esi,%edx
+f0104aef:	a8 04                	test   $0x4,%al
+f0104af1:	b8 f1 c5 10 f0       	mov    $0xf010c5f1,%eax
+f0104af6:	be a7 c4 10 f0       	mov    $0xf010c4a7,%esi
+f0104afb:	0f 45 c6             	cmovne %esi,%eax
+f0104afe:	51                   	push   %ecx
+f0104aff:	52                   	push   %edx
+f0104b00:	50                   	push   %eax
+f0104b01:	68 1f c5 10 f0       	push   $0xf010c51f
+f0104b06:	e8 e1 fb ff ff       	call   f01046ec <cprintf>
+f0104b0b:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+f0104b0e:	83 ec 08             	sub    $0x8,%esp
+f0104b11:	ff 73 30             	push   0x30(%ebx)
+f0104b14:	68 2e c5 10 f0       	push   $0xf010c52e
+f0104b19:	e8 ce fb ff ff       	call   f01046ec <cprintf>
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f0104b1e:	83 c4 08             	add    $0x8,%esp
+f0104b21:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0104b25:	50                   	push   %eax
+f0104b26:	68 3d c5 10 f0       	push   $0xf010c53d
+f0104b2b:	e8 bc fb ff ff       	call   f01046ec <cprintf>
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f0104b30:	83 c4 08             	add    $0x8,%esp
+f0104b33:	ff 73 38             	push   0x38(%ebx)
+f0104b36:	68 50 c5 10 f0       	push   $0xf010c550
+f0104b3b:	e8 ac fb ff ff       	call   f01046ec <cprintf>
+	if ((tf->tf_cs & 3) != 0) {
+f0104b40:	83 c4 10             	add    $0x10,%esp
+f0104b43:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0104b47:	75 4b                	jne    f0104b94 <print_trapframe+0x175>
+}
+f0104b49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104b4c:	5b                   	pop    %ebx
+f0104b4d:	5e                   	pop    %esi
+f0104b4e:	5d                   	pop    %ebp
+f0104b4f:	c3                   	ret
+		return excnames[trapno];
+f0104b50:	8b 14 85 a0 c7 10 f0 	mov    -0xfef3860(,%eax,4),%edx
+f0104b57:	e9 37 ff ff ff       	jmp    f0104a93 <print_trapframe+0x74>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104b5c:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104b60:	0f 85 4b ff ff ff    	jne    f0104ab1 <print_trapframe+0x92>
+	__asm __volatile("movl %%cr2,%0" : "=r" (val));
+f0104b66:	0f 20 d0             	mov    %cr2,%eax
+		cprintf("  cr2  0x%08x\n", rcr2());
+f0104b69:	83 ec 08             	sub    $0x8,%esp
+f0104b6c:	50                   	push   %eax
+f0104b6d:	68 02 c5 10 f0       	push   $0xf010c502
+f0104b72:	e8 75 fb ff ff       	call   f01046ec <cprintf>
+f0104b77:	83 c4 10             	add    $0x10,%esp
+f0104b7a:	e9 32 ff ff ff       	jmp    f0104ab1 <print_trapframe+0x92>
+		cprintf("\n");
+f0104b7f:	83 ec 0c             	sub    $0xc,%esp
+f0104b82:	68 8b bb 10 f0       	push   $0xf010bb8b
+f0104b87:	e8 60 fb ff ff       	call   f01046ec <cprintf>
+f0104b8c:	83 c4 10             	add    $0x10,%esp
+f0104b8f:	e9 7a ff ff ff       	jmp    f0104b0e <print_trapframe+0xef>
+		cprintf("  esp  0x%08x\n", tf->tf_esp);
+f0104b94:	83 ec 08             	sub    $0x8,%esp
+f0104b97:	ff 73 3c             	push   0x3c(%ebx)
+f0104b9a:	68 5f c5 10 f0       	push   $0xf010c55f
+f0104b9f:	e8 48 fb ff ff       	call   f01046ec <cprintf>
+		cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f0104ba4:	83 c4 08             	add    $0x8,%esp
+f0104ba7:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f0104bab:	50                   	push   %eax
+f0104bac:	68 6e c5 10 f0       	push   $0xf010c56e
+f0104bb1:	e8 36 fb ff ff       	call   f01046ec <cprintf>
+f0104bb6:	83 c4 10             	add    $0x10,%esp
+}
+f0104bb9:	eb 8e                	jmp    f0104b49 <print_trapframe+0x12a>
+
+f0104bbb <page_fault_handler>:
+}
+
+
+void
+page_fault_handler(struct Trapframe *tf)
+{
+f0104bbb:	55                   	push   %ebp
+f0104bbc:	89 e5                	mov    %esp,%ebp
+f0104bbe:	57                   	push   %edi
+f0104bbf:	56                   	push   %esi
+f0104bc0:	53                   	push   %ebx
+f0104bc1:	83 ec 1c             	sub    $0x1c,%esp
+f0104bc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104bc7:	0f 20 d0             	mov    %cr2,%eax
+f0104bca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	// Handle kernel-mode page faults.
+
+	// LAB 3: Your code here.
+	int perm = 0;
+	if((tf->tf_cs & 3) == 0) {
+f0104bcd:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0104bd1:	66 83 e0 03          	and    $0x3,%ax
+f0104bd5:	0f 84 8a 00 00 00    	je     f0104c65 <page_fault_handler+0xaa>
+		panic("page fault happens in kernel mode");
+	}
+	assert((tf->tf_cs & 3) == 3);
+f0104bdb:	66 83 f8 03          	cmp    $0x3,%ax
+f0104bdf:	0f 85 97 00 00 00    	jne    f0104c7c <page_fault_handler+0xc1>
+	//   (the 'tf' variable points at 'curenv->env_tf').
+
+	// LAB 4: Your code here.
+	// Envs sharing an address space (see sys_exofork_shared) each have
+	// an exception stack of their own, ending at env_uxstacktop.
+	uintptr_t esp, xtop = curenv->env_uxstacktop;
+f0104be5:	e8 0f 37 00 00       	call   f01082f9 <cpunum>
+f0104bea:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104bf0:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104bf6:	8b 70 7c             	mov    0x7c(%eax),%esi
+	if(curenv->env_pgfault_upcall) {
+f0104bf9:	e8 fb 36 00 00       	call   f01082f9 <cpunum>
+f0104bfe:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104c04:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104c0a:	83 78 78 00          	cmpl   $0x0,0x78(%eax)
+f0104c0e:	0f 85 81 00 00 00    	jne    f0104c95 <page_fault_handler+0xda>
+		tf->tf_eip = (uintptr_t)(curenv->env_pgfault_upcall);
+		env_run(curenv);
+	}
+
+	// Destroy the environment that caused the fault.
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104c14:	8b 73 30             	mov    0x30(%ebx),%esi
+		curenv->env_id, fault_va, tf->tf_eip);
+f0104c17:	e8 dd 36 00 00       	call   f01082f9 <cpunum>
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104c1c:	56                   	push   %esi
+f0104c1d:	ff 75 e4             	push   -0x1c(%ebp)
+		curenv->env_id, fault_va, tf->tf_eip);
+f0104c20:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104c26:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104c2c:	ff 70 48             	push   0x48(%eax)
+f0104c2f:	68 60 c7 10 f0       	push   $0xf010c760
+f0104c34:	e8 b3 fa ff ff       	call   f01046ec <cprintf>
+	print_trapframe(tf);
+f0104c39:	89 1c 24             	mov    %ebx,(%esp)
+f0104c3c:	e8 de fd ff ff       	call   f0104a1f <print_trapframe>
+	env_destroy(curenv);
+f0104c41:	e8 b3 36 00 00       	call   f01082f9 <cpunum>
+f0104c46:	83 c4 04             	add    $0x4,%esp
+f0104c49:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104c4f:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0104c55:	e8 f0 f6 ff ff       	call   f010434a <env_destroy>
+}
+f0104c5a:	83 c4 10             	add    $0x10,%esp
+f0104c5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104c60:	5b                   	pop    %ebx
+f0104c61:	5e                   	pop    %esi
+f0104c62:	5f                   	pop    %edi
+f0104c63:	5d                   	pop    %ebp
+f0104c64:	c3                   	ret
+		panic("page fault happens in kernel mode");
+f0104c65:	83 ec 04             	sub    $0x4,%esp
+f0104c68:	68 3c c7 10 f0       	push   $0xf010c73c
+f0104c6d:	68 65 01 00 00       	push   $0x165
+f0104c72:	68 81 c5 10 f0       	push   $0xf010c581
+f0104c77:	e8 c4 b3 ff ff       	call   f0100040 <_panic>
+	assert((tf->tf_cs & 3) == 3);
+f0104c7c:	68 8d c5 10 f0       	push   $0xf010c58d
+f0104c81:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0104c86:	68 67 01 00 00       	push   $0x167
+f0104c8b:	68 81 c5 10 f0       	push   $0xf010c581
+f0104c90:	e8 ab b3 ff ff       	call   f0100040 <_panic>
+		if(tf->tf_esp >= xtop - PGSIZE && tf->tf_esp <= xtop - 1) {
+f0104c95:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0104c98:	8d 96 00 f0 ff ff    	lea    -0x1000(%esi),%edx
+f0104c9e:	39 d0                	cmp    %edx,%eax
+f0104ca0:	72 0e                	jb     f0104cb0 <page_fault_handler+0xf5>
+f0104ca2:	8d 56 ff             	lea    -0x1(%esi),%edx
+f0104ca5:	39 c2                	cmp    %eax,%edx
+f0104ca7:	72 07                	jb     f0104cb0 <page_fault_handler+0xf5>
+			esp = tf->tf_esp - 4 - sizeof(struct UTrapframe);
+f0104ca9:	83 e8 38             	sub    $0x38,%eax
+f0104cac:	89 c7                	mov    %eax,%edi
+f0104cae:	eb 05                	jmp    f0104cb5 <page_fault_handler+0xfa>
+			esp = xtop - sizeof(struct UTrapframe);
+f0104cb0:	8d 46 cc             	lea    -0x34(%esi),%eax
+f0104cb3:	89 c7                	mov    %eax,%edi
+		user_mem_assert(curenv, (void*)esp, sizeof(struct UTrapframe), PTE_P|PTE_U|PTE_W);
+f0104cb5:	e8 3f 36 00 00       	call   f01082f9 <cpunum>
+f0104cba:	6a 07                	push   $0x7
+f0104cbc:	6a 34                	push   $0x34
+f0104cbe:	57                   	push   %edi
+f0104cbf:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104cc5:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0104ccb:	e8 3d ef ff ff       	call   f0103c0d <user_mem_assert>
+		utf->utf_esp = tf->tf_esp;
+f0104cd0:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0104cd3:	89 47 30             	mov    %eax,0x30(%edi)
+		utf->utf_eflags = tf->tf_eflags;
+f0104cd6:	8b 43 38             	mov    0x38(%ebx),%eax
+f0104cd9:	89 fa                	mov    %edi,%edx
+f0104cdb:	89 47 2c             	mov    %eax,0x2c(%edi)
+		utf->utf_eip = tf->tf_eip;
+f0104cde:	8b 43 30             	mov    0x30(%ebx),%eax
+f0104ce1:	89 47 28             	mov    %eax,0x28(%edi)
+		utf->utf_regs = tf->tf_regs;
+f0104ce4:	8d 7f 08             	lea    0x8(%edi),%edi
+f0104ce7:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0104cec:	89 de                	mov    %ebx,%esi
+f0104cee:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		utf->utf_err = tf->tf_err;
+f0104cf0:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f0104cf3:	89 42 04             	mov    %eax,0x4(%edx)
+		utf->utf_fault_va = fault_va;
+f0104cf6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0104cf9:	89 02                	mov    %eax,(%edx)
+		tf->tf_esp = esp;
+f0104cfb:	89 53 3c             	mov    %edx,0x3c(%ebx)
+		tf->tf_eip = (uintptr_t)(curenv->env_pgfault_upcall);
+f0104cfe:	e8 f6 35 00 00       	call   f01082f9 <cpunum>
+f0104d03:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104d09:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104d0f:	8b 40 78             	mov    0x78(%eax),%eax
+f0104d12:	89 43 30             	mov    %eax,0x30(%ebx)
+		env_run(curenv);
+f0104d15:	e8 df 35 00 00       	call   f01082f9 <cpunum>
+f0104d1a:	83 c4 04             	add    $0x4,%esp
+f0104d1d:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104d23:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0104d29:	e8 c7 f6 ff ff       	call   f01043f5 <env_run>
+
+f0104d2e <trap>:
+{
+f0104d2e:	55                   	push   %ebp
+f0104d2f:	89 e5                	mov    %esp,%ebp
+f0104d31:	57                   	push   %edi
+f0104d32:	56                   	push   %esi
+f0104d33:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("cld" ::: "cc");
+f0104d36:	fc                   	cld
+	if (panicstr)
+f0104d37:	83 3d e0 f3 92 f0 00 	cmpl   $0x0,0xf092f3e0
+f0104d3e:	74 01                	je     f0104d41 <trap+0x13>
+		asm volatile("hlt");
+f0104d40:	f4                   	hlt
+        __asm __volatile("pushfl; popl %0" : "=r" (eflags));
+f0104d41:	9c                   	pushf
+f0104d42:	58                   	pop    %eax
+	assert(!(read_eflags() & FL_IF));
+f0104d43:	f6 c4 02             	test   $0x2,%ah
+f0104d46:	0f 85 b7 00 00 00    	jne    f0104e03 <trap+0xd5>
+	if (tf->tf_trapno == T_TLBFLUSH) {
+f0104d4c:	83 7e 28 31          	cmpl   $0x31,0x28(%esi)
+f0104d50:	0f 84 c6 00 00 00    	je     f0104e1c <trap+0xee>
+	if ((tf->tf_cs & 3) == 3) {
+f0104d56:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f0104d5a:	83 e0 03             	and    $0x3,%eax
+f0104d5d:	66 83 f8 03          	cmp    $0x3,%ax
+f0104d61:	0f 84 c8 00 00 00    	je     f0104e2f <trap+0x101>
+	last_tf = tf;
+f0104d67:	89 35 60 ca 92 f0    	mov    %esi,0xf092ca60
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_SPURIOUS) {
+f0104d6d:	8b 46 28             	mov    0x28(%esi),%eax
+f0104d70:	83 f8 27             	cmp    $0x27,%eax
+f0104d73:	0f 84 9c 01 00 00    	je     f0104f15 <trap+0x1e7>
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
+f0104d79:	83 f8 20             	cmp    $0x20,%eax
+f0104d7c:	0f 84 ad 01 00 00    	je     f0104f2f <trap+0x201>
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_KBD) {
+f0104d82:	8b 46 28             	mov    0x28(%esi),%eax
+f0104d85:	83 f8 21             	cmp    $0x21,%eax
+f0104d88:	0f 84 c8 01 00 00    	je     f0104f56 <trap+0x228>
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_SERIAL) {
+f0104d8e:	83 f8 24             	cmp    $0x24,%eax
+f0104d91:	0f 84 c6 01 00 00    	je     f0104f5d <trap+0x22f>
+	if (e1000_irq && tf->tf_trapno == IRQ_OFFSET + e1000_irq) {
+f0104d97:	0f b6 15 a4 14 97 f0 	movzbl 0xf09714a4,%edx
+f0104d9e:	84 d2                	test   %dl,%dl
+f0104da0:	74 0e                	je     f0104db0 <trap+0x82>
+f0104da2:	0f b6 d2             	movzbl %dl,%edx
+f0104da5:	83 c2 20             	add    $0x20,%edx
+f0104da8:	39 d0                	cmp    %edx,%eax
+f0104daa:	0f 84 b4 01 00 00    	je     f0104f64 <trap+0x236>
+	switch(tf->tf_trapno) {
+f0104db0:	83 f8 0e             	cmp    $0xe,%eax
+f0104db3:	0f 84 b7 01 00 00    	je     f0104f70 <trap+0x242>
+f0104db9:	83 f8 30             	cmp    $0x30,%eax
+f0104dbc:	0f 84 f8 01 00 00    	je     f0104fba <trap+0x28c>
+f0104dc2:	83 f8 03             	cmp    $0x3,%eax
+f0104dc5:	0f 84 e1 01 00 00    	je     f0104fac <trap+0x27e>
+			print_trapframe(tf);
+f0104dcb:	83 ec 0c             	sub    $0xc,%esp
+f0104dce:	56                   	push   %esi
+f0104dcf:	e8 4b fc ff ff       	call   f0104a1f <print_trapframe>
+			if (tf->tf_cs == GD_KT)
+f0104dd4:	83 c4 10             	add    $0x10,%esp
+f0104dd7:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0104ddc:	0f 84 f9 01 00 00    	je     f0104fdb <trap+0x2ad>
+				env_destroy(curenv);
+f0104de2:	e8 12 35 00 00       	call   f01082f9 <cpunum>
+f0104de7:	83 ec 0c             	sub    $0xc,%esp
+f0104dea:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104df0:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0104df6:	e8 4f f5 ff ff       	call   f010434a <env_destroy>
+				return;
+f0104dfb:	83 c4 10             	add    $0x10,%esp
+f0104dfe:	e9 79 01 00 00       	jmp    f0104f7c <trap+0x24e>
+	assert(!(read_eflags() & FL_IF));
+f0104e03:	68 a2 c5 10 f0       	push   $0xf010c5a2
+f0104e08:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0104e0d:	68 23 01 00 00       	push   $0x123
+f0104e12:	68 81 c5 10 f0       	push   $0xf010c581
+f0104e17:	e8 24 b2 ff ff       	call   f0100040 <_panic>
+		tlb_flush_pending();
+f0104e1c:	e8 bd 3a 00 00       	call   f01088de <tlb_flush_pending>
+		lapic_eoi();
+f0104e21:	e8 0e 36 00 00       	call   f0108434 <lapic_eoi>
+		env_pop_tf(tf);
+f0104e26:	83 ec 0c             	sub    $0xc,%esp
+f0104e29:	56                   	push   %esi
+f0104e2a:	e8 85 f5 ff ff       	call   f01043b4 <env_pop_tf>
+		thiscpu->cpu_tlb_locking = 1;
+f0104e2f:	e8 c5 34 00 00       	call   f01082f9 <cpunum>
+f0104e34:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104e3a:	c7 80 a0 00 93 f0 01 	movl   $0x1,-0xf6cff60(%eax)
+f0104e41:	00 00 00 
+	spin_lock(&kernel_lock);
+f0104e44:	83 ec 0c             	sub    $0xc,%esp
+f0104e47:	68 a0 87 11 f0       	push   $0xf01187a0
+f0104e4c:	e8 42 37 00 00       	call   f0108593 <spin_lock>
+		tlb_flush_pending();
+f0104e51:	e8 88 3a 00 00       	call   f01088de <tlb_flush_pending>
+		thiscpu->cpu_tlb_locking = 0;
+f0104e56:	e8 9e 34 00 00       	call   f01082f9 <cpunum>
+f0104e5b:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104e61:	c7 80 a0 00 93 f0 00 	movl   $0x0,-0xf6cff60(%eax)
+f0104e68:	00 00 00 
+		assert(curenv);
+f0104e6b:	e8 89 34 00 00       	call   f01082f9 <cpunum>
+f0104e70:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104e76:	83 c4 10             	add    $0x10,%esp
+f0104e79:	83 b8 28 00 93 f0 00 	cmpl   $0x0,-0xf6cffd8(%eax)
+f0104e80:	74 47                	je     f0104ec9 <trap+0x19b>
+		if (curenv->env_status == ENV_DYING) {
+f0104e82:	e8 72 34 00 00       	call   f01082f9 <cpunum>
+f0104e87:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104e8d:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104e93:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f0104e97:	74 49                	je     f0104ee2 <trap+0x1b4>
+		curenv->env_tf = *tf;
+f0104e99:	e8 5b 34 00 00       	call   f01082f9 <cpunum>
+f0104e9e:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104ea4:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104eaa:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0104eaf:	89 c7                	mov    %eax,%edi
+f0104eb1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		tf = &curenv->env_tf;
+f0104eb3:	e8 41 34 00 00       	call   f01082f9 <cpunum>
+f0104eb8:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104ebe:	8b b0 28 00 93 f0    	mov    -0xf6cffd8(%eax),%esi
+f0104ec4:	e9 9e fe ff ff       	jmp    f0104d67 <trap+0x39>
+		assert(curenv);
+f0104ec9:	68 bb c5 10 f0       	push   $0xf010c5bb
+f0104ece:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0104ed3:	68 36 01 00 00       	push   $0x136
+f0104ed8:	68 81 c5 10 f0       	push   $0xf010c581
+f0104edd:	e8 5e b1 ff ff       	call   f0100040 <_panic>
+			env_free(curenv);
+f0104ee2:	e8 12 34 00 00       	call   f01082f9 <cpunum>
+f0104ee7:	83 ec 0c             	sub    $0xc,%esp
+f0104eea:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104ef0:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0104ef6:	e8 f1 f2 ff ff       	call   f01041ec <env_free>
+			curenv = NULL;
+f0104efb:	e8 f9 33 00 00       	call   f01082f9 <cpunum>
+f0104f00:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104f06:	c7 80 28 00 93 f0 00 	movl   $0x0,-0xf6cffd8(%eax)
+f0104f0d:	00 00 00 
+			sched_yield();
+f0104f10:	e8 dd 0b 00 00       	call   f0105af2 <sched_yield>
+		cprintf("Spurious interrupt on irq 7\n");
+f0104f15:	83 ec 0c             	sub    $0xc,%esp
+f0104f18:	68 c2 c5 10 f0       	push   $0xf010c5c2
+f0104f1d:	e8 ca f7 ff ff       	call   f01046ec <cprintf>
+		print_trapframe(tf);
+f0104f22:	89 34 24             	mov    %esi,(%esp)
+f0104f25:	e8 f5 fa ff ff       	call   f0104a1f <print_trapframe>
+		return;
+f0104f2a:	83 c4 10             	add    $0x10,%esp
+f0104f2d:	eb 4d                	jmp    f0104f7c <trap+0x24e>
+		if (thiscpu->cpu_id == 0) {
+f0104f2f:	e8 c5 33 00 00       	call   f01082f9 <cpunum>
+f0104f34:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104f3a:	80 b8 20 00 93 f0 00 	cmpb   $0x0,-0xf6cffe0(%eax)
+f0104f41:	0f 85 3b fe ff ff    	jne    f0104d82 <trap+0x54>
+			lapic_eoi();
+f0104f47:	e8 e8 34 00 00       	call   f0108434 <lapic_eoi>
+			time_tick();
+f0104f4c:	e8 c9 5a 00 00       	call   f010aa1a <time_tick>
+			sched_yield();
+f0104f51:	e8 9c 0b 00 00       	call   f0105af2 <sched_yield>
+		kbd_intr();
+f0104f56:	e8 20 b7 ff ff       	call   f010067b <kbd_intr>
+		return;
+f0104f5b:	eb 1f                	jmp    f0104f7c <trap+0x24e>
+		serial_intr();
+f0104f5d:	e8 fd b6 ff ff       	call   f010065f <serial_intr>
+		return;
+f0104f62:	eb 18                	jmp    f0104f7c <trap+0x24e>
+		e1000_intr();
+f0104f64:	e8 22 54 00 00       	call   f010a38b <e1000_intr>
+		irq_eoi();
+f0104f69:	e8 33 f7 ff ff       	call   f01046a1 <irq_eoi>
+		return;
+f0104f6e:	eb 0c                	jmp    f0104f7c <trap+0x24e>
+			page_fault_handler(tf);
+f0104f70:	83 ec 0c             	sub    $0xc,%esp
+f0104f73:	56                   	push   %esi
+f0104f74:	e8 42 fc ff ff       	call   f0104bbb <page_fault_handler>
+			break;
+f0104f79:	83 c4 10             	add    $0x10,%esp
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f0104f7c:	e8 78 33 00 00       	call   f01082f9 <cpunum>
+f0104f81:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104f87:	83 b8 28 00 93 f0 00 	cmpl   $0x0,-0xf6cffd8(%eax)
+f0104f8e:	74 17                	je     f0104fa7 <trap+0x279>
+f0104f90:	e8 64 33 00 00       	call   f01082f9 <cpunum>
+f0104f95:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0104f9b:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0104fa1:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104fa5:	74 4b                	je     f0104ff2 <trap+0x2c4>
+		sched_yield();
+f0104fa7:	e8 46 0b 00 00       	call   f0105af2 <sched_yield>
+			monitor(tf);
+f0104fac:	83 ec 0c             	sub    $0xc,%esp
+f0104faf:	56                   	push   %esi
+f0104fb0:	e8 5b bf ff ff       	call   f0100f10 <monitor>
+			break;
+f0104fb5:	83 c4 10             	add    $0x10,%esp
+f0104fb8:	eb c2                	jmp    f0104f7c <trap+0x24e>
+			tf->tf_regs.reg_eax = syscall(tf->tf_regs.reg_eax, tf->tf_regs.reg_edx, 
+f0104fba:	83 ec 08             	sub    $0x8,%esp
+f0104fbd:	ff 76 04             	push   0x4(%esi)
+f0104fc0:	ff 36                	push   (%esi)
+f0104fc2:	ff 76 10             	push   0x10(%esi)
+f0104fc5:	ff 76 18             	push   0x18(%esi)
+f0104fc8:	ff 76 14             	push   0x14(%esi)
+f0104fcb:	ff 76 1c             	push   0x1c(%esi)
+f0104fce:	e8 0e 12 00 00       	call   f01061e1 <syscall>
+f0104fd3:	89 46 1c             	mov    %eax,0x1c(%esi)
+			break;
+f0104fd6:	83 c4 20             	add    $0x20,%esp
+f0104fd9:	eb a1                	jmp    f0104f7c <trap+0x24e>
+				panic("unhandled trap in kernel");
+f0104fdb:	83 ec 04             	sub    $0x4,%esp
+f0104fde:	68 df c5 10 f0       	push   $0xf010c5df
+f0104fe3:	68 0b 01 00 00       	push   $0x10b
+f0104fe8:	68 81 c5 10 f0       	push   $0xf010c581
+f0104fed:	e8 4e b0 ff ff       	call   f0100040 <_panic>
+		env_run(curenv);
+f0104ff2:	e8 02 33 00 00       	call   f01082f9 <cpunum>
+f0104ff7:	83 ec 0c             	sub    $0xc,%esp
+f0104ffa:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105000:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0105006:	e8 ea f3 ff ff       	call   f01043f5 <env_run>
+f010500b:	90                   	nop
+
+f010500c <vector0>:
+.text
+
+/*
+ * Lab 3: Your code here for generating entry points for the different traps.
+ */
+TRAPHANDLER_NOEC(vector0,0)
+f010500c:	6a 00                	push   $0x0
+f010500e:	6a 00                	push   $0x0
+f0105010:	e9 cc 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105015:	90                   	nop
+
+f0105016 <vector1>:
+TRAPHANDLER_NOEC(vector1,1)
+f0105016:	6a 00                	push   $0x0
+f0105018:	6a 01                	push   $0x1
+f010501a:	e9 c2 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f010501f:	90                   	nop
+
+f0105020 <vector2>:
+TRAPHANDLER_NOEC(vector2,2)
+f0105020:	6a 00                	push   $0x0
+f0105022:	6a 02                	push   $0x2
+f0105024:	e9 b8 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105029:	90                   	nop
+
+f010502a <vector3>:
+TRAPHANDLER_NOEC(vector3,3)
+f010502a:	6a 00                	push   $0x0
+f010502c:	6a 03                	push   $0x3
+f010502e:	e9 ae 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105033:	90                   	nop
+
+f0105034 <vector4>:
+TRAPHANDLER_NOEC(vector4,4)
+f0105034:	6a 00                	push   $0x0
+f0105036:	6a 04                	push   $0x4
+f0105038:	e9 a4 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f010503d:	90                   	nop
+
+f010503e <vector5>:
+TRAPHANDLER_NOEC(vector5,5)
+f010503e:	6a 00                	push   $0x0
+f0105040:	6a 05                	push   $0x5
+f0105042:	e9 9a 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105047:	90                   	nop
+
+f0105048 <vector6>:
+TRAPHANDLER_NOEC(vector6,6)
+f0105048:	6a 00                	push   $0x0
+f010504a:	6a 06                	push   $0x6
+f010504c:	e9 90 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105051:	90                   	nop
+
+f0105052 <vector7>:
+TRAPHANDLER_NOEC(vector7,7)
+f0105052:	6a 00                	push   $0x0
+f0105054:	6a 07                	push   $0x7
+f0105056:	e9 86 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f010505b:	90                   	nop
+
+f010505c <vector8>:
+TRAPHANDLER(vector8,8)
+f010505c:	6a 08                	push   $0x8
+f010505e:	e9 7e 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105063:	90                   	nop
+
+f0105064 <vector9>:
+TRAPHANDLER(vector9,9)
+f0105064:	6a 09                	push   $0x9
+f0105066:	e9 76 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f010506b:	90                   	nop
+
+f010506c <vector10>:
+TRAPHANDLER(vector10,10)
+f010506c:	6a 0a                	push   $0xa
+f010506e:	e9 6e 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105073:	90                   	nop
+
+f0105074 <vector11>:
+TRAPHANDLER(vector11,11)
+f0105074:	6a 0b                	push   $0xb
+f0105076:	e9 66 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f010507b:	90                   	nop
+
+f010507c <vector12>:
+TRAPHANDLER(vector12,12)
+f010507c:	6a 0c                	push   $0xc
+f010507e:	e9 5e 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105083:	90                   	nop
+
+f0105084 <vector13>:
+TRAPHANDLER(vector13,13)
+f0105084:	6a 0d                	push   $0xd
+f0105086:	e9 56 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f010508b:	90                   	nop
+
+f010508c <vector14>:
+TRAPHANDLER(vector14,14)
+f010508c:	6a 0e                	push   $0xe
+f010508e:	e9 4e 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f0105093:	90                   	nop
+
+f0105094 <vector15>:
+TRAPHANDLER_NOEC(vector15,15)
+f0105094:	6a 00                	push   $0x0
+f0105096:	6a 0f                	push   $0xf
+f0105098:	e9 44 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f010509d:	90                   	nop
+
+f010509e <vector16>:
+TRAPHANDLER_NOEC(vector16,16)
+f010509e:	6a 00                	push   $0x0
+f01050a0:	6a 10                	push   $0x10
+f01050a2:	e9 3a 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f01050a7:	90                   	nop
+
+f01050a8 <vector17>:
+TRAPHANDLER(vector17,17)
+f01050a8:	6a 11                	push   $0x11
+f01050aa:	e9 32 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f01050af:	90                   	nop
+
+f01050b0 <vector18>:
+TRAPHANDLER_NOEC(vector18,18)
+f01050b0:	6a 00                	push   $0x0
+f01050b2:	6a 12                	push   $0x12
+f01050b4:	e9 28 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f01050b9:	90                   	nop
+
+f01050ba <vector19>:
+TRAPHANDLER_NOEC(vector19,19)
+f01050ba:	6a 00                	push   $0x0
+f01050bc:	6a 13                	push   $0x13
+f01050be:	e9 1e 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f01050c3:	90                   	nop
+
+f01050c4 <vector20>:
+TRAPHANDLER_NOEC(vector20,20)
+f01050c4:	6a 00                	push   $0x0
+f01050c6:	6a 14                	push   $0x14
+f01050c8:	e9 14 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f01050cd:	90                   	nop
+
+f01050ce <vector21>:
+TRAPHANDLER_NOEC(vector21,21)
+f01050ce:	6a 00                	push   $0x0
+f01050d0:	6a 15                	push   $0x15
+f01050d2:	e9 0a 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f01050d7:	90                   	nop
+
+f01050d8 <vector22>:
+TRAPHANDLER_NOEC(vector22,22)
+f01050d8:	6a 00                	push   $0x0
+f01050da:	6a 16                	push   $0x16
+f01050dc:	e9 00 0a 00 00       	jmp    f0105ae1 <_alltraps>
+f01050e1:	90                   	nop
+
+f01050e2 <vector23>:
+TRAPHANDLER_NOEC(vector23,23)
+f01050e2:	6a 00                	push   $0x0
+f01050e4:	6a 17                	push   $0x17
+f01050e6:	e9 f6 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01050eb:	90                   	nop
+
+f01050ec <vector24>:
+TRAPHANDLER_NOEC(vector24,24)
+f01050ec:	6a 00                	push   $0x0
+f01050ee:	6a 18                	push   $0x18
+f01050f0:	e9 ec 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01050f5:	90                   	nop
+
+f01050f6 <vector25>:
+TRAPHANDLER_NOEC(vector25,25)
+f01050f6:	6a 00                	push   $0x0
+f01050f8:	6a 19                	push   $0x19
+f01050fa:	e9 e2 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01050ff:	90                   	nop
+
+f0105100 <vector26>:
+TRAPHANDLER_NOEC(vector26,26)
+f0105100:	6a 00                	push   $0x0
+f0105102:	6a 1a                	push   $0x1a
+f0105104:	e9 d8 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105109:	90                   	nop
+
+f010510a <vector27>:
+TRAPHANDLER_NOEC(vector27,27)
+f010510a:	6a 00                	push   $0x0
+f010510c:	6a 1b                	push   $0x1b
+f010510e:	e9 ce 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105113:	90                   	nop
+
+f0105114 <vector28>:
+TRAPHANDLER_NOEC(vector28,28)
+f0105114:	6a 00                	push   $0x0
+f0105116:	6a 1c                	push   $0x1c
+f0105118:	e9 c4 09 00 00       	jmp    f0105ae1 <_alltraps>
+f010511d:	90                   	nop
+
+f010511e <vector29>:
+TRAPHANDLER_NOEC(vector29,29)
+f010511e:	6a 00                	push   $0x0
+f0105120:	6a 1d                	push   $0x1d
+f0105122:	e9 ba 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105127:	90                   	nop
+
+f0105128 <vector30>:
+TRAPHANDLER_NOEC(vector30,30)
+f0105128:	6a 00                	push   $0x0
+f010512a:	6a 1e                	push   $0x1e
+f010512c:	e9 b0 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105131:	90                   	nop
+
+f0105132 <vector31>:
+TRAPHANDLER_NOEC(vector31,31)
+f0105132:	6a 00                	push   $0x0
+f0105134:	6a 1f                	push   $0x1f
+f0105136:	e9 a6 09 00 00       	jmp    f0105ae1 <_alltraps>
+f010513b:	90                   	nop
+
+f010513c <vector32>:
+TRAPHANDLER_NOEC(vector32,32)
+f010513c:	6a 00                	push   $0x0
+f010513e:	6a 20                	push   $0x20
+f0105140:	e9 9c 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105145:	90                   	nop
+
+f0105146 <vector33>:
+TRAPHANDLER_NOEC(vector33,33)
+f0105146:	6a 00                	push   $0x0
+f0105148:	6a 21                	push   $0x21
+f010514a:	e9 92 09 00 00       	jmp    f0105ae1 <_alltraps>
+f010514f:	90                   	nop
+
+f0105150 <vector34>:
+TRAPHANDLER_NOEC(vector34,34)
+f0105150:	6a 00                	push   $0x0
+f0105152:	6a 22                	push   $0x22
+f0105154:	e9 88 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105159:	90                   	nop
+
+f010515a <vector35>:
+TRAPHANDLER_NOEC(vector35,35)
+f010515a:	6a 00                	push   $0x0
+f010515c:	6a 23                	push   $0x23
+f010515e:	e9 7e 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105163:	90                   	nop
+
+f0105164 <vector36>:
+TRAPHANDLER_NOEC(vector36,36)
+f0105164:	6a 00                	push   $0x0
+f0105166:	6a 24                	push   $0x24
+f0105168:	e9 74 09 00 00       	jmp    f0105ae1 <_alltraps>
+f010516d:	90                   	nop
+
+f010516e <vector37>:
+TRAPHANDLER_NOEC(vector37,37)
+f010516e:	6a 00                	push   $0x0
+f0105170:	6a 25                	push   $0x25
+f0105172:	e9 6a 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105177:	90                   	nop
+
+f0105178 <vector38>:
+TRAPHANDLER_NOEC(vector38,38)
+f0105178:	6a 00                	push   $0x0
+f010517a:	6a 26                	push   $0x26
+f010517c:	e9 60 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105181:	90                   	nop
+
+f0105182 <vector39>:
+TRAPHANDLER_NOEC(vector39,39)
+f0105182:	6a 00                	push   $0x0
+f0105184:	6a 27                	push   $0x27
+f0105186:	e9 56 09 00 00       	jmp    f0105ae1 <_alltraps>
+f010518b:	90                   	nop
+
+f010518c <vector40>:
+TRAPHANDLER_NOEC(vector40,40)
+f010518c:	6a 00                	push   $0x0
+f010518e:	6a 28                	push   $0x28
+f0105190:	e9 4c 09 00 00       	jmp    f0105ae1 <_alltraps>
+f0105195:	90                   	nop
+
+f0105196 <vector41>:
+TRAPHANDLER_NOEC(vector41,41)
+f0105196:	6a 00                	push   $0x0
+f0105198:	6a 29                	push   $0x29
+f010519a:	e9 42 09 00 00       	jmp    f0105ae1 <_alltraps>
+f010519f:	90                   	nop
+
+f01051a0 <vector42>:
+TRAPHANDLER_NOEC(vector42,42)
+f01051a0:	6a 00                	push   $0x0
+f01051a2:	6a 2a                	push   $0x2a
+f01051a4:	e9 38 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01051a9:	90                   	nop
+
+f01051aa <vector43>:
+TRAPHANDLER_NOEC(vector43,43)
+f01051aa:	6a 00                	push   $0x0
+f01051ac:	6a 2b                	push   $0x2b
+f01051ae:	e9 2e 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01051b3:	90                   	nop
+
+f01051b4 <vector44>:
+TRAPHANDLER_NOEC(vector44,44)
+f01051b4:	6a 00                	push   $0x0
+f01051b6:	6a 2c                	push   $0x2c
+f01051b8:	e9 24 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01051bd:	90                   	nop
+
+f01051be <vector45>:
+TRAPHANDLER_NOEC(vector45,45)
+f01051be:	6a 00                	push   $0x0
+f01051c0:	6a 2d                	push   $0x2d
+f01051c2:	e9 1a 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01051c7:	90                   	nop
+
+f01051c8 <vector46>:
+TRAPHANDLER_NOEC(vector46,46)
+f01051c8:	6a 00                	push   $0x0
+f01051ca:	6a 2e                	push   $0x2e
+f01051cc:	e9 10 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01051d1:	90                   	nop
+
+f01051d2 <vector47>:
+TRAPHANDLER_NOEC(vector47,47)
+f01051d2:	6a 00                	push   $0x0
+f01051d4:	6a 2f                	push   $0x2f
+f01051d6:	e9 06 09 00 00       	jmp    f0105ae1 <_alltraps>
+f01051db:	90                   	nop
+
+f01051dc <vector48>:
+TRAPHANDLER_NOEC(vector48,48)
+f01051dc:	6a 00                	push   $0x0
+f01051de:	6a 30                	push   $0x30
+f01051e0:	e9 fc 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01051e5:	90                   	nop
+
+f01051e6 <vector49>:
+TRAPHANDLER_NOEC(vector49,49)
+f01051e6:	6a 00                	push   $0x0
+f01051e8:	6a 31                	push   $0x31
+f01051ea:	e9 f2 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01051ef:	90                   	nop
+
+f01051f0 <vector50>:
+TRAPHANDLER_NOEC(vector50,50)
+f01051f0:	6a 00                	push   $0x0
+f01051f2:	6a 32                	push   $0x32
+f01051f4:	e9 e8 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01051f9:	90                   	nop
+
+f01051fa <vector51>:
+TRAPHANDLER_NOEC(vector51,51)
+f01051fa:	6a 00                	push   $0x0
+f01051fc:	6a 33                	push   $0x33
+f01051fe:	e9 de 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105203:	90                   	nop
+
+f0105204 <vector52>:
+TRAPHANDLER_NOEC(vector52,52)
+f0105204:	6a 00                	push   $0x0
+f0105206:	6a 34                	push   $0x34
+f0105208:	e9 d4 08 00 00       	jmp    f0105ae1 <_alltraps>
+f010520d:	90                   	nop
+
+f010520e <vector53>:
+TRAPHANDLER_NOEC(vector53,53)
+f010520e:	6a 00                	push   $0x0
+f0105210:	6a 35                	push   $0x35
+f0105212:	e9 ca 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105217:	90                   	nop
+
+f0105218 <vector54>:
+TRAPHANDLER_NOEC(vector54,54)
+f0105218:	6a 00                	push   $0x0
+f010521a:	6a 36                	push   $0x36
+f010521c:	e9 c0 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105221:	90                   	nop
+
+f0105222 <vector55>:
+TRAPHANDLER_NOEC(vector55,55)
+f0105222:	6a 00                	push   $0x0
+f0105224:	6a 37                	push   $0x37
+f0105226:	e9 b6 08 00 00       	jmp    f0105ae1 <_alltraps>
+f010522b:	90                   	nop
+
+f010522c <vector56>:
+TRAPHANDLER_NOEC(vector56,56)
+f010522c:	6a 00                	push   $0x0
+f010522e:	6a 38                	push   $0x38
+f0105230:	e9 ac 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105235:	90                   	nop
+
+f0105236 <vector57>:
+TRAPHANDLER_NOEC(vector57,57)
+f0105236:	6a 00                	push   $0x0
+f0105238:	6a 39                	push   $0x39
+f010523a:	e9 a2 08 00 00       	jmp    f0105ae1 <_alltraps>
+f010523f:	90                   	nop
+
+f0105240 <vector58>:
+TRAPHANDLER_NOEC(vector58,58)
+f0105240:	6a 00                	push   $0x0
+f0105242:	6a 3a                	push   $0x3a
+f0105244:	e9 98 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105249:	90                   	nop
+
+f010524a <vector59>:
+TRAPHANDLER_NOEC(vector59,59)
+f010524a:	6a 00                	push   $0x0
+f010524c:	6a 3b                	push   $0x3b
+f010524e:	e9 8e 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105253:	90                   	nop
+
+f0105254 <vector60>:
+TRAPHANDLER_NOEC(vector60,60)
+f0105254:	6a 00                	push   $0x0
+f0105256:	6a 3c                	push   $0x3c
+f0105258:	e9 84 08 00 00       	jmp    f0105ae1 <_alltraps>
+f010525d:	90                   	nop
+
+f010525e <vector61>:
+TRAPHANDLER_NOEC(vector61,61)
+f010525e:	6a 00                	push   $0x0
+f0105260:	6a 3d                	push   $0x3d
+f0105262:	e9 7a 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105267:	90                   	nop
+
+f0105268 <vector62>:
+TRAPHANDLER_NOEC(vector62,62)
+f0105268:	6a 00                	push   $0x0
+f010526a:	6a 3e                	push   $0x3e
+f010526c:	e9 70 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105271:	90                   	nop
+
+f0105272 <vector63>:
+TRAPHANDLER_NOEC(vector63,63)
+f0105272:	6a 00                	push   $0x0
+f0105274:	6a 3f                	push   $0x3f
+f0105276:	e9 66 08 00 00       	jmp    f0105ae1 <_alltraps>
+f010527b:	90                   	nop
+
+f010527c <vector64>:
+TRAPHANDLER_NOEC(vector64,64)
+f010527c:	6a 00                	push   $0x0
+f010527e:	6a 40                	push   $0x40
+f0105280:	e9 5c 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105285:	90                   	nop
+
+f0105286 <vector65>:
+TRAPHANDLER_NOEC(vector65,65)
+f0105286:	6a 00                	push   $0x0
+f0105288:	6a 41                	push   $0x41
+f010528a:	e9 52 08 00 00       	jmp    f0105ae1 <_alltraps>
+f010528f:	90                   	nop
+
+f0105290 <vector66>:
+TRAPHANDLER_NOEC(vector66,66)
+f0105290:	6a 00                	push   $0x0
+f0105292:	6a 42                	push   $0x42
+f0105294:	e9 48 08 00 00       	jmp    f0105ae1 <_alltraps>
+f0105299:	90                   	nop
+
+f010529a <vector67>:
+TRAPHANDLER_NOEC(vector67,67)
+f010529a:	6a 00                	push   $0x0
+f010529c:	6a 43                	push   $0x43
+f010529e:	e9 3e 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01052a3:	90                   	nop
+
+f01052a4 <vector68>:
+TRAPHANDLER_NOEC(vector68,68)
+f01052a4:	6a 00                	push   $0x0
+f01052a6:	6a 44                	push   $0x44
+f01052a8:	e9 34 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01052ad:	90                   	nop
+
+f01052ae <vector69>:
+TRAPHANDLER_NOEC(vector69,69)
+f01052ae:	6a 00                	push   $0x0
+f01052b0:	6a 45                	push   $0x45
+f01052b2:	e9 2a 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01052b7:	90                   	nop
+
+f01052b8 <vector70>:
+TRAPHANDLER_NOEC(vector70,70)
+f01052b8:	6a 00                	push   $0x0
+f01052ba:	6a 46                	push   $0x46
+f01052bc:	e9 20 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01052c1:	90                   	nop
+
+f01052c2 <vector71>:
+TRAPHANDLER_NOEC(vector71,71)
+f01052c2:	6a 00                	push   $0x0
+f01052c4:	6a 47                	push   $0x47
+f01052c6:	e9 16 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01052cb:	90                   	nop
+
+f01052cc <vector72>:
+TRAPHANDLER_NOEC(vector72,72)
+f01052cc:	6a 00                	push   $0x0
+f01052ce:	6a 48                	push   $0x48
+f01052d0:	e9 0c 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01052d5:	90                   	nop
+
+f01052d6 <vector73>:
+TRAPHANDLER_NOEC(vector73,73)
+f01052d6:	6a 00                	push   $0x0
+f01052d8:	6a 49                	push   $0x49
+f01052da:	e9 02 08 00 00       	jmp    f0105ae1 <_alltraps>
+f01052df:	90                   	nop
+
+f01052e0 <vector74>:
+TRAPHANDLER_NOEC(vector74,74)
+f01052e0:	6a 00                	push   $0x0
+f01052e2:	6a 4a                	push   $0x4a
+f01052e4:	e9 f8 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01052e9:	90                   	nop
+
+f01052ea <vector75>:
+TRAPHANDLER_NOEC(vector75,75)
+f01052ea:	6a 00                	push   $0x0
+f01052ec:	6a 4b                	push   $0x4b
+f01052ee:	e9 ee 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01052f3:	90                   	nop
+
+f01052f4 <vector76>:
+TRAPHANDLER_NOEC(vector76,76)
+f01052f4:	6a 00                	push   $0x0
+f01052f6:	6a 4c                	push   $0x4c
+f01052f8:	e9 e4 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01052fd:	90                   	nop
+
+f01052fe <vector77>:
+TRAPHANDLER_NOEC(vector77,77)
+f01052fe:	6a 00                	push   $0x0
+f0105300:	6a 4d                	push   $0x4d
+f0105302:	e9 da 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105307:	90                   	nop
+
+f0105308 <vector78>:
+TRAPHANDLER_NOEC(vector78,78)
+f0105308:	6a 00                	push   $0x0
+f010530a:	6a 4e                	push   $0x4e
+f010530c:	e9 d0 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105311:	90                   	nop
+
+f0105312 <vector79>:
+TRAPHANDLER_NOEC(vector79,79)
+f0105312:	6a 00                	push   $0x0
+f0105314:	6a 4f                	push   $0x4f
+f0105316:	e9 c6 07 00 00       	jmp    f0105ae1 <_alltraps>
+f010531b:	90                   	nop
+
+f010531c <vector80>:
+TRAPHANDLER_NOEC(vector80,80)
+f010531c:	6a 00                	push   $0x0
+f010531e:	6a 50                	push   $0x50
+f0105320:	e9 bc 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105325:	90                   	nop
+
+f0105326 <vector81>:
+TRAPHANDLER_NOEC(vector81,81)
+f0105326:	6a 00                	push   $0x0
+f0105328:	6a 51                	push   $0x51
+f010532a:	e9 b2 07 00 00       	jmp    f0105ae1 <_alltraps>
+f010532f:	90                   	nop
+
+f0105330 <vector82>:
+TRAPHANDLER_NOEC(vector82,82)
+f0105330:	6a 00                	push   $0x0
+f0105332:	6a 52                	push   $0x52
+f0105334:	e9 a8 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105339:	90                   	nop
+
+f010533a <vector83>:
+TRAPHANDLER_NOEC(vector83,83)
+f010533a:	6a 00                	push   $0x0
+f010533c:	6a 53                	push   $0x53
+f010533e:	e9 9e 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105343:	90                   	nop
+
+f0105344 <vector84>:
+TRAPHANDLER_NOEC(vector84,84)
+f0105344:	6a 00                	push   $0x0
+f0105346:	6a 54                	push   $0x54
+f0105348:	e9 94 07 00 00       	jmp    f0105ae1 <_alltraps>
+f010534d:	90                   	nop
+
+f010534e <vector85>:
+TRAPHANDLER_NOEC(vector85,85)
+f010534e:	6a 00                	push   $0x0
+f0105350:	6a 55                	push   $0x55
+f0105352:	e9 8a 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105357:	90                   	nop
+
+f0105358 <vector86>:
+TRAPHANDLER_NOEC(vector86,86)
+f0105358:	6a 00                	push   $0x0
+f010535a:	6a 56                	push   $0x56
+f010535c:	e9 80 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105361:	90                   	nop
+
+f0105362 <vector87>:
+TRAPHANDLER_NOEC(vector87,87)
+f0105362:	6a 00                	push   $0x0
+f0105364:	6a 57                	push   $0x57
+f0105366:	e9 76 07 00 00       	jmp    f0105ae1 <_alltraps>
+f010536b:	90                   	nop
+
+f010536c <vector88>:
+TRAPHANDLER_NOEC(vector88,88)
+f010536c:	6a 00                	push   $0x0
+f010536e:	6a 58                	push   $0x58
+f0105370:	e9 6c 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105375:	90                   	nop
+
+f0105376 <vector89>:
+TRAPHANDLER_NOEC(vector89,89)
+f0105376:	6a 00                	push   $0x0
+f0105378:	6a 59                	push   $0x59
+f010537a:	e9 62 07 00 00       	jmp    f0105ae1 <_alltraps>
+f010537f:	90                   	nop
+
+f0105380 <vector90>:
+TRAPHANDLER_NOEC(vector90,90)
+f0105380:	6a 00                	push   $0x0
+f0105382:	6a 5a                	push   $0x5a
+f0105384:	e9 58 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105389:	90                   	nop
+
+f010538a <vector91>:
+TRAPHANDLER_NOEC(vector91,91)
+f010538a:	6a 00                	push   $0x0
+f010538c:	6a 5b                	push   $0x5b
+f010538e:	e9 4e 07 00 00       	jmp    f0105ae1 <_alltraps>
+f0105393:	90                   	nop
+
+f0105394 <vector92>:
+TRAPHANDLER_NOEC(vector92,92)
+f0105394:	6a 00                	push   $0x0
+f0105396:	6a 5c                	push   $0x5c
+f0105398:	e9 44 07 00 00       	jmp    f0105ae1 <_alltraps>
+f010539d:	90                   	nop
+
+f010539e <vector93>:
+TRAPHANDLER_NOEC(vector93,93)
+f010539e:	6a 00                	push   $0x0
+f01053a0:	6a 5d                	push   $0x5d
+f01053a2:	e9 3a 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01053a7:	90                   	nop
+
+f01053a8 <vector94>:
+TRAPHANDLER_NOEC(vector94,94)
+f01053a8:	6a 00                	push   $0x0
+f01053aa:	6a 5e                	push   $0x5e
+f01053ac:	e9 30 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01053b1:	90                   	nop
+
+f01053b2 <vector95>:
+TRAPHANDLER_NOEC(vector95,95)
+f01053b2:	6a 00                	push   $0x0
+f01053b4:	6a 5f                	push   $0x5f
+f01053b6:	e9 26 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01053bb:	90                   	nop
+
+f01053bc <vector96>:
+TRAPHANDLER_NOEC(vector96,96)
+f01053bc:	6a 00                	push   $0x0
+f01053be:	6a 60                	push   $0x60
+f01053c0:	e9 1c 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01053c5:	90                   	nop
+
+f01053c6 <vector97>:
+TRAPHANDLER_NOEC(vector97,97)
+f01053c6:	6a 00                	push   $0x0
+f01053c8:	6a 61                	push   $0x61
+f01053ca:	e9 12 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01053cf:	90                   	nop
+
+f01053d0 <vector98>:
+TRAPHANDLER_NOEC(vector98,98)
+f01053d0:	6a 00                	push   $0x0
+f01053d2:	6a 62                	push   $0x62
+f01053d4:	e9 08 07 00 00       	jmp    f0105ae1 <_alltraps>
+f01053d9:	90                   	nop
+
+f01053da <vector99>:
+TRAPHANDLER_NOEC(vector99,99)
+f01053da:	6a 00                	push   $0x0
+f01053dc:	6a 63                	push   $0x63
+f01053de:	e9 fe 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01053e3:	90                   	nop
+
+f01053e4 <vector100>:
+TRAPHANDLER_NOEC(vector100,100)
+f01053e4:	6a 00                	push   $0x0
+f01053e6:	6a 64                	push   $0x64
+f01053e8:	e9 f4 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01053ed:	90                   	nop
+
+f01053ee <vector101>:
+TRAPHANDLER_NOEC(vector101,101)
+f01053ee:	6a 00                	push   $0x0
+f01053f0:	6a 65                	push   $0x65
+f01053f2:	e9 ea 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01053f7:	90                   	nop
+
+f01053f8 <vector102>:
+TRAPHANDLER_NOEC(vector102,102)
+f01053f8:	6a 00                	push   $0x0
+f01053fa:	6a 66                	push   $0x66
+f01053fc:	e9 e0 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105401:	90                   	nop
+
+f0105402 <vector103>:
+TRAPHANDLER_NOEC(vector103,103)
+f0105402:	6a 00                	push   $0x0
+f0105404:	6a 67                	push   $0x67
+f0105406:	e9 d6 06 00 00       	jmp    f0105ae1 <_alltraps>
+f010540b:	90                   	nop
+
+f010540c <vector104>:
+TRAPHANDLER_NOEC(vector104,104)
+f010540c:	6a 00                	push   $0x0
+f010540e:	6a 68                	push   $0x68
+f0105410:	e9 cc 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105415:	90                   	nop
+
+f0105416 <vector105>:
+TRAPHANDLER_NOEC(vector105,105)
+f0105416:	6a 00                	push   $0x0
+f0105418:	6a 69                	push   $0x69
+f010541a:	e9 c2 06 00 00       	jmp    f0105ae1 <_alltraps>
+f010541f:	90                   	nop
+
+f0105420 <vector106>:
+TRAPHANDLER_NOEC(vector106,106)
+f0105420:	6a 00                	push   $0x0
+f0105422:	6a 6a                	push   $0x6a
+f0105424:	e9 b8 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105429:	90                   	nop
+
+f010542a <vector107>:
+TRAPHANDLER_NOEC(vector107,107)
+f010542a:	6a 00                	push   $0x0
+f010542c:	6a 6b                	push   $0x6b
+f010542e:	e9 ae 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105433:	90                   	nop
+
+f0105434 <vector108>:
+TRAPHANDLER_NOEC(vector108,108)
+f0105434:	6a 00                	push   $0x0
+f0105436:	6a 6c                	push   $0x6c
+f0105438:	e9 a4 06 00 00       	jmp    f0105ae1 <_alltraps>
+f010543d:	90                   	nop
+
+f010543e <vector109>:
+TRAPHANDLER_NOEC(vector109,109)
+f010543e:	6a 00                	push   $0x0
+f0105440:	6a 6d                	push   $0x6d
+f0105442:	e9 9a 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105447:	90                   	nop
+
+f0105448 <vector110>:
+TRAPHANDLER_NOEC(vector110,110)
+f0105448:	6a 00                	push   $0x0
+f010544a:	6a 6e                	push   $0x6e
+f010544c:	e9 90 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105451:	90                   	nop
+
+f0105452 <vector111>:
+TRAPHANDLER_NOEC(vector111,111)
+f0105452:	6a 00                	push   $0x0
+f0105454:	6a 6f                	push   $0x6f
+f0105456:	e9 86 06 00 00       	jmp    f0105ae1 <_alltraps>
+f010545b:	90                   	nop
+
+f010545c <vector112>:
+TRAPHANDLER_NOEC(vector112,112)
+f010545c:	6a 00                	push   $0x0
+f010545e:	6a 70                	push   $0x70
+f0105460:	e9 7c 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105465:	90                   	nop
+
+f0105466 <vector113>:
+TRAPHANDLER_NOEC(vector113,113)
+f0105466:	6a 00                	push   $0x0
+f0105468:	6a 71                	push   $0x71
+f010546a:	e9 72 06 00 00       	jmp    f0105ae1 <_alltraps>
+f010546f:	90                   	nop
+
+f0105470 <vector114>:
+TRAPHANDLER_NOEC(vector114,114)
+f0105470:	6a 00                	push   $0x0
+f0105472:	6a 72                	push   $0x72
+f0105474:	e9 68 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105479:	90                   	nop
+
+f010547a <vector115>:
+TRAPHANDLER_NOEC(vector115,115)
+f010547a:	6a 00                	push   $0x0
+f010547c:	6a 73                	push   $0x73
+f010547e:	e9 5e 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105483:	90                   	nop
+
+f0105484 <vector116>:
+TRAPHANDLER_NOEC(vector116,116)
+f0105484:	6a 00                	push   $0x0
+f0105486:	6a 74                	push   $0x74
+f0105488:	e9 54 06 00 00       	jmp    f0105ae1 <_alltraps>
+f010548d:	90                   	nop
+
+f010548e <vector117>:
+TRAPHANDLER_NOEC(vector117,117)
+f010548e:	6a 00                	push   $0x0
+f0105490:	6a 75                	push   $0x75
+f0105492:	e9 4a 06 00 00       	jmp    f0105ae1 <_alltraps>
+f0105497:	90                   	nop
+
+f0105498 <vector118>:
+TRAPHANDLER_NOEC(vector118,118)
+f0105498:	6a 00                	push   $0x0
+f010549a:	6a 76                	push   $0x76
+f010549c:	e9 40 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01054a1:	90                   	nop
+
+f01054a2 <vector119>:
+TRAPHANDLER_NOEC(vector119,119)
+f01054a2:	6a 00                	push   $0x0
+f01054a4:	6a 77                	push   $0x77
+f01054a6:	e9 36 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01054ab:	90                   	nop
+
+f01054ac <vector120>:
+TRAPHANDLER_NOEC(vector120,120)
+f01054ac:	6a 00                	push   $0x0
+f01054ae:	6a 78                	push   $0x78
+f01054b0:	e9 2c 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01054b5:	90                   	nop
+
+f01054b6 <vector121>:
+TRAPHANDLER_NOEC(vector121,121)
+f01054b6:	6a 00                	push   $0x0
+f01054b8:	6a 79                	push   $0x79
+f01054ba:	e9 22 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01054bf:	90                   	nop
+
+f01054c0 <vector122>:
+TRAPHANDLER_NOEC(vector122,122)
+f01054c0:	6a 00                	push   $0x0
+f01054c2:	6a 7a                	push   $0x7a
+f01054c4:	e9 18 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01054c9:	90                   	nop
+
+f01054ca <vector123>:
+TRAPHANDLER_NOEC(vector123,123)
+f01054ca:	6a 00                	push   $0x0
+f01054cc:	6a 7b                	push   $0x7b
+f01054ce:	e9 0e 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01054d3:	90                   	nop
+
+f01054d4 <vector124>:
+TRAPHANDLER_NOEC(vector124,124)
+f01054d4:	6a 00                	push   $0x0
+f01054d6:	6a 7c                	push   $0x7c
+f01054d8:	e9 04 06 00 00       	jmp    f0105ae1 <_alltraps>
+f01054dd:	90                   	nop
+
+f01054de <vector125>:
+TRAPHANDLER_NOEC(vector125,125)
+f01054de:	6a 00                	push   $0x0
+f01054e0:	6a 7d                	push   $0x7d
+f01054e2:	e9 fa 05 00 00       	jmp    f0105ae1 <_alltraps>
+f01054e7:	90                   	nop
+
+f01054e8 <vector126>:
+TRAPHANDLER_NOEC(vector126,126)
+f01054e8:	6a 00                	push   $0x0
+f01054ea:	6a 7e                	push   $0x7e
+f01054ec:	e9 f0 05 00 00       	jmp    f0105ae1 <_alltraps>
+f01054f1:	90                   	nop
+
+f01054f2 <vector127>:
+TRAPHANDLER_NOEC(vector127,127)
+f01054f2:	6a 00                	push   $0x0
+f01054f4:	6a 7f                	push   $0x7f
+f01054f6:	e9 e6 05 00 00       	jmp    f0105ae1 <_alltraps>
+f01054fb:	90                   	nop
+
+f01054fc <vector128>:
+TRAPHANDLER_NOEC(vector128,128)
+f01054fc:	6a 00                	push   $0x0
+f01054fe:	68 80 00 00 00       	push   $0x80
+f0105503:	e9 d9 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105508 <vector129>:
+TRAPHANDLER_NOEC(vector129,129)
+f0105508:	6a 00                	push   $0x0
+f010550a:	68 81 00 00 00       	push   $0x81
+f010550f:	e9 cd 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105514 <vector130>:
+TRAPHANDLER_NOEC(vector130,130)
+f0105514:	6a 00                	push   $0x0
+f0105516:	68 82 00 00 00       	push   $0x82
+f010551b:	e9 c1 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105520 <vector131>:
+TRAPHANDLER_NOEC(vector131,131)
+f0105520:	6a 00                	push   $0x0
+f0105522:	68 83 00 00 00       	push   $0x83
+f0105527:	e9 b5 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010552c <vector132>:
+TRAPHANDLER_NOEC(vector132,132)
+f010552c:	6a 00                	push   $0x0
+f010552e:	68 84 00 00 00       	push   $0x84
+f0105533:	e9 a9 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105538 <vector133>:
+TRAPHANDLER_NOEC(vector133,133)
+f0105538:	6a 00                	push   $0x0
+f010553a:	68 85 00 00 00       	push   $0x85
+f010553f:	e9 9d 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105544 <vector134>:
+TRAPHANDLER_NOEC(vector134,134)
+f0105544:	6a 00                	push   $0x0
+f0105546:	68 86 00 00 00       	push   $0x86
+f010554b:	e9 91 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105550 <vector135>:
+TRAPHANDLER_NOEC(vector135,135)
+f0105550:	6a 00                	push   $0x0
+f0105552:	68 87 00 00 00       	push   $0x87
+f0105557:	e9 85 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010555c <vector136>:
+TRAPHANDLER_NOEC(vector136,136)
+f010555c:	6a 00                	push   $0x0
+f010555e:	68 88 00 00 00       	push   $0x88
+f0105563:	e9 79 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105568 <vector137>:
+TRAPHANDLER_NOEC(vector137,137)
+f0105568:	6a 00                	push   $0x0
+f010556a:	68 89 00 00 00       	push   $0x89
+f010556f:	e9 6d 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105574 <vector138>:
+TRAPHANDLER_NOEC(vector138,138)
+f0105574:	6a 00                	push   $0x0
+f0105576:	68 8a 00 00 00       	push   $0x8a
+f010557b:	e9 61 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105580 <vector139>:
+TRAPHANDLER_NOEC(vector139,139)
+f0105580:	6a 00                	push   $0x0
+f0105582:	68 8b 00 00 00       	push   $0x8b
+f0105587:	e9 55 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010558c <vector140>:
+TRAPHANDLER_NOEC(vector140,140)
+f010558c:	6a 00                	push   $0x0
+f010558e:	68 8c 00 00 00       	push   $0x8c
+f0105593:	e9 49 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105598 <vector141>:
+TRAPHANDLER_NOEC(vector141,141)
+f0105598:	6a 00                	push   $0x0
+f010559a:	68 8d 00 00 00       	push   $0x8d
+f010559f:	e9 3d 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055a4 <vector142>:
+TRAPHANDLER_NOEC(vector142,142)
+f01055a4:	6a 00                	push   $0x0
+f01055a6:	68 8e 00 00 00       	push   $0x8e
+f01055ab:	e9 31 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055b0 <vector143>:
+TRAPHANDLER_NOEC(vector143,143)
+f01055b0:	6a 00                	push   $0x0
+f01055b2:	68 8f 00 00 00       	push   $0x8f
+f01055b7:	e9 25 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055bc <vector144>:
+TRAPHANDLER_NOEC(vector144,144)
+f01055bc:	6a 00                	push   $0x0
+f01055be:	68 90 00 00 00       	push   $0x90
+f01055c3:	e9 19 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055c8 <vector145>:
+TRAPHANDLER_NOEC(vector145,145)
+f01055c8:	6a 00                	push   $0x0
+f01055ca:	68 91 00 00 00       	push   $0x91
+f01055cf:	e9 0d 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055d4 <vector146>:
+TRAPHANDLER_NOEC(vector146,146)
+f01055d4:	6a 00                	push   $0x0
+f01055d6:	68 92 00 00 00       	push   $0x92
+f01055db:	e9 01 05 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055e0 <vector147>:
+TRAPHANDLER_NOEC(vector147,147)
+f01055e0:	6a 00                	push   $0x0
+f01055e2:	68 93 00 00 00       	push   $0x93
+f01055e7:	e9 f5 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055ec <vector148>:
+TRAPHANDLER_NOEC(vector148,148)
+f01055ec:	6a 00                	push   $0x0
+f01055ee:	68 94 00 00 00       	push   $0x94
+f01055f3:	e9 e9 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01055f8 <vector149>:
+TRAPHANDLER_NOEC(vector149,149)
+f01055f8:	6a 00                	push   $0x0
+f01055fa:	68 95 00 00 00       	push   $0x95
+f01055ff:	e9 dd 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105604 <vector150>:
+TRAPHANDLER_NOEC(vector150,150)
+f0105604:	6a 00                	push   $0x0
+f0105606:	68 96 00 00 00       	push   $0x96
+f010560b:	e9 d1 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105610 <vector151>:
+TRAPHANDLER_NOEC(vector151,151)
+f0105610:	6a 00                	push   $0x0
+f0105612:	68 97 00 00 00       	push   $0x97
+f0105617:	e9 c5 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010561c <vector152>:
+TRAPHANDLER_NOEC(vector152,152)
+f010561c:	6a 00                	push   $0x0
+f010561e:	68 98 00 00 00       	push   $0x98
+f0105623:	e9 b9 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105628 <vector153>:
+TRAPHANDLER_NOEC(vector153,153)
+f0105628:	6a 00                	push   $0x0
+f010562a:	68 99 00 00 00       	push   $0x99
+f010562f:	e9 ad 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105634 <vector154>:
+TRAPHANDLER_NOEC(vector154,154)
+f0105634:	6a 00                	push   $0x0
+f0105636:	68 9a 00 00 00       	push   $0x9a
+f010563b:	e9 a1 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105640 <vector155>:
+TRAPHANDLER_NOEC(vector155,155)
+f0105640:	6a 00                	push   $0x0
+f0105642:	68 9b 00 00 00       	push   $0x9b
+f0105647:	e9 95 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010564c <vector156>:
+TRAPHANDLER_NOEC(vector156,156)
+f010564c:	6a 00                	push   $0x0
+f010564e:	68 9c 00 00 00       	push   $0x9c
+f0105653:	e9 89 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105658 <vector157>:
+TRAPHANDLER_NOEC(vector157,157)
+f0105658:	6a 00                	push   $0x0
+f010565a:	68 9d 00 00 00       	push   $0x9d
+f010565f:	e9 7d 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105664 <vector158>:
+TRAPHANDLER_NOEC(vector158,158)
+f0105664:	6a 00                	push   $0x0
+f0105666:	68 9e 00 00 00       	push   $0x9e
+f010566b:	e9 71 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105670 <vector159>:
+TRAPHANDLER_NOEC(vector159,159)
+f0105670:	6a 00                	push   $0x0
+f0105672:	68 9f 00 00 00       	push   $0x9f
+f0105677:	e9 65 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010567c <vector160>:
+TRAPHANDLER_NOEC(vector160,160)
+f010567c:	6a 00                	push   $0x0
+f010567e:	68 a0 00 00 00       	push   $0xa0
+f0105683:	e9 59 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105688 <vector161>:
+TRAPHANDLER_NOEC(vector161,161)
+f0105688:	6a 00                	push   $0x0
+f010568a:	68 a1 00 00 00       	push   $0xa1
+f010568f:	e9 4d 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105694 <vector162>:
+TRAPHANDLER_NOEC(vector162,162)
+f0105694:	6a 00                	push   $0x0
+f0105696:	68 a2 00 00 00       	push   $0xa2
+f010569b:	e9 41 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056a0 <vector163>:
+TRAPHANDLER_NOEC(vector163,163)
+f01056a0:	6a 00                	push   $0x0
+f01056a2:	68 a3 00 00 00       	push   $0xa3
+f01056a7:	e9 35 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056ac <vector164>:
+TRAPHANDLER_NOEC(vector164,164)
+f01056ac:	6a 00                	push   $0x0
+f01056ae:	68 a4 00 00 00       	push   $0xa4
+f01056b3:	e9 29 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056b8 <vector165>:
+TRAPHANDLER_NOEC(vector165,165)
+f01056b8:	6a 00                	push   $0x0
+f01056ba:	68 a5 00 00 00       	push   $0xa5
+f01056bf:	e9 1d 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056c4 <vector166>:
+TRAPHANDLER_NOEC(vector166,166)
+f01056c4:	6a 00                	push   $0x0
+f01056c6:	68 a6 00 00 00       	push   $0xa6
+f01056cb:	e9 11 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056d0 <vector167>:
+TRAPHANDLER_NOEC(vector167,167)
+f01056d0:	6a 00                	push   $0x0
+f01056d2:	68 a7 00 00 00       	push   $0xa7
+f01056d7:	e9 05 04 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056dc <vector168>:
+TRAPHANDLER_NOEC(vector168,168)
+f01056dc:	6a 00                	push   $0x0
+f01056de:	68 a8 00 00 00       	push   $0xa8
+f01056e3:	e9 f9 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056e8 <vector169>:
+TRAPHANDLER_NOEC(vector169,169)
+f01056e8:	6a 00                	push   $0x0
+f01056ea:	68 a9 00 00 00       	push   $0xa9
+f01056ef:	e9 ed 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01056f4 <vector170>:
+TRAPHANDLER_NOEC(vector170,170)
+f01056f4:	6a 00                	push   $0x0
+f01056f6:	68 aa 00 00 00       	push   $0xaa
+f01056fb:	e9 e1 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105700 <vector171>:
+TRAPHANDLER_NOEC(vector171,171)
+f0105700:	6a 00                	push   $0x0
+f0105702:	68 ab 00 00 00       	push   $0xab
+f0105707:	e9 d5 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010570c <vector172>:
+TRAPHANDLER_NOEC(vector172,172)
+f010570c:	6a 00                	push   $0x0
+f010570e:	68 ac 00 00 00       	push   $0xac
+f0105713:	e9 c9 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105718 <vector173>:
+TRAPHANDLER_NOEC(vector173,173)
+f0105718:	6a 00                	push   $0x0
+f010571a:	68 ad 00 00 00       	push   $0xad
+f010571f:	e9 bd 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105724 <vector174>:
+TRAPHANDLER_NOEC(vector174,174)
+f0105724:	6a 00                	push   $0x0
+f0105726:	68 ae 00 00 00       	push   $0xae
+f010572b:	e9 b1 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105730 <vector175>:
+TRAPHANDLER_NOEC(vector175,175)
+f0105730:	6a 00                	push   $0x0
+f0105732:	68 af 00 00 00       	push   $0xaf
+f0105737:	e9 a5 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010573c <vector176>:
+TRAPHANDLER_NOEC(vector176,176)
+f010573c:	6a 00                	push   $0x0
+f010573e:	68 b0 00 00 00       	push   $0xb0
+f0105743:	e9 99 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105748 <vector177>:
+TRAPHANDLER_NOEC(vector177,177)
+f0105748:	6a 00                	push   $0x0
+f010574a:	68 b1 00 00 00       	push   $0xb1
+f010574f:	e9 8d 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105754 <vector178>:
+TRAPHANDLER_NOEC(vector178,178)
+f0105754:	6a 00                	push   $0x0
+f0105756:	68 b2 00 00 00       	push   $0xb2
+f010575b:	e9 81 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105760 <vector179>:
+TRAPHANDLER_NOEC(vector179,179)
+f0105760:	6a 00                	push   $0x0
+f0105762:	68 b3 00 00 00       	push   $0xb3
+f0105767:	e9 75 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010576c <vector180>:
+TRAPHANDLER_NOEC(vector180,180)
+f010576c:	6a 00                	push   $0x0
+f010576e:	68 b4 00 00 00       	push   $0xb4
+f0105773:	e9 69 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105778 <vector181>:
+TRAPHANDLER_NOEC(vector181,181)
+f0105778:	6a 00                	push   $0x0
+f010577a:	68 b5 00 00 00       	push   $0xb5
+f010577f:	e9 5d 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105784 <vector182>:
+TRAPHANDLER_NOEC(vector182,182)
+f0105784:	6a 00                	push   $0x0
+f0105786:	68 b6 00 00 00       	push   $0xb6
+f010578b:	e9 51 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105790 <vector183>:
+TRAPHANDLER_NOEC(vector183,183)
+f0105790:	6a 00                	push   $0x0
+f0105792:	68 b7 00 00 00       	push   $0xb7
+f0105797:	e9 45 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010579c <vector184>:
+TRAPHANDLER_NOEC(vector184,184)
+f010579c:	6a 00                	push   $0x0
+f010579e:	68 b8 00 00 00       	push   $0xb8
+f01057a3:	e9 39 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057a8 <vector185>:
+TRAPHANDLER_NOEC(vector185,185)
+f01057a8:	6a 00                	push   $0x0
+f01057aa:	68 b9 00 00 00       	push   $0xb9
+f01057af:	e9 2d 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057b4 <vector186>:
+TRAPHANDLER_NOEC(vector186,186)
+f01057b4:	6a 00                	push   $0x0
+f01057b6:	68 ba 00 00 00       	push   $0xba
+f01057bb:	e9 21 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057c0 <vector187>:
+TRAPHANDLER_NOEC(vector187,187)
+f01057c0:	6a 00                	push   $0x0
+f01057c2:	68 bb 00 00 00       	push   $0xbb
+f01057c7:	e9 15 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057cc <vector188>:
+TRAPHANDLER_NOEC(vector188,188)
+f01057cc:	6a 00                	push   $0x0
+f01057ce:	68 bc 00 00 00       	push   $0xbc
+f01057d3:	e9 09 03 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057d8 <vector189>:
+TRAPHANDLER_NOEC(vector189,189)
+f01057d8:	6a 00                	push   $0x0
+f01057da:	68 bd 00 00 00       	push   $0xbd
+f01057df:	e9 fd 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057e4 <vector190>:
+TRAPHANDLER_NOEC(vector190,190)
+f01057e4:	6a 00                	push   $0x0
+f01057e6:	68 be 00 00 00       	push   $0xbe
+f01057eb:	e9 f1 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057f0 <vector191>:
+TRAPHANDLER_NOEC(vector191,191)
+f01057f0:	6a 00                	push   $0x0
+f01057f2:	68 bf 00 00 00       	push   $0xbf
+f01057f7:	e9 e5 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01057fc <vector192>:
+TRAPHANDLER_NOEC(vector192,192)
+f01057fc:	6a 00                	push   $0x0
+f01057fe:	68 c0 00 00 00       	push   $0xc0
+f0105803:	e9 d9 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105808 <vector193>:
+TRAPHANDLER_NOEC(vector193,193)
+f0105808:	6a 00                	push   $0x0
+f010580a:	68 c1 00 00 00       	push   $0xc1
+f010580f:	e9 cd 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105814 <vector194>:
+TRAPHANDLER_NOEC(vector194,194)
+f0105814:	6a 00                	push   $0x0
+f0105816:	68 c2 00 00 00       	push   $0xc2
+f010581b:	e9 c1 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105820 <vector195>:
+TRAPHANDLER_NOEC(vector195,195)
+f0105820:	6a 00                	push   $0x0
+f0105822:	68 c3 00 00 00       	push   $0xc3
+f0105827:	e9 b5 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010582c <vector196>:
+TRAPHANDLER_NOEC(vector196,196)
+f010582c:	6a 00                	push   $0x0
+f010582e:	68 c4 00 00 00       	push   $0xc4
+f0105833:	e9 a9 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105838 <vector197>:
+TRAPHANDLER_NOEC(vector197,197)
+f0105838:	6a 00                	push   $0x0
+f010583a:	68 c5 00 00 00       	push   $0xc5
+f010583f:	e9 9d 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105844 <vector198>:
+TRAPHANDLER_NOEC(vector198,198)
+f0105844:	6a 00                	push   $0x0
+f0105846:	68 c6 00 00 00       	push   $0xc6
+f010584b:	e9 91 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105850 <vector199>:
+TRAPHANDLER_NOEC(vector199,199)
+f0105850:	6a 00                	push   $0x0
+f0105852:	68 c7 00 00 00       	push   $0xc7
+f0105857:	e9 85 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010585c <vector200>:
+TRAPHANDLER_NOEC(vector200,200)
+f010585c:	6a 00                	push   $0x0
+f010585e:	68 c8 00 00 00       	push   $0xc8
+f0105863:	e9 79 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105868 <vector201>:
+TRAPHANDLER_NOEC(vector201,201)
+f0105868:	6a 00                	push   $0x0
+f010586a:	68 c9 00 00 00       	push   $0xc9
+f010586f:	e9 6d 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105874 <vector202>:
+TRAPHANDLER_NOEC(vector202,202)
+f0105874:	6a 00                	push   $0x0
+f0105876:	68 ca 00 00 00       	push   $0xca
+f010587b:	e9 61 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105880 <vector203>:
+TRAPHANDLER_NOEC(vector203,203)
+f0105880:	6a 00                	push   $0x0
+f0105882:	68 cb 00 00 00       	push   $0xcb
+f0105887:	e9 55 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010588c <vector204>:
+TRAPHANDLER_NOEC(vector204,204)
+f010588c:	6a 00                	push   $0x0
+f010588e:	68 cc 00 00 00       	push   $0xcc
+f0105893:	e9 49 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105898 <vector205>:
+TRAPHANDLER_NOEC(vector205,205)
+f0105898:	6a 00                	push   $0x0
+f010589a:	68 cd 00 00 00       	push   $0xcd
+f010589f:	e9 3d 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058a4 <vector206>:
+TRAPHANDLER_NOEC(vector206,206)
+f01058a4:	6a 00                	push   $0x0
+f01058a6:	68 ce 00 00 00       	push   $0xce
+f01058ab:	e9 31 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058b0 <vector207>:
+TRAPHANDLER_NOEC(vector207,207)
+f01058b0:	6a 00                	push   $0x0
+f01058b2:	68 cf 00 00 00       	push   $0xcf
+f01058b7:	e9 25 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058bc <vector208>:
+TRAPHANDLER_NOEC(vector208,208)
+f01058bc:	6a 00                	push   $0x0
+f01058be:	68 d0 00 00 00       	push   $0xd0
+f01058c3:	e9 19 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058c8 <vector209>:
+TRAPHANDLER_NOEC(vector209,209)
+f01058c8:	6a 00                	push   $0x0
+f01058ca:	68 d1 00 00 00       	push   $0xd1
+f01058cf:	e9 0d 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058d4 <vector210>:
+TRAPHANDLER_NOEC(vector210,210)
+f01058d4:	6a 00                	push   $0x0
+f01058d6:	68 d2 00 00 00       	push   $0xd2
+f01058db:	e9 01 02 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058e0 <vector211>:
+TRAPHANDLER_NOEC(vector211,211)
+f01058e0:	6a 00                	push   $0x0
+f01058e2:	68 d3 00 00 00       	push   $0xd3
+f01058e7:	e9 f5 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058ec <vector212>:
+TRAPHANDLER_NOEC(vector212,212)
+f01058ec:	6a 00                	push   $0x0
+f01058ee:	68 d4 00 00 00       	push   $0xd4
+f01058f3:	e9 e9 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01058f8 <vector213>:
+TRAPHANDLER_NOEC(vector213,213)
+f01058f8:	6a 00                	push   $0x0
+f01058fa:	68 d5 00 00 00       	push   $0xd5
+f01058ff:	e9 dd 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105904 <vector214>:
+TRAPHANDLER_NOEC(vector214,214)
+f0105904:	6a 00                	push   $0x0
+f0105906:	68 d6 00 00 00       	push   $0xd6
+f010590b:	e9 d1 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105910 <vector215>:
+TRAPHANDLER_NOEC(vector215,215)
+f0105910:	6a 00                	push   $0x0
+f0105912:	68 d7 00 00 00       	push   $0xd7
+f0105917:	e9 c5 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010591c <vector216>:
+TRAPHANDLER_NOEC(vector216,216)
+f010591c:	6a 00                	push   $0x0
+f010591e:	68 d8 00 00 00       	push   $0xd8
+f0105923:	e9 b9 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105928 <vector217>:
+TRAPHANDLER_NOEC(vector217,217)
+f0105928:	6a 00                	push   $0x0
+f010592a:	68 d9 00 00 00       	push   $0xd9
+f010592f:	e9 ad 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105934 <vector218>:
+TRAPHANDLER_NOEC(vector218,218)
+f0105934:	6a 00                	push   $0x0
+f0105936:	68 da 00 00 00       	push   $0xda
+f010593b:	e9 a1 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105940 <vector219>:
+TRAPHANDLER_NOEC(vector219,219)
+f0105940:	6a 00                	push   $0x0
+f0105942:	68 db 00 00 00       	push   $0xdb
+f0105947:	e9 95 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010594c <vector220>:
+TRAPHANDLER_NOEC(vector220,220)
+f010594c:	6a 00                	push   $0x0
+f010594e:	68 dc 00 00 00       	push   $0xdc
+f0105953:	e9 89 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105958 <vector221>:
+TRAPHANDLER_NOEC(vector221,221)
+f0105958:	6a 00                	push   $0x0
+f010595a:	68 dd 00 00 00       	push   $0xdd
+f010595f:	e9 7d 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105964 <vector222>:
+TRAPHANDLER_NOEC(vector222,222)
+f0105964:	6a 00                	push   $0x0
+f0105966:	68 de 00 00 00       	push   $0xde
+f010596b:	e9 71 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105970 <vector223>:
+TRAPHANDLER_NOEC(vector223,223)
+f0105970:	6a 00                	push   $0x0
+f0105972:	68 df 00 00 00       	push   $0xdf
+f0105977:	e9 65 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f010597c <vector224>:
+TRAPHANDLER_NOEC(vector224,224)
+f010597c:	6a 00                	push   $0x0
+f010597e:	68 e0 00 00 00       	push   $0xe0
+f0105983:	e9 59 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105988 <vector225>:
+TRAPHANDLER_NOEC(vector225,225)
+f0105988:	6a 00                	push   $0x0
+f010598a:	68 e1 00 00 00       	push   $0xe1
+f010598f:	e9 4d 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105994 <vector226>:
+TRAPHANDLER_NOEC(vector226,226)
+f0105994:	6a 00                	push   $0x0
+f0105996:	68 e2 00 00 00       	push   $0xe2
+f010599b:	e9 41 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059a0 <vector227>:
+TRAPHANDLER_NOEC(vector227,227)
+f01059a0:	6a 00                	push   $0x0
+f01059a2:	68 e3 00 00 00       	push   $0xe3
+f01059a7:	e9 35 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059ac <vector228>:
+TRAPHANDLER_NOEC(vector228,228)
+f01059ac:	6a 00                	push   $0x0
+f01059ae:	68 e4 00 00 00       	push   $0xe4
+f01059b3:	e9 29 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059b8 <vector229>:
+TRAPHANDLER_NOEC(vector229,229)
+f01059b8:	6a 00                	push   $0x0
+f01059ba:	68 e5 00 00 00       	push   $0xe5
+f01059bf:	e9 1d 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059c4 <vector230>:
+TRAPHANDLER_NOEC(vector230,230)
+f01059c4:	6a 00                	push   $0x0
+f01059c6:	68 e6 00 00 00       	push   $0xe6
+f01059cb:	e9 11 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059d0 <vector231>:
+TRAPHANDLER_NOEC(vector231,231)
+f01059d0:	6a 00                	push   $0x0
+f01059d2:	68 e7 00 00 00       	push   $0xe7
+f01059d7:	e9 05 01 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059dc <vector232>:
+TRAPHANDLER_NOEC(vector232,232)
+f01059dc:	6a 00                	push   $0x0
+f01059de:	68 e8 00 00 00       	push   $0xe8
+f01059e3:	e9 f9 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059e8 <vector233>:
+TRAPHANDLER_NOEC(vector233,233)
+f01059e8:	6a 00                	push   $0x0
+f01059ea:	68 e9 00 00 00       	push   $0xe9
+f01059ef:	e9 ed 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f01059f4 <vector234>:
+TRAPHANDLER_NOEC(vector234,234)
+f01059f4:	6a 00                	push   $0x0
+f01059f6:	68 ea 00 00 00       	push   $0xea
+f01059fb:	e9 e1 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a00 <vector235>:
+TRAPHANDLER_NOEC(vector235,235)
+f0105a00:	6a 00                	push   $0x0
+f0105a02:	68 eb 00 00 00       	push   $0xeb
+f0105a07:	e9 d5 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a0c <vector236>:
+TRAPHANDLER_NOEC(vector236,236)
+f0105a0c:	6a 00                	push   $0x0
+f0105a0e:	68 ec 00 00 00       	push   $0xec
+f0105a13:	e9 c9 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a18 <vector237>:
+TRAPHANDLER_NOEC(vector237,237)
+f0105a18:	6a 00                	push   $0x0
+f0105a1a:	68 ed 00 00 00       	push   $0xed
+f0105a1f:	e9 bd 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a24 <vector238>:
+TRAPHANDLER_NOEC(vector238,238)
+f0105a24:	6a 00                	push   $0x0
+f0105a26:	68 ee 00 00 00       	push   $0xee
+f0105a2b:	e9 b1 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a30 <vector239>:
+TRAPHANDLER_NOEC(vector239,239)
+f0105a30:	6a 00                	push   $0x0
+f0105a32:	68 ef 00 00 00       	push   $0xef
+f0105a37:	e9 a5 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a3c <vector240>:
+TRAPHANDLER_NOEC(vector240,240)
+f0105a3c:	6a 00                	push   $0x0
+f0105a3e:	68 f0 00 00 00       	push   $0xf0
+f0105a43:	e9 99 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a48 <vector241>:
+TRAPHANDLER_NOEC(vector241,241)
+f0105a48:	6a 00                	push   $0x0
+f0105a4a:	68 f1 00 00 00       	push   $0xf1
+f0105a4f:	e9 8d 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a54 <vector242>:
+TRAPHANDLER_NOEC(vector242,242)
+f0105a54:	6a 00                	push   $0x0
+f0105a56:	68 f2 00 00 00       	push   $0xf2
+f0105a5b:	e9 81 00 00 00       	jmp    f0105ae1 <_alltraps>
+
+f0105a60 <vector243>:
+TRAPHANDLER_NOEC(vector243,243)
+f0105a60:	6a 00                	push   $0x0
+f0105a62:	68 f3 00 00 00       	push   $0xf3
+f0105a67:	eb 78                	jmp    f0105ae1 <_alltraps>
+f0105a69:	90                   	nop
+
+f0105a6a <vector244>:
+TRAPHANDLER_NOEC(vector244,244)
+f0105a6a:	6a 00                	push   $0x0
+f0105a6c:	68 f4 00 00 00       	push   $0xf4
+f0105a71:	eb 6e                	jmp    f0105ae1 <_alltraps>
+f0105a73:	90                   	nop
+
+f0105a74 <vector245>:
+TRAPHANDLER_NOEC(vector245,245)
+f0105a74:	6a 00                	push   $0x0
+f0105a76:	68 f5 00 00 00       	push   $0xf5
+f0105a7b:	eb 64                	jmp    f0105ae1 <_alltraps>
+f0105a7d:	90                   	nop
+
+f0105a7e <vector246>:
+TRAPHANDLER_NOEC(vector246,246)
+f0105a7e:	6a 00                	push   $0x0
+f0105a80:	68 f6 00 00 00       	push   $0xf6
+f0105a85:	eb 5a                	jmp    f0105ae1 <_alltraps>
+f0105a87:	90                   	nop
+
+f0105a88 <vector247>:
+TRAPHANDLER_NOEC(vector247,247)
+f0105a88:	6a 00                	push   $0x0
+f0105a8a:	68 f7 00 00 00       	push   $0xf7
+f0105a8f:	eb 50                	jmp    f0105ae1 <_alltraps>
+f0105a91:	90                   	nop
+
+f0105a92 <vector248>:
+TRAPHANDLER_NOEC(vector248,248)
+f0105a92:	6a 00                	push   $0x0
+f0105a94:	68 f8 00 00 00       	push   $0xf8
+f0105a99:	eb 46                	jmp    f0105ae1 <_alltraps>
+f0105a9b:	90                   	nop
+
+f0105a9c <vector249>:
+TRAPHANDLER_NOEC(vector249,249)
+f0105a9c:	6a 00                	push   $0x0
+f0105a9e:	68 f9 00 00 00       	push   $0xf9
+f0105aa3:	eb 3c                	jmp    f0105ae1 <_alltraps>
+f0105aa5:	90                   	nop
+
+f0105aa6 <vector250>:
+TRAPHANDLER_NOEC(vector250,250)
+f0105aa6:	6a 00                	push   $0x0
+f0105aa8:	68 fa 00 00 00       	push   $0xfa
+f0105aad:	eb 32                	jmp    f0105ae1 <_alltraps>
+f0105aaf:	90                   	nop
+
+f0105ab0 <vector251>:
+TRAPHANDLER_NOEC(vector251,251)
+f0105ab0:	6a 00                	push   $0x0
+f0105ab2:	68 fb 00 00 00       	push   $0xfb
+f0105ab7:	eb 28                	jmp    f0105ae1 <_alltraps>
+f0105ab9:	90                   	nop
+
+f0105aba <vector252>:
+TRAPHANDLER_NOEC(vector252,252)
+f0105aba:	6a 00                	push   $0x0
+f0105abc:	68 fc 00 00 00       	push   $0xfc
+f0105ac1:	eb 1e                	jmp    f0105ae1 <_alltraps>
+f0105ac3:	90                   	nop
+
+f0105ac4 <vector253>:
+TRAPHANDLER_NOEC(vector253,253)
+f0105ac4:	6a 00                	push   $0x0
+f0105ac6:	68 fd 00 00 00       	push   $0xfd
+f0105acb:	eb 14                	jmp    f0105ae1 <_alltraps>
+f0105acd:	90                   	nop
+
+f0105ace <vector254>:
+TRAPHANDLER_NOEC(vector254,254)
+f0105ace:	6a 00                	push   $0x0
+f0105ad0:	68 fe 00 00 00       	push   $0xfe
+f0105ad5:	eb 0a                	jmp    f0105ae1 <_alltraps>
+f0105ad7:	90                   	nop
+
+f0105ad8 <vector255>:
+TRAPHANDLER_NOEC(vector255,255)
+f0105ad8:	6a 00                	push   $0x0
+f0105ada:	68 ff 00 00 00       	push   $0xff
+f0105adf:	eb 00                	jmp    f0105ae1 <_alltraps>
+
+f0105ae1 <_alltraps>:
+ * Lab 3: Your code here for _alltraps
+ */
+.text
+.global _alltraps
+_alltraps:
+	pushl %ds
+f0105ae1:	1e                   	push   %ds
+	pushl %es
+f0105ae2:	06                   	push   %es
+	pushal;
+f0105ae3:	60                   	pusha
+	movw $(GD_KD), %ax
+f0105ae4:	66 b8 10 00          	mov    $0x10,%ax
+	movw %ax, %ds
+f0105ae8:	8e d8                	mov    %eax,%ds
+	movw %ax, %es
+f0105aea:	8e c0                	mov    %eax,%es
+	pushl %esp
+f0105aec:	54                   	push   %esp
+	call trap
+f0105aed:	e8 3c f2 ff ff       	call   f0104d2e <trap>
+
+f0105af2 <sched_yield>:
+
+
+// Choose a user environment to run and run it.
+void
+sched_yield(void)
+{
+f0105af2:	55                   	push   %ebp
+f0105af3:	89 e5                	mov    %esp,%ebp
+f0105af5:	53                   	push   %ebx
+f0105af6:	83 ec 04             	sub    $0x4,%esp
+	// no runnable environments, simply drop through to the code
+	// below to switch to this CPU's idle environment.
+
+	// LAB 4: Your code here.
+	int  cur;
+	if(curenv) 
+f0105af9:	e8 fb 27 00 00       	call   f01082f9 <cpunum>
+f0105afe:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+		cur = ENVX(curenv->env_id) + 1;
+	else
+		cur = 0;
+f0105b04:	ba 00 00 00 00       	mov    $0x0,%edx
+	if(curenv) 
+f0105b09:	83 b8 28 00 93 f0 00 	cmpl   $0x0,-0xf6cffd8(%eax)
+f0105b10:	74 1d                	je     f0105b2f <sched_yield+0x3d>
+		cur = ENVX(curenv->env_id) + 1;
+f0105b12:	e8 e2 27 00 00       	call   f01082f9 <cpunum>
+f0105b17:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105b1d:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0105b23:	8b 50 48             	mov    0x48(%eax),%edx
+f0105b26:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0105b2c:	83 c2 01             	add    $0x1,%edx
+	
+	for(i = 0; i < NENV; i++)
+	{
+		if(envs[cur].env_type != ENV_TYPE_IDLE && 
+f0105b2f:	8b 1d 50 c2 92 f0    	mov    0xf092c250,%ebx
+f0105b35:	b9 00 04 00 00       	mov    $0x400,%ecx
+f0105b3a:	eb 1a                	jmp    f0105b56 <sched_yield+0x64>
+			envs[cur].env_status == ENV_RUNNABLE)
+			env_run(&envs[cur]);
+
+		cur = (cur + 1) % NENV;
+f0105b3c:	83 c2 01             	add    $0x1,%edx
+f0105b3f:	89 d0                	mov    %edx,%eax
+f0105b41:	c1 f8 1f             	sar    $0x1f,%eax
+f0105b44:	c1 e8 16             	shr    $0x16,%eax
+f0105b47:	01 c2                	add    %eax,%edx
+f0105b49:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0105b4f:	29 c2                	sub    %eax,%edx
+	for(i = 0; i < NENV; i++)
+f0105b51:	83 e9 01             	sub    $0x1,%ecx
+f0105b54:	74 1d                	je     f0105b73 <sched_yield+0x81>
+		if(envs[cur].env_type != ENV_TYPE_IDLE && 
+f0105b56:	69 c2 bc 00 00 00    	imul   $0xbc,%edx,%eax
+f0105b5c:	01 d8                	add    %ebx,%eax
+f0105b5e:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105b62:	74 d8                	je     f0105b3c <sched_yield+0x4a>
+f0105b64:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f0105b68:	75 d2                	jne    f0105b3c <sched_yield+0x4a>
+			env_run(&envs[cur]);
+f0105b6a:	83 ec 0c             	sub    $0xc,%esp
+f0105b6d:	50                   	push   %eax
+f0105b6e:	e8 82 e8 ff ff       	call   f01043f5 <env_run>
+	}
+	if(curenv && curenv->env_type != ENV_TYPE_IDLE &&
+f0105b73:	e8 81 27 00 00       	call   f01082f9 <cpunum>
+f0105b78:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105b7e:	83 b8 28 00 93 f0 00 	cmpl   $0x0,-0xf6cffd8(%eax)
+f0105b85:	74 17                	je     f0105b9e <sched_yield+0xac>
+f0105b87:	e8 6d 27 00 00       	call   f01082f9 <cpunum>
+f0105b8c:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105b92:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0105b98:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105b9c:	75 10                	jne    f0105bae <sched_yield+0xbc>
+
+	// For debugging and testing purposes, if there are no
+	// runnable environments other than the idle environments,
+	// drop into the kernel monitor.
+	for (i = 0; i < NENV; i++) {
+		if (envs[i].env_type != ENV_TYPE_IDLE &&
+f0105b9e:	8b 1d 50 c2 92 f0    	mov    0xf092c250,%ebx
+f0105ba4:	8d 43 50             	lea    0x50(%ebx),%eax
+	for (i = 0; i < NENV; i++) {
+f0105ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105bac:	eb 5d                	jmp    f0105c0b <sched_yield+0x119>
+		curenv->env_status == ENV_RUNNING && 
+f0105bae:	e8 46 27 00 00       	call   f01082f9 <cpunum>
+f0105bb3:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105bb9:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+	if(curenv && curenv->env_type != ENV_TYPE_IDLE &&
+f0105bbf:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0105bc3:	75 d9                	jne    f0105b9e <sched_yield+0xac>
+		curenv->env_cpunum == cpunum())
+f0105bc5:	e8 2f 27 00 00       	call   f01082f9 <cpunum>
+f0105bca:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105bd0:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0105bd6:	8b 58 68             	mov    0x68(%eax),%ebx
+f0105bd9:	e8 1b 27 00 00       	call   f01082f9 <cpunum>
+		curenv->env_status == ENV_RUNNING && 
+f0105bde:	39 c3                	cmp    %eax,%ebx
+f0105be0:	75 bc                	jne    f0105b9e <sched_yield+0xac>
+		env_run(curenv);
+f0105be2:	e8 12 27 00 00       	call   f01082f9 <cpunum>
+f0105be7:	83 ec 0c             	sub    $0xc,%esp
+f0105bea:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105bf0:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0105bf6:	e8 fa e7 ff ff       	call   f01043f5 <env_run>
+	for (i = 0; i < NENV; i++) {
+f0105bfb:	83 c2 01             	add    $0x1,%edx
+f0105bfe:	05 bc 00 00 00       	add    $0xbc,%eax
+f0105c03:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+f0105c09:	74 47                	je     f0105c52 <sched_yield+0x160>
+		if (envs[i].env_type != ENV_TYPE_IDLE &&
+f0105c0b:	83 38 01             	cmpl   $0x1,(%eax)
+f0105c0e:	74 eb                	je     f0105bfb <sched_yield+0x109>
+		    (envs[i].env_status == ENV_RUNNABLE ||
+f0105c10:	8b 48 04             	mov    0x4(%eax),%ecx
+f0105c13:	83 e9 02             	sub    $0x2,%ecx
+		if (envs[i].env_type != ENV_TYPE_IDLE &&
+f0105c16:	83 f9 01             	cmp    $0x1,%ecx
+f0105c19:	77 e0                	ja     f0105bfb <sched_yield+0x109>
+		     envs[i].env_status == ENV_RUNNING))
+			break;
+	}
+	if (i == NENV) {
+f0105c1b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+f0105c21:	74 2f                	je     f0105c52 <sched_yield+0x160>
+		while (1)
+			monitor(NULL);
+	}
+
+	// Run this CPU's idle environment when nothing else is runnable.
+	idle = &envs[cpunum()];
+f0105c23:	e8 d1 26 00 00       	call   f01082f9 <cpunum>
+f0105c28:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0105c2e:	01 c3                	add    %eax,%ebx
+	if (!(idle->env_status == ENV_RUNNABLE || idle->env_status == ENV_RUNNING))
+f0105c30:	8b 43 54             	mov    0x54(%ebx),%eax
+f0105c33:	83 e8 02             	sub    $0x2,%eax
+f0105c36:	83 f8 01             	cmp    $0x1,%eax
+f0105c39:	76 36                	jbe    f0105c71 <sched_yield+0x17f>
+		panic("CPU %d: No idle environment!", cpunum());
+f0105c3b:	e8 b9 26 00 00       	call   f01082f9 <cpunum>
+f0105c40:	50                   	push   %eax
+f0105c41:	68 10 c8 10 f0       	push   $0xf010c810
+f0105c46:	6a 46                	push   $0x46
+f0105c48:	68 2d c8 10 f0       	push   $0xf010c82d
+f0105c4d:	e8 ee a3 ff ff       	call   f0100040 <_panic>
+		cprintf("No more runnable environments!\n");
+f0105c52:	83 ec 0c             	sub    $0xc,%esp
+f0105c55:	68 f0 c7 10 f0       	push   $0xf010c7f0
+f0105c5a:	e8 8d ea ff ff       	call   f01046ec <cprintf>
+f0105c5f:	83 c4 10             	add    $0x10,%esp
+			monitor(NULL);
+f0105c62:	83 ec 0c             	sub    $0xc,%esp
+f0105c65:	6a 00                	push   $0x0
+f0105c67:	e8 a4 b2 ff ff       	call   f0100f10 <monitor>
+f0105c6c:	83 c4 10             	add    $0x10,%esp
+f0105c6f:	eb f1                	jmp    f0105c62 <sched_yield+0x170>
+	env_run(idle);
+f0105c71:	83 ec 0c             	sub    $0xc,%esp
+f0105c74:	53                   	push   %ebx
+f0105c75:	e8 7b e7 ff ff       	call   f01043f5 <env_run>
+
+f0105c7a <sys_page_alloc>:
+//	-E_INVAL if perm is inappropriate (see above).
+//	-E_NO_MEM if there's no memory to allocate the new page,
+//		or to allocate any necessary page tables.
+static int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+f0105c7a:	55                   	push   %ebp
+f0105c7b:	89 e5                	mov    %esp,%ebp
+f0105c7d:	57                   	push   %edi
+f0105c7e:	56                   	push   %esi
+f0105c7f:	53                   	push   %ebx
+f0105c80:	83 ec 2c             	sub    $0x2c,%esp
+
+	// LAB 4: Your code here.
+	int ret;
+	struct Env* env;
+	struct Page *pp;
+	if((uintptr_t)va >= UTOP )
+f0105c83:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0105c89:	77 7b                	ja     f0105d06 <sys_page_alloc+0x8c>
+f0105c8b:	89 d6                	mov    %edx,%esi
+f0105c8d:	89 cf                	mov    %ecx,%edi
+		return -E_INVAL;
+	if((uintptr_t)va % PGSIZE)
+f0105c8f:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0105c95:	75 76                	jne    f0105d0d <sys_page_alloc+0x93>
+		return -E_INVAL;
+	if((perm & ~PTE_SYSCALL) || !(perm & PTE_P) || !(perm & PTE_U))
+f0105c97:	89 ca                	mov    %ecx,%edx
+f0105c99:	81 e2 fd f1 ff ff    	and    $0xfffff1fd,%edx
+f0105c9f:	83 fa 05             	cmp    $0x5,%edx
+f0105ca2:	75 70                	jne    f0105d14 <sys_page_alloc+0x9a>
+		return -E_INVAL;
+	if((ret = envid2env(envid, &env, 1)) < 0)
+f0105ca4:	83 ec 04             	sub    $0x4,%esp
+f0105ca7:	6a 01                	push   $0x1
+f0105ca9:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0105cac:	52                   	push   %edx
+f0105cad:	50                   	push   %eax
+f0105cae:	e8 90 e0 ff ff       	call   f0103d43 <envid2env>
+f0105cb3:	89 c3                	mov    %eax,%ebx
+f0105cb5:	83 c4 10             	add    $0x10,%esp
+f0105cb8:	85 c0                	test   %eax,%eax
+f0105cba:	78 30                	js     f0105cec <sys_page_alloc+0x72>
+		return ret;
+	// The one allocation user memory pressure goes through, and it
+	// holds no other page yet, so it may reclaim.
+	if((pp = page_alloc(ALLOC_ZERO | ALLOC_RECLAIM)) == NULL)
+f0105cbc:	83 ec 0c             	sub    $0xc,%esp
+f0105cbf:	6a 03                	push   $0x3
+f0105cc1:	e8 c5 bb ff ff       	call   f010188b <page_alloc>
+f0105cc6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0105cc9:	83 c4 10             	add    $0x10,%esp
+f0105ccc:	85 c0                	test   %eax,%eax
+f0105cce:	74 4b                	je     f0105d1b <sys_page_alloc+0xa1>
+		return -E_NO_MEM;
+	if((ret = page_insert(env->env_pgdir, pp, va, perm)) < 0) {
+f0105cd0:	57                   	push   %edi
+f0105cd1:	56                   	push   %esi
+f0105cd2:	50                   	push   %eax
+f0105cd3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105cd6:	ff 70 70             	push   0x70(%eax)
+f0105cd9:	e8 ad c3 ff ff       	call   f010208b <page_insert>
+f0105cde:	89 c3                	mov    %eax,%ebx
+f0105ce0:	83 c4 10             	add    $0x10,%esp
+f0105ce3:	85 c0                	test   %eax,%eax
+f0105ce5:	78 0f                	js     f0105cf6 <sys_page_alloc+0x7c>
+		page_free(pp);
+		return ret;
+	}
+	return 0;
+f0105ce7:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+//	panic("sys_page_alloc not implemented");
+}
+f0105cec:	89 d8                	mov    %ebx,%eax
+f0105cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105cf1:	5b                   	pop    %ebx
+f0105cf2:	5e                   	pop    %esi
+f0105cf3:	5f                   	pop    %edi
+f0105cf4:	5d                   	pop    %ebp
+f0105cf5:	c3                   	ret
+		page_free(pp);
+f0105cf6:	83 ec 0c             	sub    $0xc,%esp
+f0105cf9:	ff 75 d4             	push   -0x2c(%ebp)
+f0105cfc:	e8 33 b9 ff ff       	call   f0101634 <page_free>
+		return ret;
+f0105d01:	83 c4 10             	add    $0x10,%esp
+f0105d04:	eb e6                	jmp    f0105cec <sys_page_alloc+0x72>
+		return -E_INVAL;
+f0105d06:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105d0b:	eb df                	jmp    f0105cec <sys_page_alloc+0x72>
+		return -E_INVAL;
+f0105d0d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105d12:	eb d8                	jmp    f0105cec <sys_page_alloc+0x72>
+		return -E_INVAL;
+f0105d14:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105d19:	eb d1                	jmp    f0105cec <sys_page_alloc+0x72>
+		return -E_NO_MEM;
+f0105d1b:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0105d20:	eb ca                	jmp    f0105cec <sys_page_alloc+0x72>
+
+f0105d22 <sys_page_map>:
+//		address space.
+//	-E_NO_MEM if there's no memory to allocate any necessary page tables.
+static int
+sys_page_map(envid_t srcenvid, void *srcva,
+	     envid_t dstenvid, void *dstva, int perm)
+{
+f0105d22:	55                   	push   %ebp
+f0105d23:	89 e5                	mov    %esp,%ebp
+f0105d25:	57                   	push   %edi
+f0105d26:	56                   	push   %esi
+f0105d27:	53                   	push   %ebx
+f0105d28:	83 ec 1c             	sub    $0x1c,%esp
+f0105d2b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	// LAB 4: Your code here.
+	int ret;
+	pte_t *src_pte;
+	struct Page *pp;
+	struct Env *srcenv, *dstenv;
+	if((uintptr_t)srcva >= UTOP || (uintptr_t)dstva >= UTOP)
+f0105d2e:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0105d34:	0f 87 a9 00 00 00    	ja     f0105de3 <sys_page_map+0xc1>
+f0105d3a:	89 d3                	mov    %edx,%ebx
+f0105d3c:	89 ce                	mov    %ecx,%esi
+f0105d3e:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0105d44:	0f 87 99 00 00 00    	ja     f0105de3 <sys_page_map+0xc1>
+		return -E_INVAL;
+	if((uintptr_t)srcva % PGSIZE || (uintptr_t)dstva % PGSIZE)
+f0105d4a:	09 fa                	or     %edi,%edx
+f0105d4c:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0105d52:	0f 85 92 00 00 00    	jne    f0105dea <sys_page_map+0xc8>
+		return -E_INVAL;
+	if((perm & ~PTE_SYSCALL) || !(perm & PTE_P) || !(perm & PTE_U))
+f0105d58:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105d5b:	81 e2 fd f1 ff ff    	and    $0xfffff1fd,%edx
+f0105d61:	83 fa 05             	cmp    $0x5,%edx
+f0105d64:	0f 85 87 00 00 00    	jne    f0105df1 <sys_page_map+0xcf>
+		return -E_INVAL;
+	if((ret = envid2env(srcenvid, &srcenv, 1)) < 0) 
+f0105d6a:	83 ec 04             	sub    $0x4,%esp
+f0105d6d:	6a 01                	push   $0x1
+f0105d6f:	8d 55 e0             	lea    -0x20(%ebp),%edx
+f0105d72:	52                   	push   %edx
+f0105d73:	50                   	push   %eax
+f0105d74:	e8 ca df ff ff       	call   f0103d43 <envid2env>
+f0105d79:	83 c4 10             	add    $0x10,%esp
+f0105d7c:	85 c0                	test   %eax,%eax
+f0105d7e:	78 5b                	js     f0105ddb <sys_page_map+0xb9>
+		return ret;
+	if((ret = envid2env(dstenvid, &dstenv, 1)) < 0) 
+f0105d80:	83 ec 04             	sub    $0x4,%esp
+f0105d83:	6a 01                	push   $0x1
+f0105d85:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f0105d88:	50                   	push   %eax
+f0105d89:	56                   	push   %esi
+f0105d8a:	e8 b4 df ff ff       	call   f0103d43 <envid2env>
+f0105d8f:	83 c4 10             	add    $0x10,%esp
+f0105d92:	85 c0                	test   %eax,%eax
+f0105d94:	78 45                	js     f0105ddb <sys_page_map+0xb9>
+		return ret;
+	if((pp = page_lookup(srcenv->env_pgdir, srcva, &src_pte)) == NULL)
+f0105d96:	83 ec 04             	sub    $0x4,%esp
+f0105d99:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105d9c:	50                   	push   %eax
+f0105d9d:	53                   	push   %ebx
+f0105d9e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105da1:	ff 70 70             	push   0x70(%eax)
+f0105da4:	e8 e6 bc ff ff       	call   f0101a8f <page_lookup>
+f0105da9:	83 c4 10             	add    $0x10,%esp
+f0105dac:	85 c0                	test   %eax,%eax
+f0105dae:	74 48                	je     f0105df8 <sys_page_map+0xd6>
+		return -E_INVAL;
+	if((perm & PTE_W) && !(*src_pte & PTE_W))
+f0105db0:	f6 45 0c 02          	testb  $0x2,0xc(%ebp)
+f0105db4:	74 08                	je     f0105dbe <sys_page_map+0x9c>
+f0105db6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105db9:	f6 02 02             	testb  $0x2,(%edx)
+f0105dbc:	74 41                	je     f0105dff <sys_page_map+0xdd>
+		return -E_INVAL;
+	if((ret = page_insert(dstenv->env_pgdir, pp, dstva, perm)) < 0)
+f0105dbe:	ff 75 0c             	push   0xc(%ebp)
+f0105dc1:	57                   	push   %edi
+f0105dc2:	50                   	push   %eax
+f0105dc3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0105dc6:	ff 70 70             	push   0x70(%eax)
+f0105dc9:	e8 bd c2 ff ff       	call   f010208b <page_insert>
+f0105dce:	85 c0                	test   %eax,%eax
+f0105dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105dd5:	0f 4f c2             	cmovg  %edx,%eax
+f0105dd8:	83 c4 10             	add    $0x10,%esp
+		return ret;
+	return 0;
+//	panic("sys_page_map not implemented");
+}
+f0105ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105dde:	5b                   	pop    %ebx
+f0105ddf:	5e                   	pop    %esi
+f0105de0:	5f                   	pop    %edi
+f0105de1:	5d                   	pop    %ebp
+f0105de2:	c3                   	ret
+		return -E_INVAL;
+f0105de3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105de8:	eb f1                	jmp    f0105ddb <sys_page_map+0xb9>
+		return -E_INVAL;
+f0105dea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105def:	eb ea                	jmp    f0105ddb <sys_page_map+0xb9>
+		return -E_INVAL;
+f0105df1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105df6:	eb e3                	jmp    f0105ddb <sys_page_map+0xb9>
+		return -E_INVAL;
+f0105df8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105dfd:	eb dc                	jmp    f0105ddb <sys_page_map+0xb9>
+		return -E_INVAL;
+f0105dff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105e04:	eb d5                	jmp    f0105ddb <sys_page_map+0xb9>
+
+f0105e06 <sys_page_unmap>:
+	// Hint: This function is a wrapper around page_remove().
+
+	// LAB 4: Your code here.
+	int ret;
+	struct Env *env;
+	if((uintptr_t)va >= UTOP)
+f0105e06:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0105e0c:	77 59                	ja     f0105e67 <sys_page_unmap+0x61>
+{
+f0105e0e:	55                   	push   %ebp
+f0105e0f:	89 e5                	mov    %esp,%ebp
+f0105e11:	53                   	push   %ebx
+f0105e12:	83 ec 14             	sub    $0x14,%esp
+f0105e15:	89 d3                	mov    %edx,%ebx
+		return -E_INVAL;
+	if((uintptr_t)va % PGSIZE)
+f0105e17:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0105e1d:	75 4e                	jne    f0105e6d <sys_page_unmap+0x67>
+		return -E_INVAL;
+	if((ret = envid2env(envid, &env, 1)) < 0)
+f0105e1f:	83 ec 04             	sub    $0x4,%esp
+f0105e22:	6a 01                	push   $0x1
+f0105e24:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f0105e27:	52                   	push   %edx
+f0105e28:	50                   	push   %eax
+f0105e29:	e8 15 df ff ff       	call   f0103d43 <envid2env>
+f0105e2e:	83 c4 10             	add    $0x10,%esp
+f0105e31:	85 c0                	test   %eax,%eax
+f0105e33:	78 2d                	js     f0105e62 <sys_page_unmap+0x5c>
+		return ret;
+	if(pgdir_unshare(env->env_pgdir, va) < 0)
+f0105e35:	83 ec 08             	sub    $0x8,%esp
+f0105e38:	53                   	push   %ebx
+f0105e39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105e3c:	ff 70 70             	push   0x70(%eax)
+f0105e3f:	e8 a8 bc ff ff       	call   f0101aec <pgdir_unshare>
+f0105e44:	83 c4 10             	add    $0x10,%esp
+f0105e47:	85 c0                	test   %eax,%eax
+f0105e49:	78 29                	js     f0105e74 <sys_page_unmap+0x6e>
+		return -E_NO_MEM;
+	page_remove(env->env_pgdir, va);
+f0105e4b:	83 ec 08             	sub    $0x8,%esp
+f0105e4e:	53                   	push   %ebx
+f0105e4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105e52:	ff 70 70             	push   0x70(%eax)
+f0105e55:	e8 be c0 ff ff       	call   f0101f18 <page_remove>
+	return 0;
+f0105e5a:	83 c4 10             	add    $0x10,%esp
+f0105e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+//	panic("sys_page_unmap not implemented");
+}
+f0105e62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105e65:	c9                   	leave
+f0105e66:	c3                   	ret
+		return -E_INVAL;
+f0105e67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f0105e6c:	c3                   	ret
+		return -E_INVAL;
+f0105e6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105e72:	eb ee                	jmp    f0105e62 <sys_page_unmap+0x5c>
+		return -E_NO_MEM;
+f0105e74:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0105e79:	eb e7                	jmp    f0105e62 <sys_page_unmap+0x5c>
+
+f0105e7b <sys_page_batch>:
+//	-E_FAULT if the array is not readable by the caller.
+//	the error of the first failing entry, or -E_INVAL for an
+//		unknown po_op.
+static int
+sys_page_batch(struct PageOp *ops, int n)
+{
+f0105e7b:	55                   	push   %ebp
+f0105e7c:	89 e5                	mov    %esp,%ebp
+f0105e7e:	57                   	push   %edi
+f0105e7f:	56                   	push   %esi
+f0105e80:	53                   	push   %ebx
+f0105e81:	81 ec bc 01 00 00    	sub    $0x1bc,%esp
+f0105e87:	89 85 48 fe ff ff    	mov    %eax,-0x1b8(%ebp)
+f0105e8d:	89 d3                	mov    %edx,%ebx
+f0105e8f:	89 95 4c fe ff ff    	mov    %edx,-0x1b4(%ebp)
+	struct PageOp chunk[16], *po;
+	int i, j, m, ret;
+
+	curenv->env_batch_done = 0;
+f0105e95:	e8 5f 24 00 00       	call   f01082f9 <cpunum>
+f0105e9a:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105ea0:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0105ea6:	c7 40 74 00 00 00 00 	movl   $0x0,0x74(%eax)
+	if(n < 0 || n > PAGEOP_MAX)
+f0105ead:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+f0105eb3:	0f 87 06 03 00 00    	ja     f01061bf <sys_page_batch+0x344>
+		return -E_INVAL;
+	for(i = 0; i < n; i += m) {
+f0105eb9:	85 db                	test   %ebx,%ebx
+f0105ebb:	0f 8e 05 03 00 00    	jle    f01061c6 <sys_page_batch+0x34b>
+f0105ec1:	c7 85 50 fe ff ff 00 	movl   $0x0,-0x1b0(%ebp)
+f0105ec8:	00 00 00 
+		m = MIN(n - i, (int) (sizeof(chunk) / sizeof(chunk[0])));
+f0105ecb:	8b b5 4c fe ff ff    	mov    -0x1b4(%ebp),%esi
+f0105ed1:	8b 8d 50 fe ff ff    	mov    -0x1b0(%ebp),%ecx
+f0105ed7:	29 ce                	sub    %ecx,%esi
+f0105ed9:	b8 10 00 00 00       	mov    $0x10,%eax
+f0105ede:	39 c6                	cmp    %eax,%esi
+f0105ee0:	0f 4e c6             	cmovle %esi,%eax
+f0105ee3:	89 85 54 fe ff ff    	mov    %eax,-0x1ac(%ebp)
+		if(user_mem_check(curenv, ops + i, m * sizeof(struct PageOp), PTE_U) < 0)
+f0105ee9:	8d 1c 40             	lea    (%eax,%eax,2),%ebx
+f0105eec:	c1 e3 03             	shl    $0x3,%ebx
+f0105eef:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+f0105ef2:	8b 8d 48 fe ff ff    	mov    -0x1b8(%ebp),%ecx
+f0105ef8:	8d 3c c1             	lea    (%ecx,%eax,8),%edi
+f0105efb:	e8 f9 23 00 00       	call   f01082f9 <cpunum>
+f0105f00:	6a 04                	push   $0x4
+f0105f02:	53                   	push   %ebx
+f0105f03:	57                   	push   %edi
+f0105f04:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105f0a:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0105f10:	e8 1b dc ff ff       	call   f0103b30 <user_mem_check>
+f0105f15:	83 c4 10             	add    $0x10,%esp
+f0105f18:	85 c0                	test   %eax,%eax
+f0105f1a:	0f 88 ad 02 00 00    	js     f01061cd <sys_page_batch+0x352>
+			return -E_FAULT;
+		memmove(chunk, ops + i, m * sizeof(struct PageOp));
+f0105f20:	83 ec 04             	sub    $0x4,%esp
+f0105f23:	53                   	push   %ebx
+f0105f24:	57                   	push   %edi
+f0105f25:	8d 85 68 fe ff ff    	lea    -0x198(%ebp),%eax
+f0105f2b:	50                   	push   %eax
+f0105f2c:	e8 a2 1d 00 00       	call   f0107cd3 <memmove>
+		for(j = 0; j < m; j++) {
+f0105f31:	83 c4 10             	add    $0x10,%esp
+f0105f34:	85 f6                	test   %esi,%esi
+f0105f36:	0f 8e 5e 02 00 00    	jle    f010619a <sys_page_batch+0x31f>
+f0105f3c:	8d bd 68 fe ff ff    	lea    -0x198(%ebp),%edi
+f0105f42:	be 00 00 00 00       	mov    $0x0,%esi
+f0105f47:	eb 3d                	jmp    f0105f86 <sys_page_batch+0x10b>
+			po = &chunk[j];
+			switch(po->po_op) {
+			case PAGEOP_ALLOC:
+				ret = sys_page_alloc(po->po_dstenv, po->po_dstva, po->po_perm);
+f0105f49:	8b 4f 14             	mov    0x14(%edi),%ecx
+f0105f4c:	8b 57 10             	mov    0x10(%edi),%edx
+f0105f4f:	8b 47 0c             	mov    0xc(%edi),%eax
+f0105f52:	e8 23 fd ff ff       	call   f0105c7a <sys_page_alloc>
+				break;
+			default:
+				ret = -E_INVAL;
+				break;
+			}
+			if(ret < 0)
+f0105f57:	85 c0                	test   %eax,%eax
+f0105f59:	0f 88 73 02 00 00    	js     f01061d2 <sys_page_batch+0x357>
+				return ret;
+			curenv->env_batch_done++;
+f0105f5f:	e8 95 23 00 00       	call   f01082f9 <cpunum>
+f0105f64:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0105f6a:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0105f70:	83 40 74 01          	addl   $0x1,0x74(%eax)
+		for(j = 0; j < m; j++) {
+f0105f74:	83 c6 01             	add    $0x1,%esi
+f0105f77:	83 c7 18             	add    $0x18,%edi
+f0105f7a:	39 b5 54 fe ff ff    	cmp    %esi,-0x1ac(%ebp)
+f0105f80:	0f 8e 14 02 00 00    	jle    f010619a <sys_page_batch+0x31f>
+			switch(po->po_op) {
+f0105f86:	83 3f 05             	cmpl   $0x5,(%edi)
+f0105f89:	0f 87 4b 02 00 00    	ja     f01061da <sys_page_batch+0x35f>
+f0105f8f:	8b 17                	mov    (%edi),%edx
+f0105f91:	ff 24 95 3c c8 10 f0 	jmp    *-0xfef37c4(,%edx,4)
+				ret = sys_page_map(po->po_srcenv, po->po_srcva,
+f0105f98:	8b 4f 0c             	mov    0xc(%edi),%ecx
+f0105f9b:	8b 57 08             	mov    0x8(%edi),%edx
+f0105f9e:	8b 5f 04             	mov    0x4(%edi),%ebx
+f0105fa1:	83 ec 08             	sub    $0x8,%esp
+f0105fa4:	ff 77 14             	push   0x14(%edi)
+f0105fa7:	ff 77 10             	push   0x10(%edi)
+f0105faa:	89 d8                	mov    %ebx,%eax
+f0105fac:	e8 71 fd ff ff       	call   f0105d22 <sys_page_map>
+				break;
+f0105fb1:	83 c4 10             	add    $0x10,%esp
+f0105fb4:	eb a1                	jmp    f0105f57 <sys_page_batch+0xdc>
+				ret = sys_page_unmap(po->po_dstenv, po->po_dstva);
+f0105fb6:	8b 57 10             	mov    0x10(%edi),%edx
+f0105fb9:	8b 47 0c             	mov    0xc(%edi),%eax
+f0105fbc:	e8 45 fe ff ff       	call   f0105e06 <sys_page_unmap>
+				break;
+f0105fc1:	eb 94                	jmp    f0105f57 <sys_page_batch+0xdc>
+				ret = sys_page_protect(po->po_dstenv, po->po_dstva, po->po_perm);
+f0105fc3:	8b 4f 14             	mov    0x14(%edi),%ecx
+f0105fc6:	8b 5f 10             	mov    0x10(%edi),%ebx
+f0105fc9:	8b 57 0c             	mov    0xc(%edi),%edx
+	if((uintptr_t)va >= UTOP || (uintptr_t)va % PGSIZE)
+f0105fcc:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0105fd2:	0f 87 db 00 00 00    	ja     f01060b3 <sys_page_batch+0x238>
+f0105fd8:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0105fde:	0f 85 d9 00 00 00    	jne    f01060bd <sys_page_batch+0x242>
+	if((perm & ~PTE_SYSCALL) || !(perm & PTE_P) || !(perm & PTE_U))
+f0105fe4:	89 8d 44 fe ff ff    	mov    %ecx,-0x1bc(%ebp)
+f0105fea:	89 c8                	mov    %ecx,%eax
+f0105fec:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0105ff1:	83 f8 05             	cmp    $0x5,%eax
+f0105ff4:	0f 85 cd 00 00 00    	jne    f01060c7 <sys_page_batch+0x24c>
+	if((ret = envid2env(envid, &env, 1)) < 0)
+f0105ffa:	83 ec 04             	sub    $0x4,%esp
+f0105ffd:	6a 01                	push   $0x1
+f0105fff:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+f0106005:	50                   	push   %eax
+f0106006:	52                   	push   %edx
+f0106007:	e8 37 dd ff ff       	call   f0103d43 <envid2env>
+f010600c:	83 c4 10             	add    $0x10,%esp
+f010600f:	85 c0                	test   %eax,%eax
+f0106011:	0f 88 40 ff ff ff    	js     f0105f57 <sys_page_batch+0xdc>
+	if((pte = pgdir_walk(env->env_pgdir, va, 0)) == NULL || !(*pte & PTE_P))
+f0106017:	83 ec 04             	sub    $0x4,%esp
+f010601a:	6a 00                	push   $0x0
+f010601c:	53                   	push   %ebx
+f010601d:	8b 85 64 fe ff ff    	mov    -0x19c(%ebp),%eax
+f0106023:	ff 70 70             	push   0x70(%eax)
+f0106026:	e8 0a b9 ff ff       	call   f0101935 <pgdir_walk>
+f010602b:	83 c4 10             	add    $0x10,%esp
+f010602e:	85 c0                	test   %eax,%eax
+f0106030:	0f 84 9b 00 00 00    	je     f01060d1 <sys_page_batch+0x256>
+f0106036:	8b 00                	mov    (%eax),%eax
+f0106038:	a8 01                	test   $0x1,%al
+f010603a:	0f 84 9b 00 00 00    	je     f01060db <sys_page_batch+0x260>
+	if((perm & PTE_W) && !(*pte & PTE_W))
+f0106040:	f6 85 44 fe ff ff 02 	testb  $0x2,-0x1bc(%ebp)
+f0106047:	74 08                	je     f0106051 <sys_page_batch+0x1d6>
+f0106049:	a8 02                	test   $0x2,%al
+f010604b:	0f 84 94 00 00 00    	je     f01060e5 <sys_page_batch+0x26a>
+	if(pgdir_unshare(env->env_pgdir, va) < 0)
+f0106051:	83 ec 08             	sub    $0x8,%esp
+f0106054:	53                   	push   %ebx
+f0106055:	8b 85 64 fe ff ff    	mov    -0x19c(%ebp),%eax
+f010605b:	ff 70 70             	push   0x70(%eax)
+f010605e:	e8 89 ba ff ff       	call   f0101aec <pgdir_unshare>
+f0106063:	83 c4 10             	add    $0x10,%esp
+f0106066:	85 c0                	test   %eax,%eax
+f0106068:	0f 88 81 00 00 00    	js     f01060ef <sys_page_batch+0x274>
+	pte = pgdir_walk(env->env_pgdir, va, 0);
+f010606e:	83 ec 04             	sub    $0x4,%esp
+f0106071:	6a 00                	push   $0x0
+f0106073:	53                   	push   %ebx
+f0106074:	8b 85 64 fe ff ff    	mov    -0x19c(%ebp),%eax
+f010607a:	ff 70 70             	push   0x70(%eax)
+f010607d:	e8 b3 b8 ff ff       	call   f0101935 <pgdir_walk>
+	*pte = PTE_ADDR(*pte) | perm;
+f0106082:	8b 10                	mov    (%eax),%edx
+f0106084:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010608a:	8b 8d 44 fe ff ff    	mov    -0x1bc(%ebp),%ecx
+f0106090:	09 ca                	or     %ecx,%edx
+f0106092:	89 10                	mov    %edx,(%eax)
+	tlb_invalidate(env->env_pgdir, va);
+f0106094:	83 c4 08             	add    $0x8,%esp
+f0106097:	53                   	push   %ebx
+f0106098:	8b 85 64 fe ff ff    	mov    -0x19c(%ebp),%eax
+f010609e:	ff 70 70             	push   0x70(%eax)
+f01060a1:	e8 79 27 00 00       	call   f010881f <tlb_invalidate>
+	return 0;
+f01060a6:	83 c4 10             	add    $0x10,%esp
+f01060a9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01060ae:	e9 a4 fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+		return -E_INVAL;
+f01060b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01060b8:	e9 9a fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+f01060bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01060c2:	e9 90 fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+		return -E_INVAL;
+f01060c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01060cc:	e9 86 fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+		return -E_INVAL;
+f01060d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01060d6:	e9 7c fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+f01060db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01060e0:	e9 72 fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+		return -E_INVAL;
+f01060e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01060ea:	e9 68 fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+		return -E_NO_MEM;
+f01060ef:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+				break;
+f01060f4:	e9 5e fe ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+				ret = sys_page_sharept(po->po_srcenv, po->po_srcva,
+f01060f9:	8b 4f 14             	mov    0x14(%edi),%ecx
+f01060fc:	89 8d 40 fe ff ff    	mov    %ecx,-0x1c0(%ebp)
+f0106102:	8b 4f 0c             	mov    0xc(%edi),%ecx
+f0106105:	89 8d 44 fe ff ff    	mov    %ecx,-0x1bc(%ebp)
+f010610b:	8b 5f 08             	mov    0x8(%edi),%ebx
+f010610e:	8b 47 04             	mov    0x4(%edi),%eax
+	if((uintptr_t)va >= UTOP || (uintptr_t)va % PTSIZE)
+f0106111:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0106117:	77 6d                	ja     f0106186 <sys_page_batch+0x30b>
+f0106119:	f7 c3 ff ff 3f 00    	test   $0x3fffff,%ebx
+f010611f:	75 6f                	jne    f0106190 <sys_page_batch+0x315>
+	if((ret = envid2env(srcenvid, &srcenv, 1)) < 0)
+f0106121:	83 ec 04             	sub    $0x4,%esp
+f0106124:	6a 01                	push   $0x1
+f0106126:	8d 95 60 fe ff ff    	lea    -0x1a0(%ebp),%edx
+f010612c:	52                   	push   %edx
+f010612d:	50                   	push   %eax
+f010612e:	e8 10 dc ff ff       	call   f0103d43 <envid2env>
+f0106133:	83 c4 10             	add    $0x10,%esp
+f0106136:	85 c0                	test   %eax,%eax
+f0106138:	0f 88 19 fe ff ff    	js     f0105f57 <sys_page_batch+0xdc>
+	if((ret = envid2env(dstenvid, &dstenv, 1)) < 0)
+f010613e:	83 ec 04             	sub    $0x4,%esp
+f0106141:	6a 01                	push   $0x1
+f0106143:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+f0106149:	50                   	push   %eax
+f010614a:	ff b5 44 fe ff ff    	push   -0x1bc(%ebp)
+f0106150:	e8 ee db ff ff       	call   f0103d43 <envid2env>
+f0106155:	83 c4 10             	add    $0x10,%esp
+f0106158:	85 c0                	test   %eax,%eax
+f010615a:	0f 88 f7 fd ff ff    	js     f0105f57 <sys_page_batch+0xdc>
+	return pgdir_share(srcenv->env_pgdir, dstenv->env_pgdir, va, perm);
+f0106160:	ff b5 40 fe ff ff    	push   -0x1c0(%ebp)
+f0106166:	53                   	push   %ebx
+f0106167:	8b 85 64 fe ff ff    	mov    -0x19c(%ebp),%eax
+f010616d:	ff 70 70             	push   0x70(%eax)
+f0106170:	8b 85 60 fe ff ff    	mov    -0x1a0(%ebp),%eax
+f0106176:	ff 70 70             	push   0x70(%eax)
+f0106179:	e8 d8 bb ff ff       	call   f0101d56 <pgdir_share>
+f010617e:	83 c4 10             	add    $0x10,%esp
+f0106181:	e9 d1 fd ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+		return -E_INVAL;
+f0106186:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010618b:	e9 c7 fd ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+f0106190:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+				break;
+f0106195:	e9 bd fd ff ff       	jmp    f0105f57 <sys_page_batch+0xdc>
+	for(i = 0; i < n; i += m) {
+f010619a:	8b b5 54 fe ff ff    	mov    -0x1ac(%ebp),%esi
+f01061a0:	01 b5 50 fe ff ff    	add    %esi,-0x1b0(%ebp)
+f01061a6:	8b 85 50 fe ff ff    	mov    -0x1b0(%ebp),%eax
+f01061ac:	39 85 4c fe ff ff    	cmp    %eax,-0x1b4(%ebp)
+f01061b2:	0f 8f 13 fd ff ff    	jg     f0105ecb <sys_page_batch+0x50>
+		}
+	}
+	return 0;
+f01061b8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01061bd:	eb 13                	jmp    f01061d2 <sys_page_batch+0x357>
+		return -E_INVAL;
+f01061bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01061c4:	eb 0c                	jmp    f01061d2 <sys_page_batch+0x357>
+	return 0;
+f01061c6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01061cb:	eb 05                	jmp    f01061d2 <sys_page_batch+0x357>
+			return -E_FAULT;
+f01061cd:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f01061d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01061d5:	5b                   	pop    %ebx
+f01061d6:	5e                   	pop    %esi
+f01061d7:	5f                   	pop    %edi
+f01061d8:	5d                   	pop    %ebp
+f01061d9:	c3                   	ret
+			switch(po->po_op) {
+f01061da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01061df:	eb f1                	jmp    f01061d2 <sys_page_batch+0x357>
+
+f01061e1 <syscall>:
+	return 0;
+}
+// Dispatches to the correct kernel function, passing the arguments.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+f01061e1:	55                   	push   %ebp
+f01061e2:	89 e5                	mov    %esp,%ebp
+f01061e4:	57                   	push   %edi
+f01061e5:	56                   	push   %esi
+f01061e6:	53                   	push   %ebx
+f01061e7:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+f01061ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01061f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// Call the function corresponding to the 'syscallno' parameter.
+	// Return any appropriate return value.
+	// LAB 3: Your code here.
+	curenv->env_syscalls++;
+f01061f3:	e8 01 21 00 00       	call   f01082f9 <cpunum>
+f01061f8:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01061fe:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106204:	83 40 5c 01          	addl   $0x1,0x5c(%eax)
+	switch(syscallno) {
+f0106208:	83 fb 1d             	cmp    $0x1d,%ebx
+f010620b:	0f 87 db 0c 00 00    	ja     f0106eec <syscall+0xd0b>
+f0106211:	ff 24 9d 54 c8 10 f0 	jmp    *-0xfef37ac(,%ebx,4)
+	user_mem_assert(curenv, s, len, PTE_U);
+f0106218:	e8 dc 20 00 00       	call   f01082f9 <cpunum>
+f010621d:	6a 04                	push   $0x4
+f010621f:	ff 75 10             	push   0x10(%ebp)
+f0106222:	56                   	push   %esi
+f0106223:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106229:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f010622f:	e8 d9 d9 ff ff       	call   f0103c0d <user_mem_assert>
+	cprintf("%.*s", len, s);
+f0106234:	83 c4 0c             	add    $0xc,%esp
+f0106237:	56                   	push   %esi
+f0106238:	ff 75 10             	push   0x10(%ebp)
+f010623b:	68 cc c8 10 f0       	push   $0xf010c8cc
+f0106240:	e8 a7 e4 ff ff       	call   f01046ec <cprintf>
+}
+f0106245:	83 c4 10             	add    $0x10,%esp
+		case SYS_cputs: 
+			sys_cputs((char*)a1, a2);
+			return 0;
+f0106248:	b8 00 00 00 00       	mov    $0x0,%eax
+			 return sys_net_transmit_sg((void*)a1, a2, (void*)a3);
+		default:
+			return -E_INVAL;
+	}
+	panic("syscall not implemented");
+}
+f010624d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106250:	5b                   	pop    %ebx
+f0106251:	5e                   	pop    %esi
+f0106252:	5f                   	pop    %edi
+f0106253:	5d                   	pop    %ebp
+f0106254:	c3                   	ret
+	return cons_getc();
+f0106255:	e8 33 a4 ff ff       	call   f010068d <cons_getc>
+			return sys_cgetc();
+f010625a:	eb f1                	jmp    f010624d <syscall+0x6c>
+	return curenv->env_id;
+f010625c:	e8 98 20 00 00       	call   f01082f9 <cpunum>
+f0106261:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106267:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f010626d:	8b 40 48             	mov    0x48(%eax),%eax
+			return sys_getenvid();
+f0106270:	eb db                	jmp    f010624d <syscall+0x6c>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0106272:	83 ec 04             	sub    $0x4,%esp
+f0106275:	6a 01                	push   $0x1
+f0106277:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f010627d:	50                   	push   %eax
+f010627e:	56                   	push   %esi
+f010627f:	e8 bf da ff ff       	call   f0103d43 <envid2env>
+f0106284:	83 c4 10             	add    $0x10,%esp
+f0106287:	85 c0                	test   %eax,%eax
+f0106289:	78 c2                	js     f010624d <syscall+0x6c>
+	env_destroy(e);
+f010628b:	83 ec 0c             	sub    $0xc,%esp
+f010628e:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f0106294:	e8 b1 e0 ff ff       	call   f010434a <env_destroy>
+	return 0;
+f0106299:	83 c4 10             	add    $0x10,%esp
+f010629c:	b8 00 00 00 00       	mov    $0x0,%eax
+			return sys_env_destroy(a1);
+f01062a1:	eb aa                	jmp    f010624d <syscall+0x6c>
+	sched_yield();
+f01062a3:	e8 4a f8 ff ff       	call   f0105af2 <sched_yield>
+	if((ret = env_alloc(&child, curenv->env_id)) < 0)
+f01062a8:	e8 4c 20 00 00       	call   f01082f9 <cpunum>
+f01062ad:	83 ec 08             	sub    $0x8,%esp
+f01062b0:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01062b6:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01062bc:	ff 70 48             	push   0x48(%eax)
+f01062bf:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f01062c5:	50                   	push   %eax
+f01062c6:	e8 fa dd ff ff       	call   f01040c5 <env_alloc>
+f01062cb:	83 c4 10             	add    $0x10,%esp
+f01062ce:	85 c0                	test   %eax,%eax
+f01062d0:	0f 88 77 ff ff ff    	js     f010624d <syscall+0x6c>
+	child->env_status = ENV_NOT_RUNNABLE;
+f01062d6:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01062dc:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	memmove(&child->env_tf, &curenv->env_tf, sizeof(curenv->env_tf));
+f01062e3:	e8 11 20 00 00       	call   f01082f9 <cpunum>
+f01062e8:	83 ec 04             	sub    $0x4,%esp
+f01062eb:	6a 44                	push   $0x44
+f01062ed:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01062f3:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f01062f9:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f01062ff:	e8 cf 19 00 00       	call   f0107cd3 <memmove>
+	child->env_tf.tf_regs.reg_eax = 0;
+f0106304:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010630a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	child->env_netq = curenv->env_netq;
+f0106311:	e8 e3 1f 00 00       	call   f01082f9 <cpunum>
+f0106316:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010631c:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106322:	8b 50 6c             	mov    0x6c(%eax),%edx
+f0106325:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010632b:	89 50 6c             	mov    %edx,0x6c(%eax)
+	if (env_is_ns(curenv))
+f010632e:	e8 c6 1f 00 00       	call   f01082f9 <cpunum>
+f0106333:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+	return e->env_type == ENV_TYPE_NS || e->env_type == ENV_TYPE_NS_HELPER;
+f0106339:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f010633f:	8b 40 50             	mov    0x50(%eax),%eax
+f0106342:	83 e8 03             	sub    $0x3,%eax
+	if (env_is_ns(curenv))
+f0106345:	83 c4 10             	add    $0x10,%esp
+f0106348:	83 f8 01             	cmp    $0x1,%eax
+f010634b:	77 0d                	ja     f010635a <syscall+0x179>
+		child->env_type = ENV_TYPE_NS_HELPER;
+f010634d:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106353:	c7 40 50 04 00 00 00 	movl   $0x4,0x50(%eax)
+	return child->env_id;
+f010635a:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106360:	8b 40 48             	mov    0x48(%eax),%eax
+			 return sys_exofork();
+f0106363:	e9 e5 fe ff ff       	jmp    f010624d <syscall+0x6c>
+	if(status !=  ENV_RUNNABLE && status != ENV_NOT_RUNNABLE)
+f0106368:	8b 45 10             	mov    0x10(%ebp),%eax
+f010636b:	83 e8 02             	sub    $0x2,%eax
+f010636e:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0106373:	75 44                	jne    f01063b9 <syscall+0x1d8>
+	if((ret = envid2env(envid, &env, 1))< 0)
+f0106375:	83 ec 04             	sub    $0x4,%esp
+f0106378:	6a 01                	push   $0x1
+f010637a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106380:	50                   	push   %eax
+f0106381:	56                   	push   %esi
+f0106382:	e8 bc d9 ff ff       	call   f0103d43 <envid2env>
+f0106387:	83 c4 10             	add    $0x10,%esp
+f010638a:	85 c0                	test   %eax,%eax
+f010638c:	0f 88 bb fe ff ff    	js     f010624d <syscall+0x6c>
+	futex_cancel(env);
+f0106392:	83 ec 0c             	sub    $0xc,%esp
+f0106395:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f010639b:	e8 67 4a 00 00       	call   f010ae07 <futex_cancel>
+	env->env_status = status;	
+f01063a0:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01063a6:	8b 7d 10             	mov    0x10(%ebp),%edi
+f01063a9:	89 78 54             	mov    %edi,0x54(%eax)
+	return 0;
+f01063ac:	83 c4 10             	add    $0x10,%esp
+f01063af:	b8 00 00 00 00       	mov    $0x0,%eax
+f01063b4:	e9 94 fe ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f01063b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			 return sys_env_set_status(a1, a2);
+f01063be:	e9 8a fe ff ff       	jmp    f010624d <syscall+0x6c>
+			 return sys_page_alloc(a1, (void*)a2, a3);
+f01063c3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01063c6:	8b 55 10             	mov    0x10(%ebp),%edx
+f01063c9:	89 f0                	mov    %esi,%eax
+f01063cb:	e8 aa f8 ff ff       	call   f0105c7a <sys_page_alloc>
+f01063d0:	e9 78 fe ff ff       	jmp    f010624d <syscall+0x6c>
+			 return sys_page_map(a1, (void*)a2, a3, (void*)a4, a5);
+f01063d5:	83 ec 08             	sub    $0x8,%esp
+f01063d8:	ff 75 1c             	push   0x1c(%ebp)
+f01063db:	ff 75 18             	push   0x18(%ebp)
+f01063de:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01063e1:	8b 55 10             	mov    0x10(%ebp),%edx
+f01063e4:	89 f0                	mov    %esi,%eax
+f01063e6:	e8 37 f9 ff ff       	call   f0105d22 <sys_page_map>
+f01063eb:	83 c4 10             	add    $0x10,%esp
+f01063ee:	e9 5a fe ff ff       	jmp    f010624d <syscall+0x6c>
+			 return sys_page_unmap(a1, (void*)a2);
+f01063f3:	8b 55 10             	mov    0x10(%ebp),%edx
+f01063f6:	89 f0                	mov    %esi,%eax
+f01063f8:	e8 09 fa ff ff       	call   f0105e06 <sys_page_unmap>
+f01063fd:	e9 4b fe ff ff       	jmp    f010624d <syscall+0x6c>
+	if((ret = envid2env(envid, &env, 1)) < 0)
+f0106402:	83 ec 04             	sub    $0x4,%esp
+f0106405:	6a 01                	push   $0x1
+f0106407:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f010640d:	50                   	push   %eax
+f010640e:	56                   	push   %esi
+f010640f:	e8 2f d9 ff ff       	call   f0103d43 <envid2env>
+f0106414:	83 c4 10             	add    $0x10,%esp
+f0106417:	85 c0                	test   %eax,%eax
+f0106419:	0f 88 2e fe ff ff    	js     f010624d <syscall+0x6c>
+	env->env_pgfault_upcall = func;
+f010641f:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106425:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0106428:	89 78 78             	mov    %edi,0x78(%eax)
+	return 0;
+f010642b:	b8 00 00 00 00       	mov    $0x0,%eax
+			 return sys_env_set_pgfault_upcall(a1, (void*)a2);
+f0106430:	e9 18 fe ff ff       	jmp    f010624d <syscall+0x6c>
+	if((ret = envid2env(envid, &dstenv, 0)) < 0) 
+f0106435:	83 ec 04             	sub    $0x4,%esp
+f0106438:	6a 00                	push   $0x0
+f010643a:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+f0106440:	50                   	push   %eax
+f0106441:	56                   	push   %esi
+f0106442:	e8 fc d8 ff ff       	call   f0103d43 <envid2env>
+f0106447:	83 c4 10             	add    $0x10,%esp
+f010644a:	85 c0                	test   %eax,%eax
+f010644c:	0f 88 fb fd ff ff    	js     f010624d <syscall+0x6c>
+	if(dstenv->env_ipc_recving == 0)
+f0106452:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+f0106458:	83 b8 80 00 00 00 00 	cmpl   $0x0,0x80(%eax)
+f010645f:	0f 84 5a 02 00 00    	je     f01066bf <syscall+0x4de>
+	if((uintptr_t)srcva >= UTOP)
+f0106465:	81 7d 14 ff ff bf ee 	cmpl   $0xeebfffff,0x14(%ebp)
+f010646c:	0f 87 57 02 00 00    	ja     f01066c9 <syscall+0x4e8>
+	if(PGOFF((uintptr_t)srcva))
+f0106472:	f7 45 14 ff 0f 00 00 	testl  $0xfff,0x14(%ebp)
+f0106479:	0f 85 54 02 00 00    	jne    f01066d3 <syscall+0x4f2>
+		npages = 1;
+f010647f:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+f0106483:	ba 01 00 00 00       	mov    $0x1,%edx
+f0106488:	0f 45 55 1c          	cmovne 0x1c(%ebp),%edx
+f010648c:	89 d3                	mov    %edx,%ebx
+	dstenv->env_ipc_npages = 0;
+f010648e:	c7 80 98 00 00 00 00 	movl   $0x0,0x98(%eax)
+f0106495:	00 00 00 
+	if((uintptr_t)srcva != USTACKTOP) {
+f0106498:	81 7d 14 00 e0 bf ee 	cmpl   $0xeebfe000,0x14(%ebp)
+f010649f:	0f 84 c3 01 00 00    	je     f0106668 <syscall+0x487>
+		if((perm & ~PTE_SYSCALL) || !(perm & PTE_P) || !(perm & PTE_U))
+f01064a5:	8b 45 18             	mov    0x18(%ebp),%eax
+f01064a8:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f01064ad:	83 f8 05             	cmp    $0x5,%eax
+f01064b0:	0f 85 27 02 00 00    	jne    f01066dd <syscall+0x4fc>
+		if(npages < 0 || npages > IPC_MAXPAGES
+f01064b6:	83 fa 20             	cmp    $0x20,%edx
+f01064b9:	0f 87 28 02 00 00    	ja     f01066e7 <syscall+0x506>
+		   || (uintptr_t)srcva + npages * PGSIZE > UTOP)
+f01064bf:	89 d0                	mov    %edx,%eax
+f01064c1:	c1 e0 0c             	shl    $0xc,%eax
+f01064c4:	03 45 14             	add    0x14(%ebp),%eax
+f01064c7:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+f01064cc:	0f 87 1f 02 00 00    	ja     f01066f1 <syscall+0x510>
+		for(i = 0; i < npages; i++) {
+f01064d2:	85 d2                	test   %edx,%edx
+f01064d4:	7e 65                	jle    f010653b <syscall+0x35a>
+f01064d6:	8b 75 14             	mov    0x14(%ebp),%esi
+f01064d9:	bf 00 00 00 00       	mov    $0x0,%edi
+			if((perm & PTE_W) && !(*pte & PTE_W))
+f01064de:	8b 45 18             	mov    0x18(%ebp),%eax
+f01064e1:	83 e0 02             	and    $0x2,%eax
+f01064e4:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+f01064ea:	eb 0d                	jmp    f01064f9 <syscall+0x318>
+		for(i = 0; i < npages; i++) {
+f01064ec:	83 c7 01             	add    $0x1,%edi
+f01064ef:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01064f5:	39 fb                	cmp    %edi,%ebx
+f01064f7:	74 42                	je     f010653b <syscall+0x35a>
+			if((pte = pgdir_walk(curenv->env_pgdir, srcva + i * PGSIZE, 0)) == NULL)
+f01064f9:	e8 fb 1d 00 00       	call   f01082f9 <cpunum>
+f01064fe:	83 ec 04             	sub    $0x4,%esp
+f0106501:	6a 00                	push   $0x0
+f0106503:	56                   	push   %esi
+f0106504:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010650a:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106510:	ff 70 70             	push   0x70(%eax)
+f0106513:	e8 1d b4 ff ff       	call   f0101935 <pgdir_walk>
+f0106518:	83 c4 10             	add    $0x10,%esp
+f010651b:	85 c0                	test   %eax,%eax
+f010651d:	0f 84 d8 01 00 00    	je     f01066fb <syscall+0x51a>
+			if((perm & PTE_W) && !(*pte & PTE_W))
+f0106523:	83 bd d4 fe ff ff 00 	cmpl   $0x0,-0x12c(%ebp)
+f010652a:	74 c0                	je     f01064ec <syscall+0x30b>
+f010652c:	f6 00 02             	testb  $0x2,(%eax)
+f010652f:	75 bb                	jne    f01064ec <syscall+0x30b>
+				return -E_INVAL;
+f0106531:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106536:	e9 12 fd ff ff       	jmp    f010624d <syscall+0x6c>
+		dstva = (uintptr_t)dstenv->env_ipc_dstva;
+f010653b:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+f0106541:	8b b8 84 00 00 00    	mov    0x84(%eax),%edi
+f0106547:	89 bd d0 fe ff ff    	mov    %edi,-0x130(%ebp)
+		if(dstva != USTACKTOP) {
+f010654d:	81 ff 00 e0 bf ee    	cmp    $0xeebfe000,%edi
+f0106553:	0f 84 03 01 00 00    	je     f010665c <syscall+0x47b>
+			if(npages > dstenv->env_ipc_maxpages)
+f0106559:	3b 98 94 00 00 00    	cmp    0x94(%eax),%ebx
+f010655f:	0f 8f a0 01 00 00    	jg     f0106705 <syscall+0x524>
+			for(i = 0; i < npages; i++)
+f0106565:	85 db                	test   %ebx,%ebx
+f0106567:	0f 8e 95 00 00 00    	jle    f0106602 <syscall+0x421>
+f010656d:	be 00 00 00 00       	mov    $0x0,%esi
+f0106572:	eb 02                	jmp    f0106576 <syscall+0x395>
+f0106574:	89 c6                	mov    %eax,%esi
+				if ((pages[i] = page_lookup(curenv->env_pgdir, srcva + i * PGSIZE, NULL)) == NULL)
+f0106576:	e8 7e 1d 00 00       	call   f01082f9 <cpunum>
+f010657b:	83 ec 04             	sub    $0x4,%esp
+f010657e:	6a 00                	push   $0x0
+f0106580:	ff 75 14             	push   0x14(%ebp)
+f0106583:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106589:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f010658f:	ff 70 70             	push   0x70(%eax)
+f0106592:	e8 f8 b4 ff ff       	call   f0101a8f <page_lookup>
+f0106597:	89 84 b5 e8 fe ff ff 	mov    %eax,-0x118(%ebp,%esi,4)
+f010659e:	83 c4 10             	add    $0x10,%esp
+f01065a1:	85 c0                	test   %eax,%eax
+f01065a3:	0f 84 66 01 00 00    	je     f010670f <syscall+0x52e>
+			for(i = 0; i < npages; i++)
+f01065a9:	8d 46 01             	lea    0x1(%esi),%eax
+f01065ac:	81 45 14 00 10 00 00 	addl   $0x1000,0x14(%ebp)
+f01065b3:	39 c3                	cmp    %eax,%ebx
+f01065b5:	75 bd                	jne    f0106574 <syscall+0x393>
+		dstva = (uintptr_t)dstenv->env_ipc_dstva;
+f01065b7:	8b 85 d0 fe ff ff    	mov    -0x130(%ebp),%eax
+f01065bd:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+			for(i = 0; i < npages; i++)
+f01065c3:	bf 00 00 00 00       	mov    $0x0,%edi
+f01065c8:	eb 02                	jmp    f01065cc <syscall+0x3eb>
+f01065ca:	89 c7                	mov    %eax,%edi
+				if (page_insert(dstenv->env_pgdir, pages[i], (void*)(dstva + i * PGSIZE), perm) < 0) {
+f01065cc:	ff 75 18             	push   0x18(%ebp)
+f01065cf:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+f01065d5:	ff b4 bd e8 fe ff ff 	push   -0x118(%ebp,%edi,4)
+f01065dc:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+f01065e2:	ff 70 70             	push   0x70(%eax)
+f01065e5:	e8 a1 ba ff ff       	call   f010208b <page_insert>
+f01065ea:	83 c4 10             	add    $0x10,%esp
+f01065ed:	85 c0                	test   %eax,%eax
+f01065ef:	78 28                	js     f0106619 <syscall+0x438>
+			for(i = 0; i < npages; i++)
+f01065f1:	8d 47 01             	lea    0x1(%edi),%eax
+f01065f4:	81 85 d4 fe ff ff 00 	addl   $0x1000,-0x12c(%ebp)
+f01065fb:	10 00 00 
+f01065fe:	39 f7                	cmp    %esi,%edi
+f0106600:	75 c8                	jne    f01065ca <syscall+0x3e9>
+			dstenv->env_ipc_perm = perm;
+f0106602:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+f0106608:	8b 4d 18             	mov    0x18(%ebp),%ecx
+f010660b:	89 88 90 00 00 00    	mov    %ecx,0x90(%eax)
+			dstenv->env_ipc_npages = npages;
+f0106611:	89 98 98 00 00 00    	mov    %ebx,0x98(%eax)
+f0106617:	eb 59                	jmp    f0106672 <syscall+0x491>
+					while (--i >= 0)
+f0106619:	83 ef 01             	sub    $0x1,%edi
+f010661c:	0f 88 f7 00 00 00    	js     f0106719 <syscall+0x538>
+f0106622:	89 f8                	mov    %edi,%eax
+f0106624:	c1 e0 0c             	shl    $0xc,%eax
+f0106627:	8b 9d d0 fe ff ff    	mov    -0x130(%ebp),%ebx
+f010662d:	01 c3                	add    %eax,%ebx
+						page_remove(dstenv->env_pgdir, (void*)(dstva + i * PGSIZE));
+f010662f:	83 ec 08             	sub    $0x8,%esp
+f0106632:	53                   	push   %ebx
+f0106633:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+f0106639:	ff 70 70             	push   0x70(%eax)
+f010663c:	e8 d7 b8 ff ff       	call   f0101f18 <page_remove>
+					while (--i >= 0)
+f0106641:	83 ef 01             	sub    $0x1,%edi
+f0106644:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+f010664a:	83 c4 10             	add    $0x10,%esp
+f010664d:	83 ff ff             	cmp    $0xffffffff,%edi
+f0106650:	75 dd                	jne    f010662f <syscall+0x44e>
+					return -E_NO_MEM;
+f0106652:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0106657:	e9 f1 fb ff ff       	jmp    f010624d <syscall+0x6c>
+			dstenv->env_ipc_perm = 0;
+f010665c:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f0106663:	00 00 00 
+f0106666:	eb 0a                	jmp    f0106672 <syscall+0x491>
+		dstenv->env_ipc_perm = 0;
+f0106668:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f010666f:	00 00 00 
+	dstenv->env_ipc_from = curenv->env_id;
+f0106672:	e8 82 1c 00 00       	call   f01082f9 <cpunum>
+f0106677:	89 c2                	mov    %eax,%edx
+f0106679:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+f010667f:	69 d2 d0 00 00 00    	imul   $0xd0,%edx,%edx
+f0106685:	8b 92 28 00 93 f0    	mov    -0xf6cffd8(%edx),%edx
+f010668b:	8b 52 48             	mov    0x48(%edx),%edx
+f010668e:	89 90 8c 00 00 00    	mov    %edx,0x8c(%eax)
+	dstenv->env_ipc_value = value;
+f0106694:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0106697:	89 88 88 00 00 00    	mov    %ecx,0x88(%eax)
+	dstenv->env_tf.tf_regs.reg_eax = 0;
+f010669d:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	dstenv->env_ipc_recving = 0;
+f01066a4:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+f01066ab:	00 00 00 
+	dstenv->env_status = ENV_RUNNABLE;
+f01066ae:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+	return 0;
+f01066b5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01066ba:	e9 8e fb ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_IPC_NOT_RECV;
+f01066bf:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f01066c4:	e9 84 fb ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f01066c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01066ce:	e9 7a fb ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f01066d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01066d8:	e9 70 fb ff ff       	jmp    f010624d <syscall+0x6c>
+			return -E_INVAL;
+f01066dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01066e2:	e9 66 fb ff ff       	jmp    f010624d <syscall+0x6c>
+			return -E_INVAL;
+f01066e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01066ec:	e9 5c fb ff ff       	jmp    f010624d <syscall+0x6c>
+f01066f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01066f6:	e9 52 fb ff ff       	jmp    f010624d <syscall+0x6c>
+				return -E_INVAL;
+f01066fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106700:	e9 48 fb ff ff       	jmp    f010624d <syscall+0x6c>
+				return -E_INVAL;
+f0106705:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010670a:	e9 3e fb ff ff       	jmp    f010624d <syscall+0x6c>
+					return -E_INVAL;
+f010670f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106714:	e9 34 fb ff ff       	jmp    f010624d <syscall+0x6c>
+					return -E_NO_MEM;
+f0106719:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+			 return sys_ipc_try_send(a1, a2, (void*)a3, a4, a5);
+f010671e:	e9 2a fb ff ff       	jmp    f010624d <syscall+0x6c>
+			 return sys_ipc_recv((void*)a1, a2);
+f0106723:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if((uintptr_t)dstva >= UTOP)
+f0106726:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f010672c:	0f 87 c4 07 00 00    	ja     f0106ef6 <syscall+0xd15>
+	if(PGOFF((uintptr_t)dstva))
+f0106732:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+f0106738:	0f 85 c2 07 00 00    	jne    f0106f00 <syscall+0xd1f>
+	if(maxpages == 0)
+f010673e:	85 db                	test   %ebx,%ebx
+f0106740:	74 0f                	je     f0106751 <syscall+0x570>
+	if(maxpages < 0 || maxpages > IPC_MAXPAGES
+f0106742:	83 fb 20             	cmp    $0x20,%ebx
+f0106745:	76 0f                	jbe    f0106756 <syscall+0x575>
+		return -E_INVAL;
+f0106747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010674c:	e9 fc fa ff ff       	jmp    f010624d <syscall+0x6c>
+		maxpages = 1;
+f0106751:	bb 01 00 00 00       	mov    $0x1,%ebx
+	   || (dstva != (void*)USTACKTOP && (uintptr_t)dstva + maxpages * PGSIZE > UTOP))
+f0106756:	81 fe 00 e0 bf ee    	cmp    $0xeebfe000,%esi
+f010675c:	74 12                	je     f0106770 <syscall+0x58f>
+f010675e:	89 d8                	mov    %ebx,%eax
+f0106760:	c1 e0 0c             	shl    $0xc,%eax
+f0106763:	01 f0                	add    %esi,%eax
+f0106765:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+f010676a:	0f 87 9a 07 00 00    	ja     f0106f0a <syscall+0xd29>
+	if (curenv->env_alarm_pending) {
+f0106770:	e8 84 1b 00 00       	call   f01082f9 <cpunum>
+f0106775:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010677b:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106781:	83 b8 ac 00 00 00 00 	cmpl   $0x0,0xac(%eax)
+f0106788:	0f 85 b2 00 00 00    	jne    f0106840 <syscall+0x65f>
+	curenv->env_ipc_dstva = dstva;
+f010678e:	e8 66 1b 00 00       	call   f01082f9 <cpunum>
+f0106793:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106799:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f010679f:	89 b0 84 00 00 00    	mov    %esi,0x84(%eax)
+	curenv->env_ipc_maxpages = maxpages;
+f01067a5:	e8 4f 1b 00 00       	call   f01082f9 <cpunum>
+f01067aa:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01067b0:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01067b6:	89 98 94 00 00 00    	mov    %ebx,0x94(%eax)
+	curenv->env_ipc_recving = 1;	
+f01067bc:	e8 38 1b 00 00       	call   f01082f9 <cpunum>
+f01067c1:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01067c7:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01067cd:	c7 80 80 00 00 00 01 	movl   $0x1,0x80(%eax)
+f01067d4:	00 00 00 
+	curenv->env_status = ENV_NOT_RUNNABLE;
+f01067d7:	e8 1d 1b 00 00       	call   f01082f9 <cpunum>
+f01067dc:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01067e2:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01067e8:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	curenv->env_ipc_nrecv++;
+f01067ef:	e8 05 1b 00 00       	call   f01082f9 <cpunum>
+f01067f4:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01067fa:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106800:	83 80 9c 00 00 00 01 	addl   $0x1,0x9c(%eax)
+	futex_wake_pa(PADDR(&curenv->env_ipc_nrecv), NENV);
+f0106807:	e8 ed 1a 00 00       	call   f01082f9 <cpunum>
+f010680c:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106812:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106818:	05 9c 00 00 00       	add    $0x9c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010681d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0106822:	0f 86 bc 00 00 00    	jbe    f01068e4 <syscall+0x703>
+f0106828:	83 ec 08             	sub    $0x8,%esp
+f010682b:	68 00 04 00 00       	push   $0x400
+	return (physaddr_t)kva - KERNBASE;
+f0106830:	05 00 00 00 10       	add    $0x10000000,%eax
+f0106835:	50                   	push   %eax
+f0106836:	e8 d3 44 00 00       	call   f010ad0e <futex_wake_pa>
+	sched_yield();
+f010683b:	e8 b2 f2 ff ff       	call   f0105af2 <sched_yield>
+		curenv->env_alarm_pending = 0;
+f0106840:	e8 b4 1a 00 00       	call   f01082f9 <cpunum>
+f0106845:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010684b:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106851:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+f0106858:	00 00 00 
+		curenv->env_ipc_from = 0;
+f010685b:	e8 99 1a 00 00       	call   f01082f9 <cpunum>
+f0106860:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106866:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f010686c:	c7 80 8c 00 00 00 00 	movl   $0x0,0x8c(%eax)
+f0106873:	00 00 00 
+		curenv->env_ipc_value = curenv->env_alarm_value;
+f0106876:	e8 7e 1a 00 00       	call   f01082f9 <cpunum>
+f010687b:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106881:	8b 98 28 00 93 f0    	mov    -0xf6cffd8(%eax),%ebx
+f0106887:	e8 6d 1a 00 00       	call   f01082f9 <cpunum>
+f010688c:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106892:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106898:	8b 93 a8 00 00 00    	mov    0xa8(%ebx),%edx
+f010689e:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+		curenv->env_ipc_perm = 0;
+f01068a4:	e8 50 1a 00 00       	call   f01082f9 <cpunum>
+f01068a9:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01068af:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01068b5:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f01068bc:	00 00 00 
+		curenv->env_ipc_npages = 0;
+f01068bf:	e8 35 1a 00 00       	call   f01082f9 <cpunum>
+f01068c4:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01068ca:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f01068d0:	c7 80 98 00 00 00 00 	movl   $0x0,0x98(%eax)
+f01068d7:	00 00 00 
+		return 0;
+f01068da:	b8 00 00 00 00       	mov    $0x0,%eax
+f01068df:	e9 69 f9 ff ff       	jmp    f010624d <syscall+0x6c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01068e4:	50                   	push   %eax
+f01068e5:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01068ea:	68 81 02 00 00       	push   $0x281
+f01068ef:	68 d1 c8 10 f0       	push   $0xf010c8d1
+f01068f4:	e8 47 97 ff ff       	call   f0100040 <_panic>
+	if ((r = envid2env(envid, &env, 1)) < 0)
+f01068f9:	83 ec 04             	sub    $0x4,%esp
+f01068fc:	6a 01                	push   $0x1
+f01068fe:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106904:	50                   	push   %eax
+f0106905:	56                   	push   %esi
+f0106906:	e8 38 d4 ff ff       	call   f0103d43 <envid2env>
+f010690b:	83 c4 10             	add    $0x10,%esp
+f010690e:	85 c0                	test   %eax,%eax
+f0106910:	0f 88 37 f9 ff ff    	js     f010624d <syscall+0x6c>
+			 return sys_env_set_trapframe(a1, (void*)a2);
+f0106916:	8b 75 10             	mov    0x10(%ebp),%esi
+	if ((r = user_mem_check(curenv, tf, sizeof(struct Trapframe), PTE_U | PTE_P)) < 0)
+f0106919:	e8 db 19 00 00       	call   f01082f9 <cpunum>
+f010691e:	6a 05                	push   $0x5
+f0106920:	6a 44                	push   $0x44
+f0106922:	ff 75 10             	push   0x10(%ebp)
+f0106925:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010692b:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106931:	e8 fa d1 ff ff       	call   f0103b30 <user_mem_check>
+f0106936:	83 c4 10             	add    $0x10,%esp
+f0106939:	85 c0                	test   %eax,%eax
+f010693b:	0f 88 0c f9 ff ff    	js     f010624d <syscall+0x6c>
+	env->env_tf = *tf;
+f0106941:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106947:	b9 11 00 00 00       	mov    $0x11,%ecx
+f010694c:	89 c7                	mov    %eax,%edi
+f010694e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	env->env_tf.tf_eflags |= FL_IF;
+f0106950:	81 48 38 00 02 00 00 	orl    $0x200,0x38(%eax)
+	return 0;
+f0106957:	b8 00 00 00 00       	mov    $0x0,%eax
+			 return sys_env_set_trapframe(a1, (void*)a2);
+f010695c:	e9 ec f8 ff ff       	jmp    f010624d <syscall+0x6c>
+	return time_msec();
+f0106961:	e8 ce 41 00 00       	call   f010ab34 <time_msec>
+			 return sys_time_msec();
+f0106966:	e9 e2 f8 ff ff       	jmp    f010624d <syscall+0x6c>
+	user_mem_assert(curenv, src, len, PTE_P | PTE_U);
+f010696b:	e8 89 19 00 00       	call   f01082f9 <cpunum>
+f0106970:	6a 05                	push   $0x5
+f0106972:	ff 75 10             	push   0x10(%ebp)
+f0106975:	56                   	push   %esi
+f0106976:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010697c:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106982:	e8 86 d2 ff ff       	call   f0103c0d <user_mem_assert>
+	return transmit_e1000(src, len);
+f0106987:	83 c4 08             	add    $0x8,%esp
+f010698a:	ff 75 10             	push   0x10(%ebp)
+f010698d:	56                   	push   %esi
+f010698e:	e8 46 2f 00 00       	call   f01098d9 <transmit_e1000>
+			 return sys_net_transmit((void*)a1, a2);
+f0106993:	83 c4 10             	add    $0x10,%esp
+f0106996:	e9 b2 f8 ff ff       	jmp    f010624d <syscall+0x6c>
+	user_mem_assert(curenv, dst, MAX_PACKET_SIZE, PTE_P | PTE_U | PTE_W);
+f010699b:	e8 59 19 00 00       	call   f01082f9 <cpunum>
+f01069a0:	6a 07                	push   $0x7
+f01069a2:	68 ee 05 00 00       	push   $0x5ee
+f01069a7:	56                   	push   %esi
+f01069a8:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01069ae:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f01069b4:	e8 54 d2 ff ff       	call   f0103c0d <user_mem_assert>
+	if ((r = receive_e1000(dst)) != -E_DESC_EMPTY)
+f01069b9:	89 34 24             	mov    %esi,(%esp)
+f01069bc:	e8 38 35 00 00       	call   f0109ef9 <receive_e1000>
+f01069c1:	83 c4 10             	add    $0x10,%esp
+f01069c4:	83 f8 fd             	cmp    $0xfffffffd,%eax
+f01069c7:	0f 85 80 f8 ff ff    	jne    f010624d <syscall+0x6c>
+	if ((r = e1000_rx_wait(curenv)) < 0)
+f01069cd:	e8 27 19 00 00       	call   f01082f9 <cpunum>
+f01069d2:	83 ec 0c             	sub    $0xc,%esp
+f01069d5:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01069db:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f01069e1:	e8 36 39 00 00       	call   f010a31c <e1000_rx_wait>
+f01069e6:	83 c4 10             	add    $0x10,%esp
+f01069e9:	85 c0                	test   %eax,%eax
+f01069eb:	0f 88 5c f8 ff ff    	js     f010624d <syscall+0x6c>
+	sched_yield();
+f01069f1:	e8 fc f0 ff ff       	call   f0105af2 <sched_yield>
+	user_mem_assert(curenv, low, sizeof(uint32_t), PTE_P | PTE_U);
+f01069f6:	e8 fe 18 00 00       	call   f01082f9 <cpunum>
+f01069fb:	6a 05                	push   $0x5
+f01069fd:	6a 04                	push   $0x4
+f01069ff:	56                   	push   %esi
+f0106a00:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106a06:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106a0c:	e8 fc d1 ff ff       	call   f0103c0d <user_mem_assert>
+	user_mem_assert(curenv, high, sizeof(uint32_t), PTE_P | PTE_U);
+f0106a11:	e8 e3 18 00 00       	call   f01082f9 <cpunum>
+f0106a16:	6a 05                	push   $0x5
+f0106a18:	6a 04                	push   $0x4
+f0106a1a:	ff 75 10             	push   0x10(%ebp)
+f0106a1d:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106a23:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106a29:	e8 df d1 ff ff       	call   f0103c0d <user_mem_assert>
+	*low = e100[E1000_RAL/sizeof(uint32_t)];
+f0106a2e:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0106a33:	8b 80 00 54 00 00    	mov    0x5400(%eax),%eax
+f0106a39:	89 06                	mov    %eax,(%esi)
+	*high = e100[E1000_RAH/sizeof(uint32_t)] & 0x0000ffff;
+f0106a3b:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0106a40:	8b 80 04 54 00 00    	mov    0x5404(%eax),%eax
+f0106a46:	25 ff ff 00 00       	and    $0xffff,%eax
+f0106a4b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0106a4e:	89 01                	mov    %eax,(%ecx)
+			 return sys_get_mac((void*)a1, (void*)a2);
+f0106a50:	83 c4 20             	add    $0x20,%esp
+f0106a53:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106a58:	e9 f0 f7 ff ff       	jmp    f010624d <syscall+0x6c>
+			 return sys_page_batch((void*)a1, a2);
+f0106a5d:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106a60:	89 f0                	mov    %esi,%eax
+f0106a62:	e8 14 f4 ff ff       	call   f0105e7b <sys_page_batch>
+f0106a67:	e9 e1 f7 ff ff       	jmp    f010624d <syscall+0x6c>
+	user_mem_assert(curenv, ts, sizeof(*ts), PTE_P | PTE_U | PTE_W);
+f0106a6c:	e8 88 18 00 00       	call   f01082f9 <cpunum>
+f0106a71:	6a 07                	push   $0x7
+f0106a73:	6a 14                	push   $0x14
+f0106a75:	56                   	push   %esi
+f0106a76:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106a7c:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106a82:	e8 86 d1 ff ff       	call   f0103c0d <user_mem_assert>
+	*ts = tlb_stats;
+f0106a87:	a1 08 10 97 f0       	mov    0xf0971008,%eax
+f0106a8c:	89 06                	mov    %eax,(%esi)
+f0106a8e:	a1 0c 10 97 f0       	mov    0xf097100c,%eax
+f0106a93:	89 46 04             	mov    %eax,0x4(%esi)
+f0106a96:	a1 10 10 97 f0       	mov    0xf0971010,%eax
+f0106a9b:	89 46 08             	mov    %eax,0x8(%esi)
+f0106a9e:	a1 14 10 97 f0       	mov    0xf0971014,%eax
+f0106aa3:	89 46 0c             	mov    %eax,0xc(%esi)
+f0106aa6:	a1 18 10 97 f0       	mov    0xf0971018,%eax
+f0106aab:	89 46 10             	mov    %eax,0x10(%esi)
+			 return sys_tlb_stats((void*)a1);
+f0106aae:	83 c4 10             	add    $0x10,%esp
+f0106ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106ab6:	e9 92 f7 ff ff       	jmp    f010624d <syscall+0x6c>
+	if ((uintptr_t) va >= UTOP || PGOFF(va)
+f0106abb:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0106ac1:	0f 87 4d 04 00 00    	ja     f0106f14 <syscall+0xd33>
+f0106ac7:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+f0106acd:	0f 85 4b 04 00 00    	jne    f0106f1e <syscall+0xd3d>
+	    || n < 1 || n > NETBATCH_MAX || (uintptr_t) va + n * PGSIZE > UTOP)
+f0106ad3:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106ad6:	83 e8 01             	sub    $0x1,%eax
+f0106ad9:	83 f8 1f             	cmp    $0x1f,%eax
+f0106adc:	0f 87 46 04 00 00    	ja     f0106f28 <syscall+0xd47>
+f0106ae2:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106ae5:	c1 e0 0c             	shl    $0xc,%eax
+f0106ae8:	01 f0                	add    %esi,%eax
+f0106aea:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+f0106aef:	0f 87 3d 04 00 00    	ja     f0106f32 <syscall+0xd51>
+	if ((r = receive_e1000_pages(curenv, va, n)) != -E_DESC_EMPTY)
+f0106af5:	e8 ff 17 00 00       	call   f01082f9 <cpunum>
+f0106afa:	83 ec 04             	sub    $0x4,%esp
+f0106afd:	ff 75 10             	push   0x10(%ebp)
+f0106b00:	56                   	push   %esi
+f0106b01:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106b07:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106b0d:	e8 cb 34 00 00       	call   f0109fdd <receive_e1000_pages>
+f0106b12:	83 c4 10             	add    $0x10,%esp
+f0106b15:	83 f8 fd             	cmp    $0xfffffffd,%eax
+f0106b18:	0f 85 2f f7 ff ff    	jne    f010624d <syscall+0x6c>
+	if ((r = e1000_rx_wait(curenv)) < 0)
+f0106b1e:	e8 d6 17 00 00       	call   f01082f9 <cpunum>
+f0106b23:	83 ec 0c             	sub    $0xc,%esp
+f0106b26:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106b2c:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106b32:	e8 e5 37 00 00       	call   f010a31c <e1000_rx_wait>
+f0106b37:	83 c4 10             	add    $0x10,%esp
+f0106b3a:	85 c0                	test   %eax,%eax
+f0106b3c:	0f 88 0b f7 ff ff    	js     f010624d <syscall+0x6c>
+	sched_yield();
+f0106b42:	e8 ab ef ff ff       	call   f0105af2 <sched_yield>
+	if (n < 1 || n > NETBATCH_MAX)
+f0106b47:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106b4a:	83 e8 01             	sub    $0x1,%eax
+f0106b4d:	83 f8 1f             	cmp    $0x1f,%eax
+f0106b50:	77 5a                	ja     f0106bac <syscall+0x9cb>
+	user_mem_assert(curenv, frames, n * sizeof(*frames), PTE_P | PTE_U);
+f0106b52:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106b55:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+f0106b5c:	e8 98 17 00 00       	call   f01082f9 <cpunum>
+f0106b61:	6a 05                	push   $0x5
+f0106b63:	53                   	push   %ebx
+f0106b64:	56                   	push   %esi
+f0106b65:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106b6b:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106b71:	e8 97 d0 ff ff       	call   f0103c0d <user_mem_assert>
+	memmove(kframes, frames, n * sizeof(*frames));
+f0106b76:	83 c4 0c             	add    $0xc,%esp
+f0106b79:	53                   	push   %ebx
+f0106b7a:	56                   	push   %esi
+f0106b7b:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+f0106b81:	53                   	push   %ebx
+f0106b82:	e8 4c 11 00 00       	call   f0107cd3 <memmove>
+	return transmit_e1000_batch(curenv, kframes, n);
+f0106b87:	e8 6d 17 00 00       	call   f01082f9 <cpunum>
+f0106b8c:	83 c4 0c             	add    $0xc,%esp
+f0106b8f:	ff 75 10             	push   0x10(%ebp)
+f0106b92:	53                   	push   %ebx
+f0106b93:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106b99:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106b9f:	e8 2c 36 00 00       	call   f010a1d0 <transmit_e1000_batch>
+f0106ba4:	83 c4 10             	add    $0x10,%esp
+f0106ba7:	e9 a1 f6 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106bac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			 return sys_net_transmit_batch((void*)a1, a2);
+f0106bb1:	e9 97 f6 ff ff       	jmp    f010624d <syscall+0x6c>
+	user_mem_assert(curenv, ns, sizeof(*ns), PTE_P | PTE_U | PTE_W);
+f0106bb6:	e8 3e 17 00 00       	call   f01082f9 <cpunum>
+f0106bbb:	6a 07                	push   $0x7
+f0106bbd:	6a 5c                	push   $0x5c
+f0106bbf:	56                   	push   %esi
+f0106bc0:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106bc6:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106bcc:	e8 3c d0 ff ff       	call   f0103c0d <user_mem_assert>
+	e1000_get_stats(ns);
+f0106bd1:	89 34 24             	mov    %esi,(%esp)
+f0106bd4:	e8 66 38 00 00       	call   f010a43f <e1000_get_stats>
+			 return sys_net_stats((void*)a1);
+f0106bd9:	83 c4 10             	add    $0x10,%esp
+f0106bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106be1:	e9 67 f6 ff ff       	jmp    f010624d <syscall+0x6c>
+	time_set_alarm(curenv, msec, period, value);
+f0106be6:	e8 0e 17 00 00       	call   f01082f9 <cpunum>
+f0106beb:	ff 75 14             	push   0x14(%ebp)
+f0106bee:	ff 75 10             	push   0x10(%ebp)
+f0106bf1:	56                   	push   %esi
+f0106bf2:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106bf8:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106bfe:	e8 3c 3f 00 00       	call   f010ab3f <time_set_alarm>
+			 return sys_alarm(a1, a2, a3);
+f0106c03:	83 c4 10             	add    $0x10,%esp
+f0106c06:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106c0b:	e9 3d f6 ff ff       	jmp    f010624d <syscall+0x6c>
+	if ((r = futex_wait(curenv, (uintptr_t) addr, val, msec)) < 0)
+f0106c10:	e8 e4 16 00 00       	call   f01082f9 <cpunum>
+f0106c15:	ff 75 14             	push   0x14(%ebp)
+f0106c18:	ff 75 10             	push   0x10(%ebp)
+f0106c1b:	56                   	push   %esi
+f0106c1c:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106c22:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106c28:	e8 1f 40 00 00       	call   f010ac4c <futex_wait>
+f0106c2d:	83 c4 10             	add    $0x10,%esp
+f0106c30:	85 c0                	test   %eax,%eax
+f0106c32:	0f 88 15 f6 ff ff    	js     f010624d <syscall+0x6c>
+	sched_yield();
+f0106c38:	e8 b5 ee ff ff       	call   f0105af2 <sched_yield>
+	return futex_wake(curenv, (uintptr_t) addr, n);
+f0106c3d:	e8 b7 16 00 00       	call   f01082f9 <cpunum>
+f0106c42:	83 ec 04             	sub    $0x4,%esp
+f0106c45:	ff 75 10             	push   0x10(%ebp)
+f0106c48:	56                   	push   %esi
+f0106c49:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106c4f:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106c55:	e8 2a 41 00 00       	call   f010ad84 <futex_wake>
+			 return sys_futex_wake((uint32_t*)a1, a2);
+f0106c5a:	83 c4 10             	add    $0x10,%esp
+f0106c5d:	e9 eb f5 ff ff       	jmp    f010624d <syscall+0x6c>
+	if (uxstacktop > UTOP || uxstacktop < PGSIZE || PGOFF(uxstacktop))
+f0106c62:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106c65:	2d 00 10 00 00       	sub    $0x1000,%eax
+f0106c6a:	3d 00 f0 bf ee       	cmp    $0xeebff000,%eax
+f0106c6f:	0f 87 dd 00 00 00    	ja     f0106d52 <syscall+0xb71>
+f0106c75:	f7 45 14 ff 0f 00 00 	testl  $0xfff,0x14(%ebp)
+f0106c7c:	0f 85 da 00 00 00    	jne    f0106d5c <syscall+0xb7b>
+	if ((ret = env_alloc_vm(&child, curenv->env_id, curenv->env_pgdir)) < 0)
+f0106c82:	e8 72 16 00 00       	call   f01082f9 <cpunum>
+f0106c87:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106c8d:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106c93:	8b 58 70             	mov    0x70(%eax),%ebx
+f0106c96:	e8 5e 16 00 00       	call   f01082f9 <cpunum>
+f0106c9b:	83 ec 04             	sub    $0x4,%esp
+f0106c9e:	53                   	push   %ebx
+f0106c9f:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106ca5:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106cab:	ff 70 48             	push   0x48(%eax)
+f0106cae:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106cb4:	50                   	push   %eax
+f0106cb5:	e8 c4 d1 ff ff       	call   f0103e7e <env_alloc_vm>
+f0106cba:	83 c4 10             	add    $0x10,%esp
+f0106cbd:	85 c0                	test   %eax,%eax
+f0106cbf:	0f 88 88 f5 ff ff    	js     f010624d <syscall+0x6c>
+	child->env_status = ENV_NOT_RUNNABLE;
+f0106cc5:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106ccb:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	child->env_tf.tf_eip = eip;
+f0106cd2:	89 70 30             	mov    %esi,0x30(%eax)
+	child->env_tf.tf_esp = esp;
+f0106cd5:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106cd8:	89 50 3c             	mov    %edx,0x3c(%eax)
+	child->env_pgfault_upcall = curenv->env_pgfault_upcall;
+f0106cdb:	e8 19 16 00 00       	call   f01082f9 <cpunum>
+f0106ce0:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+f0106ce6:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106cec:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106cf2:	8b 40 78             	mov    0x78(%eax),%eax
+f0106cf5:	89 42 78             	mov    %eax,0x78(%edx)
+	child->env_uxstacktop = uxstacktop;
+f0106cf8:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106cfb:	89 42 7c             	mov    %eax,0x7c(%edx)
+	child->env_netq = curenv->env_netq;
+f0106cfe:	e8 f6 15 00 00       	call   f01082f9 <cpunum>
+f0106d03:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106d09:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106d0f:	8b 50 6c             	mov    0x6c(%eax),%edx
+f0106d12:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106d18:	89 50 6c             	mov    %edx,0x6c(%eax)
+	if (env_is_ns(curenv))
+f0106d1b:	e8 d9 15 00 00       	call   f01082f9 <cpunum>
+f0106d20:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+	return e->env_type == ENV_TYPE_NS || e->env_type == ENV_TYPE_NS_HELPER;
+f0106d26:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106d2c:	8b 40 50             	mov    0x50(%eax),%eax
+f0106d2f:	83 e8 03             	sub    $0x3,%eax
+	if (env_is_ns(curenv))
+f0106d32:	83 f8 01             	cmp    $0x1,%eax
+f0106d35:	77 0d                	ja     f0106d44 <syscall+0xb63>
+		child->env_type = ENV_TYPE_NS_HELPER;
+f0106d37:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106d3d:	c7 40 50 04 00 00 00 	movl   $0x4,0x50(%eax)
+	return child->env_id;
+f0106d44:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106d4a:	8b 40 48             	mov    0x48(%eax),%eax
+f0106d4d:	e9 fb f4 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106d52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106d57:	e9 f1 f4 ff ff       	jmp    f010624d <syscall+0x6c>
+f0106d5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			 return sys_exofork_shared(a1, a2, a3);
+f0106d61:	e9 e7 f4 ff ff       	jmp    f010624d <syscall+0x6c>
+	if (!env_is_ns(curenv))
+f0106d66:	e8 8e 15 00 00       	call   f01082f9 <cpunum>
+f0106d6b:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+	return e->env_type == ENV_TYPE_NS || e->env_type == ENV_TYPE_NS_HELPER;
+f0106d71:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106d77:	8b 40 50             	mov    0x50(%eax),%eax
+f0106d7a:	83 e8 03             	sub    $0x3,%eax
+	if (!env_is_ns(curenv))
+f0106d7d:	83 f8 01             	cmp    $0x1,%eax
+f0106d80:	0f 87 b6 01 00 00    	ja     f0106f3c <syscall+0xd5b>
+	if (q < 0 || q >= e1000_nq)
+f0106d86:	85 f6                	test   %esi,%esi
+f0106d88:	0f 88 b8 01 00 00    	js     f0106f46 <syscall+0xd65>
+f0106d8e:	3b 35 d4 87 11 f0    	cmp    0xf01187d4,%esi
+f0106d94:	0f 8d b6 01 00 00    	jge    f0106f50 <syscall+0xd6f>
+	curenv->env_netq = q;
+f0106d9a:	e8 5a 15 00 00       	call   f01082f9 <cpunum>
+f0106d9f:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106da5:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106dab:	89 70 6c             	mov    %esi,0x6c(%eax)
+	return e1000_nq;
+f0106dae:	a1 d4 87 11 f0       	mov    0xf01187d4,%eax
+f0106db3:	e9 95 f4 ff ff       	jmp    f010624d <syscall+0x6c>
+			 return sys_net_listen(a1, a2);
+f0106db8:	0f b7 f6             	movzwl %si,%esi
+	if (!env_is_ns(curenv))
+f0106dbb:	e8 39 15 00 00       	call   f01082f9 <cpunum>
+f0106dc0:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+	return e->env_type == ENV_TYPE_NS || e->env_type == ENV_TYPE_NS_HELPER;
+f0106dc6:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106dcc:	8b 40 50             	mov    0x50(%eax),%eax
+f0106dcf:	83 e8 03             	sub    $0x3,%eax
+	if (!env_is_ns(curenv))
+f0106dd2:	83 f8 01             	cmp    $0x1,%eax
+f0106dd5:	0f 87 7f 01 00 00    	ja     f0106f5a <syscall+0xd79>
+	return e1000_listen(curenv->env_netq, port, on);
+f0106ddb:	e8 19 15 00 00       	call   f01082f9 <cpunum>
+f0106de0:	83 ec 04             	sub    $0x4,%esp
+f0106de3:	ff 75 10             	push   0x10(%ebp)
+f0106de6:	56                   	push   %esi
+f0106de7:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106ded:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106df3:	ff 70 6c             	push   0x6c(%eax)
+f0106df6:	e8 2d 33 00 00       	call   f010a128 <e1000_listen>
+f0106dfb:	83 c4 10             	add    $0x10,%esp
+f0106dfe:	e9 4a f4 ff ff       	jmp    f010624d <syscall+0x6c>
+	if (!env_is_ns(curenv))
+f0106e03:	e8 f1 14 00 00       	call   f01082f9 <cpunum>
+f0106e08:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+	return e->env_type == ENV_TYPE_NS || e->env_type == ENV_TYPE_NS_HELPER;
+f0106e0e:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0106e14:	8b 40 50             	mov    0x50(%eax),%eax
+f0106e17:	83 e8 03             	sub    $0x3,%eax
+	if (!env_is_ns(curenv))
+f0106e1a:	83 f8 01             	cmp    $0x1,%eax
+f0106e1d:	0f 87 b5 00 00 00    	ja     f0106ed8 <syscall+0xcf7>
+	if (nfrag < 0 || nfrag > NETFRAG_MAX)
+f0106e23:	83 7d 10 10          	cmpl   $0x10,0x10(%ebp)
+f0106e27:	0f 87 b5 00 00 00    	ja     f0106ee2 <syscall+0xd01>
+	user_mem_assert(curenv, frags, nfrag * sizeof(*frags), PTE_P | PTE_U);
+f0106e2d:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106e30:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+f0106e37:	e8 bd 14 00 00       	call   f01082f9 <cpunum>
+f0106e3c:	6a 05                	push   $0x5
+f0106e3e:	53                   	push   %ebx
+f0106e3f:	56                   	push   %esi
+f0106e40:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106e46:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106e4c:	e8 bc cd ff ff       	call   f0103c0d <user_mem_assert>
+	memmove(kfrags, frags, nfrag * sizeof(*frags));
+f0106e51:	83 c4 0c             	add    $0xc,%esp
+f0106e54:	53                   	push   %ebx
+f0106e55:	56                   	push   %esi
+f0106e56:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106e5c:	50                   	push   %eax
+f0106e5d:	e8 71 0e 00 00       	call   f0107cd3 <memmove>
+	if (off) {
+f0106e62:	83 c4 10             	add    $0x10,%esp
+	return transmit_e1000_sg(curenv, kfrags, nfrag, off ? &koff : NULL);
+f0106e65:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (off) {
+f0106e6a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+f0106e6e:	74 3f                	je     f0106eaf <syscall+0xcce>
+		user_mem_assert(curenv, off, sizeof(*off), PTE_P | PTE_U);
+f0106e70:	e8 84 14 00 00       	call   f01082f9 <cpunum>
+f0106e75:	6a 05                	push   $0x5
+f0106e77:	6a 06                	push   $0x6
+f0106e79:	ff 75 14             	push   0x14(%ebp)
+f0106e7c:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106e82:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106e88:	e8 80 cd ff ff       	call   f0103c0d <user_mem_assert>
+		koff = *off;
+f0106e8d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106e90:	8b 00                	mov    (%eax),%eax
+f0106e92:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%ebp)
+f0106e98:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106e9b:	0f b7 40 04          	movzwl 0x4(%eax),%eax
+f0106e9f:	66 89 85 e4 fe ff ff 	mov    %ax,-0x11c(%ebp)
+f0106ea6:	83 c4 10             	add    $0x10,%esp
+	return transmit_e1000_sg(curenv, kfrags, nfrag, off ? &koff : NULL);
+f0106ea9:	8d 9d e0 fe ff ff    	lea    -0x120(%ebp),%ebx
+f0106eaf:	e8 45 14 00 00       	call   f01082f9 <cpunum>
+f0106eb4:	53                   	push   %ebx
+f0106eb5:	ff 75 10             	push   0x10(%ebp)
+f0106eb8:	8d 95 e8 fe ff ff    	lea    -0x118(%ebp),%edx
+f0106ebe:	52                   	push   %edx
+f0106ebf:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0106ec5:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0106ecb:	e8 fe 2a 00 00       	call   f01099ce <transmit_e1000_sg>
+f0106ed0:	83 c4 10             	add    $0x10,%esp
+f0106ed3:	e9 75 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_BAD_ENV;
+f0106ed8:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0106edd:	e9 6b f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106ee2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			 return sys_net_transmit_sg((void*)a1, a2, (void*)a3);
+f0106ee7:	e9 61 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+	switch(syscallno) {
+f0106eec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106ef1:	e9 57 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106ef6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106efb:	e9 4d f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106f00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f05:	e9 43 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106f0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f0f:	e9 39 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106f14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f19:	e9 2f f3 ff ff       	jmp    f010624d <syscall+0x6c>
+f0106f1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f23:	e9 25 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+f0106f28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f2d:	e9 1b f3 ff ff       	jmp    f010624d <syscall+0x6c>
+f0106f32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f37:	e9 11 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_BAD_ENV;
+f0106f3c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0106f41:	e9 07 f3 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_INVAL;
+f0106f46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f4b:	e9 fd f2 ff ff       	jmp    f010624d <syscall+0x6c>
+f0106f50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106f55:	e9 f3 f2 ff ff       	jmp    f010624d <syscall+0x6c>
+		return -E_BAD_ENV;
+f0106f5a:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0106f5f:	e9 e9 f2 ff ff       	jmp    f010624d <syscall+0x6c>
+
+f0106f64 <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f0106f64:	55                   	push   %ebp
+f0106f65:	89 e5                	mov    %esp,%ebp
+f0106f67:	57                   	push   %edi
+f0106f68:	56                   	push   %esi
+f0106f69:	53                   	push   %ebx
+f0106f6a:	83 ec 14             	sub    $0x14,%esp
+f0106f6d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0106f70:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0106f73:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0106f76:	8b 1a                	mov    (%edx),%ebx
+f0106f78:	8b 09                	mov    (%ecx),%ecx
+	
+	while (l <= r) {
+f0106f7a:	39 cb                	cmp    %ecx,%ebx
+f0106f7c:	0f 8f d8 00 00 00    	jg     f010705a <stab_binsearch+0xf6>
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0106f82:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+f0106f89:	eb 2c                	jmp    f0106fb7 <stab_binsearch+0x53>
+		int true_m = (l + r) / 2, m = true_m;
+		
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+		if (m < l) {	// no match in [l, m]
+f0106f8b:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+f0106f8e:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106f91:	39 c3                	cmp    %eax,%ebx
+f0106f93:	7f 5b                	jg     f0106ff0 <stab_binsearch+0x8c>
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0106f95:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106f98:	8b 75 ec             	mov    -0x14(%ebp),%esi
+f0106f9b:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0106f9f:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0106fa2:	73 51                	jae    f0106ff5 <stab_binsearch+0x91>
+			*region_left = m;
+f0106fa4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0106fa7:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f0106fa9:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f0106fac:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f0106fb3:	39 cb                	cmp    %ecx,%ebx
+f0106fb5:	7f 68                	jg     f010701f <stab_binsearch+0xbb>
+		int true_m = (l + r) / 2, m = true_m;
+f0106fb7:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0106fba:	89 c7                	mov    %eax,%edi
+f0106fbc:	c1 ef 1f             	shr    $0x1f,%edi
+f0106fbf:	01 c7                	add    %eax,%edi
+f0106fc1:	d1 ff                	sar    %edi
+		while (m >= l && stabs[m].n_type != type)
+f0106fc3:	39 df                	cmp    %ebx,%edi
+f0106fc5:	7c 29                	jl     f0106ff0 <stab_binsearch+0x8c>
+f0106fc7:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+f0106fca:	8b 55 ec             	mov    -0x14(%ebp),%edx
+f0106fcd:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+		int true_m = (l + r) / 2, m = true_m;
+f0106fd1:	89 f8                	mov    %edi,%eax
+f0106fd3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0106fd6:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f0106fd9:	0f b6 0a             	movzbl (%edx),%ecx
+f0106fdc:	39 f1                	cmp    %esi,%ecx
+f0106fde:	74 ab                	je     f0106f8b <stab_binsearch+0x27>
+			m--;
+f0106fe0:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f0106fe3:	83 ea 0c             	sub    $0xc,%edx
+f0106fe6:	39 d8                	cmp    %ebx,%eax
+f0106fe8:	7d ef                	jge    f0106fd9 <stab_binsearch+0x75>
+f0106fea:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+f0106fed:	89 75 08             	mov    %esi,0x8(%ebp)
+			l = true_m + 1;
+f0106ff0:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f0106ff3:	eb be                	jmp    f0106fb3 <stab_binsearch+0x4f>
+		} else if (stabs[m].n_value > addr) {
+f0106ff5:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0106ff8:	73 11                	jae    f010700b <stab_binsearch+0xa7>
+			*region_right = m - 1;
+f0106ffa:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0106ffd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107000:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f0107002:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0107009:	eb a8                	jmp    f0106fb3 <stab_binsearch+0x4f>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f010700b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f010700e:	89 06                	mov    %eax,(%esi)
+			l = m;
+			addr++;
+f0107010:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f0107014:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f0107016:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f010701d:	eb 94                	jmp    f0106fb3 <stab_binsearch+0x4f>
+		}
+	}
+
+	if (!any_matches)
+f010701f:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107022:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0107026:	74 32                	je     f010705a <stab_binsearch+0xf6>
+		*region_right = *region_left - 1;
+	else {
+		// find rightmost region containing 'addr'
+		for (l = *region_right;
+f0107028:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010702b:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f010702d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0107030:	8b 0f                	mov    (%edi),%ecx
+f0107032:	39 c8                	cmp    %ecx,%eax
+f0107034:	7e 1d                	jle    f0107053 <stab_binsearch+0xef>
+f0107036:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0107039:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f010703c:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0107040:	0f b6 1a             	movzbl (%edx),%ebx
+f0107043:	39 f3                	cmp    %esi,%ebx
+f0107045:	74 0c                	je     f0107053 <stab_binsearch+0xef>
+		     l--)
+f0107047:	83 e8 01             	sub    $0x1,%eax
+		     l > *region_left && stabs[l].n_type != type;
+f010704a:	83 ea 0c             	sub    $0xc,%edx
+f010704d:	39 c8                	cmp    %ecx,%eax
+f010704f:	75 ef                	jne    f0107040 <stab_binsearch+0xdc>
+		     l--)
+f0107051:	89 c8                	mov    %ecx,%eax
+			/* do nothing */;
+		*region_left = l;
+f0107053:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107056:	89 06                	mov    %eax,(%esi)
+	}
+}
+f0107058:	eb 0d                	jmp    f0107067 <stab_binsearch+0x103>
+		*region_right = *region_left - 1;
+f010705a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010705d:	8b 00                	mov    (%eax),%eax
+f010705f:	83 e8 01             	sub    $0x1,%eax
+f0107062:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0107065:	89 06                	mov    %eax,(%esi)
+}
+f0107067:	83 c4 14             	add    $0x14,%esp
+f010706a:	5b                   	pop    %ebx
+f010706b:	5e                   	pop    %esi
+f010706c:	5f                   	pop    %edi
+f010706d:	5d                   	pop    %ebp
+f010706e:	c3                   	ret
+
+f010706f <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f010706f:	55                   	push   %ebp
+f0107070:	89 e5                	mov    %esp,%ebp
+f0107072:	57                   	push   %edi
+f0107073:	56                   	push   %esi
+f0107074:	53                   	push   %ebx
+f0107075:	83 ec 3c             	sub    $0x3c,%esp
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f0107078:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010707b:	c7 00 e0 c8 10 f0    	movl   $0xf010c8e0,(%eax)
+	info->eip_line = 0;
+f0107081:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	info->eip_fn_name = "<unknown>";
+f0107088:	c7 40 08 e0 c8 10 f0 	movl   $0xf010c8e0,0x8(%eax)
+	info->eip_fn_namelen = 9;
+f010708f:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+	info->eip_fn_addr = addr;
+f0107096:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0107099:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f010709c:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f01070a3:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f01070a9:	0f 86 36 01 00 00    	jbe    f01071e5 <debuginfo_eip+0x176>
+		stabs = __STAB_BEGIN__;
+		stab_end = __STAB_END__;
+		stabstr = __STABSTR_BEGIN__;
+		stabstr_end = __STABSTR_END__;
+f01070af:	c7 45 c4 cd d1 10 f0 	movl   $0xf010d1cd,-0x3c(%ebp)
+		stabstr = __STABSTR_BEGIN__;
+f01070b6:	c7 45 c0 cd d1 10 f0 	movl   $0xf010d1cd,-0x40(%ebp)
+		stab_end = __STAB_END__;
+f01070bd:	be cc d1 10 f0       	mov    $0xf010d1cc,%esi
+		stabs = __STAB_BEGIN__;
+f01070c2:	bf cc d1 10 f0       	mov    $0xf010d1cc,%edi
+		if(user_mem_check(curenv, stabstr, len, PTE_U) < 0)
+			return -1;		
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f01070c7:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f01070ca:	39 4d c0             	cmp    %ecx,-0x40(%ebp)
+f01070cd:	0f 83 55 02 00 00    	jae    f0107328 <debuginfo_eip+0x2b9>
+f01070d3:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f01070d7:	0f 85 52 02 00 00    	jne    f010732f <debuginfo_eip+0x2c0>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+	
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f01070dd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f01070e4:	29 fe                	sub    %edi,%esi
+f01070e6:	c1 fe 02             	sar    $0x2,%esi
+f01070e9:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f01070ef:	83 e8 01             	sub    $0x1,%eax
+f01070f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f01070f5:	83 ec 08             	sub    $0x8,%esp
+f01070f8:	ff 75 08             	push   0x8(%ebp)
+f01070fb:	6a 64                	push   $0x64
+f01070fd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0107100:	89 c1                	mov    %eax,%ecx
+f0107102:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0107105:	89 f8                	mov    %edi,%eax
+f0107107:	e8 58 fe ff ff       	call   f0106f64 <stab_binsearch>
+	if (lfile == 0)
+f010710c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f010710f:	83 c4 10             	add    $0x10,%esp
+f0107112:	85 f6                	test   %esi,%esi
+f0107114:	0f 84 1c 02 00 00    	je     f0107336 <debuginfo_eip+0x2c7>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile;
+f010711a:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	rfun = rfile;
+f010711d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0107120:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0107123:	83 ec 08             	sub    $0x8,%esp
+f0107126:	ff 75 08             	push   0x8(%ebp)
+f0107129:	6a 24                	push   $0x24
+f010712b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f010712e:	89 c1                	mov    %eax,%ecx
+f0107130:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0107133:	89 f8                	mov    %edi,%eax
+f0107135:	e8 2a fe ff ff       	call   f0106f64 <stab_binsearch>
+
+	if (lfun <= rfun) {
+f010713a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010713d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0107140:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0107143:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0107146:	83 c4 10             	add    $0x10,%esp
+f0107149:	39 d0                	cmp    %edx,%eax
+f010714b:	0f 8f 39 01 00 00    	jg     f010728a <debuginfo_eip+0x21b>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f0107151:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0107154:	8d 14 87             	lea    (%edi,%eax,4),%edx
+f0107157:	8b 02                	mov    (%edx),%eax
+f0107159:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010715c:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f010715f:	29 d9                	sub    %ebx,%ecx
+f0107161:	39 c8                	cmp    %ecx,%eax
+f0107163:	73 08                	jae    f010716d <debuginfo_eip+0xfe>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0107165:	01 d8                	add    %ebx,%eax
+f0107167:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010716a:	89 43 08             	mov    %eax,0x8(%ebx)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f010716d:	8b 42 08             	mov    0x8(%edx),%eax
+		addr -= info->eip_fn_addr;
+f0107170:	29 45 08             	sub    %eax,0x8(%ebp)
+		// Search within the function definition for the line number.
+		lline = lfun;
+		rline = rfun;
+f0107173:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0107176:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0107179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010717c:	89 41 10             	mov    %eax,0x10(%ecx)
+		lline = lfun;
+f010717f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		rline = rfun;
+f0107182:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+		info->eip_fn_addr = addr;
+		lline = lfile;
+		rline = rfile;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0107185:	83 ec 08             	sub    $0x8,%esp
+f0107188:	6a 3a                	push   $0x3a
+f010718a:	ff 71 08             	push   0x8(%ecx)
+f010718d:	e8 e2 0a 00 00       	call   f0107c74 <strfind>
+f0107192:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0107195:	2b 43 08             	sub    0x8(%ebx),%eax
+f0107198:	89 43 0c             	mov    %eax,0xc(%ebx)
+	// Hint:
+	//	There's a particular stabs type used for line numbers.
+	//	Look at the STABS documentation and <inc/stab.h> to find
+	//	which one.
+	// Your code here.
+	stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f010719b:	83 c4 08             	add    $0x8,%esp
+f010719e:	ff 75 08             	push   0x8(%ebp)
+f01071a1:	6a 44                	push   $0x44
+f01071a3:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f01071a6:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f01071a9:	89 f8                	mov    %edi,%eax
+f01071ab:	e8 b4 fd ff ff       	call   f0106f64 <stab_binsearch>
+    if(lline <= rline) {
+f01071b0:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f01071b3:	83 c4 10             	add    $0x10,%esp
+f01071b6:	3b 55 d0             	cmp    -0x30(%ebp),%edx
+f01071b9:	0f 8f 7e 01 00 00    	jg     f010733d <debuginfo_eip+0x2ce>
+		info->eip_line = stabs[lline].n_desc;
+f01071bf:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f01071c2:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+f01071c9:	0f b7 44 87 06       	movzwl 0x6(%edi,%eax,4),%eax
+f01071ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01071d1:	89 43 04             	mov    %eax,0x4(%ebx)
+	// We can't just use the "lfile" stab because inlined functions
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f01071d4:	39 d6                	cmp    %edx,%esi
+f01071d6:	0f 8f f4 00 00 00    	jg     f01072d0 <debuginfo_eip+0x261>
+f01071dc:	8d 44 0f 04          	lea    0x4(%edi,%ecx,1),%eax
+f01071e0:	e9 b9 00 00 00       	jmp    f010729e <debuginfo_eip+0x22f>
+		if(user_mem_check(curenv, usd, sizeof(struct UserStabData), PTE_U) < 0)
+f01071e5:	e8 0f 11 00 00       	call   f01082f9 <cpunum>
+f01071ea:	6a 04                	push   $0x4
+f01071ec:	6a 10                	push   $0x10
+f01071ee:	68 00 00 20 00       	push   $0x200000
+f01071f3:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01071f9:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f01071ff:	e8 2c c9 ff ff       	call   f0103b30 <user_mem_check>
+f0107204:	83 c4 10             	add    $0x10,%esp
+f0107207:	85 c0                	test   %eax,%eax
+f0107209:	0f 88 0b 01 00 00    	js     f010731a <debuginfo_eip+0x2ab>
+		stabs = usd->stabs;
+f010720f:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+		stab_end = usd->stab_end;
+f0107215:	8b 35 04 00 20 00    	mov    0x200004,%esi
+		stabstr = usd->stabstr;
+f010721b:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f0107221:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		stabstr_end = usd->stabstr_end;
+f0107224:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f010722a:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		if(user_mem_check(curenv, stabs, len, PTE_U) < 0)
+f010722d:	e8 c7 10 00 00       	call   f01082f9 <cpunum>
+f0107232:	6a 04                	push   $0x4
+		int len = (stab_end - stabs) * sizeof(struct Stab);
+f0107234:	89 f1                	mov    %esi,%ecx
+f0107236:	29 f9                	sub    %edi,%ecx
+		if(user_mem_check(curenv, stabs, len, PTE_U) < 0)
+f0107238:	51                   	push   %ecx
+f0107239:	57                   	push   %edi
+f010723a:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0107240:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0107246:	e8 e5 c8 ff ff       	call   f0103b30 <user_mem_check>
+f010724b:	83 c4 10             	add    $0x10,%esp
+f010724e:	85 c0                	test   %eax,%eax
+f0107250:	0f 88 cb 00 00 00    	js     f0107321 <debuginfo_eip+0x2b2>
+		if(user_mem_check(curenv, stabstr, len, PTE_U) < 0)
+f0107256:	e8 9e 10 00 00       	call   f01082f9 <cpunum>
+f010725b:	6a 04                	push   $0x4
+		len = stabstr_end - stabstr;
+f010725d:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0107260:	29 da                	sub    %ebx,%edx
+		if(user_mem_check(curenv, stabstr, len, PTE_U) < 0)
+f0107262:	52                   	push   %edx
+f0107263:	53                   	push   %ebx
+f0107264:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f010726a:	ff b0 28 00 93 f0    	push   -0xf6cffd8(%eax)
+f0107270:	e8 bb c8 ff ff       	call   f0103b30 <user_mem_check>
+f0107275:	83 c4 10             	add    $0x10,%esp
+f0107278:	85 c0                	test   %eax,%eax
+f010727a:	0f 89 47 fe ff ff    	jns    f01070c7 <debuginfo_eip+0x58>
+			return -1;		
+f0107280:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107285:	e9 88 00 00 00       	jmp    f0107312 <debuginfo_eip+0x2a3>
+f010728a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010728d:	89 f2                	mov    %esi,%edx
+f010728f:	e9 e5 fe ff ff       	jmp    f0107179 <debuginfo_eip+0x10a>
+		lline--;
+f0107294:	83 ea 01             	sub    $0x1,%edx
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0107297:	83 e8 0c             	sub    $0xc,%eax
+f010729a:	39 d6                	cmp    %edx,%esi
+f010729c:	7f 32                	jg     f01072d0 <debuginfo_eip+0x261>
+	       && stabs[lline].n_type != N_SOL
+f010729e:	0f b6 08             	movzbl (%eax),%ecx
+f01072a1:	80 f9 84             	cmp    $0x84,%cl
+f01072a4:	74 0b                	je     f01072b1 <debuginfo_eip+0x242>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f01072a6:	80 f9 64             	cmp    $0x64,%cl
+f01072a9:	75 e9                	jne    f0107294 <debuginfo_eip+0x225>
+f01072ab:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f01072af:	74 e3                	je     f0107294 <debuginfo_eip+0x225>
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f01072b1:	39 d6                	cmp    %edx,%esi
+f01072b3:	7f 1b                	jg     f01072d0 <debuginfo_eip+0x261>
+f01072b5:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f01072b8:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f01072bb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01072be:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f01072c1:	29 f0                	sub    %esi,%eax
+f01072c3:	39 c2                	cmp    %eax,%edx
+f01072c5:	73 09                	jae    f01072d0 <debuginfo_eip+0x261>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f01072c7:	89 f0                	mov    %esi,%eax
+f01072c9:	01 d0                	add    %edx,%eax
+f01072cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01072ce:	89 06                	mov    %eax,(%esi)
+		for (lline = lfun + 1;
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+		     lline++)
+			info->eip_fn_narg++;
+	
+	return 0;
+f01072d0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f01072d5:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f01072d8:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f01072db:	39 f3                	cmp    %esi,%ebx
+f01072dd:	7d 33                	jge    f0107312 <debuginfo_eip+0x2a3>
+		for (lline = lfun + 1;
+f01072df:	8d 43 01             	lea    0x1(%ebx),%eax
+f01072e2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f01072e5:	39 c6                	cmp    %eax,%esi
+f01072e7:	7e 5b                	jle    f0107344 <debuginfo_eip+0x2d5>
+f01072e9:	8d 53 02             	lea    0x2(%ebx),%edx
+f01072ec:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01072ef:	8d 44 87 10          	lea    0x10(%edi,%eax,4),%eax
+f01072f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01072f6:	80 38 a0             	cmpb   $0xa0,(%eax)
+f01072f9:	75 12                	jne    f010730d <debuginfo_eip+0x29e>
+			info->eip_fn_narg++;
+f01072fb:	83 41 14 01          	addl   $0x1,0x14(%ecx)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f01072ff:	8d 5a 01             	lea    0x1(%edx),%ebx
+f0107302:	83 c0 0c             	add    $0xc,%eax
+f0107305:	39 d6                	cmp    %edx,%esi
+f0107307:	74 42                	je     f010734b <debuginfo_eip+0x2dc>
+f0107309:	89 da                	mov    %ebx,%edx
+f010730b:	eb e9                	jmp    f01072f6 <debuginfo_eip+0x287>
+	return 0;
+f010730d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107315:	5b                   	pop    %ebx
+f0107316:	5e                   	pop    %esi
+f0107317:	5f                   	pop    %edi
+f0107318:	5d                   	pop    %ebp
+f0107319:	c3                   	ret
+			return -1;
+f010731a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010731f:	eb f1                	jmp    f0107312 <debuginfo_eip+0x2a3>
+			return -1;
+f0107321:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107326:	eb ea                	jmp    f0107312 <debuginfo_eip+0x2a3>
+		return -1;
+f0107328:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010732d:	eb e3                	jmp    f0107312 <debuginfo_eip+0x2a3>
+f010732f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107334:	eb dc                	jmp    f0107312 <debuginfo_eip+0x2a3>
+		return -1;
+f0107336:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010733b:	eb d5                	jmp    f0107312 <debuginfo_eip+0x2a3>
+		return -1;
+f010733d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107342:	eb ce                	jmp    f0107312 <debuginfo_eip+0x2a3>
+	return 0;
+f0107344:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107349:	eb c7                	jmp    f0107312 <debuginfo_eip+0x2a3>
+f010734b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107350:	eb c0                	jmp    f0107312 <debuginfo_eip+0x2a3>
+
+f0107352 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f0107352:	55                   	push   %ebp
+f0107353:	89 e5                	mov    %esp,%ebp
+f0107355:	57                   	push   %edi
+f0107356:	56                   	push   %esi
+f0107357:	53                   	push   %ebx
+f0107358:	83 ec 1c             	sub    $0x1c,%esp
+f010735b:	89 c3                	mov    %eax,%ebx
+f010735d:	89 d6                	mov    %edx,%esi
+f010735f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107362:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107365:	89 d1                	mov    %edx,%ecx
+f0107367:	89 c2                	mov    %eax,%edx
+f0107369:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010736c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010736f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f0107372:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107375:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f010737c:	39 c2                	cmp    %eax,%edx
+f010737e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0107381:	73 4b                	jae    f01073ce <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+f0107383:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107386:	8d 78 ff             	lea    -0x1(%eax),%edi
+f0107389:	85 ff                	test   %edi,%edi
+f010738b:	7e 11                	jle    f010739e <printnum+0x4c>
+			putch(padc, putdat);
+f010738d:	83 ec 08             	sub    $0x8,%esp
+f0107390:	56                   	push   %esi
+f0107391:	ff 75 18             	push   0x18(%ebp)
+f0107394:	ff d3                	call   *%ebx
+		while (--width > 0)
+f0107396:	83 c4 10             	add    $0x10,%esp
+f0107399:	83 ef 01             	sub    $0x1,%edi
+f010739c:	75 ef                	jne    f010738d <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f010739e:	83 ec 08             	sub    $0x8,%esp
+f01073a1:	56                   	push   %esi
+f01073a2:	83 ec 04             	sub    $0x4,%esp
+f01073a5:	ff 75 e4             	push   -0x1c(%ebp)
+f01073a8:	ff 75 e0             	push   -0x20(%ebp)
+f01073ab:	ff 75 dc             	push   -0x24(%ebp)
+f01073ae:	ff 75 d8             	push   -0x28(%ebp)
+f01073b1:	e8 d3 3b 00 00       	call   f010af89 <__umoddi3>
+f01073b6:	83 c4 14             	add    $0x14,%esp
+f01073b9:	0f be 80 ea c8 10 f0 	movsbl -0xfef3716(%eax),%eax
+f01073c0:	50                   	push   %eax
+f01073c1:	ff d3                	call   *%ebx
+}
+f01073c3:	83 c4 10             	add    $0x10,%esp
+f01073c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01073c9:	5b                   	pop    %ebx
+f01073ca:	5e                   	pop    %esi
+f01073cb:	5f                   	pop    %edi
+f01073cc:	5d                   	pop    %ebp
+f01073cd:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f01073ce:	83 ec 0c             	sub    $0xc,%esp
+f01073d1:	ff 75 18             	push   0x18(%ebp)
+f01073d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+f01073d7:	8d 57 ff             	lea    -0x1(%edi),%edx
+f01073da:	52                   	push   %edx
+f01073db:	50                   	push   %eax
+f01073dc:	83 ec 08             	sub    $0x8,%esp
+f01073df:	ff 75 e4             	push   -0x1c(%ebp)
+f01073e2:	ff 75 e0             	push   -0x20(%ebp)
+f01073e5:	ff 75 dc             	push   -0x24(%ebp)
+f01073e8:	ff 75 d8             	push   -0x28(%ebp)
+f01073eb:	e8 d3 3a 00 00       	call   f010aec3 <__udivdi3>
+f01073f0:	83 c4 18             	add    $0x18,%esp
+f01073f3:	52                   	push   %edx
+f01073f4:	50                   	push   %eax
+f01073f5:	89 f2                	mov    %esi,%edx
+f01073f7:	89 d8                	mov    %ebx,%eax
+f01073f9:	e8 54 ff ff ff       	call   f0107352 <printnum>
+f01073fe:	83 c4 20             	add    $0x20,%esp
+f0107401:	eb 9b                	jmp    f010739e <printnum+0x4c>
+
+f0107403 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f0107403:	55                   	push   %ebp
+f0107404:	89 e5                	mov    %esp,%ebp
+f0107406:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f0107409:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f010740d:	8b 10                	mov    (%eax),%edx
+f010740f:	3b 50 04             	cmp    0x4(%eax),%edx
+f0107412:	73 0a                	jae    f010741e <sprintputch+0x1b>
+		*b->buf++ = ch;
+f0107414:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0107417:	89 08                	mov    %ecx,(%eax)
+f0107419:	8b 45 08             	mov    0x8(%ebp),%eax
+f010741c:	88 02                	mov    %al,(%edx)
+}
+f010741e:	5d                   	pop    %ebp
+f010741f:	c3                   	ret
+
+f0107420 <printfmt>:
+{
+f0107420:	55                   	push   %ebp
+f0107421:	89 e5                	mov    %esp,%ebp
+f0107423:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f0107426:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f0107429:	50                   	push   %eax
+f010742a:	ff 75 10             	push   0x10(%ebp)
+f010742d:	ff 75 0c             	push   0xc(%ebp)
+f0107430:	ff 75 08             	push   0x8(%ebp)
+f0107433:	e8 05 00 00 00       	call   f010743d <vprintfmt>
+}
+f0107438:	83 c4 10             	add    $0x10,%esp
+f010743b:	c9                   	leave
+f010743c:	c3                   	ret
+
+f010743d <vprintfmt>:
+{
+f010743d:	55                   	push   %ebp
+f010743e:	89 e5                	mov    %esp,%ebp
+f0107440:	57                   	push   %edi
+f0107441:	56                   	push   %esi
+f0107442:	53                   	push   %ebx
+f0107443:	83 ec 2c             	sub    $0x2c,%esp
+f0107446:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0107449:	89 df                	mov    %ebx,%edi
+f010744b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f010744e:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107451:	8d 70 01             	lea    0x1(%eax),%esi
+f0107454:	0f b6 00             	movzbl (%eax),%eax
+f0107457:	83 f8 25             	cmp    $0x25,%eax
+f010745a:	74 1e                	je     f010747a <vprintfmt+0x3d>
+			if (ch == '\0')
+f010745c:	85 c0                	test   %eax,%eax
+f010745e:	0f 84 15 05 00 00    	je     f0107979 <vprintfmt+0x53c>
+			putch(ch, putdat);
+f0107464:	83 ec 08             	sub    $0x8,%esp
+f0107467:	53                   	push   %ebx
+f0107468:	50                   	push   %eax
+f0107469:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f010746b:	83 c6 01             	add    $0x1,%esi
+f010746e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f0107472:	83 c4 10             	add    $0x10,%esp
+f0107475:	83 f8 25             	cmp    $0x25,%eax
+f0107478:	75 e2                	jne    f010745c <vprintfmt+0x1f>
+		padc = ' ';
+f010747a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+f010747e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+f0107485:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+f010748c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+f0107493:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107498:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f010749b:	8d 56 01             	lea    0x1(%esi),%edx
+f010749e:	0f b6 0e             	movzbl (%esi),%ecx
+f01074a1:	8d 41 dd             	lea    -0x23(%ecx),%eax
+f01074a4:	3c 55                	cmp    $0x55,%al
+f01074a6:	0f 87 3b 04 00 00    	ja     f01078e7 <vprintfmt+0x4aa>
+f01074ac:	0f b6 c0             	movzbl %al,%eax
+f01074af:	ff 24 85 40 ca 10 f0 	jmp    *-0xfef35c0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f01074b6:	89 75 10             	mov    %esi,0x10(%ebp)
+f01074b9:	eb 93                	jmp    f010744e <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+f01074bb:	89 d6                	mov    %edx,%esi
+			padc = '-';
+f01074bd:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+f01074c1:	eb d8                	jmp    f010749b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+f01074c3:	89 d6                	mov    %edx,%esi
+f01074c5:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+f01074c9:	eb d0                	jmp    f010749b <vprintfmt+0x5e>
+f01074cb:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+f01074ce:	8d 41 d0             	lea    -0x30(%ecx),%eax
+f01074d1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+f01074d4:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+f01074d8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+f01074db:	83 f9 09             	cmp    $0x9,%ecx
+f01074de:	77 6f                	ja     f010754f <vprintfmt+0x112>
+f01074e0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+f01074e3:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+f01074e6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+f01074e9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+f01074ed:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+f01074f0:	8d 70 d0             	lea    -0x30(%eax),%esi
+f01074f3:	83 fe 09             	cmp    $0x9,%esi
+f01074f6:	76 eb                	jbe    f01074e3 <vprintfmt+0xa6>
+f01074f8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+f01074fb:	89 d6                	mov    %edx,%esi
+f01074fd:	eb 13                	jmp    f0107512 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+f01074ff:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107502:	8b 00                	mov    (%eax),%eax
+f0107504:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0107507:	8b 45 14             	mov    0x14(%ebp),%eax
+f010750a:	8d 40 04             	lea    0x4(%eax),%eax
+f010750d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0107510:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+f0107512:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0107516:	79 83                	jns    f010749b <vprintfmt+0x5e>
+				width = precision, precision = -1;
+f0107518:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010751b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010751e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+f0107525:	e9 71 ff ff ff       	jmp    f010749b <vprintfmt+0x5e>
+			if (width < 0)
+f010752a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010752d:	85 c9                	test   %ecx,%ecx
+f010752f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107534:	0f 49 c1             	cmovns %ecx,%eax
+f0107537:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f010753a:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+f010753c:	e9 5a ff ff ff       	jmp    f010749b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+f0107541:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+f0107543:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+f010754a:	e9 4c ff ff ff       	jmp    f010749b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+f010754f:	89 d6                	mov    %edx,%esi
+f0107551:	eb bf                	jmp    f0107512 <vprintfmt+0xd5>
+			lflag++;
+f0107553:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0107557:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+f0107559:	e9 3d ff ff ff       	jmp    f010749b <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+f010755e:	89 55 10             	mov    %edx,0x10(%ebp)
+f0107561:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107564:	8d 70 04             	lea    0x4(%eax),%esi
+f0107567:	83 ec 08             	sub    $0x8,%esp
+f010756a:	53                   	push   %ebx
+f010756b:	ff 30                	push   (%eax)
+f010756d:	ff d7                	call   *%edi
+			break;
+f010756f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f0107572:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+f0107575:	e9 d4 fe ff ff       	jmp    f010744e <vprintfmt+0x11>
+			err = va_arg(ap, int);
+f010757a:	89 55 10             	mov    %edx,0x10(%ebp)
+f010757d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107580:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+f0107583:	8b 10                	mov    (%eax),%edx
+f0107585:	89 d0                	mov    %edx,%eax
+f0107587:	f7 d8                	neg    %eax
+f0107589:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f010758c:	83 f8 12             	cmp    $0x12,%eax
+f010758f:	7f 23                	jg     f01075b4 <vprintfmt+0x177>
+f0107591:	8b 14 85 a0 cb 10 f0 	mov    -0xfef3460(,%eax,4),%edx
+f0107598:	85 d2                	test   %edx,%edx
+f010759a:	74 18                	je     f01075b4 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+f010759c:	52                   	push   %edx
+f010759d:	68 fa b8 10 f0       	push   $0xf010b8fa
+f01075a2:	53                   	push   %ebx
+f01075a3:	57                   	push   %edi
+f01075a4:	e8 77 fe ff ff       	call   f0107420 <printfmt>
+f01075a9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f01075ac:	89 75 14             	mov    %esi,0x14(%ebp)
+f01075af:	e9 9a fe ff ff       	jmp    f010744e <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+f01075b4:	50                   	push   %eax
+f01075b5:	68 02 c9 10 f0       	push   $0xf010c902
+f01075ba:	53                   	push   %ebx
+f01075bb:	57                   	push   %edi
+f01075bc:	e8 5f fe ff ff       	call   f0107420 <printfmt>
+f01075c1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f01075c4:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f01075c7:	e9 82 fe ff ff       	jmp    f010744e <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+f01075cc:	89 55 10             	mov    %edx,0x10(%ebp)
+f01075cf:	8b 45 14             	mov    0x14(%ebp),%eax
+f01075d2:	83 c0 04             	add    $0x4,%eax
+f01075d5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f01075d8:	8b 45 14             	mov    0x14(%ebp),%eax
+f01075db:	8b 00                	mov    (%eax),%eax
+f01075dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01075e0:	85 c0                	test   %eax,%eax
+f01075e2:	0f 84 61 03 00 00    	je     f0107949 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+f01075e8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f01075ec:	7e 06                	jle    f01075f4 <vprintfmt+0x1b7>
+f01075ee:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+f01075f2:	75 29                	jne    f010761d <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f01075f4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01075f7:	8d 70 01             	lea    0x1(%eax),%esi
+f01075fa:	0f b6 00             	movzbl (%eax),%eax
+f01075fd:	0f be d0             	movsbl %al,%edx
+f0107600:	85 d2                	test   %edx,%edx
+f0107602:	0f 84 bb 00 00 00    	je     f01076c3 <vprintfmt+0x286>
+f0107608:	89 7d 08             	mov    %edi,0x8(%ebp)
+f010760b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010760e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f0107611:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0107614:	eb 7a                	jmp    f0107690 <vprintfmt+0x253>
+				p = "(null)";
+f0107616:	c7 45 d0 fb c8 10 f0 	movl   $0xf010c8fb,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f010761d:	83 ec 08             	sub    $0x8,%esp
+f0107620:	ff 75 d4             	push   -0x2c(%ebp)
+f0107623:	ff 75 d0             	push   -0x30(%ebp)
+f0107626:	e8 ce 04 00 00       	call   f0107af9 <strnlen>
+f010762b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+f010762e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0107631:	83 c4 10             	add    $0x10,%esp
+f0107634:	85 d2                	test   %edx,%edx
+f0107636:	0f 8e d6 02 00 00    	jle    f0107912 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+f010763c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+f0107640:	83 ec 08             	sub    $0x8,%esp
+f0107643:	53                   	push   %ebx
+f0107644:	56                   	push   %esi
+f0107645:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0107647:	83 c4 10             	add    $0x10,%esp
+f010764a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+f010764e:	75 f0                	jne    f0107640 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0107650:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0107653:	8d 70 01             	lea    0x1(%eax),%esi
+f0107656:	0f b6 00             	movzbl (%eax),%eax
+f0107659:	0f be d0             	movsbl %al,%edx
+f010765c:	85 d2                	test   %edx,%edx
+f010765e:	0f 84 da 02 00 00    	je     f010793e <vprintfmt+0x501>
+f0107664:	89 7d 08             	mov    %edi,0x8(%ebp)
+f0107667:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010766a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f010766d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0107670:	eb 1e                	jmp    f0107690 <vprintfmt+0x253>
+					putch(ch, putdat);
+f0107672:	83 ec 08             	sub    $0x8,%esp
+f0107675:	ff 75 0c             	push   0xc(%ebp)
+f0107678:	52                   	push   %edx
+f0107679:	ff 55 08             	call   *0x8(%ebp)
+f010767c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f010767f:	83 eb 01             	sub    $0x1,%ebx
+f0107682:	83 c6 01             	add    $0x1,%esi
+f0107685:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f0107689:	0f be d0             	movsbl %al,%edx
+f010768c:	85 d2                	test   %edx,%edx
+f010768e:	74 2a                	je     f01076ba <vprintfmt+0x27d>
+f0107690:	85 ff                	test   %edi,%edi
+f0107692:	78 05                	js     f0107699 <vprintfmt+0x25c>
+f0107694:	83 ef 01             	sub    $0x1,%edi
+f0107697:	78 59                	js     f01076f2 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+f0107699:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f010769d:	74 d3                	je     f0107672 <vprintfmt+0x235>
+f010769f:	0f be c0             	movsbl %al,%eax
+f01076a2:	83 e8 20             	sub    $0x20,%eax
+f01076a5:	83 f8 5e             	cmp    $0x5e,%eax
+f01076a8:	76 c8                	jbe    f0107672 <vprintfmt+0x235>
+					putch('?', putdat);
+f01076aa:	83 ec 08             	sub    $0x8,%esp
+f01076ad:	ff 75 0c             	push   0xc(%ebp)
+f01076b0:	6a 3f                	push   $0x3f
+f01076b2:	ff 55 08             	call   *0x8(%ebp)
+f01076b5:	83 c4 10             	add    $0x10,%esp
+f01076b8:	eb c5                	jmp    f010767f <vprintfmt+0x242>
+f01076ba:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f01076bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01076c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+f01076c3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01076c6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f01076ca:	7e 1b                	jle    f01076e7 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+f01076cc:	83 ec 08             	sub    $0x8,%esp
+f01076cf:	53                   	push   %ebx
+f01076d0:	6a 20                	push   $0x20
+f01076d2:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+f01076d4:	83 c4 10             	add    $0x10,%esp
+f01076d7:	83 ee 01             	sub    $0x1,%esi
+f01076da:	75 f0                	jne    f01076cc <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+f01076dc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01076df:	89 45 14             	mov    %eax,0x14(%ebp)
+f01076e2:	e9 67 fd ff ff       	jmp    f010744e <vprintfmt+0x11>
+f01076e7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01076ea:	89 45 14             	mov    %eax,0x14(%ebp)
+f01076ed:	e9 5c fd ff ff       	jmp    f010744e <vprintfmt+0x11>
+f01076f2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f01076f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01076f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01076fb:	eb c6                	jmp    f01076c3 <vprintfmt+0x286>
+	if (lflag >= 2)
+f01076fd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0107700:	89 55 10             	mov    %edx,0x10(%ebp)
+f0107703:	83 f9 01             	cmp    $0x1,%ecx
+f0107706:	7f 1f                	jg     f0107727 <vprintfmt+0x2ea>
+	else if (lflag)
+f0107708:	85 c9                	test   %ecx,%ecx
+f010770a:	74 67                	je     f0107773 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+f010770c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010770f:	8b 30                	mov    (%eax),%esi
+f0107711:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f0107714:	89 f0                	mov    %esi,%eax
+f0107716:	c1 f8 1f             	sar    $0x1f,%eax
+f0107719:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010771c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010771f:	8d 40 04             	lea    0x4(%eax),%eax
+f0107722:	89 45 14             	mov    %eax,0x14(%ebp)
+f0107725:	eb 17                	jmp    f010773e <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+f0107727:	8b 45 14             	mov    0x14(%ebp),%eax
+f010772a:	8b 50 04             	mov    0x4(%eax),%edx
+f010772d:	8b 00                	mov    (%eax),%eax
+f010772f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0107732:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0107735:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107738:	8d 40 08             	lea    0x8(%eax),%eax
+f010773b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f010773e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0107741:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+f0107744:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+f0107749:	85 c9                	test   %ecx,%ecx
+f010774b:	0f 89 12 01 00 00    	jns    f0107863 <vprintfmt+0x426>
+				putch('-', putdat);
+f0107751:	83 ec 08             	sub    $0x8,%esp
+f0107754:	53                   	push   %ebx
+f0107755:	6a 2d                	push   $0x2d
+f0107757:	ff d7                	call   *%edi
+				num = -(long long) num;
+f0107759:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f010775c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010775f:	f7 da                	neg    %edx
+f0107761:	83 d1 00             	adc    $0x0,%ecx
+f0107764:	f7 d9                	neg    %ecx
+f0107766:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f0107769:	be 0a 00 00 00       	mov    $0xa,%esi
+f010776e:	e9 f0 00 00 00       	jmp    f0107863 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+f0107773:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107776:	8b 30                	mov    (%eax),%esi
+f0107778:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f010777b:	89 f0                	mov    %esi,%eax
+f010777d:	c1 f8 1f             	sar    $0x1f,%eax
+f0107780:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0107783:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107786:	8d 40 04             	lea    0x4(%eax),%eax
+f0107789:	89 45 14             	mov    %eax,0x14(%ebp)
+f010778c:	eb b0                	jmp    f010773e <vprintfmt+0x301>
+	if (lflag >= 2)
+f010778e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0107791:	89 55 10             	mov    %edx,0x10(%ebp)
+f0107794:	83 f9 01             	cmp    $0x1,%ecx
+f0107797:	7f 1e                	jg     f01077b7 <vprintfmt+0x37a>
+	else if (lflag)
+f0107799:	85 c9                	test   %ecx,%ecx
+f010779b:	74 32                	je     f01077cf <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+f010779d:	8b 45 14             	mov    0x14(%ebp),%eax
+f01077a0:	8b 10                	mov    (%eax),%edx
+f01077a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01077a7:	8d 40 04             	lea    0x4(%eax),%eax
+f01077aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f01077ad:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+f01077b2:	e9 ac 00 00 00       	jmp    f0107863 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+f01077b7:	8b 45 14             	mov    0x14(%ebp),%eax
+f01077ba:	8b 10                	mov    (%eax),%edx
+f01077bc:	8b 48 04             	mov    0x4(%eax),%ecx
+f01077bf:	8d 40 08             	lea    0x8(%eax),%eax
+f01077c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f01077c5:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+f01077ca:	e9 94 00 00 00       	jmp    f0107863 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+f01077cf:	8b 45 14             	mov    0x14(%ebp),%eax
+f01077d2:	8b 10                	mov    (%eax),%edx
+f01077d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01077d9:	8d 40 04             	lea    0x4(%eax),%eax
+f01077dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f01077df:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+f01077e4:	eb 7d                	jmp    f0107863 <vprintfmt+0x426>
+	if (lflag >= 2)
+f01077e6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f01077e9:	89 55 10             	mov    %edx,0x10(%ebp)
+f01077ec:	83 f9 01             	cmp    $0x1,%ecx
+f01077ef:	7f 1b                	jg     f010780c <vprintfmt+0x3cf>
+	else if (lflag)
+f01077f1:	85 c9                	test   %ecx,%ecx
+f01077f3:	74 2c                	je     f0107821 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+f01077f5:	8b 45 14             	mov    0x14(%ebp),%eax
+f01077f8:	8b 10                	mov    (%eax),%edx
+f01077fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01077ff:	8d 40 04             	lea    0x4(%eax),%eax
+f0107802:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0107805:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+f010780a:	eb 57                	jmp    f0107863 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+f010780c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010780f:	8b 10                	mov    (%eax),%edx
+f0107811:	8b 48 04             	mov    0x4(%eax),%ecx
+f0107814:	8d 40 08             	lea    0x8(%eax),%eax
+f0107817:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f010781a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+f010781f:	eb 42                	jmp    f0107863 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+f0107821:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107824:	8b 10                	mov    (%eax),%edx
+f0107826:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010782b:	8d 40 04             	lea    0x4(%eax),%eax
+f010782e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0107831:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+f0107836:	eb 2b                	jmp    f0107863 <vprintfmt+0x426>
+			putch('0', putdat);
+f0107838:	89 55 10             	mov    %edx,0x10(%ebp)
+f010783b:	83 ec 08             	sub    $0x8,%esp
+f010783e:	53                   	push   %ebx
+f010783f:	6a 30                	push   $0x30
+f0107841:	ff d7                	call   *%edi
+			putch('x', putdat);
+f0107843:	83 c4 08             	add    $0x8,%esp
+f0107846:	53                   	push   %ebx
+f0107847:	6a 78                	push   $0x78
+f0107849:	ff d7                	call   *%edi
+			num = (unsigned long long)
+f010784b:	8b 45 14             	mov    0x14(%ebp),%eax
+f010784e:	8b 10                	mov    (%eax),%edx
+f0107850:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+f0107855:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f0107858:	8d 40 04             	lea    0x4(%eax),%eax
+f010785b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f010785e:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+f0107863:	83 ec 0c             	sub    $0xc,%esp
+f0107866:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+f010786a:	50                   	push   %eax
+f010786b:	ff 75 e4             	push   -0x1c(%ebp)
+f010786e:	56                   	push   %esi
+f010786f:	51                   	push   %ecx
+f0107870:	52                   	push   %edx
+f0107871:	89 da                	mov    %ebx,%edx
+f0107873:	89 f8                	mov    %edi,%eax
+f0107875:	e8 d8 fa ff ff       	call   f0107352 <printnum>
+			break;
+f010787a:	83 c4 20             	add    $0x20,%esp
+f010787d:	e9 cc fb ff ff       	jmp    f010744e <vprintfmt+0x11>
+	if (lflag >= 2)
+f0107882:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0107885:	89 55 10             	mov    %edx,0x10(%ebp)
+f0107888:	83 f9 01             	cmp    $0x1,%ecx
+f010788b:	7f 1b                	jg     f01078a8 <vprintfmt+0x46b>
+	else if (lflag)
+f010788d:	85 c9                	test   %ecx,%ecx
+f010788f:	74 2c                	je     f01078bd <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+f0107891:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107894:	8b 10                	mov    (%eax),%edx
+f0107896:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010789b:	8d 40 04             	lea    0x4(%eax),%eax
+f010789e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f01078a1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+f01078a6:	eb bb                	jmp    f0107863 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+f01078a8:	8b 45 14             	mov    0x14(%ebp),%eax
+f01078ab:	8b 10                	mov    (%eax),%edx
+f01078ad:	8b 48 04             	mov    0x4(%eax),%ecx
+f01078b0:	8d 40 08             	lea    0x8(%eax),%eax
+f01078b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f01078b6:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+f01078bb:	eb a6                	jmp    f0107863 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+f01078bd:	8b 45 14             	mov    0x14(%ebp),%eax
+f01078c0:	8b 10                	mov    (%eax),%edx
+f01078c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01078c7:	8d 40 04             	lea    0x4(%eax),%eax
+f01078ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f01078cd:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+f01078d2:	eb 8f                	jmp    f0107863 <vprintfmt+0x426>
+			putch(ch, putdat);
+f01078d4:	89 55 10             	mov    %edx,0x10(%ebp)
+f01078d7:	83 ec 08             	sub    $0x8,%esp
+f01078da:	53                   	push   %ebx
+f01078db:	6a 25                	push   $0x25
+f01078dd:	ff d7                	call   *%edi
+			break;
+f01078df:	83 c4 10             	add    $0x10,%esp
+f01078e2:	e9 67 fb ff ff       	jmp    f010744e <vprintfmt+0x11>
+			putch('%', putdat);
+f01078e7:	83 ec 08             	sub    $0x8,%esp
+f01078ea:	53                   	push   %ebx
+f01078eb:	6a 25                	push   $0x25
+f01078ed:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f01078ef:	83 c4 10             	add    $0x10,%esp
+f01078f2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+f01078f6:	0f 84 ba fb ff ff    	je     f01074b6 <vprintfmt+0x79>
+f01078fc:	89 75 10             	mov    %esi,0x10(%ebp)
+f01078ff:	89 f0                	mov    %esi,%eax
+f0107901:	83 e8 01             	sub    $0x1,%eax
+f0107904:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f0107908:	75 f7                	jne    f0107901 <vprintfmt+0x4c4>
+f010790a:	89 45 10             	mov    %eax,0x10(%ebp)
+f010790d:	e9 3c fb ff ff       	jmp    f010744e <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0107912:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0107915:	8d 70 01             	lea    0x1(%eax),%esi
+f0107918:	0f b6 00             	movzbl (%eax),%eax
+f010791b:	0f be d0             	movsbl %al,%edx
+f010791e:	85 d2                	test   %edx,%edx
+f0107920:	74 11                	je     f0107933 <vprintfmt+0x4f6>
+f0107922:	89 7d 08             	mov    %edi,0x8(%ebp)
+f0107925:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0107928:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f010792b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f010792e:	e9 5d fd ff ff       	jmp    f0107690 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0107933:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0107936:	89 45 14             	mov    %eax,0x14(%ebp)
+f0107939:	e9 10 fb ff ff       	jmp    f010744e <vprintfmt+0x11>
+f010793e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0107941:	89 45 14             	mov    %eax,0x14(%ebp)
+f0107944:	e9 05 fb ff ff       	jmp    f010744e <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+f0107949:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f010794d:	7e 0a                	jle    f0107959 <vprintfmt+0x51c>
+f010794f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+f0107953:	0f 85 bd fc ff ff    	jne    f0107616 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0107959:	ba 28 00 00 00       	mov    $0x28,%edx
+f010795e:	b8 28 00 00 00       	mov    $0x28,%eax
+f0107963:	be fc c8 10 f0       	mov    $0xf010c8fc,%esi
+f0107968:	89 7d 08             	mov    %edi,0x8(%ebp)
+f010796b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010796e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f0107971:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0107974:	e9 17 fd ff ff       	jmp    f0107690 <vprintfmt+0x253>
+}
+f0107979:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010797c:	5b                   	pop    %ebx
+f010797d:	5e                   	pop    %esi
+f010797e:	5f                   	pop    %edi
+f010797f:	5d                   	pop    %ebp
+f0107980:	c3                   	ret
+
+f0107981 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f0107981:	55                   	push   %ebp
+f0107982:	89 e5                	mov    %esp,%ebp
+f0107984:	83 ec 18             	sub    $0x18,%esp
+f0107987:	8b 45 08             	mov    0x8(%ebp),%eax
+f010798a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f010798d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0107990:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f0107994:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0107997:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f010799e:	85 c0                	test   %eax,%eax
+f01079a0:	74 26                	je     f01079c8 <vsnprintf+0x47>
+f01079a2:	85 d2                	test   %edx,%edx
+f01079a4:	7e 22                	jle    f01079c8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f01079a6:	ff 75 14             	push   0x14(%ebp)
+f01079a9:	ff 75 10             	push   0x10(%ebp)
+f01079ac:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f01079af:	50                   	push   %eax
+f01079b0:	68 03 74 10 f0       	push   $0xf0107403
+f01079b5:	e8 83 fa ff ff       	call   f010743d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f01079ba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f01079bd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f01079c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01079c3:	83 c4 10             	add    $0x10,%esp
+}
+f01079c6:	c9                   	leave
+f01079c7:	c3                   	ret
+		return -E_INVAL;
+f01079c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01079cd:	eb f7                	jmp    f01079c6 <vsnprintf+0x45>
+
+f01079cf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f01079cf:	55                   	push   %ebp
+f01079d0:	89 e5                	mov    %esp,%ebp
+f01079d2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f01079d5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f01079d8:	50                   	push   %eax
+f01079d9:	ff 75 10             	push   0x10(%ebp)
+f01079dc:	ff 75 0c             	push   0xc(%ebp)
+f01079df:	ff 75 08             	push   0x8(%ebp)
+f01079e2:	e8 9a ff ff ff       	call   f0107981 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f01079e7:	c9                   	leave
+f01079e8:	c3                   	ret
+
+f01079e9 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f01079e9:	55                   	push   %ebp
+f01079ea:	89 e5                	mov    %esp,%ebp
+f01079ec:	57                   	push   %edi
+f01079ed:	56                   	push   %esi
+f01079ee:	53                   	push   %ebx
+f01079ef:	83 ec 0c             	sub    $0xc,%esp
+f01079f2:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+f01079f5:	85 c0                	test   %eax,%eax
+f01079f7:	74 11                	je     f0107a0a <readline+0x21>
+		cprintf("%s", prompt);
+f01079f9:	83 ec 08             	sub    $0x8,%esp
+f01079fc:	50                   	push   %eax
+f01079fd:	68 fa b8 10 f0       	push   $0xf010b8fa
+f0107a02:	e8 e5 cc ff ff       	call   f01046ec <cprintf>
+f0107a07:	83 c4 10             	add    $0x10,%esp
+	if (prompt != NULL)
+		fprintf(1, "%s", prompt);
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+f0107a0a:	83 ec 0c             	sub    $0xc,%esp
+f0107a0d:	6a 00                	push   $0x0
+f0107a0f:	e8 20 8e ff ff       	call   f0100834 <iscons>
+f0107a14:	89 c7                	mov    %eax,%edi
+f0107a16:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f0107a19:	be 00 00 00 00       	mov    $0x0,%esi
+f0107a1e:	eb 4b                	jmp    f0107a6b <readline+0x82>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+f0107a20:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+f0107a25:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f0107a28:	75 08                	jne    f0107a32 <readline+0x49>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f0107a2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107a2d:	5b                   	pop    %ebx
+f0107a2e:	5e                   	pop    %esi
+f0107a2f:	5f                   	pop    %edi
+f0107a30:	5d                   	pop    %ebp
+f0107a31:	c3                   	ret
+				cprintf("read error: %e\n", c);
+f0107a32:	83 ec 08             	sub    $0x8,%esp
+f0107a35:	53                   	push   %ebx
+f0107a36:	68 0b cc 10 f0       	push   $0xf010cc0b
+f0107a3b:	e8 ac cc ff ff       	call   f01046ec <cprintf>
+f0107a40:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+f0107a43:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107a48:	eb e0                	jmp    f0107a2a <readline+0x41>
+			if (echoing)
+f0107a4a:	85 ff                	test   %edi,%edi
+f0107a4c:	75 05                	jne    f0107a53 <readline+0x6a>
+			i--;
+f0107a4e:	83 ee 01             	sub    $0x1,%esi
+f0107a51:	eb 18                	jmp    f0107a6b <readline+0x82>
+				cputchar('\b');
+f0107a53:	83 ec 0c             	sub    $0xc,%esp
+f0107a56:	6a 08                	push   $0x8
+f0107a58:	e8 b6 8d ff ff       	call   f0100813 <cputchar>
+f0107a5d:	83 c4 10             	add    $0x10,%esp
+f0107a60:	eb ec                	jmp    f0107a4e <readline+0x65>
+			buf[i++] = c;
+f0107a62:	88 9e 80 ca 92 f0    	mov    %bl,-0xf6d3580(%esi)
+f0107a68:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+f0107a6b:	e8 b3 8d ff ff       	call   f0100823 <getchar>
+f0107a70:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+f0107a72:	85 c0                	test   %eax,%eax
+f0107a74:	78 aa                	js     f0107a20 <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f0107a76:	83 f8 08             	cmp    $0x8,%eax
+f0107a79:	0f 94 c0             	sete   %al
+f0107a7c:	83 fb 7f             	cmp    $0x7f,%ebx
+f0107a7f:	0f 94 c2             	sete   %dl
+f0107a82:	08 d0                	or     %dl,%al
+f0107a84:	74 04                	je     f0107a8a <readline+0xa1>
+f0107a86:	85 f6                	test   %esi,%esi
+f0107a88:	7f c0                	jg     f0107a4a <readline+0x61>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f0107a8a:	83 fb 1f             	cmp    $0x1f,%ebx
+f0107a8d:	7e 1a                	jle    f0107aa9 <readline+0xc0>
+f0107a8f:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f0107a95:	7f 12                	jg     f0107aa9 <readline+0xc0>
+			if (echoing)
+f0107a97:	85 ff                	test   %edi,%edi
+f0107a99:	74 c7                	je     f0107a62 <readline+0x79>
+				cputchar(c);
+f0107a9b:	83 ec 0c             	sub    $0xc,%esp
+f0107a9e:	53                   	push   %ebx
+f0107a9f:	e8 6f 8d ff ff       	call   f0100813 <cputchar>
+f0107aa4:	83 c4 10             	add    $0x10,%esp
+f0107aa7:	eb b9                	jmp    f0107a62 <readline+0x79>
+		} else if (c == '\n' || c == '\r') {
+f0107aa9:	83 fb 0a             	cmp    $0xa,%ebx
+f0107aac:	74 05                	je     f0107ab3 <readline+0xca>
+f0107aae:	83 fb 0d             	cmp    $0xd,%ebx
+f0107ab1:	75 b8                	jne    f0107a6b <readline+0x82>
+			if (echoing)
+f0107ab3:	85 ff                	test   %edi,%edi
+f0107ab5:	75 11                	jne    f0107ac8 <readline+0xdf>
+			buf[i] = 0;
+f0107ab7:	c6 86 80 ca 92 f0 00 	movb   $0x0,-0xf6d3580(%esi)
+			return buf;
+f0107abe:	b8 80 ca 92 f0       	mov    $0xf092ca80,%eax
+f0107ac3:	e9 62 ff ff ff       	jmp    f0107a2a <readline+0x41>
+				cputchar('\n');
+f0107ac8:	83 ec 0c             	sub    $0xc,%esp
+f0107acb:	6a 0a                	push   $0xa
+f0107acd:	e8 41 8d ff ff       	call   f0100813 <cputchar>
+f0107ad2:	83 c4 10             	add    $0x10,%esp
+f0107ad5:	eb e0                	jmp    f0107ab7 <readline+0xce>
+
+f0107ad7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f0107ad7:	55                   	push   %ebp
+f0107ad8:	89 e5                	mov    %esp,%ebp
+f0107ada:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f0107add:	80 3a 00             	cmpb   $0x0,(%edx)
+f0107ae0:	74 10                	je     f0107af2 <strlen+0x1b>
+f0107ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+f0107ae7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f0107aea:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0107aee:	75 f7                	jne    f0107ae7 <strlen+0x10>
+	return n;
+}
+f0107af0:	5d                   	pop    %ebp
+f0107af1:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+f0107af2:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+f0107af7:	eb f7                	jmp    f0107af0 <strlen+0x19>
+
+f0107af9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f0107af9:	55                   	push   %ebp
+f0107afa:	89 e5                	mov    %esp,%ebp
+f0107afc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107aff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0107b02:	85 d2                	test   %edx,%edx
+f0107b04:	74 16                	je     f0107b1c <strnlen+0x23>
+f0107b06:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107b0b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f0107b0f:	74 09                	je     f0107b1a <strnlen+0x21>
+		n++;
+f0107b11:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0107b14:	39 d0                	cmp    %edx,%eax
+f0107b16:	75 f3                	jne    f0107b0b <strnlen+0x12>
+		n++;
+f0107b18:	89 d0                	mov    %edx,%eax
+	return n;
+}
+f0107b1a:	5d                   	pop    %ebp
+f0107b1b:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0107b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107b21:	eb f7                	jmp    f0107b1a <strnlen+0x21>
+
+f0107b23 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f0107b23:	55                   	push   %ebp
+f0107b24:	89 e5                	mov    %esp,%ebp
+f0107b26:	53                   	push   %ebx
+f0107b27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107b2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f0107b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107b32:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f0107b36:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0107b39:	83 c0 01             	add    $0x1,%eax
+f0107b3c:	84 d2                	test   %dl,%dl
+f0107b3e:	75 f2                	jne    f0107b32 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f0107b40:	89 c8                	mov    %ecx,%eax
+f0107b42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107b45:	c9                   	leave
+f0107b46:	c3                   	ret
+
+f0107b47 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f0107b47:	55                   	push   %ebp
+f0107b48:	89 e5                	mov    %esp,%ebp
+f0107b4a:	53                   	push   %ebx
+f0107b4b:	83 ec 10             	sub    $0x10,%esp
+f0107b4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f0107b51:	53                   	push   %ebx
+f0107b52:	e8 80 ff ff ff       	call   f0107ad7 <strlen>
+f0107b57:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f0107b5a:	ff 75 0c             	push   0xc(%ebp)
+f0107b5d:	01 d8                	add    %ebx,%eax
+f0107b5f:	50                   	push   %eax
+f0107b60:	e8 be ff ff ff       	call   f0107b23 <strcpy>
+	return dst;
+}
+f0107b65:	89 d8                	mov    %ebx,%eax
+f0107b67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107b6a:	c9                   	leave
+f0107b6b:	c3                   	ret
+
+f0107b6c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f0107b6c:	55                   	push   %ebp
+f0107b6d:	89 e5                	mov    %esp,%ebp
+f0107b6f:	56                   	push   %esi
+f0107b70:	53                   	push   %ebx
+f0107b71:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107b74:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107b77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f0107b7a:	85 db                	test   %ebx,%ebx
+f0107b7c:	74 17                	je     f0107b95 <strncpy+0x29>
+f0107b7e:	01 f3                	add    %esi,%ebx
+f0107b80:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+f0107b82:	83 c0 01             	add    $0x1,%eax
+f0107b85:	0f b6 0a             	movzbl (%edx),%ecx
+f0107b88:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f0107b8b:	80 f9 01             	cmp    $0x1,%cl
+f0107b8e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f0107b91:	39 c3                	cmp    %eax,%ebx
+f0107b93:	75 ed                	jne    f0107b82 <strncpy+0x16>
+	}
+	return ret;
+}
+f0107b95:	89 f0                	mov    %esi,%eax
+f0107b97:	5b                   	pop    %ebx
+f0107b98:	5e                   	pop    %esi
+f0107b99:	5d                   	pop    %ebp
+f0107b9a:	c3                   	ret
+
+f0107b9b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f0107b9b:	55                   	push   %ebp
+f0107b9c:	89 e5                	mov    %esp,%ebp
+f0107b9e:	56                   	push   %esi
+f0107b9f:	53                   	push   %ebx
+f0107ba0:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107ba3:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107ba6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f0107ba9:	89 f0                	mov    %esi,%eax
+f0107bab:	85 db                	test   %ebx,%ebx
+f0107bad:	74 1e                	je     f0107bcd <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+f0107baf:	83 eb 01             	sub    $0x1,%ebx
+f0107bb2:	74 16                	je     f0107bca <strlcpy+0x2f>
+f0107bb4:	01 f3                	add    %esi,%ebx
+f0107bb6:	0f b6 0a             	movzbl (%edx),%ecx
+f0107bb9:	84 c9                	test   %cl,%cl
+f0107bbb:	74 0d                	je     f0107bca <strlcpy+0x2f>
+			*dst++ = *src++;
+f0107bbd:	83 c2 01             	add    $0x1,%edx
+f0107bc0:	83 c0 01             	add    $0x1,%eax
+f0107bc3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+f0107bc6:	39 d8                	cmp    %ebx,%eax
+f0107bc8:	75 ec                	jne    f0107bb6 <strlcpy+0x1b>
+		*dst = '\0';
+f0107bca:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f0107bcd:	29 f0                	sub    %esi,%eax
+}
+f0107bcf:	5b                   	pop    %ebx
+f0107bd0:	5e                   	pop    %esi
+f0107bd1:	5d                   	pop    %ebp
+f0107bd2:	c3                   	ret
+
+f0107bd3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f0107bd3:	55                   	push   %ebp
+f0107bd4:	89 e5                	mov    %esp,%ebp
+f0107bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107bd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f0107bdc:	0f b6 01             	movzbl (%ecx),%eax
+f0107bdf:	84 c0                	test   %al,%al
+f0107be1:	74 11                	je     f0107bf4 <strcmp+0x21>
+f0107be3:	38 02                	cmp    %al,(%edx)
+f0107be5:	75 0d                	jne    f0107bf4 <strcmp+0x21>
+		p++, q++;
+f0107be7:	83 c1 01             	add    $0x1,%ecx
+f0107bea:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f0107bed:	0f b6 01             	movzbl (%ecx),%eax
+f0107bf0:	84 c0                	test   %al,%al
+f0107bf2:	75 ef                	jne    f0107be3 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f0107bf4:	0f b6 c0             	movzbl %al,%eax
+f0107bf7:	0f b6 12             	movzbl (%edx),%edx
+f0107bfa:	29 d0                	sub    %edx,%eax
+}
+f0107bfc:	5d                   	pop    %ebp
+f0107bfd:	c3                   	ret
+
+f0107bfe <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f0107bfe:	55                   	push   %ebp
+f0107bff:	89 e5                	mov    %esp,%ebp
+f0107c01:	53                   	push   %ebx
+f0107c02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107c05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0107c08:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+f0107c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+f0107c10:	85 d2                	test   %edx,%edx
+f0107c12:	74 2e                	je     f0107c42 <strncmp+0x44>
+f0107c14:	0f b6 01             	movzbl (%ecx),%eax
+f0107c17:	84 c0                	test   %al,%al
+f0107c19:	74 16                	je     f0107c31 <strncmp+0x33>
+f0107c1b:	3a 03                	cmp    (%ebx),%al
+f0107c1d:	75 12                	jne    f0107c31 <strncmp+0x33>
+		n--, p++, q++;
+f0107c1f:	83 c1 01             	add    $0x1,%ecx
+f0107c22:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+f0107c25:	83 ea 01             	sub    $0x1,%edx
+f0107c28:	75 ea                	jne    f0107c14 <strncmp+0x16>
+		return 0;
+f0107c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107c2f:	eb 11                	jmp    f0107c42 <strncmp+0x44>
+f0107c31:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+f0107c36:	85 d2                	test   %edx,%edx
+f0107c38:	74 08                	je     f0107c42 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f0107c3a:	0f b6 01             	movzbl (%ecx),%eax
+f0107c3d:	0f b6 13             	movzbl (%ebx),%edx
+f0107c40:	29 d0                	sub    %edx,%eax
+}
+f0107c42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107c45:	c9                   	leave
+f0107c46:	c3                   	ret
+
+f0107c47 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f0107c47:	55                   	push   %ebp
+f0107c48:	89 e5                	mov    %esp,%ebp
+f0107c4a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107c4d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0107c51:	0f b6 10             	movzbl (%eax),%edx
+f0107c54:	84 d2                	test   %dl,%dl
+f0107c56:	74 15                	je     f0107c6d <strchr+0x26>
+		if (*s == c)
+f0107c58:	38 d1                	cmp    %dl,%cl
+f0107c5a:	74 0f                	je     f0107c6b <strchr+0x24>
+	for (; *s; s++)
+f0107c5c:	83 c0 01             	add    $0x1,%eax
+f0107c5f:	0f b6 10             	movzbl (%eax),%edx
+f0107c62:	84 d2                	test   %dl,%dl
+f0107c64:	75 f2                	jne    f0107c58 <strchr+0x11>
+			return (char *) s;
+	return 0;
+f0107c66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107c6b:	5d                   	pop    %ebp
+f0107c6c:	c3                   	ret
+	return 0;
+f0107c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107c72:	eb f7                	jmp    f0107c6b <strchr+0x24>
+
+f0107c74 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f0107c74:	55                   	push   %ebp
+f0107c75:	89 e5                	mov    %esp,%ebp
+f0107c77:	53                   	push   %ebx
+f0107c78:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107c7b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+f0107c7e:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+f0107c81:	38 d3                	cmp    %dl,%bl
+f0107c83:	74 14                	je     f0107c99 <strfind+0x25>
+f0107c85:	89 d1                	mov    %edx,%ecx
+f0107c87:	84 db                	test   %bl,%bl
+f0107c89:	74 0e                	je     f0107c99 <strfind+0x25>
+	for (; *s; s++)
+f0107c8b:	83 c0 01             	add    $0x1,%eax
+f0107c8e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f0107c91:	38 ca                	cmp    %cl,%dl
+f0107c93:	74 04                	je     f0107c99 <strfind+0x25>
+f0107c95:	84 d2                	test   %dl,%dl
+f0107c97:	75 f2                	jne    f0107c8b <strfind+0x17>
+			break;
+	return (char *) s;
+}
+f0107c99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107c9c:	c9                   	leave
+f0107c9d:	c3                   	ret
+
+f0107c9e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f0107c9e:	55                   	push   %ebp
+f0107c9f:	89 e5                	mov    %esp,%ebp
+f0107ca1:	57                   	push   %edi
+f0107ca2:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0107ca5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f0107ca8:	85 c9                	test   %ecx,%ecx
+f0107caa:	74 20                	je     f0107ccc <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f0107cac:	89 f8                	mov    %edi,%eax
+f0107cae:	09 c8                	or     %ecx,%eax
+f0107cb0:	a8 03                	test   $0x3,%al
+f0107cb2:	75 12                	jne    f0107cc6 <memset+0x28>
+		c &= 0xFF;
+f0107cb4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f0107cb8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f0107cbe:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f0107cc1:	fc                   	cld
+f0107cc2:	f3 ab                	rep stos %eax,%es:(%edi)
+f0107cc4:	eb 06                	jmp    f0107ccc <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f0107cc6:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107cc9:	fc                   	cld
+f0107cca:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f0107ccc:	89 f8                	mov    %edi,%eax
+f0107cce:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f0107cd1:	c9                   	leave
+f0107cd2:	c3                   	ret
+
+f0107cd3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f0107cd3:	55                   	push   %ebp
+f0107cd4:	89 e5                	mov    %esp,%ebp
+f0107cd6:	57                   	push   %edi
+f0107cd7:	56                   	push   %esi
+f0107cd8:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107cdb:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0107cde:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f0107ce1:	39 c6                	cmp    %eax,%esi
+f0107ce3:	73 32                	jae    f0107d17 <memmove+0x44>
+f0107ce5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f0107ce8:	39 d0                	cmp    %edx,%eax
+f0107cea:	73 2b                	jae    f0107d17 <memmove+0x44>
+		s += n;
+		d += n;
+f0107cec:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0107cef:	89 d6                	mov    %edx,%esi
+f0107cf1:	09 fe                	or     %edi,%esi
+f0107cf3:	09 ce                	or     %ecx,%esi
+f0107cf5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f0107cfb:	75 0e                	jne    f0107d0b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f0107cfd:	83 ef 04             	sub    $0x4,%edi
+f0107d00:	8d 72 fc             	lea    -0x4(%edx),%esi
+f0107d03:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f0107d06:	fd                   	std
+f0107d07:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0107d09:	eb 09                	jmp    f0107d14 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f0107d0b:	83 ef 01             	sub    $0x1,%edi
+f0107d0e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f0107d11:	fd                   	std
+f0107d12:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f0107d14:	fc                   	cld
+f0107d15:	eb 1a                	jmp    f0107d31 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0107d17:	89 f2                	mov    %esi,%edx
+f0107d19:	09 c2                	or     %eax,%edx
+f0107d1b:	09 ca                	or     %ecx,%edx
+f0107d1d:	f6 c2 03             	test   $0x3,%dl
+f0107d20:	75 0a                	jne    f0107d2c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f0107d22:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f0107d25:	89 c7                	mov    %eax,%edi
+f0107d27:	fc                   	cld
+f0107d28:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0107d2a:	eb 05                	jmp    f0107d31 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f0107d2c:	89 c7                	mov    %eax,%edi
+f0107d2e:	fc                   	cld
+f0107d2f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f0107d31:	5e                   	pop    %esi
+f0107d32:	5f                   	pop    %edi
+f0107d33:	5d                   	pop    %ebp
+f0107d34:	c3                   	ret
+
+f0107d35 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+f0107d35:	55                   	push   %ebp
+f0107d36:	89 e5                	mov    %esp,%ebp
+f0107d38:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f0107d3b:	ff 75 10             	push   0x10(%ebp)
+f0107d3e:	ff 75 0c             	push   0xc(%ebp)
+f0107d41:	ff 75 08             	push   0x8(%ebp)
+f0107d44:	e8 8a ff ff ff       	call   f0107cd3 <memmove>
+}
+f0107d49:	c9                   	leave
+f0107d4a:	c3                   	ret
+
+f0107d4b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f0107d4b:	55                   	push   %ebp
+f0107d4c:	89 e5                	mov    %esp,%ebp
+f0107d4e:	56                   	push   %esi
+f0107d4f:	53                   	push   %ebx
+f0107d50:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107d53:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107d56:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f0107d59:	85 f6                	test   %esi,%esi
+f0107d5b:	74 29                	je     f0107d86 <memcmp+0x3b>
+f0107d5d:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+f0107d5f:	0f b6 08             	movzbl (%eax),%ecx
+f0107d62:	0f b6 1a             	movzbl (%edx),%ebx
+f0107d65:	38 d9                	cmp    %bl,%cl
+f0107d67:	75 11                	jne    f0107d7a <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f0107d69:	83 c0 01             	add    $0x1,%eax
+f0107d6c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f0107d6f:	39 c6                	cmp    %eax,%esi
+f0107d71:	75 ec                	jne    f0107d5f <memcmp+0x14>
+	}
+
+	return 0;
+f0107d73:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107d78:	eb 08                	jmp    f0107d82 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+f0107d7a:	0f b6 c1             	movzbl %cl,%eax
+f0107d7d:	0f b6 db             	movzbl %bl,%ebx
+f0107d80:	29 d8                	sub    %ebx,%eax
+}
+f0107d82:	5b                   	pop    %ebx
+f0107d83:	5e                   	pop    %esi
+f0107d84:	5d                   	pop    %ebp
+f0107d85:	c3                   	ret
+	return 0;
+f0107d86:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107d8b:	eb f5                	jmp    f0107d82 <memcmp+0x37>
+
+f0107d8d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f0107d8d:	55                   	push   %ebp
+f0107d8e:	89 e5                	mov    %esp,%ebp
+f0107d90:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107d93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f0107d96:	89 c2                	mov    %eax,%edx
+f0107d98:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f0107d9b:	39 d0                	cmp    %edx,%eax
+f0107d9d:	73 0d                	jae    f0107dac <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f0107d9f:	38 08                	cmp    %cl,(%eax)
+f0107da1:	74 0d                	je     f0107db0 <memfind+0x23>
+	for (; s < ends; s++)
+f0107da3:	83 c0 01             	add    $0x1,%eax
+f0107da6:	39 c2                	cmp    %eax,%edx
+f0107da8:	75 f5                	jne    f0107d9f <memfind+0x12>
+f0107daa:	eb 06                	jmp    f0107db2 <memfind+0x25>
+f0107dac:	89 c2                	mov    %eax,%edx
+f0107dae:	eb 02                	jmp    f0107db2 <memfind+0x25>
+f0107db0:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+f0107db2:	89 d0                	mov    %edx,%eax
+f0107db4:	5d                   	pop    %ebp
+f0107db5:	c3                   	ret
+
+f0107db6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f0107db6:	55                   	push   %ebp
+f0107db7:	89 e5                	mov    %esp,%ebp
+f0107db9:	57                   	push   %edi
+f0107dba:	56                   	push   %esi
+f0107dbb:	53                   	push   %ebx
+f0107dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+f0107dbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f0107dc2:	0f b6 02             	movzbl (%edx),%eax
+f0107dc5:	3c 20                	cmp    $0x20,%al
+f0107dc7:	74 04                	je     f0107dcd <strtol+0x17>
+f0107dc9:	3c 09                	cmp    $0x9,%al
+f0107dcb:	75 0e                	jne    f0107ddb <strtol+0x25>
+		s++;
+f0107dcd:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f0107dd0:	0f b6 02             	movzbl (%edx),%eax
+f0107dd3:	3c 20                	cmp    $0x20,%al
+f0107dd5:	74 f6                	je     f0107dcd <strtol+0x17>
+f0107dd7:	3c 09                	cmp    $0x9,%al
+f0107dd9:	74 f2                	je     f0107dcd <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+f0107ddb:	3c 2b                	cmp    $0x2b,%al
+f0107ddd:	74 2a                	je     f0107e09 <strtol+0x53>
+	int neg = 0;
+f0107ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f0107de4:	3c 2d                	cmp    $0x2d,%al
+f0107de6:	74 2b                	je     f0107e13 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0107de8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f0107dee:	75 0f                	jne    f0107dff <strtol+0x49>
+f0107df0:	80 3a 30             	cmpb   $0x30,(%edx)
+f0107df3:	74 28                	je     f0107e1d <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f0107df5:	85 db                	test   %ebx,%ebx
+f0107df7:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0107dfc:	0f 44 d8             	cmove  %eax,%ebx
+f0107dff:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107e04:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f0107e07:	eb 46                	jmp    f0107e4f <strtol+0x99>
+		s++;
+f0107e09:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f0107e0c:	bf 00 00 00 00       	mov    $0x0,%edi
+f0107e11:	eb d5                	jmp    f0107de8 <strtol+0x32>
+		s++, neg = 1;
+f0107e13:	83 c2 01             	add    $0x1,%edx
+f0107e16:	bf 01 00 00 00       	mov    $0x1,%edi
+f0107e1b:	eb cb                	jmp    f0107de8 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0107e1d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f0107e21:	74 0e                	je     f0107e31 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+f0107e23:	85 db                	test   %ebx,%ebx
+f0107e25:	75 d8                	jne    f0107dff <strtol+0x49>
+		s++, base = 8;
+f0107e27:	83 c2 01             	add    $0x1,%edx
+f0107e2a:	bb 08 00 00 00       	mov    $0x8,%ebx
+f0107e2f:	eb ce                	jmp    f0107dff <strtol+0x49>
+		s += 2, base = 16;
+f0107e31:	83 c2 02             	add    $0x2,%edx
+f0107e34:	bb 10 00 00 00       	mov    $0x10,%ebx
+f0107e39:	eb c4                	jmp    f0107dff <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f0107e3b:	0f be c0             	movsbl %al,%eax
+f0107e3e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f0107e41:	3b 45 10             	cmp    0x10(%ebp),%eax
+f0107e44:	7d 3a                	jge    f0107e80 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+f0107e46:	83 c2 01             	add    $0x1,%edx
+f0107e49:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f0107e4d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f0107e4f:	0f b6 02             	movzbl (%edx),%eax
+f0107e52:	8d 70 d0             	lea    -0x30(%eax),%esi
+f0107e55:	89 f3                	mov    %esi,%ebx
+f0107e57:	80 fb 09             	cmp    $0x9,%bl
+f0107e5a:	76 df                	jbe    f0107e3b <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+f0107e5c:	8d 70 9f             	lea    -0x61(%eax),%esi
+f0107e5f:	89 f3                	mov    %esi,%ebx
+f0107e61:	80 fb 19             	cmp    $0x19,%bl
+f0107e64:	77 08                	ja     f0107e6e <strtol+0xb8>
+			dig = *s - 'a' + 10;
+f0107e66:	0f be c0             	movsbl %al,%eax
+f0107e69:	83 e8 57             	sub    $0x57,%eax
+f0107e6c:	eb d3                	jmp    f0107e41 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+f0107e6e:	8d 70 bf             	lea    -0x41(%eax),%esi
+f0107e71:	89 f3                	mov    %esi,%ebx
+f0107e73:	80 fb 19             	cmp    $0x19,%bl
+f0107e76:	77 08                	ja     f0107e80 <strtol+0xca>
+			dig = *s - 'A' + 10;
+f0107e78:	0f be c0             	movsbl %al,%eax
+f0107e7b:	83 e8 37             	sub    $0x37,%eax
+f0107e7e:	eb c1                	jmp    f0107e41 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f0107e80:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0107e84:	74 05                	je     f0107e8b <strtol+0xd5>
+		*endptr = (char *) s;
+f0107e86:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107e89:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f0107e8b:	89 c8                	mov    %ecx,%eax
+f0107e8d:	f7 d8                	neg    %eax
+f0107e8f:	85 ff                	test   %edi,%edi
+f0107e91:	0f 45 c8             	cmovne %eax,%ecx
+}
+f0107e94:	89 c8                	mov    %ecx,%eax
+f0107e96:	5b                   	pop    %ebx
+f0107e97:	5e                   	pop    %esi
+f0107e98:	5f                   	pop    %edi
+f0107e99:	5d                   	pop    %ebp
+f0107e9a:	c3                   	ret
+f0107e9b:	90                   	nop
+
+f0107e9c <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16           
+.globl mpentry_start
+mpentry_start:
+	cli            
+f0107e9c:	fa                   	cli
+
+	xorw    %ax, %ax
+f0107e9d:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f0107e9f:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0107ea1:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107ea3:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0107ea5:	0f 01 16             	lgdtl  (%esi)
+f0107ea8:	74 70                	je     f0107f1a <mpsearch1+0x3>
+	movl    %cr0, %eax
+f0107eaa:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f0107ead:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f0107eb1:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0107eb4:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f0107eba:	08 00                	or     %al,(%eax)
+
+f0107ebc <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f0107ebc:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f0107ec0:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0107ec2:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107ec4:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f0107ec6:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f0107eca:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f0107ecc:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl    $(RELOC(entry_pgdir)), %eax
+f0107ece:	b8 00 60 11 00       	mov    $0x116000,%eax
+	movl    %eax, %cr3
+f0107ed3:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl    %cr0, %eax
+f0107ed6:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f0107ed9:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f0107ede:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in mem_init()
+	movl    mpentry_kstack, %esp
+f0107ee1:	8b 25 e4 f3 92 f0    	mov    0xf092f3e4,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f0107ee7:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f0107eec:	b8 3e 02 10 f0       	mov    $0xf010023e,%eax
+	call    *%eax
+f0107ef1:	ff d0                	call   *%eax
+
+f0107ef3 <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f0107ef3:	eb fe                	jmp    f0107ef3 <spin>
+f0107ef5:	8d 76 00             	lea    0x0(%esi),%esi
+
+f0107ef8 <gdt>:
+	...
+f0107f00:	ff                   	(bad)
+f0107f01:	ff 00                	incl   (%eax)
+f0107f03:	00 00                	add    %al,(%eax)
+f0107f05:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f0107f0c:	00                   	.byte 0x0
+f0107f0d:	92                   	xchg   %eax,%edx
+f0107f0e:	cf                   	iret
+	...
+
+f0107f10 <gdtdesc>:
+f0107f10:	17                   	pop    %ss
+f0107f11:	00 5c 70 00          	add    %bl,0x0(%eax,%esi,2)
+	...
+
+f0107f16 <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f0107f16:	90                   	nop
+
+f0107f17 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f0107f17:	55                   	push   %ebp
+f0107f18:	89 e5                	mov    %esp,%ebp
+f0107f1a:	57                   	push   %edi
+f0107f1b:	56                   	push   %esi
+f0107f1c:	53                   	push   %ebx
+f0107f1d:	83 ec 0c             	sub    $0xc,%esp
+f0107f20:	89 c3                	mov    %eax,%ebx
+f0107f22:	89 d7                	mov    %edx,%edi
+	if (PGNUM(pa) >= npages)
+f0107f24:	a1 ec f3 92 f0       	mov    0xf092f3ec,%eax
+f0107f29:	89 da                	mov    %ebx,%edx
+f0107f2b:	c1 ea 0c             	shr    $0xc,%edx
+f0107f2e:	39 c2                	cmp    %eax,%edx
+f0107f30:	73 23                	jae    f0107f55 <mpsearch1+0x3e>
+	return (void *)(pa + KERNBASE);
+f0107f32:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f0107f38:	01 df                	add    %ebx,%edi
+	if (PGNUM(pa) >= npages)
+f0107f3a:	89 fa                	mov    %edi,%edx
+f0107f3c:	c1 ea 0c             	shr    $0xc,%edx
+f0107f3f:	39 c2                	cmp    %eax,%edx
+f0107f41:	73 24                	jae    f0107f67 <mpsearch1+0x50>
+	return (void *)(pa + KERNBASE);
+f0107f43:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+
+	for (; mp < end; mp++)
+f0107f49:	39 fe                	cmp    %edi,%esi
+f0107f4b:	73 70                	jae    f0107fbd <mpsearch1+0xa6>
+f0107f4d:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f0107f53:	eb 32                	jmp    f0107f87 <mpsearch1+0x70>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107f55:	53                   	push   %ebx
+f0107f56:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0107f5b:	6a 57                	push   $0x57
+f0107f5d:	68 a9 cd 10 f0       	push   $0xf010cda9
+f0107f62:	e8 d9 80 ff ff       	call   f0100040 <_panic>
+f0107f67:	57                   	push   %edi
+f0107f68:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0107f6d:	6a 57                	push   $0x57
+f0107f6f:	68 a9 cd 10 f0       	push   $0xf010cda9
+f0107f74:	e8 c7 80 ff ff       	call   f0100040 <_panic>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0107f79:	84 c0                	test   %al,%al
+f0107f7b:	74 36                	je     f0107fb3 <mpsearch1+0x9c>
+	for (; mp < end; mp++)
+f0107f7d:	83 c6 10             	add    $0x10,%esi
+f0107f80:	83 c3 10             	add    $0x10,%ebx
+f0107f83:	39 fe                	cmp    %edi,%esi
+f0107f85:	73 27                	jae    f0107fae <mpsearch1+0x97>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0107f87:	83 ec 04             	sub    $0x4,%esp
+f0107f8a:	6a 04                	push   $0x4
+f0107f8c:	68 b9 cd 10 f0       	push   $0xf010cdb9
+f0107f91:	56                   	push   %esi
+f0107f92:	e8 b4 fd ff ff       	call   f0107d4b <memcmp>
+f0107f97:	83 c4 10             	add    $0x10,%esp
+f0107f9a:	85 c0                	test   %eax,%eax
+f0107f9c:	75 df                	jne    f0107f7d <mpsearch1+0x66>
+f0107f9e:	89 f2                	mov    %esi,%edx
+		sum += ((uint8_t *)addr)[i];
+f0107fa0:	0f b6 0a             	movzbl (%edx),%ecx
+f0107fa3:	01 c8                	add    %ecx,%eax
+	for (i = 0; i < len; i++)
+f0107fa5:	83 c2 01             	add    $0x1,%edx
+f0107fa8:	39 da                	cmp    %ebx,%edx
+f0107faa:	75 f4                	jne    f0107fa0 <mpsearch1+0x89>
+f0107fac:	eb cb                	jmp    f0107f79 <mpsearch1+0x62>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f0107fae:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0107fb3:	89 f0                	mov    %esi,%eax
+f0107fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107fb8:	5b                   	pop    %ebx
+f0107fb9:	5e                   	pop    %esi
+f0107fba:	5f                   	pop    %edi
+f0107fbb:	5d                   	pop    %ebp
+f0107fbc:	c3                   	ret
+	return NULL;
+f0107fbd:	be 00 00 00 00       	mov    $0x0,%esi
+f0107fc2:	eb ef                	jmp    f0107fb3 <mpsearch1+0x9c>
+
+f0107fc4 <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f0107fc4:	55                   	push   %ebp
+f0107fc5:	89 e5                	mov    %esp,%ebp
+f0107fc7:	57                   	push   %edi
+f0107fc8:	56                   	push   %esi
+f0107fc9:	53                   	push   %ebx
+f0107fca:	83 ec 1c             	sub    $0x1c,%esp
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f0107fcd:	c7 05 a0 06 93 f0 20 	movl   $0xf0930020,0xf09306a0
+f0107fd4:	00 93 f0 
+	if (PGNUM(pa) >= npages)
+f0107fd7:	83 3d ec f3 92 f0 00 	cmpl   $0x0,0xf092f3ec
+f0107fde:	0f 84 5a 01 00 00    	je     f010813e <mp_init+0x17a>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f0107fe4:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f0107feb:	85 c0                	test   %eax,%eax
+f0107fed:	0f 84 61 01 00 00    	je     f0108154 <mp_init+0x190>
+		p <<= 4;	// Translate from segment to PA
+f0107ff3:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f0107ff6:	ba 00 04 00 00       	mov    $0x400,%edx
+f0107ffb:	e8 17 ff ff ff       	call   f0107f17 <mpsearch1>
+f0108000:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108003:	85 c0                	test   %eax,%eax
+f0108005:	75 1a                	jne    f0108021 <mp_init+0x5d>
+	return mpsearch1(0xF0000, 0x10000);
+f0108007:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010800c:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f0108011:	e8 01 ff ff ff       	call   f0107f17 <mpsearch1>
+f0108016:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((mp = mpsearch()) == 0)
+f0108019:	85 c0                	test   %eax,%eax
+f010801b:	0f 84 15 01 00 00    	je     f0108136 <mp_init+0x172>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f0108021:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108024:	8b 78 04             	mov    0x4(%eax),%edi
+f0108027:	85 ff                	test   %edi,%edi
+f0108029:	0f 84 4e 01 00 00    	je     f010817d <mp_init+0x1b9>
+f010802f:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f0108033:	0f 85 44 01 00 00    	jne    f010817d <mp_init+0x1b9>
+f0108039:	89 f8                	mov    %edi,%eax
+f010803b:	c1 e8 0c             	shr    $0xc,%eax
+f010803e:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0108044:	0f 83 45 01 00 00    	jae    f010818f <mp_init+0x1cb>
+	return (void *)(pa + KERNBASE);
+f010804a:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f0108050:	83 ec 04             	sub    $0x4,%esp
+f0108053:	6a 04                	push   $0x4
+f0108055:	68 be cd 10 f0       	push   $0xf010cdbe
+f010805a:	57                   	push   %edi
+f010805b:	e8 eb fc ff ff       	call   f0107d4b <memcmp>
+f0108060:	89 c2                	mov    %eax,%edx
+f0108062:	83 c4 10             	add    $0x10,%esp
+f0108065:	85 c0                	test   %eax,%eax
+f0108067:	0f 85 37 01 00 00    	jne    f01081a4 <mp_init+0x1e0>
+	if (sum(conf, conf->length) != 0) {
+f010806d:	0f b7 5f 04          	movzwl 0x4(%edi),%ebx
+	for (i = 0; i < len; i++)
+f0108071:	66 85 db             	test   %bx,%bx
+f0108074:	74 23                	je     f0108099 <mp_init+0xd5>
+f0108076:	0f b7 f3             	movzwl %bx,%esi
+f0108079:	01 fe                	add    %edi,%esi
+f010807b:	89 f8                	mov    %edi,%eax
+	sum = 0;
+f010807d:	89 d1                	mov    %edx,%ecx
+f010807f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		sum += ((uint8_t *)addr)[i];
+f0108082:	0f b6 10             	movzbl (%eax),%edx
+f0108085:	01 d1                	add    %edx,%ecx
+	for (i = 0; i < len; i++)
+f0108087:	83 c0 01             	add    $0x1,%eax
+f010808a:	39 f0                	cmp    %esi,%eax
+f010808c:	75 f4                	jne    f0108082 <mp_init+0xbe>
+	if (sum(conf, conf->length) != 0) {
+f010808e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0108091:	84 c9                	test   %cl,%cl
+f0108093:	0f 85 1d 01 00 00    	jne    f01081b6 <mp_init+0x1f2>
+	if (conf->version != 1 && conf->version != 4) {
+f0108099:	0f b6 47 06          	movzbl 0x6(%edi),%eax
+f010809d:	3c 01                	cmp    $0x1,%al
+f010809f:	74 08                	je     f01080a9 <mp_init+0xe5>
+f01080a1:	3c 04                	cmp    $0x4,%al
+f01080a3:	0f 85 22 01 00 00    	jne    f01081cb <mp_init+0x207>
+	if (sum((uint8_t *)conf + conf->length, conf->xlength) != conf->xchecksum) {
+f01080a9:	0f b7 4f 28          	movzwl 0x28(%edi),%ecx
+f01080ad:	0f b7 db             	movzwl %bx,%ebx
+	for (i = 0; i < len; i++)
+f01080b0:	66 85 c9             	test   %cx,%cx
+f01080b3:	74 13                	je     f01080c8 <mp_init+0x104>
+f01080b5:	01 fb                	add    %edi,%ebx
+f01080b7:	0f b7 c9             	movzwl %cx,%ecx
+f01080ba:	01 d9                	add    %ebx,%ecx
+		sum += ((uint8_t *)addr)[i];
+f01080bc:	0f b6 03             	movzbl (%ebx),%eax
+f01080bf:	01 c2                	add    %eax,%edx
+	for (i = 0; i < len; i++)
+f01080c1:	83 c3 01             	add    $0x1,%ebx
+f01080c4:	39 cb                	cmp    %ecx,%ebx
+f01080c6:	75 f4                	jne    f01080bc <mp_init+0xf8>
+	if (sum((uint8_t *)conf + conf->length, conf->xlength) != conf->xchecksum) {
+f01080c8:	38 57 2a             	cmp    %dl,0x2a(%edi)
+f01080cb:	0f 85 13 01 00 00    	jne    f01081e4 <mp_init+0x220>
+	if ((conf = mpconfig(&mp)) == 0)
+		return;
+	ismp = 1;
+f01080d1:	c7 05 00 00 93 f0 01 	movl   $0x1,0xf0930000
+f01080d8:	00 00 00 
+	lapic = (uint32_t *)conf->lapicaddr;
+f01080db:	8b 47 24             	mov    0x24(%edi),%eax
+f01080de:	a3 00 10 97 f0       	mov    %eax,0xf0971000
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f01080e3:	8d 77 2c             	lea    0x2c(%edi),%esi
+f01080e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01080eb:	66 83 7f 22 00       	cmpw   $0x0,0x22(%edi)
+f01080f0:	0f 85 4d 01 00 00    	jne    f0108243 <mp_init+0x27f>
+			ismp = 0;
+			i = conf->entry;
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f01080f6:	a1 a0 06 93 f0       	mov    0xf09306a0,%eax
+f01080fb:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	if (!ismp) {
+f0108102:	83 3d 00 00 93 f0 00 	cmpl   $0x0,0xf0930000
+f0108109:	0f 84 83 01 00 00    	je     f0108292 <mp_init+0x2ce>
+		ncpu = 1;
+		lapic = NULL;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f010810f:	83 ec 04             	sub    $0x4,%esp
+f0108112:	ff 35 a4 06 93 f0    	push   0xf09306a4
+f0108118:	0f b6 00             	movzbl (%eax),%eax
+f010811b:	50                   	push   %eax
+f010811c:	68 c3 cd 10 f0       	push   $0xf010cdc3
+f0108121:	e8 c6 c5 ff ff       	call   f01046ec <cprintf>
+
+	if (mp->imcrp) {
+f0108126:	83 c4 10             	add    $0x10,%esp
+f0108129:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010812c:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f0108130:	0f 85 85 01 00 00    	jne    f01082bb <mp_init+0x2f7>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f0108136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108139:	5b                   	pop    %ebx
+f010813a:	5e                   	pop    %esi
+f010813b:	5f                   	pop    %edi
+f010813c:	5d                   	pop    %ebp
+f010813d:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010813e:	68 00 04 00 00       	push   $0x400
+f0108143:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0108148:	6a 6f                	push   $0x6f
+f010814a:	68 a9 cd 10 f0       	push   $0xf010cda9
+f010814f:	e8 ec 7e ff ff       	call   f0100040 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f0108154:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f010815b:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f010815e:	2d 00 04 00 00       	sub    $0x400,%eax
+f0108163:	ba 00 04 00 00       	mov    $0x400,%edx
+f0108168:	e8 aa fd ff ff       	call   f0107f17 <mpsearch1>
+f010816d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108170:	85 c0                	test   %eax,%eax
+f0108172:	0f 85 a9 fe ff ff    	jne    f0108021 <mp_init+0x5d>
+f0108178:	e9 8a fe ff ff       	jmp    f0108007 <mp_init+0x43>
+		cprintf("SMP: Default configurations not implemented\n");
+f010817d:	83 ec 0c             	sub    $0xc,%esp
+f0108180:	68 1c cc 10 f0       	push   $0xf010cc1c
+f0108185:	e8 62 c5 ff ff       	call   f01046ec <cprintf>
+		return NULL;
+f010818a:	83 c4 10             	add    $0x10,%esp
+f010818d:	eb a7                	jmp    f0108136 <mp_init+0x172>
+f010818f:	57                   	push   %edi
+f0108190:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0108195:	68 90 00 00 00       	push   $0x90
+f010819a:	68 a9 cd 10 f0       	push   $0xf010cda9
+f010819f:	e8 9c 7e ff ff       	call   f0100040 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f01081a4:	83 ec 0c             	sub    $0xc,%esp
+f01081a7:	68 4c cc 10 f0       	push   $0xf010cc4c
+f01081ac:	e8 3b c5 ff ff       	call   f01046ec <cprintf>
+		return NULL;
+f01081b1:	83 c4 10             	add    $0x10,%esp
+f01081b4:	eb 80                	jmp    f0108136 <mp_init+0x172>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f01081b6:	83 ec 0c             	sub    $0xc,%esp
+f01081b9:	68 80 cc 10 f0       	push   $0xf010cc80
+f01081be:	e8 29 c5 ff ff       	call   f01046ec <cprintf>
+		return NULL;
+f01081c3:	83 c4 10             	add    $0x10,%esp
+f01081c6:	e9 6b ff ff ff       	jmp    f0108136 <mp_init+0x172>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f01081cb:	83 ec 08             	sub    $0x8,%esp
+f01081ce:	0f b6 c0             	movzbl %al,%eax
+f01081d1:	50                   	push   %eax
+f01081d2:	68 a4 cc 10 f0       	push   $0xf010cca4
+f01081d7:	e8 10 c5 ff ff       	call   f01046ec <cprintf>
+		return NULL;
+f01081dc:	83 c4 10             	add    $0x10,%esp
+f01081df:	e9 52 ff ff ff       	jmp    f0108136 <mp_init+0x172>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f01081e4:	83 ec 0c             	sub    $0xc,%esp
+f01081e7:	68 c4 cc 10 f0       	push   $0xf010ccc4
+f01081ec:	e8 fb c4 ff ff       	call   f01046ec <cprintf>
+		return NULL;
+f01081f1:	83 c4 10             	add    $0x10,%esp
+f01081f4:	e9 3d ff ff ff       	jmp    f0108136 <mp_init+0x172>
+			if (proc->flags & MPPROC_BOOT)
+f01081f9:	f6 46 03 02          	testb  $0x2,0x3(%esi)
+f01081fd:	74 14                	je     f0108213 <mp_init+0x24f>
+				bootcpu = &cpus[ncpu];
+f01081ff:	69 05 a4 06 93 f0 d0 	imul   $0xd0,0xf09306a4,%eax
+f0108206:	00 00 00 
+f0108209:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f010820e:	a3 a0 06 93 f0       	mov    %eax,0xf09306a0
+			if (ncpu < NCPU) {
+f0108213:	a1 a4 06 93 f0       	mov    0xf09306a4,%eax
+f0108218:	83 f8 07             	cmp    $0x7,%eax
+f010821b:	7f 3a                	jg     f0108257 <mp_init+0x293>
+				cpus[ncpu].cpu_id = ncpu;
+f010821d:	69 d0 d0 00 00 00    	imul   $0xd0,%eax,%edx
+f0108223:	88 82 20 00 93 f0    	mov    %al,-0xf6cffe0(%edx)
+				ncpu++;
+f0108229:	83 c0 01             	add    $0x1,%eax
+f010822c:	a3 a4 06 93 f0       	mov    %eax,0xf09306a4
+			p += sizeof(struct mpproc);
+f0108231:	83 c6 14             	add    $0x14,%esi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0108234:	83 c3 01             	add    $0x1,%ebx
+f0108237:	0f b7 47 22          	movzwl 0x22(%edi),%eax
+f010823b:	39 c3                	cmp    %eax,%ebx
+f010823d:	0f 83 b3 fe ff ff    	jae    f01080f6 <mp_init+0x132>
+		switch (*p) {
+f0108243:	0f b6 06             	movzbl (%esi),%eax
+f0108246:	84 c0                	test   %al,%al
+f0108248:	74 af                	je     f01081f9 <mp_init+0x235>
+f010824a:	8d 50 ff             	lea    -0x1(%eax),%edx
+f010824d:	80 fa 03             	cmp    $0x3,%dl
+f0108250:	77 1c                	ja     f010826e <mp_init+0x2aa>
+			p += 8;
+f0108252:	83 c6 08             	add    $0x8,%esi
+			continue;
+f0108255:	eb dd                	jmp    f0108234 <mp_init+0x270>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f0108257:	83 ec 08             	sub    $0x8,%esp
+f010825a:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+f010825e:	50                   	push   %eax
+f010825f:	68 f4 cc 10 f0       	push   $0xf010ccf4
+f0108264:	e8 83 c4 ff ff       	call   f01046ec <cprintf>
+f0108269:	83 c4 10             	add    $0x10,%esp
+f010826c:	eb c3                	jmp    f0108231 <mp_init+0x26d>
+			cprintf("mpinit: unknown config type %x\n", *p);
+f010826e:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f0108271:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0108274:	50                   	push   %eax
+f0108275:	68 1c cd 10 f0       	push   $0xf010cd1c
+f010827a:	e8 6d c4 ff ff       	call   f01046ec <cprintf>
+			ismp = 0;
+f010827f:	c7 05 00 00 93 f0 00 	movl   $0x0,0xf0930000
+f0108286:	00 00 00 
+			i = conf->entry;
+f0108289:	0f b7 5f 22          	movzwl 0x22(%edi),%ebx
+f010828d:	83 c4 10             	add    $0x10,%esp
+f0108290:	eb a2                	jmp    f0108234 <mp_init+0x270>
+		ncpu = 1;
+f0108292:	c7 05 a4 06 93 f0 01 	movl   $0x1,0xf09306a4
+f0108299:	00 00 00 
+		lapic = NULL;
+f010829c:	c7 05 00 10 97 f0 00 	movl   $0x0,0xf0971000
+f01082a3:	00 00 00 
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f01082a6:	83 ec 0c             	sub    $0xc,%esp
+f01082a9:	68 3c cd 10 f0       	push   $0xf010cd3c
+f01082ae:	e8 39 c4 ff ff       	call   f01046ec <cprintf>
+		return;
+f01082b3:	83 c4 10             	add    $0x10,%esp
+f01082b6:	e9 7b fe ff ff       	jmp    f0108136 <mp_init+0x172>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f01082bb:	83 ec 0c             	sub    $0xc,%esp
+f01082be:	68 68 cd 10 f0       	push   $0xf010cd68
+f01082c3:	e8 24 c4 ff ff       	call   f01046ec <cprintf>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01082c8:	b8 70 00 00 00       	mov    $0x70,%eax
+f01082cd:	ba 22 00 00 00       	mov    $0x22,%edx
+f01082d2:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01082d3:	ba 23 00 00 00       	mov    $0x23,%edx
+f01082d8:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f01082d9:	83 c8 01             	or     $0x1,%eax
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01082dc:	ee                   	out    %al,(%dx)
+}
+f01082dd:	83 c4 10             	add    $0x10,%esp
+f01082e0:	e9 51 fe ff ff       	jmp    f0108136 <mp_init+0x172>
+
+f01082e5 <lapicw>:
+volatile uint32_t *lapic;  // Initialized in mp.c
+
+static void
+lapicw(int index, int value)
+{
+	lapic[index] = value;
+f01082e5:	8b 0d 00 10 97 f0    	mov    0xf0971000,%ecx
+f01082eb:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f01082ee:	89 10                	mov    %edx,(%eax)
+	lapic[ID];  // wait for write to finish, by reading
+f01082f0:	a1 00 10 97 f0       	mov    0xf0971000,%eax
+f01082f5:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f01082f8:	c3                   	ret
+
+f01082f9 <cpunum>:
+}
+
+int
+cpunum(void)
+{
+	if (lapic)
+f01082f9:	8b 15 00 10 97 f0    	mov    0xf0971000,%edx
+		return lapic[ID] >> 24;
+	return 0;
+f01082ff:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f0108304:	85 d2                	test   %edx,%edx
+f0108306:	74 06                	je     f010830e <cpunum+0x15>
+		return lapic[ID] >> 24;
+f0108308:	8b 42 20             	mov    0x20(%edx),%eax
+f010830b:	c1 e8 18             	shr    $0x18,%eax
+}
+f010830e:	c3                   	ret
+
+f010830f <lapic_init>:
+	if (!lapic) 
+f010830f:	83 3d 00 10 97 f0 00 	cmpl   $0x0,0xf0971000
+f0108316:	0f 84 17 01 00 00    	je     f0108433 <lapic_init+0x124>
+{
+f010831c:	55                   	push   %ebp
+f010831d:	89 e5                	mov    %esp,%ebp
+f010831f:	83 ec 08             	sub    $0x8,%esp
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0108322:	ba 27 01 00 00       	mov    $0x127,%edx
+f0108327:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f010832c:	e8 b4 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(TDCR, X1);
+f0108331:	ba 0b 00 00 00       	mov    $0xb,%edx
+f0108336:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f010833b:	e8 a5 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f0108340:	ba 20 00 02 00       	mov    $0x20020,%edx
+f0108345:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010834a:	e8 96 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(TICR, 10000000); 
+f010834f:	ba 80 96 98 00       	mov    $0x989680,%edx
+f0108354:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f0108359:	e8 87 ff ff ff       	call   f01082e5 <lapicw>
+	if (thiscpu != bootcpu)
+f010835e:	e8 96 ff ff ff       	call   f01082f9 <cpunum>
+f0108363:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0108369:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f010836e:	39 05 a0 06 93 f0    	cmp    %eax,0xf09306a0
+f0108374:	74 0f                	je     f0108385 <lapic_init+0x76>
+		lapicw(LINT0, MASKED);
+f0108376:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010837b:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0108380:	e8 60 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(LINT1, MASKED);
+f0108385:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010838a:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f010838f:	e8 51 ff ff ff       	call   f01082e5 <lapicw>
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f0108394:	a1 00 10 97 f0       	mov    0xf0971000,%eax
+f0108399:	8b 40 30             	mov    0x30(%eax),%eax
+f010839c:	c1 e8 10             	shr    $0x10,%eax
+f010839f:	a8 fc                	test   $0xfc,%al
+f01083a1:	75 7c                	jne    f010841f <lapic_init+0x110>
+	lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f01083a3:	ba 33 00 00 00       	mov    $0x33,%edx
+f01083a8:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f01083ad:	e8 33 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(ESR, 0);
+f01083b2:	ba 00 00 00 00       	mov    $0x0,%edx
+f01083b7:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f01083bc:	e8 24 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(ESR, 0);
+f01083c1:	ba 00 00 00 00       	mov    $0x0,%edx
+f01083c6:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f01083cb:	e8 15 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(EOI, 0);
+f01083d0:	ba 00 00 00 00       	mov    $0x0,%edx
+f01083d5:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f01083da:	e8 06 ff ff ff       	call   f01082e5 <lapicw>
+	lapicw(ICRHI, 0);
+f01083df:	ba 00 00 00 00       	mov    $0x0,%edx
+f01083e4:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01083e9:	e8 f7 fe ff ff       	call   f01082e5 <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f01083ee:	ba 00 85 08 00       	mov    $0x88500,%edx
+f01083f3:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01083f8:	e8 e8 fe ff ff       	call   f01082e5 <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f01083fd:	8b 15 00 10 97 f0    	mov    0xf0971000,%edx
+f0108403:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0108409:	f6 c4 10             	test   $0x10,%ah
+f010840c:	75 f5                	jne    f0108403 <lapic_init+0xf4>
+	lapicw(TPR, 0);
+f010840e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108413:	b8 20 00 00 00       	mov    $0x20,%eax
+f0108418:	e8 c8 fe ff ff       	call   f01082e5 <lapicw>
+}
+f010841d:	c9                   	leave
+f010841e:	c3                   	ret
+		lapicw(PCINT, MASKED);
+f010841f:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0108424:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0108429:	e8 b7 fe ff ff       	call   f01082e5 <lapicw>
+f010842e:	e9 70 ff ff ff       	jmp    f01083a3 <lapic_init+0x94>
+f0108433:	c3                   	ret
+
+f0108434 <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+	if (lapic)
+f0108434:	83 3d 00 10 97 f0 00 	cmpl   $0x0,0xf0971000
+f010843b:	74 17                	je     f0108454 <lapic_eoi+0x20>
+{
+f010843d:	55                   	push   %ebp
+f010843e:	89 e5                	mov    %esp,%ebp
+f0108440:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f0108443:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108448:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f010844d:	e8 93 fe ff ff       	call   f01082e5 <lapicw>
+}
+f0108452:	c9                   	leave
+f0108453:	c3                   	ret
+f0108454:	c3                   	ret
+
+f0108455 <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f0108455:	55                   	push   %ebp
+f0108456:	89 e5                	mov    %esp,%ebp
+f0108458:	56                   	push   %esi
+f0108459:	53                   	push   %ebx
+f010845a:	8b 75 08             	mov    0x8(%ebp),%esi
+f010845d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0108460:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0108465:	ba 70 00 00 00       	mov    $0x70,%edx
+f010846a:	ee                   	out    %al,(%dx)
+f010846b:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0108470:	ba 71 00 00 00       	mov    $0x71,%edx
+f0108475:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f0108476:	83 3d ec f3 92 f0 00 	cmpl   $0x0,0xf092f3ec
+f010847d:	74 7e                	je     f01084fd <lapic_startap+0xa8>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f010847f:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f0108486:	00 00 
+	wrv[1] = addr >> 4;
+f0108488:	89 d8                	mov    %ebx,%eax
+f010848a:	c1 e8 04             	shr    $0x4,%eax
+f010848d:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f0108493:	c1 e6 18             	shl    $0x18,%esi
+f0108496:	89 f2                	mov    %esi,%edx
+f0108498:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010849d:	e8 43 fe ff ff       	call   f01082e5 <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f01084a2:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f01084a7:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01084ac:	e8 34 fe ff ff       	call   f01082e5 <lapicw>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f01084b1:	ba 00 85 00 00       	mov    $0x8500,%edx
+f01084b6:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01084bb:	e8 25 fe ff ff       	call   f01082e5 <lapicw>
+	// when it is in the halted state due to an INIT.  So the second
+	// should be ignored, but it is part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01084c0:	c1 eb 0c             	shr    $0xc,%ebx
+f01084c3:	80 cf 06             	or     $0x6,%bh
+		lapicw(ICRHI, apicid << 24);
+f01084c6:	89 f2                	mov    %esi,%edx
+f01084c8:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01084cd:	e8 13 fe ff ff       	call   f01082e5 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01084d2:	89 da                	mov    %ebx,%edx
+f01084d4:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01084d9:	e8 07 fe ff ff       	call   f01082e5 <lapicw>
+		lapicw(ICRHI, apicid << 24);
+f01084de:	89 f2                	mov    %esi,%edx
+f01084e0:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01084e5:	e8 fb fd ff ff       	call   f01082e5 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01084ea:	89 da                	mov    %ebx,%edx
+f01084ec:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01084f1:	e8 ef fd ff ff       	call   f01082e5 <lapicw>
+		microdelay(200);
+	}
+}
+f01084f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01084f9:	5b                   	pop    %ebx
+f01084fa:	5e                   	pop    %esi
+f01084fb:	5d                   	pop    %ebp
+f01084fc:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01084fd:	68 67 04 00 00       	push   $0x467
+f0108502:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0108507:	68 93 00 00 00       	push   $0x93
+f010850c:	68 e0 cd 10 f0       	push   $0xf010cde0
+f0108511:	e8 2a 7b ff ff       	call   f0100040 <_panic>
+
+f0108516 <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f0108516:	55                   	push   %ebp
+f0108517:	89 e5                	mov    %esp,%ebp
+f0108519:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f010851c:	8b 55 08             	mov    0x8(%ebp),%edx
+f010851f:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f0108525:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010852a:	e8 b6 fd ff ff       	call   f01082e5 <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f010852f:	8b 15 00 10 97 f0    	mov    0xf0971000,%edx
+f0108535:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010853b:	f6 c4 10             	test   $0x10,%ah
+f010853e:	75 f5                	jne    f0108535 <lapic_ipi+0x1f>
+		;
+}
+f0108540:	c9                   	leave
+f0108541:	c3                   	ret
+
+f0108542 <lapic_ipi_cpu>:
+
+// Send 'vector' to the single CPU whose local APIC ID is 'apicid'.
+void
+lapic_ipi_cpu(int apicid, int vector)
+{
+f0108542:	55                   	push   %ebp
+f0108543:	89 e5                	mov    %esp,%ebp
+f0108545:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRHI, apicid << 24);
+f0108548:	8b 55 08             	mov    0x8(%ebp),%edx
+f010854b:	c1 e2 18             	shl    $0x18,%edx
+f010854e:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108553:	e8 8d fd ff ff       	call   f01082e5 <lapicw>
+	lapicw(ICRLO, FIXED | vector);
+f0108558:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010855b:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108560:	e8 80 fd ff ff       	call   f01082e5 <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f0108565:	8b 15 00 10 97 f0    	mov    0xf0971000,%edx
+f010856b:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0108571:	f6 c4 10             	test   $0x10,%ah
+f0108574:	75 f5                	jne    f010856b <lapic_ipi_cpu+0x29>
+		;
+}
+f0108576:	c9                   	leave
+f0108577:	c3                   	ret
+
+f0108578 <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f0108578:	55                   	push   %ebp
+f0108579:	89 e5                	mov    %esp,%ebp
+f010857b:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->locked = 0;
+f010857e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+#ifdef DEBUG_SPINLOCK
+	lk->name = name;
+f0108584:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108587:	89 50 04             	mov    %edx,0x4(%eax)
+	lk->cpu = 0;
+f010858a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#endif
+}
+f0108591:	5d                   	pop    %ebp
+f0108592:	c3                   	ret
+
+f0108593 <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f0108593:	55                   	push   %ebp
+f0108594:	89 e5                	mov    %esp,%ebp
+f0108596:	56                   	push   %esi
+f0108597:	53                   	push   %ebx
+f0108598:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	return lock->locked && lock->cpu == thiscpu;
+f010859b:	83 3b 00             	cmpl   $0x0,(%ebx)
+f010859e:	0f 85 83 00 00 00    	jne    f0108627 <spin_lock+0x94>
+	asm volatile("lock; xchgl %0, %1" :
+f01085a4:	b8 01 00 00 00       	mov    $0x1,%eax
+f01085a9:	f0 87 03             	lock xchg %eax,(%ebx)
+f01085ac:	ba 01 00 00 00       	mov    $0x1,%edx
+#endif
+
+	// The xchg is atomic.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it. 
+	while (xchg(&lk->locked, 1) != 0)
+f01085b1:	85 c0                	test   %eax,%eax
+f01085b3:	74 0b                	je     f01085c0 <spin_lock+0x2d>
+		asm volatile ("pause");
+f01085b5:	f3 90                	pause
+f01085b7:	89 d0                	mov    %edx,%eax
+f01085b9:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&lk->locked, 1) != 0)
+f01085bc:	85 c0                	test   %eax,%eax
+f01085be:	75 f5                	jne    f01085b5 <spin_lock+0x22>
+
+	// Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
+f01085c0:	e8 34 fd ff ff       	call   f01082f9 <cpunum>
+f01085c5:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01085cb:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f01085d0:	89 43 08             	mov    %eax,0x8(%ebx)
+        __asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f01085d3:	89 e8                	mov    %ebp,%eax
+	ebp = (uint32_t *)read_ebp();
+f01085d5:	89 c2                	mov    %eax,%edx
+		    || ebp >= (uint32_t *)IOMEMBASE)
+f01085d7:	05 00 00 80 10       	add    $0x10800000,%eax
+		if (ebp == 0 || ebp < (uint32_t *)ULIM
+f01085dc:	3d ff ff 7f 0e       	cmp    $0xe7fffff,%eax
+f01085e1:	77 7d                	ja     f0108660 <spin_lock+0xcd>
+	for (i = 0; i < 10; i++){
+f01085e3:	b8 00 00 00 00       	mov    $0x0,%eax
+		pcs[i] = ebp[1];          // saved %eip
+f01085e8:	8b 4a 04             	mov    0x4(%edx),%ecx
+f01085eb:	89 4c 83 0c          	mov    %ecx,0xc(%ebx,%eax,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f01085ef:	8b 12                	mov    (%edx),%edx
+	for (i = 0; i < 10; i++){
+f01085f1:	83 c0 01             	add    $0x1,%eax
+f01085f4:	83 f8 0a             	cmp    $0xa,%eax
+f01085f7:	74 27                	je     f0108620 <spin_lock+0x8d>
+		    || ebp >= (uint32_t *)IOMEMBASE)
+f01085f9:	8d 8a 00 00 80 10    	lea    0x10800000(%edx),%ecx
+		if (ebp == 0 || ebp < (uint32_t *)ULIM
+f01085ff:	81 f9 ff ff 7f 0e    	cmp    $0xe7fffff,%ecx
+f0108605:	76 e1                	jbe    f01085e8 <spin_lock+0x55>
+	for (; i < 10; i++)
+f0108607:	83 f8 09             	cmp    $0x9,%eax
+f010860a:	7f 14                	jg     f0108620 <spin_lock+0x8d>
+f010860c:	8d 44 83 0c          	lea    0xc(%ebx,%eax,4),%eax
+f0108610:	83 c3 34             	add    $0x34,%ebx
+		pcs[i] = 0;
+f0108613:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	for (; i < 10; i++)
+f0108619:	83 c0 04             	add    $0x4,%eax
+f010861c:	39 d8                	cmp    %ebx,%eax
+f010861e:	75 f3                	jne    f0108613 <spin_lock+0x80>
+	get_caller_pcs(lk->pcs);
+#endif
+}
+f0108620:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108623:	5b                   	pop    %ebx
+f0108624:	5e                   	pop    %esi
+f0108625:	5d                   	pop    %ebp
+f0108626:	c3                   	ret
+	return lock->locked && lock->cpu == thiscpu;
+f0108627:	8b 73 08             	mov    0x8(%ebx),%esi
+f010862a:	e8 ca fc ff ff       	call   f01082f9 <cpunum>
+f010862f:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0108635:	05 20 00 93 f0       	add    $0xf0930020,%eax
+	if (holding(lk))
+f010863a:	39 c6                	cmp    %eax,%esi
+f010863c:	0f 85 62 ff ff ff    	jne    f01085a4 <spin_lock+0x11>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f0108642:	8b 5b 04             	mov    0x4(%ebx),%ebx
+f0108645:	e8 af fc ff ff       	call   f01082f9 <cpunum>
+f010864a:	83 ec 0c             	sub    $0xc,%esp
+f010864d:	53                   	push   %ebx
+f010864e:	50                   	push   %eax
+f010864f:	68 f0 cd 10 f0       	push   $0xf010cdf0
+f0108654:	6a 42                	push   $0x42
+f0108656:	68 52 ce 10 f0       	push   $0xf010ce52
+f010865b:	e8 e0 79 ff ff       	call   f0100040 <_panic>
+	for (i = 0; i < 10; i++){
+f0108660:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108665:	eb a5                	jmp    f010860c <spin_lock+0x79>
+
+f0108667 <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f0108667:	55                   	push   %ebp
+f0108668:	89 e5                	mov    %esp,%ebp
+f010866a:	57                   	push   %edi
+f010866b:	56                   	push   %esi
+f010866c:	53                   	push   %ebx
+f010866d:	83 ec 5c             	sub    $0x5c,%esp
+f0108670:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->locked && lock->cpu == thiscpu;
+f0108673:	83 3e 00             	cmpl   $0x0,(%esi)
+f0108676:	75 38                	jne    f01086b0 <spin_unlock+0x49>
+#ifdef DEBUG_SPINLOCK
+	if (!holding(lk)) {
+		int i;
+		uint32_t pcs[10];
+		// Nab the acquiring EIP chain before it gets released
+		memmove(pcs, lk->pcs, sizeof pcs);
+f0108678:	83 ec 04             	sub    $0x4,%esp
+f010867b:	6a 28                	push   $0x28
+f010867d:	8d 46 0c             	lea    0xc(%esi),%eax
+f0108680:	50                   	push   %eax
+f0108681:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f0108684:	53                   	push   %ebx
+f0108685:	e8 49 f6 ff ff       	call   f0107cd3 <memmove>
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+			cpunum(), lk->name, lk->cpu->cpu_id);
+f010868a:	8b 46 08             	mov    0x8(%esi),%eax
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+f010868d:	0f b6 38             	movzbl (%eax),%edi
+f0108690:	8b 76 04             	mov    0x4(%esi),%esi
+f0108693:	e8 61 fc ff ff       	call   f01082f9 <cpunum>
+f0108698:	57                   	push   %edi
+f0108699:	56                   	push   %esi
+f010869a:	50                   	push   %eax
+f010869b:	68 1c ce 10 f0       	push   $0xf010ce1c
+f01086a0:	e8 47 c0 ff ff       	call   f01046ec <cprintf>
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f01086a5:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f01086a8:	83 c4 20             	add    $0x20,%esp
+			struct Eipdebuginfo info;
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f01086ab:	8d 75 a8             	lea    -0x58(%ebp),%esi
+f01086ae:	eb 51                	jmp    f0108701 <spin_unlock+0x9a>
+	return lock->locked && lock->cpu == thiscpu;
+f01086b0:	8b 5e 08             	mov    0x8(%esi),%ebx
+f01086b3:	e8 41 fc ff ff       	call   f01082f9 <cpunum>
+f01086b8:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01086be:	05 20 00 93 f0       	add    $0xf0930020,%eax
+	if (!holding(lk)) {
+f01086c3:	39 c3                	cmp    %eax,%ebx
+f01086c5:	75 b1                	jne    f0108678 <spin_unlock+0x11>
+				cprintf("  %08x\n", pcs[i]);
+		}
+		panic("spin_unlock");
+	}
+
+	lk->pcs[0] = 0;
+f01086c7:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	lk->cpu = 0;
+f01086ce:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+	asm volatile("lock; xchgl %0, %1" :
+f01086d5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01086da:	f0 87 06             	lock xchg %eax,(%esi)
+	// Paper says that Intel 64 and IA-32 will not move a load
+	// after a store. So lock->locked = 0 would work here.
+	// The xchg being asm volatile ensures gcc emits it after
+	// the above assignments (and after the critical section).
+	xchg(&lk->locked, 0);
+}
+f01086dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01086e0:	5b                   	pop    %ebx
+f01086e1:	5e                   	pop    %esi
+f01086e2:	5f                   	pop    %edi
+f01086e3:	5d                   	pop    %ebp
+f01086e4:	c3                   	ret
+				cprintf("  %08x\n", pcs[i]);
+f01086e5:	83 ec 08             	sub    $0x8,%esp
+f01086e8:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01086eb:	ff 30                	push   (%eax)
+f01086ed:	68 79 ce 10 f0       	push   $0xf010ce79
+f01086f2:	e8 f5 bf ff ff       	call   f01046ec <cprintf>
+f01086f7:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f01086fa:	83 c3 04             	add    $0x4,%ebx
+f01086fd:	39 fb                	cmp    %edi,%ebx
+f01086ff:	74 44                	je     f0108745 <spin_unlock+0xde>
+f0108701:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f0108704:	8b 03                	mov    (%ebx),%eax
+f0108706:	85 c0                	test   %eax,%eax
+f0108708:	74 3b                	je     f0108745 <spin_unlock+0xde>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f010870a:	83 ec 08             	sub    $0x8,%esp
+f010870d:	56                   	push   %esi
+f010870e:	50                   	push   %eax
+f010870f:	e8 5b e9 ff ff       	call   f010706f <debuginfo_eip>
+f0108714:	83 c4 10             	add    $0x10,%esp
+f0108717:	85 c0                	test   %eax,%eax
+f0108719:	78 ca                	js     f01086e5 <spin_unlock+0x7e>
+					pcs[i] - info.eip_fn_addr);
+f010871b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010871e:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f0108720:	83 ec 04             	sub    $0x4,%esp
+f0108723:	89 c2                	mov    %eax,%edx
+f0108725:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f0108728:	52                   	push   %edx
+f0108729:	ff 75 b0             	push   -0x50(%ebp)
+f010872c:	ff 75 b4             	push   -0x4c(%ebp)
+f010872f:	ff 75 ac             	push   -0x54(%ebp)
+f0108732:	ff 75 a8             	push   -0x58(%ebp)
+f0108735:	50                   	push   %eax
+f0108736:	68 62 ce 10 f0       	push   $0xf010ce62
+f010873b:	e8 ac bf ff ff       	call   f01046ec <cprintf>
+f0108740:	83 c4 20             	add    $0x20,%esp
+f0108743:	eb b5                	jmp    f01086fa <spin_unlock+0x93>
+		panic("spin_unlock");
+f0108745:	83 ec 04             	sub    $0x4,%esp
+f0108748:	68 81 ce 10 f0       	push   $0xf010ce81
+f010874d:	6a 68                	push   $0x68
+f010874f:	68 52 ce 10 f0       	push   $0xf010ce52
+f0108754:	e8 e7 78 ff ff       	call   f0100040 <_panic>
+
+f0108759 <tlb_queue_pgdir>:
+}
+
+// Queue 'va' in 'pgdir' for every other CPU in the address space's mask.
+static void
+tlb_queue_pgdir(pde_t *pgdir, uintptr_t va)
+{
+f0108759:	55                   	push   %ebp
+f010875a:	89 e5                	mov    %esp,%ebp
+f010875c:	57                   	push   %edi
+f010875d:	56                   	push   %esi
+f010875e:	53                   	push   %ebx
+f010875f:	83 ec 0c             	sub    $0xc,%esp
+f0108762:	89 c6                	mov    %eax,%esi
+	struct Cpu *c;
+
+	for (c = cpus; c < cpus + ncpu; c++)
+f0108764:	69 05 a4 06 93 f0 d0 	imul   $0xd0,0xf09306a4,%eax
+f010876b:	00 00 00 
+f010876e:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f0108773:	3d 20 00 93 f0       	cmp    $0xf0930020,%eax
+f0108778:	0f 86 99 00 00 00    	jbe    f0108817 <tlb_queue_pgdir+0xbe>
+f010877e:	89 d7                	mov    %edx,%edi
+f0108780:	bb 20 00 93 f0       	mov    $0xf0930020,%ebx
+f0108785:	eb 48                	jmp    f01087cf <tlb_queue_pgdir+0x76>
+		c->cpu_tlb_n = TLB_FLUSH_ALL;
+f0108787:	c7 83 8c 00 00 00 11 	movl   $0x11,0x8c(%ebx)
+f010878e:	00 00 00 
+		tlb_stats.ts_full++;
+f0108791:	83 05 0c 10 97 f0 01 	addl   $0x1,0xf097100c
+	tlb_pending |= 1 << (c - cpus);
+f0108798:	89 d9                	mov    %ebx,%ecx
+f010879a:	81 e9 20 00 93 f0    	sub    $0xf0930020,%ecx
+f01087a0:	c1 f9 04             	sar    $0x4,%ecx
+f01087a3:	69 c9 c5 4e ec c4    	imul   $0xc4ec4ec5,%ecx,%ecx
+f01087a9:	b8 01 00 00 00       	mov    $0x1,%eax
+f01087ae:	d3 e0                	shl    %cl,%eax
+f01087b0:	09 05 80 ce 92 f0    	or     %eax,0xf092ce80
+	for (c = cpus; c < cpus + ncpu; c++)
+f01087b6:	81 c3 d0 00 00 00    	add    $0xd0,%ebx
+f01087bc:	69 05 a4 06 93 f0 d0 	imul   $0xd0,0xf09306a4,%eax
+f01087c3:	00 00 00 
+f01087c6:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f01087cb:	39 c3                	cmp    %eax,%ebx
+f01087cd:	73 48                	jae    f0108817 <tlb_queue_pgdir+0xbe>
+		if (c != thiscpu && c->cpu_pgdir == pgdir)
+f01087cf:	e8 25 fb ff ff       	call   f01082f9 <cpunum>
+f01087d4:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01087da:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f01087df:	39 c3                	cmp    %eax,%ebx
+f01087e1:	74 d3                	je     f01087b6 <tlb_queue_pgdir+0x5d>
+f01087e3:	8b 43 7c             	mov    0x7c(%ebx),%eax
+f01087e6:	39 f0                	cmp    %esi,%eax
+f01087e8:	75 cc                	jne    f01087b6 <tlb_queue_pgdir+0x5d>
+	tlb_stats.ts_queued++;
+f01087ea:	83 05 08 10 97 f0 01 	addl   $0x1,0xf0971008
+	if (c->cpu_tlb_n == TLB_FLUSH_ALL)
+f01087f1:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+f01087f7:	83 f8 11             	cmp    $0x11,%eax
+f01087fa:	74 ba                	je     f01087b6 <tlb_queue_pgdir+0x5d>
+	if (va == 0 || c->cpu_tlb_n == TLB_BATCH) {
+f01087fc:	85 ff                	test   %edi,%edi
+f01087fe:	74 87                	je     f0108787 <tlb_queue_pgdir+0x2e>
+f0108800:	83 f8 10             	cmp    $0x10,%eax
+f0108803:	74 82                	je     f0108787 <tlb_queue_pgdir+0x2e>
+		c->cpu_tlb_va[c->cpu_tlb_n++] = va;
+f0108805:	8d 50 01             	lea    0x1(%eax),%edx
+f0108808:	89 93 8c 00 00 00    	mov    %edx,0x8c(%ebx)
+f010880e:	89 bc 83 90 00 00 00 	mov    %edi,0x90(%ebx,%eax,4)
+f0108815:	eb 81                	jmp    f0108798 <tlb_queue_pgdir+0x3f>
+			tlb_queue(c, va);
+}
+f0108817:	83 c4 0c             	add    $0xc,%esp
+f010881a:	5b                   	pop    %ebx
+f010881b:	5e                   	pop    %esi
+f010881c:	5f                   	pop    %edi
+f010881d:	5d                   	pop    %ebp
+f010881e:	c3                   	ret
+
+f010881f <tlb_invalidate>:
+// cache it.  The local flush happens now; the others at the next
+// tlb_shootdown().
+//
+void
+tlb_invalidate(pde_t *pgdir, void *va)
+{
+f010881f:	55                   	push   %ebp
+f0108820:	89 e5                	mov    %esp,%ebp
+f0108822:	56                   	push   %esi
+f0108823:	53                   	push   %ebx
+f0108824:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108827:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// Flush the entry only if we're modifying the current address space.
+	if (!curenv || rcr3() == PADDR(pgdir))
+f010882a:	e8 ca fa ff ff       	call   f01082f9 <cpunum>
+f010882f:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0108835:	83 b8 28 00 93 f0 00 	cmpl   $0x0,-0xf6cffd8(%eax)
+f010883c:	74 15                	je     f0108853 <tlb_invalidate+0x34>
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f010883e:	0f 20 d8             	mov    %cr3,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0108841:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f0108847:	76 26                	jbe    f010886f <tlb_invalidate+0x50>
+	return (physaddr_t)kva - KERNBASE;
+f0108849:	8d 96 00 00 00 10    	lea    0x10000000(%esi),%edx
+f010884f:	39 d0                	cmp    %edx,%eax
+f0108851:	75 03                	jne    f0108856 <tlb_invalidate+0x37>
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f0108853:	0f 01 3b             	invlpg (%ebx)
+		invlpg(va);
+	tlb_queue_pgdir(pgdir, (uintptr_t) ROUNDDOWN(va, PGSIZE) | 1);
+f0108856:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f010885c:	89 da                	mov    %ebx,%edx
+f010885e:	83 ca 01             	or     $0x1,%edx
+f0108861:	89 f0                	mov    %esi,%eax
+f0108863:	e8 f1 fe ff ff       	call   f0108759 <tlb_queue_pgdir>
+}
+f0108868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010886b:	5b                   	pop    %ebx
+f010886c:	5e                   	pop    %esi
+f010886d:	5d                   	pop    %ebp
+f010886e:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010886f:	56                   	push   %esi
+f0108870:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f0108875:	6a 47                	push   $0x47
+f0108877:	68 99 ce 10 f0       	push   $0xf010ce99
+f010887c:	e8 bf 77 ff ff       	call   f0100040 <_panic>
+
+f0108881 <tlb_invalidate_all>:
+//
+// Like tlb_invalidate, for changes too large to flush page by page.
+//
+void
+tlb_invalidate_all(pde_t *pgdir)
+{
+f0108881:	55                   	push   %ebp
+f0108882:	89 e5                	mov    %esp,%ebp
+f0108884:	83 ec 08             	sub    $0x8,%esp
+f0108887:	8b 45 08             	mov    0x8(%ebp),%eax
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f010888a:	0f 20 d9             	mov    %cr3,%ecx
+	if ((uint32_t)kva < KERNBASE)
+f010888d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0108892:	76 16                	jbe    f01088aa <tlb_invalidate_all+0x29>
+	return (physaddr_t)kva - KERNBASE;
+f0108894:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+	if (rcr3() == PADDR(pgdir))
+f010889a:	39 d1                	cmp    %edx,%ecx
+f010889c:	74 1e                	je     f01088bc <tlb_invalidate_all+0x3b>
+		lcr3(PADDR(pgdir));
+	tlb_queue_pgdir(pgdir, 0);
+f010889e:	ba 00 00 00 00       	mov    $0x0,%edx
+f01088a3:	e8 b1 fe ff ff       	call   f0108759 <tlb_queue_pgdir>
+}
+f01088a8:	c9                   	leave
+f01088a9:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01088aa:	50                   	push   %eax
+f01088ab:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01088b0:	6a 52                	push   $0x52
+f01088b2:	68 99 ce 10 f0       	push   $0xf010ce99
+f01088b7:	e8 84 77 ff ff       	call   f0100040 <_panic>
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01088bc:	0f 22 da             	mov    %edx,%cr3
+}
+f01088bf:	eb dd                	jmp    f010889e <tlb_invalidate_all+0x1d>
+
+f01088c1 <tlb_init_percpu>:
+// Enable global pages on this CPU, so that kernel mappings (those
+// with PTE_G) are not flushed when CR3 is reloaded.
+//
+void
+tlb_init_percpu(void)
+{
+f01088c1:	55                   	push   %ebp
+f01088c2:	89 e5                	mov    %esp,%ebp
+f01088c4:	53                   	push   %ebx
+	asm volatile("cpuid" 
+f01088c5:	b8 01 00 00 00       	mov    $0x1,%eax
+f01088ca:	0f a2                	cpuid
+	uint32_t eax, ebx, ecx, edx;
+
+	cpuid(1, &eax, &ebx, &ecx, &edx);
+	if (edx & CPUID_PGE)
+f01088cc:	f6 c6 20             	test   $0x20,%dh
+f01088cf:	74 08                	je     f01088d9 <tlb_init_percpu+0x18>
+	__asm __volatile("movl %%cr4,%0" : "=r" (cr4));
+f01088d1:	0f 20 e0             	mov    %cr4,%eax
+		lcr4(rcr4() | CR4_PGE);
+f01088d4:	0c 80                	or     $0x80,%al
+	__asm __volatile("movl %0,%%cr4" : : "r" (val));
+f01088d6:	0f 22 e0             	mov    %eax,%cr4
+}
+f01088d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01088dc:	c9                   	leave
+f01088dd:	c3                   	ret
+
+f01088de <tlb_flush_pending>:
+// Carry out the shootdowns posted to this CPU.  Runs from the
+// T_TLBFLUSH IPI, and after acquiring the kernel lock.
+//
+void
+tlb_flush_pending(void)
+{
+f01088de:	55                   	push   %ebp
+f01088df:	89 e5                	mov    %esp,%ebp
+f01088e1:	57                   	push   %edi
+f01088e2:	56                   	push   %esi
+f01088e3:	53                   	push   %ebx
+f01088e4:	83 ec 0c             	sub    $0xc,%esp
+	struct Cpu *c = thiscpu;
+f01088e7:	e8 0d fa ff ff       	call   f01082f9 <cpunum>
+f01088ec:	89 c1                	mov    %eax,%ecx
+	uint32_t gen = c->cpu_tlb_gen;
+f01088ee:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01088f4:	8b 98 a4 00 93 f0    	mov    -0xf6cff5c(%eax),%ebx
+f01088fa:	05 20 00 93 f0       	add    $0xf0930020,%eax
+	int i;
+
+	if (c->cpu_tlb_done == gen)
+f01088ff:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+f0108905:	39 d8                	cmp    %ebx,%eax
+f0108907:	74 56                	je     f010895f <tlb_flush_pending+0x81>
+		return;
+	if (c->cpu_tlb_n == TLB_FLUSH_ALL)
+f0108909:	69 c1 d0 00 00 00    	imul   $0xd0,%ecx,%eax
+f010890f:	8b 80 ac 00 93 f0    	mov    -0xf6cff54(%eax),%eax
+f0108915:	83 f8 11             	cmp    $0x11,%eax
+f0108918:	74 4d                	je     f0108967 <tlb_flush_pending+0x89>
+		lcr3(rcr3());
+	else
+		for (i = 0; i < c->cpu_tlb_n; i++)
+f010891a:	85 c0                	test   %eax,%eax
+f010891c:	7e 2b                	jle    f0108949 <tlb_flush_pending+0x6b>
+f010891e:	69 f9 d0 00 00 00    	imul   $0xd0,%ecx,%edi
+f0108924:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108929:	89 fe                	mov    %edi,%esi
+f010892b:	81 c6 20 00 93 f0    	add    $0xf0930020,%esi
+			invlpg((void *) (c->cpu_tlb_va[i] & ~1));
+f0108931:	8b 94 87 b0 00 93 f0 	mov    -0xf6cff50(%edi,%eax,4),%edx
+f0108938:	83 e2 fe             	and    $0xfffffffe,%edx
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f010893b:	0f 01 3a             	invlpg (%edx)
+		for (i = 0; i < c->cpu_tlb_n; i++)
+f010893e:	83 c0 01             	add    $0x1,%eax
+f0108941:	39 86 8c 00 00 00    	cmp    %eax,0x8c(%esi)
+f0108947:	7f e8                	jg     f0108931 <tlb_flush_pending+0x53>
+	c->cpu_tlb_n = 0;
+f0108949:	69 c9 d0 00 00 00    	imul   $0xd0,%ecx,%ecx
+f010894f:	c7 81 ac 00 93 f0 00 	movl   $0x0,-0xf6cff54(%ecx)
+f0108956:	00 00 00 
+	c->cpu_tlb_done = gen;
+f0108959:	89 99 a8 00 93 f0    	mov    %ebx,-0xf6cff58(%ecx)
+}
+f010895f:	83 c4 0c             	add    $0xc,%esp
+f0108962:	5b                   	pop    %ebx
+f0108963:	5e                   	pop    %esi
+f0108964:	5f                   	pop    %edi
+f0108965:	5d                   	pop    %ebp
+f0108966:	c3                   	ret
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f0108967:	0f 20 d8             	mov    %cr3,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f010896a:	0f 22 d8             	mov    %eax,%cr3
+}
+f010896d:	eb da                	jmp    f0108949 <tlb_flush_pending+0x6b>
+
+f010896f <tlb_load_pgdir>:
+{
+f010896f:	55                   	push   %ebp
+f0108970:	89 e5                	mov    %esp,%ebp
+f0108972:	53                   	push   %ebx
+f0108973:	83 ec 04             	sub    $0x4,%esp
+f0108976:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f0108979:	0f 20 da             	mov    %cr3,%edx
+	if ((uint32_t)kva < KERNBASE)
+f010897c:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0108982:	76 63                	jbe    f01089e7 <tlb_load_pgdir+0x78>
+	return (physaddr_t)kva - KERNBASE;
+f0108984:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+	if (rcr3() == PADDR(pgdir)) {
+f010898a:	39 c2                	cmp    %eax,%edx
+f010898c:	74 6b                	je     f01089f9 <tlb_load_pgdir+0x8a>
+	tlb_stats.ts_cr3loads++;
+f010898e:	83 05 18 10 97 f0 01 	addl   $0x1,0xf0971018
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0108995:	0f 22 d8             	mov    %eax,%cr3
+	thiscpu->cpu_pgdir = pgdir;
+f0108998:	e8 5c f9 ff ff       	call   f01082f9 <cpunum>
+f010899d:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01089a3:	89 98 9c 00 93 f0    	mov    %ebx,-0xf6cff64(%eax)
+	thiscpu->cpu_tlb_n = 0;
+f01089a9:	e8 4b f9 ff ff       	call   f01082f9 <cpunum>
+f01089ae:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01089b4:	c7 80 ac 00 93 f0 00 	movl   $0x0,-0xf6cff54(%eax)
+f01089bb:	00 00 00 
+	thiscpu->cpu_tlb_done = thiscpu->cpu_tlb_gen;
+f01089be:	e8 36 f9 ff ff       	call   f01082f9 <cpunum>
+f01089c3:	89 c3                	mov    %eax,%ebx
+f01089c5:	e8 2f f9 ff ff       	call   f01082f9 <cpunum>
+f01089ca:	69 db d0 00 00 00    	imul   $0xd0,%ebx,%ebx
+f01089d0:	8b 93 a4 00 93 f0    	mov    -0xf6cff5c(%ebx),%edx
+f01089d6:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f01089dc:	89 90 a8 00 93 f0    	mov    %edx,-0xf6cff58(%eax)
+}
+f01089e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01089e5:	c9                   	leave
+f01089e6:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01089e7:	53                   	push   %ebx
+f01089e8:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01089ed:	6a 6f                	push   $0x6f
+f01089ef:	68 99 ce 10 f0       	push   $0xf010ce99
+f01089f4:	e8 47 76 ff ff       	call   f0100040 <_panic>
+		tlb_flush_pending();
+f01089f9:	e8 e0 fe ff ff       	call   f01088de <tlb_flush_pending>
+		thiscpu->cpu_pgdir = pgdir;
+f01089fe:	e8 f6 f8 ff ff       	call   f01082f9 <cpunum>
+f0108a03:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0108a09:	89 98 9c 00 93 f0    	mov    %ebx,-0xf6cff64(%eax)
+		return;
+f0108a0f:	eb d1                	jmp    f01089e2 <tlb_load_pgdir+0x73>
+
+f0108a11 <tlb_shootdown>:
+// flushed, or is waiting for the kernel lock and will flush when it
+// gets it.  Must be called with the kernel lock held.
+//
+void
+tlb_shootdown(void)
+{
+f0108a11:	55                   	push   %ebp
+f0108a12:	89 e5                	mov    %esp,%ebp
+f0108a14:	57                   	push   %edi
+f0108a15:	56                   	push   %esi
+f0108a16:	53                   	push   %ebx
+f0108a17:	83 ec 2c             	sub    $0x2c,%esp
+	uint32_t mask, gen[NCPU];
+	int i;
+
+	if ((mask = tlb_pending) == 0)
+f0108a1a:	8b 3d 80 ce 92 f0    	mov    0xf092ce80,%edi
+f0108a20:	85 ff                	test   %edi,%edi
+f0108a22:	0f 84 e2 00 00 00    	je     f0108b0a <tlb_shootdown+0xf9>
+		return;
+	tlb_pending = 0;
+f0108a28:	c7 05 80 ce 92 f0 00 	movl   $0x0,0xf092ce80
+f0108a2f:	00 00 00 
+	tlb_round++;
+f0108a32:	83 05 04 10 97 f0 01 	addl   $0x1,0xf0971004
+	tlb_stats.ts_rounds++;
+f0108a39:	83 05 10 10 97 f0 01 	addl   $0x1,0xf0971010
+	for (i = 0; i < ncpu; i++)
+f0108a40:	83 3d a4 06 93 f0 00 	cmpl   $0x0,0xf09306a4
+f0108a47:	0f 8e bd 00 00 00    	jle    f0108b0a <tlb_shootdown+0xf9>
+f0108a4d:	be 20 00 93 f0       	mov    $0xf0930020,%esi
+f0108a52:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0108a57:	eb 12                	jmp    f0108a6b <tlb_shootdown+0x5a>
+f0108a59:	83 c3 01             	add    $0x1,%ebx
+f0108a5c:	a1 a4 06 93 f0       	mov    0xf09306a4,%eax
+f0108a61:	81 c6 d0 00 00 00    	add    $0xd0,%esi
+f0108a67:	39 d8                	cmp    %ebx,%eax
+f0108a69:	7e 40                	jle    f0108aab <tlb_shootdown+0x9a>
+		if (mask & (1 << i)) {
+f0108a6b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0108a70:	89 d9                	mov    %ebx,%ecx
+f0108a72:	d3 e0                	shl    %cl,%eax
+f0108a74:	85 f8                	test   %edi,%eax
+f0108a76:	74 e1                	je     f0108a59 <tlb_shootdown+0x48>
+			gen[i] = ++cpus[i].cpu_tlb_gen;
+f0108a78:	69 d3 d0 00 00 00    	imul   $0xd0,%ebx,%edx
+f0108a7e:	8b 82 a4 00 93 f0    	mov    -0xf6cff5c(%edx),%eax
+f0108a84:	83 c0 01             	add    $0x1,%eax
+f0108a87:	89 82 a4 00 93 f0    	mov    %eax,-0xf6cff5c(%edx)
+f0108a8d:	89 44 9d c8          	mov    %eax,-0x38(%ebp,%ebx,4)
+			lapic_ipi_cpu(cpus[i].cpu_id, T_TLBFLUSH);
+f0108a91:	83 ec 08             	sub    $0x8,%esp
+f0108a94:	6a 31                	push   $0x31
+f0108a96:	0f b6 06             	movzbl (%esi),%eax
+f0108a99:	50                   	push   %eax
+f0108a9a:	e8 a3 fa ff ff       	call   f0108542 <lapic_ipi_cpu>
+			tlb_stats.ts_ipis++;
+f0108a9f:	83 05 14 10 97 f0 01 	addl   $0x1,0xf0971014
+f0108aa6:	83 c4 10             	add    $0x10,%esp
+f0108aa9:	eb ae                	jmp    f0108a59 <tlb_shootdown+0x48>
+		}
+	for (i = 0; i < ncpu; i++)
+f0108aab:	85 c0                	test   %eax,%eax
+f0108aad:	7e 5b                	jle    f0108b0a <tlb_shootdown+0xf9>
+f0108aaf:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108ab4:	eb 0b                	jmp    f0108ac1 <tlb_shootdown+0xb0>
+f0108ab6:	83 c1 01             	add    $0x1,%ecx
+f0108ab9:	39 0d a4 06 93 f0    	cmp    %ecx,0xf09306a4
+f0108abf:	7e 49                	jle    f0108b0a <tlb_shootdown+0xf9>
+		if (mask & (1 << i))
+f0108ac1:	b8 01 00 00 00       	mov    $0x1,%eax
+f0108ac6:	d3 e0                	shl    %cl,%eax
+f0108ac8:	85 f8                	test   %edi,%eax
+f0108aca:	74 ea                	je     f0108ab6 <tlb_shootdown+0xa5>
+			while (cpus[i].cpu_tlb_done != gen[i]
+f0108acc:	69 c1 d0 00 00 00    	imul   $0xd0,%ecx,%eax
+f0108ad2:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f0108ad7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+f0108add:	89 cb                	mov    %ecx,%ebx
+			       && !cpus[i].cpu_tlb_locking)
+f0108adf:	3b 44 8d c8          	cmp    -0x38(%ebp,%ecx,4),%eax
+f0108ae3:	74 d1                	je     f0108ab6 <tlb_shootdown+0xa5>
+f0108ae5:	69 c1 d0 00 00 00    	imul   $0xd0,%ecx,%eax
+f0108aeb:	05 20 00 93 f0       	add    $0xf0930020,%eax
+f0108af0:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+f0108af6:	85 d2                	test   %edx,%edx
+f0108af8:	75 bc                	jne    f0108ab6 <tlb_shootdown+0xa5>
+				asm volatile("pause");
+f0108afa:	f3 90                	pause
+			while (cpus[i].cpu_tlb_done != gen[i]
+f0108afc:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+			       && !cpus[i].cpu_tlb_locking)
+f0108b02:	3b 54 9d c8          	cmp    -0x38(%ebp,%ebx,4),%edx
+f0108b06:	75 e8                	jne    f0108af0 <tlb_shootdown+0xdf>
+f0108b08:	eb ac                	jmp    f0108ab6 <tlb_shootdown+0xa5>
+}
+f0108b0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108b0d:	5b                   	pop    %ebx
+f0108b0e:	5e                   	pop    %esi
+f0108b0f:	5f                   	pop    %edi
+f0108b10:	5d                   	pop    %ebp
+f0108b11:	c3                   	ret
+
+f0108b12 <tx_post>:
+// Fill in transmit descriptor 'i'.  Only every TX_RS_EVERY'th
+// descriptor asks the card to report completion.  Extended (DEXT)
+// descriptors take the checksum options in 'popts'.
+static void
+tx_post(int i, physaddr_t addr, uint16_t len, uint8_t cmd, uint8_t popts)
+{
+f0108b12:	55                   	push   %ebp
+f0108b13:	89 e5                	mov    %esp,%ebp
+f0108b15:	57                   	push   %edi
+f0108b16:	56                   	push   %esi
+f0108b17:	53                   	push   %ebx
+f0108b18:	89 d6                	mov    %edx,%esi
+f0108b1a:	89 cf                	mov    %ecx,%edi
+f0108b1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (i % TX_RS_EVERY == TX_RS_EVERY - 1)
+f0108b1f:	89 c1                	mov    %eax,%ecx
+f0108b21:	c1 f9 1f             	sar    $0x1f,%ecx
+f0108b24:	c1 e9 1d             	shr    $0x1d,%ecx
+f0108b27:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+f0108b2a:	83 e2 07             	and    $0x7,%edx
+f0108b2d:	29 ca                	sub    %ecx,%edx
+		cmd |= E1000_TXD_CMD_RS;
+f0108b2f:	0f b6 4d 08          	movzbl 0x8(%ebp),%ecx
+f0108b33:	83 c9 08             	or     $0x8,%ecx
+f0108b36:	83 fa 07             	cmp    $0x7,%edx
+f0108b39:	0f b6 55 08          	movzbl 0x8(%ebp),%edx
+f0108b3d:	0f 45 ca             	cmovne %edx,%ecx
+	tx_fifo[i].addr = addr;
+f0108b40:	c1 e0 04             	shl    $0x4,%eax
+f0108b43:	03 05 a0 14 97 f0    	add    0xf09714a0,%eax
+f0108b49:	89 30                	mov    %esi,(%eax)
+f0108b4b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	tx_fifo[i].length = len;
+f0108b52:	66 89 78 08          	mov    %di,0x8(%eax)
+	tx_fifo[i].cso = (cmd & E1000_TXD_CMD_DEXT) ? E1000_TXD_DTYP_D : 0;
+f0108b56:	89 ca                	mov    %ecx,%edx
+f0108b58:	d0 ea                	shr    %dl
+f0108b5a:	83 e2 10             	and    $0x10,%edx
+f0108b5d:	88 50 0a             	mov    %dl,0xa(%eax)
+	tx_fifo[i].cmd = cmd;
+f0108b60:	88 48 0b             	mov    %cl,0xb(%eax)
+	tx_fifo[i].status = 0;
+f0108b63:	c6 40 0c 00          	movb   $0x0,0xc(%eax)
+	tx_fifo[i].css = popts;
+f0108b67:	88 58 0d             	mov    %bl,0xd(%eax)
+	tx_fifo[i].special = 0;
+f0108b6a:	66 c7 40 0e 00 00    	movw   $0x0,0xe(%eax)
+}
+f0108b70:	5b                   	pop    %ebx
+f0108b71:	5e                   	pop    %esi
+f0108b72:	5f                   	pop    %edi
+f0108b73:	5d                   	pop    %ebp
+f0108b74:	c3                   	ret
+
+f0108b75 <tx_free>:
+// Number of descriptors we may post (one stays empty, since
+// head == tail means an empty ring).
+static int
+tx_free(void)
+{
+	int tail = e100[E1000_TDT/sizeof(uint32_t)];
+f0108b75:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0108b7a:	8b 80 18 38 00 00    	mov    0x3818(%eax),%eax
+
+	return (tx_clean - tail - 1 + ntx) % ntx;
+f0108b80:	8b 0d 9c 10 97 f0    	mov    0xf097109c,%ecx
+f0108b86:	f7 d0                	not    %eax
+f0108b88:	03 05 a0 f0 92 f0    	add    0xf092f0a0,%eax
+f0108b8e:	01 c8                	add    %ecx,%eax
+f0108b90:	99                   	cltd
+f0108b91:	f7 f9                	idiv   %ecx
+}
+f0108b93:	89 d0                	mov    %edx,%eax
+f0108b95:	c3                   	ret
+
+f0108b96 <rx_ready>:
+
+// Number of received packets waiting in the ring.
+static int
+rx_ready(void)
+{
+f0108b96:	55                   	push   %ebp
+f0108b97:	89 e5                	mov    %esp,%ebp
+f0108b99:	57                   	push   %edi
+f0108b9a:	56                   	push   %esi
+f0108b9b:	53                   	push   %ebx
+	int i, n = 0;
+
+	for (i = rx_next; n < nrx - 1 && (rx_fifo[i].status & E1000_RXD_STAT_DD);
+f0108b9c:	8b 15 a4 f0 92 f0    	mov    0xf092f0a4,%edx
+f0108ba2:	8b 1d 24 10 97 f0    	mov    0xf0971024,%ebx
+f0108ba8:	83 fb 01             	cmp    $0x1,%ebx
+f0108bab:	7e 30                	jle    f0108bdd <rx_ready+0x47>
+f0108bad:	8b 35 20 10 97 f0    	mov    0xf0971020,%esi
+f0108bb3:	8d 7b ff             	lea    -0x1(%ebx),%edi
+	int i, n = 0;
+f0108bb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = rx_next; n < nrx - 1 && (rx_fifo[i].status & E1000_RXD_STAT_DD);
+f0108bbb:	89 d0                	mov    %edx,%eax
+f0108bbd:	c1 e0 04             	shl    $0x4,%eax
+f0108bc0:	f6 44 06 0c 01       	testb  $0x1,0xc(%esi,%eax,1)
+f0108bc5:	74 0f                	je     f0108bd6 <rx_ready+0x40>
+	     i = (i + 1) % nrx)
+		n++;
+f0108bc7:	83 c1 01             	add    $0x1,%ecx
+	     i = (i + 1) % nrx)
+f0108bca:	8d 42 01             	lea    0x1(%edx),%eax
+f0108bcd:	99                   	cltd
+f0108bce:	f7 fb                	idiv   %ebx
+	for (i = rx_next; n < nrx - 1 && (rx_fifo[i].status & E1000_RXD_STAT_DD);
+f0108bd0:	39 cf                	cmp    %ecx,%edi
+f0108bd2:	75 e7                	jne    f0108bbb <rx_ready+0x25>
+		n++;
+f0108bd4:	89 f9                	mov    %edi,%ecx
+	return n;
+}
+f0108bd6:	89 c8                	mov    %ecx,%eax
+f0108bd8:	5b                   	pop    %ebx
+f0108bd9:	5e                   	pop    %esi
+f0108bda:	5f                   	pop    %edi
+f0108bdb:	5d                   	pop    %ebp
+f0108bdc:	c3                   	ret
+	int i, n = 0;
+f0108bdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108be2:	eb f2                	jmp    f0108bd6 <rx_ready+0x40>
+
+f0108be4 <rss_hash>:
+};
+
+// Toeplitz hash of a 12-byte tuple, the hash RSS cards compute.
+static uint32_t
+rss_hash(const uint8_t *tuple)
+{
+f0108be4:	55                   	push   %ebp
+f0108be5:	89 e5                	mov    %esp,%ebp
+f0108be7:	57                   	push   %edi
+f0108be8:	56                   	push   %esi
+f0108be9:	53                   	push   %ebx
+f0108bea:	83 ec 08             	sub    $0x8,%esp
+f0108bed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	uint32_t key, h = 0;
+	int i, b;
+
+	key = (rss_key[0] << 24) | (rss_key[1] << 16)
+		| (rss_key[2] << 8) | rss_key[3];
+	for (i = 0; i < 12; i++)
+f0108bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+	uint32_t key, h = 0;
+f0108bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+	key = (rss_key[0] << 24) | (rss_key[1] << 16)
+f0108bfa:	b8 da 56 5a 6d       	mov    $0x6d5a56da,%eax
+f0108bff:	eb 0b                	jmp    f0108c0c <rss_hash+0x28>
+	for (i = 0; i < 12; i++)
+f0108c01:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0108c04:	83 c7 01             	add    $0x1,%edi
+f0108c07:	83 ff 0c             	cmp    $0xc,%edi
+f0108c0a:	74 36                	je     f0108c42 <rss_hash+0x5e>
+		for (b = 7; b >= 0; b--) {
+			if (tuple[i] & (1 << b))
+f0108c0c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+f0108c0f:	0f b6 34 3b          	movzbl (%ebx,%edi,1),%esi
+				h ^= key;
+			key = (key << 1) | ((rss_key[i + 4] >> b) & 1);
+f0108c13:	0f b6 9f 44 cf 10 f0 	movzbl -0xfef30bc(%edi),%ebx
+		for (b = 7; b >= 0; b--) {
+f0108c1a:	b9 07 00 00 00       	mov    $0x7,%ecx
+f0108c1f:	89 7d f0             	mov    %edi,-0x10(%ebp)
+				h ^= key;
+f0108c22:	89 d7                	mov    %edx,%edi
+f0108c24:	31 c7                	xor    %eax,%edi
+f0108c26:	0f a3 ce             	bt     %ecx,%esi
+f0108c29:	0f 42 d7             	cmovb  %edi,%edx
+			key = (key << 1) | ((rss_key[i + 4] >> b) & 1);
+f0108c2c:	8d 3c 00             	lea    (%eax,%eax,1),%edi
+f0108c2f:	89 d8                	mov    %ebx,%eax
+f0108c31:	d3 f8                	sar    %cl,%eax
+f0108c33:	83 e0 01             	and    $0x1,%eax
+f0108c36:	09 f8                	or     %edi,%eax
+		for (b = 7; b >= 0; b--) {
+f0108c38:	83 e9 01             	sub    $0x1,%ecx
+f0108c3b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f0108c3e:	75 e2                	jne    f0108c22 <rss_hash+0x3e>
+f0108c40:	eb bf                	jmp    f0108c01 <rss_hash+0x1d>
+		}
+	return h;
+}
+f0108c42:	89 d0                	mov    %edx,%eax
+f0108c44:	83 c4 08             	add    $0x8,%esp
+f0108c47:	5b                   	pop    %ebx
+f0108c48:	5e                   	pop    %esi
+f0108c49:	5f                   	pop    %edi
+f0108c4a:	5d                   	pop    %ebp
+f0108c4b:	c3                   	ret
+
+f0108c4c <rxq_put>:
+		page_decref(pp);
+}
+
+static void
+rxq_put(int q, struct Page *pp)
+{
+f0108c4c:	55                   	push   %ebp
+f0108c4d:	89 e5                	mov    %esp,%ebp
+f0108c4f:	57                   	push   %edi
+f0108c50:	56                   	push   %esi
+f0108c51:	53                   	push   %ebx
+f0108c52:	89 d7                	mov    %edx,%edi
+	struct rx_queue *rq = &rx_queues[q];
+
+	rq->rq_pages[(rq->rq_head + rq->rq_n) % RXQ_SIZE] = pp;
+f0108c54:	69 c8 24 01 00 00    	imul   $0x124,%eax,%ecx
+f0108c5a:	8b 99 e4 e7 92 f0    	mov    -0xf6d181c(%ecx),%ebx
+f0108c60:	89 da                	mov    %ebx,%edx
+f0108c62:	03 91 e0 e7 92 f0    	add    -0xf6d1820(%ecx),%edx
+f0108c68:	89 d6                	mov    %edx,%esi
+f0108c6a:	c1 fe 1f             	sar    $0x1f,%esi
+f0108c6d:	c1 ee 1a             	shr    $0x1a,%esi
+f0108c70:	01 f2                	add    %esi,%edx
+f0108c72:	83 e2 3f             	and    $0x3f,%edx
+f0108c75:	29 f2                	sub    %esi,%edx
+f0108c77:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+f0108c7a:	8d 34 f0             	lea    (%eax,%esi,8),%esi
+f0108c7d:	01 f2                	add    %esi,%edx
+f0108c7f:	89 3c 95 e0 e6 92 f0 	mov    %edi,-0xf6d1920(,%edx,4)
+	rq->rq_n++;
+f0108c86:	83 c3 01             	add    $0x1,%ebx
+f0108c89:	89 99 e4 e7 92 f0    	mov    %ebx,-0xf6d181c(%ecx)
+	e1000_stats.ns_rxq_packets[q]++;
+f0108c8f:	83 04 85 88 10 97 f0 	addl   $0x1,-0xf68ef78(,%eax,4)
+f0108c96:	01 
+}
+f0108c97:	5b                   	pop    %ebx
+f0108c98:	5e                   	pop    %esi
+f0108c99:	5f                   	pop    %edi
+f0108c9a:	5d                   	pop    %ebp
+f0108c9b:	c3                   	ret
+
+f0108c9c <e1000_page>:
+}
+
+// Allocate a zeroed page for the driver, for good.
+static struct Page *
+e1000_page(void)
+{
+f0108c9c:	55                   	push   %ebp
+f0108c9d:	89 e5                	mov    %esp,%ebp
+f0108c9f:	83 ec 14             	sub    $0x14,%esp
+	struct Page *pp;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f0108ca2:	6a 01                	push   $0x1
+f0108ca4:	e8 e2 8b ff ff       	call   f010188b <page_alloc>
+f0108ca9:	83 c4 10             	add    $0x10,%esp
+f0108cac:	85 c0                	test   %eax,%eax
+f0108cae:	74 07                	je     f0108cb7 <e1000_page+0x1b>
+		panic("attach_e1000: out of memory");
+	pp->pp_ref++;
+f0108cb0:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return pp;
+}
+f0108cb5:	c9                   	leave
+f0108cb6:	c3                   	ret
+		panic("attach_e1000: out of memory");
+f0108cb7:	83 ec 04             	sub    $0x4,%esp
+f0108cba:	68 a4 ce 10 f0       	push   $0xf010cea4
+f0108cbf:	68 bb 01 00 00       	push   $0x1bb
+f0108cc4:	68 c0 ce 10 f0       	push   $0xf010cec0
+f0108cc9:	e8 72 73 ff ff       	call   f0100040 <_panic>
+
+f0108cce <rx_page_get>:
+	if (rx_nspare > 0)
+f0108cce:	a1 c0 e2 92 f0       	mov    0xf092e2c0,%eax
+f0108cd3:	85 c0                	test   %eax,%eax
+f0108cd5:	7e 10                	jle    f0108ce7 <rx_page_get+0x19>
+		return rx_spare[--rx_nspare];
+f0108cd7:	83 e8 01             	sub    $0x1,%eax
+f0108cda:	a3 c0 e2 92 f0       	mov    %eax,0xf092e2c0
+f0108cdf:	8b 04 85 e0 e2 92 f0 	mov    -0xf6d1d20(,%eax,4),%eax
+}
+f0108ce6:	c3                   	ret
+{
+f0108ce7:	55                   	push   %ebp
+f0108ce8:	89 e5                	mov    %esp,%ebp
+f0108cea:	83 ec 14             	sub    $0x14,%esp
+	if ((pp = page_alloc(ALLOC_ZERO)))
+f0108ced:	6a 01                	push   $0x1
+f0108cef:	e8 97 8b ff ff       	call   f010188b <page_alloc>
+f0108cf4:	83 c4 10             	add    $0x10,%esp
+f0108cf7:	85 c0                	test   %eax,%eax
+f0108cf9:	74 05                	je     f0108d00 <rx_page_get+0x32>
+		pp->pp_ref++;
+f0108cfb:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+}
+f0108d00:	c9                   	leave
+f0108d01:	c3                   	ret
+
+f0108d02 <frame_tuple>:
+	if (len < 14 + 20 || frame[12] != 0x08 || frame[13] != 0x00)
+f0108d02:	83 fa 21             	cmp    $0x21,%edx
+f0108d05:	0f 86 9a 00 00 00    	jbe    f0108da5 <frame_tuple+0xa3>
+{
+f0108d0b:	55                   	push   %ebp
+f0108d0c:	89 e5                	mov    %esp,%ebp
+f0108d0e:	57                   	push   %edi
+f0108d0f:	56                   	push   %esi
+f0108d10:	53                   	push   %ebx
+f0108d11:	83 ec 0c             	sub    $0xc,%esp
+f0108d14:	89 c3                	mov    %eax,%ebx
+f0108d16:	89 d0                	mov    %edx,%eax
+f0108d18:	89 cf                	mov    %ecx,%edi
+	if (len < 14 + 20 || frame[12] != 0x08 || frame[13] != 0x00)
+f0108d1a:	80 7b 0c 08          	cmpb   $0x8,0xc(%ebx)
+f0108d1e:	0f 85 89 00 00 00    	jne    f0108dad <frame_tuple+0xab>
+f0108d24:	80 7b 0d 00          	cmpb   $0x0,0xd(%ebx)
+f0108d28:	0f 85 86 00 00 00    	jne    f0108db4 <frame_tuple+0xb2>
+	if ((ip[9] != 6 && ip[9] != 17) || len < 14 + hlen + 4
+f0108d2e:	0f b6 4b 17          	movzbl 0x17(%ebx),%ecx
+f0108d32:	80 f9 06             	cmp    $0x6,%cl
+f0108d35:	74 14                	je     f0108d4b <frame_tuple+0x49>
+		return 0;
+f0108d37:	ba 00 00 00 00       	mov    $0x0,%edx
+	if ((ip[9] != 6 && ip[9] != 17) || len < 14 + hlen + 4
+f0108d3c:	80 f9 11             	cmp    $0x11,%cl
+f0108d3f:	74 0a                	je     f0108d4b <frame_tuple+0x49>
+}
+f0108d41:	89 d0                	mov    %edx,%eax
+f0108d43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108d46:	5b                   	pop    %ebx
+f0108d47:	5e                   	pop    %esi
+f0108d48:	5f                   	pop    %edi
+f0108d49:	5d                   	pop    %ebp
+f0108d4a:	c3                   	ret
+	hlen = (ip[0] & 0xf) * 4;
+f0108d4b:	0f b6 73 0e          	movzbl 0xe(%ebx),%esi
+f0108d4f:	83 e6 0f             	and    $0xf,%esi
+f0108d52:	c1 e6 02             	shl    $0x2,%esi
+	if ((ip[9] != 6 && ip[9] != 17) || len < 14 + hlen + 4
+f0108d55:	8d 4e 12             	lea    0x12(%esi),%ecx
+		return 0;
+f0108d58:	ba 00 00 00 00       	mov    $0x0,%edx
+	if ((ip[9] != 6 && ip[9] != 17) || len < 14 + hlen + 4
+f0108d5d:	39 c8                	cmp    %ecx,%eax
+f0108d5f:	72 e0                	jb     f0108d41 <frame_tuple+0x3f>
+	    || (((ip[6] << 8) | ip[7]) & 0x3fff))
+f0108d61:	0f b6 43 14          	movzbl 0x14(%ebx),%eax
+f0108d65:	c1 e0 08             	shl    $0x8,%eax
+f0108d68:	0f b6 53 15          	movzbl 0x15(%ebx),%edx
+f0108d6c:	09 d0                	or     %edx,%eax
+		return 0;
+f0108d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+	    || (((ip[6] << 8) | ip[7]) & 0x3fff))
+f0108d73:	a9 ff 3f 00 00       	test   $0x3fff,%eax
+f0108d78:	75 c7                	jne    f0108d41 <frame_tuple+0x3f>
+	memmove(tuple, ip + 12, 8);
+f0108d7a:	83 ec 04             	sub    $0x4,%esp
+f0108d7d:	6a 08                	push   $0x8
+f0108d7f:	8d 43 1a             	lea    0x1a(%ebx),%eax
+f0108d82:	50                   	push   %eax
+f0108d83:	57                   	push   %edi
+f0108d84:	e8 4a ef ff ff       	call   f0107cd3 <memmove>
+	memmove(tuple + 8, ip + hlen, 4);
+f0108d89:	83 c4 0c             	add    $0xc,%esp
+f0108d8c:	6a 04                	push   $0x4
+f0108d8e:	8d 44 33 0e          	lea    0xe(%ebx,%esi,1),%eax
+f0108d92:	50                   	push   %eax
+f0108d93:	83 c7 08             	add    $0x8,%edi
+f0108d96:	57                   	push   %edi
+f0108d97:	e8 37 ef ff ff       	call   f0107cd3 <memmove>
+	return ip[9];
+f0108d9c:	0f b6 53 17          	movzbl 0x17(%ebx),%edx
+f0108da0:	83 c4 10             	add    $0x10,%esp
+f0108da3:	eb 9c                	jmp    f0108d41 <frame_tuple+0x3f>
+		return -1;
+f0108da5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+f0108daa:	89 d0                	mov    %edx,%eax
+f0108dac:	c3                   	ret
+		return -1;
+f0108dad:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0108db2:	eb 8d                	jmp    f0108d41 <frame_tuple+0x3f>
+f0108db4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0108db9:	eb 86                	jmp    f0108d41 <frame_tuple+0x3f>
+
+f0108dbb <tx_reclaim>:
+{
+f0108dbb:	55                   	push   %ebp
+f0108dbc:	89 e5                	mov    %esp,%ebp
+f0108dbe:	57                   	push   %edi
+f0108dbf:	56                   	push   %esi
+f0108dc0:	53                   	push   %ebx
+f0108dc1:	83 ec 0c             	sub    $0xc,%esp
+	int tail = e100[E1000_TDT/sizeof(uint32_t)];
+f0108dc4:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0108dc9:	8b b0 18 38 00 00    	mov    0x3818(%eax),%esi
+	while (tx_clean != tail) {
+f0108dcf:	8b 1d a0 f0 92 f0    	mov    0xf092f0a0,%ebx
+f0108dd5:	39 de                	cmp    %ebx,%esi
+f0108dd7:	0f 85 98 00 00 00    	jne    f0108e75 <tx_reclaim+0xba>
+f0108ddd:	e9 bc 00 00 00       	jmp    f0108e9e <tx_reclaim+0xe3>
+		if (rs == tail || !(tx_fifo[rs].status & E1000_TXD_STAT_DD))
+f0108de2:	39 de                	cmp    %ebx,%esi
+f0108de4:	0f 84 b4 00 00 00    	je     f0108e9e <tx_reclaim+0xe3>
+f0108dea:	f6 40 0c 01          	testb  $0x1,0xc(%eax)
+f0108dee:	75 1e                	jne    f0108e0e <tx_reclaim+0x53>
+f0108df0:	e9 a9 00 00 00       	jmp    f0108e9e <tx_reclaim+0xe3>
+			if (tx_clean == rs)
+f0108df5:	a1 a0 f0 92 f0       	mov    0xf092f0a0,%eax
+f0108dfa:	39 d8                	cmp    %ebx,%eax
+f0108dfc:	74 5f                	je     f0108e5d <tx_reclaim+0xa2>
+			tx_clean = (tx_clean + 1) % ntx;
+f0108dfe:	83 c0 01             	add    $0x1,%eax
+f0108e01:	99                   	cltd
+f0108e02:	f7 3d 9c 10 97 f0    	idivl  0xf097109c
+f0108e08:	89 15 a0 f0 92 f0    	mov    %edx,0xf092f0a0
+			if (tx_pages[tx_clean]) {
+f0108e0e:	a1 a0 f0 92 f0       	mov    0xf092f0a0,%eax
+f0108e13:	8b 04 85 a0 ec 92 f0 	mov    -0xf6d1360(,%eax,4),%eax
+f0108e1a:	85 c0                	test   %eax,%eax
+f0108e1c:	74 d7                	je     f0108df5 <tx_reclaim+0x3a>
+				page_decref(tx_pages[tx_clean]);
+f0108e1e:	83 ec 0c             	sub    $0xc,%esp
+f0108e21:	50                   	push   %eax
+f0108e22:	e8 4e 88 ff ff       	call   f0101675 <page_decref>
+				tx_pages[tx_clean] = NULL;
+f0108e27:	8b 15 a0 f0 92 f0    	mov    0xf092f0a0,%edx
+f0108e2d:	c7 04 95 a0 ec 92 f0 	movl   $0x0,-0xf6d1360(,%edx,4)
+f0108e34:	00 00 00 00 
+				if (tx_fifo[tx_clean].cmd & E1000_TXD_CMD_EOP)
+f0108e38:	89 d0                	mov    %edx,%eax
+f0108e3a:	c1 e0 04             	shl    $0x4,%eax
+f0108e3d:	03 05 a0 14 97 f0    	add    0xf09714a0,%eax
+f0108e43:	83 c4 10             	add    $0x10,%esp
+f0108e46:	f6 40 0b 01          	testb  $0x1,0xb(%eax)
+f0108e4a:	74 a9                	je     f0108df5 <tx_reclaim+0x3a>
+					tx_sg_done[tx_sg_queue[tx_clean]]++;
+f0108e4c:	0f b6 82 a0 eb 92 f0 	movzbl -0xf6d1460(%edx),%eax
+f0108e53:	83 04 85 80 eb 92 f0 	addl   $0x1,-0xf6d1480(,%eax,4)
+f0108e5a:	01 
+f0108e5b:	eb 98                	jmp    f0108df5 <tx_reclaim+0x3a>
+		tx_clean = (rs + 1) % ntx;
+f0108e5d:	8d 43 01             	lea    0x1(%ebx),%eax
+f0108e60:	99                   	cltd
+f0108e61:	f7 3d 9c 10 97 f0    	idivl  0xf097109c
+f0108e67:	89 d3                	mov    %edx,%ebx
+f0108e69:	89 15 a0 f0 92 f0    	mov    %edx,0xf092f0a0
+	while (tx_clean != tail) {
+f0108e6f:	39 f2                	cmp    %esi,%edx
+f0108e71:	74 2b                	je     f0108e9e <tx_reclaim+0xe3>
+		for (rs = tx_clean; rs != tail; rs = (rs + 1) % ntx)
+f0108e73:	74 29                	je     f0108e9e <tx_reclaim+0xe3>
+			if (tx_fifo[rs].cmd & E1000_TXD_CMD_RS)
+f0108e75:	8b 3d a0 14 97 f0    	mov    0xf09714a0,%edi
+		for (rs = tx_clean; rs != tail; rs = (rs + 1) % ntx)
+f0108e7b:	8b 0d 9c 10 97 f0    	mov    0xf097109c,%ecx
+			if (tx_fifo[rs].cmd & E1000_TXD_CMD_RS)
+f0108e81:	89 d8                	mov    %ebx,%eax
+f0108e83:	c1 e0 04             	shl    $0x4,%eax
+f0108e86:	01 f8                	add    %edi,%eax
+f0108e88:	f6 40 0b 08          	testb  $0x8,0xb(%eax)
+f0108e8c:	0f 85 50 ff ff ff    	jne    f0108de2 <tx_reclaim+0x27>
+		for (rs = tx_clean; rs != tail; rs = (rs + 1) % ntx)
+f0108e92:	8d 43 01             	lea    0x1(%ebx),%eax
+f0108e95:	99                   	cltd
+f0108e96:	f7 f9                	idiv   %ecx
+f0108e98:	89 d3                	mov    %edx,%ebx
+f0108e9a:	39 d6                	cmp    %edx,%esi
+f0108e9c:	75 e3                	jne    f0108e81 <tx_reclaim+0xc6>
+}
+f0108e9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108ea1:	5b                   	pop    %ebx
+f0108ea2:	5e                   	pop    %esi
+f0108ea3:	5f                   	pop    %edi
+f0108ea4:	5d                   	pop    %ebp
+f0108ea5:	c3                   	ret
+
+f0108ea6 <rx_page_put>:
+	if (rx_nspare < RING_MAX)
+f0108ea6:	8b 15 c0 e2 92 f0    	mov    0xf092e2c0,%edx
+f0108eac:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+f0108eb2:	7f 11                	jg     f0108ec5 <rx_page_put+0x1f>
+		rx_spare[rx_nspare++] = pp;
+f0108eb4:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0108eb7:	89 0d c0 e2 92 f0    	mov    %ecx,0xf092e2c0
+f0108ebd:	89 04 95 e0 e2 92 f0 	mov    %eax,-0xf6d1d20(,%edx,4)
+f0108ec4:	c3                   	ret
+{
+f0108ec5:	55                   	push   %ebp
+f0108ec6:	89 e5                	mov    %esp,%ebp
+f0108ec8:	83 ec 14             	sub    $0x14,%esp
+		page_decref(pp);
+f0108ecb:	50                   	push   %eax
+f0108ecc:	e8 a4 87 ff ff       	call   f0101675 <page_decref>
+f0108ed1:	83 c4 10             	add    $0x10,%esp
+}
+f0108ed4:	c9                   	leave
+f0108ed5:	c3                   	ret
+
+f0108ed6 <flow_lookup>:
+{
+f0108ed6:	55                   	push   %ebp
+f0108ed7:	89 e5                	mov    %esp,%ebp
+f0108ed9:	57                   	push   %edi
+f0108eda:	56                   	push   %esi
+f0108edb:	53                   	push   %ebx
+f0108edc:	83 ec 1c             	sub    $0x1c,%esp
+f0108edf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	struct rx_flow *f = rx_flows[h % FLOW_SETS];
+f0108ee2:	83 e2 3f             	and    $0x3f,%edx
+f0108ee5:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f0108ee8:	c1 e0 04             	shl    $0x4,%eax
+f0108eeb:	8d 98 c0 ce 92 f0    	lea    -0xf6d3140(%eax),%ebx
+f0108ef1:	8d b8 10 cf 92 f0    	lea    -0xf6d30f0(%eax),%edi
+f0108ef7:	eb 07                	jmp    f0108f00 <flow_lookup+0x2a>
+	for (i = 0; i < FLOW_WAYS; i++)
+f0108ef9:	83 c3 14             	add    $0x14,%ebx
+f0108efc:	39 fb                	cmp    %edi,%ebx
+f0108efe:	74 1f                	je     f0108f1f <flow_lookup+0x49>
+		if (f[i].rf_used && memcmp(f[i].rf_tuple, tuple, 12) == 0)
+f0108f00:	89 de                	mov    %ebx,%esi
+f0108f02:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+f0108f06:	74 f1                	je     f0108ef9 <flow_lookup+0x23>
+f0108f08:	83 ec 04             	sub    $0x4,%esp
+f0108f0b:	6a 0c                	push   $0xc
+f0108f0d:	ff 75 e4             	push   -0x1c(%ebp)
+f0108f10:	53                   	push   %ebx
+f0108f11:	e8 35 ee ff ff       	call   f0107d4b <memcmp>
+f0108f16:	83 c4 10             	add    $0x10,%esp
+f0108f19:	85 c0                	test   %eax,%eax
+f0108f1b:	75 dc                	jne    f0108ef9 <flow_lookup+0x23>
+f0108f1d:	eb 05                	jmp    f0108f24 <flow_lookup+0x4e>
+	return NULL;
+f0108f1f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0108f24:	89 f0                	mov    %esi,%eax
+f0108f26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108f29:	5b                   	pop    %ebx
+f0108f2a:	5e                   	pop    %esi
+f0108f2b:	5f                   	pop    %edi
+f0108f2c:	5d                   	pop    %ebp
+f0108f2d:	c3                   	ret
+
+f0108f2e <tx_learn>:
+	if (e1000_nq == 1 || frame_tuple(frame, len, out) <= 0)
+f0108f2e:	83 3d d4 87 11 f0 01 	cmpl   $0x1,0xf01187d4
+f0108f35:	0f 84 de 00 00 00    	je     f0109019 <tx_learn+0xeb>
+{
+f0108f3b:	55                   	push   %ebp
+f0108f3c:	89 e5                	mov    %esp,%ebp
+f0108f3e:	57                   	push   %edi
+f0108f3f:	56                   	push   %esi
+f0108f40:	53                   	push   %ebx
+f0108f41:	83 ec 2c             	sub    $0x2c,%esp
+f0108f44:	89 c3                	mov    %eax,%ebx
+f0108f46:	89 d0                	mov    %edx,%eax
+f0108f48:	89 ca                	mov    %ecx,%edx
+	if (e1000_nq == 1 || frame_tuple(frame, len, out) <= 0)
+f0108f4a:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+f0108f4d:	e8 b0 fd ff ff       	call   f0108d02 <frame_tuple>
+f0108f52:	85 c0                	test   %eax,%eax
+f0108f54:	7e 76                	jle    f0108fcc <tx_learn+0x9e>
+	memmove(tuple, out + 4, 4);
+f0108f56:	83 ec 04             	sub    $0x4,%esp
+f0108f59:	6a 04                	push   $0x4
+f0108f5b:	8d 7d dc             	lea    -0x24(%ebp),%edi
+f0108f5e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0108f61:	50                   	push   %eax
+f0108f62:	8d 75 d0             	lea    -0x30(%ebp),%esi
+f0108f65:	56                   	push   %esi
+f0108f66:	e8 68 ed ff ff       	call   f0107cd3 <memmove>
+	memmove(tuple + 4, out, 4);
+f0108f6b:	83 c4 0c             	add    $0xc,%esp
+f0108f6e:	6a 04                	push   $0x4
+f0108f70:	57                   	push   %edi
+f0108f71:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+f0108f74:	50                   	push   %eax
+f0108f75:	e8 59 ed ff ff       	call   f0107cd3 <memmove>
+	memmove(tuple + 8, out + 10, 2);
+f0108f7a:	83 c4 0c             	add    $0xc,%esp
+f0108f7d:	6a 02                	push   $0x2
+f0108f7f:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+f0108f82:	50                   	push   %eax
+f0108f83:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0108f86:	50                   	push   %eax
+f0108f87:	e8 47 ed ff ff       	call   f0107cd3 <memmove>
+	memmove(tuple + 10, out + 8, 2);
+f0108f8c:	83 c4 0c             	add    $0xc,%esp
+f0108f8f:	6a 02                	push   $0x2
+f0108f91:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108f94:	50                   	push   %eax
+f0108f95:	8d 45 da             	lea    -0x26(%ebp),%eax
+f0108f98:	50                   	push   %eax
+f0108f99:	e8 35 ed ff ff       	call   f0107cd3 <memmove>
+	h = rss_hash(tuple);
+f0108f9e:	89 f0                	mov    %esi,%eax
+f0108fa0:	e8 3f fc ff ff       	call   f0108be4 <rss_hash>
+f0108fa5:	89 c7                	mov    %eax,%edi
+	if (!(f = flow_lookup(tuple, h))) {
+f0108fa7:	89 c2                	mov    %eax,%edx
+f0108fa9:	89 f0                	mov    %esi,%eax
+f0108fab:	e8 26 ff ff ff       	call   f0108ed6 <flow_lookup>
+f0108fb0:	89 c6                	mov    %eax,%esi
+f0108fb2:	83 c4 10             	add    $0x10,%esp
+f0108fb5:	85 c0                	test   %eax,%eax
+f0108fb7:	74 1b                	je     f0108fd4 <tx_learn+0xa6>
+	f->rf_queue = q;
+f0108fb9:	88 5e 0c             	mov    %bl,0xc(%esi)
+	f->rf_used = ++rx_flow_clock;
+f0108fbc:	a1 a0 ce 92 f0       	mov    0xf092cea0,%eax
+f0108fc1:	83 c0 01             	add    $0x1,%eax
+f0108fc4:	a3 a0 ce 92 f0       	mov    %eax,0xf092cea0
+f0108fc9:	89 46 10             	mov    %eax,0x10(%esi)
+}
+f0108fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108fcf:	5b                   	pop    %ebx
+f0108fd0:	5e                   	pop    %esi
+f0108fd1:	5f                   	pop    %edi
+f0108fd2:	5d                   	pop    %ebp
+f0108fd3:	c3                   	ret
+		set = rx_flows[h % FLOW_SETS];
+f0108fd4:	83 e7 3f             	and    $0x3f,%edi
+f0108fd7:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+f0108fda:	c1 e0 04             	shl    $0x4,%eax
+f0108fdd:	05 c0 ce 92 f0       	add    $0xf092cec0,%eax
+		for (f = set, i = 1; i < FLOW_WAYS; i++)
+f0108fe2:	89 c6                	mov    %eax,%esi
+			if (set[i].rf_used < f->rf_used)
+f0108fe4:	8b 78 10             	mov    0x10(%eax),%edi
+f0108fe7:	39 78 24             	cmp    %edi,0x24(%eax)
+f0108fea:	73 03                	jae    f0108fef <tx_learn+0xc1>
+f0108fec:	8d 70 14             	lea    0x14(%eax),%esi
+f0108fef:	8b 7e 10             	mov    0x10(%esi),%edi
+f0108ff2:	39 78 38             	cmp    %edi,0x38(%eax)
+f0108ff5:	73 03                	jae    f0108ffa <tx_learn+0xcc>
+f0108ff7:	8d 70 28             	lea    0x28(%eax),%esi
+f0108ffa:	8b 7e 10             	mov    0x10(%esi),%edi
+f0108ffd:	39 78 4c             	cmp    %edi,0x4c(%eax)
+f0109000:	73 03                	jae    f0109005 <tx_learn+0xd7>
+f0109002:	8d 70 3c             	lea    0x3c(%eax),%esi
+		memmove(f->rf_tuple, tuple, 12);
+f0109005:	83 ec 04             	sub    $0x4,%esp
+f0109008:	6a 0c                	push   $0xc
+f010900a:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f010900d:	50                   	push   %eax
+f010900e:	56                   	push   %esi
+f010900f:	e8 bf ec ff ff       	call   f0107cd3 <memmove>
+f0109014:	83 c4 10             	add    $0x10,%esp
+f0109017:	eb a0                	jmp    f0108fb9 <tx_learn+0x8b>
+f0109019:	c3                   	ret
+
+f010901a <tx_buffer>:
+	return page2kva(tx_bufs[i / 2]) + (i % 2) * BUFFER_SIZE;
+f010901a:	89 c2                	mov    %eax,%edx
+f010901c:	c1 ea 1f             	shr    $0x1f,%edx
+f010901f:	01 c2                	add    %eax,%edx
+f0109021:	d1 fa                	sar    %edx
+	return (pp - pages) << PGSHIFT;
+f0109023:	8b 0c 95 c0 f0 92 f0 	mov    -0xf6d0f40(,%edx,4),%ecx
+f010902a:	2b 0d f4 f3 92 f0    	sub    0xf092f3f4,%ecx
+f0109030:	c1 f9 04             	sar    $0x4,%ecx
+f0109033:	89 ca                	mov    %ecx,%edx
+f0109035:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109038:	81 e1 ff ff 0f 00    	and    $0xfffff,%ecx
+f010903e:	3b 0d ec f3 92 f0    	cmp    0xf092f3ec,%ecx
+f0109044:	73 17                	jae    f010905d <tx_buffer+0x43>
+f0109046:	89 c1                	mov    %eax,%ecx
+f0109048:	c1 e9 1f             	shr    $0x1f,%ecx
+f010904b:	01 c8                	add    %ecx,%eax
+f010904d:	83 e0 01             	and    $0x1,%eax
+f0109050:	29 c8                	sub    %ecx,%eax
+f0109052:	c1 e0 0b             	shl    $0xb,%eax
+f0109055:	8d 84 02 00 00 00 f0 	lea    -0x10000000(%edx,%eax,1),%eax
+}
+f010905c:	c3                   	ret
+{
+f010905d:	55                   	push   %ebp
+f010905e:	89 e5                	mov    %esp,%ebp
+f0109060:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109063:	52                   	push   %edx
+f0109064:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0109069:	6a 6e                	push   $0x6e
+f010906b:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0109070:	e8 cb 6f ff ff       	call   f0100040 <_panic>
+
+f0109075 <rx_steer>:
+{
+f0109075:	55                   	push   %ebp
+f0109076:	89 e5                	mov    %esp,%ebp
+f0109078:	57                   	push   %edi
+f0109079:	56                   	push   %esi
+f010907a:	53                   	push   %ebx
+f010907b:	83 ec 4c             	sub    $0x4c,%esp
+	int tail = rx_next, q, len;
+f010907e:	a1 a4 f0 92 f0       	mov    0xf092f0a4,%eax
+f0109083:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	while ((d = &rx_fifo[tail])->status & E1000_RXD_STAT_DD) {
+f0109086:	c1 e0 04             	shl    $0x4,%eax
+f0109089:	03 05 20 10 97 f0    	add    0xf0971020,%eax
+f010908f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f0109092:	f6 40 0c 01          	testb  $0x1,0xc(%eax)
+f0109096:	0f 85 f3 02 00 00    	jne    f010938f <rx_steer+0x31a>
+f010909c:	e9 9e 02 00 00       	jmp    f010933f <rx_steer+0x2ca>
+f01090a1:	51                   	push   %ecx
+f01090a2:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01090a7:	6a 6e                	push   $0x6e
+f01090a9:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01090ae:	e8 8d 6f ff ff       	call   f0100040 <_panic>
+f01090b3:	50                   	push   %eax
+f01090b4:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01090b9:	6a 6e                	push   $0x6e
+f01090bb:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01090c0:	e8 7b 6f ff ff       	call   f0100040 <_panic>
+	if (d->errors & (E1000_RXD_ERR_IPE | E1000_RXD_ERR_TCPE))
+f01090c5:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f01090c8:	f6 43 0d 60          	testb  $0x60,0xd(%ebx)
+f01090cc:	74 76                	je     f0109144 <rx_steer+0xcf>
+		e1000_stats.ns_rx_csum_bad++;
+f01090ce:	83 05 80 10 97 f0 01 	addl   $0x1,0xf0971080
+		((int *) page2kva(pp))[1] = rx_csum_flags(d);
+f01090d5:	89 48 04             	mov    %ecx,0x4(%eax)
+		e1000_stats.ns_rx_packets++;
+f01090d8:	83 05 40 10 97 f0 01 	addl   $0x1,0xf0971040
+		e1000_stats.ns_rx_bytes += len;
+f01090df:	0f b7 d2             	movzwl %dx,%edx
+f01090e2:	01 15 44 10 97 f0    	add    %edx,0xf0971044
+	if (e1000_nq == 1)
+f01090e8:	83 3d d4 87 11 f0 01 	cmpl   $0x1,0xf01187d4
+f01090ef:	0f 84 52 02 00 00    	je     f0109347 <rx_steer+0x2d2>
+		q = rx_classify(page2kva(pp) + RX_PKT_OFFSET, len);
+f01090f5:	83 c0 08             	add    $0x8,%eax
+	if ((proto = frame_tuple(frame, len, tuple)) < 0)
+f01090f8:	8d 4d cc             	lea    -0x34(%ebp),%ecx
+f01090fb:	e8 02 fc ff ff       	call   f0108d02 <frame_tuple>
+f0109100:	89 c3                	mov    %eax,%ebx
+f0109102:	85 c0                	test   %eax,%eax
+f0109104:	0f 88 d5 00 00 00    	js     f01091df <rx_steer+0x16a>
+	if (proto == 0)
+f010910a:	0f 84 3c 02 00 00    	je     f010934c <rx_steer+0x2d7>
+	h = rss_hash(tuple);
+f0109110:	8d 45 cc             	lea    -0x34(%ebp),%eax
+f0109113:	e8 cc fa ff ff       	call   f0108be4 <rss_hash>
+f0109118:	89 45 b8             	mov    %eax,-0x48(%ebp)
+	if ((f = flow_lookup(tuple, h))) {
+f010911b:	89 c2                	mov    %eax,%edx
+f010911d:	8d 45 cc             	lea    -0x34(%ebp),%eax
+f0109120:	e8 b1 fd ff ff       	call   f0108ed6 <flow_lookup>
+f0109125:	85 c0                	test   %eax,%eax
+f0109127:	74 24                	je     f010914d <rx_steer+0xd8>
+		f->rf_used = ++rx_flow_clock;
+f0109129:	8b 1d a0 ce 92 f0    	mov    0xf092cea0,%ebx
+f010912f:	8d 53 01             	lea    0x1(%ebx),%edx
+f0109132:	89 15 a0 ce 92 f0    	mov    %edx,0xf092cea0
+f0109138:	89 50 10             	mov    %edx,0x10(%eax)
+		return f->rf_queue;
+f010913b:	0f b6 58 0c          	movzbl 0xc(%eax),%ebx
+f010913f:	e9 08 02 00 00       	jmp    f010934c <rx_steer+0x2d7>
+	else if (flags)
+f0109144:	85 c9                	test   %ecx,%ecx
+f0109146:	74 8d                	je     f01090d5 <rx_steer+0x60>
+f0109148:	e9 f9 02 00 00       	jmp    f0109446 <rx_steer+0x3d1>
+	if (proto != 6)
+f010914d:	83 fb 06             	cmp    $0x6,%ebx
+f0109150:	0f 85 fc 02 00 00    	jne    f0109452 <rx_steer+0x3dd>
+	port = (tuple[10] << 8) | tuple[11];
+f0109156:	0f b6 45 d6          	movzbl -0x2a(%ebp),%eax
+f010915a:	c1 e0 08             	shl    $0x8,%eax
+f010915d:	0f b6 4d d7          	movzbl -0x29(%ebp),%ecx
+f0109161:	09 c1                	or     %eax,%ecx
+	for (q = n = 0; q < e1000_nq; q++)
+f0109163:	a1 d4 87 11 f0       	mov    0xf01187d4,%eax
+f0109168:	ba 00 00 00 00       	mov    $0x0,%edx
+f010916d:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0109172:	be 00 00 00 00       	mov    $0x0,%esi
+f0109177:	85 c0                	test   %eax,%eax
+f0109179:	0f 8e cd 01 00 00    	jle    f010934c <rx_steer+0x2d7>
+f010917f:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+f0109182:	89 c7                	mov    %eax,%edi
+f0109184:	eb 30                	jmp    f01091b6 <rx_steer+0x141>
+	for (i = 0; i < RXQ_LPORTS; i++)
+f0109186:	83 c0 01             	add    $0x1,%eax
+f0109189:	83 f8 08             	cmp    $0x8,%eax
+f010918c:	74 1b                	je     f01091a9 <rx_steer+0x134>
+		if (rx_queues[q].rq_lref[i] && rx_queues[q].rq_lport[i] == port)
+f010918e:	80 bc 02 fc e7 92 f0 	cmpb   $0x0,-0xf6d1804(%edx,%eax,1)
+f0109195:	00 
+f0109196:	74 ee                	je     f0109186 <rx_steer+0x111>
+f0109198:	66 3b 8c 42 ec e7 92 	cmp    -0xf6d1814(%edx,%eax,2),%cx
+f010919f:	f0 
+f01091a0:	75 e4                	jne    f0109186 <rx_steer+0x111>
+			cand[n++] = q;
+f01091a2:	89 74 9d d8          	mov    %esi,-0x28(%ebp,%ebx,4)
+f01091a6:	8d 5b 01             	lea    0x1(%ebx),%ebx
+	for (q = n = 0; q < e1000_nq; q++)
+f01091a9:	83 c6 01             	add    $0x1,%esi
+f01091ac:	81 c2 24 01 00 00    	add    $0x124,%edx
+f01091b2:	39 f7                	cmp    %esi,%edi
+f01091b4:	74 07                	je     f01091bd <rx_steer+0x148>
+	for (i = 0; i < RXQ_LPORTS; i++)
+f01091b6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01091bb:	eb d1                	jmp    f010918e <rx_steer+0x119>
+	return n ? cand[h % n] : 0;
+f01091bd:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+f01091c0:	85 db                	test   %ebx,%ebx
+f01091c2:	0f 84 84 01 00 00    	je     f010934c <rx_steer+0x2d7>
+f01091c8:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f01091cb:	ba 00 00 00 00       	mov    $0x0,%edx
+f01091d0:	f7 f3                	div    %ebx
+f01091d2:	8b 5c 95 d8          	mov    -0x28(%ebp,%edx,4),%ebx
+		if (q == RXQ_ALL) {
+f01091d6:	83 fb ff             	cmp    $0xffffffff,%ebx
+f01091d9:	0f 85 6d 01 00 00    	jne    f010934c <rx_steer+0x2d7>
+	for (q = 1; q < e1000_nq; q++) {
+f01091df:	83 3d d4 87 11 f0 01 	cmpl   $0x1,0xf01187d4
+f01091e6:	0f 8e ed 00 00 00    	jle    f01092d9 <rx_steer+0x264>
+f01091ec:	ba e0 e6 92 f0       	mov    $0xf092e6e0,%edx
+f01091f1:	bb 01 00 00 00       	mov    $0x1,%ebx
+		memmove(page2kva(cp), page2kva(pp), RX_PKT_OFFSET + len);
+f01091f6:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f01091f9:	83 c0 08             	add    $0x8,%eax
+f01091fc:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+f01091ff:	89 7d bc             	mov    %edi,-0x44(%ebp)
+f0109202:	89 d7                	mov    %edx,%edi
+f0109204:	eb 1c                	jmp    f0109222 <rx_steer+0x1ad>
+			e1000_stats.ns_rxq_drops++;
+f0109206:	83 05 98 10 97 f0 01 	addl   $0x1,0xf0971098
+	for (q = 1; q < e1000_nq; q++) {
+f010920d:	83 c3 01             	add    $0x1,%ebx
+f0109210:	81 c7 24 01 00 00    	add    $0x124,%edi
+f0109216:	3b 1d d4 87 11 f0    	cmp    0xf01187d4,%ebx
+f010921c:	0f 8d ad 00 00 00    	jge    f01092cf <rx_steer+0x25a>
+		if (rx_queues[q].rq_n == RXQ_SIZE || !(cp = rx_page_get())) {
+f0109222:	83 bf 28 02 00 00 40 	cmpl   $0x40,0x228(%edi)
+f0109229:	74 db                	je     f0109206 <rx_steer+0x191>
+f010922b:	e8 9e fa ff ff       	call   f0108cce <rx_page_get>
+f0109230:	89 c6                	mov    %eax,%esi
+f0109232:	85 c0                	test   %eax,%eax
+f0109234:	74 d0                	je     f0109206 <rx_steer+0x191>
+	return (pp - pages) << PGSHIFT;
+f0109236:	8b 15 f4 f3 92 f0    	mov    0xf092f3f4,%edx
+f010923c:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f010923f:	29 d0                	sub    %edx,%eax
+f0109241:	c1 f8 04             	sar    $0x4,%eax
+f0109244:	89 c1                	mov    %eax,%ecx
+f0109246:	c1 e1 0c             	shl    $0xc,%ecx
+f0109249:	89 4d b8             	mov    %ecx,-0x48(%ebp)
+	if (PGNUM(pa) >= npages)
+f010924c:	8b 0d ec f3 92 f0    	mov    0xf092f3ec,%ecx
+f0109252:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109257:	39 c8                	cmp    %ecx,%eax
+f0109259:	73 4d                	jae    f01092a8 <rx_steer+0x233>
+	return (void *)(pa + KERNBASE);
+f010925b:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f010925e:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0109263:	89 45 b8             	mov    %eax,-0x48(%ebp)
+	return (pp - pages) << PGSHIFT;
+f0109266:	89 f0                	mov    %esi,%eax
+f0109268:	29 d0                	sub    %edx,%eax
+f010926a:	c1 f8 04             	sar    $0x4,%eax
+f010926d:	89 c2                	mov    %eax,%edx
+f010926f:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109272:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109277:	39 c8                	cmp    %ecx,%eax
+f0109279:	73 42                	jae    f01092bd <rx_steer+0x248>
+		memmove(page2kva(cp), page2kva(pp), RX_PKT_OFFSET + len);
+f010927b:	83 ec 04             	sub    $0x4,%esp
+f010927e:	ff 75 b4             	push   -0x4c(%ebp)
+f0109281:	ff 75 b8             	push   -0x48(%ebp)
+	return (void *)(pa + KERNBASE);
+f0109284:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f010928a:	52                   	push   %edx
+f010928b:	e8 43 ea ff ff       	call   f0107cd3 <memmove>
+		e1000_stats.ns_rx_copies++;
+f0109290:	83 05 48 10 97 f0 01 	addl   $0x1,0xf0971048
+		rxq_put(q, cp);
+f0109297:	89 f2                	mov    %esi,%edx
+f0109299:	89 d8                	mov    %ebx,%eax
+f010929b:	e8 ac f9 ff ff       	call   f0108c4c <rxq_put>
+f01092a0:	83 c4 10             	add    $0x10,%esp
+f01092a3:	e9 65 ff ff ff       	jmp    f010920d <rx_steer+0x198>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01092a8:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+f01092ab:	51                   	push   %ecx
+f01092ac:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01092b1:	6a 6e                	push   $0x6e
+f01092b3:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01092b8:	e8 83 6d ff ff       	call   f0100040 <_panic>
+f01092bd:	52                   	push   %edx
+f01092be:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01092c3:	6a 6e                	push   $0x6e
+f01092c5:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01092ca:	e8 71 6d ff ff       	call   f0100040 <_panic>
+			q = 0;
+f01092cf:	8b 7d bc             	mov    -0x44(%ebp),%edi
+f01092d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01092d7:	eb 73                	jmp    f010934c <rx_steer+0x2d7>
+f01092d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01092de:	eb 6c                	jmp    f010934c <rx_steer+0x2d7>
+		if (rx_queues[q].rq_n < RXQ_SIZE && (np = rx_page_get())) {
+f01092e0:	e8 e9 f9 ff ff       	call   f0108cce <rx_page_get>
+f01092e5:	89 c6                	mov    %eax,%esi
+f01092e7:	85 c0                	test   %eax,%eax
+f01092e9:	74 70                	je     f010935b <rx_steer+0x2e6>
+			rxq_put(q, pp);
+f01092eb:	89 fa                	mov    %edi,%edx
+f01092ed:	89 d8                	mov    %ebx,%eax
+f01092ef:	e8 58 f9 ff ff       	call   f0108c4c <rxq_put>
+			rx_pages[tail] = np;
+f01092f4:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f01092f7:	89 34 85 a0 10 97 f0 	mov    %esi,-0xf68ef60(,%eax,4)
+	return (pp - pages) << PGSHIFT;
+f01092fe:	89 f0                	mov    %esi,%eax
+f0109300:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0109306:	c1 f8 04             	sar    $0x4,%eax
+f0109309:	c1 e0 0c             	shl    $0xc,%eax
+			d->addr = page2pa(np) + RX_PKT_OFFSET;
+f010930c:	83 c0 08             	add    $0x8,%eax
+f010930f:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f0109312:	89 07                	mov    %eax,(%edi)
+f0109314:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+f010931b:	eb 45                	jmp    f0109362 <rx_steer+0x2ed>
+	if (tail != rx_next) {
+f010931d:	89 d1                	mov    %edx,%ecx
+f010931f:	39 15 a4 f0 92 f0    	cmp    %edx,0xf092f0a4
+f0109325:	74 18                	je     f010933f <rx_steer+0x2ca>
+		e100[E1000_RDT/sizeof(uint32_t)] = (tail - 1 + nrx) % nrx;
+f0109327:	8d 44 13 ff          	lea    -0x1(%ebx,%edx,1),%eax
+f010932b:	99                   	cltd
+f010932c:	f7 fb                	idiv   %ebx
+f010932e:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0109333:	89 90 18 28 00 00    	mov    %edx,0x2818(%eax)
+		rx_next = tail;
+f0109339:	89 0d a4 f0 92 f0    	mov    %ecx,0xf092f0a4
+}
+f010933f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109342:	5b                   	pop    %ebx
+f0109343:	5e                   	pop    %esi
+f0109344:	5f                   	pop    %edi
+f0109345:	5d                   	pop    %ebp
+f0109346:	c3                   	ret
+		return 0;
+f0109347:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (rx_queues[q].rq_n < RXQ_SIZE && (np = rx_page_get())) {
+f010934c:	69 c3 24 01 00 00    	imul   $0x124,%ebx,%eax
+f0109352:	83 b8 e4 e7 92 f0 3f 	cmpl   $0x3f,-0xf6d181c(%eax)
+f0109359:	7e 85                	jle    f01092e0 <rx_steer+0x26b>
+			e1000_stats.ns_rxq_drops++;
+f010935b:	83 05 98 10 97 f0 01 	addl   $0x1,0xf0971098
+		d->status = 0;
+f0109362:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0109365:	c6 40 0c 00          	movb   $0x0,0xc(%eax)
+		tail = (tail + 1) % nrx;
+f0109369:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f010936c:	83 c0 01             	add    $0x1,%eax
+f010936f:	8b 1d 24 10 97 f0    	mov    0xf0971024,%ebx
+f0109375:	99                   	cltd
+f0109376:	f7 fb                	idiv   %ebx
+f0109378:	89 55 c0             	mov    %edx,-0x40(%ebp)
+	while ((d = &rx_fifo[tail])->status & E1000_RXD_STAT_DD) {
+f010937b:	89 d6                	mov    %edx,%esi
+f010937d:	c1 e6 04             	shl    $0x4,%esi
+f0109380:	03 35 20 10 97 f0    	add    0xf0971020,%esi
+f0109386:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+f0109389:	f6 46 0c 01          	testb  $0x1,0xc(%esi)
+f010938d:	74 8e                	je     f010931d <rx_steer+0x2a8>
+		pp = rx_pages[tail];
+f010938f:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0109392:	8b 3c 85 a0 10 97 f0 	mov    -0xf68ef60(,%eax,4),%edi
+		len = d->length;
+f0109399:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010939c:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+f01093a0:	0f b7 c2             	movzwl %dx,%eax
+f01093a3:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f01093a6:	89 f8                	mov    %edi,%eax
+f01093a8:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01093ae:	c1 f8 04             	sar    $0x4,%eax
+f01093b1:	89 c1                	mov    %eax,%ecx
+f01093b3:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01093b6:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01093bb:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f01093c1:	0f 83 da fc ff ff    	jae    f01090a1 <rx_steer+0x2c>
+		((int *) page2kva(pp))[0] = len;
+f01093c7:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f01093ca:	89 81 00 00 00 f0    	mov    %eax,-0x10000000(%ecx)
+	return (pp - pages) << PGSHIFT;
+f01093d0:	89 f9                	mov    %edi,%ecx
+f01093d2:	2b 0d f4 f3 92 f0    	sub    0xf092f3f4,%ecx
+f01093d8:	c1 f9 04             	sar    $0x4,%ecx
+f01093db:	89 c8                	mov    %ecx,%eax
+f01093dd:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f01093e0:	81 e1 ff ff 0f 00    	and    $0xfffff,%ecx
+f01093e6:	3b 0d ec f3 92 f0    	cmp    0xf092f3ec,%ecx
+f01093ec:	0f 83 c1 fc ff ff    	jae    f01090b3 <rx_steer+0x3e>
+	return (void *)(pa + KERNBASE);
+f01093f2:	2d 00 00 00 10       	sub    $0x10000000,%eax
+	if (d->status & E1000_RXD_STAT_IXSM)
+f01093f7:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f01093fa:	0f b6 5e 0c          	movzbl 0xc(%esi),%ebx
+		return 0;
+f01093fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (d->status & E1000_RXD_STAT_IXSM)
+f0109403:	f6 c3 04             	test   $0x4,%bl
+f0109406:	0f 85 c9 fc ff ff    	jne    f01090d5 <rx_steer+0x60>
+	if ((d->status & E1000_RXD_STAT_IPCS) && !(d->errors & E1000_RXD_ERR_IPE))
+f010940c:	f6 c3 40             	test   $0x40,%bl
+f010940f:	74 10                	je     f0109421 <rx_steer+0x3ac>
+f0109411:	0f b6 4e 0d          	movzbl 0xd(%esi),%ecx
+f0109415:	88 4d b8             	mov    %cl,-0x48(%ebp)
+f0109418:	c0 e9 06             	shr    $0x6,%cl
+f010941b:	83 f1 01             	xor    $0x1,%ecx
+f010941e:	83 e1 01             	and    $0x1,%ecx
+	if ((d->status & E1000_RXD_STAT_TCPCS) && !(d->errors & E1000_RXD_ERR_TCPE))
+f0109421:	f6 c3 20             	test   $0x20,%bl
+f0109424:	0f 84 9b fc ff ff    	je     f01090c5 <rx_steer+0x50>
+f010942a:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f010942d:	0f b6 5b 0d          	movzbl 0xd(%ebx),%ebx
+f0109431:	f6 c3 20             	test   $0x20,%bl
+f0109434:	0f 85 8b fc ff ff    	jne    f01090c5 <rx_steer+0x50>
+		flags |= JP_CSUM_L4;
+f010943a:	83 c9 02             	or     $0x2,%ecx
+	if (d->errors & (E1000_RXD_ERR_IPE | E1000_RXD_ERR_TCPE))
+f010943d:	f6 c3 60             	test   $0x60,%bl
+f0109440:	0f 85 88 fc ff ff    	jne    f01090ce <rx_steer+0x59>
+		e1000_stats.ns_rx_csum_ok++;
+f0109446:	83 05 7c 10 97 f0 01 	addl   $0x1,0xf097107c
+f010944d:	e9 83 fc ff ff       	jmp    f01090d5 <rx_steer+0x60>
+		return 0;
+f0109452:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (q == RXQ_ALL) {
+f0109457:	e9 f0 fe ff ff       	jmp    f010934c <rx_steer+0x2d7>
+
+f010945c <attach_e1000>:
+
+int attach_e1000(struct pci_func *pcif)
+{
+f010945c:	55                   	push   %ebp
+f010945d:	89 e5                	mov    %esp,%ebp
+f010945f:	56                   	push   %esi
+f0109460:	53                   	push   %ebx
+f0109461:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uintptr_t addr;
+	size_t size;
+	int perm, i;
+	
+	// Enable PCI device
+	pci_func_enable(pcif);
+f0109464:	83 ec 0c             	sub    $0xc,%esp
+f0109467:	53                   	push   %ebx
+f0109468:	e8 3e 14 00 00       	call   f010a8ab <pci_func_enable>
+	size = pcif->reg_size[0];
+	size = ROUNDUP(size, PGSIZE);
+	perm = PTE_P | PTE_W | PTE_PCD | PTE_PWT;
+	
+	// Memory map I/O for PCI device
+	boot_map_region(kern_pgdir, KSTACKTOP, size, addr, perm);
+f010946d:	c7 04 24 1b 00 00 00 	movl   $0x1b,(%esp)
+f0109474:	ff 73 14             	push   0x14(%ebx)
+	size = ROUNDUP(size, PGSIZE);
+f0109477:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f010947a:	05 ff 0f 00 00       	add    $0xfff,%eax
+	boot_map_region(kern_pgdir, KSTACKTOP, size, addr, perm);
+f010947f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0109484:	50                   	push   %eax
+f0109485:	68 00 00 c0 ef       	push   $0xefc00000
+f010948a:	ff 35 f0 f3 92 f0    	push   0xf092f3f0
+f0109490:	e8 81 85 ff ff       	call   f0101a16 <boot_map_region>
+	e100 = (uint32_t *)KSTACKTOP;
+f0109495:	c7 05 e8 f3 92 f0 00 	movl   $0xefc00000,0xf092f3e8
+f010949c:	00 c0 ef 
+	cprintf("e1000 status register: %x\n", e100[E1000_STATUS/sizeof(uint32_t)]);
+f010949f:	a1 08 00 c0 ef       	mov    0xefc00008,%eax
+f01094a4:	83 c4 18             	add    $0x18,%esp
+f01094a7:	50                   	push   %eax
+f01094a8:	68 cd ce 10 f0       	push   $0xf010cecd
+f01094ad:	e8 3a b2 ff ff       	call   f01046ec <cprintf>
+
+	// Choose the ring sizes and allocate the descriptor rings.
+	ntx = ring_size(E1000_NTXDESC);
+f01094b2:	c7 05 9c 10 97 f0 00 	movl   $0x100,0xf097109c
+f01094b9:	01 00 00 
+	nrx = ring_size(E1000_NRXDESC);
+f01094bc:	c7 05 24 10 97 f0 00 	movl   $0x100,0xf0971024
+f01094c3:	01 00 00 
+	tx_fifo = page2kva(e1000_page());
+f01094c6:	e8 d1 f7 ff ff       	call   f0108c9c <e1000_page>
+	return (pp - pages) << PGSHIFT;
+f01094cb:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01094d1:	c1 f8 04             	sar    $0x4,%eax
+f01094d4:	89 c2                	mov    %eax,%edx
+f01094d6:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01094d9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01094de:	83 c4 10             	add    $0x10,%esp
+f01094e1:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f01094e7:	0f 83 9e 03 00 00    	jae    f010988b <attach_e1000+0x42f>
+	return (void *)(pa + KERNBASE);
+f01094ed:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01094f3:	89 15 a0 14 97 f0    	mov    %edx,0xf09714a0
+	rx_fifo = page2kva(e1000_page());
+f01094f9:	e8 9e f7 ff ff       	call   f0108c9c <e1000_page>
+	return (pp - pages) << PGSHIFT;
+f01094fe:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0109504:	c1 f8 04             	sar    $0x4,%eax
+f0109507:	89 c2                	mov    %eax,%edx
+f0109509:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010950c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109511:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0109517:	0f 83 80 03 00 00    	jae    f010989d <attach_e1000+0x441>
+	return (void *)(pa + KERNBASE);
+f010951d:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0109523:	89 15 20 10 97 f0    	mov    %edx,0xf0971020
+	cprintf("e1000: %d tx and %d rx descriptors\n", ntx, nrx);
+f0109529:	83 ec 04             	sub    $0x4,%esp
+f010952c:	ff 35 24 10 97 f0    	push   0xf0971024
+f0109532:	ff 35 9c 10 97 f0    	push   0xf097109c
+f0109538:	68 04 cf 10 f0       	push   $0xf010cf04
+f010953d:	e8 aa b1 ff ff       	call   f01046ec <cprintf>
+	e1000_nq = MIN(ncpu, NETQ_MAX);
+f0109542:	a1 a4 06 93 f0       	mov    0xf09306a4,%eax
+f0109547:	ba 04 00 00 00       	mov    $0x4,%edx
+f010954c:	39 d0                	cmp    %edx,%eax
+f010954e:	0f 4f c2             	cmovg  %edx,%eax
+f0109551:	a3 d4 87 11 f0       	mov    %eax,0xf01187d4
+	cprintf("e1000: %d receive queues\n", e1000_nq);
+f0109556:	83 c4 08             	add    $0x8,%esp
+f0109559:	50                   	push   %eax
+f010955a:	68 e8 ce 10 f0       	push   $0xf010cee8
+f010955f:	e8 88 b1 ff ff       	call   f01046ec <cprintf>
+
+	// transmit initialization
+	// Program the Transmit Descriptor Base Address Registers
+	e100[E1000_TDBAL/sizeof(uint32_t)] = PADDR((void*)tx_fifo);
+f0109564:	8b 15 a0 14 97 f0    	mov    0xf09714a0,%edx
+f010956a:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010956f:	83 c4 10             	add    $0x10,%esp
+f0109572:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0109578:	0f 86 31 03 00 00    	jbe    f01098af <attach_e1000+0x453>
+	return (physaddr_t)kva - KERNBASE;
+f010957e:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+f0109584:	89 90 00 38 00 00    	mov    %edx,0x3800(%eax)
+	e100[E1000_TDBAH/sizeof(uint32_t)] = 0x0;
+f010958a:	c7 80 04 38 00 00 00 	movl   $0x0,0x3804(%eax)
+f0109591:	00 00 00 
+	
+	// Set the Transmit Descriptor Length Register
+	e100[E1000_TDLEN/sizeof(uint32_t)] = ntx * sizeof(struct tx_desc);
+f0109594:	8b 0d 9c 10 97 f0    	mov    0xf097109c,%ecx
+f010959a:	89 ca                	mov    %ecx,%edx
+f010959c:	c1 e2 04             	shl    $0x4,%edx
+f010959f:	89 90 08 38 00 00    	mov    %edx,0x3808(%eax)
+	
+	// Set the Transmit Descriptor Head and Tail Registers
+	e100[E1000_TDH/sizeof(uint32_t)] = 0;
+f01095a5:	c7 80 10 38 00 00 00 	movl   $0x0,0x3810(%eax)
+f01095ac:	00 00 00 
+    e100[E1000_TDT/sizeof(uint32_t)] = 0;
+f01095af:	c7 80 18 38 00 00 00 	movl   $0x0,0x3818(%eax)
+f01095b6:	00 00 00 
+	
+	// Initialize the Transmit Control Register 
+	// Transmit Enable
+	e100[E1000_TCTL/sizeof(uint32_t)] |= E1000_TCTL_EN;
+f01095b9:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f01095bf:	83 ca 02             	or     $0x2,%edx
+f01095c2:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+	//Padding short packets, makes the packet 64 bytes long.
+	e100[E1000_TCTL/sizeof(uint32_t)] |= E1000_TCTL_PSP;
+f01095c8:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f01095ce:	83 ca 08             	or     $0x8,%edx
+f01095d1:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+	//Configure the Collision Threshold (TCTL.CT) to the desired value. 
+	//Ethernet standard is 10h.
+	//This setting only has meaning in half duplex mode.--by 8254x manual
+	e100[E1000_TCTL/sizeof(uint32_t)] |= 0x10 << E1000_TCTL_CT_SHIFT;
+f01095d7:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f01095dd:	80 ce 01             	or     $0x1,%dh
+f01095e0:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+	//Configure the Collision Distance (TCTL.COLD) to its expected value. 
+	//For full duplex operation, this value should be set to 40h. 
+	//For gigabit half duplex, this value should be set to 200h. 
+	//For 10/100 half duplex, this value should be set to 40h.--by 8254 manual
+	e100[E1000_TCTL/sizeof(uint32_t)] |= 0x40 << E1000_TCTL_COLD_SHIFT;
+f01095e6:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f01095ec:	81 ca 00 00 04 00    	or     $0x40000,%edx
+f01095f2:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+	
+	// Program the Transmit IPG Register
+	e100[E1000_TIPG/sizeof(uint32_t)] |= 10 << E1000_IPGT_SHIFT; // IPGR
+f01095f8:	8b 90 10 04 00 00    	mov    0x410(%eax),%edx
+f01095fe:	83 ca 0a             	or     $0xa,%edx
+f0109601:	89 90 10 04 00 00    	mov    %edx,0x410(%eax)
+	e100[E1000_TIPG/sizeof(uint32_t)] |= 4 << E1000_IPGR1_SHIFT; //IPGR1
+f0109607:	8b 90 10 04 00 00    	mov    0x410(%eax),%edx
+f010960d:	80 ce 10             	or     $0x10,%dh
+f0109610:	89 90 10 04 00 00    	mov    %edx,0x410(%eax)
+	e100[E1000_TIPG/sizeof(uint32_t)] |= 6 << E1000_IPGR2_SHIFT; //IPGR2
+f0109616:	8b 90 10 04 00 00    	mov    0x410(%eax),%edx
+f010961c:	81 ca 00 00 60 00    	or     $0x600000,%edx
+f0109622:	89 90 10 04 00 00    	mov    %edx,0x410(%eax)
+	e100[E1000_TIPG/sizeof(uint32_t)] |= 0 << E1000_RS_SHIFT;
+f0109628:	8b 90 10 04 00 00    	mov    0x410(%eax),%edx
+f010962e:	89 90 10 04 00 00    	mov    %edx,0x410(%eax)
+	
+	// Allocate the copy buffers; descriptors are filled in as
+	// packets are posted.
+	for (i = 0; i < ntx / 2; i++)
+f0109634:	83 f9 01             	cmp    $0x1,%ecx
+f0109637:	7e 27                	jle    f0109660 <attach_e1000+0x204>
+f0109639:	be 00 00 00 00       	mov    $0x0,%esi
+		tx_bufs[i] = e1000_page();
+f010963e:	e8 59 f6 ff ff       	call   f0108c9c <e1000_page>
+f0109643:	89 04 b5 c0 f0 92 f0 	mov    %eax,-0xf6d0f40(,%esi,4)
+	for (i = 0; i < ntx / 2; i++)
+f010964a:	83 c6 01             	add    $0x1,%esi
+f010964d:	8b 15 9c 10 97 f0    	mov    0xf097109c,%edx
+f0109653:	89 d0                	mov    %edx,%eax
+f0109655:	c1 e8 1f             	shr    $0x1f,%eax
+f0109658:	01 d0                	add    %edx,%eax
+f010965a:	d1 f8                	sar    %eax
+f010965c:	39 f0                	cmp    %esi,%eax
+f010965e:	7f de                	jg     f010963e <attach_e1000+0x1e2>
+
+	// receive initialization
+	
+	// Program the Receive Descriptor Base Address Registers
+	e100[E1000_RDBAL / sizeof(uint32_t)] = PADDR((void*)rx_fifo);
+f0109660:	8b 15 20 10 97 f0    	mov    0xf0971020,%edx
+f0109666:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010966b:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0109671:	0f 86 4d 02 00 00    	jbe    f01098c4 <attach_e1000+0x468>
+	return (physaddr_t)kva - KERNBASE;
+f0109677:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+f010967d:	89 90 00 28 00 00    	mov    %edx,0x2800(%eax)
+	e100[E1000_RDBAH / sizeof(uint32_t)] = 0x0;
+f0109683:	c7 80 04 28 00 00 00 	movl   $0x0,0x2804(%eax)
+f010968a:	00 00 00 
+	
+	// Set the Receive Descriptor Length Register
+	e100[E1000_RDLEN / sizeof(uint32_t)] = nrx * sizeof(struct rx_desc);
+f010968d:	8b 15 24 10 97 f0    	mov    0xf0971024,%edx
+f0109693:	c1 e2 04             	shl    $0x4,%edx
+f0109696:	89 90 08 28 00 00    	mov    %edx,0x2808(%eax)
+	// and 34:56 are the high-order 16 bits
+//	e100[E1000_RAL/sizeof(uint32_t)] = (0x12 << 24) | (0x0 << 16) | (0x54 << 8) | (0x52 << 0);
+//	e100[E1000_RAH/sizeof(uint32_t)] = (0x56 << 8) | (0x34 << 0);
+	// Challenge. read mac address from EEPROM
+	// first 16-bit
+	e100[E1000_EERD/sizeof(uint32_t)] = 0x0;
+f010969c:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+	e100[E1000_EERD/sizeof(uint32_t)] |= E1000_EEPROM_RW_REG_START;
+f01096a3:	8b 50 14             	mov    0x14(%eax),%edx
+f01096a6:	83 ca 01             	or     $0x1,%edx
+f01096a9:	89 50 14             	mov    %edx,0x14(%eax)
+	while(!(e100[E1000_EERD/sizeof(uint32_t)] & E1000_EEPROM_RW_REG_DONE));
+f01096ac:	8b 50 14             	mov    0x14(%eax),%edx
+f01096af:	f6 c2 10             	test   $0x10,%dl
+f01096b2:	74 f8                	je     f01096ac <attach_e1000+0x250>
+	e100[E1000_RAL/sizeof(uint32_t)] = 
+		e100[E1000_EERD/sizeof(uint32_t)] >> E1000_EEPROM_RW_REG_DATA;
+f01096b4:	8b 50 14             	mov    0x14(%eax),%edx
+f01096b7:	c1 ea 10             	shr    $0x10,%edx
+	e100[E1000_RAL/sizeof(uint32_t)] = 
+f01096ba:	89 90 00 54 00 00    	mov    %edx,0x5400(%eax)
+	// second 16-bit
+	e100[E1000_EERD/sizeof(uint32_t)] = 0x1 << E1000_EEPROM_RW_ADDR_SHIFT;
+f01096c0:	c7 40 14 00 01 00 00 	movl   $0x100,0x14(%eax)
+	e100[E1000_EERD/sizeof(uint32_t)] |= E1000_EEPROM_RW_REG_START;
+f01096c7:	8b 50 14             	mov    0x14(%eax),%edx
+f01096ca:	83 ca 01             	or     $0x1,%edx
+f01096cd:	89 50 14             	mov    %edx,0x14(%eax)
+	while(!(e100[E1000_EERD/sizeof(uint32_t)] & E1000_EEPROM_RW_REG_DONE));
+f01096d0:	8b 50 14             	mov    0x14(%eax),%edx
+f01096d3:	f6 c2 10             	test   $0x10,%dl
+f01096d6:	74 f8                	je     f01096d0 <attach_e1000+0x274>
+	e100[E1000_RAL/sizeof(uint32_t)] |= e100[E1000_EERD/sizeof(uint32_t)] & 0xffff0000;
+f01096d8:	8b 50 14             	mov    0x14(%eax),%edx
+f01096db:	8b 88 00 54 00 00    	mov    0x5400(%eax),%ecx
+f01096e1:	66 ba 00 00          	mov    $0x0,%dx
+f01096e5:	09 ca                	or     %ecx,%edx
+f01096e7:	89 90 00 54 00 00    	mov    %edx,0x5400(%eax)
+	// third 16-bit
+	e100[E1000_EERD/sizeof(uint32_t)] = 0x2 << E1000_EEPROM_RW_ADDR_SHIFT;
+f01096ed:	c7 40 14 00 02 00 00 	movl   $0x200,0x14(%eax)
+	e100[E1000_EERD/sizeof(uint32_t)] |= E1000_EEPROM_RW_REG_START;
+f01096f4:	8b 50 14             	mov    0x14(%eax),%edx
+f01096f7:	83 ca 01             	or     $0x1,%edx
+f01096fa:	89 50 14             	mov    %edx,0x14(%eax)
+	while(!(e100[E1000_EERD/sizeof(uint32_t)] & E1000_EEPROM_RW_REG_DONE));
+f01096fd:	8b 50 14             	mov    0x14(%eax),%edx
+f0109700:	f6 c2 10             	test   $0x10,%dl
+f0109703:	74 f8                	je     f01096fd <attach_e1000+0x2a1>
+	e100[E1000_RAH/sizeof(uint32_t)] = e100[E1000_EERD/sizeof(uint32_t)] >> E1000_EEPROM_RW_REG_DATA;
+f0109705:	8b 50 14             	mov    0x14(%eax),%edx
+f0109708:	c1 ea 10             	shr    $0x10,%edx
+f010970b:	89 90 04 54 00 00    	mov    %edx,0x5404(%eax)
+	//end challenge
+	
+
+
+	//address valid
+	e100[E1000_RAH/sizeof(uint32_t)] |= E1000_RAH_AV;	
+f0109711:	8b 90 04 54 00 00    	mov    0x5404(%eax),%edx
+f0109717:	81 ca 00 00 00 80    	or     $0x80000000,%edx
+f010971d:	89 90 04 54 00 00    	mov    %edx,0x5404(%eax)
+	
+	//initialize Multicast Table Array to 0b, total 4096 bit in MTA.
+	memset(((uint8_t*)e100) + E1000_MTA, 0, 4096/8);
+f0109723:	83 ec 04             	sub    $0x4,%esp
+f0109726:	68 00 02 00 00       	push   $0x200
+f010972b:	6a 00                	push   $0x0
+f010972d:	05 00 52 00 00       	add    $0x5200,%eax
+f0109732:	50                   	push   %eax
+f0109733:	e8 66 e5 ff ff       	call   f0107c9e <memset>
+	
+	// Interrupt only on receive events, and no more often than
+	// every E1000_ITR_INTERVAL.
+	e100[E1000_IMC/sizeof(uint32_t)] = 0xFFFFFFFF;
+f0109738:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f010973d:	c7 80 d8 00 00 00 ff 	movl   $0xffffffff,0xd8(%eax)
+f0109744:	ff ff ff 
+	e100[E1000_ITR/sizeof(uint32_t)] = E1000_ITR_INTERVAL;
+f0109747:	c7 80 c4 00 00 00 86 	movl   $0x186,0xc4(%eax)
+f010974e:	01 00 00 
+	(void) e100[E1000_ICR/sizeof(uint32_t)];
+f0109751:	8b 90 c0 00 00 00    	mov    0xc0(%eax),%edx
+	e100[E1000_IMS/sizeof(uint32_t)] = E1000_IMS_RX;
+f0109757:	c7 80 d0 00 00 00 d0 	movl   $0xd0,0xd0(%eax)
+f010975e:	00 00 00 
+	e1000_irq = pcif->irq_line;
+f0109761:	0f b6 53 44          	movzbl 0x44(%ebx),%edx
+f0109765:	88 15 a4 14 97 f0    	mov    %dl,0xf09714a4
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << e1000_irq));
+f010976b:	0f b7 05 88 83 11 f0 	movzwl 0xf0118388,%eax
+f0109772:	0f b3 d0             	btr    %edx,%eax
+f0109775:	0f b7 c0             	movzwl %ax,%eax
+f0109778:	89 04 24             	mov    %eax,(%esp)
+f010977b:	e8 f5 ad ff ff       	call   f0104575 <irq_setmask_8259A>
+
+	
+	// Buffer Size 2048, because largest possible standard Ethernet 
+	// packet (1518 bytes), we use one descriptor  for one packet. 
+	e100[E1000_RCTL/sizeof(uint32_t)] = 0;
+f0109780:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0109785:	c7 80 00 01 00 00 00 	movl   $0x0,0x100(%eax)
+f010978c:	00 00 00 
+	e100[E1000_RCTL/sizeof(uint32_t)] |= E1000_RCTL_SECRC; /* Strip Ethernet CRC */
+f010978f:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f0109795:	81 ca 00 00 00 04    	or     $0x4000000,%edx
+f010979b:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+	e100[E1000_RCTL/sizeof(uint32_t)] |= E1000_RCTL_SZ_2048;
+f01097a1:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f01097a7:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+	
+	// Initialize rx_fifo with one page per descriptor.  Pages are
+	// later swapped for pages donated by sys_net_recv_pages.
+	for (i = 0; i < nrx; i++) {
+f01097ad:	a1 24 10 97 f0       	mov    0xf0971024,%eax
+f01097b2:	83 c4 10             	add    $0x10,%esp
+f01097b5:	85 c0                	test   %eax,%eax
+f01097b7:	7e 40                	jle    f01097f9 <attach_e1000+0x39d>
+f01097b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		rx_pages[i] = e1000_page();
+f01097be:	e8 d9 f4 ff ff       	call   f0108c9c <e1000_page>
+f01097c3:	89 04 9d a0 10 97 f0 	mov    %eax,-0xf68ef60(,%ebx,4)
+		rx_fifo[i].addr = page2pa(rx_pages[i]) + RX_PKT_OFFSET;
+f01097ca:	89 da                	mov    %ebx,%edx
+f01097cc:	c1 e2 04             	shl    $0x4,%edx
+f01097cf:	03 15 20 10 97 f0    	add    0xf0971020,%edx
+	return (pp - pages) << PGSHIFT;
+f01097d5:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f01097db:	c1 f8 04             	sar    $0x4,%eax
+f01097de:	c1 e0 0c             	shl    $0xc,%eax
+f01097e1:	83 c0 08             	add    $0x8,%eax
+f01097e4:	89 02                	mov    %eax,(%edx)
+f01097e6:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+	for (i = 0; i < nrx; i++) {
+f01097ed:	83 c3 01             	add    $0x1,%ebx
+f01097f0:	a1 24 10 97 f0       	mov    0xf0971024,%eax
+f01097f5:	39 d8                	cmp    %ebx,%eax
+f01097f7:	7f c5                	jg     f01097be <attach_e1000+0x362>
+	}	
+
+	// Set the Receive Descriptor Head and Tail Registers: the card
+	// owns every descriptor from head up to, not including, tail.
+	// Giving it all but one leaves tail != head.
+	rx_next = 0;
+f01097f9:	c7 05 a4 f0 92 f0 00 	movl   $0x0,0xf092f0a4
+f0109800:	00 00 00 
+	e100[E1000_RDH / sizeof(uint32_t)] = 0x0;
+f0109803:	8b 15 e8 f3 92 f0    	mov    0xf092f3e8,%edx
+f0109809:	c7 82 10 28 00 00 00 	movl   $0x0,0x2810(%edx)
+f0109810:	00 00 00 
+	e100[E1000_RDT / sizeof(uint32_t)] = nrx - 1;
+f0109813:	83 e8 01             	sub    $0x1,%eax
+f0109816:	89 82 18 28 00 00    	mov    %eax,0x2818(%edx)
+	
+	//Initialize the Receive Control Register
+	e100[E1000_RCTL/sizeof(uint32_t)] &= ~E1000_RCTL_LPE; // Long Packet Reception disable
+f010981c:	8b 82 00 01 00 00    	mov    0x100(%edx),%eax
+f0109822:	83 e0 df             	and    $0xffffffdf,%eax
+f0109825:	89 82 00 01 00 00    	mov    %eax,0x100(%edx)
+	e100[E1000_RCTL/sizeof(uint32_t)] |= E1000_RCTL_BAM; // broadcast enable.
+f010982b:	8b 82 00 01 00 00    	mov    0x100(%edx),%eax
+f0109831:	80 cc 80             	or     $0x80,%ah
+f0109834:	89 82 00 01 00 00    	mov    %eax,0x100(%edx)
+	//Loopback Mode (RCTL.LBM) should be set to 00b for normal operation.
+	e100[E1000_RCTL/sizeof(uint32_t)] &= ~E1000_RCTL_LBM_NO;
+f010983a:	8b 82 00 01 00 00    	mov    0x100(%edx),%eax
+f0109840:	89 82 00 01 00 00    	mov    %eax,0x100(%edx)
+	e100[E1000_RCTL/sizeof(uint32_t)] &= ~E1000_RCTL_MPE; // multicast promiscuous disable
+f0109846:	8b 82 00 01 00 00    	mov    0x100(%edx),%eax
+f010984c:	83 e0 ef             	and    $0xffffffef,%eax
+f010984f:	89 82 00 01 00 00    	mov    %eax,0x100(%edx)
+	e100[E1000_RCTL/sizeof(uint32_t)] &= ~E1000_RCTL_BSEX; // Buffer size extension
+f0109855:	8b 82 00 01 00 00    	mov    0x100(%edx),%eax
+f010985b:	25 ff ff ff fd       	and    $0xfdffffff,%eax
+f0109860:	89 82 00 01 00 00    	mov    %eax,0x100(%edx)
+	/* broadcast enable */
+	//it is best to leave the Ethernet controller receive logic disabled (RCTL.EN = 0b) 
+	//until after the receive descriptor ring has been initialized and software is ready 
+	//to process received packets --by 8254x manual
+	// Have the card check IP, TCP and UDP checksums.
+	e100[E1000_RXCSUM/sizeof(uint32_t)] = E1000_RXCSUM_IPOFL | E1000_RXCSUM_TUOFL;
+f0109866:	c7 82 00 50 00 00 00 	movl   $0x300,0x5000(%edx)
+f010986d:	03 00 00 
+	e100[E1000_RCTL/sizeof(uint32_t)] |= E1000_RCTL_EN;  //enable receiver
+f0109870:	8b 82 00 01 00 00    	mov    0x100(%edx),%eax
+f0109876:	83 c8 02             	or     $0x2,%eax
+f0109879:	89 82 00 01 00 00    	mov    %eax,0x100(%edx)
+	return 0;
+}
+f010987f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109884:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0109887:	5b                   	pop    %ebx
+f0109888:	5e                   	pop    %esi
+f0109889:	5d                   	pop    %ebp
+f010988a:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010988b:	52                   	push   %edx
+f010988c:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0109891:	6a 6e                	push   $0x6e
+f0109893:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0109898:	e8 a3 67 ff ff       	call   f0100040 <_panic>
+f010989d:	52                   	push   %edx
+f010989e:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f01098a3:	6a 6e                	push   $0x6e
+f01098a5:	68 ce b8 10 f0       	push   $0xf010b8ce
+f01098aa:	e8 91 67 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01098af:	52                   	push   %edx
+f01098b0:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01098b5:	68 dd 01 00 00       	push   $0x1dd
+f01098ba:	68 c0 ce 10 f0       	push   $0xf010cec0
+f01098bf:	e8 7c 67 ff ff       	call   f0100040 <_panic>
+f01098c4:	52                   	push   %edx
+f01098c5:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01098ca:	68 04 02 00 00       	push   $0x204
+f01098cf:	68 c0 ce 10 f0       	push   $0xf010cec0
+f01098d4:	e8 67 67 ff ff       	call   f0100040 <_panic>
+
+f01098d9 <transmit_e1000>:
+
+// return 0 on success
+//  < 0 on error
+int 
+transmit_e1000(void* src, size_t len)
+{
+f01098d9:	55                   	push   %ebp
+f01098da:	89 e5                	mov    %esp,%ebp
+f01098dc:	57                   	push   %edi
+f01098dd:	56                   	push   %esi
+f01098de:	53                   	push   %ebx
+f01098df:	83 ec 0c             	sub    $0xc,%esp
+f01098e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int next = e100[E1000_TDT/sizeof(uint32_t)];
+f01098e5:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f01098ea:	8b 98 18 38 00 00    	mov    0x3818(%eax),%ebx
+	if (len > MAX_PACKET_SIZE)
+f01098f0:	81 fe ee 05 00 00    	cmp    $0x5ee,%esi
+f01098f6:	0f 87 c4 00 00 00    	ja     f01099c0 <transmit_e1000+0xe7>
+		return -E_OUT_BUFF;
+	// Check if next tx desc is free
+	tx_reclaim();
+f01098fc:	e8 ba f4 ff ff       	call   f0108dbb <tx_reclaim>
+	if (tx_free() > 0) {
+f0109901:	e8 6f f2 ff ff       	call   f0108b75 <tx_free>
+f0109906:	85 c0                	test   %eax,%eax
+f0109908:	0f 8e b9 00 00 00    	jle    f01099c7 <transmit_e1000+0xee>
+		memmove(tx_buffer(next), src, len);
+f010990e:	89 d8                	mov    %ebx,%eax
+f0109910:	e8 05 f7 ff ff       	call   f010901a <tx_buffer>
+f0109915:	83 ec 04             	sub    $0x4,%esp
+f0109918:	56                   	push   %esi
+f0109919:	ff 75 08             	push   0x8(%ebp)
+f010991c:	50                   	push   %eax
+f010991d:	e8 b1 e3 ff ff       	call   f0107cd3 <memmove>
+		tx_post(next, PADDR(tx_buffer(next)), len, E1000_TXD_CMD_EOP, 0);
+f0109922:	0f b7 fe             	movzwl %si,%edi
+f0109925:	89 d8                	mov    %ebx,%eax
+f0109927:	e8 ee f6 ff ff       	call   f010901a <tx_buffer>
+	if ((uint32_t)kva < KERNBASE)
+f010992c:	83 c4 10             	add    $0x10,%esp
+f010992f:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0109934:	76 75                	jbe    f01099ab <transmit_e1000+0xd2>
+	return (physaddr_t)kva - KERNBASE;
+f0109936:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f010993c:	83 ec 08             	sub    $0x8,%esp
+f010993f:	6a 00                	push   $0x0
+f0109941:	6a 01                	push   $0x1
+f0109943:	89 f9                	mov    %edi,%ecx
+f0109945:	89 d8                	mov    %ebx,%eax
+f0109947:	e8 c6 f1 ff ff       	call   f0108b12 <tx_post>
+		tx_learn(curenv->env_netq, tx_buffer(next), len);
+f010994c:	89 d8                	mov    %ebx,%eax
+f010994e:	e8 c7 f6 ff ff       	call   f010901a <tx_buffer>
+f0109953:	89 c7                	mov    %eax,%edi
+f0109955:	e8 9f e9 ff ff       	call   f01082f9 <cpunum>
+f010995a:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0109960:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0109966:	8b 40 6c             	mov    0x6c(%eax),%eax
+f0109969:	89 f1                	mov    %esi,%ecx
+f010996b:	89 fa                	mov    %edi,%edx
+f010996d:	e8 bc f5 ff ff       	call   f0108f2e <tx_learn>
+		e1000_stats.ns_tx_packets++;
+f0109972:	83 05 4c 10 97 f0 01 	addl   $0x1,0xf097104c
+		e1000_stats.ns_tx_bytes += len;
+f0109979:	01 35 50 10 97 f0    	add    %esi,0xf0971050
+		e1000_stats.ns_tx_copies++;
+f010997f:	83 05 54 10 97 f0 01 	addl   $0x1,0xf0971054
+		
+		e100[E1000_TDT/sizeof(uint32_t)] = (next + 1) % ntx;
+f0109986:	8d 43 01             	lea    0x1(%ebx),%eax
+f0109989:	99                   	cltd
+f010998a:	f7 3d 9c 10 97 f0    	idivl  0xf097109c
+f0109990:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0109995:	89 90 18 38 00 00    	mov    %edx,0x3818(%eax)
+		return 0;
+f010999b:	83 c4 10             	add    $0x10,%esp
+f010999e:	b8 00 00 00 00       	mov    $0x0,%eax
+	} else {
+		return -E_DESC_FULL;
+	}	
+}
+f01099a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01099a6:	5b                   	pop    %ebx
+f01099a7:	5e                   	pop    %esi
+f01099a8:	5f                   	pop    %edi
+f01099a9:	5d                   	pop    %ebp
+f01099aa:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01099ab:	50                   	push   %eax
+f01099ac:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f01099b1:	68 66 02 00 00       	push   $0x266
+f01099b6:	68 c0 ce 10 f0       	push   $0xf010cec0
+f01099bb:	e8 80 66 ff ff       	call   f0100040 <_panic>
+		return -E_OUT_BUFF;
+f01099c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01099c5:	eb dc                	jmp    f01099a3 <transmit_e1000+0xca>
+		return -E_DESC_FULL;
+f01099c7:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01099cc:	eb d5                	jmp    f01099a3 <transmit_e1000+0xca>
+
+f01099ce <transmit_e1000_sg>:
+//	-E_DESC_FULL if the ring has no room for the packet right now.
+// With nfrag == 0, only reports finished packets.
+int
+transmit_e1000_sg(struct Env *e, struct NetFrag *frags, int nfrag,
+		  const struct NetOffload *off)
+{
+f01099ce:	55                   	push   %ebp
+f01099cf:	89 e5                	mov    %esp,%ebp
+f01099d1:	57                   	push   %edi
+f01099d2:	56                   	push   %esi
+f01099d3:	53                   	push   %ebx
+f01099d4:	81 ec 3c 0a 00 00    	sub    $0xa3c,%esp
+f01099da:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t n, total = 0;
+	int i, next, nchunk = 0, nctx = 0, r;
+	uint8_t cmd = 0, popts = 0;
+	uint32_t done;
+
+	for (i = 0; i < nfrag; i++) {
+f01099dd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01099e1:	0f 8e 0d 02 00 00    	jle    f0109bf4 <transmit_e1000_sg+0x226>
+f01099e7:	83 fe 01             	cmp    $0x1,%esi
+f01099ea:	19 c0                	sbb    %eax,%eax
+f01099ec:	25 ef 05 ff ff       	and    $0xffff05ef,%eax
+f01099f1:	05 ff ff 00 00       	add    $0xffff,%eax
+f01099f6:	89 85 cc f5 ff ff    	mov    %eax,-0xa34(%ebp)
+	int i, next, nchunk = 0, nctx = 0, r;
+f01099fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	for (i = 0; i < nfrag; i++) {
+f0109a01:	c7 85 d0 f5 ff ff 00 	movl   $0x0,-0xa30(%ebp)
+f0109a08:	00 00 00 
+	size_t n, total = 0;
+f0109a0b:	c7 85 d4 f5 ff ff 00 	movl   $0x0,-0xa2c(%ebp)
+f0109a12:	00 00 00 
+		va = (uintptr_t) frags[i].nf_va;
+f0109a15:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109a18:	8b 8d d0 f5 ff ff    	mov    -0xa30(%ebp),%ecx
+f0109a1e:	8b 04 c8             	mov    (%eax,%ecx,8),%eax
+f0109a21:	89 c7                	mov    %eax,%edi
+		n = frags[i].nf_len;
+f0109a23:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0109a26:	8b 74 ce 04          	mov    0x4(%esi,%ecx,8),%esi
+		total += n;
+f0109a2a:	01 b5 d4 f5 ff ff    	add    %esi,-0xa2c(%ebp)
+f0109a30:	8b 8d d4 f5 ff ff    	mov    -0xa2c(%ebp),%ecx
+		if (total > (off ? NETTSO_MAX : MAX_PACKET_SIZE))
+f0109a36:	39 8d cc f5 ff ff    	cmp    %ecx,-0xa34(%ebp)
+f0109a3c:	0f 82 bc 03 00 00    	jb     f0109dfe <transmit_e1000_sg+0x430>
+			return -E_INVAL;
+		if (user_mem_check(e, (void *) va, n, PTE_U | PTE_P) < 0)
+f0109a42:	6a 05                	push   $0x5
+f0109a44:	56                   	push   %esi
+f0109a45:	50                   	push   %eax
+f0109a46:	ff 75 08             	push   0x8(%ebp)
+f0109a49:	e8 e2 a0 ff ff       	call   f0103b30 <user_mem_check>
+f0109a4e:	83 c4 10             	add    $0x10,%esp
+f0109a51:	85 c0                	test   %eax,%eax
+f0109a53:	0f 88 ac 03 00 00    	js     f0109e05 <transmit_e1000_sg+0x437>
+			return -E_FAULT;
+		while (n > 0) {
+f0109a59:	85 f6                	test   %esi,%esi
+f0109a5b:	74 65                	je     f0109ac2 <transmit_e1000_sg+0xf4>
+			if (nchunk == ntx - 2)
+f0109a5d:	a1 9c 10 97 f0       	mov    0xf097109c,%eax
+f0109a62:	83 e8 02             	sub    $0x2,%eax
+f0109a65:	39 d8                	cmp    %ebx,%eax
+f0109a67:	0f 84 9f 03 00 00    	je     f0109e0c <transmit_e1000_sg+0x43e>
+				return -E_INVAL;
+			pp[nchunk] = page_lookup(e->env_pgdir, (void *) va, 0);
+f0109a6d:	83 ec 04             	sub    $0x4,%esp
+f0109a70:	6a 00                	push   $0x0
+f0109a72:	57                   	push   %edi
+f0109a73:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109a76:	ff 70 70             	push   0x70(%eax)
+f0109a79:	e8 11 80 ff ff       	call   f0101a8f <page_lookup>
+f0109a7e:	89 84 9d e8 fb ff ff 	mov    %eax,-0x418(%ebp,%ebx,4)
+			pa[nchunk] = page2pa(pp[nchunk]) + PGOFF(va);
+f0109a85:	89 fa                	mov    %edi,%edx
+f0109a87:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+	return (pp - pages) << PGSHIFT;
+f0109a8d:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0109a93:	c1 f8 04             	sar    $0x4,%eax
+f0109a96:	c1 e0 0c             	shl    $0xc,%eax
+f0109a99:	01 d0                	add    %edx,%eax
+f0109a9b:	89 84 9d e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,4)
+			len[nchunk] = MIN(n, PGSIZE - PGOFF(va));
+f0109aa2:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0109aa7:	29 d0                	sub    %edx,%eax
+f0109aa9:	39 f0                	cmp    %esi,%eax
+f0109aab:	0f 47 c6             	cmova  %esi,%eax
+f0109aae:	66 89 84 5d e8 f5 ff 	mov    %ax,-0xa18(%ebp,%ebx,2)
+f0109ab5:	ff 
+			va += len[nchunk];
+f0109ab6:	01 c7                	add    %eax,%edi
+			n -= len[nchunk];
+			nchunk++;
+f0109ab8:	83 c3 01             	add    $0x1,%ebx
+		while (n > 0) {
+f0109abb:	83 c4 10             	add    $0x10,%esp
+f0109abe:	29 c6                	sub    %eax,%esi
+f0109ac0:	75 9b                	jne    f0109a5d <transmit_e1000_sg+0x8f>
+	for (i = 0; i < nfrag; i++) {
+f0109ac2:	83 85 d0 f5 ff ff 01 	addl   $0x1,-0xa30(%ebp)
+f0109ac9:	8b 85 d0 f5 ff ff    	mov    -0xa30(%ebp),%eax
+f0109acf:	39 45 10             	cmp    %eax,0x10(%ebp)
+f0109ad2:	0f 85 3d ff ff ff    	jne    f0109a15 <transmit_e1000_sg+0x47>
+		}
+	}
+
+	if (off && nchunk > 0) {
+f0109ad8:	8b 75 14             	mov    0x14(%ebp),%esi
+f0109adb:	85 db                	test   %ebx,%ebx
+f0109add:	0f 9f c0             	setg   %al
+f0109ae0:	85 f6                	test   %esi,%esi
+f0109ae2:	0f 95 c2             	setne  %dl
+f0109ae5:	20 c2                	and    %al,%dl
+f0109ae7:	88 95 c7 f5 ff ff    	mov    %dl,-0xa39(%ebp)
+f0109aed:	0f 84 df 02 00 00    	je     f0109dd2 <transmit_e1000_sg+0x404>
+	if (off->no_flags & ~NETOFF_ALL)
+f0109af3:	0f b6 06             	movzbl (%esi),%eax
+f0109af6:	3c 0f                	cmp    $0xf,%al
+f0109af8:	0f 87 1b 03 00 00    	ja     f0109e19 <transmit_e1000_sg+0x44b>
+	if ((off->no_flags & NETOFF_TCPCSUM) && (off->no_flags & NETOFF_UDPCSUM))
+f0109afe:	89 c2                	mov    %eax,%edx
+f0109b00:	83 e2 06             	and    $0x6,%edx
+f0109b03:	80 fa 06             	cmp    $0x6,%dl
+f0109b06:	0f 84 14 03 00 00    	je     f0109e20 <transmit_e1000_sg+0x452>
+	if (off->no_l4off < off->no_l3off + 20 || off->no_l4off + 8 > total)
+f0109b0c:	0f b6 56 02          	movzbl 0x2(%esi),%edx
+f0109b10:	0f b6 4e 01          	movzbl 0x1(%esi),%ecx
+f0109b14:	83 c1 13             	add    $0x13,%ecx
+f0109b17:	39 d1                	cmp    %edx,%ecx
+f0109b19:	0f 8d 08 03 00 00    	jge    f0109e27 <transmit_e1000_sg+0x459>
+f0109b1f:	8d 4a 08             	lea    0x8(%edx),%ecx
+f0109b22:	39 8d d4 f5 ff ff    	cmp    %ecx,-0xa2c(%ebp)
+f0109b28:	0f 82 00 03 00 00    	jb     f0109e2e <transmit_e1000_sg+0x460>
+	if (!(off->no_flags & NETOFF_TSO))
+f0109b2e:	a8 08                	test   $0x8,%al
+f0109b30:	0f 84 9d 00 00 00    	je     f0109bd3 <transmit_e1000_sg+0x205>
+	if ((off->no_flags & (NETOFF_IPCSUM | NETOFF_TCPCSUM))
+f0109b36:	83 e0 03             	and    $0x3,%eax
+f0109b39:	3c 03                	cmp    $0x3,%al
+f0109b3b:	0f 85 f4 02 00 00    	jne    f0109e35 <transmit_e1000_sg+0x467>
+	if (off->no_hdrlen < off->no_l4off + 20 || off->no_hdrlen >= total
+f0109b41:	0f b6 46 03          	movzbl 0x3(%esi),%eax
+f0109b45:	0f b6 c8             	movzbl %al,%ecx
+f0109b48:	83 c2 13             	add    $0x13,%edx
+f0109b4b:	39 ca                	cmp    %ecx,%edx
+f0109b4d:	0f 8d e9 02 00 00    	jge    f0109e3c <transmit_e1000_sg+0x46e>
+f0109b53:	8b bd d4 f5 ff ff    	mov    -0xa2c(%ebp),%edi
+f0109b59:	39 f9                	cmp    %edi,%ecx
+f0109b5b:	0f 83 e2 02 00 00    	jae    f0109e43 <transmit_e1000_sg+0x475>
+	    || off->no_mss == 0 || off->no_hdrlen + off->no_mss > MAX_PACKET_SIZE)
+f0109b61:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+f0109b65:	66 85 c0             	test   %ax,%ax
+f0109b68:	0f 84 dc 02 00 00    	je     f0109e4a <transmit_e1000_sg+0x47c>
+f0109b6e:	0f b7 c0             	movzwl %ax,%eax
+f0109b71:	01 c8                	add    %ecx,%eax
+	return total <= NETTSO_MAX ? 0 : -E_INVAL;
+f0109b73:	3d ee 05 00 00       	cmp    $0x5ee,%eax
+f0109b78:	7f 70                	jg     f0109bea <transmit_e1000_sg+0x21c>
+	memset(c, 0, sizeof(*c));
+f0109b7a:	83 ec 04             	sub    $0x4,%esp
+f0109b7d:	6a 10                	push   $0x10
+f0109b7f:	6a 00                	push   $0x0
+f0109b81:	8d 85 d8 f5 ff ff    	lea    -0xa28(%ebp),%eax
+f0109b87:	50                   	push   %eax
+f0109b88:	e8 11 e1 ff ff       	call   f0107c9e <memset>
+	c->ipcss = off->no_l3off;
+f0109b8d:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+f0109b91:	88 85 d8 f5 ff ff    	mov    %al,-0xa28(%ebp)
+	c->ipcso = off->no_l3off + 10;
+f0109b97:	83 c0 0a             	add    $0xa,%eax
+f0109b9a:	88 85 d9 f5 ff ff    	mov    %al,-0xa27(%ebp)
+	c->ipcse = off->no_l4off - 1;
+f0109ba0:	0f b6 46 02          	movzbl 0x2(%esi),%eax
+f0109ba4:	0f b6 d0             	movzbl %al,%edx
+f0109ba7:	83 ea 01             	sub    $0x1,%edx
+f0109baa:	66 89 95 da f5 ff ff 	mov    %dx,-0xa26(%ebp)
+	c->tucss = off->no_l4off;
+f0109bb1:	88 85 dc f5 ff ff    	mov    %al,-0xa24(%ebp)
+	c->tucso = off->no_l4off + ((off->no_flags & NETOFF_UDPCSUM) ? 6 : 16);
+f0109bb7:	0f b6 0e             	movzbl (%esi),%ecx
+f0109bba:	83 c4 10             	add    $0x10,%esp
+f0109bbd:	f6 c1 04             	test   $0x4,%cl
+f0109bc0:	0f 85 92 02 00 00    	jne    f0109e58 <transmit_e1000_sg+0x48a>
+f0109bc6:	83 c0 10             	add    $0x10,%eax
+		c->paylen |= E1000_TXD_TUCMD_TCP;
+f0109bc9:	ba 00 00 00 23       	mov    $0x23000000,%edx
+f0109bce:	e9 8d 02 00 00       	jmp    f0109e60 <transmit_e1000_sg+0x492>
+		return total <= MAX_PACKET_SIZE ? 0 : -E_INVAL;
+f0109bd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109bd8:	81 bd d4 f5 ff ff ee 	cmpl   $0x5ee,-0xa2c(%ebp)
+f0109bdf:	05 00 00 
+f0109be2:	0f 87 29 02 00 00    	ja     f0109e11 <transmit_e1000_sg+0x443>
+f0109be8:	eb 90                	jmp    f0109b7a <transmit_e1000_sg+0x1ac>
+f0109bea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109bef:	e9 1d 02 00 00       	jmp    f0109e11 <transmit_e1000_sg+0x443>
+	int i, next, nchunk = 0, nctx = 0, r;
+f0109bf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	size_t n, total = 0;
+f0109bf9:	c7 85 d4 f5 ff ff 00 	movl   $0x0,-0xa2c(%ebp)
+f0109c00:	00 00 00 
+	if (off && nchunk > 0) {
+f0109c03:	c6 85 c7 f5 ff ff 00 	movb   $0x0,-0xa39(%ebp)
+	uint8_t cmd = 0, popts = 0;
+f0109c0a:	c6 85 c6 f5 ff ff 00 	movb   $0x0,-0xa3a(%ebp)
+f0109c11:	c6 85 d0 f5 ff ff 00 	movb   $0x0,-0xa30(%ebp)
+	int i, next, nchunk = 0, nctx = 0, r;
+f0109c18:	c7 85 cc f5 ff ff 00 	movl   $0x0,-0xa34(%ebp)
+f0109c1f:	00 00 00 
+			popts |= E1000_TXD_POPTS_IXSM;
+		if (off->no_flags & (NETOFF_TCPCSUM | NETOFF_UDPCSUM))
+			popts |= E1000_TXD_POPTS_TXSM;
+	}
+
+	tx_reclaim();
+f0109c22:	e8 94 f1 ff ff       	call   f0108dbb <tx_reclaim>
+	if (nctx + nchunk > tx_free())
+f0109c27:	8b 85 cc f5 ff ff    	mov    -0xa34(%ebp),%eax
+f0109c2d:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+f0109c30:	e8 40 ef ff ff       	call   f0108b75 <tx_free>
+f0109c35:	39 c6                	cmp    %eax,%esi
+f0109c37:	0f 8f 14 02 00 00    	jg     f0109e51 <transmit_e1000_sg+0x483>
+		return -E_DESC_FULL;
+
+	next = e100[E1000_TDT/sizeof(uint32_t)];
+f0109c3d:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0109c42:	8b b0 18 38 00 00    	mov    0x3818(%eax),%esi
+f0109c48:	89 f7                	mov    %esi,%edi
+	if (nctx) {
+f0109c4a:	83 bd cc f5 ff ff 00 	cmpl   $0x0,-0xa34(%ebp)
+f0109c51:	74 7a                	je     f0109ccd <transmit_e1000_sg+0x2ff>
+		tx_ctx = ctx;
+f0109c53:	8b 95 d8 f5 ff ff    	mov    -0xa28(%ebp),%edx
+f0109c59:	89 15 70 eb 92 f0    	mov    %edx,0xf092eb70
+f0109c5f:	8b 85 dc f5 ff ff    	mov    -0xa24(%ebp),%eax
+f0109c65:	a3 74 eb 92 f0       	mov    %eax,0xf092eb74
+f0109c6a:	8b 85 e0 f5 ff ff    	mov    -0xa20(%ebp),%eax
+f0109c70:	a3 78 eb 92 f0       	mov    %eax,0xf092eb78
+f0109c75:	8b 85 e4 f5 ff ff    	mov    -0xa1c(%ebp),%eax
+f0109c7b:	a3 7c eb 92 f0       	mov    %eax,0xf092eb7c
+		*(struct tx_ctx_desc *) &tx_fifo[next] = ctx;
+f0109c80:	89 f0                	mov    %esi,%eax
+f0109c82:	c1 e0 04             	shl    $0x4,%eax
+f0109c85:	03 05 a0 14 97 f0    	add    0xf09714a0,%eax
+f0109c8b:	89 10                	mov    %edx,(%eax)
+f0109c8d:	8b 95 dc f5 ff ff    	mov    -0xa24(%ebp),%edx
+f0109c93:	89 50 04             	mov    %edx,0x4(%eax)
+f0109c96:	8b 95 e0 f5 ff ff    	mov    -0xa20(%ebp),%edx
+f0109c9c:	89 50 08             	mov    %edx,0x8(%eax)
+f0109c9f:	8b 95 e4 f5 ff ff    	mov    -0xa1c(%ebp),%edx
+f0109ca5:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (next % TX_RS_EVERY == TX_RS_EVERY - 1)
+f0109ca8:	89 f1                	mov    %esi,%ecx
+f0109caa:	c1 f9 1f             	sar    $0x1f,%ecx
+f0109cad:	c1 e9 1d             	shr    $0x1d,%ecx
+f0109cb0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f0109cb3:	83 e2 07             	and    $0x7,%edx
+f0109cb6:	29 ca                	sub    %ecx,%edx
+f0109cb8:	83 fa 07             	cmp    $0x7,%edx
+f0109cbb:	0f 84 34 01 00 00    	je     f0109df5 <transmit_e1000_sg+0x427>
+			tx_fifo[next].cmd |= E1000_TXD_CMD_RS;
+		next = (next + 1) % ntx;
+f0109cc1:	8d 46 01             	lea    0x1(%esi),%eax
+f0109cc4:	99                   	cltd
+f0109cc5:	f7 3d 9c 10 97 f0    	idivl  0xf097109c
+f0109ccb:	89 d7                	mov    %edx,%edi
+	}
+	for (i = 0; i < nchunk; i++) {
+f0109ccd:	be 00 00 00 00       	mov    $0x0,%esi
+		pp[i]->pp_ref++;
+		tx_pages[next] = pp[i];
+		tx_sg_queue[next] = e->env_netq;
+		// Always report the end of a packet, so that its pages
+		// are given back promptly.
+		tx_post(next, pa[i], len[i], i == nchunk - 1 ?
+f0109cd2:	0f b6 85 c6 f5 ff ff 	movzbl -0xa3a(%ebp),%eax
+f0109cd9:	89 85 cc f5 ff ff    	mov    %eax,-0xa34(%ebp)
+f0109cdf:	0f b6 85 d0 f5 ff ff 	movzbl -0xa30(%ebp),%eax
+f0109ce6:	83 c8 09             	or     $0x9,%eax
+f0109ce9:	0f b6 c0             	movzbl %al,%eax
+f0109cec:	89 85 c8 f5 ff ff    	mov    %eax,-0xa38(%ebp)
+	for (i = 0; i < nchunk; i++) {
+f0109cf2:	80 bd c7 f5 ff ff 00 	cmpb   $0x0,-0xa39(%ebp)
+f0109cf9:	0f 84 b9 00 00 00    	je     f0109db8 <transmit_e1000_sg+0x3ea>
+		pp[i]->pp_ref++;
+f0109cff:	8b 84 b5 e8 fb ff ff 	mov    -0x418(%ebp,%esi,4),%eax
+f0109d06:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+		tx_pages[next] = pp[i];
+f0109d0b:	89 04 bd a0 ec 92 f0 	mov    %eax,-0xf6d1360(,%edi,4)
+		tx_sg_queue[next] = e->env_netq;
+f0109d12:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109d15:	8b 40 6c             	mov    0x6c(%eax),%eax
+f0109d18:	88 87 a0 eb 92 f0    	mov    %al,-0xf6d1460(%edi)
+		tx_post(next, pa[i], len[i], i == nchunk - 1 ?
+f0109d1e:	8d 53 ff             	lea    -0x1(%ebx),%edx
+f0109d21:	0f b6 85 d0 f5 ff ff 	movzbl -0xa30(%ebp),%eax
+f0109d28:	39 f2                	cmp    %esi,%edx
+f0109d2a:	0f 44 85 c8 f5 ff ff 	cmove  -0xa38(%ebp),%eax
+f0109d31:	0f b7 8c 75 e8 f5 ff 	movzwl -0xa18(%ebp,%esi,2),%ecx
+f0109d38:	ff 
+f0109d39:	8b 94 b5 e8 f7 ff ff 	mov    -0x818(%ebp,%esi,4),%edx
+f0109d40:	83 ec 08             	sub    $0x8,%esp
+f0109d43:	ff b5 cc f5 ff ff    	push   -0xa34(%ebp)
+f0109d49:	50                   	push   %eax
+f0109d4a:	89 f8                	mov    %edi,%eax
+f0109d4c:	e8 c1 ed ff ff       	call   f0108b12 <tx_post>
+			cmd | E1000_TXD_CMD_EOP | E1000_TXD_CMD_RS : cmd, popts);
+		next = (next + 1) % ntx;
+f0109d51:	8d 47 01             	lea    0x1(%edi),%eax
+f0109d54:	99                   	cltd
+f0109d55:	f7 3d 9c 10 97 f0    	idivl  0xf097109c
+f0109d5b:	89 d7                	mov    %edx,%edi
+	for (i = 0; i < nchunk; i++) {
+f0109d5d:	83 c6 01             	add    $0x1,%esi
+f0109d60:	83 c4 10             	add    $0x10,%esp
+f0109d63:	39 de                	cmp    %ebx,%esi
+f0109d65:	7c 98                	jl     f0109cff <transmit_e1000_sg+0x331>
+	}
+	if (nchunk > 0) {
+		e100[E1000_TDT/sizeof(uint32_t)] = next;
+f0109d67:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f0109d6c:	89 90 18 38 00 00    	mov    %edx,0x3818(%eax)
+		tx_learn(e->env_netq, frags[0].nf_va, frags[0].nf_len);
+f0109d72:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109d75:	8b 48 04             	mov    0x4(%eax),%ecx
+f0109d78:	8b 10                	mov    (%eax),%edx
+f0109d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109d7d:	8b 40 6c             	mov    0x6c(%eax),%eax
+f0109d80:	e8 a9 f1 ff ff       	call   f0108f2e <tx_learn>
+		e1000_stats.ns_tx_packets++;
+f0109d85:	83 05 4c 10 97 f0 01 	addl   $0x1,0xf097104c
+		e1000_stats.ns_tx_bytes += total;
+f0109d8c:	8b 85 d4 f5 ff ff    	mov    -0xa2c(%ebp),%eax
+f0109d92:	01 05 50 10 97 f0    	add    %eax,0xf0971050
+		if (popts)
+f0109d98:	80 bd c6 f5 ff ff 00 	cmpb   $0x0,-0xa3a(%ebp)
+f0109d9f:	74 07                	je     f0109da8 <transmit_e1000_sg+0x3da>
+			e1000_stats.ns_tx_csum++;
+f0109da1:	83 05 74 10 97 f0 01 	addl   $0x1,0xf0971074
+		if (cmd & E1000_TXD_CMD_TSE)
+f0109da8:	f6 85 d0 f5 ff ff 04 	testb  $0x4,-0xa30(%ebp)
+f0109daf:	74 07                	je     f0109db8 <transmit_e1000_sg+0x3ea>
+			e1000_stats.ns_tx_tso++;
+f0109db1:	83 05 78 10 97 f0 01 	addl   $0x1,0xf0971078
+	}
+
+	done = tx_sg_done[e->env_netq];
+f0109db8:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109dbb:	8b 50 6c             	mov    0x6c(%eax),%edx
+f0109dbe:	8b 04 95 80 eb 92 f0 	mov    -0xf6d1480(,%edx,4),%eax
+	tx_sg_done[e->env_netq] = 0;
+f0109dc5:	c7 04 95 80 eb 92 f0 	movl   $0x0,-0xf6d1480(,%edx,4)
+f0109dcc:	00 00 00 00 
+	return done;
+f0109dd0:	eb 3f                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+	if (off && nchunk > 0) {
+f0109dd2:	88 85 c7 f5 ff ff    	mov    %al,-0xa39(%ebp)
+	uint8_t cmd = 0, popts = 0;
+f0109dd8:	c6 85 c6 f5 ff ff 00 	movb   $0x0,-0xa3a(%ebp)
+f0109ddf:	c6 85 d0 f5 ff ff 00 	movb   $0x0,-0xa30(%ebp)
+	int i, next, nchunk = 0, nctx = 0, r;
+f0109de6:	c7 85 cc f5 ff ff 00 	movl   $0x0,-0xa34(%ebp)
+f0109ded:	00 00 00 
+f0109df0:	e9 2d fe ff ff       	jmp    f0109c22 <transmit_e1000_sg+0x254>
+			tx_fifo[next].cmd |= E1000_TXD_CMD_RS;
+f0109df5:	80 48 0b 08          	orb    $0x8,0xb(%eax)
+f0109df9:	e9 c3 fe ff ff       	jmp    f0109cc1 <transmit_e1000_sg+0x2f3>
+			return -E_INVAL;
+f0109dfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e03:	eb 0c                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+			return -E_FAULT;
+f0109e05:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0109e0a:	eb 05                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+				return -E_INVAL;
+f0109e0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f0109e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109e14:	5b                   	pop    %ebx
+f0109e15:	5e                   	pop    %esi
+f0109e16:	5f                   	pop    %edi
+f0109e17:	5d                   	pop    %ebp
+f0109e18:	c3                   	ret
+f0109e19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e1e:	eb f1                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+f0109e20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e25:	eb ea                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+f0109e27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e2c:	eb e3                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+f0109e2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e33:	eb dc                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+f0109e35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e3a:	eb d5                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+f0109e3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e41:	eb ce                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+f0109e43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e48:	eb c7                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+f0109e4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109e4f:	eb c0                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+		return -E_DESC_FULL;
+f0109e51:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0109e56:	eb b9                	jmp    f0109e11 <transmit_e1000_sg+0x443>
+	c->tucso = off->no_l4off + ((off->no_flags & NETOFF_UDPCSUM) ? 6 : 16);
+f0109e58:	83 c0 06             	add    $0x6,%eax
+		c->paylen |= E1000_TXD_TUCMD_TCP;
+f0109e5b:	ba 00 00 00 22       	mov    $0x22000000,%edx
+	c->tucso = off->no_l4off + ((off->no_flags & NETOFF_UDPCSUM) ? 6 : 16);
+f0109e60:	88 85 dd f5 ff ff    	mov    %al,-0xa23(%ebp)
+f0109e66:	89 95 e0 f5 ff ff    	mov    %edx,-0xa20(%ebp)
+	if (off->no_flags & NETOFF_TSO) {
+f0109e6c:	f6 c1 08             	test   $0x8,%cl
+f0109e6f:	74 2e                	je     f0109e9f <transmit_e1000_sg+0x4d1>
+		c->paylen |= E1000_TXD_TUCMD_TSE | (total - off->no_hdrlen);
+f0109e71:	0f b6 4e 03          	movzbl 0x3(%esi),%ecx
+f0109e75:	8b 85 d4 f5 ff ff    	mov    -0xa2c(%ebp),%eax
+f0109e7b:	29 c8                	sub    %ecx,%eax
+f0109e7d:	09 d0                	or     %edx,%eax
+f0109e7f:	0d 00 00 00 04       	or     $0x4000000,%eax
+f0109e84:	89 85 e0 f5 ff ff    	mov    %eax,-0xa20(%ebp)
+		c->hdrlen = off->no_hdrlen;
+f0109e8a:	0f b6 46 03          	movzbl 0x3(%esi),%eax
+f0109e8e:	88 85 e5 f5 ff ff    	mov    %al,-0xa1b(%ebp)
+		c->mss = off->no_mss;
+f0109e94:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+f0109e98:	66 89 85 e6 f5 ff ff 	mov    %ax,-0xa1a(%ebp)
+		nctx = memcmp(&ctx, &tx_ctx, sizeof(ctx)) != 0;
+f0109e9f:	83 ec 04             	sub    $0x4,%esp
+f0109ea2:	6a 10                	push   $0x10
+f0109ea4:	68 70 eb 92 f0       	push   $0xf092eb70
+f0109ea9:	8d 85 d8 f5 ff ff    	lea    -0xa28(%ebp),%eax
+f0109eaf:	50                   	push   %eax
+f0109eb0:	e8 96 de ff ff       	call   f0107d4b <memcmp>
+f0109eb5:	83 c4 10             	add    $0x10,%esp
+f0109eb8:	85 c0                	test   %eax,%eax
+f0109eba:	0f 95 c0             	setne  %al
+f0109ebd:	0f b6 c0             	movzbl %al,%eax
+f0109ec0:	89 85 cc f5 ff ff    	mov    %eax,-0xa34(%ebp)
+		if (off->no_flags & NETOFF_TSO)
+f0109ec6:	0f b6 06             	movzbl (%esi),%eax
+f0109ec9:	89 c2                	mov    %eax,%edx
+f0109ecb:	83 e2 08             	and    $0x8,%edx
+		cmd = E1000_TXD_CMD_DEXT;
+f0109ece:	80 fa 01             	cmp    $0x1,%dl
+f0109ed1:	19 c9                	sbb    %ecx,%ecx
+f0109ed3:	83 e1 fc             	and    $0xfffffffc,%ecx
+f0109ed6:	83 c1 24             	add    $0x24,%ecx
+f0109ed9:	88 8d d0 f5 ff ff    	mov    %cl,-0xa30(%ebp)
+		if (off->no_flags & NETOFF_IPCSUM)
+f0109edf:	89 c1                	mov    %eax,%ecx
+f0109ee1:	83 e1 01             	and    $0x1,%ecx
+			popts |= E1000_TXD_POPTS_TXSM;
+f0109ee4:	89 ca                	mov    %ecx,%edx
+f0109ee6:	83 ca 02             	or     $0x2,%edx
+f0109ee9:	a8 06                	test   $0x6,%al
+f0109eeb:	0f 45 ca             	cmovne %edx,%ecx
+f0109eee:	88 8d c6 f5 ff ff    	mov    %cl,-0xa3a(%ebp)
+f0109ef4:	e9 29 fd ff ff       	jmp    f0109c22 <transmit_e1000_sg+0x254>
+
+f0109ef9 <receive_e1000>:
+// Copy the next packet of the current env's receive queue into 'dst'.
+// Returns its length, or -E_DESC_EMPTY if there is none.
+int 
+receive_e1000(void* dst)
+{
+f0109ef9:	55                   	push   %ebp
+f0109efa:	89 e5                	mov    %esp,%ebp
+f0109efc:	57                   	push   %edi
+f0109efd:	56                   	push   %esi
+f0109efe:	53                   	push   %ebx
+f0109eff:	83 ec 0c             	sub    $0xc,%esp
+	struct rx_queue *rq = &rx_queues[curenv->env_netq];
+f0109f02:	e8 f2 e3 ff ff       	call   f01082f9 <cpunum>
+f0109f07:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+f0109f0d:	8b 80 28 00 93 f0    	mov    -0xf6cffd8(%eax),%eax
+f0109f13:	8b 78 6c             	mov    0x6c(%eax),%edi
+	struct Page *pp;
+	int len;
+
+	rx_steer();
+f0109f16:	e8 5a f1 ff ff       	call   f0109075 <rx_steer>
+	if (rq->rq_n == 0)
+f0109f1b:	69 c7 24 01 00 00    	imul   $0x124,%edi,%eax
+f0109f21:	83 b8 e4 e7 92 f0 00 	cmpl   $0x0,-0xf6d181c(%eax)
+f0109f28:	0f 84 a8 00 00 00    	je     f0109fd6 <receive_e1000+0xdd>
+		return -E_DESC_EMPTY;
+	pp = rq->rq_pages[rq->rq_head];
+f0109f2e:	89 c2                	mov    %eax,%edx
+f0109f30:	8d 04 ff             	lea    (%edi,%edi,8),%eax
+f0109f33:	8d 04 c7             	lea    (%edi,%eax,8),%eax
+f0109f36:	03 82 e0 e7 92 f0    	add    -0xf6d1820(%edx),%eax
+f0109f3c:	8b 34 85 e0 e6 92 f0 	mov    -0xf6d1920(,%eax,4),%esi
+f0109f43:	89 f0                	mov    %esi,%eax
+f0109f45:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f0109f4b:	c1 f8 04             	sar    $0x4,%eax
+f0109f4e:	89 c2                	mov    %eax,%edx
+f0109f50:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109f53:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109f58:	3b 05 ec f3 92 f0    	cmp    0xf092f3ec,%eax
+f0109f5e:	73 64                	jae    f0109fc4 <receive_e1000+0xcb>
+	len = ((int *) page2kva(pp))[0];
+f0109f60:	8b 9a 00 00 00 f0    	mov    -0x10000000(%edx),%ebx
+	memmove(dst, page2kva(pp) + RX_PKT_OFFSET, len);
+f0109f66:	83 ec 04             	sub    $0x4,%esp
+f0109f69:	53                   	push   %ebx
+f0109f6a:	81 ea f8 ff ff 0f    	sub    $0xffffff8,%edx
+f0109f70:	52                   	push   %edx
+f0109f71:	ff 75 08             	push   0x8(%ebp)
+f0109f74:	e8 5a dd ff ff       	call   f0107cd3 <memmove>
+	e1000_stats.ns_rx_copies++;
+f0109f79:	83 05 48 10 97 f0 01 	addl   $0x1,0xf0971048
+	rq->rq_head = (rq->rq_head + 1) % RXQ_SIZE;
+f0109f80:	69 c7 24 01 00 00    	imul   $0x124,%edi,%eax
+f0109f86:	8b b8 e0 e7 92 f0    	mov    -0xf6d1820(%eax),%edi
+f0109f8c:	8d 57 01             	lea    0x1(%edi),%edx
+f0109f8f:	89 d1                	mov    %edx,%ecx
+f0109f91:	c1 f9 1f             	sar    $0x1f,%ecx
+f0109f94:	c1 e9 1a             	shr    $0x1a,%ecx
+f0109f97:	01 ca                	add    %ecx,%edx
+f0109f99:	83 e2 3f             	and    $0x3f,%edx
+f0109f9c:	29 ca                	sub    %ecx,%edx
+f0109f9e:	89 90 e0 e7 92 f0    	mov    %edx,-0xf6d1820(%eax)
+f0109fa4:	05 e0 e6 92 f0       	add    $0xf092e6e0,%eax
+	rq->rq_n--;
+f0109fa9:	83 a8 04 01 00 00 01 	subl   $0x1,0x104(%eax)
+	rx_page_put(pp);
+f0109fb0:	89 f0                	mov    %esi,%eax
+f0109fb2:	e8 ef ee ff ff       	call   f0108ea6 <rx_page_put>
+	return len;
+f0109fb7:	83 c4 10             	add    $0x10,%esp
+}
+f0109fba:	89 d8                	mov    %ebx,%eax
+f0109fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109fbf:	5b                   	pop    %ebx
+f0109fc0:	5e                   	pop    %esi
+f0109fc1:	5f                   	pop    %edi
+f0109fc2:	5d                   	pop    %ebp
+f0109fc3:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109fc4:	52                   	push   %edx
+f0109fc5:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f0109fca:	6a 6e                	push   $0x6e
+f0109fcc:	68 ce b8 10 f0       	push   $0xf010b8ce
+f0109fd1:	e8 6a 60 ff ff       	call   f0100040 <_panic>
+		return -E_DESC_EMPTY;
+f0109fd6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0109fdb:	eb dd                	jmp    f0109fba <receive_e1000+0xc1>
+
+f0109fdd <receive_e1000_pages>:
+//	-E_DESC_EMPTY if no packet has arrived,
+//	-E_INVAL if the first page is unsuitable,
+//	-E_NO_MEM if there's no memory to map the first packet.
+int
+receive_e1000_pages(struct Env *e, void *va, int n)
+{
+f0109fdd:	55                   	push   %ebp
+f0109fde:	89 e5                	mov    %esp,%ebp
+f0109fe0:	57                   	push   %edi
+f0109fe1:	56                   	push   %esi
+f0109fe2:	53                   	push   %ebx
+f0109fe3:	83 ec 2c             	sub    $0x2c,%esp
+	struct rx_queue *rq = &rx_queues[e->env_netq];
+f0109fe6:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109fe9:	8b 40 6c             	mov    0x6c(%eax),%eax
+f0109fec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	struct Page *pp, *rxpp;
+	pte_t *pte;
+	int i, r = -E_DESC_EMPTY;
+
+	rx_steer();
+f0109fef:	e8 81 f0 ff ff       	call   f0109075 <rx_steer>
+	for (i = 0; i < n && rq->rq_n > 0; i++, va += PGSIZE) {
+f0109ff4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0109ff8:	0f 8e e2 00 00 00    	jle    f010a0e0 <receive_e1000_pages+0x103>
+	int i, r = -E_DESC_EMPTY;
+f0109ffe:	c7 45 d0 fd ff ff ff 	movl   $0xfffffffd,-0x30(%ebp)
+	for (i = 0; i < n && rq->rq_n > 0; i++, va += PGSIZE) {
+f010a005:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a00a:	69 75 cc 24 01 00 00 	imul   $0x124,-0x34(%ebp),%esi
+f010a011:	81 c6 e0 e6 92 f0    	add    $0xf092e6e0,%esi
+		if (!(pp = page_lookup(e->env_pgdir, va, &pte))
+f010a017:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+	for (i = 0; i < n && rq->rq_n > 0; i++, va += PGSIZE) {
+f010a01a:	83 be 04 01 00 00 00 	cmpl   $0x0,0x104(%esi)
+f010a021:	0f 8e ca 00 00 00    	jle    f010a0f1 <receive_e1000_pages+0x114>
+		if (!(pp = page_lookup(e->env_pgdir, va, &pte))
+f010a027:	83 ec 04             	sub    $0x4,%esp
+f010a02a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010a02d:	50                   	push   %eax
+f010a02e:	ff 75 0c             	push   0xc(%ebp)
+f010a031:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a034:	ff 70 70             	push   0x70(%eax)
+f010a037:	e8 53 7a ff ff       	call   f0101a8f <page_lookup>
+f010a03c:	89 c3                	mov    %eax,%ebx
+f010a03e:	83 c4 10             	add    $0x10,%esp
+f010a041:	85 c0                	test   %eax,%eax
+f010a043:	0f 84 bb 00 00 00    	je     f010a104 <receive_e1000_pages+0x127>
+		    || !(*pte & PTE_W) || pp->pp_ref != 1) {
+f010a049:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a04c:	f6 00 02             	testb  $0x2,(%eax)
+f010a04f:	0f 84 bb 00 00 00    	je     f010a110 <receive_e1000_pages+0x133>
+f010a055:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f010a05a:	0f 85 bc 00 00 00    	jne    f010a11c <receive_e1000_pages+0x13f>
+			r = -E_INVAL;
+			break;
+		}
+		rxpp = rq->rq_pages[rq->rq_head];
+f010a060:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f010a063:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+f010a066:	8d 04 c1             	lea    (%ecx,%eax,8),%eax
+f010a069:	03 86 00 01 00 00    	add    0x100(%esi),%eax
+f010a06f:	8b 3c 85 e0 e6 92 f0 	mov    -0xf6d1920(,%eax,4),%edi
+
+		// Move the queue's reference from rxpp to pp.
+		pp->pp_ref++;
+f010a076:	66 c7 43 04 02 00    	movw   $0x2,0x4(%ebx)
+		if ((r = page_insert(e->env_pgdir, rxpp, va, PTE_P | PTE_U | PTE_W)) < 0) {
+f010a07c:	6a 07                	push   $0x7
+f010a07e:	ff 75 0c             	push   0xc(%ebp)
+f010a081:	57                   	push   %edi
+f010a082:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a085:	ff 70 70             	push   0x70(%eax)
+f010a088:	e8 fe 7f ff ff       	call   f010208b <page_insert>
+f010a08d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f010a090:	83 c4 10             	add    $0x10,%esp
+f010a093:	85 c0                	test   %eax,%eax
+f010a095:	78 50                	js     f010a0e7 <receive_e1000_pages+0x10a>
+			pp->pp_ref--;
+			break;
+		}
+		rxpp->pp_ref--;
+f010a097:	66 83 6f 04 01       	subw   $0x1,0x4(%edi)
+		rx_page_put(pp);
+f010a09c:	89 d8                	mov    %ebx,%eax
+f010a09e:	e8 03 ee ff ff       	call   f0108ea6 <rx_page_put>
+		rq->rq_head = (rq->rq_head + 1) % RXQ_SIZE;
+f010a0a3:	8b 86 00 01 00 00    	mov    0x100(%esi),%eax
+f010a0a9:	83 c0 01             	add    $0x1,%eax
+f010a0ac:	99                   	cltd
+f010a0ad:	c1 ea 1a             	shr    $0x1a,%edx
+f010a0b0:	01 d0                	add    %edx,%eax
+f010a0b2:	83 e0 3f             	and    $0x3f,%eax
+f010a0b5:	29 d0                	sub    %edx,%eax
+f010a0b7:	89 86 00 01 00 00    	mov    %eax,0x100(%esi)
+		rq->rq_n--;
+f010a0bd:	83 ae 04 01 00 00 01 	subl   $0x1,0x104(%esi)
+	for (i = 0; i < n && rq->rq_n > 0; i++, va += PGSIZE) {
+f010a0c4:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+f010a0c8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010a0cb:	81 45 0c 00 10 00 00 	addl   $0x1000,0xc(%ebp)
+f010a0d2:	39 45 10             	cmp    %eax,0x10(%ebp)
+f010a0d5:	0f 85 3f ff ff ff    	jne    f010a01a <receive_e1000_pages+0x3d>
+f010a0db:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010a0de:	eb 14                	jmp    f010a0f4 <receive_e1000_pages+0x117>
+	int i, r = -E_DESC_EMPTY;
+f010a0e0:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+f010a0e5:	eb 13                	jmp    f010a0fa <receive_e1000_pages+0x11d>
+			pp->pp_ref--;
+f010a0e7:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010a0ea:	66 83 6b 04 01       	subw   $0x1,0x4(%ebx)
+			break;
+f010a0ef:	eb 03                	jmp    f010a0f4 <receive_e1000_pages+0x117>
+f010a0f1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+	}
+	return i ? i : r;
+f010a0f4:	85 c9                	test   %ecx,%ecx
+f010a0f6:	0f 44 4d d0          	cmove  -0x30(%ebp),%ecx
+}
+f010a0fa:	89 c8                	mov    %ecx,%eax
+f010a0fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a0ff:	5b                   	pop    %ebx
+f010a100:	5e                   	pop    %esi
+f010a101:	5f                   	pop    %edi
+f010a102:	5d                   	pop    %ebp
+f010a103:	c3                   	ret
+			r = -E_INVAL;
+f010a104:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010a107:	c7 45 d0 fd ff ff ff 	movl   $0xfffffffd,-0x30(%ebp)
+f010a10e:	eb e4                	jmp    f010a0f4 <receive_e1000_pages+0x117>
+f010a110:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010a113:	c7 45 d0 fd ff ff ff 	movl   $0xfffffffd,-0x30(%ebp)
+f010a11a:	eb d8                	jmp    f010a0f4 <receive_e1000_pages+0x117>
+f010a11c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010a11f:	c7 45 d0 fd ff ff ff 	movl   $0xfffffffd,-0x30(%ebp)
+f010a126:	eb cc                	jmp    f010a0f4 <receive_e1000_pages+0x117>
+
+f010a128 <e1000_listen>:
+// Returns 0 on success, or
+//	-E_NO_MEM if the queue already listens on RXQ_LPORTS ports,
+//	-E_INVAL if the queue was not listening on 'port'.
+int
+e1000_listen(int q, uint16_t port, bool on)
+{
+f010a128:	55                   	push   %ebp
+f010a129:	89 e5                	mov    %esp,%ebp
+f010a12b:	57                   	push   %edi
+f010a12c:	56                   	push   %esi
+f010a12d:	53                   	push   %ebx
+f010a12e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f010a131:	89 fe                	mov    %edi,%esi
+	struct rx_queue *rq = &rx_queues[q];
+	int i, free = -1;
+
+	for (i = 0; i < RXQ_LPORTS; i++) {
+f010a133:	69 5d 08 24 01 00 00 	imul   $0x124,0x8(%ebp),%ebx
+	int i, free = -1;
+f010a13a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+	for (i = 0; i < RXQ_LPORTS; i++) {
+f010a13f:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a144:	eb 0d                	jmp    f010a153 <e1000_listen+0x2b>
+		if (rq->rq_lref[i] && rq->rq_lport[i] == port) {
+			rq->rq_lref[i] += on ? 1 : -1;
+			return 0;
+		}
+		if (!rq->rq_lref[i] && free < 0)
+f010a146:	85 c9                	test   %ecx,%ecx
+f010a148:	0f 48 c8             	cmovs  %eax,%ecx
+	for (i = 0; i < RXQ_LPORTS; i++) {
+f010a14b:	83 c0 01             	add    $0x1,%eax
+f010a14e:	83 f8 08             	cmp    $0x8,%eax
+f010a151:	74 36                	je     f010a189 <e1000_listen+0x61>
+		if (rq->rq_lref[i] && rq->rq_lport[i] == port) {
+f010a153:	0f b6 94 03 fc e7 92 	movzbl -0xf6d1804(%ebx,%eax,1),%edx
+f010a15a:	f0 
+f010a15b:	84 d2                	test   %dl,%dl
+f010a15d:	74 e7                	je     f010a146 <e1000_listen+0x1e>
+f010a15f:	66 39 b4 43 ec e7 92 	cmp    %si,-0xf6d1814(%ebx,%eax,2)
+f010a166:	f0 
+f010a167:	75 e2                	jne    f010a14b <e1000_listen+0x23>
+			rq->rq_lref[i] += on ? 1 : -1;
+f010a169:	83 7d 10 01          	cmpl   $0x1,0x10(%ebp)
+f010a16d:	19 c9                	sbb    %ecx,%ecx
+f010a16f:	83 c9 01             	or     $0x1,%ecx
+f010a172:	69 5d 08 24 01 00 00 	imul   $0x124,0x8(%ebp),%ebx
+f010a179:	01 ca                	add    %ecx,%edx
+f010a17b:	88 94 18 fc e7 92 f0 	mov    %dl,-0xf6d1804(%eax,%ebx,1)
+			return 0;
+f010a182:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a187:	eb 34                	jmp    f010a1bd <e1000_listen+0x95>
+			free = i;
+	}
+	if (!on)
+f010a189:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f010a18d:	74 33                	je     f010a1c2 <e1000_listen+0x9a>
+		return -E_INVAL;
+	if (free < 0)
+f010a18f:	85 c9                	test   %ecx,%ecx
+f010a191:	78 36                	js     f010a1c9 <e1000_listen+0xa1>
+		return -E_NO_MEM;
+	rq->rq_lport[free] = port;
+f010a193:	69 45 08 92 00 00 00 	imul   $0x92,0x8(%ebp),%eax
+f010a19a:	8d 84 01 80 00 00 00 	lea    0x80(%ecx,%eax,1),%eax
+f010a1a1:	66 89 bc 00 ec e6 92 	mov    %di,-0xf6d1914(%eax,%eax,1)
+f010a1a8:	f0 
+	rq->rq_lref[free] = 1;
+f010a1a9:	69 45 08 24 01 00 00 	imul   $0x124,0x8(%ebp),%eax
+f010a1b0:	c6 84 01 fc e7 92 f0 	movb   $0x1,-0xf6d1804(%ecx,%eax,1)
+f010a1b7:	01 
+	return 0;
+f010a1b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a1bd:	5b                   	pop    %ebx
+f010a1be:	5e                   	pop    %esi
+f010a1bf:	5f                   	pop    %edi
+f010a1c0:	5d                   	pop    %ebp
+f010a1c1:	c3                   	ret
+		return -E_INVAL;
+f010a1c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a1c7:	eb f4                	jmp    f010a1bd <e1000_listen+0x95>
+		return -E_NO_MEM;
+f010a1c9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a1ce:	eb ed                	jmp    f010a1bd <e1000_listen+0x95>
+
+f010a1d0 <transmit_e1000_batch>:
+//	-E_DESC_FULL if the ring has no room at all,
+//	-E_INVAL if the first packet is too long,
+//	-E_FAULT if the first packet is not readable by 'e'.
+int
+transmit_e1000_batch(struct Env *e, struct NetFrag *frames, int n)
+{
+f010a1d0:	55                   	push   %ebp
+f010a1d1:	89 e5                	mov    %esp,%ebp
+f010a1d3:	57                   	push   %edi
+f010a1d4:	56                   	push   %esi
+f010a1d5:	53                   	push   %ebx
+f010a1d6:	83 ec 1c             	sub    $0x1c,%esp
+f010a1d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int i, next, nfree;
+	size_t len;
+
+	tx_reclaim();
+f010a1dc:	e8 da eb ff ff       	call   f0108dbb <tx_reclaim>
+	nfree = tx_free();
+f010a1e1:	e8 8f e9 ff ff       	call   f0108b75 <tx_free>
+	next = e100[E1000_TDT/sizeof(uint32_t)];
+f010a1e6:	8b 15 e8 f3 92 f0    	mov    0xf092f3e8,%edx
+f010a1ec:	8b 8a 18 38 00 00    	mov    0x3818(%edx),%ecx
+f010a1f2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	for (i = 0; i < n && i < nfree; i++) {
+f010a1f5:	39 d8                	cmp    %ebx,%eax
+f010a1f7:	89 d9                	mov    %ebx,%ecx
+f010a1f9:	0f 4e c8             	cmovle %eax,%ecx
+f010a1fc:	85 c9                	test   %ecx,%ecx
+f010a1fe:	0f 8e 0a 01 00 00    	jle    f010a30e <transmit_e1000_batch+0x13e>
+f010a204:	be 00 00 00 00       	mov    $0x0,%esi
+f010a209:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+		len = frames[i].nf_len;
+f010a20c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a20f:	8b 5c f0 04          	mov    0x4(%eax,%esi,8),%ebx
+		if (len > MAX_PACKET_SIZE) {
+f010a213:	81 fb ee 05 00 00    	cmp    $0x5ee,%ebx
+f010a219:	0f 87 b3 00 00 00    	ja     f010a2d2 <transmit_e1000_batch+0x102>
+			if (i == 0)
+				return -E_INVAL;
+			break;
+		}
+		if (user_mem_check(e, frames[i].nf_va, len, PTE_U | PTE_P) < 0) {
+f010a21f:	6a 05                	push   $0x5
+f010a221:	53                   	push   %ebx
+f010a222:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a225:	ff 34 f0             	push   (%eax,%esi,8)
+f010a228:	ff 75 08             	push   0x8(%ebp)
+f010a22b:	e8 00 99 ff ff       	call   f0103b30 <user_mem_check>
+f010a230:	83 c4 10             	add    $0x10,%esp
+f010a233:	85 c0                	test   %eax,%eax
+f010a235:	0f 88 b3 00 00 00    	js     f010a2ee <transmit_e1000_batch+0x11e>
+			if (i == 0)
+				return -E_FAULT;
+			break;
+		}
+		memmove(tx_buffer(next), frames[i].nf_va, len);
+f010a23b:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a23e:	8b 3c f0             	mov    (%eax,%esi,8),%edi
+f010a241:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a244:	e8 d1 ed ff ff       	call   f010901a <tx_buffer>
+f010a249:	83 ec 04             	sub    $0x4,%esp
+f010a24c:	53                   	push   %ebx
+f010a24d:	57                   	push   %edi
+f010a24e:	50                   	push   %eax
+f010a24f:	e8 7f da ff ff       	call   f0107cd3 <memmove>
+		tx_post(next, PADDR(tx_buffer(next)), len, E1000_TXD_CMD_EOP, 0);
+f010a254:	0f b7 fb             	movzwl %bx,%edi
+f010a257:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a25a:	e8 bb ed ff ff       	call   f010901a <tx_buffer>
+	if ((uint32_t)kva < KERNBASE)
+f010a25f:	83 c4 10             	add    $0x10,%esp
+f010a262:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010a267:	0f 86 8c 00 00 00    	jbe    f010a2f9 <transmit_e1000_batch+0x129>
+	return (physaddr_t)kva - KERNBASE;
+f010a26d:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f010a273:	83 ec 08             	sub    $0x8,%esp
+f010a276:	6a 00                	push   $0x0
+f010a278:	6a 01                	push   $0x1
+f010a27a:	89 f9                	mov    %edi,%ecx
+f010a27c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010a27f:	89 f8                	mov    %edi,%eax
+f010a281:	e8 8c e8 ff ff       	call   f0108b12 <tx_post>
+		tx_learn(e->env_netq, tx_buffer(next), len);
+f010a286:	89 f8                	mov    %edi,%eax
+f010a288:	e8 8d ed ff ff       	call   f010901a <tx_buffer>
+f010a28d:	89 c2                	mov    %eax,%edx
+f010a28f:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a292:	8b 40 6c             	mov    0x6c(%eax),%eax
+f010a295:	89 d9                	mov    %ebx,%ecx
+f010a297:	e8 92 ec ff ff       	call   f0108f2e <tx_learn>
+		e1000_stats.ns_tx_packets++;
+f010a29c:	83 05 4c 10 97 f0 01 	addl   $0x1,0xf097104c
+		e1000_stats.ns_tx_bytes += len;
+f010a2a3:	01 1d 50 10 97 f0    	add    %ebx,0xf0971050
+		e1000_stats.ns_tx_copies++;
+f010a2a9:	83 05 54 10 97 f0 01 	addl   $0x1,0xf0971054
+		next = (next + 1) % ntx;
+f010a2b0:	89 f8                	mov    %edi,%eax
+f010a2b2:	83 c0 01             	add    $0x1,%eax
+f010a2b5:	99                   	cltd
+f010a2b6:	f7 3d 9c 10 97 f0    	idivl  0xf097109c
+f010a2bc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	for (i = 0; i < n && i < nfree; i++) {
+f010a2bf:	83 c6 01             	add    $0x1,%esi
+f010a2c2:	83 c4 10             	add    $0x10,%esp
+f010a2c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a2c8:	39 c6                	cmp    %eax,%esi
+f010a2ca:	0f 85 3c ff ff ff    	jne    f010a20c <transmit_e1000_batch+0x3c>
+f010a2d0:	eb 04                	jmp    f010a2d6 <transmit_e1000_batch+0x106>
+			if (i == 0)
+f010a2d2:	85 f6                	test   %esi,%esi
+f010a2d4:	74 3f                	je     f010a315 <transmit_e1000_batch+0x145>
+	}
+	if (i == 0)
+		return -E_DESC_FULL;
+	e100[E1000_TDT/sizeof(uint32_t)] = next;
+f010a2d6:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f010a2db:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010a2de:	89 88 18 38 00 00    	mov    %ecx,0x3818(%eax)
+	return i;
+}
+f010a2e4:	89 f0                	mov    %esi,%eax
+f010a2e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a2e9:	5b                   	pop    %ebx
+f010a2ea:	5e                   	pop    %esi
+f010a2eb:	5f                   	pop    %edi
+f010a2ec:	5d                   	pop    %ebp
+f010a2ed:	c3                   	ret
+			if (i == 0)
+f010a2ee:	85 f6                	test   %esi,%esi
+f010a2f0:	75 e4                	jne    f010a2d6 <transmit_e1000_batch+0x106>
+				return -E_FAULT;
+f010a2f2:	be fa ff ff ff       	mov    $0xfffffffa,%esi
+f010a2f7:	eb eb                	jmp    f010a2e4 <transmit_e1000_batch+0x114>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010a2f9:	50                   	push   %eax
+f010a2fa:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f010a2ff:	68 50 03 00 00       	push   $0x350
+f010a304:	68 c0 ce 10 f0       	push   $0xf010cec0
+f010a309:	e8 32 5d ff ff       	call   f0100040 <_panic>
+		return -E_DESC_FULL;
+f010a30e:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f010a313:	eb cf                	jmp    f010a2e4 <transmit_e1000_batch+0x114>
+				return -E_INVAL;
+f010a315:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010a31a:	eb c8                	jmp    f010a2e4 <transmit_e1000_batch+0x114>
+
+f010a31c <e1000_rx_wait>:
+// re-executes the system call that blocked it.
+// Returns 0 on success, -E_BUSY if another env is already blocked on
+// the queue (each queue wakes only one).
+int
+e1000_rx_wait(struct Env *e)
+{
+f010a31c:	55                   	push   %ebp
+f010a31d:	89 e5                	mov    %esp,%ebp
+f010a31f:	56                   	push   %esi
+f010a320:	53                   	push   %ebx
+f010a321:	83 ec 10             	sub    $0x10,%esp
+f010a324:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct rx_queue *rq = &rx_queues[e->env_netq];
+f010a327:	8b 73 6c             	mov    0x6c(%ebx),%esi
+	struct Env *w;
+
+	if (rq->rq_waiter && rq->rq_waiter != e->env_id
+f010a32a:	69 c6 24 01 00 00    	imul   $0x124,%esi,%eax
+f010a330:	8b 80 e8 e7 92 f0    	mov    -0xf6d1818(%eax),%eax
+f010a336:	85 c0                	test   %eax,%eax
+f010a338:	74 05                	je     f010a33f <e1000_rx_wait+0x23>
+f010a33a:	3b 43 48             	cmp    0x48(%ebx),%eax
+f010a33d:	75 26                	jne    f010a365 <e1000_rx_wait+0x49>
+	    && envid2env(rq->rq_waiter, &w, 0) == 0
+	    && w->env_status == ENV_NOT_RUNNABLE)
+		return -E_BUSY;
+	rq->rq_waiter = e->env_id;
+f010a33f:	8b 43 48             	mov    0x48(%ebx),%eax
+f010a342:	69 f6 24 01 00 00    	imul   $0x124,%esi,%esi
+f010a348:	89 86 e8 e7 92 f0    	mov    %eax,-0xf6d1818(%esi)
+	e->env_status = ENV_NOT_RUNNABLE;
+f010a34e:	c7 43 54 04 00 00 00 	movl   $0x4,0x54(%ebx)
+	e->env_tf.tf_eip -= 2;		// size of "int $T_SYSCALL"
+f010a355:	83 6b 30 02          	subl   $0x2,0x30(%ebx)
+	return 0;
+f010a359:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a35e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a361:	5b                   	pop    %ebx
+f010a362:	5e                   	pop    %esi
+f010a363:	5d                   	pop    %ebp
+f010a364:	c3                   	ret
+	    && envid2env(rq->rq_waiter, &w, 0) == 0
+f010a365:	83 ec 04             	sub    $0x4,%esp
+f010a368:	6a 00                	push   $0x0
+f010a36a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f010a36d:	52                   	push   %edx
+f010a36e:	50                   	push   %eax
+f010a36f:	e8 cf 99 ff ff       	call   f0103d43 <envid2env>
+f010a374:	83 c4 10             	add    $0x10,%esp
+f010a377:	85 c0                	test   %eax,%eax
+f010a379:	75 c4                	jne    f010a33f <e1000_rx_wait+0x23>
+	    && w->env_status == ENV_NOT_RUNNABLE)
+f010a37b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010a37e:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f010a382:	75 bb                	jne    f010a33f <e1000_rx_wait+0x23>
+		return -E_BUSY;
+f010a384:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+f010a389:	eb d3                	jmp    f010a35e <e1000_rx_wait+0x42>
+
+f010a38b <e1000_intr>:
+{
+	struct rx_queue *rq;
+	struct Env *e;
+	uint32_t icr;
+
+	icr = e100[E1000_ICR/sizeof(uint32_t)];	// reading acknowledges
+f010a38b:	a1 e8 f3 92 f0       	mov    0xf092f3e8,%eax
+f010a390:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+	if (!(icr & E1000_IMS_RX))
+f010a396:	a8 d0                	test   $0xd0,%al
+f010a398:	75 01                	jne    f010a39b <e1000_intr+0x10>
+f010a39a:	c3                   	ret
+{
+f010a39b:	55                   	push   %ebp
+f010a39c:	89 e5                	mov    %esp,%ebp
+f010a39e:	56                   	push   %esi
+f010a39f:	53                   	push   %ebx
+f010a3a0:	83 ec 10             	sub    $0x10,%esp
+		return;
+	e1000_stats.ns_rx_ready_max = MAX(e1000_stats.ns_rx_ready_max, rx_ready());
+f010a3a3:	8b 1d 70 10 97 f0    	mov    0xf0971070,%ebx
+f010a3a9:	e8 e8 e7 ff ff       	call   f0108b96 <rx_ready>
+f010a3ae:	39 d8                	cmp    %ebx,%eax
+f010a3b0:	0f 42 c3             	cmovb  %ebx,%eax
+f010a3b3:	a3 70 10 97 f0       	mov    %eax,0xf0971070
+	rx_steer();
+f010a3b8:	e8 b8 ec ff ff       	call   f0109075 <rx_steer>
+	for (rq = rx_queues; rq < rx_queues + e1000_nq; rq++) {
+f010a3bd:	69 05 d4 87 11 f0 24 	imul   $0x124,0xf01187d4,%eax
+f010a3c4:	01 00 00 
+f010a3c7:	05 e0 e6 92 f0       	add    $0xf092e6e0,%eax
+f010a3cc:	3d e0 e6 92 f0       	cmp    $0xf092e6e0,%eax
+f010a3d1:	76 65                	jbe    f010a438 <e1000_intr+0xad>
+f010a3d3:	bb e0 e6 92 f0       	mov    $0xf092e6e0,%ebx
+		if (!rq->rq_waiter || rq->rq_n == 0)
+			continue;
+		if (envid2env(rq->rq_waiter, &e, 0) == 0
+f010a3d8:	8d 75 f4             	lea    -0xc(%ebp),%esi
+f010a3db:	eb 23                	jmp    f010a400 <e1000_intr+0x75>
+		    && e->env_status == ENV_NOT_RUNNABLE)
+			e->env_status = ENV_RUNNABLE;
+		rq->rq_waiter = 0;
+f010a3dd:	c7 83 08 01 00 00 00 	movl   $0x0,0x108(%ebx)
+f010a3e4:	00 00 00 
+	for (rq = rx_queues; rq < rx_queues + e1000_nq; rq++) {
+f010a3e7:	81 c3 24 01 00 00    	add    $0x124,%ebx
+f010a3ed:	69 05 d4 87 11 f0 24 	imul   $0x124,0xf01187d4,%eax
+f010a3f4:	01 00 00 
+f010a3f7:	05 e0 e6 92 f0       	add    $0xf092e6e0,%eax
+f010a3fc:	39 c3                	cmp    %eax,%ebx
+f010a3fe:	73 38                	jae    f010a438 <e1000_intr+0xad>
+		if (!rq->rq_waiter || rq->rq_n == 0)
+f010a400:	8b 83 08 01 00 00    	mov    0x108(%ebx),%eax
+f010a406:	85 c0                	test   %eax,%eax
+f010a408:	74 dd                	je     f010a3e7 <e1000_intr+0x5c>
+f010a40a:	83 bb 04 01 00 00 00 	cmpl   $0x0,0x104(%ebx)
+f010a411:	74 d4                	je     f010a3e7 <e1000_intr+0x5c>
+		if (envid2env(rq->rq_waiter, &e, 0) == 0
+f010a413:	83 ec 04             	sub    $0x4,%esp
+f010a416:	6a 00                	push   $0x0
+f010a418:	56                   	push   %esi
+f010a419:	50                   	push   %eax
+f010a41a:	e8 24 99 ff ff       	call   f0103d43 <envid2env>
+f010a41f:	83 c4 10             	add    $0x10,%esp
+f010a422:	85 c0                	test   %eax,%eax
+f010a424:	75 b7                	jne    f010a3dd <e1000_intr+0x52>
+		    && e->env_status == ENV_NOT_RUNNABLE)
+f010a426:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010a429:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f010a42d:	75 ae                	jne    f010a3dd <e1000_intr+0x52>
+			e->env_status = ENV_RUNNABLE;
+f010a42f:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f010a436:	eb a5                	jmp    f010a3dd <e1000_intr+0x52>
+	}
+}
+f010a438:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a43b:	5b                   	pop    %ebx
+f010a43c:	5e                   	pop    %esi
+f010a43d:	5d                   	pop    %ebp
+f010a43e:	c3                   	ret
+
+f010a43f <e1000_get_stats>:
+
+// Fill in 'ns' with the driver's counters and the current ring state.
+void
+e1000_get_stats(struct NetStats *ns)
+{
+f010a43f:	55                   	push   %ebp
+f010a440:	89 e5                	mov    %esp,%ebp
+f010a442:	57                   	push   %edi
+f010a443:	56                   	push   %esi
+f010a444:	53                   	push   %ebx
+f010a445:	83 ec 1c             	sub    $0x1c,%esp
+f010a448:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int tx_inuse;
+
+	tx_reclaim();
+f010a44b:	e8 6b e9 ff ff       	call   f0108dbb <tx_reclaim>
+	tx_inuse = ntx - 1 - tx_free();
+f010a450:	a1 9c 10 97 f0       	mov    0xf097109c,%eax
+f010a455:	89 c7                	mov    %eax,%edi
+f010a457:	e8 19 e7 ff ff       	call   f0108b75 <tx_free>
+f010a45c:	89 c2                	mov    %eax,%edx
+f010a45e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010a461:	89 f8                	mov    %edi,%eax
+f010a463:	83 e8 01             	sub    $0x1,%eax
+f010a466:	29 d0                	sub    %edx,%eax
+	e1000_stats.ns_tx_inuse_max = MAX(e1000_stats.ns_tx_inuse_max, tx_inuse);
+f010a468:	be 40 10 97 f0       	mov    $0xf0971040,%esi
+f010a46d:	8b 15 64 10 97 f0    	mov    0xf0971064,%edx
+f010a473:	39 c2                	cmp    %eax,%edx
+f010a475:	0f 42 d0             	cmovb  %eax,%edx
+f010a478:	89 15 64 10 97 f0    	mov    %edx,0xf0971064
+	e1000_stats.ns_rx_missed += e100[E1000_MPC/sizeof(uint32_t)];
+f010a47e:	8b 15 e8 f3 92 f0    	mov    0xf092f3e8,%edx
+f010a484:	8b 92 10 40 00 00    	mov    0x4010(%edx),%edx
+f010a48a:	01 15 58 10 97 f0    	add    %edx,0xf0971058
+	*ns = e1000_stats;
+f010a490:	b9 17 00 00 00       	mov    $0x17,%ecx
+f010a495:	89 df                	mov    %ebx,%edi
+f010a497:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	ns->ns_tx_ring = ntx;
+f010a499:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010a49c:	89 4b 1c             	mov    %ecx,0x1c(%ebx)
+	ns->ns_rx_ring = nrx;
+f010a49f:	8b 15 24 10 97 f0    	mov    0xf0971024,%edx
+f010a4a5:	89 53 28             	mov    %edx,0x28(%ebx)
+	ns->ns_tx_inuse = tx_inuse;
+f010a4a8:	89 43 20             	mov    %eax,0x20(%ebx)
+	ns->ns_rx_ready = rx_ready();
+f010a4ab:	e8 e6 e6 ff ff       	call   f0108b96 <rx_ready>
+f010a4b0:	89 43 2c             	mov    %eax,0x2c(%ebx)
+	ns->ns_rx_queues = e1000_nq;
+f010a4b3:	a1 d4 87 11 f0       	mov    0xf01187d4,%eax
+f010a4b8:	89 43 44             	mov    %eax,0x44(%ebx)
+}
+f010a4bb:	83 c4 1c             	add    $0x1c,%esp
+f010a4be:	5b                   	pop    %ebx
+f010a4bf:	5e                   	pop    %esi
+f010a4c0:	5f                   	pop    %edi
+f010a4c1:	5d                   	pop    %ebp
+f010a4c2:	c3                   	ret
+
+f010a4c3 <pci_attach_match>:
+}
+
+static int __attribute__((warn_unused_result))
+pci_attach_match(uint32_t key1, uint32_t key2,
+		 struct pci_driver *list, struct pci_func *pcif)
+{
+f010a4c3:	55                   	push   %ebp
+f010a4c4:	89 e5                	mov    %esp,%ebp
+f010a4c6:	57                   	push   %edi
+f010a4c7:	56                   	push   %esi
+f010a4c8:	53                   	push   %ebx
+f010a4c9:	83 ec 1c             	sub    $0x1c,%esp
+f010a4cc:	89 c6                	mov    %eax,%esi
+f010a4ce:	89 d7                	mov    %edx,%edi
+f010a4d0:	89 cb                	mov    %ecx,%ebx
+	uint32_t i;
+
+	for (i = 0; list[i].attachfn; i++) {
+f010a4d2:	8b 41 08             	mov    0x8(%ecx),%eax
+f010a4d5:	85 c0                	test   %eax,%eax
+f010a4d7:	75 17                	jne    f010a4f0 <pci_attach_match+0x2d>
+				cprintf("pci_attach_match: attaching "
+					"%x.%x (%p): e\n",
+					key1, key2, list[i].attachfn, r);
+		}
+	}
+	return 0;
+f010a4d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a4de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a4e1:	5b                   	pop    %ebx
+f010a4e2:	5e                   	pop    %esi
+f010a4e3:	5f                   	pop    %edi
+f010a4e4:	5d                   	pop    %ebp
+f010a4e5:	c3                   	ret
+	for (i = 0; list[i].attachfn; i++) {
+f010a4e6:	83 c3 0c             	add    $0xc,%ebx
+f010a4e9:	8b 43 08             	mov    0x8(%ebx),%eax
+f010a4ec:	85 c0                	test   %eax,%eax
+f010a4ee:	74 ee                	je     f010a4de <pci_attach_match+0x1b>
+		if (list[i].key1 == key1 && list[i].key2 == key2) {
+f010a4f0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f010a4f3:	39 33                	cmp    %esi,(%ebx)
+f010a4f5:	75 ef                	jne    f010a4e6 <pci_attach_match+0x23>
+f010a4f7:	39 7b 04             	cmp    %edi,0x4(%ebx)
+f010a4fa:	75 ea                	jne    f010a4e6 <pci_attach_match+0x23>
+			int r = list[i].attachfn(pcif);
+f010a4fc:	83 ec 0c             	sub    $0xc,%esp
+f010a4ff:	ff 75 08             	push   0x8(%ebp)
+f010a502:	ff d0                	call   *%eax
+			if (r > 0)
+f010a504:	83 c4 10             	add    $0x10,%esp
+f010a507:	85 c0                	test   %eax,%eax
+f010a509:	7f d3                	jg     f010a4de <pci_attach_match+0x1b>
+			if (r < 0)
+f010a50b:	79 d9                	jns    f010a4e6 <pci_attach_match+0x23>
+				cprintf("pci_attach_match: attaching "
+f010a50d:	83 ec 0c             	sub    $0xc,%esp
+f010a510:	50                   	push   %eax
+f010a511:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a514:	ff 70 08             	push   0x8(%eax)
+f010a517:	57                   	push   %edi
+f010a518:	56                   	push   %esi
+f010a519:	68 68 cf 10 f0       	push   $0xf010cf68
+f010a51e:	e8 c9 a1 ff ff       	call   f01046ec <cprintf>
+f010a523:	83 c4 20             	add    $0x20,%esp
+f010a526:	eb be                	jmp    f010a4e6 <pci_attach_match+0x23>
+
+f010a528 <pci_conf1_set_addr>:
+{
+f010a528:	55                   	push   %ebp
+f010a529:	89 e5                	mov    %esp,%ebp
+f010a52b:	56                   	push   %esi
+f010a52c:	53                   	push   %ebx
+f010a52d:	8b 75 08             	mov    0x8(%ebp),%esi
+	assert(bus < 256);
+f010a530:	3d ff 00 00 00       	cmp    $0xff,%eax
+f010a535:	77 3b                	ja     f010a572 <pci_conf1_set_addr+0x4a>
+	assert(dev < 32);
+f010a537:	83 fa 1f             	cmp    $0x1f,%edx
+f010a53a:	77 4c                	ja     f010a588 <pci_conf1_set_addr+0x60>
+	assert(func < 8);
+f010a53c:	83 f9 07             	cmp    $0x7,%ecx
+f010a53f:	77 5d                	ja     f010a59e <pci_conf1_set_addr+0x76>
+	assert(offset < 256);
+f010a541:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+f010a547:	77 6b                	ja     f010a5b4 <pci_conf1_set_addr+0x8c>
+	assert((offset & 0x3) == 0);
+f010a549:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f010a54f:	75 79                	jne    f010a5ca <pci_conf1_set_addr+0xa2>
+		(bus << 16) | (dev << 11) | (func << 8) | (offset);
+f010a551:	c1 e0 10             	shl    $0x10,%eax
+f010a554:	09 f0                	or     %esi,%eax
+f010a556:	c1 e1 08             	shl    $0x8,%ecx
+f010a559:	09 c8                	or     %ecx,%eax
+f010a55b:	c1 e2 0b             	shl    $0xb,%edx
+f010a55e:	09 d0                	or     %edx,%eax
+	uint32_t v = (1 << 31) |		// config-space
+f010a560:	0d 00 00 00 80       	or     $0x80000000,%eax
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010a565:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f010a56a:	ef                   	out    %eax,(%dx)
+}
+f010a56b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a56e:	5b                   	pop    %ebx
+f010a56f:	5e                   	pop    %esi
+f010a570:	5d                   	pop    %ebp
+f010a571:	c3                   	ret
+	assert(bus < 256);
+f010a572:	68 bf d0 10 f0       	push   $0xf010d0bf
+f010a577:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010a57c:	6a 2b                	push   $0x2b
+f010a57e:	68 c9 d0 10 f0       	push   $0xf010d0c9
+f010a583:	e8 b8 5a ff ff       	call   f0100040 <_panic>
+	assert(dev < 32);
+f010a588:	68 d4 d0 10 f0       	push   $0xf010d0d4
+f010a58d:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010a592:	6a 2c                	push   $0x2c
+f010a594:	68 c9 d0 10 f0       	push   $0xf010d0c9
+f010a599:	e8 a2 5a ff ff       	call   f0100040 <_panic>
+	assert(func < 8);
+f010a59e:	68 dd d0 10 f0       	push   $0xf010d0dd
+f010a5a3:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010a5a8:	6a 2d                	push   $0x2d
+f010a5aa:	68 c9 d0 10 f0       	push   $0xf010d0c9
+f010a5af:	e8 8c 5a ff ff       	call   f0100040 <_panic>
+	assert(offset < 256);
+f010a5b4:	68 e6 d0 10 f0       	push   $0xf010d0e6
+f010a5b9:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010a5be:	6a 2e                	push   $0x2e
+f010a5c0:	68 c9 d0 10 f0       	push   $0xf010d0c9
+f010a5c5:	e8 76 5a ff ff       	call   f0100040 <_panic>
+	assert((offset & 0x3) == 0);
+f010a5ca:	68 f3 d0 10 f0       	push   $0xf010d0f3
+f010a5cf:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f010a5d4:	6a 2f                	push   $0x2f
+f010a5d6:	68 c9 d0 10 f0       	push   $0xf010d0c9
+f010a5db:	e8 60 5a ff ff       	call   f0100040 <_panic>
+
+f010a5e0 <pci_conf_read>:
+{
+f010a5e0:	55                   	push   %ebp
+f010a5e1:	89 e5                	mov    %esp,%ebp
+f010a5e3:	53                   	push   %ebx
+f010a5e4:	83 ec 10             	sub    $0x10,%esp
+f010a5e7:	89 d3                	mov    %edx,%ebx
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f010a5e9:	8b 48 08             	mov    0x8(%eax),%ecx
+f010a5ec:	8b 50 04             	mov    0x4(%eax),%edx
+f010a5ef:	8b 00                	mov    (%eax),%eax
+f010a5f1:	8b 40 04             	mov    0x4(%eax),%eax
+f010a5f4:	53                   	push   %ebx
+f010a5f5:	e8 2e ff ff ff       	call   f010a528 <pci_conf1_set_addr>
+	__asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f010a5fa:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010a5ff:	ed                   	in     (%dx),%eax
+}
+f010a600:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a603:	c9                   	leave
+f010a604:	c3                   	ret
+
+f010a605 <pci_scan_bus>:
+		f->irq_line);
+}
+
+static int
+pci_scan_bus(struct pci_bus *bus)
+{
+f010a605:	55                   	push   %ebp
+f010a606:	89 e5                	mov    %esp,%ebp
+f010a608:	57                   	push   %edi
+f010a609:	56                   	push   %esi
+f010a60a:	53                   	push   %ebx
+f010a60b:	81 ec 00 01 00 00    	sub    $0x100,%esp
+f010a611:	89 c3                	mov    %eax,%ebx
+	int totaldev = 0;
+	struct pci_func df;
+	memset(&df, 0, sizeof(df));
+f010a613:	6a 48                	push   $0x48
+f010a615:	6a 00                	push   $0x0
+f010a617:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010a61a:	50                   	push   %eax
+f010a61b:	e8 7e d6 ff ff       	call   f0107c9e <memset>
+	df.bus = bus;
+f010a620:	89 5d a0             	mov    %ebx,-0x60(%ebp)
+
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010a623:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+f010a62a:	83 c4 10             	add    $0x10,%esp
+	int totaldev = 0;
+f010a62d:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f010a634:	00 00 00 
+f010a637:	e9 46 01 00 00       	jmp    f010a782 <pci_scan_bus+0x17d>
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f010a63c:	83 ec 08             	sub    $0x8,%esp
+f010a63f:	89 fa                	mov    %edi,%edx
+f010a641:	0f b6 fa             	movzbl %dl,%edi
+f010a644:	57                   	push   %edi
+f010a645:	51                   	push   %ecx
+		PCI_CLASS(f->dev_class), PCI_SUBCLASS(f->dev_class), class,
+f010a646:	c1 e8 10             	shr    $0x10,%eax
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f010a649:	0f b6 c0             	movzbl %al,%eax
+f010a64c:	50                   	push   %eax
+f010a64d:	ff b5 00 ff ff ff    	push   -0x100(%ebp)
+f010a653:	c1 ee 10             	shr    $0x10,%esi
+f010a656:	56                   	push   %esi
+f010a657:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+f010a65d:	53                   	push   %ebx
+f010a65e:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+f010a664:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f010a66a:	ff 70 04             	push   0x4(%eax)
+f010a66d:	68 94 cf 10 f0       	push   $0xf010cf94
+f010a672:	e8 75 a0 ff ff       	call   f01046ec <cprintf>
+				 PCI_SUBCLASS(f->dev_class),
+f010a677:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f010a67d:	83 c4 24             	add    $0x24,%esp
+				 PCI_SUBCLASS(f->dev_class),
+f010a680:	89 c2                	mov    %eax,%edx
+f010a682:	c1 ea 10             	shr    $0x10,%edx
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f010a685:	0f b6 d2             	movzbl %dl,%edx
+f010a688:	c1 e8 18             	shr    $0x18,%eax
+f010a68b:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+f010a691:	51                   	push   %ecx
+f010a692:	b9 f0 87 11 f0       	mov    $0xf01187f0,%ecx
+f010a697:	e8 27 fe ff ff       	call   f010a4c3 <pci_attach_match>
+				 &pci_attach_class[0], f) ||
+f010a69c:	83 c4 10             	add    $0x10,%esp
+f010a69f:	85 c0                	test   %eax,%eax
+f010a6a1:	0f 84 a3 00 00 00    	je     f010a74a <pci_scan_bus+0x145>
+
+		totaldev++;
+
+		struct pci_func f = df;
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+		     f.func++) {
+f010a6a7:	83 c3 01             	add    $0x1,%ebx
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f010a6aa:	89 9d 18 ff ff ff    	mov    %ebx,-0xe8(%ebp)
+f010a6b0:	8b 85 fc fe ff ff    	mov    -0x104(%ebp),%eax
+f010a6b6:	39 c3                	cmp    %eax,%ebx
+f010a6b8:	0f 83 b6 00 00 00    	jae    f010a774 <pci_scan_bus+0x16f>
+			struct pci_func af = f;
+f010a6be:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010a6c4:	8d b5 10 ff ff ff    	lea    -0xf0(%ebp),%esi
+f010a6ca:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010a6cf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+
+			af.dev_id = pci_conf_read(&f, PCI_ID_REG);
+f010a6d1:	ba 00 00 00 00       	mov    $0x0,%edx
+f010a6d6:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+f010a6dc:	e8 ff fe ff ff       	call   f010a5e0 <pci_conf_read>
+f010a6e1:	89 c6                	mov    %eax,%esi
+f010a6e3:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+			if (PCI_VENDOR(af.dev_id) == 0xffff)
+f010a6e9:	0f b7 c0             	movzwl %ax,%eax
+f010a6ec:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+f010a6f2:	66 83 fe ff          	cmp    $0xffff,%si
+f010a6f6:	74 af                	je     f010a6a7 <pci_scan_bus+0xa2>
+				continue;
+
+			uint32_t intr = pci_conf_read(&af, PCI_INTERRUPT_REG);
+f010a6f8:	ba 3c 00 00 00       	mov    $0x3c,%edx
+f010a6fd:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010a703:	e8 d8 fe ff ff       	call   f010a5e0 <pci_conf_read>
+f010a708:	89 c7                	mov    %eax,%edi
+			af.irq_line = PCI_INTERRUPT_LINE(intr);
+f010a70a:	88 45 9c             	mov    %al,-0x64(%ebp)
+
+			af.dev_class = pci_conf_read(&af, PCI_CLASS_REG);
+f010a70d:	ba 08 00 00 00       	mov    $0x8,%edx
+f010a712:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010a718:	e8 c3 fe ff ff       	call   f010a5e0 <pci_conf_read>
+f010a71d:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+	if (PCI_CLASS(f->dev_class) < sizeof(pci_class) / sizeof(pci_class[0]))
+f010a723:	89 c2                	mov    %eax,%edx
+f010a725:	c1 ea 18             	shr    $0x18,%edx
+f010a728:	89 95 00 ff ff ff    	mov    %edx,-0x100(%ebp)
+	const char *class = pci_class[0];
+f010a72e:	b9 07 d1 10 f0       	mov    $0xf010d107,%ecx
+	if (PCI_CLASS(f->dev_class) < sizeof(pci_class) / sizeof(pci_class[0]))
+f010a733:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+f010a738:	0f 87 fe fe ff ff    	ja     f010a63c <pci_scan_bus+0x37>
+		class = pci_class[PCI_CLASS(f->dev_class)];
+f010a73e:	8b 0c 95 7c d1 10 f0 	mov    -0xfef2e84(,%edx,4),%ecx
+f010a745:	e9 f2 fe ff ff       	jmp    f010a63c <pci_scan_bus+0x37>
+				 PCI_PRODUCT(f->dev_id),
+f010a74a:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+		pci_attach_match(PCI_VENDOR(f->dev_id),
+f010a750:	89 c2                	mov    %eax,%edx
+f010a752:	c1 ea 10             	shr    $0x10,%edx
+f010a755:	0f b7 c0             	movzwl %ax,%eax
+f010a758:	83 ec 0c             	sub    $0xc,%esp
+f010a75b:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010a761:	57                   	push   %edi
+f010a762:	b9 d8 87 11 f0       	mov    $0xf01187d8,%ecx
+f010a767:	e8 57 fd ff ff       	call   f010a4c3 <pci_attach_match>
+f010a76c:	83 c4 10             	add    $0x10,%esp
+f010a76f:	e9 33 ff ff ff       	jmp    f010a6a7 <pci_scan_bus+0xa2>
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010a774:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010a777:	83 c0 01             	add    $0x1,%eax
+f010a77a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f010a77d:	83 f8 1f             	cmp    $0x1f,%eax
+f010a780:	77 4b                	ja     f010a7cd <pci_scan_bus+0x1c8>
+		uint32_t bhlc = pci_conf_read(&df, PCI_BHLC_REG);
+f010a782:	ba 0c 00 00 00       	mov    $0xc,%edx
+f010a787:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010a78a:	e8 51 fe ff ff       	call   f010a5e0 <pci_conf_read>
+		if (PCI_HDRTYPE_TYPE(bhlc) > 1)	    // Unsupported or no device
+f010a78f:	89 c2                	mov    %eax,%edx
+f010a791:	c1 ea 10             	shr    $0x10,%edx
+f010a794:	89 d3                	mov    %edx,%ebx
+f010a796:	83 e3 7e             	and    $0x7e,%ebx
+f010a799:	75 d9                	jne    f010a774 <pci_scan_bus+0x16f>
+		totaldev++;
+f010a79b:	83 85 f8 fe ff ff 01 	addl   $0x1,-0x108(%ebp)
+		struct pci_func f = df;
+f010a7a2:	8d bd 10 ff ff ff    	lea    -0xf0(%ebp),%edi
+f010a7a8:	8d 75 a0             	lea    -0x60(%ebp),%esi
+f010a7ab:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010a7b0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f010a7b2:	25 00 00 80 00       	and    $0x800000,%eax
+f010a7b7:	83 f8 01             	cmp    $0x1,%eax
+f010a7ba:	19 c0                	sbb    %eax,%eax
+f010a7bc:	83 e0 f9             	and    $0xfffffff9,%eax
+f010a7bf:	83 c0 08             	add    $0x8,%eax
+f010a7c2:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+f010a7c8:	e9 dd fe ff ff       	jmp    f010a6aa <pci_scan_bus+0xa5>
+			pci_attach(&af);
+		}
+	}
+
+	return totaldev;
+}
+f010a7cd:	8b 85 f8 fe ff ff    	mov    -0x108(%ebp),%eax
+f010a7d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a7d6:	5b                   	pop    %ebx
+f010a7d7:	5e                   	pop    %esi
+f010a7d8:	5f                   	pop    %edi
+f010a7d9:	5d                   	pop    %ebp
+f010a7da:	c3                   	ret
+
+f010a7db <pci_bridge_attach>:
+
+static int
+pci_bridge_attach(struct pci_func *pcif)
+{
+f010a7db:	55                   	push   %ebp
+f010a7dc:	89 e5                	mov    %esp,%ebp
+f010a7de:	57                   	push   %edi
+f010a7df:	56                   	push   %esi
+f010a7e0:	53                   	push   %ebx
+f010a7e1:	83 ec 1c             	sub    $0x1c,%esp
+f010a7e4:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t ioreg  = pci_conf_read(pcif, PCI_BRIDGE_STATIO_REG);
+f010a7e7:	ba 1c 00 00 00       	mov    $0x1c,%edx
+f010a7ec:	89 f0                	mov    %esi,%eax
+f010a7ee:	e8 ed fd ff ff       	call   f010a5e0 <pci_conf_read>
+f010a7f3:	89 c7                	mov    %eax,%edi
+	uint32_t busreg = pci_conf_read(pcif, PCI_BRIDGE_BUS_REG);
+f010a7f5:	ba 18 00 00 00       	mov    $0x18,%edx
+f010a7fa:	89 f0                	mov    %esi,%eax
+f010a7fc:	e8 df fd ff ff       	call   f010a5e0 <pci_conf_read>
+
+	if (PCI_BRIDGE_IO_32BITS(ioreg)) {
+f010a801:	83 e7 0f             	and    $0xf,%edi
+f010a804:	83 ff 01             	cmp    $0x1,%edi
+f010a807:	74 52                	je     f010a85b <pci_bridge_attach+0x80>
+f010a809:	89 c3                	mov    %eax,%ebx
+			pcif->bus->busno, pcif->dev, pcif->func);
+		return 0;
+	}
+
+	struct pci_bus nbus;
+	memset(&nbus, 0, sizeof(nbus));
+f010a80b:	83 ec 04             	sub    $0x4,%esp
+f010a80e:	6a 08                	push   $0x8
+f010a810:	6a 00                	push   $0x0
+f010a812:	8d 7d e0             	lea    -0x20(%ebp),%edi
+f010a815:	57                   	push   %edi
+f010a816:	e8 83 d4 ff ff       	call   f0107c9e <memset>
+	nbus.parent_bridge = pcif;
+f010a81b:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	nbus.busno = (busreg >> PCI_BRIDGE_BUS_SECONDARY_SHIFT) & 0xff;
+f010a81e:	0f b6 c7             	movzbl %bh,%eax
+f010a821:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	if (pci_show_devs)
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f010a824:	83 c4 08             	add    $0x8,%esp
+			pcif->bus->busno, pcif->dev, pcif->func,
+			nbus.busno,
+			(busreg >> PCI_BRIDGE_BUS_SUBORDINATE_SHIFT) & 0xff);
+f010a827:	c1 eb 10             	shr    $0x10,%ebx
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f010a82a:	0f b6 db             	movzbl %bl,%ebx
+f010a82d:	53                   	push   %ebx
+f010a82e:	50                   	push   %eax
+f010a82f:	ff 76 08             	push   0x8(%esi)
+f010a832:	ff 76 04             	push   0x4(%esi)
+f010a835:	8b 06                	mov    (%esi),%eax
+f010a837:	ff 70 04             	push   0x4(%eax)
+f010a83a:	68 04 d0 10 f0       	push   $0xf010d004
+f010a83f:	e8 a8 9e ff ff       	call   f01046ec <cprintf>
+
+	pci_scan_bus(&nbus);
+f010a844:	83 c4 20             	add    $0x20,%esp
+f010a847:	89 f8                	mov    %edi,%eax
+f010a849:	e8 b7 fd ff ff       	call   f010a605 <pci_scan_bus>
+	return 1;
+f010a84e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f010a853:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a856:	5b                   	pop    %ebx
+f010a857:	5e                   	pop    %esi
+f010a858:	5f                   	pop    %edi
+f010a859:	5d                   	pop    %ebp
+f010a85a:	c3                   	ret
+		cprintf("PCI: %02x:%02x.%d: 32-bit bridge IO not supported.\n",
+f010a85b:	ff 76 08             	push   0x8(%esi)
+f010a85e:	ff 76 04             	push   0x4(%esi)
+f010a861:	8b 06                	mov    (%esi),%eax
+f010a863:	ff 70 04             	push   0x4(%eax)
+f010a866:	68 d0 cf 10 f0       	push   $0xf010cfd0
+f010a86b:	e8 7c 9e ff ff       	call   f01046ec <cprintf>
+		return 0;
+f010a870:	83 c4 10             	add    $0x10,%esp
+f010a873:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a878:	eb d9                	jmp    f010a853 <pci_bridge_attach+0x78>
+
+f010a87a <pci_conf_write>:
+{
+f010a87a:	55                   	push   %ebp
+f010a87b:	89 e5                	mov    %esp,%ebp
+f010a87d:	57                   	push   %edi
+f010a87e:	56                   	push   %esi
+f010a87f:	53                   	push   %ebx
+f010a880:	83 ec 18             	sub    $0x18,%esp
+f010a883:	89 d7                	mov    %edx,%edi
+f010a885:	89 ce                	mov    %ecx,%esi
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f010a887:	8b 48 08             	mov    0x8(%eax),%ecx
+f010a88a:	8b 50 04             	mov    0x4(%eax),%edx
+f010a88d:	8b 00                	mov    (%eax),%eax
+f010a88f:	8b 40 04             	mov    0x4(%eax),%eax
+f010a892:	57                   	push   %edi
+f010a893:	e8 90 fc ff ff       	call   f010a528 <pci_conf1_set_addr>
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010a898:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010a89d:	89 f0                	mov    %esi,%eax
+f010a89f:	ef                   	out    %eax,(%dx)
+}
+f010a8a0:	83 c4 10             	add    $0x10,%esp
+f010a8a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a8a6:	5b                   	pop    %ebx
+f010a8a7:	5e                   	pop    %esi
+f010a8a8:	5f                   	pop    %edi
+f010a8a9:	5d                   	pop    %ebp
+f010a8aa:	c3                   	ret
+
+f010a8ab <pci_func_enable>:
+
+// External PCI subsystem interface
+
+void
+pci_func_enable(struct pci_func *f)
+{
+f010a8ab:	55                   	push   %ebp
+f010a8ac:	89 e5                	mov    %esp,%ebp
+f010a8ae:	57                   	push   %edi
+f010a8af:	56                   	push   %esi
+f010a8b0:	53                   	push   %ebx
+f010a8b1:	83 ec 1c             	sub    $0x1c,%esp
+f010a8b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	pci_conf_write(f, PCI_COMMAND_STATUS_REG,
+f010a8b7:	b9 07 00 00 00       	mov    $0x7,%ecx
+f010a8bc:	ba 04 00 00 00       	mov    $0x4,%edx
+f010a8c1:	89 f8                	mov    %edi,%eax
+f010a8c3:	e8 b2 ff ff ff       	call   f010a87a <pci_conf_write>
+		       PCI_COMMAND_MEM_ENABLE |
+		       PCI_COMMAND_MASTER_ENABLE);
+
+	uint32_t bar_width;
+	uint32_t bar;
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f010a8c8:	be 10 00 00 00       	mov    $0x10,%esi
+f010a8cd:	eb 29                	jmp    f010a8f8 <pci_func_enable+0x4d>
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+			if (pci_show_addrs)
+				cprintf("  mem region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		} else {
+			size = PCI_MAPREG_IO_SIZE(rv);
+f010a8cf:	89 d8                	mov    %ebx,%eax
+f010a8d1:	83 e0 fc             	and    $0xfffffffc,%eax
+f010a8d4:	f7 d8                	neg    %eax
+f010a8d6:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_IO_ADDR(oldv);
+f010a8d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a8db:	83 e0 fc             	and    $0xfffffffc,%eax
+f010a8de:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		bar_width = 4;
+f010a8e1:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+f010a8e8:	eb 7a                	jmp    f010a964 <pci_func_enable+0xb9>
+	     bar += bar_width)
+f010a8ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a8ed:	01 c6                	add    %eax,%esi
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f010a8ef:	83 fe 27             	cmp    $0x27,%esi
+f010a8f2:	0f 87 c7 00 00 00    	ja     f010a9bf <pci_func_enable+0x114>
+		uint32_t oldv = pci_conf_read(f, bar);
+f010a8f8:	89 f2                	mov    %esi,%edx
+f010a8fa:	89 f8                	mov    %edi,%eax
+f010a8fc:	e8 df fc ff ff       	call   f010a5e0 <pci_conf_read>
+f010a901:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		pci_conf_write(f, bar, 0xffffffff);
+f010a904:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f010a909:	89 f2                	mov    %esi,%edx
+f010a90b:	89 f8                	mov    %edi,%eax
+f010a90d:	e8 68 ff ff ff       	call   f010a87a <pci_conf_write>
+		uint32_t rv = pci_conf_read(f, bar);
+f010a912:	89 f2                	mov    %esi,%edx
+f010a914:	89 f8                	mov    %edi,%eax
+f010a916:	e8 c5 fc ff ff       	call   f010a5e0 <pci_conf_read>
+f010a91b:	89 c3                	mov    %eax,%ebx
+		bar_width = 4;
+f010a91d:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+		if (rv == 0)
+f010a924:	85 c0                	test   %eax,%eax
+f010a926:	74 c2                	je     f010a8ea <pci_func_enable+0x3f>
+		int regnum = PCI_MAPREG_NUM(bar);
+f010a928:	8d 46 f0             	lea    -0x10(%esi),%eax
+f010a92b:	89 c2                	mov    %eax,%edx
+f010a92d:	c1 ea 02             	shr    $0x2,%edx
+f010a930:	89 55 d8             	mov    %edx,-0x28(%ebp)
+		if (PCI_MAPREG_TYPE(rv) == PCI_MAPREG_TYPE_MEM) {
+f010a933:	f6 c3 01             	test   $0x1,%bl
+f010a936:	75 97                	jne    f010a8cf <pci_func_enable+0x24>
+			if (PCI_MAPREG_MEM_TYPE(rv) == PCI_MAPREG_MEM_TYPE_64BIT)
+f010a938:	89 da                	mov    %ebx,%edx
+f010a93a:	83 e2 06             	and    $0x6,%edx
+		bar_width = 4;
+f010a93d:	83 fa 04             	cmp    $0x4,%edx
+f010a940:	0f 94 c1             	sete   %cl
+f010a943:	0f b6 c9             	movzbl %cl,%ecx
+f010a946:	8d 14 8d 04 00 00 00 	lea    0x4(,%ecx,4),%edx
+f010a94d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			size = PCI_MAPREG_MEM_SIZE(rv);
+f010a950:	89 da                	mov    %ebx,%edx
+f010a952:	83 e2 f0             	and    $0xfffffff0,%edx
+f010a955:	89 d0                	mov    %edx,%eax
+f010a957:	f7 d8                	neg    %eax
+f010a959:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+f010a95b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a95e:	83 e0 f0             	and    $0xfffffff0,%eax
+f010a961:	89 45 dc             	mov    %eax,-0x24(%ebp)
+			if (pci_show_addrs)
+				cprintf("  io region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		}
+
+		pci_conf_write(f, bar, oldv);
+f010a964:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010a967:	89 f2                	mov    %esi,%edx
+f010a969:	89 f8                	mov    %edi,%eax
+f010a96b:	e8 0a ff ff ff       	call   f010a87a <pci_conf_write>
+		f->reg_base[regnum] = base;
+f010a970:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010a973:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010a976:	89 44 8f 14          	mov    %eax,0x14(%edi,%ecx,4)
+		f->reg_size[regnum] = size;
+f010a97a:	89 5c 8f 2c          	mov    %ebx,0x2c(%edi,%ecx,4)
+
+		if (size && !base)
+f010a97e:	85 db                	test   %ebx,%ebx
+f010a980:	0f 84 64 ff ff ff    	je     f010a8ea <pci_func_enable+0x3f>
+f010a986:	85 c0                	test   %eax,%eax
+f010a988:	0f 85 5c ff ff ff    	jne    f010a8ea <pci_func_enable+0x3f>
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+				"may be misconfigured: "
+				"region %d: base 0x%x, size %d\n",
+				f->bus->busno, f->dev, f->func,
+				PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id),
+f010a98e:	8b 47 0c             	mov    0xc(%edi),%eax
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+f010a991:	83 ec 0c             	sub    $0xc,%esp
+f010a994:	53                   	push   %ebx
+f010a995:	6a 00                	push   $0x0
+f010a997:	51                   	push   %ecx
+f010a998:	89 c2                	mov    %eax,%edx
+f010a99a:	c1 ea 10             	shr    $0x10,%edx
+f010a99d:	52                   	push   %edx
+f010a99e:	0f b7 c0             	movzwl %ax,%eax
+f010a9a1:	50                   	push   %eax
+f010a9a2:	ff 77 08             	push   0x8(%edi)
+f010a9a5:	ff 77 04             	push   0x4(%edi)
+f010a9a8:	8b 07                	mov    (%edi),%eax
+f010a9aa:	ff 70 04             	push   0x4(%eax)
+f010a9ad:	68 34 d0 10 f0       	push   $0xf010d034
+f010a9b2:	e8 35 9d ff ff       	call   f01046ec <cprintf>
+f010a9b7:	83 c4 30             	add    $0x30,%esp
+f010a9ba:	e9 2b ff ff ff       	jmp    f010a8ea <pci_func_enable+0x3f>
+				regnum, base, size);
+	}
+
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+		f->bus->busno, f->dev, f->func,
+		PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id));
+f010a9bf:	8b 47 0c             	mov    0xc(%edi),%eax
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+f010a9c2:	83 ec 08             	sub    $0x8,%esp
+f010a9c5:	89 c2                	mov    %eax,%edx
+f010a9c7:	c1 ea 10             	shr    $0x10,%edx
+f010a9ca:	52                   	push   %edx
+f010a9cb:	0f b7 c0             	movzwl %ax,%eax
+f010a9ce:	50                   	push   %eax
+f010a9cf:	ff 77 08             	push   0x8(%edi)
+f010a9d2:	ff 77 04             	push   0x4(%edi)
+f010a9d5:	8b 07                	mov    (%edi),%eax
+f010a9d7:	ff 70 04             	push   0x4(%eax)
+f010a9da:	68 90 d0 10 f0       	push   $0xf010d090
+f010a9df:	e8 08 9d ff ff       	call   f01046ec <cprintf>
+}
+f010a9e4:	83 c4 20             	add    $0x20,%esp
+f010a9e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a9ea:	5b                   	pop    %ebx
+f010a9eb:	5e                   	pop    %esi
+f010a9ec:	5f                   	pop    %edi
+f010a9ed:	5d                   	pop    %ebp
+f010a9ee:	c3                   	ret
+
+f010a9ef <pci_init>:
+
+int
+pci_init(void)
+{
+f010a9ef:	55                   	push   %ebp
+f010a9f0:	89 e5                	mov    %esp,%ebp
+f010a9f2:	83 ec 0c             	sub    $0xc,%esp
+	static struct pci_bus root_bus;
+	memset(&root_bus, 0, sizeof(root_bus));
+f010a9f5:	6a 08                	push   $0x8
+f010a9f7:	6a 00                	push   $0x0
+f010a9f9:	68 c0 f2 92 f0       	push   $0xf092f2c0
+f010a9fe:	e8 9b d2 ff ff       	call   f0107c9e <memset>
+
+	return pci_scan_bus(&root_bus);
+f010aa03:	b8 c0 f2 92 f0       	mov    $0xf092f2c0,%eax
+f010aa08:	e8 f8 fb ff ff       	call   f010a605 <pci_scan_bus>
+}
+f010aa0d:	c9                   	leave
+f010aa0e:	c3                   	ret
+
+f010aa0f <time_init>:
+static void time_alarms(void);
+
+void
+time_init(void)
+{
+	ticks = 0;
+f010aa0f:	c7 05 c8 f2 92 f0 00 	movl   $0x0,0xf092f2c8
+f010aa16:	00 00 00 
+}
+f010aa19:	c3                   	ret
+
+f010aa1a <time_tick>:
+
+// This should be called once per timer interrupt.  A timer interrupt
+// fires every 10 ms.
+void
+time_tick(void)
+{
+f010aa1a:	55                   	push   %ebp
+f010aa1b:	89 e5                	mov    %esp,%ebp
+f010aa1d:	57                   	push   %edi
+f010aa1e:	56                   	push   %esi
+f010aa1f:	53                   	push   %ebx
+f010aa20:	83 ec 1c             	sub    $0x1c,%esp
+	ticks++;
+f010aa23:	a1 c8 f2 92 f0       	mov    0xf092f2c8,%eax
+f010aa28:	83 c0 01             	add    $0x1,%eax
+f010aa2b:	a3 c8 f2 92 f0       	mov    %eax,0xf092f2c8
+	if (ticks * 10 < ticks)
+f010aa30:	8d 34 80             	lea    (%eax,%eax,4),%esi
+f010aa33:	01 f6                	add    %esi,%esi
+f010aa35:	39 c6                	cmp    %eax,%esi
+f010aa37:	72 1e                	jb     f010aa57 <time_tick+0x3d>
+time_alarms(void)
+{
+	uint32_t now = time_msec(), next = ~0;
+	struct Env *e;
+
+	if (now < alarm_next)
+f010aa39:	3b 35 08 88 11 f0    	cmp    0xf0118808,%esi
+f010aa3f:	0f 82 db 00 00 00    	jb     f010ab20 <time_tick+0x106>
+		return;
+	for (e = envs; e < envs + NENV; e++) {
+f010aa45:	a1 50 c2 92 f0       	mov    0xf092c250,%eax
+f010aa4a:	8d 88 00 f0 02 00    	lea    0x2f000(%eax),%ecx
+	uint32_t now = time_msec(), next = ~0;
+f010aa50:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f010aa55:	eb 7f                	jmp    f010aad6 <time_tick+0xbc>
+		panic("time_tick: time overflowed");
+f010aa57:	83 ec 04             	sub    $0x4,%esp
+f010aa5a:	68 98 d1 10 f0       	push   $0xf010d198
+f010aa5f:	6a 18                	push   $0x18
+f010aa61:	68 b3 d1 10 f0       	push   $0xf010d1b3
+f010aa66:	e8 d5 55 ff ff       	call   f0100040 <_panic>
+	if (!e->env_ipc_recving) {
+f010aa6b:	83 b8 80 00 00 00 00 	cmpl   $0x0,0x80(%eax)
+f010aa72:	74 7d                	je     f010aaf1 <time_tick+0xd7>
+	e->env_ipc_recving = 0;
+f010aa74:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+f010aa7b:	00 00 00 
+	e->env_ipc_from = 0;
+f010aa7e:	c7 80 8c 00 00 00 00 	movl   $0x0,0x8c(%eax)
+f010aa85:	00 00 00 
+	e->env_ipc_value = e->env_alarm_value;
+f010aa88:	8b b8 a8 00 00 00    	mov    0xa8(%eax),%edi
+f010aa8e:	89 b8 88 00 00 00    	mov    %edi,0x88(%eax)
+	e->env_ipc_perm = 0;
+f010aa94:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f010aa9b:	00 00 00 
+	e->env_ipc_npages = 0;
+f010aa9e:	c7 80 98 00 00 00 00 	movl   $0x0,0x98(%eax)
+f010aaa5:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = 0;
+f010aaa8:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	e->env_status = ENV_RUNNABLE;
+f010aaaf:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+		if (!e->env_alarm || e->env_status == ENV_FREE)
+			continue;
+		if (e->env_alarm <= now) {
+			alarm_fire(e);
+			if (!e->env_alarm_period)
+f010aab6:	8b b8 a4 00 00 00    	mov    0xa4(%eax),%edi
+f010aabc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010aabf:	85 ff                	test   %edi,%edi
+f010aac1:	75 3a                	jne    f010aafd <time_tick+0xe3>
+				e->env_alarm = 0;
+f010aac3:	c7 80 a0 00 00 00 00 	movl   $0x0,0xa0(%eax)
+f010aaca:	00 00 00 
+	for (e = envs; e < envs + NENV; e++) {
+f010aacd:	05 bc 00 00 00       	add    $0xbc,%eax
+f010aad2:	39 c1                	cmp    %eax,%ecx
+f010aad4:	74 44                	je     f010ab1a <time_tick+0x100>
+		if (!e->env_alarm || e->env_status == ENV_FREE)
+f010aad6:	8b 90 a0 00 00 00    	mov    0xa0(%eax),%edx
+f010aadc:	85 d2                	test   %edx,%edx
+f010aade:	74 ed                	je     f010aacd <time_tick+0xb3>
+f010aae0:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f010aae4:	74 e7                	je     f010aacd <time_tick+0xb3>
+		if (e->env_alarm <= now) {
+f010aae6:	39 d6                	cmp    %edx,%esi
+f010aae8:	73 81                	jae    f010aa6b <time_tick+0x51>
+			else if ((e->env_alarm += e->env_alarm_period) <= now)
+				e->env_alarm = now + e->env_alarm_period;
+		}
+		if (e->env_alarm)
+			next = MIN(next, e->env_alarm);
+f010aaea:	39 d3                	cmp    %edx,%ebx
+f010aaec:	0f 47 da             	cmova  %edx,%ebx
+f010aaef:	eb dc                	jmp    f010aacd <time_tick+0xb3>
+		e->env_alarm_pending = 1;
+f010aaf1:	c7 80 ac 00 00 00 01 	movl   $0x1,0xac(%eax)
+f010aaf8:	00 00 00 
+		return;
+f010aafb:	eb b9                	jmp    f010aab6 <time_tick+0x9c>
+			else if ((e->env_alarm += e->env_alarm_period) <= now)
+f010aafd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010ab00:	01 d7                	add    %edx,%edi
+				e->env_alarm = now + e->env_alarm_period;
+f010ab02:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010ab05:	01 f2                	add    %esi,%edx
+f010ab07:	39 fe                	cmp    %edi,%esi
+f010ab09:	0f 43 fa             	cmovae %edx,%edi
+f010ab0c:	89 b8 a0 00 00 00    	mov    %edi,0xa0(%eax)
+		if (e->env_alarm)
+f010ab12:	89 fa                	mov    %edi,%edx
+f010ab14:	85 ff                	test   %edi,%edi
+f010ab16:	74 b5                	je     f010aacd <time_tick+0xb3>
+f010ab18:	eb d0                	jmp    f010aaea <time_tick+0xd0>
+	}
+	alarm_next = next;
+f010ab1a:	89 1d 08 88 11 f0    	mov    %ebx,0xf0118808
+	futex_timeouts(time_msec());
+f010ab20:	83 ec 0c             	sub    $0xc,%esp
+f010ab23:	56                   	push   %esi
+f010ab24:	e8 28 03 00 00       	call   f010ae51 <futex_timeouts>
+}
+f010ab29:	83 c4 10             	add    $0x10,%esp
+f010ab2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010ab2f:	5b                   	pop    %ebx
+f010ab30:	5e                   	pop    %esi
+f010ab31:	5f                   	pop    %edi
+f010ab32:	5d                   	pop    %ebp
+f010ab33:	c3                   	ret
+
+f010ab34 <time_msec>:
+	return ticks * 10;
+f010ab34:	a1 c8 f2 92 f0       	mov    0xf092f2c8,%eax
+f010ab39:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010ab3c:	01 c0                	add    %eax,%eax
+}
+f010ab3e:	c3                   	ret
+
+f010ab3f <time_set_alarm>:
+{
+f010ab3f:	55                   	push   %ebp
+f010ab40:	89 e5                	mov    %esp,%ebp
+f010ab42:	8b 45 08             	mov    0x8(%ebp),%eax
+f010ab45:	8b 55 0c             	mov    0xc(%ebp),%edx
+	e->env_alarm = msec;
+f010ab48:	89 90 a0 00 00 00    	mov    %edx,0xa0(%eax)
+	e->env_alarm_period = period;
+f010ab4e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010ab51:	89 88 a4 00 00 00    	mov    %ecx,0xa4(%eax)
+	e->env_alarm_value = value;
+f010ab57:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f010ab5a:	89 88 a8 00 00 00    	mov    %ecx,0xa8(%eax)
+	e->env_alarm_pending = 0;
+f010ab60:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+f010ab67:	00 00 00 
+	if (msec && msec < alarm_next)
+f010ab6a:	85 d2                	test   %edx,%edx
+f010ab6c:	74 0e                	je     f010ab7c <time_set_alarm+0x3d>
+f010ab6e:	3b 15 08 88 11 f0    	cmp    0xf0118808,%edx
+f010ab74:	73 06                	jae    f010ab7c <time_set_alarm+0x3d>
+		alarm_next = msec;
+f010ab76:	89 15 08 88 11 f0    	mov    %edx,0xf0118808
+}
+f010ab7c:	5d                   	pop    %ebp
+f010ab7d:	c3                   	ret
+
+f010ab7e <futex_wakeup>:
+
+// Take 'e' off its hash chain and make it runnable, with 'ret' as the
+// return value of its sys_futex_wait.
+static void
+futex_wakeup(struct Env **pe, int ret)
+{
+f010ab7e:	55                   	push   %ebp
+f010ab7f:	89 e5                	mov    %esp,%ebp
+f010ab81:	53                   	push   %ebx
+f010ab82:	89 d1                	mov    %edx,%ecx
+	struct Env *e = *pe;
+f010ab84:	8b 10                	mov    (%eax),%edx
+
+	*pe = e->env_futex_link;
+f010ab86:	8b 9a b8 00 00 00    	mov    0xb8(%edx),%ebx
+f010ab8c:	89 18                	mov    %ebx,(%eax)
+	e->env_futex_link = NULL;
+f010ab8e:	c7 82 b8 00 00 00 00 	movl   $0x0,0xb8(%edx)
+f010ab95:	00 00 00 
+	e->env_futex_pa = 0;
+f010ab98:	c7 82 b0 00 00 00 00 	movl   $0x0,0xb0(%edx)
+f010ab9f:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = ret;
+f010aba2:	89 4a 1c             	mov    %ecx,0x1c(%edx)
+	e->env_status = ENV_RUNNABLE;
+f010aba5:	c7 42 54 02 00 00 00 	movl   $0x2,0x54(%edx)
+	futex_nwait--;
+f010abac:	83 2d a8 14 97 f0 01 	subl   $0x1,0xf09714a8
+}
+f010abb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010abb6:	c9                   	leave
+f010abb7:	c3                   	ret
+
+f010abb8 <futex_pa>:
+
+// The physical address of the word at 'va' in e's address space, or 0
+// if 'va' is not an aligned word on a user page or in the envs array.
+static physaddr_t
+futex_pa(struct Env *e, uintptr_t va)
+{
+f010abb8:	55                   	push   %ebp
+f010abb9:	89 e5                	mov    %esp,%ebp
+f010abbb:	56                   	push   %esi
+f010abbc:	53                   	push   %ebx
+f010abbd:	83 ec 10             	sub    $0x10,%esp
+	struct Page *pp;
+	pte_t *pte;
+
+	if (va % sizeof(uint32_t))
+f010abc0:	89 d6                	mov    %edx,%esi
+f010abc2:	83 e6 03             	and    $0x3,%esi
+f010abc5:	75 77                	jne    f010ac3e <futex_pa+0x86>
+f010abc7:	89 d3                	mov    %edx,%ebx
+		return 0;
+	if (va >= UENVS && va < UENVS + NENV * sizeof(struct Env))
+f010abc9:	8d 92 00 00 40 11    	lea    0x11400000(%edx),%edx
+f010abcf:	81 fa ff ef 02 00    	cmp    $0x2efff,%edx
+f010abd5:	77 27                	ja     f010abfe <futex_pa+0x46>
+		return PADDR(envs) + (va - UENVS);
+f010abd7:	a1 50 c2 92 f0       	mov    0xf092c250,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010abdc:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010abe1:	76 09                	jbe    f010abec <futex_pa+0x34>
+f010abe3:	8d b4 18 00 00 40 21 	lea    0x21400000(%eax,%ebx,1),%esi
+f010abea:	eb 57                	jmp    f010ac43 <futex_pa+0x8b>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010abec:	50                   	push   %eax
+f010abed:	68 e8 b0 10 f0       	push   $0xf010b0e8
+f010abf2:	6a 3f                	push   $0x3f
+f010abf4:	68 bf d1 10 f0       	push   $0xf010d1bf
+f010abf9:	e8 42 54 ff ff       	call   f0100040 <_panic>
+	if (va >= UTOP)
+f010abfe:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f010ac04:	77 3d                	ja     f010ac43 <futex_pa+0x8b>
+		return 0;
+	if (!(pp = page_lookup(e->env_pgdir, (void *) va, &pte))
+f010ac06:	83 ec 04             	sub    $0x4,%esp
+f010ac09:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f010ac0c:	52                   	push   %edx
+f010ac0d:	53                   	push   %ebx
+f010ac0e:	ff 70 70             	push   0x70(%eax)
+f010ac11:	e8 79 6e ff ff       	call   f0101a8f <page_lookup>
+f010ac16:	83 c4 10             	add    $0x10,%esp
+f010ac19:	85 c0                	test   %eax,%eax
+f010ac1b:	74 26                	je     f010ac43 <futex_pa+0x8b>
+	    || !(*pte & PTE_U))
+f010ac1d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f010ac20:	8b 32                	mov    (%edx),%esi
+f010ac22:	83 e6 04             	and    $0x4,%esi
+f010ac25:	74 1c                	je     f010ac43 <futex_pa+0x8b>
+	return (pp - pages) << PGSHIFT;
+f010ac27:	2b 05 f4 f3 92 f0    	sub    0xf092f3f4,%eax
+f010ac2d:	c1 f8 04             	sar    $0x4,%eax
+f010ac30:	c1 e0 0c             	shl    $0xc,%eax
+		return 0;
+	return page2pa(pp) + PGOFF(va);
+f010ac33:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f010ac39:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+f010ac3c:	eb 05                	jmp    f010ac43 <futex_pa+0x8b>
+		return 0;
+f010ac3e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f010ac43:	89 f0                	mov    %esi,%eax
+f010ac45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010ac48:	5b                   	pop    %ebx
+f010ac49:	5e                   	pop    %esi
+f010ac4a:	5d                   	pop    %ebp
+f010ac4b:	c3                   	ret
+
+f010ac4c <futex_wait>:
+//	-E_INVAL if 'va' is not an aligned word on a user page or in envs.
+//	-E_AGAIN if the word is not 'val'.
+//	-E_TIMEOUT if time 'msec' has passed.
+int
+futex_wait(struct Env *e, uintptr_t va, uint32_t val, uint32_t msec)
+{
+f010ac4c:	55                   	push   %ebp
+f010ac4d:	89 e5                	mov    %esp,%ebp
+f010ac4f:	57                   	push   %edi
+f010ac50:	56                   	push   %esi
+f010ac51:	53                   	push   %ebx
+f010ac52:	83 ec 0c             	sub    $0xc,%esp
+f010ac55:	8b 75 08             	mov    0x8(%ebp),%esi
+	physaddr_t pa;
+	struct Env **chain;
+
+	if (!(pa = futex_pa(e, va)))
+f010ac58:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010ac5b:	89 f0                	mov    %esi,%eax
+f010ac5d:	e8 56 ff ff ff       	call   f010abb8 <futex_pa>
+f010ac62:	85 c0                	test   %eax,%eax
+f010ac64:	0f 84 8f 00 00 00    	je     f010acf9 <futex_wait+0xad>
+f010ac6a:	89 c3                	mov    %eax,%ebx
+	if (PGNUM(pa) >= npages)
+f010ac6c:	89 c7                	mov    %eax,%edi
+f010ac6e:	c1 ef 0c             	shr    $0xc,%edi
+f010ac71:	3b 3d ec f3 92 f0    	cmp    0xf092f3ec,%edi
+f010ac77:	73 6e                	jae    f010ace7 <futex_wait+0x9b>
+		return -E_INVAL;
+	if (*(volatile uint32_t *) KADDR(pa) != val)
+f010ac79:	8b 80 00 00 00 f0    	mov    -0x10000000(%eax),%eax
+f010ac7f:	3b 45 10             	cmp    0x10(%ebp),%eax
+f010ac82:	75 7c                	jne    f010ad00 <futex_wait+0xb4>
+		return -E_AGAIN;
+	if (msec <= time_msec())
+f010ac84:	e8 ab fe ff ff       	call   f010ab34 <time_msec>
+f010ac89:	3b 45 14             	cmp    0x14(%ebp),%eax
+f010ac8c:	73 79                	jae    f010ad07 <futex_wait+0xbb>
+	return &futex_hash[(pa >> PGSHIFT) % FUTEX_HASH];
+f010ac8e:	83 e7 3f             	and    $0x3f,%edi
+		return -E_TIMEOUT;
+
+	chain = futex_chain(pa);
+	e->env_futex_pa = pa;
+f010ac91:	89 9e b0 00 00 00    	mov    %ebx,0xb0(%esi)
+	e->env_futex_deadline = msec;
+f010ac97:	8b 45 14             	mov    0x14(%ebp),%eax
+f010ac9a:	89 86 b4 00 00 00    	mov    %eax,0xb4(%esi)
+	e->env_futex_link = *chain;
+f010aca0:	8b 04 bd e0 f2 92 f0 	mov    -0xf6d0d20(,%edi,4),%eax
+f010aca7:	89 86 b8 00 00 00    	mov    %eax,0xb8(%esi)
+	*chain = e;
+f010acad:	89 34 bd e0 f2 92 f0 	mov    %esi,-0xf6d0d20(,%edi,4)
+	e->env_status = ENV_NOT_RUNNABLE;
+f010acb4:	c7 46 54 04 00 00 00 	movl   $0x4,0x54(%esi)
+	futex_nwait++;
+f010acbb:	83 05 a8 14 97 f0 01 	addl   $0x1,0xf09714a8
+	if (msec < futex_next)
+		futex_next = msec;
+	return 0;
+f010acc2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (msec < futex_next)
+f010acc7:	8b 0d 0c 88 11 f0    	mov    0xf011880c,%ecx
+f010accd:	39 4d 14             	cmp    %ecx,0x14(%ebp)
+f010acd0:	73 0d                	jae    f010acdf <futex_wait+0x93>
+		futex_next = msec;
+f010acd2:	8b 45 14             	mov    0x14(%ebp),%eax
+f010acd5:	a3 0c 88 11 f0       	mov    %eax,0xf011880c
+	return 0;
+f010acda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010acdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010ace2:	5b                   	pop    %ebx
+f010ace3:	5e                   	pop    %esi
+f010ace4:	5f                   	pop    %edi
+f010ace5:	5d                   	pop    %ebp
+f010ace6:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010ace7:	50                   	push   %eax
+f010ace8:	68 c4 b0 10 f0       	push   $0xf010b0c4
+f010aced:	6a 56                	push   $0x56
+f010acef:	68 bf d1 10 f0       	push   $0xf010d1bf
+f010acf4:	e8 47 53 ff ff       	call   f0100040 <_panic>
+		return -E_INVAL;
+f010acf9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010acfe:	eb df                	jmp    f010acdf <futex_wait+0x93>
+		return -E_AGAIN;
+f010ad00:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+f010ad05:	eb d8                	jmp    f010acdf <futex_wait+0x93>
+		return -E_TIMEOUT;
+f010ad07:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+f010ad0c:	eb d1                	jmp    f010acdf <futex_wait+0x93>
+
+f010ad0e <futex_wake_pa>:
+
+// Wake up to 'n' envs sleeping on the word at physical address 'pa',
+// and return how many woke.
+int
+futex_wake_pa(physaddr_t pa, int n)
+{
+f010ad0e:	55                   	push   %ebp
+f010ad0f:	89 e5                	mov    %esp,%ebp
+f010ad11:	57                   	push   %edi
+f010ad12:	56                   	push   %esi
+f010ad13:	53                   	push   %ebx
+f010ad14:	83 ec 0c             	sub    $0xc,%esp
+f010ad17:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct Env **pe;
+	int woken = 0;
+
+	if (!futex_nwait)
+f010ad1a:	8b 35 a8 14 97 f0    	mov    0xf09714a8,%esi
+f010ad20:	85 f6                	test   %esi,%esi
+f010ad22:	74 56                	je     f010ad7a <futex_wake_pa+0x6c>
+	return &futex_hash[(pa >> PGSHIFT) % FUTEX_HASH];
+f010ad24:	89 f8                	mov    %edi,%eax
+f010ad26:	c1 e8 0c             	shr    $0xc,%eax
+f010ad29:	83 e0 3f             	and    $0x3f,%eax
+f010ad2c:	8d 1c 85 e0 f2 92 f0 	lea    -0xf6d0d20(,%eax,4),%ebx
+		return 0;
+	for (pe = futex_chain(pa); *pe && woken < n; )
+f010ad33:	8b 04 85 e0 f2 92 f0 	mov    -0xf6d0d20(,%eax,4),%eax
+f010ad3a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f010ad3e:	7e 35                	jle    f010ad75 <futex_wake_pa+0x67>
+f010ad40:	85 c0                	test   %eax,%eax
+f010ad42:	74 31                	je     f010ad75 <futex_wake_pa+0x67>
+	int woken = 0;
+f010ad44:	be 00 00 00 00       	mov    $0x0,%esi
+f010ad49:	eb 1a                	jmp    f010ad65 <futex_wake_pa+0x57>
+		if ((*pe)->env_futex_pa == pa) {
+			futex_wakeup(pe, 0);
+f010ad4b:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ad50:	89 d8                	mov    %ebx,%eax
+f010ad52:	e8 27 fe ff ff       	call   f010ab7e <futex_wakeup>
+			woken++;
+f010ad57:	83 c6 01             	add    $0x1,%esi
+	for (pe = futex_chain(pa); *pe && woken < n; )
+f010ad5a:	8b 03                	mov    (%ebx),%eax
+f010ad5c:	85 c0                	test   %eax,%eax
+f010ad5e:	74 1a                	je     f010ad7a <futex_wake_pa+0x6c>
+f010ad60:	3b 75 0c             	cmp    0xc(%ebp),%esi
+f010ad63:	7d 15                	jge    f010ad7a <futex_wake_pa+0x6c>
+		if ((*pe)->env_futex_pa == pa) {
+f010ad65:	39 b8 b0 00 00 00    	cmp    %edi,0xb0(%eax)
+f010ad6b:	74 de                	je     f010ad4b <futex_wake_pa+0x3d>
+		} else
+			pe = &(*pe)->env_futex_link;
+f010ad6d:	8d 98 b8 00 00 00    	lea    0xb8(%eax),%ebx
+f010ad73:	eb e5                	jmp    f010ad5a <futex_wake_pa+0x4c>
+	int woken = 0;
+f010ad75:	be 00 00 00 00       	mov    $0x0,%esi
+	return woken;
+}
+f010ad7a:	89 f0                	mov    %esi,%eax
+f010ad7c:	83 c4 0c             	add    $0xc,%esp
+f010ad7f:	5b                   	pop    %ebx
+f010ad80:	5e                   	pop    %esi
+f010ad81:	5f                   	pop    %edi
+f010ad82:	5d                   	pop    %ebp
+f010ad83:	c3                   	ret
+
+f010ad84 <futex_wake>:
+{
+f010ad84:	55                   	push   %ebp
+f010ad85:	89 e5                	mov    %esp,%ebp
+f010ad87:	83 ec 08             	sub    $0x8,%esp
+	if (!(pa = futex_pa(e, va)))
+f010ad8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010ad8d:	8b 45 08             	mov    0x8(%ebp),%eax
+f010ad90:	e8 23 fe ff ff       	call   f010abb8 <futex_pa>
+f010ad95:	85 c0                	test   %eax,%eax
+f010ad97:	74 11                	je     f010adaa <futex_wake+0x26>
+	return futex_wake_pa(pa, n);
+f010ad99:	83 ec 08             	sub    $0x8,%esp
+f010ad9c:	ff 75 10             	push   0x10(%ebp)
+f010ad9f:	50                   	push   %eax
+f010ada0:	e8 69 ff ff ff       	call   f010ad0e <futex_wake_pa>
+f010ada5:	83 c4 10             	add    $0x10,%esp
+}
+f010ada8:	c9                   	leave
+f010ada9:	c3                   	ret
+		return -E_INVAL;
+f010adaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010adaf:	eb f7                	jmp    f010ada8 <futex_wake+0x24>
+
+f010adb1 <futex_wake_page>:
+
+// Wake every env sleeping on a word in the page at 'pa'.
+void
+futex_wake_page(physaddr_t pa)
+{
+f010adb1:	55                   	push   %ebp
+f010adb2:	89 e5                	mov    %esp,%ebp
+f010adb4:	56                   	push   %esi
+f010adb5:	53                   	push   %ebx
+f010adb6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Env **pe;
+
+	pa = ROUNDDOWN(pa, PGSIZE);
+f010adb9:	89 c6                	mov    %eax,%esi
+f010adbb:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	return &futex_hash[(pa >> PGSHIFT) % FUTEX_HASH];
+f010adc1:	c1 e8 0c             	shr    $0xc,%eax
+f010adc4:	83 e0 3f             	and    $0x3f,%eax
+f010adc7:	8d 1c 85 e0 f2 92 f0 	lea    -0xf6d0d20(,%eax,4),%ebx
+	for (pe = futex_chain(pa); *pe; )
+f010adce:	8b 04 85 e0 f2 92 f0 	mov    -0xf6d0d20(,%eax,4),%eax
+f010add5:	85 c0                	test   %eax,%eax
+f010add7:	75 16                	jne    f010adef <futex_wake_page+0x3e>
+		if (ROUNDDOWN((*pe)->env_futex_pa, PGSIZE) == pa)
+			futex_wakeup(pe, 0);
+		else
+			pe = &(*pe)->env_futex_link;
+}
+f010add9:	5b                   	pop    %ebx
+f010adda:	5e                   	pop    %esi
+f010addb:	5d                   	pop    %ebp
+f010addc:	c3                   	ret
+			futex_wakeup(pe, 0);
+f010addd:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ade2:	89 d8                	mov    %ebx,%eax
+f010ade4:	e8 95 fd ff ff       	call   f010ab7e <futex_wakeup>
+	for (pe = futex_chain(pa); *pe; )
+f010ade9:	8b 03                	mov    (%ebx),%eax
+f010adeb:	85 c0                	test   %eax,%eax
+f010aded:	74 ea                	je     f010add9 <futex_wake_page+0x28>
+		if (ROUNDDOWN((*pe)->env_futex_pa, PGSIZE) == pa)
+f010adef:	8b 90 b0 00 00 00    	mov    0xb0(%eax),%edx
+f010adf5:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010adfb:	39 d6                	cmp    %edx,%esi
+f010adfd:	74 de                	je     f010addd <futex_wake_page+0x2c>
+			pe = &(*pe)->env_futex_link;
+f010adff:	8d 98 b8 00 00 00    	lea    0xb8(%eax),%ebx
+f010ae05:	eb e2                	jmp    f010ade9 <futex_wake_page+0x38>
+
+f010ae07 <futex_cancel>:
+
+// Stop 'e' waiting, if it is, as when it is destroyed.
+void
+futex_cancel(struct Env *e)
+{
+f010ae07:	55                   	push   %ebp
+f010ae08:	89 e5                	mov    %esp,%ebp
+f010ae0a:	83 ec 08             	sub    $0x8,%esp
+f010ae0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	struct Env **pe;
+
+	if (!e->env_futex_pa)
+f010ae10:	8b 81 b0 00 00 00    	mov    0xb0(%ecx),%eax
+f010ae16:	85 c0                	test   %eax,%eax
+f010ae18:	74 2c                	je     f010ae46 <futex_cancel+0x3f>
+	return &futex_hash[(pa >> PGSHIFT) % FUTEX_HASH];
+f010ae1a:	c1 e8 0c             	shr    $0xc,%eax
+f010ae1d:	83 e0 3f             	and    $0x3f,%eax
+f010ae20:	8b 14 85 e0 f2 92 f0 	mov    -0xf6d0d20(,%eax,4),%edx
+		return;
+	for (pe = futex_chain(e->env_futex_pa); *pe != e; )
+f010ae27:	39 d1                	cmp    %edx,%ecx
+f010ae29:	74 1d                	je     f010ae48 <futex_cancel+0x41>
+		pe = &(*pe)->env_futex_link;
+f010ae2b:	89 d0                	mov    %edx,%eax
+f010ae2d:	8b 92 b8 00 00 00    	mov    0xb8(%edx),%edx
+	for (pe = futex_chain(e->env_futex_pa); *pe != e; )
+f010ae33:	39 d1                	cmp    %edx,%ecx
+f010ae35:	75 f4                	jne    f010ae2b <futex_cancel+0x24>
+		pe = &(*pe)->env_futex_link;
+f010ae37:	05 b8 00 00 00       	add    $0xb8,%eax
+	futex_wakeup(pe, 0);
+f010ae3c:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ae41:	e8 38 fd ff ff       	call   f010ab7e <futex_wakeup>
+}
+f010ae46:	c9                   	leave
+f010ae47:	c3                   	ret
+	return &futex_hash[(pa >> PGSHIFT) % FUTEX_HASH];
+f010ae48:	8d 04 85 e0 f2 92 f0 	lea    -0xf6d0d20(,%eax,4),%eax
+f010ae4f:	eb eb                	jmp    f010ae3c <futex_cancel+0x35>
+
+f010ae51 <futex_timeouts>:
+
+// Wake the envs whose waits have timed out by 'now'.
+void
+futex_timeouts(uint32_t now)
+{
+f010ae51:	55                   	push   %ebp
+f010ae52:	89 e5                	mov    %esp,%ebp
+f010ae54:	57                   	push   %edi
+f010ae55:	56                   	push   %esi
+f010ae56:	53                   	push   %ebx
+f010ae57:	83 ec 1c             	sub    $0x1c,%esp
+f010ae5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct Env **pe;
+	uint32_t next = ~0;
+	int i;
+
+	if (now < futex_next)
+f010ae5d:	3b 3d 0c 88 11 f0    	cmp    0xf011880c,%edi
+f010ae63:	72 56                	jb     f010aebb <futex_timeouts+0x6a>
+f010ae65:	b9 e0 f2 92 f0       	mov    $0xf092f2e0,%ecx
+	uint32_t next = ~0;
+f010ae6a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f010ae6f:	eb 37                	jmp    f010aea8 <futex_timeouts+0x57>
+	for (i = 0; i < FUTEX_HASH; i++)
+		for (pe = &futex_hash[i]; *pe; )
+			if ((*pe)->env_futex_deadline <= now)
+				futex_wakeup(pe, -E_TIMEOUT);
+			else {
+				next = MIN(next, (*pe)->env_futex_deadline);
+f010ae71:	39 d6                	cmp    %edx,%esi
+f010ae73:	0f 47 f2             	cmova  %edx,%esi
+				pe = &(*pe)->env_futex_link;
+f010ae76:	8d 98 b8 00 00 00    	lea    0xb8(%eax),%ebx
+		for (pe = &futex_hash[i]; *pe; )
+f010ae7c:	8b 03                	mov    (%ebx),%eax
+f010ae7e:	85 c0                	test   %eax,%eax
+f010ae80:	74 18                	je     f010ae9a <futex_timeouts+0x49>
+			if ((*pe)->env_futex_deadline <= now)
+f010ae82:	8b 90 b4 00 00 00    	mov    0xb4(%eax),%edx
+f010ae88:	39 d7                	cmp    %edx,%edi
+f010ae8a:	72 e5                	jb     f010ae71 <futex_timeouts+0x20>
+				futex_wakeup(pe, -E_TIMEOUT);
+f010ae8c:	ba ef ff ff ff       	mov    $0xffffffef,%edx
+f010ae91:	89 d8                	mov    %ebx,%eax
+f010ae93:	e8 e6 fc ff ff       	call   f010ab7e <futex_wakeup>
+f010ae98:	eb e2                	jmp    f010ae7c <futex_timeouts+0x2b>
+f010ae9a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+	for (i = 0; i < FUTEX_HASH; i++)
+f010ae9d:	83 c1 04             	add    $0x4,%ecx
+f010aea0:	81 f9 e0 f3 92 f0    	cmp    $0xf092f3e0,%ecx
+f010aea6:	74 0d                	je     f010aeb5 <futex_timeouts+0x64>
+		for (pe = &futex_hash[i]; *pe; )
+f010aea8:	89 cb                	mov    %ecx,%ebx
+f010aeaa:	8b 01                	mov    (%ecx),%eax
+f010aeac:	85 c0                	test   %eax,%eax
+f010aeae:	74 ed                	je     f010ae9d <futex_timeouts+0x4c>
+f010aeb0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f010aeb3:	eb cd                	jmp    f010ae82 <futex_timeouts+0x31>
+			}
+	futex_next = next;
+f010aeb5:	89 35 0c 88 11 f0    	mov    %esi,0xf011880c
+}
+f010aebb:	83 c4 1c             	add    $0x1c,%esp
+f010aebe:	5b                   	pop    %ebx
+f010aebf:	5e                   	pop    %esi
+f010aec0:	5f                   	pop    %edi
+f010aec1:	5d                   	pop    %ebp
+f010aec2:	c3                   	ret
+
+f010aec3 <__udivdi3>:
+f010aec3:	57                   	push   %edi
+f010aec4:	56                   	push   %esi
+f010aec5:	53                   	push   %ebx
+f010aec6:	83 ec 20             	sub    $0x20,%esp
+f010aec9:	8b 44 24 30          	mov    0x30(%esp),%eax
+f010aecd:	8b 54 24 34          	mov    0x34(%esp),%edx
+f010aed1:	89 44 24 08          	mov    %eax,0x8(%esp)
+f010aed5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f010aed9:	8b 44 24 38          	mov    0x38(%esp),%eax
+f010aedd:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f010aee1:	89 44 24 10          	mov    %eax,0x10(%esp)
+f010aee5:	89 54 24 14          	mov    %edx,0x14(%esp)
+f010aee9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010aeee:	b8 00 00 00 00       	mov    $0x0,%eax
+f010aef3:	ba 00 00 00 00       	mov    $0x0,%edx
+f010aef8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f010aeff:	00 
+f010af00:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f010af07:	00 
+f010af08:	eb 08                	jmp    f010af12 <__udivdi3+0x4f>
+f010af0a:	83 e9 01             	sub    $0x1,%ecx
+f010af0d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f010af10:	74 68                	je     f010af7a <__udivdi3+0xb7>
+f010af12:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f010af16:	01 c0                	add    %eax,%eax
+f010af18:	89 c6                	mov    %eax,%esi
+f010af1a:	89 d7                	mov    %edx,%edi
+f010af1c:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010af20:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010af24:	0f ad d0             	shrd   %cl,%edx,%eax
+f010af27:	d3 ea                	shr    %cl,%edx
+f010af29:	f6 c1 20             	test   $0x20,%cl
+f010af2c:	74 04                	je     f010af32 <__udivdi3+0x6f>
+f010af2e:	89 d0                	mov    %edx,%eax
+f010af30:	31 d2                	xor    %edx,%edx
+f010af32:	83 e0 01             	and    $0x1,%eax
+f010af35:	89 04 24             	mov    %eax,(%esp)
+f010af38:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f010af3f:	00 
+f010af40:	8b 04 24             	mov    (%esp),%eax
+f010af43:	8b 54 24 04          	mov    0x4(%esp),%edx
+f010af47:	09 f0                	or     %esi,%eax
+f010af49:	09 fa                	or     %edi,%edx
+f010af4b:	8b 74 24 10          	mov    0x10(%esp),%esi
+f010af4f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f010af53:	39 f0                	cmp    %esi,%eax
+f010af55:	89 d3                	mov    %edx,%ebx
+f010af57:	19 fb                	sbb    %edi,%ebx
+f010af59:	72 af                	jb     f010af0a <__udivdi3+0x47>
+f010af5b:	29 f0                	sub    %esi,%eax
+f010af5d:	19 fa                	sbb    %edi,%edx
+f010af5f:	89 cf                	mov    %ecx,%edi
+f010af61:	c1 ef 05             	shr    $0x5,%edi
+f010af64:	83 e7 01             	and    $0x1,%edi
+f010af67:	89 fe                	mov    %edi,%esi
+f010af69:	83 f6 01             	xor    $0x1,%esi
+f010af6c:	d3 e6                	shl    %cl,%esi
+f010af6e:	d3 e7                	shl    %cl,%edi
+f010af70:	09 74 24 18          	or     %esi,0x18(%esp)
+f010af74:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f010af78:	eb 90                	jmp    f010af0a <__udivdi3+0x47>
+f010af7a:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010af7e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010af82:	83 c4 20             	add    $0x20,%esp
+f010af85:	5b                   	pop    %ebx
+f010af86:	5e                   	pop    %esi
+f010af87:	5f                   	pop    %edi
+f010af88:	c3                   	ret
+
+f010af89 <__umoddi3>:
+f010af89:	57                   	push   %edi
+f010af8a:	56                   	push   %esi
+f010af8b:	53                   	push   %ebx
+f010af8c:	83 ec 08             	sub    $0x8,%esp
+f010af8f:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010af93:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010af97:	8b 74 24 20          	mov    0x20(%esp),%esi
+f010af9b:	8b 7c 24 24          	mov    0x24(%esp),%edi
+f010af9f:	57                   	push   %edi
+f010afa0:	56                   	push   %esi
+f010afa1:	89 44 24 08          	mov    %eax,0x8(%esp)
+f010afa5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f010afa9:	52                   	push   %edx
+f010afaa:	50                   	push   %eax
+f010afab:	e8 13 ff ff ff       	call   f010aec3 <__udivdi3>
+f010afb0:	89 c3                	mov    %eax,%ebx
+f010afb2:	0f af d6             	imul   %esi,%edx
+f010afb5:	89 f9                	mov    %edi,%ecx
+f010afb7:	0f af cb             	imul   %ebx,%ecx
+f010afba:	01 d1                	add    %edx,%ecx
+f010afbc:	89 d8                	mov    %ebx,%eax
+f010afbe:	f7 e6                	mul    %esi
+f010afc0:	89 c6                	mov    %eax,%esi
+f010afc2:	89 d7                	mov    %edx,%edi
+f010afc4:	01 cf                	add    %ecx,%edi
+f010afc6:	8b 44 24 10          	mov    0x10(%esp),%eax
+f010afca:	8b 54 24 14          	mov    0x14(%esp),%edx
+f010afce:	29 f0                	sub    %esi,%eax
+f010afd0:	19 fa                	sbb    %edi,%edx
+f010afd2:	83 c4 18             	add    $0x18,%esp
+f010afd5:	5b                   	pop    %ebx
+f010afd6:	5e                   	pop    %esi
+f010afd7:	5f                   	pop    %edi
+f010afd8:	c3                   	ret
+
+f010afd9 <__divdi3>:
+f010afd9:	53                   	push   %ebx
+f010afda:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010afde:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010afe2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+f010afe6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+f010afea:	85 d2                	test   %edx,%edx
+f010afec:	78 12                	js     f010b000 <__divdi3+0x27>
+f010afee:	85 db                	test   %ebx,%ebx
+f010aff0:	78 2e                	js     f010b020 <__divdi3+0x47>
+f010aff2:	53                   	push   %ebx
+f010aff3:	51                   	push   %ecx
+f010aff4:	52                   	push   %edx
+f010aff5:	50                   	push   %eax
+f010aff6:	e8 c8 fe ff ff       	call   f010aec3 <__udivdi3>
+f010affb:	83 c4 10             	add    $0x10,%esp
+f010affe:	eb 1e                	jmp    f010b01e <__divdi3+0x45>
+f010b000:	f7 d8                	neg    %eax
+f010b002:	83 d2 00             	adc    $0x0,%edx
+f010b005:	f7 da                	neg    %edx
+f010b007:	85 db                	test   %ebx,%ebx
+f010b009:	78 2a                	js     f010b035 <__divdi3+0x5c>
+f010b00b:	53                   	push   %ebx
+f010b00c:	51                   	push   %ecx
+f010b00d:	52                   	push   %edx
+f010b00e:	50                   	push   %eax
+f010b00f:	e8 af fe ff ff       	call   f010aec3 <__udivdi3>
+f010b014:	83 c4 10             	add    $0x10,%esp
+f010b017:	f7 d8                	neg    %eax
+f010b019:	83 d2 00             	adc    $0x0,%edx
+f010b01c:	f7 da                	neg    %edx
+f010b01e:	5b                   	pop    %ebx
+f010b01f:	c3                   	ret
+f010b020:	f7 d9                	neg    %ecx
+f010b022:	83 d3 00             	adc    $0x0,%ebx
+f010b025:	f7 db                	neg    %ebx
+f010b027:	53                   	push   %ebx
+f010b028:	51                   	push   %ecx
+f010b029:	52                   	push   %edx
+f010b02a:	50                   	push   %eax
+f010b02b:	e8 93 fe ff ff       	call   f010aec3 <__udivdi3>
+f010b030:	83 c4 10             	add    $0x10,%esp
+f010b033:	eb e2                	jmp    f010b017 <__divdi3+0x3e>
+f010b035:	f7 d9                	neg    %ecx
+f010b037:	83 d3 00             	adc    $0x0,%ebx
+f010b03a:	f7 db                	neg    %ebx
+f010b03c:	53                   	push   %ebx
+f010b03d:	51                   	push   %ecx
+f010b03e:	52                   	push   %edx
+f010b03f:	50                   	push   %eax
+f010b040:	e8 7e fe ff ff       	call   f010aec3 <__udivdi3>
+f010b045:	83 c4 10             	add    $0x10,%esp
+f010b048:	eb d4                	jmp    f010b01e <__divdi3+0x45>
+
+f010b04a <__moddi3>:
+f010b04a:	57                   	push   %edi
+f010b04b:	56                   	push   %esi
+f010b04c:	53                   	push   %ebx
+f010b04d:	83 ec 08             	sub    $0x8,%esp
+f010b050:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010b054:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010b058:	8b 74 24 20          	mov    0x20(%esp),%esi
+f010b05c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+f010b060:	57                   	push   %edi
+f010b061:	56                   	push   %esi
+f010b062:	89 44 24 08          	mov    %eax,0x8(%esp)
+f010b066:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f010b06a:	52                   	push   %edx
+f010b06b:	50                   	push   %eax
+f010b06c:	e8 68 ff ff ff       	call   f010afd9 <__divdi3>
+f010b071:	89 c3                	mov    %eax,%ebx
+f010b073:	0f af d6             	imul   %esi,%edx
+f010b076:	89 f9                	mov    %edi,%ecx
+f010b078:	0f af cb             	imul   %ebx,%ecx
+f010b07b:	01 d1                	add    %edx,%ecx
+f010b07d:	89 d8                	mov    %ebx,%eax
+f010b07f:	f7 e6                	mul    %esi
+f010b081:	89 c6                	mov    %eax,%esi
+f010b083:	89 d7                	mov    %edx,%edi
+f010b085:	01 cf                	add    %ecx,%edi
+f010b087:	8b 44 24 10          	mov    0x10(%esp),%eax
+f010b08b:	8b 54 24 14          	mov    0x14(%esp),%edx
+f010b08f:	29 f0                	sub    %esi,%eax
+f010b091:	19 fa                	sbb    %edi,%edx
+f010b093:	83 c4 18             	add    $0x18,%esp
+f010b096:	5b                   	pop    %ebx
+f010b097:	5e                   	pop    %esi
+f010b098:	5f                   	pop    %edi
+f010b099:	c3                   	ret
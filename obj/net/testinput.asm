@@ -0,0 +1,9922 @@
+
+obj/net/testinput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 37 05 00 00       	call   800568 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 7c             	sub    $0x7c,%esp
+	envid_t ns_envid = sys_getenvid();
+  80003e:	e8 94 11 00 00       	call   8011d7 <sys_getenvid>
+  800043:	89 c3                	mov    %eax,%ebx
+	int i, r, first = 1;
+
+	binaryname = "testinput";
+  800045:	c7 05 00 60 80 00 40 	movl   $0x804c40,0x806000
+  80004c:	4c 80 00 
+
+	output_envid = fork();
+  80004f:	e8 c9 17 00 00       	call   80181d <fork>
+  800054:	a3 04 70 80 00       	mov    %eax,0x807004
+	if (output_envid < 0)
+  800059:	85 c0                	test   %eax,%eax
+  80005b:	0f 88 7a 01 00 00    	js     8001db <umain+0x1a6>
+		panic("error forking");
+	else if (output_envid == 0) {
+  800061:	0f 84 88 01 00 00    	je     8001ef <umain+0x1ba>
+		output(ns_envid);
+		return;
+	}
+
+	input_envid = fork();
+  800067:	e8 b1 17 00 00       	call   80181d <fork>
+  80006c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (input_envid < 0)
+  800071:	85 c0                	test   %eax,%eax
+  800073:	0f 88 8a 01 00 00    	js     800203 <umain+0x1ce>
+		panic("error forking");
+	else if (input_envid == 0) {
+  800079:	0f 84 98 01 00 00    	je     800217 <umain+0x1e2>
+		input(ns_envid);
+		return;
+	}
+
+	cprintf("Sending ARP announcement...\n");
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	68 68 4c 80 00       	push   $0x804c68
+  800087:	e8 5e 06 00 00       	call   8006ea <cprintf>
+	uint8_t mac[6] = {0x52, 0x54, 0x00, 0x12, 0x34, 0x60};
+  80008c:	c7 45 98 52 54 00 12 	movl   $0x12005452,-0x68(%ebp)
+  800093:	66 c7 45 9c 34 60    	movw   $0x6034,-0x64(%ebp)
+	uint32_t myip = inet_addr(IP);
+  800099:	c7 04 24 85 4c 80 00 	movl   $0x804c85,(%esp)
+  8000a0:	e8 6f 49 00 00       	call   804a14 <inet_addr>
+  8000a5:	89 45 90             	mov    %eax,-0x70(%ebp)
+	uint32_t gwip = inet_addr(DEFAULT);
+  8000a8:	c7 04 24 8f 4c 80 00 	movl   $0x804c8f,(%esp)
+  8000af:	e8 60 49 00 00       	call   804a14 <inet_addr>
+  8000b4:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  8000b7:	83 c4 0c             	add    $0xc,%esp
+  8000ba:	6a 07                	push   $0x7
+  8000bc:	68 00 b0 ea 0f       	push   $0xfeab000
+  8000c1:	6a 00                	push   $0x0
+  8000c3:	e8 4d 11 00 00       	call   801215 <sys_page_alloc>
+  8000c8:	83 c4 10             	add    $0x10,%esp
+  8000cb:	85 c0                	test   %eax,%eax
+  8000cd:	0f 88 52 01 00 00    	js     800225 <umain+0x1f0>
+	pkt->jp_len = sizeof(*arp);
+  8000d3:	c7 05 00 b0 ea 0f 2a 	movl   $0x2a,0xfeab000
+  8000da:	00 00 00 
+	memset(arp->ethhdr.dest.addr, 0xff, ETHARP_HWADDR_LEN);
+  8000dd:	83 ec 04             	sub    $0x4,%esp
+  8000e0:	6a 06                	push   $0x6
+  8000e2:	68 ff 00 00 00       	push   $0xff
+  8000e7:	68 08 b0 ea 0f       	push   $0xfeab008
+  8000ec:	e8 6b 0e 00 00       	call   800f5c <memset>
+	memcpy(arp->ethhdr.src.addr,  mac,  ETHARP_HWADDR_LEN);
+  8000f1:	83 c4 0c             	add    $0xc,%esp
+  8000f4:	6a 06                	push   $0x6
+  8000f6:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  8000f9:	53                   	push   %ebx
+  8000fa:	68 0e b0 ea 0f       	push   $0xfeab00e
+  8000ff:	e8 ef 0e 00 00       	call   800ff3 <memcpy>
+	arp->ethhdr.type = htons(ETHTYPE_ARP);
+  800104:	c7 04 24 06 08 00 00 	movl   $0x806,(%esp)
+  80010b:	e8 cd 46 00 00       	call   8047dd <htons>
+  800110:	66 a3 14 b0 ea 0f    	mov    %ax,0xfeab014
+	arp->hwtype = htons(1); // Ethernet
+  800116:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80011d:	e8 bb 46 00 00       	call   8047dd <htons>
+  800122:	66 a3 16 b0 ea 0f    	mov    %ax,0xfeab016
+	arp->proto = htons(ETHTYPE_IP);
+  800128:	c7 04 24 00 08 00 00 	movl   $0x800,(%esp)
+  80012f:	e8 a9 46 00 00       	call   8047dd <htons>
+  800134:	66 a3 18 b0 ea 0f    	mov    %ax,0xfeab018
+	arp->_hwlen_protolen = htons((ETHARP_HWADDR_LEN << 8) | 4);
+  80013a:	c7 04 24 04 06 00 00 	movl   $0x604,(%esp)
+  800141:	e8 97 46 00 00       	call   8047dd <htons>
+  800146:	66 a3 1a b0 ea 0f    	mov    %ax,0xfeab01a
+	arp->opcode = htons(ARP_REQUEST);
+  80014c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800153:	e8 85 46 00 00       	call   8047dd <htons>
+  800158:	66 a3 1c b0 ea 0f    	mov    %ax,0xfeab01c
+	memcpy(arp->shwaddr.addr,  mac,   ETHARP_HWADDR_LEN);
+  80015e:	83 c4 0c             	add    $0xc,%esp
+  800161:	6a 06                	push   $0x6
+  800163:	53                   	push   %ebx
+  800164:	68 1e b0 ea 0f       	push   $0xfeab01e
+  800169:	e8 85 0e 00 00       	call   800ff3 <memcpy>
+	memcpy(arp->sipaddr.addrw, &myip, 4);
+  80016e:	83 c4 0c             	add    $0xc,%esp
+  800171:	6a 04                	push   $0x4
+  800173:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800176:	50                   	push   %eax
+  800177:	68 24 b0 ea 0f       	push   $0xfeab024
+  80017c:	e8 72 0e 00 00       	call   800ff3 <memcpy>
+	memset(arp->dhwaddr.addr,  0x00,  ETHARP_HWADDR_LEN);
+  800181:	83 c4 0c             	add    $0xc,%esp
+  800184:	6a 06                	push   $0x6
+  800186:	6a 00                	push   $0x0
+  800188:	68 28 b0 ea 0f       	push   $0xfeab028
+  80018d:	e8 ca 0d 00 00       	call   800f5c <memset>
+	memcpy(arp->dipaddr.addrw, &gwip, 4);
+  800192:	83 c4 0c             	add    $0xc,%esp
+  800195:	6a 04                	push   $0x4
+  800197:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  80019a:	50                   	push   %eax
+  80019b:	68 2e b0 ea 0f       	push   $0xfeab02e
+  8001a0:	e8 4e 0e 00 00       	call   800ff3 <memcpy>
+	ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8001a5:	6a 07                	push   $0x7
+  8001a7:	68 00 b0 ea 0f       	push   $0xfeab000
+  8001ac:	6a 12                	push   $0x12
+  8001ae:	ff 35 04 70 80 00    	push   0x807004
+  8001b4:	e8 cb 1e 00 00       	call   802084 <ipc_send>
+	sys_page_unmap(0, pkt);
+  8001b9:	83 c4 18             	add    $0x18,%esp
+  8001bc:	68 00 b0 ea 0f       	push   $0xfeab000
+  8001c1:	6a 00                	push   $0x0
+  8001c3:	e8 d2 10 00 00       	call   80129a <sys_page_unmap>
+}
+  8001c8:	83 c4 10             	add    $0x10,%esp
+	int i, r, first = 1;
+  8001cb:	bf 01 00 00 00       	mov    $0x1,%edi
+			out = buf + snprintf(buf, end - buf,
+  8001d0:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%ebp)
+}
+  8001d6:	e9 65 01 00 00       	jmp    800340 <umain+0x30b>
+		panic("error forking");
+  8001db:	83 ec 04             	sub    $0x4,%esp
+  8001de:	68 4a 4c 80 00       	push   $0x804c4a
+  8001e3:	6a 4e                	push   $0x4e
+  8001e5:	68 58 4c 80 00       	push   $0x804c58
+  8001ea:	e8 20 04 00 00       	call   80060f <_panic>
+		output(ns_envid);
+  8001ef:	83 ec 0c             	sub    $0xc,%esp
+  8001f2:	53                   	push   %ebx
+  8001f3:	e8 d9 02 00 00       	call   8004d1 <output>
+		return;
+  8001f8:	83 c4 10             	add    $0x10,%esp
+		// we've received the ARP reply
+		if (first)
+			cprintf("Waiting for packets...\n");
+		first = 0;
+	}
+}
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+		panic("error forking");
+  800203:	83 ec 04             	sub    $0x4,%esp
+  800206:	68 4a 4c 80 00       	push   $0x804c4a
+  80020b:	6a 56                	push   $0x56
+  80020d:	68 58 4c 80 00       	push   $0x804c58
+  800212:	e8 f8 03 00 00       	call   80060f <_panic>
+		input(ns_envid);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	53                   	push   %ebx
+  80021b:	e8 8c 01 00 00       	call   8003ac <input>
+		return;
+  800220:	83 c4 10             	add    $0x10,%esp
+  800223:	eb d6                	jmp    8001fb <umain+0x1c6>
+		panic("sys_page_map: %e", r);
+  800225:	50                   	push   %eax
+  800226:	68 98 4c 80 00       	push   $0x804c98
+  80022b:	6a 1a                	push   $0x1a
+  80022d:	68 58 4c 80 00       	push   $0x804c58
+  800232:	e8 d8 03 00 00       	call   80060f <_panic>
+			panic("ipc_recv: %e", req);
+  800237:	50                   	push   %eax
+  800238:	68 a9 4c 80 00       	push   $0x804ca9
+  80023d:	6a 65                	push   $0x65
+  80023f:	68 58 4c 80 00       	push   $0x804c58
+  800244:	e8 c6 03 00 00       	call   80060f <_panic>
+			panic("IPC from unexpected environment %08x", whom);
+  800249:	52                   	push   %edx
+  80024a:	68 00 4d 80 00       	push   $0x804d00
+  80024f:	6a 67                	push   $0x67
+  800251:	68 58 4c 80 00       	push   $0x804c58
+  800256:	e8 b4 03 00 00       	call   80060f <_panic>
+			panic("Unexpected IPC %d", req);
+  80025b:	50                   	push   %eax
+  80025c:	68 b6 4c 80 00       	push   $0x804cb6
+  800261:	6a 69                	push   $0x69
+  800263:	68 58 4c 80 00       	push   $0x804c58
+  800268:	e8 a2 03 00 00       	call   80060f <_panic>
+			out = buf + snprintf(buf, end - buf,
+  80026d:	83 ec 0c             	sub    $0xc,%esp
+  800270:	53                   	push   %ebx
+  800271:	68 c8 4c 80 00       	push   $0x804cc8
+  800276:	68 d0 4c 80 00       	push   $0x804cd0
+  80027b:	6a 50                	push   $0x50
+  80027d:	8d 45 98             	lea    -0x68(%ebp),%eax
+  800280:	50                   	push   %eax
+  800281:	e8 f5 0a 00 00       	call   800d7b <snprintf>
+  800286:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800289:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  80028c:	83 c4 20             	add    $0x20,%esp
+  80028f:	eb 40                	jmp    8002d1 <umain+0x29c>
+			cprintf("%.*s\n", out - buf, buf);
+  800291:	83 ec 04             	sub    $0x4,%esp
+  800294:	8d 45 98             	lea    -0x68(%ebp),%eax
+  800297:	50                   	push   %eax
+  800298:	89 f0                	mov    %esi,%eax
+  80029a:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  80029d:	29 c8                	sub    %ecx,%eax
+  80029f:	50                   	push   %eax
+  8002a0:	68 df 4c 80 00       	push   $0x804cdf
+  8002a5:	e8 40 04 00 00       	call   8006ea <cprintf>
+  8002aa:	83 c4 10             	add    $0x10,%esp
+		if (i % 2 == 1)
+  8002ad:	89 da                	mov    %ebx,%edx
+  8002af:	c1 ea 1f             	shr    $0x1f,%edx
+  8002b2:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8002b5:	83 e0 01             	and    $0x1,%eax
+  8002b8:	29 d0                	sub    %edx,%eax
+  8002ba:	83 f8 01             	cmp    $0x1,%eax
+  8002bd:	74 4e                	je     80030d <umain+0x2d8>
+		if (i % 16 == 7)
+  8002bf:	83 ff 07             	cmp    $0x7,%edi
+  8002c2:	74 51                	je     800315 <umain+0x2e0>
+	for (i = 0; i < len; i++) {
+  8002c4:	83 c3 01             	add    $0x1,%ebx
+  8002c7:	39 5d 84             	cmp    %ebx,-0x7c(%ebp)
+  8002ca:	74 51                	je     80031d <umain+0x2e8>
+		if (i % 16 == 0)
+  8002cc:	f6 c3 0f             	test   $0xf,%bl
+  8002cf:	74 9c                	je     80026d <umain+0x238>
+		out += snprintf(out, end - out, "%02x", ((uint8_t*)data)[i]);
+  8002d1:	0f b6 83 08 b0 ea 0f 	movzbl 0xfeab008(%ebx),%eax
+  8002d8:	50                   	push   %eax
+  8002d9:	68 da 4c 80 00       	push   $0x804cda
+  8002de:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002e1:	29 f0                	sub    %esi,%eax
+  8002e3:	50                   	push   %eax
+  8002e4:	56                   	push   %esi
+  8002e5:	e8 91 0a 00 00       	call   800d7b <snprintf>
+  8002ea:	01 c6                	add    %eax,%esi
+		if (i % 16 == 15 || i == len - 1)
+  8002ec:	89 d8                	mov    %ebx,%eax
+  8002ee:	c1 f8 1f             	sar    $0x1f,%eax
+  8002f1:	c1 e8 1c             	shr    $0x1c,%eax
+  8002f4:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+  8002f7:	83 e7 0f             	and    $0xf,%edi
+  8002fa:	29 c7                	sub    %eax,%edi
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	83 ff 0f             	cmp    $0xf,%edi
+  800302:	74 8d                	je     800291 <umain+0x25c>
+  800304:	8b 45 80             	mov    -0x80(%ebp),%eax
+  800307:	39 c3                	cmp    %eax,%ebx
+  800309:	75 a2                	jne    8002ad <umain+0x278>
+  80030b:	eb 84                	jmp    800291 <umain+0x25c>
+			*(out++) = ' ';
+  80030d:	c6 06 20             	movb   $0x20,(%esi)
+  800310:	8d 76 01             	lea    0x1(%esi),%esi
+  800313:	eb aa                	jmp    8002bf <umain+0x28a>
+			*(out++) = ' ';
+  800315:	c6 06 20             	movb   $0x20,(%esi)
+  800318:	8d 76 01             	lea    0x1(%esi),%esi
+  80031b:	eb a7                	jmp    8002c4 <umain+0x28f>
+		cprintf("\n");
+  80031d:	83 ec 0c             	sub    $0xc,%esp
+  800320:	68 fb 4c 80 00       	push   $0x804cfb
+  800325:	e8 c0 03 00 00       	call   8006ea <cprintf>
+		if (first)
+  80032a:	83 c4 10             	add    $0x10,%esp
+  80032d:	83 bd 7c ff ff ff 00 	cmpl   $0x0,-0x84(%ebp)
+  800334:	75 64                	jne    80039a <umain+0x365>
+		first = 0;
+  800336:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  80033d:	00 00 00 
+		int32_t req = ipc_recv((int32_t *)&whom, pkt, &perm);
+  800340:	83 ec 04             	sub    $0x4,%esp
+  800343:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800346:	50                   	push   %eax
+  800347:	68 00 b0 ea 0f       	push   $0xfeab000
+  80034c:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80034f:	50                   	push   %eax
+  800350:	e8 9f 1a 00 00       	call   801df4 <ipc_recv>
+		if (req < 0)
+  800355:	83 c4 10             	add    $0x10,%esp
+  800358:	85 c0                	test   %eax,%eax
+  80035a:	0f 88 d7 fe ff ff    	js     800237 <umain+0x202>
+		if (whom != input_envid)
+  800360:	8b 55 90             	mov    -0x70(%ebp),%edx
+  800363:	3b 15 00 70 80 00    	cmp    0x807000,%edx
+  800369:	0f 85 da fe ff ff    	jne    800249 <umain+0x214>
+		if (req != NSREQ_INPUT)
+  80036f:	83 f8 11             	cmp    $0x11,%eax
+  800372:	0f 85 e3 fe ff ff    	jne    80025b <umain+0x226>
+		hexdump("input: ", pkt->jp_data, pkt->jp_len);
+  800378:	8b 0d 00 b0 ea 0f    	mov    0xfeab000,%ecx
+	for (i = 0; i < len; i++) {
+  80037e:	85 c9                	test   %ecx,%ecx
+  800380:	7e 9b                	jle    80031d <umain+0x2e8>
+	char *out = NULL;
+  800382:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < len; i++) {
+  800387:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (i % 16 == 15 || i == len - 1)
+  80038c:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  80038f:	89 45 80             	mov    %eax,-0x80(%ebp)
+  800392:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+  800395:	e9 32 ff ff ff       	jmp    8002cc <umain+0x297>
+			cprintf("Waiting for packets...\n");
+  80039a:	83 ec 0c             	sub    $0xc,%esp
+  80039d:	68 e5 4c 80 00       	push   $0x804ce5
+  8003a2:	e8 43 03 00 00       	call   8006ea <cprintf>
+  8003a7:	83 c4 10             	add    $0x10,%esp
+  8003aa:	eb 8a                	jmp    800336 <umain+0x301>
+
+008003ac <input>:
+	return pages[PGNUM(PTE_ADDR(pte))].pp_ref == 1;
+}
+
+void
+input(envid_t ns_envid)
+{
+  8003ac:	55                   	push   %ebp
+  8003ad:	89 e5                	mov    %esp,%ebp
+  8003af:	57                   	push   %edi
+  8003b0:	56                   	push   %esi
+  8003b1:	53                   	push   %ebx
+  8003b2:	83 ec 1c             	sub    $0x1c,%esp
+	binaryname = "ns_input";
+  8003b5:	c7 05 00 60 80 00 25 	movl   $0x804d25,0x806000
+  8003bc:	4d 80 00 
+	// each pool page again once the server has unmapped it.
+	int i, j, n, ret;
+	int perm = PTE_P | PTE_W | PTE_U;
+	void *va;
+
+	for (i = 0; ; i = (i + n) % RXPOOL_SIZE) {
+  8003bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003c4:	e9 c6 00 00 00       	jmp    80048f <input+0xe3>
+		n = MIN(RXBATCH, RXPOOL_SIZE - i);
+		for (j = i; j < i + n; j++) {
+			va = (void *) (RXPOOL + j * PGSIZE);
+			if (!rx_page_free(va)
+			    && (ret = sys_page_alloc(0, va, perm)) < 0)
+  8003c9:	83 ec 04             	sub    $0x4,%esp
+  8003cc:	6a 07                	push   $0x7
+  8003ce:	53                   	push   %ebx
+  8003cf:	6a 00                	push   $0x0
+  8003d1:	e8 3f 0e 00 00       	call   801215 <sys_page_alloc>
+  8003d6:	83 c4 10             	add    $0x10,%esp
+  8003d9:	85 c0                	test   %eax,%eax
+  8003db:	78 46                	js     800423 <input+0x77>
+		for (j = i; j < i + n; j++) {
+  8003dd:	83 c6 01             	add    $0x1,%esi
+  8003e0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8003e6:	39 fe                	cmp    %edi,%esi
+  8003e8:	74 4b                	je     800435 <input+0x89>
+	if (!(vpd[PDX(va)] & PTE_P) || !((pte = vpt[PGNUM(va)]) & PTE_P))
+  8003ea:	89 d8                	mov    %ebx,%eax
+  8003ec:	c1 e8 16             	shr    $0x16,%eax
+  8003ef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8003f6:	a8 01                	test   $0x1,%al
+  8003f8:	74 cf                	je     8003c9 <input+0x1d>
+  8003fa:	89 d8                	mov    %ebx,%eax
+  8003fc:	c1 e8 0c             	shr    $0xc,%eax
+  8003ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800406:	a8 01                	test   $0x1,%al
+  800408:	74 bf                	je     8003c9 <input+0x1d>
+	return pages[PGNUM(PTE_ADDR(pte))].pp_ref == 1;
+  80040a:	c1 e8 0c             	shr    $0xc,%eax
+  80040d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  800410:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  800417:	0f b7 40 04          	movzwl 0x4(%eax),%eax
+			if (!rx_page_free(va)
+  80041b:	66 83 f8 01          	cmp    $0x1,%ax
+  80041f:	74 bc                	je     8003dd <input+0x31>
+  800421:	eb a6                	jmp    8003c9 <input+0x1d>
+				panic("sys_page_alloc: %e", ret);
+  800423:	50                   	push   %eax
+  800424:	68 2e 4d 80 00       	push   $0x804d2e
+  800429:	6a 2d                	push   $0x2d
+  80042b:	68 41 4d 80 00       	push   $0x804d41
+  800430:	e8 da 01 00 00       	call   80060f <_panic>
+  800435:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800438:	8b 7d e0             	mov    -0x20(%ebp),%edi
+		}
+
+		// Blocks until the card raises a receive interrupt.
+		if ((n = sys_net_recv_pages((void *) (RXPOOL + i * PGSIZE), n)) < 0)
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	52                   	push   %edx
+  80043f:	8d 87 8b fe 00 00    	lea    0xfe8b(%edi),%eax
+  800445:	c1 e0 0c             	shl    $0xc,%eax
+  800448:	50                   	push   %eax
+  800449:	e8 dd 10 00 00       	call   80152b <sys_net_recv_pages>
+  80044e:	83 c4 10             	add    $0x10,%esp
+  800451:	85 c0                	test   %eax,%eax
+  800453:	78 6a                	js     8004bf <input+0x113>
+			panic("sys_net_recv_pages: %e", n);
+		for (j = i; j < i + n; j++)
+  800455:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  800458:	8b 75 08             	mov    0x8(%ebp),%esi
+  80045b:	39 df                	cmp    %ebx,%edi
+  80045d:	7d 1f                	jge    80047e <input+0xd2>
+			ipc_send(ns_envid, NSREQ_INPUT,
+  80045f:	6a 07                	push   $0x7
+  800461:	89 f8                	mov    %edi,%eax
+  800463:	c1 e0 0c             	shl    $0xc,%eax
+  800466:	05 00 b0 e8 0f       	add    $0xfe8b000,%eax
+  80046b:	50                   	push   %eax
+  80046c:	6a 11                	push   $0x11
+  80046e:	56                   	push   %esi
+  80046f:	e8 10 1c 00 00       	call   802084 <ipc_send>
+		for (j = i; j < i + n; j++)
+  800474:	83 c7 01             	add    $0x1,%edi
+  800477:	83 c4 10             	add    $0x10,%esp
+  80047a:	39 df                	cmp    %ebx,%edi
+  80047c:	75 e1                	jne    80045f <input+0xb3>
+	for (i = 0; ; i = (i + n) % RXPOOL_SIZE) {
+  80047e:	89 d8                	mov    %ebx,%eax
+  800480:	c1 f8 1f             	sar    $0x1f,%eax
+  800483:	c1 e8 1b             	shr    $0x1b,%eax
+  800486:	01 c3                	add    %eax,%ebx
+  800488:	83 e3 1f             	and    $0x1f,%ebx
+  80048b:	89 df                	mov    %ebx,%edi
+  80048d:	29 c7                	sub    %eax,%edi
+		n = MIN(RXBATCH, RXPOOL_SIZE - i);
+  80048f:	ba 20 00 00 00       	mov    $0x20,%edx
+  800494:	29 fa                	sub    %edi,%edx
+  800496:	b8 08 00 00 00       	mov    $0x8,%eax
+  80049b:	39 c2                	cmp    %eax,%edx
+  80049d:	0f 4f d0             	cmovg  %eax,%edx
+		for (j = i; j < i + n; j++) {
+  8004a0:	8d 04 17             	lea    (%edi,%edx,1),%eax
+  8004a3:	39 c7                	cmp    %eax,%edi
+  8004a5:	7d 94                	jge    80043b <input+0x8f>
+  8004a7:	8d 9f 8b fe 00 00    	lea    0xfe8b(%edi),%ebx
+  8004ad:	c1 e3 0c             	shl    $0xc,%ebx
+  8004b0:	89 fe                	mov    %edi,%esi
+  8004b2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8004b5:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8004b8:	89 c7                	mov    %eax,%edi
+  8004ba:	e9 2b ff ff ff       	jmp    8003ea <input+0x3e>
+			panic("sys_net_recv_pages: %e", n);
+  8004bf:	50                   	push   %eax
+  8004c0:	68 4d 4d 80 00       	push   $0x804d4d
+  8004c5:	6a 32                	push   $0x32
+  8004c7:	68 41 4d 80 00       	push   $0x804d41
+  8004cc:	e8 3e 01 00 00       	call   80060f <_panic>
+
+008004d1 <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  8004d1:	55                   	push   %ebp
+  8004d2:	89 e5                	mov    %esp,%ebp
+  8004d4:	56                   	push   %esi
+  8004d5:	53                   	push   %ebx
+  8004d6:	83 ec 10             	sub    $0x10,%esp
+  8004d9:	8b 75 08             	mov    0x8(%ebp),%esi
+	binaryname = "ns_output";
+  8004dc:	c7 05 00 60 80 00 64 	movl   $0x804d64,0x806000
+  8004e3:	4d 80 00 
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+	int ret;
+	envid_t envid;
+	while(1) {
+		if ((ret = ipc_recv(&envid, &nsipcbuf, NULL)) < 0) 
+  8004e6:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8004e9:	eb 36                	jmp    800521 <output+0x50>
+			panic("ipc_recv: %e", ret);
+  8004eb:	50                   	push   %eax
+  8004ec:	68 a9 4c 80 00       	push   $0x804ca9
+  8004f1:	6a 14                	push   $0x14
+  8004f3:	68 6e 4d 80 00       	push   $0x804d6e
+  8004f8:	e8 12 01 00 00       	call   80060f <_panic>
+		if ((envid != ns_envid) || (ret != NSREQ_OUTPUT))
+			panic("Invalid Request");
+
+		while ((ret = sys_net_transmit(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) == -E_DESC_FULL) {
+			sys_yield();
+  8004fd:	e8 f4 0c 00 00       	call   8011f6 <sys_yield>
+		while ((ret = sys_net_transmit(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) == -E_DESC_FULL) {
+  800502:	83 ec 08             	sub    $0x8,%esp
+  800505:	ff 35 00 90 80 00    	push   0x809000
+  80050b:	68 08 90 80 00       	push   $0x809008
+  800510:	e8 73 0f 00 00       	call   801488 <sys_net_transmit>
+  800515:	83 c4 10             	add    $0x10,%esp
+  800518:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80051b:	74 e0                	je     8004fd <output+0x2c>
+		}	
+		if (ret < 0)
+  80051d:	85 c0                	test   %eax,%eax
+  80051f:	78 35                	js     800556 <output+0x85>
+		if ((ret = ipc_recv(&envid, &nsipcbuf, NULL)) < 0) 
+  800521:	83 ec 04             	sub    $0x4,%esp
+  800524:	6a 00                	push   $0x0
+  800526:	68 00 90 80 00       	push   $0x809000
+  80052b:	53                   	push   %ebx
+  80052c:	e8 c3 18 00 00       	call   801df4 <ipc_recv>
+  800531:	83 c4 10             	add    $0x10,%esp
+  800534:	85 c0                	test   %eax,%eax
+  800536:	78 b3                	js     8004eb <output+0x1a>
+		if ((envid != ns_envid) || (ret != NSREQ_OUTPUT))
+  800538:	39 75 f4             	cmp    %esi,-0xc(%ebp)
+  80053b:	75 05                	jne    800542 <output+0x71>
+  80053d:	83 f8 12             	cmp    $0x12,%eax
+  800540:	74 c0                	je     800502 <output+0x31>
+			panic("Invalid Request");
+  800542:	83 ec 04             	sub    $0x4,%esp
+  800545:	68 7b 4d 80 00       	push   $0x804d7b
+  80054a:	6a 16                	push   $0x16
+  80054c:	68 6e 4d 80 00       	push   $0x804d6e
+  800551:	e8 b9 00 00 00       	call   80060f <_panic>
+			panic("sys_net_transmit: %e", ret);
+  800556:	50                   	push   %eax
+  800557:	68 8b 4d 80 00       	push   $0x804d8b
+  80055c:	6a 1c                	push   $0x1c
+  80055e:	68 6e 4d 80 00       	push   $0x804d6e
+  800563:	e8 a7 00 00 00       	call   80060f <_panic>
+
+00800568 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800568:	55                   	push   %ebp
+  800569:	89 e5                	mov    %esp,%ebp
+  80056b:	56                   	push   %esi
+  80056c:	53                   	push   %ebx
+  80056d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800570:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800573:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800575:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80057a:	29 d0                	sub    %edx,%eax
+  80057c:	89 c2                	mov    %eax,%edx
+  80057e:	c1 ea 0f             	shr    $0xf,%edx
+  800581:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058b:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80058e:	c7 04 85 40 7a 80 00 	movl   $0x0,0x807a40(,%eax,4)
+  800595:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800599:	e8 39 0c 00 00       	call   8011d7 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80059e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005a3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8005a9:	89 e1                	mov    %esp,%ecx
+  8005ab:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8005b0:	29 ca                	sub    %ecx,%edx
+  8005b2:	89 d1                	mov    %edx,%ecx
+  8005b4:	c1 e9 0f             	shr    $0xf,%ecx
+  8005b7:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8005bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c2:	0f 42 d1             	cmovb  %ecx,%edx
+  8005c5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005ca:	89 04 95 40 7a 80 00 	mov    %eax,0x807a40(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8005d1:	85 db                	test   %ebx,%ebx
+  8005d3:	7e 07                	jle    8005dc <libmain+0x74>
+		binaryname = argv[0];
+  8005d5:	8b 06                	mov    (%esi),%eax
+  8005d7:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8005dc:	83 ec 08             	sub    $0x8,%esp
+  8005df:	56                   	push   %esi
+  8005e0:	53                   	push   %ebx
+  8005e1:	e8 4f fa ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8005e6:	e8 0a 00 00 00       	call   8005f5 <exit>
+}
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005f1:	5b                   	pop    %ebx
+  8005f2:	5e                   	pop    %esi
+  8005f3:	5d                   	pop    %ebp
+  8005f4:	c3                   	ret
+
+008005f5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005f5:	55                   	push   %ebp
+  8005f6:	89 e5                	mov    %esp,%ebp
+  8005f8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8005fb:	e8 15 1d 00 00       	call   802315 <close_all>
+	sys_env_destroy(0);
+  800600:	83 ec 0c             	sub    $0xc,%esp
+  800603:	6a 00                	push   $0x0
+  800605:	e8 8c 0b 00 00       	call   801196 <sys_env_destroy>
+}
+  80060a:	83 c4 10             	add    $0x10,%esp
+  80060d:	c9                   	leave
+  80060e:	c3                   	ret
+
+0080060f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80060f:	55                   	push   %ebp
+  800610:	89 e5                	mov    %esp,%ebp
+  800612:	56                   	push   %esi
+  800613:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800614:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800617:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80061d:	e8 b5 0b 00 00       	call   8011d7 <sys_getenvid>
+  800622:	83 ec 0c             	sub    $0xc,%esp
+  800625:	ff 75 0c             	push   0xc(%ebp)
+  800628:	ff 75 08             	push   0x8(%ebp)
+  80062b:	56                   	push   %esi
+  80062c:	50                   	push   %eax
+  80062d:	68 ac 4d 80 00       	push   $0x804dac
+  800632:	e8 b3 00 00 00       	call   8006ea <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800637:	83 c4 18             	add    $0x18,%esp
+  80063a:	53                   	push   %ebx
+  80063b:	ff 75 10             	push   0x10(%ebp)
+  80063e:	e8 56 00 00 00       	call   800699 <vcprintf>
+	cprintf("\n");
+  800643:	c7 04 24 fb 4c 80 00 	movl   $0x804cfb,(%esp)
+  80064a:	e8 9b 00 00 00       	call   8006ea <cprintf>
+  80064f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800652:	cc                   	int3
+	while (1)
+  800653:	eb fd                	jmp    800652 <_panic+0x43>
+
+00800655 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800655:	55                   	push   %ebp
+  800656:	89 e5                	mov    %esp,%ebp
+  800658:	53                   	push   %ebx
+  800659:	83 ec 04             	sub    $0x4,%esp
+  80065c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80065f:	8b 13                	mov    (%ebx),%edx
+  800661:	8d 42 01             	lea    0x1(%edx),%eax
+  800664:	89 03                	mov    %eax,(%ebx)
+  800666:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800669:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80066d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800672:	74 09                	je     80067d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800674:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800678:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80067b:	c9                   	leave
+  80067c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80067d:	83 ec 08             	sub    $0x8,%esp
+  800680:	68 ff 00 00 00       	push   $0xff
+  800685:	8d 43 08             	lea    0x8(%ebx),%eax
+  800688:	50                   	push   %eax
+  800689:	e8 cb 0a 00 00       	call   801159 <sys_cputs>
+		b->idx = 0;
+  80068e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800694:	83 c4 10             	add    $0x10,%esp
+  800697:	eb db                	jmp    800674 <putch+0x1f>
+
+00800699 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800699:	55                   	push   %ebp
+  80069a:	89 e5                	mov    %esp,%ebp
+  80069c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8006a2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006a9:	00 00 00 
+	b.cnt = 0;
+  8006ac:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006b3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006b6:	ff 75 0c             	push   0xc(%ebp)
+  8006b9:	ff 75 08             	push   0x8(%ebp)
+  8006bc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006c2:	50                   	push   %eax
+  8006c3:	68 55 06 80 00       	push   $0x800655
+  8006c8:	e8 1c 01 00 00       	call   8007e9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8006cd:	83 c4 08             	add    $0x8,%esp
+  8006d0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8006d6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8006dc:	50                   	push   %eax
+  8006dd:	e8 77 0a 00 00       	call   801159 <sys_cputs>
+
+	return b.cnt;
+}
+  8006e2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8006e8:	c9                   	leave
+  8006e9:	c3                   	ret
+
+008006ea <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006ea:	55                   	push   %ebp
+  8006eb:	89 e5                	mov    %esp,%ebp
+  8006ed:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8006f0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8006f3:	50                   	push   %eax
+  8006f4:	ff 75 08             	push   0x8(%ebp)
+  8006f7:	e8 9d ff ff ff       	call   800699 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8006fc:	c9                   	leave
+  8006fd:	c3                   	ret
+
+008006fe <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006fe:	55                   	push   %ebp
+  8006ff:	89 e5                	mov    %esp,%ebp
+  800701:	57                   	push   %edi
+  800702:	56                   	push   %esi
+  800703:	53                   	push   %ebx
+  800704:	83 ec 1c             	sub    $0x1c,%esp
+  800707:	89 c3                	mov    %eax,%ebx
+  800709:	89 d6                	mov    %edx,%esi
+  80070b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800711:	89 d1                	mov    %edx,%ecx
+  800713:	89 c2                	mov    %eax,%edx
+  800715:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800718:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80071b:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80071e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800721:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800728:	39 c2                	cmp    %eax,%edx
+  80072a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80072d:	73 4b                	jae    80077a <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80072f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800732:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800735:	85 ff                	test   %edi,%edi
+  800737:	7e 11                	jle    80074a <printnum+0x4c>
+			putch(padc, putdat);
+  800739:	83 ec 08             	sub    $0x8,%esp
+  80073c:	56                   	push   %esi
+  80073d:	ff 75 18             	push   0x18(%ebp)
+  800740:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800742:	83 c4 10             	add    $0x10,%esp
+  800745:	83 ef 01             	sub    $0x1,%edi
+  800748:	75 ef                	jne    800739 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	56                   	push   %esi
+  80074e:	83 ec 04             	sub    $0x4,%esp
+  800751:	ff 75 e4             	push   -0x1c(%ebp)
+  800754:	ff 75 e0             	push   -0x20(%ebp)
+  800757:	ff 75 dc             	push   -0x24(%ebp)
+  80075a:	ff 75 d8             	push   -0x28(%ebp)
+  80075d:	e8 b2 43 00 00       	call   804b14 <__umoddi3>
+  800762:	83 c4 14             	add    $0x14,%esp
+  800765:	0f be 80 cf 4d 80 00 	movsbl 0x804dcf(%eax),%eax
+  80076c:	50                   	push   %eax
+  80076d:	ff d3                	call   *%ebx
+}
+  80076f:	83 c4 10             	add    $0x10,%esp
+  800772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800775:	5b                   	pop    %ebx
+  800776:	5e                   	pop    %esi
+  800777:	5f                   	pop    %edi
+  800778:	5d                   	pop    %ebp
+  800779:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80077a:	83 ec 0c             	sub    $0xc,%esp
+  80077d:	ff 75 18             	push   0x18(%ebp)
+  800780:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800783:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800786:	52                   	push   %edx
+  800787:	50                   	push   %eax
+  800788:	83 ec 08             	sub    $0x8,%esp
+  80078b:	ff 75 e4             	push   -0x1c(%ebp)
+  80078e:	ff 75 e0             	push   -0x20(%ebp)
+  800791:	ff 75 dc             	push   -0x24(%ebp)
+  800794:	ff 75 d8             	push   -0x28(%ebp)
+  800797:	e8 b2 42 00 00       	call   804a4e <__udivdi3>
+  80079c:	83 c4 18             	add    $0x18,%esp
+  80079f:	52                   	push   %edx
+  8007a0:	50                   	push   %eax
+  8007a1:	89 f2                	mov    %esi,%edx
+  8007a3:	89 d8                	mov    %ebx,%eax
+  8007a5:	e8 54 ff ff ff       	call   8006fe <printnum>
+  8007aa:	83 c4 20             	add    $0x20,%esp
+  8007ad:	eb 9b                	jmp    80074a <printnum+0x4c>
+
+008007af <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007af:	55                   	push   %ebp
+  8007b0:	89 e5                	mov    %esp,%ebp
+  8007b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8007b5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8007b9:	8b 10                	mov    (%eax),%edx
+  8007bb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007be:	73 0a                	jae    8007ca <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8007c0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007c3:	89 08                	mov    %ecx,(%eax)
+  8007c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007c8:	88 02                	mov    %al,(%edx)
+}
+  8007ca:	5d                   	pop    %ebp
+  8007cb:	c3                   	ret
+
+008007cc <printfmt>:
+{
+  8007cc:	55                   	push   %ebp
+  8007cd:	89 e5                	mov    %esp,%ebp
+  8007cf:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8007d2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8007d5:	50                   	push   %eax
+  8007d6:	ff 75 10             	push   0x10(%ebp)
+  8007d9:	ff 75 0c             	push   0xc(%ebp)
+  8007dc:	ff 75 08             	push   0x8(%ebp)
+  8007df:	e8 05 00 00 00       	call   8007e9 <vprintfmt>
+}
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+
+008007e9 <vprintfmt>:
+{
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	57                   	push   %edi
+  8007ed:	56                   	push   %esi
+  8007ee:	53                   	push   %ebx
+  8007ef:	83 ec 2c             	sub    $0x2c,%esp
+  8007f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007f5:	89 df                	mov    %ebx,%edi
+  8007f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007fa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8007fd:	8d 70 01             	lea    0x1(%eax),%esi
+  800800:	0f b6 00             	movzbl (%eax),%eax
+  800803:	83 f8 25             	cmp    $0x25,%eax
+  800806:	74 1e                	je     800826 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800808:	85 c0                	test   %eax,%eax
+  80080a:	0f 84 15 05 00 00    	je     800d25 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800810:	83 ec 08             	sub    $0x8,%esp
+  800813:	53                   	push   %ebx
+  800814:	50                   	push   %eax
+  800815:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800817:	83 c6 01             	add    $0x1,%esi
+  80081a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	83 f8 25             	cmp    $0x25,%eax
+  800824:	75 e2                	jne    800808 <vprintfmt+0x1f>
+		padc = ' ';
+  800826:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80082a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800831:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800838:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80083f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800844:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800847:	8d 56 01             	lea    0x1(%esi),%edx
+  80084a:	0f b6 0e             	movzbl (%esi),%ecx
+  80084d:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800850:	3c 55                	cmp    $0x55,%al
+  800852:	0f 87 3b 04 00 00    	ja     800c93 <vprintfmt+0x4aa>
+  800858:	0f b6 c0             	movzbl %al,%eax
+  80085b:	ff 24 85 40 4f 80 00 	jmp    *0x804f40(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800862:	89 75 10             	mov    %esi,0x10(%ebp)
+  800865:	eb 93                	jmp    8007fa <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800867:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800869:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80086d:	eb d8                	jmp    800847 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80086f:	89 d6                	mov    %edx,%esi
+  800871:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800875:	eb d0                	jmp    800847 <vprintfmt+0x5e>
+  800877:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80087a:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80087d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800880:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800884:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800887:	83 f9 09             	cmp    $0x9,%ecx
+  80088a:	77 6f                	ja     8008fb <vprintfmt+0x112>
+  80088c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80088f:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800892:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800895:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800899:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80089c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80089f:	83 fe 09             	cmp    $0x9,%esi
+  8008a2:	76 eb                	jbe    80088f <vprintfmt+0xa6>
+  8008a4:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8008a7:	89 d6                	mov    %edx,%esi
+  8008a9:	eb 13                	jmp    8008be <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8008ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ae:	8b 00                	mov    (%eax),%eax
+  8008b0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8008b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008bc:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8008be:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008c2:	79 83                	jns    800847 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8008c4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8008c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008ca:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8008d1:	e9 71 ff ff ff       	jmp    800847 <vprintfmt+0x5e>
+			if (width < 0)
+  8008d6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8008d9:	85 c9                	test   %ecx,%ecx
+  8008db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e0:	0f 49 c1             	cmovns %ecx,%eax
+  8008e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008e6:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8008e8:	e9 5a ff ff ff       	jmp    800847 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008ed:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8008ef:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8008f6:	e9 4c ff ff ff       	jmp    800847 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008fb:	89 d6                	mov    %edx,%esi
+  8008fd:	eb bf                	jmp    8008be <vprintfmt+0xd5>
+			lflag++;
+  8008ff:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800903:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800905:	e9 3d ff ff ff       	jmp    800847 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80090a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8d 70 04             	lea    0x4(%eax),%esi
+  800913:	83 ec 08             	sub    $0x8,%esp
+  800916:	53                   	push   %ebx
+  800917:	ff 30                	push   (%eax)
+  800919:	ff d7                	call   *%edi
+			break;
+  80091b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80091e:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800921:	e9 d4 fe ff ff       	jmp    8007fa <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800926:	89 55 10             	mov    %edx,0x10(%ebp)
+  800929:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092c:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80092f:	8b 10                	mov    (%eax),%edx
+  800931:	89 d0                	mov    %edx,%eax
+  800933:	f7 d8                	neg    %eax
+  800935:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800938:	83 f8 12             	cmp    $0x12,%eax
+  80093b:	7f 23                	jg     800960 <vprintfmt+0x177>
+  80093d:	8b 14 85 a0 50 80 00 	mov    0x8050a0(,%eax,4),%edx
+  800944:	85 d2                	test   %edx,%edx
+  800946:	74 18                	je     800960 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800948:	52                   	push   %edx
+  800949:	68 0b 53 80 00       	push   $0x80530b
+  80094e:	53                   	push   %ebx
+  80094f:	57                   	push   %edi
+  800950:	e8 77 fe ff ff       	call   8007cc <printfmt>
+  800955:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800958:	89 75 14             	mov    %esi,0x14(%ebp)
+  80095b:	e9 9a fe ff ff       	jmp    8007fa <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800960:	50                   	push   %eax
+  800961:	68 e7 4d 80 00       	push   $0x804de7
+  800966:	53                   	push   %ebx
+  800967:	57                   	push   %edi
+  800968:	e8 5f fe ff ff       	call   8007cc <printfmt>
+  80096d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800970:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800973:	e9 82 fe ff ff       	jmp    8007fa <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800978:	89 55 10             	mov    %edx,0x10(%ebp)
+  80097b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097e:	83 c0 04             	add    $0x4,%eax
+  800981:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800984:	8b 45 14             	mov    0x14(%ebp),%eax
+  800987:	8b 00                	mov    (%eax),%eax
+  800989:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80098c:	85 c0                	test   %eax,%eax
+  80098e:	0f 84 61 03 00 00    	je     800cf5 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800994:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800998:	7e 06                	jle    8009a0 <vprintfmt+0x1b7>
+  80099a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80099e:	75 29                	jne    8009c9 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009a3:	8d 70 01             	lea    0x1(%eax),%esi
+  8009a6:	0f b6 00             	movzbl (%eax),%eax
+  8009a9:	0f be d0             	movsbl %al,%edx
+  8009ac:	85 d2                	test   %edx,%edx
+  8009ae:	0f 84 bb 00 00 00    	je     800a6f <vprintfmt+0x286>
+  8009b4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009b7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009ba:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009bd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009c0:	eb 7a                	jmp    800a3c <vprintfmt+0x253>
+				p = "(null)";
+  8009c2:	c7 45 d0 e0 4d 80 00 	movl   $0x804de0,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009c9:	83 ec 08             	sub    $0x8,%esp
+  8009cc:	ff 75 d4             	push   -0x2c(%ebp)
+  8009cf:	ff 75 d0             	push   -0x30(%ebp)
+  8009d2:	e8 e0 03 00 00       	call   800db7 <strnlen>
+  8009d7:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8009da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8009dd:	83 c4 10             	add    $0x10,%esp
+  8009e0:	85 d2                	test   %edx,%edx
+  8009e2:	0f 8e d6 02 00 00    	jle    800cbe <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8009e8:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8009ec:	83 ec 08             	sub    $0x8,%esp
+  8009ef:	53                   	push   %ebx
+  8009f0:	56                   	push   %esi
+  8009f1:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009f3:	83 c4 10             	add    $0x10,%esp
+  8009f6:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8009fa:	75 f0                	jne    8009ec <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009fc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009ff:	8d 70 01             	lea    0x1(%eax),%esi
+  800a02:	0f b6 00             	movzbl (%eax),%eax
+  800a05:	0f be d0             	movsbl %al,%edx
+  800a08:	85 d2                	test   %edx,%edx
+  800a0a:	0f 84 da 02 00 00    	je     800cea <vprintfmt+0x501>
+  800a10:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a13:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a16:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a19:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a1c:	eb 1e                	jmp    800a3c <vprintfmt+0x253>
+					putch(ch, putdat);
+  800a1e:	83 ec 08             	sub    $0x8,%esp
+  800a21:	ff 75 0c             	push   0xc(%ebp)
+  800a24:	52                   	push   %edx
+  800a25:	ff 55 08             	call   *0x8(%ebp)
+  800a28:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a2b:	83 eb 01             	sub    $0x1,%ebx
+  800a2e:	83 c6 01             	add    $0x1,%esi
+  800a31:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a35:	0f be d0             	movsbl %al,%edx
+  800a38:	85 d2                	test   %edx,%edx
+  800a3a:	74 2a                	je     800a66 <vprintfmt+0x27d>
+  800a3c:	85 ff                	test   %edi,%edi
+  800a3e:	78 05                	js     800a45 <vprintfmt+0x25c>
+  800a40:	83 ef 01             	sub    $0x1,%edi
+  800a43:	78 59                	js     800a9e <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a45:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a49:	74 d3                	je     800a1e <vprintfmt+0x235>
+  800a4b:	0f be c0             	movsbl %al,%eax
+  800a4e:	83 e8 20             	sub    $0x20,%eax
+  800a51:	83 f8 5e             	cmp    $0x5e,%eax
+  800a54:	76 c8                	jbe    800a1e <vprintfmt+0x235>
+					putch('?', putdat);
+  800a56:	83 ec 08             	sub    $0x8,%esp
+  800a59:	ff 75 0c             	push   0xc(%ebp)
+  800a5c:	6a 3f                	push   $0x3f
+  800a5e:	ff 55 08             	call   *0x8(%ebp)
+  800a61:	83 c4 10             	add    $0x10,%esp
+  800a64:	eb c5                	jmp    800a2b <vprintfmt+0x242>
+  800a66:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800a69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800a6f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800a72:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a76:	7e 1b                	jle    800a93 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800a78:	83 ec 08             	sub    $0x8,%esp
+  800a7b:	53                   	push   %ebx
+  800a7c:	6a 20                	push   $0x20
+  800a7e:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800a80:	83 c4 10             	add    $0x10,%esp
+  800a83:	83 ee 01             	sub    $0x1,%esi
+  800a86:	75 f0                	jne    800a78 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a88:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a8b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a8e:	e9 67 fd ff ff       	jmp    8007fa <vprintfmt+0x11>
+  800a93:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a96:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a99:	e9 5c fd ff ff       	jmp    8007fa <vprintfmt+0x11>
+  800a9e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800aa1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aa4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800aa7:	eb c6                	jmp    800a6f <vprintfmt+0x286>
+	if (lflag >= 2)
+  800aa9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800aac:	89 55 10             	mov    %edx,0x10(%ebp)
+  800aaf:	83 f9 01             	cmp    $0x1,%ecx
+  800ab2:	7f 1f                	jg     800ad3 <vprintfmt+0x2ea>
+	else if (lflag)
+  800ab4:	85 c9                	test   %ecx,%ecx
+  800ab6:	74 67                	je     800b1f <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800ab8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abb:	8b 30                	mov    (%eax),%esi
+  800abd:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800ac0:	89 f0                	mov    %esi,%eax
+  800ac2:	c1 f8 1f             	sar    $0x1f,%eax
+  800ac5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800ac8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800acb:	8d 40 04             	lea    0x4(%eax),%eax
+  800ace:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad1:	eb 17                	jmp    800aea <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800ad3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad6:	8b 50 04             	mov    0x4(%eax),%edx
+  800ad9:	8b 00                	mov    (%eax),%eax
+  800adb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ade:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ae1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae4:	8d 40 08             	lea    0x8(%eax),%eax
+  800ae7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800aea:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800aed:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800af0:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800af5:	85 c9                	test   %ecx,%ecx
+  800af7:	0f 89 12 01 00 00    	jns    800c0f <vprintfmt+0x426>
+				putch('-', putdat);
+  800afd:	83 ec 08             	sub    $0x8,%esp
+  800b00:	53                   	push   %ebx
+  800b01:	6a 2d                	push   $0x2d
+  800b03:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800b05:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b08:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b0b:	f7 da                	neg    %edx
+  800b0d:	83 d1 00             	adc    $0x0,%ecx
+  800b10:	f7 d9                	neg    %ecx
+  800b12:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b15:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b1a:	e9 f0 00 00 00       	jmp    800c0f <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800b1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b22:	8b 30                	mov    (%eax),%esi
+  800b24:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b27:	89 f0                	mov    %esi,%eax
+  800b29:	c1 f8 1f             	sar    $0x1f,%eax
+  800b2c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b32:	8d 40 04             	lea    0x4(%eax),%eax
+  800b35:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b38:	eb b0                	jmp    800aea <vprintfmt+0x301>
+	if (lflag >= 2)
+  800b3a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b3d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b40:	83 f9 01             	cmp    $0x1,%ecx
+  800b43:	7f 1e                	jg     800b63 <vprintfmt+0x37a>
+	else if (lflag)
+  800b45:	85 c9                	test   %ecx,%ecx
+  800b47:	74 32                	je     800b7b <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800b49:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4c:	8b 10                	mov    (%eax),%edx
+  800b4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b53:	8d 40 04             	lea    0x4(%eax),%eax
+  800b56:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b59:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800b5e:	e9 ac 00 00 00       	jmp    800c0f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b63:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b66:	8b 10                	mov    (%eax),%edx
+  800b68:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b6b:	8d 40 08             	lea    0x8(%eax),%eax
+  800b6e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b71:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800b76:	e9 94 00 00 00       	jmp    800c0f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b7b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b7e:	8b 10                	mov    (%eax),%edx
+  800b80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b85:	8d 40 04             	lea    0x4(%eax),%eax
+  800b88:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b8b:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800b90:	eb 7d                	jmp    800c0f <vprintfmt+0x426>
+	if (lflag >= 2)
+  800b92:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b95:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b98:	83 f9 01             	cmp    $0x1,%ecx
+  800b9b:	7f 1b                	jg     800bb8 <vprintfmt+0x3cf>
+	else if (lflag)
+  800b9d:	85 c9                	test   %ecx,%ecx
+  800b9f:	74 2c                	je     800bcd <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800ba1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba4:	8b 10                	mov    (%eax),%edx
+  800ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bab:	8d 40 04             	lea    0x4(%eax),%eax
+  800bae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bb1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800bb6:	eb 57                	jmp    800c0f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800bb8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bbb:	8b 10                	mov    (%eax),%edx
+  800bbd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bc0:	8d 40 08             	lea    0x8(%eax),%eax
+  800bc3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bc6:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800bcb:	eb 42                	jmp    800c0f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800bcd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd0:	8b 10                	mov    (%eax),%edx
+  800bd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd7:	8d 40 04             	lea    0x4(%eax),%eax
+  800bda:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bdd:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800be2:	eb 2b                	jmp    800c0f <vprintfmt+0x426>
+			putch('0', putdat);
+  800be4:	89 55 10             	mov    %edx,0x10(%ebp)
+  800be7:	83 ec 08             	sub    $0x8,%esp
+  800bea:	53                   	push   %ebx
+  800beb:	6a 30                	push   $0x30
+  800bed:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800bef:	83 c4 08             	add    $0x8,%esp
+  800bf2:	53                   	push   %ebx
+  800bf3:	6a 78                	push   $0x78
+  800bf5:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800bf7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bfa:	8b 10                	mov    (%eax),%edx
+  800bfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c01:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c04:	8d 40 04             	lea    0x4(%eax),%eax
+  800c07:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c0a:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800c0f:	83 ec 0c             	sub    $0xc,%esp
+  800c12:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800c16:	50                   	push   %eax
+  800c17:	ff 75 e4             	push   -0x1c(%ebp)
+  800c1a:	56                   	push   %esi
+  800c1b:	51                   	push   %ecx
+  800c1c:	52                   	push   %edx
+  800c1d:	89 da                	mov    %ebx,%edx
+  800c1f:	89 f8                	mov    %edi,%eax
+  800c21:	e8 d8 fa ff ff       	call   8006fe <printnum>
+			break;
+  800c26:	83 c4 20             	add    $0x20,%esp
+  800c29:	e9 cc fb ff ff       	jmp    8007fa <vprintfmt+0x11>
+	if (lflag >= 2)
+  800c2e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c31:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c34:	83 f9 01             	cmp    $0x1,%ecx
+  800c37:	7f 1b                	jg     800c54 <vprintfmt+0x46b>
+	else if (lflag)
+  800c39:	85 c9                	test   %ecx,%ecx
+  800c3b:	74 2c                	je     800c69 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800c3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c40:	8b 10                	mov    (%eax),%edx
+  800c42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c47:	8d 40 04             	lea    0x4(%eax),%eax
+  800c4a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c4d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800c52:	eb bb                	jmp    800c0f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800c54:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c57:	8b 10                	mov    (%eax),%edx
+  800c59:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c5c:	8d 40 08             	lea    0x8(%eax),%eax
+  800c5f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c62:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800c67:	eb a6                	jmp    800c0f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800c69:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c6c:	8b 10                	mov    (%eax),%edx
+  800c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c73:	8d 40 04             	lea    0x4(%eax),%eax
+  800c76:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c79:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800c7e:	eb 8f                	jmp    800c0f <vprintfmt+0x426>
+			putch(ch, putdat);
+  800c80:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c83:	83 ec 08             	sub    $0x8,%esp
+  800c86:	53                   	push   %ebx
+  800c87:	6a 25                	push   $0x25
+  800c89:	ff d7                	call   *%edi
+			break;
+  800c8b:	83 c4 10             	add    $0x10,%esp
+  800c8e:	e9 67 fb ff ff       	jmp    8007fa <vprintfmt+0x11>
+			putch('%', putdat);
+  800c93:	83 ec 08             	sub    $0x8,%esp
+  800c96:	53                   	push   %ebx
+  800c97:	6a 25                	push   $0x25
+  800c99:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c9b:	83 c4 10             	add    $0x10,%esp
+  800c9e:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800ca2:	0f 84 ba fb ff ff    	je     800862 <vprintfmt+0x79>
+  800ca8:	89 75 10             	mov    %esi,0x10(%ebp)
+  800cab:	89 f0                	mov    %esi,%eax
+  800cad:	83 e8 01             	sub    $0x1,%eax
+  800cb0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800cb4:	75 f7                	jne    800cad <vprintfmt+0x4c4>
+  800cb6:	89 45 10             	mov    %eax,0x10(%ebp)
+  800cb9:	e9 3c fb ff ff       	jmp    8007fa <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cbe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800cc1:	8d 70 01             	lea    0x1(%eax),%esi
+  800cc4:	0f b6 00             	movzbl (%eax),%eax
+  800cc7:	0f be d0             	movsbl %al,%edx
+  800cca:	85 d2                	test   %edx,%edx
+  800ccc:	74 11                	je     800cdf <vprintfmt+0x4f6>
+  800cce:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800cd1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800cd4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800cd7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cda:	e9 5d fd ff ff       	jmp    800a3c <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800cdf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ce2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ce5:	e9 10 fb ff ff       	jmp    8007fa <vprintfmt+0x11>
+  800cea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ced:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cf0:	e9 05 fb ff ff       	jmp    8007fa <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800cf5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800cf9:	7e 0a                	jle    800d05 <vprintfmt+0x51c>
+  800cfb:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800cff:	0f 85 bd fc ff ff    	jne    8009c2 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d05:	ba 28 00 00 00       	mov    $0x28,%edx
+  800d0a:	b8 28 00 00 00       	mov    $0x28,%eax
+  800d0f:	be e1 4d 80 00       	mov    $0x804de1,%esi
+  800d14:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d17:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d1a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d1d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d20:	e9 17 fd ff ff       	jmp    800a3c <vprintfmt+0x253>
+}
+  800d25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d28:	5b                   	pop    %ebx
+  800d29:	5e                   	pop    %esi
+  800d2a:	5f                   	pop    %edi
+  800d2b:	5d                   	pop    %ebp
+  800d2c:	c3                   	ret
+
+00800d2d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	83 ec 18             	sub    $0x18,%esp
+  800d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d36:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800d39:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d3c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d40:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d43:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d4a:	85 c0                	test   %eax,%eax
+  800d4c:	74 26                	je     800d74 <vsnprintf+0x47>
+  800d4e:	85 d2                	test   %edx,%edx
+  800d50:	7e 22                	jle    800d74 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d52:	ff 75 14             	push   0x14(%ebp)
+  800d55:	ff 75 10             	push   0x10(%ebp)
+  800d58:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d5b:	50                   	push   %eax
+  800d5c:	68 af 07 80 00       	push   $0x8007af
+  800d61:	e8 83 fa ff ff       	call   8007e9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d66:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d69:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d6f:	83 c4 10             	add    $0x10,%esp
+}
+  800d72:	c9                   	leave
+  800d73:	c3                   	ret
+		return -E_INVAL;
+  800d74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d79:	eb f7                	jmp    800d72 <vsnprintf+0x45>
+
+00800d7b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d81:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d84:	50                   	push   %eax
+  800d85:	ff 75 10             	push   0x10(%ebp)
+  800d88:	ff 75 0c             	push   0xc(%ebp)
+  800d8b:	ff 75 08             	push   0x8(%ebp)
+  800d8e:	e8 9a ff ff ff       	call   800d2d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d93:	c9                   	leave
+  800d94:	c3                   	ret
+
+00800d95 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d9b:	80 3a 00             	cmpb   $0x0,(%edx)
+  800d9e:	74 10                	je     800db0 <strlen+0x1b>
+  800da0:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800da5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800da8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800dac:	75 f7                	jne    800da5 <strlen+0x10>
+	return n;
+}
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800db0:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800db5:	eb f7                	jmp    800dae <strlen+0x19>
+
+00800db7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dc0:	85 d2                	test   %edx,%edx
+  800dc2:	74 16                	je     800dda <strnlen+0x23>
+  800dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800dcd:	74 09                	je     800dd8 <strnlen+0x21>
+		n++;
+  800dcf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dd2:	39 d0                	cmp    %edx,%eax
+  800dd4:	75 f3                	jne    800dc9 <strnlen+0x12>
+		n++;
+  800dd6:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddf:	eb f7                	jmp    800dd8 <strnlen+0x21>
+
+00800de1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	53                   	push   %ebx
+  800de5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800de8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800df4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800df7:	83 c0 01             	add    $0x1,%eax
+  800dfa:	84 d2                	test   %dl,%dl
+  800dfc:	75 f2                	jne    800df0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800dfe:	89 c8                	mov    %ecx,%eax
+  800e00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e03:	c9                   	leave
+  800e04:	c3                   	ret
+
+00800e05 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 10             	sub    $0x10,%esp
+  800e0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e0f:	53                   	push   %ebx
+  800e10:	e8 80 ff ff ff       	call   800d95 <strlen>
+  800e15:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e18:	ff 75 0c             	push   0xc(%ebp)
+  800e1b:	01 d8                	add    %ebx,%eax
+  800e1d:	50                   	push   %eax
+  800e1e:	e8 be ff ff ff       	call   800de1 <strcpy>
+	return dst;
+}
+  800e23:	89 d8                	mov    %ebx,%eax
+  800e25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e28:	c9                   	leave
+  800e29:	c3                   	ret
+
+00800e2a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e32:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800e38:	85 db                	test   %ebx,%ebx
+  800e3a:	74 17                	je     800e53 <strncpy+0x29>
+  800e3c:	01 f3                	add    %esi,%ebx
+  800e3e:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800e40:	83 c0 01             	add    $0x1,%eax
+  800e43:	0f b6 0a             	movzbl (%edx),%ecx
+  800e46:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800e49:	80 f9 01             	cmp    $0x1,%cl
+  800e4c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e4f:	39 c3                	cmp    %eax,%ebx
+  800e51:	75 ed                	jne    800e40 <strncpy+0x16>
+	}
+	return ret;
+}
+  800e53:	89 f0                	mov    %esi,%eax
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+
+00800e59 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	56                   	push   %esi
+  800e5d:	53                   	push   %ebx
+  800e5e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e67:	89 f0                	mov    %esi,%eax
+  800e69:	85 db                	test   %ebx,%ebx
+  800e6b:	74 1e                	je     800e8b <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800e6d:	83 eb 01             	sub    $0x1,%ebx
+  800e70:	74 16                	je     800e88 <strlcpy+0x2f>
+  800e72:	01 f3                	add    %esi,%ebx
+  800e74:	0f b6 0a             	movzbl (%edx),%ecx
+  800e77:	84 c9                	test   %cl,%cl
+  800e79:	74 0d                	je     800e88 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800e7b:	83 c2 01             	add    $0x1,%edx
+  800e7e:	83 c0 01             	add    $0x1,%eax
+  800e81:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800e84:	39 d8                	cmp    %ebx,%eax
+  800e86:	75 ec                	jne    800e74 <strlcpy+0x1b>
+		*dst = '\0';
+  800e88:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e8b:	29 f0                	sub    %esi,%eax
+}
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+
+00800e91 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e97:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e9a:	0f b6 01             	movzbl (%ecx),%eax
+  800e9d:	84 c0                	test   %al,%al
+  800e9f:	74 11                	je     800eb2 <strcmp+0x21>
+  800ea1:	38 02                	cmp    %al,(%edx)
+  800ea3:	75 0d                	jne    800eb2 <strcmp+0x21>
+		p++, q++;
+  800ea5:	83 c1 01             	add    $0x1,%ecx
+  800ea8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800eab:	0f b6 01             	movzbl (%ecx),%eax
+  800eae:	84 c0                	test   %al,%al
+  800eb0:	75 ef                	jne    800ea1 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800eb2:	0f b6 c0             	movzbl %al,%eax
+  800eb5:	0f b6 12             	movzbl (%edx),%edx
+  800eb8:	29 d0                	sub    %edx,%eax
+}
+  800eba:	5d                   	pop    %ebp
+  800ebb:	c3                   	ret
+
+00800ebc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ebc:	55                   	push   %ebp
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	53                   	push   %ebx
+  800ec0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ec3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ec6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800ece:	85 d2                	test   %edx,%edx
+  800ed0:	74 2e                	je     800f00 <strncmp+0x44>
+  800ed2:	0f b6 01             	movzbl (%ecx),%eax
+  800ed5:	84 c0                	test   %al,%al
+  800ed7:	74 16                	je     800eef <strncmp+0x33>
+  800ed9:	3a 03                	cmp    (%ebx),%al
+  800edb:	75 12                	jne    800eef <strncmp+0x33>
+		n--, p++, q++;
+  800edd:	83 c1 01             	add    $0x1,%ecx
+  800ee0:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800ee3:	83 ea 01             	sub    $0x1,%edx
+  800ee6:	75 ea                	jne    800ed2 <strncmp+0x16>
+		return 0;
+  800ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eed:	eb 11                	jmp    800f00 <strncmp+0x44>
+  800eef:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800ef4:	85 d2                	test   %edx,%edx
+  800ef6:	74 08                	je     800f00 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ef8:	0f b6 01             	movzbl (%ecx),%eax
+  800efb:	0f b6 13             	movzbl (%ebx),%edx
+  800efe:	29 d0                	sub    %edx,%eax
+}
+  800f00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f03:	c9                   	leave
+  800f04:	c3                   	ret
+
+00800f05 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f0f:	0f b6 10             	movzbl (%eax),%edx
+  800f12:	84 d2                	test   %dl,%dl
+  800f14:	74 15                	je     800f2b <strchr+0x26>
+		if (*s == c)
+  800f16:	38 d1                	cmp    %dl,%cl
+  800f18:	74 0f                	je     800f29 <strchr+0x24>
+	for (; *s; s++)
+  800f1a:	83 c0 01             	add    $0x1,%eax
+  800f1d:	0f b6 10             	movzbl (%eax),%edx
+  800f20:	84 d2                	test   %dl,%dl
+  800f22:	75 f2                	jne    800f16 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800f24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+	return 0;
+  800f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f30:	eb f7                	jmp    800f29 <strchr+0x24>
+
+00800f32 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	53                   	push   %ebx
+  800f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f39:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800f3c:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800f3f:	38 d3                	cmp    %dl,%bl
+  800f41:	74 14                	je     800f57 <strfind+0x25>
+  800f43:	89 d1                	mov    %edx,%ecx
+  800f45:	84 db                	test   %bl,%bl
+  800f47:	74 0e                	je     800f57 <strfind+0x25>
+	for (; *s; s++)
+  800f49:	83 c0 01             	add    $0x1,%eax
+  800f4c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800f4f:	38 ca                	cmp    %cl,%dl
+  800f51:	74 04                	je     800f57 <strfind+0x25>
+  800f53:	84 d2                	test   %dl,%dl
+  800f55:	75 f2                	jne    800f49 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800f57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f5a:	c9                   	leave
+  800f5b:	c3                   	ret
+
+00800f5c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f66:	85 c9                	test   %ecx,%ecx
+  800f68:	74 20                	je     800f8a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f6a:	89 f8                	mov    %edi,%eax
+  800f6c:	09 c8                	or     %ecx,%eax
+  800f6e:	a8 03                	test   $0x3,%al
+  800f70:	75 12                	jne    800f84 <memset+0x28>
+		c &= 0xFF;
+  800f72:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f76:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f7c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f7f:	fc                   	cld
+  800f80:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f82:	eb 06                	jmp    800f8a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f87:	fc                   	cld
+  800f88:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f8a:	89 f8                	mov    %edi,%eax
+  800f8c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f8f:	c9                   	leave
+  800f90:	c3                   	ret
+
+00800f91 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	56                   	push   %esi
+  800f96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f99:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f9c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f9f:	39 c6                	cmp    %eax,%esi
+  800fa1:	73 32                	jae    800fd5 <memmove+0x44>
+  800fa3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800fa6:	39 d0                	cmp    %edx,%eax
+  800fa8:	73 2b                	jae    800fd5 <memmove+0x44>
+		s += n;
+		d += n;
+  800faa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800fad:	89 d6                	mov    %edx,%esi
+  800faf:	09 fe                	or     %edi,%esi
+  800fb1:	09 ce                	or     %ecx,%esi
+  800fb3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800fb9:	75 0e                	jne    800fc9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800fbb:	83 ef 04             	sub    $0x4,%edi
+  800fbe:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800fc1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800fc4:	fd                   	std
+  800fc5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800fc7:	eb 09                	jmp    800fd2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800fc9:	83 ef 01             	sub    $0x1,%edi
+  800fcc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800fcf:	fd                   	std
+  800fd0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800fd2:	fc                   	cld
+  800fd3:	eb 1a                	jmp    800fef <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800fd5:	89 f2                	mov    %esi,%edx
+  800fd7:	09 c2                	or     %eax,%edx
+  800fd9:	09 ca                	or     %ecx,%edx
+  800fdb:	f6 c2 03             	test   $0x3,%dl
+  800fde:	75 0a                	jne    800fea <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800fe0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800fe3:	89 c7                	mov    %eax,%edi
+  800fe5:	fc                   	cld
+  800fe6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800fe8:	eb 05                	jmp    800fef <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800fea:	89 c7                	mov    %eax,%edi
+  800fec:	fc                   	cld
+  800fed:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+
+00800ff3 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ff9:	ff 75 10             	push   0x10(%ebp)
+  800ffc:	ff 75 0c             	push   0xc(%ebp)
+  800fff:	ff 75 08             	push   0x8(%ebp)
+  801002:	e8 8a ff ff ff       	call   800f91 <memmove>
+}
+  801007:	c9                   	leave
+  801008:	c3                   	ret
+
+00801009 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	56                   	push   %esi
+  80100d:	53                   	push   %ebx
+  80100e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801011:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801014:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801017:	85 f6                	test   %esi,%esi
+  801019:	74 29                	je     801044 <memcmp+0x3b>
+  80101b:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  80101d:	0f b6 08             	movzbl (%eax),%ecx
+  801020:	0f b6 1a             	movzbl (%edx),%ebx
+  801023:	38 d9                	cmp    %bl,%cl
+  801025:	75 11                	jne    801038 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801027:	83 c0 01             	add    $0x1,%eax
+  80102a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80102d:	39 c6                	cmp    %eax,%esi
+  80102f:	75 ec                	jne    80101d <memcmp+0x14>
+	}
+
+	return 0;
+  801031:	b8 00 00 00 00       	mov    $0x0,%eax
+  801036:	eb 08                	jmp    801040 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  801038:	0f b6 c1             	movzbl %cl,%eax
+  80103b:	0f b6 db             	movzbl %bl,%ebx
+  80103e:	29 d8                	sub    %ebx,%eax
+}
+  801040:	5b                   	pop    %ebx
+  801041:	5e                   	pop    %esi
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+	return 0;
+  801044:	b8 00 00 00 00       	mov    $0x0,%eax
+  801049:	eb f5                	jmp    801040 <memcmp+0x37>
+
+0080104b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80104b:	55                   	push   %ebp
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801054:	89 c2                	mov    %eax,%edx
+  801056:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801059:	39 d0                	cmp    %edx,%eax
+  80105b:	73 0d                	jae    80106a <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80105d:	38 08                	cmp    %cl,(%eax)
+  80105f:	74 0d                	je     80106e <memfind+0x23>
+	for (; s < ends; s++)
+  801061:	83 c0 01             	add    $0x1,%eax
+  801064:	39 c2                	cmp    %eax,%edx
+  801066:	75 f5                	jne    80105d <memfind+0x12>
+  801068:	eb 06                	jmp    801070 <memfind+0x25>
+  80106a:	89 c2                	mov    %eax,%edx
+  80106c:	eb 02                	jmp    801070 <memfind+0x25>
+  80106e:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  801070:	89 d0                	mov    %edx,%eax
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+
+00801074 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	57                   	push   %edi
+  801078:	56                   	push   %esi
+  801079:	53                   	push   %ebx
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801080:	0f b6 02             	movzbl (%edx),%eax
+  801083:	3c 20                	cmp    $0x20,%al
+  801085:	74 04                	je     80108b <strtol+0x17>
+  801087:	3c 09                	cmp    $0x9,%al
+  801089:	75 0e                	jne    801099 <strtol+0x25>
+		s++;
+  80108b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80108e:	0f b6 02             	movzbl (%edx),%eax
+  801091:	3c 20                	cmp    $0x20,%al
+  801093:	74 f6                	je     80108b <strtol+0x17>
+  801095:	3c 09                	cmp    $0x9,%al
+  801097:	74 f2                	je     80108b <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  801099:	3c 2b                	cmp    $0x2b,%al
+  80109b:	74 2a                	je     8010c7 <strtol+0x53>
+	int neg = 0;
+  80109d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8010a2:	3c 2d                	cmp    $0x2d,%al
+  8010a4:	74 2b                	je     8010d1 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010a6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8010ac:	75 0f                	jne    8010bd <strtol+0x49>
+  8010ae:	80 3a 30             	cmpb   $0x30,(%edx)
+  8010b1:	74 28                	je     8010db <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8010b3:	85 db                	test   %ebx,%ebx
+  8010b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ba:	0f 44 d8             	cmove  %eax,%ebx
+  8010bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8010c5:	eb 46                	jmp    80110d <strtol+0x99>
+		s++;
+  8010c7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8010ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010cf:	eb d5                	jmp    8010a6 <strtol+0x32>
+		s++, neg = 1;
+  8010d1:	83 c2 01             	add    $0x1,%edx
+  8010d4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8010d9:	eb cb                	jmp    8010a6 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010db:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8010df:	74 0e                	je     8010ef <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8010e1:	85 db                	test   %ebx,%ebx
+  8010e3:	75 d8                	jne    8010bd <strtol+0x49>
+		s++, base = 8;
+  8010e5:	83 c2 01             	add    $0x1,%edx
+  8010e8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8010ed:	eb ce                	jmp    8010bd <strtol+0x49>
+		s += 2, base = 16;
+  8010ef:	83 c2 02             	add    $0x2,%edx
+  8010f2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8010f7:	eb c4                	jmp    8010bd <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8010f9:	0f be c0             	movsbl %al,%eax
+  8010fc:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8010ff:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801102:	7d 3a                	jge    80113e <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  801104:	83 c2 01             	add    $0x1,%edx
+  801107:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80110b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80110d:	0f b6 02             	movzbl (%edx),%eax
+  801110:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801113:	89 f3                	mov    %esi,%ebx
+  801115:	80 fb 09             	cmp    $0x9,%bl
+  801118:	76 df                	jbe    8010f9 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  80111a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80111d:	89 f3                	mov    %esi,%ebx
+  80111f:	80 fb 19             	cmp    $0x19,%bl
+  801122:	77 08                	ja     80112c <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  801124:	0f be c0             	movsbl %al,%eax
+  801127:	83 e8 57             	sub    $0x57,%eax
+  80112a:	eb d3                	jmp    8010ff <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80112c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80112f:	89 f3                	mov    %esi,%ebx
+  801131:	80 fb 19             	cmp    $0x19,%bl
+  801134:	77 08                	ja     80113e <strtol+0xca>
+			dig = *s - 'A' + 10;
+  801136:	0f be c0             	movsbl %al,%eax
+  801139:	83 e8 37             	sub    $0x37,%eax
+  80113c:	eb c1                	jmp    8010ff <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80113e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801142:	74 05                	je     801149 <strtol+0xd5>
+		*endptr = (char *) s;
+  801144:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801147:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801149:	89 c8                	mov    %ecx,%eax
+  80114b:	f7 d8                	neg    %eax
+  80114d:	85 ff                	test   %edi,%edi
+  80114f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801152:	89 c8                	mov    %ecx,%eax
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5f                   	pop    %edi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+
+00801159 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801164:	8b 55 08             	mov    0x8(%ebp),%edx
+  801167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116a:	89 c3                	mov    %eax,%ebx
+  80116c:	89 c7                	mov    %eax,%edi
+  80116e:	89 c6                	mov    %eax,%esi
+  801170:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801172:	5b                   	pop    %ebx
+  801173:	5e                   	pop    %esi
+  801174:	5f                   	pop    %edi
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+
+00801177 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	57                   	push   %edi
+  80117b:	56                   	push   %esi
+  80117c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80117d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801182:	b8 01 00 00 00       	mov    $0x1,%eax
+  801187:	89 d1                	mov    %edx,%ecx
+  801189:	89 d3                	mov    %edx,%ebx
+  80118b:	89 d7                	mov    %edx,%edi
+  80118d:	89 d6                	mov    %edx,%esi
+  80118f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801191:	5b                   	pop    %ebx
+  801192:	5e                   	pop    %esi
+  801193:	5f                   	pop    %edi
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+
+00801196 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+  801199:	57                   	push   %edi
+  80119a:	56                   	push   %esi
+  80119b:	53                   	push   %ebx
+  80119c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80119f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011ac:	89 cb                	mov    %ecx,%ebx
+  8011ae:	89 cf                	mov    %ecx,%edi
+  8011b0:	89 ce                	mov    %ecx,%esi
+  8011b2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b4:	85 c0                	test   %eax,%eax
+  8011b6:	7f 08                	jg     8011c0 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8011b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bb:	5b                   	pop    %ebx
+  8011bc:	5e                   	pop    %esi
+  8011bd:	5f                   	pop    %edi
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c0:	83 ec 0c             	sub    $0xc,%esp
+  8011c3:	50                   	push   %eax
+  8011c4:	6a 03                	push   $0x3
+  8011c6:	68 0b 51 80 00       	push   $0x80510b
+  8011cb:	6a 23                	push   $0x23
+  8011cd:	68 28 51 80 00       	push   $0x805128
+  8011d2:	e8 38 f4 ff ff       	call   80060f <_panic>
+
+008011d7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	57                   	push   %edi
+  8011db:	56                   	push   %esi
+  8011dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8011e7:	89 d1                	mov    %edx,%ecx
+  8011e9:	89 d3                	mov    %edx,%ebx
+  8011eb:	89 d7                	mov    %edx,%edi
+  8011ed:	89 d6                	mov    %edx,%esi
+  8011ef:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8011f1:	5b                   	pop    %ebx
+  8011f2:	5e                   	pop    %esi
+  8011f3:	5f                   	pop    %edi
+  8011f4:	5d                   	pop    %ebp
+  8011f5:	c3                   	ret
+
+008011f6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	57                   	push   %edi
+  8011fa:	56                   	push   %esi
+  8011fb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801201:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801206:	89 d1                	mov    %edx,%ecx
+  801208:	89 d3                	mov    %edx,%ebx
+  80120a:	89 d7                	mov    %edx,%edi
+  80120c:	89 d6                	mov    %edx,%esi
+  80120e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801210:	5b                   	pop    %ebx
+  801211:	5e                   	pop    %esi
+  801212:	5f                   	pop    %edi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+
+00801215 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	57                   	push   %edi
+  801219:	56                   	push   %esi
+  80121a:	53                   	push   %ebx
+  80121b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80121e:	be 00 00 00 00       	mov    $0x0,%esi
+  801223:	8b 55 08             	mov    0x8(%ebp),%edx
+  801226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801229:	b8 04 00 00 00       	mov    $0x4,%eax
+  80122e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801231:	89 f7                	mov    %esi,%edi
+  801233:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801235:	85 c0                	test   %eax,%eax
+  801237:	7f 08                	jg     801241 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801239:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801241:	83 ec 0c             	sub    $0xc,%esp
+  801244:	50                   	push   %eax
+  801245:	6a 04                	push   $0x4
+  801247:	68 0b 51 80 00       	push   $0x80510b
+  80124c:	6a 23                	push   $0x23
+  80124e:	68 28 51 80 00       	push   $0x805128
+  801253:	e8 b7 f3 ff ff       	call   80060f <_panic>
+
+00801258 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	57                   	push   %edi
+  80125c:	56                   	push   %esi
+  80125d:	53                   	push   %ebx
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801261:	8b 55 08             	mov    0x8(%ebp),%edx
+  801264:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801267:	b8 05 00 00 00       	mov    $0x5,%eax
+  80126c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801272:	8b 75 18             	mov    0x18(%ebp),%esi
+  801275:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801277:	85 c0                	test   %eax,%eax
+  801279:	7f 08                	jg     801283 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80127b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801283:	83 ec 0c             	sub    $0xc,%esp
+  801286:	50                   	push   %eax
+  801287:	6a 05                	push   $0x5
+  801289:	68 0b 51 80 00       	push   $0x80510b
+  80128e:	6a 23                	push   $0x23
+  801290:	68 28 51 80 00       	push   $0x805128
+  801295:	e8 75 f3 ff ff       	call   80060f <_panic>
+
+0080129a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	57                   	push   %edi
+  80129e:	56                   	push   %esi
+  80129f:	53                   	push   %ebx
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ae:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012b3:	89 df                	mov    %ebx,%edi
+  8012b5:	89 de                	mov    %ebx,%esi
+  8012b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	7f 08                	jg     8012c5 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8012bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c0:	5b                   	pop    %ebx
+  8012c1:	5e                   	pop    %esi
+  8012c2:	5f                   	pop    %edi
+  8012c3:	5d                   	pop    %ebp
+  8012c4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c5:	83 ec 0c             	sub    $0xc,%esp
+  8012c8:	50                   	push   %eax
+  8012c9:	6a 06                	push   $0x6
+  8012cb:	68 0b 51 80 00       	push   $0x80510b
+  8012d0:	6a 23                	push   $0x23
+  8012d2:	68 28 51 80 00       	push   $0x805128
+  8012d7:	e8 33 f3 ff ff       	call   80060f <_panic>
+
+008012dc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	57                   	push   %edi
+  8012e0:	56                   	push   %esi
+  8012e1:	53                   	push   %ebx
+  8012e2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012f5:	89 df                	mov    %ebx,%edi
+  8012f7:	89 de                	mov    %ebx,%esi
+  8012f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012fb:	85 c0                	test   %eax,%eax
+  8012fd:	7f 08                	jg     801307 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8012ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801302:	5b                   	pop    %ebx
+  801303:	5e                   	pop    %esi
+  801304:	5f                   	pop    %edi
+  801305:	5d                   	pop    %ebp
+  801306:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801307:	83 ec 0c             	sub    $0xc,%esp
+  80130a:	50                   	push   %eax
+  80130b:	6a 08                	push   $0x8
+  80130d:	68 0b 51 80 00       	push   $0x80510b
+  801312:	6a 23                	push   $0x23
+  801314:	68 28 51 80 00       	push   $0x805128
+  801319:	e8 f1 f2 ff ff       	call   80060f <_panic>
+
+0080131e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	57                   	push   %edi
+  801322:	56                   	push   %esi
+  801323:	53                   	push   %ebx
+  801324:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801327:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801332:	b8 09 00 00 00       	mov    $0x9,%eax
+  801337:	89 df                	mov    %ebx,%edi
+  801339:	89 de                	mov    %ebx,%esi
+  80133b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	7f 08                	jg     801349 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801344:	5b                   	pop    %ebx
+  801345:	5e                   	pop    %esi
+  801346:	5f                   	pop    %edi
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801349:	83 ec 0c             	sub    $0xc,%esp
+  80134c:	50                   	push   %eax
+  80134d:	6a 09                	push   $0x9
+  80134f:	68 0b 51 80 00       	push   $0x80510b
+  801354:	6a 23                	push   $0x23
+  801356:	68 28 51 80 00       	push   $0x805128
+  80135b:	e8 af f2 ff ff       	call   80060f <_panic>
+
+00801360 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	57                   	push   %edi
+  801364:	56                   	push   %esi
+  801365:	53                   	push   %ebx
+  801366:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801369:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801379:	89 df                	mov    %ebx,%edi
+  80137b:	89 de                	mov    %ebx,%esi
+  80137d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80137f:	85 c0                	test   %eax,%eax
+  801381:	7f 08                	jg     80138b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80138b:	83 ec 0c             	sub    $0xc,%esp
+  80138e:	50                   	push   %eax
+  80138f:	6a 0a                	push   $0xa
+  801391:	68 0b 51 80 00       	push   $0x80510b
+  801396:	6a 23                	push   $0x23
+  801398:	68 28 51 80 00       	push   $0x805128
+  80139d:	e8 6d f2 ff ff       	call   80060f <_panic>
+
+008013a2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013bb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013be:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013c0:	5b                   	pop    %ebx
+  8013c1:	5e                   	pop    %esi
+  8013c2:	5f                   	pop    %edi
+  8013c3:	5d                   	pop    %ebp
+  8013c4:	c3                   	ret
+
+008013c5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	57                   	push   %edi
+  8013c9:	56                   	push   %esi
+  8013ca:	53                   	push   %ebx
+  8013cb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013db:	89 cb                	mov    %ecx,%ebx
+  8013dd:	89 cf                	mov    %ecx,%edi
+  8013df:	89 ce                	mov    %ecx,%esi
+  8013e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e3:	85 c0                	test   %eax,%eax
+  8013e5:	7f 08                	jg     8013ef <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8013e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ea:	5b                   	pop    %ebx
+  8013eb:	5e                   	pop    %esi
+  8013ec:	5f                   	pop    %edi
+  8013ed:	5d                   	pop    %ebp
+  8013ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ef:	83 ec 0c             	sub    $0xc,%esp
+  8013f2:	50                   	push   %eax
+  8013f3:	6a 0d                	push   $0xd
+  8013f5:	68 0b 51 80 00       	push   $0x80510b
+  8013fa:	6a 23                	push   $0x23
+  8013fc:	68 28 51 80 00       	push   $0x805128
+  801401:	e8 09 f2 ff ff       	call   80060f <_panic>
+
+00801406 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	57                   	push   %edi
+  80140a:	56                   	push   %esi
+  80140b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80140c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801412:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801417:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80141a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80141d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801420:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801422:	5b                   	pop    %ebx
+  801423:	5e                   	pop    %esi
+  801424:	5f                   	pop    %edi
+  801425:	5d                   	pop    %ebp
+  801426:	c3                   	ret
+
+00801427 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	57                   	push   %edi
+  80142b:	56                   	push   %esi
+  80142c:	53                   	push   %ebx
+  80142d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801430:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801435:	8b 55 08             	mov    0x8(%ebp),%edx
+  801438:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801440:	89 df                	mov    %ebx,%edi
+  801442:	89 de                	mov    %ebx,%esi
+  801444:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801446:	85 c0                	test   %eax,%eax
+  801448:	7f 08                	jg     801452 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80144a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144d:	5b                   	pop    %ebx
+  80144e:	5e                   	pop    %esi
+  80144f:	5f                   	pop    %edi
+  801450:	5d                   	pop    %ebp
+  801451:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	50                   	push   %eax
+  801456:	6a 0d                	push   $0xd
+  801458:	68 0b 51 80 00       	push   $0x80510b
+  80145d:	6a 23                	push   $0x23
+  80145f:	68 28 51 80 00       	push   $0x805128
+  801464:	e8 a6 f1 ff ff       	call   80060f <_panic>
+
+00801469 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	57                   	push   %edi
+  80146d:	56                   	push   %esi
+  80146e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80146f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801474:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801479:	89 d1                	mov    %edx,%ecx
+  80147b:	89 d3                	mov    %edx,%ebx
+  80147d:	89 d7                	mov    %edx,%edi
+  80147f:	89 d6                	mov    %edx,%esi
+  801481:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801483:	5b                   	pop    %ebx
+  801484:	5e                   	pop    %esi
+  801485:	5f                   	pop    %edi
+  801486:	5d                   	pop    %ebp
+  801487:	c3                   	ret
+
+00801488 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801488:	55                   	push   %ebp
+  801489:	89 e5                	mov    %esp,%ebp
+  80148b:	57                   	push   %edi
+  80148c:	56                   	push   %esi
+  80148d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80148e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801493:	8b 55 08             	mov    0x8(%ebp),%edx
+  801496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801499:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80149e:	89 df                	mov    %ebx,%edi
+  8014a0:	89 de                	mov    %ebx,%esi
+  8014a2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8014a4:	5b                   	pop    %ebx
+  8014a5:	5e                   	pop    %esi
+  8014a6:	5f                   	pop    %edi
+  8014a7:	5d                   	pop    %ebp
+  8014a8:	c3                   	ret
+
+008014a9 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8014a9:	55                   	push   %ebp
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	57                   	push   %edi
+  8014ad:	56                   	push   %esi
+  8014ae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014bc:	89 cb                	mov    %ecx,%ebx
+  8014be:	89 cf                	mov    %ecx,%edi
+  8014c0:	89 ce                	mov    %ecx,%esi
+  8014c2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8014c4:	5b                   	pop    %ebx
+  8014c5:	5e                   	pop    %esi
+  8014c6:	5f                   	pop    %edi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+
+008014c9 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	57                   	push   %edi
+  8014cd:	56                   	push   %esi
+  8014ce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014da:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014df:	89 df                	mov    %ebx,%edi
+  8014e1:	89 de                	mov    %ebx,%esi
+  8014e3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8014e5:	5b                   	pop    %ebx
+  8014e6:	5e                   	pop    %esi
+  8014e7:	5f                   	pop    %edi
+  8014e8:	5d                   	pop    %ebp
+  8014e9:	c3                   	ret
+
+008014ea <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8014ea:	55                   	push   %ebp
+  8014eb:	89 e5                	mov    %esp,%ebp
+  8014ed:	57                   	push   %edi
+  8014ee:	56                   	push   %esi
+  8014ef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fb:	b8 12 00 00 00       	mov    $0x12,%eax
+  801500:	89 df                	mov    %ebx,%edi
+  801502:	89 de                	mov    %ebx,%esi
+  801504:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801506:	5b                   	pop    %ebx
+  801507:	5e                   	pop    %esi
+  801508:	5f                   	pop    %edi
+  801509:	5d                   	pop    %ebp
+  80150a:	c3                   	ret
+
+0080150b <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	57                   	push   %edi
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801511:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801516:	8b 55 08             	mov    0x8(%ebp),%edx
+  801519:	b8 13 00 00 00       	mov    $0x13,%eax
+  80151e:	89 cb                	mov    %ecx,%ebx
+  801520:	89 cf                	mov    %ecx,%edi
+  801522:	89 ce                	mov    %ecx,%esi
+  801524:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801526:	5b                   	pop    %ebx
+  801527:	5e                   	pop    %esi
+  801528:	5f                   	pop    %edi
+  801529:	5d                   	pop    %ebp
+  80152a:	c3                   	ret
+
+0080152b <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	57                   	push   %edi
+  80152f:	56                   	push   %esi
+  801530:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801531:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801536:	8b 55 08             	mov    0x8(%ebp),%edx
+  801539:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801541:	89 df                	mov    %ebx,%edi
+  801543:	89 de                	mov    %ebx,%esi
+  801545:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801547:	5b                   	pop    %ebx
+  801548:	5e                   	pop    %esi
+  801549:	5f                   	pop    %edi
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+
+0080154c <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+  80154f:	57                   	push   %edi
+  801550:	56                   	push   %esi
+  801551:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801552:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80155f:	89 cb                	mov    %ecx,%ebx
+  801561:	89 cf                	mov    %ecx,%edi
+  801563:	89 ce                	mov    %ecx,%esi
+  801565:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801567:	5b                   	pop    %ebx
+  801568:	5e                   	pop    %esi
+  801569:	5f                   	pop    %edi
+  80156a:	5d                   	pop    %ebp
+  80156b:	c3                   	ret
+
+0080156c <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801572:	be 00 00 00 00       	mov    $0x0,%esi
+  801577:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801582:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801585:	89 f7                	mov    %esi,%edi
+  801587:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801589:	5b                   	pop    %ebx
+  80158a:	5e                   	pop    %esi
+  80158b:	5f                   	pop    %edi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+
+0080158e <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	56                   	push   %esi
+  801593:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801594:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801599:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159f:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015a4:	89 df                	mov    %ebx,%edi
+  8015a6:	89 de                	mov    %ebx,%esi
+  8015a8:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8015aa:	5b                   	pop    %ebx
+  8015ab:	5e                   	pop    %esi
+  8015ac:	5f                   	pop    %edi
+  8015ad:	5d                   	pop    %ebp
+  8015ae:	c3                   	ret
+
+008015af <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	57                   	push   %edi
+  8015b3:	56                   	push   %esi
+  8015b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015bd:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015c2:	89 cb                	mov    %ecx,%ebx
+  8015c4:	89 cf                	mov    %ecx,%edi
+  8015c6:	89 ce                	mov    %ecx,%esi
+  8015c8:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8015ca:	5b                   	pop    %ebx
+  8015cb:	5e                   	pop    %esi
+  8015cc:	5f                   	pop    %edi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+
+008015cf <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	57                   	push   %edi
+  8015d3:	56                   	push   %esi
+  8015d4:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8015d5:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8015d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	89 de                	mov    %ebx,%esi
+  8015ea:	cd 30                	int    $0x30
+}
+  8015ec:	5b                   	pop    %ebx
+  8015ed:	5e                   	pop    %esi
+  8015ee:	5f                   	pop    %edi
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	c3                   	ret
+
+008015f1 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8015f1:	55                   	push   %ebp
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	57                   	push   %edi
+  8015f5:	56                   	push   %esi
+  8015f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801602:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801607:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80160a:	89 f7                	mov    %esi,%edi
+  80160c:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80160e:	5b                   	pop    %ebx
+  80160f:	5e                   	pop    %esi
+  801610:	5f                   	pop    %edi
+  801611:	5d                   	pop    %ebp
+  801612:	c3                   	ret
+
+00801613 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	57                   	push   %edi
+  801617:	56                   	push   %esi
+  801618:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801619:	be 00 00 00 00       	mov    $0x0,%esi
+  80161e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801621:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801624:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801629:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80162c:	89 f7                	mov    %esi,%edi
+  80162e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801630:	5b                   	pop    %ebx
+  801631:	5e                   	pop    %esi
+  801632:	5f                   	pop    %edi
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+
+00801635 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	57                   	push   %edi
+  801639:	56                   	push   %esi
+  80163a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80163b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801640:	8b 55 08             	mov    0x8(%ebp),%edx
+  801643:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801646:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80164b:	89 df                	mov    %ebx,%edi
+  80164d:	89 de                	mov    %ebx,%esi
+  80164f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801651:	5b                   	pop    %ebx
+  801652:	5e                   	pop    %esi
+  801653:	5f                   	pop    %edi
+  801654:	5d                   	pop    %ebp
+  801655:	c3                   	ret
+
+00801656 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801656:	55                   	push   %ebp
+  801657:	89 e5                	mov    %esp,%ebp
+  801659:	57                   	push   %edi
+  80165a:	56                   	push   %esi
+  80165b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80165c:	be 00 00 00 00       	mov    $0x0,%esi
+  801661:	8b 55 08             	mov    0x8(%ebp),%edx
+  801664:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801667:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80166c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80166f:	89 f7                	mov    %esi,%edi
+  801671:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801673:	5b                   	pop    %ebx
+  801674:	5e                   	pop    %esi
+  801675:	5f                   	pop    %edi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+
+00801678 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	74 20                	je     80169c <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80167c:	89 c1                	mov    %eax,%ecx
+  80167e:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801684:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80168a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801690:	8b 52 48             	mov    0x48(%edx),%edx
+  801693:	39 c2                	cmp    %eax,%edx
+  801695:	74 06                	je     80169d <thread_alive+0x25>
+  801697:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80169c:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80169d:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8016a3:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	0f 95 c0             	setne  %al
+  8016ae:	0f b6 c0             	movzbl %al,%eax
+  8016b1:	c3                   	ret
+
+008016b2 <pgfault>:
+{
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	57                   	push   %edi
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+  8016bb:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8016be:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8016c0:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8016c3:	89 f3                	mov    %esi,%ebx
+  8016c5:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8016c8:	83 3d c0 7a 80 00 00 	cmpl   $0x0,0x807ac0
+  8016cf:	74 52                	je     801723 <pgfault+0x71>
+  8016d1:	a8 02                	test   $0x2,%al
+  8016d3:	75 14                	jne    8016e9 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8016d5:	83 ec 04             	sub    $0x4,%esp
+  8016d8:	68 36 51 80 00       	push   $0x805136
+  8016dd:	6a 2e                	push   $0x2e
+  8016df:	68 54 51 80 00       	push   $0x805154
+  8016e4:	e8 26 ef ff ff       	call   80060f <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8016e9:	89 d8                	mov    %ebx,%eax
+  8016eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016f0:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8016f7:	83 ec 0c             	sub    $0xc,%esp
+  8016fa:	57                   	push   %edi
+  8016fb:	e8 3b 2c 00 00       	call   80433b <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801700:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801707:	83 e0 03             	and    $0x3,%eax
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	83 f8 03             	cmp    $0x3,%eax
+  801710:	75 1a                	jne    80172c <pgfault+0x7a>
+			mutex_unlock(m);
+  801712:	83 ec 0c             	sub    $0xc,%esp
+  801715:	57                   	push   %edi
+  801716:	e8 8e 2c 00 00       	call   8043a9 <mutex_unlock>
+			return;
+  80171b:	83 c4 10             	add    $0x10,%esp
+  80171e:	e9 9f 00 00 00       	jmp    8017c2 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801723:	a8 02                	test   $0x2,%al
+  801725:	74 ae                	je     8016d5 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801727:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80172c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801733:	f6 c4 08             	test   $0x8,%ah
+  801736:	74 9d                	je     8016d5 <pgfault+0x23>
+  801738:	89 e0                	mov    %esp,%eax
+  80173a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80173f:	29 c2                	sub    %eax,%edx
+  801741:	89 d0                	mov    %edx,%eax
+  801743:	c1 e8 0f             	shr    $0xf,%eax
+  801746:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80174c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801751:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801754:	c1 e0 0c             	shl    $0xc,%eax
+  801757:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80175c:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80175e:	83 ec 04             	sub    $0x4,%esp
+  801761:	6a 07                	push   $0x7
+  801763:	53                   	push   %ebx
+  801764:	6a 00                	push   $0x0
+  801766:	e8 aa fa ff ff       	call   801215 <sys_page_alloc>
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	78 58                	js     8017ca <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801772:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801778:	83 ec 04             	sub    $0x4,%esp
+  80177b:	68 00 10 00 00       	push   $0x1000
+  801780:	56                   	push   %esi
+  801781:	53                   	push   %ebx
+  801782:	e8 0a f8 ff ff       	call   800f91 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801787:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80178e:	56                   	push   %esi
+  80178f:	6a 00                	push   $0x0
+  801791:	53                   	push   %ebx
+  801792:	6a 00                	push   $0x0
+  801794:	e8 bf fa ff ff       	call   801258 <sys_page_map>
+  801799:	83 c4 20             	add    $0x20,%esp
+  80179c:	85 c0                	test   %eax,%eax
+  80179e:	78 3c                	js     8017dc <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8017a0:	83 ec 08             	sub    $0x8,%esp
+  8017a3:	53                   	push   %ebx
+  8017a4:	6a 00                	push   $0x0
+  8017a6:	e8 ef fa ff ff       	call   80129a <sys_page_unmap>
+  8017ab:	83 c4 10             	add    $0x10,%esp
+  8017ae:	85 c0                	test   %eax,%eax
+  8017b0:	78 3c                	js     8017ee <pgfault+0x13c>
+	if(m)
+  8017b2:	85 ff                	test   %edi,%edi
+  8017b4:	74 0c                	je     8017c2 <pgfault+0x110>
+		mutex_unlock(m);
+  8017b6:	83 ec 0c             	sub    $0xc,%esp
+  8017b9:	57                   	push   %edi
+  8017ba:	e8 ea 2b 00 00       	call   8043a9 <mutex_unlock>
+  8017bf:	83 c4 10             	add    $0x10,%esp
+}
+  8017c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c5:	5b                   	pop    %ebx
+  8017c6:	5e                   	pop    %esi
+  8017c7:	5f                   	pop    %edi
+  8017c8:	5d                   	pop    %ebp
+  8017c9:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8017ca:	50                   	push   %eax
+  8017cb:	68 2e 4d 80 00       	push   $0x804d2e
+  8017d0:	6a 3d                	push   $0x3d
+  8017d2:	68 54 51 80 00       	push   $0x805154
+  8017d7:	e8 33 ee ff ff       	call   80060f <_panic>
+		panic("sys_page_map: %e", ret);
+  8017dc:	50                   	push   %eax
+  8017dd:	68 98 4c 80 00       	push   $0x804c98
+  8017e2:	6a 40                	push   $0x40
+  8017e4:	68 54 51 80 00       	push   $0x805154
+  8017e9:	e8 21 ee ff ff       	call   80060f <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8017ee:	50                   	push   %eax
+  8017ef:	68 5f 51 80 00       	push   $0x80515f
+  8017f4:	6a 42                	push   $0x42
+  8017f6:	68 54 51 80 00       	push   $0x805154
+  8017fb:	e8 0f ee ff ff       	call   80060f <_panic>
+
+00801800 <thread_main>:
+{
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801806:	ff 75 0c             	push   0xc(%ebp)
+  801809:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80180c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801813:	e8 7e f9 ff ff       	call   801196 <sys_env_destroy>
+}
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+
+0080181d <fork>:
+{
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	57                   	push   %edi
+  801821:	56                   	push   %esi
+  801822:	53                   	push   %ebx
+  801823:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801826:	68 b2 16 80 00       	push   $0x8016b2
+  80182b:	e8 57 2e 00 00       	call   804687 <set_pgfault_handler>
+	if(sforked)
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	83 3d c0 7a 80 00 00 	cmpl   $0x0,0x807ac0
+  80183a:	75 33                	jne    80186f <fork+0x52>
+	__asm __volatile("int %2"
+  80183c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801841:	cd 30                	int    $0x30
+  801843:	89 c7                	mov    %eax,%edi
+  801845:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801847:	85 c0                	test   %eax,%eax
+  801849:	0f 88 b4 00 00 00    	js     801903 <fork+0xe6>
+	if(envid == 0) {
+  80184f:	0f 84 c3 00 00 00    	je     801918 <fork+0xfb>
+	pgbatch_init(&pb);
+  801855:	83 ec 0c             	sub    $0xc,%esp
+  801858:	68 40 73 80 00       	push   $0x807340
+  80185d:	e8 25 29 00 00       	call   804187 <pgbatch_init>
+  801862:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801865:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186a:	e9 9c 01 00 00       	jmp    801a0b <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80186f:	83 ec 0c             	sub    $0xc,%esp
+  801872:	68 e0 76 80 00       	push   $0x8076e0
+  801877:	e8 bf 2a 00 00       	call   80433b <mutex_lock>
+  80187c:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80187f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801884:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801889:	eb 08                	jmp    801893 <fork+0x76>
+  80188b:	83 c3 01             	add    $0x1,%ebx
+  80188e:	83 fb 20             	cmp    $0x20,%ebx
+  801891:	74 5b                	je     8018ee <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801893:	8b 34 9d 60 76 80 00 	mov    0x807660(,%ebx,4),%esi
+  80189a:	89 f0                	mov    %esi,%eax
+  80189c:	e8 d7 fd ff ff       	call   801678 <thread_alive>
+  8018a1:	85 c0                	test   %eax,%eax
+  8018a3:	74 e6                	je     80188b <fork+0x6e>
+  8018a5:	89 e0                	mov    %esp,%eax
+  8018a7:	89 fa                	mov    %edi,%edx
+  8018a9:	29 c2                	sub    %eax,%edx
+  8018ab:	89 d0                	mov    %edx,%eax
+  8018ad:	c1 e8 0f             	shr    $0xf,%eax
+  8018b0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8018b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018bb:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8018be:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  8018c5:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8018c8:	83 ec 08             	sub    $0x8,%esp
+  8018cb:	50                   	push   %eax
+  8018cc:	56                   	push   %esi
+  8018cd:	e8 8e fa ff ff       	call   801360 <sys_env_set_pgfault_upcall>
+  8018d2:	83 c4 10             	add    $0x10,%esp
+  8018d5:	85 c0                	test   %eax,%eax
+  8018d7:	79 b2                	jns    80188b <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8018d9:	50                   	push   %eax
+  8018da:	68 ec 51 80 00       	push   $0x8051ec
+  8018df:	68 00 01 00 00       	push   $0x100
+  8018e4:	68 54 51 80 00       	push   $0x805154
+  8018e9:	e8 21 ed ff ff       	call   80060f <_panic>
+	mutex_unlock(&sfork_lock);
+  8018ee:	83 ec 0c             	sub    $0xc,%esp
+  8018f1:	68 e0 76 80 00       	push   $0x8076e0
+  8018f6:	e8 ae 2a 00 00       	call   8043a9 <mutex_unlock>
+}
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	e9 39 ff ff ff       	jmp    80183c <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801903:	50                   	push   %eax
+  801904:	68 72 51 80 00       	push   $0x805172
+  801909:	68 91 00 00 00       	push   $0x91
+  80190e:	68 54 51 80 00       	push   $0x805154
+  801913:	e8 f7 ec ff ff       	call   80060f <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801918:	e8 ba f8 ff ff       	call   8011d7 <sys_getenvid>
+  80191d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801922:	89 e1                	mov    %esp,%ecx
+  801924:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801929:	29 ca                	sub    %ecx,%edx
+  80192b:	89 d1                	mov    %edx,%ecx
+  80192d:	c1 e9 0f             	shr    $0xf,%ecx
+  801930:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801936:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193b:	0f 42 d1             	cmovb  %ecx,%edx
+  80193e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801944:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801949:	89 04 95 40 7a 80 00 	mov    %eax,0x807a40(,%edx,4)
+		if(sforked)
+  801950:	a1 c0 7a 80 00       	mov    0x807ac0,%eax
+  801955:	85 c0                	test   %eax,%eax
+  801957:	75 07                	jne    801960 <fork+0x143>
+		return 0;
+  801959:	89 c6                	mov    %eax,%esi
+  80195b:	e9 6f 02 00 00       	jmp    801bcf <fork+0x3b2>
+  801960:	89 e2                	mov    %esp,%edx
+  801962:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801967:	29 d0                	sub    %edx,%eax
+  801969:	89 c3                	mov    %eax,%ebx
+  80196b:	c1 eb 0f             	shr    $0xf,%ebx
+  80196e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+  801978:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80197b:	83 ec 04             	sub    $0x4,%esp
+  80197e:	68 80 00 00 00       	push   $0x80
+  801983:	6a 00                	push   $0x0
+  801985:	68 60 76 80 00       	push   $0x807660
+  80198a:	e8 cd f5 ff ff       	call   800f5c <memset>
+	thread_ids[slot] = sys_getenvid();
+  80198f:	e8 43 f8 ff ff       	call   8011d7 <sys_getenvid>
+  801994:	89 04 9d 60 76 80 00 	mov    %eax,0x807660(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  80199b:	8b 04 9d 40 7a 80 00 	mov    0x807a40(,%ebx,4),%eax
+  8019a2:	a3 40 7a 80 00       	mov    %eax,0x807a40
+	mutex_init(&sfork_lock);
+  8019a7:	c7 04 24 e0 76 80 00 	movl   $0x8076e0,(%esp)
+  8019ae:	e8 7a 29 00 00       	call   80432d <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8019b3:	83 c4 0c             	add    $0xc,%esp
+  8019b6:	68 07 04 00 00       	push   $0x407
+  8019bb:	68 00 00 00 e1       	push   $0xe1000000
+  8019c0:	6a 00                	push   $0x0
+  8019c2:	e8 4e f8 ff ff       	call   801215 <sys_page_alloc>
+  8019c7:	83 c4 10             	add    $0x10,%esp
+  8019ca:	85 c0                	test   %eax,%eax
+  8019cc:	0f 89 fd 01 00 00    	jns    801bcf <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8019d2:	50                   	push   %eax
+  8019d3:	68 2e 4d 80 00       	push   $0x804d2e
+  8019d8:	68 12 01 00 00       	push   $0x112
+  8019dd:	68 54 51 80 00       	push   $0x805154
+  8019e2:	e8 28 ec ff ff       	call   80060f <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8019e7:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8019ed:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8019f3:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8019f9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8019ff:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801a05:	0f 87 4f 01 00 00    	ja     801b5a <fork+0x33d>
+		pd = PDX(addr);
+  801a0b:	89 d8                	mov    %ebx,%eax
+  801a0d:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801a10:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801a17:	f6 c2 01             	test   $0x1,%dl
+  801a1a:	74 cb                	je     8019e7 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801a1c:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801a21:	0f 85 92 00 00 00    	jne    801ab9 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801a27:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801a2d:	76 10                	jbe    801a3f <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801a2f:	89 d8                	mov    %ebx,%eax
+  801a31:	f7 d8                	neg    %eax
+  801a33:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801a38:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a3d:	74 ba                	je     8019f9 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801a3f:	89 d8                	mov    %ebx,%eax
+  801a41:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801a44:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a4b:	f6 c2 01             	test   $0x1,%dl
+  801a4e:	74 a9                	je     8019f9 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801a50:	89 c1                	mov    %eax,%ecx
+  801a52:	c1 e1 0c             	shl    $0xc,%ecx
+  801a55:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801a58:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a5f:	f6 c6 04             	test   $0x4,%dh
+  801a62:	0f 85 8e 00 00 00    	jne    801af6 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801a68:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a6f:	f6 c6 08             	test   $0x8,%dh
+  801a72:	75 0f                	jne    801a83 <fork+0x266>
+  801a74:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a7b:	a8 02                	test   $0x2,%al
+  801a7d:	0f 84 bb 00 00 00    	je     801b3e <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801a83:	83 ec 08             	sub    $0x8,%esp
+  801a86:	68 05 08 00 00       	push   $0x805
+  801a8b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a8e:	50                   	push   %eax
+  801a8f:	56                   	push   %esi
+  801a90:	50                   	push   %eax
+  801a91:	6a 00                	push   $0x0
+  801a93:	68 40 73 80 00       	push   $0x807340
+  801a98:	e8 a8 27 00 00       	call   804245 <pgbatch_map>
+  801a9d:	83 c4 20             	add    $0x20,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	79 76                	jns    801b1a <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801aa4:	50                   	push   %eax
+  801aa5:	68 96 51 80 00       	push   $0x805196
+  801aaa:	68 bc 00 00 00       	push   $0xbc
+  801aaf:	68 54 51 80 00       	push   $0x805154
+  801ab4:	e8 56 eb ff ff       	call   80060f <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801ab9:	83 ec 0c             	sub    $0xc,%esp
+  801abc:	68 00 08 00 00       	push   $0x800
+  801ac1:	56                   	push   %esi
+  801ac2:	53                   	push   %ebx
+  801ac3:	6a 00                	push   $0x0
+  801ac5:	68 40 73 80 00       	push   $0x807340
+  801aca:	e8 21 28 00 00       	call   8042f0 <pgbatch_sharept>
+  801acf:	83 c4 20             	add    $0x20,%esp
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	78 0b                	js     801ae1 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801ad6:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801adc:	e9 18 ff ff ff       	jmp    8019f9 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801ae1:	50                   	push   %eax
+  801ae2:	68 82 51 80 00       	push   $0x805182
+  801ae7:	68 b2 00 00 00       	push   $0xb2
+  801aec:	68 54 51 80 00       	push   $0x805154
+  801af1:	e8 19 eb ff ff       	call   80060f <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801af6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801afd:	83 ec 08             	sub    $0x8,%esp
+  801b00:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b05:	50                   	push   %eax
+  801b06:	51                   	push   %ecx
+  801b07:	56                   	push   %esi
+  801b08:	51                   	push   %ecx
+  801b09:	6a 00                	push   $0x0
+  801b0b:	68 40 73 80 00       	push   $0x807340
+  801b10:	e8 30 27 00 00       	call   804245 <pgbatch_map>
+  801b15:	83 c4 20             	add    $0x20,%esp
+  801b18:	eb 17                	jmp    801b31 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801b1a:	68 05 08 00 00       	push   $0x805
+  801b1f:	ff 75 e4             	push   -0x1c(%ebp)
+  801b22:	6a 00                	push   $0x0
+  801b24:	68 40 73 80 00       	push   $0x807340
+  801b29:	e8 8b 27 00 00       	call   8042b9 <pgbatch_protect>
+  801b2e:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801b31:	85 c0                	test   %eax,%eax
+  801b33:	0f 89 c0 fe ff ff    	jns    8019f9 <fork+0x1dc>
+  801b39:	e9 66 ff ff ff       	jmp    801aa4 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801b3e:	83 ec 08             	sub    $0x8,%esp
+  801b41:	6a 05                	push   $0x5
+  801b43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b46:	50                   	push   %eax
+  801b47:	56                   	push   %esi
+  801b48:	50                   	push   %eax
+  801b49:	6a 00                	push   $0x0
+  801b4b:	68 40 73 80 00       	push   $0x807340
+  801b50:	e8 f0 26 00 00       	call   804245 <pgbatch_map>
+  801b55:	83 c4 20             	add    $0x20,%esp
+  801b58:	eb d7                	jmp    801b31 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801b5a:	6a 07                	push   $0x7
+  801b5c:	68 00 f0 bf ee       	push   $0xeebff000
+  801b61:	57                   	push   %edi
+  801b62:	68 40 73 80 00       	push   $0x807340
+  801b67:	e8 a2 26 00 00       	call   80420e <pgbatch_alloc>
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 66                	js     801bd9 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801b73:	83 ec 0c             	sub    $0xc,%esp
+  801b76:	68 40 73 80 00       	push   $0x807340
+  801b7b:	e8 15 26 00 00       	call   804195 <pgbatch_flush>
+  801b80:	83 c4 10             	add    $0x10,%esp
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	78 52                	js     801bd9 <fork+0x3bc>
+  801b87:	89 e2                	mov    %esp,%edx
+  801b89:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b8e:	29 d0                	sub    %edx,%eax
+  801b90:	89 c2                	mov    %eax,%edx
+  801b92:	c1 ea 0f             	shr    $0xf,%edx
+  801b95:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9f:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801ba2:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801ba9:	8b 40 78             	mov    0x78(%eax),%eax
+  801bac:	83 ec 08             	sub    $0x8,%esp
+  801baf:	50                   	push   %eax
+  801bb0:	57                   	push   %edi
+  801bb1:	e8 aa f7 ff ff       	call   801360 <sys_env_set_pgfault_upcall>
+  801bb6:	83 c4 10             	add    $0x10,%esp
+  801bb9:	85 c0                	test   %eax,%eax
+  801bbb:	78 31                	js     801bee <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801bbd:	83 ec 08             	sub    $0x8,%esp
+  801bc0:	6a 02                	push   $0x2
+  801bc2:	57                   	push   %edi
+  801bc3:	e8 14 f7 ff ff       	call   8012dc <sys_env_set_status>
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	85 c0                	test   %eax,%eax
+  801bcd:	78 34                	js     801c03 <fork+0x3e6>
+}
+  801bcf:	89 f0                	mov    %esi,%eax
+  801bd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd4:	5b                   	pop    %ebx
+  801bd5:	5e                   	pop    %esi
+  801bd6:	5f                   	pop    %edi
+  801bd7:	5d                   	pop    %ebp
+  801bd8:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801bd9:	50                   	push   %eax
+  801bda:	68 a2 51 80 00       	push   $0x8051a2
+  801bdf:	68 c0 00 00 00       	push   $0xc0
+  801be4:	68 54 51 80 00       	push   $0x805154
+  801be9:	e8 21 ea ff ff       	call   80060f <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801bee:	50                   	push   %eax
+  801bef:	68 b7 51 80 00       	push   $0x8051b7
+  801bf4:	68 c2 00 00 00       	push   $0xc2
+  801bf9:	68 54 51 80 00       	push   $0x805154
+  801bfe:	e8 0c ea ff ff       	call   80060f <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801c03:	50                   	push   %eax
+  801c04:	68 d2 51 80 00       	push   $0x8051d2
+  801c09:	68 c4 00 00 00       	push   $0xc4
+  801c0e:	68 54 51 80 00       	push   $0x805154
+  801c13:	e8 f7 e9 ff ff       	call   80060f <_panic>
+
+00801c18 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	57                   	push   %edi
+  801c1c:	56                   	push   %esi
+  801c1d:	53                   	push   %ebx
+  801c1e:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801c21:	68 e0 76 80 00       	push   $0x8076e0
+  801c26:	e8 10 27 00 00       	call   80433b <mutex_lock>
+  801c2b:	89 e2                	mov    %esp,%edx
+  801c2d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c32:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801c34:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801c37:	89 c3                	mov    %eax,%ebx
+  801c39:	c1 eb 0f             	shr    $0xf,%ebx
+  801c3c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c46:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801c49:	e8 89 f5 ff ff       	call   8011d7 <sys_getenvid>
+  801c4e:	89 04 9d 60 76 80 00 	mov    %eax,0x807660(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801c55:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801c5a:	8b 04 9d 60 76 80 00 	mov    0x807660(,%ebx,4),%eax
+  801c61:	e8 12 fa ff ff       	call   801678 <thread_alive>
+  801c66:	85 c0                	test   %eax,%eax
+  801c68:	74 24                	je     801c8e <sfork+0x76>
+  801c6a:	83 c3 01             	add    $0x1,%ebx
+  801c6d:	83 fb 20             	cmp    $0x20,%ebx
+  801c70:	75 e8                	jne    801c5a <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801c72:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801c77:	83 ec 0c             	sub    $0xc,%esp
+  801c7a:	68 e0 76 80 00       	push   $0x8076e0
+  801c7f:	e8 25 27 00 00       	call   8043a9 <mutex_unlock>
+	return r;
+}
+  801c84:	89 f0                	mov    %esi,%eax
+  801c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c89:	5b                   	pop    %ebx
+  801c8a:	5e                   	pop    %esi
+  801c8b:	5f                   	pop    %edi
+  801c8c:	5d                   	pop    %ebp
+  801c8d:	c3                   	ret
+	if (i == NTHREADS) {
+  801c8e:	83 fb 20             	cmp    $0x20,%ebx
+  801c91:	0f 84 53 01 00 00    	je     801dea <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801c97:	89 d8                	mov    %ebx,%eax
+  801c99:	c1 e0 0f             	shl    $0xf,%eax
+  801c9c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801c9f:	83 ec 0c             	sub    $0xc,%esp
+  801ca2:	68 20 70 80 00       	push   $0x807020
+  801ca7:	e8 db 24 00 00       	call   804187 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	83 3d c0 7a 80 00 00 	cmpl   $0x0,0x807ac0
+  801cb6:	75 1f                	jne    801cd7 <sfork+0xbf>
+  801cb8:	68 07 04 00 00       	push   $0x407
+  801cbd:	68 00 00 00 e1       	push   $0xe1000000
+  801cc2:	6a 00                	push   $0x0
+  801cc4:	68 20 70 80 00       	push   $0x807020
+  801cc9:	e8 40 25 00 00       	call   80420e <pgbatch_alloc>
+  801cce:	89 c6                	mov    %eax,%esi
+  801cd0:	83 c4 10             	add    $0x10,%esp
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	78 a0                	js     801c77 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801cd7:	6a 07                	push   $0x7
+  801cd9:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801cde:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ce1:	29 c8                	sub    %ecx,%eax
+  801ce3:	50                   	push   %eax
+  801ce4:	6a 00                	push   $0x0
+  801ce6:	68 20 70 80 00       	push   $0x807020
+  801ceb:	e8 1e 25 00 00       	call   80420e <pgbatch_alloc>
+  801cf0:	89 c6                	mov    %eax,%esi
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	0f 88 7a ff ff ff    	js     801c77 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801cfd:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801d02:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d05:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801d07:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801d0c:	29 c8                	sub    %ecx,%eax
+  801d0e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d11:	39 c7                	cmp    %eax,%edi
+  801d13:	73 29                	jae    801d3e <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801d15:	6a 07                	push   $0x7
+  801d17:	57                   	push   %edi
+  801d18:	6a 00                	push   $0x0
+  801d1a:	68 20 70 80 00       	push   $0x807020
+  801d1f:	e8 ea 24 00 00       	call   80420e <pgbatch_alloc>
+  801d24:	89 c6                	mov    %eax,%esi
+  801d26:	83 c4 10             	add    $0x10,%esp
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	0f 88 46 ff ff ff    	js     801c77 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801d31:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801d37:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d3a:	39 c7                	cmp    %eax,%edi
+  801d3c:	72 d7                	jb     801d15 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801d3e:	83 ec 0c             	sub    $0xc,%esp
+  801d41:	68 20 70 80 00       	push   $0x807020
+  801d46:	e8 4a 24 00 00       	call   804195 <pgbatch_flush>
+  801d4b:	89 c6                	mov    %eax,%esi
+  801d4d:	83 c4 10             	add    $0x10,%esp
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	0f 88 1f ff ff ff    	js     801c77 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801d58:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801d5d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d60:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801d62:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d6b:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801d6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d71:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801d74:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801d77:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801d7c:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801d7e:	52                   	push   %edx
+  801d7f:	50                   	push   %eax
+  801d80:	68 00 18 80 00       	push   $0x801800
+  801d85:	e8 cc f8 ff ff       	call   801656 <sys_exofork_shared>
+  801d8a:	89 c6                	mov    %eax,%esi
+  801d8c:	83 c4 10             	add    $0x10,%esp
+  801d8f:	85 c0                	test   %eax,%eax
+  801d91:	0f 88 e0 fe ff ff    	js     801c77 <sfork+0x5f>
+	thread_ids[i] = id;
+  801d97:	89 04 9d 60 76 80 00 	mov    %eax,0x807660(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801d9e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801da3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801da9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801dae:	89 04 9d 40 7a 80 00 	mov    %eax,0x807a40(,%ebx,4)
+	sforked = 1;
+  801db5:	c7 05 c0 7a 80 00 01 	movl   $0x1,0x807ac0
+  801dbc:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801dbf:	83 ec 08             	sub    $0x8,%esp
+  801dc2:	6a 02                	push   $0x2
+  801dc4:	56                   	push   %esi
+  801dc5:	e8 12 f5 ff ff       	call   8012dc <sys_env_set_status>
+  801dca:	89 c3                	mov    %eax,%ebx
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	0f 89 a0 fe ff ff    	jns    801c77 <sfork+0x5f>
+		sys_env_destroy(id);
+  801dd7:	83 ec 0c             	sub    $0xc,%esp
+  801dda:	56                   	push   %esi
+  801ddb:	e8 b6 f3 ff ff       	call   801196 <sys_env_destroy>
+		goto out;
+  801de0:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801de3:	89 de                	mov    %ebx,%esi
+		goto out;
+  801de5:	e9 8d fe ff ff       	jmp    801c77 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801dea:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801def:	e9 83 fe ff ff       	jmp    801c77 <sfork+0x5f>
+
+00801df4 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	56                   	push   %esi
+  801df8:	53                   	push   %ebx
+  801df9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801e09:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801e0c:	83 ec 0c             	sub    $0xc,%esp
+  801e0f:	50                   	push   %eax
+  801e10:	e8 b0 f5 ff ff       	call   8013c5 <sys_ipc_recv>
+  801e15:	83 c4 10             	add    $0x10,%esp
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	0f 88 8b 00 00 00    	js     801eab <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801e20:	85 f6                	test   %esi,%esi
+  801e22:	74 2a                	je     801e4e <ipc_recv+0x5a>
+  801e24:	89 e2                	mov    %esp,%edx
+  801e26:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e2b:	29 d0                	sub    %edx,%eax
+  801e2d:	89 c2                	mov    %eax,%edx
+  801e2f:	c1 ea 0f             	shr    $0xf,%edx
+  801e32:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801e3f:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801e46:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801e4c:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  801e4e:	85 db                	test   %ebx,%ebx
+  801e50:	74 2a                	je     801e7c <ipc_recv+0x88>
+  801e52:	89 e2                	mov    %esp,%edx
+  801e54:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e59:	29 d0                	sub    %edx,%eax
+  801e5b:	89 c2                	mov    %eax,%edx
+  801e5d:	c1 ea 0f             	shr    $0xf,%edx
+  801e60:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801e6d:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801e74:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801e7a:	89 03                	mov    %eax,(%ebx)
+  801e7c:	89 e2                	mov    %esp,%edx
+  801e7e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e83:	29 d0                	sub    %edx,%eax
+  801e85:	89 c2                	mov    %eax,%edx
+  801e87:	c1 ea 0f             	shr    $0xf,%edx
+  801e8a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e94:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801e97:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801e9e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801ea4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea7:	5b                   	pop    %ebx
+  801ea8:	5e                   	pop    %esi
+  801ea9:	5d                   	pop    %ebp
+  801eaa:	c3                   	ret
+		if(from_env_store != NULL)
+  801eab:	85 f6                	test   %esi,%esi
+  801ead:	74 06                	je     801eb5 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801eaf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801eb5:	85 db                	test   %ebx,%ebx
+  801eb7:	74 eb                	je     801ea4 <ipc_recv+0xb0>
+			*perm_store = 0;
+  801eb9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801ebf:	eb e3                	jmp    801ea4 <ipc_recv+0xb0>
+
+00801ec1 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	57                   	push   %edi
+  801ec5:	56                   	push   %esi
+  801ec6:	53                   	push   %ebx
+  801ec7:	83 ec 14             	sub    $0x14,%esp
+  801eca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ecd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed0:	8b 75 14             	mov    0x14(%ebp),%esi
+  801ed3:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801edd:	0f 44 c2             	cmove  %edx,%eax
+  801ee0:	ff 75 10             	push   0x10(%ebp)
+  801ee3:	50                   	push   %eax
+  801ee4:	e8 3e f5 ff ff       	call   801427 <sys_ipc_recv_pages>
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	0f 88 ba 00 00 00    	js     801fae <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801ef4:	85 ff                	test   %edi,%edi
+  801ef6:	74 2a                	je     801f22 <ipc_recv_pages+0x61>
+  801ef8:	89 e2                	mov    %esp,%edx
+  801efa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801eff:	29 d0                	sub    %edx,%eax
+  801f01:	89 c2                	mov    %eax,%edx
+  801f03:	c1 ea 0f             	shr    $0xf,%edx
+  801f06:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f10:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801f13:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801f1a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f20:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801f22:	85 f6                	test   %esi,%esi
+  801f24:	74 2a                	je     801f50 <ipc_recv_pages+0x8f>
+  801f26:	89 e2                	mov    %esp,%edx
+  801f28:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f2d:	29 d0                	sub    %edx,%eax
+  801f2f:	89 c2                	mov    %eax,%edx
+  801f31:	c1 ea 0f             	shr    $0xf,%edx
+  801f34:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801f41:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801f48:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801f4e:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801f50:	85 db                	test   %ebx,%ebx
+  801f52:	74 2a                	je     801f7e <ipc_recv_pages+0xbd>
+  801f54:	89 e2                	mov    %esp,%edx
+  801f56:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f5b:	29 d0                	sub    %edx,%eax
+  801f5d:	89 c2                	mov    %eax,%edx
+  801f5f:	c1 ea 0f             	shr    $0xf,%edx
+  801f62:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6c:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801f6f:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801f76:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801f7c:	89 03                	mov    %eax,(%ebx)
+  801f7e:	89 e2                	mov    %esp,%edx
+  801f80:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f85:	29 d0                	sub    %edx,%eax
+  801f87:	89 c2                	mov    %eax,%edx
+  801f89:	c1 ea 0f             	shr    $0xf,%edx
+  801f8c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f96:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801f99:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  801fa0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801fa6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa9:	5b                   	pop    %ebx
+  801faa:	5e                   	pop    %esi
+  801fab:	5f                   	pop    %edi
+  801fac:	5d                   	pop    %ebp
+  801fad:	c3                   	ret
+		if (from_env_store)
+  801fae:	85 ff                	test   %edi,%edi
+  801fb0:	74 06                	je     801fb8 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801fb2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801fb8:	85 f6                	test   %esi,%esi
+  801fba:	74 06                	je     801fc2 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801fbc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801fc2:	85 db                	test   %ebx,%ebx
+  801fc4:	74 e0                	je     801fa6 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801fc6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801fcc:	eb d8                	jmp    801fa6 <ipc_recv_pages+0xe5>
+
+00801fce <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	57                   	push   %edi
+  801fd2:	56                   	push   %esi
+  801fd3:	53                   	push   %ebx
+  801fd4:	83 ec 1c             	sub    $0x1c,%esp
+  801fd7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801fda:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fdd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801fe3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801fe7:	75 2b                	jne    802014 <ipc_try_send_pages+0x46>
+  801fe9:	89 e2                	mov    %esp,%edx
+  801feb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ff0:	29 d0                	sub    %edx,%eax
+  801ff2:	89 c2                	mov    %eax,%edx
+  801ff4:	c1 ea 0f             	shr    $0xf,%edx
+  801ff7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802001:	0f 42 c2             	cmovb  %edx,%eax
+  802004:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  80200b:	8b 70 48             	mov    0x48(%eax),%esi
+  80200e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  802014:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80201a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80201f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802022:	85 ff                	test   %edi,%edi
+  802024:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  802029:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80202c:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  802032:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802038:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80203e:	83 ec 0c             	sub    $0xc,%esp
+  802041:	ff 75 14             	push   0x14(%ebp)
+  802044:	ff 75 18             	push   0x18(%ebp)
+  802047:	57                   	push   %edi
+  802048:	ff 75 0c             	push   0xc(%ebp)
+  80204b:	ff 75 08             	push   0x8(%ebp)
+  80204e:	e8 b3 f3 ff ff       	call   801406 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  802053:	83 c4 20             	add    $0x20,%esp
+  802056:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802059:	75 21                	jne    80207c <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80205b:	83 ec 04             	sub    $0x4,%esp
+  80205e:	6a ff                	push   $0xffffffff
+  802060:	53                   	push   %ebx
+  802061:	ff 75 e4             	push   -0x1c(%ebp)
+  802064:	e8 aa f5 ff ff       	call   801613 <sys_futex_wait>
+  802069:	83 c4 10             	add    $0x10,%esp
+  80206c:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80206f:	74 c7                	je     802038 <ipc_try_send_pages+0x6a>
+  802071:	85 c0                	test   %eax,%eax
+  802073:	79 c3                	jns    802038 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  802075:	e8 7c f1 ff ff       	call   8011f6 <sys_yield>
+  80207a:	eb bc                	jmp    802038 <ipc_try_send_pages+0x6a>
+	}
+}
+  80207c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80207f:	5b                   	pop    %ebx
+  802080:	5e                   	pop    %esi
+  802081:	5f                   	pop    %edi
+  802082:	5d                   	pop    %ebp
+  802083:	c3                   	ret
+
+00802084 <ipc_send>:
+{
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80208a:	ff 75 14             	push   0x14(%ebp)
+  80208d:	6a 01                	push   $0x1
+  80208f:	ff 75 10             	push   0x10(%ebp)
+  802092:	ff 75 0c             	push   0xc(%ebp)
+  802095:	ff 75 08             	push   0x8(%ebp)
+  802098:	e8 31 ff ff ff       	call   801fce <ipc_try_send_pages>
+  80209d:	83 c4 20             	add    $0x20,%esp
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	78 02                	js     8020a6 <ipc_send+0x22>
+}
+  8020a4:	c9                   	leave
+  8020a5:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8020a6:	50                   	push   %eax
+  8020a7:	68 0b 52 80 00       	push   $0x80520b
+  8020ac:	6a 3f                	push   $0x3f
+  8020ae:	68 20 52 80 00       	push   $0x805220
+  8020b3:	e8 57 e5 ff ff       	call   80060f <_panic>
+
+008020b8 <ipc_send_pages>:
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8020be:	ff 75 18             	push   0x18(%ebp)
+  8020c1:	ff 75 14             	push   0x14(%ebp)
+  8020c4:	ff 75 10             	push   0x10(%ebp)
+  8020c7:	ff 75 0c             	push   0xc(%ebp)
+  8020ca:	ff 75 08             	push   0x8(%ebp)
+  8020cd:	e8 fc fe ff ff       	call   801fce <ipc_try_send_pages>
+  8020d2:	83 c4 20             	add    $0x20,%esp
+  8020d5:	85 c0                	test   %eax,%eax
+  8020d7:	78 02                	js     8020db <ipc_send_pages+0x23>
+}
+  8020d9:	c9                   	leave
+  8020da:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8020db:	50                   	push   %eax
+  8020dc:	68 2a 52 80 00       	push   $0x80522a
+  8020e1:	6a 64                	push   $0x64
+  8020e3:	68 20 52 80 00       	push   $0x805220
+  8020e8:	e8 22 e5 ff ff       	call   80060f <_panic>
+
+008020ed <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8020ed:	55                   	push   %ebp
+  8020ee:	89 e5                	mov    %esp,%ebp
+  8020f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8020f8:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8020fe:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802104:	8b 52 50             	mov    0x50(%edx),%edx
+  802107:	39 ca                	cmp    %ecx,%edx
+  802109:	74 11                	je     80211c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80210b:	83 c0 01             	add    $0x1,%eax
+  80210e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802113:	75 e3                	jne    8020f8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211a:	eb 0e                	jmp    80212a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80211c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  802122:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802127:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80212a:	5d                   	pop    %ebp
+  80212b:	c3                   	ret
+
+0080212c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80212f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802132:	05 00 00 00 30       	add    $0x30000000,%eax
+  802137:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80213a:	5d                   	pop    %ebp
+  80213b:	c3                   	ret
+
+0080213c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80213c:	55                   	push   %ebp
+  80213d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80213f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802142:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802147:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80214c:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  802151:	5d                   	pop    %ebp
+  802152:	c3                   	ret
+
+00802153 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802153:	55                   	push   %ebp
+  802154:	89 e5                	mov    %esp,%ebp
+  802156:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80215b:	89 c2                	mov    %eax,%edx
+  80215d:	c1 ea 16             	shr    $0x16,%edx
+  802160:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802167:	f6 c2 01             	test   $0x1,%dl
+  80216a:	74 29                	je     802195 <fd_alloc+0x42>
+  80216c:	89 c2                	mov    %eax,%edx
+  80216e:	c1 ea 0c             	shr    $0xc,%edx
+  802171:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802178:	f6 c2 01             	test   $0x1,%dl
+  80217b:	74 18                	je     802195 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80217d:	05 00 10 00 00       	add    $0x1000,%eax
+  802182:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  802187:	75 d2                	jne    80215b <fd_alloc+0x8>
+  802189:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80218e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802193:	eb 05                	jmp    80219a <fd_alloc+0x47>
+			return 0;
+  802195:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80219a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80219d:	89 02                	mov    %eax,(%edx)
+}
+  80219f:	89 c8                	mov    %ecx,%eax
+  8021a1:	5d                   	pop    %ebp
+  8021a2:	c3                   	ret
+
+008021a3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8021a3:	55                   	push   %ebp
+  8021a4:	89 e5                	mov    %esp,%ebp
+  8021a6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8021a9:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8021ae:	77 30                	ja     8021e0 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8021b0:	c1 e0 0c             	shl    $0xc,%eax
+  8021b3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8021b8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8021be:	f6 c2 01             	test   $0x1,%dl
+  8021c1:	74 24                	je     8021e7 <fd_lookup+0x44>
+  8021c3:	89 c2                	mov    %eax,%edx
+  8021c5:	c1 ea 0c             	shr    $0xc,%edx
+  8021c8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8021cf:	f6 c2 01             	test   $0x1,%dl
+  8021d2:	74 1a                	je     8021ee <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8021d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021d7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8021d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021de:	5d                   	pop    %ebp
+  8021df:	c3                   	ret
+		return -E_INVAL;
+  8021e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021e5:	eb f7                	jmp    8021de <fd_lookup+0x3b>
+		return -E_INVAL;
+  8021e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ec:	eb f0                	jmp    8021de <fd_lookup+0x3b>
+  8021ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f3:	eb e9                	jmp    8021de <fd_lookup+0x3b>
+
+008021f5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8021f5:	55                   	push   %ebp
+  8021f6:	89 e5                	mov    %esp,%ebp
+  8021f8:	53                   	push   %ebx
+  8021f9:	83 ec 04             	sub    $0x4,%esp
+  8021fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8021ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802204:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  802209:	39 13                	cmp    %edx,(%ebx)
+  80220b:	74 54                	je     802261 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80220d:	83 c0 01             	add    $0x1,%eax
+  802210:	8b 1c 85 c4 52 80 00 	mov    0x8052c4(,%eax,4),%ebx
+  802217:	85 db                	test   %ebx,%ebx
+  802219:	75 ee                	jne    802209 <dev_lookup+0x14>
+  80221b:	89 e1                	mov    %esp,%ecx
+  80221d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802222:	29 c8                	sub    %ecx,%eax
+  802224:	89 c1                	mov    %eax,%ecx
+  802226:	c1 e9 0f             	shr    $0xf,%ecx
+  802229:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80222e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802233:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802236:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  80223d:	8b 40 48             	mov    0x48(%eax),%eax
+  802240:	83 ec 04             	sub    $0x4,%esp
+  802243:	52                   	push   %edx
+  802244:	50                   	push   %eax
+  802245:	68 48 52 80 00       	push   $0x805248
+  80224a:	e8 9b e4 ff ff       	call   8006ea <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802257:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80225a:	89 1a                	mov    %ebx,(%edx)
+}
+  80225c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225f:	c9                   	leave
+  802260:	c3                   	ret
+			return 0;
+  802261:	b8 00 00 00 00       	mov    $0x0,%eax
+  802266:	eb ef                	jmp    802257 <dev_lookup+0x62>
+
+00802268 <fd_close>:
+{
+  802268:	55                   	push   %ebp
+  802269:	89 e5                	mov    %esp,%ebp
+  80226b:	57                   	push   %edi
+  80226c:	56                   	push   %esi
+  80226d:	53                   	push   %ebx
+  80226e:	83 ec 24             	sub    $0x24,%esp
+  802271:	8b 75 08             	mov    0x8(%ebp),%esi
+  802274:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802277:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80227a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80227b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802281:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802284:	50                   	push   %eax
+  802285:	e8 19 ff ff ff       	call   8021a3 <fd_lookup>
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	83 c4 10             	add    $0x10,%esp
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 05                	js     802298 <fd_close+0x30>
+	    || fd != fd2)
+  802293:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802296:	74 0f                	je     8022a7 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  802298:	85 ff                	test   %edi,%edi
+  80229a:	0f 44 df             	cmove  %edi,%ebx
+}
+  80229d:	89 d8                	mov    %ebx,%eax
+  80229f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a2:	5b                   	pop    %ebx
+  8022a3:	5e                   	pop    %esi
+  8022a4:	5f                   	pop    %edi
+  8022a5:	5d                   	pop    %ebp
+  8022a6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8022a7:	83 ec 08             	sub    $0x8,%esp
+  8022aa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8022ad:	50                   	push   %eax
+  8022ae:	ff 36                	push   (%esi)
+  8022b0:	e8 40 ff ff ff       	call   8021f5 <dev_lookup>
+  8022b5:	89 c3                	mov    %eax,%ebx
+  8022b7:	83 c4 10             	add    $0x10,%esp
+  8022ba:	85 c0                	test   %eax,%eax
+  8022bc:	78 1a                	js     8022d8 <fd_close+0x70>
+		if (dev->dev_close)
+  8022be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8022c1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8022c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8022c9:	85 c0                	test   %eax,%eax
+  8022cb:	74 0b                	je     8022d8 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8022cd:	83 ec 0c             	sub    $0xc,%esp
+  8022d0:	56                   	push   %esi
+  8022d1:	ff d0                	call   *%eax
+  8022d3:	89 c3                	mov    %eax,%ebx
+  8022d5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8022d8:	83 ec 08             	sub    $0x8,%esp
+  8022db:	56                   	push   %esi
+  8022dc:	6a 00                	push   $0x0
+  8022de:	e8 b7 ef ff ff       	call   80129a <sys_page_unmap>
+	return r;
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	eb b5                	jmp    80229d <fd_close+0x35>
+
+008022e8 <close>:
+
+int
+close(int fdnum)
+{
+  8022e8:	55                   	push   %ebp
+  8022e9:	89 e5                	mov    %esp,%ebp
+  8022eb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022f1:	50                   	push   %eax
+  8022f2:	ff 75 08             	push   0x8(%ebp)
+  8022f5:	e8 a9 fe ff ff       	call   8021a3 <fd_lookup>
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	79 02                	jns    802303 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+		return fd_close(fd, 1);
+  802303:	83 ec 08             	sub    $0x8,%esp
+  802306:	6a 01                	push   $0x1
+  802308:	ff 75 f4             	push   -0xc(%ebp)
+  80230b:	e8 58 ff ff ff       	call   802268 <fd_close>
+  802310:	83 c4 10             	add    $0x10,%esp
+  802313:	eb ec                	jmp    802301 <close+0x19>
+
+00802315 <close_all>:
+
+void
+close_all(void)
+{
+  802315:	55                   	push   %ebp
+  802316:	89 e5                	mov    %esp,%ebp
+  802318:	53                   	push   %ebx
+  802319:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80231c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802321:	83 ec 0c             	sub    $0xc,%esp
+  802324:	53                   	push   %ebx
+  802325:	e8 be ff ff ff       	call   8022e8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80232a:	83 c3 01             	add    $0x1,%ebx
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  802336:	75 e9                	jne    802321 <close_all+0xc>
+}
+  802338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+0080233d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	57                   	push   %edi
+  802341:	56                   	push   %esi
+  802342:	53                   	push   %ebx
+  802343:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802346:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802349:	50                   	push   %eax
+  80234a:	ff 75 08             	push   0x8(%ebp)
+  80234d:	e8 51 fe ff ff       	call   8021a3 <fd_lookup>
+  802352:	89 c3                	mov    %eax,%ebx
+  802354:	83 c4 10             	add    $0x10,%esp
+  802357:	85 c0                	test   %eax,%eax
+  802359:	78 7f                	js     8023da <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80235b:	83 ec 0c             	sub    $0xc,%esp
+  80235e:	ff 75 0c             	push   0xc(%ebp)
+  802361:	e8 82 ff ff ff       	call   8022e8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802366:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802369:	c1 e6 0c             	shl    $0xc,%esi
+  80236c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802375:	89 3c 24             	mov    %edi,(%esp)
+  802378:	e8 bf fd ff ff       	call   80213c <fd2data>
+  80237d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80237f:	89 34 24             	mov    %esi,(%esp)
+  802382:	e8 b5 fd ff ff       	call   80213c <fd2data>
+  802387:	83 c4 10             	add    $0x10,%esp
+  80238a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80238d:	89 d8                	mov    %ebx,%eax
+  80238f:	c1 e8 16             	shr    $0x16,%eax
+  802392:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802399:	a8 01                	test   $0x1,%al
+  80239b:	74 11                	je     8023ae <dup+0x71>
+  80239d:	89 d8                	mov    %ebx,%eax
+  80239f:	c1 e8 0c             	shr    $0xc,%eax
+  8023a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8023a9:	f6 c2 01             	test   $0x1,%dl
+  8023ac:	75 36                	jne    8023e4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8023ae:	89 f8                	mov    %edi,%eax
+  8023b0:	c1 e8 0c             	shr    $0xc,%eax
+  8023b3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8023ba:	83 ec 0c             	sub    $0xc,%esp
+  8023bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023c2:	50                   	push   %eax
+  8023c3:	56                   	push   %esi
+  8023c4:	6a 00                	push   $0x0
+  8023c6:	57                   	push   %edi
+  8023c7:	6a 00                	push   $0x0
+  8023c9:	e8 8a ee ff ff       	call   801258 <sys_page_map>
+  8023ce:	89 c3                	mov    %eax,%ebx
+  8023d0:	83 c4 20             	add    $0x20,%esp
+  8023d3:	85 c0                	test   %eax,%eax
+  8023d5:	78 33                	js     80240a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8023d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8023da:	89 d8                	mov    %ebx,%eax
+  8023dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023df:	5b                   	pop    %ebx
+  8023e0:	5e                   	pop    %esi
+  8023e1:	5f                   	pop    %edi
+  8023e2:	5d                   	pop    %ebp
+  8023e3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8023e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8023eb:	83 ec 0c             	sub    $0xc,%esp
+  8023ee:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023f3:	50                   	push   %eax
+  8023f4:	ff 75 d4             	push   -0x2c(%ebp)
+  8023f7:	6a 00                	push   $0x0
+  8023f9:	53                   	push   %ebx
+  8023fa:	6a 00                	push   $0x0
+  8023fc:	e8 57 ee ff ff       	call   801258 <sys_page_map>
+  802401:	89 c3                	mov    %eax,%ebx
+  802403:	83 c4 20             	add    $0x20,%esp
+  802406:	85 c0                	test   %eax,%eax
+  802408:	79 a4                	jns    8023ae <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80240a:	83 ec 08             	sub    $0x8,%esp
+  80240d:	56                   	push   %esi
+  80240e:	6a 00                	push   $0x0
+  802410:	e8 85 ee ff ff       	call   80129a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802415:	83 c4 08             	add    $0x8,%esp
+  802418:	ff 75 d4             	push   -0x2c(%ebp)
+  80241b:	6a 00                	push   $0x0
+  80241d:	e8 78 ee ff ff       	call   80129a <sys_page_unmap>
+	return r;
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	eb b3                	jmp    8023da <dup+0x9d>
+
+00802427 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802427:	55                   	push   %ebp
+  802428:	89 e5                	mov    %esp,%ebp
+  80242a:	56                   	push   %esi
+  80242b:	53                   	push   %ebx
+  80242c:	83 ec 18             	sub    $0x18,%esp
+  80242f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802432:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802435:	50                   	push   %eax
+  802436:	53                   	push   %ebx
+  802437:	e8 67 fd ff ff       	call   8021a3 <fd_lookup>
+  80243c:	83 c4 10             	add    $0x10,%esp
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	78 3c                	js     80247f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802443:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802446:	83 ec 08             	sub    $0x8,%esp
+  802449:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80244c:	50                   	push   %eax
+  80244d:	ff 36                	push   (%esi)
+  80244f:	e8 a1 fd ff ff       	call   8021f5 <dev_lookup>
+  802454:	83 c4 10             	add    $0x10,%esp
+  802457:	85 c0                	test   %eax,%eax
+  802459:	78 24                	js     80247f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80245b:	8b 46 08             	mov    0x8(%esi),%eax
+  80245e:	83 e0 03             	and    $0x3,%eax
+  802461:	83 f8 01             	cmp    $0x1,%eax
+  802464:	74 20                	je     802486 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802466:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802469:	8b 40 08             	mov    0x8(%eax),%eax
+  80246c:	85 c0                	test   %eax,%eax
+  80246e:	74 54                	je     8024c4 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802470:	83 ec 04             	sub    $0x4,%esp
+  802473:	ff 75 10             	push   0x10(%ebp)
+  802476:	ff 75 0c             	push   0xc(%ebp)
+  802479:	56                   	push   %esi
+  80247a:	ff d0                	call   *%eax
+  80247c:	83 c4 10             	add    $0x10,%esp
+}
+  80247f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802482:	5b                   	pop    %ebx
+  802483:	5e                   	pop    %esi
+  802484:	5d                   	pop    %ebp
+  802485:	c3                   	ret
+  802486:	89 e2                	mov    %esp,%edx
+  802488:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80248d:	29 d0                	sub    %edx,%eax
+  80248f:	89 c2                	mov    %eax,%edx
+  802491:	c1 ea 0f             	shr    $0xf,%edx
+  802494:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249e:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024a1:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  8024a8:	8b 40 48             	mov    0x48(%eax),%eax
+  8024ab:	83 ec 04             	sub    $0x4,%esp
+  8024ae:	53                   	push   %ebx
+  8024af:	50                   	push   %eax
+  8024b0:	68 89 52 80 00       	push   $0x805289
+  8024b5:	e8 30 e2 ff ff       	call   8006ea <cprintf>
+		return -E_INVAL;
+  8024ba:	83 c4 10             	add    $0x10,%esp
+  8024bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024c2:	eb bb                	jmp    80247f <read+0x58>
+		return -E_NOT_SUPP;
+  8024c4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024c9:	eb b4                	jmp    80247f <read+0x58>
+
+008024cb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	57                   	push   %edi
+  8024cf:	56                   	push   %esi
+  8024d0:	53                   	push   %ebx
+  8024d1:	83 ec 0c             	sub    $0xc,%esp
+  8024d4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024d7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8024da:	85 f6                	test   %esi,%esi
+  8024dc:	74 30                	je     80250e <readn+0x43>
+  8024de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e3:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024e8:	83 ec 04             	sub    $0x4,%esp
+  8024eb:	89 f2                	mov    %esi,%edx
+  8024ed:	29 c2                	sub    %eax,%edx
+  8024ef:	52                   	push   %edx
+  8024f0:	01 f8                	add    %edi,%eax
+  8024f2:	50                   	push   %eax
+  8024f3:	ff 75 08             	push   0x8(%ebp)
+  8024f6:	e8 2c ff ff ff       	call   802427 <read>
+		if (m < 0)
+  8024fb:	83 c4 10             	add    $0x10,%esp
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	78 15                	js     802517 <readn+0x4c>
+			return m;
+		if (m == 0)
+  802502:	74 11                	je     802515 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802504:	01 c3                	add    %eax,%ebx
+  802506:	89 d8                	mov    %ebx,%eax
+  802508:	39 f3                	cmp    %esi,%ebx
+  80250a:	72 dc                	jb     8024e8 <readn+0x1d>
+  80250c:	eb 09                	jmp    802517 <readn+0x4c>
+  80250e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802513:	eb 02                	jmp    802517 <readn+0x4c>
+  802515:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  802517:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80251a:	5b                   	pop    %ebx
+  80251b:	5e                   	pop    %esi
+  80251c:	5f                   	pop    %edi
+  80251d:	5d                   	pop    %ebp
+  80251e:	c3                   	ret
+
+0080251f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80251f:	55                   	push   %ebp
+  802520:	89 e5                	mov    %esp,%ebp
+  802522:	56                   	push   %esi
+  802523:	53                   	push   %ebx
+  802524:	83 ec 18             	sub    $0x18,%esp
+  802527:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80252a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80252d:	50                   	push   %eax
+  80252e:	53                   	push   %ebx
+  80252f:	e8 6f fc ff ff       	call   8021a3 <fd_lookup>
+  802534:	83 c4 10             	add    $0x10,%esp
+  802537:	85 c0                	test   %eax,%eax
+  802539:	78 37                	js     802572 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80253b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80253e:	83 ec 08             	sub    $0x8,%esp
+  802541:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802544:	50                   	push   %eax
+  802545:	ff 36                	push   (%esi)
+  802547:	e8 a9 fc ff ff       	call   8021f5 <dev_lookup>
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	85 c0                	test   %eax,%eax
+  802551:	78 1f                	js     802572 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802553:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802557:	74 20                	je     802579 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802559:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80255c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80255f:	85 c0                	test   %eax,%eax
+  802561:	74 54                	je     8025b7 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802563:	83 ec 04             	sub    $0x4,%esp
+  802566:	ff 75 10             	push   0x10(%ebp)
+  802569:	ff 75 0c             	push   0xc(%ebp)
+  80256c:	56                   	push   %esi
+  80256d:	ff d0                	call   *%eax
+  80256f:	83 c4 10             	add    $0x10,%esp
+}
+  802572:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802575:	5b                   	pop    %ebx
+  802576:	5e                   	pop    %esi
+  802577:	5d                   	pop    %ebp
+  802578:	c3                   	ret
+  802579:	89 e2                	mov    %esp,%edx
+  80257b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802580:	29 d0                	sub    %edx,%eax
+  802582:	89 c2                	mov    %eax,%edx
+  802584:	c1 ea 0f             	shr    $0xf,%edx
+  802587:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80258c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802591:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802594:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  80259b:	8b 40 48             	mov    0x48(%eax),%eax
+  80259e:	83 ec 04             	sub    $0x4,%esp
+  8025a1:	53                   	push   %ebx
+  8025a2:	50                   	push   %eax
+  8025a3:	68 a5 52 80 00       	push   $0x8052a5
+  8025a8:	e8 3d e1 ff ff       	call   8006ea <cprintf>
+		return -E_INVAL;
+  8025ad:	83 c4 10             	add    $0x10,%esp
+  8025b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025b5:	eb bb                	jmp    802572 <write+0x53>
+		return -E_NOT_SUPP;
+  8025b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025bc:	eb b4                	jmp    802572 <write+0x53>
+
+008025be <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8025be:	55                   	push   %ebp
+  8025bf:	89 e5                	mov    %esp,%ebp
+  8025c1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025c7:	50                   	push   %eax
+  8025c8:	ff 75 08             	push   0x8(%ebp)
+  8025cb:	e8 d3 fb ff ff       	call   8021a3 <fd_lookup>
+  8025d0:	83 c4 10             	add    $0x10,%esp
+  8025d3:	85 c0                	test   %eax,%eax
+  8025d5:	78 0e                	js     8025e5 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8025d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025dd:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8025e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e5:	c9                   	leave
+  8025e6:	c3                   	ret
+
+008025e7 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8025e7:	55                   	push   %ebp
+  8025e8:	89 e5                	mov    %esp,%ebp
+  8025ea:	53                   	push   %ebx
+  8025eb:	83 ec 1c             	sub    $0x1c,%esp
+  8025ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025f4:	50                   	push   %eax
+  8025f5:	ff 75 08             	push   0x8(%ebp)
+  8025f8:	e8 a6 fb ff ff       	call   8021a3 <fd_lookup>
+  8025fd:	83 c4 10             	add    $0x10,%esp
+  802600:	85 c0                	test   %eax,%eax
+  802602:	78 33                	js     802637 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802604:	83 fb 03             	cmp    $0x3,%ebx
+  802607:	74 28                	je     802631 <fcntl+0x4a>
+  802609:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80260e:	83 fb 04             	cmp    $0x4,%ebx
+  802611:	75 24                	jne    802637 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802613:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802616:	8b 41 08             	mov    0x8(%ecx),%eax
+  802619:	80 e4 ef             	and    $0xef,%ah
+  80261c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80261f:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802625:	09 d0                	or     %edx,%eax
+  802627:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80262a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262f:	eb 06                	jmp    802637 <fcntl+0x50>
+		return fd->fd_omode;
+  802631:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802634:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802637:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+0080263c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	56                   	push   %esi
+  802640:	53                   	push   %ebx
+  802641:	83 ec 18             	sub    $0x18,%esp
+  802644:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802647:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80264a:	50                   	push   %eax
+  80264b:	53                   	push   %ebx
+  80264c:	e8 52 fb ff ff       	call   8021a3 <fd_lookup>
+  802651:	83 c4 10             	add    $0x10,%esp
+  802654:	85 c0                	test   %eax,%eax
+  802656:	78 34                	js     80268c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802658:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80265b:	83 ec 08             	sub    $0x8,%esp
+  80265e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802661:	50                   	push   %eax
+  802662:	ff 36                	push   (%esi)
+  802664:	e8 8c fb ff ff       	call   8021f5 <dev_lookup>
+  802669:	83 c4 10             	add    $0x10,%esp
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	78 1c                	js     80268c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802670:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802674:	74 1d                	je     802693 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802676:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802679:	8b 40 18             	mov    0x18(%eax),%eax
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	74 51                	je     8026d1 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802680:	83 ec 08             	sub    $0x8,%esp
+  802683:	ff 75 0c             	push   0xc(%ebp)
+  802686:	56                   	push   %esi
+  802687:	ff d0                	call   *%eax
+  802689:	83 c4 10             	add    $0x10,%esp
+}
+  80268c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80268f:	5b                   	pop    %ebx
+  802690:	5e                   	pop    %esi
+  802691:	5d                   	pop    %ebp
+  802692:	c3                   	ret
+  802693:	89 e2                	mov    %esp,%edx
+  802695:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80269a:	29 d0                	sub    %edx,%eax
+  80269c:	89 c2                	mov    %eax,%edx
+  80269e:	c1 ea 0f             	shr    $0xf,%edx
+  8026a1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8026a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ab:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8026ae:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  8026b5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8026b8:	83 ec 04             	sub    $0x4,%esp
+  8026bb:	53                   	push   %ebx
+  8026bc:	50                   	push   %eax
+  8026bd:	68 68 52 80 00       	push   $0x805268
+  8026c2:	e8 23 e0 ff ff       	call   8006ea <cprintf>
+		return -E_INVAL;
+  8026c7:	83 c4 10             	add    $0x10,%esp
+  8026ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026cf:	eb bb                	jmp    80268c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8026d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026d6:	eb b4                	jmp    80268c <ftruncate+0x50>
+
+008026d8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	56                   	push   %esi
+  8026dc:	53                   	push   %ebx
+  8026dd:	83 ec 18             	sub    $0x18,%esp
+  8026e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8026e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026e6:	50                   	push   %eax
+  8026e7:	ff 75 08             	push   0x8(%ebp)
+  8026ea:	e8 b4 fa ff ff       	call   8021a3 <fd_lookup>
+  8026ef:	83 c4 10             	add    $0x10,%esp
+  8026f2:	85 c0                	test   %eax,%eax
+  8026f4:	78 53                	js     802749 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026f6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026f9:	83 ec 08             	sub    $0x8,%esp
+  8026fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ff:	50                   	push   %eax
+  802700:	ff 36                	push   (%esi)
+  802702:	e8 ee fa ff ff       	call   8021f5 <dev_lookup>
+  802707:	83 c4 10             	add    $0x10,%esp
+  80270a:	85 c0                	test   %eax,%eax
+  80270c:	78 3b                	js     802749 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80270e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802711:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802715:	74 39                	je     802750 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802717:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80271a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802721:	00 00 00 
+	stat->st_isdir = 0;
+  802724:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80272b:	00 00 00 
+	stat->st_version = 0;
+  80272e:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802735:	00 00 00 
+	stat->st_dev = dev;
+  802738:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80273e:	83 ec 08             	sub    $0x8,%esp
+  802741:	53                   	push   %ebx
+  802742:	56                   	push   %esi
+  802743:	ff 50 14             	call   *0x14(%eax)
+  802746:	83 c4 10             	add    $0x10,%esp
+}
+  802749:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80274c:	5b                   	pop    %ebx
+  80274d:	5e                   	pop    %esi
+  80274e:	5d                   	pop    %ebp
+  80274f:	c3                   	ret
+		return -E_NOT_SUPP;
+  802750:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802755:	eb f2                	jmp    802749 <fstat+0x71>
+
+00802757 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802757:	55                   	push   %ebp
+  802758:	89 e5                	mov    %esp,%ebp
+  80275a:	56                   	push   %esi
+  80275b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80275c:	83 ec 08             	sub    $0x8,%esp
+  80275f:	6a 00                	push   $0x0
+  802761:	ff 75 08             	push   0x8(%ebp)
+  802764:	e8 b7 01 00 00       	call   802920 <open>
+  802769:	89 c3                	mov    %eax,%ebx
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	78 1b                	js     80278d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802772:	83 ec 08             	sub    $0x8,%esp
+  802775:	ff 75 0c             	push   0xc(%ebp)
+  802778:	50                   	push   %eax
+  802779:	e8 5a ff ff ff       	call   8026d8 <fstat>
+  80277e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802780:	89 1c 24             	mov    %ebx,(%esp)
+  802783:	e8 60 fb ff ff       	call   8022e8 <close>
+	return r;
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	89 f3                	mov    %esi,%ebx
+}
+  80278d:	89 d8                	mov    %ebx,%eax
+  80278f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802792:	5b                   	pop    %ebx
+  802793:	5e                   	pop    %esi
+  802794:	5d                   	pop    %ebp
+  802795:	c3                   	ret
+
+00802796 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802796:	55                   	push   %ebp
+  802797:	89 e5                	mov    %esp,%ebp
+  802799:	56                   	push   %esi
+  80279a:	53                   	push   %ebx
+  80279b:	89 c6                	mov    %eax,%esi
+  80279d:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80279f:	83 3d e4 76 80 00 00 	cmpl   $0x0,0x8076e4
+  8027a6:	74 27                	je     8027cf <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8027a8:	6a 07                	push   $0x7
+  8027aa:	68 00 80 80 00       	push   $0x808000
+  8027af:	56                   	push   %esi
+  8027b0:	ff 35 e4 76 80 00    	push   0x8076e4
+  8027b6:	e8 c9 f8 ff ff       	call   802084 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8027bb:	83 c4 0c             	add    $0xc,%esp
+  8027be:	6a 00                	push   $0x0
+  8027c0:	53                   	push   %ebx
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	e8 2c f6 ff ff       	call   801df4 <ipc_recv>
+}
+  8027c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027cb:	5b                   	pop    %ebx
+  8027cc:	5e                   	pop    %esi
+  8027cd:	5d                   	pop    %ebp
+  8027ce:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027cf:	83 ec 0c             	sub    $0xc,%esp
+  8027d2:	6a 02                	push   $0x2
+  8027d4:	e8 14 f9 ff ff       	call   8020ed <ipc_find_env>
+  8027d9:	a3 e4 76 80 00       	mov    %eax,0x8076e4
+  8027de:	83 c4 10             	add    $0x10,%esp
+  8027e1:	eb c5                	jmp    8027a8 <fsipc+0x12>
+
+008027e3 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8027e3:	55                   	push   %ebp
+  8027e4:	89 e5                	mov    %esp,%ebp
+  8027e6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8027e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ec:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027ef:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8027f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027f7:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8027fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802801:	b8 02 00 00 00       	mov    $0x2,%eax
+  802806:	e8 8b ff ff ff       	call   802796 <fsipc>
+}
+  80280b:	c9                   	leave
+  80280c:	c3                   	ret
+
+0080280d <devfile_flush>:
+{
+  80280d:	55                   	push   %ebp
+  80280e:	89 e5                	mov    %esp,%ebp
+  802810:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802813:	8b 45 08             	mov    0x8(%ebp),%eax
+  802816:	8b 40 0c             	mov    0xc(%eax),%eax
+  802819:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80281e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802823:	b8 06 00 00 00       	mov    $0x6,%eax
+  802828:	e8 69 ff ff ff       	call   802796 <fsipc>
+}
+  80282d:	c9                   	leave
+  80282e:	c3                   	ret
+
+0080282f <devfile_stat>:
+{
+  80282f:	55                   	push   %ebp
+  802830:	89 e5                	mov    %esp,%ebp
+  802832:	53                   	push   %ebx
+  802833:	83 ec 04             	sub    $0x4,%esp
+  802836:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802839:	8b 45 08             	mov    0x8(%ebp),%eax
+  80283c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80283f:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802844:	ba 00 00 00 00       	mov    $0x0,%edx
+  802849:	b8 05 00 00 00       	mov    $0x5,%eax
+  80284e:	e8 43 ff ff ff       	call   802796 <fsipc>
+  802853:	85 c0                	test   %eax,%eax
+  802855:	78 37                	js     80288e <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802857:	83 ec 08             	sub    $0x8,%esp
+  80285a:	68 00 80 80 00       	push   $0x808000
+  80285f:	53                   	push   %ebx
+  802860:	e8 7c e5 ff ff       	call   800de1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802865:	a1 80 80 80 00       	mov    0x808080,%eax
+  80286a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802870:	a1 84 80 80 00       	mov    0x808084,%eax
+  802875:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80287b:	a1 88 80 80 00       	mov    0x808088,%eax
+  802880:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802886:	83 c4 10             	add    $0x10,%esp
+  802889:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802891:	c9                   	leave
+  802892:	c3                   	ret
+
+00802893 <devfile_write>:
+{
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	83 ec 0c             	sub    $0xc,%esp
+  802899:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80289c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8028a1:	39 d0                	cmp    %edx,%eax
+  8028a3:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028a9:	8b 52 0c             	mov    0xc(%edx),%edx
+  8028ac:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = count;
+  8028b2:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8028b7:	50                   	push   %eax
+  8028b8:	ff 75 0c             	push   0xc(%ebp)
+  8028bb:	68 08 80 80 00       	push   $0x808008
+  8028c0:	e8 cc e6 ff ff       	call   800f91 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8028c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ca:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028cf:	e8 c2 fe ff ff       	call   802796 <fsipc>
+}
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+
+008028d6 <devfile_read>:
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	53                   	push   %ebx
+  8028da:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8028dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028e3:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8028e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028eb:	a3 04 80 80 00       	mov    %eax,0x808004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8028f0:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8028f5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028fa:	e8 97 fe ff ff       	call   802796 <fsipc>
+  8028ff:	89 c3                	mov    %eax,%ebx
+  802901:	85 c0                	test   %eax,%eax
+  802903:	78 14                	js     802919 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802905:	83 ec 04             	sub    $0x4,%esp
+  802908:	50                   	push   %eax
+  802909:	68 00 80 80 00       	push   $0x808000
+  80290e:	ff 75 0c             	push   0xc(%ebp)
+  802911:	e8 7b e6 ff ff       	call   800f91 <memmove>
+	return r;
+  802916:	83 c4 10             	add    $0x10,%esp
+}
+  802919:	89 d8                	mov    %ebx,%eax
+  80291b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291e:	c9                   	leave
+  80291f:	c3                   	ret
+
+00802920 <open>:
+{
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	53                   	push   %ebx
+  802924:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802927:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80292a:	50                   	push   %eax
+  80292b:	e8 23 f8 ff ff       	call   802153 <fd_alloc>
+  802930:	89 c3                	mov    %eax,%ebx
+  802932:	83 c4 10             	add    $0x10,%esp
+  802935:	85 c0                	test   %eax,%eax
+  802937:	78 2a                	js     802963 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802939:	83 ec 0c             	sub    $0xc,%esp
+  80293c:	ff 75 08             	push   0x8(%ebp)
+  80293f:	e8 51 e4 ff ff       	call   800d95 <strlen>
+  802944:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802947:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80294c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802951:	7e 17                	jle    80296a <open+0x4a>
+	fd_close(fd, 1);
+  802953:	83 ec 08             	sub    $0x8,%esp
+  802956:	6a 01                	push   $0x1
+  802958:	ff 75 f4             	push   -0xc(%ebp)
+  80295b:	e8 08 f9 ff ff       	call   802268 <fd_close>
+	return r;
+  802960:	83 c4 10             	add    $0x10,%esp
+}
+  802963:	89 d8                	mov    %ebx,%eax
+  802965:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80296a:	83 ec 08             	sub    $0x8,%esp
+  80296d:	ff 75 08             	push   0x8(%ebp)
+  802970:	68 00 80 80 00       	push   $0x808000
+  802975:	e8 67 e4 ff ff       	call   800de1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80297a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80297d:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802982:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802985:	b8 01 00 00 00       	mov    $0x1,%eax
+  80298a:	e8 07 fe ff ff       	call   802796 <fsipc>
+  80298f:	89 c3                	mov    %eax,%ebx
+  802991:	83 c4 10             	add    $0x10,%esp
+  802994:	85 c0                	test   %eax,%eax
+  802996:	78 bb                	js     802953 <open+0x33>
+	return fd2num(fd); 	
+  802998:	83 ec 0c             	sub    $0xc,%esp
+  80299b:	ff 75 f4             	push   -0xc(%ebp)
+  80299e:	e8 89 f7 ff ff       	call   80212c <fd2num>
+  8029a3:	89 c3                	mov    %eax,%ebx
+  8029a5:	83 c4 10             	add    $0x10,%esp
+  8029a8:	eb b9                	jmp    802963 <open+0x43>
+
+008029aa <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8029aa:	55                   	push   %ebp
+  8029ab:	89 e5                	mov    %esp,%ebp
+  8029ad:	53                   	push   %ebx
+  8029ae:	83 ec 1c             	sub    $0x1c,%esp
+  8029b1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029b7:	50                   	push   %eax
+  8029b8:	ff 75 08             	push   0x8(%ebp)
+  8029bb:	e8 e3 f7 ff ff       	call   8021a3 <fd_lookup>
+  8029c0:	83 c4 10             	add    $0x10,%esp
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 5a                	js     802a21 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8029c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ca:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  8029d0:	39 10                	cmp    %edx,(%eax)
+  8029d2:	75 66                	jne    802a3a <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8029d4:	83 3d e4 76 80 00 00 	cmpl   $0x0,0x8076e4
+  8029db:	74 49                	je     802a26 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8029dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029e0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029e3:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8029e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029eb:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_npages = maxpages;
+  8029f0:	89 1d 08 80 80 00    	mov    %ebx,0x808008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8029f6:	6a 07                	push   $0x7
+  8029f8:	68 00 80 80 00       	push   $0x808000
+  8029fd:	6a 09                	push   $0x9
+  8029ff:	ff 35 e4 76 80 00    	push   0x8076e4
+  802a05:	e8 7a f6 ff ff       	call   802084 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802a0a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802a11:	6a 00                	push   $0x0
+  802a13:	53                   	push   %ebx
+  802a14:	ff 75 10             	push   0x10(%ebp)
+  802a17:	6a 00                	push   $0x0
+  802a19:	e8 a3 f4 ff ff       	call   801ec1 <ipc_recv_pages>
+  802a1e:	83 c4 20             	add    $0x20,%esp
+}
+  802a21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a26:	83 ec 0c             	sub    $0xc,%esp
+  802a29:	6a 02                	push   $0x2
+  802a2b:	e8 bd f6 ff ff       	call   8020ed <ipc_find_env>
+  802a30:	a3 e4 76 80 00       	mov    %eax,0x8076e4
+  802a35:	83 c4 10             	add    $0x10,%esp
+  802a38:	eb a3                	jmp    8029dd <fmap+0x33>
+		return -E_INVAL;
+  802a3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a3f:	eb e0                	jmp    802a21 <fmap+0x77>
+
+00802a41 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802a41:	55                   	push   %ebp
+  802a42:	89 e5                	mov    %esp,%ebp
+  802a44:	53                   	push   %ebx
+  802a45:	83 ec 10             	sub    $0x10,%esp
+  802a48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802a4b:	53                   	push   %ebx
+  802a4c:	e8 44 e3 ff ff       	call   800d95 <strlen>
+  802a51:	83 c4 10             	add    $0x10,%esp
+  802a54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a59:	7f 25                	jg     802a80 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802a5b:	83 ec 08             	sub    $0x8,%esp
+  802a5e:	53                   	push   %ebx
+  802a5f:	68 00 80 80 00       	push   $0x808000
+  802a64:	e8 78 e3 ff ff       	call   800de1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a73:	e8 1e fd ff ff       	call   802796 <fsipc>
+  802a78:	83 c4 10             	add    $0x10,%esp
+}
+  802a7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a7e:	c9                   	leave
+  802a7f:	c3                   	ret
+		return -E_BAD_PATH;
+  802a80:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a85:	eb f4                	jmp    802a7b <remove+0x3a>
+
+00802a87 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a87:	55                   	push   %ebp
+  802a88:	89 e5                	mov    %esp,%ebp
+  802a8a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a92:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a97:	e8 fa fc ff ff       	call   802796 <fsipc>
+}
+  802a9c:	c9                   	leave
+  802a9d:	c3                   	ret
+
+00802a9e <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a9e:	55                   	push   %ebp
+  802a9f:	89 e5                	mov    %esp,%ebp
+  802aa1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802aa4:	68 d8 52 80 00       	push   $0x8052d8
+  802aa9:	ff 75 0c             	push   0xc(%ebp)
+  802aac:	e8 30 e3 ff ff       	call   800de1 <strcpy>
+	return 0;
+}
+  802ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab6:	c9                   	leave
+  802ab7:	c3                   	ret
+
+00802ab8 <devsock_close>:
+{
+  802ab8:	55                   	push   %ebp
+  802ab9:	89 e5                	mov    %esp,%ebp
+  802abb:	53                   	push   %ebx
+  802abc:	83 ec 10             	sub    $0x10,%esp
+  802abf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ac2:	53                   	push   %ebx
+  802ac3:	e8 23 1c 00 00       	call   8046eb <pageref>
+  802ac8:	89 c2                	mov    %eax,%edx
+  802aca:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802acd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ad2:	83 fa 01             	cmp    $0x1,%edx
+  802ad5:	74 05                	je     802adc <devsock_close+0x24>
+}
+  802ad7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ada:	c9                   	leave
+  802adb:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802adc:	83 ec 0c             	sub    $0xc,%esp
+  802adf:	ff 73 0c             	push   0xc(%ebx)
+  802ae2:	e8 b0 05 00 00       	call   803097 <nsipc_close>
+  802ae7:	83 c4 10             	add    $0x10,%esp
+  802aea:	eb eb                	jmp    802ad7 <devsock_close+0x1f>
+
+00802aec <devsock_write>:
+{
+  802aec:	55                   	push   %ebp
+  802aed:	89 e5                	mov    %esp,%ebp
+  802aef:	53                   	push   %ebx
+  802af0:	83 ec 14             	sub    $0x14,%esp
+  802af3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802af6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802af9:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802afc:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802aff:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802b02:	8b 41 08             	mov    0x8(%ecx),%eax
+  802b05:	c1 f8 09             	sar    $0x9,%eax
+  802b08:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802b0b:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802b11:	77 13                	ja     802b26 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802b13:	50                   	push   %eax
+  802b14:	52                   	push   %edx
+  802b15:	53                   	push   %ebx
+  802b16:	ff 71 0c             	push   0xc(%ecx)
+  802b19:	e8 5c 06 00 00       	call   80317a <nsipc_send>
+  802b1e:	83 c4 10             	add    $0x10,%esp
+}
+  802b21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b24:	c9                   	leave
+  802b25:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802b26:	50                   	push   %eax
+  802b27:	6a 01                	push   $0x1
+  802b29:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802b2c:	50                   	push   %eax
+  802b2d:	ff 71 0c             	push   0xc(%ecx)
+  802b30:	e8 a6 06 00 00       	call   8031db <nsipc_sendmsg>
+  802b35:	83 c4 10             	add    $0x10,%esp
+  802b38:	eb e7                	jmp    802b21 <devsock_write+0x35>
+
+00802b3a <devsock_read>:
+{
+  802b3a:	55                   	push   %ebp
+  802b3b:	89 e5                	mov    %esp,%ebp
+  802b3d:	53                   	push   %ebx
+  802b3e:	83 ec 14             	sub    $0x14,%esp
+  802b41:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802b47:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802b4a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802b4d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802b50:	8b 41 08             	mov    0x8(%ecx),%eax
+  802b53:	c1 f8 09             	sar    $0x9,%eax
+  802b56:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802b59:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802b5f:	77 13                	ja     802b74 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802b61:	50                   	push   %eax
+  802b62:	52                   	push   %edx
+  802b63:	53                   	push   %ebx
+  802b64:	ff 71 0c             	push   0xc(%ecx)
+  802b67:	e8 9c 05 00 00       	call   803108 <nsipc_recv>
+  802b6c:	83 c4 10             	add    $0x10,%esp
+}
+  802b6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b72:	c9                   	leave
+  802b73:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802b74:	50                   	push   %eax
+  802b75:	6a 01                	push   $0x1
+  802b77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802b7a:	50                   	push   %eax
+  802b7b:	ff 71 0c             	push   0xc(%ecx)
+  802b7e:	e8 02 0a 00 00       	call   803585 <nsipc_recvmsg>
+  802b83:	83 c4 10             	add    $0x10,%esp
+  802b86:	eb e7                	jmp    802b6f <devsock_read+0x35>
+
+00802b88 <fd2sockid>:
+{
+  802b88:	55                   	push   %ebp
+  802b89:	89 e5                	mov    %esp,%ebp
+  802b8b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b8e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b91:	52                   	push   %edx
+  802b92:	50                   	push   %eax
+  802b93:	e8 0b f6 ff ff       	call   8021a3 <fd_lookup>
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	85 c0                	test   %eax,%eax
+  802b9d:	78 10                	js     802baf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba2:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  802ba8:	39 08                	cmp    %ecx,(%eax)
+  802baa:	75 05                	jne    802bb1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802bac:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802baf:	c9                   	leave
+  802bb0:	c3                   	ret
+		return -E_NOT_SUPP;
+  802bb1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bb6:	eb f7                	jmp    802baf <fd2sockid+0x27>
+
+00802bb8 <sock_flags>:
+{
+  802bb8:	55                   	push   %ebp
+  802bb9:	89 e5                	mov    %esp,%ebp
+  802bbb:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802bbe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bc1:	52                   	push   %edx
+  802bc2:	50                   	push   %eax
+  802bc3:	e8 db f5 ff ff       	call   8021a3 <fd_lookup>
+  802bc8:	83 c4 10             	add    $0x10,%esp
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	78 0e                	js     802bdd <sock_flags+0x25>
+  802bcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bd2:	8b 40 08             	mov    0x8(%eax),%eax
+  802bd5:	c1 e8 09             	shr    $0x9,%eax
+  802bd8:	83 e0 08             	and    $0x8,%eax
+}
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+		return 0;
+  802bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be2:	eb f7                	jmp    802bdb <sock_flags+0x23>
+
+00802be4 <alloc_sockfd>:
+{
+  802be4:	55                   	push   %ebp
+  802be5:	89 e5                	mov    %esp,%ebp
+  802be7:	56                   	push   %esi
+  802be8:	53                   	push   %ebx
+  802be9:	83 ec 1c             	sub    $0x1c,%esp
+  802bec:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802bee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bf1:	50                   	push   %eax
+  802bf2:	e8 5c f5 ff ff       	call   802153 <fd_alloc>
+  802bf7:	89 c3                	mov    %eax,%ebx
+  802bf9:	83 c4 10             	add    $0x10,%esp
+  802bfc:	85 c0                	test   %eax,%eax
+  802bfe:	78 43                	js     802c43 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c00:	83 ec 04             	sub    $0x4,%esp
+  802c03:	68 07 04 00 00       	push   $0x407
+  802c08:	ff 75 f4             	push   -0xc(%ebp)
+  802c0b:	6a 00                	push   $0x0
+  802c0d:	e8 03 e6 ff ff       	call   801215 <sys_page_alloc>
+  802c12:	89 c3                	mov    %eax,%ebx
+  802c14:	83 c4 10             	add    $0x10,%esp
+  802c17:	85 c0                	test   %eax,%eax
+  802c19:	78 28                	js     802c43 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c1e:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  802c24:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c29:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c30:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c33:	83 ec 0c             	sub    $0xc,%esp
+  802c36:	50                   	push   %eax
+  802c37:	e8 f0 f4 ff ff       	call   80212c <fd2num>
+  802c3c:	89 c3                	mov    %eax,%ebx
+  802c3e:	83 c4 10             	add    $0x10,%esp
+  802c41:	eb 0c                	jmp    802c4f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c43:	83 ec 0c             	sub    $0xc,%esp
+  802c46:	56                   	push   %esi
+  802c47:	e8 4b 04 00 00       	call   803097 <nsipc_close>
+		return r;
+  802c4c:	83 c4 10             	add    $0x10,%esp
+}
+  802c4f:	89 d8                	mov    %ebx,%eax
+  802c51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c54:	5b                   	pop    %ebx
+  802c55:	5e                   	pop    %esi
+  802c56:	5d                   	pop    %ebp
+  802c57:	c3                   	ret
+
+00802c58 <accept>:
+{
+  802c58:	55                   	push   %ebp
+  802c59:	89 e5                	mov    %esp,%ebp
+  802c5b:	56                   	push   %esi
+  802c5c:	53                   	push   %ebx
+  802c5d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802c60:	89 f0                	mov    %esi,%eax
+  802c62:	e8 21 ff ff ff       	call   802b88 <fd2sockid>
+  802c67:	89 c3                	mov    %eax,%ebx
+  802c69:	85 c0                	test   %eax,%eax
+  802c6b:	78 24                	js     802c91 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802c6d:	89 f0                	mov    %esi,%eax
+  802c6f:	e8 44 ff ff ff       	call   802bb8 <sock_flags>
+  802c74:	50                   	push   %eax
+  802c75:	ff 75 10             	push   0x10(%ebp)
+  802c78:	ff 75 0c             	push   0xc(%ebp)
+  802c7b:	53                   	push   %ebx
+  802c7c:	e8 6b 03 00 00       	call   802fec <nsipc_accept>
+  802c81:	89 c3                	mov    %eax,%ebx
+  802c83:	83 c4 10             	add    $0x10,%esp
+  802c86:	85 c0                	test   %eax,%eax
+  802c88:	78 07                	js     802c91 <accept+0x39>
+	return alloc_sockfd(r);
+  802c8a:	e8 55 ff ff ff       	call   802be4 <alloc_sockfd>
+  802c8f:	89 c3                	mov    %eax,%ebx
+}
+  802c91:	89 d8                	mov    %ebx,%eax
+  802c93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c96:	5b                   	pop    %ebx
+  802c97:	5e                   	pop    %esi
+  802c98:	5d                   	pop    %ebp
+  802c99:	c3                   	ret
+
+00802c9a <bind>:
+{
+  802c9a:	55                   	push   %ebp
+  802c9b:	89 e5                	mov    %esp,%ebp
+  802c9d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca3:	e8 e0 fe ff ff       	call   802b88 <fd2sockid>
+  802ca8:	85 c0                	test   %eax,%eax
+  802caa:	78 12                	js     802cbe <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802cac:	83 ec 04             	sub    $0x4,%esp
+  802caf:	ff 75 10             	push   0x10(%ebp)
+  802cb2:	ff 75 0c             	push   0xc(%ebp)
+  802cb5:	50                   	push   %eax
+  802cb6:	e8 85 03 00 00       	call   803040 <nsipc_bind>
+  802cbb:	83 c4 10             	add    $0x10,%esp
+}
+  802cbe:	c9                   	leave
+  802cbf:	c3                   	ret
+
+00802cc0 <shutdown>:
+{
+  802cc0:	55                   	push   %ebp
+  802cc1:	89 e5                	mov    %esp,%ebp
+  802cc3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc9:	e8 ba fe ff ff       	call   802b88 <fd2sockid>
+  802cce:	85 c0                	test   %eax,%eax
+  802cd0:	78 0f                	js     802ce1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802cd2:	83 ec 08             	sub    $0x8,%esp
+  802cd5:	ff 75 0c             	push   0xc(%ebp)
+  802cd8:	50                   	push   %eax
+  802cd9:	e8 97 03 00 00       	call   803075 <nsipc_shutdown>
+  802cde:	83 c4 10             	add    $0x10,%esp
+}
+  802ce1:	c9                   	leave
+  802ce2:	c3                   	ret
+
+00802ce3 <connect>:
+{
+  802ce3:	55                   	push   %ebp
+  802ce4:	89 e5                	mov    %esp,%ebp
+  802ce6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cec:	e8 97 fe ff ff       	call   802b88 <fd2sockid>
+  802cf1:	85 c0                	test   %eax,%eax
+  802cf3:	78 12                	js     802d07 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802cf5:	83 ec 04             	sub    $0x4,%esp
+  802cf8:	ff 75 10             	push   0x10(%ebp)
+  802cfb:	ff 75 0c             	push   0xc(%ebp)
+  802cfe:	50                   	push   %eax
+  802cff:	e8 ad 03 00 00       	call   8030b1 <nsipc_connect>
+  802d04:	83 c4 10             	add    $0x10,%esp
+}
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+
+00802d09 <listen>:
+{
+  802d09:	55                   	push   %ebp
+  802d0a:	89 e5                	mov    %esp,%ebp
+  802d0c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d12:	e8 71 fe ff ff       	call   802b88 <fd2sockid>
+  802d17:	85 c0                	test   %eax,%eax
+  802d19:	78 0f                	js     802d2a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d1b:	83 ec 08             	sub    $0x8,%esp
+  802d1e:	ff 75 0c             	push   0xc(%ebp)
+  802d21:	50                   	push   %eax
+  802d22:	e8 bf 03 00 00       	call   8030e6 <nsipc_listen>
+  802d27:	83 c4 10             	add    $0x10,%esp
+}
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+
+00802d2c <sendmsg>:
+{
+  802d2c:	55                   	push   %ebp
+  802d2d:	89 e5                	mov    %esp,%ebp
+  802d2f:	57                   	push   %edi
+  802d30:	56                   	push   %esi
+  802d31:	53                   	push   %ebx
+  802d32:	83 ec 0c             	sub    $0xc,%esp
+  802d35:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d38:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802d3b:	89 f0                	mov    %esi,%eax
+  802d3d:	e8 46 fe ff ff       	call   802b88 <fd2sockid>
+  802d42:	89 c3                	mov    %eax,%ebx
+  802d44:	85 c0                	test   %eax,%eax
+  802d46:	78 1c                	js     802d64 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802d48:	89 f0                	mov    %esi,%eax
+  802d4a:	e8 69 fe ff ff       	call   802bb8 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802d4f:	0b 45 10             	or     0x10(%ebp),%eax
+  802d52:	50                   	push   %eax
+  802d53:	ff 77 0c             	push   0xc(%edi)
+  802d56:	ff 77 08             	push   0x8(%edi)
+  802d59:	53                   	push   %ebx
+  802d5a:	e8 7c 04 00 00       	call   8031db <nsipc_sendmsg>
+  802d5f:	89 c3                	mov    %eax,%ebx
+  802d61:	83 c4 10             	add    $0x10,%esp
+}
+  802d64:	89 d8                	mov    %ebx,%eax
+  802d66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d69:	5b                   	pop    %ebx
+  802d6a:	5e                   	pop    %esi
+  802d6b:	5f                   	pop    %edi
+  802d6c:	5d                   	pop    %ebp
+  802d6d:	c3                   	ret
+
+00802d6e <recvmsg>:
+{
+  802d6e:	55                   	push   %ebp
+  802d6f:	89 e5                	mov    %esp,%ebp
+  802d71:	57                   	push   %edi
+  802d72:	56                   	push   %esi
+  802d73:	53                   	push   %ebx
+  802d74:	83 ec 0c             	sub    $0xc,%esp
+  802d77:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d7a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802d7d:	89 f8                	mov    %edi,%eax
+  802d7f:	e8 04 fe ff ff       	call   802b88 <fd2sockid>
+  802d84:	89 c3                	mov    %eax,%ebx
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	78 2a                	js     802db4 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802d8a:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802d91:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802d98:	89 f8                	mov    %edi,%eax
+  802d9a:	e8 19 fe ff ff       	call   802bb8 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802d9f:	0b 45 10             	or     0x10(%ebp),%eax
+  802da2:	50                   	push   %eax
+  802da3:	ff 76 0c             	push   0xc(%esi)
+  802da6:	ff 76 08             	push   0x8(%esi)
+  802da9:	53                   	push   %ebx
+  802daa:	e8 d6 07 00 00       	call   803585 <nsipc_recvmsg>
+  802daf:	89 c3                	mov    %eax,%ebx
+  802db1:	83 c4 10             	add    $0x10,%esp
+}
+  802db4:	89 d8                	mov    %ebx,%eax
+  802db6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db9:	5b                   	pop    %ebx
+  802dba:	5e                   	pop    %esi
+  802dbb:	5f                   	pop    %edi
+  802dbc:	5d                   	pop    %ebp
+  802dbd:	c3                   	ret
+
+00802dbe <sendfile>:
+{
+  802dbe:	55                   	push   %ebp
+  802dbf:	89 e5                	mov    %esp,%ebp
+  802dc1:	56                   	push   %esi
+  802dc2:	53                   	push   %ebx
+  802dc3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802dc6:	89 f0                	mov    %esi,%eax
+  802dc8:	e8 bb fd ff ff       	call   802b88 <fd2sockid>
+  802dcd:	89 c3                	mov    %eax,%ebx
+  802dcf:	85 c0                	test   %eax,%eax
+  802dd1:	78 1f                	js     802df2 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802dd3:	89 f0                	mov    %esi,%eax
+  802dd5:	e8 de fd ff ff       	call   802bb8 <sock_flags>
+  802dda:	83 ec 0c             	sub    $0xc,%esp
+  802ddd:	50                   	push   %eax
+  802dde:	ff 75 14             	push   0x14(%ebp)
+  802de1:	ff 75 10             	push   0x10(%ebp)
+  802de4:	ff 75 0c             	push   0xc(%ebp)
+  802de7:	53                   	push   %ebx
+  802de8:	e8 64 06 00 00       	call   803451 <nsipc_sendfile>
+  802ded:	89 c3                	mov    %eax,%ebx
+  802def:	83 c4 20             	add    $0x20,%esp
+}
+  802df2:	89 d8                	mov    %ebx,%eax
+  802df4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802df7:	5b                   	pop    %ebx
+  802df8:	5e                   	pop    %esi
+  802df9:	5d                   	pop    %ebp
+  802dfa:	c3                   	ret
+
+00802dfb <evctl>:
+{
+  802dfb:	55                   	push   %ebp
+  802dfc:	89 e5                	mov    %esp,%ebp
+  802dfe:	53                   	push   %ebx
+  802dff:	83 ec 04             	sub    $0x4,%esp
+  802e02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802e05:	89 d8                	mov    %ebx,%eax
+  802e07:	e8 7c fd ff ff       	call   802b88 <fd2sockid>
+  802e0c:	85 c0                	test   %eax,%eax
+  802e0e:	78 10                	js     802e20 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802e10:	83 ec 04             	sub    $0x4,%esp
+  802e13:	53                   	push   %ebx
+  802e14:	ff 75 0c             	push   0xc(%ebp)
+  802e17:	50                   	push   %eax
+  802e18:	e8 d2 0b 00 00       	call   8039ef <nsipc_evctl>
+  802e1d:	83 c4 10             	add    $0x10,%esp
+}
+  802e20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e23:	c9                   	leave
+  802e24:	c3                   	ret
+
+00802e25 <evwait>:
+{
+  802e25:	55                   	push   %ebp
+  802e26:	89 e5                	mov    %esp,%ebp
+  802e28:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802e2b:	ff 75 10             	push   0x10(%ebp)
+  802e2e:	ff 75 0c             	push   0xc(%ebp)
+  802e31:	ff 75 08             	push   0x8(%ebp)
+  802e34:	e8 e0 0b 00 00       	call   803a19 <nsipc_evwait>
+}
+  802e39:	c9                   	leave
+  802e3a:	c3                   	ret
+
+00802e3b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802e3b:	55                   	push   %ebp
+  802e3c:	89 e5                	mov    %esp,%ebp
+  802e3e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802e41:	ff 75 10             	push   0x10(%ebp)
+  802e44:	ff 75 0c             	push   0xc(%ebp)
+  802e47:	ff 75 08             	push   0x8(%ebp)
+  802e4a:	e8 31 0c 00 00       	call   803a80 <nsipc_socket>
+  802e4f:	83 c4 10             	add    $0x10,%esp
+  802e52:	85 c0                	test   %eax,%eax
+  802e54:	78 05                	js     802e5b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802e56:	e8 89 fd ff ff       	call   802be4 <alloc_sockfd>
+}
+  802e5b:	c9                   	leave
+  802e5c:	c3                   	ret
+
+00802e5d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	53                   	push   %ebx
+  802e61:	83 ec 04             	sub    $0x4,%esp
+  802e64:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802e66:	83 3d 04 7a 80 00 00 	cmpl   $0x0,0x807a04
+  802e6d:	74 26                	je     802e95 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802e6f:	6a 07                	push   $0x7
+  802e71:	68 00 90 80 00       	push   $0x809000
+  802e76:	53                   	push   %ebx
+  802e77:	ff 35 04 7a 80 00    	push   0x807a04
+  802e7d:	e8 02 f2 ff ff       	call   802084 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802e82:	83 c4 0c             	add    $0xc,%esp
+  802e85:	6a 00                	push   $0x0
+  802e87:	6a 00                	push   $0x0
+  802e89:	6a 00                	push   $0x0
+  802e8b:	e8 64 ef ff ff       	call   801df4 <ipc_recv>
+}
+  802e90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e93:	c9                   	leave
+  802e94:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e95:	83 ec 0c             	sub    $0xc,%esp
+  802e98:	6a 03                	push   $0x3
+  802e9a:	e8 4e f2 ff ff       	call   8020ed <ipc_find_env>
+  802e9f:	a3 04 7a 80 00       	mov    %eax,0x807a04
+  802ea4:	83 c4 10             	add    $0x10,%esp
+  802ea7:	eb c6                	jmp    802e6f <nsipc+0x12>
+
+00802ea9 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802ea9:	55                   	push   %ebp
+  802eaa:	89 e5                	mov    %esp,%ebp
+  802eac:	56                   	push   %esi
+  802ead:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802eae:	8b 35 10 7a 80 00    	mov    0x807a10,%esi
+		return 0;
+  802eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802eb9:	85 f6                	test   %esi,%esi
+  802ebb:	75 33                	jne    802ef0 <nsbulk_map+0x47>
+  802ebd:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802ec2:	83 ec 04             	sub    $0x4,%esp
+  802ec5:	6a 07                	push   $0x7
+  802ec7:	53                   	push   %ebx
+  802ec8:	6a 00                	push   $0x0
+  802eca:	e8 46 e3 ff ff       	call   801215 <sys_page_alloc>
+  802ecf:	83 c4 10             	add    $0x10,%esp
+  802ed2:	85 c0                	test   %eax,%eax
+  802ed4:	78 1a                	js     802ef0 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802ed6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802edc:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802ee2:	75 de                	jne    802ec2 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802ee4:	c7 05 10 7a 80 00 01 	movl   $0x1,0x807a10
+  802eeb:	00 00 00 
+	return 0;
+  802eee:	89 f0                	mov    %esi,%eax
+}
+  802ef0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ef3:	5b                   	pop    %ebx
+  802ef4:	5e                   	pop    %esi
+  802ef5:	5d                   	pop    %ebp
+  802ef6:	c3                   	ret
+
+00802ef7 <nsbulk_own>:
+{
+  802ef7:	55                   	push   %ebp
+  802ef8:	89 e5                	mov    %esp,%ebp
+  802efa:	57                   	push   %edi
+  802efb:	56                   	push   %esi
+  802efc:	53                   	push   %ebx
+  802efd:	83 ec 0c             	sub    $0xc,%esp
+  802f00:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802f02:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802f05:	85 d2                	test   %edx,%edx
+  802f07:	7f 0e                	jg     802f17 <nsbulk_own+0x20>
+	return 0;
+  802f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0e:	eb 47                	jmp    802f57 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802f10:	83 c3 01             	add    $0x1,%ebx
+  802f13:	39 fb                	cmp    %edi,%ebx
+  802f15:	7d 3b                	jge    802f52 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802f17:	be 01 00 00 00       	mov    $0x1,%esi
+  802f1c:	89 d9                	mov    %ebx,%ecx
+  802f1e:	d3 e6                	shl    %cl,%esi
+  802f20:	89 f0                	mov    %esi,%eax
+  802f22:	23 05 0c 7a 80 00    	and    0x807a0c,%eax
+  802f28:	74 e6                	je     802f10 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802f2a:	83 ec 04             	sub    $0x4,%esp
+  802f2d:	6a 07                	push   $0x7
+  802f2f:	89 d8                	mov    %ebx,%eax
+  802f31:	c1 e0 0c             	shl    $0xc,%eax
+  802f34:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f39:	50                   	push   %eax
+  802f3a:	6a 00                	push   $0x0
+  802f3c:	e8 d4 e2 ff ff       	call   801215 <sys_page_alloc>
+  802f41:	83 c4 10             	add    $0x10,%esp
+  802f44:	85 c0                	test   %eax,%eax
+  802f46:	78 0f                	js     802f57 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802f48:	f7 d6                	not    %esi
+  802f4a:	21 35 0c 7a 80 00    	and    %esi,0x807a0c
+  802f50:	eb be                	jmp    802f10 <nsbulk_own+0x19>
+	return 0;
+  802f52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5a:	5b                   	pop    %ebx
+  802f5b:	5e                   	pop    %esi
+  802f5c:	5f                   	pop    %edi
+  802f5d:	5d                   	pop    %ebp
+  802f5e:	c3                   	ret
+
+00802f5f <nsipc_bulk>:
+{
+  802f5f:	55                   	push   %ebp
+  802f60:	89 e5                	mov    %esp,%ebp
+  802f62:	57                   	push   %edi
+  802f63:	56                   	push   %esi
+  802f64:	53                   	push   %ebx
+  802f65:	83 ec 1c             	sub    $0x1c,%esp
+  802f68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f6b:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802f6d:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802f73:	c1 fb 0c             	sar    $0xc,%ebx
+  802f76:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802f79:	83 3d 04 7a 80 00 00 	cmpl   $0x0,0x807a04
+  802f80:	74 56                	je     802fd8 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802f82:	85 ff                	test   %edi,%edi
+  802f84:	7e 24                	jle    802faa <nsipc_bulk+0x4b>
+  802f86:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802f8c:	74 1c                	je     802faa <nsipc_bulk+0x4b>
+  802f8e:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802f94:	c1 e3 0c             	shl    $0xc,%ebx
+  802f97:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802f9c:	0f b6 10             	movzbl (%eax),%edx
+  802f9f:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802fa1:	05 00 10 00 00       	add    $0x1000,%eax
+  802fa6:	39 d8                	cmp    %ebx,%eax
+  802fa8:	75 f2                	jne    802f9c <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802faa:	83 ec 0c             	sub    $0xc,%esp
+  802fad:	56                   	push   %esi
+  802fae:	57                   	push   %edi
+  802faf:	68 00 00 00 e0       	push   $0xe0000000
+  802fb4:	ff 75 e4             	push   -0x1c(%ebp)
+  802fb7:	ff 35 04 7a 80 00    	push   0x807a04
+  802fbd:	e8 f6 f0 ff ff       	call   8020b8 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802fc2:	83 c4 1c             	add    $0x1c,%esp
+  802fc5:	6a 00                	push   $0x0
+  802fc7:	6a 00                	push   $0x0
+  802fc9:	6a 00                	push   $0x0
+  802fcb:	e8 24 ee ff ff       	call   801df4 <ipc_recv>
+}
+  802fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd3:	5b                   	pop    %ebx
+  802fd4:	5e                   	pop    %esi
+  802fd5:	5f                   	pop    %edi
+  802fd6:	5d                   	pop    %ebp
+  802fd7:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802fd8:	83 ec 0c             	sub    $0xc,%esp
+  802fdb:	6a 03                	push   $0x3
+  802fdd:	e8 0b f1 ff ff       	call   8020ed <ipc_find_env>
+  802fe2:	a3 04 7a 80 00       	mov    %eax,0x807a04
+  802fe7:	83 c4 10             	add    $0x10,%esp
+  802fea:	eb 96                	jmp    802f82 <nsipc_bulk+0x23>
+
+00802fec <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802fec:	55                   	push   %ebp
+  802fed:	89 e5                	mov    %esp,%ebp
+  802fef:	53                   	push   %ebx
+  802ff0:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ff3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff6:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_flags = flags;
+  802ffb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ffe:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803003:	b8 01 00 00 00       	mov    $0x1,%eax
+  803008:	e8 50 fe ff ff       	call   802e5d <nsipc>
+  80300d:	89 c3                	mov    %eax,%ebx
+  80300f:	85 c0                	test   %eax,%eax
+  803011:	79 07                	jns    80301a <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803013:	89 d8                	mov    %ebx,%eax
+  803015:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803018:	c9                   	leave
+  803019:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80301a:	83 ec 04             	sub    $0x4,%esp
+  80301d:	ff 35 10 90 80 00    	push   0x809010
+  803023:	68 00 90 80 00       	push   $0x809000
+  803028:	ff 75 0c             	push   0xc(%ebp)
+  80302b:	e8 61 df ff ff       	call   800f91 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803030:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  803036:	8b 45 10             	mov    0x10(%ebp),%eax
+  803039:	89 10                	mov    %edx,(%eax)
+  80303b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80303e:	eb d3                	jmp    803013 <nsipc_accept+0x27>
+
+00803040 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803040:	55                   	push   %ebp
+  803041:	89 e5                	mov    %esp,%ebp
+  803043:	53                   	push   %ebx
+  803044:	83 ec 08             	sub    $0x8,%esp
+  803047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80304a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80304d:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803052:	53                   	push   %ebx
+  803053:	ff 75 0c             	push   0xc(%ebp)
+  803056:	68 04 90 80 00       	push   $0x809004
+  80305b:	e8 31 df ff ff       	call   800f91 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803060:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803066:	b8 02 00 00 00       	mov    $0x2,%eax
+  80306b:	e8 ed fd ff ff       	call   802e5d <nsipc>
+}
+  803070:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803073:	c9                   	leave
+  803074:	c3                   	ret
+
+00803075 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803075:	55                   	push   %ebp
+  803076:	89 e5                	mov    %esp,%ebp
+  803078:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80307b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803083:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803086:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  80308b:	b8 03 00 00 00       	mov    $0x3,%eax
+  803090:	e8 c8 fd ff ff       	call   802e5d <nsipc>
+}
+  803095:	c9                   	leave
+  803096:	c3                   	ret
+
+00803097 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803097:	55                   	push   %ebp
+  803098:	89 e5                	mov    %esp,%ebp
+  80309a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80309d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a0:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  8030a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8030aa:	e8 ae fd ff ff       	call   802e5d <nsipc>
+}
+  8030af:	c9                   	leave
+  8030b0:	c3                   	ret
+
+008030b1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8030b1:	55                   	push   %ebp
+  8030b2:	89 e5                	mov    %esp,%ebp
+  8030b4:	53                   	push   %ebx
+  8030b5:	83 ec 08             	sub    $0x8,%esp
+  8030b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8030bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030be:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8030c3:	53                   	push   %ebx
+  8030c4:	ff 75 0c             	push   0xc(%ebp)
+  8030c7:	68 04 90 80 00       	push   $0x809004
+  8030cc:	e8 c0 de ff ff       	call   800f91 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8030d1:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8030d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8030dc:	e8 7c fd ff ff       	call   802e5d <nsipc>
+}
+  8030e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030e4:	c9                   	leave
+  8030e5:	c3                   	ret
+
+008030e6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8030e6:	55                   	push   %ebp
+  8030e7:	89 e5                	mov    %esp,%ebp
+  8030e9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8030ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ef:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8030f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030f7:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8030fc:	b8 06 00 00 00       	mov    $0x6,%eax
+  803101:	e8 57 fd ff ff       	call   802e5d <nsipc>
+}
+  803106:	c9                   	leave
+  803107:	c3                   	ret
+
+00803108 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803108:	55                   	push   %ebp
+  803109:	89 e5                	mov    %esp,%ebp
+  80310b:	56                   	push   %esi
+  80310c:	53                   	push   %ebx
+  80310d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803110:	8b 45 08             	mov    0x8(%ebp),%eax
+  803113:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803118:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  80311e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803121:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803126:	b8 07 00 00 00       	mov    $0x7,%eax
+  80312b:	e8 2d fd ff ff       	call   802e5d <nsipc>
+  803130:	89 c3                	mov    %eax,%ebx
+  803132:	85 c0                	test   %eax,%eax
+  803134:	78 22                	js     803158 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803136:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80313b:	39 c6                	cmp    %eax,%esi
+  80313d:	0f 4e c6             	cmovle %esi,%eax
+  803140:	39 c3                	cmp    %eax,%ebx
+  803142:	7f 1d                	jg     803161 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803144:	83 ec 04             	sub    $0x4,%esp
+  803147:	53                   	push   %ebx
+  803148:	68 00 90 80 00       	push   $0x809000
+  80314d:	ff 75 0c             	push   0xc(%ebp)
+  803150:	e8 3c de ff ff       	call   800f91 <memmove>
+  803155:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803158:	89 d8                	mov    %ebx,%eax
+  80315a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80315d:	5b                   	pop    %ebx
+  80315e:	5e                   	pop    %esi
+  80315f:	5d                   	pop    %ebp
+  803160:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803161:	68 e4 52 80 00       	push   $0x8052e4
+  803166:	68 f9 52 80 00       	push   $0x8052f9
+  80316b:	68 b2 00 00 00       	push   $0xb2
+  803170:	68 0e 53 80 00       	push   $0x80530e
+  803175:	e8 95 d4 ff ff       	call   80060f <_panic>
+
+0080317a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80317a:	55                   	push   %ebp
+  80317b:	89 e5                	mov    %esp,%ebp
+  80317d:	53                   	push   %ebx
+  80317e:	83 ec 04             	sub    $0x4,%esp
+  803181:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803184:	8b 45 08             	mov    0x8(%ebp),%eax
+  803187:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80318c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803192:	7f 2e                	jg     8031c2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803194:	83 ec 04             	sub    $0x4,%esp
+  803197:	53                   	push   %ebx
+  803198:	ff 75 0c             	push   0xc(%ebp)
+  80319b:	68 0c 90 80 00       	push   $0x80900c
+  8031a0:	e8 ec dd ff ff       	call   800f91 <memmove>
+	nsipcbuf.send.req_size = size;
+  8031a5:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  8031ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031ae:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  8031b3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8031b8:	e8 a0 fc ff ff       	call   802e5d <nsipc>
+}
+  8031bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031c0:	c9                   	leave
+  8031c1:	c3                   	ret
+	assert(size < 1600);
+  8031c2:	68 1a 53 80 00       	push   $0x80531a
+  8031c7:	68 f9 52 80 00       	push   $0x8052f9
+  8031cc:	68 bd 00 00 00       	push   $0xbd
+  8031d1:	68 0e 53 80 00       	push   $0x80530e
+  8031d6:	e8 34 d4 ff ff       	call   80060f <_panic>
+
+008031db <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8031db:	55                   	push   %ebp
+  8031dc:	89 e5                	mov    %esp,%ebp
+  8031de:	57                   	push   %edi
+  8031df:	56                   	push   %esi
+  8031e0:	53                   	push   %ebx
+  8031e1:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8031e4:	e8 c0 fc ff ff       	call   802ea9 <nsbulk_map>
+  8031e9:	85 c0                	test   %eax,%eax
+  8031eb:	78 55                	js     803242 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8031ed:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8031f4:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8031fb:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803202:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803205:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803208:	0f 8d 24 02 00 00    	jge    803432 <nsipc_sendmsg+0x257>
+  80320e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803211:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803214:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  803217:	89 d8                	mov    %ebx,%eax
+  803219:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80321e:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  803220:	83 ec 0c             	sub    $0xc,%esp
+  803223:	68 00 77 80 00       	push   $0x807700
+  803228:	e8 5a 0f 00 00       	call   804187 <pgbatch_init>
+  80322d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803230:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  803232:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  803235:	e9 82 00 00 00       	jmp    8032bc <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80323a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80323d:	85 db                	test   %ebx,%ebx
+  80323f:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  803242:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803245:	5b                   	pop    %ebx
+  803246:	5e                   	pop    %esi
+  803247:	5f                   	pop    %edi
+  803248:	5d                   	pop    %ebp
+  803249:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80324a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80324f:	29 c8                	sub    %ecx,%eax
+  803251:	39 d0                	cmp    %edx,%eax
+  803253:	0f 46 d0             	cmovbe %eax,%edx
+  803256:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  803258:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80325e:	85 ff                	test   %edi,%edi
+  803260:	0f 49 c7             	cmovns %edi,%eax
+  803263:	c1 f8 0c             	sar    $0xc,%eax
+  803266:	ba 01 00 00 00       	mov    $0x1,%edx
+  80326b:	e8 87 fc ff ff       	call   802ef7 <nsbulk_own>
+  803270:	85 c0                	test   %eax,%eax
+  803272:	0f 88 17 01 00 00    	js     80338f <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  803278:	83 ec 04             	sub    $0x4,%esp
+  80327b:	56                   	push   %esi
+  80327c:	ff 75 e0             	push   -0x20(%ebp)
+  80327f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803282:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803287:	50                   	push   %eax
+  803288:	e8 04 dd ff ff       	call   800f91 <memmove>
+  80328d:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  803290:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  803293:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803296:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803299:	0f 84 fd 00 00 00    	je     80339c <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80329f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8032a2:	01 f7                	add    %esi,%edi
+  8032a4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8032a7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8032aa:	0f 8d 01 01 00 00    	jge    8033b1 <nsipc_sendmsg+0x1d6>
+  8032b0:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8032b6:	0f 8f f0 00 00 00    	jg     8033ac <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8032bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032bf:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8032c2:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8032c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032c8:	89 c2                	mov    %eax,%edx
+  8032ca:	03 13                	add    (%ebx),%edx
+  8032cc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8032cf:	8b 73 04             	mov    0x4(%ebx),%esi
+  8032d2:	29 c6                	sub    %eax,%esi
+  8032d4:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8032d9:	29 f9                	sub    %edi,%ecx
+  8032db:	39 ce                	cmp    %ecx,%esi
+  8032dd:	89 ca                	mov    %ecx,%edx
+  8032df:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8032e2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8032e5:	89 f9                	mov    %edi,%ecx
+  8032e7:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8032ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8032f0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8032f5:	09 c8                	or     %ecx,%eax
+  8032f7:	0f 85 4d ff ff ff    	jne    80324a <nsipc_sendmsg+0x6f>
+  8032fd:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  803303:	0f 86 41 ff ff ff    	jbe    80324a <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803309:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80330f:	85 ff                	test   %edi,%edi
+  803311:	0f 49 c7             	cmovns %edi,%eax
+  803314:	c1 f8 0c             	sar    $0xc,%eax
+  803317:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  803319:	89 d1                	mov    %edx,%ecx
+  80331b:	c1 e9 0c             	shr    $0xc,%ecx
+  80331e:	01 c8                	add    %ecx,%eax
+  803320:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803323:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803326:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  803328:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80332b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803330:	29 c8                	sub    %ecx,%eax
+  803332:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803335:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  803338:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80333a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80333f:	89 f9                	mov    %edi,%ecx
+  803341:	d3 e0                	shl    %cl,%eax
+  803343:	09 05 0c 7a 80 00    	or     %eax,0x807a0c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803349:	83 ec 08             	sub    $0x8,%esp
+  80334c:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80334e:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803351:	50                   	push   %eax
+  803352:	6a 00                	push   $0x0
+  803354:	56                   	push   %esi
+  803355:	6a 00                	push   $0x0
+  803357:	68 00 77 80 00       	push   $0x807700
+  80335c:	e8 e4 0e 00 00       	call   804245 <pgbatch_map>
+  803361:	83 c4 20             	add    $0x20,%esp
+  803364:	85 c0                	test   %eax,%eax
+  803366:	0f 88 ce fe ff ff    	js     80323a <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80336c:	83 c7 01             	add    $0x1,%edi
+  80336f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803375:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803378:	39 c7                	cmp    %eax,%edi
+  80337a:	75 be                	jne    80333a <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80337c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80337f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803382:	89 d6                	mov    %edx,%esi
+  803384:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80338a:	e9 01 ff ff ff       	jmp    803290 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80338f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803392:	85 db                	test   %ebx,%ebx
+  803394:	0f 45 c3             	cmovne %ebx,%eax
+  803397:	e9 a6 fe ff ff       	jmp    803242 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80339c:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8033a0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8033a7:	e9 f3 fe ff ff       	jmp    80329f <nsipc_sendmsg+0xc4>
+  8033ac:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8033af:	eb 03                	jmp    8033b4 <nsipc_sendmsg+0x1d9>
+  8033b1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8033b4:	83 ec 0c             	sub    $0xc,%esp
+  8033b7:	68 00 77 80 00       	push   $0x807700
+  8033bc:	e8 d4 0d 00 00       	call   804195 <pgbatch_flush>
+  8033c1:	83 c4 10             	add    $0x10,%esp
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	78 50                	js     803418 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8033c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033cb:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8033d0:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8033d6:	89 fb                	mov    %edi,%ebx
+  8033d8:	29 f3                	sub    %esi,%ebx
+  8033da:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8033e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033e3:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8033e8:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8033ed:	89 fa                	mov    %edi,%edx
+  8033ef:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8033f4:	e8 66 fb ff ff       	call   802f5f <nsipc_bulk>
+  8033f9:	85 c0                	test   %eax,%eax
+  8033fb:	78 28                	js     803425 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8033fd:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  803400:	39 c3                	cmp    %eax,%ebx
+  803402:	75 0c                	jne    803410 <nsipc_sendmsg+0x235>
+  803404:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803407:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80340a:	0f 8f f2 fd ff ff    	jg     803202 <nsipc_sendmsg+0x27>
+		sent += r;
+  803410:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803413:	e9 2a fe ff ff       	jmp    803242 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803418:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80341b:	85 db                	test   %ebx,%ebx
+  80341d:	0f 45 c3             	cmovne %ebx,%eax
+  803420:	e9 1d fe ff ff       	jmp    803242 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803425:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803428:	85 db                	test   %ebx,%ebx
+  80342a:	0f 45 c3             	cmovne %ebx,%eax
+  80342d:	e9 10 fe ff ff       	jmp    803242 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803432:	83 ec 0c             	sub    $0xc,%esp
+  803435:	68 00 77 80 00       	push   $0x807700
+  80343a:	e8 48 0d 00 00       	call   804187 <pgbatch_init>
+  80343f:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803442:	be 00 00 00 00       	mov    $0x0,%esi
+  803447:	bf 00 00 00 00       	mov    $0x0,%edi
+  80344c:	e9 63 ff ff ff       	jmp    8033b4 <nsipc_sendmsg+0x1d9>
+
+00803451 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803451:	55                   	push   %ebp
+  803452:	89 e5                	mov    %esp,%ebp
+  803454:	57                   	push   %edi
+  803455:	56                   	push   %esi
+  803456:	53                   	push   %ebx
+  803457:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80345a:	83 3d 08 7a 80 00 00 	cmpl   $0x0,0x807a08
+  803461:	0f 84 c8 00 00 00    	je     80352f <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803467:	83 3d 04 7a 80 00 00 	cmpl   $0x0,0x807a04
+  80346e:	0f 84 e4 00 00 00    	je     803558 <nsipc_sendfile+0x107>
+{
+  803474:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  803479:	89 fb                	mov    %edi,%ebx
+  80347b:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80347e:	0f 83 f0 00 00 00    	jae    803574 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803484:	89 fa                	mov    %edi,%edx
+  803486:	03 55 10             	add    0x10(%ebp),%edx
+  803489:	89 d0                	mov    %edx,%eax
+  80348b:	c1 f8 1f             	sar    $0x1f,%eax
+  80348e:	c1 e8 14             	shr    $0x14,%eax
+  803491:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803494:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80349a:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80349c:	6a 10                	push   $0x10
+  80349e:	68 00 20 01 e0       	push   $0xe0012000
+  8034a3:	52                   	push   %edx
+  8034a4:	ff 75 0c             	push   0xc(%ebp)
+  8034a7:	e8 fe f4 ff ff       	call   8029aa <fmap>
+  8034ac:	83 c4 10             	add    $0x10,%esp
+  8034af:	85 c0                	test   %eax,%eax
+  8034b1:	0f 8e b8 00 00 00    	jle    80356f <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8034b7:	39 c6                	cmp    %eax,%esi
+  8034b9:	0f 8d b5 00 00 00    	jge    803574 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8034bf:	29 f0                	sub    %esi,%eax
+  8034c1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034c4:	29 da                	sub    %ebx,%edx
+  8034c6:	39 d0                	cmp    %edx,%eax
+  8034c8:	89 d3                	mov    %edx,%ebx
+  8034ca:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8034cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034d0:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8034d5:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8034db:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8034e1:	8b 45 18             	mov    0x18(%ebp),%eax
+  8034e4:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8034e9:	83 ec 0c             	sub    $0xc,%esp
+  8034ec:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8034ee:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8034f5:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8034f8:	83 c0 01             	add    $0x1,%eax
+  8034fb:	50                   	push   %eax
+  8034fc:	68 00 10 01 e0       	push   $0xe0011000
+  803501:	6a 11                	push   $0x11
+  803503:	ff 35 04 7a 80 00    	push   0x807a04
+  803509:	e8 aa eb ff ff       	call   8020b8 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80350e:	83 c4 1c             	add    $0x1c,%esp
+  803511:	6a 00                	push   $0x0
+  803513:	6a 00                	push   $0x0
+  803515:	6a 00                	push   $0x0
+  803517:	e8 d8 e8 ff ff       	call   801df4 <ipc_recv>
+  80351c:	83 c4 10             	add    $0x10,%esp
+  80351f:	85 c0                	test   %eax,%eax
+  803521:	78 5b                	js     80357e <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803523:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803525:	39 c3                	cmp    %eax,%ebx
+  803527:	0f 8e 4c ff ff ff    	jle    803479 <nsipc_sendfile+0x28>
+  80352d:	eb 45                	jmp    803574 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80352f:	83 ec 04             	sub    $0x4,%esp
+  803532:	6a 07                	push   $0x7
+  803534:	68 00 10 01 e0       	push   $0xe0011000
+  803539:	6a 00                	push   $0x0
+  80353b:	e8 d5 dc ff ff       	call   801215 <sys_page_alloc>
+  803540:	89 c7                	mov    %eax,%edi
+  803542:	83 c4 10             	add    $0x10,%esp
+  803545:	85 c0                	test   %eax,%eax
+  803547:	78 2b                	js     803574 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803549:	c7 05 08 7a 80 00 01 	movl   $0x1,0x807a08
+  803550:	00 00 00 
+  803553:	e9 0f ff ff ff       	jmp    803467 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803558:	83 ec 0c             	sub    $0xc,%esp
+  80355b:	6a 03                	push   $0x3
+  80355d:	e8 8b eb ff ff       	call   8020ed <ipc_find_env>
+  803562:	a3 04 7a 80 00       	mov    %eax,0x807a04
+  803567:	83 c4 10             	add    $0x10,%esp
+  80356a:	e9 05 ff ff ff       	jmp    803474 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80356f:	85 ff                	test   %edi,%edi
+  803571:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803574:	89 f8                	mov    %edi,%eax
+  803576:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803579:	5b                   	pop    %ebx
+  80357a:	5e                   	pop    %esi
+  80357b:	5f                   	pop    %edi
+  80357c:	5d                   	pop    %ebp
+  80357d:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80357e:	85 ff                	test   %edi,%edi
+  803580:	0f 44 f8             	cmove  %eax,%edi
+  803583:	eb ef                	jmp    803574 <nsipc_sendfile+0x123>
+
+00803585 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803585:	55                   	push   %ebp
+  803586:	89 e5                	mov    %esp,%ebp
+  803588:	57                   	push   %edi
+  803589:	56                   	push   %esi
+  80358a:	53                   	push   %ebx
+  80358b:	83 ec 1c             	sub    $0x1c,%esp
+  80358e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803591:	e8 13 f9 ff ff       	call   802ea9 <nsbulk_map>
+  803596:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803599:	85 c0                	test   %eax,%eax
+  80359b:	0f 88 ba 00 00 00    	js     80365b <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8035a1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035a5:	0f 8e bb 00 00 00    	jle    803666 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8035ab:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8035b0:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8035b5:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8035ba:	89 f8                	mov    %edi,%eax
+  8035bc:	29 f0                	sub    %esi,%eax
+  8035be:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8035c2:	39 c8                	cmp    %ecx,%eax
+  8035c4:	0f 47 c1             	cmova  %ecx,%eax
+  8035c7:	01 f0                	add    %esi,%eax
+  8035c9:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8035cb:	83 c2 01             	add    $0x1,%edx
+  8035ce:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8035d1:	7e 07                	jle    8035da <nsipc_recvmsg+0x55>
+  8035d3:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8035d8:	7e e0                	jle    8035ba <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8035da:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8035e0:	c1 fa 0c             	sar    $0xc,%edx
+  8035e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e8:	e8 0a f9 ff ff       	call   802ef7 <nsbulk_own>
+  8035ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8035f0:	85 c0                	test   %eax,%eax
+  8035f2:	78 67                	js     80365b <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8035f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035f7:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8035fc:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803602:	8b 45 14             	mov    0x14(%ebp),%eax
+  803605:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80360a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80360f:	89 f2                	mov    %esi,%edx
+  803611:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803616:	e8 44 f9 ff ff       	call   802f5f <nsipc_bulk>
+  80361b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80361e:	85 c0                	test   %eax,%eax
+  803620:	78 39                	js     80365b <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803622:	39 f0                	cmp    %esi,%eax
+  803624:	7f 4a                	jg     803670 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803626:	bf 00 00 00 00       	mov    $0x0,%edi
+  80362b:	85 c0                	test   %eax,%eax
+  80362d:	7e 2c                	jle    80365b <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80362f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803632:	29 fe                	sub    %edi,%esi
+  803634:	8b 43 04             	mov    0x4(%ebx),%eax
+  803637:	39 c6                	cmp    %eax,%esi
+  803639:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80363c:	83 ec 04             	sub    $0x4,%esp
+  80363f:	56                   	push   %esi
+  803640:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803646:	50                   	push   %eax
+  803647:	ff 33                	push   (%ebx)
+  803649:	e8 43 d9 ff ff       	call   800f91 <memmove>
+		n += m;
+  80364e:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803650:	83 c3 08             	add    $0x8,%ebx
+  803653:	83 c4 10             	add    $0x10,%esp
+  803656:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803659:	7f d4                	jg     80362f <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80365b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80365e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803661:	5b                   	pop    %ebx
+  803662:	5e                   	pop    %esi
+  803663:	5f                   	pop    %edi
+  803664:	5d                   	pop    %ebp
+  803665:	c3                   	ret
+	int r, i, n, len = 0;
+  803666:	be 00 00 00 00       	mov    $0x0,%esi
+  80366b:	e9 6a ff ff ff       	jmp    8035da <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803670:	68 f0 52 80 00       	push   $0x8052f0
+  803675:	68 f9 52 80 00       	push   $0x8052f9
+  80367a:	68 3b 01 00 00       	push   $0x13b
+  80367f:	68 0e 53 80 00       	push   $0x80530e
+  803684:	e8 86 cf ff ff       	call   80060f <_panic>
+
+00803689 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803689:	55                   	push   %ebp
+  80368a:	89 e5                	mov    %esp,%ebp
+  80368c:	57                   	push   %edi
+  80368d:	56                   	push   %esi
+  80368e:	53                   	push   %ebx
+  80368f:	83 ec 0c             	sub    $0xc,%esp
+  803692:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803695:	8b 75 10             	mov    0x10(%ebp),%esi
+  803698:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80369b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80369e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.select.req_readset = *readset;
+  8036a3:	8b 07                	mov    (%edi),%eax
+  8036a5:	a3 04 90 80 00       	mov    %eax,0x809004
+  8036aa:	8b 47 04             	mov    0x4(%edi),%eax
+  8036ad:	a3 08 90 80 00       	mov    %eax,0x809008
+  8036b2:	8b 47 08             	mov    0x8(%edi),%eax
+  8036b5:	a3 0c 90 80 00       	mov    %eax,0x80900c
+  8036ba:	8b 47 0c             	mov    0xc(%edi),%eax
+  8036bd:	a3 10 90 80 00       	mov    %eax,0x809010
+  8036c2:	8b 47 10             	mov    0x10(%edi),%eax
+  8036c5:	a3 14 90 80 00       	mov    %eax,0x809014
+  8036ca:	8b 47 14             	mov    0x14(%edi),%eax
+  8036cd:	a3 18 90 80 00       	mov    %eax,0x809018
+  8036d2:	8b 47 18             	mov    0x18(%edi),%eax
+  8036d5:	a3 1c 90 80 00       	mov    %eax,0x80901c
+  8036da:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8036dd:	a3 20 90 80 00       	mov    %eax,0x809020
+  8036e2:	8b 47 20             	mov    0x20(%edi),%eax
+  8036e5:	a3 24 90 80 00       	mov    %eax,0x809024
+  8036ea:	8b 47 24             	mov    0x24(%edi),%eax
+  8036ed:	a3 28 90 80 00       	mov    %eax,0x809028
+  8036f2:	8b 47 28             	mov    0x28(%edi),%eax
+  8036f5:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  8036fa:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8036fd:	a3 30 90 80 00       	mov    %eax,0x809030
+  803702:	8b 47 30             	mov    0x30(%edi),%eax
+  803705:	a3 34 90 80 00       	mov    %eax,0x809034
+  80370a:	8b 47 34             	mov    0x34(%edi),%eax
+  80370d:	a3 38 90 80 00       	mov    %eax,0x809038
+  803712:	8b 47 38             	mov    0x38(%edi),%eax
+  803715:	a3 3c 90 80 00       	mov    %eax,0x80903c
+  80371a:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80371d:	a3 40 90 80 00       	mov    %eax,0x809040
+	nsipcbuf.select.req_writeset = *writeset;
+  803722:	8b 06                	mov    (%esi),%eax
+  803724:	a3 44 90 80 00       	mov    %eax,0x809044
+  803729:	8b 46 04             	mov    0x4(%esi),%eax
+  80372c:	a3 48 90 80 00       	mov    %eax,0x809048
+  803731:	8b 46 08             	mov    0x8(%esi),%eax
+  803734:	a3 4c 90 80 00       	mov    %eax,0x80904c
+  803739:	8b 46 0c             	mov    0xc(%esi),%eax
+  80373c:	a3 50 90 80 00       	mov    %eax,0x809050
+  803741:	8b 46 10             	mov    0x10(%esi),%eax
+  803744:	a3 54 90 80 00       	mov    %eax,0x809054
+  803749:	8b 46 14             	mov    0x14(%esi),%eax
+  80374c:	a3 58 90 80 00       	mov    %eax,0x809058
+  803751:	8b 46 18             	mov    0x18(%esi),%eax
+  803754:	a3 5c 90 80 00       	mov    %eax,0x80905c
+  803759:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80375c:	a3 60 90 80 00       	mov    %eax,0x809060
+  803761:	8b 46 20             	mov    0x20(%esi),%eax
+  803764:	a3 64 90 80 00       	mov    %eax,0x809064
+  803769:	8b 46 24             	mov    0x24(%esi),%eax
+  80376c:	a3 68 90 80 00       	mov    %eax,0x809068
+  803771:	8b 46 28             	mov    0x28(%esi),%eax
+  803774:	a3 6c 90 80 00       	mov    %eax,0x80906c
+  803779:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80377c:	a3 70 90 80 00       	mov    %eax,0x809070
+  803781:	8b 46 30             	mov    0x30(%esi),%eax
+  803784:	a3 74 90 80 00       	mov    %eax,0x809074
+  803789:	8b 46 34             	mov    0x34(%esi),%eax
+  80378c:	a3 78 90 80 00       	mov    %eax,0x809078
+  803791:	8b 46 38             	mov    0x38(%esi),%eax
+  803794:	a3 7c 90 80 00       	mov    %eax,0x80907c
+  803799:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80379c:	a3 80 90 80 00       	mov    %eax,0x809080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8037a1:	8b 03                	mov    (%ebx),%eax
+  8037a3:	a3 84 90 80 00       	mov    %eax,0x809084
+  8037a8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8037ab:	a3 88 90 80 00       	mov    %eax,0x809088
+  8037b0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8037b3:	a3 8c 90 80 00       	mov    %eax,0x80908c
+  8037b8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8037bb:	a3 90 90 80 00       	mov    %eax,0x809090
+  8037c0:	8b 43 10             	mov    0x10(%ebx),%eax
+  8037c3:	a3 94 90 80 00       	mov    %eax,0x809094
+  8037c8:	8b 43 14             	mov    0x14(%ebx),%eax
+  8037cb:	a3 98 90 80 00       	mov    %eax,0x809098
+  8037d0:	8b 43 18             	mov    0x18(%ebx),%eax
+  8037d3:	a3 9c 90 80 00       	mov    %eax,0x80909c
+  8037d8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8037db:	a3 a0 90 80 00       	mov    %eax,0x8090a0
+  8037e0:	8b 43 20             	mov    0x20(%ebx),%eax
+  8037e3:	a3 a4 90 80 00       	mov    %eax,0x8090a4
+  8037e8:	8b 43 24             	mov    0x24(%ebx),%eax
+  8037eb:	a3 a8 90 80 00       	mov    %eax,0x8090a8
+  8037f0:	8b 43 28             	mov    0x28(%ebx),%eax
+  8037f3:	a3 ac 90 80 00       	mov    %eax,0x8090ac
+  8037f8:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8037fb:	a3 b0 90 80 00       	mov    %eax,0x8090b0
+  803800:	8b 43 30             	mov    0x30(%ebx),%eax
+  803803:	a3 b4 90 80 00       	mov    %eax,0x8090b4
+  803808:	8b 43 34             	mov    0x34(%ebx),%eax
+  80380b:	a3 b8 90 80 00       	mov    %eax,0x8090b8
+  803810:	8b 43 38             	mov    0x38(%ebx),%eax
+  803813:	a3 bc 90 80 00       	mov    %eax,0x8090bc
+  803818:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80381b:	a3 c0 90 80 00       	mov    %eax,0x8090c0
+	nsipcbuf.select.req_timeout = msec;
+  803820:	8b 45 18             	mov    0x18(%ebp),%eax
+  803823:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803828:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80382d:	e8 2b f6 ff ff       	call   802e5d <nsipc>
+  803832:	85 c0                	test   %eax,%eax
+  803834:	0f 88 ad 01 00 00    	js     8039e7 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80383a:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  803840:	89 17                	mov    %edx,(%edi)
+  803842:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  803848:	89 57 04             	mov    %edx,0x4(%edi)
+  80384b:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  803851:	89 57 08             	mov    %edx,0x8(%edi)
+  803854:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  80385a:	89 57 0c             	mov    %edx,0xc(%edi)
+  80385d:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  803863:	89 57 10             	mov    %edx,0x10(%edi)
+  803866:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  80386c:	89 57 14             	mov    %edx,0x14(%edi)
+  80386f:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  803875:	89 57 18             	mov    %edx,0x18(%edi)
+  803878:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  80387e:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803881:	8b 15 24 90 80 00    	mov    0x809024,%edx
+  803887:	89 57 20             	mov    %edx,0x20(%edi)
+  80388a:	8b 15 28 90 80 00    	mov    0x809028,%edx
+  803890:	89 57 24             	mov    %edx,0x24(%edi)
+  803893:	8b 15 2c 90 80 00    	mov    0x80902c,%edx
+  803899:	89 57 28             	mov    %edx,0x28(%edi)
+  80389c:	8b 15 30 90 80 00    	mov    0x809030,%edx
+  8038a2:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8038a5:	8b 15 34 90 80 00    	mov    0x809034,%edx
+  8038ab:	89 57 30             	mov    %edx,0x30(%edi)
+  8038ae:	8b 15 38 90 80 00    	mov    0x809038,%edx
+  8038b4:	89 57 34             	mov    %edx,0x34(%edi)
+  8038b7:	8b 15 3c 90 80 00    	mov    0x80903c,%edx
+  8038bd:	89 57 38             	mov    %edx,0x38(%edi)
+  8038c0:	8b 15 40 90 80 00    	mov    0x809040,%edx
+  8038c6:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8038c9:	8b 15 44 90 80 00    	mov    0x809044,%edx
+  8038cf:	89 16                	mov    %edx,(%esi)
+  8038d1:	8b 15 48 90 80 00    	mov    0x809048,%edx
+  8038d7:	89 56 04             	mov    %edx,0x4(%esi)
+  8038da:	8b 15 4c 90 80 00    	mov    0x80904c,%edx
+  8038e0:	89 56 08             	mov    %edx,0x8(%esi)
+  8038e3:	8b 15 50 90 80 00    	mov    0x809050,%edx
+  8038e9:	89 56 0c             	mov    %edx,0xc(%esi)
+  8038ec:	8b 15 54 90 80 00    	mov    0x809054,%edx
+  8038f2:	89 56 10             	mov    %edx,0x10(%esi)
+  8038f5:	8b 15 58 90 80 00    	mov    0x809058,%edx
+  8038fb:	89 56 14             	mov    %edx,0x14(%esi)
+  8038fe:	8b 15 5c 90 80 00    	mov    0x80905c,%edx
+  803904:	89 56 18             	mov    %edx,0x18(%esi)
+  803907:	8b 15 60 90 80 00    	mov    0x809060,%edx
+  80390d:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803910:	8b 15 64 90 80 00    	mov    0x809064,%edx
+  803916:	89 56 20             	mov    %edx,0x20(%esi)
+  803919:	8b 15 68 90 80 00    	mov    0x809068,%edx
+  80391f:	89 56 24             	mov    %edx,0x24(%esi)
+  803922:	8b 15 6c 90 80 00    	mov    0x80906c,%edx
+  803928:	89 56 28             	mov    %edx,0x28(%esi)
+  80392b:	8b 15 70 90 80 00    	mov    0x809070,%edx
+  803931:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803934:	8b 15 74 90 80 00    	mov    0x809074,%edx
+  80393a:	89 56 30             	mov    %edx,0x30(%esi)
+  80393d:	8b 15 78 90 80 00    	mov    0x809078,%edx
+  803943:	89 56 34             	mov    %edx,0x34(%esi)
+  803946:	8b 15 7c 90 80 00    	mov    0x80907c,%edx
+  80394c:	89 56 38             	mov    %edx,0x38(%esi)
+  80394f:	8b 15 80 90 80 00    	mov    0x809080,%edx
+  803955:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803958:	8b 15 84 90 80 00    	mov    0x809084,%edx
+  80395e:	89 13                	mov    %edx,(%ebx)
+  803960:	8b 15 88 90 80 00    	mov    0x809088,%edx
+  803966:	89 53 04             	mov    %edx,0x4(%ebx)
+  803969:	8b 15 8c 90 80 00    	mov    0x80908c,%edx
+  80396f:	89 53 08             	mov    %edx,0x8(%ebx)
+  803972:	8b 15 90 90 80 00    	mov    0x809090,%edx
+  803978:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80397b:	8b 15 94 90 80 00    	mov    0x809094,%edx
+  803981:	89 53 10             	mov    %edx,0x10(%ebx)
+  803984:	8b 15 98 90 80 00    	mov    0x809098,%edx
+  80398a:	89 53 14             	mov    %edx,0x14(%ebx)
+  80398d:	8b 15 9c 90 80 00    	mov    0x80909c,%edx
+  803993:	89 53 18             	mov    %edx,0x18(%ebx)
+  803996:	8b 15 a0 90 80 00    	mov    0x8090a0,%edx
+  80399c:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80399f:	8b 15 a4 90 80 00    	mov    0x8090a4,%edx
+  8039a5:	89 53 20             	mov    %edx,0x20(%ebx)
+  8039a8:	8b 15 a8 90 80 00    	mov    0x8090a8,%edx
+  8039ae:	89 53 24             	mov    %edx,0x24(%ebx)
+  8039b1:	8b 15 ac 90 80 00    	mov    0x8090ac,%edx
+  8039b7:	89 53 28             	mov    %edx,0x28(%ebx)
+  8039ba:	8b 15 b0 90 80 00    	mov    0x8090b0,%edx
+  8039c0:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8039c3:	8b 15 b4 90 80 00    	mov    0x8090b4,%edx
+  8039c9:	89 53 30             	mov    %edx,0x30(%ebx)
+  8039cc:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  8039d2:	89 53 34             	mov    %edx,0x34(%ebx)
+  8039d5:	8b 15 bc 90 80 00    	mov    0x8090bc,%edx
+  8039db:	89 53 38             	mov    %edx,0x38(%ebx)
+  8039de:	8b 15 c0 90 80 00    	mov    0x8090c0,%edx
+  8039e4:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8039e7:	83 c4 0c             	add    $0xc,%esp
+  8039ea:	5b                   	pop    %ebx
+  8039eb:	5e                   	pop    %esi
+  8039ec:	5f                   	pop    %edi
+  8039ed:	5d                   	pop    %ebp
+  8039ee:	c3                   	ret
+
+008039ef <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8039ef:	55                   	push   %ebp
+  8039f0:	89 e5                	mov    %esp,%ebp
+  8039f2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8039f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039f8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.evctl.req_events = events;
+  8039fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a00:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.evctl.req_data = data;
+  803a05:	8b 45 10             	mov    0x10(%ebp),%eax
+  803a08:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_EVCTL);
+  803a0d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803a12:	e8 46 f4 ff ff       	call   802e5d <nsipc>
+}
+  803a17:	c9                   	leave
+  803a18:	c3                   	ret
+
+00803a19 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803a19:	55                   	push   %ebp
+  803a1a:	89 e5                	mov    %esp,%ebp
+  803a1c:	56                   	push   %esi
+  803a1d:	53                   	push   %ebx
+  803a1e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803a21:	89 35 00 90 80 00    	mov    %esi,0x809000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803a27:	8b 45 10             	mov    0x10(%ebp),%eax
+  803a2a:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803a2f:	b8 10 00 00 00       	mov    $0x10,%eax
+  803a34:	e8 24 f4 ff ff       	call   802e5d <nsipc>
+  803a39:	89 c3                	mov    %eax,%ebx
+  803a3b:	85 c0                	test   %eax,%eax
+  803a3d:	7e 1f                	jle    803a5e <nsipc_evwait+0x45>
+		assert(r <= max);
+  803a3f:	39 c6                	cmp    %eax,%esi
+  803a41:	7c 24                	jl     803a67 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803a43:	83 ec 04             	sub    $0x4,%esp
+  803a46:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803a4d:	50                   	push   %eax
+  803a4e:	68 00 90 80 00       	push   $0x809000
+  803a53:	ff 75 08             	push   0x8(%ebp)
+  803a56:	e8 36 d5 ff ff       	call   800f91 <memmove>
+  803a5b:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803a5e:	89 d8                	mov    %ebx,%eax
+  803a60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a63:	5b                   	pop    %ebx
+  803a64:	5e                   	pop    %esi
+  803a65:	5d                   	pop    %ebp
+  803a66:	c3                   	ret
+		assert(r <= max);
+  803a67:	68 26 53 80 00       	push   $0x805326
+  803a6c:	68 f9 52 80 00       	push   $0x8052f9
+  803a71:	68 6a 01 00 00       	push   $0x16a
+  803a76:	68 0e 53 80 00       	push   $0x80530e
+  803a7b:	e8 8f cb ff ff       	call   80060f <_panic>
+
+00803a80 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803a80:	55                   	push   %ebp
+  803a81:	89 e5                	mov    %esp,%ebp
+  803a83:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a89:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803a8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a91:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803a96:	8b 45 10             	mov    0x10(%ebp),%eax
+  803a99:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803a9e:	b8 09 00 00 00       	mov    $0x9,%eax
+  803aa3:	e8 b5 f3 ff ff       	call   802e5d <nsipc>
+}
+  803aa8:	c9                   	leave
+  803aa9:	c3                   	ret
+
+00803aaa <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803aaa:	55                   	push   %ebp
+  803aab:	89 e5                	mov    %esp,%ebp
+  803aad:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ab3:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_OFFLOAD);
+  803ab8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803abd:	e8 9b f3 ff ff       	call   802e5d <nsipc>
+}
+  803ac2:	c9                   	leave
+  803ac3:	c3                   	ret
+
+00803ac4 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803ac4:	55                   	push   %ebp
+  803ac5:	89 e5                	mov    %esp,%ebp
+  803ac7:	53                   	push   %ebx
+  803ac8:	83 ec 04             	sub    $0x4,%esp
+  803acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803ace:	b8 12 00 00 00       	mov    $0x12,%eax
+  803ad3:	e8 85 f3 ff ff       	call   802e5d <nsipc>
+  803ad8:	85 c0                	test   %eax,%eax
+  803ada:	78 50                	js     803b2c <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803adc:	8b 15 00 90 80 00    	mov    0x809000,%edx
+  803ae2:	89 13                	mov    %edx,(%ebx)
+  803ae4:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  803aea:	89 53 04             	mov    %edx,0x4(%ebx)
+  803aed:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  803af3:	89 53 08             	mov    %edx,0x8(%ebx)
+  803af6:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  803afc:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803aff:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  803b05:	89 53 10             	mov    %edx,0x10(%ebx)
+  803b08:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  803b0e:	89 53 14             	mov    %edx,0x14(%ebx)
+  803b11:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  803b17:	89 53 18             	mov    %edx,0x18(%ebx)
+  803b1a:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  803b20:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803b23:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  803b29:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803b2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b2f:	c9                   	leave
+  803b30:	c3                   	ret
+
+00803b31 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803b31:	55                   	push   %ebp
+  803b32:	89 e5                	mov    %esp,%ebp
+  803b34:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803b37:	6a 03                	push   $0x3
+  803b39:	e8 af e5 ff ff       	call   8020ed <ipc_find_env>
+  803b3e:	a3 04 7a 80 00       	mov    %eax,0x807a04
+	nsipcbuf.shard.req_shard = shard;
+  803b43:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b46:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803b4b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803b50:	e8 08 f3 ff ff       	call   802e5d <nsipc>
+  803b55:	83 c4 10             	add    $0x10,%esp
+  803b58:	85 c0                	test   %eax,%eax
+  803b5a:	78 0a                	js     803b66 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803b5c:	a3 04 7a 80 00       	mov    %eax,0x807a04
+	return 0;
+  803b61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b66:	c9                   	leave
+  803b67:	c3                   	ret
+
+00803b68 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803b68:	55                   	push   %ebp
+  803b69:	89 e5                	mov    %esp,%ebp
+  803b6b:	57                   	push   %edi
+  803b6c:	56                   	push   %esi
+  803b6d:	53                   	push   %ebx
+  803b6e:	83 ec 1c             	sub    $0x1c,%esp
+  803b71:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803b74:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803b77:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803b7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b81:	89 e0                	mov    %esp,%eax
+  803b83:	89 f2                	mov    %esi,%edx
+  803b85:	29 c2                	sub    %eax,%edx
+  803b87:	89 d0                	mov    %edx,%eax
+  803b89:	c1 e8 0f             	shr    $0xf,%eax
+  803b8c:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803b92:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803b95:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  803b9c:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803b9f:	83 ec 0c             	sub    $0xc,%esp
+  803ba2:	ff 75 e0             	push   -0x20(%ebp)
+  803ba5:	e8 41 0b 00 00       	call   8046eb <pageref>
+  803baa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803bad:	83 c4 04             	add    $0x4,%esp
+  803bb0:	ff 75 dc             	push   -0x24(%ebp)
+  803bb3:	e8 33 0b 00 00       	call   8046eb <pageref>
+  803bb8:	89 e2                	mov    %esp,%edx
+  803bba:	89 f1                	mov    %esi,%ecx
+  803bbc:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803bbe:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803bc1:	89 ca                	mov    %ecx,%edx
+  803bc3:	c1 ea 0f             	shr    $0xf,%edx
+  803bc6:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803bcc:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803bcf:	8b 14 95 40 7a 80 00 	mov    0x807a40(,%edx,4),%edx
+  803bd6:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803bd9:	39 d7                	cmp    %edx,%edi
+  803bdb:	74 40                	je     803c1d <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803bdd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803be0:	75 9f                	jne    803b81 <_pipeisclosed+0x19>
+  803be2:	89 e2                	mov    %esp,%edx
+  803be4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803be9:	29 d0                	sub    %edx,%eax
+  803beb:	89 c2                	mov    %eax,%edx
+  803bed:	c1 ea 0f             	shr    $0xf,%edx
+  803bf0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bfa:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803bfd:	8b 04 85 40 7a 80 00 	mov    0x807a40(,%eax,4),%eax
+  803c04:	8b 40 58             	mov    0x58(%eax),%eax
+  803c07:	6a 01                	push   $0x1
+  803c09:	50                   	push   %eax
+  803c0a:	57                   	push   %edi
+  803c0b:	68 2f 53 80 00       	push   $0x80532f
+  803c10:	e8 d5 ca ff ff       	call   8006ea <cprintf>
+  803c15:	83 c4 10             	add    $0x10,%esp
+  803c18:	e9 5f ff ff ff       	jmp    803b7c <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803c1d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803c20:	0f 94 c0             	sete   %al
+  803c23:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803c26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c29:	5b                   	pop    %ebx
+  803c2a:	5e                   	pop    %esi
+  803c2b:	5f                   	pop    %edi
+  803c2c:	5d                   	pop    %ebp
+  803c2d:	c3                   	ret
+
+00803c2e <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803c2e:	55                   	push   %ebp
+  803c2f:	89 e5                	mov    %esp,%ebp
+  803c31:	53                   	push   %ebx
+  803c32:	83 ec 0c             	sub    $0xc,%esp
+  803c35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803c38:	53                   	push   %ebx
+  803c39:	6a 00                	push   $0x0
+  803c3b:	e8 5a d6 ff ff       	call   80129a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803c40:	89 1c 24             	mov    %ebx,(%esp)
+  803c43:	e8 f4 e4 ff ff       	call   80213c <fd2data>
+  803c48:	83 c4 08             	add    $0x8,%esp
+  803c4b:	50                   	push   %eax
+  803c4c:	6a 00                	push   $0x0
+  803c4e:	e8 47 d6 ff ff       	call   80129a <sys_page_unmap>
+}
+  803c53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c56:	c9                   	leave
+  803c57:	c3                   	ret
+
+00803c58 <devpipe_read>:
+{
+  803c58:	55                   	push   %ebp
+  803c59:	89 e5                	mov    %esp,%ebp
+  803c5b:	57                   	push   %edi
+  803c5c:	56                   	push   %esi
+  803c5d:	53                   	push   %ebx
+  803c5e:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803c61:	ff 75 08             	push   0x8(%ebp)
+  803c64:	e8 d3 e4 ff ff       	call   80213c <fd2data>
+  803c69:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803c6b:	8b 70 04             	mov    0x4(%eax),%esi
+  803c6e:	8b 00                	mov    (%eax),%eax
+  803c70:	83 c4 10             	add    $0x10,%esp
+  803c73:	39 f0                	cmp    %esi,%eax
+  803c75:	75 36                	jne    803cad <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803c77:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803c7a:	89 da                	mov    %ebx,%edx
+  803c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c7f:	e8 e4 fe ff ff       	call   803b68 <_pipeisclosed>
+  803c84:	85 c0                	test   %eax,%eax
+  803c86:	0f 85 d4 00 00 00    	jne    803d60 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803c8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c91:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803c95:	83 ec 04             	sub    $0x4,%esp
+  803c98:	6a ff                	push   $0xffffffff
+  803c9a:	56                   	push   %esi
+  803c9b:	57                   	push   %edi
+  803c9c:	e8 72 d9 ff ff       	call   801613 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803ca1:	8b 73 04             	mov    0x4(%ebx),%esi
+  803ca4:	8b 03                	mov    (%ebx),%eax
+  803ca6:	83 c4 10             	add    $0x10,%esp
+  803ca9:	39 c6                	cmp    %eax,%esi
+  803cab:	74 cd                	je     803c7a <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803cad:	8b 73 04             	mov    0x4(%ebx),%esi
+  803cb0:	8b 03                	mov    (%ebx),%eax
+  803cb2:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803cb8:	29 c6                	sub    %eax,%esi
+  803cba:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803cbf:	f7 e6                	mul    %esi
+  803cc1:	c1 ea 0c             	shr    $0xc,%edx
+  803cc4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803cca:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803ccc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803ccf:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803cd3:	8b 0b                	mov    (%ebx),%ecx
+  803cd5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803cda:	f7 e1                	mul    %ecx
+  803cdc:	c1 ea 0b             	shr    $0xb,%edx
+  803cdf:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803ce5:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803ce7:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803cec:	29 cf                	sub    %ecx,%edi
+  803cee:	39 f7                	cmp    %esi,%edi
+  803cf0:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803cf3:	83 ec 04             	sub    $0x4,%esp
+  803cf6:	57                   	push   %edi
+  803cf7:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803cfb:	50                   	push   %eax
+  803cfc:	ff 75 0c             	push   0xc(%ebp)
+  803cff:	e8 8d d2 ff ff       	call   800f91 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803d04:	83 c4 0c             	add    $0xc,%esp
+  803d07:	89 f0                	mov    %esi,%eax
+  803d09:	29 f8                	sub    %edi,%eax
+  803d0b:	50                   	push   %eax
+  803d0c:	8d 43 10             	lea    0x10(%ebx),%eax
+  803d0f:	50                   	push   %eax
+  803d10:	89 f8                	mov    %edi,%eax
+  803d12:	03 45 0c             	add    0xc(%ebp),%eax
+  803d15:	50                   	push   %eax
+  803d16:	e8 76 d2 ff ff       	call   800f91 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803d1b:	8b 0b                	mov    (%ebx),%ecx
+  803d1d:	01 f1                	add    %esi,%ecx
+  803d1f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803d24:	f7 e1                	mul    %ecx
+  803d26:	c1 ea 0c             	shr    $0xc,%edx
+  803d29:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803d2f:	29 c1                	sub    %eax,%ecx
+  803d31:	89 0b                	mov    %ecx,(%ebx)
+  803d33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d38:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803d3c:	83 c4 10             	add    $0x10,%esp
+  803d3f:	85 c0                	test   %eax,%eax
+  803d41:	75 0a                	jne    803d4d <devpipe_read+0xf5>
+	return n;
+  803d43:	89 f0                	mov    %esi,%eax
+}
+  803d45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d48:	5b                   	pop    %ebx
+  803d49:	5e                   	pop    %esi
+  803d4a:	5f                   	pop    %edi
+  803d4b:	5d                   	pop    %ebp
+  803d4c:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803d4d:	83 ec 08             	sub    $0x8,%esp
+  803d50:	68 00 04 00 00       	push   $0x400
+  803d55:	53                   	push   %ebx
+  803d56:	e8 da d8 ff ff       	call   801635 <sys_futex_wake>
+  803d5b:	83 c4 10             	add    $0x10,%esp
+  803d5e:	eb e3                	jmp    803d43 <devpipe_read+0xeb>
+			return 0;
+  803d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d65:	eb de                	jmp    803d45 <devpipe_read+0xed>
+
+00803d67 <devpipe_write>:
+{
+  803d67:	55                   	push   %ebp
+  803d68:	89 e5                	mov    %esp,%ebp
+  803d6a:	57                   	push   %edi
+  803d6b:	56                   	push   %esi
+  803d6c:	53                   	push   %ebx
+  803d6d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803d70:	ff 75 08             	push   0x8(%ebp)
+  803d73:	e8 c4 e3 ff ff       	call   80213c <fd2data>
+  803d78:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803d7a:	83 c4 10             	add    $0x10,%esp
+  803d7d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803d84:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803d89:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803d8d:	0f 84 43 01 00 00    	je     803ed6 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803d93:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803d96:	8b 06                	mov    (%esi),%eax
+  803d98:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803d9e:	29 c1                	sub    %eax,%ecx
+  803da0:	89 c8                	mov    %ecx,%eax
+  803da2:	f7 e7                	mul    %edi
+  803da4:	c1 ea 0c             	shr    $0xc,%edx
+  803da7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803dad:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803daf:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803db5:	75 52                	jne    803e09 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803db7:	89 f2                	mov    %esi,%edx
+  803db9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dbc:	e8 a7 fd ff ff       	call   803b68 <_pipeisclosed>
+  803dc1:	85 c0                	test   %eax,%eax
+  803dc3:	0f 85 28 01 00 00    	jne    803ef1 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803dc9:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803dcb:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803dce:	8b 06                	mov    (%esi),%eax
+  803dd0:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803dd6:	29 c1                	sub    %eax,%ecx
+  803dd8:	89 c8                	mov    %ecx,%eax
+  803dda:	f7 e7                	mul    %edi
+  803ddc:	c1 ea 0c             	shr    $0xc,%edx
+  803ddf:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803de5:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803de7:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803ded:	75 a4                	jne    803d93 <devpipe_write+0x2c>
+  803def:	b8 01 00 00 00       	mov    $0x1,%eax
+  803df4:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803df8:	83 ec 04             	sub    $0x4,%esp
+  803dfb:	6a ff                	push   $0xffffffff
+  803dfd:	53                   	push   %ebx
+  803dfe:	56                   	push   %esi
+  803dff:	e8 0f d8 ff ff       	call   801613 <sys_futex_wait>
+}
+  803e04:	83 c4 10             	add    $0x10,%esp
+  803e07:	eb 8a                	jmp    803d93 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803e09:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803e0c:	8b 06                	mov    (%esi),%eax
+  803e0e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803e14:	29 c1                	sub    %eax,%ecx
+  803e16:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803e1b:	f7 e1                	mul    %ecx
+  803e1d:	c1 ea 0c             	shr    $0xc,%edx
+  803e20:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803e26:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803e28:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803e2d:	89 d8                	mov    %ebx,%eax
+  803e2f:	29 c8                	sub    %ecx,%eax
+  803e31:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e34:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803e37:	29 ca                	sub    %ecx,%edx
+  803e39:	39 d0                	cmp    %edx,%eax
+  803e3b:	0f 46 d0             	cmovbe %eax,%edx
+  803e3e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803e41:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803e44:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803e49:	f7 e1                	mul    %ecx
+  803e4b:	c1 ea 0b             	shr    $0xb,%edx
+  803e4e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803e54:	89 ca                	mov    %ecx,%edx
+  803e56:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803e58:	29 d3                	sub    %edx,%ebx
+  803e5a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803e5d:	39 c3                	cmp    %eax,%ebx
+  803e5f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803e62:	83 ec 04             	sub    $0x4,%esp
+  803e65:	53                   	push   %ebx
+  803e66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803e69:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803e6c:	51                   	push   %ecx
+  803e6d:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803e71:	50                   	push   %eax
+  803e72:	e8 1a d1 ff ff       	call   800f91 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803e77:	83 c4 0c             	add    $0xc,%esp
+  803e7a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803e7d:	29 d8                	sub    %ebx,%eax
+  803e7f:	50                   	push   %eax
+  803e80:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803e83:	01 cb                	add    %ecx,%ebx
+  803e85:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803e88:	53                   	push   %ebx
+  803e89:	8d 46 10             	lea    0x10(%esi),%eax
+  803e8c:	50                   	push   %eax
+  803e8d:	e8 ff d0 ff ff       	call   800f91 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803e92:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803e95:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803e98:	01 c1                	add    %eax,%ecx
+  803e9a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803e9f:	f7 e1                	mul    %ecx
+  803ea1:	c1 ea 0c             	shr    $0xc,%edx
+  803ea4:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803eaa:	89 ca                	mov    %ecx,%edx
+  803eac:	29 c2                	sub    %eax,%edx
+  803eae:	89 56 04             	mov    %edx,0x4(%esi)
+  803eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb6:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803eba:	83 c4 10             	add    $0x10,%esp
+  803ebd:	85 c0                	test   %eax,%eax
+  803ebf:	75 1a                	jne    803edb <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803ec1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803ec4:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803ec7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803eca:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803ecd:	0f 82 c0 fe ff ff    	jb     803d93 <devpipe_write+0x2c>
+  803ed3:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803ed6:	8b 45 10             	mov    0x10(%ebp),%eax
+  803ed9:	eb 1b                	jmp    803ef6 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803edb:	83 ec 08             	sub    $0x8,%esp
+  803ede:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803ee3:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803ee6:	50                   	push   %eax
+  803ee7:	e8 49 d7 ff ff       	call   801635 <sys_futex_wake>
+  803eec:	83 c4 10             	add    $0x10,%esp
+  803eef:	eb d0                	jmp    803ec1 <devpipe_write+0x15a>
+				return 0;
+  803ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ef6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ef9:	5b                   	pop    %ebx
+  803efa:	5e                   	pop    %esi
+  803efb:	5f                   	pop    %edi
+  803efc:	5d                   	pop    %ebp
+  803efd:	c3                   	ret
+
+00803efe <devpipe_stat>:
+{
+  803efe:	55                   	push   %ebp
+  803eff:	89 e5                	mov    %esp,%ebp
+  803f01:	56                   	push   %esi
+  803f02:	53                   	push   %ebx
+  803f03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803f06:	83 ec 0c             	sub    $0xc,%esp
+  803f09:	ff 75 08             	push   0x8(%ebp)
+  803f0c:	e8 2b e2 ff ff       	call   80213c <fd2data>
+  803f11:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803f13:	83 c4 08             	add    $0x8,%esp
+  803f16:	68 42 53 80 00       	push   $0x805342
+  803f1b:	53                   	push   %ebx
+  803f1c:	e8 c0 ce ff ff       	call   800de1 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803f21:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803f24:	8b 06                	mov    (%esi),%eax
+  803f26:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803f2c:	29 c1                	sub    %eax,%ecx
+  803f2e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803f33:	89 c8                	mov    %ecx,%eax
+  803f35:	f7 e2                	mul    %edx
+  803f37:	c1 ea 0c             	shr    $0xc,%edx
+  803f3a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803f40:	29 d1                	sub    %edx,%ecx
+  803f42:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803f48:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803f4f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803f52:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  803f59:	60 80 00 
+}
+  803f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f64:	5b                   	pop    %ebx
+  803f65:	5e                   	pop    %esi
+  803f66:	5d                   	pop    %ebp
+  803f67:	c3                   	ret
+
+00803f68 <devpipe_poll>:
+{
+  803f68:	55                   	push   %ebp
+  803f69:	89 e5                	mov    %esp,%ebp
+  803f6b:	57                   	push   %edi
+  803f6c:	56                   	push   %esi
+  803f6d:	53                   	push   %ebx
+  803f6e:	83 ec 18             	sub    $0x18,%esp
+  803f71:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803f74:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803f77:	57                   	push   %edi
+  803f78:	e8 bf e1 ff ff       	call   80213c <fd2data>
+  803f7d:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803f7f:	83 c4 10             	add    $0x10,%esp
+  803f82:	89 f3                	mov    %esi,%ebx
+  803f84:	83 e3 01             	and    $0x1,%ebx
+  803f87:	75 27                	jne    803fb0 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803f89:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803f8f:	75 48                	jne    803fd9 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803f91:	89 ca                	mov    %ecx,%edx
+  803f93:	89 f8                	mov    %edi,%eax
+  803f95:	e8 ce fb ff ff       	call   803b68 <_pipeisclosed>
+  803f9a:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803f9c:	89 d8                	mov    %ebx,%eax
+  803f9e:	83 c8 10             	or     $0x10,%eax
+  803fa1:	85 d2                	test   %edx,%edx
+  803fa3:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803fa6:	89 d8                	mov    %ebx,%eax
+  803fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fab:	5b                   	pop    %ebx
+  803fac:	5e                   	pop    %esi
+  803fad:	5f                   	pop    %edi
+  803fae:	5d                   	pop    %ebp
+  803faf:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803fb0:	8b 58 04             	mov    0x4(%eax),%ebx
+  803fb3:	8b 00                	mov    (%eax),%eax
+  803fb5:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803fbb:	29 c3                	sub    %eax,%ebx
+  803fbd:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803fc2:	89 d8                	mov    %ebx,%eax
+  803fc4:	f7 e2                	mul    %edx
+  803fc6:	c1 ea 0c             	shr    $0xc,%edx
+  803fc9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803fcf:	39 d3                	cmp    %edx,%ebx
+  803fd1:	0f 95 c3             	setne  %bl
+  803fd4:	0f b6 db             	movzbl %bl,%ebx
+  803fd7:	eb b0                	jmp    803f89 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803fd9:	8b 71 04             	mov    0x4(%ecx),%esi
+  803fdc:	8b 01                	mov    (%ecx),%eax
+  803fde:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803fe4:	29 c6                	sub    %eax,%esi
+  803fe6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803feb:	89 f0                	mov    %esi,%eax
+  803fed:	f7 e2                	mul    %edx
+  803fef:	c1 ea 0c             	shr    $0xc,%edx
+  803ff2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803ff8:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803ffa:	89 d8                	mov    %ebx,%eax
+  803ffc:	83 c8 04             	or     $0x4,%eax
+  803fff:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  804005:	0f 42 d8             	cmovb  %eax,%ebx
+  804008:	eb 87                	jmp    803f91 <devpipe_poll+0x29>
+
+0080400a <pipe>:
+{
+  80400a:	55                   	push   %ebp
+  80400b:	89 e5                	mov    %esp,%ebp
+  80400d:	56                   	push   %esi
+  80400e:	53                   	push   %ebx
+  80400f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804012:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804015:	50                   	push   %eax
+  804016:	e8 38 e1 ff ff       	call   802153 <fd_alloc>
+  80401b:	89 c3                	mov    %eax,%ebx
+  80401d:	83 c4 10             	add    $0x10,%esp
+  804020:	85 c0                	test   %eax,%eax
+  804022:	0f 88 23 01 00 00    	js     80414b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804028:	83 ec 04             	sub    $0x4,%esp
+  80402b:	68 07 04 00 00       	push   $0x407
+  804030:	ff 75 f4             	push   -0xc(%ebp)
+  804033:	6a 00                	push   $0x0
+  804035:	e8 db d1 ff ff       	call   801215 <sys_page_alloc>
+  80403a:	89 c3                	mov    %eax,%ebx
+  80403c:	83 c4 10             	add    $0x10,%esp
+  80403f:	85 c0                	test   %eax,%eax
+  804041:	0f 88 04 01 00 00    	js     80414b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  804047:	83 ec 0c             	sub    $0xc,%esp
+  80404a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80404d:	50                   	push   %eax
+  80404e:	e8 00 e1 ff ff       	call   802153 <fd_alloc>
+  804053:	89 c3                	mov    %eax,%ebx
+  804055:	83 c4 10             	add    $0x10,%esp
+  804058:	85 c0                	test   %eax,%eax
+  80405a:	0f 88 db 00 00 00    	js     80413b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804060:	83 ec 04             	sub    $0x4,%esp
+  804063:	68 07 04 00 00       	push   $0x407
+  804068:	ff 75 f0             	push   -0x10(%ebp)
+  80406b:	6a 00                	push   $0x0
+  80406d:	e8 a3 d1 ff ff       	call   801215 <sys_page_alloc>
+  804072:	89 c3                	mov    %eax,%ebx
+  804074:	83 c4 10             	add    $0x10,%esp
+  804077:	85 c0                	test   %eax,%eax
+  804079:	0f 88 bc 00 00 00    	js     80413b <pipe+0x131>
+	va = fd2data(fd0);
+  80407f:	83 ec 0c             	sub    $0xc,%esp
+  804082:	ff 75 f4             	push   -0xc(%ebp)
+  804085:	e8 b2 e0 ff ff       	call   80213c <fd2data>
+  80408a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80408c:	83 c4 0c             	add    $0xc,%esp
+  80408f:	68 07 04 00 00       	push   $0x407
+  804094:	50                   	push   %eax
+  804095:	6a 00                	push   $0x0
+  804097:	e8 79 d1 ff ff       	call   801215 <sys_page_alloc>
+  80409c:	89 c3                	mov    %eax,%ebx
+  80409e:	83 c4 10             	add    $0x10,%esp
+  8040a1:	85 c0                	test   %eax,%eax
+  8040a3:	0f 88 82 00 00 00    	js     80412b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8040a9:	83 ec 0c             	sub    $0xc,%esp
+  8040ac:	ff 75 f0             	push   -0x10(%ebp)
+  8040af:	e8 88 e0 ff ff       	call   80213c <fd2data>
+  8040b4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8040bb:	50                   	push   %eax
+  8040bc:	6a 00                	push   $0x0
+  8040be:	56                   	push   %esi
+  8040bf:	6a 00                	push   $0x0
+  8040c1:	e8 92 d1 ff ff       	call   801258 <sys_page_map>
+  8040c6:	89 c3                	mov    %eax,%ebx
+  8040c8:	83 c4 20             	add    $0x20,%esp
+  8040cb:	85 c0                	test   %eax,%eax
+  8040cd:	78 4e                	js     80411d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8040cf:	a1 60 60 80 00       	mov    0x806060,%eax
+  8040d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8040d7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8040d9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8040dc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8040e3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8040e6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8040e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8040eb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8040f2:	83 ec 0c             	sub    $0xc,%esp
+  8040f5:	ff 75 f4             	push   -0xc(%ebp)
+  8040f8:	e8 2f e0 ff ff       	call   80212c <fd2num>
+  8040fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804100:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804102:	83 c4 04             	add    $0x4,%esp
+  804105:	ff 75 f0             	push   -0x10(%ebp)
+  804108:	e8 1f e0 ff ff       	call   80212c <fd2num>
+  80410d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804110:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804113:	83 c4 10             	add    $0x10,%esp
+  804116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80411b:	eb 2e                	jmp    80414b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80411d:	83 ec 08             	sub    $0x8,%esp
+  804120:	56                   	push   %esi
+  804121:	6a 00                	push   $0x0
+  804123:	e8 72 d1 ff ff       	call   80129a <sys_page_unmap>
+  804128:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80412b:	83 ec 08             	sub    $0x8,%esp
+  80412e:	ff 75 f0             	push   -0x10(%ebp)
+  804131:	6a 00                	push   $0x0
+  804133:	e8 62 d1 ff ff       	call   80129a <sys_page_unmap>
+  804138:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80413b:	83 ec 08             	sub    $0x8,%esp
+  80413e:	ff 75 f4             	push   -0xc(%ebp)
+  804141:	6a 00                	push   $0x0
+  804143:	e8 52 d1 ff ff       	call   80129a <sys_page_unmap>
+  804148:	83 c4 10             	add    $0x10,%esp
+}
+  80414b:	89 d8                	mov    %ebx,%eax
+  80414d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804150:	5b                   	pop    %ebx
+  804151:	5e                   	pop    %esi
+  804152:	5d                   	pop    %ebp
+  804153:	c3                   	ret
+
+00804154 <pipeisclosed>:
+{
+  804154:	55                   	push   %ebp
+  804155:	89 e5                	mov    %esp,%ebp
+  804157:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80415a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80415d:	50                   	push   %eax
+  80415e:	ff 75 08             	push   0x8(%ebp)
+  804161:	e8 3d e0 ff ff       	call   8021a3 <fd_lookup>
+  804166:	83 c4 10             	add    $0x10,%esp
+  804169:	85 c0                	test   %eax,%eax
+  80416b:	78 18                	js     804185 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80416d:	83 ec 0c             	sub    $0xc,%esp
+  804170:	ff 75 f4             	push   -0xc(%ebp)
+  804173:	e8 c4 df ff ff       	call   80213c <fd2data>
+  804178:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80417a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80417d:	e8 e6 f9 ff ff       	call   803b68 <_pipeisclosed>
+  804182:	83 c4 10             	add    $0x10,%esp
+}
+  804185:	c9                   	leave
+  804186:	c3                   	ret
+
+00804187 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  804187:	55                   	push   %ebp
+  804188:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80418a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80418d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804193:	5d                   	pop    %ebp
+  804194:	c3                   	ret
+
+00804195 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  804195:	55                   	push   %ebp
+  804196:	89 e5                	mov    %esp,%ebp
+  804198:	53                   	push   %ebx
+  804199:	83 ec 04             	sub    $0x4,%esp
+  80419c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80419f:	8b 03                	mov    (%ebx),%eax
+  8041a1:	85 c0                	test   %eax,%eax
+  8041a3:	75 05                	jne    8041aa <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8041a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041a8:	c9                   	leave
+  8041a9:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8041aa:	83 ec 08             	sub    $0x8,%esp
+  8041ad:	50                   	push   %eax
+  8041ae:	8d 43 04             	lea    0x4(%ebx),%eax
+  8041b1:	50                   	push   %eax
+  8041b2:	e8 33 d3 ff ff       	call   8014ea <sys_page_batch>
+	pb->pb_n = 0;
+  8041b7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8041bd:	83 c4 10             	add    $0x10,%esp
+  8041c0:	eb e3                	jmp    8041a5 <pgbatch_flush+0x10>
+
+008041c2 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8041c2:	55                   	push   %ebp
+  8041c3:	89 e5                	mov    %esp,%ebp
+  8041c5:	56                   	push   %esi
+  8041c6:	53                   	push   %ebx
+  8041c7:	89 c3                	mov    %eax,%ebx
+  8041c9:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8041cb:	83 38 20             	cmpl   $0x20,(%eax)
+  8041ce:	74 2c                	je     8041fc <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8041d0:	8b 03                	mov    (%ebx),%eax
+  8041d2:	8d 50 01             	lea    0x1(%eax),%edx
+  8041d5:	89 13                	mov    %edx,(%ebx)
+  8041d7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8041da:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8041de:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8041e0:	83 ec 04             	sub    $0x4,%esp
+  8041e3:	6a 18                	push   $0x18
+  8041e5:	6a 00                	push   $0x0
+  8041e7:	50                   	push   %eax
+  8041e8:	e8 6f cd ff ff       	call   800f5c <memset>
+	return 0;
+  8041ed:	83 c4 10             	add    $0x10,%esp
+  8041f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8041f8:	5b                   	pop    %ebx
+  8041f9:	5e                   	pop    %esi
+  8041fa:	5d                   	pop    %ebp
+  8041fb:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8041fc:	83 ec 0c             	sub    $0xc,%esp
+  8041ff:	50                   	push   %eax
+  804200:	e8 90 ff ff ff       	call   804195 <pgbatch_flush>
+  804205:	83 c4 10             	add    $0x10,%esp
+  804208:	85 c0                	test   %eax,%eax
+  80420a:	79 c4                	jns    8041d0 <pgbatch_slot+0xe>
+  80420c:	eb e7                	jmp    8041f5 <pgbatch_slot+0x33>
+
+0080420e <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80420e:	55                   	push   %ebp
+  80420f:	89 e5                	mov    %esp,%ebp
+  804211:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804214:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804217:	8b 45 08             	mov    0x8(%ebp),%eax
+  80421a:	e8 a3 ff ff ff       	call   8041c2 <pgbatch_slot>
+  80421f:	85 c0                	test   %eax,%eax
+  804221:	78 20                	js     804243 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  804223:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804226:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80422c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80422f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804232:	8b 55 10             	mov    0x10(%ebp),%edx
+  804235:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804238:	8b 55 14             	mov    0x14(%ebp),%edx
+  80423b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80423e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804243:	c9                   	leave
+  804244:	c3                   	ret
+
+00804245 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  804245:	55                   	push   %ebp
+  804246:	89 e5                	mov    %esp,%ebp
+  804248:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80424b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80424e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804251:	e8 6c ff ff ff       	call   8041c2 <pgbatch_slot>
+  804256:	85 c0                	test   %eax,%eax
+  804258:	78 2c                	js     804286 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80425a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80425d:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  804263:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804266:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  804269:	8b 55 10             	mov    0x10(%ebp),%edx
+  80426c:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80426f:	8b 55 14             	mov    0x14(%ebp),%edx
+  804272:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  804275:	8b 55 18             	mov    0x18(%ebp),%edx
+  804278:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80427b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80427e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804281:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804286:	c9                   	leave
+  804287:	c3                   	ret
+
+00804288 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  804288:	55                   	push   %ebp
+  804289:	89 e5                	mov    %esp,%ebp
+  80428b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80428e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804291:	8b 45 08             	mov    0x8(%ebp),%eax
+  804294:	e8 29 ff ff ff       	call   8041c2 <pgbatch_slot>
+  804299:	85 c0                	test   %eax,%eax
+  80429b:	78 1a                	js     8042b7 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80429d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042a0:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8042a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8042a9:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8042ac:	8b 55 10             	mov    0x10(%ebp),%edx
+  8042af:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8042b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042b7:	c9                   	leave
+  8042b8:	c3                   	ret
+
+008042b9 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8042b9:	55                   	push   %ebp
+  8042ba:	89 e5                	mov    %esp,%ebp
+  8042bc:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8042bf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8042c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042c5:	e8 f8 fe ff ff       	call   8041c2 <pgbatch_slot>
+  8042ca:	85 c0                	test   %eax,%eax
+  8042cc:	78 20                	js     8042ee <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8042ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042d1:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8042d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8042da:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8042dd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8042e0:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8042e3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8042e6:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8042e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042ee:	c9                   	leave
+  8042ef:	c3                   	ret
+
+008042f0 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8042f0:	55                   	push   %ebp
+  8042f1:	89 e5                	mov    %esp,%ebp
+  8042f3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8042f6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8042f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042fc:	e8 c1 fe ff ff       	call   8041c2 <pgbatch_slot>
+  804301:	85 c0                	test   %eax,%eax
+  804303:	78 26                	js     80432b <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  804305:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804308:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80430e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804311:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  804314:	8b 55 10             	mov    0x10(%ebp),%edx
+  804317:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80431a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80431d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  804320:	8b 55 18             	mov    0x18(%ebp),%edx
+  804323:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804326:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80432b:	c9                   	leave
+  80432c:	c3                   	ret
+
+0080432d <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  80432d:	55                   	push   %ebp
+  80432e:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  804330:	8b 45 08             	mov    0x8(%ebp),%eax
+  804333:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804339:	5d                   	pop    %ebp
+  80433a:	c3                   	ret
+
+0080433b <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  80433b:	55                   	push   %ebp
+  80433c:	89 e5                	mov    %esp,%ebp
+  80433e:	56                   	push   %esi
+  80433f:	53                   	push   %ebx
+  804340:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804343:	b8 00 00 00 00       	mov    $0x0,%eax
+  804348:	ba 01 00 00 00       	mov    $0x1,%edx
+  80434d:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804351:	85 c0                	test   %eax,%eax
+  804353:	74 2f                	je     804384 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  804355:	83 f8 02             	cmp    $0x2,%eax
+  804358:	74 0c                	je     804366 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  80435a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80435f:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  804362:	85 c0                	test   %eax,%eax
+  804364:	74 1e                	je     804384 <mutex_lock+0x49>
+  804366:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  80436b:	83 ec 04             	sub    $0x4,%esp
+  80436e:	6a ff                	push   $0xffffffff
+  804370:	6a 02                	push   $0x2
+  804372:	53                   	push   %ebx
+  804373:	e8 9b d2 ff ff       	call   801613 <sys_futex_wait>
+  804378:	89 f0                	mov    %esi,%eax
+  80437a:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  80437d:	83 c4 10             	add    $0x10,%esp
+  804380:	85 c0                	test   %eax,%eax
+  804382:	75 e7                	jne    80436b <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804387:	5b                   	pop    %ebx
+  804388:	5e                   	pop    %esi
+  804389:	5d                   	pop    %ebp
+  80438a:	c3                   	ret
+
+0080438b <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  80438b:	55                   	push   %ebp
+  80438c:	89 e5                	mov    %esp,%ebp
+  80438e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804391:	b8 00 00 00 00       	mov    $0x0,%eax
+  804396:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80439b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  80439f:	85 c0                	test   %eax,%eax
+  8043a1:	0f 94 c0             	sete   %al
+  8043a4:	0f b6 c0             	movzbl %al,%eax
+}
+  8043a7:	5d                   	pop    %ebp
+  8043a8:	c3                   	ret
+
+008043a9 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8043a9:	55                   	push   %ebp
+  8043aa:	89 e5                	mov    %esp,%ebp
+  8043ac:	83 ec 08             	sub    $0x8,%esp
+  8043af:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  8043b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b7:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8043ba:	83 f8 02             	cmp    $0x2,%eax
+  8043bd:	74 02                	je     8043c1 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8043bf:	c9                   	leave
+  8043c0:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8043c1:	83 ec 08             	sub    $0x8,%esp
+  8043c4:	6a 01                	push   $0x1
+  8043c6:	52                   	push   %edx
+  8043c7:	e8 69 d2 ff ff       	call   801635 <sys_futex_wake>
+  8043cc:	83 c4 10             	add    $0x10,%esp
+}
+  8043cf:	eb ee                	jmp    8043bf <mutex_unlock+0x16>
+
+008043d1 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  8043d1:	55                   	push   %ebp
+  8043d2:	89 e5                	mov    %esp,%ebp
+  8043d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  8043d7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  8043dd:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8043e4:	5d                   	pop    %ebp
+  8043e5:	c3                   	ret
+
+008043e6 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8043e6:	55                   	push   %ebp
+  8043e7:	89 e5                	mov    %esp,%ebp
+  8043e9:	57                   	push   %edi
+  8043ea:	56                   	push   %esi
+  8043eb:	53                   	push   %ebx
+  8043ec:	83 ec 18             	sub    $0x18,%esp
+  8043ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8043f2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  8043f5:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  8043f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043fc:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804401:	57                   	push   %edi
+  804402:	e8 a2 ff ff ff       	call   8043a9 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804407:	83 c4 0c             	add    $0xc,%esp
+  80440a:	ff 75 10             	push   0x10(%ebp)
+  80440d:	56                   	push   %esi
+  80440e:	53                   	push   %ebx
+  80440f:	e8 ff d1 ff ff       	call   801613 <sys_futex_wait>
+  804414:	89 c6                	mov    %eax,%esi
+  804416:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80441b:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804420:	89 3c 24             	mov    %edi,(%esp)
+  804423:	e8 13 ff ff ff       	call   80433b <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804428:	83 c4 10             	add    $0x10,%esp
+  80442b:	83 fe ef             	cmp    $0xffffffef,%esi
+  80442e:	74 05                	je     804435 <cond_timedwait+0x4f>
+  804430:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804435:	89 f0                	mov    %esi,%eax
+  804437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80443a:	5b                   	pop    %ebx
+  80443b:	5e                   	pop    %esi
+  80443c:	5f                   	pop    %edi
+  80443d:	5d                   	pop    %ebp
+  80443e:	c3                   	ret
+
+0080443f <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80443f:	55                   	push   %ebp
+  804440:	89 e5                	mov    %esp,%ebp
+  804442:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804445:	6a ff                	push   $0xffffffff
+  804447:	ff 75 0c             	push   0xc(%ebp)
+  80444a:	ff 75 08             	push   0x8(%ebp)
+  80444d:	e8 94 ff ff ff       	call   8043e6 <cond_timedwait>
+}
+  804452:	83 c4 10             	add    $0x10,%esp
+  804455:	c9                   	leave
+  804456:	c3                   	ret
+
+00804457 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804457:	55                   	push   %ebp
+  804458:	89 e5                	mov    %esp,%ebp
+  80445a:	83 ec 08             	sub    $0x8,%esp
+  80445d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804460:	ba 01 00 00 00       	mov    $0x1,%edx
+  804465:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804469:	8b 50 04             	mov    0x4(%eax),%edx
+  80446c:	85 d2                	test   %edx,%edx
+  80446e:	75 02                	jne    804472 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  804470:	c9                   	leave
+  804471:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804472:	83 ec 08             	sub    $0x8,%esp
+  804475:	6a 01                	push   $0x1
+  804477:	50                   	push   %eax
+  804478:	e8 b8 d1 ff ff       	call   801635 <sys_futex_wake>
+  80447d:	83 c4 10             	add    $0x10,%esp
+}
+  804480:	eb ee                	jmp    804470 <cond_signal+0x19>
+
+00804482 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804482:	55                   	push   %ebp
+  804483:	89 e5                	mov    %esp,%ebp
+  804485:	83 ec 08             	sub    $0x8,%esp
+  804488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80448b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804490:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804494:	8b 50 04             	mov    0x4(%eax),%edx
+  804497:	85 d2                	test   %edx,%edx
+  804499:	75 02                	jne    80449d <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  80449b:	c9                   	leave
+  80449c:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  80449d:	83 ec 08             	sub    $0x8,%esp
+  8044a0:	68 00 04 00 00       	push   $0x400
+  8044a5:	50                   	push   %eax
+  8044a6:	e8 8a d1 ff ff       	call   801635 <sys_futex_wake>
+  8044ab:	83 c4 10             	add    $0x10,%esp
+}
+  8044ae:	eb eb                	jmp    80449b <cond_broadcast+0x19>
+
+008044b0 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8044b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b5:	c3                   	ret
+
+008044b6 <devcons_poll>:
+{
+  8044b6:	55                   	push   %ebp
+  8044b7:	89 e5                	mov    %esp,%ebp
+  8044b9:	53                   	push   %ebx
+  8044ba:	83 ec 04             	sub    $0x4,%esp
+  8044bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8044c0:	89 da                	mov    %ebx,%edx
+  8044c2:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8044c5:	83 3d 14 7a 80 00 00 	cmpl   $0x0,0x807a14
+  8044cc:	74 0c                	je     8044da <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8044ce:	89 d8                	mov    %ebx,%eax
+  8044d0:	83 e0 01             	and    $0x1,%eax
+  8044d3:	09 d0                	or     %edx,%eax
+}
+  8044d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8044d8:	c9                   	leave
+  8044d9:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8044da:	e8 98 cc ff ff       	call   801177 <sys_cgetc>
+  8044df:	a3 14 7a 80 00       	mov    %eax,0x807a14
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8044e4:	89 da                	mov    %ebx,%edx
+  8044e6:	83 e2 04             	and    $0x4,%edx
+  8044e9:	85 c0                	test   %eax,%eax
+  8044eb:	74 e6                	je     8044d3 <devcons_poll+0x1d>
+  8044ed:	eb df                	jmp    8044ce <devcons_poll+0x18>
+
+008044ef <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8044ef:	55                   	push   %ebp
+  8044f0:	89 e5                	mov    %esp,%ebp
+  8044f2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8044f5:	68 4e 53 80 00       	push   $0x80534e
+  8044fa:	ff 75 0c             	push   0xc(%ebp)
+  8044fd:	e8 df c8 ff ff       	call   800de1 <strcpy>
+	return 0;
+}
+  804502:	b8 00 00 00 00       	mov    $0x0,%eax
+  804507:	c9                   	leave
+  804508:	c3                   	ret
+
+00804509 <devcons_write>:
+{
+  804509:	55                   	push   %ebp
+  80450a:	89 e5                	mov    %esp,%ebp
+  80450c:	57                   	push   %edi
+  80450d:	56                   	push   %esi
+  80450e:	53                   	push   %ebx
+  80450f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804515:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804518:	85 ff                	test   %edi,%edi
+  80451a:	74 51                	je     80456d <devcons_write+0x64>
+  80451c:	be 00 00 00 00       	mov    $0x0,%esi
+  804521:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804526:	89 fb                	mov    %edi,%ebx
+  804528:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80452a:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80452f:	39 d3                	cmp    %edx,%ebx
+  804531:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804534:	83 ec 04             	sub    $0x4,%esp
+  804537:	53                   	push   %ebx
+  804538:	03 45 0c             	add    0xc(%ebp),%eax
+  80453b:	50                   	push   %eax
+  80453c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804542:	50                   	push   %eax
+  804543:	e8 49 ca ff ff       	call   800f91 <memmove>
+		sys_cputs(buf, m);
+  804548:	83 c4 08             	add    $0x8,%esp
+  80454b:	53                   	push   %ebx
+  80454c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804552:	50                   	push   %eax
+  804553:	e8 01 cc ff ff       	call   801159 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804558:	01 de                	add    %ebx,%esi
+  80455a:	89 f0                	mov    %esi,%eax
+  80455c:	83 c4 10             	add    $0x10,%esp
+  80455f:	39 fe                	cmp    %edi,%esi
+  804561:	72 c3                	jb     804526 <devcons_write+0x1d>
+}
+  804563:	89 f0                	mov    %esi,%eax
+  804565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804568:	5b                   	pop    %ebx
+  804569:	5e                   	pop    %esi
+  80456a:	5f                   	pop    %edi
+  80456b:	5d                   	pop    %ebp
+  80456c:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80456d:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804572:	eb ef                	jmp    804563 <devcons_write+0x5a>
+
+00804574 <devcons_read>:
+{
+  804574:	55                   	push   %ebp
+  804575:	89 e5                	mov    %esp,%ebp
+  804577:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80457a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80457f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804583:	74 36                	je     8045bb <devcons_read+0x47>
+	c = cons_peek;
+  804585:	a1 14 7a 80 00       	mov    0x807a14,%eax
+	cons_peek = 0;
+  80458a:	c7 05 14 7a 80 00 00 	movl   $0x0,0x807a14
+  804591:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804594:	85 c0                	test   %eax,%eax
+  804596:	75 10                	jne    8045a8 <devcons_read+0x34>
+  804598:	e8 da cb ff ff       	call   801177 <sys_cgetc>
+  80459d:	85 c0                	test   %eax,%eax
+  80459f:	75 07                	jne    8045a8 <devcons_read+0x34>
+		sys_yield();
+  8045a1:	e8 50 cc ff ff       	call   8011f6 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8045a6:	eb f0                	jmp    804598 <devcons_read+0x24>
+	if (c < 0)
+  8045a8:	85 c0                	test   %eax,%eax
+  8045aa:	78 0f                	js     8045bb <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8045ac:	83 f8 04             	cmp    $0x4,%eax
+  8045af:	74 0c                	je     8045bd <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8045b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8045b4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8045b6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8045bb:	c9                   	leave
+  8045bc:	c3                   	ret
+		return 0;
+  8045bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c2:	eb f7                	jmp    8045bb <devcons_read+0x47>
+
+008045c4 <cputchar>:
+{
+  8045c4:	55                   	push   %ebp
+  8045c5:	89 e5                	mov    %esp,%ebp
+  8045c7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8045ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045cd:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8045d0:	6a 01                	push   $0x1
+  8045d2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8045d5:	50                   	push   %eax
+  8045d6:	e8 7e cb ff ff       	call   801159 <sys_cputs>
+}
+  8045db:	83 c4 10             	add    $0x10,%esp
+  8045de:	c9                   	leave
+  8045df:	c3                   	ret
+
+008045e0 <getchar>:
+{
+  8045e0:	55                   	push   %ebp
+  8045e1:	89 e5                	mov    %esp,%ebp
+  8045e3:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8045e6:	6a 01                	push   $0x1
+  8045e8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8045eb:	50                   	push   %eax
+  8045ec:	6a 00                	push   $0x0
+  8045ee:	e8 34 de ff ff       	call   802427 <read>
+	if (r < 0)
+  8045f3:	83 c4 10             	add    $0x10,%esp
+  8045f6:	85 c0                	test   %eax,%eax
+  8045f8:	78 06                	js     804600 <getchar+0x20>
+	if (r < 1)
+  8045fa:	74 06                	je     804602 <getchar+0x22>
+	return c;
+  8045fc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804600:	c9                   	leave
+  804601:	c3                   	ret
+		return -E_EOF;
+  804602:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804607:	eb f7                	jmp    804600 <getchar+0x20>
+
+00804609 <iscons>:
+{
+  804609:	55                   	push   %ebp
+  80460a:	89 e5                	mov    %esp,%ebp
+  80460c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80460f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804612:	50                   	push   %eax
+  804613:	ff 75 08             	push   0x8(%ebp)
+  804616:	e8 88 db ff ff       	call   8021a3 <fd_lookup>
+  80461b:	83 c4 10             	add    $0x10,%esp
+  80461e:	85 c0                	test   %eax,%eax
+  804620:	78 11                	js     804633 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804622:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804625:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  80462b:	39 10                	cmp    %edx,(%eax)
+  80462d:	0f 94 c0             	sete   %al
+  804630:	0f b6 c0             	movzbl %al,%eax
+}
+  804633:	c9                   	leave
+  804634:	c3                   	ret
+
+00804635 <opencons>:
+{
+  804635:	55                   	push   %ebp
+  804636:	89 e5                	mov    %esp,%ebp
+  804638:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80463b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80463e:	50                   	push   %eax
+  80463f:	e8 0f db ff ff       	call   802153 <fd_alloc>
+  804644:	83 c4 10             	add    $0x10,%esp
+  804647:	85 c0                	test   %eax,%eax
+  804649:	78 3a                	js     804685 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80464b:	83 ec 04             	sub    $0x4,%esp
+  80464e:	68 07 04 00 00       	push   $0x407
+  804653:	ff 75 f4             	push   -0xc(%ebp)
+  804656:	6a 00                	push   $0x0
+  804658:	e8 b8 cb ff ff       	call   801215 <sys_page_alloc>
+  80465d:	83 c4 10             	add    $0x10,%esp
+  804660:	85 c0                	test   %eax,%eax
+  804662:	78 21                	js     804685 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804664:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804667:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  80466d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80466f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804672:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804679:	83 ec 0c             	sub    $0xc,%esp
+  80467c:	50                   	push   %eax
+  80467d:	e8 aa da ff ff       	call   80212c <fd2num>
+  804682:	83 c4 10             	add    $0x10,%esp
+}
+  804685:	c9                   	leave
+  804686:	c3                   	ret
+
+00804687 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804687:	55                   	push   %ebp
+  804688:	89 e5                	mov    %esp,%ebp
+  80468a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80468d:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804694:	74 0a                	je     8046a0 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804696:	8b 45 08             	mov    0x8(%ebp),%eax
+  804699:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  80469e:	c9                   	leave
+  80469f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8046a0:	83 ec 04             	sub    $0x4,%esp
+  8046a3:	6a 07                	push   $0x7
+  8046a5:	68 00 f0 bf ee       	push   $0xeebff000
+  8046aa:	6a 00                	push   $0x0
+  8046ac:	e8 64 cb ff ff       	call   801215 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8046b1:	83 c4 08             	add    $0x8,%esp
+  8046b4:	68 c5 46 80 00       	push   $0x8046c5
+  8046b9:	6a 00                	push   $0x0
+  8046bb:	e8 a0 cc ff ff       	call   801360 <sys_env_set_pgfault_upcall>
+  8046c0:	83 c4 10             	add    $0x10,%esp
+  8046c3:	eb d1                	jmp    804696 <set_pgfault_handler+0xf>
+
+008046c5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8046c5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8046c6:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8046cb:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8046cd:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  8046d0:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  8046d4:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  8046d7:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  8046db:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  8046dd:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8046e1:	83 c4 08             	add    $0x8,%esp
+	popal;
+  8046e4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8046e5:	83 c4 04             	add    $0x4,%esp
+	popf
+  8046e8:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  8046e9:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  8046ea:	c3                   	ret
+
+008046eb <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8046eb:	55                   	push   %ebp
+  8046ec:	89 e5                	mov    %esp,%ebp
+  8046ee:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8046f1:	89 c2                	mov    %eax,%edx
+  8046f3:	c1 ea 16             	shr    $0x16,%edx
+  8046f6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8046fd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804702:	f6 c1 01             	test   $0x1,%cl
+  804705:	74 1e                	je     804725 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804707:	c1 e8 0c             	shr    $0xc,%eax
+  80470a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804711:	a8 01                	test   $0x1,%al
+  804713:	74 10                	je     804725 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804715:	c1 e8 0c             	shr    $0xc,%eax
+  804718:	c1 e0 04             	shl    $0x4,%eax
+  80471b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804722:	0f b7 d2             	movzwl %dx,%edx
+}
+  804725:	89 d0                	mov    %edx,%eax
+  804727:	5d                   	pop    %ebp
+  804728:	c3                   	ret
+
+00804729 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  804729:	55                   	push   %ebp
+  80472a:	89 e5                	mov    %esp,%ebp
+  80472c:	57                   	push   %edi
+  80472d:	56                   	push   %esi
+  80472e:	53                   	push   %ebx
+  80472f:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  804732:	8b 45 08             	mov    0x8(%ebp),%eax
+  804735:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  804738:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  80473b:	bf 18 7a 80 00       	mov    $0x807a18,%edi
+  804740:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  804743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804748:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80474b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  80474e:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  804753:	f6 e2                	mul    %dl
+  804755:	66 c1 e8 0b          	shr    $0xb,%ax
+  804759:	89 c7                	mov    %eax,%edi
+  80475b:	88 45 e0             	mov    %al,-0x20(%ebp)
+  80475e:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  804761:	01 db                	add    %ebx,%ebx
+  804763:	89 d0                	mov    %edx,%eax
+  804765:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  804767:	89 d6                	mov    %edx,%esi
+  804769:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  80476b:	89 cb                	mov    %ecx,%ebx
+  80476d:	83 c1 01             	add    $0x1,%ecx
+  804770:	0f b6 fb             	movzbl %bl,%edi
+  804773:	83 c0 30             	add    $0x30,%eax
+  804776:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  80477a:	89 f0                	mov    %esi,%eax
+  80477c:	3c 09                	cmp    $0x9,%al
+  80477e:	77 ce                	ja     80474e <inet_ntoa+0x25>
+  804780:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804783:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  804786:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  804788:	84 c9                	test   %cl,%cl
+  80478a:	74 4d                	je     8047d9 <inet_ntoa+0xb0>
+  80478c:	0f b6 db             	movzbl %bl,%ebx
+  80478f:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  804792:	01 d8                	add    %ebx,%eax
+  804794:	89 f9                	mov    %edi,%ecx
+  804796:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  804799:	83 c1 01             	add    $0x1,%ecx
+  80479c:	0f b6 10             	movzbl (%eax),%edx
+  80479f:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  8047a2:	89 c2                	mov    %eax,%edx
+  8047a4:	83 e8 01             	sub    $0x1,%eax
+  8047a7:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  8047aa:	39 da                	cmp    %ebx,%edx
+  8047ac:	75 eb                	jne    804799 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  8047ae:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8047b1:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  8047b5:	8d 78 01             	lea    0x1(%eax),%edi
+  8047b8:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  8047bb:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  8047be:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8047c1:	39 ce                	cmp    %ecx,%esi
+  8047c3:	0f 85 77 ff ff ff    	jne    804740 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  8047c9:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  8047cc:	b8 18 7a 80 00       	mov    $0x807a18,%eax
+  8047d1:	83 c4 1c             	add    $0x1c,%esp
+  8047d4:	5b                   	pop    %ebx
+  8047d5:	5e                   	pop    %esi
+  8047d6:	5f                   	pop    %edi
+  8047d7:	5d                   	pop    %ebp
+  8047d8:	c3                   	ret
+    while(i--)
+  8047d9:	89 f8                	mov    %edi,%eax
+  8047db:	eb d8                	jmp    8047b5 <inet_ntoa+0x8c>
+
+008047dd <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8047dd:	55                   	push   %ebp
+  8047de:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8047e0:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8047e4:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8047e8:	5d                   	pop    %ebp
+  8047e9:	c3                   	ret
+
+008047ea <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8047ea:	55                   	push   %ebp
+  8047eb:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8047ed:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8047f1:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8047f5:	5d                   	pop    %ebp
+  8047f6:	c3                   	ret
+
+008047f7 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8047f7:	55                   	push   %ebp
+  8047f8:	89 e5                	mov    %esp,%ebp
+  8047fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8047fd:	89 d0                	mov    %edx,%eax
+  8047ff:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  804802:	89 d1                	mov    %edx,%ecx
+  804804:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  804807:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  804809:	89 d1                	mov    %edx,%ecx
+  80480b:	c1 e1 08             	shl    $0x8,%ecx
+  80480e:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  804814:	09 c8                	or     %ecx,%eax
+  804816:	c1 ea 08             	shr    $0x8,%edx
+  804819:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  80481f:	09 d0                	or     %edx,%eax
+}
+  804821:	5d                   	pop    %ebp
+  804822:	c3                   	ret
+
+00804823 <inet_aton>:
+{
+  804823:	55                   	push   %ebp
+  804824:	89 e5                	mov    %esp,%ebp
+  804826:	57                   	push   %edi
+  804827:	56                   	push   %esi
+  804828:	53                   	push   %ebx
+  804829:	83 ec 2c             	sub    $0x2c,%esp
+  80482c:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  80482f:	0f b6 0a             	movzbl (%edx),%ecx
+  804832:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  804835:	83 e9 30             	sub    $0x30,%ecx
+  804838:	80 f9 09             	cmp    $0x9,%cl
+  80483b:	0f 87 b6 01 00 00    	ja     8049f7 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  804841:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  804844:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  804847:	e9 aa 00 00 00       	jmp    8048f6 <inet_aton+0xd3>
+      c = *++cp;
+  80484c:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  804850:	89 c1                	mov    %eax,%ecx
+  804852:	83 e1 df             	and    $0xffffffdf,%ecx
+  804855:	80 f9 58             	cmp    $0x58,%cl
+  804858:	74 10                	je     80486a <inet_aton+0x47>
+      c = *++cp;
+  80485a:	83 c2 01             	add    $0x1,%edx
+  80485d:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  804860:	bf 08 00 00 00       	mov    $0x8,%edi
+  804865:	e9 9a 00 00 00       	jmp    804904 <inet_aton+0xe1>
+        c = *++cp;
+  80486a:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  80486e:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  804871:	bf 10 00 00 00       	mov    $0x10,%edi
+  804876:	e9 89 00 00 00       	jmp    804904 <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  80487b:	0f af d7             	imul   %edi,%edx
+  80487e:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  804882:	0f be 01             	movsbl (%ecx),%eax
+  804885:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  804888:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80488b:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  80488e:	80 fb 09             	cmp    $0x9,%bl
+  804891:	76 e8                	jbe    80487b <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  804893:	83 ff 10             	cmp    $0x10,%edi
+  804896:	75 2e                	jne    8048c6 <inet_aton+0xa3>
+  804898:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80489c:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80489f:	83 e3 df             	and    $0xffffffdf,%ebx
+  8048a2:	83 eb 41             	sub    $0x41,%ebx
+  8048a5:	80 fb 05             	cmp    $0x5,%bl
+  8048a8:	77 1c                	ja     8048c6 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  8048aa:	c1 e2 04             	shl    $0x4,%edx
+  8048ad:	83 c0 0a             	add    $0xa,%eax
+  8048b0:	89 f3                	mov    %esi,%ebx
+  8048b2:	80 fb 1a             	cmp    $0x1a,%bl
+  8048b5:	19 db                	sbb    %ebx,%ebx
+  8048b7:	83 e3 20             	and    $0x20,%ebx
+  8048ba:	83 c3 41             	add    $0x41,%ebx
+  8048bd:	29 d8                	sub    %ebx,%eax
+  8048bf:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  8048c1:	0f be 01             	movsbl (%ecx),%eax
+  8048c4:	eb bf                	jmp    804885 <inet_aton+0x62>
+    if (c == '.') {
+  8048c6:	83 f8 2e             	cmp    $0x2e,%eax
+  8048c9:	75 46                	jne    804911 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  8048cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8048ce:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8048d1:	39 f0                	cmp    %esi,%eax
+  8048d3:	0f 84 25 01 00 00    	je     8049fe <inet_aton+0x1db>
+      *pp++ = val;
+  8048d9:	83 c0 04             	add    $0x4,%eax
+  8048dc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8048df:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  8048e2:	89 ca                	mov    %ecx,%edx
+  8048e4:	0f b6 09             	movzbl (%ecx),%ecx
+  8048e7:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  8048ea:	83 e9 30             	sub    $0x30,%ecx
+  8048ed:	80 f9 09             	cmp    $0x9,%cl
+  8048f0:	0f 87 17 01 00 00    	ja     804a0d <inet_aton+0x1ea>
+    base = 10;
+  8048f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8048fb:	83 f8 30             	cmp    $0x30,%eax
+  8048fe:	0f 84 48 ff ff ff    	je     80484c <inet_aton+0x29>
+  804904:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  804907:	ba 00 00 00 00       	mov    $0x0,%edx
+  80490c:	e9 77 ff ff ff       	jmp    804888 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804911:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  804915:	89 d6                	mov    %edx,%esi
+  804917:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80491a:	85 c0                	test   %eax,%eax
+  80491c:	74 2e                	je     80494c <inet_aton+0x129>
+    return (0);
+  80491e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804923:	89 fa                	mov    %edi,%edx
+  804925:	80 fa 1f             	cmp    $0x1f,%dl
+  804928:	0f 86 d5 00 00 00    	jbe    804a03 <inet_aton+0x1e0>
+  80492e:	84 c0                	test   %al,%al
+  804930:	0f 88 cd 00 00 00    	js     804a03 <inet_aton+0x1e0>
+  804936:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  804939:	83 f9 04             	cmp    $0x4,%ecx
+  80493c:	76 0e                	jbe    80494c <inet_aton+0x129>
+    return (0);
+  80493e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804943:	83 f8 20             	cmp    $0x20,%eax
+  804946:	0f 85 b7 00 00 00    	jne    804a03 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  80494c:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  80494f:	89 d8                	mov    %ebx,%eax
+  804951:	29 c8                	sub    %ecx,%eax
+  804953:	c1 f8 02             	sar    $0x2,%eax
+  804956:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  804959:	83 f8 02             	cmp    $0x2,%eax
+  80495c:	74 7a                	je     8049d8 <inet_aton+0x1b5>
+  80495e:	83 f9 03             	cmp    $0x3,%ecx
+  804961:	7f 49                	jg     8049ac <inet_aton+0x189>
+  804963:	85 c9                	test   %ecx,%ecx
+  804965:	0f 84 98 00 00 00    	je     804a03 <inet_aton+0x1e0>
+  80496b:	83 f9 02             	cmp    $0x2,%ecx
+  80496e:	75 19                	jne    804989 <inet_aton+0x166>
+      return (0);
+  804970:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  804975:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80497b:	0f 87 82 00 00 00    	ja     804a03 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  804981:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  804984:	c1 e0 18             	shl    $0x18,%eax
+  804987:	09 c6                	or     %eax,%esi
+  return (1);
+  804989:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80498e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804992:	74 6f                	je     804a03 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  804994:	83 ec 0c             	sub    $0xc,%esp
+  804997:	56                   	push   %esi
+  804998:	e8 5a fe ff ff       	call   8047f7 <htonl>
+  80499d:	83 c4 10             	add    $0x10,%esp
+  8049a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8049a3:	89 06                	mov    %eax,(%esi)
+  return (1);
+  8049a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8049aa:	eb 57                	jmp    804a03 <inet_aton+0x1e0>
+  switch (n) {
+  8049ac:	83 f9 04             	cmp    $0x4,%ecx
+  8049af:	75 d8                	jne    804989 <inet_aton+0x166>
+      return (0);
+  8049b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  8049b6:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  8049bc:	77 45                	ja     804a03 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  8049be:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8049c1:	c1 e0 18             	shl    $0x18,%eax
+  8049c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8049c7:	c1 e1 10             	shl    $0x10,%ecx
+  8049ca:	09 c8                	or     %ecx,%eax
+  8049cc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8049cf:	c1 e1 08             	shl    $0x8,%ecx
+  8049d2:	09 c8                	or     %ecx,%eax
+  8049d4:	09 c6                	or     %eax,%esi
+    break;
+  8049d6:	eb b1                	jmp    804989 <inet_aton+0x166>
+      return (0);
+  8049d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  8049dd:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8049e3:	77 1e                	ja     804a03 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8049e5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8049e8:	c1 e0 18             	shl    $0x18,%eax
+  8049eb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8049ee:	c1 e1 10             	shl    $0x10,%ecx
+  8049f1:	09 c8                	or     %ecx,%eax
+  8049f3:	09 c6                	or     %eax,%esi
+    break;
+  8049f5:	eb 92                	jmp    804989 <inet_aton+0x166>
+      return (0);
+  8049f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8049fc:	eb 05                	jmp    804a03 <inet_aton+0x1e0>
+        return (0);
+  8049fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  804a03:	89 c8                	mov    %ecx,%eax
+  804a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a08:	5b                   	pop    %ebx
+  804a09:	5e                   	pop    %esi
+  804a0a:	5f                   	pop    %edi
+  804a0b:	5d                   	pop    %ebp
+  804a0c:	c3                   	ret
+      return (0);
+  804a0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a12:	eb ef                	jmp    804a03 <inet_aton+0x1e0>
+
+00804a14 <inet_addr>:
+{
+  804a14:	55                   	push   %ebp
+  804a15:	89 e5                	mov    %esp,%ebp
+  804a17:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  804a1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804a1d:	50                   	push   %eax
+  804a1e:	ff 75 08             	push   0x8(%ebp)
+  804a21:	e8 fd fd ff ff       	call   804823 <inet_aton>
+  804a26:	89 c2                	mov    %eax,%edx
+  804a28:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  804a2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  804a30:	85 d2                	test   %edx,%edx
+  804a32:	75 02                	jne    804a36 <inet_addr+0x22>
+}
+  804a34:	c9                   	leave
+  804a35:	c3                   	ret
+    return (val.s_addr);
+  804a36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804a39:	eb f9                	jmp    804a34 <inet_addr+0x20>
+
+00804a3b <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  804a3b:	55                   	push   %ebp
+  804a3c:	89 e5                	mov    %esp,%ebp
+  804a3e:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  804a41:	ff 75 08             	push   0x8(%ebp)
+  804a44:	e8 ae fd ff ff       	call   8047f7 <htonl>
+  804a49:	83 c4 10             	add    $0x10,%esp
+}
+  804a4c:	c9                   	leave
+  804a4d:	c3                   	ret
+
+00804a4e <__udivdi3>:
+  804a4e:	57                   	push   %edi
+  804a4f:	56                   	push   %esi
+  804a50:	53                   	push   %ebx
+  804a51:	83 ec 20             	sub    $0x20,%esp
+  804a54:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804a58:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804a5c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804a60:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804a64:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804a68:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804a6c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804a70:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804a74:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804a79:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a83:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804a8a:	00 
+  804a8b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804a92:	00 
+  804a93:	eb 08                	jmp    804a9d <__udivdi3+0x4f>
+  804a95:	83 e9 01             	sub    $0x1,%ecx
+  804a98:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804a9b:	74 68                	je     804b05 <__udivdi3+0xb7>
+  804a9d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804aa1:	01 c0                	add    %eax,%eax
+  804aa3:	89 c6                	mov    %eax,%esi
+  804aa5:	89 d7                	mov    %edx,%edi
+  804aa7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804aab:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804aaf:	0f ad d0             	shrd   %cl,%edx,%eax
+  804ab2:	d3 ea                	shr    %cl,%edx
+  804ab4:	f6 c1 20             	test   $0x20,%cl
+  804ab7:	74 04                	je     804abd <__udivdi3+0x6f>
+  804ab9:	89 d0                	mov    %edx,%eax
+  804abb:	31 d2                	xor    %edx,%edx
+  804abd:	83 e0 01             	and    $0x1,%eax
+  804ac0:	89 04 24             	mov    %eax,(%esp)
+  804ac3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804aca:	00 
+  804acb:	8b 04 24             	mov    (%esp),%eax
+  804ace:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804ad2:	09 f0                	or     %esi,%eax
+  804ad4:	09 fa                	or     %edi,%edx
+  804ad6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804ada:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804ade:	39 f0                	cmp    %esi,%eax
+  804ae0:	89 d3                	mov    %edx,%ebx
+  804ae2:	19 fb                	sbb    %edi,%ebx
+  804ae4:	72 af                	jb     804a95 <__udivdi3+0x47>
+  804ae6:	29 f0                	sub    %esi,%eax
+  804ae8:	19 fa                	sbb    %edi,%edx
+  804aea:	89 cf                	mov    %ecx,%edi
+  804aec:	c1 ef 05             	shr    $0x5,%edi
+  804aef:	83 e7 01             	and    $0x1,%edi
+  804af2:	89 fe                	mov    %edi,%esi
+  804af4:	83 f6 01             	xor    $0x1,%esi
+  804af7:	d3 e6                	shl    %cl,%esi
+  804af9:	d3 e7                	shl    %cl,%edi
+  804afb:	09 74 24 18          	or     %esi,0x18(%esp)
+  804aff:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804b03:	eb 90                	jmp    804a95 <__udivdi3+0x47>
+  804b05:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b09:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b0d:	83 c4 20             	add    $0x20,%esp
+  804b10:	5b                   	pop    %ebx
+  804b11:	5e                   	pop    %esi
+  804b12:	5f                   	pop    %edi
+  804b13:	c3                   	ret
+
+00804b14 <__umoddi3>:
+  804b14:	57                   	push   %edi
+  804b15:	56                   	push   %esi
+  804b16:	53                   	push   %ebx
+  804b17:	83 ec 08             	sub    $0x8,%esp
+  804b1a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b1e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b22:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804b26:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804b2a:	57                   	push   %edi
+  804b2b:	56                   	push   %esi
+  804b2c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804b30:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804b34:	52                   	push   %edx
+  804b35:	50                   	push   %eax
+  804b36:	e8 13 ff ff ff       	call   804a4e <__udivdi3>
+  804b3b:	89 c3                	mov    %eax,%ebx
+  804b3d:	0f af d6             	imul   %esi,%edx
+  804b40:	89 f9                	mov    %edi,%ecx
+  804b42:	0f af cb             	imul   %ebx,%ecx
+  804b45:	01 d1                	add    %edx,%ecx
+  804b47:	89 d8                	mov    %ebx,%eax
+  804b49:	f7 e6                	mul    %esi
+  804b4b:	89 c6                	mov    %eax,%esi
+  804b4d:	89 d7                	mov    %edx,%edi
+  804b4f:	01 cf                	add    %ecx,%edi
+  804b51:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804b55:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804b59:	29 f0                	sub    %esi,%eax
+  804b5b:	19 fa                	sbb    %edi,%edx
+  804b5d:	83 c4 18             	add    $0x18,%esp
+  804b60:	5b                   	pop    %ebx
+  804b61:	5e                   	pop    %esi
+  804b62:	5f                   	pop    %edi
+  804b63:	c3                   	ret
+
+00804b64 <__divdi3>:
+  804b64:	53                   	push   %ebx
+  804b65:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804b69:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804b6d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804b71:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804b75:	85 d2                	test   %edx,%edx
+  804b77:	78 12                	js     804b8b <__divdi3+0x27>
+  804b79:	85 db                	test   %ebx,%ebx
+  804b7b:	78 2e                	js     804bab <__divdi3+0x47>
+  804b7d:	53                   	push   %ebx
+  804b7e:	51                   	push   %ecx
+  804b7f:	52                   	push   %edx
+  804b80:	50                   	push   %eax
+  804b81:	e8 c8 fe ff ff       	call   804a4e <__udivdi3>
+  804b86:	83 c4 10             	add    $0x10,%esp
+  804b89:	eb 1e                	jmp    804ba9 <__divdi3+0x45>
+  804b8b:	f7 d8                	neg    %eax
+  804b8d:	83 d2 00             	adc    $0x0,%edx
+  804b90:	f7 da                	neg    %edx
+  804b92:	85 db                	test   %ebx,%ebx
+  804b94:	78 2a                	js     804bc0 <__divdi3+0x5c>
+  804b96:	53                   	push   %ebx
+  804b97:	51                   	push   %ecx
+  804b98:	52                   	push   %edx
+  804b99:	50                   	push   %eax
+  804b9a:	e8 af fe ff ff       	call   804a4e <__udivdi3>
+  804b9f:	83 c4 10             	add    $0x10,%esp
+  804ba2:	f7 d8                	neg    %eax
+  804ba4:	83 d2 00             	adc    $0x0,%edx
+  804ba7:	f7 da                	neg    %edx
+  804ba9:	5b                   	pop    %ebx
+  804baa:	c3                   	ret
+  804bab:	f7 d9                	neg    %ecx
+  804bad:	83 d3 00             	adc    $0x0,%ebx
+  804bb0:	f7 db                	neg    %ebx
+  804bb2:	53                   	push   %ebx
+  804bb3:	51                   	push   %ecx
+  804bb4:	52                   	push   %edx
+  804bb5:	50                   	push   %eax
+  804bb6:	e8 93 fe ff ff       	call   804a4e <__udivdi3>
+  804bbb:	83 c4 10             	add    $0x10,%esp
+  804bbe:	eb e2                	jmp    804ba2 <__divdi3+0x3e>
+  804bc0:	f7 d9                	neg    %ecx
+  804bc2:	83 d3 00             	adc    $0x0,%ebx
+  804bc5:	f7 db                	neg    %ebx
+  804bc7:	53                   	push   %ebx
+  804bc8:	51                   	push   %ecx
+  804bc9:	52                   	push   %edx
+  804bca:	50                   	push   %eax
+  804bcb:	e8 7e fe ff ff       	call   804a4e <__udivdi3>
+  804bd0:	83 c4 10             	add    $0x10,%esp
+  804bd3:	eb d4                	jmp    804ba9 <__divdi3+0x45>
+
+00804bd5 <__moddi3>:
+  804bd5:	57                   	push   %edi
+  804bd6:	56                   	push   %esi
+  804bd7:	53                   	push   %ebx
+  804bd8:	83 ec 08             	sub    $0x8,%esp
+  804bdb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bdf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804be3:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804be7:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804beb:	57                   	push   %edi
+  804bec:	56                   	push   %esi
+  804bed:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804bf1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804bf5:	52                   	push   %edx
+  804bf6:	50                   	push   %eax
+  804bf7:	e8 68 ff ff ff       	call   804b64 <__divdi3>
+  804bfc:	89 c3                	mov    %eax,%ebx
+  804bfe:	0f af d6             	imul   %esi,%edx
+  804c01:	89 f9                	mov    %edi,%ecx
+  804c03:	0f af cb             	imul   %ebx,%ecx
+  804c06:	01 d1                	add    %edx,%ecx
+  804c08:	89 d8                	mov    %ebx,%eax
+  804c0a:	f7 e6                	mul    %esi
+  804c0c:	89 c6                	mov    %eax,%esi
+  804c0e:	89 d7                	mov    %edx,%edi
+  804c10:	01 cf                	add    %ecx,%edi
+  804c12:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804c16:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804c1a:	29 f0                	sub    %esi,%eax
+  804c1c:	19 fa                	sbb    %edi,%edx
+  804c1e:	83 c4 18             	add    $0x18,%esp
+  804c21:	5b                   	pop    %ebx
+  804c22:	5e                   	pop    %esi
+  804c23:	5f                   	pop    %edi
+  804c24:	c3                   	ret
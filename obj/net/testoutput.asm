@@ -0,0 +1,9269 @@
+
+obj/net/testoutput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 af 02 00 00       	call   8002e0 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+	envid_t ns_envid = sys_getenvid();
+  80003a:	e8 10 0f 00 00       	call   800f4f <sys_getenvid>
+  80003f:	89 c6                	mov    %eax,%esi
+	int i, r;
+
+	binaryname = "testoutput";
+  800041:	c7 05 00 50 80 00 80 	movl   $0x804680,0x805000
+  800048:	46 80 00 
+
+	output_envid = fork();
+  80004b:	e8 45 15 00 00       	call   801595 <fork>
+  800050:	a3 00 60 80 00       	mov    %eax,0x806000
+	//cprintf("output_envid = %d\n",output_envid);
+	//cprintf("output_envid status = %d\n", envs[ENVX(output_envid)].env_status);
+	if (output_envid < 0)
+  800055:	85 c0                	test   %eax,%eax
+  800057:	0f 88 93 00 00 00    	js     8000f0 <umain+0xbb>
+		return;
+	}
+//	cprintf("output_envid = %d\n",output_envid);
+//	cprintf("output_envid status = %d\n", envs[ENVX(output_envid)].env_status);
+
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  80005d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (output_envid == 0) {
+  800062:	0f 84 9c 00 00 00    	je     800104 <umain+0xcf>
+		if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  800068:	83 ec 04             	sub    $0x4,%esp
+  80006b:	6a 07                	push   $0x7
+  80006d:	68 00 b0 ea 0f       	push   $0xfeab000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 14 0f 00 00       	call   800f8d <sys_page_alloc>
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	85 c0                	test   %eax,%eax
+  80007e:	0f 88 8e 00 00 00    	js     800112 <umain+0xdd>
+			panic("sys_page_alloc: %e", r);
+		pkt->jp_len = snprintf(pkt->jp_data,
+  800084:	53                   	push   %ebx
+  800085:	68 bd 46 80 00       	push   $0x8046bd
+  80008a:	68 f8 0f 00 00       	push   $0xff8
+  80008f:	68 08 b0 ea 0f       	push   $0xfeab008
+  800094:	e8 5a 0a 00 00       	call   800af3 <snprintf>
+  800099:	a3 00 b0 ea 0f       	mov    %eax,0xfeab000
+				       PGSIZE - sizeof(*pkt),
+				       "Packet %02d", i);
+		cprintf("Transmitting packet %d\n", i);
+  80009e:	83 c4 08             	add    $0x8,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	68 c9 46 80 00       	push   $0x8046c9
+  8000a7:	e8 b6 03 00 00       	call   800462 <cprintf>
+		ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8000ac:	6a 07                	push   $0x7
+  8000ae:	68 00 b0 ea 0f       	push   $0xfeab000
+  8000b3:	6a 12                	push   $0x12
+  8000b5:	ff 35 00 60 80 00    	push   0x806000
+  8000bb:	e8 3c 1d 00 00       	call   801dfc <ipc_send>
+		sys_page_unmap(0, pkt);
+  8000c0:	83 c4 18             	add    $0x18,%esp
+  8000c3:	68 00 b0 ea 0f       	push   $0xfeab000
+  8000c8:	6a 00                	push   $0x0
+  8000ca:	e8 43 0f 00 00       	call   801012 <sys_page_unmap>
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  8000cf:	83 c3 01             	add    $0x1,%ebx
+  8000d2:	83 c4 10             	add    $0x10,%esp
+  8000d5:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d8:	75 8e                	jne    800068 <umain+0x33>
+  8000da:	bb 14 00 00 00       	mov    $0x14,%ebx
+	}
+
+	// Spin for a while, just in case IPC's or packets need to be flushed
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+		sys_yield();
+  8000df:	e8 8a 0e 00 00       	call   800f6e <sys_yield>
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  8000e4:	83 eb 01             	sub    $0x1,%ebx
+  8000e7:	75 f6                	jne    8000df <umain+0xaa>
+}
+  8000e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000ec:	5b                   	pop    %ebx
+  8000ed:	5e                   	pop    %esi
+  8000ee:	5d                   	pop    %ebp
+  8000ef:	c3                   	ret
+		panic("error forking");
+  8000f0:	83 ec 04             	sub    $0x4,%esp
+  8000f3:	68 8b 46 80 00       	push   $0x80468b
+  8000f8:	6a 18                	push   $0x18
+  8000fa:	68 99 46 80 00       	push   $0x804699
+  8000ff:	e8 83 02 00 00       	call   800387 <_panic>
+		output(ns_envid);
+  800104:	83 ec 0c             	sub    $0xc,%esp
+  800107:	56                   	push   %esi
+  800108:	e8 3c 01 00 00       	call   800249 <output>
+		return;
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	eb d7                	jmp    8000e9 <umain+0xb4>
+			panic("sys_page_alloc: %e", r);
+  800112:	50                   	push   %eax
+  800113:	68 aa 46 80 00       	push   $0x8046aa
+  800118:	6a 22                	push   $0x22
+  80011a:	68 99 46 80 00       	push   $0x804699
+  80011f:	e8 63 02 00 00       	call   800387 <_panic>
+
+00800124 <input>:
+	return pages[PGNUM(PTE_ADDR(pte))].pp_ref == 1;
+}
+
+void
+input(envid_t ns_envid)
+{
+  800124:	55                   	push   %ebp
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	57                   	push   %edi
+  800128:	56                   	push   %esi
+  800129:	53                   	push   %ebx
+  80012a:	83 ec 1c             	sub    $0x1c,%esp
+	binaryname = "ns_input";
+  80012d:	c7 05 00 50 80 00 e1 	movl   $0x8046e1,0x805000
+  800134:	46 80 00 
+	// each pool page again once the server has unmapped it.
+	int i, j, n, ret;
+	int perm = PTE_P | PTE_W | PTE_U;
+	void *va;
+
+	for (i = 0; ; i = (i + n) % RXPOOL_SIZE) {
+  800137:	bf 00 00 00 00       	mov    $0x0,%edi
+  80013c:	e9 c6 00 00 00       	jmp    800207 <input+0xe3>
+		n = MIN(RXBATCH, RXPOOL_SIZE - i);
+		for (j = i; j < i + n; j++) {
+			va = (void *) (RXPOOL + j * PGSIZE);
+			if (!rx_page_free(va)
+			    && (ret = sys_page_alloc(0, va, perm)) < 0)
+  800141:	83 ec 04             	sub    $0x4,%esp
+  800144:	6a 07                	push   $0x7
+  800146:	53                   	push   %ebx
+  800147:	6a 00                	push   $0x0
+  800149:	e8 3f 0e 00 00       	call   800f8d <sys_page_alloc>
+  80014e:	83 c4 10             	add    $0x10,%esp
+  800151:	85 c0                	test   %eax,%eax
+  800153:	78 46                	js     80019b <input+0x77>
+		for (j = i; j < i + n; j++) {
+  800155:	83 c6 01             	add    $0x1,%esi
+  800158:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80015e:	39 fe                	cmp    %edi,%esi
+  800160:	74 4b                	je     8001ad <input+0x89>
+	if (!(vpd[PDX(va)] & PTE_P) || !((pte = vpt[PGNUM(va)]) & PTE_P))
+  800162:	89 d8                	mov    %ebx,%eax
+  800164:	c1 e8 16             	shr    $0x16,%eax
+  800167:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80016e:	a8 01                	test   $0x1,%al
+  800170:	74 cf                	je     800141 <input+0x1d>
+  800172:	89 d8                	mov    %ebx,%eax
+  800174:	c1 e8 0c             	shr    $0xc,%eax
+  800177:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80017e:	a8 01                	test   $0x1,%al
+  800180:	74 bf                	je     800141 <input+0x1d>
+	return pages[PGNUM(PTE_ADDR(pte))].pp_ref == 1;
+  800182:	c1 e8 0c             	shr    $0xc,%eax
+  800185:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  800188:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80018f:	0f b7 40 04          	movzwl 0x4(%eax),%eax
+			if (!rx_page_free(va)
+  800193:	66 83 f8 01          	cmp    $0x1,%ax
+  800197:	74 bc                	je     800155 <input+0x31>
+  800199:	eb a6                	jmp    800141 <input+0x1d>
+				panic("sys_page_alloc: %e", ret);
+  80019b:	50                   	push   %eax
+  80019c:	68 aa 46 80 00       	push   $0x8046aa
+  8001a1:	6a 2d                	push   $0x2d
+  8001a3:	68 ea 46 80 00       	push   $0x8046ea
+  8001a8:	e8 da 01 00 00       	call   800387 <_panic>
+  8001ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8001b0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+		}
+
+		// Blocks until the card raises a receive interrupt.
+		if ((n = sys_net_recv_pages((void *) (RXPOOL + i * PGSIZE), n)) < 0)
+  8001b3:	83 ec 08             	sub    $0x8,%esp
+  8001b6:	52                   	push   %edx
+  8001b7:	8d 87 8b fe 00 00    	lea    0xfe8b(%edi),%eax
+  8001bd:	c1 e0 0c             	shl    $0xc,%eax
+  8001c0:	50                   	push   %eax
+  8001c1:	e8 dd 10 00 00       	call   8012a3 <sys_net_recv_pages>
+  8001c6:	83 c4 10             	add    $0x10,%esp
+  8001c9:	85 c0                	test   %eax,%eax
+  8001cb:	78 6a                	js     800237 <input+0x113>
+			panic("sys_net_recv_pages: %e", n);
+		for (j = i; j < i + n; j++)
+  8001cd:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8001d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001d3:	39 df                	cmp    %ebx,%edi
+  8001d5:	7d 1f                	jge    8001f6 <input+0xd2>
+			ipc_send(ns_envid, NSREQ_INPUT,
+  8001d7:	6a 07                	push   $0x7
+  8001d9:	89 f8                	mov    %edi,%eax
+  8001db:	c1 e0 0c             	shl    $0xc,%eax
+  8001de:	05 00 b0 e8 0f       	add    $0xfe8b000,%eax
+  8001e3:	50                   	push   %eax
+  8001e4:	6a 11                	push   $0x11
+  8001e6:	56                   	push   %esi
+  8001e7:	e8 10 1c 00 00       	call   801dfc <ipc_send>
+		for (j = i; j < i + n; j++)
+  8001ec:	83 c7 01             	add    $0x1,%edi
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	39 df                	cmp    %ebx,%edi
+  8001f4:	75 e1                	jne    8001d7 <input+0xb3>
+	for (i = 0; ; i = (i + n) % RXPOOL_SIZE) {
+  8001f6:	89 d8                	mov    %ebx,%eax
+  8001f8:	c1 f8 1f             	sar    $0x1f,%eax
+  8001fb:	c1 e8 1b             	shr    $0x1b,%eax
+  8001fe:	01 c3                	add    %eax,%ebx
+  800200:	83 e3 1f             	and    $0x1f,%ebx
+  800203:	89 df                	mov    %ebx,%edi
+  800205:	29 c7                	sub    %eax,%edi
+		n = MIN(RXBATCH, RXPOOL_SIZE - i);
+  800207:	ba 20 00 00 00       	mov    $0x20,%edx
+  80020c:	29 fa                	sub    %edi,%edx
+  80020e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800213:	39 c2                	cmp    %eax,%edx
+  800215:	0f 4f d0             	cmovg  %eax,%edx
+		for (j = i; j < i + n; j++) {
+  800218:	8d 04 17             	lea    (%edi,%edx,1),%eax
+  80021b:	39 c7                	cmp    %eax,%edi
+  80021d:	7d 94                	jge    8001b3 <input+0x8f>
+  80021f:	8d 9f 8b fe 00 00    	lea    0xfe8b(%edi),%ebx
+  800225:	c1 e3 0c             	shl    $0xc,%ebx
+  800228:	89 fe                	mov    %edi,%esi
+  80022a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80022d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800230:	89 c7                	mov    %eax,%edi
+  800232:	e9 2b ff ff ff       	jmp    800162 <input+0x3e>
+			panic("sys_net_recv_pages: %e", n);
+  800237:	50                   	push   %eax
+  800238:	68 f6 46 80 00       	push   $0x8046f6
+  80023d:	6a 32                	push   $0x32
+  80023f:	68 ea 46 80 00       	push   $0x8046ea
+  800244:	e8 3e 01 00 00       	call   800387 <_panic>
+
+00800249 <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  800249:	55                   	push   %ebp
+  80024a:	89 e5                	mov    %esp,%ebp
+  80024c:	56                   	push   %esi
+  80024d:	53                   	push   %ebx
+  80024e:	83 ec 10             	sub    $0x10,%esp
+  800251:	8b 75 08             	mov    0x8(%ebp),%esi
+	binaryname = "ns_output";
+  800254:	c7 05 00 50 80 00 0d 	movl   $0x80470d,0x805000
+  80025b:	47 80 00 
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+	int ret;
+	envid_t envid;
+	while(1) {
+		if ((ret = ipc_recv(&envid, &nsipcbuf, NULL)) < 0) 
+  80025e:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  800261:	eb 36                	jmp    800299 <output+0x50>
+			panic("ipc_recv: %e", ret);
+  800263:	50                   	push   %eax
+  800264:	68 17 47 80 00       	push   $0x804717
+  800269:	6a 14                	push   $0x14
+  80026b:	68 24 47 80 00       	push   $0x804724
+  800270:	e8 12 01 00 00       	call   800387 <_panic>
+		if ((envid != ns_envid) || (ret != NSREQ_OUTPUT))
+			panic("Invalid Request");
+
+		while ((ret = sys_net_transmit(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) == -E_DESC_FULL) {
+			sys_yield();
+  800275:	e8 f4 0c 00 00       	call   800f6e <sys_yield>
+		while ((ret = sys_net_transmit(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) == -E_DESC_FULL) {
+  80027a:	83 ec 08             	sub    $0x8,%esp
+  80027d:	ff 35 00 80 80 00    	push   0x808000
+  800283:	68 08 80 80 00       	push   $0x808008
+  800288:	e8 73 0f 00 00       	call   801200 <sys_net_transmit>
+  80028d:	83 c4 10             	add    $0x10,%esp
+  800290:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  800293:	74 e0                	je     800275 <output+0x2c>
+		}	
+		if (ret < 0)
+  800295:	85 c0                	test   %eax,%eax
+  800297:	78 35                	js     8002ce <output+0x85>
+		if ((ret = ipc_recv(&envid, &nsipcbuf, NULL)) < 0) 
+  800299:	83 ec 04             	sub    $0x4,%esp
+  80029c:	6a 00                	push   $0x0
+  80029e:	68 00 80 80 00       	push   $0x808000
+  8002a3:	53                   	push   %ebx
+  8002a4:	e8 c3 18 00 00       	call   801b6c <ipc_recv>
+  8002a9:	83 c4 10             	add    $0x10,%esp
+  8002ac:	85 c0                	test   %eax,%eax
+  8002ae:	78 b3                	js     800263 <output+0x1a>
+		if ((envid != ns_envid) || (ret != NSREQ_OUTPUT))
+  8002b0:	39 75 f4             	cmp    %esi,-0xc(%ebp)
+  8002b3:	75 05                	jne    8002ba <output+0x71>
+  8002b5:	83 f8 12             	cmp    $0x12,%eax
+  8002b8:	74 c0                	je     80027a <output+0x31>
+			panic("Invalid Request");
+  8002ba:	83 ec 04             	sub    $0x4,%esp
+  8002bd:	68 31 47 80 00       	push   $0x804731
+  8002c2:	6a 16                	push   $0x16
+  8002c4:	68 24 47 80 00       	push   $0x804724
+  8002c9:	e8 b9 00 00 00       	call   800387 <_panic>
+			panic("sys_net_transmit: %e", ret);
+  8002ce:	50                   	push   %eax
+  8002cf:	68 41 47 80 00       	push   $0x804741
+  8002d4:	6a 1c                	push   $0x1c
+  8002d6:	68 24 47 80 00       	push   $0x804724
+  8002db:	e8 a7 00 00 00       	call   800387 <_panic>
+
+008002e0 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	56                   	push   %esi
+  8002e4:	53                   	push   %ebx
+  8002e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8002eb:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8002ed:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8002f2:	29 d0                	sub    %edx,%eax
+  8002f4:	89 c2                	mov    %eax,%edx
+  8002f6:	c1 ea 0f             	shr    $0xf,%edx
+  8002f9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8002fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800303:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800306:	c7 04 85 20 6a 80 00 	movl   $0x0,0x806a20(,%eax,4)
+  80030d:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800311:	e8 39 0c 00 00       	call   800f4f <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800316:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80031b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800321:	89 e1                	mov    %esp,%ecx
+  800323:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800328:	29 ca                	sub    %ecx,%edx
+  80032a:	89 d1                	mov    %edx,%ecx
+  80032c:	c1 e9 0f             	shr    $0xf,%ecx
+  80032f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80033a:	0f 42 d1             	cmovb  %ecx,%edx
+  80033d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800342:	89 04 95 20 6a 80 00 	mov    %eax,0x806a20(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800349:	85 db                	test   %ebx,%ebx
+  80034b:	7e 07                	jle    800354 <libmain+0x74>
+		binaryname = argv[0];
+  80034d:	8b 06                	mov    (%esi),%eax
+  80034f:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800354:	83 ec 08             	sub    $0x8,%esp
+  800357:	56                   	push   %esi
+  800358:	53                   	push   %ebx
+  800359:	e8 d7 fc ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  80035e:	e8 0a 00 00 00       	call   80036d <exit>
+}
+  800363:	83 c4 10             	add    $0x10,%esp
+  800366:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800369:	5b                   	pop    %ebx
+  80036a:	5e                   	pop    %esi
+  80036b:	5d                   	pop    %ebp
+  80036c:	c3                   	ret
+
+0080036d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80036d:	55                   	push   %ebp
+  80036e:	89 e5                	mov    %esp,%ebp
+  800370:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800373:	e8 15 1d 00 00       	call   80208d <close_all>
+	sys_env_destroy(0);
+  800378:	83 ec 0c             	sub    $0xc,%esp
+  80037b:	6a 00                	push   $0x0
+  80037d:	e8 8c 0b 00 00       	call   800f0e <sys_env_destroy>
+}
+  800382:	83 c4 10             	add    $0x10,%esp
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+
+00800387 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	56                   	push   %esi
+  80038b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80038c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80038f:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800395:	e8 b5 0b 00 00       	call   800f4f <sys_getenvid>
+  80039a:	83 ec 0c             	sub    $0xc,%esp
+  80039d:	ff 75 0c             	push   0xc(%ebp)
+  8003a0:	ff 75 08             	push   0x8(%ebp)
+  8003a3:	56                   	push   %esi
+  8003a4:	50                   	push   %eax
+  8003a5:	68 60 47 80 00       	push   $0x804760
+  8003aa:	e8 b3 00 00 00       	call   800462 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003af:	83 c4 18             	add    $0x18,%esp
+  8003b2:	53                   	push   %ebx
+  8003b3:	ff 75 10             	push   0x10(%ebp)
+  8003b6:	e8 56 00 00 00       	call   800411 <vcprintf>
+	cprintf("\n");
+  8003bb:	c7 04 24 df 46 80 00 	movl   $0x8046df,(%esp)
+  8003c2:	e8 9b 00 00 00       	call   800462 <cprintf>
+  8003c7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003ca:	cc                   	int3
+	while (1)
+  8003cb:	eb fd                	jmp    8003ca <_panic+0x43>
+
+008003cd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003cd:	55                   	push   %ebp
+  8003ce:	89 e5                	mov    %esp,%ebp
+  8003d0:	53                   	push   %ebx
+  8003d1:	83 ec 04             	sub    $0x4,%esp
+  8003d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003d7:	8b 13                	mov    (%ebx),%edx
+  8003d9:	8d 42 01             	lea    0x1(%edx),%eax
+  8003dc:	89 03                	mov    %eax,(%ebx)
+  8003de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003e1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003e5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003ea:	74 09                	je     8003f5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003ec:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003f3:	c9                   	leave
+  8003f4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003f5:	83 ec 08             	sub    $0x8,%esp
+  8003f8:	68 ff 00 00 00       	push   $0xff
+  8003fd:	8d 43 08             	lea    0x8(%ebx),%eax
+  800400:	50                   	push   %eax
+  800401:	e8 cb 0a 00 00       	call   800ed1 <sys_cputs>
+		b->idx = 0;
+  800406:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80040c:	83 c4 10             	add    $0x10,%esp
+  80040f:	eb db                	jmp    8003ec <putch+0x1f>
+
+00800411 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800411:	55                   	push   %ebp
+  800412:	89 e5                	mov    %esp,%ebp
+  800414:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80041a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800421:	00 00 00 
+	b.cnt = 0;
+  800424:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80042b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80042e:	ff 75 0c             	push   0xc(%ebp)
+  800431:	ff 75 08             	push   0x8(%ebp)
+  800434:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80043a:	50                   	push   %eax
+  80043b:	68 cd 03 80 00       	push   $0x8003cd
+  800440:	e8 1c 01 00 00       	call   800561 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800445:	83 c4 08             	add    $0x8,%esp
+  800448:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80044e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800454:	50                   	push   %eax
+  800455:	e8 77 0a 00 00       	call   800ed1 <sys_cputs>
+
+	return b.cnt;
+}
+  80045a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800460:	c9                   	leave
+  800461:	c3                   	ret
+
+00800462 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800462:	55                   	push   %ebp
+  800463:	89 e5                	mov    %esp,%ebp
+  800465:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800468:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80046b:	50                   	push   %eax
+  80046c:	ff 75 08             	push   0x8(%ebp)
+  80046f:	e8 9d ff ff ff       	call   800411 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800474:	c9                   	leave
+  800475:	c3                   	ret
+
+00800476 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800476:	55                   	push   %ebp
+  800477:	89 e5                	mov    %esp,%ebp
+  800479:	57                   	push   %edi
+  80047a:	56                   	push   %esi
+  80047b:	53                   	push   %ebx
+  80047c:	83 ec 1c             	sub    $0x1c,%esp
+  80047f:	89 c3                	mov    %eax,%ebx
+  800481:	89 d6                	mov    %edx,%esi
+  800483:	8b 45 08             	mov    0x8(%ebp),%eax
+  800486:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800489:	89 d1                	mov    %edx,%ecx
+  80048b:	89 c2                	mov    %eax,%edx
+  80048d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800490:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800493:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800496:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800499:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004a0:	39 c2                	cmp    %eax,%edx
+  8004a2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004a5:	73 4b                	jae    8004f2 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8004a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004aa:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8004ad:	85 ff                	test   %edi,%edi
+  8004af:	7e 11                	jle    8004c2 <printnum+0x4c>
+			putch(padc, putdat);
+  8004b1:	83 ec 08             	sub    $0x8,%esp
+  8004b4:	56                   	push   %esi
+  8004b5:	ff 75 18             	push   0x18(%ebp)
+  8004b8:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8004ba:	83 c4 10             	add    $0x10,%esp
+  8004bd:	83 ef 01             	sub    $0x1,%edi
+  8004c0:	75 ef                	jne    8004b1 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004c2:	83 ec 08             	sub    $0x8,%esp
+  8004c5:	56                   	push   %esi
+  8004c6:	83 ec 04             	sub    $0x4,%esp
+  8004c9:	ff 75 e4             	push   -0x1c(%ebp)
+  8004cc:	ff 75 e0             	push   -0x20(%ebp)
+  8004cf:	ff 75 dc             	push   -0x24(%ebp)
+  8004d2:	ff 75 d8             	push   -0x28(%ebp)
+  8004d5:	e8 8d 40 00 00       	call   804567 <__umoddi3>
+  8004da:	83 c4 14             	add    $0x14,%esp
+  8004dd:	0f be 80 83 47 80 00 	movsbl 0x804783(%eax),%eax
+  8004e4:	50                   	push   %eax
+  8004e5:	ff d3                	call   *%ebx
+}
+  8004e7:	83 c4 10             	add    $0x10,%esp
+  8004ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ed:	5b                   	pop    %ebx
+  8004ee:	5e                   	pop    %esi
+  8004ef:	5f                   	pop    %edi
+  8004f0:	5d                   	pop    %ebp
+  8004f1:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004f2:	83 ec 0c             	sub    $0xc,%esp
+  8004f5:	ff 75 18             	push   0x18(%ebp)
+  8004f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004fb:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004fe:	52                   	push   %edx
+  8004ff:	50                   	push   %eax
+  800500:	83 ec 08             	sub    $0x8,%esp
+  800503:	ff 75 e4             	push   -0x1c(%ebp)
+  800506:	ff 75 e0             	push   -0x20(%ebp)
+  800509:	ff 75 dc             	push   -0x24(%ebp)
+  80050c:	ff 75 d8             	push   -0x28(%ebp)
+  80050f:	e8 8d 3f 00 00       	call   8044a1 <__udivdi3>
+  800514:	83 c4 18             	add    $0x18,%esp
+  800517:	52                   	push   %edx
+  800518:	50                   	push   %eax
+  800519:	89 f2                	mov    %esi,%edx
+  80051b:	89 d8                	mov    %ebx,%eax
+  80051d:	e8 54 ff ff ff       	call   800476 <printnum>
+  800522:	83 c4 20             	add    $0x20,%esp
+  800525:	eb 9b                	jmp    8004c2 <printnum+0x4c>
+
+00800527 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800527:	55                   	push   %ebp
+  800528:	89 e5                	mov    %esp,%ebp
+  80052a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80052d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800531:	8b 10                	mov    (%eax),%edx
+  800533:	3b 50 04             	cmp    0x4(%eax),%edx
+  800536:	73 0a                	jae    800542 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800538:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80053b:	89 08                	mov    %ecx,(%eax)
+  80053d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800540:	88 02                	mov    %al,(%edx)
+}
+  800542:	5d                   	pop    %ebp
+  800543:	c3                   	ret
+
+00800544 <printfmt>:
+{
+  800544:	55                   	push   %ebp
+  800545:	89 e5                	mov    %esp,%ebp
+  800547:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80054a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80054d:	50                   	push   %eax
+  80054e:	ff 75 10             	push   0x10(%ebp)
+  800551:	ff 75 0c             	push   0xc(%ebp)
+  800554:	ff 75 08             	push   0x8(%ebp)
+  800557:	e8 05 00 00 00       	call   800561 <vprintfmt>
+}
+  80055c:	83 c4 10             	add    $0x10,%esp
+  80055f:	c9                   	leave
+  800560:	c3                   	ret
+
+00800561 <vprintfmt>:
+{
+  800561:	55                   	push   %ebp
+  800562:	89 e5                	mov    %esp,%ebp
+  800564:	57                   	push   %edi
+  800565:	56                   	push   %esi
+  800566:	53                   	push   %ebx
+  800567:	83 ec 2c             	sub    $0x2c,%esp
+  80056a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80056d:	89 df                	mov    %ebx,%edi
+  80056f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800572:	8b 45 10             	mov    0x10(%ebp),%eax
+  800575:	8d 70 01             	lea    0x1(%eax),%esi
+  800578:	0f b6 00             	movzbl (%eax),%eax
+  80057b:	83 f8 25             	cmp    $0x25,%eax
+  80057e:	74 1e                	je     80059e <vprintfmt+0x3d>
+			if (ch == '\0')
+  800580:	85 c0                	test   %eax,%eax
+  800582:	0f 84 15 05 00 00    	je     800a9d <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	50                   	push   %eax
+  80058d:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80058f:	83 c6 01             	add    $0x1,%esi
+  800592:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800596:	83 c4 10             	add    $0x10,%esp
+  800599:	83 f8 25             	cmp    $0x25,%eax
+  80059c:	75 e2                	jne    800580 <vprintfmt+0x1f>
+		padc = ' ';
+  80059e:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8005a2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005a9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8005b0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8005b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005bc:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005bf:	8d 56 01             	lea    0x1(%esi),%edx
+  8005c2:	0f b6 0e             	movzbl (%esi),%ecx
+  8005c5:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005c8:	3c 55                	cmp    $0x55,%al
+  8005ca:	0f 87 3b 04 00 00    	ja     800a0b <vprintfmt+0x4aa>
+  8005d0:	0f b6 c0             	movzbl %al,%eax
+  8005d3:	ff 24 85 00 49 80 00 	jmp    *0x804900(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8005da:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005dd:	eb 93                	jmp    800572 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005df:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8005e1:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005e5:	eb d8                	jmp    8005bf <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e7:	89 d6                	mov    %edx,%esi
+  8005e9:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005ed:	eb d0                	jmp    8005bf <vprintfmt+0x5e>
+  8005ef:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8005f2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005f5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8005f8:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8005fc:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005ff:	83 f9 09             	cmp    $0x9,%ecx
+  800602:	77 6f                	ja     800673 <vprintfmt+0x112>
+  800604:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800607:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80060a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80060d:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800611:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800614:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800617:	83 fe 09             	cmp    $0x9,%esi
+  80061a:	76 eb                	jbe    800607 <vprintfmt+0xa6>
+  80061c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80061f:	89 d6                	mov    %edx,%esi
+  800621:	eb 13                	jmp    800636 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 00                	mov    (%eax),%eax
+  800628:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8d 40 04             	lea    0x4(%eax),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800634:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800636:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80063a:	79 83                	jns    8005bf <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80063c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80063f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800642:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800649:	e9 71 ff ff ff       	jmp    8005bf <vprintfmt+0x5e>
+			if (width < 0)
+  80064e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800651:	85 c9                	test   %ecx,%ecx
+  800653:	b8 00 00 00 00       	mov    $0x0,%eax
+  800658:	0f 49 c1             	cmovns %ecx,%eax
+  80065b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80065e:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800660:	e9 5a ff ff ff       	jmp    8005bf <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800665:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800667:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80066e:	e9 4c ff ff ff       	jmp    8005bf <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800673:	89 d6                	mov    %edx,%esi
+  800675:	eb bf                	jmp    800636 <vprintfmt+0xd5>
+			lflag++;
+  800677:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80067b:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80067d:	e9 3d ff ff ff       	jmp    8005bf <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800682:	89 55 10             	mov    %edx,0x10(%ebp)
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8d 70 04             	lea    0x4(%eax),%esi
+  80068b:	83 ec 08             	sub    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	ff 30                	push   (%eax)
+  800691:	ff d7                	call   *%edi
+			break;
+  800693:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800696:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800699:	e9 d4 fe ff ff       	jmp    800572 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80069e:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8006a7:	8b 10                	mov    (%eax),%edx
+  8006a9:	89 d0                	mov    %edx,%eax
+  8006ab:	f7 d8                	neg    %eax
+  8006ad:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006b0:	83 f8 12             	cmp    $0x12,%eax
+  8006b3:	7f 23                	jg     8006d8 <vprintfmt+0x177>
+  8006b5:	8b 14 85 60 4a 80 00 	mov    0x804a60(,%eax,4),%edx
+  8006bc:	85 d2                	test   %edx,%edx
+  8006be:	74 18                	je     8006d8 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8006c0:	52                   	push   %edx
+  8006c1:	68 db 4c 80 00       	push   $0x804cdb
+  8006c6:	53                   	push   %ebx
+  8006c7:	57                   	push   %edi
+  8006c8:	e8 77 fe ff ff       	call   800544 <printfmt>
+  8006cd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006d0:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006d3:	e9 9a fe ff ff       	jmp    800572 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8006d8:	50                   	push   %eax
+  8006d9:	68 9b 47 80 00       	push   $0x80479b
+  8006de:	53                   	push   %ebx
+  8006df:	57                   	push   %edi
+  8006e0:	e8 5f fe ff ff       	call   800544 <printfmt>
+  8006e5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006e8:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006eb:	e9 82 fe ff ff       	jmp    800572 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006f0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	83 c0 04             	add    $0x4,%eax
+  8006f9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8b 00                	mov    (%eax),%eax
+  800701:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800704:	85 c0                	test   %eax,%eax
+  800706:	0f 84 61 03 00 00    	je     800a6d <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80070c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800710:	7e 06                	jle    800718 <vprintfmt+0x1b7>
+  800712:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800716:	75 29                	jne    800741 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800718:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80071b:	8d 70 01             	lea    0x1(%eax),%esi
+  80071e:	0f b6 00             	movzbl (%eax),%eax
+  800721:	0f be d0             	movsbl %al,%edx
+  800724:	85 d2                	test   %edx,%edx
+  800726:	0f 84 bb 00 00 00    	je     8007e7 <vprintfmt+0x286>
+  80072c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80072f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800732:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800735:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800738:	eb 7a                	jmp    8007b4 <vprintfmt+0x253>
+				p = "(null)";
+  80073a:	c7 45 d0 94 47 80 00 	movl   $0x804794,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	ff 75 d4             	push   -0x2c(%ebp)
+  800747:	ff 75 d0             	push   -0x30(%ebp)
+  80074a:	e8 e0 03 00 00       	call   800b2f <strnlen>
+  80074f:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800752:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800755:	83 c4 10             	add    $0x10,%esp
+  800758:	85 d2                	test   %edx,%edx
+  80075a:	0f 8e d6 02 00 00    	jle    800a36 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800760:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800764:	83 ec 08             	sub    $0x8,%esp
+  800767:	53                   	push   %ebx
+  800768:	56                   	push   %esi
+  800769:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80076b:	83 c4 10             	add    $0x10,%esp
+  80076e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800772:	75 f0                	jne    800764 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800774:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800777:	8d 70 01             	lea    0x1(%eax),%esi
+  80077a:	0f b6 00             	movzbl (%eax),%eax
+  80077d:	0f be d0             	movsbl %al,%edx
+  800780:	85 d2                	test   %edx,%edx
+  800782:	0f 84 da 02 00 00    	je     800a62 <vprintfmt+0x501>
+  800788:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80078b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80078e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800791:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800794:	eb 1e                	jmp    8007b4 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800796:	83 ec 08             	sub    $0x8,%esp
+  800799:	ff 75 0c             	push   0xc(%ebp)
+  80079c:	52                   	push   %edx
+  80079d:	ff 55 08             	call   *0x8(%ebp)
+  8007a0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007a3:	83 eb 01             	sub    $0x1,%ebx
+  8007a6:	83 c6 01             	add    $0x1,%esi
+  8007a9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007ad:	0f be d0             	movsbl %al,%edx
+  8007b0:	85 d2                	test   %edx,%edx
+  8007b2:	74 2a                	je     8007de <vprintfmt+0x27d>
+  8007b4:	85 ff                	test   %edi,%edi
+  8007b6:	78 05                	js     8007bd <vprintfmt+0x25c>
+  8007b8:	83 ef 01             	sub    $0x1,%edi
+  8007bb:	78 59                	js     800816 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007c1:	74 d3                	je     800796 <vprintfmt+0x235>
+  8007c3:	0f be c0             	movsbl %al,%eax
+  8007c6:	83 e8 20             	sub    $0x20,%eax
+  8007c9:	83 f8 5e             	cmp    $0x5e,%eax
+  8007cc:	76 c8                	jbe    800796 <vprintfmt+0x235>
+					putch('?', putdat);
+  8007ce:	83 ec 08             	sub    $0x8,%esp
+  8007d1:	ff 75 0c             	push   0xc(%ebp)
+  8007d4:	6a 3f                	push   $0x3f
+  8007d6:	ff 55 08             	call   *0x8(%ebp)
+  8007d9:	83 c4 10             	add    $0x10,%esp
+  8007dc:	eb c5                	jmp    8007a3 <vprintfmt+0x242>
+  8007de:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8007e7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007ea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007ee:	7e 1b                	jle    80080b <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	6a 20                	push   $0x20
+  8007f6:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	83 ee 01             	sub    $0x1,%esi
+  8007fe:	75 f0                	jne    8007f0 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800800:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800803:	89 45 14             	mov    %eax,0x14(%ebp)
+  800806:	e9 67 fd ff ff       	jmp    800572 <vprintfmt+0x11>
+  80080b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80080e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800811:	e9 5c fd ff ff       	jmp    800572 <vprintfmt+0x11>
+  800816:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800819:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80081c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80081f:	eb c6                	jmp    8007e7 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800821:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800824:	89 55 10             	mov    %edx,0x10(%ebp)
+  800827:	83 f9 01             	cmp    $0x1,%ecx
+  80082a:	7f 1f                	jg     80084b <vprintfmt+0x2ea>
+	else if (lflag)
+  80082c:	85 c9                	test   %ecx,%ecx
+  80082e:	74 67                	je     800897 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800830:	8b 45 14             	mov    0x14(%ebp),%eax
+  800833:	8b 30                	mov    (%eax),%esi
+  800835:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800838:	89 f0                	mov    %esi,%eax
+  80083a:	c1 f8 1f             	sar    $0x1f,%eax
+  80083d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8d 40 04             	lea    0x4(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+  800849:	eb 17                	jmp    800862 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80084b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084e:	8b 50 04             	mov    0x4(%eax),%edx
+  800851:	8b 00                	mov    (%eax),%eax
+  800853:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800856:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8d 40 08             	lea    0x8(%eax),%eax
+  80085f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800862:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800865:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800868:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80086d:	85 c9                	test   %ecx,%ecx
+  80086f:	0f 89 12 01 00 00    	jns    800987 <vprintfmt+0x426>
+				putch('-', putdat);
+  800875:	83 ec 08             	sub    $0x8,%esp
+  800878:	53                   	push   %ebx
+  800879:	6a 2d                	push   $0x2d
+  80087b:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80087d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800880:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800883:	f7 da                	neg    %edx
+  800885:	83 d1 00             	adc    $0x0,%ecx
+  800888:	f7 d9                	neg    %ecx
+  80088a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80088d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800892:	e9 f0 00 00 00       	jmp    800987 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 30                	mov    (%eax),%esi
+  80089c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80089f:	89 f0                	mov    %esi,%eax
+  8008a1:	c1 f8 1f             	sar    $0x1f,%eax
+  8008a4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b0:	eb b0                	jmp    800862 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8008b2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008b5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b8:	83 f9 01             	cmp    $0x1,%ecx
+  8008bb:	7f 1e                	jg     8008db <vprintfmt+0x37a>
+	else if (lflag)
+  8008bd:	85 c9                	test   %ecx,%ecx
+  8008bf:	74 32                	je     8008f3 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8008c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c4:	8b 10                	mov    (%eax),%edx
+  8008c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008d1:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8008d6:	e9 ac 00 00 00       	jmp    800987 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008de:	8b 10                	mov    (%eax),%edx
+  8008e0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e9:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8008ee:	e9 94 00 00 00       	jmp    800987 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f6:	8b 10                	mov    (%eax),%edx
+  8008f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800900:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800903:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800908:	eb 7d                	jmp    800987 <vprintfmt+0x426>
+	if (lflag >= 2)
+  80090a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80090d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800910:	83 f9 01             	cmp    $0x1,%ecx
+  800913:	7f 1b                	jg     800930 <vprintfmt+0x3cf>
+	else if (lflag)
+  800915:	85 c9                	test   %ecx,%ecx
+  800917:	74 2c                	je     800945 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800919:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091c:	8b 10                	mov    (%eax),%edx
+  80091e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800923:	8d 40 04             	lea    0x4(%eax),%eax
+  800926:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800929:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80092e:	eb 57                	jmp    800987 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800930:	8b 45 14             	mov    0x14(%ebp),%eax
+  800933:	8b 10                	mov    (%eax),%edx
+  800935:	8b 48 04             	mov    0x4(%eax),%ecx
+  800938:	8d 40 08             	lea    0x8(%eax),%eax
+  80093b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80093e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800943:	eb 42                	jmp    800987 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800945:	8b 45 14             	mov    0x14(%ebp),%eax
+  800948:	8b 10                	mov    (%eax),%edx
+  80094a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094f:	8d 40 04             	lea    0x4(%eax),%eax
+  800952:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800955:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80095a:	eb 2b                	jmp    800987 <vprintfmt+0x426>
+			putch('0', putdat);
+  80095c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80095f:	83 ec 08             	sub    $0x8,%esp
+  800962:	53                   	push   %ebx
+  800963:	6a 30                	push   $0x30
+  800965:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800967:	83 c4 08             	add    $0x8,%esp
+  80096a:	53                   	push   %ebx
+  80096b:	6a 78                	push   $0x78
+  80096d:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80096f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800972:	8b 10                	mov    (%eax),%edx
+  800974:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800979:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80097c:	8d 40 04             	lea    0x4(%eax),%eax
+  80097f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800982:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800987:	83 ec 0c             	sub    $0xc,%esp
+  80098a:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80098e:	50                   	push   %eax
+  80098f:	ff 75 e4             	push   -0x1c(%ebp)
+  800992:	56                   	push   %esi
+  800993:	51                   	push   %ecx
+  800994:	52                   	push   %edx
+  800995:	89 da                	mov    %ebx,%edx
+  800997:	89 f8                	mov    %edi,%eax
+  800999:	e8 d8 fa ff ff       	call   800476 <printnum>
+			break;
+  80099e:	83 c4 20             	add    $0x20,%esp
+  8009a1:	e9 cc fb ff ff       	jmp    800572 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8009a6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009ac:	83 f9 01             	cmp    $0x1,%ecx
+  8009af:	7f 1b                	jg     8009cc <vprintfmt+0x46b>
+	else if (lflag)
+  8009b1:	85 c9                	test   %ecx,%ecx
+  8009b3:	74 2c                	je     8009e1 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8009b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b8:	8b 10                	mov    (%eax),%edx
+  8009ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009c5:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009ca:	eb bb                	jmp    800987 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cf:	8b 10                	mov    (%eax),%edx
+  8009d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8009d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009da:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8009df:	eb a6                	jmp    800987 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e4:	8b 10                	mov    (%eax),%edx
+  8009e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009f1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8009f6:	eb 8f                	jmp    800987 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8009f8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009fb:	83 ec 08             	sub    $0x8,%esp
+  8009fe:	53                   	push   %ebx
+  8009ff:	6a 25                	push   $0x25
+  800a01:	ff d7                	call   *%edi
+			break;
+  800a03:	83 c4 10             	add    $0x10,%esp
+  800a06:	e9 67 fb ff ff       	jmp    800572 <vprintfmt+0x11>
+			putch('%', putdat);
+  800a0b:	83 ec 08             	sub    $0x8,%esp
+  800a0e:	53                   	push   %ebx
+  800a0f:	6a 25                	push   $0x25
+  800a11:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a13:	83 c4 10             	add    $0x10,%esp
+  800a16:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a1a:	0f 84 ba fb ff ff    	je     8005da <vprintfmt+0x79>
+  800a20:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a23:	89 f0                	mov    %esi,%eax
+  800a25:	83 e8 01             	sub    $0x1,%eax
+  800a28:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a2c:	75 f7                	jne    800a25 <vprintfmt+0x4c4>
+  800a2e:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a31:	e9 3c fb ff ff       	jmp    800572 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a36:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a39:	8d 70 01             	lea    0x1(%eax),%esi
+  800a3c:	0f b6 00             	movzbl (%eax),%eax
+  800a3f:	0f be d0             	movsbl %al,%edx
+  800a42:	85 d2                	test   %edx,%edx
+  800a44:	74 11                	je     800a57 <vprintfmt+0x4f6>
+  800a46:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a49:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a4c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a4f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a52:	e9 5d fd ff ff       	jmp    8007b4 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a57:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a5a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a5d:	e9 10 fb ff ff       	jmp    800572 <vprintfmt+0x11>
+  800a62:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a65:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a68:	e9 05 fb ff ff       	jmp    800572 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a6d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a71:	7e 0a                	jle    800a7d <vprintfmt+0x51c>
+  800a73:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a77:	0f 85 bd fc ff ff    	jne    80073a <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a7d:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a82:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a87:	be 95 47 80 00       	mov    $0x804795,%esi
+  800a8c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a8f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a92:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a95:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a98:	e9 17 fd ff ff       	jmp    8007b4 <vprintfmt+0x253>
+}
+  800a9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aa0:	5b                   	pop    %ebx
+  800aa1:	5e                   	pop    %esi
+  800aa2:	5f                   	pop    %edi
+  800aa3:	5d                   	pop    %ebp
+  800aa4:	c3                   	ret
+
+00800aa5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800aa5:	55                   	push   %ebp
+  800aa6:	89 e5                	mov    %esp,%ebp
+  800aa8:	83 ec 18             	sub    $0x18,%esp
+  800aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ab1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ab4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ab8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800abb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800ac2:	85 c0                	test   %eax,%eax
+  800ac4:	74 26                	je     800aec <vsnprintf+0x47>
+  800ac6:	85 d2                	test   %edx,%edx
+  800ac8:	7e 22                	jle    800aec <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800aca:	ff 75 14             	push   0x14(%ebp)
+  800acd:	ff 75 10             	push   0x10(%ebp)
+  800ad0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ad3:	50                   	push   %eax
+  800ad4:	68 27 05 80 00       	push   $0x800527
+  800ad9:	e8 83 fa ff ff       	call   800561 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ade:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ae1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ae4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ae7:	83 c4 10             	add    $0x10,%esp
+}
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+		return -E_INVAL;
+  800aec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af1:	eb f7                	jmp    800aea <vsnprintf+0x45>
+
+00800af3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800af9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800afc:	50                   	push   %eax
+  800afd:	ff 75 10             	push   0x10(%ebp)
+  800b00:	ff 75 0c             	push   0xc(%ebp)
+  800b03:	ff 75 08             	push   0x8(%ebp)
+  800b06:	e8 9a ff ff ff       	call   800aa5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b0b:	c9                   	leave
+  800b0c:	c3                   	ret
+
+00800b0d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b0d:	55                   	push   %ebp
+  800b0e:	89 e5                	mov    %esp,%ebp
+  800b10:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b13:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b16:	74 10                	je     800b28 <strlen+0x1b>
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b1d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b20:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b24:	75 f7                	jne    800b1d <strlen+0x10>
+	return n;
+}
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b28:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b2d:	eb f7                	jmp    800b26 <strlen+0x19>
+
+00800b2f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b35:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b38:	85 d2                	test   %edx,%edx
+  800b3a:	74 16                	je     800b52 <strnlen+0x23>
+  800b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b41:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b45:	74 09                	je     800b50 <strnlen+0x21>
+		n++;
+  800b47:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b4a:	39 d0                	cmp    %edx,%eax
+  800b4c:	75 f3                	jne    800b41 <strnlen+0x12>
+		n++;
+  800b4e:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b50:	5d                   	pop    %ebp
+  800b51:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b57:	eb f7                	jmp    800b50 <strnlen+0x21>
+
+00800b59 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	53                   	push   %ebx
+  800b5d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b68:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b6c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b6f:	83 c0 01             	add    $0x1,%eax
+  800b72:	84 d2                	test   %dl,%dl
+  800b74:	75 f2                	jne    800b68 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b76:	89 c8                	mov    %ecx,%eax
+  800b78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b7b:	c9                   	leave
+  800b7c:	c3                   	ret
+
+00800b7d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	53                   	push   %ebx
+  800b81:	83 ec 10             	sub    $0x10,%esp
+  800b84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b87:	53                   	push   %ebx
+  800b88:	e8 80 ff ff ff       	call   800b0d <strlen>
+  800b8d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b90:	ff 75 0c             	push   0xc(%ebp)
+  800b93:	01 d8                	add    %ebx,%eax
+  800b95:	50                   	push   %eax
+  800b96:	e8 be ff ff ff       	call   800b59 <strcpy>
+	return dst;
+}
+  800b9b:	89 d8                	mov    %ebx,%eax
+  800b9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba0:	c9                   	leave
+  800ba1:	c3                   	ret
+
+00800ba2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	56                   	push   %esi
+  800ba6:	53                   	push   %ebx
+  800ba7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800baa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bb0:	85 db                	test   %ebx,%ebx
+  800bb2:	74 17                	je     800bcb <strncpy+0x29>
+  800bb4:	01 f3                	add    %esi,%ebx
+  800bb6:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800bb8:	83 c0 01             	add    $0x1,%eax
+  800bbb:	0f b6 0a             	movzbl (%edx),%ecx
+  800bbe:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bc1:	80 f9 01             	cmp    $0x1,%cl
+  800bc4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bc7:	39 c3                	cmp    %eax,%ebx
+  800bc9:	75 ed                	jne    800bb8 <strncpy+0x16>
+	}
+	return ret;
+}
+  800bcb:	89 f0                	mov    %esi,%eax
+  800bcd:	5b                   	pop    %ebx
+  800bce:	5e                   	pop    %esi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+
+00800bd1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	56                   	push   %esi
+  800bd5:	53                   	push   %ebx
+  800bd6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bdc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bdf:	89 f0                	mov    %esi,%eax
+  800be1:	85 db                	test   %ebx,%ebx
+  800be3:	74 1e                	je     800c03 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800be5:	83 eb 01             	sub    $0x1,%ebx
+  800be8:	74 16                	je     800c00 <strlcpy+0x2f>
+  800bea:	01 f3                	add    %esi,%ebx
+  800bec:	0f b6 0a             	movzbl (%edx),%ecx
+  800bef:	84 c9                	test   %cl,%cl
+  800bf1:	74 0d                	je     800c00 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800bf3:	83 c2 01             	add    $0x1,%edx
+  800bf6:	83 c0 01             	add    $0x1,%eax
+  800bf9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800bfc:	39 d8                	cmp    %ebx,%eax
+  800bfe:	75 ec                	jne    800bec <strlcpy+0x1b>
+		*dst = '\0';
+  800c00:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c03:	29 f0                	sub    %esi,%eax
+}
+  800c05:	5b                   	pop    %ebx
+  800c06:	5e                   	pop    %esi
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+
+00800c09 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c12:	0f b6 01             	movzbl (%ecx),%eax
+  800c15:	84 c0                	test   %al,%al
+  800c17:	74 11                	je     800c2a <strcmp+0x21>
+  800c19:	38 02                	cmp    %al,(%edx)
+  800c1b:	75 0d                	jne    800c2a <strcmp+0x21>
+		p++, q++;
+  800c1d:	83 c1 01             	add    $0x1,%ecx
+  800c20:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c23:	0f b6 01             	movzbl (%ecx),%eax
+  800c26:	84 c0                	test   %al,%al
+  800c28:	75 ef                	jne    800c19 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c2a:	0f b6 c0             	movzbl %al,%eax
+  800c2d:	0f b6 12             	movzbl (%edx),%edx
+  800c30:	29 d0                	sub    %edx,%eax
+}
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+
+00800c34 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	53                   	push   %ebx
+  800c38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c3b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c3e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c41:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c46:	85 d2                	test   %edx,%edx
+  800c48:	74 2e                	je     800c78 <strncmp+0x44>
+  800c4a:	0f b6 01             	movzbl (%ecx),%eax
+  800c4d:	84 c0                	test   %al,%al
+  800c4f:	74 16                	je     800c67 <strncmp+0x33>
+  800c51:	3a 03                	cmp    (%ebx),%al
+  800c53:	75 12                	jne    800c67 <strncmp+0x33>
+		n--, p++, q++;
+  800c55:	83 c1 01             	add    $0x1,%ecx
+  800c58:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800c5b:	83 ea 01             	sub    $0x1,%edx
+  800c5e:	75 ea                	jne    800c4a <strncmp+0x16>
+		return 0;
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c65:	eb 11                	jmp    800c78 <strncmp+0x44>
+  800c67:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800c6c:	85 d2                	test   %edx,%edx
+  800c6e:	74 08                	je     800c78 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c70:	0f b6 01             	movzbl (%ecx),%eax
+  800c73:	0f b6 13             	movzbl (%ebx),%edx
+  800c76:	29 d0                	sub    %edx,%eax
+}
+  800c78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c7b:	c9                   	leave
+  800c7c:	c3                   	ret
+
+00800c7d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c7d:	55                   	push   %ebp
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c83:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c87:	0f b6 10             	movzbl (%eax),%edx
+  800c8a:	84 d2                	test   %dl,%dl
+  800c8c:	74 15                	je     800ca3 <strchr+0x26>
+		if (*s == c)
+  800c8e:	38 d1                	cmp    %dl,%cl
+  800c90:	74 0f                	je     800ca1 <strchr+0x24>
+	for (; *s; s++)
+  800c92:	83 c0 01             	add    $0x1,%eax
+  800c95:	0f b6 10             	movzbl (%eax),%edx
+  800c98:	84 d2                	test   %dl,%dl
+  800c9a:	75 f2                	jne    800c8e <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca1:	5d                   	pop    %ebp
+  800ca2:	c3                   	ret
+	return 0;
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca8:	eb f7                	jmp    800ca1 <strchr+0x24>
+
+00800caa <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	53                   	push   %ebx
+  800cae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800cb4:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800cb7:	38 d3                	cmp    %dl,%bl
+  800cb9:	74 14                	je     800ccf <strfind+0x25>
+  800cbb:	89 d1                	mov    %edx,%ecx
+  800cbd:	84 db                	test   %bl,%bl
+  800cbf:	74 0e                	je     800ccf <strfind+0x25>
+	for (; *s; s++)
+  800cc1:	83 c0 01             	add    $0x1,%eax
+  800cc4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cc7:	38 ca                	cmp    %cl,%dl
+  800cc9:	74 04                	je     800ccf <strfind+0x25>
+  800ccb:	84 d2                	test   %dl,%dl
+  800ccd:	75 f2                	jne    800cc1 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800ccf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cd2:	c9                   	leave
+  800cd3:	c3                   	ret
+
+00800cd4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	57                   	push   %edi
+  800cd8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cdb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cde:	85 c9                	test   %ecx,%ecx
+  800ce0:	74 20                	je     800d02 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ce2:	89 f8                	mov    %edi,%eax
+  800ce4:	09 c8                	or     %ecx,%eax
+  800ce6:	a8 03                	test   $0x3,%al
+  800ce8:	75 12                	jne    800cfc <memset+0x28>
+		c &= 0xFF;
+  800cea:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cee:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cf4:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cf7:	fc                   	cld
+  800cf8:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cfa:	eb 06                	jmp    800d02 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cff:	fc                   	cld
+  800d00:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d02:	89 f8                	mov    %edi,%eax
+  800d04:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d07:	c9                   	leave
+  800d08:	c3                   	ret
+
+00800d09 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	57                   	push   %edi
+  800d0d:	56                   	push   %esi
+  800d0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d11:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d14:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d17:	39 c6                	cmp    %eax,%esi
+  800d19:	73 32                	jae    800d4d <memmove+0x44>
+  800d1b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d1e:	39 d0                	cmp    %edx,%eax
+  800d20:	73 2b                	jae    800d4d <memmove+0x44>
+		s += n;
+		d += n;
+  800d22:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d25:	89 d6                	mov    %edx,%esi
+  800d27:	09 fe                	or     %edi,%esi
+  800d29:	09 ce                	or     %ecx,%esi
+  800d2b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d31:	75 0e                	jne    800d41 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d33:	83 ef 04             	sub    $0x4,%edi
+  800d36:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d39:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d3c:	fd                   	std
+  800d3d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d3f:	eb 09                	jmp    800d4a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d41:	83 ef 01             	sub    $0x1,%edi
+  800d44:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d47:	fd                   	std
+  800d48:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d4a:	fc                   	cld
+  800d4b:	eb 1a                	jmp    800d67 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d4d:	89 f2                	mov    %esi,%edx
+  800d4f:	09 c2                	or     %eax,%edx
+  800d51:	09 ca                	or     %ecx,%edx
+  800d53:	f6 c2 03             	test   $0x3,%dl
+  800d56:	75 0a                	jne    800d62 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d58:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d5b:	89 c7                	mov    %eax,%edi
+  800d5d:	fc                   	cld
+  800d5e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d60:	eb 05                	jmp    800d67 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d62:	89 c7                	mov    %eax,%edi
+  800d64:	fc                   	cld
+  800d65:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d67:	5e                   	pop    %esi
+  800d68:	5f                   	pop    %edi
+  800d69:	5d                   	pop    %ebp
+  800d6a:	c3                   	ret
+
+00800d6b <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d71:	ff 75 10             	push   0x10(%ebp)
+  800d74:	ff 75 0c             	push   0xc(%ebp)
+  800d77:	ff 75 08             	push   0x8(%ebp)
+  800d7a:	e8 8a ff ff ff       	call   800d09 <memmove>
+}
+  800d7f:	c9                   	leave
+  800d80:	c3                   	ret
+
+00800d81 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d81:	55                   	push   %ebp
+  800d82:	89 e5                	mov    %esp,%ebp
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+  800d86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d8c:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d8f:	85 f6                	test   %esi,%esi
+  800d91:	74 29                	je     800dbc <memcmp+0x3b>
+  800d93:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800d95:	0f b6 08             	movzbl (%eax),%ecx
+  800d98:	0f b6 1a             	movzbl (%edx),%ebx
+  800d9b:	38 d9                	cmp    %bl,%cl
+  800d9d:	75 11                	jne    800db0 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d9f:	83 c0 01             	add    $0x1,%eax
+  800da2:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800da5:	39 c6                	cmp    %eax,%esi
+  800da7:	75 ec                	jne    800d95 <memcmp+0x14>
+	}
+
+	return 0;
+  800da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dae:	eb 08                	jmp    800db8 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800db0:	0f b6 c1             	movzbl %cl,%eax
+  800db3:	0f b6 db             	movzbl %bl,%ebx
+  800db6:	29 d8                	sub    %ebx,%eax
+}
+  800db8:	5b                   	pop    %ebx
+  800db9:	5e                   	pop    %esi
+  800dba:	5d                   	pop    %ebp
+  800dbb:	c3                   	ret
+	return 0;
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	eb f5                	jmp    800db8 <memcmp+0x37>
+
+00800dc3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dcc:	89 c2                	mov    %eax,%edx
+  800dce:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dd1:	39 d0                	cmp    %edx,%eax
+  800dd3:	73 0d                	jae    800de2 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dd5:	38 08                	cmp    %cl,(%eax)
+  800dd7:	74 0d                	je     800de6 <memfind+0x23>
+	for (; s < ends; s++)
+  800dd9:	83 c0 01             	add    $0x1,%eax
+  800ddc:	39 c2                	cmp    %eax,%edx
+  800dde:	75 f5                	jne    800dd5 <memfind+0x12>
+  800de0:	eb 06                	jmp    800de8 <memfind+0x25>
+  800de2:	89 c2                	mov    %eax,%edx
+  800de4:	eb 02                	jmp    800de8 <memfind+0x25>
+  800de6:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800de8:	89 d0                	mov    %edx,%eax
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  800df2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800df8:	0f b6 02             	movzbl (%edx),%eax
+  800dfb:	3c 20                	cmp    $0x20,%al
+  800dfd:	74 04                	je     800e03 <strtol+0x17>
+  800dff:	3c 09                	cmp    $0x9,%al
+  800e01:	75 0e                	jne    800e11 <strtol+0x25>
+		s++;
+  800e03:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e06:	0f b6 02             	movzbl (%edx),%eax
+  800e09:	3c 20                	cmp    $0x20,%al
+  800e0b:	74 f6                	je     800e03 <strtol+0x17>
+  800e0d:	3c 09                	cmp    $0x9,%al
+  800e0f:	74 f2                	je     800e03 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e11:	3c 2b                	cmp    $0x2b,%al
+  800e13:	74 2a                	je     800e3f <strtol+0x53>
+	int neg = 0;
+  800e15:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e1a:	3c 2d                	cmp    $0x2d,%al
+  800e1c:	74 2b                	je     800e49 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e1e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e24:	75 0f                	jne    800e35 <strtol+0x49>
+  800e26:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e29:	74 28                	je     800e53 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e2b:	85 db                	test   %ebx,%ebx
+  800e2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e32:	0f 44 d8             	cmove  %eax,%ebx
+  800e35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e3d:	eb 46                	jmp    800e85 <strtol+0x99>
+		s++;
+  800e3f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e42:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e47:	eb d5                	jmp    800e1e <strtol+0x32>
+		s++, neg = 1;
+  800e49:	83 c2 01             	add    $0x1,%edx
+  800e4c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e51:	eb cb                	jmp    800e1e <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e53:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e57:	74 0e                	je     800e67 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800e59:	85 db                	test   %ebx,%ebx
+  800e5b:	75 d8                	jne    800e35 <strtol+0x49>
+		s++, base = 8;
+  800e5d:	83 c2 01             	add    $0x1,%edx
+  800e60:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e65:	eb ce                	jmp    800e35 <strtol+0x49>
+		s += 2, base = 16;
+  800e67:	83 c2 02             	add    $0x2,%edx
+  800e6a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e6f:	eb c4                	jmp    800e35 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e71:	0f be c0             	movsbl %al,%eax
+  800e74:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e77:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e7a:	7d 3a                	jge    800eb6 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800e7c:	83 c2 01             	add    $0x1,%edx
+  800e7f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e83:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e85:	0f b6 02             	movzbl (%edx),%eax
+  800e88:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e8b:	89 f3                	mov    %esi,%ebx
+  800e8d:	80 fb 09             	cmp    $0x9,%bl
+  800e90:	76 df                	jbe    800e71 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800e92:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e95:	89 f3                	mov    %esi,%ebx
+  800e97:	80 fb 19             	cmp    $0x19,%bl
+  800e9a:	77 08                	ja     800ea4 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800e9c:	0f be c0             	movsbl %al,%eax
+  800e9f:	83 e8 57             	sub    $0x57,%eax
+  800ea2:	eb d3                	jmp    800e77 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ea4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ea7:	89 f3                	mov    %esi,%ebx
+  800ea9:	80 fb 19             	cmp    $0x19,%bl
+  800eac:	77 08                	ja     800eb6 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800eae:	0f be c0             	movsbl %al,%eax
+  800eb1:	83 e8 37             	sub    $0x37,%eax
+  800eb4:	eb c1                	jmp    800e77 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800eb6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eba:	74 05                	je     800ec1 <strtol+0xd5>
+		*endptr = (char *) s;
+  800ebc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ebf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ec1:	89 c8                	mov    %ecx,%eax
+  800ec3:	f7 d8                	neg    %eax
+  800ec5:	85 ff                	test   %edi,%edi
+  800ec7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800eca:	89 c8                	mov    %ecx,%eax
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+
+00800ed1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee2:	89 c3                	mov    %eax,%ebx
+  800ee4:	89 c7                	mov    %eax,%edi
+  800ee6:	89 c6                	mov    %eax,%esi
+  800ee8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800eea:	5b                   	pop    %ebx
+  800eeb:	5e                   	pop    %esi
+  800eec:	5f                   	pop    %edi
+  800eed:	5d                   	pop    %ebp
+  800eee:	c3                   	ret
+
+00800eef <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	56                   	push   %esi
+  800ef4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efa:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eff:	89 d1                	mov    %edx,%ecx
+  800f01:	89 d3                	mov    %edx,%ebx
+  800f03:	89 d7                	mov    %edx,%edi
+  800f05:	89 d6                	mov    %edx,%esi
+  800f07:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+
+00800f0e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+  800f14:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f24:	89 cb                	mov    %ecx,%ebx
+  800f26:	89 cf                	mov    %ecx,%edi
+  800f28:	89 ce                	mov    %ecx,%esi
+  800f2a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2c:	85 c0                	test   %eax,%eax
+  800f2e:	7f 08                	jg     800f38 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f33:	5b                   	pop    %ebx
+  800f34:	5e                   	pop    %esi
+  800f35:	5f                   	pop    %edi
+  800f36:	5d                   	pop    %ebp
+  800f37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+  800f3b:	50                   	push   %eax
+  800f3c:	6a 03                	push   $0x3
+  800f3e:	68 cb 4a 80 00       	push   $0x804acb
+  800f43:	6a 23                	push   $0x23
+  800f45:	68 e8 4a 80 00       	push   $0x804ae8
+  800f4a:	e8 38 f4 ff ff       	call   800387 <_panic>
+
+00800f4f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	57                   	push   %edi
+  800f53:	56                   	push   %esi
+  800f54:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f5f:	89 d1                	mov    %edx,%ecx
+  800f61:	89 d3                	mov    %edx,%ebx
+  800f63:	89 d7                	mov    %edx,%edi
+  800f65:	89 d6                	mov    %edx,%esi
+  800f67:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f69:	5b                   	pop    %ebx
+  800f6a:	5e                   	pop    %esi
+  800f6b:	5f                   	pop    %edi
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+
+00800f6e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f79:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f7e:	89 d1                	mov    %edx,%ecx
+  800f80:	89 d3                	mov    %edx,%ebx
+  800f82:	89 d7                	mov    %edx,%edi
+  800f84:	89 d6                	mov    %edx,%esi
+  800f86:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+
+00800f8d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	56                   	push   %esi
+  800f92:	53                   	push   %ebx
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f96:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fa6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa9:	89 f7                	mov    %esi,%edi
+  800fab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 08                	jg     800fb9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	50                   	push   %eax
+  800fbd:	6a 04                	push   $0x4
+  800fbf:	68 cb 4a 80 00       	push   $0x804acb
+  800fc4:	6a 23                	push   $0x23
+  800fc6:	68 e8 4a 80 00       	push   $0x804ae8
+  800fcb:	e8 b7 f3 ff ff       	call   800387 <_panic>
+
+00800fd0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fe4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fea:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fef:	85 c0                	test   %eax,%eax
+  800ff1:	7f 08                	jg     800ffb <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ff3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff6:	5b                   	pop    %ebx
+  800ff7:	5e                   	pop    %esi
+  800ff8:	5f                   	pop    %edi
+  800ff9:	5d                   	pop    %ebp
+  800ffa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+  800ffe:	50                   	push   %eax
+  800fff:	6a 05                	push   $0x5
+  801001:	68 cb 4a 80 00       	push   $0x804acb
+  801006:	6a 23                	push   $0x23
+  801008:	68 e8 4a 80 00       	push   $0x804ae8
+  80100d:	e8 75 f3 ff ff       	call   800387 <_panic>
+
+00801012 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801012:	55                   	push   %ebp
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	57                   	push   %edi
+  801016:	56                   	push   %esi
+  801017:	53                   	push   %ebx
+  801018:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80101b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801026:	b8 06 00 00 00       	mov    $0x6,%eax
+  80102b:	89 df                	mov    %ebx,%edi
+  80102d:	89 de                	mov    %ebx,%esi
+  80102f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801031:	85 c0                	test   %eax,%eax
+  801033:	7f 08                	jg     80103d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801038:	5b                   	pop    %ebx
+  801039:	5e                   	pop    %esi
+  80103a:	5f                   	pop    %edi
+  80103b:	5d                   	pop    %ebp
+  80103c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103d:	83 ec 0c             	sub    $0xc,%esp
+  801040:	50                   	push   %eax
+  801041:	6a 06                	push   $0x6
+  801043:	68 cb 4a 80 00       	push   $0x804acb
+  801048:	6a 23                	push   $0x23
+  80104a:	68 e8 4a 80 00       	push   $0x804ae8
+  80104f:	e8 33 f3 ff ff       	call   800387 <_panic>
+
+00801054 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801054:	55                   	push   %ebp
+  801055:	89 e5                	mov    %esp,%ebp
+  801057:	57                   	push   %edi
+  801058:	56                   	push   %esi
+  801059:	53                   	push   %ebx
+  80105a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80105d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801062:	8b 55 08             	mov    0x8(%ebp),%edx
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	b8 08 00 00 00       	mov    $0x8,%eax
+  80106d:	89 df                	mov    %ebx,%edi
+  80106f:	89 de                	mov    %ebx,%esi
+  801071:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801073:	85 c0                	test   %eax,%eax
+  801075:	7f 08                	jg     80107f <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801077:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107a:	5b                   	pop    %ebx
+  80107b:	5e                   	pop    %esi
+  80107c:	5f                   	pop    %edi
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107f:	83 ec 0c             	sub    $0xc,%esp
+  801082:	50                   	push   %eax
+  801083:	6a 08                	push   $0x8
+  801085:	68 cb 4a 80 00       	push   $0x804acb
+  80108a:	6a 23                	push   $0x23
+  80108c:	68 e8 4a 80 00       	push   $0x804ae8
+  801091:	e8 f1 f2 ff ff       	call   800387 <_panic>
+
+00801096 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	57                   	push   %edi
+  80109a:	56                   	push   %esi
+  80109b:	53                   	push   %ebx
+  80109c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010af:	89 df                	mov    %ebx,%edi
+  8010b1:	89 de                	mov    %ebx,%esi
+  8010b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b5:	85 c0                	test   %eax,%eax
+  8010b7:	7f 08                	jg     8010c1 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+  8010c4:	50                   	push   %eax
+  8010c5:	6a 09                	push   $0x9
+  8010c7:	68 cb 4a 80 00       	push   $0x804acb
+  8010cc:	6a 23                	push   $0x23
+  8010ce:	68 e8 4a 80 00       	push   $0x804ae8
+  8010d3:	e8 af f2 ff ff       	call   800387 <_panic>
+
+008010d8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010f1:	89 df                	mov    %ebx,%edi
+  8010f3:	89 de                	mov    %ebx,%esi
+  8010f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f7:	85 c0                	test   %eax,%eax
+  8010f9:	7f 08                	jg     801103 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801103:	83 ec 0c             	sub    $0xc,%esp
+  801106:	50                   	push   %eax
+  801107:	6a 0a                	push   $0xa
+  801109:	68 cb 4a 80 00       	push   $0x804acb
+  80110e:	6a 23                	push   $0x23
+  801110:	68 e8 4a 80 00       	push   $0x804ae8
+  801115:	e8 6d f2 ff ff       	call   800387 <_panic>
+
+0080111a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+  80111d:	57                   	push   %edi
+  80111e:	56                   	push   %esi
+  80111f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+  801123:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801126:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80112b:	be 00 00 00 00       	mov    $0x0,%esi
+  801130:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801133:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801136:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801138:	5b                   	pop    %ebx
+  801139:	5e                   	pop    %esi
+  80113a:	5f                   	pop    %edi
+  80113b:	5d                   	pop    %ebp
+  80113c:	c3                   	ret
+
+0080113d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	57                   	push   %edi
+  801141:	56                   	push   %esi
+  801142:	53                   	push   %ebx
+  801143:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801146:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801153:	89 cb                	mov    %ecx,%ebx
+  801155:	89 cf                	mov    %ecx,%edi
+  801157:	89 ce                	mov    %ecx,%esi
+  801159:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	7f 08                	jg     801167 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801167:	83 ec 0c             	sub    $0xc,%esp
+  80116a:	50                   	push   %eax
+  80116b:	6a 0d                	push   $0xd
+  80116d:	68 cb 4a 80 00       	push   $0x804acb
+  801172:	6a 23                	push   $0x23
+  801174:	68 e8 4a 80 00       	push   $0x804ae8
+  801179:	e8 09 f2 ff ff       	call   800387 <_panic>
+
+0080117e <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	57                   	push   %edi
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80118f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801192:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801195:	8b 75 18             	mov    0x18(%ebp),%esi
+  801198:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80119a:	5b                   	pop    %ebx
+  80119b:	5e                   	pop    %esi
+  80119c:	5f                   	pop    %edi
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+  8011a5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011b8:	89 df                	mov    %ebx,%edi
+  8011ba:	89 de                	mov    %ebx,%esi
+  8011bc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011be:	85 c0                	test   %eax,%eax
+  8011c0:	7f 08                	jg     8011ca <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8011c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c5:	5b                   	pop    %ebx
+  8011c6:	5e                   	pop    %esi
+  8011c7:	5f                   	pop    %edi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ca:	83 ec 0c             	sub    $0xc,%esp
+  8011cd:	50                   	push   %eax
+  8011ce:	6a 0d                	push   $0xd
+  8011d0:	68 cb 4a 80 00       	push   $0x804acb
+  8011d5:	6a 23                	push   $0x23
+  8011d7:	68 e8 4a 80 00       	push   $0x804ae8
+  8011dc:	e8 a6 f1 ff ff       	call   800387 <_panic>
+
+008011e1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	57                   	push   %edi
+  8011e5:	56                   	push   %esi
+  8011e6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f1:	89 d1                	mov    %edx,%ecx
+  8011f3:	89 d3                	mov    %edx,%ebx
+  8011f5:	89 d7                	mov    %edx,%edi
+  8011f7:	89 d6                	mov    %edx,%esi
+  8011f9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011fb:	5b                   	pop    %ebx
+  8011fc:	5e                   	pop    %esi
+  8011fd:	5f                   	pop    %edi
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+
+00801200 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801211:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801216:	89 df                	mov    %ebx,%edi
+  801218:	89 de                	mov    %ebx,%esi
+  80121a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80121c:	5b                   	pop    %ebx
+  80121d:	5e                   	pop    %esi
+  80121e:	5f                   	pop    %edi
+  80121f:	5d                   	pop    %ebp
+  801220:	c3                   	ret
+
+00801221 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801227:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801234:	89 cb                	mov    %ecx,%ebx
+  801236:	89 cf                	mov    %ecx,%edi
+  801238:	89 ce                	mov    %ecx,%esi
+  80123a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+
+00801241 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801252:	b8 11 00 00 00       	mov    $0x11,%eax
+  801257:	89 df                	mov    %ebx,%edi
+  801259:	89 de                	mov    %ebx,%esi
+  80125b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80125d:	5b                   	pop    %ebx
+  80125e:	5e                   	pop    %esi
+  80125f:	5f                   	pop    %edi
+  801260:	5d                   	pop    %ebp
+  801261:	c3                   	ret
+
+00801262 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	57                   	push   %edi
+  801266:	56                   	push   %esi
+  801267:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801273:	b8 12 00 00 00       	mov    $0x12,%eax
+  801278:	89 df                	mov    %ebx,%edi
+  80127a:	89 de                	mov    %ebx,%esi
+  80127c:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+
+00801283 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801289:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80128e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801291:	b8 13 00 00 00       	mov    $0x13,%eax
+  801296:	89 cb                	mov    %ecx,%ebx
+  801298:	89 cf                	mov    %ecx,%edi
+  80129a:	89 ce                	mov    %ecx,%esi
+  80129c:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80129e:	5b                   	pop    %ebx
+  80129f:	5e                   	pop    %esi
+  8012a0:	5f                   	pop    %edi
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+
+008012a3 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8012a3:	55                   	push   %ebp
+  8012a4:	89 e5                	mov    %esp,%ebp
+  8012a6:	57                   	push   %edi
+  8012a7:	56                   	push   %esi
+  8012a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012b9:	89 df                	mov    %ebx,%edi
+  8012bb:	89 de                	mov    %ebx,%esi
+  8012bd:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8012bf:	5b                   	pop    %ebx
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5f                   	pop    %edi
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+
+008012c4 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	57                   	push   %edi
+  8012c8:	56                   	push   %esi
+  8012c9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012d7:	89 cb                	mov    %ecx,%ebx
+  8012d9:	89 cf                	mov    %ecx,%edi
+  8012db:	89 ce                	mov    %ecx,%esi
+  8012dd:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8012df:	5b                   	pop    %ebx
+  8012e0:	5e                   	pop    %esi
+  8012e1:	5f                   	pop    %edi
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+
+008012e4 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8012e4:	55                   	push   %ebp
+  8012e5:	89 e5                	mov    %esp,%ebp
+  8012e7:	57                   	push   %edi
+  8012e8:	56                   	push   %esi
+  8012e9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fd:	89 f7                	mov    %esi,%edi
+  8012ff:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+
+00801306 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	57                   	push   %edi
+  80130a:	56                   	push   %esi
+  80130b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80130c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801311:	8b 55 08             	mov    0x8(%ebp),%edx
+  801314:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801317:	b8 17 00 00 00       	mov    $0x17,%eax
+  80131c:	89 df                	mov    %ebx,%edi
+  80131e:	89 de                	mov    %ebx,%esi
+  801320:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801322:	5b                   	pop    %ebx
+  801323:	5e                   	pop    %esi
+  801324:	5f                   	pop    %edi
+  801325:	5d                   	pop    %ebp
+  801326:	c3                   	ret
+
+00801327 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801327:	55                   	push   %ebp
+  801328:	89 e5                	mov    %esp,%ebp
+  80132a:	57                   	push   %edi
+  80132b:	56                   	push   %esi
+  80132c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80132d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801332:	8b 55 08             	mov    0x8(%ebp),%edx
+  801335:	b8 18 00 00 00       	mov    $0x18,%eax
+  80133a:	89 cb                	mov    %ecx,%ebx
+  80133c:	89 cf                	mov    %ecx,%edi
+  80133e:	89 ce                	mov    %ecx,%esi
+  801340:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801342:	5b                   	pop    %ebx
+  801343:	5e                   	pop    %esi
+  801344:	5f                   	pop    %edi
+  801345:	5d                   	pop    %ebp
+  801346:	c3                   	ret
+
+00801347 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	57                   	push   %edi
+  80134b:	56                   	push   %esi
+  80134c:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80134d:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 19 00 00 00       	mov    $0x19,%eax
+  80135e:	89 df                	mov    %ebx,%edi
+  801360:	89 de                	mov    %ebx,%esi
+  801362:	cd 30                	int    $0x30
+}
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+
+00801369 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	57                   	push   %edi
+  80136d:	56                   	push   %esi
+  80136e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80136f:	be 00 00 00 00       	mov    $0x0,%esi
+  801374:	8b 55 08             	mov    0x8(%ebp),%edx
+  801377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80137f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801382:	89 f7                	mov    %esi,%edi
+  801384:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+
+0080138b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  80138e:	57                   	push   %edi
+  80138f:	56                   	push   %esi
+  801390:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801391:	be 00 00 00 00       	mov    $0x0,%esi
+  801396:	8b 55 08             	mov    0x8(%ebp),%edx
+  801399:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a4:	89 f7                	mov    %esi,%edi
+  8013a6:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8013a8:	5b                   	pop    %ebx
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5f                   	pop    %edi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+
+008013ad <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	57                   	push   %edi
+  8013b1:	56                   	push   %esi
+  8013b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013be:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013c3:	89 df                	mov    %ebx,%edi
+  8013c5:	89 de                	mov    %ebx,%esi
+  8013c7:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8013c9:	5b                   	pop    %ebx
+  8013ca:	5e                   	pop    %esi
+  8013cb:	5f                   	pop    %edi
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+
+008013ce <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8013ce:	55                   	push   %ebp
+  8013cf:	89 e5                	mov    %esp,%ebp
+  8013d1:	57                   	push   %edi
+  8013d2:	56                   	push   %esi
+  8013d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013df:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e7:	89 f7                	mov    %esi,%edi
+  8013e9:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8013eb:	5b                   	pop    %ebx
+  8013ec:	5e                   	pop    %esi
+  8013ed:	5f                   	pop    %edi
+  8013ee:	5d                   	pop    %ebp
+  8013ef:	c3                   	ret
+
+008013f0 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	74 20                	je     801414 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8013f4:	89 c1                	mov    %eax,%ecx
+  8013f6:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8013fc:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  801402:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801408:	8b 52 48             	mov    0x48(%edx),%edx
+  80140b:	39 c2                	cmp    %eax,%edx
+  80140d:	74 06                	je     801415 <thread_alive+0x25>
+  80140f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801414:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801415:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  80141b:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801421:	85 c0                	test   %eax,%eax
+  801423:	0f 95 c0             	setne  %al
+  801426:	0f b6 c0             	movzbl %al,%eax
+  801429:	c3                   	ret
+
+0080142a <pgfault>:
+{
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+  801430:	83 ec 0c             	sub    $0xc,%esp
+  801433:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801436:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801438:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  80143b:	89 f3                	mov    %esi,%ebx
+  80143d:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801440:	83 3d a0 6a 80 00 00 	cmpl   $0x0,0x806aa0
+  801447:	74 52                	je     80149b <pgfault+0x71>
+  801449:	a8 02                	test   $0x2,%al
+  80144b:	75 14                	jne    801461 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  80144d:	83 ec 04             	sub    $0x4,%esp
+  801450:	68 f6 4a 80 00       	push   $0x804af6
+  801455:	6a 2e                	push   $0x2e
+  801457:	68 14 4b 80 00       	push   $0x804b14
+  80145c:	e8 26 ef ff ff       	call   800387 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801461:	89 d8                	mov    %ebx,%eax
+  801463:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801468:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	57                   	push   %edi
+  801473:	e8 3b 2c 00 00       	call   8040b3 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801478:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80147f:	83 e0 03             	and    $0x3,%eax
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	83 f8 03             	cmp    $0x3,%eax
+  801488:	75 1a                	jne    8014a4 <pgfault+0x7a>
+			mutex_unlock(m);
+  80148a:	83 ec 0c             	sub    $0xc,%esp
+  80148d:	57                   	push   %edi
+  80148e:	e8 8e 2c 00 00       	call   804121 <mutex_unlock>
+			return;
+  801493:	83 c4 10             	add    $0x10,%esp
+  801496:	e9 9f 00 00 00       	jmp    80153a <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80149b:	a8 02                	test   $0x2,%al
+  80149d:	74 ae                	je     80144d <pgfault+0x23>
+	struct mutex *m = NULL;
+  80149f:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8014a4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8014ab:	f6 c4 08             	test   $0x8,%ah
+  8014ae:	74 9d                	je     80144d <pgfault+0x23>
+  8014b0:	89 e0                	mov    %esp,%eax
+  8014b2:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8014b7:	29 c2                	sub    %eax,%edx
+  8014b9:	89 d0                	mov    %edx,%eax
+  8014bb:	c1 e8 0f             	shr    $0xf,%eax
+  8014be:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8014c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c9:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8014cc:	c1 e0 0c             	shl    $0xc,%eax
+  8014cf:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8014d4:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8014d6:	83 ec 04             	sub    $0x4,%esp
+  8014d9:	6a 07                	push   $0x7
+  8014db:	53                   	push   %ebx
+  8014dc:	6a 00                	push   $0x0
+  8014de:	e8 aa fa ff ff       	call   800f8d <sys_page_alloc>
+  8014e3:	83 c4 10             	add    $0x10,%esp
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	78 58                	js     801542 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8014ea:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8014f0:	83 ec 04             	sub    $0x4,%esp
+  8014f3:	68 00 10 00 00       	push   $0x1000
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+  8014fa:	e8 0a f8 ff ff       	call   800d09 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8014ff:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801506:	56                   	push   %esi
+  801507:	6a 00                	push   $0x0
+  801509:	53                   	push   %ebx
+  80150a:	6a 00                	push   $0x0
+  80150c:	e8 bf fa ff ff       	call   800fd0 <sys_page_map>
+  801511:	83 c4 20             	add    $0x20,%esp
+  801514:	85 c0                	test   %eax,%eax
+  801516:	78 3c                	js     801554 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801518:	83 ec 08             	sub    $0x8,%esp
+  80151b:	53                   	push   %ebx
+  80151c:	6a 00                	push   $0x0
+  80151e:	e8 ef fa ff ff       	call   801012 <sys_page_unmap>
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	85 c0                	test   %eax,%eax
+  801528:	78 3c                	js     801566 <pgfault+0x13c>
+	if(m)
+  80152a:	85 ff                	test   %edi,%edi
+  80152c:	74 0c                	je     80153a <pgfault+0x110>
+		mutex_unlock(m);
+  80152e:	83 ec 0c             	sub    $0xc,%esp
+  801531:	57                   	push   %edi
+  801532:	e8 ea 2b 00 00       	call   804121 <mutex_unlock>
+  801537:	83 c4 10             	add    $0x10,%esp
+}
+  80153a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153d:	5b                   	pop    %ebx
+  80153e:	5e                   	pop    %esi
+  80153f:	5f                   	pop    %edi
+  801540:	5d                   	pop    %ebp
+  801541:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801542:	50                   	push   %eax
+  801543:	68 aa 46 80 00       	push   $0x8046aa
+  801548:	6a 3d                	push   $0x3d
+  80154a:	68 14 4b 80 00       	push   $0x804b14
+  80154f:	e8 33 ee ff ff       	call   800387 <_panic>
+		panic("sys_page_map: %e", ret);
+  801554:	50                   	push   %eax
+  801555:	68 1f 4b 80 00       	push   $0x804b1f
+  80155a:	6a 40                	push   $0x40
+  80155c:	68 14 4b 80 00       	push   $0x804b14
+  801561:	e8 21 ee ff ff       	call   800387 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801566:	50                   	push   %eax
+  801567:	68 30 4b 80 00       	push   $0x804b30
+  80156c:	6a 42                	push   $0x42
+  80156e:	68 14 4b 80 00       	push   $0x804b14
+  801573:	e8 0f ee ff ff       	call   800387 <_panic>
+
+00801578 <thread_main>:
+{
+  801578:	55                   	push   %ebp
+  801579:	89 e5                	mov    %esp,%ebp
+  80157b:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  80157e:	ff 75 0c             	push   0xc(%ebp)
+  801581:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801584:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80158b:	e8 7e f9 ff ff       	call   800f0e <sys_env_destroy>
+}
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	c9                   	leave
+  801594:	c3                   	ret
+
+00801595 <fork>:
+{
+  801595:	55                   	push   %ebp
+  801596:	89 e5                	mov    %esp,%ebp
+  801598:	57                   	push   %edi
+  801599:	56                   	push   %esi
+  80159a:	53                   	push   %ebx
+  80159b:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  80159e:	68 2a 14 80 00       	push   $0x80142a
+  8015a3:	e8 57 2e 00 00       	call   8043ff <set_pgfault_handler>
+	if(sforked)
+  8015a8:	83 c4 10             	add    $0x10,%esp
+  8015ab:	83 3d a0 6a 80 00 00 	cmpl   $0x0,0x806aa0
+  8015b2:	75 33                	jne    8015e7 <fork+0x52>
+	__asm __volatile("int %2"
+  8015b4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015b9:	cd 30                	int    $0x30
+  8015bb:	89 c7                	mov    %eax,%edi
+  8015bd:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8015bf:	85 c0                	test   %eax,%eax
+  8015c1:	0f 88 b4 00 00 00    	js     80167b <fork+0xe6>
+	if(envid == 0) {
+  8015c7:	0f 84 c3 00 00 00    	je     801690 <fork+0xfb>
+	pgbatch_init(&pb);
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	68 40 63 80 00       	push   $0x806340
+  8015d5:	e8 25 29 00 00       	call   803eff <pgbatch_init>
+  8015da:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8015dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e2:	e9 9c 01 00 00       	jmp    801783 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8015e7:	83 ec 0c             	sub    $0xc,%esp
+  8015ea:	68 e0 66 80 00       	push   $0x8066e0
+  8015ef:	e8 bf 2a 00 00       	call   8040b3 <mutex_lock>
+  8015f4:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8015f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8015fc:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801601:	eb 08                	jmp    80160b <fork+0x76>
+  801603:	83 c3 01             	add    $0x1,%ebx
+  801606:	83 fb 20             	cmp    $0x20,%ebx
+  801609:	74 5b                	je     801666 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  80160b:	8b 34 9d 60 66 80 00 	mov    0x806660(,%ebx,4),%esi
+  801612:	89 f0                	mov    %esi,%eax
+  801614:	e8 d7 fd ff ff       	call   8013f0 <thread_alive>
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	74 e6                	je     801603 <fork+0x6e>
+  80161d:	89 e0                	mov    %esp,%eax
+  80161f:	89 fa                	mov    %edi,%edx
+  801621:	29 c2                	sub    %eax,%edx
+  801623:	89 d0                	mov    %edx,%eax
+  801625:	c1 e8 0f             	shr    $0xf,%eax
+  801628:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80162e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801633:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  801636:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80163d:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801640:	83 ec 08             	sub    $0x8,%esp
+  801643:	50                   	push   %eax
+  801644:	56                   	push   %esi
+  801645:	e8 8e fa ff ff       	call   8010d8 <sys_env_set_pgfault_upcall>
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	79 b2                	jns    801603 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801651:	50                   	push   %eax
+  801652:	68 bc 4b 80 00       	push   $0x804bbc
+  801657:	68 00 01 00 00       	push   $0x100
+  80165c:	68 14 4b 80 00       	push   $0x804b14
+  801661:	e8 21 ed ff ff       	call   800387 <_panic>
+	mutex_unlock(&sfork_lock);
+  801666:	83 ec 0c             	sub    $0xc,%esp
+  801669:	68 e0 66 80 00       	push   $0x8066e0
+  80166e:	e8 ae 2a 00 00       	call   804121 <mutex_unlock>
+}
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	e9 39 ff ff ff       	jmp    8015b4 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  80167b:	50                   	push   %eax
+  80167c:	68 43 4b 80 00       	push   $0x804b43
+  801681:	68 91 00 00 00       	push   $0x91
+  801686:	68 14 4b 80 00       	push   $0x804b14
+  80168b:	e8 f7 ec ff ff       	call   800387 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801690:	e8 ba f8 ff ff       	call   800f4f <sys_getenvid>
+  801695:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80169a:	89 e1                	mov    %esp,%ecx
+  80169c:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8016a1:	29 ca                	sub    %ecx,%edx
+  8016a3:	89 d1                	mov    %edx,%ecx
+  8016a5:	c1 e9 0f             	shr    $0xf,%ecx
+  8016a8:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8016ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b3:	0f 42 d1             	cmovb  %ecx,%edx
+  8016b6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8016bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016c1:	89 04 95 20 6a 80 00 	mov    %eax,0x806a20(,%edx,4)
+		if(sforked)
+  8016c8:	a1 a0 6a 80 00       	mov    0x806aa0,%eax
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	75 07                	jne    8016d8 <fork+0x143>
+		return 0;
+  8016d1:	89 c6                	mov    %eax,%esi
+  8016d3:	e9 6f 02 00 00       	jmp    801947 <fork+0x3b2>
+  8016d8:	89 e2                	mov    %esp,%edx
+  8016da:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016df:	29 d0                	sub    %edx,%eax
+  8016e1:	89 c3                	mov    %eax,%ebx
+  8016e3:	c1 eb 0f             	shr    $0xf,%ebx
+  8016e6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f0:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8016f3:	83 ec 04             	sub    $0x4,%esp
+  8016f6:	68 80 00 00 00       	push   $0x80
+  8016fb:	6a 00                	push   $0x0
+  8016fd:	68 60 66 80 00       	push   $0x806660
+  801702:	e8 cd f5 ff ff       	call   800cd4 <memset>
+	thread_ids[slot] = sys_getenvid();
+  801707:	e8 43 f8 ff ff       	call   800f4f <sys_getenvid>
+  80170c:	89 04 9d 60 66 80 00 	mov    %eax,0x806660(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  801713:	8b 04 9d 20 6a 80 00 	mov    0x806a20(,%ebx,4),%eax
+  80171a:	a3 20 6a 80 00       	mov    %eax,0x806a20
+	mutex_init(&sfork_lock);
+  80171f:	c7 04 24 e0 66 80 00 	movl   $0x8066e0,(%esp)
+  801726:	e8 7a 29 00 00       	call   8040a5 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80172b:	83 c4 0c             	add    $0xc,%esp
+  80172e:	68 07 04 00 00       	push   $0x407
+  801733:	68 00 00 00 e1       	push   $0xe1000000
+  801738:	6a 00                	push   $0x0
+  80173a:	e8 4e f8 ff ff       	call   800f8d <sys_page_alloc>
+  80173f:	83 c4 10             	add    $0x10,%esp
+  801742:	85 c0                	test   %eax,%eax
+  801744:	0f 89 fd 01 00 00    	jns    801947 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  80174a:	50                   	push   %eax
+  80174b:	68 aa 46 80 00       	push   $0x8046aa
+  801750:	68 12 01 00 00       	push   $0x112
+  801755:	68 14 4b 80 00       	push   $0x804b14
+  80175a:	e8 28 ec ff ff       	call   800387 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  80175f:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801765:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  80176b:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801771:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801777:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  80177d:	0f 87 4f 01 00 00    	ja     8018d2 <fork+0x33d>
+		pd = PDX(addr);
+  801783:	89 d8                	mov    %ebx,%eax
+  801785:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801788:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80178f:	f6 c2 01             	test   $0x1,%dl
+  801792:	74 cb                	je     80175f <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801794:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801799:	0f 85 92 00 00 00    	jne    801831 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  80179f:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8017a5:	76 10                	jbe    8017b7 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8017a7:	89 d8                	mov    %ebx,%eax
+  8017a9:	f7 d8                	neg    %eax
+  8017ab:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8017b0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017b5:	74 ba                	je     801771 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8017b7:	89 d8                	mov    %ebx,%eax
+  8017b9:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8017bc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017c3:	f6 c2 01             	test   $0x1,%dl
+  8017c6:	74 a9                	je     801771 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8017c8:	89 c1                	mov    %eax,%ecx
+  8017ca:	c1 e1 0c             	shl    $0xc,%ecx
+  8017cd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8017d0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017d7:	f6 c6 04             	test   $0x4,%dh
+  8017da:	0f 85 8e 00 00 00    	jne    80186e <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8017e0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017e7:	f6 c6 08             	test   $0x8,%dh
+  8017ea:	75 0f                	jne    8017fb <fork+0x266>
+  8017ec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017f3:	a8 02                	test   $0x2,%al
+  8017f5:	0f 84 bb 00 00 00    	je     8018b6 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8017fb:	83 ec 08             	sub    $0x8,%esp
+  8017fe:	68 05 08 00 00       	push   $0x805
+  801803:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801806:	50                   	push   %eax
+  801807:	56                   	push   %esi
+  801808:	50                   	push   %eax
+  801809:	6a 00                	push   $0x0
+  80180b:	68 40 63 80 00       	push   $0x806340
+  801810:	e8 a8 27 00 00       	call   803fbd <pgbatch_map>
+  801815:	83 c4 20             	add    $0x20,%esp
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	79 76                	jns    801892 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  80181c:	50                   	push   %eax
+  80181d:	68 67 4b 80 00       	push   $0x804b67
+  801822:	68 bc 00 00 00       	push   $0xbc
+  801827:	68 14 4b 80 00       	push   $0x804b14
+  80182c:	e8 56 eb ff ff       	call   800387 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801831:	83 ec 0c             	sub    $0xc,%esp
+  801834:	68 00 08 00 00       	push   $0x800
+  801839:	56                   	push   %esi
+  80183a:	53                   	push   %ebx
+  80183b:	6a 00                	push   $0x0
+  80183d:	68 40 63 80 00       	push   $0x806340
+  801842:	e8 21 28 00 00       	call   804068 <pgbatch_sharept>
+  801847:	83 c4 20             	add    $0x20,%esp
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 0b                	js     801859 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  80184e:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801854:	e9 18 ff ff ff       	jmp    801771 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801859:	50                   	push   %eax
+  80185a:	68 53 4b 80 00       	push   $0x804b53
+  80185f:	68 b2 00 00 00       	push   $0xb2
+  801864:	68 14 4b 80 00       	push   $0x804b14
+  801869:	e8 19 eb ff ff       	call   800387 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  80186e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801875:	83 ec 08             	sub    $0x8,%esp
+  801878:	25 07 0e 00 00       	and    $0xe07,%eax
+  80187d:	50                   	push   %eax
+  80187e:	51                   	push   %ecx
+  80187f:	56                   	push   %esi
+  801880:	51                   	push   %ecx
+  801881:	6a 00                	push   $0x0
+  801883:	68 40 63 80 00       	push   $0x806340
+  801888:	e8 30 27 00 00       	call   803fbd <pgbatch_map>
+  80188d:	83 c4 20             	add    $0x20,%esp
+  801890:	eb 17                	jmp    8018a9 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801892:	68 05 08 00 00       	push   $0x805
+  801897:	ff 75 e4             	push   -0x1c(%ebp)
+  80189a:	6a 00                	push   $0x0
+  80189c:	68 40 63 80 00       	push   $0x806340
+  8018a1:	e8 8b 27 00 00       	call   804031 <pgbatch_protect>
+  8018a6:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8018a9:	85 c0                	test   %eax,%eax
+  8018ab:	0f 89 c0 fe ff ff    	jns    801771 <fork+0x1dc>
+  8018b1:	e9 66 ff ff ff       	jmp    80181c <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8018b6:	83 ec 08             	sub    $0x8,%esp
+  8018b9:	6a 05                	push   $0x5
+  8018bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018be:	50                   	push   %eax
+  8018bf:	56                   	push   %esi
+  8018c0:	50                   	push   %eax
+  8018c1:	6a 00                	push   $0x0
+  8018c3:	68 40 63 80 00       	push   $0x806340
+  8018c8:	e8 f0 26 00 00       	call   803fbd <pgbatch_map>
+  8018cd:	83 c4 20             	add    $0x20,%esp
+  8018d0:	eb d7                	jmp    8018a9 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  8018d2:	6a 07                	push   $0x7
+  8018d4:	68 00 f0 bf ee       	push   $0xeebff000
+  8018d9:	57                   	push   %edi
+  8018da:	68 40 63 80 00       	push   $0x806340
+  8018df:	e8 a2 26 00 00       	call   803f86 <pgbatch_alloc>
+  8018e4:	83 c4 10             	add    $0x10,%esp
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	78 66                	js     801951 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8018eb:	83 ec 0c             	sub    $0xc,%esp
+  8018ee:	68 40 63 80 00       	push   $0x806340
+  8018f3:	e8 15 26 00 00       	call   803f0d <pgbatch_flush>
+  8018f8:	83 c4 10             	add    $0x10,%esp
+  8018fb:	85 c0                	test   %eax,%eax
+  8018fd:	78 52                	js     801951 <fork+0x3bc>
+  8018ff:	89 e2                	mov    %esp,%edx
+  801901:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801906:	29 d0                	sub    %edx,%eax
+  801908:	89 c2                	mov    %eax,%edx
+  80190a:	c1 ea 0f             	shr    $0xf,%edx
+  80190d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801912:	b8 00 00 00 00       	mov    $0x0,%eax
+  801917:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  80191a:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801921:	8b 40 78             	mov    0x78(%eax),%eax
+  801924:	83 ec 08             	sub    $0x8,%esp
+  801927:	50                   	push   %eax
+  801928:	57                   	push   %edi
+  801929:	e8 aa f7 ff ff       	call   8010d8 <sys_env_set_pgfault_upcall>
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	85 c0                	test   %eax,%eax
+  801933:	78 31                	js     801966 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801935:	83 ec 08             	sub    $0x8,%esp
+  801938:	6a 02                	push   $0x2
+  80193a:	57                   	push   %edi
+  80193b:	e8 14 f7 ff ff       	call   801054 <sys_env_set_status>
+  801940:	83 c4 10             	add    $0x10,%esp
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 34                	js     80197b <fork+0x3e6>
+}
+  801947:	89 f0                	mov    %esi,%eax
+  801949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194c:	5b                   	pop    %ebx
+  80194d:	5e                   	pop    %esi
+  80194e:	5f                   	pop    %edi
+  80194f:	5d                   	pop    %ebp
+  801950:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801951:	50                   	push   %eax
+  801952:	68 73 4b 80 00       	push   $0x804b73
+  801957:	68 c0 00 00 00       	push   $0xc0
+  80195c:	68 14 4b 80 00       	push   $0x804b14
+  801961:	e8 21 ea ff ff       	call   800387 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801966:	50                   	push   %eax
+  801967:	68 88 4b 80 00       	push   $0x804b88
+  80196c:	68 c2 00 00 00       	push   $0xc2
+  801971:	68 14 4b 80 00       	push   $0x804b14
+  801976:	e8 0c ea ff ff       	call   800387 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  80197b:	50                   	push   %eax
+  80197c:	68 a3 4b 80 00       	push   $0x804ba3
+  801981:	68 c4 00 00 00       	push   $0xc4
+  801986:	68 14 4b 80 00       	push   $0x804b14
+  80198b:	e8 f7 e9 ff ff       	call   800387 <_panic>
+
+00801990 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801990:	55                   	push   %ebp
+  801991:	89 e5                	mov    %esp,%ebp
+  801993:	57                   	push   %edi
+  801994:	56                   	push   %esi
+  801995:	53                   	push   %ebx
+  801996:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801999:	68 e0 66 80 00       	push   $0x8066e0
+  80199e:	e8 10 27 00 00       	call   8040b3 <mutex_lock>
+  8019a3:	89 e2                	mov    %esp,%edx
+  8019a5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8019aa:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  8019ac:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8019af:	89 c3                	mov    %eax,%ebx
+  8019b1:	c1 eb 0f             	shr    $0xf,%ebx
+  8019b4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019be:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  8019c1:	e8 89 f5 ff ff       	call   800f4f <sys_getenvid>
+  8019c6:	89 04 9d 60 66 80 00 	mov    %eax,0x806660(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  8019cd:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8019d2:	8b 04 9d 60 66 80 00 	mov    0x806660(,%ebx,4),%eax
+  8019d9:	e8 12 fa ff ff       	call   8013f0 <thread_alive>
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	74 24                	je     801a06 <sfork+0x76>
+  8019e2:	83 c3 01             	add    $0x1,%ebx
+  8019e5:	83 fb 20             	cmp    $0x20,%ebx
+  8019e8:	75 e8                	jne    8019d2 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  8019ea:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  8019ef:	83 ec 0c             	sub    $0xc,%esp
+  8019f2:	68 e0 66 80 00       	push   $0x8066e0
+  8019f7:	e8 25 27 00 00       	call   804121 <mutex_unlock>
+	return r;
+}
+  8019fc:	89 f0                	mov    %esi,%eax
+  8019fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a01:	5b                   	pop    %ebx
+  801a02:	5e                   	pop    %esi
+  801a03:	5f                   	pop    %edi
+  801a04:	5d                   	pop    %ebp
+  801a05:	c3                   	ret
+	if (i == NTHREADS) {
+  801a06:	83 fb 20             	cmp    $0x20,%ebx
+  801a09:	0f 84 53 01 00 00    	je     801b62 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801a0f:	89 d8                	mov    %ebx,%eax
+  801a11:	c1 e0 0f             	shl    $0xf,%eax
+  801a14:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801a17:	83 ec 0c             	sub    $0xc,%esp
+  801a1a:	68 20 60 80 00       	push   $0x806020
+  801a1f:	e8 db 24 00 00       	call   803eff <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801a24:	83 c4 10             	add    $0x10,%esp
+  801a27:	83 3d a0 6a 80 00 00 	cmpl   $0x0,0x806aa0
+  801a2e:	75 1f                	jne    801a4f <sfork+0xbf>
+  801a30:	68 07 04 00 00       	push   $0x407
+  801a35:	68 00 00 00 e1       	push   $0xe1000000
+  801a3a:	6a 00                	push   $0x0
+  801a3c:	68 20 60 80 00       	push   $0x806020
+  801a41:	e8 40 25 00 00       	call   803f86 <pgbatch_alloc>
+  801a46:	89 c6                	mov    %eax,%esi
+  801a48:	83 c4 10             	add    $0x10,%esp
+  801a4b:	85 c0                	test   %eax,%eax
+  801a4d:	78 a0                	js     8019ef <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801a4f:	6a 07                	push   $0x7
+  801a51:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801a56:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a59:	29 c8                	sub    %ecx,%eax
+  801a5b:	50                   	push   %eax
+  801a5c:	6a 00                	push   $0x0
+  801a5e:	68 20 60 80 00       	push   $0x806020
+  801a63:	e8 1e 25 00 00       	call   803f86 <pgbatch_alloc>
+  801a68:	89 c6                	mov    %eax,%esi
+  801a6a:	83 c4 10             	add    $0x10,%esp
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	0f 88 7a ff ff ff    	js     8019ef <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801a75:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801a7a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a7d:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801a7f:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801a84:	29 c8                	sub    %ecx,%eax
+  801a86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a89:	39 c7                	cmp    %eax,%edi
+  801a8b:	73 29                	jae    801ab6 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801a8d:	6a 07                	push   $0x7
+  801a8f:	57                   	push   %edi
+  801a90:	6a 00                	push   $0x0
+  801a92:	68 20 60 80 00       	push   $0x806020
+  801a97:	e8 ea 24 00 00       	call   803f86 <pgbatch_alloc>
+  801a9c:	89 c6                	mov    %eax,%esi
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	0f 88 46 ff ff ff    	js     8019ef <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801aa9:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801aaf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ab2:	39 c7                	cmp    %eax,%edi
+  801ab4:	72 d7                	jb     801a8d <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801ab6:	83 ec 0c             	sub    $0xc,%esp
+  801ab9:	68 20 60 80 00       	push   $0x806020
+  801abe:	e8 4a 24 00 00       	call   803f0d <pgbatch_flush>
+  801ac3:	89 c6                	mov    %eax,%esi
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	0f 88 1f ff ff ff    	js     8019ef <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801ad0:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801ad5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ad8:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801ada:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801ae0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae3:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801ae6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ae9:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801aec:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801aef:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801af4:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801af6:	52                   	push   %edx
+  801af7:	50                   	push   %eax
+  801af8:	68 78 15 80 00       	push   $0x801578
+  801afd:	e8 cc f8 ff ff       	call   8013ce <sys_exofork_shared>
+  801b02:	89 c6                	mov    %eax,%esi
+  801b04:	83 c4 10             	add    $0x10,%esp
+  801b07:	85 c0                	test   %eax,%eax
+  801b09:	0f 88 e0 fe ff ff    	js     8019ef <sfork+0x5f>
+	thread_ids[i] = id;
+  801b0f:	89 04 9d 60 66 80 00 	mov    %eax,0x806660(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801b16:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b1b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801b21:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b26:	89 04 9d 20 6a 80 00 	mov    %eax,0x806a20(,%ebx,4)
+	sforked = 1;
+  801b2d:	c7 05 a0 6a 80 00 01 	movl   $0x1,0x806aa0
+  801b34:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b37:	83 ec 08             	sub    $0x8,%esp
+  801b3a:	6a 02                	push   $0x2
+  801b3c:	56                   	push   %esi
+  801b3d:	e8 12 f5 ff ff       	call   801054 <sys_env_set_status>
+  801b42:	89 c3                	mov    %eax,%ebx
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	85 c0                	test   %eax,%eax
+  801b49:	0f 89 a0 fe ff ff    	jns    8019ef <sfork+0x5f>
+		sys_env_destroy(id);
+  801b4f:	83 ec 0c             	sub    $0xc,%esp
+  801b52:	56                   	push   %esi
+  801b53:	e8 b6 f3 ff ff       	call   800f0e <sys_env_destroy>
+		goto out;
+  801b58:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b5b:	89 de                	mov    %ebx,%esi
+		goto out;
+  801b5d:	e9 8d fe ff ff       	jmp    8019ef <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801b62:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801b67:	e9 83 fe ff ff       	jmp    8019ef <sfork+0x5f>
+
+00801b6c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	56                   	push   %esi
+  801b70:	53                   	push   %ebx
+  801b71:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801b81:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801b84:	83 ec 0c             	sub    $0xc,%esp
+  801b87:	50                   	push   %eax
+  801b88:	e8 b0 f5 ff ff       	call   80113d <sys_ipc_recv>
+  801b8d:	83 c4 10             	add    $0x10,%esp
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	0f 88 8b 00 00 00    	js     801c23 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801b98:	85 f6                	test   %esi,%esi
+  801b9a:	74 2a                	je     801bc6 <ipc_recv+0x5a>
+  801b9c:	89 e2                	mov    %esp,%edx
+  801b9e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ba3:	29 d0                	sub    %edx,%eax
+  801ba5:	89 c2                	mov    %eax,%edx
+  801ba7:	c1 ea 0f             	shr    $0xf,%edx
+  801baa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb4:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801bb7:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801bbe:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801bc4:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  801bc6:	85 db                	test   %ebx,%ebx
+  801bc8:	74 2a                	je     801bf4 <ipc_recv+0x88>
+  801bca:	89 e2                	mov    %esp,%edx
+  801bcc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bd1:	29 d0                	sub    %edx,%eax
+  801bd3:	89 c2                	mov    %eax,%edx
+  801bd5:	c1 ea 0f             	shr    $0xf,%edx
+  801bd8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be2:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801be5:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801bec:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801bf2:	89 03                	mov    %eax,(%ebx)
+  801bf4:	89 e2                	mov    %esp,%edx
+  801bf6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bfb:	29 d0                	sub    %edx,%eax
+  801bfd:	89 c2                	mov    %eax,%edx
+  801bff:	c1 ea 0f             	shr    $0xf,%edx
+  801c02:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0c:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801c0f:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801c16:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801c1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1f:	5b                   	pop    %ebx
+  801c20:	5e                   	pop    %esi
+  801c21:	5d                   	pop    %ebp
+  801c22:	c3                   	ret
+		if(from_env_store != NULL)
+  801c23:	85 f6                	test   %esi,%esi
+  801c25:	74 06                	je     801c2d <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801c27:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801c2d:	85 db                	test   %ebx,%ebx
+  801c2f:	74 eb                	je     801c1c <ipc_recv+0xb0>
+			*perm_store = 0;
+  801c31:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801c37:	eb e3                	jmp    801c1c <ipc_recv+0xb0>
+
+00801c39 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801c39:	55                   	push   %ebp
+  801c3a:	89 e5                	mov    %esp,%ebp
+  801c3c:	57                   	push   %edi
+  801c3d:	56                   	push   %esi
+  801c3e:	53                   	push   %ebx
+  801c3f:	83 ec 14             	sub    $0x14,%esp
+  801c42:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c48:	8b 75 14             	mov    0x14(%ebp),%esi
+  801c4b:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801c4e:	85 c0                	test   %eax,%eax
+  801c50:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801c55:	0f 44 c2             	cmove  %edx,%eax
+  801c58:	ff 75 10             	push   0x10(%ebp)
+  801c5b:	50                   	push   %eax
+  801c5c:	e8 3e f5 ff ff       	call   80119f <sys_ipc_recv_pages>
+  801c61:	83 c4 10             	add    $0x10,%esp
+  801c64:	85 c0                	test   %eax,%eax
+  801c66:	0f 88 ba 00 00 00    	js     801d26 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801c6c:	85 ff                	test   %edi,%edi
+  801c6e:	74 2a                	je     801c9a <ipc_recv_pages+0x61>
+  801c70:	89 e2                	mov    %esp,%edx
+  801c72:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c77:	29 d0                	sub    %edx,%eax
+  801c79:	89 c2                	mov    %eax,%edx
+  801c7b:	c1 ea 0f             	shr    $0xf,%edx
+  801c7e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c88:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801c8b:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801c92:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801c98:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801c9a:	85 f6                	test   %esi,%esi
+  801c9c:	74 2a                	je     801cc8 <ipc_recv_pages+0x8f>
+  801c9e:	89 e2                	mov    %esp,%edx
+  801ca0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ca5:	29 d0                	sub    %edx,%eax
+  801ca7:	89 c2                	mov    %eax,%edx
+  801ca9:	c1 ea 0f             	shr    $0xf,%edx
+  801cac:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb6:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801cb9:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801cc0:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801cc6:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801cc8:	85 db                	test   %ebx,%ebx
+  801cca:	74 2a                	je     801cf6 <ipc_recv_pages+0xbd>
+  801ccc:	89 e2                	mov    %esp,%edx
+  801cce:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801cd3:	29 d0                	sub    %edx,%eax
+  801cd5:	89 c2                	mov    %eax,%edx
+  801cd7:	c1 ea 0f             	shr    $0xf,%edx
+  801cda:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce4:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801ce7:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801cee:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801cf4:	89 03                	mov    %eax,(%ebx)
+  801cf6:	89 e2                	mov    %esp,%edx
+  801cf8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801cfd:	29 d0                	sub    %edx,%eax
+  801cff:	89 c2                	mov    %eax,%edx
+  801d01:	c1 ea 0f             	shr    $0xf,%edx
+  801d04:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0e:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801d11:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801d18:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801d1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d21:	5b                   	pop    %ebx
+  801d22:	5e                   	pop    %esi
+  801d23:	5f                   	pop    %edi
+  801d24:	5d                   	pop    %ebp
+  801d25:	c3                   	ret
+		if (from_env_store)
+  801d26:	85 ff                	test   %edi,%edi
+  801d28:	74 06                	je     801d30 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801d2a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801d30:	85 f6                	test   %esi,%esi
+  801d32:	74 06                	je     801d3a <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801d34:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801d3a:	85 db                	test   %ebx,%ebx
+  801d3c:	74 e0                	je     801d1e <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801d3e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801d44:	eb d8                	jmp    801d1e <ipc_recv_pages+0xe5>
+
+00801d46 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801d46:	55                   	push   %ebp
+  801d47:	89 e5                	mov    %esp,%ebp
+  801d49:	57                   	push   %edi
+  801d4a:	56                   	push   %esi
+  801d4b:	53                   	push   %ebx
+  801d4c:	83 ec 1c             	sub    $0x1c,%esp
+  801d4f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801d52:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d55:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801d5b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801d5f:	75 2b                	jne    801d8c <ipc_try_send_pages+0x46>
+  801d61:	89 e2                	mov    %esp,%edx
+  801d63:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d68:	29 d0                	sub    %edx,%eax
+  801d6a:	89 c2                	mov    %eax,%edx
+  801d6c:	c1 ea 0f             	shr    $0xf,%edx
+  801d6f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d79:	0f 42 c2             	cmovb  %edx,%eax
+  801d7c:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801d83:	8b 70 48             	mov    0x48(%eax),%esi
+  801d86:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801d8c:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801d92:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801d97:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d9a:	85 ff                	test   %edi,%edi
+  801d9c:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801da1:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  801da4:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801daa:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801db0:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  801db6:	83 ec 0c             	sub    $0xc,%esp
+  801db9:	ff 75 14             	push   0x14(%ebp)
+  801dbc:	ff 75 18             	push   0x18(%ebp)
+  801dbf:	57                   	push   %edi
+  801dc0:	ff 75 0c             	push   0xc(%ebp)
+  801dc3:	ff 75 08             	push   0x8(%ebp)
+  801dc6:	e8 b3 f3 ff ff       	call   80117e <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801dcb:	83 c4 20             	add    $0x20,%esp
+  801dce:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801dd1:	75 21                	jne    801df4 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801dd3:	83 ec 04             	sub    $0x4,%esp
+  801dd6:	6a ff                	push   $0xffffffff
+  801dd8:	53                   	push   %ebx
+  801dd9:	ff 75 e4             	push   -0x1c(%ebp)
+  801ddc:	e8 aa f5 ff ff       	call   80138b <sys_futex_wait>
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801de7:	74 c7                	je     801db0 <ipc_try_send_pages+0x6a>
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	79 c3                	jns    801db0 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801ded:	e8 7c f1 ff ff       	call   800f6e <sys_yield>
+  801df2:	eb bc                	jmp    801db0 <ipc_try_send_pages+0x6a>
+	}
+}
+  801df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df7:	5b                   	pop    %ebx
+  801df8:	5e                   	pop    %esi
+  801df9:	5f                   	pop    %edi
+  801dfa:	5d                   	pop    %ebp
+  801dfb:	c3                   	ret
+
+00801dfc <ipc_send>:
+{
+  801dfc:	55                   	push   %ebp
+  801dfd:	89 e5                	mov    %esp,%ebp
+  801dff:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801e02:	ff 75 14             	push   0x14(%ebp)
+  801e05:	6a 01                	push   $0x1
+  801e07:	ff 75 10             	push   0x10(%ebp)
+  801e0a:	ff 75 0c             	push   0xc(%ebp)
+  801e0d:	ff 75 08             	push   0x8(%ebp)
+  801e10:	e8 31 ff ff ff       	call   801d46 <ipc_try_send_pages>
+  801e15:	83 c4 20             	add    $0x20,%esp
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	78 02                	js     801e1e <ipc_send+0x22>
+}
+  801e1c:	c9                   	leave
+  801e1d:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801e1e:	50                   	push   %eax
+  801e1f:	68 db 4b 80 00       	push   $0x804bdb
+  801e24:	6a 3f                	push   $0x3f
+  801e26:	68 f0 4b 80 00       	push   $0x804bf0
+  801e2b:	e8 57 e5 ff ff       	call   800387 <_panic>
+
+00801e30 <ipc_send_pages>:
+{
+  801e30:	55                   	push   %ebp
+  801e31:	89 e5                	mov    %esp,%ebp
+  801e33:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801e36:	ff 75 18             	push   0x18(%ebp)
+  801e39:	ff 75 14             	push   0x14(%ebp)
+  801e3c:	ff 75 10             	push   0x10(%ebp)
+  801e3f:	ff 75 0c             	push   0xc(%ebp)
+  801e42:	ff 75 08             	push   0x8(%ebp)
+  801e45:	e8 fc fe ff ff       	call   801d46 <ipc_try_send_pages>
+  801e4a:	83 c4 20             	add    $0x20,%esp
+  801e4d:	85 c0                	test   %eax,%eax
+  801e4f:	78 02                	js     801e53 <ipc_send_pages+0x23>
+}
+  801e51:	c9                   	leave
+  801e52:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801e53:	50                   	push   %eax
+  801e54:	68 fa 4b 80 00       	push   $0x804bfa
+  801e59:	6a 64                	push   $0x64
+  801e5b:	68 f0 4b 80 00       	push   $0x804bf0
+  801e60:	e8 22 e5 ff ff       	call   800387 <_panic>
+
+00801e65 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801e65:	55                   	push   %ebp
+  801e66:	89 e5                	mov    %esp,%ebp
+  801e68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801e70:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801e76:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801e7c:	8b 52 50             	mov    0x50(%edx),%edx
+  801e7f:	39 ca                	cmp    %ecx,%edx
+  801e81:	74 11                	je     801e94 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801e83:	83 c0 01             	add    $0x1,%eax
+  801e86:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801e8b:	75 e3                	jne    801e70 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e92:	eb 0e                	jmp    801ea2 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801e94:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801e9a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e9f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801ea2:	5d                   	pop    %ebp
+  801ea3:	c3                   	ret
+
+00801ea4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eaa:	05 00 00 00 30       	add    $0x30000000,%eax
+  801eaf:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801eb2:	5d                   	pop    %ebp
+  801eb3:	c3                   	ret
+
+00801eb4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801eb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eba:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801ebf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ec4:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801ec9:	5d                   	pop    %ebp
+  801eca:	c3                   	ret
+
+00801ecb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801ecb:	55                   	push   %ebp
+  801ecc:	89 e5                	mov    %esp,%ebp
+  801ece:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801ed3:	89 c2                	mov    %eax,%edx
+  801ed5:	c1 ea 16             	shr    $0x16,%edx
+  801ed8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801edf:	f6 c2 01             	test   $0x1,%dl
+  801ee2:	74 29                	je     801f0d <fd_alloc+0x42>
+  801ee4:	89 c2                	mov    %eax,%edx
+  801ee6:	c1 ea 0c             	shr    $0xc,%edx
+  801ee9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ef0:	f6 c2 01             	test   $0x1,%dl
+  801ef3:	74 18                	je     801f0d <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801ef5:	05 00 10 00 00       	add    $0x1000,%eax
+  801efa:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801eff:	75 d2                	jne    801ed3 <fd_alloc+0x8>
+  801f01:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801f06:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f0b:	eb 05                	jmp    801f12 <fd_alloc+0x47>
+			return 0;
+  801f0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f15:	89 02                	mov    %eax,(%edx)
+}
+  801f17:	89 c8                	mov    %ecx,%eax
+  801f19:	5d                   	pop    %ebp
+  801f1a:	c3                   	ret
+
+00801f1b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801f21:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801f26:	77 30                	ja     801f58 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801f28:	c1 e0 0c             	shl    $0xc,%eax
+  801f2b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801f30:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801f36:	f6 c2 01             	test   $0x1,%dl
+  801f39:	74 24                	je     801f5f <fd_lookup+0x44>
+  801f3b:	89 c2                	mov    %eax,%edx
+  801f3d:	c1 ea 0c             	shr    $0xc,%edx
+  801f40:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f47:	f6 c2 01             	test   $0x1,%dl
+  801f4a:	74 1a                	je     801f66 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801f4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f4f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801f51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f56:	5d                   	pop    %ebp
+  801f57:	c3                   	ret
+		return -E_INVAL;
+  801f58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5d:	eb f7                	jmp    801f56 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801f5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f64:	eb f0                	jmp    801f56 <fd_lookup+0x3b>
+  801f66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6b:	eb e9                	jmp    801f56 <fd_lookup+0x3b>
+
+00801f6d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801f6d:	55                   	push   %ebp
+  801f6e:	89 e5                	mov    %esp,%ebp
+  801f70:	53                   	push   %ebx
+  801f71:	83 ec 04             	sub    $0x4,%esp
+  801f74:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7c:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801f81:	39 13                	cmp    %edx,(%ebx)
+  801f83:	74 54                	je     801fd9 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801f85:	83 c0 01             	add    $0x1,%eax
+  801f88:	8b 1c 85 94 4c 80 00 	mov    0x804c94(,%eax,4),%ebx
+  801f8f:	85 db                	test   %ebx,%ebx
+  801f91:	75 ee                	jne    801f81 <dev_lookup+0x14>
+  801f93:	89 e1                	mov    %esp,%ecx
+  801f95:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f9a:	29 c8                	sub    %ecx,%eax
+  801f9c:	89 c1                	mov    %eax,%ecx
+  801f9e:	c1 e9 0f             	shr    $0xf,%ecx
+  801fa1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fab:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801fae:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801fb5:	8b 40 48             	mov    0x48(%eax),%eax
+  801fb8:	83 ec 04             	sub    $0x4,%esp
+  801fbb:	52                   	push   %edx
+  801fbc:	50                   	push   %eax
+  801fbd:	68 18 4c 80 00       	push   $0x804c18
+  801fc2:	e8 9b e4 ff ff       	call   800462 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801fc7:	83 c4 10             	add    $0x10,%esp
+  801fca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801fcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fd2:	89 1a                	mov    %ebx,(%edx)
+}
+  801fd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd7:	c9                   	leave
+  801fd8:	c3                   	ret
+			return 0;
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fde:	eb ef                	jmp    801fcf <dev_lookup+0x62>
+
+00801fe0 <fd_close>:
+{
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	57                   	push   %edi
+  801fe4:	56                   	push   %esi
+  801fe5:	53                   	push   %ebx
+  801fe6:	83 ec 24             	sub    $0x24,%esp
+  801fe9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801fef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ff2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ff3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ff9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ffc:	50                   	push   %eax
+  801ffd:	e8 19 ff ff ff       	call   801f1b <fd_lookup>
+  802002:	89 c3                	mov    %eax,%ebx
+  802004:	83 c4 10             	add    $0x10,%esp
+  802007:	85 c0                	test   %eax,%eax
+  802009:	78 05                	js     802010 <fd_close+0x30>
+	    || fd != fd2)
+  80200b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80200e:	74 0f                	je     80201f <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  802010:	85 ff                	test   %edi,%edi
+  802012:	0f 44 df             	cmove  %edi,%ebx
+}
+  802015:	89 d8                	mov    %ebx,%eax
+  802017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80201a:	5b                   	pop    %ebx
+  80201b:	5e                   	pop    %esi
+  80201c:	5f                   	pop    %edi
+  80201d:	5d                   	pop    %ebp
+  80201e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80201f:	83 ec 08             	sub    $0x8,%esp
+  802022:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802025:	50                   	push   %eax
+  802026:	ff 36                	push   (%esi)
+  802028:	e8 40 ff ff ff       	call   801f6d <dev_lookup>
+  80202d:	89 c3                	mov    %eax,%ebx
+  80202f:	83 c4 10             	add    $0x10,%esp
+  802032:	85 c0                	test   %eax,%eax
+  802034:	78 1a                	js     802050 <fd_close+0x70>
+		if (dev->dev_close)
+  802036:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802039:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80203c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802041:	85 c0                	test   %eax,%eax
+  802043:	74 0b                	je     802050 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  802045:	83 ec 0c             	sub    $0xc,%esp
+  802048:	56                   	push   %esi
+  802049:	ff d0                	call   *%eax
+  80204b:	89 c3                	mov    %eax,%ebx
+  80204d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802050:	83 ec 08             	sub    $0x8,%esp
+  802053:	56                   	push   %esi
+  802054:	6a 00                	push   $0x0
+  802056:	e8 b7 ef ff ff       	call   801012 <sys_page_unmap>
+	return r;
+  80205b:	83 c4 10             	add    $0x10,%esp
+  80205e:	eb b5                	jmp    802015 <fd_close+0x35>
+
+00802060 <close>:
+
+int
+close(int fdnum)
+{
+  802060:	55                   	push   %ebp
+  802061:	89 e5                	mov    %esp,%ebp
+  802063:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802066:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802069:	50                   	push   %eax
+  80206a:	ff 75 08             	push   0x8(%ebp)
+  80206d:	e8 a9 fe ff ff       	call   801f1b <fd_lookup>
+  802072:	83 c4 10             	add    $0x10,%esp
+  802075:	85 c0                	test   %eax,%eax
+  802077:	79 02                	jns    80207b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802079:	c9                   	leave
+  80207a:	c3                   	ret
+		return fd_close(fd, 1);
+  80207b:	83 ec 08             	sub    $0x8,%esp
+  80207e:	6a 01                	push   $0x1
+  802080:	ff 75 f4             	push   -0xc(%ebp)
+  802083:	e8 58 ff ff ff       	call   801fe0 <fd_close>
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	eb ec                	jmp    802079 <close+0x19>
+
+0080208d <close_all>:
+
+void
+close_all(void)
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	53                   	push   %ebx
+  802091:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802094:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802099:	83 ec 0c             	sub    $0xc,%esp
+  80209c:	53                   	push   %ebx
+  80209d:	e8 be ff ff ff       	call   802060 <close>
+	for (i = 0; i < MAXFD; i++)
+  8020a2:	83 c3 01             	add    $0x1,%ebx
+  8020a5:	83 c4 10             	add    $0x10,%esp
+  8020a8:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8020ae:	75 e9                	jne    802099 <close_all+0xc>
+}
+  8020b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b3:	c9                   	leave
+  8020b4:	c3                   	ret
+
+008020b5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	57                   	push   %edi
+  8020b9:	56                   	push   %esi
+  8020ba:	53                   	push   %ebx
+  8020bb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8020be:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020c1:	50                   	push   %eax
+  8020c2:	ff 75 08             	push   0x8(%ebp)
+  8020c5:	e8 51 fe ff ff       	call   801f1b <fd_lookup>
+  8020ca:	89 c3                	mov    %eax,%ebx
+  8020cc:	83 c4 10             	add    $0x10,%esp
+  8020cf:	85 c0                	test   %eax,%eax
+  8020d1:	78 7f                	js     802152 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8020d3:	83 ec 0c             	sub    $0xc,%esp
+  8020d6:	ff 75 0c             	push   0xc(%ebp)
+  8020d9:	e8 82 ff ff ff       	call   802060 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8020de:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020e1:	c1 e6 0c             	shl    $0xc,%esi
+  8020e4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8020ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8020ed:	89 3c 24             	mov    %edi,(%esp)
+  8020f0:	e8 bf fd ff ff       	call   801eb4 <fd2data>
+  8020f5:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8020f7:	89 34 24             	mov    %esi,(%esp)
+  8020fa:	e8 b5 fd ff ff       	call   801eb4 <fd2data>
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  802105:	89 d8                	mov    %ebx,%eax
+  802107:	c1 e8 16             	shr    $0x16,%eax
+  80210a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802111:	a8 01                	test   $0x1,%al
+  802113:	74 11                	je     802126 <dup+0x71>
+  802115:	89 d8                	mov    %ebx,%eax
+  802117:	c1 e8 0c             	shr    $0xc,%eax
+  80211a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802121:	f6 c2 01             	test   $0x1,%dl
+  802124:	75 36                	jne    80215c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802126:	89 f8                	mov    %edi,%eax
+  802128:	c1 e8 0c             	shr    $0xc,%eax
+  80212b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802132:	83 ec 0c             	sub    $0xc,%esp
+  802135:	25 07 0e 00 00       	and    $0xe07,%eax
+  80213a:	50                   	push   %eax
+  80213b:	56                   	push   %esi
+  80213c:	6a 00                	push   $0x0
+  80213e:	57                   	push   %edi
+  80213f:	6a 00                	push   $0x0
+  802141:	e8 8a ee ff ff       	call   800fd0 <sys_page_map>
+  802146:	89 c3                	mov    %eax,%ebx
+  802148:	83 c4 20             	add    $0x20,%esp
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	78 33                	js     802182 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80214f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802152:	89 d8                	mov    %ebx,%eax
+  802154:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802157:	5b                   	pop    %ebx
+  802158:	5e                   	pop    %esi
+  802159:	5f                   	pop    %edi
+  80215a:	5d                   	pop    %ebp
+  80215b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80215c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802163:	83 ec 0c             	sub    $0xc,%esp
+  802166:	25 07 0e 00 00       	and    $0xe07,%eax
+  80216b:	50                   	push   %eax
+  80216c:	ff 75 d4             	push   -0x2c(%ebp)
+  80216f:	6a 00                	push   $0x0
+  802171:	53                   	push   %ebx
+  802172:	6a 00                	push   $0x0
+  802174:	e8 57 ee ff ff       	call   800fd0 <sys_page_map>
+  802179:	89 c3                	mov    %eax,%ebx
+  80217b:	83 c4 20             	add    $0x20,%esp
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	79 a4                	jns    802126 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802182:	83 ec 08             	sub    $0x8,%esp
+  802185:	56                   	push   %esi
+  802186:	6a 00                	push   $0x0
+  802188:	e8 85 ee ff ff       	call   801012 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80218d:	83 c4 08             	add    $0x8,%esp
+  802190:	ff 75 d4             	push   -0x2c(%ebp)
+  802193:	6a 00                	push   $0x0
+  802195:	e8 78 ee ff ff       	call   801012 <sys_page_unmap>
+	return r;
+  80219a:	83 c4 10             	add    $0x10,%esp
+  80219d:	eb b3                	jmp    802152 <dup+0x9d>
+
+0080219f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80219f:	55                   	push   %ebp
+  8021a0:	89 e5                	mov    %esp,%ebp
+  8021a2:	56                   	push   %esi
+  8021a3:	53                   	push   %ebx
+  8021a4:	83 ec 18             	sub    $0x18,%esp
+  8021a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021ad:	50                   	push   %eax
+  8021ae:	53                   	push   %ebx
+  8021af:	e8 67 fd ff ff       	call   801f1b <fd_lookup>
+  8021b4:	83 c4 10             	add    $0x10,%esp
+  8021b7:	85 c0                	test   %eax,%eax
+  8021b9:	78 3c                	js     8021f7 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021bb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021be:	83 ec 08             	sub    $0x8,%esp
+  8021c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c4:	50                   	push   %eax
+  8021c5:	ff 36                	push   (%esi)
+  8021c7:	e8 a1 fd ff ff       	call   801f6d <dev_lookup>
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	85 c0                	test   %eax,%eax
+  8021d1:	78 24                	js     8021f7 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8021d3:	8b 46 08             	mov    0x8(%esi),%eax
+  8021d6:	83 e0 03             	and    $0x3,%eax
+  8021d9:	83 f8 01             	cmp    $0x1,%eax
+  8021dc:	74 20                	je     8021fe <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8021de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e1:	8b 40 08             	mov    0x8(%eax),%eax
+  8021e4:	85 c0                	test   %eax,%eax
+  8021e6:	74 54                	je     80223c <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8021e8:	83 ec 04             	sub    $0x4,%esp
+  8021eb:	ff 75 10             	push   0x10(%ebp)
+  8021ee:	ff 75 0c             	push   0xc(%ebp)
+  8021f1:	56                   	push   %esi
+  8021f2:	ff d0                	call   *%eax
+  8021f4:	83 c4 10             	add    $0x10,%esp
+}
+  8021f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021fa:	5b                   	pop    %ebx
+  8021fb:	5e                   	pop    %esi
+  8021fc:	5d                   	pop    %ebp
+  8021fd:	c3                   	ret
+  8021fe:	89 e2                	mov    %esp,%edx
+  802200:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802205:	29 d0                	sub    %edx,%eax
+  802207:	89 c2                	mov    %eax,%edx
+  802209:	c1 ea 0f             	shr    $0xf,%edx
+  80220c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802211:	b8 00 00 00 00       	mov    $0x0,%eax
+  802216:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802219:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  802220:	8b 40 48             	mov    0x48(%eax),%eax
+  802223:	83 ec 04             	sub    $0x4,%esp
+  802226:	53                   	push   %ebx
+  802227:	50                   	push   %eax
+  802228:	68 59 4c 80 00       	push   $0x804c59
+  80222d:	e8 30 e2 ff ff       	call   800462 <cprintf>
+		return -E_INVAL;
+  802232:	83 c4 10             	add    $0x10,%esp
+  802235:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80223a:	eb bb                	jmp    8021f7 <read+0x58>
+		return -E_NOT_SUPP;
+  80223c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802241:	eb b4                	jmp    8021f7 <read+0x58>
+
+00802243 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802243:	55                   	push   %ebp
+  802244:	89 e5                	mov    %esp,%ebp
+  802246:	57                   	push   %edi
+  802247:	56                   	push   %esi
+  802248:	53                   	push   %ebx
+  802249:	83 ec 0c             	sub    $0xc,%esp
+  80224c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80224f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802252:	85 f6                	test   %esi,%esi
+  802254:	74 30                	je     802286 <readn+0x43>
+  802256:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80225b:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802260:	83 ec 04             	sub    $0x4,%esp
+  802263:	89 f2                	mov    %esi,%edx
+  802265:	29 c2                	sub    %eax,%edx
+  802267:	52                   	push   %edx
+  802268:	01 f8                	add    %edi,%eax
+  80226a:	50                   	push   %eax
+  80226b:	ff 75 08             	push   0x8(%ebp)
+  80226e:	e8 2c ff ff ff       	call   80219f <read>
+		if (m < 0)
+  802273:	83 c4 10             	add    $0x10,%esp
+  802276:	85 c0                	test   %eax,%eax
+  802278:	78 15                	js     80228f <readn+0x4c>
+			return m;
+		if (m == 0)
+  80227a:	74 11                	je     80228d <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80227c:	01 c3                	add    %eax,%ebx
+  80227e:	89 d8                	mov    %ebx,%eax
+  802280:	39 f3                	cmp    %esi,%ebx
+  802282:	72 dc                	jb     802260 <readn+0x1d>
+  802284:	eb 09                	jmp    80228f <readn+0x4c>
+  802286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228b:	eb 02                	jmp    80228f <readn+0x4c>
+  80228d:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80228f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802292:	5b                   	pop    %ebx
+  802293:	5e                   	pop    %esi
+  802294:	5f                   	pop    %edi
+  802295:	5d                   	pop    %ebp
+  802296:	c3                   	ret
+
+00802297 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802297:	55                   	push   %ebp
+  802298:	89 e5                	mov    %esp,%ebp
+  80229a:	56                   	push   %esi
+  80229b:	53                   	push   %ebx
+  80229c:	83 ec 18             	sub    $0x18,%esp
+  80229f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022a5:	50                   	push   %eax
+  8022a6:	53                   	push   %ebx
+  8022a7:	e8 6f fc ff ff       	call   801f1b <fd_lookup>
+  8022ac:	83 c4 10             	add    $0x10,%esp
+  8022af:	85 c0                	test   %eax,%eax
+  8022b1:	78 37                	js     8022ea <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022b3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022b6:	83 ec 08             	sub    $0x8,%esp
+  8022b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022bc:	50                   	push   %eax
+  8022bd:	ff 36                	push   (%esi)
+  8022bf:	e8 a9 fc ff ff       	call   801f6d <dev_lookup>
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	85 c0                	test   %eax,%eax
+  8022c9:	78 1f                	js     8022ea <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022cb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8022cf:	74 20                	je     8022f1 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8022d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	74 54                	je     80232f <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8022db:	83 ec 04             	sub    $0x4,%esp
+  8022de:	ff 75 10             	push   0x10(%ebp)
+  8022e1:	ff 75 0c             	push   0xc(%ebp)
+  8022e4:	56                   	push   %esi
+  8022e5:	ff d0                	call   *%eax
+  8022e7:	83 c4 10             	add    $0x10,%esp
+}
+  8022ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ed:	5b                   	pop    %ebx
+  8022ee:	5e                   	pop    %esi
+  8022ef:	5d                   	pop    %ebp
+  8022f0:	c3                   	ret
+  8022f1:	89 e2                	mov    %esp,%edx
+  8022f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8022f8:	29 d0                	sub    %edx,%eax
+  8022fa:	89 c2                	mov    %eax,%edx
+  8022fc:	c1 ea 0f             	shr    $0xf,%edx
+  8022ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802304:	b8 00 00 00 00       	mov    $0x0,%eax
+  802309:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80230c:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  802313:	8b 40 48             	mov    0x48(%eax),%eax
+  802316:	83 ec 04             	sub    $0x4,%esp
+  802319:	53                   	push   %ebx
+  80231a:	50                   	push   %eax
+  80231b:	68 75 4c 80 00       	push   $0x804c75
+  802320:	e8 3d e1 ff ff       	call   800462 <cprintf>
+		return -E_INVAL;
+  802325:	83 c4 10             	add    $0x10,%esp
+  802328:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80232d:	eb bb                	jmp    8022ea <write+0x53>
+		return -E_NOT_SUPP;
+  80232f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802334:	eb b4                	jmp    8022ea <write+0x53>
+
+00802336 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80233c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80233f:	50                   	push   %eax
+  802340:	ff 75 08             	push   0x8(%ebp)
+  802343:	e8 d3 fb ff ff       	call   801f1b <fd_lookup>
+  802348:	83 c4 10             	add    $0x10,%esp
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	78 0e                	js     80235d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80234f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802352:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802355:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802358:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80235d:	c9                   	leave
+  80235e:	c3                   	ret
+
+0080235f <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	53                   	push   %ebx
+  802363:	83 ec 1c             	sub    $0x1c,%esp
+  802366:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802369:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80236c:	50                   	push   %eax
+  80236d:	ff 75 08             	push   0x8(%ebp)
+  802370:	e8 a6 fb ff ff       	call   801f1b <fd_lookup>
+  802375:	83 c4 10             	add    $0x10,%esp
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	78 33                	js     8023af <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80237c:	83 fb 03             	cmp    $0x3,%ebx
+  80237f:	74 28                	je     8023a9 <fcntl+0x4a>
+  802381:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802386:	83 fb 04             	cmp    $0x4,%ebx
+  802389:	75 24                	jne    8023af <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80238b:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80238e:	8b 41 08             	mov    0x8(%ecx),%eax
+  802391:	80 e4 ef             	and    $0xef,%ah
+  802394:	8b 55 10             	mov    0x10(%ebp),%edx
+  802397:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80239d:	09 d0                	or     %edx,%eax
+  80239f:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8023a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a7:	eb 06                	jmp    8023af <fcntl+0x50>
+		return fd->fd_omode;
+  8023a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023ac:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8023af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023b2:	c9                   	leave
+  8023b3:	c3                   	ret
+
+008023b4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8023b4:	55                   	push   %ebp
+  8023b5:	89 e5                	mov    %esp,%ebp
+  8023b7:	56                   	push   %esi
+  8023b8:	53                   	push   %ebx
+  8023b9:	83 ec 18             	sub    $0x18,%esp
+  8023bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8023bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023c2:	50                   	push   %eax
+  8023c3:	53                   	push   %ebx
+  8023c4:	e8 52 fb ff ff       	call   801f1b <fd_lookup>
+  8023c9:	83 c4 10             	add    $0x10,%esp
+  8023cc:	85 c0                	test   %eax,%eax
+  8023ce:	78 34                	js     802404 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023d0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d9:	50                   	push   %eax
+  8023da:	ff 36                	push   (%esi)
+  8023dc:	e8 8c fb ff ff       	call   801f6d <dev_lookup>
+  8023e1:	83 c4 10             	add    $0x10,%esp
+  8023e4:	85 c0                	test   %eax,%eax
+  8023e6:	78 1c                	js     802404 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023e8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8023ec:	74 1d                	je     80240b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8023ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f1:	8b 40 18             	mov    0x18(%eax),%eax
+  8023f4:	85 c0                	test   %eax,%eax
+  8023f6:	74 51                	je     802449 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8023f8:	83 ec 08             	sub    $0x8,%esp
+  8023fb:	ff 75 0c             	push   0xc(%ebp)
+  8023fe:	56                   	push   %esi
+  8023ff:	ff d0                	call   *%eax
+  802401:	83 c4 10             	add    $0x10,%esp
+}
+  802404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802407:	5b                   	pop    %ebx
+  802408:	5e                   	pop    %esi
+  802409:	5d                   	pop    %ebp
+  80240a:	c3                   	ret
+  80240b:	89 e2                	mov    %esp,%edx
+  80240d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802412:	29 d0                	sub    %edx,%eax
+  802414:	89 c2                	mov    %eax,%edx
+  802416:	c1 ea 0f             	shr    $0xf,%edx
+  802419:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80241e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802423:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  802426:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80242d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802430:	83 ec 04             	sub    $0x4,%esp
+  802433:	53                   	push   %ebx
+  802434:	50                   	push   %eax
+  802435:	68 38 4c 80 00       	push   $0x804c38
+  80243a:	e8 23 e0 ff ff       	call   800462 <cprintf>
+		return -E_INVAL;
+  80243f:	83 c4 10             	add    $0x10,%esp
+  802442:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802447:	eb bb                	jmp    802404 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802449:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80244e:	eb b4                	jmp    802404 <ftruncate+0x50>
+
+00802450 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802450:	55                   	push   %ebp
+  802451:	89 e5                	mov    %esp,%ebp
+  802453:	56                   	push   %esi
+  802454:	53                   	push   %ebx
+  802455:	83 ec 18             	sub    $0x18,%esp
+  802458:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80245b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80245e:	50                   	push   %eax
+  80245f:	ff 75 08             	push   0x8(%ebp)
+  802462:	e8 b4 fa ff ff       	call   801f1b <fd_lookup>
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	78 53                	js     8024c1 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80246e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802471:	83 ec 08             	sub    $0x8,%esp
+  802474:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802477:	50                   	push   %eax
+  802478:	ff 36                	push   (%esi)
+  80247a:	e8 ee fa ff ff       	call   801f6d <dev_lookup>
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	85 c0                	test   %eax,%eax
+  802484:	78 3b                	js     8024c1 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802486:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802489:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80248d:	74 39                	je     8024c8 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80248f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802492:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802499:	00 00 00 
+	stat->st_isdir = 0;
+  80249c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024a3:	00 00 00 
+	stat->st_version = 0;
+  8024a6:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8024ad:	00 00 00 
+	stat->st_dev = dev;
+  8024b0:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8024b6:	83 ec 08             	sub    $0x8,%esp
+  8024b9:	53                   	push   %ebx
+  8024ba:	56                   	push   %esi
+  8024bb:	ff 50 14             	call   *0x14(%eax)
+  8024be:	83 c4 10             	add    $0x10,%esp
+}
+  8024c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c4:	5b                   	pop    %ebx
+  8024c5:	5e                   	pop    %esi
+  8024c6:	5d                   	pop    %ebp
+  8024c7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024cd:	eb f2                	jmp    8024c1 <fstat+0x71>
+
+008024cf <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8024cf:	55                   	push   %ebp
+  8024d0:	89 e5                	mov    %esp,%ebp
+  8024d2:	56                   	push   %esi
+  8024d3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8024d4:	83 ec 08             	sub    $0x8,%esp
+  8024d7:	6a 00                	push   $0x0
+  8024d9:	ff 75 08             	push   0x8(%ebp)
+  8024dc:	e8 b7 01 00 00       	call   802698 <open>
+  8024e1:	89 c3                	mov    %eax,%ebx
+  8024e3:	83 c4 10             	add    $0x10,%esp
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	78 1b                	js     802505 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8024ea:	83 ec 08             	sub    $0x8,%esp
+  8024ed:	ff 75 0c             	push   0xc(%ebp)
+  8024f0:	50                   	push   %eax
+  8024f1:	e8 5a ff ff ff       	call   802450 <fstat>
+  8024f6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8024f8:	89 1c 24             	mov    %ebx,(%esp)
+  8024fb:	e8 60 fb ff ff       	call   802060 <close>
+	return r;
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	89 f3                	mov    %esi,%ebx
+}
+  802505:	89 d8                	mov    %ebx,%eax
+  802507:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80250a:	5b                   	pop    %ebx
+  80250b:	5e                   	pop    %esi
+  80250c:	5d                   	pop    %ebp
+  80250d:	c3                   	ret
+
+0080250e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	56                   	push   %esi
+  802512:	53                   	push   %ebx
+  802513:	89 c6                	mov    %eax,%esi
+  802515:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802517:	83 3d e4 66 80 00 00 	cmpl   $0x0,0x8066e4
+  80251e:	74 27                	je     802547 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802520:	6a 07                	push   $0x7
+  802522:	68 00 70 80 00       	push   $0x807000
+  802527:	56                   	push   %esi
+  802528:	ff 35 e4 66 80 00    	push   0x8066e4
+  80252e:	e8 c9 f8 ff ff       	call   801dfc <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802533:	83 c4 0c             	add    $0xc,%esp
+  802536:	6a 00                	push   $0x0
+  802538:	53                   	push   %ebx
+  802539:	6a 00                	push   $0x0
+  80253b:	e8 2c f6 ff ff       	call   801b6c <ipc_recv>
+}
+  802540:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802543:	5b                   	pop    %ebx
+  802544:	5e                   	pop    %esi
+  802545:	5d                   	pop    %ebp
+  802546:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802547:	83 ec 0c             	sub    $0xc,%esp
+  80254a:	6a 02                	push   $0x2
+  80254c:	e8 14 f9 ff ff       	call   801e65 <ipc_find_env>
+  802551:	a3 e4 66 80 00       	mov    %eax,0x8066e4
+  802556:	83 c4 10             	add    $0x10,%esp
+  802559:	eb c5                	jmp    802520 <fsipc+0x12>
+
+0080255b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80255b:	55                   	push   %ebp
+  80255c:	89 e5                	mov    %esp,%ebp
+  80255e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802561:	8b 45 08             	mov    0x8(%ebp),%eax
+  802564:	8b 40 0c             	mov    0xc(%eax),%eax
+  802567:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80256c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80256f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802574:	ba 00 00 00 00       	mov    $0x0,%edx
+  802579:	b8 02 00 00 00       	mov    $0x2,%eax
+  80257e:	e8 8b ff ff ff       	call   80250e <fsipc>
+}
+  802583:	c9                   	leave
+  802584:	c3                   	ret
+
+00802585 <devfile_flush>:
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80258b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802591:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259b:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025a0:	e8 69 ff ff ff       	call   80250e <fsipc>
+}
+  8025a5:	c9                   	leave
+  8025a6:	c3                   	ret
+
+008025a7 <devfile_stat>:
+{
+  8025a7:	55                   	push   %ebp
+  8025a8:	89 e5                	mov    %esp,%ebp
+  8025aa:	53                   	push   %ebx
+  8025ab:	83 ec 04             	sub    $0x4,%esp
+  8025ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025b7:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8025bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025c6:	e8 43 ff ff ff       	call   80250e <fsipc>
+  8025cb:	85 c0                	test   %eax,%eax
+  8025cd:	78 37                	js     802606 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8025cf:	83 ec 08             	sub    $0x8,%esp
+  8025d2:	68 00 70 80 00       	push   $0x807000
+  8025d7:	53                   	push   %ebx
+  8025d8:	e8 7c e5 ff ff       	call   800b59 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8025dd:	a1 80 70 80 00       	mov    0x807080,%eax
+  8025e2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8025e8:	a1 84 70 80 00       	mov    0x807084,%eax
+  8025ed:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8025f3:	a1 88 70 80 00       	mov    0x807088,%eax
+  8025f8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8025fe:	83 c4 10             	add    $0x10,%esp
+  802601:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802606:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802609:	c9                   	leave
+  80260a:	c3                   	ret
+
+0080260b <devfile_write>:
+{
+  80260b:	55                   	push   %ebp
+  80260c:	89 e5                	mov    %esp,%ebp
+  80260e:	83 ec 0c             	sub    $0xc,%esp
+  802611:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802614:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802619:	39 d0                	cmp    %edx,%eax
+  80261b:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80261e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802621:	8b 52 0c             	mov    0xc(%edx),%edx
+  802624:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80262a:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  80262f:	50                   	push   %eax
+  802630:	ff 75 0c             	push   0xc(%ebp)
+  802633:	68 08 70 80 00       	push   $0x807008
+  802638:	e8 cc e6 ff ff       	call   800d09 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80263d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802642:	b8 04 00 00 00       	mov    $0x4,%eax
+  802647:	e8 c2 fe ff ff       	call   80250e <fsipc>
+}
+  80264c:	c9                   	leave
+  80264d:	c3                   	ret
+
+0080264e <devfile_read>:
+{
+  80264e:	55                   	push   %ebp
+  80264f:	89 e5                	mov    %esp,%ebp
+  802651:	53                   	push   %ebx
+  802652:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802655:	8b 45 08             	mov    0x8(%ebp),%eax
+  802658:	8b 40 0c             	mov    0xc(%eax),%eax
+  80265b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802660:	8b 45 10             	mov    0x10(%ebp),%eax
+  802663:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802668:	ba 00 70 80 00       	mov    $0x807000,%edx
+  80266d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802672:	e8 97 fe ff ff       	call   80250e <fsipc>
+  802677:	89 c3                	mov    %eax,%ebx
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	78 14                	js     802691 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  80267d:	83 ec 04             	sub    $0x4,%esp
+  802680:	50                   	push   %eax
+  802681:	68 00 70 80 00       	push   $0x807000
+  802686:	ff 75 0c             	push   0xc(%ebp)
+  802689:	e8 7b e6 ff ff       	call   800d09 <memmove>
+	return r;
+  80268e:	83 c4 10             	add    $0x10,%esp
+}
+  802691:	89 d8                	mov    %ebx,%eax
+  802693:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802696:	c9                   	leave
+  802697:	c3                   	ret
+
+00802698 <open>:
+{
+  802698:	55                   	push   %ebp
+  802699:	89 e5                	mov    %esp,%ebp
+  80269b:	53                   	push   %ebx
+  80269c:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80269f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026a2:	50                   	push   %eax
+  8026a3:	e8 23 f8 ff ff       	call   801ecb <fd_alloc>
+  8026a8:	89 c3                	mov    %eax,%ebx
+  8026aa:	83 c4 10             	add    $0x10,%esp
+  8026ad:	85 c0                	test   %eax,%eax
+  8026af:	78 2a                	js     8026db <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8026b1:	83 ec 0c             	sub    $0xc,%esp
+  8026b4:	ff 75 08             	push   0x8(%ebp)
+  8026b7:	e8 51 e4 ff ff       	call   800b0d <strlen>
+  8026bc:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8026bf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8026c4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8026c9:	7e 17                	jle    8026e2 <open+0x4a>
+	fd_close(fd, 1);
+  8026cb:	83 ec 08             	sub    $0x8,%esp
+  8026ce:	6a 01                	push   $0x1
+  8026d0:	ff 75 f4             	push   -0xc(%ebp)
+  8026d3:	e8 08 f9 ff ff       	call   801fe0 <fd_close>
+	return r;
+  8026d8:	83 c4 10             	add    $0x10,%esp
+}
+  8026db:	89 d8                	mov    %ebx,%eax
+  8026dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e0:	c9                   	leave
+  8026e1:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8026e2:	83 ec 08             	sub    $0x8,%esp
+  8026e5:	ff 75 08             	push   0x8(%ebp)
+  8026e8:	68 00 70 80 00       	push   $0x807000
+  8026ed:	e8 67 e4 ff ff       	call   800b59 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8026f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026f5:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8026fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802702:	e8 07 fe ff ff       	call   80250e <fsipc>
+  802707:	89 c3                	mov    %eax,%ebx
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	85 c0                	test   %eax,%eax
+  80270e:	78 bb                	js     8026cb <open+0x33>
+	return fd2num(fd); 	
+  802710:	83 ec 0c             	sub    $0xc,%esp
+  802713:	ff 75 f4             	push   -0xc(%ebp)
+  802716:	e8 89 f7 ff ff       	call   801ea4 <fd2num>
+  80271b:	89 c3                	mov    %eax,%ebx
+  80271d:	83 c4 10             	add    $0x10,%esp
+  802720:	eb b9                	jmp    8026db <open+0x43>
+
+00802722 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802722:	55                   	push   %ebp
+  802723:	89 e5                	mov    %esp,%ebp
+  802725:	53                   	push   %ebx
+  802726:	83 ec 1c             	sub    $0x1c,%esp
+  802729:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80272c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80272f:	50                   	push   %eax
+  802730:	ff 75 08             	push   0x8(%ebp)
+  802733:	e8 e3 f7 ff ff       	call   801f1b <fd_lookup>
+  802738:	83 c4 10             	add    $0x10,%esp
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	78 5a                	js     802799 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80273f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802742:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802748:	39 10                	cmp    %edx,(%eax)
+  80274a:	75 66                	jne    8027b2 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  80274c:	83 3d e4 66 80 00 00 	cmpl   $0x0,0x8066e4
+  802753:	74 49                	je     80279e <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802755:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802758:	8b 40 0c             	mov    0xc(%eax),%eax
+  80275b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802760:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802763:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802768:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80276e:	6a 07                	push   $0x7
+  802770:	68 00 70 80 00       	push   $0x807000
+  802775:	6a 09                	push   $0x9
+  802777:	ff 35 e4 66 80 00    	push   0x8066e4
+  80277d:	e8 7a f6 ff ff       	call   801dfc <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802782:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802789:	6a 00                	push   $0x0
+  80278b:	53                   	push   %ebx
+  80278c:	ff 75 10             	push   0x10(%ebp)
+  80278f:	6a 00                	push   $0x0
+  802791:	e8 a3 f4 ff ff       	call   801c39 <ipc_recv_pages>
+  802796:	83 c4 20             	add    $0x20,%esp
+}
+  802799:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80279c:	c9                   	leave
+  80279d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80279e:	83 ec 0c             	sub    $0xc,%esp
+  8027a1:	6a 02                	push   $0x2
+  8027a3:	e8 bd f6 ff ff       	call   801e65 <ipc_find_env>
+  8027a8:	a3 e4 66 80 00       	mov    %eax,0x8066e4
+  8027ad:	83 c4 10             	add    $0x10,%esp
+  8027b0:	eb a3                	jmp    802755 <fmap+0x33>
+		return -E_INVAL;
+  8027b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027b7:	eb e0                	jmp    802799 <fmap+0x77>
+
+008027b9 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	53                   	push   %ebx
+  8027bd:	83 ec 10             	sub    $0x10,%esp
+  8027c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8027c3:	53                   	push   %ebx
+  8027c4:	e8 44 e3 ff ff       	call   800b0d <strlen>
+  8027c9:	83 c4 10             	add    $0x10,%esp
+  8027cc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027d1:	7f 25                	jg     8027f8 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8027d3:	83 ec 08             	sub    $0x8,%esp
+  8027d6:	53                   	push   %ebx
+  8027d7:	68 00 70 80 00       	push   $0x807000
+  8027dc:	e8 78 e3 ff ff       	call   800b59 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8027e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027eb:	e8 1e fd ff ff       	call   80250e <fsipc>
+  8027f0:	83 c4 10             	add    $0x10,%esp
+}
+  8027f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f6:	c9                   	leave
+  8027f7:	c3                   	ret
+		return -E_BAD_PATH;
+  8027f8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8027fd:	eb f4                	jmp    8027f3 <remove+0x3a>
+
+008027ff <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027ff:	55                   	push   %ebp
+  802800:	89 e5                	mov    %esp,%ebp
+  802802:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802805:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80280f:	e8 fa fc ff ff       	call   80250e <fsipc>
+}
+  802814:	c9                   	leave
+  802815:	c3                   	ret
+
+00802816 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80281c:	68 a8 4c 80 00       	push   $0x804ca8
+  802821:	ff 75 0c             	push   0xc(%ebp)
+  802824:	e8 30 e3 ff ff       	call   800b59 <strcpy>
+	return 0;
+}
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282e:	c9                   	leave
+  80282f:	c3                   	ret
+
+00802830 <devsock_close>:
+{
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	53                   	push   %ebx
+  802834:	83 ec 10             	sub    $0x10,%esp
+  802837:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80283a:	53                   	push   %ebx
+  80283b:	e8 23 1c 00 00       	call   804463 <pageref>
+  802840:	89 c2                	mov    %eax,%edx
+  802842:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802845:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80284a:	83 fa 01             	cmp    $0x1,%edx
+  80284d:	74 05                	je     802854 <devsock_close+0x24>
+}
+  80284f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802852:	c9                   	leave
+  802853:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802854:	83 ec 0c             	sub    $0xc,%esp
+  802857:	ff 73 0c             	push   0xc(%ebx)
+  80285a:	e8 b0 05 00 00       	call   802e0f <nsipc_close>
+  80285f:	83 c4 10             	add    $0x10,%esp
+  802862:	eb eb                	jmp    80284f <devsock_close+0x1f>
+
+00802864 <devsock_write>:
+{
+  802864:	55                   	push   %ebp
+  802865:	89 e5                	mov    %esp,%ebp
+  802867:	53                   	push   %ebx
+  802868:	83 ec 14             	sub    $0x14,%esp
+  80286b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80286e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802871:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802874:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802877:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80287a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80287d:	c1 f8 09             	sar    $0x9,%eax
+  802880:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802883:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802889:	77 13                	ja     80289e <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  80288b:	50                   	push   %eax
+  80288c:	52                   	push   %edx
+  80288d:	53                   	push   %ebx
+  80288e:	ff 71 0c             	push   0xc(%ecx)
+  802891:	e8 5c 06 00 00       	call   802ef2 <nsipc_send>
+  802896:	83 c4 10             	add    $0x10,%esp
+}
+  802899:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80289c:	c9                   	leave
+  80289d:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80289e:	50                   	push   %eax
+  80289f:	6a 01                	push   $0x1
+  8028a1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8028a4:	50                   	push   %eax
+  8028a5:	ff 71 0c             	push   0xc(%ecx)
+  8028a8:	e8 a6 06 00 00       	call   802f53 <nsipc_sendmsg>
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	eb e7                	jmp    802899 <devsock_write+0x35>
+
+008028b2 <devsock_read>:
+{
+  8028b2:	55                   	push   %ebp
+  8028b3:	89 e5                	mov    %esp,%ebp
+  8028b5:	53                   	push   %ebx
+  8028b6:	83 ec 14             	sub    $0x14,%esp
+  8028b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8028bf:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8028c2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8028c5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8028c8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8028cb:	c1 f8 09             	sar    $0x9,%eax
+  8028ce:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8028d1:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8028d7:	77 13                	ja     8028ec <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8028d9:	50                   	push   %eax
+  8028da:	52                   	push   %edx
+  8028db:	53                   	push   %ebx
+  8028dc:	ff 71 0c             	push   0xc(%ecx)
+  8028df:	e8 9c 05 00 00       	call   802e80 <nsipc_recv>
+  8028e4:	83 c4 10             	add    $0x10,%esp
+}
+  8028e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ea:	c9                   	leave
+  8028eb:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8028ec:	50                   	push   %eax
+  8028ed:	6a 01                	push   $0x1
+  8028ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8028f2:	50                   	push   %eax
+  8028f3:	ff 71 0c             	push   0xc(%ecx)
+  8028f6:	e8 02 0a 00 00       	call   8032fd <nsipc_recvmsg>
+  8028fb:	83 c4 10             	add    $0x10,%esp
+  8028fe:	eb e7                	jmp    8028e7 <devsock_read+0x35>
+
+00802900 <fd2sockid>:
+{
+  802900:	55                   	push   %ebp
+  802901:	89 e5                	mov    %esp,%ebp
+  802903:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802906:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802909:	52                   	push   %edx
+  80290a:	50                   	push   %eax
+  80290b:	e8 0b f6 ff ff       	call   801f1b <fd_lookup>
+  802910:	83 c4 10             	add    $0x10,%esp
+  802913:	85 c0                	test   %eax,%eax
+  802915:	78 10                	js     802927 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802917:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80291a:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802920:	39 08                	cmp    %ecx,(%eax)
+  802922:	75 05                	jne    802929 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802924:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802927:	c9                   	leave
+  802928:	c3                   	ret
+		return -E_NOT_SUPP;
+  802929:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80292e:	eb f7                	jmp    802927 <fd2sockid+0x27>
+
+00802930 <sock_flags>:
+{
+  802930:	55                   	push   %ebp
+  802931:	89 e5                	mov    %esp,%ebp
+  802933:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802936:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802939:	52                   	push   %edx
+  80293a:	50                   	push   %eax
+  80293b:	e8 db f5 ff ff       	call   801f1b <fd_lookup>
+  802940:	83 c4 10             	add    $0x10,%esp
+  802943:	85 c0                	test   %eax,%eax
+  802945:	78 0e                	js     802955 <sock_flags+0x25>
+  802947:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80294a:	8b 40 08             	mov    0x8(%eax),%eax
+  80294d:	c1 e8 09             	shr    $0x9,%eax
+  802950:	83 e0 08             	and    $0x8,%eax
+}
+  802953:	c9                   	leave
+  802954:	c3                   	ret
+		return 0;
+  802955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295a:	eb f7                	jmp    802953 <sock_flags+0x23>
+
+0080295c <alloc_sockfd>:
+{
+  80295c:	55                   	push   %ebp
+  80295d:	89 e5                	mov    %esp,%ebp
+  80295f:	56                   	push   %esi
+  802960:	53                   	push   %ebx
+  802961:	83 ec 1c             	sub    $0x1c,%esp
+  802964:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802966:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802969:	50                   	push   %eax
+  80296a:	e8 5c f5 ff ff       	call   801ecb <fd_alloc>
+  80296f:	89 c3                	mov    %eax,%ebx
+  802971:	83 c4 10             	add    $0x10,%esp
+  802974:	85 c0                	test   %eax,%eax
+  802976:	78 43                	js     8029bb <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802978:	83 ec 04             	sub    $0x4,%esp
+  80297b:	68 07 04 00 00       	push   $0x407
+  802980:	ff 75 f4             	push   -0xc(%ebp)
+  802983:	6a 00                	push   $0x0
+  802985:	e8 03 e6 ff ff       	call   800f8d <sys_page_alloc>
+  80298a:	89 c3                	mov    %eax,%ebx
+  80298c:	83 c4 10             	add    $0x10,%esp
+  80298f:	85 c0                	test   %eax,%eax
+  802991:	78 28                	js     8029bb <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802993:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802996:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  80299c:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80299e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029a1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8029a8:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8029ab:	83 ec 0c             	sub    $0xc,%esp
+  8029ae:	50                   	push   %eax
+  8029af:	e8 f0 f4 ff ff       	call   801ea4 <fd2num>
+  8029b4:	89 c3                	mov    %eax,%ebx
+  8029b6:	83 c4 10             	add    $0x10,%esp
+  8029b9:	eb 0c                	jmp    8029c7 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8029bb:	83 ec 0c             	sub    $0xc,%esp
+  8029be:	56                   	push   %esi
+  8029bf:	e8 4b 04 00 00       	call   802e0f <nsipc_close>
+		return r;
+  8029c4:	83 c4 10             	add    $0x10,%esp
+}
+  8029c7:	89 d8                	mov    %ebx,%eax
+  8029c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029cc:	5b                   	pop    %ebx
+  8029cd:	5e                   	pop    %esi
+  8029ce:	5d                   	pop    %ebp
+  8029cf:	c3                   	ret
+
+008029d0 <accept>:
+{
+  8029d0:	55                   	push   %ebp
+  8029d1:	89 e5                	mov    %esp,%ebp
+  8029d3:	56                   	push   %esi
+  8029d4:	53                   	push   %ebx
+  8029d5:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8029d8:	89 f0                	mov    %esi,%eax
+  8029da:	e8 21 ff ff ff       	call   802900 <fd2sockid>
+  8029df:	89 c3                	mov    %eax,%ebx
+  8029e1:	85 c0                	test   %eax,%eax
+  8029e3:	78 24                	js     802a09 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8029e5:	89 f0                	mov    %esi,%eax
+  8029e7:	e8 44 ff ff ff       	call   802930 <sock_flags>
+  8029ec:	50                   	push   %eax
+  8029ed:	ff 75 10             	push   0x10(%ebp)
+  8029f0:	ff 75 0c             	push   0xc(%ebp)
+  8029f3:	53                   	push   %ebx
+  8029f4:	e8 6b 03 00 00       	call   802d64 <nsipc_accept>
+  8029f9:	89 c3                	mov    %eax,%ebx
+  8029fb:	83 c4 10             	add    $0x10,%esp
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	78 07                	js     802a09 <accept+0x39>
+	return alloc_sockfd(r);
+  802a02:	e8 55 ff ff ff       	call   80295c <alloc_sockfd>
+  802a07:	89 c3                	mov    %eax,%ebx
+}
+  802a09:	89 d8                	mov    %ebx,%eax
+  802a0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a0e:	5b                   	pop    %ebx
+  802a0f:	5e                   	pop    %esi
+  802a10:	5d                   	pop    %ebp
+  802a11:	c3                   	ret
+
+00802a12 <bind>:
+{
+  802a12:	55                   	push   %ebp
+  802a13:	89 e5                	mov    %esp,%ebp
+  802a15:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1b:	e8 e0 fe ff ff       	call   802900 <fd2sockid>
+  802a20:	85 c0                	test   %eax,%eax
+  802a22:	78 12                	js     802a36 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802a24:	83 ec 04             	sub    $0x4,%esp
+  802a27:	ff 75 10             	push   0x10(%ebp)
+  802a2a:	ff 75 0c             	push   0xc(%ebp)
+  802a2d:	50                   	push   %eax
+  802a2e:	e8 85 03 00 00       	call   802db8 <nsipc_bind>
+  802a33:	83 c4 10             	add    $0x10,%esp
+}
+  802a36:	c9                   	leave
+  802a37:	c3                   	ret
+
+00802a38 <shutdown>:
+{
+  802a38:	55                   	push   %ebp
+  802a39:	89 e5                	mov    %esp,%ebp
+  802a3b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a41:	e8 ba fe ff ff       	call   802900 <fd2sockid>
+  802a46:	85 c0                	test   %eax,%eax
+  802a48:	78 0f                	js     802a59 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a4a:	83 ec 08             	sub    $0x8,%esp
+  802a4d:	ff 75 0c             	push   0xc(%ebp)
+  802a50:	50                   	push   %eax
+  802a51:	e8 97 03 00 00       	call   802ded <nsipc_shutdown>
+  802a56:	83 c4 10             	add    $0x10,%esp
+}
+  802a59:	c9                   	leave
+  802a5a:	c3                   	ret
+
+00802a5b <connect>:
+{
+  802a5b:	55                   	push   %ebp
+  802a5c:	89 e5                	mov    %esp,%ebp
+  802a5e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a64:	e8 97 fe ff ff       	call   802900 <fd2sockid>
+  802a69:	85 c0                	test   %eax,%eax
+  802a6b:	78 12                	js     802a7f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802a6d:	83 ec 04             	sub    $0x4,%esp
+  802a70:	ff 75 10             	push   0x10(%ebp)
+  802a73:	ff 75 0c             	push   0xc(%ebp)
+  802a76:	50                   	push   %eax
+  802a77:	e8 ad 03 00 00       	call   802e29 <nsipc_connect>
+  802a7c:	83 c4 10             	add    $0x10,%esp
+}
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+
+00802a81 <listen>:
+{
+  802a81:	55                   	push   %ebp
+  802a82:	89 e5                	mov    %esp,%ebp
+  802a84:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a87:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8a:	e8 71 fe ff ff       	call   802900 <fd2sockid>
+  802a8f:	85 c0                	test   %eax,%eax
+  802a91:	78 0f                	js     802aa2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a93:	83 ec 08             	sub    $0x8,%esp
+  802a96:	ff 75 0c             	push   0xc(%ebp)
+  802a99:	50                   	push   %eax
+  802a9a:	e8 bf 03 00 00       	call   802e5e <nsipc_listen>
+  802a9f:	83 c4 10             	add    $0x10,%esp
+}
+  802aa2:	c9                   	leave
+  802aa3:	c3                   	ret
+
+00802aa4 <sendmsg>:
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	57                   	push   %edi
+  802aa8:	56                   	push   %esi
+  802aa9:	53                   	push   %ebx
+  802aaa:	83 ec 0c             	sub    $0xc,%esp
+  802aad:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ab0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802ab3:	89 f0                	mov    %esi,%eax
+  802ab5:	e8 46 fe ff ff       	call   802900 <fd2sockid>
+  802aba:	89 c3                	mov    %eax,%ebx
+  802abc:	85 c0                	test   %eax,%eax
+  802abe:	78 1c                	js     802adc <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802ac0:	89 f0                	mov    %esi,%eax
+  802ac2:	e8 69 fe ff ff       	call   802930 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802ac7:	0b 45 10             	or     0x10(%ebp),%eax
+  802aca:	50                   	push   %eax
+  802acb:	ff 77 0c             	push   0xc(%edi)
+  802ace:	ff 77 08             	push   0x8(%edi)
+  802ad1:	53                   	push   %ebx
+  802ad2:	e8 7c 04 00 00       	call   802f53 <nsipc_sendmsg>
+  802ad7:	89 c3                	mov    %eax,%ebx
+  802ad9:	83 c4 10             	add    $0x10,%esp
+}
+  802adc:	89 d8                	mov    %ebx,%eax
+  802ade:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae1:	5b                   	pop    %ebx
+  802ae2:	5e                   	pop    %esi
+  802ae3:	5f                   	pop    %edi
+  802ae4:	5d                   	pop    %ebp
+  802ae5:	c3                   	ret
+
+00802ae6 <recvmsg>:
+{
+  802ae6:	55                   	push   %ebp
+  802ae7:	89 e5                	mov    %esp,%ebp
+  802ae9:	57                   	push   %edi
+  802aea:	56                   	push   %esi
+  802aeb:	53                   	push   %ebx
+  802aec:	83 ec 0c             	sub    $0xc,%esp
+  802aef:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802af2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802af5:	89 f8                	mov    %edi,%eax
+  802af7:	e8 04 fe ff ff       	call   802900 <fd2sockid>
+  802afc:	89 c3                	mov    %eax,%ebx
+  802afe:	85 c0                	test   %eax,%eax
+  802b00:	78 2a                	js     802b2c <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802b02:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802b09:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802b10:	89 f8                	mov    %edi,%eax
+  802b12:	e8 19 fe ff ff       	call   802930 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802b17:	0b 45 10             	or     0x10(%ebp),%eax
+  802b1a:	50                   	push   %eax
+  802b1b:	ff 76 0c             	push   0xc(%esi)
+  802b1e:	ff 76 08             	push   0x8(%esi)
+  802b21:	53                   	push   %ebx
+  802b22:	e8 d6 07 00 00       	call   8032fd <nsipc_recvmsg>
+  802b27:	89 c3                	mov    %eax,%ebx
+  802b29:	83 c4 10             	add    $0x10,%esp
+}
+  802b2c:	89 d8                	mov    %ebx,%eax
+  802b2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b31:	5b                   	pop    %ebx
+  802b32:	5e                   	pop    %esi
+  802b33:	5f                   	pop    %edi
+  802b34:	5d                   	pop    %ebp
+  802b35:	c3                   	ret
+
+00802b36 <sendfile>:
+{
+  802b36:	55                   	push   %ebp
+  802b37:	89 e5                	mov    %esp,%ebp
+  802b39:	56                   	push   %esi
+  802b3a:	53                   	push   %ebx
+  802b3b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802b3e:	89 f0                	mov    %esi,%eax
+  802b40:	e8 bb fd ff ff       	call   802900 <fd2sockid>
+  802b45:	89 c3                	mov    %eax,%ebx
+  802b47:	85 c0                	test   %eax,%eax
+  802b49:	78 1f                	js     802b6a <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802b4b:	89 f0                	mov    %esi,%eax
+  802b4d:	e8 de fd ff ff       	call   802930 <sock_flags>
+  802b52:	83 ec 0c             	sub    $0xc,%esp
+  802b55:	50                   	push   %eax
+  802b56:	ff 75 14             	push   0x14(%ebp)
+  802b59:	ff 75 10             	push   0x10(%ebp)
+  802b5c:	ff 75 0c             	push   0xc(%ebp)
+  802b5f:	53                   	push   %ebx
+  802b60:	e8 64 06 00 00       	call   8031c9 <nsipc_sendfile>
+  802b65:	89 c3                	mov    %eax,%ebx
+  802b67:	83 c4 20             	add    $0x20,%esp
+}
+  802b6a:	89 d8                	mov    %ebx,%eax
+  802b6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b6f:	5b                   	pop    %ebx
+  802b70:	5e                   	pop    %esi
+  802b71:	5d                   	pop    %ebp
+  802b72:	c3                   	ret
+
+00802b73 <evctl>:
+{
+  802b73:	55                   	push   %ebp
+  802b74:	89 e5                	mov    %esp,%ebp
+  802b76:	53                   	push   %ebx
+  802b77:	83 ec 04             	sub    $0x4,%esp
+  802b7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802b7d:	89 d8                	mov    %ebx,%eax
+  802b7f:	e8 7c fd ff ff       	call   802900 <fd2sockid>
+  802b84:	85 c0                	test   %eax,%eax
+  802b86:	78 10                	js     802b98 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802b88:	83 ec 04             	sub    $0x4,%esp
+  802b8b:	53                   	push   %ebx
+  802b8c:	ff 75 0c             	push   0xc(%ebp)
+  802b8f:	50                   	push   %eax
+  802b90:	e8 d2 0b 00 00       	call   803767 <nsipc_evctl>
+  802b95:	83 c4 10             	add    $0x10,%esp
+}
+  802b98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+
+00802b9d <evwait>:
+{
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802ba3:	ff 75 10             	push   0x10(%ebp)
+  802ba6:	ff 75 0c             	push   0xc(%ebp)
+  802ba9:	ff 75 08             	push   0x8(%ebp)
+  802bac:	e8 e0 0b 00 00       	call   803791 <nsipc_evwait>
+}
+  802bb1:	c9                   	leave
+  802bb2:	c3                   	ret
+
+00802bb3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802bb3:	55                   	push   %ebp
+  802bb4:	89 e5                	mov    %esp,%ebp
+  802bb6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802bb9:	ff 75 10             	push   0x10(%ebp)
+  802bbc:	ff 75 0c             	push   0xc(%ebp)
+  802bbf:	ff 75 08             	push   0x8(%ebp)
+  802bc2:	e8 31 0c 00 00       	call   8037f8 <nsipc_socket>
+  802bc7:	83 c4 10             	add    $0x10,%esp
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 05                	js     802bd3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802bce:	e8 89 fd ff ff       	call   80295c <alloc_sockfd>
+}
+  802bd3:	c9                   	leave
+  802bd4:	c3                   	ret
+
+00802bd5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802bd5:	55                   	push   %ebp
+  802bd6:	89 e5                	mov    %esp,%ebp
+  802bd8:	53                   	push   %ebx
+  802bd9:	83 ec 04             	sub    $0x4,%esp
+  802bdc:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802bde:	83 3d 04 6a 80 00 00 	cmpl   $0x0,0x806a04
+  802be5:	74 26                	je     802c0d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802be7:	6a 07                	push   $0x7
+  802be9:	68 00 80 80 00       	push   $0x808000
+  802bee:	53                   	push   %ebx
+  802bef:	ff 35 04 6a 80 00    	push   0x806a04
+  802bf5:	e8 02 f2 ff ff       	call   801dfc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802bfa:	83 c4 0c             	add    $0xc,%esp
+  802bfd:	6a 00                	push   $0x0
+  802bff:	6a 00                	push   $0x0
+  802c01:	6a 00                	push   $0x0
+  802c03:	e8 64 ef ff ff       	call   801b6c <ipc_recv>
+}
+  802c08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c0b:	c9                   	leave
+  802c0c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c0d:	83 ec 0c             	sub    $0xc,%esp
+  802c10:	6a 03                	push   $0x3
+  802c12:	e8 4e f2 ff ff       	call   801e65 <ipc_find_env>
+  802c17:	a3 04 6a 80 00       	mov    %eax,0x806a04
+  802c1c:	83 c4 10             	add    $0x10,%esp
+  802c1f:	eb c6                	jmp    802be7 <nsipc+0x12>
+
+00802c21 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	56                   	push   %esi
+  802c25:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802c26:	8b 35 10 6a 80 00    	mov    0x806a10,%esi
+		return 0;
+  802c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802c31:	85 f6                	test   %esi,%esi
+  802c33:	75 33                	jne    802c68 <nsbulk_map+0x47>
+  802c35:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802c3a:	83 ec 04             	sub    $0x4,%esp
+  802c3d:	6a 07                	push   $0x7
+  802c3f:	53                   	push   %ebx
+  802c40:	6a 00                	push   $0x0
+  802c42:	e8 46 e3 ff ff       	call   800f8d <sys_page_alloc>
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	78 1a                	js     802c68 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802c4e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c54:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802c5a:	75 de                	jne    802c3a <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802c5c:	c7 05 10 6a 80 00 01 	movl   $0x1,0x806a10
+  802c63:	00 00 00 
+	return 0;
+  802c66:	89 f0                	mov    %esi,%eax
+}
+  802c68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c6b:	5b                   	pop    %ebx
+  802c6c:	5e                   	pop    %esi
+  802c6d:	5d                   	pop    %ebp
+  802c6e:	c3                   	ret
+
+00802c6f <nsbulk_own>:
+{
+  802c6f:	55                   	push   %ebp
+  802c70:	89 e5                	mov    %esp,%ebp
+  802c72:	57                   	push   %edi
+  802c73:	56                   	push   %esi
+  802c74:	53                   	push   %ebx
+  802c75:	83 ec 0c             	sub    $0xc,%esp
+  802c78:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802c7a:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802c7d:	85 d2                	test   %edx,%edx
+  802c7f:	7f 0e                	jg     802c8f <nsbulk_own+0x20>
+	return 0;
+  802c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c86:	eb 47                	jmp    802ccf <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802c88:	83 c3 01             	add    $0x1,%ebx
+  802c8b:	39 fb                	cmp    %edi,%ebx
+  802c8d:	7d 3b                	jge    802cca <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802c8f:	be 01 00 00 00       	mov    $0x1,%esi
+  802c94:	89 d9                	mov    %ebx,%ecx
+  802c96:	d3 e6                	shl    %cl,%esi
+  802c98:	89 f0                	mov    %esi,%eax
+  802c9a:	23 05 0c 6a 80 00    	and    0x806a0c,%eax
+  802ca0:	74 e6                	je     802c88 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802ca2:	83 ec 04             	sub    $0x4,%esp
+  802ca5:	6a 07                	push   $0x7
+  802ca7:	89 d8                	mov    %ebx,%eax
+  802ca9:	c1 e0 0c             	shl    $0xc,%eax
+  802cac:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802cb1:	50                   	push   %eax
+  802cb2:	6a 00                	push   $0x0
+  802cb4:	e8 d4 e2 ff ff       	call   800f8d <sys_page_alloc>
+  802cb9:	83 c4 10             	add    $0x10,%esp
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	78 0f                	js     802ccf <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802cc0:	f7 d6                	not    %esi
+  802cc2:	21 35 0c 6a 80 00    	and    %esi,0x806a0c
+  802cc8:	eb be                	jmp    802c88 <nsbulk_own+0x19>
+	return 0;
+  802cca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cd2:	5b                   	pop    %ebx
+  802cd3:	5e                   	pop    %esi
+  802cd4:	5f                   	pop    %edi
+  802cd5:	5d                   	pop    %ebp
+  802cd6:	c3                   	ret
+
+00802cd7 <nsipc_bulk>:
+{
+  802cd7:	55                   	push   %ebp
+  802cd8:	89 e5                	mov    %esp,%ebp
+  802cda:	57                   	push   %edi
+  802cdb:	56                   	push   %esi
+  802cdc:	53                   	push   %ebx
+  802cdd:	83 ec 1c             	sub    $0x1c,%esp
+  802ce0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ce3:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802ce5:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802ceb:	c1 fb 0c             	sar    $0xc,%ebx
+  802cee:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802cf1:	83 3d 04 6a 80 00 00 	cmpl   $0x0,0x806a04
+  802cf8:	74 56                	je     802d50 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802cfa:	85 ff                	test   %edi,%edi
+  802cfc:	7e 24                	jle    802d22 <nsipc_bulk+0x4b>
+  802cfe:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802d04:	74 1c                	je     802d22 <nsipc_bulk+0x4b>
+  802d06:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802d0c:	c1 e3 0c             	shl    $0xc,%ebx
+  802d0f:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802d14:	0f b6 10             	movzbl (%eax),%edx
+  802d17:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802d19:	05 00 10 00 00       	add    $0x1000,%eax
+  802d1e:	39 d8                	cmp    %ebx,%eax
+  802d20:	75 f2                	jne    802d14 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802d22:	83 ec 0c             	sub    $0xc,%esp
+  802d25:	56                   	push   %esi
+  802d26:	57                   	push   %edi
+  802d27:	68 00 00 00 e0       	push   $0xe0000000
+  802d2c:	ff 75 e4             	push   -0x1c(%ebp)
+  802d2f:	ff 35 04 6a 80 00    	push   0x806a04
+  802d35:	e8 f6 f0 ff ff       	call   801e30 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802d3a:	83 c4 1c             	add    $0x1c,%esp
+  802d3d:	6a 00                	push   $0x0
+  802d3f:	6a 00                	push   $0x0
+  802d41:	6a 00                	push   $0x0
+  802d43:	e8 24 ee ff ff       	call   801b6c <ipc_recv>
+}
+  802d48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4b:	5b                   	pop    %ebx
+  802d4c:	5e                   	pop    %esi
+  802d4d:	5f                   	pop    %edi
+  802d4e:	5d                   	pop    %ebp
+  802d4f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d50:	83 ec 0c             	sub    $0xc,%esp
+  802d53:	6a 03                	push   $0x3
+  802d55:	e8 0b f1 ff ff       	call   801e65 <ipc_find_env>
+  802d5a:	a3 04 6a 80 00       	mov    %eax,0x806a04
+  802d5f:	83 c4 10             	add    $0x10,%esp
+  802d62:	eb 96                	jmp    802cfa <nsipc_bulk+0x23>
+
+00802d64 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802d64:	55                   	push   %ebp
+  802d65:	89 e5                	mov    %esp,%ebp
+  802d67:	53                   	push   %ebx
+  802d68:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802d73:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d76:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d80:	e8 50 fe ff ff       	call   802bd5 <nsipc>
+  802d85:	89 c3                	mov    %eax,%ebx
+  802d87:	85 c0                	test   %eax,%eax
+  802d89:	79 07                	jns    802d92 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d8b:	89 d8                	mov    %ebx,%eax
+  802d8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d90:	c9                   	leave
+  802d91:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d92:	83 ec 04             	sub    $0x4,%esp
+  802d95:	ff 35 10 80 80 00    	push   0x808010
+  802d9b:	68 00 80 80 00       	push   $0x808000
+  802da0:	ff 75 0c             	push   0xc(%ebp)
+  802da3:	e8 61 df ff ff       	call   800d09 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802da8:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802dae:	8b 45 10             	mov    0x10(%ebp),%eax
+  802db1:	89 10                	mov    %edx,(%eax)
+  802db3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802db6:	eb d3                	jmp    802d8b <nsipc_accept+0x27>
+
+00802db8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802db8:	55                   	push   %ebp
+  802db9:	89 e5                	mov    %esp,%ebp
+  802dbb:	53                   	push   %ebx
+  802dbc:	83 ec 08             	sub    $0x8,%esp
+  802dbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc5:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802dca:	53                   	push   %ebx
+  802dcb:	ff 75 0c             	push   0xc(%ebp)
+  802dce:	68 04 80 80 00       	push   $0x808004
+  802dd3:	e8 31 df ff ff       	call   800d09 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802dd8:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802dde:	b8 02 00 00 00       	mov    $0x2,%eax
+  802de3:	e8 ed fd ff ff       	call   802bd5 <nsipc>
+}
+  802de8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802deb:	c9                   	leave
+  802dec:	c3                   	ret
+
+00802ded <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ded:	55                   	push   %ebp
+  802dee:	89 e5                	mov    %esp,%ebp
+  802df0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802df3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802dfb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dfe:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e03:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e08:	e8 c8 fd ff ff       	call   802bd5 <nsipc>
+}
+  802e0d:	c9                   	leave
+  802e0e:	c3                   	ret
+
+00802e0f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e0f:	55                   	push   %ebp
+  802e10:	89 e5                	mov    %esp,%ebp
+  802e12:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e18:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802e1d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e22:	e8 ae fd ff ff       	call   802bd5 <nsipc>
+}
+  802e27:	c9                   	leave
+  802e28:	c3                   	ret
+
+00802e29 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e29:	55                   	push   %ebp
+  802e2a:	89 e5                	mov    %esp,%ebp
+  802e2c:	53                   	push   %ebx
+  802e2d:	83 ec 08             	sub    $0x8,%esp
+  802e30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e36:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e3b:	53                   	push   %ebx
+  802e3c:	ff 75 0c             	push   0xc(%ebp)
+  802e3f:	68 04 80 80 00       	push   $0x808004
+  802e44:	e8 c0 de ff ff       	call   800d09 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802e49:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802e4f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e54:	e8 7c fd ff ff       	call   802bd5 <nsipc>
+}
+  802e59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e5c:	c9                   	leave
+  802e5d:	c3                   	ret
+
+00802e5e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e5e:	55                   	push   %ebp
+  802e5f:	89 e5                	mov    %esp,%ebp
+  802e61:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e67:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e6f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802e74:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e79:	e8 57 fd ff ff       	call   802bd5 <nsipc>
+}
+  802e7e:	c9                   	leave
+  802e7f:	c3                   	ret
+
+00802e80 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e80:	55                   	push   %ebp
+  802e81:	89 e5                	mov    %esp,%ebp
+  802e83:	56                   	push   %esi
+  802e84:	53                   	push   %ebx
+  802e85:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e88:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802e90:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802e96:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e99:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e9e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ea3:	e8 2d fd ff ff       	call   802bd5 <nsipc>
+  802ea8:	89 c3                	mov    %eax,%ebx
+  802eaa:	85 c0                	test   %eax,%eax
+  802eac:	78 22                	js     802ed0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802eae:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802eb3:	39 c6                	cmp    %eax,%esi
+  802eb5:	0f 4e c6             	cmovle %esi,%eax
+  802eb8:	39 c3                	cmp    %eax,%ebx
+  802eba:	7f 1d                	jg     802ed9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ebc:	83 ec 04             	sub    $0x4,%esp
+  802ebf:	53                   	push   %ebx
+  802ec0:	68 00 80 80 00       	push   $0x808000
+  802ec5:	ff 75 0c             	push   0xc(%ebp)
+  802ec8:	e8 3c de ff ff       	call   800d09 <memmove>
+  802ecd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802ed0:	89 d8                	mov    %ebx,%eax
+  802ed2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ed5:	5b                   	pop    %ebx
+  802ed6:	5e                   	pop    %esi
+  802ed7:	5d                   	pop    %ebp
+  802ed8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ed9:	68 b4 4c 80 00       	push   $0x804cb4
+  802ede:	68 c9 4c 80 00       	push   $0x804cc9
+  802ee3:	68 b2 00 00 00       	push   $0xb2
+  802ee8:	68 de 4c 80 00       	push   $0x804cde
+  802eed:	e8 95 d4 ff ff       	call   800387 <_panic>
+
+00802ef2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ef2:	55                   	push   %ebp
+  802ef3:	89 e5                	mov    %esp,%ebp
+  802ef5:	53                   	push   %ebx
+  802ef6:	83 ec 04             	sub    $0x4,%esp
+  802ef9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802efc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eff:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802f04:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f0a:	7f 2e                	jg     802f3a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f0c:	83 ec 04             	sub    $0x4,%esp
+  802f0f:	53                   	push   %ebx
+  802f10:	ff 75 0c             	push   0xc(%ebp)
+  802f13:	68 0c 80 80 00       	push   $0x80800c
+  802f18:	e8 ec dd ff ff       	call   800d09 <memmove>
+	nsipcbuf.send.req_size = size;
+  802f1d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802f23:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f26:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802f2b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f30:	e8 a0 fc ff ff       	call   802bd5 <nsipc>
+}
+  802f35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f38:	c9                   	leave
+  802f39:	c3                   	ret
+	assert(size < 1600);
+  802f3a:	68 ea 4c 80 00       	push   $0x804cea
+  802f3f:	68 c9 4c 80 00       	push   $0x804cc9
+  802f44:	68 bd 00 00 00       	push   $0xbd
+  802f49:	68 de 4c 80 00       	push   $0x804cde
+  802f4e:	e8 34 d4 ff ff       	call   800387 <_panic>
+
+00802f53 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802f53:	55                   	push   %ebp
+  802f54:	89 e5                	mov    %esp,%ebp
+  802f56:	57                   	push   %edi
+  802f57:	56                   	push   %esi
+  802f58:	53                   	push   %ebx
+  802f59:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802f5c:	e8 c0 fc ff ff       	call   802c21 <nsbulk_map>
+  802f61:	85 c0                	test   %eax,%eax
+  802f63:	78 55                	js     802fba <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802f65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802f6c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802f73:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802f7a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802f7d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f80:	0f 8d 24 02 00 00    	jge    8031aa <nsipc_sendmsg+0x257>
+  802f86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f89:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802f8c:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802f8f:	89 d8                	mov    %ebx,%eax
+  802f91:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f96:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802f98:	83 ec 0c             	sub    $0xc,%esp
+  802f9b:	68 00 67 80 00       	push   $0x806700
+  802fa0:	e8 5a 0f 00 00       	call   803eff <pgbatch_init>
+  802fa5:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802fa8:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802faa:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802fad:	e9 82 00 00 00       	jmp    803034 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802fb2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802fb5:	85 db                	test   %ebx,%ebx
+  802fb7:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802fba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbd:	5b                   	pop    %ebx
+  802fbe:	5e                   	pop    %esi
+  802fbf:	5f                   	pop    %edi
+  802fc0:	5d                   	pop    %ebp
+  802fc1:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802fc2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802fc7:	29 c8                	sub    %ecx,%eax
+  802fc9:	39 d0                	cmp    %edx,%eax
+  802fcb:	0f 46 d0             	cmovbe %eax,%edx
+  802fce:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802fd0:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802fd6:	85 ff                	test   %edi,%edi
+  802fd8:	0f 49 c7             	cmovns %edi,%eax
+  802fdb:	c1 f8 0c             	sar    $0xc,%eax
+  802fde:	ba 01 00 00 00       	mov    $0x1,%edx
+  802fe3:	e8 87 fc ff ff       	call   802c6f <nsbulk_own>
+  802fe8:	85 c0                	test   %eax,%eax
+  802fea:	0f 88 17 01 00 00    	js     803107 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802ff0:	83 ec 04             	sub    $0x4,%esp
+  802ff3:	56                   	push   %esi
+  802ff4:	ff 75 e0             	push   -0x20(%ebp)
+  802ff7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802ffa:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802fff:	50                   	push   %eax
+  803000:	e8 04 dd ff ff       	call   800d09 <memmove>
+  803005:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  803008:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80300b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80300e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803011:	0f 84 fd 00 00 00    	je     803114 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  803017:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80301a:	01 f7                	add    %esi,%edi
+  80301c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80301f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803022:	0f 8d 01 01 00 00    	jge    803129 <nsipc_sendmsg+0x1d6>
+  803028:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80302e:	0f 8f f0 00 00 00    	jg     803124 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  803034:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803037:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80303a:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80303d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803040:	89 c2                	mov    %eax,%edx
+  803042:	03 13                	add    (%ebx),%edx
+  803044:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  803047:	8b 73 04             	mov    0x4(%ebx),%esi
+  80304a:	29 c6                	sub    %eax,%esi
+  80304c:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  803051:	29 f9                	sub    %edi,%ecx
+  803053:	39 ce                	cmp    %ecx,%esi
+  803055:	89 ca                	mov    %ecx,%edx
+  803057:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  80305a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80305d:	89 f9                	mov    %edi,%ecx
+  80305f:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  803065:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803068:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80306d:	09 c8                	or     %ecx,%eax
+  80306f:	0f 85 4d ff ff ff    	jne    802fc2 <nsipc_sendmsg+0x6f>
+  803075:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80307b:	0f 86 41 ff ff ff    	jbe    802fc2 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803081:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803087:	85 ff                	test   %edi,%edi
+  803089:	0f 49 c7             	cmovns %edi,%eax
+  80308c:	c1 f8 0c             	sar    $0xc,%eax
+  80308f:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  803091:	89 d1                	mov    %edx,%ecx
+  803093:	c1 e9 0c             	shr    $0xc,%ecx
+  803096:	01 c8                	add    %ecx,%eax
+  803098:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80309b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80309e:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8030a0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8030a3:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8030a8:	29 c8                	sub    %ecx,%eax
+  8030aa:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8030ad:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8030b0:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8030b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030b7:	89 f9                	mov    %edi,%ecx
+  8030b9:	d3 e0                	shl    %cl,%eax
+  8030bb:	09 05 0c 6a 80 00    	or     %eax,0x806a0c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8030c1:	83 ec 08             	sub    $0x8,%esp
+  8030c4:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8030c6:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8030c9:	50                   	push   %eax
+  8030ca:	6a 00                	push   $0x0
+  8030cc:	56                   	push   %esi
+  8030cd:	6a 00                	push   $0x0
+  8030cf:	68 00 67 80 00       	push   $0x806700
+  8030d4:	e8 e4 0e 00 00       	call   803fbd <pgbatch_map>
+  8030d9:	83 c4 20             	add    $0x20,%esp
+  8030dc:	85 c0                	test   %eax,%eax
+  8030de:	0f 88 ce fe ff ff    	js     802fb2 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8030e4:	83 c7 01             	add    $0x1,%edi
+  8030e7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8030ed:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8030f0:	39 c7                	cmp    %eax,%edi
+  8030f2:	75 be                	jne    8030b2 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8030f4:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8030f7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8030fa:	89 d6                	mov    %edx,%esi
+  8030fc:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803102:	e9 01 ff ff ff       	jmp    803008 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  803107:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80310a:	85 db                	test   %ebx,%ebx
+  80310c:	0f 45 c3             	cmovne %ebx,%eax
+  80310f:	e9 a6 fe ff ff       	jmp    802fba <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  803114:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  803118:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80311f:	e9 f3 fe ff ff       	jmp    803017 <nsipc_sendmsg+0xc4>
+  803124:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  803127:	eb 03                	jmp    80312c <nsipc_sendmsg+0x1d9>
+  803129:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80312c:	83 ec 0c             	sub    $0xc,%esp
+  80312f:	68 00 67 80 00       	push   $0x806700
+  803134:	e8 d4 0d 00 00       	call   803f0d <pgbatch_flush>
+  803139:	83 c4 10             	add    $0x10,%esp
+  80313c:	85 c0                	test   %eax,%eax
+  80313e:	78 50                	js     803190 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  803140:	8b 45 08             	mov    0x8(%ebp),%eax
+  803143:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  803148:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  80314e:	89 fb                	mov    %edi,%ebx
+  803150:	29 f3                	sub    %esi,%ebx
+  803152:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  803158:	8b 45 14             	mov    0x14(%ebp),%eax
+  80315b:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  803160:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803165:	89 fa                	mov    %edi,%edx
+  803167:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80316c:	e8 66 fb ff ff       	call   802cd7 <nsipc_bulk>
+  803171:	85 c0                	test   %eax,%eax
+  803173:	78 28                	js     80319d <nsipc_sendmsg+0x24a>
+		sent += r;
+  803175:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  803178:	39 c3                	cmp    %eax,%ebx
+  80317a:	75 0c                	jne    803188 <nsipc_sendmsg+0x235>
+  80317c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80317f:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803182:	0f 8f f2 fd ff ff    	jg     802f7a <nsipc_sendmsg+0x27>
+		sent += r;
+  803188:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80318b:	e9 2a fe ff ff       	jmp    802fba <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803190:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803193:	85 db                	test   %ebx,%ebx
+  803195:	0f 45 c3             	cmovne %ebx,%eax
+  803198:	e9 1d fe ff ff       	jmp    802fba <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80319d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8031a0:	85 db                	test   %ebx,%ebx
+  8031a2:	0f 45 c3             	cmovne %ebx,%eax
+  8031a5:	e9 10 fe ff ff       	jmp    802fba <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8031aa:	83 ec 0c             	sub    $0xc,%esp
+  8031ad:	68 00 67 80 00       	push   $0x806700
+  8031b2:	e8 48 0d 00 00       	call   803eff <pgbatch_init>
+  8031b7:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8031ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8031bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031c4:	e9 63 ff ff ff       	jmp    80312c <nsipc_sendmsg+0x1d9>
+
+008031c9 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8031c9:	55                   	push   %ebp
+  8031ca:	89 e5                	mov    %esp,%ebp
+  8031cc:	57                   	push   %edi
+  8031cd:	56                   	push   %esi
+  8031ce:	53                   	push   %ebx
+  8031cf:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8031d2:	83 3d 08 6a 80 00 00 	cmpl   $0x0,0x806a08
+  8031d9:	0f 84 c8 00 00 00    	je     8032a7 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8031df:	83 3d 04 6a 80 00 00 	cmpl   $0x0,0x806a04
+  8031e6:	0f 84 e4 00 00 00    	je     8032d0 <nsipc_sendfile+0x107>
+{
+  8031ec:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8031f1:	89 fb                	mov    %edi,%ebx
+  8031f3:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8031f6:	0f 83 f0 00 00 00    	jae    8032ec <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8031fc:	89 fa                	mov    %edi,%edx
+  8031fe:	03 55 10             	add    0x10(%ebp),%edx
+  803201:	89 d0                	mov    %edx,%eax
+  803203:	c1 f8 1f             	sar    $0x1f,%eax
+  803206:	c1 e8 14             	shr    $0x14,%eax
+  803209:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80320c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803212:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803214:	6a 10                	push   $0x10
+  803216:	68 00 20 01 e0       	push   $0xe0012000
+  80321b:	52                   	push   %edx
+  80321c:	ff 75 0c             	push   0xc(%ebp)
+  80321f:	e8 fe f4 ff ff       	call   802722 <fmap>
+  803224:	83 c4 10             	add    $0x10,%esp
+  803227:	85 c0                	test   %eax,%eax
+  803229:	0f 8e b8 00 00 00    	jle    8032e7 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80322f:	39 c6                	cmp    %eax,%esi
+  803231:	0f 8d b5 00 00 00    	jge    8032ec <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  803237:	29 f0                	sub    %esi,%eax
+  803239:	8b 55 14             	mov    0x14(%ebp),%edx
+  80323c:	29 da                	sub    %ebx,%edx
+  80323e:	39 d0                	cmp    %edx,%eax
+  803240:	89 d3                	mov    %edx,%ebx
+  803242:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  803245:	8b 45 08             	mov    0x8(%ebp),%eax
+  803248:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  80324d:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  803253:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  803259:	8b 45 18             	mov    0x18(%ebp),%eax
+  80325c:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803261:	83 ec 0c             	sub    $0xc,%esp
+  803264:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  803266:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  80326d:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803270:	83 c0 01             	add    $0x1,%eax
+  803273:	50                   	push   %eax
+  803274:	68 00 10 01 e0       	push   $0xe0011000
+  803279:	6a 11                	push   $0x11
+  80327b:	ff 35 04 6a 80 00    	push   0x806a04
+  803281:	e8 aa eb ff ff       	call   801e30 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803286:	83 c4 1c             	add    $0x1c,%esp
+  803289:	6a 00                	push   $0x0
+  80328b:	6a 00                	push   $0x0
+  80328d:	6a 00                	push   $0x0
+  80328f:	e8 d8 e8 ff ff       	call   801b6c <ipc_recv>
+  803294:	83 c4 10             	add    $0x10,%esp
+  803297:	85 c0                	test   %eax,%eax
+  803299:	78 5b                	js     8032f6 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  80329b:	01 c7                	add    %eax,%edi
+		if (r < n)
+  80329d:	39 c3                	cmp    %eax,%ebx
+  80329f:	0f 8e 4c ff ff ff    	jle    8031f1 <nsipc_sendfile+0x28>
+  8032a5:	eb 45                	jmp    8032ec <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8032a7:	83 ec 04             	sub    $0x4,%esp
+  8032aa:	6a 07                	push   $0x7
+  8032ac:	68 00 10 01 e0       	push   $0xe0011000
+  8032b1:	6a 00                	push   $0x0
+  8032b3:	e8 d5 dc ff ff       	call   800f8d <sys_page_alloc>
+  8032b8:	89 c7                	mov    %eax,%edi
+  8032ba:	83 c4 10             	add    $0x10,%esp
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	78 2b                	js     8032ec <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8032c1:	c7 05 08 6a 80 00 01 	movl   $0x1,0x806a08
+  8032c8:	00 00 00 
+  8032cb:	e9 0f ff ff ff       	jmp    8031df <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8032d0:	83 ec 0c             	sub    $0xc,%esp
+  8032d3:	6a 03                	push   $0x3
+  8032d5:	e8 8b eb ff ff       	call   801e65 <ipc_find_env>
+  8032da:	a3 04 6a 80 00       	mov    %eax,0x806a04
+  8032df:	83 c4 10             	add    $0x10,%esp
+  8032e2:	e9 05 ff ff ff       	jmp    8031ec <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8032e7:	85 ff                	test   %edi,%edi
+  8032e9:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8032ec:	89 f8                	mov    %edi,%eax
+  8032ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032f1:	5b                   	pop    %ebx
+  8032f2:	5e                   	pop    %esi
+  8032f3:	5f                   	pop    %edi
+  8032f4:	5d                   	pop    %ebp
+  8032f5:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8032f6:	85 ff                	test   %edi,%edi
+  8032f8:	0f 44 f8             	cmove  %eax,%edi
+  8032fb:	eb ef                	jmp    8032ec <nsipc_sendfile+0x123>
+
+008032fd <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8032fd:	55                   	push   %ebp
+  8032fe:	89 e5                	mov    %esp,%ebp
+  803300:	57                   	push   %edi
+  803301:	56                   	push   %esi
+  803302:	53                   	push   %ebx
+  803303:	83 ec 1c             	sub    $0x1c,%esp
+  803306:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803309:	e8 13 f9 ff ff       	call   802c21 <nsbulk_map>
+  80330e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803311:	85 c0                	test   %eax,%eax
+  803313:	0f 88 ba 00 00 00    	js     8033d3 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803319:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80331d:	0f 8e bb 00 00 00    	jle    8033de <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803323:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803328:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80332d:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803332:	89 f8                	mov    %edi,%eax
+  803334:	29 f0                	sub    %esi,%eax
+  803336:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80333a:	39 c8                	cmp    %ecx,%eax
+  80333c:	0f 47 c1             	cmova  %ecx,%eax
+  80333f:	01 f0                	add    %esi,%eax
+  803341:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803343:	83 c2 01             	add    $0x1,%edx
+  803346:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803349:	7e 07                	jle    803352 <nsipc_recvmsg+0x55>
+  80334b:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803350:	7e e0                	jle    803332 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803352:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  803358:	c1 fa 0c             	sar    $0xc,%edx
+  80335b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803360:	e8 0a f9 ff ff       	call   802c6f <nsbulk_own>
+  803365:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	78 67                	js     8033d3 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80336c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80336f:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803374:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80337a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80337d:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803382:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803387:	89 f2                	mov    %esi,%edx
+  803389:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80338e:	e8 44 f9 ff ff       	call   802cd7 <nsipc_bulk>
+  803393:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803396:	85 c0                	test   %eax,%eax
+  803398:	78 39                	js     8033d3 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  80339a:	39 f0                	cmp    %esi,%eax
+  80339c:	7f 4a                	jg     8033e8 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80339e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a3:	85 c0                	test   %eax,%eax
+  8033a5:	7e 2c                	jle    8033d3 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8033a7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8033aa:	29 fe                	sub    %edi,%esi
+  8033ac:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033af:	39 c6                	cmp    %eax,%esi
+  8033b1:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8033b4:	83 ec 04             	sub    $0x4,%esp
+  8033b7:	56                   	push   %esi
+  8033b8:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8033be:	50                   	push   %eax
+  8033bf:	ff 33                	push   (%ebx)
+  8033c1:	e8 43 d9 ff ff       	call   800d09 <memmove>
+		n += m;
+  8033c6:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8033c8:	83 c3 08             	add    $0x8,%ebx
+  8033cb:	83 c4 10             	add    $0x10,%esp
+  8033ce:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8033d1:	7f d4                	jg     8033a7 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8033d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d9:	5b                   	pop    %ebx
+  8033da:	5e                   	pop    %esi
+  8033db:	5f                   	pop    %edi
+  8033dc:	5d                   	pop    %ebp
+  8033dd:	c3                   	ret
+	int r, i, n, len = 0;
+  8033de:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e3:	e9 6a ff ff ff       	jmp    803352 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8033e8:	68 c0 4c 80 00       	push   $0x804cc0
+  8033ed:	68 c9 4c 80 00       	push   $0x804cc9
+  8033f2:	68 3b 01 00 00       	push   $0x13b
+  8033f7:	68 de 4c 80 00       	push   $0x804cde
+  8033fc:	e8 86 cf ff ff       	call   800387 <_panic>
+
+00803401 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803401:	55                   	push   %ebp
+  803402:	89 e5                	mov    %esp,%ebp
+  803404:	57                   	push   %edi
+  803405:	56                   	push   %esi
+  803406:	53                   	push   %ebx
+  803407:	83 ec 0c             	sub    $0xc,%esp
+  80340a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80340d:	8b 75 10             	mov    0x10(%ebp),%esi
+  803410:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803413:	8b 45 08             	mov    0x8(%ebp),%eax
+  803416:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80341b:	8b 07                	mov    (%edi),%eax
+  80341d:	a3 04 80 80 00       	mov    %eax,0x808004
+  803422:	8b 47 04             	mov    0x4(%edi),%eax
+  803425:	a3 08 80 80 00       	mov    %eax,0x808008
+  80342a:	8b 47 08             	mov    0x8(%edi),%eax
+  80342d:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  803432:	8b 47 0c             	mov    0xc(%edi),%eax
+  803435:	a3 10 80 80 00       	mov    %eax,0x808010
+  80343a:	8b 47 10             	mov    0x10(%edi),%eax
+  80343d:	a3 14 80 80 00       	mov    %eax,0x808014
+  803442:	8b 47 14             	mov    0x14(%edi),%eax
+  803445:	a3 18 80 80 00       	mov    %eax,0x808018
+  80344a:	8b 47 18             	mov    0x18(%edi),%eax
+  80344d:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803452:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803455:	a3 20 80 80 00       	mov    %eax,0x808020
+  80345a:	8b 47 20             	mov    0x20(%edi),%eax
+  80345d:	a3 24 80 80 00       	mov    %eax,0x808024
+  803462:	8b 47 24             	mov    0x24(%edi),%eax
+  803465:	a3 28 80 80 00       	mov    %eax,0x808028
+  80346a:	8b 47 28             	mov    0x28(%edi),%eax
+  80346d:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  803472:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803475:	a3 30 80 80 00       	mov    %eax,0x808030
+  80347a:	8b 47 30             	mov    0x30(%edi),%eax
+  80347d:	a3 34 80 80 00       	mov    %eax,0x808034
+  803482:	8b 47 34             	mov    0x34(%edi),%eax
+  803485:	a3 38 80 80 00       	mov    %eax,0x808038
+  80348a:	8b 47 38             	mov    0x38(%edi),%eax
+  80348d:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  803492:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803495:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  80349a:	8b 06                	mov    (%esi),%eax
+  80349c:	a3 44 80 80 00       	mov    %eax,0x808044
+  8034a1:	8b 46 04             	mov    0x4(%esi),%eax
+  8034a4:	a3 48 80 80 00       	mov    %eax,0x808048
+  8034a9:	8b 46 08             	mov    0x8(%esi),%eax
+  8034ac:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8034b1:	8b 46 0c             	mov    0xc(%esi),%eax
+  8034b4:	a3 50 80 80 00       	mov    %eax,0x808050
+  8034b9:	8b 46 10             	mov    0x10(%esi),%eax
+  8034bc:	a3 54 80 80 00       	mov    %eax,0x808054
+  8034c1:	8b 46 14             	mov    0x14(%esi),%eax
+  8034c4:	a3 58 80 80 00       	mov    %eax,0x808058
+  8034c9:	8b 46 18             	mov    0x18(%esi),%eax
+  8034cc:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8034d1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8034d4:	a3 60 80 80 00       	mov    %eax,0x808060
+  8034d9:	8b 46 20             	mov    0x20(%esi),%eax
+  8034dc:	a3 64 80 80 00       	mov    %eax,0x808064
+  8034e1:	8b 46 24             	mov    0x24(%esi),%eax
+  8034e4:	a3 68 80 80 00       	mov    %eax,0x808068
+  8034e9:	8b 46 28             	mov    0x28(%esi),%eax
+  8034ec:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8034f1:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8034f4:	a3 70 80 80 00       	mov    %eax,0x808070
+  8034f9:	8b 46 30             	mov    0x30(%esi),%eax
+  8034fc:	a3 74 80 80 00       	mov    %eax,0x808074
+  803501:	8b 46 34             	mov    0x34(%esi),%eax
+  803504:	a3 78 80 80 00       	mov    %eax,0x808078
+  803509:	8b 46 38             	mov    0x38(%esi),%eax
+  80350c:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  803511:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803514:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803519:	8b 03                	mov    (%ebx),%eax
+  80351b:	a3 84 80 80 00       	mov    %eax,0x808084
+  803520:	8b 43 04             	mov    0x4(%ebx),%eax
+  803523:	a3 88 80 80 00       	mov    %eax,0x808088
+  803528:	8b 43 08             	mov    0x8(%ebx),%eax
+  80352b:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  803530:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803533:	a3 90 80 80 00       	mov    %eax,0x808090
+  803538:	8b 43 10             	mov    0x10(%ebx),%eax
+  80353b:	a3 94 80 80 00       	mov    %eax,0x808094
+  803540:	8b 43 14             	mov    0x14(%ebx),%eax
+  803543:	a3 98 80 80 00       	mov    %eax,0x808098
+  803548:	8b 43 18             	mov    0x18(%ebx),%eax
+  80354b:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803550:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803553:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  803558:	8b 43 20             	mov    0x20(%ebx),%eax
+  80355b:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803560:	8b 43 24             	mov    0x24(%ebx),%eax
+  803563:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  803568:	8b 43 28             	mov    0x28(%ebx),%eax
+  80356b:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803570:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803573:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  803578:	8b 43 30             	mov    0x30(%ebx),%eax
+  80357b:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803580:	8b 43 34             	mov    0x34(%ebx),%eax
+  803583:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  803588:	8b 43 38             	mov    0x38(%ebx),%eax
+  80358b:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803590:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803593:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  803598:	8b 45 18             	mov    0x18(%ebp),%eax
+  80359b:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8035a0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8035a5:	e8 2b f6 ff ff       	call   802bd5 <nsipc>
+  8035aa:	85 c0                	test   %eax,%eax
+  8035ac:	0f 88 ad 01 00 00    	js     80375f <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8035b2:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8035b8:	89 17                	mov    %edx,(%edi)
+  8035ba:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8035c0:	89 57 04             	mov    %edx,0x4(%edi)
+  8035c3:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8035c9:	89 57 08             	mov    %edx,0x8(%edi)
+  8035cc:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8035d2:	89 57 0c             	mov    %edx,0xc(%edi)
+  8035d5:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8035db:	89 57 10             	mov    %edx,0x10(%edi)
+  8035de:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8035e4:	89 57 14             	mov    %edx,0x14(%edi)
+  8035e7:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8035ed:	89 57 18             	mov    %edx,0x18(%edi)
+  8035f0:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8035f6:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8035f9:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8035ff:	89 57 20             	mov    %edx,0x20(%edi)
+  803602:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  803608:	89 57 24             	mov    %edx,0x24(%edi)
+  80360b:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803611:	89 57 28             	mov    %edx,0x28(%edi)
+  803614:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80361a:	89 57 2c             	mov    %edx,0x2c(%edi)
+  80361d:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  803623:	89 57 30             	mov    %edx,0x30(%edi)
+  803626:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  80362c:	89 57 34             	mov    %edx,0x34(%edi)
+  80362f:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  803635:	89 57 38             	mov    %edx,0x38(%edi)
+  803638:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  80363e:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803641:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  803647:	89 16                	mov    %edx,(%esi)
+  803649:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  80364f:	89 56 04             	mov    %edx,0x4(%esi)
+  803652:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  803658:	89 56 08             	mov    %edx,0x8(%esi)
+  80365b:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803661:	89 56 0c             	mov    %edx,0xc(%esi)
+  803664:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80366a:	89 56 10             	mov    %edx,0x10(%esi)
+  80366d:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803673:	89 56 14             	mov    %edx,0x14(%esi)
+  803676:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  80367c:	89 56 18             	mov    %edx,0x18(%esi)
+  80367f:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  803685:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803688:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  80368e:	89 56 20             	mov    %edx,0x20(%esi)
+  803691:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  803697:	89 56 24             	mov    %edx,0x24(%esi)
+  80369a:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8036a0:	89 56 28             	mov    %edx,0x28(%esi)
+  8036a3:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  8036a9:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8036ac:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8036b2:	89 56 30             	mov    %edx,0x30(%esi)
+  8036b5:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8036bb:	89 56 34             	mov    %edx,0x34(%esi)
+  8036be:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8036c4:	89 56 38             	mov    %edx,0x38(%esi)
+  8036c7:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8036cd:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  8036d0:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8036d6:	89 13                	mov    %edx,(%ebx)
+  8036d8:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  8036de:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036e1:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  8036e7:	89 53 08             	mov    %edx,0x8(%ebx)
+  8036ea:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8036f0:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8036f3:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8036f9:	89 53 10             	mov    %edx,0x10(%ebx)
+  8036fc:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803702:	89 53 14             	mov    %edx,0x14(%ebx)
+  803705:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  80370b:	89 53 18             	mov    %edx,0x18(%ebx)
+  80370e:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  803714:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803717:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  80371d:	89 53 20             	mov    %edx,0x20(%ebx)
+  803720:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  803726:	89 53 24             	mov    %edx,0x24(%ebx)
+  803729:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  80372f:	89 53 28             	mov    %edx,0x28(%ebx)
+  803732:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  803738:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  80373b:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803741:	89 53 30             	mov    %edx,0x30(%ebx)
+  803744:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  80374a:	89 53 34             	mov    %edx,0x34(%ebx)
+  80374d:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803753:	89 53 38             	mov    %edx,0x38(%ebx)
+  803756:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  80375c:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80375f:	83 c4 0c             	add    $0xc,%esp
+  803762:	5b                   	pop    %ebx
+  803763:	5e                   	pop    %esi
+  803764:	5f                   	pop    %edi
+  803765:	5d                   	pop    %ebp
+  803766:	c3                   	ret
+
+00803767 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803767:	55                   	push   %ebp
+  803768:	89 e5                	mov    %esp,%ebp
+  80376a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80376d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803770:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803775:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803778:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  80377d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803780:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  803785:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80378a:	e8 46 f4 ff ff       	call   802bd5 <nsipc>
+}
+  80378f:	c9                   	leave
+  803790:	c3                   	ret
+
+00803791 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803791:	55                   	push   %ebp
+  803792:	89 e5                	mov    %esp,%ebp
+  803794:	56                   	push   %esi
+  803795:	53                   	push   %ebx
+  803796:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803799:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80379f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8037a2:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  8037a7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8037ac:	e8 24 f4 ff ff       	call   802bd5 <nsipc>
+  8037b1:	89 c3                	mov    %eax,%ebx
+  8037b3:	85 c0                	test   %eax,%eax
+  8037b5:	7e 1f                	jle    8037d6 <nsipc_evwait+0x45>
+		assert(r <= max);
+  8037b7:	39 c6                	cmp    %eax,%esi
+  8037b9:	7c 24                	jl     8037df <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8037bb:	83 ec 04             	sub    $0x4,%esp
+  8037be:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8037c5:	50                   	push   %eax
+  8037c6:	68 00 80 80 00       	push   $0x808000
+  8037cb:	ff 75 08             	push   0x8(%ebp)
+  8037ce:	e8 36 d5 ff ff       	call   800d09 <memmove>
+  8037d3:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8037d6:	89 d8                	mov    %ebx,%eax
+  8037d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037db:	5b                   	pop    %ebx
+  8037dc:	5e                   	pop    %esi
+  8037dd:	5d                   	pop    %ebp
+  8037de:	c3                   	ret
+		assert(r <= max);
+  8037df:	68 f6 4c 80 00       	push   $0x804cf6
+  8037e4:	68 c9 4c 80 00       	push   $0x804cc9
+  8037e9:	68 6a 01 00 00       	push   $0x16a
+  8037ee:	68 de 4c 80 00       	push   $0x804cde
+  8037f3:	e8 8f cb ff ff       	call   800387 <_panic>
+
+008037f8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8037f8:	55                   	push   %ebp
+  8037f9:	89 e5                	mov    %esp,%ebp
+  8037fb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8037fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803801:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803806:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803809:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80380e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803811:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803816:	b8 09 00 00 00       	mov    $0x9,%eax
+  80381b:	e8 b5 f3 ff ff       	call   802bd5 <nsipc>
+}
+  803820:	c9                   	leave
+  803821:	c3                   	ret
+
+00803822 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803822:	55                   	push   %ebp
+  803823:	89 e5                	mov    %esp,%ebp
+  803825:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80382b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803830:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803835:	e8 9b f3 ff ff       	call   802bd5 <nsipc>
+}
+  80383a:	c9                   	leave
+  80383b:	c3                   	ret
+
+0080383c <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  80383c:	55                   	push   %ebp
+  80383d:	89 e5                	mov    %esp,%ebp
+  80383f:	53                   	push   %ebx
+  803840:	83 ec 04             	sub    $0x4,%esp
+  803843:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803846:	b8 12 00 00 00       	mov    $0x12,%eax
+  80384b:	e8 85 f3 ff ff       	call   802bd5 <nsipc>
+  803850:	85 c0                	test   %eax,%eax
+  803852:	78 50                	js     8038a4 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803854:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  80385a:	89 13                	mov    %edx,(%ebx)
+  80385c:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803862:	89 53 04             	mov    %edx,0x4(%ebx)
+  803865:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80386b:	89 53 08             	mov    %edx,0x8(%ebx)
+  80386e:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803874:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803877:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80387d:	89 53 10             	mov    %edx,0x10(%ebx)
+  803880:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803886:	89 53 14             	mov    %edx,0x14(%ebx)
+  803889:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80388f:	89 53 18             	mov    %edx,0x18(%ebx)
+  803892:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803898:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80389b:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8038a1:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8038a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a7:	c9                   	leave
+  8038a8:	c3                   	ret
+
+008038a9 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8038a9:	55                   	push   %ebp
+  8038aa:	89 e5                	mov    %esp,%ebp
+  8038ac:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8038af:	6a 03                	push   $0x3
+  8038b1:	e8 af e5 ff ff       	call   801e65 <ipc_find_env>
+  8038b6:	a3 04 6a 80 00       	mov    %eax,0x806a04
+	nsipcbuf.shard.req_shard = shard;
+  8038bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038be:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8038c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8038c8:	e8 08 f3 ff ff       	call   802bd5 <nsipc>
+  8038cd:	83 c4 10             	add    $0x10,%esp
+  8038d0:	85 c0                	test   %eax,%eax
+  8038d2:	78 0a                	js     8038de <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8038d4:	a3 04 6a 80 00       	mov    %eax,0x806a04
+	return 0;
+  8038d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038de:	c9                   	leave
+  8038df:	c3                   	ret
+
+008038e0 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8038e0:	55                   	push   %ebp
+  8038e1:	89 e5                	mov    %esp,%ebp
+  8038e3:	57                   	push   %edi
+  8038e4:	56                   	push   %esi
+  8038e5:	53                   	push   %ebx
+  8038e6:	83 ec 1c             	sub    $0x1c,%esp
+  8038e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8038ec:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8038ef:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8038f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038f9:	89 e0                	mov    %esp,%eax
+  8038fb:	89 f2                	mov    %esi,%edx
+  8038fd:	29 c2                	sub    %eax,%edx
+  8038ff:	89 d0                	mov    %edx,%eax
+  803901:	c1 e8 0f             	shr    $0xf,%eax
+  803904:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80390a:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80390d:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  803914:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803917:	83 ec 0c             	sub    $0xc,%esp
+  80391a:	ff 75 e0             	push   -0x20(%ebp)
+  80391d:	e8 41 0b 00 00       	call   804463 <pageref>
+  803922:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803925:	83 c4 04             	add    $0x4,%esp
+  803928:	ff 75 dc             	push   -0x24(%ebp)
+  80392b:	e8 33 0b 00 00       	call   804463 <pageref>
+  803930:	89 e2                	mov    %esp,%edx
+  803932:	89 f1                	mov    %esi,%ecx
+  803934:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803936:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803939:	89 ca                	mov    %ecx,%edx
+  80393b:	c1 ea 0f             	shr    $0xf,%edx
+  80393e:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803944:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803947:	8b 14 95 20 6a 80 00 	mov    0x806a20(,%edx,4),%edx
+  80394e:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803951:	39 d7                	cmp    %edx,%edi
+  803953:	74 40                	je     803995 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803955:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803958:	75 9f                	jne    8038f9 <_pipeisclosed+0x19>
+  80395a:	89 e2                	mov    %esp,%edx
+  80395c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803961:	29 d0                	sub    %edx,%eax
+  803963:	89 c2                	mov    %eax,%edx
+  803965:	c1 ea 0f             	shr    $0xf,%edx
+  803968:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80396d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803972:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803975:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80397c:	8b 40 58             	mov    0x58(%eax),%eax
+  80397f:	6a 01                	push   $0x1
+  803981:	50                   	push   %eax
+  803982:	57                   	push   %edi
+  803983:	68 ff 4c 80 00       	push   $0x804cff
+  803988:	e8 d5 ca ff ff       	call   800462 <cprintf>
+  80398d:	83 c4 10             	add    $0x10,%esp
+  803990:	e9 5f ff ff ff       	jmp    8038f4 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803995:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803998:	0f 94 c0             	sete   %al
+  80399b:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80399e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039a1:	5b                   	pop    %ebx
+  8039a2:	5e                   	pop    %esi
+  8039a3:	5f                   	pop    %edi
+  8039a4:	5d                   	pop    %ebp
+  8039a5:	c3                   	ret
+
+008039a6 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8039a6:	55                   	push   %ebp
+  8039a7:	89 e5                	mov    %esp,%ebp
+  8039a9:	53                   	push   %ebx
+  8039aa:	83 ec 0c             	sub    $0xc,%esp
+  8039ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8039b0:	53                   	push   %ebx
+  8039b1:	6a 00                	push   $0x0
+  8039b3:	e8 5a d6 ff ff       	call   801012 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8039b8:	89 1c 24             	mov    %ebx,(%esp)
+  8039bb:	e8 f4 e4 ff ff       	call   801eb4 <fd2data>
+  8039c0:	83 c4 08             	add    $0x8,%esp
+  8039c3:	50                   	push   %eax
+  8039c4:	6a 00                	push   $0x0
+  8039c6:	e8 47 d6 ff ff       	call   801012 <sys_page_unmap>
+}
+  8039cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039ce:	c9                   	leave
+  8039cf:	c3                   	ret
+
+008039d0 <devpipe_read>:
+{
+  8039d0:	55                   	push   %ebp
+  8039d1:	89 e5                	mov    %esp,%ebp
+  8039d3:	57                   	push   %edi
+  8039d4:	56                   	push   %esi
+  8039d5:	53                   	push   %ebx
+  8039d6:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8039d9:	ff 75 08             	push   0x8(%ebp)
+  8039dc:	e8 d3 e4 ff ff       	call   801eb4 <fd2data>
+  8039e1:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8039e3:	8b 70 04             	mov    0x4(%eax),%esi
+  8039e6:	8b 00                	mov    (%eax),%eax
+  8039e8:	83 c4 10             	add    $0x10,%esp
+  8039eb:	39 f0                	cmp    %esi,%eax
+  8039ed:	75 36                	jne    803a25 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8039ef:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8039f2:	89 da                	mov    %ebx,%edx
+  8039f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039f7:	e8 e4 fe ff ff       	call   8038e0 <_pipeisclosed>
+  8039fc:	85 c0                	test   %eax,%eax
+  8039fe:	0f 85 d4 00 00 00    	jne    803ad8 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803a04:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a09:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803a0d:	83 ec 04             	sub    $0x4,%esp
+  803a10:	6a ff                	push   $0xffffffff
+  803a12:	56                   	push   %esi
+  803a13:	57                   	push   %edi
+  803a14:	e8 72 d9 ff ff       	call   80138b <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803a19:	8b 73 04             	mov    0x4(%ebx),%esi
+  803a1c:	8b 03                	mov    (%ebx),%eax
+  803a1e:	83 c4 10             	add    $0x10,%esp
+  803a21:	39 c6                	cmp    %eax,%esi
+  803a23:	74 cd                	je     8039f2 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a25:	8b 73 04             	mov    0x4(%ebx),%esi
+  803a28:	8b 03                	mov    (%ebx),%eax
+  803a2a:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803a30:	29 c6                	sub    %eax,%esi
+  803a32:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a37:	f7 e6                	mul    %esi
+  803a39:	c1 ea 0c             	shr    $0xc,%edx
+  803a3c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a42:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803a44:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a47:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803a4b:	8b 0b                	mov    (%ebx),%ecx
+  803a4d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a52:	f7 e1                	mul    %ecx
+  803a54:	c1 ea 0b             	shr    $0xb,%edx
+  803a57:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803a5d:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803a5f:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803a64:	29 cf                	sub    %ecx,%edi
+  803a66:	39 f7                	cmp    %esi,%edi
+  803a68:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803a6b:	83 ec 04             	sub    $0x4,%esp
+  803a6e:	57                   	push   %edi
+  803a6f:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803a73:	50                   	push   %eax
+  803a74:	ff 75 0c             	push   0xc(%ebp)
+  803a77:	e8 8d d2 ff ff       	call   800d09 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803a7c:	83 c4 0c             	add    $0xc,%esp
+  803a7f:	89 f0                	mov    %esi,%eax
+  803a81:	29 f8                	sub    %edi,%eax
+  803a83:	50                   	push   %eax
+  803a84:	8d 43 10             	lea    0x10(%ebx),%eax
+  803a87:	50                   	push   %eax
+  803a88:	89 f8                	mov    %edi,%eax
+  803a8a:	03 45 0c             	add    0xc(%ebp),%eax
+  803a8d:	50                   	push   %eax
+  803a8e:	e8 76 d2 ff ff       	call   800d09 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803a93:	8b 0b                	mov    (%ebx),%ecx
+  803a95:	01 f1                	add    %esi,%ecx
+  803a97:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a9c:	f7 e1                	mul    %ecx
+  803a9e:	c1 ea 0c             	shr    $0xc,%edx
+  803aa1:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803aa7:	29 c1                	sub    %eax,%ecx
+  803aa9:	89 0b                	mov    %ecx,(%ebx)
+  803aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab0:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803ab4:	83 c4 10             	add    $0x10,%esp
+  803ab7:	85 c0                	test   %eax,%eax
+  803ab9:	75 0a                	jne    803ac5 <devpipe_read+0xf5>
+	return n;
+  803abb:	89 f0                	mov    %esi,%eax
+}
+  803abd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac0:	5b                   	pop    %ebx
+  803ac1:	5e                   	pop    %esi
+  803ac2:	5f                   	pop    %edi
+  803ac3:	5d                   	pop    %ebp
+  803ac4:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803ac5:	83 ec 08             	sub    $0x8,%esp
+  803ac8:	68 00 04 00 00       	push   $0x400
+  803acd:	53                   	push   %ebx
+  803ace:	e8 da d8 ff ff       	call   8013ad <sys_futex_wake>
+  803ad3:	83 c4 10             	add    $0x10,%esp
+  803ad6:	eb e3                	jmp    803abb <devpipe_read+0xeb>
+			return 0;
+  803ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803add:	eb de                	jmp    803abd <devpipe_read+0xed>
+
+00803adf <devpipe_write>:
+{
+  803adf:	55                   	push   %ebp
+  803ae0:	89 e5                	mov    %esp,%ebp
+  803ae2:	57                   	push   %edi
+  803ae3:	56                   	push   %esi
+  803ae4:	53                   	push   %ebx
+  803ae5:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803ae8:	ff 75 08             	push   0x8(%ebp)
+  803aeb:	e8 c4 e3 ff ff       	call   801eb4 <fd2data>
+  803af0:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803af2:	83 c4 10             	add    $0x10,%esp
+  803af5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803afc:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803b01:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b05:	0f 84 43 01 00 00    	je     803c4e <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b0b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b0e:	8b 06                	mov    (%esi),%eax
+  803b10:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b16:	29 c1                	sub    %eax,%ecx
+  803b18:	89 c8                	mov    %ecx,%eax
+  803b1a:	f7 e7                	mul    %edi
+  803b1c:	c1 ea 0c             	shr    $0xc,%edx
+  803b1f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b25:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803b27:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803b2d:	75 52                	jne    803b81 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803b2f:	89 f2                	mov    %esi,%edx
+  803b31:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b34:	e8 a7 fd ff ff       	call   8038e0 <_pipeisclosed>
+  803b39:	85 c0                	test   %eax,%eax
+  803b3b:	0f 85 28 01 00 00    	jne    803c69 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803b41:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b43:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b46:	8b 06                	mov    (%esi),%eax
+  803b48:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b4e:	29 c1                	sub    %eax,%ecx
+  803b50:	89 c8                	mov    %ecx,%eax
+  803b52:	f7 e7                	mul    %edi
+  803b54:	c1 ea 0c             	shr    $0xc,%edx
+  803b57:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b5d:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803b5f:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803b65:	75 a4                	jne    803b0b <devpipe_write+0x2c>
+  803b67:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b6c:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803b70:	83 ec 04             	sub    $0x4,%esp
+  803b73:	6a ff                	push   $0xffffffff
+  803b75:	53                   	push   %ebx
+  803b76:	56                   	push   %esi
+  803b77:	e8 0f d8 ff ff       	call   80138b <sys_futex_wait>
+}
+  803b7c:	83 c4 10             	add    $0x10,%esp
+  803b7f:	eb 8a                	jmp    803b0b <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b81:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b84:	8b 06                	mov    (%esi),%eax
+  803b86:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b8c:	29 c1                	sub    %eax,%ecx
+  803b8e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803b93:	f7 e1                	mul    %ecx
+  803b95:	c1 ea 0c             	shr    $0xc,%edx
+  803b98:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b9e:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803ba0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803ba5:	89 d8                	mov    %ebx,%eax
+  803ba7:	29 c8                	sub    %ecx,%eax
+  803ba9:	8b 55 10             	mov    0x10(%ebp),%edx
+  803bac:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803baf:	29 ca                	sub    %ecx,%edx
+  803bb1:	39 d0                	cmp    %edx,%eax
+  803bb3:	0f 46 d0             	cmovbe %eax,%edx
+  803bb6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803bb9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803bbc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803bc1:	f7 e1                	mul    %ecx
+  803bc3:	c1 ea 0b             	shr    $0xb,%edx
+  803bc6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803bcc:	89 ca                	mov    %ecx,%edx
+  803bce:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803bd0:	29 d3                	sub    %edx,%ebx
+  803bd2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803bd5:	39 c3                	cmp    %eax,%ebx
+  803bd7:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803bda:	83 ec 04             	sub    $0x4,%esp
+  803bdd:	53                   	push   %ebx
+  803bde:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803be1:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803be4:	51                   	push   %ecx
+  803be5:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803be9:	50                   	push   %eax
+  803bea:	e8 1a d1 ff ff       	call   800d09 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803bef:	83 c4 0c             	add    $0xc,%esp
+  803bf2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803bf5:	29 d8                	sub    %ebx,%eax
+  803bf7:	50                   	push   %eax
+  803bf8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803bfb:	01 cb                	add    %ecx,%ebx
+  803bfd:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803c00:	53                   	push   %ebx
+  803c01:	8d 46 10             	lea    0x10(%esi),%eax
+  803c04:	50                   	push   %eax
+  803c05:	e8 ff d0 ff ff       	call   800d09 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803c0a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803c0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803c10:	01 c1                	add    %eax,%ecx
+  803c12:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803c17:	f7 e1                	mul    %ecx
+  803c19:	c1 ea 0c             	shr    $0xc,%edx
+  803c1c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803c22:	89 ca                	mov    %ecx,%edx
+  803c24:	29 c2                	sub    %eax,%edx
+  803c26:	89 56 04             	mov    %edx,0x4(%esi)
+  803c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c2e:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803c32:	83 c4 10             	add    $0x10,%esp
+  803c35:	85 c0                	test   %eax,%eax
+  803c37:	75 1a                	jne    803c53 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803c39:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803c3c:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803c3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803c42:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803c45:	0f 82 c0 fe ff ff    	jb     803b0b <devpipe_write+0x2c>
+  803c4b:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803c4e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803c51:	eb 1b                	jmp    803c6e <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803c53:	83 ec 08             	sub    $0x8,%esp
+  803c56:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803c5b:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803c5e:	50                   	push   %eax
+  803c5f:	e8 49 d7 ff ff       	call   8013ad <sys_futex_wake>
+  803c64:	83 c4 10             	add    $0x10,%esp
+  803c67:	eb d0                	jmp    803c39 <devpipe_write+0x15a>
+				return 0;
+  803c69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c71:	5b                   	pop    %ebx
+  803c72:	5e                   	pop    %esi
+  803c73:	5f                   	pop    %edi
+  803c74:	5d                   	pop    %ebp
+  803c75:	c3                   	ret
+
+00803c76 <devpipe_stat>:
+{
+  803c76:	55                   	push   %ebp
+  803c77:	89 e5                	mov    %esp,%ebp
+  803c79:	56                   	push   %esi
+  803c7a:	53                   	push   %ebx
+  803c7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803c7e:	83 ec 0c             	sub    $0xc,%esp
+  803c81:	ff 75 08             	push   0x8(%ebp)
+  803c84:	e8 2b e2 ff ff       	call   801eb4 <fd2data>
+  803c89:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803c8b:	83 c4 08             	add    $0x8,%esp
+  803c8e:	68 12 4d 80 00       	push   $0x804d12
+  803c93:	53                   	push   %ebx
+  803c94:	e8 c0 ce ff ff       	call   800b59 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803c99:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803c9c:	8b 06                	mov    (%esi),%eax
+  803c9e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803ca4:	29 c1                	sub    %eax,%ecx
+  803ca6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803cab:	89 c8                	mov    %ecx,%eax
+  803cad:	f7 e2                	mul    %edx
+  803caf:	c1 ea 0c             	shr    $0xc,%edx
+  803cb2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803cb8:	29 d1                	sub    %edx,%ecx
+  803cba:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803cc0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803cc7:	00 00 00 
+	stat->st_dev = &devpipe;
+  803cca:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803cd1:	50 80 00 
+}
+  803cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cdc:	5b                   	pop    %ebx
+  803cdd:	5e                   	pop    %esi
+  803cde:	5d                   	pop    %ebp
+  803cdf:	c3                   	ret
+
+00803ce0 <devpipe_poll>:
+{
+  803ce0:	55                   	push   %ebp
+  803ce1:	89 e5                	mov    %esp,%ebp
+  803ce3:	57                   	push   %edi
+  803ce4:	56                   	push   %esi
+  803ce5:	53                   	push   %ebx
+  803ce6:	83 ec 18             	sub    $0x18,%esp
+  803ce9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803cec:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803cef:	57                   	push   %edi
+  803cf0:	e8 bf e1 ff ff       	call   801eb4 <fd2data>
+  803cf5:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803cf7:	83 c4 10             	add    $0x10,%esp
+  803cfa:	89 f3                	mov    %esi,%ebx
+  803cfc:	83 e3 01             	and    $0x1,%ebx
+  803cff:	75 27                	jne    803d28 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803d01:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803d07:	75 48                	jne    803d51 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803d09:	89 ca                	mov    %ecx,%edx
+  803d0b:	89 f8                	mov    %edi,%eax
+  803d0d:	e8 ce fb ff ff       	call   8038e0 <_pipeisclosed>
+  803d12:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803d14:	89 d8                	mov    %ebx,%eax
+  803d16:	83 c8 10             	or     $0x10,%eax
+  803d19:	85 d2                	test   %edx,%edx
+  803d1b:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803d1e:	89 d8                	mov    %ebx,%eax
+  803d20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d23:	5b                   	pop    %ebx
+  803d24:	5e                   	pop    %esi
+  803d25:	5f                   	pop    %edi
+  803d26:	5d                   	pop    %ebp
+  803d27:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803d28:	8b 58 04             	mov    0x4(%eax),%ebx
+  803d2b:	8b 00                	mov    (%eax),%eax
+  803d2d:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803d33:	29 c3                	sub    %eax,%ebx
+  803d35:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803d3a:	89 d8                	mov    %ebx,%eax
+  803d3c:	f7 e2                	mul    %edx
+  803d3e:	c1 ea 0c             	shr    $0xc,%edx
+  803d41:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803d47:	39 d3                	cmp    %edx,%ebx
+  803d49:	0f 95 c3             	setne  %bl
+  803d4c:	0f b6 db             	movzbl %bl,%ebx
+  803d4f:	eb b0                	jmp    803d01 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803d51:	8b 71 04             	mov    0x4(%ecx),%esi
+  803d54:	8b 01                	mov    (%ecx),%eax
+  803d56:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803d5c:	29 c6                	sub    %eax,%esi
+  803d5e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803d63:	89 f0                	mov    %esi,%eax
+  803d65:	f7 e2                	mul    %edx
+  803d67:	c1 ea 0c             	shr    $0xc,%edx
+  803d6a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803d70:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803d72:	89 d8                	mov    %ebx,%eax
+  803d74:	83 c8 04             	or     $0x4,%eax
+  803d77:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803d7d:	0f 42 d8             	cmovb  %eax,%ebx
+  803d80:	eb 87                	jmp    803d09 <devpipe_poll+0x29>
+
+00803d82 <pipe>:
+{
+  803d82:	55                   	push   %ebp
+  803d83:	89 e5                	mov    %esp,%ebp
+  803d85:	56                   	push   %esi
+  803d86:	53                   	push   %ebx
+  803d87:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803d8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d8d:	50                   	push   %eax
+  803d8e:	e8 38 e1 ff ff       	call   801ecb <fd_alloc>
+  803d93:	89 c3                	mov    %eax,%ebx
+  803d95:	83 c4 10             	add    $0x10,%esp
+  803d98:	85 c0                	test   %eax,%eax
+  803d9a:	0f 88 23 01 00 00    	js     803ec3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803da0:	83 ec 04             	sub    $0x4,%esp
+  803da3:	68 07 04 00 00       	push   $0x407
+  803da8:	ff 75 f4             	push   -0xc(%ebp)
+  803dab:	6a 00                	push   $0x0
+  803dad:	e8 db d1 ff ff       	call   800f8d <sys_page_alloc>
+  803db2:	89 c3                	mov    %eax,%ebx
+  803db4:	83 c4 10             	add    $0x10,%esp
+  803db7:	85 c0                	test   %eax,%eax
+  803db9:	0f 88 04 01 00 00    	js     803ec3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803dbf:	83 ec 0c             	sub    $0xc,%esp
+  803dc2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803dc5:	50                   	push   %eax
+  803dc6:	e8 00 e1 ff ff       	call   801ecb <fd_alloc>
+  803dcb:	89 c3                	mov    %eax,%ebx
+  803dcd:	83 c4 10             	add    $0x10,%esp
+  803dd0:	85 c0                	test   %eax,%eax
+  803dd2:	0f 88 db 00 00 00    	js     803eb3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803dd8:	83 ec 04             	sub    $0x4,%esp
+  803ddb:	68 07 04 00 00       	push   $0x407
+  803de0:	ff 75 f0             	push   -0x10(%ebp)
+  803de3:	6a 00                	push   $0x0
+  803de5:	e8 a3 d1 ff ff       	call   800f8d <sys_page_alloc>
+  803dea:	89 c3                	mov    %eax,%ebx
+  803dec:	83 c4 10             	add    $0x10,%esp
+  803def:	85 c0                	test   %eax,%eax
+  803df1:	0f 88 bc 00 00 00    	js     803eb3 <pipe+0x131>
+	va = fd2data(fd0);
+  803df7:	83 ec 0c             	sub    $0xc,%esp
+  803dfa:	ff 75 f4             	push   -0xc(%ebp)
+  803dfd:	e8 b2 e0 ff ff       	call   801eb4 <fd2data>
+  803e02:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803e04:	83 c4 0c             	add    $0xc,%esp
+  803e07:	68 07 04 00 00       	push   $0x407
+  803e0c:	50                   	push   %eax
+  803e0d:	6a 00                	push   $0x0
+  803e0f:	e8 79 d1 ff ff       	call   800f8d <sys_page_alloc>
+  803e14:	89 c3                	mov    %eax,%ebx
+  803e16:	83 c4 10             	add    $0x10,%esp
+  803e19:	85 c0                	test   %eax,%eax
+  803e1b:	0f 88 82 00 00 00    	js     803ea3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803e21:	83 ec 0c             	sub    $0xc,%esp
+  803e24:	ff 75 f0             	push   -0x10(%ebp)
+  803e27:	e8 88 e0 ff ff       	call   801eb4 <fd2data>
+  803e2c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803e33:	50                   	push   %eax
+  803e34:	6a 00                	push   $0x0
+  803e36:	56                   	push   %esi
+  803e37:	6a 00                	push   $0x0
+  803e39:	e8 92 d1 ff ff       	call   800fd0 <sys_page_map>
+  803e3e:	89 c3                	mov    %eax,%ebx
+  803e40:	83 c4 20             	add    $0x20,%esp
+  803e43:	85 c0                	test   %eax,%eax
+  803e45:	78 4e                	js     803e95 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803e47:	a1 60 50 80 00       	mov    0x805060,%eax
+  803e4c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803e4f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803e51:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803e54:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803e5b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803e5e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803e60:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803e63:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803e6a:	83 ec 0c             	sub    $0xc,%esp
+  803e6d:	ff 75 f4             	push   -0xc(%ebp)
+  803e70:	e8 2f e0 ff ff       	call   801ea4 <fd2num>
+  803e75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803e78:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803e7a:	83 c4 04             	add    $0x4,%esp
+  803e7d:	ff 75 f0             	push   -0x10(%ebp)
+  803e80:	e8 1f e0 ff ff       	call   801ea4 <fd2num>
+  803e85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803e88:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803e8b:	83 c4 10             	add    $0x10,%esp
+  803e8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e93:	eb 2e                	jmp    803ec3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803e95:	83 ec 08             	sub    $0x8,%esp
+  803e98:	56                   	push   %esi
+  803e99:	6a 00                	push   $0x0
+  803e9b:	e8 72 d1 ff ff       	call   801012 <sys_page_unmap>
+  803ea0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803ea3:	83 ec 08             	sub    $0x8,%esp
+  803ea6:	ff 75 f0             	push   -0x10(%ebp)
+  803ea9:	6a 00                	push   $0x0
+  803eab:	e8 62 d1 ff ff       	call   801012 <sys_page_unmap>
+  803eb0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803eb3:	83 ec 08             	sub    $0x8,%esp
+  803eb6:	ff 75 f4             	push   -0xc(%ebp)
+  803eb9:	6a 00                	push   $0x0
+  803ebb:	e8 52 d1 ff ff       	call   801012 <sys_page_unmap>
+  803ec0:	83 c4 10             	add    $0x10,%esp
+}
+  803ec3:	89 d8                	mov    %ebx,%eax
+  803ec5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ec8:	5b                   	pop    %ebx
+  803ec9:	5e                   	pop    %esi
+  803eca:	5d                   	pop    %ebp
+  803ecb:	c3                   	ret
+
+00803ecc <pipeisclosed>:
+{
+  803ecc:	55                   	push   %ebp
+  803ecd:	89 e5                	mov    %esp,%ebp
+  803ecf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ed2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ed5:	50                   	push   %eax
+  803ed6:	ff 75 08             	push   0x8(%ebp)
+  803ed9:	e8 3d e0 ff ff       	call   801f1b <fd_lookup>
+  803ede:	83 c4 10             	add    $0x10,%esp
+  803ee1:	85 c0                	test   %eax,%eax
+  803ee3:	78 18                	js     803efd <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803ee5:	83 ec 0c             	sub    $0xc,%esp
+  803ee8:	ff 75 f4             	push   -0xc(%ebp)
+  803eeb:	e8 c4 df ff ff       	call   801eb4 <fd2data>
+  803ef0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803ef2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ef5:	e8 e6 f9 ff ff       	call   8038e0 <_pipeisclosed>
+  803efa:	83 c4 10             	add    $0x10,%esp
+}
+  803efd:	c9                   	leave
+  803efe:	c3                   	ret
+
+00803eff <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803eff:	55                   	push   %ebp
+  803f00:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803f02:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f05:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803f0b:	5d                   	pop    %ebp
+  803f0c:	c3                   	ret
+
+00803f0d <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803f0d:	55                   	push   %ebp
+  803f0e:	89 e5                	mov    %esp,%ebp
+  803f10:	53                   	push   %ebx
+  803f11:	83 ec 04             	sub    $0x4,%esp
+  803f14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803f17:	8b 03                	mov    (%ebx),%eax
+  803f19:	85 c0                	test   %eax,%eax
+  803f1b:	75 05                	jne    803f22 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803f1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f20:	c9                   	leave
+  803f21:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803f22:	83 ec 08             	sub    $0x8,%esp
+  803f25:	50                   	push   %eax
+  803f26:	8d 43 04             	lea    0x4(%ebx),%eax
+  803f29:	50                   	push   %eax
+  803f2a:	e8 33 d3 ff ff       	call   801262 <sys_page_batch>
+	pb->pb_n = 0;
+  803f2f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803f35:	83 c4 10             	add    $0x10,%esp
+  803f38:	eb e3                	jmp    803f1d <pgbatch_flush+0x10>
+
+00803f3a <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803f3a:	55                   	push   %ebp
+  803f3b:	89 e5                	mov    %esp,%ebp
+  803f3d:	56                   	push   %esi
+  803f3e:	53                   	push   %ebx
+  803f3f:	89 c3                	mov    %eax,%ebx
+  803f41:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803f43:	83 38 20             	cmpl   $0x20,(%eax)
+  803f46:	74 2c                	je     803f74 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803f48:	8b 03                	mov    (%ebx),%eax
+  803f4a:	8d 50 01             	lea    0x1(%eax),%edx
+  803f4d:	89 13                	mov    %edx,(%ebx)
+  803f4f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803f52:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803f56:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803f58:	83 ec 04             	sub    $0x4,%esp
+  803f5b:	6a 18                	push   $0x18
+  803f5d:	6a 00                	push   $0x0
+  803f5f:	50                   	push   %eax
+  803f60:	e8 6f cd ff ff       	call   800cd4 <memset>
+	return 0;
+  803f65:	83 c4 10             	add    $0x10,%esp
+  803f68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f70:	5b                   	pop    %ebx
+  803f71:	5e                   	pop    %esi
+  803f72:	5d                   	pop    %ebp
+  803f73:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803f74:	83 ec 0c             	sub    $0xc,%esp
+  803f77:	50                   	push   %eax
+  803f78:	e8 90 ff ff ff       	call   803f0d <pgbatch_flush>
+  803f7d:	83 c4 10             	add    $0x10,%esp
+  803f80:	85 c0                	test   %eax,%eax
+  803f82:	79 c4                	jns    803f48 <pgbatch_slot+0xe>
+  803f84:	eb e7                	jmp    803f6d <pgbatch_slot+0x33>
+
+00803f86 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803f86:	55                   	push   %ebp
+  803f87:	89 e5                	mov    %esp,%ebp
+  803f89:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f8c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f92:	e8 a3 ff ff ff       	call   803f3a <pgbatch_slot>
+  803f97:	85 c0                	test   %eax,%eax
+  803f99:	78 20                	js     803fbb <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803f9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f9e:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803fa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fa7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803faa:	8b 55 10             	mov    0x10(%ebp),%edx
+  803fad:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803fb0:	8b 55 14             	mov    0x14(%ebp),%edx
+  803fb3:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fbb:	c9                   	leave
+  803fbc:	c3                   	ret
+
+00803fbd <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803fbd:	55                   	push   %ebp
+  803fbe:	89 e5                	mov    %esp,%ebp
+  803fc0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803fc3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803fc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fc9:	e8 6c ff ff ff       	call   803f3a <pgbatch_slot>
+  803fce:	85 c0                	test   %eax,%eax
+  803fd0:	78 2c                	js     803ffe <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803fd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fd5:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803fdb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fde:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803fe1:	8b 55 10             	mov    0x10(%ebp),%edx
+  803fe4:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803fe7:	8b 55 14             	mov    0x14(%ebp),%edx
+  803fea:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803fed:	8b 55 18             	mov    0x18(%ebp),%edx
+  803ff0:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ff3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803ff6:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ffe:	c9                   	leave
+  803fff:	c3                   	ret
+
+00804000 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  804000:	55                   	push   %ebp
+  804001:	89 e5                	mov    %esp,%ebp
+  804003:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804006:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804009:	8b 45 08             	mov    0x8(%ebp),%eax
+  80400c:	e8 29 ff ff ff       	call   803f3a <pgbatch_slot>
+  804011:	85 c0                	test   %eax,%eax
+  804013:	78 1a                	js     80402f <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  804015:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804018:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80401e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804021:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804024:	8b 55 10             	mov    0x10(%ebp),%edx
+  804027:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80402a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80402f:	c9                   	leave
+  804030:	c3                   	ret
+
+00804031 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  804031:	55                   	push   %ebp
+  804032:	89 e5                	mov    %esp,%ebp
+  804034:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804037:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80403a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80403d:	e8 f8 fe ff ff       	call   803f3a <pgbatch_slot>
+  804042:	85 c0                	test   %eax,%eax
+  804044:	78 20                	js     804066 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  804046:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804049:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80404f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804052:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804055:	8b 55 10             	mov    0x10(%ebp),%edx
+  804058:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80405b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80405e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804061:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804066:	c9                   	leave
+  804067:	c3                   	ret
+
+00804068 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  804068:	55                   	push   %ebp
+  804069:	89 e5                	mov    %esp,%ebp
+  80406b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80406e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804071:	8b 45 08             	mov    0x8(%ebp),%eax
+  804074:	e8 c1 fe ff ff       	call   803f3a <pgbatch_slot>
+  804079:	85 c0                	test   %eax,%eax
+  80407b:	78 26                	js     8040a3 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80407d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804080:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  804086:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804089:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  80408c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80408f:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  804092:	8b 55 14             	mov    0x14(%ebp),%edx
+  804095:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  804098:	8b 55 18             	mov    0x18(%ebp),%edx
+  80409b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80409e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040a3:	c9                   	leave
+  8040a4:	c3                   	ret
+
+008040a5 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  8040a5:	55                   	push   %ebp
+  8040a6:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8040a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8040b1:	5d                   	pop    %ebp
+  8040b2:	c3                   	ret
+
+008040b3 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  8040b3:	55                   	push   %ebp
+  8040b4:	89 e5                	mov    %esp,%ebp
+  8040b6:	56                   	push   %esi
+  8040b7:	53                   	push   %ebx
+  8040b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  8040bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040c5:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8040c9:	85 c0                	test   %eax,%eax
+  8040cb:	74 2f                	je     8040fc <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  8040cd:	83 f8 02             	cmp    $0x2,%eax
+  8040d0:	74 0c                	je     8040de <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  8040d2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8040d7:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  8040da:	85 c0                	test   %eax,%eax
+  8040dc:	74 1e                	je     8040fc <mutex_lock+0x49>
+  8040de:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  8040e3:	83 ec 04             	sub    $0x4,%esp
+  8040e6:	6a ff                	push   $0xffffffff
+  8040e8:	6a 02                	push   $0x2
+  8040ea:	53                   	push   %ebx
+  8040eb:	e8 9b d2 ff ff       	call   80138b <sys_futex_wait>
+  8040f0:	89 f0                	mov    %esi,%eax
+  8040f2:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  8040f5:	83 c4 10             	add    $0x10,%esp
+  8040f8:	85 c0                	test   %eax,%eax
+  8040fa:	75 e7                	jne    8040e3 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8040fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040ff:	5b                   	pop    %ebx
+  804100:	5e                   	pop    %esi
+  804101:	5d                   	pop    %ebp
+  804102:	c3                   	ret
+
+00804103 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  804103:	55                   	push   %ebp
+  804104:	89 e5                	mov    %esp,%ebp
+  804106:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804113:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  804117:	85 c0                	test   %eax,%eax
+  804119:	0f 94 c0             	sete   %al
+  80411c:	0f b6 c0             	movzbl %al,%eax
+}
+  80411f:	5d                   	pop    %ebp
+  804120:	c3                   	ret
+
+00804121 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804121:	55                   	push   %ebp
+  804122:	89 e5                	mov    %esp,%ebp
+  804124:	83 ec 08             	sub    $0x8,%esp
+  804127:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  80412a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80412f:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  804132:	83 f8 02             	cmp    $0x2,%eax
+  804135:	74 02                	je     804139 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804137:	c9                   	leave
+  804138:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804139:	83 ec 08             	sub    $0x8,%esp
+  80413c:	6a 01                	push   $0x1
+  80413e:	52                   	push   %edx
+  80413f:	e8 69 d2 ff ff       	call   8013ad <sys_futex_wake>
+  804144:	83 c4 10             	add    $0x10,%esp
+}
+  804147:	eb ee                	jmp    804137 <mutex_unlock+0x16>
+
+00804149 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  804149:	55                   	push   %ebp
+  80414a:	89 e5                	mov    %esp,%ebp
+  80414c:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  80414f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  804155:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  80415c:	5d                   	pop    %ebp
+  80415d:	c3                   	ret
+
+0080415e <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80415e:	55                   	push   %ebp
+  80415f:	89 e5                	mov    %esp,%ebp
+  804161:	57                   	push   %edi
+  804162:	56                   	push   %esi
+  804163:	53                   	push   %ebx
+  804164:	83 ec 18             	sub    $0x18,%esp
+  804167:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80416a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  80416d:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  80416f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804174:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804179:	57                   	push   %edi
+  80417a:	e8 a2 ff ff ff       	call   804121 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80417f:	83 c4 0c             	add    $0xc,%esp
+  804182:	ff 75 10             	push   0x10(%ebp)
+  804185:	56                   	push   %esi
+  804186:	53                   	push   %ebx
+  804187:	e8 ff d1 ff ff       	call   80138b <sys_futex_wait>
+  80418c:	89 c6                	mov    %eax,%esi
+  80418e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804193:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804198:	89 3c 24             	mov    %edi,(%esp)
+  80419b:	e8 13 ff ff ff       	call   8040b3 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  8041a0:	83 c4 10             	add    $0x10,%esp
+  8041a3:	83 fe ef             	cmp    $0xffffffef,%esi
+  8041a6:	74 05                	je     8041ad <cond_timedwait+0x4f>
+  8041a8:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8041ad:	89 f0                	mov    %esi,%eax
+  8041af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041b2:	5b                   	pop    %ebx
+  8041b3:	5e                   	pop    %esi
+  8041b4:	5f                   	pop    %edi
+  8041b5:	5d                   	pop    %ebp
+  8041b6:	c3                   	ret
+
+008041b7 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8041b7:	55                   	push   %ebp
+  8041b8:	89 e5                	mov    %esp,%ebp
+  8041ba:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  8041bd:	6a ff                	push   $0xffffffff
+  8041bf:	ff 75 0c             	push   0xc(%ebp)
+  8041c2:	ff 75 08             	push   0x8(%ebp)
+  8041c5:	e8 94 ff ff ff       	call   80415e <cond_timedwait>
+}
+  8041ca:	83 c4 10             	add    $0x10,%esp
+  8041cd:	c9                   	leave
+  8041ce:	c3                   	ret
+
+008041cf <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8041cf:	55                   	push   %ebp
+  8041d0:	89 e5                	mov    %esp,%ebp
+  8041d2:	83 ec 08             	sub    $0x8,%esp
+  8041d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041d8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041dd:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8041e1:	8b 50 04             	mov    0x4(%eax),%edx
+  8041e4:	85 d2                	test   %edx,%edx
+  8041e6:	75 02                	jne    8041ea <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  8041e8:	c9                   	leave
+  8041e9:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  8041ea:	83 ec 08             	sub    $0x8,%esp
+  8041ed:	6a 01                	push   $0x1
+  8041ef:	50                   	push   %eax
+  8041f0:	e8 b8 d1 ff ff       	call   8013ad <sys_futex_wake>
+  8041f5:	83 c4 10             	add    $0x10,%esp
+}
+  8041f8:	eb ee                	jmp    8041e8 <cond_signal+0x19>
+
+008041fa <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8041fa:	55                   	push   %ebp
+  8041fb:	89 e5                	mov    %esp,%ebp
+  8041fd:	83 ec 08             	sub    $0x8,%esp
+  804200:	8b 45 08             	mov    0x8(%ebp),%eax
+  804203:	ba 01 00 00 00       	mov    $0x1,%edx
+  804208:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  80420c:	8b 50 04             	mov    0x4(%eax),%edx
+  80420f:	85 d2                	test   %edx,%edx
+  804211:	75 02                	jne    804215 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  804213:	c9                   	leave
+  804214:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  804215:	83 ec 08             	sub    $0x8,%esp
+  804218:	68 00 04 00 00       	push   $0x400
+  80421d:	50                   	push   %eax
+  80421e:	e8 8a d1 ff ff       	call   8013ad <sys_futex_wake>
+  804223:	83 c4 10             	add    $0x10,%esp
+}
+  804226:	eb eb                	jmp    804213 <cond_broadcast+0x19>
+
+00804228 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422d:	c3                   	ret
+
+0080422e <devcons_poll>:
+{
+  80422e:	55                   	push   %ebp
+  80422f:	89 e5                	mov    %esp,%ebp
+  804231:	53                   	push   %ebx
+  804232:	83 ec 04             	sub    $0x4,%esp
+  804235:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804238:	89 da                	mov    %ebx,%edx
+  80423a:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80423d:	83 3d 14 6a 80 00 00 	cmpl   $0x0,0x806a14
+  804244:	74 0c                	je     804252 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804246:	89 d8                	mov    %ebx,%eax
+  804248:	83 e0 01             	and    $0x1,%eax
+  80424b:	09 d0                	or     %edx,%eax
+}
+  80424d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804250:	c9                   	leave
+  804251:	c3                   	ret
+		cons_peek = sys_cgetc();
+  804252:	e8 98 cc ff ff       	call   800eef <sys_cgetc>
+  804257:	a3 14 6a 80 00       	mov    %eax,0x806a14
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80425c:	89 da                	mov    %ebx,%edx
+  80425e:	83 e2 04             	and    $0x4,%edx
+  804261:	85 c0                	test   %eax,%eax
+  804263:	74 e6                	je     80424b <devcons_poll+0x1d>
+  804265:	eb df                	jmp    804246 <devcons_poll+0x18>
+
+00804267 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804267:	55                   	push   %ebp
+  804268:	89 e5                	mov    %esp,%ebp
+  80426a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80426d:	68 1e 4d 80 00       	push   $0x804d1e
+  804272:	ff 75 0c             	push   0xc(%ebp)
+  804275:	e8 df c8 ff ff       	call   800b59 <strcpy>
+	return 0;
+}
+  80427a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427f:	c9                   	leave
+  804280:	c3                   	ret
+
+00804281 <devcons_write>:
+{
+  804281:	55                   	push   %ebp
+  804282:	89 e5                	mov    %esp,%ebp
+  804284:	57                   	push   %edi
+  804285:	56                   	push   %esi
+  804286:	53                   	push   %ebx
+  804287:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80428d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804290:	85 ff                	test   %edi,%edi
+  804292:	74 51                	je     8042e5 <devcons_write+0x64>
+  804294:	be 00 00 00 00       	mov    $0x0,%esi
+  804299:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80429e:	89 fb                	mov    %edi,%ebx
+  8042a0:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8042a2:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8042a7:	39 d3                	cmp    %edx,%ebx
+  8042a9:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8042ac:	83 ec 04             	sub    $0x4,%esp
+  8042af:	53                   	push   %ebx
+  8042b0:	03 45 0c             	add    0xc(%ebp),%eax
+  8042b3:	50                   	push   %eax
+  8042b4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8042ba:	50                   	push   %eax
+  8042bb:	e8 49 ca ff ff       	call   800d09 <memmove>
+		sys_cputs(buf, m);
+  8042c0:	83 c4 08             	add    $0x8,%esp
+  8042c3:	53                   	push   %ebx
+  8042c4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8042ca:	50                   	push   %eax
+  8042cb:	e8 01 cc ff ff       	call   800ed1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8042d0:	01 de                	add    %ebx,%esi
+  8042d2:	89 f0                	mov    %esi,%eax
+  8042d4:	83 c4 10             	add    $0x10,%esp
+  8042d7:	39 fe                	cmp    %edi,%esi
+  8042d9:	72 c3                	jb     80429e <devcons_write+0x1d>
+}
+  8042db:	89 f0                	mov    %esi,%eax
+  8042dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042e0:	5b                   	pop    %ebx
+  8042e1:	5e                   	pop    %esi
+  8042e2:	5f                   	pop    %edi
+  8042e3:	5d                   	pop    %ebp
+  8042e4:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8042e5:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8042ea:	eb ef                	jmp    8042db <devcons_write+0x5a>
+
+008042ec <devcons_read>:
+{
+  8042ec:	55                   	push   %ebp
+  8042ed:	89 e5                	mov    %esp,%ebp
+  8042ef:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8042f2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8042f7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8042fb:	74 36                	je     804333 <devcons_read+0x47>
+	c = cons_peek;
+  8042fd:	a1 14 6a 80 00       	mov    0x806a14,%eax
+	cons_peek = 0;
+  804302:	c7 05 14 6a 80 00 00 	movl   $0x0,0x806a14
+  804309:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80430c:	85 c0                	test   %eax,%eax
+  80430e:	75 10                	jne    804320 <devcons_read+0x34>
+  804310:	e8 da cb ff ff       	call   800eef <sys_cgetc>
+  804315:	85 c0                	test   %eax,%eax
+  804317:	75 07                	jne    804320 <devcons_read+0x34>
+		sys_yield();
+  804319:	e8 50 cc ff ff       	call   800f6e <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80431e:	eb f0                	jmp    804310 <devcons_read+0x24>
+	if (c < 0)
+  804320:	85 c0                	test   %eax,%eax
+  804322:	78 0f                	js     804333 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  804324:	83 f8 04             	cmp    $0x4,%eax
+  804327:	74 0c                	je     804335 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  804329:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80432c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80432e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804333:	c9                   	leave
+  804334:	c3                   	ret
+		return 0;
+  804335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433a:	eb f7                	jmp    804333 <devcons_read+0x47>
+
+0080433c <cputchar>:
+{
+  80433c:	55                   	push   %ebp
+  80433d:	89 e5                	mov    %esp,%ebp
+  80433f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804342:	8b 45 08             	mov    0x8(%ebp),%eax
+  804345:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804348:	6a 01                	push   $0x1
+  80434a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80434d:	50                   	push   %eax
+  80434e:	e8 7e cb ff ff       	call   800ed1 <sys_cputs>
+}
+  804353:	83 c4 10             	add    $0x10,%esp
+  804356:	c9                   	leave
+  804357:	c3                   	ret
+
+00804358 <getchar>:
+{
+  804358:	55                   	push   %ebp
+  804359:	89 e5                	mov    %esp,%ebp
+  80435b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80435e:	6a 01                	push   $0x1
+  804360:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804363:	50                   	push   %eax
+  804364:	6a 00                	push   $0x0
+  804366:	e8 34 de ff ff       	call   80219f <read>
+	if (r < 0)
+  80436b:	83 c4 10             	add    $0x10,%esp
+  80436e:	85 c0                	test   %eax,%eax
+  804370:	78 06                	js     804378 <getchar+0x20>
+	if (r < 1)
+  804372:	74 06                	je     80437a <getchar+0x22>
+	return c;
+  804374:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804378:	c9                   	leave
+  804379:	c3                   	ret
+		return -E_EOF;
+  80437a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80437f:	eb f7                	jmp    804378 <getchar+0x20>
+
+00804381 <iscons>:
+{
+  804381:	55                   	push   %ebp
+  804382:	89 e5                	mov    %esp,%ebp
+  804384:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804387:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80438a:	50                   	push   %eax
+  80438b:	ff 75 08             	push   0x8(%ebp)
+  80438e:	e8 88 db ff ff       	call   801f1b <fd_lookup>
+  804393:	83 c4 10             	add    $0x10,%esp
+  804396:	85 c0                	test   %eax,%eax
+  804398:	78 11                	js     8043ab <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80439a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80439d:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8043a3:	39 10                	cmp    %edx,(%eax)
+  8043a5:	0f 94 c0             	sete   %al
+  8043a8:	0f b6 c0             	movzbl %al,%eax
+}
+  8043ab:	c9                   	leave
+  8043ac:	c3                   	ret
+
+008043ad <opencons>:
+{
+  8043ad:	55                   	push   %ebp
+  8043ae:	89 e5                	mov    %esp,%ebp
+  8043b0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8043b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043b6:	50                   	push   %eax
+  8043b7:	e8 0f db ff ff       	call   801ecb <fd_alloc>
+  8043bc:	83 c4 10             	add    $0x10,%esp
+  8043bf:	85 c0                	test   %eax,%eax
+  8043c1:	78 3a                	js     8043fd <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8043c3:	83 ec 04             	sub    $0x4,%esp
+  8043c6:	68 07 04 00 00       	push   $0x407
+  8043cb:	ff 75 f4             	push   -0xc(%ebp)
+  8043ce:	6a 00                	push   $0x0
+  8043d0:	e8 b8 cb ff ff       	call   800f8d <sys_page_alloc>
+  8043d5:	83 c4 10             	add    $0x10,%esp
+  8043d8:	85 c0                	test   %eax,%eax
+  8043da:	78 21                	js     8043fd <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8043dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043df:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8043e5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8043e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043ea:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8043f1:	83 ec 0c             	sub    $0xc,%esp
+  8043f4:	50                   	push   %eax
+  8043f5:	e8 aa da ff ff       	call   801ea4 <fd2num>
+  8043fa:	83 c4 10             	add    $0x10,%esp
+}
+  8043fd:	c9                   	leave
+  8043fe:	c3                   	ret
+
+008043ff <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8043ff:	55                   	push   %ebp
+  804400:	89 e5                	mov    %esp,%ebp
+  804402:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804405:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80440c:	74 0a                	je     804418 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80440e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804411:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804416:	c9                   	leave
+  804417:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804418:	83 ec 04             	sub    $0x4,%esp
+  80441b:	6a 07                	push   $0x7
+  80441d:	68 00 f0 bf ee       	push   $0xeebff000
+  804422:	6a 00                	push   $0x0
+  804424:	e8 64 cb ff ff       	call   800f8d <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804429:	83 c4 08             	add    $0x8,%esp
+  80442c:	68 3d 44 80 00       	push   $0x80443d
+  804431:	6a 00                	push   $0x0
+  804433:	e8 a0 cc ff ff       	call   8010d8 <sys_env_set_pgfault_upcall>
+  804438:	83 c4 10             	add    $0x10,%esp
+  80443b:	eb d1                	jmp    80440e <set_pgfault_handler+0xf>
+
+0080443d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80443d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80443e:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804443:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804445:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804448:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  80444c:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80444f:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804453:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804455:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804459:	83 c4 08             	add    $0x8,%esp
+	popal;
+  80445c:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80445d:	83 c4 04             	add    $0x4,%esp
+	popf
+  804460:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804461:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804462:	c3                   	ret
+
+00804463 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804463:	55                   	push   %ebp
+  804464:	89 e5                	mov    %esp,%ebp
+  804466:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804469:	89 c2                	mov    %eax,%edx
+  80446b:	c1 ea 16             	shr    $0x16,%edx
+  80446e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804475:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80447a:	f6 c1 01             	test   $0x1,%cl
+  80447d:	74 1e                	je     80449d <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80447f:	c1 e8 0c             	shr    $0xc,%eax
+  804482:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804489:	a8 01                	test   $0x1,%al
+  80448b:	74 10                	je     80449d <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80448d:	c1 e8 0c             	shr    $0xc,%eax
+  804490:	c1 e0 04             	shl    $0x4,%eax
+  804493:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80449a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80449d:	89 d0                	mov    %edx,%eax
+  80449f:	5d                   	pop    %ebp
+  8044a0:	c3                   	ret
+
+008044a1 <__udivdi3>:
+  8044a1:	57                   	push   %edi
+  8044a2:	56                   	push   %esi
+  8044a3:	53                   	push   %ebx
+  8044a4:	83 ec 20             	sub    $0x20,%esp
+  8044a7:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044ab:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8044af:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044b3:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044b7:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8044bb:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8044bf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044c3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044c7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044d6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044dd:	00 
+  8044de:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044e5:	00 
+  8044e6:	eb 08                	jmp    8044f0 <__udivdi3+0x4f>
+  8044e8:	83 e9 01             	sub    $0x1,%ecx
+  8044eb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044ee:	74 68                	je     804558 <__udivdi3+0xb7>
+  8044f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044f4:	01 c0                	add    %eax,%eax
+  8044f6:	89 c6                	mov    %eax,%esi
+  8044f8:	89 d7                	mov    %edx,%edi
+  8044fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8044fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804502:	0f ad d0             	shrd   %cl,%edx,%eax
+  804505:	d3 ea                	shr    %cl,%edx
+  804507:	f6 c1 20             	test   $0x20,%cl
+  80450a:	74 04                	je     804510 <__udivdi3+0x6f>
+  80450c:	89 d0                	mov    %edx,%eax
+  80450e:	31 d2                	xor    %edx,%edx
+  804510:	83 e0 01             	and    $0x1,%eax
+  804513:	89 04 24             	mov    %eax,(%esp)
+  804516:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80451d:	00 
+  80451e:	8b 04 24             	mov    (%esp),%eax
+  804521:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804525:	09 f0                	or     %esi,%eax
+  804527:	09 fa                	or     %edi,%edx
+  804529:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80452d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804531:	39 f0                	cmp    %esi,%eax
+  804533:	89 d3                	mov    %edx,%ebx
+  804535:	19 fb                	sbb    %edi,%ebx
+  804537:	72 af                	jb     8044e8 <__udivdi3+0x47>
+  804539:	29 f0                	sub    %esi,%eax
+  80453b:	19 fa                	sbb    %edi,%edx
+  80453d:	89 cf                	mov    %ecx,%edi
+  80453f:	c1 ef 05             	shr    $0x5,%edi
+  804542:	83 e7 01             	and    $0x1,%edi
+  804545:	89 fe                	mov    %edi,%esi
+  804547:	83 f6 01             	xor    $0x1,%esi
+  80454a:	d3 e6                	shl    %cl,%esi
+  80454c:	d3 e7                	shl    %cl,%edi
+  80454e:	09 74 24 18          	or     %esi,0x18(%esp)
+  804552:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804556:	eb 90                	jmp    8044e8 <__udivdi3+0x47>
+  804558:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80455c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804560:	83 c4 20             	add    $0x20,%esp
+  804563:	5b                   	pop    %ebx
+  804564:	5e                   	pop    %esi
+  804565:	5f                   	pop    %edi
+  804566:	c3                   	ret
+
+00804567 <__umoddi3>:
+  804567:	57                   	push   %edi
+  804568:	56                   	push   %esi
+  804569:	53                   	push   %ebx
+  80456a:	83 ec 08             	sub    $0x8,%esp
+  80456d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804571:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804575:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804579:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80457d:	57                   	push   %edi
+  80457e:	56                   	push   %esi
+  80457f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804583:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804587:	52                   	push   %edx
+  804588:	50                   	push   %eax
+  804589:	e8 13 ff ff ff       	call   8044a1 <__udivdi3>
+  80458e:	89 c3                	mov    %eax,%ebx
+  804590:	0f af d6             	imul   %esi,%edx
+  804593:	89 f9                	mov    %edi,%ecx
+  804595:	0f af cb             	imul   %ebx,%ecx
+  804598:	01 d1                	add    %edx,%ecx
+  80459a:	89 d8                	mov    %ebx,%eax
+  80459c:	f7 e6                	mul    %esi
+  80459e:	89 c6                	mov    %eax,%esi
+  8045a0:	89 d7                	mov    %edx,%edi
+  8045a2:	01 cf                	add    %ecx,%edi
+  8045a4:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8045a8:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8045ac:	29 f0                	sub    %esi,%eax
+  8045ae:	19 fa                	sbb    %edi,%edx
+  8045b0:	83 c4 18             	add    $0x18,%esp
+  8045b3:	5b                   	pop    %ebx
+  8045b4:	5e                   	pop    %esi
+  8045b5:	5f                   	pop    %edi
+  8045b6:	c3                   	ret
+
+008045b7 <__divdi3>:
+  8045b7:	53                   	push   %ebx
+  8045b8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8045bc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8045c0:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8045c4:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8045c8:	85 d2                	test   %edx,%edx
+  8045ca:	78 12                	js     8045de <__divdi3+0x27>
+  8045cc:	85 db                	test   %ebx,%ebx
+  8045ce:	78 2e                	js     8045fe <__divdi3+0x47>
+  8045d0:	53                   	push   %ebx
+  8045d1:	51                   	push   %ecx
+  8045d2:	52                   	push   %edx
+  8045d3:	50                   	push   %eax
+  8045d4:	e8 c8 fe ff ff       	call   8044a1 <__udivdi3>
+  8045d9:	83 c4 10             	add    $0x10,%esp
+  8045dc:	eb 1e                	jmp    8045fc <__divdi3+0x45>
+  8045de:	f7 d8                	neg    %eax
+  8045e0:	83 d2 00             	adc    $0x0,%edx
+  8045e3:	f7 da                	neg    %edx
+  8045e5:	85 db                	test   %ebx,%ebx
+  8045e7:	78 2a                	js     804613 <__divdi3+0x5c>
+  8045e9:	53                   	push   %ebx
+  8045ea:	51                   	push   %ecx
+  8045eb:	52                   	push   %edx
+  8045ec:	50                   	push   %eax
+  8045ed:	e8 af fe ff ff       	call   8044a1 <__udivdi3>
+  8045f2:	83 c4 10             	add    $0x10,%esp
+  8045f5:	f7 d8                	neg    %eax
+  8045f7:	83 d2 00             	adc    $0x0,%edx
+  8045fa:	f7 da                	neg    %edx
+  8045fc:	5b                   	pop    %ebx
+  8045fd:	c3                   	ret
+  8045fe:	f7 d9                	neg    %ecx
+  804600:	83 d3 00             	adc    $0x0,%ebx
+  804603:	f7 db                	neg    %ebx
+  804605:	53                   	push   %ebx
+  804606:	51                   	push   %ecx
+  804607:	52                   	push   %edx
+  804608:	50                   	push   %eax
+  804609:	e8 93 fe ff ff       	call   8044a1 <__udivdi3>
+  80460e:	83 c4 10             	add    $0x10,%esp
+  804611:	eb e2                	jmp    8045f5 <__divdi3+0x3e>
+  804613:	f7 d9                	neg    %ecx
+  804615:	83 d3 00             	adc    $0x0,%ebx
+  804618:	f7 db                	neg    %ebx
+  80461a:	53                   	push   %ebx
+  80461b:	51                   	push   %ecx
+  80461c:	52                   	push   %edx
+  80461d:	50                   	push   %eax
+  80461e:	e8 7e fe ff ff       	call   8044a1 <__udivdi3>
+  804623:	83 c4 10             	add    $0x10,%esp
+  804626:	eb d4                	jmp    8045fc <__divdi3+0x45>
+
+00804628 <__moddi3>:
+  804628:	57                   	push   %edi
+  804629:	56                   	push   %esi
+  80462a:	53                   	push   %ebx
+  80462b:	83 ec 08             	sub    $0x8,%esp
+  80462e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804632:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804636:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80463a:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80463e:	57                   	push   %edi
+  80463f:	56                   	push   %esi
+  804640:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804644:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804648:	52                   	push   %edx
+  804649:	50                   	push   %eax
+  80464a:	e8 68 ff ff ff       	call   8045b7 <__divdi3>
+  80464f:	89 c3                	mov    %eax,%ebx
+  804651:	0f af d6             	imul   %esi,%edx
+  804654:	89 f9                	mov    %edi,%ecx
+  804656:	0f af cb             	imul   %ebx,%ecx
+  804659:	01 d1                	add    %edx,%ecx
+  80465b:	89 d8                	mov    %ebx,%eax
+  80465d:	f7 e6                	mul    %esi
+  80465f:	89 c6                	mov    %eax,%esi
+  804661:	89 d7                	mov    %edx,%edi
+  804663:	01 cf                	add    %ecx,%edi
+  804665:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804669:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80466d:	29 f0                	sub    %esi,%eax
+  80466f:	19 fa                	sbb    %edi,%edx
+  804671:	83 c4 18             	add    $0x18,%esp
+  804674:	5b                   	pop    %ebx
+  804675:	5e                   	pop    %esi
+  804676:	5f                   	pop    %edi
+  804677:	c3                   	ret
@@ -0,0 +1,7854 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0b 00 00 00       	call   80003c <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800035:	66 b8 28 00          	mov    $0x28,%ax
+  800039:	8e d8                	mov    %eax,%ds
+}
+  80003b:	c3                   	ret
+
+0080003c <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003c:	55                   	push   %ebp
+  80003d:	89 e5                	mov    %esp,%ebp
+  80003f:	56                   	push   %esi
+  800040:	53                   	push   %ebx
+  800041:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800044:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800047:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800049:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80004e:	29 d0                	sub    %edx,%eax
+  800050:	89 c2                	mov    %eax,%edx
+  800052:	c1 ea 0f             	shr    $0xf,%edx
+  800055:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005f:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800062:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800069:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80006d:	e8 ef 00 00 00       	call   800161 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800072:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800077:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80007d:	89 e1                	mov    %esp,%ecx
+  80007f:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800084:	29 ca                	sub    %ecx,%edx
+  800086:	89 d1                	mov    %edx,%ecx
+  800088:	c1 e9 0f             	shr    $0xf,%ecx
+  80008b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800091:	ba 00 00 00 00       	mov    $0x0,%edx
+  800096:	0f 42 d1             	cmovb  %ecx,%edx
+  800099:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009e:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e 07                	jle    8000b0 <libmain+0x74>
+		binaryname = argv[0];
+  8000a9:	8b 06                	mov    (%esi),%eax
+  8000ab:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	e8 7b ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000ba:	e8 0a 00 00 00       	call   8000c9 <exit>
+}
+  8000bf:	83 c4 10             	add    $0x10,%esp
+  8000c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c5:	5b                   	pop    %ebx
+  8000c6:	5e                   	pop    %esi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000cf:	e8 17 07 00 00       	call   8007eb <close_all>
+	sys_env_destroy(0);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	6a 00                	push   $0x0
+  8000d9:	e8 42 00 00 00       	call   800120 <sys_env_destroy>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	57                   	push   %edi
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000f4:	89 c3                	mov    %eax,%ebx
+  8000f6:	89 c7                	mov    %eax,%edi
+  8000f8:	89 c6                	mov    %eax,%esi
+  8000fa:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000fc:	5b                   	pop    %ebx
+  8000fd:	5e                   	pop    %esi
+  8000fe:	5f                   	pop    %edi
+  8000ff:	5d                   	pop    %ebp
+  800100:	c3                   	ret
+
+00800101 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800101:	55                   	push   %ebp
+  800102:	89 e5                	mov    %esp,%ebp
+  800104:	57                   	push   %edi
+  800105:	56                   	push   %esi
+  800106:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800107:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800111:	89 d1                	mov    %edx,%ecx
+  800113:	89 d3                	mov    %edx,%ebx
+  800115:	89 d7                	mov    %edx,%edi
+  800117:	89 d6                	mov    %edx,%esi
+  800119:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80011b:	5b                   	pop    %ebx
+  80011c:	5e                   	pop    %esi
+  80011d:	5f                   	pop    %edi
+  80011e:	5d                   	pop    %ebp
+  80011f:	c3                   	ret
+
+00800120 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	57                   	push   %edi
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800129:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80012e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800131:	b8 03 00 00 00       	mov    $0x3,%eax
+  800136:	89 cb                	mov    %ecx,%ebx
+  800138:	89 cf                	mov    %ecx,%edi
+  80013a:	89 ce                	mov    %ecx,%esi
+  80013c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80013e:	85 c0                	test   %eax,%eax
+  800140:	7f 08                	jg     80014a <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800142:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800145:	5b                   	pop    %ebx
+  800146:	5e                   	pop    %esi
+  800147:	5f                   	pop    %edi
+  800148:	5d                   	pop    %ebp
+  800149:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	50                   	push   %eax
+  80014e:	6a 03                	push   $0x3
+  800150:	68 8a 3a 80 00       	push   $0x803a8a
+  800155:	6a 23                	push   $0x23
+  800157:	68 a7 3a 80 00       	push   $0x803aa7
+  80015c:	e8 79 28 00 00       	call   8029da <_panic>
+
+00800161 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800161:	55                   	push   %ebp
+  800162:	89 e5                	mov    %esp,%ebp
+  800164:	57                   	push   %edi
+  800165:	56                   	push   %esi
+  800166:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800171:	89 d1                	mov    %edx,%ecx
+  800173:	89 d3                	mov    %edx,%ebx
+  800175:	89 d7                	mov    %edx,%edi
+  800177:	89 d6                	mov    %edx,%esi
+  800179:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80017b:	5b                   	pop    %ebx
+  80017c:	5e                   	pop    %esi
+  80017d:	5f                   	pop    %edi
+  80017e:	5d                   	pop    %ebp
+  80017f:	c3                   	ret
+
+00800180 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800180:	55                   	push   %ebp
+  800181:	89 e5                	mov    %esp,%ebp
+  800183:	57                   	push   %edi
+  800184:	56                   	push   %esi
+  800185:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800186:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800190:	89 d1                	mov    %edx,%ecx
+  800192:	89 d3                	mov    %edx,%ebx
+  800194:	89 d7                	mov    %edx,%edi
+  800196:	89 d6                	mov    %edx,%esi
+  800198:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80019a:	5b                   	pop    %ebx
+  80019b:	5e                   	pop    %esi
+  80019c:	5f                   	pop    %edi
+  80019d:	5d                   	pop    %ebp
+  80019e:	c3                   	ret
+
+0080019f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80019f:	55                   	push   %ebp
+  8001a0:	89 e5                	mov    %esp,%ebp
+  8001a2:	57                   	push   %edi
+  8001a3:	56                   	push   %esi
+  8001a4:	53                   	push   %ebx
+  8001a5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001bb:	89 f7                	mov    %esi,%edi
+  8001bd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	7f 08                	jg     8001cb <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c6:	5b                   	pop    %ebx
+  8001c7:	5e                   	pop    %esi
+  8001c8:	5f                   	pop    %edi
+  8001c9:	5d                   	pop    %ebp
+  8001ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001cb:	83 ec 0c             	sub    $0xc,%esp
+  8001ce:	50                   	push   %eax
+  8001cf:	6a 04                	push   $0x4
+  8001d1:	68 8a 3a 80 00       	push   $0x803a8a
+  8001d6:	6a 23                	push   $0x23
+  8001d8:	68 a7 3a 80 00       	push   $0x803aa7
+  8001dd:	e8 f8 27 00 00       	call   8029da <_panic>
+
+008001e2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e2:	55                   	push   %ebp
+  8001e3:	89 e5                	mov    %esp,%ebp
+  8001e5:	57                   	push   %edi
+  8001e6:	56                   	push   %esi
+  8001e7:	53                   	push   %ebx
+  8001e8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001fc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800201:	85 c0                	test   %eax,%eax
+  800203:	7f 08                	jg     80020d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800205:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800208:	5b                   	pop    %ebx
+  800209:	5e                   	pop    %esi
+  80020a:	5f                   	pop    %edi
+  80020b:	5d                   	pop    %ebp
+  80020c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80020d:	83 ec 0c             	sub    $0xc,%esp
+  800210:	50                   	push   %eax
+  800211:	6a 05                	push   $0x5
+  800213:	68 8a 3a 80 00       	push   $0x803a8a
+  800218:	6a 23                	push   $0x23
+  80021a:	68 a7 3a 80 00       	push   $0x803aa7
+  80021f:	e8 b6 27 00 00       	call   8029da <_panic>
+
+00800224 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	57                   	push   %edi
+  800228:	56                   	push   %esi
+  800229:	53                   	push   %ebx
+  80022a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80022d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800232:	8b 55 08             	mov    0x8(%ebp),%edx
+  800235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800238:	b8 06 00 00 00       	mov    $0x6,%eax
+  80023d:	89 df                	mov    %ebx,%edi
+  80023f:	89 de                	mov    %ebx,%esi
+  800241:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800243:	85 c0                	test   %eax,%eax
+  800245:	7f 08                	jg     80024f <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024a:	5b                   	pop    %ebx
+  80024b:	5e                   	pop    %esi
+  80024c:	5f                   	pop    %edi
+  80024d:	5d                   	pop    %ebp
+  80024e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024f:	83 ec 0c             	sub    $0xc,%esp
+  800252:	50                   	push   %eax
+  800253:	6a 06                	push   $0x6
+  800255:	68 8a 3a 80 00       	push   $0x803a8a
+  80025a:	6a 23                	push   $0x23
+  80025c:	68 a7 3a 80 00       	push   $0x803aa7
+  800261:	e8 74 27 00 00       	call   8029da <_panic>
+
+00800266 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800266:	55                   	push   %ebp
+  800267:	89 e5                	mov    %esp,%ebp
+  800269:	57                   	push   %edi
+  80026a:	56                   	push   %esi
+  80026b:	53                   	push   %ebx
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80026f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800274:	8b 55 08             	mov    0x8(%ebp),%edx
+  800277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80027f:	89 df                	mov    %ebx,%edi
+  800281:	89 de                	mov    %ebx,%esi
+  800283:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800285:	85 c0                	test   %eax,%eax
+  800287:	7f 08                	jg     800291 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028c:	5b                   	pop    %ebx
+  80028d:	5e                   	pop    %esi
+  80028e:	5f                   	pop    %edi
+  80028f:	5d                   	pop    %ebp
+  800290:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	50                   	push   %eax
+  800295:	6a 08                	push   $0x8
+  800297:	68 8a 3a 80 00       	push   $0x803a8a
+  80029c:	6a 23                	push   $0x23
+  80029e:	68 a7 3a 80 00       	push   $0x803aa7
+  8002a3:	e8 32 27 00 00       	call   8029da <_panic>
+
+008002a8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	57                   	push   %edi
+  8002ac:	56                   	push   %esi
+  8002ad:	53                   	push   %ebx
+  8002ae:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002bc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002c1:	89 df                	mov    %ebx,%edi
+  8002c3:	89 de                	mov    %ebx,%esi
+  8002c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002c7:	85 c0                	test   %eax,%eax
+  8002c9:	7f 08                	jg     8002d3 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ce:	5b                   	pop    %ebx
+  8002cf:	5e                   	pop    %esi
+  8002d0:	5f                   	pop    %edi
+  8002d1:	5d                   	pop    %ebp
+  8002d2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002d3:	83 ec 0c             	sub    $0xc,%esp
+  8002d6:	50                   	push   %eax
+  8002d7:	6a 09                	push   $0x9
+  8002d9:	68 8a 3a 80 00       	push   $0x803a8a
+  8002de:	6a 23                	push   $0x23
+  8002e0:	68 a7 3a 80 00       	push   $0x803aa7
+  8002e5:	e8 f0 26 00 00       	call   8029da <_panic>
+
+008002ea <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002ea:	55                   	push   %ebp
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	57                   	push   %edi
+  8002ee:	56                   	push   %esi
+  8002ef:	53                   	push   %ebx
+  8002f0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800303:	89 df                	mov    %ebx,%edi
+  800305:	89 de                	mov    %ebx,%esi
+  800307:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800309:	85 c0                	test   %eax,%eax
+  80030b:	7f 08                	jg     800315 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80030d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800310:	5b                   	pop    %ebx
+  800311:	5e                   	pop    %esi
+  800312:	5f                   	pop    %edi
+  800313:	5d                   	pop    %ebp
+  800314:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800315:	83 ec 0c             	sub    $0xc,%esp
+  800318:	50                   	push   %eax
+  800319:	6a 0a                	push   $0xa
+  80031b:	68 8a 3a 80 00       	push   $0x803a8a
+  800320:	6a 23                	push   $0x23
+  800322:	68 a7 3a 80 00       	push   $0x803aa7
+  800327:	e8 ae 26 00 00       	call   8029da <_panic>
+
+0080032c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	57                   	push   %edi
+  800330:	56                   	push   %esi
+  800331:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800332:	8b 55 08             	mov    0x8(%ebp),%edx
+  800335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800338:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+  800342:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800345:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800348:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80034a:	5b                   	pop    %ebx
+  80034b:	5e                   	pop    %esi
+  80034c:	5f                   	pop    %edi
+  80034d:	5d                   	pop    %ebp
+  80034e:	c3                   	ret
+
+0080034f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80034f:	55                   	push   %ebp
+  800350:	89 e5                	mov    %esp,%ebp
+  800352:	57                   	push   %edi
+  800353:	56                   	push   %esi
+  800354:	53                   	push   %ebx
+  800355:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800358:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80035d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800360:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800365:	89 cb                	mov    %ecx,%ebx
+  800367:	89 cf                	mov    %ecx,%edi
+  800369:	89 ce                	mov    %ecx,%esi
+  80036b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80036d:	85 c0                	test   %eax,%eax
+  80036f:	7f 08                	jg     800379 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800374:	5b                   	pop    %ebx
+  800375:	5e                   	pop    %esi
+  800376:	5f                   	pop    %edi
+  800377:	5d                   	pop    %ebp
+  800378:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800379:	83 ec 0c             	sub    $0xc,%esp
+  80037c:	50                   	push   %eax
+  80037d:	6a 0d                	push   $0xd
+  80037f:	68 8a 3a 80 00       	push   $0x803a8a
+  800384:	6a 23                	push   $0x23
+  800386:	68 a7 3a 80 00       	push   $0x803aa7
+  80038b:	e8 4a 26 00 00       	call   8029da <_panic>
+
+00800390 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	57                   	push   %edi
+  800394:	56                   	push   %esi
+  800395:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800396:	8b 55 08             	mov    0x8(%ebp),%edx
+  800399:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80039c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003a7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003aa:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003ac:	5b                   	pop    %ebx
+  8003ad:	5e                   	pop    %esi
+  8003ae:	5f                   	pop    %edi
+  8003af:	5d                   	pop    %ebp
+  8003b0:	c3                   	ret
+
+008003b1 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003b1:	55                   	push   %ebp
+  8003b2:	89 e5                	mov    %esp,%ebp
+  8003b4:	57                   	push   %edi
+  8003b5:	56                   	push   %esi
+  8003b6:	53                   	push   %ebx
+  8003b7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003ca:	89 df                	mov    %ebx,%edi
+  8003cc:	89 de                	mov    %ebx,%esi
+  8003ce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003d0:	85 c0                	test   %eax,%eax
+  8003d2:	7f 08                	jg     8003dc <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d7:	5b                   	pop    %ebx
+  8003d8:	5e                   	pop    %esi
+  8003d9:	5f                   	pop    %edi
+  8003da:	5d                   	pop    %ebp
+  8003db:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003dc:	83 ec 0c             	sub    $0xc,%esp
+  8003df:	50                   	push   %eax
+  8003e0:	6a 0d                	push   $0xd
+  8003e2:	68 8a 3a 80 00       	push   $0x803a8a
+  8003e7:	6a 23                	push   $0x23
+  8003e9:	68 a7 3a 80 00       	push   $0x803aa7
+  8003ee:	e8 e7 25 00 00       	call   8029da <_panic>
+
+008003f3 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	57                   	push   %edi
+  8003f7:	56                   	push   %esi
+  8003f8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fe:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800403:	89 d1                	mov    %edx,%ecx
+  800405:	89 d3                	mov    %edx,%ebx
+  800407:	89 d7                	mov    %edx,%edi
+  800409:	89 d6                	mov    %edx,%esi
+  80040b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80040d:	5b                   	pop    %ebx
+  80040e:	5e                   	pop    %esi
+  80040f:	5f                   	pop    %edi
+  800410:	5d                   	pop    %ebp
+  800411:	c3                   	ret
+
+00800412 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800412:	55                   	push   %ebp
+  800413:	89 e5                	mov    %esp,%ebp
+  800415:	57                   	push   %edi
+  800416:	56                   	push   %esi
+  800417:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800418:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80041d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800423:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800428:	89 df                	mov    %ebx,%edi
+  80042a:	89 de                	mov    %ebx,%esi
+  80042c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80042e:	5b                   	pop    %ebx
+  80042f:	5e                   	pop    %esi
+  800430:	5f                   	pop    %edi
+  800431:	5d                   	pop    %ebp
+  800432:	c3                   	ret
+
+00800433 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	57                   	push   %edi
+  800437:	56                   	push   %esi
+  800438:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800439:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80043e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800441:	b8 10 00 00 00       	mov    $0x10,%eax
+  800446:	89 cb                	mov    %ecx,%ebx
+  800448:	89 cf                	mov    %ecx,%edi
+  80044a:	89 ce                	mov    %ecx,%esi
+  80044c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80044e:	5b                   	pop    %ebx
+  80044f:	5e                   	pop    %esi
+  800450:	5f                   	pop    %edi
+  800451:	5d                   	pop    %ebp
+  800452:	c3                   	ret
+
+00800453 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800453:	55                   	push   %ebp
+  800454:	89 e5                	mov    %esp,%ebp
+  800456:	57                   	push   %edi
+  800457:	56                   	push   %esi
+  800458:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800459:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80045e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800461:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800464:	b8 11 00 00 00       	mov    $0x11,%eax
+  800469:	89 df                	mov    %ebx,%edi
+  80046b:	89 de                	mov    %ebx,%esi
+  80046d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80046f:	5b                   	pop    %ebx
+  800470:	5e                   	pop    %esi
+  800471:	5f                   	pop    %edi
+  800472:	5d                   	pop    %ebp
+  800473:	c3                   	ret
+
+00800474 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800474:	55                   	push   %ebp
+  800475:	89 e5                	mov    %esp,%ebp
+  800477:	57                   	push   %edi
+  800478:	56                   	push   %esi
+  800479:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80047a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80047f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800482:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800485:	b8 12 00 00 00       	mov    $0x12,%eax
+  80048a:	89 df                	mov    %ebx,%edi
+  80048c:	89 de                	mov    %ebx,%esi
+  80048e:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  800490:	5b                   	pop    %ebx
+  800491:	5e                   	pop    %esi
+  800492:	5f                   	pop    %edi
+  800493:	5d                   	pop    %ebp
+  800494:	c3                   	ret
+
+00800495 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800495:	55                   	push   %ebp
+  800496:	89 e5                	mov    %esp,%ebp
+  800498:	57                   	push   %edi
+  800499:	56                   	push   %esi
+  80049a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80049b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004a8:	89 cb                	mov    %ecx,%ebx
+  8004aa:	89 cf                	mov    %ecx,%edi
+  8004ac:	89 ce                	mov    %ecx,%esi
+  8004ae:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+
+008004b5 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	57                   	push   %edi
+  8004b9:	56                   	push   %esi
+  8004ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004cb:	89 df                	mov    %ebx,%edi
+  8004cd:	89 de                	mov    %ebx,%esi
+  8004cf:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004d1:	5b                   	pop    %ebx
+  8004d2:	5e                   	pop    %esi
+  8004d3:	5f                   	pop    %edi
+  8004d4:	5d                   	pop    %ebp
+  8004d5:	c3                   	ret
+
+008004d6 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004d6:	55                   	push   %ebp
+  8004d7:	89 e5                	mov    %esp,%ebp
+  8004d9:	57                   	push   %edi
+  8004da:	56                   	push   %esi
+  8004db:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8004e9:	89 cb                	mov    %ecx,%ebx
+  8004eb:	89 cf                	mov    %ecx,%edi
+  8004ed:	89 ce                	mov    %ecx,%esi
+  8004ef:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8004f1:	5b                   	pop    %ebx
+  8004f2:	5e                   	pop    %esi
+  8004f3:	5f                   	pop    %edi
+  8004f4:	5d                   	pop    %ebp
+  8004f5:	c3                   	ret
+
+008004f6 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8004f6:	55                   	push   %ebp
+  8004f7:	89 e5                	mov    %esp,%ebp
+  8004f9:	57                   	push   %edi
+  8004fa:	56                   	push   %esi
+  8004fb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800501:	8b 55 08             	mov    0x8(%ebp),%edx
+  800504:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800507:	b8 16 00 00 00       	mov    $0x16,%eax
+  80050c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80050f:	89 f7                	mov    %esi,%edi
+  800511:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  800513:	5b                   	pop    %ebx
+  800514:	5e                   	pop    %esi
+  800515:	5f                   	pop    %edi
+  800516:	5d                   	pop    %ebp
+  800517:	c3                   	ret
+
+00800518 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800518:	55                   	push   %ebp
+  800519:	89 e5                	mov    %esp,%ebp
+  80051b:	57                   	push   %edi
+  80051c:	56                   	push   %esi
+  80051d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80051e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800523:	8b 55 08             	mov    0x8(%ebp),%edx
+  800526:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800529:	b8 17 00 00 00       	mov    $0x17,%eax
+  80052e:	89 df                	mov    %ebx,%edi
+  800530:	89 de                	mov    %ebx,%esi
+  800532:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  800534:	5b                   	pop    %ebx
+  800535:	5e                   	pop    %esi
+  800536:	5f                   	pop    %edi
+  800537:	5d                   	pop    %ebp
+  800538:	c3                   	ret
+
+00800539 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800539:	55                   	push   %ebp
+  80053a:	89 e5                	mov    %esp,%ebp
+  80053c:	57                   	push   %edi
+  80053d:	56                   	push   %esi
+  80053e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80053f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800544:	8b 55 08             	mov    0x8(%ebp),%edx
+  800547:	b8 18 00 00 00       	mov    $0x18,%eax
+  80054c:	89 cb                	mov    %ecx,%ebx
+  80054e:	89 cf                	mov    %ecx,%edi
+  800550:	89 ce                	mov    %ecx,%esi
+  800552:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  800554:	5b                   	pop    %ebx
+  800555:	5e                   	pop    %esi
+  800556:	5f                   	pop    %edi
+  800557:	5d                   	pop    %ebp
+  800558:	c3                   	ret
+
+00800559 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800559:	55                   	push   %ebp
+  80055a:	89 e5                	mov    %esp,%ebp
+  80055c:	57                   	push   %edi
+  80055d:	56                   	push   %esi
+  80055e:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80055f:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  800563:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800568:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80056b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800570:	89 df                	mov    %ebx,%edi
+  800572:	89 de                	mov    %ebx,%esi
+  800574:	cd 30                	int    $0x30
+}
+  800576:	5b                   	pop    %ebx
+  800577:	5e                   	pop    %esi
+  800578:	5f                   	pop    %edi
+  800579:	5d                   	pop    %ebp
+  80057a:	c3                   	ret
+
+0080057b <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80057b:	55                   	push   %ebp
+  80057c:	89 e5                	mov    %esp,%ebp
+  80057e:	57                   	push   %edi
+  80057f:	56                   	push   %esi
+  800580:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800581:	be 00 00 00 00       	mov    $0x0,%esi
+  800586:	8b 55 08             	mov    0x8(%ebp),%edx
+  800589:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80058c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800591:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800594:	89 f7                	mov    %esi,%edi
+  800596:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  800598:	5b                   	pop    %ebx
+  800599:	5e                   	pop    %esi
+  80059a:	5f                   	pop    %edi
+  80059b:	5d                   	pop    %ebp
+  80059c:	c3                   	ret
+
+0080059d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80059d:	55                   	push   %ebp
+  80059e:	89 e5                	mov    %esp,%ebp
+  8005a0:	57                   	push   %edi
+  8005a1:	56                   	push   %esi
+  8005a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ae:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005b6:	89 f7                	mov    %esi,%edi
+  8005b8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005ba:	5b                   	pop    %ebx
+  8005bb:	5e                   	pop    %esi
+  8005bc:	5f                   	pop    %edi
+  8005bd:	5d                   	pop    %ebp
+  8005be:	c3                   	ret
+
+008005bf <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005bf:	55                   	push   %ebp
+  8005c0:	89 e5                	mov    %esp,%ebp
+  8005c2:	57                   	push   %edi
+  8005c3:	56                   	push   %esi
+  8005c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005d5:	89 df                	mov    %ebx,%edi
+  8005d7:	89 de                	mov    %ebx,%esi
+  8005d9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005db:	5b                   	pop    %ebx
+  8005dc:	5e                   	pop    %esi
+  8005dd:	5f                   	pop    %edi
+  8005de:	5d                   	pop    %ebp
+  8005df:	c3                   	ret
+
+008005e0 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005e0:	55                   	push   %ebp
+  8005e1:	89 e5                	mov    %esp,%ebp
+  8005e3:	57                   	push   %edi
+  8005e4:	56                   	push   %esi
+  8005e5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8005f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005f9:	89 f7                	mov    %esi,%edi
+  8005fb:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8005fd:	5b                   	pop    %ebx
+  8005fe:	5e                   	pop    %esi
+  8005ff:	5f                   	pop    %edi
+  800600:	5d                   	pop    %ebp
+  800601:	c3                   	ret
+
+00800602 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800602:	55                   	push   %ebp
+  800603:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800605:	8b 45 08             	mov    0x8(%ebp),%eax
+  800608:	05 00 00 00 30       	add    $0x30000000,%eax
+  80060d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800610:	5d                   	pop    %ebp
+  800611:	c3                   	ret
+
+00800612 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800612:	55                   	push   %ebp
+  800613:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800615:	8b 45 08             	mov    0x8(%ebp),%eax
+  800618:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80061d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800622:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800627:	5d                   	pop    %ebp
+  800628:	c3                   	ret
+
+00800629 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800629:	55                   	push   %ebp
+  80062a:	89 e5                	mov    %esp,%ebp
+  80062c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  800631:	89 c2                	mov    %eax,%edx
+  800633:	c1 ea 16             	shr    $0x16,%edx
+  800636:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80063d:	f6 c2 01             	test   $0x1,%dl
+  800640:	74 29                	je     80066b <fd_alloc+0x42>
+  800642:	89 c2                	mov    %eax,%edx
+  800644:	c1 ea 0c             	shr    $0xc,%edx
+  800647:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80064e:	f6 c2 01             	test   $0x1,%dl
+  800651:	74 18                	je     80066b <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800653:	05 00 10 00 00       	add    $0x1000,%eax
+  800658:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80065d:	75 d2                	jne    800631 <fd_alloc+0x8>
+  80065f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800664:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800669:	eb 05                	jmp    800670 <fd_alloc+0x47>
+			return 0;
+  80066b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800670:	8b 55 08             	mov    0x8(%ebp),%edx
+  800673:	89 02                	mov    %eax,(%edx)
+}
+  800675:	89 c8                	mov    %ecx,%eax
+  800677:	5d                   	pop    %ebp
+  800678:	c3                   	ret
+
+00800679 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800679:	55                   	push   %ebp
+  80067a:	89 e5                	mov    %esp,%ebp
+  80067c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80067f:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800684:	77 30                	ja     8006b6 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800686:	c1 e0 0c             	shl    $0xc,%eax
+  800689:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80068e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800694:	f6 c2 01             	test   $0x1,%dl
+  800697:	74 24                	je     8006bd <fd_lookup+0x44>
+  800699:	89 c2                	mov    %eax,%edx
+  80069b:	c1 ea 0c             	shr    $0xc,%edx
+  80069e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006a5:	f6 c2 01             	test   $0x1,%dl
+  8006a8:	74 1a                	je     8006c4 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ad:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006b4:	5d                   	pop    %ebp
+  8006b5:	c3                   	ret
+		return -E_INVAL;
+  8006b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006bb:	eb f7                	jmp    8006b4 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c2:	eb f0                	jmp    8006b4 <fd_lookup+0x3b>
+  8006c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c9:	eb e9                	jmp    8006b4 <fd_lookup+0x3b>
+
+008006cb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006cb:	55                   	push   %ebp
+  8006cc:	89 e5                	mov    %esp,%ebp
+  8006ce:	53                   	push   %ebx
+  8006cf:	83 ec 04             	sub    $0x4,%esp
+  8006d2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006da:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8006df:	39 13                	cmp    %edx,(%ebx)
+  8006e1:	74 54                	je     800737 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8006e3:	83 c0 01             	add    $0x1,%eax
+  8006e6:	8b 1c 85 34 3b 80 00 	mov    0x803b34(,%eax,4),%ebx
+  8006ed:	85 db                	test   %ebx,%ebx
+  8006ef:	75 ee                	jne    8006df <dev_lookup+0x14>
+  8006f1:	89 e1                	mov    %esp,%ecx
+  8006f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8006f8:	29 c8                	sub    %ecx,%eax
+  8006fa:	89 c1                	mov    %eax,%ecx
+  8006fc:	c1 e9 0f             	shr    $0xf,%ecx
+  8006ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80070c:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800713:	8b 40 48             	mov    0x48(%eax),%eax
+  800716:	83 ec 04             	sub    $0x4,%esp
+  800719:	52                   	push   %edx
+  80071a:	50                   	push   %eax
+  80071b:	68 b8 3a 80 00       	push   $0x803ab8
+  800720:	e8 90 23 00 00       	call   802ab5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800725:	83 c4 10             	add    $0x10,%esp
+  800728:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80072d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800730:	89 1a                	mov    %ebx,(%edx)
+}
+  800732:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800735:	c9                   	leave
+  800736:	c3                   	ret
+			return 0;
+  800737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073c:	eb ef                	jmp    80072d <dev_lookup+0x62>
+
+0080073e <fd_close>:
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	57                   	push   %edi
+  800742:	56                   	push   %esi
+  800743:	53                   	push   %ebx
+  800744:	83 ec 24             	sub    $0x24,%esp
+  800747:	8b 75 08             	mov    0x8(%ebp),%esi
+  80074a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80074d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800750:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800751:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800757:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80075a:	50                   	push   %eax
+  80075b:	e8 19 ff ff ff       	call   800679 <fd_lookup>
+  800760:	89 c3                	mov    %eax,%ebx
+  800762:	83 c4 10             	add    $0x10,%esp
+  800765:	85 c0                	test   %eax,%eax
+  800767:	78 05                	js     80076e <fd_close+0x30>
+	    || fd != fd2)
+  800769:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80076c:	74 0f                	je     80077d <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80076e:	85 ff                	test   %edi,%edi
+  800770:	0f 44 df             	cmove  %edi,%ebx
+}
+  800773:	89 d8                	mov    %ebx,%eax
+  800775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800778:	5b                   	pop    %ebx
+  800779:	5e                   	pop    %esi
+  80077a:	5f                   	pop    %edi
+  80077b:	5d                   	pop    %ebp
+  80077c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80077d:	83 ec 08             	sub    $0x8,%esp
+  800780:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800783:	50                   	push   %eax
+  800784:	ff 36                	push   (%esi)
+  800786:	e8 40 ff ff ff       	call   8006cb <dev_lookup>
+  80078b:	89 c3                	mov    %eax,%ebx
+  80078d:	83 c4 10             	add    $0x10,%esp
+  800790:	85 c0                	test   %eax,%eax
+  800792:	78 1a                	js     8007ae <fd_close+0x70>
+		if (dev->dev_close)
+  800794:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800797:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80079a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80079f:	85 c0                	test   %eax,%eax
+  8007a1:	74 0b                	je     8007ae <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8007a3:	83 ec 0c             	sub    $0xc,%esp
+  8007a6:	56                   	push   %esi
+  8007a7:	ff d0                	call   *%eax
+  8007a9:	89 c3                	mov    %eax,%ebx
+  8007ab:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007ae:	83 ec 08             	sub    $0x8,%esp
+  8007b1:	56                   	push   %esi
+  8007b2:	6a 00                	push   $0x0
+  8007b4:	e8 6b fa ff ff       	call   800224 <sys_page_unmap>
+	return r;
+  8007b9:	83 c4 10             	add    $0x10,%esp
+  8007bc:	eb b5                	jmp    800773 <fd_close+0x35>
+
+008007be <close>:
+
+int
+close(int fdnum)
+{
+  8007be:	55                   	push   %ebp
+  8007bf:	89 e5                	mov    %esp,%ebp
+  8007c1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007c7:	50                   	push   %eax
+  8007c8:	ff 75 08             	push   0x8(%ebp)
+  8007cb:	e8 a9 fe ff ff       	call   800679 <fd_lookup>
+  8007d0:	83 c4 10             	add    $0x10,%esp
+  8007d3:	85 c0                	test   %eax,%eax
+  8007d5:	79 02                	jns    8007d9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007d7:	c9                   	leave
+  8007d8:	c3                   	ret
+		return fd_close(fd, 1);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	6a 01                	push   $0x1
+  8007de:	ff 75 f4             	push   -0xc(%ebp)
+  8007e1:	e8 58 ff ff ff       	call   80073e <fd_close>
+  8007e6:	83 c4 10             	add    $0x10,%esp
+  8007e9:	eb ec                	jmp    8007d7 <close+0x19>
+
+008007eb <close_all>:
+
+void
+close_all(void)
+{
+  8007eb:	55                   	push   %ebp
+  8007ec:	89 e5                	mov    %esp,%ebp
+  8007ee:	53                   	push   %ebx
+  8007ef:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007f7:	83 ec 0c             	sub    $0xc,%esp
+  8007fa:	53                   	push   %ebx
+  8007fb:	e8 be ff ff ff       	call   8007be <close>
+	for (i = 0; i < MAXFD; i++)
+  800800:	83 c3 01             	add    $0x1,%ebx
+  800803:	83 c4 10             	add    $0x10,%esp
+  800806:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80080c:	75 e9                	jne    8007f7 <close_all+0xc>
+}
+  80080e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800811:	c9                   	leave
+  800812:	c3                   	ret
+
+00800813 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800813:	55                   	push   %ebp
+  800814:	89 e5                	mov    %esp,%ebp
+  800816:	57                   	push   %edi
+  800817:	56                   	push   %esi
+  800818:	53                   	push   %ebx
+  800819:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80081c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80081f:	50                   	push   %eax
+  800820:	ff 75 08             	push   0x8(%ebp)
+  800823:	e8 51 fe ff ff       	call   800679 <fd_lookup>
+  800828:	89 c3                	mov    %eax,%ebx
+  80082a:	83 c4 10             	add    $0x10,%esp
+  80082d:	85 c0                	test   %eax,%eax
+  80082f:	78 7f                	js     8008b0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800831:	83 ec 0c             	sub    $0xc,%esp
+  800834:	ff 75 0c             	push   0xc(%ebp)
+  800837:	e8 82 ff ff ff       	call   8007be <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80083c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80083f:	c1 e6 0c             	shl    $0xc,%esi
+  800842:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800848:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80084b:	89 3c 24             	mov    %edi,(%esp)
+  80084e:	e8 bf fd ff ff       	call   800612 <fd2data>
+  800853:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800855:	89 34 24             	mov    %esi,(%esp)
+  800858:	e8 b5 fd ff ff       	call   800612 <fd2data>
+  80085d:	83 c4 10             	add    $0x10,%esp
+  800860:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  800863:	89 d8                	mov    %ebx,%eax
+  800865:	c1 e8 16             	shr    $0x16,%eax
+  800868:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80086f:	a8 01                	test   $0x1,%al
+  800871:	74 11                	je     800884 <dup+0x71>
+  800873:	89 d8                	mov    %ebx,%eax
+  800875:	c1 e8 0c             	shr    $0xc,%eax
+  800878:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80087f:	f6 c2 01             	test   $0x1,%dl
+  800882:	75 36                	jne    8008ba <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800884:	89 f8                	mov    %edi,%eax
+  800886:	c1 e8 0c             	shr    $0xc,%eax
+  800889:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800890:	83 ec 0c             	sub    $0xc,%esp
+  800893:	25 07 0e 00 00       	and    $0xe07,%eax
+  800898:	50                   	push   %eax
+  800899:	56                   	push   %esi
+  80089a:	6a 00                	push   $0x0
+  80089c:	57                   	push   %edi
+  80089d:	6a 00                	push   $0x0
+  80089f:	e8 3e f9 ff ff       	call   8001e2 <sys_page_map>
+  8008a4:	89 c3                	mov    %eax,%ebx
+  8008a6:	83 c4 20             	add    $0x20,%esp
+  8008a9:	85 c0                	test   %eax,%eax
+  8008ab:	78 33                	js     8008e0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008b0:	89 d8                	mov    %ebx,%eax
+  8008b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b5:	5b                   	pop    %ebx
+  8008b6:	5e                   	pop    %esi
+  8008b7:	5f                   	pop    %edi
+  8008b8:	5d                   	pop    %ebp
+  8008b9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008ba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008c1:	83 ec 0c             	sub    $0xc,%esp
+  8008c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008c9:	50                   	push   %eax
+  8008ca:	ff 75 d4             	push   -0x2c(%ebp)
+  8008cd:	6a 00                	push   $0x0
+  8008cf:	53                   	push   %ebx
+  8008d0:	6a 00                	push   $0x0
+  8008d2:	e8 0b f9 ff ff       	call   8001e2 <sys_page_map>
+  8008d7:	89 c3                	mov    %eax,%ebx
+  8008d9:	83 c4 20             	add    $0x20,%esp
+  8008dc:	85 c0                	test   %eax,%eax
+  8008de:	79 a4                	jns    800884 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008e0:	83 ec 08             	sub    $0x8,%esp
+  8008e3:	56                   	push   %esi
+  8008e4:	6a 00                	push   $0x0
+  8008e6:	e8 39 f9 ff ff       	call   800224 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008eb:	83 c4 08             	add    $0x8,%esp
+  8008ee:	ff 75 d4             	push   -0x2c(%ebp)
+  8008f1:	6a 00                	push   $0x0
+  8008f3:	e8 2c f9 ff ff       	call   800224 <sys_page_unmap>
+	return r;
+  8008f8:	83 c4 10             	add    $0x10,%esp
+  8008fb:	eb b3                	jmp    8008b0 <dup+0x9d>
+
+008008fd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	56                   	push   %esi
+  800901:	53                   	push   %ebx
+  800902:	83 ec 18             	sub    $0x18,%esp
+  800905:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800908:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80090b:	50                   	push   %eax
+  80090c:	53                   	push   %ebx
+  80090d:	e8 67 fd ff ff       	call   800679 <fd_lookup>
+  800912:	83 c4 10             	add    $0x10,%esp
+  800915:	85 c0                	test   %eax,%eax
+  800917:	78 3c                	js     800955 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800919:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80091c:	83 ec 08             	sub    $0x8,%esp
+  80091f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800922:	50                   	push   %eax
+  800923:	ff 36                	push   (%esi)
+  800925:	e8 a1 fd ff ff       	call   8006cb <dev_lookup>
+  80092a:	83 c4 10             	add    $0x10,%esp
+  80092d:	85 c0                	test   %eax,%eax
+  80092f:	78 24                	js     800955 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800931:	8b 46 08             	mov    0x8(%esi),%eax
+  800934:	83 e0 03             	and    $0x3,%eax
+  800937:	83 f8 01             	cmp    $0x1,%eax
+  80093a:	74 20                	je     80095c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80093c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093f:	8b 40 08             	mov    0x8(%eax),%eax
+  800942:	85 c0                	test   %eax,%eax
+  800944:	74 54                	je     80099a <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800946:	83 ec 04             	sub    $0x4,%esp
+  800949:	ff 75 10             	push   0x10(%ebp)
+  80094c:	ff 75 0c             	push   0xc(%ebp)
+  80094f:	56                   	push   %esi
+  800950:	ff d0                	call   *%eax
+  800952:	83 c4 10             	add    $0x10,%esp
+}
+  800955:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800958:	5b                   	pop    %ebx
+  800959:	5e                   	pop    %esi
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+  80095c:	89 e2                	mov    %esp,%edx
+  80095e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800963:	29 d0                	sub    %edx,%eax
+  800965:	89 c2                	mov    %eax,%edx
+  800967:	c1 ea 0f             	shr    $0xf,%edx
+  80096a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80096f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800974:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800977:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80097e:	8b 40 48             	mov    0x48(%eax),%eax
+  800981:	83 ec 04             	sub    $0x4,%esp
+  800984:	53                   	push   %ebx
+  800985:	50                   	push   %eax
+  800986:	68 f9 3a 80 00       	push   $0x803af9
+  80098b:	e8 25 21 00 00       	call   802ab5 <cprintf>
+		return -E_INVAL;
+  800990:	83 c4 10             	add    $0x10,%esp
+  800993:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800998:	eb bb                	jmp    800955 <read+0x58>
+		return -E_NOT_SUPP;
+  80099a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80099f:	eb b4                	jmp    800955 <read+0x58>
+
+008009a1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	57                   	push   %edi
+  8009a5:	56                   	push   %esi
+  8009a6:	53                   	push   %ebx
+  8009a7:	83 ec 0c             	sub    $0xc,%esp
+  8009aa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009ad:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009b0:	85 f6                	test   %esi,%esi
+  8009b2:	74 30                	je     8009e4 <readn+0x43>
+  8009b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009b9:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009be:	83 ec 04             	sub    $0x4,%esp
+  8009c1:	89 f2                	mov    %esi,%edx
+  8009c3:	29 c2                	sub    %eax,%edx
+  8009c5:	52                   	push   %edx
+  8009c6:	01 f8                	add    %edi,%eax
+  8009c8:	50                   	push   %eax
+  8009c9:	ff 75 08             	push   0x8(%ebp)
+  8009cc:	e8 2c ff ff ff       	call   8008fd <read>
+		if (m < 0)
+  8009d1:	83 c4 10             	add    $0x10,%esp
+  8009d4:	85 c0                	test   %eax,%eax
+  8009d6:	78 15                	js     8009ed <readn+0x4c>
+			return m;
+		if (m == 0)
+  8009d8:	74 11                	je     8009eb <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8009da:	01 c3                	add    %eax,%ebx
+  8009dc:	89 d8                	mov    %ebx,%eax
+  8009de:	39 f3                	cmp    %esi,%ebx
+  8009e0:	72 dc                	jb     8009be <readn+0x1d>
+  8009e2:	eb 09                	jmp    8009ed <readn+0x4c>
+  8009e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e9:	eb 02                	jmp    8009ed <readn+0x4c>
+  8009eb:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8009ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009f0:	5b                   	pop    %ebx
+  8009f1:	5e                   	pop    %esi
+  8009f2:	5f                   	pop    %edi
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+
+008009f5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	56                   	push   %esi
+  8009f9:	53                   	push   %ebx
+  8009fa:	83 ec 18             	sub    $0x18,%esp
+  8009fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a00:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a03:	50                   	push   %eax
+  800a04:	53                   	push   %ebx
+  800a05:	e8 6f fc ff ff       	call   800679 <fd_lookup>
+  800a0a:	83 c4 10             	add    $0x10,%esp
+  800a0d:	85 c0                	test   %eax,%eax
+  800a0f:	78 37                	js     800a48 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a11:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a14:	83 ec 08             	sub    $0x8,%esp
+  800a17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a1a:	50                   	push   %eax
+  800a1b:	ff 36                	push   (%esi)
+  800a1d:	e8 a9 fc ff ff       	call   8006cb <dev_lookup>
+  800a22:	83 c4 10             	add    $0x10,%esp
+  800a25:	85 c0                	test   %eax,%eax
+  800a27:	78 1f                	js     800a48 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a29:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a2d:	74 20                	je     800a4f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a32:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a35:	85 c0                	test   %eax,%eax
+  800a37:	74 54                	je     800a8d <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a39:	83 ec 04             	sub    $0x4,%esp
+  800a3c:	ff 75 10             	push   0x10(%ebp)
+  800a3f:	ff 75 0c             	push   0xc(%ebp)
+  800a42:	56                   	push   %esi
+  800a43:	ff d0                	call   *%eax
+  800a45:	83 c4 10             	add    $0x10,%esp
+}
+  800a48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a4b:	5b                   	pop    %ebx
+  800a4c:	5e                   	pop    %esi
+  800a4d:	5d                   	pop    %ebp
+  800a4e:	c3                   	ret
+  800a4f:	89 e2                	mov    %esp,%edx
+  800a51:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a56:	29 d0                	sub    %edx,%eax
+  800a58:	89 c2                	mov    %eax,%edx
+  800a5a:	c1 ea 0f             	shr    $0xf,%edx
+  800a5d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a67:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a6a:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a71:	8b 40 48             	mov    0x48(%eax),%eax
+  800a74:	83 ec 04             	sub    $0x4,%esp
+  800a77:	53                   	push   %ebx
+  800a78:	50                   	push   %eax
+  800a79:	68 15 3b 80 00       	push   $0x803b15
+  800a7e:	e8 32 20 00 00       	call   802ab5 <cprintf>
+		return -E_INVAL;
+  800a83:	83 c4 10             	add    $0x10,%esp
+  800a86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a8b:	eb bb                	jmp    800a48 <write+0x53>
+		return -E_NOT_SUPP;
+  800a8d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a92:	eb b4                	jmp    800a48 <write+0x53>
+
+00800a94 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a9d:	50                   	push   %eax
+  800a9e:	ff 75 08             	push   0x8(%ebp)
+  800aa1:	e8 d3 fb ff ff       	call   800679 <fd_lookup>
+  800aa6:	83 c4 10             	add    $0x10,%esp
+  800aa9:	85 c0                	test   %eax,%eax
+  800aab:	78 0e                	js     800abb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800aad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ab3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+
+00800abd <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	53                   	push   %ebx
+  800ac1:	83 ec 1c             	sub    $0x1c,%esp
+  800ac4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ac7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aca:	50                   	push   %eax
+  800acb:	ff 75 08             	push   0x8(%ebp)
+  800ace:	e8 a6 fb ff ff       	call   800679 <fd_lookup>
+  800ad3:	83 c4 10             	add    $0x10,%esp
+  800ad6:	85 c0                	test   %eax,%eax
+  800ad8:	78 33                	js     800b0d <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800ada:	83 fb 03             	cmp    $0x3,%ebx
+  800add:	74 28                	je     800b07 <fcntl+0x4a>
+  800adf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae4:	83 fb 04             	cmp    $0x4,%ebx
+  800ae7:	75 24                	jne    800b0d <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800ae9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800aec:	8b 41 08             	mov    0x8(%ecx),%eax
+  800aef:	80 e4 ef             	and    $0xef,%ah
+  800af2:	8b 55 10             	mov    0x10(%ebp),%edx
+  800af5:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800afb:	09 d0                	or     %edx,%eax
+  800afd:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b05:	eb 06                	jmp    800b0d <fcntl+0x50>
+		return fd->fd_omode;
+  800b07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0a:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b10:	c9                   	leave
+  800b11:	c3                   	ret
+
+00800b12 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+  800b17:	83 ec 18             	sub    $0x18,%esp
+  800b1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b20:	50                   	push   %eax
+  800b21:	53                   	push   %ebx
+  800b22:	e8 52 fb ff ff       	call   800679 <fd_lookup>
+  800b27:	83 c4 10             	add    $0x10,%esp
+  800b2a:	85 c0                	test   %eax,%eax
+  800b2c:	78 34                	js     800b62 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b2e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b31:	83 ec 08             	sub    $0x8,%esp
+  800b34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b37:	50                   	push   %eax
+  800b38:	ff 36                	push   (%esi)
+  800b3a:	e8 8c fb ff ff       	call   8006cb <dev_lookup>
+  800b3f:	83 c4 10             	add    $0x10,%esp
+  800b42:	85 c0                	test   %eax,%eax
+  800b44:	78 1c                	js     800b62 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b46:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b4a:	74 1d                	je     800b69 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4f:	8b 40 18             	mov    0x18(%eax),%eax
+  800b52:	85 c0                	test   %eax,%eax
+  800b54:	74 51                	je     800ba7 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b56:	83 ec 08             	sub    $0x8,%esp
+  800b59:	ff 75 0c             	push   0xc(%ebp)
+  800b5c:	56                   	push   %esi
+  800b5d:	ff d0                	call   *%eax
+  800b5f:	83 c4 10             	add    $0x10,%esp
+}
+  800b62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b65:	5b                   	pop    %ebx
+  800b66:	5e                   	pop    %esi
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+  800b69:	89 e2                	mov    %esp,%edx
+  800b6b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b70:	29 d0                	sub    %edx,%eax
+  800b72:	89 c2                	mov    %eax,%edx
+  800b74:	c1 ea 0f             	shr    $0xf,%edx
+  800b77:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b81:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800b84:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800b8b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b8e:	83 ec 04             	sub    $0x4,%esp
+  800b91:	53                   	push   %ebx
+  800b92:	50                   	push   %eax
+  800b93:	68 d8 3a 80 00       	push   $0x803ad8
+  800b98:	e8 18 1f 00 00       	call   802ab5 <cprintf>
+		return -E_INVAL;
+  800b9d:	83 c4 10             	add    $0x10,%esp
+  800ba0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba5:	eb bb                	jmp    800b62 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ba7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bac:	eb b4                	jmp    800b62 <ftruncate+0x50>
+
+00800bae <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	56                   	push   %esi
+  800bb2:	53                   	push   %ebx
+  800bb3:	83 ec 18             	sub    $0x18,%esp
+  800bb6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bb9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bbc:	50                   	push   %eax
+  800bbd:	ff 75 08             	push   0x8(%ebp)
+  800bc0:	e8 b4 fa ff ff       	call   800679 <fd_lookup>
+  800bc5:	83 c4 10             	add    $0x10,%esp
+  800bc8:	85 c0                	test   %eax,%eax
+  800bca:	78 53                	js     800c1f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bcc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bcf:	83 ec 08             	sub    $0x8,%esp
+  800bd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bd5:	50                   	push   %eax
+  800bd6:	ff 36                	push   (%esi)
+  800bd8:	e8 ee fa ff ff       	call   8006cb <dev_lookup>
+  800bdd:	83 c4 10             	add    $0x10,%esp
+  800be0:	85 c0                	test   %eax,%eax
+  800be2:	78 3b                	js     800c1f <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800be4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800be7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800beb:	74 39                	je     800c26 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800bed:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800bf0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bf7:	00 00 00 
+	stat->st_isdir = 0;
+  800bfa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c01:	00 00 00 
+	stat->st_version = 0;
+  800c04:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c0b:	00 00 00 
+	stat->st_dev = dev;
+  800c0e:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c14:	83 ec 08             	sub    $0x8,%esp
+  800c17:	53                   	push   %ebx
+  800c18:	56                   	push   %esi
+  800c19:	ff 50 14             	call   *0x14(%eax)
+  800c1c:	83 c4 10             	add    $0x10,%esp
+}
+  800c1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c22:	5b                   	pop    %ebx
+  800c23:	5e                   	pop    %esi
+  800c24:	5d                   	pop    %ebp
+  800c25:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c26:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c2b:	eb f2                	jmp    800c1f <fstat+0x71>
+
+00800c2d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	56                   	push   %esi
+  800c31:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c32:	83 ec 08             	sub    $0x8,%esp
+  800c35:	6a 00                	push   $0x0
+  800c37:	ff 75 08             	push   0x8(%ebp)
+  800c3a:	e8 b7 01 00 00       	call   800df6 <open>
+  800c3f:	89 c3                	mov    %eax,%ebx
+  800c41:	83 c4 10             	add    $0x10,%esp
+  800c44:	85 c0                	test   %eax,%eax
+  800c46:	78 1b                	js     800c63 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c48:	83 ec 08             	sub    $0x8,%esp
+  800c4b:	ff 75 0c             	push   0xc(%ebp)
+  800c4e:	50                   	push   %eax
+  800c4f:	e8 5a ff ff ff       	call   800bae <fstat>
+  800c54:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c56:	89 1c 24             	mov    %ebx,(%esp)
+  800c59:	e8 60 fb ff ff       	call   8007be <close>
+	return r;
+  800c5e:	83 c4 10             	add    $0x10,%esp
+  800c61:	89 f3                	mov    %esi,%ebx
+}
+  800c63:	89 d8                	mov    %ebx,%eax
+  800c65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5d                   	pop    %ebp
+  800c6b:	c3                   	ret
+
+00800c6c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	56                   	push   %esi
+  800c70:	53                   	push   %ebx
+  800c71:	89 c6                	mov    %eax,%esi
+  800c73:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800c75:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800c7c:	74 27                	je     800ca5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800c7e:	6a 07                	push   $0x7
+  800c80:	68 00 60 80 00       	push   $0x806000
+  800c85:	56                   	push   %esi
+  800c86:	ff 35 00 50 80 00    	push   0x805000
+  800c8c:	e8 23 2b 00 00       	call   8037b4 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800c91:	83 c4 0c             	add    $0xc,%esp
+  800c94:	6a 00                	push   $0x0
+  800c96:	53                   	push   %ebx
+  800c97:	6a 00                	push   $0x0
+  800c99:	e8 86 28 00 00       	call   803524 <ipc_recv>
+}
+  800c9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca1:	5b                   	pop    %ebx
+  800ca2:	5e                   	pop    %esi
+  800ca3:	5d                   	pop    %ebp
+  800ca4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+  800ca8:	6a 02                	push   $0x2
+  800caa:	e8 6e 2b 00 00       	call   80381d <ipc_find_env>
+  800caf:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cb4:	83 c4 10             	add    $0x10,%esp
+  800cb7:	eb c5                	jmp    800c7e <fsipc+0x12>
+
+00800cb9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc2:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cc5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ccd:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800cd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cdc:	e8 8b ff ff ff       	call   800c6c <fsipc>
+}
+  800ce1:	c9                   	leave
+  800ce2:	c3                   	ret
+
+00800ce3 <devfile_flush>:
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cec:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cef:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cfe:	e8 69 ff ff ff       	call   800c6c <fsipc>
+}
+  800d03:	c9                   	leave
+  800d04:	c3                   	ret
+
+00800d05 <devfile_stat>:
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	53                   	push   %ebx
+  800d09:	83 ec 04             	sub    $0x4,%esp
+  800d0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d12:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d15:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d24:	e8 43 ff ff ff       	call   800c6c <fsipc>
+  800d29:	85 c0                	test   %eax,%eax
+  800d2b:	78 37                	js     800d64 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d2d:	83 ec 08             	sub    $0x8,%esp
+  800d30:	68 00 60 80 00       	push   $0x806000
+  800d35:	53                   	push   %ebx
+  800d36:	e8 71 24 00 00       	call   8031ac <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d3b:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d40:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d46:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d4b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d51:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d56:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d5c:	83 c4 10             	add    $0x10,%esp
+  800d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d67:	c9                   	leave
+  800d68:	c3                   	ret
+
+00800d69 <devfile_write>:
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	83 ec 0c             	sub    $0xc,%esp
+  800d6f:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d72:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800d77:	39 d0                	cmp    %edx,%eax
+  800d79:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 52 0c             	mov    0xc(%edx),%edx
+  800d82:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800d88:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800d8d:	50                   	push   %eax
+  800d8e:	ff 75 0c             	push   0xc(%ebp)
+  800d91:	68 08 60 80 00       	push   $0x806008
+  800d96:	e8 c1 25 00 00       	call   80335c <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800d9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da5:	e8 c2 fe ff ff       	call   800c6c <fsipc>
+}
+  800daa:	c9                   	leave
+  800dab:	c3                   	ret
+
+00800dac <devfile_read>:
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	53                   	push   %ebx
+  800db0:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800db3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800dbe:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dc1:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800dc6:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800dcb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd0:	e8 97 fe ff ff       	call   800c6c <fsipc>
+  800dd5:	89 c3                	mov    %eax,%ebx
+  800dd7:	85 c0                	test   %eax,%eax
+  800dd9:	78 14                	js     800def <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800ddb:	83 ec 04             	sub    $0x4,%esp
+  800dde:	50                   	push   %eax
+  800ddf:	68 00 60 80 00       	push   $0x806000
+  800de4:	ff 75 0c             	push   0xc(%ebp)
+  800de7:	e8 70 25 00 00       	call   80335c <memmove>
+	return r;
+  800dec:	83 c4 10             	add    $0x10,%esp
+}
+  800def:	89 d8                	mov    %ebx,%eax
+  800df1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800df4:	c9                   	leave
+  800df5:	c3                   	ret
+
+00800df6 <open>:
+{
+  800df6:	55                   	push   %ebp
+  800df7:	89 e5                	mov    %esp,%ebp
+  800df9:	53                   	push   %ebx
+  800dfa:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800dfd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e00:	50                   	push   %eax
+  800e01:	e8 23 f8 ff ff       	call   800629 <fd_alloc>
+  800e06:	89 c3                	mov    %eax,%ebx
+  800e08:	83 c4 10             	add    $0x10,%esp
+  800e0b:	85 c0                	test   %eax,%eax
+  800e0d:	78 2a                	js     800e39 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e0f:	83 ec 0c             	sub    $0xc,%esp
+  800e12:	ff 75 08             	push   0x8(%ebp)
+  800e15:	e8 46 23 00 00       	call   803160 <strlen>
+  800e1a:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e1d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e22:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e27:	7e 17                	jle    800e40 <open+0x4a>
+	fd_close(fd, 1);
+  800e29:	83 ec 08             	sub    $0x8,%esp
+  800e2c:	6a 01                	push   $0x1
+  800e2e:	ff 75 f4             	push   -0xc(%ebp)
+  800e31:	e8 08 f9 ff ff       	call   80073e <fd_close>
+	return r;
+  800e36:	83 c4 10             	add    $0x10,%esp
+}
+  800e39:	89 d8                	mov    %ebx,%eax
+  800e3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e3e:	c9                   	leave
+  800e3f:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e40:	83 ec 08             	sub    $0x8,%esp
+  800e43:	ff 75 08             	push   0x8(%ebp)
+  800e46:	68 00 60 80 00       	push   $0x806000
+  800e4b:	e8 5c 23 00 00       	call   8031ac <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e50:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e53:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e58:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e60:	e8 07 fe ff ff       	call   800c6c <fsipc>
+  800e65:	89 c3                	mov    %eax,%ebx
+  800e67:	83 c4 10             	add    $0x10,%esp
+  800e6a:	85 c0                	test   %eax,%eax
+  800e6c:	78 bb                	js     800e29 <open+0x33>
+	return fd2num(fd); 	
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+  800e71:	ff 75 f4             	push   -0xc(%ebp)
+  800e74:	e8 89 f7 ff ff       	call   800602 <fd2num>
+  800e79:	89 c3                	mov    %eax,%ebx
+  800e7b:	83 c4 10             	add    $0x10,%esp
+  800e7e:	eb b9                	jmp    800e39 <open+0x43>
+
+00800e80 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800e80:	55                   	push   %ebp
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	53                   	push   %ebx
+  800e84:	83 ec 1c             	sub    $0x1c,%esp
+  800e87:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e8d:	50                   	push   %eax
+  800e8e:	ff 75 08             	push   0x8(%ebp)
+  800e91:	e8 e3 f7 ff ff       	call   800679 <fd_lookup>
+  800e96:	83 c4 10             	add    $0x10,%esp
+  800e99:	85 c0                	test   %eax,%eax
+  800e9b:	78 5a                	js     800ef7 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea0:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800ea6:	39 10                	cmp    %edx,(%eax)
+  800ea8:	75 66                	jne    800f10 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800eaa:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800eb1:	74 49                	je     800efc <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800eb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800eb9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800ebe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ec1:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800ec6:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ecc:	6a 07                	push   $0x7
+  800ece:	68 00 60 80 00       	push   $0x806000
+  800ed3:	6a 09                	push   $0x9
+  800ed5:	ff 35 00 50 80 00    	push   0x805000
+  800edb:	e8 d4 28 00 00       	call   8037b4 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800ee0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800ee7:	6a 00                	push   $0x0
+  800ee9:	53                   	push   %ebx
+  800eea:	ff 75 10             	push   0x10(%ebp)
+  800eed:	6a 00                	push   $0x0
+  800eef:	e8 fd 26 00 00       	call   8035f1 <ipc_recv_pages>
+  800ef4:	83 c4 20             	add    $0x20,%esp
+}
+  800ef7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800efa:	c9                   	leave
+  800efb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	6a 02                	push   $0x2
+  800f01:	e8 17 29 00 00       	call   80381d <ipc_find_env>
+  800f06:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f0b:	83 c4 10             	add    $0x10,%esp
+  800f0e:	eb a3                	jmp    800eb3 <fmap+0x33>
+		return -E_INVAL;
+  800f10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f15:	eb e0                	jmp    800ef7 <fmap+0x77>
+
+00800f17 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	53                   	push   %ebx
+  800f1b:	83 ec 10             	sub    $0x10,%esp
+  800f1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f21:	53                   	push   %ebx
+  800f22:	e8 39 22 00 00       	call   803160 <strlen>
+  800f27:	83 c4 10             	add    $0x10,%esp
+  800f2a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f2f:	7f 25                	jg     800f56 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f31:	83 ec 08             	sub    $0x8,%esp
+  800f34:	53                   	push   %ebx
+  800f35:	68 00 60 80 00       	push   $0x806000
+  800f3a:	e8 6d 22 00 00       	call   8031ac <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f44:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f49:	e8 1e fd ff ff       	call   800c6c <fsipc>
+  800f4e:	83 c4 10             	add    $0x10,%esp
+}
+  800f51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f54:	c9                   	leave
+  800f55:	c3                   	ret
+		return -E_BAD_PATH;
+  800f56:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f5b:	eb f4                	jmp    800f51 <remove+0x3a>
+
+00800f5d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f68:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f6d:	e8 fa fc ff ff       	call   800c6c <fsipc>
+}
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+
+00800f74 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800f7a:	68 48 3b 80 00       	push   $0x803b48
+  800f7f:	ff 75 0c             	push   0xc(%ebp)
+  800f82:	e8 25 22 00 00       	call   8031ac <strcpy>
+	return 0;
+}
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8c:	c9                   	leave
+  800f8d:	c3                   	ret
+
+00800f8e <devsock_close>:
+{
+  800f8e:	55                   	push   %ebp
+  800f8f:	89 e5                	mov    %esp,%ebp
+  800f91:	53                   	push   %ebx
+  800f92:	83 ec 10             	sub    $0x10,%esp
+  800f95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800f98:	53                   	push   %ebx
+  800f99:	e8 be 28 00 00       	call   80385c <pageref>
+  800f9e:	89 c2                	mov    %eax,%edx
+  800fa0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fa8:	83 fa 01             	cmp    $0x1,%edx
+  800fab:	74 05                	je     800fb2 <devsock_close+0x24>
+}
+  800fad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fb0:	c9                   	leave
+  800fb1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+  800fb5:	ff 73 0c             	push   0xc(%ebx)
+  800fb8:	e8 b0 05 00 00       	call   80156d <nsipc_close>
+  800fbd:	83 c4 10             	add    $0x10,%esp
+  800fc0:	eb eb                	jmp    800fad <devsock_close+0x1f>
+
+00800fc2 <devsock_write>:
+{
+  800fc2:	55                   	push   %ebp
+  800fc3:	89 e5                	mov    %esp,%ebp
+  800fc5:	53                   	push   %ebx
+  800fc6:	83 ec 14             	sub    $0x14,%esp
+  800fc9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fcc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fcf:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800fd2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  800fd5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  800fd8:	8b 41 08             	mov    0x8(%ecx),%eax
+  800fdb:	c1 f8 09             	sar    $0x9,%eax
+  800fde:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  800fe1:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  800fe7:	77 13                	ja     800ffc <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  800fe9:	50                   	push   %eax
+  800fea:	52                   	push   %edx
+  800feb:	53                   	push   %ebx
+  800fec:	ff 71 0c             	push   0xc(%ecx)
+  800fef:	e8 5c 06 00 00       	call   801650 <nsipc_send>
+  800ff4:	83 c4 10             	add    $0x10,%esp
+}
+  800ff7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ffa:	c9                   	leave
+  800ffb:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  800ffc:	50                   	push   %eax
+  800ffd:	6a 01                	push   $0x1
+  800fff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801002:	50                   	push   %eax
+  801003:	ff 71 0c             	push   0xc(%ecx)
+  801006:	e8 a6 06 00 00       	call   8016b1 <nsipc_sendmsg>
+  80100b:	83 c4 10             	add    $0x10,%esp
+  80100e:	eb e7                	jmp    800ff7 <devsock_write+0x35>
+
+00801010 <devsock_read>:
+{
+  801010:	55                   	push   %ebp
+  801011:	89 e5                	mov    %esp,%ebp
+  801013:	53                   	push   %ebx
+  801014:	83 ec 14             	sub    $0x14,%esp
+  801017:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80101a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80101d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801020:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801023:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801026:	8b 41 08             	mov    0x8(%ecx),%eax
+  801029:	c1 f8 09             	sar    $0x9,%eax
+  80102c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80102f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801035:	77 13                	ja     80104a <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801037:	50                   	push   %eax
+  801038:	52                   	push   %edx
+  801039:	53                   	push   %ebx
+  80103a:	ff 71 0c             	push   0xc(%ecx)
+  80103d:	e8 9c 05 00 00       	call   8015de <nsipc_recv>
+  801042:	83 c4 10             	add    $0x10,%esp
+}
+  801045:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801048:	c9                   	leave
+  801049:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80104a:	50                   	push   %eax
+  80104b:	6a 01                	push   $0x1
+  80104d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801050:	50                   	push   %eax
+  801051:	ff 71 0c             	push   0xc(%ecx)
+  801054:	e8 02 0a 00 00       	call   801a5b <nsipc_recvmsg>
+  801059:	83 c4 10             	add    $0x10,%esp
+  80105c:	eb e7                	jmp    801045 <devsock_read+0x35>
+
+0080105e <fd2sockid>:
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801064:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801067:	52                   	push   %edx
+  801068:	50                   	push   %eax
+  801069:	e8 0b f6 ff ff       	call   800679 <fd_lookup>
+  80106e:	83 c4 10             	add    $0x10,%esp
+  801071:	85 c0                	test   %eax,%eax
+  801073:	78 10                	js     801085 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801075:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801078:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80107e:	39 08                	cmp    %ecx,(%eax)
+  801080:	75 05                	jne    801087 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801082:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801085:	c9                   	leave
+  801086:	c3                   	ret
+		return -E_NOT_SUPP;
+  801087:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80108c:	eb f7                	jmp    801085 <fd2sockid+0x27>
+
+0080108e <sock_flags>:
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801094:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801097:	52                   	push   %edx
+  801098:	50                   	push   %eax
+  801099:	e8 db f5 ff ff       	call   800679 <fd_lookup>
+  80109e:	83 c4 10             	add    $0x10,%esp
+  8010a1:	85 c0                	test   %eax,%eax
+  8010a3:	78 0e                	js     8010b3 <sock_flags+0x25>
+  8010a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a8:	8b 40 08             	mov    0x8(%eax),%eax
+  8010ab:	c1 e8 09             	shr    $0x9,%eax
+  8010ae:	83 e0 08             	and    $0x8,%eax
+}
+  8010b1:	c9                   	leave
+  8010b2:	c3                   	ret
+		return 0;
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b8:	eb f7                	jmp    8010b1 <sock_flags+0x23>
+
+008010ba <alloc_sockfd>:
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+  8010bf:	83 ec 1c             	sub    $0x1c,%esp
+  8010c2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010c7:	50                   	push   %eax
+  8010c8:	e8 5c f5 ff ff       	call   800629 <fd_alloc>
+  8010cd:	89 c3                	mov    %eax,%ebx
+  8010cf:	83 c4 10             	add    $0x10,%esp
+  8010d2:	85 c0                	test   %eax,%eax
+  8010d4:	78 43                	js     801119 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010d6:	83 ec 04             	sub    $0x4,%esp
+  8010d9:	68 07 04 00 00       	push   $0x407
+  8010de:	ff 75 f4             	push   -0xc(%ebp)
+  8010e1:	6a 00                	push   $0x0
+  8010e3:	e8 b7 f0 ff ff       	call   80019f <sys_page_alloc>
+  8010e8:	89 c3                	mov    %eax,%ebx
+  8010ea:	83 c4 10             	add    $0x10,%esp
+  8010ed:	85 c0                	test   %eax,%eax
+  8010ef:	78 28                	js     801119 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8010f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010f4:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8010fa:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8010fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010ff:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801106:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801109:	83 ec 0c             	sub    $0xc,%esp
+  80110c:	50                   	push   %eax
+  80110d:	e8 f0 f4 ff ff       	call   800602 <fd2num>
+  801112:	89 c3                	mov    %eax,%ebx
+  801114:	83 c4 10             	add    $0x10,%esp
+  801117:	eb 0c                	jmp    801125 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	56                   	push   %esi
+  80111d:	e8 4b 04 00 00       	call   80156d <nsipc_close>
+		return r;
+  801122:	83 c4 10             	add    $0x10,%esp
+}
+  801125:	89 d8                	mov    %ebx,%eax
+  801127:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80112a:	5b                   	pop    %ebx
+  80112b:	5e                   	pop    %esi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+
+0080112e <accept>:
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+  801133:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801136:	89 f0                	mov    %esi,%eax
+  801138:	e8 21 ff ff ff       	call   80105e <fd2sockid>
+  80113d:	89 c3                	mov    %eax,%ebx
+  80113f:	85 c0                	test   %eax,%eax
+  801141:	78 24                	js     801167 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801143:	89 f0                	mov    %esi,%eax
+  801145:	e8 44 ff ff ff       	call   80108e <sock_flags>
+  80114a:	50                   	push   %eax
+  80114b:	ff 75 10             	push   0x10(%ebp)
+  80114e:	ff 75 0c             	push   0xc(%ebp)
+  801151:	53                   	push   %ebx
+  801152:	e8 6b 03 00 00       	call   8014c2 <nsipc_accept>
+  801157:	89 c3                	mov    %eax,%ebx
+  801159:	83 c4 10             	add    $0x10,%esp
+  80115c:	85 c0                	test   %eax,%eax
+  80115e:	78 07                	js     801167 <accept+0x39>
+	return alloc_sockfd(r);
+  801160:	e8 55 ff ff ff       	call   8010ba <alloc_sockfd>
+  801165:	89 c3                	mov    %eax,%ebx
+}
+  801167:	89 d8                	mov    %ebx,%eax
+  801169:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80116c:	5b                   	pop    %ebx
+  80116d:	5e                   	pop    %esi
+  80116e:	5d                   	pop    %ebp
+  80116f:	c3                   	ret
+
+00801170 <bind>:
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801176:	8b 45 08             	mov    0x8(%ebp),%eax
+  801179:	e8 e0 fe ff ff       	call   80105e <fd2sockid>
+  80117e:	85 c0                	test   %eax,%eax
+  801180:	78 12                	js     801194 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801182:	83 ec 04             	sub    $0x4,%esp
+  801185:	ff 75 10             	push   0x10(%ebp)
+  801188:	ff 75 0c             	push   0xc(%ebp)
+  80118b:	50                   	push   %eax
+  80118c:	e8 85 03 00 00       	call   801516 <nsipc_bind>
+  801191:	83 c4 10             	add    $0x10,%esp
+}
+  801194:	c9                   	leave
+  801195:	c3                   	ret
+
+00801196 <shutdown>:
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+  801199:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80119c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80119f:	e8 ba fe ff ff       	call   80105e <fd2sockid>
+  8011a4:	85 c0                	test   %eax,%eax
+  8011a6:	78 0f                	js     8011b7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011a8:	83 ec 08             	sub    $0x8,%esp
+  8011ab:	ff 75 0c             	push   0xc(%ebp)
+  8011ae:	50                   	push   %eax
+  8011af:	e8 97 03 00 00       	call   80154b <nsipc_shutdown>
+  8011b4:	83 c4 10             	add    $0x10,%esp
+}
+  8011b7:	c9                   	leave
+  8011b8:	c3                   	ret
+
+008011b9 <connect>:
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c2:	e8 97 fe ff ff       	call   80105e <fd2sockid>
+  8011c7:	85 c0                	test   %eax,%eax
+  8011c9:	78 12                	js     8011dd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011cb:	83 ec 04             	sub    $0x4,%esp
+  8011ce:	ff 75 10             	push   0x10(%ebp)
+  8011d1:	ff 75 0c             	push   0xc(%ebp)
+  8011d4:	50                   	push   %eax
+  8011d5:	e8 ad 03 00 00       	call   801587 <nsipc_connect>
+  8011da:	83 c4 10             	add    $0x10,%esp
+}
+  8011dd:	c9                   	leave
+  8011de:	c3                   	ret
+
+008011df <listen>:
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e8:	e8 71 fe ff ff       	call   80105e <fd2sockid>
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	78 0f                	js     801200 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8011f1:	83 ec 08             	sub    $0x8,%esp
+  8011f4:	ff 75 0c             	push   0xc(%ebp)
+  8011f7:	50                   	push   %eax
+  8011f8:	e8 bf 03 00 00       	call   8015bc <nsipc_listen>
+  8011fd:	83 c4 10             	add    $0x10,%esp
+}
+  801200:	c9                   	leave
+  801201:	c3                   	ret
+
+00801202 <sendmsg>:
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	56                   	push   %esi
+  801207:	53                   	push   %ebx
+  801208:	83 ec 0c             	sub    $0xc,%esp
+  80120b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80120e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801211:	89 f0                	mov    %esi,%eax
+  801213:	e8 46 fe ff ff       	call   80105e <fd2sockid>
+  801218:	89 c3                	mov    %eax,%ebx
+  80121a:	85 c0                	test   %eax,%eax
+  80121c:	78 1c                	js     80123a <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80121e:	89 f0                	mov    %esi,%eax
+  801220:	e8 69 fe ff ff       	call   80108e <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801225:	0b 45 10             	or     0x10(%ebp),%eax
+  801228:	50                   	push   %eax
+  801229:	ff 77 0c             	push   0xc(%edi)
+  80122c:	ff 77 08             	push   0x8(%edi)
+  80122f:	53                   	push   %ebx
+  801230:	e8 7c 04 00 00       	call   8016b1 <nsipc_sendmsg>
+  801235:	89 c3                	mov    %eax,%ebx
+  801237:	83 c4 10             	add    $0x10,%esp
+}
+  80123a:	89 d8                	mov    %ebx,%eax
+  80123c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123f:	5b                   	pop    %ebx
+  801240:	5e                   	pop    %esi
+  801241:	5f                   	pop    %edi
+  801242:	5d                   	pop    %ebp
+  801243:	c3                   	ret
+
+00801244 <recvmsg>:
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	57                   	push   %edi
+  801248:	56                   	push   %esi
+  801249:	53                   	push   %ebx
+  80124a:	83 ec 0c             	sub    $0xc,%esp
+  80124d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801250:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801253:	89 f8                	mov    %edi,%eax
+  801255:	e8 04 fe ff ff       	call   80105e <fd2sockid>
+  80125a:	89 c3                	mov    %eax,%ebx
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	78 2a                	js     80128a <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801260:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801267:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80126e:	89 f8                	mov    %edi,%eax
+  801270:	e8 19 fe ff ff       	call   80108e <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801275:	0b 45 10             	or     0x10(%ebp),%eax
+  801278:	50                   	push   %eax
+  801279:	ff 76 0c             	push   0xc(%esi)
+  80127c:	ff 76 08             	push   0x8(%esi)
+  80127f:	53                   	push   %ebx
+  801280:	e8 d6 07 00 00       	call   801a5b <nsipc_recvmsg>
+  801285:	89 c3                	mov    %eax,%ebx
+  801287:	83 c4 10             	add    $0x10,%esp
+}
+  80128a:	89 d8                	mov    %ebx,%eax
+  80128c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5f                   	pop    %edi
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+
+00801294 <sendfile>:
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	56                   	push   %esi
+  801298:	53                   	push   %ebx
+  801299:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80129c:	89 f0                	mov    %esi,%eax
+  80129e:	e8 bb fd ff ff       	call   80105e <fd2sockid>
+  8012a3:	89 c3                	mov    %eax,%ebx
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 1f                	js     8012c8 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012a9:	89 f0                	mov    %esi,%eax
+  8012ab:	e8 de fd ff ff       	call   80108e <sock_flags>
+  8012b0:	83 ec 0c             	sub    $0xc,%esp
+  8012b3:	50                   	push   %eax
+  8012b4:	ff 75 14             	push   0x14(%ebp)
+  8012b7:	ff 75 10             	push   0x10(%ebp)
+  8012ba:	ff 75 0c             	push   0xc(%ebp)
+  8012bd:	53                   	push   %ebx
+  8012be:	e8 64 06 00 00       	call   801927 <nsipc_sendfile>
+  8012c3:	89 c3                	mov    %eax,%ebx
+  8012c5:	83 c4 20             	add    $0x20,%esp
+}
+  8012c8:	89 d8                	mov    %ebx,%eax
+  8012ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012cd:	5b                   	pop    %ebx
+  8012ce:	5e                   	pop    %esi
+  8012cf:	5d                   	pop    %ebp
+  8012d0:	c3                   	ret
+
+008012d1 <evctl>:
+{
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	53                   	push   %ebx
+  8012d5:	83 ec 04             	sub    $0x4,%esp
+  8012d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8012db:	89 d8                	mov    %ebx,%eax
+  8012dd:	e8 7c fd ff ff       	call   80105e <fd2sockid>
+  8012e2:	85 c0                	test   %eax,%eax
+  8012e4:	78 10                	js     8012f6 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8012e6:	83 ec 04             	sub    $0x4,%esp
+  8012e9:	53                   	push   %ebx
+  8012ea:	ff 75 0c             	push   0xc(%ebp)
+  8012ed:	50                   	push   %eax
+  8012ee:	e8 d2 0b 00 00       	call   801ec5 <nsipc_evctl>
+  8012f3:	83 c4 10             	add    $0x10,%esp
+}
+  8012f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f9:	c9                   	leave
+  8012fa:	c3                   	ret
+
+008012fb <evwait>:
+{
+  8012fb:	55                   	push   %ebp
+  8012fc:	89 e5                	mov    %esp,%ebp
+  8012fe:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801301:	ff 75 10             	push   0x10(%ebp)
+  801304:	ff 75 0c             	push   0xc(%ebp)
+  801307:	ff 75 08             	push   0x8(%ebp)
+  80130a:	e8 e0 0b 00 00       	call   801eef <nsipc_evwait>
+}
+  80130f:	c9                   	leave
+  801310:	c3                   	ret
+
+00801311 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801317:	ff 75 10             	push   0x10(%ebp)
+  80131a:	ff 75 0c             	push   0xc(%ebp)
+  80131d:	ff 75 08             	push   0x8(%ebp)
+  801320:	e8 31 0c 00 00       	call   801f56 <nsipc_socket>
+  801325:	83 c4 10             	add    $0x10,%esp
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	78 05                	js     801331 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80132c:	e8 89 fd ff ff       	call   8010ba <alloc_sockfd>
+}
+  801331:	c9                   	leave
+  801332:	c3                   	ret
+
+00801333 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	53                   	push   %ebx
+  801337:	83 ec 04             	sub    $0x4,%esp
+  80133a:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80133c:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801343:	74 26                	je     80136b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801345:	6a 07                	push   $0x7
+  801347:	68 00 70 80 00       	push   $0x807000
+  80134c:	53                   	push   %ebx
+  80134d:	ff 35 24 53 80 00    	push   0x805324
+  801353:	e8 5c 24 00 00       	call   8037b4 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801358:	83 c4 0c             	add    $0xc,%esp
+  80135b:	6a 00                	push   $0x0
+  80135d:	6a 00                	push   $0x0
+  80135f:	6a 00                	push   $0x0
+  801361:	e8 be 21 00 00       	call   803524 <ipc_recv>
+}
+  801366:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801369:	c9                   	leave
+  80136a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80136b:	83 ec 0c             	sub    $0xc,%esp
+  80136e:	6a 03                	push   $0x3
+  801370:	e8 a8 24 00 00       	call   80381d <ipc_find_env>
+  801375:	a3 24 53 80 00       	mov    %eax,0x805324
+  80137a:	83 c4 10             	add    $0x10,%esp
+  80137d:	eb c6                	jmp    801345 <nsipc+0x12>
+
+0080137f <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	56                   	push   %esi
+  801383:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801384:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  80138a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80138f:	85 f6                	test   %esi,%esi
+  801391:	75 33                	jne    8013c6 <nsbulk_map+0x47>
+  801393:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801398:	83 ec 04             	sub    $0x4,%esp
+  80139b:	6a 07                	push   $0x7
+  80139d:	53                   	push   %ebx
+  80139e:	6a 00                	push   $0x0
+  8013a0:	e8 fa ed ff ff       	call   80019f <sys_page_alloc>
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	78 1a                	js     8013c6 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013ac:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013b2:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013b8:	75 de                	jne    801398 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013ba:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013c1:	00 00 00 
+	return 0;
+  8013c4:	89 f0                	mov    %esi,%eax
+}
+  8013c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c9:	5b                   	pop    %ebx
+  8013ca:	5e                   	pop    %esi
+  8013cb:	5d                   	pop    %ebp
+  8013cc:	c3                   	ret
+
+008013cd <nsbulk_own>:
+{
+  8013cd:	55                   	push   %ebp
+  8013ce:	89 e5                	mov    %esp,%ebp
+  8013d0:	57                   	push   %edi
+  8013d1:	56                   	push   %esi
+  8013d2:	53                   	push   %ebx
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8013d8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8013db:	85 d2                	test   %edx,%edx
+  8013dd:	7f 0e                	jg     8013ed <nsbulk_own+0x20>
+	return 0;
+  8013df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e4:	eb 47                	jmp    80142d <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8013e6:	83 c3 01             	add    $0x1,%ebx
+  8013e9:	39 fb                	cmp    %edi,%ebx
+  8013eb:	7d 3b                	jge    801428 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8013ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8013f2:	89 d9                	mov    %ebx,%ecx
+  8013f4:	d3 e6                	shl    %cl,%esi
+  8013f6:	89 f0                	mov    %esi,%eax
+  8013f8:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  8013fe:	74 e6                	je     8013e6 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801400:	83 ec 04             	sub    $0x4,%esp
+  801403:	6a 07                	push   $0x7
+  801405:	89 d8                	mov    %ebx,%eax
+  801407:	c1 e0 0c             	shl    $0xc,%eax
+  80140a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80140f:	50                   	push   %eax
+  801410:	6a 00                	push   $0x0
+  801412:	e8 88 ed ff ff       	call   80019f <sys_page_alloc>
+  801417:	83 c4 10             	add    $0x10,%esp
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	78 0f                	js     80142d <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80141e:	f7 d6                	not    %esi
+  801420:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801426:	eb be                	jmp    8013e6 <nsbulk_own+0x19>
+	return 0;
+  801428:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80142d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5f                   	pop    %edi
+  801433:	5d                   	pop    %ebp
+  801434:	c3                   	ret
+
+00801435 <nsipc_bulk>:
+{
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	57                   	push   %edi
+  801439:	56                   	push   %esi
+  80143a:	53                   	push   %ebx
+  80143b:	83 ec 1c             	sub    $0x1c,%esp
+  80143e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801441:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801443:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801449:	c1 fb 0c             	sar    $0xc,%ebx
+  80144c:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80144f:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801456:	74 56                	je     8014ae <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801458:	85 ff                	test   %edi,%edi
+  80145a:	7e 24                	jle    801480 <nsipc_bulk+0x4b>
+  80145c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801462:	74 1c                	je     801480 <nsipc_bulk+0x4b>
+  801464:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80146a:	c1 e3 0c             	shl    $0xc,%ebx
+  80146d:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801472:	0f b6 10             	movzbl (%eax),%edx
+  801475:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801477:	05 00 10 00 00       	add    $0x1000,%eax
+  80147c:	39 d8                	cmp    %ebx,%eax
+  80147e:	75 f2                	jne    801472 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801480:	83 ec 0c             	sub    $0xc,%esp
+  801483:	56                   	push   %esi
+  801484:	57                   	push   %edi
+  801485:	68 00 00 00 e0       	push   $0xe0000000
+  80148a:	ff 75 e4             	push   -0x1c(%ebp)
+  80148d:	ff 35 24 53 80 00    	push   0x805324
+  801493:	e8 50 23 00 00       	call   8037e8 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801498:	83 c4 1c             	add    $0x1c,%esp
+  80149b:	6a 00                	push   $0x0
+  80149d:	6a 00                	push   $0x0
+  80149f:	6a 00                	push   $0x0
+  8014a1:	e8 7e 20 00 00       	call   803524 <ipc_recv>
+}
+  8014a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a9:	5b                   	pop    %ebx
+  8014aa:	5e                   	pop    %esi
+  8014ab:	5f                   	pop    %edi
+  8014ac:	5d                   	pop    %ebp
+  8014ad:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014ae:	83 ec 0c             	sub    $0xc,%esp
+  8014b1:	6a 03                	push   $0x3
+  8014b3:	e8 65 23 00 00       	call   80381d <ipc_find_env>
+  8014b8:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  8014c0:	eb 96                	jmp    801458 <nsipc_bulk+0x23>
+
+008014c2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014c2:	55                   	push   %ebp
+  8014c3:	89 e5                	mov    %esp,%ebp
+  8014c5:	53                   	push   %ebx
+  8014c6:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014cc:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014d4:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8014d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014de:	e8 50 fe ff ff       	call   801333 <nsipc>
+  8014e3:	89 c3                	mov    %eax,%ebx
+  8014e5:	85 c0                	test   %eax,%eax
+  8014e7:	79 07                	jns    8014f0 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8014e9:	89 d8                	mov    %ebx,%eax
+  8014eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ee:	c9                   	leave
+  8014ef:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8014f0:	83 ec 04             	sub    $0x4,%esp
+  8014f3:	ff 35 10 70 80 00    	push   0x807010
+  8014f9:	68 00 70 80 00       	push   $0x807000
+  8014fe:	ff 75 0c             	push   0xc(%ebp)
+  801501:	e8 56 1e 00 00       	call   80335c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801506:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80150c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80150f:	89 10                	mov    %edx,(%eax)
+  801511:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801514:	eb d3                	jmp    8014e9 <nsipc_accept+0x27>
+
+00801516 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	53                   	push   %ebx
+  80151a:	83 ec 08             	sub    $0x8,%esp
+  80151d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801520:	8b 45 08             	mov    0x8(%ebp),%eax
+  801523:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801528:	53                   	push   %ebx
+  801529:	ff 75 0c             	push   0xc(%ebp)
+  80152c:	68 04 70 80 00       	push   $0x807004
+  801531:	e8 26 1e 00 00       	call   80335c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801536:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80153c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801541:	e8 ed fd ff ff       	call   801333 <nsipc>
+}
+  801546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801549:	c9                   	leave
+  80154a:	c3                   	ret
+
+0080154b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801551:	8b 45 08             	mov    0x8(%ebp),%eax
+  801554:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801559:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80155c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801561:	b8 03 00 00 00       	mov    $0x3,%eax
+  801566:	e8 c8 fd ff ff       	call   801333 <nsipc>
+}
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+
+0080156d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801573:	8b 45 08             	mov    0x8(%ebp),%eax
+  801576:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80157b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801580:	e8 ae fd ff ff       	call   801333 <nsipc>
+}
+  801585:	c9                   	leave
+  801586:	c3                   	ret
+
+00801587 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	53                   	push   %ebx
+  80158b:	83 ec 08             	sub    $0x8,%esp
+  80158e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801591:	8b 45 08             	mov    0x8(%ebp),%eax
+  801594:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801599:	53                   	push   %ebx
+  80159a:	ff 75 0c             	push   0xc(%ebp)
+  80159d:	68 04 70 80 00       	push   $0x807004
+  8015a2:	e8 b5 1d 00 00       	call   80335c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015a7:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015ad:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015b2:	e8 7c fd ff ff       	call   801333 <nsipc>
+}
+  8015b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ba:	c9                   	leave
+  8015bb:	c3                   	ret
+
+008015bc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015bc:	55                   	push   %ebp
+  8015bd:	89 e5                	mov    %esp,%ebp
+  8015bf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015cd:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015d2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015d7:	e8 57 fd ff ff       	call   801333 <nsipc>
+}
+  8015dc:	c9                   	leave
+  8015dd:	c3                   	ret
+
+008015de <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8015de:	55                   	push   %ebp
+  8015df:	89 e5                	mov    %esp,%ebp
+  8015e1:	56                   	push   %esi
+  8015e2:	53                   	push   %ebx
+  8015e3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8015e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8015ee:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8015f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8015f7:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8015fc:	b8 07 00 00 00       	mov    $0x7,%eax
+  801601:	e8 2d fd ff ff       	call   801333 <nsipc>
+  801606:	89 c3                	mov    %eax,%ebx
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	78 22                	js     80162e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80160c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801611:	39 c6                	cmp    %eax,%esi
+  801613:	0f 4e c6             	cmovle %esi,%eax
+  801616:	39 c3                	cmp    %eax,%ebx
+  801618:	7f 1d                	jg     801637 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80161a:	83 ec 04             	sub    $0x4,%esp
+  80161d:	53                   	push   %ebx
+  80161e:	68 00 70 80 00       	push   $0x807000
+  801623:	ff 75 0c             	push   0xc(%ebp)
+  801626:	e8 31 1d 00 00       	call   80335c <memmove>
+  80162b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80162e:	89 d8                	mov    %ebx,%eax
+  801630:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801633:	5b                   	pop    %ebx
+  801634:	5e                   	pop    %esi
+  801635:	5d                   	pop    %ebp
+  801636:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801637:	68 54 3b 80 00       	push   $0x803b54
+  80163c:	68 69 3b 80 00       	push   $0x803b69
+  801641:	68 b2 00 00 00       	push   $0xb2
+  801646:	68 7e 3b 80 00       	push   $0x803b7e
+  80164b:	e8 8a 13 00 00       	call   8029da <_panic>
+
+00801650 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801650:	55                   	push   %ebp
+  801651:	89 e5                	mov    %esp,%ebp
+  801653:	53                   	push   %ebx
+  801654:	83 ec 04             	sub    $0x4,%esp
+  801657:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80165a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80165d:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801662:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801668:	7f 2e                	jg     801698 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80166a:	83 ec 04             	sub    $0x4,%esp
+  80166d:	53                   	push   %ebx
+  80166e:	ff 75 0c             	push   0xc(%ebp)
+  801671:	68 0c 70 80 00       	push   $0x80700c
+  801676:	e8 e1 1c 00 00       	call   80335c <memmove>
+	nsipcbuf.send.req_size = size;
+  80167b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801681:	8b 45 14             	mov    0x14(%ebp),%eax
+  801684:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801689:	b8 08 00 00 00       	mov    $0x8,%eax
+  80168e:	e8 a0 fc ff ff       	call   801333 <nsipc>
+}
+  801693:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801696:	c9                   	leave
+  801697:	c3                   	ret
+	assert(size < 1600);
+  801698:	68 8a 3b 80 00       	push   $0x803b8a
+  80169d:	68 69 3b 80 00       	push   $0x803b69
+  8016a2:	68 bd 00 00 00       	push   $0xbd
+  8016a7:	68 7e 3b 80 00       	push   $0x803b7e
+  8016ac:	e8 29 13 00 00       	call   8029da <_panic>
+
+008016b1 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	57                   	push   %edi
+  8016b5:	56                   	push   %esi
+  8016b6:	53                   	push   %ebx
+  8016b7:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016ba:	e8 c0 fc ff ff       	call   80137f <nsbulk_map>
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	78 55                	js     801718 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016ca:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016d1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8016d8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8016db:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016de:	0f 8d 24 02 00 00    	jge    801908 <nsipc_sendmsg+0x257>
+  8016e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016ea:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8016ed:	89 d8                	mov    %ebx,%eax
+  8016ef:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8016f4:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8016f6:	83 ec 0c             	sub    $0xc,%esp
+  8016f9:	68 20 50 80 00       	push   $0x805020
+  8016fe:	e8 5a 0f 00 00       	call   80265d <pgbatch_init>
+  801703:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801706:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801708:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80170b:	e9 82 00 00 00       	jmp    801792 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  801710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801713:	85 db                	test   %ebx,%ebx
+  801715:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801718:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171b:	5b                   	pop    %ebx
+  80171c:	5e                   	pop    %esi
+  80171d:	5f                   	pop    %edi
+  80171e:	5d                   	pop    %ebp
+  80171f:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  801720:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801725:	29 c8                	sub    %ecx,%eax
+  801727:	39 d0                	cmp    %edx,%eax
+  801729:	0f 46 d0             	cmovbe %eax,%edx
+  80172c:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80172e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801734:	85 ff                	test   %edi,%edi
+  801736:	0f 49 c7             	cmovns %edi,%eax
+  801739:	c1 f8 0c             	sar    $0xc,%eax
+  80173c:	ba 01 00 00 00       	mov    $0x1,%edx
+  801741:	e8 87 fc ff ff       	call   8013cd <nsbulk_own>
+  801746:	85 c0                	test   %eax,%eax
+  801748:	0f 88 17 01 00 00    	js     801865 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80174e:	83 ec 04             	sub    $0x4,%esp
+  801751:	56                   	push   %esi
+  801752:	ff 75 e0             	push   -0x20(%ebp)
+  801755:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801758:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80175d:	50                   	push   %eax
+  80175e:	e8 f9 1b 00 00       	call   80335c <memmove>
+  801763:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801766:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801769:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80176c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80176f:	0f 84 fd 00 00 00    	je     801872 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801775:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801778:	01 f7                	add    %esi,%edi
+  80177a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80177d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801780:	0f 8d 01 01 00 00    	jge    801887 <nsipc_sendmsg+0x1d6>
+  801786:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80178c:	0f 8f f0 00 00 00    	jg     801882 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  801792:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801795:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801798:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80179b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80179e:	89 c2                	mov    %eax,%edx
+  8017a0:	03 13                	add    (%ebx),%edx
+  8017a2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017a5:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017a8:	29 c6                	sub    %eax,%esi
+  8017aa:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017af:	29 f9                	sub    %edi,%ecx
+  8017b1:	39 ce                	cmp    %ecx,%esi
+  8017b3:	89 ca                	mov    %ecx,%edx
+  8017b5:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017b8:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017bb:	89 f9                	mov    %edi,%ecx
+  8017bd:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017c6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017cb:	09 c8                	or     %ecx,%eax
+  8017cd:	0f 85 4d ff ff ff    	jne    801720 <nsipc_sendmsg+0x6f>
+  8017d3:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017d9:	0f 86 41 ff ff ff    	jbe    801720 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017df:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8017e5:	85 ff                	test   %edi,%edi
+  8017e7:	0f 49 c7             	cmovns %edi,%eax
+  8017ea:	c1 f8 0c             	sar    $0xc,%eax
+  8017ed:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8017ef:	89 d1                	mov    %edx,%ecx
+  8017f1:	c1 e9 0c             	shr    $0xc,%ecx
+  8017f4:	01 c8                	add    %ecx,%eax
+  8017f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017f9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017fc:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8017fe:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801801:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801806:	29 c8                	sub    %ecx,%eax
+  801808:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80180b:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80180e:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801810:	b8 01 00 00 00       	mov    $0x1,%eax
+  801815:	89 f9                	mov    %edi,%ecx
+  801817:	d3 e0                	shl    %cl,%eax
+  801819:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80181f:	83 ec 08             	sub    $0x8,%esp
+  801822:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801824:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801827:	50                   	push   %eax
+  801828:	6a 00                	push   $0x0
+  80182a:	56                   	push   %esi
+  80182b:	6a 00                	push   $0x0
+  80182d:	68 20 50 80 00       	push   $0x805020
+  801832:	e8 e4 0e 00 00       	call   80271b <pgbatch_map>
+  801837:	83 c4 20             	add    $0x20,%esp
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	0f 88 ce fe ff ff    	js     801710 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  801842:	83 c7 01             	add    $0x1,%edi
+  801845:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80184b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80184e:	39 c7                	cmp    %eax,%edi
+  801850:	75 be                	jne    801810 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  801852:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801855:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801858:	89 d6                	mov    %edx,%esi
+  80185a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801860:	e9 01 ff ff ff       	jmp    801766 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801865:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801868:	85 db                	test   %ebx,%ebx
+  80186a:	0f 45 c3             	cmovne %ebx,%eax
+  80186d:	e9 a6 fe ff ff       	jmp    801718 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  801872:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  801876:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80187d:	e9 f3 fe ff ff       	jmp    801775 <nsipc_sendmsg+0xc4>
+  801882:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801885:	eb 03                	jmp    80188a <nsipc_sendmsg+0x1d9>
+  801887:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80188a:	83 ec 0c             	sub    $0xc,%esp
+  80188d:	68 20 50 80 00       	push   $0x805020
+  801892:	e8 d4 0d 00 00       	call   80266b <pgbatch_flush>
+  801897:	83 c4 10             	add    $0x10,%esp
+  80189a:	85 c0                	test   %eax,%eax
+  80189c:	78 50                	js     8018ee <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  80189e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018a6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018ac:	89 fb                	mov    %edi,%ebx
+  8018ae:	29 f3                	sub    %esi,%ebx
+  8018b0:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018b9:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018be:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018c3:	89 fa                	mov    %edi,%edx
+  8018c5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018ca:	e8 66 fb ff ff       	call   801435 <nsipc_bulk>
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 28                	js     8018fb <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018d3:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8018d6:	39 c3                	cmp    %eax,%ebx
+  8018d8:	75 0c                	jne    8018e6 <nsipc_sendmsg+0x235>
+  8018da:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018dd:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8018e0:	0f 8f f2 fd ff ff    	jg     8016d8 <nsipc_sendmsg+0x27>
+		sent += r;
+  8018e6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018e9:	e9 2a fe ff ff       	jmp    801718 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018ee:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018f1:	85 db                	test   %ebx,%ebx
+  8018f3:	0f 45 c3             	cmovne %ebx,%eax
+  8018f6:	e9 1d fe ff ff       	jmp    801718 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018fb:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018fe:	85 db                	test   %ebx,%ebx
+  801900:	0f 45 c3             	cmovne %ebx,%eax
+  801903:	e9 10 fe ff ff       	jmp    801718 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801908:	83 ec 0c             	sub    $0xc,%esp
+  80190b:	68 20 50 80 00       	push   $0x805020
+  801910:	e8 48 0d 00 00       	call   80265d <pgbatch_init>
+  801915:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801918:	be 00 00 00 00       	mov    $0x0,%esi
+  80191d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801922:	e9 63 ff ff ff       	jmp    80188a <nsipc_sendmsg+0x1d9>
+
+00801927 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	57                   	push   %edi
+  80192b:	56                   	push   %esi
+  80192c:	53                   	push   %ebx
+  80192d:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  801930:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  801937:	0f 84 c8 00 00 00    	je     801a05 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80193d:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801944:	0f 84 e4 00 00 00    	je     801a2e <nsipc_sendfile+0x107>
+{
+  80194a:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80194f:	89 fb                	mov    %edi,%ebx
+  801951:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801954:	0f 83 f0 00 00 00    	jae    801a4a <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80195a:	89 fa                	mov    %edi,%edx
+  80195c:	03 55 10             	add    0x10(%ebp),%edx
+  80195f:	89 d0                	mov    %edx,%eax
+  801961:	c1 f8 1f             	sar    $0x1f,%eax
+  801964:	c1 e8 14             	shr    $0x14,%eax
+  801967:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80196a:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801970:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801972:	6a 10                	push   $0x10
+  801974:	68 00 20 01 e0       	push   $0xe0012000
+  801979:	52                   	push   %edx
+  80197a:	ff 75 0c             	push   0xc(%ebp)
+  80197d:	e8 fe f4 ff ff       	call   800e80 <fmap>
+  801982:	83 c4 10             	add    $0x10,%esp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	0f 8e b8 00 00 00    	jle    801a45 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80198d:	39 c6                	cmp    %eax,%esi
+  80198f:	0f 8d b5 00 00 00    	jge    801a4a <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  801995:	29 f0                	sub    %esi,%eax
+  801997:	8b 55 14             	mov    0x14(%ebp),%edx
+  80199a:	29 da                	sub    %ebx,%edx
+  80199c:	39 d0                	cmp    %edx,%eax
+  80199e:	89 d3                	mov    %edx,%ebx
+  8019a0:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8019a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a6:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019ab:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019b1:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019b7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019ba:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019bf:	83 ec 0c             	sub    $0xc,%esp
+  8019c2:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019c4:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019cb:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019ce:	83 c0 01             	add    $0x1,%eax
+  8019d1:	50                   	push   %eax
+  8019d2:	68 00 10 01 e0       	push   $0xe0011000
+  8019d7:	6a 11                	push   $0x11
+  8019d9:	ff 35 24 53 80 00    	push   0x805324
+  8019df:	e8 04 1e 00 00       	call   8037e8 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8019e4:	83 c4 1c             	add    $0x1c,%esp
+  8019e7:	6a 00                	push   $0x0
+  8019e9:	6a 00                	push   $0x0
+  8019eb:	6a 00                	push   $0x0
+  8019ed:	e8 32 1b 00 00       	call   803524 <ipc_recv>
+  8019f2:	83 c4 10             	add    $0x10,%esp
+  8019f5:	85 c0                	test   %eax,%eax
+  8019f7:	78 5b                	js     801a54 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8019f9:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8019fb:	39 c3                	cmp    %eax,%ebx
+  8019fd:	0f 8e 4c ff ff ff    	jle    80194f <nsipc_sendfile+0x28>
+  801a03:	eb 45                	jmp    801a4a <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a05:	83 ec 04             	sub    $0x4,%esp
+  801a08:	6a 07                	push   $0x7
+  801a0a:	68 00 10 01 e0       	push   $0xe0011000
+  801a0f:	6a 00                	push   $0x0
+  801a11:	e8 89 e7 ff ff       	call   80019f <sys_page_alloc>
+  801a16:	89 c7                	mov    %eax,%edi
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	78 2b                	js     801a4a <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a1f:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a26:	00 00 00 
+  801a29:	e9 0f ff ff ff       	jmp    80193d <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a2e:	83 ec 0c             	sub    $0xc,%esp
+  801a31:	6a 03                	push   $0x3
+  801a33:	e8 e5 1d 00 00       	call   80381d <ipc_find_env>
+  801a38:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a3d:	83 c4 10             	add    $0x10,%esp
+  801a40:	e9 05 ff ff ff       	jmp    80194a <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a45:	85 ff                	test   %edi,%edi
+  801a47:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a4a:	89 f8                	mov    %edi,%eax
+  801a4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4f:	5b                   	pop    %ebx
+  801a50:	5e                   	pop    %esi
+  801a51:	5f                   	pop    %edi
+  801a52:	5d                   	pop    %ebp
+  801a53:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a54:	85 ff                	test   %edi,%edi
+  801a56:	0f 44 f8             	cmove  %eax,%edi
+  801a59:	eb ef                	jmp    801a4a <nsipc_sendfile+0x123>
+
+00801a5b <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+  801a5e:	57                   	push   %edi
+  801a5f:	56                   	push   %esi
+  801a60:	53                   	push   %ebx
+  801a61:	83 ec 1c             	sub    $0x1c,%esp
+  801a64:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a67:	e8 13 f9 ff ff       	call   80137f <nsbulk_map>
+  801a6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	0f 88 ba 00 00 00    	js     801b31 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a77:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a7b:	0f 8e bb 00 00 00    	jle    801b3c <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801a81:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a86:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801a8b:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801a90:	89 f8                	mov    %edi,%eax
+  801a92:	29 f0                	sub    %esi,%eax
+  801a94:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801a98:	39 c8                	cmp    %ecx,%eax
+  801a9a:	0f 47 c1             	cmova  %ecx,%eax
+  801a9d:	01 f0                	add    %esi,%eax
+  801a9f:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801aa1:	83 c2 01             	add    $0x1,%edx
+  801aa4:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801aa7:	7e 07                	jle    801ab0 <nsipc_recvmsg+0x55>
+  801aa9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801aae:	7e e0                	jle    801a90 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801ab0:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801ab6:	c1 fa 0c             	sar    $0xc,%edx
+  801ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abe:	e8 0a f9 ff ff       	call   8013cd <nsbulk_own>
+  801ac3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	78 67                	js     801b31 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801aca:	8b 45 08             	mov    0x8(%ebp),%eax
+  801acd:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801ad2:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801ad8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801adb:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801ae0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801ae5:	89 f2                	mov    %esi,%edx
+  801ae7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801aec:	e8 44 f9 ff ff       	call   801435 <nsipc_bulk>
+  801af1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801af4:	85 c0                	test   %eax,%eax
+  801af6:	78 39                	js     801b31 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801af8:	39 f0                	cmp    %esi,%eax
+  801afa:	7f 4a                	jg     801b46 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	7e 2c                	jle    801b31 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b05:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b08:	29 fe                	sub    %edi,%esi
+  801b0a:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b0d:	39 c6                	cmp    %eax,%esi
+  801b0f:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b12:	83 ec 04             	sub    $0x4,%esp
+  801b15:	56                   	push   %esi
+  801b16:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b1c:	50                   	push   %eax
+  801b1d:	ff 33                	push   (%ebx)
+  801b1f:	e8 38 18 00 00       	call   80335c <memmove>
+		n += m;
+  801b24:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b26:	83 c3 08             	add    $0x8,%ebx
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b2f:	7f d4                	jg     801b05 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b31:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b37:	5b                   	pop    %ebx
+  801b38:	5e                   	pop    %esi
+  801b39:	5f                   	pop    %edi
+  801b3a:	5d                   	pop    %ebp
+  801b3b:	c3                   	ret
+	int r, i, n, len = 0;
+  801b3c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b41:	e9 6a ff ff ff       	jmp    801ab0 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b46:	68 60 3b 80 00       	push   $0x803b60
+  801b4b:	68 69 3b 80 00       	push   $0x803b69
+  801b50:	68 3b 01 00 00       	push   $0x13b
+  801b55:	68 7e 3b 80 00       	push   $0x803b7e
+  801b5a:	e8 7b 0e 00 00       	call   8029da <_panic>
+
+00801b5f <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b5f:	55                   	push   %ebp
+  801b60:	89 e5                	mov    %esp,%ebp
+  801b62:	57                   	push   %edi
+  801b63:	56                   	push   %esi
+  801b64:	53                   	push   %ebx
+  801b65:	83 ec 0c             	sub    $0xc,%esp
+  801b68:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b6b:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b6e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b74:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801b79:	8b 07                	mov    (%edi),%eax
+  801b7b:	a3 04 70 80 00       	mov    %eax,0x807004
+  801b80:	8b 47 04             	mov    0x4(%edi),%eax
+  801b83:	a3 08 70 80 00       	mov    %eax,0x807008
+  801b88:	8b 47 08             	mov    0x8(%edi),%eax
+  801b8b:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801b90:	8b 47 0c             	mov    0xc(%edi),%eax
+  801b93:	a3 10 70 80 00       	mov    %eax,0x807010
+  801b98:	8b 47 10             	mov    0x10(%edi),%eax
+  801b9b:	a3 14 70 80 00       	mov    %eax,0x807014
+  801ba0:	8b 47 14             	mov    0x14(%edi),%eax
+  801ba3:	a3 18 70 80 00       	mov    %eax,0x807018
+  801ba8:	8b 47 18             	mov    0x18(%edi),%eax
+  801bab:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bb0:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bb3:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bb8:	8b 47 20             	mov    0x20(%edi),%eax
+  801bbb:	a3 24 70 80 00       	mov    %eax,0x807024
+  801bc0:	8b 47 24             	mov    0x24(%edi),%eax
+  801bc3:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bc8:	8b 47 28             	mov    0x28(%edi),%eax
+  801bcb:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801bd0:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801bd3:	a3 30 70 80 00       	mov    %eax,0x807030
+  801bd8:	8b 47 30             	mov    0x30(%edi),%eax
+  801bdb:	a3 34 70 80 00       	mov    %eax,0x807034
+  801be0:	8b 47 34             	mov    0x34(%edi),%eax
+  801be3:	a3 38 70 80 00       	mov    %eax,0x807038
+  801be8:	8b 47 38             	mov    0x38(%edi),%eax
+  801beb:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801bf0:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801bf3:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801bf8:	8b 06                	mov    (%esi),%eax
+  801bfa:	a3 44 70 80 00       	mov    %eax,0x807044
+  801bff:	8b 46 04             	mov    0x4(%esi),%eax
+  801c02:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c07:	8b 46 08             	mov    0x8(%esi),%eax
+  801c0a:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c0f:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c12:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c17:	8b 46 10             	mov    0x10(%esi),%eax
+  801c1a:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c1f:	8b 46 14             	mov    0x14(%esi),%eax
+  801c22:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c27:	8b 46 18             	mov    0x18(%esi),%eax
+  801c2a:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c2f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c32:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c37:	8b 46 20             	mov    0x20(%esi),%eax
+  801c3a:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c3f:	8b 46 24             	mov    0x24(%esi),%eax
+  801c42:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c47:	8b 46 28             	mov    0x28(%esi),%eax
+  801c4a:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c4f:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c52:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c57:	8b 46 30             	mov    0x30(%esi),%eax
+  801c5a:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c5f:	8b 46 34             	mov    0x34(%esi),%eax
+  801c62:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c67:	8b 46 38             	mov    0x38(%esi),%eax
+  801c6a:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c6f:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c72:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801c77:	8b 03                	mov    (%ebx),%eax
+  801c79:	a3 84 70 80 00       	mov    %eax,0x807084
+  801c7e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c81:	a3 88 70 80 00       	mov    %eax,0x807088
+  801c86:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c89:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801c8e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c91:	a3 90 70 80 00       	mov    %eax,0x807090
+  801c96:	8b 43 10             	mov    0x10(%ebx),%eax
+  801c99:	a3 94 70 80 00       	mov    %eax,0x807094
+  801c9e:	8b 43 14             	mov    0x14(%ebx),%eax
+  801ca1:	a3 98 70 80 00       	mov    %eax,0x807098
+  801ca6:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ca9:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801cae:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cb1:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cb6:	8b 43 20             	mov    0x20(%ebx),%eax
+  801cb9:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801cbe:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cc1:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cc6:	8b 43 28             	mov    0x28(%ebx),%eax
+  801cc9:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801cce:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801cd1:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801cd6:	8b 43 30             	mov    0x30(%ebx),%eax
+  801cd9:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801cde:	8b 43 34             	mov    0x34(%ebx),%eax
+  801ce1:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801ce6:	8b 43 38             	mov    0x38(%ebx),%eax
+  801ce9:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801cee:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801cf1:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801cf6:	8b 45 18             	mov    0x18(%ebp),%eax
+  801cf9:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801cfe:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d03:	e8 2b f6 ff ff       	call   801333 <nsipc>
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	0f 88 ad 01 00 00    	js     801ebd <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d10:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d16:	89 17                	mov    %edx,(%edi)
+  801d18:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d1e:	89 57 04             	mov    %edx,0x4(%edi)
+  801d21:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d27:	89 57 08             	mov    %edx,0x8(%edi)
+  801d2a:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d30:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d33:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d39:	89 57 10             	mov    %edx,0x10(%edi)
+  801d3c:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d42:	89 57 14             	mov    %edx,0x14(%edi)
+  801d45:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d4b:	89 57 18             	mov    %edx,0x18(%edi)
+  801d4e:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d54:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d57:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d5d:	89 57 20             	mov    %edx,0x20(%edi)
+  801d60:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d66:	89 57 24             	mov    %edx,0x24(%edi)
+  801d69:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d6f:	89 57 28             	mov    %edx,0x28(%edi)
+  801d72:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801d78:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801d7b:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801d81:	89 57 30             	mov    %edx,0x30(%edi)
+  801d84:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801d8a:	89 57 34             	mov    %edx,0x34(%edi)
+  801d8d:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801d93:	89 57 38             	mov    %edx,0x38(%edi)
+  801d96:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801d9c:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801d9f:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801da5:	89 16                	mov    %edx,(%esi)
+  801da7:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801dad:	89 56 04             	mov    %edx,0x4(%esi)
+  801db0:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801db6:	89 56 08             	mov    %edx,0x8(%esi)
+  801db9:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dbf:	89 56 0c             	mov    %edx,0xc(%esi)
+  801dc2:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801dc8:	89 56 10             	mov    %edx,0x10(%esi)
+  801dcb:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801dd1:	89 56 14             	mov    %edx,0x14(%esi)
+  801dd4:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801dda:	89 56 18             	mov    %edx,0x18(%esi)
+  801ddd:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801de3:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801de6:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801dec:	89 56 20             	mov    %edx,0x20(%esi)
+  801def:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801df5:	89 56 24             	mov    %edx,0x24(%esi)
+  801df8:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801dfe:	89 56 28             	mov    %edx,0x28(%esi)
+  801e01:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e07:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e0a:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e10:	89 56 30             	mov    %edx,0x30(%esi)
+  801e13:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e19:	89 56 34             	mov    %edx,0x34(%esi)
+  801e1c:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e22:	89 56 38             	mov    %edx,0x38(%esi)
+  801e25:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e2b:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e2e:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e34:	89 13                	mov    %edx,(%ebx)
+  801e36:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e3c:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e3f:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e45:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e48:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e4e:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e51:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e57:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e5a:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e60:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e63:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e69:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e6c:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e72:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801e75:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801e7b:	89 53 20             	mov    %edx,0x20(%ebx)
+  801e7e:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801e84:	89 53 24             	mov    %edx,0x24(%ebx)
+  801e87:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801e8d:	89 53 28             	mov    %edx,0x28(%ebx)
+  801e90:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801e96:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801e99:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801e9f:	89 53 30             	mov    %edx,0x30(%ebx)
+  801ea2:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801ea8:	89 53 34             	mov    %edx,0x34(%ebx)
+  801eab:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801eb1:	89 53 38             	mov    %edx,0x38(%ebx)
+  801eb4:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801eba:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801ebd:	83 c4 0c             	add    $0xc,%esp
+  801ec0:	5b                   	pop    %ebx
+  801ec1:	5e                   	pop    %esi
+  801ec2:	5f                   	pop    %edi
+  801ec3:	5d                   	pop    %ebp
+  801ec4:	c3                   	ret
+
+00801ec5 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ec5:	55                   	push   %ebp
+  801ec6:	89 e5                	mov    %esp,%ebp
+  801ec8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801ecb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ece:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801ed3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed6:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801edb:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ede:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801ee3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ee8:	e8 46 f4 ff ff       	call   801333 <nsipc>
+}
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+00801eef <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	56                   	push   %esi
+  801ef3:	53                   	push   %ebx
+  801ef4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801ef7:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801efd:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f00:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f05:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f0a:	e8 24 f4 ff ff       	call   801333 <nsipc>
+  801f0f:	89 c3                	mov    %eax,%ebx
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	7e 1f                	jle    801f34 <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f15:	39 c6                	cmp    %eax,%esi
+  801f17:	7c 24                	jl     801f3d <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f19:	83 ec 04             	sub    $0x4,%esp
+  801f1c:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f23:	50                   	push   %eax
+  801f24:	68 00 70 80 00       	push   $0x807000
+  801f29:	ff 75 08             	push   0x8(%ebp)
+  801f2c:	e8 2b 14 00 00       	call   80335c <memmove>
+  801f31:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f34:	89 d8                	mov    %ebx,%eax
+  801f36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f39:	5b                   	pop    %ebx
+  801f3a:	5e                   	pop    %esi
+  801f3b:	5d                   	pop    %ebp
+  801f3c:	c3                   	ret
+		assert(r <= max);
+  801f3d:	68 96 3b 80 00       	push   $0x803b96
+  801f42:	68 69 3b 80 00       	push   $0x803b69
+  801f47:	68 6a 01 00 00       	push   $0x16a
+  801f4c:	68 7e 3b 80 00       	push   $0x803b7e
+  801f51:	e8 84 0a 00 00       	call   8029da <_panic>
+
+00801f56 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f67:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f6c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f6f:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f74:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f79:	e8 b5 f3 ff ff       	call   801333 <nsipc>
+}
+  801f7e:	c9                   	leave
+  801f7f:	c3                   	ret
+
+00801f80 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801f86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f89:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801f8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f93:	e8 9b f3 ff ff       	call   801333 <nsipc>
+}
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+
+00801f9a <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	53                   	push   %ebx
+  801f9e:	83 ec 04             	sub    $0x4,%esp
+  801fa1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fa4:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fa9:	e8 85 f3 ff ff       	call   801333 <nsipc>
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	78 50                	js     802002 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fb2:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fb8:	89 13                	mov    %edx,(%ebx)
+  801fba:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801fc0:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fc3:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801fc9:	89 53 08             	mov    %edx,0x8(%ebx)
+  801fcc:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801fd2:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801fd5:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801fdb:	89 53 10             	mov    %edx,0x10(%ebx)
+  801fde:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801fe4:	89 53 14             	mov    %edx,0x14(%ebx)
+  801fe7:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801fed:	89 53 18             	mov    %edx,0x18(%ebx)
+  801ff0:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801ff6:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801ff9:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801fff:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802002:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802005:	c9                   	leave
+  802006:	c3                   	ret
+
+00802007 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802007:	55                   	push   %ebp
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80200d:	6a 03                	push   $0x3
+  80200f:	e8 09 18 00 00       	call   80381d <ipc_find_env>
+  802014:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802021:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802026:	e8 08 f3 ff ff       	call   801333 <nsipc>
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	85 c0                	test   %eax,%eax
+  802030:	78 0a                	js     80203c <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802032:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802037:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80203c:	c9                   	leave
+  80203d:	c3                   	ret
+
+0080203e <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	57                   	push   %edi
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	83 ec 1c             	sub    $0x1c,%esp
+  802047:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80204a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80204d:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802057:	89 e0                	mov    %esp,%eax
+  802059:	89 f2                	mov    %esi,%edx
+  80205b:	29 c2                	sub    %eax,%edx
+  80205d:	89 d0                	mov    %edx,%eax
+  80205f:	c1 e8 0f             	shr    $0xf,%eax
+  802062:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802068:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80206b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802072:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802075:	83 ec 0c             	sub    $0xc,%esp
+  802078:	ff 75 e0             	push   -0x20(%ebp)
+  80207b:	e8 dc 17 00 00       	call   80385c <pageref>
+  802080:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802083:	83 c4 04             	add    $0x4,%esp
+  802086:	ff 75 dc             	push   -0x24(%ebp)
+  802089:	e8 ce 17 00 00       	call   80385c <pageref>
+  80208e:	89 e2                	mov    %esp,%edx
+  802090:	89 f1                	mov    %esi,%ecx
+  802092:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802094:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802097:	89 ca                	mov    %ecx,%edx
+  802099:	c1 ea 0f             	shr    $0xf,%edx
+  80209c:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8020a2:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020a5:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020ac:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020af:	39 d7                	cmp    %edx,%edi
+  8020b1:	74 40                	je     8020f3 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020b3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020b6:	75 9f                	jne    802057 <_pipeisclosed+0x19>
+  8020b8:	89 e2                	mov    %esp,%edx
+  8020ba:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020bf:	29 d0                	sub    %edx,%eax
+  8020c1:	89 c2                	mov    %eax,%edx
+  8020c3:	c1 ea 0f             	shr    $0xf,%edx
+  8020c6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d0:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020d3:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020da:	8b 40 58             	mov    0x58(%eax),%eax
+  8020dd:	6a 01                	push   $0x1
+  8020df:	50                   	push   %eax
+  8020e0:	57                   	push   %edi
+  8020e1:	68 9f 3b 80 00       	push   $0x803b9f
+  8020e6:	e8 ca 09 00 00       	call   802ab5 <cprintf>
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	e9 5f ff ff ff       	jmp    802052 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8020f3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020f6:	0f 94 c0             	sete   %al
+  8020f9:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8020fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ff:	5b                   	pop    %ebx
+  802100:	5e                   	pop    %esi
+  802101:	5f                   	pop    %edi
+  802102:	5d                   	pop    %ebp
+  802103:	c3                   	ret
+
+00802104 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	53                   	push   %ebx
+  802108:	83 ec 0c             	sub    $0xc,%esp
+  80210b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80210e:	53                   	push   %ebx
+  80210f:	6a 00                	push   $0x0
+  802111:	e8 0e e1 ff ff       	call   800224 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802116:	89 1c 24             	mov    %ebx,(%esp)
+  802119:	e8 f4 e4 ff ff       	call   800612 <fd2data>
+  80211e:	83 c4 08             	add    $0x8,%esp
+  802121:	50                   	push   %eax
+  802122:	6a 00                	push   $0x0
+  802124:	e8 fb e0 ff ff       	call   800224 <sys_page_unmap>
+}
+  802129:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80212c:	c9                   	leave
+  80212d:	c3                   	ret
+
+0080212e <devpipe_read>:
+{
+  80212e:	55                   	push   %ebp
+  80212f:	89 e5                	mov    %esp,%ebp
+  802131:	57                   	push   %edi
+  802132:	56                   	push   %esi
+  802133:	53                   	push   %ebx
+  802134:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802137:	ff 75 08             	push   0x8(%ebp)
+  80213a:	e8 d3 e4 ff ff       	call   800612 <fd2data>
+  80213f:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802141:	8b 70 04             	mov    0x4(%eax),%esi
+  802144:	8b 00                	mov    (%eax),%eax
+  802146:	83 c4 10             	add    $0x10,%esp
+  802149:	39 f0                	cmp    %esi,%eax
+  80214b:	75 36                	jne    802183 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80214d:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802150:	89 da                	mov    %ebx,%edx
+  802152:	8b 45 08             	mov    0x8(%ebp),%eax
+  802155:	e8 e4 fe ff ff       	call   80203e <_pipeisclosed>
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	0f 85 d4 00 00 00    	jne    802236 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802162:	b8 01 00 00 00       	mov    $0x1,%eax
+  802167:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80216b:	83 ec 04             	sub    $0x4,%esp
+  80216e:	6a ff                	push   $0xffffffff
+  802170:	56                   	push   %esi
+  802171:	57                   	push   %edi
+  802172:	e8 26 e4 ff ff       	call   80059d <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802177:	8b 73 04             	mov    0x4(%ebx),%esi
+  80217a:	8b 03                	mov    (%ebx),%eax
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	39 c6                	cmp    %eax,%esi
+  802181:	74 cd                	je     802150 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802183:	8b 73 04             	mov    0x4(%ebx),%esi
+  802186:	8b 03                	mov    (%ebx),%eax
+  802188:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80218e:	29 c6                	sub    %eax,%esi
+  802190:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802195:	f7 e6                	mul    %esi
+  802197:	c1 ea 0c             	shr    $0xc,%edx
+  80219a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021a0:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8021a2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021a5:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021a9:	8b 0b                	mov    (%ebx),%ecx
+  8021ab:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021b0:	f7 e1                	mul    %ecx
+  8021b2:	c1 ea 0b             	shr    $0xb,%edx
+  8021b5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021bb:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021bd:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021c2:	29 cf                	sub    %ecx,%edi
+  8021c4:	39 f7                	cmp    %esi,%edi
+  8021c6:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021c9:	83 ec 04             	sub    $0x4,%esp
+  8021cc:	57                   	push   %edi
+  8021cd:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021d1:	50                   	push   %eax
+  8021d2:	ff 75 0c             	push   0xc(%ebp)
+  8021d5:	e8 82 11 00 00       	call   80335c <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8021da:	83 c4 0c             	add    $0xc,%esp
+  8021dd:	89 f0                	mov    %esi,%eax
+  8021df:	29 f8                	sub    %edi,%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	89 f8                	mov    %edi,%eax
+  8021e8:	03 45 0c             	add    0xc(%ebp),%eax
+  8021eb:	50                   	push   %eax
+  8021ec:	e8 6b 11 00 00       	call   80335c <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8021f1:	8b 0b                	mov    (%ebx),%ecx
+  8021f3:	01 f1                	add    %esi,%ecx
+  8021f5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021fa:	f7 e1                	mul    %ecx
+  8021fc:	c1 ea 0c             	shr    $0xc,%edx
+  8021ff:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802205:	29 c1                	sub    %eax,%ecx
+  802207:	89 0b                	mov    %ecx,(%ebx)
+  802209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220e:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	85 c0                	test   %eax,%eax
+  802217:	75 0a                	jne    802223 <devpipe_read+0xf5>
+	return n;
+  802219:	89 f0                	mov    %esi,%eax
+}
+  80221b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80221e:	5b                   	pop    %ebx
+  80221f:	5e                   	pop    %esi
+  802220:	5f                   	pop    %edi
+  802221:	5d                   	pop    %ebp
+  802222:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802223:	83 ec 08             	sub    $0x8,%esp
+  802226:	68 00 04 00 00       	push   $0x400
+  80222b:	53                   	push   %ebx
+  80222c:	e8 8e e3 ff ff       	call   8005bf <sys_futex_wake>
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	eb e3                	jmp    802219 <devpipe_read+0xeb>
+			return 0;
+  802236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223b:	eb de                	jmp    80221b <devpipe_read+0xed>
+
+0080223d <devpipe_write>:
+{
+  80223d:	55                   	push   %ebp
+  80223e:	89 e5                	mov    %esp,%ebp
+  802240:	57                   	push   %edi
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+  802243:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802246:	ff 75 08             	push   0x8(%ebp)
+  802249:	e8 c4 e3 ff ff       	call   800612 <fd2data>
+  80224e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80225a:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80225f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802263:	0f 84 43 01 00 00    	je     8023ac <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802269:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80226c:	8b 06                	mov    (%esi),%eax
+  80226e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802274:	29 c1                	sub    %eax,%ecx
+  802276:	89 c8                	mov    %ecx,%eax
+  802278:	f7 e7                	mul    %edi
+  80227a:	c1 ea 0c             	shr    $0xc,%edx
+  80227d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802283:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802285:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80228b:	75 52                	jne    8022df <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80228d:	89 f2                	mov    %esi,%edx
+  80228f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802292:	e8 a7 fd ff ff       	call   80203e <_pipeisclosed>
+  802297:	85 c0                	test   %eax,%eax
+  802299:	0f 85 28 01 00 00    	jne    8023c7 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80229f:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022a1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022a4:	8b 06                	mov    (%esi),%eax
+  8022a6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022ac:	29 c1                	sub    %eax,%ecx
+  8022ae:	89 c8                	mov    %ecx,%eax
+  8022b0:	f7 e7                	mul    %edi
+  8022b2:	c1 ea 0c             	shr    $0xc,%edx
+  8022b5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022bb:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022bd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022c3:	75 a4                	jne    802269 <devpipe_write+0x2c>
+  8022c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ca:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022ce:	83 ec 04             	sub    $0x4,%esp
+  8022d1:	6a ff                	push   $0xffffffff
+  8022d3:	53                   	push   %ebx
+  8022d4:	56                   	push   %esi
+  8022d5:	e8 c3 e2 ff ff       	call   80059d <sys_futex_wait>
+}
+  8022da:	83 c4 10             	add    $0x10,%esp
+  8022dd:	eb 8a                	jmp    802269 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022df:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022e2:	8b 06                	mov    (%esi),%eax
+  8022e4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022ea:	29 c1                	sub    %eax,%ecx
+  8022ec:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022f1:	f7 e1                	mul    %ecx
+  8022f3:	c1 ea 0c             	shr    $0xc,%edx
+  8022f6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022fc:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8022fe:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802303:	89 d8                	mov    %ebx,%eax
+  802305:	29 c8                	sub    %ecx,%eax
+  802307:	8b 55 10             	mov    0x10(%ebp),%edx
+  80230a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80230d:	29 ca                	sub    %ecx,%edx
+  80230f:	39 d0                	cmp    %edx,%eax
+  802311:	0f 46 d0             	cmovbe %eax,%edx
+  802314:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802317:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80231a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80231f:	f7 e1                	mul    %ecx
+  802321:	c1 ea 0b             	shr    $0xb,%edx
+  802324:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80232a:	89 ca                	mov    %ecx,%edx
+  80232c:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80232e:	29 d3                	sub    %edx,%ebx
+  802330:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802333:	39 c3                	cmp    %eax,%ebx
+  802335:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802338:	83 ec 04             	sub    $0x4,%esp
+  80233b:	53                   	push   %ebx
+  80233c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80233f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802342:	51                   	push   %ecx
+  802343:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802347:	50                   	push   %eax
+  802348:	e8 0f 10 00 00       	call   80335c <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80234d:	83 c4 0c             	add    $0xc,%esp
+  802350:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802353:	29 d8                	sub    %ebx,%eax
+  802355:	50                   	push   %eax
+  802356:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802359:	01 cb                	add    %ecx,%ebx
+  80235b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80235e:	53                   	push   %ebx
+  80235f:	8d 46 10             	lea    0x10(%esi),%eax
+  802362:	50                   	push   %eax
+  802363:	e8 f4 0f 00 00       	call   80335c <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802368:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80236b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80236e:	01 c1                	add    %eax,%ecx
+  802370:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802375:	f7 e1                	mul    %ecx
+  802377:	c1 ea 0c             	shr    $0xc,%edx
+  80237a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802380:	89 ca                	mov    %ecx,%edx
+  802382:	29 c2                	sub    %eax,%edx
+  802384:	89 56 04             	mov    %edx,0x4(%esi)
+  802387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238c:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802390:	83 c4 10             	add    $0x10,%esp
+  802393:	85 c0                	test   %eax,%eax
+  802395:	75 1a                	jne    8023b1 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802397:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80239a:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80239d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023a0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023a3:	0f 82 c0 fe ff ff    	jb     802269 <devpipe_write+0x2c>
+  8023a9:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023ac:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023af:	eb 1b                	jmp    8023cc <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023b1:	83 ec 08             	sub    $0x8,%esp
+  8023b4:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023b9:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023bc:	50                   	push   %eax
+  8023bd:	e8 fd e1 ff ff       	call   8005bf <sys_futex_wake>
+  8023c2:	83 c4 10             	add    $0x10,%esp
+  8023c5:	eb d0                	jmp    802397 <devpipe_write+0x15a>
+				return 0;
+  8023c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023cf:	5b                   	pop    %ebx
+  8023d0:	5e                   	pop    %esi
+  8023d1:	5f                   	pop    %edi
+  8023d2:	5d                   	pop    %ebp
+  8023d3:	c3                   	ret
+
+008023d4 <devpipe_stat>:
+{
+  8023d4:	55                   	push   %ebp
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	56                   	push   %esi
+  8023d8:	53                   	push   %ebx
+  8023d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023dc:	83 ec 0c             	sub    $0xc,%esp
+  8023df:	ff 75 08             	push   0x8(%ebp)
+  8023e2:	e8 2b e2 ff ff       	call   800612 <fd2data>
+  8023e7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023e9:	83 c4 08             	add    $0x8,%esp
+  8023ec:	68 b2 3b 80 00       	push   $0x803bb2
+  8023f1:	53                   	push   %ebx
+  8023f2:	e8 b5 0d 00 00       	call   8031ac <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8023f7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8023fa:	8b 06                	mov    (%esi),%eax
+  8023fc:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802402:	29 c1                	sub    %eax,%ecx
+  802404:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802409:	89 c8                	mov    %ecx,%eax
+  80240b:	f7 e2                	mul    %edx
+  80240d:	c1 ea 0c             	shr    $0xc,%edx
+  802410:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802416:	29 d1                	sub    %edx,%ecx
+  802418:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80241e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802425:	00 00 00 
+	stat->st_dev = &devpipe;
+  802428:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  80242f:	40 80 00 
+}
+  802432:	b8 00 00 00 00       	mov    $0x0,%eax
+  802437:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80243a:	5b                   	pop    %ebx
+  80243b:	5e                   	pop    %esi
+  80243c:	5d                   	pop    %ebp
+  80243d:	c3                   	ret
+
+0080243e <devpipe_poll>:
+{
+  80243e:	55                   	push   %ebp
+  80243f:	89 e5                	mov    %esp,%ebp
+  802441:	57                   	push   %edi
+  802442:	56                   	push   %esi
+  802443:	53                   	push   %ebx
+  802444:	83 ec 18             	sub    $0x18,%esp
+  802447:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80244a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80244d:	57                   	push   %edi
+  80244e:	e8 bf e1 ff ff       	call   800612 <fd2data>
+  802453:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	89 f3                	mov    %esi,%ebx
+  80245a:	83 e3 01             	and    $0x1,%ebx
+  80245d:	75 27                	jne    802486 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80245f:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802465:	75 48                	jne    8024af <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802467:	89 ca                	mov    %ecx,%edx
+  802469:	89 f8                	mov    %edi,%eax
+  80246b:	e8 ce fb ff ff       	call   80203e <_pipeisclosed>
+  802470:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  802472:	89 d8                	mov    %ebx,%eax
+  802474:	83 c8 10             	or     $0x10,%eax
+  802477:	85 d2                	test   %edx,%edx
+  802479:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80247c:	89 d8                	mov    %ebx,%eax
+  80247e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802481:	5b                   	pop    %ebx
+  802482:	5e                   	pop    %esi
+  802483:	5f                   	pop    %edi
+  802484:	5d                   	pop    %ebp
+  802485:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802486:	8b 58 04             	mov    0x4(%eax),%ebx
+  802489:	8b 00                	mov    (%eax),%eax
+  80248b:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  802491:	29 c3                	sub    %eax,%ebx
+  802493:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802498:	89 d8                	mov    %ebx,%eax
+  80249a:	f7 e2                	mul    %edx
+  80249c:	c1 ea 0c             	shr    $0xc,%edx
+  80249f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024a5:	39 d3                	cmp    %edx,%ebx
+  8024a7:	0f 95 c3             	setne  %bl
+  8024aa:	0f b6 db             	movzbl %bl,%ebx
+  8024ad:	eb b0                	jmp    80245f <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024af:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024b2:	8b 01                	mov    (%ecx),%eax
+  8024b4:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024ba:	29 c6                	sub    %eax,%esi
+  8024bc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024c1:	89 f0                	mov    %esi,%eax
+  8024c3:	f7 e2                	mul    %edx
+  8024c5:	c1 ea 0c             	shr    $0xc,%edx
+  8024c8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024ce:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024d0:	89 d8                	mov    %ebx,%eax
+  8024d2:	83 c8 04             	or     $0x4,%eax
+  8024d5:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8024db:	0f 42 d8             	cmovb  %eax,%ebx
+  8024de:	eb 87                	jmp    802467 <devpipe_poll+0x29>
+
+008024e0 <pipe>:
+{
+  8024e0:	55                   	push   %ebp
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	56                   	push   %esi
+  8024e4:	53                   	push   %ebx
+  8024e5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024eb:	50                   	push   %eax
+  8024ec:	e8 38 e1 ff ff       	call   800629 <fd_alloc>
+  8024f1:	89 c3                	mov    %eax,%ebx
+  8024f3:	83 c4 10             	add    $0x10,%esp
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	0f 88 23 01 00 00    	js     802621 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024fe:	83 ec 04             	sub    $0x4,%esp
+  802501:	68 07 04 00 00       	push   $0x407
+  802506:	ff 75 f4             	push   -0xc(%ebp)
+  802509:	6a 00                	push   $0x0
+  80250b:	e8 8f dc ff ff       	call   80019f <sys_page_alloc>
+  802510:	89 c3                	mov    %eax,%ebx
+  802512:	83 c4 10             	add    $0x10,%esp
+  802515:	85 c0                	test   %eax,%eax
+  802517:	0f 88 04 01 00 00    	js     802621 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80251d:	83 ec 0c             	sub    $0xc,%esp
+  802520:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802523:	50                   	push   %eax
+  802524:	e8 00 e1 ff ff       	call   800629 <fd_alloc>
+  802529:	89 c3                	mov    %eax,%ebx
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	0f 88 db 00 00 00    	js     802611 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802536:	83 ec 04             	sub    $0x4,%esp
+  802539:	68 07 04 00 00       	push   $0x407
+  80253e:	ff 75 f0             	push   -0x10(%ebp)
+  802541:	6a 00                	push   $0x0
+  802543:	e8 57 dc ff ff       	call   80019f <sys_page_alloc>
+  802548:	89 c3                	mov    %eax,%ebx
+  80254a:	83 c4 10             	add    $0x10,%esp
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	0f 88 bc 00 00 00    	js     802611 <pipe+0x131>
+	va = fd2data(fd0);
+  802555:	83 ec 0c             	sub    $0xc,%esp
+  802558:	ff 75 f4             	push   -0xc(%ebp)
+  80255b:	e8 b2 e0 ff ff       	call   800612 <fd2data>
+  802560:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802562:	83 c4 0c             	add    $0xc,%esp
+  802565:	68 07 04 00 00       	push   $0x407
+  80256a:	50                   	push   %eax
+  80256b:	6a 00                	push   $0x0
+  80256d:	e8 2d dc ff ff       	call   80019f <sys_page_alloc>
+  802572:	89 c3                	mov    %eax,%ebx
+  802574:	83 c4 10             	add    $0x10,%esp
+  802577:	85 c0                	test   %eax,%eax
+  802579:	0f 88 82 00 00 00    	js     802601 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80257f:	83 ec 0c             	sub    $0xc,%esp
+  802582:	ff 75 f0             	push   -0x10(%ebp)
+  802585:	e8 88 e0 ff ff       	call   800612 <fd2data>
+  80258a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802591:	50                   	push   %eax
+  802592:	6a 00                	push   $0x0
+  802594:	56                   	push   %esi
+  802595:	6a 00                	push   $0x0
+  802597:	e8 46 dc ff ff       	call   8001e2 <sys_page_map>
+  80259c:	89 c3                	mov    %eax,%ebx
+  80259e:	83 c4 20             	add    $0x20,%esp
+  8025a1:	85 c0                	test   %eax,%eax
+  8025a3:	78 4e                	js     8025f3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025a5:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025ad:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025af:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025b2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025b9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025bc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025c1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025c8:	83 ec 0c             	sub    $0xc,%esp
+  8025cb:	ff 75 f4             	push   -0xc(%ebp)
+  8025ce:	e8 2f e0 ff ff       	call   800602 <fd2num>
+  8025d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025d6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025d8:	83 c4 04             	add    $0x4,%esp
+  8025db:	ff 75 f0             	push   -0x10(%ebp)
+  8025de:	e8 1f e0 ff ff       	call   800602 <fd2num>
+  8025e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025e6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025e9:	83 c4 10             	add    $0x10,%esp
+  8025ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025f1:	eb 2e                	jmp    802621 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8025f3:	83 ec 08             	sub    $0x8,%esp
+  8025f6:	56                   	push   %esi
+  8025f7:	6a 00                	push   $0x0
+  8025f9:	e8 26 dc ff ff       	call   800224 <sys_page_unmap>
+  8025fe:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802601:	83 ec 08             	sub    $0x8,%esp
+  802604:	ff 75 f0             	push   -0x10(%ebp)
+  802607:	6a 00                	push   $0x0
+  802609:	e8 16 dc ff ff       	call   800224 <sys_page_unmap>
+  80260e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802611:	83 ec 08             	sub    $0x8,%esp
+  802614:	ff 75 f4             	push   -0xc(%ebp)
+  802617:	6a 00                	push   $0x0
+  802619:	e8 06 dc ff ff       	call   800224 <sys_page_unmap>
+  80261e:	83 c4 10             	add    $0x10,%esp
+}
+  802621:	89 d8                	mov    %ebx,%eax
+  802623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802626:	5b                   	pop    %ebx
+  802627:	5e                   	pop    %esi
+  802628:	5d                   	pop    %ebp
+  802629:	c3                   	ret
+
+0080262a <pipeisclosed>:
+{
+  80262a:	55                   	push   %ebp
+  80262b:	89 e5                	mov    %esp,%ebp
+  80262d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802630:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802633:	50                   	push   %eax
+  802634:	ff 75 08             	push   0x8(%ebp)
+  802637:	e8 3d e0 ff ff       	call   800679 <fd_lookup>
+  80263c:	83 c4 10             	add    $0x10,%esp
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	78 18                	js     80265b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802643:	83 ec 0c             	sub    $0xc,%esp
+  802646:	ff 75 f4             	push   -0xc(%ebp)
+  802649:	e8 c4 df ff ff       	call   800612 <fd2data>
+  80264e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802650:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802653:	e8 e6 f9 ff ff       	call   80203e <_pipeisclosed>
+  802658:	83 c4 10             	add    $0x10,%esp
+}
+  80265b:	c9                   	leave
+  80265c:	c3                   	ret
+
+0080265d <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80265d:	55                   	push   %ebp
+  80265e:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  802660:	8b 45 08             	mov    0x8(%ebp),%eax
+  802663:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802669:	5d                   	pop    %ebp
+  80266a:	c3                   	ret
+
+0080266b <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80266b:	55                   	push   %ebp
+  80266c:	89 e5                	mov    %esp,%ebp
+  80266e:	53                   	push   %ebx
+  80266f:	83 ec 04             	sub    $0x4,%esp
+  802672:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802675:	8b 03                	mov    (%ebx),%eax
+  802677:	85 c0                	test   %eax,%eax
+  802679:	75 05                	jne    802680 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80267b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80267e:	c9                   	leave
+  80267f:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  802680:	83 ec 08             	sub    $0x8,%esp
+  802683:	50                   	push   %eax
+  802684:	8d 43 04             	lea    0x4(%ebx),%eax
+  802687:	50                   	push   %eax
+  802688:	e8 e7 dd ff ff       	call   800474 <sys_page_batch>
+	pb->pb_n = 0;
+  80268d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	eb e3                	jmp    80267b <pgbatch_flush+0x10>
+
+00802698 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  802698:	55                   	push   %ebp
+  802699:	89 e5                	mov    %esp,%ebp
+  80269b:	56                   	push   %esi
+  80269c:	53                   	push   %ebx
+  80269d:	89 c3                	mov    %eax,%ebx
+  80269f:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026a1:	83 38 20             	cmpl   $0x20,(%eax)
+  8026a4:	74 2c                	je     8026d2 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026a6:	8b 03                	mov    (%ebx),%eax
+  8026a8:	8d 50 01             	lea    0x1(%eax),%edx
+  8026ab:	89 13                	mov    %edx,(%ebx)
+  8026ad:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026b0:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026b4:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026b6:	83 ec 04             	sub    $0x4,%esp
+  8026b9:	6a 18                	push   $0x18
+  8026bb:	6a 00                	push   $0x0
+  8026bd:	50                   	push   %eax
+  8026be:	e8 64 0c 00 00       	call   803327 <memset>
+	return 0;
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ce:	5b                   	pop    %ebx
+  8026cf:	5e                   	pop    %esi
+  8026d0:	5d                   	pop    %ebp
+  8026d1:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026d2:	83 ec 0c             	sub    $0xc,%esp
+  8026d5:	50                   	push   %eax
+  8026d6:	e8 90 ff ff ff       	call   80266b <pgbatch_flush>
+  8026db:	83 c4 10             	add    $0x10,%esp
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	79 c4                	jns    8026a6 <pgbatch_slot+0xe>
+  8026e2:	eb e7                	jmp    8026cb <pgbatch_slot+0x33>
+
+008026e4 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8026e4:	55                   	push   %ebp
+  8026e5:	89 e5                	mov    %esp,%ebp
+  8026e7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8026ea:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f0:	e8 a3 ff ff ff       	call   802698 <pgbatch_slot>
+  8026f5:	85 c0                	test   %eax,%eax
+  8026f7:	78 20                	js     802719 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8026f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026fc:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  802702:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802705:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802708:	8b 55 10             	mov    0x10(%ebp),%edx
+  80270b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80270e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802711:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802714:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802719:	c9                   	leave
+  80271a:	c3                   	ret
+
+0080271b <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80271b:	55                   	push   %ebp
+  80271c:	89 e5                	mov    %esp,%ebp
+  80271e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802721:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802724:	8b 45 08             	mov    0x8(%ebp),%eax
+  802727:	e8 6c ff ff ff       	call   802698 <pgbatch_slot>
+  80272c:	85 c0                	test   %eax,%eax
+  80272e:	78 2c                	js     80275c <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  802730:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802733:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802739:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80273c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80273f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802742:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802745:	8b 55 14             	mov    0x14(%ebp),%edx
+  802748:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80274b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80274e:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802751:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802754:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802757:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80275c:	c9                   	leave
+  80275d:	c3                   	ret
+
+0080275e <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80275e:	55                   	push   %ebp
+  80275f:	89 e5                	mov    %esp,%ebp
+  802761:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802764:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802767:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276a:	e8 29 ff ff ff       	call   802698 <pgbatch_slot>
+  80276f:	85 c0                	test   %eax,%eax
+  802771:	78 1a                	js     80278d <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  802773:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802776:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80277c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80277f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802782:	8b 55 10             	mov    0x10(%ebp),%edx
+  802785:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  802788:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80278d:	c9                   	leave
+  80278e:	c3                   	ret
+
+0080278f <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80278f:	55                   	push   %ebp
+  802790:	89 e5                	mov    %esp,%ebp
+  802792:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802795:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802798:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279b:	e8 f8 fe ff ff       	call   802698 <pgbatch_slot>
+  8027a0:	85 c0                	test   %eax,%eax
+  8027a2:	78 20                	js     8027c4 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a7:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027b0:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027b3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027b6:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027b9:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027bc:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027c4:	c9                   	leave
+  8027c5:	c3                   	ret
+
+008027c6 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027c6:	55                   	push   %ebp
+  8027c7:	89 e5                	mov    %esp,%ebp
+  8027c9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027cc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d2:	e8 c1 fe ff ff       	call   802698 <pgbatch_slot>
+  8027d7:	85 c0                	test   %eax,%eax
+  8027d9:	78 26                	js     802801 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8027db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027de:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8027e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027e7:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8027ea:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027ed:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8027f0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027f3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8027f6:	8b 55 18             	mov    0x18(%ebp),%edx
+  8027f9:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802801:	c9                   	leave
+  802802:	c3                   	ret
+
+00802803 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802803:	b8 00 00 00 00       	mov    $0x0,%eax
+  802808:	c3                   	ret
+
+00802809 <devcons_poll>:
+{
+  802809:	55                   	push   %ebp
+  80280a:	89 e5                	mov    %esp,%ebp
+  80280c:	53                   	push   %ebx
+  80280d:	83 ec 04             	sub    $0x4,%esp
+  802810:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802813:	89 da                	mov    %ebx,%edx
+  802815:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802818:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80281f:	74 0c                	je     80282d <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802821:	89 d8                	mov    %ebx,%eax
+  802823:	83 e0 01             	and    $0x1,%eax
+  802826:	09 d0                	or     %edx,%eax
+}
+  802828:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80282b:	c9                   	leave
+  80282c:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80282d:	e8 cf d8 ff ff       	call   800101 <sys_cgetc>
+  802832:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802837:	89 da                	mov    %ebx,%edx
+  802839:	83 e2 04             	and    $0x4,%edx
+  80283c:	85 c0                	test   %eax,%eax
+  80283e:	74 e6                	je     802826 <devcons_poll+0x1d>
+  802840:	eb df                	jmp    802821 <devcons_poll+0x18>
+
+00802842 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802842:	55                   	push   %ebp
+  802843:	89 e5                	mov    %esp,%ebp
+  802845:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802848:	68 be 3b 80 00       	push   $0x803bbe
+  80284d:	ff 75 0c             	push   0xc(%ebp)
+  802850:	e8 57 09 00 00       	call   8031ac <strcpy>
+	return 0;
+}
+  802855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285a:	c9                   	leave
+  80285b:	c3                   	ret
+
+0080285c <devcons_write>:
+{
+  80285c:	55                   	push   %ebp
+  80285d:	89 e5                	mov    %esp,%ebp
+  80285f:	57                   	push   %edi
+  802860:	56                   	push   %esi
+  802861:	53                   	push   %ebx
+  802862:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802868:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80286b:	85 ff                	test   %edi,%edi
+  80286d:	74 51                	je     8028c0 <devcons_write+0x64>
+  80286f:	be 00 00 00 00       	mov    $0x0,%esi
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  802879:	89 fb                	mov    %edi,%ebx
+  80287b:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80287d:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802882:	39 d3                	cmp    %edx,%ebx
+  802884:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802887:	83 ec 04             	sub    $0x4,%esp
+  80288a:	53                   	push   %ebx
+  80288b:	03 45 0c             	add    0xc(%ebp),%eax
+  80288e:	50                   	push   %eax
+  80288f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802895:	50                   	push   %eax
+  802896:	e8 c1 0a 00 00       	call   80335c <memmove>
+		sys_cputs(buf, m);
+  80289b:	83 c4 08             	add    $0x8,%esp
+  80289e:	53                   	push   %ebx
+  80289f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028a5:	50                   	push   %eax
+  8028a6:	e8 38 d8 ff ff       	call   8000e3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028ab:	01 de                	add    %ebx,%esi
+  8028ad:	89 f0                	mov    %esi,%eax
+  8028af:	83 c4 10             	add    $0x10,%esp
+  8028b2:	39 fe                	cmp    %edi,%esi
+  8028b4:	72 c3                	jb     802879 <devcons_write+0x1d>
+}
+  8028b6:	89 f0                	mov    %esi,%eax
+  8028b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028bb:	5b                   	pop    %ebx
+  8028bc:	5e                   	pop    %esi
+  8028bd:	5f                   	pop    %edi
+  8028be:	5d                   	pop    %ebp
+  8028bf:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028c0:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028c5:	eb ef                	jmp    8028b6 <devcons_write+0x5a>
+
+008028c7 <devcons_read>:
+{
+  8028c7:	55                   	push   %ebp
+  8028c8:	89 e5                	mov    %esp,%ebp
+  8028ca:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028cd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028d2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028d6:	74 36                	je     80290e <devcons_read+0x47>
+	c = cons_peek;
+  8028d8:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8028dd:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8028e4:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	75 10                	jne    8028fb <devcons_read+0x34>
+  8028eb:	e8 11 d8 ff ff       	call   800101 <sys_cgetc>
+  8028f0:	85 c0                	test   %eax,%eax
+  8028f2:	75 07                	jne    8028fb <devcons_read+0x34>
+		sys_yield();
+  8028f4:	e8 87 d8 ff ff       	call   800180 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028f9:	eb f0                	jmp    8028eb <devcons_read+0x24>
+	if (c < 0)
+  8028fb:	85 c0                	test   %eax,%eax
+  8028fd:	78 0f                	js     80290e <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8028ff:	83 f8 04             	cmp    $0x4,%eax
+  802902:	74 0c                	je     802910 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802904:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802907:	88 02                	mov    %al,(%edx)
+	return 1;
+  802909:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80290e:	c9                   	leave
+  80290f:	c3                   	ret
+		return 0;
+  802910:	b8 00 00 00 00       	mov    $0x0,%eax
+  802915:	eb f7                	jmp    80290e <devcons_read+0x47>
+
+00802917 <cputchar>:
+{
+  802917:	55                   	push   %ebp
+  802918:	89 e5                	mov    %esp,%ebp
+  80291a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80291d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802920:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802923:	6a 01                	push   $0x1
+  802925:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802928:	50                   	push   %eax
+  802929:	e8 b5 d7 ff ff       	call   8000e3 <sys_cputs>
+}
+  80292e:	83 c4 10             	add    $0x10,%esp
+  802931:	c9                   	leave
+  802932:	c3                   	ret
+
+00802933 <getchar>:
+{
+  802933:	55                   	push   %ebp
+  802934:	89 e5                	mov    %esp,%ebp
+  802936:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802939:	6a 01                	push   $0x1
+  80293b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80293e:	50                   	push   %eax
+  80293f:	6a 00                	push   $0x0
+  802941:	e8 b7 df ff ff       	call   8008fd <read>
+	if (r < 0)
+  802946:	83 c4 10             	add    $0x10,%esp
+  802949:	85 c0                	test   %eax,%eax
+  80294b:	78 06                	js     802953 <getchar+0x20>
+	if (r < 1)
+  80294d:	74 06                	je     802955 <getchar+0x22>
+	return c;
+  80294f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802953:	c9                   	leave
+  802954:	c3                   	ret
+		return -E_EOF;
+  802955:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80295a:	eb f7                	jmp    802953 <getchar+0x20>
+
+0080295c <iscons>:
+{
+  80295c:	55                   	push   %ebp
+  80295d:	89 e5                	mov    %esp,%ebp
+  80295f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802962:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802965:	50                   	push   %eax
+  802966:	ff 75 08             	push   0x8(%ebp)
+  802969:	e8 0b dd ff ff       	call   800679 <fd_lookup>
+  80296e:	83 c4 10             	add    $0x10,%esp
+  802971:	85 c0                	test   %eax,%eax
+  802973:	78 11                	js     802986 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802978:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80297e:	39 10                	cmp    %edx,(%eax)
+  802980:	0f 94 c0             	sete   %al
+  802983:	0f b6 c0             	movzbl %al,%eax
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+00802988 <opencons>:
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80298e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802991:	50                   	push   %eax
+  802992:	e8 92 dc ff ff       	call   800629 <fd_alloc>
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 3a                	js     8029d8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80299e:	83 ec 04             	sub    $0x4,%esp
+  8029a1:	68 07 04 00 00       	push   $0x407
+  8029a6:	ff 75 f4             	push   -0xc(%ebp)
+  8029a9:	6a 00                	push   $0x0
+  8029ab:	e8 ef d7 ff ff       	call   80019f <sys_page_alloc>
+  8029b0:	83 c4 10             	add    $0x10,%esp
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	78 21                	js     8029d8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ba:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029c0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029cc:	83 ec 0c             	sub    $0xc,%esp
+  8029cf:	50                   	push   %eax
+  8029d0:	e8 2d dc ff ff       	call   800602 <fd2num>
+  8029d5:	83 c4 10             	add    $0x10,%esp
+}
+  8029d8:	c9                   	leave
+  8029d9:	c3                   	ret
+
+008029da <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029da:	55                   	push   %ebp
+  8029db:	89 e5                	mov    %esp,%ebp
+  8029dd:	56                   	push   %esi
+  8029de:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029df:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029e2:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8029e8:	e8 74 d7 ff ff       	call   800161 <sys_getenvid>
+  8029ed:	83 ec 0c             	sub    $0xc,%esp
+  8029f0:	ff 75 0c             	push   0xc(%ebp)
+  8029f3:	ff 75 08             	push   0x8(%ebp)
+  8029f6:	56                   	push   %esi
+  8029f7:	50                   	push   %eax
+  8029f8:	68 cc 3b 80 00       	push   $0x803bcc
+  8029fd:	e8 b3 00 00 00       	call   802ab5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802a02:	83 c4 18             	add    $0x18,%esp
+  802a05:	53                   	push   %ebx
+  802a06:	ff 75 10             	push   0x10(%ebp)
+  802a09:	e8 56 00 00 00       	call   802a64 <vcprintf>
+	cprintf("\n");
+  802a0e:	c7 04 24 b0 3b 80 00 	movl   $0x803bb0,(%esp)
+  802a15:	e8 9b 00 00 00       	call   802ab5 <cprintf>
+  802a1a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a1d:	cc                   	int3
+	while (1)
+  802a1e:	eb fd                	jmp    802a1d <_panic+0x43>
+
+00802a20 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a20:	55                   	push   %ebp
+  802a21:	89 e5                	mov    %esp,%ebp
+  802a23:	53                   	push   %ebx
+  802a24:	83 ec 04             	sub    $0x4,%esp
+  802a27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a2a:	8b 13                	mov    (%ebx),%edx
+  802a2c:	8d 42 01             	lea    0x1(%edx),%eax
+  802a2f:	89 03                	mov    %eax,(%ebx)
+  802a31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a34:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a38:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a3d:	74 09                	je     802a48 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a3f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a46:	c9                   	leave
+  802a47:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a48:	83 ec 08             	sub    $0x8,%esp
+  802a4b:	68 ff 00 00 00       	push   $0xff
+  802a50:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a53:	50                   	push   %eax
+  802a54:	e8 8a d6 ff ff       	call   8000e3 <sys_cputs>
+		b->idx = 0;
+  802a59:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a5f:	83 c4 10             	add    $0x10,%esp
+  802a62:	eb db                	jmp    802a3f <putch+0x1f>
+
+00802a64 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a64:	55                   	push   %ebp
+  802a65:	89 e5                	mov    %esp,%ebp
+  802a67:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a6d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a74:	00 00 00 
+	b.cnt = 0;
+  802a77:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802a7e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802a81:	ff 75 0c             	push   0xc(%ebp)
+  802a84:	ff 75 08             	push   0x8(%ebp)
+  802a87:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802a8d:	50                   	push   %eax
+  802a8e:	68 20 2a 80 00       	push   $0x802a20
+  802a93:	e8 1c 01 00 00       	call   802bb4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802a98:	83 c4 08             	add    $0x8,%esp
+  802a9b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802aa1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802aa7:	50                   	push   %eax
+  802aa8:	e8 36 d6 ff ff       	call   8000e3 <sys_cputs>
+
+	return b.cnt;
+}
+  802aad:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802ab3:	c9                   	leave
+  802ab4:	c3                   	ret
+
+00802ab5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802abb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802abe:	50                   	push   %eax
+  802abf:	ff 75 08             	push   0x8(%ebp)
+  802ac2:	e8 9d ff ff ff       	call   802a64 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802ac7:	c9                   	leave
+  802ac8:	c3                   	ret
+
+00802ac9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802ac9:	55                   	push   %ebp
+  802aca:	89 e5                	mov    %esp,%ebp
+  802acc:	57                   	push   %edi
+  802acd:	56                   	push   %esi
+  802ace:	53                   	push   %ebx
+  802acf:	83 ec 1c             	sub    $0x1c,%esp
+  802ad2:	89 c3                	mov    %eax,%ebx
+  802ad4:	89 d6                	mov    %edx,%esi
+  802ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802adc:	89 d1                	mov    %edx,%ecx
+  802ade:	89 c2                	mov    %eax,%edx
+  802ae0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ae3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802ae6:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802ae9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802aec:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802af3:	39 c2                	cmp    %eax,%edx
+  802af5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802af8:	73 4b                	jae    802b45 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802afa:	8b 45 14             	mov    0x14(%ebp),%eax
+  802afd:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b00:	85 ff                	test   %edi,%edi
+  802b02:	7e 11                	jle    802b15 <printnum+0x4c>
+			putch(padc, putdat);
+  802b04:	83 ec 08             	sub    $0x8,%esp
+  802b07:	56                   	push   %esi
+  802b08:	ff 75 18             	push   0x18(%ebp)
+  802b0b:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b0d:	83 c4 10             	add    $0x10,%esp
+  802b10:	83 ef 01             	sub    $0x1,%edi
+  802b13:	75 ef                	jne    802b04 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b15:	83 ec 08             	sub    $0x8,%esp
+  802b18:	56                   	push   %esi
+  802b19:	83 ec 04             	sub    $0x4,%esp
+  802b1c:	ff 75 e4             	push   -0x1c(%ebp)
+  802b1f:	ff 75 e0             	push   -0x20(%ebp)
+  802b22:	ff 75 dc             	push   -0x24(%ebp)
+  802b25:	ff 75 d8             	push   -0x28(%ebp)
+  802b28:	e8 33 0e 00 00       	call   803960 <__umoddi3>
+  802b2d:	83 c4 14             	add    $0x14,%esp
+  802b30:	0f be 80 ef 3b 80 00 	movsbl 0x803bef(%eax),%eax
+  802b37:	50                   	push   %eax
+  802b38:	ff d3                	call   *%ebx
+}
+  802b3a:	83 c4 10             	add    $0x10,%esp
+  802b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b40:	5b                   	pop    %ebx
+  802b41:	5e                   	pop    %esi
+  802b42:	5f                   	pop    %edi
+  802b43:	5d                   	pop    %ebp
+  802b44:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b45:	83 ec 0c             	sub    $0xc,%esp
+  802b48:	ff 75 18             	push   0x18(%ebp)
+  802b4b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b4e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b51:	52                   	push   %edx
+  802b52:	50                   	push   %eax
+  802b53:	83 ec 08             	sub    $0x8,%esp
+  802b56:	ff 75 e4             	push   -0x1c(%ebp)
+  802b59:	ff 75 e0             	push   -0x20(%ebp)
+  802b5c:	ff 75 dc             	push   -0x24(%ebp)
+  802b5f:	ff 75 d8             	push   -0x28(%ebp)
+  802b62:	e8 33 0d 00 00       	call   80389a <__udivdi3>
+  802b67:	83 c4 18             	add    $0x18,%esp
+  802b6a:	52                   	push   %edx
+  802b6b:	50                   	push   %eax
+  802b6c:	89 f2                	mov    %esi,%edx
+  802b6e:	89 d8                	mov    %ebx,%eax
+  802b70:	e8 54 ff ff ff       	call   802ac9 <printnum>
+  802b75:	83 c4 20             	add    $0x20,%esp
+  802b78:	eb 9b                	jmp    802b15 <printnum+0x4c>
+
+00802b7a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802b7a:	55                   	push   %ebp
+  802b7b:	89 e5                	mov    %esp,%ebp
+  802b7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802b80:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802b84:	8b 10                	mov    (%eax),%edx
+  802b86:	3b 50 04             	cmp    0x4(%eax),%edx
+  802b89:	73 0a                	jae    802b95 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802b8b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802b8e:	89 08                	mov    %ecx,(%eax)
+  802b90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b93:	88 02                	mov    %al,(%edx)
+}
+  802b95:	5d                   	pop    %ebp
+  802b96:	c3                   	ret
+
+00802b97 <printfmt>:
+{
+  802b97:	55                   	push   %ebp
+  802b98:	89 e5                	mov    %esp,%ebp
+  802b9a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802b9d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802ba0:	50                   	push   %eax
+  802ba1:	ff 75 10             	push   0x10(%ebp)
+  802ba4:	ff 75 0c             	push   0xc(%ebp)
+  802ba7:	ff 75 08             	push   0x8(%ebp)
+  802baa:	e8 05 00 00 00       	call   802bb4 <vprintfmt>
+}
+  802baf:	83 c4 10             	add    $0x10,%esp
+  802bb2:	c9                   	leave
+  802bb3:	c3                   	ret
+
+00802bb4 <vprintfmt>:
+{
+  802bb4:	55                   	push   %ebp
+  802bb5:	89 e5                	mov    %esp,%ebp
+  802bb7:	57                   	push   %edi
+  802bb8:	56                   	push   %esi
+  802bb9:	53                   	push   %ebx
+  802bba:	83 ec 2c             	sub    $0x2c,%esp
+  802bbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bc0:	89 df                	mov    %ebx,%edi
+  802bc2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bc8:	8d 70 01             	lea    0x1(%eax),%esi
+  802bcb:	0f b6 00             	movzbl (%eax),%eax
+  802bce:	83 f8 25             	cmp    $0x25,%eax
+  802bd1:	74 1e                	je     802bf1 <vprintfmt+0x3d>
+			if (ch == '\0')
+  802bd3:	85 c0                	test   %eax,%eax
+  802bd5:	0f 84 15 05 00 00    	je     8030f0 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802bdb:	83 ec 08             	sub    $0x8,%esp
+  802bde:	53                   	push   %ebx
+  802bdf:	50                   	push   %eax
+  802be0:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802be2:	83 c6 01             	add    $0x1,%esi
+  802be5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802be9:	83 c4 10             	add    $0x10,%esp
+  802bec:	83 f8 25             	cmp    $0x25,%eax
+  802bef:	75 e2                	jne    802bd3 <vprintfmt+0x1f>
+		padc = ' ';
+  802bf1:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802bf5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802bfc:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802c03:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c0f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c12:	8d 56 01             	lea    0x1(%esi),%edx
+  802c15:	0f b6 0e             	movzbl (%esi),%ecx
+  802c18:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c1b:	3c 55                	cmp    $0x55,%al
+  802c1d:	0f 87 3b 04 00 00    	ja     80305e <vprintfmt+0x4aa>
+  802c23:	0f b6 c0             	movzbl %al,%eax
+  802c26:	ff 24 85 60 3d 80 00 	jmp    *0x803d60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c2d:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c30:	eb 93                	jmp    802bc5 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c32:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c34:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c38:	eb d8                	jmp    802c12 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c3a:	89 d6                	mov    %edx,%esi
+  802c3c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c40:	eb d0                	jmp    802c12 <vprintfmt+0x5e>
+  802c42:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c45:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c48:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c4b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c4f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c52:	83 f9 09             	cmp    $0x9,%ecx
+  802c55:	77 6f                	ja     802cc6 <vprintfmt+0x112>
+  802c57:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c5a:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c5d:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c60:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c64:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c67:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c6a:	83 fe 09             	cmp    $0x9,%esi
+  802c6d:	76 eb                	jbe    802c5a <vprintfmt+0xa6>
+  802c6f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c72:	89 d6                	mov    %edx,%esi
+  802c74:	eb 13                	jmp    802c89 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802c76:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c79:	8b 00                	mov    (%eax),%eax
+  802c7b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c81:	8d 40 04             	lea    0x4(%eax),%eax
+  802c84:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c87:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802c89:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802c8d:	79 83                	jns    802c12 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802c8f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c92:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c95:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802c9c:	e9 71 ff ff ff       	jmp    802c12 <vprintfmt+0x5e>
+			if (width < 0)
+  802ca1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ca4:	85 c9                	test   %ecx,%ecx
+  802ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cab:	0f 49 c1             	cmovns %ecx,%eax
+  802cae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cb1:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cb3:	e9 5a ff ff ff       	jmp    802c12 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cb8:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cba:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cc1:	e9 4c ff ff ff       	jmp    802c12 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc6:	89 d6                	mov    %edx,%esi
+  802cc8:	eb bf                	jmp    802c89 <vprintfmt+0xd5>
+			lflag++;
+  802cca:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cce:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cd0:	e9 3d ff ff ff       	jmp    802c12 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802cd5:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cdb:	8d 70 04             	lea    0x4(%eax),%esi
+  802cde:	83 ec 08             	sub    $0x8,%esp
+  802ce1:	53                   	push   %ebx
+  802ce2:	ff 30                	push   (%eax)
+  802ce4:	ff d7                	call   *%edi
+			break;
+  802ce6:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802ce9:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802cec:	e9 d4 fe ff ff       	jmp    802bc5 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802cf1:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cf4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cf7:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802cfa:	8b 10                	mov    (%eax),%edx
+  802cfc:	89 d0                	mov    %edx,%eax
+  802cfe:	f7 d8                	neg    %eax
+  802d00:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802d03:	83 f8 12             	cmp    $0x12,%eax
+  802d06:	7f 23                	jg     802d2b <vprintfmt+0x177>
+  802d08:	8b 14 85 c0 3e 80 00 	mov    0x803ec0(,%eax,4),%edx
+  802d0f:	85 d2                	test   %edx,%edx
+  802d11:	74 18                	je     802d2b <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d13:	52                   	push   %edx
+  802d14:	68 7b 3b 80 00       	push   $0x803b7b
+  802d19:	53                   	push   %ebx
+  802d1a:	57                   	push   %edi
+  802d1b:	e8 77 fe ff ff       	call   802b97 <printfmt>
+  802d20:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d23:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d26:	e9 9a fe ff ff       	jmp    802bc5 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d2b:	50                   	push   %eax
+  802d2c:	68 07 3c 80 00       	push   $0x803c07
+  802d31:	53                   	push   %ebx
+  802d32:	57                   	push   %edi
+  802d33:	e8 5f fe ff ff       	call   802b97 <printfmt>
+  802d38:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d3b:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d3e:	e9 82 fe ff ff       	jmp    802bc5 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d43:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d46:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d49:	83 c0 04             	add    $0x4,%eax
+  802d4c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d4f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d52:	8b 00                	mov    (%eax),%eax
+  802d54:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	0f 84 61 03 00 00    	je     8030c0 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d5f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d63:	7e 06                	jle    802d6b <vprintfmt+0x1b7>
+  802d65:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d69:	75 29                	jne    802d94 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d6b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d6e:	8d 70 01             	lea    0x1(%eax),%esi
+  802d71:	0f b6 00             	movzbl (%eax),%eax
+  802d74:	0f be d0             	movsbl %al,%edx
+  802d77:	85 d2                	test   %edx,%edx
+  802d79:	0f 84 bb 00 00 00    	je     802e3a <vprintfmt+0x286>
+  802d7f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802d82:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802d85:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802d88:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d8b:	eb 7a                	jmp    802e07 <vprintfmt+0x253>
+				p = "(null)";
+  802d8d:	c7 45 d0 00 3c 80 00 	movl   $0x803c00,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802d94:	83 ec 08             	sub    $0x8,%esp
+  802d97:	ff 75 d4             	push   -0x2c(%ebp)
+  802d9a:	ff 75 d0             	push   -0x30(%ebp)
+  802d9d:	e8 e0 03 00 00       	call   803182 <strnlen>
+  802da2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802da5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802da8:	83 c4 10             	add    $0x10,%esp
+  802dab:	85 d2                	test   %edx,%edx
+  802dad:	0f 8e d6 02 00 00    	jle    803089 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802db3:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802db7:	83 ec 08             	sub    $0x8,%esp
+  802dba:	53                   	push   %ebx
+  802dbb:	56                   	push   %esi
+  802dbc:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dbe:	83 c4 10             	add    $0x10,%esp
+  802dc1:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802dc5:	75 f0                	jne    802db7 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dc7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dca:	8d 70 01             	lea    0x1(%eax),%esi
+  802dcd:	0f b6 00             	movzbl (%eax),%eax
+  802dd0:	0f be d0             	movsbl %al,%edx
+  802dd3:	85 d2                	test   %edx,%edx
+  802dd5:	0f 84 da 02 00 00    	je     8030b5 <vprintfmt+0x501>
+  802ddb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802dde:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802de1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802de4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802de7:	eb 1e                	jmp    802e07 <vprintfmt+0x253>
+					putch(ch, putdat);
+  802de9:	83 ec 08             	sub    $0x8,%esp
+  802dec:	ff 75 0c             	push   0xc(%ebp)
+  802def:	52                   	push   %edx
+  802df0:	ff 55 08             	call   *0x8(%ebp)
+  802df3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802df6:	83 eb 01             	sub    $0x1,%ebx
+  802df9:	83 c6 01             	add    $0x1,%esi
+  802dfc:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e00:	0f be d0             	movsbl %al,%edx
+  802e03:	85 d2                	test   %edx,%edx
+  802e05:	74 2a                	je     802e31 <vprintfmt+0x27d>
+  802e07:	85 ff                	test   %edi,%edi
+  802e09:	78 05                	js     802e10 <vprintfmt+0x25c>
+  802e0b:	83 ef 01             	sub    $0x1,%edi
+  802e0e:	78 59                	js     802e69 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e10:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e14:	74 d3                	je     802de9 <vprintfmt+0x235>
+  802e16:	0f be c0             	movsbl %al,%eax
+  802e19:	83 e8 20             	sub    $0x20,%eax
+  802e1c:	83 f8 5e             	cmp    $0x5e,%eax
+  802e1f:	76 c8                	jbe    802de9 <vprintfmt+0x235>
+					putch('?', putdat);
+  802e21:	83 ec 08             	sub    $0x8,%esp
+  802e24:	ff 75 0c             	push   0xc(%ebp)
+  802e27:	6a 3f                	push   $0x3f
+  802e29:	ff 55 08             	call   *0x8(%ebp)
+  802e2c:	83 c4 10             	add    $0x10,%esp
+  802e2f:	eb c5                	jmp    802df6 <vprintfmt+0x242>
+  802e31:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e34:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e3a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e3d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e41:	7e 1b                	jle    802e5e <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e43:	83 ec 08             	sub    $0x8,%esp
+  802e46:	53                   	push   %ebx
+  802e47:	6a 20                	push   $0x20
+  802e49:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e4b:	83 c4 10             	add    $0x10,%esp
+  802e4e:	83 ee 01             	sub    $0x1,%esi
+  802e51:	75 f0                	jne    802e43 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e53:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e56:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e59:	e9 67 fd ff ff       	jmp    802bc5 <vprintfmt+0x11>
+  802e5e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e61:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e64:	e9 5c fd ff ff       	jmp    802bc5 <vprintfmt+0x11>
+  802e69:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e72:	eb c6                	jmp    802e3a <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e74:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802e77:	89 55 10             	mov    %edx,0x10(%ebp)
+  802e7a:	83 f9 01             	cmp    $0x1,%ecx
+  802e7d:	7f 1f                	jg     802e9e <vprintfmt+0x2ea>
+	else if (lflag)
+  802e7f:	85 c9                	test   %ecx,%ecx
+  802e81:	74 67                	je     802eea <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802e83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e86:	8b 30                	mov    (%eax),%esi
+  802e88:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802e8b:	89 f0                	mov    %esi,%eax
+  802e8d:	c1 f8 1f             	sar    $0x1f,%eax
+  802e90:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802e93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e96:	8d 40 04             	lea    0x4(%eax),%eax
+  802e99:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e9c:	eb 17                	jmp    802eb5 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802e9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea1:	8b 50 04             	mov    0x4(%eax),%edx
+  802ea4:	8b 00                	mov    (%eax),%eax
+  802ea6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ea9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802eac:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eaf:	8d 40 08             	lea    0x8(%eax),%eax
+  802eb2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802eb5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802eb8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802ebb:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802ec0:	85 c9                	test   %ecx,%ecx
+  802ec2:	0f 89 12 01 00 00    	jns    802fda <vprintfmt+0x426>
+				putch('-', putdat);
+  802ec8:	83 ec 08             	sub    $0x8,%esp
+  802ecb:	53                   	push   %ebx
+  802ecc:	6a 2d                	push   $0x2d
+  802ece:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802ed0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ed3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ed6:	f7 da                	neg    %edx
+  802ed8:	83 d1 00             	adc    $0x0,%ecx
+  802edb:	f7 d9                	neg    %ecx
+  802edd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802ee0:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ee5:	e9 f0 00 00 00       	jmp    802fda <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802eea:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eed:	8b 30                	mov    (%eax),%esi
+  802eef:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802ef2:	89 f0                	mov    %esi,%eax
+  802ef4:	c1 f8 1f             	sar    $0x1f,%eax
+  802ef7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802efa:	8b 45 14             	mov    0x14(%ebp),%eax
+  802efd:	8d 40 04             	lea    0x4(%eax),%eax
+  802f00:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f03:	eb b0                	jmp    802eb5 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f05:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f08:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f0b:	83 f9 01             	cmp    $0x1,%ecx
+  802f0e:	7f 1e                	jg     802f2e <vprintfmt+0x37a>
+	else if (lflag)
+  802f10:	85 c9                	test   %ecx,%ecx
+  802f12:	74 32                	je     802f46 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f14:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f17:	8b 10                	mov    (%eax),%edx
+  802f19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f1e:	8d 40 04             	lea    0x4(%eax),%eax
+  802f21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f24:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f29:	e9 ac 00 00 00       	jmp    802fda <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f31:	8b 10                	mov    (%eax),%edx
+  802f33:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f36:	8d 40 08             	lea    0x8(%eax),%eax
+  802f39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f3c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f41:	e9 94 00 00 00       	jmp    802fda <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f46:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f49:	8b 10                	mov    (%eax),%edx
+  802f4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f50:	8d 40 04             	lea    0x4(%eax),%eax
+  802f53:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f56:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f5b:	eb 7d                	jmp    802fda <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f5d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f60:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f63:	83 f9 01             	cmp    $0x1,%ecx
+  802f66:	7f 1b                	jg     802f83 <vprintfmt+0x3cf>
+	else if (lflag)
+  802f68:	85 c9                	test   %ecx,%ecx
+  802f6a:	74 2c                	je     802f98 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f6f:	8b 10                	mov    (%eax),%edx
+  802f71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f76:	8d 40 04             	lea    0x4(%eax),%eax
+  802f79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f7c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802f81:	eb 57                	jmp    802fda <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f86:	8b 10                	mov    (%eax),%edx
+  802f88:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f8b:	8d 40 08             	lea    0x8(%eax),%eax
+  802f8e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f91:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802f96:	eb 42                	jmp    802fda <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f98:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f9b:	8b 10                	mov    (%eax),%edx
+  802f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fa2:	8d 40 04             	lea    0x4(%eax),%eax
+  802fa5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fa8:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fad:	eb 2b                	jmp    802fda <vprintfmt+0x426>
+			putch('0', putdat);
+  802faf:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fb2:	83 ec 08             	sub    $0x8,%esp
+  802fb5:	53                   	push   %ebx
+  802fb6:	6a 30                	push   $0x30
+  802fb8:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fba:	83 c4 08             	add    $0x8,%esp
+  802fbd:	53                   	push   %ebx
+  802fbe:	6a 78                	push   $0x78
+  802fc0:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fc2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc5:	8b 10                	mov    (%eax),%edx
+  802fc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802fcc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802fcf:	8d 40 04             	lea    0x4(%eax),%eax
+  802fd2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802fd5:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  802fda:	83 ec 0c             	sub    $0xc,%esp
+  802fdd:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802fe1:	50                   	push   %eax
+  802fe2:	ff 75 e4             	push   -0x1c(%ebp)
+  802fe5:	56                   	push   %esi
+  802fe6:	51                   	push   %ecx
+  802fe7:	52                   	push   %edx
+  802fe8:	89 da                	mov    %ebx,%edx
+  802fea:	89 f8                	mov    %edi,%eax
+  802fec:	e8 d8 fa ff ff       	call   802ac9 <printnum>
+			break;
+  802ff1:	83 c4 20             	add    $0x20,%esp
+  802ff4:	e9 cc fb ff ff       	jmp    802bc5 <vprintfmt+0x11>
+	if (lflag >= 2)
+  802ff9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802ffc:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fff:	83 f9 01             	cmp    $0x1,%ecx
+  803002:	7f 1b                	jg     80301f <vprintfmt+0x46b>
+	else if (lflag)
+  803004:	85 c9                	test   %ecx,%ecx
+  803006:	74 2c                	je     803034 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803008:	8b 45 14             	mov    0x14(%ebp),%eax
+  80300b:	8b 10                	mov    (%eax),%edx
+  80300d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803012:	8d 40 04             	lea    0x4(%eax),%eax
+  803015:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803018:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80301d:	eb bb                	jmp    802fda <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80301f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803022:	8b 10                	mov    (%eax),%edx
+  803024:	8b 48 04             	mov    0x4(%eax),%ecx
+  803027:	8d 40 08             	lea    0x8(%eax),%eax
+  80302a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80302d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  803032:	eb a6                	jmp    802fda <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803034:	8b 45 14             	mov    0x14(%ebp),%eax
+  803037:	8b 10                	mov    (%eax),%edx
+  803039:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80303e:	8d 40 04             	lea    0x4(%eax),%eax
+  803041:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803044:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  803049:	eb 8f                	jmp    802fda <vprintfmt+0x426>
+			putch(ch, putdat);
+  80304b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80304e:	83 ec 08             	sub    $0x8,%esp
+  803051:	53                   	push   %ebx
+  803052:	6a 25                	push   $0x25
+  803054:	ff d7                	call   *%edi
+			break;
+  803056:	83 c4 10             	add    $0x10,%esp
+  803059:	e9 67 fb ff ff       	jmp    802bc5 <vprintfmt+0x11>
+			putch('%', putdat);
+  80305e:	83 ec 08             	sub    $0x8,%esp
+  803061:	53                   	push   %ebx
+  803062:	6a 25                	push   $0x25
+  803064:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803066:	83 c4 10             	add    $0x10,%esp
+  803069:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80306d:	0f 84 ba fb ff ff    	je     802c2d <vprintfmt+0x79>
+  803073:	89 75 10             	mov    %esi,0x10(%ebp)
+  803076:	89 f0                	mov    %esi,%eax
+  803078:	83 e8 01             	sub    $0x1,%eax
+  80307b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80307f:	75 f7                	jne    803078 <vprintfmt+0x4c4>
+  803081:	89 45 10             	mov    %eax,0x10(%ebp)
+  803084:	e9 3c fb ff ff       	jmp    802bc5 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803089:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80308c:	8d 70 01             	lea    0x1(%eax),%esi
+  80308f:	0f b6 00             	movzbl (%eax),%eax
+  803092:	0f be d0             	movsbl %al,%edx
+  803095:	85 d2                	test   %edx,%edx
+  803097:	74 11                	je     8030aa <vprintfmt+0x4f6>
+  803099:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80309c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80309f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030a2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030a5:	e9 5d fd ff ff       	jmp    802e07 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030aa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030b0:	e9 10 fb ff ff       	jmp    802bc5 <vprintfmt+0x11>
+  8030b5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030bb:	e9 05 fb ff ff       	jmp    802bc5 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030c4:	7e 0a                	jle    8030d0 <vprintfmt+0x51c>
+  8030c6:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030ca:	0f 85 bd fc ff ff    	jne    802d8d <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030d0:	ba 28 00 00 00       	mov    $0x28,%edx
+  8030d5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8030da:	be 01 3c 80 00       	mov    $0x803c01,%esi
+  8030df:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030e2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030e5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030eb:	e9 17 fd ff ff       	jmp    802e07 <vprintfmt+0x253>
+}
+  8030f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f3:	5b                   	pop    %ebx
+  8030f4:	5e                   	pop    %esi
+  8030f5:	5f                   	pop    %edi
+  8030f6:	5d                   	pop    %ebp
+  8030f7:	c3                   	ret
+
+008030f8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8030f8:	55                   	push   %ebp
+  8030f9:	89 e5                	mov    %esp,%ebp
+  8030fb:	83 ec 18             	sub    $0x18,%esp
+  8030fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803101:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803104:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803107:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80310b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80310e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803115:	85 c0                	test   %eax,%eax
+  803117:	74 26                	je     80313f <vsnprintf+0x47>
+  803119:	85 d2                	test   %edx,%edx
+  80311b:	7e 22                	jle    80313f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80311d:	ff 75 14             	push   0x14(%ebp)
+  803120:	ff 75 10             	push   0x10(%ebp)
+  803123:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803126:	50                   	push   %eax
+  803127:	68 7a 2b 80 00       	push   $0x802b7a
+  80312c:	e8 83 fa ff ff       	call   802bb4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803131:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803134:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803137:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80313a:	83 c4 10             	add    $0x10,%esp
+}
+  80313d:	c9                   	leave
+  80313e:	c3                   	ret
+		return -E_INVAL;
+  80313f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803144:	eb f7                	jmp    80313d <vsnprintf+0x45>
+
+00803146 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803146:	55                   	push   %ebp
+  803147:	89 e5                	mov    %esp,%ebp
+  803149:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80314c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80314f:	50                   	push   %eax
+  803150:	ff 75 10             	push   0x10(%ebp)
+  803153:	ff 75 0c             	push   0xc(%ebp)
+  803156:	ff 75 08             	push   0x8(%ebp)
+  803159:	e8 9a ff ff ff       	call   8030f8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80315e:	c9                   	leave
+  80315f:	c3                   	ret
+
+00803160 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803160:	55                   	push   %ebp
+  803161:	89 e5                	mov    %esp,%ebp
+  803163:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803166:	80 3a 00             	cmpb   $0x0,(%edx)
+  803169:	74 10                	je     80317b <strlen+0x1b>
+  80316b:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  803170:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803173:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  803177:	75 f7                	jne    803170 <strlen+0x10>
+	return n;
+}
+  803179:	5d                   	pop    %ebp
+  80317a:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80317b:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  803180:	eb f7                	jmp    803179 <strlen+0x19>
+
+00803182 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803182:	55                   	push   %ebp
+  803183:	89 e5                	mov    %esp,%ebp
+  803185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803188:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80318b:	85 d2                	test   %edx,%edx
+  80318d:	74 16                	je     8031a5 <strnlen+0x23>
+  80318f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803194:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  803198:	74 09                	je     8031a3 <strnlen+0x21>
+		n++;
+  80319a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80319d:	39 d0                	cmp    %edx,%eax
+  80319f:	75 f3                	jne    803194 <strnlen+0x12>
+		n++;
+  8031a1:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8031a3:	5d                   	pop    %ebp
+  8031a4:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031aa:	eb f7                	jmp    8031a3 <strnlen+0x21>
+
+008031ac <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031ac:	55                   	push   %ebp
+  8031ad:	89 e5                	mov    %esp,%ebp
+  8031af:	53                   	push   %ebx
+  8031b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031bf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031c2:	83 c0 01             	add    $0x1,%eax
+  8031c5:	84 d2                	test   %dl,%dl
+  8031c7:	75 f2                	jne    8031bb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031c9:	89 c8                	mov    %ecx,%eax
+  8031cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ce:	c9                   	leave
+  8031cf:	c3                   	ret
+
+008031d0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031d0:	55                   	push   %ebp
+  8031d1:	89 e5                	mov    %esp,%ebp
+  8031d3:	53                   	push   %ebx
+  8031d4:	83 ec 10             	sub    $0x10,%esp
+  8031d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8031da:	53                   	push   %ebx
+  8031db:	e8 80 ff ff ff       	call   803160 <strlen>
+  8031e0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8031e3:	ff 75 0c             	push   0xc(%ebp)
+  8031e6:	01 d8                	add    %ebx,%eax
+  8031e8:	50                   	push   %eax
+  8031e9:	e8 be ff ff ff       	call   8031ac <strcpy>
+	return dst;
+}
+  8031ee:	89 d8                	mov    %ebx,%eax
+  8031f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031f3:	c9                   	leave
+  8031f4:	c3                   	ret
+
+008031f5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8031f5:	55                   	push   %ebp
+  8031f6:	89 e5                	mov    %esp,%ebp
+  8031f8:	56                   	push   %esi
+  8031f9:	53                   	push   %ebx
+  8031fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803200:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  803203:	85 db                	test   %ebx,%ebx
+  803205:	74 17                	je     80321e <strncpy+0x29>
+  803207:	01 f3                	add    %esi,%ebx
+  803209:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80320b:	83 c0 01             	add    $0x1,%eax
+  80320e:	0f b6 0a             	movzbl (%edx),%ecx
+  803211:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803214:	80 f9 01             	cmp    $0x1,%cl
+  803217:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80321a:	39 c3                	cmp    %eax,%ebx
+  80321c:	75 ed                	jne    80320b <strncpy+0x16>
+	}
+	return ret;
+}
+  80321e:	89 f0                	mov    %esi,%eax
+  803220:	5b                   	pop    %ebx
+  803221:	5e                   	pop    %esi
+  803222:	5d                   	pop    %ebp
+  803223:	c3                   	ret
+
+00803224 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803224:	55                   	push   %ebp
+  803225:	89 e5                	mov    %esp,%ebp
+  803227:	56                   	push   %esi
+  803228:	53                   	push   %ebx
+  803229:	8b 75 08             	mov    0x8(%ebp),%esi
+  80322c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80322f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803232:	89 f0                	mov    %esi,%eax
+  803234:	85 db                	test   %ebx,%ebx
+  803236:	74 1e                	je     803256 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  803238:	83 eb 01             	sub    $0x1,%ebx
+  80323b:	74 16                	je     803253 <strlcpy+0x2f>
+  80323d:	01 f3                	add    %esi,%ebx
+  80323f:	0f b6 0a             	movzbl (%edx),%ecx
+  803242:	84 c9                	test   %cl,%cl
+  803244:	74 0d                	je     803253 <strlcpy+0x2f>
+			*dst++ = *src++;
+  803246:	83 c2 01             	add    $0x1,%edx
+  803249:	83 c0 01             	add    $0x1,%eax
+  80324c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80324f:	39 d8                	cmp    %ebx,%eax
+  803251:	75 ec                	jne    80323f <strlcpy+0x1b>
+		*dst = '\0';
+  803253:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803256:	29 f0                	sub    %esi,%eax
+}
+  803258:	5b                   	pop    %ebx
+  803259:	5e                   	pop    %esi
+  80325a:	5d                   	pop    %ebp
+  80325b:	c3                   	ret
+
+0080325c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80325c:	55                   	push   %ebp
+  80325d:	89 e5                	mov    %esp,%ebp
+  80325f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803262:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803265:	0f b6 01             	movzbl (%ecx),%eax
+  803268:	84 c0                	test   %al,%al
+  80326a:	74 11                	je     80327d <strcmp+0x21>
+  80326c:	38 02                	cmp    %al,(%edx)
+  80326e:	75 0d                	jne    80327d <strcmp+0x21>
+		p++, q++;
+  803270:	83 c1 01             	add    $0x1,%ecx
+  803273:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803276:	0f b6 01             	movzbl (%ecx),%eax
+  803279:	84 c0                	test   %al,%al
+  80327b:	75 ef                	jne    80326c <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80327d:	0f b6 c0             	movzbl %al,%eax
+  803280:	0f b6 12             	movzbl (%edx),%edx
+  803283:	29 d0                	sub    %edx,%eax
+}
+  803285:	5d                   	pop    %ebp
+  803286:	c3                   	ret
+
+00803287 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	53                   	push   %ebx
+  80328b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80328e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803291:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  803294:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  803299:	85 d2                	test   %edx,%edx
+  80329b:	74 2e                	je     8032cb <strncmp+0x44>
+  80329d:	0f b6 01             	movzbl (%ecx),%eax
+  8032a0:	84 c0                	test   %al,%al
+  8032a2:	74 16                	je     8032ba <strncmp+0x33>
+  8032a4:	3a 03                	cmp    (%ebx),%al
+  8032a6:	75 12                	jne    8032ba <strncmp+0x33>
+		n--, p++, q++;
+  8032a8:	83 c1 01             	add    $0x1,%ecx
+  8032ab:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032ae:	83 ea 01             	sub    $0x1,%edx
+  8032b1:	75 ea                	jne    80329d <strncmp+0x16>
+		return 0;
+  8032b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b8:	eb 11                	jmp    8032cb <strncmp+0x44>
+  8032ba:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032bf:	85 d2                	test   %edx,%edx
+  8032c1:	74 08                	je     8032cb <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032c3:	0f b6 01             	movzbl (%ecx),%eax
+  8032c6:	0f b6 13             	movzbl (%ebx),%edx
+  8032c9:	29 d0                	sub    %edx,%eax
+}
+  8032cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032ce:	c9                   	leave
+  8032cf:	c3                   	ret
+
+008032d0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032d0:	55                   	push   %ebp
+  8032d1:	89 e5                	mov    %esp,%ebp
+  8032d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8032da:	0f b6 10             	movzbl (%eax),%edx
+  8032dd:	84 d2                	test   %dl,%dl
+  8032df:	74 15                	je     8032f6 <strchr+0x26>
+		if (*s == c)
+  8032e1:	38 d1                	cmp    %dl,%cl
+  8032e3:	74 0f                	je     8032f4 <strchr+0x24>
+	for (; *s; s++)
+  8032e5:	83 c0 01             	add    $0x1,%eax
+  8032e8:	0f b6 10             	movzbl (%eax),%edx
+  8032eb:	84 d2                	test   %dl,%dl
+  8032ed:	75 f2                	jne    8032e1 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8032ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f4:	5d                   	pop    %ebp
+  8032f5:	c3                   	ret
+	return 0;
+  8032f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fb:	eb f7                	jmp    8032f4 <strchr+0x24>
+
+008032fd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8032fd:	55                   	push   %ebp
+  8032fe:	89 e5                	mov    %esp,%ebp
+  803300:	53                   	push   %ebx
+  803301:	8b 45 08             	mov    0x8(%ebp),%eax
+  803304:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  803307:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  80330a:	38 d3                	cmp    %dl,%bl
+  80330c:	74 14                	je     803322 <strfind+0x25>
+  80330e:	89 d1                	mov    %edx,%ecx
+  803310:	84 db                	test   %bl,%bl
+  803312:	74 0e                	je     803322 <strfind+0x25>
+	for (; *s; s++)
+  803314:	83 c0 01             	add    $0x1,%eax
+  803317:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80331a:	38 ca                	cmp    %cl,%dl
+  80331c:	74 04                	je     803322 <strfind+0x25>
+  80331e:	84 d2                	test   %dl,%dl
+  803320:	75 f2                	jne    803314 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  803322:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803325:	c9                   	leave
+  803326:	c3                   	ret
+
+00803327 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803327:	55                   	push   %ebp
+  803328:	89 e5                	mov    %esp,%ebp
+  80332a:	57                   	push   %edi
+  80332b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80332e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  803331:	85 c9                	test   %ecx,%ecx
+  803333:	74 20                	je     803355 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803335:	89 f8                	mov    %edi,%eax
+  803337:	09 c8                	or     %ecx,%eax
+  803339:	a8 03                	test   $0x3,%al
+  80333b:	75 12                	jne    80334f <memset+0x28>
+		c &= 0xFF;
+  80333d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803341:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803347:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80334a:	fc                   	cld
+  80334b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80334d:	eb 06                	jmp    803355 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80334f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803352:	fc                   	cld
+  803353:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803355:	89 f8                	mov    %edi,%eax
+  803357:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80335a:	c9                   	leave
+  80335b:	c3                   	ret
+
+0080335c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80335c:	55                   	push   %ebp
+  80335d:	89 e5                	mov    %esp,%ebp
+  80335f:	57                   	push   %edi
+  803360:	56                   	push   %esi
+  803361:	8b 45 08             	mov    0x8(%ebp),%eax
+  803364:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803367:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80336a:	39 c6                	cmp    %eax,%esi
+  80336c:	73 32                	jae    8033a0 <memmove+0x44>
+  80336e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803371:	39 d0                	cmp    %edx,%eax
+  803373:	73 2b                	jae    8033a0 <memmove+0x44>
+		s += n;
+		d += n;
+  803375:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803378:	89 d6                	mov    %edx,%esi
+  80337a:	09 fe                	or     %edi,%esi
+  80337c:	09 ce                	or     %ecx,%esi
+  80337e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803384:	75 0e                	jne    803394 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803386:	83 ef 04             	sub    $0x4,%edi
+  803389:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80338c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80338f:	fd                   	std
+  803390:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803392:	eb 09                	jmp    80339d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803394:	83 ef 01             	sub    $0x1,%edi
+  803397:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80339a:	fd                   	std
+  80339b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80339d:	fc                   	cld
+  80339e:	eb 1a                	jmp    8033ba <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033a0:	89 f2                	mov    %esi,%edx
+  8033a2:	09 c2                	or     %eax,%edx
+  8033a4:	09 ca                	or     %ecx,%edx
+  8033a6:	f6 c2 03             	test   $0x3,%dl
+  8033a9:	75 0a                	jne    8033b5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033ab:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033ae:	89 c7                	mov    %eax,%edi
+  8033b0:	fc                   	cld
+  8033b1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033b3:	eb 05                	jmp    8033ba <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033b5:	89 c7                	mov    %eax,%edi
+  8033b7:	fc                   	cld
+  8033b8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033ba:	5e                   	pop    %esi
+  8033bb:	5f                   	pop    %edi
+  8033bc:	5d                   	pop    %ebp
+  8033bd:	c3                   	ret
+
+008033be <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033be:	55                   	push   %ebp
+  8033bf:	89 e5                	mov    %esp,%ebp
+  8033c1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033c4:	ff 75 10             	push   0x10(%ebp)
+  8033c7:	ff 75 0c             	push   0xc(%ebp)
+  8033ca:	ff 75 08             	push   0x8(%ebp)
+  8033cd:	e8 8a ff ff ff       	call   80335c <memmove>
+}
+  8033d2:	c9                   	leave
+  8033d3:	c3                   	ret
+
+008033d4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033d4:	55                   	push   %ebp
+  8033d5:	89 e5                	mov    %esp,%ebp
+  8033d7:	56                   	push   %esi
+  8033d8:	53                   	push   %ebx
+  8033d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033df:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8033e2:	85 f6                	test   %esi,%esi
+  8033e4:	74 29                	je     80340f <memcmp+0x3b>
+  8033e6:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8033e8:	0f b6 08             	movzbl (%eax),%ecx
+  8033eb:	0f b6 1a             	movzbl (%edx),%ebx
+  8033ee:	38 d9                	cmp    %bl,%cl
+  8033f0:	75 11                	jne    803403 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8033f2:	83 c0 01             	add    $0x1,%eax
+  8033f5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8033f8:	39 c6                	cmp    %eax,%esi
+  8033fa:	75 ec                	jne    8033e8 <memcmp+0x14>
+	}
+
+	return 0;
+  8033fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803401:	eb 08                	jmp    80340b <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  803403:	0f b6 c1             	movzbl %cl,%eax
+  803406:	0f b6 db             	movzbl %bl,%ebx
+  803409:	29 d8                	sub    %ebx,%eax
+}
+  80340b:	5b                   	pop    %ebx
+  80340c:	5e                   	pop    %esi
+  80340d:	5d                   	pop    %ebp
+  80340e:	c3                   	ret
+	return 0;
+  80340f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803414:	eb f5                	jmp    80340b <memcmp+0x37>
+
+00803416 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803416:	55                   	push   %ebp
+  803417:	89 e5                	mov    %esp,%ebp
+  803419:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80341f:	89 c2                	mov    %eax,%edx
+  803421:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803424:	39 d0                	cmp    %edx,%eax
+  803426:	73 0d                	jae    803435 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803428:	38 08                	cmp    %cl,(%eax)
+  80342a:	74 0d                	je     803439 <memfind+0x23>
+	for (; s < ends; s++)
+  80342c:	83 c0 01             	add    $0x1,%eax
+  80342f:	39 c2                	cmp    %eax,%edx
+  803431:	75 f5                	jne    803428 <memfind+0x12>
+  803433:	eb 06                	jmp    80343b <memfind+0x25>
+  803435:	89 c2                	mov    %eax,%edx
+  803437:	eb 02                	jmp    80343b <memfind+0x25>
+  803439:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  80343b:	89 d0                	mov    %edx,%eax
+  80343d:	5d                   	pop    %ebp
+  80343e:	c3                   	ret
+
+0080343f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80343f:	55                   	push   %ebp
+  803440:	89 e5                	mov    %esp,%ebp
+  803442:	57                   	push   %edi
+  803443:	56                   	push   %esi
+  803444:	53                   	push   %ebx
+  803445:	8b 55 08             	mov    0x8(%ebp),%edx
+  803448:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80344b:	0f b6 02             	movzbl (%edx),%eax
+  80344e:	3c 20                	cmp    $0x20,%al
+  803450:	74 04                	je     803456 <strtol+0x17>
+  803452:	3c 09                	cmp    $0x9,%al
+  803454:	75 0e                	jne    803464 <strtol+0x25>
+		s++;
+  803456:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803459:	0f b6 02             	movzbl (%edx),%eax
+  80345c:	3c 20                	cmp    $0x20,%al
+  80345e:	74 f6                	je     803456 <strtol+0x17>
+  803460:	3c 09                	cmp    $0x9,%al
+  803462:	74 f2                	je     803456 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  803464:	3c 2b                	cmp    $0x2b,%al
+  803466:	74 2a                	je     803492 <strtol+0x53>
+	int neg = 0;
+  803468:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80346d:	3c 2d                	cmp    $0x2d,%al
+  80346f:	74 2b                	je     80349c <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803471:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803477:	75 0f                	jne    803488 <strtol+0x49>
+  803479:	80 3a 30             	cmpb   $0x30,(%edx)
+  80347c:	74 28                	je     8034a6 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80347e:	85 db                	test   %ebx,%ebx
+  803480:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803485:	0f 44 d8             	cmove  %eax,%ebx
+  803488:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80348d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803490:	eb 46                	jmp    8034d8 <strtol+0x99>
+		s++;
+  803492:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803495:	bf 00 00 00 00       	mov    $0x0,%edi
+  80349a:	eb d5                	jmp    803471 <strtol+0x32>
+		s++, neg = 1;
+  80349c:	83 c2 01             	add    $0x1,%edx
+  80349f:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034a4:	eb cb                	jmp    803471 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034a6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034aa:	74 0e                	je     8034ba <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034ac:	85 db                	test   %ebx,%ebx
+  8034ae:	75 d8                	jne    803488 <strtol+0x49>
+		s++, base = 8;
+  8034b0:	83 c2 01             	add    $0x1,%edx
+  8034b3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034b8:	eb ce                	jmp    803488 <strtol+0x49>
+		s += 2, base = 16;
+  8034ba:	83 c2 02             	add    $0x2,%edx
+  8034bd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034c2:	eb c4                	jmp    803488 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034c4:	0f be c0             	movsbl %al,%eax
+  8034c7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034ca:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034cd:	7d 3a                	jge    803509 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034cf:	83 c2 01             	add    $0x1,%edx
+  8034d2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8034d6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8034d8:	0f b6 02             	movzbl (%edx),%eax
+  8034db:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8034de:	89 f3                	mov    %esi,%ebx
+  8034e0:	80 fb 09             	cmp    $0x9,%bl
+  8034e3:	76 df                	jbe    8034c4 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8034e5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8034e8:	89 f3                	mov    %esi,%ebx
+  8034ea:	80 fb 19             	cmp    $0x19,%bl
+  8034ed:	77 08                	ja     8034f7 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8034ef:	0f be c0             	movsbl %al,%eax
+  8034f2:	83 e8 57             	sub    $0x57,%eax
+  8034f5:	eb d3                	jmp    8034ca <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8034f7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8034fa:	89 f3                	mov    %esi,%ebx
+  8034fc:	80 fb 19             	cmp    $0x19,%bl
+  8034ff:	77 08                	ja     803509 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  803501:	0f be c0             	movsbl %al,%eax
+  803504:	83 e8 37             	sub    $0x37,%eax
+  803507:	eb c1                	jmp    8034ca <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803509:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80350d:	74 05                	je     803514 <strtol+0xd5>
+		*endptr = (char *) s;
+  80350f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803512:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803514:	89 c8                	mov    %ecx,%eax
+  803516:	f7 d8                	neg    %eax
+  803518:	85 ff                	test   %edi,%edi
+  80351a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80351d:	89 c8                	mov    %ecx,%eax
+  80351f:	5b                   	pop    %ebx
+  803520:	5e                   	pop    %esi
+  803521:	5f                   	pop    %edi
+  803522:	5d                   	pop    %ebp
+  803523:	c3                   	ret
+
+00803524 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803524:	55                   	push   %ebp
+  803525:	89 e5                	mov    %esp,%ebp
+  803527:	56                   	push   %esi
+  803528:	53                   	push   %ebx
+  803529:	8b 75 08             	mov    0x8(%ebp),%esi
+  80352c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80352f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803532:	85 c0                	test   %eax,%eax
+  803534:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803539:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80353c:	83 ec 0c             	sub    $0xc,%esp
+  80353f:	50                   	push   %eax
+  803540:	e8 0a ce ff ff       	call   80034f <sys_ipc_recv>
+  803545:	83 c4 10             	add    $0x10,%esp
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	0f 88 8b 00 00 00    	js     8035db <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803550:	85 f6                	test   %esi,%esi
+  803552:	74 2a                	je     80357e <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803554:	89 e2                	mov    %esp,%edx
+  803556:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80355b:	29 d0                	sub    %edx,%eax
+  80355d:	89 c2                	mov    %eax,%edx
+  80355f:	c1 ea 0f             	shr    $0xf,%edx
+  803562:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80356f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803576:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80357c:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80357e:	85 db                	test   %ebx,%ebx
+  803580:	74 2a                	je     8035ac <ipc_recv+0x88>
+  803582:	89 e2                	mov    %esp,%edx
+  803584:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803589:	29 d0                	sub    %edx,%eax
+  80358b:	89 c2                	mov    %eax,%edx
+  80358d:	c1 ea 0f             	shr    $0xf,%edx
+  803590:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80359d:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035a4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035aa:	89 03                	mov    %eax,(%ebx)
+  8035ac:	89 e2                	mov    %esp,%edx
+  8035ae:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035b3:	29 d0                	sub    %edx,%eax
+  8035b5:	89 c2                	mov    %eax,%edx
+  8035b7:	c1 ea 0f             	shr    $0xf,%edx
+  8035ba:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035c7:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035ce:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035d7:	5b                   	pop    %ebx
+  8035d8:	5e                   	pop    %esi
+  8035d9:	5d                   	pop    %ebp
+  8035da:	c3                   	ret
+		if(from_env_store != NULL)
+  8035db:	85 f6                	test   %esi,%esi
+  8035dd:	74 06                	je     8035e5 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035df:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035e5:	85 db                	test   %ebx,%ebx
+  8035e7:	74 eb                	je     8035d4 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035e9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8035ef:	eb e3                	jmp    8035d4 <ipc_recv+0xb0>
+
+008035f1 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8035f1:	55                   	push   %ebp
+  8035f2:	89 e5                	mov    %esp,%ebp
+  8035f4:	57                   	push   %edi
+  8035f5:	56                   	push   %esi
+  8035f6:	53                   	push   %ebx
+  8035f7:	83 ec 14             	sub    $0x14,%esp
+  8035fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803600:	8b 75 14             	mov    0x14(%ebp),%esi
+  803603:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803606:	85 c0                	test   %eax,%eax
+  803608:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80360d:	0f 44 c2             	cmove  %edx,%eax
+  803610:	ff 75 10             	push   0x10(%ebp)
+  803613:	50                   	push   %eax
+  803614:	e8 98 cd ff ff       	call   8003b1 <sys_ipc_recv_pages>
+  803619:	83 c4 10             	add    $0x10,%esp
+  80361c:	85 c0                	test   %eax,%eax
+  80361e:	0f 88 ba 00 00 00    	js     8036de <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803624:	85 ff                	test   %edi,%edi
+  803626:	74 2a                	je     803652 <ipc_recv_pages+0x61>
+  803628:	89 e2                	mov    %esp,%edx
+  80362a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80362f:	29 d0                	sub    %edx,%eax
+  803631:	89 c2                	mov    %eax,%edx
+  803633:	c1 ea 0f             	shr    $0xf,%edx
+  803636:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80363b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803640:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803643:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80364a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803650:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803652:	85 f6                	test   %esi,%esi
+  803654:	74 2a                	je     803680 <ipc_recv_pages+0x8f>
+  803656:	89 e2                	mov    %esp,%edx
+  803658:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80365d:	29 d0                	sub    %edx,%eax
+  80365f:	89 c2                	mov    %eax,%edx
+  803661:	c1 ea 0f             	shr    $0xf,%edx
+  803664:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803671:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803678:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80367e:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803680:	85 db                	test   %ebx,%ebx
+  803682:	74 2a                	je     8036ae <ipc_recv_pages+0xbd>
+  803684:	89 e2                	mov    %esp,%edx
+  803686:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80368b:	29 d0                	sub    %edx,%eax
+  80368d:	89 c2                	mov    %eax,%edx
+  80368f:	c1 ea 0f             	shr    $0xf,%edx
+  803692:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369c:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80369f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036a6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036ac:	89 03                	mov    %eax,(%ebx)
+  8036ae:	89 e2                	mov    %esp,%edx
+  8036b0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036b5:	29 d0                	sub    %edx,%eax
+  8036b7:	89 c2                	mov    %eax,%edx
+  8036b9:	c1 ea 0f             	shr    $0xf,%edx
+  8036bc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c6:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036c9:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036d0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d9:	5b                   	pop    %ebx
+  8036da:	5e                   	pop    %esi
+  8036db:	5f                   	pop    %edi
+  8036dc:	5d                   	pop    %ebp
+  8036dd:	c3                   	ret
+		if (from_env_store)
+  8036de:	85 ff                	test   %edi,%edi
+  8036e0:	74 06                	je     8036e8 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036e2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036e8:	85 f6                	test   %esi,%esi
+  8036ea:	74 06                	je     8036f2 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8036ec:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8036f2:	85 db                	test   %ebx,%ebx
+  8036f4:	74 e0                	je     8036d6 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8036f6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036fc:	eb d8                	jmp    8036d6 <ipc_recv_pages+0xe5>
+
+008036fe <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8036fe:	55                   	push   %ebp
+  8036ff:	89 e5                	mov    %esp,%ebp
+  803701:	57                   	push   %edi
+  803702:	56                   	push   %esi
+  803703:	53                   	push   %ebx
+  803704:	83 ec 1c             	sub    $0x1c,%esp
+  803707:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80370a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80370d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803713:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803717:	75 2b                	jne    803744 <ipc_try_send_pages+0x46>
+  803719:	89 e2                	mov    %esp,%edx
+  80371b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803720:	29 d0                	sub    %edx,%eax
+  803722:	89 c2                	mov    %eax,%edx
+  803724:	c1 ea 0f             	shr    $0xf,%edx
+  803727:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80372c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803731:	0f 42 c2             	cmovb  %edx,%eax
+  803734:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80373b:	8b 70 48             	mov    0x48(%eax),%esi
+  80373e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803744:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80374a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80374f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803752:	85 ff                	test   %edi,%edi
+  803754:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803759:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80375c:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803762:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803768:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80376e:	83 ec 0c             	sub    $0xc,%esp
+  803771:	ff 75 14             	push   0x14(%ebp)
+  803774:	ff 75 18             	push   0x18(%ebp)
+  803777:	57                   	push   %edi
+  803778:	ff 75 0c             	push   0xc(%ebp)
+  80377b:	ff 75 08             	push   0x8(%ebp)
+  80377e:	e8 0d cc ff ff       	call   800390 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803783:	83 c4 20             	add    $0x20,%esp
+  803786:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803789:	75 21                	jne    8037ac <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80378b:	83 ec 04             	sub    $0x4,%esp
+  80378e:	6a ff                	push   $0xffffffff
+  803790:	53                   	push   %ebx
+  803791:	ff 75 e4             	push   -0x1c(%ebp)
+  803794:	e8 04 ce ff ff       	call   80059d <sys_futex_wait>
+  803799:	83 c4 10             	add    $0x10,%esp
+  80379c:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80379f:	74 c7                	je     803768 <ipc_try_send_pages+0x6a>
+  8037a1:	85 c0                	test   %eax,%eax
+  8037a3:	79 c3                	jns    803768 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037a5:	e8 d6 c9 ff ff       	call   800180 <sys_yield>
+  8037aa:	eb bc                	jmp    803768 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037af:	5b                   	pop    %ebx
+  8037b0:	5e                   	pop    %esi
+  8037b1:	5f                   	pop    %edi
+  8037b2:	5d                   	pop    %ebp
+  8037b3:	c3                   	ret
+
+008037b4 <ipc_send>:
+{
+  8037b4:	55                   	push   %ebp
+  8037b5:	89 e5                	mov    %esp,%ebp
+  8037b7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037ba:	ff 75 14             	push   0x14(%ebp)
+  8037bd:	6a 01                	push   $0x1
+  8037bf:	ff 75 10             	push   0x10(%ebp)
+  8037c2:	ff 75 0c             	push   0xc(%ebp)
+  8037c5:	ff 75 08             	push   0x8(%ebp)
+  8037c8:	e8 31 ff ff ff       	call   8036fe <ipc_try_send_pages>
+  8037cd:	83 c4 20             	add    $0x20,%esp
+  8037d0:	85 c0                	test   %eax,%eax
+  8037d2:	78 02                	js     8037d6 <ipc_send+0x22>
+}
+  8037d4:	c9                   	leave
+  8037d5:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037d6:	50                   	push   %eax
+  8037d7:	68 2b 3f 80 00       	push   $0x803f2b
+  8037dc:	6a 3f                	push   $0x3f
+  8037de:	68 40 3f 80 00       	push   $0x803f40
+  8037e3:	e8 f2 f1 ff ff       	call   8029da <_panic>
+
+008037e8 <ipc_send_pages>:
+{
+  8037e8:	55                   	push   %ebp
+  8037e9:	89 e5                	mov    %esp,%ebp
+  8037eb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8037ee:	ff 75 18             	push   0x18(%ebp)
+  8037f1:	ff 75 14             	push   0x14(%ebp)
+  8037f4:	ff 75 10             	push   0x10(%ebp)
+  8037f7:	ff 75 0c             	push   0xc(%ebp)
+  8037fa:	ff 75 08             	push   0x8(%ebp)
+  8037fd:	e8 fc fe ff ff       	call   8036fe <ipc_try_send_pages>
+  803802:	83 c4 20             	add    $0x20,%esp
+  803805:	85 c0                	test   %eax,%eax
+  803807:	78 02                	js     80380b <ipc_send_pages+0x23>
+}
+  803809:	c9                   	leave
+  80380a:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80380b:	50                   	push   %eax
+  80380c:	68 4a 3f 80 00       	push   $0x803f4a
+  803811:	6a 64                	push   $0x64
+  803813:	68 40 3f 80 00       	push   $0x803f40
+  803818:	e8 bd f1 ff ff       	call   8029da <_panic>
+
+0080381d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80381d:	55                   	push   %ebp
+  80381e:	89 e5                	mov    %esp,%ebp
+  803820:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803823:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803828:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80382e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803834:	8b 52 50             	mov    0x50(%edx),%edx
+  803837:	39 ca                	cmp    %ecx,%edx
+  803839:	74 11                	je     80384c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80383b:	83 c0 01             	add    $0x1,%eax
+  80383e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803843:	75 e3                	jne    803828 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384a:	eb 0e                	jmp    80385a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80384c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803852:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803857:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80385a:	5d                   	pop    %ebp
+  80385b:	c3                   	ret
+
+0080385c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80385c:	55                   	push   %ebp
+  80385d:	89 e5                	mov    %esp,%ebp
+  80385f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803862:	89 c2                	mov    %eax,%edx
+  803864:	c1 ea 16             	shr    $0x16,%edx
+  803867:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80386e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803873:	f6 c1 01             	test   $0x1,%cl
+  803876:	74 1e                	je     803896 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803878:	c1 e8 0c             	shr    $0xc,%eax
+  80387b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803882:	a8 01                	test   $0x1,%al
+  803884:	74 10                	je     803896 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803886:	c1 e8 0c             	shr    $0xc,%eax
+  803889:	c1 e0 04             	shl    $0x4,%eax
+  80388c:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803893:	0f b7 d2             	movzwl %dx,%edx
+}
+  803896:	89 d0                	mov    %edx,%eax
+  803898:	5d                   	pop    %ebp
+  803899:	c3                   	ret
+
+0080389a <__udivdi3>:
+  80389a:	57                   	push   %edi
+  80389b:	56                   	push   %esi
+  80389c:	53                   	push   %ebx
+  80389d:	83 ec 20             	sub    $0x20,%esp
+  8038a0:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038a4:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038a8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038ac:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038b0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038b4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038b8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038bc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038cf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038d6:	00 
+  8038d7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038de:	00 
+  8038df:	eb 08                	jmp    8038e9 <__udivdi3+0x4f>
+  8038e1:	83 e9 01             	sub    $0x1,%ecx
+  8038e4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038e7:	74 68                	je     803951 <__udivdi3+0xb7>
+  8038e9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038ed:	01 c0                	add    %eax,%eax
+  8038ef:	89 c6                	mov    %eax,%esi
+  8038f1:	89 d7                	mov    %edx,%edi
+  8038f3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038f7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038fb:	0f ad d0             	shrd   %cl,%edx,%eax
+  8038fe:	d3 ea                	shr    %cl,%edx
+  803900:	f6 c1 20             	test   $0x20,%cl
+  803903:	74 04                	je     803909 <__udivdi3+0x6f>
+  803905:	89 d0                	mov    %edx,%eax
+  803907:	31 d2                	xor    %edx,%edx
+  803909:	83 e0 01             	and    $0x1,%eax
+  80390c:	89 04 24             	mov    %eax,(%esp)
+  80390f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803916:	00 
+  803917:	8b 04 24             	mov    (%esp),%eax
+  80391a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80391e:	09 f0                	or     %esi,%eax
+  803920:	09 fa                	or     %edi,%edx
+  803922:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803926:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80392a:	39 f0                	cmp    %esi,%eax
+  80392c:	89 d3                	mov    %edx,%ebx
+  80392e:	19 fb                	sbb    %edi,%ebx
+  803930:	72 af                	jb     8038e1 <__udivdi3+0x47>
+  803932:	29 f0                	sub    %esi,%eax
+  803934:	19 fa                	sbb    %edi,%edx
+  803936:	89 cf                	mov    %ecx,%edi
+  803938:	c1 ef 05             	shr    $0x5,%edi
+  80393b:	83 e7 01             	and    $0x1,%edi
+  80393e:	89 fe                	mov    %edi,%esi
+  803940:	83 f6 01             	xor    $0x1,%esi
+  803943:	d3 e6                	shl    %cl,%esi
+  803945:	d3 e7                	shl    %cl,%edi
+  803947:	09 74 24 18          	or     %esi,0x18(%esp)
+  80394b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80394f:	eb 90                	jmp    8038e1 <__udivdi3+0x47>
+  803951:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803955:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803959:	83 c4 20             	add    $0x20,%esp
+  80395c:	5b                   	pop    %ebx
+  80395d:	5e                   	pop    %esi
+  80395e:	5f                   	pop    %edi
+  80395f:	c3                   	ret
+
+00803960 <__umoddi3>:
+  803960:	57                   	push   %edi
+  803961:	56                   	push   %esi
+  803962:	53                   	push   %ebx
+  803963:	83 ec 08             	sub    $0x8,%esp
+  803966:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80396a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80396e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803972:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803976:	57                   	push   %edi
+  803977:	56                   	push   %esi
+  803978:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80397c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803980:	52                   	push   %edx
+  803981:	50                   	push   %eax
+  803982:	e8 13 ff ff ff       	call   80389a <__udivdi3>
+  803987:	89 c3                	mov    %eax,%ebx
+  803989:	0f af d6             	imul   %esi,%edx
+  80398c:	89 f9                	mov    %edi,%ecx
+  80398e:	0f af cb             	imul   %ebx,%ecx
+  803991:	01 d1                	add    %edx,%ecx
+  803993:	89 d8                	mov    %ebx,%eax
+  803995:	f7 e6                	mul    %esi
+  803997:	89 c6                	mov    %eax,%esi
+  803999:	89 d7                	mov    %edx,%edi
+  80399b:	01 cf                	add    %ecx,%edi
+  80399d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039a1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039a5:	29 f0                	sub    %esi,%eax
+  8039a7:	19 fa                	sbb    %edi,%edx
+  8039a9:	83 c4 18             	add    $0x18,%esp
+  8039ac:	5b                   	pop    %ebx
+  8039ad:	5e                   	pop    %esi
+  8039ae:	5f                   	pop    %edi
+  8039af:	c3                   	ret
+
+008039b0 <__divdi3>:
+  8039b0:	53                   	push   %ebx
+  8039b1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039b5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039b9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039bd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039c1:	85 d2                	test   %edx,%edx
+  8039c3:	78 12                	js     8039d7 <__divdi3+0x27>
+  8039c5:	85 db                	test   %ebx,%ebx
+  8039c7:	78 2e                	js     8039f7 <__divdi3+0x47>
+  8039c9:	53                   	push   %ebx
+  8039ca:	51                   	push   %ecx
+  8039cb:	52                   	push   %edx
+  8039cc:	50                   	push   %eax
+  8039cd:	e8 c8 fe ff ff       	call   80389a <__udivdi3>
+  8039d2:	83 c4 10             	add    $0x10,%esp
+  8039d5:	eb 1e                	jmp    8039f5 <__divdi3+0x45>
+  8039d7:	f7 d8                	neg    %eax
+  8039d9:	83 d2 00             	adc    $0x0,%edx
+  8039dc:	f7 da                	neg    %edx
+  8039de:	85 db                	test   %ebx,%ebx
+  8039e0:	78 2a                	js     803a0c <__divdi3+0x5c>
+  8039e2:	53                   	push   %ebx
+  8039e3:	51                   	push   %ecx
+  8039e4:	52                   	push   %edx
+  8039e5:	50                   	push   %eax
+  8039e6:	e8 af fe ff ff       	call   80389a <__udivdi3>
+  8039eb:	83 c4 10             	add    $0x10,%esp
+  8039ee:	f7 d8                	neg    %eax
+  8039f0:	83 d2 00             	adc    $0x0,%edx
+  8039f3:	f7 da                	neg    %edx
+  8039f5:	5b                   	pop    %ebx
+  8039f6:	c3                   	ret
+  8039f7:	f7 d9                	neg    %ecx
+  8039f9:	83 d3 00             	adc    $0x0,%ebx
+  8039fc:	f7 db                	neg    %ebx
+  8039fe:	53                   	push   %ebx
+  8039ff:	51                   	push   %ecx
+  803a00:	52                   	push   %edx
+  803a01:	50                   	push   %eax
+  803a02:	e8 93 fe ff ff       	call   80389a <__udivdi3>
+  803a07:	83 c4 10             	add    $0x10,%esp
+  803a0a:	eb e2                	jmp    8039ee <__divdi3+0x3e>
+  803a0c:	f7 d9                	neg    %ecx
+  803a0e:	83 d3 00             	adc    $0x0,%ebx
+  803a11:	f7 db                	neg    %ebx
+  803a13:	53                   	push   %ebx
+  803a14:	51                   	push   %ecx
+  803a15:	52                   	push   %edx
+  803a16:	50                   	push   %eax
+  803a17:	e8 7e fe ff ff       	call   80389a <__udivdi3>
+  803a1c:	83 c4 10             	add    $0x10,%esp
+  803a1f:	eb d4                	jmp    8039f5 <__divdi3+0x45>
+
+00803a21 <__moddi3>:
+  803a21:	57                   	push   %edi
+  803a22:	56                   	push   %esi
+  803a23:	53                   	push   %ebx
+  803a24:	83 ec 08             	sub    $0x8,%esp
+  803a27:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a2b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a2f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a33:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a37:	57                   	push   %edi
+  803a38:	56                   	push   %esi
+  803a39:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a3d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a41:	52                   	push   %edx
+  803a42:	50                   	push   %eax
+  803a43:	e8 68 ff ff ff       	call   8039b0 <__divdi3>
+  803a48:	89 c3                	mov    %eax,%ebx
+  803a4a:	0f af d6             	imul   %esi,%edx
+  803a4d:	89 f9                	mov    %edi,%ecx
+  803a4f:	0f af cb             	imul   %ebx,%ecx
+  803a52:	01 d1                	add    %edx,%ecx
+  803a54:	89 d8                	mov    %ebx,%eax
+  803a56:	f7 e6                	mul    %esi
+  803a58:	89 c6                	mov    %eax,%esi
+  803a5a:	89 d7                	mov    %edx,%edi
+  803a5c:	01 cf                	add    %ecx,%edi
+  803a5e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a62:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a66:	29 f0                	sub    %esi,%eax
+  803a68:	19 fa                	sbb    %edi,%edx
+  803a6a:	83 c4 18             	add    $0x18,%esp
+  803a6d:	5b                   	pop    %ebx
+  803a6e:	5e                   	pop    %esi
+  803a6f:	5f                   	pop    %edi
+  803a70:	c3                   	ret
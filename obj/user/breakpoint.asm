@@ -0,0 +1,7853 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 00 00 00       	call   800037 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800035:	cc                   	int3
+}
+  800036:	c3                   	ret
+
+00800037 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800037:	55                   	push   %ebp
+  800038:	89 e5                	mov    %esp,%ebp
+  80003a:	56                   	push   %esi
+  80003b:	53                   	push   %ebx
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800042:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800044:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800049:	29 d0                	sub    %edx,%eax
+  80004b:	89 c2                	mov    %eax,%edx
+  80004d:	c1 ea 0f             	shr    $0xf,%edx
+  800050:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005a:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80005d:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800064:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800068:	e8 ef 00 00 00       	call   80015c <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80006d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800072:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800078:	89 e1                	mov    %esp,%ecx
+  80007a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80007f:	29 ca                	sub    %ecx,%edx
+  800081:	89 d1                	mov    %edx,%ecx
+  800083:	c1 e9 0f             	shr    $0xf,%ecx
+  800086:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80008c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800091:	0f 42 d1             	cmovb  %ecx,%edx
+  800094:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800099:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a0:	85 db                	test   %ebx,%ebx
+  8000a2:	7e 07                	jle    8000ab <libmain+0x74>
+		binaryname = argv[0];
+  8000a4:	8b 06                	mov    (%esi),%eax
+  8000a6:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+  8000b0:	e8 80 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000b5:	e8 0a 00 00 00       	call   8000c4 <exit>
+}
+  8000ba:	83 c4 10             	add    $0x10,%esp
+  8000bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5d                   	pop    %ebp
+  8000c3:	c3                   	ret
+
+008000c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c4:	55                   	push   %ebp
+  8000c5:	89 e5                	mov    %esp,%ebp
+  8000c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ca:	e8 17 07 00 00       	call   8007e6 <close_all>
+	sys_env_destroy(0);
+  8000cf:	83 ec 0c             	sub    $0xc,%esp
+  8000d2:	6a 00                	push   $0x0
+  8000d4:	e8 42 00 00 00       	call   80011b <sys_env_destroy>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	c9                   	leave
+  8000dd:	c3                   	ret
+
+008000de <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	57                   	push   %edi
+  8000e2:	56                   	push   %esi
+  8000e3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ef:	89 c3                	mov    %eax,%ebx
+  8000f1:	89 c7                	mov    %eax,%edi
+  8000f3:	89 c6                	mov    %eax,%esi
+  8000f5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000f7:	5b                   	pop    %ebx
+  8000f8:	5e                   	pop    %esi
+  8000f9:	5f                   	pop    %edi
+  8000fa:	5d                   	pop    %ebp
+  8000fb:	c3                   	ret
+
+008000fc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000fc:	55                   	push   %ebp
+  8000fd:	89 e5                	mov    %esp,%ebp
+  8000ff:	57                   	push   %edi
+  800100:	56                   	push   %esi
+  800101:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800102:	ba 00 00 00 00       	mov    $0x0,%edx
+  800107:	b8 01 00 00 00       	mov    $0x1,%eax
+  80010c:	89 d1                	mov    %edx,%ecx
+  80010e:	89 d3                	mov    %edx,%ebx
+  800110:	89 d7                	mov    %edx,%edi
+  800112:	89 d6                	mov    %edx,%esi
+  800114:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800116:	5b                   	pop    %ebx
+  800117:	5e                   	pop    %esi
+  800118:	5f                   	pop    %edi
+  800119:	5d                   	pop    %ebp
+  80011a:	c3                   	ret
+
+0080011b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80011b:	55                   	push   %ebp
+  80011c:	89 e5                	mov    %esp,%ebp
+  80011e:	57                   	push   %edi
+  80011f:	56                   	push   %esi
+  800120:	53                   	push   %ebx
+  800121:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800124:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800129:	8b 55 08             	mov    0x8(%ebp),%edx
+  80012c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800131:	89 cb                	mov    %ecx,%ebx
+  800133:	89 cf                	mov    %ecx,%edi
+  800135:	89 ce                	mov    %ecx,%esi
+  800137:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800139:	85 c0                	test   %eax,%eax
+  80013b:	7f 08                	jg     800145 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80013d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800140:	5b                   	pop    %ebx
+  800141:	5e                   	pop    %esi
+  800142:	5f                   	pop    %edi
+  800143:	5d                   	pop    %ebp
+  800144:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800145:	83 ec 0c             	sub    $0xc,%esp
+  800148:	50                   	push   %eax
+  800149:	6a 03                	push   $0x3
+  80014b:	68 8a 3a 80 00       	push   $0x803a8a
+  800150:	6a 23                	push   $0x23
+  800152:	68 a7 3a 80 00       	push   $0x803aa7
+  800157:	e8 79 28 00 00       	call   8029d5 <_panic>
+
+0080015c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	57                   	push   %edi
+  800160:	56                   	push   %esi
+  800161:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800162:	ba 00 00 00 00       	mov    $0x0,%edx
+  800167:	b8 02 00 00 00       	mov    $0x2,%eax
+  80016c:	89 d1                	mov    %edx,%ecx
+  80016e:	89 d3                	mov    %edx,%ebx
+  800170:	89 d7                	mov    %edx,%edi
+  800172:	89 d6                	mov    %edx,%esi
+  800174:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800176:	5b                   	pop    %ebx
+  800177:	5e                   	pop    %esi
+  800178:	5f                   	pop    %edi
+  800179:	5d                   	pop    %ebp
+  80017a:	c3                   	ret
+
+0080017b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	56                   	push   %esi
+  800180:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800181:	ba 00 00 00 00       	mov    $0x0,%edx
+  800186:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80018b:	89 d1                	mov    %edx,%ecx
+  80018d:	89 d3                	mov    %edx,%ebx
+  80018f:	89 d7                	mov    %edx,%edi
+  800191:	89 d6                	mov    %edx,%esi
+  800193:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800195:	5b                   	pop    %ebx
+  800196:	5e                   	pop    %esi
+  800197:	5f                   	pop    %edi
+  800198:	5d                   	pop    %ebp
+  800199:	c3                   	ret
+
+0080019a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80019a:	55                   	push   %ebp
+  80019b:	89 e5                	mov    %esp,%ebp
+  80019d:	57                   	push   %edi
+  80019e:	56                   	push   %esi
+  80019f:	53                   	push   %ebx
+  8001a0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ae:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b6:	89 f7                	mov    %esi,%edi
+  8001b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ba:	85 c0                	test   %eax,%eax
+  8001bc:	7f 08                	jg     8001c6 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c1:	5b                   	pop    %ebx
+  8001c2:	5e                   	pop    %esi
+  8001c3:	5f                   	pop    %edi
+  8001c4:	5d                   	pop    %ebp
+  8001c5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c6:	83 ec 0c             	sub    $0xc,%esp
+  8001c9:	50                   	push   %eax
+  8001ca:	6a 04                	push   $0x4
+  8001cc:	68 8a 3a 80 00       	push   $0x803a8a
+  8001d1:	6a 23                	push   $0x23
+  8001d3:	68 a7 3a 80 00       	push   $0x803aa7
+  8001d8:	e8 f8 27 00 00       	call   8029d5 <_panic>
+
+008001dd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	57                   	push   %edi
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+  8001e3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ec:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001f7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001fc:	85 c0                	test   %eax,%eax
+  8001fe:	7f 08                	jg     800208 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800203:	5b                   	pop    %ebx
+  800204:	5e                   	pop    %esi
+  800205:	5f                   	pop    %edi
+  800206:	5d                   	pop    %ebp
+  800207:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800208:	83 ec 0c             	sub    $0xc,%esp
+  80020b:	50                   	push   %eax
+  80020c:	6a 05                	push   $0x5
+  80020e:	68 8a 3a 80 00       	push   $0x803a8a
+  800213:	6a 23                	push   $0x23
+  800215:	68 a7 3a 80 00       	push   $0x803aa7
+  80021a:	e8 b6 27 00 00       	call   8029d5 <_panic>
+
+0080021f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80021f:	55                   	push   %ebp
+  800220:	89 e5                	mov    %esp,%ebp
+  800222:	57                   	push   %edi
+  800223:	56                   	push   %esi
+  800224:	53                   	push   %ebx
+  800225:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800228:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800230:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800233:	b8 06 00 00 00       	mov    $0x6,%eax
+  800238:	89 df                	mov    %ebx,%edi
+  80023a:	89 de                	mov    %ebx,%esi
+  80023c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80023e:	85 c0                	test   %eax,%eax
+  800240:	7f 08                	jg     80024a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800242:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800245:	5b                   	pop    %ebx
+  800246:	5e                   	pop    %esi
+  800247:	5f                   	pop    %edi
+  800248:	5d                   	pop    %ebp
+  800249:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024a:	83 ec 0c             	sub    $0xc,%esp
+  80024d:	50                   	push   %eax
+  80024e:	6a 06                	push   $0x6
+  800250:	68 8a 3a 80 00       	push   $0x803a8a
+  800255:	6a 23                	push   $0x23
+  800257:	68 a7 3a 80 00       	push   $0x803aa7
+  80025c:	e8 74 27 00 00       	call   8029d5 <_panic>
+
+00800261 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800261:	55                   	push   %ebp
+  800262:	89 e5                	mov    %esp,%ebp
+  800264:	57                   	push   %edi
+  800265:	56                   	push   %esi
+  800266:	53                   	push   %ebx
+  800267:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80026a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80026f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800272:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800275:	b8 08 00 00 00       	mov    $0x8,%eax
+  80027a:	89 df                	mov    %ebx,%edi
+  80027c:	89 de                	mov    %ebx,%esi
+  80027e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800280:	85 c0                	test   %eax,%eax
+  800282:	7f 08                	jg     80028c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800287:	5b                   	pop    %ebx
+  800288:	5e                   	pop    %esi
+  800289:	5f                   	pop    %edi
+  80028a:	5d                   	pop    %ebp
+  80028b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	50                   	push   %eax
+  800290:	6a 08                	push   $0x8
+  800292:	68 8a 3a 80 00       	push   $0x803a8a
+  800297:	6a 23                	push   $0x23
+  800299:	68 a7 3a 80 00       	push   $0x803aa7
+  80029e:	e8 32 27 00 00       	call   8029d5 <_panic>
+
+008002a3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002a3:	55                   	push   %ebp
+  8002a4:	89 e5                	mov    %esp,%ebp
+  8002a6:	57                   	push   %edi
+  8002a7:	56                   	push   %esi
+  8002a8:	53                   	push   %ebx
+  8002a9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002bc:	89 df                	mov    %ebx,%edi
+  8002be:	89 de                	mov    %ebx,%esi
+  8002c0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002c2:	85 c0                	test   %eax,%eax
+  8002c4:	7f 08                	jg     8002ce <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c9:	5b                   	pop    %ebx
+  8002ca:	5e                   	pop    %esi
+  8002cb:	5f                   	pop    %edi
+  8002cc:	5d                   	pop    %ebp
+  8002cd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ce:	83 ec 0c             	sub    $0xc,%esp
+  8002d1:	50                   	push   %eax
+  8002d2:	6a 09                	push   $0x9
+  8002d4:	68 8a 3a 80 00       	push   $0x803a8a
+  8002d9:	6a 23                	push   $0x23
+  8002db:	68 a7 3a 80 00       	push   $0x803aa7
+  8002e0:	e8 f0 26 00 00       	call   8029d5 <_panic>
+
+008002e5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002e5:	55                   	push   %ebp
+  8002e6:	89 e5                	mov    %esp,%ebp
+  8002e8:	57                   	push   %edi
+  8002e9:	56                   	push   %esi
+  8002ea:	53                   	push   %ebx
+  8002eb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002fe:	89 df                	mov    %ebx,%edi
+  800300:	89 de                	mov    %ebx,%esi
+  800302:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800304:	85 c0                	test   %eax,%eax
+  800306:	7f 08                	jg     800310 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800308:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030b:	5b                   	pop    %ebx
+  80030c:	5e                   	pop    %esi
+  80030d:	5f                   	pop    %edi
+  80030e:	5d                   	pop    %ebp
+  80030f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800310:	83 ec 0c             	sub    $0xc,%esp
+  800313:	50                   	push   %eax
+  800314:	6a 0a                	push   $0xa
+  800316:	68 8a 3a 80 00       	push   $0x803a8a
+  80031b:	6a 23                	push   $0x23
+  80031d:	68 a7 3a 80 00       	push   $0x803aa7
+  800322:	e8 ae 26 00 00       	call   8029d5 <_panic>
+
+00800327 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800327:	55                   	push   %ebp
+  800328:	89 e5                	mov    %esp,%ebp
+  80032a:	57                   	push   %edi
+  80032b:	56                   	push   %esi
+  80032c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80032d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800330:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800333:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800338:	be 00 00 00 00       	mov    $0x0,%esi
+  80033d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800340:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800343:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800345:	5b                   	pop    %ebx
+  800346:	5e                   	pop    %esi
+  800347:	5f                   	pop    %edi
+  800348:	5d                   	pop    %ebp
+  800349:	c3                   	ret
+
+0080034a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80034a:	55                   	push   %ebp
+  80034b:	89 e5                	mov    %esp,%ebp
+  80034d:	57                   	push   %edi
+  80034e:	56                   	push   %esi
+  80034f:	53                   	push   %ebx
+  800350:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800353:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800358:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800360:	89 cb                	mov    %ecx,%ebx
+  800362:	89 cf                	mov    %ecx,%edi
+  800364:	89 ce                	mov    %ecx,%esi
+  800366:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	7f 08                	jg     800374 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80036c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036f:	5b                   	pop    %ebx
+  800370:	5e                   	pop    %esi
+  800371:	5f                   	pop    %edi
+  800372:	5d                   	pop    %ebp
+  800373:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800374:	83 ec 0c             	sub    $0xc,%esp
+  800377:	50                   	push   %eax
+  800378:	6a 0d                	push   $0xd
+  80037a:	68 8a 3a 80 00       	push   $0x803a8a
+  80037f:	6a 23                	push   $0x23
+  800381:	68 a7 3a 80 00       	push   $0x803aa7
+  800386:	e8 4a 26 00 00       	call   8029d5 <_panic>
+
+0080038b <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80038b:	55                   	push   %ebp
+  80038c:	89 e5                	mov    %esp,%ebp
+  80038e:	57                   	push   %edi
+  80038f:	56                   	push   %esi
+  800390:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800391:	8b 55 08             	mov    0x8(%ebp),%edx
+  800394:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800397:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80039c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80039f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003a2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003a5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003a7:	5b                   	pop    %ebx
+  8003a8:	5e                   	pop    %esi
+  8003a9:	5f                   	pop    %edi
+  8003aa:	5d                   	pop    %ebp
+  8003ab:	c3                   	ret
+
+008003ac <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003ac:	55                   	push   %ebp
+  8003ad:	89 e5                	mov    %esp,%ebp
+  8003af:	57                   	push   %edi
+  8003b0:	56                   	push   %esi
+  8003b1:	53                   	push   %ebx
+  8003b2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003c5:	89 df                	mov    %ebx,%edi
+  8003c7:	89 de                	mov    %ebx,%esi
+  8003c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003cb:	85 c0                	test   %eax,%eax
+  8003cd:	7f 08                	jg     8003d7 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d2:	5b                   	pop    %ebx
+  8003d3:	5e                   	pop    %esi
+  8003d4:	5f                   	pop    %edi
+  8003d5:	5d                   	pop    %ebp
+  8003d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003d7:	83 ec 0c             	sub    $0xc,%esp
+  8003da:	50                   	push   %eax
+  8003db:	6a 0d                	push   $0xd
+  8003dd:	68 8a 3a 80 00       	push   $0x803a8a
+  8003e2:	6a 23                	push   $0x23
+  8003e4:	68 a7 3a 80 00       	push   $0x803aa7
+  8003e9:	e8 e7 25 00 00       	call   8029d5 <_panic>
+
+008003ee <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8003ee:	55                   	push   %ebp
+  8003ef:	89 e5                	mov    %esp,%ebp
+  8003f1:	57                   	push   %edi
+  8003f2:	56                   	push   %esi
+  8003f3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003fe:	89 d1                	mov    %edx,%ecx
+  800400:	89 d3                	mov    %edx,%ebx
+  800402:	89 d7                	mov    %edx,%edi
+  800404:	89 d6                	mov    %edx,%esi
+  800406:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800408:	5b                   	pop    %ebx
+  800409:	5e                   	pop    %esi
+  80040a:	5f                   	pop    %edi
+  80040b:	5d                   	pop    %ebp
+  80040c:	c3                   	ret
+
+0080040d <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	57                   	push   %edi
+  800411:	56                   	push   %esi
+  800412:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800413:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80041b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800423:	89 df                	mov    %ebx,%edi
+  800425:	89 de                	mov    %ebx,%esi
+  800427:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800429:	5b                   	pop    %ebx
+  80042a:	5e                   	pop    %esi
+  80042b:	5f                   	pop    %edi
+  80042c:	5d                   	pop    %ebp
+  80042d:	c3                   	ret
+
+0080042e <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80042e:	55                   	push   %ebp
+  80042f:	89 e5                	mov    %esp,%ebp
+  800431:	57                   	push   %edi
+  800432:	56                   	push   %esi
+  800433:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800434:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800441:	89 cb                	mov    %ecx,%ebx
+  800443:	89 cf                	mov    %ecx,%edi
+  800445:	89 ce                	mov    %ecx,%esi
+  800447:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800449:	5b                   	pop    %ebx
+  80044a:	5e                   	pop    %esi
+  80044b:	5f                   	pop    %edi
+  80044c:	5d                   	pop    %ebp
+  80044d:	c3                   	ret
+
+0080044e <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80044e:	55                   	push   %ebp
+  80044f:	89 e5                	mov    %esp,%ebp
+  800451:	57                   	push   %edi
+  800452:	56                   	push   %esi
+  800453:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80045f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800464:	89 df                	mov    %ebx,%edi
+  800466:	89 de                	mov    %ebx,%esi
+  800468:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80046a:	5b                   	pop    %ebx
+  80046b:	5e                   	pop    %esi
+  80046c:	5f                   	pop    %edi
+  80046d:	5d                   	pop    %ebp
+  80046e:	c3                   	ret
+
+0080046f <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80046f:	55                   	push   %ebp
+  800470:	89 e5                	mov    %esp,%ebp
+  800472:	57                   	push   %edi
+  800473:	56                   	push   %esi
+  800474:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800475:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80047a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80047d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800480:	b8 12 00 00 00       	mov    $0x12,%eax
+  800485:	89 df                	mov    %ebx,%edi
+  800487:	89 de                	mov    %ebx,%esi
+  800489:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80048b:	5b                   	pop    %ebx
+  80048c:	5e                   	pop    %esi
+  80048d:	5f                   	pop    %edi
+  80048e:	5d                   	pop    %ebp
+  80048f:	c3                   	ret
+
+00800490 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800490:	55                   	push   %ebp
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	57                   	push   %edi
+  800494:	56                   	push   %esi
+  800495:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800496:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80049b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049e:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004a3:	89 cb                	mov    %ecx,%ebx
+  8004a5:	89 cf                	mov    %ecx,%edi
+  8004a7:	89 ce                	mov    %ecx,%esi
+  8004a9:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004ab:	5b                   	pop    %ebx
+  8004ac:	5e                   	pop    %esi
+  8004ad:	5f                   	pop    %edi
+  8004ae:	5d                   	pop    %ebp
+  8004af:	c3                   	ret
+
+008004b0 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004b0:	55                   	push   %ebp
+  8004b1:	89 e5                	mov    %esp,%ebp
+  8004b3:	57                   	push   %edi
+  8004b4:	56                   	push   %esi
+  8004b5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004c6:	89 df                	mov    %ebx,%edi
+  8004c8:	89 de                	mov    %ebx,%esi
+  8004ca:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004cc:	5b                   	pop    %ebx
+  8004cd:	5e                   	pop    %esi
+  8004ce:	5f                   	pop    %edi
+  8004cf:	5d                   	pop    %ebp
+  8004d0:	c3                   	ret
+
+008004d1 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004d1:	55                   	push   %ebp
+  8004d2:	89 e5                	mov    %esp,%ebp
+  8004d4:	57                   	push   %edi
+  8004d5:	56                   	push   %esi
+  8004d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004df:	b8 15 00 00 00       	mov    $0x15,%eax
+  8004e4:	89 cb                	mov    %ecx,%ebx
+  8004e6:	89 cf                	mov    %ecx,%edi
+  8004e8:	89 ce                	mov    %ecx,%esi
+  8004ea:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8004ec:	5b                   	pop    %ebx
+  8004ed:	5e                   	pop    %esi
+  8004ee:	5f                   	pop    %edi
+  8004ef:	5d                   	pop    %ebp
+  8004f0:	c3                   	ret
+
+008004f1 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8004f1:	55                   	push   %ebp
+  8004f2:	89 e5                	mov    %esp,%ebp
+  8004f4:	57                   	push   %edi
+  8004f5:	56                   	push   %esi
+  8004f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8004fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800502:	b8 16 00 00 00       	mov    $0x16,%eax
+  800507:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80050a:	89 f7                	mov    %esi,%edi
+  80050c:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80050e:	5b                   	pop    %ebx
+  80050f:	5e                   	pop    %esi
+  800510:	5f                   	pop    %edi
+  800511:	5d                   	pop    %ebp
+  800512:	c3                   	ret
+
+00800513 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800513:	55                   	push   %ebp
+  800514:	89 e5                	mov    %esp,%ebp
+  800516:	57                   	push   %edi
+  800517:	56                   	push   %esi
+  800518:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800519:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800524:	b8 17 00 00 00       	mov    $0x17,%eax
+  800529:	89 df                	mov    %ebx,%edi
+  80052b:	89 de                	mov    %ebx,%esi
+  80052d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80052f:	5b                   	pop    %ebx
+  800530:	5e                   	pop    %esi
+  800531:	5f                   	pop    %edi
+  800532:	5d                   	pop    %ebp
+  800533:	c3                   	ret
+
+00800534 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800534:	55                   	push   %ebp
+  800535:	89 e5                	mov    %esp,%ebp
+  800537:	57                   	push   %edi
+  800538:	56                   	push   %esi
+  800539:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80053a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80053f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800542:	b8 18 00 00 00       	mov    $0x18,%eax
+  800547:	89 cb                	mov    %ecx,%ebx
+  800549:	89 cf                	mov    %ecx,%edi
+  80054b:	89 ce                	mov    %ecx,%esi
+  80054d:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80054f:	5b                   	pop    %ebx
+  800550:	5e                   	pop    %esi
+  800551:	5f                   	pop    %edi
+  800552:	5d                   	pop    %ebp
+  800553:	c3                   	ret
+
+00800554 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800554:	55                   	push   %ebp
+  800555:	89 e5                	mov    %esp,%ebp
+  800557:	57                   	push   %edi
+  800558:	56                   	push   %esi
+  800559:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80055a:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80055e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800563:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800566:	b8 19 00 00 00       	mov    $0x19,%eax
+  80056b:	89 df                	mov    %ebx,%edi
+  80056d:	89 de                	mov    %ebx,%esi
+  80056f:	cd 30                	int    $0x30
+}
+  800571:	5b                   	pop    %ebx
+  800572:	5e                   	pop    %esi
+  800573:	5f                   	pop    %edi
+  800574:	5d                   	pop    %ebp
+  800575:	c3                   	ret
+
+00800576 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  800576:	55                   	push   %ebp
+  800577:	89 e5                	mov    %esp,%ebp
+  800579:	57                   	push   %edi
+  80057a:	56                   	push   %esi
+  80057b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80057c:	be 00 00 00 00       	mov    $0x0,%esi
+  800581:	8b 55 08             	mov    0x8(%ebp),%edx
+  800584:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800587:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80058c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80058f:	89 f7                	mov    %esi,%edi
+  800591:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  800593:	5b                   	pop    %ebx
+  800594:	5e                   	pop    %esi
+  800595:	5f                   	pop    %edi
+  800596:	5d                   	pop    %ebp
+  800597:	c3                   	ret
+
+00800598 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  800598:	55                   	push   %ebp
+  800599:	89 e5                	mov    %esp,%ebp
+  80059b:	57                   	push   %edi
+  80059c:	56                   	push   %esi
+  80059d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80059e:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005b1:	89 f7                	mov    %esi,%edi
+  8005b3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005b5:	5b                   	pop    %ebx
+  8005b6:	5e                   	pop    %esi
+  8005b7:	5f                   	pop    %edi
+  8005b8:	5d                   	pop    %ebp
+  8005b9:	c3                   	ret
+
+008005ba <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005ba:	55                   	push   %ebp
+  8005bb:	89 e5                	mov    %esp,%ebp
+  8005bd:	57                   	push   %edi
+  8005be:	56                   	push   %esi
+  8005bf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005d0:	89 df                	mov    %ebx,%edi
+  8005d2:	89 de                	mov    %ebx,%esi
+  8005d4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005d6:	5b                   	pop    %ebx
+  8005d7:	5e                   	pop    %esi
+  8005d8:	5f                   	pop    %edi
+  8005d9:	5d                   	pop    %ebp
+  8005da:	c3                   	ret
+
+008005db <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005db:	55                   	push   %ebp
+  8005dc:	89 e5                	mov    %esp,%ebp
+  8005de:	57                   	push   %edi
+  8005df:	56                   	push   %esi
+  8005e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ec:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8005f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005f4:	89 f7                	mov    %esi,%edi
+  8005f6:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8005f8:	5b                   	pop    %ebx
+  8005f9:	5e                   	pop    %esi
+  8005fa:	5f                   	pop    %edi
+  8005fb:	5d                   	pop    %ebp
+  8005fc:	c3                   	ret
+
+008005fd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8005fd:	55                   	push   %ebp
+  8005fe:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800600:	8b 45 08             	mov    0x8(%ebp),%eax
+  800603:	05 00 00 00 30       	add    $0x30000000,%eax
+  800608:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80060b:	5d                   	pop    %ebp
+  80060c:	c3                   	ret
+
+0080060d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80060d:	55                   	push   %ebp
+  80060e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800610:	8b 45 08             	mov    0x8(%ebp),%eax
+  800613:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800618:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80061d:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800622:	5d                   	pop    %ebp
+  800623:	c3                   	ret
+
+00800624 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800624:	55                   	push   %ebp
+  800625:	89 e5                	mov    %esp,%ebp
+  800627:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80062c:	89 c2                	mov    %eax,%edx
+  80062e:	c1 ea 16             	shr    $0x16,%edx
+  800631:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800638:	f6 c2 01             	test   $0x1,%dl
+  80063b:	74 29                	je     800666 <fd_alloc+0x42>
+  80063d:	89 c2                	mov    %eax,%edx
+  80063f:	c1 ea 0c             	shr    $0xc,%edx
+  800642:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800649:	f6 c2 01             	test   $0x1,%dl
+  80064c:	74 18                	je     800666 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80064e:	05 00 10 00 00       	add    $0x1000,%eax
+  800653:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  800658:	75 d2                	jne    80062c <fd_alloc+0x8>
+  80065a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80065f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800664:	eb 05                	jmp    80066b <fd_alloc+0x47>
+			return 0;
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80066b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066e:	89 02                	mov    %eax,(%edx)
+}
+  800670:	89 c8                	mov    %ecx,%eax
+  800672:	5d                   	pop    %ebp
+  800673:	c3                   	ret
+
+00800674 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800674:	55                   	push   %ebp
+  800675:	89 e5                	mov    %esp,%ebp
+  800677:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80067a:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80067f:	77 30                	ja     8006b1 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800681:	c1 e0 0c             	shl    $0xc,%eax
+  800684:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  800689:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80068f:	f6 c2 01             	test   $0x1,%dl
+  800692:	74 24                	je     8006b8 <fd_lookup+0x44>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	c1 ea 0c             	shr    $0xc,%edx
+  800699:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006a0:	f6 c2 01             	test   $0x1,%dl
+  8006a3:	74 1a                	je     8006bf <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006a8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006af:	5d                   	pop    %ebp
+  8006b0:	c3                   	ret
+		return -E_INVAL;
+  8006b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006b6:	eb f7                	jmp    8006af <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006bd:	eb f0                	jmp    8006af <fd_lookup+0x3b>
+  8006bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c4:	eb e9                	jmp    8006af <fd_lookup+0x3b>
+
+008006c6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006c6:	55                   	push   %ebp
+  8006c7:	89 e5                	mov    %esp,%ebp
+  8006c9:	53                   	push   %ebx
+  8006ca:	83 ec 04             	sub    $0x4,%esp
+  8006cd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d5:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8006da:	39 13                	cmp    %edx,(%ebx)
+  8006dc:	74 54                	je     800732 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8006de:	83 c0 01             	add    $0x1,%eax
+  8006e1:	8b 1c 85 34 3b 80 00 	mov    0x803b34(,%eax,4),%ebx
+  8006e8:	85 db                	test   %ebx,%ebx
+  8006ea:	75 ee                	jne    8006da <dev_lookup+0x14>
+  8006ec:	89 e1                	mov    %esp,%ecx
+  8006ee:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8006f3:	29 c8                	sub    %ecx,%eax
+  8006f5:	89 c1                	mov    %eax,%ecx
+  8006f7:	c1 e9 0f             	shr    $0xf,%ecx
+  8006fa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8006ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800704:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800707:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80070e:	8b 40 48             	mov    0x48(%eax),%eax
+  800711:	83 ec 04             	sub    $0x4,%esp
+  800714:	52                   	push   %edx
+  800715:	50                   	push   %eax
+  800716:	68 b8 3a 80 00       	push   $0x803ab8
+  80071b:	e8 90 23 00 00       	call   802ab0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800720:	83 c4 10             	add    $0x10,%esp
+  800723:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800728:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80072b:	89 1a                	mov    %ebx,(%edx)
+}
+  80072d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800730:	c9                   	leave
+  800731:	c3                   	ret
+			return 0;
+  800732:	b8 00 00 00 00       	mov    $0x0,%eax
+  800737:	eb ef                	jmp    800728 <dev_lookup+0x62>
+
+00800739 <fd_close>:
+{
+  800739:	55                   	push   %ebp
+  80073a:	89 e5                	mov    %esp,%ebp
+  80073c:	57                   	push   %edi
+  80073d:	56                   	push   %esi
+  80073e:	53                   	push   %ebx
+  80073f:	83 ec 24             	sub    $0x24,%esp
+  800742:	8b 75 08             	mov    0x8(%ebp),%esi
+  800745:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800748:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80074b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80074c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800752:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800755:	50                   	push   %eax
+  800756:	e8 19 ff ff ff       	call   800674 <fd_lookup>
+  80075b:	89 c3                	mov    %eax,%ebx
+  80075d:	83 c4 10             	add    $0x10,%esp
+  800760:	85 c0                	test   %eax,%eax
+  800762:	78 05                	js     800769 <fd_close+0x30>
+	    || fd != fd2)
+  800764:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800767:	74 0f                	je     800778 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  800769:	85 ff                	test   %edi,%edi
+  80076b:	0f 44 df             	cmove  %edi,%ebx
+}
+  80076e:	89 d8                	mov    %ebx,%eax
+  800770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800773:	5b                   	pop    %ebx
+  800774:	5e                   	pop    %esi
+  800775:	5f                   	pop    %edi
+  800776:	5d                   	pop    %ebp
+  800777:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800778:	83 ec 08             	sub    $0x8,%esp
+  80077b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80077e:	50                   	push   %eax
+  80077f:	ff 36                	push   (%esi)
+  800781:	e8 40 ff ff ff       	call   8006c6 <dev_lookup>
+  800786:	89 c3                	mov    %eax,%ebx
+  800788:	83 c4 10             	add    $0x10,%esp
+  80078b:	85 c0                	test   %eax,%eax
+  80078d:	78 1a                	js     8007a9 <fd_close+0x70>
+		if (dev->dev_close)
+  80078f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800792:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800795:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80079a:	85 c0                	test   %eax,%eax
+  80079c:	74 0b                	je     8007a9 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80079e:	83 ec 0c             	sub    $0xc,%esp
+  8007a1:	56                   	push   %esi
+  8007a2:	ff d0                	call   *%eax
+  8007a4:	89 c3                	mov    %eax,%ebx
+  8007a6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007a9:	83 ec 08             	sub    $0x8,%esp
+  8007ac:	56                   	push   %esi
+  8007ad:	6a 00                	push   $0x0
+  8007af:	e8 6b fa ff ff       	call   80021f <sys_page_unmap>
+	return r;
+  8007b4:	83 c4 10             	add    $0x10,%esp
+  8007b7:	eb b5                	jmp    80076e <fd_close+0x35>
+
+008007b9 <close>:
+
+int
+close(int fdnum)
+{
+  8007b9:	55                   	push   %ebp
+  8007ba:	89 e5                	mov    %esp,%ebp
+  8007bc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007c2:	50                   	push   %eax
+  8007c3:	ff 75 08             	push   0x8(%ebp)
+  8007c6:	e8 a9 fe ff ff       	call   800674 <fd_lookup>
+  8007cb:	83 c4 10             	add    $0x10,%esp
+  8007ce:	85 c0                	test   %eax,%eax
+  8007d0:	79 02                	jns    8007d4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007d2:	c9                   	leave
+  8007d3:	c3                   	ret
+		return fd_close(fd, 1);
+  8007d4:	83 ec 08             	sub    $0x8,%esp
+  8007d7:	6a 01                	push   $0x1
+  8007d9:	ff 75 f4             	push   -0xc(%ebp)
+  8007dc:	e8 58 ff ff ff       	call   800739 <fd_close>
+  8007e1:	83 c4 10             	add    $0x10,%esp
+  8007e4:	eb ec                	jmp    8007d2 <close+0x19>
+
+008007e6 <close_all>:
+
+void
+close_all(void)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	53                   	push   %ebx
+  8007ea:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007f2:	83 ec 0c             	sub    $0xc,%esp
+  8007f5:	53                   	push   %ebx
+  8007f6:	e8 be ff ff ff       	call   8007b9 <close>
+	for (i = 0; i < MAXFD; i++)
+  8007fb:	83 c3 01             	add    $0x1,%ebx
+  8007fe:	83 c4 10             	add    $0x10,%esp
+  800801:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800807:	75 e9                	jne    8007f2 <close_all+0xc>
+}
+  800809:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080c:	c9                   	leave
+  80080d:	c3                   	ret
+
+0080080e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	57                   	push   %edi
+  800812:	56                   	push   %esi
+  800813:	53                   	push   %ebx
+  800814:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800817:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80081a:	50                   	push   %eax
+  80081b:	ff 75 08             	push   0x8(%ebp)
+  80081e:	e8 51 fe ff ff       	call   800674 <fd_lookup>
+  800823:	89 c3                	mov    %eax,%ebx
+  800825:	83 c4 10             	add    $0x10,%esp
+  800828:	85 c0                	test   %eax,%eax
+  80082a:	78 7f                	js     8008ab <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80082c:	83 ec 0c             	sub    $0xc,%esp
+  80082f:	ff 75 0c             	push   0xc(%ebp)
+  800832:	e8 82 ff ff ff       	call   8007b9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800837:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80083a:	c1 e6 0c             	shl    $0xc,%esi
+  80083d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800843:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800846:	89 3c 24             	mov    %edi,(%esp)
+  800849:	e8 bf fd ff ff       	call   80060d <fd2data>
+  80084e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800850:	89 34 24             	mov    %esi,(%esp)
+  800853:	e8 b5 fd ff ff       	call   80060d <fd2data>
+  800858:	83 c4 10             	add    $0x10,%esp
+  80085b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80085e:	89 d8                	mov    %ebx,%eax
+  800860:	c1 e8 16             	shr    $0x16,%eax
+  800863:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80086a:	a8 01                	test   $0x1,%al
+  80086c:	74 11                	je     80087f <dup+0x71>
+  80086e:	89 d8                	mov    %ebx,%eax
+  800870:	c1 e8 0c             	shr    $0xc,%eax
+  800873:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80087a:	f6 c2 01             	test   $0x1,%dl
+  80087d:	75 36                	jne    8008b5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80087f:	89 f8                	mov    %edi,%eax
+  800881:	c1 e8 0c             	shr    $0xc,%eax
+  800884:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80088b:	83 ec 0c             	sub    $0xc,%esp
+  80088e:	25 07 0e 00 00       	and    $0xe07,%eax
+  800893:	50                   	push   %eax
+  800894:	56                   	push   %esi
+  800895:	6a 00                	push   $0x0
+  800897:	57                   	push   %edi
+  800898:	6a 00                	push   $0x0
+  80089a:	e8 3e f9 ff ff       	call   8001dd <sys_page_map>
+  80089f:	89 c3                	mov    %eax,%ebx
+  8008a1:	83 c4 20             	add    $0x20,%esp
+  8008a4:	85 c0                	test   %eax,%eax
+  8008a6:	78 33                	js     8008db <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008ab:	89 d8                	mov    %ebx,%eax
+  8008ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b0:	5b                   	pop    %ebx
+  8008b1:	5e                   	pop    %esi
+  8008b2:	5f                   	pop    %edi
+  8008b3:	5d                   	pop    %ebp
+  8008b4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008bc:	83 ec 0c             	sub    $0xc,%esp
+  8008bf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008c4:	50                   	push   %eax
+  8008c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8008c8:	6a 00                	push   $0x0
+  8008ca:	53                   	push   %ebx
+  8008cb:	6a 00                	push   $0x0
+  8008cd:	e8 0b f9 ff ff       	call   8001dd <sys_page_map>
+  8008d2:	89 c3                	mov    %eax,%ebx
+  8008d4:	83 c4 20             	add    $0x20,%esp
+  8008d7:	85 c0                	test   %eax,%eax
+  8008d9:	79 a4                	jns    80087f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008db:	83 ec 08             	sub    $0x8,%esp
+  8008de:	56                   	push   %esi
+  8008df:	6a 00                	push   $0x0
+  8008e1:	e8 39 f9 ff ff       	call   80021f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008e6:	83 c4 08             	add    $0x8,%esp
+  8008e9:	ff 75 d4             	push   -0x2c(%ebp)
+  8008ec:	6a 00                	push   $0x0
+  8008ee:	e8 2c f9 ff ff       	call   80021f <sys_page_unmap>
+	return r;
+  8008f3:	83 c4 10             	add    $0x10,%esp
+  8008f6:	eb b3                	jmp    8008ab <dup+0x9d>
+
+008008f8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	56                   	push   %esi
+  8008fc:	53                   	push   %ebx
+  8008fd:	83 ec 18             	sub    $0x18,%esp
+  800900:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800903:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800906:	50                   	push   %eax
+  800907:	53                   	push   %ebx
+  800908:	e8 67 fd ff ff       	call   800674 <fd_lookup>
+  80090d:	83 c4 10             	add    $0x10,%esp
+  800910:	85 c0                	test   %eax,%eax
+  800912:	78 3c                	js     800950 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800914:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800917:	83 ec 08             	sub    $0x8,%esp
+  80091a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80091d:	50                   	push   %eax
+  80091e:	ff 36                	push   (%esi)
+  800920:	e8 a1 fd ff ff       	call   8006c6 <dev_lookup>
+  800925:	83 c4 10             	add    $0x10,%esp
+  800928:	85 c0                	test   %eax,%eax
+  80092a:	78 24                	js     800950 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80092c:	8b 46 08             	mov    0x8(%esi),%eax
+  80092f:	83 e0 03             	and    $0x3,%eax
+  800932:	83 f8 01             	cmp    $0x1,%eax
+  800935:	74 20                	je     800957 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800937:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093a:	8b 40 08             	mov    0x8(%eax),%eax
+  80093d:	85 c0                	test   %eax,%eax
+  80093f:	74 54                	je     800995 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800941:	83 ec 04             	sub    $0x4,%esp
+  800944:	ff 75 10             	push   0x10(%ebp)
+  800947:	ff 75 0c             	push   0xc(%ebp)
+  80094a:	56                   	push   %esi
+  80094b:	ff d0                	call   *%eax
+  80094d:	83 c4 10             	add    $0x10,%esp
+}
+  800950:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800953:	5b                   	pop    %ebx
+  800954:	5e                   	pop    %esi
+  800955:	5d                   	pop    %ebp
+  800956:	c3                   	ret
+  800957:	89 e2                	mov    %esp,%edx
+  800959:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80095e:	29 d0                	sub    %edx,%eax
+  800960:	89 c2                	mov    %eax,%edx
+  800962:	c1 ea 0f             	shr    $0xf,%edx
+  800965:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80096a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800972:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800979:	8b 40 48             	mov    0x48(%eax),%eax
+  80097c:	83 ec 04             	sub    $0x4,%esp
+  80097f:	53                   	push   %ebx
+  800980:	50                   	push   %eax
+  800981:	68 f9 3a 80 00       	push   $0x803af9
+  800986:	e8 25 21 00 00       	call   802ab0 <cprintf>
+		return -E_INVAL;
+  80098b:	83 c4 10             	add    $0x10,%esp
+  80098e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800993:	eb bb                	jmp    800950 <read+0x58>
+		return -E_NOT_SUPP;
+  800995:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80099a:	eb b4                	jmp    800950 <read+0x58>
+
+0080099c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	57                   	push   %edi
+  8009a0:	56                   	push   %esi
+  8009a1:	53                   	push   %ebx
+  8009a2:	83 ec 0c             	sub    $0xc,%esp
+  8009a5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009a8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009ab:	85 f6                	test   %esi,%esi
+  8009ad:	74 30                	je     8009df <readn+0x43>
+  8009af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009b4:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009b9:	83 ec 04             	sub    $0x4,%esp
+  8009bc:	89 f2                	mov    %esi,%edx
+  8009be:	29 c2                	sub    %eax,%edx
+  8009c0:	52                   	push   %edx
+  8009c1:	01 f8                	add    %edi,%eax
+  8009c3:	50                   	push   %eax
+  8009c4:	ff 75 08             	push   0x8(%ebp)
+  8009c7:	e8 2c ff ff ff       	call   8008f8 <read>
+		if (m < 0)
+  8009cc:	83 c4 10             	add    $0x10,%esp
+  8009cf:	85 c0                	test   %eax,%eax
+  8009d1:	78 15                	js     8009e8 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8009d3:	74 11                	je     8009e6 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8009d5:	01 c3                	add    %eax,%ebx
+  8009d7:	89 d8                	mov    %ebx,%eax
+  8009d9:	39 f3                	cmp    %esi,%ebx
+  8009db:	72 dc                	jb     8009b9 <readn+0x1d>
+  8009dd:	eb 09                	jmp    8009e8 <readn+0x4c>
+  8009df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e4:	eb 02                	jmp    8009e8 <readn+0x4c>
+  8009e6:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8009e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009eb:	5b                   	pop    %ebx
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5f                   	pop    %edi
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+
+008009f0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	56                   	push   %esi
+  8009f4:	53                   	push   %ebx
+  8009f5:	83 ec 18             	sub    $0x18,%esp
+  8009f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009fb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009fe:	50                   	push   %eax
+  8009ff:	53                   	push   %ebx
+  800a00:	e8 6f fc ff ff       	call   800674 <fd_lookup>
+  800a05:	83 c4 10             	add    $0x10,%esp
+  800a08:	85 c0                	test   %eax,%eax
+  800a0a:	78 37                	js     800a43 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a0c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a0f:	83 ec 08             	sub    $0x8,%esp
+  800a12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a15:	50                   	push   %eax
+  800a16:	ff 36                	push   (%esi)
+  800a18:	e8 a9 fc ff ff       	call   8006c6 <dev_lookup>
+  800a1d:	83 c4 10             	add    $0x10,%esp
+  800a20:	85 c0                	test   %eax,%eax
+  800a22:	78 1f                	js     800a43 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a24:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a28:	74 20                	je     800a4a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a2d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a30:	85 c0                	test   %eax,%eax
+  800a32:	74 54                	je     800a88 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a34:	83 ec 04             	sub    $0x4,%esp
+  800a37:	ff 75 10             	push   0x10(%ebp)
+  800a3a:	ff 75 0c             	push   0xc(%ebp)
+  800a3d:	56                   	push   %esi
+  800a3e:	ff d0                	call   *%eax
+  800a40:	83 c4 10             	add    $0x10,%esp
+}
+  800a43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a46:	5b                   	pop    %ebx
+  800a47:	5e                   	pop    %esi
+  800a48:	5d                   	pop    %ebp
+  800a49:	c3                   	ret
+  800a4a:	89 e2                	mov    %esp,%edx
+  800a4c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a51:	29 d0                	sub    %edx,%eax
+  800a53:	89 c2                	mov    %eax,%edx
+  800a55:	c1 ea 0f             	shr    $0xf,%edx
+  800a58:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a62:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a65:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a6c:	8b 40 48             	mov    0x48(%eax),%eax
+  800a6f:	83 ec 04             	sub    $0x4,%esp
+  800a72:	53                   	push   %ebx
+  800a73:	50                   	push   %eax
+  800a74:	68 15 3b 80 00       	push   $0x803b15
+  800a79:	e8 32 20 00 00       	call   802ab0 <cprintf>
+		return -E_INVAL;
+  800a7e:	83 c4 10             	add    $0x10,%esp
+  800a81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a86:	eb bb                	jmp    800a43 <write+0x53>
+		return -E_NOT_SUPP;
+  800a88:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a8d:	eb b4                	jmp    800a43 <write+0x53>
+
+00800a8f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a98:	50                   	push   %eax
+  800a99:	ff 75 08             	push   0x8(%ebp)
+  800a9c:	e8 d3 fb ff ff       	call   800674 <fd_lookup>
+  800aa1:	83 c4 10             	add    $0x10,%esp
+  800aa4:	85 c0                	test   %eax,%eax
+  800aa6:	78 0e                	js     800ab6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aae:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab6:	c9                   	leave
+  800ab7:	c3                   	ret
+
+00800ab8 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	53                   	push   %ebx
+  800abc:	83 ec 1c             	sub    $0x1c,%esp
+  800abf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ac2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ac5:	50                   	push   %eax
+  800ac6:	ff 75 08             	push   0x8(%ebp)
+  800ac9:	e8 a6 fb ff ff       	call   800674 <fd_lookup>
+  800ace:	83 c4 10             	add    $0x10,%esp
+  800ad1:	85 c0                	test   %eax,%eax
+  800ad3:	78 33                	js     800b08 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800ad5:	83 fb 03             	cmp    $0x3,%ebx
+  800ad8:	74 28                	je     800b02 <fcntl+0x4a>
+  800ada:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800adf:	83 fb 04             	cmp    $0x4,%ebx
+  800ae2:	75 24                	jne    800b08 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800ae4:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800ae7:	8b 41 08             	mov    0x8(%ecx),%eax
+  800aea:	80 e4 ef             	and    $0xef,%ah
+  800aed:	8b 55 10             	mov    0x10(%ebp),%edx
+  800af0:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800af6:	09 d0                	or     %edx,%eax
+  800af8:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b00:	eb 06                	jmp    800b08 <fcntl+0x50>
+		return fd->fd_omode;
+  800b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b05:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b0b:	c9                   	leave
+  800b0c:	c3                   	ret
+
+00800b0d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b0d:	55                   	push   %ebp
+  800b0e:	89 e5                	mov    %esp,%ebp
+  800b10:	56                   	push   %esi
+  800b11:	53                   	push   %ebx
+  800b12:	83 ec 18             	sub    $0x18,%esp
+  800b15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b18:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b1b:	50                   	push   %eax
+  800b1c:	53                   	push   %ebx
+  800b1d:	e8 52 fb ff ff       	call   800674 <fd_lookup>
+  800b22:	83 c4 10             	add    $0x10,%esp
+  800b25:	85 c0                	test   %eax,%eax
+  800b27:	78 34                	js     800b5d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b29:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b2c:	83 ec 08             	sub    $0x8,%esp
+  800b2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b32:	50                   	push   %eax
+  800b33:	ff 36                	push   (%esi)
+  800b35:	e8 8c fb ff ff       	call   8006c6 <dev_lookup>
+  800b3a:	83 c4 10             	add    $0x10,%esp
+  800b3d:	85 c0                	test   %eax,%eax
+  800b3f:	78 1c                	js     800b5d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b41:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b45:	74 1d                	je     800b64 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4a:	8b 40 18             	mov    0x18(%eax),%eax
+  800b4d:	85 c0                	test   %eax,%eax
+  800b4f:	74 51                	je     800ba2 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b51:	83 ec 08             	sub    $0x8,%esp
+  800b54:	ff 75 0c             	push   0xc(%ebp)
+  800b57:	56                   	push   %esi
+  800b58:	ff d0                	call   *%eax
+  800b5a:	83 c4 10             	add    $0x10,%esp
+}
+  800b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b60:	5b                   	pop    %ebx
+  800b61:	5e                   	pop    %esi
+  800b62:	5d                   	pop    %ebp
+  800b63:	c3                   	ret
+  800b64:	89 e2                	mov    %esp,%edx
+  800b66:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b6b:	29 d0                	sub    %edx,%eax
+  800b6d:	89 c2                	mov    %eax,%edx
+  800b6f:	c1 ea 0f             	shr    $0xf,%edx
+  800b72:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7c:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800b7f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800b86:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b89:	83 ec 04             	sub    $0x4,%esp
+  800b8c:	53                   	push   %ebx
+  800b8d:	50                   	push   %eax
+  800b8e:	68 d8 3a 80 00       	push   $0x803ad8
+  800b93:	e8 18 1f 00 00       	call   802ab0 <cprintf>
+		return -E_INVAL;
+  800b98:	83 c4 10             	add    $0x10,%esp
+  800b9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba0:	eb bb                	jmp    800b5d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ba2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ba7:	eb b4                	jmp    800b5d <ftruncate+0x50>
+
+00800ba9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	56                   	push   %esi
+  800bad:	53                   	push   %ebx
+  800bae:	83 ec 18             	sub    $0x18,%esp
+  800bb1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bb4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bb7:	50                   	push   %eax
+  800bb8:	ff 75 08             	push   0x8(%ebp)
+  800bbb:	e8 b4 fa ff ff       	call   800674 <fd_lookup>
+  800bc0:	83 c4 10             	add    $0x10,%esp
+  800bc3:	85 c0                	test   %eax,%eax
+  800bc5:	78 53                	js     800c1a <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bc7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bca:	83 ec 08             	sub    $0x8,%esp
+  800bcd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bd0:	50                   	push   %eax
+  800bd1:	ff 36                	push   (%esi)
+  800bd3:	e8 ee fa ff ff       	call   8006c6 <dev_lookup>
+  800bd8:	83 c4 10             	add    $0x10,%esp
+  800bdb:	85 c0                	test   %eax,%eax
+  800bdd:	78 3b                	js     800c1a <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800bdf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800be2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800be6:	74 39                	je     800c21 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800be8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800beb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bf2:	00 00 00 
+	stat->st_isdir = 0;
+  800bf5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bfc:	00 00 00 
+	stat->st_version = 0;
+  800bff:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c06:	00 00 00 
+	stat->st_dev = dev;
+  800c09:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c0f:	83 ec 08             	sub    $0x8,%esp
+  800c12:	53                   	push   %ebx
+  800c13:	56                   	push   %esi
+  800c14:	ff 50 14             	call   *0x14(%eax)
+  800c17:	83 c4 10             	add    $0x10,%esp
+}
+  800c1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5d                   	pop    %ebp
+  800c20:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c21:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c26:	eb f2                	jmp    800c1a <fstat+0x71>
+
+00800c28 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	56                   	push   %esi
+  800c2c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c2d:	83 ec 08             	sub    $0x8,%esp
+  800c30:	6a 00                	push   $0x0
+  800c32:	ff 75 08             	push   0x8(%ebp)
+  800c35:	e8 b7 01 00 00       	call   800df1 <open>
+  800c3a:	89 c3                	mov    %eax,%ebx
+  800c3c:	83 c4 10             	add    $0x10,%esp
+  800c3f:	85 c0                	test   %eax,%eax
+  800c41:	78 1b                	js     800c5e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c43:	83 ec 08             	sub    $0x8,%esp
+  800c46:	ff 75 0c             	push   0xc(%ebp)
+  800c49:	50                   	push   %eax
+  800c4a:	e8 5a ff ff ff       	call   800ba9 <fstat>
+  800c4f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c51:	89 1c 24             	mov    %ebx,(%esp)
+  800c54:	e8 60 fb ff ff       	call   8007b9 <close>
+	return r;
+  800c59:	83 c4 10             	add    $0x10,%esp
+  800c5c:	89 f3                	mov    %esi,%ebx
+}
+  800c5e:	89 d8                	mov    %ebx,%eax
+  800c60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c63:	5b                   	pop    %ebx
+  800c64:	5e                   	pop    %esi
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+
+00800c67 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	56                   	push   %esi
+  800c6b:	53                   	push   %ebx
+  800c6c:	89 c6                	mov    %eax,%esi
+  800c6e:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800c70:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800c77:	74 27                	je     800ca0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800c79:	6a 07                	push   $0x7
+  800c7b:	68 00 60 80 00       	push   $0x806000
+  800c80:	56                   	push   %esi
+  800c81:	ff 35 00 50 80 00    	push   0x805000
+  800c87:	e8 23 2b 00 00       	call   8037af <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800c8c:	83 c4 0c             	add    $0xc,%esp
+  800c8f:	6a 00                	push   $0x0
+  800c91:	53                   	push   %ebx
+  800c92:	6a 00                	push   $0x0
+  800c94:	e8 86 28 00 00       	call   80351f <ipc_recv>
+}
+  800c99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c9c:	5b                   	pop    %ebx
+  800c9d:	5e                   	pop    %esi
+  800c9e:	5d                   	pop    %ebp
+  800c9f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ca0:	83 ec 0c             	sub    $0xc,%esp
+  800ca3:	6a 02                	push   $0x2
+  800ca5:	e8 6e 2b 00 00       	call   803818 <ipc_find_env>
+  800caa:	a3 00 50 80 00       	mov    %eax,0x805000
+  800caf:	83 c4 10             	add    $0x10,%esp
+  800cb2:	eb c5                	jmp    800c79 <fsipc+0x12>
+
+00800cb4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800cba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbd:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cc0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cc8:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd7:	e8 8b ff ff ff       	call   800c67 <fsipc>
+}
+  800cdc:	c9                   	leave
+  800cdd:	c3                   	ret
+
+00800cde <devfile_flush>:
+{
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce7:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cea:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cf9:	e8 69 ff ff ff       	call   800c67 <fsipc>
+}
+  800cfe:	c9                   	leave
+  800cff:	c3                   	ret
+
+00800d00 <devfile_stat>:
+{
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	53                   	push   %ebx
+  800d04:	83 ec 04             	sub    $0x4,%esp
+  800d07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d10:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d1f:	e8 43 ff ff ff       	call   800c67 <fsipc>
+  800d24:	85 c0                	test   %eax,%eax
+  800d26:	78 37                	js     800d5f <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d28:	83 ec 08             	sub    $0x8,%esp
+  800d2b:	68 00 60 80 00       	push   $0x806000
+  800d30:	53                   	push   %ebx
+  800d31:	e8 71 24 00 00       	call   8031a7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d36:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d3b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d41:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d46:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d4c:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d51:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d57:	83 c4 10             	add    $0x10,%esp
+  800d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d62:	c9                   	leave
+  800d63:	c3                   	ret
+
+00800d64 <devfile_write>:
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	83 ec 0c             	sub    $0xc,%esp
+  800d6a:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d6d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800d72:	39 d0                	cmp    %edx,%eax
+  800d74:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	8b 52 0c             	mov    0xc(%edx),%edx
+  800d7d:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800d83:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800d88:	50                   	push   %eax
+  800d89:	ff 75 0c             	push   0xc(%ebp)
+  800d8c:	68 08 60 80 00       	push   $0x806008
+  800d91:	e8 c1 25 00 00       	call   803357 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da0:	e8 c2 fe ff ff       	call   800c67 <fsipc>
+}
+  800da5:	c9                   	leave
+  800da6:	c3                   	ret
+
+00800da7 <devfile_read>:
+{
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	53                   	push   %ebx
+  800dab:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db4:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800db9:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dbc:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800dc1:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800dc6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dcb:	e8 97 fe ff ff       	call   800c67 <fsipc>
+  800dd0:	89 c3                	mov    %eax,%ebx
+  800dd2:	85 c0                	test   %eax,%eax
+  800dd4:	78 14                	js     800dea <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800dd6:	83 ec 04             	sub    $0x4,%esp
+  800dd9:	50                   	push   %eax
+  800dda:	68 00 60 80 00       	push   $0x806000
+  800ddf:	ff 75 0c             	push   0xc(%ebp)
+  800de2:	e8 70 25 00 00       	call   803357 <memmove>
+	return r;
+  800de7:	83 c4 10             	add    $0x10,%esp
+}
+  800dea:	89 d8                	mov    %ebx,%eax
+  800dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+
+00800df1 <open>:
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	53                   	push   %ebx
+  800df5:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800df8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800dfb:	50                   	push   %eax
+  800dfc:	e8 23 f8 ff ff       	call   800624 <fd_alloc>
+  800e01:	89 c3                	mov    %eax,%ebx
+  800e03:	83 c4 10             	add    $0x10,%esp
+  800e06:	85 c0                	test   %eax,%eax
+  800e08:	78 2a                	js     800e34 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e0a:	83 ec 0c             	sub    $0xc,%esp
+  800e0d:	ff 75 08             	push   0x8(%ebp)
+  800e10:	e8 46 23 00 00       	call   80315b <strlen>
+  800e15:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e18:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e1d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e22:	7e 17                	jle    800e3b <open+0x4a>
+	fd_close(fd, 1);
+  800e24:	83 ec 08             	sub    $0x8,%esp
+  800e27:	6a 01                	push   $0x1
+  800e29:	ff 75 f4             	push   -0xc(%ebp)
+  800e2c:	e8 08 f9 ff ff       	call   800739 <fd_close>
+	return r;
+  800e31:	83 c4 10             	add    $0x10,%esp
+}
+  800e34:	89 d8                	mov    %ebx,%eax
+  800e36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e39:	c9                   	leave
+  800e3a:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e3b:	83 ec 08             	sub    $0x8,%esp
+  800e3e:	ff 75 08             	push   0x8(%ebp)
+  800e41:	68 00 60 80 00       	push   $0x806000
+  800e46:	e8 5c 23 00 00       	call   8031a7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e4e:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e53:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e56:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5b:	e8 07 fe ff ff       	call   800c67 <fsipc>
+  800e60:	89 c3                	mov    %eax,%ebx
+  800e62:	83 c4 10             	add    $0x10,%esp
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	78 bb                	js     800e24 <open+0x33>
+	return fd2num(fd); 	
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+  800e6c:	ff 75 f4             	push   -0xc(%ebp)
+  800e6f:	e8 89 f7 ff ff       	call   8005fd <fd2num>
+  800e74:	89 c3                	mov    %eax,%ebx
+  800e76:	83 c4 10             	add    $0x10,%esp
+  800e79:	eb b9                	jmp    800e34 <open+0x43>
+
+00800e7b <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	53                   	push   %ebx
+  800e7f:	83 ec 1c             	sub    $0x1c,%esp
+  800e82:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e88:	50                   	push   %eax
+  800e89:	ff 75 08             	push   0x8(%ebp)
+  800e8c:	e8 e3 f7 ff ff       	call   800674 <fd_lookup>
+  800e91:	83 c4 10             	add    $0x10,%esp
+  800e94:	85 c0                	test   %eax,%eax
+  800e96:	78 5a                	js     800ef2 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800e98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e9b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800ea1:	39 10                	cmp    %edx,(%eax)
+  800ea3:	75 66                	jne    800f0b <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800ea5:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800eac:	74 49                	je     800ef7 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800eae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800eb4:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800eb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ebc:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800ec1:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ec7:	6a 07                	push   $0x7
+  800ec9:	68 00 60 80 00       	push   $0x806000
+  800ece:	6a 09                	push   $0x9
+  800ed0:	ff 35 00 50 80 00    	push   0x805000
+  800ed6:	e8 d4 28 00 00       	call   8037af <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800edb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800ee2:	6a 00                	push   $0x0
+  800ee4:	53                   	push   %ebx
+  800ee5:	ff 75 10             	push   0x10(%ebp)
+  800ee8:	6a 00                	push   $0x0
+  800eea:	e8 fd 26 00 00       	call   8035ec <ipc_recv_pages>
+  800eef:	83 c4 20             	add    $0x20,%esp
+}
+  800ef2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ef5:	c9                   	leave
+  800ef6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ef7:	83 ec 0c             	sub    $0xc,%esp
+  800efa:	6a 02                	push   $0x2
+  800efc:	e8 17 29 00 00       	call   803818 <ipc_find_env>
+  800f01:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f06:	83 c4 10             	add    $0x10,%esp
+  800f09:	eb a3                	jmp    800eae <fmap+0x33>
+		return -E_INVAL;
+  800f0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f10:	eb e0                	jmp    800ef2 <fmap+0x77>
+
+00800f12 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	53                   	push   %ebx
+  800f16:	83 ec 10             	sub    $0x10,%esp
+  800f19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f1c:	53                   	push   %ebx
+  800f1d:	e8 39 22 00 00       	call   80315b <strlen>
+  800f22:	83 c4 10             	add    $0x10,%esp
+  800f25:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f2a:	7f 25                	jg     800f51 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f2c:	83 ec 08             	sub    $0x8,%esp
+  800f2f:	53                   	push   %ebx
+  800f30:	68 00 60 80 00       	push   $0x806000
+  800f35:	e8 6d 22 00 00       	call   8031a7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f3f:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f44:	e8 1e fd ff ff       	call   800c67 <fsipc>
+  800f49:	83 c4 10             	add    $0x10,%esp
+}
+  800f4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f4f:	c9                   	leave
+  800f50:	c3                   	ret
+		return -E_BAD_PATH;
+  800f51:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f56:	eb f4                	jmp    800f4c <remove+0x3a>
+
+00800f58 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f63:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f68:	e8 fa fc ff ff       	call   800c67 <fsipc>
+}
+  800f6d:	c9                   	leave
+  800f6e:	c3                   	ret
+
+00800f6f <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800f75:	68 48 3b 80 00       	push   $0x803b48
+  800f7a:	ff 75 0c             	push   0xc(%ebp)
+  800f7d:	e8 25 22 00 00       	call   8031a7 <strcpy>
+	return 0;
+}
+  800f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f87:	c9                   	leave
+  800f88:	c3                   	ret
+
+00800f89 <devsock_close>:
+{
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	53                   	push   %ebx
+  800f8d:	83 ec 10             	sub    $0x10,%esp
+  800f90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800f93:	53                   	push   %ebx
+  800f94:	e8 be 28 00 00       	call   803857 <pageref>
+  800f99:	89 c2                	mov    %eax,%edx
+  800f9b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fa3:	83 fa 01             	cmp    $0x1,%edx
+  800fa6:	74 05                	je     800fad <devsock_close+0x24>
+}
+  800fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fab:	c9                   	leave
+  800fac:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+  800fb0:	ff 73 0c             	push   0xc(%ebx)
+  800fb3:	e8 b0 05 00 00       	call   801568 <nsipc_close>
+  800fb8:	83 c4 10             	add    $0x10,%esp
+  800fbb:	eb eb                	jmp    800fa8 <devsock_close+0x1f>
+
+00800fbd <devsock_write>:
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	53                   	push   %ebx
+  800fc1:	83 ec 14             	sub    $0x14,%esp
+  800fc4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fc7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fca:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800fcd:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  800fd0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  800fd3:	8b 41 08             	mov    0x8(%ecx),%eax
+  800fd6:	c1 f8 09             	sar    $0x9,%eax
+  800fd9:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  800fdc:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  800fe2:	77 13                	ja     800ff7 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  800fe4:	50                   	push   %eax
+  800fe5:	52                   	push   %edx
+  800fe6:	53                   	push   %ebx
+  800fe7:	ff 71 0c             	push   0xc(%ecx)
+  800fea:	e8 5c 06 00 00       	call   80164b <nsipc_send>
+  800fef:	83 c4 10             	add    $0x10,%esp
+}
+  800ff2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ff5:	c9                   	leave
+  800ff6:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  800ff7:	50                   	push   %eax
+  800ff8:	6a 01                	push   $0x1
+  800ffa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ffd:	50                   	push   %eax
+  800ffe:	ff 71 0c             	push   0xc(%ecx)
+  801001:	e8 a6 06 00 00       	call   8016ac <nsipc_sendmsg>
+  801006:	83 c4 10             	add    $0x10,%esp
+  801009:	eb e7                	jmp    800ff2 <devsock_write+0x35>
+
+0080100b <devsock_read>:
+{
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	53                   	push   %ebx
+  80100f:	83 ec 14             	sub    $0x14,%esp
+  801012:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801015:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801018:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80101b:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80101e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801021:	8b 41 08             	mov    0x8(%ecx),%eax
+  801024:	c1 f8 09             	sar    $0x9,%eax
+  801027:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80102a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801030:	77 13                	ja     801045 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801032:	50                   	push   %eax
+  801033:	52                   	push   %edx
+  801034:	53                   	push   %ebx
+  801035:	ff 71 0c             	push   0xc(%ecx)
+  801038:	e8 9c 05 00 00       	call   8015d9 <nsipc_recv>
+  80103d:	83 c4 10             	add    $0x10,%esp
+}
+  801040:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801043:	c9                   	leave
+  801044:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801045:	50                   	push   %eax
+  801046:	6a 01                	push   $0x1
+  801048:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80104b:	50                   	push   %eax
+  80104c:	ff 71 0c             	push   0xc(%ecx)
+  80104f:	e8 02 0a 00 00       	call   801a56 <nsipc_recvmsg>
+  801054:	83 c4 10             	add    $0x10,%esp
+  801057:	eb e7                	jmp    801040 <devsock_read+0x35>
+
+00801059 <fd2sockid>:
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80105f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801062:	52                   	push   %edx
+  801063:	50                   	push   %eax
+  801064:	e8 0b f6 ff ff       	call   800674 <fd_lookup>
+  801069:	83 c4 10             	add    $0x10,%esp
+  80106c:	85 c0                	test   %eax,%eax
+  80106e:	78 10                	js     801080 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801070:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801073:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801079:	39 08                	cmp    %ecx,(%eax)
+  80107b:	75 05                	jne    801082 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80107d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+		return -E_NOT_SUPP;
+  801082:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801087:	eb f7                	jmp    801080 <fd2sockid+0x27>
+
+00801089 <sock_flags>:
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  80108f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801092:	52                   	push   %edx
+  801093:	50                   	push   %eax
+  801094:	e8 db f5 ff ff       	call   800674 <fd_lookup>
+  801099:	83 c4 10             	add    $0x10,%esp
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	78 0e                	js     8010ae <sock_flags+0x25>
+  8010a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a3:	8b 40 08             	mov    0x8(%eax),%eax
+  8010a6:	c1 e8 09             	shr    $0x9,%eax
+  8010a9:	83 e0 08             	and    $0x8,%eax
+}
+  8010ac:	c9                   	leave
+  8010ad:	c3                   	ret
+		return 0;
+  8010ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b3:	eb f7                	jmp    8010ac <sock_flags+0x23>
+
+008010b5 <alloc_sockfd>:
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	83 ec 1c             	sub    $0x1c,%esp
+  8010bd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010c2:	50                   	push   %eax
+  8010c3:	e8 5c f5 ff ff       	call   800624 <fd_alloc>
+  8010c8:	89 c3                	mov    %eax,%ebx
+  8010ca:	83 c4 10             	add    $0x10,%esp
+  8010cd:	85 c0                	test   %eax,%eax
+  8010cf:	78 43                	js     801114 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010d1:	83 ec 04             	sub    $0x4,%esp
+  8010d4:	68 07 04 00 00       	push   $0x407
+  8010d9:	ff 75 f4             	push   -0xc(%ebp)
+  8010dc:	6a 00                	push   $0x0
+  8010de:	e8 b7 f0 ff ff       	call   80019a <sys_page_alloc>
+  8010e3:	89 c3                	mov    %eax,%ebx
+  8010e5:	83 c4 10             	add    $0x10,%esp
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	78 28                	js     801114 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8010ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010ef:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8010f5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8010f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010fa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801101:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801104:	83 ec 0c             	sub    $0xc,%esp
+  801107:	50                   	push   %eax
+  801108:	e8 f0 f4 ff ff       	call   8005fd <fd2num>
+  80110d:	89 c3                	mov    %eax,%ebx
+  80110f:	83 c4 10             	add    $0x10,%esp
+  801112:	eb 0c                	jmp    801120 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	56                   	push   %esi
+  801118:	e8 4b 04 00 00       	call   801568 <nsipc_close>
+		return r;
+  80111d:	83 c4 10             	add    $0x10,%esp
+}
+  801120:	89 d8                	mov    %ebx,%eax
+  801122:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5d                   	pop    %ebp
+  801128:	c3                   	ret
+
+00801129 <accept>:
+{
+  801129:	55                   	push   %ebp
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+  80112e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801131:	89 f0                	mov    %esi,%eax
+  801133:	e8 21 ff ff ff       	call   801059 <fd2sockid>
+  801138:	89 c3                	mov    %eax,%ebx
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	78 24                	js     801162 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80113e:	89 f0                	mov    %esi,%eax
+  801140:	e8 44 ff ff ff       	call   801089 <sock_flags>
+  801145:	50                   	push   %eax
+  801146:	ff 75 10             	push   0x10(%ebp)
+  801149:	ff 75 0c             	push   0xc(%ebp)
+  80114c:	53                   	push   %ebx
+  80114d:	e8 6b 03 00 00       	call   8014bd <nsipc_accept>
+  801152:	89 c3                	mov    %eax,%ebx
+  801154:	83 c4 10             	add    $0x10,%esp
+  801157:	85 c0                	test   %eax,%eax
+  801159:	78 07                	js     801162 <accept+0x39>
+	return alloc_sockfd(r);
+  80115b:	e8 55 ff ff ff       	call   8010b5 <alloc_sockfd>
+  801160:	89 c3                	mov    %eax,%ebx
+}
+  801162:	89 d8                	mov    %ebx,%eax
+  801164:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801167:	5b                   	pop    %ebx
+  801168:	5e                   	pop    %esi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+
+0080116b <bind>:
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801171:	8b 45 08             	mov    0x8(%ebp),%eax
+  801174:	e8 e0 fe ff ff       	call   801059 <fd2sockid>
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	78 12                	js     80118f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80117d:	83 ec 04             	sub    $0x4,%esp
+  801180:	ff 75 10             	push   0x10(%ebp)
+  801183:	ff 75 0c             	push   0xc(%ebp)
+  801186:	50                   	push   %eax
+  801187:	e8 85 03 00 00       	call   801511 <nsipc_bind>
+  80118c:	83 c4 10             	add    $0x10,%esp
+}
+  80118f:	c9                   	leave
+  801190:	c3                   	ret
+
+00801191 <shutdown>:
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801197:	8b 45 08             	mov    0x8(%ebp),%eax
+  80119a:	e8 ba fe ff ff       	call   801059 <fd2sockid>
+  80119f:	85 c0                	test   %eax,%eax
+  8011a1:	78 0f                	js     8011b2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011a3:	83 ec 08             	sub    $0x8,%esp
+  8011a6:	ff 75 0c             	push   0xc(%ebp)
+  8011a9:	50                   	push   %eax
+  8011aa:	e8 97 03 00 00       	call   801546 <nsipc_shutdown>
+  8011af:	83 c4 10             	add    $0x10,%esp
+}
+  8011b2:	c9                   	leave
+  8011b3:	c3                   	ret
+
+008011b4 <connect>:
+{
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011bd:	e8 97 fe ff ff       	call   801059 <fd2sockid>
+  8011c2:	85 c0                	test   %eax,%eax
+  8011c4:	78 12                	js     8011d8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011c6:	83 ec 04             	sub    $0x4,%esp
+  8011c9:	ff 75 10             	push   0x10(%ebp)
+  8011cc:	ff 75 0c             	push   0xc(%ebp)
+  8011cf:	50                   	push   %eax
+  8011d0:	e8 ad 03 00 00       	call   801582 <nsipc_connect>
+  8011d5:	83 c4 10             	add    $0x10,%esp
+}
+  8011d8:	c9                   	leave
+  8011d9:	c3                   	ret
+
+008011da <listen>:
+{
+  8011da:	55                   	push   %ebp
+  8011db:	89 e5                	mov    %esp,%ebp
+  8011dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e3:	e8 71 fe ff ff       	call   801059 <fd2sockid>
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	78 0f                	js     8011fb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	ff 75 0c             	push   0xc(%ebp)
+  8011f2:	50                   	push   %eax
+  8011f3:	e8 bf 03 00 00       	call   8015b7 <nsipc_listen>
+  8011f8:	83 c4 10             	add    $0x10,%esp
+}
+  8011fb:	c9                   	leave
+  8011fc:	c3                   	ret
+
+008011fd <sendmsg>:
+{
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	57                   	push   %edi
+  801201:	56                   	push   %esi
+  801202:	53                   	push   %ebx
+  801203:	83 ec 0c             	sub    $0xc,%esp
+  801206:	8b 75 08             	mov    0x8(%ebp),%esi
+  801209:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80120c:	89 f0                	mov    %esi,%eax
+  80120e:	e8 46 fe ff ff       	call   801059 <fd2sockid>
+  801213:	89 c3                	mov    %eax,%ebx
+  801215:	85 c0                	test   %eax,%eax
+  801217:	78 1c                	js     801235 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801219:	89 f0                	mov    %esi,%eax
+  80121b:	e8 69 fe ff ff       	call   801089 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801220:	0b 45 10             	or     0x10(%ebp),%eax
+  801223:	50                   	push   %eax
+  801224:	ff 77 0c             	push   0xc(%edi)
+  801227:	ff 77 08             	push   0x8(%edi)
+  80122a:	53                   	push   %ebx
+  80122b:	e8 7c 04 00 00       	call   8016ac <nsipc_sendmsg>
+  801230:	89 c3                	mov    %eax,%ebx
+  801232:	83 c4 10             	add    $0x10,%esp
+}
+  801235:	89 d8                	mov    %ebx,%eax
+  801237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123a:	5b                   	pop    %ebx
+  80123b:	5e                   	pop    %esi
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <recvmsg>:
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+  801245:	83 ec 0c             	sub    $0xc,%esp
+  801248:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80124b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80124e:	89 f8                	mov    %edi,%eax
+  801250:	e8 04 fe ff ff       	call   801059 <fd2sockid>
+  801255:	89 c3                	mov    %eax,%ebx
+  801257:	85 c0                	test   %eax,%eax
+  801259:	78 2a                	js     801285 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80125b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801262:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801269:	89 f8                	mov    %edi,%eax
+  80126b:	e8 19 fe ff ff       	call   801089 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801270:	0b 45 10             	or     0x10(%ebp),%eax
+  801273:	50                   	push   %eax
+  801274:	ff 76 0c             	push   0xc(%esi)
+  801277:	ff 76 08             	push   0x8(%esi)
+  80127a:	53                   	push   %ebx
+  80127b:	e8 d6 07 00 00       	call   801a56 <nsipc_recvmsg>
+  801280:	89 c3                	mov    %eax,%ebx
+  801282:	83 c4 10             	add    $0x10,%esp
+}
+  801285:	89 d8                	mov    %ebx,%eax
+  801287:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128a:	5b                   	pop    %ebx
+  80128b:	5e                   	pop    %esi
+  80128c:	5f                   	pop    %edi
+  80128d:	5d                   	pop    %ebp
+  80128e:	c3                   	ret
+
+0080128f <sendfile>:
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	56                   	push   %esi
+  801293:	53                   	push   %ebx
+  801294:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801297:	89 f0                	mov    %esi,%eax
+  801299:	e8 bb fd ff ff       	call   801059 <fd2sockid>
+  80129e:	89 c3                	mov    %eax,%ebx
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	78 1f                	js     8012c3 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012a4:	89 f0                	mov    %esi,%eax
+  8012a6:	e8 de fd ff ff       	call   801089 <sock_flags>
+  8012ab:	83 ec 0c             	sub    $0xc,%esp
+  8012ae:	50                   	push   %eax
+  8012af:	ff 75 14             	push   0x14(%ebp)
+  8012b2:	ff 75 10             	push   0x10(%ebp)
+  8012b5:	ff 75 0c             	push   0xc(%ebp)
+  8012b8:	53                   	push   %ebx
+  8012b9:	e8 64 06 00 00       	call   801922 <nsipc_sendfile>
+  8012be:	89 c3                	mov    %eax,%ebx
+  8012c0:	83 c4 20             	add    $0x20,%esp
+}
+  8012c3:	89 d8                	mov    %ebx,%eax
+  8012c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012c8:	5b                   	pop    %ebx
+  8012c9:	5e                   	pop    %esi
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	c3                   	ret
+
+008012cc <evctl>:
+{
+  8012cc:	55                   	push   %ebp
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	53                   	push   %ebx
+  8012d0:	83 ec 04             	sub    $0x4,%esp
+  8012d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8012d6:	89 d8                	mov    %ebx,%eax
+  8012d8:	e8 7c fd ff ff       	call   801059 <fd2sockid>
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	78 10                	js     8012f1 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8012e1:	83 ec 04             	sub    $0x4,%esp
+  8012e4:	53                   	push   %ebx
+  8012e5:	ff 75 0c             	push   0xc(%ebp)
+  8012e8:	50                   	push   %eax
+  8012e9:	e8 d2 0b 00 00       	call   801ec0 <nsipc_evctl>
+  8012ee:	83 c4 10             	add    $0x10,%esp
+}
+  8012f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f4:	c9                   	leave
+  8012f5:	c3                   	ret
+
+008012f6 <evwait>:
+{
+  8012f6:	55                   	push   %ebp
+  8012f7:	89 e5                	mov    %esp,%ebp
+  8012f9:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8012fc:	ff 75 10             	push   0x10(%ebp)
+  8012ff:	ff 75 0c             	push   0xc(%ebp)
+  801302:	ff 75 08             	push   0x8(%ebp)
+  801305:	e8 e0 0b 00 00       	call   801eea <nsipc_evwait>
+}
+  80130a:	c9                   	leave
+  80130b:	c3                   	ret
+
+0080130c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801312:	ff 75 10             	push   0x10(%ebp)
+  801315:	ff 75 0c             	push   0xc(%ebp)
+  801318:	ff 75 08             	push   0x8(%ebp)
+  80131b:	e8 31 0c 00 00       	call   801f51 <nsipc_socket>
+  801320:	83 c4 10             	add    $0x10,%esp
+  801323:	85 c0                	test   %eax,%eax
+  801325:	78 05                	js     80132c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801327:	e8 89 fd ff ff       	call   8010b5 <alloc_sockfd>
+}
+  80132c:	c9                   	leave
+  80132d:	c3                   	ret
+
+0080132e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	53                   	push   %ebx
+  801332:	83 ec 04             	sub    $0x4,%esp
+  801335:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801337:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80133e:	74 26                	je     801366 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801340:	6a 07                	push   $0x7
+  801342:	68 00 70 80 00       	push   $0x807000
+  801347:	53                   	push   %ebx
+  801348:	ff 35 24 53 80 00    	push   0x805324
+  80134e:	e8 5c 24 00 00       	call   8037af <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801353:	83 c4 0c             	add    $0xc,%esp
+  801356:	6a 00                	push   $0x0
+  801358:	6a 00                	push   $0x0
+  80135a:	6a 00                	push   $0x0
+  80135c:	e8 be 21 00 00       	call   80351f <ipc_recv>
+}
+  801361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801364:	c9                   	leave
+  801365:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801366:	83 ec 0c             	sub    $0xc,%esp
+  801369:	6a 03                	push   $0x3
+  80136b:	e8 a8 24 00 00       	call   803818 <ipc_find_env>
+  801370:	a3 24 53 80 00       	mov    %eax,0x805324
+  801375:	83 c4 10             	add    $0x10,%esp
+  801378:	eb c6                	jmp    801340 <nsipc+0x12>
+
+0080137a <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	56                   	push   %esi
+  80137e:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80137f:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  801385:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80138a:	85 f6                	test   %esi,%esi
+  80138c:	75 33                	jne    8013c1 <nsbulk_map+0x47>
+  80138e:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801393:	83 ec 04             	sub    $0x4,%esp
+  801396:	6a 07                	push   $0x7
+  801398:	53                   	push   %ebx
+  801399:	6a 00                	push   $0x0
+  80139b:	e8 fa ed ff ff       	call   80019a <sys_page_alloc>
+  8013a0:	83 c4 10             	add    $0x10,%esp
+  8013a3:	85 c0                	test   %eax,%eax
+  8013a5:	78 1a                	js     8013c1 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013a7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013ad:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013b3:	75 de                	jne    801393 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013b5:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013bc:	00 00 00 
+	return 0;
+  8013bf:	89 f0                	mov    %esi,%eax
+}
+  8013c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c4:	5b                   	pop    %ebx
+  8013c5:	5e                   	pop    %esi
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+
+008013c8 <nsbulk_own>:
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	57                   	push   %edi
+  8013cc:	56                   	push   %esi
+  8013cd:	53                   	push   %ebx
+  8013ce:	83 ec 0c             	sub    $0xc,%esp
+  8013d1:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8013d3:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8013d6:	85 d2                	test   %edx,%edx
+  8013d8:	7f 0e                	jg     8013e8 <nsbulk_own+0x20>
+	return 0;
+  8013da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013df:	eb 47                	jmp    801428 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8013e1:	83 c3 01             	add    $0x1,%ebx
+  8013e4:	39 fb                	cmp    %edi,%ebx
+  8013e6:	7d 3b                	jge    801423 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8013e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8013ed:	89 d9                	mov    %ebx,%ecx
+  8013ef:	d3 e6                	shl    %cl,%esi
+  8013f1:	89 f0                	mov    %esi,%eax
+  8013f3:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  8013f9:	74 e6                	je     8013e1 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8013fb:	83 ec 04             	sub    $0x4,%esp
+  8013fe:	6a 07                	push   $0x7
+  801400:	89 d8                	mov    %ebx,%eax
+  801402:	c1 e0 0c             	shl    $0xc,%eax
+  801405:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80140a:	50                   	push   %eax
+  80140b:	6a 00                	push   $0x0
+  80140d:	e8 88 ed ff ff       	call   80019a <sys_page_alloc>
+  801412:	83 c4 10             	add    $0x10,%esp
+  801415:	85 c0                	test   %eax,%eax
+  801417:	78 0f                	js     801428 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801419:	f7 d6                	not    %esi
+  80141b:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801421:	eb be                	jmp    8013e1 <nsbulk_own+0x19>
+	return 0;
+  801423:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142b:	5b                   	pop    %ebx
+  80142c:	5e                   	pop    %esi
+  80142d:	5f                   	pop    %edi
+  80142e:	5d                   	pop    %ebp
+  80142f:	c3                   	ret
+
+00801430 <nsipc_bulk>:
+{
+  801430:	55                   	push   %ebp
+  801431:	89 e5                	mov    %esp,%ebp
+  801433:	57                   	push   %edi
+  801434:	56                   	push   %esi
+  801435:	53                   	push   %ebx
+  801436:	83 ec 1c             	sub    $0x1c,%esp
+  801439:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80143c:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80143e:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801444:	c1 fb 0c             	sar    $0xc,%ebx
+  801447:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80144a:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801451:	74 56                	je     8014a9 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801453:	85 ff                	test   %edi,%edi
+  801455:	7e 24                	jle    80147b <nsipc_bulk+0x4b>
+  801457:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80145d:	74 1c                	je     80147b <nsipc_bulk+0x4b>
+  80145f:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801465:	c1 e3 0c             	shl    $0xc,%ebx
+  801468:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80146d:	0f b6 10             	movzbl (%eax),%edx
+  801470:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801472:	05 00 10 00 00       	add    $0x1000,%eax
+  801477:	39 d8                	cmp    %ebx,%eax
+  801479:	75 f2                	jne    80146d <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80147b:	83 ec 0c             	sub    $0xc,%esp
+  80147e:	56                   	push   %esi
+  80147f:	57                   	push   %edi
+  801480:	68 00 00 00 e0       	push   $0xe0000000
+  801485:	ff 75 e4             	push   -0x1c(%ebp)
+  801488:	ff 35 24 53 80 00    	push   0x805324
+  80148e:	e8 50 23 00 00       	call   8037e3 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801493:	83 c4 1c             	add    $0x1c,%esp
+  801496:	6a 00                	push   $0x0
+  801498:	6a 00                	push   $0x0
+  80149a:	6a 00                	push   $0x0
+  80149c:	e8 7e 20 00 00       	call   80351f <ipc_recv>
+}
+  8014a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a4:	5b                   	pop    %ebx
+  8014a5:	5e                   	pop    %esi
+  8014a6:	5f                   	pop    %edi
+  8014a7:	5d                   	pop    %ebp
+  8014a8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014a9:	83 ec 0c             	sub    $0xc,%esp
+  8014ac:	6a 03                	push   $0x3
+  8014ae:	e8 65 23 00 00       	call   803818 <ipc_find_env>
+  8014b3:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014b8:	83 c4 10             	add    $0x10,%esp
+  8014bb:	eb 96                	jmp    801453 <nsipc_bulk+0x23>
+
+008014bd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014bd:	55                   	push   %ebp
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	53                   	push   %ebx
+  8014c1:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c7:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014cf:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8014d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014d9:	e8 50 fe ff ff       	call   80132e <nsipc>
+  8014de:	89 c3                	mov    %eax,%ebx
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	79 07                	jns    8014eb <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8014e4:	89 d8                	mov    %ebx,%eax
+  8014e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8014eb:	83 ec 04             	sub    $0x4,%esp
+  8014ee:	ff 35 10 70 80 00    	push   0x807010
+  8014f4:	68 00 70 80 00       	push   $0x807000
+  8014f9:	ff 75 0c             	push   0xc(%ebp)
+  8014fc:	e8 56 1e 00 00       	call   803357 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801501:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801507:	8b 45 10             	mov    0x10(%ebp),%eax
+  80150a:	89 10                	mov    %edx,(%eax)
+  80150c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80150f:	eb d3                	jmp    8014e4 <nsipc_accept+0x27>
+
+00801511 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	53                   	push   %ebx
+  801515:	83 ec 08             	sub    $0x8,%esp
+  801518:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80151b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80151e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801523:	53                   	push   %ebx
+  801524:	ff 75 0c             	push   0xc(%ebp)
+  801527:	68 04 70 80 00       	push   $0x807004
+  80152c:	e8 26 1e 00 00       	call   803357 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801531:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801537:	b8 02 00 00 00       	mov    $0x2,%eax
+  80153c:	e8 ed fd ff ff       	call   80132e <nsipc>
+}
+  801541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801544:	c9                   	leave
+  801545:	c3                   	ret
+
+00801546 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801546:	55                   	push   %ebp
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80154c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80154f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801554:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801557:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80155c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801561:	e8 c8 fd ff ff       	call   80132e <nsipc>
+}
+  801566:	c9                   	leave
+  801567:	c3                   	ret
+
+00801568 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80156e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801571:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801576:	b8 04 00 00 00       	mov    $0x4,%eax
+  80157b:	e8 ae fd ff ff       	call   80132e <nsipc>
+}
+  801580:	c9                   	leave
+  801581:	c3                   	ret
+
+00801582 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	53                   	push   %ebx
+  801586:	83 ec 08             	sub    $0x8,%esp
+  801589:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80158c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80158f:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801594:	53                   	push   %ebx
+  801595:	ff 75 0c             	push   0xc(%ebp)
+  801598:	68 04 70 80 00       	push   $0x807004
+  80159d:	e8 b5 1d 00 00       	call   803357 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015a2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015a8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015ad:	e8 7c fd ff ff       	call   80132e <nsipc>
+}
+  8015b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+
+008015b7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015c8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015cd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015d2:	e8 57 fd ff ff       	call   80132e <nsipc>
+}
+  8015d7:	c9                   	leave
+  8015d8:	c3                   	ret
+
+008015d9 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	56                   	push   %esi
+  8015dd:	53                   	push   %ebx
+  8015de:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8015e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8015e9:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8015ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8015f2:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8015f7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015fc:	e8 2d fd ff ff       	call   80132e <nsipc>
+  801601:	89 c3                	mov    %eax,%ebx
+  801603:	85 c0                	test   %eax,%eax
+  801605:	78 22                	js     801629 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801607:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80160c:	39 c6                	cmp    %eax,%esi
+  80160e:	0f 4e c6             	cmovle %esi,%eax
+  801611:	39 c3                	cmp    %eax,%ebx
+  801613:	7f 1d                	jg     801632 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801615:	83 ec 04             	sub    $0x4,%esp
+  801618:	53                   	push   %ebx
+  801619:	68 00 70 80 00       	push   $0x807000
+  80161e:	ff 75 0c             	push   0xc(%ebp)
+  801621:	e8 31 1d 00 00       	call   803357 <memmove>
+  801626:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801629:	89 d8                	mov    %ebx,%eax
+  80162b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162e:	5b                   	pop    %ebx
+  80162f:	5e                   	pop    %esi
+  801630:	5d                   	pop    %ebp
+  801631:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801632:	68 54 3b 80 00       	push   $0x803b54
+  801637:	68 69 3b 80 00       	push   $0x803b69
+  80163c:	68 b2 00 00 00       	push   $0xb2
+  801641:	68 7e 3b 80 00       	push   $0x803b7e
+  801646:	e8 8a 13 00 00       	call   8029d5 <_panic>
+
+0080164b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80164b:	55                   	push   %ebp
+  80164c:	89 e5                	mov    %esp,%ebp
+  80164e:	53                   	push   %ebx
+  80164f:	83 ec 04             	sub    $0x4,%esp
+  801652:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801655:	8b 45 08             	mov    0x8(%ebp),%eax
+  801658:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80165d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801663:	7f 2e                	jg     801693 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801665:	83 ec 04             	sub    $0x4,%esp
+  801668:	53                   	push   %ebx
+  801669:	ff 75 0c             	push   0xc(%ebp)
+  80166c:	68 0c 70 80 00       	push   $0x80700c
+  801671:	e8 e1 1c 00 00       	call   803357 <memmove>
+	nsipcbuf.send.req_size = size;
+  801676:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80167c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80167f:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801684:	b8 08 00 00 00       	mov    $0x8,%eax
+  801689:	e8 a0 fc ff ff       	call   80132e <nsipc>
+}
+  80168e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801691:	c9                   	leave
+  801692:	c3                   	ret
+	assert(size < 1600);
+  801693:	68 8a 3b 80 00       	push   $0x803b8a
+  801698:	68 69 3b 80 00       	push   $0x803b69
+  80169d:	68 bd 00 00 00       	push   $0xbd
+  8016a2:	68 7e 3b 80 00       	push   $0x803b7e
+  8016a7:	e8 29 13 00 00       	call   8029d5 <_panic>
+
+008016ac <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016ac:	55                   	push   %ebp
+  8016ad:	89 e5                	mov    %esp,%ebp
+  8016af:	57                   	push   %edi
+  8016b0:	56                   	push   %esi
+  8016b1:	53                   	push   %ebx
+  8016b2:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016b5:	e8 c0 fc ff ff       	call   80137a <nsbulk_map>
+  8016ba:	85 c0                	test   %eax,%eax
+  8016bc:	78 55                	js     801713 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016be:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016c5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016cc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8016d3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8016d6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016d9:	0f 8d 24 02 00 00    	jge    801903 <nsipc_sendmsg+0x257>
+  8016df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016e5:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8016e8:	89 d8                	mov    %ebx,%eax
+  8016ea:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8016ef:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8016f1:	83 ec 0c             	sub    $0xc,%esp
+  8016f4:	68 20 50 80 00       	push   $0x805020
+  8016f9:	e8 5a 0f 00 00       	call   802658 <pgbatch_init>
+  8016fe:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801701:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801703:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  801706:	e9 82 00 00 00       	jmp    80178d <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80170b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80170e:	85 db                	test   %ebx,%ebx
+  801710:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801713:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801716:	5b                   	pop    %ebx
+  801717:	5e                   	pop    %esi
+  801718:	5f                   	pop    %edi
+  801719:	5d                   	pop    %ebp
+  80171a:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80171b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801720:	29 c8                	sub    %ecx,%eax
+  801722:	39 d0                	cmp    %edx,%eax
+  801724:	0f 46 d0             	cmovbe %eax,%edx
+  801727:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  801729:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80172f:	85 ff                	test   %edi,%edi
+  801731:	0f 49 c7             	cmovns %edi,%eax
+  801734:	c1 f8 0c             	sar    $0xc,%eax
+  801737:	ba 01 00 00 00       	mov    $0x1,%edx
+  80173c:	e8 87 fc ff ff       	call   8013c8 <nsbulk_own>
+  801741:	85 c0                	test   %eax,%eax
+  801743:	0f 88 17 01 00 00    	js     801860 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  801749:	83 ec 04             	sub    $0x4,%esp
+  80174c:	56                   	push   %esi
+  80174d:	ff 75 e0             	push   -0x20(%ebp)
+  801750:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801753:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801758:	50                   	push   %eax
+  801759:	e8 f9 1b 00 00       	call   803357 <memmove>
+  80175e:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801761:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801764:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801767:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80176a:	0f 84 fd 00 00 00    	je     80186d <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801770:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801773:	01 f7                	add    %esi,%edi
+  801775:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801778:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80177b:	0f 8d 01 01 00 00    	jge    801882 <nsipc_sendmsg+0x1d6>
+  801781:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  801787:	0f 8f f0 00 00 00    	jg     80187d <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80178d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801790:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801793:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  801796:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801799:	89 c2                	mov    %eax,%edx
+  80179b:	03 13                	add    (%ebx),%edx
+  80179d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017a0:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017a3:	29 c6                	sub    %eax,%esi
+  8017a5:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017aa:	29 f9                	sub    %edi,%ecx
+  8017ac:	39 ce                	cmp    %ecx,%esi
+  8017ae:	89 ca                	mov    %ecx,%edx
+  8017b0:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017b3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017b6:	89 f9                	mov    %edi,%ecx
+  8017b8:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017c1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017c6:	09 c8                	or     %ecx,%eax
+  8017c8:	0f 85 4d ff ff ff    	jne    80171b <nsipc_sendmsg+0x6f>
+  8017ce:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017d4:	0f 86 41 ff ff ff    	jbe    80171b <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017da:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8017e0:	85 ff                	test   %edi,%edi
+  8017e2:	0f 49 c7             	cmovns %edi,%eax
+  8017e5:	c1 f8 0c             	sar    $0xc,%eax
+  8017e8:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8017ea:	89 d1                	mov    %edx,%ecx
+  8017ec:	c1 e9 0c             	shr    $0xc,%ecx
+  8017ef:	01 c8                	add    %ecx,%eax
+  8017f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017f4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017f7:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8017f9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8017fc:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801801:	29 c8                	sub    %ecx,%eax
+  801803:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801806:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801809:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80180b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801810:	89 f9                	mov    %edi,%ecx
+  801812:	d3 e0                	shl    %cl,%eax
+  801814:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80181a:	83 ec 08             	sub    $0x8,%esp
+  80181d:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80181f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801822:	50                   	push   %eax
+  801823:	6a 00                	push   $0x0
+  801825:	56                   	push   %esi
+  801826:	6a 00                	push   $0x0
+  801828:	68 20 50 80 00       	push   $0x805020
+  80182d:	e8 e4 0e 00 00       	call   802716 <pgbatch_map>
+  801832:	83 c4 20             	add    $0x20,%esp
+  801835:	85 c0                	test   %eax,%eax
+  801837:	0f 88 ce fe ff ff    	js     80170b <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80183d:	83 c7 01             	add    $0x1,%edi
+  801840:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801846:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801849:	39 c7                	cmp    %eax,%edi
+  80184b:	75 be                	jne    80180b <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80184d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801850:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801853:	89 d6                	mov    %edx,%esi
+  801855:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80185b:	e9 01 ff ff ff       	jmp    801761 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801863:	85 db                	test   %ebx,%ebx
+  801865:	0f 45 c3             	cmovne %ebx,%eax
+  801868:	e9 a6 fe ff ff       	jmp    801713 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80186d:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  801871:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801878:	e9 f3 fe ff ff       	jmp    801770 <nsipc_sendmsg+0xc4>
+  80187d:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801880:	eb 03                	jmp    801885 <nsipc_sendmsg+0x1d9>
+  801882:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  801885:	83 ec 0c             	sub    $0xc,%esp
+  801888:	68 20 50 80 00       	push   $0x805020
+  80188d:	e8 d4 0d 00 00       	call   802666 <pgbatch_flush>
+  801892:	83 c4 10             	add    $0x10,%esp
+  801895:	85 c0                	test   %eax,%eax
+  801897:	78 50                	js     8018e9 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  801899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189c:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018a1:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018a7:	89 fb                	mov    %edi,%ebx
+  8018a9:	29 f3                	sub    %esi,%ebx
+  8018ab:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018b4:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018b9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018be:	89 fa                	mov    %edi,%edx
+  8018c0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018c5:	e8 66 fb ff ff       	call   801430 <nsipc_bulk>
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	78 28                	js     8018f6 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018ce:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8018d1:	39 c3                	cmp    %eax,%ebx
+  8018d3:	75 0c                	jne    8018e1 <nsipc_sendmsg+0x235>
+  8018d5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018d8:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8018db:	0f 8f f2 fd ff ff    	jg     8016d3 <nsipc_sendmsg+0x27>
+		sent += r;
+  8018e1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018e4:	e9 2a fe ff ff       	jmp    801713 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018e9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018ec:	85 db                	test   %ebx,%ebx
+  8018ee:	0f 45 c3             	cmovne %ebx,%eax
+  8018f1:	e9 1d fe ff ff       	jmp    801713 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018f6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018f9:	85 db                	test   %ebx,%ebx
+  8018fb:	0f 45 c3             	cmovne %ebx,%eax
+  8018fe:	e9 10 fe ff ff       	jmp    801713 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801903:	83 ec 0c             	sub    $0xc,%esp
+  801906:	68 20 50 80 00       	push   $0x805020
+  80190b:	e8 48 0d 00 00       	call   802658 <pgbatch_init>
+  801910:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801913:	be 00 00 00 00       	mov    $0x0,%esi
+  801918:	bf 00 00 00 00       	mov    $0x0,%edi
+  80191d:	e9 63 ff ff ff       	jmp    801885 <nsipc_sendmsg+0x1d9>
+
+00801922 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801922:	55                   	push   %ebp
+  801923:	89 e5                	mov    %esp,%ebp
+  801925:	57                   	push   %edi
+  801926:	56                   	push   %esi
+  801927:	53                   	push   %ebx
+  801928:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80192b:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  801932:	0f 84 c8 00 00 00    	je     801a00 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  801938:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80193f:	0f 84 e4 00 00 00    	je     801a29 <nsipc_sendfile+0x107>
+{
+  801945:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80194a:	89 fb                	mov    %edi,%ebx
+  80194c:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80194f:	0f 83 f0 00 00 00    	jae    801a45 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  801955:	89 fa                	mov    %edi,%edx
+  801957:	03 55 10             	add    0x10(%ebp),%edx
+  80195a:	89 d0                	mov    %edx,%eax
+  80195c:	c1 f8 1f             	sar    $0x1f,%eax
+  80195f:	c1 e8 14             	shr    $0x14,%eax
+  801962:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  801965:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80196b:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80196d:	6a 10                	push   $0x10
+  80196f:	68 00 20 01 e0       	push   $0xe0012000
+  801974:	52                   	push   %edx
+  801975:	ff 75 0c             	push   0xc(%ebp)
+  801978:	e8 fe f4 ff ff       	call   800e7b <fmap>
+  80197d:	83 c4 10             	add    $0x10,%esp
+  801980:	85 c0                	test   %eax,%eax
+  801982:	0f 8e b8 00 00 00    	jle    801a40 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  801988:	39 c6                	cmp    %eax,%esi
+  80198a:	0f 8d b5 00 00 00    	jge    801a45 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  801990:	29 f0                	sub    %esi,%eax
+  801992:	8b 55 14             	mov    0x14(%ebp),%edx
+  801995:	29 da                	sub    %ebx,%edx
+  801997:	39 d0                	cmp    %edx,%eax
+  801999:	89 d3                	mov    %edx,%ebx
+  80199b:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80199e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a1:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019a6:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019ac:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019b2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019b5:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019ba:	83 ec 0c             	sub    $0xc,%esp
+  8019bd:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019bf:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019c6:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019c9:	83 c0 01             	add    $0x1,%eax
+  8019cc:	50                   	push   %eax
+  8019cd:	68 00 10 01 e0       	push   $0xe0011000
+  8019d2:	6a 11                	push   $0x11
+  8019d4:	ff 35 24 53 80 00    	push   0x805324
+  8019da:	e8 04 1e 00 00       	call   8037e3 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8019df:	83 c4 1c             	add    $0x1c,%esp
+  8019e2:	6a 00                	push   $0x0
+  8019e4:	6a 00                	push   $0x0
+  8019e6:	6a 00                	push   $0x0
+  8019e8:	e8 32 1b 00 00       	call   80351f <ipc_recv>
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 5b                	js     801a4f <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8019f4:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8019f6:	39 c3                	cmp    %eax,%ebx
+  8019f8:	0f 8e 4c ff ff ff    	jle    80194a <nsipc_sendfile+0x28>
+  8019fe:	eb 45                	jmp    801a45 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a00:	83 ec 04             	sub    $0x4,%esp
+  801a03:	6a 07                	push   $0x7
+  801a05:	68 00 10 01 e0       	push   $0xe0011000
+  801a0a:	6a 00                	push   $0x0
+  801a0c:	e8 89 e7 ff ff       	call   80019a <sys_page_alloc>
+  801a11:	89 c7                	mov    %eax,%edi
+  801a13:	83 c4 10             	add    $0x10,%esp
+  801a16:	85 c0                	test   %eax,%eax
+  801a18:	78 2b                	js     801a45 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a1a:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a21:	00 00 00 
+  801a24:	e9 0f ff ff ff       	jmp    801938 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a29:	83 ec 0c             	sub    $0xc,%esp
+  801a2c:	6a 03                	push   $0x3
+  801a2e:	e8 e5 1d 00 00       	call   803818 <ipc_find_env>
+  801a33:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a38:	83 c4 10             	add    $0x10,%esp
+  801a3b:	e9 05 ff ff ff       	jmp    801945 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a40:	85 ff                	test   %edi,%edi
+  801a42:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a45:	89 f8                	mov    %edi,%eax
+  801a47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4a:	5b                   	pop    %ebx
+  801a4b:	5e                   	pop    %esi
+  801a4c:	5f                   	pop    %edi
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a4f:	85 ff                	test   %edi,%edi
+  801a51:	0f 44 f8             	cmove  %eax,%edi
+  801a54:	eb ef                	jmp    801a45 <nsipc_sendfile+0x123>
+
+00801a56 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	57                   	push   %edi
+  801a5a:	56                   	push   %esi
+  801a5b:	53                   	push   %ebx
+  801a5c:	83 ec 1c             	sub    $0x1c,%esp
+  801a5f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a62:	e8 13 f9 ff ff       	call   80137a <nsbulk_map>
+  801a67:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	0f 88 ba 00 00 00    	js     801b2c <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a72:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a76:	0f 8e bb 00 00 00    	jle    801b37 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801a7c:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a81:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801a86:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801a8b:	89 f8                	mov    %edi,%eax
+  801a8d:	29 f0                	sub    %esi,%eax
+  801a8f:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801a93:	39 c8                	cmp    %ecx,%eax
+  801a95:	0f 47 c1             	cmova  %ecx,%eax
+  801a98:	01 f0                	add    %esi,%eax
+  801a9a:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a9c:	83 c2 01             	add    $0x1,%edx
+  801a9f:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801aa2:	7e 07                	jle    801aab <nsipc_recvmsg+0x55>
+  801aa4:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801aa9:	7e e0                	jle    801a8b <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801aab:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801ab1:	c1 fa 0c             	sar    $0xc,%edx
+  801ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab9:	e8 0a f9 ff ff       	call   8013c8 <nsbulk_own>
+  801abe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	78 67                	js     801b2c <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac8:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801acd:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801ad3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad6:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801adb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801ae0:	89 f2                	mov    %esi,%edx
+  801ae2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ae7:	e8 44 f9 ff ff       	call   801430 <nsipc_bulk>
+  801aec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801aef:	85 c0                	test   %eax,%eax
+  801af1:	78 39                	js     801b2c <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801af3:	39 f0                	cmp    %esi,%eax
+  801af5:	7f 4a                	jg     801b41 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	7e 2c                	jle    801b2c <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b03:	29 fe                	sub    %edi,%esi
+  801b05:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b08:	39 c6                	cmp    %eax,%esi
+  801b0a:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b0d:	83 ec 04             	sub    $0x4,%esp
+  801b10:	56                   	push   %esi
+  801b11:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b17:	50                   	push   %eax
+  801b18:	ff 33                	push   (%ebx)
+  801b1a:	e8 38 18 00 00       	call   803357 <memmove>
+		n += m;
+  801b1f:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b21:	83 c3 08             	add    $0x8,%ebx
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b2a:	7f d4                	jg     801b00 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b32:	5b                   	pop    %ebx
+  801b33:	5e                   	pop    %esi
+  801b34:	5f                   	pop    %edi
+  801b35:	5d                   	pop    %ebp
+  801b36:	c3                   	ret
+	int r, i, n, len = 0;
+  801b37:	be 00 00 00 00       	mov    $0x0,%esi
+  801b3c:	e9 6a ff ff ff       	jmp    801aab <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b41:	68 60 3b 80 00       	push   $0x803b60
+  801b46:	68 69 3b 80 00       	push   $0x803b69
+  801b4b:	68 3b 01 00 00       	push   $0x13b
+  801b50:	68 7e 3b 80 00       	push   $0x803b7e
+  801b55:	e8 7b 0e 00 00       	call   8029d5 <_panic>
+
+00801b5a <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	57                   	push   %edi
+  801b5e:	56                   	push   %esi
+  801b5f:	53                   	push   %ebx
+  801b60:	83 ec 0c             	sub    $0xc,%esp
+  801b63:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b66:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b69:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801b74:	8b 07                	mov    (%edi),%eax
+  801b76:	a3 04 70 80 00       	mov    %eax,0x807004
+  801b7b:	8b 47 04             	mov    0x4(%edi),%eax
+  801b7e:	a3 08 70 80 00       	mov    %eax,0x807008
+  801b83:	8b 47 08             	mov    0x8(%edi),%eax
+  801b86:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801b8b:	8b 47 0c             	mov    0xc(%edi),%eax
+  801b8e:	a3 10 70 80 00       	mov    %eax,0x807010
+  801b93:	8b 47 10             	mov    0x10(%edi),%eax
+  801b96:	a3 14 70 80 00       	mov    %eax,0x807014
+  801b9b:	8b 47 14             	mov    0x14(%edi),%eax
+  801b9e:	a3 18 70 80 00       	mov    %eax,0x807018
+  801ba3:	8b 47 18             	mov    0x18(%edi),%eax
+  801ba6:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bab:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bae:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bb3:	8b 47 20             	mov    0x20(%edi),%eax
+  801bb6:	a3 24 70 80 00       	mov    %eax,0x807024
+  801bbb:	8b 47 24             	mov    0x24(%edi),%eax
+  801bbe:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bc3:	8b 47 28             	mov    0x28(%edi),%eax
+  801bc6:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801bcb:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801bce:	a3 30 70 80 00       	mov    %eax,0x807030
+  801bd3:	8b 47 30             	mov    0x30(%edi),%eax
+  801bd6:	a3 34 70 80 00       	mov    %eax,0x807034
+  801bdb:	8b 47 34             	mov    0x34(%edi),%eax
+  801bde:	a3 38 70 80 00       	mov    %eax,0x807038
+  801be3:	8b 47 38             	mov    0x38(%edi),%eax
+  801be6:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801beb:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801bee:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801bf3:	8b 06                	mov    (%esi),%eax
+  801bf5:	a3 44 70 80 00       	mov    %eax,0x807044
+  801bfa:	8b 46 04             	mov    0x4(%esi),%eax
+  801bfd:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c02:	8b 46 08             	mov    0x8(%esi),%eax
+  801c05:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c0a:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c0d:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c12:	8b 46 10             	mov    0x10(%esi),%eax
+  801c15:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c1a:	8b 46 14             	mov    0x14(%esi),%eax
+  801c1d:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c22:	8b 46 18             	mov    0x18(%esi),%eax
+  801c25:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c2a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c2d:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c32:	8b 46 20             	mov    0x20(%esi),%eax
+  801c35:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c3a:	8b 46 24             	mov    0x24(%esi),%eax
+  801c3d:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c42:	8b 46 28             	mov    0x28(%esi),%eax
+  801c45:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c4a:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c4d:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c52:	8b 46 30             	mov    0x30(%esi),%eax
+  801c55:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c5a:	8b 46 34             	mov    0x34(%esi),%eax
+  801c5d:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c62:	8b 46 38             	mov    0x38(%esi),%eax
+  801c65:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c6a:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c6d:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801c72:	8b 03                	mov    (%ebx),%eax
+  801c74:	a3 84 70 80 00       	mov    %eax,0x807084
+  801c79:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c7c:	a3 88 70 80 00       	mov    %eax,0x807088
+  801c81:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c84:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801c89:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c8c:	a3 90 70 80 00       	mov    %eax,0x807090
+  801c91:	8b 43 10             	mov    0x10(%ebx),%eax
+  801c94:	a3 94 70 80 00       	mov    %eax,0x807094
+  801c99:	8b 43 14             	mov    0x14(%ebx),%eax
+  801c9c:	a3 98 70 80 00       	mov    %eax,0x807098
+  801ca1:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ca4:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801ca9:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cac:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cb1:	8b 43 20             	mov    0x20(%ebx),%eax
+  801cb4:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801cb9:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cbc:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cc1:	8b 43 28             	mov    0x28(%ebx),%eax
+  801cc4:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801cc9:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801ccc:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801cd1:	8b 43 30             	mov    0x30(%ebx),%eax
+  801cd4:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801cd9:	8b 43 34             	mov    0x34(%ebx),%eax
+  801cdc:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801ce1:	8b 43 38             	mov    0x38(%ebx),%eax
+  801ce4:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801ce9:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801cec:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801cf1:	8b 45 18             	mov    0x18(%ebp),%eax
+  801cf4:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801cf9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cfe:	e8 2b f6 ff ff       	call   80132e <nsipc>
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	0f 88 ad 01 00 00    	js     801eb8 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d0b:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d11:	89 17                	mov    %edx,(%edi)
+  801d13:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d19:	89 57 04             	mov    %edx,0x4(%edi)
+  801d1c:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d22:	89 57 08             	mov    %edx,0x8(%edi)
+  801d25:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d2b:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d2e:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d34:	89 57 10             	mov    %edx,0x10(%edi)
+  801d37:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d3d:	89 57 14             	mov    %edx,0x14(%edi)
+  801d40:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d46:	89 57 18             	mov    %edx,0x18(%edi)
+  801d49:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d4f:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d52:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d58:	89 57 20             	mov    %edx,0x20(%edi)
+  801d5b:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d61:	89 57 24             	mov    %edx,0x24(%edi)
+  801d64:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d6a:	89 57 28             	mov    %edx,0x28(%edi)
+  801d6d:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801d73:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801d76:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801d7c:	89 57 30             	mov    %edx,0x30(%edi)
+  801d7f:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801d85:	89 57 34             	mov    %edx,0x34(%edi)
+  801d88:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801d8e:	89 57 38             	mov    %edx,0x38(%edi)
+  801d91:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801d97:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801d9a:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801da0:	89 16                	mov    %edx,(%esi)
+  801da2:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801da8:	89 56 04             	mov    %edx,0x4(%esi)
+  801dab:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801db1:	89 56 08             	mov    %edx,0x8(%esi)
+  801db4:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dba:	89 56 0c             	mov    %edx,0xc(%esi)
+  801dbd:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801dc3:	89 56 10             	mov    %edx,0x10(%esi)
+  801dc6:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801dcc:	89 56 14             	mov    %edx,0x14(%esi)
+  801dcf:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801dd5:	89 56 18             	mov    %edx,0x18(%esi)
+  801dd8:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801dde:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801de1:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801de7:	89 56 20             	mov    %edx,0x20(%esi)
+  801dea:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801df0:	89 56 24             	mov    %edx,0x24(%esi)
+  801df3:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801df9:	89 56 28             	mov    %edx,0x28(%esi)
+  801dfc:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e02:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e05:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e0b:	89 56 30             	mov    %edx,0x30(%esi)
+  801e0e:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e14:	89 56 34             	mov    %edx,0x34(%esi)
+  801e17:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e1d:	89 56 38             	mov    %edx,0x38(%esi)
+  801e20:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e26:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e29:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e2f:	89 13                	mov    %edx,(%ebx)
+  801e31:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e37:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e3a:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e40:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e43:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e49:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e4c:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e52:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e55:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e5b:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e5e:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e64:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e67:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e6d:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801e70:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801e76:	89 53 20             	mov    %edx,0x20(%ebx)
+  801e79:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801e7f:	89 53 24             	mov    %edx,0x24(%ebx)
+  801e82:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801e88:	89 53 28             	mov    %edx,0x28(%ebx)
+  801e8b:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801e91:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801e94:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801e9a:	89 53 30             	mov    %edx,0x30(%ebx)
+  801e9d:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801ea3:	89 53 34             	mov    %edx,0x34(%ebx)
+  801ea6:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801eac:	89 53 38             	mov    %edx,0x38(%ebx)
+  801eaf:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801eb5:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801eb8:	83 c4 0c             	add    $0xc,%esp
+  801ebb:	5b                   	pop    %ebx
+  801ebc:	5e                   	pop    %esi
+  801ebd:	5f                   	pop    %edi
+  801ebe:	5d                   	pop    %ebp
+  801ebf:	c3                   	ret
+
+00801ec0 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ec0:	55                   	push   %ebp
+  801ec1:	89 e5                	mov    %esp,%ebp
+  801ec3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801ece:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed1:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801ed6:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ed9:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801ede:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ee3:	e8 46 f4 ff ff       	call   80132e <nsipc>
+}
+  801ee8:	c9                   	leave
+  801ee9:	c3                   	ret
+
+00801eea <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801eea:	55                   	push   %ebp
+  801eeb:	89 e5                	mov    %esp,%ebp
+  801eed:	56                   	push   %esi
+  801eee:	53                   	push   %ebx
+  801eef:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801ef2:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801ef8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801efb:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f00:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f05:	e8 24 f4 ff ff       	call   80132e <nsipc>
+  801f0a:	89 c3                	mov    %eax,%ebx
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	7e 1f                	jle    801f2f <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f10:	39 c6                	cmp    %eax,%esi
+  801f12:	7c 24                	jl     801f38 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f14:	83 ec 04             	sub    $0x4,%esp
+  801f17:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f1e:	50                   	push   %eax
+  801f1f:	68 00 70 80 00       	push   $0x807000
+  801f24:	ff 75 08             	push   0x8(%ebp)
+  801f27:	e8 2b 14 00 00       	call   803357 <memmove>
+  801f2c:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f2f:	89 d8                	mov    %ebx,%eax
+  801f31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f34:	5b                   	pop    %ebx
+  801f35:	5e                   	pop    %esi
+  801f36:	5d                   	pop    %ebp
+  801f37:	c3                   	ret
+		assert(r <= max);
+  801f38:	68 96 3b 80 00       	push   $0x803b96
+  801f3d:	68 69 3b 80 00       	push   $0x803b69
+  801f42:	68 6a 01 00 00       	push   $0x16a
+  801f47:	68 7e 3b 80 00       	push   $0x803b7e
+  801f4c:	e8 84 0a 00 00       	call   8029d5 <_panic>
+
+00801f51 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f51:	55                   	push   %ebp
+  801f52:	89 e5                	mov    %esp,%ebp
+  801f54:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f62:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f67:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f6a:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f6f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f74:	e8 b5 f3 ff ff       	call   80132e <nsipc>
+}
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+
+00801f7b <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801f81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f84:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801f89:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f8e:	e8 9b f3 ff ff       	call   80132e <nsipc>
+}
+  801f93:	c9                   	leave
+  801f94:	c3                   	ret
+
+00801f95 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801f95:	55                   	push   %ebp
+  801f96:	89 e5                	mov    %esp,%ebp
+  801f98:	53                   	push   %ebx
+  801f99:	83 ec 04             	sub    $0x4,%esp
+  801f9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801f9f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fa4:	e8 85 f3 ff ff       	call   80132e <nsipc>
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	78 50                	js     801ffd <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fad:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fb3:	89 13                	mov    %edx,(%ebx)
+  801fb5:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801fbb:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fbe:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801fc4:	89 53 08             	mov    %edx,0x8(%ebx)
+  801fc7:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801fcd:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801fd0:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801fd6:	89 53 10             	mov    %edx,0x10(%ebx)
+  801fd9:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801fdf:	89 53 14             	mov    %edx,0x14(%ebx)
+  801fe2:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801fe8:	89 53 18             	mov    %edx,0x18(%ebx)
+  801feb:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801ff1:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801ff4:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801ffa:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  801ffd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802000:	c9                   	leave
+  802001:	c3                   	ret
+
+00802002 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802002:	55                   	push   %ebp
+  802003:	89 e5                	mov    %esp,%ebp
+  802005:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802008:	6a 03                	push   $0x3
+  80200a:	e8 09 18 00 00       	call   803818 <ipc_find_env>
+  80200f:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802014:	8b 45 08             	mov    0x8(%ebp),%eax
+  802017:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80201c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802021:	e8 08 f3 ff ff       	call   80132e <nsipc>
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	85 c0                	test   %eax,%eax
+  80202b:	78 0a                	js     802037 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80202d:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802032:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802037:	c9                   	leave
+  802038:	c3                   	ret
+
+00802039 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802039:	55                   	push   %ebp
+  80203a:	89 e5                	mov    %esp,%ebp
+  80203c:	57                   	push   %edi
+  80203d:	56                   	push   %esi
+  80203e:	53                   	push   %ebx
+  80203f:	83 ec 1c             	sub    $0x1c,%esp
+  802042:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802045:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802048:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80204d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802052:	89 e0                	mov    %esp,%eax
+  802054:	89 f2                	mov    %esi,%edx
+  802056:	29 c2                	sub    %eax,%edx
+  802058:	89 d0                	mov    %edx,%eax
+  80205a:	c1 e8 0f             	shr    $0xf,%eax
+  80205d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802063:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802066:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80206d:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802070:	83 ec 0c             	sub    $0xc,%esp
+  802073:	ff 75 e0             	push   -0x20(%ebp)
+  802076:	e8 dc 17 00 00       	call   803857 <pageref>
+  80207b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80207e:	83 c4 04             	add    $0x4,%esp
+  802081:	ff 75 dc             	push   -0x24(%ebp)
+  802084:	e8 ce 17 00 00       	call   803857 <pageref>
+  802089:	89 e2                	mov    %esp,%edx
+  80208b:	89 f1                	mov    %esi,%ecx
+  80208d:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  80208f:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802092:	89 ca                	mov    %ecx,%edx
+  802094:	c1 ea 0f             	shr    $0xf,%edx
+  802097:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  80209d:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020a0:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020a7:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020aa:	39 d7                	cmp    %edx,%edi
+  8020ac:	74 40                	je     8020ee <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020ae:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020b1:	75 9f                	jne    802052 <_pipeisclosed+0x19>
+  8020b3:	89 e2                	mov    %esp,%edx
+  8020b5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020ba:	29 d0                	sub    %edx,%eax
+  8020bc:	89 c2                	mov    %eax,%edx
+  8020be:	c1 ea 0f             	shr    $0xf,%edx
+  8020c1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cb:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020ce:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020d5:	8b 40 58             	mov    0x58(%eax),%eax
+  8020d8:	6a 01                	push   $0x1
+  8020da:	50                   	push   %eax
+  8020db:	57                   	push   %edi
+  8020dc:	68 9f 3b 80 00       	push   $0x803b9f
+  8020e1:	e8 ca 09 00 00       	call   802ab0 <cprintf>
+  8020e6:	83 c4 10             	add    $0x10,%esp
+  8020e9:	e9 5f ff ff ff       	jmp    80204d <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8020ee:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020f1:	0f 94 c0             	sete   %al
+  8020f4:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8020f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020fa:	5b                   	pop    %ebx
+  8020fb:	5e                   	pop    %esi
+  8020fc:	5f                   	pop    %edi
+  8020fd:	5d                   	pop    %ebp
+  8020fe:	c3                   	ret
+
+008020ff <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020ff:	55                   	push   %ebp
+  802100:	89 e5                	mov    %esp,%ebp
+  802102:	53                   	push   %ebx
+  802103:	83 ec 0c             	sub    $0xc,%esp
+  802106:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802109:	53                   	push   %ebx
+  80210a:	6a 00                	push   $0x0
+  80210c:	e8 0e e1 ff ff       	call   80021f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802111:	89 1c 24             	mov    %ebx,(%esp)
+  802114:	e8 f4 e4 ff ff       	call   80060d <fd2data>
+  802119:	83 c4 08             	add    $0x8,%esp
+  80211c:	50                   	push   %eax
+  80211d:	6a 00                	push   $0x0
+  80211f:	e8 fb e0 ff ff       	call   80021f <sys_page_unmap>
+}
+  802124:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802127:	c9                   	leave
+  802128:	c3                   	ret
+
+00802129 <devpipe_read>:
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	57                   	push   %edi
+  80212d:	56                   	push   %esi
+  80212e:	53                   	push   %ebx
+  80212f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802132:	ff 75 08             	push   0x8(%ebp)
+  802135:	e8 d3 e4 ff ff       	call   80060d <fd2data>
+  80213a:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80213c:	8b 70 04             	mov    0x4(%eax),%esi
+  80213f:	8b 00                	mov    (%eax),%eax
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	39 f0                	cmp    %esi,%eax
+  802146:	75 36                	jne    80217e <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802148:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80214b:	89 da                	mov    %ebx,%edx
+  80214d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802150:	e8 e4 fe ff ff       	call   802039 <_pipeisclosed>
+  802155:	85 c0                	test   %eax,%eax
+  802157:	0f 85 d4 00 00 00    	jne    802231 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80215d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802162:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802166:	83 ec 04             	sub    $0x4,%esp
+  802169:	6a ff                	push   $0xffffffff
+  80216b:	56                   	push   %esi
+  80216c:	57                   	push   %edi
+  80216d:	e8 26 e4 ff ff       	call   800598 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802172:	8b 73 04             	mov    0x4(%ebx),%esi
+  802175:	8b 03                	mov    (%ebx),%eax
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	39 c6                	cmp    %eax,%esi
+  80217c:	74 cd                	je     80214b <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80217e:	8b 73 04             	mov    0x4(%ebx),%esi
+  802181:	8b 03                	mov    (%ebx),%eax
+  802183:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802189:	29 c6                	sub    %eax,%esi
+  80218b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802190:	f7 e6                	mul    %esi
+  802192:	c1 ea 0c             	shr    $0xc,%edx
+  802195:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80219b:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  80219d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021a0:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021a4:	8b 0b                	mov    (%ebx),%ecx
+  8021a6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021ab:	f7 e1                	mul    %ecx
+  8021ad:	c1 ea 0b             	shr    $0xb,%edx
+  8021b0:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021b6:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021b8:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021bd:	29 cf                	sub    %ecx,%edi
+  8021bf:	39 f7                	cmp    %esi,%edi
+  8021c1:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021c4:	83 ec 04             	sub    $0x4,%esp
+  8021c7:	57                   	push   %edi
+  8021c8:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021cc:	50                   	push   %eax
+  8021cd:	ff 75 0c             	push   0xc(%ebp)
+  8021d0:	e8 82 11 00 00       	call   803357 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8021d5:	83 c4 0c             	add    $0xc,%esp
+  8021d8:	89 f0                	mov    %esi,%eax
+  8021da:	29 f8                	sub    %edi,%eax
+  8021dc:	50                   	push   %eax
+  8021dd:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021e0:	50                   	push   %eax
+  8021e1:	89 f8                	mov    %edi,%eax
+  8021e3:	03 45 0c             	add    0xc(%ebp),%eax
+  8021e6:	50                   	push   %eax
+  8021e7:	e8 6b 11 00 00       	call   803357 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8021ec:	8b 0b                	mov    (%ebx),%ecx
+  8021ee:	01 f1                	add    %esi,%ecx
+  8021f0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021f5:	f7 e1                	mul    %ecx
+  8021f7:	c1 ea 0c             	shr    $0xc,%edx
+  8021fa:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802200:	29 c1                	sub    %eax,%ecx
+  802202:	89 0b                	mov    %ecx,(%ebx)
+  802204:	b8 00 00 00 00       	mov    $0x0,%eax
+  802209:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	85 c0                	test   %eax,%eax
+  802212:	75 0a                	jne    80221e <devpipe_read+0xf5>
+	return n;
+  802214:	89 f0                	mov    %esi,%eax
+}
+  802216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802219:	5b                   	pop    %ebx
+  80221a:	5e                   	pop    %esi
+  80221b:	5f                   	pop    %edi
+  80221c:	5d                   	pop    %ebp
+  80221d:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80221e:	83 ec 08             	sub    $0x8,%esp
+  802221:	68 00 04 00 00       	push   $0x400
+  802226:	53                   	push   %ebx
+  802227:	e8 8e e3 ff ff       	call   8005ba <sys_futex_wake>
+  80222c:	83 c4 10             	add    $0x10,%esp
+  80222f:	eb e3                	jmp    802214 <devpipe_read+0xeb>
+			return 0;
+  802231:	b8 00 00 00 00       	mov    $0x0,%eax
+  802236:	eb de                	jmp    802216 <devpipe_read+0xed>
+
+00802238 <devpipe_write>:
+{
+  802238:	55                   	push   %ebp
+  802239:	89 e5                	mov    %esp,%ebp
+  80223b:	57                   	push   %edi
+  80223c:	56                   	push   %esi
+  80223d:	53                   	push   %ebx
+  80223e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802241:	ff 75 08             	push   0x8(%ebp)
+  802244:	e8 c4 e3 ff ff       	call   80060d <fd2data>
+  802249:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802255:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80225a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80225e:	0f 84 43 01 00 00    	je     8023a7 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802264:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802267:	8b 06                	mov    (%esi),%eax
+  802269:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80226f:	29 c1                	sub    %eax,%ecx
+  802271:	89 c8                	mov    %ecx,%eax
+  802273:	f7 e7                	mul    %edi
+  802275:	c1 ea 0c             	shr    $0xc,%edx
+  802278:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80227e:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802280:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802286:	75 52                	jne    8022da <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802288:	89 f2                	mov    %esi,%edx
+  80228a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228d:	e8 a7 fd ff ff       	call   802039 <_pipeisclosed>
+  802292:	85 c0                	test   %eax,%eax
+  802294:	0f 85 28 01 00 00    	jne    8023c2 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80229a:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80229c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80229f:	8b 06                	mov    (%esi),%eax
+  8022a1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022a7:	29 c1                	sub    %eax,%ecx
+  8022a9:	89 c8                	mov    %ecx,%eax
+  8022ab:	f7 e7                	mul    %edi
+  8022ad:	c1 ea 0c             	shr    $0xc,%edx
+  8022b0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022b6:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022b8:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022be:	75 a4                	jne    802264 <devpipe_write+0x2c>
+  8022c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c5:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022c9:	83 ec 04             	sub    $0x4,%esp
+  8022cc:	6a ff                	push   $0xffffffff
+  8022ce:	53                   	push   %ebx
+  8022cf:	56                   	push   %esi
+  8022d0:	e8 c3 e2 ff ff       	call   800598 <sys_futex_wait>
+}
+  8022d5:	83 c4 10             	add    $0x10,%esp
+  8022d8:	eb 8a                	jmp    802264 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022da:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022dd:	8b 06                	mov    (%esi),%eax
+  8022df:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022e5:	29 c1                	sub    %eax,%ecx
+  8022e7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022ec:	f7 e1                	mul    %ecx
+  8022ee:	c1 ea 0c             	shr    $0xc,%edx
+  8022f1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022f7:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8022f9:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022fe:	89 d8                	mov    %ebx,%eax
+  802300:	29 c8                	sub    %ecx,%eax
+  802302:	8b 55 10             	mov    0x10(%ebp),%edx
+  802305:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802308:	29 ca                	sub    %ecx,%edx
+  80230a:	39 d0                	cmp    %edx,%eax
+  80230c:	0f 46 d0             	cmovbe %eax,%edx
+  80230f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802312:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802315:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80231a:	f7 e1                	mul    %ecx
+  80231c:	c1 ea 0b             	shr    $0xb,%edx
+  80231f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802325:	89 ca                	mov    %ecx,%edx
+  802327:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802329:	29 d3                	sub    %edx,%ebx
+  80232b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80232e:	39 c3                	cmp    %eax,%ebx
+  802330:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802333:	83 ec 04             	sub    $0x4,%esp
+  802336:	53                   	push   %ebx
+  802337:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80233a:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80233d:	51                   	push   %ecx
+  80233e:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802342:	50                   	push   %eax
+  802343:	e8 0f 10 00 00       	call   803357 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802348:	83 c4 0c             	add    $0xc,%esp
+  80234b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80234e:	29 d8                	sub    %ebx,%eax
+  802350:	50                   	push   %eax
+  802351:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802354:	01 cb                	add    %ecx,%ebx
+  802356:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802359:	53                   	push   %ebx
+  80235a:	8d 46 10             	lea    0x10(%esi),%eax
+  80235d:	50                   	push   %eax
+  80235e:	e8 f4 0f 00 00       	call   803357 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802363:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802366:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802369:	01 c1                	add    %eax,%ecx
+  80236b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802370:	f7 e1                	mul    %ecx
+  802372:	c1 ea 0c             	shr    $0xc,%edx
+  802375:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80237b:	89 ca                	mov    %ecx,%edx
+  80237d:	29 c2                	sub    %eax,%edx
+  80237f:	89 56 04             	mov    %edx,0x4(%esi)
+  802382:	b8 00 00 00 00       	mov    $0x0,%eax
+  802387:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80238b:	83 c4 10             	add    $0x10,%esp
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	75 1a                	jne    8023ac <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802392:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802395:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802398:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80239b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80239e:	0f 82 c0 fe ff ff    	jb     802264 <devpipe_write+0x2c>
+  8023a4:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023a7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023aa:	eb 1b                	jmp    8023c7 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023ac:	83 ec 08             	sub    $0x8,%esp
+  8023af:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023b4:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023b7:	50                   	push   %eax
+  8023b8:	e8 fd e1 ff ff       	call   8005ba <sys_futex_wake>
+  8023bd:	83 c4 10             	add    $0x10,%esp
+  8023c0:	eb d0                	jmp    802392 <devpipe_write+0x15a>
+				return 0;
+  8023c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5f                   	pop    %edi
+  8023cd:	5d                   	pop    %ebp
+  8023ce:	c3                   	ret
+
+008023cf <devpipe_stat>:
+{
+  8023cf:	55                   	push   %ebp
+  8023d0:	89 e5                	mov    %esp,%ebp
+  8023d2:	56                   	push   %esi
+  8023d3:	53                   	push   %ebx
+  8023d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023d7:	83 ec 0c             	sub    $0xc,%esp
+  8023da:	ff 75 08             	push   0x8(%ebp)
+  8023dd:	e8 2b e2 ff ff       	call   80060d <fd2data>
+  8023e2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023e4:	83 c4 08             	add    $0x8,%esp
+  8023e7:	68 b2 3b 80 00       	push   $0x803bb2
+  8023ec:	53                   	push   %ebx
+  8023ed:	e8 b5 0d 00 00       	call   8031a7 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8023f2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8023f5:	8b 06                	mov    (%esi),%eax
+  8023f7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8023fd:	29 c1                	sub    %eax,%ecx
+  8023ff:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802404:	89 c8                	mov    %ecx,%eax
+  802406:	f7 e2                	mul    %edx
+  802408:	c1 ea 0c             	shr    $0xc,%edx
+  80240b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802411:	29 d1                	sub    %edx,%ecx
+  802413:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802419:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802420:	00 00 00 
+	stat->st_dev = &devpipe;
+  802423:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  80242a:	40 80 00 
+}
+  80242d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802432:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802435:	5b                   	pop    %ebx
+  802436:	5e                   	pop    %esi
+  802437:	5d                   	pop    %ebp
+  802438:	c3                   	ret
+
+00802439 <devpipe_poll>:
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	57                   	push   %edi
+  80243d:	56                   	push   %esi
+  80243e:	53                   	push   %ebx
+  80243f:	83 ec 18             	sub    $0x18,%esp
+  802442:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802445:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802448:	57                   	push   %edi
+  802449:	e8 bf e1 ff ff       	call   80060d <fd2data>
+  80244e:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802450:	83 c4 10             	add    $0x10,%esp
+  802453:	89 f3                	mov    %esi,%ebx
+  802455:	83 e3 01             	and    $0x1,%ebx
+  802458:	75 27                	jne    802481 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80245a:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802460:	75 48                	jne    8024aa <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802462:	89 ca                	mov    %ecx,%edx
+  802464:	89 f8                	mov    %edi,%eax
+  802466:	e8 ce fb ff ff       	call   802039 <_pipeisclosed>
+  80246b:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80246d:	89 d8                	mov    %ebx,%eax
+  80246f:	83 c8 10             	or     $0x10,%eax
+  802472:	85 d2                	test   %edx,%edx
+  802474:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802477:	89 d8                	mov    %ebx,%eax
+  802479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80247c:	5b                   	pop    %ebx
+  80247d:	5e                   	pop    %esi
+  80247e:	5f                   	pop    %edi
+  80247f:	5d                   	pop    %ebp
+  802480:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802481:	8b 58 04             	mov    0x4(%eax),%ebx
+  802484:	8b 00                	mov    (%eax),%eax
+  802486:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80248c:	29 c3                	sub    %eax,%ebx
+  80248e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802493:	89 d8                	mov    %ebx,%eax
+  802495:	f7 e2                	mul    %edx
+  802497:	c1 ea 0c             	shr    $0xc,%edx
+  80249a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024a0:	39 d3                	cmp    %edx,%ebx
+  8024a2:	0f 95 c3             	setne  %bl
+  8024a5:	0f b6 db             	movzbl %bl,%ebx
+  8024a8:	eb b0                	jmp    80245a <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024aa:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024ad:	8b 01                	mov    (%ecx),%eax
+  8024af:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024b5:	29 c6                	sub    %eax,%esi
+  8024b7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024bc:	89 f0                	mov    %esi,%eax
+  8024be:	f7 e2                	mul    %edx
+  8024c0:	c1 ea 0c             	shr    $0xc,%edx
+  8024c3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024c9:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024cb:	89 d8                	mov    %ebx,%eax
+  8024cd:	83 c8 04             	or     $0x4,%eax
+  8024d0:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8024d6:	0f 42 d8             	cmovb  %eax,%ebx
+  8024d9:	eb 87                	jmp    802462 <devpipe_poll+0x29>
+
+008024db <pipe>:
+{
+  8024db:	55                   	push   %ebp
+  8024dc:	89 e5                	mov    %esp,%ebp
+  8024de:	56                   	push   %esi
+  8024df:	53                   	push   %ebx
+  8024e0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e6:	50                   	push   %eax
+  8024e7:	e8 38 e1 ff ff       	call   800624 <fd_alloc>
+  8024ec:	89 c3                	mov    %eax,%ebx
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	85 c0                	test   %eax,%eax
+  8024f3:	0f 88 23 01 00 00    	js     80261c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024f9:	83 ec 04             	sub    $0x4,%esp
+  8024fc:	68 07 04 00 00       	push   $0x407
+  802501:	ff 75 f4             	push   -0xc(%ebp)
+  802504:	6a 00                	push   $0x0
+  802506:	e8 8f dc ff ff       	call   80019a <sys_page_alloc>
+  80250b:	89 c3                	mov    %eax,%ebx
+  80250d:	83 c4 10             	add    $0x10,%esp
+  802510:	85 c0                	test   %eax,%eax
+  802512:	0f 88 04 01 00 00    	js     80261c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802518:	83 ec 0c             	sub    $0xc,%esp
+  80251b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80251e:	50                   	push   %eax
+  80251f:	e8 00 e1 ff ff       	call   800624 <fd_alloc>
+  802524:	89 c3                	mov    %eax,%ebx
+  802526:	83 c4 10             	add    $0x10,%esp
+  802529:	85 c0                	test   %eax,%eax
+  80252b:	0f 88 db 00 00 00    	js     80260c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802531:	83 ec 04             	sub    $0x4,%esp
+  802534:	68 07 04 00 00       	push   $0x407
+  802539:	ff 75 f0             	push   -0x10(%ebp)
+  80253c:	6a 00                	push   $0x0
+  80253e:	e8 57 dc ff ff       	call   80019a <sys_page_alloc>
+  802543:	89 c3                	mov    %eax,%ebx
+  802545:	83 c4 10             	add    $0x10,%esp
+  802548:	85 c0                	test   %eax,%eax
+  80254a:	0f 88 bc 00 00 00    	js     80260c <pipe+0x131>
+	va = fd2data(fd0);
+  802550:	83 ec 0c             	sub    $0xc,%esp
+  802553:	ff 75 f4             	push   -0xc(%ebp)
+  802556:	e8 b2 e0 ff ff       	call   80060d <fd2data>
+  80255b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80255d:	83 c4 0c             	add    $0xc,%esp
+  802560:	68 07 04 00 00       	push   $0x407
+  802565:	50                   	push   %eax
+  802566:	6a 00                	push   $0x0
+  802568:	e8 2d dc ff ff       	call   80019a <sys_page_alloc>
+  80256d:	89 c3                	mov    %eax,%ebx
+  80256f:	83 c4 10             	add    $0x10,%esp
+  802572:	85 c0                	test   %eax,%eax
+  802574:	0f 88 82 00 00 00    	js     8025fc <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80257a:	83 ec 0c             	sub    $0xc,%esp
+  80257d:	ff 75 f0             	push   -0x10(%ebp)
+  802580:	e8 88 e0 ff ff       	call   80060d <fd2data>
+  802585:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80258c:	50                   	push   %eax
+  80258d:	6a 00                	push   $0x0
+  80258f:	56                   	push   %esi
+  802590:	6a 00                	push   $0x0
+  802592:	e8 46 dc ff ff       	call   8001dd <sys_page_map>
+  802597:	89 c3                	mov    %eax,%ebx
+  802599:	83 c4 20             	add    $0x20,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 4e                	js     8025ee <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025a0:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025a8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025ad:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025b4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025b7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025bc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025c3:	83 ec 0c             	sub    $0xc,%esp
+  8025c6:	ff 75 f4             	push   -0xc(%ebp)
+  8025c9:	e8 2f e0 ff ff       	call   8005fd <fd2num>
+  8025ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025d1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025d3:	83 c4 04             	add    $0x4,%esp
+  8025d6:	ff 75 f0             	push   -0x10(%ebp)
+  8025d9:	e8 1f e0 ff ff       	call   8005fd <fd2num>
+  8025de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025e1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025e4:	83 c4 10             	add    $0x10,%esp
+  8025e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ec:	eb 2e                	jmp    80261c <pipe+0x141>
+	sys_page_unmap(0, va);
+  8025ee:	83 ec 08             	sub    $0x8,%esp
+  8025f1:	56                   	push   %esi
+  8025f2:	6a 00                	push   $0x0
+  8025f4:	e8 26 dc ff ff       	call   80021f <sys_page_unmap>
+  8025f9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8025fc:	83 ec 08             	sub    $0x8,%esp
+  8025ff:	ff 75 f0             	push   -0x10(%ebp)
+  802602:	6a 00                	push   $0x0
+  802604:	e8 16 dc ff ff       	call   80021f <sys_page_unmap>
+  802609:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80260c:	83 ec 08             	sub    $0x8,%esp
+  80260f:	ff 75 f4             	push   -0xc(%ebp)
+  802612:	6a 00                	push   $0x0
+  802614:	e8 06 dc ff ff       	call   80021f <sys_page_unmap>
+  802619:	83 c4 10             	add    $0x10,%esp
+}
+  80261c:	89 d8                	mov    %ebx,%eax
+  80261e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802621:	5b                   	pop    %ebx
+  802622:	5e                   	pop    %esi
+  802623:	5d                   	pop    %ebp
+  802624:	c3                   	ret
+
+00802625 <pipeisclosed>:
+{
+  802625:	55                   	push   %ebp
+  802626:	89 e5                	mov    %esp,%ebp
+  802628:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80262b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80262e:	50                   	push   %eax
+  80262f:	ff 75 08             	push   0x8(%ebp)
+  802632:	e8 3d e0 ff ff       	call   800674 <fd_lookup>
+  802637:	83 c4 10             	add    $0x10,%esp
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	78 18                	js     802656 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80263e:	83 ec 0c             	sub    $0xc,%esp
+  802641:	ff 75 f4             	push   -0xc(%ebp)
+  802644:	e8 c4 df ff ff       	call   80060d <fd2data>
+  802649:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80264b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80264e:	e8 e6 f9 ff ff       	call   802039 <_pipeisclosed>
+  802653:	83 c4 10             	add    $0x10,%esp
+}
+  802656:	c9                   	leave
+  802657:	c3                   	ret
+
+00802658 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  802658:	55                   	push   %ebp
+  802659:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80265b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802664:	5d                   	pop    %ebp
+  802665:	c3                   	ret
+
+00802666 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  802666:	55                   	push   %ebp
+  802667:	89 e5                	mov    %esp,%ebp
+  802669:	53                   	push   %ebx
+  80266a:	83 ec 04             	sub    $0x4,%esp
+  80266d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802670:	8b 03                	mov    (%ebx),%eax
+  802672:	85 c0                	test   %eax,%eax
+  802674:	75 05                	jne    80267b <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  802676:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802679:	c9                   	leave
+  80267a:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80267b:	83 ec 08             	sub    $0x8,%esp
+  80267e:	50                   	push   %eax
+  80267f:	8d 43 04             	lea    0x4(%ebx),%eax
+  802682:	50                   	push   %eax
+  802683:	e8 e7 dd ff ff       	call   80046f <sys_page_batch>
+	pb->pb_n = 0;
+  802688:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80268e:	83 c4 10             	add    $0x10,%esp
+  802691:	eb e3                	jmp    802676 <pgbatch_flush+0x10>
+
+00802693 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  802693:	55                   	push   %ebp
+  802694:	89 e5                	mov    %esp,%ebp
+  802696:	56                   	push   %esi
+  802697:	53                   	push   %ebx
+  802698:	89 c3                	mov    %eax,%ebx
+  80269a:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80269c:	83 38 20             	cmpl   $0x20,(%eax)
+  80269f:	74 2c                	je     8026cd <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026a1:	8b 03                	mov    (%ebx),%eax
+  8026a3:	8d 50 01             	lea    0x1(%eax),%edx
+  8026a6:	89 13                	mov    %edx,(%ebx)
+  8026a8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026ab:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026af:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026b1:	83 ec 04             	sub    $0x4,%esp
+  8026b4:	6a 18                	push   $0x18
+  8026b6:	6a 00                	push   $0x0
+  8026b8:	50                   	push   %eax
+  8026b9:	e8 64 0c 00 00       	call   803322 <memset>
+	return 0;
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c9:	5b                   	pop    %ebx
+  8026ca:	5e                   	pop    %esi
+  8026cb:	5d                   	pop    %ebp
+  8026cc:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026cd:	83 ec 0c             	sub    $0xc,%esp
+  8026d0:	50                   	push   %eax
+  8026d1:	e8 90 ff ff ff       	call   802666 <pgbatch_flush>
+  8026d6:	83 c4 10             	add    $0x10,%esp
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	79 c4                	jns    8026a1 <pgbatch_slot+0xe>
+  8026dd:	eb e7                	jmp    8026c6 <pgbatch_slot+0x33>
+
+008026df <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8026df:	55                   	push   %ebp
+  8026e0:	89 e5                	mov    %esp,%ebp
+  8026e2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8026e5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026eb:	e8 a3 ff ff ff       	call   802693 <pgbatch_slot>
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	78 20                	js     802714 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8026f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026f7:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8026fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802700:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802703:	8b 55 10             	mov    0x10(%ebp),%edx
+  802706:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802709:	8b 55 14             	mov    0x14(%ebp),%edx
+  80270c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802714:	c9                   	leave
+  802715:	c3                   	ret
+
+00802716 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  802716:	55                   	push   %ebp
+  802717:	89 e5                	mov    %esp,%ebp
+  802719:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80271c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80271f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802722:	e8 6c ff ff ff       	call   802693 <pgbatch_slot>
+  802727:	85 c0                	test   %eax,%eax
+  802729:	78 2c                	js     802757 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80272b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80272e:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802734:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802737:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80273a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80273d:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802740:	8b 55 14             	mov    0x14(%ebp),%edx
+  802743:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  802746:	8b 55 18             	mov    0x18(%ebp),%edx
+  802749:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80274c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80274f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802752:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802757:	c9                   	leave
+  802758:	c3                   	ret
+
+00802759 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  802759:	55                   	push   %ebp
+  80275a:	89 e5                	mov    %esp,%ebp
+  80275c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80275f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802762:	8b 45 08             	mov    0x8(%ebp),%eax
+  802765:	e8 29 ff ff ff       	call   802693 <pgbatch_slot>
+  80276a:	85 c0                	test   %eax,%eax
+  80276c:	78 1a                	js     802788 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80276e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802771:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  802777:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80277a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80277d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802780:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  802783:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802788:	c9                   	leave
+  802789:	c3                   	ret
+
+0080278a <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80278a:	55                   	push   %ebp
+  80278b:	89 e5                	mov    %esp,%ebp
+  80278d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802790:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802793:	8b 45 08             	mov    0x8(%ebp),%eax
+  802796:	e8 f8 fe ff ff       	call   802693 <pgbatch_slot>
+  80279b:	85 c0                	test   %eax,%eax
+  80279d:	78 20                	js     8027bf <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  80279f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a2:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027ab:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027ae:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027b1:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027b4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027b7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027bf:	c9                   	leave
+  8027c0:	c3                   	ret
+
+008027c1 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027c1:	55                   	push   %ebp
+  8027c2:	89 e5                	mov    %esp,%ebp
+  8027c4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027c7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027cd:	e8 c1 fe ff ff       	call   802693 <pgbatch_slot>
+  8027d2:	85 c0                	test   %eax,%eax
+  8027d4:	78 26                	js     8027fc <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8027d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d9:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8027df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027e2:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8027e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027e8:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8027eb:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027ee:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8027f1:	8b 55 18             	mov    0x18(%ebp),%edx
+  8027f4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027fc:	c9                   	leave
+  8027fd:	c3                   	ret
+
+008027fe <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8027fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802803:	c3                   	ret
+
+00802804 <devcons_poll>:
+{
+  802804:	55                   	push   %ebp
+  802805:	89 e5                	mov    %esp,%ebp
+  802807:	53                   	push   %ebx
+  802808:	83 ec 04             	sub    $0x4,%esp
+  80280b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80280e:	89 da                	mov    %ebx,%edx
+  802810:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802813:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80281a:	74 0c                	je     802828 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80281c:	89 d8                	mov    %ebx,%eax
+  80281e:	83 e0 01             	and    $0x1,%eax
+  802821:	09 d0                	or     %edx,%eax
+}
+  802823:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802826:	c9                   	leave
+  802827:	c3                   	ret
+		cons_peek = sys_cgetc();
+  802828:	e8 cf d8 ff ff       	call   8000fc <sys_cgetc>
+  80282d:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802832:	89 da                	mov    %ebx,%edx
+  802834:	83 e2 04             	and    $0x4,%edx
+  802837:	85 c0                	test   %eax,%eax
+  802839:	74 e6                	je     802821 <devcons_poll+0x1d>
+  80283b:	eb df                	jmp    80281c <devcons_poll+0x18>
+
+0080283d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802843:	68 be 3b 80 00       	push   $0x803bbe
+  802848:	ff 75 0c             	push   0xc(%ebp)
+  80284b:	e8 57 09 00 00       	call   8031a7 <strcpy>
+	return 0;
+}
+  802850:	b8 00 00 00 00       	mov    $0x0,%eax
+  802855:	c9                   	leave
+  802856:	c3                   	ret
+
+00802857 <devcons_write>:
+{
+  802857:	55                   	push   %ebp
+  802858:	89 e5                	mov    %esp,%ebp
+  80285a:	57                   	push   %edi
+  80285b:	56                   	push   %esi
+  80285c:	53                   	push   %ebx
+  80285d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802863:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802866:	85 ff                	test   %edi,%edi
+  802868:	74 51                	je     8028bb <devcons_write+0x64>
+  80286a:	be 00 00 00 00       	mov    $0x0,%esi
+  80286f:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  802874:	89 fb                	mov    %edi,%ebx
+  802876:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  802878:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80287d:	39 d3                	cmp    %edx,%ebx
+  80287f:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802882:	83 ec 04             	sub    $0x4,%esp
+  802885:	53                   	push   %ebx
+  802886:	03 45 0c             	add    0xc(%ebp),%eax
+  802889:	50                   	push   %eax
+  80288a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802890:	50                   	push   %eax
+  802891:	e8 c1 0a 00 00       	call   803357 <memmove>
+		sys_cputs(buf, m);
+  802896:	83 c4 08             	add    $0x8,%esp
+  802899:	53                   	push   %ebx
+  80289a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028a0:	50                   	push   %eax
+  8028a1:	e8 38 d8 ff ff       	call   8000de <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028a6:	01 de                	add    %ebx,%esi
+  8028a8:	89 f0                	mov    %esi,%eax
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	39 fe                	cmp    %edi,%esi
+  8028af:	72 c3                	jb     802874 <devcons_write+0x1d>
+}
+  8028b1:	89 f0                	mov    %esi,%eax
+  8028b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b6:	5b                   	pop    %ebx
+  8028b7:	5e                   	pop    %esi
+  8028b8:	5f                   	pop    %edi
+  8028b9:	5d                   	pop    %ebp
+  8028ba:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028bb:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028c0:	eb ef                	jmp    8028b1 <devcons_write+0x5a>
+
+008028c2 <devcons_read>:
+{
+  8028c2:	55                   	push   %ebp
+  8028c3:	89 e5                	mov    %esp,%ebp
+  8028c5:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028c8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028cd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028d1:	74 36                	je     802909 <devcons_read+0x47>
+	c = cons_peek;
+  8028d3:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8028d8:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8028df:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	75 10                	jne    8028f6 <devcons_read+0x34>
+  8028e6:	e8 11 d8 ff ff       	call   8000fc <sys_cgetc>
+  8028eb:	85 c0                	test   %eax,%eax
+  8028ed:	75 07                	jne    8028f6 <devcons_read+0x34>
+		sys_yield();
+  8028ef:	e8 87 d8 ff ff       	call   80017b <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028f4:	eb f0                	jmp    8028e6 <devcons_read+0x24>
+	if (c < 0)
+  8028f6:	85 c0                	test   %eax,%eax
+  8028f8:	78 0f                	js     802909 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8028fa:	83 f8 04             	cmp    $0x4,%eax
+  8028fd:	74 0c                	je     80290b <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8028ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802902:	88 02                	mov    %al,(%edx)
+	return 1;
+  802904:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802909:	c9                   	leave
+  80290a:	c3                   	ret
+		return 0;
+  80290b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802910:	eb f7                	jmp    802909 <devcons_read+0x47>
+
+00802912 <cputchar>:
+{
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802918:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80291e:	6a 01                	push   $0x1
+  802920:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802923:	50                   	push   %eax
+  802924:	e8 b5 d7 ff ff       	call   8000de <sys_cputs>
+}
+  802929:	83 c4 10             	add    $0x10,%esp
+  80292c:	c9                   	leave
+  80292d:	c3                   	ret
+
+0080292e <getchar>:
+{
+  80292e:	55                   	push   %ebp
+  80292f:	89 e5                	mov    %esp,%ebp
+  802931:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802934:	6a 01                	push   $0x1
+  802936:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802939:	50                   	push   %eax
+  80293a:	6a 00                	push   $0x0
+  80293c:	e8 b7 df ff ff       	call   8008f8 <read>
+	if (r < 0)
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	85 c0                	test   %eax,%eax
+  802946:	78 06                	js     80294e <getchar+0x20>
+	if (r < 1)
+  802948:	74 06                	je     802950 <getchar+0x22>
+	return c;
+  80294a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80294e:	c9                   	leave
+  80294f:	c3                   	ret
+		return -E_EOF;
+  802950:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802955:	eb f7                	jmp    80294e <getchar+0x20>
+
+00802957 <iscons>:
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80295d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802960:	50                   	push   %eax
+  802961:	ff 75 08             	push   0x8(%ebp)
+  802964:	e8 0b dd ff ff       	call   800674 <fd_lookup>
+  802969:	83 c4 10             	add    $0x10,%esp
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	78 11                	js     802981 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802973:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802979:	39 10                	cmp    %edx,(%eax)
+  80297b:	0f 94 c0             	sete   %al
+  80297e:	0f b6 c0             	movzbl %al,%eax
+}
+  802981:	c9                   	leave
+  802982:	c3                   	ret
+
+00802983 <opencons>:
+{
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802989:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80298c:	50                   	push   %eax
+  80298d:	e8 92 dc ff ff       	call   800624 <fd_alloc>
+  802992:	83 c4 10             	add    $0x10,%esp
+  802995:	85 c0                	test   %eax,%eax
+  802997:	78 3a                	js     8029d3 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802999:	83 ec 04             	sub    $0x4,%esp
+  80299c:	68 07 04 00 00       	push   $0x407
+  8029a1:	ff 75 f4             	push   -0xc(%ebp)
+  8029a4:	6a 00                	push   $0x0
+  8029a6:	e8 ef d7 ff ff       	call   80019a <sys_page_alloc>
+  8029ab:	83 c4 10             	add    $0x10,%esp
+  8029ae:	85 c0                	test   %eax,%eax
+  8029b0:	78 21                	js     8029d3 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029b5:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029bb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029c7:	83 ec 0c             	sub    $0xc,%esp
+  8029ca:	50                   	push   %eax
+  8029cb:	e8 2d dc ff ff       	call   8005fd <fd2num>
+  8029d0:	83 c4 10             	add    $0x10,%esp
+}
+  8029d3:	c9                   	leave
+  8029d4:	c3                   	ret
+
+008029d5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029d5:	55                   	push   %ebp
+  8029d6:	89 e5                	mov    %esp,%ebp
+  8029d8:	56                   	push   %esi
+  8029d9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029da:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029dd:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8029e3:	e8 74 d7 ff ff       	call   80015c <sys_getenvid>
+  8029e8:	83 ec 0c             	sub    $0xc,%esp
+  8029eb:	ff 75 0c             	push   0xc(%ebp)
+  8029ee:	ff 75 08             	push   0x8(%ebp)
+  8029f1:	56                   	push   %esi
+  8029f2:	50                   	push   %eax
+  8029f3:	68 cc 3b 80 00       	push   $0x803bcc
+  8029f8:	e8 b3 00 00 00       	call   802ab0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8029fd:	83 c4 18             	add    $0x18,%esp
+  802a00:	53                   	push   %ebx
+  802a01:	ff 75 10             	push   0x10(%ebp)
+  802a04:	e8 56 00 00 00       	call   802a5f <vcprintf>
+	cprintf("\n");
+  802a09:	c7 04 24 b0 3b 80 00 	movl   $0x803bb0,(%esp)
+  802a10:	e8 9b 00 00 00       	call   802ab0 <cprintf>
+  802a15:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a18:	cc                   	int3
+	while (1)
+  802a19:	eb fd                	jmp    802a18 <_panic+0x43>
+
+00802a1b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a1b:	55                   	push   %ebp
+  802a1c:	89 e5                	mov    %esp,%ebp
+  802a1e:	53                   	push   %ebx
+  802a1f:	83 ec 04             	sub    $0x4,%esp
+  802a22:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a25:	8b 13                	mov    (%ebx),%edx
+  802a27:	8d 42 01             	lea    0x1(%edx),%eax
+  802a2a:	89 03                	mov    %eax,(%ebx)
+  802a2c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a2f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a33:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a38:	74 09                	je     802a43 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a3a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a41:	c9                   	leave
+  802a42:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a43:	83 ec 08             	sub    $0x8,%esp
+  802a46:	68 ff 00 00 00       	push   $0xff
+  802a4b:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a4e:	50                   	push   %eax
+  802a4f:	e8 8a d6 ff ff       	call   8000de <sys_cputs>
+		b->idx = 0;
+  802a54:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a5a:	83 c4 10             	add    $0x10,%esp
+  802a5d:	eb db                	jmp    802a3a <putch+0x1f>
+
+00802a5f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a68:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a6f:	00 00 00 
+	b.cnt = 0;
+  802a72:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802a79:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802a7c:	ff 75 0c             	push   0xc(%ebp)
+  802a7f:	ff 75 08             	push   0x8(%ebp)
+  802a82:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802a88:	50                   	push   %eax
+  802a89:	68 1b 2a 80 00       	push   $0x802a1b
+  802a8e:	e8 1c 01 00 00       	call   802baf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802a93:	83 c4 08             	add    $0x8,%esp
+  802a96:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802a9c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802aa2:	50                   	push   %eax
+  802aa3:	e8 36 d6 ff ff       	call   8000de <sys_cputs>
+
+	return b.cnt;
+}
+  802aa8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802aae:	c9                   	leave
+  802aaf:	c3                   	ret
+
+00802ab0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ab0:	55                   	push   %ebp
+  802ab1:	89 e5                	mov    %esp,%ebp
+  802ab3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802ab6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802ab9:	50                   	push   %eax
+  802aba:	ff 75 08             	push   0x8(%ebp)
+  802abd:	e8 9d ff ff ff       	call   802a5f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802ac2:	c9                   	leave
+  802ac3:	c3                   	ret
+
+00802ac4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802ac4:	55                   	push   %ebp
+  802ac5:	89 e5                	mov    %esp,%ebp
+  802ac7:	57                   	push   %edi
+  802ac8:	56                   	push   %esi
+  802ac9:	53                   	push   %ebx
+  802aca:	83 ec 1c             	sub    $0x1c,%esp
+  802acd:	89 c3                	mov    %eax,%ebx
+  802acf:	89 d6                	mov    %edx,%esi
+  802ad1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ad7:	89 d1                	mov    %edx,%ecx
+  802ad9:	89 c2                	mov    %eax,%edx
+  802adb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ade:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802ae1:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802ae4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802ae7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802aee:	39 c2                	cmp    %eax,%edx
+  802af0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802af3:	73 4b                	jae    802b40 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802af5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af8:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802afb:	85 ff                	test   %edi,%edi
+  802afd:	7e 11                	jle    802b10 <printnum+0x4c>
+			putch(padc, putdat);
+  802aff:	83 ec 08             	sub    $0x8,%esp
+  802b02:	56                   	push   %esi
+  802b03:	ff 75 18             	push   0x18(%ebp)
+  802b06:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b08:	83 c4 10             	add    $0x10,%esp
+  802b0b:	83 ef 01             	sub    $0x1,%edi
+  802b0e:	75 ef                	jne    802aff <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b10:	83 ec 08             	sub    $0x8,%esp
+  802b13:	56                   	push   %esi
+  802b14:	83 ec 04             	sub    $0x4,%esp
+  802b17:	ff 75 e4             	push   -0x1c(%ebp)
+  802b1a:	ff 75 e0             	push   -0x20(%ebp)
+  802b1d:	ff 75 dc             	push   -0x24(%ebp)
+  802b20:	ff 75 d8             	push   -0x28(%ebp)
+  802b23:	e8 33 0e 00 00       	call   80395b <__umoddi3>
+  802b28:	83 c4 14             	add    $0x14,%esp
+  802b2b:	0f be 80 ef 3b 80 00 	movsbl 0x803bef(%eax),%eax
+  802b32:	50                   	push   %eax
+  802b33:	ff d3                	call   *%ebx
+}
+  802b35:	83 c4 10             	add    $0x10,%esp
+  802b38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b3b:	5b                   	pop    %ebx
+  802b3c:	5e                   	pop    %esi
+  802b3d:	5f                   	pop    %edi
+  802b3e:	5d                   	pop    %ebp
+  802b3f:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b40:	83 ec 0c             	sub    $0xc,%esp
+  802b43:	ff 75 18             	push   0x18(%ebp)
+  802b46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b49:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b4c:	52                   	push   %edx
+  802b4d:	50                   	push   %eax
+  802b4e:	83 ec 08             	sub    $0x8,%esp
+  802b51:	ff 75 e4             	push   -0x1c(%ebp)
+  802b54:	ff 75 e0             	push   -0x20(%ebp)
+  802b57:	ff 75 dc             	push   -0x24(%ebp)
+  802b5a:	ff 75 d8             	push   -0x28(%ebp)
+  802b5d:	e8 33 0d 00 00       	call   803895 <__udivdi3>
+  802b62:	83 c4 18             	add    $0x18,%esp
+  802b65:	52                   	push   %edx
+  802b66:	50                   	push   %eax
+  802b67:	89 f2                	mov    %esi,%edx
+  802b69:	89 d8                	mov    %ebx,%eax
+  802b6b:	e8 54 ff ff ff       	call   802ac4 <printnum>
+  802b70:	83 c4 20             	add    $0x20,%esp
+  802b73:	eb 9b                	jmp    802b10 <printnum+0x4c>
+
+00802b75 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802b75:	55                   	push   %ebp
+  802b76:	89 e5                	mov    %esp,%ebp
+  802b78:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802b7b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802b7f:	8b 10                	mov    (%eax),%edx
+  802b81:	3b 50 04             	cmp    0x4(%eax),%edx
+  802b84:	73 0a                	jae    802b90 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802b86:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802b89:	89 08                	mov    %ecx,(%eax)
+  802b8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8e:	88 02                	mov    %al,(%edx)
+}
+  802b90:	5d                   	pop    %ebp
+  802b91:	c3                   	ret
+
+00802b92 <printfmt>:
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802b98:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802b9b:	50                   	push   %eax
+  802b9c:	ff 75 10             	push   0x10(%ebp)
+  802b9f:	ff 75 0c             	push   0xc(%ebp)
+  802ba2:	ff 75 08             	push   0x8(%ebp)
+  802ba5:	e8 05 00 00 00       	call   802baf <vprintfmt>
+}
+  802baa:	83 c4 10             	add    $0x10,%esp
+  802bad:	c9                   	leave
+  802bae:	c3                   	ret
+
+00802baf <vprintfmt>:
+{
+  802baf:	55                   	push   %ebp
+  802bb0:	89 e5                	mov    %esp,%ebp
+  802bb2:	57                   	push   %edi
+  802bb3:	56                   	push   %esi
+  802bb4:	53                   	push   %ebx
+  802bb5:	83 ec 2c             	sub    $0x2c,%esp
+  802bb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bbb:	89 df                	mov    %ebx,%edi
+  802bbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bc0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bc3:	8d 70 01             	lea    0x1(%eax),%esi
+  802bc6:	0f b6 00             	movzbl (%eax),%eax
+  802bc9:	83 f8 25             	cmp    $0x25,%eax
+  802bcc:	74 1e                	je     802bec <vprintfmt+0x3d>
+			if (ch == '\0')
+  802bce:	85 c0                	test   %eax,%eax
+  802bd0:	0f 84 15 05 00 00    	je     8030eb <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802bd6:	83 ec 08             	sub    $0x8,%esp
+  802bd9:	53                   	push   %ebx
+  802bda:	50                   	push   %eax
+  802bdb:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bdd:	83 c6 01             	add    $0x1,%esi
+  802be0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802be4:	83 c4 10             	add    $0x10,%esp
+  802be7:	83 f8 25             	cmp    $0x25,%eax
+  802bea:	75 e2                	jne    802bce <vprintfmt+0x1f>
+		padc = ' ';
+  802bec:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802bf0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802bf7:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802bfe:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c0a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c0d:	8d 56 01             	lea    0x1(%esi),%edx
+  802c10:	0f b6 0e             	movzbl (%esi),%ecx
+  802c13:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c16:	3c 55                	cmp    $0x55,%al
+  802c18:	0f 87 3b 04 00 00    	ja     803059 <vprintfmt+0x4aa>
+  802c1e:	0f b6 c0             	movzbl %al,%eax
+  802c21:	ff 24 85 60 3d 80 00 	jmp    *0x803d60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c28:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c2b:	eb 93                	jmp    802bc0 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c2d:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c2f:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c33:	eb d8                	jmp    802c0d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c35:	89 d6                	mov    %edx,%esi
+  802c37:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c3b:	eb d0                	jmp    802c0d <vprintfmt+0x5e>
+  802c3d:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c40:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c43:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c46:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c4a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c4d:	83 f9 09             	cmp    $0x9,%ecx
+  802c50:	77 6f                	ja     802cc1 <vprintfmt+0x112>
+  802c52:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c55:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c58:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c5b:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c5f:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c62:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c65:	83 fe 09             	cmp    $0x9,%esi
+  802c68:	76 eb                	jbe    802c55 <vprintfmt+0xa6>
+  802c6a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c6d:	89 d6                	mov    %edx,%esi
+  802c6f:	eb 13                	jmp    802c84 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802c71:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c74:	8b 00                	mov    (%eax),%eax
+  802c76:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c79:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c7c:	8d 40 04             	lea    0x4(%eax),%eax
+  802c7f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c82:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802c84:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802c88:	79 83                	jns    802c0d <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802c8a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c8d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c90:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802c97:	e9 71 ff ff ff       	jmp    802c0d <vprintfmt+0x5e>
+			if (width < 0)
+  802c9c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802c9f:	85 c9                	test   %ecx,%ecx
+  802ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca6:	0f 49 c1             	cmovns %ecx,%eax
+  802ca9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cac:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cae:	e9 5a ff ff ff       	jmp    802c0d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cb3:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cb5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cbc:	e9 4c ff ff ff       	jmp    802c0d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc1:	89 d6                	mov    %edx,%esi
+  802cc3:	eb bf                	jmp    802c84 <vprintfmt+0xd5>
+			lflag++;
+  802cc5:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc9:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802ccb:	e9 3d ff ff ff       	jmp    802c0d <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802cd0:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cd3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cd6:	8d 70 04             	lea    0x4(%eax),%esi
+  802cd9:	83 ec 08             	sub    $0x8,%esp
+  802cdc:	53                   	push   %ebx
+  802cdd:	ff 30                	push   (%eax)
+  802cdf:	ff d7                	call   *%edi
+			break;
+  802ce1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802ce4:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802ce7:	e9 d4 fe ff ff       	jmp    802bc0 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802cec:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cef:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cf2:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802cf5:	8b 10                	mov    (%eax),%edx
+  802cf7:	89 d0                	mov    %edx,%eax
+  802cf9:	f7 d8                	neg    %eax
+  802cfb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802cfe:	83 f8 12             	cmp    $0x12,%eax
+  802d01:	7f 23                	jg     802d26 <vprintfmt+0x177>
+  802d03:	8b 14 85 c0 3e 80 00 	mov    0x803ec0(,%eax,4),%edx
+  802d0a:	85 d2                	test   %edx,%edx
+  802d0c:	74 18                	je     802d26 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d0e:	52                   	push   %edx
+  802d0f:	68 7b 3b 80 00       	push   $0x803b7b
+  802d14:	53                   	push   %ebx
+  802d15:	57                   	push   %edi
+  802d16:	e8 77 fe ff ff       	call   802b92 <printfmt>
+  802d1b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d1e:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d21:	e9 9a fe ff ff       	jmp    802bc0 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d26:	50                   	push   %eax
+  802d27:	68 07 3c 80 00       	push   $0x803c07
+  802d2c:	53                   	push   %ebx
+  802d2d:	57                   	push   %edi
+  802d2e:	e8 5f fe ff ff       	call   802b92 <printfmt>
+  802d33:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d36:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d39:	e9 82 fe ff ff       	jmp    802bc0 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d3e:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d41:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d44:	83 c0 04             	add    $0x4,%eax
+  802d47:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d4d:	8b 00                	mov    (%eax),%eax
+  802d4f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d52:	85 c0                	test   %eax,%eax
+  802d54:	0f 84 61 03 00 00    	je     8030bb <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d5a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d5e:	7e 06                	jle    802d66 <vprintfmt+0x1b7>
+  802d60:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d64:	75 29                	jne    802d8f <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d66:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d69:	8d 70 01             	lea    0x1(%eax),%esi
+  802d6c:	0f b6 00             	movzbl (%eax),%eax
+  802d6f:	0f be d0             	movsbl %al,%edx
+  802d72:	85 d2                	test   %edx,%edx
+  802d74:	0f 84 bb 00 00 00    	je     802e35 <vprintfmt+0x286>
+  802d7a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802d7d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802d80:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802d83:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d86:	eb 7a                	jmp    802e02 <vprintfmt+0x253>
+				p = "(null)";
+  802d88:	c7 45 d0 00 3c 80 00 	movl   $0x803c00,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802d8f:	83 ec 08             	sub    $0x8,%esp
+  802d92:	ff 75 d4             	push   -0x2c(%ebp)
+  802d95:	ff 75 d0             	push   -0x30(%ebp)
+  802d98:	e8 e0 03 00 00       	call   80317d <strnlen>
+  802d9d:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802da0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802da3:	83 c4 10             	add    $0x10,%esp
+  802da6:	85 d2                	test   %edx,%edx
+  802da8:	0f 8e d6 02 00 00    	jle    803084 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802dae:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802db2:	83 ec 08             	sub    $0x8,%esp
+  802db5:	53                   	push   %ebx
+  802db6:	56                   	push   %esi
+  802db7:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802db9:	83 c4 10             	add    $0x10,%esp
+  802dbc:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802dc0:	75 f0                	jne    802db2 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dc2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dc5:	8d 70 01             	lea    0x1(%eax),%esi
+  802dc8:	0f b6 00             	movzbl (%eax),%eax
+  802dcb:	0f be d0             	movsbl %al,%edx
+  802dce:	85 d2                	test   %edx,%edx
+  802dd0:	0f 84 da 02 00 00    	je     8030b0 <vprintfmt+0x501>
+  802dd6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802dd9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802ddc:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802ddf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802de2:	eb 1e                	jmp    802e02 <vprintfmt+0x253>
+					putch(ch, putdat);
+  802de4:	83 ec 08             	sub    $0x8,%esp
+  802de7:	ff 75 0c             	push   0xc(%ebp)
+  802dea:	52                   	push   %edx
+  802deb:	ff 55 08             	call   *0x8(%ebp)
+  802dee:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802df1:	83 eb 01             	sub    $0x1,%ebx
+  802df4:	83 c6 01             	add    $0x1,%esi
+  802df7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802dfb:	0f be d0             	movsbl %al,%edx
+  802dfe:	85 d2                	test   %edx,%edx
+  802e00:	74 2a                	je     802e2c <vprintfmt+0x27d>
+  802e02:	85 ff                	test   %edi,%edi
+  802e04:	78 05                	js     802e0b <vprintfmt+0x25c>
+  802e06:	83 ef 01             	sub    $0x1,%edi
+  802e09:	78 59                	js     802e64 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e0b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e0f:	74 d3                	je     802de4 <vprintfmt+0x235>
+  802e11:	0f be c0             	movsbl %al,%eax
+  802e14:	83 e8 20             	sub    $0x20,%eax
+  802e17:	83 f8 5e             	cmp    $0x5e,%eax
+  802e1a:	76 c8                	jbe    802de4 <vprintfmt+0x235>
+					putch('?', putdat);
+  802e1c:	83 ec 08             	sub    $0x8,%esp
+  802e1f:	ff 75 0c             	push   0xc(%ebp)
+  802e22:	6a 3f                	push   $0x3f
+  802e24:	ff 55 08             	call   *0x8(%ebp)
+  802e27:	83 c4 10             	add    $0x10,%esp
+  802e2a:	eb c5                	jmp    802df1 <vprintfmt+0x242>
+  802e2c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e35:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e38:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e3c:	7e 1b                	jle    802e59 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e3e:	83 ec 08             	sub    $0x8,%esp
+  802e41:	53                   	push   %ebx
+  802e42:	6a 20                	push   $0x20
+  802e44:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e46:	83 c4 10             	add    $0x10,%esp
+  802e49:	83 ee 01             	sub    $0x1,%esi
+  802e4c:	75 f0                	jne    802e3e <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e4e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e51:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e54:	e9 67 fd ff ff       	jmp    802bc0 <vprintfmt+0x11>
+  802e59:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e5c:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e5f:	e9 5c fd ff ff       	jmp    802bc0 <vprintfmt+0x11>
+  802e64:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e67:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e6a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e6d:	eb c6                	jmp    802e35 <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e6f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802e72:	89 55 10             	mov    %edx,0x10(%ebp)
+  802e75:	83 f9 01             	cmp    $0x1,%ecx
+  802e78:	7f 1f                	jg     802e99 <vprintfmt+0x2ea>
+	else if (lflag)
+  802e7a:	85 c9                	test   %ecx,%ecx
+  802e7c:	74 67                	je     802ee5 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802e7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e81:	8b 30                	mov    (%eax),%esi
+  802e83:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802e86:	89 f0                	mov    %esi,%eax
+  802e88:	c1 f8 1f             	sar    $0x1f,%eax
+  802e8b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802e8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e91:	8d 40 04             	lea    0x4(%eax),%eax
+  802e94:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e97:	eb 17                	jmp    802eb0 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802e99:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9c:	8b 50 04             	mov    0x4(%eax),%edx
+  802e9f:	8b 00                	mov    (%eax),%eax
+  802ea1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ea4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802ea7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eaa:	8d 40 08             	lea    0x8(%eax),%eax
+  802ead:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802eb0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802eb3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802eb6:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802ebb:	85 c9                	test   %ecx,%ecx
+  802ebd:	0f 89 12 01 00 00    	jns    802fd5 <vprintfmt+0x426>
+				putch('-', putdat);
+  802ec3:	83 ec 08             	sub    $0x8,%esp
+  802ec6:	53                   	push   %ebx
+  802ec7:	6a 2d                	push   $0x2d
+  802ec9:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802ecb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ece:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ed1:	f7 da                	neg    %edx
+  802ed3:	83 d1 00             	adc    $0x0,%ecx
+  802ed6:	f7 d9                	neg    %ecx
+  802ed8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802edb:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ee0:	e9 f0 00 00 00       	jmp    802fd5 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802ee5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ee8:	8b 30                	mov    (%eax),%esi
+  802eea:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802eed:	89 f0                	mov    %esi,%eax
+  802eef:	c1 f8 1f             	sar    $0x1f,%eax
+  802ef2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802ef5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ef8:	8d 40 04             	lea    0x4(%eax),%eax
+  802efb:	89 45 14             	mov    %eax,0x14(%ebp)
+  802efe:	eb b0                	jmp    802eb0 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f00:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f03:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f06:	83 f9 01             	cmp    $0x1,%ecx
+  802f09:	7f 1e                	jg     802f29 <vprintfmt+0x37a>
+	else if (lflag)
+  802f0b:	85 c9                	test   %ecx,%ecx
+  802f0d:	74 32                	je     802f41 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f12:	8b 10                	mov    (%eax),%edx
+  802f14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f19:	8d 40 04             	lea    0x4(%eax),%eax
+  802f1c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f1f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f24:	e9 ac 00 00 00       	jmp    802fd5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f29:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2c:	8b 10                	mov    (%eax),%edx
+  802f2e:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f31:	8d 40 08             	lea    0x8(%eax),%eax
+  802f34:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f37:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f3c:	e9 94 00 00 00       	jmp    802fd5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f41:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f44:	8b 10                	mov    (%eax),%edx
+  802f46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f4b:	8d 40 04             	lea    0x4(%eax),%eax
+  802f4e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f51:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f56:	eb 7d                	jmp    802fd5 <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f58:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f5b:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f5e:	83 f9 01             	cmp    $0x1,%ecx
+  802f61:	7f 1b                	jg     802f7e <vprintfmt+0x3cf>
+	else if (lflag)
+  802f63:	85 c9                	test   %ecx,%ecx
+  802f65:	74 2c                	je     802f93 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f67:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f6a:	8b 10                	mov    (%eax),%edx
+  802f6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f71:	8d 40 04             	lea    0x4(%eax),%eax
+  802f74:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f77:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802f7c:	eb 57                	jmp    802fd5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f81:	8b 10                	mov    (%eax),%edx
+  802f83:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f86:	8d 40 08             	lea    0x8(%eax),%eax
+  802f89:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f8c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802f91:	eb 42                	jmp    802fd5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f96:	8b 10                	mov    (%eax),%edx
+  802f98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f9d:	8d 40 04             	lea    0x4(%eax),%eax
+  802fa0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fa3:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fa8:	eb 2b                	jmp    802fd5 <vprintfmt+0x426>
+			putch('0', putdat);
+  802faa:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fad:	83 ec 08             	sub    $0x8,%esp
+  802fb0:	53                   	push   %ebx
+  802fb1:	6a 30                	push   $0x30
+  802fb3:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fb5:	83 c4 08             	add    $0x8,%esp
+  802fb8:	53                   	push   %ebx
+  802fb9:	6a 78                	push   $0x78
+  802fbb:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fbd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc0:	8b 10                	mov    (%eax),%edx
+  802fc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802fc7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802fca:	8d 40 04             	lea    0x4(%eax),%eax
+  802fcd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802fd0:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  802fd5:	83 ec 0c             	sub    $0xc,%esp
+  802fd8:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802fdc:	50                   	push   %eax
+  802fdd:	ff 75 e4             	push   -0x1c(%ebp)
+  802fe0:	56                   	push   %esi
+  802fe1:	51                   	push   %ecx
+  802fe2:	52                   	push   %edx
+  802fe3:	89 da                	mov    %ebx,%edx
+  802fe5:	89 f8                	mov    %edi,%eax
+  802fe7:	e8 d8 fa ff ff       	call   802ac4 <printnum>
+			break;
+  802fec:	83 c4 20             	add    $0x20,%esp
+  802fef:	e9 cc fb ff ff       	jmp    802bc0 <vprintfmt+0x11>
+	if (lflag >= 2)
+  802ff4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802ff7:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ffa:	83 f9 01             	cmp    $0x1,%ecx
+  802ffd:	7f 1b                	jg     80301a <vprintfmt+0x46b>
+	else if (lflag)
+  802fff:	85 c9                	test   %ecx,%ecx
+  803001:	74 2c                	je     80302f <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803003:	8b 45 14             	mov    0x14(%ebp),%eax
+  803006:	8b 10                	mov    (%eax),%edx
+  803008:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80300d:	8d 40 04             	lea    0x4(%eax),%eax
+  803010:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803013:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  803018:	eb bb                	jmp    802fd5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80301a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80301d:	8b 10                	mov    (%eax),%edx
+  80301f:	8b 48 04             	mov    0x4(%eax),%ecx
+  803022:	8d 40 08             	lea    0x8(%eax),%eax
+  803025:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803028:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80302d:	eb a6                	jmp    802fd5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80302f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803032:	8b 10                	mov    (%eax),%edx
+  803034:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803039:	8d 40 04             	lea    0x4(%eax),%eax
+  80303c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80303f:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  803044:	eb 8f                	jmp    802fd5 <vprintfmt+0x426>
+			putch(ch, putdat);
+  803046:	89 55 10             	mov    %edx,0x10(%ebp)
+  803049:	83 ec 08             	sub    $0x8,%esp
+  80304c:	53                   	push   %ebx
+  80304d:	6a 25                	push   $0x25
+  80304f:	ff d7                	call   *%edi
+			break;
+  803051:	83 c4 10             	add    $0x10,%esp
+  803054:	e9 67 fb ff ff       	jmp    802bc0 <vprintfmt+0x11>
+			putch('%', putdat);
+  803059:	83 ec 08             	sub    $0x8,%esp
+  80305c:	53                   	push   %ebx
+  80305d:	6a 25                	push   $0x25
+  80305f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803061:	83 c4 10             	add    $0x10,%esp
+  803064:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  803068:	0f 84 ba fb ff ff    	je     802c28 <vprintfmt+0x79>
+  80306e:	89 75 10             	mov    %esi,0x10(%ebp)
+  803071:	89 f0                	mov    %esi,%eax
+  803073:	83 e8 01             	sub    $0x1,%eax
+  803076:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80307a:	75 f7                	jne    803073 <vprintfmt+0x4c4>
+  80307c:	89 45 10             	mov    %eax,0x10(%ebp)
+  80307f:	e9 3c fb ff ff       	jmp    802bc0 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803084:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803087:	8d 70 01             	lea    0x1(%eax),%esi
+  80308a:	0f b6 00             	movzbl (%eax),%eax
+  80308d:	0f be d0             	movsbl %al,%edx
+  803090:	85 d2                	test   %edx,%edx
+  803092:	74 11                	je     8030a5 <vprintfmt+0x4f6>
+  803094:	89 7d 08             	mov    %edi,0x8(%ebp)
+  803097:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80309a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80309d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030a0:	e9 5d fd ff ff       	jmp    802e02 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030a5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030ab:	e9 10 fb ff ff       	jmp    802bc0 <vprintfmt+0x11>
+  8030b0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030b6:	e9 05 fb ff ff       	jmp    802bc0 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030bb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030bf:	7e 0a                	jle    8030cb <vprintfmt+0x51c>
+  8030c1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030c5:	0f 85 bd fc ff ff    	jne    802d88 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030cb:	ba 28 00 00 00       	mov    $0x28,%edx
+  8030d0:	b8 28 00 00 00       	mov    $0x28,%eax
+  8030d5:	be 01 3c 80 00       	mov    $0x803c01,%esi
+  8030da:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030dd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030e0:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030e3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030e6:	e9 17 fd ff ff       	jmp    802e02 <vprintfmt+0x253>
+}
+  8030eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030ee:	5b                   	pop    %ebx
+  8030ef:	5e                   	pop    %esi
+  8030f0:	5f                   	pop    %edi
+  8030f1:	5d                   	pop    %ebp
+  8030f2:	c3                   	ret
+
+008030f3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8030f3:	55                   	push   %ebp
+  8030f4:	89 e5                	mov    %esp,%ebp
+  8030f6:	83 ec 18             	sub    $0x18,%esp
+  8030f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8030ff:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803102:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803106:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803109:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803110:	85 c0                	test   %eax,%eax
+  803112:	74 26                	je     80313a <vsnprintf+0x47>
+  803114:	85 d2                	test   %edx,%edx
+  803116:	7e 22                	jle    80313a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803118:	ff 75 14             	push   0x14(%ebp)
+  80311b:	ff 75 10             	push   0x10(%ebp)
+  80311e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803121:	50                   	push   %eax
+  803122:	68 75 2b 80 00       	push   $0x802b75
+  803127:	e8 83 fa ff ff       	call   802baf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80312c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80312f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803135:	83 c4 10             	add    $0x10,%esp
+}
+  803138:	c9                   	leave
+  803139:	c3                   	ret
+		return -E_INVAL;
+  80313a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80313f:	eb f7                	jmp    803138 <vsnprintf+0x45>
+
+00803141 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803141:	55                   	push   %ebp
+  803142:	89 e5                	mov    %esp,%ebp
+  803144:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803147:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80314a:	50                   	push   %eax
+  80314b:	ff 75 10             	push   0x10(%ebp)
+  80314e:	ff 75 0c             	push   0xc(%ebp)
+  803151:	ff 75 08             	push   0x8(%ebp)
+  803154:	e8 9a ff ff ff       	call   8030f3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803159:	c9                   	leave
+  80315a:	c3                   	ret
+
+0080315b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80315b:	55                   	push   %ebp
+  80315c:	89 e5                	mov    %esp,%ebp
+  80315e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803161:	80 3a 00             	cmpb   $0x0,(%edx)
+  803164:	74 10                	je     803176 <strlen+0x1b>
+  803166:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80316b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80316e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  803172:	75 f7                	jne    80316b <strlen+0x10>
+	return n;
+}
+  803174:	5d                   	pop    %ebp
+  803175:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  803176:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80317b:	eb f7                	jmp    803174 <strlen+0x19>
+
+0080317d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80317d:	55                   	push   %ebp
+  80317e:	89 e5                	mov    %esp,%ebp
+  803180:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803183:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803186:	85 d2                	test   %edx,%edx
+  803188:	74 16                	je     8031a0 <strnlen+0x23>
+  80318a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80318f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  803193:	74 09                	je     80319e <strnlen+0x21>
+		n++;
+  803195:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803198:	39 d0                	cmp    %edx,%eax
+  80319a:	75 f3                	jne    80318f <strnlen+0x12>
+		n++;
+  80319c:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80319e:	5d                   	pop    %ebp
+  80319f:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a5:	eb f7                	jmp    80319e <strnlen+0x21>
+
+008031a7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031a7:	55                   	push   %ebp
+  8031a8:	89 e5                	mov    %esp,%ebp
+  8031aa:	53                   	push   %ebx
+  8031ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031ba:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031bd:	83 c0 01             	add    $0x1,%eax
+  8031c0:	84 d2                	test   %dl,%dl
+  8031c2:	75 f2                	jne    8031b6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031c4:	89 c8                	mov    %ecx,%eax
+  8031c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031c9:	c9                   	leave
+  8031ca:	c3                   	ret
+
+008031cb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031cb:	55                   	push   %ebp
+  8031cc:	89 e5                	mov    %esp,%ebp
+  8031ce:	53                   	push   %ebx
+  8031cf:	83 ec 10             	sub    $0x10,%esp
+  8031d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8031d5:	53                   	push   %ebx
+  8031d6:	e8 80 ff ff ff       	call   80315b <strlen>
+  8031db:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8031de:	ff 75 0c             	push   0xc(%ebp)
+  8031e1:	01 d8                	add    %ebx,%eax
+  8031e3:	50                   	push   %eax
+  8031e4:	e8 be ff ff ff       	call   8031a7 <strcpy>
+	return dst;
+}
+  8031e9:	89 d8                	mov    %ebx,%eax
+  8031eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ee:	c9                   	leave
+  8031ef:	c3                   	ret
+
+008031f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8031f0:	55                   	push   %ebp
+  8031f1:	89 e5                	mov    %esp,%ebp
+  8031f3:	56                   	push   %esi
+  8031f4:	53                   	push   %ebx
+  8031f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8031fe:	85 db                	test   %ebx,%ebx
+  803200:	74 17                	je     803219 <strncpy+0x29>
+  803202:	01 f3                	add    %esi,%ebx
+  803204:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  803206:	83 c0 01             	add    $0x1,%eax
+  803209:	0f b6 0a             	movzbl (%edx),%ecx
+  80320c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80320f:	80 f9 01             	cmp    $0x1,%cl
+  803212:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  803215:	39 c3                	cmp    %eax,%ebx
+  803217:	75 ed                	jne    803206 <strncpy+0x16>
+	}
+	return ret;
+}
+  803219:	89 f0                	mov    %esi,%eax
+  80321b:	5b                   	pop    %ebx
+  80321c:	5e                   	pop    %esi
+  80321d:	5d                   	pop    %ebp
+  80321e:	c3                   	ret
+
+0080321f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80321f:	55                   	push   %ebp
+  803220:	89 e5                	mov    %esp,%ebp
+  803222:	56                   	push   %esi
+  803223:	53                   	push   %ebx
+  803224:	8b 75 08             	mov    0x8(%ebp),%esi
+  803227:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80322a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80322d:	89 f0                	mov    %esi,%eax
+  80322f:	85 db                	test   %ebx,%ebx
+  803231:	74 1e                	je     803251 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  803233:	83 eb 01             	sub    $0x1,%ebx
+  803236:	74 16                	je     80324e <strlcpy+0x2f>
+  803238:	01 f3                	add    %esi,%ebx
+  80323a:	0f b6 0a             	movzbl (%edx),%ecx
+  80323d:	84 c9                	test   %cl,%cl
+  80323f:	74 0d                	je     80324e <strlcpy+0x2f>
+			*dst++ = *src++;
+  803241:	83 c2 01             	add    $0x1,%edx
+  803244:	83 c0 01             	add    $0x1,%eax
+  803247:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80324a:	39 d8                	cmp    %ebx,%eax
+  80324c:	75 ec                	jne    80323a <strlcpy+0x1b>
+		*dst = '\0';
+  80324e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803251:	29 f0                	sub    %esi,%eax
+}
+  803253:	5b                   	pop    %ebx
+  803254:	5e                   	pop    %esi
+  803255:	5d                   	pop    %ebp
+  803256:	c3                   	ret
+
+00803257 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80325d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803260:	0f b6 01             	movzbl (%ecx),%eax
+  803263:	84 c0                	test   %al,%al
+  803265:	74 11                	je     803278 <strcmp+0x21>
+  803267:	38 02                	cmp    %al,(%edx)
+  803269:	75 0d                	jne    803278 <strcmp+0x21>
+		p++, q++;
+  80326b:	83 c1 01             	add    $0x1,%ecx
+  80326e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803271:	0f b6 01             	movzbl (%ecx),%eax
+  803274:	84 c0                	test   %al,%al
+  803276:	75 ef                	jne    803267 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803278:	0f b6 c0             	movzbl %al,%eax
+  80327b:	0f b6 12             	movzbl (%edx),%edx
+  80327e:	29 d0                	sub    %edx,%eax
+}
+  803280:	5d                   	pop    %ebp
+  803281:	c3                   	ret
+
+00803282 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803282:	55                   	push   %ebp
+  803283:	89 e5                	mov    %esp,%ebp
+  803285:	53                   	push   %ebx
+  803286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80328c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  80328f:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  803294:	85 d2                	test   %edx,%edx
+  803296:	74 2e                	je     8032c6 <strncmp+0x44>
+  803298:	0f b6 01             	movzbl (%ecx),%eax
+  80329b:	84 c0                	test   %al,%al
+  80329d:	74 16                	je     8032b5 <strncmp+0x33>
+  80329f:	3a 03                	cmp    (%ebx),%al
+  8032a1:	75 12                	jne    8032b5 <strncmp+0x33>
+		n--, p++, q++;
+  8032a3:	83 c1 01             	add    $0x1,%ecx
+  8032a6:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032a9:	83 ea 01             	sub    $0x1,%edx
+  8032ac:	75 ea                	jne    803298 <strncmp+0x16>
+		return 0;
+  8032ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b3:	eb 11                	jmp    8032c6 <strncmp+0x44>
+  8032b5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032ba:	85 d2                	test   %edx,%edx
+  8032bc:	74 08                	je     8032c6 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032be:	0f b6 01             	movzbl (%ecx),%eax
+  8032c1:	0f b6 13             	movzbl (%ebx),%edx
+  8032c4:	29 d0                	sub    %edx,%eax
+}
+  8032c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032c9:	c9                   	leave
+  8032ca:	c3                   	ret
+
+008032cb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032cb:	55                   	push   %ebp
+  8032cc:	89 e5                	mov    %esp,%ebp
+  8032ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8032d5:	0f b6 10             	movzbl (%eax),%edx
+  8032d8:	84 d2                	test   %dl,%dl
+  8032da:	74 15                	je     8032f1 <strchr+0x26>
+		if (*s == c)
+  8032dc:	38 d1                	cmp    %dl,%cl
+  8032de:	74 0f                	je     8032ef <strchr+0x24>
+	for (; *s; s++)
+  8032e0:	83 c0 01             	add    $0x1,%eax
+  8032e3:	0f b6 10             	movzbl (%eax),%edx
+  8032e6:	84 d2                	test   %dl,%dl
+  8032e8:	75 f2                	jne    8032dc <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8032ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ef:	5d                   	pop    %ebp
+  8032f0:	c3                   	ret
+	return 0;
+  8032f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f6:	eb f7                	jmp    8032ef <strchr+0x24>
+
+008032f8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8032f8:	55                   	push   %ebp
+  8032f9:	89 e5                	mov    %esp,%ebp
+  8032fb:	53                   	push   %ebx
+  8032fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  803302:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  803305:	38 d3                	cmp    %dl,%bl
+  803307:	74 14                	je     80331d <strfind+0x25>
+  803309:	89 d1                	mov    %edx,%ecx
+  80330b:	84 db                	test   %bl,%bl
+  80330d:	74 0e                	je     80331d <strfind+0x25>
+	for (; *s; s++)
+  80330f:	83 c0 01             	add    $0x1,%eax
+  803312:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  803315:	38 ca                	cmp    %cl,%dl
+  803317:	74 04                	je     80331d <strfind+0x25>
+  803319:	84 d2                	test   %dl,%dl
+  80331b:	75 f2                	jne    80330f <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  80331d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803320:	c9                   	leave
+  803321:	c3                   	ret
+
+00803322 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803322:	55                   	push   %ebp
+  803323:	89 e5                	mov    %esp,%ebp
+  803325:	57                   	push   %edi
+  803326:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803329:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80332c:	85 c9                	test   %ecx,%ecx
+  80332e:	74 20                	je     803350 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803330:	89 f8                	mov    %edi,%eax
+  803332:	09 c8                	or     %ecx,%eax
+  803334:	a8 03                	test   $0x3,%al
+  803336:	75 12                	jne    80334a <memset+0x28>
+		c &= 0xFF;
+  803338:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80333c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803342:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  803345:	fc                   	cld
+  803346:	f3 ab                	rep stos %eax,%es:(%edi)
+  803348:	eb 06                	jmp    803350 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80334a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80334d:	fc                   	cld
+  80334e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803350:	89 f8                	mov    %edi,%eax
+  803352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803355:	c9                   	leave
+  803356:	c3                   	ret
+
+00803357 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803357:	55                   	push   %ebp
+  803358:	89 e5                	mov    %esp,%ebp
+  80335a:	57                   	push   %edi
+  80335b:	56                   	push   %esi
+  80335c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80335f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803362:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803365:	39 c6                	cmp    %eax,%esi
+  803367:	73 32                	jae    80339b <memmove+0x44>
+  803369:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80336c:	39 d0                	cmp    %edx,%eax
+  80336e:	73 2b                	jae    80339b <memmove+0x44>
+		s += n;
+		d += n;
+  803370:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803373:	89 d6                	mov    %edx,%esi
+  803375:	09 fe                	or     %edi,%esi
+  803377:	09 ce                	or     %ecx,%esi
+  803379:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80337f:	75 0e                	jne    80338f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803381:	83 ef 04             	sub    $0x4,%edi
+  803384:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803387:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80338a:	fd                   	std
+  80338b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80338d:	eb 09                	jmp    803398 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80338f:	83 ef 01             	sub    $0x1,%edi
+  803392:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803395:	fd                   	std
+  803396:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803398:	fc                   	cld
+  803399:	eb 1a                	jmp    8033b5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80339b:	89 f2                	mov    %esi,%edx
+  80339d:	09 c2                	or     %eax,%edx
+  80339f:	09 ca                	or     %ecx,%edx
+  8033a1:	f6 c2 03             	test   $0x3,%dl
+  8033a4:	75 0a                	jne    8033b0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033a6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033a9:	89 c7                	mov    %eax,%edi
+  8033ab:	fc                   	cld
+  8033ac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033ae:	eb 05                	jmp    8033b5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033b0:	89 c7                	mov    %eax,%edi
+  8033b2:	fc                   	cld
+  8033b3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033b5:	5e                   	pop    %esi
+  8033b6:	5f                   	pop    %edi
+  8033b7:	5d                   	pop    %ebp
+  8033b8:	c3                   	ret
+
+008033b9 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033bf:	ff 75 10             	push   0x10(%ebp)
+  8033c2:	ff 75 0c             	push   0xc(%ebp)
+  8033c5:	ff 75 08             	push   0x8(%ebp)
+  8033c8:	e8 8a ff ff ff       	call   803357 <memmove>
+}
+  8033cd:	c9                   	leave
+  8033ce:	c3                   	ret
+
+008033cf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033cf:	55                   	push   %ebp
+  8033d0:	89 e5                	mov    %esp,%ebp
+  8033d2:	56                   	push   %esi
+  8033d3:	53                   	push   %ebx
+  8033d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033da:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8033dd:	85 f6                	test   %esi,%esi
+  8033df:	74 29                	je     80340a <memcmp+0x3b>
+  8033e1:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8033e3:	0f b6 08             	movzbl (%eax),%ecx
+  8033e6:	0f b6 1a             	movzbl (%edx),%ebx
+  8033e9:	38 d9                	cmp    %bl,%cl
+  8033eb:	75 11                	jne    8033fe <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8033ed:	83 c0 01             	add    $0x1,%eax
+  8033f0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8033f3:	39 c6                	cmp    %eax,%esi
+  8033f5:	75 ec                	jne    8033e3 <memcmp+0x14>
+	}
+
+	return 0;
+  8033f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fc:	eb 08                	jmp    803406 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  8033fe:	0f b6 c1             	movzbl %cl,%eax
+  803401:	0f b6 db             	movzbl %bl,%ebx
+  803404:	29 d8                	sub    %ebx,%eax
+}
+  803406:	5b                   	pop    %ebx
+  803407:	5e                   	pop    %esi
+  803408:	5d                   	pop    %ebp
+  803409:	c3                   	ret
+	return 0;
+  80340a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340f:	eb f5                	jmp    803406 <memcmp+0x37>
+
+00803411 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803411:	55                   	push   %ebp
+  803412:	89 e5                	mov    %esp,%ebp
+  803414:	8b 45 08             	mov    0x8(%ebp),%eax
+  803417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80341a:	89 c2                	mov    %eax,%edx
+  80341c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80341f:	39 d0                	cmp    %edx,%eax
+  803421:	73 0d                	jae    803430 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803423:	38 08                	cmp    %cl,(%eax)
+  803425:	74 0d                	je     803434 <memfind+0x23>
+	for (; s < ends; s++)
+  803427:	83 c0 01             	add    $0x1,%eax
+  80342a:	39 c2                	cmp    %eax,%edx
+  80342c:	75 f5                	jne    803423 <memfind+0x12>
+  80342e:	eb 06                	jmp    803436 <memfind+0x25>
+  803430:	89 c2                	mov    %eax,%edx
+  803432:	eb 02                	jmp    803436 <memfind+0x25>
+  803434:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  803436:	89 d0                	mov    %edx,%eax
+  803438:	5d                   	pop    %ebp
+  803439:	c3                   	ret
+
+0080343a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80343a:	55                   	push   %ebp
+  80343b:	89 e5                	mov    %esp,%ebp
+  80343d:	57                   	push   %edi
+  80343e:	56                   	push   %esi
+  80343f:	53                   	push   %ebx
+  803440:	8b 55 08             	mov    0x8(%ebp),%edx
+  803443:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803446:	0f b6 02             	movzbl (%edx),%eax
+  803449:	3c 20                	cmp    $0x20,%al
+  80344b:	74 04                	je     803451 <strtol+0x17>
+  80344d:	3c 09                	cmp    $0x9,%al
+  80344f:	75 0e                	jne    80345f <strtol+0x25>
+		s++;
+  803451:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803454:	0f b6 02             	movzbl (%edx),%eax
+  803457:	3c 20                	cmp    $0x20,%al
+  803459:	74 f6                	je     803451 <strtol+0x17>
+  80345b:	3c 09                	cmp    $0x9,%al
+  80345d:	74 f2                	je     803451 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  80345f:	3c 2b                	cmp    $0x2b,%al
+  803461:	74 2a                	je     80348d <strtol+0x53>
+	int neg = 0;
+  803463:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803468:	3c 2d                	cmp    $0x2d,%al
+  80346a:	74 2b                	je     803497 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80346c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803472:	75 0f                	jne    803483 <strtol+0x49>
+  803474:	80 3a 30             	cmpb   $0x30,(%edx)
+  803477:	74 28                	je     8034a1 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803479:	85 db                	test   %ebx,%ebx
+  80347b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803480:	0f 44 d8             	cmove  %eax,%ebx
+  803483:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803488:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80348b:	eb 46                	jmp    8034d3 <strtol+0x99>
+		s++;
+  80348d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803490:	bf 00 00 00 00       	mov    $0x0,%edi
+  803495:	eb d5                	jmp    80346c <strtol+0x32>
+		s++, neg = 1;
+  803497:	83 c2 01             	add    $0x1,%edx
+  80349a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80349f:	eb cb                	jmp    80346c <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034a1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034a5:	74 0e                	je     8034b5 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034a7:	85 db                	test   %ebx,%ebx
+  8034a9:	75 d8                	jne    803483 <strtol+0x49>
+		s++, base = 8;
+  8034ab:	83 c2 01             	add    $0x1,%edx
+  8034ae:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034b3:	eb ce                	jmp    803483 <strtol+0x49>
+		s += 2, base = 16;
+  8034b5:	83 c2 02             	add    $0x2,%edx
+  8034b8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034bd:	eb c4                	jmp    803483 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034bf:	0f be c0             	movsbl %al,%eax
+  8034c2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034c5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034c8:	7d 3a                	jge    803504 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034ca:	83 c2 01             	add    $0x1,%edx
+  8034cd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8034d1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8034d3:	0f b6 02             	movzbl (%edx),%eax
+  8034d6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8034d9:	89 f3                	mov    %esi,%ebx
+  8034db:	80 fb 09             	cmp    $0x9,%bl
+  8034de:	76 df                	jbe    8034bf <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8034e0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8034e3:	89 f3                	mov    %esi,%ebx
+  8034e5:	80 fb 19             	cmp    $0x19,%bl
+  8034e8:	77 08                	ja     8034f2 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8034ea:	0f be c0             	movsbl %al,%eax
+  8034ed:	83 e8 57             	sub    $0x57,%eax
+  8034f0:	eb d3                	jmp    8034c5 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8034f2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8034f5:	89 f3                	mov    %esi,%ebx
+  8034f7:	80 fb 19             	cmp    $0x19,%bl
+  8034fa:	77 08                	ja     803504 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8034fc:	0f be c0             	movsbl %al,%eax
+  8034ff:	83 e8 37             	sub    $0x37,%eax
+  803502:	eb c1                	jmp    8034c5 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803504:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803508:	74 05                	je     80350f <strtol+0xd5>
+		*endptr = (char *) s;
+  80350a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80350d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80350f:	89 c8                	mov    %ecx,%eax
+  803511:	f7 d8                	neg    %eax
+  803513:	85 ff                	test   %edi,%edi
+  803515:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803518:	89 c8                	mov    %ecx,%eax
+  80351a:	5b                   	pop    %ebx
+  80351b:	5e                   	pop    %esi
+  80351c:	5f                   	pop    %edi
+  80351d:	5d                   	pop    %ebp
+  80351e:	c3                   	ret
+
+0080351f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	56                   	push   %esi
+  803523:	53                   	push   %ebx
+  803524:	8b 75 08             	mov    0x8(%ebp),%esi
+  803527:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80352a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80352d:	85 c0                	test   %eax,%eax
+  80352f:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803534:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803537:	83 ec 0c             	sub    $0xc,%esp
+  80353a:	50                   	push   %eax
+  80353b:	e8 0a ce ff ff       	call   80034a <sys_ipc_recv>
+  803540:	83 c4 10             	add    $0x10,%esp
+  803543:	85 c0                	test   %eax,%eax
+  803545:	0f 88 8b 00 00 00    	js     8035d6 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80354b:	85 f6                	test   %esi,%esi
+  80354d:	74 2a                	je     803579 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80354f:	89 e2                	mov    %esp,%edx
+  803551:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803556:	29 d0                	sub    %edx,%eax
+  803558:	89 c2                	mov    %eax,%edx
+  80355a:	c1 ea 0f             	shr    $0xf,%edx
+  80355d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803562:	b8 00 00 00 00       	mov    $0x0,%eax
+  803567:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80356a:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803571:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803577:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803579:	85 db                	test   %ebx,%ebx
+  80357b:	74 2a                	je     8035a7 <ipc_recv+0x88>
+  80357d:	89 e2                	mov    %esp,%edx
+  80357f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803584:	29 d0                	sub    %edx,%eax
+  803586:	89 c2                	mov    %eax,%edx
+  803588:	c1 ea 0f             	shr    $0xf,%edx
+  80358b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803590:	b8 00 00 00 00       	mov    $0x0,%eax
+  803595:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803598:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80359f:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035a5:	89 03                	mov    %eax,(%ebx)
+  8035a7:	89 e2                	mov    %esp,%edx
+  8035a9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035ae:	29 d0                	sub    %edx,%eax
+  8035b0:	89 c2                	mov    %eax,%edx
+  8035b2:	c1 ea 0f             	shr    $0xf,%edx
+  8035b5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bf:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035c2:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035c9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035d2:	5b                   	pop    %ebx
+  8035d3:	5e                   	pop    %esi
+  8035d4:	5d                   	pop    %ebp
+  8035d5:	c3                   	ret
+		if(from_env_store != NULL)
+  8035d6:	85 f6                	test   %esi,%esi
+  8035d8:	74 06                	je     8035e0 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035e0:	85 db                	test   %ebx,%ebx
+  8035e2:	74 eb                	je     8035cf <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035e4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8035ea:	eb e3                	jmp    8035cf <ipc_recv+0xb0>
+
+008035ec <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8035ec:	55                   	push   %ebp
+  8035ed:	89 e5                	mov    %esp,%ebp
+  8035ef:	57                   	push   %edi
+  8035f0:	56                   	push   %esi
+  8035f1:	53                   	push   %ebx
+  8035f2:	83 ec 14             	sub    $0x14,%esp
+  8035f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035fb:	8b 75 14             	mov    0x14(%ebp),%esi
+  8035fe:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803601:	85 c0                	test   %eax,%eax
+  803603:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803608:	0f 44 c2             	cmove  %edx,%eax
+  80360b:	ff 75 10             	push   0x10(%ebp)
+  80360e:	50                   	push   %eax
+  80360f:	e8 98 cd ff ff       	call   8003ac <sys_ipc_recv_pages>
+  803614:	83 c4 10             	add    $0x10,%esp
+  803617:	85 c0                	test   %eax,%eax
+  803619:	0f 88 ba 00 00 00    	js     8036d9 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80361f:	85 ff                	test   %edi,%edi
+  803621:	74 2a                	je     80364d <ipc_recv_pages+0x61>
+  803623:	89 e2                	mov    %esp,%edx
+  803625:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80362a:	29 d0                	sub    %edx,%eax
+  80362c:	89 c2                	mov    %eax,%edx
+  80362e:	c1 ea 0f             	shr    $0xf,%edx
+  803631:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80363e:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803645:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80364b:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80364d:	85 f6                	test   %esi,%esi
+  80364f:	74 2a                	je     80367b <ipc_recv_pages+0x8f>
+  803651:	89 e2                	mov    %esp,%edx
+  803653:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803658:	29 d0                	sub    %edx,%eax
+  80365a:	89 c2                	mov    %eax,%edx
+  80365c:	c1 ea 0f             	shr    $0xf,%edx
+  80365f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803664:	b8 00 00 00 00       	mov    $0x0,%eax
+  803669:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80366c:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803673:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803679:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80367b:	85 db                	test   %ebx,%ebx
+  80367d:	74 2a                	je     8036a9 <ipc_recv_pages+0xbd>
+  80367f:	89 e2                	mov    %esp,%edx
+  803681:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803686:	29 d0                	sub    %edx,%eax
+  803688:	89 c2                	mov    %eax,%edx
+  80368a:	c1 ea 0f             	shr    $0xf,%edx
+  80368d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803692:	b8 00 00 00 00       	mov    $0x0,%eax
+  803697:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80369a:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036a1:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036a7:	89 03                	mov    %eax,(%ebx)
+  8036a9:	89 e2                	mov    %esp,%edx
+  8036ab:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036b0:	29 d0                	sub    %edx,%eax
+  8036b2:	89 c2                	mov    %eax,%edx
+  8036b4:	c1 ea 0f             	shr    $0xf,%edx
+  8036b7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c1:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036c4:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036cb:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d4:	5b                   	pop    %ebx
+  8036d5:	5e                   	pop    %esi
+  8036d6:	5f                   	pop    %edi
+  8036d7:	5d                   	pop    %ebp
+  8036d8:	c3                   	ret
+		if (from_env_store)
+  8036d9:	85 ff                	test   %edi,%edi
+  8036db:	74 06                	je     8036e3 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036dd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036e3:	85 f6                	test   %esi,%esi
+  8036e5:	74 06                	je     8036ed <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8036e7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8036ed:	85 db                	test   %ebx,%ebx
+  8036ef:	74 e0                	je     8036d1 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8036f1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036f7:	eb d8                	jmp    8036d1 <ipc_recv_pages+0xe5>
+
+008036f9 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8036f9:	55                   	push   %ebp
+  8036fa:	89 e5                	mov    %esp,%ebp
+  8036fc:	57                   	push   %edi
+  8036fd:	56                   	push   %esi
+  8036fe:	53                   	push   %ebx
+  8036ff:	83 ec 1c             	sub    $0x1c,%esp
+  803702:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803705:	8b 75 08             	mov    0x8(%ebp),%esi
+  803708:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80370e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803712:	75 2b                	jne    80373f <ipc_try_send_pages+0x46>
+  803714:	89 e2                	mov    %esp,%edx
+  803716:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80371b:	29 d0                	sub    %edx,%eax
+  80371d:	89 c2                	mov    %eax,%edx
+  80371f:	c1 ea 0f             	shr    $0xf,%edx
+  803722:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372c:	0f 42 c2             	cmovb  %edx,%eax
+  80372f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803736:	8b 70 48             	mov    0x48(%eax),%esi
+  803739:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80373f:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803745:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80374a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80374d:	85 ff                	test   %edi,%edi
+  80374f:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803754:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803757:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80375d:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803763:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803769:	83 ec 0c             	sub    $0xc,%esp
+  80376c:	ff 75 14             	push   0x14(%ebp)
+  80376f:	ff 75 18             	push   0x18(%ebp)
+  803772:	57                   	push   %edi
+  803773:	ff 75 0c             	push   0xc(%ebp)
+  803776:	ff 75 08             	push   0x8(%ebp)
+  803779:	e8 0d cc ff ff       	call   80038b <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80377e:	83 c4 20             	add    $0x20,%esp
+  803781:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803784:	75 21                	jne    8037a7 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803786:	83 ec 04             	sub    $0x4,%esp
+  803789:	6a ff                	push   $0xffffffff
+  80378b:	53                   	push   %ebx
+  80378c:	ff 75 e4             	push   -0x1c(%ebp)
+  80378f:	e8 04 ce ff ff       	call   800598 <sys_futex_wait>
+  803794:	83 c4 10             	add    $0x10,%esp
+  803797:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80379a:	74 c7                	je     803763 <ipc_try_send_pages+0x6a>
+  80379c:	85 c0                	test   %eax,%eax
+  80379e:	79 c3                	jns    803763 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037a0:	e8 d6 c9 ff ff       	call   80017b <sys_yield>
+  8037a5:	eb bc                	jmp    803763 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037aa:	5b                   	pop    %ebx
+  8037ab:	5e                   	pop    %esi
+  8037ac:	5f                   	pop    %edi
+  8037ad:	5d                   	pop    %ebp
+  8037ae:	c3                   	ret
+
+008037af <ipc_send>:
+{
+  8037af:	55                   	push   %ebp
+  8037b0:	89 e5                	mov    %esp,%ebp
+  8037b2:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037b5:	ff 75 14             	push   0x14(%ebp)
+  8037b8:	6a 01                	push   $0x1
+  8037ba:	ff 75 10             	push   0x10(%ebp)
+  8037bd:	ff 75 0c             	push   0xc(%ebp)
+  8037c0:	ff 75 08             	push   0x8(%ebp)
+  8037c3:	e8 31 ff ff ff       	call   8036f9 <ipc_try_send_pages>
+  8037c8:	83 c4 20             	add    $0x20,%esp
+  8037cb:	85 c0                	test   %eax,%eax
+  8037cd:	78 02                	js     8037d1 <ipc_send+0x22>
+}
+  8037cf:	c9                   	leave
+  8037d0:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037d1:	50                   	push   %eax
+  8037d2:	68 2b 3f 80 00       	push   $0x803f2b
+  8037d7:	6a 3f                	push   $0x3f
+  8037d9:	68 40 3f 80 00       	push   $0x803f40
+  8037de:	e8 f2 f1 ff ff       	call   8029d5 <_panic>
+
+008037e3 <ipc_send_pages>:
+{
+  8037e3:	55                   	push   %ebp
+  8037e4:	89 e5                	mov    %esp,%ebp
+  8037e6:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8037e9:	ff 75 18             	push   0x18(%ebp)
+  8037ec:	ff 75 14             	push   0x14(%ebp)
+  8037ef:	ff 75 10             	push   0x10(%ebp)
+  8037f2:	ff 75 0c             	push   0xc(%ebp)
+  8037f5:	ff 75 08             	push   0x8(%ebp)
+  8037f8:	e8 fc fe ff ff       	call   8036f9 <ipc_try_send_pages>
+  8037fd:	83 c4 20             	add    $0x20,%esp
+  803800:	85 c0                	test   %eax,%eax
+  803802:	78 02                	js     803806 <ipc_send_pages+0x23>
+}
+  803804:	c9                   	leave
+  803805:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803806:	50                   	push   %eax
+  803807:	68 4a 3f 80 00       	push   $0x803f4a
+  80380c:	6a 64                	push   $0x64
+  80380e:	68 40 3f 80 00       	push   $0x803f40
+  803813:	e8 bd f1 ff ff       	call   8029d5 <_panic>
+
+00803818 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803818:	55                   	push   %ebp
+  803819:	89 e5                	mov    %esp,%ebp
+  80381b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80381e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803823:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803829:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80382f:	8b 52 50             	mov    0x50(%edx),%edx
+  803832:	39 ca                	cmp    %ecx,%edx
+  803834:	74 11                	je     803847 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803836:	83 c0 01             	add    $0x1,%eax
+  803839:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80383e:	75 e3                	jne    803823 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803840:	b8 00 00 00 00       	mov    $0x0,%eax
+  803845:	eb 0e                	jmp    803855 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803847:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80384d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803852:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803855:	5d                   	pop    %ebp
+  803856:	c3                   	ret
+
+00803857 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803857:	55                   	push   %ebp
+  803858:	89 e5                	mov    %esp,%ebp
+  80385a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80385d:	89 c2                	mov    %eax,%edx
+  80385f:	c1 ea 16             	shr    $0x16,%edx
+  803862:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803869:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80386e:	f6 c1 01             	test   $0x1,%cl
+  803871:	74 1e                	je     803891 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803873:	c1 e8 0c             	shr    $0xc,%eax
+  803876:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80387d:	a8 01                	test   $0x1,%al
+  80387f:	74 10                	je     803891 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803881:	c1 e8 0c             	shr    $0xc,%eax
+  803884:	c1 e0 04             	shl    $0x4,%eax
+  803887:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80388e:	0f b7 d2             	movzwl %dx,%edx
+}
+  803891:	89 d0                	mov    %edx,%eax
+  803893:	5d                   	pop    %ebp
+  803894:	c3                   	ret
+
+00803895 <__udivdi3>:
+  803895:	57                   	push   %edi
+  803896:	56                   	push   %esi
+  803897:	53                   	push   %ebx
+  803898:	83 ec 20             	sub    $0x20,%esp
+  80389b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80389f:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038a3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038a7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038ab:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038af:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038b3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038b7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038ca:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038d1:	00 
+  8038d2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038d9:	00 
+  8038da:	eb 08                	jmp    8038e4 <__udivdi3+0x4f>
+  8038dc:	83 e9 01             	sub    $0x1,%ecx
+  8038df:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038e2:	74 68                	je     80394c <__udivdi3+0xb7>
+  8038e4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038e8:	01 c0                	add    %eax,%eax
+  8038ea:	89 c6                	mov    %eax,%esi
+  8038ec:	89 d7                	mov    %edx,%edi
+  8038ee:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038f2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038f6:	0f ad d0             	shrd   %cl,%edx,%eax
+  8038f9:	d3 ea                	shr    %cl,%edx
+  8038fb:	f6 c1 20             	test   $0x20,%cl
+  8038fe:	74 04                	je     803904 <__udivdi3+0x6f>
+  803900:	89 d0                	mov    %edx,%eax
+  803902:	31 d2                	xor    %edx,%edx
+  803904:	83 e0 01             	and    $0x1,%eax
+  803907:	89 04 24             	mov    %eax,(%esp)
+  80390a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803911:	00 
+  803912:	8b 04 24             	mov    (%esp),%eax
+  803915:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803919:	09 f0                	or     %esi,%eax
+  80391b:	09 fa                	or     %edi,%edx
+  80391d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803921:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803925:	39 f0                	cmp    %esi,%eax
+  803927:	89 d3                	mov    %edx,%ebx
+  803929:	19 fb                	sbb    %edi,%ebx
+  80392b:	72 af                	jb     8038dc <__udivdi3+0x47>
+  80392d:	29 f0                	sub    %esi,%eax
+  80392f:	19 fa                	sbb    %edi,%edx
+  803931:	89 cf                	mov    %ecx,%edi
+  803933:	c1 ef 05             	shr    $0x5,%edi
+  803936:	83 e7 01             	and    $0x1,%edi
+  803939:	89 fe                	mov    %edi,%esi
+  80393b:	83 f6 01             	xor    $0x1,%esi
+  80393e:	d3 e6                	shl    %cl,%esi
+  803940:	d3 e7                	shl    %cl,%edi
+  803942:	09 74 24 18          	or     %esi,0x18(%esp)
+  803946:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80394a:	eb 90                	jmp    8038dc <__udivdi3+0x47>
+  80394c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803950:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803954:	83 c4 20             	add    $0x20,%esp
+  803957:	5b                   	pop    %ebx
+  803958:	5e                   	pop    %esi
+  803959:	5f                   	pop    %edi
+  80395a:	c3                   	ret
+
+0080395b <__umoddi3>:
+  80395b:	57                   	push   %edi
+  80395c:	56                   	push   %esi
+  80395d:	53                   	push   %ebx
+  80395e:	83 ec 08             	sub    $0x8,%esp
+  803961:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803965:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803969:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80396d:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803971:	57                   	push   %edi
+  803972:	56                   	push   %esi
+  803973:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803977:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80397b:	52                   	push   %edx
+  80397c:	50                   	push   %eax
+  80397d:	e8 13 ff ff ff       	call   803895 <__udivdi3>
+  803982:	89 c3                	mov    %eax,%ebx
+  803984:	0f af d6             	imul   %esi,%edx
+  803987:	89 f9                	mov    %edi,%ecx
+  803989:	0f af cb             	imul   %ebx,%ecx
+  80398c:	01 d1                	add    %edx,%ecx
+  80398e:	89 d8                	mov    %ebx,%eax
+  803990:	f7 e6                	mul    %esi
+  803992:	89 c6                	mov    %eax,%esi
+  803994:	89 d7                	mov    %edx,%edi
+  803996:	01 cf                	add    %ecx,%edi
+  803998:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80399c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039a0:	29 f0                	sub    %esi,%eax
+  8039a2:	19 fa                	sbb    %edi,%edx
+  8039a4:	83 c4 18             	add    $0x18,%esp
+  8039a7:	5b                   	pop    %ebx
+  8039a8:	5e                   	pop    %esi
+  8039a9:	5f                   	pop    %edi
+  8039aa:	c3                   	ret
+
+008039ab <__divdi3>:
+  8039ab:	53                   	push   %ebx
+  8039ac:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039b0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039b4:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039b8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039bc:	85 d2                	test   %edx,%edx
+  8039be:	78 12                	js     8039d2 <__divdi3+0x27>
+  8039c0:	85 db                	test   %ebx,%ebx
+  8039c2:	78 2e                	js     8039f2 <__divdi3+0x47>
+  8039c4:	53                   	push   %ebx
+  8039c5:	51                   	push   %ecx
+  8039c6:	52                   	push   %edx
+  8039c7:	50                   	push   %eax
+  8039c8:	e8 c8 fe ff ff       	call   803895 <__udivdi3>
+  8039cd:	83 c4 10             	add    $0x10,%esp
+  8039d0:	eb 1e                	jmp    8039f0 <__divdi3+0x45>
+  8039d2:	f7 d8                	neg    %eax
+  8039d4:	83 d2 00             	adc    $0x0,%edx
+  8039d7:	f7 da                	neg    %edx
+  8039d9:	85 db                	test   %ebx,%ebx
+  8039db:	78 2a                	js     803a07 <__divdi3+0x5c>
+  8039dd:	53                   	push   %ebx
+  8039de:	51                   	push   %ecx
+  8039df:	52                   	push   %edx
+  8039e0:	50                   	push   %eax
+  8039e1:	e8 af fe ff ff       	call   803895 <__udivdi3>
+  8039e6:	83 c4 10             	add    $0x10,%esp
+  8039e9:	f7 d8                	neg    %eax
+  8039eb:	83 d2 00             	adc    $0x0,%edx
+  8039ee:	f7 da                	neg    %edx
+  8039f0:	5b                   	pop    %ebx
+  8039f1:	c3                   	ret
+  8039f2:	f7 d9                	neg    %ecx
+  8039f4:	83 d3 00             	adc    $0x0,%ebx
+  8039f7:	f7 db                	neg    %ebx
+  8039f9:	53                   	push   %ebx
+  8039fa:	51                   	push   %ecx
+  8039fb:	52                   	push   %edx
+  8039fc:	50                   	push   %eax
+  8039fd:	e8 93 fe ff ff       	call   803895 <__udivdi3>
+  803a02:	83 c4 10             	add    $0x10,%esp
+  803a05:	eb e2                	jmp    8039e9 <__divdi3+0x3e>
+  803a07:	f7 d9                	neg    %ecx
+  803a09:	83 d3 00             	adc    $0x0,%ebx
+  803a0c:	f7 db                	neg    %ebx
+  803a0e:	53                   	push   %ebx
+  803a0f:	51                   	push   %ecx
+  803a10:	52                   	push   %edx
+  803a11:	50                   	push   %eax
+  803a12:	e8 7e fe ff ff       	call   803895 <__udivdi3>
+  803a17:	83 c4 10             	add    $0x10,%esp
+  803a1a:	eb d4                	jmp    8039f0 <__divdi3+0x45>
+
+00803a1c <__moddi3>:
+  803a1c:	57                   	push   %edi
+  803a1d:	56                   	push   %esi
+  803a1e:	53                   	push   %ebx
+  803a1f:	83 ec 08             	sub    $0x8,%esp
+  803a22:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a26:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a2a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a2e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a32:	57                   	push   %edi
+  803a33:	56                   	push   %esi
+  803a34:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a38:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a3c:	52                   	push   %edx
+  803a3d:	50                   	push   %eax
+  803a3e:	e8 68 ff ff ff       	call   8039ab <__divdi3>
+  803a43:	89 c3                	mov    %eax,%ebx
+  803a45:	0f af d6             	imul   %esi,%edx
+  803a48:	89 f9                	mov    %edi,%ecx
+  803a4a:	0f af cb             	imul   %ebx,%ecx
+  803a4d:	01 d1                	add    %edx,%ecx
+  803a4f:	89 d8                	mov    %ebx,%eax
+  803a51:	f7 e6                	mul    %esi
+  803a53:	89 c6                	mov    %eax,%esi
+  803a55:	89 d7                	mov    %edx,%edi
+  803a57:	01 cf                	add    %ecx,%edi
+  803a59:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a5d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a61:	29 f0                	sub    %esi,%eax
+  803a63:	19 fa                	sbb    %edi,%edx
+  803a65:	83 c4 18             	add    $0x18,%esp
+  803a68:	5b                   	pop    %ebx
+  803a69:	5e                   	pop    %esi
+  803a6a:	5f                   	pop    %edi
+  803a6b:	c3                   	ret
@@ -0,0 +1,7861 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 18 00 00 00       	call   800049 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  80003b:	6a 01                	push   $0x1
+  80003d:	6a 01                	push   $0x1
+  80003f:	e8 ac 00 00 00       	call   8000f0 <sys_cputs>
+}
+  800044:	83 c4 10             	add    $0x10,%esp
+  800047:	c9                   	leave
+  800048:	c3                   	ret
+
+00800049 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800049:	55                   	push   %ebp
+  80004a:	89 e5                	mov    %esp,%ebp
+  80004c:	56                   	push   %esi
+  80004d:	53                   	push   %ebx
+  80004e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800051:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800054:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800056:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80005b:	29 d0                	sub    %edx,%eax
+  80005d:	89 c2                	mov    %eax,%edx
+  80005f:	c1 ea 0f             	shr    $0xf,%edx
+  800062:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80006f:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800076:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80007a:	e8 ef 00 00 00       	call   80016e <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80007f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800084:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80008a:	89 e1                	mov    %esp,%ecx
+  80008c:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800091:	29 ca                	sub    %ecx,%edx
+  800093:	89 d1                	mov    %edx,%ecx
+  800095:	c1 e9 0f             	shr    $0xf,%ecx
+  800098:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80009e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a3:	0f 42 d1             	cmovb  %ecx,%edx
+  8000a6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ab:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000b2:	85 db                	test   %ebx,%ebx
+  8000b4:	7e 07                	jle    8000bd <libmain+0x74>
+		binaryname = argv[0];
+  8000b6:	8b 06                	mov    (%esi),%eax
+  8000b8:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000bd:	83 ec 08             	sub    $0x8,%esp
+  8000c0:	56                   	push   %esi
+  8000c1:	53                   	push   %ebx
+  8000c2:	e8 6e ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000c7:	e8 0a 00 00 00       	call   8000d6 <exit>
+}
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d2:	5b                   	pop    %ebx
+  8000d3:	5e                   	pop    %esi
+  8000d4:	5d                   	pop    %ebp
+  8000d5:	c3                   	ret
+
+008000d6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000d6:	55                   	push   %ebp
+  8000d7:	89 e5                	mov    %esp,%ebp
+  8000d9:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000dc:	e8 17 07 00 00       	call   8007f8 <close_all>
+	sys_env_destroy(0);
+  8000e1:	83 ec 0c             	sub    $0xc,%esp
+  8000e4:	6a 00                	push   $0x0
+  8000e6:	e8 42 00 00 00       	call   80012d <sys_env_destroy>
+}
+  8000eb:	83 c4 10             	add    $0x10,%esp
+  8000ee:	c9                   	leave
+  8000ef:	c3                   	ret
+
+008000f0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000f0:	55                   	push   %ebp
+  8000f1:	89 e5                	mov    %esp,%ebp
+  8000f3:	57                   	push   %edi
+  8000f4:	56                   	push   %esi
+  8000f5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800101:	89 c3                	mov    %eax,%ebx
+  800103:	89 c7                	mov    %eax,%edi
+  800105:	89 c6                	mov    %eax,%esi
+  800107:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800109:	5b                   	pop    %ebx
+  80010a:	5e                   	pop    %esi
+  80010b:	5f                   	pop    %edi
+  80010c:	5d                   	pop    %ebp
+  80010d:	c3                   	ret
+
+0080010e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80010e:	55                   	push   %ebp
+  80010f:	89 e5                	mov    %esp,%ebp
+  800111:	57                   	push   %edi
+  800112:	56                   	push   %esi
+  800113:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800114:	ba 00 00 00 00       	mov    $0x0,%edx
+  800119:	b8 01 00 00 00       	mov    $0x1,%eax
+  80011e:	89 d1                	mov    %edx,%ecx
+  800120:	89 d3                	mov    %edx,%ebx
+  800122:	89 d7                	mov    %edx,%edi
+  800124:	89 d6                	mov    %edx,%esi
+  800126:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800128:	5b                   	pop    %ebx
+  800129:	5e                   	pop    %esi
+  80012a:	5f                   	pop    %edi
+  80012b:	5d                   	pop    %ebp
+  80012c:	c3                   	ret
+
+0080012d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	57                   	push   %edi
+  800131:	56                   	push   %esi
+  800132:	53                   	push   %ebx
+  800133:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800136:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80013b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80013e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800143:	89 cb                	mov    %ecx,%ebx
+  800145:	89 cf                	mov    %ecx,%edi
+  800147:	89 ce                	mov    %ecx,%esi
+  800149:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80014b:	85 c0                	test   %eax,%eax
+  80014d:	7f 08                	jg     800157 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80014f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800152:	5b                   	pop    %ebx
+  800153:	5e                   	pop    %esi
+  800154:	5f                   	pop    %edi
+  800155:	5d                   	pop    %ebp
+  800156:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	50                   	push   %eax
+  80015b:	6a 03                	push   $0x3
+  80015d:	68 8a 3a 80 00       	push   $0x803a8a
+  800162:	6a 23                	push   $0x23
+  800164:	68 a7 3a 80 00       	push   $0x803aa7
+  800169:	e8 79 28 00 00       	call   8029e7 <_panic>
+
+0080016e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80016e:	55                   	push   %ebp
+  80016f:	89 e5                	mov    %esp,%ebp
+  800171:	57                   	push   %edi
+  800172:	56                   	push   %esi
+  800173:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800174:	ba 00 00 00 00       	mov    $0x0,%edx
+  800179:	b8 02 00 00 00       	mov    $0x2,%eax
+  80017e:	89 d1                	mov    %edx,%ecx
+  800180:	89 d3                	mov    %edx,%ebx
+  800182:	89 d7                	mov    %edx,%edi
+  800184:	89 d6                	mov    %edx,%esi
+  800186:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800188:	5b                   	pop    %ebx
+  800189:	5e                   	pop    %esi
+  80018a:	5f                   	pop    %edi
+  80018b:	5d                   	pop    %ebp
+  80018c:	c3                   	ret
+
+0080018d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80018d:	55                   	push   %ebp
+  80018e:	89 e5                	mov    %esp,%ebp
+  800190:	57                   	push   %edi
+  800191:	56                   	push   %esi
+  800192:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800193:	ba 00 00 00 00       	mov    $0x0,%edx
+  800198:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80019d:	89 d1                	mov    %edx,%ecx
+  80019f:	89 d3                	mov    %edx,%ebx
+  8001a1:	89 d7                	mov    %edx,%edi
+  8001a3:	89 d6                	mov    %edx,%esi
+  8001a5:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001a7:	5b                   	pop    %ebx
+  8001a8:	5e                   	pop    %esi
+  8001a9:	5f                   	pop    %edi
+  8001aa:	5d                   	pop    %ebp
+  8001ab:	c3                   	ret
+
+008001ac <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001ac:	55                   	push   %ebp
+  8001ad:	89 e5                	mov    %esp,%ebp
+  8001af:	57                   	push   %edi
+  8001b0:	56                   	push   %esi
+  8001b1:	53                   	push   %ebx
+  8001b2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c8:	89 f7                	mov    %esi,%edi
+  8001ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001cc:	85 c0                	test   %eax,%eax
+  8001ce:	7f 08                	jg     8001d8 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d3:	5b                   	pop    %ebx
+  8001d4:	5e                   	pop    %esi
+  8001d5:	5f                   	pop    %edi
+  8001d6:	5d                   	pop    %ebp
+  8001d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d8:	83 ec 0c             	sub    $0xc,%esp
+  8001db:	50                   	push   %eax
+  8001dc:	6a 04                	push   $0x4
+  8001de:	68 8a 3a 80 00       	push   $0x803a8a
+  8001e3:	6a 23                	push   $0x23
+  8001e5:	68 a7 3a 80 00       	push   $0x803aa7
+  8001ea:	e8 f8 27 00 00       	call   8029e7 <_panic>
+
+008001ef <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001fe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800203:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800206:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800209:	8b 75 18             	mov    0x18(%ebp),%esi
+  80020c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80020e:	85 c0                	test   %eax,%eax
+  800210:	7f 08                	jg     80021a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800215:	5b                   	pop    %ebx
+  800216:	5e                   	pop    %esi
+  800217:	5f                   	pop    %edi
+  800218:	5d                   	pop    %ebp
+  800219:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80021a:	83 ec 0c             	sub    $0xc,%esp
+  80021d:	50                   	push   %eax
+  80021e:	6a 05                	push   $0x5
+  800220:	68 8a 3a 80 00       	push   $0x803a8a
+  800225:	6a 23                	push   $0x23
+  800227:	68 a7 3a 80 00       	push   $0x803aa7
+  80022c:	e8 b6 27 00 00       	call   8029e7 <_panic>
+
+00800231 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	57                   	push   %edi
+  800235:	56                   	push   %esi
+  800236:	53                   	push   %ebx
+  800237:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80023a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80023f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800242:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800245:	b8 06 00 00 00       	mov    $0x6,%eax
+  80024a:	89 df                	mov    %ebx,%edi
+  80024c:	89 de                	mov    %ebx,%esi
+  80024e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800250:	85 c0                	test   %eax,%eax
+  800252:	7f 08                	jg     80025c <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800257:	5b                   	pop    %ebx
+  800258:	5e                   	pop    %esi
+  800259:	5f                   	pop    %edi
+  80025a:	5d                   	pop    %ebp
+  80025b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80025c:	83 ec 0c             	sub    $0xc,%esp
+  80025f:	50                   	push   %eax
+  800260:	6a 06                	push   $0x6
+  800262:	68 8a 3a 80 00       	push   $0x803a8a
+  800267:	6a 23                	push   $0x23
+  800269:	68 a7 3a 80 00       	push   $0x803aa7
+  80026e:	e8 74 27 00 00       	call   8029e7 <_panic>
+
+00800273 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	57                   	push   %edi
+  800277:	56                   	push   %esi
+  800278:	53                   	push   %ebx
+  800279:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80027c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800281:	8b 55 08             	mov    0x8(%ebp),%edx
+  800284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800287:	b8 08 00 00 00       	mov    $0x8,%eax
+  80028c:	89 df                	mov    %ebx,%edi
+  80028e:	89 de                	mov    %ebx,%esi
+  800290:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800292:	85 c0                	test   %eax,%eax
+  800294:	7f 08                	jg     80029e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800299:	5b                   	pop    %ebx
+  80029a:	5e                   	pop    %esi
+  80029b:	5f                   	pop    %edi
+  80029c:	5d                   	pop    %ebp
+  80029d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80029e:	83 ec 0c             	sub    $0xc,%esp
+  8002a1:	50                   	push   %eax
+  8002a2:	6a 08                	push   $0x8
+  8002a4:	68 8a 3a 80 00       	push   $0x803a8a
+  8002a9:	6a 23                	push   $0x23
+  8002ab:	68 a7 3a 80 00       	push   $0x803aa7
+  8002b0:	e8 32 27 00 00       	call   8029e7 <_panic>
+
+008002b5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	57                   	push   %edi
+  8002b9:	56                   	push   %esi
+  8002ba:	53                   	push   %ebx
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002ce:	89 df                	mov    %ebx,%edi
+  8002d0:	89 de                	mov    %ebx,%esi
+  8002d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002d4:	85 c0                	test   %eax,%eax
+  8002d6:	7f 08                	jg     8002e0 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002db:	5b                   	pop    %ebx
+  8002dc:	5e                   	pop    %esi
+  8002dd:	5f                   	pop    %edi
+  8002de:	5d                   	pop    %ebp
+  8002df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002e0:	83 ec 0c             	sub    $0xc,%esp
+  8002e3:	50                   	push   %eax
+  8002e4:	6a 09                	push   $0x9
+  8002e6:	68 8a 3a 80 00       	push   $0x803a8a
+  8002eb:	6a 23                	push   $0x23
+  8002ed:	68 a7 3a 80 00       	push   $0x803aa7
+  8002f2:	e8 f0 26 00 00       	call   8029e7 <_panic>
+
+008002f7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002f7:	55                   	push   %ebp
+  8002f8:	89 e5                	mov    %esp,%ebp
+  8002fa:	57                   	push   %edi
+  8002fb:	56                   	push   %esi
+  8002fc:	53                   	push   %ebx
+  8002fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800300:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800305:	8b 55 08             	mov    0x8(%ebp),%edx
+  800308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800310:	89 df                	mov    %ebx,%edi
+  800312:	89 de                	mov    %ebx,%esi
+  800314:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800316:	85 c0                	test   %eax,%eax
+  800318:	7f 08                	jg     800322 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80031a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031d:	5b                   	pop    %ebx
+  80031e:	5e                   	pop    %esi
+  80031f:	5f                   	pop    %edi
+  800320:	5d                   	pop    %ebp
+  800321:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	50                   	push   %eax
+  800326:	6a 0a                	push   $0xa
+  800328:	68 8a 3a 80 00       	push   $0x803a8a
+  80032d:	6a 23                	push   $0x23
+  80032f:	68 a7 3a 80 00       	push   $0x803aa7
+  800334:	e8 ae 26 00 00       	call   8029e7 <_panic>
+
+00800339 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	57                   	push   %edi
+  80033d:	56                   	push   %esi
+  80033e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80033f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800342:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800345:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80034a:	be 00 00 00 00       	mov    $0x0,%esi
+  80034f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800352:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800355:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800357:	5b                   	pop    %ebx
+  800358:	5e                   	pop    %esi
+  800359:	5f                   	pop    %edi
+  80035a:	5d                   	pop    %ebp
+  80035b:	c3                   	ret
+
+0080035c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80035c:	55                   	push   %ebp
+  80035d:	89 e5                	mov    %esp,%ebp
+  80035f:	57                   	push   %edi
+  800360:	56                   	push   %esi
+  800361:	53                   	push   %ebx
+  800362:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800365:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80036a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80036d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800372:	89 cb                	mov    %ecx,%ebx
+  800374:	89 cf                	mov    %ecx,%edi
+  800376:	89 ce                	mov    %ecx,%esi
+  800378:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80037a:	85 c0                	test   %eax,%eax
+  80037c:	7f 08                	jg     800386 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80037e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800381:	5b                   	pop    %ebx
+  800382:	5e                   	pop    %esi
+  800383:	5f                   	pop    %edi
+  800384:	5d                   	pop    %ebp
+  800385:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800386:	83 ec 0c             	sub    $0xc,%esp
+  800389:	50                   	push   %eax
+  80038a:	6a 0d                	push   $0xd
+  80038c:	68 8a 3a 80 00       	push   $0x803a8a
+  800391:	6a 23                	push   $0x23
+  800393:	68 a7 3a 80 00       	push   $0x803aa7
+  800398:	e8 4a 26 00 00       	call   8029e7 <_panic>
+
+0080039d <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80039d:	55                   	push   %ebp
+  80039e:	89 e5                	mov    %esp,%ebp
+  8003a0:	57                   	push   %edi
+  8003a1:	56                   	push   %esi
+  8003a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003b7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003b9:	5b                   	pop    %ebx
+  8003ba:	5e                   	pop    %esi
+  8003bb:	5f                   	pop    %edi
+  8003bc:	5d                   	pop    %ebp
+  8003bd:	c3                   	ret
+
+008003be <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003be:	55                   	push   %ebp
+  8003bf:	89 e5                	mov    %esp,%ebp
+  8003c1:	57                   	push   %edi
+  8003c2:	56                   	push   %esi
+  8003c3:	53                   	push   %ebx
+  8003c4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003d7:	89 df                	mov    %ebx,%edi
+  8003d9:	89 de                	mov    %ebx,%esi
+  8003db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003dd:	85 c0                	test   %eax,%eax
+  8003df:	7f 08                	jg     8003e9 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e4:	5b                   	pop    %ebx
+  8003e5:	5e                   	pop    %esi
+  8003e6:	5f                   	pop    %edi
+  8003e7:	5d                   	pop    %ebp
+  8003e8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003e9:	83 ec 0c             	sub    $0xc,%esp
+  8003ec:	50                   	push   %eax
+  8003ed:	6a 0d                	push   $0xd
+  8003ef:	68 8a 3a 80 00       	push   $0x803a8a
+  8003f4:	6a 23                	push   $0x23
+  8003f6:	68 a7 3a 80 00       	push   $0x803aa7
+  8003fb:	e8 e7 25 00 00       	call   8029e7 <_panic>
+
+00800400 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	57                   	push   %edi
+  800404:	56                   	push   %esi
+  800405:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800406:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800410:	89 d1                	mov    %edx,%ecx
+  800412:	89 d3                	mov    %edx,%ebx
+  800414:	89 d7                	mov    %edx,%edi
+  800416:	89 d6                	mov    %edx,%esi
+  800418:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80041a:	5b                   	pop    %ebx
+  80041b:	5e                   	pop    %esi
+  80041c:	5f                   	pop    %edi
+  80041d:	5d                   	pop    %ebp
+  80041e:	c3                   	ret
+
+0080041f <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80041f:	55                   	push   %ebp
+  800420:	89 e5                	mov    %esp,%ebp
+  800422:	57                   	push   %edi
+  800423:	56                   	push   %esi
+  800424:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800425:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80042a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80042d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800430:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800435:	89 df                	mov    %ebx,%edi
+  800437:	89 de                	mov    %ebx,%esi
+  800439:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80043b:	5b                   	pop    %ebx
+  80043c:	5e                   	pop    %esi
+  80043d:	5f                   	pop    %edi
+  80043e:	5d                   	pop    %ebp
+  80043f:	c3                   	ret
+
+00800440 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800440:	55                   	push   %ebp
+  800441:	89 e5                	mov    %esp,%ebp
+  800443:	57                   	push   %edi
+  800444:	56                   	push   %esi
+  800445:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800446:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80044b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80044e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800453:	89 cb                	mov    %ecx,%ebx
+  800455:	89 cf                	mov    %ecx,%edi
+  800457:	89 ce                	mov    %ecx,%esi
+  800459:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80045b:	5b                   	pop    %ebx
+  80045c:	5e                   	pop    %esi
+  80045d:	5f                   	pop    %edi
+  80045e:	5d                   	pop    %ebp
+  80045f:	c3                   	ret
+
+00800460 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800460:	55                   	push   %ebp
+  800461:	89 e5                	mov    %esp,%ebp
+  800463:	57                   	push   %edi
+  800464:	56                   	push   %esi
+  800465:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800466:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80046b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800471:	b8 11 00 00 00       	mov    $0x11,%eax
+  800476:	89 df                	mov    %ebx,%edi
+  800478:	89 de                	mov    %ebx,%esi
+  80047a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80047c:	5b                   	pop    %ebx
+  80047d:	5e                   	pop    %esi
+  80047e:	5f                   	pop    %edi
+  80047f:	5d                   	pop    %ebp
+  800480:	c3                   	ret
+
+00800481 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800481:	55                   	push   %ebp
+  800482:	89 e5                	mov    %esp,%ebp
+  800484:	57                   	push   %edi
+  800485:	56                   	push   %esi
+  800486:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800487:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80048c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800492:	b8 12 00 00 00       	mov    $0x12,%eax
+  800497:	89 df                	mov    %ebx,%edi
+  800499:	89 de                	mov    %ebx,%esi
+  80049b:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80049d:	5b                   	pop    %ebx
+  80049e:	5e                   	pop    %esi
+  80049f:	5f                   	pop    %edi
+  8004a0:	5d                   	pop    %ebp
+  8004a1:	c3                   	ret
+
+008004a2 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8004a2:	55                   	push   %ebp
+  8004a3:	89 e5                	mov    %esp,%ebp
+  8004a5:	57                   	push   %edi
+  8004a6:	56                   	push   %esi
+  8004a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004b5:	89 cb                	mov    %ecx,%ebx
+  8004b7:	89 cf                	mov    %ecx,%edi
+  8004b9:	89 ce                	mov    %ecx,%esi
+  8004bb:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004bd:	5b                   	pop    %ebx
+  8004be:	5e                   	pop    %esi
+  8004bf:	5f                   	pop    %edi
+  8004c0:	5d                   	pop    %ebp
+  8004c1:	c3                   	ret
+
+008004c2 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	57                   	push   %edi
+  8004c6:	56                   	push   %esi
+  8004c7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004d8:	89 df                	mov    %ebx,%edi
+  8004da:	89 de                	mov    %ebx,%esi
+  8004dc:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004de:	5b                   	pop    %ebx
+  8004df:	5e                   	pop    %esi
+  8004e0:	5f                   	pop    %edi
+  8004e1:	5d                   	pop    %ebp
+  8004e2:	c3                   	ret
+
+008004e3 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004e3:	55                   	push   %ebp
+  8004e4:	89 e5                	mov    %esp,%ebp
+  8004e6:	57                   	push   %edi
+  8004e7:	56                   	push   %esi
+  8004e8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8004f6:	89 cb                	mov    %ecx,%ebx
+  8004f8:	89 cf                	mov    %ecx,%edi
+  8004fa:	89 ce                	mov    %ecx,%esi
+  8004fc:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8004fe:	5b                   	pop    %ebx
+  8004ff:	5e                   	pop    %esi
+  800500:	5f                   	pop    %edi
+  800501:	5d                   	pop    %ebp
+  800502:	c3                   	ret
+
+00800503 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  800503:	55                   	push   %ebp
+  800504:	89 e5                	mov    %esp,%ebp
+  800506:	57                   	push   %edi
+  800507:	56                   	push   %esi
+  800508:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800509:	be 00 00 00 00       	mov    $0x0,%esi
+  80050e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800511:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800514:	b8 16 00 00 00       	mov    $0x16,%eax
+  800519:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80051c:	89 f7                	mov    %esi,%edi
+  80051e:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  800520:	5b                   	pop    %ebx
+  800521:	5e                   	pop    %esi
+  800522:	5f                   	pop    %edi
+  800523:	5d                   	pop    %ebp
+  800524:	c3                   	ret
+
+00800525 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800525:	55                   	push   %ebp
+  800526:	89 e5                	mov    %esp,%ebp
+  800528:	57                   	push   %edi
+  800529:	56                   	push   %esi
+  80052a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80052b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800530:	8b 55 08             	mov    0x8(%ebp),%edx
+  800533:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800536:	b8 17 00 00 00       	mov    $0x17,%eax
+  80053b:	89 df                	mov    %ebx,%edi
+  80053d:	89 de                	mov    %ebx,%esi
+  80053f:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  800541:	5b                   	pop    %ebx
+  800542:	5e                   	pop    %esi
+  800543:	5f                   	pop    %edi
+  800544:	5d                   	pop    %ebp
+  800545:	c3                   	ret
+
+00800546 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800546:	55                   	push   %ebp
+  800547:	89 e5                	mov    %esp,%ebp
+  800549:	57                   	push   %edi
+  80054a:	56                   	push   %esi
+  80054b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80054c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800551:	8b 55 08             	mov    0x8(%ebp),%edx
+  800554:	b8 18 00 00 00       	mov    $0x18,%eax
+  800559:	89 cb                	mov    %ecx,%ebx
+  80055b:	89 cf                	mov    %ecx,%edi
+  80055d:	89 ce                	mov    %ecx,%esi
+  80055f:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  800561:	5b                   	pop    %ebx
+  800562:	5e                   	pop    %esi
+  800563:	5f                   	pop    %edi
+  800564:	5d                   	pop    %ebp
+  800565:	c3                   	ret
+
+00800566 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800566:	55                   	push   %ebp
+  800567:	89 e5                	mov    %esp,%ebp
+  800569:	57                   	push   %edi
+  80056a:	56                   	push   %esi
+  80056b:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80056c:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  800570:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800575:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800578:	b8 19 00 00 00       	mov    $0x19,%eax
+  80057d:	89 df                	mov    %ebx,%edi
+  80057f:	89 de                	mov    %ebx,%esi
+  800581:	cd 30                	int    $0x30
+}
+  800583:	5b                   	pop    %ebx
+  800584:	5e                   	pop    %esi
+  800585:	5f                   	pop    %edi
+  800586:	5d                   	pop    %ebp
+  800587:	c3                   	ret
+
+00800588 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  800588:	55                   	push   %ebp
+  800589:	89 e5                	mov    %esp,%ebp
+  80058b:	57                   	push   %edi
+  80058c:	56                   	push   %esi
+  80058d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80058e:	be 00 00 00 00       	mov    $0x0,%esi
+  800593:	8b 55 08             	mov    0x8(%ebp),%edx
+  800596:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800599:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80059e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005a1:	89 f7                	mov    %esi,%edi
+  8005a3:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8005a5:	5b                   	pop    %ebx
+  8005a6:	5e                   	pop    %esi
+  8005a7:	5f                   	pop    %edi
+  8005a8:	5d                   	pop    %ebp
+  8005a9:	c3                   	ret
+
+008005aa <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8005aa:	55                   	push   %ebp
+  8005ab:	89 e5                	mov    %esp,%ebp
+  8005ad:	57                   	push   %edi
+  8005ae:	56                   	push   %esi
+  8005af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005c3:	89 f7                	mov    %esi,%edi
+  8005c5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005c7:	5b                   	pop    %ebx
+  8005c8:	5e                   	pop    %esi
+  8005c9:	5f                   	pop    %edi
+  8005ca:	5d                   	pop    %ebp
+  8005cb:	c3                   	ret
+
+008005cc <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005cc:	55                   	push   %ebp
+  8005cd:	89 e5                	mov    %esp,%ebp
+  8005cf:	57                   	push   %edi
+  8005d0:	56                   	push   %esi
+  8005d1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005dd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005e2:	89 df                	mov    %ebx,%edi
+  8005e4:	89 de                	mov    %ebx,%esi
+  8005e6:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005e8:	5b                   	pop    %ebx
+  8005e9:	5e                   	pop    %esi
+  8005ea:	5f                   	pop    %edi
+  8005eb:	5d                   	pop    %ebp
+  8005ec:	c3                   	ret
+
+008005ed <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005ed:	55                   	push   %ebp
+  8005ee:	89 e5                	mov    %esp,%ebp
+  8005f0:	57                   	push   %edi
+  8005f1:	56                   	push   %esi
+  8005f2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005fe:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800603:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800606:	89 f7                	mov    %esi,%edi
+  800608:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80060a:	5b                   	pop    %ebx
+  80060b:	5e                   	pop    %esi
+  80060c:	5f                   	pop    %edi
+  80060d:	5d                   	pop    %ebp
+  80060e:	c3                   	ret
+
+0080060f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80060f:	55                   	push   %ebp
+  800610:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800612:	8b 45 08             	mov    0x8(%ebp),%eax
+  800615:	05 00 00 00 30       	add    $0x30000000,%eax
+  80061a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80061d:	5d                   	pop    %ebp
+  80061e:	c3                   	ret
+
+0080061f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80061f:	55                   	push   %ebp
+  800620:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800622:	8b 45 08             	mov    0x8(%ebp),%eax
+  800625:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80062a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80062f:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800634:	5d                   	pop    %ebp
+  800635:	c3                   	ret
+
+00800636 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800636:	55                   	push   %ebp
+  800637:	89 e5                	mov    %esp,%ebp
+  800639:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80063e:	89 c2                	mov    %eax,%edx
+  800640:	c1 ea 16             	shr    $0x16,%edx
+  800643:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80064a:	f6 c2 01             	test   $0x1,%dl
+  80064d:	74 29                	je     800678 <fd_alloc+0x42>
+  80064f:	89 c2                	mov    %eax,%edx
+  800651:	c1 ea 0c             	shr    $0xc,%edx
+  800654:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80065b:	f6 c2 01             	test   $0x1,%dl
+  80065e:	74 18                	je     800678 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800660:	05 00 10 00 00       	add    $0x1000,%eax
+  800665:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80066a:	75 d2                	jne    80063e <fd_alloc+0x8>
+  80066c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800671:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800676:	eb 05                	jmp    80067d <fd_alloc+0x47>
+			return 0;
+  800678:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80067d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800680:	89 02                	mov    %eax,(%edx)
+}
+  800682:	89 c8                	mov    %ecx,%eax
+  800684:	5d                   	pop    %ebp
+  800685:	c3                   	ret
+
+00800686 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800686:	55                   	push   %ebp
+  800687:	89 e5                	mov    %esp,%ebp
+  800689:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80068c:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800691:	77 30                	ja     8006c3 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800693:	c1 e0 0c             	shl    $0xc,%eax
+  800696:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80069b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006a1:	f6 c2 01             	test   $0x1,%dl
+  8006a4:	74 24                	je     8006ca <fd_lookup+0x44>
+  8006a6:	89 c2                	mov    %eax,%edx
+  8006a8:	c1 ea 0c             	shr    $0xc,%edx
+  8006ab:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006b2:	f6 c2 01             	test   $0x1,%dl
+  8006b5:	74 1a                	je     8006d1 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ba:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006c1:	5d                   	pop    %ebp
+  8006c2:	c3                   	ret
+		return -E_INVAL;
+  8006c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c8:	eb f7                	jmp    8006c1 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006cf:	eb f0                	jmp    8006c1 <fd_lookup+0x3b>
+  8006d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d6:	eb e9                	jmp    8006c1 <fd_lookup+0x3b>
+
+008006d8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006d8:	55                   	push   %ebp
+  8006d9:	89 e5                	mov    %esp,%ebp
+  8006db:	53                   	push   %ebx
+  8006dc:	83 ec 04             	sub    $0x4,%esp
+  8006df:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e7:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8006ec:	39 13                	cmp    %edx,(%ebx)
+  8006ee:	74 54                	je     800744 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8006f0:	83 c0 01             	add    $0x1,%eax
+  8006f3:	8b 1c 85 34 3b 80 00 	mov    0x803b34(,%eax,4),%ebx
+  8006fa:	85 db                	test   %ebx,%ebx
+  8006fc:	75 ee                	jne    8006ec <dev_lookup+0x14>
+  8006fe:	89 e1                	mov    %esp,%ecx
+  800700:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800705:	29 c8                	sub    %ecx,%eax
+  800707:	89 c1                	mov    %eax,%ecx
+  800709:	c1 e9 0f             	shr    $0xf,%ecx
+  80070c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800711:	b8 00 00 00 00       	mov    $0x0,%eax
+  800716:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800719:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800720:	8b 40 48             	mov    0x48(%eax),%eax
+  800723:	83 ec 04             	sub    $0x4,%esp
+  800726:	52                   	push   %edx
+  800727:	50                   	push   %eax
+  800728:	68 b8 3a 80 00       	push   $0x803ab8
+  80072d:	e8 90 23 00 00       	call   802ac2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800732:	83 c4 10             	add    $0x10,%esp
+  800735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80073a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80073d:	89 1a                	mov    %ebx,(%edx)
+}
+  80073f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800742:	c9                   	leave
+  800743:	c3                   	ret
+			return 0;
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	eb ef                	jmp    80073a <dev_lookup+0x62>
+
+0080074b <fd_close>:
+{
+  80074b:	55                   	push   %ebp
+  80074c:	89 e5                	mov    %esp,%ebp
+  80074e:	57                   	push   %edi
+  80074f:	56                   	push   %esi
+  800750:	53                   	push   %ebx
+  800751:	83 ec 24             	sub    $0x24,%esp
+  800754:	8b 75 08             	mov    0x8(%ebp),%esi
+  800757:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80075a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80075d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80075e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800764:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800767:	50                   	push   %eax
+  800768:	e8 19 ff ff ff       	call   800686 <fd_lookup>
+  80076d:	89 c3                	mov    %eax,%ebx
+  80076f:	83 c4 10             	add    $0x10,%esp
+  800772:	85 c0                	test   %eax,%eax
+  800774:	78 05                	js     80077b <fd_close+0x30>
+	    || fd != fd2)
+  800776:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800779:	74 0f                	je     80078a <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80077b:	85 ff                	test   %edi,%edi
+  80077d:	0f 44 df             	cmove  %edi,%ebx
+}
+  800780:	89 d8                	mov    %ebx,%eax
+  800782:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800785:	5b                   	pop    %ebx
+  800786:	5e                   	pop    %esi
+  800787:	5f                   	pop    %edi
+  800788:	5d                   	pop    %ebp
+  800789:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80078a:	83 ec 08             	sub    $0x8,%esp
+  80078d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800790:	50                   	push   %eax
+  800791:	ff 36                	push   (%esi)
+  800793:	e8 40 ff ff ff       	call   8006d8 <dev_lookup>
+  800798:	89 c3                	mov    %eax,%ebx
+  80079a:	83 c4 10             	add    $0x10,%esp
+  80079d:	85 c0                	test   %eax,%eax
+  80079f:	78 1a                	js     8007bb <fd_close+0x70>
+		if (dev->dev_close)
+  8007a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8007a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007ac:	85 c0                	test   %eax,%eax
+  8007ae:	74 0b                	je     8007bb <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8007b0:	83 ec 0c             	sub    $0xc,%esp
+  8007b3:	56                   	push   %esi
+  8007b4:	ff d0                	call   *%eax
+  8007b6:	89 c3                	mov    %eax,%ebx
+  8007b8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007bb:	83 ec 08             	sub    $0x8,%esp
+  8007be:	56                   	push   %esi
+  8007bf:	6a 00                	push   $0x0
+  8007c1:	e8 6b fa ff ff       	call   800231 <sys_page_unmap>
+	return r;
+  8007c6:	83 c4 10             	add    $0x10,%esp
+  8007c9:	eb b5                	jmp    800780 <fd_close+0x35>
+
+008007cb <close>:
+
+int
+close(int fdnum)
+{
+  8007cb:	55                   	push   %ebp
+  8007cc:	89 e5                	mov    %esp,%ebp
+  8007ce:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007d4:	50                   	push   %eax
+  8007d5:	ff 75 08             	push   0x8(%ebp)
+  8007d8:	e8 a9 fe ff ff       	call   800686 <fd_lookup>
+  8007dd:	83 c4 10             	add    $0x10,%esp
+  8007e0:	85 c0                	test   %eax,%eax
+  8007e2:	79 02                	jns    8007e6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007e4:	c9                   	leave
+  8007e5:	c3                   	ret
+		return fd_close(fd, 1);
+  8007e6:	83 ec 08             	sub    $0x8,%esp
+  8007e9:	6a 01                	push   $0x1
+  8007eb:	ff 75 f4             	push   -0xc(%ebp)
+  8007ee:	e8 58 ff ff ff       	call   80074b <fd_close>
+  8007f3:	83 c4 10             	add    $0x10,%esp
+  8007f6:	eb ec                	jmp    8007e4 <close+0x19>
+
+008007f8 <close_all>:
+
+void
+close_all(void)
+{
+  8007f8:	55                   	push   %ebp
+  8007f9:	89 e5                	mov    %esp,%ebp
+  8007fb:	53                   	push   %ebx
+  8007fc:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800804:	83 ec 0c             	sub    $0xc,%esp
+  800807:	53                   	push   %ebx
+  800808:	e8 be ff ff ff       	call   8007cb <close>
+	for (i = 0; i < MAXFD; i++)
+  80080d:	83 c3 01             	add    $0x1,%ebx
+  800810:	83 c4 10             	add    $0x10,%esp
+  800813:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800819:	75 e9                	jne    800804 <close_all+0xc>
+}
+  80081b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80081e:	c9                   	leave
+  80081f:	c3                   	ret
+
+00800820 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800820:	55                   	push   %ebp
+  800821:	89 e5                	mov    %esp,%ebp
+  800823:	57                   	push   %edi
+  800824:	56                   	push   %esi
+  800825:	53                   	push   %ebx
+  800826:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80082c:	50                   	push   %eax
+  80082d:	ff 75 08             	push   0x8(%ebp)
+  800830:	e8 51 fe ff ff       	call   800686 <fd_lookup>
+  800835:	89 c3                	mov    %eax,%ebx
+  800837:	83 c4 10             	add    $0x10,%esp
+  80083a:	85 c0                	test   %eax,%eax
+  80083c:	78 7f                	js     8008bd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80083e:	83 ec 0c             	sub    $0xc,%esp
+  800841:	ff 75 0c             	push   0xc(%ebp)
+  800844:	e8 82 ff ff ff       	call   8007cb <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800849:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80084c:	c1 e6 0c             	shl    $0xc,%esi
+  80084f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800855:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800858:	89 3c 24             	mov    %edi,(%esp)
+  80085b:	e8 bf fd ff ff       	call   80061f <fd2data>
+  800860:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800862:	89 34 24             	mov    %esi,(%esp)
+  800865:	e8 b5 fd ff ff       	call   80061f <fd2data>
+  80086a:	83 c4 10             	add    $0x10,%esp
+  80086d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  800870:	89 d8                	mov    %ebx,%eax
+  800872:	c1 e8 16             	shr    $0x16,%eax
+  800875:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80087c:	a8 01                	test   $0x1,%al
+  80087e:	74 11                	je     800891 <dup+0x71>
+  800880:	89 d8                	mov    %ebx,%eax
+  800882:	c1 e8 0c             	shr    $0xc,%eax
+  800885:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80088c:	f6 c2 01             	test   $0x1,%dl
+  80088f:	75 36                	jne    8008c7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800891:	89 f8                	mov    %edi,%eax
+  800893:	c1 e8 0c             	shr    $0xc,%eax
+  800896:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80089d:	83 ec 0c             	sub    $0xc,%esp
+  8008a0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008a5:	50                   	push   %eax
+  8008a6:	56                   	push   %esi
+  8008a7:	6a 00                	push   $0x0
+  8008a9:	57                   	push   %edi
+  8008aa:	6a 00                	push   $0x0
+  8008ac:	e8 3e f9 ff ff       	call   8001ef <sys_page_map>
+  8008b1:	89 c3                	mov    %eax,%ebx
+  8008b3:	83 c4 20             	add    $0x20,%esp
+  8008b6:	85 c0                	test   %eax,%eax
+  8008b8:	78 33                	js     8008ed <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008bd:	89 d8                	mov    %ebx,%eax
+  8008bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c2:	5b                   	pop    %ebx
+  8008c3:	5e                   	pop    %esi
+  8008c4:	5f                   	pop    %edi
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008ce:	83 ec 0c             	sub    $0xc,%esp
+  8008d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008d6:	50                   	push   %eax
+  8008d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8008da:	6a 00                	push   $0x0
+  8008dc:	53                   	push   %ebx
+  8008dd:	6a 00                	push   $0x0
+  8008df:	e8 0b f9 ff ff       	call   8001ef <sys_page_map>
+  8008e4:	89 c3                	mov    %eax,%ebx
+  8008e6:	83 c4 20             	add    $0x20,%esp
+  8008e9:	85 c0                	test   %eax,%eax
+  8008eb:	79 a4                	jns    800891 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008ed:	83 ec 08             	sub    $0x8,%esp
+  8008f0:	56                   	push   %esi
+  8008f1:	6a 00                	push   $0x0
+  8008f3:	e8 39 f9 ff ff       	call   800231 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008f8:	83 c4 08             	add    $0x8,%esp
+  8008fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8008fe:	6a 00                	push   $0x0
+  800900:	e8 2c f9 ff ff       	call   800231 <sys_page_unmap>
+	return r;
+  800905:	83 c4 10             	add    $0x10,%esp
+  800908:	eb b3                	jmp    8008bd <dup+0x9d>
+
+0080090a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	56                   	push   %esi
+  80090e:	53                   	push   %ebx
+  80090f:	83 ec 18             	sub    $0x18,%esp
+  800912:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800915:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800918:	50                   	push   %eax
+  800919:	53                   	push   %ebx
+  80091a:	e8 67 fd ff ff       	call   800686 <fd_lookup>
+  80091f:	83 c4 10             	add    $0x10,%esp
+  800922:	85 c0                	test   %eax,%eax
+  800924:	78 3c                	js     800962 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800926:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800929:	83 ec 08             	sub    $0x8,%esp
+  80092c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80092f:	50                   	push   %eax
+  800930:	ff 36                	push   (%esi)
+  800932:	e8 a1 fd ff ff       	call   8006d8 <dev_lookup>
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	85 c0                	test   %eax,%eax
+  80093c:	78 24                	js     800962 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80093e:	8b 46 08             	mov    0x8(%esi),%eax
+  800941:	83 e0 03             	and    $0x3,%eax
+  800944:	83 f8 01             	cmp    $0x1,%eax
+  800947:	74 20                	je     800969 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800949:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80094c:	8b 40 08             	mov    0x8(%eax),%eax
+  80094f:	85 c0                	test   %eax,%eax
+  800951:	74 54                	je     8009a7 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800953:	83 ec 04             	sub    $0x4,%esp
+  800956:	ff 75 10             	push   0x10(%ebp)
+  800959:	ff 75 0c             	push   0xc(%ebp)
+  80095c:	56                   	push   %esi
+  80095d:	ff d0                	call   *%eax
+  80095f:	83 c4 10             	add    $0x10,%esp
+}
+  800962:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800965:	5b                   	pop    %ebx
+  800966:	5e                   	pop    %esi
+  800967:	5d                   	pop    %ebp
+  800968:	c3                   	ret
+  800969:	89 e2                	mov    %esp,%edx
+  80096b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800970:	29 d0                	sub    %edx,%eax
+  800972:	89 c2                	mov    %eax,%edx
+  800974:	c1 ea 0f             	shr    $0xf,%edx
+  800977:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80097c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800981:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800984:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80098b:	8b 40 48             	mov    0x48(%eax),%eax
+  80098e:	83 ec 04             	sub    $0x4,%esp
+  800991:	53                   	push   %ebx
+  800992:	50                   	push   %eax
+  800993:	68 f9 3a 80 00       	push   $0x803af9
+  800998:	e8 25 21 00 00       	call   802ac2 <cprintf>
+		return -E_INVAL;
+  80099d:	83 c4 10             	add    $0x10,%esp
+  8009a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a5:	eb bb                	jmp    800962 <read+0x58>
+		return -E_NOT_SUPP;
+  8009a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009ac:	eb b4                	jmp    800962 <read+0x58>
+
+008009ae <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	57                   	push   %edi
+  8009b2:	56                   	push   %esi
+  8009b3:	53                   	push   %ebx
+  8009b4:	83 ec 0c             	sub    $0xc,%esp
+  8009b7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009ba:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009bd:	85 f6                	test   %esi,%esi
+  8009bf:	74 30                	je     8009f1 <readn+0x43>
+  8009c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009c6:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009cb:	83 ec 04             	sub    $0x4,%esp
+  8009ce:	89 f2                	mov    %esi,%edx
+  8009d0:	29 c2                	sub    %eax,%edx
+  8009d2:	52                   	push   %edx
+  8009d3:	01 f8                	add    %edi,%eax
+  8009d5:	50                   	push   %eax
+  8009d6:	ff 75 08             	push   0x8(%ebp)
+  8009d9:	e8 2c ff ff ff       	call   80090a <read>
+		if (m < 0)
+  8009de:	83 c4 10             	add    $0x10,%esp
+  8009e1:	85 c0                	test   %eax,%eax
+  8009e3:	78 15                	js     8009fa <readn+0x4c>
+			return m;
+		if (m == 0)
+  8009e5:	74 11                	je     8009f8 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8009e7:	01 c3                	add    %eax,%ebx
+  8009e9:	89 d8                	mov    %ebx,%eax
+  8009eb:	39 f3                	cmp    %esi,%ebx
+  8009ed:	72 dc                	jb     8009cb <readn+0x1d>
+  8009ef:	eb 09                	jmp    8009fa <readn+0x4c>
+  8009f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f6:	eb 02                	jmp    8009fa <readn+0x4c>
+  8009f8:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8009fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009fd:	5b                   	pop    %ebx
+  8009fe:	5e                   	pop    %esi
+  8009ff:	5f                   	pop    %edi
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	56                   	push   %esi
+  800a06:	53                   	push   %ebx
+  800a07:	83 ec 18             	sub    $0x18,%esp
+  800a0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a10:	50                   	push   %eax
+  800a11:	53                   	push   %ebx
+  800a12:	e8 6f fc ff ff       	call   800686 <fd_lookup>
+  800a17:	83 c4 10             	add    $0x10,%esp
+  800a1a:	85 c0                	test   %eax,%eax
+  800a1c:	78 37                	js     800a55 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a1e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a21:	83 ec 08             	sub    $0x8,%esp
+  800a24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a27:	50                   	push   %eax
+  800a28:	ff 36                	push   (%esi)
+  800a2a:	e8 a9 fc ff ff       	call   8006d8 <dev_lookup>
+  800a2f:	83 c4 10             	add    $0x10,%esp
+  800a32:	85 c0                	test   %eax,%eax
+  800a34:	78 1f                	js     800a55 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a36:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a3a:	74 20                	je     800a5c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a42:	85 c0                	test   %eax,%eax
+  800a44:	74 54                	je     800a9a <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a46:	83 ec 04             	sub    $0x4,%esp
+  800a49:	ff 75 10             	push   0x10(%ebp)
+  800a4c:	ff 75 0c             	push   0xc(%ebp)
+  800a4f:	56                   	push   %esi
+  800a50:	ff d0                	call   *%eax
+  800a52:	83 c4 10             	add    $0x10,%esp
+}
+  800a55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a58:	5b                   	pop    %ebx
+  800a59:	5e                   	pop    %esi
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+  800a5c:	89 e2                	mov    %esp,%edx
+  800a5e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a63:	29 d0                	sub    %edx,%eax
+  800a65:	89 c2                	mov    %eax,%edx
+  800a67:	c1 ea 0f             	shr    $0xf,%edx
+  800a6a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a74:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a77:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a7e:	8b 40 48             	mov    0x48(%eax),%eax
+  800a81:	83 ec 04             	sub    $0x4,%esp
+  800a84:	53                   	push   %ebx
+  800a85:	50                   	push   %eax
+  800a86:	68 15 3b 80 00       	push   $0x803b15
+  800a8b:	e8 32 20 00 00       	call   802ac2 <cprintf>
+		return -E_INVAL;
+  800a90:	83 c4 10             	add    $0x10,%esp
+  800a93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a98:	eb bb                	jmp    800a55 <write+0x53>
+		return -E_NOT_SUPP;
+  800a9a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a9f:	eb b4                	jmp    800a55 <write+0x53>
+
+00800aa1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800aa1:	55                   	push   %ebp
+  800aa2:	89 e5                	mov    %esp,%ebp
+  800aa4:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800aa7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aaa:	50                   	push   %eax
+  800aab:	ff 75 08             	push   0x8(%ebp)
+  800aae:	e8 d3 fb ff ff       	call   800686 <fd_lookup>
+  800ab3:	83 c4 10             	add    $0x10,%esp
+  800ab6:	85 c0                	test   %eax,%eax
+  800ab8:	78 0e                	js     800ac8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800aba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800abd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac8:	c9                   	leave
+  800ac9:	c3                   	ret
+
+00800aca <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800aca:	55                   	push   %ebp
+  800acb:	89 e5                	mov    %esp,%ebp
+  800acd:	53                   	push   %ebx
+  800ace:	83 ec 1c             	sub    $0x1c,%esp
+  800ad1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ad4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ad7:	50                   	push   %eax
+  800ad8:	ff 75 08             	push   0x8(%ebp)
+  800adb:	e8 a6 fb ff ff       	call   800686 <fd_lookup>
+  800ae0:	83 c4 10             	add    $0x10,%esp
+  800ae3:	85 c0                	test   %eax,%eax
+  800ae5:	78 33                	js     800b1a <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800ae7:	83 fb 03             	cmp    $0x3,%ebx
+  800aea:	74 28                	je     800b14 <fcntl+0x4a>
+  800aec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af1:	83 fb 04             	cmp    $0x4,%ebx
+  800af4:	75 24                	jne    800b1a <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800af6:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800af9:	8b 41 08             	mov    0x8(%ecx),%eax
+  800afc:	80 e4 ef             	and    $0xef,%ah
+  800aff:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b02:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800b08:	09 d0                	or     %edx,%eax
+  800b0a:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b12:	eb 06                	jmp    800b1a <fcntl+0x50>
+		return fd->fd_omode;
+  800b14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b17:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1d:	c9                   	leave
+  800b1e:	c3                   	ret
+
+00800b1f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	56                   	push   %esi
+  800b23:	53                   	push   %ebx
+  800b24:	83 ec 18             	sub    $0x18,%esp
+  800b27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b2a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b2d:	50                   	push   %eax
+  800b2e:	53                   	push   %ebx
+  800b2f:	e8 52 fb ff ff       	call   800686 <fd_lookup>
+  800b34:	83 c4 10             	add    $0x10,%esp
+  800b37:	85 c0                	test   %eax,%eax
+  800b39:	78 34                	js     800b6f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b3b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b3e:	83 ec 08             	sub    $0x8,%esp
+  800b41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b44:	50                   	push   %eax
+  800b45:	ff 36                	push   (%esi)
+  800b47:	e8 8c fb ff ff       	call   8006d8 <dev_lookup>
+  800b4c:	83 c4 10             	add    $0x10,%esp
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	78 1c                	js     800b6f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b53:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b57:	74 1d                	je     800b76 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b5c:	8b 40 18             	mov    0x18(%eax),%eax
+  800b5f:	85 c0                	test   %eax,%eax
+  800b61:	74 51                	je     800bb4 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b63:	83 ec 08             	sub    $0x8,%esp
+  800b66:	ff 75 0c             	push   0xc(%ebp)
+  800b69:	56                   	push   %esi
+  800b6a:	ff d0                	call   *%eax
+  800b6c:	83 c4 10             	add    $0x10,%esp
+}
+  800b6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b72:	5b                   	pop    %ebx
+  800b73:	5e                   	pop    %esi
+  800b74:	5d                   	pop    %ebp
+  800b75:	c3                   	ret
+  800b76:	89 e2                	mov    %esp,%edx
+  800b78:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b7d:	29 d0                	sub    %edx,%eax
+  800b7f:	89 c2                	mov    %eax,%edx
+  800b81:	c1 ea 0f             	shr    $0xf,%edx
+  800b84:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8e:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800b91:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800b98:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b9b:	83 ec 04             	sub    $0x4,%esp
+  800b9e:	53                   	push   %ebx
+  800b9f:	50                   	push   %eax
+  800ba0:	68 d8 3a 80 00       	push   $0x803ad8
+  800ba5:	e8 18 1f 00 00       	call   802ac2 <cprintf>
+		return -E_INVAL;
+  800baa:	83 c4 10             	add    $0x10,%esp
+  800bad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb2:	eb bb                	jmp    800b6f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bb4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bb9:	eb b4                	jmp    800b6f <ftruncate+0x50>
+
+00800bbb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bbb:	55                   	push   %ebp
+  800bbc:	89 e5                	mov    %esp,%ebp
+  800bbe:	56                   	push   %esi
+  800bbf:	53                   	push   %ebx
+  800bc0:	83 ec 18             	sub    $0x18,%esp
+  800bc3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bc6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bc9:	50                   	push   %eax
+  800bca:	ff 75 08             	push   0x8(%ebp)
+  800bcd:	e8 b4 fa ff ff       	call   800686 <fd_lookup>
+  800bd2:	83 c4 10             	add    $0x10,%esp
+  800bd5:	85 c0                	test   %eax,%eax
+  800bd7:	78 53                	js     800c2c <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bd9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bdc:	83 ec 08             	sub    $0x8,%esp
+  800bdf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800be2:	50                   	push   %eax
+  800be3:	ff 36                	push   (%esi)
+  800be5:	e8 ee fa ff ff       	call   8006d8 <dev_lookup>
+  800bea:	83 c4 10             	add    $0x10,%esp
+  800bed:	85 c0                	test   %eax,%eax
+  800bef:	78 3b                	js     800c2c <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800bf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bf4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bf8:	74 39                	je     800c33 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800bfa:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800bfd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c04:	00 00 00 
+	stat->st_isdir = 0;
+  800c07:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c0e:	00 00 00 
+	stat->st_version = 0;
+  800c11:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c18:	00 00 00 
+	stat->st_dev = dev;
+  800c1b:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c21:	83 ec 08             	sub    $0x8,%esp
+  800c24:	53                   	push   %ebx
+  800c25:	56                   	push   %esi
+  800c26:	ff 50 14             	call   *0x14(%eax)
+  800c29:	83 c4 10             	add    $0x10,%esp
+}
+  800c2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c2f:	5b                   	pop    %ebx
+  800c30:	5e                   	pop    %esi
+  800c31:	5d                   	pop    %ebp
+  800c32:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c33:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c38:	eb f2                	jmp    800c2c <fstat+0x71>
+
+00800c3a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	56                   	push   %esi
+  800c3e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c3f:	83 ec 08             	sub    $0x8,%esp
+  800c42:	6a 00                	push   $0x0
+  800c44:	ff 75 08             	push   0x8(%ebp)
+  800c47:	e8 b7 01 00 00       	call   800e03 <open>
+  800c4c:	89 c3                	mov    %eax,%ebx
+  800c4e:	83 c4 10             	add    $0x10,%esp
+  800c51:	85 c0                	test   %eax,%eax
+  800c53:	78 1b                	js     800c70 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c55:	83 ec 08             	sub    $0x8,%esp
+  800c58:	ff 75 0c             	push   0xc(%ebp)
+  800c5b:	50                   	push   %eax
+  800c5c:	e8 5a ff ff ff       	call   800bbb <fstat>
+  800c61:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c63:	89 1c 24             	mov    %ebx,(%esp)
+  800c66:	e8 60 fb ff ff       	call   8007cb <close>
+	return r;
+  800c6b:	83 c4 10             	add    $0x10,%esp
+  800c6e:	89 f3                	mov    %esi,%ebx
+}
+  800c70:	89 d8                	mov    %ebx,%eax
+  800c72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c75:	5b                   	pop    %ebx
+  800c76:	5e                   	pop    %esi
+  800c77:	5d                   	pop    %ebp
+  800c78:	c3                   	ret
+
+00800c79 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+  800c7e:	89 c6                	mov    %eax,%esi
+  800c80:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800c82:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800c89:	74 27                	je     800cb2 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800c8b:	6a 07                	push   $0x7
+  800c8d:	68 00 60 80 00       	push   $0x806000
+  800c92:	56                   	push   %esi
+  800c93:	ff 35 00 50 80 00    	push   0x805000
+  800c99:	e8 23 2b 00 00       	call   8037c1 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800c9e:	83 c4 0c             	add    $0xc,%esp
+  800ca1:	6a 00                	push   $0x0
+  800ca3:	53                   	push   %ebx
+  800ca4:	6a 00                	push   $0x0
+  800ca6:	e8 86 28 00 00       	call   803531 <ipc_recv>
+}
+  800cab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cb2:	83 ec 0c             	sub    $0xc,%esp
+  800cb5:	6a 02                	push   $0x2
+  800cb7:	e8 6e 2b 00 00       	call   80382a <ipc_find_env>
+  800cbc:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cc1:	83 c4 10             	add    $0x10,%esp
+  800cc4:	eb c5                	jmp    800c8b <fsipc+0x12>
+
+00800cc6 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ccf:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cd2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cd7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cda:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800cdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ce9:	e8 8b ff ff ff       	call   800c79 <fsipc>
+}
+  800cee:	c9                   	leave
+  800cef:	c3                   	ret
+
+00800cf0 <devfile_flush>:
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf9:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cfc:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d06:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d0b:	e8 69 ff ff ff       	call   800c79 <fsipc>
+}
+  800d10:	c9                   	leave
+  800d11:	c3                   	ret
+
+00800d12 <devfile_stat>:
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	53                   	push   %ebx
+  800d16:	83 ec 04             	sub    $0x4,%esp
+  800d19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d1f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d22:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d31:	e8 43 ff ff ff       	call   800c79 <fsipc>
+  800d36:	85 c0                	test   %eax,%eax
+  800d38:	78 37                	js     800d71 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d3a:	83 ec 08             	sub    $0x8,%esp
+  800d3d:	68 00 60 80 00       	push   $0x806000
+  800d42:	53                   	push   %ebx
+  800d43:	e8 71 24 00 00       	call   8031b9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d48:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d4d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d53:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d58:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d5e:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d63:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d69:	83 c4 10             	add    $0x10,%esp
+  800d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d74:	c9                   	leave
+  800d75:	c3                   	ret
+
+00800d76 <devfile_write>:
+{
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	83 ec 0c             	sub    $0xc,%esp
+  800d7c:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d7f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800d84:	39 d0                	cmp    %edx,%eax
+  800d86:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8c:	8b 52 0c             	mov    0xc(%edx),%edx
+  800d8f:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800d95:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800d9a:	50                   	push   %eax
+  800d9b:	ff 75 0c             	push   0xc(%ebp)
+  800d9e:	68 08 60 80 00       	push   $0x806008
+  800da3:	e8 c1 25 00 00       	call   803369 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dad:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db2:	e8 c2 fe ff ff       	call   800c79 <fsipc>
+}
+  800db7:	c9                   	leave
+  800db8:	c3                   	ret
+
+00800db9 <devfile_read>:
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	53                   	push   %ebx
+  800dbd:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800dc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc3:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dc6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800dcb:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dce:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800dd3:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800dd8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ddd:	e8 97 fe ff ff       	call   800c79 <fsipc>
+  800de2:	89 c3                	mov    %eax,%ebx
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	78 14                	js     800dfc <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800de8:	83 ec 04             	sub    $0x4,%esp
+  800deb:	50                   	push   %eax
+  800dec:	68 00 60 80 00       	push   $0x806000
+  800df1:	ff 75 0c             	push   0xc(%ebp)
+  800df4:	e8 70 25 00 00       	call   803369 <memmove>
+	return r;
+  800df9:	83 c4 10             	add    $0x10,%esp
+}
+  800dfc:	89 d8                	mov    %ebx,%eax
+  800dfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e01:	c9                   	leave
+  800e02:	c3                   	ret
+
+00800e03 <open>:
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	53                   	push   %ebx
+  800e07:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800e0a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e0d:	50                   	push   %eax
+  800e0e:	e8 23 f8 ff ff       	call   800636 <fd_alloc>
+  800e13:	89 c3                	mov    %eax,%ebx
+  800e15:	83 c4 10             	add    $0x10,%esp
+  800e18:	85 c0                	test   %eax,%eax
+  800e1a:	78 2a                	js     800e46 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e1c:	83 ec 0c             	sub    $0xc,%esp
+  800e1f:	ff 75 08             	push   0x8(%ebp)
+  800e22:	e8 46 23 00 00       	call   80316d <strlen>
+  800e27:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e2a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e2f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e34:	7e 17                	jle    800e4d <open+0x4a>
+	fd_close(fd, 1);
+  800e36:	83 ec 08             	sub    $0x8,%esp
+  800e39:	6a 01                	push   $0x1
+  800e3b:	ff 75 f4             	push   -0xc(%ebp)
+  800e3e:	e8 08 f9 ff ff       	call   80074b <fd_close>
+	return r;
+  800e43:	83 c4 10             	add    $0x10,%esp
+}
+  800e46:	89 d8                	mov    %ebx,%eax
+  800e48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e4b:	c9                   	leave
+  800e4c:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e4d:	83 ec 08             	sub    $0x8,%esp
+  800e50:	ff 75 08             	push   0x8(%ebp)
+  800e53:	68 00 60 80 00       	push   $0x806000
+  800e58:	e8 5c 23 00 00       	call   8031b9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e60:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e65:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e68:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e6d:	e8 07 fe ff ff       	call   800c79 <fsipc>
+  800e72:	89 c3                	mov    %eax,%ebx
+  800e74:	83 c4 10             	add    $0x10,%esp
+  800e77:	85 c0                	test   %eax,%eax
+  800e79:	78 bb                	js     800e36 <open+0x33>
+	return fd2num(fd); 	
+  800e7b:	83 ec 0c             	sub    $0xc,%esp
+  800e7e:	ff 75 f4             	push   -0xc(%ebp)
+  800e81:	e8 89 f7 ff ff       	call   80060f <fd2num>
+  800e86:	89 c3                	mov    %eax,%ebx
+  800e88:	83 c4 10             	add    $0x10,%esp
+  800e8b:	eb b9                	jmp    800e46 <open+0x43>
+
+00800e8d <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800e8d:	55                   	push   %ebp
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	53                   	push   %ebx
+  800e91:	83 ec 1c             	sub    $0x1c,%esp
+  800e94:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e9a:	50                   	push   %eax
+  800e9b:	ff 75 08             	push   0x8(%ebp)
+  800e9e:	e8 e3 f7 ff ff       	call   800686 <fd_lookup>
+  800ea3:	83 c4 10             	add    $0x10,%esp
+  800ea6:	85 c0                	test   %eax,%eax
+  800ea8:	78 5a                	js     800f04 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800eaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ead:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800eb3:	39 10                	cmp    %edx,(%eax)
+  800eb5:	75 66                	jne    800f1d <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800eb7:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800ebe:	74 49                	je     800f09 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800ec0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ec3:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ec6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800ecb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ece:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800ed3:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ed9:	6a 07                	push   $0x7
+  800edb:	68 00 60 80 00       	push   $0x806000
+  800ee0:	6a 09                	push   $0x9
+  800ee2:	ff 35 00 50 80 00    	push   0x805000
+  800ee8:	e8 d4 28 00 00       	call   8037c1 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800eed:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800ef4:	6a 00                	push   $0x0
+  800ef6:	53                   	push   %ebx
+  800ef7:	ff 75 10             	push   0x10(%ebp)
+  800efa:	6a 00                	push   $0x0
+  800efc:	e8 fd 26 00 00       	call   8035fe <ipc_recv_pages>
+  800f01:	83 c4 20             	add    $0x20,%esp
+}
+  800f04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f07:	c9                   	leave
+  800f08:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f09:	83 ec 0c             	sub    $0xc,%esp
+  800f0c:	6a 02                	push   $0x2
+  800f0e:	e8 17 29 00 00       	call   80382a <ipc_find_env>
+  800f13:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f18:	83 c4 10             	add    $0x10,%esp
+  800f1b:	eb a3                	jmp    800ec0 <fmap+0x33>
+		return -E_INVAL;
+  800f1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f22:	eb e0                	jmp    800f04 <fmap+0x77>
+
+00800f24 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	53                   	push   %ebx
+  800f28:	83 ec 10             	sub    $0x10,%esp
+  800f2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f2e:	53                   	push   %ebx
+  800f2f:	e8 39 22 00 00       	call   80316d <strlen>
+  800f34:	83 c4 10             	add    $0x10,%esp
+  800f37:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f3c:	7f 25                	jg     800f63 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f3e:	83 ec 08             	sub    $0x8,%esp
+  800f41:	53                   	push   %ebx
+  800f42:	68 00 60 80 00       	push   $0x806000
+  800f47:	e8 6d 22 00 00       	call   8031b9 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f51:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f56:	e8 1e fd ff ff       	call   800c79 <fsipc>
+  800f5b:	83 c4 10             	add    $0x10,%esp
+}
+  800f5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f61:	c9                   	leave
+  800f62:	c3                   	ret
+		return -E_BAD_PATH;
+  800f63:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f68:	eb f4                	jmp    800f5e <remove+0x3a>
+
+00800f6a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f75:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f7a:	e8 fa fc ff ff       	call   800c79 <fsipc>
+}
+  800f7f:	c9                   	leave
+  800f80:	c3                   	ret
+
+00800f81 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800f87:	68 48 3b 80 00       	push   $0x803b48
+  800f8c:	ff 75 0c             	push   0xc(%ebp)
+  800f8f:	e8 25 22 00 00       	call   8031b9 <strcpy>
+	return 0;
+}
+  800f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f99:	c9                   	leave
+  800f9a:	c3                   	ret
+
+00800f9b <devsock_close>:
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	53                   	push   %ebx
+  800f9f:	83 ec 10             	sub    $0x10,%esp
+  800fa2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800fa5:	53                   	push   %ebx
+  800fa6:	e8 be 28 00 00       	call   803869 <pageref>
+  800fab:	89 c2                	mov    %eax,%edx
+  800fad:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fb5:	83 fa 01             	cmp    $0x1,%edx
+  800fb8:	74 05                	je     800fbf <devsock_close+0x24>
+}
+  800fba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fbd:	c9                   	leave
+  800fbe:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fbf:	83 ec 0c             	sub    $0xc,%esp
+  800fc2:	ff 73 0c             	push   0xc(%ebx)
+  800fc5:	e8 b0 05 00 00       	call   80157a <nsipc_close>
+  800fca:	83 c4 10             	add    $0x10,%esp
+  800fcd:	eb eb                	jmp    800fba <devsock_close+0x1f>
+
+00800fcf <devsock_write>:
+{
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	53                   	push   %ebx
+  800fd3:	83 ec 14             	sub    $0x14,%esp
+  800fd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fdc:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800fdf:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  800fe2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  800fe5:	8b 41 08             	mov    0x8(%ecx),%eax
+  800fe8:	c1 f8 09             	sar    $0x9,%eax
+  800feb:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  800fee:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  800ff4:	77 13                	ja     801009 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  800ff6:	50                   	push   %eax
+  800ff7:	52                   	push   %edx
+  800ff8:	53                   	push   %ebx
+  800ff9:	ff 71 0c             	push   0xc(%ecx)
+  800ffc:	e8 5c 06 00 00       	call   80165d <nsipc_send>
+  801001:	83 c4 10             	add    $0x10,%esp
+}
+  801004:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801007:	c9                   	leave
+  801008:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801009:	50                   	push   %eax
+  80100a:	6a 01                	push   $0x1
+  80100c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80100f:	50                   	push   %eax
+  801010:	ff 71 0c             	push   0xc(%ecx)
+  801013:	e8 a6 06 00 00       	call   8016be <nsipc_sendmsg>
+  801018:	83 c4 10             	add    $0x10,%esp
+  80101b:	eb e7                	jmp    801004 <devsock_write+0x35>
+
+0080101d <devsock_read>:
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	53                   	push   %ebx
+  801021:	83 ec 14             	sub    $0x14,%esp
+  801024:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801027:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80102a:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80102d:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801030:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801033:	8b 41 08             	mov    0x8(%ecx),%eax
+  801036:	c1 f8 09             	sar    $0x9,%eax
+  801039:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80103c:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801042:	77 13                	ja     801057 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801044:	50                   	push   %eax
+  801045:	52                   	push   %edx
+  801046:	53                   	push   %ebx
+  801047:	ff 71 0c             	push   0xc(%ecx)
+  80104a:	e8 9c 05 00 00       	call   8015eb <nsipc_recv>
+  80104f:	83 c4 10             	add    $0x10,%esp
+}
+  801052:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801055:	c9                   	leave
+  801056:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801057:	50                   	push   %eax
+  801058:	6a 01                	push   $0x1
+  80105a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80105d:	50                   	push   %eax
+  80105e:	ff 71 0c             	push   0xc(%ecx)
+  801061:	e8 02 0a 00 00       	call   801a68 <nsipc_recvmsg>
+  801066:	83 c4 10             	add    $0x10,%esp
+  801069:	eb e7                	jmp    801052 <devsock_read+0x35>
+
+0080106b <fd2sockid>:
+{
+  80106b:	55                   	push   %ebp
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801071:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801074:	52                   	push   %edx
+  801075:	50                   	push   %eax
+  801076:	e8 0b f6 ff ff       	call   800686 <fd_lookup>
+  80107b:	83 c4 10             	add    $0x10,%esp
+  80107e:	85 c0                	test   %eax,%eax
+  801080:	78 10                	js     801092 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801082:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801085:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80108b:	39 08                	cmp    %ecx,(%eax)
+  80108d:	75 05                	jne    801094 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80108f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801092:	c9                   	leave
+  801093:	c3                   	ret
+		return -E_NOT_SUPP;
+  801094:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801099:	eb f7                	jmp    801092 <fd2sockid+0x27>
+
+0080109b <sock_flags>:
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8010a1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8010a4:	52                   	push   %edx
+  8010a5:	50                   	push   %eax
+  8010a6:	e8 db f5 ff ff       	call   800686 <fd_lookup>
+  8010ab:	83 c4 10             	add    $0x10,%esp
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	78 0e                	js     8010c0 <sock_flags+0x25>
+  8010b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b5:	8b 40 08             	mov    0x8(%eax),%eax
+  8010b8:	c1 e8 09             	shr    $0x9,%eax
+  8010bb:	83 e0 08             	and    $0x8,%eax
+}
+  8010be:	c9                   	leave
+  8010bf:	c3                   	ret
+		return 0;
+  8010c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c5:	eb f7                	jmp    8010be <sock_flags+0x23>
+
+008010c7 <alloc_sockfd>:
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+  8010cc:	83 ec 1c             	sub    $0x1c,%esp
+  8010cf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010d4:	50                   	push   %eax
+  8010d5:	e8 5c f5 ff ff       	call   800636 <fd_alloc>
+  8010da:	89 c3                	mov    %eax,%ebx
+  8010dc:	83 c4 10             	add    $0x10,%esp
+  8010df:	85 c0                	test   %eax,%eax
+  8010e1:	78 43                	js     801126 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010e3:	83 ec 04             	sub    $0x4,%esp
+  8010e6:	68 07 04 00 00       	push   $0x407
+  8010eb:	ff 75 f4             	push   -0xc(%ebp)
+  8010ee:	6a 00                	push   $0x0
+  8010f0:	e8 b7 f0 ff ff       	call   8001ac <sys_page_alloc>
+  8010f5:	89 c3                	mov    %eax,%ebx
+  8010f7:	83 c4 10             	add    $0x10,%esp
+  8010fa:	85 c0                	test   %eax,%eax
+  8010fc:	78 28                	js     801126 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8010fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801101:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801107:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801109:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80110c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801113:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801116:	83 ec 0c             	sub    $0xc,%esp
+  801119:	50                   	push   %eax
+  80111a:	e8 f0 f4 ff ff       	call   80060f <fd2num>
+  80111f:	89 c3                	mov    %eax,%ebx
+  801121:	83 c4 10             	add    $0x10,%esp
+  801124:	eb 0c                	jmp    801132 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801126:	83 ec 0c             	sub    $0xc,%esp
+  801129:	56                   	push   %esi
+  80112a:	e8 4b 04 00 00       	call   80157a <nsipc_close>
+		return r;
+  80112f:	83 c4 10             	add    $0x10,%esp
+}
+  801132:	89 d8                	mov    %ebx,%eax
+  801134:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+
+0080113b <accept>:
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	56                   	push   %esi
+  80113f:	53                   	push   %ebx
+  801140:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801143:	89 f0                	mov    %esi,%eax
+  801145:	e8 21 ff ff ff       	call   80106b <fd2sockid>
+  80114a:	89 c3                	mov    %eax,%ebx
+  80114c:	85 c0                	test   %eax,%eax
+  80114e:	78 24                	js     801174 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801150:	89 f0                	mov    %esi,%eax
+  801152:	e8 44 ff ff ff       	call   80109b <sock_flags>
+  801157:	50                   	push   %eax
+  801158:	ff 75 10             	push   0x10(%ebp)
+  80115b:	ff 75 0c             	push   0xc(%ebp)
+  80115e:	53                   	push   %ebx
+  80115f:	e8 6b 03 00 00       	call   8014cf <nsipc_accept>
+  801164:	89 c3                	mov    %eax,%ebx
+  801166:	83 c4 10             	add    $0x10,%esp
+  801169:	85 c0                	test   %eax,%eax
+  80116b:	78 07                	js     801174 <accept+0x39>
+	return alloc_sockfd(r);
+  80116d:	e8 55 ff ff ff       	call   8010c7 <alloc_sockfd>
+  801172:	89 c3                	mov    %eax,%ebx
+}
+  801174:	89 d8                	mov    %ebx,%eax
+  801176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+
+0080117d <bind>:
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801183:	8b 45 08             	mov    0x8(%ebp),%eax
+  801186:	e8 e0 fe ff ff       	call   80106b <fd2sockid>
+  80118b:	85 c0                	test   %eax,%eax
+  80118d:	78 12                	js     8011a1 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80118f:	83 ec 04             	sub    $0x4,%esp
+  801192:	ff 75 10             	push   0x10(%ebp)
+  801195:	ff 75 0c             	push   0xc(%ebp)
+  801198:	50                   	push   %eax
+  801199:	e8 85 03 00 00       	call   801523 <nsipc_bind>
+  80119e:	83 c4 10             	add    $0x10,%esp
+}
+  8011a1:	c9                   	leave
+  8011a2:	c3                   	ret
+
+008011a3 <shutdown>:
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ac:	e8 ba fe ff ff       	call   80106b <fd2sockid>
+  8011b1:	85 c0                	test   %eax,%eax
+  8011b3:	78 0f                	js     8011c4 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011b5:	83 ec 08             	sub    $0x8,%esp
+  8011b8:	ff 75 0c             	push   0xc(%ebp)
+  8011bb:	50                   	push   %eax
+  8011bc:	e8 97 03 00 00       	call   801558 <nsipc_shutdown>
+  8011c1:	83 c4 10             	add    $0x10,%esp
+}
+  8011c4:	c9                   	leave
+  8011c5:	c3                   	ret
+
+008011c6 <connect>:
+{
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011cf:	e8 97 fe ff ff       	call   80106b <fd2sockid>
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	78 12                	js     8011ea <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011d8:	83 ec 04             	sub    $0x4,%esp
+  8011db:	ff 75 10             	push   0x10(%ebp)
+  8011de:	ff 75 0c             	push   0xc(%ebp)
+  8011e1:	50                   	push   %eax
+  8011e2:	e8 ad 03 00 00       	call   801594 <nsipc_connect>
+  8011e7:	83 c4 10             	add    $0x10,%esp
+}
+  8011ea:	c9                   	leave
+  8011eb:	c3                   	ret
+
+008011ec <listen>:
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011f5:	e8 71 fe ff ff       	call   80106b <fd2sockid>
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	78 0f                	js     80120d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8011fe:	83 ec 08             	sub    $0x8,%esp
+  801201:	ff 75 0c             	push   0xc(%ebp)
+  801204:	50                   	push   %eax
+  801205:	e8 bf 03 00 00       	call   8015c9 <nsipc_listen>
+  80120a:	83 c4 10             	add    $0x10,%esp
+}
+  80120d:	c9                   	leave
+  80120e:	c3                   	ret
+
+0080120f <sendmsg>:
+{
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	57                   	push   %edi
+  801213:	56                   	push   %esi
+  801214:	53                   	push   %ebx
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  801218:	8b 75 08             	mov    0x8(%ebp),%esi
+  80121b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80121e:	89 f0                	mov    %esi,%eax
+  801220:	e8 46 fe ff ff       	call   80106b <fd2sockid>
+  801225:	89 c3                	mov    %eax,%ebx
+  801227:	85 c0                	test   %eax,%eax
+  801229:	78 1c                	js     801247 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80122b:	89 f0                	mov    %esi,%eax
+  80122d:	e8 69 fe ff ff       	call   80109b <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801232:	0b 45 10             	or     0x10(%ebp),%eax
+  801235:	50                   	push   %eax
+  801236:	ff 77 0c             	push   0xc(%edi)
+  801239:	ff 77 08             	push   0x8(%edi)
+  80123c:	53                   	push   %ebx
+  80123d:	e8 7c 04 00 00       	call   8016be <nsipc_sendmsg>
+  801242:	89 c3                	mov    %eax,%ebx
+  801244:	83 c4 10             	add    $0x10,%esp
+}
+  801247:	89 d8                	mov    %ebx,%eax
+  801249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124c:	5b                   	pop    %ebx
+  80124d:	5e                   	pop    %esi
+  80124e:	5f                   	pop    %edi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+
+00801251 <recvmsg>:
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	57                   	push   %edi
+  801255:	56                   	push   %esi
+  801256:	53                   	push   %ebx
+  801257:	83 ec 0c             	sub    $0xc,%esp
+  80125a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80125d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801260:	89 f8                	mov    %edi,%eax
+  801262:	e8 04 fe ff ff       	call   80106b <fd2sockid>
+  801267:	89 c3                	mov    %eax,%ebx
+  801269:	85 c0                	test   %eax,%eax
+  80126b:	78 2a                	js     801297 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80126d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801274:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80127b:	89 f8                	mov    %edi,%eax
+  80127d:	e8 19 fe ff ff       	call   80109b <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801282:	0b 45 10             	or     0x10(%ebp),%eax
+  801285:	50                   	push   %eax
+  801286:	ff 76 0c             	push   0xc(%esi)
+  801289:	ff 76 08             	push   0x8(%esi)
+  80128c:	53                   	push   %ebx
+  80128d:	e8 d6 07 00 00       	call   801a68 <nsipc_recvmsg>
+  801292:	89 c3                	mov    %eax,%ebx
+  801294:	83 c4 10             	add    $0x10,%esp
+}
+  801297:	89 d8                	mov    %ebx,%eax
+  801299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129c:	5b                   	pop    %ebx
+  80129d:	5e                   	pop    %esi
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+
+008012a1 <sendfile>:
+{
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	56                   	push   %esi
+  8012a5:	53                   	push   %ebx
+  8012a6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8012a9:	89 f0                	mov    %esi,%eax
+  8012ab:	e8 bb fd ff ff       	call   80106b <fd2sockid>
+  8012b0:	89 c3                	mov    %eax,%ebx
+  8012b2:	85 c0                	test   %eax,%eax
+  8012b4:	78 1f                	js     8012d5 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012b6:	89 f0                	mov    %esi,%eax
+  8012b8:	e8 de fd ff ff       	call   80109b <sock_flags>
+  8012bd:	83 ec 0c             	sub    $0xc,%esp
+  8012c0:	50                   	push   %eax
+  8012c1:	ff 75 14             	push   0x14(%ebp)
+  8012c4:	ff 75 10             	push   0x10(%ebp)
+  8012c7:	ff 75 0c             	push   0xc(%ebp)
+  8012ca:	53                   	push   %ebx
+  8012cb:	e8 64 06 00 00       	call   801934 <nsipc_sendfile>
+  8012d0:	89 c3                	mov    %eax,%ebx
+  8012d2:	83 c4 20             	add    $0x20,%esp
+}
+  8012d5:	89 d8                	mov    %ebx,%eax
+  8012d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012da:	5b                   	pop    %ebx
+  8012db:	5e                   	pop    %esi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+
+008012de <evctl>:
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	53                   	push   %ebx
+  8012e2:	83 ec 04             	sub    $0x4,%esp
+  8012e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8012e8:	89 d8                	mov    %ebx,%eax
+  8012ea:	e8 7c fd ff ff       	call   80106b <fd2sockid>
+  8012ef:	85 c0                	test   %eax,%eax
+  8012f1:	78 10                	js     801303 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8012f3:	83 ec 04             	sub    $0x4,%esp
+  8012f6:	53                   	push   %ebx
+  8012f7:	ff 75 0c             	push   0xc(%ebp)
+  8012fa:	50                   	push   %eax
+  8012fb:	e8 d2 0b 00 00       	call   801ed2 <nsipc_evctl>
+  801300:	83 c4 10             	add    $0x10,%esp
+}
+  801303:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+00801308 <evwait>:
+{
+  801308:	55                   	push   %ebp
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80130e:	ff 75 10             	push   0x10(%ebp)
+  801311:	ff 75 0c             	push   0xc(%ebp)
+  801314:	ff 75 08             	push   0x8(%ebp)
+  801317:	e8 e0 0b 00 00       	call   801efc <nsipc_evwait>
+}
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+
+0080131e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801324:	ff 75 10             	push   0x10(%ebp)
+  801327:	ff 75 0c             	push   0xc(%ebp)
+  80132a:	ff 75 08             	push   0x8(%ebp)
+  80132d:	e8 31 0c 00 00       	call   801f63 <nsipc_socket>
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	85 c0                	test   %eax,%eax
+  801337:	78 05                	js     80133e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801339:	e8 89 fd ff ff       	call   8010c7 <alloc_sockfd>
+}
+  80133e:	c9                   	leave
+  80133f:	c3                   	ret
+
+00801340 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	53                   	push   %ebx
+  801344:	83 ec 04             	sub    $0x4,%esp
+  801347:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801349:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801350:	74 26                	je     801378 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801352:	6a 07                	push   $0x7
+  801354:	68 00 70 80 00       	push   $0x807000
+  801359:	53                   	push   %ebx
+  80135a:	ff 35 24 53 80 00    	push   0x805324
+  801360:	e8 5c 24 00 00       	call   8037c1 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801365:	83 c4 0c             	add    $0xc,%esp
+  801368:	6a 00                	push   $0x0
+  80136a:	6a 00                	push   $0x0
+  80136c:	6a 00                	push   $0x0
+  80136e:	e8 be 21 00 00       	call   803531 <ipc_recv>
+}
+  801373:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801376:	c9                   	leave
+  801377:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801378:	83 ec 0c             	sub    $0xc,%esp
+  80137b:	6a 03                	push   $0x3
+  80137d:	e8 a8 24 00 00       	call   80382a <ipc_find_env>
+  801382:	a3 24 53 80 00       	mov    %eax,0x805324
+  801387:	83 c4 10             	add    $0x10,%esp
+  80138a:	eb c6                	jmp    801352 <nsipc+0x12>
+
+0080138c <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	56                   	push   %esi
+  801390:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801391:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  801397:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80139c:	85 f6                	test   %esi,%esi
+  80139e:	75 33                	jne    8013d3 <nsbulk_map+0x47>
+  8013a0:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8013a5:	83 ec 04             	sub    $0x4,%esp
+  8013a8:	6a 07                	push   $0x7
+  8013aa:	53                   	push   %ebx
+  8013ab:	6a 00                	push   $0x0
+  8013ad:	e8 fa ed ff ff       	call   8001ac <sys_page_alloc>
+  8013b2:	83 c4 10             	add    $0x10,%esp
+  8013b5:	85 c0                	test   %eax,%eax
+  8013b7:	78 1a                	js     8013d3 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013b9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013bf:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013c5:	75 de                	jne    8013a5 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013c7:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013ce:	00 00 00 
+	return 0;
+  8013d1:	89 f0                	mov    %esi,%eax
+}
+  8013d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d6:	5b                   	pop    %ebx
+  8013d7:	5e                   	pop    %esi
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	c3                   	ret
+
+008013da <nsbulk_own>:
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	57                   	push   %edi
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+  8013e0:	83 ec 0c             	sub    $0xc,%esp
+  8013e3:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8013e5:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8013e8:	85 d2                	test   %edx,%edx
+  8013ea:	7f 0e                	jg     8013fa <nsbulk_own+0x20>
+	return 0;
+  8013ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f1:	eb 47                	jmp    80143a <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8013f3:	83 c3 01             	add    $0x1,%ebx
+  8013f6:	39 fb                	cmp    %edi,%ebx
+  8013f8:	7d 3b                	jge    801435 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8013fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8013ff:	89 d9                	mov    %ebx,%ecx
+  801401:	d3 e6                	shl    %cl,%esi
+  801403:	89 f0                	mov    %esi,%eax
+  801405:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  80140b:	74 e6                	je     8013f3 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80140d:	83 ec 04             	sub    $0x4,%esp
+  801410:	6a 07                	push   $0x7
+  801412:	89 d8                	mov    %ebx,%eax
+  801414:	c1 e0 0c             	shl    $0xc,%eax
+  801417:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80141c:	50                   	push   %eax
+  80141d:	6a 00                	push   $0x0
+  80141f:	e8 88 ed ff ff       	call   8001ac <sys_page_alloc>
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	85 c0                	test   %eax,%eax
+  801429:	78 0f                	js     80143a <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80142b:	f7 d6                	not    %esi
+  80142d:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801433:	eb be                	jmp    8013f3 <nsbulk_own+0x19>
+	return 0;
+  801435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143d:	5b                   	pop    %ebx
+  80143e:	5e                   	pop    %esi
+  80143f:	5f                   	pop    %edi
+  801440:	5d                   	pop    %ebp
+  801441:	c3                   	ret
+
+00801442 <nsipc_bulk>:
+{
+  801442:	55                   	push   %ebp
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	57                   	push   %edi
+  801446:	56                   	push   %esi
+  801447:	53                   	push   %ebx
+  801448:	83 ec 1c             	sub    $0x1c,%esp
+  80144b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80144e:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801450:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801456:	c1 fb 0c             	sar    $0xc,%ebx
+  801459:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80145c:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801463:	74 56                	je     8014bb <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801465:	85 ff                	test   %edi,%edi
+  801467:	7e 24                	jle    80148d <nsipc_bulk+0x4b>
+  801469:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80146f:	74 1c                	je     80148d <nsipc_bulk+0x4b>
+  801471:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801477:	c1 e3 0c             	shl    $0xc,%ebx
+  80147a:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80147f:	0f b6 10             	movzbl (%eax),%edx
+  801482:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801484:	05 00 10 00 00       	add    $0x1000,%eax
+  801489:	39 d8                	cmp    %ebx,%eax
+  80148b:	75 f2                	jne    80147f <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80148d:	83 ec 0c             	sub    $0xc,%esp
+  801490:	56                   	push   %esi
+  801491:	57                   	push   %edi
+  801492:	68 00 00 00 e0       	push   $0xe0000000
+  801497:	ff 75 e4             	push   -0x1c(%ebp)
+  80149a:	ff 35 24 53 80 00    	push   0x805324
+  8014a0:	e8 50 23 00 00       	call   8037f5 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8014a5:	83 c4 1c             	add    $0x1c,%esp
+  8014a8:	6a 00                	push   $0x0
+  8014aa:	6a 00                	push   $0x0
+  8014ac:	6a 00                	push   $0x0
+  8014ae:	e8 7e 20 00 00       	call   803531 <ipc_recv>
+}
+  8014b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b6:	5b                   	pop    %ebx
+  8014b7:	5e                   	pop    %esi
+  8014b8:	5f                   	pop    %edi
+  8014b9:	5d                   	pop    %ebp
+  8014ba:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014bb:	83 ec 0c             	sub    $0xc,%esp
+  8014be:	6a 03                	push   $0x3
+  8014c0:	e8 65 23 00 00       	call   80382a <ipc_find_env>
+  8014c5:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014ca:	83 c4 10             	add    $0x10,%esp
+  8014cd:	eb 96                	jmp    801465 <nsipc_bulk+0x23>
+
+008014cf <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	53                   	push   %ebx
+  8014d3:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014e1:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8014e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014eb:	e8 50 fe ff ff       	call   801340 <nsipc>
+  8014f0:	89 c3                	mov    %eax,%ebx
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	79 07                	jns    8014fd <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8014f6:	89 d8                	mov    %ebx,%eax
+  8014f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014fb:	c9                   	leave
+  8014fc:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8014fd:	83 ec 04             	sub    $0x4,%esp
+  801500:	ff 35 10 70 80 00    	push   0x807010
+  801506:	68 00 70 80 00       	push   $0x807000
+  80150b:	ff 75 0c             	push   0xc(%ebp)
+  80150e:	e8 56 1e 00 00       	call   803369 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801513:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801519:	8b 45 10             	mov    0x10(%ebp),%eax
+  80151c:	89 10                	mov    %edx,(%eax)
+  80151e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801521:	eb d3                	jmp    8014f6 <nsipc_accept+0x27>
+
+00801523 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	53                   	push   %ebx
+  801527:	83 ec 08             	sub    $0x8,%esp
+  80152a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80152d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801530:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801535:	53                   	push   %ebx
+  801536:	ff 75 0c             	push   0xc(%ebp)
+  801539:	68 04 70 80 00       	push   $0x807004
+  80153e:	e8 26 1e 00 00       	call   803369 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801543:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801549:	b8 02 00 00 00       	mov    $0x2,%eax
+  80154e:	e8 ed fd ff ff       	call   801340 <nsipc>
+}
+  801553:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801556:	c9                   	leave
+  801557:	c3                   	ret
+
+00801558 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80155e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801561:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801566:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801569:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80156e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801573:	e8 c8 fd ff ff       	call   801340 <nsipc>
+}
+  801578:	c9                   	leave
+  801579:	c3                   	ret
+
+0080157a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80157a:	55                   	push   %ebp
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801580:	8b 45 08             	mov    0x8(%ebp),%eax
+  801583:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801588:	b8 04 00 00 00       	mov    $0x4,%eax
+  80158d:	e8 ae fd ff ff       	call   801340 <nsipc>
+}
+  801592:	c9                   	leave
+  801593:	c3                   	ret
+
+00801594 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	53                   	push   %ebx
+  801598:	83 ec 08             	sub    $0x8,%esp
+  80159b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80159e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a1:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8015a6:	53                   	push   %ebx
+  8015a7:	ff 75 0c             	push   0xc(%ebp)
+  8015aa:	68 04 70 80 00       	push   $0x807004
+  8015af:	e8 b5 1d 00 00       	call   803369 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015b4:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015bf:	e8 7c fd ff ff       	call   801340 <nsipc>
+}
+  8015c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+
+008015c9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015da:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015df:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015e4:	e8 57 fd ff ff       	call   801340 <nsipc>
+}
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+
+008015eb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	56                   	push   %esi
+  8015ef:	53                   	push   %ebx
+  8015f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8015f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8015fb:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801601:	8b 45 14             	mov    0x14(%ebp),%eax
+  801604:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801609:	b8 07 00 00 00       	mov    $0x7,%eax
+  80160e:	e8 2d fd ff ff       	call   801340 <nsipc>
+  801613:	89 c3                	mov    %eax,%ebx
+  801615:	85 c0                	test   %eax,%eax
+  801617:	78 22                	js     80163b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801619:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80161e:	39 c6                	cmp    %eax,%esi
+  801620:	0f 4e c6             	cmovle %esi,%eax
+  801623:	39 c3                	cmp    %eax,%ebx
+  801625:	7f 1d                	jg     801644 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801627:	83 ec 04             	sub    $0x4,%esp
+  80162a:	53                   	push   %ebx
+  80162b:	68 00 70 80 00       	push   $0x807000
+  801630:	ff 75 0c             	push   0xc(%ebp)
+  801633:	e8 31 1d 00 00       	call   803369 <memmove>
+  801638:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80163b:	89 d8                	mov    %ebx,%eax
+  80163d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801640:	5b                   	pop    %ebx
+  801641:	5e                   	pop    %esi
+  801642:	5d                   	pop    %ebp
+  801643:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801644:	68 54 3b 80 00       	push   $0x803b54
+  801649:	68 69 3b 80 00       	push   $0x803b69
+  80164e:	68 b2 00 00 00       	push   $0xb2
+  801653:	68 7e 3b 80 00       	push   $0x803b7e
+  801658:	e8 8a 13 00 00       	call   8029e7 <_panic>
+
+0080165d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80165d:	55                   	push   %ebp
+  80165e:	89 e5                	mov    %esp,%ebp
+  801660:	53                   	push   %ebx
+  801661:	83 ec 04             	sub    $0x4,%esp
+  801664:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801667:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166a:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80166f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801675:	7f 2e                	jg     8016a5 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801677:	83 ec 04             	sub    $0x4,%esp
+  80167a:	53                   	push   %ebx
+  80167b:	ff 75 0c             	push   0xc(%ebp)
+  80167e:	68 0c 70 80 00       	push   $0x80700c
+  801683:	e8 e1 1c 00 00       	call   803369 <memmove>
+	nsipcbuf.send.req_size = size;
+  801688:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80168e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801691:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801696:	b8 08 00 00 00       	mov    $0x8,%eax
+  80169b:	e8 a0 fc ff ff       	call   801340 <nsipc>
+}
+  8016a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a3:	c9                   	leave
+  8016a4:	c3                   	ret
+	assert(size < 1600);
+  8016a5:	68 8a 3b 80 00       	push   $0x803b8a
+  8016aa:	68 69 3b 80 00       	push   $0x803b69
+  8016af:	68 bd 00 00 00       	push   $0xbd
+  8016b4:	68 7e 3b 80 00       	push   $0x803b7e
+  8016b9:	e8 29 13 00 00       	call   8029e7 <_panic>
+
+008016be <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016be:	55                   	push   %ebp
+  8016bf:	89 e5                	mov    %esp,%ebp
+  8016c1:	57                   	push   %edi
+  8016c2:	56                   	push   %esi
+  8016c3:	53                   	push   %ebx
+  8016c4:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016c7:	e8 c0 fc ff ff       	call   80138c <nsbulk_map>
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	78 55                	js     801725 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016d0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016d7:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016de:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8016e5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8016e8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016eb:	0f 8d 24 02 00 00    	jge    801915 <nsipc_sendmsg+0x257>
+  8016f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016f7:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8016fa:	89 d8                	mov    %ebx,%eax
+  8016fc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801701:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  801703:	83 ec 0c             	sub    $0xc,%esp
+  801706:	68 20 50 80 00       	push   $0x805020
+  80170b:	e8 5a 0f 00 00       	call   80266a <pgbatch_init>
+  801710:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801713:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801715:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  801718:	e9 82 00 00 00       	jmp    80179f <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80171d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801720:	85 db                	test   %ebx,%ebx
+  801722:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801725:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801728:	5b                   	pop    %ebx
+  801729:	5e                   	pop    %esi
+  80172a:	5f                   	pop    %edi
+  80172b:	5d                   	pop    %ebp
+  80172c:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80172d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801732:	29 c8                	sub    %ecx,%eax
+  801734:	39 d0                	cmp    %edx,%eax
+  801736:	0f 46 d0             	cmovbe %eax,%edx
+  801739:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80173b:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801741:	85 ff                	test   %edi,%edi
+  801743:	0f 49 c7             	cmovns %edi,%eax
+  801746:	c1 f8 0c             	sar    $0xc,%eax
+  801749:	ba 01 00 00 00       	mov    $0x1,%edx
+  80174e:	e8 87 fc ff ff       	call   8013da <nsbulk_own>
+  801753:	85 c0                	test   %eax,%eax
+  801755:	0f 88 17 01 00 00    	js     801872 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80175b:	83 ec 04             	sub    $0x4,%esp
+  80175e:	56                   	push   %esi
+  80175f:	ff 75 e0             	push   -0x20(%ebp)
+  801762:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801765:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80176a:	50                   	push   %eax
+  80176b:	e8 f9 1b 00 00       	call   803369 <memmove>
+  801770:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801773:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801776:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801779:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80177c:	0f 84 fd 00 00 00    	je     80187f <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801782:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801785:	01 f7                	add    %esi,%edi
+  801787:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80178a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80178d:	0f 8d 01 01 00 00    	jge    801894 <nsipc_sendmsg+0x1d6>
+  801793:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  801799:	0f 8f f0 00 00 00    	jg     80188f <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80179f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017a2:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8017a5:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8017a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017ab:	89 c2                	mov    %eax,%edx
+  8017ad:	03 13                	add    (%ebx),%edx
+  8017af:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017b2:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017b5:	29 c6                	sub    %eax,%esi
+  8017b7:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017bc:	29 f9                	sub    %edi,%ecx
+  8017be:	39 ce                	cmp    %ecx,%esi
+  8017c0:	89 ca                	mov    %ecx,%edx
+  8017c2:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017c5:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017c8:	89 f9                	mov    %edi,%ecx
+  8017ca:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017d3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017d8:	09 c8                	or     %ecx,%eax
+  8017da:	0f 85 4d ff ff ff    	jne    80172d <nsipc_sendmsg+0x6f>
+  8017e0:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017e6:	0f 86 41 ff ff ff    	jbe    80172d <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017ec:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8017f2:	85 ff                	test   %edi,%edi
+  8017f4:	0f 49 c7             	cmovns %edi,%eax
+  8017f7:	c1 f8 0c             	sar    $0xc,%eax
+  8017fa:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8017fc:	89 d1                	mov    %edx,%ecx
+  8017fe:	c1 e9 0c             	shr    $0xc,%ecx
+  801801:	01 c8                	add    %ecx,%eax
+  801803:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801806:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801809:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80180b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80180e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801813:	29 c8                	sub    %ecx,%eax
+  801815:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801818:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80181b:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80181d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801822:	89 f9                	mov    %edi,%ecx
+  801824:	d3 e0                	shl    %cl,%eax
+  801826:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80182c:	83 ec 08             	sub    $0x8,%esp
+  80182f:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801831:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801834:	50                   	push   %eax
+  801835:	6a 00                	push   $0x0
+  801837:	56                   	push   %esi
+  801838:	6a 00                	push   $0x0
+  80183a:	68 20 50 80 00       	push   $0x805020
+  80183f:	e8 e4 0e 00 00       	call   802728 <pgbatch_map>
+  801844:	83 c4 20             	add    $0x20,%esp
+  801847:	85 c0                	test   %eax,%eax
+  801849:	0f 88 ce fe ff ff    	js     80171d <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80184f:	83 c7 01             	add    $0x1,%edi
+  801852:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801858:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80185b:	39 c7                	cmp    %eax,%edi
+  80185d:	75 be                	jne    80181d <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80185f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801862:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801865:	89 d6                	mov    %edx,%esi
+  801867:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80186d:	e9 01 ff ff ff       	jmp    801773 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801872:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801875:	85 db                	test   %ebx,%ebx
+  801877:	0f 45 c3             	cmovne %ebx,%eax
+  80187a:	e9 a6 fe ff ff       	jmp    801725 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80187f:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  801883:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80188a:	e9 f3 fe ff ff       	jmp    801782 <nsipc_sendmsg+0xc4>
+  80188f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801892:	eb 03                	jmp    801897 <nsipc_sendmsg+0x1d9>
+  801894:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  801897:	83 ec 0c             	sub    $0xc,%esp
+  80189a:	68 20 50 80 00       	push   $0x805020
+  80189f:	e8 d4 0d 00 00       	call   802678 <pgbatch_flush>
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  8018a7:	85 c0                	test   %eax,%eax
+  8018a9:	78 50                	js     8018fb <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8018ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ae:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018b3:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018b9:	89 fb                	mov    %edi,%ebx
+  8018bb:	29 f3                	sub    %esi,%ebx
+  8018bd:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018c6:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018cb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018d0:	89 fa                	mov    %edi,%edx
+  8018d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018d7:	e8 66 fb ff ff       	call   801442 <nsipc_bulk>
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	78 28                	js     801908 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018e0:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8018e3:	39 c3                	cmp    %eax,%ebx
+  8018e5:	75 0c                	jne    8018f3 <nsipc_sendmsg+0x235>
+  8018e7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018ea:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8018ed:	0f 8f f2 fd ff ff    	jg     8016e5 <nsipc_sendmsg+0x27>
+		sent += r;
+  8018f3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018f6:	e9 2a fe ff ff       	jmp    801725 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018fb:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018fe:	85 db                	test   %ebx,%ebx
+  801900:	0f 45 c3             	cmovne %ebx,%eax
+  801903:	e9 1d fe ff ff       	jmp    801725 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801908:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80190b:	85 db                	test   %ebx,%ebx
+  80190d:	0f 45 c3             	cmovne %ebx,%eax
+  801910:	e9 10 fe ff ff       	jmp    801725 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801915:	83 ec 0c             	sub    $0xc,%esp
+  801918:	68 20 50 80 00       	push   $0x805020
+  80191d:	e8 48 0d 00 00       	call   80266a <pgbatch_init>
+  801922:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801925:	be 00 00 00 00       	mov    $0x0,%esi
+  80192a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80192f:	e9 63 ff ff ff       	jmp    801897 <nsipc_sendmsg+0x1d9>
+
+00801934 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801934:	55                   	push   %ebp
+  801935:	89 e5                	mov    %esp,%ebp
+  801937:	57                   	push   %edi
+  801938:	56                   	push   %esi
+  801939:	53                   	push   %ebx
+  80193a:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80193d:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  801944:	0f 84 c8 00 00 00    	je     801a12 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80194a:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801951:	0f 84 e4 00 00 00    	je     801a3b <nsipc_sendfile+0x107>
+{
+  801957:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80195c:	89 fb                	mov    %edi,%ebx
+  80195e:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801961:	0f 83 f0 00 00 00    	jae    801a57 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  801967:	89 fa                	mov    %edi,%edx
+  801969:	03 55 10             	add    0x10(%ebp),%edx
+  80196c:	89 d0                	mov    %edx,%eax
+  80196e:	c1 f8 1f             	sar    $0x1f,%eax
+  801971:	c1 e8 14             	shr    $0x14,%eax
+  801974:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  801977:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80197d:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80197f:	6a 10                	push   $0x10
+  801981:	68 00 20 01 e0       	push   $0xe0012000
+  801986:	52                   	push   %edx
+  801987:	ff 75 0c             	push   0xc(%ebp)
+  80198a:	e8 fe f4 ff ff       	call   800e8d <fmap>
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	85 c0                	test   %eax,%eax
+  801994:	0f 8e b8 00 00 00    	jle    801a52 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80199a:	39 c6                	cmp    %eax,%esi
+  80199c:	0f 8d b5 00 00 00    	jge    801a57 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8019a2:	29 f0                	sub    %esi,%eax
+  8019a4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8019a7:	29 da                	sub    %ebx,%edx
+  8019a9:	39 d0                	cmp    %edx,%eax
+  8019ab:	89 d3                	mov    %edx,%ebx
+  8019ad:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8019b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b3:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019b8:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019be:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019c4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019c7:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+  8019cf:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019d1:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019d8:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019db:	83 c0 01             	add    $0x1,%eax
+  8019de:	50                   	push   %eax
+  8019df:	68 00 10 01 e0       	push   $0xe0011000
+  8019e4:	6a 11                	push   $0x11
+  8019e6:	ff 35 24 53 80 00    	push   0x805324
+  8019ec:	e8 04 1e 00 00       	call   8037f5 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8019f1:	83 c4 1c             	add    $0x1c,%esp
+  8019f4:	6a 00                	push   $0x0
+  8019f6:	6a 00                	push   $0x0
+  8019f8:	6a 00                	push   $0x0
+  8019fa:	e8 32 1b 00 00       	call   803531 <ipc_recv>
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	78 5b                	js     801a61 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  801a06:	01 c7                	add    %eax,%edi
+		if (r < n)
+  801a08:	39 c3                	cmp    %eax,%ebx
+  801a0a:	0f 8e 4c ff ff ff    	jle    80195c <nsipc_sendfile+0x28>
+  801a10:	eb 45                	jmp    801a57 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a12:	83 ec 04             	sub    $0x4,%esp
+  801a15:	6a 07                	push   $0x7
+  801a17:	68 00 10 01 e0       	push   $0xe0011000
+  801a1c:	6a 00                	push   $0x0
+  801a1e:	e8 89 e7 ff ff       	call   8001ac <sys_page_alloc>
+  801a23:	89 c7                	mov    %eax,%edi
+  801a25:	83 c4 10             	add    $0x10,%esp
+  801a28:	85 c0                	test   %eax,%eax
+  801a2a:	78 2b                	js     801a57 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a2c:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a33:	00 00 00 
+  801a36:	e9 0f ff ff ff       	jmp    80194a <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a3b:	83 ec 0c             	sub    $0xc,%esp
+  801a3e:	6a 03                	push   $0x3
+  801a40:	e8 e5 1d 00 00       	call   80382a <ipc_find_env>
+  801a45:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a4a:	83 c4 10             	add    $0x10,%esp
+  801a4d:	e9 05 ff ff ff       	jmp    801957 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a52:	85 ff                	test   %edi,%edi
+  801a54:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a57:	89 f8                	mov    %edi,%eax
+  801a59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5c:	5b                   	pop    %ebx
+  801a5d:	5e                   	pop    %esi
+  801a5e:	5f                   	pop    %edi
+  801a5f:	5d                   	pop    %ebp
+  801a60:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a61:	85 ff                	test   %edi,%edi
+  801a63:	0f 44 f8             	cmove  %eax,%edi
+  801a66:	eb ef                	jmp    801a57 <nsipc_sendfile+0x123>
+
+00801a68 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a68:	55                   	push   %ebp
+  801a69:	89 e5                	mov    %esp,%ebp
+  801a6b:	57                   	push   %edi
+  801a6c:	56                   	push   %esi
+  801a6d:	53                   	push   %ebx
+  801a6e:	83 ec 1c             	sub    $0x1c,%esp
+  801a71:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a74:	e8 13 f9 ff ff       	call   80138c <nsbulk_map>
+  801a79:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	0f 88 ba 00 00 00    	js     801b3e <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a84:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a88:	0f 8e bb 00 00 00    	jle    801b49 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801a8e:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a93:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801a98:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801a9d:	89 f8                	mov    %edi,%eax
+  801a9f:	29 f0                	sub    %esi,%eax
+  801aa1:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801aa5:	39 c8                	cmp    %ecx,%eax
+  801aa7:	0f 47 c1             	cmova  %ecx,%eax
+  801aaa:	01 f0                	add    %esi,%eax
+  801aac:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801aae:	83 c2 01             	add    $0x1,%edx
+  801ab1:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801ab4:	7e 07                	jle    801abd <nsipc_recvmsg+0x55>
+  801ab6:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801abb:	7e e0                	jle    801a9d <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801abd:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801ac3:	c1 fa 0c             	sar    $0xc,%edx
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	e8 0a f9 ff ff       	call   8013da <nsbulk_own>
+  801ad0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ad3:	85 c0                	test   %eax,%eax
+  801ad5:	78 67                	js     801b3e <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801ad7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ada:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801adf:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801ae5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ae8:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801aed:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801af2:	89 f2                	mov    %esi,%edx
+  801af4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801af9:	e8 44 f9 ff ff       	call   801442 <nsipc_bulk>
+  801afe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	78 39                	js     801b3e <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801b05:	39 f0                	cmp    %esi,%eax
+  801b07:	7f 4a                	jg     801b53 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801b09:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b0e:	85 c0                	test   %eax,%eax
+  801b10:	7e 2c                	jle    801b3e <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b12:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b15:	29 fe                	sub    %edi,%esi
+  801b17:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b1a:	39 c6                	cmp    %eax,%esi
+  801b1c:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b1f:	83 ec 04             	sub    $0x4,%esp
+  801b22:	56                   	push   %esi
+  801b23:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b29:	50                   	push   %eax
+  801b2a:	ff 33                	push   (%ebx)
+  801b2c:	e8 38 18 00 00       	call   803369 <memmove>
+		n += m;
+  801b31:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b33:	83 c3 08             	add    $0x8,%ebx
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b3c:	7f d4                	jg     801b12 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b3e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b44:	5b                   	pop    %ebx
+  801b45:	5e                   	pop    %esi
+  801b46:	5f                   	pop    %edi
+  801b47:	5d                   	pop    %ebp
+  801b48:	c3                   	ret
+	int r, i, n, len = 0;
+  801b49:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4e:	e9 6a ff ff ff       	jmp    801abd <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b53:	68 60 3b 80 00       	push   $0x803b60
+  801b58:	68 69 3b 80 00       	push   $0x803b69
+  801b5d:	68 3b 01 00 00       	push   $0x13b
+  801b62:	68 7e 3b 80 00       	push   $0x803b7e
+  801b67:	e8 7b 0e 00 00       	call   8029e7 <_panic>
+
+00801b6c <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	57                   	push   %edi
+  801b70:	56                   	push   %esi
+  801b71:	53                   	push   %ebx
+  801b72:	83 ec 0c             	sub    $0xc,%esp
+  801b75:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b78:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b7b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b81:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801b86:	8b 07                	mov    (%edi),%eax
+  801b88:	a3 04 70 80 00       	mov    %eax,0x807004
+  801b8d:	8b 47 04             	mov    0x4(%edi),%eax
+  801b90:	a3 08 70 80 00       	mov    %eax,0x807008
+  801b95:	8b 47 08             	mov    0x8(%edi),%eax
+  801b98:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801b9d:	8b 47 0c             	mov    0xc(%edi),%eax
+  801ba0:	a3 10 70 80 00       	mov    %eax,0x807010
+  801ba5:	8b 47 10             	mov    0x10(%edi),%eax
+  801ba8:	a3 14 70 80 00       	mov    %eax,0x807014
+  801bad:	8b 47 14             	mov    0x14(%edi),%eax
+  801bb0:	a3 18 70 80 00       	mov    %eax,0x807018
+  801bb5:	8b 47 18             	mov    0x18(%edi),%eax
+  801bb8:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bbd:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bc0:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bc5:	8b 47 20             	mov    0x20(%edi),%eax
+  801bc8:	a3 24 70 80 00       	mov    %eax,0x807024
+  801bcd:	8b 47 24             	mov    0x24(%edi),%eax
+  801bd0:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bd5:	8b 47 28             	mov    0x28(%edi),%eax
+  801bd8:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801bdd:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801be0:	a3 30 70 80 00       	mov    %eax,0x807030
+  801be5:	8b 47 30             	mov    0x30(%edi),%eax
+  801be8:	a3 34 70 80 00       	mov    %eax,0x807034
+  801bed:	8b 47 34             	mov    0x34(%edi),%eax
+  801bf0:	a3 38 70 80 00       	mov    %eax,0x807038
+  801bf5:	8b 47 38             	mov    0x38(%edi),%eax
+  801bf8:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801bfd:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801c00:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801c05:	8b 06                	mov    (%esi),%eax
+  801c07:	a3 44 70 80 00       	mov    %eax,0x807044
+  801c0c:	8b 46 04             	mov    0x4(%esi),%eax
+  801c0f:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c14:	8b 46 08             	mov    0x8(%esi),%eax
+  801c17:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c1c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c1f:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c24:	8b 46 10             	mov    0x10(%esi),%eax
+  801c27:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c2c:	8b 46 14             	mov    0x14(%esi),%eax
+  801c2f:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c34:	8b 46 18             	mov    0x18(%esi),%eax
+  801c37:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c3c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c3f:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c44:	8b 46 20             	mov    0x20(%esi),%eax
+  801c47:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c4c:	8b 46 24             	mov    0x24(%esi),%eax
+  801c4f:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c54:	8b 46 28             	mov    0x28(%esi),%eax
+  801c57:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c5c:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c5f:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c64:	8b 46 30             	mov    0x30(%esi),%eax
+  801c67:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c6c:	8b 46 34             	mov    0x34(%esi),%eax
+  801c6f:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c74:	8b 46 38             	mov    0x38(%esi),%eax
+  801c77:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c7c:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c7f:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801c84:	8b 03                	mov    (%ebx),%eax
+  801c86:	a3 84 70 80 00       	mov    %eax,0x807084
+  801c8b:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c8e:	a3 88 70 80 00       	mov    %eax,0x807088
+  801c93:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c96:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801c9b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c9e:	a3 90 70 80 00       	mov    %eax,0x807090
+  801ca3:	8b 43 10             	mov    0x10(%ebx),%eax
+  801ca6:	a3 94 70 80 00       	mov    %eax,0x807094
+  801cab:	8b 43 14             	mov    0x14(%ebx),%eax
+  801cae:	a3 98 70 80 00       	mov    %eax,0x807098
+  801cb3:	8b 43 18             	mov    0x18(%ebx),%eax
+  801cb6:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801cbb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cbe:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cc3:	8b 43 20             	mov    0x20(%ebx),%eax
+  801cc6:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801ccb:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cce:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cd3:	8b 43 28             	mov    0x28(%ebx),%eax
+  801cd6:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801cdb:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801cde:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801ce3:	8b 43 30             	mov    0x30(%ebx),%eax
+  801ce6:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801ceb:	8b 43 34             	mov    0x34(%ebx),%eax
+  801cee:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801cf3:	8b 43 38             	mov    0x38(%ebx),%eax
+  801cf6:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801cfb:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801cfe:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801d03:	8b 45 18             	mov    0x18(%ebp),%eax
+  801d06:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801d0b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d10:	e8 2b f6 ff ff       	call   801340 <nsipc>
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	0f 88 ad 01 00 00    	js     801eca <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d1d:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d23:	89 17                	mov    %edx,(%edi)
+  801d25:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d2b:	89 57 04             	mov    %edx,0x4(%edi)
+  801d2e:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d34:	89 57 08             	mov    %edx,0x8(%edi)
+  801d37:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d3d:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d40:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d46:	89 57 10             	mov    %edx,0x10(%edi)
+  801d49:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d4f:	89 57 14             	mov    %edx,0x14(%edi)
+  801d52:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d58:	89 57 18             	mov    %edx,0x18(%edi)
+  801d5b:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d61:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d64:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d6a:	89 57 20             	mov    %edx,0x20(%edi)
+  801d6d:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d73:	89 57 24             	mov    %edx,0x24(%edi)
+  801d76:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d7c:	89 57 28             	mov    %edx,0x28(%edi)
+  801d7f:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801d85:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801d88:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801d8e:	89 57 30             	mov    %edx,0x30(%edi)
+  801d91:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801d97:	89 57 34             	mov    %edx,0x34(%edi)
+  801d9a:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801da0:	89 57 38             	mov    %edx,0x38(%edi)
+  801da3:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801da9:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801dac:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801db2:	89 16                	mov    %edx,(%esi)
+  801db4:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801dba:	89 56 04             	mov    %edx,0x4(%esi)
+  801dbd:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801dc3:	89 56 08             	mov    %edx,0x8(%esi)
+  801dc6:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dcc:	89 56 0c             	mov    %edx,0xc(%esi)
+  801dcf:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801dd5:	89 56 10             	mov    %edx,0x10(%esi)
+  801dd8:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801dde:	89 56 14             	mov    %edx,0x14(%esi)
+  801de1:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801de7:	89 56 18             	mov    %edx,0x18(%esi)
+  801dea:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801df0:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801df3:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801df9:	89 56 20             	mov    %edx,0x20(%esi)
+  801dfc:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801e02:	89 56 24             	mov    %edx,0x24(%esi)
+  801e05:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801e0b:	89 56 28             	mov    %edx,0x28(%esi)
+  801e0e:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e14:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e17:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e1d:	89 56 30             	mov    %edx,0x30(%esi)
+  801e20:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e26:	89 56 34             	mov    %edx,0x34(%esi)
+  801e29:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e2f:	89 56 38             	mov    %edx,0x38(%esi)
+  801e32:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e38:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e3b:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e41:	89 13                	mov    %edx,(%ebx)
+  801e43:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e49:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e4c:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e52:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e55:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e5b:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e5e:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e64:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e67:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e6d:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e70:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e76:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e79:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e7f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801e82:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801e88:	89 53 20             	mov    %edx,0x20(%ebx)
+  801e8b:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801e91:	89 53 24             	mov    %edx,0x24(%ebx)
+  801e94:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801e9a:	89 53 28             	mov    %edx,0x28(%ebx)
+  801e9d:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801ea3:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801ea6:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801eac:	89 53 30             	mov    %edx,0x30(%ebx)
+  801eaf:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801eb5:	89 53 34             	mov    %edx,0x34(%ebx)
+  801eb8:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801ebe:	89 53 38             	mov    %edx,0x38(%ebx)
+  801ec1:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801ec7:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801eca:	83 c4 0c             	add    $0xc,%esp
+  801ecd:	5b                   	pop    %ebx
+  801ece:	5e                   	pop    %esi
+  801ecf:	5f                   	pop    %edi
+  801ed0:	5d                   	pop    %ebp
+  801ed1:	c3                   	ret
+
+00801ed2 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801ed8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801edb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801ee0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee3:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801ee8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801eeb:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801ef0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ef5:	e8 46 f4 ff ff       	call   801340 <nsipc>
+}
+  801efa:	c9                   	leave
+  801efb:	c3                   	ret
+
+00801efc <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	56                   	push   %esi
+  801f00:	53                   	push   %ebx
+  801f01:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801f04:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801f0a:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f0d:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f12:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f17:	e8 24 f4 ff ff       	call   801340 <nsipc>
+  801f1c:	89 c3                	mov    %eax,%ebx
+  801f1e:	85 c0                	test   %eax,%eax
+  801f20:	7e 1f                	jle    801f41 <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f22:	39 c6                	cmp    %eax,%esi
+  801f24:	7c 24                	jl     801f4a <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f26:	83 ec 04             	sub    $0x4,%esp
+  801f29:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f30:	50                   	push   %eax
+  801f31:	68 00 70 80 00       	push   $0x807000
+  801f36:	ff 75 08             	push   0x8(%ebp)
+  801f39:	e8 2b 14 00 00       	call   803369 <memmove>
+  801f3e:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f41:	89 d8                	mov    %ebx,%eax
+  801f43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f46:	5b                   	pop    %ebx
+  801f47:	5e                   	pop    %esi
+  801f48:	5d                   	pop    %ebp
+  801f49:	c3                   	ret
+		assert(r <= max);
+  801f4a:	68 96 3b 80 00       	push   $0x803b96
+  801f4f:	68 69 3b 80 00       	push   $0x803b69
+  801f54:	68 6a 01 00 00       	push   $0x16a
+  801f59:	68 7e 3b 80 00       	push   $0x803b7e
+  801f5e:	e8 84 0a 00 00       	call   8029e7 <_panic>
+
+00801f63 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f63:	55                   	push   %ebp
+  801f64:	89 e5                	mov    %esp,%ebp
+  801f66:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f74:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f79:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f7c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f81:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f86:	e8 b5 f3 ff ff       	call   801340 <nsipc>
+}
+  801f8b:	c9                   	leave
+  801f8c:	c3                   	ret
+
+00801f8d <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801f8d:	55                   	push   %ebp
+  801f8e:	89 e5                	mov    %esp,%ebp
+  801f90:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801f93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f96:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801f9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fa0:	e8 9b f3 ff ff       	call   801340 <nsipc>
+}
+  801fa5:	c9                   	leave
+  801fa6:	c3                   	ret
+
+00801fa7 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801fa7:	55                   	push   %ebp
+  801fa8:	89 e5                	mov    %esp,%ebp
+  801faa:	53                   	push   %ebx
+  801fab:	83 ec 04             	sub    $0x4,%esp
+  801fae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fb1:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fb6:	e8 85 f3 ff ff       	call   801340 <nsipc>
+  801fbb:	85 c0                	test   %eax,%eax
+  801fbd:	78 50                	js     80200f <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fbf:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fc5:	89 13                	mov    %edx,(%ebx)
+  801fc7:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801fcd:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fd0:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801fd6:	89 53 08             	mov    %edx,0x8(%ebx)
+  801fd9:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801fdf:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801fe2:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801fe8:	89 53 10             	mov    %edx,0x10(%ebx)
+  801feb:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801ff1:	89 53 14             	mov    %edx,0x14(%ebx)
+  801ff4:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801ffa:	89 53 18             	mov    %edx,0x18(%ebx)
+  801ffd:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802003:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802006:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  80200c:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80200f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+
+00802014 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80201a:	6a 03                	push   $0x3
+  80201c:	e8 09 18 00 00       	call   80382a <ipc_find_env>
+  802021:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802026:	8b 45 08             	mov    0x8(%ebp),%eax
+  802029:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80202e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802033:	e8 08 f3 ff ff       	call   801340 <nsipc>
+  802038:	83 c4 10             	add    $0x10,%esp
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 0a                	js     802049 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80203f:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802044:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802049:	c9                   	leave
+  80204a:	c3                   	ret
+
+0080204b <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80204b:	55                   	push   %ebp
+  80204c:	89 e5                	mov    %esp,%ebp
+  80204e:	57                   	push   %edi
+  80204f:	56                   	push   %esi
+  802050:	53                   	push   %ebx
+  802051:	83 ec 1c             	sub    $0x1c,%esp
+  802054:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802057:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80205a:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80205f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802064:	89 e0                	mov    %esp,%eax
+  802066:	89 f2                	mov    %esi,%edx
+  802068:	29 c2                	sub    %eax,%edx
+  80206a:	89 d0                	mov    %edx,%eax
+  80206c:	c1 e8 0f             	shr    $0xf,%eax
+  80206f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802075:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802078:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80207f:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802082:	83 ec 0c             	sub    $0xc,%esp
+  802085:	ff 75 e0             	push   -0x20(%ebp)
+  802088:	e8 dc 17 00 00       	call   803869 <pageref>
+  80208d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802090:	83 c4 04             	add    $0x4,%esp
+  802093:	ff 75 dc             	push   -0x24(%ebp)
+  802096:	e8 ce 17 00 00       	call   803869 <pageref>
+  80209b:	89 e2                	mov    %esp,%edx
+  80209d:	89 f1                	mov    %esi,%ecx
+  80209f:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8020a1:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8020a4:	89 ca                	mov    %ecx,%edx
+  8020a6:	c1 ea 0f             	shr    $0xf,%edx
+  8020a9:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8020af:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020b2:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020b9:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020bc:	39 d7                	cmp    %edx,%edi
+  8020be:	74 40                	je     802100 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020c0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020c3:	75 9f                	jne    802064 <_pipeisclosed+0x19>
+  8020c5:	89 e2                	mov    %esp,%edx
+  8020c7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020cc:	29 d0                	sub    %edx,%eax
+  8020ce:	89 c2                	mov    %eax,%edx
+  8020d0:	c1 ea 0f             	shr    $0xf,%edx
+  8020d3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dd:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020e0:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020e7:	8b 40 58             	mov    0x58(%eax),%eax
+  8020ea:	6a 01                	push   $0x1
+  8020ec:	50                   	push   %eax
+  8020ed:	57                   	push   %edi
+  8020ee:	68 9f 3b 80 00       	push   $0x803b9f
+  8020f3:	e8 ca 09 00 00       	call   802ac2 <cprintf>
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	e9 5f ff ff ff       	jmp    80205f <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802100:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802103:	0f 94 c0             	sete   %al
+  802106:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80210c:	5b                   	pop    %ebx
+  80210d:	5e                   	pop    %esi
+  80210e:	5f                   	pop    %edi
+  80210f:	5d                   	pop    %ebp
+  802110:	c3                   	ret
+
+00802111 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	53                   	push   %ebx
+  802115:	83 ec 0c             	sub    $0xc,%esp
+  802118:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80211b:	53                   	push   %ebx
+  80211c:	6a 00                	push   $0x0
+  80211e:	e8 0e e1 ff ff       	call   800231 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802123:	89 1c 24             	mov    %ebx,(%esp)
+  802126:	e8 f4 e4 ff ff       	call   80061f <fd2data>
+  80212b:	83 c4 08             	add    $0x8,%esp
+  80212e:	50                   	push   %eax
+  80212f:	6a 00                	push   $0x0
+  802131:	e8 fb e0 ff ff       	call   800231 <sys_page_unmap>
+}
+  802136:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802139:	c9                   	leave
+  80213a:	c3                   	ret
+
+0080213b <devpipe_read>:
+{
+  80213b:	55                   	push   %ebp
+  80213c:	89 e5                	mov    %esp,%ebp
+  80213e:	57                   	push   %edi
+  80213f:	56                   	push   %esi
+  802140:	53                   	push   %ebx
+  802141:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802144:	ff 75 08             	push   0x8(%ebp)
+  802147:	e8 d3 e4 ff ff       	call   80061f <fd2data>
+  80214c:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80214e:	8b 70 04             	mov    0x4(%eax),%esi
+  802151:	8b 00                	mov    (%eax),%eax
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	39 f0                	cmp    %esi,%eax
+  802158:	75 36                	jne    802190 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80215a:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80215d:	89 da                	mov    %ebx,%edx
+  80215f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802162:	e8 e4 fe ff ff       	call   80204b <_pipeisclosed>
+  802167:	85 c0                	test   %eax,%eax
+  802169:	0f 85 d4 00 00 00    	jne    802243 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80216f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802174:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802178:	83 ec 04             	sub    $0x4,%esp
+  80217b:	6a ff                	push   $0xffffffff
+  80217d:	56                   	push   %esi
+  80217e:	57                   	push   %edi
+  80217f:	e8 26 e4 ff ff       	call   8005aa <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802184:	8b 73 04             	mov    0x4(%ebx),%esi
+  802187:	8b 03                	mov    (%ebx),%eax
+  802189:	83 c4 10             	add    $0x10,%esp
+  80218c:	39 c6                	cmp    %eax,%esi
+  80218e:	74 cd                	je     80215d <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802190:	8b 73 04             	mov    0x4(%ebx),%esi
+  802193:	8b 03                	mov    (%ebx),%eax
+  802195:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80219b:	29 c6                	sub    %eax,%esi
+  80219d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021a2:	f7 e6                	mul    %esi
+  8021a4:	c1 ea 0c             	shr    $0xc,%edx
+  8021a7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021ad:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8021af:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021b2:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021b6:	8b 0b                	mov    (%ebx),%ecx
+  8021b8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021bd:	f7 e1                	mul    %ecx
+  8021bf:	c1 ea 0b             	shr    $0xb,%edx
+  8021c2:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021c8:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021ca:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021cf:	29 cf                	sub    %ecx,%edi
+  8021d1:	39 f7                	cmp    %esi,%edi
+  8021d3:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021d6:	83 ec 04             	sub    $0x4,%esp
+  8021d9:	57                   	push   %edi
+  8021da:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021de:	50                   	push   %eax
+  8021df:	ff 75 0c             	push   0xc(%ebp)
+  8021e2:	e8 82 11 00 00       	call   803369 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8021e7:	83 c4 0c             	add    $0xc,%esp
+  8021ea:	89 f0                	mov    %esi,%eax
+  8021ec:	29 f8                	sub    %edi,%eax
+  8021ee:	50                   	push   %eax
+  8021ef:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021f2:	50                   	push   %eax
+  8021f3:	89 f8                	mov    %edi,%eax
+  8021f5:	03 45 0c             	add    0xc(%ebp),%eax
+  8021f8:	50                   	push   %eax
+  8021f9:	e8 6b 11 00 00       	call   803369 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8021fe:	8b 0b                	mov    (%ebx),%ecx
+  802200:	01 f1                	add    %esi,%ecx
+  802202:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802207:	f7 e1                	mul    %ecx
+  802209:	c1 ea 0c             	shr    $0xc,%edx
+  80220c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802212:	29 c1                	sub    %eax,%ecx
+  802214:	89 0b                	mov    %ecx,(%ebx)
+  802216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221b:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80221f:	83 c4 10             	add    $0x10,%esp
+  802222:	85 c0                	test   %eax,%eax
+  802224:	75 0a                	jne    802230 <devpipe_read+0xf5>
+	return n;
+  802226:	89 f0                	mov    %esi,%eax
+}
+  802228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80222b:	5b                   	pop    %ebx
+  80222c:	5e                   	pop    %esi
+  80222d:	5f                   	pop    %edi
+  80222e:	5d                   	pop    %ebp
+  80222f:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802230:	83 ec 08             	sub    $0x8,%esp
+  802233:	68 00 04 00 00       	push   $0x400
+  802238:	53                   	push   %ebx
+  802239:	e8 8e e3 ff ff       	call   8005cc <sys_futex_wake>
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	eb e3                	jmp    802226 <devpipe_read+0xeb>
+			return 0;
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+  802248:	eb de                	jmp    802228 <devpipe_read+0xed>
+
+0080224a <devpipe_write>:
+{
+  80224a:	55                   	push   %ebp
+  80224b:	89 e5                	mov    %esp,%ebp
+  80224d:	57                   	push   %edi
+  80224e:	56                   	push   %esi
+  80224f:	53                   	push   %ebx
+  802250:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802253:	ff 75 08             	push   0x8(%ebp)
+  802256:	e8 c4 e3 ff ff       	call   80061f <fd2data>
+  80225b:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80225d:	83 c4 10             	add    $0x10,%esp
+  802260:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802267:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80226c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802270:	0f 84 43 01 00 00    	je     8023b9 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802276:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802279:	8b 06                	mov    (%esi),%eax
+  80227b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802281:	29 c1                	sub    %eax,%ecx
+  802283:	89 c8                	mov    %ecx,%eax
+  802285:	f7 e7                	mul    %edi
+  802287:	c1 ea 0c             	shr    $0xc,%edx
+  80228a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802290:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802292:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802298:	75 52                	jne    8022ec <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80229a:	89 f2                	mov    %esi,%edx
+  80229c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229f:	e8 a7 fd ff ff       	call   80204b <_pipeisclosed>
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	0f 85 28 01 00 00    	jne    8023d4 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8022ac:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022ae:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022b1:	8b 06                	mov    (%esi),%eax
+  8022b3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022b9:	29 c1                	sub    %eax,%ecx
+  8022bb:	89 c8                	mov    %ecx,%eax
+  8022bd:	f7 e7                	mul    %edi
+  8022bf:	c1 ea 0c             	shr    $0xc,%edx
+  8022c2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022c8:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022ca:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022d0:	75 a4                	jne    802276 <devpipe_write+0x2c>
+  8022d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022d7:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022db:	83 ec 04             	sub    $0x4,%esp
+  8022de:	6a ff                	push   $0xffffffff
+  8022e0:	53                   	push   %ebx
+  8022e1:	56                   	push   %esi
+  8022e2:	e8 c3 e2 ff ff       	call   8005aa <sys_futex_wait>
+}
+  8022e7:	83 c4 10             	add    $0x10,%esp
+  8022ea:	eb 8a                	jmp    802276 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022ec:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022ef:	8b 06                	mov    (%esi),%eax
+  8022f1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022f7:	29 c1                	sub    %eax,%ecx
+  8022f9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022fe:	f7 e1                	mul    %ecx
+  802300:	c1 ea 0c             	shr    $0xc,%edx
+  802303:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802309:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80230b:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802310:	89 d8                	mov    %ebx,%eax
+  802312:	29 c8                	sub    %ecx,%eax
+  802314:	8b 55 10             	mov    0x10(%ebp),%edx
+  802317:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80231a:	29 ca                	sub    %ecx,%edx
+  80231c:	39 d0                	cmp    %edx,%eax
+  80231e:	0f 46 d0             	cmovbe %eax,%edx
+  802321:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802324:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802327:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80232c:	f7 e1                	mul    %ecx
+  80232e:	c1 ea 0b             	shr    $0xb,%edx
+  802331:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802337:	89 ca                	mov    %ecx,%edx
+  802339:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80233b:	29 d3                	sub    %edx,%ebx
+  80233d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802340:	39 c3                	cmp    %eax,%ebx
+  802342:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802345:	83 ec 04             	sub    $0x4,%esp
+  802348:	53                   	push   %ebx
+  802349:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80234c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80234f:	51                   	push   %ecx
+  802350:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802354:	50                   	push   %eax
+  802355:	e8 0f 10 00 00       	call   803369 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80235a:	83 c4 0c             	add    $0xc,%esp
+  80235d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802360:	29 d8                	sub    %ebx,%eax
+  802362:	50                   	push   %eax
+  802363:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802366:	01 cb                	add    %ecx,%ebx
+  802368:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80236b:	53                   	push   %ebx
+  80236c:	8d 46 10             	lea    0x10(%esi),%eax
+  80236f:	50                   	push   %eax
+  802370:	e8 f4 0f 00 00       	call   803369 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802375:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802378:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80237b:	01 c1                	add    %eax,%ecx
+  80237d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802382:	f7 e1                	mul    %ecx
+  802384:	c1 ea 0c             	shr    $0xc,%edx
+  802387:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80238d:	89 ca                	mov    %ecx,%edx
+  80238f:	29 c2                	sub    %eax,%edx
+  802391:	89 56 04             	mov    %edx,0x4(%esi)
+  802394:	b8 00 00 00 00       	mov    $0x0,%eax
+  802399:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	85 c0                	test   %eax,%eax
+  8023a2:	75 1a                	jne    8023be <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8023a4:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8023a7:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8023aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023ad:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023b0:	0f 82 c0 fe ff ff    	jb     802276 <devpipe_write+0x2c>
+  8023b6:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023bc:	eb 1b                	jmp    8023d9 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023be:	83 ec 08             	sub    $0x8,%esp
+  8023c1:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023c6:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023c9:	50                   	push   %eax
+  8023ca:	e8 fd e1 ff ff       	call   8005cc <sys_futex_wake>
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	eb d0                	jmp    8023a4 <devpipe_write+0x15a>
+				return 0;
+  8023d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023dc:	5b                   	pop    %ebx
+  8023dd:	5e                   	pop    %esi
+  8023de:	5f                   	pop    %edi
+  8023df:	5d                   	pop    %ebp
+  8023e0:	c3                   	ret
+
+008023e1 <devpipe_stat>:
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	56                   	push   %esi
+  8023e5:	53                   	push   %ebx
+  8023e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023e9:	83 ec 0c             	sub    $0xc,%esp
+  8023ec:	ff 75 08             	push   0x8(%ebp)
+  8023ef:	e8 2b e2 ff ff       	call   80061f <fd2data>
+  8023f4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023f6:	83 c4 08             	add    $0x8,%esp
+  8023f9:	68 b2 3b 80 00       	push   $0x803bb2
+  8023fe:	53                   	push   %ebx
+  8023ff:	e8 b5 0d 00 00       	call   8031b9 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802404:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802407:	8b 06                	mov    (%esi),%eax
+  802409:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80240f:	29 c1                	sub    %eax,%ecx
+  802411:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802416:	89 c8                	mov    %ecx,%eax
+  802418:	f7 e2                	mul    %edx
+  80241a:	c1 ea 0c             	shr    $0xc,%edx
+  80241d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802423:	29 d1                	sub    %edx,%ecx
+  802425:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80242b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802432:	00 00 00 
+	stat->st_dev = &devpipe;
+  802435:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  80243c:	40 80 00 
+}
+  80243f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802444:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802447:	5b                   	pop    %ebx
+  802448:	5e                   	pop    %esi
+  802449:	5d                   	pop    %ebp
+  80244a:	c3                   	ret
+
+0080244b <devpipe_poll>:
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	57                   	push   %edi
+  80244f:	56                   	push   %esi
+  802450:	53                   	push   %ebx
+  802451:	83 ec 18             	sub    $0x18,%esp
+  802454:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802457:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80245a:	57                   	push   %edi
+  80245b:	e8 bf e1 ff ff       	call   80061f <fd2data>
+  802460:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802462:	83 c4 10             	add    $0x10,%esp
+  802465:	89 f3                	mov    %esi,%ebx
+  802467:	83 e3 01             	and    $0x1,%ebx
+  80246a:	75 27                	jne    802493 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80246c:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802472:	75 48                	jne    8024bc <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802474:	89 ca                	mov    %ecx,%edx
+  802476:	89 f8                	mov    %edi,%eax
+  802478:	e8 ce fb ff ff       	call   80204b <_pipeisclosed>
+  80247d:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80247f:	89 d8                	mov    %ebx,%eax
+  802481:	83 c8 10             	or     $0x10,%eax
+  802484:	85 d2                	test   %edx,%edx
+  802486:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802489:	89 d8                	mov    %ebx,%eax
+  80248b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248e:	5b                   	pop    %ebx
+  80248f:	5e                   	pop    %esi
+  802490:	5f                   	pop    %edi
+  802491:	5d                   	pop    %ebp
+  802492:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802493:	8b 58 04             	mov    0x4(%eax),%ebx
+  802496:	8b 00                	mov    (%eax),%eax
+  802498:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80249e:	29 c3                	sub    %eax,%ebx
+  8024a0:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024a5:	89 d8                	mov    %ebx,%eax
+  8024a7:	f7 e2                	mul    %edx
+  8024a9:	c1 ea 0c             	shr    $0xc,%edx
+  8024ac:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024b2:	39 d3                	cmp    %edx,%ebx
+  8024b4:	0f 95 c3             	setne  %bl
+  8024b7:	0f b6 db             	movzbl %bl,%ebx
+  8024ba:	eb b0                	jmp    80246c <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024bc:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024bf:	8b 01                	mov    (%ecx),%eax
+  8024c1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024c7:	29 c6                	sub    %eax,%esi
+  8024c9:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024ce:	89 f0                	mov    %esi,%eax
+  8024d0:	f7 e2                	mul    %edx
+  8024d2:	c1 ea 0c             	shr    $0xc,%edx
+  8024d5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024db:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024dd:	89 d8                	mov    %ebx,%eax
+  8024df:	83 c8 04             	or     $0x4,%eax
+  8024e2:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8024e8:	0f 42 d8             	cmovb  %eax,%ebx
+  8024eb:	eb 87                	jmp    802474 <devpipe_poll+0x29>
+
+008024ed <pipe>:
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	56                   	push   %esi
+  8024f1:	53                   	push   %ebx
+  8024f2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024f8:	50                   	push   %eax
+  8024f9:	e8 38 e1 ff ff       	call   800636 <fd_alloc>
+  8024fe:	89 c3                	mov    %eax,%ebx
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	85 c0                	test   %eax,%eax
+  802505:	0f 88 23 01 00 00    	js     80262e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80250b:	83 ec 04             	sub    $0x4,%esp
+  80250e:	68 07 04 00 00       	push   $0x407
+  802513:	ff 75 f4             	push   -0xc(%ebp)
+  802516:	6a 00                	push   $0x0
+  802518:	e8 8f dc ff ff       	call   8001ac <sys_page_alloc>
+  80251d:	89 c3                	mov    %eax,%ebx
+  80251f:	83 c4 10             	add    $0x10,%esp
+  802522:	85 c0                	test   %eax,%eax
+  802524:	0f 88 04 01 00 00    	js     80262e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80252a:	83 ec 0c             	sub    $0xc,%esp
+  80252d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802530:	50                   	push   %eax
+  802531:	e8 00 e1 ff ff       	call   800636 <fd_alloc>
+  802536:	89 c3                	mov    %eax,%ebx
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	0f 88 db 00 00 00    	js     80261e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802543:	83 ec 04             	sub    $0x4,%esp
+  802546:	68 07 04 00 00       	push   $0x407
+  80254b:	ff 75 f0             	push   -0x10(%ebp)
+  80254e:	6a 00                	push   $0x0
+  802550:	e8 57 dc ff ff       	call   8001ac <sys_page_alloc>
+  802555:	89 c3                	mov    %eax,%ebx
+  802557:	83 c4 10             	add    $0x10,%esp
+  80255a:	85 c0                	test   %eax,%eax
+  80255c:	0f 88 bc 00 00 00    	js     80261e <pipe+0x131>
+	va = fd2data(fd0);
+  802562:	83 ec 0c             	sub    $0xc,%esp
+  802565:	ff 75 f4             	push   -0xc(%ebp)
+  802568:	e8 b2 e0 ff ff       	call   80061f <fd2data>
+  80256d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80256f:	83 c4 0c             	add    $0xc,%esp
+  802572:	68 07 04 00 00       	push   $0x407
+  802577:	50                   	push   %eax
+  802578:	6a 00                	push   $0x0
+  80257a:	e8 2d dc ff ff       	call   8001ac <sys_page_alloc>
+  80257f:	89 c3                	mov    %eax,%ebx
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	85 c0                	test   %eax,%eax
+  802586:	0f 88 82 00 00 00    	js     80260e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80258c:	83 ec 0c             	sub    $0xc,%esp
+  80258f:	ff 75 f0             	push   -0x10(%ebp)
+  802592:	e8 88 e0 ff ff       	call   80061f <fd2data>
+  802597:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80259e:	50                   	push   %eax
+  80259f:	6a 00                	push   $0x0
+  8025a1:	56                   	push   %esi
+  8025a2:	6a 00                	push   $0x0
+  8025a4:	e8 46 dc ff ff       	call   8001ef <sys_page_map>
+  8025a9:	89 c3                	mov    %eax,%ebx
+  8025ab:	83 c4 20             	add    $0x20,%esp
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	78 4e                	js     802600 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025b2:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025b7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025ba:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025bf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025c6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025c9:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025cb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025ce:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025d5:	83 ec 0c             	sub    $0xc,%esp
+  8025d8:	ff 75 f4             	push   -0xc(%ebp)
+  8025db:	e8 2f e0 ff ff       	call   80060f <fd2num>
+  8025e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025e3:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025e5:	83 c4 04             	add    $0x4,%esp
+  8025e8:	ff 75 f0             	push   -0x10(%ebp)
+  8025eb:	e8 1f e0 ff ff       	call   80060f <fd2num>
+  8025f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025f3:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025f6:	83 c4 10             	add    $0x10,%esp
+  8025f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025fe:	eb 2e                	jmp    80262e <pipe+0x141>
+	sys_page_unmap(0, va);
+  802600:	83 ec 08             	sub    $0x8,%esp
+  802603:	56                   	push   %esi
+  802604:	6a 00                	push   $0x0
+  802606:	e8 26 dc ff ff       	call   800231 <sys_page_unmap>
+  80260b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80260e:	83 ec 08             	sub    $0x8,%esp
+  802611:	ff 75 f0             	push   -0x10(%ebp)
+  802614:	6a 00                	push   $0x0
+  802616:	e8 16 dc ff ff       	call   800231 <sys_page_unmap>
+  80261b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80261e:	83 ec 08             	sub    $0x8,%esp
+  802621:	ff 75 f4             	push   -0xc(%ebp)
+  802624:	6a 00                	push   $0x0
+  802626:	e8 06 dc ff ff       	call   800231 <sys_page_unmap>
+  80262b:	83 c4 10             	add    $0x10,%esp
+}
+  80262e:	89 d8                	mov    %ebx,%eax
+  802630:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802633:	5b                   	pop    %ebx
+  802634:	5e                   	pop    %esi
+  802635:	5d                   	pop    %ebp
+  802636:	c3                   	ret
+
+00802637 <pipeisclosed>:
+{
+  802637:	55                   	push   %ebp
+  802638:	89 e5                	mov    %esp,%ebp
+  80263a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80263d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802640:	50                   	push   %eax
+  802641:	ff 75 08             	push   0x8(%ebp)
+  802644:	e8 3d e0 ff ff       	call   800686 <fd_lookup>
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	85 c0                	test   %eax,%eax
+  80264e:	78 18                	js     802668 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802650:	83 ec 0c             	sub    $0xc,%esp
+  802653:	ff 75 f4             	push   -0xc(%ebp)
+  802656:	e8 c4 df ff ff       	call   80061f <fd2data>
+  80265b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80265d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802660:	e8 e6 f9 ff ff       	call   80204b <_pipeisclosed>
+  802665:	83 c4 10             	add    $0x10,%esp
+}
+  802668:	c9                   	leave
+  802669:	c3                   	ret
+
+0080266a <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80266d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802670:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802676:	5d                   	pop    %ebp
+  802677:	c3                   	ret
+
+00802678 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  802678:	55                   	push   %ebp
+  802679:	89 e5                	mov    %esp,%ebp
+  80267b:	53                   	push   %ebx
+  80267c:	83 ec 04             	sub    $0x4,%esp
+  80267f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802682:	8b 03                	mov    (%ebx),%eax
+  802684:	85 c0                	test   %eax,%eax
+  802686:	75 05                	jne    80268d <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  802688:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80268b:	c9                   	leave
+  80268c:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80268d:	83 ec 08             	sub    $0x8,%esp
+  802690:	50                   	push   %eax
+  802691:	8d 43 04             	lea    0x4(%ebx),%eax
+  802694:	50                   	push   %eax
+  802695:	e8 e7 dd ff ff       	call   800481 <sys_page_batch>
+	pb->pb_n = 0;
+  80269a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8026a0:	83 c4 10             	add    $0x10,%esp
+  8026a3:	eb e3                	jmp    802688 <pgbatch_flush+0x10>
+
+008026a5 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8026a5:	55                   	push   %ebp
+  8026a6:	89 e5                	mov    %esp,%ebp
+  8026a8:	56                   	push   %esi
+  8026a9:	53                   	push   %ebx
+  8026aa:	89 c3                	mov    %eax,%ebx
+  8026ac:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026ae:	83 38 20             	cmpl   $0x20,(%eax)
+  8026b1:	74 2c                	je     8026df <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026b3:	8b 03                	mov    (%ebx),%eax
+  8026b5:	8d 50 01             	lea    0x1(%eax),%edx
+  8026b8:	89 13                	mov    %edx,(%ebx)
+  8026ba:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026bd:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026c1:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026c3:	83 ec 04             	sub    $0x4,%esp
+  8026c6:	6a 18                	push   $0x18
+  8026c8:	6a 00                	push   $0x0
+  8026ca:	50                   	push   %eax
+  8026cb:	e8 64 0c 00 00       	call   803334 <memset>
+	return 0;
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026db:	5b                   	pop    %ebx
+  8026dc:	5e                   	pop    %esi
+  8026dd:	5d                   	pop    %ebp
+  8026de:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026df:	83 ec 0c             	sub    $0xc,%esp
+  8026e2:	50                   	push   %eax
+  8026e3:	e8 90 ff ff ff       	call   802678 <pgbatch_flush>
+  8026e8:	83 c4 10             	add    $0x10,%esp
+  8026eb:	85 c0                	test   %eax,%eax
+  8026ed:	79 c4                	jns    8026b3 <pgbatch_slot+0xe>
+  8026ef:	eb e7                	jmp    8026d8 <pgbatch_slot+0x33>
+
+008026f1 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8026f1:	55                   	push   %ebp
+  8026f2:	89 e5                	mov    %esp,%ebp
+  8026f4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8026f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026fd:	e8 a3 ff ff ff       	call   8026a5 <pgbatch_slot>
+  802702:	85 c0                	test   %eax,%eax
+  802704:	78 20                	js     802726 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  802706:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802709:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80270f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802712:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802715:	8b 55 10             	mov    0x10(%ebp),%edx
+  802718:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80271b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80271e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802721:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802726:	c9                   	leave
+  802727:	c3                   	ret
+
+00802728 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  802728:	55                   	push   %ebp
+  802729:	89 e5                	mov    %esp,%ebp
+  80272b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80272e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802731:	8b 45 08             	mov    0x8(%ebp),%eax
+  802734:	e8 6c ff ff ff       	call   8026a5 <pgbatch_slot>
+  802739:	85 c0                	test   %eax,%eax
+  80273b:	78 2c                	js     802769 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80273d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802740:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802746:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802749:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80274c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80274f:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802752:	8b 55 14             	mov    0x14(%ebp),%edx
+  802755:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  802758:	8b 55 18             	mov    0x18(%ebp),%edx
+  80275b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80275e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802761:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802764:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802769:	c9                   	leave
+  80276a:	c3                   	ret
+
+0080276b <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80276b:	55                   	push   %ebp
+  80276c:	89 e5                	mov    %esp,%ebp
+  80276e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802771:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802774:	8b 45 08             	mov    0x8(%ebp),%eax
+  802777:	e8 29 ff ff ff       	call   8026a5 <pgbatch_slot>
+  80277c:	85 c0                	test   %eax,%eax
+  80277e:	78 1a                	js     80279a <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  802780:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802783:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  802789:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80278c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80278f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802792:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+
+0080279c <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80279c:	55                   	push   %ebp
+  80279d:	89 e5                	mov    %esp,%ebp
+  80279f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027a2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a8:	e8 f8 fe ff ff       	call   8026a5 <pgbatch_slot>
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	78 20                	js     8027d1 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b4:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027bd:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027c3:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027c6:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027c9:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027d1:	c9                   	leave
+  8027d2:	c3                   	ret
+
+008027d3 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027d3:	55                   	push   %ebp
+  8027d4:	89 e5                	mov    %esp,%ebp
+  8027d6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027d9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027df:	e8 c1 fe ff ff       	call   8026a5 <pgbatch_slot>
+  8027e4:	85 c0                	test   %eax,%eax
+  8027e6:	78 26                	js     80280e <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8027e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027eb:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8027f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027f4:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8027f7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027fa:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8027fd:	8b 55 14             	mov    0x14(%ebp),%edx
+  802800:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  802803:	8b 55 18             	mov    0x18(%ebp),%edx
+  802806:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802809:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80280e:	c9                   	leave
+  80280f:	c3                   	ret
+
+00802810 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802810:	b8 00 00 00 00       	mov    $0x0,%eax
+  802815:	c3                   	ret
+
+00802816 <devcons_poll>:
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	53                   	push   %ebx
+  80281a:	83 ec 04             	sub    $0x4,%esp
+  80281d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802820:	89 da                	mov    %ebx,%edx
+  802822:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802825:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80282c:	74 0c                	je     80283a <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80282e:	89 d8                	mov    %ebx,%eax
+  802830:	83 e0 01             	and    $0x1,%eax
+  802833:	09 d0                	or     %edx,%eax
+}
+  802835:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80283a:	e8 cf d8 ff ff       	call   80010e <sys_cgetc>
+  80283f:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802844:	89 da                	mov    %ebx,%edx
+  802846:	83 e2 04             	and    $0x4,%edx
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	74 e6                	je     802833 <devcons_poll+0x1d>
+  80284d:	eb df                	jmp    80282e <devcons_poll+0x18>
+
+0080284f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80284f:	55                   	push   %ebp
+  802850:	89 e5                	mov    %esp,%ebp
+  802852:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802855:	68 be 3b 80 00       	push   $0x803bbe
+  80285a:	ff 75 0c             	push   0xc(%ebp)
+  80285d:	e8 57 09 00 00       	call   8031b9 <strcpy>
+	return 0;
+}
+  802862:	b8 00 00 00 00       	mov    $0x0,%eax
+  802867:	c9                   	leave
+  802868:	c3                   	ret
+
+00802869 <devcons_write>:
+{
+  802869:	55                   	push   %ebp
+  80286a:	89 e5                	mov    %esp,%ebp
+  80286c:	57                   	push   %edi
+  80286d:	56                   	push   %esi
+  80286e:	53                   	push   %ebx
+  80286f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802875:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802878:	85 ff                	test   %edi,%edi
+  80287a:	74 51                	je     8028cd <devcons_write+0x64>
+  80287c:	be 00 00 00 00       	mov    $0x0,%esi
+  802881:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  802886:	89 fb                	mov    %edi,%ebx
+  802888:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80288a:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80288f:	39 d3                	cmp    %edx,%ebx
+  802891:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802894:	83 ec 04             	sub    $0x4,%esp
+  802897:	53                   	push   %ebx
+  802898:	03 45 0c             	add    0xc(%ebp),%eax
+  80289b:	50                   	push   %eax
+  80289c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028a2:	50                   	push   %eax
+  8028a3:	e8 c1 0a 00 00       	call   803369 <memmove>
+		sys_cputs(buf, m);
+  8028a8:	83 c4 08             	add    $0x8,%esp
+  8028ab:	53                   	push   %ebx
+  8028ac:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028b2:	50                   	push   %eax
+  8028b3:	e8 38 d8 ff ff       	call   8000f0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028b8:	01 de                	add    %ebx,%esi
+  8028ba:	89 f0                	mov    %esi,%eax
+  8028bc:	83 c4 10             	add    $0x10,%esp
+  8028bf:	39 fe                	cmp    %edi,%esi
+  8028c1:	72 c3                	jb     802886 <devcons_write+0x1d>
+}
+  8028c3:	89 f0                	mov    %esi,%eax
+  8028c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c8:	5b                   	pop    %ebx
+  8028c9:	5e                   	pop    %esi
+  8028ca:	5f                   	pop    %edi
+  8028cb:	5d                   	pop    %ebp
+  8028cc:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028cd:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028d2:	eb ef                	jmp    8028c3 <devcons_write+0x5a>
+
+008028d4 <devcons_read>:
+{
+  8028d4:	55                   	push   %ebp
+  8028d5:	89 e5                	mov    %esp,%ebp
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028da:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028df:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028e3:	74 36                	je     80291b <devcons_read+0x47>
+	c = cons_peek;
+  8028e5:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8028ea:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8028f1:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	75 10                	jne    802908 <devcons_read+0x34>
+  8028f8:	e8 11 d8 ff ff       	call   80010e <sys_cgetc>
+  8028fd:	85 c0                	test   %eax,%eax
+  8028ff:	75 07                	jne    802908 <devcons_read+0x34>
+		sys_yield();
+  802901:	e8 87 d8 ff ff       	call   80018d <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802906:	eb f0                	jmp    8028f8 <devcons_read+0x24>
+	if (c < 0)
+  802908:	85 c0                	test   %eax,%eax
+  80290a:	78 0f                	js     80291b <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80290c:	83 f8 04             	cmp    $0x4,%eax
+  80290f:	74 0c                	je     80291d <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802911:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802914:	88 02                	mov    %al,(%edx)
+	return 1;
+  802916:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80291b:	c9                   	leave
+  80291c:	c3                   	ret
+		return 0;
+  80291d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802922:	eb f7                	jmp    80291b <devcons_read+0x47>
+
+00802924 <cputchar>:
+{
+  802924:	55                   	push   %ebp
+  802925:	89 e5                	mov    %esp,%ebp
+  802927:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80292a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802930:	6a 01                	push   $0x1
+  802932:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802935:	50                   	push   %eax
+  802936:	e8 b5 d7 ff ff       	call   8000f0 <sys_cputs>
+}
+  80293b:	83 c4 10             	add    $0x10,%esp
+  80293e:	c9                   	leave
+  80293f:	c3                   	ret
+
+00802940 <getchar>:
+{
+  802940:	55                   	push   %ebp
+  802941:	89 e5                	mov    %esp,%ebp
+  802943:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802946:	6a 01                	push   $0x1
+  802948:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80294b:	50                   	push   %eax
+  80294c:	6a 00                	push   $0x0
+  80294e:	e8 b7 df ff ff       	call   80090a <read>
+	if (r < 0)
+  802953:	83 c4 10             	add    $0x10,%esp
+  802956:	85 c0                	test   %eax,%eax
+  802958:	78 06                	js     802960 <getchar+0x20>
+	if (r < 1)
+  80295a:	74 06                	je     802962 <getchar+0x22>
+	return c;
+  80295c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+		return -E_EOF;
+  802962:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802967:	eb f7                	jmp    802960 <getchar+0x20>
+
+00802969 <iscons>:
+{
+  802969:	55                   	push   %ebp
+  80296a:	89 e5                	mov    %esp,%ebp
+  80296c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80296f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802972:	50                   	push   %eax
+  802973:	ff 75 08             	push   0x8(%ebp)
+  802976:	e8 0b dd ff ff       	call   800686 <fd_lookup>
+  80297b:	83 c4 10             	add    $0x10,%esp
+  80297e:	85 c0                	test   %eax,%eax
+  802980:	78 11                	js     802993 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802982:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802985:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80298b:	39 10                	cmp    %edx,(%eax)
+  80298d:	0f 94 c0             	sete   %al
+  802990:	0f b6 c0             	movzbl %al,%eax
+}
+  802993:	c9                   	leave
+  802994:	c3                   	ret
+
+00802995 <opencons>:
+{
+  802995:	55                   	push   %ebp
+  802996:	89 e5                	mov    %esp,%ebp
+  802998:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80299b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80299e:	50                   	push   %eax
+  80299f:	e8 92 dc ff ff       	call   800636 <fd_alloc>
+  8029a4:	83 c4 10             	add    $0x10,%esp
+  8029a7:	85 c0                	test   %eax,%eax
+  8029a9:	78 3a                	js     8029e5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029ab:	83 ec 04             	sub    $0x4,%esp
+  8029ae:	68 07 04 00 00       	push   $0x407
+  8029b3:	ff 75 f4             	push   -0xc(%ebp)
+  8029b6:	6a 00                	push   $0x0
+  8029b8:	e8 ef d7 ff ff       	call   8001ac <sys_page_alloc>
+  8029bd:	83 c4 10             	add    $0x10,%esp
+  8029c0:	85 c0                	test   %eax,%eax
+  8029c2:	78 21                	js     8029e5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c7:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029cd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029d9:	83 ec 0c             	sub    $0xc,%esp
+  8029dc:	50                   	push   %eax
+  8029dd:	e8 2d dc ff ff       	call   80060f <fd2num>
+  8029e2:	83 c4 10             	add    $0x10,%esp
+}
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+
+008029e7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029e7:	55                   	push   %ebp
+  8029e8:	89 e5                	mov    %esp,%ebp
+  8029ea:	56                   	push   %esi
+  8029eb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029ec:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029ef:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8029f5:	e8 74 d7 ff ff       	call   80016e <sys_getenvid>
+  8029fa:	83 ec 0c             	sub    $0xc,%esp
+  8029fd:	ff 75 0c             	push   0xc(%ebp)
+  802a00:	ff 75 08             	push   0x8(%ebp)
+  802a03:	56                   	push   %esi
+  802a04:	50                   	push   %eax
+  802a05:	68 cc 3b 80 00       	push   $0x803bcc
+  802a0a:	e8 b3 00 00 00       	call   802ac2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802a0f:	83 c4 18             	add    $0x18,%esp
+  802a12:	53                   	push   %ebx
+  802a13:	ff 75 10             	push   0x10(%ebp)
+  802a16:	e8 56 00 00 00       	call   802a71 <vcprintf>
+	cprintf("\n");
+  802a1b:	c7 04 24 b0 3b 80 00 	movl   $0x803bb0,(%esp)
+  802a22:	e8 9b 00 00 00       	call   802ac2 <cprintf>
+  802a27:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a2a:	cc                   	int3
+	while (1)
+  802a2b:	eb fd                	jmp    802a2a <_panic+0x43>
+
+00802a2d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a2d:	55                   	push   %ebp
+  802a2e:	89 e5                	mov    %esp,%ebp
+  802a30:	53                   	push   %ebx
+  802a31:	83 ec 04             	sub    $0x4,%esp
+  802a34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a37:	8b 13                	mov    (%ebx),%edx
+  802a39:	8d 42 01             	lea    0x1(%edx),%eax
+  802a3c:	89 03                	mov    %eax,(%ebx)
+  802a3e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a41:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a45:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a4a:	74 09                	je     802a55 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a4c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a55:	83 ec 08             	sub    $0x8,%esp
+  802a58:	68 ff 00 00 00       	push   $0xff
+  802a5d:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a60:	50                   	push   %eax
+  802a61:	e8 8a d6 ff ff       	call   8000f0 <sys_cputs>
+		b->idx = 0;
+  802a66:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a6c:	83 c4 10             	add    $0x10,%esp
+  802a6f:	eb db                	jmp    802a4c <putch+0x1f>
+
+00802a71 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a71:	55                   	push   %ebp
+  802a72:	89 e5                	mov    %esp,%ebp
+  802a74:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a7a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a81:	00 00 00 
+	b.cnt = 0;
+  802a84:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802a8b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802a8e:	ff 75 0c             	push   0xc(%ebp)
+  802a91:	ff 75 08             	push   0x8(%ebp)
+  802a94:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802a9a:	50                   	push   %eax
+  802a9b:	68 2d 2a 80 00       	push   $0x802a2d
+  802aa0:	e8 1c 01 00 00       	call   802bc1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802aa5:	83 c4 08             	add    $0x8,%esp
+  802aa8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802aae:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802ab4:	50                   	push   %eax
+  802ab5:	e8 36 d6 ff ff       	call   8000f0 <sys_cputs>
+
+	return b.cnt;
+}
+  802aba:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802ac0:	c9                   	leave
+  802ac1:	c3                   	ret
+
+00802ac2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ac2:	55                   	push   %ebp
+  802ac3:	89 e5                	mov    %esp,%ebp
+  802ac5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802ac8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802acb:	50                   	push   %eax
+  802acc:	ff 75 08             	push   0x8(%ebp)
+  802acf:	e8 9d ff ff ff       	call   802a71 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802ad4:	c9                   	leave
+  802ad5:	c3                   	ret
+
+00802ad6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802ad6:	55                   	push   %ebp
+  802ad7:	89 e5                	mov    %esp,%ebp
+  802ad9:	57                   	push   %edi
+  802ada:	56                   	push   %esi
+  802adb:	53                   	push   %ebx
+  802adc:	83 ec 1c             	sub    $0x1c,%esp
+  802adf:	89 c3                	mov    %eax,%ebx
+  802ae1:	89 d6                	mov    %edx,%esi
+  802ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ae9:	89 d1                	mov    %edx,%ecx
+  802aeb:	89 c2                	mov    %eax,%edx
+  802aed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802af0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802af3:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802af6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802af9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b00:	39 c2                	cmp    %eax,%edx
+  802b02:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802b05:	73 4b                	jae    802b52 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802b07:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b0a:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b0d:	85 ff                	test   %edi,%edi
+  802b0f:	7e 11                	jle    802b22 <printnum+0x4c>
+			putch(padc, putdat);
+  802b11:	83 ec 08             	sub    $0x8,%esp
+  802b14:	56                   	push   %esi
+  802b15:	ff 75 18             	push   0x18(%ebp)
+  802b18:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b1a:	83 c4 10             	add    $0x10,%esp
+  802b1d:	83 ef 01             	sub    $0x1,%edi
+  802b20:	75 ef                	jne    802b11 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b22:	83 ec 08             	sub    $0x8,%esp
+  802b25:	56                   	push   %esi
+  802b26:	83 ec 04             	sub    $0x4,%esp
+  802b29:	ff 75 e4             	push   -0x1c(%ebp)
+  802b2c:	ff 75 e0             	push   -0x20(%ebp)
+  802b2f:	ff 75 dc             	push   -0x24(%ebp)
+  802b32:	ff 75 d8             	push   -0x28(%ebp)
+  802b35:	e8 33 0e 00 00       	call   80396d <__umoddi3>
+  802b3a:	83 c4 14             	add    $0x14,%esp
+  802b3d:	0f be 80 ef 3b 80 00 	movsbl 0x803bef(%eax),%eax
+  802b44:	50                   	push   %eax
+  802b45:	ff d3                	call   *%ebx
+}
+  802b47:	83 c4 10             	add    $0x10,%esp
+  802b4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b4d:	5b                   	pop    %ebx
+  802b4e:	5e                   	pop    %esi
+  802b4f:	5f                   	pop    %edi
+  802b50:	5d                   	pop    %ebp
+  802b51:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b52:	83 ec 0c             	sub    $0xc,%esp
+  802b55:	ff 75 18             	push   0x18(%ebp)
+  802b58:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b5b:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b5e:	52                   	push   %edx
+  802b5f:	50                   	push   %eax
+  802b60:	83 ec 08             	sub    $0x8,%esp
+  802b63:	ff 75 e4             	push   -0x1c(%ebp)
+  802b66:	ff 75 e0             	push   -0x20(%ebp)
+  802b69:	ff 75 dc             	push   -0x24(%ebp)
+  802b6c:	ff 75 d8             	push   -0x28(%ebp)
+  802b6f:	e8 33 0d 00 00       	call   8038a7 <__udivdi3>
+  802b74:	83 c4 18             	add    $0x18,%esp
+  802b77:	52                   	push   %edx
+  802b78:	50                   	push   %eax
+  802b79:	89 f2                	mov    %esi,%edx
+  802b7b:	89 d8                	mov    %ebx,%eax
+  802b7d:	e8 54 ff ff ff       	call   802ad6 <printnum>
+  802b82:	83 c4 20             	add    $0x20,%esp
+  802b85:	eb 9b                	jmp    802b22 <printnum+0x4c>
+
+00802b87 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802b87:	55                   	push   %ebp
+  802b88:	89 e5                	mov    %esp,%ebp
+  802b8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802b8d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802b91:	8b 10                	mov    (%eax),%edx
+  802b93:	3b 50 04             	cmp    0x4(%eax),%edx
+  802b96:	73 0a                	jae    802ba2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802b98:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802b9b:	89 08                	mov    %ecx,(%eax)
+  802b9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba0:	88 02                	mov    %al,(%edx)
+}
+  802ba2:	5d                   	pop    %ebp
+  802ba3:	c3                   	ret
+
+00802ba4 <printfmt>:
+{
+  802ba4:	55                   	push   %ebp
+  802ba5:	89 e5                	mov    %esp,%ebp
+  802ba7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802baa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802bad:	50                   	push   %eax
+  802bae:	ff 75 10             	push   0x10(%ebp)
+  802bb1:	ff 75 0c             	push   0xc(%ebp)
+  802bb4:	ff 75 08             	push   0x8(%ebp)
+  802bb7:	e8 05 00 00 00       	call   802bc1 <vprintfmt>
+}
+  802bbc:	83 c4 10             	add    $0x10,%esp
+  802bbf:	c9                   	leave
+  802bc0:	c3                   	ret
+
+00802bc1 <vprintfmt>:
+{
+  802bc1:	55                   	push   %ebp
+  802bc2:	89 e5                	mov    %esp,%ebp
+  802bc4:	57                   	push   %edi
+  802bc5:	56                   	push   %esi
+  802bc6:	53                   	push   %ebx
+  802bc7:	83 ec 2c             	sub    $0x2c,%esp
+  802bca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bcd:	89 df                	mov    %ebx,%edi
+  802bcf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bd2:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd5:	8d 70 01             	lea    0x1(%eax),%esi
+  802bd8:	0f b6 00             	movzbl (%eax),%eax
+  802bdb:	83 f8 25             	cmp    $0x25,%eax
+  802bde:	74 1e                	je     802bfe <vprintfmt+0x3d>
+			if (ch == '\0')
+  802be0:	85 c0                	test   %eax,%eax
+  802be2:	0f 84 15 05 00 00    	je     8030fd <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802be8:	83 ec 08             	sub    $0x8,%esp
+  802beb:	53                   	push   %ebx
+  802bec:	50                   	push   %eax
+  802bed:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bef:	83 c6 01             	add    $0x1,%esi
+  802bf2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802bf6:	83 c4 10             	add    $0x10,%esp
+  802bf9:	83 f8 25             	cmp    $0x25,%eax
+  802bfc:	75 e2                	jne    802be0 <vprintfmt+0x1f>
+		padc = ' ';
+  802bfe:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802c02:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802c09:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802c10:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c1c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c1f:	8d 56 01             	lea    0x1(%esi),%edx
+  802c22:	0f b6 0e             	movzbl (%esi),%ecx
+  802c25:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c28:	3c 55                	cmp    $0x55,%al
+  802c2a:	0f 87 3b 04 00 00    	ja     80306b <vprintfmt+0x4aa>
+  802c30:	0f b6 c0             	movzbl %al,%eax
+  802c33:	ff 24 85 60 3d 80 00 	jmp    *0x803d60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c3a:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c3d:	eb 93                	jmp    802bd2 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c3f:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c41:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c45:	eb d8                	jmp    802c1f <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c47:	89 d6                	mov    %edx,%esi
+  802c49:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c4d:	eb d0                	jmp    802c1f <vprintfmt+0x5e>
+  802c4f:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c52:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c55:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c58:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c5c:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c5f:	83 f9 09             	cmp    $0x9,%ecx
+  802c62:	77 6f                	ja     802cd3 <vprintfmt+0x112>
+  802c64:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c67:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c6a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c6d:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c71:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c74:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c77:	83 fe 09             	cmp    $0x9,%esi
+  802c7a:	76 eb                	jbe    802c67 <vprintfmt+0xa6>
+  802c7c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c7f:	89 d6                	mov    %edx,%esi
+  802c81:	eb 13                	jmp    802c96 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802c83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c86:	8b 00                	mov    (%eax),%eax
+  802c88:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c8b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c8e:	8d 40 04             	lea    0x4(%eax),%eax
+  802c91:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c94:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802c96:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802c9a:	79 83                	jns    802c1f <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802c9c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c9f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ca2:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802ca9:	e9 71 ff ff ff       	jmp    802c1f <vprintfmt+0x5e>
+			if (width < 0)
+  802cae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802cb1:	85 c9                	test   %ecx,%ecx
+  802cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb8:	0f 49 c1             	cmovns %ecx,%eax
+  802cbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cbe:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cc0:	e9 5a ff ff ff       	jmp    802c1f <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc5:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cc7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cce:	e9 4c ff ff ff       	jmp    802c1f <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cd3:	89 d6                	mov    %edx,%esi
+  802cd5:	eb bf                	jmp    802c96 <vprintfmt+0xd5>
+			lflag++;
+  802cd7:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cdb:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cdd:	e9 3d ff ff ff       	jmp    802c1f <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802ce2:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ce5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ce8:	8d 70 04             	lea    0x4(%eax),%esi
+  802ceb:	83 ec 08             	sub    $0x8,%esp
+  802cee:	53                   	push   %ebx
+  802cef:	ff 30                	push   (%eax)
+  802cf1:	ff d7                	call   *%edi
+			break;
+  802cf3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802cf6:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802cf9:	e9 d4 fe ff ff       	jmp    802bd2 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802cfe:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d01:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d04:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802d07:	8b 10                	mov    (%eax),%edx
+  802d09:	89 d0                	mov    %edx,%eax
+  802d0b:	f7 d8                	neg    %eax
+  802d0d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802d10:	83 f8 12             	cmp    $0x12,%eax
+  802d13:	7f 23                	jg     802d38 <vprintfmt+0x177>
+  802d15:	8b 14 85 c0 3e 80 00 	mov    0x803ec0(,%eax,4),%edx
+  802d1c:	85 d2                	test   %edx,%edx
+  802d1e:	74 18                	je     802d38 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d20:	52                   	push   %edx
+  802d21:	68 7b 3b 80 00       	push   $0x803b7b
+  802d26:	53                   	push   %ebx
+  802d27:	57                   	push   %edi
+  802d28:	e8 77 fe ff ff       	call   802ba4 <printfmt>
+  802d2d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d30:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d33:	e9 9a fe ff ff       	jmp    802bd2 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d38:	50                   	push   %eax
+  802d39:	68 07 3c 80 00       	push   $0x803c07
+  802d3e:	53                   	push   %ebx
+  802d3f:	57                   	push   %edi
+  802d40:	e8 5f fe ff ff       	call   802ba4 <printfmt>
+  802d45:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d48:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d4b:	e9 82 fe ff ff       	jmp    802bd2 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d50:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d53:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d56:	83 c0 04             	add    $0x4,%eax
+  802d59:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d5c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d5f:	8b 00                	mov    (%eax),%eax
+  802d61:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d64:	85 c0                	test   %eax,%eax
+  802d66:	0f 84 61 03 00 00    	je     8030cd <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d6c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d70:	7e 06                	jle    802d78 <vprintfmt+0x1b7>
+  802d72:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d76:	75 29                	jne    802da1 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d78:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d7b:	8d 70 01             	lea    0x1(%eax),%esi
+  802d7e:	0f b6 00             	movzbl (%eax),%eax
+  802d81:	0f be d0             	movsbl %al,%edx
+  802d84:	85 d2                	test   %edx,%edx
+  802d86:	0f 84 bb 00 00 00    	je     802e47 <vprintfmt+0x286>
+  802d8c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802d8f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802d92:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802d95:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d98:	eb 7a                	jmp    802e14 <vprintfmt+0x253>
+				p = "(null)";
+  802d9a:	c7 45 d0 00 3c 80 00 	movl   $0x803c00,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802da1:	83 ec 08             	sub    $0x8,%esp
+  802da4:	ff 75 d4             	push   -0x2c(%ebp)
+  802da7:	ff 75 d0             	push   -0x30(%ebp)
+  802daa:	e8 e0 03 00 00       	call   80318f <strnlen>
+  802daf:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802db2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802db5:	83 c4 10             	add    $0x10,%esp
+  802db8:	85 d2                	test   %edx,%edx
+  802dba:	0f 8e d6 02 00 00    	jle    803096 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802dc0:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802dc4:	83 ec 08             	sub    $0x8,%esp
+  802dc7:	53                   	push   %ebx
+  802dc8:	56                   	push   %esi
+  802dc9:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dcb:	83 c4 10             	add    $0x10,%esp
+  802dce:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802dd2:	75 f0                	jne    802dc4 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dd4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dd7:	8d 70 01             	lea    0x1(%eax),%esi
+  802dda:	0f b6 00             	movzbl (%eax),%eax
+  802ddd:	0f be d0             	movsbl %al,%edx
+  802de0:	85 d2                	test   %edx,%edx
+  802de2:	0f 84 da 02 00 00    	je     8030c2 <vprintfmt+0x501>
+  802de8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802deb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802dee:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802df1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802df4:	eb 1e                	jmp    802e14 <vprintfmt+0x253>
+					putch(ch, putdat);
+  802df6:	83 ec 08             	sub    $0x8,%esp
+  802df9:	ff 75 0c             	push   0xc(%ebp)
+  802dfc:	52                   	push   %edx
+  802dfd:	ff 55 08             	call   *0x8(%ebp)
+  802e00:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802e03:	83 eb 01             	sub    $0x1,%ebx
+  802e06:	83 c6 01             	add    $0x1,%esi
+  802e09:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e0d:	0f be d0             	movsbl %al,%edx
+  802e10:	85 d2                	test   %edx,%edx
+  802e12:	74 2a                	je     802e3e <vprintfmt+0x27d>
+  802e14:	85 ff                	test   %edi,%edi
+  802e16:	78 05                	js     802e1d <vprintfmt+0x25c>
+  802e18:	83 ef 01             	sub    $0x1,%edi
+  802e1b:	78 59                	js     802e76 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e1d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e21:	74 d3                	je     802df6 <vprintfmt+0x235>
+  802e23:	0f be c0             	movsbl %al,%eax
+  802e26:	83 e8 20             	sub    $0x20,%eax
+  802e29:	83 f8 5e             	cmp    $0x5e,%eax
+  802e2c:	76 c8                	jbe    802df6 <vprintfmt+0x235>
+					putch('?', putdat);
+  802e2e:	83 ec 08             	sub    $0x8,%esp
+  802e31:	ff 75 0c             	push   0xc(%ebp)
+  802e34:	6a 3f                	push   $0x3f
+  802e36:	ff 55 08             	call   *0x8(%ebp)
+  802e39:	83 c4 10             	add    $0x10,%esp
+  802e3c:	eb c5                	jmp    802e03 <vprintfmt+0x242>
+  802e3e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e41:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e47:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e4a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e4e:	7e 1b                	jle    802e6b <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e50:	83 ec 08             	sub    $0x8,%esp
+  802e53:	53                   	push   %ebx
+  802e54:	6a 20                	push   $0x20
+  802e56:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e58:	83 c4 10             	add    $0x10,%esp
+  802e5b:	83 ee 01             	sub    $0x1,%esi
+  802e5e:	75 f0                	jne    802e50 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e60:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e63:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e66:	e9 67 fd ff ff       	jmp    802bd2 <vprintfmt+0x11>
+  802e6b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e6e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e71:	e9 5c fd ff ff       	jmp    802bd2 <vprintfmt+0x11>
+  802e76:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e79:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e7f:	eb c6                	jmp    802e47 <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e81:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802e84:	89 55 10             	mov    %edx,0x10(%ebp)
+  802e87:	83 f9 01             	cmp    $0x1,%ecx
+  802e8a:	7f 1f                	jg     802eab <vprintfmt+0x2ea>
+	else if (lflag)
+  802e8c:	85 c9                	test   %ecx,%ecx
+  802e8e:	74 67                	je     802ef7 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802e90:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e93:	8b 30                	mov    (%eax),%esi
+  802e95:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802e98:	89 f0                	mov    %esi,%eax
+  802e9a:	c1 f8 1f             	sar    $0x1f,%eax
+  802e9d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802ea0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea3:	8d 40 04             	lea    0x4(%eax),%eax
+  802ea6:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ea9:	eb 17                	jmp    802ec2 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802eab:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eae:	8b 50 04             	mov    0x4(%eax),%edx
+  802eb1:	8b 00                	mov    (%eax),%eax
+  802eb3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802eb6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802eb9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ebc:	8d 40 08             	lea    0x8(%eax),%eax
+  802ebf:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802ec2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ec5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802ec8:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802ecd:	85 c9                	test   %ecx,%ecx
+  802ecf:	0f 89 12 01 00 00    	jns    802fe7 <vprintfmt+0x426>
+				putch('-', putdat);
+  802ed5:	83 ec 08             	sub    $0x8,%esp
+  802ed8:	53                   	push   %ebx
+  802ed9:	6a 2d                	push   $0x2d
+  802edb:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802edd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ee0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ee3:	f7 da                	neg    %edx
+  802ee5:	83 d1 00             	adc    $0x0,%ecx
+  802ee8:	f7 d9                	neg    %ecx
+  802eea:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802eed:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ef2:	e9 f0 00 00 00       	jmp    802fe7 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802ef7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802efa:	8b 30                	mov    (%eax),%esi
+  802efc:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802eff:	89 f0                	mov    %esi,%eax
+  802f01:	c1 f8 1f             	sar    $0x1f,%eax
+  802f04:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f07:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f0a:	8d 40 04             	lea    0x4(%eax),%eax
+  802f0d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f10:	eb b0                	jmp    802ec2 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f12:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f15:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f18:	83 f9 01             	cmp    $0x1,%ecx
+  802f1b:	7f 1e                	jg     802f3b <vprintfmt+0x37a>
+	else if (lflag)
+  802f1d:	85 c9                	test   %ecx,%ecx
+  802f1f:	74 32                	je     802f53 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f21:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f24:	8b 10                	mov    (%eax),%edx
+  802f26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f2b:	8d 40 04             	lea    0x4(%eax),%eax
+  802f2e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f31:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f36:	e9 ac 00 00 00       	jmp    802fe7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f3e:	8b 10                	mov    (%eax),%edx
+  802f40:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f43:	8d 40 08             	lea    0x8(%eax),%eax
+  802f46:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f49:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f4e:	e9 94 00 00 00       	jmp    802fe7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f53:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f56:	8b 10                	mov    (%eax),%edx
+  802f58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f5d:	8d 40 04             	lea    0x4(%eax),%eax
+  802f60:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f63:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f68:	eb 7d                	jmp    802fe7 <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f6a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f6d:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f70:	83 f9 01             	cmp    $0x1,%ecx
+  802f73:	7f 1b                	jg     802f90 <vprintfmt+0x3cf>
+	else if (lflag)
+  802f75:	85 c9                	test   %ecx,%ecx
+  802f77:	74 2c                	je     802fa5 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f79:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f7c:	8b 10                	mov    (%eax),%edx
+  802f7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f83:	8d 40 04             	lea    0x4(%eax),%eax
+  802f86:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f89:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802f8e:	eb 57                	jmp    802fe7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f90:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f93:	8b 10                	mov    (%eax),%edx
+  802f95:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f98:	8d 40 08             	lea    0x8(%eax),%eax
+  802f9b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f9e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802fa3:	eb 42                	jmp    802fe7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802fa5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fa8:	8b 10                	mov    (%eax),%edx
+  802faa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802faf:	8d 40 04             	lea    0x4(%eax),%eax
+  802fb2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fb5:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fba:	eb 2b                	jmp    802fe7 <vprintfmt+0x426>
+			putch('0', putdat);
+  802fbc:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fbf:	83 ec 08             	sub    $0x8,%esp
+  802fc2:	53                   	push   %ebx
+  802fc3:	6a 30                	push   $0x30
+  802fc5:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fc7:	83 c4 08             	add    $0x8,%esp
+  802fca:	53                   	push   %ebx
+  802fcb:	6a 78                	push   $0x78
+  802fcd:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fcf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fd2:	8b 10                	mov    (%eax),%edx
+  802fd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802fd9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802fdc:	8d 40 04             	lea    0x4(%eax),%eax
+  802fdf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802fe2:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  802fe7:	83 ec 0c             	sub    $0xc,%esp
+  802fea:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802fee:	50                   	push   %eax
+  802fef:	ff 75 e4             	push   -0x1c(%ebp)
+  802ff2:	56                   	push   %esi
+  802ff3:	51                   	push   %ecx
+  802ff4:	52                   	push   %edx
+  802ff5:	89 da                	mov    %ebx,%edx
+  802ff7:	89 f8                	mov    %edi,%eax
+  802ff9:	e8 d8 fa ff ff       	call   802ad6 <printnum>
+			break;
+  802ffe:	83 c4 20             	add    $0x20,%esp
+  803001:	e9 cc fb ff ff       	jmp    802bd2 <vprintfmt+0x11>
+	if (lflag >= 2)
+  803006:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803009:	89 55 10             	mov    %edx,0x10(%ebp)
+  80300c:	83 f9 01             	cmp    $0x1,%ecx
+  80300f:	7f 1b                	jg     80302c <vprintfmt+0x46b>
+	else if (lflag)
+  803011:	85 c9                	test   %ecx,%ecx
+  803013:	74 2c                	je     803041 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803015:	8b 45 14             	mov    0x14(%ebp),%eax
+  803018:	8b 10                	mov    (%eax),%edx
+  80301a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80301f:	8d 40 04             	lea    0x4(%eax),%eax
+  803022:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803025:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80302a:	eb bb                	jmp    802fe7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80302c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80302f:	8b 10                	mov    (%eax),%edx
+  803031:	8b 48 04             	mov    0x4(%eax),%ecx
+  803034:	8d 40 08             	lea    0x8(%eax),%eax
+  803037:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80303a:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80303f:	eb a6                	jmp    802fe7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803041:	8b 45 14             	mov    0x14(%ebp),%eax
+  803044:	8b 10                	mov    (%eax),%edx
+  803046:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80304b:	8d 40 04             	lea    0x4(%eax),%eax
+  80304e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803051:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  803056:	eb 8f                	jmp    802fe7 <vprintfmt+0x426>
+			putch(ch, putdat);
+  803058:	89 55 10             	mov    %edx,0x10(%ebp)
+  80305b:	83 ec 08             	sub    $0x8,%esp
+  80305e:	53                   	push   %ebx
+  80305f:	6a 25                	push   $0x25
+  803061:	ff d7                	call   *%edi
+			break;
+  803063:	83 c4 10             	add    $0x10,%esp
+  803066:	e9 67 fb ff ff       	jmp    802bd2 <vprintfmt+0x11>
+			putch('%', putdat);
+  80306b:	83 ec 08             	sub    $0x8,%esp
+  80306e:	53                   	push   %ebx
+  80306f:	6a 25                	push   $0x25
+  803071:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803073:	83 c4 10             	add    $0x10,%esp
+  803076:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80307a:	0f 84 ba fb ff ff    	je     802c3a <vprintfmt+0x79>
+  803080:	89 75 10             	mov    %esi,0x10(%ebp)
+  803083:	89 f0                	mov    %esi,%eax
+  803085:	83 e8 01             	sub    $0x1,%eax
+  803088:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80308c:	75 f7                	jne    803085 <vprintfmt+0x4c4>
+  80308e:	89 45 10             	mov    %eax,0x10(%ebp)
+  803091:	e9 3c fb ff ff       	jmp    802bd2 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803096:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803099:	8d 70 01             	lea    0x1(%eax),%esi
+  80309c:	0f b6 00             	movzbl (%eax),%eax
+  80309f:	0f be d0             	movsbl %al,%edx
+  8030a2:	85 d2                	test   %edx,%edx
+  8030a4:	74 11                	je     8030b7 <vprintfmt+0x4f6>
+  8030a6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030a9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030ac:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030af:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030b2:	e9 5d fd ff ff       	jmp    802e14 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030bd:	e9 10 fb ff ff       	jmp    802bd2 <vprintfmt+0x11>
+  8030c2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030c8:	e9 05 fb ff ff       	jmp    802bd2 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030cd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030d1:	7e 0a                	jle    8030dd <vprintfmt+0x51c>
+  8030d3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030d7:	0f 85 bd fc ff ff    	jne    802d9a <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030dd:	ba 28 00 00 00       	mov    $0x28,%edx
+  8030e2:	b8 28 00 00 00       	mov    $0x28,%eax
+  8030e7:	be 01 3c 80 00       	mov    $0x803c01,%esi
+  8030ec:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030ef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030f2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030f5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030f8:	e9 17 fd ff ff       	jmp    802e14 <vprintfmt+0x253>
+}
+  8030fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803100:	5b                   	pop    %ebx
+  803101:	5e                   	pop    %esi
+  803102:	5f                   	pop    %edi
+  803103:	5d                   	pop    %ebp
+  803104:	c3                   	ret
+
+00803105 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803105:	55                   	push   %ebp
+  803106:	89 e5                	mov    %esp,%ebp
+  803108:	83 ec 18             	sub    $0x18,%esp
+  80310b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80310e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803111:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803114:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803118:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80311b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803122:	85 c0                	test   %eax,%eax
+  803124:	74 26                	je     80314c <vsnprintf+0x47>
+  803126:	85 d2                	test   %edx,%edx
+  803128:	7e 22                	jle    80314c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80312a:	ff 75 14             	push   0x14(%ebp)
+  80312d:	ff 75 10             	push   0x10(%ebp)
+  803130:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803133:	50                   	push   %eax
+  803134:	68 87 2b 80 00       	push   $0x802b87
+  803139:	e8 83 fa ff ff       	call   802bc1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80313e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803141:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803144:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803147:	83 c4 10             	add    $0x10,%esp
+}
+  80314a:	c9                   	leave
+  80314b:	c3                   	ret
+		return -E_INVAL;
+  80314c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803151:	eb f7                	jmp    80314a <vsnprintf+0x45>
+
+00803153 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803153:	55                   	push   %ebp
+  803154:	89 e5                	mov    %esp,%ebp
+  803156:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803159:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80315c:	50                   	push   %eax
+  80315d:	ff 75 10             	push   0x10(%ebp)
+  803160:	ff 75 0c             	push   0xc(%ebp)
+  803163:	ff 75 08             	push   0x8(%ebp)
+  803166:	e8 9a ff ff ff       	call   803105 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80316b:	c9                   	leave
+  80316c:	c3                   	ret
+
+0080316d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80316d:	55                   	push   %ebp
+  80316e:	89 e5                	mov    %esp,%ebp
+  803170:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803173:	80 3a 00             	cmpb   $0x0,(%edx)
+  803176:	74 10                	je     803188 <strlen+0x1b>
+  803178:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80317d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803180:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  803184:	75 f7                	jne    80317d <strlen+0x10>
+	return n;
+}
+  803186:	5d                   	pop    %ebp
+  803187:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  803188:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80318d:	eb f7                	jmp    803186 <strlen+0x19>
+
+0080318f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80318f:	55                   	push   %ebp
+  803190:	89 e5                	mov    %esp,%ebp
+  803192:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803195:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803198:	85 d2                	test   %edx,%edx
+  80319a:	74 16                	je     8031b2 <strnlen+0x23>
+  80319c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8031a5:	74 09                	je     8031b0 <strnlen+0x21>
+		n++;
+  8031a7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031aa:	39 d0                	cmp    %edx,%eax
+  8031ac:	75 f3                	jne    8031a1 <strnlen+0x12>
+		n++;
+  8031ae:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8031b0:	5d                   	pop    %ebp
+  8031b1:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b7:	eb f7                	jmp    8031b0 <strnlen+0x21>
+
+008031b9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031b9:	55                   	push   %ebp
+  8031ba:	89 e5                	mov    %esp,%ebp
+  8031bc:	53                   	push   %ebx
+  8031bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031cc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031cf:	83 c0 01             	add    $0x1,%eax
+  8031d2:	84 d2                	test   %dl,%dl
+  8031d4:	75 f2                	jne    8031c8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031d6:	89 c8                	mov    %ecx,%eax
+  8031d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031db:	c9                   	leave
+  8031dc:	c3                   	ret
+
+008031dd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031dd:	55                   	push   %ebp
+  8031de:	89 e5                	mov    %esp,%ebp
+  8031e0:	53                   	push   %ebx
+  8031e1:	83 ec 10             	sub    $0x10,%esp
+  8031e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8031e7:	53                   	push   %ebx
+  8031e8:	e8 80 ff ff ff       	call   80316d <strlen>
+  8031ed:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8031f0:	ff 75 0c             	push   0xc(%ebp)
+  8031f3:	01 d8                	add    %ebx,%eax
+  8031f5:	50                   	push   %eax
+  8031f6:	e8 be ff ff ff       	call   8031b9 <strcpy>
+	return dst;
+}
+  8031fb:	89 d8                	mov    %ebx,%eax
+  8031fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803200:	c9                   	leave
+  803201:	c3                   	ret
+
+00803202 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803202:	55                   	push   %ebp
+  803203:	89 e5                	mov    %esp,%ebp
+  803205:	56                   	push   %esi
+  803206:	53                   	push   %ebx
+  803207:	8b 75 08             	mov    0x8(%ebp),%esi
+  80320a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80320d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  803210:	85 db                	test   %ebx,%ebx
+  803212:	74 17                	je     80322b <strncpy+0x29>
+  803214:	01 f3                	add    %esi,%ebx
+  803216:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  803218:	83 c0 01             	add    $0x1,%eax
+  80321b:	0f b6 0a             	movzbl (%edx),%ecx
+  80321e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803221:	80 f9 01             	cmp    $0x1,%cl
+  803224:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  803227:	39 c3                	cmp    %eax,%ebx
+  803229:	75 ed                	jne    803218 <strncpy+0x16>
+	}
+	return ret;
+}
+  80322b:	89 f0                	mov    %esi,%eax
+  80322d:	5b                   	pop    %ebx
+  80322e:	5e                   	pop    %esi
+  80322f:	5d                   	pop    %ebp
+  803230:	c3                   	ret
+
+00803231 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803231:	55                   	push   %ebp
+  803232:	89 e5                	mov    %esp,%ebp
+  803234:	56                   	push   %esi
+  803235:	53                   	push   %ebx
+  803236:	8b 75 08             	mov    0x8(%ebp),%esi
+  803239:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80323c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80323f:	89 f0                	mov    %esi,%eax
+  803241:	85 db                	test   %ebx,%ebx
+  803243:	74 1e                	je     803263 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  803245:	83 eb 01             	sub    $0x1,%ebx
+  803248:	74 16                	je     803260 <strlcpy+0x2f>
+  80324a:	01 f3                	add    %esi,%ebx
+  80324c:	0f b6 0a             	movzbl (%edx),%ecx
+  80324f:	84 c9                	test   %cl,%cl
+  803251:	74 0d                	je     803260 <strlcpy+0x2f>
+			*dst++ = *src++;
+  803253:	83 c2 01             	add    $0x1,%edx
+  803256:	83 c0 01             	add    $0x1,%eax
+  803259:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80325c:	39 d8                	cmp    %ebx,%eax
+  80325e:	75 ec                	jne    80324c <strlcpy+0x1b>
+		*dst = '\0';
+  803260:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803263:	29 f0                	sub    %esi,%eax
+}
+  803265:	5b                   	pop    %ebx
+  803266:	5e                   	pop    %esi
+  803267:	5d                   	pop    %ebp
+  803268:	c3                   	ret
+
+00803269 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803269:	55                   	push   %ebp
+  80326a:	89 e5                	mov    %esp,%ebp
+  80326c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80326f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803272:	0f b6 01             	movzbl (%ecx),%eax
+  803275:	84 c0                	test   %al,%al
+  803277:	74 11                	je     80328a <strcmp+0x21>
+  803279:	38 02                	cmp    %al,(%edx)
+  80327b:	75 0d                	jne    80328a <strcmp+0x21>
+		p++, q++;
+  80327d:	83 c1 01             	add    $0x1,%ecx
+  803280:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803283:	0f b6 01             	movzbl (%ecx),%eax
+  803286:	84 c0                	test   %al,%al
+  803288:	75 ef                	jne    803279 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80328a:	0f b6 c0             	movzbl %al,%eax
+  80328d:	0f b6 12             	movzbl (%edx),%edx
+  803290:	29 d0                	sub    %edx,%eax
+}
+  803292:	5d                   	pop    %ebp
+  803293:	c3                   	ret
+
+00803294 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803294:	55                   	push   %ebp
+  803295:	89 e5                	mov    %esp,%ebp
+  803297:	53                   	push   %ebx
+  803298:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80329b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80329e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8032a1:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8032a6:	85 d2                	test   %edx,%edx
+  8032a8:	74 2e                	je     8032d8 <strncmp+0x44>
+  8032aa:	0f b6 01             	movzbl (%ecx),%eax
+  8032ad:	84 c0                	test   %al,%al
+  8032af:	74 16                	je     8032c7 <strncmp+0x33>
+  8032b1:	3a 03                	cmp    (%ebx),%al
+  8032b3:	75 12                	jne    8032c7 <strncmp+0x33>
+		n--, p++, q++;
+  8032b5:	83 c1 01             	add    $0x1,%ecx
+  8032b8:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032bb:	83 ea 01             	sub    $0x1,%edx
+  8032be:	75 ea                	jne    8032aa <strncmp+0x16>
+		return 0;
+  8032c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c5:	eb 11                	jmp    8032d8 <strncmp+0x44>
+  8032c7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032cc:	85 d2                	test   %edx,%edx
+  8032ce:	74 08                	je     8032d8 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032d0:	0f b6 01             	movzbl (%ecx),%eax
+  8032d3:	0f b6 13             	movzbl (%ebx),%edx
+  8032d6:	29 d0                	sub    %edx,%eax
+}
+  8032d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032db:	c9                   	leave
+  8032dc:	c3                   	ret
+
+008032dd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032dd:	55                   	push   %ebp
+  8032de:	89 e5                	mov    %esp,%ebp
+  8032e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8032e7:	0f b6 10             	movzbl (%eax),%edx
+  8032ea:	84 d2                	test   %dl,%dl
+  8032ec:	74 15                	je     803303 <strchr+0x26>
+		if (*s == c)
+  8032ee:	38 d1                	cmp    %dl,%cl
+  8032f0:	74 0f                	je     803301 <strchr+0x24>
+	for (; *s; s++)
+  8032f2:	83 c0 01             	add    $0x1,%eax
+  8032f5:	0f b6 10             	movzbl (%eax),%edx
+  8032f8:	84 d2                	test   %dl,%dl
+  8032fa:	75 f2                	jne    8032ee <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8032fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803301:	5d                   	pop    %ebp
+  803302:	c3                   	ret
+	return 0;
+  803303:	b8 00 00 00 00       	mov    $0x0,%eax
+  803308:	eb f7                	jmp    803301 <strchr+0x24>
+
+0080330a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80330a:	55                   	push   %ebp
+  80330b:	89 e5                	mov    %esp,%ebp
+  80330d:	53                   	push   %ebx
+  80330e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803311:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  803314:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  803317:	38 d3                	cmp    %dl,%bl
+  803319:	74 14                	je     80332f <strfind+0x25>
+  80331b:	89 d1                	mov    %edx,%ecx
+  80331d:	84 db                	test   %bl,%bl
+  80331f:	74 0e                	je     80332f <strfind+0x25>
+	for (; *s; s++)
+  803321:	83 c0 01             	add    $0x1,%eax
+  803324:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  803327:	38 ca                	cmp    %cl,%dl
+  803329:	74 04                	je     80332f <strfind+0x25>
+  80332b:	84 d2                	test   %dl,%dl
+  80332d:	75 f2                	jne    803321 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  80332f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803332:	c9                   	leave
+  803333:	c3                   	ret
+
+00803334 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803334:	55                   	push   %ebp
+  803335:	89 e5                	mov    %esp,%ebp
+  803337:	57                   	push   %edi
+  803338:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80333b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80333e:	85 c9                	test   %ecx,%ecx
+  803340:	74 20                	je     803362 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803342:	89 f8                	mov    %edi,%eax
+  803344:	09 c8                	or     %ecx,%eax
+  803346:	a8 03                	test   $0x3,%al
+  803348:	75 12                	jne    80335c <memset+0x28>
+		c &= 0xFF;
+  80334a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80334e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803354:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  803357:	fc                   	cld
+  803358:	f3 ab                	rep stos %eax,%es:(%edi)
+  80335a:	eb 06                	jmp    803362 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80335c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80335f:	fc                   	cld
+  803360:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803362:	89 f8                	mov    %edi,%eax
+  803364:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803367:	c9                   	leave
+  803368:	c3                   	ret
+
+00803369 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803369:	55                   	push   %ebp
+  80336a:	89 e5                	mov    %esp,%ebp
+  80336c:	57                   	push   %edi
+  80336d:	56                   	push   %esi
+  80336e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803371:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803374:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803377:	39 c6                	cmp    %eax,%esi
+  803379:	73 32                	jae    8033ad <memmove+0x44>
+  80337b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80337e:	39 d0                	cmp    %edx,%eax
+  803380:	73 2b                	jae    8033ad <memmove+0x44>
+		s += n;
+		d += n;
+  803382:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803385:	89 d6                	mov    %edx,%esi
+  803387:	09 fe                	or     %edi,%esi
+  803389:	09 ce                	or     %ecx,%esi
+  80338b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803391:	75 0e                	jne    8033a1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803393:	83 ef 04             	sub    $0x4,%edi
+  803396:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803399:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80339c:	fd                   	std
+  80339d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80339f:	eb 09                	jmp    8033aa <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8033a1:	83 ef 01             	sub    $0x1,%edi
+  8033a4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8033a7:	fd                   	std
+  8033a8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8033aa:	fc                   	cld
+  8033ab:	eb 1a                	jmp    8033c7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033ad:	89 f2                	mov    %esi,%edx
+  8033af:	09 c2                	or     %eax,%edx
+  8033b1:	09 ca                	or     %ecx,%edx
+  8033b3:	f6 c2 03             	test   $0x3,%dl
+  8033b6:	75 0a                	jne    8033c2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033b8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033bb:	89 c7                	mov    %eax,%edi
+  8033bd:	fc                   	cld
+  8033be:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033c0:	eb 05                	jmp    8033c7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033c2:	89 c7                	mov    %eax,%edi
+  8033c4:	fc                   	cld
+  8033c5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033c7:	5e                   	pop    %esi
+  8033c8:	5f                   	pop    %edi
+  8033c9:	5d                   	pop    %ebp
+  8033ca:	c3                   	ret
+
+008033cb <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033cb:	55                   	push   %ebp
+  8033cc:	89 e5                	mov    %esp,%ebp
+  8033ce:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033d1:	ff 75 10             	push   0x10(%ebp)
+  8033d4:	ff 75 0c             	push   0xc(%ebp)
+  8033d7:	ff 75 08             	push   0x8(%ebp)
+  8033da:	e8 8a ff ff ff       	call   803369 <memmove>
+}
+  8033df:	c9                   	leave
+  8033e0:	c3                   	ret
+
+008033e1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033e1:	55                   	push   %ebp
+  8033e2:	89 e5                	mov    %esp,%ebp
+  8033e4:	56                   	push   %esi
+  8033e5:	53                   	push   %ebx
+  8033e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8033ef:	85 f6                	test   %esi,%esi
+  8033f1:	74 29                	je     80341c <memcmp+0x3b>
+  8033f3:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8033f5:	0f b6 08             	movzbl (%eax),%ecx
+  8033f8:	0f b6 1a             	movzbl (%edx),%ebx
+  8033fb:	38 d9                	cmp    %bl,%cl
+  8033fd:	75 11                	jne    803410 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8033ff:	83 c0 01             	add    $0x1,%eax
+  803402:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803405:	39 c6                	cmp    %eax,%esi
+  803407:	75 ec                	jne    8033f5 <memcmp+0x14>
+	}
+
+	return 0;
+  803409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340e:	eb 08                	jmp    803418 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  803410:	0f b6 c1             	movzbl %cl,%eax
+  803413:	0f b6 db             	movzbl %bl,%ebx
+  803416:	29 d8                	sub    %ebx,%eax
+}
+  803418:	5b                   	pop    %ebx
+  803419:	5e                   	pop    %esi
+  80341a:	5d                   	pop    %ebp
+  80341b:	c3                   	ret
+	return 0;
+  80341c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803421:	eb f5                	jmp    803418 <memcmp+0x37>
+
+00803423 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803423:	55                   	push   %ebp
+  803424:	89 e5                	mov    %esp,%ebp
+  803426:	8b 45 08             	mov    0x8(%ebp),%eax
+  803429:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80342c:	89 c2                	mov    %eax,%edx
+  80342e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803431:	39 d0                	cmp    %edx,%eax
+  803433:	73 0d                	jae    803442 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803435:	38 08                	cmp    %cl,(%eax)
+  803437:	74 0d                	je     803446 <memfind+0x23>
+	for (; s < ends; s++)
+  803439:	83 c0 01             	add    $0x1,%eax
+  80343c:	39 c2                	cmp    %eax,%edx
+  80343e:	75 f5                	jne    803435 <memfind+0x12>
+  803440:	eb 06                	jmp    803448 <memfind+0x25>
+  803442:	89 c2                	mov    %eax,%edx
+  803444:	eb 02                	jmp    803448 <memfind+0x25>
+  803446:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  803448:	89 d0                	mov    %edx,%eax
+  80344a:	5d                   	pop    %ebp
+  80344b:	c3                   	ret
+
+0080344c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80344c:	55                   	push   %ebp
+  80344d:	89 e5                	mov    %esp,%ebp
+  80344f:	57                   	push   %edi
+  803450:	56                   	push   %esi
+  803451:	53                   	push   %ebx
+  803452:	8b 55 08             	mov    0x8(%ebp),%edx
+  803455:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803458:	0f b6 02             	movzbl (%edx),%eax
+  80345b:	3c 20                	cmp    $0x20,%al
+  80345d:	74 04                	je     803463 <strtol+0x17>
+  80345f:	3c 09                	cmp    $0x9,%al
+  803461:	75 0e                	jne    803471 <strtol+0x25>
+		s++;
+  803463:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803466:	0f b6 02             	movzbl (%edx),%eax
+  803469:	3c 20                	cmp    $0x20,%al
+  80346b:	74 f6                	je     803463 <strtol+0x17>
+  80346d:	3c 09                	cmp    $0x9,%al
+  80346f:	74 f2                	je     803463 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  803471:	3c 2b                	cmp    $0x2b,%al
+  803473:	74 2a                	je     80349f <strtol+0x53>
+	int neg = 0;
+  803475:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80347a:	3c 2d                	cmp    $0x2d,%al
+  80347c:	74 2b                	je     8034a9 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80347e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803484:	75 0f                	jne    803495 <strtol+0x49>
+  803486:	80 3a 30             	cmpb   $0x30,(%edx)
+  803489:	74 28                	je     8034b3 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80348b:	85 db                	test   %ebx,%ebx
+  80348d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803492:	0f 44 d8             	cmove  %eax,%ebx
+  803495:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80349a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80349d:	eb 46                	jmp    8034e5 <strtol+0x99>
+		s++;
+  80349f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8034a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034a7:	eb d5                	jmp    80347e <strtol+0x32>
+		s++, neg = 1;
+  8034a9:	83 c2 01             	add    $0x1,%edx
+  8034ac:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034b1:	eb cb                	jmp    80347e <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034b3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034b7:	74 0e                	je     8034c7 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034b9:	85 db                	test   %ebx,%ebx
+  8034bb:	75 d8                	jne    803495 <strtol+0x49>
+		s++, base = 8;
+  8034bd:	83 c2 01             	add    $0x1,%edx
+  8034c0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034c5:	eb ce                	jmp    803495 <strtol+0x49>
+		s += 2, base = 16;
+  8034c7:	83 c2 02             	add    $0x2,%edx
+  8034ca:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034cf:	eb c4                	jmp    803495 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034d1:	0f be c0             	movsbl %al,%eax
+  8034d4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034d7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034da:	7d 3a                	jge    803516 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034dc:	83 c2 01             	add    $0x1,%edx
+  8034df:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8034e3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8034e5:	0f b6 02             	movzbl (%edx),%eax
+  8034e8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8034eb:	89 f3                	mov    %esi,%ebx
+  8034ed:	80 fb 09             	cmp    $0x9,%bl
+  8034f0:	76 df                	jbe    8034d1 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8034f2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8034f5:	89 f3                	mov    %esi,%ebx
+  8034f7:	80 fb 19             	cmp    $0x19,%bl
+  8034fa:	77 08                	ja     803504 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8034fc:	0f be c0             	movsbl %al,%eax
+  8034ff:	83 e8 57             	sub    $0x57,%eax
+  803502:	eb d3                	jmp    8034d7 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  803504:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803507:	89 f3                	mov    %esi,%ebx
+  803509:	80 fb 19             	cmp    $0x19,%bl
+  80350c:	77 08                	ja     803516 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  80350e:	0f be c0             	movsbl %al,%eax
+  803511:	83 e8 37             	sub    $0x37,%eax
+  803514:	eb c1                	jmp    8034d7 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803516:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80351a:	74 05                	je     803521 <strtol+0xd5>
+		*endptr = (char *) s;
+  80351c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80351f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803521:	89 c8                	mov    %ecx,%eax
+  803523:	f7 d8                	neg    %eax
+  803525:	85 ff                	test   %edi,%edi
+  803527:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80352a:	89 c8                	mov    %ecx,%eax
+  80352c:	5b                   	pop    %ebx
+  80352d:	5e                   	pop    %esi
+  80352e:	5f                   	pop    %edi
+  80352f:	5d                   	pop    %ebp
+  803530:	c3                   	ret
+
+00803531 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803531:	55                   	push   %ebp
+  803532:	89 e5                	mov    %esp,%ebp
+  803534:	56                   	push   %esi
+  803535:	53                   	push   %ebx
+  803536:	8b 75 08             	mov    0x8(%ebp),%esi
+  803539:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80353c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80353f:	85 c0                	test   %eax,%eax
+  803541:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803546:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803549:	83 ec 0c             	sub    $0xc,%esp
+  80354c:	50                   	push   %eax
+  80354d:	e8 0a ce ff ff       	call   80035c <sys_ipc_recv>
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	85 c0                	test   %eax,%eax
+  803557:	0f 88 8b 00 00 00    	js     8035e8 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80355d:	85 f6                	test   %esi,%esi
+  80355f:	74 2a                	je     80358b <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803561:	89 e2                	mov    %esp,%edx
+  803563:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803568:	29 d0                	sub    %edx,%eax
+  80356a:	89 c2                	mov    %eax,%edx
+  80356c:	c1 ea 0f             	shr    $0xf,%edx
+  80356f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803574:	b8 00 00 00 00       	mov    $0x0,%eax
+  803579:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80357c:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803583:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803589:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80358b:	85 db                	test   %ebx,%ebx
+  80358d:	74 2a                	je     8035b9 <ipc_recv+0x88>
+  80358f:	89 e2                	mov    %esp,%edx
+  803591:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803596:	29 d0                	sub    %edx,%eax
+  803598:	89 c2                	mov    %eax,%edx
+  80359a:	c1 ea 0f             	shr    $0xf,%edx
+  80359d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a7:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035aa:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035b1:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035b7:	89 03                	mov    %eax,(%ebx)
+  8035b9:	89 e2                	mov    %esp,%edx
+  8035bb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035c0:	29 d0                	sub    %edx,%eax
+  8035c2:	89 c2                	mov    %eax,%edx
+  8035c4:	c1 ea 0f             	shr    $0xf,%edx
+  8035c7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d1:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035d4:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035db:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035e4:	5b                   	pop    %ebx
+  8035e5:	5e                   	pop    %esi
+  8035e6:	5d                   	pop    %ebp
+  8035e7:	c3                   	ret
+		if(from_env_store != NULL)
+  8035e8:	85 f6                	test   %esi,%esi
+  8035ea:	74 06                	je     8035f2 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035ec:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035f2:	85 db                	test   %ebx,%ebx
+  8035f4:	74 eb                	je     8035e1 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035f6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8035fc:	eb e3                	jmp    8035e1 <ipc_recv+0xb0>
+
+008035fe <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8035fe:	55                   	push   %ebp
+  8035ff:	89 e5                	mov    %esp,%ebp
+  803601:	57                   	push   %edi
+  803602:	56                   	push   %esi
+  803603:	53                   	push   %ebx
+  803604:	83 ec 14             	sub    $0x14,%esp
+  803607:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80360a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80360d:	8b 75 14             	mov    0x14(%ebp),%esi
+  803610:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803613:	85 c0                	test   %eax,%eax
+  803615:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80361a:	0f 44 c2             	cmove  %edx,%eax
+  80361d:	ff 75 10             	push   0x10(%ebp)
+  803620:	50                   	push   %eax
+  803621:	e8 98 cd ff ff       	call   8003be <sys_ipc_recv_pages>
+  803626:	83 c4 10             	add    $0x10,%esp
+  803629:	85 c0                	test   %eax,%eax
+  80362b:	0f 88 ba 00 00 00    	js     8036eb <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803631:	85 ff                	test   %edi,%edi
+  803633:	74 2a                	je     80365f <ipc_recv_pages+0x61>
+  803635:	89 e2                	mov    %esp,%edx
+  803637:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80363c:	29 d0                	sub    %edx,%eax
+  80363e:	89 c2                	mov    %eax,%edx
+  803640:	c1 ea 0f             	shr    $0xf,%edx
+  803643:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364d:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803650:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803657:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80365d:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80365f:	85 f6                	test   %esi,%esi
+  803661:	74 2a                	je     80368d <ipc_recv_pages+0x8f>
+  803663:	89 e2                	mov    %esp,%edx
+  803665:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80366a:	29 d0                	sub    %edx,%eax
+  80366c:	89 c2                	mov    %eax,%edx
+  80366e:	c1 ea 0f             	shr    $0xf,%edx
+  803671:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803676:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367b:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80367e:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803685:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80368b:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80368d:	85 db                	test   %ebx,%ebx
+  80368f:	74 2a                	je     8036bb <ipc_recv_pages+0xbd>
+  803691:	89 e2                	mov    %esp,%edx
+  803693:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803698:	29 d0                	sub    %edx,%eax
+  80369a:	89 c2                	mov    %eax,%edx
+  80369c:	c1 ea 0f             	shr    $0xf,%edx
+  80369f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a9:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036ac:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036b3:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036b9:	89 03                	mov    %eax,(%ebx)
+  8036bb:	89 e2                	mov    %esp,%edx
+  8036bd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036c2:	29 d0                	sub    %edx,%eax
+  8036c4:	89 c2                	mov    %eax,%edx
+  8036c6:	c1 ea 0f             	shr    $0xf,%edx
+  8036c9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d3:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036d6:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036dd:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036e6:	5b                   	pop    %ebx
+  8036e7:	5e                   	pop    %esi
+  8036e8:	5f                   	pop    %edi
+  8036e9:	5d                   	pop    %ebp
+  8036ea:	c3                   	ret
+		if (from_env_store)
+  8036eb:	85 ff                	test   %edi,%edi
+  8036ed:	74 06                	je     8036f5 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036ef:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036f5:	85 f6                	test   %esi,%esi
+  8036f7:	74 06                	je     8036ff <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8036f9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8036ff:	85 db                	test   %ebx,%ebx
+  803701:	74 e0                	je     8036e3 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803703:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803709:	eb d8                	jmp    8036e3 <ipc_recv_pages+0xe5>
+
+0080370b <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80370b:	55                   	push   %ebp
+  80370c:	89 e5                	mov    %esp,%ebp
+  80370e:	57                   	push   %edi
+  80370f:	56                   	push   %esi
+  803710:	53                   	push   %ebx
+  803711:	83 ec 1c             	sub    $0x1c,%esp
+  803714:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803717:	8b 75 08             	mov    0x8(%ebp),%esi
+  80371a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803720:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803724:	75 2b                	jne    803751 <ipc_try_send_pages+0x46>
+  803726:	89 e2                	mov    %esp,%edx
+  803728:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80372d:	29 d0                	sub    %edx,%eax
+  80372f:	89 c2                	mov    %eax,%edx
+  803731:	c1 ea 0f             	shr    $0xf,%edx
+  803734:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373e:	0f 42 c2             	cmovb  %edx,%eax
+  803741:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803748:	8b 70 48             	mov    0x48(%eax),%esi
+  80374b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803751:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803757:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80375c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80375f:	85 ff                	test   %edi,%edi
+  803761:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803766:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803769:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80376f:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803775:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80377b:	83 ec 0c             	sub    $0xc,%esp
+  80377e:	ff 75 14             	push   0x14(%ebp)
+  803781:	ff 75 18             	push   0x18(%ebp)
+  803784:	57                   	push   %edi
+  803785:	ff 75 0c             	push   0xc(%ebp)
+  803788:	ff 75 08             	push   0x8(%ebp)
+  80378b:	e8 0d cc ff ff       	call   80039d <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803790:	83 c4 20             	add    $0x20,%esp
+  803793:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803796:	75 21                	jne    8037b9 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803798:	83 ec 04             	sub    $0x4,%esp
+  80379b:	6a ff                	push   $0xffffffff
+  80379d:	53                   	push   %ebx
+  80379e:	ff 75 e4             	push   -0x1c(%ebp)
+  8037a1:	e8 04 ce ff ff       	call   8005aa <sys_futex_wait>
+  8037a6:	83 c4 10             	add    $0x10,%esp
+  8037a9:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037ac:	74 c7                	je     803775 <ipc_try_send_pages+0x6a>
+  8037ae:	85 c0                	test   %eax,%eax
+  8037b0:	79 c3                	jns    803775 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037b2:	e8 d6 c9 ff ff       	call   80018d <sys_yield>
+  8037b7:	eb bc                	jmp    803775 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037bc:	5b                   	pop    %ebx
+  8037bd:	5e                   	pop    %esi
+  8037be:	5f                   	pop    %edi
+  8037bf:	5d                   	pop    %ebp
+  8037c0:	c3                   	ret
+
+008037c1 <ipc_send>:
+{
+  8037c1:	55                   	push   %ebp
+  8037c2:	89 e5                	mov    %esp,%ebp
+  8037c4:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037c7:	ff 75 14             	push   0x14(%ebp)
+  8037ca:	6a 01                	push   $0x1
+  8037cc:	ff 75 10             	push   0x10(%ebp)
+  8037cf:	ff 75 0c             	push   0xc(%ebp)
+  8037d2:	ff 75 08             	push   0x8(%ebp)
+  8037d5:	e8 31 ff ff ff       	call   80370b <ipc_try_send_pages>
+  8037da:	83 c4 20             	add    $0x20,%esp
+  8037dd:	85 c0                	test   %eax,%eax
+  8037df:	78 02                	js     8037e3 <ipc_send+0x22>
+}
+  8037e1:	c9                   	leave
+  8037e2:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037e3:	50                   	push   %eax
+  8037e4:	68 2b 3f 80 00       	push   $0x803f2b
+  8037e9:	6a 3f                	push   $0x3f
+  8037eb:	68 40 3f 80 00       	push   $0x803f40
+  8037f0:	e8 f2 f1 ff ff       	call   8029e7 <_panic>
+
+008037f5 <ipc_send_pages>:
+{
+  8037f5:	55                   	push   %ebp
+  8037f6:	89 e5                	mov    %esp,%ebp
+  8037f8:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8037fb:	ff 75 18             	push   0x18(%ebp)
+  8037fe:	ff 75 14             	push   0x14(%ebp)
+  803801:	ff 75 10             	push   0x10(%ebp)
+  803804:	ff 75 0c             	push   0xc(%ebp)
+  803807:	ff 75 08             	push   0x8(%ebp)
+  80380a:	e8 fc fe ff ff       	call   80370b <ipc_try_send_pages>
+  80380f:	83 c4 20             	add    $0x20,%esp
+  803812:	85 c0                	test   %eax,%eax
+  803814:	78 02                	js     803818 <ipc_send_pages+0x23>
+}
+  803816:	c9                   	leave
+  803817:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803818:	50                   	push   %eax
+  803819:	68 4a 3f 80 00       	push   $0x803f4a
+  80381e:	6a 64                	push   $0x64
+  803820:	68 40 3f 80 00       	push   $0x803f40
+  803825:	e8 bd f1 ff ff       	call   8029e7 <_panic>
+
+0080382a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80382a:	55                   	push   %ebp
+  80382b:	89 e5                	mov    %esp,%ebp
+  80382d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803830:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803835:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80383b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803841:	8b 52 50             	mov    0x50(%edx),%edx
+  803844:	39 ca                	cmp    %ecx,%edx
+  803846:	74 11                	je     803859 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803848:	83 c0 01             	add    $0x1,%eax
+  80384b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803850:	75 e3                	jne    803835 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803852:	b8 00 00 00 00       	mov    $0x0,%eax
+  803857:	eb 0e                	jmp    803867 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803859:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80385f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803864:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803867:	5d                   	pop    %ebp
+  803868:	c3                   	ret
+
+00803869 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803869:	55                   	push   %ebp
+  80386a:	89 e5                	mov    %esp,%ebp
+  80386c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80386f:	89 c2                	mov    %eax,%edx
+  803871:	c1 ea 16             	shr    $0x16,%edx
+  803874:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80387b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803880:	f6 c1 01             	test   $0x1,%cl
+  803883:	74 1e                	je     8038a3 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803885:	c1 e8 0c             	shr    $0xc,%eax
+  803888:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80388f:	a8 01                	test   $0x1,%al
+  803891:	74 10                	je     8038a3 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803893:	c1 e8 0c             	shr    $0xc,%eax
+  803896:	c1 e0 04             	shl    $0x4,%eax
+  803899:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8038a0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038a3:	89 d0                	mov    %edx,%eax
+  8038a5:	5d                   	pop    %ebp
+  8038a6:	c3                   	ret
+
+008038a7 <__udivdi3>:
+  8038a7:	57                   	push   %edi
+  8038a8:	56                   	push   %esi
+  8038a9:	53                   	push   %ebx
+  8038aa:	83 ec 20             	sub    $0x20,%esp
+  8038ad:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038b1:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038b5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038b9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038bd:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038c1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038c5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038c9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038cd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038dc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038e3:	00 
+  8038e4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038eb:	00 
+  8038ec:	eb 08                	jmp    8038f6 <__udivdi3+0x4f>
+  8038ee:	83 e9 01             	sub    $0x1,%ecx
+  8038f1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038f4:	74 68                	je     80395e <__udivdi3+0xb7>
+  8038f6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038fa:	01 c0                	add    %eax,%eax
+  8038fc:	89 c6                	mov    %eax,%esi
+  8038fe:	89 d7                	mov    %edx,%edi
+  803900:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803904:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803908:	0f ad d0             	shrd   %cl,%edx,%eax
+  80390b:	d3 ea                	shr    %cl,%edx
+  80390d:	f6 c1 20             	test   $0x20,%cl
+  803910:	74 04                	je     803916 <__udivdi3+0x6f>
+  803912:	89 d0                	mov    %edx,%eax
+  803914:	31 d2                	xor    %edx,%edx
+  803916:	83 e0 01             	and    $0x1,%eax
+  803919:	89 04 24             	mov    %eax,(%esp)
+  80391c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803923:	00 
+  803924:	8b 04 24             	mov    (%esp),%eax
+  803927:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80392b:	09 f0                	or     %esi,%eax
+  80392d:	09 fa                	or     %edi,%edx
+  80392f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803933:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803937:	39 f0                	cmp    %esi,%eax
+  803939:	89 d3                	mov    %edx,%ebx
+  80393b:	19 fb                	sbb    %edi,%ebx
+  80393d:	72 af                	jb     8038ee <__udivdi3+0x47>
+  80393f:	29 f0                	sub    %esi,%eax
+  803941:	19 fa                	sbb    %edi,%edx
+  803943:	89 cf                	mov    %ecx,%edi
+  803945:	c1 ef 05             	shr    $0x5,%edi
+  803948:	83 e7 01             	and    $0x1,%edi
+  80394b:	89 fe                	mov    %edi,%esi
+  80394d:	83 f6 01             	xor    $0x1,%esi
+  803950:	d3 e6                	shl    %cl,%esi
+  803952:	d3 e7                	shl    %cl,%edi
+  803954:	09 74 24 18          	or     %esi,0x18(%esp)
+  803958:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80395c:	eb 90                	jmp    8038ee <__udivdi3+0x47>
+  80395e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803962:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803966:	83 c4 20             	add    $0x20,%esp
+  803969:	5b                   	pop    %ebx
+  80396a:	5e                   	pop    %esi
+  80396b:	5f                   	pop    %edi
+  80396c:	c3                   	ret
+
+0080396d <__umoddi3>:
+  80396d:	57                   	push   %edi
+  80396e:	56                   	push   %esi
+  80396f:	53                   	push   %ebx
+  803970:	83 ec 08             	sub    $0x8,%esp
+  803973:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803977:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80397b:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80397f:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803983:	57                   	push   %edi
+  803984:	56                   	push   %esi
+  803985:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803989:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80398d:	52                   	push   %edx
+  80398e:	50                   	push   %eax
+  80398f:	e8 13 ff ff ff       	call   8038a7 <__udivdi3>
+  803994:	89 c3                	mov    %eax,%ebx
+  803996:	0f af d6             	imul   %esi,%edx
+  803999:	89 f9                	mov    %edi,%ecx
+  80399b:	0f af cb             	imul   %ebx,%ecx
+  80399e:	01 d1                	add    %edx,%ecx
+  8039a0:	89 d8                	mov    %ebx,%eax
+  8039a2:	f7 e6                	mul    %esi
+  8039a4:	89 c6                	mov    %eax,%esi
+  8039a6:	89 d7                	mov    %edx,%edi
+  8039a8:	01 cf                	add    %ecx,%edi
+  8039aa:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039ae:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039b2:	29 f0                	sub    %esi,%eax
+  8039b4:	19 fa                	sbb    %edi,%edx
+  8039b6:	83 c4 18             	add    $0x18,%esp
+  8039b9:	5b                   	pop    %ebx
+  8039ba:	5e                   	pop    %esi
+  8039bb:	5f                   	pop    %edi
+  8039bc:	c3                   	ret
+
+008039bd <__divdi3>:
+  8039bd:	53                   	push   %ebx
+  8039be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039c6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039ca:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039ce:	85 d2                	test   %edx,%edx
+  8039d0:	78 12                	js     8039e4 <__divdi3+0x27>
+  8039d2:	85 db                	test   %ebx,%ebx
+  8039d4:	78 2e                	js     803a04 <__divdi3+0x47>
+  8039d6:	53                   	push   %ebx
+  8039d7:	51                   	push   %ecx
+  8039d8:	52                   	push   %edx
+  8039d9:	50                   	push   %eax
+  8039da:	e8 c8 fe ff ff       	call   8038a7 <__udivdi3>
+  8039df:	83 c4 10             	add    $0x10,%esp
+  8039e2:	eb 1e                	jmp    803a02 <__divdi3+0x45>
+  8039e4:	f7 d8                	neg    %eax
+  8039e6:	83 d2 00             	adc    $0x0,%edx
+  8039e9:	f7 da                	neg    %edx
+  8039eb:	85 db                	test   %ebx,%ebx
+  8039ed:	78 2a                	js     803a19 <__divdi3+0x5c>
+  8039ef:	53                   	push   %ebx
+  8039f0:	51                   	push   %ecx
+  8039f1:	52                   	push   %edx
+  8039f2:	50                   	push   %eax
+  8039f3:	e8 af fe ff ff       	call   8038a7 <__udivdi3>
+  8039f8:	83 c4 10             	add    $0x10,%esp
+  8039fb:	f7 d8                	neg    %eax
+  8039fd:	83 d2 00             	adc    $0x0,%edx
+  803a00:	f7 da                	neg    %edx
+  803a02:	5b                   	pop    %ebx
+  803a03:	c3                   	ret
+  803a04:	f7 d9                	neg    %ecx
+  803a06:	83 d3 00             	adc    $0x0,%ebx
+  803a09:	f7 db                	neg    %ebx
+  803a0b:	53                   	push   %ebx
+  803a0c:	51                   	push   %ecx
+  803a0d:	52                   	push   %edx
+  803a0e:	50                   	push   %eax
+  803a0f:	e8 93 fe ff ff       	call   8038a7 <__udivdi3>
+  803a14:	83 c4 10             	add    $0x10,%esp
+  803a17:	eb e2                	jmp    8039fb <__divdi3+0x3e>
+  803a19:	f7 d9                	neg    %ecx
+  803a1b:	83 d3 00             	adc    $0x0,%ebx
+  803a1e:	f7 db                	neg    %ebx
+  803a20:	53                   	push   %ebx
+  803a21:	51                   	push   %ecx
+  803a22:	52                   	push   %edx
+  803a23:	50                   	push   %eax
+  803a24:	e8 7e fe ff ff       	call   8038a7 <__udivdi3>
+  803a29:	83 c4 10             	add    $0x10,%esp
+  803a2c:	eb d4                	jmp    803a02 <__divdi3+0x45>
+
+00803a2e <__moddi3>:
+  803a2e:	57                   	push   %edi
+  803a2f:	56                   	push   %esi
+  803a30:	53                   	push   %ebx
+  803a31:	83 ec 08             	sub    $0x8,%esp
+  803a34:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a38:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a3c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a40:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a44:	57                   	push   %edi
+  803a45:	56                   	push   %esi
+  803a46:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a4a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a4e:	52                   	push   %edx
+  803a4f:	50                   	push   %eax
+  803a50:	e8 68 ff ff ff       	call   8039bd <__divdi3>
+  803a55:	89 c3                	mov    %eax,%ebx
+  803a57:	0f af d6             	imul   %esi,%edx
+  803a5a:	89 f9                	mov    %edi,%ecx
+  803a5c:	0f af cb             	imul   %ebx,%ecx
+  803a5f:	01 d1                	add    %edx,%ecx
+  803a61:	89 d8                	mov    %ebx,%eax
+  803a63:	f7 e6                	mul    %esi
+  803a65:	89 c6                	mov    %eax,%esi
+  803a67:	89 d7                	mov    %edx,%edi
+  803a69:	01 cf                	add    %ecx,%edi
+  803a6b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a6f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a73:	29 f0                	sub    %esi,%eax
+  803a75:	19 fa                	sbb    %edi,%edx
+  803a77:	83 c4 18             	add    $0x18,%esp
+  803a7a:	5b                   	pop    %ebx
+  803a7b:	5e                   	pop    %esi
+  803a7c:	5f                   	pop    %edi
+  803a7d:	c3                   	ret
@@ -0,0 +1,7861 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1f 00 00 00       	call   800050 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs(hello, 1024*1024);
+  80003b:	68 00 00 10 00       	push   $0x100000
+  800040:	ff 35 00 40 80 00    	push   0x804000
+  800046:	e8 ac 00 00 00       	call   8000f7 <sys_cputs>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	56                   	push   %esi
+  800054:	53                   	push   %ebx
+  800055:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800058:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80005b:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80005d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800062:	29 d0                	sub    %edx,%eax
+  800064:	89 c2                	mov    %eax,%edx
+  800066:	c1 ea 0f             	shr    $0xf,%edx
+  800069:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800076:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  80007d:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800081:	e8 ef 00 00 00       	call   800175 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800086:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80008b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800091:	89 e1                	mov    %esp,%ecx
+  800093:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800098:	29 ca                	sub    %ecx,%edx
+  80009a:	89 d1                	mov    %edx,%ecx
+  80009c:	c1 e9 0f             	shr    $0xf,%ecx
+  80009f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	0f 42 d1             	cmovb  %ecx,%edx
+  8000ad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b2:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000b9:	85 db                	test   %ebx,%ebx
+  8000bb:	7e 07                	jle    8000c4 <libmain+0x74>
+		binaryname = argv[0];
+  8000bd:	8b 06                	mov    (%esi),%eax
+  8000bf:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	56                   	push   %esi
+  8000c8:	53                   	push   %ebx
+  8000c9:	e8 67 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000ce:	e8 0a 00 00 00       	call   8000dd <exit>
+}
+  8000d3:	83 c4 10             	add    $0x10,%esp
+  8000d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d9:	5b                   	pop    %ebx
+  8000da:	5e                   	pop    %esi
+  8000db:	5d                   	pop    %ebp
+  8000dc:	c3                   	ret
+
+008000dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000dd:	55                   	push   %ebp
+  8000de:	89 e5                	mov    %esp,%ebp
+  8000e0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e3:	e8 17 07 00 00       	call   8007ff <close_all>
+	sys_env_destroy(0);
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	6a 00                	push   $0x0
+  8000ed:	e8 42 00 00 00       	call   800134 <sys_env_destroy>
+}
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	c9                   	leave
+  8000f6:	c3                   	ret
+
+008000f7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000f7:	55                   	push   %ebp
+  8000f8:	89 e5                	mov    %esp,%ebp
+  8000fa:	57                   	push   %edi
+  8000fb:	56                   	push   %esi
+  8000fc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800102:	8b 55 08             	mov    0x8(%ebp),%edx
+  800105:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800108:	89 c3                	mov    %eax,%ebx
+  80010a:	89 c7                	mov    %eax,%edi
+  80010c:	89 c6                	mov    %eax,%esi
+  80010e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800110:	5b                   	pop    %ebx
+  800111:	5e                   	pop    %esi
+  800112:	5f                   	pop    %edi
+  800113:	5d                   	pop    %ebp
+  800114:	c3                   	ret
+
+00800115 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800115:	55                   	push   %ebp
+  800116:	89 e5                	mov    %esp,%ebp
+  800118:	57                   	push   %edi
+  800119:	56                   	push   %esi
+  80011a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80011b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800120:	b8 01 00 00 00       	mov    $0x1,%eax
+  800125:	89 d1                	mov    %edx,%ecx
+  800127:	89 d3                	mov    %edx,%ebx
+  800129:	89 d7                	mov    %edx,%edi
+  80012b:	89 d6                	mov    %edx,%esi
+  80012d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80012f:	5b                   	pop    %ebx
+  800130:	5e                   	pop    %esi
+  800131:	5f                   	pop    %edi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+
+00800134 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	57                   	push   %edi
+  800138:	56                   	push   %esi
+  800139:	53                   	push   %ebx
+  80013a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80013d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800142:	8b 55 08             	mov    0x8(%ebp),%edx
+  800145:	b8 03 00 00 00       	mov    $0x3,%eax
+  80014a:	89 cb                	mov    %ecx,%ebx
+  80014c:	89 cf                	mov    %ecx,%edi
+  80014e:	89 ce                	mov    %ecx,%esi
+  800150:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800152:	85 c0                	test   %eax,%eax
+  800154:	7f 08                	jg     80015e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5f                   	pop    %edi
+  80015c:	5d                   	pop    %ebp
+  80015d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80015e:	83 ec 0c             	sub    $0xc,%esp
+  800161:	50                   	push   %eax
+  800162:	6a 03                	push   $0x3
+  800164:	68 b8 3a 80 00       	push   $0x803ab8
+  800169:	6a 23                	push   $0x23
+  80016b:	68 d5 3a 80 00       	push   $0x803ad5
+  800170:	e8 79 28 00 00       	call   8029ee <_panic>
+
+00800175 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800175:	55                   	push   %ebp
+  800176:	89 e5                	mov    %esp,%ebp
+  800178:	57                   	push   %edi
+  800179:	56                   	push   %esi
+  80017a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80017b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800180:	b8 02 00 00 00       	mov    $0x2,%eax
+  800185:	89 d1                	mov    %edx,%ecx
+  800187:	89 d3                	mov    %edx,%ebx
+  800189:	89 d7                	mov    %edx,%edi
+  80018b:	89 d6                	mov    %edx,%esi
+  80018d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80018f:	5b                   	pop    %ebx
+  800190:	5e                   	pop    %esi
+  800191:	5f                   	pop    %edi
+  800192:	5d                   	pop    %ebp
+  800193:	c3                   	ret
+
+00800194 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	57                   	push   %edi
+  800198:	56                   	push   %esi
+  800199:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80019a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001a4:	89 d1                	mov    %edx,%ecx
+  8001a6:	89 d3                	mov    %edx,%ebx
+  8001a8:	89 d7                	mov    %edx,%edi
+  8001aa:	89 d6                	mov    %edx,%esi
+  8001ac:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001ae:	5b                   	pop    %ebx
+  8001af:	5e                   	pop    %esi
+  8001b0:	5f                   	pop    %edi
+  8001b1:	5d                   	pop    %ebp
+  8001b2:	c3                   	ret
+
+008001b3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001b3:	55                   	push   %ebp
+  8001b4:	89 e5                	mov    %esp,%ebp
+  8001b6:	57                   	push   %edi
+  8001b7:	56                   	push   %esi
+  8001b8:	53                   	push   %ebx
+  8001b9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001cf:	89 f7                	mov    %esi,%edi
+  8001d1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001d3:	85 c0                	test   %eax,%eax
+  8001d5:	7f 08                	jg     8001df <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001da:	5b                   	pop    %ebx
+  8001db:	5e                   	pop    %esi
+  8001dc:	5f                   	pop    %edi
+  8001dd:	5d                   	pop    %ebp
+  8001de:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001df:	83 ec 0c             	sub    $0xc,%esp
+  8001e2:	50                   	push   %eax
+  8001e3:	6a 04                	push   $0x4
+  8001e5:	68 b8 3a 80 00       	push   $0x803ab8
+  8001ea:	6a 23                	push   $0x23
+  8001ec:	68 d5 3a 80 00       	push   $0x803ad5
+  8001f1:	e8 f8 27 00 00       	call   8029ee <_panic>
+
+008001f6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001f6:	55                   	push   %ebp
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	57                   	push   %edi
+  8001fa:	56                   	push   %esi
+  8001fb:	53                   	push   %ebx
+  8001fc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800202:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800205:	b8 05 00 00 00       	mov    $0x5,%eax
+  80020a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80020d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800210:	8b 75 18             	mov    0x18(%ebp),%esi
+  800213:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800215:	85 c0                	test   %eax,%eax
+  800217:	7f 08                	jg     800221 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800219:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021c:	5b                   	pop    %ebx
+  80021d:	5e                   	pop    %esi
+  80021e:	5f                   	pop    %edi
+  80021f:	5d                   	pop    %ebp
+  800220:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800221:	83 ec 0c             	sub    $0xc,%esp
+  800224:	50                   	push   %eax
+  800225:	6a 05                	push   $0x5
+  800227:	68 b8 3a 80 00       	push   $0x803ab8
+  80022c:	6a 23                	push   $0x23
+  80022e:	68 d5 3a 80 00       	push   $0x803ad5
+  800233:	e8 b6 27 00 00       	call   8029ee <_panic>
+
+00800238 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	57                   	push   %edi
+  80023c:	56                   	push   %esi
+  80023d:	53                   	push   %ebx
+  80023e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800241:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800246:	8b 55 08             	mov    0x8(%ebp),%edx
+  800249:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80024c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800251:	89 df                	mov    %ebx,%edi
+  800253:	89 de                	mov    %ebx,%esi
+  800255:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800257:	85 c0                	test   %eax,%eax
+  800259:	7f 08                	jg     800263 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80025b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025e:	5b                   	pop    %ebx
+  80025f:	5e                   	pop    %esi
+  800260:	5f                   	pop    %edi
+  800261:	5d                   	pop    %ebp
+  800262:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800263:	83 ec 0c             	sub    $0xc,%esp
+  800266:	50                   	push   %eax
+  800267:	6a 06                	push   $0x6
+  800269:	68 b8 3a 80 00       	push   $0x803ab8
+  80026e:	6a 23                	push   $0x23
+  800270:	68 d5 3a 80 00       	push   $0x803ad5
+  800275:	e8 74 27 00 00       	call   8029ee <_panic>
+
+0080027a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80027a:	55                   	push   %ebp
+  80027b:	89 e5                	mov    %esp,%ebp
+  80027d:	57                   	push   %edi
+  80027e:	56                   	push   %esi
+  80027f:	53                   	push   %ebx
+  800280:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800288:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80028e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800293:	89 df                	mov    %ebx,%edi
+  800295:	89 de                	mov    %ebx,%esi
+  800297:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	7f 08                	jg     8002a5 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80029d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5f                   	pop    %edi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a5:	83 ec 0c             	sub    $0xc,%esp
+  8002a8:	50                   	push   %eax
+  8002a9:	6a 08                	push   $0x8
+  8002ab:	68 b8 3a 80 00       	push   $0x803ab8
+  8002b0:	6a 23                	push   $0x23
+  8002b2:	68 d5 3a 80 00       	push   $0x803ad5
+  8002b7:	e8 32 27 00 00       	call   8029ee <_panic>
+
+008002bc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002bc:	55                   	push   %ebp
+  8002bd:	89 e5                	mov    %esp,%ebp
+  8002bf:	57                   	push   %edi
+  8002c0:	56                   	push   %esi
+  8002c1:	53                   	push   %ebx
+  8002c2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002d5:	89 df                	mov    %ebx,%edi
+  8002d7:	89 de                	mov    %ebx,%esi
+  8002d9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002db:	85 c0                	test   %eax,%eax
+  8002dd:	7f 08                	jg     8002e7 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e2:	5b                   	pop    %ebx
+  8002e3:	5e                   	pop    %esi
+  8002e4:	5f                   	pop    %edi
+  8002e5:	5d                   	pop    %ebp
+  8002e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002e7:	83 ec 0c             	sub    $0xc,%esp
+  8002ea:	50                   	push   %eax
+  8002eb:	6a 09                	push   $0x9
+  8002ed:	68 b8 3a 80 00       	push   $0x803ab8
+  8002f2:	6a 23                	push   $0x23
+  8002f4:	68 d5 3a 80 00       	push   $0x803ad5
+  8002f9:	e8 f0 26 00 00       	call   8029ee <_panic>
+
+008002fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	57                   	push   %edi
+  800302:	56                   	push   %esi
+  800303:	53                   	push   %ebx
+  800304:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800307:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80030c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80030f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800312:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800317:	89 df                	mov    %ebx,%edi
+  800319:	89 de                	mov    %ebx,%esi
+  80031b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80031d:	85 c0                	test   %eax,%eax
+  80031f:	7f 08                	jg     800329 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800321:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800324:	5b                   	pop    %ebx
+  800325:	5e                   	pop    %esi
+  800326:	5f                   	pop    %edi
+  800327:	5d                   	pop    %ebp
+  800328:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800329:	83 ec 0c             	sub    $0xc,%esp
+  80032c:	50                   	push   %eax
+  80032d:	6a 0a                	push   $0xa
+  80032f:	68 b8 3a 80 00       	push   $0x803ab8
+  800334:	6a 23                	push   $0x23
+  800336:	68 d5 3a 80 00       	push   $0x803ad5
+  80033b:	e8 ae 26 00 00       	call   8029ee <_panic>
+
+00800340 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	57                   	push   %edi
+  800344:	56                   	push   %esi
+  800345:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800346:	8b 55 08             	mov    0x8(%ebp),%edx
+  800349:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80034c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800351:	be 00 00 00 00       	mov    $0x0,%esi
+  800356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800359:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80035c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80035e:	5b                   	pop    %ebx
+  80035f:	5e                   	pop    %esi
+  800360:	5f                   	pop    %edi
+  800361:	5d                   	pop    %ebp
+  800362:	c3                   	ret
+
+00800363 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800363:	55                   	push   %ebp
+  800364:	89 e5                	mov    %esp,%ebp
+  800366:	57                   	push   %edi
+  800367:	56                   	push   %esi
+  800368:	53                   	push   %ebx
+  800369:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80036c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800371:	8b 55 08             	mov    0x8(%ebp),%edx
+  800374:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800379:	89 cb                	mov    %ecx,%ebx
+  80037b:	89 cf                	mov    %ecx,%edi
+  80037d:	89 ce                	mov    %ecx,%esi
+  80037f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800381:	85 c0                	test   %eax,%eax
+  800383:	7f 08                	jg     80038d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800388:	5b                   	pop    %ebx
+  800389:	5e                   	pop    %esi
+  80038a:	5f                   	pop    %edi
+  80038b:	5d                   	pop    %ebp
+  80038c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80038d:	83 ec 0c             	sub    $0xc,%esp
+  800390:	50                   	push   %eax
+  800391:	6a 0d                	push   $0xd
+  800393:	68 b8 3a 80 00       	push   $0x803ab8
+  800398:	6a 23                	push   $0x23
+  80039a:	68 d5 3a 80 00       	push   $0x803ad5
+  80039f:	e8 4a 26 00 00       	call   8029ee <_panic>
+
+008003a4 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8003a4:	55                   	push   %ebp
+  8003a5:	89 e5                	mov    %esp,%ebp
+  8003a7:	57                   	push   %edi
+  8003a8:	56                   	push   %esi
+  8003a9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003bb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003be:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	57                   	push   %edi
+  8003c9:	56                   	push   %esi
+  8003ca:	53                   	push   %ebx
+  8003cb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003de:	89 df                	mov    %ebx,%edi
+  8003e0:	89 de                	mov    %ebx,%esi
+  8003e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003e4:	85 c0                	test   %eax,%eax
+  8003e6:	7f 08                	jg     8003f0 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003eb:	5b                   	pop    %ebx
+  8003ec:	5e                   	pop    %esi
+  8003ed:	5f                   	pop    %edi
+  8003ee:	5d                   	pop    %ebp
+  8003ef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003f0:	83 ec 0c             	sub    $0xc,%esp
+  8003f3:	50                   	push   %eax
+  8003f4:	6a 0d                	push   $0xd
+  8003f6:	68 b8 3a 80 00       	push   $0x803ab8
+  8003fb:	6a 23                	push   $0x23
+  8003fd:	68 d5 3a 80 00       	push   $0x803ad5
+  800402:	e8 e7 25 00 00       	call   8029ee <_panic>
+
+00800407 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	57                   	push   %edi
+  80040b:	56                   	push   %esi
+  80040c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80040d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800412:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800417:	89 d1                	mov    %edx,%ecx
+  800419:	89 d3                	mov    %edx,%ebx
+  80041b:	89 d7                	mov    %edx,%edi
+  80041d:	89 d6                	mov    %edx,%esi
+  80041f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800421:	5b                   	pop    %ebx
+  800422:	5e                   	pop    %esi
+  800423:	5f                   	pop    %edi
+  800424:	5d                   	pop    %ebp
+  800425:	c3                   	ret
+
+00800426 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800426:	55                   	push   %ebp
+  800427:	89 e5                	mov    %esp,%ebp
+  800429:	57                   	push   %edi
+  80042a:	56                   	push   %esi
+  80042b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80042c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800431:	8b 55 08             	mov    0x8(%ebp),%edx
+  800434:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800437:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80043c:	89 df                	mov    %ebx,%edi
+  80043e:	89 de                	mov    %ebx,%esi
+  800440:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800442:	5b                   	pop    %ebx
+  800443:	5e                   	pop    %esi
+  800444:	5f                   	pop    %edi
+  800445:	5d                   	pop    %ebp
+  800446:	c3                   	ret
+
+00800447 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	57                   	push   %edi
+  80044b:	56                   	push   %esi
+  80044c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80044d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800452:	8b 55 08             	mov    0x8(%ebp),%edx
+  800455:	b8 10 00 00 00       	mov    $0x10,%eax
+  80045a:	89 cb                	mov    %ecx,%ebx
+  80045c:	89 cf                	mov    %ecx,%edi
+  80045e:	89 ce                	mov    %ecx,%esi
+  800460:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800462:	5b                   	pop    %ebx
+  800463:	5e                   	pop    %esi
+  800464:	5f                   	pop    %edi
+  800465:	5d                   	pop    %ebp
+  800466:	c3                   	ret
+
+00800467 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800467:	55                   	push   %ebp
+  800468:	89 e5                	mov    %esp,%ebp
+  80046a:	57                   	push   %edi
+  80046b:	56                   	push   %esi
+  80046c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80046d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800472:	8b 55 08             	mov    0x8(%ebp),%edx
+  800475:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800478:	b8 11 00 00 00       	mov    $0x11,%eax
+  80047d:	89 df                	mov    %ebx,%edi
+  80047f:	89 de                	mov    %ebx,%esi
+  800481:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800483:	5b                   	pop    %ebx
+  800484:	5e                   	pop    %esi
+  800485:	5f                   	pop    %edi
+  800486:	5d                   	pop    %ebp
+  800487:	c3                   	ret
+
+00800488 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800488:	55                   	push   %ebp
+  800489:	89 e5                	mov    %esp,%ebp
+  80048b:	57                   	push   %edi
+  80048c:	56                   	push   %esi
+  80048d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80048e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800493:	8b 55 08             	mov    0x8(%ebp),%edx
+  800496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800499:	b8 12 00 00 00       	mov    $0x12,%eax
+  80049e:	89 df                	mov    %ebx,%edi
+  8004a0:	89 de                	mov    %ebx,%esi
+  8004a2:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8004a4:	5b                   	pop    %ebx
+  8004a5:	5e                   	pop    %esi
+  8004a6:	5f                   	pop    %edi
+  8004a7:	5d                   	pop    %ebp
+  8004a8:	c3                   	ret
+
+008004a9 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8004a9:	55                   	push   %ebp
+  8004aa:	89 e5                	mov    %esp,%ebp
+  8004ac:	57                   	push   %edi
+  8004ad:	56                   	push   %esi
+  8004ae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004bc:	89 cb                	mov    %ecx,%ebx
+  8004be:	89 cf                	mov    %ecx,%edi
+  8004c0:	89 ce                	mov    %ecx,%esi
+  8004c2:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004c4:	5b                   	pop    %ebx
+  8004c5:	5e                   	pop    %esi
+  8004c6:	5f                   	pop    %edi
+  8004c7:	5d                   	pop    %ebp
+  8004c8:	c3                   	ret
+
+008004c9 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004c9:	55                   	push   %ebp
+  8004ca:	89 e5                	mov    %esp,%ebp
+  8004cc:	57                   	push   %edi
+  8004cd:	56                   	push   %esi
+  8004ce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004da:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004df:	89 df                	mov    %ebx,%edi
+  8004e1:	89 de                	mov    %ebx,%esi
+  8004e3:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004e5:	5b                   	pop    %ebx
+  8004e6:	5e                   	pop    %esi
+  8004e7:	5f                   	pop    %edi
+  8004e8:	5d                   	pop    %ebp
+  8004e9:	c3                   	ret
+
+008004ea <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004ea:	55                   	push   %ebp
+  8004eb:	89 e5                	mov    %esp,%ebp
+  8004ed:	57                   	push   %edi
+  8004ee:	56                   	push   %esi
+  8004ef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8004fd:	89 cb                	mov    %ecx,%ebx
+  8004ff:	89 cf                	mov    %ecx,%edi
+  800501:	89 ce                	mov    %ecx,%esi
+  800503:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  800505:	5b                   	pop    %ebx
+  800506:	5e                   	pop    %esi
+  800507:	5f                   	pop    %edi
+  800508:	5d                   	pop    %ebp
+  800509:	c3                   	ret
+
+0080050a <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80050a:	55                   	push   %ebp
+  80050b:	89 e5                	mov    %esp,%ebp
+  80050d:	57                   	push   %edi
+  80050e:	56                   	push   %esi
+  80050f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800510:	be 00 00 00 00       	mov    $0x0,%esi
+  800515:	8b 55 08             	mov    0x8(%ebp),%edx
+  800518:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80051b:	b8 16 00 00 00       	mov    $0x16,%eax
+  800520:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800523:	89 f7                	mov    %esi,%edi
+  800525:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  800527:	5b                   	pop    %ebx
+  800528:	5e                   	pop    %esi
+  800529:	5f                   	pop    %edi
+  80052a:	5d                   	pop    %ebp
+  80052b:	c3                   	ret
+
+0080052c <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80052c:	55                   	push   %ebp
+  80052d:	89 e5                	mov    %esp,%ebp
+  80052f:	57                   	push   %edi
+  800530:	56                   	push   %esi
+  800531:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80053a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800542:	89 df                	mov    %ebx,%edi
+  800544:	89 de                	mov    %ebx,%esi
+  800546:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  800548:	5b                   	pop    %ebx
+  800549:	5e                   	pop    %esi
+  80054a:	5f                   	pop    %edi
+  80054b:	5d                   	pop    %ebp
+  80054c:	c3                   	ret
+
+0080054d <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80054d:	55                   	push   %ebp
+  80054e:	89 e5                	mov    %esp,%ebp
+  800550:	57                   	push   %edi
+  800551:	56                   	push   %esi
+  800552:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800553:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800558:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800560:	89 cb                	mov    %ecx,%ebx
+  800562:	89 cf                	mov    %ecx,%edi
+  800564:	89 ce                	mov    %ecx,%esi
+  800566:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  800568:	5b                   	pop    %ebx
+  800569:	5e                   	pop    %esi
+  80056a:	5f                   	pop    %edi
+  80056b:	5d                   	pop    %ebp
+  80056c:	c3                   	ret
+
+0080056d <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80056d:	55                   	push   %ebp
+  80056e:	89 e5                	mov    %esp,%ebp
+  800570:	57                   	push   %edi
+  800571:	56                   	push   %esi
+  800572:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  800573:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  800577:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80057c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80057f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800584:	89 df                	mov    %ebx,%edi
+  800586:	89 de                	mov    %ebx,%esi
+  800588:	cd 30                	int    $0x30
+}
+  80058a:	5b                   	pop    %ebx
+  80058b:	5e                   	pop    %esi
+  80058c:	5f                   	pop    %edi
+  80058d:	5d                   	pop    %ebp
+  80058e:	c3                   	ret
+
+0080058f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80058f:	55                   	push   %ebp
+  800590:	89 e5                	mov    %esp,%ebp
+  800592:	57                   	push   %edi
+  800593:	56                   	push   %esi
+  800594:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800595:	be 00 00 00 00       	mov    $0x0,%esi
+  80059a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80059d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005a8:	89 f7                	mov    %esi,%edi
+  8005aa:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8005ac:	5b                   	pop    %ebx
+  8005ad:	5e                   	pop    %esi
+  8005ae:	5f                   	pop    %edi
+  8005af:	5d                   	pop    %ebp
+  8005b0:	c3                   	ret
+
+008005b1 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8005b1:	55                   	push   %ebp
+  8005b2:	89 e5                	mov    %esp,%ebp
+  8005b4:	57                   	push   %edi
+  8005b5:	56                   	push   %esi
+  8005b6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005ca:	89 f7                	mov    %esi,%edi
+  8005cc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005ce:	5b                   	pop    %ebx
+  8005cf:	5e                   	pop    %esi
+  8005d0:	5f                   	pop    %edi
+  8005d1:	5d                   	pop    %ebp
+  8005d2:	c3                   	ret
+
+008005d3 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005d3:	55                   	push   %ebp
+  8005d4:	89 e5                	mov    %esp,%ebp
+  8005d6:	57                   	push   %edi
+  8005d7:	56                   	push   %esi
+  8005d8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005e9:	89 df                	mov    %ebx,%edi
+  8005eb:	89 de                	mov    %ebx,%esi
+  8005ed:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005ef:	5b                   	pop    %ebx
+  8005f0:	5e                   	pop    %esi
+  8005f1:	5f                   	pop    %edi
+  8005f2:	5d                   	pop    %ebp
+  8005f3:	c3                   	ret
+
+008005f4 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005f4:	55                   	push   %ebp
+  8005f5:	89 e5                	mov    %esp,%ebp
+  8005f7:	57                   	push   %edi
+  8005f8:	56                   	push   %esi
+  8005f9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800602:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800605:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80060a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80060d:	89 f7                	mov    %esi,%edi
+  80060f:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  800611:	5b                   	pop    %ebx
+  800612:	5e                   	pop    %esi
+  800613:	5f                   	pop    %edi
+  800614:	5d                   	pop    %ebp
+  800615:	c3                   	ret
+
+00800616 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800616:	55                   	push   %ebp
+  800617:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800619:	8b 45 08             	mov    0x8(%ebp),%eax
+  80061c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800621:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800624:	5d                   	pop    %ebp
+  800625:	c3                   	ret
+
+00800626 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800626:	55                   	push   %ebp
+  800627:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800629:	8b 45 08             	mov    0x8(%ebp),%eax
+  80062c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800631:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800636:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80063b:	5d                   	pop    %ebp
+  80063c:	c3                   	ret
+
+0080063d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80063d:	55                   	push   %ebp
+  80063e:	89 e5                	mov    %esp,%ebp
+  800640:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  800645:	89 c2                	mov    %eax,%edx
+  800647:	c1 ea 16             	shr    $0x16,%edx
+  80064a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800651:	f6 c2 01             	test   $0x1,%dl
+  800654:	74 29                	je     80067f <fd_alloc+0x42>
+  800656:	89 c2                	mov    %eax,%edx
+  800658:	c1 ea 0c             	shr    $0xc,%edx
+  80065b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800662:	f6 c2 01             	test   $0x1,%dl
+  800665:	74 18                	je     80067f <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800667:	05 00 10 00 00       	add    $0x1000,%eax
+  80066c:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  800671:	75 d2                	jne    800645 <fd_alloc+0x8>
+  800673:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800678:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80067d:	eb 05                	jmp    800684 <fd_alloc+0x47>
+			return 0;
+  80067f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800684:	8b 55 08             	mov    0x8(%ebp),%edx
+  800687:	89 02                	mov    %eax,(%edx)
+}
+  800689:	89 c8                	mov    %ecx,%eax
+  80068b:	5d                   	pop    %ebp
+  80068c:	c3                   	ret
+
+0080068d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80068d:	55                   	push   %ebp
+  80068e:	89 e5                	mov    %esp,%ebp
+  800690:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800693:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800698:	77 30                	ja     8006ca <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80069a:	c1 e0 0c             	shl    $0xc,%eax
+  80069d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8006a2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006a8:	f6 c2 01             	test   $0x1,%dl
+  8006ab:	74 24                	je     8006d1 <fd_lookup+0x44>
+  8006ad:	89 c2                	mov    %eax,%edx
+  8006af:	c1 ea 0c             	shr    $0xc,%edx
+  8006b2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006b9:	f6 c2 01             	test   $0x1,%dl
+  8006bc:	74 1a                	je     8006d8 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006c1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006c8:	5d                   	pop    %ebp
+  8006c9:	c3                   	ret
+		return -E_INVAL;
+  8006ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006cf:	eb f7                	jmp    8006c8 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d6:	eb f0                	jmp    8006c8 <fd_lookup+0x3b>
+  8006d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006dd:	eb e9                	jmp    8006c8 <fd_lookup+0x3b>
+
+008006df <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006df:	55                   	push   %ebp
+  8006e0:	89 e5                	mov    %esp,%ebp
+  8006e2:	53                   	push   %ebx
+  8006e3:	83 ec 04             	sub    $0x4,%esp
+  8006e6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ee:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8006f3:	39 13                	cmp    %edx,(%ebx)
+  8006f5:	74 54                	je     80074b <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8006f7:	83 c0 01             	add    $0x1,%eax
+  8006fa:	8b 1c 85 60 3b 80 00 	mov    0x803b60(,%eax,4),%ebx
+  800701:	85 db                	test   %ebx,%ebx
+  800703:	75 ee                	jne    8006f3 <dev_lookup+0x14>
+  800705:	89 e1                	mov    %esp,%ecx
+  800707:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80070c:	29 c8                	sub    %ecx,%eax
+  80070e:	89 c1                	mov    %eax,%ecx
+  800710:	c1 e9 0f             	shr    $0xf,%ecx
+  800713:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071d:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800720:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800727:	8b 40 48             	mov    0x48(%eax),%eax
+  80072a:	83 ec 04             	sub    $0x4,%esp
+  80072d:	52                   	push   %edx
+  80072e:	50                   	push   %eax
+  80072f:	68 e4 3a 80 00       	push   $0x803ae4
+  800734:	e8 90 23 00 00       	call   802ac9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800739:	83 c4 10             	add    $0x10,%esp
+  80073c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800741:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800744:	89 1a                	mov    %ebx,(%edx)
+}
+  800746:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800749:	c9                   	leave
+  80074a:	c3                   	ret
+			return 0;
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	eb ef                	jmp    800741 <dev_lookup+0x62>
+
+00800752 <fd_close>:
+{
+  800752:	55                   	push   %ebp
+  800753:	89 e5                	mov    %esp,%ebp
+  800755:	57                   	push   %edi
+  800756:	56                   	push   %esi
+  800757:	53                   	push   %ebx
+  800758:	83 ec 24             	sub    $0x24,%esp
+  80075b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80075e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800761:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800764:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800765:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80076b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80076e:	50                   	push   %eax
+  80076f:	e8 19 ff ff ff       	call   80068d <fd_lookup>
+  800774:	89 c3                	mov    %eax,%ebx
+  800776:	83 c4 10             	add    $0x10,%esp
+  800779:	85 c0                	test   %eax,%eax
+  80077b:	78 05                	js     800782 <fd_close+0x30>
+	    || fd != fd2)
+  80077d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800780:	74 0f                	je     800791 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  800782:	85 ff                	test   %edi,%edi
+  800784:	0f 44 df             	cmove  %edi,%ebx
+}
+  800787:	89 d8                	mov    %ebx,%eax
+  800789:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80078c:	5b                   	pop    %ebx
+  80078d:	5e                   	pop    %esi
+  80078e:	5f                   	pop    %edi
+  80078f:	5d                   	pop    %ebp
+  800790:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800797:	50                   	push   %eax
+  800798:	ff 36                	push   (%esi)
+  80079a:	e8 40 ff ff ff       	call   8006df <dev_lookup>
+  80079f:	89 c3                	mov    %eax,%ebx
+  8007a1:	83 c4 10             	add    $0x10,%esp
+  8007a4:	85 c0                	test   %eax,%eax
+  8007a6:	78 1a                	js     8007c2 <fd_close+0x70>
+		if (dev->dev_close)
+  8007a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007ab:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8007ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007b3:	85 c0                	test   %eax,%eax
+  8007b5:	74 0b                	je     8007c2 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8007b7:	83 ec 0c             	sub    $0xc,%esp
+  8007ba:	56                   	push   %esi
+  8007bb:	ff d0                	call   *%eax
+  8007bd:	89 c3                	mov    %eax,%ebx
+  8007bf:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007c2:	83 ec 08             	sub    $0x8,%esp
+  8007c5:	56                   	push   %esi
+  8007c6:	6a 00                	push   $0x0
+  8007c8:	e8 6b fa ff ff       	call   800238 <sys_page_unmap>
+	return r;
+  8007cd:	83 c4 10             	add    $0x10,%esp
+  8007d0:	eb b5                	jmp    800787 <fd_close+0x35>
+
+008007d2 <close>:
+
+int
+close(int fdnum)
+{
+  8007d2:	55                   	push   %ebp
+  8007d3:	89 e5                	mov    %esp,%ebp
+  8007d5:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007db:	50                   	push   %eax
+  8007dc:	ff 75 08             	push   0x8(%ebp)
+  8007df:	e8 a9 fe ff ff       	call   80068d <fd_lookup>
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	85 c0                	test   %eax,%eax
+  8007e9:	79 02                	jns    8007ed <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007eb:	c9                   	leave
+  8007ec:	c3                   	ret
+		return fd_close(fd, 1);
+  8007ed:	83 ec 08             	sub    $0x8,%esp
+  8007f0:	6a 01                	push   $0x1
+  8007f2:	ff 75 f4             	push   -0xc(%ebp)
+  8007f5:	e8 58 ff ff ff       	call   800752 <fd_close>
+  8007fa:	83 c4 10             	add    $0x10,%esp
+  8007fd:	eb ec                	jmp    8007eb <close+0x19>
+
+008007ff <close_all>:
+
+void
+close_all(void)
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	53                   	push   %ebx
+  800803:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800806:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80080b:	83 ec 0c             	sub    $0xc,%esp
+  80080e:	53                   	push   %ebx
+  80080f:	e8 be ff ff ff       	call   8007d2 <close>
+	for (i = 0; i < MAXFD; i++)
+  800814:	83 c3 01             	add    $0x1,%ebx
+  800817:	83 c4 10             	add    $0x10,%esp
+  80081a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800820:	75 e9                	jne    80080b <close_all+0xc>
+}
+  800822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800825:	c9                   	leave
+  800826:	c3                   	ret
+
+00800827 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800827:	55                   	push   %ebp
+  800828:	89 e5                	mov    %esp,%ebp
+  80082a:	57                   	push   %edi
+  80082b:	56                   	push   %esi
+  80082c:	53                   	push   %ebx
+  80082d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800830:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800833:	50                   	push   %eax
+  800834:	ff 75 08             	push   0x8(%ebp)
+  800837:	e8 51 fe ff ff       	call   80068d <fd_lookup>
+  80083c:	89 c3                	mov    %eax,%ebx
+  80083e:	83 c4 10             	add    $0x10,%esp
+  800841:	85 c0                	test   %eax,%eax
+  800843:	78 7f                	js     8008c4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800845:	83 ec 0c             	sub    $0xc,%esp
+  800848:	ff 75 0c             	push   0xc(%ebp)
+  80084b:	e8 82 ff ff ff       	call   8007d2 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800850:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800853:	c1 e6 0c             	shl    $0xc,%esi
+  800856:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80085c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80085f:	89 3c 24             	mov    %edi,(%esp)
+  800862:	e8 bf fd ff ff       	call   800626 <fd2data>
+  800867:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800869:	89 34 24             	mov    %esi,(%esp)
+  80086c:	e8 b5 fd ff ff       	call   800626 <fd2data>
+  800871:	83 c4 10             	add    $0x10,%esp
+  800874:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  800877:	89 d8                	mov    %ebx,%eax
+  800879:	c1 e8 16             	shr    $0x16,%eax
+  80087c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800883:	a8 01                	test   $0x1,%al
+  800885:	74 11                	je     800898 <dup+0x71>
+  800887:	89 d8                	mov    %ebx,%eax
+  800889:	c1 e8 0c             	shr    $0xc,%eax
+  80088c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800893:	f6 c2 01             	test   $0x1,%dl
+  800896:	75 36                	jne    8008ce <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800898:	89 f8                	mov    %edi,%eax
+  80089a:	c1 e8 0c             	shr    $0xc,%eax
+  80089d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008a4:	83 ec 0c             	sub    $0xc,%esp
+  8008a7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008ac:	50                   	push   %eax
+  8008ad:	56                   	push   %esi
+  8008ae:	6a 00                	push   $0x0
+  8008b0:	57                   	push   %edi
+  8008b1:	6a 00                	push   $0x0
+  8008b3:	e8 3e f9 ff ff       	call   8001f6 <sys_page_map>
+  8008b8:	89 c3                	mov    %eax,%ebx
+  8008ba:	83 c4 20             	add    $0x20,%esp
+  8008bd:	85 c0                	test   %eax,%eax
+  8008bf:	78 33                	js     8008f4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008c4:	89 d8                	mov    %ebx,%eax
+  8008c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c9:	5b                   	pop    %ebx
+  8008ca:	5e                   	pop    %esi
+  8008cb:	5f                   	pop    %edi
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008ce:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008d5:	83 ec 0c             	sub    $0xc,%esp
+  8008d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008dd:	50                   	push   %eax
+  8008de:	ff 75 d4             	push   -0x2c(%ebp)
+  8008e1:	6a 00                	push   $0x0
+  8008e3:	53                   	push   %ebx
+  8008e4:	6a 00                	push   $0x0
+  8008e6:	e8 0b f9 ff ff       	call   8001f6 <sys_page_map>
+  8008eb:	89 c3                	mov    %eax,%ebx
+  8008ed:	83 c4 20             	add    $0x20,%esp
+  8008f0:	85 c0                	test   %eax,%eax
+  8008f2:	79 a4                	jns    800898 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008f4:	83 ec 08             	sub    $0x8,%esp
+  8008f7:	56                   	push   %esi
+  8008f8:	6a 00                	push   $0x0
+  8008fa:	e8 39 f9 ff ff       	call   800238 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008ff:	83 c4 08             	add    $0x8,%esp
+  800902:	ff 75 d4             	push   -0x2c(%ebp)
+  800905:	6a 00                	push   $0x0
+  800907:	e8 2c f9 ff ff       	call   800238 <sys_page_unmap>
+	return r;
+  80090c:	83 c4 10             	add    $0x10,%esp
+  80090f:	eb b3                	jmp    8008c4 <dup+0x9d>
+
+00800911 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	56                   	push   %esi
+  800915:	53                   	push   %ebx
+  800916:	83 ec 18             	sub    $0x18,%esp
+  800919:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80091c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80091f:	50                   	push   %eax
+  800920:	53                   	push   %ebx
+  800921:	e8 67 fd ff ff       	call   80068d <fd_lookup>
+  800926:	83 c4 10             	add    $0x10,%esp
+  800929:	85 c0                	test   %eax,%eax
+  80092b:	78 3c                	js     800969 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80092d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800930:	83 ec 08             	sub    $0x8,%esp
+  800933:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800936:	50                   	push   %eax
+  800937:	ff 36                	push   (%esi)
+  800939:	e8 a1 fd ff ff       	call   8006df <dev_lookup>
+  80093e:	83 c4 10             	add    $0x10,%esp
+  800941:	85 c0                	test   %eax,%eax
+  800943:	78 24                	js     800969 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800945:	8b 46 08             	mov    0x8(%esi),%eax
+  800948:	83 e0 03             	and    $0x3,%eax
+  80094b:	83 f8 01             	cmp    $0x1,%eax
+  80094e:	74 20                	je     800970 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800950:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800953:	8b 40 08             	mov    0x8(%eax),%eax
+  800956:	85 c0                	test   %eax,%eax
+  800958:	74 54                	je     8009ae <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80095a:	83 ec 04             	sub    $0x4,%esp
+  80095d:	ff 75 10             	push   0x10(%ebp)
+  800960:	ff 75 0c             	push   0xc(%ebp)
+  800963:	56                   	push   %esi
+  800964:	ff d0                	call   *%eax
+  800966:	83 c4 10             	add    $0x10,%esp
+}
+  800969:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80096c:	5b                   	pop    %ebx
+  80096d:	5e                   	pop    %esi
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+  800970:	89 e2                	mov    %esp,%edx
+  800972:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800977:	29 d0                	sub    %edx,%eax
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	c1 ea 0f             	shr    $0xf,%edx
+  80097e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800983:	b8 00 00 00 00       	mov    $0x0,%eax
+  800988:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80098b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800992:	8b 40 48             	mov    0x48(%eax),%eax
+  800995:	83 ec 04             	sub    $0x4,%esp
+  800998:	53                   	push   %ebx
+  800999:	50                   	push   %eax
+  80099a:	68 25 3b 80 00       	push   $0x803b25
+  80099f:	e8 25 21 00 00       	call   802ac9 <cprintf>
+		return -E_INVAL;
+  8009a4:	83 c4 10             	add    $0x10,%esp
+  8009a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009ac:	eb bb                	jmp    800969 <read+0x58>
+		return -E_NOT_SUPP;
+  8009ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009b3:	eb b4                	jmp    800969 <read+0x58>
+
+008009b5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009b5:	55                   	push   %ebp
+  8009b6:	89 e5                	mov    %esp,%ebp
+  8009b8:	57                   	push   %edi
+  8009b9:	56                   	push   %esi
+  8009ba:	53                   	push   %ebx
+  8009bb:	83 ec 0c             	sub    $0xc,%esp
+  8009be:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009c1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009c4:	85 f6                	test   %esi,%esi
+  8009c6:	74 30                	je     8009f8 <readn+0x43>
+  8009c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009d2:	83 ec 04             	sub    $0x4,%esp
+  8009d5:	89 f2                	mov    %esi,%edx
+  8009d7:	29 c2                	sub    %eax,%edx
+  8009d9:	52                   	push   %edx
+  8009da:	01 f8                	add    %edi,%eax
+  8009dc:	50                   	push   %eax
+  8009dd:	ff 75 08             	push   0x8(%ebp)
+  8009e0:	e8 2c ff ff ff       	call   800911 <read>
+		if (m < 0)
+  8009e5:	83 c4 10             	add    $0x10,%esp
+  8009e8:	85 c0                	test   %eax,%eax
+  8009ea:	78 15                	js     800a01 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8009ec:	74 11                	je     8009ff <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8009ee:	01 c3                	add    %eax,%ebx
+  8009f0:	89 d8                	mov    %ebx,%eax
+  8009f2:	39 f3                	cmp    %esi,%ebx
+  8009f4:	72 dc                	jb     8009d2 <readn+0x1d>
+  8009f6:	eb 09                	jmp    800a01 <readn+0x4c>
+  8009f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fd:	eb 02                	jmp    800a01 <readn+0x4c>
+  8009ff:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  800a01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a04:	5b                   	pop    %ebx
+  800a05:	5e                   	pop    %esi
+  800a06:	5f                   	pop    %edi
+  800a07:	5d                   	pop    %ebp
+  800a08:	c3                   	ret
+
+00800a09 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	56                   	push   %esi
+  800a0d:	53                   	push   %ebx
+  800a0e:	83 ec 18             	sub    $0x18,%esp
+  800a11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a14:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a17:	50                   	push   %eax
+  800a18:	53                   	push   %ebx
+  800a19:	e8 6f fc ff ff       	call   80068d <fd_lookup>
+  800a1e:	83 c4 10             	add    $0x10,%esp
+  800a21:	85 c0                	test   %eax,%eax
+  800a23:	78 37                	js     800a5c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a25:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a28:	83 ec 08             	sub    $0x8,%esp
+  800a2b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a2e:	50                   	push   %eax
+  800a2f:	ff 36                	push   (%esi)
+  800a31:	e8 a9 fc ff ff       	call   8006df <dev_lookup>
+  800a36:	83 c4 10             	add    $0x10,%esp
+  800a39:	85 c0                	test   %eax,%eax
+  800a3b:	78 1f                	js     800a5c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a3d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a41:	74 20                	je     800a63 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a46:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a49:	85 c0                	test   %eax,%eax
+  800a4b:	74 54                	je     800aa1 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a4d:	83 ec 04             	sub    $0x4,%esp
+  800a50:	ff 75 10             	push   0x10(%ebp)
+  800a53:	ff 75 0c             	push   0xc(%ebp)
+  800a56:	56                   	push   %esi
+  800a57:	ff d0                	call   *%eax
+  800a59:	83 c4 10             	add    $0x10,%esp
+}
+  800a5c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a5f:	5b                   	pop    %ebx
+  800a60:	5e                   	pop    %esi
+  800a61:	5d                   	pop    %ebp
+  800a62:	c3                   	ret
+  800a63:	89 e2                	mov    %esp,%edx
+  800a65:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a6a:	29 d0                	sub    %edx,%eax
+  800a6c:	89 c2                	mov    %eax,%edx
+  800a6e:	c1 ea 0f             	shr    $0xf,%edx
+  800a71:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7b:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a7e:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a85:	8b 40 48             	mov    0x48(%eax),%eax
+  800a88:	83 ec 04             	sub    $0x4,%esp
+  800a8b:	53                   	push   %ebx
+  800a8c:	50                   	push   %eax
+  800a8d:	68 41 3b 80 00       	push   $0x803b41
+  800a92:	e8 32 20 00 00       	call   802ac9 <cprintf>
+		return -E_INVAL;
+  800a97:	83 c4 10             	add    $0x10,%esp
+  800a9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a9f:	eb bb                	jmp    800a5c <write+0x53>
+		return -E_NOT_SUPP;
+  800aa1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800aa6:	eb b4                	jmp    800a5c <write+0x53>
+
+00800aa8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800aae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ab1:	50                   	push   %eax
+  800ab2:	ff 75 08             	push   0x8(%ebp)
+  800ab5:	e8 d3 fb ff ff       	call   80068d <fd_lookup>
+  800aba:	83 c4 10             	add    $0x10,%esp
+  800abd:	85 c0                	test   %eax,%eax
+  800abf:	78 0e                	js     800acf <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800ac1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800acf:	c9                   	leave
+  800ad0:	c3                   	ret
+
+00800ad1 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	53                   	push   %ebx
+  800ad5:	83 ec 1c             	sub    $0x1c,%esp
+  800ad8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800adb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ade:	50                   	push   %eax
+  800adf:	ff 75 08             	push   0x8(%ebp)
+  800ae2:	e8 a6 fb ff ff       	call   80068d <fd_lookup>
+  800ae7:	83 c4 10             	add    $0x10,%esp
+  800aea:	85 c0                	test   %eax,%eax
+  800aec:	78 33                	js     800b21 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800aee:	83 fb 03             	cmp    $0x3,%ebx
+  800af1:	74 28                	je     800b1b <fcntl+0x4a>
+  800af3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af8:	83 fb 04             	cmp    $0x4,%ebx
+  800afb:	75 24                	jne    800b21 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800afd:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800b00:	8b 41 08             	mov    0x8(%ecx),%eax
+  800b03:	80 e4 ef             	and    $0xef,%ah
+  800b06:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b09:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800b0f:	09 d0                	or     %edx,%eax
+  800b11:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b19:	eb 06                	jmp    800b21 <fcntl+0x50>
+		return fd->fd_omode;
+  800b1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1e:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b24:	c9                   	leave
+  800b25:	c3                   	ret
+
+00800b26 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	56                   	push   %esi
+  800b2a:	53                   	push   %ebx
+  800b2b:	83 ec 18             	sub    $0x18,%esp
+  800b2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b31:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b34:	50                   	push   %eax
+  800b35:	53                   	push   %ebx
+  800b36:	e8 52 fb ff ff       	call   80068d <fd_lookup>
+  800b3b:	83 c4 10             	add    $0x10,%esp
+  800b3e:	85 c0                	test   %eax,%eax
+  800b40:	78 34                	js     800b76 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b42:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b45:	83 ec 08             	sub    $0x8,%esp
+  800b48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b4b:	50                   	push   %eax
+  800b4c:	ff 36                	push   (%esi)
+  800b4e:	e8 8c fb ff ff       	call   8006df <dev_lookup>
+  800b53:	83 c4 10             	add    $0x10,%esp
+  800b56:	85 c0                	test   %eax,%eax
+  800b58:	78 1c                	js     800b76 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b5a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b5e:	74 1d                	je     800b7d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b63:	8b 40 18             	mov    0x18(%eax),%eax
+  800b66:	85 c0                	test   %eax,%eax
+  800b68:	74 51                	je     800bbb <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b6a:	83 ec 08             	sub    $0x8,%esp
+  800b6d:	ff 75 0c             	push   0xc(%ebp)
+  800b70:	56                   	push   %esi
+  800b71:	ff d0                	call   *%eax
+  800b73:	83 c4 10             	add    $0x10,%esp
+}
+  800b76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b79:	5b                   	pop    %ebx
+  800b7a:	5e                   	pop    %esi
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+  800b7d:	89 e2                	mov    %esp,%edx
+  800b7f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b84:	29 d0                	sub    %edx,%eax
+  800b86:	89 c2                	mov    %eax,%edx
+  800b88:	c1 ea 0f             	shr    $0xf,%edx
+  800b8b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b95:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800b98:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800b9f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ba2:	83 ec 04             	sub    $0x4,%esp
+  800ba5:	53                   	push   %ebx
+  800ba6:	50                   	push   %eax
+  800ba7:	68 04 3b 80 00       	push   $0x803b04
+  800bac:	e8 18 1f 00 00       	call   802ac9 <cprintf>
+		return -E_INVAL;
+  800bb1:	83 c4 10             	add    $0x10,%esp
+  800bb4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb9:	eb bb                	jmp    800b76 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bbb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bc0:	eb b4                	jmp    800b76 <ftruncate+0x50>
+
+00800bc2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	56                   	push   %esi
+  800bc6:	53                   	push   %ebx
+  800bc7:	83 ec 18             	sub    $0x18,%esp
+  800bca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bcd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bd0:	50                   	push   %eax
+  800bd1:	ff 75 08             	push   0x8(%ebp)
+  800bd4:	e8 b4 fa ff ff       	call   80068d <fd_lookup>
+  800bd9:	83 c4 10             	add    $0x10,%esp
+  800bdc:	85 c0                	test   %eax,%eax
+  800bde:	78 53                	js     800c33 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800be0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800be3:	83 ec 08             	sub    $0x8,%esp
+  800be6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800be9:	50                   	push   %eax
+  800bea:	ff 36                	push   (%esi)
+  800bec:	e8 ee fa ff ff       	call   8006df <dev_lookup>
+  800bf1:	83 c4 10             	add    $0x10,%esp
+  800bf4:	85 c0                	test   %eax,%eax
+  800bf6:	78 3b                	js     800c33 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bfb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bff:	74 39                	je     800c3a <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c01:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c04:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c0b:	00 00 00 
+	stat->st_isdir = 0;
+  800c0e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c15:	00 00 00 
+	stat->st_version = 0;
+  800c18:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c1f:	00 00 00 
+	stat->st_dev = dev;
+  800c22:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c28:	83 ec 08             	sub    $0x8,%esp
+  800c2b:	53                   	push   %ebx
+  800c2c:	56                   	push   %esi
+  800c2d:	ff 50 14             	call   *0x14(%eax)
+  800c30:	83 c4 10             	add    $0x10,%esp
+}
+  800c33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c36:	5b                   	pop    %ebx
+  800c37:	5e                   	pop    %esi
+  800c38:	5d                   	pop    %ebp
+  800c39:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c3a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c3f:	eb f2                	jmp    800c33 <fstat+0x71>
+
+00800c41 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	56                   	push   %esi
+  800c45:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c46:	83 ec 08             	sub    $0x8,%esp
+  800c49:	6a 00                	push   $0x0
+  800c4b:	ff 75 08             	push   0x8(%ebp)
+  800c4e:	e8 b7 01 00 00       	call   800e0a <open>
+  800c53:	89 c3                	mov    %eax,%ebx
+  800c55:	83 c4 10             	add    $0x10,%esp
+  800c58:	85 c0                	test   %eax,%eax
+  800c5a:	78 1b                	js     800c77 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c5c:	83 ec 08             	sub    $0x8,%esp
+  800c5f:	ff 75 0c             	push   0xc(%ebp)
+  800c62:	50                   	push   %eax
+  800c63:	e8 5a ff ff ff       	call   800bc2 <fstat>
+  800c68:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c6a:	89 1c 24             	mov    %ebx,(%esp)
+  800c6d:	e8 60 fb ff ff       	call   8007d2 <close>
+	return r;
+  800c72:	83 c4 10             	add    $0x10,%esp
+  800c75:	89 f3                	mov    %esi,%ebx
+}
+  800c77:	89 d8                	mov    %ebx,%eax
+  800c79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	56                   	push   %esi
+  800c84:	53                   	push   %ebx
+  800c85:	89 c6                	mov    %eax,%esi
+  800c87:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800c89:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800c90:	74 27                	je     800cb9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800c92:	6a 07                	push   $0x7
+  800c94:	68 00 60 80 00       	push   $0x806000
+  800c99:	56                   	push   %esi
+  800c9a:	ff 35 00 50 80 00    	push   0x805000
+  800ca0:	e8 23 2b 00 00       	call   8037c8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800ca5:	83 c4 0c             	add    $0xc,%esp
+  800ca8:	6a 00                	push   $0x0
+  800caa:	53                   	push   %ebx
+  800cab:	6a 00                	push   $0x0
+  800cad:	e8 86 28 00 00       	call   803538 <ipc_recv>
+}
+  800cb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb5:	5b                   	pop    %ebx
+  800cb6:	5e                   	pop    %esi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cb9:	83 ec 0c             	sub    $0xc,%esp
+  800cbc:	6a 02                	push   $0x2
+  800cbe:	e8 6e 2b 00 00       	call   803831 <ipc_find_env>
+  800cc3:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cc8:	83 c4 10             	add    $0x10,%esp
+  800ccb:	eb c5                	jmp    800c92 <fsipc+0x12>
+
+00800ccd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cd9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cde:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce1:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ceb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cf0:	e8 8b ff ff ff       	call   800c80 <fsipc>
+}
+  800cf5:	c9                   	leave
+  800cf6:	c3                   	ret
+
+00800cf7 <devfile_flush>:
+{
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d00:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d03:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d12:	e8 69 ff ff ff       	call   800c80 <fsipc>
+}
+  800d17:	c9                   	leave
+  800d18:	c3                   	ret
+
+00800d19 <devfile_stat>:
+{
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	53                   	push   %ebx
+  800d1d:	83 ec 04             	sub    $0x4,%esp
+  800d20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d26:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d29:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d33:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d38:	e8 43 ff ff ff       	call   800c80 <fsipc>
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	78 37                	js     800d78 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d41:	83 ec 08             	sub    $0x8,%esp
+  800d44:	68 00 60 80 00       	push   $0x806000
+  800d49:	53                   	push   %ebx
+  800d4a:	e8 71 24 00 00       	call   8031c0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d4f:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d54:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d5a:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d5f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d65:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d6a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d70:	83 c4 10             	add    $0x10,%esp
+  800d73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d7b:	c9                   	leave
+  800d7c:	c3                   	ret
+
+00800d7d <devfile_write>:
+{
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+  800d83:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d86:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800d8b:	39 d0                	cmp    %edx,%eax
+  800d8d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d93:	8b 52 0c             	mov    0xc(%edx),%edx
+  800d96:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800d9c:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800da1:	50                   	push   %eax
+  800da2:	ff 75 0c             	push   0xc(%ebp)
+  800da5:	68 08 60 80 00       	push   $0x806008
+  800daa:	e8 c1 25 00 00       	call   803370 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db9:	e8 c2 fe ff ff       	call   800c80 <fsipc>
+}
+  800dbe:	c9                   	leave
+  800dbf:	c3                   	ret
+
+00800dc0 <devfile_read>:
+{
+  800dc0:	55                   	push   %ebp
+  800dc1:	89 e5                	mov    %esp,%ebp
+  800dc3:	53                   	push   %ebx
+  800dc4:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dca:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dcd:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800dd2:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dd5:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800dda:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800ddf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800de4:	e8 97 fe ff ff       	call   800c80 <fsipc>
+  800de9:	89 c3                	mov    %eax,%ebx
+  800deb:	85 c0                	test   %eax,%eax
+  800ded:	78 14                	js     800e03 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800def:	83 ec 04             	sub    $0x4,%esp
+  800df2:	50                   	push   %eax
+  800df3:	68 00 60 80 00       	push   $0x806000
+  800df8:	ff 75 0c             	push   0xc(%ebp)
+  800dfb:	e8 70 25 00 00       	call   803370 <memmove>
+	return r;
+  800e00:	83 c4 10             	add    $0x10,%esp
+}
+  800e03:	89 d8                	mov    %ebx,%eax
+  800e05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e08:	c9                   	leave
+  800e09:	c3                   	ret
+
+00800e0a <open>:
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	53                   	push   %ebx
+  800e0e:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800e11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e14:	50                   	push   %eax
+  800e15:	e8 23 f8 ff ff       	call   80063d <fd_alloc>
+  800e1a:	89 c3                	mov    %eax,%ebx
+  800e1c:	83 c4 10             	add    $0x10,%esp
+  800e1f:	85 c0                	test   %eax,%eax
+  800e21:	78 2a                	js     800e4d <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e23:	83 ec 0c             	sub    $0xc,%esp
+  800e26:	ff 75 08             	push   0x8(%ebp)
+  800e29:	e8 46 23 00 00       	call   803174 <strlen>
+  800e2e:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e31:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e36:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e3b:	7e 17                	jle    800e54 <open+0x4a>
+	fd_close(fd, 1);
+  800e3d:	83 ec 08             	sub    $0x8,%esp
+  800e40:	6a 01                	push   $0x1
+  800e42:	ff 75 f4             	push   -0xc(%ebp)
+  800e45:	e8 08 f9 ff ff       	call   800752 <fd_close>
+	return r;
+  800e4a:	83 c4 10             	add    $0x10,%esp
+}
+  800e4d:	89 d8                	mov    %ebx,%eax
+  800e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e52:	c9                   	leave
+  800e53:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e54:	83 ec 08             	sub    $0x8,%esp
+  800e57:	ff 75 08             	push   0x8(%ebp)
+  800e5a:	68 00 60 80 00       	push   $0x806000
+  800e5f:	e8 5c 23 00 00       	call   8031c0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e67:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e6c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e74:	e8 07 fe ff ff       	call   800c80 <fsipc>
+  800e79:	89 c3                	mov    %eax,%ebx
+  800e7b:	83 c4 10             	add    $0x10,%esp
+  800e7e:	85 c0                	test   %eax,%eax
+  800e80:	78 bb                	js     800e3d <open+0x33>
+	return fd2num(fd); 	
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+  800e85:	ff 75 f4             	push   -0xc(%ebp)
+  800e88:	e8 89 f7 ff ff       	call   800616 <fd2num>
+  800e8d:	89 c3                	mov    %eax,%ebx
+  800e8f:	83 c4 10             	add    $0x10,%esp
+  800e92:	eb b9                	jmp    800e4d <open+0x43>
+
+00800e94 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	53                   	push   %ebx
+  800e98:	83 ec 1c             	sub    $0x1c,%esp
+  800e9b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ea1:	50                   	push   %eax
+  800ea2:	ff 75 08             	push   0x8(%ebp)
+  800ea5:	e8 e3 f7 ff ff       	call   80068d <fd_lookup>
+  800eaa:	83 c4 10             	add    $0x10,%esp
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	78 5a                	js     800f0b <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800eb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb4:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800eba:	39 10                	cmp    %edx,(%eax)
+  800ebc:	75 66                	jne    800f24 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800ebe:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800ec5:	74 49                	je     800f10 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800ec7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eca:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ecd:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800ed2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ed5:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800eda:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ee0:	6a 07                	push   $0x7
+  800ee2:	68 00 60 80 00       	push   $0x806000
+  800ee7:	6a 09                	push   $0x9
+  800ee9:	ff 35 00 50 80 00    	push   0x805000
+  800eef:	e8 d4 28 00 00       	call   8037c8 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800ef4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800efb:	6a 00                	push   $0x0
+  800efd:	53                   	push   %ebx
+  800efe:	ff 75 10             	push   0x10(%ebp)
+  800f01:	6a 00                	push   $0x0
+  800f03:	e8 fd 26 00 00       	call   803605 <ipc_recv_pages>
+  800f08:	83 c4 20             	add    $0x20,%esp
+}
+  800f0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f0e:	c9                   	leave
+  800f0f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+  800f13:	6a 02                	push   $0x2
+  800f15:	e8 17 29 00 00       	call   803831 <ipc_find_env>
+  800f1a:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f1f:	83 c4 10             	add    $0x10,%esp
+  800f22:	eb a3                	jmp    800ec7 <fmap+0x33>
+		return -E_INVAL;
+  800f24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f29:	eb e0                	jmp    800f0b <fmap+0x77>
+
+00800f2b <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	53                   	push   %ebx
+  800f2f:	83 ec 10             	sub    $0x10,%esp
+  800f32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f35:	53                   	push   %ebx
+  800f36:	e8 39 22 00 00       	call   803174 <strlen>
+  800f3b:	83 c4 10             	add    $0x10,%esp
+  800f3e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f43:	7f 25                	jg     800f6a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f45:	83 ec 08             	sub    $0x8,%esp
+  800f48:	53                   	push   %ebx
+  800f49:	68 00 60 80 00       	push   $0x806000
+  800f4e:	e8 6d 22 00 00       	call   8031c0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f58:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f5d:	e8 1e fd ff ff       	call   800c80 <fsipc>
+  800f62:	83 c4 10             	add    $0x10,%esp
+}
+  800f65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f68:	c9                   	leave
+  800f69:	c3                   	ret
+		return -E_BAD_PATH;
+  800f6a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f6f:	eb f4                	jmp    800f65 <remove+0x3a>
+
+00800f71 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f81:	e8 fa fc ff ff       	call   800c80 <fsipc>
+}
+  800f86:	c9                   	leave
+  800f87:	c3                   	ret
+
+00800f88 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800f8e:	68 74 3b 80 00       	push   $0x803b74
+  800f93:	ff 75 0c             	push   0xc(%ebp)
+  800f96:	e8 25 22 00 00       	call   8031c0 <strcpy>
+	return 0;
+}
+  800f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa0:	c9                   	leave
+  800fa1:	c3                   	ret
+
+00800fa2 <devsock_close>:
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	53                   	push   %ebx
+  800fa6:	83 ec 10             	sub    $0x10,%esp
+  800fa9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800fac:	53                   	push   %ebx
+  800fad:	e8 be 28 00 00       	call   803870 <pageref>
+  800fb2:	89 c2                	mov    %eax,%edx
+  800fb4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fbc:	83 fa 01             	cmp    $0x1,%edx
+  800fbf:	74 05                	je     800fc6 <devsock_close+0x24>
+}
+  800fc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fc4:	c9                   	leave
+  800fc5:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	ff 73 0c             	push   0xc(%ebx)
+  800fcc:	e8 b0 05 00 00       	call   801581 <nsipc_close>
+  800fd1:	83 c4 10             	add    $0x10,%esp
+  800fd4:	eb eb                	jmp    800fc1 <devsock_close+0x1f>
+
+00800fd6 <devsock_write>:
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	53                   	push   %ebx
+  800fda:	83 ec 14             	sub    $0x14,%esp
+  800fdd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fe0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fe3:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800fe6:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  800fe9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  800fec:	8b 41 08             	mov    0x8(%ecx),%eax
+  800fef:	c1 f8 09             	sar    $0x9,%eax
+  800ff2:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  800ff5:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  800ffb:	77 13                	ja     801010 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  800ffd:	50                   	push   %eax
+  800ffe:	52                   	push   %edx
+  800fff:	53                   	push   %ebx
+  801000:	ff 71 0c             	push   0xc(%ecx)
+  801003:	e8 5c 06 00 00       	call   801664 <nsipc_send>
+  801008:	83 c4 10             	add    $0x10,%esp
+}
+  80100b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80100e:	c9                   	leave
+  80100f:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801010:	50                   	push   %eax
+  801011:	6a 01                	push   $0x1
+  801013:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801016:	50                   	push   %eax
+  801017:	ff 71 0c             	push   0xc(%ecx)
+  80101a:	e8 a6 06 00 00       	call   8016c5 <nsipc_sendmsg>
+  80101f:	83 c4 10             	add    $0x10,%esp
+  801022:	eb e7                	jmp    80100b <devsock_write+0x35>
+
+00801024 <devsock_read>:
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	53                   	push   %ebx
+  801028:	83 ec 14             	sub    $0x14,%esp
+  80102b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80102e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801031:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801034:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801037:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80103a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80103d:	c1 f8 09             	sar    $0x9,%eax
+  801040:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801043:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801049:	77 13                	ja     80105e <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80104b:	50                   	push   %eax
+  80104c:	52                   	push   %edx
+  80104d:	53                   	push   %ebx
+  80104e:	ff 71 0c             	push   0xc(%ecx)
+  801051:	e8 9c 05 00 00       	call   8015f2 <nsipc_recv>
+  801056:	83 c4 10             	add    $0x10,%esp
+}
+  801059:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80105c:	c9                   	leave
+  80105d:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80105e:	50                   	push   %eax
+  80105f:	6a 01                	push   $0x1
+  801061:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801064:	50                   	push   %eax
+  801065:	ff 71 0c             	push   0xc(%ecx)
+  801068:	e8 02 0a 00 00       	call   801a6f <nsipc_recvmsg>
+  80106d:	83 c4 10             	add    $0x10,%esp
+  801070:	eb e7                	jmp    801059 <devsock_read+0x35>
+
+00801072 <fd2sockid>:
+{
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801078:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80107b:	52                   	push   %edx
+  80107c:	50                   	push   %eax
+  80107d:	e8 0b f6 ff ff       	call   80068d <fd_lookup>
+  801082:	83 c4 10             	add    $0x10,%esp
+  801085:	85 c0                	test   %eax,%eax
+  801087:	78 10                	js     801099 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801089:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80108c:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801092:	39 08                	cmp    %ecx,(%eax)
+  801094:	75 05                	jne    80109b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801096:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801099:	c9                   	leave
+  80109a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80109b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8010a0:	eb f7                	jmp    801099 <fd2sockid+0x27>
+
+008010a2 <sock_flags>:
+{
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8010a8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8010ab:	52                   	push   %edx
+  8010ac:	50                   	push   %eax
+  8010ad:	e8 db f5 ff ff       	call   80068d <fd_lookup>
+  8010b2:	83 c4 10             	add    $0x10,%esp
+  8010b5:	85 c0                	test   %eax,%eax
+  8010b7:	78 0e                	js     8010c7 <sock_flags+0x25>
+  8010b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010bc:	8b 40 08             	mov    0x8(%eax),%eax
+  8010bf:	c1 e8 09             	shr    $0x9,%eax
+  8010c2:	83 e0 08             	and    $0x8,%eax
+}
+  8010c5:	c9                   	leave
+  8010c6:	c3                   	ret
+		return 0;
+  8010c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010cc:	eb f7                	jmp    8010c5 <sock_flags+0x23>
+
+008010ce <alloc_sockfd>:
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	56                   	push   %esi
+  8010d2:	53                   	push   %ebx
+  8010d3:	83 ec 1c             	sub    $0x1c,%esp
+  8010d6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010db:	50                   	push   %eax
+  8010dc:	e8 5c f5 ff ff       	call   80063d <fd_alloc>
+  8010e1:	89 c3                	mov    %eax,%ebx
+  8010e3:	83 c4 10             	add    $0x10,%esp
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	78 43                	js     80112d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010ea:	83 ec 04             	sub    $0x4,%esp
+  8010ed:	68 07 04 00 00       	push   $0x407
+  8010f2:	ff 75 f4             	push   -0xc(%ebp)
+  8010f5:	6a 00                	push   $0x0
+  8010f7:	e8 b7 f0 ff ff       	call   8001b3 <sys_page_alloc>
+  8010fc:	89 c3                	mov    %eax,%ebx
+  8010fe:	83 c4 10             	add    $0x10,%esp
+  801101:	85 c0                	test   %eax,%eax
+  801103:	78 28                	js     80112d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801105:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801108:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  80110e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801110:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801113:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80111a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+  801120:	50                   	push   %eax
+  801121:	e8 f0 f4 ff ff       	call   800616 <fd2num>
+  801126:	89 c3                	mov    %eax,%ebx
+  801128:	83 c4 10             	add    $0x10,%esp
+  80112b:	eb 0c                	jmp    801139 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80112d:	83 ec 0c             	sub    $0xc,%esp
+  801130:	56                   	push   %esi
+  801131:	e8 4b 04 00 00       	call   801581 <nsipc_close>
+		return r;
+  801136:	83 c4 10             	add    $0x10,%esp
+}
+  801139:	89 d8                	mov    %ebx,%eax
+  80113b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80113e:	5b                   	pop    %ebx
+  80113f:	5e                   	pop    %esi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+
+00801142 <accept>:
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	56                   	push   %esi
+  801146:	53                   	push   %ebx
+  801147:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80114a:	89 f0                	mov    %esi,%eax
+  80114c:	e8 21 ff ff ff       	call   801072 <fd2sockid>
+  801151:	89 c3                	mov    %eax,%ebx
+  801153:	85 c0                	test   %eax,%eax
+  801155:	78 24                	js     80117b <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801157:	89 f0                	mov    %esi,%eax
+  801159:	e8 44 ff ff ff       	call   8010a2 <sock_flags>
+  80115e:	50                   	push   %eax
+  80115f:	ff 75 10             	push   0x10(%ebp)
+  801162:	ff 75 0c             	push   0xc(%ebp)
+  801165:	53                   	push   %ebx
+  801166:	e8 6b 03 00 00       	call   8014d6 <nsipc_accept>
+  80116b:	89 c3                	mov    %eax,%ebx
+  80116d:	83 c4 10             	add    $0x10,%esp
+  801170:	85 c0                	test   %eax,%eax
+  801172:	78 07                	js     80117b <accept+0x39>
+	return alloc_sockfd(r);
+  801174:	e8 55 ff ff ff       	call   8010ce <alloc_sockfd>
+  801179:	89 c3                	mov    %eax,%ebx
+}
+  80117b:	89 d8                	mov    %ebx,%eax
+  80117d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5d                   	pop    %ebp
+  801183:	c3                   	ret
+
+00801184 <bind>:
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80118a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118d:	e8 e0 fe ff ff       	call   801072 <fd2sockid>
+  801192:	85 c0                	test   %eax,%eax
+  801194:	78 12                	js     8011a8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801196:	83 ec 04             	sub    $0x4,%esp
+  801199:	ff 75 10             	push   0x10(%ebp)
+  80119c:	ff 75 0c             	push   0xc(%ebp)
+  80119f:	50                   	push   %eax
+  8011a0:	e8 85 03 00 00       	call   80152a <nsipc_bind>
+  8011a5:	83 c4 10             	add    $0x10,%esp
+}
+  8011a8:	c9                   	leave
+  8011a9:	c3                   	ret
+
+008011aa <shutdown>:
+{
+  8011aa:	55                   	push   %ebp
+  8011ab:	89 e5                	mov    %esp,%ebp
+  8011ad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011b3:	e8 ba fe ff ff       	call   801072 <fd2sockid>
+  8011b8:	85 c0                	test   %eax,%eax
+  8011ba:	78 0f                	js     8011cb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011bc:	83 ec 08             	sub    $0x8,%esp
+  8011bf:	ff 75 0c             	push   0xc(%ebp)
+  8011c2:	50                   	push   %eax
+  8011c3:	e8 97 03 00 00       	call   80155f <nsipc_shutdown>
+  8011c8:	83 c4 10             	add    $0x10,%esp
+}
+  8011cb:	c9                   	leave
+  8011cc:	c3                   	ret
+
+008011cd <connect>:
+{
+  8011cd:	55                   	push   %ebp
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d6:	e8 97 fe ff ff       	call   801072 <fd2sockid>
+  8011db:	85 c0                	test   %eax,%eax
+  8011dd:	78 12                	js     8011f1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011df:	83 ec 04             	sub    $0x4,%esp
+  8011e2:	ff 75 10             	push   0x10(%ebp)
+  8011e5:	ff 75 0c             	push   0xc(%ebp)
+  8011e8:	50                   	push   %eax
+  8011e9:	e8 ad 03 00 00       	call   80159b <nsipc_connect>
+  8011ee:	83 c4 10             	add    $0x10,%esp
+}
+  8011f1:	c9                   	leave
+  8011f2:	c3                   	ret
+
+008011f3 <listen>:
+{
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011fc:	e8 71 fe ff ff       	call   801072 <fd2sockid>
+  801201:	85 c0                	test   %eax,%eax
+  801203:	78 0f                	js     801214 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801205:	83 ec 08             	sub    $0x8,%esp
+  801208:	ff 75 0c             	push   0xc(%ebp)
+  80120b:	50                   	push   %eax
+  80120c:	e8 bf 03 00 00       	call   8015d0 <nsipc_listen>
+  801211:	83 c4 10             	add    $0x10,%esp
+}
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+00801216 <sendmsg>:
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+  80121c:	83 ec 0c             	sub    $0xc,%esp
+  80121f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801222:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801225:	89 f0                	mov    %esi,%eax
+  801227:	e8 46 fe ff ff       	call   801072 <fd2sockid>
+  80122c:	89 c3                	mov    %eax,%ebx
+  80122e:	85 c0                	test   %eax,%eax
+  801230:	78 1c                	js     80124e <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801232:	89 f0                	mov    %esi,%eax
+  801234:	e8 69 fe ff ff       	call   8010a2 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801239:	0b 45 10             	or     0x10(%ebp),%eax
+  80123c:	50                   	push   %eax
+  80123d:	ff 77 0c             	push   0xc(%edi)
+  801240:	ff 77 08             	push   0x8(%edi)
+  801243:	53                   	push   %ebx
+  801244:	e8 7c 04 00 00       	call   8016c5 <nsipc_sendmsg>
+  801249:	89 c3                	mov    %eax,%ebx
+  80124b:	83 c4 10             	add    $0x10,%esp
+}
+  80124e:	89 d8                	mov    %ebx,%eax
+  801250:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801253:	5b                   	pop    %ebx
+  801254:	5e                   	pop    %esi
+  801255:	5f                   	pop    %edi
+  801256:	5d                   	pop    %ebp
+  801257:	c3                   	ret
+
+00801258 <recvmsg>:
+{
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	57                   	push   %edi
+  80125c:	56                   	push   %esi
+  80125d:	53                   	push   %ebx
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+  801261:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801264:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801267:	89 f8                	mov    %edi,%eax
+  801269:	e8 04 fe ff ff       	call   801072 <fd2sockid>
+  80126e:	89 c3                	mov    %eax,%ebx
+  801270:	85 c0                	test   %eax,%eax
+  801272:	78 2a                	js     80129e <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801274:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80127b:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801282:	89 f8                	mov    %edi,%eax
+  801284:	e8 19 fe ff ff       	call   8010a2 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801289:	0b 45 10             	or     0x10(%ebp),%eax
+  80128c:	50                   	push   %eax
+  80128d:	ff 76 0c             	push   0xc(%esi)
+  801290:	ff 76 08             	push   0x8(%esi)
+  801293:	53                   	push   %ebx
+  801294:	e8 d6 07 00 00       	call   801a6f <nsipc_recvmsg>
+  801299:	89 c3                	mov    %eax,%ebx
+  80129b:	83 c4 10             	add    $0x10,%esp
+}
+  80129e:	89 d8                	mov    %ebx,%eax
+  8012a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a3:	5b                   	pop    %ebx
+  8012a4:	5e                   	pop    %esi
+  8012a5:	5f                   	pop    %edi
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+
+008012a8 <sendfile>:
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	56                   	push   %esi
+  8012ac:	53                   	push   %ebx
+  8012ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8012b0:	89 f0                	mov    %esi,%eax
+  8012b2:	e8 bb fd ff ff       	call   801072 <fd2sockid>
+  8012b7:	89 c3                	mov    %eax,%ebx
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	78 1f                	js     8012dc <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012bd:	89 f0                	mov    %esi,%eax
+  8012bf:	e8 de fd ff ff       	call   8010a2 <sock_flags>
+  8012c4:	83 ec 0c             	sub    $0xc,%esp
+  8012c7:	50                   	push   %eax
+  8012c8:	ff 75 14             	push   0x14(%ebp)
+  8012cb:	ff 75 10             	push   0x10(%ebp)
+  8012ce:	ff 75 0c             	push   0xc(%ebp)
+  8012d1:	53                   	push   %ebx
+  8012d2:	e8 64 06 00 00       	call   80193b <nsipc_sendfile>
+  8012d7:	89 c3                	mov    %eax,%ebx
+  8012d9:	83 c4 20             	add    $0x20,%esp
+}
+  8012dc:	89 d8                	mov    %ebx,%eax
+  8012de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012e1:	5b                   	pop    %ebx
+  8012e2:	5e                   	pop    %esi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+
+008012e5 <evctl>:
+{
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	53                   	push   %ebx
+  8012e9:	83 ec 04             	sub    $0x4,%esp
+  8012ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8012ef:	89 d8                	mov    %ebx,%eax
+  8012f1:	e8 7c fd ff ff       	call   801072 <fd2sockid>
+  8012f6:	85 c0                	test   %eax,%eax
+  8012f8:	78 10                	js     80130a <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8012fa:	83 ec 04             	sub    $0x4,%esp
+  8012fd:	53                   	push   %ebx
+  8012fe:	ff 75 0c             	push   0xc(%ebp)
+  801301:	50                   	push   %eax
+  801302:	e8 d2 0b 00 00       	call   801ed9 <nsipc_evctl>
+  801307:	83 c4 10             	add    $0x10,%esp
+}
+  80130a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+0080130f <evwait>:
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801315:	ff 75 10             	push   0x10(%ebp)
+  801318:	ff 75 0c             	push   0xc(%ebp)
+  80131b:	ff 75 08             	push   0x8(%ebp)
+  80131e:	e8 e0 0b 00 00       	call   801f03 <nsipc_evwait>
+}
+  801323:	c9                   	leave
+  801324:	c3                   	ret
+
+00801325 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801325:	55                   	push   %ebp
+  801326:	89 e5                	mov    %esp,%ebp
+  801328:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80132b:	ff 75 10             	push   0x10(%ebp)
+  80132e:	ff 75 0c             	push   0xc(%ebp)
+  801331:	ff 75 08             	push   0x8(%ebp)
+  801334:	e8 31 0c 00 00       	call   801f6a <nsipc_socket>
+  801339:	83 c4 10             	add    $0x10,%esp
+  80133c:	85 c0                	test   %eax,%eax
+  80133e:	78 05                	js     801345 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801340:	e8 89 fd ff ff       	call   8010ce <alloc_sockfd>
+}
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+
+00801347 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 04             	sub    $0x4,%esp
+  80134e:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801350:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801357:	74 26                	je     80137f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801359:	6a 07                	push   $0x7
+  80135b:	68 00 70 80 00       	push   $0x807000
+  801360:	53                   	push   %ebx
+  801361:	ff 35 24 53 80 00    	push   0x805324
+  801367:	e8 5c 24 00 00       	call   8037c8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80136c:	83 c4 0c             	add    $0xc,%esp
+  80136f:	6a 00                	push   $0x0
+  801371:	6a 00                	push   $0x0
+  801373:	6a 00                	push   $0x0
+  801375:	e8 be 21 00 00       	call   803538 <ipc_recv>
+}
+  80137a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80137d:	c9                   	leave
+  80137e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80137f:	83 ec 0c             	sub    $0xc,%esp
+  801382:	6a 03                	push   $0x3
+  801384:	e8 a8 24 00 00       	call   803831 <ipc_find_env>
+  801389:	a3 24 53 80 00       	mov    %eax,0x805324
+  80138e:	83 c4 10             	add    $0x10,%esp
+  801391:	eb c6                	jmp    801359 <nsipc+0x12>
+
+00801393 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801398:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  80139e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8013a3:	85 f6                	test   %esi,%esi
+  8013a5:	75 33                	jne    8013da <nsbulk_map+0x47>
+  8013a7:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8013ac:	83 ec 04             	sub    $0x4,%esp
+  8013af:	6a 07                	push   $0x7
+  8013b1:	53                   	push   %ebx
+  8013b2:	6a 00                	push   $0x0
+  8013b4:	e8 fa ed ff ff       	call   8001b3 <sys_page_alloc>
+  8013b9:	83 c4 10             	add    $0x10,%esp
+  8013bc:	85 c0                	test   %eax,%eax
+  8013be:	78 1a                	js     8013da <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013c0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013c6:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013cc:	75 de                	jne    8013ac <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013ce:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013d5:	00 00 00 
+	return 0;
+  8013d8:	89 f0                	mov    %esi,%eax
+}
+  8013da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013dd:	5b                   	pop    %ebx
+  8013de:	5e                   	pop    %esi
+  8013df:	5d                   	pop    %ebp
+  8013e0:	c3                   	ret
+
+008013e1 <nsbulk_own>:
+{
+  8013e1:	55                   	push   %ebp
+  8013e2:	89 e5                	mov    %esp,%ebp
+  8013e4:	57                   	push   %edi
+  8013e5:	56                   	push   %esi
+  8013e6:	53                   	push   %ebx
+  8013e7:	83 ec 0c             	sub    $0xc,%esp
+  8013ea:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8013ec:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8013ef:	85 d2                	test   %edx,%edx
+  8013f1:	7f 0e                	jg     801401 <nsbulk_own+0x20>
+	return 0;
+  8013f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f8:	eb 47                	jmp    801441 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8013fa:	83 c3 01             	add    $0x1,%ebx
+  8013fd:	39 fb                	cmp    %edi,%ebx
+  8013ff:	7d 3b                	jge    80143c <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801401:	be 01 00 00 00       	mov    $0x1,%esi
+  801406:	89 d9                	mov    %ebx,%ecx
+  801408:	d3 e6                	shl    %cl,%esi
+  80140a:	89 f0                	mov    %esi,%eax
+  80140c:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  801412:	74 e6                	je     8013fa <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801414:	83 ec 04             	sub    $0x4,%esp
+  801417:	6a 07                	push   $0x7
+  801419:	89 d8                	mov    %ebx,%eax
+  80141b:	c1 e0 0c             	shl    $0xc,%eax
+  80141e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801423:	50                   	push   %eax
+  801424:	6a 00                	push   $0x0
+  801426:	e8 88 ed ff ff       	call   8001b3 <sys_page_alloc>
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	85 c0                	test   %eax,%eax
+  801430:	78 0f                	js     801441 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801432:	f7 d6                	not    %esi
+  801434:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  80143a:	eb be                	jmp    8013fa <nsbulk_own+0x19>
+	return 0;
+  80143c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801441:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801444:	5b                   	pop    %ebx
+  801445:	5e                   	pop    %esi
+  801446:	5f                   	pop    %edi
+  801447:	5d                   	pop    %ebp
+  801448:	c3                   	ret
+
+00801449 <nsipc_bulk>:
+{
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	57                   	push   %edi
+  80144d:	56                   	push   %esi
+  80144e:	53                   	push   %ebx
+  80144f:	83 ec 1c             	sub    $0x1c,%esp
+  801452:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801455:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801457:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80145d:	c1 fb 0c             	sar    $0xc,%ebx
+  801460:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  801463:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80146a:	74 56                	je     8014c2 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80146c:	85 ff                	test   %edi,%edi
+  80146e:	7e 24                	jle    801494 <nsipc_bulk+0x4b>
+  801470:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801476:	74 1c                	je     801494 <nsipc_bulk+0x4b>
+  801478:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80147e:	c1 e3 0c             	shl    $0xc,%ebx
+  801481:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801486:	0f b6 10             	movzbl (%eax),%edx
+  801489:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80148b:	05 00 10 00 00       	add    $0x1000,%eax
+  801490:	39 d8                	cmp    %ebx,%eax
+  801492:	75 f2                	jne    801486 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801494:	83 ec 0c             	sub    $0xc,%esp
+  801497:	56                   	push   %esi
+  801498:	57                   	push   %edi
+  801499:	68 00 00 00 e0       	push   $0xe0000000
+  80149e:	ff 75 e4             	push   -0x1c(%ebp)
+  8014a1:	ff 35 24 53 80 00    	push   0x805324
+  8014a7:	e8 50 23 00 00       	call   8037fc <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8014ac:	83 c4 1c             	add    $0x1c,%esp
+  8014af:	6a 00                	push   $0x0
+  8014b1:	6a 00                	push   $0x0
+  8014b3:	6a 00                	push   $0x0
+  8014b5:	e8 7e 20 00 00       	call   803538 <ipc_recv>
+}
+  8014ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014bd:	5b                   	pop    %ebx
+  8014be:	5e                   	pop    %esi
+  8014bf:	5f                   	pop    %edi
+  8014c0:	5d                   	pop    %ebp
+  8014c1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014c2:	83 ec 0c             	sub    $0xc,%esp
+  8014c5:	6a 03                	push   $0x3
+  8014c7:	e8 65 23 00 00       	call   803831 <ipc_find_env>
+  8014cc:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014d1:	83 c4 10             	add    $0x10,%esp
+  8014d4:	eb 96                	jmp    80146c <nsipc_bulk+0x23>
+
+008014d6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	53                   	push   %ebx
+  8014da:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014e0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014e8:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8014ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f2:	e8 50 fe ff ff       	call   801347 <nsipc>
+  8014f7:	89 c3                	mov    %eax,%ebx
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	79 07                	jns    801504 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8014fd:	89 d8                	mov    %ebx,%eax
+  8014ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801502:	c9                   	leave
+  801503:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801504:	83 ec 04             	sub    $0x4,%esp
+  801507:	ff 35 10 70 80 00    	push   0x807010
+  80150d:	68 00 70 80 00       	push   $0x807000
+  801512:	ff 75 0c             	push   0xc(%ebp)
+  801515:	e8 56 1e 00 00       	call   803370 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80151a:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801520:	8b 45 10             	mov    0x10(%ebp),%eax
+  801523:	89 10                	mov    %edx,(%eax)
+  801525:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801528:	eb d3                	jmp    8014fd <nsipc_accept+0x27>
+
+0080152a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80152a:	55                   	push   %ebp
+  80152b:	89 e5                	mov    %esp,%ebp
+  80152d:	53                   	push   %ebx
+  80152e:	83 ec 08             	sub    $0x8,%esp
+  801531:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801534:	8b 45 08             	mov    0x8(%ebp),%eax
+  801537:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80153c:	53                   	push   %ebx
+  80153d:	ff 75 0c             	push   0xc(%ebp)
+  801540:	68 04 70 80 00       	push   $0x807004
+  801545:	e8 26 1e 00 00       	call   803370 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80154a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801550:	b8 02 00 00 00       	mov    $0x2,%eax
+  801555:	e8 ed fd ff ff       	call   801347 <nsipc>
+}
+  80155a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80155d:	c9                   	leave
+  80155e:	c3                   	ret
+
+0080155f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801565:	8b 45 08             	mov    0x8(%ebp),%eax
+  801568:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80156d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801570:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801575:	b8 03 00 00 00       	mov    $0x3,%eax
+  80157a:	e8 c8 fd ff ff       	call   801347 <nsipc>
+}
+  80157f:	c9                   	leave
+  801580:	c3                   	ret
+
+00801581 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801581:	55                   	push   %ebp
+  801582:	89 e5                	mov    %esp,%ebp
+  801584:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801587:	8b 45 08             	mov    0x8(%ebp),%eax
+  80158a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80158f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801594:	e8 ae fd ff ff       	call   801347 <nsipc>
+}
+  801599:	c9                   	leave
+  80159a:	c3                   	ret
+
+0080159b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80159b:	55                   	push   %ebp
+  80159c:	89 e5                	mov    %esp,%ebp
+  80159e:	53                   	push   %ebx
+  80159f:	83 ec 08             	sub    $0x8,%esp
+  8015a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8015a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8015ad:	53                   	push   %ebx
+  8015ae:	ff 75 0c             	push   0xc(%ebp)
+  8015b1:	68 04 70 80 00       	push   $0x807004
+  8015b6:	e8 b5 1d 00 00       	call   803370 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015bb:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015c1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015c6:	e8 7c fd ff ff       	call   801347 <nsipc>
+}
+  8015cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ce:	c9                   	leave
+  8015cf:	c3                   	ret
+
+008015d0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015d0:	55                   	push   %ebp
+  8015d1:	89 e5                	mov    %esp,%ebp
+  8015d3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015e1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015e6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015eb:	e8 57 fd ff ff       	call   801347 <nsipc>
+}
+  8015f0:	c9                   	leave
+  8015f1:	c3                   	ret
+
+008015f2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	56                   	push   %esi
+  8015f6:	53                   	push   %ebx
+  8015f7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8015fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015fd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801602:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80160b:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801610:	b8 07 00 00 00       	mov    $0x7,%eax
+  801615:	e8 2d fd ff ff       	call   801347 <nsipc>
+  80161a:	89 c3                	mov    %eax,%ebx
+  80161c:	85 c0                	test   %eax,%eax
+  80161e:	78 22                	js     801642 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801620:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801625:	39 c6                	cmp    %eax,%esi
+  801627:	0f 4e c6             	cmovle %esi,%eax
+  80162a:	39 c3                	cmp    %eax,%ebx
+  80162c:	7f 1d                	jg     80164b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80162e:	83 ec 04             	sub    $0x4,%esp
+  801631:	53                   	push   %ebx
+  801632:	68 00 70 80 00       	push   $0x807000
+  801637:	ff 75 0c             	push   0xc(%ebp)
+  80163a:	e8 31 1d 00 00       	call   803370 <memmove>
+  80163f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801642:	89 d8                	mov    %ebx,%eax
+  801644:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801647:	5b                   	pop    %ebx
+  801648:	5e                   	pop    %esi
+  801649:	5d                   	pop    %ebp
+  80164a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80164b:	68 80 3b 80 00       	push   $0x803b80
+  801650:	68 95 3b 80 00       	push   $0x803b95
+  801655:	68 b2 00 00 00       	push   $0xb2
+  80165a:	68 aa 3b 80 00       	push   $0x803baa
+  80165f:	e8 8a 13 00 00       	call   8029ee <_panic>
+
+00801664 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801664:	55                   	push   %ebp
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	53                   	push   %ebx
+  801668:	83 ec 04             	sub    $0x4,%esp
+  80166b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80166e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801671:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801676:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80167c:	7f 2e                	jg     8016ac <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80167e:	83 ec 04             	sub    $0x4,%esp
+  801681:	53                   	push   %ebx
+  801682:	ff 75 0c             	push   0xc(%ebp)
+  801685:	68 0c 70 80 00       	push   $0x80700c
+  80168a:	e8 e1 1c 00 00       	call   803370 <memmove>
+	nsipcbuf.send.req_size = size;
+  80168f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801695:	8b 45 14             	mov    0x14(%ebp),%eax
+  801698:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80169d:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016a2:	e8 a0 fc ff ff       	call   801347 <nsipc>
+}
+  8016a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016aa:	c9                   	leave
+  8016ab:	c3                   	ret
+	assert(size < 1600);
+  8016ac:	68 b6 3b 80 00       	push   $0x803bb6
+  8016b1:	68 95 3b 80 00       	push   $0x803b95
+  8016b6:	68 bd 00 00 00       	push   $0xbd
+  8016bb:	68 aa 3b 80 00       	push   $0x803baa
+  8016c0:	e8 29 13 00 00       	call   8029ee <_panic>
+
+008016c5 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	57                   	push   %edi
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016ce:	e8 c0 fc ff ff       	call   801393 <nsbulk_map>
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	78 55                	js     80172c <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016d7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016de:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016e5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8016ec:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8016ef:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016f2:	0f 8d 24 02 00 00    	jge    80191c <nsipc_sendmsg+0x257>
+  8016f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016fe:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  801701:	89 d8                	mov    %ebx,%eax
+  801703:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801708:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80170a:	83 ec 0c             	sub    $0xc,%esp
+  80170d:	68 20 50 80 00       	push   $0x805020
+  801712:	e8 5a 0f 00 00       	call   802671 <pgbatch_init>
+  801717:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80171a:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80171c:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80171f:	e9 82 00 00 00       	jmp    8017a6 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  801724:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801727:	85 db                	test   %ebx,%ebx
+  801729:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  80172c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80172f:	5b                   	pop    %ebx
+  801730:	5e                   	pop    %esi
+  801731:	5f                   	pop    %edi
+  801732:	5d                   	pop    %ebp
+  801733:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  801734:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801739:	29 c8                	sub    %ecx,%eax
+  80173b:	39 d0                	cmp    %edx,%eax
+  80173d:	0f 46 d0             	cmovbe %eax,%edx
+  801740:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  801742:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801748:	85 ff                	test   %edi,%edi
+  80174a:	0f 49 c7             	cmovns %edi,%eax
+  80174d:	c1 f8 0c             	sar    $0xc,%eax
+  801750:	ba 01 00 00 00       	mov    $0x1,%edx
+  801755:	e8 87 fc ff ff       	call   8013e1 <nsbulk_own>
+  80175a:	85 c0                	test   %eax,%eax
+  80175c:	0f 88 17 01 00 00    	js     801879 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  801762:	83 ec 04             	sub    $0x4,%esp
+  801765:	56                   	push   %esi
+  801766:	ff 75 e0             	push   -0x20(%ebp)
+  801769:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80176c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801771:	50                   	push   %eax
+  801772:	e8 f9 1b 00 00       	call   803370 <memmove>
+  801777:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80177a:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80177d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801780:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801783:	0f 84 fd 00 00 00    	je     801886 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801789:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80178c:	01 f7                	add    %esi,%edi
+  80178e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801791:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801794:	0f 8d 01 01 00 00    	jge    80189b <nsipc_sendmsg+0x1d6>
+  80179a:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8017a0:	0f 8f f0 00 00 00    	jg     801896 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8017a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017a9:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8017ac:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8017af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017b2:	89 c2                	mov    %eax,%edx
+  8017b4:	03 13                	add    (%ebx),%edx
+  8017b6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017b9:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017bc:	29 c6                	sub    %eax,%esi
+  8017be:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017c3:	29 f9                	sub    %edi,%ecx
+  8017c5:	39 ce                	cmp    %ecx,%esi
+  8017c7:	89 ca                	mov    %ecx,%edx
+  8017c9:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017cc:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017cf:	89 f9                	mov    %edi,%ecx
+  8017d1:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017da:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017df:	09 c8                	or     %ecx,%eax
+  8017e1:	0f 85 4d ff ff ff    	jne    801734 <nsipc_sendmsg+0x6f>
+  8017e7:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017ed:	0f 86 41 ff ff ff    	jbe    801734 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017f3:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8017f9:	85 ff                	test   %edi,%edi
+  8017fb:	0f 49 c7             	cmovns %edi,%eax
+  8017fe:	c1 f8 0c             	sar    $0xc,%eax
+  801801:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  801803:	89 d1                	mov    %edx,%ecx
+  801805:	c1 e9 0c             	shr    $0xc,%ecx
+  801808:	01 c8                	add    %ecx,%eax
+  80180a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80180d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801810:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  801812:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801815:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80181a:	29 c8                	sub    %ecx,%eax
+  80181c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80181f:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801822:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801824:	b8 01 00 00 00       	mov    $0x1,%eax
+  801829:	89 f9                	mov    %edi,%ecx
+  80182b:	d3 e0                	shl    %cl,%eax
+  80182d:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801833:	83 ec 08             	sub    $0x8,%esp
+  801836:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801838:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80183b:	50                   	push   %eax
+  80183c:	6a 00                	push   $0x0
+  80183e:	56                   	push   %esi
+  80183f:	6a 00                	push   $0x0
+  801841:	68 20 50 80 00       	push   $0x805020
+  801846:	e8 e4 0e 00 00       	call   80272f <pgbatch_map>
+  80184b:	83 c4 20             	add    $0x20,%esp
+  80184e:	85 c0                	test   %eax,%eax
+  801850:	0f 88 ce fe ff ff    	js     801724 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  801856:	83 c7 01             	add    $0x1,%edi
+  801859:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80185f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801862:	39 c7                	cmp    %eax,%edi
+  801864:	75 be                	jne    801824 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  801866:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801869:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80186c:	89 d6                	mov    %edx,%esi
+  80186e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801874:	e9 01 ff ff ff       	jmp    80177a <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801879:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80187c:	85 db                	test   %ebx,%ebx
+  80187e:	0f 45 c3             	cmovne %ebx,%eax
+  801881:	e9 a6 fe ff ff       	jmp    80172c <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  801886:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80188a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801891:	e9 f3 fe ff ff       	jmp    801789 <nsipc_sendmsg+0xc4>
+  801896:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801899:	eb 03                	jmp    80189e <nsipc_sendmsg+0x1d9>
+  80189b:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80189e:	83 ec 0c             	sub    $0xc,%esp
+  8018a1:	68 20 50 80 00       	push   $0x805020
+  8018a6:	e8 d4 0d 00 00       	call   80267f <pgbatch_flush>
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	78 50                	js     801902 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8018b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b5:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018ba:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018c0:	89 fb                	mov    %edi,%ebx
+  8018c2:	29 f3                	sub    %esi,%ebx
+  8018c4:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018cd:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018d2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018d7:	89 fa                	mov    %edi,%edx
+  8018d9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018de:	e8 66 fb ff ff       	call   801449 <nsipc_bulk>
+  8018e3:	85 c0                	test   %eax,%eax
+  8018e5:	78 28                	js     80190f <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018e7:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8018ea:	39 c3                	cmp    %eax,%ebx
+  8018ec:	75 0c                	jne    8018fa <nsipc_sendmsg+0x235>
+  8018ee:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018f1:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8018f4:	0f 8f f2 fd ff ff    	jg     8016ec <nsipc_sendmsg+0x27>
+		sent += r;
+  8018fa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018fd:	e9 2a fe ff ff       	jmp    80172c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801902:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801905:	85 db                	test   %ebx,%ebx
+  801907:	0f 45 c3             	cmovne %ebx,%eax
+  80190a:	e9 1d fe ff ff       	jmp    80172c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80190f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801912:	85 db                	test   %ebx,%ebx
+  801914:	0f 45 c3             	cmovne %ebx,%eax
+  801917:	e9 10 fe ff ff       	jmp    80172c <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  80191c:	83 ec 0c             	sub    $0xc,%esp
+  80191f:	68 20 50 80 00       	push   $0x805020
+  801924:	e8 48 0d 00 00       	call   802671 <pgbatch_init>
+  801929:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80192c:	be 00 00 00 00       	mov    $0x0,%esi
+  801931:	bf 00 00 00 00       	mov    $0x0,%edi
+  801936:	e9 63 ff ff ff       	jmp    80189e <nsipc_sendmsg+0x1d9>
+
+0080193b <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+  80193e:	57                   	push   %edi
+  80193f:	56                   	push   %esi
+  801940:	53                   	push   %ebx
+  801941:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  801944:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  80194b:	0f 84 c8 00 00 00    	je     801a19 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  801951:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801958:	0f 84 e4 00 00 00    	je     801a42 <nsipc_sendfile+0x107>
+{
+  80195e:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  801963:	89 fb                	mov    %edi,%ebx
+  801965:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801968:	0f 83 f0 00 00 00    	jae    801a5e <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80196e:	89 fa                	mov    %edi,%edx
+  801970:	03 55 10             	add    0x10(%ebp),%edx
+  801973:	89 d0                	mov    %edx,%eax
+  801975:	c1 f8 1f             	sar    $0x1f,%eax
+  801978:	c1 e8 14             	shr    $0x14,%eax
+  80197b:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80197e:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801984:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801986:	6a 10                	push   $0x10
+  801988:	68 00 20 01 e0       	push   $0xe0012000
+  80198d:	52                   	push   %edx
+  80198e:	ff 75 0c             	push   0xc(%ebp)
+  801991:	e8 fe f4 ff ff       	call   800e94 <fmap>
+  801996:	83 c4 10             	add    $0x10,%esp
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	0f 8e b8 00 00 00    	jle    801a59 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8019a1:	39 c6                	cmp    %eax,%esi
+  8019a3:	0f 8d b5 00 00 00    	jge    801a5e <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8019a9:	29 f0                	sub    %esi,%eax
+  8019ab:	8b 55 14             	mov    0x14(%ebp),%edx
+  8019ae:	29 da                	sub    %ebx,%edx
+  8019b0:	39 d0                	cmp    %edx,%eax
+  8019b2:	89 d3                	mov    %edx,%ebx
+  8019b4:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8019b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ba:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019bf:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019c5:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019cb:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019ce:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019d3:	83 ec 0c             	sub    $0xc,%esp
+  8019d6:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019d8:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019df:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019e2:	83 c0 01             	add    $0x1,%eax
+  8019e5:	50                   	push   %eax
+  8019e6:	68 00 10 01 e0       	push   $0xe0011000
+  8019eb:	6a 11                	push   $0x11
+  8019ed:	ff 35 24 53 80 00    	push   0x805324
+  8019f3:	e8 04 1e 00 00       	call   8037fc <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8019f8:	83 c4 1c             	add    $0x1c,%esp
+  8019fb:	6a 00                	push   $0x0
+  8019fd:	6a 00                	push   $0x0
+  8019ff:	6a 00                	push   $0x0
+  801a01:	e8 32 1b 00 00       	call   803538 <ipc_recv>
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	78 5b                	js     801a68 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  801a0d:	01 c7                	add    %eax,%edi
+		if (r < n)
+  801a0f:	39 c3                	cmp    %eax,%ebx
+  801a11:	0f 8e 4c ff ff ff    	jle    801963 <nsipc_sendfile+0x28>
+  801a17:	eb 45                	jmp    801a5e <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a19:	83 ec 04             	sub    $0x4,%esp
+  801a1c:	6a 07                	push   $0x7
+  801a1e:	68 00 10 01 e0       	push   $0xe0011000
+  801a23:	6a 00                	push   $0x0
+  801a25:	e8 89 e7 ff ff       	call   8001b3 <sys_page_alloc>
+  801a2a:	89 c7                	mov    %eax,%edi
+  801a2c:	83 c4 10             	add    $0x10,%esp
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 2b                	js     801a5e <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a33:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a3a:	00 00 00 
+  801a3d:	e9 0f ff ff ff       	jmp    801951 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a42:	83 ec 0c             	sub    $0xc,%esp
+  801a45:	6a 03                	push   $0x3
+  801a47:	e8 e5 1d 00 00       	call   803831 <ipc_find_env>
+  801a4c:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	e9 05 ff ff ff       	jmp    80195e <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a59:	85 ff                	test   %edi,%edi
+  801a5b:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a5e:	89 f8                	mov    %edi,%eax
+  801a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a63:	5b                   	pop    %ebx
+  801a64:	5e                   	pop    %esi
+  801a65:	5f                   	pop    %edi
+  801a66:	5d                   	pop    %ebp
+  801a67:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a68:	85 ff                	test   %edi,%edi
+  801a6a:	0f 44 f8             	cmove  %eax,%edi
+  801a6d:	eb ef                	jmp    801a5e <nsipc_sendfile+0x123>
+
+00801a6f <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	57                   	push   %edi
+  801a73:	56                   	push   %esi
+  801a74:	53                   	push   %ebx
+  801a75:	83 ec 1c             	sub    $0x1c,%esp
+  801a78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a7b:	e8 13 f9 ff ff       	call   801393 <nsbulk_map>
+  801a80:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a83:	85 c0                	test   %eax,%eax
+  801a85:	0f 88 ba 00 00 00    	js     801b45 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a8b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a8f:	0f 8e bb 00 00 00    	jle    801b50 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801a95:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a9a:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801a9f:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801aa4:	89 f8                	mov    %edi,%eax
+  801aa6:	29 f0                	sub    %esi,%eax
+  801aa8:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801aac:	39 c8                	cmp    %ecx,%eax
+  801aae:	0f 47 c1             	cmova  %ecx,%eax
+  801ab1:	01 f0                	add    %esi,%eax
+  801ab3:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ab5:	83 c2 01             	add    $0x1,%edx
+  801ab8:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801abb:	7e 07                	jle    801ac4 <nsipc_recvmsg+0x55>
+  801abd:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801ac2:	7e e0                	jle    801aa4 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801ac4:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801aca:	c1 fa 0c             	sar    $0xc,%edx
+  801acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad2:	e8 0a f9 ff ff       	call   8013e1 <nsbulk_own>
+  801ad7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ada:	85 c0                	test   %eax,%eax
+  801adc:	78 67                	js     801b45 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801ade:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801ae6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801aec:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aef:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801af4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801af9:	89 f2                	mov    %esi,%edx
+  801afb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b00:	e8 44 f9 ff ff       	call   801449 <nsipc_bulk>
+  801b05:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 39                	js     801b45 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801b0c:	39 f0                	cmp    %esi,%eax
+  801b0e:	7f 4a                	jg     801b5a <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801b10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	7e 2c                	jle    801b45 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b19:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b1c:	29 fe                	sub    %edi,%esi
+  801b1e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b21:	39 c6                	cmp    %eax,%esi
+  801b23:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b26:	83 ec 04             	sub    $0x4,%esp
+  801b29:	56                   	push   %esi
+  801b2a:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b30:	50                   	push   %eax
+  801b31:	ff 33                	push   (%ebx)
+  801b33:	e8 38 18 00 00       	call   803370 <memmove>
+		n += m;
+  801b38:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b3a:	83 c3 08             	add    $0x8,%ebx
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b43:	7f d4                	jg     801b19 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b45:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b4b:	5b                   	pop    %ebx
+  801b4c:	5e                   	pop    %esi
+  801b4d:	5f                   	pop    %edi
+  801b4e:	5d                   	pop    %ebp
+  801b4f:	c3                   	ret
+	int r, i, n, len = 0;
+  801b50:	be 00 00 00 00       	mov    $0x0,%esi
+  801b55:	e9 6a ff ff ff       	jmp    801ac4 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b5a:	68 8c 3b 80 00       	push   $0x803b8c
+  801b5f:	68 95 3b 80 00       	push   $0x803b95
+  801b64:	68 3b 01 00 00       	push   $0x13b
+  801b69:	68 aa 3b 80 00       	push   $0x803baa
+  801b6e:	e8 7b 0e 00 00       	call   8029ee <_panic>
+
+00801b73 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b73:	55                   	push   %ebp
+  801b74:	89 e5                	mov    %esp,%ebp
+  801b76:	57                   	push   %edi
+  801b77:	56                   	push   %esi
+  801b78:	53                   	push   %ebx
+  801b79:	83 ec 0c             	sub    $0xc,%esp
+  801b7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b7f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b82:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b88:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801b8d:	8b 07                	mov    (%edi),%eax
+  801b8f:	a3 04 70 80 00       	mov    %eax,0x807004
+  801b94:	8b 47 04             	mov    0x4(%edi),%eax
+  801b97:	a3 08 70 80 00       	mov    %eax,0x807008
+  801b9c:	8b 47 08             	mov    0x8(%edi),%eax
+  801b9f:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801ba4:	8b 47 0c             	mov    0xc(%edi),%eax
+  801ba7:	a3 10 70 80 00       	mov    %eax,0x807010
+  801bac:	8b 47 10             	mov    0x10(%edi),%eax
+  801baf:	a3 14 70 80 00       	mov    %eax,0x807014
+  801bb4:	8b 47 14             	mov    0x14(%edi),%eax
+  801bb7:	a3 18 70 80 00       	mov    %eax,0x807018
+  801bbc:	8b 47 18             	mov    0x18(%edi),%eax
+  801bbf:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bc4:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bc7:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bcc:	8b 47 20             	mov    0x20(%edi),%eax
+  801bcf:	a3 24 70 80 00       	mov    %eax,0x807024
+  801bd4:	8b 47 24             	mov    0x24(%edi),%eax
+  801bd7:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bdc:	8b 47 28             	mov    0x28(%edi),%eax
+  801bdf:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801be4:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801be7:	a3 30 70 80 00       	mov    %eax,0x807030
+  801bec:	8b 47 30             	mov    0x30(%edi),%eax
+  801bef:	a3 34 70 80 00       	mov    %eax,0x807034
+  801bf4:	8b 47 34             	mov    0x34(%edi),%eax
+  801bf7:	a3 38 70 80 00       	mov    %eax,0x807038
+  801bfc:	8b 47 38             	mov    0x38(%edi),%eax
+  801bff:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801c04:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801c07:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801c0c:	8b 06                	mov    (%esi),%eax
+  801c0e:	a3 44 70 80 00       	mov    %eax,0x807044
+  801c13:	8b 46 04             	mov    0x4(%esi),%eax
+  801c16:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c1b:	8b 46 08             	mov    0x8(%esi),%eax
+  801c1e:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c23:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c26:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c2b:	8b 46 10             	mov    0x10(%esi),%eax
+  801c2e:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c33:	8b 46 14             	mov    0x14(%esi),%eax
+  801c36:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c3b:	8b 46 18             	mov    0x18(%esi),%eax
+  801c3e:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c43:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c46:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c4b:	8b 46 20             	mov    0x20(%esi),%eax
+  801c4e:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c53:	8b 46 24             	mov    0x24(%esi),%eax
+  801c56:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c5b:	8b 46 28             	mov    0x28(%esi),%eax
+  801c5e:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c63:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c66:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c6b:	8b 46 30             	mov    0x30(%esi),%eax
+  801c6e:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c73:	8b 46 34             	mov    0x34(%esi),%eax
+  801c76:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c7b:	8b 46 38             	mov    0x38(%esi),%eax
+  801c7e:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c83:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c86:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801c8b:	8b 03                	mov    (%ebx),%eax
+  801c8d:	a3 84 70 80 00       	mov    %eax,0x807084
+  801c92:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c95:	a3 88 70 80 00       	mov    %eax,0x807088
+  801c9a:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c9d:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801ca2:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ca5:	a3 90 70 80 00       	mov    %eax,0x807090
+  801caa:	8b 43 10             	mov    0x10(%ebx),%eax
+  801cad:	a3 94 70 80 00       	mov    %eax,0x807094
+  801cb2:	8b 43 14             	mov    0x14(%ebx),%eax
+  801cb5:	a3 98 70 80 00       	mov    %eax,0x807098
+  801cba:	8b 43 18             	mov    0x18(%ebx),%eax
+  801cbd:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801cc2:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cc5:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cca:	8b 43 20             	mov    0x20(%ebx),%eax
+  801ccd:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801cd2:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cd5:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cda:	8b 43 28             	mov    0x28(%ebx),%eax
+  801cdd:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801ce2:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801ce5:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801cea:	8b 43 30             	mov    0x30(%ebx),%eax
+  801ced:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801cf2:	8b 43 34             	mov    0x34(%ebx),%eax
+  801cf5:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801cfa:	8b 43 38             	mov    0x38(%ebx),%eax
+  801cfd:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801d02:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801d05:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801d0a:	8b 45 18             	mov    0x18(%ebp),%eax
+  801d0d:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801d12:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d17:	e8 2b f6 ff ff       	call   801347 <nsipc>
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	0f 88 ad 01 00 00    	js     801ed1 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d24:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d2a:	89 17                	mov    %edx,(%edi)
+  801d2c:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d32:	89 57 04             	mov    %edx,0x4(%edi)
+  801d35:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d3b:	89 57 08             	mov    %edx,0x8(%edi)
+  801d3e:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d44:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d47:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d4d:	89 57 10             	mov    %edx,0x10(%edi)
+  801d50:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d56:	89 57 14             	mov    %edx,0x14(%edi)
+  801d59:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d5f:	89 57 18             	mov    %edx,0x18(%edi)
+  801d62:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d68:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d6b:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d71:	89 57 20             	mov    %edx,0x20(%edi)
+  801d74:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d7a:	89 57 24             	mov    %edx,0x24(%edi)
+  801d7d:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d83:	89 57 28             	mov    %edx,0x28(%edi)
+  801d86:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801d8c:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801d8f:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801d95:	89 57 30             	mov    %edx,0x30(%edi)
+  801d98:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801d9e:	89 57 34             	mov    %edx,0x34(%edi)
+  801da1:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801da7:	89 57 38             	mov    %edx,0x38(%edi)
+  801daa:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801db0:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801db3:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801db9:	89 16                	mov    %edx,(%esi)
+  801dbb:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801dc1:	89 56 04             	mov    %edx,0x4(%esi)
+  801dc4:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801dca:	89 56 08             	mov    %edx,0x8(%esi)
+  801dcd:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dd3:	89 56 0c             	mov    %edx,0xc(%esi)
+  801dd6:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801ddc:	89 56 10             	mov    %edx,0x10(%esi)
+  801ddf:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801de5:	89 56 14             	mov    %edx,0x14(%esi)
+  801de8:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801dee:	89 56 18             	mov    %edx,0x18(%esi)
+  801df1:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801df7:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801dfa:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801e00:	89 56 20             	mov    %edx,0x20(%esi)
+  801e03:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801e09:	89 56 24             	mov    %edx,0x24(%esi)
+  801e0c:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801e12:	89 56 28             	mov    %edx,0x28(%esi)
+  801e15:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e1b:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e1e:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e24:	89 56 30             	mov    %edx,0x30(%esi)
+  801e27:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e2d:	89 56 34             	mov    %edx,0x34(%esi)
+  801e30:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e36:	89 56 38             	mov    %edx,0x38(%esi)
+  801e39:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e3f:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e42:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e48:	89 13                	mov    %edx,(%ebx)
+  801e4a:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e50:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e53:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e59:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e5c:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e62:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e65:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e6b:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e6e:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e74:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e77:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e7d:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e80:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e86:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801e89:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801e8f:	89 53 20             	mov    %edx,0x20(%ebx)
+  801e92:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801e98:	89 53 24             	mov    %edx,0x24(%ebx)
+  801e9b:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801ea1:	89 53 28             	mov    %edx,0x28(%ebx)
+  801ea4:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801eaa:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801ead:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801eb3:	89 53 30             	mov    %edx,0x30(%ebx)
+  801eb6:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801ebc:	89 53 34             	mov    %edx,0x34(%ebx)
+  801ebf:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801ec5:	89 53 38             	mov    %edx,0x38(%ebx)
+  801ec8:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801ece:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801ed1:	83 c4 0c             	add    $0xc,%esp
+  801ed4:	5b                   	pop    %ebx
+  801ed5:	5e                   	pop    %esi
+  801ed6:	5f                   	pop    %edi
+  801ed7:	5d                   	pop    %ebp
+  801ed8:	c3                   	ret
+
+00801ed9 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801ee7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eea:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801eef:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ef2:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801ef7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801efc:	e8 46 f4 ff ff       	call   801347 <nsipc>
+}
+  801f01:	c9                   	leave
+  801f02:	c3                   	ret
+
+00801f03 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	56                   	push   %esi
+  801f07:	53                   	push   %ebx
+  801f08:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801f0b:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801f11:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f14:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f19:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f1e:	e8 24 f4 ff ff       	call   801347 <nsipc>
+  801f23:	89 c3                	mov    %eax,%ebx
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	7e 1f                	jle    801f48 <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f29:	39 c6                	cmp    %eax,%esi
+  801f2b:	7c 24                	jl     801f51 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f2d:	83 ec 04             	sub    $0x4,%esp
+  801f30:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f37:	50                   	push   %eax
+  801f38:	68 00 70 80 00       	push   $0x807000
+  801f3d:	ff 75 08             	push   0x8(%ebp)
+  801f40:	e8 2b 14 00 00       	call   803370 <memmove>
+  801f45:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f48:	89 d8                	mov    %ebx,%eax
+  801f4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4d:	5b                   	pop    %ebx
+  801f4e:	5e                   	pop    %esi
+  801f4f:	5d                   	pop    %ebp
+  801f50:	c3                   	ret
+		assert(r <= max);
+  801f51:	68 c2 3b 80 00       	push   $0x803bc2
+  801f56:	68 95 3b 80 00       	push   $0x803b95
+  801f5b:	68 6a 01 00 00       	push   $0x16a
+  801f60:	68 aa 3b 80 00       	push   $0x803baa
+  801f65:	e8 84 0a 00 00       	call   8029ee <_panic>
+
+00801f6a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f6a:	55                   	push   %ebp
+  801f6b:	89 e5                	mov    %esp,%ebp
+  801f6d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f73:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f7b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f80:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f83:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f88:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f8d:	e8 b5 f3 ff ff       	call   801347 <nsipc>
+}
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+
+00801f94 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801fa2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fa7:	e8 9b f3 ff ff       	call   801347 <nsipc>
+}
+  801fac:	c9                   	leave
+  801fad:	c3                   	ret
+
+00801fae <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801fae:	55                   	push   %ebp
+  801faf:	89 e5                	mov    %esp,%ebp
+  801fb1:	53                   	push   %ebx
+  801fb2:	83 ec 04             	sub    $0x4,%esp
+  801fb5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fb8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fbd:	e8 85 f3 ff ff       	call   801347 <nsipc>
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	78 50                	js     802016 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fc6:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fcc:	89 13                	mov    %edx,(%ebx)
+  801fce:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801fd4:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fd7:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801fdd:	89 53 08             	mov    %edx,0x8(%ebx)
+  801fe0:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801fe6:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801fe9:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801fef:	89 53 10             	mov    %edx,0x10(%ebx)
+  801ff2:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801ff8:	89 53 14             	mov    %edx,0x14(%ebx)
+  801ffb:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  802001:	89 53 18             	mov    %edx,0x18(%ebx)
+  802004:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  80200a:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80200d:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802013:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802016:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802019:	c9                   	leave
+  80201a:	c3                   	ret
+
+0080201b <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802021:	6a 03                	push   $0x3
+  802023:	e8 09 18 00 00       	call   803831 <ipc_find_env>
+  802028:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  80202d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802030:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802035:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80203a:	e8 08 f3 ff ff       	call   801347 <nsipc>
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	85 c0                	test   %eax,%eax
+  802044:	78 0a                	js     802050 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802046:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  80204b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+
+00802052 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802052:	55                   	push   %ebp
+  802053:	89 e5                	mov    %esp,%ebp
+  802055:	57                   	push   %edi
+  802056:	56                   	push   %esi
+  802057:	53                   	push   %ebx
+  802058:	83 ec 1c             	sub    $0x1c,%esp
+  80205b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80205e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802061:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80206b:	89 e0                	mov    %esp,%eax
+  80206d:	89 f2                	mov    %esi,%edx
+  80206f:	29 c2                	sub    %eax,%edx
+  802071:	89 d0                	mov    %edx,%eax
+  802073:	c1 e8 0f             	shr    $0xf,%eax
+  802076:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80207c:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80207f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802086:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802089:	83 ec 0c             	sub    $0xc,%esp
+  80208c:	ff 75 e0             	push   -0x20(%ebp)
+  80208f:	e8 dc 17 00 00       	call   803870 <pageref>
+  802094:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802097:	83 c4 04             	add    $0x4,%esp
+  80209a:	ff 75 dc             	push   -0x24(%ebp)
+  80209d:	e8 ce 17 00 00       	call   803870 <pageref>
+  8020a2:	89 e2                	mov    %esp,%edx
+  8020a4:	89 f1                	mov    %esi,%ecx
+  8020a6:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8020a8:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8020ab:	89 ca                	mov    %ecx,%edx
+  8020ad:	c1 ea 0f             	shr    $0xf,%edx
+  8020b0:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8020b6:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020b9:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020c0:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020c3:	39 d7                	cmp    %edx,%edi
+  8020c5:	74 40                	je     802107 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020c7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020ca:	75 9f                	jne    80206b <_pipeisclosed+0x19>
+  8020cc:	89 e2                	mov    %esp,%edx
+  8020ce:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020d3:	29 d0                	sub    %edx,%eax
+  8020d5:	89 c2                	mov    %eax,%edx
+  8020d7:	c1 ea 0f             	shr    $0xf,%edx
+  8020da:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e4:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020e7:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020ee:	8b 40 58             	mov    0x58(%eax),%eax
+  8020f1:	6a 01                	push   $0x1
+  8020f3:	50                   	push   %eax
+  8020f4:	57                   	push   %edi
+  8020f5:	68 cb 3b 80 00       	push   $0x803bcb
+  8020fa:	e8 ca 09 00 00       	call   802ac9 <cprintf>
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	e9 5f ff ff ff       	jmp    802066 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802107:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80210a:	0f 94 c0             	sete   %al
+  80210d:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802110:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802113:	5b                   	pop    %ebx
+  802114:	5e                   	pop    %esi
+  802115:	5f                   	pop    %edi
+  802116:	5d                   	pop    %ebp
+  802117:	c3                   	ret
+
+00802118 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802118:	55                   	push   %ebp
+  802119:	89 e5                	mov    %esp,%ebp
+  80211b:	53                   	push   %ebx
+  80211c:	83 ec 0c             	sub    $0xc,%esp
+  80211f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802122:	53                   	push   %ebx
+  802123:	6a 00                	push   $0x0
+  802125:	e8 0e e1 ff ff       	call   800238 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80212a:	89 1c 24             	mov    %ebx,(%esp)
+  80212d:	e8 f4 e4 ff ff       	call   800626 <fd2data>
+  802132:	83 c4 08             	add    $0x8,%esp
+  802135:	50                   	push   %eax
+  802136:	6a 00                	push   $0x0
+  802138:	e8 fb e0 ff ff       	call   800238 <sys_page_unmap>
+}
+  80213d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802140:	c9                   	leave
+  802141:	c3                   	ret
+
+00802142 <devpipe_read>:
+{
+  802142:	55                   	push   %ebp
+  802143:	89 e5                	mov    %esp,%ebp
+  802145:	57                   	push   %edi
+  802146:	56                   	push   %esi
+  802147:	53                   	push   %ebx
+  802148:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80214b:	ff 75 08             	push   0x8(%ebp)
+  80214e:	e8 d3 e4 ff ff       	call   800626 <fd2data>
+  802153:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802155:	8b 70 04             	mov    0x4(%eax),%esi
+  802158:	8b 00                	mov    (%eax),%eax
+  80215a:	83 c4 10             	add    $0x10,%esp
+  80215d:	39 f0                	cmp    %esi,%eax
+  80215f:	75 36                	jne    802197 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802161:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802164:	89 da                	mov    %ebx,%edx
+  802166:	8b 45 08             	mov    0x8(%ebp),%eax
+  802169:	e8 e4 fe ff ff       	call   802052 <_pipeisclosed>
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	0f 85 d4 00 00 00    	jne    80224a <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802176:	b8 01 00 00 00       	mov    $0x1,%eax
+  80217b:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80217f:	83 ec 04             	sub    $0x4,%esp
+  802182:	6a ff                	push   $0xffffffff
+  802184:	56                   	push   %esi
+  802185:	57                   	push   %edi
+  802186:	e8 26 e4 ff ff       	call   8005b1 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80218b:	8b 73 04             	mov    0x4(%ebx),%esi
+  80218e:	8b 03                	mov    (%ebx),%eax
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	39 c6                	cmp    %eax,%esi
+  802195:	74 cd                	je     802164 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802197:	8b 73 04             	mov    0x4(%ebx),%esi
+  80219a:	8b 03                	mov    (%ebx),%eax
+  80219c:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8021a2:	29 c6                	sub    %eax,%esi
+  8021a4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021a9:	f7 e6                	mul    %esi
+  8021ab:	c1 ea 0c             	shr    $0xc,%edx
+  8021ae:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021b4:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8021b6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021b9:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021bd:	8b 0b                	mov    (%ebx),%ecx
+  8021bf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021c4:	f7 e1                	mul    %ecx
+  8021c6:	c1 ea 0b             	shr    $0xb,%edx
+  8021c9:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021cf:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021d1:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021d6:	29 cf                	sub    %ecx,%edi
+  8021d8:	39 f7                	cmp    %esi,%edi
+  8021da:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021dd:	83 ec 04             	sub    $0x4,%esp
+  8021e0:	57                   	push   %edi
+  8021e1:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	ff 75 0c             	push   0xc(%ebp)
+  8021e9:	e8 82 11 00 00       	call   803370 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8021ee:	83 c4 0c             	add    $0xc,%esp
+  8021f1:	89 f0                	mov    %esi,%eax
+  8021f3:	29 f8                	sub    %edi,%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021f9:	50                   	push   %eax
+  8021fa:	89 f8                	mov    %edi,%eax
+  8021fc:	03 45 0c             	add    0xc(%ebp),%eax
+  8021ff:	50                   	push   %eax
+  802200:	e8 6b 11 00 00       	call   803370 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802205:	8b 0b                	mov    (%ebx),%ecx
+  802207:	01 f1                	add    %esi,%ecx
+  802209:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80220e:	f7 e1                	mul    %ecx
+  802210:	c1 ea 0c             	shr    $0xc,%edx
+  802213:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802219:	29 c1                	sub    %eax,%ecx
+  80221b:	89 0b                	mov    %ecx,(%ebx)
+  80221d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802222:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802226:	83 c4 10             	add    $0x10,%esp
+  802229:	85 c0                	test   %eax,%eax
+  80222b:	75 0a                	jne    802237 <devpipe_read+0xf5>
+	return n;
+  80222d:	89 f0                	mov    %esi,%eax
+}
+  80222f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802232:	5b                   	pop    %ebx
+  802233:	5e                   	pop    %esi
+  802234:	5f                   	pop    %edi
+  802235:	5d                   	pop    %ebp
+  802236:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802237:	83 ec 08             	sub    $0x8,%esp
+  80223a:	68 00 04 00 00       	push   $0x400
+  80223f:	53                   	push   %ebx
+  802240:	e8 8e e3 ff ff       	call   8005d3 <sys_futex_wake>
+  802245:	83 c4 10             	add    $0x10,%esp
+  802248:	eb e3                	jmp    80222d <devpipe_read+0xeb>
+			return 0;
+  80224a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224f:	eb de                	jmp    80222f <devpipe_read+0xed>
+
+00802251 <devpipe_write>:
+{
+  802251:	55                   	push   %ebp
+  802252:	89 e5                	mov    %esp,%ebp
+  802254:	57                   	push   %edi
+  802255:	56                   	push   %esi
+  802256:	53                   	push   %ebx
+  802257:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80225a:	ff 75 08             	push   0x8(%ebp)
+  80225d:	e8 c4 e3 ff ff       	call   800626 <fd2data>
+  802262:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80226e:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802273:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802277:	0f 84 43 01 00 00    	je     8023c0 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80227d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802280:	8b 06                	mov    (%esi),%eax
+  802282:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802288:	29 c1                	sub    %eax,%ecx
+  80228a:	89 c8                	mov    %ecx,%eax
+  80228c:	f7 e7                	mul    %edi
+  80228e:	c1 ea 0c             	shr    $0xc,%edx
+  802291:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802297:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802299:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80229f:	75 52                	jne    8022f3 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8022a1:	89 f2                	mov    %esi,%edx
+  8022a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a6:	e8 a7 fd ff ff       	call   802052 <_pipeisclosed>
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	0f 85 28 01 00 00    	jne    8023db <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8022b3:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022b5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022b8:	8b 06                	mov    (%esi),%eax
+  8022ba:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022c0:	29 c1                	sub    %eax,%ecx
+  8022c2:	89 c8                	mov    %ecx,%eax
+  8022c4:	f7 e7                	mul    %edi
+  8022c6:	c1 ea 0c             	shr    $0xc,%edx
+  8022c9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022cf:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022d1:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022d7:	75 a4                	jne    80227d <devpipe_write+0x2c>
+  8022d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022de:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022e2:	83 ec 04             	sub    $0x4,%esp
+  8022e5:	6a ff                	push   $0xffffffff
+  8022e7:	53                   	push   %ebx
+  8022e8:	56                   	push   %esi
+  8022e9:	e8 c3 e2 ff ff       	call   8005b1 <sys_futex_wait>
+}
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	eb 8a                	jmp    80227d <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022f3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022f6:	8b 06                	mov    (%esi),%eax
+  8022f8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022fe:	29 c1                	sub    %eax,%ecx
+  802300:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802305:	f7 e1                	mul    %ecx
+  802307:	c1 ea 0c             	shr    $0xc,%edx
+  80230a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802310:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802312:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802317:	89 d8                	mov    %ebx,%eax
+  802319:	29 c8                	sub    %ecx,%eax
+  80231b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80231e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802321:	29 ca                	sub    %ecx,%edx
+  802323:	39 d0                	cmp    %edx,%eax
+  802325:	0f 46 d0             	cmovbe %eax,%edx
+  802328:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80232b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80232e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802333:	f7 e1                	mul    %ecx
+  802335:	c1 ea 0b             	shr    $0xb,%edx
+  802338:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80233e:	89 ca                	mov    %ecx,%edx
+  802340:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802342:	29 d3                	sub    %edx,%ebx
+  802344:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802347:	39 c3                	cmp    %eax,%ebx
+  802349:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80234c:	83 ec 04             	sub    $0x4,%esp
+  80234f:	53                   	push   %ebx
+  802350:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802353:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802356:	51                   	push   %ecx
+  802357:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80235b:	50                   	push   %eax
+  80235c:	e8 0f 10 00 00       	call   803370 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802361:	83 c4 0c             	add    $0xc,%esp
+  802364:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802367:	29 d8                	sub    %ebx,%eax
+  802369:	50                   	push   %eax
+  80236a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80236d:	01 cb                	add    %ecx,%ebx
+  80236f:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802372:	53                   	push   %ebx
+  802373:	8d 46 10             	lea    0x10(%esi),%eax
+  802376:	50                   	push   %eax
+  802377:	e8 f4 0f 00 00       	call   803370 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80237c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80237f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802382:	01 c1                	add    %eax,%ecx
+  802384:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802389:	f7 e1                	mul    %ecx
+  80238b:	c1 ea 0c             	shr    $0xc,%edx
+  80238e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802394:	89 ca                	mov    %ecx,%edx
+  802396:	29 c2                	sub    %eax,%edx
+  802398:	89 56 04             	mov    %edx,0x4(%esi)
+  80239b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a0:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8023a4:	83 c4 10             	add    $0x10,%esp
+  8023a7:	85 c0                	test   %eax,%eax
+  8023a9:	75 1a                	jne    8023c5 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8023ab:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8023ae:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8023b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023b4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023b7:	0f 82 c0 fe ff ff    	jb     80227d <devpipe_write+0x2c>
+  8023bd:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023c0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023c3:	eb 1b                	jmp    8023e0 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023c5:	83 ec 08             	sub    $0x8,%esp
+  8023c8:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023cd:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023d0:	50                   	push   %eax
+  8023d1:	e8 fd e1 ff ff       	call   8005d3 <sys_futex_wake>
+  8023d6:	83 c4 10             	add    $0x10,%esp
+  8023d9:	eb d0                	jmp    8023ab <devpipe_write+0x15a>
+				return 0;
+  8023db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e3:	5b                   	pop    %ebx
+  8023e4:	5e                   	pop    %esi
+  8023e5:	5f                   	pop    %edi
+  8023e6:	5d                   	pop    %ebp
+  8023e7:	c3                   	ret
+
+008023e8 <devpipe_stat>:
+{
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	56                   	push   %esi
+  8023ec:	53                   	push   %ebx
+  8023ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023f0:	83 ec 0c             	sub    $0xc,%esp
+  8023f3:	ff 75 08             	push   0x8(%ebp)
+  8023f6:	e8 2b e2 ff ff       	call   800626 <fd2data>
+  8023fb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023fd:	83 c4 08             	add    $0x8,%esp
+  802400:	68 de 3b 80 00       	push   $0x803bde
+  802405:	53                   	push   %ebx
+  802406:	e8 b5 0d 00 00       	call   8031c0 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80240b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80240e:	8b 06                	mov    (%esi),%eax
+  802410:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802416:	29 c1                	sub    %eax,%ecx
+  802418:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80241d:	89 c8                	mov    %ecx,%eax
+  80241f:	f7 e2                	mul    %edx
+  802421:	c1 ea 0c             	shr    $0xc,%edx
+  802424:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80242a:	29 d1                	sub    %edx,%ecx
+  80242c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802432:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802439:	00 00 00 
+	stat->st_dev = &devpipe;
+  80243c:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  802443:	40 80 00 
+}
+  802446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80244e:	5b                   	pop    %ebx
+  80244f:	5e                   	pop    %esi
+  802450:	5d                   	pop    %ebp
+  802451:	c3                   	ret
+
+00802452 <devpipe_poll>:
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	57                   	push   %edi
+  802456:	56                   	push   %esi
+  802457:	53                   	push   %ebx
+  802458:	83 ec 18             	sub    $0x18,%esp
+  80245b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80245e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802461:	57                   	push   %edi
+  802462:	e8 bf e1 ff ff       	call   800626 <fd2data>
+  802467:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	89 f3                	mov    %esi,%ebx
+  80246e:	83 e3 01             	and    $0x1,%ebx
+  802471:	75 27                	jne    80249a <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  802473:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802479:	75 48                	jne    8024c3 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80247b:	89 ca                	mov    %ecx,%edx
+  80247d:	89 f8                	mov    %edi,%eax
+  80247f:	e8 ce fb ff ff       	call   802052 <_pipeisclosed>
+  802484:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  802486:	89 d8                	mov    %ebx,%eax
+  802488:	83 c8 10             	or     $0x10,%eax
+  80248b:	85 d2                	test   %edx,%edx
+  80248d:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802490:	89 d8                	mov    %ebx,%eax
+  802492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802495:	5b                   	pop    %ebx
+  802496:	5e                   	pop    %esi
+  802497:	5f                   	pop    %edi
+  802498:	5d                   	pop    %ebp
+  802499:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80249a:	8b 58 04             	mov    0x4(%eax),%ebx
+  80249d:	8b 00                	mov    (%eax),%eax
+  80249f:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8024a5:	29 c3                	sub    %eax,%ebx
+  8024a7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024ac:	89 d8                	mov    %ebx,%eax
+  8024ae:	f7 e2                	mul    %edx
+  8024b0:	c1 ea 0c             	shr    $0xc,%edx
+  8024b3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024b9:	39 d3                	cmp    %edx,%ebx
+  8024bb:	0f 95 c3             	setne  %bl
+  8024be:	0f b6 db             	movzbl %bl,%ebx
+  8024c1:	eb b0                	jmp    802473 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024c3:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024c6:	8b 01                	mov    (%ecx),%eax
+  8024c8:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024ce:	29 c6                	sub    %eax,%esi
+  8024d0:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024d5:	89 f0                	mov    %esi,%eax
+  8024d7:	f7 e2                	mul    %edx
+  8024d9:	c1 ea 0c             	shr    $0xc,%edx
+  8024dc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024e2:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024e4:	89 d8                	mov    %ebx,%eax
+  8024e6:	83 c8 04             	or     $0x4,%eax
+  8024e9:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8024ef:	0f 42 d8             	cmovb  %eax,%ebx
+  8024f2:	eb 87                	jmp    80247b <devpipe_poll+0x29>
+
+008024f4 <pipe>:
+{
+  8024f4:	55                   	push   %ebp
+  8024f5:	89 e5                	mov    %esp,%ebp
+  8024f7:	56                   	push   %esi
+  8024f8:	53                   	push   %ebx
+  8024f9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ff:	50                   	push   %eax
+  802500:	e8 38 e1 ff ff       	call   80063d <fd_alloc>
+  802505:	89 c3                	mov    %eax,%ebx
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	85 c0                	test   %eax,%eax
+  80250c:	0f 88 23 01 00 00    	js     802635 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802512:	83 ec 04             	sub    $0x4,%esp
+  802515:	68 07 04 00 00       	push   $0x407
+  80251a:	ff 75 f4             	push   -0xc(%ebp)
+  80251d:	6a 00                	push   $0x0
+  80251f:	e8 8f dc ff ff       	call   8001b3 <sys_page_alloc>
+  802524:	89 c3                	mov    %eax,%ebx
+  802526:	83 c4 10             	add    $0x10,%esp
+  802529:	85 c0                	test   %eax,%eax
+  80252b:	0f 88 04 01 00 00    	js     802635 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802531:	83 ec 0c             	sub    $0xc,%esp
+  802534:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802537:	50                   	push   %eax
+  802538:	e8 00 e1 ff ff       	call   80063d <fd_alloc>
+  80253d:	89 c3                	mov    %eax,%ebx
+  80253f:	83 c4 10             	add    $0x10,%esp
+  802542:	85 c0                	test   %eax,%eax
+  802544:	0f 88 db 00 00 00    	js     802625 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80254a:	83 ec 04             	sub    $0x4,%esp
+  80254d:	68 07 04 00 00       	push   $0x407
+  802552:	ff 75 f0             	push   -0x10(%ebp)
+  802555:	6a 00                	push   $0x0
+  802557:	e8 57 dc ff ff       	call   8001b3 <sys_page_alloc>
+  80255c:	89 c3                	mov    %eax,%ebx
+  80255e:	83 c4 10             	add    $0x10,%esp
+  802561:	85 c0                	test   %eax,%eax
+  802563:	0f 88 bc 00 00 00    	js     802625 <pipe+0x131>
+	va = fd2data(fd0);
+  802569:	83 ec 0c             	sub    $0xc,%esp
+  80256c:	ff 75 f4             	push   -0xc(%ebp)
+  80256f:	e8 b2 e0 ff ff       	call   800626 <fd2data>
+  802574:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802576:	83 c4 0c             	add    $0xc,%esp
+  802579:	68 07 04 00 00       	push   $0x407
+  80257e:	50                   	push   %eax
+  80257f:	6a 00                	push   $0x0
+  802581:	e8 2d dc ff ff       	call   8001b3 <sys_page_alloc>
+  802586:	89 c3                	mov    %eax,%ebx
+  802588:	83 c4 10             	add    $0x10,%esp
+  80258b:	85 c0                	test   %eax,%eax
+  80258d:	0f 88 82 00 00 00    	js     802615 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802593:	83 ec 0c             	sub    $0xc,%esp
+  802596:	ff 75 f0             	push   -0x10(%ebp)
+  802599:	e8 88 e0 ff ff       	call   800626 <fd2data>
+  80259e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025a5:	50                   	push   %eax
+  8025a6:	6a 00                	push   $0x0
+  8025a8:	56                   	push   %esi
+  8025a9:	6a 00                	push   $0x0
+  8025ab:	e8 46 dc ff ff       	call   8001f6 <sys_page_map>
+  8025b0:	89 c3                	mov    %eax,%ebx
+  8025b2:	83 c4 20             	add    $0x20,%esp
+  8025b5:	85 c0                	test   %eax,%eax
+  8025b7:	78 4e                	js     802607 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025b9:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025c3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025cd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025d0:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025d2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025d5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025dc:	83 ec 0c             	sub    $0xc,%esp
+  8025df:	ff 75 f4             	push   -0xc(%ebp)
+  8025e2:	e8 2f e0 ff ff       	call   800616 <fd2num>
+  8025e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025ea:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025ec:	83 c4 04             	add    $0x4,%esp
+  8025ef:	ff 75 f0             	push   -0x10(%ebp)
+  8025f2:	e8 1f e0 ff ff       	call   800616 <fd2num>
+  8025f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025fa:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025fd:	83 c4 10             	add    $0x10,%esp
+  802600:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802605:	eb 2e                	jmp    802635 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802607:	83 ec 08             	sub    $0x8,%esp
+  80260a:	56                   	push   %esi
+  80260b:	6a 00                	push   $0x0
+  80260d:	e8 26 dc ff ff       	call   800238 <sys_page_unmap>
+  802612:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802615:	83 ec 08             	sub    $0x8,%esp
+  802618:	ff 75 f0             	push   -0x10(%ebp)
+  80261b:	6a 00                	push   $0x0
+  80261d:	e8 16 dc ff ff       	call   800238 <sys_page_unmap>
+  802622:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802625:	83 ec 08             	sub    $0x8,%esp
+  802628:	ff 75 f4             	push   -0xc(%ebp)
+  80262b:	6a 00                	push   $0x0
+  80262d:	e8 06 dc ff ff       	call   800238 <sys_page_unmap>
+  802632:	83 c4 10             	add    $0x10,%esp
+}
+  802635:	89 d8                	mov    %ebx,%eax
+  802637:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80263a:	5b                   	pop    %ebx
+  80263b:	5e                   	pop    %esi
+  80263c:	5d                   	pop    %ebp
+  80263d:	c3                   	ret
+
+0080263e <pipeisclosed>:
+{
+  80263e:	55                   	push   %ebp
+  80263f:	89 e5                	mov    %esp,%ebp
+  802641:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802644:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802647:	50                   	push   %eax
+  802648:	ff 75 08             	push   0x8(%ebp)
+  80264b:	e8 3d e0 ff ff       	call   80068d <fd_lookup>
+  802650:	83 c4 10             	add    $0x10,%esp
+  802653:	85 c0                	test   %eax,%eax
+  802655:	78 18                	js     80266f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802657:	83 ec 0c             	sub    $0xc,%esp
+  80265a:	ff 75 f4             	push   -0xc(%ebp)
+  80265d:	e8 c4 df ff ff       	call   800626 <fd2data>
+  802662:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802664:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802667:	e8 e6 f9 ff ff       	call   802052 <_pipeisclosed>
+  80266c:	83 c4 10             	add    $0x10,%esp
+}
+  80266f:	c9                   	leave
+  802670:	c3                   	ret
+
+00802671 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  802671:	55                   	push   %ebp
+  802672:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  802674:	8b 45 08             	mov    0x8(%ebp),%eax
+  802677:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80267d:	5d                   	pop    %ebp
+  80267e:	c3                   	ret
+
+0080267f <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80267f:	55                   	push   %ebp
+  802680:	89 e5                	mov    %esp,%ebp
+  802682:	53                   	push   %ebx
+  802683:	83 ec 04             	sub    $0x4,%esp
+  802686:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802689:	8b 03                	mov    (%ebx),%eax
+  80268b:	85 c0                	test   %eax,%eax
+  80268d:	75 05                	jne    802694 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80268f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802692:	c9                   	leave
+  802693:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  802694:	83 ec 08             	sub    $0x8,%esp
+  802697:	50                   	push   %eax
+  802698:	8d 43 04             	lea    0x4(%ebx),%eax
+  80269b:	50                   	push   %eax
+  80269c:	e8 e7 dd ff ff       	call   800488 <sys_page_batch>
+	pb->pb_n = 0;
+  8026a1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8026a7:	83 c4 10             	add    $0x10,%esp
+  8026aa:	eb e3                	jmp    80268f <pgbatch_flush+0x10>
+
+008026ac <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	56                   	push   %esi
+  8026b0:	53                   	push   %ebx
+  8026b1:	89 c3                	mov    %eax,%ebx
+  8026b3:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026b5:	83 38 20             	cmpl   $0x20,(%eax)
+  8026b8:	74 2c                	je     8026e6 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026ba:	8b 03                	mov    (%ebx),%eax
+  8026bc:	8d 50 01             	lea    0x1(%eax),%edx
+  8026bf:	89 13                	mov    %edx,(%ebx)
+  8026c1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026c4:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026c8:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026ca:	83 ec 04             	sub    $0x4,%esp
+  8026cd:	6a 18                	push   $0x18
+  8026cf:	6a 00                	push   $0x0
+  8026d1:	50                   	push   %eax
+  8026d2:	e8 64 0c 00 00       	call   80333b <memset>
+	return 0;
+  8026d7:	83 c4 10             	add    $0x10,%esp
+  8026da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e2:	5b                   	pop    %ebx
+  8026e3:	5e                   	pop    %esi
+  8026e4:	5d                   	pop    %ebp
+  8026e5:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026e6:	83 ec 0c             	sub    $0xc,%esp
+  8026e9:	50                   	push   %eax
+  8026ea:	e8 90 ff ff ff       	call   80267f <pgbatch_flush>
+  8026ef:	83 c4 10             	add    $0x10,%esp
+  8026f2:	85 c0                	test   %eax,%eax
+  8026f4:	79 c4                	jns    8026ba <pgbatch_slot+0xe>
+  8026f6:	eb e7                	jmp    8026df <pgbatch_slot+0x33>
+
+008026f8 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8026f8:	55                   	push   %ebp
+  8026f9:	89 e5                	mov    %esp,%ebp
+  8026fb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8026fe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802701:	8b 45 08             	mov    0x8(%ebp),%eax
+  802704:	e8 a3 ff ff ff       	call   8026ac <pgbatch_slot>
+  802709:	85 c0                	test   %eax,%eax
+  80270b:	78 20                	js     80272d <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  80270d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802710:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  802716:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802719:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80271c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80271f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802722:	8b 55 14             	mov    0x14(%ebp),%edx
+  802725:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802728:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80272d:	c9                   	leave
+  80272e:	c3                   	ret
+
+0080272f <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80272f:	55                   	push   %ebp
+  802730:	89 e5                	mov    %esp,%ebp
+  802732:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802735:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802738:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273b:	e8 6c ff ff ff       	call   8026ac <pgbatch_slot>
+  802740:	85 c0                	test   %eax,%eax
+  802742:	78 2c                	js     802770 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  802744:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802747:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80274d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802750:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  802753:	8b 55 10             	mov    0x10(%ebp),%edx
+  802756:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802759:	8b 55 14             	mov    0x14(%ebp),%edx
+  80275c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80275f:	8b 55 18             	mov    0x18(%ebp),%edx
+  802762:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802765:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802768:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80276b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802770:	c9                   	leave
+  802771:	c3                   	ret
+
+00802772 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  802772:	55                   	push   %ebp
+  802773:	89 e5                	mov    %esp,%ebp
+  802775:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802778:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80277b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277e:	e8 29 ff ff ff       	call   8026ac <pgbatch_slot>
+  802783:	85 c0                	test   %eax,%eax
+  802785:	78 1a                	js     8027a1 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  802787:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80278a:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  802790:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802793:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802796:	8b 55 10             	mov    0x10(%ebp),%edx
+  802799:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80279c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027a1:	c9                   	leave
+  8027a2:	c3                   	ret
+
+008027a3 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8027a3:	55                   	push   %ebp
+  8027a4:	89 e5                	mov    %esp,%ebp
+  8027a6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027a9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027af:	e8 f8 fe ff ff       	call   8026ac <pgbatch_slot>
+  8027b4:	85 c0                	test   %eax,%eax
+  8027b6:	78 20                	js     8027d8 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027bb:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027c4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027c7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027ca:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027cd:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027d0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027d8:	c9                   	leave
+  8027d9:	c3                   	ret
+
+008027da <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027da:	55                   	push   %ebp
+  8027db:	89 e5                	mov    %esp,%ebp
+  8027dd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027e0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e6:	e8 c1 fe ff ff       	call   8026ac <pgbatch_slot>
+  8027eb:	85 c0                	test   %eax,%eax
+  8027ed:	78 26                	js     802815 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8027ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027f2:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8027f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027fb:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8027fe:	8b 55 10             	mov    0x10(%ebp),%edx
+  802801:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802804:	8b 55 14             	mov    0x14(%ebp),%edx
+  802807:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80280a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80280d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802810:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802815:	c9                   	leave
+  802816:	c3                   	ret
+
+00802817 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281c:	c3                   	ret
+
+0080281d <devcons_poll>:
+{
+  80281d:	55                   	push   %ebp
+  80281e:	89 e5                	mov    %esp,%ebp
+  802820:	53                   	push   %ebx
+  802821:	83 ec 04             	sub    $0x4,%esp
+  802824:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802827:	89 da                	mov    %ebx,%edx
+  802829:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80282c:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  802833:	74 0c                	je     802841 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802835:	89 d8                	mov    %ebx,%eax
+  802837:	83 e0 01             	and    $0x1,%eax
+  80283a:	09 d0                	or     %edx,%eax
+}
+  80283c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80283f:	c9                   	leave
+  802840:	c3                   	ret
+		cons_peek = sys_cgetc();
+  802841:	e8 cf d8 ff ff       	call   800115 <sys_cgetc>
+  802846:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80284b:	89 da                	mov    %ebx,%edx
+  80284d:	83 e2 04             	and    $0x4,%edx
+  802850:	85 c0                	test   %eax,%eax
+  802852:	74 e6                	je     80283a <devcons_poll+0x1d>
+  802854:	eb df                	jmp    802835 <devcons_poll+0x18>
+
+00802856 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802856:	55                   	push   %ebp
+  802857:	89 e5                	mov    %esp,%ebp
+  802859:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80285c:	68 ea 3b 80 00       	push   $0x803bea
+  802861:	ff 75 0c             	push   0xc(%ebp)
+  802864:	e8 57 09 00 00       	call   8031c0 <strcpy>
+	return 0;
+}
+  802869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286e:	c9                   	leave
+  80286f:	c3                   	ret
+
+00802870 <devcons_write>:
+{
+  802870:	55                   	push   %ebp
+  802871:	89 e5                	mov    %esp,%ebp
+  802873:	57                   	push   %edi
+  802874:	56                   	push   %esi
+  802875:	53                   	push   %ebx
+  802876:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80287c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80287f:	85 ff                	test   %edi,%edi
+  802881:	74 51                	je     8028d4 <devcons_write+0x64>
+  802883:	be 00 00 00 00       	mov    $0x0,%esi
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80288d:	89 fb                	mov    %edi,%ebx
+  80288f:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  802891:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802896:	39 d3                	cmp    %edx,%ebx
+  802898:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80289b:	83 ec 04             	sub    $0x4,%esp
+  80289e:	53                   	push   %ebx
+  80289f:	03 45 0c             	add    0xc(%ebp),%eax
+  8028a2:	50                   	push   %eax
+  8028a3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028a9:	50                   	push   %eax
+  8028aa:	e8 c1 0a 00 00       	call   803370 <memmove>
+		sys_cputs(buf, m);
+  8028af:	83 c4 08             	add    $0x8,%esp
+  8028b2:	53                   	push   %ebx
+  8028b3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028b9:	50                   	push   %eax
+  8028ba:	e8 38 d8 ff ff       	call   8000f7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028bf:	01 de                	add    %ebx,%esi
+  8028c1:	89 f0                	mov    %esi,%eax
+  8028c3:	83 c4 10             	add    $0x10,%esp
+  8028c6:	39 fe                	cmp    %edi,%esi
+  8028c8:	72 c3                	jb     80288d <devcons_write+0x1d>
+}
+  8028ca:	89 f0                	mov    %esi,%eax
+  8028cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028cf:	5b                   	pop    %ebx
+  8028d0:	5e                   	pop    %esi
+  8028d1:	5f                   	pop    %edi
+  8028d2:	5d                   	pop    %ebp
+  8028d3:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028d4:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028d9:	eb ef                	jmp    8028ca <devcons_write+0x5a>
+
+008028db <devcons_read>:
+{
+  8028db:	55                   	push   %ebp
+  8028dc:	89 e5                	mov    %esp,%ebp
+  8028de:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028e1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028e6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028ea:	74 36                	je     802922 <devcons_read+0x47>
+	c = cons_peek;
+  8028ec:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8028f1:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8028f8:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028fb:	85 c0                	test   %eax,%eax
+  8028fd:	75 10                	jne    80290f <devcons_read+0x34>
+  8028ff:	e8 11 d8 ff ff       	call   800115 <sys_cgetc>
+  802904:	85 c0                	test   %eax,%eax
+  802906:	75 07                	jne    80290f <devcons_read+0x34>
+		sys_yield();
+  802908:	e8 87 d8 ff ff       	call   800194 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80290d:	eb f0                	jmp    8028ff <devcons_read+0x24>
+	if (c < 0)
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	78 0f                	js     802922 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  802913:	83 f8 04             	cmp    $0x4,%eax
+  802916:	74 0c                	je     802924 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802918:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80291b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80291d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802922:	c9                   	leave
+  802923:	c3                   	ret
+		return 0;
+  802924:	b8 00 00 00 00       	mov    $0x0,%eax
+  802929:	eb f7                	jmp    802922 <devcons_read+0x47>
+
+0080292b <cputchar>:
+{
+  80292b:	55                   	push   %ebp
+  80292c:	89 e5                	mov    %esp,%ebp
+  80292e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802931:	8b 45 08             	mov    0x8(%ebp),%eax
+  802934:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802937:	6a 01                	push   $0x1
+  802939:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80293c:	50                   	push   %eax
+  80293d:	e8 b5 d7 ff ff       	call   8000f7 <sys_cputs>
+}
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	c9                   	leave
+  802946:	c3                   	ret
+
+00802947 <getchar>:
+{
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80294d:	6a 01                	push   $0x1
+  80294f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802952:	50                   	push   %eax
+  802953:	6a 00                	push   $0x0
+  802955:	e8 b7 df ff ff       	call   800911 <read>
+	if (r < 0)
+  80295a:	83 c4 10             	add    $0x10,%esp
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	78 06                	js     802967 <getchar+0x20>
+	if (r < 1)
+  802961:	74 06                	je     802969 <getchar+0x22>
+	return c;
+  802963:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802967:	c9                   	leave
+  802968:	c3                   	ret
+		return -E_EOF;
+  802969:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80296e:	eb f7                	jmp    802967 <getchar+0x20>
+
+00802970 <iscons>:
+{
+  802970:	55                   	push   %ebp
+  802971:	89 e5                	mov    %esp,%ebp
+  802973:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802976:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802979:	50                   	push   %eax
+  80297a:	ff 75 08             	push   0x8(%ebp)
+  80297d:	e8 0b dd ff ff       	call   80068d <fd_lookup>
+  802982:	83 c4 10             	add    $0x10,%esp
+  802985:	85 c0                	test   %eax,%eax
+  802987:	78 11                	js     80299a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80298c:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802992:	39 10                	cmp    %edx,(%eax)
+  802994:	0f 94 c0             	sete   %al
+  802997:	0f b6 c0             	movzbl %al,%eax
+}
+  80299a:	c9                   	leave
+  80299b:	c3                   	ret
+
+0080299c <opencons>:
+{
+  80299c:	55                   	push   %ebp
+  80299d:	89 e5                	mov    %esp,%ebp
+  80299f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8029a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029a5:	50                   	push   %eax
+  8029a6:	e8 92 dc ff ff       	call   80063d <fd_alloc>
+  8029ab:	83 c4 10             	add    $0x10,%esp
+  8029ae:	85 c0                	test   %eax,%eax
+  8029b0:	78 3a                	js     8029ec <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029b2:	83 ec 04             	sub    $0x4,%esp
+  8029b5:	68 07 04 00 00       	push   $0x407
+  8029ba:	ff 75 f4             	push   -0xc(%ebp)
+  8029bd:	6a 00                	push   $0x0
+  8029bf:	e8 ef d7 ff ff       	call   8001b3 <sys_page_alloc>
+  8029c4:	83 c4 10             	add    $0x10,%esp
+  8029c7:	85 c0                	test   %eax,%eax
+  8029c9:	78 21                	js     8029ec <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ce:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029d4:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029e0:	83 ec 0c             	sub    $0xc,%esp
+  8029e3:	50                   	push   %eax
+  8029e4:	e8 2d dc ff ff       	call   800616 <fd2num>
+  8029e9:	83 c4 10             	add    $0x10,%esp
+}
+  8029ec:	c9                   	leave
+  8029ed:	c3                   	ret
+
+008029ee <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029ee:	55                   	push   %ebp
+  8029ef:	89 e5                	mov    %esp,%ebp
+  8029f1:	56                   	push   %esi
+  8029f2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029f3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029f6:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8029fc:	e8 74 d7 ff ff       	call   800175 <sys_getenvid>
+  802a01:	83 ec 0c             	sub    $0xc,%esp
+  802a04:	ff 75 0c             	push   0xc(%ebp)
+  802a07:	ff 75 08             	push   0x8(%ebp)
+  802a0a:	56                   	push   %esi
+  802a0b:	50                   	push   %eax
+  802a0c:	68 f8 3b 80 00       	push   $0x803bf8
+  802a11:	e8 b3 00 00 00       	call   802ac9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802a16:	83 c4 18             	add    $0x18,%esp
+  802a19:	53                   	push   %ebx
+  802a1a:	ff 75 10             	push   0x10(%ebp)
+  802a1d:	e8 56 00 00 00       	call   802a78 <vcprintf>
+	cprintf("\n");
+  802a22:	c7 04 24 dc 3b 80 00 	movl   $0x803bdc,(%esp)
+  802a29:	e8 9b 00 00 00       	call   802ac9 <cprintf>
+  802a2e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a31:	cc                   	int3
+	while (1)
+  802a32:	eb fd                	jmp    802a31 <_panic+0x43>
+
+00802a34 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a34:	55                   	push   %ebp
+  802a35:	89 e5                	mov    %esp,%ebp
+  802a37:	53                   	push   %ebx
+  802a38:	83 ec 04             	sub    $0x4,%esp
+  802a3b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a3e:	8b 13                	mov    (%ebx),%edx
+  802a40:	8d 42 01             	lea    0x1(%edx),%eax
+  802a43:	89 03                	mov    %eax,(%ebx)
+  802a45:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a48:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a4c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a51:	74 09                	je     802a5c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a53:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5a:	c9                   	leave
+  802a5b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a5c:	83 ec 08             	sub    $0x8,%esp
+  802a5f:	68 ff 00 00 00       	push   $0xff
+  802a64:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a67:	50                   	push   %eax
+  802a68:	e8 8a d6 ff ff       	call   8000f7 <sys_cputs>
+		b->idx = 0;
+  802a6d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a73:	83 c4 10             	add    $0x10,%esp
+  802a76:	eb db                	jmp    802a53 <putch+0x1f>
+
+00802a78 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a78:	55                   	push   %ebp
+  802a79:	89 e5                	mov    %esp,%ebp
+  802a7b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a81:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a88:	00 00 00 
+	b.cnt = 0;
+  802a8b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802a92:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802a95:	ff 75 0c             	push   0xc(%ebp)
+  802a98:	ff 75 08             	push   0x8(%ebp)
+  802a9b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802aa1:	50                   	push   %eax
+  802aa2:	68 34 2a 80 00       	push   $0x802a34
+  802aa7:	e8 1c 01 00 00       	call   802bc8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802aac:	83 c4 08             	add    $0x8,%esp
+  802aaf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802ab5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802abb:	50                   	push   %eax
+  802abc:	e8 36 d6 ff ff       	call   8000f7 <sys_cputs>
+
+	return b.cnt;
+}
+  802ac1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802ac7:	c9                   	leave
+  802ac8:	c3                   	ret
+
+00802ac9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ac9:	55                   	push   %ebp
+  802aca:	89 e5                	mov    %esp,%ebp
+  802acc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802acf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802ad2:	50                   	push   %eax
+  802ad3:	ff 75 08             	push   0x8(%ebp)
+  802ad6:	e8 9d ff ff ff       	call   802a78 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802adb:	c9                   	leave
+  802adc:	c3                   	ret
+
+00802add <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	57                   	push   %edi
+  802ae1:	56                   	push   %esi
+  802ae2:	53                   	push   %ebx
+  802ae3:	83 ec 1c             	sub    $0x1c,%esp
+  802ae6:	89 c3                	mov    %eax,%ebx
+  802ae8:	89 d6                	mov    %edx,%esi
+  802aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802af0:	89 d1                	mov    %edx,%ecx
+  802af2:	89 c2                	mov    %eax,%edx
+  802af4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802af7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802afa:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802afd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b00:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b07:	39 c2                	cmp    %eax,%edx
+  802b09:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802b0c:	73 4b                	jae    802b59 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802b0e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b11:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b14:	85 ff                	test   %edi,%edi
+  802b16:	7e 11                	jle    802b29 <printnum+0x4c>
+			putch(padc, putdat);
+  802b18:	83 ec 08             	sub    $0x8,%esp
+  802b1b:	56                   	push   %esi
+  802b1c:	ff 75 18             	push   0x18(%ebp)
+  802b1f:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b21:	83 c4 10             	add    $0x10,%esp
+  802b24:	83 ef 01             	sub    $0x1,%edi
+  802b27:	75 ef                	jne    802b18 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b29:	83 ec 08             	sub    $0x8,%esp
+  802b2c:	56                   	push   %esi
+  802b2d:	83 ec 04             	sub    $0x4,%esp
+  802b30:	ff 75 e4             	push   -0x1c(%ebp)
+  802b33:	ff 75 e0             	push   -0x20(%ebp)
+  802b36:	ff 75 dc             	push   -0x24(%ebp)
+  802b39:	ff 75 d8             	push   -0x28(%ebp)
+  802b3c:	e8 33 0e 00 00       	call   803974 <__umoddi3>
+  802b41:	83 c4 14             	add    $0x14,%esp
+  802b44:	0f be 80 1b 3c 80 00 	movsbl 0x803c1b(%eax),%eax
+  802b4b:	50                   	push   %eax
+  802b4c:	ff d3                	call   *%ebx
+}
+  802b4e:	83 c4 10             	add    $0x10,%esp
+  802b51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b54:	5b                   	pop    %ebx
+  802b55:	5e                   	pop    %esi
+  802b56:	5f                   	pop    %edi
+  802b57:	5d                   	pop    %ebp
+  802b58:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b59:	83 ec 0c             	sub    $0xc,%esp
+  802b5c:	ff 75 18             	push   0x18(%ebp)
+  802b5f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b62:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b65:	52                   	push   %edx
+  802b66:	50                   	push   %eax
+  802b67:	83 ec 08             	sub    $0x8,%esp
+  802b6a:	ff 75 e4             	push   -0x1c(%ebp)
+  802b6d:	ff 75 e0             	push   -0x20(%ebp)
+  802b70:	ff 75 dc             	push   -0x24(%ebp)
+  802b73:	ff 75 d8             	push   -0x28(%ebp)
+  802b76:	e8 33 0d 00 00       	call   8038ae <__udivdi3>
+  802b7b:	83 c4 18             	add    $0x18,%esp
+  802b7e:	52                   	push   %edx
+  802b7f:	50                   	push   %eax
+  802b80:	89 f2                	mov    %esi,%edx
+  802b82:	89 d8                	mov    %ebx,%eax
+  802b84:	e8 54 ff ff ff       	call   802add <printnum>
+  802b89:	83 c4 20             	add    $0x20,%esp
+  802b8c:	eb 9b                	jmp    802b29 <printnum+0x4c>
+
+00802b8e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802b8e:	55                   	push   %ebp
+  802b8f:	89 e5                	mov    %esp,%ebp
+  802b91:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802b94:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802b98:	8b 10                	mov    (%eax),%edx
+  802b9a:	3b 50 04             	cmp    0x4(%eax),%edx
+  802b9d:	73 0a                	jae    802ba9 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802b9f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802ba2:	89 08                	mov    %ecx,(%eax)
+  802ba4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba7:	88 02                	mov    %al,(%edx)
+}
+  802ba9:	5d                   	pop    %ebp
+  802baa:	c3                   	ret
+
+00802bab <printfmt>:
+{
+  802bab:	55                   	push   %ebp
+  802bac:	89 e5                	mov    %esp,%ebp
+  802bae:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802bb1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802bb4:	50                   	push   %eax
+  802bb5:	ff 75 10             	push   0x10(%ebp)
+  802bb8:	ff 75 0c             	push   0xc(%ebp)
+  802bbb:	ff 75 08             	push   0x8(%ebp)
+  802bbe:	e8 05 00 00 00       	call   802bc8 <vprintfmt>
+}
+  802bc3:	83 c4 10             	add    $0x10,%esp
+  802bc6:	c9                   	leave
+  802bc7:	c3                   	ret
+
+00802bc8 <vprintfmt>:
+{
+  802bc8:	55                   	push   %ebp
+  802bc9:	89 e5                	mov    %esp,%ebp
+  802bcb:	57                   	push   %edi
+  802bcc:	56                   	push   %esi
+  802bcd:	53                   	push   %ebx
+  802bce:	83 ec 2c             	sub    $0x2c,%esp
+  802bd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bd4:	89 df                	mov    %ebx,%edi
+  802bd6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bd9:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bdc:	8d 70 01             	lea    0x1(%eax),%esi
+  802bdf:	0f b6 00             	movzbl (%eax),%eax
+  802be2:	83 f8 25             	cmp    $0x25,%eax
+  802be5:	74 1e                	je     802c05 <vprintfmt+0x3d>
+			if (ch == '\0')
+  802be7:	85 c0                	test   %eax,%eax
+  802be9:	0f 84 15 05 00 00    	je     803104 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802bef:	83 ec 08             	sub    $0x8,%esp
+  802bf2:	53                   	push   %ebx
+  802bf3:	50                   	push   %eax
+  802bf4:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bf6:	83 c6 01             	add    $0x1,%esi
+  802bf9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802bfd:	83 c4 10             	add    $0x10,%esp
+  802c00:	83 f8 25             	cmp    $0x25,%eax
+  802c03:	75 e2                	jne    802be7 <vprintfmt+0x1f>
+		padc = ' ';
+  802c05:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802c09:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802c10:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802c17:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c23:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c26:	8d 56 01             	lea    0x1(%esi),%edx
+  802c29:	0f b6 0e             	movzbl (%esi),%ecx
+  802c2c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c2f:	3c 55                	cmp    $0x55,%al
+  802c31:	0f 87 3b 04 00 00    	ja     803072 <vprintfmt+0x4aa>
+  802c37:	0f b6 c0             	movzbl %al,%eax
+  802c3a:	ff 24 85 80 3d 80 00 	jmp    *0x803d80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c41:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c44:	eb 93                	jmp    802bd9 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c46:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c48:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c4c:	eb d8                	jmp    802c26 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c4e:	89 d6                	mov    %edx,%esi
+  802c50:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c54:	eb d0                	jmp    802c26 <vprintfmt+0x5e>
+  802c56:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c59:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c5c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c5f:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c63:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c66:	83 f9 09             	cmp    $0x9,%ecx
+  802c69:	77 6f                	ja     802cda <vprintfmt+0x112>
+  802c6b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c6e:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c71:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c74:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c78:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c7b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c7e:	83 fe 09             	cmp    $0x9,%esi
+  802c81:	76 eb                	jbe    802c6e <vprintfmt+0xa6>
+  802c83:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c86:	89 d6                	mov    %edx,%esi
+  802c88:	eb 13                	jmp    802c9d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802c8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c8d:	8b 00                	mov    (%eax),%eax
+  802c8f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c92:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c95:	8d 40 04             	lea    0x4(%eax),%eax
+  802c98:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c9b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802c9d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802ca1:	79 83                	jns    802c26 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802ca3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ca6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ca9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802cb0:	e9 71 ff ff ff       	jmp    802c26 <vprintfmt+0x5e>
+			if (width < 0)
+  802cb5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802cb8:	85 c9                	test   %ecx,%ecx
+  802cba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbf:	0f 49 c1             	cmovns %ecx,%eax
+  802cc2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc5:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cc7:	e9 5a ff ff ff       	jmp    802c26 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802ccc:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cce:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cd5:	e9 4c ff ff ff       	jmp    802c26 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cda:	89 d6                	mov    %edx,%esi
+  802cdc:	eb bf                	jmp    802c9d <vprintfmt+0xd5>
+			lflag++;
+  802cde:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802ce2:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802ce4:	e9 3d ff ff ff       	jmp    802c26 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802ce9:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cec:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cef:	8d 70 04             	lea    0x4(%eax),%esi
+  802cf2:	83 ec 08             	sub    $0x8,%esp
+  802cf5:	53                   	push   %ebx
+  802cf6:	ff 30                	push   (%eax)
+  802cf8:	ff d7                	call   *%edi
+			break;
+  802cfa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802cfd:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802d00:	e9 d4 fe ff ff       	jmp    802bd9 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802d05:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d08:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d0b:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802d0e:	8b 10                	mov    (%eax),%edx
+  802d10:	89 d0                	mov    %edx,%eax
+  802d12:	f7 d8                	neg    %eax
+  802d14:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802d17:	83 f8 12             	cmp    $0x12,%eax
+  802d1a:	7f 23                	jg     802d3f <vprintfmt+0x177>
+  802d1c:	8b 14 85 e0 3e 80 00 	mov    0x803ee0(,%eax,4),%edx
+  802d23:	85 d2                	test   %edx,%edx
+  802d25:	74 18                	je     802d3f <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d27:	52                   	push   %edx
+  802d28:	68 a7 3b 80 00       	push   $0x803ba7
+  802d2d:	53                   	push   %ebx
+  802d2e:	57                   	push   %edi
+  802d2f:	e8 77 fe ff ff       	call   802bab <printfmt>
+  802d34:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d37:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d3a:	e9 9a fe ff ff       	jmp    802bd9 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d3f:	50                   	push   %eax
+  802d40:	68 33 3c 80 00       	push   $0x803c33
+  802d45:	53                   	push   %ebx
+  802d46:	57                   	push   %edi
+  802d47:	e8 5f fe ff ff       	call   802bab <printfmt>
+  802d4c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d4f:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d52:	e9 82 fe ff ff       	jmp    802bd9 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d57:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d5d:	83 c0 04             	add    $0x4,%eax
+  802d60:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d63:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d66:	8b 00                	mov    (%eax),%eax
+  802d68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d6b:	85 c0                	test   %eax,%eax
+  802d6d:	0f 84 61 03 00 00    	je     8030d4 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d73:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d77:	7e 06                	jle    802d7f <vprintfmt+0x1b7>
+  802d79:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d7d:	75 29                	jne    802da8 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d7f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d82:	8d 70 01             	lea    0x1(%eax),%esi
+  802d85:	0f b6 00             	movzbl (%eax),%eax
+  802d88:	0f be d0             	movsbl %al,%edx
+  802d8b:	85 d2                	test   %edx,%edx
+  802d8d:	0f 84 bb 00 00 00    	je     802e4e <vprintfmt+0x286>
+  802d93:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802d96:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802d99:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802d9c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d9f:	eb 7a                	jmp    802e1b <vprintfmt+0x253>
+				p = "(null)";
+  802da1:	c7 45 d0 2c 3c 80 00 	movl   $0x803c2c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802da8:	83 ec 08             	sub    $0x8,%esp
+  802dab:	ff 75 d4             	push   -0x2c(%ebp)
+  802dae:	ff 75 d0             	push   -0x30(%ebp)
+  802db1:	e8 e0 03 00 00       	call   803196 <strnlen>
+  802db6:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802db9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802dbc:	83 c4 10             	add    $0x10,%esp
+  802dbf:	85 d2                	test   %edx,%edx
+  802dc1:	0f 8e d6 02 00 00    	jle    80309d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802dc7:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802dcb:	83 ec 08             	sub    $0x8,%esp
+  802dce:	53                   	push   %ebx
+  802dcf:	56                   	push   %esi
+  802dd0:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dd2:	83 c4 10             	add    $0x10,%esp
+  802dd5:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802dd9:	75 f0                	jne    802dcb <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802ddb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dde:	8d 70 01             	lea    0x1(%eax),%esi
+  802de1:	0f b6 00             	movzbl (%eax),%eax
+  802de4:	0f be d0             	movsbl %al,%edx
+  802de7:	85 d2                	test   %edx,%edx
+  802de9:	0f 84 da 02 00 00    	je     8030c9 <vprintfmt+0x501>
+  802def:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802df2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802df5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802df8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dfb:	eb 1e                	jmp    802e1b <vprintfmt+0x253>
+					putch(ch, putdat);
+  802dfd:	83 ec 08             	sub    $0x8,%esp
+  802e00:	ff 75 0c             	push   0xc(%ebp)
+  802e03:	52                   	push   %edx
+  802e04:	ff 55 08             	call   *0x8(%ebp)
+  802e07:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802e0a:	83 eb 01             	sub    $0x1,%ebx
+  802e0d:	83 c6 01             	add    $0x1,%esi
+  802e10:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e14:	0f be d0             	movsbl %al,%edx
+  802e17:	85 d2                	test   %edx,%edx
+  802e19:	74 2a                	je     802e45 <vprintfmt+0x27d>
+  802e1b:	85 ff                	test   %edi,%edi
+  802e1d:	78 05                	js     802e24 <vprintfmt+0x25c>
+  802e1f:	83 ef 01             	sub    $0x1,%edi
+  802e22:	78 59                	js     802e7d <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e24:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e28:	74 d3                	je     802dfd <vprintfmt+0x235>
+  802e2a:	0f be c0             	movsbl %al,%eax
+  802e2d:	83 e8 20             	sub    $0x20,%eax
+  802e30:	83 f8 5e             	cmp    $0x5e,%eax
+  802e33:	76 c8                	jbe    802dfd <vprintfmt+0x235>
+					putch('?', putdat);
+  802e35:	83 ec 08             	sub    $0x8,%esp
+  802e38:	ff 75 0c             	push   0xc(%ebp)
+  802e3b:	6a 3f                	push   $0x3f
+  802e3d:	ff 55 08             	call   *0x8(%ebp)
+  802e40:	83 c4 10             	add    $0x10,%esp
+  802e43:	eb c5                	jmp    802e0a <vprintfmt+0x242>
+  802e45:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e48:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e4e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e51:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e55:	7e 1b                	jle    802e72 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e57:	83 ec 08             	sub    $0x8,%esp
+  802e5a:	53                   	push   %ebx
+  802e5b:	6a 20                	push   $0x20
+  802e5d:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e5f:	83 c4 10             	add    $0x10,%esp
+  802e62:	83 ee 01             	sub    $0x1,%esi
+  802e65:	75 f0                	jne    802e57 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e67:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e6a:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e6d:	e9 67 fd ff ff       	jmp    802bd9 <vprintfmt+0x11>
+  802e72:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e75:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e78:	e9 5c fd ff ff       	jmp    802bd9 <vprintfmt+0x11>
+  802e7d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e80:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e86:	eb c6                	jmp    802e4e <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e88:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802e8b:	89 55 10             	mov    %edx,0x10(%ebp)
+  802e8e:	83 f9 01             	cmp    $0x1,%ecx
+  802e91:	7f 1f                	jg     802eb2 <vprintfmt+0x2ea>
+	else if (lflag)
+  802e93:	85 c9                	test   %ecx,%ecx
+  802e95:	74 67                	je     802efe <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802e97:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9a:	8b 30                	mov    (%eax),%esi
+  802e9c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802e9f:	89 f0                	mov    %esi,%eax
+  802ea1:	c1 f8 1f             	sar    $0x1f,%eax
+  802ea4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802ea7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eaa:	8d 40 04             	lea    0x4(%eax),%eax
+  802ead:	89 45 14             	mov    %eax,0x14(%ebp)
+  802eb0:	eb 17                	jmp    802ec9 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802eb2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eb5:	8b 50 04             	mov    0x4(%eax),%edx
+  802eb8:	8b 00                	mov    (%eax),%eax
+  802eba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ebd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802ec0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ec3:	8d 40 08             	lea    0x8(%eax),%eax
+  802ec6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802ec9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ecc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802ecf:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802ed4:	85 c9                	test   %ecx,%ecx
+  802ed6:	0f 89 12 01 00 00    	jns    802fee <vprintfmt+0x426>
+				putch('-', putdat);
+  802edc:	83 ec 08             	sub    $0x8,%esp
+  802edf:	53                   	push   %ebx
+  802ee0:	6a 2d                	push   $0x2d
+  802ee2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802ee4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ee7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802eea:	f7 da                	neg    %edx
+  802eec:	83 d1 00             	adc    $0x0,%ecx
+  802eef:	f7 d9                	neg    %ecx
+  802ef1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802ef4:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ef9:	e9 f0 00 00 00       	jmp    802fee <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802efe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f01:	8b 30                	mov    (%eax),%esi
+  802f03:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f06:	89 f0                	mov    %esi,%eax
+  802f08:	c1 f8 1f             	sar    $0x1f,%eax
+  802f0b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f0e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f11:	8d 40 04             	lea    0x4(%eax),%eax
+  802f14:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f17:	eb b0                	jmp    802ec9 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f19:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f1c:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f1f:	83 f9 01             	cmp    $0x1,%ecx
+  802f22:	7f 1e                	jg     802f42 <vprintfmt+0x37a>
+	else if (lflag)
+  802f24:	85 c9                	test   %ecx,%ecx
+  802f26:	74 32                	je     802f5a <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f28:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2b:	8b 10                	mov    (%eax),%edx
+  802f2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f32:	8d 40 04             	lea    0x4(%eax),%eax
+  802f35:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f38:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f3d:	e9 ac 00 00 00       	jmp    802fee <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f42:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f45:	8b 10                	mov    (%eax),%edx
+  802f47:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f4a:	8d 40 08             	lea    0x8(%eax),%eax
+  802f4d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f50:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f55:	e9 94 00 00 00       	jmp    802fee <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f5d:	8b 10                	mov    (%eax),%edx
+  802f5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f64:	8d 40 04             	lea    0x4(%eax),%eax
+  802f67:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f6a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f6f:	eb 7d                	jmp    802fee <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f71:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f74:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f77:	83 f9 01             	cmp    $0x1,%ecx
+  802f7a:	7f 1b                	jg     802f97 <vprintfmt+0x3cf>
+	else if (lflag)
+  802f7c:	85 c9                	test   %ecx,%ecx
+  802f7e:	74 2c                	je     802fac <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f80:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f83:	8b 10                	mov    (%eax),%edx
+  802f85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f8a:	8d 40 04             	lea    0x4(%eax),%eax
+  802f8d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f90:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802f95:	eb 57                	jmp    802fee <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f97:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f9a:	8b 10                	mov    (%eax),%edx
+  802f9c:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f9f:	8d 40 08             	lea    0x8(%eax),%eax
+  802fa2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fa5:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802faa:	eb 42                	jmp    802fee <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802fac:	8b 45 14             	mov    0x14(%ebp),%eax
+  802faf:	8b 10                	mov    (%eax),%edx
+  802fb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fb6:	8d 40 04             	lea    0x4(%eax),%eax
+  802fb9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fbc:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fc1:	eb 2b                	jmp    802fee <vprintfmt+0x426>
+			putch('0', putdat);
+  802fc3:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fc6:	83 ec 08             	sub    $0x8,%esp
+  802fc9:	53                   	push   %ebx
+  802fca:	6a 30                	push   $0x30
+  802fcc:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fce:	83 c4 08             	add    $0x8,%esp
+  802fd1:	53                   	push   %ebx
+  802fd2:	6a 78                	push   $0x78
+  802fd4:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fd9:	8b 10                	mov    (%eax),%edx
+  802fdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802fe0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802fe3:	8d 40 04             	lea    0x4(%eax),%eax
+  802fe6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802fe9:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  802fee:	83 ec 0c             	sub    $0xc,%esp
+  802ff1:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802ff5:	50                   	push   %eax
+  802ff6:	ff 75 e4             	push   -0x1c(%ebp)
+  802ff9:	56                   	push   %esi
+  802ffa:	51                   	push   %ecx
+  802ffb:	52                   	push   %edx
+  802ffc:	89 da                	mov    %ebx,%edx
+  802ffe:	89 f8                	mov    %edi,%eax
+  803000:	e8 d8 fa ff ff       	call   802add <printnum>
+			break;
+  803005:	83 c4 20             	add    $0x20,%esp
+  803008:	e9 cc fb ff ff       	jmp    802bd9 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80300d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803010:	89 55 10             	mov    %edx,0x10(%ebp)
+  803013:	83 f9 01             	cmp    $0x1,%ecx
+  803016:	7f 1b                	jg     803033 <vprintfmt+0x46b>
+	else if (lflag)
+  803018:	85 c9                	test   %ecx,%ecx
+  80301a:	74 2c                	je     803048 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80301c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80301f:	8b 10                	mov    (%eax),%edx
+  803021:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803026:	8d 40 04             	lea    0x4(%eax),%eax
+  803029:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80302c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  803031:	eb bb                	jmp    802fee <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  803033:	8b 45 14             	mov    0x14(%ebp),%eax
+  803036:	8b 10                	mov    (%eax),%edx
+  803038:	8b 48 04             	mov    0x4(%eax),%ecx
+  80303b:	8d 40 08             	lea    0x8(%eax),%eax
+  80303e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803041:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  803046:	eb a6                	jmp    802fee <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803048:	8b 45 14             	mov    0x14(%ebp),%eax
+  80304b:	8b 10                	mov    (%eax),%edx
+  80304d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803052:	8d 40 04             	lea    0x4(%eax),%eax
+  803055:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803058:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80305d:	eb 8f                	jmp    802fee <vprintfmt+0x426>
+			putch(ch, putdat);
+  80305f:	89 55 10             	mov    %edx,0x10(%ebp)
+  803062:	83 ec 08             	sub    $0x8,%esp
+  803065:	53                   	push   %ebx
+  803066:	6a 25                	push   $0x25
+  803068:	ff d7                	call   *%edi
+			break;
+  80306a:	83 c4 10             	add    $0x10,%esp
+  80306d:	e9 67 fb ff ff       	jmp    802bd9 <vprintfmt+0x11>
+			putch('%', putdat);
+  803072:	83 ec 08             	sub    $0x8,%esp
+  803075:	53                   	push   %ebx
+  803076:	6a 25                	push   $0x25
+  803078:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80307a:	83 c4 10             	add    $0x10,%esp
+  80307d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  803081:	0f 84 ba fb ff ff    	je     802c41 <vprintfmt+0x79>
+  803087:	89 75 10             	mov    %esi,0x10(%ebp)
+  80308a:	89 f0                	mov    %esi,%eax
+  80308c:	83 e8 01             	sub    $0x1,%eax
+  80308f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  803093:	75 f7                	jne    80308c <vprintfmt+0x4c4>
+  803095:	89 45 10             	mov    %eax,0x10(%ebp)
+  803098:	e9 3c fb ff ff       	jmp    802bd9 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80309d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8030a0:	8d 70 01             	lea    0x1(%eax),%esi
+  8030a3:	0f b6 00             	movzbl (%eax),%eax
+  8030a6:	0f be d0             	movsbl %al,%edx
+  8030a9:	85 d2                	test   %edx,%edx
+  8030ab:	74 11                	je     8030be <vprintfmt+0x4f6>
+  8030ad:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030b0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030b3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030b6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030b9:	e9 5d fd ff ff       	jmp    802e1b <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030be:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030c4:	e9 10 fb ff ff       	jmp    802bd9 <vprintfmt+0x11>
+  8030c9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030cf:	e9 05 fb ff ff       	jmp    802bd9 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030d4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030d8:	7e 0a                	jle    8030e4 <vprintfmt+0x51c>
+  8030da:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030de:	0f 85 bd fc ff ff    	jne    802da1 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030e4:	ba 28 00 00 00       	mov    $0x28,%edx
+  8030e9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8030ee:	be 2d 3c 80 00       	mov    $0x803c2d,%esi
+  8030f3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030f6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030f9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030fc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030ff:	e9 17 fd ff ff       	jmp    802e1b <vprintfmt+0x253>
+}
+  803104:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803107:	5b                   	pop    %ebx
+  803108:	5e                   	pop    %esi
+  803109:	5f                   	pop    %edi
+  80310a:	5d                   	pop    %ebp
+  80310b:	c3                   	ret
+
+0080310c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80310c:	55                   	push   %ebp
+  80310d:	89 e5                	mov    %esp,%ebp
+  80310f:	83 ec 18             	sub    $0x18,%esp
+  803112:	8b 45 08             	mov    0x8(%ebp),%eax
+  803115:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803118:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80311b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80311f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803122:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	74 26                	je     803153 <vsnprintf+0x47>
+  80312d:	85 d2                	test   %edx,%edx
+  80312f:	7e 22                	jle    803153 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803131:	ff 75 14             	push   0x14(%ebp)
+  803134:	ff 75 10             	push   0x10(%ebp)
+  803137:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80313a:	50                   	push   %eax
+  80313b:	68 8e 2b 80 00       	push   $0x802b8e
+  803140:	e8 83 fa ff ff       	call   802bc8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803145:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803148:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80314b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80314e:	83 c4 10             	add    $0x10,%esp
+}
+  803151:	c9                   	leave
+  803152:	c3                   	ret
+		return -E_INVAL;
+  803153:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803158:	eb f7                	jmp    803151 <vsnprintf+0x45>
+
+0080315a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80315a:	55                   	push   %ebp
+  80315b:	89 e5                	mov    %esp,%ebp
+  80315d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803160:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803163:	50                   	push   %eax
+  803164:	ff 75 10             	push   0x10(%ebp)
+  803167:	ff 75 0c             	push   0xc(%ebp)
+  80316a:	ff 75 08             	push   0x8(%ebp)
+  80316d:	e8 9a ff ff ff       	call   80310c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803172:	c9                   	leave
+  803173:	c3                   	ret
+
+00803174 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803174:	55                   	push   %ebp
+  803175:	89 e5                	mov    %esp,%ebp
+  803177:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80317a:	80 3a 00             	cmpb   $0x0,(%edx)
+  80317d:	74 10                	je     80318f <strlen+0x1b>
+  80317f:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  803184:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803187:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80318b:	75 f7                	jne    803184 <strlen+0x10>
+	return n;
+}
+  80318d:	5d                   	pop    %ebp
+  80318e:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80318f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  803194:	eb f7                	jmp    80318d <strlen+0x19>
+
+00803196 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803196:	55                   	push   %ebp
+  803197:	89 e5                	mov    %esp,%ebp
+  803199:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80319c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80319f:	85 d2                	test   %edx,%edx
+  8031a1:	74 16                	je     8031b9 <strnlen+0x23>
+  8031a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8031ac:	74 09                	je     8031b7 <strnlen+0x21>
+		n++;
+  8031ae:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031b1:	39 d0                	cmp    %edx,%eax
+  8031b3:	75 f3                	jne    8031a8 <strnlen+0x12>
+		n++;
+  8031b5:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8031b7:	5d                   	pop    %ebp
+  8031b8:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031be:	eb f7                	jmp    8031b7 <strnlen+0x21>
+
+008031c0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031c0:	55                   	push   %ebp
+  8031c1:	89 e5                	mov    %esp,%ebp
+  8031c3:	53                   	push   %ebx
+  8031c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031cf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031d3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031d6:	83 c0 01             	add    $0x1,%eax
+  8031d9:	84 d2                	test   %dl,%dl
+  8031db:	75 f2                	jne    8031cf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031dd:	89 c8                	mov    %ecx,%eax
+  8031df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031e2:	c9                   	leave
+  8031e3:	c3                   	ret
+
+008031e4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031e4:	55                   	push   %ebp
+  8031e5:	89 e5                	mov    %esp,%ebp
+  8031e7:	53                   	push   %ebx
+  8031e8:	83 ec 10             	sub    $0x10,%esp
+  8031eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8031ee:	53                   	push   %ebx
+  8031ef:	e8 80 ff ff ff       	call   803174 <strlen>
+  8031f4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8031f7:	ff 75 0c             	push   0xc(%ebp)
+  8031fa:	01 d8                	add    %ebx,%eax
+  8031fc:	50                   	push   %eax
+  8031fd:	e8 be ff ff ff       	call   8031c0 <strcpy>
+	return dst;
+}
+  803202:	89 d8                	mov    %ebx,%eax
+  803204:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803207:	c9                   	leave
+  803208:	c3                   	ret
+
+00803209 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803209:	55                   	push   %ebp
+  80320a:	89 e5                	mov    %esp,%ebp
+  80320c:	56                   	push   %esi
+  80320d:	53                   	push   %ebx
+  80320e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803211:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803214:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  803217:	85 db                	test   %ebx,%ebx
+  803219:	74 17                	je     803232 <strncpy+0x29>
+  80321b:	01 f3                	add    %esi,%ebx
+  80321d:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80321f:	83 c0 01             	add    $0x1,%eax
+  803222:	0f b6 0a             	movzbl (%edx),%ecx
+  803225:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803228:	80 f9 01             	cmp    $0x1,%cl
+  80322b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80322e:	39 c3                	cmp    %eax,%ebx
+  803230:	75 ed                	jne    80321f <strncpy+0x16>
+	}
+	return ret;
+}
+  803232:	89 f0                	mov    %esi,%eax
+  803234:	5b                   	pop    %ebx
+  803235:	5e                   	pop    %esi
+  803236:	5d                   	pop    %ebp
+  803237:	c3                   	ret
+
+00803238 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803238:	55                   	push   %ebp
+  803239:	89 e5                	mov    %esp,%ebp
+  80323b:	56                   	push   %esi
+  80323c:	53                   	push   %ebx
+  80323d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803240:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803243:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803246:	89 f0                	mov    %esi,%eax
+  803248:	85 db                	test   %ebx,%ebx
+  80324a:	74 1e                	je     80326a <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  80324c:	83 eb 01             	sub    $0x1,%ebx
+  80324f:	74 16                	je     803267 <strlcpy+0x2f>
+  803251:	01 f3                	add    %esi,%ebx
+  803253:	0f b6 0a             	movzbl (%edx),%ecx
+  803256:	84 c9                	test   %cl,%cl
+  803258:	74 0d                	je     803267 <strlcpy+0x2f>
+			*dst++ = *src++;
+  80325a:	83 c2 01             	add    $0x1,%edx
+  80325d:	83 c0 01             	add    $0x1,%eax
+  803260:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  803263:	39 d8                	cmp    %ebx,%eax
+  803265:	75 ec                	jne    803253 <strlcpy+0x1b>
+		*dst = '\0';
+  803267:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80326a:	29 f0                	sub    %esi,%eax
+}
+  80326c:	5b                   	pop    %ebx
+  80326d:	5e                   	pop    %esi
+  80326e:	5d                   	pop    %ebp
+  80326f:	c3                   	ret
+
+00803270 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803270:	55                   	push   %ebp
+  803271:	89 e5                	mov    %esp,%ebp
+  803273:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803276:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803279:	0f b6 01             	movzbl (%ecx),%eax
+  80327c:	84 c0                	test   %al,%al
+  80327e:	74 11                	je     803291 <strcmp+0x21>
+  803280:	38 02                	cmp    %al,(%edx)
+  803282:	75 0d                	jne    803291 <strcmp+0x21>
+		p++, q++;
+  803284:	83 c1 01             	add    $0x1,%ecx
+  803287:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80328a:	0f b6 01             	movzbl (%ecx),%eax
+  80328d:	84 c0                	test   %al,%al
+  80328f:	75 ef                	jne    803280 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803291:	0f b6 c0             	movzbl %al,%eax
+  803294:	0f b6 12             	movzbl (%edx),%edx
+  803297:	29 d0                	sub    %edx,%eax
+}
+  803299:	5d                   	pop    %ebp
+  80329a:	c3                   	ret
+
+0080329b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80329b:	55                   	push   %ebp
+  80329c:	89 e5                	mov    %esp,%ebp
+  80329e:	53                   	push   %ebx
+  80329f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8032a5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8032a8:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8032ad:	85 d2                	test   %edx,%edx
+  8032af:	74 2e                	je     8032df <strncmp+0x44>
+  8032b1:	0f b6 01             	movzbl (%ecx),%eax
+  8032b4:	84 c0                	test   %al,%al
+  8032b6:	74 16                	je     8032ce <strncmp+0x33>
+  8032b8:	3a 03                	cmp    (%ebx),%al
+  8032ba:	75 12                	jne    8032ce <strncmp+0x33>
+		n--, p++, q++;
+  8032bc:	83 c1 01             	add    $0x1,%ecx
+  8032bf:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032c2:	83 ea 01             	sub    $0x1,%edx
+  8032c5:	75 ea                	jne    8032b1 <strncmp+0x16>
+		return 0;
+  8032c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cc:	eb 11                	jmp    8032df <strncmp+0x44>
+  8032ce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032d3:	85 d2                	test   %edx,%edx
+  8032d5:	74 08                	je     8032df <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032d7:	0f b6 01             	movzbl (%ecx),%eax
+  8032da:	0f b6 13             	movzbl (%ebx),%edx
+  8032dd:	29 d0                	sub    %edx,%eax
+}
+  8032df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032e2:	c9                   	leave
+  8032e3:	c3                   	ret
+
+008032e4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032e4:	55                   	push   %ebp
+  8032e5:	89 e5                	mov    %esp,%ebp
+  8032e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ea:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8032ee:	0f b6 10             	movzbl (%eax),%edx
+  8032f1:	84 d2                	test   %dl,%dl
+  8032f3:	74 15                	je     80330a <strchr+0x26>
+		if (*s == c)
+  8032f5:	38 d1                	cmp    %dl,%cl
+  8032f7:	74 0f                	je     803308 <strchr+0x24>
+	for (; *s; s++)
+  8032f9:	83 c0 01             	add    $0x1,%eax
+  8032fc:	0f b6 10             	movzbl (%eax),%edx
+  8032ff:	84 d2                	test   %dl,%dl
+  803301:	75 f2                	jne    8032f5 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  803303:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803308:	5d                   	pop    %ebp
+  803309:	c3                   	ret
+	return 0;
+  80330a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330f:	eb f7                	jmp    803308 <strchr+0x24>
+
+00803311 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  803311:	55                   	push   %ebp
+  803312:	89 e5                	mov    %esp,%ebp
+  803314:	53                   	push   %ebx
+  803315:	8b 45 08             	mov    0x8(%ebp),%eax
+  803318:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  80331b:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  80331e:	38 d3                	cmp    %dl,%bl
+  803320:	74 14                	je     803336 <strfind+0x25>
+  803322:	89 d1                	mov    %edx,%ecx
+  803324:	84 db                	test   %bl,%bl
+  803326:	74 0e                	je     803336 <strfind+0x25>
+	for (; *s; s++)
+  803328:	83 c0 01             	add    $0x1,%eax
+  80332b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80332e:	38 ca                	cmp    %cl,%dl
+  803330:	74 04                	je     803336 <strfind+0x25>
+  803332:	84 d2                	test   %dl,%dl
+  803334:	75 f2                	jne    803328 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  803336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803339:	c9                   	leave
+  80333a:	c3                   	ret
+
+0080333b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80333b:	55                   	push   %ebp
+  80333c:	89 e5                	mov    %esp,%ebp
+  80333e:	57                   	push   %edi
+  80333f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803342:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  803345:	85 c9                	test   %ecx,%ecx
+  803347:	74 20                	je     803369 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803349:	89 f8                	mov    %edi,%eax
+  80334b:	09 c8                	or     %ecx,%eax
+  80334d:	a8 03                	test   $0x3,%al
+  80334f:	75 12                	jne    803363 <memset+0x28>
+		c &= 0xFF;
+  803351:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803355:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80335b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80335e:	fc                   	cld
+  80335f:	f3 ab                	rep stos %eax,%es:(%edi)
+  803361:	eb 06                	jmp    803369 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  803363:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803366:	fc                   	cld
+  803367:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803369:	89 f8                	mov    %edi,%eax
+  80336b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80336e:	c9                   	leave
+  80336f:	c3                   	ret
+
+00803370 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803370:	55                   	push   %ebp
+  803371:	89 e5                	mov    %esp,%ebp
+  803373:	57                   	push   %edi
+  803374:	56                   	push   %esi
+  803375:	8b 45 08             	mov    0x8(%ebp),%eax
+  803378:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80337b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80337e:	39 c6                	cmp    %eax,%esi
+  803380:	73 32                	jae    8033b4 <memmove+0x44>
+  803382:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803385:	39 d0                	cmp    %edx,%eax
+  803387:	73 2b                	jae    8033b4 <memmove+0x44>
+		s += n;
+		d += n;
+  803389:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80338c:	89 d6                	mov    %edx,%esi
+  80338e:	09 fe                	or     %edi,%esi
+  803390:	09 ce                	or     %ecx,%esi
+  803392:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803398:	75 0e                	jne    8033a8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80339a:	83 ef 04             	sub    $0x4,%edi
+  80339d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8033a0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8033a3:	fd                   	std
+  8033a4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033a6:	eb 09                	jmp    8033b1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8033a8:	83 ef 01             	sub    $0x1,%edi
+  8033ab:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8033ae:	fd                   	std
+  8033af:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8033b1:	fc                   	cld
+  8033b2:	eb 1a                	jmp    8033ce <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033b4:	89 f2                	mov    %esi,%edx
+  8033b6:	09 c2                	or     %eax,%edx
+  8033b8:	09 ca                	or     %ecx,%edx
+  8033ba:	f6 c2 03             	test   $0x3,%dl
+  8033bd:	75 0a                	jne    8033c9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033bf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033c2:	89 c7                	mov    %eax,%edi
+  8033c4:	fc                   	cld
+  8033c5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033c7:	eb 05                	jmp    8033ce <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033c9:	89 c7                	mov    %eax,%edi
+  8033cb:	fc                   	cld
+  8033cc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033ce:	5e                   	pop    %esi
+  8033cf:	5f                   	pop    %edi
+  8033d0:	5d                   	pop    %ebp
+  8033d1:	c3                   	ret
+
+008033d2 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033d2:	55                   	push   %ebp
+  8033d3:	89 e5                	mov    %esp,%ebp
+  8033d5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033d8:	ff 75 10             	push   0x10(%ebp)
+  8033db:	ff 75 0c             	push   0xc(%ebp)
+  8033de:	ff 75 08             	push   0x8(%ebp)
+  8033e1:	e8 8a ff ff ff       	call   803370 <memmove>
+}
+  8033e6:	c9                   	leave
+  8033e7:	c3                   	ret
+
+008033e8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033e8:	55                   	push   %ebp
+  8033e9:	89 e5                	mov    %esp,%ebp
+  8033eb:	56                   	push   %esi
+  8033ec:	53                   	push   %ebx
+  8033ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8033f6:	85 f6                	test   %esi,%esi
+  8033f8:	74 29                	je     803423 <memcmp+0x3b>
+  8033fa:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8033fc:	0f b6 08             	movzbl (%eax),%ecx
+  8033ff:	0f b6 1a             	movzbl (%edx),%ebx
+  803402:	38 d9                	cmp    %bl,%cl
+  803404:	75 11                	jne    803417 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803406:	83 c0 01             	add    $0x1,%eax
+  803409:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80340c:	39 c6                	cmp    %eax,%esi
+  80340e:	75 ec                	jne    8033fc <memcmp+0x14>
+	}
+
+	return 0;
+  803410:	b8 00 00 00 00       	mov    $0x0,%eax
+  803415:	eb 08                	jmp    80341f <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  803417:	0f b6 c1             	movzbl %cl,%eax
+  80341a:	0f b6 db             	movzbl %bl,%ebx
+  80341d:	29 d8                	sub    %ebx,%eax
+}
+  80341f:	5b                   	pop    %ebx
+  803420:	5e                   	pop    %esi
+  803421:	5d                   	pop    %ebp
+  803422:	c3                   	ret
+	return 0;
+  803423:	b8 00 00 00 00       	mov    $0x0,%eax
+  803428:	eb f5                	jmp    80341f <memcmp+0x37>
+
+0080342a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80342a:	55                   	push   %ebp
+  80342b:	89 e5                	mov    %esp,%ebp
+  80342d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803433:	89 c2                	mov    %eax,%edx
+  803435:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803438:	39 d0                	cmp    %edx,%eax
+  80343a:	73 0d                	jae    803449 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80343c:	38 08                	cmp    %cl,(%eax)
+  80343e:	74 0d                	je     80344d <memfind+0x23>
+	for (; s < ends; s++)
+  803440:	83 c0 01             	add    $0x1,%eax
+  803443:	39 c2                	cmp    %eax,%edx
+  803445:	75 f5                	jne    80343c <memfind+0x12>
+  803447:	eb 06                	jmp    80344f <memfind+0x25>
+  803449:	89 c2                	mov    %eax,%edx
+  80344b:	eb 02                	jmp    80344f <memfind+0x25>
+  80344d:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  80344f:	89 d0                	mov    %edx,%eax
+  803451:	5d                   	pop    %ebp
+  803452:	c3                   	ret
+
+00803453 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803453:	55                   	push   %ebp
+  803454:	89 e5                	mov    %esp,%ebp
+  803456:	57                   	push   %edi
+  803457:	56                   	push   %esi
+  803458:	53                   	push   %ebx
+  803459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80345c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80345f:	0f b6 02             	movzbl (%edx),%eax
+  803462:	3c 20                	cmp    $0x20,%al
+  803464:	74 04                	je     80346a <strtol+0x17>
+  803466:	3c 09                	cmp    $0x9,%al
+  803468:	75 0e                	jne    803478 <strtol+0x25>
+		s++;
+  80346a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80346d:	0f b6 02             	movzbl (%edx),%eax
+  803470:	3c 20                	cmp    $0x20,%al
+  803472:	74 f6                	je     80346a <strtol+0x17>
+  803474:	3c 09                	cmp    $0x9,%al
+  803476:	74 f2                	je     80346a <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  803478:	3c 2b                	cmp    $0x2b,%al
+  80347a:	74 2a                	je     8034a6 <strtol+0x53>
+	int neg = 0;
+  80347c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803481:	3c 2d                	cmp    $0x2d,%al
+  803483:	74 2b                	je     8034b0 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803485:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80348b:	75 0f                	jne    80349c <strtol+0x49>
+  80348d:	80 3a 30             	cmpb   $0x30,(%edx)
+  803490:	74 28                	je     8034ba <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803492:	85 db                	test   %ebx,%ebx
+  803494:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803499:	0f 44 d8             	cmove  %eax,%ebx
+  80349c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034a1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8034a4:	eb 46                	jmp    8034ec <strtol+0x99>
+		s++;
+  8034a6:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8034a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ae:	eb d5                	jmp    803485 <strtol+0x32>
+		s++, neg = 1;
+  8034b0:	83 c2 01             	add    $0x1,%edx
+  8034b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034b8:	eb cb                	jmp    803485 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034ba:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034be:	74 0e                	je     8034ce <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034c0:	85 db                	test   %ebx,%ebx
+  8034c2:	75 d8                	jne    80349c <strtol+0x49>
+		s++, base = 8;
+  8034c4:	83 c2 01             	add    $0x1,%edx
+  8034c7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034cc:	eb ce                	jmp    80349c <strtol+0x49>
+		s += 2, base = 16;
+  8034ce:	83 c2 02             	add    $0x2,%edx
+  8034d1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034d6:	eb c4                	jmp    80349c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034d8:	0f be c0             	movsbl %al,%eax
+  8034db:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034de:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034e1:	7d 3a                	jge    80351d <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034e3:	83 c2 01             	add    $0x1,%edx
+  8034e6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8034ea:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8034ec:	0f b6 02             	movzbl (%edx),%eax
+  8034ef:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8034f2:	89 f3                	mov    %esi,%ebx
+  8034f4:	80 fb 09             	cmp    $0x9,%bl
+  8034f7:	76 df                	jbe    8034d8 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8034f9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8034fc:	89 f3                	mov    %esi,%ebx
+  8034fe:	80 fb 19             	cmp    $0x19,%bl
+  803501:	77 08                	ja     80350b <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  803503:	0f be c0             	movsbl %al,%eax
+  803506:	83 e8 57             	sub    $0x57,%eax
+  803509:	eb d3                	jmp    8034de <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80350b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80350e:	89 f3                	mov    %esi,%ebx
+  803510:	80 fb 19             	cmp    $0x19,%bl
+  803513:	77 08                	ja     80351d <strtol+0xca>
+			dig = *s - 'A' + 10;
+  803515:	0f be c0             	movsbl %al,%eax
+  803518:	83 e8 37             	sub    $0x37,%eax
+  80351b:	eb c1                	jmp    8034de <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80351d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803521:	74 05                	je     803528 <strtol+0xd5>
+		*endptr = (char *) s;
+  803523:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803526:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803528:	89 c8                	mov    %ecx,%eax
+  80352a:	f7 d8                	neg    %eax
+  80352c:	85 ff                	test   %edi,%edi
+  80352e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803531:	89 c8                	mov    %ecx,%eax
+  803533:	5b                   	pop    %ebx
+  803534:	5e                   	pop    %esi
+  803535:	5f                   	pop    %edi
+  803536:	5d                   	pop    %ebp
+  803537:	c3                   	ret
+
+00803538 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803538:	55                   	push   %ebp
+  803539:	89 e5                	mov    %esp,%ebp
+  80353b:	56                   	push   %esi
+  80353c:	53                   	push   %ebx
+  80353d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803540:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803543:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803546:	85 c0                	test   %eax,%eax
+  803548:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80354d:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803550:	83 ec 0c             	sub    $0xc,%esp
+  803553:	50                   	push   %eax
+  803554:	e8 0a ce ff ff       	call   800363 <sys_ipc_recv>
+  803559:	83 c4 10             	add    $0x10,%esp
+  80355c:	85 c0                	test   %eax,%eax
+  80355e:	0f 88 8b 00 00 00    	js     8035ef <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803564:	85 f6                	test   %esi,%esi
+  803566:	74 2a                	je     803592 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803568:	89 e2                	mov    %esp,%edx
+  80356a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80356f:	29 d0                	sub    %edx,%eax
+  803571:	89 c2                	mov    %eax,%edx
+  803573:	c1 ea 0f             	shr    $0xf,%edx
+  803576:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80357b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803580:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803583:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80358a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803590:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803592:	85 db                	test   %ebx,%ebx
+  803594:	74 2a                	je     8035c0 <ipc_recv+0x88>
+  803596:	89 e2                	mov    %esp,%edx
+  803598:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80359d:	29 d0                	sub    %edx,%eax
+  80359f:	89 c2                	mov    %eax,%edx
+  8035a1:	c1 ea 0f             	shr    $0xf,%edx
+  8035a4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ae:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035b1:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035b8:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035be:	89 03                	mov    %eax,(%ebx)
+  8035c0:	89 e2                	mov    %esp,%edx
+  8035c2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035c7:	29 d0                	sub    %edx,%eax
+  8035c9:	89 c2                	mov    %eax,%edx
+  8035cb:	c1 ea 0f             	shr    $0xf,%edx
+  8035ce:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d8:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035db:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035e2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035eb:	5b                   	pop    %ebx
+  8035ec:	5e                   	pop    %esi
+  8035ed:	5d                   	pop    %ebp
+  8035ee:	c3                   	ret
+		if(from_env_store != NULL)
+  8035ef:	85 f6                	test   %esi,%esi
+  8035f1:	74 06                	je     8035f9 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035f3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035f9:	85 db                	test   %ebx,%ebx
+  8035fb:	74 eb                	je     8035e8 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803603:	eb e3                	jmp    8035e8 <ipc_recv+0xb0>
+
+00803605 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803605:	55                   	push   %ebp
+  803606:	89 e5                	mov    %esp,%ebp
+  803608:	57                   	push   %edi
+  803609:	56                   	push   %esi
+  80360a:	53                   	push   %ebx
+  80360b:	83 ec 14             	sub    $0x14,%esp
+  80360e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803611:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803614:	8b 75 14             	mov    0x14(%ebp),%esi
+  803617:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803621:	0f 44 c2             	cmove  %edx,%eax
+  803624:	ff 75 10             	push   0x10(%ebp)
+  803627:	50                   	push   %eax
+  803628:	e8 98 cd ff ff       	call   8003c5 <sys_ipc_recv_pages>
+  80362d:	83 c4 10             	add    $0x10,%esp
+  803630:	85 c0                	test   %eax,%eax
+  803632:	0f 88 ba 00 00 00    	js     8036f2 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803638:	85 ff                	test   %edi,%edi
+  80363a:	74 2a                	je     803666 <ipc_recv_pages+0x61>
+  80363c:	89 e2                	mov    %esp,%edx
+  80363e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803643:	29 d0                	sub    %edx,%eax
+  803645:	89 c2                	mov    %eax,%edx
+  803647:	c1 ea 0f             	shr    $0xf,%edx
+  80364a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80364f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803654:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803657:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80365e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803664:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803666:	85 f6                	test   %esi,%esi
+  803668:	74 2a                	je     803694 <ipc_recv_pages+0x8f>
+  80366a:	89 e2                	mov    %esp,%edx
+  80366c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803671:	29 d0                	sub    %edx,%eax
+  803673:	89 c2                	mov    %eax,%edx
+  803675:	c1 ea 0f             	shr    $0xf,%edx
+  803678:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80367d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803682:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803685:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80368c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803692:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803694:	85 db                	test   %ebx,%ebx
+  803696:	74 2a                	je     8036c2 <ipc_recv_pages+0xbd>
+  803698:	89 e2                	mov    %esp,%edx
+  80369a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80369f:	29 d0                	sub    %edx,%eax
+  8036a1:	89 c2                	mov    %eax,%edx
+  8036a3:	c1 ea 0f             	shr    $0xf,%edx
+  8036a6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b0:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036b3:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036ba:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036c0:	89 03                	mov    %eax,(%ebx)
+  8036c2:	89 e2                	mov    %esp,%edx
+  8036c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036c9:	29 d0                	sub    %edx,%eax
+  8036cb:	89 c2                	mov    %eax,%edx
+  8036cd:	c1 ea 0f             	shr    $0xf,%edx
+  8036d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036da:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036dd:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036e4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ed:	5b                   	pop    %ebx
+  8036ee:	5e                   	pop    %esi
+  8036ef:	5f                   	pop    %edi
+  8036f0:	5d                   	pop    %ebp
+  8036f1:	c3                   	ret
+		if (from_env_store)
+  8036f2:	85 ff                	test   %edi,%edi
+  8036f4:	74 06                	je     8036fc <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036f6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036fc:	85 f6                	test   %esi,%esi
+  8036fe:	74 06                	je     803706 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803700:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803706:	85 db                	test   %ebx,%ebx
+  803708:	74 e0                	je     8036ea <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  80370a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803710:	eb d8                	jmp    8036ea <ipc_recv_pages+0xe5>
+
+00803712 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803712:	55                   	push   %ebp
+  803713:	89 e5                	mov    %esp,%ebp
+  803715:	57                   	push   %edi
+  803716:	56                   	push   %esi
+  803717:	53                   	push   %ebx
+  803718:	83 ec 1c             	sub    $0x1c,%esp
+  80371b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80371e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803721:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803727:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80372b:	75 2b                	jne    803758 <ipc_try_send_pages+0x46>
+  80372d:	89 e2                	mov    %esp,%edx
+  80372f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803734:	29 d0                	sub    %edx,%eax
+  803736:	89 c2                	mov    %eax,%edx
+  803738:	c1 ea 0f             	shr    $0xf,%edx
+  80373b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803740:	b8 00 00 00 00       	mov    $0x0,%eax
+  803745:	0f 42 c2             	cmovb  %edx,%eax
+  803748:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80374f:	8b 70 48             	mov    0x48(%eax),%esi
+  803752:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803758:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80375e:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803763:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803766:	85 ff                	test   %edi,%edi
+  803768:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80376d:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803770:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803776:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80377c:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803782:	83 ec 0c             	sub    $0xc,%esp
+  803785:	ff 75 14             	push   0x14(%ebp)
+  803788:	ff 75 18             	push   0x18(%ebp)
+  80378b:	57                   	push   %edi
+  80378c:	ff 75 0c             	push   0xc(%ebp)
+  80378f:	ff 75 08             	push   0x8(%ebp)
+  803792:	e8 0d cc ff ff       	call   8003a4 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803797:	83 c4 20             	add    $0x20,%esp
+  80379a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80379d:	75 21                	jne    8037c0 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80379f:	83 ec 04             	sub    $0x4,%esp
+  8037a2:	6a ff                	push   $0xffffffff
+  8037a4:	53                   	push   %ebx
+  8037a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8037a8:	e8 04 ce ff ff       	call   8005b1 <sys_futex_wait>
+  8037ad:	83 c4 10             	add    $0x10,%esp
+  8037b0:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037b3:	74 c7                	je     80377c <ipc_try_send_pages+0x6a>
+  8037b5:	85 c0                	test   %eax,%eax
+  8037b7:	79 c3                	jns    80377c <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037b9:	e8 d6 c9 ff ff       	call   800194 <sys_yield>
+  8037be:	eb bc                	jmp    80377c <ipc_try_send_pages+0x6a>
+	}
+}
+  8037c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c3:	5b                   	pop    %ebx
+  8037c4:	5e                   	pop    %esi
+  8037c5:	5f                   	pop    %edi
+  8037c6:	5d                   	pop    %ebp
+  8037c7:	c3                   	ret
+
+008037c8 <ipc_send>:
+{
+  8037c8:	55                   	push   %ebp
+  8037c9:	89 e5                	mov    %esp,%ebp
+  8037cb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037ce:	ff 75 14             	push   0x14(%ebp)
+  8037d1:	6a 01                	push   $0x1
+  8037d3:	ff 75 10             	push   0x10(%ebp)
+  8037d6:	ff 75 0c             	push   0xc(%ebp)
+  8037d9:	ff 75 08             	push   0x8(%ebp)
+  8037dc:	e8 31 ff ff ff       	call   803712 <ipc_try_send_pages>
+  8037e1:	83 c4 20             	add    $0x20,%esp
+  8037e4:	85 c0                	test   %eax,%eax
+  8037e6:	78 02                	js     8037ea <ipc_send+0x22>
+}
+  8037e8:	c9                   	leave
+  8037e9:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037ea:	50                   	push   %eax
+  8037eb:	68 4b 3f 80 00       	push   $0x803f4b
+  8037f0:	6a 3f                	push   $0x3f
+  8037f2:	68 60 3f 80 00       	push   $0x803f60
+  8037f7:	e8 f2 f1 ff ff       	call   8029ee <_panic>
+
+008037fc <ipc_send_pages>:
+{
+  8037fc:	55                   	push   %ebp
+  8037fd:	89 e5                	mov    %esp,%ebp
+  8037ff:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803802:	ff 75 18             	push   0x18(%ebp)
+  803805:	ff 75 14             	push   0x14(%ebp)
+  803808:	ff 75 10             	push   0x10(%ebp)
+  80380b:	ff 75 0c             	push   0xc(%ebp)
+  80380e:	ff 75 08             	push   0x8(%ebp)
+  803811:	e8 fc fe ff ff       	call   803712 <ipc_try_send_pages>
+  803816:	83 c4 20             	add    $0x20,%esp
+  803819:	85 c0                	test   %eax,%eax
+  80381b:	78 02                	js     80381f <ipc_send_pages+0x23>
+}
+  80381d:	c9                   	leave
+  80381e:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80381f:	50                   	push   %eax
+  803820:	68 6a 3f 80 00       	push   $0x803f6a
+  803825:	6a 64                	push   $0x64
+  803827:	68 60 3f 80 00       	push   $0x803f60
+  80382c:	e8 bd f1 ff ff       	call   8029ee <_panic>
+
+00803831 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803831:	55                   	push   %ebp
+  803832:	89 e5                	mov    %esp,%ebp
+  803834:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803837:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80383c:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803842:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803848:	8b 52 50             	mov    0x50(%edx),%edx
+  80384b:	39 ca                	cmp    %ecx,%edx
+  80384d:	74 11                	je     803860 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80384f:	83 c0 01             	add    $0x1,%eax
+  803852:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803857:	75 e3                	jne    80383c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385e:	eb 0e                	jmp    80386e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803860:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803866:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80386b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80386e:	5d                   	pop    %ebp
+  80386f:	c3                   	ret
+
+00803870 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803870:	55                   	push   %ebp
+  803871:	89 e5                	mov    %esp,%ebp
+  803873:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803876:	89 c2                	mov    %eax,%edx
+  803878:	c1 ea 16             	shr    $0x16,%edx
+  80387b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803882:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803887:	f6 c1 01             	test   $0x1,%cl
+  80388a:	74 1e                	je     8038aa <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80388c:	c1 e8 0c             	shr    $0xc,%eax
+  80388f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803896:	a8 01                	test   $0x1,%al
+  803898:	74 10                	je     8038aa <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80389a:	c1 e8 0c             	shr    $0xc,%eax
+  80389d:	c1 e0 04             	shl    $0x4,%eax
+  8038a0:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8038a7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038aa:	89 d0                	mov    %edx,%eax
+  8038ac:	5d                   	pop    %ebp
+  8038ad:	c3                   	ret
+
+008038ae <__udivdi3>:
+  8038ae:	57                   	push   %edi
+  8038af:	56                   	push   %esi
+  8038b0:	53                   	push   %ebx
+  8038b1:	83 ec 20             	sub    $0x20,%esp
+  8038b4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038b8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038bc:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038c0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038c4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038c8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038cc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038d4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038e3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038ea:	00 
+  8038eb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038f2:	00 
+  8038f3:	eb 08                	jmp    8038fd <__udivdi3+0x4f>
+  8038f5:	83 e9 01             	sub    $0x1,%ecx
+  8038f8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038fb:	74 68                	je     803965 <__udivdi3+0xb7>
+  8038fd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803901:	01 c0                	add    %eax,%eax
+  803903:	89 c6                	mov    %eax,%esi
+  803905:	89 d7                	mov    %edx,%edi
+  803907:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80390b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80390f:	0f ad d0             	shrd   %cl,%edx,%eax
+  803912:	d3 ea                	shr    %cl,%edx
+  803914:	f6 c1 20             	test   $0x20,%cl
+  803917:	74 04                	je     80391d <__udivdi3+0x6f>
+  803919:	89 d0                	mov    %edx,%eax
+  80391b:	31 d2                	xor    %edx,%edx
+  80391d:	83 e0 01             	and    $0x1,%eax
+  803920:	89 04 24             	mov    %eax,(%esp)
+  803923:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80392a:	00 
+  80392b:	8b 04 24             	mov    (%esp),%eax
+  80392e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803932:	09 f0                	or     %esi,%eax
+  803934:	09 fa                	or     %edi,%edx
+  803936:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80393a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80393e:	39 f0                	cmp    %esi,%eax
+  803940:	89 d3                	mov    %edx,%ebx
+  803942:	19 fb                	sbb    %edi,%ebx
+  803944:	72 af                	jb     8038f5 <__udivdi3+0x47>
+  803946:	29 f0                	sub    %esi,%eax
+  803948:	19 fa                	sbb    %edi,%edx
+  80394a:	89 cf                	mov    %ecx,%edi
+  80394c:	c1 ef 05             	shr    $0x5,%edi
+  80394f:	83 e7 01             	and    $0x1,%edi
+  803952:	89 fe                	mov    %edi,%esi
+  803954:	83 f6 01             	xor    $0x1,%esi
+  803957:	d3 e6                	shl    %cl,%esi
+  803959:	d3 e7                	shl    %cl,%edi
+  80395b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80395f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803963:	eb 90                	jmp    8038f5 <__udivdi3+0x47>
+  803965:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803969:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80396d:	83 c4 20             	add    $0x20,%esp
+  803970:	5b                   	pop    %ebx
+  803971:	5e                   	pop    %esi
+  803972:	5f                   	pop    %edi
+  803973:	c3                   	ret
+
+00803974 <__umoddi3>:
+  803974:	57                   	push   %edi
+  803975:	56                   	push   %esi
+  803976:	53                   	push   %ebx
+  803977:	83 ec 08             	sub    $0x8,%esp
+  80397a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80397e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803982:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803986:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80398a:	57                   	push   %edi
+  80398b:	56                   	push   %esi
+  80398c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803990:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803994:	52                   	push   %edx
+  803995:	50                   	push   %eax
+  803996:	e8 13 ff ff ff       	call   8038ae <__udivdi3>
+  80399b:	89 c3                	mov    %eax,%ebx
+  80399d:	0f af d6             	imul   %esi,%edx
+  8039a0:	89 f9                	mov    %edi,%ecx
+  8039a2:	0f af cb             	imul   %ebx,%ecx
+  8039a5:	01 d1                	add    %edx,%ecx
+  8039a7:	89 d8                	mov    %ebx,%eax
+  8039a9:	f7 e6                	mul    %esi
+  8039ab:	89 c6                	mov    %eax,%esi
+  8039ad:	89 d7                	mov    %edx,%edi
+  8039af:	01 cf                	add    %ecx,%edi
+  8039b1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039b5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039b9:	29 f0                	sub    %esi,%eax
+  8039bb:	19 fa                	sbb    %edi,%edx
+  8039bd:	83 c4 18             	add    $0x18,%esp
+  8039c0:	5b                   	pop    %ebx
+  8039c1:	5e                   	pop    %esi
+  8039c2:	5f                   	pop    %edi
+  8039c3:	c3                   	ret
+
+008039c4 <__divdi3>:
+  8039c4:	53                   	push   %ebx
+  8039c5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039c9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039cd:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039d1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039d5:	85 d2                	test   %edx,%edx
+  8039d7:	78 12                	js     8039eb <__divdi3+0x27>
+  8039d9:	85 db                	test   %ebx,%ebx
+  8039db:	78 2e                	js     803a0b <__divdi3+0x47>
+  8039dd:	53                   	push   %ebx
+  8039de:	51                   	push   %ecx
+  8039df:	52                   	push   %edx
+  8039e0:	50                   	push   %eax
+  8039e1:	e8 c8 fe ff ff       	call   8038ae <__udivdi3>
+  8039e6:	83 c4 10             	add    $0x10,%esp
+  8039e9:	eb 1e                	jmp    803a09 <__divdi3+0x45>
+  8039eb:	f7 d8                	neg    %eax
+  8039ed:	83 d2 00             	adc    $0x0,%edx
+  8039f0:	f7 da                	neg    %edx
+  8039f2:	85 db                	test   %ebx,%ebx
+  8039f4:	78 2a                	js     803a20 <__divdi3+0x5c>
+  8039f6:	53                   	push   %ebx
+  8039f7:	51                   	push   %ecx
+  8039f8:	52                   	push   %edx
+  8039f9:	50                   	push   %eax
+  8039fa:	e8 af fe ff ff       	call   8038ae <__udivdi3>
+  8039ff:	83 c4 10             	add    $0x10,%esp
+  803a02:	f7 d8                	neg    %eax
+  803a04:	83 d2 00             	adc    $0x0,%edx
+  803a07:	f7 da                	neg    %edx
+  803a09:	5b                   	pop    %ebx
+  803a0a:	c3                   	ret
+  803a0b:	f7 d9                	neg    %ecx
+  803a0d:	83 d3 00             	adc    $0x0,%ebx
+  803a10:	f7 db                	neg    %ebx
+  803a12:	53                   	push   %ebx
+  803a13:	51                   	push   %ecx
+  803a14:	52                   	push   %edx
+  803a15:	50                   	push   %eax
+  803a16:	e8 93 fe ff ff       	call   8038ae <__udivdi3>
+  803a1b:	83 c4 10             	add    $0x10,%esp
+  803a1e:	eb e2                	jmp    803a02 <__divdi3+0x3e>
+  803a20:	f7 d9                	neg    %ecx
+  803a22:	83 d3 00             	adc    $0x0,%ebx
+  803a25:	f7 db                	neg    %ebx
+  803a27:	53                   	push   %ebx
+  803a28:	51                   	push   %ecx
+  803a29:	52                   	push   %edx
+  803a2a:	50                   	push   %eax
+  803a2b:	e8 7e fe ff ff       	call   8038ae <__udivdi3>
+  803a30:	83 c4 10             	add    $0x10,%esp
+  803a33:	eb d4                	jmp    803a09 <__divdi3+0x45>
+
+00803a35 <__moddi3>:
+  803a35:	57                   	push   %edi
+  803a36:	56                   	push   %esi
+  803a37:	53                   	push   %ebx
+  803a38:	83 ec 08             	sub    $0x8,%esp
+  803a3b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a3f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a43:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a47:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a4b:	57                   	push   %edi
+  803a4c:	56                   	push   %esi
+  803a4d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a51:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a55:	52                   	push   %edx
+  803a56:	50                   	push   %eax
+  803a57:	e8 68 ff ff ff       	call   8039c4 <__divdi3>
+  803a5c:	89 c3                	mov    %eax,%ebx
+  803a5e:	0f af d6             	imul   %esi,%edx
+  803a61:	89 f9                	mov    %edi,%ecx
+  803a63:	0f af cb             	imul   %ebx,%ecx
+  803a66:	01 d1                	add    %edx,%ecx
+  803a68:	89 d8                	mov    %ebx,%eax
+  803a6a:	f7 e6                	mul    %esi
+  803a6c:	89 c6                	mov    %eax,%esi
+  803a6e:	89 d7                	mov    %edx,%edi
+  803a70:	01 cf                	add    %ecx,%edi
+  803a72:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a76:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a7a:	29 f0                	sub    %esi,%eax
+  803a7c:	19 fa                	sbb    %edi,%edx
+  803a7e:	83 c4 18             	add    $0x18,%esp
+  803a81:	5b                   	pop    %ebx
+  803a82:	5e                   	pop    %esi
+  803a83:	5f                   	pop    %edi
+  803a84:	c3                   	ret
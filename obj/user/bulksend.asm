@@ -0,0 +1,8581 @@
+
+obj/user/bulksend.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d4 02 00 00       	call   800305 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+
+static char buf[CHUNK];
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 60 40 80 00       	push   $0x804060
+  800041:	e8 fb 03 00 00       	call   800441 <cprintf>
+	exit();
+  800046:	e8 47 03 00 00       	call   800392 <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <run>:
+
+// Send NBYTES to one client and report the throughput and how many
+// cycles the whole system spent per byte sent.
+static void
+run(int serversock, const char *how)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	57                   	push   %edi
+  800054:	56                   	push   %esi
+  800055:	53                   	push   %ebx
+  800056:	81 ec f0 00 00 00    	sub    $0xf0,%esp
+  80005c:	89 95 10 ff ff ff    	mov    %edx,-0xf0(%ebp)
+	int clientsock, n;
+	struct sockaddr_in client;
+	unsigned int clientlen = sizeof(client);
+  800062:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+	struct NetStats ns0, ns1;
+	unsigned start, ms;
+	uint64_t t0, cycles;
+
+	if ((clientsock = accept(serversock, (struct sockaddr *) &client,
+  800069:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  80006c:	52                   	push   %edx
+  80006d:	8d 55 d8             	lea    -0x28(%ebp),%edx
+  800070:	52                   	push   %edx
+  800071:	50                   	push   %eax
+  800072:	e8 84 1e 00 00       	call   801efb <accept>
+  800077:	89 c6                	mov    %eax,%esi
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	85 c0                	test   %eax,%eax
+  80007e:	78 32                	js     8000b2 <run+0x62>
+				 &clientlen)) < 0)
+		die("Failed to accept client connection");
+
+	sys_net_stats(&ns0);
+  800080:	83 ec 0c             	sub    $0xc,%esp
+  800083:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  800089:	50                   	push   %eax
+  80008a:	e8 14 12 00 00       	call   8012a3 <sys_net_stats>
+	start = sys_time_msec();
+  80008f:	e8 2c 11 00 00       	call   8011c0 <sys_time_msec>
+  800094:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+        uint64_t tsc;
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  80009a:	0f 31                	rdtsc
+  80009c:	89 85 08 ff ff ff    	mov    %eax,-0xf8(%ebp)
+  8000a2:	89 95 0c ff ff ff    	mov    %edx,-0xf4(%ebp)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	bb 00 04 00 00       	mov    $0x400,%ebx
+  8000b0:	eb 11                	jmp    8000c3 <run+0x73>
+		die("Failed to accept client connection");
+  8000b2:	b8 b8 40 80 00       	mov    $0x8040b8,%eax
+  8000b7:	e8 79 ff ff ff       	call   800035 <die>
+  8000bc:	eb c2                	jmp    800080 <run+0x30>
+	t0 = read_tsc();
+	for (n = 0; n < NBYTES; n += CHUNK)
+  8000be:	83 eb 01             	sub    $0x1,%ebx
+  8000c1:	74 29                	je     8000ec <run+0x9c>
+		if (write(clientsock, buf, CHUNK) != CHUNK)
+  8000c3:	83 ec 04             	sub    $0x4,%esp
+  8000c6:	68 00 04 00 00       	push   $0x400
+  8000cb:	68 00 60 80 00       	push   $0x806000
+  8000d0:	56                   	push   %esi
+  8000d1:	e8 ec 16 00 00       	call   8017c2 <write>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000de:	74 de                	je     8000be <run+0x6e>
+			die("Failed to send");
+  8000e0:	b8 64 40 80 00       	mov    $0x804064,%eax
+  8000e5:	e8 4b ff ff ff       	call   800035 <die>
+  8000ea:	eb d2                	jmp    8000be <run+0x6e>
+	close(clientsock);
+  8000ec:	83 ec 0c             	sub    $0xc,%esp
+  8000ef:	56                   	push   %esi
+  8000f0:	e8 96 14 00 00       	call   80158b <close>
+  8000f5:	0f 31                	rdtsc
+	cycles = read_tsc() - t0;
+  8000f7:	2b 85 08 ff ff ff    	sub    -0xf8(%ebp),%eax
+  8000fd:	1b 95 0c ff ff ff    	sbb    -0xf4(%ebp),%edx
+  800103:	89 c6                	mov    %eax,%esi
+  800105:	89 d7                	mov    %edx,%edi
+	ms = sys_time_msec() - start;
+  800107:	e8 b4 10 00 00       	call   8011c0 <sys_time_msec>
+  80010c:	8b 8d 14 ff ff ff    	mov    -0xec(%ebp),%ecx
+  800112:	29 c8                	sub    %ecx,%eax
+  800114:	89 c3                	mov    %eax,%ebx
+	sys_net_stats(&ns1);
+  800116:	8d 85 1c ff ff ff    	lea    -0xe4(%ebp),%eax
+  80011c:	89 04 24             	mov    %eax,(%esp)
+  80011f:	e8 7f 11 00 00       	call   8012a3 <sys_net_stats>
+
+	cycles = cycles * 100 / NBYTES;
+  800124:	6b cf 64             	imul   $0x64,%edi,%ecx
+  800127:	b8 64 00 00 00       	mov    $0x64,%eax
+  80012c:	f7 e6                	mul    %esi
+  80012e:	01 ca                	add    %ecx,%edx
+  800130:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+  800134:	c1 ea 14             	shr    $0x14,%edx
+	cprintf("bulksend: offload %s: %d bytes in %u ms, %u KB/s, "
+		"%u.%02u cycles/byte\n", how, NBYTES, ms,
+		NBYTES / (ms ? ms : 1) * 1000 / 1024,
+		(uint32_t) cycles / 100, (uint32_t) cycles % 100);
+  800137:	89 c6                	mov    %eax,%esi
+	cprintf("bulksend: offload %s: %d bytes in %u ms, %u KB/s, "
+  800139:	83 c4 0c             	add    $0xc,%esp
+  80013c:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  800141:	89 f0                	mov    %esi,%eax
+  800143:	f7 e2                	mul    %edx
+  800145:	c1 ea 05             	shr    $0x5,%edx
+  800148:	6b ca 64             	imul   $0x64,%edx,%ecx
+  80014b:	89 f0                	mov    %esi,%eax
+  80014d:	29 c8                	sub    %ecx,%eax
+  80014f:	50                   	push   %eax
+  800150:	52                   	push   %edx
+		NBYTES / (ms ? ms : 1) * 1000 / 1024,
+  800151:	85 db                	test   %ebx,%ebx
+  800153:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800158:	0f 45 cb             	cmovne %ebx,%ecx
+  80015b:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800160:	ba 00 00 00 00       	mov    $0x0,%edx
+  800165:	f7 f1                	div    %ecx
+  800167:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+	cprintf("bulksend: offload %s: %d bytes in %u ms, %u KB/s, "
+  80016d:	c1 e8 0a             	shr    $0xa,%eax
+  800170:	50                   	push   %eax
+  800171:	53                   	push   %ebx
+  800172:	68 00 00 10 00       	push   $0x100000
+  800177:	8b bd 10 ff ff ff    	mov    -0xf0(%ebp),%edi
+  80017d:	57                   	push   %edi
+  80017e:	68 dc 40 80 00       	push   $0x8040dc
+  800183:	e8 b9 02 00 00       	call   800441 <cprintf>
+	cprintf("bulksend: offload %s: %u packets sent, %u copied by the "
+  800188:	83 c4 18             	add    $0x18,%esp
+  80018b:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  800191:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  800194:	50                   	push   %eax
+  800195:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  80019b:	2b 45 ac             	sub    -0x54(%ebp),%eax
+  80019e:	50                   	push   %eax
+  80019f:	8b 85 30 ff ff ff    	mov    -0xd0(%ebp),%eax
+  8001a5:	2b 45 8c             	sub    -0x74(%ebp),%eax
+  8001a8:	50                   	push   %eax
+  8001a9:	8b 85 28 ff ff ff    	mov    -0xd8(%ebp),%eax
+  8001af:	2b 45 84             	sub    -0x7c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	57                   	push   %edi
+  8001b4:	68 24 41 80 00       	push   $0x804124
+  8001b9:	e8 83 02 00 00       	call   800441 <cprintf>
+		"kernel, %u checksummed by the card, %u TSO\n", how,
+		ns1.ns_tx_packets - ns0.ns_tx_packets,
+		ns1.ns_tx_copies - ns0.ns_tx_copies,
+		ns1.ns_tx_csum - ns0.ns_tx_csum,
+		ns1.ns_tx_tso - ns0.ns_tx_tso);
+}
+  8001be:	83 c4 20             	add    $0x20,%esp
+  8001c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c4:	5b                   	pop    %ebx
+  8001c5:	5e                   	pop    %esi
+  8001c6:	5f                   	pop    %edi
+  8001c7:	5d                   	pop    %ebp
+  8001c8:	c3                   	ret
+
+008001c9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001c9:	55                   	push   %ebp
+  8001ca:	89 e5                	mov    %esp,%ebp
+  8001cc:	56                   	push   %esi
+  8001cd:	53                   	push   %ebx
+  8001ce:	83 ec 14             	sub    $0x14,%esp
+	int serversock, i;
+	struct sockaddr_in addr;
+
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8001d1:	6a 06                	push   $0x6
+  8001d3:	6a 01                	push   $0x1
+  8001d5:	6a 02                	push   $0x2
+  8001d7:	e8 02 1f 00 00       	call   8020de <socket>
+  8001dc:	89 c3                	mov    %eax,%ebx
+  8001de:	83 c4 10             	add    $0x10,%esp
+  8001e1:	85 c0                	test   %eax,%eax
+  8001e3:	0f 88 ef 00 00 00    	js     8002d8 <umain+0x10f>
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+  8001e9:	83 ec 04             	sub    $0x4,%esp
+  8001ec:	6a 10                	push   $0x10
+  8001ee:	6a 00                	push   $0x0
+  8001f0:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  8001f3:	56                   	push   %esi
+  8001f4:	e8 ba 0a 00 00       	call   800cb3 <memset>
+	addr.sin_family = AF_INET;
+  8001f9:	c6 45 e9 02          	movb   $0x2,-0x17(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  8001fd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800204:	e8 28 3a 00 00       	call   803c31 <htonl>
+  800209:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	addr.sin_port = htons(PORT);
+  80020c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800213:	e8 ff 39 00 00       	call   803c17 <htons>
+  800218:	66 89 45 ea          	mov    %ax,-0x16(%ebp)
+	if (bind(serversock, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  80021c:	83 c4 0c             	add    $0xc,%esp
+  80021f:	6a 10                	push   $0x10
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	e8 15 1d 00 00       	call   801f3d <bind>
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	85 c0                	test   %eax,%eax
+  80022d:	0f 88 b4 00 00 00    	js     8002e7 <umain+0x11e>
+		die("Failed to bind the server socket");
+	if (listen(serversock, 1) < 0)
+  800233:	83 ec 08             	sub    $0x8,%esp
+  800236:	6a 01                	push   $0x1
+  800238:	53                   	push   %ebx
+  800239:	e8 6e 1d 00 00       	call   801fac <listen>
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	85 c0                	test   %eax,%eax
+  800243:	0f 88 ad 00 00 00    	js     8002f6 <umain+0x12d>
+		die("Failed to listen on server socket");
+	cprintf("bulksend: listening\n");
+  800249:	83 ec 0c             	sub    $0xc,%esp
+  80024c:	68 8b 40 80 00       	push   $0x80408b
+  800251:	e8 eb 01 00 00       	call   800441 <cprintf>
+  800256:	83 c4 10             	add    $0x10,%esp
+
+	for (i = 0; i < CHUNK; i++)
+  800259:	b9 00 00 00 00       	mov    $0x0,%ecx
+		buf[i] = 'a' + i % 26;
+  80025e:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+  800263:	89 c8                	mov    %ecx,%eax
+  800265:	f7 ee                	imul   %esi
+  800267:	c1 fa 03             	sar    $0x3,%edx
+  80026a:	89 c8                	mov    %ecx,%eax
+  80026c:	c1 f8 1f             	sar    $0x1f,%eax
+  80026f:	29 c2                	sub    %eax,%edx
+  800271:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  800274:	89 c8                	mov    %ecx,%eax
+  800276:	29 d0                	sub    %edx,%eax
+  800278:	83 c0 61             	add    $0x61,%eax
+  80027b:	88 81 00 60 80 00    	mov    %al,0x806000(%ecx)
+	for (i = 0; i < CHUNK; i++)
+  800281:	83 c1 01             	add    $0x1,%ecx
+  800284:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+  80028a:	75 d7                	jne    800263 <umain+0x9a>
+
+	// Once with checksums and segmentation done in software, then
+	// once with the card doing them.
+	nsipc_offload(0);
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	6a 00                	push   $0x0
+  800291:	e8 b7 2a 00 00       	call   802d4d <nsipc_offload>
+	run(serversock, "off");
+  800296:	ba a0 40 80 00       	mov    $0x8040a0,%edx
+  80029b:	89 d8                	mov    %ebx,%eax
+  80029d:	e8 ae fd ff ff       	call   800050 <run>
+	nsipc_offload(NETOFF_ALL);
+  8002a2:	c7 04 24 0f 00 00 00 	movl   $0xf,(%esp)
+  8002a9:	e8 9f 2a 00 00       	call   802d4d <nsipc_offload>
+	run(serversock, "on");
+  8002ae:	ba a4 40 80 00       	mov    $0x8040a4,%edx
+  8002b3:	89 d8                	mov    %ebx,%eax
+  8002b5:	e8 96 fd ff ff       	call   800050 <run>
+	cprintf("bulksend: done\n");
+  8002ba:	c7 04 24 a7 40 80 00 	movl   $0x8040a7,(%esp)
+  8002c1:	e8 7b 01 00 00       	call   800441 <cprintf>
+	close(serversock);
+  8002c6:	89 1c 24             	mov    %ebx,(%esp)
+  8002c9:	e8 bd 12 00 00       	call   80158b <close>
+}
+  8002ce:	83 c4 10             	add    $0x10,%esp
+  8002d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002d4:	5b                   	pop    %ebx
+  8002d5:	5e                   	pop    %esi
+  8002d6:	5d                   	pop    %ebp
+  8002d7:	c3                   	ret
+		die("Failed to create socket");
+  8002d8:	b8 73 40 80 00       	mov    $0x804073,%eax
+  8002dd:	e8 53 fd ff ff       	call   800035 <die>
+  8002e2:	e9 02 ff ff ff       	jmp    8001e9 <umain+0x20>
+		die("Failed to bind the server socket");
+  8002e7:	b8 88 41 80 00       	mov    $0x804188,%eax
+  8002ec:	e8 44 fd ff ff       	call   800035 <die>
+  8002f1:	e9 3d ff ff ff       	jmp    800233 <umain+0x6a>
+		die("Failed to listen on server socket");
+  8002f6:	b8 ac 41 80 00       	mov    $0x8041ac,%eax
+  8002fb:	e8 35 fd ff ff       	call   800035 <die>
+  800300:	e9 44 ff ff ff       	jmp    800249 <umain+0x80>
+
+00800305 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	56                   	push   %esi
+  800309:	53                   	push   %ebx
+  80030a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80030d:	8b 75 0c             	mov    0xc(%ebp),%esi
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800310:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800312:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800317:	29 d0                	sub    %edx,%eax
+  800319:	89 c2                	mov    %eax,%edx
+  80031b:	c1 ea 0f             	shr    $0xf,%edx
+  80031e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800323:	b8 00 00 00 00       	mov    $0x0,%eax
+  800328:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80032b:	c7 04 85 60 67 80 00 	movl   $0x0,0x806760(,%eax,4)
+  800332:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800336:	e8 f3 0b 00 00       	call   800f2e <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80033b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800340:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800346:	89 e1                	mov    %esp,%ecx
+  800348:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80034d:	29 ca                	sub    %ecx,%edx
+  80034f:	89 d1                	mov    %edx,%ecx
+  800351:	c1 e9 0f             	shr    $0xf,%ecx
+  800354:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80035a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80035f:	0f 42 d1             	cmovb  %ecx,%edx
+  800362:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800367:	89 04 95 60 67 80 00 	mov    %eax,0x806760(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80036e:	85 db                	test   %ebx,%ebx
+  800370:	7e 07                	jle    800379 <libmain+0x74>
+		binaryname = argv[0];
+  800372:	8b 06                	mov    (%esi),%eax
+  800374:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800379:	83 ec 08             	sub    $0x8,%esp
+  80037c:	56                   	push   %esi
+  80037d:	53                   	push   %ebx
+  80037e:	e8 46 fe ff ff       	call   8001c9 <umain>
+
+	// exit gracefully
+	exit();
+  800383:	e8 0a 00 00 00       	call   800392 <exit>
+}
+  800388:	83 c4 10             	add    $0x10,%esp
+  80038b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80038e:	5b                   	pop    %ebx
+  80038f:	5e                   	pop    %esi
+  800390:	5d                   	pop    %ebp
+  800391:	c3                   	ret
+
+00800392 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800392:	55                   	push   %ebp
+  800393:	89 e5                	mov    %esp,%ebp
+  800395:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800398:	e8 1b 12 00 00       	call   8015b8 <close_all>
+	sys_env_destroy(0);
+  80039d:	83 ec 0c             	sub    $0xc,%esp
+  8003a0:	6a 00                	push   $0x0
+  8003a2:	e8 46 0b 00 00       	call   800eed <sys_env_destroy>
+}
+  8003a7:	83 c4 10             	add    $0x10,%esp
+  8003aa:	c9                   	leave
+  8003ab:	c3                   	ret
+
+008003ac <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003ac:	55                   	push   %ebp
+  8003ad:	89 e5                	mov    %esp,%ebp
+  8003af:	53                   	push   %ebx
+  8003b0:	83 ec 04             	sub    $0x4,%esp
+  8003b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003b6:	8b 13                	mov    (%ebx),%edx
+  8003b8:	8d 42 01             	lea    0x1(%edx),%eax
+  8003bb:	89 03                	mov    %eax,(%ebx)
+  8003bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003c0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003c4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003c9:	74 09                	je     8003d4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003cb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003d2:	c9                   	leave
+  8003d3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003d4:	83 ec 08             	sub    $0x8,%esp
+  8003d7:	68 ff 00 00 00       	push   $0xff
+  8003dc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003df:	50                   	push   %eax
+  8003e0:	e8 cb 0a 00 00       	call   800eb0 <sys_cputs>
+		b->idx = 0;
+  8003e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003eb:	83 c4 10             	add    $0x10,%esp
+  8003ee:	eb db                	jmp    8003cb <putch+0x1f>
+
+008003f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003f0:	55                   	push   %ebp
+  8003f1:	89 e5                	mov    %esp,%ebp
+  8003f3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003f9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800400:	00 00 00 
+	b.cnt = 0;
+  800403:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80040a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80040d:	ff 75 0c             	push   0xc(%ebp)
+  800410:	ff 75 08             	push   0x8(%ebp)
+  800413:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800419:	50                   	push   %eax
+  80041a:	68 ac 03 80 00       	push   $0x8003ac
+  80041f:	e8 1c 01 00 00       	call   800540 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800424:	83 c4 08             	add    $0x8,%esp
+  800427:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80042d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800433:	50                   	push   %eax
+  800434:	e8 77 0a 00 00       	call   800eb0 <sys_cputs>
+
+	return b.cnt;
+}
+  800439:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80043f:	c9                   	leave
+  800440:	c3                   	ret
+
+00800441 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800441:	55                   	push   %ebp
+  800442:	89 e5                	mov    %esp,%ebp
+  800444:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800447:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80044a:	50                   	push   %eax
+  80044b:	ff 75 08             	push   0x8(%ebp)
+  80044e:	e8 9d ff ff ff       	call   8003f0 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800453:	c9                   	leave
+  800454:	c3                   	ret
+
+00800455 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800455:	55                   	push   %ebp
+  800456:	89 e5                	mov    %esp,%ebp
+  800458:	57                   	push   %edi
+  800459:	56                   	push   %esi
+  80045a:	53                   	push   %ebx
+  80045b:	83 ec 1c             	sub    $0x1c,%esp
+  80045e:	89 c3                	mov    %eax,%ebx
+  800460:	89 d6                	mov    %edx,%esi
+  800462:	8b 45 08             	mov    0x8(%ebp),%eax
+  800465:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800468:	89 d1                	mov    %edx,%ecx
+  80046a:	89 c2                	mov    %eax,%edx
+  80046c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80046f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800472:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800475:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800478:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80047f:	39 c2                	cmp    %eax,%edx
+  800481:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800484:	73 4b                	jae    8004d1 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800486:	8b 45 14             	mov    0x14(%ebp),%eax
+  800489:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80048c:	85 ff                	test   %edi,%edi
+  80048e:	7e 11                	jle    8004a1 <printnum+0x4c>
+			putch(padc, putdat);
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	56                   	push   %esi
+  800494:	ff 75 18             	push   0x18(%ebp)
+  800497:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800499:	83 c4 10             	add    $0x10,%esp
+  80049c:	83 ef 01             	sub    $0x1,%edi
+  80049f:	75 ef                	jne    800490 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+  8004a4:	56                   	push   %esi
+  8004a5:	83 ec 04             	sub    $0x4,%esp
+  8004a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ab:	ff 75 e0             	push   -0x20(%ebp)
+  8004ae:	ff 75 dc             	push   -0x24(%ebp)
+  8004b1:	ff 75 d8             	push   -0x28(%ebp)
+  8004b4:	e8 95 3a 00 00       	call   803f4e <__umoddi3>
+  8004b9:	83 c4 14             	add    $0x14,%esp
+  8004bc:	0f be 80 d8 41 80 00 	movsbl 0x8041d8(%eax),%eax
+  8004c3:	50                   	push   %eax
+  8004c4:	ff d3                	call   *%ebx
+}
+  8004c6:	83 c4 10             	add    $0x10,%esp
+  8004c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004cc:	5b                   	pop    %ebx
+  8004cd:	5e                   	pop    %esi
+  8004ce:	5f                   	pop    %edi
+  8004cf:	5d                   	pop    %ebp
+  8004d0:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004d1:	83 ec 0c             	sub    $0xc,%esp
+  8004d4:	ff 75 18             	push   0x18(%ebp)
+  8004d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004da:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004dd:	52                   	push   %edx
+  8004de:	50                   	push   %eax
+  8004df:	83 ec 08             	sub    $0x8,%esp
+  8004e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8004e5:	ff 75 e0             	push   -0x20(%ebp)
+  8004e8:	ff 75 dc             	push   -0x24(%ebp)
+  8004eb:	ff 75 d8             	push   -0x28(%ebp)
+  8004ee:	e8 95 39 00 00       	call   803e88 <__udivdi3>
+  8004f3:	83 c4 18             	add    $0x18,%esp
+  8004f6:	52                   	push   %edx
+  8004f7:	50                   	push   %eax
+  8004f8:	89 f2                	mov    %esi,%edx
+  8004fa:	89 d8                	mov    %ebx,%eax
+  8004fc:	e8 54 ff ff ff       	call   800455 <printnum>
+  800501:	83 c4 20             	add    $0x20,%esp
+  800504:	eb 9b                	jmp    8004a1 <printnum+0x4c>
+
+00800506 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80050c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800510:	8b 10                	mov    (%eax),%edx
+  800512:	3b 50 04             	cmp    0x4(%eax),%edx
+  800515:	73 0a                	jae    800521 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800517:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80051a:	89 08                	mov    %ecx,(%eax)
+  80051c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80051f:	88 02                	mov    %al,(%edx)
+}
+  800521:	5d                   	pop    %ebp
+  800522:	c3                   	ret
+
+00800523 <printfmt>:
+{
+  800523:	55                   	push   %ebp
+  800524:	89 e5                	mov    %esp,%ebp
+  800526:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800529:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80052c:	50                   	push   %eax
+  80052d:	ff 75 10             	push   0x10(%ebp)
+  800530:	ff 75 0c             	push   0xc(%ebp)
+  800533:	ff 75 08             	push   0x8(%ebp)
+  800536:	e8 05 00 00 00       	call   800540 <vprintfmt>
+}
+  80053b:	83 c4 10             	add    $0x10,%esp
+  80053e:	c9                   	leave
+  80053f:	c3                   	ret
+
+00800540 <vprintfmt>:
+{
+  800540:	55                   	push   %ebp
+  800541:	89 e5                	mov    %esp,%ebp
+  800543:	57                   	push   %edi
+  800544:	56                   	push   %esi
+  800545:	53                   	push   %ebx
+  800546:	83 ec 2c             	sub    $0x2c,%esp
+  800549:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80054c:	89 df                	mov    %ebx,%edi
+  80054e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800551:	8b 45 10             	mov    0x10(%ebp),%eax
+  800554:	8d 70 01             	lea    0x1(%eax),%esi
+  800557:	0f b6 00             	movzbl (%eax),%eax
+  80055a:	83 f8 25             	cmp    $0x25,%eax
+  80055d:	74 1e                	je     80057d <vprintfmt+0x3d>
+			if (ch == '\0')
+  80055f:	85 c0                	test   %eax,%eax
+  800561:	0f 84 15 05 00 00    	je     800a7c <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800567:	83 ec 08             	sub    $0x8,%esp
+  80056a:	53                   	push   %ebx
+  80056b:	50                   	push   %eax
+  80056c:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80056e:	83 c6 01             	add    $0x1,%esi
+  800571:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800575:	83 c4 10             	add    $0x10,%esp
+  800578:	83 f8 25             	cmp    $0x25,%eax
+  80057b:	75 e2                	jne    80055f <vprintfmt+0x1f>
+		padc = ' ';
+  80057d:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800581:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800588:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80058f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800596:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80059e:	8d 56 01             	lea    0x1(%esi),%edx
+  8005a1:	0f b6 0e             	movzbl (%esi),%ecx
+  8005a4:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005a7:	3c 55                	cmp    $0x55,%al
+  8005a9:	0f 87 3b 04 00 00    	ja     8009ea <vprintfmt+0x4aa>
+  8005af:	0f b6 c0             	movzbl %al,%eax
+  8005b2:	ff 24 85 40 43 80 00 	jmp    *0x804340(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8005b9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005bc:	eb 93                	jmp    800551 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005be:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8005c0:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005c4:	eb d8                	jmp    80059e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c6:	89 d6                	mov    %edx,%esi
+  8005c8:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005cc:	eb d0                	jmp    80059e <vprintfmt+0x5e>
+  8005ce:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8005d1:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8005d7:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8005db:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005de:	83 f9 09             	cmp    $0x9,%ecx
+  8005e1:	77 6f                	ja     800652 <vprintfmt+0x112>
+  8005e3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8005e6:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8005e9:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8005ec:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8005f0:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8005f3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005f6:	83 fe 09             	cmp    $0x9,%esi
+  8005f9:	76 eb                	jbe    8005e6 <vprintfmt+0xa6>
+  8005fb:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8005fe:	89 d6                	mov    %edx,%esi
+  800600:	eb 13                	jmp    800615 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800602:	8b 45 14             	mov    0x14(%ebp),%eax
+  800605:	8b 00                	mov    (%eax),%eax
+  800607:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8d 40 04             	lea    0x4(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800613:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800615:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800619:	79 83                	jns    80059e <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80061b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80061e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800621:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800628:	e9 71 ff ff ff       	jmp    80059e <vprintfmt+0x5e>
+			if (width < 0)
+  80062d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800630:	85 c9                	test   %ecx,%ecx
+  800632:	b8 00 00 00 00       	mov    $0x0,%eax
+  800637:	0f 49 c1             	cmovns %ecx,%eax
+  80063a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80063d:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80063f:	e9 5a ff ff ff       	jmp    80059e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800644:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800646:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80064d:	e9 4c ff ff ff       	jmp    80059e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800652:	89 d6                	mov    %edx,%esi
+  800654:	eb bf                	jmp    800615 <vprintfmt+0xd5>
+			lflag++;
+  800656:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80065a:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80065c:	e9 3d ff ff ff       	jmp    80059e <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800661:	89 55 10             	mov    %edx,0x10(%ebp)
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8d 70 04             	lea    0x4(%eax),%esi
+  80066a:	83 ec 08             	sub    $0x8,%esp
+  80066d:	53                   	push   %ebx
+  80066e:	ff 30                	push   (%eax)
+  800670:	ff d7                	call   *%edi
+			break;
+  800672:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800675:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800678:	e9 d4 fe ff ff       	jmp    800551 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80067d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800686:	8b 10                	mov    (%eax),%edx
+  800688:	89 d0                	mov    %edx,%eax
+  80068a:	f7 d8                	neg    %eax
+  80068c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80068f:	83 f8 12             	cmp    $0x12,%eax
+  800692:	7f 23                	jg     8006b7 <vprintfmt+0x177>
+  800694:	8b 14 85 a0 44 80 00 	mov    0x8044a0(,%eax,4),%edx
+  80069b:	85 d2                	test   %edx,%edx
+  80069d:	74 18                	je     8006b7 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80069f:	52                   	push   %edx
+  8006a0:	68 fb 45 80 00       	push   $0x8045fb
+  8006a5:	53                   	push   %ebx
+  8006a6:	57                   	push   %edi
+  8006a7:	e8 77 fe ff ff       	call   800523 <printfmt>
+  8006ac:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006af:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006b2:	e9 9a fe ff ff       	jmp    800551 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8006b7:	50                   	push   %eax
+  8006b8:	68 f0 41 80 00       	push   $0x8041f0
+  8006bd:	53                   	push   %ebx
+  8006be:	57                   	push   %edi
+  8006bf:	e8 5f fe ff ff       	call   800523 <printfmt>
+  8006c4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006c7:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006ca:	e9 82 fe ff ff       	jmp    800551 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006cf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d5:	83 c0 04             	add    $0x4,%eax
+  8006d8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 00                	mov    (%eax),%eax
+  8006e0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006e3:	85 c0                	test   %eax,%eax
+  8006e5:	0f 84 61 03 00 00    	je     800a4c <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8006eb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006ef:	7e 06                	jle    8006f7 <vprintfmt+0x1b7>
+  8006f1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8006f5:	75 29                	jne    800720 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006f7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006fa:	8d 70 01             	lea    0x1(%eax),%esi
+  8006fd:	0f b6 00             	movzbl (%eax),%eax
+  800700:	0f be d0             	movsbl %al,%edx
+  800703:	85 d2                	test   %edx,%edx
+  800705:	0f 84 bb 00 00 00    	je     8007c6 <vprintfmt+0x286>
+  80070b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80070e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800711:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800714:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800717:	eb 7a                	jmp    800793 <vprintfmt+0x253>
+				p = "(null)";
+  800719:	c7 45 d0 e9 41 80 00 	movl   $0x8041e9,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800720:	83 ec 08             	sub    $0x8,%esp
+  800723:	ff 75 d4             	push   -0x2c(%ebp)
+  800726:	ff 75 d0             	push   -0x30(%ebp)
+  800729:	e8 e0 03 00 00       	call   800b0e <strnlen>
+  80072e:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800731:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800734:	83 c4 10             	add    $0x10,%esp
+  800737:	85 d2                	test   %edx,%edx
+  800739:	0f 8e d6 02 00 00    	jle    800a15 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80073f:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800743:	83 ec 08             	sub    $0x8,%esp
+  800746:	53                   	push   %ebx
+  800747:	56                   	push   %esi
+  800748:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80074a:	83 c4 10             	add    $0x10,%esp
+  80074d:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800751:	75 f0                	jne    800743 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800753:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800756:	8d 70 01             	lea    0x1(%eax),%esi
+  800759:	0f b6 00             	movzbl (%eax),%eax
+  80075c:	0f be d0             	movsbl %al,%edx
+  80075f:	85 d2                	test   %edx,%edx
+  800761:	0f 84 da 02 00 00    	je     800a41 <vprintfmt+0x501>
+  800767:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80076a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80076d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800770:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800773:	eb 1e                	jmp    800793 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800775:	83 ec 08             	sub    $0x8,%esp
+  800778:	ff 75 0c             	push   0xc(%ebp)
+  80077b:	52                   	push   %edx
+  80077c:	ff 55 08             	call   *0x8(%ebp)
+  80077f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800782:	83 eb 01             	sub    $0x1,%ebx
+  800785:	83 c6 01             	add    $0x1,%esi
+  800788:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80078c:	0f be d0             	movsbl %al,%edx
+  80078f:	85 d2                	test   %edx,%edx
+  800791:	74 2a                	je     8007bd <vprintfmt+0x27d>
+  800793:	85 ff                	test   %edi,%edi
+  800795:	78 05                	js     80079c <vprintfmt+0x25c>
+  800797:	83 ef 01             	sub    $0x1,%edi
+  80079a:	78 59                	js     8007f5 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80079c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007a0:	74 d3                	je     800775 <vprintfmt+0x235>
+  8007a2:	0f be c0             	movsbl %al,%eax
+  8007a5:	83 e8 20             	sub    $0x20,%eax
+  8007a8:	83 f8 5e             	cmp    $0x5e,%eax
+  8007ab:	76 c8                	jbe    800775 <vprintfmt+0x235>
+					putch('?', putdat);
+  8007ad:	83 ec 08             	sub    $0x8,%esp
+  8007b0:	ff 75 0c             	push   0xc(%ebp)
+  8007b3:	6a 3f                	push   $0x3f
+  8007b5:	ff 55 08             	call   *0x8(%ebp)
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	eb c5                	jmp    800782 <vprintfmt+0x242>
+  8007bd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8007c6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007c9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007cd:	7e 1b                	jle    8007ea <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8007cf:	83 ec 08             	sub    $0x8,%esp
+  8007d2:	53                   	push   %ebx
+  8007d3:	6a 20                	push   $0x20
+  8007d5:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007d7:	83 c4 10             	add    $0x10,%esp
+  8007da:	83 ee 01             	sub    $0x1,%esi
+  8007dd:	75 f0                	jne    8007cf <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007df:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e5:	e9 67 fd ff ff       	jmp    800551 <vprintfmt+0x11>
+  8007ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f0:	e9 5c fd ff ff       	jmp    800551 <vprintfmt+0x11>
+  8007f5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007fe:	eb c6                	jmp    8007c6 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800800:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800803:	89 55 10             	mov    %edx,0x10(%ebp)
+  800806:	83 f9 01             	cmp    $0x1,%ecx
+  800809:	7f 1f                	jg     80082a <vprintfmt+0x2ea>
+	else if (lflag)
+  80080b:	85 c9                	test   %ecx,%ecx
+  80080d:	74 67                	je     800876 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8b 30                	mov    (%eax),%esi
+  800814:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800817:	89 f0                	mov    %esi,%eax
+  800819:	c1 f8 1f             	sar    $0x1f,%eax
+  80081c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80081f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800822:	8d 40 04             	lea    0x4(%eax),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+  800828:	eb 17                	jmp    800841 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80082a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082d:	8b 50 04             	mov    0x4(%eax),%edx
+  800830:	8b 00                	mov    (%eax),%eax
+  800832:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800835:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8d 40 08             	lea    0x8(%eax),%eax
+  80083e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800841:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800844:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800847:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80084c:	85 c9                	test   %ecx,%ecx
+  80084e:	0f 89 12 01 00 00    	jns    800966 <vprintfmt+0x426>
+				putch('-', putdat);
+  800854:	83 ec 08             	sub    $0x8,%esp
+  800857:	53                   	push   %ebx
+  800858:	6a 2d                	push   $0x2d
+  80085a:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80085c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80085f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800862:	f7 da                	neg    %edx
+  800864:	83 d1 00             	adc    $0x0,%ecx
+  800867:	f7 d9                	neg    %ecx
+  800869:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80086c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800871:	e9 f0 00 00 00       	jmp    800966 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800876:	8b 45 14             	mov    0x14(%ebp),%eax
+  800879:	8b 30                	mov    (%eax),%esi
+  80087b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80087e:	89 f0                	mov    %esi,%eax
+  800880:	c1 f8 1f             	sar    $0x1f,%eax
+  800883:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800886:	8b 45 14             	mov    0x14(%ebp),%eax
+  800889:	8d 40 04             	lea    0x4(%eax),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088f:	eb b0                	jmp    800841 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800891:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800894:	89 55 10             	mov    %edx,0x10(%ebp)
+  800897:	83 f9 01             	cmp    $0x1,%ecx
+  80089a:	7f 1e                	jg     8008ba <vprintfmt+0x37a>
+	else if (lflag)
+  80089c:	85 c9                	test   %ecx,%ecx
+  80089e:	74 32                	je     8008d2 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 10                	mov    (%eax),%edx
+  8008a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008b0:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8008b5:	e9 ac 00 00 00       	jmp    800966 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bd:	8b 10                	mov    (%eax),%edx
+  8008bf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008c2:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008c8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8008cd:	e9 94 00 00 00       	jmp    800966 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d5:	8b 10                	mov    (%eax),%edx
+  8008d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e2:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8008e7:	eb 7d                	jmp    800966 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8008e9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008ec:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008ef:	83 f9 01             	cmp    $0x1,%ecx
+  8008f2:	7f 1b                	jg     80090f <vprintfmt+0x3cf>
+	else if (lflag)
+  8008f4:	85 c9                	test   %ecx,%ecx
+  8008f6:	74 2c                	je     800924 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8008f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fb:	8b 10                	mov    (%eax),%edx
+  8008fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800902:	8d 40 04             	lea    0x4(%eax),%eax
+  800905:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800908:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80090d:	eb 57                	jmp    800966 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80090f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800912:	8b 10                	mov    (%eax),%edx
+  800914:	8b 48 04             	mov    0x4(%eax),%ecx
+  800917:	8d 40 08             	lea    0x8(%eax),%eax
+  80091a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80091d:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800922:	eb 42                	jmp    800966 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8b 10                	mov    (%eax),%edx
+  800929:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092e:	8d 40 04             	lea    0x4(%eax),%eax
+  800931:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800934:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800939:	eb 2b                	jmp    800966 <vprintfmt+0x426>
+			putch('0', putdat);
+  80093b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	53                   	push   %ebx
+  800942:	6a 30                	push   $0x30
+  800944:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800946:	83 c4 08             	add    $0x8,%esp
+  800949:	53                   	push   %ebx
+  80094a:	6a 78                	push   $0x78
+  80094c:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80094e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800951:	8b 10                	mov    (%eax),%edx
+  800953:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800958:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80095b:	8d 40 04             	lea    0x4(%eax),%eax
+  80095e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800961:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800966:	83 ec 0c             	sub    $0xc,%esp
+  800969:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80096d:	50                   	push   %eax
+  80096e:	ff 75 e4             	push   -0x1c(%ebp)
+  800971:	56                   	push   %esi
+  800972:	51                   	push   %ecx
+  800973:	52                   	push   %edx
+  800974:	89 da                	mov    %ebx,%edx
+  800976:	89 f8                	mov    %edi,%eax
+  800978:	e8 d8 fa ff ff       	call   800455 <printnum>
+			break;
+  80097d:	83 c4 20             	add    $0x20,%esp
+  800980:	e9 cc fb ff ff       	jmp    800551 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800985:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800988:	89 55 10             	mov    %edx,0x10(%ebp)
+  80098b:	83 f9 01             	cmp    $0x1,%ecx
+  80098e:	7f 1b                	jg     8009ab <vprintfmt+0x46b>
+	else if (lflag)
+  800990:	85 c9                	test   %ecx,%ecx
+  800992:	74 2c                	je     8009c0 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800994:	8b 45 14             	mov    0x14(%ebp),%eax
+  800997:	8b 10                	mov    (%eax),%edx
+  800999:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099e:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a4:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009a9:	eb bb                	jmp    800966 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ae:	8b 10                	mov    (%eax),%edx
+  8009b0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8009b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b9:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8009be:	eb a6                	jmp    800966 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c3:	8b 10                	mov    (%eax),%edx
+  8009c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009d0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8009d5:	eb 8f                	jmp    800966 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8009d7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009da:	83 ec 08             	sub    $0x8,%esp
+  8009dd:	53                   	push   %ebx
+  8009de:	6a 25                	push   $0x25
+  8009e0:	ff d7                	call   *%edi
+			break;
+  8009e2:	83 c4 10             	add    $0x10,%esp
+  8009e5:	e9 67 fb ff ff       	jmp    800551 <vprintfmt+0x11>
+			putch('%', putdat);
+  8009ea:	83 ec 08             	sub    $0x8,%esp
+  8009ed:	53                   	push   %ebx
+  8009ee:	6a 25                	push   $0x25
+  8009f0:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009f2:	83 c4 10             	add    $0x10,%esp
+  8009f5:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8009f9:	0f 84 ba fb ff ff    	je     8005b9 <vprintfmt+0x79>
+  8009ff:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a02:	89 f0                	mov    %esi,%eax
+  800a04:	83 e8 01             	sub    $0x1,%eax
+  800a07:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a0b:	75 f7                	jne    800a04 <vprintfmt+0x4c4>
+  800a0d:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a10:	e9 3c fb ff ff       	jmp    800551 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a15:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a18:	8d 70 01             	lea    0x1(%eax),%esi
+  800a1b:	0f b6 00             	movzbl (%eax),%eax
+  800a1e:	0f be d0             	movsbl %al,%edx
+  800a21:	85 d2                	test   %edx,%edx
+  800a23:	74 11                	je     800a36 <vprintfmt+0x4f6>
+  800a25:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a28:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a2b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a2e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a31:	e9 5d fd ff ff       	jmp    800793 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a36:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a39:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a3c:	e9 10 fb ff ff       	jmp    800551 <vprintfmt+0x11>
+  800a41:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a44:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a47:	e9 05 fb ff ff       	jmp    800551 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a4c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a50:	7e 0a                	jle    800a5c <vprintfmt+0x51c>
+  800a52:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a56:	0f 85 bd fc ff ff    	jne    800719 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a5c:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a61:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a66:	be ea 41 80 00       	mov    $0x8041ea,%esi
+  800a6b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a6e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a71:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a74:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a77:	e9 17 fd ff ff       	jmp    800793 <vprintfmt+0x253>
+}
+  800a7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a7f:	5b                   	pop    %ebx
+  800a80:	5e                   	pop    %esi
+  800a81:	5f                   	pop    %edi
+  800a82:	5d                   	pop    %ebp
+  800a83:	c3                   	ret
+
+00800a84 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a84:	55                   	push   %ebp
+  800a85:	89 e5                	mov    %esp,%ebp
+  800a87:	83 ec 18             	sub    $0x18,%esp
+  800a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a90:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a93:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a97:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a9a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800aa1:	85 c0                	test   %eax,%eax
+  800aa3:	74 26                	je     800acb <vsnprintf+0x47>
+  800aa5:	85 d2                	test   %edx,%edx
+  800aa7:	7e 22                	jle    800acb <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800aa9:	ff 75 14             	push   0x14(%ebp)
+  800aac:	ff 75 10             	push   0x10(%ebp)
+  800aaf:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ab2:	50                   	push   %eax
+  800ab3:	68 06 05 80 00       	push   $0x800506
+  800ab8:	e8 83 fa ff ff       	call   800540 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800abd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ac0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac6:	83 c4 10             	add    $0x10,%esp
+}
+  800ac9:	c9                   	leave
+  800aca:	c3                   	ret
+		return -E_INVAL;
+  800acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad0:	eb f7                	jmp    800ac9 <vsnprintf+0x45>
+
+00800ad2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ad8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800adb:	50                   	push   %eax
+  800adc:	ff 75 10             	push   0x10(%ebp)
+  800adf:	ff 75 0c             	push   0xc(%ebp)
+  800ae2:	ff 75 08             	push   0x8(%ebp)
+  800ae5:	e8 9a ff ff ff       	call   800a84 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+
+00800aec <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800af2:	80 3a 00             	cmpb   $0x0,(%edx)
+  800af5:	74 10                	je     800b07 <strlen+0x1b>
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800afc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800aff:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b03:	75 f7                	jne    800afc <strlen+0x10>
+	return n;
+}
+  800b05:	5d                   	pop    %ebp
+  800b06:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b07:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b0c:	eb f7                	jmp    800b05 <strlen+0x19>
+
+00800b0e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b14:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b17:	85 d2                	test   %edx,%edx
+  800b19:	74 16                	je     800b31 <strnlen+0x23>
+  800b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b20:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b24:	74 09                	je     800b2f <strnlen+0x21>
+		n++;
+  800b26:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b29:	39 d0                	cmp    %edx,%eax
+  800b2b:	75 f3                	jne    800b20 <strnlen+0x12>
+		n++;
+  800b2d:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b36:	eb f7                	jmp    800b2f <strnlen+0x21>
+
+00800b38 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	53                   	push   %ebx
+  800b3c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b3f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b47:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b4b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b4e:	83 c0 01             	add    $0x1,%eax
+  800b51:	84 d2                	test   %dl,%dl
+  800b53:	75 f2                	jne    800b47 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b55:	89 c8                	mov    %ecx,%eax
+  800b57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b5a:	c9                   	leave
+  800b5b:	c3                   	ret
+
+00800b5c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	53                   	push   %ebx
+  800b60:	83 ec 10             	sub    $0x10,%esp
+  800b63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b66:	53                   	push   %ebx
+  800b67:	e8 80 ff ff ff       	call   800aec <strlen>
+  800b6c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b6f:	ff 75 0c             	push   0xc(%ebp)
+  800b72:	01 d8                	add    %ebx,%eax
+  800b74:	50                   	push   %eax
+  800b75:	e8 be ff ff ff       	call   800b38 <strcpy>
+	return dst;
+}
+  800b7a:	89 d8                	mov    %ebx,%eax
+  800b7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b7f:	c9                   	leave
+  800b80:	c3                   	ret
+
+00800b81 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b8f:	85 db                	test   %ebx,%ebx
+  800b91:	74 17                	je     800baa <strncpy+0x29>
+  800b93:	01 f3                	add    %esi,%ebx
+  800b95:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800b97:	83 c0 01             	add    $0x1,%eax
+  800b9a:	0f b6 0a             	movzbl (%edx),%ecx
+  800b9d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ba0:	80 f9 01             	cmp    $0x1,%cl
+  800ba3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ba6:	39 c3                	cmp    %eax,%ebx
+  800ba8:	75 ed                	jne    800b97 <strncpy+0x16>
+	}
+	return ret;
+}
+  800baa:	89 f0                	mov    %esi,%eax
+  800bac:	5b                   	pop    %ebx
+  800bad:	5e                   	pop    %esi
+  800bae:	5d                   	pop    %ebp
+  800baf:	c3                   	ret
+
+00800bb0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  800bb5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bbe:	89 f0                	mov    %esi,%eax
+  800bc0:	85 db                	test   %ebx,%ebx
+  800bc2:	74 1e                	je     800be2 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800bc4:	83 eb 01             	sub    $0x1,%ebx
+  800bc7:	74 16                	je     800bdf <strlcpy+0x2f>
+  800bc9:	01 f3                	add    %esi,%ebx
+  800bcb:	0f b6 0a             	movzbl (%edx),%ecx
+  800bce:	84 c9                	test   %cl,%cl
+  800bd0:	74 0d                	je     800bdf <strlcpy+0x2f>
+			*dst++ = *src++;
+  800bd2:	83 c2 01             	add    $0x1,%edx
+  800bd5:	83 c0 01             	add    $0x1,%eax
+  800bd8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800bdb:	39 d8                	cmp    %ebx,%eax
+  800bdd:	75 ec                	jne    800bcb <strlcpy+0x1b>
+		*dst = '\0';
+  800bdf:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800be2:	29 f0                	sub    %esi,%eax
+}
+  800be4:	5b                   	pop    %ebx
+  800be5:	5e                   	pop    %esi
+  800be6:	5d                   	pop    %ebp
+  800be7:	c3                   	ret
+
+00800be8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bee:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800bf1:	0f b6 01             	movzbl (%ecx),%eax
+  800bf4:	84 c0                	test   %al,%al
+  800bf6:	74 11                	je     800c09 <strcmp+0x21>
+  800bf8:	38 02                	cmp    %al,(%edx)
+  800bfa:	75 0d                	jne    800c09 <strcmp+0x21>
+		p++, q++;
+  800bfc:	83 c1 01             	add    $0x1,%ecx
+  800bff:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c02:	0f b6 01             	movzbl (%ecx),%eax
+  800c05:	84 c0                	test   %al,%al
+  800c07:	75 ef                	jne    800bf8 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c09:	0f b6 c0             	movzbl %al,%eax
+  800c0c:	0f b6 12             	movzbl (%edx),%edx
+  800c0f:	29 d0                	sub    %edx,%eax
+}
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+
+00800c13 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	53                   	push   %ebx
+  800c17:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c1a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c1d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c25:	85 d2                	test   %edx,%edx
+  800c27:	74 2e                	je     800c57 <strncmp+0x44>
+  800c29:	0f b6 01             	movzbl (%ecx),%eax
+  800c2c:	84 c0                	test   %al,%al
+  800c2e:	74 16                	je     800c46 <strncmp+0x33>
+  800c30:	3a 03                	cmp    (%ebx),%al
+  800c32:	75 12                	jne    800c46 <strncmp+0x33>
+		n--, p++, q++;
+  800c34:	83 c1 01             	add    $0x1,%ecx
+  800c37:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800c3a:	83 ea 01             	sub    $0x1,%edx
+  800c3d:	75 ea                	jne    800c29 <strncmp+0x16>
+		return 0;
+  800c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c44:	eb 11                	jmp    800c57 <strncmp+0x44>
+  800c46:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800c4b:	85 d2                	test   %edx,%edx
+  800c4d:	74 08                	je     800c57 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c4f:	0f b6 01             	movzbl (%ecx),%eax
+  800c52:	0f b6 13             	movzbl (%ebx),%edx
+  800c55:	29 d0                	sub    %edx,%eax
+}
+  800c57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c5a:	c9                   	leave
+  800c5b:	c3                   	ret
+
+00800c5c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c62:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c66:	0f b6 10             	movzbl (%eax),%edx
+  800c69:	84 d2                	test   %dl,%dl
+  800c6b:	74 15                	je     800c82 <strchr+0x26>
+		if (*s == c)
+  800c6d:	38 d1                	cmp    %dl,%cl
+  800c6f:	74 0f                	je     800c80 <strchr+0x24>
+	for (; *s; s++)
+  800c71:	83 c0 01             	add    $0x1,%eax
+  800c74:	0f b6 10             	movzbl (%eax),%edx
+  800c77:	84 d2                	test   %dl,%dl
+  800c79:	75 f2                	jne    800c6d <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+	return 0;
+  800c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c87:	eb f7                	jmp    800c80 <strchr+0x24>
+
+00800c89 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	53                   	push   %ebx
+  800c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c90:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800c93:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800c96:	38 d3                	cmp    %dl,%bl
+  800c98:	74 14                	je     800cae <strfind+0x25>
+  800c9a:	89 d1                	mov    %edx,%ecx
+  800c9c:	84 db                	test   %bl,%bl
+  800c9e:	74 0e                	je     800cae <strfind+0x25>
+	for (; *s; s++)
+  800ca0:	83 c0 01             	add    $0x1,%eax
+  800ca3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ca6:	38 ca                	cmp    %cl,%dl
+  800ca8:	74 04                	je     800cae <strfind+0x25>
+  800caa:	84 d2                	test   %dl,%dl
+  800cac:	75 f2                	jne    800ca0 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800cae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cb1:	c9                   	leave
+  800cb2:	c3                   	ret
+
+00800cb3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	57                   	push   %edi
+  800cb7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cbd:	85 c9                	test   %ecx,%ecx
+  800cbf:	74 20                	je     800ce1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cc1:	89 f8                	mov    %edi,%eax
+  800cc3:	09 c8                	or     %ecx,%eax
+  800cc5:	a8 03                	test   $0x3,%al
+  800cc7:	75 12                	jne    800cdb <memset+0x28>
+		c &= 0xFF;
+  800cc9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ccd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cd3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cd6:	fc                   	cld
+  800cd7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cd9:	eb 06                	jmp    800ce1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cde:	fc                   	cld
+  800cdf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ce1:	89 f8                	mov    %edi,%eax
+  800ce3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ce6:	c9                   	leave
+  800ce7:	c3                   	ret
+
+00800ce8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ce8:	55                   	push   %ebp
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	57                   	push   %edi
+  800cec:	56                   	push   %esi
+  800ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cf3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cf6:	39 c6                	cmp    %eax,%esi
+  800cf8:	73 32                	jae    800d2c <memmove+0x44>
+  800cfa:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800cfd:	39 d0                	cmp    %edx,%eax
+  800cff:	73 2b                	jae    800d2c <memmove+0x44>
+		s += n;
+		d += n;
+  800d01:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d04:	89 d6                	mov    %edx,%esi
+  800d06:	09 fe                	or     %edi,%esi
+  800d08:	09 ce                	or     %ecx,%esi
+  800d0a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d10:	75 0e                	jne    800d20 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d12:	83 ef 04             	sub    $0x4,%edi
+  800d15:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d18:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d1b:	fd                   	std
+  800d1c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d1e:	eb 09                	jmp    800d29 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d20:	83 ef 01             	sub    $0x1,%edi
+  800d23:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d26:	fd                   	std
+  800d27:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d29:	fc                   	cld
+  800d2a:	eb 1a                	jmp    800d46 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d2c:	89 f2                	mov    %esi,%edx
+  800d2e:	09 c2                	or     %eax,%edx
+  800d30:	09 ca                	or     %ecx,%edx
+  800d32:	f6 c2 03             	test   $0x3,%dl
+  800d35:	75 0a                	jne    800d41 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d37:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d3a:	89 c7                	mov    %eax,%edi
+  800d3c:	fc                   	cld
+  800d3d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d3f:	eb 05                	jmp    800d46 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d41:	89 c7                	mov    %eax,%edi
+  800d43:	fc                   	cld
+  800d44:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+
+00800d4a <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d50:	ff 75 10             	push   0x10(%ebp)
+  800d53:	ff 75 0c             	push   0xc(%ebp)
+  800d56:	ff 75 08             	push   0x8(%ebp)
+  800d59:	e8 8a ff ff ff       	call   800ce8 <memmove>
+}
+  800d5e:	c9                   	leave
+  800d5f:	c3                   	ret
+
+00800d60 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	56                   	push   %esi
+  800d64:	53                   	push   %ebx
+  800d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d68:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d6b:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d6e:	85 f6                	test   %esi,%esi
+  800d70:	74 29                	je     800d9b <memcmp+0x3b>
+  800d72:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800d74:	0f b6 08             	movzbl (%eax),%ecx
+  800d77:	0f b6 1a             	movzbl (%edx),%ebx
+  800d7a:	38 d9                	cmp    %bl,%cl
+  800d7c:	75 11                	jne    800d8f <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d7e:	83 c0 01             	add    $0x1,%eax
+  800d81:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d84:	39 c6                	cmp    %eax,%esi
+  800d86:	75 ec                	jne    800d74 <memcmp+0x14>
+	}
+
+	return 0;
+  800d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8d:	eb 08                	jmp    800d97 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800d8f:	0f b6 c1             	movzbl %cl,%eax
+  800d92:	0f b6 db             	movzbl %bl,%ebx
+  800d95:	29 d8                	sub    %ebx,%eax
+}
+  800d97:	5b                   	pop    %ebx
+  800d98:	5e                   	pop    %esi
+  800d99:	5d                   	pop    %ebp
+  800d9a:	c3                   	ret
+	return 0;
+  800d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da0:	eb f5                	jmp    800d97 <memcmp+0x37>
+
+00800da2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dab:	89 c2                	mov    %eax,%edx
+  800dad:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800db0:	39 d0                	cmp    %edx,%eax
+  800db2:	73 0d                	jae    800dc1 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800db4:	38 08                	cmp    %cl,(%eax)
+  800db6:	74 0d                	je     800dc5 <memfind+0x23>
+	for (; s < ends; s++)
+  800db8:	83 c0 01             	add    $0x1,%eax
+  800dbb:	39 c2                	cmp    %eax,%edx
+  800dbd:	75 f5                	jne    800db4 <memfind+0x12>
+  800dbf:	eb 06                	jmp    800dc7 <memfind+0x25>
+  800dc1:	89 c2                	mov    %eax,%edx
+  800dc3:	eb 02                	jmp    800dc7 <memfind+0x25>
+  800dc5:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800dc7:	89 d0                	mov    %edx,%eax
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+
+00800dcb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	57                   	push   %edi
+  800dcf:	56                   	push   %esi
+  800dd0:	53                   	push   %ebx
+  800dd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800dd7:	0f b6 02             	movzbl (%edx),%eax
+  800dda:	3c 20                	cmp    $0x20,%al
+  800ddc:	74 04                	je     800de2 <strtol+0x17>
+  800dde:	3c 09                	cmp    $0x9,%al
+  800de0:	75 0e                	jne    800df0 <strtol+0x25>
+		s++;
+  800de2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800de5:	0f b6 02             	movzbl (%edx),%eax
+  800de8:	3c 20                	cmp    $0x20,%al
+  800dea:	74 f6                	je     800de2 <strtol+0x17>
+  800dec:	3c 09                	cmp    $0x9,%al
+  800dee:	74 f2                	je     800de2 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800df0:	3c 2b                	cmp    $0x2b,%al
+  800df2:	74 2a                	je     800e1e <strtol+0x53>
+	int neg = 0;
+  800df4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800df9:	3c 2d                	cmp    $0x2d,%al
+  800dfb:	74 2b                	je     800e28 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800dfd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e03:	75 0f                	jne    800e14 <strtol+0x49>
+  800e05:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e08:	74 28                	je     800e32 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e0a:	85 db                	test   %ebx,%ebx
+  800e0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e11:	0f 44 d8             	cmove  %eax,%ebx
+  800e14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e19:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e1c:	eb 46                	jmp    800e64 <strtol+0x99>
+		s++;
+  800e1e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e21:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e26:	eb d5                	jmp    800dfd <strtol+0x32>
+		s++, neg = 1;
+  800e28:	83 c2 01             	add    $0x1,%edx
+  800e2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e30:	eb cb                	jmp    800dfd <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e32:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e36:	74 0e                	je     800e46 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800e38:	85 db                	test   %ebx,%ebx
+  800e3a:	75 d8                	jne    800e14 <strtol+0x49>
+		s++, base = 8;
+  800e3c:	83 c2 01             	add    $0x1,%edx
+  800e3f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e44:	eb ce                	jmp    800e14 <strtol+0x49>
+		s += 2, base = 16;
+  800e46:	83 c2 02             	add    $0x2,%edx
+  800e49:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e4e:	eb c4                	jmp    800e14 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e50:	0f be c0             	movsbl %al,%eax
+  800e53:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e56:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e59:	7d 3a                	jge    800e95 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800e5b:	83 c2 01             	add    $0x1,%edx
+  800e5e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e62:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e64:	0f b6 02             	movzbl (%edx),%eax
+  800e67:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e6a:	89 f3                	mov    %esi,%ebx
+  800e6c:	80 fb 09             	cmp    $0x9,%bl
+  800e6f:	76 df                	jbe    800e50 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800e71:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e74:	89 f3                	mov    %esi,%ebx
+  800e76:	80 fb 19             	cmp    $0x19,%bl
+  800e79:	77 08                	ja     800e83 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800e7b:	0f be c0             	movsbl %al,%eax
+  800e7e:	83 e8 57             	sub    $0x57,%eax
+  800e81:	eb d3                	jmp    800e56 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e83:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e86:	89 f3                	mov    %esi,%ebx
+  800e88:	80 fb 19             	cmp    $0x19,%bl
+  800e8b:	77 08                	ja     800e95 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800e8d:	0f be c0             	movsbl %al,%eax
+  800e90:	83 e8 37             	sub    $0x37,%eax
+  800e93:	eb c1                	jmp    800e56 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e95:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e99:	74 05                	je     800ea0 <strtol+0xd5>
+		*endptr = (char *) s;
+  800e9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e9e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ea0:	89 c8                	mov    %ecx,%eax
+  800ea2:	f7 d8                	neg    %eax
+  800ea4:	85 ff                	test   %edi,%edi
+  800ea6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ea9:	89 c8                	mov    %ecx,%eax
+  800eab:	5b                   	pop    %ebx
+  800eac:	5e                   	pop    %esi
+  800ead:	5f                   	pop    %edi
+  800eae:	5d                   	pop    %ebp
+  800eaf:	c3                   	ret
+
+00800eb0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	56                   	push   %esi
+  800eb5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec1:	89 c3                	mov    %eax,%ebx
+  800ec3:	89 c7                	mov    %eax,%edi
+  800ec5:	89 c6                	mov    %eax,%esi
+  800ec7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+
+00800ece <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ede:	89 d1                	mov    %edx,%ecx
+  800ee0:	89 d3                	mov    %edx,%ebx
+  800ee2:	89 d7                	mov    %edx,%edi
+  800ee4:	89 d6                	mov    %edx,%esi
+  800ee6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+
+00800eed <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+  800ef3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efe:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f03:	89 cb                	mov    %ecx,%ebx
+  800f05:	89 cf                	mov    %ecx,%edi
+  800f07:	89 ce                	mov    %ecx,%esi
+  800f09:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	7f 08                	jg     800f17 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	50                   	push   %eax
+  800f1b:	6a 03                	push   $0x3
+  800f1d:	68 0b 45 80 00       	push   $0x80450b
+  800f22:	6a 23                	push   $0x23
+  800f24:	68 28 45 80 00       	push   $0x804528
+  800f29:	e8 79 28 00 00       	call   8037a7 <_panic>
+
+00800f2e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f39:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f3e:	89 d1                	mov    %edx,%ecx
+  800f40:	89 d3                	mov    %edx,%ebx
+  800f42:	89 d7                	mov    %edx,%edi
+  800f44:	89 d6                	mov    %edx,%esi
+  800f46:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f48:	5b                   	pop    %ebx
+  800f49:	5e                   	pop    %esi
+  800f4a:	5f                   	pop    %edi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	c3                   	ret
+
+00800f4d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f4d:	55                   	push   %ebp
+  800f4e:	89 e5                	mov    %esp,%ebp
+  800f50:	57                   	push   %edi
+  800f51:	56                   	push   %esi
+  800f52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f58:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f5d:	89 d1                	mov    %edx,%ecx
+  800f5f:	89 d3                	mov    %edx,%ebx
+  800f61:	89 d7                	mov    %edx,%edi
+  800f63:	89 d6                	mov    %edx,%esi
+  800f65:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+
+00800f6c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+  800f72:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f75:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f80:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f88:	89 f7                	mov    %esi,%edi
+  800f8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8c:	85 c0                	test   %eax,%eax
+  800f8e:	7f 08                	jg     800f98 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f98:	83 ec 0c             	sub    $0xc,%esp
+  800f9b:	50                   	push   %eax
+  800f9c:	6a 04                	push   $0x4
+  800f9e:	68 0b 45 80 00       	push   $0x80450b
+  800fa3:	6a 23                	push   $0x23
+  800fa5:	68 28 45 80 00       	push   $0x804528
+  800faa:	e8 f8 27 00 00       	call   8037a7 <_panic>
+
+00800faf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	57                   	push   %edi
+  800fb3:	56                   	push   %esi
+  800fb4:	53                   	push   %ebx
+  800fb5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fcc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fce:	85 c0                	test   %eax,%eax
+  800fd0:	7f 08                	jg     800fda <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd5:	5b                   	pop    %ebx
+  800fd6:	5e                   	pop    %esi
+  800fd7:	5f                   	pop    %edi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	50                   	push   %eax
+  800fde:	6a 05                	push   $0x5
+  800fe0:	68 0b 45 80 00       	push   $0x80450b
+  800fe5:	6a 23                	push   $0x23
+  800fe7:	68 28 45 80 00       	push   $0x804528
+  800fec:	e8 b6 27 00 00       	call   8037a7 <_panic>
+
+00800ff1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+  800ff7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801005:	b8 06 00 00 00       	mov    $0x6,%eax
+  80100a:	89 df                	mov    %ebx,%edi
+  80100c:	89 de                	mov    %ebx,%esi
+  80100e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801010:	85 c0                	test   %eax,%eax
+  801012:	7f 08                	jg     80101c <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+  80101f:	50                   	push   %eax
+  801020:	6a 06                	push   $0x6
+  801022:	68 0b 45 80 00       	push   $0x80450b
+  801027:	6a 23                	push   $0x23
+  801029:	68 28 45 80 00       	push   $0x804528
+  80102e:	e8 74 27 00 00       	call   8037a7 <_panic>
+
+00801033 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	57                   	push   %edi
+  801037:	56                   	push   %esi
+  801038:	53                   	push   %ebx
+  801039:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80103c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 08 00 00 00       	mov    $0x8,%eax
+  80104c:	89 df                	mov    %ebx,%edi
+  80104e:	89 de                	mov    %ebx,%esi
+  801050:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801052:	85 c0                	test   %eax,%eax
+  801054:	7f 08                	jg     80105e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801056:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801059:	5b                   	pop    %ebx
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105e:	83 ec 0c             	sub    $0xc,%esp
+  801061:	50                   	push   %eax
+  801062:	6a 08                	push   $0x8
+  801064:	68 0b 45 80 00       	push   $0x80450b
+  801069:	6a 23                	push   $0x23
+  80106b:	68 28 45 80 00       	push   $0x804528
+  801070:	e8 32 27 00 00       	call   8037a7 <_panic>
+
+00801075 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	57                   	push   %edi
+  801079:	56                   	push   %esi
+  80107a:	53                   	push   %ebx
+  80107b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80107e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 09 00 00 00       	mov    $0x9,%eax
+  80108e:	89 df                	mov    %ebx,%edi
+  801090:	89 de                	mov    %ebx,%esi
+  801092:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801094:	85 c0                	test   %eax,%eax
+  801096:	7f 08                	jg     8010a0 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801098:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109b:	5b                   	pop    %ebx
+  80109c:	5e                   	pop    %esi
+  80109d:	5f                   	pop    %edi
+  80109e:	5d                   	pop    %ebp
+  80109f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a0:	83 ec 0c             	sub    $0xc,%esp
+  8010a3:	50                   	push   %eax
+  8010a4:	6a 09                	push   $0x9
+  8010a6:	68 0b 45 80 00       	push   $0x80450b
+  8010ab:	6a 23                	push   $0x23
+  8010ad:	68 28 45 80 00       	push   $0x804528
+  8010b2:	e8 f0 26 00 00       	call   8037a7 <_panic>
+
+008010b7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	57                   	push   %edi
+  8010bb:	56                   	push   %esi
+  8010bc:	53                   	push   %ebx
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010d0:	89 df                	mov    %ebx,%edi
+  8010d2:	89 de                	mov    %ebx,%esi
+  8010d4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	7f 08                	jg     8010e2 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e2:	83 ec 0c             	sub    $0xc,%esp
+  8010e5:	50                   	push   %eax
+  8010e6:	6a 0a                	push   $0xa
+  8010e8:	68 0b 45 80 00       	push   $0x80450b
+  8010ed:	6a 23                	push   $0x23
+  8010ef:	68 28 45 80 00       	push   $0x804528
+  8010f4:	e8 ae 26 00 00       	call   8037a7 <_panic>
+
+008010f9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	56                   	push   %esi
+  8010fe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801102:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801105:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80110a:	be 00 00 00 00       	mov    $0x0,%esi
+  80110f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801112:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801115:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801117:	5b                   	pop    %ebx
+  801118:	5e                   	pop    %esi
+  801119:	5f                   	pop    %edi
+  80111a:	5d                   	pop    %ebp
+  80111b:	c3                   	ret
+
+0080111c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80111c:	55                   	push   %ebp
+  80111d:	89 e5                	mov    %esp,%ebp
+  80111f:	57                   	push   %edi
+  801120:	56                   	push   %esi
+  801121:	53                   	push   %ebx
+  801122:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801125:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80112a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801132:	89 cb                	mov    %ecx,%ebx
+  801134:	89 cf                	mov    %ecx,%edi
+  801136:	89 ce                	mov    %ecx,%esi
+  801138:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	7f 08                	jg     801146 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80113e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801146:	83 ec 0c             	sub    $0xc,%esp
+  801149:	50                   	push   %eax
+  80114a:	6a 0d                	push   $0xd
+  80114c:	68 0b 45 80 00       	push   $0x80450b
+  801151:	6a 23                	push   $0x23
+  801153:	68 28 45 80 00       	push   $0x804528
+  801158:	e8 4a 26 00 00       	call   8037a7 <_panic>
+
+0080115d <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801169:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80116e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801171:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801174:	8b 75 18             	mov    0x18(%ebp),%esi
+  801177:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+
+0080117e <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	57                   	push   %edi
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+  801184:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801197:	89 df                	mov    %ebx,%edi
+  801199:	89 de                	mov    %ebx,%esi
+  80119b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80119d:	85 c0                	test   %eax,%eax
+  80119f:	7f 08                	jg     8011a9 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8011a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a9:	83 ec 0c             	sub    $0xc,%esp
+  8011ac:	50                   	push   %eax
+  8011ad:	6a 0d                	push   $0xd
+  8011af:	68 0b 45 80 00       	push   $0x80450b
+  8011b4:	6a 23                	push   $0x23
+  8011b6:	68 28 45 80 00       	push   $0x804528
+  8011bb:	e8 e7 25 00 00       	call   8037a7 <_panic>
+
+008011c0 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	57                   	push   %edi
+  8011c4:	56                   	push   %esi
+  8011c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d0:	89 d1                	mov    %edx,%ecx
+  8011d2:	89 d3                	mov    %edx,%ebx
+  8011d4:	89 d7                	mov    %edx,%edi
+  8011d6:	89 d6                	mov    %edx,%esi
+  8011d8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011f5:	89 df                	mov    %ebx,%edi
+  8011f7:	89 de                	mov    %ebx,%esi
+  8011f9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8011fb:	5b                   	pop    %ebx
+  8011fc:	5e                   	pop    %esi
+  8011fd:	5f                   	pop    %edi
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+
+00801200 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801206:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801213:	89 cb                	mov    %ecx,%ebx
+  801215:	89 cf                	mov    %ecx,%edi
+  801217:	89 ce                	mov    %ecx,%esi
+  801219:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+
+00801220 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	57                   	push   %edi
+  801224:	56                   	push   %esi
+  801225:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801226:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801231:	b8 11 00 00 00       	mov    $0x11,%eax
+  801236:	89 df                	mov    %ebx,%edi
+  801238:	89 de                	mov    %ebx,%esi
+  80123a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+
+00801241 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801252:	b8 12 00 00 00       	mov    $0x12,%eax
+  801257:	89 df                	mov    %ebx,%edi
+  801259:	89 de                	mov    %ebx,%esi
+  80125b:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80125d:	5b                   	pop    %ebx
+  80125e:	5e                   	pop    %esi
+  80125f:	5f                   	pop    %edi
+  801260:	5d                   	pop    %ebp
+  801261:	c3                   	ret
+
+00801262 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	57                   	push   %edi
+  801266:	56                   	push   %esi
+  801267:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801268:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	b8 13 00 00 00       	mov    $0x13,%eax
+  801275:	89 cb                	mov    %ecx,%ebx
+  801277:	89 cf                	mov    %ecx,%edi
+  801279:	89 ce                	mov    %ecx,%esi
+  80127b:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80127d:	5b                   	pop    %ebx
+  80127e:	5e                   	pop    %esi
+  80127f:	5f                   	pop    %edi
+  801280:	5d                   	pop    %ebp
+  801281:	c3                   	ret
+
+00801282 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	b8 14 00 00 00       	mov    $0x14,%eax
+  801298:	89 df                	mov    %ebx,%edi
+  80129a:	89 de                	mov    %ebx,%esi
+  80129c:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80129e:	5b                   	pop    %ebx
+  80129f:	5e                   	pop    %esi
+  8012a0:	5f                   	pop    %edi
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+
+008012a3 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8012a3:	55                   	push   %ebp
+  8012a4:	89 e5                	mov    %esp,%ebp
+  8012a6:	57                   	push   %edi
+  8012a7:	56                   	push   %esi
+  8012a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012b6:	89 cb                	mov    %ecx,%ebx
+  8012b8:	89 cf                	mov    %ecx,%edi
+  8012ba:	89 ce                	mov    %ecx,%esi
+  8012bc:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8012be:	5b                   	pop    %ebx
+  8012bf:	5e                   	pop    %esi
+  8012c0:	5f                   	pop    %edi
+  8012c1:	5d                   	pop    %ebp
+  8012c2:	c3                   	ret
+
+008012c3 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012dc:	89 f7                	mov    %esi,%edi
+  8012de:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+
+008012e5 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	57                   	push   %edi
+  8012e9:	56                   	push   %esi
+  8012ea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012fb:	89 df                	mov    %ebx,%edi
+  8012fd:	89 de                	mov    %ebx,%esi
+  8012ff:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+
+00801306 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	57                   	push   %edi
+  80130a:	56                   	push   %esi
+  80130b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80130c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801311:	8b 55 08             	mov    0x8(%ebp),%edx
+  801314:	b8 18 00 00 00       	mov    $0x18,%eax
+  801319:	89 cb                	mov    %ecx,%ebx
+  80131b:	89 cf                	mov    %ecx,%edi
+  80131d:	89 ce                	mov    %ecx,%esi
+  80131f:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801321:	5b                   	pop    %ebx
+  801322:	5e                   	pop    %esi
+  801323:	5f                   	pop    %edi
+  801324:	5d                   	pop    %ebp
+  801325:	c3                   	ret
+
+00801326 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	57                   	push   %edi
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80132c:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801338:	b8 19 00 00 00       	mov    $0x19,%eax
+  80133d:	89 df                	mov    %ebx,%edi
+  80133f:	89 de                	mov    %ebx,%esi
+  801341:	cd 30                	int    $0x30
+}
+  801343:	5b                   	pop    %ebx
+  801344:	5e                   	pop    %esi
+  801345:	5f                   	pop    %edi
+  801346:	5d                   	pop    %ebp
+  801347:	c3                   	ret
+
+00801348 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	57                   	push   %edi
+  80134c:	56                   	push   %esi
+  80134d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80135e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801361:	89 f7                	mov    %esi,%edi
+  801363:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801365:	5b                   	pop    %ebx
+  801366:	5e                   	pop    %esi
+  801367:	5f                   	pop    %edi
+  801368:	5d                   	pop    %ebp
+  801369:	c3                   	ret
+
+0080136a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80136a:	55                   	push   %ebp
+  80136b:	89 e5                	mov    %esp,%ebp
+  80136d:	57                   	push   %edi
+  80136e:	56                   	push   %esi
+  80136f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801370:	be 00 00 00 00       	mov    $0x0,%esi
+  801375:	8b 55 08             	mov    0x8(%ebp),%edx
+  801378:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801383:	89 f7                	mov    %esi,%edi
+  801385:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801387:	5b                   	pop    %ebx
+  801388:	5e                   	pop    %esi
+  801389:	5f                   	pop    %edi
+  80138a:	5d                   	pop    %ebp
+  80138b:	c3                   	ret
+
+0080138c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	57                   	push   %edi
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013a2:	89 df                	mov    %ebx,%edi
+  8013a4:	89 de                	mov    %ebx,%esi
+  8013a6:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8013a8:	5b                   	pop    %ebx
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5f                   	pop    %edi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+
+008013ad <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	57                   	push   %edi
+  8013b1:	56                   	push   %esi
+  8013b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013be:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c6:	89 f7                	mov    %esi,%edi
+  8013c8:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8013ca:	5b                   	pop    %ebx
+  8013cb:	5e                   	pop    %esi
+  8013cc:	5f                   	pop    %edi
+  8013cd:	5d                   	pop    %ebp
+  8013ce:	c3                   	ret
+
+008013cf <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013da:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013dd:	5d                   	pop    %ebp
+  8013de:	c3                   	ret
+
+008013df <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013df:	55                   	push   %ebp
+  8013e0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013ea:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013ef:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+
+008013f6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013fe:	89 c2                	mov    %eax,%edx
+  801400:	c1 ea 16             	shr    $0x16,%edx
+  801403:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80140a:	f6 c2 01             	test   $0x1,%dl
+  80140d:	74 29                	je     801438 <fd_alloc+0x42>
+  80140f:	89 c2                	mov    %eax,%edx
+  801411:	c1 ea 0c             	shr    $0xc,%edx
+  801414:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80141b:	f6 c2 01             	test   $0x1,%dl
+  80141e:	74 18                	je     801438 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801420:	05 00 10 00 00       	add    $0x1000,%eax
+  801425:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80142a:	75 d2                	jne    8013fe <fd_alloc+0x8>
+  80142c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801431:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801436:	eb 05                	jmp    80143d <fd_alloc+0x47>
+			return 0;
+  801438:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80143d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801440:	89 02                	mov    %eax,(%edx)
+}
+  801442:	89 c8                	mov    %ecx,%eax
+  801444:	5d                   	pop    %ebp
+  801445:	c3                   	ret
+
+00801446 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801446:	55                   	push   %ebp
+  801447:	89 e5                	mov    %esp,%ebp
+  801449:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80144c:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801451:	77 30                	ja     801483 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801453:	c1 e0 0c             	shl    $0xc,%eax
+  801456:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80145b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801461:	f6 c2 01             	test   $0x1,%dl
+  801464:	74 24                	je     80148a <fd_lookup+0x44>
+  801466:	89 c2                	mov    %eax,%edx
+  801468:	c1 ea 0c             	shr    $0xc,%edx
+  80146b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801472:	f6 c2 01             	test   $0x1,%dl
+  801475:	74 1a                	je     801491 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801477:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80147a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801481:	5d                   	pop    %ebp
+  801482:	c3                   	ret
+		return -E_INVAL;
+  801483:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801488:	eb f7                	jmp    801481 <fd_lookup+0x3b>
+		return -E_INVAL;
+  80148a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148f:	eb f0                	jmp    801481 <fd_lookup+0x3b>
+  801491:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801496:	eb e9                	jmp    801481 <fd_lookup+0x3b>
+
+00801498 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	53                   	push   %ebx
+  80149c:	83 ec 04             	sub    $0x4,%esp
+  80149f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a7:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8014ac:	39 13                	cmp    %edx,(%ebx)
+  8014ae:	74 54                	je     801504 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8014b0:	83 c0 01             	add    $0x1,%eax
+  8014b3:	8b 1c 85 b4 45 80 00 	mov    0x8045b4(,%eax,4),%ebx
+  8014ba:	85 db                	test   %ebx,%ebx
+  8014bc:	75 ee                	jne    8014ac <dev_lookup+0x14>
+  8014be:	89 e1                	mov    %esp,%ecx
+  8014c0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8014c5:	29 c8                	sub    %ecx,%eax
+  8014c7:	89 c1                	mov    %eax,%ecx
+  8014c9:	c1 e9 0f             	shr    $0xf,%ecx
+  8014cc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d6:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014d9:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  8014e0:	8b 40 48             	mov    0x48(%eax),%eax
+  8014e3:	83 ec 04             	sub    $0x4,%esp
+  8014e6:	52                   	push   %edx
+  8014e7:	50                   	push   %eax
+  8014e8:	68 38 45 80 00       	push   $0x804538
+  8014ed:	e8 4f ef ff ff       	call   800441 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014f2:	83 c4 10             	add    $0x10,%esp
+  8014f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014fd:	89 1a                	mov    %ebx,(%edx)
+}
+  8014ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801502:	c9                   	leave
+  801503:	c3                   	ret
+			return 0;
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	eb ef                	jmp    8014fa <dev_lookup+0x62>
+
+0080150b <fd_close>:
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	57                   	push   %edi
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+  801511:	83 ec 24             	sub    $0x24,%esp
+  801514:	8b 75 08             	mov    0x8(%ebp),%esi
+  801517:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80151a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80151d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80151e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801524:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801527:	50                   	push   %eax
+  801528:	e8 19 ff ff ff       	call   801446 <fd_lookup>
+  80152d:	89 c3                	mov    %eax,%ebx
+  80152f:	83 c4 10             	add    $0x10,%esp
+  801532:	85 c0                	test   %eax,%eax
+  801534:	78 05                	js     80153b <fd_close+0x30>
+	    || fd != fd2)
+  801536:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801539:	74 0f                	je     80154a <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80153b:	85 ff                	test   %edi,%edi
+  80153d:	0f 44 df             	cmove  %edi,%ebx
+}
+  801540:	89 d8                	mov    %ebx,%eax
+  801542:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801545:	5b                   	pop    %ebx
+  801546:	5e                   	pop    %esi
+  801547:	5f                   	pop    %edi
+  801548:	5d                   	pop    %ebp
+  801549:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80154a:	83 ec 08             	sub    $0x8,%esp
+  80154d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801550:	50                   	push   %eax
+  801551:	ff 36                	push   (%esi)
+  801553:	e8 40 ff ff ff       	call   801498 <dev_lookup>
+  801558:	89 c3                	mov    %eax,%ebx
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	78 1a                	js     80157b <fd_close+0x70>
+		if (dev->dev_close)
+  801561:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801564:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801567:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	74 0b                	je     80157b <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	56                   	push   %esi
+  801574:	ff d0                	call   *%eax
+  801576:	89 c3                	mov    %eax,%ebx
+  801578:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80157b:	83 ec 08             	sub    $0x8,%esp
+  80157e:	56                   	push   %esi
+  80157f:	6a 00                	push   $0x0
+  801581:	e8 6b fa ff ff       	call   800ff1 <sys_page_unmap>
+	return r;
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	eb b5                	jmp    801540 <fd_close+0x35>
+
+0080158b <close>:
+
+int
+close(int fdnum)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801591:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801594:	50                   	push   %eax
+  801595:	ff 75 08             	push   0x8(%ebp)
+  801598:	e8 a9 fe ff ff       	call   801446 <fd_lookup>
+  80159d:	83 c4 10             	add    $0x10,%esp
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	79 02                	jns    8015a6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+		return fd_close(fd, 1);
+  8015a6:	83 ec 08             	sub    $0x8,%esp
+  8015a9:	6a 01                	push   $0x1
+  8015ab:	ff 75 f4             	push   -0xc(%ebp)
+  8015ae:	e8 58 ff ff ff       	call   80150b <fd_close>
+  8015b3:	83 c4 10             	add    $0x10,%esp
+  8015b6:	eb ec                	jmp    8015a4 <close+0x19>
+
+008015b8 <close_all>:
+
+void
+close_all(void)
+{
+  8015b8:	55                   	push   %ebp
+  8015b9:	89 e5                	mov    %esp,%ebp
+  8015bb:	53                   	push   %ebx
+  8015bc:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015c4:	83 ec 0c             	sub    $0xc,%esp
+  8015c7:	53                   	push   %ebx
+  8015c8:	e8 be ff ff ff       	call   80158b <close>
+	for (i = 0; i < MAXFD; i++)
+  8015cd:	83 c3 01             	add    $0x1,%ebx
+  8015d0:	83 c4 10             	add    $0x10,%esp
+  8015d3:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8015d9:	75 e9                	jne    8015c4 <close_all+0xc>
+}
+  8015db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015de:	c9                   	leave
+  8015df:	c3                   	ret
+
+008015e0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	57                   	push   %edi
+  8015e4:	56                   	push   %esi
+  8015e5:	53                   	push   %ebx
+  8015e6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015e9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015ec:	50                   	push   %eax
+  8015ed:	ff 75 08             	push   0x8(%ebp)
+  8015f0:	e8 51 fe ff ff       	call   801446 <fd_lookup>
+  8015f5:	89 c3                	mov    %eax,%ebx
+  8015f7:	83 c4 10             	add    $0x10,%esp
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	78 7f                	js     80167d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015fe:	83 ec 0c             	sub    $0xc,%esp
+  801601:	ff 75 0c             	push   0xc(%ebp)
+  801604:	e8 82 ff ff ff       	call   80158b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801609:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80160c:	c1 e6 0c             	shl    $0xc,%esi
+  80160f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801615:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801618:	89 3c 24             	mov    %edi,(%esp)
+  80161b:	e8 bf fd ff ff       	call   8013df <fd2data>
+  801620:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801622:	89 34 24             	mov    %esi,(%esp)
+  801625:	e8 b5 fd ff ff       	call   8013df <fd2data>
+  80162a:	83 c4 10             	add    $0x10,%esp
+  80162d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801630:	89 d8                	mov    %ebx,%eax
+  801632:	c1 e8 16             	shr    $0x16,%eax
+  801635:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80163c:	a8 01                	test   $0x1,%al
+  80163e:	74 11                	je     801651 <dup+0x71>
+  801640:	89 d8                	mov    %ebx,%eax
+  801642:	c1 e8 0c             	shr    $0xc,%eax
+  801645:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80164c:	f6 c2 01             	test   $0x1,%dl
+  80164f:	75 36                	jne    801687 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801651:	89 f8                	mov    %edi,%eax
+  801653:	c1 e8 0c             	shr    $0xc,%eax
+  801656:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80165d:	83 ec 0c             	sub    $0xc,%esp
+  801660:	25 07 0e 00 00       	and    $0xe07,%eax
+  801665:	50                   	push   %eax
+  801666:	56                   	push   %esi
+  801667:	6a 00                	push   $0x0
+  801669:	57                   	push   %edi
+  80166a:	6a 00                	push   $0x0
+  80166c:	e8 3e f9 ff ff       	call   800faf <sys_page_map>
+  801671:	89 c3                	mov    %eax,%ebx
+  801673:	83 c4 20             	add    $0x20,%esp
+  801676:	85 c0                	test   %eax,%eax
+  801678:	78 33                	js     8016ad <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80167a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80167d:	89 d8                	mov    %ebx,%eax
+  80167f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801682:	5b                   	pop    %ebx
+  801683:	5e                   	pop    %esi
+  801684:	5f                   	pop    %edi
+  801685:	5d                   	pop    %ebp
+  801686:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801687:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80168e:	83 ec 0c             	sub    $0xc,%esp
+  801691:	25 07 0e 00 00       	and    $0xe07,%eax
+  801696:	50                   	push   %eax
+  801697:	ff 75 d4             	push   -0x2c(%ebp)
+  80169a:	6a 00                	push   $0x0
+  80169c:	53                   	push   %ebx
+  80169d:	6a 00                	push   $0x0
+  80169f:	e8 0b f9 ff ff       	call   800faf <sys_page_map>
+  8016a4:	89 c3                	mov    %eax,%ebx
+  8016a6:	83 c4 20             	add    $0x20,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	79 a4                	jns    801651 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016ad:	83 ec 08             	sub    $0x8,%esp
+  8016b0:	56                   	push   %esi
+  8016b1:	6a 00                	push   $0x0
+  8016b3:	e8 39 f9 ff ff       	call   800ff1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016b8:	83 c4 08             	add    $0x8,%esp
+  8016bb:	ff 75 d4             	push   -0x2c(%ebp)
+  8016be:	6a 00                	push   $0x0
+  8016c0:	e8 2c f9 ff ff       	call   800ff1 <sys_page_unmap>
+	return r;
+  8016c5:	83 c4 10             	add    $0x10,%esp
+  8016c8:	eb b3                	jmp    80167d <dup+0x9d>
+
+008016ca <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	56                   	push   %esi
+  8016ce:	53                   	push   %ebx
+  8016cf:	83 ec 18             	sub    $0x18,%esp
+  8016d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d8:	50                   	push   %eax
+  8016d9:	53                   	push   %ebx
+  8016da:	e8 67 fd ff ff       	call   801446 <fd_lookup>
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	78 3c                	js     801722 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016e9:	83 ec 08             	sub    $0x8,%esp
+  8016ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ef:	50                   	push   %eax
+  8016f0:	ff 36                	push   (%esi)
+  8016f2:	e8 a1 fd ff ff       	call   801498 <dev_lookup>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 24                	js     801722 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016fe:	8b 46 08             	mov    0x8(%esi),%eax
+  801701:	83 e0 03             	and    $0x3,%eax
+  801704:	83 f8 01             	cmp    $0x1,%eax
+  801707:	74 20                	je     801729 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170c:	8b 40 08             	mov    0x8(%eax),%eax
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	74 54                	je     801767 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801713:	83 ec 04             	sub    $0x4,%esp
+  801716:	ff 75 10             	push   0x10(%ebp)
+  801719:	ff 75 0c             	push   0xc(%ebp)
+  80171c:	56                   	push   %esi
+  80171d:	ff d0                	call   *%eax
+  80171f:	83 c4 10             	add    $0x10,%esp
+}
+  801722:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801725:	5b                   	pop    %ebx
+  801726:	5e                   	pop    %esi
+  801727:	5d                   	pop    %ebp
+  801728:	c3                   	ret
+  801729:	89 e2                	mov    %esp,%edx
+  80172b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801730:	29 d0                	sub    %edx,%eax
+  801732:	89 c2                	mov    %eax,%edx
+  801734:	c1 ea 0f             	shr    $0xf,%edx
+  801737:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80173c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801741:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801744:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80174b:	8b 40 48             	mov    0x48(%eax),%eax
+  80174e:	83 ec 04             	sub    $0x4,%esp
+  801751:	53                   	push   %ebx
+  801752:	50                   	push   %eax
+  801753:	68 79 45 80 00       	push   $0x804579
+  801758:	e8 e4 ec ff ff       	call   800441 <cprintf>
+		return -E_INVAL;
+  80175d:	83 c4 10             	add    $0x10,%esp
+  801760:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801765:	eb bb                	jmp    801722 <read+0x58>
+		return -E_NOT_SUPP;
+  801767:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80176c:	eb b4                	jmp    801722 <read+0x58>
+
+0080176e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	57                   	push   %edi
+  801772:	56                   	push   %esi
+  801773:	53                   	push   %ebx
+  801774:	83 ec 0c             	sub    $0xc,%esp
+  801777:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80177a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80177d:	85 f6                	test   %esi,%esi
+  80177f:	74 30                	je     8017b1 <readn+0x43>
+  801781:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801786:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80178b:	83 ec 04             	sub    $0x4,%esp
+  80178e:	89 f2                	mov    %esi,%edx
+  801790:	29 c2                	sub    %eax,%edx
+  801792:	52                   	push   %edx
+  801793:	01 f8                	add    %edi,%eax
+  801795:	50                   	push   %eax
+  801796:	ff 75 08             	push   0x8(%ebp)
+  801799:	e8 2c ff ff ff       	call   8016ca <read>
+		if (m < 0)
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	78 15                	js     8017ba <readn+0x4c>
+			return m;
+		if (m == 0)
+  8017a5:	74 11                	je     8017b8 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8017a7:	01 c3                	add    %eax,%ebx
+  8017a9:	89 d8                	mov    %ebx,%eax
+  8017ab:	39 f3                	cmp    %esi,%ebx
+  8017ad:	72 dc                	jb     80178b <readn+0x1d>
+  8017af:	eb 09                	jmp    8017ba <readn+0x4c>
+  8017b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b6:	eb 02                	jmp    8017ba <readn+0x4c>
+  8017b8:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8017ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017bd:	5b                   	pop    %ebx
+  8017be:	5e                   	pop    %esi
+  8017bf:	5f                   	pop    %edi
+  8017c0:	5d                   	pop    %ebp
+  8017c1:	c3                   	ret
+
+008017c2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	56                   	push   %esi
+  8017c6:	53                   	push   %ebx
+  8017c7:	83 ec 18             	sub    $0x18,%esp
+  8017ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017d0:	50                   	push   %eax
+  8017d1:	53                   	push   %ebx
+  8017d2:	e8 6f fc ff ff       	call   801446 <fd_lookup>
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	78 37                	js     801815 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017de:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017e1:	83 ec 08             	sub    $0x8,%esp
+  8017e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e7:	50                   	push   %eax
+  8017e8:	ff 36                	push   (%esi)
+  8017ea:	e8 a9 fc ff ff       	call   801498 <dev_lookup>
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	78 1f                	js     801815 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017f6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017fa:	74 20                	je     80181c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  801802:	85 c0                	test   %eax,%eax
+  801804:	74 54                	je     80185a <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801806:	83 ec 04             	sub    $0x4,%esp
+  801809:	ff 75 10             	push   0x10(%ebp)
+  80180c:	ff 75 0c             	push   0xc(%ebp)
+  80180f:	56                   	push   %esi
+  801810:	ff d0                	call   *%eax
+  801812:	83 c4 10             	add    $0x10,%esp
+}
+  801815:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801818:	5b                   	pop    %ebx
+  801819:	5e                   	pop    %esi
+  80181a:	5d                   	pop    %ebp
+  80181b:	c3                   	ret
+  80181c:	89 e2                	mov    %esp,%edx
+  80181e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801823:	29 d0                	sub    %edx,%eax
+  801825:	89 c2                	mov    %eax,%edx
+  801827:	c1 ea 0f             	shr    $0xf,%edx
+  80182a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80182f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801834:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801837:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80183e:	8b 40 48             	mov    0x48(%eax),%eax
+  801841:	83 ec 04             	sub    $0x4,%esp
+  801844:	53                   	push   %ebx
+  801845:	50                   	push   %eax
+  801846:	68 95 45 80 00       	push   $0x804595
+  80184b:	e8 f1 eb ff ff       	call   800441 <cprintf>
+		return -E_INVAL;
+  801850:	83 c4 10             	add    $0x10,%esp
+  801853:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801858:	eb bb                	jmp    801815 <write+0x53>
+		return -E_NOT_SUPP;
+  80185a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80185f:	eb b4                	jmp    801815 <write+0x53>
+
+00801861 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801861:	55                   	push   %ebp
+  801862:	89 e5                	mov    %esp,%ebp
+  801864:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801867:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80186a:	50                   	push   %eax
+  80186b:	ff 75 08             	push   0x8(%ebp)
+  80186e:	e8 d3 fb ff ff       	call   801446 <fd_lookup>
+  801873:	83 c4 10             	add    $0x10,%esp
+  801876:	85 c0                	test   %eax,%eax
+  801878:	78 0e                	js     801888 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80187a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80187d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801880:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801883:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801888:	c9                   	leave
+  801889:	c3                   	ret
+
+0080188a <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80188a:	55                   	push   %ebp
+  80188b:	89 e5                	mov    %esp,%ebp
+  80188d:	53                   	push   %ebx
+  80188e:	83 ec 1c             	sub    $0x1c,%esp
+  801891:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801894:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801897:	50                   	push   %eax
+  801898:	ff 75 08             	push   0x8(%ebp)
+  80189b:	e8 a6 fb ff ff       	call   801446 <fd_lookup>
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	85 c0                	test   %eax,%eax
+  8018a5:	78 33                	js     8018da <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8018a7:	83 fb 03             	cmp    $0x3,%ebx
+  8018aa:	74 28                	je     8018d4 <fcntl+0x4a>
+  8018ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b1:	83 fb 04             	cmp    $0x4,%ebx
+  8018b4:	75 24                	jne    8018da <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8018b6:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8018b9:	8b 41 08             	mov    0x8(%ecx),%eax
+  8018bc:	80 e4 ef             	and    $0xef,%ah
+  8018bf:	8b 55 10             	mov    0x10(%ebp),%edx
+  8018c2:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8018c8:	09 d0                	or     %edx,%eax
+  8018ca:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8018cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d2:	eb 06                	jmp    8018da <fcntl+0x50>
+		return fd->fd_omode;
+  8018d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d7:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8018da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018dd:	c9                   	leave
+  8018de:	c3                   	ret
+
+008018df <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	56                   	push   %esi
+  8018e3:	53                   	push   %ebx
+  8018e4:	83 ec 18             	sub    $0x18,%esp
+  8018e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ed:	50                   	push   %eax
+  8018ee:	53                   	push   %ebx
+  8018ef:	e8 52 fb ff ff       	call   801446 <fd_lookup>
+  8018f4:	83 c4 10             	add    $0x10,%esp
+  8018f7:	85 c0                	test   %eax,%eax
+  8018f9:	78 34                	js     80192f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018fb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+  801901:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801904:	50                   	push   %eax
+  801905:	ff 36                	push   (%esi)
+  801907:	e8 8c fb ff ff       	call   801498 <dev_lookup>
+  80190c:	83 c4 10             	add    $0x10,%esp
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	78 1c                	js     80192f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801913:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801917:	74 1d                	je     801936 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801919:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80191c:	8b 40 18             	mov    0x18(%eax),%eax
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	74 51                	je     801974 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801923:	83 ec 08             	sub    $0x8,%esp
+  801926:	ff 75 0c             	push   0xc(%ebp)
+  801929:	56                   	push   %esi
+  80192a:	ff d0                	call   *%eax
+  80192c:	83 c4 10             	add    $0x10,%esp
+}
+  80192f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801932:	5b                   	pop    %ebx
+  801933:	5e                   	pop    %esi
+  801934:	5d                   	pop    %ebp
+  801935:	c3                   	ret
+  801936:	89 e2                	mov    %esp,%edx
+  801938:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80193d:	29 d0                	sub    %edx,%eax
+  80193f:	89 c2                	mov    %eax,%edx
+  801941:	c1 ea 0f             	shr    $0xf,%edx
+  801944:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194e:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801951:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  801958:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80195b:	83 ec 04             	sub    $0x4,%esp
+  80195e:	53                   	push   %ebx
+  80195f:	50                   	push   %eax
+  801960:	68 58 45 80 00       	push   $0x804558
+  801965:	e8 d7 ea ff ff       	call   800441 <cprintf>
+		return -E_INVAL;
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801972:	eb bb                	jmp    80192f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801974:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801979:	eb b4                	jmp    80192f <ftruncate+0x50>
+
+0080197b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	56                   	push   %esi
+  80197f:	53                   	push   %ebx
+  801980:	83 ec 18             	sub    $0x18,%esp
+  801983:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801986:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801989:	50                   	push   %eax
+  80198a:	ff 75 08             	push   0x8(%ebp)
+  80198d:	e8 b4 fa ff ff       	call   801446 <fd_lookup>
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	85 c0                	test   %eax,%eax
+  801997:	78 53                	js     8019ec <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801999:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80199c:	83 ec 08             	sub    $0x8,%esp
+  80199f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a2:	50                   	push   %eax
+  8019a3:	ff 36                	push   (%esi)
+  8019a5:	e8 ee fa ff ff       	call   801498 <dev_lookup>
+  8019aa:	83 c4 10             	add    $0x10,%esp
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	78 3b                	js     8019ec <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8019b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019b4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019b8:	74 39                	je     8019f3 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019ba:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019bd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019c4:	00 00 00 
+	stat->st_isdir = 0;
+  8019c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019ce:	00 00 00 
+	stat->st_version = 0;
+  8019d1:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8019d8:	00 00 00 
+	stat->st_dev = dev;
+  8019db:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019e1:	83 ec 08             	sub    $0x8,%esp
+  8019e4:	53                   	push   %ebx
+  8019e5:	56                   	push   %esi
+  8019e6:	ff 50 14             	call   *0x14(%eax)
+  8019e9:	83 c4 10             	add    $0x10,%esp
+}
+  8019ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ef:	5b                   	pop    %ebx
+  8019f0:	5e                   	pop    %esi
+  8019f1:	5d                   	pop    %ebp
+  8019f2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019f3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019f8:	eb f2                	jmp    8019ec <fstat+0x71>
+
+008019fa <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	56                   	push   %esi
+  8019fe:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8019ff:	83 ec 08             	sub    $0x8,%esp
+  801a02:	6a 00                	push   $0x0
+  801a04:	ff 75 08             	push   0x8(%ebp)
+  801a07:	e8 b7 01 00 00       	call   801bc3 <open>
+  801a0c:	89 c3                	mov    %eax,%ebx
+  801a0e:	83 c4 10             	add    $0x10,%esp
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	78 1b                	js     801a30 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a15:	83 ec 08             	sub    $0x8,%esp
+  801a18:	ff 75 0c             	push   0xc(%ebp)
+  801a1b:	50                   	push   %eax
+  801a1c:	e8 5a ff ff ff       	call   80197b <fstat>
+  801a21:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a23:	89 1c 24             	mov    %ebx,(%esp)
+  801a26:	e8 60 fb ff ff       	call   80158b <close>
+	return r;
+  801a2b:	83 c4 10             	add    $0x10,%esp
+  801a2e:	89 f3                	mov    %esi,%ebx
+}
+  801a30:	89 d8                	mov    %ebx,%eax
+  801a32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a35:	5b                   	pop    %ebx
+  801a36:	5e                   	pop    %esi
+  801a37:	5d                   	pop    %ebp
+  801a38:	c3                   	ret
+
+00801a39 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	56                   	push   %esi
+  801a3d:	53                   	push   %ebx
+  801a3e:	89 c6                	mov    %eax,%esi
+  801a40:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801a42:	83 3d 00 64 80 00 00 	cmpl   $0x0,0x806400
+  801a49:	74 27                	je     801a72 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a4b:	6a 07                	push   $0x7
+  801a4d:	68 00 70 80 00       	push   $0x807000
+  801a52:	56                   	push   %esi
+  801a53:	ff 35 00 64 80 00    	push   0x806400
+  801a59:	e8 1f 20 00 00       	call   803a7d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a5e:	83 c4 0c             	add    $0xc,%esp
+  801a61:	6a 00                	push   $0x0
+  801a63:	53                   	push   %ebx
+  801a64:	6a 00                	push   $0x0
+  801a66:	e8 82 1d 00 00       	call   8037ed <ipc_recv>
+}
+  801a6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6e:	5b                   	pop    %ebx
+  801a6f:	5e                   	pop    %esi
+  801a70:	5d                   	pop    %ebp
+  801a71:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a72:	83 ec 0c             	sub    $0xc,%esp
+  801a75:	6a 02                	push   $0x2
+  801a77:	e8 6a 20 00 00       	call   803ae6 <ipc_find_env>
+  801a7c:	a3 00 64 80 00       	mov    %eax,0x806400
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	eb c5                	jmp    801a4b <fsipc+0x12>
+
+00801a86 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a86:	55                   	push   %ebp
+  801a87:	89 e5                	mov    %esp,%ebp
+  801a89:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a8f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a92:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801a97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a9a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa4:	b8 02 00 00 00       	mov    $0x2,%eax
+  801aa9:	e8 8b ff ff ff       	call   801a39 <fsipc>
+}
+  801aae:	c9                   	leave
+  801aaf:	c3                   	ret
+
+00801ab0 <devfile_flush>:
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801abc:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac6:	b8 06 00 00 00       	mov    $0x6,%eax
+  801acb:	e8 69 ff ff ff       	call   801a39 <fsipc>
+}
+  801ad0:	c9                   	leave
+  801ad1:	c3                   	ret
+
+00801ad2 <devfile_stat>:
+{
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	53                   	push   %ebx
+  801ad6:	83 ec 04             	sub    $0x4,%esp
+  801ad9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801adc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae2:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aec:	b8 05 00 00 00       	mov    $0x5,%eax
+  801af1:	e8 43 ff ff ff       	call   801a39 <fsipc>
+  801af6:	85 c0                	test   %eax,%eax
+  801af8:	78 37                	js     801b31 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801afa:	83 ec 08             	sub    $0x8,%esp
+  801afd:	68 00 70 80 00       	push   $0x807000
+  801b02:	53                   	push   %ebx
+  801b03:	e8 30 f0 ff ff       	call   800b38 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b08:	a1 80 70 80 00       	mov    0x807080,%eax
+  801b0d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b13:	a1 84 70 80 00       	mov    0x807084,%eax
+  801b18:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801b1e:	a1 88 70 80 00       	mov    0x807088,%eax
+  801b23:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+
+00801b36 <devfile_write>:
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	83 ec 0c             	sub    $0xc,%esp
+  801b3c:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801b3f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b44:	39 d0                	cmp    %edx,%eax
+  801b46:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b49:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4c:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b4f:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801b55:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801b5a:	50                   	push   %eax
+  801b5b:	ff 75 0c             	push   0xc(%ebp)
+  801b5e:	68 08 70 80 00       	push   $0x807008
+  801b63:	e8 80 f1 ff ff       	call   800ce8 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801b68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b72:	e8 c2 fe ff ff       	call   801a39 <fsipc>
+}
+  801b77:	c9                   	leave
+  801b78:	c3                   	ret
+
+00801b79 <devfile_read>:
+{
+  801b79:	55                   	push   %ebp
+  801b7a:	89 e5                	mov    %esp,%ebp
+  801b7c:	53                   	push   %ebx
+  801b7d:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b83:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b86:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801b8b:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b8e:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801b93:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801b98:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b9d:	e8 97 fe ff ff       	call   801a39 <fsipc>
+  801ba2:	89 c3                	mov    %eax,%ebx
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 14                	js     801bbc <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801ba8:	83 ec 04             	sub    $0x4,%esp
+  801bab:	50                   	push   %eax
+  801bac:	68 00 70 80 00       	push   $0x807000
+  801bb1:	ff 75 0c             	push   0xc(%ebp)
+  801bb4:	e8 2f f1 ff ff       	call   800ce8 <memmove>
+	return r;
+  801bb9:	83 c4 10             	add    $0x10,%esp
+}
+  801bbc:	89 d8                	mov    %ebx,%eax
+  801bbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc1:	c9                   	leave
+  801bc2:	c3                   	ret
+
+00801bc3 <open>:
+{
+  801bc3:	55                   	push   %ebp
+  801bc4:	89 e5                	mov    %esp,%ebp
+  801bc6:	53                   	push   %ebx
+  801bc7:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801bca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bcd:	50                   	push   %eax
+  801bce:	e8 23 f8 ff ff       	call   8013f6 <fd_alloc>
+  801bd3:	89 c3                	mov    %eax,%ebx
+  801bd5:	83 c4 10             	add    $0x10,%esp
+  801bd8:	85 c0                	test   %eax,%eax
+  801bda:	78 2a                	js     801c06 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801bdc:	83 ec 0c             	sub    $0xc,%esp
+  801bdf:	ff 75 08             	push   0x8(%ebp)
+  801be2:	e8 05 ef ff ff       	call   800aec <strlen>
+  801be7:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801bea:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801bef:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801bf4:	7e 17                	jle    801c0d <open+0x4a>
+	fd_close(fd, 1);
+  801bf6:	83 ec 08             	sub    $0x8,%esp
+  801bf9:	6a 01                	push   $0x1
+  801bfb:	ff 75 f4             	push   -0xc(%ebp)
+  801bfe:	e8 08 f9 ff ff       	call   80150b <fd_close>
+	return r;
+  801c03:	83 c4 10             	add    $0x10,%esp
+}
+  801c06:	89 d8                	mov    %ebx,%eax
+  801c08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c0b:	c9                   	leave
+  801c0c:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801c0d:	83 ec 08             	sub    $0x8,%esp
+  801c10:	ff 75 08             	push   0x8(%ebp)
+  801c13:	68 00 70 80 00       	push   $0x807000
+  801c18:	e8 1b ef ff ff       	call   800b38 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c20:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801c25:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c28:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c2d:	e8 07 fe ff ff       	call   801a39 <fsipc>
+  801c32:	89 c3                	mov    %eax,%ebx
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	78 bb                	js     801bf6 <open+0x33>
+	return fd2num(fd); 	
+  801c3b:	83 ec 0c             	sub    $0xc,%esp
+  801c3e:	ff 75 f4             	push   -0xc(%ebp)
+  801c41:	e8 89 f7 ff ff       	call   8013cf <fd2num>
+  801c46:	89 c3                	mov    %eax,%ebx
+  801c48:	83 c4 10             	add    $0x10,%esp
+  801c4b:	eb b9                	jmp    801c06 <open+0x43>
+
+00801c4d <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801c4d:	55                   	push   %ebp
+  801c4e:	89 e5                	mov    %esp,%ebp
+  801c50:	53                   	push   %ebx
+  801c51:	83 ec 1c             	sub    $0x1c,%esp
+  801c54:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c5a:	50                   	push   %eax
+  801c5b:	ff 75 08             	push   0x8(%ebp)
+  801c5e:	e8 e3 f7 ff ff       	call   801446 <fd_lookup>
+  801c63:	83 c4 10             	add    $0x10,%esp
+  801c66:	85 c0                	test   %eax,%eax
+  801c68:	78 5a                	js     801cc4 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801c6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c6d:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801c73:	39 10                	cmp    %edx,(%eax)
+  801c75:	75 66                	jne    801cdd <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801c77:	83 3d 00 64 80 00 00 	cmpl   $0x0,0x806400
+  801c7e:	74 49                	je     801cc9 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801c80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c83:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c86:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801c8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c8e:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801c93:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c99:	6a 07                	push   $0x7
+  801c9b:	68 00 70 80 00       	push   $0x807000
+  801ca0:	6a 09                	push   $0x9
+  801ca2:	ff 35 00 64 80 00    	push   0x806400
+  801ca8:	e8 d0 1d 00 00       	call   803a7d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801cad:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801cb4:	6a 00                	push   $0x0
+  801cb6:	53                   	push   %ebx
+  801cb7:	ff 75 10             	push   0x10(%ebp)
+  801cba:	6a 00                	push   $0x0
+  801cbc:	e8 f9 1b 00 00       	call   8038ba <ipc_recv_pages>
+  801cc1:	83 c4 20             	add    $0x20,%esp
+}
+  801cc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc7:	c9                   	leave
+  801cc8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cc9:	83 ec 0c             	sub    $0xc,%esp
+  801ccc:	6a 02                	push   $0x2
+  801cce:	e8 13 1e 00 00       	call   803ae6 <ipc_find_env>
+  801cd3:	a3 00 64 80 00       	mov    %eax,0x806400
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	eb a3                	jmp    801c80 <fmap+0x33>
+		return -E_INVAL;
+  801cdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce2:	eb e0                	jmp    801cc4 <fmap+0x77>
+
+00801ce4 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ce4:	55                   	push   %ebp
+  801ce5:	89 e5                	mov    %esp,%ebp
+  801ce7:	53                   	push   %ebx
+  801ce8:	83 ec 10             	sub    $0x10,%esp
+  801ceb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801cee:	53                   	push   %ebx
+  801cef:	e8 f8 ed ff ff       	call   800aec <strlen>
+  801cf4:	83 c4 10             	add    $0x10,%esp
+  801cf7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cfc:	7f 25                	jg     801d23 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801cfe:	83 ec 08             	sub    $0x8,%esp
+  801d01:	53                   	push   %ebx
+  801d02:	68 00 70 80 00       	push   $0x807000
+  801d07:	e8 2c ee ff ff       	call   800b38 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d11:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d16:	e8 1e fd ff ff       	call   801a39 <fsipc>
+  801d1b:	83 c4 10             	add    $0x10,%esp
+}
+  801d1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d21:	c9                   	leave
+  801d22:	c3                   	ret
+		return -E_BAD_PATH;
+  801d23:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801d28:	eb f4                	jmp    801d1e <remove+0x3a>
+
+00801d2a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d2a:	55                   	push   %ebp
+  801d2b:	89 e5                	mov    %esp,%ebp
+  801d2d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801d30:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d35:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d3a:	e8 fa fc ff ff       	call   801a39 <fsipc>
+}
+  801d3f:	c9                   	leave
+  801d40:	c3                   	ret
+
+00801d41 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801d47:	68 c8 45 80 00       	push   $0x8045c8
+  801d4c:	ff 75 0c             	push   0xc(%ebp)
+  801d4f:	e8 e4 ed ff ff       	call   800b38 <strcpy>
+	return 0;
+}
+  801d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+
+00801d5b <devsock_close>:
+{
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	53                   	push   %ebx
+  801d5f:	83 ec 10             	sub    $0x10,%esp
+  801d62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801d65:	53                   	push   %ebx
+  801d66:	e8 ba 1d 00 00       	call   803b25 <pageref>
+  801d6b:	89 c2                	mov    %eax,%edx
+  801d6d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d70:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d75:	83 fa 01             	cmp    $0x1,%edx
+  801d78:	74 05                	je     801d7f <devsock_close+0x24>
+}
+  801d7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d7f:	83 ec 0c             	sub    $0xc,%esp
+  801d82:	ff 73 0c             	push   0xc(%ebx)
+  801d85:	e8 b0 05 00 00       	call   80233a <nsipc_close>
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	eb eb                	jmp    801d7a <devsock_close+0x1f>
+
+00801d8f <devsock_write>:
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	53                   	push   %ebx
+  801d93:	83 ec 14             	sub    $0x14,%esp
+  801d96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d9c:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801d9f:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801da2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801da5:	8b 41 08             	mov    0x8(%ecx),%eax
+  801da8:	c1 f8 09             	sar    $0x9,%eax
+  801dab:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801dae:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801db4:	77 13                	ja     801dc9 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801db6:	50                   	push   %eax
+  801db7:	52                   	push   %edx
+  801db8:	53                   	push   %ebx
+  801db9:	ff 71 0c             	push   0xc(%ecx)
+  801dbc:	e8 5c 06 00 00       	call   80241d <nsipc_send>
+  801dc1:	83 c4 10             	add    $0x10,%esp
+}
+  801dc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc7:	c9                   	leave
+  801dc8:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801dc9:	50                   	push   %eax
+  801dca:	6a 01                	push   $0x1
+  801dcc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dcf:	50                   	push   %eax
+  801dd0:	ff 71 0c             	push   0xc(%ecx)
+  801dd3:	e8 a6 06 00 00       	call   80247e <nsipc_sendmsg>
+  801dd8:	83 c4 10             	add    $0x10,%esp
+  801ddb:	eb e7                	jmp    801dc4 <devsock_write+0x35>
+
+00801ddd <devsock_read>:
+{
+  801ddd:	55                   	push   %ebp
+  801dde:	89 e5                	mov    %esp,%ebp
+  801de0:	53                   	push   %ebx
+  801de1:	83 ec 14             	sub    $0x14,%esp
+  801de4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801de7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801dea:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801ded:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801df0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801df3:	8b 41 08             	mov    0x8(%ecx),%eax
+  801df6:	c1 f8 09             	sar    $0x9,%eax
+  801df9:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801dfc:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801e02:	77 13                	ja     801e17 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801e04:	50                   	push   %eax
+  801e05:	52                   	push   %edx
+  801e06:	53                   	push   %ebx
+  801e07:	ff 71 0c             	push   0xc(%ecx)
+  801e0a:	e8 9c 05 00 00       	call   8023ab <nsipc_recv>
+  801e0f:	83 c4 10             	add    $0x10,%esp
+}
+  801e12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e15:	c9                   	leave
+  801e16:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801e17:	50                   	push   %eax
+  801e18:	6a 01                	push   $0x1
+  801e1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e1d:	50                   	push   %eax
+  801e1e:	ff 71 0c             	push   0xc(%ecx)
+  801e21:	e8 02 0a 00 00       	call   802828 <nsipc_recvmsg>
+  801e26:	83 c4 10             	add    $0x10,%esp
+  801e29:	eb e7                	jmp    801e12 <devsock_read+0x35>
+
+00801e2b <fd2sockid>:
+{
+  801e2b:	55                   	push   %ebp
+  801e2c:	89 e5                	mov    %esp,%ebp
+  801e2e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e31:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e34:	52                   	push   %edx
+  801e35:	50                   	push   %eax
+  801e36:	e8 0b f6 ff ff       	call   801446 <fd_lookup>
+  801e3b:	83 c4 10             	add    $0x10,%esp
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 10                	js     801e52 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801e42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e45:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801e4b:	39 08                	cmp    %ecx,(%eax)
+  801e4d:	75 05                	jne    801e54 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801e4f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801e52:	c9                   	leave
+  801e53:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e54:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e59:	eb f7                	jmp    801e52 <fd2sockid+0x27>
+
+00801e5b <sock_flags>:
+{
+  801e5b:	55                   	push   %ebp
+  801e5c:	89 e5                	mov    %esp,%ebp
+  801e5e:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801e61:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e64:	52                   	push   %edx
+  801e65:	50                   	push   %eax
+  801e66:	e8 db f5 ff ff       	call   801446 <fd_lookup>
+  801e6b:	83 c4 10             	add    $0x10,%esp
+  801e6e:	85 c0                	test   %eax,%eax
+  801e70:	78 0e                	js     801e80 <sock_flags+0x25>
+  801e72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e75:	8b 40 08             	mov    0x8(%eax),%eax
+  801e78:	c1 e8 09             	shr    $0x9,%eax
+  801e7b:	83 e0 08             	and    $0x8,%eax
+}
+  801e7e:	c9                   	leave
+  801e7f:	c3                   	ret
+		return 0;
+  801e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e85:	eb f7                	jmp    801e7e <sock_flags+0x23>
+
+00801e87 <alloc_sockfd>:
+{
+  801e87:	55                   	push   %ebp
+  801e88:	89 e5                	mov    %esp,%ebp
+  801e8a:	56                   	push   %esi
+  801e8b:	53                   	push   %ebx
+  801e8c:	83 ec 1c             	sub    $0x1c,%esp
+  801e8f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801e91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e94:	50                   	push   %eax
+  801e95:	e8 5c f5 ff ff       	call   8013f6 <fd_alloc>
+  801e9a:	89 c3                	mov    %eax,%ebx
+  801e9c:	83 c4 10             	add    $0x10,%esp
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	78 43                	js     801ee6 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ea3:	83 ec 04             	sub    $0x4,%esp
+  801ea6:	68 07 04 00 00       	push   $0x407
+  801eab:	ff 75 f4             	push   -0xc(%ebp)
+  801eae:	6a 00                	push   $0x0
+  801eb0:	e8 b7 f0 ff ff       	call   800f6c <sys_page_alloc>
+  801eb5:	89 c3                	mov    %eax,%ebx
+  801eb7:	83 c4 10             	add    $0x10,%esp
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 28                	js     801ee6 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801ebe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec1:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801ec7:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ec9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ecc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801ed3:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ed6:	83 ec 0c             	sub    $0xc,%esp
+  801ed9:	50                   	push   %eax
+  801eda:	e8 f0 f4 ff ff       	call   8013cf <fd2num>
+  801edf:	89 c3                	mov    %eax,%ebx
+  801ee1:	83 c4 10             	add    $0x10,%esp
+  801ee4:	eb 0c                	jmp    801ef2 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801ee6:	83 ec 0c             	sub    $0xc,%esp
+  801ee9:	56                   	push   %esi
+  801eea:	e8 4b 04 00 00       	call   80233a <nsipc_close>
+		return r;
+  801eef:	83 c4 10             	add    $0x10,%esp
+}
+  801ef2:	89 d8                	mov    %ebx,%eax
+  801ef4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef7:	5b                   	pop    %ebx
+  801ef8:	5e                   	pop    %esi
+  801ef9:	5d                   	pop    %ebp
+  801efa:	c3                   	ret
+
+00801efb <accept>:
+{
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	56                   	push   %esi
+  801eff:	53                   	push   %ebx
+  801f00:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f03:	89 f0                	mov    %esi,%eax
+  801f05:	e8 21 ff ff ff       	call   801e2b <fd2sockid>
+  801f0a:	89 c3                	mov    %eax,%ebx
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	78 24                	js     801f34 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801f10:	89 f0                	mov    %esi,%eax
+  801f12:	e8 44 ff ff ff       	call   801e5b <sock_flags>
+  801f17:	50                   	push   %eax
+  801f18:	ff 75 10             	push   0x10(%ebp)
+  801f1b:	ff 75 0c             	push   0xc(%ebp)
+  801f1e:	53                   	push   %ebx
+  801f1f:	e8 6b 03 00 00       	call   80228f <nsipc_accept>
+  801f24:	89 c3                	mov    %eax,%ebx
+  801f26:	83 c4 10             	add    $0x10,%esp
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 07                	js     801f34 <accept+0x39>
+	return alloc_sockfd(r);
+  801f2d:	e8 55 ff ff ff       	call   801e87 <alloc_sockfd>
+  801f32:	89 c3                	mov    %eax,%ebx
+}
+  801f34:	89 d8                	mov    %ebx,%eax
+  801f36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f39:	5b                   	pop    %ebx
+  801f3a:	5e                   	pop    %esi
+  801f3b:	5d                   	pop    %ebp
+  801f3c:	c3                   	ret
+
+00801f3d <bind>:
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f46:	e8 e0 fe ff ff       	call   801e2b <fd2sockid>
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	78 12                	js     801f61 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f4f:	83 ec 04             	sub    $0x4,%esp
+  801f52:	ff 75 10             	push   0x10(%ebp)
+  801f55:	ff 75 0c             	push   0xc(%ebp)
+  801f58:	50                   	push   %eax
+  801f59:	e8 85 03 00 00       	call   8022e3 <nsipc_bind>
+  801f5e:	83 c4 10             	add    $0x10,%esp
+}
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+
+00801f63 <shutdown>:
+{
+  801f63:	55                   	push   %ebp
+  801f64:	89 e5                	mov    %esp,%ebp
+  801f66:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6c:	e8 ba fe ff ff       	call   801e2b <fd2sockid>
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	78 0f                	js     801f84 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f75:	83 ec 08             	sub    $0x8,%esp
+  801f78:	ff 75 0c             	push   0xc(%ebp)
+  801f7b:	50                   	push   %eax
+  801f7c:	e8 97 03 00 00       	call   802318 <nsipc_shutdown>
+  801f81:	83 c4 10             	add    $0x10,%esp
+}
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+
+00801f86 <connect>:
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8f:	e8 97 fe ff ff       	call   801e2b <fd2sockid>
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	78 12                	js     801faa <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801f98:	83 ec 04             	sub    $0x4,%esp
+  801f9b:	ff 75 10             	push   0x10(%ebp)
+  801f9e:	ff 75 0c             	push   0xc(%ebp)
+  801fa1:	50                   	push   %eax
+  801fa2:	e8 ad 03 00 00       	call   802354 <nsipc_connect>
+  801fa7:	83 c4 10             	add    $0x10,%esp
+}
+  801faa:	c9                   	leave
+  801fab:	c3                   	ret
+
+00801fac <listen>:
+{
+  801fac:	55                   	push   %ebp
+  801fad:	89 e5                	mov    %esp,%ebp
+  801faf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb5:	e8 71 fe ff ff       	call   801e2b <fd2sockid>
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 0f                	js     801fcd <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801fbe:	83 ec 08             	sub    $0x8,%esp
+  801fc1:	ff 75 0c             	push   0xc(%ebp)
+  801fc4:	50                   	push   %eax
+  801fc5:	e8 bf 03 00 00       	call   802389 <nsipc_listen>
+  801fca:	83 c4 10             	add    $0x10,%esp
+}
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <sendmsg>:
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	57                   	push   %edi
+  801fd3:	56                   	push   %esi
+  801fd4:	53                   	push   %ebx
+  801fd5:	83 ec 0c             	sub    $0xc,%esp
+  801fd8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fdb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801fde:	89 f0                	mov    %esi,%eax
+  801fe0:	e8 46 fe ff ff       	call   801e2b <fd2sockid>
+  801fe5:	89 c3                	mov    %eax,%ebx
+  801fe7:	85 c0                	test   %eax,%eax
+  801fe9:	78 1c                	js     802007 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801feb:	89 f0                	mov    %esi,%eax
+  801fed:	e8 69 fe ff ff       	call   801e5b <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801ff2:	0b 45 10             	or     0x10(%ebp),%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	ff 77 0c             	push   0xc(%edi)
+  801ff9:	ff 77 08             	push   0x8(%edi)
+  801ffc:	53                   	push   %ebx
+  801ffd:	e8 7c 04 00 00       	call   80247e <nsipc_sendmsg>
+  802002:	89 c3                	mov    %eax,%ebx
+  802004:	83 c4 10             	add    $0x10,%esp
+}
+  802007:	89 d8                	mov    %ebx,%eax
+  802009:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80200c:	5b                   	pop    %ebx
+  80200d:	5e                   	pop    %esi
+  80200e:	5f                   	pop    %edi
+  80200f:	5d                   	pop    %ebp
+  802010:	c3                   	ret
+
+00802011 <recvmsg>:
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	57                   	push   %edi
+  802015:	56                   	push   %esi
+  802016:	53                   	push   %ebx
+  802017:	83 ec 0c             	sub    $0xc,%esp
+  80201a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80201d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802020:	89 f8                	mov    %edi,%eax
+  802022:	e8 04 fe ff ff       	call   801e2b <fd2sockid>
+  802027:	89 c3                	mov    %eax,%ebx
+  802029:	85 c0                	test   %eax,%eax
+  80202b:	78 2a                	js     802057 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80202d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802034:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80203b:	89 f8                	mov    %edi,%eax
+  80203d:	e8 19 fe ff ff       	call   801e5b <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802042:	0b 45 10             	or     0x10(%ebp),%eax
+  802045:	50                   	push   %eax
+  802046:	ff 76 0c             	push   0xc(%esi)
+  802049:	ff 76 08             	push   0x8(%esi)
+  80204c:	53                   	push   %ebx
+  80204d:	e8 d6 07 00 00       	call   802828 <nsipc_recvmsg>
+  802052:	89 c3                	mov    %eax,%ebx
+  802054:	83 c4 10             	add    $0x10,%esp
+}
+  802057:	89 d8                	mov    %ebx,%eax
+  802059:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205c:	5b                   	pop    %ebx
+  80205d:	5e                   	pop    %esi
+  80205e:	5f                   	pop    %edi
+  80205f:	5d                   	pop    %ebp
+  802060:	c3                   	ret
+
+00802061 <sendfile>:
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	56                   	push   %esi
+  802065:	53                   	push   %ebx
+  802066:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802069:	89 f0                	mov    %esi,%eax
+  80206b:	e8 bb fd ff ff       	call   801e2b <fd2sockid>
+  802070:	89 c3                	mov    %eax,%ebx
+  802072:	85 c0                	test   %eax,%eax
+  802074:	78 1f                	js     802095 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802076:	89 f0                	mov    %esi,%eax
+  802078:	e8 de fd ff ff       	call   801e5b <sock_flags>
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	50                   	push   %eax
+  802081:	ff 75 14             	push   0x14(%ebp)
+  802084:	ff 75 10             	push   0x10(%ebp)
+  802087:	ff 75 0c             	push   0xc(%ebp)
+  80208a:	53                   	push   %ebx
+  80208b:	e8 64 06 00 00       	call   8026f4 <nsipc_sendfile>
+  802090:	89 c3                	mov    %eax,%ebx
+  802092:	83 c4 20             	add    $0x20,%esp
+}
+  802095:	89 d8                	mov    %ebx,%eax
+  802097:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209a:	5b                   	pop    %ebx
+  80209b:	5e                   	pop    %esi
+  80209c:	5d                   	pop    %ebp
+  80209d:	c3                   	ret
+
+0080209e <evctl>:
+{
+  80209e:	55                   	push   %ebp
+  80209f:	89 e5                	mov    %esp,%ebp
+  8020a1:	53                   	push   %ebx
+  8020a2:	83 ec 04             	sub    $0x4,%esp
+  8020a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8020a8:	89 d8                	mov    %ebx,%eax
+  8020aa:	e8 7c fd ff ff       	call   801e2b <fd2sockid>
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 10                	js     8020c3 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8020b3:	83 ec 04             	sub    $0x4,%esp
+  8020b6:	53                   	push   %ebx
+  8020b7:	ff 75 0c             	push   0xc(%ebp)
+  8020ba:	50                   	push   %eax
+  8020bb:	e8 d2 0b 00 00       	call   802c92 <nsipc_evctl>
+  8020c0:	83 c4 10             	add    $0x10,%esp
+}
+  8020c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c6:	c9                   	leave
+  8020c7:	c3                   	ret
+
+008020c8 <evwait>:
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8020ce:	ff 75 10             	push   0x10(%ebp)
+  8020d1:	ff 75 0c             	push   0xc(%ebp)
+  8020d4:	ff 75 08             	push   0x8(%ebp)
+  8020d7:	e8 e0 0b 00 00       	call   802cbc <nsipc_evwait>
+}
+  8020dc:	c9                   	leave
+  8020dd:	c3                   	ret
+
+008020de <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8020e4:	ff 75 10             	push   0x10(%ebp)
+  8020e7:	ff 75 0c             	push   0xc(%ebp)
+  8020ea:	ff 75 08             	push   0x8(%ebp)
+  8020ed:	e8 31 0c 00 00       	call   802d23 <nsipc_socket>
+  8020f2:	83 c4 10             	add    $0x10,%esp
+  8020f5:	85 c0                	test   %eax,%eax
+  8020f7:	78 05                	js     8020fe <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8020f9:	e8 89 fd ff ff       	call   801e87 <alloc_sockfd>
+}
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+
+00802100 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	53                   	push   %ebx
+  802104:	83 ec 04             	sub    $0x4,%esp
+  802107:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802109:	83 3d 24 67 80 00 00 	cmpl   $0x0,0x806724
+  802110:	74 26                	je     802138 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802112:	6a 07                	push   $0x7
+  802114:	68 00 80 80 00       	push   $0x808000
+  802119:	53                   	push   %ebx
+  80211a:	ff 35 24 67 80 00    	push   0x806724
+  802120:	e8 58 19 00 00       	call   803a7d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802125:	83 c4 0c             	add    $0xc,%esp
+  802128:	6a 00                	push   $0x0
+  80212a:	6a 00                	push   $0x0
+  80212c:	6a 00                	push   $0x0
+  80212e:	e8 ba 16 00 00       	call   8037ed <ipc_recv>
+}
+  802133:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802138:	83 ec 0c             	sub    $0xc,%esp
+  80213b:	6a 03                	push   $0x3
+  80213d:	e8 a4 19 00 00       	call   803ae6 <ipc_find_env>
+  802142:	a3 24 67 80 00       	mov    %eax,0x806724
+  802147:	83 c4 10             	add    $0x10,%esp
+  80214a:	eb c6                	jmp    802112 <nsipc+0x12>
+
+0080214c <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80214c:	55                   	push   %ebp
+  80214d:	89 e5                	mov    %esp,%ebp
+  80214f:	56                   	push   %esi
+  802150:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802151:	8b 35 30 67 80 00    	mov    0x806730,%esi
+		return 0;
+  802157:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80215c:	85 f6                	test   %esi,%esi
+  80215e:	75 33                	jne    802193 <nsbulk_map+0x47>
+  802160:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802165:	83 ec 04             	sub    $0x4,%esp
+  802168:	6a 07                	push   $0x7
+  80216a:	53                   	push   %ebx
+  80216b:	6a 00                	push   $0x0
+  80216d:	e8 fa ed ff ff       	call   800f6c <sys_page_alloc>
+  802172:	83 c4 10             	add    $0x10,%esp
+  802175:	85 c0                	test   %eax,%eax
+  802177:	78 1a                	js     802193 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802179:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80217f:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802185:	75 de                	jne    802165 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802187:	c7 05 30 67 80 00 01 	movl   $0x1,0x806730
+  80218e:	00 00 00 
+	return 0;
+  802191:	89 f0                	mov    %esi,%eax
+}
+  802193:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802196:	5b                   	pop    %ebx
+  802197:	5e                   	pop    %esi
+  802198:	5d                   	pop    %ebp
+  802199:	c3                   	ret
+
+0080219a <nsbulk_own>:
+{
+  80219a:	55                   	push   %ebp
+  80219b:	89 e5                	mov    %esp,%ebp
+  80219d:	57                   	push   %edi
+  80219e:	56                   	push   %esi
+  80219f:	53                   	push   %ebx
+  8021a0:	83 ec 0c             	sub    $0xc,%esp
+  8021a3:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8021a5:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8021a8:	85 d2                	test   %edx,%edx
+  8021aa:	7f 0e                	jg     8021ba <nsbulk_own+0x20>
+	return 0;
+  8021ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b1:	eb 47                	jmp    8021fa <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8021b3:	83 c3 01             	add    $0x1,%ebx
+  8021b6:	39 fb                	cmp    %edi,%ebx
+  8021b8:	7d 3b                	jge    8021f5 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8021ba:	be 01 00 00 00       	mov    $0x1,%esi
+  8021bf:	89 d9                	mov    %ebx,%ecx
+  8021c1:	d3 e6                	shl    %cl,%esi
+  8021c3:	89 f0                	mov    %esi,%eax
+  8021c5:	23 05 2c 67 80 00    	and    0x80672c,%eax
+  8021cb:	74 e6                	je     8021b3 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8021cd:	83 ec 04             	sub    $0x4,%esp
+  8021d0:	6a 07                	push   $0x7
+  8021d2:	89 d8                	mov    %ebx,%eax
+  8021d4:	c1 e0 0c             	shl    $0xc,%eax
+  8021d7:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8021dc:	50                   	push   %eax
+  8021dd:	6a 00                	push   $0x0
+  8021df:	e8 88 ed ff ff       	call   800f6c <sys_page_alloc>
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	78 0f                	js     8021fa <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8021eb:	f7 d6                	not    %esi
+  8021ed:	21 35 2c 67 80 00    	and    %esi,0x80672c
+  8021f3:	eb be                	jmp    8021b3 <nsbulk_own+0x19>
+	return 0;
+  8021f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5f                   	pop    %edi
+  802200:	5d                   	pop    %ebp
+  802201:	c3                   	ret
+
+00802202 <nsipc_bulk>:
+{
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	57                   	push   %edi
+  802206:	56                   	push   %esi
+  802207:	53                   	push   %ebx
+  802208:	83 ec 1c             	sub    $0x1c,%esp
+  80220b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80220e:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802210:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802216:	c1 fb 0c             	sar    $0xc,%ebx
+  802219:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80221c:	83 3d 24 67 80 00 00 	cmpl   $0x0,0x806724
+  802223:	74 56                	je     80227b <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802225:	85 ff                	test   %edi,%edi
+  802227:	7e 24                	jle    80224d <nsipc_bulk+0x4b>
+  802229:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80222f:	74 1c                	je     80224d <nsipc_bulk+0x4b>
+  802231:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802237:	c1 e3 0c             	shl    $0xc,%ebx
+  80223a:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80223f:	0f b6 10             	movzbl (%eax),%edx
+  802242:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802244:	05 00 10 00 00       	add    $0x1000,%eax
+  802249:	39 d8                	cmp    %ebx,%eax
+  80224b:	75 f2                	jne    80223f <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80224d:	83 ec 0c             	sub    $0xc,%esp
+  802250:	56                   	push   %esi
+  802251:	57                   	push   %edi
+  802252:	68 00 00 00 e0       	push   $0xe0000000
+  802257:	ff 75 e4             	push   -0x1c(%ebp)
+  80225a:	ff 35 24 67 80 00    	push   0x806724
+  802260:	e8 4c 18 00 00       	call   803ab1 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802265:	83 c4 1c             	add    $0x1c,%esp
+  802268:	6a 00                	push   $0x0
+  80226a:	6a 00                	push   $0x0
+  80226c:	6a 00                	push   $0x0
+  80226e:	e8 7a 15 00 00       	call   8037ed <ipc_recv>
+}
+  802273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802276:	5b                   	pop    %ebx
+  802277:	5e                   	pop    %esi
+  802278:	5f                   	pop    %edi
+  802279:	5d                   	pop    %ebp
+  80227a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	6a 03                	push   $0x3
+  802280:	e8 61 18 00 00       	call   803ae6 <ipc_find_env>
+  802285:	a3 24 67 80 00       	mov    %eax,0x806724
+  80228a:	83 c4 10             	add    $0x10,%esp
+  80228d:	eb 96                	jmp    802225 <nsipc_bulk+0x23>
+
+0080228f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  80228f:	55                   	push   %ebp
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	53                   	push   %ebx
+  802293:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802296:	8b 45 08             	mov    0x8(%ebp),%eax
+  802299:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  80229e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022a1:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8022a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ab:	e8 50 fe ff ff       	call   802100 <nsipc>
+  8022b0:	89 c3                	mov    %eax,%ebx
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	79 07                	jns    8022bd <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022b6:	89 d8                	mov    %ebx,%eax
+  8022b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bb:	c9                   	leave
+  8022bc:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022bd:	83 ec 04             	sub    $0x4,%esp
+  8022c0:	ff 35 10 80 80 00    	push   0x808010
+  8022c6:	68 00 80 80 00       	push   $0x808000
+  8022cb:	ff 75 0c             	push   0xc(%ebp)
+  8022ce:	e8 15 ea ff ff       	call   800ce8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022d3:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8022d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022dc:	89 10                	mov    %edx,(%eax)
+  8022de:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022e1:	eb d3                	jmp    8022b6 <nsipc_accept+0x27>
+
+008022e3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022e3:	55                   	push   %ebp
+  8022e4:	89 e5                	mov    %esp,%ebp
+  8022e6:	53                   	push   %ebx
+  8022e7:	83 ec 08             	sub    $0x8,%esp
+  8022ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f0:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022f5:	53                   	push   %ebx
+  8022f6:	ff 75 0c             	push   0xc(%ebp)
+  8022f9:	68 04 80 80 00       	push   $0x808004
+  8022fe:	e8 e5 e9 ff ff       	call   800ce8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802303:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802309:	b8 02 00 00 00       	mov    $0x2,%eax
+  80230e:	e8 ed fd ff ff       	call   802100 <nsipc>
+}
+  802313:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802316:	c9                   	leave
+  802317:	c3                   	ret
+
+00802318 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802318:	55                   	push   %ebp
+  802319:	89 e5                	mov    %esp,%ebp
+  80231b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80231e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802321:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802326:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802329:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80232e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802333:	e8 c8 fd ff ff       	call   802100 <nsipc>
+}
+  802338:	c9                   	leave
+  802339:	c3                   	ret
+
+0080233a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802340:	8b 45 08             	mov    0x8(%ebp),%eax
+  802343:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802348:	b8 04 00 00 00       	mov    $0x4,%eax
+  80234d:	e8 ae fd ff ff       	call   802100 <nsipc>
+}
+  802352:	c9                   	leave
+  802353:	c3                   	ret
+
+00802354 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802354:	55                   	push   %ebp
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	53                   	push   %ebx
+  802358:	83 ec 08             	sub    $0x8,%esp
+  80235b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80235e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802361:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802366:	53                   	push   %ebx
+  802367:	ff 75 0c             	push   0xc(%ebp)
+  80236a:	68 04 80 80 00       	push   $0x808004
+  80236f:	e8 74 e9 ff ff       	call   800ce8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802374:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80237a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80237f:	e8 7c fd ff ff       	call   802100 <nsipc>
+}
+  802384:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802387:	c9                   	leave
+  802388:	c3                   	ret
+
+00802389 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80238f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802392:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802397:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80239a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80239f:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023a4:	e8 57 fd ff ff       	call   802100 <nsipc>
+}
+  8023a9:	c9                   	leave
+  8023aa:	c3                   	ret
+
+008023ab <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8023ab:	55                   	push   %ebp
+  8023ac:	89 e5                	mov    %esp,%ebp
+  8023ae:	56                   	push   %esi
+  8023af:	53                   	push   %ebx
+  8023b0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8023b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8023bb:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8023c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023c4:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023c9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023ce:	e8 2d fd ff ff       	call   802100 <nsipc>
+  8023d3:	89 c3                	mov    %eax,%ebx
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	78 22                	js     8023fb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023d9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023de:	39 c6                	cmp    %eax,%esi
+  8023e0:	0f 4e c6             	cmovle %esi,%eax
+  8023e3:	39 c3                	cmp    %eax,%ebx
+  8023e5:	7f 1d                	jg     802404 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023e7:	83 ec 04             	sub    $0x4,%esp
+  8023ea:	53                   	push   %ebx
+  8023eb:	68 00 80 80 00       	push   $0x808000
+  8023f0:	ff 75 0c             	push   0xc(%ebp)
+  8023f3:	e8 f0 e8 ff ff       	call   800ce8 <memmove>
+  8023f8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023fb:	89 d8                	mov    %ebx,%eax
+  8023fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5d                   	pop    %ebp
+  802403:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802404:	68 d4 45 80 00       	push   $0x8045d4
+  802409:	68 e9 45 80 00       	push   $0x8045e9
+  80240e:	68 b2 00 00 00       	push   $0xb2
+  802413:	68 fe 45 80 00       	push   $0x8045fe
+  802418:	e8 8a 13 00 00       	call   8037a7 <_panic>
+
+0080241d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80241d:	55                   	push   %ebp
+  80241e:	89 e5                	mov    %esp,%ebp
+  802420:	53                   	push   %ebx
+  802421:	83 ec 04             	sub    $0x4,%esp
+  802424:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802427:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242a:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80242f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802435:	7f 2e                	jg     802465 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802437:	83 ec 04             	sub    $0x4,%esp
+  80243a:	53                   	push   %ebx
+  80243b:	ff 75 0c             	push   0xc(%ebp)
+  80243e:	68 0c 80 80 00       	push   $0x80800c
+  802443:	e8 a0 e8 ff ff       	call   800ce8 <memmove>
+	nsipcbuf.send.req_size = size;
+  802448:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80244e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802451:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802456:	b8 08 00 00 00       	mov    $0x8,%eax
+  80245b:	e8 a0 fc ff ff       	call   802100 <nsipc>
+}
+  802460:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802463:	c9                   	leave
+  802464:	c3                   	ret
+	assert(size < 1600);
+  802465:	68 0a 46 80 00       	push   $0x80460a
+  80246a:	68 e9 45 80 00       	push   $0x8045e9
+  80246f:	68 bd 00 00 00       	push   $0xbd
+  802474:	68 fe 45 80 00       	push   $0x8045fe
+  802479:	e8 29 13 00 00       	call   8037a7 <_panic>
+
+0080247e <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80247e:	55                   	push   %ebp
+  80247f:	89 e5                	mov    %esp,%ebp
+  802481:	57                   	push   %edi
+  802482:	56                   	push   %esi
+  802483:	53                   	push   %ebx
+  802484:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802487:	e8 c0 fc ff ff       	call   80214c <nsbulk_map>
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 55                	js     8024e5 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802490:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802497:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  80249e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024a5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024a8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024ab:	0f 8d 24 02 00 00    	jge    8026d5 <nsipc_sendmsg+0x257>
+  8024b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024b4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024b7:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8024ba:	89 d8                	mov    %ebx,%eax
+  8024bc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024c1:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8024c3:	83 ec 0c             	sub    $0xc,%esp
+  8024c6:	68 20 64 80 00       	push   $0x806420
+  8024cb:	e8 5a 0f 00 00       	call   80342a <pgbatch_init>
+  8024d0:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024d3:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8024d5:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8024d8:	e9 82 00 00 00       	jmp    80255f <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8024dd:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024e0:	85 db                	test   %ebx,%ebx
+  8024e2:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8024e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e8:	5b                   	pop    %ebx
+  8024e9:	5e                   	pop    %esi
+  8024ea:	5f                   	pop    %edi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8024ed:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024f2:	29 c8                	sub    %ecx,%eax
+  8024f4:	39 d0                	cmp    %edx,%eax
+  8024f6:	0f 46 d0             	cmovbe %eax,%edx
+  8024f9:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8024fb:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802501:	85 ff                	test   %edi,%edi
+  802503:	0f 49 c7             	cmovns %edi,%eax
+  802506:	c1 f8 0c             	sar    $0xc,%eax
+  802509:	ba 01 00 00 00       	mov    $0x1,%edx
+  80250e:	e8 87 fc ff ff       	call   80219a <nsbulk_own>
+  802513:	85 c0                	test   %eax,%eax
+  802515:	0f 88 17 01 00 00    	js     802632 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80251b:	83 ec 04             	sub    $0x4,%esp
+  80251e:	56                   	push   %esi
+  80251f:	ff 75 e0             	push   -0x20(%ebp)
+  802522:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802525:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80252a:	50                   	push   %eax
+  80252b:	e8 b8 e7 ff ff       	call   800ce8 <memmove>
+  802530:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802533:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802536:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802539:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80253c:	0f 84 fd 00 00 00    	je     80263f <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802542:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802545:	01 f7                	add    %esi,%edi
+  802547:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80254a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80254d:	0f 8d 01 01 00 00    	jge    802654 <nsipc_sendmsg+0x1d6>
+  802553:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802559:	0f 8f f0 00 00 00    	jg     80264f <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80255f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802562:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802565:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802568:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80256b:	89 c2                	mov    %eax,%edx
+  80256d:	03 13                	add    (%ebx),%edx
+  80256f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802572:	8b 73 04             	mov    0x4(%ebx),%esi
+  802575:	29 c6                	sub    %eax,%esi
+  802577:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  80257c:	29 f9                	sub    %edi,%ecx
+  80257e:	39 ce                	cmp    %ecx,%esi
+  802580:	89 ca                	mov    %ecx,%edx
+  802582:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802585:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802588:	89 f9                	mov    %edi,%ecx
+  80258a:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802590:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802593:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802598:	09 c8                	or     %ecx,%eax
+  80259a:	0f 85 4d ff ff ff    	jne    8024ed <nsipc_sendmsg+0x6f>
+  8025a0:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8025a6:	0f 86 41 ff ff ff    	jbe    8024ed <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025ac:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8025b2:	85 ff                	test   %edi,%edi
+  8025b4:	0f 49 c7             	cmovns %edi,%eax
+  8025b7:	c1 f8 0c             	sar    $0xc,%eax
+  8025ba:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8025bc:	89 d1                	mov    %edx,%ecx
+  8025be:	c1 e9 0c             	shr    $0xc,%ecx
+  8025c1:	01 c8                	add    %ecx,%eax
+  8025c3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025c6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025c9:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8025cb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025ce:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8025d3:	29 c8                	sub    %ecx,%eax
+  8025d5:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8025d8:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8025db:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025e2:	89 f9                	mov    %edi,%ecx
+  8025e4:	d3 e0                	shl    %cl,%eax
+  8025e6:	09 05 2c 67 80 00    	or     %eax,0x80672c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8025ec:	83 ec 08             	sub    $0x8,%esp
+  8025ef:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8025f1:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8025f4:	50                   	push   %eax
+  8025f5:	6a 00                	push   $0x0
+  8025f7:	56                   	push   %esi
+  8025f8:	6a 00                	push   $0x0
+  8025fa:	68 20 64 80 00       	push   $0x806420
+  8025ff:	e8 e4 0e 00 00       	call   8034e8 <pgbatch_map>
+  802604:	83 c4 20             	add    $0x20,%esp
+  802607:	85 c0                	test   %eax,%eax
+  802609:	0f 88 ce fe ff ff    	js     8024dd <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80260f:	83 c7 01             	add    $0x1,%edi
+  802612:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802618:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80261b:	39 c7                	cmp    %eax,%edi
+  80261d:	75 be                	jne    8025dd <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80261f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802622:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802625:	89 d6                	mov    %edx,%esi
+  802627:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80262d:	e9 01 ff ff ff       	jmp    802533 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802632:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802635:	85 db                	test   %ebx,%ebx
+  802637:	0f 45 c3             	cmovne %ebx,%eax
+  80263a:	e9 a6 fe ff ff       	jmp    8024e5 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80263f:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802643:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80264a:	e9 f3 fe ff ff       	jmp    802542 <nsipc_sendmsg+0xc4>
+  80264f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802652:	eb 03                	jmp    802657 <nsipc_sendmsg+0x1d9>
+  802654:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802657:	83 ec 0c             	sub    $0xc,%esp
+  80265a:	68 20 64 80 00       	push   $0x806420
+  80265f:	e8 d4 0d 00 00       	call   803438 <pgbatch_flush>
+  802664:	83 c4 10             	add    $0x10,%esp
+  802667:	85 c0                	test   %eax,%eax
+  802669:	78 50                	js     8026bb <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  80266b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80266e:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802673:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802679:	89 fb                	mov    %edi,%ebx
+  80267b:	29 f3                	sub    %esi,%ebx
+  80267d:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802683:	8b 45 14             	mov    0x14(%ebp),%eax
+  802686:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  80268b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802690:	89 fa                	mov    %edi,%edx
+  802692:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802697:	e8 66 fb ff ff       	call   802202 <nsipc_bulk>
+  80269c:	85 c0                	test   %eax,%eax
+  80269e:	78 28                	js     8026c8 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8026a0:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8026a3:	39 c3                	cmp    %eax,%ebx
+  8026a5:	75 0c                	jne    8026b3 <nsipc_sendmsg+0x235>
+  8026a7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026aa:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8026ad:	0f 8f f2 fd ff ff    	jg     8024a5 <nsipc_sendmsg+0x27>
+		sent += r;
+  8026b3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8026b6:	e9 2a fe ff ff       	jmp    8024e5 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8026bb:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026be:	85 db                	test   %ebx,%ebx
+  8026c0:	0f 45 c3             	cmovne %ebx,%eax
+  8026c3:	e9 1d fe ff ff       	jmp    8024e5 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8026c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026cb:	85 db                	test   %ebx,%ebx
+  8026cd:	0f 45 c3             	cmovne %ebx,%eax
+  8026d0:	e9 10 fe ff ff       	jmp    8024e5 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8026d5:	83 ec 0c             	sub    $0xc,%esp
+  8026d8:	68 20 64 80 00       	push   $0x806420
+  8026dd:	e8 48 0d 00 00       	call   80342a <pgbatch_init>
+  8026e2:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8026e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ef:	e9 63 ff ff ff       	jmp    802657 <nsipc_sendmsg+0x1d9>
+
+008026f4 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8026f4:	55                   	push   %ebp
+  8026f5:	89 e5                	mov    %esp,%ebp
+  8026f7:	57                   	push   %edi
+  8026f8:	56                   	push   %esi
+  8026f9:	53                   	push   %ebx
+  8026fa:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8026fd:	83 3d 28 67 80 00 00 	cmpl   $0x0,0x806728
+  802704:	0f 84 c8 00 00 00    	je     8027d2 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80270a:	83 3d 24 67 80 00 00 	cmpl   $0x0,0x806724
+  802711:	0f 84 e4 00 00 00    	je     8027fb <nsipc_sendfile+0x107>
+{
+  802717:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80271c:	89 fb                	mov    %edi,%ebx
+  80271e:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802721:	0f 83 f0 00 00 00    	jae    802817 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802727:	89 fa                	mov    %edi,%edx
+  802729:	03 55 10             	add    0x10(%ebp),%edx
+  80272c:	89 d0                	mov    %edx,%eax
+  80272e:	c1 f8 1f             	sar    $0x1f,%eax
+  802731:	c1 e8 14             	shr    $0x14,%eax
+  802734:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802737:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80273d:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80273f:	6a 10                	push   $0x10
+  802741:	68 00 20 01 e0       	push   $0xe0012000
+  802746:	52                   	push   %edx
+  802747:	ff 75 0c             	push   0xc(%ebp)
+  80274a:	e8 fe f4 ff ff       	call   801c4d <fmap>
+  80274f:	83 c4 10             	add    $0x10,%esp
+  802752:	85 c0                	test   %eax,%eax
+  802754:	0f 8e b8 00 00 00    	jle    802812 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80275a:	39 c6                	cmp    %eax,%esi
+  80275c:	0f 8d b5 00 00 00    	jge    802817 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802762:	29 f0                	sub    %esi,%eax
+  802764:	8b 55 14             	mov    0x14(%ebp),%edx
+  802767:	29 da                	sub    %ebx,%edx
+  802769:	39 d0                	cmp    %edx,%eax
+  80276b:	89 d3                	mov    %edx,%ebx
+  80276d:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802770:	8b 45 08             	mov    0x8(%ebp),%eax
+  802773:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802778:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80277e:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802784:	8b 45 18             	mov    0x18(%ebp),%eax
+  802787:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80278c:	83 ec 0c             	sub    $0xc,%esp
+  80278f:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802791:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802798:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80279b:	83 c0 01             	add    $0x1,%eax
+  80279e:	50                   	push   %eax
+  80279f:	68 00 10 01 e0       	push   $0xe0011000
+  8027a4:	6a 11                	push   $0x11
+  8027a6:	ff 35 24 67 80 00    	push   0x806724
+  8027ac:	e8 00 13 00 00       	call   803ab1 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8027b1:	83 c4 1c             	add    $0x1c,%esp
+  8027b4:	6a 00                	push   $0x0
+  8027b6:	6a 00                	push   $0x0
+  8027b8:	6a 00                	push   $0x0
+  8027ba:	e8 2e 10 00 00       	call   8037ed <ipc_recv>
+  8027bf:	83 c4 10             	add    $0x10,%esp
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	78 5b                	js     802821 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8027c6:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8027c8:	39 c3                	cmp    %eax,%ebx
+  8027ca:	0f 8e 4c ff ff ff    	jle    80271c <nsipc_sendfile+0x28>
+  8027d0:	eb 45                	jmp    802817 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8027d2:	83 ec 04             	sub    $0x4,%esp
+  8027d5:	6a 07                	push   $0x7
+  8027d7:	68 00 10 01 e0       	push   $0xe0011000
+  8027dc:	6a 00                	push   $0x0
+  8027de:	e8 89 e7 ff ff       	call   800f6c <sys_page_alloc>
+  8027e3:	89 c7                	mov    %eax,%edi
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	78 2b                	js     802817 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8027ec:	c7 05 28 67 80 00 01 	movl   $0x1,0x806728
+  8027f3:	00 00 00 
+  8027f6:	e9 0f ff ff ff       	jmp    80270a <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8027fb:	83 ec 0c             	sub    $0xc,%esp
+  8027fe:	6a 03                	push   $0x3
+  802800:	e8 e1 12 00 00       	call   803ae6 <ipc_find_env>
+  802805:	a3 24 67 80 00       	mov    %eax,0x806724
+  80280a:	83 c4 10             	add    $0x10,%esp
+  80280d:	e9 05 ff ff ff       	jmp    802717 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802812:	85 ff                	test   %edi,%edi
+  802814:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802817:	89 f8                	mov    %edi,%eax
+  802819:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80281c:	5b                   	pop    %ebx
+  80281d:	5e                   	pop    %esi
+  80281e:	5f                   	pop    %edi
+  80281f:	5d                   	pop    %ebp
+  802820:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802821:	85 ff                	test   %edi,%edi
+  802823:	0f 44 f8             	cmove  %eax,%edi
+  802826:	eb ef                	jmp    802817 <nsipc_sendfile+0x123>
+
+00802828 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802828:	55                   	push   %ebp
+  802829:	89 e5                	mov    %esp,%ebp
+  80282b:	57                   	push   %edi
+  80282c:	56                   	push   %esi
+  80282d:	53                   	push   %ebx
+  80282e:	83 ec 1c             	sub    $0x1c,%esp
+  802831:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802834:	e8 13 f9 ff ff       	call   80214c <nsbulk_map>
+  802839:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80283c:	85 c0                	test   %eax,%eax
+  80283e:	0f 88 ba 00 00 00    	js     8028fe <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802844:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802848:	0f 8e bb 00 00 00    	jle    802909 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80284e:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802853:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802858:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80285d:	89 f8                	mov    %edi,%eax
+  80285f:	29 f0                	sub    %esi,%eax
+  802861:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802865:	39 c8                	cmp    %ecx,%eax
+  802867:	0f 47 c1             	cmova  %ecx,%eax
+  80286a:	01 f0                	add    %esi,%eax
+  80286c:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80286e:	83 c2 01             	add    $0x1,%edx
+  802871:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802874:	7e 07                	jle    80287d <nsipc_recvmsg+0x55>
+  802876:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80287b:	7e e0                	jle    80285d <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80287d:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802883:	c1 fa 0c             	sar    $0xc,%edx
+  802886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288b:	e8 0a f9 ff ff       	call   80219a <nsbulk_own>
+  802890:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802893:	85 c0                	test   %eax,%eax
+  802895:	78 67                	js     8028fe <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289a:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80289f:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8028a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028a8:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8028ad:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8028b2:	89 f2                	mov    %esi,%edx
+  8028b4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8028b9:	e8 44 f9 ff ff       	call   802202 <nsipc_bulk>
+  8028be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028c1:	85 c0                	test   %eax,%eax
+  8028c3:	78 39                	js     8028fe <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8028c5:	39 f0                	cmp    %esi,%eax
+  8028c7:	7f 4a                	jg     802913 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8028c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ce:	85 c0                	test   %eax,%eax
+  8028d0:	7e 2c                	jle    8028fe <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8028d2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8028d5:	29 fe                	sub    %edi,%esi
+  8028d7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028da:	39 c6                	cmp    %eax,%esi
+  8028dc:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8028df:	83 ec 04             	sub    $0x4,%esp
+  8028e2:	56                   	push   %esi
+  8028e3:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8028e9:	50                   	push   %eax
+  8028ea:	ff 33                	push   (%ebx)
+  8028ec:	e8 f7 e3 ff ff       	call   800ce8 <memmove>
+		n += m;
+  8028f1:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8028f3:	83 c3 08             	add    $0x8,%ebx
+  8028f6:	83 c4 10             	add    $0x10,%esp
+  8028f9:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8028fc:	7f d4                	jg     8028d2 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8028fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802901:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802904:	5b                   	pop    %ebx
+  802905:	5e                   	pop    %esi
+  802906:	5f                   	pop    %edi
+  802907:	5d                   	pop    %ebp
+  802908:	c3                   	ret
+	int r, i, n, len = 0;
+  802909:	be 00 00 00 00       	mov    $0x0,%esi
+  80290e:	e9 6a ff ff ff       	jmp    80287d <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802913:	68 e0 45 80 00       	push   $0x8045e0
+  802918:	68 e9 45 80 00       	push   $0x8045e9
+  80291d:	68 3b 01 00 00       	push   $0x13b
+  802922:	68 fe 45 80 00       	push   $0x8045fe
+  802927:	e8 7b 0e 00 00       	call   8037a7 <_panic>
+
+0080292c <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80292c:	55                   	push   %ebp
+  80292d:	89 e5                	mov    %esp,%ebp
+  80292f:	57                   	push   %edi
+  802930:	56                   	push   %esi
+  802931:	53                   	push   %ebx
+  802932:	83 ec 0c             	sub    $0xc,%esp
+  802935:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802938:	8b 75 10             	mov    0x10(%ebp),%esi
+  80293b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80293e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802941:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802946:	8b 07                	mov    (%edi),%eax
+  802948:	a3 04 80 80 00       	mov    %eax,0x808004
+  80294d:	8b 47 04             	mov    0x4(%edi),%eax
+  802950:	a3 08 80 80 00       	mov    %eax,0x808008
+  802955:	8b 47 08             	mov    0x8(%edi),%eax
+  802958:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  80295d:	8b 47 0c             	mov    0xc(%edi),%eax
+  802960:	a3 10 80 80 00       	mov    %eax,0x808010
+  802965:	8b 47 10             	mov    0x10(%edi),%eax
+  802968:	a3 14 80 80 00       	mov    %eax,0x808014
+  80296d:	8b 47 14             	mov    0x14(%edi),%eax
+  802970:	a3 18 80 80 00       	mov    %eax,0x808018
+  802975:	8b 47 18             	mov    0x18(%edi),%eax
+  802978:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  80297d:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802980:	a3 20 80 80 00       	mov    %eax,0x808020
+  802985:	8b 47 20             	mov    0x20(%edi),%eax
+  802988:	a3 24 80 80 00       	mov    %eax,0x808024
+  80298d:	8b 47 24             	mov    0x24(%edi),%eax
+  802990:	a3 28 80 80 00       	mov    %eax,0x808028
+  802995:	8b 47 28             	mov    0x28(%edi),%eax
+  802998:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80299d:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8029a0:	a3 30 80 80 00       	mov    %eax,0x808030
+  8029a5:	8b 47 30             	mov    0x30(%edi),%eax
+  8029a8:	a3 34 80 80 00       	mov    %eax,0x808034
+  8029ad:	8b 47 34             	mov    0x34(%edi),%eax
+  8029b0:	a3 38 80 80 00       	mov    %eax,0x808038
+  8029b5:	8b 47 38             	mov    0x38(%edi),%eax
+  8029b8:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8029bd:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8029c0:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8029c5:	8b 06                	mov    (%esi),%eax
+  8029c7:	a3 44 80 80 00       	mov    %eax,0x808044
+  8029cc:	8b 46 04             	mov    0x4(%esi),%eax
+  8029cf:	a3 48 80 80 00       	mov    %eax,0x808048
+  8029d4:	8b 46 08             	mov    0x8(%esi),%eax
+  8029d7:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8029dc:	8b 46 0c             	mov    0xc(%esi),%eax
+  8029df:	a3 50 80 80 00       	mov    %eax,0x808050
+  8029e4:	8b 46 10             	mov    0x10(%esi),%eax
+  8029e7:	a3 54 80 80 00       	mov    %eax,0x808054
+  8029ec:	8b 46 14             	mov    0x14(%esi),%eax
+  8029ef:	a3 58 80 80 00       	mov    %eax,0x808058
+  8029f4:	8b 46 18             	mov    0x18(%esi),%eax
+  8029f7:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8029fc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8029ff:	a3 60 80 80 00       	mov    %eax,0x808060
+  802a04:	8b 46 20             	mov    0x20(%esi),%eax
+  802a07:	a3 64 80 80 00       	mov    %eax,0x808064
+  802a0c:	8b 46 24             	mov    0x24(%esi),%eax
+  802a0f:	a3 68 80 80 00       	mov    %eax,0x808068
+  802a14:	8b 46 28             	mov    0x28(%esi),%eax
+  802a17:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802a1c:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802a1f:	a3 70 80 80 00       	mov    %eax,0x808070
+  802a24:	8b 46 30             	mov    0x30(%esi),%eax
+  802a27:	a3 74 80 80 00       	mov    %eax,0x808074
+  802a2c:	8b 46 34             	mov    0x34(%esi),%eax
+  802a2f:	a3 78 80 80 00       	mov    %eax,0x808078
+  802a34:	8b 46 38             	mov    0x38(%esi),%eax
+  802a37:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802a3c:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802a3f:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802a44:	8b 03                	mov    (%ebx),%eax
+  802a46:	a3 84 80 80 00       	mov    %eax,0x808084
+  802a4b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a4e:	a3 88 80 80 00       	mov    %eax,0x808088
+  802a53:	8b 43 08             	mov    0x8(%ebx),%eax
+  802a56:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802a5b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802a5e:	a3 90 80 80 00       	mov    %eax,0x808090
+  802a63:	8b 43 10             	mov    0x10(%ebx),%eax
+  802a66:	a3 94 80 80 00       	mov    %eax,0x808094
+  802a6b:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a6e:	a3 98 80 80 00       	mov    %eax,0x808098
+  802a73:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a76:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802a7b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802a7e:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802a83:	8b 43 20             	mov    0x20(%ebx),%eax
+  802a86:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802a8b:	8b 43 24             	mov    0x24(%ebx),%eax
+  802a8e:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802a93:	8b 43 28             	mov    0x28(%ebx),%eax
+  802a96:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802a9b:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802a9e:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802aa3:	8b 43 30             	mov    0x30(%ebx),%eax
+  802aa6:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802aab:	8b 43 34             	mov    0x34(%ebx),%eax
+  802aae:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802ab3:	8b 43 38             	mov    0x38(%ebx),%eax
+  802ab6:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802abb:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802abe:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802ac3:	8b 45 18             	mov    0x18(%ebp),%eax
+  802ac6:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802acb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802ad0:	e8 2b f6 ff ff       	call   802100 <nsipc>
+  802ad5:	85 c0                	test   %eax,%eax
+  802ad7:	0f 88 ad 01 00 00    	js     802c8a <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802add:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802ae3:	89 17                	mov    %edx,(%edi)
+  802ae5:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802aeb:	89 57 04             	mov    %edx,0x4(%edi)
+  802aee:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802af4:	89 57 08             	mov    %edx,0x8(%edi)
+  802af7:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802afd:	89 57 0c             	mov    %edx,0xc(%edi)
+  802b00:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802b06:	89 57 10             	mov    %edx,0x10(%edi)
+  802b09:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802b0f:	89 57 14             	mov    %edx,0x14(%edi)
+  802b12:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802b18:	89 57 18             	mov    %edx,0x18(%edi)
+  802b1b:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802b21:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802b24:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802b2a:	89 57 20             	mov    %edx,0x20(%edi)
+  802b2d:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802b33:	89 57 24             	mov    %edx,0x24(%edi)
+  802b36:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802b3c:	89 57 28             	mov    %edx,0x28(%edi)
+  802b3f:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802b45:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802b48:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802b4e:	89 57 30             	mov    %edx,0x30(%edi)
+  802b51:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802b57:	89 57 34             	mov    %edx,0x34(%edi)
+  802b5a:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802b60:	89 57 38             	mov    %edx,0x38(%edi)
+  802b63:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802b69:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802b6c:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802b72:	89 16                	mov    %edx,(%esi)
+  802b74:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802b7a:	89 56 04             	mov    %edx,0x4(%esi)
+  802b7d:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802b83:	89 56 08             	mov    %edx,0x8(%esi)
+  802b86:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802b8c:	89 56 0c             	mov    %edx,0xc(%esi)
+  802b8f:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802b95:	89 56 10             	mov    %edx,0x10(%esi)
+  802b98:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802b9e:	89 56 14             	mov    %edx,0x14(%esi)
+  802ba1:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802ba7:	89 56 18             	mov    %edx,0x18(%esi)
+  802baa:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802bb0:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802bb3:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802bb9:	89 56 20             	mov    %edx,0x20(%esi)
+  802bbc:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802bc2:	89 56 24             	mov    %edx,0x24(%esi)
+  802bc5:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802bcb:	89 56 28             	mov    %edx,0x28(%esi)
+  802bce:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802bd4:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802bd7:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802bdd:	89 56 30             	mov    %edx,0x30(%esi)
+  802be0:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802be6:	89 56 34             	mov    %edx,0x34(%esi)
+  802be9:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802bef:	89 56 38             	mov    %edx,0x38(%esi)
+  802bf2:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802bf8:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802bfb:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802c01:	89 13                	mov    %edx,(%ebx)
+  802c03:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802c09:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c0c:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802c12:	89 53 08             	mov    %edx,0x8(%ebx)
+  802c15:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802c1b:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802c1e:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802c24:	89 53 10             	mov    %edx,0x10(%ebx)
+  802c27:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802c2d:	89 53 14             	mov    %edx,0x14(%ebx)
+  802c30:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802c36:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c39:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802c3f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802c42:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802c48:	89 53 20             	mov    %edx,0x20(%ebx)
+  802c4b:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802c51:	89 53 24             	mov    %edx,0x24(%ebx)
+  802c54:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802c5a:	89 53 28             	mov    %edx,0x28(%ebx)
+  802c5d:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802c63:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802c66:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802c6c:	89 53 30             	mov    %edx,0x30(%ebx)
+  802c6f:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802c75:	89 53 34             	mov    %edx,0x34(%ebx)
+  802c78:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802c7e:	89 53 38             	mov    %edx,0x38(%ebx)
+  802c81:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802c87:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802c8a:	83 c4 0c             	add    $0xc,%esp
+  802c8d:	5b                   	pop    %ebx
+  802c8e:	5e                   	pop    %esi
+  802c8f:	5f                   	pop    %edi
+  802c90:	5d                   	pop    %ebp
+  802c91:	c3                   	ret
+
+00802c92 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802c92:	55                   	push   %ebp
+  802c93:	89 e5                	mov    %esp,%ebp
+  802c95:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802c98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802ca0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ca3:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802ca8:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cab:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802cb0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802cb5:	e8 46 f4 ff ff       	call   802100 <nsipc>
+}
+  802cba:	c9                   	leave
+  802cbb:	c3                   	ret
+
+00802cbc <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802cbc:	55                   	push   %ebp
+  802cbd:	89 e5                	mov    %esp,%ebp
+  802cbf:	56                   	push   %esi
+  802cc0:	53                   	push   %ebx
+  802cc1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802cc4:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802cca:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ccd:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802cd2:	b8 10 00 00 00       	mov    $0x10,%eax
+  802cd7:	e8 24 f4 ff ff       	call   802100 <nsipc>
+  802cdc:	89 c3                	mov    %eax,%ebx
+  802cde:	85 c0                	test   %eax,%eax
+  802ce0:	7e 1f                	jle    802d01 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802ce2:	39 c6                	cmp    %eax,%esi
+  802ce4:	7c 24                	jl     802d0a <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802ce6:	83 ec 04             	sub    $0x4,%esp
+  802ce9:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802cf0:	50                   	push   %eax
+  802cf1:	68 00 80 80 00       	push   $0x808000
+  802cf6:	ff 75 08             	push   0x8(%ebp)
+  802cf9:	e8 ea df ff ff       	call   800ce8 <memmove>
+  802cfe:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802d01:	89 d8                	mov    %ebx,%eax
+  802d03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d06:	5b                   	pop    %ebx
+  802d07:	5e                   	pop    %esi
+  802d08:	5d                   	pop    %ebp
+  802d09:	c3                   	ret
+		assert(r <= max);
+  802d0a:	68 16 46 80 00       	push   $0x804616
+  802d0f:	68 e9 45 80 00       	push   $0x8045e9
+  802d14:	68 6a 01 00 00       	push   $0x16a
+  802d19:	68 fe 45 80 00       	push   $0x8045fe
+  802d1e:	e8 84 0a 00 00       	call   8037a7 <_panic>
+
+00802d23 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d23:	55                   	push   %ebp
+  802d24:	89 e5                	mov    %esp,%ebp
+  802d26:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802d31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d34:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d39:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d3c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802d41:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d46:	e8 b5 f3 ff ff       	call   802100 <nsipc>
+}
+  802d4b:	c9                   	leave
+  802d4c:	c3                   	ret
+
+00802d4d <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802d4d:	55                   	push   %ebp
+  802d4e:	89 e5                	mov    %esp,%ebp
+  802d50:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802d53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d56:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802d5b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802d60:	e8 9b f3 ff ff       	call   802100 <nsipc>
+}
+  802d65:	c9                   	leave
+  802d66:	c3                   	ret
+
+00802d67 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802d67:	55                   	push   %ebp
+  802d68:	89 e5                	mov    %esp,%ebp
+  802d6a:	53                   	push   %ebx
+  802d6b:	83 ec 04             	sub    $0x4,%esp
+  802d6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802d71:	b8 12 00 00 00       	mov    $0x12,%eax
+  802d76:	e8 85 f3 ff ff       	call   802100 <nsipc>
+  802d7b:	85 c0                	test   %eax,%eax
+  802d7d:	78 50                	js     802dcf <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802d7f:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802d85:	89 13                	mov    %edx,(%ebx)
+  802d87:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802d8d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802d90:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802d96:	89 53 08             	mov    %edx,0x8(%ebx)
+  802d99:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802d9f:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802da2:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802da8:	89 53 10             	mov    %edx,0x10(%ebx)
+  802dab:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802db1:	89 53 14             	mov    %edx,0x14(%ebx)
+  802db4:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802dba:	89 53 18             	mov    %edx,0x18(%ebx)
+  802dbd:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802dc3:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802dc6:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802dcc:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802dcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dd2:	c9                   	leave
+  802dd3:	c3                   	ret
+
+00802dd4 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802dd4:	55                   	push   %ebp
+  802dd5:	89 e5                	mov    %esp,%ebp
+  802dd7:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802dda:	6a 03                	push   $0x3
+  802ddc:	e8 05 0d 00 00       	call   803ae6 <ipc_find_env>
+  802de1:	a3 24 67 80 00       	mov    %eax,0x806724
+	nsipcbuf.shard.req_shard = shard;
+  802de6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de9:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802dee:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802df3:	e8 08 f3 ff ff       	call   802100 <nsipc>
+  802df8:	83 c4 10             	add    $0x10,%esp
+  802dfb:	85 c0                	test   %eax,%eax
+  802dfd:	78 0a                	js     802e09 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802dff:	a3 24 67 80 00       	mov    %eax,0x806724
+	return 0;
+  802e04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e09:	c9                   	leave
+  802e0a:	c3                   	ret
+
+00802e0b <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802e0b:	55                   	push   %ebp
+  802e0c:	89 e5                	mov    %esp,%ebp
+  802e0e:	57                   	push   %edi
+  802e0f:	56                   	push   %esi
+  802e10:	53                   	push   %ebx
+  802e11:	83 ec 1c             	sub    $0x1c,%esp
+  802e14:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e17:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802e1a:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802e1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e24:	89 e0                	mov    %esp,%eax
+  802e26:	89 f2                	mov    %esi,%edx
+  802e28:	29 c2                	sub    %eax,%edx
+  802e2a:	89 d0                	mov    %edx,%eax
+  802e2c:	c1 e8 0f             	shr    $0xf,%eax
+  802e2f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802e35:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802e38:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  802e3f:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802e42:	83 ec 0c             	sub    $0xc,%esp
+  802e45:	ff 75 e0             	push   -0x20(%ebp)
+  802e48:	e8 d8 0c 00 00       	call   803b25 <pageref>
+  802e4d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e50:	83 c4 04             	add    $0x4,%esp
+  802e53:	ff 75 dc             	push   -0x24(%ebp)
+  802e56:	e8 ca 0c 00 00       	call   803b25 <pageref>
+  802e5b:	89 e2                	mov    %esp,%edx
+  802e5d:	89 f1                	mov    %esi,%ecx
+  802e5f:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802e61:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802e64:	89 ca                	mov    %ecx,%edx
+  802e66:	c1 ea 0f             	shr    $0xf,%edx
+  802e69:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802e6f:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802e72:	8b 14 95 60 67 80 00 	mov    0x806760(,%edx,4),%edx
+  802e79:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802e7c:	39 d7                	cmp    %edx,%edi
+  802e7e:	74 40                	je     802ec0 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802e80:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e83:	75 9f                	jne    802e24 <_pipeisclosed+0x19>
+  802e85:	89 e2                	mov    %esp,%edx
+  802e87:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802e8c:	29 d0                	sub    %edx,%eax
+  802e8e:	89 c2                	mov    %eax,%edx
+  802e90:	c1 ea 0f             	shr    $0xf,%edx
+  802e93:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9d:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ea0:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  802ea7:	8b 40 58             	mov    0x58(%eax),%eax
+  802eaa:	6a 01                	push   $0x1
+  802eac:	50                   	push   %eax
+  802ead:	57                   	push   %edi
+  802eae:	68 1f 46 80 00       	push   $0x80461f
+  802eb3:	e8 89 d5 ff ff       	call   800441 <cprintf>
+  802eb8:	83 c4 10             	add    $0x10,%esp
+  802ebb:	e9 5f ff ff ff       	jmp    802e1f <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802ec0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ec3:	0f 94 c0             	sete   %al
+  802ec6:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802ec9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ecc:	5b                   	pop    %ebx
+  802ecd:	5e                   	pop    %esi
+  802ece:	5f                   	pop    %edi
+  802ecf:	5d                   	pop    %ebp
+  802ed0:	c3                   	ret
+
+00802ed1 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ed1:	55                   	push   %ebp
+  802ed2:	89 e5                	mov    %esp,%ebp
+  802ed4:	53                   	push   %ebx
+  802ed5:	83 ec 0c             	sub    $0xc,%esp
+  802ed8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802edb:	53                   	push   %ebx
+  802edc:	6a 00                	push   $0x0
+  802ede:	e8 0e e1 ff ff       	call   800ff1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802ee3:	89 1c 24             	mov    %ebx,(%esp)
+  802ee6:	e8 f4 e4 ff ff       	call   8013df <fd2data>
+  802eeb:	83 c4 08             	add    $0x8,%esp
+  802eee:	50                   	push   %eax
+  802eef:	6a 00                	push   $0x0
+  802ef1:	e8 fb e0 ff ff       	call   800ff1 <sys_page_unmap>
+}
+  802ef6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ef9:	c9                   	leave
+  802efa:	c3                   	ret
+
+00802efb <devpipe_read>:
+{
+  802efb:	55                   	push   %ebp
+  802efc:	89 e5                	mov    %esp,%ebp
+  802efe:	57                   	push   %edi
+  802eff:	56                   	push   %esi
+  802f00:	53                   	push   %ebx
+  802f01:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802f04:	ff 75 08             	push   0x8(%ebp)
+  802f07:	e8 d3 e4 ff ff       	call   8013df <fd2data>
+  802f0c:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f0e:	8b 70 04             	mov    0x4(%eax),%esi
+  802f11:	8b 00                	mov    (%eax),%eax
+  802f13:	83 c4 10             	add    $0x10,%esp
+  802f16:	39 f0                	cmp    %esi,%eax
+  802f18:	75 36                	jne    802f50 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802f1a:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802f1d:	89 da                	mov    %ebx,%edx
+  802f1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f22:	e8 e4 fe ff ff       	call   802e0b <_pipeisclosed>
+  802f27:	85 c0                	test   %eax,%eax
+  802f29:	0f 85 d4 00 00 00    	jne    803003 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802f2f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f34:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802f38:	83 ec 04             	sub    $0x4,%esp
+  802f3b:	6a ff                	push   $0xffffffff
+  802f3d:	56                   	push   %esi
+  802f3e:	57                   	push   %edi
+  802f3f:	e8 26 e4 ff ff       	call   80136a <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f44:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f47:	8b 03                	mov    (%ebx),%eax
+  802f49:	83 c4 10             	add    $0x10,%esp
+  802f4c:	39 c6                	cmp    %eax,%esi
+  802f4e:	74 cd                	je     802f1d <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f50:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f53:	8b 03                	mov    (%ebx),%eax
+  802f55:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802f5b:	29 c6                	sub    %eax,%esi
+  802f5d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f62:	f7 e6                	mul    %esi
+  802f64:	c1 ea 0c             	shr    $0xc,%edx
+  802f67:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f6d:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802f6f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f72:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802f76:	8b 0b                	mov    (%ebx),%ecx
+  802f78:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f7d:	f7 e1                	mul    %ecx
+  802f7f:	c1 ea 0b             	shr    $0xb,%edx
+  802f82:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f88:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802f8a:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802f8f:	29 cf                	sub    %ecx,%edi
+  802f91:	39 f7                	cmp    %esi,%edi
+  802f93:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802f96:	83 ec 04             	sub    $0x4,%esp
+  802f99:	57                   	push   %edi
+  802f9a:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802f9e:	50                   	push   %eax
+  802f9f:	ff 75 0c             	push   0xc(%ebp)
+  802fa2:	e8 41 dd ff ff       	call   800ce8 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802fa7:	83 c4 0c             	add    $0xc,%esp
+  802faa:	89 f0                	mov    %esi,%eax
+  802fac:	29 f8                	sub    %edi,%eax
+  802fae:	50                   	push   %eax
+  802faf:	8d 43 10             	lea    0x10(%ebx),%eax
+  802fb2:	50                   	push   %eax
+  802fb3:	89 f8                	mov    %edi,%eax
+  802fb5:	03 45 0c             	add    0xc(%ebp),%eax
+  802fb8:	50                   	push   %eax
+  802fb9:	e8 2a dd ff ff       	call   800ce8 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802fbe:	8b 0b                	mov    (%ebx),%ecx
+  802fc0:	01 f1                	add    %esi,%ecx
+  802fc2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fc7:	f7 e1                	mul    %ecx
+  802fc9:	c1 ea 0c             	shr    $0xc,%edx
+  802fcc:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802fd2:	29 c1                	sub    %eax,%ecx
+  802fd4:	89 0b                	mov    %ecx,(%ebx)
+  802fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdb:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802fdf:	83 c4 10             	add    $0x10,%esp
+  802fe2:	85 c0                	test   %eax,%eax
+  802fe4:	75 0a                	jne    802ff0 <devpipe_read+0xf5>
+	return n;
+  802fe6:	89 f0                	mov    %esi,%eax
+}
+  802fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802feb:	5b                   	pop    %ebx
+  802fec:	5e                   	pop    %esi
+  802fed:	5f                   	pop    %edi
+  802fee:	5d                   	pop    %ebp
+  802fef:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802ff0:	83 ec 08             	sub    $0x8,%esp
+  802ff3:	68 00 04 00 00       	push   $0x400
+  802ff8:	53                   	push   %ebx
+  802ff9:	e8 8e e3 ff ff       	call   80138c <sys_futex_wake>
+  802ffe:	83 c4 10             	add    $0x10,%esp
+  803001:	eb e3                	jmp    802fe6 <devpipe_read+0xeb>
+			return 0;
+  803003:	b8 00 00 00 00       	mov    $0x0,%eax
+  803008:	eb de                	jmp    802fe8 <devpipe_read+0xed>
+
+0080300a <devpipe_write>:
+{
+  80300a:	55                   	push   %ebp
+  80300b:	89 e5                	mov    %esp,%ebp
+  80300d:	57                   	push   %edi
+  80300e:	56                   	push   %esi
+  80300f:	53                   	push   %ebx
+  803010:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803013:	ff 75 08             	push   0x8(%ebp)
+  803016:	e8 c4 e3 ff ff       	call   8013df <fd2data>
+  80301b:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80301d:	83 c4 10             	add    $0x10,%esp
+  803020:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803027:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80302c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803030:	0f 84 43 01 00 00    	je     803179 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803036:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803039:	8b 06                	mov    (%esi),%eax
+  80303b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803041:	29 c1                	sub    %eax,%ecx
+  803043:	89 c8                	mov    %ecx,%eax
+  803045:	f7 e7                	mul    %edi
+  803047:	c1 ea 0c             	shr    $0xc,%edx
+  80304a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803050:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803052:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803058:	75 52                	jne    8030ac <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80305a:	89 f2                	mov    %esi,%edx
+  80305c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80305f:	e8 a7 fd ff ff       	call   802e0b <_pipeisclosed>
+  803064:	85 c0                	test   %eax,%eax
+  803066:	0f 85 28 01 00 00    	jne    803194 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80306c:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80306e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803071:	8b 06                	mov    (%esi),%eax
+  803073:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803079:	29 c1                	sub    %eax,%ecx
+  80307b:	89 c8                	mov    %ecx,%eax
+  80307d:	f7 e7                	mul    %edi
+  80307f:	c1 ea 0c             	shr    $0xc,%edx
+  803082:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803088:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80308a:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803090:	75 a4                	jne    803036 <devpipe_write+0x2c>
+  803092:	b8 01 00 00 00       	mov    $0x1,%eax
+  803097:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80309b:	83 ec 04             	sub    $0x4,%esp
+  80309e:	6a ff                	push   $0xffffffff
+  8030a0:	53                   	push   %ebx
+  8030a1:	56                   	push   %esi
+  8030a2:	e8 c3 e2 ff ff       	call   80136a <sys_futex_wait>
+}
+  8030a7:	83 c4 10             	add    $0x10,%esp
+  8030aa:	eb 8a                	jmp    803036 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030ac:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030af:	8b 06                	mov    (%esi),%eax
+  8030b1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030b7:	29 c1                	sub    %eax,%ecx
+  8030b9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030be:	f7 e1                	mul    %ecx
+  8030c0:	c1 ea 0c             	shr    $0xc,%edx
+  8030c3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030c9:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8030cb:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8030d0:	89 d8                	mov    %ebx,%eax
+  8030d2:	29 c8                	sub    %ecx,%eax
+  8030d4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8030d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030da:	29 ca                	sub    %ecx,%edx
+  8030dc:	39 d0                	cmp    %edx,%eax
+  8030de:	0f 46 d0             	cmovbe %eax,%edx
+  8030e1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8030e4:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030e7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030ec:	f7 e1                	mul    %ecx
+  8030ee:	c1 ea 0b             	shr    $0xb,%edx
+  8030f1:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8030f7:	89 ca                	mov    %ecx,%edx
+  8030f9:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8030fb:	29 d3                	sub    %edx,%ebx
+  8030fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803100:	39 c3                	cmp    %eax,%ebx
+  803102:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803105:	83 ec 04             	sub    $0x4,%esp
+  803108:	53                   	push   %ebx
+  803109:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80310c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80310f:	51                   	push   %ecx
+  803110:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803114:	50                   	push   %eax
+  803115:	e8 ce db ff ff       	call   800ce8 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80311a:	83 c4 0c             	add    $0xc,%esp
+  80311d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803120:	29 d8                	sub    %ebx,%eax
+  803122:	50                   	push   %eax
+  803123:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803126:	01 cb                	add    %ecx,%ebx
+  803128:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80312b:	53                   	push   %ebx
+  80312c:	8d 46 10             	lea    0x10(%esi),%eax
+  80312f:	50                   	push   %eax
+  803130:	e8 b3 db ff ff       	call   800ce8 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803135:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803138:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80313b:	01 c1                	add    %eax,%ecx
+  80313d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803142:	f7 e1                	mul    %ecx
+  803144:	c1 ea 0c             	shr    $0xc,%edx
+  803147:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80314d:	89 ca                	mov    %ecx,%edx
+  80314f:	29 c2                	sub    %eax,%edx
+  803151:	89 56 04             	mov    %edx,0x4(%esi)
+  803154:	b8 00 00 00 00       	mov    $0x0,%eax
+  803159:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80315d:	83 c4 10             	add    $0x10,%esp
+  803160:	85 c0                	test   %eax,%eax
+  803162:	75 1a                	jne    80317e <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803164:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803167:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80316a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80316d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803170:	0f 82 c0 fe ff ff    	jb     803036 <devpipe_write+0x2c>
+  803176:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80317c:	eb 1b                	jmp    803199 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  80317e:	83 ec 08             	sub    $0x8,%esp
+  803181:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803186:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803189:	50                   	push   %eax
+  80318a:	e8 fd e1 ff ff       	call   80138c <sys_futex_wake>
+  80318f:	83 c4 10             	add    $0x10,%esp
+  803192:	eb d0                	jmp    803164 <devpipe_write+0x15a>
+				return 0;
+  803194:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803199:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80319c:	5b                   	pop    %ebx
+  80319d:	5e                   	pop    %esi
+  80319e:	5f                   	pop    %edi
+  80319f:	5d                   	pop    %ebp
+  8031a0:	c3                   	ret
+
+008031a1 <devpipe_stat>:
+{
+  8031a1:	55                   	push   %ebp
+  8031a2:	89 e5                	mov    %esp,%ebp
+  8031a4:	56                   	push   %esi
+  8031a5:	53                   	push   %ebx
+  8031a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031a9:	83 ec 0c             	sub    $0xc,%esp
+  8031ac:	ff 75 08             	push   0x8(%ebp)
+  8031af:	e8 2b e2 ff ff       	call   8013df <fd2data>
+  8031b4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8031b6:	83 c4 08             	add    $0x8,%esp
+  8031b9:	68 32 46 80 00       	push   $0x804632
+  8031be:	53                   	push   %ebx
+  8031bf:	e8 74 d9 ff ff       	call   800b38 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031c4:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8031c7:	8b 06                	mov    (%esi),%eax
+  8031c9:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8031cf:	29 c1                	sub    %eax,%ecx
+  8031d1:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031d6:	89 c8                	mov    %ecx,%eax
+  8031d8:	f7 e2                	mul    %edx
+  8031da:	c1 ea 0c             	shr    $0xc,%edx
+  8031dd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031e3:	29 d1                	sub    %edx,%ecx
+  8031e5:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8031eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8031f2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8031f5:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8031fc:	50 80 00 
+}
+  8031ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803204:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803207:	5b                   	pop    %ebx
+  803208:	5e                   	pop    %esi
+  803209:	5d                   	pop    %ebp
+  80320a:	c3                   	ret
+
+0080320b <devpipe_poll>:
+{
+  80320b:	55                   	push   %ebp
+  80320c:	89 e5                	mov    %esp,%ebp
+  80320e:	57                   	push   %edi
+  80320f:	56                   	push   %esi
+  803210:	53                   	push   %ebx
+  803211:	83 ec 18             	sub    $0x18,%esp
+  803214:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803217:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80321a:	57                   	push   %edi
+  80321b:	e8 bf e1 ff ff       	call   8013df <fd2data>
+  803220:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803222:	83 c4 10             	add    $0x10,%esp
+  803225:	89 f3                	mov    %esi,%ebx
+  803227:	83 e3 01             	and    $0x1,%ebx
+  80322a:	75 27                	jne    803253 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80322c:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803232:	75 48                	jne    80327c <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803234:	89 ca                	mov    %ecx,%edx
+  803236:	89 f8                	mov    %edi,%eax
+  803238:	e8 ce fb ff ff       	call   802e0b <_pipeisclosed>
+  80323d:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80323f:	89 d8                	mov    %ebx,%eax
+  803241:	83 c8 10             	or     $0x10,%eax
+  803244:	85 d2                	test   %edx,%edx
+  803246:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803249:	89 d8                	mov    %ebx,%eax
+  80324b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80324e:	5b                   	pop    %ebx
+  80324f:	5e                   	pop    %esi
+  803250:	5f                   	pop    %edi
+  803251:	5d                   	pop    %ebp
+  803252:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803253:	8b 58 04             	mov    0x4(%eax),%ebx
+  803256:	8b 00                	mov    (%eax),%eax
+  803258:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80325e:	29 c3                	sub    %eax,%ebx
+  803260:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803265:	89 d8                	mov    %ebx,%eax
+  803267:	f7 e2                	mul    %edx
+  803269:	c1 ea 0c             	shr    $0xc,%edx
+  80326c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803272:	39 d3                	cmp    %edx,%ebx
+  803274:	0f 95 c3             	setne  %bl
+  803277:	0f b6 db             	movzbl %bl,%ebx
+  80327a:	eb b0                	jmp    80322c <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80327c:	8b 71 04             	mov    0x4(%ecx),%esi
+  80327f:	8b 01                	mov    (%ecx),%eax
+  803281:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803287:	29 c6                	sub    %eax,%esi
+  803289:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80328e:	89 f0                	mov    %esi,%eax
+  803290:	f7 e2                	mul    %edx
+  803292:	c1 ea 0c             	shr    $0xc,%edx
+  803295:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80329b:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80329d:	89 d8                	mov    %ebx,%eax
+  80329f:	83 c8 04             	or     $0x4,%eax
+  8032a2:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8032a8:	0f 42 d8             	cmovb  %eax,%ebx
+  8032ab:	eb 87                	jmp    803234 <devpipe_poll+0x29>
+
+008032ad <pipe>:
+{
+  8032ad:	55                   	push   %ebp
+  8032ae:	89 e5                	mov    %esp,%ebp
+  8032b0:	56                   	push   %esi
+  8032b1:	53                   	push   %ebx
+  8032b2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8032b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032b8:	50                   	push   %eax
+  8032b9:	e8 38 e1 ff ff       	call   8013f6 <fd_alloc>
+  8032be:	89 c3                	mov    %eax,%ebx
+  8032c0:	83 c4 10             	add    $0x10,%esp
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	0f 88 23 01 00 00    	js     8033ee <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032cb:	83 ec 04             	sub    $0x4,%esp
+  8032ce:	68 07 04 00 00       	push   $0x407
+  8032d3:	ff 75 f4             	push   -0xc(%ebp)
+  8032d6:	6a 00                	push   $0x0
+  8032d8:	e8 8f dc ff ff       	call   800f6c <sys_page_alloc>
+  8032dd:	89 c3                	mov    %eax,%ebx
+  8032df:	83 c4 10             	add    $0x10,%esp
+  8032e2:	85 c0                	test   %eax,%eax
+  8032e4:	0f 88 04 01 00 00    	js     8033ee <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032ea:	83 ec 0c             	sub    $0xc,%esp
+  8032ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032f0:	50                   	push   %eax
+  8032f1:	e8 00 e1 ff ff       	call   8013f6 <fd_alloc>
+  8032f6:	89 c3                	mov    %eax,%ebx
+  8032f8:	83 c4 10             	add    $0x10,%esp
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	0f 88 db 00 00 00    	js     8033de <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803303:	83 ec 04             	sub    $0x4,%esp
+  803306:	68 07 04 00 00       	push   $0x407
+  80330b:	ff 75 f0             	push   -0x10(%ebp)
+  80330e:	6a 00                	push   $0x0
+  803310:	e8 57 dc ff ff       	call   800f6c <sys_page_alloc>
+  803315:	89 c3                	mov    %eax,%ebx
+  803317:	83 c4 10             	add    $0x10,%esp
+  80331a:	85 c0                	test   %eax,%eax
+  80331c:	0f 88 bc 00 00 00    	js     8033de <pipe+0x131>
+	va = fd2data(fd0);
+  803322:	83 ec 0c             	sub    $0xc,%esp
+  803325:	ff 75 f4             	push   -0xc(%ebp)
+  803328:	e8 b2 e0 ff ff       	call   8013df <fd2data>
+  80332d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80332f:	83 c4 0c             	add    $0xc,%esp
+  803332:	68 07 04 00 00       	push   $0x407
+  803337:	50                   	push   %eax
+  803338:	6a 00                	push   $0x0
+  80333a:	e8 2d dc ff ff       	call   800f6c <sys_page_alloc>
+  80333f:	89 c3                	mov    %eax,%ebx
+  803341:	83 c4 10             	add    $0x10,%esp
+  803344:	85 c0                	test   %eax,%eax
+  803346:	0f 88 82 00 00 00    	js     8033ce <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80334c:	83 ec 0c             	sub    $0xc,%esp
+  80334f:	ff 75 f0             	push   -0x10(%ebp)
+  803352:	e8 88 e0 ff ff       	call   8013df <fd2data>
+  803357:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80335e:	50                   	push   %eax
+  80335f:	6a 00                	push   $0x0
+  803361:	56                   	push   %esi
+  803362:	6a 00                	push   $0x0
+  803364:	e8 46 dc ff ff       	call   800faf <sys_page_map>
+  803369:	89 c3                	mov    %eax,%ebx
+  80336b:	83 c4 20             	add    $0x20,%esp
+  80336e:	85 c0                	test   %eax,%eax
+  803370:	78 4e                	js     8033c0 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803372:	a1 60 50 80 00       	mov    0x805060,%eax
+  803377:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80337a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80337c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80337f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803386:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803389:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80338b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80338e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803395:	83 ec 0c             	sub    $0xc,%esp
+  803398:	ff 75 f4             	push   -0xc(%ebp)
+  80339b:	e8 2f e0 ff ff       	call   8013cf <fd2num>
+  8033a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033a3:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8033a5:	83 c4 04             	add    $0x4,%esp
+  8033a8:	ff 75 f0             	push   -0x10(%ebp)
+  8033ab:	e8 1f e0 ff ff       	call   8013cf <fd2num>
+  8033b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033b3:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8033b6:	83 c4 10             	add    $0x10,%esp
+  8033b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033be:	eb 2e                	jmp    8033ee <pipe+0x141>
+	sys_page_unmap(0, va);
+  8033c0:	83 ec 08             	sub    $0x8,%esp
+  8033c3:	56                   	push   %esi
+  8033c4:	6a 00                	push   $0x0
+  8033c6:	e8 26 dc ff ff       	call   800ff1 <sys_page_unmap>
+  8033cb:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8033ce:	83 ec 08             	sub    $0x8,%esp
+  8033d1:	ff 75 f0             	push   -0x10(%ebp)
+  8033d4:	6a 00                	push   $0x0
+  8033d6:	e8 16 dc ff ff       	call   800ff1 <sys_page_unmap>
+  8033db:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033de:	83 ec 08             	sub    $0x8,%esp
+  8033e1:	ff 75 f4             	push   -0xc(%ebp)
+  8033e4:	6a 00                	push   $0x0
+  8033e6:	e8 06 dc ff ff       	call   800ff1 <sys_page_unmap>
+  8033eb:	83 c4 10             	add    $0x10,%esp
+}
+  8033ee:	89 d8                	mov    %ebx,%eax
+  8033f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033f3:	5b                   	pop    %ebx
+  8033f4:	5e                   	pop    %esi
+  8033f5:	5d                   	pop    %ebp
+  8033f6:	c3                   	ret
+
+008033f7 <pipeisclosed>:
+{
+  8033f7:	55                   	push   %ebp
+  8033f8:	89 e5                	mov    %esp,%ebp
+  8033fa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803400:	50                   	push   %eax
+  803401:	ff 75 08             	push   0x8(%ebp)
+  803404:	e8 3d e0 ff ff       	call   801446 <fd_lookup>
+  803409:	83 c4 10             	add    $0x10,%esp
+  80340c:	85 c0                	test   %eax,%eax
+  80340e:	78 18                	js     803428 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803410:	83 ec 0c             	sub    $0xc,%esp
+  803413:	ff 75 f4             	push   -0xc(%ebp)
+  803416:	e8 c4 df ff ff       	call   8013df <fd2data>
+  80341b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80341d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803420:	e8 e6 f9 ff ff       	call   802e0b <_pipeisclosed>
+  803425:	83 c4 10             	add    $0x10,%esp
+}
+  803428:	c9                   	leave
+  803429:	c3                   	ret
+
+0080342a <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80342a:	55                   	push   %ebp
+  80342b:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80342d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803430:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803436:	5d                   	pop    %ebp
+  803437:	c3                   	ret
+
+00803438 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803438:	55                   	push   %ebp
+  803439:	89 e5                	mov    %esp,%ebp
+  80343b:	53                   	push   %ebx
+  80343c:	83 ec 04             	sub    $0x4,%esp
+  80343f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803442:	8b 03                	mov    (%ebx),%eax
+  803444:	85 c0                	test   %eax,%eax
+  803446:	75 05                	jne    80344d <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803448:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80344b:	c9                   	leave
+  80344c:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80344d:	83 ec 08             	sub    $0x8,%esp
+  803450:	50                   	push   %eax
+  803451:	8d 43 04             	lea    0x4(%ebx),%eax
+  803454:	50                   	push   %eax
+  803455:	e8 e7 dd ff ff       	call   801241 <sys_page_batch>
+	pb->pb_n = 0;
+  80345a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803460:	83 c4 10             	add    $0x10,%esp
+  803463:	eb e3                	jmp    803448 <pgbatch_flush+0x10>
+
+00803465 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803465:	55                   	push   %ebp
+  803466:	89 e5                	mov    %esp,%ebp
+  803468:	56                   	push   %esi
+  803469:	53                   	push   %ebx
+  80346a:	89 c3                	mov    %eax,%ebx
+  80346c:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80346e:	83 38 20             	cmpl   $0x20,(%eax)
+  803471:	74 2c                	je     80349f <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803473:	8b 03                	mov    (%ebx),%eax
+  803475:	8d 50 01             	lea    0x1(%eax),%edx
+  803478:	89 13                	mov    %edx,(%ebx)
+  80347a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80347d:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803481:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803483:	83 ec 04             	sub    $0x4,%esp
+  803486:	6a 18                	push   $0x18
+  803488:	6a 00                	push   $0x0
+  80348a:	50                   	push   %eax
+  80348b:	e8 23 d8 ff ff       	call   800cb3 <memset>
+	return 0;
+  803490:	83 c4 10             	add    $0x10,%esp
+  803493:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803498:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80349b:	5b                   	pop    %ebx
+  80349c:	5e                   	pop    %esi
+  80349d:	5d                   	pop    %ebp
+  80349e:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80349f:	83 ec 0c             	sub    $0xc,%esp
+  8034a2:	50                   	push   %eax
+  8034a3:	e8 90 ff ff ff       	call   803438 <pgbatch_flush>
+  8034a8:	83 c4 10             	add    $0x10,%esp
+  8034ab:	85 c0                	test   %eax,%eax
+  8034ad:	79 c4                	jns    803473 <pgbatch_slot+0xe>
+  8034af:	eb e7                	jmp    803498 <pgbatch_slot+0x33>
+
+008034b1 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8034b1:	55                   	push   %ebp
+  8034b2:	89 e5                	mov    %esp,%ebp
+  8034b4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034b7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034bd:	e8 a3 ff ff ff       	call   803465 <pgbatch_slot>
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	78 20                	js     8034e6 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8034c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034c9:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8034cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034d2:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034d5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034d8:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034db:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034de:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034e6:	c9                   	leave
+  8034e7:	c3                   	ret
+
+008034e8 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8034e8:	55                   	push   %ebp
+  8034e9:	89 e5                	mov    %esp,%ebp
+  8034eb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034ee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f4:	e8 6c ff ff ff       	call   803465 <pgbatch_slot>
+  8034f9:	85 c0                	test   %eax,%eax
+  8034fb:	78 2c                	js     803529 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8034fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803500:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803506:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803509:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80350c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80350f:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803512:	8b 55 14             	mov    0x14(%ebp),%edx
+  803515:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803518:	8b 55 18             	mov    0x18(%ebp),%edx
+  80351b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80351e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803521:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803524:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803529:	c9                   	leave
+  80352a:	c3                   	ret
+
+0080352b <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80352b:	55                   	push   %ebp
+  80352c:	89 e5                	mov    %esp,%ebp
+  80352e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803531:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803534:	8b 45 08             	mov    0x8(%ebp),%eax
+  803537:	e8 29 ff ff ff       	call   803465 <pgbatch_slot>
+  80353c:	85 c0                	test   %eax,%eax
+  80353e:	78 1a                	js     80355a <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803540:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803543:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803549:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80354c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80354f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803552:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803555:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80355a:	c9                   	leave
+  80355b:	c3                   	ret
+
+0080355c <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80355c:	55                   	push   %ebp
+  80355d:	89 e5                	mov    %esp,%ebp
+  80355f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803562:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803565:	8b 45 08             	mov    0x8(%ebp),%eax
+  803568:	e8 f8 fe ff ff       	call   803465 <pgbatch_slot>
+  80356d:	85 c0                	test   %eax,%eax
+  80356f:	78 20                	js     803591 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803571:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803574:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80357a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80357d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803580:	8b 55 10             	mov    0x10(%ebp),%edx
+  803583:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803586:	8b 55 14             	mov    0x14(%ebp),%edx
+  803589:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80358c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803591:	c9                   	leave
+  803592:	c3                   	ret
+
+00803593 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803593:	55                   	push   %ebp
+  803594:	89 e5                	mov    %esp,%ebp
+  803596:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803599:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80359c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80359f:	e8 c1 fe ff ff       	call   803465 <pgbatch_slot>
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	78 26                	js     8035ce <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8035a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035ab:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8035b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035b4:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8035b7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035ba:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8035bd:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035c0:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8035c3:	8b 55 18             	mov    0x18(%ebp),%edx
+  8035c6:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ce:	c9                   	leave
+  8035cf:	c3                   	ret
+
+008035d0 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8035d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d5:	c3                   	ret
+
+008035d6 <devcons_poll>:
+{
+  8035d6:	55                   	push   %ebp
+  8035d7:	89 e5                	mov    %esp,%ebp
+  8035d9:	53                   	push   %ebx
+  8035da:	83 ec 04             	sub    $0x4,%esp
+  8035dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8035e0:	89 da                	mov    %ebx,%edx
+  8035e2:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8035e5:	83 3d 34 67 80 00 00 	cmpl   $0x0,0x806734
+  8035ec:	74 0c                	je     8035fa <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8035ee:	89 d8                	mov    %ebx,%eax
+  8035f0:	83 e0 01             	and    $0x1,%eax
+  8035f3:	09 d0                	or     %edx,%eax
+}
+  8035f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035f8:	c9                   	leave
+  8035f9:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8035fa:	e8 cf d8 ff ff       	call   800ece <sys_cgetc>
+  8035ff:	a3 34 67 80 00       	mov    %eax,0x806734
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803604:	89 da                	mov    %ebx,%edx
+  803606:	83 e2 04             	and    $0x4,%edx
+  803609:	85 c0                	test   %eax,%eax
+  80360b:	74 e6                	je     8035f3 <devcons_poll+0x1d>
+  80360d:	eb df                	jmp    8035ee <devcons_poll+0x18>
+
+0080360f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80360f:	55                   	push   %ebp
+  803610:	89 e5                	mov    %esp,%ebp
+  803612:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803615:	68 3e 46 80 00       	push   $0x80463e
+  80361a:	ff 75 0c             	push   0xc(%ebp)
+  80361d:	e8 16 d5 ff ff       	call   800b38 <strcpy>
+	return 0;
+}
+  803622:	b8 00 00 00 00       	mov    $0x0,%eax
+  803627:	c9                   	leave
+  803628:	c3                   	ret
+
+00803629 <devcons_write>:
+{
+  803629:	55                   	push   %ebp
+  80362a:	89 e5                	mov    %esp,%ebp
+  80362c:	57                   	push   %edi
+  80362d:	56                   	push   %esi
+  80362e:	53                   	push   %ebx
+  80362f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803635:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803638:	85 ff                	test   %edi,%edi
+  80363a:	74 51                	je     80368d <devcons_write+0x64>
+  80363c:	be 00 00 00 00       	mov    $0x0,%esi
+  803641:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803646:	89 fb                	mov    %edi,%ebx
+  803648:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80364a:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80364f:	39 d3                	cmp    %edx,%ebx
+  803651:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803654:	83 ec 04             	sub    $0x4,%esp
+  803657:	53                   	push   %ebx
+  803658:	03 45 0c             	add    0xc(%ebp),%eax
+  80365b:	50                   	push   %eax
+  80365c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803662:	50                   	push   %eax
+  803663:	e8 80 d6 ff ff       	call   800ce8 <memmove>
+		sys_cputs(buf, m);
+  803668:	83 c4 08             	add    $0x8,%esp
+  80366b:	53                   	push   %ebx
+  80366c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803672:	50                   	push   %eax
+  803673:	e8 38 d8 ff ff       	call   800eb0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803678:	01 de                	add    %ebx,%esi
+  80367a:	89 f0                	mov    %esi,%eax
+  80367c:	83 c4 10             	add    $0x10,%esp
+  80367f:	39 fe                	cmp    %edi,%esi
+  803681:	72 c3                	jb     803646 <devcons_write+0x1d>
+}
+  803683:	89 f0                	mov    %esi,%eax
+  803685:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803688:	5b                   	pop    %ebx
+  803689:	5e                   	pop    %esi
+  80368a:	5f                   	pop    %edi
+  80368b:	5d                   	pop    %ebp
+  80368c:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80368d:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803692:	eb ef                	jmp    803683 <devcons_write+0x5a>
+
+00803694 <devcons_read>:
+{
+  803694:	55                   	push   %ebp
+  803695:	89 e5                	mov    %esp,%ebp
+  803697:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80369a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80369f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036a3:	74 36                	je     8036db <devcons_read+0x47>
+	c = cons_peek;
+  8036a5:	a1 34 67 80 00       	mov    0x806734,%eax
+	cons_peek = 0;
+  8036aa:	c7 05 34 67 80 00 00 	movl   $0x0,0x806734
+  8036b1:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8036b4:	85 c0                	test   %eax,%eax
+  8036b6:	75 10                	jne    8036c8 <devcons_read+0x34>
+  8036b8:	e8 11 d8 ff ff       	call   800ece <sys_cgetc>
+  8036bd:	85 c0                	test   %eax,%eax
+  8036bf:	75 07                	jne    8036c8 <devcons_read+0x34>
+		sys_yield();
+  8036c1:	e8 87 d8 ff ff       	call   800f4d <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8036c6:	eb f0                	jmp    8036b8 <devcons_read+0x24>
+	if (c < 0)
+  8036c8:	85 c0                	test   %eax,%eax
+  8036ca:	78 0f                	js     8036db <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8036cc:	83 f8 04             	cmp    $0x4,%eax
+  8036cf:	74 0c                	je     8036dd <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8036d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036d4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8036d6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8036db:	c9                   	leave
+  8036dc:	c3                   	ret
+		return 0;
+  8036dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e2:	eb f7                	jmp    8036db <devcons_read+0x47>
+
+008036e4 <cputchar>:
+{
+  8036e4:	55                   	push   %ebp
+  8036e5:	89 e5                	mov    %esp,%ebp
+  8036e7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8036ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ed:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8036f0:	6a 01                	push   $0x1
+  8036f2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036f5:	50                   	push   %eax
+  8036f6:	e8 b5 d7 ff ff       	call   800eb0 <sys_cputs>
+}
+  8036fb:	83 c4 10             	add    $0x10,%esp
+  8036fe:	c9                   	leave
+  8036ff:	c3                   	ret
+
+00803700 <getchar>:
+{
+  803700:	55                   	push   %ebp
+  803701:	89 e5                	mov    %esp,%ebp
+  803703:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803706:	6a 01                	push   $0x1
+  803708:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80370b:	50                   	push   %eax
+  80370c:	6a 00                	push   $0x0
+  80370e:	e8 b7 df ff ff       	call   8016ca <read>
+	if (r < 0)
+  803713:	83 c4 10             	add    $0x10,%esp
+  803716:	85 c0                	test   %eax,%eax
+  803718:	78 06                	js     803720 <getchar+0x20>
+	if (r < 1)
+  80371a:	74 06                	je     803722 <getchar+0x22>
+	return c;
+  80371c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803720:	c9                   	leave
+  803721:	c3                   	ret
+		return -E_EOF;
+  803722:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803727:	eb f7                	jmp    803720 <getchar+0x20>
+
+00803729 <iscons>:
+{
+  803729:	55                   	push   %ebp
+  80372a:	89 e5                	mov    %esp,%ebp
+  80372c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80372f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803732:	50                   	push   %eax
+  803733:	ff 75 08             	push   0x8(%ebp)
+  803736:	e8 0b dd ff ff       	call   801446 <fd_lookup>
+  80373b:	83 c4 10             	add    $0x10,%esp
+  80373e:	85 c0                	test   %eax,%eax
+  803740:	78 11                	js     803753 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803745:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80374b:	39 10                	cmp    %edx,(%eax)
+  80374d:	0f 94 c0             	sete   %al
+  803750:	0f b6 c0             	movzbl %al,%eax
+}
+  803753:	c9                   	leave
+  803754:	c3                   	ret
+
+00803755 <opencons>:
+{
+  803755:	55                   	push   %ebp
+  803756:	89 e5                	mov    %esp,%ebp
+  803758:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80375b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80375e:	50                   	push   %eax
+  80375f:	e8 92 dc ff ff       	call   8013f6 <fd_alloc>
+  803764:	83 c4 10             	add    $0x10,%esp
+  803767:	85 c0                	test   %eax,%eax
+  803769:	78 3a                	js     8037a5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80376b:	83 ec 04             	sub    $0x4,%esp
+  80376e:	68 07 04 00 00       	push   $0x407
+  803773:	ff 75 f4             	push   -0xc(%ebp)
+  803776:	6a 00                	push   $0x0
+  803778:	e8 ef d7 ff ff       	call   800f6c <sys_page_alloc>
+  80377d:	83 c4 10             	add    $0x10,%esp
+  803780:	85 c0                	test   %eax,%eax
+  803782:	78 21                	js     8037a5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803784:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803787:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80378d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80378f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803792:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803799:	83 ec 0c             	sub    $0xc,%esp
+  80379c:	50                   	push   %eax
+  80379d:	e8 2d dc ff ff       	call   8013cf <fd2num>
+  8037a2:	83 c4 10             	add    $0x10,%esp
+}
+  8037a5:	c9                   	leave
+  8037a6:	c3                   	ret
+
+008037a7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8037a7:	55                   	push   %ebp
+  8037a8:	89 e5                	mov    %esp,%ebp
+  8037aa:	56                   	push   %esi
+  8037ab:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8037ac:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8037af:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8037b5:	e8 74 d7 ff ff       	call   800f2e <sys_getenvid>
+  8037ba:	83 ec 0c             	sub    $0xc,%esp
+  8037bd:	ff 75 0c             	push   0xc(%ebp)
+  8037c0:	ff 75 08             	push   0x8(%ebp)
+  8037c3:	56                   	push   %esi
+  8037c4:	50                   	push   %eax
+  8037c5:	68 4c 46 80 00       	push   $0x80464c
+  8037ca:	e8 72 cc ff ff       	call   800441 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8037cf:	83 c4 18             	add    $0x18,%esp
+  8037d2:	53                   	push   %ebx
+  8037d3:	ff 75 10             	push   0x10(%ebp)
+  8037d6:	e8 15 cc ff ff       	call   8003f0 <vcprintf>
+	cprintf("\n");
+  8037db:	c7 04 24 30 46 80 00 	movl   $0x804630,(%esp)
+  8037e2:	e8 5a cc ff ff       	call   800441 <cprintf>
+  8037e7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8037ea:	cc                   	int3
+	while (1)
+  8037eb:	eb fd                	jmp    8037ea <_panic+0x43>
+
+008037ed <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8037ed:	55                   	push   %ebp
+  8037ee:	89 e5                	mov    %esp,%ebp
+  8037f0:	56                   	push   %esi
+  8037f1:	53                   	push   %ebx
+  8037f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8037fb:	85 c0                	test   %eax,%eax
+  8037fd:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803802:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803805:	83 ec 0c             	sub    $0xc,%esp
+  803808:	50                   	push   %eax
+  803809:	e8 0e d9 ff ff       	call   80111c <sys_ipc_recv>
+  80380e:	83 c4 10             	add    $0x10,%esp
+  803811:	85 c0                	test   %eax,%eax
+  803813:	0f 88 8b 00 00 00    	js     8038a4 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803819:	85 f6                	test   %esi,%esi
+  80381b:	74 2a                	je     803847 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80381d:	89 e2                	mov    %esp,%edx
+  80381f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803824:	29 d0                	sub    %edx,%eax
+  803826:	89 c2                	mov    %eax,%edx
+  803828:	c1 ea 0f             	shr    $0xf,%edx
+  80382b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803830:	b8 00 00 00 00       	mov    $0x0,%eax
+  803835:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803838:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80383f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803845:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803847:	85 db                	test   %ebx,%ebx
+  803849:	74 2a                	je     803875 <ipc_recv+0x88>
+  80384b:	89 e2                	mov    %esp,%edx
+  80384d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803852:	29 d0                	sub    %edx,%eax
+  803854:	89 c2                	mov    %eax,%edx
+  803856:	c1 ea 0f             	shr    $0xf,%edx
+  803859:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80385e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803863:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803866:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80386d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803873:	89 03                	mov    %eax,(%ebx)
+  803875:	89 e2                	mov    %esp,%edx
+  803877:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80387c:	29 d0                	sub    %edx,%eax
+  80387e:	89 c2                	mov    %eax,%edx
+  803880:	c1 ea 0f             	shr    $0xf,%edx
+  803883:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388d:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803890:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803897:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80389d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038a0:	5b                   	pop    %ebx
+  8038a1:	5e                   	pop    %esi
+  8038a2:	5d                   	pop    %ebp
+  8038a3:	c3                   	ret
+		if(from_env_store != NULL)
+  8038a4:	85 f6                	test   %esi,%esi
+  8038a6:	74 06                	je     8038ae <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8038a8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8038ae:	85 db                	test   %ebx,%ebx
+  8038b0:	74 eb                	je     80389d <ipc_recv+0xb0>
+			*perm_store = 0;
+  8038b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8038b8:	eb e3                	jmp    80389d <ipc_recv+0xb0>
+
+008038ba <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8038ba:	55                   	push   %ebp
+  8038bb:	89 e5                	mov    %esp,%ebp
+  8038bd:	57                   	push   %edi
+  8038be:	56                   	push   %esi
+  8038bf:	53                   	push   %ebx
+  8038c0:	83 ec 14             	sub    $0x14,%esp
+  8038c3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038c9:	8b 75 14             	mov    0x14(%ebp),%esi
+  8038cc:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8038cf:	85 c0                	test   %eax,%eax
+  8038d1:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8038d6:	0f 44 c2             	cmove  %edx,%eax
+  8038d9:	ff 75 10             	push   0x10(%ebp)
+  8038dc:	50                   	push   %eax
+  8038dd:	e8 9c d8 ff ff       	call   80117e <sys_ipc_recv_pages>
+  8038e2:	83 c4 10             	add    $0x10,%esp
+  8038e5:	85 c0                	test   %eax,%eax
+  8038e7:	0f 88 ba 00 00 00    	js     8039a7 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8038ed:	85 ff                	test   %edi,%edi
+  8038ef:	74 2a                	je     80391b <ipc_recv_pages+0x61>
+  8038f1:	89 e2                	mov    %esp,%edx
+  8038f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038f8:	29 d0                	sub    %edx,%eax
+  8038fa:	89 c2                	mov    %eax,%edx
+  8038fc:	c1 ea 0f             	shr    $0xf,%edx
+  8038ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803904:	b8 00 00 00 00       	mov    $0x0,%eax
+  803909:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80390c:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803913:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803919:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80391b:	85 f6                	test   %esi,%esi
+  80391d:	74 2a                	je     803949 <ipc_recv_pages+0x8f>
+  80391f:	89 e2                	mov    %esp,%edx
+  803921:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803926:	29 d0                	sub    %edx,%eax
+  803928:	89 c2                	mov    %eax,%edx
+  80392a:	c1 ea 0f             	shr    $0xf,%edx
+  80392d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803932:	b8 00 00 00 00       	mov    $0x0,%eax
+  803937:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80393a:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803941:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803947:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803949:	85 db                	test   %ebx,%ebx
+  80394b:	74 2a                	je     803977 <ipc_recv_pages+0xbd>
+  80394d:	89 e2                	mov    %esp,%edx
+  80394f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803954:	29 d0                	sub    %edx,%eax
+  803956:	89 c2                	mov    %eax,%edx
+  803958:	c1 ea 0f             	shr    $0xf,%edx
+  80395b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803960:	b8 00 00 00 00       	mov    $0x0,%eax
+  803965:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803968:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80396f:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803975:	89 03                	mov    %eax,(%ebx)
+  803977:	89 e2                	mov    %esp,%edx
+  803979:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80397e:	29 d0                	sub    %edx,%eax
+  803980:	89 c2                	mov    %eax,%edx
+  803982:	c1 ea 0f             	shr    $0xf,%edx
+  803985:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80398a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398f:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803992:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803999:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80399f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039a2:	5b                   	pop    %ebx
+  8039a3:	5e                   	pop    %esi
+  8039a4:	5f                   	pop    %edi
+  8039a5:	5d                   	pop    %ebp
+  8039a6:	c3                   	ret
+		if (from_env_store)
+  8039a7:	85 ff                	test   %edi,%edi
+  8039a9:	74 06                	je     8039b1 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8039ab:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8039b1:	85 f6                	test   %esi,%esi
+  8039b3:	74 06                	je     8039bb <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8039b5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8039bb:	85 db                	test   %ebx,%ebx
+  8039bd:	74 e0                	je     80399f <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8039bf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8039c5:	eb d8                	jmp    80399f <ipc_recv_pages+0xe5>
+
+008039c7 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8039c7:	55                   	push   %ebp
+  8039c8:	89 e5                	mov    %esp,%ebp
+  8039ca:	57                   	push   %edi
+  8039cb:	56                   	push   %esi
+  8039cc:	53                   	push   %ebx
+  8039cd:	83 ec 1c             	sub    $0x1c,%esp
+  8039d0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8039d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039d6:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8039dc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8039e0:	75 2b                	jne    803a0d <ipc_try_send_pages+0x46>
+  8039e2:	89 e2                	mov    %esp,%edx
+  8039e4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8039e9:	29 d0                	sub    %edx,%eax
+  8039eb:	89 c2                	mov    %eax,%edx
+  8039ed:	c1 ea 0f             	shr    $0xf,%edx
+  8039f0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039fa:	0f 42 c2             	cmovb  %edx,%eax
+  8039fd:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803a04:	8b 70 48             	mov    0x48(%eax),%esi
+  803a07:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803a0d:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803a13:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803a18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803a1b:	85 ff                	test   %edi,%edi
+  803a1d:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803a22:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803a25:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803a2b:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803a31:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803a37:	83 ec 0c             	sub    $0xc,%esp
+  803a3a:	ff 75 14             	push   0x14(%ebp)
+  803a3d:	ff 75 18             	push   0x18(%ebp)
+  803a40:	57                   	push   %edi
+  803a41:	ff 75 0c             	push   0xc(%ebp)
+  803a44:	ff 75 08             	push   0x8(%ebp)
+  803a47:	e8 11 d7 ff ff       	call   80115d <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803a4c:	83 c4 20             	add    $0x20,%esp
+  803a4f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803a52:	75 21                	jne    803a75 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803a54:	83 ec 04             	sub    $0x4,%esp
+  803a57:	6a ff                	push   $0xffffffff
+  803a59:	53                   	push   %ebx
+  803a5a:	ff 75 e4             	push   -0x1c(%ebp)
+  803a5d:	e8 08 d9 ff ff       	call   80136a <sys_futex_wait>
+  803a62:	83 c4 10             	add    $0x10,%esp
+  803a65:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803a68:	74 c7                	je     803a31 <ipc_try_send_pages+0x6a>
+  803a6a:	85 c0                	test   %eax,%eax
+  803a6c:	79 c3                	jns    803a31 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803a6e:	e8 da d4 ff ff       	call   800f4d <sys_yield>
+  803a73:	eb bc                	jmp    803a31 <ipc_try_send_pages+0x6a>
+	}
+}
+  803a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a78:	5b                   	pop    %ebx
+  803a79:	5e                   	pop    %esi
+  803a7a:	5f                   	pop    %edi
+  803a7b:	5d                   	pop    %ebp
+  803a7c:	c3                   	ret
+
+00803a7d <ipc_send>:
+{
+  803a7d:	55                   	push   %ebp
+  803a7e:	89 e5                	mov    %esp,%ebp
+  803a80:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803a83:	ff 75 14             	push   0x14(%ebp)
+  803a86:	6a 01                	push   $0x1
+  803a88:	ff 75 10             	push   0x10(%ebp)
+  803a8b:	ff 75 0c             	push   0xc(%ebp)
+  803a8e:	ff 75 08             	push   0x8(%ebp)
+  803a91:	e8 31 ff ff ff       	call   8039c7 <ipc_try_send_pages>
+  803a96:	83 c4 20             	add    $0x20,%esp
+  803a99:	85 c0                	test   %eax,%eax
+  803a9b:	78 02                	js     803a9f <ipc_send+0x22>
+}
+  803a9d:	c9                   	leave
+  803a9e:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803a9f:	50                   	push   %eax
+  803aa0:	68 6f 46 80 00       	push   $0x80466f
+  803aa5:	6a 3f                	push   $0x3f
+  803aa7:	68 84 46 80 00       	push   $0x804684
+  803aac:	e8 f6 fc ff ff       	call   8037a7 <_panic>
+
+00803ab1 <ipc_send_pages>:
+{
+  803ab1:	55                   	push   %ebp
+  803ab2:	89 e5                	mov    %esp,%ebp
+  803ab4:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803ab7:	ff 75 18             	push   0x18(%ebp)
+  803aba:	ff 75 14             	push   0x14(%ebp)
+  803abd:	ff 75 10             	push   0x10(%ebp)
+  803ac0:	ff 75 0c             	push   0xc(%ebp)
+  803ac3:	ff 75 08             	push   0x8(%ebp)
+  803ac6:	e8 fc fe ff ff       	call   8039c7 <ipc_try_send_pages>
+  803acb:	83 c4 20             	add    $0x20,%esp
+  803ace:	85 c0                	test   %eax,%eax
+  803ad0:	78 02                	js     803ad4 <ipc_send_pages+0x23>
+}
+  803ad2:	c9                   	leave
+  803ad3:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803ad4:	50                   	push   %eax
+  803ad5:	68 8e 46 80 00       	push   $0x80468e
+  803ada:	6a 64                	push   $0x64
+  803adc:	68 84 46 80 00       	push   $0x804684
+  803ae1:	e8 c1 fc ff ff       	call   8037a7 <_panic>
+
+00803ae6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803ae6:	55                   	push   %ebp
+  803ae7:	89 e5                	mov    %esp,%ebp
+  803ae9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803aec:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803af1:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803af7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803afd:	8b 52 50             	mov    0x50(%edx),%edx
+  803b00:	39 ca                	cmp    %ecx,%edx
+  803b02:	74 11                	je     803b15 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803b04:	83 c0 01             	add    $0x1,%eax
+  803b07:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803b0c:	75 e3                	jne    803af1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b13:	eb 0e                	jmp    803b23 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803b15:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803b1b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b20:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803b23:	5d                   	pop    %ebp
+  803b24:	c3                   	ret
+
+00803b25 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b25:	55                   	push   %ebp
+  803b26:	89 e5                	mov    %esp,%ebp
+  803b28:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b2b:	89 c2                	mov    %eax,%edx
+  803b2d:	c1 ea 16             	shr    $0x16,%edx
+  803b30:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803b37:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b3c:	f6 c1 01             	test   $0x1,%cl
+  803b3f:	74 1e                	je     803b5f <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803b41:	c1 e8 0c             	shr    $0xc,%eax
+  803b44:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803b4b:	a8 01                	test   $0x1,%al
+  803b4d:	74 10                	je     803b5f <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803b4f:	c1 e8 0c             	shr    $0xc,%eax
+  803b52:	c1 e0 04             	shl    $0x4,%eax
+  803b55:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803b5c:	0f b7 d2             	movzwl %dx,%edx
+}
+  803b5f:	89 d0                	mov    %edx,%eax
+  803b61:	5d                   	pop    %ebp
+  803b62:	c3                   	ret
+
+00803b63 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  803b63:	55                   	push   %ebp
+  803b64:	89 e5                	mov    %esp,%ebp
+  803b66:	57                   	push   %edi
+  803b67:	56                   	push   %esi
+  803b68:	53                   	push   %ebx
+  803b69:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  803b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b6f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  803b72:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  803b75:	bf 38 67 80 00       	mov    $0x806738,%edi
+  803b7a:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  803b7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b82:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803b85:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  803b88:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803b8d:	f6 e2                	mul    %dl
+  803b8f:	66 c1 e8 0b          	shr    $0xb,%ax
+  803b93:	89 c7                	mov    %eax,%edi
+  803b95:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803b98:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803b9b:	01 db                	add    %ebx,%ebx
+  803b9d:	89 d0                	mov    %edx,%eax
+  803b9f:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  803ba1:	89 d6                	mov    %edx,%esi
+  803ba3:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  803ba5:	89 cb                	mov    %ecx,%ebx
+  803ba7:	83 c1 01             	add    $0x1,%ecx
+  803baa:	0f b6 fb             	movzbl %bl,%edi
+  803bad:	83 c0 30             	add    $0x30,%eax
+  803bb0:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  803bb4:	89 f0                	mov    %esi,%eax
+  803bb6:	3c 09                	cmp    $0x9,%al
+  803bb8:	77 ce                	ja     803b88 <inet_ntoa+0x25>
+  803bba:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803bbd:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803bc0:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  803bc2:	84 c9                	test   %cl,%cl
+  803bc4:	74 4d                	je     803c13 <inet_ntoa+0xb0>
+  803bc6:	0f b6 db             	movzbl %bl,%ebx
+  803bc9:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803bcc:	01 d8                	add    %ebx,%eax
+  803bce:	89 f9                	mov    %edi,%ecx
+  803bd0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  803bd3:	83 c1 01             	add    $0x1,%ecx
+  803bd6:	0f b6 10             	movzbl (%eax),%edx
+  803bd9:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  803bdc:	89 c2                	mov    %eax,%edx
+  803bde:	83 e8 01             	sub    $0x1,%eax
+  803be1:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803be4:	39 da                	cmp    %ebx,%edx
+  803be6:	75 eb                	jne    803bd3 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  803be8:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803beb:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  803bef:	8d 78 01             	lea    0x1(%eax),%edi
+  803bf2:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  803bf5:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  803bf8:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803bfb:	39 ce                	cmp    %ecx,%esi
+  803bfd:	0f 85 77 ff ff ff    	jne    803b7a <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  803c03:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  803c06:	b8 38 67 80 00       	mov    $0x806738,%eax
+  803c0b:	83 c4 1c             	add    $0x1c,%esp
+  803c0e:	5b                   	pop    %ebx
+  803c0f:	5e                   	pop    %esi
+  803c10:	5f                   	pop    %edi
+  803c11:	5d                   	pop    %ebp
+  803c12:	c3                   	ret
+    while(i--)
+  803c13:	89 f8                	mov    %edi,%eax
+  803c15:	eb d8                	jmp    803bef <inet_ntoa+0x8c>
+
+00803c17 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  803c17:	55                   	push   %ebp
+  803c18:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803c1a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803c1e:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  803c22:	5d                   	pop    %ebp
+  803c23:	c3                   	ret
+
+00803c24 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  803c24:	55                   	push   %ebp
+  803c25:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803c27:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803c2b:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  803c2f:	5d                   	pop    %ebp
+  803c30:	c3                   	ret
+
+00803c31 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  803c31:	55                   	push   %ebp
+  803c32:	89 e5                	mov    %esp,%ebp
+  803c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  803c37:	89 d0                	mov    %edx,%eax
+  803c39:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  803c3c:	89 d1                	mov    %edx,%ecx
+  803c3e:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803c41:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  803c43:	89 d1                	mov    %edx,%ecx
+  803c45:	c1 e1 08             	shl    $0x8,%ecx
+  803c48:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803c4e:	09 c8                	or     %ecx,%eax
+  803c50:	c1 ea 08             	shr    $0x8,%edx
+  803c53:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803c59:	09 d0                	or     %edx,%eax
+}
+  803c5b:	5d                   	pop    %ebp
+  803c5c:	c3                   	ret
+
+00803c5d <inet_aton>:
+{
+  803c5d:	55                   	push   %ebp
+  803c5e:	89 e5                	mov    %esp,%ebp
+  803c60:	57                   	push   %edi
+  803c61:	56                   	push   %esi
+  803c62:	53                   	push   %ebx
+  803c63:	83 ec 2c             	sub    $0x2c,%esp
+  803c66:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  803c69:	0f b6 0a             	movzbl (%edx),%ecx
+  803c6c:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803c6f:	83 e9 30             	sub    $0x30,%ecx
+  803c72:	80 f9 09             	cmp    $0x9,%cl
+  803c75:	0f 87 b6 01 00 00    	ja     803e31 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  803c7b:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  803c7e:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803c81:	e9 aa 00 00 00       	jmp    803d30 <inet_aton+0xd3>
+      c = *++cp;
+  803c86:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  803c8a:	89 c1                	mov    %eax,%ecx
+  803c8c:	83 e1 df             	and    $0xffffffdf,%ecx
+  803c8f:	80 f9 58             	cmp    $0x58,%cl
+  803c92:	74 10                	je     803ca4 <inet_aton+0x47>
+      c = *++cp;
+  803c94:	83 c2 01             	add    $0x1,%edx
+  803c97:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  803c9a:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c9f:	e9 9a 00 00 00       	jmp    803d3e <inet_aton+0xe1>
+        c = *++cp;
+  803ca4:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803ca8:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  803cab:	bf 10 00 00 00       	mov    $0x10,%edi
+  803cb0:	e9 89 00 00 00       	jmp    803d3e <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  803cb5:	0f af d7             	imul   %edi,%edx
+  803cb8:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  803cbc:	0f be 01             	movsbl (%ecx),%eax
+  803cbf:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  803cc2:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803cc5:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803cc8:	80 fb 09             	cmp    $0x9,%bl
+  803ccb:	76 e8                	jbe    803cb5 <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  803ccd:	83 ff 10             	cmp    $0x10,%edi
+  803cd0:	75 2e                	jne    803d00 <inet_aton+0xa3>
+  803cd2:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803cd6:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803cd9:	83 e3 df             	and    $0xffffffdf,%ebx
+  803cdc:	83 eb 41             	sub    $0x41,%ebx
+  803cdf:	80 fb 05             	cmp    $0x5,%bl
+  803ce2:	77 1c                	ja     803d00 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  803ce4:	c1 e2 04             	shl    $0x4,%edx
+  803ce7:	83 c0 0a             	add    $0xa,%eax
+  803cea:	89 f3                	mov    %esi,%ebx
+  803cec:	80 fb 1a             	cmp    $0x1a,%bl
+  803cef:	19 db                	sbb    %ebx,%ebx
+  803cf1:	83 e3 20             	and    $0x20,%ebx
+  803cf4:	83 c3 41             	add    $0x41,%ebx
+  803cf7:	29 d8                	sub    %ebx,%eax
+  803cf9:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  803cfb:	0f be 01             	movsbl (%ecx),%eax
+  803cfe:	eb bf                	jmp    803cbf <inet_aton+0x62>
+    if (c == '.') {
+  803d00:	83 f8 2e             	cmp    $0x2e,%eax
+  803d03:	75 46                	jne    803d4b <inet_aton+0xee>
+      if (pp >= parts + 3)
+  803d05:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803d08:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803d0b:	39 f0                	cmp    %esi,%eax
+  803d0d:	0f 84 25 01 00 00    	je     803e38 <inet_aton+0x1db>
+      *pp++ = val;
+  803d13:	83 c0 04             	add    $0x4,%eax
+  803d16:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803d19:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  803d1c:	89 ca                	mov    %ecx,%edx
+  803d1e:	0f b6 09             	movzbl (%ecx),%ecx
+  803d21:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803d24:	83 e9 30             	sub    $0x30,%ecx
+  803d27:	80 f9 09             	cmp    $0x9,%cl
+  803d2a:	0f 87 17 01 00 00    	ja     803e47 <inet_aton+0x1ea>
+    base = 10;
+  803d30:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  803d35:	83 f8 30             	cmp    $0x30,%eax
+  803d38:	0f 84 48 ff ff ff    	je     803c86 <inet_aton+0x29>
+  803d3e:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  803d41:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d46:	e9 77 ff ff ff       	jmp    803cc2 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803d4b:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803d4f:	89 d6                	mov    %edx,%esi
+  803d51:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803d54:	85 c0                	test   %eax,%eax
+  803d56:	74 2e                	je     803d86 <inet_aton+0x129>
+    return (0);
+  803d58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803d5d:	89 fa                	mov    %edi,%edx
+  803d5f:	80 fa 1f             	cmp    $0x1f,%dl
+  803d62:	0f 86 d5 00 00 00    	jbe    803e3d <inet_aton+0x1e0>
+  803d68:	84 c0                	test   %al,%al
+  803d6a:	0f 88 cd 00 00 00    	js     803e3d <inet_aton+0x1e0>
+  803d70:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803d73:	83 f9 04             	cmp    $0x4,%ecx
+  803d76:	76 0e                	jbe    803d86 <inet_aton+0x129>
+    return (0);
+  803d78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803d7d:	83 f8 20             	cmp    $0x20,%eax
+  803d80:	0f 85 b7 00 00 00    	jne    803e3d <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  803d86:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803d89:	89 d8                	mov    %ebx,%eax
+  803d8b:	29 c8                	sub    %ecx,%eax
+  803d8d:	c1 f8 02             	sar    $0x2,%eax
+  803d90:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  803d93:	83 f8 02             	cmp    $0x2,%eax
+  803d96:	74 7a                	je     803e12 <inet_aton+0x1b5>
+  803d98:	83 f9 03             	cmp    $0x3,%ecx
+  803d9b:	7f 49                	jg     803de6 <inet_aton+0x189>
+  803d9d:	85 c9                	test   %ecx,%ecx
+  803d9f:	0f 84 98 00 00 00    	je     803e3d <inet_aton+0x1e0>
+  803da5:	83 f9 02             	cmp    $0x2,%ecx
+  803da8:	75 19                	jne    803dc3 <inet_aton+0x166>
+      return (0);
+  803daa:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  803daf:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803db5:	0f 87 82 00 00 00    	ja     803e3d <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  803dbb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803dbe:	c1 e0 18             	shl    $0x18,%eax
+  803dc1:	09 c6                	or     %eax,%esi
+  return (1);
+  803dc3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  803dc8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803dcc:	74 6f                	je     803e3d <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  803dce:	83 ec 0c             	sub    $0xc,%esp
+  803dd1:	56                   	push   %esi
+  803dd2:	e8 5a fe ff ff       	call   803c31 <htonl>
+  803dd7:	83 c4 10             	add    $0x10,%esp
+  803dda:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803ddd:	89 06                	mov    %eax,(%esi)
+  return (1);
+  803ddf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803de4:	eb 57                	jmp    803e3d <inet_aton+0x1e0>
+  switch (n) {
+  803de6:	83 f9 04             	cmp    $0x4,%ecx
+  803de9:	75 d8                	jne    803dc3 <inet_aton+0x166>
+      return (0);
+  803deb:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  803df0:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803df6:	77 45                	ja     803e3d <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  803df8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803dfb:	c1 e0 18             	shl    $0x18,%eax
+  803dfe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803e01:	c1 e1 10             	shl    $0x10,%ecx
+  803e04:	09 c8                	or     %ecx,%eax
+  803e06:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803e09:	c1 e1 08             	shl    $0x8,%ecx
+  803e0c:	09 c8                	or     %ecx,%eax
+  803e0e:	09 c6                	or     %eax,%esi
+    break;
+  803e10:	eb b1                	jmp    803dc3 <inet_aton+0x166>
+      return (0);
+  803e12:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  803e17:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803e1d:	77 1e                	ja     803e3d <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  803e1f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803e22:	c1 e0 18             	shl    $0x18,%eax
+  803e25:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803e28:	c1 e1 10             	shl    $0x10,%ecx
+  803e2b:	09 c8                	or     %ecx,%eax
+  803e2d:	09 c6                	or     %eax,%esi
+    break;
+  803e2f:	eb 92                	jmp    803dc3 <inet_aton+0x166>
+      return (0);
+  803e31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e36:	eb 05                	jmp    803e3d <inet_aton+0x1e0>
+        return (0);
+  803e38:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  803e3d:	89 c8                	mov    %ecx,%eax
+  803e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e42:	5b                   	pop    %ebx
+  803e43:	5e                   	pop    %esi
+  803e44:	5f                   	pop    %edi
+  803e45:	5d                   	pop    %ebp
+  803e46:	c3                   	ret
+      return (0);
+  803e47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e4c:	eb ef                	jmp    803e3d <inet_aton+0x1e0>
+
+00803e4e <inet_addr>:
+{
+  803e4e:	55                   	push   %ebp
+  803e4f:	89 e5                	mov    %esp,%ebp
+  803e51:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  803e54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e57:	50                   	push   %eax
+  803e58:	ff 75 08             	push   0x8(%ebp)
+  803e5b:	e8 fd fd ff ff       	call   803c5d <inet_aton>
+  803e60:	89 c2                	mov    %eax,%edx
+  803e62:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  803e65:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  803e6a:	85 d2                	test   %edx,%edx
+  803e6c:	75 02                	jne    803e70 <inet_addr+0x22>
+}
+  803e6e:	c9                   	leave
+  803e6f:	c3                   	ret
+    return (val.s_addr);
+  803e70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e73:	eb f9                	jmp    803e6e <inet_addr+0x20>
+
+00803e75 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  803e75:	55                   	push   %ebp
+  803e76:	89 e5                	mov    %esp,%ebp
+  803e78:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  803e7b:	ff 75 08             	push   0x8(%ebp)
+  803e7e:	e8 ae fd ff ff       	call   803c31 <htonl>
+  803e83:	83 c4 10             	add    $0x10,%esp
+}
+  803e86:	c9                   	leave
+  803e87:	c3                   	ret
+
+00803e88 <__udivdi3>:
+  803e88:	57                   	push   %edi
+  803e89:	56                   	push   %esi
+  803e8a:	53                   	push   %ebx
+  803e8b:	83 ec 20             	sub    $0x20,%esp
+  803e8e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803e92:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803e96:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803e9a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803e9e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803ea2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803ea6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803eaa:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803eae:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ebd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803ec4:	00 
+  803ec5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ecc:	00 
+  803ecd:	eb 08                	jmp    803ed7 <__udivdi3+0x4f>
+  803ecf:	83 e9 01             	sub    $0x1,%ecx
+  803ed2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803ed5:	74 68                	je     803f3f <__udivdi3+0xb7>
+  803ed7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803edb:	01 c0                	add    %eax,%eax
+  803edd:	89 c6                	mov    %eax,%esi
+  803edf:	89 d7                	mov    %edx,%edi
+  803ee1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ee5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ee9:	0f ad d0             	shrd   %cl,%edx,%eax
+  803eec:	d3 ea                	shr    %cl,%edx
+  803eee:	f6 c1 20             	test   $0x20,%cl
+  803ef1:	74 04                	je     803ef7 <__udivdi3+0x6f>
+  803ef3:	89 d0                	mov    %edx,%eax
+  803ef5:	31 d2                	xor    %edx,%edx
+  803ef7:	83 e0 01             	and    $0x1,%eax
+  803efa:	89 04 24             	mov    %eax,(%esp)
+  803efd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f04:	00 
+  803f05:	8b 04 24             	mov    (%esp),%eax
+  803f08:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f0c:	09 f0                	or     %esi,%eax
+  803f0e:	09 fa                	or     %edi,%edx
+  803f10:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f14:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f18:	39 f0                	cmp    %esi,%eax
+  803f1a:	89 d3                	mov    %edx,%ebx
+  803f1c:	19 fb                	sbb    %edi,%ebx
+  803f1e:	72 af                	jb     803ecf <__udivdi3+0x47>
+  803f20:	29 f0                	sub    %esi,%eax
+  803f22:	19 fa                	sbb    %edi,%edx
+  803f24:	89 cf                	mov    %ecx,%edi
+  803f26:	c1 ef 05             	shr    $0x5,%edi
+  803f29:	83 e7 01             	and    $0x1,%edi
+  803f2c:	89 fe                	mov    %edi,%esi
+  803f2e:	83 f6 01             	xor    $0x1,%esi
+  803f31:	d3 e6                	shl    %cl,%esi
+  803f33:	d3 e7                	shl    %cl,%edi
+  803f35:	09 74 24 18          	or     %esi,0x18(%esp)
+  803f39:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803f3d:	eb 90                	jmp    803ecf <__udivdi3+0x47>
+  803f3f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f43:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f47:	83 c4 20             	add    $0x20,%esp
+  803f4a:	5b                   	pop    %ebx
+  803f4b:	5e                   	pop    %esi
+  803f4c:	5f                   	pop    %edi
+  803f4d:	c3                   	ret
+
+00803f4e <__umoddi3>:
+  803f4e:	57                   	push   %edi
+  803f4f:	56                   	push   %esi
+  803f50:	53                   	push   %ebx
+  803f51:	83 ec 08             	sub    $0x8,%esp
+  803f54:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f58:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f5c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803f60:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803f64:	57                   	push   %edi
+  803f65:	56                   	push   %esi
+  803f66:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f6a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f6e:	52                   	push   %edx
+  803f6f:	50                   	push   %eax
+  803f70:	e8 13 ff ff ff       	call   803e88 <__udivdi3>
+  803f75:	89 c3                	mov    %eax,%ebx
+  803f77:	0f af d6             	imul   %esi,%edx
+  803f7a:	89 f9                	mov    %edi,%ecx
+  803f7c:	0f af cb             	imul   %ebx,%ecx
+  803f7f:	01 d1                	add    %edx,%ecx
+  803f81:	89 d8                	mov    %ebx,%eax
+  803f83:	f7 e6                	mul    %esi
+  803f85:	89 c6                	mov    %eax,%esi
+  803f87:	89 d7                	mov    %edx,%edi
+  803f89:	01 cf                	add    %ecx,%edi
+  803f8b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803f8f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803f93:	29 f0                	sub    %esi,%eax
+  803f95:	19 fa                	sbb    %edi,%edx
+  803f97:	83 c4 18             	add    $0x18,%esp
+  803f9a:	5b                   	pop    %ebx
+  803f9b:	5e                   	pop    %esi
+  803f9c:	5f                   	pop    %edi
+  803f9d:	c3                   	ret
+
+00803f9e <__divdi3>:
+  803f9e:	53                   	push   %ebx
+  803f9f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803fa3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803fa7:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803fab:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803faf:	85 d2                	test   %edx,%edx
+  803fb1:	78 12                	js     803fc5 <__divdi3+0x27>
+  803fb3:	85 db                	test   %ebx,%ebx
+  803fb5:	78 2e                	js     803fe5 <__divdi3+0x47>
+  803fb7:	53                   	push   %ebx
+  803fb8:	51                   	push   %ecx
+  803fb9:	52                   	push   %edx
+  803fba:	50                   	push   %eax
+  803fbb:	e8 c8 fe ff ff       	call   803e88 <__udivdi3>
+  803fc0:	83 c4 10             	add    $0x10,%esp
+  803fc3:	eb 1e                	jmp    803fe3 <__divdi3+0x45>
+  803fc5:	f7 d8                	neg    %eax
+  803fc7:	83 d2 00             	adc    $0x0,%edx
+  803fca:	f7 da                	neg    %edx
+  803fcc:	85 db                	test   %ebx,%ebx
+  803fce:	78 2a                	js     803ffa <__divdi3+0x5c>
+  803fd0:	53                   	push   %ebx
+  803fd1:	51                   	push   %ecx
+  803fd2:	52                   	push   %edx
+  803fd3:	50                   	push   %eax
+  803fd4:	e8 af fe ff ff       	call   803e88 <__udivdi3>
+  803fd9:	83 c4 10             	add    $0x10,%esp
+  803fdc:	f7 d8                	neg    %eax
+  803fde:	83 d2 00             	adc    $0x0,%edx
+  803fe1:	f7 da                	neg    %edx
+  803fe3:	5b                   	pop    %ebx
+  803fe4:	c3                   	ret
+  803fe5:	f7 d9                	neg    %ecx
+  803fe7:	83 d3 00             	adc    $0x0,%ebx
+  803fea:	f7 db                	neg    %ebx
+  803fec:	53                   	push   %ebx
+  803fed:	51                   	push   %ecx
+  803fee:	52                   	push   %edx
+  803fef:	50                   	push   %eax
+  803ff0:	e8 93 fe ff ff       	call   803e88 <__udivdi3>
+  803ff5:	83 c4 10             	add    $0x10,%esp
+  803ff8:	eb e2                	jmp    803fdc <__divdi3+0x3e>
+  803ffa:	f7 d9                	neg    %ecx
+  803ffc:	83 d3 00             	adc    $0x0,%ebx
+  803fff:	f7 db                	neg    %ebx
+  804001:	53                   	push   %ebx
+  804002:	51                   	push   %ecx
+  804003:	52                   	push   %edx
+  804004:	50                   	push   %eax
+  804005:	e8 7e fe ff ff       	call   803e88 <__udivdi3>
+  80400a:	83 c4 10             	add    $0x10,%esp
+  80400d:	eb d4                	jmp    803fe3 <__divdi3+0x45>
+
+0080400f <__moddi3>:
+  80400f:	57                   	push   %edi
+  804010:	56                   	push   %esi
+  804011:	53                   	push   %ebx
+  804012:	83 ec 08             	sub    $0x8,%esp
+  804015:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804019:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80401d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804021:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804025:	57                   	push   %edi
+  804026:	56                   	push   %esi
+  804027:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80402b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80402f:	52                   	push   %edx
+  804030:	50                   	push   %eax
+  804031:	e8 68 ff ff ff       	call   803f9e <__divdi3>
+  804036:	89 c3                	mov    %eax,%ebx
+  804038:	0f af d6             	imul   %esi,%edx
+  80403b:	89 f9                	mov    %edi,%ecx
+  80403d:	0f af cb             	imul   %ebx,%ecx
+  804040:	01 d1                	add    %edx,%ecx
+  804042:	89 d8                	mov    %ebx,%eax
+  804044:	f7 e6                	mul    %esi
+  804046:	89 c6                	mov    %eax,%esi
+  804048:	89 d7                	mov    %edx,%edi
+  80404a:	01 cf                	add    %ecx,%edi
+  80404c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804050:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804054:	29 f0                	sub    %esi,%eax
+  804056:	19 fa                	sbb    %edi,%edx
+  804058:	83 c4 18             	add    $0x18,%esp
+  80405b:	5b                   	pop    %ebx
+  80405c:	5e                   	pop    %esi
+  80405d:	5f                   	pop    %edi
+  80405e:	c3                   	ret
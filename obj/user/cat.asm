@@ -0,0 +1,8154 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 01 00 00       	call   800137 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003d:	83 ec 04             	sub    $0x4,%esp
+  800040:	68 00 20 00 00       	push   $0x2000
+  800045:	68 40 63 80 00       	push   $0x806340
+  80004a:	56                   	push   %esi
+  80004b:	e8 f2 14 00 00       	call   801542 <read>
+  800050:	89 c3                	mov    %eax,%ebx
+  800052:	83 c4 10             	add    $0x10,%esp
+  800055:	85 c0                	test   %eax,%eax
+  800057:	7e 2f                	jle    800088 <cat+0x53>
+		if ((r = write(1, buf, n)) != n)
+  800059:	83 ec 04             	sub    $0x4,%esp
+  80005c:	53                   	push   %ebx
+  80005d:	68 40 63 80 00       	push   $0x806340
+  800062:	6a 01                	push   $0x1
+  800064:	e8 d1 15 00 00       	call   80163a <write>
+  800069:	83 c4 10             	add    $0x10,%esp
+  80006c:	39 c3                	cmp    %eax,%ebx
+  80006e:	74 cd                	je     80003d <cat+0x8>
+			panic("write error copying %s: %e", s, r);
+  800070:	83 ec 0c             	sub    $0xc,%esp
+  800073:	50                   	push   %eax
+  800074:	ff 75 0c             	push   0xc(%ebp)
+  800077:	68 80 3c 80 00       	push   $0x803c80
+  80007c:	6a 0d                	push   $0xd
+  80007e:	68 9b 3c 80 00       	push   $0x803c9b
+  800083:	e8 56 01 00 00       	call   8001de <_panic>
+	if (n < 0)
+  800088:	78 07                	js     800091 <cat+0x5c>
+		panic("error reading %s: %e", s, n);
+}
+  80008a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008d:	5b                   	pop    %ebx
+  80008e:	5e                   	pop    %esi
+  80008f:	5d                   	pop    %ebp
+  800090:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  800091:	83 ec 0c             	sub    $0xc,%esp
+  800094:	50                   	push   %eax
+  800095:	ff 75 0c             	push   0xc(%ebp)
+  800098:	68 a6 3c 80 00       	push   $0x803ca6
+  80009d:	6a 0f                	push   $0xf
+  80009f:	68 9b 3c 80 00       	push   $0x803c9b
+  8000a4:	e8 35 01 00 00       	call   8001de <_panic>
+
+008000a9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a9:	55                   	push   %ebp
+  8000aa:	89 e5                	mov    %esp,%ebp
+  8000ac:	57                   	push   %edi
+  8000ad:	56                   	push   %esi
+  8000ae:	53                   	push   %ebx
+  8000af:	83 ec 0c             	sub    $0xc,%esp
+  8000b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int f, i;
+
+	binaryname = "cat";
+  8000b5:	c7 05 00 50 80 00 bb 	movl   $0x803cbb,0x805000
+  8000bc:	3c 80 00 
+	if (argc == 1)
+  8000bf:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c3:	74 0d                	je     8000d2 <umain+0x29>
+		cat(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  8000c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8000ca:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000ce:	7f 38                	jg     800108 <umain+0x5f>
+  8000d0:	eb 12                	jmp    8000e4 <umain+0x3b>
+		cat(0, "<stdin>");
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	68 bf 3c 80 00       	push   $0x803cbf
+  8000da:	6a 00                	push   $0x0
+  8000dc:	e8 54 ff ff ff       	call   800035 <cat>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  8000e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e7:	5b                   	pop    %ebx
+  8000e8:	5e                   	pop    %esi
+  8000e9:	5f                   	pop    %edi
+  8000ea:	5d                   	pop    %ebp
+  8000eb:	c3                   	ret
+				printf("can't open %s: %e\n", argv[i], f);
+  8000ec:	83 ec 04             	sub    $0x4,%esp
+  8000ef:	50                   	push   %eax
+  8000f0:	ff 34 b7             	push   (%edi,%esi,4)
+  8000f3:	68 c7 3c 80 00       	push   $0x803cc7
+  8000f8:	e8 ba 1b 00 00       	call   801cb7 <printf>
+  8000fd:	83 c4 10             	add    $0x10,%esp
+		for (i = 1; i < argc; i++) {
+  800100:	83 c6 01             	add    $0x1,%esi
+  800103:	39 75 08             	cmp    %esi,0x8(%ebp)
+  800106:	74 dc                	je     8000e4 <umain+0x3b>
+			f = open(argv[i], O_RDONLY);
+  800108:	83 ec 08             	sub    $0x8,%esp
+  80010b:	6a 00                	push   $0x0
+  80010d:	ff 34 b7             	push   (%edi,%esi,4)
+  800110:	e8 26 19 00 00       	call   801a3b <open>
+  800115:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	78 ce                	js     8000ec <umain+0x43>
+				cat(f, argv[i]);
+  80011e:	83 ec 08             	sub    $0x8,%esp
+  800121:	ff 34 b7             	push   (%edi,%esi,4)
+  800124:	50                   	push   %eax
+  800125:	e8 0b ff ff ff       	call   800035 <cat>
+				close(f);
+  80012a:	89 1c 24             	mov    %ebx,(%esp)
+  80012d:	e8 d1 12 00 00       	call   801403 <close>
+  800132:	83 c4 10             	add    $0x10,%esp
+  800135:	eb c9                	jmp    800100 <umain+0x57>
+
+00800137 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800137:	55                   	push   %ebp
+  800138:	89 e5                	mov    %esp,%ebp
+  80013a:	56                   	push   %esi
+  80013b:	53                   	push   %ebx
+  80013c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013f:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800142:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800144:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800149:	29 d0                	sub    %edx,%eax
+  80014b:	89 c2                	mov    %eax,%edx
+  80014d:	c1 ea 0f             	shr    $0xf,%edx
+  800150:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015a:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80015d:	c7 04 85 40 83 80 00 	movl   $0x0,0x808340(,%eax,4)
+  800164:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800168:	e8 39 0c 00 00       	call   800da6 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80016d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800172:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800178:	89 e1                	mov    %esp,%ecx
+  80017a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80017f:	29 ca                	sub    %ecx,%edx
+  800181:	89 d1                	mov    %edx,%ecx
+  800183:	c1 e9 0f             	shr    $0xf,%ecx
+  800186:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80018c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800191:	0f 42 d1             	cmovb  %ecx,%edx
+  800194:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800199:	89 04 95 40 83 80 00 	mov    %eax,0x808340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001a0:	85 db                	test   %ebx,%ebx
+  8001a2:	7e 07                	jle    8001ab <libmain+0x74>
+		binaryname = argv[0];
+  8001a4:	8b 06                	mov    (%esi),%eax
+  8001a6:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8001ab:	83 ec 08             	sub    $0x8,%esp
+  8001ae:	56                   	push   %esi
+  8001af:	53                   	push   %ebx
+  8001b0:	e8 f4 fe ff ff       	call   8000a9 <umain>
+
+	// exit gracefully
+	exit();
+  8001b5:	e8 0a 00 00 00       	call   8001c4 <exit>
+}
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001c0:	5b                   	pop    %ebx
+  8001c1:	5e                   	pop    %esi
+  8001c2:	5d                   	pop    %ebp
+  8001c3:	c3                   	ret
+
+008001c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001ca:	e8 61 12 00 00       	call   801430 <close_all>
+	sys_env_destroy(0);
+  8001cf:	83 ec 0c             	sub    $0xc,%esp
+  8001d2:	6a 00                	push   $0x0
+  8001d4:	e8 8c 0b 00 00       	call   800d65 <sys_env_destroy>
+}
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	c9                   	leave
+  8001dd:	c3                   	ret
+
+008001de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e6:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001ec:	e8 b5 0b 00 00       	call   800da6 <sys_getenvid>
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+  8001f4:	ff 75 0c             	push   0xc(%ebp)
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	56                   	push   %esi
+  8001fb:	50                   	push   %eax
+  8001fc:	68 e4 3c 80 00       	push   $0x803ce4
+  800201:	e8 b3 00 00 00       	call   8002b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800206:	83 c4 18             	add    $0x18,%esp
+  800209:	53                   	push   %ebx
+  80020a:	ff 75 10             	push   0x10(%ebp)
+  80020d:	e8 56 00 00 00       	call   800268 <vcprintf>
+	cprintf("\n");
+  800212:	c7 04 24 70 41 80 00 	movl   $0x804170,(%esp)
+  800219:	e8 9b 00 00 00       	call   8002b9 <cprintf>
+  80021e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800221:	cc                   	int3
+	while (1)
+  800222:	eb fd                	jmp    800221 <_panic+0x43>
+
+00800224 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	53                   	push   %ebx
+  800228:	83 ec 04             	sub    $0x4,%esp
+  80022b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022e:	8b 13                	mov    (%ebx),%edx
+  800230:	8d 42 01             	lea    0x1(%edx),%eax
+  800233:	89 03                	mov    %eax,(%ebx)
+  800235:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800238:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80023c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800241:	74 09                	je     80024c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800243:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800247:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80024a:	c9                   	leave
+  80024b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80024c:	83 ec 08             	sub    $0x8,%esp
+  80024f:	68 ff 00 00 00       	push   $0xff
+  800254:	8d 43 08             	lea    0x8(%ebx),%eax
+  800257:	50                   	push   %eax
+  800258:	e8 cb 0a 00 00       	call   800d28 <sys_cputs>
+		b->idx = 0;
+  80025d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	eb db                	jmp    800243 <putch+0x1f>
+
+00800268 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800271:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800278:	00 00 00 
+	b.cnt = 0;
+  80027b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800282:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800285:	ff 75 0c             	push   0xc(%ebp)
+  800288:	ff 75 08             	push   0x8(%ebp)
+  80028b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800291:	50                   	push   %eax
+  800292:	68 24 02 80 00       	push   $0x800224
+  800297:	e8 1c 01 00 00       	call   8003b8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80029c:	83 c4 08             	add    $0x8,%esp
+  80029f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002ab:	50                   	push   %eax
+  8002ac:	e8 77 0a 00 00       	call   800d28 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b7:	c9                   	leave
+  8002b8:	c3                   	ret
+
+008002b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c2:	50                   	push   %eax
+  8002c3:	ff 75 08             	push   0x8(%ebp)
+  8002c6:	e8 9d ff ff ff       	call   800268 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+
+008002cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	57                   	push   %edi
+  8002d1:	56                   	push   %esi
+  8002d2:	53                   	push   %ebx
+  8002d3:	83 ec 1c             	sub    $0x1c,%esp
+  8002d6:	89 c3                	mov    %eax,%ebx
+  8002d8:	89 d6                	mov    %edx,%esi
+  8002da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002e0:	89 d1                	mov    %edx,%ecx
+  8002e2:	89 c2                	mov    %eax,%edx
+  8002e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ea:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002f7:	39 c2                	cmp    %eax,%edx
+  8002f9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002fc:	73 4b                	jae    800349 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8002fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800301:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800304:	85 ff                	test   %edi,%edi
+  800306:	7e 11                	jle    800319 <printnum+0x4c>
+			putch(padc, putdat);
+  800308:	83 ec 08             	sub    $0x8,%esp
+  80030b:	56                   	push   %esi
+  80030c:	ff 75 18             	push   0x18(%ebp)
+  80030f:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	83 ef 01             	sub    $0x1,%edi
+  800317:	75 ef                	jne    800308 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800319:	83 ec 08             	sub    $0x8,%esp
+  80031c:	56                   	push   %esi
+  80031d:	83 ec 04             	sub    $0x4,%esp
+  800320:	ff 75 e4             	push   -0x1c(%ebp)
+  800323:	ff 75 e0             	push   -0x20(%ebp)
+  800326:	ff 75 dc             	push   -0x24(%ebp)
+  800329:	ff 75 d8             	push   -0x28(%ebp)
+  80032c:	e8 3e 38 00 00       	call   803b6f <__umoddi3>
+  800331:	83 c4 14             	add    $0x14,%esp
+  800334:	0f be 80 07 3d 80 00 	movsbl 0x803d07(%eax),%eax
+  80033b:	50                   	push   %eax
+  80033c:	ff d3                	call   *%ebx
+}
+  80033e:	83 c4 10             	add    $0x10,%esp
+  800341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800344:	5b                   	pop    %ebx
+  800345:	5e                   	pop    %esi
+  800346:	5f                   	pop    %edi
+  800347:	5d                   	pop    %ebp
+  800348:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800349:	83 ec 0c             	sub    $0xc,%esp
+  80034c:	ff 75 18             	push   0x18(%ebp)
+  80034f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800352:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800355:	52                   	push   %edx
+  800356:	50                   	push   %eax
+  800357:	83 ec 08             	sub    $0x8,%esp
+  80035a:	ff 75 e4             	push   -0x1c(%ebp)
+  80035d:	ff 75 e0             	push   -0x20(%ebp)
+  800360:	ff 75 dc             	push   -0x24(%ebp)
+  800363:	ff 75 d8             	push   -0x28(%ebp)
+  800366:	e8 3e 37 00 00       	call   803aa9 <__udivdi3>
+  80036b:	83 c4 18             	add    $0x18,%esp
+  80036e:	52                   	push   %edx
+  80036f:	50                   	push   %eax
+  800370:	89 f2                	mov    %esi,%edx
+  800372:	89 d8                	mov    %ebx,%eax
+  800374:	e8 54 ff ff ff       	call   8002cd <printnum>
+  800379:	83 c4 20             	add    $0x20,%esp
+  80037c:	eb 9b                	jmp    800319 <printnum+0x4c>
+
+0080037e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80037e:	55                   	push   %ebp
+  80037f:	89 e5                	mov    %esp,%ebp
+  800381:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800384:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800388:	8b 10                	mov    (%eax),%edx
+  80038a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80038d:	73 0a                	jae    800399 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80038f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800392:	89 08                	mov    %ecx,(%eax)
+  800394:	8b 45 08             	mov    0x8(%ebp),%eax
+  800397:	88 02                	mov    %al,(%edx)
+}
+  800399:	5d                   	pop    %ebp
+  80039a:	c3                   	ret
+
+0080039b <printfmt>:
+{
+  80039b:	55                   	push   %ebp
+  80039c:	89 e5                	mov    %esp,%ebp
+  80039e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003a1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003a4:	50                   	push   %eax
+  8003a5:	ff 75 10             	push   0x10(%ebp)
+  8003a8:	ff 75 0c             	push   0xc(%ebp)
+  8003ab:	ff 75 08             	push   0x8(%ebp)
+  8003ae:	e8 05 00 00 00       	call   8003b8 <vprintfmt>
+}
+  8003b3:	83 c4 10             	add    $0x10,%esp
+  8003b6:	c9                   	leave
+  8003b7:	c3                   	ret
+
+008003b8 <vprintfmt>:
+{
+  8003b8:	55                   	push   %ebp
+  8003b9:	89 e5                	mov    %esp,%ebp
+  8003bb:	57                   	push   %edi
+  8003bc:	56                   	push   %esi
+  8003bd:	53                   	push   %ebx
+  8003be:	83 ec 2c             	sub    $0x2c,%esp
+  8003c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003c4:	89 df                	mov    %ebx,%edi
+  8003c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003c9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003cc:	8d 70 01             	lea    0x1(%eax),%esi
+  8003cf:	0f b6 00             	movzbl (%eax),%eax
+  8003d2:	83 f8 25             	cmp    $0x25,%eax
+  8003d5:	74 1e                	je     8003f5 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8003d7:	85 c0                	test   %eax,%eax
+  8003d9:	0f 84 15 05 00 00    	je     8008f4 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8003df:	83 ec 08             	sub    $0x8,%esp
+  8003e2:	53                   	push   %ebx
+  8003e3:	50                   	push   %eax
+  8003e4:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e6:	83 c6 01             	add    $0x1,%esi
+  8003e9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003ed:	83 c4 10             	add    $0x10,%esp
+  8003f0:	83 f8 25             	cmp    $0x25,%eax
+  8003f3:	75 e2                	jne    8003d7 <vprintfmt+0x1f>
+		padc = ' ';
+  8003f5:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8003f9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800400:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800407:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80040e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800413:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800416:	8d 56 01             	lea    0x1(%esi),%edx
+  800419:	0f b6 0e             	movzbl (%esi),%ecx
+  80041c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80041f:	3c 55                	cmp    $0x55,%al
+  800421:	0f 87 3b 04 00 00    	ja     800862 <vprintfmt+0x4aa>
+  800427:	0f b6 c0             	movzbl %al,%eax
+  80042a:	ff 24 85 80 3e 80 00 	jmp    *0x803e80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800431:	89 75 10             	mov    %esi,0x10(%ebp)
+  800434:	eb 93                	jmp    8003c9 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800436:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800438:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80043c:	eb d8                	jmp    800416 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043e:	89 d6                	mov    %edx,%esi
+  800440:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800444:	eb d0                	jmp    800416 <vprintfmt+0x5e>
+  800446:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800449:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80044c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80044f:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800453:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800456:	83 f9 09             	cmp    $0x9,%ecx
+  800459:	77 6f                	ja     8004ca <vprintfmt+0x112>
+  80045b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80045e:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800461:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800464:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800468:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80046b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80046e:	83 fe 09             	cmp    $0x9,%esi
+  800471:	76 eb                	jbe    80045e <vprintfmt+0xa6>
+  800473:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800476:	89 d6                	mov    %edx,%esi
+  800478:	eb 13                	jmp    80048d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80047a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047d:	8b 00                	mov    (%eax),%eax
+  80047f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800482:	8b 45 14             	mov    0x14(%ebp),%eax
+  800485:	8d 40 04             	lea    0x4(%eax),%eax
+  800488:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80048b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80048d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800491:	79 83                	jns    800416 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800493:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800496:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800499:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004a0:	e9 71 ff ff ff       	jmp    800416 <vprintfmt+0x5e>
+			if (width < 0)
+  8004a5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004a8:	85 c9                	test   %ecx,%ecx
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	0f 49 c1             	cmovns %ecx,%eax
+  8004b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b5:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004b7:	e9 5a ff ff ff       	jmp    800416 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bc:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8004be:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004c5:	e9 4c ff ff ff       	jmp    800416 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ca:	89 d6                	mov    %edx,%esi
+  8004cc:	eb bf                	jmp    80048d <vprintfmt+0xd5>
+			lflag++;
+  8004ce:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d2:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004d4:	e9 3d ff ff ff       	jmp    800416 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8004d9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8d 70 04             	lea    0x4(%eax),%esi
+  8004e2:	83 ec 08             	sub    $0x8,%esp
+  8004e5:	53                   	push   %ebx
+  8004e6:	ff 30                	push   (%eax)
+  8004e8:	ff d7                	call   *%edi
+			break;
+  8004ea:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ed:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8004f0:	e9 d4 fe ff ff       	jmp    8003c9 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8004f5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fb:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8004fe:	8b 10                	mov    (%eax),%edx
+  800500:	89 d0                	mov    %edx,%eax
+  800502:	f7 d8                	neg    %eax
+  800504:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800507:	83 f8 12             	cmp    $0x12,%eax
+  80050a:	7f 23                	jg     80052f <vprintfmt+0x177>
+  80050c:	8b 14 85 e0 3f 80 00 	mov    0x803fe0(,%eax,4),%edx
+  800513:	85 d2                	test   %edx,%edx
+  800515:	74 18                	je     80052f <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800517:	52                   	push   %edx
+  800518:	68 3b 41 80 00       	push   $0x80413b
+  80051d:	53                   	push   %ebx
+  80051e:	57                   	push   %edi
+  80051f:	e8 77 fe ff ff       	call   80039b <printfmt>
+  800524:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800527:	89 75 14             	mov    %esi,0x14(%ebp)
+  80052a:	e9 9a fe ff ff       	jmp    8003c9 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80052f:	50                   	push   %eax
+  800530:	68 1f 3d 80 00       	push   $0x803d1f
+  800535:	53                   	push   %ebx
+  800536:	57                   	push   %edi
+  800537:	e8 5f fe ff ff       	call   80039b <printfmt>
+  80053c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80053f:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800542:	e9 82 fe ff ff       	jmp    8003c9 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800547:	89 55 10             	mov    %edx,0x10(%ebp)
+  80054a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054d:	83 c0 04             	add    $0x4,%eax
+  800550:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800553:	8b 45 14             	mov    0x14(%ebp),%eax
+  800556:	8b 00                	mov    (%eax),%eax
+  800558:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80055b:	85 c0                	test   %eax,%eax
+  80055d:	0f 84 61 03 00 00    	je     8008c4 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800563:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800567:	7e 06                	jle    80056f <vprintfmt+0x1b7>
+  800569:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80056d:	75 29                	jne    800598 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80056f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800572:	8d 70 01             	lea    0x1(%eax),%esi
+  800575:	0f b6 00             	movzbl (%eax),%eax
+  800578:	0f be d0             	movsbl %al,%edx
+  80057b:	85 d2                	test   %edx,%edx
+  80057d:	0f 84 bb 00 00 00    	je     80063e <vprintfmt+0x286>
+  800583:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800586:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800589:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80058c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80058f:	eb 7a                	jmp    80060b <vprintfmt+0x253>
+				p = "(null)";
+  800591:	c7 45 d0 18 3d 80 00 	movl   $0x803d18,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800598:	83 ec 08             	sub    $0x8,%esp
+  80059b:	ff 75 d4             	push   -0x2c(%ebp)
+  80059e:	ff 75 d0             	push   -0x30(%ebp)
+  8005a1:	e8 e0 03 00 00       	call   800986 <strnlen>
+  8005a6:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005ac:	83 c4 10             	add    $0x10,%esp
+  8005af:	85 d2                	test   %edx,%edx
+  8005b1:	0f 8e d6 02 00 00    	jle    80088d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8005b7:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8005bb:	83 ec 08             	sub    $0x8,%esp
+  8005be:	53                   	push   %ebx
+  8005bf:	56                   	push   %esi
+  8005c0:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c2:	83 c4 10             	add    $0x10,%esp
+  8005c5:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8005c9:	75 f0                	jne    8005bb <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ce:	8d 70 01             	lea    0x1(%eax),%esi
+  8005d1:	0f b6 00             	movzbl (%eax),%eax
+  8005d4:	0f be d0             	movsbl %al,%edx
+  8005d7:	85 d2                	test   %edx,%edx
+  8005d9:	0f 84 da 02 00 00    	je     8008b9 <vprintfmt+0x501>
+  8005df:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005e2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005e5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005eb:	eb 1e                	jmp    80060b <vprintfmt+0x253>
+					putch(ch, putdat);
+  8005ed:	83 ec 08             	sub    $0x8,%esp
+  8005f0:	ff 75 0c             	push   0xc(%ebp)
+  8005f3:	52                   	push   %edx
+  8005f4:	ff 55 08             	call   *0x8(%ebp)
+  8005f7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005fa:	83 eb 01             	sub    $0x1,%ebx
+  8005fd:	83 c6 01             	add    $0x1,%esi
+  800600:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800604:	0f be d0             	movsbl %al,%edx
+  800607:	85 d2                	test   %edx,%edx
+  800609:	74 2a                	je     800635 <vprintfmt+0x27d>
+  80060b:	85 ff                	test   %edi,%edi
+  80060d:	78 05                	js     800614 <vprintfmt+0x25c>
+  80060f:	83 ef 01             	sub    $0x1,%edi
+  800612:	78 59                	js     80066d <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800614:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800618:	74 d3                	je     8005ed <vprintfmt+0x235>
+  80061a:	0f be c0             	movsbl %al,%eax
+  80061d:	83 e8 20             	sub    $0x20,%eax
+  800620:	83 f8 5e             	cmp    $0x5e,%eax
+  800623:	76 c8                	jbe    8005ed <vprintfmt+0x235>
+					putch('?', putdat);
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	ff 75 0c             	push   0xc(%ebp)
+  80062b:	6a 3f                	push   $0x3f
+  80062d:	ff 55 08             	call   *0x8(%ebp)
+  800630:	83 c4 10             	add    $0x10,%esp
+  800633:	eb c5                	jmp    8005fa <vprintfmt+0x242>
+  800635:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800638:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80063b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80063e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800641:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800645:	7e 1b                	jle    800662 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800647:	83 ec 08             	sub    $0x8,%esp
+  80064a:	53                   	push   %ebx
+  80064b:	6a 20                	push   $0x20
+  80064d:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80064f:	83 c4 10             	add    $0x10,%esp
+  800652:	83 ee 01             	sub    $0x1,%esi
+  800655:	75 f0                	jne    800647 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800657:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065d:	e9 67 fd ff ff       	jmp    8003c9 <vprintfmt+0x11>
+  800662:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+  800668:	e9 5c fd ff ff       	jmp    8003c9 <vprintfmt+0x11>
+  80066d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800670:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800673:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800676:	eb c6                	jmp    80063e <vprintfmt+0x286>
+	if (lflag >= 2)
+  800678:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80067b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80067e:	83 f9 01             	cmp    $0x1,%ecx
+  800681:	7f 1f                	jg     8006a2 <vprintfmt+0x2ea>
+	else if (lflag)
+  800683:	85 c9                	test   %ecx,%ecx
+  800685:	74 67                	je     8006ee <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 30                	mov    (%eax),%esi
+  80068c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80068f:	89 f0                	mov    %esi,%eax
+  800691:	c1 f8 1f             	sar    $0x1f,%eax
+  800694:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8d 40 04             	lea    0x4(%eax),%eax
+  80069d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a0:	eb 17                	jmp    8006b9 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a8:	8b 00                	mov    (%eax),%eax
+  8006aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ad:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006b9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006bc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006bf:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8006c4:	85 c9                	test   %ecx,%ecx
+  8006c6:	0f 89 12 01 00 00    	jns    8007de <vprintfmt+0x426>
+				putch('-', putdat);
+  8006cc:	83 ec 08             	sub    $0x8,%esp
+  8006cf:	53                   	push   %ebx
+  8006d0:	6a 2d                	push   $0x2d
+  8006d2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006d4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006da:	f7 da                	neg    %edx
+  8006dc:	83 d1 00             	adc    $0x0,%ecx
+  8006df:	f7 d9                	neg    %ecx
+  8006e1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006e4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006e9:	e9 f0 00 00 00       	jmp    8007de <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8b 30                	mov    (%eax),%esi
+  8006f3:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006f6:	89 f0                	mov    %esi,%eax
+  8006f8:	c1 f8 1f             	sar    $0x1f,%eax
+  8006fb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8d 40 04             	lea    0x4(%eax),%eax
+  800704:	89 45 14             	mov    %eax,0x14(%ebp)
+  800707:	eb b0                	jmp    8006b9 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800709:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80070c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80070f:	83 f9 01             	cmp    $0x1,%ecx
+  800712:	7f 1e                	jg     800732 <vprintfmt+0x37a>
+	else if (lflag)
+  800714:	85 c9                	test   %ecx,%ecx
+  800716:	74 32                	je     80074a <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 10                	mov    (%eax),%edx
+  80071d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800722:	8d 40 04             	lea    0x4(%eax),%eax
+  800725:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800728:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80072d:	e9 ac 00 00 00       	jmp    8007de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073a:	8d 40 08             	lea    0x8(%eax),%eax
+  80073d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800740:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800745:	e9 94 00 00 00       	jmp    8007de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8b 10                	mov    (%eax),%edx
+  80074f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800754:	8d 40 04             	lea    0x4(%eax),%eax
+  800757:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80075f:	eb 7d                	jmp    8007de <vprintfmt+0x426>
+	if (lflag >= 2)
+  800761:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800764:	89 55 10             	mov    %edx,0x10(%ebp)
+  800767:	83 f9 01             	cmp    $0x1,%ecx
+  80076a:	7f 1b                	jg     800787 <vprintfmt+0x3cf>
+	else if (lflag)
+  80076c:	85 c9                	test   %ecx,%ecx
+  80076e:	74 2c                	je     80079c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8b 10                	mov    (%eax),%edx
+  800775:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077a:	8d 40 04             	lea    0x4(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800780:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800785:	eb 57                	jmp    8007de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8b 10                	mov    (%eax),%edx
+  80078c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078f:	8d 40 08             	lea    0x8(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800795:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80079a:	eb 42                	jmp    8007de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8b 10                	mov    (%eax),%edx
+  8007a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ac:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8007b1:	eb 2b                	jmp    8007de <vprintfmt+0x426>
+			putch('0', putdat);
+  8007b3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007b6:	83 ec 08             	sub    $0x8,%esp
+  8007b9:	53                   	push   %ebx
+  8007ba:	6a 30                	push   $0x30
+  8007bc:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8007be:	83 c4 08             	add    $0x8,%esp
+  8007c1:	53                   	push   %ebx
+  8007c2:	6a 78                	push   $0x78
+  8007c4:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8b 10                	mov    (%eax),%edx
+  8007cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007d0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d9:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8007de:	83 ec 0c             	sub    $0xc,%esp
+  8007e1:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007e5:	50                   	push   %eax
+  8007e6:	ff 75 e4             	push   -0x1c(%ebp)
+  8007e9:	56                   	push   %esi
+  8007ea:	51                   	push   %ecx
+  8007eb:	52                   	push   %edx
+  8007ec:	89 da                	mov    %ebx,%edx
+  8007ee:	89 f8                	mov    %edi,%eax
+  8007f0:	e8 d8 fa ff ff       	call   8002cd <printnum>
+			break;
+  8007f5:	83 c4 20             	add    $0x20,%esp
+  8007f8:	e9 cc fb ff ff       	jmp    8003c9 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8007fd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800800:	89 55 10             	mov    %edx,0x10(%ebp)
+  800803:	83 f9 01             	cmp    $0x1,%ecx
+  800806:	7f 1b                	jg     800823 <vprintfmt+0x46b>
+	else if (lflag)
+  800808:	85 c9                	test   %ecx,%ecx
+  80080a:	74 2c                	je     800838 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80080c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080f:	8b 10                	mov    (%eax),%edx
+  800811:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800816:	8d 40 04             	lea    0x4(%eax),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800821:	eb bb                	jmp    8007de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800823:	8b 45 14             	mov    0x14(%ebp),%eax
+  800826:	8b 10                	mov    (%eax),%edx
+  800828:	8b 48 04             	mov    0x4(%eax),%ecx
+  80082b:	8d 40 08             	lea    0x8(%eax),%eax
+  80082e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800831:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800836:	eb a6                	jmp    8007de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8b 10                	mov    (%eax),%edx
+  80083d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800842:	8d 40 04             	lea    0x4(%eax),%eax
+  800845:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800848:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80084d:	eb 8f                	jmp    8007de <vprintfmt+0x426>
+			putch(ch, putdat);
+  80084f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800852:	83 ec 08             	sub    $0x8,%esp
+  800855:	53                   	push   %ebx
+  800856:	6a 25                	push   $0x25
+  800858:	ff d7                	call   *%edi
+			break;
+  80085a:	83 c4 10             	add    $0x10,%esp
+  80085d:	e9 67 fb ff ff       	jmp    8003c9 <vprintfmt+0x11>
+			putch('%', putdat);
+  800862:	83 ec 08             	sub    $0x8,%esp
+  800865:	53                   	push   %ebx
+  800866:	6a 25                	push   $0x25
+  800868:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80086a:	83 c4 10             	add    $0x10,%esp
+  80086d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800871:	0f 84 ba fb ff ff    	je     800431 <vprintfmt+0x79>
+  800877:	89 75 10             	mov    %esi,0x10(%ebp)
+  80087a:	89 f0                	mov    %esi,%eax
+  80087c:	83 e8 01             	sub    $0x1,%eax
+  80087f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800883:	75 f7                	jne    80087c <vprintfmt+0x4c4>
+  800885:	89 45 10             	mov    %eax,0x10(%ebp)
+  800888:	e9 3c fb ff ff       	jmp    8003c9 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80088d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800890:	8d 70 01             	lea    0x1(%eax),%esi
+  800893:	0f b6 00             	movzbl (%eax),%eax
+  800896:	0f be d0             	movsbl %al,%edx
+  800899:	85 d2                	test   %edx,%edx
+  80089b:	74 11                	je     8008ae <vprintfmt+0x4f6>
+  80089d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008a0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008a3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008a6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008a9:	e9 5d fd ff ff       	jmp    80060b <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008ae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008b1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b4:	e9 10 fb ff ff       	jmp    8003c9 <vprintfmt+0x11>
+  8008b9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008bf:	e9 05 fb ff ff       	jmp    8003c9 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8008c4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008c8:	7e 0a                	jle    8008d4 <vprintfmt+0x51c>
+  8008ca:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008ce:	0f 85 bd fc ff ff    	jne    800591 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008d4:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008d9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008de:	be 19 3d 80 00       	mov    $0x803d19,%esi
+  8008e3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008e6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008e9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008ec:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008ef:	e9 17 fd ff ff       	jmp    80060b <vprintfmt+0x253>
+}
+  8008f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008f7:	5b                   	pop    %ebx
+  8008f8:	5e                   	pop    %esi
+  8008f9:	5f                   	pop    %edi
+  8008fa:	5d                   	pop    %ebp
+  8008fb:	c3                   	ret
+
+008008fc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008fc:	55                   	push   %ebp
+  8008fd:	89 e5                	mov    %esp,%ebp
+  8008ff:	83 ec 18             	sub    $0x18,%esp
+  800902:	8b 45 08             	mov    0x8(%ebp),%eax
+  800905:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800908:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80090b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80090f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800912:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800919:	85 c0                	test   %eax,%eax
+  80091b:	74 26                	je     800943 <vsnprintf+0x47>
+  80091d:	85 d2                	test   %edx,%edx
+  80091f:	7e 22                	jle    800943 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800921:	ff 75 14             	push   0x14(%ebp)
+  800924:	ff 75 10             	push   0x10(%ebp)
+  800927:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80092a:	50                   	push   %eax
+  80092b:	68 7e 03 80 00       	push   $0x80037e
+  800930:	e8 83 fa ff ff       	call   8003b8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800935:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800938:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80093b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093e:	83 c4 10             	add    $0x10,%esp
+}
+  800941:	c9                   	leave
+  800942:	c3                   	ret
+		return -E_INVAL;
+  800943:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800948:	eb f7                	jmp    800941 <vsnprintf+0x45>
+
+0080094a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80094a:	55                   	push   %ebp
+  80094b:	89 e5                	mov    %esp,%ebp
+  80094d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800950:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800953:	50                   	push   %eax
+  800954:	ff 75 10             	push   0x10(%ebp)
+  800957:	ff 75 0c             	push   0xc(%ebp)
+  80095a:	ff 75 08             	push   0x8(%ebp)
+  80095d:	e8 9a ff ff ff       	call   8008fc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+
+00800964 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80096a:	80 3a 00             	cmpb   $0x0,(%edx)
+  80096d:	74 10                	je     80097f <strlen+0x1b>
+  80096f:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800974:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800977:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80097b:	75 f7                	jne    800974 <strlen+0x10>
+	return n;
+}
+  80097d:	5d                   	pop    %ebp
+  80097e:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80097f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800984:	eb f7                	jmp    80097d <strlen+0x19>
+
+00800986 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80098c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80098f:	85 d2                	test   %edx,%edx
+  800991:	74 16                	je     8009a9 <strnlen+0x23>
+  800993:	b8 00 00 00 00       	mov    $0x0,%eax
+  800998:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80099c:	74 09                	je     8009a7 <strnlen+0x21>
+		n++;
+  80099e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a1:	39 d0                	cmp    %edx,%eax
+  8009a3:	75 f3                	jne    800998 <strnlen+0x12>
+		n++;
+  8009a5:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ae:	eb f7                	jmp    8009a7 <strnlen+0x21>
+
+008009b0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	53                   	push   %ebx
+  8009b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009bf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009c3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009c6:	83 c0 01             	add    $0x1,%eax
+  8009c9:	84 d2                	test   %dl,%dl
+  8009cb:	75 f2                	jne    8009bf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009cd:	89 c8                	mov    %ecx,%eax
+  8009cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d2:	c9                   	leave
+  8009d3:	c3                   	ret
+
+008009d4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	53                   	push   %ebx
+  8009d8:	83 ec 10             	sub    $0x10,%esp
+  8009db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009de:	53                   	push   %ebx
+  8009df:	e8 80 ff ff ff       	call   800964 <strlen>
+  8009e4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009e7:	ff 75 0c             	push   0xc(%ebp)
+  8009ea:	01 d8                	add    %ebx,%eax
+  8009ec:	50                   	push   %eax
+  8009ed:	e8 be ff ff ff       	call   8009b0 <strcpy>
+	return dst;
+}
+  8009f2:	89 d8                	mov    %ebx,%eax
+  8009f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f7:	c9                   	leave
+  8009f8:	c3                   	ret
+
+008009f9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	56                   	push   %esi
+  8009fd:	53                   	push   %ebx
+  8009fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a07:	85 db                	test   %ebx,%ebx
+  800a09:	74 17                	je     800a22 <strncpy+0x29>
+  800a0b:	01 f3                	add    %esi,%ebx
+  800a0d:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a0f:	83 c0 01             	add    $0x1,%eax
+  800a12:	0f b6 0a             	movzbl (%edx),%ecx
+  800a15:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a18:	80 f9 01             	cmp    $0x1,%cl
+  800a1b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a1e:	39 c3                	cmp    %eax,%ebx
+  800a20:	75 ed                	jne    800a0f <strncpy+0x16>
+	}
+	return ret;
+}
+  800a22:	89 f0                	mov    %esi,%eax
+  800a24:	5b                   	pop    %ebx
+  800a25:	5e                   	pop    %esi
+  800a26:	5d                   	pop    %ebp
+  800a27:	c3                   	ret
+
+00800a28 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a28:	55                   	push   %ebp
+  800a29:	89 e5                	mov    %esp,%ebp
+  800a2b:	56                   	push   %esi
+  800a2c:	53                   	push   %ebx
+  800a2d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a36:	89 f0                	mov    %esi,%eax
+  800a38:	85 db                	test   %ebx,%ebx
+  800a3a:	74 1e                	je     800a5a <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a3c:	83 eb 01             	sub    $0x1,%ebx
+  800a3f:	74 16                	je     800a57 <strlcpy+0x2f>
+  800a41:	01 f3                	add    %esi,%ebx
+  800a43:	0f b6 0a             	movzbl (%edx),%ecx
+  800a46:	84 c9                	test   %cl,%cl
+  800a48:	74 0d                	je     800a57 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800a4a:	83 c2 01             	add    $0x1,%edx
+  800a4d:	83 c0 01             	add    $0x1,%eax
+  800a50:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800a53:	39 d8                	cmp    %ebx,%eax
+  800a55:	75 ec                	jne    800a43 <strlcpy+0x1b>
+		*dst = '\0';
+  800a57:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a5a:	29 f0                	sub    %esi,%eax
+}
+  800a5c:	5b                   	pop    %ebx
+  800a5d:	5e                   	pop    %esi
+  800a5e:	5d                   	pop    %ebp
+  800a5f:	c3                   	ret
+
+00800a60 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a60:	55                   	push   %ebp
+  800a61:	89 e5                	mov    %esp,%ebp
+  800a63:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a66:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a69:	0f b6 01             	movzbl (%ecx),%eax
+  800a6c:	84 c0                	test   %al,%al
+  800a6e:	74 11                	je     800a81 <strcmp+0x21>
+  800a70:	38 02                	cmp    %al,(%edx)
+  800a72:	75 0d                	jne    800a81 <strcmp+0x21>
+		p++, q++;
+  800a74:	83 c1 01             	add    $0x1,%ecx
+  800a77:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a7a:	0f b6 01             	movzbl (%ecx),%eax
+  800a7d:	84 c0                	test   %al,%al
+  800a7f:	75 ef                	jne    800a70 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a81:	0f b6 c0             	movzbl %al,%eax
+  800a84:	0f b6 12             	movzbl (%edx),%edx
+  800a87:	29 d0                	sub    %edx,%eax
+}
+  800a89:	5d                   	pop    %ebp
+  800a8a:	c3                   	ret
+
+00800a8b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a8b:	55                   	push   %ebp
+  800a8c:	89 e5                	mov    %esp,%ebp
+  800a8e:	53                   	push   %ebx
+  800a8f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a92:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a95:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a98:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a9d:	85 d2                	test   %edx,%edx
+  800a9f:	74 2e                	je     800acf <strncmp+0x44>
+  800aa1:	0f b6 01             	movzbl (%ecx),%eax
+  800aa4:	84 c0                	test   %al,%al
+  800aa6:	74 16                	je     800abe <strncmp+0x33>
+  800aa8:	3a 03                	cmp    (%ebx),%al
+  800aaa:	75 12                	jne    800abe <strncmp+0x33>
+		n--, p++, q++;
+  800aac:	83 c1 01             	add    $0x1,%ecx
+  800aaf:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800ab2:	83 ea 01             	sub    $0x1,%edx
+  800ab5:	75 ea                	jne    800aa1 <strncmp+0x16>
+		return 0;
+  800ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abc:	eb 11                	jmp    800acf <strncmp+0x44>
+  800abe:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800ac3:	85 d2                	test   %edx,%edx
+  800ac5:	74 08                	je     800acf <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac7:	0f b6 01             	movzbl (%ecx),%eax
+  800aca:	0f b6 13             	movzbl (%ebx),%edx
+  800acd:	29 d0                	sub    %edx,%eax
+}
+  800acf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad2:	c9                   	leave
+  800ad3:	c3                   	ret
+
+00800ad4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ada:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ade:	0f b6 10             	movzbl (%eax),%edx
+  800ae1:	84 d2                	test   %dl,%dl
+  800ae3:	74 15                	je     800afa <strchr+0x26>
+		if (*s == c)
+  800ae5:	38 d1                	cmp    %dl,%cl
+  800ae7:	74 0f                	je     800af8 <strchr+0x24>
+	for (; *s; s++)
+  800ae9:	83 c0 01             	add    $0x1,%eax
+  800aec:	0f b6 10             	movzbl (%eax),%edx
+  800aef:	84 d2                	test   %dl,%dl
+  800af1:	75 f2                	jne    800ae5 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800af3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af8:	5d                   	pop    %ebp
+  800af9:	c3                   	ret
+	return 0;
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aff:	eb f7                	jmp    800af8 <strchr+0x24>
+
+00800b01 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	53                   	push   %ebx
+  800b05:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b08:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b0b:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b0e:	38 d3                	cmp    %dl,%bl
+  800b10:	74 14                	je     800b26 <strfind+0x25>
+  800b12:	89 d1                	mov    %edx,%ecx
+  800b14:	84 db                	test   %bl,%bl
+  800b16:	74 0e                	je     800b26 <strfind+0x25>
+	for (; *s; s++)
+  800b18:	83 c0 01             	add    $0x1,%eax
+  800b1b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b1e:	38 ca                	cmp    %cl,%dl
+  800b20:	74 04                	je     800b26 <strfind+0x25>
+  800b22:	84 d2                	test   %dl,%dl
+  800b24:	75 f2                	jne    800b18 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b29:	c9                   	leave
+  800b2a:	c3                   	ret
+
+00800b2b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b2b:	55                   	push   %ebp
+  800b2c:	89 e5                	mov    %esp,%ebp
+  800b2e:	57                   	push   %edi
+  800b2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b32:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b35:	85 c9                	test   %ecx,%ecx
+  800b37:	74 20                	je     800b59 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b39:	89 f8                	mov    %edi,%eax
+  800b3b:	09 c8                	or     %ecx,%eax
+  800b3d:	a8 03                	test   $0x3,%al
+  800b3f:	75 12                	jne    800b53 <memset+0x28>
+		c &= 0xFF;
+  800b41:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b45:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b4b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b4e:	fc                   	cld
+  800b4f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b51:	eb 06                	jmp    800b59 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b56:	fc                   	cld
+  800b57:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b59:	89 f8                	mov    %edi,%eax
+  800b5b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b5e:	c9                   	leave
+  800b5f:	c3                   	ret
+
+00800b60 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	57                   	push   %edi
+  800b64:	56                   	push   %esi
+  800b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b68:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b6b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b6e:	39 c6                	cmp    %eax,%esi
+  800b70:	73 32                	jae    800ba4 <memmove+0x44>
+  800b72:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b75:	39 d0                	cmp    %edx,%eax
+  800b77:	73 2b                	jae    800ba4 <memmove+0x44>
+		s += n;
+		d += n;
+  800b79:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b7c:	89 d6                	mov    %edx,%esi
+  800b7e:	09 fe                	or     %edi,%esi
+  800b80:	09 ce                	or     %ecx,%esi
+  800b82:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b88:	75 0e                	jne    800b98 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b8a:	83 ef 04             	sub    $0x4,%edi
+  800b8d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b90:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b93:	fd                   	std
+  800b94:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b96:	eb 09                	jmp    800ba1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b98:	83 ef 01             	sub    $0x1,%edi
+  800b9b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b9e:	fd                   	std
+  800b9f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ba1:	fc                   	cld
+  800ba2:	eb 1a                	jmp    800bbe <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba4:	89 f2                	mov    %esi,%edx
+  800ba6:	09 c2                	or     %eax,%edx
+  800ba8:	09 ca                	or     %ecx,%edx
+  800baa:	f6 c2 03             	test   $0x3,%dl
+  800bad:	75 0a                	jne    800bb9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800baf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bb2:	89 c7                	mov    %eax,%edi
+  800bb4:	fc                   	cld
+  800bb5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb7:	eb 05                	jmp    800bbe <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bb9:	89 c7                	mov    %eax,%edi
+  800bbb:	fc                   	cld
+  800bbc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5f                   	pop    %edi
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	c3                   	ret
+
+00800bc2 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bc8:	ff 75 10             	push   0x10(%ebp)
+  800bcb:	ff 75 0c             	push   0xc(%ebp)
+  800bce:	ff 75 08             	push   0x8(%ebp)
+  800bd1:	e8 8a ff ff ff       	call   800b60 <memmove>
+}
+  800bd6:	c9                   	leave
+  800bd7:	c3                   	ret
+
+00800bd8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	56                   	push   %esi
+  800bdc:	53                   	push   %ebx
+  800bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be3:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800be6:	85 f6                	test   %esi,%esi
+  800be8:	74 29                	je     800c13 <memcmp+0x3b>
+  800bea:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800bec:	0f b6 08             	movzbl (%eax),%ecx
+  800bef:	0f b6 1a             	movzbl (%edx),%ebx
+  800bf2:	38 d9                	cmp    %bl,%cl
+  800bf4:	75 11                	jne    800c07 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bf6:	83 c0 01             	add    $0x1,%eax
+  800bf9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bfc:	39 c6                	cmp    %eax,%esi
+  800bfe:	75 ec                	jne    800bec <memcmp+0x14>
+	}
+
+	return 0;
+  800c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c05:	eb 08                	jmp    800c0f <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c07:	0f b6 c1             	movzbl %cl,%eax
+  800c0a:	0f b6 db             	movzbl %bl,%ebx
+  800c0d:	29 d8                	sub    %ebx,%eax
+}
+  800c0f:	5b                   	pop    %ebx
+  800c10:	5e                   	pop    %esi
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+	return 0;
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	eb f5                	jmp    800c0f <memcmp+0x37>
+
+00800c1a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c23:	89 c2                	mov    %eax,%edx
+  800c25:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c28:	39 d0                	cmp    %edx,%eax
+  800c2a:	73 0d                	jae    800c39 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c2c:	38 08                	cmp    %cl,(%eax)
+  800c2e:	74 0d                	je     800c3d <memfind+0x23>
+	for (; s < ends; s++)
+  800c30:	83 c0 01             	add    $0x1,%eax
+  800c33:	39 c2                	cmp    %eax,%edx
+  800c35:	75 f5                	jne    800c2c <memfind+0x12>
+  800c37:	eb 06                	jmp    800c3f <memfind+0x25>
+  800c39:	89 c2                	mov    %eax,%edx
+  800c3b:	eb 02                	jmp    800c3f <memfind+0x25>
+  800c3d:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c3f:	89 d0                	mov    %edx,%eax
+  800c41:	5d                   	pop    %ebp
+  800c42:	c3                   	ret
+
+00800c43 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	57                   	push   %edi
+  800c47:	56                   	push   %esi
+  800c48:	53                   	push   %ebx
+  800c49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c4f:	0f b6 02             	movzbl (%edx),%eax
+  800c52:	3c 20                	cmp    $0x20,%al
+  800c54:	74 04                	je     800c5a <strtol+0x17>
+  800c56:	3c 09                	cmp    $0x9,%al
+  800c58:	75 0e                	jne    800c68 <strtol+0x25>
+		s++;
+  800c5a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c5d:	0f b6 02             	movzbl (%edx),%eax
+  800c60:	3c 20                	cmp    $0x20,%al
+  800c62:	74 f6                	je     800c5a <strtol+0x17>
+  800c64:	3c 09                	cmp    $0x9,%al
+  800c66:	74 f2                	je     800c5a <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c68:	3c 2b                	cmp    $0x2b,%al
+  800c6a:	74 2a                	je     800c96 <strtol+0x53>
+	int neg = 0;
+  800c6c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c71:	3c 2d                	cmp    $0x2d,%al
+  800c73:	74 2b                	je     800ca0 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c75:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c7b:	75 0f                	jne    800c8c <strtol+0x49>
+  800c7d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c80:	74 28                	je     800caa <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c82:	85 db                	test   %ebx,%ebx
+  800c84:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c89:	0f 44 d8             	cmove  %eax,%ebx
+  800c8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c91:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c94:	eb 46                	jmp    800cdc <strtol+0x99>
+		s++;
+  800c96:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c99:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c9e:	eb d5                	jmp    800c75 <strtol+0x32>
+		s++, neg = 1;
+  800ca0:	83 c2 01             	add    $0x1,%edx
+  800ca3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca8:	eb cb                	jmp    800c75 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800caa:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cae:	74 0e                	je     800cbe <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800cb0:	85 db                	test   %ebx,%ebx
+  800cb2:	75 d8                	jne    800c8c <strtol+0x49>
+		s++, base = 8;
+  800cb4:	83 c2 01             	add    $0x1,%edx
+  800cb7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cbc:	eb ce                	jmp    800c8c <strtol+0x49>
+		s += 2, base = 16;
+  800cbe:	83 c2 02             	add    $0x2,%edx
+  800cc1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cc6:	eb c4                	jmp    800c8c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc8:	0f be c0             	movsbl %al,%eax
+  800ccb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cce:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd1:	7d 3a                	jge    800d0d <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800cd3:	83 c2 01             	add    $0x1,%edx
+  800cd6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cda:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cdc:	0f b6 02             	movzbl (%edx),%eax
+  800cdf:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce2:	89 f3                	mov    %esi,%ebx
+  800ce4:	80 fb 09             	cmp    $0x9,%bl
+  800ce7:	76 df                	jbe    800cc8 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cec:	89 f3                	mov    %esi,%ebx
+  800cee:	80 fb 19             	cmp    $0x19,%bl
+  800cf1:	77 08                	ja     800cfb <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800cf3:	0f be c0             	movsbl %al,%eax
+  800cf6:	83 e8 57             	sub    $0x57,%eax
+  800cf9:	eb d3                	jmp    800cce <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cfb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cfe:	89 f3                	mov    %esi,%ebx
+  800d00:	80 fb 19             	cmp    $0x19,%bl
+  800d03:	77 08                	ja     800d0d <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d05:	0f be c0             	movsbl %al,%eax
+  800d08:	83 e8 37             	sub    $0x37,%eax
+  800d0b:	eb c1                	jmp    800cce <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d0d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d11:	74 05                	je     800d18 <strtol+0xd5>
+		*endptr = (char *) s;
+  800d13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d16:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d18:	89 c8                	mov    %ecx,%eax
+  800d1a:	f7 d8                	neg    %eax
+  800d1c:	85 ff                	test   %edi,%edi
+  800d1e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d21:	89 c8                	mov    %ecx,%eax
+  800d23:	5b                   	pop    %ebx
+  800d24:	5e                   	pop    %esi
+  800d25:	5f                   	pop    %edi
+  800d26:	5d                   	pop    %ebp
+  800d27:	c3                   	ret
+
+00800d28 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	57                   	push   %edi
+  800d2c:	56                   	push   %esi
+  800d2d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	89 c3                	mov    %eax,%ebx
+  800d3b:	89 c7                	mov    %eax,%edi
+  800d3d:	89 c6                	mov    %eax,%esi
+  800d3f:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+
+00800d46 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	57                   	push   %edi
+  800d4a:	56                   	push   %esi
+  800d4b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d51:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d56:	89 d1                	mov    %edx,%ecx
+  800d58:	89 d3                	mov    %edx,%ebx
+  800d5a:	89 d7                	mov    %edx,%edi
+  800d5c:	89 d6                	mov    %edx,%esi
+  800d5e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d60:	5b                   	pop    %ebx
+  800d61:	5e                   	pop    %esi
+  800d62:	5f                   	pop    %edi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+
+00800d65 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	57                   	push   %edi
+  800d69:	56                   	push   %esi
+  800d6a:	53                   	push   %ebx
+  800d6b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d76:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d7b:	89 cb                	mov    %ecx,%ebx
+  800d7d:	89 cf                	mov    %ecx,%edi
+  800d7f:	89 ce                	mov    %ecx,%esi
+  800d81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d83:	85 c0                	test   %eax,%eax
+  800d85:	7f 08                	jg     800d8f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8f:	83 ec 0c             	sub    $0xc,%esp
+  800d92:	50                   	push   %eax
+  800d93:	6a 03                	push   $0x3
+  800d95:	68 4b 40 80 00       	push   $0x80404b
+  800d9a:	6a 23                	push   $0x23
+  800d9c:	68 68 40 80 00       	push   $0x804068
+  800da1:	e8 38 f4 ff ff       	call   8001de <_panic>
+
+00800da6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db6:	89 d1                	mov    %edx,%ecx
+  800db8:	89 d3                	mov    %edx,%ebx
+  800dba:	89 d7                	mov    %edx,%edi
+  800dbc:	89 d6                	mov    %edx,%esi
+  800dbe:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc0:	5b                   	pop    %ebx
+  800dc1:	5e                   	pop    %esi
+  800dc2:	5f                   	pop    %edi
+  800dc3:	5d                   	pop    %ebp
+  800dc4:	c3                   	ret
+
+00800dc5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	57                   	push   %edi
+  800dc9:	56                   	push   %esi
+  800dca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd5:	89 d1                	mov    %edx,%ecx
+  800dd7:	89 d3                	mov    %edx,%ebx
+  800dd9:	89 d7                	mov    %edx,%edi
+  800ddb:	89 d6                	mov    %edx,%esi
+  800ddd:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ddf:	5b                   	pop    %ebx
+  800de0:	5e                   	pop    %esi
+  800de1:	5f                   	pop    %edi
+  800de2:	5d                   	pop    %ebp
+  800de3:	c3                   	ret
+
+00800de4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800de4:	55                   	push   %ebp
+  800de5:	89 e5                	mov    %esp,%ebp
+  800de7:	57                   	push   %edi
+  800de8:	56                   	push   %esi
+  800de9:	53                   	push   %ebx
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ded:	be 00 00 00 00       	mov    $0x0,%esi
+  800df2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e00:	89 f7                	mov    %esi,%edi
+  800e02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e04:	85 c0                	test   %eax,%eax
+  800e06:	7f 08                	jg     800e10 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+  800e13:	50                   	push   %eax
+  800e14:	6a 04                	push   $0x4
+  800e16:	68 4b 40 80 00       	push   $0x80404b
+  800e1b:	6a 23                	push   $0x23
+  800e1d:	68 68 40 80 00       	push   $0x804068
+  800e22:	e8 b7 f3 ff ff       	call   8001de <_panic>
+
+00800e27 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e36:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e41:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e46:	85 c0                	test   %eax,%eax
+  800e48:	7f 08                	jg     800e52 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+  800e55:	50                   	push   %eax
+  800e56:	6a 05                	push   $0x5
+  800e58:	68 4b 40 80 00       	push   $0x80404b
+  800e5d:	6a 23                	push   $0x23
+  800e5f:	68 68 40 80 00       	push   $0x804068
+  800e64:	e8 75 f3 ff ff       	call   8001de <_panic>
+
+00800e69 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	57                   	push   %edi
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  800e6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e82:	89 df                	mov    %ebx,%edi
+  800e84:	89 de                	mov    %ebx,%esi
+  800e86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e88:	85 c0                	test   %eax,%eax
+  800e8a:	7f 08                	jg     800e94 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	50                   	push   %eax
+  800e98:	6a 06                	push   $0x6
+  800e9a:	68 4b 40 80 00       	push   $0x80404b
+  800e9f:	6a 23                	push   $0x23
+  800ea1:	68 68 40 80 00       	push   $0x804068
+  800ea6:	e8 33 f3 ff ff       	call   8001de <_panic>
+
+00800eab <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+  800eb1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec4:	89 df                	mov    %ebx,%edi
+  800ec6:	89 de                	mov    %ebx,%esi
+  800ec8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eca:	85 c0                	test   %eax,%eax
+  800ecc:	7f 08                	jg     800ed6 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed6:	83 ec 0c             	sub    $0xc,%esp
+  800ed9:	50                   	push   %eax
+  800eda:	6a 08                	push   $0x8
+  800edc:	68 4b 40 80 00       	push   $0x80404b
+  800ee1:	6a 23                	push   $0x23
+  800ee3:	68 68 40 80 00       	push   $0x804068
+  800ee8:	e8 f1 f2 ff ff       	call   8001de <_panic>
+
+00800eed <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+  800ef3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f01:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f06:	89 df                	mov    %ebx,%edi
+  800f08:	89 de                	mov    %ebx,%esi
+  800f0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0c:	85 c0                	test   %eax,%eax
+  800f0e:	7f 08                	jg     800f18 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f18:	83 ec 0c             	sub    $0xc,%esp
+  800f1b:	50                   	push   %eax
+  800f1c:	6a 09                	push   $0x9
+  800f1e:	68 4b 40 80 00       	push   $0x80404b
+  800f23:	6a 23                	push   $0x23
+  800f25:	68 68 40 80 00       	push   $0x804068
+  800f2a:	e8 af f2 ff ff       	call   8001de <_panic>
+
+00800f2f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f2f:	55                   	push   %ebp
+  800f30:	89 e5                	mov    %esp,%ebp
+  800f32:	57                   	push   %edi
+  800f33:	56                   	push   %esi
+  800f34:	53                   	push   %ebx
+  800f35:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f43:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f48:	89 df                	mov    %ebx,%edi
+  800f4a:	89 de                	mov    %ebx,%esi
+  800f4c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4e:	85 c0                	test   %eax,%eax
+  800f50:	7f 08                	jg     800f5a <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f55:	5b                   	pop    %ebx
+  800f56:	5e                   	pop    %esi
+  800f57:	5f                   	pop    %edi
+  800f58:	5d                   	pop    %ebp
+  800f59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5a:	83 ec 0c             	sub    $0xc,%esp
+  800f5d:	50                   	push   %eax
+  800f5e:	6a 0a                	push   $0xa
+  800f60:	68 4b 40 80 00       	push   $0x80404b
+  800f65:	6a 23                	push   $0x23
+  800f67:	68 68 40 80 00       	push   $0x804068
+  800f6c:	e8 6d f2 ff ff       	call   8001de <_panic>
+
+00800f71 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f82:	be 00 00 00 00       	mov    $0x0,%esi
+  800f87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+
+00800f94 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	57                   	push   %edi
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+  800f9a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800faa:	89 cb                	mov    %ecx,%ebx
+  800fac:	89 cf                	mov    %ecx,%edi
+  800fae:	89 ce                	mov    %ecx,%esi
+  800fb0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	7f 08                	jg     800fbe <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  800fc1:	50                   	push   %eax
+  800fc2:	6a 0d                	push   $0xd
+  800fc4:	68 4b 40 80 00       	push   $0x80404b
+  800fc9:	6a 23                	push   $0x23
+  800fcb:	68 68 40 80 00       	push   $0x804068
+  800fd0:	e8 09 f2 ff ff       	call   8001de <_panic>
+
+00800fd5 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	57                   	push   %edi
+  800fd9:	56                   	push   %esi
+  800fda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fec:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fef:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+
+00800ff6 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+  800ffc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801004:	8b 55 08             	mov    0x8(%ebp),%edx
+  801007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80100f:	89 df                	mov    %ebx,%edi
+  801011:	89 de                	mov    %ebx,%esi
+  801013:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801015:	85 c0                	test   %eax,%eax
+  801017:	7f 08                	jg     801021 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  801024:	50                   	push   %eax
+  801025:	6a 0d                	push   $0xd
+  801027:	68 4b 40 80 00       	push   $0x80404b
+  80102c:	6a 23                	push   $0x23
+  80102e:	68 68 40 80 00       	push   $0x804068
+  801033:	e8 a6 f1 ff ff       	call   8001de <_panic>
+
+00801038 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	57                   	push   %edi
+  80103c:	56                   	push   %esi
+  80103d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801043:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801048:	89 d1                	mov    %edx,%ecx
+  80104a:	89 d3                	mov    %edx,%ebx
+  80104c:	89 d7                	mov    %edx,%edi
+  80104e:	89 d6                	mov    %edx,%esi
+  801050:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+
+00801057 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	56                   	push   %esi
+  80105c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801062:	8b 55 08             	mov    0x8(%ebp),%edx
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80106d:	89 df                	mov    %ebx,%edi
+  80106f:	89 de                	mov    %ebx,%esi
+  801071:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801073:	5b                   	pop    %ebx
+  801074:	5e                   	pop    %esi
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+
+00801078 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	57                   	push   %edi
+  80107c:	56                   	push   %esi
+  80107d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	b8 10 00 00 00       	mov    $0x10,%eax
+  80108b:	89 cb                	mov    %ecx,%ebx
+  80108d:	89 cf                	mov    %ecx,%edi
+  80108f:	89 ce                	mov    %ecx,%esi
+  801091:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801093:	5b                   	pop    %ebx
+  801094:	5e                   	pop    %esi
+  801095:	5f                   	pop    %edi
+  801096:	5d                   	pop    %ebp
+  801097:	c3                   	ret
+
+00801098 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801098:	55                   	push   %ebp
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	57                   	push   %edi
+  80109c:	56                   	push   %esi
+  80109d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a9:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010ae:	89 df                	mov    %ebx,%edi
+  8010b0:	89 de                	mov    %ebx,%esi
+  8010b2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+
+008010b9 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	57                   	push   %edi
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ca:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010cf:	89 df                	mov    %ebx,%edi
+  8010d1:	89 de                	mov    %ebx,%esi
+  8010d3:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8010d5:	5b                   	pop    %ebx
+  8010d6:	5e                   	pop    %esi
+  8010d7:	5f                   	pop    %edi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+
+008010da <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	57                   	push   %edi
+  8010de:	56                   	push   %esi
+  8010df:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ed:	89 cb                	mov    %ecx,%ebx
+  8010ef:	89 cf                	mov    %ecx,%edi
+  8010f1:	89 ce                	mov    %ecx,%esi
+  8010f3:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801100:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801110:	89 df                	mov    %ebx,%edi
+  801112:	89 de                	mov    %ebx,%esi
+  801114:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801116:	5b                   	pop    %ebx
+  801117:	5e                   	pop    %esi
+  801118:	5f                   	pop    %edi
+  801119:	5d                   	pop    %ebp
+  80111a:	c3                   	ret
+
+0080111b <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80111b:	55                   	push   %ebp
+  80111c:	89 e5                	mov    %esp,%ebp
+  80111e:	57                   	push   %edi
+  80111f:	56                   	push   %esi
+  801120:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801121:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	b8 15 00 00 00       	mov    $0x15,%eax
+  80112e:	89 cb                	mov    %ecx,%ebx
+  801130:	89 cf                	mov    %ecx,%edi
+  801132:	89 ce                	mov    %ecx,%esi
+  801134:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+
+0080113b <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801141:	be 00 00 00 00       	mov    $0x0,%esi
+  801146:	8b 55 08             	mov    0x8(%ebp),%edx
+  801149:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801151:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801154:	89 f7                	mov    %esi,%edi
+  801156:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801158:	5b                   	pop    %ebx
+  801159:	5e                   	pop    %esi
+  80115a:	5f                   	pop    %edi
+  80115b:	5d                   	pop    %ebp
+  80115c:	c3                   	ret
+
+0080115d <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801163:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801168:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801173:	89 df                	mov    %ebx,%edi
+  801175:	89 de                	mov    %ebx,%esi
+  801177:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+
+0080117e <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	57                   	push   %edi
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801184:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801191:	89 cb                	mov    %ecx,%ebx
+  801193:	89 cf                	mov    %ecx,%edi
+  801195:	89 ce                	mov    %ecx,%esi
+  801197:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+
+0080119e <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	57                   	push   %edi
+  8011a2:	56                   	push   %esi
+  8011a3:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8011a4:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8011a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b0:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011b5:	89 df                	mov    %ebx,%edi
+  8011b7:	89 de                	mov    %ebx,%esi
+  8011b9:	cd 30                	int    $0x30
+}
+  8011bb:	5b                   	pop    %ebx
+  8011bc:	5e                   	pop    %esi
+  8011bd:	5f                   	pop    %edi
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+
+008011c0 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	57                   	push   %edi
+  8011c4:	56                   	push   %esi
+  8011c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d9:	89 f7                	mov    %esi,%edi
+  8011db:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8011dd:	5b                   	pop    %ebx
+  8011de:	5e                   	pop    %esi
+  8011df:	5f                   	pop    %edi
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+
+008011e2 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  8011e5:	57                   	push   %edi
+  8011e6:	56                   	push   %esi
+  8011e7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fb:	89 f7                	mov    %esi,%edi
+  8011fd:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8011ff:	5b                   	pop    %ebx
+  801200:	5e                   	pop    %esi
+  801201:	5f                   	pop    %edi
+  801202:	5d                   	pop    %ebp
+  801203:	c3                   	ret
+
+00801204 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801204:	55                   	push   %ebp
+  801205:	89 e5                	mov    %esp,%ebp
+  801207:	57                   	push   %edi
+  801208:	56                   	push   %esi
+  801209:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801212:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801215:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80121a:	89 df                	mov    %ebx,%edi
+  80121c:	89 de                	mov    %ebx,%esi
+  80121e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801220:	5b                   	pop    %ebx
+  801221:	5e                   	pop    %esi
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+
+00801225 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801225:	55                   	push   %ebp
+  801226:	89 e5                	mov    %esp,%ebp
+  801228:	57                   	push   %edi
+  801229:	56                   	push   %esi
+  80122a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122b:	be 00 00 00 00       	mov    $0x0,%esi
+  801230:	8b 55 08             	mov    0x8(%ebp),%edx
+  801233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801236:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80123b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123e:	89 f7                	mov    %esi,%edi
+  801240:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801242:	5b                   	pop    %ebx
+  801243:	5e                   	pop    %esi
+  801244:	5f                   	pop    %edi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+
+00801247 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80124a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80124d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801252:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801255:	5d                   	pop    %ebp
+  801256:	c3                   	ret
+
+00801257 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80125a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80125d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801262:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801267:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80126c:	5d                   	pop    %ebp
+  80126d:	c3                   	ret
+
+0080126e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801276:	89 c2                	mov    %eax,%edx
+  801278:	c1 ea 16             	shr    $0x16,%edx
+  80127b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801282:	f6 c2 01             	test   $0x1,%dl
+  801285:	74 29                	je     8012b0 <fd_alloc+0x42>
+  801287:	89 c2                	mov    %eax,%edx
+  801289:	c1 ea 0c             	shr    $0xc,%edx
+  80128c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801293:	f6 c2 01             	test   $0x1,%dl
+  801296:	74 18                	je     8012b0 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801298:	05 00 10 00 00       	add    $0x1000,%eax
+  80129d:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8012a2:	75 d2                	jne    801276 <fd_alloc+0x8>
+  8012a4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012a9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012ae:	eb 05                	jmp    8012b5 <fd_alloc+0x47>
+			return 0;
+  8012b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b8:	89 02                	mov    %eax,(%edx)
+}
+  8012ba:	89 c8                	mov    %ecx,%eax
+  8012bc:	5d                   	pop    %ebp
+  8012bd:	c3                   	ret
+
+008012be <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012c4:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8012c9:	77 30                	ja     8012fb <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012cb:	c1 e0 0c             	shl    $0xc,%eax
+  8012ce:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8012d3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012d9:	f6 c2 01             	test   $0x1,%dl
+  8012dc:	74 24                	je     801302 <fd_lookup+0x44>
+  8012de:	89 c2                	mov    %eax,%edx
+  8012e0:	c1 ea 0c             	shr    $0xc,%edx
+  8012e3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012ea:	f6 c2 01             	test   $0x1,%dl
+  8012ed:	74 1a                	je     801309 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012f2:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012f9:	5d                   	pop    %ebp
+  8012fa:	c3                   	ret
+		return -E_INVAL;
+  8012fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801300:	eb f7                	jmp    8012f9 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801302:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801307:	eb f0                	jmp    8012f9 <fd_lookup+0x3b>
+  801309:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80130e:	eb e9                	jmp    8012f9 <fd_lookup+0x3b>
+
+00801310 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	53                   	push   %ebx
+  801314:	83 ec 04             	sub    $0x4,%esp
+  801317:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80131a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131f:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801324:	39 13                	cmp    %edx,(%ebx)
+  801326:	74 54                	je     80137c <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801328:	83 c0 01             	add    $0x1,%eax
+  80132b:	8b 1c 85 f4 40 80 00 	mov    0x8040f4(,%eax,4),%ebx
+  801332:	85 db                	test   %ebx,%ebx
+  801334:	75 ee                	jne    801324 <dev_lookup+0x14>
+  801336:	89 e1                	mov    %esp,%ecx
+  801338:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80133d:	29 c8                	sub    %ecx,%eax
+  80133f:	89 c1                	mov    %eax,%ecx
+  801341:	c1 e9 0f             	shr    $0xf,%ecx
+  801344:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134e:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801351:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  801358:	8b 40 48             	mov    0x48(%eax),%eax
+  80135b:	83 ec 04             	sub    $0x4,%esp
+  80135e:	52                   	push   %edx
+  80135f:	50                   	push   %eax
+  801360:	68 78 40 80 00       	push   $0x804078
+  801365:	e8 4f ef ff ff       	call   8002b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80136a:	83 c4 10             	add    $0x10,%esp
+  80136d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801372:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801375:	89 1a                	mov    %ebx,(%edx)
+}
+  801377:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80137a:	c9                   	leave
+  80137b:	c3                   	ret
+			return 0;
+  80137c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801381:	eb ef                	jmp    801372 <dev_lookup+0x62>
+
+00801383 <fd_close>:
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	57                   	push   %edi
+  801387:	56                   	push   %esi
+  801388:	53                   	push   %ebx
+  801389:	83 ec 24             	sub    $0x24,%esp
+  80138c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80138f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801392:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801395:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801396:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80139c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80139f:	50                   	push   %eax
+  8013a0:	e8 19 ff ff ff       	call   8012be <fd_lookup>
+  8013a5:	89 c3                	mov    %eax,%ebx
+  8013a7:	83 c4 10             	add    $0x10,%esp
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 05                	js     8013b3 <fd_close+0x30>
+	    || fd != fd2)
+  8013ae:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013b1:	74 0f                	je     8013c2 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8013b3:	85 ff                	test   %edi,%edi
+  8013b5:	0f 44 df             	cmove  %edi,%ebx
+}
+  8013b8:	89 d8                	mov    %ebx,%eax
+  8013ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5f                   	pop    %edi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013c2:	83 ec 08             	sub    $0x8,%esp
+  8013c5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013c8:	50                   	push   %eax
+  8013c9:	ff 36                	push   (%esi)
+  8013cb:	e8 40 ff ff ff       	call   801310 <dev_lookup>
+  8013d0:	89 c3                	mov    %eax,%ebx
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	78 1a                	js     8013f3 <fd_close+0x70>
+		if (dev->dev_close)
+  8013d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013dc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013df:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	74 0b                	je     8013f3 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+  8013eb:	56                   	push   %esi
+  8013ec:	ff d0                	call   *%eax
+  8013ee:	89 c3                	mov    %eax,%ebx
+  8013f0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013f3:	83 ec 08             	sub    $0x8,%esp
+  8013f6:	56                   	push   %esi
+  8013f7:	6a 00                	push   $0x0
+  8013f9:	e8 6b fa ff ff       	call   800e69 <sys_page_unmap>
+	return r;
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	eb b5                	jmp    8013b8 <fd_close+0x35>
+
+00801403 <close>:
+
+int
+close(int fdnum)
+{
+  801403:	55                   	push   %ebp
+  801404:	89 e5                	mov    %esp,%ebp
+  801406:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801409:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140c:	50                   	push   %eax
+  80140d:	ff 75 08             	push   0x8(%ebp)
+  801410:	e8 a9 fe ff ff       	call   8012be <fd_lookup>
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	79 02                	jns    80141e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80141c:	c9                   	leave
+  80141d:	c3                   	ret
+		return fd_close(fd, 1);
+  80141e:	83 ec 08             	sub    $0x8,%esp
+  801421:	6a 01                	push   $0x1
+  801423:	ff 75 f4             	push   -0xc(%ebp)
+  801426:	e8 58 ff ff ff       	call   801383 <fd_close>
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	eb ec                	jmp    80141c <close+0x19>
+
+00801430 <close_all>:
+
+void
+close_all(void)
+{
+  801430:	55                   	push   %ebp
+  801431:	89 e5                	mov    %esp,%ebp
+  801433:	53                   	push   %ebx
+  801434:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801437:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80143c:	83 ec 0c             	sub    $0xc,%esp
+  80143f:	53                   	push   %ebx
+  801440:	e8 be ff ff ff       	call   801403 <close>
+	for (i = 0; i < MAXFD; i++)
+  801445:	83 c3 01             	add    $0x1,%ebx
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801451:	75 e9                	jne    80143c <close_all+0xc>
+}
+  801453:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801456:	c9                   	leave
+  801457:	c3                   	ret
+
+00801458 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801458:	55                   	push   %ebp
+  801459:	89 e5                	mov    %esp,%ebp
+  80145b:	57                   	push   %edi
+  80145c:	56                   	push   %esi
+  80145d:	53                   	push   %ebx
+  80145e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801461:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801464:	50                   	push   %eax
+  801465:	ff 75 08             	push   0x8(%ebp)
+  801468:	e8 51 fe ff ff       	call   8012be <fd_lookup>
+  80146d:	89 c3                	mov    %eax,%ebx
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	85 c0                	test   %eax,%eax
+  801474:	78 7f                	js     8014f5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801476:	83 ec 0c             	sub    $0xc,%esp
+  801479:	ff 75 0c             	push   0xc(%ebp)
+  80147c:	e8 82 ff ff ff       	call   801403 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801481:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801484:	c1 e6 0c             	shl    $0xc,%esi
+  801487:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80148d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801490:	89 3c 24             	mov    %edi,(%esp)
+  801493:	e8 bf fd ff ff       	call   801257 <fd2data>
+  801498:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80149a:	89 34 24             	mov    %esi,(%esp)
+  80149d:	e8 b5 fd ff ff       	call   801257 <fd2data>
+  8014a2:	83 c4 10             	add    $0x10,%esp
+  8014a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8014a8:	89 d8                	mov    %ebx,%eax
+  8014aa:	c1 e8 16             	shr    $0x16,%eax
+  8014ad:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014b4:	a8 01                	test   $0x1,%al
+  8014b6:	74 11                	je     8014c9 <dup+0x71>
+  8014b8:	89 d8                	mov    %ebx,%eax
+  8014ba:	c1 e8 0c             	shr    $0xc,%eax
+  8014bd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014c4:	f6 c2 01             	test   $0x1,%dl
+  8014c7:	75 36                	jne    8014ff <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014c9:	89 f8                	mov    %edi,%eax
+  8014cb:	c1 e8 0c             	shr    $0xc,%eax
+  8014ce:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014d5:	83 ec 0c             	sub    $0xc,%esp
+  8014d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014dd:	50                   	push   %eax
+  8014de:	56                   	push   %esi
+  8014df:	6a 00                	push   $0x0
+  8014e1:	57                   	push   %edi
+  8014e2:	6a 00                	push   $0x0
+  8014e4:	e8 3e f9 ff ff       	call   800e27 <sys_page_map>
+  8014e9:	89 c3                	mov    %eax,%ebx
+  8014eb:	83 c4 20             	add    $0x20,%esp
+  8014ee:	85 c0                	test   %eax,%eax
+  8014f0:	78 33                	js     801525 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014f5:	89 d8                	mov    %ebx,%eax
+  8014f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fa:	5b                   	pop    %ebx
+  8014fb:	5e                   	pop    %esi
+  8014fc:	5f                   	pop    %edi
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	25 07 0e 00 00       	and    $0xe07,%eax
+  80150e:	50                   	push   %eax
+  80150f:	ff 75 d4             	push   -0x2c(%ebp)
+  801512:	6a 00                	push   $0x0
+  801514:	53                   	push   %ebx
+  801515:	6a 00                	push   $0x0
+  801517:	e8 0b f9 ff ff       	call   800e27 <sys_page_map>
+  80151c:	89 c3                	mov    %eax,%ebx
+  80151e:	83 c4 20             	add    $0x20,%esp
+  801521:	85 c0                	test   %eax,%eax
+  801523:	79 a4                	jns    8014c9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801525:	83 ec 08             	sub    $0x8,%esp
+  801528:	56                   	push   %esi
+  801529:	6a 00                	push   $0x0
+  80152b:	e8 39 f9 ff ff       	call   800e69 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801530:	83 c4 08             	add    $0x8,%esp
+  801533:	ff 75 d4             	push   -0x2c(%ebp)
+  801536:	6a 00                	push   $0x0
+  801538:	e8 2c f9 ff ff       	call   800e69 <sys_page_unmap>
+	return r;
+  80153d:	83 c4 10             	add    $0x10,%esp
+  801540:	eb b3                	jmp    8014f5 <dup+0x9d>
+
+00801542 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801542:	55                   	push   %ebp
+  801543:	89 e5                	mov    %esp,%ebp
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+  801547:	83 ec 18             	sub    $0x18,%esp
+  80154a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80154d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801550:	50                   	push   %eax
+  801551:	53                   	push   %ebx
+  801552:	e8 67 fd ff ff       	call   8012be <fd_lookup>
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	85 c0                	test   %eax,%eax
+  80155c:	78 3c                	js     80159a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801561:	83 ec 08             	sub    $0x8,%esp
+  801564:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801567:	50                   	push   %eax
+  801568:	ff 36                	push   (%esi)
+  80156a:	e8 a1 fd ff ff       	call   801310 <dev_lookup>
+  80156f:	83 c4 10             	add    $0x10,%esp
+  801572:	85 c0                	test   %eax,%eax
+  801574:	78 24                	js     80159a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801576:	8b 46 08             	mov    0x8(%esi),%eax
+  801579:	83 e0 03             	and    $0x3,%eax
+  80157c:	83 f8 01             	cmp    $0x1,%eax
+  80157f:	74 20                	je     8015a1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801581:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801584:	8b 40 08             	mov    0x8(%eax),%eax
+  801587:	85 c0                	test   %eax,%eax
+  801589:	74 54                	je     8015df <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80158b:	83 ec 04             	sub    $0x4,%esp
+  80158e:	ff 75 10             	push   0x10(%ebp)
+  801591:	ff 75 0c             	push   0xc(%ebp)
+  801594:	56                   	push   %esi
+  801595:	ff d0                	call   *%eax
+  801597:	83 c4 10             	add    $0x10,%esp
+}
+  80159a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159d:	5b                   	pop    %ebx
+  80159e:	5e                   	pop    %esi
+  80159f:	5d                   	pop    %ebp
+  8015a0:	c3                   	ret
+  8015a1:	89 e2                	mov    %esp,%edx
+  8015a3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015a8:	29 d0                	sub    %edx,%eax
+  8015aa:	89 c2                	mov    %eax,%edx
+  8015ac:	c1 ea 0f             	shr    $0xf,%edx
+  8015af:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b9:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015bc:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  8015c3:	8b 40 48             	mov    0x48(%eax),%eax
+  8015c6:	83 ec 04             	sub    $0x4,%esp
+  8015c9:	53                   	push   %ebx
+  8015ca:	50                   	push   %eax
+  8015cb:	68 b9 40 80 00       	push   $0x8040b9
+  8015d0:	e8 e4 ec ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  8015d5:	83 c4 10             	add    $0x10,%esp
+  8015d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015dd:	eb bb                	jmp    80159a <read+0x58>
+		return -E_NOT_SUPP;
+  8015df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e4:	eb b4                	jmp    80159a <read+0x58>
+
+008015e6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	57                   	push   %edi
+  8015ea:	56                   	push   %esi
+  8015eb:	53                   	push   %ebx
+  8015ec:	83 ec 0c             	sub    $0xc,%esp
+  8015ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8015f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015f5:	85 f6                	test   %esi,%esi
+  8015f7:	74 30                	je     801629 <readn+0x43>
+  8015f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fe:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801603:	83 ec 04             	sub    $0x4,%esp
+  801606:	89 f2                	mov    %esi,%edx
+  801608:	29 c2                	sub    %eax,%edx
+  80160a:	52                   	push   %edx
+  80160b:	01 f8                	add    %edi,%eax
+  80160d:	50                   	push   %eax
+  80160e:	ff 75 08             	push   0x8(%ebp)
+  801611:	e8 2c ff ff ff       	call   801542 <read>
+		if (m < 0)
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	78 15                	js     801632 <readn+0x4c>
+			return m;
+		if (m == 0)
+  80161d:	74 11                	je     801630 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80161f:	01 c3                	add    %eax,%ebx
+  801621:	89 d8                	mov    %ebx,%eax
+  801623:	39 f3                	cmp    %esi,%ebx
+  801625:	72 dc                	jb     801603 <readn+0x1d>
+  801627:	eb 09                	jmp    801632 <readn+0x4c>
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	eb 02                	jmp    801632 <readn+0x4c>
+  801630:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801635:	5b                   	pop    %ebx
+  801636:	5e                   	pop    %esi
+  801637:	5f                   	pop    %edi
+  801638:	5d                   	pop    %ebp
+  801639:	c3                   	ret
+
+0080163a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80163a:	55                   	push   %ebp
+  80163b:	89 e5                	mov    %esp,%ebp
+  80163d:	56                   	push   %esi
+  80163e:	53                   	push   %ebx
+  80163f:	83 ec 18             	sub    $0x18,%esp
+  801642:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801645:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801648:	50                   	push   %eax
+  801649:	53                   	push   %ebx
+  80164a:	e8 6f fc ff ff       	call   8012be <fd_lookup>
+  80164f:	83 c4 10             	add    $0x10,%esp
+  801652:	85 c0                	test   %eax,%eax
+  801654:	78 37                	js     80168d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801656:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801659:	83 ec 08             	sub    $0x8,%esp
+  80165c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165f:	50                   	push   %eax
+  801660:	ff 36                	push   (%esi)
+  801662:	e8 a9 fc ff ff       	call   801310 <dev_lookup>
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	78 1f                	js     80168d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80166e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801672:	74 20                	je     801694 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801674:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801677:	8b 40 0c             	mov    0xc(%eax),%eax
+  80167a:	85 c0                	test   %eax,%eax
+  80167c:	74 54                	je     8016d2 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80167e:	83 ec 04             	sub    $0x4,%esp
+  801681:	ff 75 10             	push   0x10(%ebp)
+  801684:	ff 75 0c             	push   0xc(%ebp)
+  801687:	56                   	push   %esi
+  801688:	ff d0                	call   *%eax
+  80168a:	83 c4 10             	add    $0x10,%esp
+}
+  80168d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801690:	5b                   	pop    %ebx
+  801691:	5e                   	pop    %esi
+  801692:	5d                   	pop    %ebp
+  801693:	c3                   	ret
+  801694:	89 e2                	mov    %esp,%edx
+  801696:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80169b:	29 d0                	sub    %edx,%eax
+  80169d:	89 c2                	mov    %eax,%edx
+  80169f:	c1 ea 0f             	shr    $0xf,%edx
+  8016a2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ac:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016af:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  8016b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8016b9:	83 ec 04             	sub    $0x4,%esp
+  8016bc:	53                   	push   %ebx
+  8016bd:	50                   	push   %eax
+  8016be:	68 d5 40 80 00       	push   $0x8040d5
+  8016c3:	e8 f1 eb ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  8016c8:	83 c4 10             	add    $0x10,%esp
+  8016cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d0:	eb bb                	jmp    80168d <write+0x53>
+		return -E_NOT_SUPP;
+  8016d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d7:	eb b4                	jmp    80168d <write+0x53>
+
+008016d9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016d9:	55                   	push   %ebp
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e2:	50                   	push   %eax
+  8016e3:	ff 75 08             	push   0x8(%ebp)
+  8016e6:	e8 d3 fb ff ff       	call   8012be <fd_lookup>
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	78 0e                	js     801700 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801700:	c9                   	leave
+  801701:	c3                   	ret
+
+00801702 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	53                   	push   %ebx
+  801706:	83 ec 1c             	sub    $0x1c,%esp
+  801709:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80170c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170f:	50                   	push   %eax
+  801710:	ff 75 08             	push   0x8(%ebp)
+  801713:	e8 a6 fb ff ff       	call   8012be <fd_lookup>
+  801718:	83 c4 10             	add    $0x10,%esp
+  80171b:	85 c0                	test   %eax,%eax
+  80171d:	78 33                	js     801752 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80171f:	83 fb 03             	cmp    $0x3,%ebx
+  801722:	74 28                	je     80174c <fcntl+0x4a>
+  801724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801729:	83 fb 04             	cmp    $0x4,%ebx
+  80172c:	75 24                	jne    801752 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80172e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801731:	8b 41 08             	mov    0x8(%ecx),%eax
+  801734:	80 e4 ef             	and    $0xef,%ah
+  801737:	8b 55 10             	mov    0x10(%ebp),%edx
+  80173a:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801740:	09 d0                	or     %edx,%eax
+  801742:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174a:	eb 06                	jmp    801752 <fcntl+0x50>
+		return fd->fd_omode;
+  80174c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80174f:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801752:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801755:	c9                   	leave
+  801756:	c3                   	ret
+
+00801757 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801757:	55                   	push   %ebp
+  801758:	89 e5                	mov    %esp,%ebp
+  80175a:	56                   	push   %esi
+  80175b:	53                   	push   %ebx
+  80175c:	83 ec 18             	sub    $0x18,%esp
+  80175f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801762:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801765:	50                   	push   %eax
+  801766:	53                   	push   %ebx
+  801767:	e8 52 fb ff ff       	call   8012be <fd_lookup>
+  80176c:	83 c4 10             	add    $0x10,%esp
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	78 34                	js     8017a7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801773:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801776:	83 ec 08             	sub    $0x8,%esp
+  801779:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80177c:	50                   	push   %eax
+  80177d:	ff 36                	push   (%esi)
+  80177f:	e8 8c fb ff ff       	call   801310 <dev_lookup>
+  801784:	83 c4 10             	add    $0x10,%esp
+  801787:	85 c0                	test   %eax,%eax
+  801789:	78 1c                	js     8017a7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80178b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80178f:	74 1d                	je     8017ae <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801791:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801794:	8b 40 18             	mov    0x18(%eax),%eax
+  801797:	85 c0                	test   %eax,%eax
+  801799:	74 51                	je     8017ec <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80179b:	83 ec 08             	sub    $0x8,%esp
+  80179e:	ff 75 0c             	push   0xc(%ebp)
+  8017a1:	56                   	push   %esi
+  8017a2:	ff d0                	call   *%eax
+  8017a4:	83 c4 10             	add    $0x10,%esp
+}
+  8017a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017aa:	5b                   	pop    %ebx
+  8017ab:	5e                   	pop    %esi
+  8017ac:	5d                   	pop    %ebp
+  8017ad:	c3                   	ret
+  8017ae:	89 e2                	mov    %esp,%edx
+  8017b0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017b5:	29 d0                	sub    %edx,%eax
+  8017b7:	89 c2                	mov    %eax,%edx
+  8017b9:	c1 ea 0f             	shr    $0xf,%edx
+  8017bc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c6:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8017c9:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  8017d0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017d3:	83 ec 04             	sub    $0x4,%esp
+  8017d6:	53                   	push   %ebx
+  8017d7:	50                   	push   %eax
+  8017d8:	68 98 40 80 00       	push   $0x804098
+  8017dd:	e8 d7 ea ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ea:	eb bb                	jmp    8017a7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017f1:	eb b4                	jmp    8017a7 <ftruncate+0x50>
+
+008017f3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	56                   	push   %esi
+  8017f7:	53                   	push   %ebx
+  8017f8:	83 ec 18             	sub    $0x18,%esp
+  8017fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801801:	50                   	push   %eax
+  801802:	ff 75 08             	push   0x8(%ebp)
+  801805:	e8 b4 fa ff ff       	call   8012be <fd_lookup>
+  80180a:	83 c4 10             	add    $0x10,%esp
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	78 53                	js     801864 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801811:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801814:	83 ec 08             	sub    $0x8,%esp
+  801817:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80181a:	50                   	push   %eax
+  80181b:	ff 36                	push   (%esi)
+  80181d:	e8 ee fa ff ff       	call   801310 <dev_lookup>
+  801822:	83 c4 10             	add    $0x10,%esp
+  801825:	85 c0                	test   %eax,%eax
+  801827:	78 3b                	js     801864 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801829:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801830:	74 39                	je     80186b <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801832:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801835:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80183c:	00 00 00 
+	stat->st_isdir = 0;
+  80183f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801846:	00 00 00 
+	stat->st_version = 0;
+  801849:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801850:	00 00 00 
+	stat->st_dev = dev;
+  801853:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801859:	83 ec 08             	sub    $0x8,%esp
+  80185c:	53                   	push   %ebx
+  80185d:	56                   	push   %esi
+  80185e:	ff 50 14             	call   *0x14(%eax)
+  801861:	83 c4 10             	add    $0x10,%esp
+}
+  801864:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801867:	5b                   	pop    %ebx
+  801868:	5e                   	pop    %esi
+  801869:	5d                   	pop    %ebp
+  80186a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80186b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801870:	eb f2                	jmp    801864 <fstat+0x71>
+
+00801872 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	56                   	push   %esi
+  801876:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801877:	83 ec 08             	sub    $0x8,%esp
+  80187a:	6a 00                	push   $0x0
+  80187c:	ff 75 08             	push   0x8(%ebp)
+  80187f:	e8 b7 01 00 00       	call   801a3b <open>
+  801884:	89 c3                	mov    %eax,%ebx
+  801886:	83 c4 10             	add    $0x10,%esp
+  801889:	85 c0                	test   %eax,%eax
+  80188b:	78 1b                	js     8018a8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80188d:	83 ec 08             	sub    $0x8,%esp
+  801890:	ff 75 0c             	push   0xc(%ebp)
+  801893:	50                   	push   %eax
+  801894:	e8 5a ff ff ff       	call   8017f3 <fstat>
+  801899:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80189b:	89 1c 24             	mov    %ebx,(%esp)
+  80189e:	e8 60 fb ff ff       	call   801403 <close>
+	return r;
+  8018a3:	83 c4 10             	add    $0x10,%esp
+  8018a6:	89 f3                	mov    %esi,%ebx
+}
+  8018a8:	89 d8                	mov    %ebx,%eax
+  8018aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ad:	5b                   	pop    %ebx
+  8018ae:	5e                   	pop    %esi
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+
+008018b1 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8018b1:	55                   	push   %ebp
+  8018b2:	89 e5                	mov    %esp,%ebp
+  8018b4:	56                   	push   %esi
+  8018b5:	53                   	push   %ebx
+  8018b6:	89 c6                	mov    %eax,%esi
+  8018b8:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8018ba:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8018c1:	74 27                	je     8018ea <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018c3:	6a 07                	push   $0x7
+  8018c5:	68 00 90 80 00       	push   $0x809000
+  8018ca:	56                   	push   %esi
+  8018cb:	ff 35 00 60 80 00    	push   0x806000
+  8018d1:	e8 ed 20 00 00       	call   8039c3 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018d6:	83 c4 0c             	add    $0xc,%esp
+  8018d9:	6a 00                	push   $0x0
+  8018db:	53                   	push   %ebx
+  8018dc:	6a 00                	push   $0x0
+  8018de:	e8 50 1e 00 00       	call   803733 <ipc_recv>
+}
+  8018e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e6:	5b                   	pop    %ebx
+  8018e7:	5e                   	pop    %esi
+  8018e8:	5d                   	pop    %ebp
+  8018e9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	6a 02                	push   $0x2
+  8018ef:	e8 38 21 00 00       	call   803a2c <ipc_find_env>
+  8018f4:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018f9:	83 c4 10             	add    $0x10,%esp
+  8018fc:	eb c5                	jmp    8018c3 <fsipc+0x12>
+
+008018fe <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801904:	8b 45 08             	mov    0x8(%ebp),%eax
+  801907:	8b 40 0c             	mov    0xc(%eax),%eax
+  80190a:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  80190f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801912:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801917:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801921:	e8 8b ff ff ff       	call   8018b1 <fsipc>
+}
+  801926:	c9                   	leave
+  801927:	c3                   	ret
+
+00801928 <devfile_flush>:
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80192e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801931:	8b 40 0c             	mov    0xc(%eax),%eax
+  801934:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801939:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801943:	e8 69 ff ff ff       	call   8018b1 <fsipc>
+}
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+0080194a <devfile_stat>:
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	53                   	push   %ebx
+  80194e:	83 ec 04             	sub    $0x4,%esp
+  801951:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801954:	8b 45 08             	mov    0x8(%ebp),%eax
+  801957:	8b 40 0c             	mov    0xc(%eax),%eax
+  80195a:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80195f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801964:	b8 05 00 00 00       	mov    $0x5,%eax
+  801969:	e8 43 ff ff ff       	call   8018b1 <fsipc>
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 37                	js     8019a9 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801972:	83 ec 08             	sub    $0x8,%esp
+  801975:	68 00 90 80 00       	push   $0x809000
+  80197a:	53                   	push   %ebx
+  80197b:	e8 30 f0 ff ff       	call   8009b0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801980:	a1 80 90 80 00       	mov    0x809080,%eax
+  801985:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80198b:	a1 84 90 80 00       	mov    0x809084,%eax
+  801990:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801996:	a1 88 90 80 00       	mov    0x809088,%eax
+  80199b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8019a1:	83 c4 10             	add    $0x10,%esp
+  8019a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+
+008019ae <devfile_write>:
+{
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+  8019b1:	83 ec 0c             	sub    $0xc,%esp
+  8019b4:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8019b7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019bc:	39 d0                	cmp    %edx,%eax
+  8019be:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c4:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019c7:	89 15 00 90 80 00    	mov    %edx,0x809000
+	fsipcbuf.write.req_n = count;
+  8019cd:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8019d2:	50                   	push   %eax
+  8019d3:	ff 75 0c             	push   0xc(%ebp)
+  8019d6:	68 08 90 80 00       	push   $0x809008
+  8019db:	e8 80 f1 ff ff       	call   800b60 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8019e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019ea:	e8 c2 fe ff ff       	call   8018b1 <fsipc>
+}
+  8019ef:	c9                   	leave
+  8019f0:	c3                   	ret
+
+008019f1 <devfile_read>:
+{
+  8019f1:	55                   	push   %ebp
+  8019f2:	89 e5                	mov    %esp,%ebp
+  8019f4:	53                   	push   %ebx
+  8019f5:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fe:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  801a03:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a06:	a3 04 90 80 00       	mov    %eax,0x809004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801a0b:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801a10:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a15:	e8 97 fe ff ff       	call   8018b1 <fsipc>
+  801a1a:	89 c3                	mov    %eax,%ebx
+  801a1c:	85 c0                	test   %eax,%eax
+  801a1e:	78 14                	js     801a34 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801a20:	83 ec 04             	sub    $0x4,%esp
+  801a23:	50                   	push   %eax
+  801a24:	68 00 90 80 00       	push   $0x809000
+  801a29:	ff 75 0c             	push   0xc(%ebp)
+  801a2c:	e8 2f f1 ff ff       	call   800b60 <memmove>
+	return r;
+  801a31:	83 c4 10             	add    $0x10,%esp
+}
+  801a34:	89 d8                	mov    %ebx,%eax
+  801a36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a39:	c9                   	leave
+  801a3a:	c3                   	ret
+
+00801a3b <open>:
+{
+  801a3b:	55                   	push   %ebp
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	53                   	push   %ebx
+  801a3f:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801a42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a45:	50                   	push   %eax
+  801a46:	e8 23 f8 ff ff       	call   80126e <fd_alloc>
+  801a4b:	89 c3                	mov    %eax,%ebx
+  801a4d:	83 c4 10             	add    $0x10,%esp
+  801a50:	85 c0                	test   %eax,%eax
+  801a52:	78 2a                	js     801a7e <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801a54:	83 ec 0c             	sub    $0xc,%esp
+  801a57:	ff 75 08             	push   0x8(%ebp)
+  801a5a:	e8 05 ef ff ff       	call   800964 <strlen>
+  801a5f:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801a62:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801a67:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a6c:	7e 17                	jle    801a85 <open+0x4a>
+	fd_close(fd, 1);
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  801a71:	6a 01                	push   $0x1
+  801a73:	ff 75 f4             	push   -0xc(%ebp)
+  801a76:	e8 08 f9 ff ff       	call   801383 <fd_close>
+	return r;
+  801a7b:	83 c4 10             	add    $0x10,%esp
+}
+  801a7e:	89 d8                	mov    %ebx,%eax
+  801a80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a83:	c9                   	leave
+  801a84:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a85:	83 ec 08             	sub    $0x8,%esp
+  801a88:	ff 75 08             	push   0x8(%ebp)
+  801a8b:	68 00 90 80 00       	push   $0x809000
+  801a90:	e8 1b ef ff ff       	call   8009b0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a98:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a9d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801aa0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aa5:	e8 07 fe ff ff       	call   8018b1 <fsipc>
+  801aaa:	89 c3                	mov    %eax,%ebx
+  801aac:	83 c4 10             	add    $0x10,%esp
+  801aaf:	85 c0                	test   %eax,%eax
+  801ab1:	78 bb                	js     801a6e <open+0x33>
+	return fd2num(fd); 	
+  801ab3:	83 ec 0c             	sub    $0xc,%esp
+  801ab6:	ff 75 f4             	push   -0xc(%ebp)
+  801ab9:	e8 89 f7 ff ff       	call   801247 <fd2num>
+  801abe:	89 c3                	mov    %eax,%ebx
+  801ac0:	83 c4 10             	add    $0x10,%esp
+  801ac3:	eb b9                	jmp    801a7e <open+0x43>
+
+00801ac5 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	53                   	push   %ebx
+  801ac9:	83 ec 1c             	sub    $0x1c,%esp
+  801acc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801acf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad2:	50                   	push   %eax
+  801ad3:	ff 75 08             	push   0x8(%ebp)
+  801ad6:	e8 e3 f7 ff ff       	call   8012be <fd_lookup>
+  801adb:	83 c4 10             	add    $0x10,%esp
+  801ade:	85 c0                	test   %eax,%eax
+  801ae0:	78 5a                	js     801b3c <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ae2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae5:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801aeb:	39 10                	cmp    %edx,(%eax)
+  801aed:	75 66                	jne    801b55 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801aef:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801af6:	74 49                	je     801b41 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801af8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801afb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801afe:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.map.req_offset = offset;
+  801b03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b06:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.map.req_npages = maxpages;
+  801b0b:	89 1d 08 90 80 00    	mov    %ebx,0x809008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b11:	6a 07                	push   $0x7
+  801b13:	68 00 90 80 00       	push   $0x809000
+  801b18:	6a 09                	push   $0x9
+  801b1a:	ff 35 00 60 80 00    	push   0x806000
+  801b20:	e8 9e 1e 00 00       	call   8039c3 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801b25:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b2c:	6a 00                	push   $0x0
+  801b2e:	53                   	push   %ebx
+  801b2f:	ff 75 10             	push   0x10(%ebp)
+  801b32:	6a 00                	push   $0x0
+  801b34:	e8 c7 1c 00 00       	call   803800 <ipc_recv_pages>
+  801b39:	83 c4 20             	add    $0x20,%esp
+}
+  801b3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b3f:	c9                   	leave
+  801b40:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b41:	83 ec 0c             	sub    $0xc,%esp
+  801b44:	6a 02                	push   $0x2
+  801b46:	e8 e1 1e 00 00       	call   803a2c <ipc_find_env>
+  801b4b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b50:	83 c4 10             	add    $0x10,%esp
+  801b53:	eb a3                	jmp    801af8 <fmap+0x33>
+		return -E_INVAL;
+  801b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b5a:	eb e0                	jmp    801b3c <fmap+0x77>
+
+00801b5c <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b5c:	55                   	push   %ebp
+  801b5d:	89 e5                	mov    %esp,%ebp
+  801b5f:	53                   	push   %ebx
+  801b60:	83 ec 10             	sub    $0x10,%esp
+  801b63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b66:	53                   	push   %ebx
+  801b67:	e8 f8 ed ff ff       	call   800964 <strlen>
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b74:	7f 25                	jg     801b9b <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b76:	83 ec 08             	sub    $0x8,%esp
+  801b79:	53                   	push   %ebx
+  801b7a:	68 00 90 80 00       	push   $0x809000
+  801b7f:	e8 2c ee ff ff       	call   8009b0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b89:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b8e:	e8 1e fd ff ff       	call   8018b1 <fsipc>
+  801b93:	83 c4 10             	add    $0x10,%esp
+}
+  801b96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b99:	c9                   	leave
+  801b9a:	c3                   	ret
+		return -E_BAD_PATH;
+  801b9b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801ba0:	eb f4                	jmp    801b96 <remove+0x3a>
+
+00801ba2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bad:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bb2:	e8 fa fc ff ff       	call   8018b1 <fsipc>
+}
+  801bb7:	c9                   	leave
+  801bb8:	c3                   	ret
+
+00801bb9 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801bb9:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801bbd:	7f 01                	jg     801bc0 <writebuf+0x7>
+  801bbf:	c3                   	ret
+{
+  801bc0:	55                   	push   %ebp
+  801bc1:	89 e5                	mov    %esp,%ebp
+  801bc3:	53                   	push   %ebx
+  801bc4:	83 ec 08             	sub    $0x8,%esp
+  801bc7:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801bc9:	ff 70 04             	push   0x4(%eax)
+  801bcc:	8d 40 10             	lea    0x10(%eax),%eax
+  801bcf:	50                   	push   %eax
+  801bd0:	ff 33                	push   (%ebx)
+  801bd2:	e8 63 fa ff ff       	call   80163a <write>
+		if (result > 0)
+  801bd7:	83 c4 10             	add    $0x10,%esp
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	7e 03                	jle    801be1 <writebuf+0x28>
+			b->result += result;
+  801bde:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801be1:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801be4:	74 0d                	je     801bf3 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bed:	0f 4f c2             	cmovg  %edx,%eax
+  801bf0:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801bf3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+
+00801bf8 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	53                   	push   %ebx
+  801bfc:	83 ec 04             	sub    $0x4,%esp
+  801bff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801c02:	8b 53 04             	mov    0x4(%ebx),%edx
+  801c05:	8d 42 01             	lea    0x1(%edx),%eax
+  801c08:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c0b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c0e:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801c12:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801c17:	74 05                	je     801c1e <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c1c:	c9                   	leave
+  801c1d:	c3                   	ret
+		writebuf(b);
+  801c1e:	89 d8                	mov    %ebx,%eax
+  801c20:	e8 94 ff ff ff       	call   801bb9 <writebuf>
+		b->idx = 0;
+  801c25:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801c2c:	eb eb                	jmp    801c19 <putch+0x21>
+
+00801c2e <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801c2e:	55                   	push   %ebp
+  801c2f:	89 e5                	mov    %esp,%ebp
+  801c31:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801c37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c3a:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801c40:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801c47:	00 00 00 
+	b.result = 0;
+  801c4a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801c51:	00 00 00 
+	b.error = 1;
+  801c54:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801c5b:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801c5e:	ff 75 10             	push   0x10(%ebp)
+  801c61:	ff 75 0c             	push   0xc(%ebp)
+  801c64:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801c6a:	50                   	push   %eax
+  801c6b:	68 f8 1b 80 00       	push   $0x801bf8
+  801c70:	e8 43 e7 ff ff       	call   8003b8 <vprintfmt>
+	if (b.idx > 0)
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801c7f:	7f 12                	jg     801c93 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801c81:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	75 06                	jne    801c91 <vfprintf+0x63>
+  801c8b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801c91:	c9                   	leave
+  801c92:	c3                   	ret
+		writebuf(&b);
+  801c93:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801c99:	e8 1b ff ff ff       	call   801bb9 <writebuf>
+  801c9e:	eb e1                	jmp    801c81 <vfprintf+0x53>
+
+00801ca0 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801ca0:	55                   	push   %ebp
+  801ca1:	89 e5                	mov    %esp,%ebp
+  801ca3:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801ca6:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801ca9:	50                   	push   %eax
+  801caa:	ff 75 0c             	push   0xc(%ebp)
+  801cad:	ff 75 08             	push   0x8(%ebp)
+  801cb0:	e8 79 ff ff ff       	call   801c2e <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801cb5:	c9                   	leave
+  801cb6:	c3                   	ret
+
+00801cb7 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+  801cba:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801cbd:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801cc0:	50                   	push   %eax
+  801cc1:	ff 75 08             	push   0x8(%ebp)
+  801cc4:	6a 01                	push   $0x1
+  801cc6:	e8 63 ff ff ff       	call   801c2e <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801ccb:	c9                   	leave
+  801ccc:	c3                   	ret
+
+00801ccd <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ccd:	55                   	push   %ebp
+  801cce:	89 e5                	mov    %esp,%ebp
+  801cd0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801cd3:	68 08 41 80 00       	push   $0x804108
+  801cd8:	ff 75 0c             	push   0xc(%ebp)
+  801cdb:	e8 d0 ec ff ff       	call   8009b0 <strcpy>
+	return 0;
+}
+  801ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce5:	c9                   	leave
+  801ce6:	c3                   	ret
+
+00801ce7 <devsock_close>:
+{
+  801ce7:	55                   	push   %ebp
+  801ce8:	89 e5                	mov    %esp,%ebp
+  801cea:	53                   	push   %ebx
+  801ceb:	83 ec 10             	sub    $0x10,%esp
+  801cee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cf1:	53                   	push   %ebx
+  801cf2:	e8 74 1d 00 00       	call   803a6b <pageref>
+  801cf7:	89 c2                	mov    %eax,%edx
+  801cf9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d01:	83 fa 01             	cmp    $0x1,%edx
+  801d04:	74 05                	je     801d0b <devsock_close+0x24>
+}
+  801d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d09:	c9                   	leave
+  801d0a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d0b:	83 ec 0c             	sub    $0xc,%esp
+  801d0e:	ff 73 0c             	push   0xc(%ebx)
+  801d11:	e8 b0 05 00 00       	call   8022c6 <nsipc_close>
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	eb eb                	jmp    801d06 <devsock_close+0x1f>
+
+00801d1b <devsock_write>:
+{
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	53                   	push   %ebx
+  801d1f:	83 ec 14             	sub    $0x14,%esp
+  801d22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d28:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801d2b:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801d2e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801d31:	8b 41 08             	mov    0x8(%ecx),%eax
+  801d34:	c1 f8 09             	sar    $0x9,%eax
+  801d37:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801d3a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801d40:	77 13                	ja     801d55 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801d42:	50                   	push   %eax
+  801d43:	52                   	push   %edx
+  801d44:	53                   	push   %ebx
+  801d45:	ff 71 0c             	push   0xc(%ecx)
+  801d48:	e8 5c 06 00 00       	call   8023a9 <nsipc_send>
+  801d4d:	83 c4 10             	add    $0x10,%esp
+}
+  801d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d53:	c9                   	leave
+  801d54:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801d55:	50                   	push   %eax
+  801d56:	6a 01                	push   $0x1
+  801d58:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d5b:	50                   	push   %eax
+  801d5c:	ff 71 0c             	push   0xc(%ecx)
+  801d5f:	e8 a6 06 00 00       	call   80240a <nsipc_sendmsg>
+  801d64:	83 c4 10             	add    $0x10,%esp
+  801d67:	eb e7                	jmp    801d50 <devsock_write+0x35>
+
+00801d69 <devsock_read>:
+{
+  801d69:	55                   	push   %ebp
+  801d6a:	89 e5                	mov    %esp,%ebp
+  801d6c:	53                   	push   %ebx
+  801d6d:	83 ec 14             	sub    $0x14,%esp
+  801d70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d76:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801d79:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801d7c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801d7f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801d82:	c1 f8 09             	sar    $0x9,%eax
+  801d85:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801d88:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801d8e:	77 13                	ja     801da3 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801d90:	50                   	push   %eax
+  801d91:	52                   	push   %edx
+  801d92:	53                   	push   %ebx
+  801d93:	ff 71 0c             	push   0xc(%ecx)
+  801d96:	e8 9c 05 00 00       	call   802337 <nsipc_recv>
+  801d9b:	83 c4 10             	add    $0x10,%esp
+}
+  801d9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801da1:	c9                   	leave
+  801da2:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801da3:	50                   	push   %eax
+  801da4:	6a 01                	push   $0x1
+  801da6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801da9:	50                   	push   %eax
+  801daa:	ff 71 0c             	push   0xc(%ecx)
+  801dad:	e8 02 0a 00 00       	call   8027b4 <nsipc_recvmsg>
+  801db2:	83 c4 10             	add    $0x10,%esp
+  801db5:	eb e7                	jmp    801d9e <devsock_read+0x35>
+
+00801db7 <fd2sockid>:
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801dbd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801dc0:	52                   	push   %edx
+  801dc1:	50                   	push   %eax
+  801dc2:	e8 f7 f4 ff ff       	call   8012be <fd_lookup>
+  801dc7:	83 c4 10             	add    $0x10,%esp
+  801dca:	85 c0                	test   %eax,%eax
+  801dcc:	78 10                	js     801dde <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801dce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd1:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801dd7:	39 08                	cmp    %ecx,(%eax)
+  801dd9:	75 05                	jne    801de0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ddb:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801dde:	c9                   	leave
+  801ddf:	c3                   	ret
+		return -E_NOT_SUPP;
+  801de0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801de5:	eb f7                	jmp    801dde <fd2sockid+0x27>
+
+00801de7 <sock_flags>:
+{
+  801de7:	55                   	push   %ebp
+  801de8:	89 e5                	mov    %esp,%ebp
+  801dea:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801ded:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801df0:	52                   	push   %edx
+  801df1:	50                   	push   %eax
+  801df2:	e8 c7 f4 ff ff       	call   8012be <fd_lookup>
+  801df7:	83 c4 10             	add    $0x10,%esp
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	78 0e                	js     801e0c <sock_flags+0x25>
+  801dfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e01:	8b 40 08             	mov    0x8(%eax),%eax
+  801e04:	c1 e8 09             	shr    $0x9,%eax
+  801e07:	83 e0 08             	and    $0x8,%eax
+}
+  801e0a:	c9                   	leave
+  801e0b:	c3                   	ret
+		return 0;
+  801e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e11:	eb f7                	jmp    801e0a <sock_flags+0x23>
+
+00801e13 <alloc_sockfd>:
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	56                   	push   %esi
+  801e17:	53                   	push   %ebx
+  801e18:	83 ec 1c             	sub    $0x1c,%esp
+  801e1b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801e1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e20:	50                   	push   %eax
+  801e21:	e8 48 f4 ff ff       	call   80126e <fd_alloc>
+  801e26:	89 c3                	mov    %eax,%ebx
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	85 c0                	test   %eax,%eax
+  801e2d:	78 43                	js     801e72 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801e2f:	83 ec 04             	sub    $0x4,%esp
+  801e32:	68 07 04 00 00       	push   $0x407
+  801e37:	ff 75 f4             	push   -0xc(%ebp)
+  801e3a:	6a 00                	push   $0x0
+  801e3c:	e8 a3 ef ff ff       	call   800de4 <sys_page_alloc>
+  801e41:	89 c3                	mov    %eax,%ebx
+  801e43:	83 c4 10             	add    $0x10,%esp
+  801e46:	85 c0                	test   %eax,%eax
+  801e48:	78 28                	js     801e72 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801e4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e4d:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801e53:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801e55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e58:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801e5f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	50                   	push   %eax
+  801e66:	e8 dc f3 ff ff       	call   801247 <fd2num>
+  801e6b:	89 c3                	mov    %eax,%ebx
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	eb 0c                	jmp    801e7e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e72:	83 ec 0c             	sub    $0xc,%esp
+  801e75:	56                   	push   %esi
+  801e76:	e8 4b 04 00 00       	call   8022c6 <nsipc_close>
+		return r;
+  801e7b:	83 c4 10             	add    $0x10,%esp
+}
+  801e7e:	89 d8                	mov    %ebx,%eax
+  801e80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e83:	5b                   	pop    %ebx
+  801e84:	5e                   	pop    %esi
+  801e85:	5d                   	pop    %ebp
+  801e86:	c3                   	ret
+
+00801e87 <accept>:
+{
+  801e87:	55                   	push   %ebp
+  801e88:	89 e5                	mov    %esp,%ebp
+  801e8a:	56                   	push   %esi
+  801e8b:	53                   	push   %ebx
+  801e8c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e8f:	89 f0                	mov    %esi,%eax
+  801e91:	e8 21 ff ff ff       	call   801db7 <fd2sockid>
+  801e96:	89 c3                	mov    %eax,%ebx
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 24                	js     801ec0 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801e9c:	89 f0                	mov    %esi,%eax
+  801e9e:	e8 44 ff ff ff       	call   801de7 <sock_flags>
+  801ea3:	50                   	push   %eax
+  801ea4:	ff 75 10             	push   0x10(%ebp)
+  801ea7:	ff 75 0c             	push   0xc(%ebp)
+  801eaa:	53                   	push   %ebx
+  801eab:	e8 6b 03 00 00       	call   80221b <nsipc_accept>
+  801eb0:	89 c3                	mov    %eax,%ebx
+  801eb2:	83 c4 10             	add    $0x10,%esp
+  801eb5:	85 c0                	test   %eax,%eax
+  801eb7:	78 07                	js     801ec0 <accept+0x39>
+	return alloc_sockfd(r);
+  801eb9:	e8 55 ff ff ff       	call   801e13 <alloc_sockfd>
+  801ebe:	89 c3                	mov    %eax,%ebx
+}
+  801ec0:	89 d8                	mov    %ebx,%eax
+  801ec2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec5:	5b                   	pop    %ebx
+  801ec6:	5e                   	pop    %esi
+  801ec7:	5d                   	pop    %ebp
+  801ec8:	c3                   	ret
+
+00801ec9 <bind>:
+{
+  801ec9:	55                   	push   %ebp
+  801eca:	89 e5                	mov    %esp,%ebp
+  801ecc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ecf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed2:	e8 e0 fe ff ff       	call   801db7 <fd2sockid>
+  801ed7:	85 c0                	test   %eax,%eax
+  801ed9:	78 12                	js     801eed <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801edb:	83 ec 04             	sub    $0x4,%esp
+  801ede:	ff 75 10             	push   0x10(%ebp)
+  801ee1:	ff 75 0c             	push   0xc(%ebp)
+  801ee4:	50                   	push   %eax
+  801ee5:	e8 85 03 00 00       	call   80226f <nsipc_bind>
+  801eea:	83 c4 10             	add    $0x10,%esp
+}
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+00801eef <shutdown>:
+{
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef8:	e8 ba fe ff ff       	call   801db7 <fd2sockid>
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	78 0f                	js     801f10 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f01:	83 ec 08             	sub    $0x8,%esp
+  801f04:	ff 75 0c             	push   0xc(%ebp)
+  801f07:	50                   	push   %eax
+  801f08:	e8 97 03 00 00       	call   8022a4 <nsipc_shutdown>
+  801f0d:	83 c4 10             	add    $0x10,%esp
+}
+  801f10:	c9                   	leave
+  801f11:	c3                   	ret
+
+00801f12 <connect>:
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1b:	e8 97 fe ff ff       	call   801db7 <fd2sockid>
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	78 12                	js     801f36 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801f24:	83 ec 04             	sub    $0x4,%esp
+  801f27:	ff 75 10             	push   0x10(%ebp)
+  801f2a:	ff 75 0c             	push   0xc(%ebp)
+  801f2d:	50                   	push   %eax
+  801f2e:	e8 ad 03 00 00       	call   8022e0 <nsipc_connect>
+  801f33:	83 c4 10             	add    $0x10,%esp
+}
+  801f36:	c9                   	leave
+  801f37:	c3                   	ret
+
+00801f38 <listen>:
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f41:	e8 71 fe ff ff       	call   801db7 <fd2sockid>
+  801f46:	85 c0                	test   %eax,%eax
+  801f48:	78 0f                	js     801f59 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801f4a:	83 ec 08             	sub    $0x8,%esp
+  801f4d:	ff 75 0c             	push   0xc(%ebp)
+  801f50:	50                   	push   %eax
+  801f51:	e8 bf 03 00 00       	call   802315 <nsipc_listen>
+  801f56:	83 c4 10             	add    $0x10,%esp
+}
+  801f59:	c9                   	leave
+  801f5a:	c3                   	ret
+
+00801f5b <sendmsg>:
+{
+  801f5b:	55                   	push   %ebp
+  801f5c:	89 e5                	mov    %esp,%ebp
+  801f5e:	57                   	push   %edi
+  801f5f:	56                   	push   %esi
+  801f60:	53                   	push   %ebx
+  801f61:	83 ec 0c             	sub    $0xc,%esp
+  801f64:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f67:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801f6a:	89 f0                	mov    %esi,%eax
+  801f6c:	e8 46 fe ff ff       	call   801db7 <fd2sockid>
+  801f71:	89 c3                	mov    %eax,%ebx
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	78 1c                	js     801f93 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801f77:	89 f0                	mov    %esi,%eax
+  801f79:	e8 69 fe ff ff       	call   801de7 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f7e:	0b 45 10             	or     0x10(%ebp),%eax
+  801f81:	50                   	push   %eax
+  801f82:	ff 77 0c             	push   0xc(%edi)
+  801f85:	ff 77 08             	push   0x8(%edi)
+  801f88:	53                   	push   %ebx
+  801f89:	e8 7c 04 00 00       	call   80240a <nsipc_sendmsg>
+  801f8e:	89 c3                	mov    %eax,%ebx
+  801f90:	83 c4 10             	add    $0x10,%esp
+}
+  801f93:	89 d8                	mov    %ebx,%eax
+  801f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f98:	5b                   	pop    %ebx
+  801f99:	5e                   	pop    %esi
+  801f9a:	5f                   	pop    %edi
+  801f9b:	5d                   	pop    %ebp
+  801f9c:	c3                   	ret
+
+00801f9d <recvmsg>:
+{
+  801f9d:	55                   	push   %ebp
+  801f9e:	89 e5                	mov    %esp,%ebp
+  801fa0:	57                   	push   %edi
+  801fa1:	56                   	push   %esi
+  801fa2:	53                   	push   %ebx
+  801fa3:	83 ec 0c             	sub    $0xc,%esp
+  801fa6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801fac:	89 f8                	mov    %edi,%eax
+  801fae:	e8 04 fe ff ff       	call   801db7 <fd2sockid>
+  801fb3:	89 c3                	mov    %eax,%ebx
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	78 2a                	js     801fe3 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801fb9:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801fc0:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801fc7:	89 f8                	mov    %edi,%eax
+  801fc9:	e8 19 fe ff ff       	call   801de7 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801fce:	0b 45 10             	or     0x10(%ebp),%eax
+  801fd1:	50                   	push   %eax
+  801fd2:	ff 76 0c             	push   0xc(%esi)
+  801fd5:	ff 76 08             	push   0x8(%esi)
+  801fd8:	53                   	push   %ebx
+  801fd9:	e8 d6 07 00 00       	call   8027b4 <nsipc_recvmsg>
+  801fde:	89 c3                	mov    %eax,%ebx
+  801fe0:	83 c4 10             	add    $0x10,%esp
+}
+  801fe3:	89 d8                	mov    %ebx,%eax
+  801fe5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe8:	5b                   	pop    %ebx
+  801fe9:	5e                   	pop    %esi
+  801fea:	5f                   	pop    %edi
+  801feb:	5d                   	pop    %ebp
+  801fec:	c3                   	ret
+
+00801fed <sendfile>:
+{
+  801fed:	55                   	push   %ebp
+  801fee:	89 e5                	mov    %esp,%ebp
+  801ff0:	56                   	push   %esi
+  801ff1:	53                   	push   %ebx
+  801ff2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801ff5:	89 f0                	mov    %esi,%eax
+  801ff7:	e8 bb fd ff ff       	call   801db7 <fd2sockid>
+  801ffc:	89 c3                	mov    %eax,%ebx
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	78 1f                	js     802021 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802002:	89 f0                	mov    %esi,%eax
+  802004:	e8 de fd ff ff       	call   801de7 <sock_flags>
+  802009:	83 ec 0c             	sub    $0xc,%esp
+  80200c:	50                   	push   %eax
+  80200d:	ff 75 14             	push   0x14(%ebp)
+  802010:	ff 75 10             	push   0x10(%ebp)
+  802013:	ff 75 0c             	push   0xc(%ebp)
+  802016:	53                   	push   %ebx
+  802017:	e8 64 06 00 00       	call   802680 <nsipc_sendfile>
+  80201c:	89 c3                	mov    %eax,%ebx
+  80201e:	83 c4 20             	add    $0x20,%esp
+}
+  802021:	89 d8                	mov    %ebx,%eax
+  802023:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802026:	5b                   	pop    %ebx
+  802027:	5e                   	pop    %esi
+  802028:	5d                   	pop    %ebp
+  802029:	c3                   	ret
+
+0080202a <evctl>:
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	53                   	push   %ebx
+  80202e:	83 ec 04             	sub    $0x4,%esp
+  802031:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802034:	89 d8                	mov    %ebx,%eax
+  802036:	e8 7c fd ff ff       	call   801db7 <fd2sockid>
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 10                	js     80204f <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80203f:	83 ec 04             	sub    $0x4,%esp
+  802042:	53                   	push   %ebx
+  802043:	ff 75 0c             	push   0xc(%ebp)
+  802046:	50                   	push   %eax
+  802047:	e8 d2 0b 00 00       	call   802c1e <nsipc_evctl>
+  80204c:	83 c4 10             	add    $0x10,%esp
+}
+  80204f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802052:	c9                   	leave
+  802053:	c3                   	ret
+
+00802054 <evwait>:
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80205a:	ff 75 10             	push   0x10(%ebp)
+  80205d:	ff 75 0c             	push   0xc(%ebp)
+  802060:	ff 75 08             	push   0x8(%ebp)
+  802063:	e8 e0 0b 00 00       	call   802c48 <nsipc_evwait>
+}
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+
+0080206a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802070:	ff 75 10             	push   0x10(%ebp)
+  802073:	ff 75 0c             	push   0xc(%ebp)
+  802076:	ff 75 08             	push   0x8(%ebp)
+  802079:	e8 31 0c 00 00       	call   802caf <nsipc_socket>
+  80207e:	83 c4 10             	add    $0x10,%esp
+  802081:	85 c0                	test   %eax,%eax
+  802083:	78 05                	js     80208a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802085:	e8 89 fd ff ff       	call   801e13 <alloc_sockfd>
+}
+  80208a:	c9                   	leave
+  80208b:	c3                   	ret
+
+0080208c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	53                   	push   %ebx
+  802090:	83 ec 04             	sub    $0x4,%esp
+  802093:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802095:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80209c:	74 26                	je     8020c4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80209e:	6a 07                	push   $0x7
+  8020a0:	68 00 a0 80 00       	push   $0x80a000
+  8020a5:	53                   	push   %ebx
+  8020a6:	ff 35 24 63 80 00    	push   0x806324
+  8020ac:	e8 12 19 00 00       	call   8039c3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8020b1:	83 c4 0c             	add    $0xc,%esp
+  8020b4:	6a 00                	push   $0x0
+  8020b6:	6a 00                	push   $0x0
+  8020b8:	6a 00                	push   $0x0
+  8020ba:	e8 74 16 00 00       	call   803733 <ipc_recv>
+}
+  8020bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c2:	c9                   	leave
+  8020c3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8020c4:	83 ec 0c             	sub    $0xc,%esp
+  8020c7:	6a 03                	push   $0x3
+  8020c9:	e8 5e 19 00 00       	call   803a2c <ipc_find_env>
+  8020ce:	a3 24 63 80 00       	mov    %eax,0x806324
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	eb c6                	jmp    80209e <nsipc+0x12>
+
+008020d8 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	56                   	push   %esi
+  8020dc:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8020dd:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  8020e3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8020e8:	85 f6                	test   %esi,%esi
+  8020ea:	75 33                	jne    80211f <nsbulk_map+0x47>
+  8020ec:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8020f1:	83 ec 04             	sub    $0x4,%esp
+  8020f4:	6a 07                	push   $0x7
+  8020f6:	53                   	push   %ebx
+  8020f7:	6a 00                	push   $0x0
+  8020f9:	e8 e6 ec ff ff       	call   800de4 <sys_page_alloc>
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	85 c0                	test   %eax,%eax
+  802103:	78 1a                	js     80211f <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802105:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80210b:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802111:	75 de                	jne    8020f1 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802113:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  80211a:	00 00 00 
+	return 0;
+  80211d:	89 f0                	mov    %esi,%eax
+}
+  80211f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802122:	5b                   	pop    %ebx
+  802123:	5e                   	pop    %esi
+  802124:	5d                   	pop    %ebp
+  802125:	c3                   	ret
+
+00802126 <nsbulk_own>:
+{
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	57                   	push   %edi
+  80212a:	56                   	push   %esi
+  80212b:	53                   	push   %ebx
+  80212c:	83 ec 0c             	sub    $0xc,%esp
+  80212f:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802131:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802134:	85 d2                	test   %edx,%edx
+  802136:	7f 0e                	jg     802146 <nsbulk_own+0x20>
+	return 0;
+  802138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213d:	eb 47                	jmp    802186 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80213f:	83 c3 01             	add    $0x1,%ebx
+  802142:	39 fb                	cmp    %edi,%ebx
+  802144:	7d 3b                	jge    802181 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802146:	be 01 00 00 00       	mov    $0x1,%esi
+  80214b:	89 d9                	mov    %ebx,%ecx
+  80214d:	d3 e6                	shl    %cl,%esi
+  80214f:	89 f0                	mov    %esi,%eax
+  802151:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  802157:	74 e6                	je     80213f <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802159:	83 ec 04             	sub    $0x4,%esp
+  80215c:	6a 07                	push   $0x7
+  80215e:	89 d8                	mov    %ebx,%eax
+  802160:	c1 e0 0c             	shl    $0xc,%eax
+  802163:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802168:	50                   	push   %eax
+  802169:	6a 00                	push   $0x0
+  80216b:	e8 74 ec ff ff       	call   800de4 <sys_page_alloc>
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	85 c0                	test   %eax,%eax
+  802175:	78 0f                	js     802186 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802177:	f7 d6                	not    %esi
+  802179:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  80217f:	eb be                	jmp    80213f <nsbulk_own+0x19>
+	return 0;
+  802181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802189:	5b                   	pop    %ebx
+  80218a:	5e                   	pop    %esi
+  80218b:	5f                   	pop    %edi
+  80218c:	5d                   	pop    %ebp
+  80218d:	c3                   	ret
+
+0080218e <nsipc_bulk>:
+{
+  80218e:	55                   	push   %ebp
+  80218f:	89 e5                	mov    %esp,%ebp
+  802191:	57                   	push   %edi
+  802192:	56                   	push   %esi
+  802193:	53                   	push   %ebx
+  802194:	83 ec 1c             	sub    $0x1c,%esp
+  802197:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80219a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80219c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8021a2:	c1 fb 0c             	sar    $0xc,%ebx
+  8021a5:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8021a8:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8021af:	74 56                	je     802207 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8021b1:	85 ff                	test   %edi,%edi
+  8021b3:	7e 24                	jle    8021d9 <nsipc_bulk+0x4b>
+  8021b5:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8021bb:	74 1c                	je     8021d9 <nsipc_bulk+0x4b>
+  8021bd:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8021c3:	c1 e3 0c             	shl    $0xc,%ebx
+  8021c6:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8021cb:	0f b6 10             	movzbl (%eax),%edx
+  8021ce:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8021d0:	05 00 10 00 00       	add    $0x1000,%eax
+  8021d5:	39 d8                	cmp    %ebx,%eax
+  8021d7:	75 f2                	jne    8021cb <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8021d9:	83 ec 0c             	sub    $0xc,%esp
+  8021dc:	56                   	push   %esi
+  8021dd:	57                   	push   %edi
+  8021de:	68 00 00 00 e0       	push   $0xe0000000
+  8021e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8021e6:	ff 35 24 63 80 00    	push   0x806324
+  8021ec:	e8 06 18 00 00       	call   8039f7 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8021f1:	83 c4 1c             	add    $0x1c,%esp
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	6a 00                	push   $0x0
+  8021f8:	6a 00                	push   $0x0
+  8021fa:	e8 34 15 00 00       	call   803733 <ipc_recv>
+}
+  8021ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802202:	5b                   	pop    %ebx
+  802203:	5e                   	pop    %esi
+  802204:	5f                   	pop    %edi
+  802205:	5d                   	pop    %ebp
+  802206:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802207:	83 ec 0c             	sub    $0xc,%esp
+  80220a:	6a 03                	push   $0x3
+  80220c:	e8 1b 18 00 00       	call   803a2c <ipc_find_env>
+  802211:	a3 24 63 80 00       	mov    %eax,0x806324
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	eb 96                	jmp    8021b1 <nsipc_bulk+0x23>
+
+0080221b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  80221b:	55                   	push   %ebp
+  80221c:	89 e5                	mov    %esp,%ebp
+  80221e:	53                   	push   %ebx
+  80221f:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802222:	8b 45 08             	mov    0x8(%ebp),%eax
+  802225:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_flags = flags;
+  80222a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80222d:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802232:	b8 01 00 00 00       	mov    $0x1,%eax
+  802237:	e8 50 fe ff ff       	call   80208c <nsipc>
+  80223c:	89 c3                	mov    %eax,%ebx
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	79 07                	jns    802249 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802242:	89 d8                	mov    %ebx,%eax
+  802244:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802247:	c9                   	leave
+  802248:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802249:	83 ec 04             	sub    $0x4,%esp
+  80224c:	ff 35 10 a0 80 00    	push   0x80a010
+  802252:	68 00 a0 80 00       	push   $0x80a000
+  802257:	ff 75 0c             	push   0xc(%ebp)
+  80225a:	e8 01 e9 ff ff       	call   800b60 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80225f:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  802265:	8b 45 10             	mov    0x10(%ebp),%eax
+  802268:	89 10                	mov    %edx,(%eax)
+  80226a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80226d:	eb d3                	jmp    802242 <nsipc_accept+0x27>
+
+0080226f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	53                   	push   %ebx
+  802273:	83 ec 08             	sub    $0x8,%esp
+  802276:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802279:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802281:	53                   	push   %ebx
+  802282:	ff 75 0c             	push   0xc(%ebp)
+  802285:	68 04 a0 80 00       	push   $0x80a004
+  80228a:	e8 d1 e8 ff ff       	call   800b60 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80228f:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  802295:	b8 02 00 00 00       	mov    $0x2,%eax
+  80229a:	e8 ed fd ff ff       	call   80208c <nsipc>
+}
+  80229f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a2:	c9                   	leave
+  8022a3:	c3                   	ret
+
+008022a4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022a4:	55                   	push   %ebp
+  8022a5:	89 e5                	mov    %esp,%ebp
+  8022a7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ad:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  8022b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b5:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  8022ba:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022bf:	e8 c8 fd ff ff       	call   80208c <nsipc>
+}
+  8022c4:	c9                   	leave
+  8022c5:	c3                   	ret
+
+008022c6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8022cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022cf:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  8022d4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022d9:	e8 ae fd ff ff       	call   80208c <nsipc>
+}
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+
+008022e0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8022e0:	55                   	push   %ebp
+  8022e1:	89 e5                	mov    %esp,%ebp
+  8022e3:	53                   	push   %ebx
+  8022e4:	83 ec 08             	sub    $0x8,%esp
+  8022e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8022ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ed:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8022f2:	53                   	push   %ebx
+  8022f3:	ff 75 0c             	push   0xc(%ebp)
+  8022f6:	68 04 a0 80 00       	push   $0x80a004
+  8022fb:	e8 60 e8 ff ff       	call   800b60 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802300:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  802306:	b8 05 00 00 00       	mov    $0x5,%eax
+  80230b:	e8 7c fd ff ff       	call   80208c <nsipc>
+}
+  802310:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802313:	c9                   	leave
+  802314:	c3                   	ret
+
+00802315 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802315:	55                   	push   %ebp
+  802316:	89 e5                	mov    %esp,%ebp
+  802318:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80231b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802323:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802326:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  80232b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802330:	e8 57 fd ff ff       	call   80208c <nsipc>
+}
+  802335:	c9                   	leave
+  802336:	c3                   	ret
+
+00802337 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802337:	55                   	push   %ebp
+  802338:	89 e5                	mov    %esp,%ebp
+  80233a:	56                   	push   %esi
+  80233b:	53                   	push   %ebx
+  80233c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80233f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802342:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  802347:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  80234d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802350:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802355:	b8 07 00 00 00       	mov    $0x7,%eax
+  80235a:	e8 2d fd ff ff       	call   80208c <nsipc>
+  80235f:	89 c3                	mov    %eax,%ebx
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 22                	js     802387 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802365:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80236a:	39 c6                	cmp    %eax,%esi
+  80236c:	0f 4e c6             	cmovle %esi,%eax
+  80236f:	39 c3                	cmp    %eax,%ebx
+  802371:	7f 1d                	jg     802390 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802373:	83 ec 04             	sub    $0x4,%esp
+  802376:	53                   	push   %ebx
+  802377:	68 00 a0 80 00       	push   $0x80a000
+  80237c:	ff 75 0c             	push   0xc(%ebp)
+  80237f:	e8 dc e7 ff ff       	call   800b60 <memmove>
+  802384:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802387:	89 d8                	mov    %ebx,%eax
+  802389:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80238c:	5b                   	pop    %ebx
+  80238d:	5e                   	pop    %esi
+  80238e:	5d                   	pop    %ebp
+  80238f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802390:	68 14 41 80 00       	push   $0x804114
+  802395:	68 29 41 80 00       	push   $0x804129
+  80239a:	68 b2 00 00 00       	push   $0xb2
+  80239f:	68 3e 41 80 00       	push   $0x80413e
+  8023a4:	e8 35 de ff ff       	call   8001de <_panic>
+
+008023a9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023a9:	55                   	push   %ebp
+  8023aa:	89 e5                	mov    %esp,%ebp
+  8023ac:	53                   	push   %ebx
+  8023ad:	83 ec 04             	sub    $0x4,%esp
+  8023b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b6:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  8023bb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8023c1:	7f 2e                	jg     8023f1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8023c3:	83 ec 04             	sub    $0x4,%esp
+  8023c6:	53                   	push   %ebx
+  8023c7:	ff 75 0c             	push   0xc(%ebp)
+  8023ca:	68 0c a0 80 00       	push   $0x80a00c
+  8023cf:	e8 8c e7 ff ff       	call   800b60 <memmove>
+	nsipcbuf.send.req_size = size;
+  8023d4:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  8023da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023dd:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  8023e2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023e7:	e8 a0 fc ff ff       	call   80208c <nsipc>
+}
+  8023ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ef:	c9                   	leave
+  8023f0:	c3                   	ret
+	assert(size < 1600);
+  8023f1:	68 4a 41 80 00       	push   $0x80414a
+  8023f6:	68 29 41 80 00       	push   $0x804129
+  8023fb:	68 bd 00 00 00       	push   $0xbd
+  802400:	68 3e 41 80 00       	push   $0x80413e
+  802405:	e8 d4 dd ff ff       	call   8001de <_panic>
+
+0080240a <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80240a:	55                   	push   %ebp
+  80240b:	89 e5                	mov    %esp,%ebp
+  80240d:	57                   	push   %edi
+  80240e:	56                   	push   %esi
+  80240f:	53                   	push   %ebx
+  802410:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802413:	e8 c0 fc ff ff       	call   8020d8 <nsbulk_map>
+  802418:	85 c0                	test   %eax,%eax
+  80241a:	78 55                	js     802471 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  80241c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802423:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  80242a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802431:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802434:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802437:	0f 8d 24 02 00 00    	jge    802661 <nsipc_sendmsg+0x257>
+  80243d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802440:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802443:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802446:	89 d8                	mov    %ebx,%eax
+  802448:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80244d:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80244f:	83 ec 0c             	sub    $0xc,%esp
+  802452:	68 20 60 80 00       	push   $0x806020
+  802457:	e8 5a 0f 00 00       	call   8033b6 <pgbatch_init>
+  80245c:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80245f:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802461:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802464:	e9 82 00 00 00       	jmp    8024eb <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802469:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80246c:	85 db                	test   %ebx,%ebx
+  80246e:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802471:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802474:	5b                   	pop    %ebx
+  802475:	5e                   	pop    %esi
+  802476:	5f                   	pop    %edi
+  802477:	5d                   	pop    %ebp
+  802478:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802479:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80247e:	29 c8                	sub    %ecx,%eax
+  802480:	39 d0                	cmp    %edx,%eax
+  802482:	0f 46 d0             	cmovbe %eax,%edx
+  802485:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802487:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80248d:	85 ff                	test   %edi,%edi
+  80248f:	0f 49 c7             	cmovns %edi,%eax
+  802492:	c1 f8 0c             	sar    $0xc,%eax
+  802495:	ba 01 00 00 00       	mov    $0x1,%edx
+  80249a:	e8 87 fc ff ff       	call   802126 <nsbulk_own>
+  80249f:	85 c0                	test   %eax,%eax
+  8024a1:	0f 88 17 01 00 00    	js     8025be <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8024a7:	83 ec 04             	sub    $0x4,%esp
+  8024aa:	56                   	push   %esi
+  8024ab:	ff 75 e0             	push   -0x20(%ebp)
+  8024ae:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8024b1:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8024b6:	50                   	push   %eax
+  8024b7:	e8 a4 e6 ff ff       	call   800b60 <memmove>
+  8024bc:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8024bf:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8024c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024c5:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8024c8:	0f 84 fd 00 00 00    	je     8025cb <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8024ce:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8024d1:	01 f7                	add    %esi,%edi
+  8024d3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024d6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024d9:	0f 8d 01 01 00 00    	jge    8025e0 <nsipc_sendmsg+0x1d6>
+  8024df:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8024e5:	0f 8f f0 00 00 00    	jg     8025db <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8024eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ee:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8024f1:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8024f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024f7:	89 c2                	mov    %eax,%edx
+  8024f9:	03 13                	add    (%ebx),%edx
+  8024fb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8024fe:	8b 73 04             	mov    0x4(%ebx),%esi
+  802501:	29 c6                	sub    %eax,%esi
+  802503:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802508:	29 f9                	sub    %edi,%ecx
+  80250a:	39 ce                	cmp    %ecx,%esi
+  80250c:	89 ca                	mov    %ecx,%edx
+  80250e:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802511:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802514:	89 f9                	mov    %edi,%ecx
+  802516:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  80251c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80251f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802524:	09 c8                	or     %ecx,%eax
+  802526:	0f 85 4d ff ff ff    	jne    802479 <nsipc_sendmsg+0x6f>
+  80252c:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802532:	0f 86 41 ff ff ff    	jbe    802479 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802538:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80253e:	85 ff                	test   %edi,%edi
+  802540:	0f 49 c7             	cmovns %edi,%eax
+  802543:	c1 f8 0c             	sar    $0xc,%eax
+  802546:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802548:	89 d1                	mov    %edx,%ecx
+  80254a:	c1 e9 0c             	shr    $0xc,%ecx
+  80254d:	01 c8                	add    %ecx,%eax
+  80254f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802552:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802555:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802557:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80255a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80255f:	29 c8                	sub    %ecx,%eax
+  802561:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802564:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802567:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802569:	b8 01 00 00 00       	mov    $0x1,%eax
+  80256e:	89 f9                	mov    %edi,%ecx
+  802570:	d3 e0                	shl    %cl,%eax
+  802572:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802578:	83 ec 08             	sub    $0x8,%esp
+  80257b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80257d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802580:	50                   	push   %eax
+  802581:	6a 00                	push   $0x0
+  802583:	56                   	push   %esi
+  802584:	6a 00                	push   $0x0
+  802586:	68 20 60 80 00       	push   $0x806020
+  80258b:	e8 e4 0e 00 00       	call   803474 <pgbatch_map>
+  802590:	83 c4 20             	add    $0x20,%esp
+  802593:	85 c0                	test   %eax,%eax
+  802595:	0f 88 ce fe ff ff    	js     802469 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80259b:	83 c7 01             	add    $0x1,%edi
+  80259e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025a4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8025a7:	39 c7                	cmp    %eax,%edi
+  8025a9:	75 be                	jne    802569 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8025ab:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8025ae:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8025b1:	89 d6                	mov    %edx,%esi
+  8025b3:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8025b9:	e9 01 ff ff ff       	jmp    8024bf <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8025be:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025c1:	85 db                	test   %ebx,%ebx
+  8025c3:	0f 45 c3             	cmovne %ebx,%eax
+  8025c6:	e9 a6 fe ff ff       	jmp    802471 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8025cb:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8025cf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8025d6:	e9 f3 fe ff ff       	jmp    8024ce <nsipc_sendmsg+0xc4>
+  8025db:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8025de:	eb 03                	jmp    8025e3 <nsipc_sendmsg+0x1d9>
+  8025e0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8025e3:	83 ec 0c             	sub    $0xc,%esp
+  8025e6:	68 20 60 80 00       	push   $0x806020
+  8025eb:	e8 d4 0d 00 00       	call   8033c4 <pgbatch_flush>
+  8025f0:	83 c4 10             	add    $0x10,%esp
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	78 50                	js     802647 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8025f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025fa:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8025ff:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802605:	89 fb                	mov    %edi,%ebx
+  802607:	29 f3                	sub    %esi,%ebx
+  802609:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80260f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802612:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802617:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80261c:	89 fa                	mov    %edi,%edx
+  80261e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802623:	e8 66 fb ff ff       	call   80218e <nsipc_bulk>
+  802628:	85 c0                	test   %eax,%eax
+  80262a:	78 28                	js     802654 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80262c:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80262f:	39 c3                	cmp    %eax,%ebx
+  802631:	75 0c                	jne    80263f <nsipc_sendmsg+0x235>
+  802633:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802636:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802639:	0f 8f f2 fd ff ff    	jg     802431 <nsipc_sendmsg+0x27>
+		sent += r;
+  80263f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802642:	e9 2a fe ff ff       	jmp    802471 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802647:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80264a:	85 db                	test   %ebx,%ebx
+  80264c:	0f 45 c3             	cmovne %ebx,%eax
+  80264f:	e9 1d fe ff ff       	jmp    802471 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802654:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802657:	85 db                	test   %ebx,%ebx
+  802659:	0f 45 c3             	cmovne %ebx,%eax
+  80265c:	e9 10 fe ff ff       	jmp    802471 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802661:	83 ec 0c             	sub    $0xc,%esp
+  802664:	68 20 60 80 00       	push   $0x806020
+  802669:	e8 48 0d 00 00       	call   8033b6 <pgbatch_init>
+  80266e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802671:	be 00 00 00 00       	mov    $0x0,%esi
+  802676:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267b:	e9 63 ff ff ff       	jmp    8025e3 <nsipc_sendmsg+0x1d9>
+
+00802680 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802680:	55                   	push   %ebp
+  802681:	89 e5                	mov    %esp,%ebp
+  802683:	57                   	push   %edi
+  802684:	56                   	push   %esi
+  802685:	53                   	push   %ebx
+  802686:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802689:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802690:	0f 84 c8 00 00 00    	je     80275e <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802696:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80269d:	0f 84 e4 00 00 00    	je     802787 <nsipc_sendfile+0x107>
+{
+  8026a3:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8026a8:	89 fb                	mov    %edi,%ebx
+  8026aa:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8026ad:	0f 83 f0 00 00 00    	jae    8027a3 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8026b3:	89 fa                	mov    %edi,%edx
+  8026b5:	03 55 10             	add    0x10(%ebp),%edx
+  8026b8:	89 d0                	mov    %edx,%eax
+  8026ba:	c1 f8 1f             	sar    $0x1f,%eax
+  8026bd:	c1 e8 14             	shr    $0x14,%eax
+  8026c0:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8026c3:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8026c9:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8026cb:	6a 10                	push   $0x10
+  8026cd:	68 00 20 01 e0       	push   $0xe0012000
+  8026d2:	52                   	push   %edx
+  8026d3:	ff 75 0c             	push   0xc(%ebp)
+  8026d6:	e8 ea f3 ff ff       	call   801ac5 <fmap>
+  8026db:	83 c4 10             	add    $0x10,%esp
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	0f 8e b8 00 00 00    	jle    80279e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8026e6:	39 c6                	cmp    %eax,%esi
+  8026e8:	0f 8d b5 00 00 00    	jge    8027a3 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8026ee:	29 f0                	sub    %esi,%eax
+  8026f0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8026f3:	29 da                	sub    %ebx,%edx
+  8026f5:	39 d0                	cmp    %edx,%eax
+  8026f7:	89 d3                	mov    %edx,%ebx
+  8026f9:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8026fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ff:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802704:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80270a:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802710:	8b 45 18             	mov    0x18(%ebp),%eax
+  802713:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802718:	83 ec 0c             	sub    $0xc,%esp
+  80271b:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80271d:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802724:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802727:	83 c0 01             	add    $0x1,%eax
+  80272a:	50                   	push   %eax
+  80272b:	68 00 10 01 e0       	push   $0xe0011000
+  802730:	6a 11                	push   $0x11
+  802732:	ff 35 24 63 80 00    	push   0x806324
+  802738:	e8 ba 12 00 00       	call   8039f7 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80273d:	83 c4 1c             	add    $0x1c,%esp
+  802740:	6a 00                	push   $0x0
+  802742:	6a 00                	push   $0x0
+  802744:	6a 00                	push   $0x0
+  802746:	e8 e8 0f 00 00       	call   803733 <ipc_recv>
+  80274b:	83 c4 10             	add    $0x10,%esp
+  80274e:	85 c0                	test   %eax,%eax
+  802750:	78 5b                	js     8027ad <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802752:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802754:	39 c3                	cmp    %eax,%ebx
+  802756:	0f 8e 4c ff ff ff    	jle    8026a8 <nsipc_sendfile+0x28>
+  80275c:	eb 45                	jmp    8027a3 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80275e:	83 ec 04             	sub    $0x4,%esp
+  802761:	6a 07                	push   $0x7
+  802763:	68 00 10 01 e0       	push   $0xe0011000
+  802768:	6a 00                	push   $0x0
+  80276a:	e8 75 e6 ff ff       	call   800de4 <sys_page_alloc>
+  80276f:	89 c7                	mov    %eax,%edi
+  802771:	83 c4 10             	add    $0x10,%esp
+  802774:	85 c0                	test   %eax,%eax
+  802776:	78 2b                	js     8027a3 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802778:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  80277f:	00 00 00 
+  802782:	e9 0f ff ff ff       	jmp    802696 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802787:	83 ec 0c             	sub    $0xc,%esp
+  80278a:	6a 03                	push   $0x3
+  80278c:	e8 9b 12 00 00       	call   803a2c <ipc_find_env>
+  802791:	a3 24 63 80 00       	mov    %eax,0x806324
+  802796:	83 c4 10             	add    $0x10,%esp
+  802799:	e9 05 ff ff ff       	jmp    8026a3 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80279e:	85 ff                	test   %edi,%edi
+  8027a0:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8027a3:	89 f8                	mov    %edi,%eax
+  8027a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a8:	5b                   	pop    %ebx
+  8027a9:	5e                   	pop    %esi
+  8027aa:	5f                   	pop    %edi
+  8027ab:	5d                   	pop    %ebp
+  8027ac:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8027ad:	85 ff                	test   %edi,%edi
+  8027af:	0f 44 f8             	cmove  %eax,%edi
+  8027b2:	eb ef                	jmp    8027a3 <nsipc_sendfile+0x123>
+
+008027b4 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8027b4:	55                   	push   %ebp
+  8027b5:	89 e5                	mov    %esp,%ebp
+  8027b7:	57                   	push   %edi
+  8027b8:	56                   	push   %esi
+  8027b9:	53                   	push   %ebx
+  8027ba:	83 ec 1c             	sub    $0x1c,%esp
+  8027bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8027c0:	e8 13 f9 ff ff       	call   8020d8 <nsbulk_map>
+  8027c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	0f 88 ba 00 00 00    	js     80288a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8027d0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027d4:	0f 8e bb 00 00 00    	jle    802895 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8027da:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8027df:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8027e4:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8027e9:	89 f8                	mov    %edi,%eax
+  8027eb:	29 f0                	sub    %esi,%eax
+  8027ed:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8027f1:	39 c8                	cmp    %ecx,%eax
+  8027f3:	0f 47 c1             	cmova  %ecx,%eax
+  8027f6:	01 f0                	add    %esi,%eax
+  8027f8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8027fa:	83 c2 01             	add    $0x1,%edx
+  8027fd:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802800:	7e 07                	jle    802809 <nsipc_recvmsg+0x55>
+  802802:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802807:	7e e0                	jle    8027e9 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802809:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80280f:	c1 fa 0c             	sar    $0xc,%edx
+  802812:	b8 00 00 00 00       	mov    $0x0,%eax
+  802817:	e8 0a f9 ff ff       	call   802126 <nsbulk_own>
+  80281c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	78 67                	js     80288a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802823:	8b 45 08             	mov    0x8(%ebp),%eax
+  802826:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80282b:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802831:	8b 45 14             	mov    0x14(%ebp),%eax
+  802834:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802839:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80283e:	89 f2                	mov    %esi,%edx
+  802840:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802845:	e8 44 f9 ff ff       	call   80218e <nsipc_bulk>
+  80284a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	78 39                	js     80288a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802851:	39 f0                	cmp    %esi,%eax
+  802853:	7f 4a                	jg     80289f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802855:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285a:	85 c0                	test   %eax,%eax
+  80285c:	7e 2c                	jle    80288a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80285e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802861:	29 fe                	sub    %edi,%esi
+  802863:	8b 43 04             	mov    0x4(%ebx),%eax
+  802866:	39 c6                	cmp    %eax,%esi
+  802868:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80286b:	83 ec 04             	sub    $0x4,%esp
+  80286e:	56                   	push   %esi
+  80286f:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802875:	50                   	push   %eax
+  802876:	ff 33                	push   (%ebx)
+  802878:	e8 e3 e2 ff ff       	call   800b60 <memmove>
+		n += m;
+  80287d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80287f:	83 c3 08             	add    $0x8,%ebx
+  802882:	83 c4 10             	add    $0x10,%esp
+  802885:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802888:	7f d4                	jg     80285e <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80288a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80288d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802890:	5b                   	pop    %ebx
+  802891:	5e                   	pop    %esi
+  802892:	5f                   	pop    %edi
+  802893:	5d                   	pop    %ebp
+  802894:	c3                   	ret
+	int r, i, n, len = 0;
+  802895:	be 00 00 00 00       	mov    $0x0,%esi
+  80289a:	e9 6a ff ff ff       	jmp    802809 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80289f:	68 20 41 80 00       	push   $0x804120
+  8028a4:	68 29 41 80 00       	push   $0x804129
+  8028a9:	68 3b 01 00 00       	push   $0x13b
+  8028ae:	68 3e 41 80 00       	push   $0x80413e
+  8028b3:	e8 26 d9 ff ff       	call   8001de <_panic>
+
+008028b8 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8028b8:	55                   	push   %ebp
+  8028b9:	89 e5                	mov    %esp,%ebp
+  8028bb:	57                   	push   %edi
+  8028bc:	56                   	push   %esi
+  8028bd:	53                   	push   %ebx
+  8028be:	83 ec 0c             	sub    $0xc,%esp
+  8028c1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8028c4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8028c7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8028ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028cd:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.select.req_readset = *readset;
+  8028d2:	8b 07                	mov    (%edi),%eax
+  8028d4:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  8028d9:	8b 47 04             	mov    0x4(%edi),%eax
+  8028dc:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  8028e1:	8b 47 08             	mov    0x8(%edi),%eax
+  8028e4:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+  8028e9:	8b 47 0c             	mov    0xc(%edi),%eax
+  8028ec:	a3 10 a0 80 00       	mov    %eax,0x80a010
+  8028f1:	8b 47 10             	mov    0x10(%edi),%eax
+  8028f4:	a3 14 a0 80 00       	mov    %eax,0x80a014
+  8028f9:	8b 47 14             	mov    0x14(%edi),%eax
+  8028fc:	a3 18 a0 80 00       	mov    %eax,0x80a018
+  802901:	8b 47 18             	mov    0x18(%edi),%eax
+  802904:	a3 1c a0 80 00       	mov    %eax,0x80a01c
+  802909:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80290c:	a3 20 a0 80 00       	mov    %eax,0x80a020
+  802911:	8b 47 20             	mov    0x20(%edi),%eax
+  802914:	a3 24 a0 80 00       	mov    %eax,0x80a024
+  802919:	8b 47 24             	mov    0x24(%edi),%eax
+  80291c:	a3 28 a0 80 00       	mov    %eax,0x80a028
+  802921:	8b 47 28             	mov    0x28(%edi),%eax
+  802924:	a3 2c a0 80 00       	mov    %eax,0x80a02c
+  802929:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80292c:	a3 30 a0 80 00       	mov    %eax,0x80a030
+  802931:	8b 47 30             	mov    0x30(%edi),%eax
+  802934:	a3 34 a0 80 00       	mov    %eax,0x80a034
+  802939:	8b 47 34             	mov    0x34(%edi),%eax
+  80293c:	a3 38 a0 80 00       	mov    %eax,0x80a038
+  802941:	8b 47 38             	mov    0x38(%edi),%eax
+  802944:	a3 3c a0 80 00       	mov    %eax,0x80a03c
+  802949:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80294c:	a3 40 a0 80 00       	mov    %eax,0x80a040
+	nsipcbuf.select.req_writeset = *writeset;
+  802951:	8b 06                	mov    (%esi),%eax
+  802953:	a3 44 a0 80 00       	mov    %eax,0x80a044
+  802958:	8b 46 04             	mov    0x4(%esi),%eax
+  80295b:	a3 48 a0 80 00       	mov    %eax,0x80a048
+  802960:	8b 46 08             	mov    0x8(%esi),%eax
+  802963:	a3 4c a0 80 00       	mov    %eax,0x80a04c
+  802968:	8b 46 0c             	mov    0xc(%esi),%eax
+  80296b:	a3 50 a0 80 00       	mov    %eax,0x80a050
+  802970:	8b 46 10             	mov    0x10(%esi),%eax
+  802973:	a3 54 a0 80 00       	mov    %eax,0x80a054
+  802978:	8b 46 14             	mov    0x14(%esi),%eax
+  80297b:	a3 58 a0 80 00       	mov    %eax,0x80a058
+  802980:	8b 46 18             	mov    0x18(%esi),%eax
+  802983:	a3 5c a0 80 00       	mov    %eax,0x80a05c
+  802988:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80298b:	a3 60 a0 80 00       	mov    %eax,0x80a060
+  802990:	8b 46 20             	mov    0x20(%esi),%eax
+  802993:	a3 64 a0 80 00       	mov    %eax,0x80a064
+  802998:	8b 46 24             	mov    0x24(%esi),%eax
+  80299b:	a3 68 a0 80 00       	mov    %eax,0x80a068
+  8029a0:	8b 46 28             	mov    0x28(%esi),%eax
+  8029a3:	a3 6c a0 80 00       	mov    %eax,0x80a06c
+  8029a8:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8029ab:	a3 70 a0 80 00       	mov    %eax,0x80a070
+  8029b0:	8b 46 30             	mov    0x30(%esi),%eax
+  8029b3:	a3 74 a0 80 00       	mov    %eax,0x80a074
+  8029b8:	8b 46 34             	mov    0x34(%esi),%eax
+  8029bb:	a3 78 a0 80 00       	mov    %eax,0x80a078
+  8029c0:	8b 46 38             	mov    0x38(%esi),%eax
+  8029c3:	a3 7c a0 80 00       	mov    %eax,0x80a07c
+  8029c8:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8029cb:	a3 80 a0 80 00       	mov    %eax,0x80a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8029d0:	8b 03                	mov    (%ebx),%eax
+  8029d2:	a3 84 a0 80 00       	mov    %eax,0x80a084
+  8029d7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029da:	a3 88 a0 80 00       	mov    %eax,0x80a088
+  8029df:	8b 43 08             	mov    0x8(%ebx),%eax
+  8029e2:	a3 8c a0 80 00       	mov    %eax,0x80a08c
+  8029e7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8029ea:	a3 90 a0 80 00       	mov    %eax,0x80a090
+  8029ef:	8b 43 10             	mov    0x10(%ebx),%eax
+  8029f2:	a3 94 a0 80 00       	mov    %eax,0x80a094
+  8029f7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8029fa:	a3 98 a0 80 00       	mov    %eax,0x80a098
+  8029ff:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a02:	a3 9c a0 80 00       	mov    %eax,0x80a09c
+  802a07:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802a0a:	a3 a0 a0 80 00       	mov    %eax,0x80a0a0
+  802a0f:	8b 43 20             	mov    0x20(%ebx),%eax
+  802a12:	a3 a4 a0 80 00       	mov    %eax,0x80a0a4
+  802a17:	8b 43 24             	mov    0x24(%ebx),%eax
+  802a1a:	a3 a8 a0 80 00       	mov    %eax,0x80a0a8
+  802a1f:	8b 43 28             	mov    0x28(%ebx),%eax
+  802a22:	a3 ac a0 80 00       	mov    %eax,0x80a0ac
+  802a27:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802a2a:	a3 b0 a0 80 00       	mov    %eax,0x80a0b0
+  802a2f:	8b 43 30             	mov    0x30(%ebx),%eax
+  802a32:	a3 b4 a0 80 00       	mov    %eax,0x80a0b4
+  802a37:	8b 43 34             	mov    0x34(%ebx),%eax
+  802a3a:	a3 b8 a0 80 00       	mov    %eax,0x80a0b8
+  802a3f:	8b 43 38             	mov    0x38(%ebx),%eax
+  802a42:	a3 bc a0 80 00       	mov    %eax,0x80a0bc
+  802a47:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802a4a:	a3 c0 a0 80 00       	mov    %eax,0x80a0c0
+	nsipcbuf.select.req_timeout = msec;
+  802a4f:	8b 45 18             	mov    0x18(%ebp),%eax
+  802a52:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802a57:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802a5c:	e8 2b f6 ff ff       	call   80208c <nsipc>
+  802a61:	85 c0                	test   %eax,%eax
+  802a63:	0f 88 ad 01 00 00    	js     802c16 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802a69:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  802a6f:	89 17                	mov    %edx,(%edi)
+  802a71:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  802a77:	89 57 04             	mov    %edx,0x4(%edi)
+  802a7a:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  802a80:	89 57 08             	mov    %edx,0x8(%edi)
+  802a83:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  802a89:	89 57 0c             	mov    %edx,0xc(%edi)
+  802a8c:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  802a92:	89 57 10             	mov    %edx,0x10(%edi)
+  802a95:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  802a9b:	89 57 14             	mov    %edx,0x14(%edi)
+  802a9e:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  802aa4:	89 57 18             	mov    %edx,0x18(%edi)
+  802aa7:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  802aad:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802ab0:	8b 15 24 a0 80 00    	mov    0x80a024,%edx
+  802ab6:	89 57 20             	mov    %edx,0x20(%edi)
+  802ab9:	8b 15 28 a0 80 00    	mov    0x80a028,%edx
+  802abf:	89 57 24             	mov    %edx,0x24(%edi)
+  802ac2:	8b 15 2c a0 80 00    	mov    0x80a02c,%edx
+  802ac8:	89 57 28             	mov    %edx,0x28(%edi)
+  802acb:	8b 15 30 a0 80 00    	mov    0x80a030,%edx
+  802ad1:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802ad4:	8b 15 34 a0 80 00    	mov    0x80a034,%edx
+  802ada:	89 57 30             	mov    %edx,0x30(%edi)
+  802add:	8b 15 38 a0 80 00    	mov    0x80a038,%edx
+  802ae3:	89 57 34             	mov    %edx,0x34(%edi)
+  802ae6:	8b 15 3c a0 80 00    	mov    0x80a03c,%edx
+  802aec:	89 57 38             	mov    %edx,0x38(%edi)
+  802aef:	8b 15 40 a0 80 00    	mov    0x80a040,%edx
+  802af5:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802af8:	8b 15 44 a0 80 00    	mov    0x80a044,%edx
+  802afe:	89 16                	mov    %edx,(%esi)
+  802b00:	8b 15 48 a0 80 00    	mov    0x80a048,%edx
+  802b06:	89 56 04             	mov    %edx,0x4(%esi)
+  802b09:	8b 15 4c a0 80 00    	mov    0x80a04c,%edx
+  802b0f:	89 56 08             	mov    %edx,0x8(%esi)
+  802b12:	8b 15 50 a0 80 00    	mov    0x80a050,%edx
+  802b18:	89 56 0c             	mov    %edx,0xc(%esi)
+  802b1b:	8b 15 54 a0 80 00    	mov    0x80a054,%edx
+  802b21:	89 56 10             	mov    %edx,0x10(%esi)
+  802b24:	8b 15 58 a0 80 00    	mov    0x80a058,%edx
+  802b2a:	89 56 14             	mov    %edx,0x14(%esi)
+  802b2d:	8b 15 5c a0 80 00    	mov    0x80a05c,%edx
+  802b33:	89 56 18             	mov    %edx,0x18(%esi)
+  802b36:	8b 15 60 a0 80 00    	mov    0x80a060,%edx
+  802b3c:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802b3f:	8b 15 64 a0 80 00    	mov    0x80a064,%edx
+  802b45:	89 56 20             	mov    %edx,0x20(%esi)
+  802b48:	8b 15 68 a0 80 00    	mov    0x80a068,%edx
+  802b4e:	89 56 24             	mov    %edx,0x24(%esi)
+  802b51:	8b 15 6c a0 80 00    	mov    0x80a06c,%edx
+  802b57:	89 56 28             	mov    %edx,0x28(%esi)
+  802b5a:	8b 15 70 a0 80 00    	mov    0x80a070,%edx
+  802b60:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802b63:	8b 15 74 a0 80 00    	mov    0x80a074,%edx
+  802b69:	89 56 30             	mov    %edx,0x30(%esi)
+  802b6c:	8b 15 78 a0 80 00    	mov    0x80a078,%edx
+  802b72:	89 56 34             	mov    %edx,0x34(%esi)
+  802b75:	8b 15 7c a0 80 00    	mov    0x80a07c,%edx
+  802b7b:	89 56 38             	mov    %edx,0x38(%esi)
+  802b7e:	8b 15 80 a0 80 00    	mov    0x80a080,%edx
+  802b84:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802b87:	8b 15 84 a0 80 00    	mov    0x80a084,%edx
+  802b8d:	89 13                	mov    %edx,(%ebx)
+  802b8f:	8b 15 88 a0 80 00    	mov    0x80a088,%edx
+  802b95:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b98:	8b 15 8c a0 80 00    	mov    0x80a08c,%edx
+  802b9e:	89 53 08             	mov    %edx,0x8(%ebx)
+  802ba1:	8b 15 90 a0 80 00    	mov    0x80a090,%edx
+  802ba7:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802baa:	8b 15 94 a0 80 00    	mov    0x80a094,%edx
+  802bb0:	89 53 10             	mov    %edx,0x10(%ebx)
+  802bb3:	8b 15 98 a0 80 00    	mov    0x80a098,%edx
+  802bb9:	89 53 14             	mov    %edx,0x14(%ebx)
+  802bbc:	8b 15 9c a0 80 00    	mov    0x80a09c,%edx
+  802bc2:	89 53 18             	mov    %edx,0x18(%ebx)
+  802bc5:	8b 15 a0 a0 80 00    	mov    0x80a0a0,%edx
+  802bcb:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802bce:	8b 15 a4 a0 80 00    	mov    0x80a0a4,%edx
+  802bd4:	89 53 20             	mov    %edx,0x20(%ebx)
+  802bd7:	8b 15 a8 a0 80 00    	mov    0x80a0a8,%edx
+  802bdd:	89 53 24             	mov    %edx,0x24(%ebx)
+  802be0:	8b 15 ac a0 80 00    	mov    0x80a0ac,%edx
+  802be6:	89 53 28             	mov    %edx,0x28(%ebx)
+  802be9:	8b 15 b0 a0 80 00    	mov    0x80a0b0,%edx
+  802bef:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802bf2:	8b 15 b4 a0 80 00    	mov    0x80a0b4,%edx
+  802bf8:	89 53 30             	mov    %edx,0x30(%ebx)
+  802bfb:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  802c01:	89 53 34             	mov    %edx,0x34(%ebx)
+  802c04:	8b 15 bc a0 80 00    	mov    0x80a0bc,%edx
+  802c0a:	89 53 38             	mov    %edx,0x38(%ebx)
+  802c0d:	8b 15 c0 a0 80 00    	mov    0x80a0c0,%edx
+  802c13:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802c16:	83 c4 0c             	add    $0xc,%esp
+  802c19:	5b                   	pop    %ebx
+  802c1a:	5e                   	pop    %esi
+  802c1b:	5f                   	pop    %edi
+  802c1c:	5d                   	pop    %ebp
+  802c1d:	c3                   	ret
+
+00802c1e <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802c1e:	55                   	push   %ebp
+  802c1f:	89 e5                	mov    %esp,%ebp
+  802c21:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c27:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.evctl.req_events = events;
+  802c2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c2f:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.evctl.req_data = data;
+  802c34:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c37:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_EVCTL);
+  802c3c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802c41:	e8 46 f4 ff ff       	call   80208c <nsipc>
+}
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+
+00802c48 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802c48:	55                   	push   %ebp
+  802c49:	89 e5                	mov    %esp,%ebp
+  802c4b:	56                   	push   %esi
+  802c4c:	53                   	push   %ebx
+  802c4d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802c50:	89 35 00 a0 80 00    	mov    %esi,0x80a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802c56:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c59:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802c5e:	b8 10 00 00 00       	mov    $0x10,%eax
+  802c63:	e8 24 f4 ff ff       	call   80208c <nsipc>
+  802c68:	89 c3                	mov    %eax,%ebx
+  802c6a:	85 c0                	test   %eax,%eax
+  802c6c:	7e 1f                	jle    802c8d <nsipc_evwait+0x45>
+		assert(r <= max);
+  802c6e:	39 c6                	cmp    %eax,%esi
+  802c70:	7c 24                	jl     802c96 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802c72:	83 ec 04             	sub    $0x4,%esp
+  802c75:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802c7c:	50                   	push   %eax
+  802c7d:	68 00 a0 80 00       	push   $0x80a000
+  802c82:	ff 75 08             	push   0x8(%ebp)
+  802c85:	e8 d6 de ff ff       	call   800b60 <memmove>
+  802c8a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802c8d:	89 d8                	mov    %ebx,%eax
+  802c8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c92:	5b                   	pop    %ebx
+  802c93:	5e                   	pop    %esi
+  802c94:	5d                   	pop    %ebp
+  802c95:	c3                   	ret
+		assert(r <= max);
+  802c96:	68 56 41 80 00       	push   $0x804156
+  802c9b:	68 29 41 80 00       	push   $0x804129
+  802ca0:	68 6a 01 00 00       	push   $0x16a
+  802ca5:	68 3e 41 80 00       	push   $0x80413e
+  802caa:	e8 2f d5 ff ff       	call   8001de <_panic>
+
+00802caf <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802caf:	55                   	push   %ebp
+  802cb0:	89 e5                	mov    %esp,%ebp
+  802cb2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb8:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  802cbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc0:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  802cc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cc8:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  802ccd:	b8 09 00 00 00       	mov    $0x9,%eax
+  802cd2:	e8 b5 f3 ff ff       	call   80208c <nsipc>
+}
+  802cd7:	c9                   	leave
+  802cd8:	c3                   	ret
+
+00802cd9 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802cd9:	55                   	push   %ebp
+  802cda:	89 e5                	mov    %esp,%ebp
+  802cdc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802cdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce2:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_OFFLOAD);
+  802ce7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802cec:	e8 9b f3 ff ff       	call   80208c <nsipc>
+}
+  802cf1:	c9                   	leave
+  802cf2:	c3                   	ret
+
+00802cf3 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802cf3:	55                   	push   %ebp
+  802cf4:	89 e5                	mov    %esp,%ebp
+  802cf6:	53                   	push   %ebx
+  802cf7:	83 ec 04             	sub    $0x4,%esp
+  802cfa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802cfd:	b8 12 00 00 00       	mov    $0x12,%eax
+  802d02:	e8 85 f3 ff ff       	call   80208c <nsipc>
+  802d07:	85 c0                	test   %eax,%eax
+  802d09:	78 50                	js     802d5b <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802d0b:	8b 15 00 a0 80 00    	mov    0x80a000,%edx
+  802d11:	89 13                	mov    %edx,(%ebx)
+  802d13:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  802d19:	89 53 04             	mov    %edx,0x4(%ebx)
+  802d1c:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  802d22:	89 53 08             	mov    %edx,0x8(%ebx)
+  802d25:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  802d2b:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802d2e:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  802d34:	89 53 10             	mov    %edx,0x10(%ebx)
+  802d37:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  802d3d:	89 53 14             	mov    %edx,0x14(%ebx)
+  802d40:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  802d46:	89 53 18             	mov    %edx,0x18(%ebx)
+  802d49:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  802d4f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802d52:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  802d58:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802d5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d5e:	c9                   	leave
+  802d5f:	c3                   	ret
+
+00802d60 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802d60:	55                   	push   %ebp
+  802d61:	89 e5                	mov    %esp,%ebp
+  802d63:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d66:	6a 03                	push   $0x3
+  802d68:	e8 bf 0c 00 00       	call   803a2c <ipc_find_env>
+  802d6d:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802d72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d75:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802d7a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802d7f:	e8 08 f3 ff ff       	call   80208c <nsipc>
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	85 c0                	test   %eax,%eax
+  802d89:	78 0a                	js     802d95 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802d8b:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802d90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d95:	c9                   	leave
+  802d96:	c3                   	ret
+
+00802d97 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	57                   	push   %edi
+  802d9b:	56                   	push   %esi
+  802d9c:	53                   	push   %ebx
+  802d9d:	83 ec 1c             	sub    $0x1c,%esp
+  802da0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802da3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802da6:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802dab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802db0:	89 e0                	mov    %esp,%eax
+  802db2:	89 f2                	mov    %esi,%edx
+  802db4:	29 c2                	sub    %eax,%edx
+  802db6:	89 d0                	mov    %edx,%eax
+  802db8:	c1 e8 0f             	shr    $0xf,%eax
+  802dbb:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802dc1:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802dc4:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  802dcb:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802dce:	83 ec 0c             	sub    $0xc,%esp
+  802dd1:	ff 75 e0             	push   -0x20(%ebp)
+  802dd4:	e8 92 0c 00 00       	call   803a6b <pageref>
+  802dd9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ddc:	83 c4 04             	add    $0x4,%esp
+  802ddf:	ff 75 dc             	push   -0x24(%ebp)
+  802de2:	e8 84 0c 00 00       	call   803a6b <pageref>
+  802de7:	89 e2                	mov    %esp,%edx
+  802de9:	89 f1                	mov    %esi,%ecx
+  802deb:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802ded:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802df0:	89 ca                	mov    %ecx,%edx
+  802df2:	c1 ea 0f             	shr    $0xf,%edx
+  802df5:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802dfb:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802dfe:	8b 14 95 40 83 80 00 	mov    0x808340(,%edx,4),%edx
+  802e05:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802e08:	39 d7                	cmp    %edx,%edi
+  802e0a:	74 40                	je     802e4c <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802e0c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e0f:	75 9f                	jne    802db0 <_pipeisclosed+0x19>
+  802e11:	89 e2                	mov    %esp,%edx
+  802e13:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802e18:	29 d0                	sub    %edx,%eax
+  802e1a:	89 c2                	mov    %eax,%edx
+  802e1c:	c1 ea 0f             	shr    $0xf,%edx
+  802e1f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e29:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e2c:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  802e33:	8b 40 58             	mov    0x58(%eax),%eax
+  802e36:	6a 01                	push   $0x1
+  802e38:	50                   	push   %eax
+  802e39:	57                   	push   %edi
+  802e3a:	68 5f 41 80 00       	push   $0x80415f
+  802e3f:	e8 75 d4 ff ff       	call   8002b9 <cprintf>
+  802e44:	83 c4 10             	add    $0x10,%esp
+  802e47:	e9 5f ff ff ff       	jmp    802dab <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802e4c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e4f:	0f 94 c0             	sete   %al
+  802e52:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e58:	5b                   	pop    %ebx
+  802e59:	5e                   	pop    %esi
+  802e5a:	5f                   	pop    %edi
+  802e5b:	5d                   	pop    %ebp
+  802e5c:	c3                   	ret
+
+00802e5d <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	53                   	push   %ebx
+  802e61:	83 ec 0c             	sub    $0xc,%esp
+  802e64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e67:	53                   	push   %ebx
+  802e68:	6a 00                	push   $0x0
+  802e6a:	e8 fa df ff ff       	call   800e69 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e6f:	89 1c 24             	mov    %ebx,(%esp)
+  802e72:	e8 e0 e3 ff ff       	call   801257 <fd2data>
+  802e77:	83 c4 08             	add    $0x8,%esp
+  802e7a:	50                   	push   %eax
+  802e7b:	6a 00                	push   $0x0
+  802e7d:	e8 e7 df ff ff       	call   800e69 <sys_page_unmap>
+}
+  802e82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e85:	c9                   	leave
+  802e86:	c3                   	ret
+
+00802e87 <devpipe_read>:
+{
+  802e87:	55                   	push   %ebp
+  802e88:	89 e5                	mov    %esp,%ebp
+  802e8a:	57                   	push   %edi
+  802e8b:	56                   	push   %esi
+  802e8c:	53                   	push   %ebx
+  802e8d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802e90:	ff 75 08             	push   0x8(%ebp)
+  802e93:	e8 bf e3 ff ff       	call   801257 <fd2data>
+  802e98:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e9a:	8b 70 04             	mov    0x4(%eax),%esi
+  802e9d:	8b 00                	mov    (%eax),%eax
+  802e9f:	83 c4 10             	add    $0x10,%esp
+  802ea2:	39 f0                	cmp    %esi,%eax
+  802ea4:	75 36                	jne    802edc <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802ea6:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802ea9:	89 da                	mov    %ebx,%edx
+  802eab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eae:	e8 e4 fe ff ff       	call   802d97 <_pipeisclosed>
+  802eb3:	85 c0                	test   %eax,%eax
+  802eb5:	0f 85 d4 00 00 00    	jne    802f8f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802ebb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ec0:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802ec4:	83 ec 04             	sub    $0x4,%esp
+  802ec7:	6a ff                	push   $0xffffffff
+  802ec9:	56                   	push   %esi
+  802eca:	57                   	push   %edi
+  802ecb:	e8 12 e3 ff ff       	call   8011e2 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802ed0:	8b 73 04             	mov    0x4(%ebx),%esi
+  802ed3:	8b 03                	mov    (%ebx),%eax
+  802ed5:	83 c4 10             	add    $0x10,%esp
+  802ed8:	39 c6                	cmp    %eax,%esi
+  802eda:	74 cd                	je     802ea9 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802edc:	8b 73 04             	mov    0x4(%ebx),%esi
+  802edf:	8b 03                	mov    (%ebx),%eax
+  802ee1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802ee7:	29 c6                	sub    %eax,%esi
+  802ee9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802eee:	f7 e6                	mul    %esi
+  802ef0:	c1 ea 0c             	shr    $0xc,%edx
+  802ef3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ef9:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802efb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802efe:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802f02:	8b 0b                	mov    (%ebx),%ecx
+  802f04:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f09:	f7 e1                	mul    %ecx
+  802f0b:	c1 ea 0b             	shr    $0xb,%edx
+  802f0e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f14:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802f16:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802f1b:	29 cf                	sub    %ecx,%edi
+  802f1d:	39 f7                	cmp    %esi,%edi
+  802f1f:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802f22:	83 ec 04             	sub    $0x4,%esp
+  802f25:	57                   	push   %edi
+  802f26:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802f2a:	50                   	push   %eax
+  802f2b:	ff 75 0c             	push   0xc(%ebp)
+  802f2e:	e8 2d dc ff ff       	call   800b60 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802f33:	83 c4 0c             	add    $0xc,%esp
+  802f36:	89 f0                	mov    %esi,%eax
+  802f38:	29 f8                	sub    %edi,%eax
+  802f3a:	50                   	push   %eax
+  802f3b:	8d 43 10             	lea    0x10(%ebx),%eax
+  802f3e:	50                   	push   %eax
+  802f3f:	89 f8                	mov    %edi,%eax
+  802f41:	03 45 0c             	add    0xc(%ebp),%eax
+  802f44:	50                   	push   %eax
+  802f45:	e8 16 dc ff ff       	call   800b60 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802f4a:	8b 0b                	mov    (%ebx),%ecx
+  802f4c:	01 f1                	add    %esi,%ecx
+  802f4e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f53:	f7 e1                	mul    %ecx
+  802f55:	c1 ea 0c             	shr    $0xc,%edx
+  802f58:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f5e:	29 c1                	sub    %eax,%ecx
+  802f60:	89 0b                	mov    %ecx,(%ebx)
+  802f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f67:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802f6b:	83 c4 10             	add    $0x10,%esp
+  802f6e:	85 c0                	test   %eax,%eax
+  802f70:	75 0a                	jne    802f7c <devpipe_read+0xf5>
+	return n;
+  802f72:	89 f0                	mov    %esi,%eax
+}
+  802f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f77:	5b                   	pop    %ebx
+  802f78:	5e                   	pop    %esi
+  802f79:	5f                   	pop    %edi
+  802f7a:	5d                   	pop    %ebp
+  802f7b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802f7c:	83 ec 08             	sub    $0x8,%esp
+  802f7f:	68 00 04 00 00       	push   $0x400
+  802f84:	53                   	push   %ebx
+  802f85:	e8 7a e2 ff ff       	call   801204 <sys_futex_wake>
+  802f8a:	83 c4 10             	add    $0x10,%esp
+  802f8d:	eb e3                	jmp    802f72 <devpipe_read+0xeb>
+			return 0;
+  802f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f94:	eb de                	jmp    802f74 <devpipe_read+0xed>
+
+00802f96 <devpipe_write>:
+{
+  802f96:	55                   	push   %ebp
+  802f97:	89 e5                	mov    %esp,%ebp
+  802f99:	57                   	push   %edi
+  802f9a:	56                   	push   %esi
+  802f9b:	53                   	push   %ebx
+  802f9c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f9f:	ff 75 08             	push   0x8(%ebp)
+  802fa2:	e8 b0 e2 ff ff       	call   801257 <fd2data>
+  802fa7:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802fa9:	83 c4 10             	add    $0x10,%esp
+  802fac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fb3:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802fb8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fbc:	0f 84 43 01 00 00    	je     803105 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fc2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fc5:	8b 06                	mov    (%esi),%eax
+  802fc7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fcd:	29 c1                	sub    %eax,%ecx
+  802fcf:	89 c8                	mov    %ecx,%eax
+  802fd1:	f7 e7                	mul    %edi
+  802fd3:	c1 ea 0c             	shr    $0xc,%edx
+  802fd6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fdc:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802fde:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802fe4:	75 52                	jne    803038 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802fe6:	89 f2                	mov    %esi,%edx
+  802fe8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802feb:	e8 a7 fd ff ff       	call   802d97 <_pipeisclosed>
+  802ff0:	85 c0                	test   %eax,%eax
+  802ff2:	0f 85 28 01 00 00    	jne    803120 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802ff8:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ffa:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ffd:	8b 06                	mov    (%esi),%eax
+  802fff:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803005:	29 c1                	sub    %eax,%ecx
+  803007:	89 c8                	mov    %ecx,%eax
+  803009:	f7 e7                	mul    %edi
+  80300b:	c1 ea 0c             	shr    $0xc,%edx
+  80300e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803014:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803016:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80301c:	75 a4                	jne    802fc2 <devpipe_write+0x2c>
+  80301e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803023:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803027:	83 ec 04             	sub    $0x4,%esp
+  80302a:	6a ff                	push   $0xffffffff
+  80302c:	53                   	push   %ebx
+  80302d:	56                   	push   %esi
+  80302e:	e8 af e1 ff ff       	call   8011e2 <sys_futex_wait>
+}
+  803033:	83 c4 10             	add    $0x10,%esp
+  803036:	eb 8a                	jmp    802fc2 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803038:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80303b:	8b 06                	mov    (%esi),%eax
+  80303d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803043:	29 c1                	sub    %eax,%ecx
+  803045:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80304a:	f7 e1                	mul    %ecx
+  80304c:	c1 ea 0c             	shr    $0xc,%edx
+  80304f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803055:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803057:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80305c:	89 d8                	mov    %ebx,%eax
+  80305e:	29 c8                	sub    %ecx,%eax
+  803060:	8b 55 10             	mov    0x10(%ebp),%edx
+  803063:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803066:	29 ca                	sub    %ecx,%edx
+  803068:	39 d0                	cmp    %edx,%eax
+  80306a:	0f 46 d0             	cmovbe %eax,%edx
+  80306d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803070:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803073:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803078:	f7 e1                	mul    %ecx
+  80307a:	c1 ea 0b             	shr    $0xb,%edx
+  80307d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803083:	89 ca                	mov    %ecx,%edx
+  803085:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803087:	29 d3                	sub    %edx,%ebx
+  803089:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80308c:	39 c3                	cmp    %eax,%ebx
+  80308e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803091:	83 ec 04             	sub    $0x4,%esp
+  803094:	53                   	push   %ebx
+  803095:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803098:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80309b:	51                   	push   %ecx
+  80309c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8030a0:	50                   	push   %eax
+  8030a1:	e8 ba da ff ff       	call   800b60 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8030a6:	83 c4 0c             	add    $0xc,%esp
+  8030a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030ac:	29 d8                	sub    %ebx,%eax
+  8030ae:	50                   	push   %eax
+  8030af:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030b2:	01 cb                	add    %ecx,%ebx
+  8030b4:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8030b7:	53                   	push   %ebx
+  8030b8:	8d 46 10             	lea    0x10(%esi),%eax
+  8030bb:	50                   	push   %eax
+  8030bc:	e8 9f da ff ff       	call   800b60 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8030c1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030c7:	01 c1                	add    %eax,%ecx
+  8030c9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030ce:	f7 e1                	mul    %ecx
+  8030d0:	c1 ea 0c             	shr    $0xc,%edx
+  8030d3:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8030d9:	89 ca                	mov    %ecx,%edx
+  8030db:	29 c2                	sub    %eax,%edx
+  8030dd:	89 56 04             	mov    %edx,0x4(%esi)
+  8030e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e5:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8030e9:	83 c4 10             	add    $0x10,%esp
+  8030ec:	85 c0                	test   %eax,%eax
+  8030ee:	75 1a                	jne    80310a <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8030f0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8030f3:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8030f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030f9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8030fc:	0f 82 c0 fe ff ff    	jb     802fc2 <devpipe_write+0x2c>
+  803102:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803105:	8b 45 10             	mov    0x10(%ebp),%eax
+  803108:	eb 1b                	jmp    803125 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  80310a:	83 ec 08             	sub    $0x8,%esp
+  80310d:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803112:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803115:	50                   	push   %eax
+  803116:	e8 e9 e0 ff ff       	call   801204 <sys_futex_wake>
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	eb d0                	jmp    8030f0 <devpipe_write+0x15a>
+				return 0;
+  803120:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803128:	5b                   	pop    %ebx
+  803129:	5e                   	pop    %esi
+  80312a:	5f                   	pop    %edi
+  80312b:	5d                   	pop    %ebp
+  80312c:	c3                   	ret
+
+0080312d <devpipe_stat>:
+{
+  80312d:	55                   	push   %ebp
+  80312e:	89 e5                	mov    %esp,%ebp
+  803130:	56                   	push   %esi
+  803131:	53                   	push   %ebx
+  803132:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803135:	83 ec 0c             	sub    $0xc,%esp
+  803138:	ff 75 08             	push   0x8(%ebp)
+  80313b:	e8 17 e1 ff ff       	call   801257 <fd2data>
+  803140:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803142:	83 c4 08             	add    $0x8,%esp
+  803145:	68 72 41 80 00       	push   $0x804172
+  80314a:	53                   	push   %ebx
+  80314b:	e8 60 d8 ff ff       	call   8009b0 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803150:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803153:	8b 06                	mov    (%esi),%eax
+  803155:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80315b:	29 c1                	sub    %eax,%ecx
+  80315d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803162:	89 c8                	mov    %ecx,%eax
+  803164:	f7 e2                	mul    %edx
+  803166:	c1 ea 0c             	shr    $0xc,%edx
+  803169:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80316f:	29 d1                	sub    %edx,%ecx
+  803171:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803177:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80317e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803181:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803188:	50 80 00 
+}
+  80318b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803190:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803193:	5b                   	pop    %ebx
+  803194:	5e                   	pop    %esi
+  803195:	5d                   	pop    %ebp
+  803196:	c3                   	ret
+
+00803197 <devpipe_poll>:
+{
+  803197:	55                   	push   %ebp
+  803198:	89 e5                	mov    %esp,%ebp
+  80319a:	57                   	push   %edi
+  80319b:	56                   	push   %esi
+  80319c:	53                   	push   %ebx
+  80319d:	83 ec 18             	sub    $0x18,%esp
+  8031a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8031a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031a6:	57                   	push   %edi
+  8031a7:	e8 ab e0 ff ff       	call   801257 <fd2data>
+  8031ac:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8031ae:	83 c4 10             	add    $0x10,%esp
+  8031b1:	89 f3                	mov    %esi,%ebx
+  8031b3:	83 e3 01             	and    $0x1,%ebx
+  8031b6:	75 27                	jne    8031df <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8031b8:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8031be:	75 48                	jne    803208 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8031c0:	89 ca                	mov    %ecx,%edx
+  8031c2:	89 f8                	mov    %edi,%eax
+  8031c4:	e8 ce fb ff ff       	call   802d97 <_pipeisclosed>
+  8031c9:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8031cb:	89 d8                	mov    %ebx,%eax
+  8031cd:	83 c8 10             	or     $0x10,%eax
+  8031d0:	85 d2                	test   %edx,%edx
+  8031d2:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8031d5:	89 d8                	mov    %ebx,%eax
+  8031d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031da:	5b                   	pop    %ebx
+  8031db:	5e                   	pop    %esi
+  8031dc:	5f                   	pop    %edi
+  8031dd:	5d                   	pop    %ebp
+  8031de:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031df:	8b 58 04             	mov    0x4(%eax),%ebx
+  8031e2:	8b 00                	mov    (%eax),%eax
+  8031e4:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8031ea:	29 c3                	sub    %eax,%ebx
+  8031ec:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031f1:	89 d8                	mov    %ebx,%eax
+  8031f3:	f7 e2                	mul    %edx
+  8031f5:	c1 ea 0c             	shr    $0xc,%edx
+  8031f8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8031fe:	39 d3                	cmp    %edx,%ebx
+  803200:	0f 95 c3             	setne  %bl
+  803203:	0f b6 db             	movzbl %bl,%ebx
+  803206:	eb b0                	jmp    8031b8 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803208:	8b 71 04             	mov    0x4(%ecx),%esi
+  80320b:	8b 01                	mov    (%ecx),%eax
+  80320d:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803213:	29 c6                	sub    %eax,%esi
+  803215:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80321a:	89 f0                	mov    %esi,%eax
+  80321c:	f7 e2                	mul    %edx
+  80321e:	c1 ea 0c             	shr    $0xc,%edx
+  803221:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803227:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803229:	89 d8                	mov    %ebx,%eax
+  80322b:	83 c8 04             	or     $0x4,%eax
+  80322e:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803234:	0f 42 d8             	cmovb  %eax,%ebx
+  803237:	eb 87                	jmp    8031c0 <devpipe_poll+0x29>
+
+00803239 <pipe>:
+{
+  803239:	55                   	push   %ebp
+  80323a:	89 e5                	mov    %esp,%ebp
+  80323c:	56                   	push   %esi
+  80323d:	53                   	push   %ebx
+  80323e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803241:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803244:	50                   	push   %eax
+  803245:	e8 24 e0 ff ff       	call   80126e <fd_alloc>
+  80324a:	89 c3                	mov    %eax,%ebx
+  80324c:	83 c4 10             	add    $0x10,%esp
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	0f 88 23 01 00 00    	js     80337a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803257:	83 ec 04             	sub    $0x4,%esp
+  80325a:	68 07 04 00 00       	push   $0x407
+  80325f:	ff 75 f4             	push   -0xc(%ebp)
+  803262:	6a 00                	push   $0x0
+  803264:	e8 7b db ff ff       	call   800de4 <sys_page_alloc>
+  803269:	89 c3                	mov    %eax,%ebx
+  80326b:	83 c4 10             	add    $0x10,%esp
+  80326e:	85 c0                	test   %eax,%eax
+  803270:	0f 88 04 01 00 00    	js     80337a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803276:	83 ec 0c             	sub    $0xc,%esp
+  803279:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80327c:	50                   	push   %eax
+  80327d:	e8 ec df ff ff       	call   80126e <fd_alloc>
+  803282:	89 c3                	mov    %eax,%ebx
+  803284:	83 c4 10             	add    $0x10,%esp
+  803287:	85 c0                	test   %eax,%eax
+  803289:	0f 88 db 00 00 00    	js     80336a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80328f:	83 ec 04             	sub    $0x4,%esp
+  803292:	68 07 04 00 00       	push   $0x407
+  803297:	ff 75 f0             	push   -0x10(%ebp)
+  80329a:	6a 00                	push   $0x0
+  80329c:	e8 43 db ff ff       	call   800de4 <sys_page_alloc>
+  8032a1:	89 c3                	mov    %eax,%ebx
+  8032a3:	83 c4 10             	add    $0x10,%esp
+  8032a6:	85 c0                	test   %eax,%eax
+  8032a8:	0f 88 bc 00 00 00    	js     80336a <pipe+0x131>
+	va = fd2data(fd0);
+  8032ae:	83 ec 0c             	sub    $0xc,%esp
+  8032b1:	ff 75 f4             	push   -0xc(%ebp)
+  8032b4:	e8 9e df ff ff       	call   801257 <fd2data>
+  8032b9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032bb:	83 c4 0c             	add    $0xc,%esp
+  8032be:	68 07 04 00 00       	push   $0x407
+  8032c3:	50                   	push   %eax
+  8032c4:	6a 00                	push   $0x0
+  8032c6:	e8 19 db ff ff       	call   800de4 <sys_page_alloc>
+  8032cb:	89 c3                	mov    %eax,%ebx
+  8032cd:	83 c4 10             	add    $0x10,%esp
+  8032d0:	85 c0                	test   %eax,%eax
+  8032d2:	0f 88 82 00 00 00    	js     80335a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032d8:	83 ec 0c             	sub    $0xc,%esp
+  8032db:	ff 75 f0             	push   -0x10(%ebp)
+  8032de:	e8 74 df ff ff       	call   801257 <fd2data>
+  8032e3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8032ea:	50                   	push   %eax
+  8032eb:	6a 00                	push   $0x0
+  8032ed:	56                   	push   %esi
+  8032ee:	6a 00                	push   $0x0
+  8032f0:	e8 32 db ff ff       	call   800e27 <sys_page_map>
+  8032f5:	89 c3                	mov    %eax,%ebx
+  8032f7:	83 c4 20             	add    $0x20,%esp
+  8032fa:	85 c0                	test   %eax,%eax
+  8032fc:	78 4e                	js     80334c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032fe:	a1 60 50 80 00       	mov    0x805060,%eax
+  803303:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803306:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803308:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80330b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803312:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803315:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803317:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80331a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803321:	83 ec 0c             	sub    $0xc,%esp
+  803324:	ff 75 f4             	push   -0xc(%ebp)
+  803327:	e8 1b df ff ff       	call   801247 <fd2num>
+  80332c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80332f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803331:	83 c4 04             	add    $0x4,%esp
+  803334:	ff 75 f0             	push   -0x10(%ebp)
+  803337:	e8 0b df ff ff       	call   801247 <fd2num>
+  80333c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80333f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803342:	83 c4 10             	add    $0x10,%esp
+  803345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80334a:	eb 2e                	jmp    80337a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80334c:	83 ec 08             	sub    $0x8,%esp
+  80334f:	56                   	push   %esi
+  803350:	6a 00                	push   $0x0
+  803352:	e8 12 db ff ff       	call   800e69 <sys_page_unmap>
+  803357:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80335a:	83 ec 08             	sub    $0x8,%esp
+  80335d:	ff 75 f0             	push   -0x10(%ebp)
+  803360:	6a 00                	push   $0x0
+  803362:	e8 02 db ff ff       	call   800e69 <sys_page_unmap>
+  803367:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80336a:	83 ec 08             	sub    $0x8,%esp
+  80336d:	ff 75 f4             	push   -0xc(%ebp)
+  803370:	6a 00                	push   $0x0
+  803372:	e8 f2 da ff ff       	call   800e69 <sys_page_unmap>
+  803377:	83 c4 10             	add    $0x10,%esp
+}
+  80337a:	89 d8                	mov    %ebx,%eax
+  80337c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80337f:	5b                   	pop    %ebx
+  803380:	5e                   	pop    %esi
+  803381:	5d                   	pop    %ebp
+  803382:	c3                   	ret
+
+00803383 <pipeisclosed>:
+{
+  803383:	55                   	push   %ebp
+  803384:	89 e5                	mov    %esp,%ebp
+  803386:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803389:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80338c:	50                   	push   %eax
+  80338d:	ff 75 08             	push   0x8(%ebp)
+  803390:	e8 29 df ff ff       	call   8012be <fd_lookup>
+  803395:	83 c4 10             	add    $0x10,%esp
+  803398:	85 c0                	test   %eax,%eax
+  80339a:	78 18                	js     8033b4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80339c:	83 ec 0c             	sub    $0xc,%esp
+  80339f:	ff 75 f4             	push   -0xc(%ebp)
+  8033a2:	e8 b0 de ff ff       	call   801257 <fd2data>
+  8033a7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ac:	e8 e6 f9 ff ff       	call   802d97 <_pipeisclosed>
+  8033b1:	83 c4 10             	add    $0x10,%esp
+}
+  8033b4:	c9                   	leave
+  8033b5:	c3                   	ret
+
+008033b6 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8033b6:	55                   	push   %ebp
+  8033b7:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8033b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033bc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8033c2:	5d                   	pop    %ebp
+  8033c3:	c3                   	ret
+
+008033c4 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8033c4:	55                   	push   %ebp
+  8033c5:	89 e5                	mov    %esp,%ebp
+  8033c7:	53                   	push   %ebx
+  8033c8:	83 ec 04             	sub    $0x4,%esp
+  8033cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8033ce:	8b 03                	mov    (%ebx),%eax
+  8033d0:	85 c0                	test   %eax,%eax
+  8033d2:	75 05                	jne    8033d9 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8033d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033d7:	c9                   	leave
+  8033d8:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8033d9:	83 ec 08             	sub    $0x8,%esp
+  8033dc:	50                   	push   %eax
+  8033dd:	8d 43 04             	lea    0x4(%ebx),%eax
+  8033e0:	50                   	push   %eax
+  8033e1:	e8 d3 dc ff ff       	call   8010b9 <sys_page_batch>
+	pb->pb_n = 0;
+  8033e6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8033ec:	83 c4 10             	add    $0x10,%esp
+  8033ef:	eb e3                	jmp    8033d4 <pgbatch_flush+0x10>
+
+008033f1 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8033f1:	55                   	push   %ebp
+  8033f2:	89 e5                	mov    %esp,%ebp
+  8033f4:	56                   	push   %esi
+  8033f5:	53                   	push   %ebx
+  8033f6:	89 c3                	mov    %eax,%ebx
+  8033f8:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033fa:	83 38 20             	cmpl   $0x20,(%eax)
+  8033fd:	74 2c                	je     80342b <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8033ff:	8b 03                	mov    (%ebx),%eax
+  803401:	8d 50 01             	lea    0x1(%eax),%edx
+  803404:	89 13                	mov    %edx,(%ebx)
+  803406:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803409:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  80340d:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  80340f:	83 ec 04             	sub    $0x4,%esp
+  803412:	6a 18                	push   $0x18
+  803414:	6a 00                	push   $0x0
+  803416:	50                   	push   %eax
+  803417:	e8 0f d7 ff ff       	call   800b2b <memset>
+	return 0;
+  80341c:	83 c4 10             	add    $0x10,%esp
+  80341f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803427:	5b                   	pop    %ebx
+  803428:	5e                   	pop    %esi
+  803429:	5d                   	pop    %ebp
+  80342a:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80342b:	83 ec 0c             	sub    $0xc,%esp
+  80342e:	50                   	push   %eax
+  80342f:	e8 90 ff ff ff       	call   8033c4 <pgbatch_flush>
+  803434:	83 c4 10             	add    $0x10,%esp
+  803437:	85 c0                	test   %eax,%eax
+  803439:	79 c4                	jns    8033ff <pgbatch_slot+0xe>
+  80343b:	eb e7                	jmp    803424 <pgbatch_slot+0x33>
+
+0080343d <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80343d:	55                   	push   %ebp
+  80343e:	89 e5                	mov    %esp,%ebp
+  803440:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803443:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803446:	8b 45 08             	mov    0x8(%ebp),%eax
+  803449:	e8 a3 ff ff ff       	call   8033f1 <pgbatch_slot>
+  80344e:	85 c0                	test   %eax,%eax
+  803450:	78 20                	js     803472 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803452:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803455:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80345b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80345e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803461:	8b 55 10             	mov    0x10(%ebp),%edx
+  803464:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803467:	8b 55 14             	mov    0x14(%ebp),%edx
+  80346a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80346d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803472:	c9                   	leave
+  803473:	c3                   	ret
+
+00803474 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803474:	55                   	push   %ebp
+  803475:	89 e5                	mov    %esp,%ebp
+  803477:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80347a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80347d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803480:	e8 6c ff ff ff       	call   8033f1 <pgbatch_slot>
+  803485:	85 c0                	test   %eax,%eax
+  803487:	78 2c                	js     8034b5 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803489:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80348c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803492:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803495:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803498:	8b 55 10             	mov    0x10(%ebp),%edx
+  80349b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80349e:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034a1:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8034a4:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034a7:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034aa:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8034ad:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034b5:	c9                   	leave
+  8034b6:	c3                   	ret
+
+008034b7 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  8034b7:	55                   	push   %ebp
+  8034b8:	89 e5                	mov    %esp,%ebp
+  8034ba:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034bd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c3:	e8 29 ff ff ff       	call   8033f1 <pgbatch_slot>
+  8034c8:	85 c0                	test   %eax,%eax
+  8034ca:	78 1a                	js     8034e6 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8034cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034cf:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8034d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034d8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034db:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034de:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8034e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034e6:	c9                   	leave
+  8034e7:	c3                   	ret
+
+008034e8 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8034e8:	55                   	push   %ebp
+  8034e9:	89 e5                	mov    %esp,%ebp
+  8034eb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034ee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f4:	e8 f8 fe ff ff       	call   8033f1 <pgbatch_slot>
+  8034f9:	85 c0                	test   %eax,%eax
+  8034fb:	78 20                	js     80351d <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8034fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803500:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803506:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803509:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80350c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80350f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803512:	8b 55 14             	mov    0x14(%ebp),%edx
+  803515:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803518:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80351d:	c9                   	leave
+  80351e:	c3                   	ret
+
+0080351f <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803525:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803528:	8b 45 08             	mov    0x8(%ebp),%eax
+  80352b:	e8 c1 fe ff ff       	call   8033f1 <pgbatch_slot>
+  803530:	85 c0                	test   %eax,%eax
+  803532:	78 26                	js     80355a <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803534:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803537:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80353d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803540:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803543:	8b 55 10             	mov    0x10(%ebp),%edx
+  803546:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803549:	8b 55 14             	mov    0x14(%ebp),%edx
+  80354c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80354f:	8b 55 18             	mov    0x18(%ebp),%edx
+  803552:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803555:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80355a:	c9                   	leave
+  80355b:	c3                   	ret
+
+0080355c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80355c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803561:	c3                   	ret
+
+00803562 <devcons_poll>:
+{
+  803562:	55                   	push   %ebp
+  803563:	89 e5                	mov    %esp,%ebp
+  803565:	53                   	push   %ebx
+  803566:	83 ec 04             	sub    $0x4,%esp
+  803569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80356c:	89 da                	mov    %ebx,%edx
+  80356e:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803571:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803578:	74 0c                	je     803586 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80357a:	89 d8                	mov    %ebx,%eax
+  80357c:	83 e0 01             	and    $0x1,%eax
+  80357f:	09 d0                	or     %edx,%eax
+}
+  803581:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803584:	c9                   	leave
+  803585:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803586:	e8 bb d7 ff ff       	call   800d46 <sys_cgetc>
+  80358b:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803590:	89 da                	mov    %ebx,%edx
+  803592:	83 e2 04             	and    $0x4,%edx
+  803595:	85 c0                	test   %eax,%eax
+  803597:	74 e6                	je     80357f <devcons_poll+0x1d>
+  803599:	eb df                	jmp    80357a <devcons_poll+0x18>
+
+0080359b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80359b:	55                   	push   %ebp
+  80359c:	89 e5                	mov    %esp,%ebp
+  80359e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8035a1:	68 7e 41 80 00       	push   $0x80417e
+  8035a6:	ff 75 0c             	push   0xc(%ebp)
+  8035a9:	e8 02 d4 ff ff       	call   8009b0 <strcpy>
+	return 0;
+}
+  8035ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b3:	c9                   	leave
+  8035b4:	c3                   	ret
+
+008035b5 <devcons_write>:
+{
+  8035b5:	55                   	push   %ebp
+  8035b6:	89 e5                	mov    %esp,%ebp
+  8035b8:	57                   	push   %edi
+  8035b9:	56                   	push   %esi
+  8035ba:	53                   	push   %ebx
+  8035bb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8035c1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8035c4:	85 ff                	test   %edi,%edi
+  8035c6:	74 51                	je     803619 <devcons_write+0x64>
+  8035c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8035cd:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8035d2:	89 fb                	mov    %edi,%ebx
+  8035d4:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8035d6:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8035db:	39 d3                	cmp    %edx,%ebx
+  8035dd:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8035e0:	83 ec 04             	sub    $0x4,%esp
+  8035e3:	53                   	push   %ebx
+  8035e4:	03 45 0c             	add    0xc(%ebp),%eax
+  8035e7:	50                   	push   %eax
+  8035e8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035ee:	50                   	push   %eax
+  8035ef:	e8 6c d5 ff ff       	call   800b60 <memmove>
+		sys_cputs(buf, m);
+  8035f4:	83 c4 08             	add    $0x8,%esp
+  8035f7:	53                   	push   %ebx
+  8035f8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035fe:	50                   	push   %eax
+  8035ff:	e8 24 d7 ff ff       	call   800d28 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803604:	01 de                	add    %ebx,%esi
+  803606:	89 f0                	mov    %esi,%eax
+  803608:	83 c4 10             	add    $0x10,%esp
+  80360b:	39 fe                	cmp    %edi,%esi
+  80360d:	72 c3                	jb     8035d2 <devcons_write+0x1d>
+}
+  80360f:	89 f0                	mov    %esi,%eax
+  803611:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803614:	5b                   	pop    %ebx
+  803615:	5e                   	pop    %esi
+  803616:	5f                   	pop    %edi
+  803617:	5d                   	pop    %ebp
+  803618:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803619:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80361e:	eb ef                	jmp    80360f <devcons_write+0x5a>
+
+00803620 <devcons_read>:
+{
+  803620:	55                   	push   %ebp
+  803621:	89 e5                	mov    %esp,%ebp
+  803623:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803626:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80362b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80362f:	74 36                	je     803667 <devcons_read+0x47>
+	c = cons_peek;
+  803631:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  803636:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  80363d:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803640:	85 c0                	test   %eax,%eax
+  803642:	75 10                	jne    803654 <devcons_read+0x34>
+  803644:	e8 fd d6 ff ff       	call   800d46 <sys_cgetc>
+  803649:	85 c0                	test   %eax,%eax
+  80364b:	75 07                	jne    803654 <devcons_read+0x34>
+		sys_yield();
+  80364d:	e8 73 d7 ff ff       	call   800dc5 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803652:	eb f0                	jmp    803644 <devcons_read+0x24>
+	if (c < 0)
+  803654:	85 c0                	test   %eax,%eax
+  803656:	78 0f                	js     803667 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803658:	83 f8 04             	cmp    $0x4,%eax
+  80365b:	74 0c                	je     803669 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80365d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803660:	88 02                	mov    %al,(%edx)
+	return 1;
+  803662:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803667:	c9                   	leave
+  803668:	c3                   	ret
+		return 0;
+  803669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366e:	eb f7                	jmp    803667 <devcons_read+0x47>
+
+00803670 <cputchar>:
+{
+  803670:	55                   	push   %ebp
+  803671:	89 e5                	mov    %esp,%ebp
+  803673:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803676:	8b 45 08             	mov    0x8(%ebp),%eax
+  803679:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80367c:	6a 01                	push   $0x1
+  80367e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803681:	50                   	push   %eax
+  803682:	e8 a1 d6 ff ff       	call   800d28 <sys_cputs>
+}
+  803687:	83 c4 10             	add    $0x10,%esp
+  80368a:	c9                   	leave
+  80368b:	c3                   	ret
+
+0080368c <getchar>:
+{
+  80368c:	55                   	push   %ebp
+  80368d:	89 e5                	mov    %esp,%ebp
+  80368f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803692:	6a 01                	push   $0x1
+  803694:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803697:	50                   	push   %eax
+  803698:	6a 00                	push   $0x0
+  80369a:	e8 a3 de ff ff       	call   801542 <read>
+	if (r < 0)
+  80369f:	83 c4 10             	add    $0x10,%esp
+  8036a2:	85 c0                	test   %eax,%eax
+  8036a4:	78 06                	js     8036ac <getchar+0x20>
+	if (r < 1)
+  8036a6:	74 06                	je     8036ae <getchar+0x22>
+	return c;
+  8036a8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8036ac:	c9                   	leave
+  8036ad:	c3                   	ret
+		return -E_EOF;
+  8036ae:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8036b3:	eb f7                	jmp    8036ac <getchar+0x20>
+
+008036b5 <iscons>:
+{
+  8036b5:	55                   	push   %ebp
+  8036b6:	89 e5                	mov    %esp,%ebp
+  8036b8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036be:	50                   	push   %eax
+  8036bf:	ff 75 08             	push   0x8(%ebp)
+  8036c2:	e8 f7 db ff ff       	call   8012be <fd_lookup>
+  8036c7:	83 c4 10             	add    $0x10,%esp
+  8036ca:	85 c0                	test   %eax,%eax
+  8036cc:	78 11                	js     8036df <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8036ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036d1:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8036d7:	39 10                	cmp    %edx,(%eax)
+  8036d9:	0f 94 c0             	sete   %al
+  8036dc:	0f b6 c0             	movzbl %al,%eax
+}
+  8036df:	c9                   	leave
+  8036e0:	c3                   	ret
+
+008036e1 <opencons>:
+{
+  8036e1:	55                   	push   %ebp
+  8036e2:	89 e5                	mov    %esp,%ebp
+  8036e4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8036e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036ea:	50                   	push   %eax
+  8036eb:	e8 7e db ff ff       	call   80126e <fd_alloc>
+  8036f0:	83 c4 10             	add    $0x10,%esp
+  8036f3:	85 c0                	test   %eax,%eax
+  8036f5:	78 3a                	js     803731 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8036f7:	83 ec 04             	sub    $0x4,%esp
+  8036fa:	68 07 04 00 00       	push   $0x407
+  8036ff:	ff 75 f4             	push   -0xc(%ebp)
+  803702:	6a 00                	push   $0x0
+  803704:	e8 db d6 ff ff       	call   800de4 <sys_page_alloc>
+  803709:	83 c4 10             	add    $0x10,%esp
+  80370c:	85 c0                	test   %eax,%eax
+  80370e:	78 21                	js     803731 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803710:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803713:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803719:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80371b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80371e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803725:	83 ec 0c             	sub    $0xc,%esp
+  803728:	50                   	push   %eax
+  803729:	e8 19 db ff ff       	call   801247 <fd2num>
+  80372e:	83 c4 10             	add    $0x10,%esp
+}
+  803731:	c9                   	leave
+  803732:	c3                   	ret
+
+00803733 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803733:	55                   	push   %ebp
+  803734:	89 e5                	mov    %esp,%ebp
+  803736:	56                   	push   %esi
+  803737:	53                   	push   %ebx
+  803738:	8b 75 08             	mov    0x8(%ebp),%esi
+  80373b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80373e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803741:	85 c0                	test   %eax,%eax
+  803743:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803748:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80374b:	83 ec 0c             	sub    $0xc,%esp
+  80374e:	50                   	push   %eax
+  80374f:	e8 40 d8 ff ff       	call   800f94 <sys_ipc_recv>
+  803754:	83 c4 10             	add    $0x10,%esp
+  803757:	85 c0                	test   %eax,%eax
+  803759:	0f 88 8b 00 00 00    	js     8037ea <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80375f:	85 f6                	test   %esi,%esi
+  803761:	74 2a                	je     80378d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803763:	89 e2                	mov    %esp,%edx
+  803765:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80376a:	29 d0                	sub    %edx,%eax
+  80376c:	89 c2                	mov    %eax,%edx
+  80376e:	c1 ea 0f             	shr    $0xf,%edx
+  803771:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80377e:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  803785:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80378b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80378d:	85 db                	test   %ebx,%ebx
+  80378f:	74 2a                	je     8037bb <ipc_recv+0x88>
+  803791:	89 e2                	mov    %esp,%edx
+  803793:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803798:	29 d0                	sub    %edx,%eax
+  80379a:	89 c2                	mov    %eax,%edx
+  80379c:	c1 ea 0f             	shr    $0xf,%edx
+  80379f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a9:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8037ac:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  8037b3:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8037b9:	89 03                	mov    %eax,(%ebx)
+  8037bb:	89 e2                	mov    %esp,%edx
+  8037bd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037c2:	29 d0                	sub    %edx,%eax
+  8037c4:	89 c2                	mov    %eax,%edx
+  8037c6:	c1 ea 0f             	shr    $0xf,%edx
+  8037c9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d3:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8037d6:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  8037dd:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8037e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037e6:	5b                   	pop    %ebx
+  8037e7:	5e                   	pop    %esi
+  8037e8:	5d                   	pop    %ebp
+  8037e9:	c3                   	ret
+		if(from_env_store != NULL)
+  8037ea:	85 f6                	test   %esi,%esi
+  8037ec:	74 06                	je     8037f4 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8037ee:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8037f4:	85 db                	test   %ebx,%ebx
+  8037f6:	74 eb                	je     8037e3 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8037f8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037fe:	eb e3                	jmp    8037e3 <ipc_recv+0xb0>
+
+00803800 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803800:	55                   	push   %ebp
+  803801:	89 e5                	mov    %esp,%ebp
+  803803:	57                   	push   %edi
+  803804:	56                   	push   %esi
+  803805:	53                   	push   %ebx
+  803806:	83 ec 14             	sub    $0x14,%esp
+  803809:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80380c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80380f:	8b 75 14             	mov    0x14(%ebp),%esi
+  803812:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803815:	85 c0                	test   %eax,%eax
+  803817:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80381c:	0f 44 c2             	cmove  %edx,%eax
+  80381f:	ff 75 10             	push   0x10(%ebp)
+  803822:	50                   	push   %eax
+  803823:	e8 ce d7 ff ff       	call   800ff6 <sys_ipc_recv_pages>
+  803828:	83 c4 10             	add    $0x10,%esp
+  80382b:	85 c0                	test   %eax,%eax
+  80382d:	0f 88 ba 00 00 00    	js     8038ed <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803833:	85 ff                	test   %edi,%edi
+  803835:	74 2a                	je     803861 <ipc_recv_pages+0x61>
+  803837:	89 e2                	mov    %esp,%edx
+  803839:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80383e:	29 d0                	sub    %edx,%eax
+  803840:	89 c2                	mov    %eax,%edx
+  803842:	c1 ea 0f             	shr    $0xf,%edx
+  803845:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80384a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384f:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803852:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  803859:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80385f:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803861:	85 f6                	test   %esi,%esi
+  803863:	74 2a                	je     80388f <ipc_recv_pages+0x8f>
+  803865:	89 e2                	mov    %esp,%edx
+  803867:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80386c:	29 d0                	sub    %edx,%eax
+  80386e:	89 c2                	mov    %eax,%edx
+  803870:	c1 ea 0f             	shr    $0xf,%edx
+  803873:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803880:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  803887:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80388d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80388f:	85 db                	test   %ebx,%ebx
+  803891:	74 2a                	je     8038bd <ipc_recv_pages+0xbd>
+  803893:	89 e2                	mov    %esp,%edx
+  803895:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80389a:	29 d0                	sub    %edx,%eax
+  80389c:	89 c2                	mov    %eax,%edx
+  80389e:	c1 ea 0f             	shr    $0xf,%edx
+  8038a1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ab:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8038ae:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  8038b5:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8038bb:	89 03                	mov    %eax,(%ebx)
+  8038bd:	89 e2                	mov    %esp,%edx
+  8038bf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038c4:	29 d0                	sub    %edx,%eax
+  8038c6:	89 c2                	mov    %eax,%edx
+  8038c8:	c1 ea 0f             	shr    $0xf,%edx
+  8038cb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d5:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8038d8:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  8038df:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8038e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038e8:	5b                   	pop    %ebx
+  8038e9:	5e                   	pop    %esi
+  8038ea:	5f                   	pop    %edi
+  8038eb:	5d                   	pop    %ebp
+  8038ec:	c3                   	ret
+		if (from_env_store)
+  8038ed:	85 ff                	test   %edi,%edi
+  8038ef:	74 06                	je     8038f7 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8038f1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8038f7:	85 f6                	test   %esi,%esi
+  8038f9:	74 06                	je     803901 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8038fb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803901:	85 db                	test   %ebx,%ebx
+  803903:	74 e0                	je     8038e5 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803905:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80390b:	eb d8                	jmp    8038e5 <ipc_recv_pages+0xe5>
+
+0080390d <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80390d:	55                   	push   %ebp
+  80390e:	89 e5                	mov    %esp,%ebp
+  803910:	57                   	push   %edi
+  803911:	56                   	push   %esi
+  803912:	53                   	push   %ebx
+  803913:	83 ec 1c             	sub    $0x1c,%esp
+  803916:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803919:	8b 75 08             	mov    0x8(%ebp),%esi
+  80391c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803922:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803926:	75 2b                	jne    803953 <ipc_try_send_pages+0x46>
+  803928:	89 e2                	mov    %esp,%edx
+  80392a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80392f:	29 d0                	sub    %edx,%eax
+  803931:	89 c2                	mov    %eax,%edx
+  803933:	c1 ea 0f             	shr    $0xf,%edx
+  803936:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80393b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803940:	0f 42 c2             	cmovb  %edx,%eax
+  803943:	8b 04 85 40 83 80 00 	mov    0x808340(,%eax,4),%eax
+  80394a:	8b 70 48             	mov    0x48(%eax),%esi
+  80394d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803953:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803959:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80395e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803961:	85 ff                	test   %edi,%edi
+  803963:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803968:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80396b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803971:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803977:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80397d:	83 ec 0c             	sub    $0xc,%esp
+  803980:	ff 75 14             	push   0x14(%ebp)
+  803983:	ff 75 18             	push   0x18(%ebp)
+  803986:	57                   	push   %edi
+  803987:	ff 75 0c             	push   0xc(%ebp)
+  80398a:	ff 75 08             	push   0x8(%ebp)
+  80398d:	e8 43 d6 ff ff       	call   800fd5 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803992:	83 c4 20             	add    $0x20,%esp
+  803995:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803998:	75 21                	jne    8039bb <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80399a:	83 ec 04             	sub    $0x4,%esp
+  80399d:	6a ff                	push   $0xffffffff
+  80399f:	53                   	push   %ebx
+  8039a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8039a3:	e8 3a d8 ff ff       	call   8011e2 <sys_futex_wait>
+  8039a8:	83 c4 10             	add    $0x10,%esp
+  8039ab:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8039ae:	74 c7                	je     803977 <ipc_try_send_pages+0x6a>
+  8039b0:	85 c0                	test   %eax,%eax
+  8039b2:	79 c3                	jns    803977 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8039b4:	e8 0c d4 ff ff       	call   800dc5 <sys_yield>
+  8039b9:	eb bc                	jmp    803977 <ipc_try_send_pages+0x6a>
+	}
+}
+  8039bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039be:	5b                   	pop    %ebx
+  8039bf:	5e                   	pop    %esi
+  8039c0:	5f                   	pop    %edi
+  8039c1:	5d                   	pop    %ebp
+  8039c2:	c3                   	ret
+
+008039c3 <ipc_send>:
+{
+  8039c3:	55                   	push   %ebp
+  8039c4:	89 e5                	mov    %esp,%ebp
+  8039c6:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8039c9:	ff 75 14             	push   0x14(%ebp)
+  8039cc:	6a 01                	push   $0x1
+  8039ce:	ff 75 10             	push   0x10(%ebp)
+  8039d1:	ff 75 0c             	push   0xc(%ebp)
+  8039d4:	ff 75 08             	push   0x8(%ebp)
+  8039d7:	e8 31 ff ff ff       	call   80390d <ipc_try_send_pages>
+  8039dc:	83 c4 20             	add    $0x20,%esp
+  8039df:	85 c0                	test   %eax,%eax
+  8039e1:	78 02                	js     8039e5 <ipc_send+0x22>
+}
+  8039e3:	c9                   	leave
+  8039e4:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8039e5:	50                   	push   %eax
+  8039e6:	68 8a 41 80 00       	push   $0x80418a
+  8039eb:	6a 3f                	push   $0x3f
+  8039ed:	68 9f 41 80 00       	push   $0x80419f
+  8039f2:	e8 e7 c7 ff ff       	call   8001de <_panic>
+
+008039f7 <ipc_send_pages>:
+{
+  8039f7:	55                   	push   %ebp
+  8039f8:	89 e5                	mov    %esp,%ebp
+  8039fa:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8039fd:	ff 75 18             	push   0x18(%ebp)
+  803a00:	ff 75 14             	push   0x14(%ebp)
+  803a03:	ff 75 10             	push   0x10(%ebp)
+  803a06:	ff 75 0c             	push   0xc(%ebp)
+  803a09:	ff 75 08             	push   0x8(%ebp)
+  803a0c:	e8 fc fe ff ff       	call   80390d <ipc_try_send_pages>
+  803a11:	83 c4 20             	add    $0x20,%esp
+  803a14:	85 c0                	test   %eax,%eax
+  803a16:	78 02                	js     803a1a <ipc_send_pages+0x23>
+}
+  803a18:	c9                   	leave
+  803a19:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803a1a:	50                   	push   %eax
+  803a1b:	68 a9 41 80 00       	push   $0x8041a9
+  803a20:	6a 64                	push   $0x64
+  803a22:	68 9f 41 80 00       	push   $0x80419f
+  803a27:	e8 b2 c7 ff ff       	call   8001de <_panic>
+
+00803a2c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803a2c:	55                   	push   %ebp
+  803a2d:	89 e5                	mov    %esp,%ebp
+  803a2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803a32:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803a37:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803a3d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a43:	8b 52 50             	mov    0x50(%edx),%edx
+  803a46:	39 ca                	cmp    %ecx,%edx
+  803a48:	74 11                	je     803a5b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803a4a:	83 c0 01             	add    $0x1,%eax
+  803a4d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803a52:	75 e3                	jne    803a37 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a59:	eb 0e                	jmp    803a69 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803a5b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803a61:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a66:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803a69:	5d                   	pop    %ebp
+  803a6a:	c3                   	ret
+
+00803a6b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a6b:	55                   	push   %ebp
+  803a6c:	89 e5                	mov    %esp,%ebp
+  803a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a71:	89 c2                	mov    %eax,%edx
+  803a73:	c1 ea 16             	shr    $0x16,%edx
+  803a76:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a7d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a82:	f6 c1 01             	test   $0x1,%cl
+  803a85:	74 1e                	je     803aa5 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803a87:	c1 e8 0c             	shr    $0xc,%eax
+  803a8a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a91:	a8 01                	test   $0x1,%al
+  803a93:	74 10                	je     803aa5 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a95:	c1 e8 0c             	shr    $0xc,%eax
+  803a98:	c1 e0 04             	shl    $0x4,%eax
+  803a9b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803aa2:	0f b7 d2             	movzwl %dx,%edx
+}
+  803aa5:	89 d0                	mov    %edx,%eax
+  803aa7:	5d                   	pop    %ebp
+  803aa8:	c3                   	ret
+
+00803aa9 <__udivdi3>:
+  803aa9:	57                   	push   %edi
+  803aaa:	56                   	push   %esi
+  803aab:	53                   	push   %ebx
+  803aac:	83 ec 20             	sub    $0x20,%esp
+  803aaf:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803ab3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803ab7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803abb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803abf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803ac3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803ac7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803acb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803acf:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ade:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803ae5:	00 
+  803ae6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803aed:	00 
+  803aee:	eb 08                	jmp    803af8 <__udivdi3+0x4f>
+  803af0:	83 e9 01             	sub    $0x1,%ecx
+  803af3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803af6:	74 68                	je     803b60 <__udivdi3+0xb7>
+  803af8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803afc:	01 c0                	add    %eax,%eax
+  803afe:	89 c6                	mov    %eax,%esi
+  803b00:	89 d7                	mov    %edx,%edi
+  803b02:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b06:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b0a:	0f ad d0             	shrd   %cl,%edx,%eax
+  803b0d:	d3 ea                	shr    %cl,%edx
+  803b0f:	f6 c1 20             	test   $0x20,%cl
+  803b12:	74 04                	je     803b18 <__udivdi3+0x6f>
+  803b14:	89 d0                	mov    %edx,%eax
+  803b16:	31 d2                	xor    %edx,%edx
+  803b18:	83 e0 01             	and    $0x1,%eax
+  803b1b:	89 04 24             	mov    %eax,(%esp)
+  803b1e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803b25:	00 
+  803b26:	8b 04 24             	mov    (%esp),%eax
+  803b29:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803b2d:	09 f0                	or     %esi,%eax
+  803b2f:	09 fa                	or     %edi,%edx
+  803b31:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803b35:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803b39:	39 f0                	cmp    %esi,%eax
+  803b3b:	89 d3                	mov    %edx,%ebx
+  803b3d:	19 fb                	sbb    %edi,%ebx
+  803b3f:	72 af                	jb     803af0 <__udivdi3+0x47>
+  803b41:	29 f0                	sub    %esi,%eax
+  803b43:	19 fa                	sbb    %edi,%edx
+  803b45:	89 cf                	mov    %ecx,%edi
+  803b47:	c1 ef 05             	shr    $0x5,%edi
+  803b4a:	83 e7 01             	and    $0x1,%edi
+  803b4d:	89 fe                	mov    %edi,%esi
+  803b4f:	83 f6 01             	xor    $0x1,%esi
+  803b52:	d3 e6                	shl    %cl,%esi
+  803b54:	d3 e7                	shl    %cl,%edi
+  803b56:	09 74 24 18          	or     %esi,0x18(%esp)
+  803b5a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803b5e:	eb 90                	jmp    803af0 <__udivdi3+0x47>
+  803b60:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b64:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b68:	83 c4 20             	add    $0x20,%esp
+  803b6b:	5b                   	pop    %ebx
+  803b6c:	5e                   	pop    %esi
+  803b6d:	5f                   	pop    %edi
+  803b6e:	c3                   	ret
+
+00803b6f <__umoddi3>:
+  803b6f:	57                   	push   %edi
+  803b70:	56                   	push   %esi
+  803b71:	53                   	push   %ebx
+  803b72:	83 ec 08             	sub    $0x8,%esp
+  803b75:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b79:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b7d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803b81:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803b85:	57                   	push   %edi
+  803b86:	56                   	push   %esi
+  803b87:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b8b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b8f:	52                   	push   %edx
+  803b90:	50                   	push   %eax
+  803b91:	e8 13 ff ff ff       	call   803aa9 <__udivdi3>
+  803b96:	89 c3                	mov    %eax,%ebx
+  803b98:	0f af d6             	imul   %esi,%edx
+  803b9b:	89 f9                	mov    %edi,%ecx
+  803b9d:	0f af cb             	imul   %ebx,%ecx
+  803ba0:	01 d1                	add    %edx,%ecx
+  803ba2:	89 d8                	mov    %ebx,%eax
+  803ba4:	f7 e6                	mul    %esi
+  803ba6:	89 c6                	mov    %eax,%esi
+  803ba8:	89 d7                	mov    %edx,%edi
+  803baa:	01 cf                	add    %ecx,%edi
+  803bac:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803bb0:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803bb4:	29 f0                	sub    %esi,%eax
+  803bb6:	19 fa                	sbb    %edi,%edx
+  803bb8:	83 c4 18             	add    $0x18,%esp
+  803bbb:	5b                   	pop    %ebx
+  803bbc:	5e                   	pop    %esi
+  803bbd:	5f                   	pop    %edi
+  803bbe:	c3                   	ret
+
+00803bbf <__divdi3>:
+  803bbf:	53                   	push   %ebx
+  803bc0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803bc4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803bc8:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803bcc:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803bd0:	85 d2                	test   %edx,%edx
+  803bd2:	78 12                	js     803be6 <__divdi3+0x27>
+  803bd4:	85 db                	test   %ebx,%ebx
+  803bd6:	78 2e                	js     803c06 <__divdi3+0x47>
+  803bd8:	53                   	push   %ebx
+  803bd9:	51                   	push   %ecx
+  803bda:	52                   	push   %edx
+  803bdb:	50                   	push   %eax
+  803bdc:	e8 c8 fe ff ff       	call   803aa9 <__udivdi3>
+  803be1:	83 c4 10             	add    $0x10,%esp
+  803be4:	eb 1e                	jmp    803c04 <__divdi3+0x45>
+  803be6:	f7 d8                	neg    %eax
+  803be8:	83 d2 00             	adc    $0x0,%edx
+  803beb:	f7 da                	neg    %edx
+  803bed:	85 db                	test   %ebx,%ebx
+  803bef:	78 2a                	js     803c1b <__divdi3+0x5c>
+  803bf1:	53                   	push   %ebx
+  803bf2:	51                   	push   %ecx
+  803bf3:	52                   	push   %edx
+  803bf4:	50                   	push   %eax
+  803bf5:	e8 af fe ff ff       	call   803aa9 <__udivdi3>
+  803bfa:	83 c4 10             	add    $0x10,%esp
+  803bfd:	f7 d8                	neg    %eax
+  803bff:	83 d2 00             	adc    $0x0,%edx
+  803c02:	f7 da                	neg    %edx
+  803c04:	5b                   	pop    %ebx
+  803c05:	c3                   	ret
+  803c06:	f7 d9                	neg    %ecx
+  803c08:	83 d3 00             	adc    $0x0,%ebx
+  803c0b:	f7 db                	neg    %ebx
+  803c0d:	53                   	push   %ebx
+  803c0e:	51                   	push   %ecx
+  803c0f:	52                   	push   %edx
+  803c10:	50                   	push   %eax
+  803c11:	e8 93 fe ff ff       	call   803aa9 <__udivdi3>
+  803c16:	83 c4 10             	add    $0x10,%esp
+  803c19:	eb e2                	jmp    803bfd <__divdi3+0x3e>
+  803c1b:	f7 d9                	neg    %ecx
+  803c1d:	83 d3 00             	adc    $0x0,%ebx
+  803c20:	f7 db                	neg    %ebx
+  803c22:	53                   	push   %ebx
+  803c23:	51                   	push   %ecx
+  803c24:	52                   	push   %edx
+  803c25:	50                   	push   %eax
+  803c26:	e8 7e fe ff ff       	call   803aa9 <__udivdi3>
+  803c2b:	83 c4 10             	add    $0x10,%esp
+  803c2e:	eb d4                	jmp    803c04 <__divdi3+0x45>
+
+00803c30 <__moddi3>:
+  803c30:	57                   	push   %edi
+  803c31:	56                   	push   %esi
+  803c32:	53                   	push   %ebx
+  803c33:	83 ec 08             	sub    $0x8,%esp
+  803c36:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c3a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c3e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803c42:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803c46:	57                   	push   %edi
+  803c47:	56                   	push   %esi
+  803c48:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c4c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c50:	52                   	push   %edx
+  803c51:	50                   	push   %eax
+  803c52:	e8 68 ff ff ff       	call   803bbf <__divdi3>
+  803c57:	89 c3                	mov    %eax,%ebx
+  803c59:	0f af d6             	imul   %esi,%edx
+  803c5c:	89 f9                	mov    %edi,%ecx
+  803c5e:	0f af cb             	imul   %ebx,%ecx
+  803c61:	01 d1                	add    %edx,%ecx
+  803c63:	89 d8                	mov    %ebx,%eax
+  803c65:	f7 e6                	mul    %esi
+  803c67:	89 c6                	mov    %eax,%esi
+  803c69:	89 d7                	mov    %edx,%edi
+  803c6b:	01 cf                	add    %ecx,%edi
+  803c6d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803c71:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803c75:	29 f0                	sub    %esi,%eax
+  803c77:	19 fa                	sbb    %edi,%edx
+  803c79:	83 c4 18             	add    $0x18,%esp
+  803c7c:	5b                   	pop    %ebx
+  803c7d:	5e                   	pop    %esi
+  803c7e:	5f                   	pop    %edi
+  803c7f:	c3                   	ret
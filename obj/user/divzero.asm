@@ -0,0 +1,7864 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 25 00 00 00       	call   800056 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  80003b:	c7 05 38 53 80 00 00 	movl   $0x0,0x805338
+  800042:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800045:	6a 00                	push   $0x0
+  800047:	68 a0 3a 80 00       	push   $0x803aa0
+  80004c:	e8 41 01 00 00       	call   800192 <cprintf>
+}
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	c9                   	leave
+  800055:	c3                   	ret
+
+00800056 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800056:	55                   	push   %ebp
+  800057:	89 e5                	mov    %esp,%ebp
+  800059:	56                   	push   %esi
+  80005a:	53                   	push   %ebx
+  80005b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800061:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800063:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800068:	29 d0                	sub    %edx,%eax
+  80006a:	89 c2                	mov    %eax,%edx
+  80006c:	c1 ea 0f             	shr    $0xf,%edx
+  80006f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800074:	b8 00 00 00 00       	mov    $0x0,%eax
+  800079:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80007c:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800083:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800087:	e8 f3 0b 00 00       	call   800c7f <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80008c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800091:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800097:	89 e1                	mov    %esp,%ecx
+  800099:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80009e:	29 ca                	sub    %ecx,%edx
+  8000a0:	89 d1                	mov    %edx,%ecx
+  8000a2:	c1 e9 0f             	shr    $0xf,%ecx
+  8000a5:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	0f 42 d1             	cmovb  %ecx,%edx
+  8000b3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b8:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x74>
+		binaryname = argv[0];
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 61 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e9:	e8 1b 12 00 00       	call   801309 <close_all>
+	sys_env_destroy(0);
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	e8 46 0b 00 00       	call   800c3e <sys_env_destroy>
+}
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	c9                   	leave
+  8000fc:	c3                   	ret
+
+008000fd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	53                   	push   %ebx
+  800101:	83 ec 04             	sub    $0x4,%esp
+  800104:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800107:	8b 13                	mov    (%ebx),%edx
+  800109:	8d 42 01             	lea    0x1(%edx),%eax
+  80010c:	89 03                	mov    %eax,(%ebx)
+  80010e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800111:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800115:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80011a:	74 09                	je     800125 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80011c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800125:	83 ec 08             	sub    $0x8,%esp
+  800128:	68 ff 00 00 00       	push   $0xff
+  80012d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800130:	50                   	push   %eax
+  800131:	e8 cb 0a 00 00       	call   800c01 <sys_cputs>
+		b->idx = 0;
+  800136:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80013c:	83 c4 10             	add    $0x10,%esp
+  80013f:	eb db                	jmp    80011c <putch+0x1f>
+
+00800141 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800141:	55                   	push   %ebp
+  800142:	89 e5                	mov    %esp,%ebp
+  800144:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80014a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800151:	00 00 00 
+	b.cnt = 0;
+  800154:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80015b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80015e:	ff 75 0c             	push   0xc(%ebp)
+  800161:	ff 75 08             	push   0x8(%ebp)
+  800164:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	68 fd 00 80 00       	push   $0x8000fd
+  800170:	e8 1c 01 00 00       	call   800291 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800175:	83 c4 08             	add    $0x8,%esp
+  800178:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800184:	50                   	push   %eax
+  800185:	e8 77 0a 00 00       	call   800c01 <sys_cputs>
+
+	return b.cnt;
+}
+  80018a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+
+00800192 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800192:	55                   	push   %ebp
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800198:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80019b:	50                   	push   %eax
+  80019c:	ff 75 08             	push   0x8(%ebp)
+  80019f:	e8 9d ff ff ff       	call   800141 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	57                   	push   %edi
+  8001aa:	56                   	push   %esi
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 1c             	sub    $0x1c,%esp
+  8001af:	89 c3                	mov    %eax,%ebx
+  8001b1:	89 d6                	mov    %edx,%esi
+  8001b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b9:	89 d1                	mov    %edx,%ecx
+  8001bb:	89 c2                	mov    %eax,%edx
+  8001bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c3:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d0:	39 c2                	cmp    %eax,%edx
+  8001d2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d5:	73 4b                	jae    800222 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8001d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8001da:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8001dd:	85 ff                	test   %edi,%edi
+  8001df:	7e 11                	jle    8001f2 <printnum+0x4c>
+			putch(padc, putdat);
+  8001e1:	83 ec 08             	sub    $0x8,%esp
+  8001e4:	56                   	push   %esi
+  8001e5:	ff 75 18             	push   0x18(%ebp)
+  8001e8:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8001ea:	83 c4 10             	add    $0x10,%esp
+  8001ed:	83 ef 01             	sub    $0x1,%edi
+  8001f0:	75 ef                	jne    8001e1 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001f2:	83 ec 08             	sub    $0x8,%esp
+  8001f5:	56                   	push   %esi
+  8001f6:	83 ec 04             	sub    $0x4,%esp
+  8001f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8001fc:	ff 75 e0             	push   -0x20(%ebp)
+  8001ff:	ff 75 dc             	push   -0x24(%ebp)
+  800202:	ff 75 d8             	push   -0x28(%ebp)
+  800205:	e8 70 37 00 00       	call   80397a <__umoddi3>
+  80020a:	83 c4 14             	add    $0x14,%esp
+  80020d:	0f be 80 b8 3a 80 00 	movsbl 0x803ab8(%eax),%eax
+  800214:	50                   	push   %eax
+  800215:	ff d3                	call   *%ebx
+}
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021d:	5b                   	pop    %ebx
+  80021e:	5e                   	pop    %esi
+  80021f:	5f                   	pop    %edi
+  800220:	5d                   	pop    %ebp
+  800221:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800222:	83 ec 0c             	sub    $0xc,%esp
+  800225:	ff 75 18             	push   0x18(%ebp)
+  800228:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80022b:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80022e:	52                   	push   %edx
+  80022f:	50                   	push   %eax
+  800230:	83 ec 08             	sub    $0x8,%esp
+  800233:	ff 75 e4             	push   -0x1c(%ebp)
+  800236:	ff 75 e0             	push   -0x20(%ebp)
+  800239:	ff 75 dc             	push   -0x24(%ebp)
+  80023c:	ff 75 d8             	push   -0x28(%ebp)
+  80023f:	e8 70 36 00 00       	call   8038b4 <__udivdi3>
+  800244:	83 c4 18             	add    $0x18,%esp
+  800247:	52                   	push   %edx
+  800248:	50                   	push   %eax
+  800249:	89 f2                	mov    %esi,%edx
+  80024b:	89 d8                	mov    %ebx,%eax
+  80024d:	e8 54 ff ff ff       	call   8001a6 <printnum>
+  800252:	83 c4 20             	add    $0x20,%esp
+  800255:	eb 9b                	jmp    8001f2 <printnum+0x4c>
+
+00800257 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800257:	55                   	push   %ebp
+  800258:	89 e5                	mov    %esp,%ebp
+  80025a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80025d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800261:	8b 10                	mov    (%eax),%edx
+  800263:	3b 50 04             	cmp    0x4(%eax),%edx
+  800266:	73 0a                	jae    800272 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800268:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80026b:	89 08                	mov    %ecx,(%eax)
+  80026d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800270:	88 02                	mov    %al,(%edx)
+}
+  800272:	5d                   	pop    %ebp
+  800273:	c3                   	ret
+
+00800274 <printfmt>:
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80027a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80027d:	50                   	push   %eax
+  80027e:	ff 75 10             	push   0x10(%ebp)
+  800281:	ff 75 0c             	push   0xc(%ebp)
+  800284:	ff 75 08             	push   0x8(%ebp)
+  800287:	e8 05 00 00 00       	call   800291 <vprintfmt>
+}
+  80028c:	83 c4 10             	add    $0x10,%esp
+  80028f:	c9                   	leave
+  800290:	c3                   	ret
+
+00800291 <vprintfmt>:
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	57                   	push   %edi
+  800295:	56                   	push   %esi
+  800296:	53                   	push   %ebx
+  800297:	83 ec 2c             	sub    $0x2c,%esp
+  80029a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80029d:	89 df                	mov    %ebx,%edi
+  80029f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002a2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a5:	8d 70 01             	lea    0x1(%eax),%esi
+  8002a8:	0f b6 00             	movzbl (%eax),%eax
+  8002ab:	83 f8 25             	cmp    $0x25,%eax
+  8002ae:	74 1e                	je     8002ce <vprintfmt+0x3d>
+			if (ch == '\0')
+  8002b0:	85 c0                	test   %eax,%eax
+  8002b2:	0f 84 15 05 00 00    	je     8007cd <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+  8002bb:	53                   	push   %ebx
+  8002bc:	50                   	push   %eax
+  8002bd:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002bf:	83 c6 01             	add    $0x1,%esi
+  8002c2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002c6:	83 c4 10             	add    $0x10,%esp
+  8002c9:	83 f8 25             	cmp    $0x25,%eax
+  8002cc:	75 e2                	jne    8002b0 <vprintfmt+0x1f>
+		padc = ' ';
+  8002ce:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8002d2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002d9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8002e0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8002e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002ec:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002ef:	8d 56 01             	lea    0x1(%esi),%edx
+  8002f2:	0f b6 0e             	movzbl (%esi),%ecx
+  8002f5:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8002f8:	3c 55                	cmp    $0x55,%al
+  8002fa:	0f 87 3b 04 00 00    	ja     80073b <vprintfmt+0x4aa>
+  800300:	0f b6 c0             	movzbl %al,%eax
+  800303:	ff 24 85 20 3c 80 00 	jmp    *0x803c20(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80030a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80030d:	eb 93                	jmp    8002a2 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80030f:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800311:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800315:	eb d8                	jmp    8002ef <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800317:	89 d6                	mov    %edx,%esi
+  800319:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80031d:	eb d0                	jmp    8002ef <vprintfmt+0x5e>
+  80031f:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800322:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800325:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800328:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80032c:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80032f:	83 f9 09             	cmp    $0x9,%ecx
+  800332:	77 6f                	ja     8003a3 <vprintfmt+0x112>
+  800334:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800337:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80033a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80033d:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800341:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800344:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800347:	83 fe 09             	cmp    $0x9,%esi
+  80034a:	76 eb                	jbe    800337 <vprintfmt+0xa6>
+  80034c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80034f:	89 d6                	mov    %edx,%esi
+  800351:	eb 13                	jmp    800366 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800353:	8b 45 14             	mov    0x14(%ebp),%eax
+  800356:	8b 00                	mov    (%eax),%eax
+  800358:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80035b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035e:	8d 40 04             	lea    0x4(%eax),%eax
+  800361:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800364:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800366:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80036a:	79 83                	jns    8002ef <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80036c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80036f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800372:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800379:	e9 71 ff ff ff       	jmp    8002ef <vprintfmt+0x5e>
+			if (width < 0)
+  80037e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800381:	85 c9                	test   %ecx,%ecx
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+  800388:	0f 49 c1             	cmovns %ecx,%eax
+  80038b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038e:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800390:	e9 5a ff ff ff       	jmp    8002ef <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800395:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800397:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80039e:	e9 4c ff ff ff       	jmp    8002ef <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a3:	89 d6                	mov    %edx,%esi
+  8003a5:	eb bf                	jmp    800366 <vprintfmt+0xd5>
+			lflag++;
+  8003a7:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ab:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003ad:	e9 3d ff ff ff       	jmp    8002ef <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8003b2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b8:	8d 70 04             	lea    0x4(%eax),%esi
+  8003bb:	83 ec 08             	sub    $0x8,%esp
+  8003be:	53                   	push   %ebx
+  8003bf:	ff 30                	push   (%eax)
+  8003c1:	ff d7                	call   *%edi
+			break;
+  8003c3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c6:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8003c9:	e9 d4 fe ff ff       	jmp    8002a2 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8003ce:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d4:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8003d7:	8b 10                	mov    (%eax),%edx
+  8003d9:	89 d0                	mov    %edx,%eax
+  8003db:	f7 d8                	neg    %eax
+  8003dd:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e0:	83 f8 12             	cmp    $0x12,%eax
+  8003e3:	7f 23                	jg     800408 <vprintfmt+0x177>
+  8003e5:	8b 14 85 80 3d 80 00 	mov    0x803d80(,%eax,4),%edx
+  8003ec:	85 d2                	test   %edx,%edx
+  8003ee:	74 18                	je     800408 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8003f0:	52                   	push   %edx
+  8003f1:	68 db 3e 80 00       	push   $0x803edb
+  8003f6:	53                   	push   %ebx
+  8003f7:	57                   	push   %edi
+  8003f8:	e8 77 fe ff ff       	call   800274 <printfmt>
+  8003fd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800400:	89 75 14             	mov    %esi,0x14(%ebp)
+  800403:	e9 9a fe ff ff       	jmp    8002a2 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800408:	50                   	push   %eax
+  800409:	68 d0 3a 80 00       	push   $0x803ad0
+  80040e:	53                   	push   %ebx
+  80040f:	57                   	push   %edi
+  800410:	e8 5f fe ff ff       	call   800274 <printfmt>
+  800415:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800418:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041b:	e9 82 fe ff ff       	jmp    8002a2 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800420:	89 55 10             	mov    %edx,0x10(%ebp)
+  800423:	8b 45 14             	mov    0x14(%ebp),%eax
+  800426:	83 c0 04             	add    $0x4,%eax
+  800429:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8b 00                	mov    (%eax),%eax
+  800431:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800434:	85 c0                	test   %eax,%eax
+  800436:	0f 84 61 03 00 00    	je     80079d <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80043c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800440:	7e 06                	jle    800448 <vprintfmt+0x1b7>
+  800442:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800446:	75 29                	jne    800471 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800448:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80044b:	8d 70 01             	lea    0x1(%eax),%esi
+  80044e:	0f b6 00             	movzbl (%eax),%eax
+  800451:	0f be d0             	movsbl %al,%edx
+  800454:	85 d2                	test   %edx,%edx
+  800456:	0f 84 bb 00 00 00    	je     800517 <vprintfmt+0x286>
+  80045c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80045f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800462:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800465:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800468:	eb 7a                	jmp    8004e4 <vprintfmt+0x253>
+				p = "(null)";
+  80046a:	c7 45 d0 c9 3a 80 00 	movl   $0x803ac9,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800471:	83 ec 08             	sub    $0x8,%esp
+  800474:	ff 75 d4             	push   -0x2c(%ebp)
+  800477:	ff 75 d0             	push   -0x30(%ebp)
+  80047a:	e8 e0 03 00 00       	call   80085f <strnlen>
+  80047f:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800482:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800485:	83 c4 10             	add    $0x10,%esp
+  800488:	85 d2                	test   %edx,%edx
+  80048a:	0f 8e d6 02 00 00    	jle    800766 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800490:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800494:	83 ec 08             	sub    $0x8,%esp
+  800497:	53                   	push   %ebx
+  800498:	56                   	push   %esi
+  800499:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049b:	83 c4 10             	add    $0x10,%esp
+  80049e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004a2:	75 f0                	jne    800494 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004a7:	8d 70 01             	lea    0x1(%eax),%esi
+  8004aa:	0f b6 00             	movzbl (%eax),%eax
+  8004ad:	0f be d0             	movsbl %al,%edx
+  8004b0:	85 d2                	test   %edx,%edx
+  8004b2:	0f 84 da 02 00 00    	je     800792 <vprintfmt+0x501>
+  8004b8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004bb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004be:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004c1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004c4:	eb 1e                	jmp    8004e4 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8004c6:	83 ec 08             	sub    $0x8,%esp
+  8004c9:	ff 75 0c             	push   0xc(%ebp)
+  8004cc:	52                   	push   %edx
+  8004cd:	ff 55 08             	call   *0x8(%ebp)
+  8004d0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004d3:	83 eb 01             	sub    $0x1,%ebx
+  8004d6:	83 c6 01             	add    $0x1,%esi
+  8004d9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004dd:	0f be d0             	movsbl %al,%edx
+  8004e0:	85 d2                	test   %edx,%edx
+  8004e2:	74 2a                	je     80050e <vprintfmt+0x27d>
+  8004e4:	85 ff                	test   %edi,%edi
+  8004e6:	78 05                	js     8004ed <vprintfmt+0x25c>
+  8004e8:	83 ef 01             	sub    $0x1,%edi
+  8004eb:	78 59                	js     800546 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004ed:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004f1:	74 d3                	je     8004c6 <vprintfmt+0x235>
+  8004f3:	0f be c0             	movsbl %al,%eax
+  8004f6:	83 e8 20             	sub    $0x20,%eax
+  8004f9:	83 f8 5e             	cmp    $0x5e,%eax
+  8004fc:	76 c8                	jbe    8004c6 <vprintfmt+0x235>
+					putch('?', putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	ff 75 0c             	push   0xc(%ebp)
+  800504:	6a 3f                	push   $0x3f
+  800506:	ff 55 08             	call   *0x8(%ebp)
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	eb c5                	jmp    8004d3 <vprintfmt+0x242>
+  80050e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800511:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800514:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800517:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80051a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80051e:	7e 1b                	jle    80053b <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	6a 20                	push   $0x20
+  800526:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800528:	83 c4 10             	add    $0x10,%esp
+  80052b:	83 ee 01             	sub    $0x1,%esi
+  80052e:	75 f0                	jne    800520 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800530:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800533:	89 45 14             	mov    %eax,0x14(%ebp)
+  800536:	e9 67 fd ff ff       	jmp    8002a2 <vprintfmt+0x11>
+  80053b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800541:	e9 5c fd ff ff       	jmp    8002a2 <vprintfmt+0x11>
+  800546:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800549:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80054c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80054f:	eb c6                	jmp    800517 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800551:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800554:	89 55 10             	mov    %edx,0x10(%ebp)
+  800557:	83 f9 01             	cmp    $0x1,%ecx
+  80055a:	7f 1f                	jg     80057b <vprintfmt+0x2ea>
+	else if (lflag)
+  80055c:	85 c9                	test   %ecx,%ecx
+  80055e:	74 67                	je     8005c7 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800560:	8b 45 14             	mov    0x14(%ebp),%eax
+  800563:	8b 30                	mov    (%eax),%esi
+  800565:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800568:	89 f0                	mov    %esi,%eax
+  80056a:	c1 f8 1f             	sar    $0x1f,%eax
+  80056d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	8d 40 04             	lea    0x4(%eax),%eax
+  800576:	89 45 14             	mov    %eax,0x14(%ebp)
+  800579:	eb 17                	jmp    800592 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	8b 50 04             	mov    0x4(%eax),%edx
+  800581:	8b 00                	mov    (%eax),%eax
+  800583:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800586:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058c:	8d 40 08             	lea    0x8(%eax),%eax
+  80058f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800592:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800595:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800598:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80059d:	85 c9                	test   %ecx,%ecx
+  80059f:	0f 89 12 01 00 00    	jns    8006b7 <vprintfmt+0x426>
+				putch('-', putdat);
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	53                   	push   %ebx
+  8005a9:	6a 2d                	push   $0x2d
+  8005ab:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8005ad:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b3:	f7 da                	neg    %edx
+  8005b5:	83 d1 00             	adc    $0x0,%ecx
+  8005b8:	f7 d9                	neg    %ecx
+  8005ba:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005bd:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005c2:	e9 f0 00 00 00       	jmp    8006b7 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8b 30                	mov    (%eax),%esi
+  8005cc:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005cf:	89 f0                	mov    %esi,%eax
+  8005d1:	c1 f8 1f             	sar    $0x1f,%eax
+  8005d4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8d 40 04             	lea    0x4(%eax),%eax
+  8005dd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e0:	eb b0                	jmp    800592 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8005e2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e8:	83 f9 01             	cmp    $0x1,%ecx
+  8005eb:	7f 1e                	jg     80060b <vprintfmt+0x37a>
+	else if (lflag)
+  8005ed:	85 c9                	test   %ecx,%ecx
+  8005ef:	74 32                	je     800623 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800601:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800606:	e9 ac 00 00 00       	jmp    8006b7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8b 10                	mov    (%eax),%edx
+  800610:	8b 48 04             	mov    0x4(%eax),%ecx
+  800613:	8d 40 08             	lea    0x8(%eax),%eax
+  800616:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800619:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80061e:	e9 94 00 00 00       	jmp    8006b7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062d:	8d 40 04             	lea    0x4(%eax),%eax
+  800630:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800633:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800638:	eb 7d                	jmp    8006b7 <vprintfmt+0x426>
+	if (lflag >= 2)
+  80063a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80063d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800640:	83 f9 01             	cmp    $0x1,%ecx
+  800643:	7f 1b                	jg     800660 <vprintfmt+0x3cf>
+	else if (lflag)
+  800645:	85 c9                	test   %ecx,%ecx
+  800647:	74 2c                	je     800675 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8b 10                	mov    (%eax),%edx
+  80064e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800653:	8d 40 04             	lea    0x4(%eax),%eax
+  800656:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800659:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80065e:	eb 57                	jmp    8006b7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	8b 48 04             	mov    0x4(%eax),%ecx
+  800668:	8d 40 08             	lea    0x8(%eax),%eax
+  80066b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80066e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800673:	eb 42                	jmp    8006b7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800675:	8b 45 14             	mov    0x14(%ebp),%eax
+  800678:	8b 10                	mov    (%eax),%edx
+  80067a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067f:	8d 40 04             	lea    0x4(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800685:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80068a:	eb 2b                	jmp    8006b7 <vprintfmt+0x426>
+			putch('0', putdat);
+  80068c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80068f:	83 ec 08             	sub    $0x8,%esp
+  800692:	53                   	push   %ebx
+  800693:	6a 30                	push   $0x30
+  800695:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800697:	83 c4 08             	add    $0x8,%esp
+  80069a:	53                   	push   %ebx
+  80069b:	6a 78                	push   $0x78
+  80069d:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8b 10                	mov    (%eax),%edx
+  8006a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006a9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8006af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b2:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8006b7:	83 ec 0c             	sub    $0xc,%esp
+  8006ba:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8006c2:	56                   	push   %esi
+  8006c3:	51                   	push   %ecx
+  8006c4:	52                   	push   %edx
+  8006c5:	89 da                	mov    %ebx,%edx
+  8006c7:	89 f8                	mov    %edi,%eax
+  8006c9:	e8 d8 fa ff ff       	call   8001a6 <printnum>
+			break;
+  8006ce:	83 c4 20             	add    $0x20,%esp
+  8006d1:	e9 cc fb ff ff       	jmp    8002a2 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8006d6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006d9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006dc:	83 f9 01             	cmp    $0x1,%ecx
+  8006df:	7f 1b                	jg     8006fc <vprintfmt+0x46b>
+	else if (lflag)
+  8006e1:	85 c9                	test   %ecx,%ecx
+  8006e3:	74 2c                	je     800711 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8b 10                	mov    (%eax),%edx
+  8006ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f5:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8006fa:	eb bb                	jmp    8006b7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8b 10                	mov    (%eax),%edx
+  800701:	8b 48 04             	mov    0x4(%eax),%ecx
+  800704:	8d 40 08             	lea    0x8(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070a:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80070f:	eb a6                	jmp    8006b7 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 10                	mov    (%eax),%edx
+  800716:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800721:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800726:	eb 8f                	jmp    8006b7 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800728:	89 55 10             	mov    %edx,0x10(%ebp)
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	6a 25                	push   $0x25
+  800731:	ff d7                	call   *%edi
+			break;
+  800733:	83 c4 10             	add    $0x10,%esp
+  800736:	e9 67 fb ff ff       	jmp    8002a2 <vprintfmt+0x11>
+			putch('%', putdat);
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	53                   	push   %ebx
+  80073f:	6a 25                	push   $0x25
+  800741:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800743:	83 c4 10             	add    $0x10,%esp
+  800746:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80074a:	0f 84 ba fb ff ff    	je     80030a <vprintfmt+0x79>
+  800750:	89 75 10             	mov    %esi,0x10(%ebp)
+  800753:	89 f0                	mov    %esi,%eax
+  800755:	83 e8 01             	sub    $0x1,%eax
+  800758:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80075c:	75 f7                	jne    800755 <vprintfmt+0x4c4>
+  80075e:	89 45 10             	mov    %eax,0x10(%ebp)
+  800761:	e9 3c fb ff ff       	jmp    8002a2 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800766:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800769:	8d 70 01             	lea    0x1(%eax),%esi
+  80076c:	0f b6 00             	movzbl (%eax),%eax
+  80076f:	0f be d0             	movsbl %al,%edx
+  800772:	85 d2                	test   %edx,%edx
+  800774:	74 11                	je     800787 <vprintfmt+0x4f6>
+  800776:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800779:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80077c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80077f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800782:	e9 5d fd ff ff       	jmp    8004e4 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800787:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80078a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078d:	e9 10 fb ff ff       	jmp    8002a2 <vprintfmt+0x11>
+  800792:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+  800798:	e9 05 fb ff ff       	jmp    8002a2 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  80079d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007a1:	7e 0a                	jle    8007ad <vprintfmt+0x51c>
+  8007a3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007a7:	0f 85 bd fc ff ff    	jne    80046a <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007ad:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007b2:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007b7:	be ca 3a 80 00       	mov    $0x803aca,%esi
+  8007bc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007bf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007c2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007c5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c8:	e9 17 fd ff ff       	jmp    8004e4 <vprintfmt+0x253>
+}
+  8007cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d0:	5b                   	pop    %ebx
+  8007d1:	5e                   	pop    %esi
+  8007d2:	5f                   	pop    %edi
+  8007d3:	5d                   	pop    %ebp
+  8007d4:	c3                   	ret
+
+008007d5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007d5:	55                   	push   %ebp
+  8007d6:	89 e5                	mov    %esp,%ebp
+  8007d8:	83 ec 18             	sub    $0x18,%esp
+  8007db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007de:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007e4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007e8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007eb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007f2:	85 c0                	test   %eax,%eax
+  8007f4:	74 26                	je     80081c <vsnprintf+0x47>
+  8007f6:	85 d2                	test   %edx,%edx
+  8007f8:	7e 22                	jle    80081c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007fa:	ff 75 14             	push   0x14(%ebp)
+  8007fd:	ff 75 10             	push   0x10(%ebp)
+  800800:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800803:	50                   	push   %eax
+  800804:	68 57 02 80 00       	push   $0x800257
+  800809:	e8 83 fa ff ff       	call   800291 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80080e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800811:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800814:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800817:	83 c4 10             	add    $0x10,%esp
+}
+  80081a:	c9                   	leave
+  80081b:	c3                   	ret
+		return -E_INVAL;
+  80081c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800821:	eb f7                	jmp    80081a <vsnprintf+0x45>
+
+00800823 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800823:	55                   	push   %ebp
+  800824:	89 e5                	mov    %esp,%ebp
+  800826:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800829:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80082c:	50                   	push   %eax
+  80082d:	ff 75 10             	push   0x10(%ebp)
+  800830:	ff 75 0c             	push   0xc(%ebp)
+  800833:	ff 75 08             	push   0x8(%ebp)
+  800836:	e8 9a ff ff ff       	call   8007d5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80083b:	c9                   	leave
+  80083c:	c3                   	ret
+
+0080083d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800843:	80 3a 00             	cmpb   $0x0,(%edx)
+  800846:	74 10                	je     800858 <strlen+0x1b>
+  800848:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80084d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800850:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800854:	75 f7                	jne    80084d <strlen+0x10>
+	return n;
+}
+  800856:	5d                   	pop    %ebp
+  800857:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800858:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80085d:	eb f7                	jmp    800856 <strlen+0x19>
+
+0080085f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800865:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	74 16                	je     800882 <strnlen+0x23>
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800875:	74 09                	je     800880 <strnlen+0x21>
+		n++;
+  800877:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087a:	39 d0                	cmp    %edx,%eax
+  80087c:	75 f3                	jne    800871 <strnlen+0x12>
+		n++;
+  80087e:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800882:	b8 00 00 00 00       	mov    $0x0,%eax
+  800887:	eb f7                	jmp    800880 <strnlen+0x21>
+
+00800889 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800889:	55                   	push   %ebp
+  80088a:	89 e5                	mov    %esp,%ebp
+  80088c:	53                   	push   %ebx
+  80088d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800890:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800893:	b8 00 00 00 00       	mov    $0x0,%eax
+  800898:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80089c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80089f:	83 c0 01             	add    $0x1,%eax
+  8008a2:	84 d2                	test   %dl,%dl
+  8008a4:	75 f2                	jne    800898 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008a6:	89 c8                	mov    %ecx,%eax
+  8008a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ab:	c9                   	leave
+  8008ac:	c3                   	ret
+
+008008ad <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ad:	55                   	push   %ebp
+  8008ae:	89 e5                	mov    %esp,%ebp
+  8008b0:	53                   	push   %ebx
+  8008b1:	83 ec 10             	sub    $0x10,%esp
+  8008b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b7:	53                   	push   %ebx
+  8008b8:	e8 80 ff ff ff       	call   80083d <strlen>
+  8008bd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008c0:	ff 75 0c             	push   0xc(%ebp)
+  8008c3:	01 d8                	add    %ebx,%eax
+  8008c5:	50                   	push   %eax
+  8008c6:	e8 be ff ff ff       	call   800889 <strcpy>
+	return dst;
+}
+  8008cb:	89 d8                	mov    %ebx,%eax
+  8008cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d0:	c9                   	leave
+  8008d1:	c3                   	ret
+
+008008d2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008d2:	55                   	push   %ebp
+  8008d3:	89 e5                	mov    %esp,%ebp
+  8008d5:	56                   	push   %esi
+  8008d6:	53                   	push   %ebx
+  8008d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008e0:	85 db                	test   %ebx,%ebx
+  8008e2:	74 17                	je     8008fb <strncpy+0x29>
+  8008e4:	01 f3                	add    %esi,%ebx
+  8008e6:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8008e8:	83 c0 01             	add    $0x1,%eax
+  8008eb:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ee:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008f1:	80 f9 01             	cmp    $0x1,%cl
+  8008f4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f7:	39 c3                	cmp    %eax,%ebx
+  8008f9:	75 ed                	jne    8008e8 <strncpy+0x16>
+	}
+	return ret;
+}
+  8008fb:	89 f0                	mov    %esi,%eax
+  8008fd:	5b                   	pop    %ebx
+  8008fe:	5e                   	pop    %esi
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+
+00800901 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	56                   	push   %esi
+  800905:	53                   	push   %ebx
+  800906:	8b 75 08             	mov    0x8(%ebp),%esi
+  800909:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80090c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80090f:	89 f0                	mov    %esi,%eax
+  800911:	85 db                	test   %ebx,%ebx
+  800913:	74 1e                	je     800933 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800915:	83 eb 01             	sub    $0x1,%ebx
+  800918:	74 16                	je     800930 <strlcpy+0x2f>
+  80091a:	01 f3                	add    %esi,%ebx
+  80091c:	0f b6 0a             	movzbl (%edx),%ecx
+  80091f:	84 c9                	test   %cl,%cl
+  800921:	74 0d                	je     800930 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800923:	83 c2 01             	add    $0x1,%edx
+  800926:	83 c0 01             	add    $0x1,%eax
+  800929:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80092c:	39 d8                	cmp    %ebx,%eax
+  80092e:	75 ec                	jne    80091c <strlcpy+0x1b>
+		*dst = '\0';
+  800930:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800933:	29 f0                	sub    %esi,%eax
+}
+  800935:	5b                   	pop    %ebx
+  800936:	5e                   	pop    %esi
+  800937:	5d                   	pop    %ebp
+  800938:	c3                   	ret
+
+00800939 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800942:	0f b6 01             	movzbl (%ecx),%eax
+  800945:	84 c0                	test   %al,%al
+  800947:	74 11                	je     80095a <strcmp+0x21>
+  800949:	38 02                	cmp    %al,(%edx)
+  80094b:	75 0d                	jne    80095a <strcmp+0x21>
+		p++, q++;
+  80094d:	83 c1 01             	add    $0x1,%ecx
+  800950:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800953:	0f b6 01             	movzbl (%ecx),%eax
+  800956:	84 c0                	test   %al,%al
+  800958:	75 ef                	jne    800949 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80095a:	0f b6 c0             	movzbl %al,%eax
+  80095d:	0f b6 12             	movzbl (%edx),%edx
+  800960:	29 d0                	sub    %edx,%eax
+}
+  800962:	5d                   	pop    %ebp
+  800963:	c3                   	ret
+
+00800964 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	53                   	push   %ebx
+  800968:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80096b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80096e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800971:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800976:	85 d2                	test   %edx,%edx
+  800978:	74 2e                	je     8009a8 <strncmp+0x44>
+  80097a:	0f b6 01             	movzbl (%ecx),%eax
+  80097d:	84 c0                	test   %al,%al
+  80097f:	74 16                	je     800997 <strncmp+0x33>
+  800981:	3a 03                	cmp    (%ebx),%al
+  800983:	75 12                	jne    800997 <strncmp+0x33>
+		n--, p++, q++;
+  800985:	83 c1 01             	add    $0x1,%ecx
+  800988:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  80098b:	83 ea 01             	sub    $0x1,%edx
+  80098e:	75 ea                	jne    80097a <strncmp+0x16>
+		return 0;
+  800990:	b8 00 00 00 00       	mov    $0x0,%eax
+  800995:	eb 11                	jmp    8009a8 <strncmp+0x44>
+  800997:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80099c:	85 d2                	test   %edx,%edx
+  80099e:	74 08                	je     8009a8 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009a0:	0f b6 01             	movzbl (%ecx),%eax
+  8009a3:	0f b6 13             	movzbl (%ebx),%edx
+  8009a6:	29 d0                	sub    %edx,%eax
+}
+  8009a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ab:	c9                   	leave
+  8009ac:	c3                   	ret
+
+008009ad <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009b7:	0f b6 10             	movzbl (%eax),%edx
+  8009ba:	84 d2                	test   %dl,%dl
+  8009bc:	74 15                	je     8009d3 <strchr+0x26>
+		if (*s == c)
+  8009be:	38 d1                	cmp    %dl,%cl
+  8009c0:	74 0f                	je     8009d1 <strchr+0x24>
+	for (; *s; s++)
+  8009c2:	83 c0 01             	add    $0x1,%eax
+  8009c5:	0f b6 10             	movzbl (%eax),%edx
+  8009c8:	84 d2                	test   %dl,%dl
+  8009ca:	75 f2                	jne    8009be <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8009cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+	return 0;
+  8009d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d8:	eb f7                	jmp    8009d1 <strchr+0x24>
+
+008009da <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009da:	55                   	push   %ebp
+  8009db:	89 e5                	mov    %esp,%ebp
+  8009dd:	53                   	push   %ebx
+  8009de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  8009e4:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  8009e7:	38 d3                	cmp    %dl,%bl
+  8009e9:	74 14                	je     8009ff <strfind+0x25>
+  8009eb:	89 d1                	mov    %edx,%ecx
+  8009ed:	84 db                	test   %bl,%bl
+  8009ef:	74 0e                	je     8009ff <strfind+0x25>
+	for (; *s; s++)
+  8009f1:	83 c0 01             	add    $0x1,%eax
+  8009f4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009f7:	38 ca                	cmp    %cl,%dl
+  8009f9:	74 04                	je     8009ff <strfind+0x25>
+  8009fb:	84 d2                	test   %dl,%dl
+  8009fd:	75 f2                	jne    8009f1 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  8009ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+
+00800a04 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	57                   	push   %edi
+  800a08:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a0b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a0e:	85 c9                	test   %ecx,%ecx
+  800a10:	74 20                	je     800a32 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a12:	89 f8                	mov    %edi,%eax
+  800a14:	09 c8                	or     %ecx,%eax
+  800a16:	a8 03                	test   $0x3,%al
+  800a18:	75 12                	jne    800a2c <memset+0x28>
+		c &= 0xFF;
+  800a1a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a1e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a24:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a27:	fc                   	cld
+  800a28:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a2a:	eb 06                	jmp    800a32 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2f:	fc                   	cld
+  800a30:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a32:	89 f8                	mov    %edi,%eax
+  800a34:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a37:	c9                   	leave
+  800a38:	c3                   	ret
+
+00800a39 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	57                   	push   %edi
+  800a3d:	56                   	push   %esi
+  800a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a41:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a44:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a47:	39 c6                	cmp    %eax,%esi
+  800a49:	73 32                	jae    800a7d <memmove+0x44>
+  800a4b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a4e:	39 d0                	cmp    %edx,%eax
+  800a50:	73 2b                	jae    800a7d <memmove+0x44>
+		s += n;
+		d += n;
+  800a52:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a55:	89 d6                	mov    %edx,%esi
+  800a57:	09 fe                	or     %edi,%esi
+  800a59:	09 ce                	or     %ecx,%esi
+  800a5b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a61:	75 0e                	jne    800a71 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a63:	83 ef 04             	sub    $0x4,%edi
+  800a66:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a69:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a6c:	fd                   	std
+  800a6d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6f:	eb 09                	jmp    800a7a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a71:	83 ef 01             	sub    $0x1,%edi
+  800a74:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a77:	fd                   	std
+  800a78:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a7a:	fc                   	cld
+  800a7b:	eb 1a                	jmp    800a97 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a7d:	89 f2                	mov    %esi,%edx
+  800a7f:	09 c2                	or     %eax,%edx
+  800a81:	09 ca                	or     %ecx,%edx
+  800a83:	f6 c2 03             	test   $0x3,%dl
+  800a86:	75 0a                	jne    800a92 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a88:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a8b:	89 c7                	mov    %eax,%edi
+  800a8d:	fc                   	cld
+  800a8e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a90:	eb 05                	jmp    800a97 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a92:	89 c7                	mov    %eax,%edi
+  800a94:	fc                   	cld
+  800a95:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a97:	5e                   	pop    %esi
+  800a98:	5f                   	pop    %edi
+  800a99:	5d                   	pop    %ebp
+  800a9a:	c3                   	ret
+
+00800a9b <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aa1:	ff 75 10             	push   0x10(%ebp)
+  800aa4:	ff 75 0c             	push   0xc(%ebp)
+  800aa7:	ff 75 08             	push   0x8(%ebp)
+  800aaa:	e8 8a ff ff ff       	call   800a39 <memmove>
+}
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+00800ab1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	56                   	push   %esi
+  800ab5:	53                   	push   %ebx
+  800ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800abc:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800abf:	85 f6                	test   %esi,%esi
+  800ac1:	74 29                	je     800aec <memcmp+0x3b>
+  800ac3:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800ac5:	0f b6 08             	movzbl (%eax),%ecx
+  800ac8:	0f b6 1a             	movzbl (%edx),%ebx
+  800acb:	38 d9                	cmp    %bl,%cl
+  800acd:	75 11                	jne    800ae0 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800acf:	83 c0 01             	add    $0x1,%eax
+  800ad2:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ad5:	39 c6                	cmp    %eax,%esi
+  800ad7:	75 ec                	jne    800ac5 <memcmp+0x14>
+	}
+
+	return 0;
+  800ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ade:	eb 08                	jmp    800ae8 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ae0:	0f b6 c1             	movzbl %cl,%eax
+  800ae3:	0f b6 db             	movzbl %bl,%ebx
+  800ae6:	29 d8                	sub    %ebx,%eax
+}
+  800ae8:	5b                   	pop    %ebx
+  800ae9:	5e                   	pop    %esi
+  800aea:	5d                   	pop    %ebp
+  800aeb:	c3                   	ret
+	return 0;
+  800aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af1:	eb f5                	jmp    800ae8 <memcmp+0x37>
+
+00800af3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800afc:	89 c2                	mov    %eax,%edx
+  800afe:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b01:	39 d0                	cmp    %edx,%eax
+  800b03:	73 0d                	jae    800b12 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b05:	38 08                	cmp    %cl,(%eax)
+  800b07:	74 0d                	je     800b16 <memfind+0x23>
+	for (; s < ends; s++)
+  800b09:	83 c0 01             	add    $0x1,%eax
+  800b0c:	39 c2                	cmp    %eax,%edx
+  800b0e:	75 f5                	jne    800b05 <memfind+0x12>
+  800b10:	eb 06                	jmp    800b18 <memfind+0x25>
+  800b12:	89 c2                	mov    %eax,%edx
+  800b14:	eb 02                	jmp    800b18 <memfind+0x25>
+  800b16:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800b18:	89 d0                	mov    %edx,%eax
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+
+00800b1c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	57                   	push   %edi
+  800b20:	56                   	push   %esi
+  800b21:	53                   	push   %ebx
+  800b22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b28:	0f b6 02             	movzbl (%edx),%eax
+  800b2b:	3c 20                	cmp    $0x20,%al
+  800b2d:	74 04                	je     800b33 <strtol+0x17>
+  800b2f:	3c 09                	cmp    $0x9,%al
+  800b31:	75 0e                	jne    800b41 <strtol+0x25>
+		s++;
+  800b33:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b36:	0f b6 02             	movzbl (%edx),%eax
+  800b39:	3c 20                	cmp    $0x20,%al
+  800b3b:	74 f6                	je     800b33 <strtol+0x17>
+  800b3d:	3c 09                	cmp    $0x9,%al
+  800b3f:	74 f2                	je     800b33 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b41:	3c 2b                	cmp    $0x2b,%al
+  800b43:	74 2a                	je     800b6f <strtol+0x53>
+	int neg = 0;
+  800b45:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b4a:	3c 2d                	cmp    $0x2d,%al
+  800b4c:	74 2b                	je     800b79 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b4e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b54:	75 0f                	jne    800b65 <strtol+0x49>
+  800b56:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b59:	74 28                	je     800b83 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b5b:	85 db                	test   %ebx,%ebx
+  800b5d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b62:	0f 44 d8             	cmove  %eax,%ebx
+  800b65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b6d:	eb 46                	jmp    800bb5 <strtol+0x99>
+		s++;
+  800b6f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b72:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b77:	eb d5                	jmp    800b4e <strtol+0x32>
+		s++, neg = 1;
+  800b79:	83 c2 01             	add    $0x1,%edx
+  800b7c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b81:	eb cb                	jmp    800b4e <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b83:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b87:	74 0e                	je     800b97 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800b89:	85 db                	test   %ebx,%ebx
+  800b8b:	75 d8                	jne    800b65 <strtol+0x49>
+		s++, base = 8;
+  800b8d:	83 c2 01             	add    $0x1,%edx
+  800b90:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b95:	eb ce                	jmp    800b65 <strtol+0x49>
+		s += 2, base = 16;
+  800b97:	83 c2 02             	add    $0x2,%edx
+  800b9a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b9f:	eb c4                	jmp    800b65 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ba1:	0f be c0             	movsbl %al,%eax
+  800ba4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ba7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800baa:	7d 3a                	jge    800be6 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800bac:	83 c2 01             	add    $0x1,%edx
+  800baf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bb3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bb5:	0f b6 02             	movzbl (%edx),%eax
+  800bb8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bbb:	89 f3                	mov    %esi,%ebx
+  800bbd:	80 fb 09             	cmp    $0x9,%bl
+  800bc0:	76 df                	jbe    800ba1 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800bc2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bc5:	89 f3                	mov    %esi,%ebx
+  800bc7:	80 fb 19             	cmp    $0x19,%bl
+  800bca:	77 08                	ja     800bd4 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800bcc:	0f be c0             	movsbl %al,%eax
+  800bcf:	83 e8 57             	sub    $0x57,%eax
+  800bd2:	eb d3                	jmp    800ba7 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bd4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bd7:	89 f3                	mov    %esi,%ebx
+  800bd9:	80 fb 19             	cmp    $0x19,%bl
+  800bdc:	77 08                	ja     800be6 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800bde:	0f be c0             	movsbl %al,%eax
+  800be1:	83 e8 37             	sub    $0x37,%eax
+  800be4:	eb c1                	jmp    800ba7 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800be6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bea:	74 05                	je     800bf1 <strtol+0xd5>
+		*endptr = (char *) s;
+  800bec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bef:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bf1:	89 c8                	mov    %ecx,%eax
+  800bf3:	f7 d8                	neg    %eax
+  800bf5:	85 ff                	test   %edi,%edi
+  800bf7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bfa:	89 c8                	mov    %ecx,%eax
+  800bfc:	5b                   	pop    %ebx
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5f                   	pop    %edi
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+
+00800c01 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	57                   	push   %edi
+  800c05:	56                   	push   %esi
+  800c06:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c12:	89 c3                	mov    %eax,%ebx
+  800c14:	89 c7                	mov    %eax,%edi
+  800c16:	89 c6                	mov    %eax,%esi
+  800c18:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c1a:	5b                   	pop    %ebx
+  800c1b:	5e                   	pop    %esi
+  800c1c:	5f                   	pop    %edi
+  800c1d:	5d                   	pop    %ebp
+  800c1e:	c3                   	ret
+
+00800c1f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	57                   	push   %edi
+  800c23:	56                   	push   %esi
+  800c24:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c2f:	89 d1                	mov    %edx,%ecx
+  800c31:	89 d3                	mov    %edx,%ebx
+  800c33:	89 d7                	mov    %edx,%edi
+  800c35:	89 d6                	mov    %edx,%esi
+  800c37:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c39:	5b                   	pop    %ebx
+  800c3a:	5e                   	pop    %esi
+  800c3b:	5f                   	pop    %edi
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	c3                   	ret
+
+00800c3e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	57                   	push   %edi
+  800c42:	56                   	push   %esi
+  800c43:	53                   	push   %ebx
+  800c44:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c54:	89 cb                	mov    %ecx,%ebx
+  800c56:	89 cf                	mov    %ecx,%edi
+  800c58:	89 ce                	mov    %ecx,%esi
+  800c5a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c5c:	85 c0                	test   %eax,%eax
+  800c5e:	7f 08                	jg     800c68 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c63:	5b                   	pop    %ebx
+  800c64:	5e                   	pop    %esi
+  800c65:	5f                   	pop    %edi
+  800c66:	5d                   	pop    %ebp
+  800c67:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c68:	83 ec 0c             	sub    $0xc,%esp
+  800c6b:	50                   	push   %eax
+  800c6c:	6a 03                	push   $0x3
+  800c6e:	68 eb 3d 80 00       	push   $0x803deb
+  800c73:	6a 23                	push   $0x23
+  800c75:	68 08 3e 80 00       	push   $0x803e08
+  800c7a:	e8 79 28 00 00       	call   8034f8 <_panic>
+
+00800c7f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	57                   	push   %edi
+  800c83:	56                   	push   %esi
+  800c84:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c8f:	89 d1                	mov    %edx,%ecx
+  800c91:	89 d3                	mov    %edx,%ebx
+  800c93:	89 d7                	mov    %edx,%edi
+  800c95:	89 d6                	mov    %edx,%esi
+  800c97:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5f                   	pop    %edi
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+
+00800c9e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c9e:	55                   	push   %ebp
+  800c9f:	89 e5                	mov    %esp,%ebp
+  800ca1:	57                   	push   %edi
+  800ca2:	56                   	push   %esi
+  800ca3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cae:	89 d1                	mov    %edx,%ecx
+  800cb0:	89 d3                	mov    %edx,%ebx
+  800cb2:	89 d7                	mov    %edx,%edi
+  800cb4:	89 d6                	mov    %edx,%esi
+  800cb6:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5f                   	pop    %edi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+
+00800cbd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	57                   	push   %edi
+  800cc1:	56                   	push   %esi
+  800cc2:	53                   	push   %ebx
+  800cc3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cc6:	be 00 00 00 00       	mov    $0x0,%esi
+  800ccb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd9:	89 f7                	mov    %esi,%edi
+  800cdb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cdd:	85 c0                	test   %eax,%eax
+  800cdf:	7f 08                	jg     800ce9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ce1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce4:	5b                   	pop    %ebx
+  800ce5:	5e                   	pop    %esi
+  800ce6:	5f                   	pop    %edi
+  800ce7:	5d                   	pop    %ebp
+  800ce8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+  800cec:	50                   	push   %eax
+  800ced:	6a 04                	push   $0x4
+  800cef:	68 eb 3d 80 00       	push   $0x803deb
+  800cf4:	6a 23                	push   $0x23
+  800cf6:	68 08 3e 80 00       	push   $0x803e08
+  800cfb:	e8 f8 27 00 00       	call   8034f8 <_panic>
+
+00800d00 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	57                   	push   %edi
+  800d04:	56                   	push   %esi
+  800d05:	53                   	push   %ebx
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d17:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d1a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d1d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d1f:	85 c0                	test   %eax,%eax
+  800d21:	7f 08                	jg     800d2b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  800d2e:	50                   	push   %eax
+  800d2f:	6a 05                	push   $0x5
+  800d31:	68 eb 3d 80 00       	push   $0x803deb
+  800d36:	6a 23                	push   $0x23
+  800d38:	68 08 3e 80 00       	push   $0x803e08
+  800d3d:	e8 b6 27 00 00       	call   8034f8 <_panic>
+
+00800d42 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	57                   	push   %edi
+  800d46:	56                   	push   %esi
+  800d47:	53                   	push   %ebx
+  800d48:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d56:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d5b:	89 df                	mov    %ebx,%edi
+  800d5d:	89 de                	mov    %ebx,%esi
+  800d5f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d61:	85 c0                	test   %eax,%eax
+  800d63:	7f 08                	jg     800d6d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d68:	5b                   	pop    %ebx
+  800d69:	5e                   	pop    %esi
+  800d6a:	5f                   	pop    %edi
+  800d6b:	5d                   	pop    %ebp
+  800d6c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6d:	83 ec 0c             	sub    $0xc,%esp
+  800d70:	50                   	push   %eax
+  800d71:	6a 06                	push   $0x6
+  800d73:	68 eb 3d 80 00       	push   $0x803deb
+  800d78:	6a 23                	push   $0x23
+  800d7a:	68 08 3e 80 00       	push   $0x803e08
+  800d7f:	e8 74 27 00 00       	call   8034f8 <_panic>
+
+00800d84 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d84:	55                   	push   %ebp
+  800d85:	89 e5                	mov    %esp,%ebp
+  800d87:	57                   	push   %edi
+  800d88:	56                   	push   %esi
+  800d89:	53                   	push   %ebx
+  800d8a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d98:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d9d:	89 df                	mov    %ebx,%edi
+  800d9f:	89 de                	mov    %ebx,%esi
+  800da1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da3:	85 c0                	test   %eax,%eax
+  800da5:	7f 08                	jg     800daf <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800da7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800daa:	5b                   	pop    %ebx
+  800dab:	5e                   	pop    %esi
+  800dac:	5f                   	pop    %edi
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800daf:	83 ec 0c             	sub    $0xc,%esp
+  800db2:	50                   	push   %eax
+  800db3:	6a 08                	push   $0x8
+  800db5:	68 eb 3d 80 00       	push   $0x803deb
+  800dba:	6a 23                	push   $0x23
+  800dbc:	68 08 3e 80 00       	push   $0x803e08
+  800dc1:	e8 32 27 00 00       	call   8034f8 <_panic>
+
+00800dc6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dc6:	55                   	push   %ebp
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	57                   	push   %edi
+  800dca:	56                   	push   %esi
+  800dcb:	53                   	push   %ebx
+  800dcc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dda:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ddf:	89 df                	mov    %ebx,%edi
+  800de1:	89 de                	mov    %ebx,%esi
+  800de3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de5:	85 c0                	test   %eax,%eax
+  800de7:	7f 08                	jg     800df1 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  800df4:	50                   	push   %eax
+  800df5:	6a 09                	push   $0x9
+  800df7:	68 eb 3d 80 00       	push   $0x803deb
+  800dfc:	6a 23                	push   $0x23
+  800dfe:	68 08 3e 80 00       	push   $0x803e08
+  800e03:	e8 f0 26 00 00       	call   8034f8 <_panic>
+
+00800e08 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  800e0e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e21:	89 df                	mov    %ebx,%edi
+  800e23:	89 de                	mov    %ebx,%esi
+  800e25:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e27:	85 c0                	test   %eax,%eax
+  800e29:	7f 08                	jg     800e33 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e33:	83 ec 0c             	sub    $0xc,%esp
+  800e36:	50                   	push   %eax
+  800e37:	6a 0a                	push   $0xa
+  800e39:	68 eb 3d 80 00       	push   $0x803deb
+  800e3e:	6a 23                	push   $0x23
+  800e40:	68 08 3e 80 00       	push   $0x803e08
+  800e45:	e8 ae 26 00 00       	call   8034f8 <_panic>
+
+00800e4a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	57                   	push   %edi
+  800e4e:	56                   	push   %esi
+  800e4f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e56:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e63:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e66:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e68:	5b                   	pop    %ebx
+  800e69:	5e                   	pop    %esi
+  800e6a:	5f                   	pop    %edi
+  800e6b:	5d                   	pop    %ebp
+  800e6c:	c3                   	ret
+
+00800e6d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	57                   	push   %edi
+  800e71:	56                   	push   %esi
+  800e72:	53                   	push   %ebx
+  800e73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e83:	89 cb                	mov    %ecx,%ebx
+  800e85:	89 cf                	mov    %ecx,%edi
+  800e87:	89 ce                	mov    %ecx,%esi
+  800e89:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8b:	85 c0                	test   %eax,%eax
+  800e8d:	7f 08                	jg     800e97 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e97:	83 ec 0c             	sub    $0xc,%esp
+  800e9a:	50                   	push   %eax
+  800e9b:	6a 0d                	push   $0xd
+  800e9d:	68 eb 3d 80 00       	push   $0x803deb
+  800ea2:	6a 23                	push   $0x23
+  800ea4:	68 08 3e 80 00       	push   $0x803e08
+  800ea9:	e8 4a 26 00 00       	call   8034f8 <_panic>
+
+00800eae <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	57                   	push   %edi
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eba:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ec8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800eca:	5b                   	pop    %ebx
+  800ecb:	5e                   	pop    %esi
+  800ecc:	5f                   	pop    %edi
+  800ecd:	5d                   	pop    %ebp
+  800ece:	c3                   	ret
+
+00800ecf <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800ecf:	55                   	push   %ebp
+  800ed0:	89 e5                	mov    %esp,%ebp
+  800ed2:	57                   	push   %edi
+  800ed3:	56                   	push   %esi
+  800ed4:	53                   	push   %ebx
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ee8:	89 df                	mov    %ebx,%edi
+  800eea:	89 de                	mov    %ebx,%esi
+  800eec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eee:	85 c0                	test   %eax,%eax
+  800ef0:	7f 08                	jg     800efa <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800ef2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef5:	5b                   	pop    %ebx
+  800ef6:	5e                   	pop    %esi
+  800ef7:	5f                   	pop    %edi
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	50                   	push   %eax
+  800efe:	6a 0d                	push   $0xd
+  800f00:	68 eb 3d 80 00       	push   $0x803deb
+  800f05:	6a 23                	push   $0x23
+  800f07:	68 08 3e 80 00       	push   $0x803e08
+  800f0c:	e8 e7 25 00 00       	call   8034f8 <_panic>
+
+00800f11 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	57                   	push   %edi
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f21:	89 d1                	mov    %edx,%ecx
+  800f23:	89 d3                	mov    %edx,%ebx
+  800f25:	89 d7                	mov    %edx,%edi
+  800f27:	89 d6                	mov    %edx,%esi
+  800f29:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f41:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f46:	89 df                	mov    %ebx,%edi
+  800f48:	89 de                	mov    %ebx,%esi
+  800f4a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800f4c:	5b                   	pop    %ebx
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5f                   	pop    %edi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+
+00800f51 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	57                   	push   %edi
+  800f55:	56                   	push   %esi
+  800f56:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f64:	89 cb                	mov    %ecx,%ebx
+  800f66:	89 cf                	mov    %ecx,%edi
+  800f68:	89 ce                	mov    %ecx,%esi
+  800f6a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+
+00800f71 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f82:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f87:	89 df                	mov    %ebx,%edi
+  800f89:	89 de                	mov    %ebx,%esi
+  800f8b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5f                   	pop    %edi
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+
+00800f92 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	57                   	push   %edi
+  800f96:	56                   	push   %esi
+  800f97:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa3:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fa8:	89 df                	mov    %ebx,%edi
+  800faa:	89 de                	mov    %ebx,%esi
+  800fac:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+
+00800fb3 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fc6:	89 cb                	mov    %ecx,%ebx
+  800fc8:	89 cf                	mov    %ecx,%edi
+  800fca:	89 ce                	mov    %ecx,%esi
+  800fcc:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+
+00800fd3 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe4:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fe9:	89 df                	mov    %ebx,%edi
+  800feb:	89 de                	mov    %ebx,%esi
+  800fed:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  800fef:	5b                   	pop    %ebx
+  800ff0:	5e                   	pop    %esi
+  800ff1:	5f                   	pop    %edi
+  800ff2:	5d                   	pop    %ebp
+  800ff3:	c3                   	ret
+
+00800ff4 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  800ff4:	55                   	push   %ebp
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	57                   	push   %edi
+  800ff8:	56                   	push   %esi
+  800ff9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	b8 15 00 00 00       	mov    $0x15,%eax
+  801007:	89 cb                	mov    %ecx,%ebx
+  801009:	89 cf                	mov    %ecx,%edi
+  80100b:	89 ce                	mov    %ecx,%esi
+  80100d:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80100f:	5b                   	pop    %ebx
+  801010:	5e                   	pop    %esi
+  801011:	5f                   	pop    %edi
+  801012:	5d                   	pop    %ebp
+  801013:	c3                   	ret
+
+00801014 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101a:	be 00 00 00 00       	mov    $0x0,%esi
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 16 00 00 00       	mov    $0x16,%eax
+  80102a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102d:	89 f7                	mov    %esi,%edi
+  80102f:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801031:	5b                   	pop    %ebx
+  801032:	5e                   	pop    %esi
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+
+00801036 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	57                   	push   %edi
+  80103a:	56                   	push   %esi
+  80103b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 17 00 00 00       	mov    $0x17,%eax
+  80104c:	89 df                	mov    %ebx,%edi
+  80104e:	89 de                	mov    %ebx,%esi
+  801050:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+
+00801057 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	56                   	push   %esi
+  80105c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801062:	8b 55 08             	mov    0x8(%ebp),%edx
+  801065:	b8 18 00 00 00       	mov    $0x18,%eax
+  80106a:	89 cb                	mov    %ecx,%ebx
+  80106c:	89 cf                	mov    %ecx,%edi
+  80106e:	89 ce                	mov    %ecx,%esi
+  801070:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80107d:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801081:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 19 00 00 00       	mov    $0x19,%eax
+  80108e:	89 df                	mov    %ebx,%edi
+  801090:	89 de                	mov    %ebx,%esi
+  801092:	cd 30                	int    $0x30
+}
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+
+00801099 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109f:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b2:	89 f7                	mov    %esi,%edi
+  8010b4:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8010b6:	5b                   	pop    %ebx
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5f                   	pop    %edi
+  8010b9:	5d                   	pop    %ebp
+  8010ba:	c3                   	ret
+
+008010bb <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d4:	89 f7                	mov    %esi,%edi
+  8010d6:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5e                   	pop    %esi
+  8010da:	5f                   	pop    %edi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+
+008010dd <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8010dd:	55                   	push   %ebp
+  8010de:	89 e5                	mov    %esp,%ebp
+  8010e0:	57                   	push   %edi
+  8010e1:	56                   	push   %esi
+  8010e2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010f3:	89 df                	mov    %ebx,%edi
+  8010f5:	89 de                	mov    %ebx,%esi
+  8010f7:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8010f9:	5b                   	pop    %ebx
+  8010fa:	5e                   	pop    %esi
+  8010fb:	5f                   	pop    %edi
+  8010fc:	5d                   	pop    %ebp
+  8010fd:	c3                   	ret
+
+008010fe <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801104:	be 00 00 00 00       	mov    $0x0,%esi
+  801109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801114:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801117:	89 f7                	mov    %esi,%edi
+  801119:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80111b:	5b                   	pop    %ebx
+  80111c:	5e                   	pop    %esi
+  80111d:	5f                   	pop    %edi
+  80111e:	5d                   	pop    %ebp
+  80111f:	c3                   	ret
+
+00801120 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801123:	8b 45 08             	mov    0x8(%ebp),%eax
+  801126:	05 00 00 00 30       	add    $0x30000000,%eax
+  80112b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80112e:	5d                   	pop    %ebp
+  80112f:	c3                   	ret
+
+00801130 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801133:	8b 45 08             	mov    0x8(%ebp),%eax
+  801136:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80113b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801140:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801145:	5d                   	pop    %ebp
+  801146:	c3                   	ret
+
+00801147 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80114f:	89 c2                	mov    %eax,%edx
+  801151:	c1 ea 16             	shr    $0x16,%edx
+  801154:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80115b:	f6 c2 01             	test   $0x1,%dl
+  80115e:	74 29                	je     801189 <fd_alloc+0x42>
+  801160:	89 c2                	mov    %eax,%edx
+  801162:	c1 ea 0c             	shr    $0xc,%edx
+  801165:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80116c:	f6 c2 01             	test   $0x1,%dl
+  80116f:	74 18                	je     801189 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801171:	05 00 10 00 00       	add    $0x1000,%eax
+  801176:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80117b:	75 d2                	jne    80114f <fd_alloc+0x8>
+  80117d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801182:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801187:	eb 05                	jmp    80118e <fd_alloc+0x47>
+			return 0;
+  801189:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80118e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801191:	89 02                	mov    %eax,(%edx)
+}
+  801193:	89 c8                	mov    %ecx,%eax
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+
+00801197 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80119d:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8011a2:	77 30                	ja     8011d4 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011a4:	c1 e0 0c             	shl    $0xc,%eax
+  8011a7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8011ac:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011b2:	f6 c2 01             	test   $0x1,%dl
+  8011b5:	74 24                	je     8011db <fd_lookup+0x44>
+  8011b7:	89 c2                	mov    %eax,%edx
+  8011b9:	c1 ea 0c             	shr    $0xc,%edx
+  8011bc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011c3:	f6 c2 01             	test   $0x1,%dl
+  8011c6:	74 1a                	je     8011e2 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011cb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d2:	5d                   	pop    %ebp
+  8011d3:	c3                   	ret
+		return -E_INVAL;
+  8011d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011d9:	eb f7                	jmp    8011d2 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8011db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e0:	eb f0                	jmp    8011d2 <fd_lookup+0x3b>
+  8011e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e7:	eb e9                	jmp    8011d2 <fd_lookup+0x3b>
+
+008011e9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	53                   	push   %ebx
+  8011ed:	83 ec 04             	sub    $0x4,%esp
+  8011f0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f8:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8011fd:	39 13                	cmp    %edx,(%ebx)
+  8011ff:	74 54                	je     801255 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801201:	83 c0 01             	add    $0x1,%eax
+  801204:	8b 1c 85 94 3e 80 00 	mov    0x803e94(,%eax,4),%ebx
+  80120b:	85 db                	test   %ebx,%ebx
+  80120d:	75 ee                	jne    8011fd <dev_lookup+0x14>
+  80120f:	89 e1                	mov    %esp,%ecx
+  801211:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801216:	29 c8                	sub    %ecx,%eax
+  801218:	89 c1                	mov    %eax,%ecx
+  80121a:	c1 e9 0f             	shr    $0xf,%ecx
+  80121d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801222:	b8 00 00 00 00       	mov    $0x0,%eax
+  801227:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80122a:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  801231:	8b 40 48             	mov    0x48(%eax),%eax
+  801234:	83 ec 04             	sub    $0x4,%esp
+  801237:	52                   	push   %edx
+  801238:	50                   	push   %eax
+  801239:	68 18 3e 80 00       	push   $0x803e18
+  80123e:	e8 4f ef ff ff       	call   800192 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801243:	83 c4 10             	add    $0x10,%esp
+  801246:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80124b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80124e:	89 1a                	mov    %ebx,(%edx)
+}
+  801250:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801253:	c9                   	leave
+  801254:	c3                   	ret
+			return 0;
+  801255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125a:	eb ef                	jmp    80124b <dev_lookup+0x62>
+
+0080125c <fd_close>:
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	57                   	push   %edi
+  801260:	56                   	push   %esi
+  801261:	53                   	push   %ebx
+  801262:	83 ec 24             	sub    $0x24,%esp
+  801265:	8b 75 08             	mov    0x8(%ebp),%esi
+  801268:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80126b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80126e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80126f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801275:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801278:	50                   	push   %eax
+  801279:	e8 19 ff ff ff       	call   801197 <fd_lookup>
+  80127e:	89 c3                	mov    %eax,%ebx
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	85 c0                	test   %eax,%eax
+  801285:	78 05                	js     80128c <fd_close+0x30>
+	    || fd != fd2)
+  801287:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80128a:	74 0f                	je     80129b <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80128c:	85 ff                	test   %edi,%edi
+  80128e:	0f 44 df             	cmove  %edi,%ebx
+}
+  801291:	89 d8                	mov    %ebx,%eax
+  801293:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801296:	5b                   	pop    %ebx
+  801297:	5e                   	pop    %esi
+  801298:	5f                   	pop    %edi
+  801299:	5d                   	pop    %ebp
+  80129a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80129b:	83 ec 08             	sub    $0x8,%esp
+  80129e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012a1:	50                   	push   %eax
+  8012a2:	ff 36                	push   (%esi)
+  8012a4:	e8 40 ff ff ff       	call   8011e9 <dev_lookup>
+  8012a9:	89 c3                	mov    %eax,%ebx
+  8012ab:	83 c4 10             	add    $0x10,%esp
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	78 1a                	js     8012cc <fd_close+0x70>
+		if (dev->dev_close)
+  8012b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012b5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	74 0b                	je     8012cc <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8012c1:	83 ec 0c             	sub    $0xc,%esp
+  8012c4:	56                   	push   %esi
+  8012c5:	ff d0                	call   *%eax
+  8012c7:	89 c3                	mov    %eax,%ebx
+  8012c9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012cc:	83 ec 08             	sub    $0x8,%esp
+  8012cf:	56                   	push   %esi
+  8012d0:	6a 00                	push   $0x0
+  8012d2:	e8 6b fa ff ff       	call   800d42 <sys_page_unmap>
+	return r;
+  8012d7:	83 c4 10             	add    $0x10,%esp
+  8012da:	eb b5                	jmp    801291 <fd_close+0x35>
+
+008012dc <close>:
+
+int
+close(int fdnum)
+{
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012e5:	50                   	push   %eax
+  8012e6:	ff 75 08             	push   0x8(%ebp)
+  8012e9:	e8 a9 fe ff ff       	call   801197 <fd_lookup>
+  8012ee:	83 c4 10             	add    $0x10,%esp
+  8012f1:	85 c0                	test   %eax,%eax
+  8012f3:	79 02                	jns    8012f7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012f5:	c9                   	leave
+  8012f6:	c3                   	ret
+		return fd_close(fd, 1);
+  8012f7:	83 ec 08             	sub    $0x8,%esp
+  8012fa:	6a 01                	push   $0x1
+  8012fc:	ff 75 f4             	push   -0xc(%ebp)
+  8012ff:	e8 58 ff ff ff       	call   80125c <fd_close>
+  801304:	83 c4 10             	add    $0x10,%esp
+  801307:	eb ec                	jmp    8012f5 <close+0x19>
+
+00801309 <close_all>:
+
+void
+close_all(void)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	53                   	push   %ebx
+  80130d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801310:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801315:	83 ec 0c             	sub    $0xc,%esp
+  801318:	53                   	push   %ebx
+  801319:	e8 be ff ff ff       	call   8012dc <close>
+	for (i = 0; i < MAXFD; i++)
+  80131e:	83 c3 01             	add    $0x1,%ebx
+  801321:	83 c4 10             	add    $0x10,%esp
+  801324:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80132a:	75 e9                	jne    801315 <close_all+0xc>
+}
+  80132c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80132f:	c9                   	leave
+  801330:	c3                   	ret
+
+00801331 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+  801337:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80133a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80133d:	50                   	push   %eax
+  80133e:	ff 75 08             	push   0x8(%ebp)
+  801341:	e8 51 fe ff ff       	call   801197 <fd_lookup>
+  801346:	89 c3                	mov    %eax,%ebx
+  801348:	83 c4 10             	add    $0x10,%esp
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	78 7f                	js     8013ce <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80134f:	83 ec 0c             	sub    $0xc,%esp
+  801352:	ff 75 0c             	push   0xc(%ebp)
+  801355:	e8 82 ff ff ff       	call   8012dc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80135a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80135d:	c1 e6 0c             	shl    $0xc,%esi
+  801360:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801366:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801369:	89 3c 24             	mov    %edi,(%esp)
+  80136c:	e8 bf fd ff ff       	call   801130 <fd2data>
+  801371:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801373:	89 34 24             	mov    %esi,(%esp)
+  801376:	e8 b5 fd ff ff       	call   801130 <fd2data>
+  80137b:	83 c4 10             	add    $0x10,%esp
+  80137e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801381:	89 d8                	mov    %ebx,%eax
+  801383:	c1 e8 16             	shr    $0x16,%eax
+  801386:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80138d:	a8 01                	test   $0x1,%al
+  80138f:	74 11                	je     8013a2 <dup+0x71>
+  801391:	89 d8                	mov    %ebx,%eax
+  801393:	c1 e8 0c             	shr    $0xc,%eax
+  801396:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80139d:	f6 c2 01             	test   $0x1,%dl
+  8013a0:	75 36                	jne    8013d8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013a2:	89 f8                	mov    %edi,%eax
+  8013a4:	c1 e8 0c             	shr    $0xc,%eax
+  8013a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013ae:	83 ec 0c             	sub    $0xc,%esp
+  8013b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b6:	50                   	push   %eax
+  8013b7:	56                   	push   %esi
+  8013b8:	6a 00                	push   $0x0
+  8013ba:	57                   	push   %edi
+  8013bb:	6a 00                	push   $0x0
+  8013bd:	e8 3e f9 ff ff       	call   800d00 <sys_page_map>
+  8013c2:	89 c3                	mov    %eax,%ebx
+  8013c4:	83 c4 20             	add    $0x20,%esp
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	78 33                	js     8013fe <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013ce:	89 d8                	mov    %ebx,%eax
+  8013d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d3:	5b                   	pop    %ebx
+  8013d4:	5e                   	pop    %esi
+  8013d5:	5f                   	pop    %edi
+  8013d6:	5d                   	pop    %ebp
+  8013d7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013df:	83 ec 0c             	sub    $0xc,%esp
+  8013e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013e7:	50                   	push   %eax
+  8013e8:	ff 75 d4             	push   -0x2c(%ebp)
+  8013eb:	6a 00                	push   $0x0
+  8013ed:	53                   	push   %ebx
+  8013ee:	6a 00                	push   $0x0
+  8013f0:	e8 0b f9 ff ff       	call   800d00 <sys_page_map>
+  8013f5:	89 c3                	mov    %eax,%ebx
+  8013f7:	83 c4 20             	add    $0x20,%esp
+  8013fa:	85 c0                	test   %eax,%eax
+  8013fc:	79 a4                	jns    8013a2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013fe:	83 ec 08             	sub    $0x8,%esp
+  801401:	56                   	push   %esi
+  801402:	6a 00                	push   $0x0
+  801404:	e8 39 f9 ff ff       	call   800d42 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801409:	83 c4 08             	add    $0x8,%esp
+  80140c:	ff 75 d4             	push   -0x2c(%ebp)
+  80140f:	6a 00                	push   $0x0
+  801411:	e8 2c f9 ff ff       	call   800d42 <sys_page_unmap>
+	return r;
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	eb b3                	jmp    8013ce <dup+0x9d>
+
+0080141b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	56                   	push   %esi
+  80141f:	53                   	push   %ebx
+  801420:	83 ec 18             	sub    $0x18,%esp
+  801423:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801426:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801429:	50                   	push   %eax
+  80142a:	53                   	push   %ebx
+  80142b:	e8 67 fd ff ff       	call   801197 <fd_lookup>
+  801430:	83 c4 10             	add    $0x10,%esp
+  801433:	85 c0                	test   %eax,%eax
+  801435:	78 3c                	js     801473 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801437:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80143a:	83 ec 08             	sub    $0x8,%esp
+  80143d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801440:	50                   	push   %eax
+  801441:	ff 36                	push   (%esi)
+  801443:	e8 a1 fd ff ff       	call   8011e9 <dev_lookup>
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	78 24                	js     801473 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80144f:	8b 46 08             	mov    0x8(%esi),%eax
+  801452:	83 e0 03             	and    $0x3,%eax
+  801455:	83 f8 01             	cmp    $0x1,%eax
+  801458:	74 20                	je     80147a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80145a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145d:	8b 40 08             	mov    0x8(%eax),%eax
+  801460:	85 c0                	test   %eax,%eax
+  801462:	74 54                	je     8014b8 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801464:	83 ec 04             	sub    $0x4,%esp
+  801467:	ff 75 10             	push   0x10(%ebp)
+  80146a:	ff 75 0c             	push   0xc(%ebp)
+  80146d:	56                   	push   %esi
+  80146e:	ff d0                	call   *%eax
+  801470:	83 c4 10             	add    $0x10,%esp
+}
+  801473:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801476:	5b                   	pop    %ebx
+  801477:	5e                   	pop    %esi
+  801478:	5d                   	pop    %ebp
+  801479:	c3                   	ret
+  80147a:	89 e2                	mov    %esp,%edx
+  80147c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801481:	29 d0                	sub    %edx,%eax
+  801483:	89 c2                	mov    %eax,%edx
+  801485:	c1 ea 0f             	shr    $0xf,%edx
+  801488:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80148d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801492:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801495:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80149c:	8b 40 48             	mov    0x48(%eax),%eax
+  80149f:	83 ec 04             	sub    $0x4,%esp
+  8014a2:	53                   	push   %ebx
+  8014a3:	50                   	push   %eax
+  8014a4:	68 59 3e 80 00       	push   $0x803e59
+  8014a9:	e8 e4 ec ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8014ae:	83 c4 10             	add    $0x10,%esp
+  8014b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b6:	eb bb                	jmp    801473 <read+0x58>
+		return -E_NOT_SUPP;
+  8014b8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014bd:	eb b4                	jmp    801473 <read+0x58>
+
+008014bf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	57                   	push   %edi
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	83 ec 0c             	sub    $0xc,%esp
+  8014c8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014cb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014ce:	85 f6                	test   %esi,%esi
+  8014d0:	74 30                	je     801502 <readn+0x43>
+  8014d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014dc:	83 ec 04             	sub    $0x4,%esp
+  8014df:	89 f2                	mov    %esi,%edx
+  8014e1:	29 c2                	sub    %eax,%edx
+  8014e3:	52                   	push   %edx
+  8014e4:	01 f8                	add    %edi,%eax
+  8014e6:	50                   	push   %eax
+  8014e7:	ff 75 08             	push   0x8(%ebp)
+  8014ea:	e8 2c ff ff ff       	call   80141b <read>
+		if (m < 0)
+  8014ef:	83 c4 10             	add    $0x10,%esp
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	78 15                	js     80150b <readn+0x4c>
+			return m;
+		if (m == 0)
+  8014f6:	74 11                	je     801509 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8014f8:	01 c3                	add    %eax,%ebx
+  8014fa:	89 d8                	mov    %ebx,%eax
+  8014fc:	39 f3                	cmp    %esi,%ebx
+  8014fe:	72 dc                	jb     8014dc <readn+0x1d>
+  801500:	eb 09                	jmp    80150b <readn+0x4c>
+  801502:	b8 00 00 00 00       	mov    $0x0,%eax
+  801507:	eb 02                	jmp    80150b <readn+0x4c>
+  801509:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80150b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150e:	5b                   	pop    %ebx
+  80150f:	5e                   	pop    %esi
+  801510:	5f                   	pop    %edi
+  801511:	5d                   	pop    %ebp
+  801512:	c3                   	ret
+
+00801513 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	56                   	push   %esi
+  801517:	53                   	push   %ebx
+  801518:	83 ec 18             	sub    $0x18,%esp
+  80151b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80151e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801521:	50                   	push   %eax
+  801522:	53                   	push   %ebx
+  801523:	e8 6f fc ff ff       	call   801197 <fd_lookup>
+  801528:	83 c4 10             	add    $0x10,%esp
+  80152b:	85 c0                	test   %eax,%eax
+  80152d:	78 37                	js     801566 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80152f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801532:	83 ec 08             	sub    $0x8,%esp
+  801535:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801538:	50                   	push   %eax
+  801539:	ff 36                	push   (%esi)
+  80153b:	e8 a9 fc ff ff       	call   8011e9 <dev_lookup>
+  801540:	83 c4 10             	add    $0x10,%esp
+  801543:	85 c0                	test   %eax,%eax
+  801545:	78 1f                	js     801566 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801547:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80154b:	74 20                	je     80156d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80154d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801550:	8b 40 0c             	mov    0xc(%eax),%eax
+  801553:	85 c0                	test   %eax,%eax
+  801555:	74 54                	je     8015ab <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801557:	83 ec 04             	sub    $0x4,%esp
+  80155a:	ff 75 10             	push   0x10(%ebp)
+  80155d:	ff 75 0c             	push   0xc(%ebp)
+  801560:	56                   	push   %esi
+  801561:	ff d0                	call   *%eax
+  801563:	83 c4 10             	add    $0x10,%esp
+}
+  801566:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801569:	5b                   	pop    %ebx
+  80156a:	5e                   	pop    %esi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+  80156d:	89 e2                	mov    %esp,%edx
+  80156f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801574:	29 d0                	sub    %edx,%eax
+  801576:	89 c2                	mov    %eax,%edx
+  801578:	c1 ea 0f             	shr    $0xf,%edx
+  80157b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801580:	b8 00 00 00 00       	mov    $0x0,%eax
+  801585:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801588:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80158f:	8b 40 48             	mov    0x48(%eax),%eax
+  801592:	83 ec 04             	sub    $0x4,%esp
+  801595:	53                   	push   %ebx
+  801596:	50                   	push   %eax
+  801597:	68 75 3e 80 00       	push   $0x803e75
+  80159c:	e8 f1 eb ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8015a1:	83 c4 10             	add    $0x10,%esp
+  8015a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a9:	eb bb                	jmp    801566 <write+0x53>
+		return -E_NOT_SUPP;
+  8015ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b0:	eb b4                	jmp    801566 <write+0x53>
+
+008015b2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015b2:	55                   	push   %ebp
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015bb:	50                   	push   %eax
+  8015bc:	ff 75 08             	push   0x8(%ebp)
+  8015bf:	e8 d3 fb ff ff       	call   801197 <fd_lookup>
+  8015c4:	83 c4 10             	add    $0x10,%esp
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	78 0e                	js     8015d9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015d1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d9:	c9                   	leave
+  8015da:	c3                   	ret
+
+008015db <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  8015de:	53                   	push   %ebx
+  8015df:	83 ec 1c             	sub    $0x1c,%esp
+  8015e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e8:	50                   	push   %eax
+  8015e9:	ff 75 08             	push   0x8(%ebp)
+  8015ec:	e8 a6 fb ff ff       	call   801197 <fd_lookup>
+  8015f1:	83 c4 10             	add    $0x10,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	78 33                	js     80162b <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8015f8:	83 fb 03             	cmp    $0x3,%ebx
+  8015fb:	74 28                	je     801625 <fcntl+0x4a>
+  8015fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801602:	83 fb 04             	cmp    $0x4,%ebx
+  801605:	75 24                	jne    80162b <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801607:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80160a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80160d:	80 e4 ef             	and    $0xef,%ah
+  801610:	8b 55 10             	mov    0x10(%ebp),%edx
+  801613:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801619:	09 d0                	or     %edx,%eax
+  80161b:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801623:	eb 06                	jmp    80162b <fcntl+0x50>
+		return fd->fd_omode;
+  801625:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801628:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80162b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80162e:	c9                   	leave
+  80162f:	c3                   	ret
+
+00801630 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	56                   	push   %esi
+  801634:	53                   	push   %ebx
+  801635:	83 ec 18             	sub    $0x18,%esp
+  801638:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80163b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80163e:	50                   	push   %eax
+  80163f:	53                   	push   %ebx
+  801640:	e8 52 fb ff ff       	call   801197 <fd_lookup>
+  801645:	83 c4 10             	add    $0x10,%esp
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	78 34                	js     801680 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80164c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80164f:	83 ec 08             	sub    $0x8,%esp
+  801652:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801655:	50                   	push   %eax
+  801656:	ff 36                	push   (%esi)
+  801658:	e8 8c fb ff ff       	call   8011e9 <dev_lookup>
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	85 c0                	test   %eax,%eax
+  801662:	78 1c                	js     801680 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801664:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801668:	74 1d                	je     801687 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80166a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80166d:	8b 40 18             	mov    0x18(%eax),%eax
+  801670:	85 c0                	test   %eax,%eax
+  801672:	74 51                	je     8016c5 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801674:	83 ec 08             	sub    $0x8,%esp
+  801677:	ff 75 0c             	push   0xc(%ebp)
+  80167a:	56                   	push   %esi
+  80167b:	ff d0                	call   *%eax
+  80167d:	83 c4 10             	add    $0x10,%esp
+}
+  801680:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801683:	5b                   	pop    %ebx
+  801684:	5e                   	pop    %esi
+  801685:	5d                   	pop    %ebp
+  801686:	c3                   	ret
+  801687:	89 e2                	mov    %esp,%edx
+  801689:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80168e:	29 d0                	sub    %edx,%eax
+  801690:	89 c2                	mov    %eax,%edx
+  801692:	c1 ea 0f             	shr    $0xf,%edx
+  801695:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80169a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169f:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8016a2:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8016a9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016ac:	83 ec 04             	sub    $0x4,%esp
+  8016af:	53                   	push   %ebx
+  8016b0:	50                   	push   %eax
+  8016b1:	68 38 3e 80 00       	push   $0x803e38
+  8016b6:	e8 d7 ea ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8016bb:	83 c4 10             	add    $0x10,%esp
+  8016be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c3:	eb bb                	jmp    801680 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016c5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ca:	eb b4                	jmp    801680 <ftruncate+0x50>
+
+008016cc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+  8016d1:	83 ec 18             	sub    $0x18,%esp
+  8016d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016da:	50                   	push   %eax
+  8016db:	ff 75 08             	push   0x8(%ebp)
+  8016de:	e8 b4 fa ff ff       	call   801197 <fd_lookup>
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	78 53                	js     80173d <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016ed:	83 ec 08             	sub    $0x8,%esp
+  8016f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016f3:	50                   	push   %eax
+  8016f4:	ff 36                	push   (%esi)
+  8016f6:	e8 ee fa ff ff       	call   8011e9 <dev_lookup>
+  8016fb:	83 c4 10             	add    $0x10,%esp
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	78 3b                	js     80173d <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801705:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801709:	74 39                	je     801744 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80170b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80170e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801715:	00 00 00 
+	stat->st_isdir = 0;
+  801718:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80171f:	00 00 00 
+	stat->st_version = 0;
+  801722:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801729:	00 00 00 
+	stat->st_dev = dev;
+  80172c:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801732:	83 ec 08             	sub    $0x8,%esp
+  801735:	53                   	push   %ebx
+  801736:	56                   	push   %esi
+  801737:	ff 50 14             	call   *0x14(%eax)
+  80173a:	83 c4 10             	add    $0x10,%esp
+}
+  80173d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801740:	5b                   	pop    %ebx
+  801741:	5e                   	pop    %esi
+  801742:	5d                   	pop    %ebp
+  801743:	c3                   	ret
+		return -E_NOT_SUPP;
+  801744:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801749:	eb f2                	jmp    80173d <fstat+0x71>
+
+0080174b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	56                   	push   %esi
+  80174f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801750:	83 ec 08             	sub    $0x8,%esp
+  801753:	6a 00                	push   $0x0
+  801755:	ff 75 08             	push   0x8(%ebp)
+  801758:	e8 b7 01 00 00       	call   801914 <open>
+  80175d:	89 c3                	mov    %eax,%ebx
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	85 c0                	test   %eax,%eax
+  801764:	78 1b                	js     801781 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801766:	83 ec 08             	sub    $0x8,%esp
+  801769:	ff 75 0c             	push   0xc(%ebp)
+  80176c:	50                   	push   %eax
+  80176d:	e8 5a ff ff ff       	call   8016cc <fstat>
+  801772:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801774:	89 1c 24             	mov    %ebx,(%esp)
+  801777:	e8 60 fb ff ff       	call   8012dc <close>
+	return r;
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	89 f3                	mov    %esi,%ebx
+}
+  801781:	89 d8                	mov    %ebx,%eax
+  801783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5d                   	pop    %ebp
+  801789:	c3                   	ret
+
+0080178a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	56                   	push   %esi
+  80178e:	53                   	push   %ebx
+  80178f:	89 c6                	mov    %eax,%esi
+  801791:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801793:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80179a:	74 27                	je     8017c3 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80179c:	6a 07                	push   $0x7
+  80179e:	68 00 60 80 00       	push   $0x806000
+  8017a3:	56                   	push   %esi
+  8017a4:	ff 35 00 50 80 00    	push   0x805000
+  8017aa:	e8 1f 20 00 00       	call   8037ce <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017af:	83 c4 0c             	add    $0xc,%esp
+  8017b2:	6a 00                	push   $0x0
+  8017b4:	53                   	push   %ebx
+  8017b5:	6a 00                	push   $0x0
+  8017b7:	e8 82 1d 00 00       	call   80353e <ipc_recv>
+}
+  8017bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017bf:	5b                   	pop    %ebx
+  8017c0:	5e                   	pop    %esi
+  8017c1:	5d                   	pop    %ebp
+  8017c2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017c3:	83 ec 0c             	sub    $0xc,%esp
+  8017c6:	6a 02                	push   $0x2
+  8017c8:	e8 6a 20 00 00       	call   803837 <ipc_find_env>
+  8017cd:	a3 00 50 80 00       	mov    %eax,0x805000
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	eb c5                	jmp    80179c <fsipc+0x12>
+
+008017d7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8017e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017eb:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8017f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017fa:	e8 8b ff ff ff       	call   80178a <fsipc>
+}
+  8017ff:	c9                   	leave
+  801800:	c3                   	ret
+
+00801801 <devfile_flush>:
+{
+  801801:	55                   	push   %ebp
+  801802:	89 e5                	mov    %esp,%ebp
+  801804:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180d:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801812:	ba 00 00 00 00       	mov    $0x0,%edx
+  801817:	b8 06 00 00 00       	mov    $0x6,%eax
+  80181c:	e8 69 ff ff ff       	call   80178a <fsipc>
+}
+  801821:	c9                   	leave
+  801822:	c3                   	ret
+
+00801823 <devfile_stat>:
+{
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	53                   	push   %ebx
+  801827:	83 ec 04             	sub    $0x4,%esp
+  80182a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80182d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801830:	8b 40 0c             	mov    0xc(%eax),%eax
+  801833:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801838:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801842:	e8 43 ff ff ff       	call   80178a <fsipc>
+  801847:	85 c0                	test   %eax,%eax
+  801849:	78 37                	js     801882 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80184b:	83 ec 08             	sub    $0x8,%esp
+  80184e:	68 00 60 80 00       	push   $0x806000
+  801853:	53                   	push   %ebx
+  801854:	e8 30 f0 ff ff       	call   800889 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801859:	a1 80 60 80 00       	mov    0x806080,%eax
+  80185e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801864:	a1 84 60 80 00       	mov    0x806084,%eax
+  801869:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80186f:	a1 88 60 80 00       	mov    0x806088,%eax
+  801874:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801882:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801885:	c9                   	leave
+  801886:	c3                   	ret
+
+00801887 <devfile_write>:
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	83 ec 0c             	sub    $0xc,%esp
+  80188d:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801890:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801895:	39 d0                	cmp    %edx,%eax
+  801897:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80189a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189d:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018a0:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  8018a6:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8018ab:	50                   	push   %eax
+  8018ac:	ff 75 0c             	push   0xc(%ebp)
+  8018af:	68 08 60 80 00       	push   $0x806008
+  8018b4:	e8 80 f1 ff ff       	call   800a39 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8018b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018be:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018c3:	e8 c2 fe ff ff       	call   80178a <fsipc>
+}
+  8018c8:	c9                   	leave
+  8018c9:	c3                   	ret
+
+008018ca <devfile_read>:
+{
+  8018ca:	55                   	push   %ebp
+  8018cb:	89 e5                	mov    %esp,%ebp
+  8018cd:	53                   	push   %ebx
+  8018ce:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018d7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8018dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018df:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8018e4:	ba 00 60 80 00       	mov    $0x806000,%edx
+  8018e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018ee:	e8 97 fe ff ff       	call   80178a <fsipc>
+  8018f3:	89 c3                	mov    %eax,%ebx
+  8018f5:	85 c0                	test   %eax,%eax
+  8018f7:	78 14                	js     80190d <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8018f9:	83 ec 04             	sub    $0x4,%esp
+  8018fc:	50                   	push   %eax
+  8018fd:	68 00 60 80 00       	push   $0x806000
+  801902:	ff 75 0c             	push   0xc(%ebp)
+  801905:	e8 2f f1 ff ff       	call   800a39 <memmove>
+	return r;
+  80190a:	83 c4 10             	add    $0x10,%esp
+}
+  80190d:	89 d8                	mov    %ebx,%eax
+  80190f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801912:	c9                   	leave
+  801913:	c3                   	ret
+
+00801914 <open>:
+{
+  801914:	55                   	push   %ebp
+  801915:	89 e5                	mov    %esp,%ebp
+  801917:	53                   	push   %ebx
+  801918:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80191b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80191e:	50                   	push   %eax
+  80191f:	e8 23 f8 ff ff       	call   801147 <fd_alloc>
+  801924:	89 c3                	mov    %eax,%ebx
+  801926:	83 c4 10             	add    $0x10,%esp
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	78 2a                	js     801957 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80192d:	83 ec 0c             	sub    $0xc,%esp
+  801930:	ff 75 08             	push   0x8(%ebp)
+  801933:	e8 05 ef ff ff       	call   80083d <strlen>
+  801938:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80193b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801940:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801945:	7e 17                	jle    80195e <open+0x4a>
+	fd_close(fd, 1);
+  801947:	83 ec 08             	sub    $0x8,%esp
+  80194a:	6a 01                	push   $0x1
+  80194c:	ff 75 f4             	push   -0xc(%ebp)
+  80194f:	e8 08 f9 ff ff       	call   80125c <fd_close>
+	return r;
+  801954:	83 c4 10             	add    $0x10,%esp
+}
+  801957:	89 d8                	mov    %ebx,%eax
+  801959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195c:	c9                   	leave
+  80195d:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80195e:	83 ec 08             	sub    $0x8,%esp
+  801961:	ff 75 08             	push   0x8(%ebp)
+  801964:	68 00 60 80 00       	push   $0x806000
+  801969:	e8 1b ef ff ff       	call   800889 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80196e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801971:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801976:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801979:	b8 01 00 00 00       	mov    $0x1,%eax
+  80197e:	e8 07 fe ff ff       	call   80178a <fsipc>
+  801983:	89 c3                	mov    %eax,%ebx
+  801985:	83 c4 10             	add    $0x10,%esp
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	78 bb                	js     801947 <open+0x33>
+	return fd2num(fd); 	
+  80198c:	83 ec 0c             	sub    $0xc,%esp
+  80198f:	ff 75 f4             	push   -0xc(%ebp)
+  801992:	e8 89 f7 ff ff       	call   801120 <fd2num>
+  801997:	89 c3                	mov    %eax,%ebx
+  801999:	83 c4 10             	add    $0x10,%esp
+  80199c:	eb b9                	jmp    801957 <open+0x43>
+
+0080199e <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  80199e:	55                   	push   %ebp
+  80199f:	89 e5                	mov    %esp,%ebp
+  8019a1:	53                   	push   %ebx
+  8019a2:	83 ec 1c             	sub    $0x1c,%esp
+  8019a5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ab:	50                   	push   %eax
+  8019ac:	ff 75 08             	push   0x8(%ebp)
+  8019af:	e8 e3 f7 ff ff       	call   801197 <fd_lookup>
+  8019b4:	83 c4 10             	add    $0x10,%esp
+  8019b7:	85 c0                	test   %eax,%eax
+  8019b9:	78 5a                	js     801a15 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8019bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019be:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8019c4:	39 10                	cmp    %edx,(%eax)
+  8019c6:	75 66                	jne    801a2e <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8019c8:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8019cf:	74 49                	je     801a1a <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8019d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  8019dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019df:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  8019e4:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019ea:	6a 07                	push   $0x7
+  8019ec:	68 00 60 80 00       	push   $0x806000
+  8019f1:	6a 09                	push   $0x9
+  8019f3:	ff 35 00 50 80 00    	push   0x805000
+  8019f9:	e8 d0 1d 00 00       	call   8037ce <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8019fe:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a05:	6a 00                	push   $0x0
+  801a07:	53                   	push   %ebx
+  801a08:	ff 75 10             	push   0x10(%ebp)
+  801a0b:	6a 00                	push   $0x0
+  801a0d:	e8 f9 1b 00 00       	call   80360b <ipc_recv_pages>
+  801a12:	83 c4 20             	add    $0x20,%esp
+}
+  801a15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a18:	c9                   	leave
+  801a19:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a1a:	83 ec 0c             	sub    $0xc,%esp
+  801a1d:	6a 02                	push   $0x2
+  801a1f:	e8 13 1e 00 00       	call   803837 <ipc_find_env>
+  801a24:	a3 00 50 80 00       	mov    %eax,0x805000
+  801a29:	83 c4 10             	add    $0x10,%esp
+  801a2c:	eb a3                	jmp    8019d1 <fmap+0x33>
+		return -E_INVAL;
+  801a2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a33:	eb e0                	jmp    801a15 <fmap+0x77>
+
+00801a35 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	53                   	push   %ebx
+  801a39:	83 ec 10             	sub    $0x10,%esp
+  801a3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801a3f:	53                   	push   %ebx
+  801a40:	e8 f8 ed ff ff       	call   80083d <strlen>
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a4d:	7f 25                	jg     801a74 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801a4f:	83 ec 08             	sub    $0x8,%esp
+  801a52:	53                   	push   %ebx
+  801a53:	68 00 60 80 00       	push   $0x806000
+  801a58:	e8 2c ee ff ff       	call   800889 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a62:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a67:	e8 1e fd ff ff       	call   80178a <fsipc>
+  801a6c:	83 c4 10             	add    $0x10,%esp
+}
+  801a6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a72:	c9                   	leave
+  801a73:	c3                   	ret
+		return -E_BAD_PATH;
+  801a74:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801a79:	eb f4                	jmp    801a6f <remove+0x3a>
+
+00801a7b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801a7b:	55                   	push   %ebp
+  801a7c:	89 e5                	mov    %esp,%ebp
+  801a7e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801a81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a86:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a8b:	e8 fa fc ff ff       	call   80178a <fsipc>
+}
+  801a90:	c9                   	leave
+  801a91:	c3                   	ret
+
+00801a92 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a98:	68 a8 3e 80 00       	push   $0x803ea8
+  801a9d:	ff 75 0c             	push   0xc(%ebp)
+  801aa0:	e8 e4 ed ff ff       	call   800889 <strcpy>
+	return 0;
+}
+  801aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+
+00801aac <devsock_close>:
+{
+  801aac:	55                   	push   %ebp
+  801aad:	89 e5                	mov    %esp,%ebp
+  801aaf:	53                   	push   %ebx
+  801ab0:	83 ec 10             	sub    $0x10,%esp
+  801ab3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ab6:	53                   	push   %ebx
+  801ab7:	e8 ba 1d 00 00       	call   803876 <pageref>
+  801abc:	89 c2                	mov    %eax,%edx
+  801abe:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ac6:	83 fa 01             	cmp    $0x1,%edx
+  801ac9:	74 05                	je     801ad0 <devsock_close+0x24>
+}
+  801acb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ace:	c9                   	leave
+  801acf:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ad0:	83 ec 0c             	sub    $0xc,%esp
+  801ad3:	ff 73 0c             	push   0xc(%ebx)
+  801ad6:	e8 b0 05 00 00       	call   80208b <nsipc_close>
+  801adb:	83 c4 10             	add    $0x10,%esp
+  801ade:	eb eb                	jmp    801acb <devsock_close+0x1f>
+
+00801ae0 <devsock_write>:
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	53                   	push   %ebx
+  801ae4:	83 ec 14             	sub    $0x14,%esp
+  801ae7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801aea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801aed:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801af0:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801af3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801af6:	8b 41 08             	mov    0x8(%ecx),%eax
+  801af9:	c1 f8 09             	sar    $0x9,%eax
+  801afc:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801aff:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801b05:	77 13                	ja     801b1a <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801b07:	50                   	push   %eax
+  801b08:	52                   	push   %edx
+  801b09:	53                   	push   %ebx
+  801b0a:	ff 71 0c             	push   0xc(%ecx)
+  801b0d:	e8 5c 06 00 00       	call   80216e <nsipc_send>
+  801b12:	83 c4 10             	add    $0x10,%esp
+}
+  801b15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b18:	c9                   	leave
+  801b19:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801b1a:	50                   	push   %eax
+  801b1b:	6a 01                	push   $0x1
+  801b1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b20:	50                   	push   %eax
+  801b21:	ff 71 0c             	push   0xc(%ecx)
+  801b24:	e8 a6 06 00 00       	call   8021cf <nsipc_sendmsg>
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	eb e7                	jmp    801b15 <devsock_write+0x35>
+
+00801b2e <devsock_read>:
+{
+  801b2e:	55                   	push   %ebp
+  801b2f:	89 e5                	mov    %esp,%ebp
+  801b31:	53                   	push   %ebx
+  801b32:	83 ec 14             	sub    $0x14,%esp
+  801b35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b3b:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801b3e:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801b41:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801b44:	8b 41 08             	mov    0x8(%ecx),%eax
+  801b47:	c1 f8 09             	sar    $0x9,%eax
+  801b4a:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801b4d:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801b53:	77 13                	ja     801b68 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801b55:	50                   	push   %eax
+  801b56:	52                   	push   %edx
+  801b57:	53                   	push   %ebx
+  801b58:	ff 71 0c             	push   0xc(%ecx)
+  801b5b:	e8 9c 05 00 00       	call   8020fc <nsipc_recv>
+  801b60:	83 c4 10             	add    $0x10,%esp
+}
+  801b63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b66:	c9                   	leave
+  801b67:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801b68:	50                   	push   %eax
+  801b69:	6a 01                	push   $0x1
+  801b6b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b6e:	50                   	push   %eax
+  801b6f:	ff 71 0c             	push   0xc(%ecx)
+  801b72:	e8 02 0a 00 00       	call   802579 <nsipc_recvmsg>
+  801b77:	83 c4 10             	add    $0x10,%esp
+  801b7a:	eb e7                	jmp    801b63 <devsock_read+0x35>
+
+00801b7c <fd2sockid>:
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b82:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b85:	52                   	push   %edx
+  801b86:	50                   	push   %eax
+  801b87:	e8 0b f6 ff ff       	call   801197 <fd_lookup>
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	78 10                	js     801ba3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b96:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801b9c:	39 08                	cmp    %ecx,(%eax)
+  801b9e:	75 05                	jne    801ba5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ba0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ba3:	c9                   	leave
+  801ba4:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ba5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801baa:	eb f7                	jmp    801ba3 <fd2sockid+0x27>
+
+00801bac <sock_flags>:
+{
+  801bac:	55                   	push   %ebp
+  801bad:	89 e5                	mov    %esp,%ebp
+  801baf:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801bb2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801bb5:	52                   	push   %edx
+  801bb6:	50                   	push   %eax
+  801bb7:	e8 db f5 ff ff       	call   801197 <fd_lookup>
+  801bbc:	83 c4 10             	add    $0x10,%esp
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 0e                	js     801bd1 <sock_flags+0x25>
+  801bc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc6:	8b 40 08             	mov    0x8(%eax),%eax
+  801bc9:	c1 e8 09             	shr    $0x9,%eax
+  801bcc:	83 e0 08             	and    $0x8,%eax
+}
+  801bcf:	c9                   	leave
+  801bd0:	c3                   	ret
+		return 0;
+  801bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd6:	eb f7                	jmp    801bcf <sock_flags+0x23>
+
+00801bd8 <alloc_sockfd>:
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	56                   	push   %esi
+  801bdc:	53                   	push   %ebx
+  801bdd:	83 ec 1c             	sub    $0x1c,%esp
+  801be0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801be2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be5:	50                   	push   %eax
+  801be6:	e8 5c f5 ff ff       	call   801147 <fd_alloc>
+  801beb:	89 c3                	mov    %eax,%ebx
+  801bed:	83 c4 10             	add    $0x10,%esp
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	78 43                	js     801c37 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801bf4:	83 ec 04             	sub    $0x4,%esp
+  801bf7:	68 07 04 00 00       	push   $0x407
+  801bfc:	ff 75 f4             	push   -0xc(%ebp)
+  801bff:	6a 00                	push   $0x0
+  801c01:	e8 b7 f0 ff ff       	call   800cbd <sys_page_alloc>
+  801c06:	89 c3                	mov    %eax,%ebx
+  801c08:	83 c4 10             	add    $0x10,%esp
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	78 28                	js     801c37 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c12:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801c18:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c1d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801c24:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801c27:	83 ec 0c             	sub    $0xc,%esp
+  801c2a:	50                   	push   %eax
+  801c2b:	e8 f0 f4 ff ff       	call   801120 <fd2num>
+  801c30:	89 c3                	mov    %eax,%ebx
+  801c32:	83 c4 10             	add    $0x10,%esp
+  801c35:	eb 0c                	jmp    801c43 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c37:	83 ec 0c             	sub    $0xc,%esp
+  801c3a:	56                   	push   %esi
+  801c3b:	e8 4b 04 00 00       	call   80208b <nsipc_close>
+		return r;
+  801c40:	83 c4 10             	add    $0x10,%esp
+}
+  801c43:	89 d8                	mov    %ebx,%eax
+  801c45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c48:	5b                   	pop    %ebx
+  801c49:	5e                   	pop    %esi
+  801c4a:	5d                   	pop    %ebp
+  801c4b:	c3                   	ret
+
+00801c4c <accept>:
+{
+  801c4c:	55                   	push   %ebp
+  801c4d:	89 e5                	mov    %esp,%ebp
+  801c4f:	56                   	push   %esi
+  801c50:	53                   	push   %ebx
+  801c51:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801c54:	89 f0                	mov    %esi,%eax
+  801c56:	e8 21 ff ff ff       	call   801b7c <fd2sockid>
+  801c5b:	89 c3                	mov    %eax,%ebx
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	78 24                	js     801c85 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801c61:	89 f0                	mov    %esi,%eax
+  801c63:	e8 44 ff ff ff       	call   801bac <sock_flags>
+  801c68:	50                   	push   %eax
+  801c69:	ff 75 10             	push   0x10(%ebp)
+  801c6c:	ff 75 0c             	push   0xc(%ebp)
+  801c6f:	53                   	push   %ebx
+  801c70:	e8 6b 03 00 00       	call   801fe0 <nsipc_accept>
+  801c75:	89 c3                	mov    %eax,%ebx
+  801c77:	83 c4 10             	add    $0x10,%esp
+  801c7a:	85 c0                	test   %eax,%eax
+  801c7c:	78 07                	js     801c85 <accept+0x39>
+	return alloc_sockfd(r);
+  801c7e:	e8 55 ff ff ff       	call   801bd8 <alloc_sockfd>
+  801c83:	89 c3                	mov    %eax,%ebx
+}
+  801c85:	89 d8                	mov    %ebx,%eax
+  801c87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c8a:	5b                   	pop    %ebx
+  801c8b:	5e                   	pop    %esi
+  801c8c:	5d                   	pop    %ebp
+  801c8d:	c3                   	ret
+
+00801c8e <bind>:
+{
+  801c8e:	55                   	push   %ebp
+  801c8f:	89 e5                	mov    %esp,%ebp
+  801c91:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c97:	e8 e0 fe ff ff       	call   801b7c <fd2sockid>
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 12                	js     801cb2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801ca0:	83 ec 04             	sub    $0x4,%esp
+  801ca3:	ff 75 10             	push   0x10(%ebp)
+  801ca6:	ff 75 0c             	push   0xc(%ebp)
+  801ca9:	50                   	push   %eax
+  801caa:	e8 85 03 00 00       	call   802034 <nsipc_bind>
+  801caf:	83 c4 10             	add    $0x10,%esp
+}
+  801cb2:	c9                   	leave
+  801cb3:	c3                   	ret
+
+00801cb4 <shutdown>:
+{
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbd:	e8 ba fe ff ff       	call   801b7c <fd2sockid>
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 0f                	js     801cd5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801cc6:	83 ec 08             	sub    $0x8,%esp
+  801cc9:	ff 75 0c             	push   0xc(%ebp)
+  801ccc:	50                   	push   %eax
+  801ccd:	e8 97 03 00 00       	call   802069 <nsipc_shutdown>
+  801cd2:	83 c4 10             	add    $0x10,%esp
+}
+  801cd5:	c9                   	leave
+  801cd6:	c3                   	ret
+
+00801cd7 <connect>:
+{
+  801cd7:	55                   	push   %ebp
+  801cd8:	89 e5                	mov    %esp,%ebp
+  801cda:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce0:	e8 97 fe ff ff       	call   801b7c <fd2sockid>
+  801ce5:	85 c0                	test   %eax,%eax
+  801ce7:	78 12                	js     801cfb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ce9:	83 ec 04             	sub    $0x4,%esp
+  801cec:	ff 75 10             	push   0x10(%ebp)
+  801cef:	ff 75 0c             	push   0xc(%ebp)
+  801cf2:	50                   	push   %eax
+  801cf3:	e8 ad 03 00 00       	call   8020a5 <nsipc_connect>
+  801cf8:	83 c4 10             	add    $0x10,%esp
+}
+  801cfb:	c9                   	leave
+  801cfc:	c3                   	ret
+
+00801cfd <listen>:
+{
+  801cfd:	55                   	push   %ebp
+  801cfe:	89 e5                	mov    %esp,%ebp
+  801d00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d06:	e8 71 fe ff ff       	call   801b7c <fd2sockid>
+  801d0b:	85 c0                	test   %eax,%eax
+  801d0d:	78 0f                	js     801d1e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	ff 75 0c             	push   0xc(%ebp)
+  801d15:	50                   	push   %eax
+  801d16:	e8 bf 03 00 00       	call   8020da <nsipc_listen>
+  801d1b:	83 c4 10             	add    $0x10,%esp
+}
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+
+00801d20 <sendmsg>:
+{
+  801d20:	55                   	push   %ebp
+  801d21:	89 e5                	mov    %esp,%ebp
+  801d23:	57                   	push   %edi
+  801d24:	56                   	push   %esi
+  801d25:	53                   	push   %ebx
+  801d26:	83 ec 0c             	sub    $0xc,%esp
+  801d29:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d2c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801d2f:	89 f0                	mov    %esi,%eax
+  801d31:	e8 46 fe ff ff       	call   801b7c <fd2sockid>
+  801d36:	89 c3                	mov    %eax,%ebx
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	78 1c                	js     801d58 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801d3c:	89 f0                	mov    %esi,%eax
+  801d3e:	e8 69 fe ff ff       	call   801bac <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801d43:	0b 45 10             	or     0x10(%ebp),%eax
+  801d46:	50                   	push   %eax
+  801d47:	ff 77 0c             	push   0xc(%edi)
+  801d4a:	ff 77 08             	push   0x8(%edi)
+  801d4d:	53                   	push   %ebx
+  801d4e:	e8 7c 04 00 00       	call   8021cf <nsipc_sendmsg>
+  801d53:	89 c3                	mov    %eax,%ebx
+  801d55:	83 c4 10             	add    $0x10,%esp
+}
+  801d58:	89 d8                	mov    %ebx,%eax
+  801d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5d:	5b                   	pop    %ebx
+  801d5e:	5e                   	pop    %esi
+  801d5f:	5f                   	pop    %edi
+  801d60:	5d                   	pop    %ebp
+  801d61:	c3                   	ret
+
+00801d62 <recvmsg>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	57                   	push   %edi
+  801d66:	56                   	push   %esi
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 0c             	sub    $0xc,%esp
+  801d6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d6e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d71:	89 f8                	mov    %edi,%eax
+  801d73:	e8 04 fe ff ff       	call   801b7c <fd2sockid>
+  801d78:	89 c3                	mov    %eax,%ebx
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 2a                	js     801da8 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801d7e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801d85:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801d8c:	89 f8                	mov    %edi,%eax
+  801d8e:	e8 19 fe ff ff       	call   801bac <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801d93:	0b 45 10             	or     0x10(%ebp),%eax
+  801d96:	50                   	push   %eax
+  801d97:	ff 76 0c             	push   0xc(%esi)
+  801d9a:	ff 76 08             	push   0x8(%esi)
+  801d9d:	53                   	push   %ebx
+  801d9e:	e8 d6 07 00 00       	call   802579 <nsipc_recvmsg>
+  801da3:	89 c3                	mov    %eax,%ebx
+  801da5:	83 c4 10             	add    $0x10,%esp
+}
+  801da8:	89 d8                	mov    %ebx,%eax
+  801daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dad:	5b                   	pop    %ebx
+  801dae:	5e                   	pop    %esi
+  801daf:	5f                   	pop    %edi
+  801db0:	5d                   	pop    %ebp
+  801db1:	c3                   	ret
+
+00801db2 <sendfile>:
+{
+  801db2:	55                   	push   %ebp
+  801db3:	89 e5                	mov    %esp,%ebp
+  801db5:	56                   	push   %esi
+  801db6:	53                   	push   %ebx
+  801db7:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801dba:	89 f0                	mov    %esi,%eax
+  801dbc:	e8 bb fd ff ff       	call   801b7c <fd2sockid>
+  801dc1:	89 c3                	mov    %eax,%ebx
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	78 1f                	js     801de6 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801dc7:	89 f0                	mov    %esi,%eax
+  801dc9:	e8 de fd ff ff       	call   801bac <sock_flags>
+  801dce:	83 ec 0c             	sub    $0xc,%esp
+  801dd1:	50                   	push   %eax
+  801dd2:	ff 75 14             	push   0x14(%ebp)
+  801dd5:	ff 75 10             	push   0x10(%ebp)
+  801dd8:	ff 75 0c             	push   0xc(%ebp)
+  801ddb:	53                   	push   %ebx
+  801ddc:	e8 64 06 00 00       	call   802445 <nsipc_sendfile>
+  801de1:	89 c3                	mov    %eax,%ebx
+  801de3:	83 c4 20             	add    $0x20,%esp
+}
+  801de6:	89 d8                	mov    %ebx,%eax
+  801de8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801deb:	5b                   	pop    %ebx
+  801dec:	5e                   	pop    %esi
+  801ded:	5d                   	pop    %ebp
+  801dee:	c3                   	ret
+
+00801def <evctl>:
+{
+  801def:	55                   	push   %ebp
+  801df0:	89 e5                	mov    %esp,%ebp
+  801df2:	53                   	push   %ebx
+  801df3:	83 ec 04             	sub    $0x4,%esp
+  801df6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801df9:	89 d8                	mov    %ebx,%eax
+  801dfb:	e8 7c fd ff ff       	call   801b7c <fd2sockid>
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	78 10                	js     801e14 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801e04:	83 ec 04             	sub    $0x4,%esp
+  801e07:	53                   	push   %ebx
+  801e08:	ff 75 0c             	push   0xc(%ebp)
+  801e0b:	50                   	push   %eax
+  801e0c:	e8 d2 0b 00 00       	call   8029e3 <nsipc_evctl>
+  801e11:	83 c4 10             	add    $0x10,%esp
+}
+  801e14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e17:	c9                   	leave
+  801e18:	c3                   	ret
+
+00801e19 <evwait>:
+{
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801e1f:	ff 75 10             	push   0x10(%ebp)
+  801e22:	ff 75 0c             	push   0xc(%ebp)
+  801e25:	ff 75 08             	push   0x8(%ebp)
+  801e28:	e8 e0 0b 00 00       	call   802a0d <nsipc_evwait>
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e35:	ff 75 10             	push   0x10(%ebp)
+  801e38:	ff 75 0c             	push   0xc(%ebp)
+  801e3b:	ff 75 08             	push   0x8(%ebp)
+  801e3e:	e8 31 0c 00 00       	call   802a74 <nsipc_socket>
+  801e43:	83 c4 10             	add    $0x10,%esp
+  801e46:	85 c0                	test   %eax,%eax
+  801e48:	78 05                	js     801e4f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e4a:	e8 89 fd ff ff       	call   801bd8 <alloc_sockfd>
+}
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	53                   	push   %ebx
+  801e55:	83 ec 04             	sub    $0x4,%esp
+  801e58:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801e5a:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801e61:	74 26                	je     801e89 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e63:	6a 07                	push   $0x7
+  801e65:	68 00 70 80 00       	push   $0x807000
+  801e6a:	53                   	push   %ebx
+  801e6b:	ff 35 24 53 80 00    	push   0x805324
+  801e71:	e8 58 19 00 00       	call   8037ce <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e76:	83 c4 0c             	add    $0xc,%esp
+  801e79:	6a 00                	push   $0x0
+  801e7b:	6a 00                	push   $0x0
+  801e7d:	6a 00                	push   $0x0
+  801e7f:	e8 ba 16 00 00       	call   80353e <ipc_recv>
+}
+  801e84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e87:	c9                   	leave
+  801e88:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e89:	83 ec 0c             	sub    $0xc,%esp
+  801e8c:	6a 03                	push   $0x3
+  801e8e:	e8 a4 19 00 00       	call   803837 <ipc_find_env>
+  801e93:	a3 24 53 80 00       	mov    %eax,0x805324
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	eb c6                	jmp    801e63 <nsipc+0x12>
+
+00801e9d <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	56                   	push   %esi
+  801ea1:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801ea2:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  801ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801ead:	85 f6                	test   %esi,%esi
+  801eaf:	75 33                	jne    801ee4 <nsbulk_map+0x47>
+  801eb1:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801eb6:	83 ec 04             	sub    $0x4,%esp
+  801eb9:	6a 07                	push   $0x7
+  801ebb:	53                   	push   %ebx
+  801ebc:	6a 00                	push   $0x0
+  801ebe:	e8 fa ed ff ff       	call   800cbd <sys_page_alloc>
+  801ec3:	83 c4 10             	add    $0x10,%esp
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	78 1a                	js     801ee4 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801eca:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ed0:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801ed6:	75 de                	jne    801eb6 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801ed8:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  801edf:	00 00 00 
+	return 0;
+  801ee2:	89 f0                	mov    %esi,%eax
+}
+  801ee4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee7:	5b                   	pop    %ebx
+  801ee8:	5e                   	pop    %esi
+  801ee9:	5d                   	pop    %ebp
+  801eea:	c3                   	ret
+
+00801eeb <nsbulk_own>:
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	57                   	push   %edi
+  801eef:	56                   	push   %esi
+  801ef0:	53                   	push   %ebx
+  801ef1:	83 ec 0c             	sub    $0xc,%esp
+  801ef4:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801ef6:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801ef9:	85 d2                	test   %edx,%edx
+  801efb:	7f 0e                	jg     801f0b <nsbulk_own+0x20>
+	return 0;
+  801efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f02:	eb 47                	jmp    801f4b <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801f04:	83 c3 01             	add    $0x1,%ebx
+  801f07:	39 fb                	cmp    %edi,%ebx
+  801f09:	7d 3b                	jge    801f46 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801f0b:	be 01 00 00 00       	mov    $0x1,%esi
+  801f10:	89 d9                	mov    %ebx,%ecx
+  801f12:	d3 e6                	shl    %cl,%esi
+  801f14:	89 f0                	mov    %esi,%eax
+  801f16:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  801f1c:	74 e6                	je     801f04 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801f1e:	83 ec 04             	sub    $0x4,%esp
+  801f21:	6a 07                	push   $0x7
+  801f23:	89 d8                	mov    %ebx,%eax
+  801f25:	c1 e0 0c             	shl    $0xc,%eax
+  801f28:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801f2d:	50                   	push   %eax
+  801f2e:	6a 00                	push   $0x0
+  801f30:	e8 88 ed ff ff       	call   800cbd <sys_page_alloc>
+  801f35:	83 c4 10             	add    $0x10,%esp
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	78 0f                	js     801f4b <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801f3c:	f7 d6                	not    %esi
+  801f3e:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801f44:	eb be                	jmp    801f04 <nsbulk_own+0x19>
+	return 0;
+  801f46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f4e:	5b                   	pop    %ebx
+  801f4f:	5e                   	pop    %esi
+  801f50:	5f                   	pop    %edi
+  801f51:	5d                   	pop    %ebp
+  801f52:	c3                   	ret
+
+00801f53 <nsipc_bulk>:
+{
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	57                   	push   %edi
+  801f57:	56                   	push   %esi
+  801f58:	53                   	push   %ebx
+  801f59:	83 ec 1c             	sub    $0x1c,%esp
+  801f5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f5f:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801f61:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801f67:	c1 fb 0c             	sar    $0xc,%ebx
+  801f6a:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  801f6d:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801f74:	74 56                	je     801fcc <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801f76:	85 ff                	test   %edi,%edi
+  801f78:	7e 24                	jle    801f9e <nsipc_bulk+0x4b>
+  801f7a:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801f80:	74 1c                	je     801f9e <nsipc_bulk+0x4b>
+  801f82:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801f88:	c1 e3 0c             	shl    $0xc,%ebx
+  801f8b:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801f90:	0f b6 10             	movzbl (%eax),%edx
+  801f93:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801f95:	05 00 10 00 00       	add    $0x1000,%eax
+  801f9a:	39 d8                	cmp    %ebx,%eax
+  801f9c:	75 f2                	jne    801f90 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801f9e:	83 ec 0c             	sub    $0xc,%esp
+  801fa1:	56                   	push   %esi
+  801fa2:	57                   	push   %edi
+  801fa3:	68 00 00 00 e0       	push   $0xe0000000
+  801fa8:	ff 75 e4             	push   -0x1c(%ebp)
+  801fab:	ff 35 24 53 80 00    	push   0x805324
+  801fb1:	e8 4c 18 00 00       	call   803802 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801fb6:	83 c4 1c             	add    $0x1c,%esp
+  801fb9:	6a 00                	push   $0x0
+  801fbb:	6a 00                	push   $0x0
+  801fbd:	6a 00                	push   $0x0
+  801fbf:	e8 7a 15 00 00       	call   80353e <ipc_recv>
+}
+  801fc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc7:	5b                   	pop    %ebx
+  801fc8:	5e                   	pop    %esi
+  801fc9:	5f                   	pop    %edi
+  801fca:	5d                   	pop    %ebp
+  801fcb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801fcc:	83 ec 0c             	sub    $0xc,%esp
+  801fcf:	6a 03                	push   $0x3
+  801fd1:	e8 61 18 00 00       	call   803837 <ipc_find_env>
+  801fd6:	a3 24 53 80 00       	mov    %eax,0x805324
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	eb 96                	jmp    801f76 <nsipc_bulk+0x23>
+
+00801fe0 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	53                   	push   %ebx
+  801fe4:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801fe7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fea:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  801fef:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff2:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ff7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ffc:	e8 50 fe ff ff       	call   801e51 <nsipc>
+  802001:	89 c3                	mov    %eax,%ebx
+  802003:	85 c0                	test   %eax,%eax
+  802005:	79 07                	jns    80200e <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802007:	89 d8                	mov    %ebx,%eax
+  802009:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80200c:	c9                   	leave
+  80200d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80200e:	83 ec 04             	sub    $0x4,%esp
+  802011:	ff 35 10 70 80 00    	push   0x807010
+  802017:	68 00 70 80 00       	push   $0x807000
+  80201c:	ff 75 0c             	push   0xc(%ebp)
+  80201f:	e8 15 ea ff ff       	call   800a39 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802024:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80202a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80202d:	89 10                	mov    %edx,(%eax)
+  80202f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802032:	eb d3                	jmp    802007 <nsipc_accept+0x27>
+
+00802034 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802034:	55                   	push   %ebp
+  802035:	89 e5                	mov    %esp,%ebp
+  802037:	53                   	push   %ebx
+  802038:	83 ec 08             	sub    $0x8,%esp
+  80203b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80203e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802041:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802046:	53                   	push   %ebx
+  802047:	ff 75 0c             	push   0xc(%ebp)
+  80204a:	68 04 70 80 00       	push   $0x807004
+  80204f:	e8 e5 e9 ff ff       	call   800a39 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802054:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80205a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80205f:	e8 ed fd ff ff       	call   801e51 <nsipc>
+}
+  802064:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802067:	c9                   	leave
+  802068:	c3                   	ret
+
+00802069 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802069:	55                   	push   %ebp
+  80206a:	89 e5                	mov    %esp,%ebp
+  80206c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80206f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802072:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802077:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80207a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80207f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802084:	e8 c8 fd ff ff       	call   801e51 <nsipc>
+}
+  802089:	c9                   	leave
+  80208a:	c3                   	ret
+
+0080208b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80208b:	55                   	push   %ebp
+  80208c:	89 e5                	mov    %esp,%ebp
+  80208e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802091:	8b 45 08             	mov    0x8(%ebp),%eax
+  802094:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802099:	b8 04 00 00 00       	mov    $0x4,%eax
+  80209e:	e8 ae fd ff ff       	call   801e51 <nsipc>
+}
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+
+008020a5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	53                   	push   %ebx
+  8020a9:	83 ec 08             	sub    $0x8,%esp
+  8020ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8020af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8020b7:	53                   	push   %ebx
+  8020b8:	ff 75 0c             	push   0xc(%ebp)
+  8020bb:	68 04 70 80 00       	push   $0x807004
+  8020c0:	e8 74 e9 ff ff       	call   800a39 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8020c5:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8020cb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020d0:	e8 7c fd ff ff       	call   801e51 <nsipc>
+}
+  8020d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+
+008020da <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8020da:	55                   	push   %ebp
+  8020db:	89 e5                	mov    %esp,%ebp
+  8020dd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8020e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8020e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020eb:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8020f0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020f5:	e8 57 fd ff ff       	call   801e51 <nsipc>
+}
+  8020fa:	c9                   	leave
+  8020fb:	c3                   	ret
+
+008020fc <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8020fc:	55                   	push   %ebp
+  8020fd:	89 e5                	mov    %esp,%ebp
+  8020ff:	56                   	push   %esi
+  802100:	53                   	push   %ebx
+  802101:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802104:	8b 45 08             	mov    0x8(%ebp),%eax
+  802107:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80210c:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802112:	8b 45 14             	mov    0x14(%ebp),%eax
+  802115:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80211a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80211f:	e8 2d fd ff ff       	call   801e51 <nsipc>
+  802124:	89 c3                	mov    %eax,%ebx
+  802126:	85 c0                	test   %eax,%eax
+  802128:	78 22                	js     80214c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80212a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80212f:	39 c6                	cmp    %eax,%esi
+  802131:	0f 4e c6             	cmovle %esi,%eax
+  802134:	39 c3                	cmp    %eax,%ebx
+  802136:	7f 1d                	jg     802155 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802138:	83 ec 04             	sub    $0x4,%esp
+  80213b:	53                   	push   %ebx
+  80213c:	68 00 70 80 00       	push   $0x807000
+  802141:	ff 75 0c             	push   0xc(%ebp)
+  802144:	e8 f0 e8 ff ff       	call   800a39 <memmove>
+  802149:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80214c:	89 d8                	mov    %ebx,%eax
+  80214e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802151:	5b                   	pop    %ebx
+  802152:	5e                   	pop    %esi
+  802153:	5d                   	pop    %ebp
+  802154:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802155:	68 b4 3e 80 00       	push   $0x803eb4
+  80215a:	68 c9 3e 80 00       	push   $0x803ec9
+  80215f:	68 b2 00 00 00       	push   $0xb2
+  802164:	68 de 3e 80 00       	push   $0x803ede
+  802169:	e8 8a 13 00 00       	call   8034f8 <_panic>
+
+0080216e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80216e:	55                   	push   %ebp
+  80216f:	89 e5                	mov    %esp,%ebp
+  802171:	53                   	push   %ebx
+  802172:	83 ec 04             	sub    $0x4,%esp
+  802175:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802178:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217b:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802180:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802186:	7f 2e                	jg     8021b6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802188:	83 ec 04             	sub    $0x4,%esp
+  80218b:	53                   	push   %ebx
+  80218c:	ff 75 0c             	push   0xc(%ebp)
+  80218f:	68 0c 70 80 00       	push   $0x80700c
+  802194:	e8 a0 e8 ff ff       	call   800a39 <memmove>
+	nsipcbuf.send.req_size = size;
+  802199:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80219f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021a2:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8021a7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021ac:	e8 a0 fc ff ff       	call   801e51 <nsipc>
+}
+  8021b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b4:	c9                   	leave
+  8021b5:	c3                   	ret
+	assert(size < 1600);
+  8021b6:	68 ea 3e 80 00       	push   $0x803eea
+  8021bb:	68 c9 3e 80 00       	push   $0x803ec9
+  8021c0:	68 bd 00 00 00       	push   $0xbd
+  8021c5:	68 de 3e 80 00       	push   $0x803ede
+  8021ca:	e8 29 13 00 00       	call   8034f8 <_panic>
+
+008021cf <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	57                   	push   %edi
+  8021d3:	56                   	push   %esi
+  8021d4:	53                   	push   %ebx
+  8021d5:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8021d8:	e8 c0 fc ff ff       	call   801e9d <nsbulk_map>
+  8021dd:	85 c0                	test   %eax,%eax
+  8021df:	78 55                	js     802236 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8021e1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8021e8:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8021ef:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8021f6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8021f9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8021fc:	0f 8d 24 02 00 00    	jge    802426 <nsipc_sendmsg+0x257>
+  802202:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802205:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802208:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80220b:	89 d8                	mov    %ebx,%eax
+  80220d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802212:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802214:	83 ec 0c             	sub    $0xc,%esp
+  802217:	68 20 50 80 00       	push   $0x805020
+  80221c:	e8 5a 0f 00 00       	call   80317b <pgbatch_init>
+  802221:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802224:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802226:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802229:	e9 82 00 00 00       	jmp    8022b0 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80222e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802231:	85 db                	test   %ebx,%ebx
+  802233:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802239:	5b                   	pop    %ebx
+  80223a:	5e                   	pop    %esi
+  80223b:	5f                   	pop    %edi
+  80223c:	5d                   	pop    %ebp
+  80223d:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80223e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802243:	29 c8                	sub    %ecx,%eax
+  802245:	39 d0                	cmp    %edx,%eax
+  802247:	0f 46 d0             	cmovbe %eax,%edx
+  80224a:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80224c:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802252:	85 ff                	test   %edi,%edi
+  802254:	0f 49 c7             	cmovns %edi,%eax
+  802257:	c1 f8 0c             	sar    $0xc,%eax
+  80225a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80225f:	e8 87 fc ff ff       	call   801eeb <nsbulk_own>
+  802264:	85 c0                	test   %eax,%eax
+  802266:	0f 88 17 01 00 00    	js     802383 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80226c:	83 ec 04             	sub    $0x4,%esp
+  80226f:	56                   	push   %esi
+  802270:	ff 75 e0             	push   -0x20(%ebp)
+  802273:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802276:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80227b:	50                   	push   %eax
+  80227c:	e8 b8 e7 ff ff       	call   800a39 <memmove>
+  802281:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802284:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802287:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80228a:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80228d:	0f 84 fd 00 00 00    	je     802390 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802293:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802296:	01 f7                	add    %esi,%edi
+  802298:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80229b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80229e:	0f 8d 01 01 00 00    	jge    8023a5 <nsipc_sendmsg+0x1d6>
+  8022a4:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8022aa:	0f 8f f0 00 00 00    	jg     8023a0 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8022b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b3:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8022b6:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8022b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022bc:	89 c2                	mov    %eax,%edx
+  8022be:	03 13                	add    (%ebx),%edx
+  8022c0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8022c3:	8b 73 04             	mov    0x4(%ebx),%esi
+  8022c6:	29 c6                	sub    %eax,%esi
+  8022c8:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8022cd:	29 f9                	sub    %edi,%ecx
+  8022cf:	39 ce                	cmp    %ecx,%esi
+  8022d1:	89 ca                	mov    %ecx,%edx
+  8022d3:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8022d6:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8022d9:	89 f9                	mov    %edi,%ecx
+  8022db:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8022e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8022e4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022e9:	09 c8                	or     %ecx,%eax
+  8022eb:	0f 85 4d ff ff ff    	jne    80223e <nsipc_sendmsg+0x6f>
+  8022f1:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8022f7:	0f 86 41 ff ff ff    	jbe    80223e <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8022fd:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802303:	85 ff                	test   %edi,%edi
+  802305:	0f 49 c7             	cmovns %edi,%eax
+  802308:	c1 f8 0c             	sar    $0xc,%eax
+  80230b:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80230d:	89 d1                	mov    %edx,%ecx
+  80230f:	c1 e9 0c             	shr    $0xc,%ecx
+  802312:	01 c8                	add    %ecx,%eax
+  802314:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802317:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80231a:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80231c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80231f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802324:	29 c8                	sub    %ecx,%eax
+  802326:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802329:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80232c:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80232e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802333:	89 f9                	mov    %edi,%ecx
+  802335:	d3 e0                	shl    %cl,%eax
+  802337:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80233d:	83 ec 08             	sub    $0x8,%esp
+  802340:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802342:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802345:	50                   	push   %eax
+  802346:	6a 00                	push   $0x0
+  802348:	56                   	push   %esi
+  802349:	6a 00                	push   $0x0
+  80234b:	68 20 50 80 00       	push   $0x805020
+  802350:	e8 e4 0e 00 00       	call   803239 <pgbatch_map>
+  802355:	83 c4 20             	add    $0x20,%esp
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	0f 88 ce fe ff ff    	js     80222e <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802360:	83 c7 01             	add    $0x1,%edi
+  802363:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802369:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80236c:	39 c7                	cmp    %eax,%edi
+  80236e:	75 be                	jne    80232e <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802370:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802373:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802376:	89 d6                	mov    %edx,%esi
+  802378:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80237e:	e9 01 ff ff ff       	jmp    802284 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802383:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802386:	85 db                	test   %ebx,%ebx
+  802388:	0f 45 c3             	cmovne %ebx,%eax
+  80238b:	e9 a6 fe ff ff       	jmp    802236 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802390:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802394:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80239b:	e9 f3 fe ff ff       	jmp    802293 <nsipc_sendmsg+0xc4>
+  8023a0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8023a3:	eb 03                	jmp    8023a8 <nsipc_sendmsg+0x1d9>
+  8023a5:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8023a8:	83 ec 0c             	sub    $0xc,%esp
+  8023ab:	68 20 50 80 00       	push   $0x805020
+  8023b0:	e8 d4 0d 00 00       	call   803189 <pgbatch_flush>
+  8023b5:	83 c4 10             	add    $0x10,%esp
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	78 50                	js     80240c <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8023bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bf:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8023c4:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8023ca:	89 fb                	mov    %edi,%ebx
+  8023cc:	29 f3                	sub    %esi,%ebx
+  8023ce:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8023d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023d7:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8023dc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8023e1:	89 fa                	mov    %edi,%edx
+  8023e3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8023e8:	e8 66 fb ff ff       	call   801f53 <nsipc_bulk>
+  8023ed:	85 c0                	test   %eax,%eax
+  8023ef:	78 28                	js     802419 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8023f1:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8023f4:	39 c3                	cmp    %eax,%ebx
+  8023f6:	75 0c                	jne    802404 <nsipc_sendmsg+0x235>
+  8023f8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023fb:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8023fe:	0f 8f f2 fd ff ff    	jg     8021f6 <nsipc_sendmsg+0x27>
+		sent += r;
+  802404:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802407:	e9 2a fe ff ff       	jmp    802236 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80240c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80240f:	85 db                	test   %ebx,%ebx
+  802411:	0f 45 c3             	cmovne %ebx,%eax
+  802414:	e9 1d fe ff ff       	jmp    802236 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802419:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80241c:	85 db                	test   %ebx,%ebx
+  80241e:	0f 45 c3             	cmovne %ebx,%eax
+  802421:	e9 10 fe ff ff       	jmp    802236 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802426:	83 ec 0c             	sub    $0xc,%esp
+  802429:	68 20 50 80 00       	push   $0x805020
+  80242e:	e8 48 0d 00 00       	call   80317b <pgbatch_init>
+  802433:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802436:	be 00 00 00 00       	mov    $0x0,%esi
+  80243b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802440:	e9 63 ff ff ff       	jmp    8023a8 <nsipc_sendmsg+0x1d9>
+
+00802445 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	57                   	push   %edi
+  802449:	56                   	push   %esi
+  80244a:	53                   	push   %ebx
+  80244b:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80244e:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  802455:	0f 84 c8 00 00 00    	je     802523 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80245b:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  802462:	0f 84 e4 00 00 00    	je     80254c <nsipc_sendfile+0x107>
+{
+  802468:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80246d:	89 fb                	mov    %edi,%ebx
+  80246f:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802472:	0f 83 f0 00 00 00    	jae    802568 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802478:	89 fa                	mov    %edi,%edx
+  80247a:	03 55 10             	add    0x10(%ebp),%edx
+  80247d:	89 d0                	mov    %edx,%eax
+  80247f:	c1 f8 1f             	sar    $0x1f,%eax
+  802482:	c1 e8 14             	shr    $0x14,%eax
+  802485:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802488:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80248e:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802490:	6a 10                	push   $0x10
+  802492:	68 00 20 01 e0       	push   $0xe0012000
+  802497:	52                   	push   %edx
+  802498:	ff 75 0c             	push   0xc(%ebp)
+  80249b:	e8 fe f4 ff ff       	call   80199e <fmap>
+  8024a0:	83 c4 10             	add    $0x10,%esp
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	0f 8e b8 00 00 00    	jle    802563 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8024ab:	39 c6                	cmp    %eax,%esi
+  8024ad:	0f 8d b5 00 00 00    	jge    802568 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8024b3:	29 f0                	sub    %esi,%eax
+  8024b5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8024b8:	29 da                	sub    %ebx,%edx
+  8024ba:	39 d0                	cmp    %edx,%eax
+  8024bc:	89 d3                	mov    %edx,%ebx
+  8024be:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8024c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c4:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8024c9:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8024cf:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8024d5:	8b 45 18             	mov    0x18(%ebp),%eax
+  8024d8:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8024dd:	83 ec 0c             	sub    $0xc,%esp
+  8024e0:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8024e2:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8024e9:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8024ec:	83 c0 01             	add    $0x1,%eax
+  8024ef:	50                   	push   %eax
+  8024f0:	68 00 10 01 e0       	push   $0xe0011000
+  8024f5:	6a 11                	push   $0x11
+  8024f7:	ff 35 24 53 80 00    	push   0x805324
+  8024fd:	e8 00 13 00 00       	call   803802 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802502:	83 c4 1c             	add    $0x1c,%esp
+  802505:	6a 00                	push   $0x0
+  802507:	6a 00                	push   $0x0
+  802509:	6a 00                	push   $0x0
+  80250b:	e8 2e 10 00 00       	call   80353e <ipc_recv>
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 5b                	js     802572 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802517:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802519:	39 c3                	cmp    %eax,%ebx
+  80251b:	0f 8e 4c ff ff ff    	jle    80246d <nsipc_sendfile+0x28>
+  802521:	eb 45                	jmp    802568 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802523:	83 ec 04             	sub    $0x4,%esp
+  802526:	6a 07                	push   $0x7
+  802528:	68 00 10 01 e0       	push   $0xe0011000
+  80252d:	6a 00                	push   $0x0
+  80252f:	e8 89 e7 ff ff       	call   800cbd <sys_page_alloc>
+  802534:	89 c7                	mov    %eax,%edi
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	78 2b                	js     802568 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80253d:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  802544:	00 00 00 
+  802547:	e9 0f ff ff ff       	jmp    80245b <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80254c:	83 ec 0c             	sub    $0xc,%esp
+  80254f:	6a 03                	push   $0x3
+  802551:	e8 e1 12 00 00       	call   803837 <ipc_find_env>
+  802556:	a3 24 53 80 00       	mov    %eax,0x805324
+  80255b:	83 c4 10             	add    $0x10,%esp
+  80255e:	e9 05 ff ff ff       	jmp    802468 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802563:	85 ff                	test   %edi,%edi
+  802565:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802568:	89 f8                	mov    %edi,%eax
+  80256a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802572:	85 ff                	test   %edi,%edi
+  802574:	0f 44 f8             	cmove  %eax,%edi
+  802577:	eb ef                	jmp    802568 <nsipc_sendfile+0x123>
+
+00802579 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802579:	55                   	push   %ebp
+  80257a:	89 e5                	mov    %esp,%ebp
+  80257c:	57                   	push   %edi
+  80257d:	56                   	push   %esi
+  80257e:	53                   	push   %ebx
+  80257f:	83 ec 1c             	sub    $0x1c,%esp
+  802582:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802585:	e8 13 f9 ff ff       	call   801e9d <nsbulk_map>
+  80258a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	0f 88 ba 00 00 00    	js     80264f <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802595:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802599:	0f 8e bb 00 00 00    	jle    80265a <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80259f:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8025a4:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8025a9:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8025ae:	89 f8                	mov    %edi,%eax
+  8025b0:	29 f0                	sub    %esi,%eax
+  8025b2:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8025b6:	39 c8                	cmp    %ecx,%eax
+  8025b8:	0f 47 c1             	cmova  %ecx,%eax
+  8025bb:	01 f0                	add    %esi,%eax
+  8025bd:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8025bf:	83 c2 01             	add    $0x1,%edx
+  8025c2:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8025c5:	7e 07                	jle    8025ce <nsipc_recvmsg+0x55>
+  8025c7:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8025cc:	7e e0                	jle    8025ae <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8025ce:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8025d4:	c1 fa 0c             	sar    $0xc,%edx
+  8025d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025dc:	e8 0a f9 ff ff       	call   801eeb <nsbulk_own>
+  8025e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025e4:	85 c0                	test   %eax,%eax
+  8025e6:	78 67                	js     80264f <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8025e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025eb:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8025f0:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8025f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025f9:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8025fe:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802603:	89 f2                	mov    %esi,%edx
+  802605:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80260a:	e8 44 f9 ff ff       	call   801f53 <nsipc_bulk>
+  80260f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802612:	85 c0                	test   %eax,%eax
+  802614:	78 39                	js     80264f <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802616:	39 f0                	cmp    %esi,%eax
+  802618:	7f 4a                	jg     802664 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80261a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80261f:	85 c0                	test   %eax,%eax
+  802621:	7e 2c                	jle    80264f <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802623:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802626:	29 fe                	sub    %edi,%esi
+  802628:	8b 43 04             	mov    0x4(%ebx),%eax
+  80262b:	39 c6                	cmp    %eax,%esi
+  80262d:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802630:	83 ec 04             	sub    $0x4,%esp
+  802633:	56                   	push   %esi
+  802634:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80263a:	50                   	push   %eax
+  80263b:	ff 33                	push   (%ebx)
+  80263d:	e8 f7 e3 ff ff       	call   800a39 <memmove>
+		n += m;
+  802642:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802644:	83 c3 08             	add    $0x8,%ebx
+  802647:	83 c4 10             	add    $0x10,%esp
+  80264a:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80264d:	7f d4                	jg     802623 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80264f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802652:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+	int r, i, n, len = 0;
+  80265a:	be 00 00 00 00       	mov    $0x0,%esi
+  80265f:	e9 6a ff ff ff       	jmp    8025ce <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802664:	68 c0 3e 80 00       	push   $0x803ec0
+  802669:	68 c9 3e 80 00       	push   $0x803ec9
+  80266e:	68 3b 01 00 00       	push   $0x13b
+  802673:	68 de 3e 80 00       	push   $0x803ede
+  802678:	e8 7b 0e 00 00       	call   8034f8 <_panic>
+
+0080267d <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80267d:	55                   	push   %ebp
+  80267e:	89 e5                	mov    %esp,%ebp
+  802680:	57                   	push   %edi
+  802681:	56                   	push   %esi
+  802682:	53                   	push   %ebx
+  802683:	83 ec 0c             	sub    $0xc,%esp
+  802686:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802689:	8b 75 10             	mov    0x10(%ebp),%esi
+  80268c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80268f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802692:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  802697:	8b 07                	mov    (%edi),%eax
+  802699:	a3 04 70 80 00       	mov    %eax,0x807004
+  80269e:	8b 47 04             	mov    0x4(%edi),%eax
+  8026a1:	a3 08 70 80 00       	mov    %eax,0x807008
+  8026a6:	8b 47 08             	mov    0x8(%edi),%eax
+  8026a9:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  8026ae:	8b 47 0c             	mov    0xc(%edi),%eax
+  8026b1:	a3 10 70 80 00       	mov    %eax,0x807010
+  8026b6:	8b 47 10             	mov    0x10(%edi),%eax
+  8026b9:	a3 14 70 80 00       	mov    %eax,0x807014
+  8026be:	8b 47 14             	mov    0x14(%edi),%eax
+  8026c1:	a3 18 70 80 00       	mov    %eax,0x807018
+  8026c6:	8b 47 18             	mov    0x18(%edi),%eax
+  8026c9:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  8026ce:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8026d1:	a3 20 70 80 00       	mov    %eax,0x807020
+  8026d6:	8b 47 20             	mov    0x20(%edi),%eax
+  8026d9:	a3 24 70 80 00       	mov    %eax,0x807024
+  8026de:	8b 47 24             	mov    0x24(%edi),%eax
+  8026e1:	a3 28 70 80 00       	mov    %eax,0x807028
+  8026e6:	8b 47 28             	mov    0x28(%edi),%eax
+  8026e9:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  8026ee:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8026f1:	a3 30 70 80 00       	mov    %eax,0x807030
+  8026f6:	8b 47 30             	mov    0x30(%edi),%eax
+  8026f9:	a3 34 70 80 00       	mov    %eax,0x807034
+  8026fe:	8b 47 34             	mov    0x34(%edi),%eax
+  802701:	a3 38 70 80 00       	mov    %eax,0x807038
+  802706:	8b 47 38             	mov    0x38(%edi),%eax
+  802709:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  80270e:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802711:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  802716:	8b 06                	mov    (%esi),%eax
+  802718:	a3 44 70 80 00       	mov    %eax,0x807044
+  80271d:	8b 46 04             	mov    0x4(%esi),%eax
+  802720:	a3 48 70 80 00       	mov    %eax,0x807048
+  802725:	8b 46 08             	mov    0x8(%esi),%eax
+  802728:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  80272d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802730:	a3 50 70 80 00       	mov    %eax,0x807050
+  802735:	8b 46 10             	mov    0x10(%esi),%eax
+  802738:	a3 54 70 80 00       	mov    %eax,0x807054
+  80273d:	8b 46 14             	mov    0x14(%esi),%eax
+  802740:	a3 58 70 80 00       	mov    %eax,0x807058
+  802745:	8b 46 18             	mov    0x18(%esi),%eax
+  802748:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  80274d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802750:	a3 60 70 80 00       	mov    %eax,0x807060
+  802755:	8b 46 20             	mov    0x20(%esi),%eax
+  802758:	a3 64 70 80 00       	mov    %eax,0x807064
+  80275d:	8b 46 24             	mov    0x24(%esi),%eax
+  802760:	a3 68 70 80 00       	mov    %eax,0x807068
+  802765:	8b 46 28             	mov    0x28(%esi),%eax
+  802768:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  80276d:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802770:	a3 70 70 80 00       	mov    %eax,0x807070
+  802775:	8b 46 30             	mov    0x30(%esi),%eax
+  802778:	a3 74 70 80 00       	mov    %eax,0x807074
+  80277d:	8b 46 34             	mov    0x34(%esi),%eax
+  802780:	a3 78 70 80 00       	mov    %eax,0x807078
+  802785:	8b 46 38             	mov    0x38(%esi),%eax
+  802788:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  80278d:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802790:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802795:	8b 03                	mov    (%ebx),%eax
+  802797:	a3 84 70 80 00       	mov    %eax,0x807084
+  80279c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80279f:	a3 88 70 80 00       	mov    %eax,0x807088
+  8027a4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8027a7:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  8027ac:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8027af:	a3 90 70 80 00       	mov    %eax,0x807090
+  8027b4:	8b 43 10             	mov    0x10(%ebx),%eax
+  8027b7:	a3 94 70 80 00       	mov    %eax,0x807094
+  8027bc:	8b 43 14             	mov    0x14(%ebx),%eax
+  8027bf:	a3 98 70 80 00       	mov    %eax,0x807098
+  8027c4:	8b 43 18             	mov    0x18(%ebx),%eax
+  8027c7:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  8027cc:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8027cf:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  8027d4:	8b 43 20             	mov    0x20(%ebx),%eax
+  8027d7:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  8027dc:	8b 43 24             	mov    0x24(%ebx),%eax
+  8027df:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  8027e4:	8b 43 28             	mov    0x28(%ebx),%eax
+  8027e7:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  8027ec:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8027ef:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  8027f4:	8b 43 30             	mov    0x30(%ebx),%eax
+  8027f7:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  8027fc:	8b 43 34             	mov    0x34(%ebx),%eax
+  8027ff:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  802804:	8b 43 38             	mov    0x38(%ebx),%eax
+  802807:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  80280c:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80280f:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  802814:	8b 45 18             	mov    0x18(%ebp),%eax
+  802817:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80281c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802821:	e8 2b f6 ff ff       	call   801e51 <nsipc>
+  802826:	85 c0                	test   %eax,%eax
+  802828:	0f 88 ad 01 00 00    	js     8029db <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80282e:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  802834:	89 17                	mov    %edx,(%edi)
+  802836:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  80283c:	89 57 04             	mov    %edx,0x4(%edi)
+  80283f:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  802845:	89 57 08             	mov    %edx,0x8(%edi)
+  802848:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80284e:	89 57 0c             	mov    %edx,0xc(%edi)
+  802851:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  802857:	89 57 10             	mov    %edx,0x10(%edi)
+  80285a:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  802860:	89 57 14             	mov    %edx,0x14(%edi)
+  802863:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802869:	89 57 18             	mov    %edx,0x18(%edi)
+  80286c:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802872:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802875:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  80287b:	89 57 20             	mov    %edx,0x20(%edi)
+  80287e:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  802884:	89 57 24             	mov    %edx,0x24(%edi)
+  802887:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  80288d:	89 57 28             	mov    %edx,0x28(%edi)
+  802890:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  802896:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802899:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  80289f:	89 57 30             	mov    %edx,0x30(%edi)
+  8028a2:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  8028a8:	89 57 34             	mov    %edx,0x34(%edi)
+  8028ab:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  8028b1:	89 57 38             	mov    %edx,0x38(%edi)
+  8028b4:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  8028ba:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8028bd:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  8028c3:	89 16                	mov    %edx,(%esi)
+  8028c5:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  8028cb:	89 56 04             	mov    %edx,0x4(%esi)
+  8028ce:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  8028d4:	89 56 08             	mov    %edx,0x8(%esi)
+  8028d7:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  8028dd:	89 56 0c             	mov    %edx,0xc(%esi)
+  8028e0:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  8028e6:	89 56 10             	mov    %edx,0x10(%esi)
+  8028e9:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  8028ef:	89 56 14             	mov    %edx,0x14(%esi)
+  8028f2:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  8028f8:	89 56 18             	mov    %edx,0x18(%esi)
+  8028fb:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  802901:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802904:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  80290a:	89 56 20             	mov    %edx,0x20(%esi)
+  80290d:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  802913:	89 56 24             	mov    %edx,0x24(%esi)
+  802916:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  80291c:	89 56 28             	mov    %edx,0x28(%esi)
+  80291f:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  802925:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802928:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  80292e:	89 56 30             	mov    %edx,0x30(%esi)
+  802931:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  802937:	89 56 34             	mov    %edx,0x34(%esi)
+  80293a:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  802940:	89 56 38             	mov    %edx,0x38(%esi)
+  802943:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  802949:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80294c:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  802952:	89 13                	mov    %edx,(%ebx)
+  802954:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  80295a:	89 53 04             	mov    %edx,0x4(%ebx)
+  80295d:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  802963:	89 53 08             	mov    %edx,0x8(%ebx)
+  802966:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  80296c:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80296f:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  802975:	89 53 10             	mov    %edx,0x10(%ebx)
+  802978:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  80297e:	89 53 14             	mov    %edx,0x14(%ebx)
+  802981:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  802987:	89 53 18             	mov    %edx,0x18(%ebx)
+  80298a:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  802990:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802993:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  802999:	89 53 20             	mov    %edx,0x20(%ebx)
+  80299c:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  8029a2:	89 53 24             	mov    %edx,0x24(%ebx)
+  8029a5:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  8029ab:	89 53 28             	mov    %edx,0x28(%ebx)
+  8029ae:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  8029b4:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8029b7:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  8029bd:	89 53 30             	mov    %edx,0x30(%ebx)
+  8029c0:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  8029c6:	89 53 34             	mov    %edx,0x34(%ebx)
+  8029c9:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  8029cf:	89 53 38             	mov    %edx,0x38(%ebx)
+  8029d2:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  8029d8:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8029db:	83 c4 0c             	add    $0xc,%esp
+  8029de:	5b                   	pop    %ebx
+  8029df:	5e                   	pop    %esi
+  8029e0:	5f                   	pop    %edi
+  8029e1:	5d                   	pop    %ebp
+  8029e2:	c3                   	ret
+
+008029e3 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8029e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ec:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  8029f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029f4:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  8029f9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029fc:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  802a01:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a06:	e8 46 f4 ff ff       	call   801e51 <nsipc>
+}
+  802a0b:	c9                   	leave
+  802a0c:	c3                   	ret
+
+00802a0d <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802a0d:	55                   	push   %ebp
+  802a0e:	89 e5                	mov    %esp,%ebp
+  802a10:	56                   	push   %esi
+  802a11:	53                   	push   %ebx
+  802a12:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802a15:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802a1b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a1e:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802a23:	b8 10 00 00 00       	mov    $0x10,%eax
+  802a28:	e8 24 f4 ff ff       	call   801e51 <nsipc>
+  802a2d:	89 c3                	mov    %eax,%ebx
+  802a2f:	85 c0                	test   %eax,%eax
+  802a31:	7e 1f                	jle    802a52 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802a33:	39 c6                	cmp    %eax,%esi
+  802a35:	7c 24                	jl     802a5b <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802a37:	83 ec 04             	sub    $0x4,%esp
+  802a3a:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802a41:	50                   	push   %eax
+  802a42:	68 00 70 80 00       	push   $0x807000
+  802a47:	ff 75 08             	push   0x8(%ebp)
+  802a4a:	e8 ea df ff ff       	call   800a39 <memmove>
+  802a4f:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a52:	89 d8                	mov    %ebx,%eax
+  802a54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a57:	5b                   	pop    %ebx
+  802a58:	5e                   	pop    %esi
+  802a59:	5d                   	pop    %ebp
+  802a5a:	c3                   	ret
+		assert(r <= max);
+  802a5b:	68 f6 3e 80 00       	push   $0x803ef6
+  802a60:	68 c9 3e 80 00       	push   $0x803ec9
+  802a65:	68 6a 01 00 00       	push   $0x16a
+  802a6a:	68 de 3e 80 00       	push   $0x803ede
+  802a6f:	e8 84 0a 00 00       	call   8034f8 <_panic>
+
+00802a74 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a74:	55                   	push   %ebp
+  802a75:	89 e5                	mov    %esp,%ebp
+  802a77:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802a82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a85:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a8a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a8d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802a92:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a97:	e8 b5 f3 ff ff       	call   801e51 <nsipc>
+}
+  802a9c:	c9                   	leave
+  802a9d:	c3                   	ret
+
+00802a9e <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802a9e:	55                   	push   %ebp
+  802a9f:	89 e5                	mov    %esp,%ebp
+  802aa1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa7:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  802aac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ab1:	e8 9b f3 ff ff       	call   801e51 <nsipc>
+}
+  802ab6:	c9                   	leave
+  802ab7:	c3                   	ret
+
+00802ab8 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802ab8:	55                   	push   %ebp
+  802ab9:	89 e5                	mov    %esp,%ebp
+  802abb:	53                   	push   %ebx
+  802abc:	83 ec 04             	sub    $0x4,%esp
+  802abf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802ac2:	b8 12 00 00 00       	mov    $0x12,%eax
+  802ac7:	e8 85 f3 ff ff       	call   801e51 <nsipc>
+  802acc:	85 c0                	test   %eax,%eax
+  802ace:	78 50                	js     802b20 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802ad0:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  802ad6:	89 13                	mov    %edx,(%ebx)
+  802ad8:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  802ade:	89 53 04             	mov    %edx,0x4(%ebx)
+  802ae1:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  802ae7:	89 53 08             	mov    %edx,0x8(%ebx)
+  802aea:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  802af0:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802af3:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802af9:	89 53 10             	mov    %edx,0x10(%ebx)
+  802afc:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  802b02:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b05:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  802b0b:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b0e:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802b14:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b17:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802b1d:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802b20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b23:	c9                   	leave
+  802b24:	c3                   	ret
+
+00802b25 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802b25:	55                   	push   %ebp
+  802b26:	89 e5                	mov    %esp,%ebp
+  802b28:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b2b:	6a 03                	push   $0x3
+  802b2d:	e8 05 0d 00 00       	call   803837 <ipc_find_env>
+  802b32:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3a:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802b3f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802b44:	e8 08 f3 ff ff       	call   801e51 <nsipc>
+  802b49:	83 c4 10             	add    $0x10,%esp
+  802b4c:	85 c0                	test   %eax,%eax
+  802b4e:	78 0a                	js     802b5a <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802b50:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+
+00802b5c <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	57                   	push   %edi
+  802b60:	56                   	push   %esi
+  802b61:	53                   	push   %ebx
+  802b62:	83 ec 1c             	sub    $0x1c,%esp
+  802b65:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b68:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802b6b:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b75:	89 e0                	mov    %esp,%eax
+  802b77:	89 f2                	mov    %esi,%edx
+  802b79:	29 c2                	sub    %eax,%edx
+  802b7b:	89 d0                	mov    %edx,%eax
+  802b7d:	c1 e8 0f             	shr    $0xf,%eax
+  802b80:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802b86:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802b89:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802b90:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802b93:	83 ec 0c             	sub    $0xc,%esp
+  802b96:	ff 75 e0             	push   -0x20(%ebp)
+  802b99:	e8 d8 0c 00 00       	call   803876 <pageref>
+  802b9e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ba1:	83 c4 04             	add    $0x4,%esp
+  802ba4:	ff 75 dc             	push   -0x24(%ebp)
+  802ba7:	e8 ca 0c 00 00       	call   803876 <pageref>
+  802bac:	89 e2                	mov    %esp,%edx
+  802bae:	89 f1                	mov    %esi,%ecx
+  802bb0:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802bb2:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802bb5:	89 ca                	mov    %ecx,%edx
+  802bb7:	c1 ea 0f             	shr    $0xf,%edx
+  802bba:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802bc0:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802bc3:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  802bca:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802bcd:	39 d7                	cmp    %edx,%edi
+  802bcf:	74 40                	je     802c11 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802bd1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bd4:	75 9f                	jne    802b75 <_pipeisclosed+0x19>
+  802bd6:	89 e2                	mov    %esp,%edx
+  802bd8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802bdd:	29 d0                	sub    %edx,%eax
+  802bdf:	89 c2                	mov    %eax,%edx
+  802be1:	c1 ea 0f             	shr    $0xf,%edx
+  802be4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bee:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802bf1:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802bf8:	8b 40 58             	mov    0x58(%eax),%eax
+  802bfb:	6a 01                	push   $0x1
+  802bfd:	50                   	push   %eax
+  802bfe:	57                   	push   %edi
+  802bff:	68 ff 3e 80 00       	push   $0x803eff
+  802c04:	e8 89 d5 ff ff       	call   800192 <cprintf>
+  802c09:	83 c4 10             	add    $0x10,%esp
+  802c0c:	e9 5f ff ff ff       	jmp    802b70 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802c11:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c14:	0f 94 c0             	sete   %al
+  802c17:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802c1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c1d:	5b                   	pop    %ebx
+  802c1e:	5e                   	pop    %esi
+  802c1f:	5f                   	pop    %edi
+  802c20:	5d                   	pop    %ebp
+  802c21:	c3                   	ret
+
+00802c22 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	53                   	push   %ebx
+  802c26:	83 ec 0c             	sub    $0xc,%esp
+  802c29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c2c:	53                   	push   %ebx
+  802c2d:	6a 00                	push   $0x0
+  802c2f:	e8 0e e1 ff ff       	call   800d42 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c34:	89 1c 24             	mov    %ebx,(%esp)
+  802c37:	e8 f4 e4 ff ff       	call   801130 <fd2data>
+  802c3c:	83 c4 08             	add    $0x8,%esp
+  802c3f:	50                   	push   %eax
+  802c40:	6a 00                	push   $0x0
+  802c42:	e8 fb e0 ff ff       	call   800d42 <sys_page_unmap>
+}
+  802c47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c4a:	c9                   	leave
+  802c4b:	c3                   	ret
+
+00802c4c <devpipe_read>:
+{
+  802c4c:	55                   	push   %ebp
+  802c4d:	89 e5                	mov    %esp,%ebp
+  802c4f:	57                   	push   %edi
+  802c50:	56                   	push   %esi
+  802c51:	53                   	push   %ebx
+  802c52:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802c55:	ff 75 08             	push   0x8(%ebp)
+  802c58:	e8 d3 e4 ff ff       	call   801130 <fd2data>
+  802c5d:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802c5f:	8b 70 04             	mov    0x4(%eax),%esi
+  802c62:	8b 00                	mov    (%eax),%eax
+  802c64:	83 c4 10             	add    $0x10,%esp
+  802c67:	39 f0                	cmp    %esi,%eax
+  802c69:	75 36                	jne    802ca1 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802c6b:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802c6e:	89 da                	mov    %ebx,%edx
+  802c70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c73:	e8 e4 fe ff ff       	call   802b5c <_pipeisclosed>
+  802c78:	85 c0                	test   %eax,%eax
+  802c7a:	0f 85 d4 00 00 00    	jne    802d54 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802c80:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c85:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802c89:	83 ec 04             	sub    $0x4,%esp
+  802c8c:	6a ff                	push   $0xffffffff
+  802c8e:	56                   	push   %esi
+  802c8f:	57                   	push   %edi
+  802c90:	e8 26 e4 ff ff       	call   8010bb <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802c95:	8b 73 04             	mov    0x4(%ebx),%esi
+  802c98:	8b 03                	mov    (%ebx),%eax
+  802c9a:	83 c4 10             	add    $0x10,%esp
+  802c9d:	39 c6                	cmp    %eax,%esi
+  802c9f:	74 cd                	je     802c6e <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ca1:	8b 73 04             	mov    0x4(%ebx),%esi
+  802ca4:	8b 03                	mov    (%ebx),%eax
+  802ca6:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802cac:	29 c6                	sub    %eax,%esi
+  802cae:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802cb3:	f7 e6                	mul    %esi
+  802cb5:	c1 ea 0c             	shr    $0xc,%edx
+  802cb8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802cbe:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802cc0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802cc3:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802cc7:	8b 0b                	mov    (%ebx),%ecx
+  802cc9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802cce:	f7 e1                	mul    %ecx
+  802cd0:	c1 ea 0b             	shr    $0xb,%edx
+  802cd3:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802cd9:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802cdb:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802ce0:	29 cf                	sub    %ecx,%edi
+  802ce2:	39 f7                	cmp    %esi,%edi
+  802ce4:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802ce7:	83 ec 04             	sub    $0x4,%esp
+  802cea:	57                   	push   %edi
+  802ceb:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802cef:	50                   	push   %eax
+  802cf0:	ff 75 0c             	push   0xc(%ebp)
+  802cf3:	e8 41 dd ff ff       	call   800a39 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802cf8:	83 c4 0c             	add    $0xc,%esp
+  802cfb:	89 f0                	mov    %esi,%eax
+  802cfd:	29 f8                	sub    %edi,%eax
+  802cff:	50                   	push   %eax
+  802d00:	8d 43 10             	lea    0x10(%ebx),%eax
+  802d03:	50                   	push   %eax
+  802d04:	89 f8                	mov    %edi,%eax
+  802d06:	03 45 0c             	add    0xc(%ebp),%eax
+  802d09:	50                   	push   %eax
+  802d0a:	e8 2a dd ff ff       	call   800a39 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802d0f:	8b 0b                	mov    (%ebx),%ecx
+  802d11:	01 f1                	add    %esi,%ecx
+  802d13:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d18:	f7 e1                	mul    %ecx
+  802d1a:	c1 ea 0c             	shr    $0xc,%edx
+  802d1d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802d23:	29 c1                	sub    %eax,%ecx
+  802d25:	89 0b                	mov    %ecx,(%ebx)
+  802d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2c:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802d30:	83 c4 10             	add    $0x10,%esp
+  802d33:	85 c0                	test   %eax,%eax
+  802d35:	75 0a                	jne    802d41 <devpipe_read+0xf5>
+	return n;
+  802d37:	89 f0                	mov    %esi,%eax
+}
+  802d39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d3c:	5b                   	pop    %ebx
+  802d3d:	5e                   	pop    %esi
+  802d3e:	5f                   	pop    %edi
+  802d3f:	5d                   	pop    %ebp
+  802d40:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802d41:	83 ec 08             	sub    $0x8,%esp
+  802d44:	68 00 04 00 00       	push   $0x400
+  802d49:	53                   	push   %ebx
+  802d4a:	e8 8e e3 ff ff       	call   8010dd <sys_futex_wake>
+  802d4f:	83 c4 10             	add    $0x10,%esp
+  802d52:	eb e3                	jmp    802d37 <devpipe_read+0xeb>
+			return 0;
+  802d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d59:	eb de                	jmp    802d39 <devpipe_read+0xed>
+
+00802d5b <devpipe_write>:
+{
+  802d5b:	55                   	push   %ebp
+  802d5c:	89 e5                	mov    %esp,%ebp
+  802d5e:	57                   	push   %edi
+  802d5f:	56                   	push   %esi
+  802d60:	53                   	push   %ebx
+  802d61:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802d64:	ff 75 08             	push   0x8(%ebp)
+  802d67:	e8 c4 e3 ff ff       	call   801130 <fd2data>
+  802d6c:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802d6e:	83 c4 10             	add    $0x10,%esp
+  802d71:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d78:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802d7d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d81:	0f 84 43 01 00 00    	je     802eca <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d87:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802d8a:	8b 06                	mov    (%esi),%eax
+  802d8c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802d92:	29 c1                	sub    %eax,%ecx
+  802d94:	89 c8                	mov    %ecx,%eax
+  802d96:	f7 e7                	mul    %edi
+  802d98:	c1 ea 0c             	shr    $0xc,%edx
+  802d9b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802da1:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802da3:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802da9:	75 52                	jne    802dfd <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802dab:	89 f2                	mov    %esi,%edx
+  802dad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db0:	e8 a7 fd ff ff       	call   802b5c <_pipeisclosed>
+  802db5:	85 c0                	test   %eax,%eax
+  802db7:	0f 85 28 01 00 00    	jne    802ee5 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802dbd:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802dbf:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802dc2:	8b 06                	mov    (%esi),%eax
+  802dc4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802dca:	29 c1                	sub    %eax,%ecx
+  802dcc:	89 c8                	mov    %ecx,%eax
+  802dce:	f7 e7                	mul    %edi
+  802dd0:	c1 ea 0c             	shr    $0xc,%edx
+  802dd3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802dd9:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802ddb:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802de1:	75 a4                	jne    802d87 <devpipe_write+0x2c>
+  802de3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802de8:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802dec:	83 ec 04             	sub    $0x4,%esp
+  802def:	6a ff                	push   $0xffffffff
+  802df1:	53                   	push   %ebx
+  802df2:	56                   	push   %esi
+  802df3:	e8 c3 e2 ff ff       	call   8010bb <sys_futex_wait>
+}
+  802df8:	83 c4 10             	add    $0x10,%esp
+  802dfb:	eb 8a                	jmp    802d87 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802dfd:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e00:	8b 06                	mov    (%esi),%eax
+  802e02:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e08:	29 c1                	sub    %eax,%ecx
+  802e0a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e0f:	f7 e1                	mul    %ecx
+  802e11:	c1 ea 0c             	shr    $0xc,%edx
+  802e14:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e1a:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802e1c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802e21:	89 d8                	mov    %ebx,%eax
+  802e23:	29 c8                	sub    %ecx,%eax
+  802e25:	8b 55 10             	mov    0x10(%ebp),%edx
+  802e28:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e2b:	29 ca                	sub    %ecx,%edx
+  802e2d:	39 d0                	cmp    %edx,%eax
+  802e2f:	0f 46 d0             	cmovbe %eax,%edx
+  802e32:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802e35:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e38:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e3d:	f7 e1                	mul    %ecx
+  802e3f:	c1 ea 0b             	shr    $0xb,%edx
+  802e42:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802e48:	89 ca                	mov    %ecx,%edx
+  802e4a:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802e4c:	29 d3                	sub    %edx,%ebx
+  802e4e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e51:	39 c3                	cmp    %eax,%ebx
+  802e53:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802e56:	83 ec 04             	sub    $0x4,%esp
+  802e59:	53                   	push   %ebx
+  802e5a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e5d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802e60:	51                   	push   %ecx
+  802e61:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802e65:	50                   	push   %eax
+  802e66:	e8 ce db ff ff       	call   800a39 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802e6b:	83 c4 0c             	add    $0xc,%esp
+  802e6e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e71:	29 d8                	sub    %ebx,%eax
+  802e73:	50                   	push   %eax
+  802e74:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e77:	01 cb                	add    %ecx,%ebx
+  802e79:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802e7c:	53                   	push   %ebx
+  802e7d:	8d 46 10             	lea    0x10(%esi),%eax
+  802e80:	50                   	push   %eax
+  802e81:	e8 b3 db ff ff       	call   800a39 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802e86:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e89:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e8c:	01 c1                	add    %eax,%ecx
+  802e8e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e93:	f7 e1                	mul    %ecx
+  802e95:	c1 ea 0c             	shr    $0xc,%edx
+  802e98:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802e9e:	89 ca                	mov    %ecx,%edx
+  802ea0:	29 c2                	sub    %eax,%edx
+  802ea2:	89 56 04             	mov    %edx,0x4(%esi)
+  802ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eaa:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802eae:	83 c4 10             	add    $0x10,%esp
+  802eb1:	85 c0                	test   %eax,%eax
+  802eb3:	75 1a                	jne    802ecf <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802eb5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802eb8:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802ebb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ebe:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ec1:	0f 82 c0 fe ff ff    	jb     802d87 <devpipe_write+0x2c>
+  802ec7:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802eca:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ecd:	eb 1b                	jmp    802eea <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802ecf:	83 ec 08             	sub    $0x8,%esp
+  802ed2:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802ed7:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802eda:	50                   	push   %eax
+  802edb:	e8 fd e1 ff ff       	call   8010dd <sys_futex_wake>
+  802ee0:	83 c4 10             	add    $0x10,%esp
+  802ee3:	eb d0                	jmp    802eb5 <devpipe_write+0x15a>
+				return 0;
+  802ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eed:	5b                   	pop    %ebx
+  802eee:	5e                   	pop    %esi
+  802eef:	5f                   	pop    %edi
+  802ef0:	5d                   	pop    %ebp
+  802ef1:	c3                   	ret
+
+00802ef2 <devpipe_stat>:
+{
+  802ef2:	55                   	push   %ebp
+  802ef3:	89 e5                	mov    %esp,%ebp
+  802ef5:	56                   	push   %esi
+  802ef6:	53                   	push   %ebx
+  802ef7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802efa:	83 ec 0c             	sub    $0xc,%esp
+  802efd:	ff 75 08             	push   0x8(%ebp)
+  802f00:	e8 2b e2 ff ff       	call   801130 <fd2data>
+  802f05:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f07:	83 c4 08             	add    $0x8,%esp
+  802f0a:	68 12 3f 80 00       	push   $0x803f12
+  802f0f:	53                   	push   %ebx
+  802f10:	e8 74 d9 ff ff       	call   800889 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f15:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f18:	8b 06                	mov    (%esi),%eax
+  802f1a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f20:	29 c1                	sub    %eax,%ecx
+  802f22:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802f27:	89 c8                	mov    %ecx,%eax
+  802f29:	f7 e2                	mul    %edx
+  802f2b:	c1 ea 0c             	shr    $0xc,%edx
+  802f2e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f34:	29 d1                	sub    %edx,%ecx
+  802f36:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f3c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f43:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f46:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  802f4d:	40 80 00 
+}
+  802f50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f58:	5b                   	pop    %ebx
+  802f59:	5e                   	pop    %esi
+  802f5a:	5d                   	pop    %ebp
+  802f5b:	c3                   	ret
+
+00802f5c <devpipe_poll>:
+{
+  802f5c:	55                   	push   %ebp
+  802f5d:	89 e5                	mov    %esp,%ebp
+  802f5f:	57                   	push   %edi
+  802f60:	56                   	push   %esi
+  802f61:	53                   	push   %ebx
+  802f62:	83 ec 18             	sub    $0x18,%esp
+  802f65:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f68:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f6b:	57                   	push   %edi
+  802f6c:	e8 bf e1 ff ff       	call   801130 <fd2data>
+  802f71:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802f73:	83 c4 10             	add    $0x10,%esp
+  802f76:	89 f3                	mov    %esi,%ebx
+  802f78:	83 e3 01             	and    $0x1,%ebx
+  802f7b:	75 27                	jne    802fa4 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  802f7d:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802f83:	75 48                	jne    802fcd <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802f85:	89 ca                	mov    %ecx,%edx
+  802f87:	89 f8                	mov    %edi,%eax
+  802f89:	e8 ce fb ff ff       	call   802b5c <_pipeisclosed>
+  802f8e:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  802f90:	89 d8                	mov    %ebx,%eax
+  802f92:	83 c8 10             	or     $0x10,%eax
+  802f95:	85 d2                	test   %edx,%edx
+  802f97:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802f9a:	89 d8                	mov    %ebx,%eax
+  802f9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9f:	5b                   	pop    %ebx
+  802fa0:	5e                   	pop    %esi
+  802fa1:	5f                   	pop    %edi
+  802fa2:	5d                   	pop    %ebp
+  802fa3:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fa4:	8b 58 04             	mov    0x4(%eax),%ebx
+  802fa7:	8b 00                	mov    (%eax),%eax
+  802fa9:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  802faf:	29 c3                	sub    %eax,%ebx
+  802fb1:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802fb6:	89 d8                	mov    %ebx,%eax
+  802fb8:	f7 e2                	mul    %edx
+  802fba:	c1 ea 0c             	shr    $0xc,%edx
+  802fbd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802fc3:	39 d3                	cmp    %edx,%ebx
+  802fc5:	0f 95 c3             	setne  %bl
+  802fc8:	0f b6 db             	movzbl %bl,%ebx
+  802fcb:	eb b0                	jmp    802f7d <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fcd:	8b 71 04             	mov    0x4(%ecx),%esi
+  802fd0:	8b 01                	mov    (%ecx),%eax
+  802fd2:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802fd8:	29 c6                	sub    %eax,%esi
+  802fda:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802fdf:	89 f0                	mov    %esi,%eax
+  802fe1:	f7 e2                	mul    %edx
+  802fe3:	c1 ea 0c             	shr    $0xc,%edx
+  802fe6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fec:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  802fee:	89 d8                	mov    %ebx,%eax
+  802ff0:	83 c8 04             	or     $0x4,%eax
+  802ff3:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  802ff9:	0f 42 d8             	cmovb  %eax,%ebx
+  802ffc:	eb 87                	jmp    802f85 <devpipe_poll+0x29>
+
+00802ffe <pipe>:
+{
+  802ffe:	55                   	push   %ebp
+  802fff:	89 e5                	mov    %esp,%ebp
+  803001:	56                   	push   %esi
+  803002:	53                   	push   %ebx
+  803003:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803006:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803009:	50                   	push   %eax
+  80300a:	e8 38 e1 ff ff       	call   801147 <fd_alloc>
+  80300f:	89 c3                	mov    %eax,%ebx
+  803011:	83 c4 10             	add    $0x10,%esp
+  803014:	85 c0                	test   %eax,%eax
+  803016:	0f 88 23 01 00 00    	js     80313f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80301c:	83 ec 04             	sub    $0x4,%esp
+  80301f:	68 07 04 00 00       	push   $0x407
+  803024:	ff 75 f4             	push   -0xc(%ebp)
+  803027:	6a 00                	push   $0x0
+  803029:	e8 8f dc ff ff       	call   800cbd <sys_page_alloc>
+  80302e:	89 c3                	mov    %eax,%ebx
+  803030:	83 c4 10             	add    $0x10,%esp
+  803033:	85 c0                	test   %eax,%eax
+  803035:	0f 88 04 01 00 00    	js     80313f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80303b:	83 ec 0c             	sub    $0xc,%esp
+  80303e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803041:	50                   	push   %eax
+  803042:	e8 00 e1 ff ff       	call   801147 <fd_alloc>
+  803047:	89 c3                	mov    %eax,%ebx
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	85 c0                	test   %eax,%eax
+  80304e:	0f 88 db 00 00 00    	js     80312f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803054:	83 ec 04             	sub    $0x4,%esp
+  803057:	68 07 04 00 00       	push   $0x407
+  80305c:	ff 75 f0             	push   -0x10(%ebp)
+  80305f:	6a 00                	push   $0x0
+  803061:	e8 57 dc ff ff       	call   800cbd <sys_page_alloc>
+  803066:	89 c3                	mov    %eax,%ebx
+  803068:	83 c4 10             	add    $0x10,%esp
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	0f 88 bc 00 00 00    	js     80312f <pipe+0x131>
+	va = fd2data(fd0);
+  803073:	83 ec 0c             	sub    $0xc,%esp
+  803076:	ff 75 f4             	push   -0xc(%ebp)
+  803079:	e8 b2 e0 ff ff       	call   801130 <fd2data>
+  80307e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803080:	83 c4 0c             	add    $0xc,%esp
+  803083:	68 07 04 00 00       	push   $0x407
+  803088:	50                   	push   %eax
+  803089:	6a 00                	push   $0x0
+  80308b:	e8 2d dc ff ff       	call   800cbd <sys_page_alloc>
+  803090:	89 c3                	mov    %eax,%ebx
+  803092:	83 c4 10             	add    $0x10,%esp
+  803095:	85 c0                	test   %eax,%eax
+  803097:	0f 88 82 00 00 00    	js     80311f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80309d:	83 ec 0c             	sub    $0xc,%esp
+  8030a0:	ff 75 f0             	push   -0x10(%ebp)
+  8030a3:	e8 88 e0 ff ff       	call   801130 <fd2data>
+  8030a8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030af:	50                   	push   %eax
+  8030b0:	6a 00                	push   $0x0
+  8030b2:	56                   	push   %esi
+  8030b3:	6a 00                	push   $0x0
+  8030b5:	e8 46 dc ff ff       	call   800d00 <sys_page_map>
+  8030ba:	89 c3                	mov    %eax,%ebx
+  8030bc:	83 c4 20             	add    $0x20,%esp
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	78 4e                	js     803111 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030c3:	a1 60 40 80 00       	mov    0x804060,%eax
+  8030c8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030cb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8030cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030d0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8030d7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030da:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8030dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030df:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8030e6:	83 ec 0c             	sub    $0xc,%esp
+  8030e9:	ff 75 f4             	push   -0xc(%ebp)
+  8030ec:	e8 2f e0 ff ff       	call   801120 <fd2num>
+  8030f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030f4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030f6:	83 c4 04             	add    $0x4,%esp
+  8030f9:	ff 75 f0             	push   -0x10(%ebp)
+  8030fc:	e8 1f e0 ff ff       	call   801120 <fd2num>
+  803101:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803104:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803107:	83 c4 10             	add    $0x10,%esp
+  80310a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80310f:	eb 2e                	jmp    80313f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803111:	83 ec 08             	sub    $0x8,%esp
+  803114:	56                   	push   %esi
+  803115:	6a 00                	push   $0x0
+  803117:	e8 26 dc ff ff       	call   800d42 <sys_page_unmap>
+  80311c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80311f:	83 ec 08             	sub    $0x8,%esp
+  803122:	ff 75 f0             	push   -0x10(%ebp)
+  803125:	6a 00                	push   $0x0
+  803127:	e8 16 dc ff ff       	call   800d42 <sys_page_unmap>
+  80312c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80312f:	83 ec 08             	sub    $0x8,%esp
+  803132:	ff 75 f4             	push   -0xc(%ebp)
+  803135:	6a 00                	push   $0x0
+  803137:	e8 06 dc ff ff       	call   800d42 <sys_page_unmap>
+  80313c:	83 c4 10             	add    $0x10,%esp
+}
+  80313f:	89 d8                	mov    %ebx,%eax
+  803141:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803144:	5b                   	pop    %ebx
+  803145:	5e                   	pop    %esi
+  803146:	5d                   	pop    %ebp
+  803147:	c3                   	ret
+
+00803148 <pipeisclosed>:
+{
+  803148:	55                   	push   %ebp
+  803149:	89 e5                	mov    %esp,%ebp
+  80314b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80314e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803151:	50                   	push   %eax
+  803152:	ff 75 08             	push   0x8(%ebp)
+  803155:	e8 3d e0 ff ff       	call   801197 <fd_lookup>
+  80315a:	83 c4 10             	add    $0x10,%esp
+  80315d:	85 c0                	test   %eax,%eax
+  80315f:	78 18                	js     803179 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803161:	83 ec 0c             	sub    $0xc,%esp
+  803164:	ff 75 f4             	push   -0xc(%ebp)
+  803167:	e8 c4 df ff ff       	call   801130 <fd2data>
+  80316c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80316e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803171:	e8 e6 f9 ff ff       	call   802b5c <_pipeisclosed>
+  803176:	83 c4 10             	add    $0x10,%esp
+}
+  803179:	c9                   	leave
+  80317a:	c3                   	ret
+
+0080317b <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80317b:	55                   	push   %ebp
+  80317c:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80317e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803181:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803187:	5d                   	pop    %ebp
+  803188:	c3                   	ret
+
+00803189 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803189:	55                   	push   %ebp
+  80318a:	89 e5                	mov    %esp,%ebp
+  80318c:	53                   	push   %ebx
+  80318d:	83 ec 04             	sub    $0x4,%esp
+  803190:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803193:	8b 03                	mov    (%ebx),%eax
+  803195:	85 c0                	test   %eax,%eax
+  803197:	75 05                	jne    80319e <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803199:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80319c:	c9                   	leave
+  80319d:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80319e:	83 ec 08             	sub    $0x8,%esp
+  8031a1:	50                   	push   %eax
+  8031a2:	8d 43 04             	lea    0x4(%ebx),%eax
+  8031a5:	50                   	push   %eax
+  8031a6:	e8 e7 dd ff ff       	call   800f92 <sys_page_batch>
+	pb->pb_n = 0;
+  8031ab:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8031b1:	83 c4 10             	add    $0x10,%esp
+  8031b4:	eb e3                	jmp    803199 <pgbatch_flush+0x10>
+
+008031b6 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8031b6:	55                   	push   %ebp
+  8031b7:	89 e5                	mov    %esp,%ebp
+  8031b9:	56                   	push   %esi
+  8031ba:	53                   	push   %ebx
+  8031bb:	89 c3                	mov    %eax,%ebx
+  8031bd:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8031bf:	83 38 20             	cmpl   $0x20,(%eax)
+  8031c2:	74 2c                	je     8031f0 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8031c4:	8b 03                	mov    (%ebx),%eax
+  8031c6:	8d 50 01             	lea    0x1(%eax),%edx
+  8031c9:	89 13                	mov    %edx,(%ebx)
+  8031cb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8031ce:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8031d2:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8031d4:	83 ec 04             	sub    $0x4,%esp
+  8031d7:	6a 18                	push   $0x18
+  8031d9:	6a 00                	push   $0x0
+  8031db:	50                   	push   %eax
+  8031dc:	e8 23 d8 ff ff       	call   800a04 <memset>
+	return 0;
+  8031e1:	83 c4 10             	add    $0x10,%esp
+  8031e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031ec:	5b                   	pop    %ebx
+  8031ed:	5e                   	pop    %esi
+  8031ee:	5d                   	pop    %ebp
+  8031ef:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8031f0:	83 ec 0c             	sub    $0xc,%esp
+  8031f3:	50                   	push   %eax
+  8031f4:	e8 90 ff ff ff       	call   803189 <pgbatch_flush>
+  8031f9:	83 c4 10             	add    $0x10,%esp
+  8031fc:	85 c0                	test   %eax,%eax
+  8031fe:	79 c4                	jns    8031c4 <pgbatch_slot+0xe>
+  803200:	eb e7                	jmp    8031e9 <pgbatch_slot+0x33>
+
+00803202 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803202:	55                   	push   %ebp
+  803203:	89 e5                	mov    %esp,%ebp
+  803205:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803208:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80320b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80320e:	e8 a3 ff ff ff       	call   8031b6 <pgbatch_slot>
+  803213:	85 c0                	test   %eax,%eax
+  803215:	78 20                	js     803237 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803217:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80321a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803220:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803223:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803226:	8b 55 10             	mov    0x10(%ebp),%edx
+  803229:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80322c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80322f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803232:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803237:	c9                   	leave
+  803238:	c3                   	ret
+
+00803239 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803239:	55                   	push   %ebp
+  80323a:	89 e5                	mov    %esp,%ebp
+  80323c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80323f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803242:	8b 45 08             	mov    0x8(%ebp),%eax
+  803245:	e8 6c ff ff ff       	call   8031b6 <pgbatch_slot>
+  80324a:	85 c0                	test   %eax,%eax
+  80324c:	78 2c                	js     80327a <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80324e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803251:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803257:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80325a:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80325d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803260:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803263:	8b 55 14             	mov    0x14(%ebp),%edx
+  803266:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803269:	8b 55 18             	mov    0x18(%ebp),%edx
+  80326c:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80326f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803272:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803275:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80327a:	c9                   	leave
+  80327b:	c3                   	ret
+
+0080327c <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80327c:	55                   	push   %ebp
+  80327d:	89 e5                	mov    %esp,%ebp
+  80327f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803282:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803285:	8b 45 08             	mov    0x8(%ebp),%eax
+  803288:	e8 29 ff ff ff       	call   8031b6 <pgbatch_slot>
+  80328d:	85 c0                	test   %eax,%eax
+  80328f:	78 1a                	js     8032ab <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803291:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803294:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80329a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80329d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032a0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032a3:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8032a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ab:	c9                   	leave
+  8032ac:	c3                   	ret
+
+008032ad <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8032ad:	55                   	push   %ebp
+  8032ae:	89 e5                	mov    %esp,%ebp
+  8032b0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032b3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b9:	e8 f8 fe ff ff       	call   8031b6 <pgbatch_slot>
+  8032be:	85 c0                	test   %eax,%eax
+  8032c0:	78 20                	js     8032e2 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8032c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032c5:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8032cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032ce:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032d1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032d4:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8032d7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8032da:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8032dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032e2:	c9                   	leave
+  8032e3:	c3                   	ret
+
+008032e4 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8032e4:	55                   	push   %ebp
+  8032e5:	89 e5                	mov    %esp,%ebp
+  8032e7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032ea:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032f0:	e8 c1 fe ff ff       	call   8031b6 <pgbatch_slot>
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	78 26                	js     80331f <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8032f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032fc:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803302:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803305:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803308:	8b 55 10             	mov    0x10(%ebp),%edx
+  80330b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80330e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803311:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803314:	8b 55 18             	mov    0x18(%ebp),%edx
+  803317:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331f:	c9                   	leave
+  803320:	c3                   	ret
+
+00803321 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803321:	b8 00 00 00 00       	mov    $0x0,%eax
+  803326:	c3                   	ret
+
+00803327 <devcons_poll>:
+{
+  803327:	55                   	push   %ebp
+  803328:	89 e5                	mov    %esp,%ebp
+  80332a:	53                   	push   %ebx
+  80332b:	83 ec 04             	sub    $0x4,%esp
+  80332e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803331:	89 da                	mov    %ebx,%edx
+  803333:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803336:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80333d:	74 0c                	je     80334b <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80333f:	89 d8                	mov    %ebx,%eax
+  803341:	83 e0 01             	and    $0x1,%eax
+  803344:	09 d0                	or     %edx,%eax
+}
+  803346:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803349:	c9                   	leave
+  80334a:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80334b:	e8 cf d8 ff ff       	call   800c1f <sys_cgetc>
+  803350:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803355:	89 da                	mov    %ebx,%edx
+  803357:	83 e2 04             	and    $0x4,%edx
+  80335a:	85 c0                	test   %eax,%eax
+  80335c:	74 e6                	je     803344 <devcons_poll+0x1d>
+  80335e:	eb df                	jmp    80333f <devcons_poll+0x18>
+
+00803360 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803360:	55                   	push   %ebp
+  803361:	89 e5                	mov    %esp,%ebp
+  803363:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803366:	68 1e 3f 80 00       	push   $0x803f1e
+  80336b:	ff 75 0c             	push   0xc(%ebp)
+  80336e:	e8 16 d5 ff ff       	call   800889 <strcpy>
+	return 0;
+}
+  803373:	b8 00 00 00 00       	mov    $0x0,%eax
+  803378:	c9                   	leave
+  803379:	c3                   	ret
+
+0080337a <devcons_write>:
+{
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	57                   	push   %edi
+  80337e:	56                   	push   %esi
+  80337f:	53                   	push   %ebx
+  803380:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803386:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803389:	85 ff                	test   %edi,%edi
+  80338b:	74 51                	je     8033de <devcons_write+0x64>
+  80338d:	be 00 00 00 00       	mov    $0x0,%esi
+  803392:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803397:	89 fb                	mov    %edi,%ebx
+  803399:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80339b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8033a0:	39 d3                	cmp    %edx,%ebx
+  8033a2:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8033a5:	83 ec 04             	sub    $0x4,%esp
+  8033a8:	53                   	push   %ebx
+  8033a9:	03 45 0c             	add    0xc(%ebp),%eax
+  8033ac:	50                   	push   %eax
+  8033ad:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033b3:	50                   	push   %eax
+  8033b4:	e8 80 d6 ff ff       	call   800a39 <memmove>
+		sys_cputs(buf, m);
+  8033b9:	83 c4 08             	add    $0x8,%esp
+  8033bc:	53                   	push   %ebx
+  8033bd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033c3:	50                   	push   %eax
+  8033c4:	e8 38 d8 ff ff       	call   800c01 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8033c9:	01 de                	add    %ebx,%esi
+  8033cb:	89 f0                	mov    %esi,%eax
+  8033cd:	83 c4 10             	add    $0x10,%esp
+  8033d0:	39 fe                	cmp    %edi,%esi
+  8033d2:	72 c3                	jb     803397 <devcons_write+0x1d>
+}
+  8033d4:	89 f0                	mov    %esi,%eax
+  8033d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d9:	5b                   	pop    %ebx
+  8033da:	5e                   	pop    %esi
+  8033db:	5f                   	pop    %edi
+  8033dc:	5d                   	pop    %ebp
+  8033dd:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8033de:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8033e3:	eb ef                	jmp    8033d4 <devcons_write+0x5a>
+
+008033e5 <devcons_read>:
+{
+  8033e5:	55                   	push   %ebp
+  8033e6:	89 e5                	mov    %esp,%ebp
+  8033e8:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8033eb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8033f0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033f4:	74 36                	je     80342c <devcons_read+0x47>
+	c = cons_peek;
+  8033f6:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8033fb:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  803402:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803405:	85 c0                	test   %eax,%eax
+  803407:	75 10                	jne    803419 <devcons_read+0x34>
+  803409:	e8 11 d8 ff ff       	call   800c1f <sys_cgetc>
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	75 07                	jne    803419 <devcons_read+0x34>
+		sys_yield();
+  803412:	e8 87 d8 ff ff       	call   800c9e <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803417:	eb f0                	jmp    803409 <devcons_read+0x24>
+	if (c < 0)
+  803419:	85 c0                	test   %eax,%eax
+  80341b:	78 0f                	js     80342c <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80341d:	83 f8 04             	cmp    $0x4,%eax
+  803420:	74 0c                	je     80342e <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803422:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803425:	88 02                	mov    %al,(%edx)
+	return 1;
+  803427:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80342c:	c9                   	leave
+  80342d:	c3                   	ret
+		return 0;
+  80342e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803433:	eb f7                	jmp    80342c <devcons_read+0x47>
+
+00803435 <cputchar>:
+{
+  803435:	55                   	push   %ebp
+  803436:	89 e5                	mov    %esp,%ebp
+  803438:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80343b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80343e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803441:	6a 01                	push   $0x1
+  803443:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803446:	50                   	push   %eax
+  803447:	e8 b5 d7 ff ff       	call   800c01 <sys_cputs>
+}
+  80344c:	83 c4 10             	add    $0x10,%esp
+  80344f:	c9                   	leave
+  803450:	c3                   	ret
+
+00803451 <getchar>:
+{
+  803451:	55                   	push   %ebp
+  803452:	89 e5                	mov    %esp,%ebp
+  803454:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803457:	6a 01                	push   $0x1
+  803459:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80345c:	50                   	push   %eax
+  80345d:	6a 00                	push   $0x0
+  80345f:	e8 b7 df ff ff       	call   80141b <read>
+	if (r < 0)
+  803464:	83 c4 10             	add    $0x10,%esp
+  803467:	85 c0                	test   %eax,%eax
+  803469:	78 06                	js     803471 <getchar+0x20>
+	if (r < 1)
+  80346b:	74 06                	je     803473 <getchar+0x22>
+	return c;
+  80346d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803471:	c9                   	leave
+  803472:	c3                   	ret
+		return -E_EOF;
+  803473:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803478:	eb f7                	jmp    803471 <getchar+0x20>
+
+0080347a <iscons>:
+{
+  80347a:	55                   	push   %ebp
+  80347b:	89 e5                	mov    %esp,%ebp
+  80347d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803480:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803483:	50                   	push   %eax
+  803484:	ff 75 08             	push   0x8(%ebp)
+  803487:	e8 0b dd ff ff       	call   801197 <fd_lookup>
+  80348c:	83 c4 10             	add    $0x10,%esp
+  80348f:	85 c0                	test   %eax,%eax
+  803491:	78 11                	js     8034a4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803493:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803496:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80349c:	39 10                	cmp    %edx,(%eax)
+  80349e:	0f 94 c0             	sete   %al
+  8034a1:	0f b6 c0             	movzbl %al,%eax
+}
+  8034a4:	c9                   	leave
+  8034a5:	c3                   	ret
+
+008034a6 <opencons>:
+{
+  8034a6:	55                   	push   %ebp
+  8034a7:	89 e5                	mov    %esp,%ebp
+  8034a9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8034ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034af:	50                   	push   %eax
+  8034b0:	e8 92 dc ff ff       	call   801147 <fd_alloc>
+  8034b5:	83 c4 10             	add    $0x10,%esp
+  8034b8:	85 c0                	test   %eax,%eax
+  8034ba:	78 3a                	js     8034f6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034bc:	83 ec 04             	sub    $0x4,%esp
+  8034bf:	68 07 04 00 00       	push   $0x407
+  8034c4:	ff 75 f4             	push   -0xc(%ebp)
+  8034c7:	6a 00                	push   $0x0
+  8034c9:	e8 ef d7 ff ff       	call   800cbd <sys_page_alloc>
+  8034ce:	83 c4 10             	add    $0x10,%esp
+  8034d1:	85 c0                	test   %eax,%eax
+  8034d3:	78 21                	js     8034f6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8034d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034d8:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8034de:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8034e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034e3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8034ea:	83 ec 0c             	sub    $0xc,%esp
+  8034ed:	50                   	push   %eax
+  8034ee:	e8 2d dc ff ff       	call   801120 <fd2num>
+  8034f3:	83 c4 10             	add    $0x10,%esp
+}
+  8034f6:	c9                   	leave
+  8034f7:	c3                   	ret
+
+008034f8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8034f8:	55                   	push   %ebp
+  8034f9:	89 e5                	mov    %esp,%ebp
+  8034fb:	56                   	push   %esi
+  8034fc:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8034fd:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803500:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803506:	e8 74 d7 ff ff       	call   800c7f <sys_getenvid>
+  80350b:	83 ec 0c             	sub    $0xc,%esp
+  80350e:	ff 75 0c             	push   0xc(%ebp)
+  803511:	ff 75 08             	push   0x8(%ebp)
+  803514:	56                   	push   %esi
+  803515:	50                   	push   %eax
+  803516:	68 2c 3f 80 00       	push   $0x803f2c
+  80351b:	e8 72 cc ff ff       	call   800192 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803520:	83 c4 18             	add    $0x18,%esp
+  803523:	53                   	push   %ebx
+  803524:	ff 75 10             	push   0x10(%ebp)
+  803527:	e8 15 cc ff ff       	call   800141 <vcprintf>
+	cprintf("\n");
+  80352c:	c7 04 24 ac 3a 80 00 	movl   $0x803aac,(%esp)
+  803533:	e8 5a cc ff ff       	call   800192 <cprintf>
+  803538:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80353b:	cc                   	int3
+	while (1)
+  80353c:	eb fd                	jmp    80353b <_panic+0x43>
+
+0080353e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80353e:	55                   	push   %ebp
+  80353f:	89 e5                	mov    %esp,%ebp
+  803541:	56                   	push   %esi
+  803542:	53                   	push   %ebx
+  803543:	8b 75 08             	mov    0x8(%ebp),%esi
+  803546:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803549:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80354c:	85 c0                	test   %eax,%eax
+  80354e:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803553:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803556:	83 ec 0c             	sub    $0xc,%esp
+  803559:	50                   	push   %eax
+  80355a:	e8 0e d9 ff ff       	call   800e6d <sys_ipc_recv>
+  80355f:	83 c4 10             	add    $0x10,%esp
+  803562:	85 c0                	test   %eax,%eax
+  803564:	0f 88 8b 00 00 00    	js     8035f5 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80356a:	85 f6                	test   %esi,%esi
+  80356c:	74 2a                	je     803598 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80356e:	89 e2                	mov    %esp,%edx
+  803570:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803575:	29 d0                	sub    %edx,%eax
+  803577:	89 c2                	mov    %eax,%edx
+  803579:	c1 ea 0f             	shr    $0xf,%edx
+  80357c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803581:	b8 00 00 00 00       	mov    $0x0,%eax
+  803586:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803589:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803590:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803596:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803598:	85 db                	test   %ebx,%ebx
+  80359a:	74 2a                	je     8035c6 <ipc_recv+0x88>
+  80359c:	89 e2                	mov    %esp,%edx
+  80359e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035a3:	29 d0                	sub    %edx,%eax
+  8035a5:	89 c2                	mov    %eax,%edx
+  8035a7:	c1 ea 0f             	shr    $0xf,%edx
+  8035aa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b4:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035b7:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035be:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035c4:	89 03                	mov    %eax,(%ebx)
+  8035c6:	89 e2                	mov    %esp,%edx
+  8035c8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035cd:	29 d0                	sub    %edx,%eax
+  8035cf:	89 c2                	mov    %eax,%edx
+  8035d1:	c1 ea 0f             	shr    $0xf,%edx
+  8035d4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035de:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035e1:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035e8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035f1:	5b                   	pop    %ebx
+  8035f2:	5e                   	pop    %esi
+  8035f3:	5d                   	pop    %ebp
+  8035f4:	c3                   	ret
+		if(from_env_store != NULL)
+  8035f5:	85 f6                	test   %esi,%esi
+  8035f7:	74 06                	je     8035ff <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035f9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035ff:	85 db                	test   %ebx,%ebx
+  803601:	74 eb                	je     8035ee <ipc_recv+0xb0>
+			*perm_store = 0;
+  803603:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803609:	eb e3                	jmp    8035ee <ipc_recv+0xb0>
+
+0080360b <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80360b:	55                   	push   %ebp
+  80360c:	89 e5                	mov    %esp,%ebp
+  80360e:	57                   	push   %edi
+  80360f:	56                   	push   %esi
+  803610:	53                   	push   %ebx
+  803611:	83 ec 14             	sub    $0x14,%esp
+  803614:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803617:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80361a:	8b 75 14             	mov    0x14(%ebp),%esi
+  80361d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803620:	85 c0                	test   %eax,%eax
+  803622:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803627:	0f 44 c2             	cmove  %edx,%eax
+  80362a:	ff 75 10             	push   0x10(%ebp)
+  80362d:	50                   	push   %eax
+  80362e:	e8 9c d8 ff ff       	call   800ecf <sys_ipc_recv_pages>
+  803633:	83 c4 10             	add    $0x10,%esp
+  803636:	85 c0                	test   %eax,%eax
+  803638:	0f 88 ba 00 00 00    	js     8036f8 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80363e:	85 ff                	test   %edi,%edi
+  803640:	74 2a                	je     80366c <ipc_recv_pages+0x61>
+  803642:	89 e2                	mov    %esp,%edx
+  803644:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803649:	29 d0                	sub    %edx,%eax
+  80364b:	89 c2                	mov    %eax,%edx
+  80364d:	c1 ea 0f             	shr    $0xf,%edx
+  803650:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80365d:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803664:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80366a:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80366c:	85 f6                	test   %esi,%esi
+  80366e:	74 2a                	je     80369a <ipc_recv_pages+0x8f>
+  803670:	89 e2                	mov    %esp,%edx
+  803672:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803677:	29 d0                	sub    %edx,%eax
+  803679:	89 c2                	mov    %eax,%edx
+  80367b:	c1 ea 0f             	shr    $0xf,%edx
+  80367e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803683:	b8 00 00 00 00       	mov    $0x0,%eax
+  803688:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80368b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803692:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803698:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80369a:	85 db                	test   %ebx,%ebx
+  80369c:	74 2a                	je     8036c8 <ipc_recv_pages+0xbd>
+  80369e:	89 e2                	mov    %esp,%edx
+  8036a0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036a5:	29 d0                	sub    %edx,%eax
+  8036a7:	89 c2                	mov    %eax,%edx
+  8036a9:	c1 ea 0f             	shr    $0xf,%edx
+  8036ac:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b6:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036b9:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036c0:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036c6:	89 03                	mov    %eax,(%ebx)
+  8036c8:	89 e2                	mov    %esp,%edx
+  8036ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036cf:	29 d0                	sub    %edx,%eax
+  8036d1:	89 c2                	mov    %eax,%edx
+  8036d3:	c1 ea 0f             	shr    $0xf,%edx
+  8036d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e0:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036e3:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036ea:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f3:	5b                   	pop    %ebx
+  8036f4:	5e                   	pop    %esi
+  8036f5:	5f                   	pop    %edi
+  8036f6:	5d                   	pop    %ebp
+  8036f7:	c3                   	ret
+		if (from_env_store)
+  8036f8:	85 ff                	test   %edi,%edi
+  8036fa:	74 06                	je     803702 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036fc:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803702:	85 f6                	test   %esi,%esi
+  803704:	74 06                	je     80370c <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803706:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80370c:	85 db                	test   %ebx,%ebx
+  80370e:	74 e0                	je     8036f0 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803710:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803716:	eb d8                	jmp    8036f0 <ipc_recv_pages+0xe5>
+
+00803718 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803718:	55                   	push   %ebp
+  803719:	89 e5                	mov    %esp,%ebp
+  80371b:	57                   	push   %edi
+  80371c:	56                   	push   %esi
+  80371d:	53                   	push   %ebx
+  80371e:	83 ec 1c             	sub    $0x1c,%esp
+  803721:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803724:	8b 75 08             	mov    0x8(%ebp),%esi
+  803727:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80372d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803731:	75 2b                	jne    80375e <ipc_try_send_pages+0x46>
+  803733:	89 e2                	mov    %esp,%edx
+  803735:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80373a:	29 d0                	sub    %edx,%eax
+  80373c:	89 c2                	mov    %eax,%edx
+  80373e:	c1 ea 0f             	shr    $0xf,%edx
+  803741:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374b:	0f 42 c2             	cmovb  %edx,%eax
+  80374e:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803755:	8b 70 48             	mov    0x48(%eax),%esi
+  803758:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80375e:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803764:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803769:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80376c:	85 ff                	test   %edi,%edi
+  80376e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803773:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803776:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80377c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803782:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803788:	83 ec 0c             	sub    $0xc,%esp
+  80378b:	ff 75 14             	push   0x14(%ebp)
+  80378e:	ff 75 18             	push   0x18(%ebp)
+  803791:	57                   	push   %edi
+  803792:	ff 75 0c             	push   0xc(%ebp)
+  803795:	ff 75 08             	push   0x8(%ebp)
+  803798:	e8 11 d7 ff ff       	call   800eae <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80379d:	83 c4 20             	add    $0x20,%esp
+  8037a0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037a3:	75 21                	jne    8037c6 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8037a5:	83 ec 04             	sub    $0x4,%esp
+  8037a8:	6a ff                	push   $0xffffffff
+  8037aa:	53                   	push   %ebx
+  8037ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8037ae:	e8 08 d9 ff ff       	call   8010bb <sys_futex_wait>
+  8037b3:	83 c4 10             	add    $0x10,%esp
+  8037b6:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037b9:	74 c7                	je     803782 <ipc_try_send_pages+0x6a>
+  8037bb:	85 c0                	test   %eax,%eax
+  8037bd:	79 c3                	jns    803782 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037bf:	e8 da d4 ff ff       	call   800c9e <sys_yield>
+  8037c4:	eb bc                	jmp    803782 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c9:	5b                   	pop    %ebx
+  8037ca:	5e                   	pop    %esi
+  8037cb:	5f                   	pop    %edi
+  8037cc:	5d                   	pop    %ebp
+  8037cd:	c3                   	ret
+
+008037ce <ipc_send>:
+{
+  8037ce:	55                   	push   %ebp
+  8037cf:	89 e5                	mov    %esp,%ebp
+  8037d1:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037d4:	ff 75 14             	push   0x14(%ebp)
+  8037d7:	6a 01                	push   $0x1
+  8037d9:	ff 75 10             	push   0x10(%ebp)
+  8037dc:	ff 75 0c             	push   0xc(%ebp)
+  8037df:	ff 75 08             	push   0x8(%ebp)
+  8037e2:	e8 31 ff ff ff       	call   803718 <ipc_try_send_pages>
+  8037e7:	83 c4 20             	add    $0x20,%esp
+  8037ea:	85 c0                	test   %eax,%eax
+  8037ec:	78 02                	js     8037f0 <ipc_send+0x22>
+}
+  8037ee:	c9                   	leave
+  8037ef:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037f0:	50                   	push   %eax
+  8037f1:	68 4f 3f 80 00       	push   $0x803f4f
+  8037f6:	6a 3f                	push   $0x3f
+  8037f8:	68 64 3f 80 00       	push   $0x803f64
+  8037fd:	e8 f6 fc ff ff       	call   8034f8 <_panic>
+
+00803802 <ipc_send_pages>:
+{
+  803802:	55                   	push   %ebp
+  803803:	89 e5                	mov    %esp,%ebp
+  803805:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803808:	ff 75 18             	push   0x18(%ebp)
+  80380b:	ff 75 14             	push   0x14(%ebp)
+  80380e:	ff 75 10             	push   0x10(%ebp)
+  803811:	ff 75 0c             	push   0xc(%ebp)
+  803814:	ff 75 08             	push   0x8(%ebp)
+  803817:	e8 fc fe ff ff       	call   803718 <ipc_try_send_pages>
+  80381c:	83 c4 20             	add    $0x20,%esp
+  80381f:	85 c0                	test   %eax,%eax
+  803821:	78 02                	js     803825 <ipc_send_pages+0x23>
+}
+  803823:	c9                   	leave
+  803824:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803825:	50                   	push   %eax
+  803826:	68 6e 3f 80 00       	push   $0x803f6e
+  80382b:	6a 64                	push   $0x64
+  80382d:	68 64 3f 80 00       	push   $0x803f64
+  803832:	e8 c1 fc ff ff       	call   8034f8 <_panic>
+
+00803837 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803837:	55                   	push   %ebp
+  803838:	89 e5                	mov    %esp,%ebp
+  80383a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80383d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803842:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803848:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80384e:	8b 52 50             	mov    0x50(%edx),%edx
+  803851:	39 ca                	cmp    %ecx,%edx
+  803853:	74 11                	je     803866 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803855:	83 c0 01             	add    $0x1,%eax
+  803858:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80385d:	75 e3                	jne    803842 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80385f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803864:	eb 0e                	jmp    803874 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803866:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80386c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803871:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803874:	5d                   	pop    %ebp
+  803875:	c3                   	ret
+
+00803876 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803876:	55                   	push   %ebp
+  803877:	89 e5                	mov    %esp,%ebp
+  803879:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80387c:	89 c2                	mov    %eax,%edx
+  80387e:	c1 ea 16             	shr    $0x16,%edx
+  803881:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803888:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80388d:	f6 c1 01             	test   $0x1,%cl
+  803890:	74 1e                	je     8038b0 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803892:	c1 e8 0c             	shr    $0xc,%eax
+  803895:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80389c:	a8 01                	test   $0x1,%al
+  80389e:	74 10                	je     8038b0 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8038a0:	c1 e8 0c             	shr    $0xc,%eax
+  8038a3:	c1 e0 04             	shl    $0x4,%eax
+  8038a6:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8038ad:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038b0:	89 d0                	mov    %edx,%eax
+  8038b2:	5d                   	pop    %ebp
+  8038b3:	c3                   	ret
+
+008038b4 <__udivdi3>:
+  8038b4:	57                   	push   %edi
+  8038b5:	56                   	push   %esi
+  8038b6:	53                   	push   %ebx
+  8038b7:	83 ec 20             	sub    $0x20,%esp
+  8038ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038be:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038c2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038c6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038ce:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038d2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038d6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038da:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038e9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038f0:	00 
+  8038f1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038f8:	00 
+  8038f9:	eb 08                	jmp    803903 <__udivdi3+0x4f>
+  8038fb:	83 e9 01             	sub    $0x1,%ecx
+  8038fe:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803901:	74 68                	je     80396b <__udivdi3+0xb7>
+  803903:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803907:	01 c0                	add    %eax,%eax
+  803909:	89 c6                	mov    %eax,%esi
+  80390b:	89 d7                	mov    %edx,%edi
+  80390d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803911:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803915:	0f ad d0             	shrd   %cl,%edx,%eax
+  803918:	d3 ea                	shr    %cl,%edx
+  80391a:	f6 c1 20             	test   $0x20,%cl
+  80391d:	74 04                	je     803923 <__udivdi3+0x6f>
+  80391f:	89 d0                	mov    %edx,%eax
+  803921:	31 d2                	xor    %edx,%edx
+  803923:	83 e0 01             	and    $0x1,%eax
+  803926:	89 04 24             	mov    %eax,(%esp)
+  803929:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803930:	00 
+  803931:	8b 04 24             	mov    (%esp),%eax
+  803934:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803938:	09 f0                	or     %esi,%eax
+  80393a:	09 fa                	or     %edi,%edx
+  80393c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803940:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803944:	39 f0                	cmp    %esi,%eax
+  803946:	89 d3                	mov    %edx,%ebx
+  803948:	19 fb                	sbb    %edi,%ebx
+  80394a:	72 af                	jb     8038fb <__udivdi3+0x47>
+  80394c:	29 f0                	sub    %esi,%eax
+  80394e:	19 fa                	sbb    %edi,%edx
+  803950:	89 cf                	mov    %ecx,%edi
+  803952:	c1 ef 05             	shr    $0x5,%edi
+  803955:	83 e7 01             	and    $0x1,%edi
+  803958:	89 fe                	mov    %edi,%esi
+  80395a:	83 f6 01             	xor    $0x1,%esi
+  80395d:	d3 e6                	shl    %cl,%esi
+  80395f:	d3 e7                	shl    %cl,%edi
+  803961:	09 74 24 18          	or     %esi,0x18(%esp)
+  803965:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803969:	eb 90                	jmp    8038fb <__udivdi3+0x47>
+  80396b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80396f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803973:	83 c4 20             	add    $0x20,%esp
+  803976:	5b                   	pop    %ebx
+  803977:	5e                   	pop    %esi
+  803978:	5f                   	pop    %edi
+  803979:	c3                   	ret
+
+0080397a <__umoddi3>:
+  80397a:	57                   	push   %edi
+  80397b:	56                   	push   %esi
+  80397c:	53                   	push   %ebx
+  80397d:	83 ec 08             	sub    $0x8,%esp
+  803980:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803984:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803988:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80398c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803990:	57                   	push   %edi
+  803991:	56                   	push   %esi
+  803992:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803996:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80399a:	52                   	push   %edx
+  80399b:	50                   	push   %eax
+  80399c:	e8 13 ff ff ff       	call   8038b4 <__udivdi3>
+  8039a1:	89 c3                	mov    %eax,%ebx
+  8039a3:	0f af d6             	imul   %esi,%edx
+  8039a6:	89 f9                	mov    %edi,%ecx
+  8039a8:	0f af cb             	imul   %ebx,%ecx
+  8039ab:	01 d1                	add    %edx,%ecx
+  8039ad:	89 d8                	mov    %ebx,%eax
+  8039af:	f7 e6                	mul    %esi
+  8039b1:	89 c6                	mov    %eax,%esi
+  8039b3:	89 d7                	mov    %edx,%edi
+  8039b5:	01 cf                	add    %ecx,%edi
+  8039b7:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039bb:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039bf:	29 f0                	sub    %esi,%eax
+  8039c1:	19 fa                	sbb    %edi,%edx
+  8039c3:	83 c4 18             	add    $0x18,%esp
+  8039c6:	5b                   	pop    %ebx
+  8039c7:	5e                   	pop    %esi
+  8039c8:	5f                   	pop    %edi
+  8039c9:	c3                   	ret
+
+008039ca <__divdi3>:
+  8039ca:	53                   	push   %ebx
+  8039cb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039cf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039d3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039d7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039db:	85 d2                	test   %edx,%edx
+  8039dd:	78 12                	js     8039f1 <__divdi3+0x27>
+  8039df:	85 db                	test   %ebx,%ebx
+  8039e1:	78 2e                	js     803a11 <__divdi3+0x47>
+  8039e3:	53                   	push   %ebx
+  8039e4:	51                   	push   %ecx
+  8039e5:	52                   	push   %edx
+  8039e6:	50                   	push   %eax
+  8039e7:	e8 c8 fe ff ff       	call   8038b4 <__udivdi3>
+  8039ec:	83 c4 10             	add    $0x10,%esp
+  8039ef:	eb 1e                	jmp    803a0f <__divdi3+0x45>
+  8039f1:	f7 d8                	neg    %eax
+  8039f3:	83 d2 00             	adc    $0x0,%edx
+  8039f6:	f7 da                	neg    %edx
+  8039f8:	85 db                	test   %ebx,%ebx
+  8039fa:	78 2a                	js     803a26 <__divdi3+0x5c>
+  8039fc:	53                   	push   %ebx
+  8039fd:	51                   	push   %ecx
+  8039fe:	52                   	push   %edx
+  8039ff:	50                   	push   %eax
+  803a00:	e8 af fe ff ff       	call   8038b4 <__udivdi3>
+  803a05:	83 c4 10             	add    $0x10,%esp
+  803a08:	f7 d8                	neg    %eax
+  803a0a:	83 d2 00             	adc    $0x0,%edx
+  803a0d:	f7 da                	neg    %edx
+  803a0f:	5b                   	pop    %ebx
+  803a10:	c3                   	ret
+  803a11:	f7 d9                	neg    %ecx
+  803a13:	83 d3 00             	adc    $0x0,%ebx
+  803a16:	f7 db                	neg    %ebx
+  803a18:	53                   	push   %ebx
+  803a19:	51                   	push   %ecx
+  803a1a:	52                   	push   %edx
+  803a1b:	50                   	push   %eax
+  803a1c:	e8 93 fe ff ff       	call   8038b4 <__udivdi3>
+  803a21:	83 c4 10             	add    $0x10,%esp
+  803a24:	eb e2                	jmp    803a08 <__divdi3+0x3e>
+  803a26:	f7 d9                	neg    %ecx
+  803a28:	83 d3 00             	adc    $0x0,%ebx
+  803a2b:	f7 db                	neg    %ebx
+  803a2d:	53                   	push   %ebx
+  803a2e:	51                   	push   %ecx
+  803a2f:	52                   	push   %edx
+  803a30:	50                   	push   %eax
+  803a31:	e8 7e fe ff ff       	call   8038b4 <__udivdi3>
+  803a36:	83 c4 10             	add    $0x10,%esp
+  803a39:	eb d4                	jmp    803a0f <__divdi3+0x45>
+
+00803a3b <__moddi3>:
+  803a3b:	57                   	push   %edi
+  803a3c:	56                   	push   %esi
+  803a3d:	53                   	push   %ebx
+  803a3e:	83 ec 08             	sub    $0x8,%esp
+  803a41:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a45:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a49:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a4d:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a51:	57                   	push   %edi
+  803a52:	56                   	push   %esi
+  803a53:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a57:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a5b:	52                   	push   %edx
+  803a5c:	50                   	push   %eax
+  803a5d:	e8 68 ff ff ff       	call   8039ca <__divdi3>
+  803a62:	89 c3                	mov    %eax,%ebx
+  803a64:	0f af d6             	imul   %esi,%edx
+  803a67:	89 f9                	mov    %edi,%ecx
+  803a69:	0f af cb             	imul   %ebx,%ecx
+  803a6c:	01 d1                	add    %edx,%ecx
+  803a6e:	89 d8                	mov    %ebx,%eax
+  803a70:	f7 e6                	mul    %esi
+  803a72:	89 c6                	mov    %eax,%esi
+  803a74:	89 d7                	mov    %edx,%edi
+  803a76:	01 cf                	add    %ecx,%edi
+  803a78:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a7c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a80:	29 f0                	sub    %esi,%eax
+  803a82:	19 fa                	sbb    %edi,%edx
+  803a84:	83 c4 18             	add    $0x18,%esp
+  803a87:	5b                   	pop    %ebx
+  803a88:	5e                   	pop    %esi
+  803a89:	5f                   	pop    %edi
+  803a8a:	c3                   	ret
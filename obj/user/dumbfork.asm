@@ -0,0 +1,8071 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d0 01 00 00       	call   800201 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  800040:	83 ec 04             	sub    $0x4,%esp
+  800043:	6a 07                	push   $0x7
+  800045:	53                   	push   %ebx
+  800046:	56                   	push   %esi
+  800047:	e8 62 0e 00 00       	call   800eae <sys_page_alloc>
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	85 c0                	test   %eax,%eax
+  800051:	78 4a                	js     80009d <duppage+0x68>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800053:	83 ec 0c             	sub    $0xc,%esp
+  800056:	6a 07                	push   $0x7
+  800058:	68 00 00 40 00       	push   $0x400000
+  80005d:	6a 00                	push   $0x0
+  80005f:	53                   	push   %ebx
+  800060:	56                   	push   %esi
+  800061:	e8 8b 0e 00 00       	call   800ef1 <sys_page_map>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	85 c0                	test   %eax,%eax
+  80006b:	78 42                	js     8000af <duppage+0x7a>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006d:	83 ec 04             	sub    $0x4,%esp
+  800070:	68 00 10 00 00       	push   $0x1000
+  800075:	53                   	push   %ebx
+  800076:	68 00 00 40 00       	push   $0x400000
+  80007b:	e8 aa 0b 00 00       	call   800c2a <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  800080:	83 c4 08             	add    $0x8,%esp
+  800083:	68 00 00 40 00       	push   $0x400000
+  800088:	6a 00                	push   $0x0
+  80008a:	e8 a4 0e 00 00       	call   800f33 <sys_page_unmap>
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	85 c0                	test   %eax,%eax
+  800094:	78 2b                	js     8000c1 <duppage+0x8c>
+		panic("sys_page_unmap: %e", r);
+}
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80009d:	50                   	push   %eax
+  80009e:	68 40 3c 80 00       	push   $0x803c40
+  8000a3:	6a 20                	push   $0x20
+  8000a5:	68 53 3c 80 00       	push   $0x803c53
+  8000aa:	e8 f9 01 00 00       	call   8002a8 <_panic>
+		panic("sys_page_map: %e", r);
+  8000af:	50                   	push   %eax
+  8000b0:	68 63 3c 80 00       	push   $0x803c63
+  8000b5:	6a 22                	push   $0x22
+  8000b7:	68 53 3c 80 00       	push   $0x803c53
+  8000bc:	e8 e7 01 00 00       	call   8002a8 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8000c1:	50                   	push   %eax
+  8000c2:	68 74 3c 80 00       	push   $0x803c74
+  8000c7:	6a 25                	push   $0x25
+  8000c9:	68 53 3c 80 00       	push   $0x803c53
+  8000ce:	e8 d5 01 00 00       	call   8002a8 <_panic>
+
+008000d3 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	53                   	push   %ebx
+  8000d7:	83 ec 14             	sub    $0x14,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8000da:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000df:	cd 30                	int    $0x30
+  8000e1:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e3:	85 c0                	test   %eax,%eax
+  8000e5:	78 66                	js     80014d <dumbfork+0x7a>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e7:	74 76                	je     80015f <dumbfork+0x8c>
+	}
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  8000e9:	c7 45 f4 00 00 80 00 	movl   $0x800000,-0xc(%ebp)
+  8000f0:	b8 00 90 80 00       	mov    $0x809000,%eax
+  8000f5:	3d 00 00 80 00       	cmp    $0x800000,%eax
+  8000fa:	76 26                	jbe    800122 <dumbfork+0x4f>
+  8000fc:	ba 00 00 80 00       	mov    $0x800000,%edx
+		duppage(envid, addr);
+  800101:	83 ec 08             	sub    $0x8,%esp
+  800104:	52                   	push   %edx
+  800105:	53                   	push   %ebx
+  800106:	e8 2a ff ff ff       	call   800035 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  80010b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80010e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800114:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	81 fa 00 90 80 00    	cmp    $0x809000,%edx
+  800120:	72 df                	jb     800101 <dumbfork+0x2e>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  800122:	83 ec 08             	sub    $0x8,%esp
+  800125:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800128:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80012d:	50                   	push   %eax
+  80012e:	53                   	push   %ebx
+  80012f:	e8 01 ff ff ff       	call   800035 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  800134:	83 c4 08             	add    $0x8,%esp
+  800137:	6a 02                	push   $0x2
+  800139:	53                   	push   %ebx
+  80013a:	e8 36 0e 00 00       	call   800f75 <sys_env_set_status>
+  80013f:	83 c4 10             	add    $0x10,%esp
+  800142:	85 c0                	test   %eax,%eax
+  800144:	78 53                	js     800199 <dumbfork+0xc6>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  800146:	89 d8                	mov    %ebx,%eax
+  800148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80014b:	c9                   	leave
+  80014c:	c3                   	ret
+		panic("sys_exofork: %e", envid);
+  80014d:	50                   	push   %eax
+  80014e:	68 87 3c 80 00       	push   $0x803c87
+  800153:	6a 37                	push   $0x37
+  800155:	68 53 3c 80 00       	push   $0x803c53
+  80015a:	e8 49 01 00 00       	call   8002a8 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80015f:	e8 0c 0d 00 00       	call   800e70 <sys_getenvid>
+  800164:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800169:	89 e1                	mov    %esp,%ecx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80016b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800170:	29 ca                	sub    %ecx,%edx
+  800172:	89 d1                	mov    %edx,%ecx
+  800174:	c1 e9 0f             	shr    $0xf,%ecx
+  800177:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80017d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800182:	0f 42 d1             	cmovb  %ecx,%edx
+  800185:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80018b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800190:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+		return 0;
+  800197:	eb ad                	jmp    800146 <dumbfork+0x73>
+		panic("sys_env_set_status: %e", r);
+  800199:	50                   	push   %eax
+  80019a:	68 97 3c 80 00       	push   $0x803c97
+  80019f:	6a 4c                	push   $0x4c
+  8001a1:	68 53 3c 80 00       	push   $0x803c53
+  8001a6:	e8 fd 00 00 00       	call   8002a8 <_panic>
+
+008001ab <umain>:
+{
+  8001ab:	55                   	push   %ebp
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	57                   	push   %edi
+  8001af:	56                   	push   %esi
+  8001b0:	53                   	push   %ebx
+  8001b1:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  8001b4:	e8 1a ff ff ff       	call   8000d3 <dumbfork>
+  8001b9:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001bb:	85 c0                	test   %eax,%eax
+  8001bd:	bf ae 3c 80 00       	mov    $0x803cae,%edi
+  8001c2:	b8 b5 3c 80 00       	mov    $0x803cb5,%eax
+  8001c7:	0f 44 f8             	cmove  %eax,%edi
+  8001ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001cf:	eb 1f                	jmp    8001f0 <umain+0x45>
+  8001d1:	83 fb 13             	cmp    $0x13,%ebx
+  8001d4:	7f 23                	jg     8001f9 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001d6:	83 ec 04             	sub    $0x4,%esp
+  8001d9:	57                   	push   %edi
+  8001da:	53                   	push   %ebx
+  8001db:	68 bb 3c 80 00       	push   $0x803cbb
+  8001e0:	e8 9e 01 00 00       	call   800383 <cprintf>
+		sys_yield();
+  8001e5:	e8 a5 0c 00 00       	call   800e8f <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001ea:	83 c3 01             	add    $0x1,%ebx
+  8001ed:	83 c4 10             	add    $0x10,%esp
+  8001f0:	85 f6                	test   %esi,%esi
+  8001f2:	74 dd                	je     8001d1 <umain+0x26>
+  8001f4:	83 fb 09             	cmp    $0x9,%ebx
+  8001f7:	7e dd                	jle    8001d6 <umain+0x2b>
+}
+  8001f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fc:	5b                   	pop    %ebx
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5f                   	pop    %edi
+  8001ff:	5d                   	pop    %ebp
+  800200:	c3                   	ret
+
+00800201 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	56                   	push   %esi
+  800205:	53                   	push   %ebx
+  800206:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800209:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80020c:	89 e2                	mov    %esp,%edx
+  80020e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800213:	29 d0                	sub    %edx,%eax
+  800215:	89 c2                	mov    %eax,%edx
+  800217:	c1 ea 0f             	shr    $0xf,%edx
+  80021a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80021f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800224:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800227:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  80022e:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800232:	e8 39 0c 00 00       	call   800e70 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800237:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80023c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800242:	89 e1                	mov    %esp,%ecx
+  800244:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800249:	29 ca                	sub    %ecx,%edx
+  80024b:	89 d1                	mov    %edx,%ecx
+  80024d:	c1 e9 0f             	shr    $0xf,%ecx
+  800250:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025b:	0f 42 d1             	cmovb  %ecx,%edx
+  80025e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800263:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80026a:	85 db                	test   %ebx,%ebx
+  80026c:	7e 07                	jle    800275 <libmain+0x74>
+		binaryname = argv[0];
+  80026e:	8b 06                	mov    (%esi),%eax
+  800270:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800275:	83 ec 08             	sub    $0x8,%esp
+  800278:	56                   	push   %esi
+  800279:	53                   	push   %ebx
+  80027a:	e8 2c ff ff ff       	call   8001ab <umain>
+
+	// exit gracefully
+	exit();
+  80027f:	e8 0a 00 00 00       	call   80028e <exit>
+}
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80028a:	5b                   	pop    %ebx
+  80028b:	5e                   	pop    %esi
+  80028c:	5d                   	pop    %ebp
+  80028d:	c3                   	ret
+
+0080028e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80028e:	55                   	push   %ebp
+  80028f:	89 e5                	mov    %esp,%ebp
+  800291:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800294:	e8 61 12 00 00       	call   8014fa <close_all>
+	sys_env_destroy(0);
+  800299:	83 ec 0c             	sub    $0xc,%esp
+  80029c:	6a 00                	push   $0x0
+  80029e:	e8 8c 0b 00 00       	call   800e2f <sys_env_destroy>
+}
+  8002a3:	83 c4 10             	add    $0x10,%esp
+  8002a6:	c9                   	leave
+  8002a7:	c3                   	ret
+
+008002a8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	56                   	push   %esi
+  8002ac:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002ad:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002b0:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002b6:	e8 b5 0b 00 00       	call   800e70 <sys_getenvid>
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	ff 75 0c             	push   0xc(%ebp)
+  8002c1:	ff 75 08             	push   0x8(%ebp)
+  8002c4:	56                   	push   %esi
+  8002c5:	50                   	push   %eax
+  8002c6:	68 d8 3c 80 00       	push   $0x803cd8
+  8002cb:	e8 b3 00 00 00       	call   800383 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002d0:	83 c4 18             	add    $0x18,%esp
+  8002d3:	53                   	push   %ebx
+  8002d4:	ff 75 10             	push   0x10(%ebp)
+  8002d7:	e8 56 00 00 00       	call   800332 <vcprintf>
+	cprintf("\n");
+  8002dc:	c7 04 24 cb 3c 80 00 	movl   $0x803ccb,(%esp)
+  8002e3:	e8 9b 00 00 00       	call   800383 <cprintf>
+  8002e8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002eb:	cc                   	int3
+	while (1)
+  8002ec:	eb fd                	jmp    8002eb <_panic+0x43>
+
+008002ee <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002ee:	55                   	push   %ebp
+  8002ef:	89 e5                	mov    %esp,%ebp
+  8002f1:	53                   	push   %ebx
+  8002f2:	83 ec 04             	sub    $0x4,%esp
+  8002f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002f8:	8b 13                	mov    (%ebx),%edx
+  8002fa:	8d 42 01             	lea    0x1(%edx),%eax
+  8002fd:	89 03                	mov    %eax,(%ebx)
+  8002ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800302:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800306:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80030b:	74 09                	je     800316 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80030d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	68 ff 00 00 00       	push   $0xff
+  80031e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800321:	50                   	push   %eax
+  800322:	e8 cb 0a 00 00       	call   800df2 <sys_cputs>
+		b->idx = 0;
+  800327:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80032d:	83 c4 10             	add    $0x10,%esp
+  800330:	eb db                	jmp    80030d <putch+0x1f>
+
+00800332 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80033b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800342:	00 00 00 
+	b.cnt = 0;
+  800345:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80034c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80034f:	ff 75 0c             	push   0xc(%ebp)
+  800352:	ff 75 08             	push   0x8(%ebp)
+  800355:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80035b:	50                   	push   %eax
+  80035c:	68 ee 02 80 00       	push   $0x8002ee
+  800361:	e8 1c 01 00 00       	call   800482 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800366:	83 c4 08             	add    $0x8,%esp
+  800369:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80036f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800375:	50                   	push   %eax
+  800376:	e8 77 0a 00 00       	call   800df2 <sys_cputs>
+
+	return b.cnt;
+}
+  80037b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800381:	c9                   	leave
+  800382:	c3                   	ret
+
+00800383 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800383:	55                   	push   %ebp
+  800384:	89 e5                	mov    %esp,%ebp
+  800386:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800389:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80038c:	50                   	push   %eax
+  80038d:	ff 75 08             	push   0x8(%ebp)
+  800390:	e8 9d ff ff ff       	call   800332 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800395:	c9                   	leave
+  800396:	c3                   	ret
+
+00800397 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800397:	55                   	push   %ebp
+  800398:	89 e5                	mov    %esp,%ebp
+  80039a:	57                   	push   %edi
+  80039b:	56                   	push   %esi
+  80039c:	53                   	push   %ebx
+  80039d:	83 ec 1c             	sub    $0x1c,%esp
+  8003a0:	89 c3                	mov    %eax,%ebx
+  8003a2:	89 d6                	mov    %edx,%esi
+  8003a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003aa:	89 d1                	mov    %edx,%ecx
+  8003ac:	89 c2                	mov    %eax,%edx
+  8003ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003b1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003b4:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ba:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003c1:	39 c2                	cmp    %eax,%edx
+  8003c3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003c6:	73 4b                	jae    800413 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8003c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cb:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003ce:	85 ff                	test   %edi,%edi
+  8003d0:	7e 11                	jle    8003e3 <printnum+0x4c>
+			putch(padc, putdat);
+  8003d2:	83 ec 08             	sub    $0x8,%esp
+  8003d5:	56                   	push   %esi
+  8003d6:	ff 75 18             	push   0x18(%ebp)
+  8003d9:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8003db:	83 c4 10             	add    $0x10,%esp
+  8003de:	83 ef 01             	sub    $0x1,%edi
+  8003e1:	75 ef                	jne    8003d2 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003e3:	83 ec 08             	sub    $0x8,%esp
+  8003e6:	56                   	push   %esi
+  8003e7:	83 ec 04             	sub    $0x4,%esp
+  8003ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ed:	ff 75 e0             	push   -0x20(%ebp)
+  8003f0:	ff 75 dc             	push   -0x24(%ebp)
+  8003f3:	ff 75 d8             	push   -0x28(%ebp)
+  8003f6:	e8 2a 37 00 00       	call   803b25 <__umoddi3>
+  8003fb:	83 c4 14             	add    $0x14,%esp
+  8003fe:	0f be 80 fb 3c 80 00 	movsbl 0x803cfb(%eax),%eax
+  800405:	50                   	push   %eax
+  800406:	ff d3                	call   *%ebx
+}
+  800408:	83 c4 10             	add    $0x10,%esp
+  80040b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040e:	5b                   	pop    %ebx
+  80040f:	5e                   	pop    %esi
+  800410:	5f                   	pop    %edi
+  800411:	5d                   	pop    %ebp
+  800412:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800413:	83 ec 0c             	sub    $0xc,%esp
+  800416:	ff 75 18             	push   0x18(%ebp)
+  800419:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80041c:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80041f:	52                   	push   %edx
+  800420:	50                   	push   %eax
+  800421:	83 ec 08             	sub    $0x8,%esp
+  800424:	ff 75 e4             	push   -0x1c(%ebp)
+  800427:	ff 75 e0             	push   -0x20(%ebp)
+  80042a:	ff 75 dc             	push   -0x24(%ebp)
+  80042d:	ff 75 d8             	push   -0x28(%ebp)
+  800430:	e8 2a 36 00 00       	call   803a5f <__udivdi3>
+  800435:	83 c4 18             	add    $0x18,%esp
+  800438:	52                   	push   %edx
+  800439:	50                   	push   %eax
+  80043a:	89 f2                	mov    %esi,%edx
+  80043c:	89 d8                	mov    %ebx,%eax
+  80043e:	e8 54 ff ff ff       	call   800397 <printnum>
+  800443:	83 c4 20             	add    $0x20,%esp
+  800446:	eb 9b                	jmp    8003e3 <printnum+0x4c>
+
+00800448 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800448:	55                   	push   %ebp
+  800449:	89 e5                	mov    %esp,%ebp
+  80044b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80044e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800452:	8b 10                	mov    (%eax),%edx
+  800454:	3b 50 04             	cmp    0x4(%eax),%edx
+  800457:	73 0a                	jae    800463 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800459:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80045c:	89 08                	mov    %ecx,(%eax)
+  80045e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800461:	88 02                	mov    %al,(%edx)
+}
+  800463:	5d                   	pop    %ebp
+  800464:	c3                   	ret
+
+00800465 <printfmt>:
+{
+  800465:	55                   	push   %ebp
+  800466:	89 e5                	mov    %esp,%ebp
+  800468:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80046b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80046e:	50                   	push   %eax
+  80046f:	ff 75 10             	push   0x10(%ebp)
+  800472:	ff 75 0c             	push   0xc(%ebp)
+  800475:	ff 75 08             	push   0x8(%ebp)
+  800478:	e8 05 00 00 00       	call   800482 <vprintfmt>
+}
+  80047d:	83 c4 10             	add    $0x10,%esp
+  800480:	c9                   	leave
+  800481:	c3                   	ret
+
+00800482 <vprintfmt>:
+{
+  800482:	55                   	push   %ebp
+  800483:	89 e5                	mov    %esp,%ebp
+  800485:	57                   	push   %edi
+  800486:	56                   	push   %esi
+  800487:	53                   	push   %ebx
+  800488:	83 ec 2c             	sub    $0x2c,%esp
+  80048b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80048e:	89 df                	mov    %ebx,%edi
+  800490:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800493:	8b 45 10             	mov    0x10(%ebp),%eax
+  800496:	8d 70 01             	lea    0x1(%eax),%esi
+  800499:	0f b6 00             	movzbl (%eax),%eax
+  80049c:	83 f8 25             	cmp    $0x25,%eax
+  80049f:	74 1e                	je     8004bf <vprintfmt+0x3d>
+			if (ch == '\0')
+  8004a1:	85 c0                	test   %eax,%eax
+  8004a3:	0f 84 15 05 00 00    	je     8009be <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8004a9:	83 ec 08             	sub    $0x8,%esp
+  8004ac:	53                   	push   %ebx
+  8004ad:	50                   	push   %eax
+  8004ae:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004b0:	83 c6 01             	add    $0x1,%esi
+  8004b3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b7:	83 c4 10             	add    $0x10,%esp
+  8004ba:	83 f8 25             	cmp    $0x25,%eax
+  8004bd:	75 e2                	jne    8004a1 <vprintfmt+0x1f>
+		padc = ' ';
+  8004bf:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8004c3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004ca:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8004d1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8004d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004dd:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e0:	8d 56 01             	lea    0x1(%esi),%edx
+  8004e3:	0f b6 0e             	movzbl (%esi),%ecx
+  8004e6:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004e9:	3c 55                	cmp    $0x55,%al
+  8004eb:	0f 87 3b 04 00 00    	ja     80092c <vprintfmt+0x4aa>
+  8004f1:	0f b6 c0             	movzbl %al,%eax
+  8004f4:	ff 24 85 60 3e 80 00 	jmp    *0x803e60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8004fb:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004fe:	eb 93                	jmp    800493 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800500:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800502:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800506:	eb d8                	jmp    8004e0 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800508:	89 d6                	mov    %edx,%esi
+  80050a:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80050e:	eb d0                	jmp    8004e0 <vprintfmt+0x5e>
+  800510:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800513:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800516:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800519:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80051d:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800520:	83 f9 09             	cmp    $0x9,%ecx
+  800523:	77 6f                	ja     800594 <vprintfmt+0x112>
+  800525:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800528:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80052b:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80052e:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800532:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800535:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800538:	83 fe 09             	cmp    $0x9,%esi
+  80053b:	76 eb                	jbe    800528 <vprintfmt+0xa6>
+  80053d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800540:	89 d6                	mov    %edx,%esi
+  800542:	eb 13                	jmp    800557 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800544:	8b 45 14             	mov    0x14(%ebp),%eax
+  800547:	8b 00                	mov    (%eax),%eax
+  800549:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8d 40 04             	lea    0x4(%eax),%eax
+  800552:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800555:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800557:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80055b:	79 83                	jns    8004e0 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80055d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800560:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800563:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80056a:	e9 71 ff ff ff       	jmp    8004e0 <vprintfmt+0x5e>
+			if (width < 0)
+  80056f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800572:	85 c9                	test   %ecx,%ecx
+  800574:	b8 00 00 00 00       	mov    $0x0,%eax
+  800579:	0f 49 c1             	cmovns %ecx,%eax
+  80057c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80057f:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800581:	e9 5a ff ff ff       	jmp    8004e0 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800586:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800588:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80058f:	e9 4c ff ff ff       	jmp    8004e0 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800594:	89 d6                	mov    %edx,%esi
+  800596:	eb bf                	jmp    800557 <vprintfmt+0xd5>
+			lflag++;
+  800598:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80059c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80059e:	e9 3d ff ff ff       	jmp    8004e0 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8005a3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8d 70 04             	lea    0x4(%eax),%esi
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	53                   	push   %ebx
+  8005b0:	ff 30                	push   (%eax)
+  8005b2:	ff d7                	call   *%edi
+			break;
+  8005b4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005b7:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8005ba:	e9 d4 fe ff ff       	jmp    800493 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8005bf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8005c8:	8b 10                	mov    (%eax),%edx
+  8005ca:	89 d0                	mov    %edx,%eax
+  8005cc:	f7 d8                	neg    %eax
+  8005ce:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005d1:	83 f8 12             	cmp    $0x12,%eax
+  8005d4:	7f 23                	jg     8005f9 <vprintfmt+0x177>
+  8005d6:	8b 14 85 c0 3f 80 00 	mov    0x803fc0(,%eax,4),%edx
+  8005dd:	85 d2                	test   %edx,%edx
+  8005df:	74 18                	je     8005f9 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8005e1:	52                   	push   %edx
+  8005e2:	68 1b 41 80 00       	push   $0x80411b
+  8005e7:	53                   	push   %ebx
+  8005e8:	57                   	push   %edi
+  8005e9:	e8 77 fe ff ff       	call   800465 <printfmt>
+  8005ee:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005f1:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005f4:	e9 9a fe ff ff       	jmp    800493 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8005f9:	50                   	push   %eax
+  8005fa:	68 13 3d 80 00       	push   $0x803d13
+  8005ff:	53                   	push   %ebx
+  800600:	57                   	push   %edi
+  800601:	e8 5f fe ff ff       	call   800465 <printfmt>
+  800606:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800609:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80060c:	e9 82 fe ff ff       	jmp    800493 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800611:	89 55 10             	mov    %edx,0x10(%ebp)
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	83 c0 04             	add    $0x4,%eax
+  80061a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 00                	mov    (%eax),%eax
+  800622:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800625:	85 c0                	test   %eax,%eax
+  800627:	0f 84 61 03 00 00    	je     80098e <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80062d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800631:	7e 06                	jle    800639 <vprintfmt+0x1b7>
+  800633:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800637:	75 29                	jne    800662 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800639:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80063c:	8d 70 01             	lea    0x1(%eax),%esi
+  80063f:	0f b6 00             	movzbl (%eax),%eax
+  800642:	0f be d0             	movsbl %al,%edx
+  800645:	85 d2                	test   %edx,%edx
+  800647:	0f 84 bb 00 00 00    	je     800708 <vprintfmt+0x286>
+  80064d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800650:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800653:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800656:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800659:	eb 7a                	jmp    8006d5 <vprintfmt+0x253>
+				p = "(null)";
+  80065b:	c7 45 d0 0c 3d 80 00 	movl   $0x803d0c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800662:	83 ec 08             	sub    $0x8,%esp
+  800665:	ff 75 d4             	push   -0x2c(%ebp)
+  800668:	ff 75 d0             	push   -0x30(%ebp)
+  80066b:	e8 e0 03 00 00       	call   800a50 <strnlen>
+  800670:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800673:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800676:	83 c4 10             	add    $0x10,%esp
+  800679:	85 d2                	test   %edx,%edx
+  80067b:	0f 8e d6 02 00 00    	jle    800957 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800681:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800685:	83 ec 08             	sub    $0x8,%esp
+  800688:	53                   	push   %ebx
+  800689:	56                   	push   %esi
+  80068a:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80068c:	83 c4 10             	add    $0x10,%esp
+  80068f:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800693:	75 f0                	jne    800685 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800695:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800698:	8d 70 01             	lea    0x1(%eax),%esi
+  80069b:	0f b6 00             	movzbl (%eax),%eax
+  80069e:	0f be d0             	movsbl %al,%edx
+  8006a1:	85 d2                	test   %edx,%edx
+  8006a3:	0f 84 da 02 00 00    	je     800983 <vprintfmt+0x501>
+  8006a9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006ac:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006af:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006b2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006b5:	eb 1e                	jmp    8006d5 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	ff 75 0c             	push   0xc(%ebp)
+  8006bd:	52                   	push   %edx
+  8006be:	ff 55 08             	call   *0x8(%ebp)
+  8006c1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006c4:	83 eb 01             	sub    $0x1,%ebx
+  8006c7:	83 c6 01             	add    $0x1,%esi
+  8006ca:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006ce:	0f be d0             	movsbl %al,%edx
+  8006d1:	85 d2                	test   %edx,%edx
+  8006d3:	74 2a                	je     8006ff <vprintfmt+0x27d>
+  8006d5:	85 ff                	test   %edi,%edi
+  8006d7:	78 05                	js     8006de <vprintfmt+0x25c>
+  8006d9:	83 ef 01             	sub    $0x1,%edi
+  8006dc:	78 59                	js     800737 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006de:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006e2:	74 d3                	je     8006b7 <vprintfmt+0x235>
+  8006e4:	0f be c0             	movsbl %al,%eax
+  8006e7:	83 e8 20             	sub    $0x20,%eax
+  8006ea:	83 f8 5e             	cmp    $0x5e,%eax
+  8006ed:	76 c8                	jbe    8006b7 <vprintfmt+0x235>
+					putch('?', putdat);
+  8006ef:	83 ec 08             	sub    $0x8,%esp
+  8006f2:	ff 75 0c             	push   0xc(%ebp)
+  8006f5:	6a 3f                	push   $0x3f
+  8006f7:	ff 55 08             	call   *0x8(%ebp)
+  8006fa:	83 c4 10             	add    $0x10,%esp
+  8006fd:	eb c5                	jmp    8006c4 <vprintfmt+0x242>
+  8006ff:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800702:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800705:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800708:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80070b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80070f:	7e 1b                	jle    80072c <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800711:	83 ec 08             	sub    $0x8,%esp
+  800714:	53                   	push   %ebx
+  800715:	6a 20                	push   $0x20
+  800717:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	83 ee 01             	sub    $0x1,%esi
+  80071f:	75 f0                	jne    800711 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800721:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+  800727:	e9 67 fd ff ff       	jmp    800493 <vprintfmt+0x11>
+  80072c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800732:	e9 5c fd ff ff       	jmp    800493 <vprintfmt+0x11>
+  800737:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80073a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80073d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800740:	eb c6                	jmp    800708 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800742:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800745:	89 55 10             	mov    %edx,0x10(%ebp)
+  800748:	83 f9 01             	cmp    $0x1,%ecx
+  80074b:	7f 1f                	jg     80076c <vprintfmt+0x2ea>
+	else if (lflag)
+  80074d:	85 c9                	test   %ecx,%ecx
+  80074f:	74 67                	je     8007b8 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8b 30                	mov    (%eax),%esi
+  800756:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800759:	89 f0                	mov    %esi,%eax
+  80075b:	c1 f8 1f             	sar    $0x1f,%eax
+  80075e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800761:	8b 45 14             	mov    0x14(%ebp),%eax
+  800764:	8d 40 04             	lea    0x4(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076a:	eb 17                	jmp    800783 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8b 50 04             	mov    0x4(%eax),%edx
+  800772:	8b 00                	mov    (%eax),%eax
+  800774:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800777:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8d 40 08             	lea    0x8(%eax),%eax
+  800780:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800783:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800786:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800789:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80078e:	85 c9                	test   %ecx,%ecx
+  800790:	0f 89 12 01 00 00    	jns    8008a8 <vprintfmt+0x426>
+				putch('-', putdat);
+  800796:	83 ec 08             	sub    $0x8,%esp
+  800799:	53                   	push   %ebx
+  80079a:	6a 2d                	push   $0x2d
+  80079c:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80079e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007a1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007a4:	f7 da                	neg    %edx
+  8007a6:	83 d1 00             	adc    $0x0,%ecx
+  8007a9:	f7 d9                	neg    %ecx
+  8007ab:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007ae:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007b3:	e9 f0 00 00 00       	jmp    8008a8 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 30                	mov    (%eax),%esi
+  8007bd:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007c0:	89 f0                	mov    %esi,%eax
+  8007c2:	c1 f8 1f             	sar    $0x1f,%eax
+  8007c5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d1:	eb b0                	jmp    800783 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8007d3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007d6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d9:	83 f9 01             	cmp    $0x1,%ecx
+  8007dc:	7f 1e                	jg     8007fc <vprintfmt+0x37a>
+	else if (lflag)
+  8007de:	85 c9                	test   %ecx,%ecx
+  8007e0:	74 32                	je     800814 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007f2:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8007f7:	e9 ac 00 00 00       	jmp    8008a8 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ff:	8b 10                	mov    (%eax),%edx
+  800801:	8b 48 04             	mov    0x4(%eax),%ecx
+  800804:	8d 40 08             	lea    0x8(%eax),%eax
+  800807:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80080a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80080f:	e9 94 00 00 00       	jmp    8008a8 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800814:	8b 45 14             	mov    0x14(%ebp),%eax
+  800817:	8b 10                	mov    (%eax),%edx
+  800819:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081e:	8d 40 04             	lea    0x4(%eax),%eax
+  800821:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800824:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800829:	eb 7d                	jmp    8008a8 <vprintfmt+0x426>
+	if (lflag >= 2)
+  80082b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80082e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800831:	83 f9 01             	cmp    $0x1,%ecx
+  800834:	7f 1b                	jg     800851 <vprintfmt+0x3cf>
+	else if (lflag)
+  800836:	85 c9                	test   %ecx,%ecx
+  800838:	74 2c                	je     800866 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80083a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083d:	8b 10                	mov    (%eax),%edx
+  80083f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800844:	8d 40 04             	lea    0x4(%eax),%eax
+  800847:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80084a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80084f:	eb 57                	jmp    8008a8 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800851:	8b 45 14             	mov    0x14(%ebp),%eax
+  800854:	8b 10                	mov    (%eax),%edx
+  800856:	8b 48 04             	mov    0x4(%eax),%ecx
+  800859:	8d 40 08             	lea    0x8(%eax),%eax
+  80085c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80085f:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800864:	eb 42                	jmp    8008a8 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800866:	8b 45 14             	mov    0x14(%ebp),%eax
+  800869:	8b 10                	mov    (%eax),%edx
+  80086b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800870:	8d 40 04             	lea    0x4(%eax),%eax
+  800873:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800876:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80087b:	eb 2b                	jmp    8008a8 <vprintfmt+0x426>
+			putch('0', putdat);
+  80087d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800880:	83 ec 08             	sub    $0x8,%esp
+  800883:	53                   	push   %ebx
+  800884:	6a 30                	push   $0x30
+  800886:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800888:	83 c4 08             	add    $0x8,%esp
+  80088b:	53                   	push   %ebx
+  80088c:	6a 78                	push   $0x78
+  80088e:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800890:	8b 45 14             	mov    0x14(%ebp),%eax
+  800893:	8b 10                	mov    (%eax),%edx
+  800895:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80089a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80089d:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a3:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8008a8:	83 ec 0c             	sub    $0xc,%esp
+  8008ab:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008af:	50                   	push   %eax
+  8008b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8008b3:	56                   	push   %esi
+  8008b4:	51                   	push   %ecx
+  8008b5:	52                   	push   %edx
+  8008b6:	89 da                	mov    %ebx,%edx
+  8008b8:	89 f8                	mov    %edi,%eax
+  8008ba:	e8 d8 fa ff ff       	call   800397 <printnum>
+			break;
+  8008bf:	83 c4 20             	add    $0x20,%esp
+  8008c2:	e9 cc fb ff ff       	jmp    800493 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8008c7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008ca:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008cd:	83 f9 01             	cmp    $0x1,%ecx
+  8008d0:	7f 1b                	jg     8008ed <vprintfmt+0x46b>
+	else if (lflag)
+  8008d2:	85 c9                	test   %ecx,%ecx
+  8008d4:	74 2c                	je     800902 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8008d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d9:	8b 10                	mov    (%eax),%edx
+  8008db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e6:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8008eb:	eb bb                	jmp    8008a8 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f0:	8b 10                	mov    (%eax),%edx
+  8008f2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008fb:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800900:	eb a6                	jmp    8008a8 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800902:	8b 45 14             	mov    0x14(%ebp),%eax
+  800905:	8b 10                	mov    (%eax),%edx
+  800907:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80090c:	8d 40 04             	lea    0x4(%eax),%eax
+  80090f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800912:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800917:	eb 8f                	jmp    8008a8 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800919:	89 55 10             	mov    %edx,0x10(%ebp)
+  80091c:	83 ec 08             	sub    $0x8,%esp
+  80091f:	53                   	push   %ebx
+  800920:	6a 25                	push   $0x25
+  800922:	ff d7                	call   *%edi
+			break;
+  800924:	83 c4 10             	add    $0x10,%esp
+  800927:	e9 67 fb ff ff       	jmp    800493 <vprintfmt+0x11>
+			putch('%', putdat);
+  80092c:	83 ec 08             	sub    $0x8,%esp
+  80092f:	53                   	push   %ebx
+  800930:	6a 25                	push   $0x25
+  800932:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800934:	83 c4 10             	add    $0x10,%esp
+  800937:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80093b:	0f 84 ba fb ff ff    	je     8004fb <vprintfmt+0x79>
+  800941:	89 75 10             	mov    %esi,0x10(%ebp)
+  800944:	89 f0                	mov    %esi,%eax
+  800946:	83 e8 01             	sub    $0x1,%eax
+  800949:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80094d:	75 f7                	jne    800946 <vprintfmt+0x4c4>
+  80094f:	89 45 10             	mov    %eax,0x10(%ebp)
+  800952:	e9 3c fb ff ff       	jmp    800493 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800957:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80095a:	8d 70 01             	lea    0x1(%eax),%esi
+  80095d:	0f b6 00             	movzbl (%eax),%eax
+  800960:	0f be d0             	movsbl %al,%edx
+  800963:	85 d2                	test   %edx,%edx
+  800965:	74 11                	je     800978 <vprintfmt+0x4f6>
+  800967:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80096a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80096d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800970:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800973:	e9 5d fd ff ff       	jmp    8006d5 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800978:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80097b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097e:	e9 10 fb ff ff       	jmp    800493 <vprintfmt+0x11>
+  800983:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800986:	89 45 14             	mov    %eax,0x14(%ebp)
+  800989:	e9 05 fb ff ff       	jmp    800493 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  80098e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800992:	7e 0a                	jle    80099e <vprintfmt+0x51c>
+  800994:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800998:	0f 85 bd fc ff ff    	jne    80065b <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80099e:	ba 28 00 00 00       	mov    $0x28,%edx
+  8009a3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009a8:	be 0d 3d 80 00       	mov    $0x803d0d,%esi
+  8009ad:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009b0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009b3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009b6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009b9:	e9 17 fd ff ff       	jmp    8006d5 <vprintfmt+0x253>
+}
+  8009be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c1:	5b                   	pop    %ebx
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5f                   	pop    %edi
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	83 ec 18             	sub    $0x18,%esp
+  8009cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009d2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009d5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009d9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009dc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009e3:	85 c0                	test   %eax,%eax
+  8009e5:	74 26                	je     800a0d <vsnprintf+0x47>
+  8009e7:	85 d2                	test   %edx,%edx
+  8009e9:	7e 22                	jle    800a0d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009eb:	ff 75 14             	push   0x14(%ebp)
+  8009ee:	ff 75 10             	push   0x10(%ebp)
+  8009f1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009f4:	50                   	push   %eax
+  8009f5:	68 48 04 80 00       	push   $0x800448
+  8009fa:	e8 83 fa ff ff       	call   800482 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009ff:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a02:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a08:	83 c4 10             	add    $0x10,%esp
+}
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+		return -E_INVAL;
+  800a0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a12:	eb f7                	jmp    800a0b <vsnprintf+0x45>
+
+00800a14 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a1a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a1d:	50                   	push   %eax
+  800a1e:	ff 75 10             	push   0x10(%ebp)
+  800a21:	ff 75 0c             	push   0xc(%ebp)
+  800a24:	ff 75 08             	push   0x8(%ebp)
+  800a27:	e8 9a ff ff ff       	call   8009c6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a2c:	c9                   	leave
+  800a2d:	c3                   	ret
+
+00800a2e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a34:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a37:	74 10                	je     800a49 <strlen+0x1b>
+  800a39:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800a3e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a41:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a45:	75 f7                	jne    800a3e <strlen+0x10>
+	return n;
+}
+  800a47:	5d                   	pop    %ebp
+  800a48:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800a49:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800a4e:	eb f7                	jmp    800a47 <strlen+0x19>
+
+00800a50 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a56:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a59:	85 d2                	test   %edx,%edx
+  800a5b:	74 16                	je     800a73 <strnlen+0x23>
+  800a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a62:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a66:	74 09                	je     800a71 <strnlen+0x21>
+		n++;
+  800a68:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a6b:	39 d0                	cmp    %edx,%eax
+  800a6d:	75 f3                	jne    800a62 <strnlen+0x12>
+		n++;
+  800a6f:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a71:	5d                   	pop    %ebp
+  800a72:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a78:	eb f7                	jmp    800a71 <strnlen+0x21>
+
+00800a7a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a7a:	55                   	push   %ebp
+  800a7b:	89 e5                	mov    %esp,%ebp
+  800a7d:	53                   	push   %ebx
+  800a7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a81:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a89:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a8d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a90:	83 c0 01             	add    $0x1,%eax
+  800a93:	84 d2                	test   %dl,%dl
+  800a95:	75 f2                	jne    800a89 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a97:	89 c8                	mov    %ecx,%eax
+  800a99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a9c:	c9                   	leave
+  800a9d:	c3                   	ret
+
+00800a9e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a9e:	55                   	push   %ebp
+  800a9f:	89 e5                	mov    %esp,%ebp
+  800aa1:	53                   	push   %ebx
+  800aa2:	83 ec 10             	sub    $0x10,%esp
+  800aa5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800aa8:	53                   	push   %ebx
+  800aa9:	e8 80 ff ff ff       	call   800a2e <strlen>
+  800aae:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ab1:	ff 75 0c             	push   0xc(%ebp)
+  800ab4:	01 d8                	add    %ebx,%eax
+  800ab6:	50                   	push   %eax
+  800ab7:	e8 be ff ff ff       	call   800a7a <strcpy>
+	return dst;
+}
+  800abc:	89 d8                	mov    %ebx,%eax
+  800abe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac1:	c9                   	leave
+  800ac2:	c3                   	ret
+
+00800ac3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ac3:	55                   	push   %ebp
+  800ac4:	89 e5                	mov    %esp,%ebp
+  800ac6:	56                   	push   %esi
+  800ac7:	53                   	push   %ebx
+  800ac8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800acb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ace:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ad1:	85 db                	test   %ebx,%ebx
+  800ad3:	74 17                	je     800aec <strncpy+0x29>
+  800ad5:	01 f3                	add    %esi,%ebx
+  800ad7:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800ad9:	83 c0 01             	add    $0x1,%eax
+  800adc:	0f b6 0a             	movzbl (%edx),%ecx
+  800adf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ae2:	80 f9 01             	cmp    $0x1,%cl
+  800ae5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ae8:	39 c3                	cmp    %eax,%ebx
+  800aea:	75 ed                	jne    800ad9 <strncpy+0x16>
+	}
+	return ret;
+}
+  800aec:	89 f0                	mov    %esi,%eax
+  800aee:	5b                   	pop    %ebx
+  800aef:	5e                   	pop    %esi
+  800af0:	5d                   	pop    %ebp
+  800af1:	c3                   	ret
+
+00800af2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+  800af7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800afd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b00:	89 f0                	mov    %esi,%eax
+  800b02:	85 db                	test   %ebx,%ebx
+  800b04:	74 1e                	je     800b24 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800b06:	83 eb 01             	sub    $0x1,%ebx
+  800b09:	74 16                	je     800b21 <strlcpy+0x2f>
+  800b0b:	01 f3                	add    %esi,%ebx
+  800b0d:	0f b6 0a             	movzbl (%edx),%ecx
+  800b10:	84 c9                	test   %cl,%cl
+  800b12:	74 0d                	je     800b21 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800b14:	83 c2 01             	add    $0x1,%edx
+  800b17:	83 c0 01             	add    $0x1,%eax
+  800b1a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800b1d:	39 d8                	cmp    %ebx,%eax
+  800b1f:	75 ec                	jne    800b0d <strlcpy+0x1b>
+		*dst = '\0';
+  800b21:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b24:	29 f0                	sub    %esi,%eax
+}
+  800b26:	5b                   	pop    %ebx
+  800b27:	5e                   	pop    %esi
+  800b28:	5d                   	pop    %ebp
+  800b29:	c3                   	ret
+
+00800b2a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b30:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b33:	0f b6 01             	movzbl (%ecx),%eax
+  800b36:	84 c0                	test   %al,%al
+  800b38:	74 11                	je     800b4b <strcmp+0x21>
+  800b3a:	38 02                	cmp    %al,(%edx)
+  800b3c:	75 0d                	jne    800b4b <strcmp+0x21>
+		p++, q++;
+  800b3e:	83 c1 01             	add    $0x1,%ecx
+  800b41:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b44:	0f b6 01             	movzbl (%ecx),%eax
+  800b47:	84 c0                	test   %al,%al
+  800b49:	75 ef                	jne    800b3a <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b4b:	0f b6 c0             	movzbl %al,%eax
+  800b4e:	0f b6 12             	movzbl (%edx),%edx
+  800b51:	29 d0                	sub    %edx,%eax
+}
+  800b53:	5d                   	pop    %ebp
+  800b54:	c3                   	ret
+
+00800b55 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	53                   	push   %ebx
+  800b59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b5c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b5f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800b62:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800b67:	85 d2                	test   %edx,%edx
+  800b69:	74 2e                	je     800b99 <strncmp+0x44>
+  800b6b:	0f b6 01             	movzbl (%ecx),%eax
+  800b6e:	84 c0                	test   %al,%al
+  800b70:	74 16                	je     800b88 <strncmp+0x33>
+  800b72:	3a 03                	cmp    (%ebx),%al
+  800b74:	75 12                	jne    800b88 <strncmp+0x33>
+		n--, p++, q++;
+  800b76:	83 c1 01             	add    $0x1,%ecx
+  800b79:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b7c:	83 ea 01             	sub    $0x1,%edx
+  800b7f:	75 ea                	jne    800b6b <strncmp+0x16>
+		return 0;
+  800b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b86:	eb 11                	jmp    800b99 <strncmp+0x44>
+  800b88:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b8d:	85 d2                	test   %edx,%edx
+  800b8f:	74 08                	je     800b99 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b91:	0f b6 01             	movzbl (%ecx),%eax
+  800b94:	0f b6 13             	movzbl (%ebx),%edx
+  800b97:	29 d0                	sub    %edx,%eax
+}
+  800b99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b9c:	c9                   	leave
+  800b9d:	c3                   	ret
+
+00800b9e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b9e:	55                   	push   %ebp
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ba8:	0f b6 10             	movzbl (%eax),%edx
+  800bab:	84 d2                	test   %dl,%dl
+  800bad:	74 15                	je     800bc4 <strchr+0x26>
+		if (*s == c)
+  800baf:	38 d1                	cmp    %dl,%cl
+  800bb1:	74 0f                	je     800bc2 <strchr+0x24>
+	for (; *s; s++)
+  800bb3:	83 c0 01             	add    $0x1,%eax
+  800bb6:	0f b6 10             	movzbl (%eax),%edx
+  800bb9:	84 d2                	test   %dl,%dl
+  800bbb:	75 f2                	jne    800baf <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bc2:	5d                   	pop    %ebp
+  800bc3:	c3                   	ret
+	return 0;
+  800bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc9:	eb f7                	jmp    800bc2 <strchr+0x24>
+
+00800bcb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	53                   	push   %ebx
+  800bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800bd5:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800bd8:	38 d3                	cmp    %dl,%bl
+  800bda:	74 14                	je     800bf0 <strfind+0x25>
+  800bdc:	89 d1                	mov    %edx,%ecx
+  800bde:	84 db                	test   %bl,%bl
+  800be0:	74 0e                	je     800bf0 <strfind+0x25>
+	for (; *s; s++)
+  800be2:	83 c0 01             	add    $0x1,%eax
+  800be5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800be8:	38 ca                	cmp    %cl,%dl
+  800bea:	74 04                	je     800bf0 <strfind+0x25>
+  800bec:	84 d2                	test   %dl,%dl
+  800bee:	75 f2                	jne    800be2 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800bf0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf3:	c9                   	leave
+  800bf4:	c3                   	ret
+
+00800bf5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bfc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bff:	85 c9                	test   %ecx,%ecx
+  800c01:	74 20                	je     800c23 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c03:	89 f8                	mov    %edi,%eax
+  800c05:	09 c8                	or     %ecx,%eax
+  800c07:	a8 03                	test   $0x3,%al
+  800c09:	75 12                	jne    800c1d <memset+0x28>
+		c &= 0xFF;
+  800c0b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c0f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c15:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c18:	fc                   	cld
+  800c19:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c1b:	eb 06                	jmp    800c23 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c20:	fc                   	cld
+  800c21:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c23:	89 f8                	mov    %edi,%eax
+  800c25:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c28:	c9                   	leave
+  800c29:	c3                   	ret
+
+00800c2a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	57                   	push   %edi
+  800c2e:	56                   	push   %esi
+  800c2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c32:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c38:	39 c6                	cmp    %eax,%esi
+  800c3a:	73 32                	jae    800c6e <memmove+0x44>
+  800c3c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c3f:	39 d0                	cmp    %edx,%eax
+  800c41:	73 2b                	jae    800c6e <memmove+0x44>
+		s += n;
+		d += n;
+  800c43:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c46:	89 d6                	mov    %edx,%esi
+  800c48:	09 fe                	or     %edi,%esi
+  800c4a:	09 ce                	or     %ecx,%esi
+  800c4c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c52:	75 0e                	jne    800c62 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c54:	83 ef 04             	sub    $0x4,%edi
+  800c57:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c5a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c5d:	fd                   	std
+  800c5e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c60:	eb 09                	jmp    800c6b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c62:	83 ef 01             	sub    $0x1,%edi
+  800c65:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c68:	fd                   	std
+  800c69:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c6b:	fc                   	cld
+  800c6c:	eb 1a                	jmp    800c88 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c6e:	89 f2                	mov    %esi,%edx
+  800c70:	09 c2                	or     %eax,%edx
+  800c72:	09 ca                	or     %ecx,%edx
+  800c74:	f6 c2 03             	test   $0x3,%dl
+  800c77:	75 0a                	jne    800c83 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c79:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c7c:	89 c7                	mov    %eax,%edi
+  800c7e:	fc                   	cld
+  800c7f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c81:	eb 05                	jmp    800c88 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c83:	89 c7                	mov    %eax,%edi
+  800c85:	fc                   	cld
+  800c86:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c88:	5e                   	pop    %esi
+  800c89:	5f                   	pop    %edi
+  800c8a:	5d                   	pop    %ebp
+  800c8b:	c3                   	ret
+
+00800c8c <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c8c:	55                   	push   %ebp
+  800c8d:	89 e5                	mov    %esp,%ebp
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c92:	ff 75 10             	push   0x10(%ebp)
+  800c95:	ff 75 0c             	push   0xc(%ebp)
+  800c98:	ff 75 08             	push   0x8(%ebp)
+  800c9b:	e8 8a ff ff ff       	call   800c2a <memmove>
+}
+  800ca0:	c9                   	leave
+  800ca1:	c3                   	ret
+
+00800ca2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ca2:	55                   	push   %ebp
+  800ca3:	89 e5                	mov    %esp,%ebp
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+  800ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800caa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cad:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cb0:	85 f6                	test   %esi,%esi
+  800cb2:	74 29                	je     800cdd <memcmp+0x3b>
+  800cb4:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800cb6:	0f b6 08             	movzbl (%eax),%ecx
+  800cb9:	0f b6 1a             	movzbl (%edx),%ebx
+  800cbc:	38 d9                	cmp    %bl,%cl
+  800cbe:	75 11                	jne    800cd1 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cc0:	83 c0 01             	add    $0x1,%eax
+  800cc3:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cc6:	39 c6                	cmp    %eax,%esi
+  800cc8:	75 ec                	jne    800cb6 <memcmp+0x14>
+	}
+
+	return 0;
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	eb 08                	jmp    800cd9 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800cd1:	0f b6 c1             	movzbl %cl,%eax
+  800cd4:	0f b6 db             	movzbl %bl,%ebx
+  800cd7:	29 d8                	sub    %ebx,%eax
+}
+  800cd9:	5b                   	pop    %ebx
+  800cda:	5e                   	pop    %esi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+	return 0;
+  800cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce2:	eb f5                	jmp    800cd9 <memcmp+0x37>
+
+00800ce4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ced:	89 c2                	mov    %eax,%edx
+  800cef:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cf2:	39 d0                	cmp    %edx,%eax
+  800cf4:	73 0d                	jae    800d03 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cf6:	38 08                	cmp    %cl,(%eax)
+  800cf8:	74 0d                	je     800d07 <memfind+0x23>
+	for (; s < ends; s++)
+  800cfa:	83 c0 01             	add    $0x1,%eax
+  800cfd:	39 c2                	cmp    %eax,%edx
+  800cff:	75 f5                	jne    800cf6 <memfind+0x12>
+  800d01:	eb 06                	jmp    800d09 <memfind+0x25>
+  800d03:	89 c2                	mov    %eax,%edx
+  800d05:	eb 02                	jmp    800d09 <memfind+0x25>
+  800d07:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800d09:	89 d0                	mov    %edx,%eax
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  800d13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d19:	0f b6 02             	movzbl (%edx),%eax
+  800d1c:	3c 20                	cmp    $0x20,%al
+  800d1e:	74 04                	je     800d24 <strtol+0x17>
+  800d20:	3c 09                	cmp    $0x9,%al
+  800d22:	75 0e                	jne    800d32 <strtol+0x25>
+		s++;
+  800d24:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d27:	0f b6 02             	movzbl (%edx),%eax
+  800d2a:	3c 20                	cmp    $0x20,%al
+  800d2c:	74 f6                	je     800d24 <strtol+0x17>
+  800d2e:	3c 09                	cmp    $0x9,%al
+  800d30:	74 f2                	je     800d24 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d32:	3c 2b                	cmp    $0x2b,%al
+  800d34:	74 2a                	je     800d60 <strtol+0x53>
+	int neg = 0;
+  800d36:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d3b:	3c 2d                	cmp    $0x2d,%al
+  800d3d:	74 2b                	je     800d6a <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d3f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d45:	75 0f                	jne    800d56 <strtol+0x49>
+  800d47:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d4a:	74 28                	je     800d74 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d4c:	85 db                	test   %ebx,%ebx
+  800d4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d53:	0f 44 d8             	cmove  %eax,%ebx
+  800d56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d5e:	eb 46                	jmp    800da6 <strtol+0x99>
+		s++;
+  800d60:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d68:	eb d5                	jmp    800d3f <strtol+0x32>
+		s++, neg = 1;
+  800d6a:	83 c2 01             	add    $0x1,%edx
+  800d6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d72:	eb cb                	jmp    800d3f <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d74:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d78:	74 0e                	je     800d88 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d7a:	85 db                	test   %ebx,%ebx
+  800d7c:	75 d8                	jne    800d56 <strtol+0x49>
+		s++, base = 8;
+  800d7e:	83 c2 01             	add    $0x1,%edx
+  800d81:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d86:	eb ce                	jmp    800d56 <strtol+0x49>
+		s += 2, base = 16;
+  800d88:	83 c2 02             	add    $0x2,%edx
+  800d8b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d90:	eb c4                	jmp    800d56 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d92:	0f be c0             	movsbl %al,%eax
+  800d95:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d98:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d9b:	7d 3a                	jge    800dd7 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d9d:	83 c2 01             	add    $0x1,%edx
+  800da0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800da4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800da6:	0f b6 02             	movzbl (%edx),%eax
+  800da9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dac:	89 f3                	mov    %esi,%ebx
+  800dae:	80 fb 09             	cmp    $0x9,%bl
+  800db1:	76 df                	jbe    800d92 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800db3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800db6:	89 f3                	mov    %esi,%ebx
+  800db8:	80 fb 19             	cmp    $0x19,%bl
+  800dbb:	77 08                	ja     800dc5 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800dbd:	0f be c0             	movsbl %al,%eax
+  800dc0:	83 e8 57             	sub    $0x57,%eax
+  800dc3:	eb d3                	jmp    800d98 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dc5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dc8:	89 f3                	mov    %esi,%ebx
+  800dca:	80 fb 19             	cmp    $0x19,%bl
+  800dcd:	77 08                	ja     800dd7 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800dcf:	0f be c0             	movsbl %al,%eax
+  800dd2:	83 e8 37             	sub    $0x37,%eax
+  800dd5:	eb c1                	jmp    800d98 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dd7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ddb:	74 05                	je     800de2 <strtol+0xd5>
+		*endptr = (char *) s;
+  800ddd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800de0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800de2:	89 c8                	mov    %ecx,%eax
+  800de4:	f7 d8                	neg    %eax
+  800de6:	85 ff                	test   %edi,%edi
+  800de8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800deb:	89 c8                	mov    %ecx,%eax
+  800ded:	5b                   	pop    %ebx
+  800dee:	5e                   	pop    %esi
+  800def:	5f                   	pop    %edi
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+
+00800df2 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e03:	89 c3                	mov    %eax,%ebx
+  800e05:	89 c7                	mov    %eax,%edi
+  800e07:	89 c6                	mov    %eax,%esi
+  800e09:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+
+00800e10 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e20:	89 d1                	mov    %edx,%ecx
+  800e22:	89 d3                	mov    %edx,%ebx
+  800e24:	89 d7                	mov    %edx,%edi
+  800e26:	89 d6                	mov    %edx,%esi
+  800e28:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5e                   	pop    %esi
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+
+00800e2f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+  800e35:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e45:	89 cb                	mov    %ecx,%ebx
+  800e47:	89 cf                	mov    %ecx,%edi
+  800e49:	89 ce                	mov    %ecx,%esi
+  800e4b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4d:	85 c0                	test   %eax,%eax
+  800e4f:	7f 08                	jg     800e59 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 03                	push   $0x3
+  800e5f:	68 2b 40 80 00       	push   $0x80402b
+  800e64:	6a 23                	push   $0x23
+  800e66:	68 48 40 80 00       	push   $0x804048
+  800e6b:	e8 38 f4 ff ff       	call   8002a8 <_panic>
+
+00800e70 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e80:	89 d1                	mov    %edx,%ecx
+  800e82:	89 d3                	mov    %edx,%ebx
+  800e84:	89 d7                	mov    %edx,%edi
+  800e86:	89 d6                	mov    %edx,%esi
+  800e88:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+
+00800e8f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	56                   	push   %esi
+  800e94:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e9f:	89 d1                	mov    %edx,%ecx
+  800ea1:	89 d3                	mov    %edx,%ebx
+  800ea3:	89 d7                	mov    %edx,%edi
+  800ea5:	89 d6                	mov    %edx,%esi
+  800ea7:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+
+00800eae <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	57                   	push   %edi
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eca:	89 f7                	mov    %esi,%edi
+  800ecc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ece:	85 c0                	test   %eax,%eax
+  800ed0:	7f 08                	jg     800eda <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ed2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed5:	5b                   	pop    %ebx
+  800ed6:	5e                   	pop    %esi
+  800ed7:	5f                   	pop    %edi
+  800ed8:	5d                   	pop    %ebp
+  800ed9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+  800edd:	50                   	push   %eax
+  800ede:	6a 04                	push   $0x4
+  800ee0:	68 2b 40 80 00       	push   $0x80402b
+  800ee5:	6a 23                	push   $0x23
+  800ee7:	68 48 40 80 00       	push   $0x804048
+  800eec:	e8 b7 f3 ff ff       	call   8002a8 <_panic>
+
+00800ef1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	57                   	push   %edi
+  800ef5:	56                   	push   %esi
+  800ef6:	53                   	push   %ebx
+  800ef7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f00:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f08:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f0e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f10:	85 c0                	test   %eax,%eax
+  800f12:	7f 08                	jg     800f1c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f17:	5b                   	pop    %ebx
+  800f18:	5e                   	pop    %esi
+  800f19:	5f                   	pop    %edi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1c:	83 ec 0c             	sub    $0xc,%esp
+  800f1f:	50                   	push   %eax
+  800f20:	6a 05                	push   $0x5
+  800f22:	68 2b 40 80 00       	push   $0x80402b
+  800f27:	6a 23                	push   $0x23
+  800f29:	68 48 40 80 00       	push   $0x804048
+  800f2e:	e8 75 f3 ff ff       	call   8002a8 <_panic>
+
+00800f33 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f33:	55                   	push   %ebp
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	57                   	push   %edi
+  800f37:	56                   	push   %esi
+  800f38:	53                   	push   %ebx
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f4c:	89 df                	mov    %ebx,%edi
+  800f4e:	89 de                	mov    %ebx,%esi
+  800f50:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f52:	85 c0                	test   %eax,%eax
+  800f54:	7f 08                	jg     800f5e <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5e:	83 ec 0c             	sub    $0xc,%esp
+  800f61:	50                   	push   %eax
+  800f62:	6a 06                	push   $0x6
+  800f64:	68 2b 40 80 00       	push   $0x80402b
+  800f69:	6a 23                	push   $0x23
+  800f6b:	68 48 40 80 00       	push   $0x804048
+  800f70:	e8 33 f3 ff ff       	call   8002a8 <_panic>
+
+00800f75 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	57                   	push   %edi
+  800f79:	56                   	push   %esi
+  800f7a:	53                   	push   %ebx
+  800f7b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f89:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f8e:	89 df                	mov    %ebx,%edi
+  800f90:	89 de                	mov    %ebx,%esi
+  800f92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 08                	jg     800fa0 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	6a 08                	push   $0x8
+  800fa6:	68 2b 40 80 00       	push   $0x80402b
+  800fab:	6a 23                	push   $0x23
+  800fad:	68 48 40 80 00       	push   $0x804048
+  800fb2:	e8 f1 f2 ff ff       	call   8002a8 <_panic>
+
+00800fb7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fd0:	89 df                	mov    %ebx,%edi
+  800fd2:	89 de                	mov    %ebx,%esi
+  800fd4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	7f 08                	jg     800fe2 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5f                   	pop    %edi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe2:	83 ec 0c             	sub    $0xc,%esp
+  800fe5:	50                   	push   %eax
+  800fe6:	6a 09                	push   $0x9
+  800fe8:	68 2b 40 80 00       	push   $0x80402b
+  800fed:	6a 23                	push   $0x23
+  800fef:	68 48 40 80 00       	push   $0x804048
+  800ff4:	e8 af f2 ff ff       	call   8002a8 <_panic>
+
+00800ff9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 0a                	push   $0xa
+  80102a:	68 2b 40 80 00       	push   $0x80402b
+  80102f:	6a 23                	push   $0x23
+  801031:	68 48 40 80 00       	push   $0x804048
+  801036:	e8 6d f2 ff ff       	call   8002a8 <_panic>
+
+0080103b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80104c:	be 00 00 00 00       	mov    $0x0,%esi
+  801051:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801054:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801057:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801059:	5b                   	pop    %ebx
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+
+0080105e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801067:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801074:	89 cb                	mov    %ecx,%ebx
+  801076:	89 cf                	mov    %ecx,%edi
+  801078:	89 ce                	mov    %ecx,%esi
+  80107a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107c:	85 c0                	test   %eax,%eax
+  80107e:	7f 08                	jg     801088 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801083:	5b                   	pop    %ebx
+  801084:	5e                   	pop    %esi
+  801085:	5f                   	pop    %edi
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801088:	83 ec 0c             	sub    $0xc,%esp
+  80108b:	50                   	push   %eax
+  80108c:	6a 0d                	push   $0xd
+  80108e:	68 2b 40 80 00       	push   $0x80402b
+  801093:	6a 23                	push   $0x23
+  801095:	68 48 40 80 00       	push   $0x804048
+  80109a:	e8 09 f2 ff ff       	call   8002a8 <_panic>
+
+0080109f <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  8010a2:	57                   	push   %edi
+  8010a3:	56                   	push   %esi
+  8010a4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010b9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8010bb:	5b                   	pop    %ebx
+  8010bc:	5e                   	pop    %esi
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+
+008010c0 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d9:	89 df                	mov    %ebx,%edi
+  8010db:	89 de                	mov    %ebx,%esi
+  8010dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010df:	85 c0                	test   %eax,%eax
+  8010e1:	7f 08                	jg     8010eb <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8010e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5f                   	pop    %edi
+  8010e9:	5d                   	pop    %ebp
+  8010ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010eb:	83 ec 0c             	sub    $0xc,%esp
+  8010ee:	50                   	push   %eax
+  8010ef:	6a 0d                	push   $0xd
+  8010f1:	68 2b 40 80 00       	push   $0x80402b
+  8010f6:	6a 23                	push   $0x23
+  8010f8:	68 48 40 80 00       	push   $0x804048
+  8010fd:	e8 a6 f1 ff ff       	call   8002a8 <_panic>
+
+00801102 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801112:	89 d1                	mov    %edx,%ecx
+  801114:	89 d3                	mov    %edx,%ebx
+  801116:	89 d7                	mov    %edx,%edi
+  801118:	89 d6                	mov    %edx,%esi
+  80111a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5f                   	pop    %edi
+  80111f:	5d                   	pop    %ebp
+  801120:	c3                   	ret
+
+00801121 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801121:	55                   	push   %ebp
+  801122:	89 e5                	mov    %esp,%ebp
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801127:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801132:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801137:	89 df                	mov    %ebx,%edi
+  801139:	89 de                	mov    %ebx,%esi
+  80113b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80113d:	5b                   	pop    %ebx
+  80113e:	5e                   	pop    %esi
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+
+00801142 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	57                   	push   %edi
+  801146:	56                   	push   %esi
+  801147:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801148:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80114d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801150:	b8 10 00 00 00       	mov    $0x10,%eax
+  801155:	89 cb                	mov    %ecx,%ebx
+  801157:	89 cf                	mov    %ecx,%edi
+  801159:	89 ce                	mov    %ecx,%esi
+  80115b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+
+00801162 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	57                   	push   %edi
+  801166:	56                   	push   %esi
+  801167:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 11 00 00 00       	mov    $0x11,%eax
+  801178:	89 df                	mov    %ebx,%edi
+  80117a:	89 de                	mov    %ebx,%esi
+  80117c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80117e:	5b                   	pop    %ebx
+  80117f:	5e                   	pop    %esi
+  801180:	5f                   	pop    %edi
+  801181:	5d                   	pop    %ebp
+  801182:	c3                   	ret
+
+00801183 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	57                   	push   %edi
+  801187:	56                   	push   %esi
+  801188:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801189:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801191:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801194:	b8 12 00 00 00       	mov    $0x12,%eax
+  801199:	89 df                	mov    %ebx,%edi
+  80119b:	89 de                	mov    %ebx,%esi
+  80119d:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5e                   	pop    %esi
+  8011a1:	5f                   	pop    %edi
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+
+008011a4 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8011a4:	55                   	push   %ebp
+  8011a5:	89 e5                	mov    %esp,%ebp
+  8011a7:	57                   	push   %edi
+  8011a8:	56                   	push   %esi
+  8011a9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011b7:	89 cb                	mov    %ecx,%ebx
+  8011b9:	89 cf                	mov    %ecx,%edi
+  8011bb:	89 ce                	mov    %ecx,%esi
+  8011bd:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8011bf:	5b                   	pop    %ebx
+  8011c0:	5e                   	pop    %esi
+  8011c1:	5f                   	pop    %edi
+  8011c2:	5d                   	pop    %ebp
+  8011c3:	c3                   	ret
+
+008011c4 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8011c4:	55                   	push   %ebp
+  8011c5:	89 e5                	mov    %esp,%ebp
+  8011c7:	57                   	push   %edi
+  8011c8:	56                   	push   %esi
+  8011c9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d5:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011da:	89 df                	mov    %ebx,%edi
+  8011dc:	89 de                	mov    %ebx,%esi
+  8011de:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8011e0:	5b                   	pop    %ebx
+  8011e1:	5e                   	pop    %esi
+  8011e2:	5f                   	pop    %edi
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+
+008011e5 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	57                   	push   %edi
+  8011e9:	56                   	push   %esi
+  8011ea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011f8:	89 cb                	mov    %ecx,%ebx
+  8011fa:	89 cf                	mov    %ecx,%edi
+  8011fc:	89 ce                	mov    %ecx,%esi
+  8011fe:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801200:	5b                   	pop    %ebx
+  801201:	5e                   	pop    %esi
+  801202:	5f                   	pop    %edi
+  801203:	5d                   	pop    %ebp
+  801204:	c3                   	ret
+
+00801205 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120b:	be 00 00 00 00       	mov    $0x0,%esi
+  801210:	8b 55 08             	mov    0x8(%ebp),%edx
+  801213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801216:	b8 16 00 00 00       	mov    $0x16,%eax
+  80121b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121e:	89 f7                	mov    %esi,%edi
+  801220:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801222:	5b                   	pop    %ebx
+  801223:	5e                   	pop    %esi
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+
+00801227 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801238:	b8 17 00 00 00       	mov    $0x17,%eax
+  80123d:	89 df                	mov    %ebx,%edi
+  80123f:	89 de                	mov    %ebx,%esi
+  801241:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+
+00801248 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	57                   	push   %edi
+  80124c:	56                   	push   %esi
+  80124d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801253:	8b 55 08             	mov    0x8(%ebp),%edx
+  801256:	b8 18 00 00 00       	mov    $0x18,%eax
+  80125b:	89 cb                	mov    %ecx,%ebx
+  80125d:	89 cf                	mov    %ecx,%edi
+  80125f:	89 ce                	mov    %ecx,%esi
+  801261:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801263:	5b                   	pop    %ebx
+  801264:	5e                   	pop    %esi
+  801265:	5f                   	pop    %edi
+  801266:	5d                   	pop    %ebp
+  801267:	c3                   	ret
+
+00801268 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80126e:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801272:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80127f:	89 df                	mov    %ebx,%edi
+  801281:	89 de                	mov    %ebx,%esi
+  801283:	cd 30                	int    $0x30
+}
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+
+0080128a <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801290:	be 00 00 00 00       	mov    $0x0,%esi
+  801295:	8b 55 08             	mov    0x8(%ebp),%edx
+  801298:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8012a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a3:	89 f7                	mov    %esi,%edi
+  8012a5:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+
+008012ac <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8012c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c5:	89 f7                	mov    %esi,%edi
+  8012c7:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8012c9:	5b                   	pop    %ebx
+  8012ca:	5e                   	pop    %esi
+  8012cb:	5f                   	pop    %edi
+  8012cc:	5d                   	pop    %ebp
+  8012cd:	c3                   	ret
+
+008012ce <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012df:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012e4:	89 df                	mov    %ebx,%edi
+  8012e6:	89 de                	mov    %ebx,%esi
+  8012e8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801300:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801305:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801308:	89 f7                	mov    %esi,%edi
+  80130a:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80130c:	5b                   	pop    %ebx
+  80130d:	5e                   	pop    %esi
+  80130e:	5f                   	pop    %edi
+  80130f:	5d                   	pop    %ebp
+  801310:	c3                   	ret
+
+00801311 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801314:	8b 45 08             	mov    0x8(%ebp),%eax
+  801317:	05 00 00 00 30       	add    $0x30000000,%eax
+  80131c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80131f:	5d                   	pop    %ebp
+  801320:	c3                   	ret
+
+00801321 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801324:	8b 45 08             	mov    0x8(%ebp),%eax
+  801327:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80132c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801331:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801336:	5d                   	pop    %ebp
+  801337:	c3                   	ret
+
+00801338 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801338:	55                   	push   %ebp
+  801339:	89 e5                	mov    %esp,%ebp
+  80133b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801340:	89 c2                	mov    %eax,%edx
+  801342:	c1 ea 16             	shr    $0x16,%edx
+  801345:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80134c:	f6 c2 01             	test   $0x1,%dl
+  80134f:	74 29                	je     80137a <fd_alloc+0x42>
+  801351:	89 c2                	mov    %eax,%edx
+  801353:	c1 ea 0c             	shr    $0xc,%edx
+  801356:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80135d:	f6 c2 01             	test   $0x1,%dl
+  801360:	74 18                	je     80137a <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801362:	05 00 10 00 00       	add    $0x1000,%eax
+  801367:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80136c:	75 d2                	jne    801340 <fd_alloc+0x8>
+  80136e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801373:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801378:	eb 05                	jmp    80137f <fd_alloc+0x47>
+			return 0;
+  80137a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80137f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801382:	89 02                	mov    %eax,(%edx)
+}
+  801384:	89 c8                	mov    %ecx,%eax
+  801386:	5d                   	pop    %ebp
+  801387:	c3                   	ret
+
+00801388 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80138e:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801393:	77 30                	ja     8013c5 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801395:	c1 e0 0c             	shl    $0xc,%eax
+  801398:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80139d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013a3:	f6 c2 01             	test   $0x1,%dl
+  8013a6:	74 24                	je     8013cc <fd_lookup+0x44>
+  8013a8:	89 c2                	mov    %eax,%edx
+  8013aa:	c1 ea 0c             	shr    $0xc,%edx
+  8013ad:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013b4:	f6 c2 01             	test   $0x1,%dl
+  8013b7:	74 1a                	je     8013d3 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013bc:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c3:	5d                   	pop    %ebp
+  8013c4:	c3                   	ret
+		return -E_INVAL;
+  8013c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ca:	eb f7                	jmp    8013c3 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8013cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013d1:	eb f0                	jmp    8013c3 <fd_lookup+0x3b>
+  8013d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013d8:	eb e9                	jmp    8013c3 <fd_lookup+0x3b>
+
+008013da <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	53                   	push   %ebx
+  8013de:	83 ec 04             	sub    $0x4,%esp
+  8013e1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e9:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8013ee:	39 13                	cmp    %edx,(%ebx)
+  8013f0:	74 54                	je     801446 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8013f2:	83 c0 01             	add    $0x1,%eax
+  8013f5:	8b 1c 85 d4 40 80 00 	mov    0x8040d4(,%eax,4),%ebx
+  8013fc:	85 db                	test   %ebx,%ebx
+  8013fe:	75 ee                	jne    8013ee <dev_lookup+0x14>
+  801400:	89 e1                	mov    %esp,%ecx
+  801402:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801407:	29 c8                	sub    %ecx,%eax
+  801409:	89 c1                	mov    %eax,%ecx
+  80140b:	c1 e9 0f             	shr    $0xf,%ecx
+  80140e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801413:	b8 00 00 00 00       	mov    $0x0,%eax
+  801418:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80141b:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801422:	8b 40 48             	mov    0x48(%eax),%eax
+  801425:	83 ec 04             	sub    $0x4,%esp
+  801428:	52                   	push   %edx
+  801429:	50                   	push   %eax
+  80142a:	68 58 40 80 00       	push   $0x804058
+  80142f:	e8 4f ef ff ff       	call   800383 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80143c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80143f:	89 1a                	mov    %ebx,(%edx)
+}
+  801441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801444:	c9                   	leave
+  801445:	c3                   	ret
+			return 0;
+  801446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144b:	eb ef                	jmp    80143c <dev_lookup+0x62>
+
+0080144d <fd_close>:
+{
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	57                   	push   %edi
+  801451:	56                   	push   %esi
+  801452:	53                   	push   %ebx
+  801453:	83 ec 24             	sub    $0x24,%esp
+  801456:	8b 75 08             	mov    0x8(%ebp),%esi
+  801459:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80145c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80145f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801460:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801466:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801469:	50                   	push   %eax
+  80146a:	e8 19 ff ff ff       	call   801388 <fd_lookup>
+  80146f:	89 c3                	mov    %eax,%ebx
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	85 c0                	test   %eax,%eax
+  801476:	78 05                	js     80147d <fd_close+0x30>
+	    || fd != fd2)
+  801478:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80147b:	74 0f                	je     80148c <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80147d:	85 ff                	test   %edi,%edi
+  80147f:	0f 44 df             	cmove  %edi,%ebx
+}
+  801482:	89 d8                	mov    %ebx,%eax
+  801484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801487:	5b                   	pop    %ebx
+  801488:	5e                   	pop    %esi
+  801489:	5f                   	pop    %edi
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80148c:	83 ec 08             	sub    $0x8,%esp
+  80148f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801492:	50                   	push   %eax
+  801493:	ff 36                	push   (%esi)
+  801495:	e8 40 ff ff ff       	call   8013da <dev_lookup>
+  80149a:	89 c3                	mov    %eax,%ebx
+  80149c:	83 c4 10             	add    $0x10,%esp
+  80149f:	85 c0                	test   %eax,%eax
+  8014a1:	78 1a                	js     8014bd <fd_close+0x70>
+		if (dev->dev_close)
+  8014a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014a6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	74 0b                	je     8014bd <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	56                   	push   %esi
+  8014b6:	ff d0                	call   *%eax
+  8014b8:	89 c3                	mov    %eax,%ebx
+  8014ba:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014bd:	83 ec 08             	sub    $0x8,%esp
+  8014c0:	56                   	push   %esi
+  8014c1:	6a 00                	push   $0x0
+  8014c3:	e8 6b fa ff ff       	call   800f33 <sys_page_unmap>
+	return r;
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	eb b5                	jmp    801482 <fd_close+0x35>
+
+008014cd <close>:
+
+int
+close(int fdnum)
+{
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d6:	50                   	push   %eax
+  8014d7:	ff 75 08             	push   0x8(%ebp)
+  8014da:	e8 a9 fe ff ff       	call   801388 <fd_lookup>
+  8014df:	83 c4 10             	add    $0x10,%esp
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	79 02                	jns    8014e8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014e6:	c9                   	leave
+  8014e7:	c3                   	ret
+		return fd_close(fd, 1);
+  8014e8:	83 ec 08             	sub    $0x8,%esp
+  8014eb:	6a 01                	push   $0x1
+  8014ed:	ff 75 f4             	push   -0xc(%ebp)
+  8014f0:	e8 58 ff ff ff       	call   80144d <fd_close>
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	eb ec                	jmp    8014e6 <close+0x19>
+
+008014fa <close_all>:
+
+void
+close_all(void)
+{
+  8014fa:	55                   	push   %ebp
+  8014fb:	89 e5                	mov    %esp,%ebp
+  8014fd:	53                   	push   %ebx
+  8014fe:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801501:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	53                   	push   %ebx
+  80150a:	e8 be ff ff ff       	call   8014cd <close>
+	for (i = 0; i < MAXFD; i++)
+  80150f:	83 c3 01             	add    $0x1,%ebx
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80151b:	75 e9                	jne    801506 <close_all+0xc>
+}
+  80151d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801520:	c9                   	leave
+  801521:	c3                   	ret
+
+00801522 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	57                   	push   %edi
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+  801528:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80152b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80152e:	50                   	push   %eax
+  80152f:	ff 75 08             	push   0x8(%ebp)
+  801532:	e8 51 fe ff ff       	call   801388 <fd_lookup>
+  801537:	89 c3                	mov    %eax,%ebx
+  801539:	83 c4 10             	add    $0x10,%esp
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	78 7f                	js     8015bf <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801540:	83 ec 0c             	sub    $0xc,%esp
+  801543:	ff 75 0c             	push   0xc(%ebp)
+  801546:	e8 82 ff ff ff       	call   8014cd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80154b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80154e:	c1 e6 0c             	shl    $0xc,%esi
+  801551:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801557:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80155a:	89 3c 24             	mov    %edi,(%esp)
+  80155d:	e8 bf fd ff ff       	call   801321 <fd2data>
+  801562:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801564:	89 34 24             	mov    %esi,(%esp)
+  801567:	e8 b5 fd ff ff       	call   801321 <fd2data>
+  80156c:	83 c4 10             	add    $0x10,%esp
+  80156f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801572:	89 d8                	mov    %ebx,%eax
+  801574:	c1 e8 16             	shr    $0x16,%eax
+  801577:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80157e:	a8 01                	test   $0x1,%al
+  801580:	74 11                	je     801593 <dup+0x71>
+  801582:	89 d8                	mov    %ebx,%eax
+  801584:	c1 e8 0c             	shr    $0xc,%eax
+  801587:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80158e:	f6 c2 01             	test   $0x1,%dl
+  801591:	75 36                	jne    8015c9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801593:	89 f8                	mov    %edi,%eax
+  801595:	c1 e8 0c             	shr    $0xc,%eax
+  801598:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80159f:	83 ec 0c             	sub    $0xc,%esp
+  8015a2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015a7:	50                   	push   %eax
+  8015a8:	56                   	push   %esi
+  8015a9:	6a 00                	push   $0x0
+  8015ab:	57                   	push   %edi
+  8015ac:	6a 00                	push   $0x0
+  8015ae:	e8 3e f9 ff ff       	call   800ef1 <sys_page_map>
+  8015b3:	89 c3                	mov    %eax,%ebx
+  8015b5:	83 c4 20             	add    $0x20,%esp
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	78 33                	js     8015ef <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015bf:	89 d8                	mov    %ebx,%eax
+  8015c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015c9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015d0:	83 ec 0c             	sub    $0xc,%esp
+  8015d3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015d8:	50                   	push   %eax
+  8015d9:	ff 75 d4             	push   -0x2c(%ebp)
+  8015dc:	6a 00                	push   $0x0
+  8015de:	53                   	push   %ebx
+  8015df:	6a 00                	push   $0x0
+  8015e1:	e8 0b f9 ff ff       	call   800ef1 <sys_page_map>
+  8015e6:	89 c3                	mov    %eax,%ebx
+  8015e8:	83 c4 20             	add    $0x20,%esp
+  8015eb:	85 c0                	test   %eax,%eax
+  8015ed:	79 a4                	jns    801593 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015ef:	83 ec 08             	sub    $0x8,%esp
+  8015f2:	56                   	push   %esi
+  8015f3:	6a 00                	push   $0x0
+  8015f5:	e8 39 f9 ff ff       	call   800f33 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015fa:	83 c4 08             	add    $0x8,%esp
+  8015fd:	ff 75 d4             	push   -0x2c(%ebp)
+  801600:	6a 00                	push   $0x0
+  801602:	e8 2c f9 ff ff       	call   800f33 <sys_page_unmap>
+	return r;
+  801607:	83 c4 10             	add    $0x10,%esp
+  80160a:	eb b3                	jmp    8015bf <dup+0x9d>
+
+0080160c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	56                   	push   %esi
+  801610:	53                   	push   %ebx
+  801611:	83 ec 18             	sub    $0x18,%esp
+  801614:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801617:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80161a:	50                   	push   %eax
+  80161b:	53                   	push   %ebx
+  80161c:	e8 67 fd ff ff       	call   801388 <fd_lookup>
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	85 c0                	test   %eax,%eax
+  801626:	78 3c                	js     801664 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801628:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80162b:	83 ec 08             	sub    $0x8,%esp
+  80162e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801631:	50                   	push   %eax
+  801632:	ff 36                	push   (%esi)
+  801634:	e8 a1 fd ff ff       	call   8013da <dev_lookup>
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	78 24                	js     801664 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801640:	8b 46 08             	mov    0x8(%esi),%eax
+  801643:	83 e0 03             	and    $0x3,%eax
+  801646:	83 f8 01             	cmp    $0x1,%eax
+  801649:	74 20                	je     80166b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80164b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164e:	8b 40 08             	mov    0x8(%eax),%eax
+  801651:	85 c0                	test   %eax,%eax
+  801653:	74 54                	je     8016a9 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801655:	83 ec 04             	sub    $0x4,%esp
+  801658:	ff 75 10             	push   0x10(%ebp)
+  80165b:	ff 75 0c             	push   0xc(%ebp)
+  80165e:	56                   	push   %esi
+  80165f:	ff d0                	call   *%eax
+  801661:	83 c4 10             	add    $0x10,%esp
+}
+  801664:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801667:	5b                   	pop    %ebx
+  801668:	5e                   	pop    %esi
+  801669:	5d                   	pop    %ebp
+  80166a:	c3                   	ret
+  80166b:	89 e2                	mov    %esp,%edx
+  80166d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801672:	29 d0                	sub    %edx,%eax
+  801674:	89 c2                	mov    %eax,%edx
+  801676:	c1 ea 0f             	shr    $0xf,%edx
+  801679:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80167e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801683:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801686:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80168d:	8b 40 48             	mov    0x48(%eax),%eax
+  801690:	83 ec 04             	sub    $0x4,%esp
+  801693:	53                   	push   %ebx
+  801694:	50                   	push   %eax
+  801695:	68 99 40 80 00       	push   $0x804099
+  80169a:	e8 e4 ec ff ff       	call   800383 <cprintf>
+		return -E_INVAL;
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a7:	eb bb                	jmp    801664 <read+0x58>
+		return -E_NOT_SUPP;
+  8016a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ae:	eb b4                	jmp    801664 <read+0x58>
+
+008016b0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+  8016b3:	57                   	push   %edi
+  8016b4:	56                   	push   %esi
+  8016b5:	53                   	push   %ebx
+  8016b6:	83 ec 0c             	sub    $0xc,%esp
+  8016b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8016bc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016bf:	85 f6                	test   %esi,%esi
+  8016c1:	74 30                	je     8016f3 <readn+0x43>
+  8016c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c8:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016cd:	83 ec 04             	sub    $0x4,%esp
+  8016d0:	89 f2                	mov    %esi,%edx
+  8016d2:	29 c2                	sub    %eax,%edx
+  8016d4:	52                   	push   %edx
+  8016d5:	01 f8                	add    %edi,%eax
+  8016d7:	50                   	push   %eax
+  8016d8:	ff 75 08             	push   0x8(%ebp)
+  8016db:	e8 2c ff ff ff       	call   80160c <read>
+		if (m < 0)
+  8016e0:	83 c4 10             	add    $0x10,%esp
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	78 15                	js     8016fc <readn+0x4c>
+			return m;
+		if (m == 0)
+  8016e7:	74 11                	je     8016fa <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8016e9:	01 c3                	add    %eax,%ebx
+  8016eb:	89 d8                	mov    %ebx,%eax
+  8016ed:	39 f3                	cmp    %esi,%ebx
+  8016ef:	72 dc                	jb     8016cd <readn+0x1d>
+  8016f1:	eb 09                	jmp    8016fc <readn+0x4c>
+  8016f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f8:	eb 02                	jmp    8016fc <readn+0x4c>
+  8016fa:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8016fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ff:	5b                   	pop    %ebx
+  801700:	5e                   	pop    %esi
+  801701:	5f                   	pop    %edi
+  801702:	5d                   	pop    %ebp
+  801703:	c3                   	ret
+
+00801704 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801704:	55                   	push   %ebp
+  801705:	89 e5                	mov    %esp,%ebp
+  801707:	56                   	push   %esi
+  801708:	53                   	push   %ebx
+  801709:	83 ec 18             	sub    $0x18,%esp
+  80170c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80170f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801712:	50                   	push   %eax
+  801713:	53                   	push   %ebx
+  801714:	e8 6f fc ff ff       	call   801388 <fd_lookup>
+  801719:	83 c4 10             	add    $0x10,%esp
+  80171c:	85 c0                	test   %eax,%eax
+  80171e:	78 37                	js     801757 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801720:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801723:	83 ec 08             	sub    $0x8,%esp
+  801726:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801729:	50                   	push   %eax
+  80172a:	ff 36                	push   (%esi)
+  80172c:	e8 a9 fc ff ff       	call   8013da <dev_lookup>
+  801731:	83 c4 10             	add    $0x10,%esp
+  801734:	85 c0                	test   %eax,%eax
+  801736:	78 1f                	js     801757 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801738:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80173c:	74 20                	je     80175e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80173e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801741:	8b 40 0c             	mov    0xc(%eax),%eax
+  801744:	85 c0                	test   %eax,%eax
+  801746:	74 54                	je     80179c <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801748:	83 ec 04             	sub    $0x4,%esp
+  80174b:	ff 75 10             	push   0x10(%ebp)
+  80174e:	ff 75 0c             	push   0xc(%ebp)
+  801751:	56                   	push   %esi
+  801752:	ff d0                	call   *%eax
+  801754:	83 c4 10             	add    $0x10,%esp
+}
+  801757:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80175a:	5b                   	pop    %ebx
+  80175b:	5e                   	pop    %esi
+  80175c:	5d                   	pop    %ebp
+  80175d:	c3                   	ret
+  80175e:	89 e2                	mov    %esp,%edx
+  801760:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801765:	29 d0                	sub    %edx,%eax
+  801767:	89 c2                	mov    %eax,%edx
+  801769:	c1 ea 0f             	shr    $0xf,%edx
+  80176c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801771:	b8 00 00 00 00       	mov    $0x0,%eax
+  801776:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801779:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801780:	8b 40 48             	mov    0x48(%eax),%eax
+  801783:	83 ec 04             	sub    $0x4,%esp
+  801786:	53                   	push   %ebx
+  801787:	50                   	push   %eax
+  801788:	68 b5 40 80 00       	push   $0x8040b5
+  80178d:	e8 f1 eb ff ff       	call   800383 <cprintf>
+		return -E_INVAL;
+  801792:	83 c4 10             	add    $0x10,%esp
+  801795:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179a:	eb bb                	jmp    801757 <write+0x53>
+		return -E_NOT_SUPP;
+  80179c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017a1:	eb b4                	jmp    801757 <write+0x53>
+
+008017a3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ac:	50                   	push   %eax
+  8017ad:	ff 75 08             	push   0x8(%ebp)
+  8017b0:	e8 d3 fb ff ff       	call   801388 <fd_lookup>
+  8017b5:	83 c4 10             	add    $0x10,%esp
+  8017b8:	85 c0                	test   %eax,%eax
+  8017ba:	78 0e                	js     8017ca <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c2:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ca:	c9                   	leave
+  8017cb:	c3                   	ret
+
+008017cc <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8017cc:	55                   	push   %ebp
+  8017cd:	89 e5                	mov    %esp,%ebp
+  8017cf:	53                   	push   %ebx
+  8017d0:	83 ec 1c             	sub    $0x1c,%esp
+  8017d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d9:	50                   	push   %eax
+  8017da:	ff 75 08             	push   0x8(%ebp)
+  8017dd:	e8 a6 fb ff ff       	call   801388 <fd_lookup>
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	78 33                	js     80181c <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8017e9:	83 fb 03             	cmp    $0x3,%ebx
+  8017ec:	74 28                	je     801816 <fcntl+0x4a>
+  8017ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f3:	83 fb 04             	cmp    $0x4,%ebx
+  8017f6:	75 24                	jne    80181c <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8017f8:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8017fb:	8b 41 08             	mov    0x8(%ecx),%eax
+  8017fe:	80 e4 ef             	and    $0xef,%ah
+  801801:	8b 55 10             	mov    0x10(%ebp),%edx
+  801804:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80180a:	09 d0                	or     %edx,%eax
+  80180c:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80180f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801814:	eb 06                	jmp    80181c <fcntl+0x50>
+		return fd->fd_omode;
+  801816:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801819:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80181c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181f:	c9                   	leave
+  801820:	c3                   	ret
+
+00801821 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801821:	55                   	push   %ebp
+  801822:	89 e5                	mov    %esp,%ebp
+  801824:	56                   	push   %esi
+  801825:	53                   	push   %ebx
+  801826:	83 ec 18             	sub    $0x18,%esp
+  801829:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80182c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80182f:	50                   	push   %eax
+  801830:	53                   	push   %ebx
+  801831:	e8 52 fb ff ff       	call   801388 <fd_lookup>
+  801836:	83 c4 10             	add    $0x10,%esp
+  801839:	85 c0                	test   %eax,%eax
+  80183b:	78 34                	js     801871 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80183d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801840:	83 ec 08             	sub    $0x8,%esp
+  801843:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801846:	50                   	push   %eax
+  801847:	ff 36                	push   (%esi)
+  801849:	e8 8c fb ff ff       	call   8013da <dev_lookup>
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	85 c0                	test   %eax,%eax
+  801853:	78 1c                	js     801871 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801855:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801859:	74 1d                	je     801878 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80185b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185e:	8b 40 18             	mov    0x18(%eax),%eax
+  801861:	85 c0                	test   %eax,%eax
+  801863:	74 51                	je     8018b6 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801865:	83 ec 08             	sub    $0x8,%esp
+  801868:	ff 75 0c             	push   0xc(%ebp)
+  80186b:	56                   	push   %esi
+  80186c:	ff d0                	call   *%eax
+  80186e:	83 c4 10             	add    $0x10,%esp
+}
+  801871:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801874:	5b                   	pop    %ebx
+  801875:	5e                   	pop    %esi
+  801876:	5d                   	pop    %ebp
+  801877:	c3                   	ret
+  801878:	89 e2                	mov    %esp,%edx
+  80187a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80187f:	29 d0                	sub    %edx,%eax
+  801881:	89 c2                	mov    %eax,%edx
+  801883:	c1 ea 0f             	shr    $0xf,%edx
+  801886:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80188b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801890:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801893:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80189a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80189d:	83 ec 04             	sub    $0x4,%esp
+  8018a0:	53                   	push   %ebx
+  8018a1:	50                   	push   %eax
+  8018a2:	68 78 40 80 00       	push   $0x804078
+  8018a7:	e8 d7 ea ff ff       	call   800383 <cprintf>
+		return -E_INVAL;
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b4:	eb bb                	jmp    801871 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018b6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018bb:	eb b4                	jmp    801871 <ftruncate+0x50>
+
+008018bd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018bd:	55                   	push   %ebp
+  8018be:	89 e5                	mov    %esp,%ebp
+  8018c0:	56                   	push   %esi
+  8018c1:	53                   	push   %ebx
+  8018c2:	83 ec 18             	sub    $0x18,%esp
+  8018c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018cb:	50                   	push   %eax
+  8018cc:	ff 75 08             	push   0x8(%ebp)
+  8018cf:	e8 b4 fa ff ff       	call   801388 <fd_lookup>
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 53                	js     80192e <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018db:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018de:	83 ec 08             	sub    $0x8,%esp
+  8018e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018e4:	50                   	push   %eax
+  8018e5:	ff 36                	push   (%esi)
+  8018e7:	e8 ee fa ff ff       	call   8013da <dev_lookup>
+  8018ec:	83 c4 10             	add    $0x10,%esp
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	78 3b                	js     80192e <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8018f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018fa:	74 39                	je     801935 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018fc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018ff:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801906:	00 00 00 
+	stat->st_isdir = 0;
+  801909:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801910:	00 00 00 
+	stat->st_version = 0;
+  801913:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80191a:	00 00 00 
+	stat->st_dev = dev;
+  80191d:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801923:	83 ec 08             	sub    $0x8,%esp
+  801926:	53                   	push   %ebx
+  801927:	56                   	push   %esi
+  801928:	ff 50 14             	call   *0x14(%eax)
+  80192b:	83 c4 10             	add    $0x10,%esp
+}
+  80192e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801931:	5b                   	pop    %ebx
+  801932:	5e                   	pop    %esi
+  801933:	5d                   	pop    %ebp
+  801934:	c3                   	ret
+		return -E_NOT_SUPP;
+  801935:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80193a:	eb f2                	jmp    80192e <fstat+0x71>
+
+0080193c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80193c:	55                   	push   %ebp
+  80193d:	89 e5                	mov    %esp,%ebp
+  80193f:	56                   	push   %esi
+  801940:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801941:	83 ec 08             	sub    $0x8,%esp
+  801944:	6a 00                	push   $0x0
+  801946:	ff 75 08             	push   0x8(%ebp)
+  801949:	e8 b7 01 00 00       	call   801b05 <open>
+  80194e:	89 c3                	mov    %eax,%ebx
+  801950:	83 c4 10             	add    $0x10,%esp
+  801953:	85 c0                	test   %eax,%eax
+  801955:	78 1b                	js     801972 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801957:	83 ec 08             	sub    $0x8,%esp
+  80195a:	ff 75 0c             	push   0xc(%ebp)
+  80195d:	50                   	push   %eax
+  80195e:	e8 5a ff ff ff       	call   8018bd <fstat>
+  801963:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801965:	89 1c 24             	mov    %ebx,(%esp)
+  801968:	e8 60 fb ff ff       	call   8014cd <close>
+	return r;
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	89 f3                	mov    %esi,%ebx
+}
+  801972:	89 d8                	mov    %ebx,%eax
+  801974:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801977:	5b                   	pop    %ebx
+  801978:	5e                   	pop    %esi
+  801979:	5d                   	pop    %ebp
+  80197a:	c3                   	ret
+
+0080197b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	56                   	push   %esi
+  80197f:	53                   	push   %ebx
+  801980:	89 c6                	mov    %eax,%esi
+  801982:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801984:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80198b:	74 27                	je     8019b4 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80198d:	6a 07                	push   $0x7
+  80198f:	68 00 70 80 00       	push   $0x807000
+  801994:	56                   	push   %esi
+  801995:	ff 35 00 60 80 00    	push   0x806000
+  80199b:	e8 d9 1f 00 00       	call   803979 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8019a0:	83 c4 0c             	add    $0xc,%esp
+  8019a3:	6a 00                	push   $0x0
+  8019a5:	53                   	push   %ebx
+  8019a6:	6a 00                	push   $0x0
+  8019a8:	e8 3c 1d 00 00       	call   8036e9 <ipc_recv>
+}
+  8019ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b0:	5b                   	pop    %ebx
+  8019b1:	5e                   	pop    %esi
+  8019b2:	5d                   	pop    %ebp
+  8019b3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019b4:	83 ec 0c             	sub    $0xc,%esp
+  8019b7:	6a 02                	push   $0x2
+  8019b9:	e8 24 20 00 00       	call   8039e2 <ipc_find_env>
+  8019be:	a3 00 60 80 00       	mov    %eax,0x806000
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	eb c5                	jmp    80198d <fsipc+0x12>
+
+008019c8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d4:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8019d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019dc:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019eb:	e8 8b ff ff ff       	call   80197b <fsipc>
+}
+  8019f0:	c9                   	leave
+  8019f1:	c3                   	ret
+
+008019f2 <devfile_flush>:
+{
+  8019f2:	55                   	push   %ebp
+  8019f3:	89 e5                	mov    %esp,%ebp
+  8019f5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fe:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801a03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a08:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a0d:	e8 69 ff ff ff       	call   80197b <fsipc>
+}
+  801a12:	c9                   	leave
+  801a13:	c3                   	ret
+
+00801a14 <devfile_stat>:
+{
+  801a14:	55                   	push   %ebp
+  801a15:	89 e5                	mov    %esp,%ebp
+  801a17:	53                   	push   %ebx
+  801a18:	83 ec 04             	sub    $0x4,%esp
+  801a1b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a21:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a24:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a33:	e8 43 ff ff ff       	call   80197b <fsipc>
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	78 37                	js     801a73 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a3c:	83 ec 08             	sub    $0x8,%esp
+  801a3f:	68 00 70 80 00       	push   $0x807000
+  801a44:	53                   	push   %ebx
+  801a45:	e8 30 f0 ff ff       	call   800a7a <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a4a:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a4f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a55:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a5a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801a60:	a1 88 70 80 00       	mov    0x807088,%eax
+  801a65:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801a6b:	83 c4 10             	add    $0x10,%esp
+  801a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a76:	c9                   	leave
+  801a77:	c3                   	ret
+
+00801a78 <devfile_write>:
+{
+  801a78:	55                   	push   %ebp
+  801a79:	89 e5                	mov    %esp,%ebp
+  801a7b:	83 ec 0c             	sub    $0xc,%esp
+  801a7e:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801a81:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a86:	39 d0                	cmp    %edx,%eax
+  801a88:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a91:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801a97:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801a9c:	50                   	push   %eax
+  801a9d:	ff 75 0c             	push   0xc(%ebp)
+  801aa0:	68 08 70 80 00       	push   $0x807008
+  801aa5:	e8 80 f1 ff ff       	call   800c2a <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801aaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aaf:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ab4:	e8 c2 fe ff ff       	call   80197b <fsipc>
+}
+  801ab9:	c9                   	leave
+  801aba:	c3                   	ret
+
+00801abb <devfile_read>:
+{
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	53                   	push   %ebx
+  801abf:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ac2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801acd:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ad0:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801ad5:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801ada:	b8 03 00 00 00       	mov    $0x3,%eax
+  801adf:	e8 97 fe ff ff       	call   80197b <fsipc>
+  801ae4:	89 c3                	mov    %eax,%ebx
+  801ae6:	85 c0                	test   %eax,%eax
+  801ae8:	78 14                	js     801afe <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801aea:	83 ec 04             	sub    $0x4,%esp
+  801aed:	50                   	push   %eax
+  801aee:	68 00 70 80 00       	push   $0x807000
+  801af3:	ff 75 0c             	push   0xc(%ebp)
+  801af6:	e8 2f f1 ff ff       	call   800c2a <memmove>
+	return r;
+  801afb:	83 c4 10             	add    $0x10,%esp
+}
+  801afe:	89 d8                	mov    %ebx,%eax
+  801b00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b03:	c9                   	leave
+  801b04:	c3                   	ret
+
+00801b05 <open>:
+{
+  801b05:	55                   	push   %ebp
+  801b06:	89 e5                	mov    %esp,%ebp
+  801b08:	53                   	push   %ebx
+  801b09:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801b0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b0f:	50                   	push   %eax
+  801b10:	e8 23 f8 ff ff       	call   801338 <fd_alloc>
+  801b15:	89 c3                	mov    %eax,%ebx
+  801b17:	83 c4 10             	add    $0x10,%esp
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	78 2a                	js     801b48 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801b1e:	83 ec 0c             	sub    $0xc,%esp
+  801b21:	ff 75 08             	push   0x8(%ebp)
+  801b24:	e8 05 ef ff ff       	call   800a2e <strlen>
+  801b29:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801b2c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801b31:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b36:	7e 17                	jle    801b4f <open+0x4a>
+	fd_close(fd, 1);
+  801b38:	83 ec 08             	sub    $0x8,%esp
+  801b3b:	6a 01                	push   $0x1
+  801b3d:	ff 75 f4             	push   -0xc(%ebp)
+  801b40:	e8 08 f9 ff ff       	call   80144d <fd_close>
+	return r;
+  801b45:	83 c4 10             	add    $0x10,%esp
+}
+  801b48:	89 d8                	mov    %ebx,%eax
+  801b4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b4d:	c9                   	leave
+  801b4e:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801b4f:	83 ec 08             	sub    $0x8,%esp
+  801b52:	ff 75 08             	push   0x8(%ebp)
+  801b55:	68 00 70 80 00       	push   $0x807000
+  801b5a:	e8 1b ef ff ff       	call   800a7a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b62:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801b67:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b6f:	e8 07 fe ff ff       	call   80197b <fsipc>
+  801b74:	89 c3                	mov    %eax,%ebx
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	78 bb                	js     801b38 <open+0x33>
+	return fd2num(fd); 	
+  801b7d:	83 ec 0c             	sub    $0xc,%esp
+  801b80:	ff 75 f4             	push   -0xc(%ebp)
+  801b83:	e8 89 f7 ff ff       	call   801311 <fd2num>
+  801b88:	89 c3                	mov    %eax,%ebx
+  801b8a:	83 c4 10             	add    $0x10,%esp
+  801b8d:	eb b9                	jmp    801b48 <open+0x43>
+
+00801b8f <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801b8f:	55                   	push   %ebp
+  801b90:	89 e5                	mov    %esp,%ebp
+  801b92:	53                   	push   %ebx
+  801b93:	83 ec 1c             	sub    $0x1c,%esp
+  801b96:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b99:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b9c:	50                   	push   %eax
+  801b9d:	ff 75 08             	push   0x8(%ebp)
+  801ba0:	e8 e3 f7 ff ff       	call   801388 <fd_lookup>
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 5a                	js     801c06 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801baf:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801bb5:	39 10                	cmp    %edx,(%eax)
+  801bb7:	75 66                	jne    801c1f <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801bb9:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801bc0:	74 49                	je     801c0b <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801bc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801bcd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd0:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801bd5:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bdb:	6a 07                	push   $0x7
+  801bdd:	68 00 70 80 00       	push   $0x807000
+  801be2:	6a 09                	push   $0x9
+  801be4:	ff 35 00 60 80 00    	push   0x806000
+  801bea:	e8 8a 1d 00 00       	call   803979 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801bef:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801bf6:	6a 00                	push   $0x0
+  801bf8:	53                   	push   %ebx
+  801bf9:	ff 75 10             	push   0x10(%ebp)
+  801bfc:	6a 00                	push   $0x0
+  801bfe:	e8 b3 1b 00 00       	call   8037b6 <ipc_recv_pages>
+  801c03:	83 c4 20             	add    $0x20,%esp
+}
+  801c06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c09:	c9                   	leave
+  801c0a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c0b:	83 ec 0c             	sub    $0xc,%esp
+  801c0e:	6a 02                	push   $0x2
+  801c10:	e8 cd 1d 00 00       	call   8039e2 <ipc_find_env>
+  801c15:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c1a:	83 c4 10             	add    $0x10,%esp
+  801c1d:	eb a3                	jmp    801bc2 <fmap+0x33>
+		return -E_INVAL;
+  801c1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c24:	eb e0                	jmp    801c06 <fmap+0x77>
+
+00801c26 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	53                   	push   %ebx
+  801c2a:	83 ec 10             	sub    $0x10,%esp
+  801c2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c30:	53                   	push   %ebx
+  801c31:	e8 f8 ed ff ff       	call   800a2e <strlen>
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c3e:	7f 25                	jg     801c65 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c40:	83 ec 08             	sub    $0x8,%esp
+  801c43:	53                   	push   %ebx
+  801c44:	68 00 70 80 00       	push   $0x807000
+  801c49:	e8 2c ee ff ff       	call   800a7a <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c53:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c58:	e8 1e fd ff ff       	call   80197b <fsipc>
+  801c5d:	83 c4 10             	add    $0x10,%esp
+}
+  801c60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+		return -E_BAD_PATH;
+  801c65:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c6a:	eb f4                	jmp    801c60 <remove+0x3a>
+
+00801c6c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c72:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c77:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c7c:	e8 fa fc ff ff       	call   80197b <fsipc>
+}
+  801c81:	c9                   	leave
+  801c82:	c3                   	ret
+
+00801c83 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c83:	55                   	push   %ebp
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c89:	68 e8 40 80 00       	push   $0x8040e8
+  801c8e:	ff 75 0c             	push   0xc(%ebp)
+  801c91:	e8 e4 ed ff ff       	call   800a7a <strcpy>
+	return 0;
+}
+  801c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9b:	c9                   	leave
+  801c9c:	c3                   	ret
+
+00801c9d <devsock_close>:
+{
+  801c9d:	55                   	push   %ebp
+  801c9e:	89 e5                	mov    %esp,%ebp
+  801ca0:	53                   	push   %ebx
+  801ca1:	83 ec 10             	sub    $0x10,%esp
+  801ca4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ca7:	53                   	push   %ebx
+  801ca8:	e8 74 1d 00 00       	call   803a21 <pageref>
+  801cad:	89 c2                	mov    %eax,%edx
+  801caf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801cb7:	83 fa 01             	cmp    $0x1,%edx
+  801cba:	74 05                	je     801cc1 <devsock_close+0x24>
+}
+  801cbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbf:	c9                   	leave
+  801cc0:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cc1:	83 ec 0c             	sub    $0xc,%esp
+  801cc4:	ff 73 0c             	push   0xc(%ebx)
+  801cc7:	e8 b0 05 00 00       	call   80227c <nsipc_close>
+  801ccc:	83 c4 10             	add    $0x10,%esp
+  801ccf:	eb eb                	jmp    801cbc <devsock_close+0x1f>
+
+00801cd1 <devsock_write>:
+{
+  801cd1:	55                   	push   %ebp
+  801cd2:	89 e5                	mov    %esp,%ebp
+  801cd4:	53                   	push   %ebx
+  801cd5:	83 ec 14             	sub    $0x14,%esp
+  801cd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cdb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cde:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801ce1:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801ce4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801ce7:	8b 41 08             	mov    0x8(%ecx),%eax
+  801cea:	c1 f8 09             	sar    $0x9,%eax
+  801ced:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801cf0:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801cf6:	77 13                	ja     801d0b <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801cf8:	50                   	push   %eax
+  801cf9:	52                   	push   %edx
+  801cfa:	53                   	push   %ebx
+  801cfb:	ff 71 0c             	push   0xc(%ecx)
+  801cfe:	e8 5c 06 00 00       	call   80235f <nsipc_send>
+  801d03:	83 c4 10             	add    $0x10,%esp
+}
+  801d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d09:	c9                   	leave
+  801d0a:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801d0b:	50                   	push   %eax
+  801d0c:	6a 01                	push   $0x1
+  801d0e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d11:	50                   	push   %eax
+  801d12:	ff 71 0c             	push   0xc(%ecx)
+  801d15:	e8 a6 06 00 00       	call   8023c0 <nsipc_sendmsg>
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	eb e7                	jmp    801d06 <devsock_write+0x35>
+
+00801d1f <devsock_read>:
+{
+  801d1f:	55                   	push   %ebp
+  801d20:	89 e5                	mov    %esp,%ebp
+  801d22:	53                   	push   %ebx
+  801d23:	83 ec 14             	sub    $0x14,%esp
+  801d26:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d29:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d2c:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801d2f:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801d32:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801d35:	8b 41 08             	mov    0x8(%ecx),%eax
+  801d38:	c1 f8 09             	sar    $0x9,%eax
+  801d3b:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801d3e:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801d44:	77 13                	ja     801d59 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801d46:	50                   	push   %eax
+  801d47:	52                   	push   %edx
+  801d48:	53                   	push   %ebx
+  801d49:	ff 71 0c             	push   0xc(%ecx)
+  801d4c:	e8 9c 05 00 00       	call   8022ed <nsipc_recv>
+  801d51:	83 c4 10             	add    $0x10,%esp
+}
+  801d54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801d59:	50                   	push   %eax
+  801d5a:	6a 01                	push   $0x1
+  801d5c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d5f:	50                   	push   %eax
+  801d60:	ff 71 0c             	push   0xc(%ecx)
+  801d63:	e8 02 0a 00 00       	call   80276a <nsipc_recvmsg>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	eb e7                	jmp    801d54 <devsock_read+0x35>
+
+00801d6d <fd2sockid>:
+{
+  801d6d:	55                   	push   %ebp
+  801d6e:	89 e5                	mov    %esp,%ebp
+  801d70:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d73:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d76:	52                   	push   %edx
+  801d77:	50                   	push   %eax
+  801d78:	e8 0b f6 ff ff       	call   801388 <fd_lookup>
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	85 c0                	test   %eax,%eax
+  801d82:	78 10                	js     801d94 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d87:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801d8d:	39 08                	cmp    %ecx,(%eax)
+  801d8f:	75 05                	jne    801d96 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d91:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d9b:	eb f7                	jmp    801d94 <fd2sockid+0x27>
+
+00801d9d <sock_flags>:
+{
+  801d9d:	55                   	push   %ebp
+  801d9e:	89 e5                	mov    %esp,%ebp
+  801da0:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801da3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801da6:	52                   	push   %edx
+  801da7:	50                   	push   %eax
+  801da8:	e8 db f5 ff ff       	call   801388 <fd_lookup>
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 0e                	js     801dc2 <sock_flags+0x25>
+  801db4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801db7:	8b 40 08             	mov    0x8(%eax),%eax
+  801dba:	c1 e8 09             	shr    $0x9,%eax
+  801dbd:	83 e0 08             	and    $0x8,%eax
+}
+  801dc0:	c9                   	leave
+  801dc1:	c3                   	ret
+		return 0;
+  801dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc7:	eb f7                	jmp    801dc0 <sock_flags+0x23>
+
+00801dc9 <alloc_sockfd>:
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	56                   	push   %esi
+  801dcd:	53                   	push   %ebx
+  801dce:	83 ec 1c             	sub    $0x1c,%esp
+  801dd1:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801dd3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dd6:	50                   	push   %eax
+  801dd7:	e8 5c f5 ff ff       	call   801338 <fd_alloc>
+  801ddc:	89 c3                	mov    %eax,%ebx
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 43                	js     801e28 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801de5:	83 ec 04             	sub    $0x4,%esp
+  801de8:	68 07 04 00 00       	push   $0x407
+  801ded:	ff 75 f4             	push   -0xc(%ebp)
+  801df0:	6a 00                	push   $0x0
+  801df2:	e8 b7 f0 ff ff       	call   800eae <sys_page_alloc>
+  801df7:	89 c3                	mov    %eax,%ebx
+  801df9:	83 c4 10             	add    $0x10,%esp
+  801dfc:	85 c0                	test   %eax,%eax
+  801dfe:	78 28                	js     801e28 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801e00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e03:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801e09:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801e0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e0e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801e15:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801e18:	83 ec 0c             	sub    $0xc,%esp
+  801e1b:	50                   	push   %eax
+  801e1c:	e8 f0 f4 ff ff       	call   801311 <fd2num>
+  801e21:	89 c3                	mov    %eax,%ebx
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	eb 0c                	jmp    801e34 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e28:	83 ec 0c             	sub    $0xc,%esp
+  801e2b:	56                   	push   %esi
+  801e2c:	e8 4b 04 00 00       	call   80227c <nsipc_close>
+		return r;
+  801e31:	83 c4 10             	add    $0x10,%esp
+}
+  801e34:	89 d8                	mov    %ebx,%eax
+  801e36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e39:	5b                   	pop    %ebx
+  801e3a:	5e                   	pop    %esi
+  801e3b:	5d                   	pop    %ebp
+  801e3c:	c3                   	ret
+
+00801e3d <accept>:
+{
+  801e3d:	55                   	push   %ebp
+  801e3e:	89 e5                	mov    %esp,%ebp
+  801e40:	56                   	push   %esi
+  801e41:	53                   	push   %ebx
+  801e42:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e45:	89 f0                	mov    %esi,%eax
+  801e47:	e8 21 ff ff ff       	call   801d6d <fd2sockid>
+  801e4c:	89 c3                	mov    %eax,%ebx
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 24                	js     801e76 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801e52:	89 f0                	mov    %esi,%eax
+  801e54:	e8 44 ff ff ff       	call   801d9d <sock_flags>
+  801e59:	50                   	push   %eax
+  801e5a:	ff 75 10             	push   0x10(%ebp)
+  801e5d:	ff 75 0c             	push   0xc(%ebp)
+  801e60:	53                   	push   %ebx
+  801e61:	e8 6b 03 00 00       	call   8021d1 <nsipc_accept>
+  801e66:	89 c3                	mov    %eax,%ebx
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 07                	js     801e76 <accept+0x39>
+	return alloc_sockfd(r);
+  801e6f:	e8 55 ff ff ff       	call   801dc9 <alloc_sockfd>
+  801e74:	89 c3                	mov    %eax,%ebx
+}
+  801e76:	89 d8                	mov    %ebx,%eax
+  801e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7b:	5b                   	pop    %ebx
+  801e7c:	5e                   	pop    %esi
+  801e7d:	5d                   	pop    %ebp
+  801e7e:	c3                   	ret
+
+00801e7f <bind>:
+{
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e88:	e8 e0 fe ff ff       	call   801d6d <fd2sockid>
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	78 12                	js     801ea3 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e91:	83 ec 04             	sub    $0x4,%esp
+  801e94:	ff 75 10             	push   0x10(%ebp)
+  801e97:	ff 75 0c             	push   0xc(%ebp)
+  801e9a:	50                   	push   %eax
+  801e9b:	e8 85 03 00 00       	call   802225 <nsipc_bind>
+  801ea0:	83 c4 10             	add    $0x10,%esp
+}
+  801ea3:	c9                   	leave
+  801ea4:	c3                   	ret
+
+00801ea5 <shutdown>:
+{
+  801ea5:	55                   	push   %ebp
+  801ea6:	89 e5                	mov    %esp,%ebp
+  801ea8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801eab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eae:	e8 ba fe ff ff       	call   801d6d <fd2sockid>
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 0f                	js     801ec6 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801eb7:	83 ec 08             	sub    $0x8,%esp
+  801eba:	ff 75 0c             	push   0xc(%ebp)
+  801ebd:	50                   	push   %eax
+  801ebe:	e8 97 03 00 00       	call   80225a <nsipc_shutdown>
+  801ec3:	83 c4 10             	add    $0x10,%esp
+}
+  801ec6:	c9                   	leave
+  801ec7:	c3                   	ret
+
+00801ec8 <connect>:
+{
+  801ec8:	55                   	push   %ebp
+  801ec9:	89 e5                	mov    %esp,%ebp
+  801ecb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ece:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed1:	e8 97 fe ff ff       	call   801d6d <fd2sockid>
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	78 12                	js     801eec <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801eda:	83 ec 04             	sub    $0x4,%esp
+  801edd:	ff 75 10             	push   0x10(%ebp)
+  801ee0:	ff 75 0c             	push   0xc(%ebp)
+  801ee3:	50                   	push   %eax
+  801ee4:	e8 ad 03 00 00       	call   802296 <nsipc_connect>
+  801ee9:	83 c4 10             	add    $0x10,%esp
+}
+  801eec:	c9                   	leave
+  801eed:	c3                   	ret
+
+00801eee <listen>:
+{
+  801eee:	55                   	push   %ebp
+  801eef:	89 e5                	mov    %esp,%ebp
+  801ef1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ef4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef7:	e8 71 fe ff ff       	call   801d6d <fd2sockid>
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	78 0f                	js     801f0f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801f00:	83 ec 08             	sub    $0x8,%esp
+  801f03:	ff 75 0c             	push   0xc(%ebp)
+  801f06:	50                   	push   %eax
+  801f07:	e8 bf 03 00 00       	call   8022cb <nsipc_listen>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+}
+  801f0f:	c9                   	leave
+  801f10:	c3                   	ret
+
+00801f11 <sendmsg>:
+{
+  801f11:	55                   	push   %ebp
+  801f12:	89 e5                	mov    %esp,%ebp
+  801f14:	57                   	push   %edi
+  801f15:	56                   	push   %esi
+  801f16:	53                   	push   %ebx
+  801f17:	83 ec 0c             	sub    $0xc,%esp
+  801f1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f1d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801f20:	89 f0                	mov    %esi,%eax
+  801f22:	e8 46 fe ff ff       	call   801d6d <fd2sockid>
+  801f27:	89 c3                	mov    %eax,%ebx
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 1c                	js     801f49 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801f2d:	89 f0                	mov    %esi,%eax
+  801f2f:	e8 69 fe ff ff       	call   801d9d <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f34:	0b 45 10             	or     0x10(%ebp),%eax
+  801f37:	50                   	push   %eax
+  801f38:	ff 77 0c             	push   0xc(%edi)
+  801f3b:	ff 77 08             	push   0x8(%edi)
+  801f3e:	53                   	push   %ebx
+  801f3f:	e8 7c 04 00 00       	call   8023c0 <nsipc_sendmsg>
+  801f44:	89 c3                	mov    %eax,%ebx
+  801f46:	83 c4 10             	add    $0x10,%esp
+}
+  801f49:	89 d8                	mov    %ebx,%eax
+  801f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f4e:	5b                   	pop    %ebx
+  801f4f:	5e                   	pop    %esi
+  801f50:	5f                   	pop    %edi
+  801f51:	5d                   	pop    %ebp
+  801f52:	c3                   	ret
+
+00801f53 <recvmsg>:
+{
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	57                   	push   %edi
+  801f57:	56                   	push   %esi
+  801f58:	53                   	push   %ebx
+  801f59:	83 ec 0c             	sub    $0xc,%esp
+  801f5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f5f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f62:	89 f8                	mov    %edi,%eax
+  801f64:	e8 04 fe ff ff       	call   801d6d <fd2sockid>
+  801f69:	89 c3                	mov    %eax,%ebx
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 2a                	js     801f99 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801f6f:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801f76:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801f7d:	89 f8                	mov    %edi,%eax
+  801f7f:	e8 19 fe ff ff       	call   801d9d <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f84:	0b 45 10             	or     0x10(%ebp),%eax
+  801f87:	50                   	push   %eax
+  801f88:	ff 76 0c             	push   0xc(%esi)
+  801f8b:	ff 76 08             	push   0x8(%esi)
+  801f8e:	53                   	push   %ebx
+  801f8f:	e8 d6 07 00 00       	call   80276a <nsipc_recvmsg>
+  801f94:	89 c3                	mov    %eax,%ebx
+  801f96:	83 c4 10             	add    $0x10,%esp
+}
+  801f99:	89 d8                	mov    %ebx,%eax
+  801f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f9e:	5b                   	pop    %ebx
+  801f9f:	5e                   	pop    %esi
+  801fa0:	5f                   	pop    %edi
+  801fa1:	5d                   	pop    %ebp
+  801fa2:	c3                   	ret
+
+00801fa3 <sendfile>:
+{
+  801fa3:	55                   	push   %ebp
+  801fa4:	89 e5                	mov    %esp,%ebp
+  801fa6:	56                   	push   %esi
+  801fa7:	53                   	push   %ebx
+  801fa8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801fab:	89 f0                	mov    %esi,%eax
+  801fad:	e8 bb fd ff ff       	call   801d6d <fd2sockid>
+  801fb2:	89 c3                	mov    %eax,%ebx
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 1f                	js     801fd7 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801fb8:	89 f0                	mov    %esi,%eax
+  801fba:	e8 de fd ff ff       	call   801d9d <sock_flags>
+  801fbf:	83 ec 0c             	sub    $0xc,%esp
+  801fc2:	50                   	push   %eax
+  801fc3:	ff 75 14             	push   0x14(%ebp)
+  801fc6:	ff 75 10             	push   0x10(%ebp)
+  801fc9:	ff 75 0c             	push   0xc(%ebp)
+  801fcc:	53                   	push   %ebx
+  801fcd:	e8 64 06 00 00       	call   802636 <nsipc_sendfile>
+  801fd2:	89 c3                	mov    %eax,%ebx
+  801fd4:	83 c4 20             	add    $0x20,%esp
+}
+  801fd7:	89 d8                	mov    %ebx,%eax
+  801fd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fdc:	5b                   	pop    %ebx
+  801fdd:	5e                   	pop    %esi
+  801fde:	5d                   	pop    %ebp
+  801fdf:	c3                   	ret
+
+00801fe0 <evctl>:
+{
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	53                   	push   %ebx
+  801fe4:	83 ec 04             	sub    $0x4,%esp
+  801fe7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801fea:	89 d8                	mov    %ebx,%eax
+  801fec:	e8 7c fd ff ff       	call   801d6d <fd2sockid>
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 10                	js     802005 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801ff5:	83 ec 04             	sub    $0x4,%esp
+  801ff8:	53                   	push   %ebx
+  801ff9:	ff 75 0c             	push   0xc(%ebp)
+  801ffc:	50                   	push   %eax
+  801ffd:	e8 d2 0b 00 00       	call   802bd4 <nsipc_evctl>
+  802002:	83 c4 10             	add    $0x10,%esp
+}
+  802005:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+0080200a <evwait>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802010:	ff 75 10             	push   0x10(%ebp)
+  802013:	ff 75 0c             	push   0xc(%ebp)
+  802016:	ff 75 08             	push   0x8(%ebp)
+  802019:	e8 e0 0b 00 00       	call   802bfe <nsipc_evwait>
+}
+  80201e:	c9                   	leave
+  80201f:	c3                   	ret
+
+00802020 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802020:	55                   	push   %ebp
+  802021:	89 e5                	mov    %esp,%ebp
+  802023:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802026:	ff 75 10             	push   0x10(%ebp)
+  802029:	ff 75 0c             	push   0xc(%ebp)
+  80202c:	ff 75 08             	push   0x8(%ebp)
+  80202f:	e8 31 0c 00 00       	call   802c65 <nsipc_socket>
+  802034:	83 c4 10             	add    $0x10,%esp
+  802037:	85 c0                	test   %eax,%eax
+  802039:	78 05                	js     802040 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80203b:	e8 89 fd ff ff       	call   801dc9 <alloc_sockfd>
+}
+  802040:	c9                   	leave
+  802041:	c3                   	ret
+
+00802042 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802042:	55                   	push   %ebp
+  802043:	89 e5                	mov    %esp,%ebp
+  802045:	53                   	push   %ebx
+  802046:	83 ec 04             	sub    $0x4,%esp
+  802049:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80204b:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802052:	74 26                	je     80207a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802054:	6a 07                	push   $0x7
+  802056:	68 00 80 80 00       	push   $0x808000
+  80205b:	53                   	push   %ebx
+  80205c:	ff 35 24 63 80 00    	push   0x806324
+  802062:	e8 12 19 00 00       	call   803979 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802067:	83 c4 0c             	add    $0xc,%esp
+  80206a:	6a 00                	push   $0x0
+  80206c:	6a 00                	push   $0x0
+  80206e:	6a 00                	push   $0x0
+  802070:	e8 74 16 00 00       	call   8036e9 <ipc_recv>
+}
+  802075:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802078:	c9                   	leave
+  802079:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	6a 03                	push   $0x3
+  80207f:	e8 5e 19 00 00       	call   8039e2 <ipc_find_env>
+  802084:	a3 24 63 80 00       	mov    %eax,0x806324
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	eb c6                	jmp    802054 <nsipc+0x12>
+
+0080208e <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80208e:	55                   	push   %ebp
+  80208f:	89 e5                	mov    %esp,%ebp
+  802091:	56                   	push   %esi
+  802092:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802093:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  802099:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80209e:	85 f6                	test   %esi,%esi
+  8020a0:	75 33                	jne    8020d5 <nsbulk_map+0x47>
+  8020a2:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8020a7:	83 ec 04             	sub    $0x4,%esp
+  8020aa:	6a 07                	push   $0x7
+  8020ac:	53                   	push   %ebx
+  8020ad:	6a 00                	push   $0x0
+  8020af:	e8 fa ed ff ff       	call   800eae <sys_page_alloc>
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	78 1a                	js     8020d5 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8020bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020c1:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8020c7:	75 de                	jne    8020a7 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8020c9:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  8020d0:	00 00 00 
+	return 0;
+  8020d3:	89 f0                	mov    %esi,%eax
+}
+  8020d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d8:	5b                   	pop    %ebx
+  8020d9:	5e                   	pop    %esi
+  8020da:	5d                   	pop    %ebp
+  8020db:	c3                   	ret
+
+008020dc <nsbulk_own>:
+{
+  8020dc:	55                   	push   %ebp
+  8020dd:	89 e5                	mov    %esp,%ebp
+  8020df:	57                   	push   %edi
+  8020e0:	56                   	push   %esi
+  8020e1:	53                   	push   %ebx
+  8020e2:	83 ec 0c             	sub    $0xc,%esp
+  8020e5:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8020e7:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8020ea:	85 d2                	test   %edx,%edx
+  8020ec:	7f 0e                	jg     8020fc <nsbulk_own+0x20>
+	return 0;
+  8020ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f3:	eb 47                	jmp    80213c <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8020f5:	83 c3 01             	add    $0x1,%ebx
+  8020f8:	39 fb                	cmp    %edi,%ebx
+  8020fa:	7d 3b                	jge    802137 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8020fc:	be 01 00 00 00       	mov    $0x1,%esi
+  802101:	89 d9                	mov    %ebx,%ecx
+  802103:	d3 e6                	shl    %cl,%esi
+  802105:	89 f0                	mov    %esi,%eax
+  802107:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  80210d:	74 e6                	je     8020f5 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80210f:	83 ec 04             	sub    $0x4,%esp
+  802112:	6a 07                	push   $0x7
+  802114:	89 d8                	mov    %ebx,%eax
+  802116:	c1 e0 0c             	shl    $0xc,%eax
+  802119:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80211e:	50                   	push   %eax
+  80211f:	6a 00                	push   $0x0
+  802121:	e8 88 ed ff ff       	call   800eae <sys_page_alloc>
+  802126:	83 c4 10             	add    $0x10,%esp
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	78 0f                	js     80213c <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80212d:	f7 d6                	not    %esi
+  80212f:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  802135:	eb be                	jmp    8020f5 <nsbulk_own+0x19>
+	return 0;
+  802137:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80213c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80213f:	5b                   	pop    %ebx
+  802140:	5e                   	pop    %esi
+  802141:	5f                   	pop    %edi
+  802142:	5d                   	pop    %ebp
+  802143:	c3                   	ret
+
+00802144 <nsipc_bulk>:
+{
+  802144:	55                   	push   %ebp
+  802145:	89 e5                	mov    %esp,%ebp
+  802147:	57                   	push   %edi
+  802148:	56                   	push   %esi
+  802149:	53                   	push   %ebx
+  80214a:	83 ec 1c             	sub    $0x1c,%esp
+  80214d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802150:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802152:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802158:	c1 fb 0c             	sar    $0xc,%ebx
+  80215b:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80215e:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802165:	74 56                	je     8021bd <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802167:	85 ff                	test   %edi,%edi
+  802169:	7e 24                	jle    80218f <nsipc_bulk+0x4b>
+  80216b:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802171:	74 1c                	je     80218f <nsipc_bulk+0x4b>
+  802173:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802179:	c1 e3 0c             	shl    $0xc,%ebx
+  80217c:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802181:	0f b6 10             	movzbl (%eax),%edx
+  802184:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802186:	05 00 10 00 00       	add    $0x1000,%eax
+  80218b:	39 d8                	cmp    %ebx,%eax
+  80218d:	75 f2                	jne    802181 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80218f:	83 ec 0c             	sub    $0xc,%esp
+  802192:	56                   	push   %esi
+  802193:	57                   	push   %edi
+  802194:	68 00 00 00 e0       	push   $0xe0000000
+  802199:	ff 75 e4             	push   -0x1c(%ebp)
+  80219c:	ff 35 24 63 80 00    	push   0x806324
+  8021a2:	e8 06 18 00 00       	call   8039ad <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8021a7:	83 c4 1c             	add    $0x1c,%esp
+  8021aa:	6a 00                	push   $0x0
+  8021ac:	6a 00                	push   $0x0
+  8021ae:	6a 00                	push   $0x0
+  8021b0:	e8 34 15 00 00       	call   8036e9 <ipc_recv>
+}
+  8021b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b8:	5b                   	pop    %ebx
+  8021b9:	5e                   	pop    %esi
+  8021ba:	5f                   	pop    %edi
+  8021bb:	5d                   	pop    %ebp
+  8021bc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8021bd:	83 ec 0c             	sub    $0xc,%esp
+  8021c0:	6a 03                	push   $0x3
+  8021c2:	e8 1b 18 00 00       	call   8039e2 <ipc_find_env>
+  8021c7:	a3 24 63 80 00       	mov    %eax,0x806324
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	eb 96                	jmp    802167 <nsipc_bulk+0x23>
+
+008021d1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8021d1:	55                   	push   %ebp
+  8021d2:	89 e5                	mov    %esp,%ebp
+  8021d4:	53                   	push   %ebx
+  8021d5:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8021d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021db:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8021e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021e3:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8021e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ed:	e8 50 fe ff ff       	call   802042 <nsipc>
+  8021f2:	89 c3                	mov    %eax,%ebx
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	79 07                	jns    8021ff <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8021f8:	89 d8                	mov    %ebx,%eax
+  8021fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8021ff:	83 ec 04             	sub    $0x4,%esp
+  802202:	ff 35 10 80 80 00    	push   0x808010
+  802208:	68 00 80 80 00       	push   $0x808000
+  80220d:	ff 75 0c             	push   0xc(%ebp)
+  802210:	e8 15 ea ff ff       	call   800c2a <memmove>
+		*addrlen = ret->ret_addrlen;
+  802215:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80221b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80221e:	89 10                	mov    %edx,(%eax)
+  802220:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802223:	eb d3                	jmp    8021f8 <nsipc_accept+0x27>
+
+00802225 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802225:	55                   	push   %ebp
+  802226:	89 e5                	mov    %esp,%ebp
+  802228:	53                   	push   %ebx
+  802229:	83 ec 08             	sub    $0x8,%esp
+  80222c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80222f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802232:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802237:	53                   	push   %ebx
+  802238:	ff 75 0c             	push   0xc(%ebp)
+  80223b:	68 04 80 80 00       	push   $0x808004
+  802240:	e8 e5 e9 ff ff       	call   800c2a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802245:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80224b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802250:	e8 ed fd ff ff       	call   802042 <nsipc>
+}
+  802255:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802258:	c9                   	leave
+  802259:	c3                   	ret
+
+0080225a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80225a:	55                   	push   %ebp
+  80225b:	89 e5                	mov    %esp,%ebp
+  80225d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802260:	8b 45 08             	mov    0x8(%ebp),%eax
+  802263:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802268:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80226b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802270:	b8 03 00 00 00       	mov    $0x3,%eax
+  802275:	e8 c8 fd ff ff       	call   802042 <nsipc>
+}
+  80227a:	c9                   	leave
+  80227b:	c3                   	ret
+
+0080227c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80227c:	55                   	push   %ebp
+  80227d:	89 e5                	mov    %esp,%ebp
+  80227f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802282:	8b 45 08             	mov    0x8(%ebp),%eax
+  802285:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80228a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80228f:	e8 ae fd ff ff       	call   802042 <nsipc>
+}
+  802294:	c9                   	leave
+  802295:	c3                   	ret
+
+00802296 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	53                   	push   %ebx
+  80229a:	83 ec 08             	sub    $0x8,%esp
+  80229d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8022a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a3:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8022a8:	53                   	push   %ebx
+  8022a9:	ff 75 0c             	push   0xc(%ebp)
+  8022ac:	68 04 80 80 00       	push   $0x808004
+  8022b1:	e8 74 e9 ff ff       	call   800c2a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8022b6:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8022bc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022c1:	e8 7c fd ff ff       	call   802042 <nsipc>
+}
+  8022c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c9:	c9                   	leave
+  8022ca:	c3                   	ret
+
+008022cb <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8022cb:	55                   	push   %ebp
+  8022cc:	89 e5                	mov    %esp,%ebp
+  8022ce:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8022d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8022d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022dc:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8022e1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022e6:	e8 57 fd ff ff       	call   802042 <nsipc>
+}
+  8022eb:	c9                   	leave
+  8022ec:	c3                   	ret
+
+008022ed <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8022ed:	55                   	push   %ebp
+  8022ee:	89 e5                	mov    %esp,%ebp
+  8022f0:	56                   	push   %esi
+  8022f1:	53                   	push   %ebx
+  8022f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8022f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8022fd:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802303:	8b 45 14             	mov    0x14(%ebp),%eax
+  802306:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80230b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802310:	e8 2d fd ff ff       	call   802042 <nsipc>
+  802315:	89 c3                	mov    %eax,%ebx
+  802317:	85 c0                	test   %eax,%eax
+  802319:	78 22                	js     80233d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80231b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802320:	39 c6                	cmp    %eax,%esi
+  802322:	0f 4e c6             	cmovle %esi,%eax
+  802325:	39 c3                	cmp    %eax,%ebx
+  802327:	7f 1d                	jg     802346 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802329:	83 ec 04             	sub    $0x4,%esp
+  80232c:	53                   	push   %ebx
+  80232d:	68 00 80 80 00       	push   $0x808000
+  802332:	ff 75 0c             	push   0xc(%ebp)
+  802335:	e8 f0 e8 ff ff       	call   800c2a <memmove>
+  80233a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80233d:	89 d8                	mov    %ebx,%eax
+  80233f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802342:	5b                   	pop    %ebx
+  802343:	5e                   	pop    %esi
+  802344:	5d                   	pop    %ebp
+  802345:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802346:	68 f4 40 80 00       	push   $0x8040f4
+  80234b:	68 09 41 80 00       	push   $0x804109
+  802350:	68 b2 00 00 00       	push   $0xb2
+  802355:	68 1e 41 80 00       	push   $0x80411e
+  80235a:	e8 49 df ff ff       	call   8002a8 <_panic>
+
+0080235f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	53                   	push   %ebx
+  802363:	83 ec 04             	sub    $0x4,%esp
+  802366:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236c:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802371:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802377:	7f 2e                	jg     8023a7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802379:	83 ec 04             	sub    $0x4,%esp
+  80237c:	53                   	push   %ebx
+  80237d:	ff 75 0c             	push   0xc(%ebp)
+  802380:	68 0c 80 80 00       	push   $0x80800c
+  802385:	e8 a0 e8 ff ff       	call   800c2a <memmove>
+	nsipcbuf.send.req_size = size;
+  80238a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802390:	8b 45 14             	mov    0x14(%ebp),%eax
+  802393:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802398:	b8 08 00 00 00       	mov    $0x8,%eax
+  80239d:	e8 a0 fc ff ff       	call   802042 <nsipc>
+}
+  8023a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a5:	c9                   	leave
+  8023a6:	c3                   	ret
+	assert(size < 1600);
+  8023a7:	68 2a 41 80 00       	push   $0x80412a
+  8023ac:	68 09 41 80 00       	push   $0x804109
+  8023b1:	68 bd 00 00 00       	push   $0xbd
+  8023b6:	68 1e 41 80 00       	push   $0x80411e
+  8023bb:	e8 e8 de ff ff       	call   8002a8 <_panic>
+
+008023c0 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8023c0:	55                   	push   %ebp
+  8023c1:	89 e5                	mov    %esp,%ebp
+  8023c3:	57                   	push   %edi
+  8023c4:	56                   	push   %esi
+  8023c5:	53                   	push   %ebx
+  8023c6:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8023c9:	e8 c0 fc ff ff       	call   80208e <nsbulk_map>
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 55                	js     802427 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8023d2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8023d9:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8023e0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8023e7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023ea:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023ed:	0f 8d 24 02 00 00    	jge    802617 <nsipc_sendmsg+0x257>
+  8023f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023f6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023f9:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8023fc:	89 d8                	mov    %ebx,%eax
+  8023fe:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802403:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802405:	83 ec 0c             	sub    $0xc,%esp
+  802408:	68 20 60 80 00       	push   $0x806020
+  80240d:	e8 5a 0f 00 00       	call   80336c <pgbatch_init>
+  802412:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802415:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802417:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80241a:	e9 82 00 00 00       	jmp    8024a1 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80241f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802422:	85 db                	test   %ebx,%ebx
+  802424:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242a:	5b                   	pop    %ebx
+  80242b:	5e                   	pop    %esi
+  80242c:	5f                   	pop    %edi
+  80242d:	5d                   	pop    %ebp
+  80242e:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80242f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802434:	29 c8                	sub    %ecx,%eax
+  802436:	39 d0                	cmp    %edx,%eax
+  802438:	0f 46 d0             	cmovbe %eax,%edx
+  80243b:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80243d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802443:	85 ff                	test   %edi,%edi
+  802445:	0f 49 c7             	cmovns %edi,%eax
+  802448:	c1 f8 0c             	sar    $0xc,%eax
+  80244b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802450:	e8 87 fc ff ff       	call   8020dc <nsbulk_own>
+  802455:	85 c0                	test   %eax,%eax
+  802457:	0f 88 17 01 00 00    	js     802574 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80245d:	83 ec 04             	sub    $0x4,%esp
+  802460:	56                   	push   %esi
+  802461:	ff 75 e0             	push   -0x20(%ebp)
+  802464:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802467:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80246c:	50                   	push   %eax
+  80246d:	e8 b8 e7 ff ff       	call   800c2a <memmove>
+  802472:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802475:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802478:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80247b:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80247e:	0f 84 fd 00 00 00    	je     802581 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802484:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802487:	01 f7                	add    %esi,%edi
+  802489:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80248c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80248f:	0f 8d 01 01 00 00    	jge    802596 <nsipc_sendmsg+0x1d6>
+  802495:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80249b:	0f 8f f0 00 00 00    	jg     802591 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8024a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024a4:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8024a7:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8024aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024ad:	89 c2                	mov    %eax,%edx
+  8024af:	03 13                	add    (%ebx),%edx
+  8024b1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8024b4:	8b 73 04             	mov    0x4(%ebx),%esi
+  8024b7:	29 c6                	sub    %eax,%esi
+  8024b9:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8024be:	29 f9                	sub    %edi,%ecx
+  8024c0:	39 ce                	cmp    %ecx,%esi
+  8024c2:	89 ca                	mov    %ecx,%edx
+  8024c4:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8024c7:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8024ca:	89 f9                	mov    %edi,%ecx
+  8024cc:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8024d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024d5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024da:	09 c8                	or     %ecx,%eax
+  8024dc:	0f 85 4d ff ff ff    	jne    80242f <nsipc_sendmsg+0x6f>
+  8024e2:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8024e8:	0f 86 41 ff ff ff    	jbe    80242f <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024ee:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8024f4:	85 ff                	test   %edi,%edi
+  8024f6:	0f 49 c7             	cmovns %edi,%eax
+  8024f9:	c1 f8 0c             	sar    $0xc,%eax
+  8024fc:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8024fe:	89 d1                	mov    %edx,%ecx
+  802500:	c1 e9 0c             	shr    $0xc,%ecx
+  802503:	01 c8                	add    %ecx,%eax
+  802505:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802508:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80250b:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80250d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802510:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802515:	29 c8                	sub    %ecx,%eax
+  802517:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80251a:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80251d:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80251f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802524:	89 f9                	mov    %edi,%ecx
+  802526:	d3 e0                	shl    %cl,%eax
+  802528:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80252e:	83 ec 08             	sub    $0x8,%esp
+  802531:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802533:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802536:	50                   	push   %eax
+  802537:	6a 00                	push   $0x0
+  802539:	56                   	push   %esi
+  80253a:	6a 00                	push   $0x0
+  80253c:	68 20 60 80 00       	push   $0x806020
+  802541:	e8 e4 0e 00 00       	call   80342a <pgbatch_map>
+  802546:	83 c4 20             	add    $0x20,%esp
+  802549:	85 c0                	test   %eax,%eax
+  80254b:	0f 88 ce fe ff ff    	js     80241f <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802551:	83 c7 01             	add    $0x1,%edi
+  802554:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80255a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80255d:	39 c7                	cmp    %eax,%edi
+  80255f:	75 be                	jne    80251f <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802561:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802564:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802567:	89 d6                	mov    %edx,%esi
+  802569:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80256f:	e9 01 ff ff ff       	jmp    802475 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802574:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802577:	85 db                	test   %ebx,%ebx
+  802579:	0f 45 c3             	cmovne %ebx,%eax
+  80257c:	e9 a6 fe ff ff       	jmp    802427 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802581:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802585:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80258c:	e9 f3 fe ff ff       	jmp    802484 <nsipc_sendmsg+0xc4>
+  802591:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802594:	eb 03                	jmp    802599 <nsipc_sendmsg+0x1d9>
+  802596:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802599:	83 ec 0c             	sub    $0xc,%esp
+  80259c:	68 20 60 80 00       	push   $0x806020
+  8025a1:	e8 d4 0d 00 00       	call   80337a <pgbatch_flush>
+  8025a6:	83 c4 10             	add    $0x10,%esp
+  8025a9:	85 c0                	test   %eax,%eax
+  8025ab:	78 50                	js     8025fd <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8025ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b0:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8025b5:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8025bb:	89 fb                	mov    %edi,%ebx
+  8025bd:	29 f3                	sub    %esi,%ebx
+  8025bf:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8025c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025c8:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8025cd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8025d2:	89 fa                	mov    %edi,%edx
+  8025d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8025d9:	e8 66 fb ff ff       	call   802144 <nsipc_bulk>
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 28                	js     80260a <nsipc_sendmsg+0x24a>
+		sent += r;
+  8025e2:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8025e5:	39 c3                	cmp    %eax,%ebx
+  8025e7:	75 0c                	jne    8025f5 <nsipc_sendmsg+0x235>
+  8025e9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025ec:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8025ef:	0f 8f f2 fd ff ff    	jg     8023e7 <nsipc_sendmsg+0x27>
+		sent += r;
+  8025f5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8025f8:	e9 2a fe ff ff       	jmp    802427 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8025fd:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802600:	85 db                	test   %ebx,%ebx
+  802602:	0f 45 c3             	cmovne %ebx,%eax
+  802605:	e9 1d fe ff ff       	jmp    802427 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80260a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80260d:	85 db                	test   %ebx,%ebx
+  80260f:	0f 45 c3             	cmovne %ebx,%eax
+  802612:	e9 10 fe ff ff       	jmp    802427 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802617:	83 ec 0c             	sub    $0xc,%esp
+  80261a:	68 20 60 80 00       	push   $0x806020
+  80261f:	e8 48 0d 00 00       	call   80336c <pgbatch_init>
+  802624:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802627:	be 00 00 00 00       	mov    $0x0,%esi
+  80262c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802631:	e9 63 ff ff ff       	jmp    802599 <nsipc_sendmsg+0x1d9>
+
+00802636 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802636:	55                   	push   %ebp
+  802637:	89 e5                	mov    %esp,%ebp
+  802639:	57                   	push   %edi
+  80263a:	56                   	push   %esi
+  80263b:	53                   	push   %ebx
+  80263c:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80263f:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802646:	0f 84 c8 00 00 00    	je     802714 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80264c:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802653:	0f 84 e4 00 00 00    	je     80273d <nsipc_sendfile+0x107>
+{
+  802659:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80265e:	89 fb                	mov    %edi,%ebx
+  802660:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802663:	0f 83 f0 00 00 00    	jae    802759 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802669:	89 fa                	mov    %edi,%edx
+  80266b:	03 55 10             	add    0x10(%ebp),%edx
+  80266e:	89 d0                	mov    %edx,%eax
+  802670:	c1 f8 1f             	sar    $0x1f,%eax
+  802673:	c1 e8 14             	shr    $0x14,%eax
+  802676:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802679:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80267f:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802681:	6a 10                	push   $0x10
+  802683:	68 00 20 01 e0       	push   $0xe0012000
+  802688:	52                   	push   %edx
+  802689:	ff 75 0c             	push   0xc(%ebp)
+  80268c:	e8 fe f4 ff ff       	call   801b8f <fmap>
+  802691:	83 c4 10             	add    $0x10,%esp
+  802694:	85 c0                	test   %eax,%eax
+  802696:	0f 8e b8 00 00 00    	jle    802754 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80269c:	39 c6                	cmp    %eax,%esi
+  80269e:	0f 8d b5 00 00 00    	jge    802759 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8026a4:	29 f0                	sub    %esi,%eax
+  8026a6:	8b 55 14             	mov    0x14(%ebp),%edx
+  8026a9:	29 da                	sub    %ebx,%edx
+  8026ab:	39 d0                	cmp    %edx,%eax
+  8026ad:	89 d3                	mov    %edx,%ebx
+  8026af:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8026b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b5:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8026ba:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8026c0:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8026c6:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026c9:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  8026d1:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8026d3:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8026da:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026dd:	83 c0 01             	add    $0x1,%eax
+  8026e0:	50                   	push   %eax
+  8026e1:	68 00 10 01 e0       	push   $0xe0011000
+  8026e6:	6a 11                	push   $0x11
+  8026e8:	ff 35 24 63 80 00    	push   0x806324
+  8026ee:	e8 ba 12 00 00       	call   8039ad <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8026f3:	83 c4 1c             	add    $0x1c,%esp
+  8026f6:	6a 00                	push   $0x0
+  8026f8:	6a 00                	push   $0x0
+  8026fa:	6a 00                	push   $0x0
+  8026fc:	e8 e8 0f 00 00       	call   8036e9 <ipc_recv>
+  802701:	83 c4 10             	add    $0x10,%esp
+  802704:	85 c0                	test   %eax,%eax
+  802706:	78 5b                	js     802763 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802708:	01 c7                	add    %eax,%edi
+		if (r < n)
+  80270a:	39 c3                	cmp    %eax,%ebx
+  80270c:	0f 8e 4c ff ff ff    	jle    80265e <nsipc_sendfile+0x28>
+  802712:	eb 45                	jmp    802759 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802714:	83 ec 04             	sub    $0x4,%esp
+  802717:	6a 07                	push   $0x7
+  802719:	68 00 10 01 e0       	push   $0xe0011000
+  80271e:	6a 00                	push   $0x0
+  802720:	e8 89 e7 ff ff       	call   800eae <sys_page_alloc>
+  802725:	89 c7                	mov    %eax,%edi
+  802727:	83 c4 10             	add    $0x10,%esp
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	78 2b                	js     802759 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80272e:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802735:	00 00 00 
+  802738:	e9 0f ff ff ff       	jmp    80264c <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80273d:	83 ec 0c             	sub    $0xc,%esp
+  802740:	6a 03                	push   $0x3
+  802742:	e8 9b 12 00 00       	call   8039e2 <ipc_find_env>
+  802747:	a3 24 63 80 00       	mov    %eax,0x806324
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	e9 05 ff ff ff       	jmp    802659 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802754:	85 ff                	test   %edi,%edi
+  802756:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802759:	89 f8                	mov    %edi,%eax
+  80275b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275e:	5b                   	pop    %ebx
+  80275f:	5e                   	pop    %esi
+  802760:	5f                   	pop    %edi
+  802761:	5d                   	pop    %ebp
+  802762:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802763:	85 ff                	test   %edi,%edi
+  802765:	0f 44 f8             	cmove  %eax,%edi
+  802768:	eb ef                	jmp    802759 <nsipc_sendfile+0x123>
+
+0080276a <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80276a:	55                   	push   %ebp
+  80276b:	89 e5                	mov    %esp,%ebp
+  80276d:	57                   	push   %edi
+  80276e:	56                   	push   %esi
+  80276f:	53                   	push   %ebx
+  802770:	83 ec 1c             	sub    $0x1c,%esp
+  802773:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802776:	e8 13 f9 ff ff       	call   80208e <nsbulk_map>
+  80277b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80277e:	85 c0                	test   %eax,%eax
+  802780:	0f 88 ba 00 00 00    	js     802840 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802786:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80278a:	0f 8e bb 00 00 00    	jle    80284b <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802790:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802795:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80279a:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80279f:	89 f8                	mov    %edi,%eax
+  8027a1:	29 f0                	sub    %esi,%eax
+  8027a3:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8027a7:	39 c8                	cmp    %ecx,%eax
+  8027a9:	0f 47 c1             	cmova  %ecx,%eax
+  8027ac:	01 f0                	add    %esi,%eax
+  8027ae:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8027b0:	83 c2 01             	add    $0x1,%edx
+  8027b3:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8027b6:	7e 07                	jle    8027bf <nsipc_recvmsg+0x55>
+  8027b8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8027bd:	7e e0                	jle    80279f <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8027bf:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8027c5:	c1 fa 0c             	sar    $0xc,%edx
+  8027c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027cd:	e8 0a f9 ff ff       	call   8020dc <nsbulk_own>
+  8027d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027d5:	85 c0                	test   %eax,%eax
+  8027d7:	78 67                	js     802840 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8027d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027dc:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8027e1:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8027e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027ea:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8027ef:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8027f4:	89 f2                	mov    %esi,%edx
+  8027f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8027fb:	e8 44 f9 ff ff       	call   802144 <nsipc_bulk>
+  802800:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802803:	85 c0                	test   %eax,%eax
+  802805:	78 39                	js     802840 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802807:	39 f0                	cmp    %esi,%eax
+  802809:	7f 4a                	jg     802855 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80280b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802810:	85 c0                	test   %eax,%eax
+  802812:	7e 2c                	jle    802840 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802814:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802817:	29 fe                	sub    %edi,%esi
+  802819:	8b 43 04             	mov    0x4(%ebx),%eax
+  80281c:	39 c6                	cmp    %eax,%esi
+  80281e:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802821:	83 ec 04             	sub    $0x4,%esp
+  802824:	56                   	push   %esi
+  802825:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80282b:	50                   	push   %eax
+  80282c:	ff 33                	push   (%ebx)
+  80282e:	e8 f7 e3 ff ff       	call   800c2a <memmove>
+		n += m;
+  802833:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802835:	83 c3 08             	add    $0x8,%ebx
+  802838:	83 c4 10             	add    $0x10,%esp
+  80283b:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80283e:	7f d4                	jg     802814 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802840:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802843:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802846:	5b                   	pop    %ebx
+  802847:	5e                   	pop    %esi
+  802848:	5f                   	pop    %edi
+  802849:	5d                   	pop    %ebp
+  80284a:	c3                   	ret
+	int r, i, n, len = 0;
+  80284b:	be 00 00 00 00       	mov    $0x0,%esi
+  802850:	e9 6a ff ff ff       	jmp    8027bf <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802855:	68 00 41 80 00       	push   $0x804100
+  80285a:	68 09 41 80 00       	push   $0x804109
+  80285f:	68 3b 01 00 00       	push   $0x13b
+  802864:	68 1e 41 80 00       	push   $0x80411e
+  802869:	e8 3a da ff ff       	call   8002a8 <_panic>
+
+0080286e <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80286e:	55                   	push   %ebp
+  80286f:	89 e5                	mov    %esp,%ebp
+  802871:	57                   	push   %edi
+  802872:	56                   	push   %esi
+  802873:	53                   	push   %ebx
+  802874:	83 ec 0c             	sub    $0xc,%esp
+  802877:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80287a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80287d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802880:	8b 45 08             	mov    0x8(%ebp),%eax
+  802883:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802888:	8b 07                	mov    (%edi),%eax
+  80288a:	a3 04 80 80 00       	mov    %eax,0x808004
+  80288f:	8b 47 04             	mov    0x4(%edi),%eax
+  802892:	a3 08 80 80 00       	mov    %eax,0x808008
+  802897:	8b 47 08             	mov    0x8(%edi),%eax
+  80289a:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  80289f:	8b 47 0c             	mov    0xc(%edi),%eax
+  8028a2:	a3 10 80 80 00       	mov    %eax,0x808010
+  8028a7:	8b 47 10             	mov    0x10(%edi),%eax
+  8028aa:	a3 14 80 80 00       	mov    %eax,0x808014
+  8028af:	8b 47 14             	mov    0x14(%edi),%eax
+  8028b2:	a3 18 80 80 00       	mov    %eax,0x808018
+  8028b7:	8b 47 18             	mov    0x18(%edi),%eax
+  8028ba:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8028bf:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8028c2:	a3 20 80 80 00       	mov    %eax,0x808020
+  8028c7:	8b 47 20             	mov    0x20(%edi),%eax
+  8028ca:	a3 24 80 80 00       	mov    %eax,0x808024
+  8028cf:	8b 47 24             	mov    0x24(%edi),%eax
+  8028d2:	a3 28 80 80 00       	mov    %eax,0x808028
+  8028d7:	8b 47 28             	mov    0x28(%edi),%eax
+  8028da:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8028df:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8028e2:	a3 30 80 80 00       	mov    %eax,0x808030
+  8028e7:	8b 47 30             	mov    0x30(%edi),%eax
+  8028ea:	a3 34 80 80 00       	mov    %eax,0x808034
+  8028ef:	8b 47 34             	mov    0x34(%edi),%eax
+  8028f2:	a3 38 80 80 00       	mov    %eax,0x808038
+  8028f7:	8b 47 38             	mov    0x38(%edi),%eax
+  8028fa:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8028ff:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802902:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802907:	8b 06                	mov    (%esi),%eax
+  802909:	a3 44 80 80 00       	mov    %eax,0x808044
+  80290e:	8b 46 04             	mov    0x4(%esi),%eax
+  802911:	a3 48 80 80 00       	mov    %eax,0x808048
+  802916:	8b 46 08             	mov    0x8(%esi),%eax
+  802919:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  80291e:	8b 46 0c             	mov    0xc(%esi),%eax
+  802921:	a3 50 80 80 00       	mov    %eax,0x808050
+  802926:	8b 46 10             	mov    0x10(%esi),%eax
+  802929:	a3 54 80 80 00       	mov    %eax,0x808054
+  80292e:	8b 46 14             	mov    0x14(%esi),%eax
+  802931:	a3 58 80 80 00       	mov    %eax,0x808058
+  802936:	8b 46 18             	mov    0x18(%esi),%eax
+  802939:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  80293e:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802941:	a3 60 80 80 00       	mov    %eax,0x808060
+  802946:	8b 46 20             	mov    0x20(%esi),%eax
+  802949:	a3 64 80 80 00       	mov    %eax,0x808064
+  80294e:	8b 46 24             	mov    0x24(%esi),%eax
+  802951:	a3 68 80 80 00       	mov    %eax,0x808068
+  802956:	8b 46 28             	mov    0x28(%esi),%eax
+  802959:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  80295e:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802961:	a3 70 80 80 00       	mov    %eax,0x808070
+  802966:	8b 46 30             	mov    0x30(%esi),%eax
+  802969:	a3 74 80 80 00       	mov    %eax,0x808074
+  80296e:	8b 46 34             	mov    0x34(%esi),%eax
+  802971:	a3 78 80 80 00       	mov    %eax,0x808078
+  802976:	8b 46 38             	mov    0x38(%esi),%eax
+  802979:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  80297e:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802981:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802986:	8b 03                	mov    (%ebx),%eax
+  802988:	a3 84 80 80 00       	mov    %eax,0x808084
+  80298d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802990:	a3 88 80 80 00       	mov    %eax,0x808088
+  802995:	8b 43 08             	mov    0x8(%ebx),%eax
+  802998:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  80299d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8029a0:	a3 90 80 80 00       	mov    %eax,0x808090
+  8029a5:	8b 43 10             	mov    0x10(%ebx),%eax
+  8029a8:	a3 94 80 80 00       	mov    %eax,0x808094
+  8029ad:	8b 43 14             	mov    0x14(%ebx),%eax
+  8029b0:	a3 98 80 80 00       	mov    %eax,0x808098
+  8029b5:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029b8:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8029bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8029c0:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8029c5:	8b 43 20             	mov    0x20(%ebx),%eax
+  8029c8:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8029cd:	8b 43 24             	mov    0x24(%ebx),%eax
+  8029d0:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8029d5:	8b 43 28             	mov    0x28(%ebx),%eax
+  8029d8:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8029dd:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8029e0:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8029e5:	8b 43 30             	mov    0x30(%ebx),%eax
+  8029e8:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8029ed:	8b 43 34             	mov    0x34(%ebx),%eax
+  8029f0:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8029f5:	8b 43 38             	mov    0x38(%ebx),%eax
+  8029f8:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8029fd:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802a00:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802a05:	8b 45 18             	mov    0x18(%ebp),%eax
+  802a08:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802a0d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802a12:	e8 2b f6 ff ff       	call   802042 <nsipc>
+  802a17:	85 c0                	test   %eax,%eax
+  802a19:	0f 88 ad 01 00 00    	js     802bcc <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802a1f:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802a25:	89 17                	mov    %edx,(%edi)
+  802a27:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802a2d:	89 57 04             	mov    %edx,0x4(%edi)
+  802a30:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802a36:	89 57 08             	mov    %edx,0x8(%edi)
+  802a39:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a3f:	89 57 0c             	mov    %edx,0xc(%edi)
+  802a42:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802a48:	89 57 10             	mov    %edx,0x10(%edi)
+  802a4b:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802a51:	89 57 14             	mov    %edx,0x14(%edi)
+  802a54:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802a5a:	89 57 18             	mov    %edx,0x18(%edi)
+  802a5d:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802a63:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802a66:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802a6c:	89 57 20             	mov    %edx,0x20(%edi)
+  802a6f:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802a75:	89 57 24             	mov    %edx,0x24(%edi)
+  802a78:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802a7e:	89 57 28             	mov    %edx,0x28(%edi)
+  802a81:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802a87:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802a8a:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802a90:	89 57 30             	mov    %edx,0x30(%edi)
+  802a93:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802a99:	89 57 34             	mov    %edx,0x34(%edi)
+  802a9c:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802aa2:	89 57 38             	mov    %edx,0x38(%edi)
+  802aa5:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802aab:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802aae:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802ab4:	89 16                	mov    %edx,(%esi)
+  802ab6:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802abc:	89 56 04             	mov    %edx,0x4(%esi)
+  802abf:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802ac5:	89 56 08             	mov    %edx,0x8(%esi)
+  802ac8:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802ace:	89 56 0c             	mov    %edx,0xc(%esi)
+  802ad1:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802ad7:	89 56 10             	mov    %edx,0x10(%esi)
+  802ada:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802ae0:	89 56 14             	mov    %edx,0x14(%esi)
+  802ae3:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802ae9:	89 56 18             	mov    %edx,0x18(%esi)
+  802aec:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802af2:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802af5:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802afb:	89 56 20             	mov    %edx,0x20(%esi)
+  802afe:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802b04:	89 56 24             	mov    %edx,0x24(%esi)
+  802b07:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802b0d:	89 56 28             	mov    %edx,0x28(%esi)
+  802b10:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802b16:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802b19:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802b1f:	89 56 30             	mov    %edx,0x30(%esi)
+  802b22:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802b28:	89 56 34             	mov    %edx,0x34(%esi)
+  802b2b:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802b31:	89 56 38             	mov    %edx,0x38(%esi)
+  802b34:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802b3a:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802b3d:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802b43:	89 13                	mov    %edx,(%ebx)
+  802b45:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802b4b:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b4e:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802b54:	89 53 08             	mov    %edx,0x8(%ebx)
+  802b57:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802b5d:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802b60:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802b66:	89 53 10             	mov    %edx,0x10(%ebx)
+  802b69:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802b6f:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b72:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802b78:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b7b:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802b81:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b84:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802b8a:	89 53 20             	mov    %edx,0x20(%ebx)
+  802b8d:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802b93:	89 53 24             	mov    %edx,0x24(%ebx)
+  802b96:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802b9c:	89 53 28             	mov    %edx,0x28(%ebx)
+  802b9f:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802ba5:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802ba8:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802bae:	89 53 30             	mov    %edx,0x30(%ebx)
+  802bb1:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802bb7:	89 53 34             	mov    %edx,0x34(%ebx)
+  802bba:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802bc0:	89 53 38             	mov    %edx,0x38(%ebx)
+  802bc3:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802bc9:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802bcc:	83 c4 0c             	add    $0xc,%esp
+  802bcf:	5b                   	pop    %ebx
+  802bd0:	5e                   	pop    %esi
+  802bd1:	5f                   	pop    %edi
+  802bd2:	5d                   	pop    %ebp
+  802bd3:	c3                   	ret
+
+00802bd4 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802bd4:	55                   	push   %ebp
+  802bd5:	89 e5                	mov    %esp,%ebp
+  802bd7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802be2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802be5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802bea:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bed:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802bf2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802bf7:	e8 46 f4 ff ff       	call   802042 <nsipc>
+}
+  802bfc:	c9                   	leave
+  802bfd:	c3                   	ret
+
+00802bfe <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802bfe:	55                   	push   %ebp
+  802bff:	89 e5                	mov    %esp,%ebp
+  802c01:	56                   	push   %esi
+  802c02:	53                   	push   %ebx
+  802c03:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802c06:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802c0c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c0f:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802c14:	b8 10 00 00 00       	mov    $0x10,%eax
+  802c19:	e8 24 f4 ff ff       	call   802042 <nsipc>
+  802c1e:	89 c3                	mov    %eax,%ebx
+  802c20:	85 c0                	test   %eax,%eax
+  802c22:	7e 1f                	jle    802c43 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802c24:	39 c6                	cmp    %eax,%esi
+  802c26:	7c 24                	jl     802c4c <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802c28:	83 ec 04             	sub    $0x4,%esp
+  802c2b:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802c32:	50                   	push   %eax
+  802c33:	68 00 80 80 00       	push   $0x808000
+  802c38:	ff 75 08             	push   0x8(%ebp)
+  802c3b:	e8 ea df ff ff       	call   800c2a <memmove>
+  802c40:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802c43:	89 d8                	mov    %ebx,%eax
+  802c45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c48:	5b                   	pop    %ebx
+  802c49:	5e                   	pop    %esi
+  802c4a:	5d                   	pop    %ebp
+  802c4b:	c3                   	ret
+		assert(r <= max);
+  802c4c:	68 36 41 80 00       	push   $0x804136
+  802c51:	68 09 41 80 00       	push   $0x804109
+  802c56:	68 6a 01 00 00       	push   $0x16a
+  802c5b:	68 1e 41 80 00       	push   $0x80411e
+  802c60:	e8 43 d6 ff ff       	call   8002a8 <_panic>
+
+00802c65 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c65:	55                   	push   %ebp
+  802c66:	89 e5                	mov    %esp,%ebp
+  802c68:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802c73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c76:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c7b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c7e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802c83:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c88:	e8 b5 f3 ff ff       	call   802042 <nsipc>
+}
+  802c8d:	c9                   	leave
+  802c8e:	c3                   	ret
+
+00802c8f <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802c8f:	55                   	push   %ebp
+  802c90:	89 e5                	mov    %esp,%ebp
+  802c92:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c98:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802c9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ca2:	e8 9b f3 ff ff       	call   802042 <nsipc>
+}
+  802ca7:	c9                   	leave
+  802ca8:	c3                   	ret
+
+00802ca9 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802ca9:	55                   	push   %ebp
+  802caa:	89 e5                	mov    %esp,%ebp
+  802cac:	53                   	push   %ebx
+  802cad:	83 ec 04             	sub    $0x4,%esp
+  802cb0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802cb3:	b8 12 00 00 00       	mov    $0x12,%eax
+  802cb8:	e8 85 f3 ff ff       	call   802042 <nsipc>
+  802cbd:	85 c0                	test   %eax,%eax
+  802cbf:	78 50                	js     802d11 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802cc1:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802cc7:	89 13                	mov    %edx,(%ebx)
+  802cc9:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802ccf:	89 53 04             	mov    %edx,0x4(%ebx)
+  802cd2:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802cd8:	89 53 08             	mov    %edx,0x8(%ebx)
+  802cdb:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802ce1:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802ce4:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802cea:	89 53 10             	mov    %edx,0x10(%ebx)
+  802ced:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802cf3:	89 53 14             	mov    %edx,0x14(%ebx)
+  802cf6:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802cfc:	89 53 18             	mov    %edx,0x18(%ebx)
+  802cff:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802d05:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802d08:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802d0e:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d14:	c9                   	leave
+  802d15:	c3                   	ret
+
+00802d16 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802d16:	55                   	push   %ebp
+  802d17:	89 e5                	mov    %esp,%ebp
+  802d19:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d1c:	6a 03                	push   $0x3
+  802d1e:	e8 bf 0c 00 00       	call   8039e2 <ipc_find_env>
+  802d23:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802d28:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2b:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802d30:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802d35:	e8 08 f3 ff ff       	call   802042 <nsipc>
+  802d3a:	83 c4 10             	add    $0x10,%esp
+  802d3d:	85 c0                	test   %eax,%eax
+  802d3f:	78 0a                	js     802d4b <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802d41:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802d46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d4b:	c9                   	leave
+  802d4c:	c3                   	ret
+
+00802d4d <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802d4d:	55                   	push   %ebp
+  802d4e:	89 e5                	mov    %esp,%ebp
+  802d50:	57                   	push   %edi
+  802d51:	56                   	push   %esi
+  802d52:	53                   	push   %ebx
+  802d53:	83 ec 1c             	sub    $0x1c,%esp
+  802d56:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802d59:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802d5c:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802d61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d66:	89 e0                	mov    %esp,%eax
+  802d68:	89 f2                	mov    %esi,%edx
+  802d6a:	29 c2                	sub    %eax,%edx
+  802d6c:	89 d0                	mov    %edx,%eax
+  802d6e:	c1 e8 0f             	shr    $0xf,%eax
+  802d71:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802d77:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802d7a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802d81:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802d84:	83 ec 0c             	sub    $0xc,%esp
+  802d87:	ff 75 e0             	push   -0x20(%ebp)
+  802d8a:	e8 92 0c 00 00       	call   803a21 <pageref>
+  802d8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d92:	83 c4 04             	add    $0x4,%esp
+  802d95:	ff 75 dc             	push   -0x24(%ebp)
+  802d98:	e8 84 0c 00 00       	call   803a21 <pageref>
+  802d9d:	89 e2                	mov    %esp,%edx
+  802d9f:	89 f1                	mov    %esi,%ecx
+  802da1:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802da3:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802da6:	89 ca                	mov    %ecx,%edx
+  802da8:	c1 ea 0f             	shr    $0xf,%edx
+  802dab:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802db1:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802db4:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802dbb:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802dbe:	39 d7                	cmp    %edx,%edi
+  802dc0:	74 40                	je     802e02 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802dc2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802dc5:	75 9f                	jne    802d66 <_pipeisclosed+0x19>
+  802dc7:	89 e2                	mov    %esp,%edx
+  802dc9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802dce:	29 d0                	sub    %edx,%eax
+  802dd0:	89 c2                	mov    %eax,%edx
+  802dd2:	c1 ea 0f             	shr    $0xf,%edx
+  802dd5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddf:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802de2:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802de9:	8b 40 58             	mov    0x58(%eax),%eax
+  802dec:	6a 01                	push   $0x1
+  802dee:	50                   	push   %eax
+  802def:	57                   	push   %edi
+  802df0:	68 3f 41 80 00       	push   $0x80413f
+  802df5:	e8 89 d5 ff ff       	call   800383 <cprintf>
+  802dfa:	83 c4 10             	add    $0x10,%esp
+  802dfd:	e9 5f ff ff ff       	jmp    802d61 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802e02:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e05:	0f 94 c0             	sete   %al
+  802e08:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802e0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e0e:	5b                   	pop    %ebx
+  802e0f:	5e                   	pop    %esi
+  802e10:	5f                   	pop    %edi
+  802e11:	5d                   	pop    %ebp
+  802e12:	c3                   	ret
+
+00802e13 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e13:	55                   	push   %ebp
+  802e14:	89 e5                	mov    %esp,%ebp
+  802e16:	53                   	push   %ebx
+  802e17:	83 ec 0c             	sub    $0xc,%esp
+  802e1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e1d:	53                   	push   %ebx
+  802e1e:	6a 00                	push   $0x0
+  802e20:	e8 0e e1 ff ff       	call   800f33 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e25:	89 1c 24             	mov    %ebx,(%esp)
+  802e28:	e8 f4 e4 ff ff       	call   801321 <fd2data>
+  802e2d:	83 c4 08             	add    $0x8,%esp
+  802e30:	50                   	push   %eax
+  802e31:	6a 00                	push   $0x0
+  802e33:	e8 fb e0 ff ff       	call   800f33 <sys_page_unmap>
+}
+  802e38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e3b:	c9                   	leave
+  802e3c:	c3                   	ret
+
+00802e3d <devpipe_read>:
+{
+  802e3d:	55                   	push   %ebp
+  802e3e:	89 e5                	mov    %esp,%ebp
+  802e40:	57                   	push   %edi
+  802e41:	56                   	push   %esi
+  802e42:	53                   	push   %ebx
+  802e43:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802e46:	ff 75 08             	push   0x8(%ebp)
+  802e49:	e8 d3 e4 ff ff       	call   801321 <fd2data>
+  802e4e:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e50:	8b 70 04             	mov    0x4(%eax),%esi
+  802e53:	8b 00                	mov    (%eax),%eax
+  802e55:	83 c4 10             	add    $0x10,%esp
+  802e58:	39 f0                	cmp    %esi,%eax
+  802e5a:	75 36                	jne    802e92 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802e5c:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802e5f:	89 da                	mov    %ebx,%edx
+  802e61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e64:	e8 e4 fe ff ff       	call   802d4d <_pipeisclosed>
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	0f 85 d4 00 00 00    	jne    802f45 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802e71:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e76:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802e7a:	83 ec 04             	sub    $0x4,%esp
+  802e7d:	6a ff                	push   $0xffffffff
+  802e7f:	56                   	push   %esi
+  802e80:	57                   	push   %edi
+  802e81:	e8 26 e4 ff ff       	call   8012ac <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e86:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e89:	8b 03                	mov    (%ebx),%eax
+  802e8b:	83 c4 10             	add    $0x10,%esp
+  802e8e:	39 c6                	cmp    %eax,%esi
+  802e90:	74 cd                	je     802e5f <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e92:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e95:	8b 03                	mov    (%ebx),%eax
+  802e97:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802e9d:	29 c6                	sub    %eax,%esi
+  802e9f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ea4:	f7 e6                	mul    %esi
+  802ea6:	c1 ea 0c             	shr    $0xc,%edx
+  802ea9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802eaf:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802eb1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802eb4:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802eb8:	8b 0b                	mov    (%ebx),%ecx
+  802eba:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ebf:	f7 e1                	mul    %ecx
+  802ec1:	c1 ea 0b             	shr    $0xb,%edx
+  802ec4:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802eca:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802ecc:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802ed1:	29 cf                	sub    %ecx,%edi
+  802ed3:	39 f7                	cmp    %esi,%edi
+  802ed5:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802ed8:	83 ec 04             	sub    $0x4,%esp
+  802edb:	57                   	push   %edi
+  802edc:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802ee0:	50                   	push   %eax
+  802ee1:	ff 75 0c             	push   0xc(%ebp)
+  802ee4:	e8 41 dd ff ff       	call   800c2a <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802ee9:	83 c4 0c             	add    $0xc,%esp
+  802eec:	89 f0                	mov    %esi,%eax
+  802eee:	29 f8                	sub    %edi,%eax
+  802ef0:	50                   	push   %eax
+  802ef1:	8d 43 10             	lea    0x10(%ebx),%eax
+  802ef4:	50                   	push   %eax
+  802ef5:	89 f8                	mov    %edi,%eax
+  802ef7:	03 45 0c             	add    0xc(%ebp),%eax
+  802efa:	50                   	push   %eax
+  802efb:	e8 2a dd ff ff       	call   800c2a <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802f00:	8b 0b                	mov    (%ebx),%ecx
+  802f02:	01 f1                	add    %esi,%ecx
+  802f04:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f09:	f7 e1                	mul    %ecx
+  802f0b:	c1 ea 0c             	shr    $0xc,%edx
+  802f0e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f14:	29 c1                	sub    %eax,%ecx
+  802f16:	89 0b                	mov    %ecx,(%ebx)
+  802f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1d:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802f21:	83 c4 10             	add    $0x10,%esp
+  802f24:	85 c0                	test   %eax,%eax
+  802f26:	75 0a                	jne    802f32 <devpipe_read+0xf5>
+	return n;
+  802f28:	89 f0                	mov    %esi,%eax
+}
+  802f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f2d:	5b                   	pop    %ebx
+  802f2e:	5e                   	pop    %esi
+  802f2f:	5f                   	pop    %edi
+  802f30:	5d                   	pop    %ebp
+  802f31:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802f32:	83 ec 08             	sub    $0x8,%esp
+  802f35:	68 00 04 00 00       	push   $0x400
+  802f3a:	53                   	push   %ebx
+  802f3b:	e8 8e e3 ff ff       	call   8012ce <sys_futex_wake>
+  802f40:	83 c4 10             	add    $0x10,%esp
+  802f43:	eb e3                	jmp    802f28 <devpipe_read+0xeb>
+			return 0;
+  802f45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4a:	eb de                	jmp    802f2a <devpipe_read+0xed>
+
+00802f4c <devpipe_write>:
+{
+  802f4c:	55                   	push   %ebp
+  802f4d:	89 e5                	mov    %esp,%ebp
+  802f4f:	57                   	push   %edi
+  802f50:	56                   	push   %esi
+  802f51:	53                   	push   %ebx
+  802f52:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f55:	ff 75 08             	push   0x8(%ebp)
+  802f58:	e8 c4 e3 ff ff       	call   801321 <fd2data>
+  802f5d:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802f5f:	83 c4 10             	add    $0x10,%esp
+  802f62:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f69:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802f6e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f72:	0f 84 43 01 00 00    	je     8030bb <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f78:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f7b:	8b 06                	mov    (%esi),%eax
+  802f7d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f83:	29 c1                	sub    %eax,%ecx
+  802f85:	89 c8                	mov    %ecx,%eax
+  802f87:	f7 e7                	mul    %edi
+  802f89:	c1 ea 0c             	shr    $0xc,%edx
+  802f8c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f92:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802f94:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802f9a:	75 52                	jne    802fee <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802f9c:	89 f2                	mov    %esi,%edx
+  802f9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa1:	e8 a7 fd ff ff       	call   802d4d <_pipeisclosed>
+  802fa6:	85 c0                	test   %eax,%eax
+  802fa8:	0f 85 28 01 00 00    	jne    8030d6 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802fae:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fb0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fb3:	8b 06                	mov    (%esi),%eax
+  802fb5:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fbb:	29 c1                	sub    %eax,%ecx
+  802fbd:	89 c8                	mov    %ecx,%eax
+  802fbf:	f7 e7                	mul    %edi
+  802fc1:	c1 ea 0c             	shr    $0xc,%edx
+  802fc4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fca:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802fcc:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802fd2:	75 a4                	jne    802f78 <devpipe_write+0x2c>
+  802fd4:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fd9:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802fdd:	83 ec 04             	sub    $0x4,%esp
+  802fe0:	6a ff                	push   $0xffffffff
+  802fe2:	53                   	push   %ebx
+  802fe3:	56                   	push   %esi
+  802fe4:	e8 c3 e2 ff ff       	call   8012ac <sys_futex_wait>
+}
+  802fe9:	83 c4 10             	add    $0x10,%esp
+  802fec:	eb 8a                	jmp    802f78 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fee:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ff1:	8b 06                	mov    (%esi),%eax
+  802ff3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802ff9:	29 c1                	sub    %eax,%ecx
+  802ffb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803000:	f7 e1                	mul    %ecx
+  803002:	c1 ea 0c             	shr    $0xc,%edx
+  803005:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80300b:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80300d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803012:	89 d8                	mov    %ebx,%eax
+  803014:	29 c8                	sub    %ecx,%eax
+  803016:	8b 55 10             	mov    0x10(%ebp),%edx
+  803019:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80301c:	29 ca                	sub    %ecx,%edx
+  80301e:	39 d0                	cmp    %edx,%eax
+  803020:	0f 46 d0             	cmovbe %eax,%edx
+  803023:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803026:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803029:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80302e:	f7 e1                	mul    %ecx
+  803030:	c1 ea 0b             	shr    $0xb,%edx
+  803033:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803039:	89 ca                	mov    %ecx,%edx
+  80303b:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80303d:	29 d3                	sub    %edx,%ebx
+  80303f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803042:	39 c3                	cmp    %eax,%ebx
+  803044:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803047:	83 ec 04             	sub    $0x4,%esp
+  80304a:	53                   	push   %ebx
+  80304b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80304e:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803051:	51                   	push   %ecx
+  803052:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803056:	50                   	push   %eax
+  803057:	e8 ce db ff ff       	call   800c2a <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80305c:	83 c4 0c             	add    $0xc,%esp
+  80305f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803062:	29 d8                	sub    %ebx,%eax
+  803064:	50                   	push   %eax
+  803065:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803068:	01 cb                	add    %ecx,%ebx
+  80306a:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80306d:	53                   	push   %ebx
+  80306e:	8d 46 10             	lea    0x10(%esi),%eax
+  803071:	50                   	push   %eax
+  803072:	e8 b3 db ff ff       	call   800c2a <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803077:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80307a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80307d:	01 c1                	add    %eax,%ecx
+  80307f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803084:	f7 e1                	mul    %ecx
+  803086:	c1 ea 0c             	shr    $0xc,%edx
+  803089:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80308f:	89 ca                	mov    %ecx,%edx
+  803091:	29 c2                	sub    %eax,%edx
+  803093:	89 56 04             	mov    %edx,0x4(%esi)
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309b:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80309f:	83 c4 10             	add    $0x10,%esp
+  8030a2:	85 c0                	test   %eax,%eax
+  8030a4:	75 1a                	jne    8030c0 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8030a6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8030a9:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8030ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030af:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8030b2:	0f 82 c0 fe ff ff    	jb     802f78 <devpipe_write+0x2c>
+  8030b8:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8030bb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030be:	eb 1b                	jmp    8030db <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8030c0:	83 ec 08             	sub    $0x8,%esp
+  8030c3:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8030c8:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8030cb:	50                   	push   %eax
+  8030cc:	e8 fd e1 ff ff       	call   8012ce <sys_futex_wake>
+  8030d1:	83 c4 10             	add    $0x10,%esp
+  8030d4:	eb d0                	jmp    8030a6 <devpipe_write+0x15a>
+				return 0;
+  8030d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030de:	5b                   	pop    %ebx
+  8030df:	5e                   	pop    %esi
+  8030e0:	5f                   	pop    %edi
+  8030e1:	5d                   	pop    %ebp
+  8030e2:	c3                   	ret
+
+008030e3 <devpipe_stat>:
+{
+  8030e3:	55                   	push   %ebp
+  8030e4:	89 e5                	mov    %esp,%ebp
+  8030e6:	56                   	push   %esi
+  8030e7:	53                   	push   %ebx
+  8030e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8030eb:	83 ec 0c             	sub    $0xc,%esp
+  8030ee:	ff 75 08             	push   0x8(%ebp)
+  8030f1:	e8 2b e2 ff ff       	call   801321 <fd2data>
+  8030f6:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8030f8:	83 c4 08             	add    $0x8,%esp
+  8030fb:	68 52 41 80 00       	push   $0x804152
+  803100:	53                   	push   %ebx
+  803101:	e8 74 d9 ff ff       	call   800a7a <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803106:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803109:	8b 06                	mov    (%esi),%eax
+  80310b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803111:	29 c1                	sub    %eax,%ecx
+  803113:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803118:	89 c8                	mov    %ecx,%eax
+  80311a:	f7 e2                	mul    %edx
+  80311c:	c1 ea 0c             	shr    $0xc,%edx
+  80311f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803125:	29 d1                	sub    %edx,%ecx
+  803127:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80312d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803134:	00 00 00 
+	stat->st_dev = &devpipe;
+  803137:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80313e:	50 80 00 
+}
+  803141:	b8 00 00 00 00       	mov    $0x0,%eax
+  803146:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803149:	5b                   	pop    %ebx
+  80314a:	5e                   	pop    %esi
+  80314b:	5d                   	pop    %ebp
+  80314c:	c3                   	ret
+
+0080314d <devpipe_poll>:
+{
+  80314d:	55                   	push   %ebp
+  80314e:	89 e5                	mov    %esp,%ebp
+  803150:	57                   	push   %edi
+  803151:	56                   	push   %esi
+  803152:	53                   	push   %ebx
+  803153:	83 ec 18             	sub    $0x18,%esp
+  803156:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803159:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80315c:	57                   	push   %edi
+  80315d:	e8 bf e1 ff ff       	call   801321 <fd2data>
+  803162:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803164:	83 c4 10             	add    $0x10,%esp
+  803167:	89 f3                	mov    %esi,%ebx
+  803169:	83 e3 01             	and    $0x1,%ebx
+  80316c:	75 27                	jne    803195 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80316e:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803174:	75 48                	jne    8031be <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803176:	89 ca                	mov    %ecx,%edx
+  803178:	89 f8                	mov    %edi,%eax
+  80317a:	e8 ce fb ff ff       	call   802d4d <_pipeisclosed>
+  80317f:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803181:	89 d8                	mov    %ebx,%eax
+  803183:	83 c8 10             	or     $0x10,%eax
+  803186:	85 d2                	test   %edx,%edx
+  803188:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80318b:	89 d8                	mov    %ebx,%eax
+  80318d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803190:	5b                   	pop    %ebx
+  803191:	5e                   	pop    %esi
+  803192:	5f                   	pop    %edi
+  803193:	5d                   	pop    %ebp
+  803194:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803195:	8b 58 04             	mov    0x4(%eax),%ebx
+  803198:	8b 00                	mov    (%eax),%eax
+  80319a:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8031a0:	29 c3                	sub    %eax,%ebx
+  8031a2:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031a7:	89 d8                	mov    %ebx,%eax
+  8031a9:	f7 e2                	mul    %edx
+  8031ab:	c1 ea 0c             	shr    $0xc,%edx
+  8031ae:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8031b4:	39 d3                	cmp    %edx,%ebx
+  8031b6:	0f 95 c3             	setne  %bl
+  8031b9:	0f b6 db             	movzbl %bl,%ebx
+  8031bc:	eb b0                	jmp    80316e <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031be:	8b 71 04             	mov    0x4(%ecx),%esi
+  8031c1:	8b 01                	mov    (%ecx),%eax
+  8031c3:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8031c9:	29 c6                	sub    %eax,%esi
+  8031cb:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031d0:	89 f0                	mov    %esi,%eax
+  8031d2:	f7 e2                	mul    %edx
+  8031d4:	c1 ea 0c             	shr    $0xc,%edx
+  8031d7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031dd:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8031df:	89 d8                	mov    %ebx,%eax
+  8031e1:	83 c8 04             	or     $0x4,%eax
+  8031e4:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8031ea:	0f 42 d8             	cmovb  %eax,%ebx
+  8031ed:	eb 87                	jmp    803176 <devpipe_poll+0x29>
+
+008031ef <pipe>:
+{
+  8031ef:	55                   	push   %ebp
+  8031f0:	89 e5                	mov    %esp,%ebp
+  8031f2:	56                   	push   %esi
+  8031f3:	53                   	push   %ebx
+  8031f4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031fa:	50                   	push   %eax
+  8031fb:	e8 38 e1 ff ff       	call   801338 <fd_alloc>
+  803200:	89 c3                	mov    %eax,%ebx
+  803202:	83 c4 10             	add    $0x10,%esp
+  803205:	85 c0                	test   %eax,%eax
+  803207:	0f 88 23 01 00 00    	js     803330 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80320d:	83 ec 04             	sub    $0x4,%esp
+  803210:	68 07 04 00 00       	push   $0x407
+  803215:	ff 75 f4             	push   -0xc(%ebp)
+  803218:	6a 00                	push   $0x0
+  80321a:	e8 8f dc ff ff       	call   800eae <sys_page_alloc>
+  80321f:	89 c3                	mov    %eax,%ebx
+  803221:	83 c4 10             	add    $0x10,%esp
+  803224:	85 c0                	test   %eax,%eax
+  803226:	0f 88 04 01 00 00    	js     803330 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80322c:	83 ec 0c             	sub    $0xc,%esp
+  80322f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803232:	50                   	push   %eax
+  803233:	e8 00 e1 ff ff       	call   801338 <fd_alloc>
+  803238:	89 c3                	mov    %eax,%ebx
+  80323a:	83 c4 10             	add    $0x10,%esp
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	0f 88 db 00 00 00    	js     803320 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803245:	83 ec 04             	sub    $0x4,%esp
+  803248:	68 07 04 00 00       	push   $0x407
+  80324d:	ff 75 f0             	push   -0x10(%ebp)
+  803250:	6a 00                	push   $0x0
+  803252:	e8 57 dc ff ff       	call   800eae <sys_page_alloc>
+  803257:	89 c3                	mov    %eax,%ebx
+  803259:	83 c4 10             	add    $0x10,%esp
+  80325c:	85 c0                	test   %eax,%eax
+  80325e:	0f 88 bc 00 00 00    	js     803320 <pipe+0x131>
+	va = fd2data(fd0);
+  803264:	83 ec 0c             	sub    $0xc,%esp
+  803267:	ff 75 f4             	push   -0xc(%ebp)
+  80326a:	e8 b2 e0 ff ff       	call   801321 <fd2data>
+  80326f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803271:	83 c4 0c             	add    $0xc,%esp
+  803274:	68 07 04 00 00       	push   $0x407
+  803279:	50                   	push   %eax
+  80327a:	6a 00                	push   $0x0
+  80327c:	e8 2d dc ff ff       	call   800eae <sys_page_alloc>
+  803281:	89 c3                	mov    %eax,%ebx
+  803283:	83 c4 10             	add    $0x10,%esp
+  803286:	85 c0                	test   %eax,%eax
+  803288:	0f 88 82 00 00 00    	js     803310 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80328e:	83 ec 0c             	sub    $0xc,%esp
+  803291:	ff 75 f0             	push   -0x10(%ebp)
+  803294:	e8 88 e0 ff ff       	call   801321 <fd2data>
+  803299:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8032a0:	50                   	push   %eax
+  8032a1:	6a 00                	push   $0x0
+  8032a3:	56                   	push   %esi
+  8032a4:	6a 00                	push   $0x0
+  8032a6:	e8 46 dc ff ff       	call   800ef1 <sys_page_map>
+  8032ab:	89 c3                	mov    %eax,%ebx
+  8032ad:	83 c4 20             	add    $0x20,%esp
+  8032b0:	85 c0                	test   %eax,%eax
+  8032b2:	78 4e                	js     803302 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032b4:	a1 60 50 80 00       	mov    0x805060,%eax
+  8032b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032bc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032c1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032c8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032cb:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8032cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032d0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032d7:	83 ec 0c             	sub    $0xc,%esp
+  8032da:	ff 75 f4             	push   -0xc(%ebp)
+  8032dd:	e8 2f e0 ff ff       	call   801311 <fd2num>
+  8032e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032e5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032e7:	83 c4 04             	add    $0x4,%esp
+  8032ea:	ff 75 f0             	push   -0x10(%ebp)
+  8032ed:	e8 1f e0 ff ff       	call   801311 <fd2num>
+  8032f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032f5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032f8:	83 c4 10             	add    $0x10,%esp
+  8032fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803300:	eb 2e                	jmp    803330 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803302:	83 ec 08             	sub    $0x8,%esp
+  803305:	56                   	push   %esi
+  803306:	6a 00                	push   $0x0
+  803308:	e8 26 dc ff ff       	call   800f33 <sys_page_unmap>
+  80330d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803310:	83 ec 08             	sub    $0x8,%esp
+  803313:	ff 75 f0             	push   -0x10(%ebp)
+  803316:	6a 00                	push   $0x0
+  803318:	e8 16 dc ff ff       	call   800f33 <sys_page_unmap>
+  80331d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803320:	83 ec 08             	sub    $0x8,%esp
+  803323:	ff 75 f4             	push   -0xc(%ebp)
+  803326:	6a 00                	push   $0x0
+  803328:	e8 06 dc ff ff       	call   800f33 <sys_page_unmap>
+  80332d:	83 c4 10             	add    $0x10,%esp
+}
+  803330:	89 d8                	mov    %ebx,%eax
+  803332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803335:	5b                   	pop    %ebx
+  803336:	5e                   	pop    %esi
+  803337:	5d                   	pop    %ebp
+  803338:	c3                   	ret
+
+00803339 <pipeisclosed>:
+{
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80333f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803342:	50                   	push   %eax
+  803343:	ff 75 08             	push   0x8(%ebp)
+  803346:	e8 3d e0 ff ff       	call   801388 <fd_lookup>
+  80334b:	83 c4 10             	add    $0x10,%esp
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	78 18                	js     80336a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803352:	83 ec 0c             	sub    $0xc,%esp
+  803355:	ff 75 f4             	push   -0xc(%ebp)
+  803358:	e8 c4 df ff ff       	call   801321 <fd2data>
+  80335d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80335f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803362:	e8 e6 f9 ff ff       	call   802d4d <_pipeisclosed>
+  803367:	83 c4 10             	add    $0x10,%esp
+}
+  80336a:	c9                   	leave
+  80336b:	c3                   	ret
+
+0080336c <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80336c:	55                   	push   %ebp
+  80336d:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80336f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803372:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803378:	5d                   	pop    %ebp
+  803379:	c3                   	ret
+
+0080337a <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	53                   	push   %ebx
+  80337e:	83 ec 04             	sub    $0x4,%esp
+  803381:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803384:	8b 03                	mov    (%ebx),%eax
+  803386:	85 c0                	test   %eax,%eax
+  803388:	75 05                	jne    80338f <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80338a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80338d:	c9                   	leave
+  80338e:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80338f:	83 ec 08             	sub    $0x8,%esp
+  803392:	50                   	push   %eax
+  803393:	8d 43 04             	lea    0x4(%ebx),%eax
+  803396:	50                   	push   %eax
+  803397:	e8 e7 dd ff ff       	call   801183 <sys_page_batch>
+	pb->pb_n = 0;
+  80339c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8033a2:	83 c4 10             	add    $0x10,%esp
+  8033a5:	eb e3                	jmp    80338a <pgbatch_flush+0x10>
+
+008033a7 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8033a7:	55                   	push   %ebp
+  8033a8:	89 e5                	mov    %esp,%ebp
+  8033aa:	56                   	push   %esi
+  8033ab:	53                   	push   %ebx
+  8033ac:	89 c3                	mov    %eax,%ebx
+  8033ae:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033b0:	83 38 20             	cmpl   $0x20,(%eax)
+  8033b3:	74 2c                	je     8033e1 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8033b5:	8b 03                	mov    (%ebx),%eax
+  8033b7:	8d 50 01             	lea    0x1(%eax),%edx
+  8033ba:	89 13                	mov    %edx,(%ebx)
+  8033bc:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8033bf:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8033c3:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8033c5:	83 ec 04             	sub    $0x4,%esp
+  8033c8:	6a 18                	push   $0x18
+  8033ca:	6a 00                	push   $0x0
+  8033cc:	50                   	push   %eax
+  8033cd:	e8 23 d8 ff ff       	call   800bf5 <memset>
+	return 0;
+  8033d2:	83 c4 10             	add    $0x10,%esp
+  8033d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033dd:	5b                   	pop    %ebx
+  8033de:	5e                   	pop    %esi
+  8033df:	5d                   	pop    %ebp
+  8033e0:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033e1:	83 ec 0c             	sub    $0xc,%esp
+  8033e4:	50                   	push   %eax
+  8033e5:	e8 90 ff ff ff       	call   80337a <pgbatch_flush>
+  8033ea:	83 c4 10             	add    $0x10,%esp
+  8033ed:	85 c0                	test   %eax,%eax
+  8033ef:	79 c4                	jns    8033b5 <pgbatch_slot+0xe>
+  8033f1:	eb e7                	jmp    8033da <pgbatch_slot+0x33>
+
+008033f3 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8033f3:	55                   	push   %ebp
+  8033f4:	89 e5                	mov    %esp,%ebp
+  8033f6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033f9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ff:	e8 a3 ff ff ff       	call   8033a7 <pgbatch_slot>
+  803404:	85 c0                	test   %eax,%eax
+  803406:	78 20                	js     803428 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803408:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80340b:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803411:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803414:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803417:	8b 55 10             	mov    0x10(%ebp),%edx
+  80341a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80341d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803420:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803423:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803428:	c9                   	leave
+  803429:	c3                   	ret
+
+0080342a <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80342a:	55                   	push   %ebp
+  80342b:	89 e5                	mov    %esp,%ebp
+  80342d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803430:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803433:	8b 45 08             	mov    0x8(%ebp),%eax
+  803436:	e8 6c ff ff ff       	call   8033a7 <pgbatch_slot>
+  80343b:	85 c0                	test   %eax,%eax
+  80343d:	78 2c                	js     80346b <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80343f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803442:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803448:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80344b:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80344e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803451:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803454:	8b 55 14             	mov    0x14(%ebp),%edx
+  803457:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80345a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80345d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803460:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803463:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803466:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80346b:	c9                   	leave
+  80346c:	c3                   	ret
+
+0080346d <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80346d:	55                   	push   %ebp
+  80346e:	89 e5                	mov    %esp,%ebp
+  803470:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803473:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803476:	8b 45 08             	mov    0x8(%ebp),%eax
+  803479:	e8 29 ff ff ff       	call   8033a7 <pgbatch_slot>
+  80347e:	85 c0                	test   %eax,%eax
+  803480:	78 1a                	js     80349c <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803482:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803485:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80348b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80348e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803491:	8b 55 10             	mov    0x10(%ebp),%edx
+  803494:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803497:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80349c:	c9                   	leave
+  80349d:	c3                   	ret
+
+0080349e <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80349e:	55                   	push   %ebp
+  80349f:	89 e5                	mov    %esp,%ebp
+  8034a1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034a4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034aa:	e8 f8 fe ff ff       	call   8033a7 <pgbatch_slot>
+  8034af:	85 c0                	test   %eax,%eax
+  8034b1:	78 20                	js     8034d3 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8034b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034b6:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8034bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034bf:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034c2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034c5:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034c8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034cb:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034d3:	c9                   	leave
+  8034d4:	c3                   	ret
+
+008034d5 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8034d5:	55                   	push   %ebp
+  8034d6:	89 e5                	mov    %esp,%ebp
+  8034d8:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034db:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e1:	e8 c1 fe ff ff       	call   8033a7 <pgbatch_slot>
+  8034e6:	85 c0                	test   %eax,%eax
+  8034e8:	78 26                	js     803510 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8034ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034ed:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8034f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034f6:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8034f9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034fc:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8034ff:	8b 55 14             	mov    0x14(%ebp),%edx
+  803502:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803505:	8b 55 18             	mov    0x18(%ebp),%edx
+  803508:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80350b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803510:	c9                   	leave
+  803511:	c3                   	ret
+
+00803512 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803512:	b8 00 00 00 00       	mov    $0x0,%eax
+  803517:	c3                   	ret
+
+00803518 <devcons_poll>:
+{
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	53                   	push   %ebx
+  80351c:	83 ec 04             	sub    $0x4,%esp
+  80351f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803522:	89 da                	mov    %ebx,%edx
+  803524:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803527:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  80352e:	74 0c                	je     80353c <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803530:	89 d8                	mov    %ebx,%eax
+  803532:	83 e0 01             	and    $0x1,%eax
+  803535:	09 d0                	or     %edx,%eax
+}
+  803537:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80353a:	c9                   	leave
+  80353b:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80353c:	e8 cf d8 ff ff       	call   800e10 <sys_cgetc>
+  803541:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803546:	89 da                	mov    %ebx,%edx
+  803548:	83 e2 04             	and    $0x4,%edx
+  80354b:	85 c0                	test   %eax,%eax
+  80354d:	74 e6                	je     803535 <devcons_poll+0x1d>
+  80354f:	eb df                	jmp    803530 <devcons_poll+0x18>
+
+00803551 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803551:	55                   	push   %ebp
+  803552:	89 e5                	mov    %esp,%ebp
+  803554:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803557:	68 5e 41 80 00       	push   $0x80415e
+  80355c:	ff 75 0c             	push   0xc(%ebp)
+  80355f:	e8 16 d5 ff ff       	call   800a7a <strcpy>
+	return 0;
+}
+  803564:	b8 00 00 00 00       	mov    $0x0,%eax
+  803569:	c9                   	leave
+  80356a:	c3                   	ret
+
+0080356b <devcons_write>:
+{
+  80356b:	55                   	push   %ebp
+  80356c:	89 e5                	mov    %esp,%ebp
+  80356e:	57                   	push   %edi
+  80356f:	56                   	push   %esi
+  803570:	53                   	push   %ebx
+  803571:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803577:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80357a:	85 ff                	test   %edi,%edi
+  80357c:	74 51                	je     8035cf <devcons_write+0x64>
+  80357e:	be 00 00 00 00       	mov    $0x0,%esi
+  803583:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803588:	89 fb                	mov    %edi,%ebx
+  80358a:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80358c:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803591:	39 d3                	cmp    %edx,%ebx
+  803593:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803596:	83 ec 04             	sub    $0x4,%esp
+  803599:	53                   	push   %ebx
+  80359a:	03 45 0c             	add    0xc(%ebp),%eax
+  80359d:	50                   	push   %eax
+  80359e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035a4:	50                   	push   %eax
+  8035a5:	e8 80 d6 ff ff       	call   800c2a <memmove>
+		sys_cputs(buf, m);
+  8035aa:	83 c4 08             	add    $0x8,%esp
+  8035ad:	53                   	push   %ebx
+  8035ae:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035b4:	50                   	push   %eax
+  8035b5:	e8 38 d8 ff ff       	call   800df2 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8035ba:	01 de                	add    %ebx,%esi
+  8035bc:	89 f0                	mov    %esi,%eax
+  8035be:	83 c4 10             	add    $0x10,%esp
+  8035c1:	39 fe                	cmp    %edi,%esi
+  8035c3:	72 c3                	jb     803588 <devcons_write+0x1d>
+}
+  8035c5:	89 f0                	mov    %esi,%eax
+  8035c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035ca:	5b                   	pop    %ebx
+  8035cb:	5e                   	pop    %esi
+  8035cc:	5f                   	pop    %edi
+  8035cd:	5d                   	pop    %ebp
+  8035ce:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8035cf:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8035d4:	eb ef                	jmp    8035c5 <devcons_write+0x5a>
+
+008035d6 <devcons_read>:
+{
+  8035d6:	55                   	push   %ebp
+  8035d7:	89 e5                	mov    %esp,%ebp
+  8035d9:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8035dc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8035e1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035e5:	74 36                	je     80361d <devcons_read+0x47>
+	c = cons_peek;
+  8035e7:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8035ec:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8035f3:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8035f6:	85 c0                	test   %eax,%eax
+  8035f8:	75 10                	jne    80360a <devcons_read+0x34>
+  8035fa:	e8 11 d8 ff ff       	call   800e10 <sys_cgetc>
+  8035ff:	85 c0                	test   %eax,%eax
+  803601:	75 07                	jne    80360a <devcons_read+0x34>
+		sys_yield();
+  803603:	e8 87 d8 ff ff       	call   800e8f <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803608:	eb f0                	jmp    8035fa <devcons_read+0x24>
+	if (c < 0)
+  80360a:	85 c0                	test   %eax,%eax
+  80360c:	78 0f                	js     80361d <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80360e:	83 f8 04             	cmp    $0x4,%eax
+  803611:	74 0c                	je     80361f <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803613:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803616:	88 02                	mov    %al,(%edx)
+	return 1;
+  803618:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80361d:	c9                   	leave
+  80361e:	c3                   	ret
+		return 0;
+  80361f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803624:	eb f7                	jmp    80361d <devcons_read+0x47>
+
+00803626 <cputchar>:
+{
+  803626:	55                   	push   %ebp
+  803627:	89 e5                	mov    %esp,%ebp
+  803629:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80362c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80362f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803632:	6a 01                	push   $0x1
+  803634:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803637:	50                   	push   %eax
+  803638:	e8 b5 d7 ff ff       	call   800df2 <sys_cputs>
+}
+  80363d:	83 c4 10             	add    $0x10,%esp
+  803640:	c9                   	leave
+  803641:	c3                   	ret
+
+00803642 <getchar>:
+{
+  803642:	55                   	push   %ebp
+  803643:	89 e5                	mov    %esp,%ebp
+  803645:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803648:	6a 01                	push   $0x1
+  80364a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80364d:	50                   	push   %eax
+  80364e:	6a 00                	push   $0x0
+  803650:	e8 b7 df ff ff       	call   80160c <read>
+	if (r < 0)
+  803655:	83 c4 10             	add    $0x10,%esp
+  803658:	85 c0                	test   %eax,%eax
+  80365a:	78 06                	js     803662 <getchar+0x20>
+	if (r < 1)
+  80365c:	74 06                	je     803664 <getchar+0x22>
+	return c;
+  80365e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803662:	c9                   	leave
+  803663:	c3                   	ret
+		return -E_EOF;
+  803664:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803669:	eb f7                	jmp    803662 <getchar+0x20>
+
+0080366b <iscons>:
+{
+  80366b:	55                   	push   %ebp
+  80366c:	89 e5                	mov    %esp,%ebp
+  80366e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803671:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803674:	50                   	push   %eax
+  803675:	ff 75 08             	push   0x8(%ebp)
+  803678:	e8 0b dd ff ff       	call   801388 <fd_lookup>
+  80367d:	83 c4 10             	add    $0x10,%esp
+  803680:	85 c0                	test   %eax,%eax
+  803682:	78 11                	js     803695 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803687:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80368d:	39 10                	cmp    %edx,(%eax)
+  80368f:	0f 94 c0             	sete   %al
+  803692:	0f b6 c0             	movzbl %al,%eax
+}
+  803695:	c9                   	leave
+  803696:	c3                   	ret
+
+00803697 <opencons>:
+{
+  803697:	55                   	push   %ebp
+  803698:	89 e5                	mov    %esp,%ebp
+  80369a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80369d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036a0:	50                   	push   %eax
+  8036a1:	e8 92 dc ff ff       	call   801338 <fd_alloc>
+  8036a6:	83 c4 10             	add    $0x10,%esp
+  8036a9:	85 c0                	test   %eax,%eax
+  8036ab:	78 3a                	js     8036e7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8036ad:	83 ec 04             	sub    $0x4,%esp
+  8036b0:	68 07 04 00 00       	push   $0x407
+  8036b5:	ff 75 f4             	push   -0xc(%ebp)
+  8036b8:	6a 00                	push   $0x0
+  8036ba:	e8 ef d7 ff ff       	call   800eae <sys_page_alloc>
+  8036bf:	83 c4 10             	add    $0x10,%esp
+  8036c2:	85 c0                	test   %eax,%eax
+  8036c4:	78 21                	js     8036e7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8036c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036c9:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8036cf:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8036d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036d4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8036db:	83 ec 0c             	sub    $0xc,%esp
+  8036de:	50                   	push   %eax
+  8036df:	e8 2d dc ff ff       	call   801311 <fd2num>
+  8036e4:	83 c4 10             	add    $0x10,%esp
+}
+  8036e7:	c9                   	leave
+  8036e8:	c3                   	ret
+
+008036e9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036e9:	55                   	push   %ebp
+  8036ea:	89 e5                	mov    %esp,%ebp
+  8036ec:	56                   	push   %esi
+  8036ed:	53                   	push   %ebx
+  8036ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8036f7:	85 c0                	test   %eax,%eax
+  8036f9:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036fe:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803701:	83 ec 0c             	sub    $0xc,%esp
+  803704:	50                   	push   %eax
+  803705:	e8 54 d9 ff ff       	call   80105e <sys_ipc_recv>
+  80370a:	83 c4 10             	add    $0x10,%esp
+  80370d:	85 c0                	test   %eax,%eax
+  80370f:	0f 88 8b 00 00 00    	js     8037a0 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803715:	85 f6                	test   %esi,%esi
+  803717:	74 2a                	je     803743 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803719:	89 e2                	mov    %esp,%edx
+  80371b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803720:	29 d0                	sub    %edx,%eax
+  803722:	89 c2                	mov    %eax,%edx
+  803724:	c1 ea 0f             	shr    $0xf,%edx
+  803727:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80372c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803731:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803734:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80373b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803741:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803743:	85 db                	test   %ebx,%ebx
+  803745:	74 2a                	je     803771 <ipc_recv+0x88>
+  803747:	89 e2                	mov    %esp,%edx
+  803749:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80374e:	29 d0                	sub    %edx,%eax
+  803750:	89 c2                	mov    %eax,%edx
+  803752:	c1 ea 0f             	shr    $0xf,%edx
+  803755:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80375a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375f:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803762:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803769:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80376f:	89 03                	mov    %eax,(%ebx)
+  803771:	89 e2                	mov    %esp,%edx
+  803773:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803778:	29 d0                	sub    %edx,%eax
+  80377a:	89 c2                	mov    %eax,%edx
+  80377c:	c1 ea 0f             	shr    $0xf,%edx
+  80377f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803784:	b8 00 00 00 00       	mov    $0x0,%eax
+  803789:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80378c:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803793:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803799:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80379c:	5b                   	pop    %ebx
+  80379d:	5e                   	pop    %esi
+  80379e:	5d                   	pop    %ebp
+  80379f:	c3                   	ret
+		if(from_env_store != NULL)
+  8037a0:	85 f6                	test   %esi,%esi
+  8037a2:	74 06                	je     8037aa <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8037a4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8037aa:	85 db                	test   %ebx,%ebx
+  8037ac:	74 eb                	je     803799 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8037ae:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037b4:	eb e3                	jmp    803799 <ipc_recv+0xb0>
+
+008037b6 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8037b6:	55                   	push   %ebp
+  8037b7:	89 e5                	mov    %esp,%ebp
+  8037b9:	57                   	push   %edi
+  8037ba:	56                   	push   %esi
+  8037bb:	53                   	push   %ebx
+  8037bc:	83 ec 14             	sub    $0x14,%esp
+  8037bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037c5:	8b 75 14             	mov    0x14(%ebp),%esi
+  8037c8:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8037cb:	85 c0                	test   %eax,%eax
+  8037cd:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8037d2:	0f 44 c2             	cmove  %edx,%eax
+  8037d5:	ff 75 10             	push   0x10(%ebp)
+  8037d8:	50                   	push   %eax
+  8037d9:	e8 e2 d8 ff ff       	call   8010c0 <sys_ipc_recv_pages>
+  8037de:	83 c4 10             	add    $0x10,%esp
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	0f 88 ba 00 00 00    	js     8038a3 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8037e9:	85 ff                	test   %edi,%edi
+  8037eb:	74 2a                	je     803817 <ipc_recv_pages+0x61>
+  8037ed:	89 e2                	mov    %esp,%edx
+  8037ef:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037f4:	29 d0                	sub    %edx,%eax
+  8037f6:	89 c2                	mov    %eax,%edx
+  8037f8:	c1 ea 0f             	shr    $0xf,%edx
+  8037fb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803800:	b8 00 00 00 00       	mov    $0x0,%eax
+  803805:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803808:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80380f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803815:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803817:	85 f6                	test   %esi,%esi
+  803819:	74 2a                	je     803845 <ipc_recv_pages+0x8f>
+  80381b:	89 e2                	mov    %esp,%edx
+  80381d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803822:	29 d0                	sub    %edx,%eax
+  803824:	89 c2                	mov    %eax,%edx
+  803826:	c1 ea 0f             	shr    $0xf,%edx
+  803829:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80382e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803833:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803836:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80383d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803843:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803845:	85 db                	test   %ebx,%ebx
+  803847:	74 2a                	je     803873 <ipc_recv_pages+0xbd>
+  803849:	89 e2                	mov    %esp,%edx
+  80384b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803850:	29 d0                	sub    %edx,%eax
+  803852:	89 c2                	mov    %eax,%edx
+  803854:	c1 ea 0f             	shr    $0xf,%edx
+  803857:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80385c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803861:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803864:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80386b:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803871:	89 03                	mov    %eax,(%ebx)
+  803873:	89 e2                	mov    %esp,%edx
+  803875:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80387a:	29 d0                	sub    %edx,%eax
+  80387c:	89 c2                	mov    %eax,%edx
+  80387e:	c1 ea 0f             	shr    $0xf,%edx
+  803881:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388b:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80388e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803895:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80389b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80389e:	5b                   	pop    %ebx
+  80389f:	5e                   	pop    %esi
+  8038a0:	5f                   	pop    %edi
+  8038a1:	5d                   	pop    %ebp
+  8038a2:	c3                   	ret
+		if (from_env_store)
+  8038a3:	85 ff                	test   %edi,%edi
+  8038a5:	74 06                	je     8038ad <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8038a7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8038ad:	85 f6                	test   %esi,%esi
+  8038af:	74 06                	je     8038b7 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8038b1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8038b7:	85 db                	test   %ebx,%ebx
+  8038b9:	74 e0                	je     80389b <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8038bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8038c1:	eb d8                	jmp    80389b <ipc_recv_pages+0xe5>
+
+008038c3 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8038c3:	55                   	push   %ebp
+  8038c4:	89 e5                	mov    %esp,%ebp
+  8038c6:	57                   	push   %edi
+  8038c7:	56                   	push   %esi
+  8038c8:	53                   	push   %ebx
+  8038c9:	83 ec 1c             	sub    $0x1c,%esp
+  8038cc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8038cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038d2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038d8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038dc:	75 2b                	jne    803909 <ipc_try_send_pages+0x46>
+  8038de:	89 e2                	mov    %esp,%edx
+  8038e0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038e5:	29 d0                	sub    %edx,%eax
+  8038e7:	89 c2                	mov    %eax,%edx
+  8038e9:	c1 ea 0f             	shr    $0xf,%edx
+  8038ec:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f6:	0f 42 c2             	cmovb  %edx,%eax
+  8038f9:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803900:	8b 70 48             	mov    0x48(%eax),%esi
+  803903:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803909:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80390f:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803914:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803917:	85 ff                	test   %edi,%edi
+  803919:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80391e:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803921:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803927:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80392d:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803933:	83 ec 0c             	sub    $0xc,%esp
+  803936:	ff 75 14             	push   0x14(%ebp)
+  803939:	ff 75 18             	push   0x18(%ebp)
+  80393c:	57                   	push   %edi
+  80393d:	ff 75 0c             	push   0xc(%ebp)
+  803940:	ff 75 08             	push   0x8(%ebp)
+  803943:	e8 57 d7 ff ff       	call   80109f <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803948:	83 c4 20             	add    $0x20,%esp
+  80394b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80394e:	75 21                	jne    803971 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803950:	83 ec 04             	sub    $0x4,%esp
+  803953:	6a ff                	push   $0xffffffff
+  803955:	53                   	push   %ebx
+  803956:	ff 75 e4             	push   -0x1c(%ebp)
+  803959:	e8 4e d9 ff ff       	call   8012ac <sys_futex_wait>
+  80395e:	83 c4 10             	add    $0x10,%esp
+  803961:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803964:	74 c7                	je     80392d <ipc_try_send_pages+0x6a>
+  803966:	85 c0                	test   %eax,%eax
+  803968:	79 c3                	jns    80392d <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80396a:	e8 20 d5 ff ff       	call   800e8f <sys_yield>
+  80396f:	eb bc                	jmp    80392d <ipc_try_send_pages+0x6a>
+	}
+}
+  803971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803974:	5b                   	pop    %ebx
+  803975:	5e                   	pop    %esi
+  803976:	5f                   	pop    %edi
+  803977:	5d                   	pop    %ebp
+  803978:	c3                   	ret
+
+00803979 <ipc_send>:
+{
+  803979:	55                   	push   %ebp
+  80397a:	89 e5                	mov    %esp,%ebp
+  80397c:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80397f:	ff 75 14             	push   0x14(%ebp)
+  803982:	6a 01                	push   $0x1
+  803984:	ff 75 10             	push   0x10(%ebp)
+  803987:	ff 75 0c             	push   0xc(%ebp)
+  80398a:	ff 75 08             	push   0x8(%ebp)
+  80398d:	e8 31 ff ff ff       	call   8038c3 <ipc_try_send_pages>
+  803992:	83 c4 20             	add    $0x20,%esp
+  803995:	85 c0                	test   %eax,%eax
+  803997:	78 02                	js     80399b <ipc_send+0x22>
+}
+  803999:	c9                   	leave
+  80399a:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80399b:	50                   	push   %eax
+  80399c:	68 6a 41 80 00       	push   $0x80416a
+  8039a1:	6a 3f                	push   $0x3f
+  8039a3:	68 7f 41 80 00       	push   $0x80417f
+  8039a8:	e8 fb c8 ff ff       	call   8002a8 <_panic>
+
+008039ad <ipc_send_pages>:
+{
+  8039ad:	55                   	push   %ebp
+  8039ae:	89 e5                	mov    %esp,%ebp
+  8039b0:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8039b3:	ff 75 18             	push   0x18(%ebp)
+  8039b6:	ff 75 14             	push   0x14(%ebp)
+  8039b9:	ff 75 10             	push   0x10(%ebp)
+  8039bc:	ff 75 0c             	push   0xc(%ebp)
+  8039bf:	ff 75 08             	push   0x8(%ebp)
+  8039c2:	e8 fc fe ff ff       	call   8038c3 <ipc_try_send_pages>
+  8039c7:	83 c4 20             	add    $0x20,%esp
+  8039ca:	85 c0                	test   %eax,%eax
+  8039cc:	78 02                	js     8039d0 <ipc_send_pages+0x23>
+}
+  8039ce:	c9                   	leave
+  8039cf:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8039d0:	50                   	push   %eax
+  8039d1:	68 89 41 80 00       	push   $0x804189
+  8039d6:	6a 64                	push   $0x64
+  8039d8:	68 7f 41 80 00       	push   $0x80417f
+  8039dd:	e8 c6 c8 ff ff       	call   8002a8 <_panic>
+
+008039e2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8039e2:	55                   	push   %ebp
+  8039e3:	89 e5                	mov    %esp,%ebp
+  8039e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8039e8:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8039ed:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8039f3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039f9:	8b 52 50             	mov    0x50(%edx),%edx
+  8039fc:	39 ca                	cmp    %ecx,%edx
+  8039fe:	74 11                	je     803a11 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803a00:	83 c0 01             	add    $0x1,%eax
+  803a03:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803a08:	75 e3                	jne    8039ed <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a0f:	eb 0e                	jmp    803a1f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803a11:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803a17:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a1c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803a1f:	5d                   	pop    %ebp
+  803a20:	c3                   	ret
+
+00803a21 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a21:	55                   	push   %ebp
+  803a22:	89 e5                	mov    %esp,%ebp
+  803a24:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a27:	89 c2                	mov    %eax,%edx
+  803a29:	c1 ea 16             	shr    $0x16,%edx
+  803a2c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a33:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a38:	f6 c1 01             	test   $0x1,%cl
+  803a3b:	74 1e                	je     803a5b <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803a3d:	c1 e8 0c             	shr    $0xc,%eax
+  803a40:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a47:	a8 01                	test   $0x1,%al
+  803a49:	74 10                	je     803a5b <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a4b:	c1 e8 0c             	shr    $0xc,%eax
+  803a4e:	c1 e0 04             	shl    $0x4,%eax
+  803a51:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803a58:	0f b7 d2             	movzwl %dx,%edx
+}
+  803a5b:	89 d0                	mov    %edx,%eax
+  803a5d:	5d                   	pop    %ebp
+  803a5e:	c3                   	ret
+
+00803a5f <__udivdi3>:
+  803a5f:	57                   	push   %edi
+  803a60:	56                   	push   %esi
+  803a61:	53                   	push   %ebx
+  803a62:	83 ec 20             	sub    $0x20,%esp
+  803a65:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803a69:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803a6d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a71:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a75:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a79:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a7d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803a81:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803a85:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a94:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803a9b:	00 
+  803a9c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803aa3:	00 
+  803aa4:	eb 08                	jmp    803aae <__udivdi3+0x4f>
+  803aa6:	83 e9 01             	sub    $0x1,%ecx
+  803aa9:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803aac:	74 68                	je     803b16 <__udivdi3+0xb7>
+  803aae:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803ab2:	01 c0                	add    %eax,%eax
+  803ab4:	89 c6                	mov    %eax,%esi
+  803ab6:	89 d7                	mov    %edx,%edi
+  803ab8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803abc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ac0:	0f ad d0             	shrd   %cl,%edx,%eax
+  803ac3:	d3 ea                	shr    %cl,%edx
+  803ac5:	f6 c1 20             	test   $0x20,%cl
+  803ac8:	74 04                	je     803ace <__udivdi3+0x6f>
+  803aca:	89 d0                	mov    %edx,%eax
+  803acc:	31 d2                	xor    %edx,%edx
+  803ace:	83 e0 01             	and    $0x1,%eax
+  803ad1:	89 04 24             	mov    %eax,(%esp)
+  803ad4:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803adb:	00 
+  803adc:	8b 04 24             	mov    (%esp),%eax
+  803adf:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803ae3:	09 f0                	or     %esi,%eax
+  803ae5:	09 fa                	or     %edi,%edx
+  803ae7:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803aeb:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803aef:	39 f0                	cmp    %esi,%eax
+  803af1:	89 d3                	mov    %edx,%ebx
+  803af3:	19 fb                	sbb    %edi,%ebx
+  803af5:	72 af                	jb     803aa6 <__udivdi3+0x47>
+  803af7:	29 f0                	sub    %esi,%eax
+  803af9:	19 fa                	sbb    %edi,%edx
+  803afb:	89 cf                	mov    %ecx,%edi
+  803afd:	c1 ef 05             	shr    $0x5,%edi
+  803b00:	83 e7 01             	and    $0x1,%edi
+  803b03:	89 fe                	mov    %edi,%esi
+  803b05:	83 f6 01             	xor    $0x1,%esi
+  803b08:	d3 e6                	shl    %cl,%esi
+  803b0a:	d3 e7                	shl    %cl,%edi
+  803b0c:	09 74 24 18          	or     %esi,0x18(%esp)
+  803b10:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803b14:	eb 90                	jmp    803aa6 <__udivdi3+0x47>
+  803b16:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b1a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b1e:	83 c4 20             	add    $0x20,%esp
+  803b21:	5b                   	pop    %ebx
+  803b22:	5e                   	pop    %esi
+  803b23:	5f                   	pop    %edi
+  803b24:	c3                   	ret
+
+00803b25 <__umoddi3>:
+  803b25:	57                   	push   %edi
+  803b26:	56                   	push   %esi
+  803b27:	53                   	push   %ebx
+  803b28:	83 ec 08             	sub    $0x8,%esp
+  803b2b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b2f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b33:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803b37:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803b3b:	57                   	push   %edi
+  803b3c:	56                   	push   %esi
+  803b3d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b41:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b45:	52                   	push   %edx
+  803b46:	50                   	push   %eax
+  803b47:	e8 13 ff ff ff       	call   803a5f <__udivdi3>
+  803b4c:	89 c3                	mov    %eax,%ebx
+  803b4e:	0f af d6             	imul   %esi,%edx
+  803b51:	89 f9                	mov    %edi,%ecx
+  803b53:	0f af cb             	imul   %ebx,%ecx
+  803b56:	01 d1                	add    %edx,%ecx
+  803b58:	89 d8                	mov    %ebx,%eax
+  803b5a:	f7 e6                	mul    %esi
+  803b5c:	89 c6                	mov    %eax,%esi
+  803b5e:	89 d7                	mov    %edx,%edi
+  803b60:	01 cf                	add    %ecx,%edi
+  803b62:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b66:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b6a:	29 f0                	sub    %esi,%eax
+  803b6c:	19 fa                	sbb    %edi,%edx
+  803b6e:	83 c4 18             	add    $0x18,%esp
+  803b71:	5b                   	pop    %ebx
+  803b72:	5e                   	pop    %esi
+  803b73:	5f                   	pop    %edi
+  803b74:	c3                   	ret
+
+00803b75 <__divdi3>:
+  803b75:	53                   	push   %ebx
+  803b76:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b7a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b7e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803b82:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803b86:	85 d2                	test   %edx,%edx
+  803b88:	78 12                	js     803b9c <__divdi3+0x27>
+  803b8a:	85 db                	test   %ebx,%ebx
+  803b8c:	78 2e                	js     803bbc <__divdi3+0x47>
+  803b8e:	53                   	push   %ebx
+  803b8f:	51                   	push   %ecx
+  803b90:	52                   	push   %edx
+  803b91:	50                   	push   %eax
+  803b92:	e8 c8 fe ff ff       	call   803a5f <__udivdi3>
+  803b97:	83 c4 10             	add    $0x10,%esp
+  803b9a:	eb 1e                	jmp    803bba <__divdi3+0x45>
+  803b9c:	f7 d8                	neg    %eax
+  803b9e:	83 d2 00             	adc    $0x0,%edx
+  803ba1:	f7 da                	neg    %edx
+  803ba3:	85 db                	test   %ebx,%ebx
+  803ba5:	78 2a                	js     803bd1 <__divdi3+0x5c>
+  803ba7:	53                   	push   %ebx
+  803ba8:	51                   	push   %ecx
+  803ba9:	52                   	push   %edx
+  803baa:	50                   	push   %eax
+  803bab:	e8 af fe ff ff       	call   803a5f <__udivdi3>
+  803bb0:	83 c4 10             	add    $0x10,%esp
+  803bb3:	f7 d8                	neg    %eax
+  803bb5:	83 d2 00             	adc    $0x0,%edx
+  803bb8:	f7 da                	neg    %edx
+  803bba:	5b                   	pop    %ebx
+  803bbb:	c3                   	ret
+  803bbc:	f7 d9                	neg    %ecx
+  803bbe:	83 d3 00             	adc    $0x0,%ebx
+  803bc1:	f7 db                	neg    %ebx
+  803bc3:	53                   	push   %ebx
+  803bc4:	51                   	push   %ecx
+  803bc5:	52                   	push   %edx
+  803bc6:	50                   	push   %eax
+  803bc7:	e8 93 fe ff ff       	call   803a5f <__udivdi3>
+  803bcc:	83 c4 10             	add    $0x10,%esp
+  803bcf:	eb e2                	jmp    803bb3 <__divdi3+0x3e>
+  803bd1:	f7 d9                	neg    %ecx
+  803bd3:	83 d3 00             	adc    $0x0,%ebx
+  803bd6:	f7 db                	neg    %ebx
+  803bd8:	53                   	push   %ebx
+  803bd9:	51                   	push   %ecx
+  803bda:	52                   	push   %edx
+  803bdb:	50                   	push   %eax
+  803bdc:	e8 7e fe ff ff       	call   803a5f <__udivdi3>
+  803be1:	83 c4 10             	add    $0x10,%esp
+  803be4:	eb d4                	jmp    803bba <__divdi3+0x45>
+
+00803be6 <__moddi3>:
+  803be6:	57                   	push   %edi
+  803be7:	56                   	push   %esi
+  803be8:	53                   	push   %ebx
+  803be9:	83 ec 08             	sub    $0x8,%esp
+  803bec:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803bf0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803bf4:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803bf8:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803bfc:	57                   	push   %edi
+  803bfd:	56                   	push   %esi
+  803bfe:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c02:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c06:	52                   	push   %edx
+  803c07:	50                   	push   %eax
+  803c08:	e8 68 ff ff ff       	call   803b75 <__divdi3>
+  803c0d:	89 c3                	mov    %eax,%ebx
+  803c0f:	0f af d6             	imul   %esi,%edx
+  803c12:	89 f9                	mov    %edi,%ecx
+  803c14:	0f af cb             	imul   %ebx,%ecx
+  803c17:	01 d1                	add    %edx,%ecx
+  803c19:	89 d8                	mov    %ebx,%eax
+  803c1b:	f7 e6                	mul    %esi
+  803c1d:	89 c6                	mov    %eax,%esi
+  803c1f:	89 d7                	mov    %edx,%edi
+  803c21:	01 cf                	add    %ecx,%edi
+  803c23:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803c27:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803c2b:	29 f0                	sub    %esi,%eax
+  803c2d:	19 fa                	sbb    %edi,%edx
+  803c2f:	83 c4 18             	add    $0x18,%esp
+  803c32:	5b                   	pop    %ebx
+  803c33:	5e                   	pop    %esi
+  803c34:	5f                   	pop    %edi
+  803c35:	c3                   	ret
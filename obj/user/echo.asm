@@ -0,0 +1,7934 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b5 00 00 00       	call   8000e6 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 1c             	sub    $0x1c,%esp
+  80003e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800041:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i, nflag;
+
+	nflag = 0;
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800044:	83 ff 01             	cmp    $0x1,%edi
+  800047:	7f 16                	jg     80005f <umain+0x2a>
+		if (i > 1)
+			write(1, " ", 1);
+		write(1, argv[i], strlen(argv[i]));
+	}
+	if (!nflag)
+		write(1, "\n", 1);
+  800049:	83 ec 04             	sub    $0x4,%esp
+  80004c:	6a 01                	push   $0x1
+  80004e:	68 54 3c 80 00       	push   $0x803c54
+  800053:	6a 01                	push   $0x1
+  800055:	e8 09 0e 00 00       	call   800e63 <write>
+  80005a:	83 c4 10             	add    $0x10,%esp
+}
+  80005d:	eb 7f                	jmp    8000de <umain+0xa9>
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80005f:	83 ec 08             	sub    $0x8,%esp
+  800062:	68 20 3b 80 00       	push   $0x803b20
+  800067:	ff 76 04             	push   0x4(%esi)
+  80006a:	e8 1a 02 00 00       	call   800289 <strcmp>
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	75 55                	jne    8000cb <umain+0x96>
+		argc--;
+  800076:	83 ef 01             	sub    $0x1,%edi
+		argv++;
+  800079:	83 c6 04             	add    $0x4,%esi
+	for (i = 1; i < argc; i++) {
+  80007c:	83 ff 01             	cmp    $0x1,%edi
+  80007f:	7e 5d                	jle    8000de <umain+0xa9>
+		nflag = 1;
+  800081:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+	for (i = 1; i < argc; i++) {
+  800088:	bb 01 00 00 00       	mov    $0x1,%ebx
+		write(1, argv[i], strlen(argv[i]));
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	ff 34 9e             	push   (%esi,%ebx,4)
+  800093:	e8 f5 00 00 00       	call   80018d <strlen>
+  800098:	83 c4 0c             	add    $0xc,%esp
+  80009b:	50                   	push   %eax
+  80009c:	ff 34 9e             	push   (%esi,%ebx,4)
+  80009f:	6a 01                	push   $0x1
+  8000a1:	e8 bd 0d 00 00       	call   800e63 <write>
+	for (i = 1; i < argc; i++) {
+  8000a6:	83 c3 01             	add    $0x1,%ebx
+  8000a9:	83 c4 10             	add    $0x10,%esp
+  8000ac:	39 fb                	cmp    %edi,%ebx
+  8000ae:	7d 24                	jge    8000d4 <umain+0x9f>
+		if (i > 1)
+  8000b0:	83 fb 01             	cmp    $0x1,%ebx
+  8000b3:	7e d8                	jle    80008d <umain+0x58>
+			write(1, " ", 1);
+  8000b5:	83 ec 04             	sub    $0x4,%esp
+  8000b8:	6a 01                	push   $0x1
+  8000ba:	68 23 3b 80 00       	push   $0x803b23
+  8000bf:	6a 01                	push   $0x1
+  8000c1:	e8 9d 0d 00 00       	call   800e63 <write>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	eb c2                	jmp    80008d <umain+0x58>
+	nflag = 0;
+  8000cb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8000d2:	eb b4                	jmp    800088 <umain+0x53>
+	if (!nflag)
+  8000d4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000d8:	0f 84 6b ff ff ff    	je     800049 <umain+0x14>
+}
+  8000de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e1:	5b                   	pop    %ebx
+  8000e2:	5e                   	pop    %esi
+  8000e3:	5f                   	pop    %edi
+  8000e4:	5d                   	pop    %ebp
+  8000e5:	c3                   	ret
+
+008000e6 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e6:	55                   	push   %ebp
+  8000e7:	89 e5                	mov    %esp,%ebp
+  8000e9:	56                   	push   %esi
+  8000ea:	53                   	push   %ebx
+  8000eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000f1:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000f8:	29 d0                	sub    %edx,%eax
+  8000fa:	89 c2                	mov    %eax,%edx
+  8000fc:	c1 ea 0f             	shr    $0xf,%edx
+  8000ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800104:	b8 00 00 00 00       	mov    $0x0,%eax
+  800109:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80010c:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  800113:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800117:	e8 b3 04 00 00       	call   8005cf <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80011c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800121:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800127:	89 e1                	mov    %esp,%ecx
+  800129:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80012e:	29 ca                	sub    %ecx,%edx
+  800130:	89 d1                	mov    %edx,%ecx
+  800132:	c1 e9 0f             	shr    $0xf,%ecx
+  800135:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80013b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800140:	0f 42 d1             	cmovb  %ecx,%edx
+  800143:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800148:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80014f:	85 db                	test   %ebx,%ebx
+  800151:	7e 07                	jle    80015a <libmain+0x74>
+		binaryname = argv[0];
+  800153:	8b 06                	mov    (%esi),%eax
+  800155:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80015a:	83 ec 08             	sub    $0x8,%esp
+  80015d:	56                   	push   %esi
+  80015e:	53                   	push   %ebx
+  80015f:	e8 d1 fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800164:	e8 0a 00 00 00       	call   800173 <exit>
+}
+  800169:	83 c4 10             	add    $0x10,%esp
+  80016c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80016f:	5b                   	pop    %ebx
+  800170:	5e                   	pop    %esi
+  800171:	5d                   	pop    %ebp
+  800172:	c3                   	ret
+
+00800173 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800173:	55                   	push   %ebp
+  800174:	89 e5                	mov    %esp,%ebp
+  800176:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800179:	e8 db 0a 00 00       	call   800c59 <close_all>
+	sys_env_destroy(0);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	6a 00                	push   $0x0
+  800183:	e8 06 04 00 00       	call   80058e <sys_env_destroy>
+}
+  800188:	83 c4 10             	add    $0x10,%esp
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+
+0080018d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80018d:	55                   	push   %ebp
+  80018e:	89 e5                	mov    %esp,%ebp
+  800190:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800193:	80 3a 00             	cmpb   $0x0,(%edx)
+  800196:	74 10                	je     8001a8 <strlen+0x1b>
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80019d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8001a0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8001a4:	75 f7                	jne    80019d <strlen+0x10>
+	return n;
+}
+  8001a6:	5d                   	pop    %ebp
+  8001a7:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8001a8:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8001ad:	eb f7                	jmp    8001a6 <strlen+0x19>
+
+008001af <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8001b8:	85 d2                	test   %edx,%edx
+  8001ba:	74 16                	je     8001d2 <strnlen+0x23>
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8001c5:	74 09                	je     8001d0 <strnlen+0x21>
+		n++;
+  8001c7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8001ca:	39 d0                	cmp    %edx,%eax
+  8001cc:	75 f3                	jne    8001c1 <strnlen+0x12>
+		n++;
+  8001ce:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8001d0:	5d                   	pop    %ebp
+  8001d1:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8001d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d7:	eb f7                	jmp    8001d0 <strnlen+0x21>
+
+008001d9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8001d9:	55                   	push   %ebp
+  8001da:	89 e5                	mov    %esp,%ebp
+  8001dc:	53                   	push   %ebx
+  8001dd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8001ec:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8001ef:	83 c0 01             	add    $0x1,%eax
+  8001f2:	84 d2                	test   %dl,%dl
+  8001f4:	75 f2                	jne    8001e8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8001f6:	89 c8                	mov    %ecx,%eax
+  8001f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001fb:	c9                   	leave
+  8001fc:	c3                   	ret
+
+008001fd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8001fd:	55                   	push   %ebp
+  8001fe:	89 e5                	mov    %esp,%ebp
+  800200:	53                   	push   %ebx
+  800201:	83 ec 10             	sub    $0x10,%esp
+  800204:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800207:	53                   	push   %ebx
+  800208:	e8 80 ff ff ff       	call   80018d <strlen>
+  80020d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800210:	ff 75 0c             	push   0xc(%ebp)
+  800213:	01 d8                	add    %ebx,%eax
+  800215:	50                   	push   %eax
+  800216:	e8 be ff ff ff       	call   8001d9 <strcpy>
+	return dst;
+}
+  80021b:	89 d8                	mov    %ebx,%eax
+  80021d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800220:	c9                   	leave
+  800221:	c3                   	ret
+
+00800222 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	56                   	push   %esi
+  800226:	53                   	push   %ebx
+  800227:	8b 75 08             	mov    0x8(%ebp),%esi
+  80022a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80022d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800230:	85 db                	test   %ebx,%ebx
+  800232:	74 17                	je     80024b <strncpy+0x29>
+  800234:	01 f3                	add    %esi,%ebx
+  800236:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800238:	83 c0 01             	add    $0x1,%eax
+  80023b:	0f b6 0a             	movzbl (%edx),%ecx
+  80023e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800241:	80 f9 01             	cmp    $0x1,%cl
+  800244:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800247:	39 c3                	cmp    %eax,%ebx
+  800249:	75 ed                	jne    800238 <strncpy+0x16>
+	}
+	return ret;
+}
+  80024b:	89 f0                	mov    %esi,%eax
+  80024d:	5b                   	pop    %ebx
+  80024e:	5e                   	pop    %esi
+  80024f:	5d                   	pop    %ebp
+  800250:	c3                   	ret
+
+00800251 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800251:	55                   	push   %ebp
+  800252:	89 e5                	mov    %esp,%ebp
+  800254:	56                   	push   %esi
+  800255:	53                   	push   %ebx
+  800256:	8b 75 08             	mov    0x8(%ebp),%esi
+  800259:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80025c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80025f:	89 f0                	mov    %esi,%eax
+  800261:	85 db                	test   %ebx,%ebx
+  800263:	74 1e                	je     800283 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800265:	83 eb 01             	sub    $0x1,%ebx
+  800268:	74 16                	je     800280 <strlcpy+0x2f>
+  80026a:	01 f3                	add    %esi,%ebx
+  80026c:	0f b6 0a             	movzbl (%edx),%ecx
+  80026f:	84 c9                	test   %cl,%cl
+  800271:	74 0d                	je     800280 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800273:	83 c2 01             	add    $0x1,%edx
+  800276:	83 c0 01             	add    $0x1,%eax
+  800279:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80027c:	39 d8                	cmp    %ebx,%eax
+  80027e:	75 ec                	jne    80026c <strlcpy+0x1b>
+		*dst = '\0';
+  800280:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800283:	29 f0                	sub    %esi,%eax
+}
+  800285:	5b                   	pop    %ebx
+  800286:	5e                   	pop    %esi
+  800287:	5d                   	pop    %ebp
+  800288:	c3                   	ret
+
+00800289 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800292:	0f b6 01             	movzbl (%ecx),%eax
+  800295:	84 c0                	test   %al,%al
+  800297:	74 11                	je     8002aa <strcmp+0x21>
+  800299:	38 02                	cmp    %al,(%edx)
+  80029b:	75 0d                	jne    8002aa <strcmp+0x21>
+		p++, q++;
+  80029d:	83 c1 01             	add    $0x1,%ecx
+  8002a0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8002a3:	0f b6 01             	movzbl (%ecx),%eax
+  8002a6:	84 c0                	test   %al,%al
+  8002a8:	75 ef                	jne    800299 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8002aa:	0f b6 c0             	movzbl %al,%eax
+  8002ad:	0f b6 12             	movzbl (%edx),%edx
+  8002b0:	29 d0                	sub    %edx,%eax
+}
+  8002b2:	5d                   	pop    %ebp
+  8002b3:	c3                   	ret
+
+008002b4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	53                   	push   %ebx
+  8002b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002be:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8002c1:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8002c6:	85 d2                	test   %edx,%edx
+  8002c8:	74 2e                	je     8002f8 <strncmp+0x44>
+  8002ca:	0f b6 01             	movzbl (%ecx),%eax
+  8002cd:	84 c0                	test   %al,%al
+  8002cf:	74 16                	je     8002e7 <strncmp+0x33>
+  8002d1:	3a 03                	cmp    (%ebx),%al
+  8002d3:	75 12                	jne    8002e7 <strncmp+0x33>
+		n--, p++, q++;
+  8002d5:	83 c1 01             	add    $0x1,%ecx
+  8002d8:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8002db:	83 ea 01             	sub    $0x1,%edx
+  8002de:	75 ea                	jne    8002ca <strncmp+0x16>
+		return 0;
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	eb 11                	jmp    8002f8 <strncmp+0x44>
+  8002e7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8002ec:	85 d2                	test   %edx,%edx
+  8002ee:	74 08                	je     8002f8 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8002f0:	0f b6 01             	movzbl (%ecx),%eax
+  8002f3:	0f b6 13             	movzbl (%ebx),%edx
+  8002f6:	29 d0                	sub    %edx,%eax
+}
+  8002f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002fb:	c9                   	leave
+  8002fc:	c3                   	ret
+
+008002fd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8002fd:	55                   	push   %ebp
+  8002fe:	89 e5                	mov    %esp,%ebp
+  800300:	8b 45 08             	mov    0x8(%ebp),%eax
+  800303:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800307:	0f b6 10             	movzbl (%eax),%edx
+  80030a:	84 d2                	test   %dl,%dl
+  80030c:	74 15                	je     800323 <strchr+0x26>
+		if (*s == c)
+  80030e:	38 d1                	cmp    %dl,%cl
+  800310:	74 0f                	je     800321 <strchr+0x24>
+	for (; *s; s++)
+  800312:	83 c0 01             	add    $0x1,%eax
+  800315:	0f b6 10             	movzbl (%eax),%edx
+  800318:	84 d2                	test   %dl,%dl
+  80031a:	75 f2                	jne    80030e <strchr+0x11>
+			return (char *) s;
+	return 0;
+  80031c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800321:	5d                   	pop    %ebp
+  800322:	c3                   	ret
+	return 0;
+  800323:	b8 00 00 00 00       	mov    $0x0,%eax
+  800328:	eb f7                	jmp    800321 <strchr+0x24>
+
+0080032a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	53                   	push   %ebx
+  80032e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800331:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800334:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800337:	38 d3                	cmp    %dl,%bl
+  800339:	74 14                	je     80034f <strfind+0x25>
+  80033b:	89 d1                	mov    %edx,%ecx
+  80033d:	84 db                	test   %bl,%bl
+  80033f:	74 0e                	je     80034f <strfind+0x25>
+	for (; *s; s++)
+  800341:	83 c0 01             	add    $0x1,%eax
+  800344:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800347:	38 ca                	cmp    %cl,%dl
+  800349:	74 04                	je     80034f <strfind+0x25>
+  80034b:	84 d2                	test   %dl,%dl
+  80034d:	75 f2                	jne    800341 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  80034f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800352:	c9                   	leave
+  800353:	c3                   	ret
+
+00800354 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800354:	55                   	push   %ebp
+  800355:	89 e5                	mov    %esp,%ebp
+  800357:	57                   	push   %edi
+  800358:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80035b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80035e:	85 c9                	test   %ecx,%ecx
+  800360:	74 20                	je     800382 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800362:	89 f8                	mov    %edi,%eax
+  800364:	09 c8                	or     %ecx,%eax
+  800366:	a8 03                	test   $0x3,%al
+  800368:	75 12                	jne    80037c <memset+0x28>
+		c &= 0xFF;
+  80036a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80036e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800374:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800377:	fc                   	cld
+  800378:	f3 ab                	rep stos %eax,%es:(%edi)
+  80037a:	eb 06                	jmp    800382 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80037c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80037f:	fc                   	cld
+  800380:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800382:	89 f8                	mov    %edi,%eax
+  800384:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+
+00800389 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800389:	55                   	push   %ebp
+  80038a:	89 e5                	mov    %esp,%ebp
+  80038c:	57                   	push   %edi
+  80038d:	56                   	push   %esi
+  80038e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800391:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800394:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800397:	39 c6                	cmp    %eax,%esi
+  800399:	73 32                	jae    8003cd <memmove+0x44>
+  80039b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80039e:	39 d0                	cmp    %edx,%eax
+  8003a0:	73 2b                	jae    8003cd <memmove+0x44>
+		s += n;
+		d += n;
+  8003a2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8003a5:	89 d6                	mov    %edx,%esi
+  8003a7:	09 fe                	or     %edi,%esi
+  8003a9:	09 ce                	or     %ecx,%esi
+  8003ab:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8003b1:	75 0e                	jne    8003c1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8003b3:	83 ef 04             	sub    $0x4,%edi
+  8003b6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8003b9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8003bc:	fd                   	std
+  8003bd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8003bf:	eb 09                	jmp    8003ca <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8003c1:	83 ef 01             	sub    $0x1,%edi
+  8003c4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8003c7:	fd                   	std
+  8003c8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8003ca:	fc                   	cld
+  8003cb:	eb 1a                	jmp    8003e7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8003cd:	89 f2                	mov    %esi,%edx
+  8003cf:	09 c2                	or     %eax,%edx
+  8003d1:	09 ca                	or     %ecx,%edx
+  8003d3:	f6 c2 03             	test   $0x3,%dl
+  8003d6:	75 0a                	jne    8003e2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8003d8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8003db:	89 c7                	mov    %eax,%edi
+  8003dd:	fc                   	cld
+  8003de:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8003e0:	eb 05                	jmp    8003e7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8003e2:	89 c7                	mov    %eax,%edi
+  8003e4:	fc                   	cld
+  8003e5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8003e7:	5e                   	pop    %esi
+  8003e8:	5f                   	pop    %edi
+  8003e9:	5d                   	pop    %ebp
+  8003ea:	c3                   	ret
+
+008003eb <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8003eb:	55                   	push   %ebp
+  8003ec:	89 e5                	mov    %esp,%ebp
+  8003ee:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8003f1:	ff 75 10             	push   0x10(%ebp)
+  8003f4:	ff 75 0c             	push   0xc(%ebp)
+  8003f7:	ff 75 08             	push   0x8(%ebp)
+  8003fa:	e8 8a ff ff ff       	call   800389 <memmove>
+}
+  8003ff:	c9                   	leave
+  800400:	c3                   	ret
+
+00800401 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800401:	55                   	push   %ebp
+  800402:	89 e5                	mov    %esp,%ebp
+  800404:	56                   	push   %esi
+  800405:	53                   	push   %ebx
+  800406:	8b 45 08             	mov    0x8(%ebp),%eax
+  800409:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80040c:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80040f:	85 f6                	test   %esi,%esi
+  800411:	74 29                	je     80043c <memcmp+0x3b>
+  800413:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800415:	0f b6 08             	movzbl (%eax),%ecx
+  800418:	0f b6 1a             	movzbl (%edx),%ebx
+  80041b:	38 d9                	cmp    %bl,%cl
+  80041d:	75 11                	jne    800430 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80041f:	83 c0 01             	add    $0x1,%eax
+  800422:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800425:	39 c6                	cmp    %eax,%esi
+  800427:	75 ec                	jne    800415 <memcmp+0x14>
+	}
+
+	return 0;
+  800429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042e:	eb 08                	jmp    800438 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800430:	0f b6 c1             	movzbl %cl,%eax
+  800433:	0f b6 db             	movzbl %bl,%ebx
+  800436:	29 d8                	sub    %ebx,%eax
+}
+  800438:	5b                   	pop    %ebx
+  800439:	5e                   	pop    %esi
+  80043a:	5d                   	pop    %ebp
+  80043b:	c3                   	ret
+	return 0;
+  80043c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800441:	eb f5                	jmp    800438 <memcmp+0x37>
+
+00800443 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	8b 45 08             	mov    0x8(%ebp),%eax
+  800449:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80044c:	89 c2                	mov    %eax,%edx
+  80044e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800451:	39 d0                	cmp    %edx,%eax
+  800453:	73 0d                	jae    800462 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800455:	38 08                	cmp    %cl,(%eax)
+  800457:	74 0d                	je     800466 <memfind+0x23>
+	for (; s < ends; s++)
+  800459:	83 c0 01             	add    $0x1,%eax
+  80045c:	39 c2                	cmp    %eax,%edx
+  80045e:	75 f5                	jne    800455 <memfind+0x12>
+  800460:	eb 06                	jmp    800468 <memfind+0x25>
+  800462:	89 c2                	mov    %eax,%edx
+  800464:	eb 02                	jmp    800468 <memfind+0x25>
+  800466:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800468:	89 d0                	mov    %edx,%eax
+  80046a:	5d                   	pop    %ebp
+  80046b:	c3                   	ret
+
+0080046c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80046c:	55                   	push   %ebp
+  80046d:	89 e5                	mov    %esp,%ebp
+  80046f:	57                   	push   %edi
+  800470:	56                   	push   %esi
+  800471:	53                   	push   %ebx
+  800472:	8b 55 08             	mov    0x8(%ebp),%edx
+  800475:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800478:	0f b6 02             	movzbl (%edx),%eax
+  80047b:	3c 20                	cmp    $0x20,%al
+  80047d:	74 04                	je     800483 <strtol+0x17>
+  80047f:	3c 09                	cmp    $0x9,%al
+  800481:	75 0e                	jne    800491 <strtol+0x25>
+		s++;
+  800483:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800486:	0f b6 02             	movzbl (%edx),%eax
+  800489:	3c 20                	cmp    $0x20,%al
+  80048b:	74 f6                	je     800483 <strtol+0x17>
+  80048d:	3c 09                	cmp    $0x9,%al
+  80048f:	74 f2                	je     800483 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800491:	3c 2b                	cmp    $0x2b,%al
+  800493:	74 2a                	je     8004bf <strtol+0x53>
+	int neg = 0;
+  800495:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80049a:	3c 2d                	cmp    $0x2d,%al
+  80049c:	74 2b                	je     8004c9 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80049e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8004a4:	75 0f                	jne    8004b5 <strtol+0x49>
+  8004a6:	80 3a 30             	cmpb   $0x30,(%edx)
+  8004a9:	74 28                	je     8004d3 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8004ab:	85 db                	test   %ebx,%ebx
+  8004ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004b2:	0f 44 d8             	cmove  %eax,%ebx
+  8004b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ba:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8004bd:	eb 46                	jmp    800505 <strtol+0x99>
+		s++;
+  8004bf:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8004c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004c7:	eb d5                	jmp    80049e <strtol+0x32>
+		s++, neg = 1;
+  8004c9:	83 c2 01             	add    $0x1,%edx
+  8004cc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004d1:	eb cb                	jmp    80049e <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8004d3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8004d7:	74 0e                	je     8004e7 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8004d9:	85 db                	test   %ebx,%ebx
+  8004db:	75 d8                	jne    8004b5 <strtol+0x49>
+		s++, base = 8;
+  8004dd:	83 c2 01             	add    $0x1,%edx
+  8004e0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8004e5:	eb ce                	jmp    8004b5 <strtol+0x49>
+		s += 2, base = 16;
+  8004e7:	83 c2 02             	add    $0x2,%edx
+  8004ea:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8004ef:	eb c4                	jmp    8004b5 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8004f1:	0f be c0             	movsbl %al,%eax
+  8004f4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8004f7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8004fa:	7d 3a                	jge    800536 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8004fc:	83 c2 01             	add    $0x1,%edx
+  8004ff:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800503:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800505:	0f b6 02             	movzbl (%edx),%eax
+  800508:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80050b:	89 f3                	mov    %esi,%ebx
+  80050d:	80 fb 09             	cmp    $0x9,%bl
+  800510:	76 df                	jbe    8004f1 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800512:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800515:	89 f3                	mov    %esi,%ebx
+  800517:	80 fb 19             	cmp    $0x19,%bl
+  80051a:	77 08                	ja     800524 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  80051c:	0f be c0             	movsbl %al,%eax
+  80051f:	83 e8 57             	sub    $0x57,%eax
+  800522:	eb d3                	jmp    8004f7 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800524:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800527:	89 f3                	mov    %esi,%ebx
+  800529:	80 fb 19             	cmp    $0x19,%bl
+  80052c:	77 08                	ja     800536 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  80052e:	0f be c0             	movsbl %al,%eax
+  800531:	83 e8 37             	sub    $0x37,%eax
+  800534:	eb c1                	jmp    8004f7 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800536:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80053a:	74 05                	je     800541 <strtol+0xd5>
+		*endptr = (char *) s;
+  80053c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80053f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800541:	89 c8                	mov    %ecx,%eax
+  800543:	f7 d8                	neg    %eax
+  800545:	85 ff                	test   %edi,%edi
+  800547:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80054a:	89 c8                	mov    %ecx,%eax
+  80054c:	5b                   	pop    %ebx
+  80054d:	5e                   	pop    %esi
+  80054e:	5f                   	pop    %edi
+  80054f:	5d                   	pop    %ebp
+  800550:	c3                   	ret
+
+00800551 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800551:	55                   	push   %ebp
+  800552:	89 e5                	mov    %esp,%ebp
+  800554:	57                   	push   %edi
+  800555:	56                   	push   %esi
+  800556:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800562:	89 c3                	mov    %eax,%ebx
+  800564:	89 c7                	mov    %eax,%edi
+  800566:	89 c6                	mov    %eax,%esi
+  800568:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80056a:	5b                   	pop    %ebx
+  80056b:	5e                   	pop    %esi
+  80056c:	5f                   	pop    %edi
+  80056d:	5d                   	pop    %ebp
+  80056e:	c3                   	ret
+
+0080056f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80056f:	55                   	push   %ebp
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	57                   	push   %edi
+  800573:	56                   	push   %esi
+  800574:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800575:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80057f:	89 d1                	mov    %edx,%ecx
+  800581:	89 d3                	mov    %edx,%ebx
+  800583:	89 d7                	mov    %edx,%edi
+  800585:	89 d6                	mov    %edx,%esi
+  800587:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800589:	5b                   	pop    %ebx
+  80058a:	5e                   	pop    %esi
+  80058b:	5f                   	pop    %edi
+  80058c:	5d                   	pop    %ebp
+  80058d:	c3                   	ret
+
+0080058e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80058e:	55                   	push   %ebp
+  80058f:	89 e5                	mov    %esp,%ebp
+  800591:	57                   	push   %edi
+  800592:	56                   	push   %esi
+  800593:	53                   	push   %ebx
+  800594:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800597:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80059f:	b8 03 00 00 00       	mov    $0x3,%eax
+  8005a4:	89 cb                	mov    %ecx,%ebx
+  8005a6:	89 cf                	mov    %ecx,%edi
+  8005a8:	89 ce                	mov    %ecx,%esi
+  8005aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005ac:	85 c0                	test   %eax,%eax
+  8005ae:	7f 08                	jg     8005b8 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8005b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b3:	5b                   	pop    %ebx
+  8005b4:	5e                   	pop    %esi
+  8005b5:	5f                   	pop    %edi
+  8005b6:	5d                   	pop    %ebp
+  8005b7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005b8:	83 ec 0c             	sub    $0xc,%esp
+  8005bb:	50                   	push   %eax
+  8005bc:	6a 03                	push   $0x3
+  8005be:	68 2f 3b 80 00       	push   $0x803b2f
+  8005c3:	6a 23                	push   $0x23
+  8005c5:	68 4c 3b 80 00       	push   $0x803b4c
+  8005ca:	e8 79 28 00 00       	call   802e48 <_panic>
+
+008005cf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8005cf:	55                   	push   %ebp
+  8005d0:	89 e5                	mov    %esp,%ebp
+  8005d2:	57                   	push   %edi
+  8005d3:	56                   	push   %esi
+  8005d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005da:	b8 02 00 00 00       	mov    $0x2,%eax
+  8005df:	89 d1                	mov    %edx,%ecx
+  8005e1:	89 d3                	mov    %edx,%ebx
+  8005e3:	89 d7                	mov    %edx,%edi
+  8005e5:	89 d6                	mov    %edx,%esi
+  8005e7:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8005e9:	5b                   	pop    %ebx
+  8005ea:	5e                   	pop    %esi
+  8005eb:	5f                   	pop    %edi
+  8005ec:	5d                   	pop    %ebp
+  8005ed:	c3                   	ret
+
+008005ee <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8005ee:	55                   	push   %ebp
+  8005ef:	89 e5                	mov    %esp,%ebp
+  8005f1:	57                   	push   %edi
+  8005f2:	56                   	push   %esi
+  8005f3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8005fe:	89 d1                	mov    %edx,%ecx
+  800600:	89 d3                	mov    %edx,%ebx
+  800602:	89 d7                	mov    %edx,%edi
+  800604:	89 d6                	mov    %edx,%esi
+  800606:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800608:	5b                   	pop    %ebx
+  800609:	5e                   	pop    %esi
+  80060a:	5f                   	pop    %edi
+  80060b:	5d                   	pop    %ebp
+  80060c:	c3                   	ret
+
+0080060d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80060d:	55                   	push   %ebp
+  80060e:	89 e5                	mov    %esp,%ebp
+  800610:	57                   	push   %edi
+  800611:	56                   	push   %esi
+  800612:	53                   	push   %ebx
+  800613:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800616:	be 00 00 00 00       	mov    $0x0,%esi
+  80061b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80061e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800621:	b8 04 00 00 00       	mov    $0x4,%eax
+  800626:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800629:	89 f7                	mov    %esi,%edi
+  80062b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80062d:	85 c0                	test   %eax,%eax
+  80062f:	7f 08                	jg     800639 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800634:	5b                   	pop    %ebx
+  800635:	5e                   	pop    %esi
+  800636:	5f                   	pop    %edi
+  800637:	5d                   	pop    %ebp
+  800638:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800639:	83 ec 0c             	sub    $0xc,%esp
+  80063c:	50                   	push   %eax
+  80063d:	6a 04                	push   $0x4
+  80063f:	68 2f 3b 80 00       	push   $0x803b2f
+  800644:	6a 23                	push   $0x23
+  800646:	68 4c 3b 80 00       	push   $0x803b4c
+  80064b:	e8 f8 27 00 00       	call   802e48 <_panic>
+
+00800650 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800650:	55                   	push   %ebp
+  800651:	89 e5                	mov    %esp,%ebp
+  800653:	57                   	push   %edi
+  800654:	56                   	push   %esi
+  800655:	53                   	push   %ebx
+  800656:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800659:	8b 55 08             	mov    0x8(%ebp),%edx
+  80065c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80065f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800664:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800667:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80066a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80066d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80066f:	85 c0                	test   %eax,%eax
+  800671:	7f 08                	jg     80067b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800673:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800676:	5b                   	pop    %ebx
+  800677:	5e                   	pop    %esi
+  800678:	5f                   	pop    %edi
+  800679:	5d                   	pop    %ebp
+  80067a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80067b:	83 ec 0c             	sub    $0xc,%esp
+  80067e:	50                   	push   %eax
+  80067f:	6a 05                	push   $0x5
+  800681:	68 2f 3b 80 00       	push   $0x803b2f
+  800686:	6a 23                	push   $0x23
+  800688:	68 4c 3b 80 00       	push   $0x803b4c
+  80068d:	e8 b6 27 00 00       	call   802e48 <_panic>
+
+00800692 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800692:	55                   	push   %ebp
+  800693:	89 e5                	mov    %esp,%ebp
+  800695:	57                   	push   %edi
+  800696:	56                   	push   %esi
+  800697:	53                   	push   %ebx
+  800698:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80069b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006a6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8006ab:	89 df                	mov    %ebx,%edi
+  8006ad:	89 de                	mov    %ebx,%esi
+  8006af:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006b1:	85 c0                	test   %eax,%eax
+  8006b3:	7f 08                	jg     8006bd <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8006b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006b8:	5b                   	pop    %ebx
+  8006b9:	5e                   	pop    %esi
+  8006ba:	5f                   	pop    %edi
+  8006bb:	5d                   	pop    %ebp
+  8006bc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006bd:	83 ec 0c             	sub    $0xc,%esp
+  8006c0:	50                   	push   %eax
+  8006c1:	6a 06                	push   $0x6
+  8006c3:	68 2f 3b 80 00       	push   $0x803b2f
+  8006c8:	6a 23                	push   $0x23
+  8006ca:	68 4c 3b 80 00       	push   $0x803b4c
+  8006cf:	e8 74 27 00 00       	call   802e48 <_panic>
+
+008006d4 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8006d4:	55                   	push   %ebp
+  8006d5:	89 e5                	mov    %esp,%ebp
+  8006d7:	57                   	push   %edi
+  8006d8:	56                   	push   %esi
+  8006d9:	53                   	push   %ebx
+  8006da:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006e8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8006ed:	89 df                	mov    %ebx,%edi
+  8006ef:	89 de                	mov    %ebx,%esi
+  8006f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006f3:	85 c0                	test   %eax,%eax
+  8006f5:	7f 08                	jg     8006ff <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8006f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006fa:	5b                   	pop    %ebx
+  8006fb:	5e                   	pop    %esi
+  8006fc:	5f                   	pop    %edi
+  8006fd:	5d                   	pop    %ebp
+  8006fe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006ff:	83 ec 0c             	sub    $0xc,%esp
+  800702:	50                   	push   %eax
+  800703:	6a 08                	push   $0x8
+  800705:	68 2f 3b 80 00       	push   $0x803b2f
+  80070a:	6a 23                	push   $0x23
+  80070c:	68 4c 3b 80 00       	push   $0x803b4c
+  800711:	e8 32 27 00 00       	call   802e48 <_panic>
+
+00800716 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800716:	55                   	push   %ebp
+  800717:	89 e5                	mov    %esp,%ebp
+  800719:	57                   	push   %edi
+  80071a:	56                   	push   %esi
+  80071b:	53                   	push   %ebx
+  80071c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80071f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800724:	8b 55 08             	mov    0x8(%ebp),%edx
+  800727:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80072a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80072f:	89 df                	mov    %ebx,%edi
+  800731:	89 de                	mov    %ebx,%esi
+  800733:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800735:	85 c0                	test   %eax,%eax
+  800737:	7f 08                	jg     800741 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80073c:	5b                   	pop    %ebx
+  80073d:	5e                   	pop    %esi
+  80073e:	5f                   	pop    %edi
+  80073f:	5d                   	pop    %ebp
+  800740:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800741:	83 ec 0c             	sub    $0xc,%esp
+  800744:	50                   	push   %eax
+  800745:	6a 09                	push   $0x9
+  800747:	68 2f 3b 80 00       	push   $0x803b2f
+  80074c:	6a 23                	push   $0x23
+  80074e:	68 4c 3b 80 00       	push   $0x803b4c
+  800753:	e8 f0 26 00 00       	call   802e48 <_panic>
+
+00800758 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800758:	55                   	push   %ebp
+  800759:	89 e5                	mov    %esp,%ebp
+  80075b:	57                   	push   %edi
+  80075c:	56                   	push   %esi
+  80075d:	53                   	push   %ebx
+  80075e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800761:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800766:	8b 55 08             	mov    0x8(%ebp),%edx
+  800769:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80076c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800771:	89 df                	mov    %ebx,%edi
+  800773:	89 de                	mov    %ebx,%esi
+  800775:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800777:	85 c0                	test   %eax,%eax
+  800779:	7f 08                	jg     800783 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80077b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80077e:	5b                   	pop    %ebx
+  80077f:	5e                   	pop    %esi
+  800780:	5f                   	pop    %edi
+  800781:	5d                   	pop    %ebp
+  800782:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800783:	83 ec 0c             	sub    $0xc,%esp
+  800786:	50                   	push   %eax
+  800787:	6a 0a                	push   $0xa
+  800789:	68 2f 3b 80 00       	push   $0x803b2f
+  80078e:	6a 23                	push   $0x23
+  800790:	68 4c 3b 80 00       	push   $0x803b4c
+  800795:	e8 ae 26 00 00       	call   802e48 <_panic>
+
+0080079a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80079a:	55                   	push   %ebp
+  80079b:	89 e5                	mov    %esp,%ebp
+  80079d:	57                   	push   %edi
+  80079e:	56                   	push   %esi
+  80079f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8007a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007a6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8007ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8007b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007b6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8007b8:	5b                   	pop    %ebx
+  8007b9:	5e                   	pop    %esi
+  8007ba:	5f                   	pop    %edi
+  8007bb:	5d                   	pop    %ebp
+  8007bc:	c3                   	ret
+
+008007bd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8007bd:	55                   	push   %ebp
+  8007be:	89 e5                	mov    %esp,%ebp
+  8007c0:	57                   	push   %edi
+  8007c1:	56                   	push   %esi
+  8007c2:	53                   	push   %ebx
+  8007c3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8007c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8007d3:	89 cb                	mov    %ecx,%ebx
+  8007d5:	89 cf                	mov    %ecx,%edi
+  8007d7:	89 ce                	mov    %ecx,%esi
+  8007d9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8007db:	85 c0                	test   %eax,%eax
+  8007dd:	7f 08                	jg     8007e7 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8007df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e2:	5b                   	pop    %ebx
+  8007e3:	5e                   	pop    %esi
+  8007e4:	5f                   	pop    %edi
+  8007e5:	5d                   	pop    %ebp
+  8007e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007e7:	83 ec 0c             	sub    $0xc,%esp
+  8007ea:	50                   	push   %eax
+  8007eb:	6a 0d                	push   $0xd
+  8007ed:	68 2f 3b 80 00       	push   $0x803b2f
+  8007f2:	6a 23                	push   $0x23
+  8007f4:	68 4c 3b 80 00       	push   $0x803b4c
+  8007f9:	e8 4a 26 00 00       	call   802e48 <_panic>
+
+008007fe <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	57                   	push   %edi
+  800802:	56                   	push   %esi
+  800803:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800804:	8b 55 08             	mov    0x8(%ebp),%edx
+  800807:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80080a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80080f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800812:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800815:	8b 75 18             	mov    0x18(%ebp),%esi
+  800818:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80081a:	5b                   	pop    %ebx
+  80081b:	5e                   	pop    %esi
+  80081c:	5f                   	pop    %edi
+  80081d:	5d                   	pop    %ebp
+  80081e:	c3                   	ret
+
+0080081f <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80081f:	55                   	push   %ebp
+  800820:	89 e5                	mov    %esp,%ebp
+  800822:	57                   	push   %edi
+  800823:	56                   	push   %esi
+  800824:	53                   	push   %ebx
+  800825:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800828:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80082d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800830:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800833:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800838:	89 df                	mov    %ebx,%edi
+  80083a:	89 de                	mov    %ebx,%esi
+  80083c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80083e:	85 c0                	test   %eax,%eax
+  800840:	7f 08                	jg     80084a <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800842:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800845:	5b                   	pop    %ebx
+  800846:	5e                   	pop    %esi
+  800847:	5f                   	pop    %edi
+  800848:	5d                   	pop    %ebp
+  800849:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80084a:	83 ec 0c             	sub    $0xc,%esp
+  80084d:	50                   	push   %eax
+  80084e:	6a 0d                	push   $0xd
+  800850:	68 2f 3b 80 00       	push   $0x803b2f
+  800855:	6a 23                	push   $0x23
+  800857:	68 4c 3b 80 00       	push   $0x803b4c
+  80085c:	e8 e7 25 00 00       	call   802e48 <_panic>
+
+00800861 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	57                   	push   %edi
+  800865:	56                   	push   %esi
+  800866:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800867:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800871:	89 d1                	mov    %edx,%ecx
+  800873:	89 d3                	mov    %edx,%ebx
+  800875:	89 d7                	mov    %edx,%edi
+  800877:	89 d6                	mov    %edx,%esi
+  800879:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80087b:	5b                   	pop    %ebx
+  80087c:	5e                   	pop    %esi
+  80087d:	5f                   	pop    %edi
+  80087e:	5d                   	pop    %ebp
+  80087f:	c3                   	ret
+
+00800880 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800880:	55                   	push   %ebp
+  800881:	89 e5                	mov    %esp,%ebp
+  800883:	57                   	push   %edi
+  800884:	56                   	push   %esi
+  800885:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800886:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80088b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80088e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800891:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800896:	89 df                	mov    %ebx,%edi
+  800898:	89 de                	mov    %ebx,%esi
+  80089a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80089c:	5b                   	pop    %ebx
+  80089d:	5e                   	pop    %esi
+  80089e:	5f                   	pop    %edi
+  80089f:	5d                   	pop    %ebp
+  8008a0:	c3                   	ret
+
+008008a1 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	57                   	push   %edi
+  8008a5:	56                   	push   %esi
+  8008a6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8008a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008af:	b8 10 00 00 00       	mov    $0x10,%eax
+  8008b4:	89 cb                	mov    %ecx,%ebx
+  8008b6:	89 cf                	mov    %ecx,%edi
+  8008b8:	89 ce                	mov    %ecx,%esi
+  8008ba:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8008bc:	5b                   	pop    %ebx
+  8008bd:	5e                   	pop    %esi
+  8008be:	5f                   	pop    %edi
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+
+008008c1 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8008c1:	55                   	push   %ebp
+  8008c2:	89 e5                	mov    %esp,%ebp
+  8008c4:	57                   	push   %edi
+  8008c5:	56                   	push   %esi
+  8008c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8008c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008d7:	89 df                	mov    %ebx,%edi
+  8008d9:	89 de                	mov    %ebx,%esi
+  8008db:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8008dd:	5b                   	pop    %ebx
+  8008de:	5e                   	pop    %esi
+  8008df:	5f                   	pop    %edi
+  8008e0:	5d                   	pop    %ebp
+  8008e1:	c3                   	ret
+
+008008e2 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8008e2:	55                   	push   %ebp
+  8008e3:	89 e5                	mov    %esp,%ebp
+  8008e5:	57                   	push   %edi
+  8008e6:	56                   	push   %esi
+  8008e7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8008e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8008f8:	89 df                	mov    %ebx,%edi
+  8008fa:	89 de                	mov    %ebx,%esi
+  8008fc:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8008fe:	5b                   	pop    %ebx
+  8008ff:	5e                   	pop    %esi
+  800900:	5f                   	pop    %edi
+  800901:	5d                   	pop    %ebp
+  800902:	c3                   	ret
+
+00800903 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	57                   	push   %edi
+  800907:	56                   	push   %esi
+  800908:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800909:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80090e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800911:	b8 13 00 00 00       	mov    $0x13,%eax
+  800916:	89 cb                	mov    %ecx,%ebx
+  800918:	89 cf                	mov    %ecx,%edi
+  80091a:	89 ce                	mov    %ecx,%esi
+  80091c:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80091e:	5b                   	pop    %ebx
+  80091f:	5e                   	pop    %esi
+  800920:	5f                   	pop    %edi
+  800921:	5d                   	pop    %ebp
+  800922:	c3                   	ret
+
+00800923 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	57                   	push   %edi
+  800927:	56                   	push   %esi
+  800928:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800929:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80092e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800931:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800934:	b8 14 00 00 00       	mov    $0x14,%eax
+  800939:	89 df                	mov    %ebx,%edi
+  80093b:	89 de                	mov    %ebx,%esi
+  80093d:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80093f:	5b                   	pop    %ebx
+  800940:	5e                   	pop    %esi
+  800941:	5f                   	pop    %edi
+  800942:	5d                   	pop    %ebp
+  800943:	c3                   	ret
+
+00800944 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	57                   	push   %edi
+  800948:	56                   	push   %esi
+  800949:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80094a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800952:	b8 15 00 00 00       	mov    $0x15,%eax
+  800957:	89 cb                	mov    %ecx,%ebx
+  800959:	89 cf                	mov    %ecx,%edi
+  80095b:	89 ce                	mov    %ecx,%esi
+  80095d:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80095f:	5b                   	pop    %ebx
+  800960:	5e                   	pop    %esi
+  800961:	5f                   	pop    %edi
+  800962:	5d                   	pop    %ebp
+  800963:	c3                   	ret
+
+00800964 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	57                   	push   %edi
+  800968:	56                   	push   %esi
+  800969:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80096a:	be 00 00 00 00       	mov    $0x0,%esi
+  80096f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800972:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800975:	b8 16 00 00 00       	mov    $0x16,%eax
+  80097a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80097d:	89 f7                	mov    %esi,%edi
+  80097f:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  800981:	5b                   	pop    %ebx
+  800982:	5e                   	pop    %esi
+  800983:	5f                   	pop    %edi
+  800984:	5d                   	pop    %ebp
+  800985:	c3                   	ret
+
+00800986 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	57                   	push   %edi
+  80098a:	56                   	push   %esi
+  80098b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80098c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800991:	8b 55 08             	mov    0x8(%ebp),%edx
+  800994:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800997:	b8 17 00 00 00       	mov    $0x17,%eax
+  80099c:	89 df                	mov    %ebx,%edi
+  80099e:	89 de                	mov    %ebx,%esi
+  8009a0:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8009a2:	5b                   	pop    %ebx
+  8009a3:	5e                   	pop    %esi
+  8009a4:	5f                   	pop    %edi
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+
+008009a7 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	57                   	push   %edi
+  8009ab:	56                   	push   %esi
+  8009ac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009b5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8009ba:	89 cb                	mov    %ecx,%ebx
+  8009bc:	89 cf                	mov    %ecx,%edi
+  8009be:	89 ce                	mov    %ecx,%esi
+  8009c0:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8009c2:	5b                   	pop    %ebx
+  8009c3:	5e                   	pop    %esi
+  8009c4:	5f                   	pop    %edi
+  8009c5:	5d                   	pop    %ebp
+  8009c6:	c3                   	ret
+
+008009c7 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8009c7:	55                   	push   %ebp
+  8009c8:	89 e5                	mov    %esp,%ebp
+  8009ca:	57                   	push   %edi
+  8009cb:	56                   	push   %esi
+  8009cc:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8009cd:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8009d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8009de:	89 df                	mov    %ebx,%edi
+  8009e0:	89 de                	mov    %ebx,%esi
+  8009e2:	cd 30                	int    $0x30
+}
+  8009e4:	5b                   	pop    %ebx
+  8009e5:	5e                   	pop    %esi
+  8009e6:	5f                   	pop    %edi
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+
+008009e9 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	57                   	push   %edi
+  8009ed:	56                   	push   %esi
+  8009ee:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009fa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8009ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a02:	89 f7                	mov    %esi,%edi
+  800a04:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  800a06:	5b                   	pop    %ebx
+  800a07:	5e                   	pop    %esi
+  800a08:	5f                   	pop    %edi
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+
+00800a0b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	57                   	push   %edi
+  800a0f:	56                   	push   %esi
+  800a10:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a11:	be 00 00 00 00       	mov    $0x0,%esi
+  800a16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a1c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800a21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a24:	89 f7                	mov    %esi,%edi
+  800a26:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  800a28:	5b                   	pop    %ebx
+  800a29:	5e                   	pop    %esi
+  800a2a:	5f                   	pop    %edi
+  800a2b:	5d                   	pop    %ebp
+  800a2c:	c3                   	ret
+
+00800a2d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	57                   	push   %edi
+  800a31:	56                   	push   %esi
+  800a32:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a3e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800a43:	89 df                	mov    %ebx,%edi
+  800a45:	89 de                	mov    %ebx,%esi
+  800a47:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  800a49:	5b                   	pop    %ebx
+  800a4a:	5e                   	pop    %esi
+  800a4b:	5f                   	pop    %edi
+  800a4c:	5d                   	pop    %ebp
+  800a4d:	c3                   	ret
+
+00800a4e <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  800a4e:	55                   	push   %ebp
+  800a4f:	89 e5                	mov    %esp,%ebp
+  800a51:	57                   	push   %edi
+  800a52:	56                   	push   %esi
+  800a53:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a54:	be 00 00 00 00       	mov    $0x0,%esi
+  800a59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a5f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800a64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a67:	89 f7                	mov    %esi,%edi
+  800a69:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  800a6b:	5b                   	pop    %ebx
+  800a6c:	5e                   	pop    %esi
+  800a6d:	5f                   	pop    %edi
+  800a6e:	5d                   	pop    %ebp
+  800a6f:	c3                   	ret
+
+00800a70 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800a73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a76:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a7b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800a7e:	5d                   	pop    %ebp
+  800a7f:	c3                   	ret
+
+00800a80 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800a80:	55                   	push   %ebp
+  800a81:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a86:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800a8b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a90:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800a95:	5d                   	pop    %ebp
+  800a96:	c3                   	ret
+
+00800a97 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  800a9f:	89 c2                	mov    %eax,%edx
+  800aa1:	c1 ea 16             	shr    $0x16,%edx
+  800aa4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800aab:	f6 c2 01             	test   $0x1,%dl
+  800aae:	74 29                	je     800ad9 <fd_alloc+0x42>
+  800ab0:	89 c2                	mov    %eax,%edx
+  800ab2:	c1 ea 0c             	shr    $0xc,%edx
+  800ab5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800abc:	f6 c2 01             	test   $0x1,%dl
+  800abf:	74 18                	je     800ad9 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800ac1:	05 00 10 00 00       	add    $0x1000,%eax
+  800ac6:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  800acb:	75 d2                	jne    800a9f <fd_alloc+0x8>
+  800acd:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800ad2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800ad7:	eb 05                	jmp    800ade <fd_alloc+0x47>
+			return 0;
+  800ad9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800ade:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae1:	89 02                	mov    %eax,(%edx)
+}
+  800ae3:	89 c8                	mov    %ecx,%eax
+  800ae5:	5d                   	pop    %ebp
+  800ae6:	c3                   	ret
+
+00800ae7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800ae7:	55                   	push   %ebp
+  800ae8:	89 e5                	mov    %esp,%ebp
+  800aea:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800aed:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800af2:	77 30                	ja     800b24 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800af4:	c1 e0 0c             	shl    $0xc,%eax
+  800af7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  800afc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800b02:	f6 c2 01             	test   $0x1,%dl
+  800b05:	74 24                	je     800b2b <fd_lookup+0x44>
+  800b07:	89 c2                	mov    %eax,%edx
+  800b09:	c1 ea 0c             	shr    $0xc,%edx
+  800b0c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800b13:	f6 c2 01             	test   $0x1,%dl
+  800b16:	74 1a                	je     800b32 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800b18:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b1b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b22:	5d                   	pop    %ebp
+  800b23:	c3                   	ret
+		return -E_INVAL;
+  800b24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b29:	eb f7                	jmp    800b22 <fd_lookup+0x3b>
+		return -E_INVAL;
+  800b2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b30:	eb f0                	jmp    800b22 <fd_lookup+0x3b>
+  800b32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b37:	eb e9                	jmp    800b22 <fd_lookup+0x3b>
+
+00800b39 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	53                   	push   %ebx
+  800b3d:	83 ec 04             	sub    $0x4,%esp
+  800b40:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b48:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  800b4d:	39 13                	cmp    %edx,(%ebx)
+  800b4f:	74 54                	je     800ba5 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  800b51:	83 c0 01             	add    $0x1,%eax
+  800b54:	8b 1c 85 d8 3b 80 00 	mov    0x803bd8(,%eax,4),%ebx
+  800b5b:	85 db                	test   %ebx,%ebx
+  800b5d:	75 ee                	jne    800b4d <dev_lookup+0x14>
+  800b5f:	89 e1                	mov    %esp,%ecx
+  800b61:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b66:	29 c8                	sub    %ecx,%eax
+  800b68:	89 c1                	mov    %eax,%ecx
+  800b6a:	c1 e9 0f             	shr    $0xf,%ecx
+  800b6d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b77:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b7a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  800b81:	8b 40 48             	mov    0x48(%eax),%eax
+  800b84:	83 ec 04             	sub    $0x4,%esp
+  800b87:	52                   	push   %edx
+  800b88:	50                   	push   %eax
+  800b89:	68 5c 3b 80 00       	push   $0x803b5c
+  800b8e:	e8 90 23 00 00       	call   802f23 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800b9b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b9e:	89 1a                	mov    %ebx,(%edx)
+}
+  800ba0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba3:	c9                   	leave
+  800ba4:	c3                   	ret
+			return 0;
+  800ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800baa:	eb ef                	jmp    800b9b <dev_lookup+0x62>
+
+00800bac <fd_close>:
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	57                   	push   %edi
+  800bb0:	56                   	push   %esi
+  800bb1:	53                   	push   %ebx
+  800bb2:	83 ec 24             	sub    $0x24,%esp
+  800bb5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bb8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800bbb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800bbe:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800bbf:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800bc5:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800bc8:	50                   	push   %eax
+  800bc9:	e8 19 ff ff ff       	call   800ae7 <fd_lookup>
+  800bce:	89 c3                	mov    %eax,%ebx
+  800bd0:	83 c4 10             	add    $0x10,%esp
+  800bd3:	85 c0                	test   %eax,%eax
+  800bd5:	78 05                	js     800bdc <fd_close+0x30>
+	    || fd != fd2)
+  800bd7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800bda:	74 0f                	je     800beb <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  800bdc:	85 ff                	test   %edi,%edi
+  800bde:	0f 44 df             	cmove  %edi,%ebx
+}
+  800be1:	89 d8                	mov    %ebx,%eax
+  800be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be6:	5b                   	pop    %ebx
+  800be7:	5e                   	pop    %esi
+  800be8:	5f                   	pop    %edi
+  800be9:	5d                   	pop    %ebp
+  800bea:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800beb:	83 ec 08             	sub    $0x8,%esp
+  800bee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800bf1:	50                   	push   %eax
+  800bf2:	ff 36                	push   (%esi)
+  800bf4:	e8 40 ff ff ff       	call   800b39 <dev_lookup>
+  800bf9:	89 c3                	mov    %eax,%ebx
+  800bfb:	83 c4 10             	add    $0x10,%esp
+  800bfe:	85 c0                	test   %eax,%eax
+  800c00:	78 1a                	js     800c1c <fd_close+0x70>
+		if (dev->dev_close)
+  800c02:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c05:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800c08:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800c0d:	85 c0                	test   %eax,%eax
+  800c0f:	74 0b                	je     800c1c <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  800c11:	83 ec 0c             	sub    $0xc,%esp
+  800c14:	56                   	push   %esi
+  800c15:	ff d0                	call   *%eax
+  800c17:	89 c3                	mov    %eax,%ebx
+  800c19:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800c1c:	83 ec 08             	sub    $0x8,%esp
+  800c1f:	56                   	push   %esi
+  800c20:	6a 00                	push   $0x0
+  800c22:	e8 6b fa ff ff       	call   800692 <sys_page_unmap>
+	return r;
+  800c27:	83 c4 10             	add    $0x10,%esp
+  800c2a:	eb b5                	jmp    800be1 <fd_close+0x35>
+
+00800c2c <close>:
+
+int
+close(int fdnum)
+{
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800c32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c35:	50                   	push   %eax
+  800c36:	ff 75 08             	push   0x8(%ebp)
+  800c39:	e8 a9 fe ff ff       	call   800ae7 <fd_lookup>
+  800c3e:	83 c4 10             	add    $0x10,%esp
+  800c41:	85 c0                	test   %eax,%eax
+  800c43:	79 02                	jns    800c47 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800c45:	c9                   	leave
+  800c46:	c3                   	ret
+		return fd_close(fd, 1);
+  800c47:	83 ec 08             	sub    $0x8,%esp
+  800c4a:	6a 01                	push   $0x1
+  800c4c:	ff 75 f4             	push   -0xc(%ebp)
+  800c4f:	e8 58 ff ff ff       	call   800bac <fd_close>
+  800c54:	83 c4 10             	add    $0x10,%esp
+  800c57:	eb ec                	jmp    800c45 <close+0x19>
+
+00800c59 <close_all>:
+
+void
+close_all(void)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	53                   	push   %ebx
+  800c5d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800c60:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800c65:	83 ec 0c             	sub    $0xc,%esp
+  800c68:	53                   	push   %ebx
+  800c69:	e8 be ff ff ff       	call   800c2c <close>
+	for (i = 0; i < MAXFD; i++)
+  800c6e:	83 c3 01             	add    $0x1,%ebx
+  800c71:	83 c4 10             	add    $0x10,%esp
+  800c74:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800c7a:	75 e9                	jne    800c65 <close_all+0xc>
+}
+  800c7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c7f:	c9                   	leave
+  800c80:	c3                   	ret
+
+00800c81 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	57                   	push   %edi
+  800c85:	56                   	push   %esi
+  800c86:	53                   	push   %ebx
+  800c87:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800c8a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c8d:	50                   	push   %eax
+  800c8e:	ff 75 08             	push   0x8(%ebp)
+  800c91:	e8 51 fe ff ff       	call   800ae7 <fd_lookup>
+  800c96:	89 c3                	mov    %eax,%ebx
+  800c98:	83 c4 10             	add    $0x10,%esp
+  800c9b:	85 c0                	test   %eax,%eax
+  800c9d:	78 7f                	js     800d1e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800c9f:	83 ec 0c             	sub    $0xc,%esp
+  800ca2:	ff 75 0c             	push   0xc(%ebp)
+  800ca5:	e8 82 ff ff ff       	call   800c2c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800caa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cad:	c1 e6 0c             	shl    $0xc,%esi
+  800cb0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800cb6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cb9:	89 3c 24             	mov    %edi,(%esp)
+  800cbc:	e8 bf fd ff ff       	call   800a80 <fd2data>
+  800cc1:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800cc3:	89 34 24             	mov    %esi,(%esp)
+  800cc6:	e8 b5 fd ff ff       	call   800a80 <fd2data>
+  800ccb:	83 c4 10             	add    $0x10,%esp
+  800cce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  800cd1:	89 d8                	mov    %ebx,%eax
+  800cd3:	c1 e8 16             	shr    $0x16,%eax
+  800cd6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800cdd:	a8 01                	test   $0x1,%al
+  800cdf:	74 11                	je     800cf2 <dup+0x71>
+  800ce1:	89 d8                	mov    %ebx,%eax
+  800ce3:	c1 e8 0c             	shr    $0xc,%eax
+  800ce6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800ced:	f6 c2 01             	test   $0x1,%dl
+  800cf0:	75 36                	jne    800d28 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800cf2:	89 f8                	mov    %edi,%eax
+  800cf4:	c1 e8 0c             	shr    $0xc,%eax
+  800cf7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+  800d01:	25 07 0e 00 00       	and    $0xe07,%eax
+  800d06:	50                   	push   %eax
+  800d07:	56                   	push   %esi
+  800d08:	6a 00                	push   $0x0
+  800d0a:	57                   	push   %edi
+  800d0b:	6a 00                	push   $0x0
+  800d0d:	e8 3e f9 ff ff       	call   800650 <sys_page_map>
+  800d12:	89 c3                	mov    %eax,%ebx
+  800d14:	83 c4 20             	add    $0x20,%esp
+  800d17:	85 c0                	test   %eax,%eax
+  800d19:	78 33                	js     800d4e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800d1b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800d1e:	89 d8                	mov    %ebx,%eax
+  800d20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d23:	5b                   	pop    %ebx
+  800d24:	5e                   	pop    %esi
+  800d25:	5f                   	pop    %edi
+  800d26:	5d                   	pop    %ebp
+  800d27:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800d28:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800d2f:	83 ec 0c             	sub    $0xc,%esp
+  800d32:	25 07 0e 00 00       	and    $0xe07,%eax
+  800d37:	50                   	push   %eax
+  800d38:	ff 75 d4             	push   -0x2c(%ebp)
+  800d3b:	6a 00                	push   $0x0
+  800d3d:	53                   	push   %ebx
+  800d3e:	6a 00                	push   $0x0
+  800d40:	e8 0b f9 ff ff       	call   800650 <sys_page_map>
+  800d45:	89 c3                	mov    %eax,%ebx
+  800d47:	83 c4 20             	add    $0x20,%esp
+  800d4a:	85 c0                	test   %eax,%eax
+  800d4c:	79 a4                	jns    800cf2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800d4e:	83 ec 08             	sub    $0x8,%esp
+  800d51:	56                   	push   %esi
+  800d52:	6a 00                	push   $0x0
+  800d54:	e8 39 f9 ff ff       	call   800692 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800d59:	83 c4 08             	add    $0x8,%esp
+  800d5c:	ff 75 d4             	push   -0x2c(%ebp)
+  800d5f:	6a 00                	push   $0x0
+  800d61:	e8 2c f9 ff ff       	call   800692 <sys_page_unmap>
+	return r;
+  800d66:	83 c4 10             	add    $0x10,%esp
+  800d69:	eb b3                	jmp    800d1e <dup+0x9d>
+
+00800d6b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	56                   	push   %esi
+  800d6f:	53                   	push   %ebx
+  800d70:	83 ec 18             	sub    $0x18,%esp
+  800d73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800d76:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d79:	50                   	push   %eax
+  800d7a:	53                   	push   %ebx
+  800d7b:	e8 67 fd ff ff       	call   800ae7 <fd_lookup>
+  800d80:	83 c4 10             	add    $0x10,%esp
+  800d83:	85 c0                	test   %eax,%eax
+  800d85:	78 3c                	js     800dc3 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800d87:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800d8a:	83 ec 08             	sub    $0x8,%esp
+  800d8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d90:	50                   	push   %eax
+  800d91:	ff 36                	push   (%esi)
+  800d93:	e8 a1 fd ff ff       	call   800b39 <dev_lookup>
+  800d98:	83 c4 10             	add    $0x10,%esp
+  800d9b:	85 c0                	test   %eax,%eax
+  800d9d:	78 24                	js     800dc3 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800d9f:	8b 46 08             	mov    0x8(%esi),%eax
+  800da2:	83 e0 03             	and    $0x3,%eax
+  800da5:	83 f8 01             	cmp    $0x1,%eax
+  800da8:	74 20                	je     800dca <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800daa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800dad:	8b 40 08             	mov    0x8(%eax),%eax
+  800db0:	85 c0                	test   %eax,%eax
+  800db2:	74 54                	je     800e08 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800db4:	83 ec 04             	sub    $0x4,%esp
+  800db7:	ff 75 10             	push   0x10(%ebp)
+  800dba:	ff 75 0c             	push   0xc(%ebp)
+  800dbd:	56                   	push   %esi
+  800dbe:	ff d0                	call   *%eax
+  800dc0:	83 c4 10             	add    $0x10,%esp
+}
+  800dc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+  800dca:	89 e2                	mov    %esp,%edx
+  800dcc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800dd1:	29 d0                	sub    %edx,%eax
+  800dd3:	89 c2                	mov    %eax,%edx
+  800dd5:	c1 ea 0f             	shr    $0xf,%edx
+  800dd8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de2:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800de5:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  800dec:	8b 40 48             	mov    0x48(%eax),%eax
+  800def:	83 ec 04             	sub    $0x4,%esp
+  800df2:	53                   	push   %ebx
+  800df3:	50                   	push   %eax
+  800df4:	68 9d 3b 80 00       	push   $0x803b9d
+  800df9:	e8 25 21 00 00       	call   802f23 <cprintf>
+		return -E_INVAL;
+  800dfe:	83 c4 10             	add    $0x10,%esp
+  800e01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e06:	eb bb                	jmp    800dc3 <read+0x58>
+		return -E_NOT_SUPP;
+  800e08:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e0d:	eb b4                	jmp    800dc3 <read+0x58>
+
+00800e0f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	57                   	push   %edi
+  800e13:	56                   	push   %esi
+  800e14:	53                   	push   %ebx
+  800e15:	83 ec 0c             	sub    $0xc,%esp
+  800e18:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e1b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800e1e:	85 f6                	test   %esi,%esi
+  800e20:	74 30                	je     800e52 <readn+0x43>
+  800e22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e27:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800e2c:	83 ec 04             	sub    $0x4,%esp
+  800e2f:	89 f2                	mov    %esi,%edx
+  800e31:	29 c2                	sub    %eax,%edx
+  800e33:	52                   	push   %edx
+  800e34:	01 f8                	add    %edi,%eax
+  800e36:	50                   	push   %eax
+  800e37:	ff 75 08             	push   0x8(%ebp)
+  800e3a:	e8 2c ff ff ff       	call   800d6b <read>
+		if (m < 0)
+  800e3f:	83 c4 10             	add    $0x10,%esp
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	78 15                	js     800e5b <readn+0x4c>
+			return m;
+		if (m == 0)
+  800e46:	74 11                	je     800e59 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  800e48:	01 c3                	add    %eax,%ebx
+  800e4a:	89 d8                	mov    %ebx,%eax
+  800e4c:	39 f3                	cmp    %esi,%ebx
+  800e4e:	72 dc                	jb     800e2c <readn+0x1d>
+  800e50:	eb 09                	jmp    800e5b <readn+0x4c>
+  800e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e57:	eb 02                	jmp    800e5b <readn+0x4c>
+  800e59:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  800e5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5f                   	pop    %edi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+
+00800e63 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 18             	sub    $0x18,%esp
+  800e6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800e6e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e71:	50                   	push   %eax
+  800e72:	53                   	push   %ebx
+  800e73:	e8 6f fc ff ff       	call   800ae7 <fd_lookup>
+  800e78:	83 c4 10             	add    $0x10,%esp
+  800e7b:	85 c0                	test   %eax,%eax
+  800e7d:	78 37                	js     800eb6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800e7f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e82:	83 ec 08             	sub    $0x8,%esp
+  800e85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e88:	50                   	push   %eax
+  800e89:	ff 36                	push   (%esi)
+  800e8b:	e8 a9 fc ff ff       	call   800b39 <dev_lookup>
+  800e90:	83 c4 10             	add    $0x10,%esp
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	78 1f                	js     800eb6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800e97:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e9b:	74 20                	je     800ebd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea0:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ea3:	85 c0                	test   %eax,%eax
+  800ea5:	74 54                	je     800efb <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800ea7:	83 ec 04             	sub    $0x4,%esp
+  800eaa:	ff 75 10             	push   0x10(%ebp)
+  800ead:	ff 75 0c             	push   0xc(%ebp)
+  800eb0:	56                   	push   %esi
+  800eb1:	ff d0                	call   *%eax
+  800eb3:	83 c4 10             	add    $0x10,%esp
+}
+  800eb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	c3                   	ret
+  800ebd:	89 e2                	mov    %esp,%edx
+  800ebf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800ec4:	29 d0                	sub    %edx,%eax
+  800ec6:	89 c2                	mov    %eax,%edx
+  800ec8:	c1 ea 0f             	shr    $0xf,%edx
+  800ecb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed5:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ed8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  800edf:	8b 40 48             	mov    0x48(%eax),%eax
+  800ee2:	83 ec 04             	sub    $0x4,%esp
+  800ee5:	53                   	push   %ebx
+  800ee6:	50                   	push   %eax
+  800ee7:	68 b9 3b 80 00       	push   $0x803bb9
+  800eec:	e8 32 20 00 00       	call   802f23 <cprintf>
+		return -E_INVAL;
+  800ef1:	83 c4 10             	add    $0x10,%esp
+  800ef4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef9:	eb bb                	jmp    800eb6 <write+0x53>
+		return -E_NOT_SUPP;
+  800efb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f00:	eb b4                	jmp    800eb6 <write+0x53>
+
+00800f02 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800f08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f0b:	50                   	push   %eax
+  800f0c:	ff 75 08             	push   0x8(%ebp)
+  800f0f:	e8 d3 fb ff ff       	call   800ae7 <fd_lookup>
+  800f14:	83 c4 10             	add    $0x10,%esp
+  800f17:	85 c0                	test   %eax,%eax
+  800f19:	78 0e                	js     800f29 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800f1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f21:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800f24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f29:	c9                   	leave
+  800f2a:	c3                   	ret
+
+00800f2b <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	53                   	push   %ebx
+  800f2f:	83 ec 1c             	sub    $0x1c,%esp
+  800f32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800f35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f38:	50                   	push   %eax
+  800f39:	ff 75 08             	push   0x8(%ebp)
+  800f3c:	e8 a6 fb ff ff       	call   800ae7 <fd_lookup>
+  800f41:	83 c4 10             	add    $0x10,%esp
+  800f44:	85 c0                	test   %eax,%eax
+  800f46:	78 33                	js     800f7b <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800f48:	83 fb 03             	cmp    $0x3,%ebx
+  800f4b:	74 28                	je     800f75 <fcntl+0x4a>
+  800f4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f52:	83 fb 04             	cmp    $0x4,%ebx
+  800f55:	75 24                	jne    800f7b <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800f57:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800f5a:	8b 41 08             	mov    0x8(%ecx),%eax
+  800f5d:	80 e4 ef             	and    $0xef,%ah
+  800f60:	8b 55 10             	mov    0x10(%ebp),%edx
+  800f63:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800f69:	09 d0                	or     %edx,%eax
+  800f6b:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f73:	eb 06                	jmp    800f7b <fcntl+0x50>
+		return fd->fd_omode;
+  800f75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f78:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800f7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f7e:	c9                   	leave
+  800f7f:	c3                   	ret
+
+00800f80 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	56                   	push   %esi
+  800f84:	53                   	push   %ebx
+  800f85:	83 ec 18             	sub    $0x18,%esp
+  800f88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800f8b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f8e:	50                   	push   %eax
+  800f8f:	53                   	push   %ebx
+  800f90:	e8 52 fb ff ff       	call   800ae7 <fd_lookup>
+  800f95:	83 c4 10             	add    $0x10,%esp
+  800f98:	85 c0                	test   %eax,%eax
+  800f9a:	78 34                	js     800fd0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800f9c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f9f:	83 ec 08             	sub    $0x8,%esp
+  800fa2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fa5:	50                   	push   %eax
+  800fa6:	ff 36                	push   (%esi)
+  800fa8:	e8 8c fb ff ff       	call   800b39 <dev_lookup>
+  800fad:	83 c4 10             	add    $0x10,%esp
+  800fb0:	85 c0                	test   %eax,%eax
+  800fb2:	78 1c                	js     800fd0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800fb4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800fb8:	74 1d                	je     800fd7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800fba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800fbd:	8b 40 18             	mov    0x18(%eax),%eax
+  800fc0:	85 c0                	test   %eax,%eax
+  800fc2:	74 51                	je     801015 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800fc4:	83 ec 08             	sub    $0x8,%esp
+  800fc7:	ff 75 0c             	push   0xc(%ebp)
+  800fca:	56                   	push   %esi
+  800fcb:	ff d0                	call   *%eax
+  800fcd:	83 c4 10             	add    $0x10,%esp
+}
+  800fd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd3:	5b                   	pop    %ebx
+  800fd4:	5e                   	pop    %esi
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	c3                   	ret
+  800fd7:	89 e2                	mov    %esp,%edx
+  800fd9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800fde:	29 d0                	sub    %edx,%eax
+  800fe0:	89 c2                	mov    %eax,%edx
+  800fe2:	c1 ea 0f             	shr    $0xf,%edx
+  800fe5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800fea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fef:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800ff2:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  800ff9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ffc:	83 ec 04             	sub    $0x4,%esp
+  800fff:	53                   	push   %ebx
+  801000:	50                   	push   %eax
+  801001:	68 7c 3b 80 00       	push   $0x803b7c
+  801006:	e8 18 1f 00 00       	call   802f23 <cprintf>
+		return -E_INVAL;
+  80100b:	83 c4 10             	add    $0x10,%esp
+  80100e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801013:	eb bb                	jmp    800fd0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801015:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80101a:	eb b4                	jmp    800fd0 <ftruncate+0x50>
+
+0080101c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 18             	sub    $0x18,%esp
+  801024:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801027:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80102a:	50                   	push   %eax
+  80102b:	ff 75 08             	push   0x8(%ebp)
+  80102e:	e8 b4 fa ff ff       	call   800ae7 <fd_lookup>
+  801033:	83 c4 10             	add    $0x10,%esp
+  801036:	85 c0                	test   %eax,%eax
+  801038:	78 53                	js     80108d <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80103a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80103d:	83 ec 08             	sub    $0x8,%esp
+  801040:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801043:	50                   	push   %eax
+  801044:	ff 36                	push   (%esi)
+  801046:	e8 ee fa ff ff       	call   800b39 <dev_lookup>
+  80104b:	83 c4 10             	add    $0x10,%esp
+  80104e:	85 c0                	test   %eax,%eax
+  801050:	78 3b                	js     80108d <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801052:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801055:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801059:	74 39                	je     801094 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80105b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80105e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801065:	00 00 00 
+	stat->st_isdir = 0;
+  801068:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80106f:	00 00 00 
+	stat->st_version = 0;
+  801072:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801079:	00 00 00 
+	stat->st_dev = dev;
+  80107c:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801082:	83 ec 08             	sub    $0x8,%esp
+  801085:	53                   	push   %ebx
+  801086:	56                   	push   %esi
+  801087:	ff 50 14             	call   *0x14(%eax)
+  80108a:	83 c4 10             	add    $0x10,%esp
+}
+  80108d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5d                   	pop    %ebp
+  801093:	c3                   	ret
+		return -E_NOT_SUPP;
+  801094:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801099:	eb f2                	jmp    80108d <fstat+0x71>
+
+0080109b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	56                   	push   %esi
+  80109f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8010a0:	83 ec 08             	sub    $0x8,%esp
+  8010a3:	6a 00                	push   $0x0
+  8010a5:	ff 75 08             	push   0x8(%ebp)
+  8010a8:	e8 b7 01 00 00       	call   801264 <open>
+  8010ad:	89 c3                	mov    %eax,%ebx
+  8010af:	83 c4 10             	add    $0x10,%esp
+  8010b2:	85 c0                	test   %eax,%eax
+  8010b4:	78 1b                	js     8010d1 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8010b6:	83 ec 08             	sub    $0x8,%esp
+  8010b9:	ff 75 0c             	push   0xc(%ebp)
+  8010bc:	50                   	push   %eax
+  8010bd:	e8 5a ff ff ff       	call   80101c <fstat>
+  8010c2:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8010c4:	89 1c 24             	mov    %ebx,(%esp)
+  8010c7:	e8 60 fb ff ff       	call   800c2c <close>
+	return r;
+  8010cc:	83 c4 10             	add    $0x10,%esp
+  8010cf:	89 f3                	mov    %esi,%ebx
+}
+  8010d1:	89 d8                	mov    %ebx,%eax
+  8010d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+
+008010da <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	56                   	push   %esi
+  8010de:	53                   	push   %ebx
+  8010df:	89 c6                	mov    %eax,%esi
+  8010e1:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8010e3:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8010ea:	74 27                	je     801113 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8010ec:	6a 07                	push   $0x7
+  8010ee:	68 00 70 80 00       	push   $0x807000
+  8010f3:	56                   	push   %esi
+  8010f4:	ff 35 00 60 80 00    	push   0x806000
+  8010fa:	e8 5f 27 00 00       	call   80385e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8010ff:	83 c4 0c             	add    $0xc,%esp
+  801102:	6a 00                	push   $0x0
+  801104:	53                   	push   %ebx
+  801105:	6a 00                	push   $0x0
+  801107:	e8 c2 24 00 00       	call   8035ce <ipc_recv>
+}
+  80110c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801113:	83 ec 0c             	sub    $0xc,%esp
+  801116:	6a 02                	push   $0x2
+  801118:	e8 aa 27 00 00       	call   8038c7 <ipc_find_env>
+  80111d:	a3 00 60 80 00       	mov    %eax,0x806000
+  801122:	83 c4 10             	add    $0x10,%esp
+  801125:	eb c5                	jmp    8010ec <fsipc+0x12>
+
+00801127 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80112d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801130:	8b 40 0c             	mov    0xc(%eax),%eax
+  801133:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801138:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80113b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801140:	ba 00 00 00 00       	mov    $0x0,%edx
+  801145:	b8 02 00 00 00       	mov    $0x2,%eax
+  80114a:	e8 8b ff ff ff       	call   8010da <fsipc>
+}
+  80114f:	c9                   	leave
+  801150:	c3                   	ret
+
+00801151 <devfile_flush>:
+{
+  801151:	55                   	push   %ebp
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801157:	8b 45 08             	mov    0x8(%ebp),%eax
+  80115a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80115d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801162:	ba 00 00 00 00       	mov    $0x0,%edx
+  801167:	b8 06 00 00 00       	mov    $0x6,%eax
+  80116c:	e8 69 ff ff ff       	call   8010da <fsipc>
+}
+  801171:	c9                   	leave
+  801172:	c3                   	ret
+
+00801173 <devfile_stat>:
+{
+  801173:	55                   	push   %ebp
+  801174:	89 e5                	mov    %esp,%ebp
+  801176:	53                   	push   %ebx
+  801177:	83 ec 04             	sub    $0x4,%esp
+  80117a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80117d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801180:	8b 40 0c             	mov    0xc(%eax),%eax
+  801183:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801192:	e8 43 ff ff ff       	call   8010da <fsipc>
+  801197:	85 c0                	test   %eax,%eax
+  801199:	78 37                	js     8011d2 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80119b:	83 ec 08             	sub    $0x8,%esp
+  80119e:	68 00 70 80 00       	push   $0x807000
+  8011a3:	53                   	push   %ebx
+  8011a4:	e8 30 f0 ff ff       	call   8001d9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8011a9:	a1 80 70 80 00       	mov    0x807080,%eax
+  8011ae:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8011b4:	a1 84 70 80 00       	mov    0x807084,%eax
+  8011b9:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8011bf:	a1 88 70 80 00       	mov    0x807088,%eax
+  8011c4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8011ca:	83 c4 10             	add    $0x10,%esp
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011d5:	c9                   	leave
+  8011d6:	c3                   	ret
+
+008011d7 <devfile_write>:
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+  8011dd:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8011e0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8011e5:	39 d0                	cmp    %edx,%eax
+  8011e7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 52 0c             	mov    0xc(%edx),%edx
+  8011f0:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8011f6:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8011fb:	50                   	push   %eax
+  8011fc:	ff 75 0c             	push   0xc(%ebp)
+  8011ff:	68 08 70 80 00       	push   $0x807008
+  801204:	e8 80 f1 ff ff       	call   800389 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801213:	e8 c2 fe ff ff       	call   8010da <fsipc>
+}
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+
+0080121a <devfile_read>:
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	53                   	push   %ebx
+  80121e:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801221:	8b 45 08             	mov    0x8(%ebp),%eax
+  801224:	8b 40 0c             	mov    0xc(%eax),%eax
+  801227:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80122c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80122f:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801234:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801239:	b8 03 00 00 00       	mov    $0x3,%eax
+  80123e:	e8 97 fe ff ff       	call   8010da <fsipc>
+  801243:	89 c3                	mov    %eax,%ebx
+  801245:	85 c0                	test   %eax,%eax
+  801247:	78 14                	js     80125d <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801249:	83 ec 04             	sub    $0x4,%esp
+  80124c:	50                   	push   %eax
+  80124d:	68 00 70 80 00       	push   $0x807000
+  801252:	ff 75 0c             	push   0xc(%ebp)
+  801255:	e8 2f f1 ff ff       	call   800389 <memmove>
+	return r;
+  80125a:	83 c4 10             	add    $0x10,%esp
+}
+  80125d:	89 d8                	mov    %ebx,%eax
+  80125f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801262:	c9                   	leave
+  801263:	c3                   	ret
+
+00801264 <open>:
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	53                   	push   %ebx
+  801268:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80126b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80126e:	50                   	push   %eax
+  80126f:	e8 23 f8 ff ff       	call   800a97 <fd_alloc>
+  801274:	89 c3                	mov    %eax,%ebx
+  801276:	83 c4 10             	add    $0x10,%esp
+  801279:	85 c0                	test   %eax,%eax
+  80127b:	78 2a                	js     8012a7 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80127d:	83 ec 0c             	sub    $0xc,%esp
+  801280:	ff 75 08             	push   0x8(%ebp)
+  801283:	e8 05 ef ff ff       	call   80018d <strlen>
+  801288:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80128b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801290:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801295:	7e 17                	jle    8012ae <open+0x4a>
+	fd_close(fd, 1);
+  801297:	83 ec 08             	sub    $0x8,%esp
+  80129a:	6a 01                	push   $0x1
+  80129c:	ff 75 f4             	push   -0xc(%ebp)
+  80129f:	e8 08 f9 ff ff       	call   800bac <fd_close>
+	return r;
+  8012a4:	83 c4 10             	add    $0x10,%esp
+}
+  8012a7:	89 d8                	mov    %ebx,%eax
+  8012a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ac:	c9                   	leave
+  8012ad:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8012ae:	83 ec 08             	sub    $0x8,%esp
+  8012b1:	ff 75 08             	push   0x8(%ebp)
+  8012b4:	68 00 70 80 00       	push   $0x807000
+  8012b9:	e8 1b ef ff ff       	call   8001d9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8012be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012c1:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8012c6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8012c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012ce:	e8 07 fe ff ff       	call   8010da <fsipc>
+  8012d3:	89 c3                	mov    %eax,%ebx
+  8012d5:	83 c4 10             	add    $0x10,%esp
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	78 bb                	js     801297 <open+0x33>
+	return fd2num(fd); 	
+  8012dc:	83 ec 0c             	sub    $0xc,%esp
+  8012df:	ff 75 f4             	push   -0xc(%ebp)
+  8012e2:	e8 89 f7 ff ff       	call   800a70 <fd2num>
+  8012e7:	89 c3                	mov    %eax,%ebx
+  8012e9:	83 c4 10             	add    $0x10,%esp
+  8012ec:	eb b9                	jmp    8012a7 <open+0x43>
+
+008012ee <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	53                   	push   %ebx
+  8012f2:	83 ec 1c             	sub    $0x1c,%esp
+  8012f5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012fb:	50                   	push   %eax
+  8012fc:	ff 75 08             	push   0x8(%ebp)
+  8012ff:	e8 e3 f7 ff ff       	call   800ae7 <fd_lookup>
+  801304:	83 c4 10             	add    $0x10,%esp
+  801307:	85 c0                	test   %eax,%eax
+  801309:	78 5a                	js     801365 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80130b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80130e:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801314:	39 10                	cmp    %edx,(%eax)
+  801316:	75 66                	jne    80137e <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801318:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80131f:	74 49                	je     80136a <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801321:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801324:	8b 40 0c             	mov    0xc(%eax),%eax
+  801327:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80132c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80132f:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801334:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80133a:	6a 07                	push   $0x7
+  80133c:	68 00 70 80 00       	push   $0x807000
+  801341:	6a 09                	push   $0x9
+  801343:	ff 35 00 60 80 00    	push   0x806000
+  801349:	e8 10 25 00 00       	call   80385e <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80134e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801355:	6a 00                	push   $0x0
+  801357:	53                   	push   %ebx
+  801358:	ff 75 10             	push   0x10(%ebp)
+  80135b:	6a 00                	push   $0x0
+  80135d:	e8 39 23 00 00       	call   80369b <ipc_recv_pages>
+  801362:	83 c4 20             	add    $0x20,%esp
+}
+  801365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80136a:	83 ec 0c             	sub    $0xc,%esp
+  80136d:	6a 02                	push   $0x2
+  80136f:	e8 53 25 00 00       	call   8038c7 <ipc_find_env>
+  801374:	a3 00 60 80 00       	mov    %eax,0x806000
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	eb a3                	jmp    801321 <fmap+0x33>
+		return -E_INVAL;
+  80137e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801383:	eb e0                	jmp    801365 <fmap+0x77>
+
+00801385 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	53                   	push   %ebx
+  801389:	83 ec 10             	sub    $0x10,%esp
+  80138c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80138f:	53                   	push   %ebx
+  801390:	e8 f8 ed ff ff       	call   80018d <strlen>
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80139d:	7f 25                	jg     8013c4 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80139f:	83 ec 08             	sub    $0x8,%esp
+  8013a2:	53                   	push   %ebx
+  8013a3:	68 00 70 80 00       	push   $0x807000
+  8013a8:	e8 2c ee ff ff       	call   8001d9 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8013ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013b7:	e8 1e fd ff ff       	call   8010da <fsipc>
+  8013bc:	83 c4 10             	add    $0x10,%esp
+}
+  8013bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c2:	c9                   	leave
+  8013c3:	c3                   	ret
+		return -E_BAD_PATH;
+  8013c4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8013c9:	eb f4                	jmp    8013bf <remove+0x3a>
+
+008013cb <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8013d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013db:	e8 fa fc ff ff       	call   8010da <fsipc>
+}
+  8013e0:	c9                   	leave
+  8013e1:	c3                   	ret
+
+008013e2 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+  8013e5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8013e8:	68 ec 3b 80 00       	push   $0x803bec
+  8013ed:	ff 75 0c             	push   0xc(%ebp)
+  8013f0:	e8 e4 ed ff ff       	call   8001d9 <strcpy>
+	return 0;
+}
+  8013f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fa:	c9                   	leave
+  8013fb:	c3                   	ret
+
+008013fc <devsock_close>:
+{
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	53                   	push   %ebx
+  801400:	83 ec 10             	sub    $0x10,%esp
+  801403:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801406:	53                   	push   %ebx
+  801407:	e8 fa 24 00 00       	call   803906 <pageref>
+  80140c:	89 c2                	mov    %eax,%edx
+  80140e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801411:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801416:	83 fa 01             	cmp    $0x1,%edx
+  801419:	74 05                	je     801420 <devsock_close+0x24>
+}
+  80141b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80141e:	c9                   	leave
+  80141f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801420:	83 ec 0c             	sub    $0xc,%esp
+  801423:	ff 73 0c             	push   0xc(%ebx)
+  801426:	e8 b0 05 00 00       	call   8019db <nsipc_close>
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	eb eb                	jmp    80141b <devsock_close+0x1f>
+
+00801430 <devsock_write>:
+{
+  801430:	55                   	push   %ebp
+  801431:	89 e5                	mov    %esp,%ebp
+  801433:	53                   	push   %ebx
+  801434:	83 ec 14             	sub    $0x14,%esp
+  801437:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80143a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80143d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801440:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801443:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801446:	8b 41 08             	mov    0x8(%ecx),%eax
+  801449:	c1 f8 09             	sar    $0x9,%eax
+  80144c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80144f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801455:	77 13                	ja     80146a <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801457:	50                   	push   %eax
+  801458:	52                   	push   %edx
+  801459:	53                   	push   %ebx
+  80145a:	ff 71 0c             	push   0xc(%ecx)
+  80145d:	e8 5c 06 00 00       	call   801abe <nsipc_send>
+  801462:	83 c4 10             	add    $0x10,%esp
+}
+  801465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80146a:	50                   	push   %eax
+  80146b:	6a 01                	push   $0x1
+  80146d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801470:	50                   	push   %eax
+  801471:	ff 71 0c             	push   0xc(%ecx)
+  801474:	e8 a6 06 00 00       	call   801b1f <nsipc_sendmsg>
+  801479:	83 c4 10             	add    $0x10,%esp
+  80147c:	eb e7                	jmp    801465 <devsock_write+0x35>
+
+0080147e <devsock_read>:
+{
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	53                   	push   %ebx
+  801482:	83 ec 14             	sub    $0x14,%esp
+  801485:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801488:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80148b:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80148e:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801491:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801494:	8b 41 08             	mov    0x8(%ecx),%eax
+  801497:	c1 f8 09             	sar    $0x9,%eax
+  80149a:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80149d:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8014a3:	77 13                	ja     8014b8 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8014a5:	50                   	push   %eax
+  8014a6:	52                   	push   %edx
+  8014a7:	53                   	push   %ebx
+  8014a8:	ff 71 0c             	push   0xc(%ecx)
+  8014ab:	e8 9c 05 00 00       	call   801a4c <nsipc_recv>
+  8014b0:	83 c4 10             	add    $0x10,%esp
+}
+  8014b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b6:	c9                   	leave
+  8014b7:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8014b8:	50                   	push   %eax
+  8014b9:	6a 01                	push   $0x1
+  8014bb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014be:	50                   	push   %eax
+  8014bf:	ff 71 0c             	push   0xc(%ecx)
+  8014c2:	e8 02 0a 00 00       	call   801ec9 <nsipc_recvmsg>
+  8014c7:	83 c4 10             	add    $0x10,%esp
+  8014ca:	eb e7                	jmp    8014b3 <devsock_read+0x35>
+
+008014cc <fd2sockid>:
+{
+  8014cc:	55                   	push   %ebp
+  8014cd:	89 e5                	mov    %esp,%ebp
+  8014cf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8014d2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8014d5:	52                   	push   %edx
+  8014d6:	50                   	push   %eax
+  8014d7:	e8 0b f6 ff ff       	call   800ae7 <fd_lookup>
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 10                	js     8014f3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8014e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e6:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8014ec:	39 08                	cmp    %ecx,(%eax)
+  8014ee:	75 05                	jne    8014f5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8014f0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8014f3:	c9                   	leave
+  8014f4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8014f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014fa:	eb f7                	jmp    8014f3 <fd2sockid+0x27>
+
+008014fc <sock_flags>:
+{
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801502:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801505:	52                   	push   %edx
+  801506:	50                   	push   %eax
+  801507:	e8 db f5 ff ff       	call   800ae7 <fd_lookup>
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	78 0e                	js     801521 <sock_flags+0x25>
+  801513:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801516:	8b 40 08             	mov    0x8(%eax),%eax
+  801519:	c1 e8 09             	shr    $0x9,%eax
+  80151c:	83 e0 08             	and    $0x8,%eax
+}
+  80151f:	c9                   	leave
+  801520:	c3                   	ret
+		return 0;
+  801521:	b8 00 00 00 00       	mov    $0x0,%eax
+  801526:	eb f7                	jmp    80151f <sock_flags+0x23>
+
+00801528 <alloc_sockfd>:
+{
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	56                   	push   %esi
+  80152c:	53                   	push   %ebx
+  80152d:	83 ec 1c             	sub    $0x1c,%esp
+  801530:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801532:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801535:	50                   	push   %eax
+  801536:	e8 5c f5 ff ff       	call   800a97 <fd_alloc>
+  80153b:	89 c3                	mov    %eax,%ebx
+  80153d:	83 c4 10             	add    $0x10,%esp
+  801540:	85 c0                	test   %eax,%eax
+  801542:	78 43                	js     801587 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801544:	83 ec 04             	sub    $0x4,%esp
+  801547:	68 07 04 00 00       	push   $0x407
+  80154c:	ff 75 f4             	push   -0xc(%ebp)
+  80154f:	6a 00                	push   $0x0
+  801551:	e8 b7 f0 ff ff       	call   80060d <sys_page_alloc>
+  801556:	89 c3                	mov    %eax,%ebx
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	78 28                	js     801587 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80155f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801562:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801568:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80156a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80156d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801574:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801577:	83 ec 0c             	sub    $0xc,%esp
+  80157a:	50                   	push   %eax
+  80157b:	e8 f0 f4 ff ff       	call   800a70 <fd2num>
+  801580:	89 c3                	mov    %eax,%ebx
+  801582:	83 c4 10             	add    $0x10,%esp
+  801585:	eb 0c                	jmp    801593 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801587:	83 ec 0c             	sub    $0xc,%esp
+  80158a:	56                   	push   %esi
+  80158b:	e8 4b 04 00 00       	call   8019db <nsipc_close>
+		return r;
+  801590:	83 c4 10             	add    $0x10,%esp
+}
+  801593:	89 d8                	mov    %ebx,%eax
+  801595:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801598:	5b                   	pop    %ebx
+  801599:	5e                   	pop    %esi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+
+0080159c <accept>:
+{
+  80159c:	55                   	push   %ebp
+  80159d:	89 e5                	mov    %esp,%ebp
+  80159f:	56                   	push   %esi
+  8015a0:	53                   	push   %ebx
+  8015a1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8015a4:	89 f0                	mov    %esi,%eax
+  8015a6:	e8 21 ff ff ff       	call   8014cc <fd2sockid>
+  8015ab:	89 c3                	mov    %eax,%ebx
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	78 24                	js     8015d5 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8015b1:	89 f0                	mov    %esi,%eax
+  8015b3:	e8 44 ff ff ff       	call   8014fc <sock_flags>
+  8015b8:	50                   	push   %eax
+  8015b9:	ff 75 10             	push   0x10(%ebp)
+  8015bc:	ff 75 0c             	push   0xc(%ebp)
+  8015bf:	53                   	push   %ebx
+  8015c0:	e8 6b 03 00 00       	call   801930 <nsipc_accept>
+  8015c5:	89 c3                	mov    %eax,%ebx
+  8015c7:	83 c4 10             	add    $0x10,%esp
+  8015ca:	85 c0                	test   %eax,%eax
+  8015cc:	78 07                	js     8015d5 <accept+0x39>
+	return alloc_sockfd(r);
+  8015ce:	e8 55 ff ff ff       	call   801528 <alloc_sockfd>
+  8015d3:	89 c3                	mov    %eax,%ebx
+}
+  8015d5:	89 d8                	mov    %ebx,%eax
+  8015d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015da:	5b                   	pop    %ebx
+  8015db:	5e                   	pop    %esi
+  8015dc:	5d                   	pop    %ebp
+  8015dd:	c3                   	ret
+
+008015de <bind>:
+{
+  8015de:	55                   	push   %ebp
+  8015df:	89 e5                	mov    %esp,%ebp
+  8015e1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8015e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e7:	e8 e0 fe ff ff       	call   8014cc <fd2sockid>
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	78 12                	js     801602 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8015f0:	83 ec 04             	sub    $0x4,%esp
+  8015f3:	ff 75 10             	push   0x10(%ebp)
+  8015f6:	ff 75 0c             	push   0xc(%ebp)
+  8015f9:	50                   	push   %eax
+  8015fa:	e8 85 03 00 00       	call   801984 <nsipc_bind>
+  8015ff:	83 c4 10             	add    $0x10,%esp
+}
+  801602:	c9                   	leave
+  801603:	c3                   	ret
+
+00801604 <shutdown>:
+{
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+  801607:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80160a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80160d:	e8 ba fe ff ff       	call   8014cc <fd2sockid>
+  801612:	85 c0                	test   %eax,%eax
+  801614:	78 0f                	js     801625 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801616:	83 ec 08             	sub    $0x8,%esp
+  801619:	ff 75 0c             	push   0xc(%ebp)
+  80161c:	50                   	push   %eax
+  80161d:	e8 97 03 00 00       	call   8019b9 <nsipc_shutdown>
+  801622:	83 c4 10             	add    $0x10,%esp
+}
+  801625:	c9                   	leave
+  801626:	c3                   	ret
+
+00801627 <connect>:
+{
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+  80162a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80162d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801630:	e8 97 fe ff ff       	call   8014cc <fd2sockid>
+  801635:	85 c0                	test   %eax,%eax
+  801637:	78 12                	js     80164b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801639:	83 ec 04             	sub    $0x4,%esp
+  80163c:	ff 75 10             	push   0x10(%ebp)
+  80163f:	ff 75 0c             	push   0xc(%ebp)
+  801642:	50                   	push   %eax
+  801643:	e8 ad 03 00 00       	call   8019f5 <nsipc_connect>
+  801648:	83 c4 10             	add    $0x10,%esp
+}
+  80164b:	c9                   	leave
+  80164c:	c3                   	ret
+
+0080164d <listen>:
+{
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801653:	8b 45 08             	mov    0x8(%ebp),%eax
+  801656:	e8 71 fe ff ff       	call   8014cc <fd2sockid>
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	78 0f                	js     80166e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80165f:	83 ec 08             	sub    $0x8,%esp
+  801662:	ff 75 0c             	push   0xc(%ebp)
+  801665:	50                   	push   %eax
+  801666:	e8 bf 03 00 00       	call   801a2a <nsipc_listen>
+  80166b:	83 c4 10             	add    $0x10,%esp
+}
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+
+00801670 <sendmsg>:
+{
+  801670:	55                   	push   %ebp
+  801671:	89 e5                	mov    %esp,%ebp
+  801673:	57                   	push   %edi
+  801674:	56                   	push   %esi
+  801675:	53                   	push   %ebx
+  801676:	83 ec 0c             	sub    $0xc,%esp
+  801679:	8b 75 08             	mov    0x8(%ebp),%esi
+  80167c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80167f:	89 f0                	mov    %esi,%eax
+  801681:	e8 46 fe ff ff       	call   8014cc <fd2sockid>
+  801686:	89 c3                	mov    %eax,%ebx
+  801688:	85 c0                	test   %eax,%eax
+  80168a:	78 1c                	js     8016a8 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80168c:	89 f0                	mov    %esi,%eax
+  80168e:	e8 69 fe ff ff       	call   8014fc <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801693:	0b 45 10             	or     0x10(%ebp),%eax
+  801696:	50                   	push   %eax
+  801697:	ff 77 0c             	push   0xc(%edi)
+  80169a:	ff 77 08             	push   0x8(%edi)
+  80169d:	53                   	push   %ebx
+  80169e:	e8 7c 04 00 00       	call   801b1f <nsipc_sendmsg>
+  8016a3:	89 c3                	mov    %eax,%ebx
+  8016a5:	83 c4 10             	add    $0x10,%esp
+}
+  8016a8:	89 d8                	mov    %ebx,%eax
+  8016aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ad:	5b                   	pop    %ebx
+  8016ae:	5e                   	pop    %esi
+  8016af:	5f                   	pop    %edi
+  8016b0:	5d                   	pop    %ebp
+  8016b1:	c3                   	ret
+
+008016b2 <recvmsg>:
+{
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	57                   	push   %edi
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+  8016bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016be:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8016c1:	89 f8                	mov    %edi,%eax
+  8016c3:	e8 04 fe ff ff       	call   8014cc <fd2sockid>
+  8016c8:	89 c3                	mov    %eax,%ebx
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	78 2a                	js     8016f8 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8016ce:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8016d5:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8016dc:	89 f8                	mov    %edi,%eax
+  8016de:	e8 19 fe ff ff       	call   8014fc <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8016e3:	0b 45 10             	or     0x10(%ebp),%eax
+  8016e6:	50                   	push   %eax
+  8016e7:	ff 76 0c             	push   0xc(%esi)
+  8016ea:	ff 76 08             	push   0x8(%esi)
+  8016ed:	53                   	push   %ebx
+  8016ee:	e8 d6 07 00 00       	call   801ec9 <nsipc_recvmsg>
+  8016f3:	89 c3                	mov    %eax,%ebx
+  8016f5:	83 c4 10             	add    $0x10,%esp
+}
+  8016f8:	89 d8                	mov    %ebx,%eax
+  8016fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016fd:	5b                   	pop    %ebx
+  8016fe:	5e                   	pop    %esi
+  8016ff:	5f                   	pop    %edi
+  801700:	5d                   	pop    %ebp
+  801701:	c3                   	ret
+
+00801702 <sendfile>:
+{
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	56                   	push   %esi
+  801706:	53                   	push   %ebx
+  801707:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80170a:	89 f0                	mov    %esi,%eax
+  80170c:	e8 bb fd ff ff       	call   8014cc <fd2sockid>
+  801711:	89 c3                	mov    %eax,%ebx
+  801713:	85 c0                	test   %eax,%eax
+  801715:	78 1f                	js     801736 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801717:	89 f0                	mov    %esi,%eax
+  801719:	e8 de fd ff ff       	call   8014fc <sock_flags>
+  80171e:	83 ec 0c             	sub    $0xc,%esp
+  801721:	50                   	push   %eax
+  801722:	ff 75 14             	push   0x14(%ebp)
+  801725:	ff 75 10             	push   0x10(%ebp)
+  801728:	ff 75 0c             	push   0xc(%ebp)
+  80172b:	53                   	push   %ebx
+  80172c:	e8 64 06 00 00       	call   801d95 <nsipc_sendfile>
+  801731:	89 c3                	mov    %eax,%ebx
+  801733:	83 c4 20             	add    $0x20,%esp
+}
+  801736:	89 d8                	mov    %ebx,%eax
+  801738:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173b:	5b                   	pop    %ebx
+  80173c:	5e                   	pop    %esi
+  80173d:	5d                   	pop    %ebp
+  80173e:	c3                   	ret
+
+0080173f <evctl>:
+{
+  80173f:	55                   	push   %ebp
+  801740:	89 e5                	mov    %esp,%ebp
+  801742:	53                   	push   %ebx
+  801743:	83 ec 04             	sub    $0x4,%esp
+  801746:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801749:	89 d8                	mov    %ebx,%eax
+  80174b:	e8 7c fd ff ff       	call   8014cc <fd2sockid>
+  801750:	85 c0                	test   %eax,%eax
+  801752:	78 10                	js     801764 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801754:	83 ec 04             	sub    $0x4,%esp
+  801757:	53                   	push   %ebx
+  801758:	ff 75 0c             	push   0xc(%ebp)
+  80175b:	50                   	push   %eax
+  80175c:	e8 d2 0b 00 00       	call   802333 <nsipc_evctl>
+  801761:	83 c4 10             	add    $0x10,%esp
+}
+  801764:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801767:	c9                   	leave
+  801768:	c3                   	ret
+
+00801769 <evwait>:
+{
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80176f:	ff 75 10             	push   0x10(%ebp)
+  801772:	ff 75 0c             	push   0xc(%ebp)
+  801775:	ff 75 08             	push   0x8(%ebp)
+  801778:	e8 e0 0b 00 00       	call   80235d <nsipc_evwait>
+}
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+
+0080177f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80177f:	55                   	push   %ebp
+  801780:	89 e5                	mov    %esp,%ebp
+  801782:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801785:	ff 75 10             	push   0x10(%ebp)
+  801788:	ff 75 0c             	push   0xc(%ebp)
+  80178b:	ff 75 08             	push   0x8(%ebp)
+  80178e:	e8 31 0c 00 00       	call   8023c4 <nsipc_socket>
+  801793:	83 c4 10             	add    $0x10,%esp
+  801796:	85 c0                	test   %eax,%eax
+  801798:	78 05                	js     80179f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80179a:	e8 89 fd ff ff       	call   801528 <alloc_sockfd>
+}
+  80179f:	c9                   	leave
+  8017a0:	c3                   	ret
+
+008017a1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8017a1:	55                   	push   %ebp
+  8017a2:	89 e5                	mov    %esp,%ebp
+  8017a4:	53                   	push   %ebx
+  8017a5:	83 ec 04             	sub    $0x4,%esp
+  8017a8:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8017aa:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8017b1:	74 26                	je     8017d9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8017b3:	6a 07                	push   $0x7
+  8017b5:	68 00 80 80 00       	push   $0x808000
+  8017ba:	53                   	push   %ebx
+  8017bb:	ff 35 24 63 80 00    	push   0x806324
+  8017c1:	e8 98 20 00 00       	call   80385e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8017c6:	83 c4 0c             	add    $0xc,%esp
+  8017c9:	6a 00                	push   $0x0
+  8017cb:	6a 00                	push   $0x0
+  8017cd:	6a 00                	push   $0x0
+  8017cf:	e8 fa 1d 00 00       	call   8035ce <ipc_recv>
+}
+  8017d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017d7:	c9                   	leave
+  8017d8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8017d9:	83 ec 0c             	sub    $0xc,%esp
+  8017dc:	6a 03                	push   $0x3
+  8017de:	e8 e4 20 00 00       	call   8038c7 <ipc_find_env>
+  8017e3:	a3 24 63 80 00       	mov    %eax,0x806324
+  8017e8:	83 c4 10             	add    $0x10,%esp
+  8017eb:	eb c6                	jmp    8017b3 <nsipc+0x12>
+
+008017ed <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8017ed:	55                   	push   %ebp
+  8017ee:	89 e5                	mov    %esp,%ebp
+  8017f0:	56                   	push   %esi
+  8017f1:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8017f2:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  8017f8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8017fd:	85 f6                	test   %esi,%esi
+  8017ff:	75 33                	jne    801834 <nsbulk_map+0x47>
+  801801:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801806:	83 ec 04             	sub    $0x4,%esp
+  801809:	6a 07                	push   $0x7
+  80180b:	53                   	push   %ebx
+  80180c:	6a 00                	push   $0x0
+  80180e:	e8 fa ed ff ff       	call   80060d <sys_page_alloc>
+  801813:	83 c4 10             	add    $0x10,%esp
+  801816:	85 c0                	test   %eax,%eax
+  801818:	78 1a                	js     801834 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80181a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801820:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801826:	75 de                	jne    801806 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801828:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  80182f:	00 00 00 
+	return 0;
+  801832:	89 f0                	mov    %esi,%eax
+}
+  801834:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801837:	5b                   	pop    %ebx
+  801838:	5e                   	pop    %esi
+  801839:	5d                   	pop    %ebp
+  80183a:	c3                   	ret
+
+0080183b <nsbulk_own>:
+{
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	57                   	push   %edi
+  80183f:	56                   	push   %esi
+  801840:	53                   	push   %ebx
+  801841:	83 ec 0c             	sub    $0xc,%esp
+  801844:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801846:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801849:	85 d2                	test   %edx,%edx
+  80184b:	7f 0e                	jg     80185b <nsbulk_own+0x20>
+	return 0;
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801852:	eb 47                	jmp    80189b <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801854:	83 c3 01             	add    $0x1,%ebx
+  801857:	39 fb                	cmp    %edi,%ebx
+  801859:	7d 3b                	jge    801896 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80185b:	be 01 00 00 00       	mov    $0x1,%esi
+  801860:	89 d9                	mov    %ebx,%ecx
+  801862:	d3 e6                	shl    %cl,%esi
+  801864:	89 f0                	mov    %esi,%eax
+  801866:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  80186c:	74 e6                	je     801854 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80186e:	83 ec 04             	sub    $0x4,%esp
+  801871:	6a 07                	push   $0x7
+  801873:	89 d8                	mov    %ebx,%eax
+  801875:	c1 e0 0c             	shl    $0xc,%eax
+  801878:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80187d:	50                   	push   %eax
+  80187e:	6a 00                	push   $0x0
+  801880:	e8 88 ed ff ff       	call   80060d <sys_page_alloc>
+  801885:	83 c4 10             	add    $0x10,%esp
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	78 0f                	js     80189b <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80188c:	f7 d6                	not    %esi
+  80188e:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  801894:	eb be                	jmp    801854 <nsbulk_own+0x19>
+	return 0;
+  801896:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80189b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189e:	5b                   	pop    %ebx
+  80189f:	5e                   	pop    %esi
+  8018a0:	5f                   	pop    %edi
+  8018a1:	5d                   	pop    %ebp
+  8018a2:	c3                   	ret
+
+008018a3 <nsipc_bulk>:
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	57                   	push   %edi
+  8018a7:	56                   	push   %esi
+  8018a8:	53                   	push   %ebx
+  8018a9:	83 ec 1c             	sub    $0x1c,%esp
+  8018ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8018af:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8018b1:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8018b7:	c1 fb 0c             	sar    $0xc,%ebx
+  8018ba:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8018bd:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8018c4:	74 56                	je     80191c <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8018c6:	85 ff                	test   %edi,%edi
+  8018c8:	7e 24                	jle    8018ee <nsipc_bulk+0x4b>
+  8018ca:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8018d0:	74 1c                	je     8018ee <nsipc_bulk+0x4b>
+  8018d2:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8018d8:	c1 e3 0c             	shl    $0xc,%ebx
+  8018db:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8018e0:	0f b6 10             	movzbl (%eax),%edx
+  8018e3:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8018e5:	05 00 10 00 00       	add    $0x1000,%eax
+  8018ea:	39 d8                	cmp    %ebx,%eax
+  8018ec:	75 f2                	jne    8018e0 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8018ee:	83 ec 0c             	sub    $0xc,%esp
+  8018f1:	56                   	push   %esi
+  8018f2:	57                   	push   %edi
+  8018f3:	68 00 00 00 e0       	push   $0xe0000000
+  8018f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8018fb:	ff 35 24 63 80 00    	push   0x806324
+  801901:	e8 8c 1f 00 00       	call   803892 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801906:	83 c4 1c             	add    $0x1c,%esp
+  801909:	6a 00                	push   $0x0
+  80190b:	6a 00                	push   $0x0
+  80190d:	6a 00                	push   $0x0
+  80190f:	e8 ba 1c 00 00       	call   8035ce <ipc_recv>
+}
+  801914:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801917:	5b                   	pop    %ebx
+  801918:	5e                   	pop    %esi
+  801919:	5f                   	pop    %edi
+  80191a:	5d                   	pop    %ebp
+  80191b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80191c:	83 ec 0c             	sub    $0xc,%esp
+  80191f:	6a 03                	push   $0x3
+  801921:	e8 a1 1f 00 00       	call   8038c7 <ipc_find_env>
+  801926:	a3 24 63 80 00       	mov    %eax,0x806324
+  80192b:	83 c4 10             	add    $0x10,%esp
+  80192e:	eb 96                	jmp    8018c6 <nsipc_bulk+0x23>
+
+00801930 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  801930:	55                   	push   %ebp
+  801931:	89 e5                	mov    %esp,%ebp
+  801933:	53                   	push   %ebx
+  801934:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801937:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  80193f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801942:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801947:	b8 01 00 00 00       	mov    $0x1,%eax
+  80194c:	e8 50 fe ff ff       	call   8017a1 <nsipc>
+  801951:	89 c3                	mov    %eax,%ebx
+  801953:	85 c0                	test   %eax,%eax
+  801955:	79 07                	jns    80195e <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801957:	89 d8                	mov    %ebx,%eax
+  801959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195c:	c9                   	leave
+  80195d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80195e:	83 ec 04             	sub    $0x4,%esp
+  801961:	ff 35 10 80 80 00    	push   0x808010
+  801967:	68 00 80 80 00       	push   $0x808000
+  80196c:	ff 75 0c             	push   0xc(%ebp)
+  80196f:	e8 15 ea ff ff       	call   800389 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801974:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80197a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80197d:	89 10                	mov    %edx,(%eax)
+  80197f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801982:	eb d3                	jmp    801957 <nsipc_accept+0x27>
+
+00801984 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	53                   	push   %ebx
+  801988:	83 ec 08             	sub    $0x8,%esp
+  80198b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80198e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801991:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801996:	53                   	push   %ebx
+  801997:	ff 75 0c             	push   0xc(%ebp)
+  80199a:	68 04 80 80 00       	push   $0x808004
+  80199f:	e8 e5 e9 ff ff       	call   800389 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8019a4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8019aa:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019af:	e8 ed fd ff ff       	call   8017a1 <nsipc>
+}
+  8019b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+008019b9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8019b9:	55                   	push   %ebp
+  8019ba:	89 e5                	mov    %esp,%ebp
+  8019bc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8019bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8019c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019ca:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8019cf:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019d4:	e8 c8 fd ff ff       	call   8017a1 <nsipc>
+}
+  8019d9:	c9                   	leave
+  8019da:	c3                   	ret
+
+008019db <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8019e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e4:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8019e9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019ee:	e8 ae fd ff ff       	call   8017a1 <nsipc>
+}
+  8019f3:	c9                   	leave
+  8019f4:	c3                   	ret
+
+008019f5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8019f5:	55                   	push   %ebp
+  8019f6:	89 e5                	mov    %esp,%ebp
+  8019f8:	53                   	push   %ebx
+  8019f9:	83 ec 08             	sub    $0x8,%esp
+  8019fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8019ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a02:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801a07:	53                   	push   %ebx
+  801a08:	ff 75 0c             	push   0xc(%ebp)
+  801a0b:	68 04 80 80 00       	push   $0x808004
+  801a10:	e8 74 e9 ff ff       	call   800389 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801a15:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801a1b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a20:	e8 7c fd ff ff       	call   8017a1 <nsipc>
+}
+  801a25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a28:	c9                   	leave
+  801a29:	c3                   	ret
+
+00801a2a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801a2a:	55                   	push   %ebp
+  801a2b:	89 e5                	mov    %esp,%ebp
+  801a2d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a33:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801a38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a3b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801a40:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a45:	e8 57 fd ff ff       	call   8017a1 <nsipc>
+}
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+
+00801a4c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	56                   	push   %esi
+  801a50:	53                   	push   %ebx
+  801a51:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801a54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a57:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801a5c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801a62:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a65:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801a6a:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a6f:	e8 2d fd ff ff       	call   8017a1 <nsipc>
+  801a74:	89 c3                	mov    %eax,%ebx
+  801a76:	85 c0                	test   %eax,%eax
+  801a78:	78 22                	js     801a9c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801a7a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801a7f:	39 c6                	cmp    %eax,%esi
+  801a81:	0f 4e c6             	cmovle %esi,%eax
+  801a84:	39 c3                	cmp    %eax,%ebx
+  801a86:	7f 1d                	jg     801aa5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801a88:	83 ec 04             	sub    $0x4,%esp
+  801a8b:	53                   	push   %ebx
+  801a8c:	68 00 80 80 00       	push   $0x808000
+  801a91:	ff 75 0c             	push   0xc(%ebp)
+  801a94:	e8 f0 e8 ff ff       	call   800389 <memmove>
+  801a99:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801a9c:	89 d8                	mov    %ebx,%eax
+  801a9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa1:	5b                   	pop    %ebx
+  801aa2:	5e                   	pop    %esi
+  801aa3:	5d                   	pop    %ebp
+  801aa4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801aa5:	68 f8 3b 80 00       	push   $0x803bf8
+  801aaa:	68 0d 3c 80 00       	push   $0x803c0d
+  801aaf:	68 b2 00 00 00       	push   $0xb2
+  801ab4:	68 22 3c 80 00       	push   $0x803c22
+  801ab9:	e8 8a 13 00 00       	call   802e48 <_panic>
+
+00801abe <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	53                   	push   %ebx
+  801ac2:	83 ec 04             	sub    $0x4,%esp
+  801ac5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801acb:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  801ad0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ad6:	7f 2e                	jg     801b06 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ad8:	83 ec 04             	sub    $0x4,%esp
+  801adb:	53                   	push   %ebx
+  801adc:	ff 75 0c             	push   0xc(%ebp)
+  801adf:	68 0c 80 80 00       	push   $0x80800c
+  801ae4:	e8 a0 e8 ff ff       	call   800389 <memmove>
+	nsipcbuf.send.req_size = size;
+  801ae9:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  801aef:	8b 45 14             	mov    0x14(%ebp),%eax
+  801af2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  801af7:	b8 08 00 00 00       	mov    $0x8,%eax
+  801afc:	e8 a0 fc ff ff       	call   8017a1 <nsipc>
+}
+  801b01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b04:	c9                   	leave
+  801b05:	c3                   	ret
+	assert(size < 1600);
+  801b06:	68 2e 3c 80 00       	push   $0x803c2e
+  801b0b:	68 0d 3c 80 00       	push   $0x803c0d
+  801b10:	68 bd 00 00 00       	push   $0xbd
+  801b15:	68 22 3c 80 00       	push   $0x803c22
+  801b1a:	e8 29 13 00 00       	call   802e48 <_panic>
+
+00801b1f <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801b1f:	55                   	push   %ebp
+  801b20:	89 e5                	mov    %esp,%ebp
+  801b22:	57                   	push   %edi
+  801b23:	56                   	push   %esi
+  801b24:	53                   	push   %ebx
+  801b25:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  801b28:	e8 c0 fc ff ff       	call   8017ed <nsbulk_map>
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	78 55                	js     801b86 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  801b31:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  801b38:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  801b3f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801b46:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801b49:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801b4c:	0f 8d 24 02 00 00    	jge    801d76 <nsipc_sendmsg+0x257>
+  801b52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b55:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801b58:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  801b5b:	89 d8                	mov    %ebx,%eax
+  801b5d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b62:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  801b64:	83 ec 0c             	sub    $0xc,%esp
+  801b67:	68 20 60 80 00       	push   $0x806020
+  801b6c:	e8 5a 0f 00 00       	call   802acb <pgbatch_init>
+  801b71:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801b74:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801b76:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  801b79:	e9 82 00 00 00       	jmp    801c00 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  801b7e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801b81:	85 db                	test   %ebx,%ebx
+  801b83:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801b86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b89:	5b                   	pop    %ebx
+  801b8a:	5e                   	pop    %esi
+  801b8b:	5f                   	pop    %edi
+  801b8c:	5d                   	pop    %ebp
+  801b8d:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  801b8e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801b93:	29 c8                	sub    %ecx,%eax
+  801b95:	39 d0                	cmp    %edx,%eax
+  801b97:	0f 46 d0             	cmovbe %eax,%edx
+  801b9a:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  801b9c:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801ba2:	85 ff                	test   %edi,%edi
+  801ba4:	0f 49 c7             	cmovns %edi,%eax
+  801ba7:	c1 f8 0c             	sar    $0xc,%eax
+  801baa:	ba 01 00 00 00       	mov    $0x1,%edx
+  801baf:	e8 87 fc ff ff       	call   80183b <nsbulk_own>
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	0f 88 17 01 00 00    	js     801cd3 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  801bbc:	83 ec 04             	sub    $0x4,%esp
+  801bbf:	56                   	push   %esi
+  801bc0:	ff 75 e0             	push   -0x20(%ebp)
+  801bc3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801bc6:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801bcb:	50                   	push   %eax
+  801bcc:	e8 b8 e7 ff ff       	call   800389 <memmove>
+  801bd1:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801bd4:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801bd7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bda:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801bdd:	0f 84 fd 00 00 00    	je     801ce0 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801be3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801be6:	01 f7                	add    %esi,%edi
+  801be8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801beb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801bee:	0f 8d 01 01 00 00    	jge    801cf5 <nsipc_sendmsg+0x1d6>
+  801bf4:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  801bfa:	0f 8f f0 00 00 00    	jg     801cf0 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  801c00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c03:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801c06:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  801c09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c0c:	89 c2                	mov    %eax,%edx
+  801c0e:	03 13                	add    (%ebx),%edx
+  801c10:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801c13:	8b 73 04             	mov    0x4(%ebx),%esi
+  801c16:	29 c6                	sub    %eax,%esi
+  801c18:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  801c1d:	29 f9                	sub    %edi,%ecx
+  801c1f:	39 ce                	cmp    %ecx,%esi
+  801c21:	89 ca                	mov    %ecx,%edx
+  801c23:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  801c26:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801c29:	89 f9                	mov    %edi,%ecx
+  801c2b:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  801c31:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c34:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c39:	09 c8                	or     %ecx,%eax
+  801c3b:	0f 85 4d ff ff ff    	jne    801b8e <nsipc_sendmsg+0x6f>
+  801c41:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801c47:	0f 86 41 ff ff ff    	jbe    801b8e <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801c4d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801c53:	85 ff                	test   %edi,%edi
+  801c55:	0f 49 c7             	cmovns %edi,%eax
+  801c58:	c1 f8 0c             	sar    $0xc,%eax
+  801c5b:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  801c5d:	89 d1                	mov    %edx,%ecx
+  801c5f:	c1 e9 0c             	shr    $0xc,%ecx
+  801c62:	01 c8                	add    %ecx,%eax
+  801c64:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801c67:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c6a:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  801c6c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801c6f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801c74:	29 c8                	sub    %ecx,%eax
+  801c76:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801c79:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801c7c:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801c7e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c83:	89 f9                	mov    %edi,%ecx
+  801c85:	d3 e0                	shl    %cl,%eax
+  801c87:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801c8d:	83 ec 08             	sub    $0x8,%esp
+  801c90:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801c92:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801c95:	50                   	push   %eax
+  801c96:	6a 00                	push   $0x0
+  801c98:	56                   	push   %esi
+  801c99:	6a 00                	push   $0x0
+  801c9b:	68 20 60 80 00       	push   $0x806020
+  801ca0:	e8 e4 0e 00 00       	call   802b89 <pgbatch_map>
+  801ca5:	83 c4 20             	add    $0x20,%esp
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	0f 88 ce fe ff ff    	js     801b7e <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  801cb0:	83 c7 01             	add    $0x1,%edi
+  801cb3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801cb9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cbc:	39 c7                	cmp    %eax,%edi
+  801cbe:	75 be                	jne    801c7e <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  801cc0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801cc3:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801cc6:	89 d6                	mov    %edx,%esi
+  801cc8:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801cce:	e9 01 ff ff ff       	jmp    801bd4 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801cd3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801cd6:	85 db                	test   %ebx,%ebx
+  801cd8:	0f 45 c3             	cmovne %ebx,%eax
+  801cdb:	e9 a6 fe ff ff       	jmp    801b86 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  801ce0:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  801ce4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801ceb:	e9 f3 fe ff ff       	jmp    801be3 <nsipc_sendmsg+0xc4>
+  801cf0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801cf3:	eb 03                	jmp    801cf8 <nsipc_sendmsg+0x1d9>
+  801cf5:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  801cf8:	83 ec 0c             	sub    $0xc,%esp
+  801cfb:	68 20 60 80 00       	push   $0x806020
+  801d00:	e8 d4 0d 00 00       	call   802ad9 <pgbatch_flush>
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 50                	js     801d5c <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  801d0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0f:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  801d14:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  801d1a:	89 fb                	mov    %edi,%ebx
+  801d1c:	29 f3                	sub    %esi,%ebx
+  801d1e:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  801d24:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d27:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  801d2c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801d31:	89 fa                	mov    %edi,%edx
+  801d33:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d38:	e8 66 fb ff ff       	call   8018a3 <nsipc_bulk>
+  801d3d:	85 c0                	test   %eax,%eax
+  801d3f:	78 28                	js     801d69 <nsipc_sendmsg+0x24a>
+		sent += r;
+  801d41:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  801d44:	39 c3                	cmp    %eax,%ebx
+  801d46:	75 0c                	jne    801d54 <nsipc_sendmsg+0x235>
+  801d48:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801d4b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801d4e:	0f 8f f2 fd ff ff    	jg     801b46 <nsipc_sendmsg+0x27>
+		sent += r;
+  801d54:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801d57:	e9 2a fe ff ff       	jmp    801b86 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801d5c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801d5f:	85 db                	test   %ebx,%ebx
+  801d61:	0f 45 c3             	cmovne %ebx,%eax
+  801d64:	e9 1d fe ff ff       	jmp    801b86 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801d69:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801d6c:	85 db                	test   %ebx,%ebx
+  801d6e:	0f 45 c3             	cmovne %ebx,%eax
+  801d71:	e9 10 fe ff ff       	jmp    801b86 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801d76:	83 ec 0c             	sub    $0xc,%esp
+  801d79:	68 20 60 80 00       	push   $0x806020
+  801d7e:	e8 48 0d 00 00       	call   802acb <pgbatch_init>
+  801d83:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801d86:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d90:	e9 63 ff ff ff       	jmp    801cf8 <nsipc_sendmsg+0x1d9>
+
+00801d95 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801d95:	55                   	push   %ebp
+  801d96:	89 e5                	mov    %esp,%ebp
+  801d98:	57                   	push   %edi
+  801d99:	56                   	push   %esi
+  801d9a:	53                   	push   %ebx
+  801d9b:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  801d9e:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  801da5:	0f 84 c8 00 00 00    	je     801e73 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  801dab:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801db2:	0f 84 e4 00 00 00    	je     801e9c <nsipc_sendfile+0x107>
+{
+  801db8:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  801dbd:	89 fb                	mov    %edi,%ebx
+  801dbf:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801dc2:	0f 83 f0 00 00 00    	jae    801eb8 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  801dc8:	89 fa                	mov    %edi,%edx
+  801dca:	03 55 10             	add    0x10(%ebp),%edx
+  801dcd:	89 d0                	mov    %edx,%eax
+  801dcf:	c1 f8 1f             	sar    $0x1f,%eax
+  801dd2:	c1 e8 14             	shr    $0x14,%eax
+  801dd5:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  801dd8:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801dde:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801de0:	6a 10                	push   $0x10
+  801de2:	68 00 20 01 e0       	push   $0xe0012000
+  801de7:	52                   	push   %edx
+  801de8:	ff 75 0c             	push   0xc(%ebp)
+  801deb:	e8 fe f4 ff ff       	call   8012ee <fmap>
+  801df0:	83 c4 10             	add    $0x10,%esp
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	0f 8e b8 00 00 00    	jle    801eb3 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  801dfb:	39 c6                	cmp    %eax,%esi
+  801dfd:	0f 8d b5 00 00 00    	jge    801eb8 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  801e03:	29 f0                	sub    %esi,%eax
+  801e05:	8b 55 14             	mov    0x14(%ebp),%edx
+  801e08:	29 da                	sub    %ebx,%edx
+  801e0a:	39 d0                	cmp    %edx,%eax
+  801e0c:	89 d3                	mov    %edx,%ebx
+  801e0e:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  801e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e14:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  801e19:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  801e1f:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  801e25:	8b 45 18             	mov    0x18(%ebp),%eax
+  801e28:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  801e2d:	83 ec 0c             	sub    $0xc,%esp
+  801e30:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  801e32:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  801e39:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  801e3c:	83 c0 01             	add    $0x1,%eax
+  801e3f:	50                   	push   %eax
+  801e40:	68 00 10 01 e0       	push   $0xe0011000
+  801e45:	6a 11                	push   $0x11
+  801e47:	ff 35 24 63 80 00    	push   0x806324
+  801e4d:	e8 40 1a 00 00       	call   803892 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801e52:	83 c4 1c             	add    $0x1c,%esp
+  801e55:	6a 00                	push   $0x0
+  801e57:	6a 00                	push   $0x0
+  801e59:	6a 00                	push   $0x0
+  801e5b:	e8 6e 17 00 00       	call   8035ce <ipc_recv>
+  801e60:	83 c4 10             	add    $0x10,%esp
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	78 5b                	js     801ec2 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  801e67:	01 c7                	add    %eax,%edi
+		if (r < n)
+  801e69:	39 c3                	cmp    %eax,%ebx
+  801e6b:	0f 8e 4c ff ff ff    	jle    801dbd <nsipc_sendfile+0x28>
+  801e71:	eb 45                	jmp    801eb8 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801e73:	83 ec 04             	sub    $0x4,%esp
+  801e76:	6a 07                	push   $0x7
+  801e78:	68 00 10 01 e0       	push   $0xe0011000
+  801e7d:	6a 00                	push   $0x0
+  801e7f:	e8 89 e7 ff ff       	call   80060d <sys_page_alloc>
+  801e84:	89 c7                	mov    %eax,%edi
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	78 2b                	js     801eb8 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801e8d:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  801e94:	00 00 00 
+  801e97:	e9 0f ff ff ff       	jmp    801dab <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e9c:	83 ec 0c             	sub    $0xc,%esp
+  801e9f:	6a 03                	push   $0x3
+  801ea1:	e8 21 1a 00 00       	call   8038c7 <ipc_find_env>
+  801ea6:	a3 24 63 80 00       	mov    %eax,0x806324
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	e9 05 ff ff ff       	jmp    801db8 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801eb3:	85 ff                	test   %edi,%edi
+  801eb5:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801eb8:	89 f8                	mov    %edi,%eax
+  801eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ebd:	5b                   	pop    %ebx
+  801ebe:	5e                   	pop    %esi
+  801ebf:	5f                   	pop    %edi
+  801ec0:	5d                   	pop    %ebp
+  801ec1:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801ec2:	85 ff                	test   %edi,%edi
+  801ec4:	0f 44 f8             	cmove  %eax,%edi
+  801ec7:	eb ef                	jmp    801eb8 <nsipc_sendfile+0x123>
+
+00801ec9 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801ec9:	55                   	push   %ebp
+  801eca:	89 e5                	mov    %esp,%ebp
+  801ecc:	57                   	push   %edi
+  801ecd:	56                   	push   %esi
+  801ece:	53                   	push   %ebx
+  801ecf:	83 ec 1c             	sub    $0x1c,%esp
+  801ed2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801ed5:	e8 13 f9 ff ff       	call   8017ed <nsbulk_map>
+  801eda:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801edd:	85 c0                	test   %eax,%eax
+  801edf:	0f 88 ba 00 00 00    	js     801f9f <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ee5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ee9:	0f 8e bb 00 00 00    	jle    801faa <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801eef:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801ef9:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801efe:	89 f8                	mov    %edi,%eax
+  801f00:	29 f0                	sub    %esi,%eax
+  801f02:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801f06:	39 c8                	cmp    %ecx,%eax
+  801f08:	0f 47 c1             	cmova  %ecx,%eax
+  801f0b:	01 f0                	add    %esi,%eax
+  801f0d:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801f0f:	83 c2 01             	add    $0x1,%edx
+  801f12:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801f15:	7e 07                	jle    801f1e <nsipc_recvmsg+0x55>
+  801f17:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801f1c:	7e e0                	jle    801efe <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801f1e:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801f24:	c1 fa 0c             	sar    $0xc,%edx
+  801f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2c:	e8 0a f9 ff ff       	call   80183b <nsbulk_own>
+  801f31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	78 67                	js     801f9f <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801f38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3b:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801f40:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801f46:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f49:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801f4e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801f53:	89 f2                	mov    %esi,%edx
+  801f55:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801f5a:	e8 44 f9 ff ff       	call   8018a3 <nsipc_bulk>
+  801f5f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f62:	85 c0                	test   %eax,%eax
+  801f64:	78 39                	js     801f9f <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801f66:	39 f0                	cmp    %esi,%eax
+  801f68:	7f 4a                	jg     801fb4 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801f6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	7e 2c                	jle    801f9f <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801f73:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801f76:	29 fe                	sub    %edi,%esi
+  801f78:	8b 43 04             	mov    0x4(%ebx),%eax
+  801f7b:	39 c6                	cmp    %eax,%esi
+  801f7d:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801f80:	83 ec 04             	sub    $0x4,%esp
+  801f83:	56                   	push   %esi
+  801f84:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801f8a:	50                   	push   %eax
+  801f8b:	ff 33                	push   (%ebx)
+  801f8d:	e8 f7 e3 ff ff       	call   800389 <memmove>
+		n += m;
+  801f92:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801f94:	83 c3 08             	add    $0x8,%ebx
+  801f97:	83 c4 10             	add    $0x10,%esp
+  801f9a:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801f9d:	7f d4                	jg     801f73 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801f9f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa5:	5b                   	pop    %ebx
+  801fa6:	5e                   	pop    %esi
+  801fa7:	5f                   	pop    %edi
+  801fa8:	5d                   	pop    %ebp
+  801fa9:	c3                   	ret
+	int r, i, n, len = 0;
+  801faa:	be 00 00 00 00       	mov    $0x0,%esi
+  801faf:	e9 6a ff ff ff       	jmp    801f1e <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801fb4:	68 04 3c 80 00       	push   $0x803c04
+  801fb9:	68 0d 3c 80 00       	push   $0x803c0d
+  801fbe:	68 3b 01 00 00       	push   $0x13b
+  801fc3:	68 22 3c 80 00       	push   $0x803c22
+  801fc8:	e8 7b 0e 00 00       	call   802e48 <_panic>
+
+00801fcd <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801fcd:	55                   	push   %ebp
+  801fce:	89 e5                	mov    %esp,%ebp
+  801fd0:	57                   	push   %edi
+  801fd1:	56                   	push   %esi
+  801fd2:	53                   	push   %ebx
+  801fd3:	83 ec 0c             	sub    $0xc,%esp
+  801fd6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fd9:	8b 75 10             	mov    0x10(%ebp),%esi
+  801fdc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  801fe7:	8b 07                	mov    (%edi),%eax
+  801fe9:	a3 04 80 80 00       	mov    %eax,0x808004
+  801fee:	8b 47 04             	mov    0x4(%edi),%eax
+  801ff1:	a3 08 80 80 00       	mov    %eax,0x808008
+  801ff6:	8b 47 08             	mov    0x8(%edi),%eax
+  801ff9:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  801ffe:	8b 47 0c             	mov    0xc(%edi),%eax
+  802001:	a3 10 80 80 00       	mov    %eax,0x808010
+  802006:	8b 47 10             	mov    0x10(%edi),%eax
+  802009:	a3 14 80 80 00       	mov    %eax,0x808014
+  80200e:	8b 47 14             	mov    0x14(%edi),%eax
+  802011:	a3 18 80 80 00       	mov    %eax,0x808018
+  802016:	8b 47 18             	mov    0x18(%edi),%eax
+  802019:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  80201e:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802021:	a3 20 80 80 00       	mov    %eax,0x808020
+  802026:	8b 47 20             	mov    0x20(%edi),%eax
+  802029:	a3 24 80 80 00       	mov    %eax,0x808024
+  80202e:	8b 47 24             	mov    0x24(%edi),%eax
+  802031:	a3 28 80 80 00       	mov    %eax,0x808028
+  802036:	8b 47 28             	mov    0x28(%edi),%eax
+  802039:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80203e:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802041:	a3 30 80 80 00       	mov    %eax,0x808030
+  802046:	8b 47 30             	mov    0x30(%edi),%eax
+  802049:	a3 34 80 80 00       	mov    %eax,0x808034
+  80204e:	8b 47 34             	mov    0x34(%edi),%eax
+  802051:	a3 38 80 80 00       	mov    %eax,0x808038
+  802056:	8b 47 38             	mov    0x38(%edi),%eax
+  802059:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  80205e:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802061:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802066:	8b 06                	mov    (%esi),%eax
+  802068:	a3 44 80 80 00       	mov    %eax,0x808044
+  80206d:	8b 46 04             	mov    0x4(%esi),%eax
+  802070:	a3 48 80 80 00       	mov    %eax,0x808048
+  802075:	8b 46 08             	mov    0x8(%esi),%eax
+  802078:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  80207d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802080:	a3 50 80 80 00       	mov    %eax,0x808050
+  802085:	8b 46 10             	mov    0x10(%esi),%eax
+  802088:	a3 54 80 80 00       	mov    %eax,0x808054
+  80208d:	8b 46 14             	mov    0x14(%esi),%eax
+  802090:	a3 58 80 80 00       	mov    %eax,0x808058
+  802095:	8b 46 18             	mov    0x18(%esi),%eax
+  802098:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  80209d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8020a0:	a3 60 80 80 00       	mov    %eax,0x808060
+  8020a5:	8b 46 20             	mov    0x20(%esi),%eax
+  8020a8:	a3 64 80 80 00       	mov    %eax,0x808064
+  8020ad:	8b 46 24             	mov    0x24(%esi),%eax
+  8020b0:	a3 68 80 80 00       	mov    %eax,0x808068
+  8020b5:	8b 46 28             	mov    0x28(%esi),%eax
+  8020b8:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8020bd:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8020c0:	a3 70 80 80 00       	mov    %eax,0x808070
+  8020c5:	8b 46 30             	mov    0x30(%esi),%eax
+  8020c8:	a3 74 80 80 00       	mov    %eax,0x808074
+  8020cd:	8b 46 34             	mov    0x34(%esi),%eax
+  8020d0:	a3 78 80 80 00       	mov    %eax,0x808078
+  8020d5:	8b 46 38             	mov    0x38(%esi),%eax
+  8020d8:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8020dd:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8020e0:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8020e5:	8b 03                	mov    (%ebx),%eax
+  8020e7:	a3 84 80 80 00       	mov    %eax,0x808084
+  8020ec:	8b 43 04             	mov    0x4(%ebx),%eax
+  8020ef:	a3 88 80 80 00       	mov    %eax,0x808088
+  8020f4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8020f7:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8020fc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020ff:	a3 90 80 80 00       	mov    %eax,0x808090
+  802104:	8b 43 10             	mov    0x10(%ebx),%eax
+  802107:	a3 94 80 80 00       	mov    %eax,0x808094
+  80210c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80210f:	a3 98 80 80 00       	mov    %eax,0x808098
+  802114:	8b 43 18             	mov    0x18(%ebx),%eax
+  802117:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  80211c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80211f:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802124:	8b 43 20             	mov    0x20(%ebx),%eax
+  802127:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  80212c:	8b 43 24             	mov    0x24(%ebx),%eax
+  80212f:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802134:	8b 43 28             	mov    0x28(%ebx),%eax
+  802137:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  80213c:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  80213f:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802144:	8b 43 30             	mov    0x30(%ebx),%eax
+  802147:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  80214c:	8b 43 34             	mov    0x34(%ebx),%eax
+  80214f:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802154:	8b 43 38             	mov    0x38(%ebx),%eax
+  802157:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  80215c:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80215f:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802164:	8b 45 18             	mov    0x18(%ebp),%eax
+  802167:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80216c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802171:	e8 2b f6 ff ff       	call   8017a1 <nsipc>
+  802176:	85 c0                	test   %eax,%eax
+  802178:	0f 88 ad 01 00 00    	js     80232b <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80217e:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802184:	89 17                	mov    %edx,(%edi)
+  802186:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80218c:	89 57 04             	mov    %edx,0x4(%edi)
+  80218f:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802195:	89 57 08             	mov    %edx,0x8(%edi)
+  802198:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80219e:	89 57 0c             	mov    %edx,0xc(%edi)
+  8021a1:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8021a7:	89 57 10             	mov    %edx,0x10(%edi)
+  8021aa:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8021b0:	89 57 14             	mov    %edx,0x14(%edi)
+  8021b3:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8021b9:	89 57 18             	mov    %edx,0x18(%edi)
+  8021bc:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8021c2:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8021c5:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8021cb:	89 57 20             	mov    %edx,0x20(%edi)
+  8021ce:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8021d4:	89 57 24             	mov    %edx,0x24(%edi)
+  8021d7:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8021dd:	89 57 28             	mov    %edx,0x28(%edi)
+  8021e0:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8021e6:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8021e9:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8021ef:	89 57 30             	mov    %edx,0x30(%edi)
+  8021f2:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8021f8:	89 57 34             	mov    %edx,0x34(%edi)
+  8021fb:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802201:	89 57 38             	mov    %edx,0x38(%edi)
+  802204:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  80220a:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  80220d:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802213:	89 16                	mov    %edx,(%esi)
+  802215:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  80221b:	89 56 04             	mov    %edx,0x4(%esi)
+  80221e:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802224:	89 56 08             	mov    %edx,0x8(%esi)
+  802227:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  80222d:	89 56 0c             	mov    %edx,0xc(%esi)
+  802230:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802236:	89 56 10             	mov    %edx,0x10(%esi)
+  802239:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  80223f:	89 56 14             	mov    %edx,0x14(%esi)
+  802242:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802248:	89 56 18             	mov    %edx,0x18(%esi)
+  80224b:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802251:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802254:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  80225a:	89 56 20             	mov    %edx,0x20(%esi)
+  80225d:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802263:	89 56 24             	mov    %edx,0x24(%esi)
+  802266:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  80226c:	89 56 28             	mov    %edx,0x28(%esi)
+  80226f:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802275:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802278:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  80227e:	89 56 30             	mov    %edx,0x30(%esi)
+  802281:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802287:	89 56 34             	mov    %edx,0x34(%esi)
+  80228a:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802290:	89 56 38             	mov    %edx,0x38(%esi)
+  802293:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802299:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80229c:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8022a2:	89 13                	mov    %edx,(%ebx)
+  8022a4:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  8022aa:	89 53 04             	mov    %edx,0x4(%ebx)
+  8022ad:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  8022b3:	89 53 08             	mov    %edx,0x8(%ebx)
+  8022b6:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8022bc:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8022bf:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8022c5:	89 53 10             	mov    %edx,0x10(%ebx)
+  8022c8:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8022ce:	89 53 14             	mov    %edx,0x14(%ebx)
+  8022d1:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8022d7:	89 53 18             	mov    %edx,0x18(%ebx)
+  8022da:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8022e0:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8022e3:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8022e9:	89 53 20             	mov    %edx,0x20(%ebx)
+  8022ec:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8022f2:	89 53 24             	mov    %edx,0x24(%ebx)
+  8022f5:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8022fb:	89 53 28             	mov    %edx,0x28(%ebx)
+  8022fe:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802304:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802307:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  80230d:	89 53 30             	mov    %edx,0x30(%ebx)
+  802310:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802316:	89 53 34             	mov    %edx,0x34(%ebx)
+  802319:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  80231f:	89 53 38             	mov    %edx,0x38(%ebx)
+  802322:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802328:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80232b:	83 c4 0c             	add    $0xc,%esp
+  80232e:	5b                   	pop    %ebx
+  80232f:	5e                   	pop    %esi
+  802330:	5f                   	pop    %edi
+  802331:	5d                   	pop    %ebp
+  802332:	c3                   	ret
+
+00802333 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802341:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802344:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802349:	8b 45 10             	mov    0x10(%ebp),%eax
+  80234c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802351:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802356:	e8 46 f4 ff ff       	call   8017a1 <nsipc>
+}
+  80235b:	c9                   	leave
+  80235c:	c3                   	ret
+
+0080235d <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80235d:	55                   	push   %ebp
+  80235e:	89 e5                	mov    %esp,%ebp
+  802360:	56                   	push   %esi
+  802361:	53                   	push   %ebx
+  802362:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802365:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80236b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80236e:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802373:	b8 10 00 00 00       	mov    $0x10,%eax
+  802378:	e8 24 f4 ff ff       	call   8017a1 <nsipc>
+  80237d:	89 c3                	mov    %eax,%ebx
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	7e 1f                	jle    8023a2 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802383:	39 c6                	cmp    %eax,%esi
+  802385:	7c 24                	jl     8023ab <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802387:	83 ec 04             	sub    $0x4,%esp
+  80238a:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802391:	50                   	push   %eax
+  802392:	68 00 80 80 00       	push   $0x808000
+  802397:	ff 75 08             	push   0x8(%ebp)
+  80239a:	e8 ea df ff ff       	call   800389 <memmove>
+  80239f:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8023a2:	89 d8                	mov    %ebx,%eax
+  8023a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023a7:	5b                   	pop    %ebx
+  8023a8:	5e                   	pop    %esi
+  8023a9:	5d                   	pop    %ebp
+  8023aa:	c3                   	ret
+		assert(r <= max);
+  8023ab:	68 3a 3c 80 00       	push   $0x803c3a
+  8023b0:	68 0d 3c 80 00       	push   $0x803c0d
+  8023b5:	68 6a 01 00 00       	push   $0x16a
+  8023ba:	68 22 3c 80 00       	push   $0x803c22
+  8023bf:	e8 84 0a 00 00       	call   802e48 <_panic>
+
+008023c4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8023ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023cd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8023d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8023da:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023dd:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8023e2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023e7:	e8 b5 f3 ff ff       	call   8017a1 <nsipc>
+}
+  8023ec:	c9                   	leave
+  8023ed:	c3                   	ret
+
+008023ee <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8023ee:	55                   	push   %ebp
+  8023ef:	89 e5                	mov    %esp,%ebp
+  8023f1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8023f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f7:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8023fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802401:	e8 9b f3 ff ff       	call   8017a1 <nsipc>
+}
+  802406:	c9                   	leave
+  802407:	c3                   	ret
+
+00802408 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802408:	55                   	push   %ebp
+  802409:	89 e5                	mov    %esp,%ebp
+  80240b:	53                   	push   %ebx
+  80240c:	83 ec 04             	sub    $0x4,%esp
+  80240f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802412:	b8 12 00 00 00       	mov    $0x12,%eax
+  802417:	e8 85 f3 ff ff       	call   8017a1 <nsipc>
+  80241c:	85 c0                	test   %eax,%eax
+  80241e:	78 50                	js     802470 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802420:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802426:	89 13                	mov    %edx,(%ebx)
+  802428:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80242e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802431:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802437:	89 53 08             	mov    %edx,0x8(%ebx)
+  80243a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802440:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802443:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802449:	89 53 10             	mov    %edx,0x10(%ebx)
+  80244c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802452:	89 53 14             	mov    %edx,0x14(%ebx)
+  802455:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80245b:	89 53 18             	mov    %edx,0x18(%ebx)
+  80245e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802464:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802467:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80246d:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802470:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802473:	c9                   	leave
+  802474:	c3                   	ret
+
+00802475 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802475:	55                   	push   %ebp
+  802476:	89 e5                	mov    %esp,%ebp
+  802478:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80247b:	6a 03                	push   $0x3
+  80247d:	e8 45 14 00 00       	call   8038c7 <ipc_find_env>
+  802482:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802487:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248a:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80248f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802494:	e8 08 f3 ff ff       	call   8017a1 <nsipc>
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	78 0a                	js     8024aa <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8024a0:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  8024a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024aa:	c9                   	leave
+  8024ab:	c3                   	ret
+
+008024ac <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	57                   	push   %edi
+  8024b0:	56                   	push   %esi
+  8024b1:	53                   	push   %ebx
+  8024b2:	83 ec 1c             	sub    $0x1c,%esp
+  8024b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8024b8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024bb:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8024c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024c5:	89 e0                	mov    %esp,%eax
+  8024c7:	89 f2                	mov    %esi,%edx
+  8024c9:	29 c2                	sub    %eax,%edx
+  8024cb:	89 d0                	mov    %edx,%eax
+  8024cd:	c1 e8 0f             	shr    $0xf,%eax
+  8024d0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8024d6:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8024d9:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8024e0:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8024e3:	83 ec 0c             	sub    $0xc,%esp
+  8024e6:	ff 75 e0             	push   -0x20(%ebp)
+  8024e9:	e8 18 14 00 00       	call   803906 <pageref>
+  8024ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024f1:	83 c4 04             	add    $0x4,%esp
+  8024f4:	ff 75 dc             	push   -0x24(%ebp)
+  8024f7:	e8 0a 14 00 00       	call   803906 <pageref>
+  8024fc:	89 e2                	mov    %esp,%edx
+  8024fe:	89 f1                	mov    %esi,%ecx
+  802500:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802502:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802505:	89 ca                	mov    %ecx,%edx
+  802507:	c1 ea 0f             	shr    $0xf,%edx
+  80250a:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802510:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802513:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  80251a:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80251d:	39 d7                	cmp    %edx,%edi
+  80251f:	74 40                	je     802561 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802521:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802524:	75 9f                	jne    8024c5 <_pipeisclosed+0x19>
+  802526:	89 e2                	mov    %esp,%edx
+  802528:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80252d:	29 d0                	sub    %edx,%eax
+  80252f:	89 c2                	mov    %eax,%edx
+  802531:	c1 ea 0f             	shr    $0xf,%edx
+  802534:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80253e:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802541:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802548:	8b 40 58             	mov    0x58(%eax),%eax
+  80254b:	6a 01                	push   $0x1
+  80254d:	50                   	push   %eax
+  80254e:	57                   	push   %edi
+  80254f:	68 43 3c 80 00       	push   $0x803c43
+  802554:	e8 ca 09 00 00       	call   802f23 <cprintf>
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	e9 5f ff ff ff       	jmp    8024c0 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802561:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802564:	0f 94 c0             	sete   %al
+  802567:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80256a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+
+00802572 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802572:	55                   	push   %ebp
+  802573:	89 e5                	mov    %esp,%ebp
+  802575:	53                   	push   %ebx
+  802576:	83 ec 0c             	sub    $0xc,%esp
+  802579:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80257c:	53                   	push   %ebx
+  80257d:	6a 00                	push   $0x0
+  80257f:	e8 0e e1 ff ff       	call   800692 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802584:	89 1c 24             	mov    %ebx,(%esp)
+  802587:	e8 f4 e4 ff ff       	call   800a80 <fd2data>
+  80258c:	83 c4 08             	add    $0x8,%esp
+  80258f:	50                   	push   %eax
+  802590:	6a 00                	push   $0x0
+  802592:	e8 fb e0 ff ff       	call   800692 <sys_page_unmap>
+}
+  802597:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+0080259c <devpipe_read>:
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	57                   	push   %edi
+  8025a0:	56                   	push   %esi
+  8025a1:	53                   	push   %ebx
+  8025a2:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8025a5:	ff 75 08             	push   0x8(%ebp)
+  8025a8:	e8 d3 e4 ff ff       	call   800a80 <fd2data>
+  8025ad:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8025af:	8b 70 04             	mov    0x4(%eax),%esi
+  8025b2:	8b 00                	mov    (%eax),%eax
+  8025b4:	83 c4 10             	add    $0x10,%esp
+  8025b7:	39 f0                	cmp    %esi,%eax
+  8025b9:	75 36                	jne    8025f1 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8025bb:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8025be:	89 da                	mov    %ebx,%edx
+  8025c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c3:	e8 e4 fe ff ff       	call   8024ac <_pipeisclosed>
+  8025c8:	85 c0                	test   %eax,%eax
+  8025ca:	0f 85 d4 00 00 00    	jne    8026a4 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8025d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025d5:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8025d9:	83 ec 04             	sub    $0x4,%esp
+  8025dc:	6a ff                	push   $0xffffffff
+  8025de:	56                   	push   %esi
+  8025df:	57                   	push   %edi
+  8025e0:	e8 26 e4 ff ff       	call   800a0b <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8025e5:	8b 73 04             	mov    0x4(%ebx),%esi
+  8025e8:	8b 03                	mov    (%ebx),%eax
+  8025ea:	83 c4 10             	add    $0x10,%esp
+  8025ed:	39 c6                	cmp    %eax,%esi
+  8025ef:	74 cd                	je     8025be <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8025f1:	8b 73 04             	mov    0x4(%ebx),%esi
+  8025f4:	8b 03                	mov    (%ebx),%eax
+  8025f6:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8025fc:	29 c6                	sub    %eax,%esi
+  8025fe:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802603:	f7 e6                	mul    %esi
+  802605:	c1 ea 0c             	shr    $0xc,%edx
+  802608:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80260e:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802610:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802613:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802617:	8b 0b                	mov    (%ebx),%ecx
+  802619:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80261e:	f7 e1                	mul    %ecx
+  802620:	c1 ea 0b             	shr    $0xb,%edx
+  802623:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802629:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80262b:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802630:	29 cf                	sub    %ecx,%edi
+  802632:	39 f7                	cmp    %esi,%edi
+  802634:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802637:	83 ec 04             	sub    $0x4,%esp
+  80263a:	57                   	push   %edi
+  80263b:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  80263f:	50                   	push   %eax
+  802640:	ff 75 0c             	push   0xc(%ebp)
+  802643:	e8 41 dd ff ff       	call   800389 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802648:	83 c4 0c             	add    $0xc,%esp
+  80264b:	89 f0                	mov    %esi,%eax
+  80264d:	29 f8                	sub    %edi,%eax
+  80264f:	50                   	push   %eax
+  802650:	8d 43 10             	lea    0x10(%ebx),%eax
+  802653:	50                   	push   %eax
+  802654:	89 f8                	mov    %edi,%eax
+  802656:	03 45 0c             	add    0xc(%ebp),%eax
+  802659:	50                   	push   %eax
+  80265a:	e8 2a dd ff ff       	call   800389 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80265f:	8b 0b                	mov    (%ebx),%ecx
+  802661:	01 f1                	add    %esi,%ecx
+  802663:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802668:	f7 e1                	mul    %ecx
+  80266a:	c1 ea 0c             	shr    $0xc,%edx
+  80266d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802673:	29 c1                	sub    %eax,%ecx
+  802675:	89 0b                	mov    %ecx,(%ebx)
+  802677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267c:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802680:	83 c4 10             	add    $0x10,%esp
+  802683:	85 c0                	test   %eax,%eax
+  802685:	75 0a                	jne    802691 <devpipe_read+0xf5>
+	return n;
+  802687:	89 f0                	mov    %esi,%eax
+}
+  802689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80268c:	5b                   	pop    %ebx
+  80268d:	5e                   	pop    %esi
+  80268e:	5f                   	pop    %edi
+  80268f:	5d                   	pop    %ebp
+  802690:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802691:	83 ec 08             	sub    $0x8,%esp
+  802694:	68 00 04 00 00       	push   $0x400
+  802699:	53                   	push   %ebx
+  80269a:	e8 8e e3 ff ff       	call   800a2d <sys_futex_wake>
+  80269f:	83 c4 10             	add    $0x10,%esp
+  8026a2:	eb e3                	jmp    802687 <devpipe_read+0xeb>
+			return 0;
+  8026a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a9:	eb de                	jmp    802689 <devpipe_read+0xed>
+
+008026ab <devpipe_write>:
+{
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	57                   	push   %edi
+  8026af:	56                   	push   %esi
+  8026b0:	53                   	push   %ebx
+  8026b1:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8026b4:	ff 75 08             	push   0x8(%ebp)
+  8026b7:	e8 c4 e3 ff ff       	call   800a80 <fd2data>
+  8026bc:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8026c8:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8026cd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8026d1:	0f 84 43 01 00 00    	je     80281a <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8026d7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8026da:	8b 06                	mov    (%esi),%eax
+  8026dc:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8026e2:	29 c1                	sub    %eax,%ecx
+  8026e4:	89 c8                	mov    %ecx,%eax
+  8026e6:	f7 e7                	mul    %edi
+  8026e8:	c1 ea 0c             	shr    $0xc,%edx
+  8026eb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8026f1:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8026f3:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8026f9:	75 52                	jne    80274d <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8026fb:	89 f2                	mov    %esi,%edx
+  8026fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802700:	e8 a7 fd ff ff       	call   8024ac <_pipeisclosed>
+  802705:	85 c0                	test   %eax,%eax
+  802707:	0f 85 28 01 00 00    	jne    802835 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80270d:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80270f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802712:	8b 06                	mov    (%esi),%eax
+  802714:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80271a:	29 c1                	sub    %eax,%ecx
+  80271c:	89 c8                	mov    %ecx,%eax
+  80271e:	f7 e7                	mul    %edi
+  802720:	c1 ea 0c             	shr    $0xc,%edx
+  802723:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802729:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80272b:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802731:	75 a4                	jne    8026d7 <devpipe_write+0x2c>
+  802733:	b8 01 00 00 00       	mov    $0x1,%eax
+  802738:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80273c:	83 ec 04             	sub    $0x4,%esp
+  80273f:	6a ff                	push   $0xffffffff
+  802741:	53                   	push   %ebx
+  802742:	56                   	push   %esi
+  802743:	e8 c3 e2 ff ff       	call   800a0b <sys_futex_wait>
+}
+  802748:	83 c4 10             	add    $0x10,%esp
+  80274b:	eb 8a                	jmp    8026d7 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80274d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802750:	8b 06                	mov    (%esi),%eax
+  802752:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802758:	29 c1                	sub    %eax,%ecx
+  80275a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80275f:	f7 e1                	mul    %ecx
+  802761:	c1 ea 0c             	shr    $0xc,%edx
+  802764:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80276a:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80276c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802771:	89 d8                	mov    %ebx,%eax
+  802773:	29 c8                	sub    %ecx,%eax
+  802775:	8b 55 10             	mov    0x10(%ebp),%edx
+  802778:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80277b:	29 ca                	sub    %ecx,%edx
+  80277d:	39 d0                	cmp    %edx,%eax
+  80277f:	0f 46 d0             	cmovbe %eax,%edx
+  802782:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802785:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802788:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80278d:	f7 e1                	mul    %ecx
+  80278f:	c1 ea 0b             	shr    $0xb,%edx
+  802792:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802798:	89 ca                	mov    %ecx,%edx
+  80279a:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80279c:	29 d3                	sub    %edx,%ebx
+  80279e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027a1:	39 c3                	cmp    %eax,%ebx
+  8027a3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8027a6:	83 ec 04             	sub    $0x4,%esp
+  8027a9:	53                   	push   %ebx
+  8027aa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027ad:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8027b0:	51                   	push   %ecx
+  8027b1:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8027b5:	50                   	push   %eax
+  8027b6:	e8 ce db ff ff       	call   800389 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8027bb:	83 c4 0c             	add    $0xc,%esp
+  8027be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027c1:	29 d8                	sub    %ebx,%eax
+  8027c3:	50                   	push   %eax
+  8027c4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027c7:	01 cb                	add    %ecx,%ebx
+  8027c9:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8027cc:	53                   	push   %ebx
+  8027cd:	8d 46 10             	lea    0x10(%esi),%eax
+  8027d0:	50                   	push   %eax
+  8027d1:	e8 b3 db ff ff       	call   800389 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8027d6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8027d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027dc:	01 c1                	add    %eax,%ecx
+  8027de:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8027e3:	f7 e1                	mul    %ecx
+  8027e5:	c1 ea 0c             	shr    $0xc,%edx
+  8027e8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8027ee:	89 ca                	mov    %ecx,%edx
+  8027f0:	29 c2                	sub    %eax,%edx
+  8027f2:	89 56 04             	mov    %edx,0x4(%esi)
+  8027f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fa:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8027fe:	83 c4 10             	add    $0x10,%esp
+  802801:	85 c0                	test   %eax,%eax
+  802803:	75 1a                	jne    80281f <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802805:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802808:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80280b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80280e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802811:	0f 82 c0 fe ff ff    	jb     8026d7 <devpipe_write+0x2c>
+  802817:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80281a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80281d:	eb 1b                	jmp    80283a <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  80281f:	83 ec 08             	sub    $0x8,%esp
+  802822:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802827:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80282a:	50                   	push   %eax
+  80282b:	e8 fd e1 ff ff       	call   800a2d <sys_futex_wake>
+  802830:	83 c4 10             	add    $0x10,%esp
+  802833:	eb d0                	jmp    802805 <devpipe_write+0x15a>
+				return 0;
+  802835:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80283a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283d:	5b                   	pop    %ebx
+  80283e:	5e                   	pop    %esi
+  80283f:	5f                   	pop    %edi
+  802840:	5d                   	pop    %ebp
+  802841:	c3                   	ret
+
+00802842 <devpipe_stat>:
+{
+  802842:	55                   	push   %ebp
+  802843:	89 e5                	mov    %esp,%ebp
+  802845:	56                   	push   %esi
+  802846:	53                   	push   %ebx
+  802847:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80284a:	83 ec 0c             	sub    $0xc,%esp
+  80284d:	ff 75 08             	push   0x8(%ebp)
+  802850:	e8 2b e2 ff ff       	call   800a80 <fd2data>
+  802855:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802857:	83 c4 08             	add    $0x8,%esp
+  80285a:	68 56 3c 80 00       	push   $0x803c56
+  80285f:	53                   	push   %ebx
+  802860:	e8 74 d9 ff ff       	call   8001d9 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802865:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802868:	8b 06                	mov    (%esi),%eax
+  80286a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802870:	29 c1                	sub    %eax,%ecx
+  802872:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802877:	89 c8                	mov    %ecx,%eax
+  802879:	f7 e2                	mul    %edx
+  80287b:	c1 ea 0c             	shr    $0xc,%edx
+  80287e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802884:	29 d1                	sub    %edx,%ecx
+  802886:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80288c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802893:	00 00 00 
+	stat->st_dev = &devpipe;
+  802896:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80289d:	50 80 00 
+}
+  8028a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a8:	5b                   	pop    %ebx
+  8028a9:	5e                   	pop    %esi
+  8028aa:	5d                   	pop    %ebp
+  8028ab:	c3                   	ret
+
+008028ac <devpipe_poll>:
+{
+  8028ac:	55                   	push   %ebp
+  8028ad:	89 e5                	mov    %esp,%ebp
+  8028af:	57                   	push   %edi
+  8028b0:	56                   	push   %esi
+  8028b1:	53                   	push   %ebx
+  8028b2:	83 ec 18             	sub    $0x18,%esp
+  8028b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8028bb:	57                   	push   %edi
+  8028bc:	e8 bf e1 ff ff       	call   800a80 <fd2data>
+  8028c1:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8028c3:	83 c4 10             	add    $0x10,%esp
+  8028c6:	89 f3                	mov    %esi,%ebx
+  8028c8:	83 e3 01             	and    $0x1,%ebx
+  8028cb:	75 27                	jne    8028f4 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8028cd:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8028d3:	75 48                	jne    80291d <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8028d5:	89 ca                	mov    %ecx,%edx
+  8028d7:	89 f8                	mov    %edi,%eax
+  8028d9:	e8 ce fb ff ff       	call   8024ac <_pipeisclosed>
+  8028de:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8028e0:	89 d8                	mov    %ebx,%eax
+  8028e2:	83 c8 10             	or     $0x10,%eax
+  8028e5:	85 d2                	test   %edx,%edx
+  8028e7:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8028ea:	89 d8                	mov    %ebx,%eax
+  8028ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ef:	5b                   	pop    %ebx
+  8028f0:	5e                   	pop    %esi
+  8028f1:	5f                   	pop    %edi
+  8028f2:	5d                   	pop    %ebp
+  8028f3:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8028f4:	8b 58 04             	mov    0x4(%eax),%ebx
+  8028f7:	8b 00                	mov    (%eax),%eax
+  8028f9:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8028ff:	29 c3                	sub    %eax,%ebx
+  802901:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802906:	89 d8                	mov    %ebx,%eax
+  802908:	f7 e2                	mul    %edx
+  80290a:	c1 ea 0c             	shr    $0xc,%edx
+  80290d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802913:	39 d3                	cmp    %edx,%ebx
+  802915:	0f 95 c3             	setne  %bl
+  802918:	0f b6 db             	movzbl %bl,%ebx
+  80291b:	eb b0                	jmp    8028cd <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80291d:	8b 71 04             	mov    0x4(%ecx),%esi
+  802920:	8b 01                	mov    (%ecx),%eax
+  802922:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802928:	29 c6                	sub    %eax,%esi
+  80292a:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80292f:	89 f0                	mov    %esi,%eax
+  802931:	f7 e2                	mul    %edx
+  802933:	c1 ea 0c             	shr    $0xc,%edx
+  802936:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80293c:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80293e:	89 d8                	mov    %ebx,%eax
+  802940:	83 c8 04             	or     $0x4,%eax
+  802943:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  802949:	0f 42 d8             	cmovb  %eax,%ebx
+  80294c:	eb 87                	jmp    8028d5 <devpipe_poll+0x29>
+
+0080294e <pipe>:
+{
+  80294e:	55                   	push   %ebp
+  80294f:	89 e5                	mov    %esp,%ebp
+  802951:	56                   	push   %esi
+  802952:	53                   	push   %ebx
+  802953:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802956:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802959:	50                   	push   %eax
+  80295a:	e8 38 e1 ff ff       	call   800a97 <fd_alloc>
+  80295f:	89 c3                	mov    %eax,%ebx
+  802961:	83 c4 10             	add    $0x10,%esp
+  802964:	85 c0                	test   %eax,%eax
+  802966:	0f 88 23 01 00 00    	js     802a8f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80296c:	83 ec 04             	sub    $0x4,%esp
+  80296f:	68 07 04 00 00       	push   $0x407
+  802974:	ff 75 f4             	push   -0xc(%ebp)
+  802977:	6a 00                	push   $0x0
+  802979:	e8 8f dc ff ff       	call   80060d <sys_page_alloc>
+  80297e:	89 c3                	mov    %eax,%ebx
+  802980:	83 c4 10             	add    $0x10,%esp
+  802983:	85 c0                	test   %eax,%eax
+  802985:	0f 88 04 01 00 00    	js     802a8f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80298b:	83 ec 0c             	sub    $0xc,%esp
+  80298e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802991:	50                   	push   %eax
+  802992:	e8 00 e1 ff ff       	call   800a97 <fd_alloc>
+  802997:	89 c3                	mov    %eax,%ebx
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	0f 88 db 00 00 00    	js     802a7f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029a4:	83 ec 04             	sub    $0x4,%esp
+  8029a7:	68 07 04 00 00       	push   $0x407
+  8029ac:	ff 75 f0             	push   -0x10(%ebp)
+  8029af:	6a 00                	push   $0x0
+  8029b1:	e8 57 dc ff ff       	call   80060d <sys_page_alloc>
+  8029b6:	89 c3                	mov    %eax,%ebx
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  8029bb:	85 c0                	test   %eax,%eax
+  8029bd:	0f 88 bc 00 00 00    	js     802a7f <pipe+0x131>
+	va = fd2data(fd0);
+  8029c3:	83 ec 0c             	sub    $0xc,%esp
+  8029c6:	ff 75 f4             	push   -0xc(%ebp)
+  8029c9:	e8 b2 e0 ff ff       	call   800a80 <fd2data>
+  8029ce:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029d0:	83 c4 0c             	add    $0xc,%esp
+  8029d3:	68 07 04 00 00       	push   $0x407
+  8029d8:	50                   	push   %eax
+  8029d9:	6a 00                	push   $0x0
+  8029db:	e8 2d dc ff ff       	call   80060d <sys_page_alloc>
+  8029e0:	89 c3                	mov    %eax,%ebx
+  8029e2:	83 c4 10             	add    $0x10,%esp
+  8029e5:	85 c0                	test   %eax,%eax
+  8029e7:	0f 88 82 00 00 00    	js     802a6f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029ed:	83 ec 0c             	sub    $0xc,%esp
+  8029f0:	ff 75 f0             	push   -0x10(%ebp)
+  8029f3:	e8 88 e0 ff ff       	call   800a80 <fd2data>
+  8029f8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029ff:	50                   	push   %eax
+  802a00:	6a 00                	push   $0x0
+  802a02:	56                   	push   %esi
+  802a03:	6a 00                	push   $0x0
+  802a05:	e8 46 dc ff ff       	call   800650 <sys_page_map>
+  802a0a:	89 c3                	mov    %eax,%ebx
+  802a0c:	83 c4 20             	add    $0x20,%esp
+  802a0f:	85 c0                	test   %eax,%eax
+  802a11:	78 4e                	js     802a61 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802a13:	a1 60 50 80 00       	mov    0x805060,%eax
+  802a18:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a1b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802a1d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a20:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802a27:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a2a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802a2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802a2f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802a36:	83 ec 0c             	sub    $0xc,%esp
+  802a39:	ff 75 f4             	push   -0xc(%ebp)
+  802a3c:	e8 2f e0 ff ff       	call   800a70 <fd2num>
+  802a41:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a44:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802a46:	83 c4 04             	add    $0x4,%esp
+  802a49:	ff 75 f0             	push   -0x10(%ebp)
+  802a4c:	e8 1f e0 ff ff       	call   800a70 <fd2num>
+  802a51:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a54:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802a57:	83 c4 10             	add    $0x10,%esp
+  802a5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a5f:	eb 2e                	jmp    802a8f <pipe+0x141>
+	sys_page_unmap(0, va);
+  802a61:	83 ec 08             	sub    $0x8,%esp
+  802a64:	56                   	push   %esi
+  802a65:	6a 00                	push   $0x0
+  802a67:	e8 26 dc ff ff       	call   800692 <sys_page_unmap>
+  802a6c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802a6f:	83 ec 08             	sub    $0x8,%esp
+  802a72:	ff 75 f0             	push   -0x10(%ebp)
+  802a75:	6a 00                	push   $0x0
+  802a77:	e8 16 dc ff ff       	call   800692 <sys_page_unmap>
+  802a7c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802a7f:	83 ec 08             	sub    $0x8,%esp
+  802a82:	ff 75 f4             	push   -0xc(%ebp)
+  802a85:	6a 00                	push   $0x0
+  802a87:	e8 06 dc ff ff       	call   800692 <sys_page_unmap>
+  802a8c:	83 c4 10             	add    $0x10,%esp
+}
+  802a8f:	89 d8                	mov    %ebx,%eax
+  802a91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a94:	5b                   	pop    %ebx
+  802a95:	5e                   	pop    %esi
+  802a96:	5d                   	pop    %ebp
+  802a97:	c3                   	ret
+
+00802a98 <pipeisclosed>:
+{
+  802a98:	55                   	push   %ebp
+  802a99:	89 e5                	mov    %esp,%ebp
+  802a9b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa1:	50                   	push   %eax
+  802aa2:	ff 75 08             	push   0x8(%ebp)
+  802aa5:	e8 3d e0 ff ff       	call   800ae7 <fd_lookup>
+  802aaa:	83 c4 10             	add    $0x10,%esp
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 18                	js     802ac9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802ab1:	83 ec 0c             	sub    $0xc,%esp
+  802ab4:	ff 75 f4             	push   -0xc(%ebp)
+  802ab7:	e8 c4 df ff ff       	call   800a80 <fd2data>
+  802abc:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802abe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ac1:	e8 e6 f9 ff ff       	call   8024ac <_pipeisclosed>
+  802ac6:	83 c4 10             	add    $0x10,%esp
+}
+  802ac9:	c9                   	leave
+  802aca:	c3                   	ret
+
+00802acb <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  802acb:	55                   	push   %ebp
+  802acc:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  802ace:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802ad7:	5d                   	pop    %ebp
+  802ad8:	c3                   	ret
+
+00802ad9 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  802ad9:	55                   	push   %ebp
+  802ada:	89 e5                	mov    %esp,%ebp
+  802adc:	53                   	push   %ebx
+  802add:	83 ec 04             	sub    $0x4,%esp
+  802ae0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802ae3:	8b 03                	mov    (%ebx),%eax
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	75 05                	jne    802aee <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  802ae9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aec:	c9                   	leave
+  802aed:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  802aee:	83 ec 08             	sub    $0x8,%esp
+  802af1:	50                   	push   %eax
+  802af2:	8d 43 04             	lea    0x4(%ebx),%eax
+  802af5:	50                   	push   %eax
+  802af6:	e8 e7 dd ff ff       	call   8008e2 <sys_page_batch>
+	pb->pb_n = 0;
+  802afb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  802b01:	83 c4 10             	add    $0x10,%esp
+  802b04:	eb e3                	jmp    802ae9 <pgbatch_flush+0x10>
+
+00802b06 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  802b06:	55                   	push   %ebp
+  802b07:	89 e5                	mov    %esp,%ebp
+  802b09:	56                   	push   %esi
+  802b0a:	53                   	push   %ebx
+  802b0b:	89 c3                	mov    %eax,%ebx
+  802b0d:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  802b0f:	83 38 20             	cmpl   $0x20,(%eax)
+  802b12:	74 2c                	je     802b40 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  802b14:	8b 03                	mov    (%ebx),%eax
+  802b16:	8d 50 01             	lea    0x1(%eax),%edx
+  802b19:	89 13                	mov    %edx,(%ebx)
+  802b1b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802b1e:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  802b22:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  802b24:	83 ec 04             	sub    $0x4,%esp
+  802b27:	6a 18                	push   $0x18
+  802b29:	6a 00                	push   $0x0
+  802b2b:	50                   	push   %eax
+  802b2c:	e8 23 d8 ff ff       	call   800354 <memset>
+	return 0;
+  802b31:	83 c4 10             	add    $0x10,%esp
+  802b34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b3c:	5b                   	pop    %ebx
+  802b3d:	5e                   	pop    %esi
+  802b3e:	5d                   	pop    %ebp
+  802b3f:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  802b40:	83 ec 0c             	sub    $0xc,%esp
+  802b43:	50                   	push   %eax
+  802b44:	e8 90 ff ff ff       	call   802ad9 <pgbatch_flush>
+  802b49:	83 c4 10             	add    $0x10,%esp
+  802b4c:	85 c0                	test   %eax,%eax
+  802b4e:	79 c4                	jns    802b14 <pgbatch_slot+0xe>
+  802b50:	eb e7                	jmp    802b39 <pgbatch_slot+0x33>
+
+00802b52 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  802b52:	55                   	push   %ebp
+  802b53:	89 e5                	mov    %esp,%ebp
+  802b55:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802b58:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5e:	e8 a3 ff ff ff       	call   802b06 <pgbatch_slot>
+  802b63:	85 c0                	test   %eax,%eax
+  802b65:	78 20                	js     802b87 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  802b67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b6a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  802b70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b73:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802b76:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b79:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802b7c:	8b 55 14             	mov    0x14(%ebp),%edx
+  802b7f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802b82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b87:	c9                   	leave
+  802b88:	c3                   	ret
+
+00802b89 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  802b89:	55                   	push   %ebp
+  802b8a:	89 e5                	mov    %esp,%ebp
+  802b8c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802b8f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b95:	e8 6c ff ff ff       	call   802b06 <pgbatch_slot>
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	78 2c                	js     802bca <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  802b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba1:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802ba7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802baa:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  802bad:	8b 55 10             	mov    0x10(%ebp),%edx
+  802bb0:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802bb3:	8b 55 14             	mov    0x14(%ebp),%edx
+  802bb6:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  802bb9:	8b 55 18             	mov    0x18(%ebp),%edx
+  802bbc:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802bbf:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802bc2:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bca:	c9                   	leave
+  802bcb:	c3                   	ret
+
+00802bcc <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  802bcc:	55                   	push   %ebp
+  802bcd:	89 e5                	mov    %esp,%ebp
+  802bcf:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802bd2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd8:	e8 29 ff ff ff       	call   802b06 <pgbatch_slot>
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	78 1a                	js     802bfb <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  802be1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802be4:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  802bea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bed:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802bf0:	8b 55 10             	mov    0x10(%ebp),%edx
+  802bf3:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  802bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bfb:	c9                   	leave
+  802bfc:	c3                   	ret
+
+00802bfd <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  802bfd:	55                   	push   %ebp
+  802bfe:	89 e5                	mov    %esp,%ebp
+  802c00:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802c03:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c09:	e8 f8 fe ff ff       	call   802b06 <pgbatch_slot>
+  802c0e:	85 c0                	test   %eax,%eax
+  802c10:	78 20                	js     802c32 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  802c12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c15:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  802c1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c1e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802c21:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c24:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802c27:	8b 55 14             	mov    0x14(%ebp),%edx
+  802c2a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c32:	c9                   	leave
+  802c33:	c3                   	ret
+
+00802c34 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  802c34:	55                   	push   %ebp
+  802c35:	89 e5                	mov    %esp,%ebp
+  802c37:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802c3a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c40:	e8 c1 fe ff ff       	call   802b06 <pgbatch_slot>
+  802c45:	85 c0                	test   %eax,%eax
+  802c47:	78 26                	js     802c6f <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  802c49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c4c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  802c52:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c55:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  802c58:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c5b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802c5e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802c61:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  802c64:	8b 55 18             	mov    0x18(%ebp),%edx
+  802c67:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c6f:	c9                   	leave
+  802c70:	c3                   	ret
+
+00802c71 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c76:	c3                   	ret
+
+00802c77 <devcons_poll>:
+{
+  802c77:	55                   	push   %ebp
+  802c78:	89 e5                	mov    %esp,%ebp
+  802c7a:	53                   	push   %ebx
+  802c7b:	83 ec 04             	sub    $0x4,%esp
+  802c7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802c81:	89 da                	mov    %ebx,%edx
+  802c83:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802c86:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  802c8d:	74 0c                	je     802c9b <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802c8f:	89 d8                	mov    %ebx,%eax
+  802c91:	83 e0 01             	and    $0x1,%eax
+  802c94:	09 d0                	or     %edx,%eax
+}
+  802c96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c99:	c9                   	leave
+  802c9a:	c3                   	ret
+		cons_peek = sys_cgetc();
+  802c9b:	e8 cf d8 ff ff       	call   80056f <sys_cgetc>
+  802ca0:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802ca5:	89 da                	mov    %ebx,%edx
+  802ca7:	83 e2 04             	and    $0x4,%edx
+  802caa:	85 c0                	test   %eax,%eax
+  802cac:	74 e6                	je     802c94 <devcons_poll+0x1d>
+  802cae:	eb df                	jmp    802c8f <devcons_poll+0x18>
+
+00802cb0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802cb0:	55                   	push   %ebp
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802cb6:	68 62 3c 80 00       	push   $0x803c62
+  802cbb:	ff 75 0c             	push   0xc(%ebp)
+  802cbe:	e8 16 d5 ff ff       	call   8001d9 <strcpy>
+	return 0;
+}
+  802cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+
+00802cca <devcons_write>:
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	57                   	push   %edi
+  802cce:	56                   	push   %esi
+  802ccf:	53                   	push   %ebx
+  802cd0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802cd6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802cd9:	85 ff                	test   %edi,%edi
+  802cdb:	74 51                	je     802d2e <devcons_write+0x64>
+  802cdd:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  802ce7:	89 fb                	mov    %edi,%ebx
+  802ce9:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  802ceb:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802cf0:	39 d3                	cmp    %edx,%ebx
+  802cf2:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802cf5:	83 ec 04             	sub    $0x4,%esp
+  802cf8:	53                   	push   %ebx
+  802cf9:	03 45 0c             	add    0xc(%ebp),%eax
+  802cfc:	50                   	push   %eax
+  802cfd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d03:	50                   	push   %eax
+  802d04:	e8 80 d6 ff ff       	call   800389 <memmove>
+		sys_cputs(buf, m);
+  802d09:	83 c4 08             	add    $0x8,%esp
+  802d0c:	53                   	push   %ebx
+  802d0d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d13:	50                   	push   %eax
+  802d14:	e8 38 d8 ff ff       	call   800551 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802d19:	01 de                	add    %ebx,%esi
+  802d1b:	89 f0                	mov    %esi,%eax
+  802d1d:	83 c4 10             	add    $0x10,%esp
+  802d20:	39 fe                	cmp    %edi,%esi
+  802d22:	72 c3                	jb     802ce7 <devcons_write+0x1d>
+}
+  802d24:	89 f0                	mov    %esi,%eax
+  802d26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d29:	5b                   	pop    %ebx
+  802d2a:	5e                   	pop    %esi
+  802d2b:	5f                   	pop    %edi
+  802d2c:	5d                   	pop    %ebp
+  802d2d:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  802d2e:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  802d33:	eb ef                	jmp    802d24 <devcons_write+0x5a>
+
+00802d35 <devcons_read>:
+{
+  802d35:	55                   	push   %ebp
+  802d36:	89 e5                	mov    %esp,%ebp
+  802d38:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  802d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  802d40:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d44:	74 36                	je     802d7c <devcons_read+0x47>
+	c = cons_peek;
+  802d46:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  802d4b:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  802d52:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802d55:	85 c0                	test   %eax,%eax
+  802d57:	75 10                	jne    802d69 <devcons_read+0x34>
+  802d59:	e8 11 d8 ff ff       	call   80056f <sys_cgetc>
+  802d5e:	85 c0                	test   %eax,%eax
+  802d60:	75 07                	jne    802d69 <devcons_read+0x34>
+		sys_yield();
+  802d62:	e8 87 d8 ff ff       	call   8005ee <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802d67:	eb f0                	jmp    802d59 <devcons_read+0x24>
+	if (c < 0)
+  802d69:	85 c0                	test   %eax,%eax
+  802d6b:	78 0f                	js     802d7c <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  802d6d:	83 f8 04             	cmp    $0x4,%eax
+  802d70:	74 0c                	je     802d7e <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802d72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d75:	88 02                	mov    %al,(%edx)
+	return 1;
+  802d77:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802d7c:	c9                   	leave
+  802d7d:	c3                   	ret
+		return 0;
+  802d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d83:	eb f7                	jmp    802d7c <devcons_read+0x47>
+
+00802d85 <cputchar>:
+{
+  802d85:	55                   	push   %ebp
+  802d86:	89 e5                	mov    %esp,%ebp
+  802d88:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802d91:	6a 01                	push   $0x1
+  802d93:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d96:	50                   	push   %eax
+  802d97:	e8 b5 d7 ff ff       	call   800551 <sys_cputs>
+}
+  802d9c:	83 c4 10             	add    $0x10,%esp
+  802d9f:	c9                   	leave
+  802da0:	c3                   	ret
+
+00802da1 <getchar>:
+{
+  802da1:	55                   	push   %ebp
+  802da2:	89 e5                	mov    %esp,%ebp
+  802da4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802da7:	6a 01                	push   $0x1
+  802da9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802dac:	50                   	push   %eax
+  802dad:	6a 00                	push   $0x0
+  802daf:	e8 b7 df ff ff       	call   800d6b <read>
+	if (r < 0)
+  802db4:	83 c4 10             	add    $0x10,%esp
+  802db7:	85 c0                	test   %eax,%eax
+  802db9:	78 06                	js     802dc1 <getchar+0x20>
+	if (r < 1)
+  802dbb:	74 06                	je     802dc3 <getchar+0x22>
+	return c;
+  802dbd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802dc1:	c9                   	leave
+  802dc2:	c3                   	ret
+		return -E_EOF;
+  802dc3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802dc8:	eb f7                	jmp    802dc1 <getchar+0x20>
+
+00802dca <iscons>:
+{
+  802dca:	55                   	push   %ebp
+  802dcb:	89 e5                	mov    %esp,%ebp
+  802dcd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dd3:	50                   	push   %eax
+  802dd4:	ff 75 08             	push   0x8(%ebp)
+  802dd7:	e8 0b dd ff ff       	call   800ae7 <fd_lookup>
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	85 c0                	test   %eax,%eax
+  802de1:	78 11                	js     802df4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802de3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802de6:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  802dec:	39 10                	cmp    %edx,(%eax)
+  802dee:	0f 94 c0             	sete   %al
+  802df1:	0f b6 c0             	movzbl %al,%eax
+}
+  802df4:	c9                   	leave
+  802df5:	c3                   	ret
+
+00802df6 <opencons>:
+{
+  802df6:	55                   	push   %ebp
+  802df7:	89 e5                	mov    %esp,%ebp
+  802df9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802dfc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dff:	50                   	push   %eax
+  802e00:	e8 92 dc ff ff       	call   800a97 <fd_alloc>
+  802e05:	83 c4 10             	add    $0x10,%esp
+  802e08:	85 c0                	test   %eax,%eax
+  802e0a:	78 3a                	js     802e46 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802e0c:	83 ec 04             	sub    $0x4,%esp
+  802e0f:	68 07 04 00 00       	push   $0x407
+  802e14:	ff 75 f4             	push   -0xc(%ebp)
+  802e17:	6a 00                	push   $0x0
+  802e19:	e8 ef d7 ff ff       	call   80060d <sys_page_alloc>
+  802e1e:	83 c4 10             	add    $0x10,%esp
+  802e21:	85 c0                	test   %eax,%eax
+  802e23:	78 21                	js     802e46 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802e25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e28:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  802e2e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802e30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e33:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802e3a:	83 ec 0c             	sub    $0xc,%esp
+  802e3d:	50                   	push   %eax
+  802e3e:	e8 2d dc ff ff       	call   800a70 <fd2num>
+  802e43:	83 c4 10             	add    $0x10,%esp
+}
+  802e46:	c9                   	leave
+  802e47:	c3                   	ret
+
+00802e48 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802e48:	55                   	push   %ebp
+  802e49:	89 e5                	mov    %esp,%ebp
+  802e4b:	56                   	push   %esi
+  802e4c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802e4d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802e50:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  802e56:	e8 74 d7 ff ff       	call   8005cf <sys_getenvid>
+  802e5b:	83 ec 0c             	sub    $0xc,%esp
+  802e5e:	ff 75 0c             	push   0xc(%ebp)
+  802e61:	ff 75 08             	push   0x8(%ebp)
+  802e64:	56                   	push   %esi
+  802e65:	50                   	push   %eax
+  802e66:	68 70 3c 80 00       	push   $0x803c70
+  802e6b:	e8 b3 00 00 00       	call   802f23 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802e70:	83 c4 18             	add    $0x18,%esp
+  802e73:	53                   	push   %ebx
+  802e74:	ff 75 10             	push   0x10(%ebp)
+  802e77:	e8 56 00 00 00       	call   802ed2 <vcprintf>
+	cprintf("\n");
+  802e7c:	c7 04 24 54 3c 80 00 	movl   $0x803c54,(%esp)
+  802e83:	e8 9b 00 00 00       	call   802f23 <cprintf>
+  802e88:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802e8b:	cc                   	int3
+	while (1)
+  802e8c:	eb fd                	jmp    802e8b <_panic+0x43>
+
+00802e8e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802e8e:	55                   	push   %ebp
+  802e8f:	89 e5                	mov    %esp,%ebp
+  802e91:	53                   	push   %ebx
+  802e92:	83 ec 04             	sub    $0x4,%esp
+  802e95:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802e98:	8b 13                	mov    (%ebx),%edx
+  802e9a:	8d 42 01             	lea    0x1(%edx),%eax
+  802e9d:	89 03                	mov    %eax,(%ebx)
+  802e9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ea2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802ea6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802eab:	74 09                	je     802eb6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802ead:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802eb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb4:	c9                   	leave
+  802eb5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802eb6:	83 ec 08             	sub    $0x8,%esp
+  802eb9:	68 ff 00 00 00       	push   $0xff
+  802ebe:	8d 43 08             	lea    0x8(%ebx),%eax
+  802ec1:	50                   	push   %eax
+  802ec2:	e8 8a d6 ff ff       	call   800551 <sys_cputs>
+		b->idx = 0;
+  802ec7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802ecd:	83 c4 10             	add    $0x10,%esp
+  802ed0:	eb db                	jmp    802ead <putch+0x1f>
+
+00802ed2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802ed2:	55                   	push   %ebp
+  802ed3:	89 e5                	mov    %esp,%ebp
+  802ed5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802edb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802ee2:	00 00 00 
+	b.cnt = 0;
+  802ee5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802eec:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802eef:	ff 75 0c             	push   0xc(%ebp)
+  802ef2:	ff 75 08             	push   0x8(%ebp)
+  802ef5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802efb:	50                   	push   %eax
+  802efc:	68 8e 2e 80 00       	push   $0x802e8e
+  802f01:	e8 1c 01 00 00       	call   803022 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802f06:	83 c4 08             	add    $0x8,%esp
+  802f09:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802f0f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802f15:	50                   	push   %eax
+  802f16:	e8 36 d6 ff ff       	call   800551 <sys_cputs>
+
+	return b.cnt;
+}
+  802f1b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+
+00802f23 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802f23:	55                   	push   %ebp
+  802f24:	89 e5                	mov    %esp,%ebp
+  802f26:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802f29:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802f2c:	50                   	push   %eax
+  802f2d:	ff 75 08             	push   0x8(%ebp)
+  802f30:	e8 9d ff ff ff       	call   802ed2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802f35:	c9                   	leave
+  802f36:	c3                   	ret
+
+00802f37 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802f37:	55                   	push   %ebp
+  802f38:	89 e5                	mov    %esp,%ebp
+  802f3a:	57                   	push   %edi
+  802f3b:	56                   	push   %esi
+  802f3c:	53                   	push   %ebx
+  802f3d:	83 ec 1c             	sub    $0x1c,%esp
+  802f40:	89 c3                	mov    %eax,%ebx
+  802f42:	89 d6                	mov    %edx,%esi
+  802f44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f4a:	89 d1                	mov    %edx,%ecx
+  802f4c:	89 c2                	mov    %eax,%edx
+  802f4e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802f51:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802f54:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802f57:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f5a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802f61:	39 c2                	cmp    %eax,%edx
+  802f63:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802f66:	73 4b                	jae    802fb3 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802f68:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f6b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802f6e:	85 ff                	test   %edi,%edi
+  802f70:	7e 11                	jle    802f83 <printnum+0x4c>
+			putch(padc, putdat);
+  802f72:	83 ec 08             	sub    $0x8,%esp
+  802f75:	56                   	push   %esi
+  802f76:	ff 75 18             	push   0x18(%ebp)
+  802f79:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802f7b:	83 c4 10             	add    $0x10,%esp
+  802f7e:	83 ef 01             	sub    $0x1,%edi
+  802f81:	75 ef                	jne    802f72 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802f83:	83 ec 08             	sub    $0x8,%esp
+  802f86:	56                   	push   %esi
+  802f87:	83 ec 04             	sub    $0x4,%esp
+  802f8a:	ff 75 e4             	push   -0x1c(%ebp)
+  802f8d:	ff 75 e0             	push   -0x20(%ebp)
+  802f90:	ff 75 dc             	push   -0x24(%ebp)
+  802f93:	ff 75 d8             	push   -0x28(%ebp)
+  802f96:	e8 6f 0a 00 00       	call   803a0a <__umoddi3>
+  802f9b:	83 c4 14             	add    $0x14,%esp
+  802f9e:	0f be 80 93 3c 80 00 	movsbl 0x803c93(%eax),%eax
+  802fa5:	50                   	push   %eax
+  802fa6:	ff d3                	call   *%ebx
+}
+  802fa8:	83 c4 10             	add    $0x10,%esp
+  802fab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fae:	5b                   	pop    %ebx
+  802faf:	5e                   	pop    %esi
+  802fb0:	5f                   	pop    %edi
+  802fb1:	5d                   	pop    %ebp
+  802fb2:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802fb3:	83 ec 0c             	sub    $0xc,%esp
+  802fb6:	ff 75 18             	push   0x18(%ebp)
+  802fb9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802fbc:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802fbf:	52                   	push   %edx
+  802fc0:	50                   	push   %eax
+  802fc1:	83 ec 08             	sub    $0x8,%esp
+  802fc4:	ff 75 e4             	push   -0x1c(%ebp)
+  802fc7:	ff 75 e0             	push   -0x20(%ebp)
+  802fca:	ff 75 dc             	push   -0x24(%ebp)
+  802fcd:	ff 75 d8             	push   -0x28(%ebp)
+  802fd0:	e8 6f 09 00 00       	call   803944 <__udivdi3>
+  802fd5:	83 c4 18             	add    $0x18,%esp
+  802fd8:	52                   	push   %edx
+  802fd9:	50                   	push   %eax
+  802fda:	89 f2                	mov    %esi,%edx
+  802fdc:	89 d8                	mov    %ebx,%eax
+  802fde:	e8 54 ff ff ff       	call   802f37 <printnum>
+  802fe3:	83 c4 20             	add    $0x20,%esp
+  802fe6:	eb 9b                	jmp    802f83 <printnum+0x4c>
+
+00802fe8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802fe8:	55                   	push   %ebp
+  802fe9:	89 e5                	mov    %esp,%ebp
+  802feb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802fee:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802ff2:	8b 10                	mov    (%eax),%edx
+  802ff4:	3b 50 04             	cmp    0x4(%eax),%edx
+  802ff7:	73 0a                	jae    803003 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802ff9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802ffc:	89 08                	mov    %ecx,(%eax)
+  802ffe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803001:	88 02                	mov    %al,(%edx)
+}
+  803003:	5d                   	pop    %ebp
+  803004:	c3                   	ret
+
+00803005 <printfmt>:
+{
+  803005:	55                   	push   %ebp
+  803006:	89 e5                	mov    %esp,%ebp
+  803008:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80300b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80300e:	50                   	push   %eax
+  80300f:	ff 75 10             	push   0x10(%ebp)
+  803012:	ff 75 0c             	push   0xc(%ebp)
+  803015:	ff 75 08             	push   0x8(%ebp)
+  803018:	e8 05 00 00 00       	call   803022 <vprintfmt>
+}
+  80301d:	83 c4 10             	add    $0x10,%esp
+  803020:	c9                   	leave
+  803021:	c3                   	ret
+
+00803022 <vprintfmt>:
+{
+  803022:	55                   	push   %ebp
+  803023:	89 e5                	mov    %esp,%ebp
+  803025:	57                   	push   %edi
+  803026:	56                   	push   %esi
+  803027:	53                   	push   %ebx
+  803028:	83 ec 2c             	sub    $0x2c,%esp
+  80302b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80302e:	89 df                	mov    %ebx,%edi
+  803030:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  803033:	8b 45 10             	mov    0x10(%ebp),%eax
+  803036:	8d 70 01             	lea    0x1(%eax),%esi
+  803039:	0f b6 00             	movzbl (%eax),%eax
+  80303c:	83 f8 25             	cmp    $0x25,%eax
+  80303f:	74 1e                	je     80305f <vprintfmt+0x3d>
+			if (ch == '\0')
+  803041:	85 c0                	test   %eax,%eax
+  803043:	0f 84 15 05 00 00    	je     80355e <vprintfmt+0x53c>
+			putch(ch, putdat);
+  803049:	83 ec 08             	sub    $0x8,%esp
+  80304c:	53                   	push   %ebx
+  80304d:	50                   	push   %eax
+  80304e:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  803050:	83 c6 01             	add    $0x1,%esi
+  803053:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803057:	83 c4 10             	add    $0x10,%esp
+  80305a:	83 f8 25             	cmp    $0x25,%eax
+  80305d:	75 e2                	jne    803041 <vprintfmt+0x1f>
+		padc = ' ';
+  80305f:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  803063:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80306a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  803071:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  803078:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80307d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  803080:	8d 56 01             	lea    0x1(%esi),%edx
+  803083:	0f b6 0e             	movzbl (%esi),%ecx
+  803086:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  803089:	3c 55                	cmp    $0x55,%al
+  80308b:	0f 87 3b 04 00 00    	ja     8034cc <vprintfmt+0x4aa>
+  803091:	0f b6 c0             	movzbl %al,%eax
+  803094:	ff 24 85 00 3e 80 00 	jmp    *0x803e00(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80309b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80309e:	eb 93                	jmp    803033 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8030a0:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8030a2:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8030a6:	eb d8                	jmp    803080 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8030a8:	89 d6                	mov    %edx,%esi
+  8030aa:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8030ae:	eb d0                	jmp    803080 <vprintfmt+0x5e>
+  8030b0:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8030b3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8030b6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8030b9:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8030bd:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8030c0:	83 f9 09             	cmp    $0x9,%ecx
+  8030c3:	77 6f                	ja     803134 <vprintfmt+0x112>
+  8030c5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8030c8:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8030cb:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8030ce:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8030d2:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8030d5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8030d8:	83 fe 09             	cmp    $0x9,%esi
+  8030db:	76 eb                	jbe    8030c8 <vprintfmt+0xa6>
+  8030dd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8030e0:	89 d6                	mov    %edx,%esi
+  8030e2:	eb 13                	jmp    8030f7 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8030e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030e7:	8b 00                	mov    (%eax),%eax
+  8030e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8030ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8030f2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8030f5:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8030f7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030fb:	79 83                	jns    803080 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8030fd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803100:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803103:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80310a:	e9 71 ff ff ff       	jmp    803080 <vprintfmt+0x5e>
+			if (width < 0)
+  80310f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803112:	85 c9                	test   %ecx,%ecx
+  803114:	b8 00 00 00 00       	mov    $0x0,%eax
+  803119:	0f 49 c1             	cmovns %ecx,%eax
+  80311c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80311f:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  803121:	e9 5a ff ff ff       	jmp    803080 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  803126:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  803128:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80312f:	e9 4c ff ff ff       	jmp    803080 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  803134:	89 d6                	mov    %edx,%esi
+  803136:	eb bf                	jmp    8030f7 <vprintfmt+0xd5>
+			lflag++;
+  803138:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80313c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80313e:	e9 3d ff ff ff       	jmp    803080 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  803143:	89 55 10             	mov    %edx,0x10(%ebp)
+  803146:	8b 45 14             	mov    0x14(%ebp),%eax
+  803149:	8d 70 04             	lea    0x4(%eax),%esi
+  80314c:	83 ec 08             	sub    $0x8,%esp
+  80314f:	53                   	push   %ebx
+  803150:	ff 30                	push   (%eax)
+  803152:	ff d7                	call   *%edi
+			break;
+  803154:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  803157:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80315a:	e9 d4 fe ff ff       	jmp    803033 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80315f:	89 55 10             	mov    %edx,0x10(%ebp)
+  803162:	8b 45 14             	mov    0x14(%ebp),%eax
+  803165:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  803168:	8b 10                	mov    (%eax),%edx
+  80316a:	89 d0                	mov    %edx,%eax
+  80316c:	f7 d8                	neg    %eax
+  80316e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  803171:	83 f8 12             	cmp    $0x12,%eax
+  803174:	7f 23                	jg     803199 <vprintfmt+0x177>
+  803176:	8b 14 85 60 3f 80 00 	mov    0x803f60(,%eax,4),%edx
+  80317d:	85 d2                	test   %edx,%edx
+  80317f:	74 18                	je     803199 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  803181:	52                   	push   %edx
+  803182:	68 1f 3c 80 00       	push   $0x803c1f
+  803187:	53                   	push   %ebx
+  803188:	57                   	push   %edi
+  803189:	e8 77 fe ff ff       	call   803005 <printfmt>
+  80318e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803191:	89 75 14             	mov    %esi,0x14(%ebp)
+  803194:	e9 9a fe ff ff       	jmp    803033 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  803199:	50                   	push   %eax
+  80319a:	68 ab 3c 80 00       	push   $0x803cab
+  80319f:	53                   	push   %ebx
+  8031a0:	57                   	push   %edi
+  8031a1:	e8 5f fe ff ff       	call   803005 <printfmt>
+  8031a6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8031a9:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8031ac:	e9 82 fe ff ff       	jmp    803033 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8031b1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8031b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031b7:	83 c0 04             	add    $0x4,%eax
+  8031ba:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8031bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031c0:	8b 00                	mov    (%eax),%eax
+  8031c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	0f 84 61 03 00 00    	je     80352e <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8031cd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8031d1:	7e 06                	jle    8031d9 <vprintfmt+0x1b7>
+  8031d3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8031d7:	75 29                	jne    803202 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8031d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8031dc:	8d 70 01             	lea    0x1(%eax),%esi
+  8031df:	0f b6 00             	movzbl (%eax),%eax
+  8031e2:	0f be d0             	movsbl %al,%edx
+  8031e5:	85 d2                	test   %edx,%edx
+  8031e7:	0f 84 bb 00 00 00    	je     8032a8 <vprintfmt+0x286>
+  8031ed:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8031f0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8031f3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8031f6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8031f9:	eb 7a                	jmp    803275 <vprintfmt+0x253>
+				p = "(null)";
+  8031fb:	c7 45 d0 a4 3c 80 00 	movl   $0x803ca4,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803202:	83 ec 08             	sub    $0x8,%esp
+  803205:	ff 75 d4             	push   -0x2c(%ebp)
+  803208:	ff 75 d0             	push   -0x30(%ebp)
+  80320b:	e8 9f cf ff ff       	call   8001af <strnlen>
+  803210:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  803213:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803216:	83 c4 10             	add    $0x10,%esp
+  803219:	85 d2                	test   %edx,%edx
+  80321b:	0f 8e d6 02 00 00    	jle    8034f7 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  803221:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  803225:	83 ec 08             	sub    $0x8,%esp
+  803228:	53                   	push   %ebx
+  803229:	56                   	push   %esi
+  80322a:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80322c:	83 c4 10             	add    $0x10,%esp
+  80322f:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  803233:	75 f0                	jne    803225 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803235:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803238:	8d 70 01             	lea    0x1(%eax),%esi
+  80323b:	0f b6 00             	movzbl (%eax),%eax
+  80323e:	0f be d0             	movsbl %al,%edx
+  803241:	85 d2                	test   %edx,%edx
+  803243:	0f 84 da 02 00 00    	je     803523 <vprintfmt+0x501>
+  803249:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80324c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80324f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803252:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803255:	eb 1e                	jmp    803275 <vprintfmt+0x253>
+					putch(ch, putdat);
+  803257:	83 ec 08             	sub    $0x8,%esp
+  80325a:	ff 75 0c             	push   0xc(%ebp)
+  80325d:	52                   	push   %edx
+  80325e:	ff 55 08             	call   *0x8(%ebp)
+  803261:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803264:	83 eb 01             	sub    $0x1,%ebx
+  803267:	83 c6 01             	add    $0x1,%esi
+  80326a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80326e:	0f be d0             	movsbl %al,%edx
+  803271:	85 d2                	test   %edx,%edx
+  803273:	74 2a                	je     80329f <vprintfmt+0x27d>
+  803275:	85 ff                	test   %edi,%edi
+  803277:	78 05                	js     80327e <vprintfmt+0x25c>
+  803279:	83 ef 01             	sub    $0x1,%edi
+  80327c:	78 59                	js     8032d7 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80327e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  803282:	74 d3                	je     803257 <vprintfmt+0x235>
+  803284:	0f be c0             	movsbl %al,%eax
+  803287:	83 e8 20             	sub    $0x20,%eax
+  80328a:	83 f8 5e             	cmp    $0x5e,%eax
+  80328d:	76 c8                	jbe    803257 <vprintfmt+0x235>
+					putch('?', putdat);
+  80328f:	83 ec 08             	sub    $0x8,%esp
+  803292:	ff 75 0c             	push   0xc(%ebp)
+  803295:	6a 3f                	push   $0x3f
+  803297:	ff 55 08             	call   *0x8(%ebp)
+  80329a:	83 c4 10             	add    $0x10,%esp
+  80329d:	eb c5                	jmp    803264 <vprintfmt+0x242>
+  80329f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8032a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8032a8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8032ab:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8032af:	7e 1b                	jle    8032cc <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8032b1:	83 ec 08             	sub    $0x8,%esp
+  8032b4:	53                   	push   %ebx
+  8032b5:	6a 20                	push   $0x20
+  8032b7:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8032b9:	83 c4 10             	add    $0x10,%esp
+  8032bc:	83 ee 01             	sub    $0x1,%esi
+  8032bf:	75 f0                	jne    8032b1 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8032c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8032c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8032c7:	e9 67 fd ff ff       	jmp    803033 <vprintfmt+0x11>
+  8032cc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8032cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8032d2:	e9 5c fd ff ff       	jmp    803033 <vprintfmt+0x11>
+  8032d7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8032da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8032e0:	eb c6                	jmp    8032a8 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8032e2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8032e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8032e8:	83 f9 01             	cmp    $0x1,%ecx
+  8032eb:	7f 1f                	jg     80330c <vprintfmt+0x2ea>
+	else if (lflag)
+  8032ed:	85 c9                	test   %ecx,%ecx
+  8032ef:	74 67                	je     803358 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8032f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032f4:	8b 30                	mov    (%eax),%esi
+  8032f6:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8032f9:	89 f0                	mov    %esi,%eax
+  8032fb:	c1 f8 1f             	sar    $0x1f,%eax
+  8032fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803301:	8b 45 14             	mov    0x14(%ebp),%eax
+  803304:	8d 40 04             	lea    0x4(%eax),%eax
+  803307:	89 45 14             	mov    %eax,0x14(%ebp)
+  80330a:	eb 17                	jmp    803323 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80330c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80330f:	8b 50 04             	mov    0x4(%eax),%edx
+  803312:	8b 00                	mov    (%eax),%eax
+  803314:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803317:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80331a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80331d:	8d 40 08             	lea    0x8(%eax),%eax
+  803320:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803323:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803326:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  803329:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80332e:	85 c9                	test   %ecx,%ecx
+  803330:	0f 89 12 01 00 00    	jns    803448 <vprintfmt+0x426>
+				putch('-', putdat);
+  803336:	83 ec 08             	sub    $0x8,%esp
+  803339:	53                   	push   %ebx
+  80333a:	6a 2d                	push   $0x2d
+  80333c:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80333e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803341:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803344:	f7 da                	neg    %edx
+  803346:	83 d1 00             	adc    $0x0,%ecx
+  803349:	f7 d9                	neg    %ecx
+  80334b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80334e:	be 0a 00 00 00       	mov    $0xa,%esi
+  803353:	e9 f0 00 00 00       	jmp    803448 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  803358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80335b:	8b 30                	mov    (%eax),%esi
+  80335d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  803360:	89 f0                	mov    %esi,%eax
+  803362:	c1 f8 1f             	sar    $0x1f,%eax
+  803365:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803368:	8b 45 14             	mov    0x14(%ebp),%eax
+  80336b:	8d 40 04             	lea    0x4(%eax),%eax
+  80336e:	89 45 14             	mov    %eax,0x14(%ebp)
+  803371:	eb b0                	jmp    803323 <vprintfmt+0x301>
+	if (lflag >= 2)
+  803373:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803376:	89 55 10             	mov    %edx,0x10(%ebp)
+  803379:	83 f9 01             	cmp    $0x1,%ecx
+  80337c:	7f 1e                	jg     80339c <vprintfmt+0x37a>
+	else if (lflag)
+  80337e:	85 c9                	test   %ecx,%ecx
+  803380:	74 32                	je     8033b4 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  803382:	8b 45 14             	mov    0x14(%ebp),%eax
+  803385:	8b 10                	mov    (%eax),%edx
+  803387:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80338c:	8d 40 04             	lea    0x4(%eax),%eax
+  80338f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  803392:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  803397:	e9 ac 00 00 00       	jmp    803448 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80339c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80339f:	8b 10                	mov    (%eax),%edx
+  8033a1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8033a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8033a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8033aa:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8033af:	e9 94 00 00 00       	jmp    803448 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8033b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033b7:	8b 10                	mov    (%eax),%edx
+  8033b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033be:	8d 40 04             	lea    0x4(%eax),%eax
+  8033c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8033c4:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8033c9:	eb 7d                	jmp    803448 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8033cb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8033ce:	89 55 10             	mov    %edx,0x10(%ebp)
+  8033d1:	83 f9 01             	cmp    $0x1,%ecx
+  8033d4:	7f 1b                	jg     8033f1 <vprintfmt+0x3cf>
+	else if (lflag)
+  8033d6:	85 c9                	test   %ecx,%ecx
+  8033d8:	74 2c                	je     803406 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8033da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033dd:	8b 10                	mov    (%eax),%edx
+  8033df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8033e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8033ea:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8033ef:	eb 57                	jmp    803448 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8033f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033f4:	8b 10                	mov    (%eax),%edx
+  8033f6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8033f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8033fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8033ff:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  803404:	eb 42                	jmp    803448 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803406:	8b 45 14             	mov    0x14(%ebp),%eax
+  803409:	8b 10                	mov    (%eax),%edx
+  80340b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803410:	8d 40 04             	lea    0x4(%eax),%eax
+  803413:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803416:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80341b:	eb 2b                	jmp    803448 <vprintfmt+0x426>
+			putch('0', putdat);
+  80341d:	89 55 10             	mov    %edx,0x10(%ebp)
+  803420:	83 ec 08             	sub    $0x8,%esp
+  803423:	53                   	push   %ebx
+  803424:	6a 30                	push   $0x30
+  803426:	ff d7                	call   *%edi
+			putch('x', putdat);
+  803428:	83 c4 08             	add    $0x8,%esp
+  80342b:	53                   	push   %ebx
+  80342c:	6a 78                	push   $0x78
+  80342e:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  803430:	8b 45 14             	mov    0x14(%ebp),%eax
+  803433:	8b 10                	mov    (%eax),%edx
+  803435:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80343a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80343d:	8d 40 04             	lea    0x4(%eax),%eax
+  803440:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803443:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  803448:	83 ec 0c             	sub    $0xc,%esp
+  80344b:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80344f:	50                   	push   %eax
+  803450:	ff 75 e4             	push   -0x1c(%ebp)
+  803453:	56                   	push   %esi
+  803454:	51                   	push   %ecx
+  803455:	52                   	push   %edx
+  803456:	89 da                	mov    %ebx,%edx
+  803458:	89 f8                	mov    %edi,%eax
+  80345a:	e8 d8 fa ff ff       	call   802f37 <printnum>
+			break;
+  80345f:	83 c4 20             	add    $0x20,%esp
+  803462:	e9 cc fb ff ff       	jmp    803033 <vprintfmt+0x11>
+	if (lflag >= 2)
+  803467:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80346a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80346d:	83 f9 01             	cmp    $0x1,%ecx
+  803470:	7f 1b                	jg     80348d <vprintfmt+0x46b>
+	else if (lflag)
+  803472:	85 c9                	test   %ecx,%ecx
+  803474:	74 2c                	je     8034a2 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803476:	8b 45 14             	mov    0x14(%ebp),%eax
+  803479:	8b 10                	mov    (%eax),%edx
+  80347b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803480:	8d 40 04             	lea    0x4(%eax),%eax
+  803483:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803486:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80348b:	eb bb                	jmp    803448 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80348d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803490:	8b 10                	mov    (%eax),%edx
+  803492:	8b 48 04             	mov    0x4(%eax),%ecx
+  803495:	8d 40 08             	lea    0x8(%eax),%eax
+  803498:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80349b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8034a0:	eb a6                	jmp    803448 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8034a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034a5:	8b 10                	mov    (%eax),%edx
+  8034a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8034af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8034b2:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8034b7:	eb 8f                	jmp    803448 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8034b9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8034bc:	83 ec 08             	sub    $0x8,%esp
+  8034bf:	53                   	push   %ebx
+  8034c0:	6a 25                	push   $0x25
+  8034c2:	ff d7                	call   *%edi
+			break;
+  8034c4:	83 c4 10             	add    $0x10,%esp
+  8034c7:	e9 67 fb ff ff       	jmp    803033 <vprintfmt+0x11>
+			putch('%', putdat);
+  8034cc:	83 ec 08             	sub    $0x8,%esp
+  8034cf:	53                   	push   %ebx
+  8034d0:	6a 25                	push   $0x25
+  8034d2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8034d4:	83 c4 10             	add    $0x10,%esp
+  8034d7:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8034db:	0f 84 ba fb ff ff    	je     80309b <vprintfmt+0x79>
+  8034e1:	89 75 10             	mov    %esi,0x10(%ebp)
+  8034e4:	89 f0                	mov    %esi,%eax
+  8034e6:	83 e8 01             	sub    $0x1,%eax
+  8034e9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8034ed:	75 f7                	jne    8034e6 <vprintfmt+0x4c4>
+  8034ef:	89 45 10             	mov    %eax,0x10(%ebp)
+  8034f2:	e9 3c fb ff ff       	jmp    803033 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8034f7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8034fa:	8d 70 01             	lea    0x1(%eax),%esi
+  8034fd:	0f b6 00             	movzbl (%eax),%eax
+  803500:	0f be d0             	movsbl %al,%edx
+  803503:	85 d2                	test   %edx,%edx
+  803505:	74 11                	je     803518 <vprintfmt+0x4f6>
+  803507:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80350a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80350d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803510:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803513:	e9 5d fd ff ff       	jmp    803275 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803518:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80351b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80351e:	e9 10 fb ff ff       	jmp    803033 <vprintfmt+0x11>
+  803523:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803526:	89 45 14             	mov    %eax,0x14(%ebp)
+  803529:	e9 05 fb ff ff       	jmp    803033 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  80352e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803532:	7e 0a                	jle    80353e <vprintfmt+0x51c>
+  803534:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  803538:	0f 85 bd fc ff ff    	jne    8031fb <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80353e:	ba 28 00 00 00       	mov    $0x28,%edx
+  803543:	b8 28 00 00 00       	mov    $0x28,%eax
+  803548:	be a5 3c 80 00       	mov    $0x803ca5,%esi
+  80354d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  803550:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803553:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803556:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803559:	e9 17 fd ff ff       	jmp    803275 <vprintfmt+0x253>
+}
+  80355e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803561:	5b                   	pop    %ebx
+  803562:	5e                   	pop    %esi
+  803563:	5f                   	pop    %edi
+  803564:	5d                   	pop    %ebp
+  803565:	c3                   	ret
+
+00803566 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803566:	55                   	push   %ebp
+  803567:	89 e5                	mov    %esp,%ebp
+  803569:	83 ec 18             	sub    $0x18,%esp
+  80356c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80356f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803572:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803575:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803579:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80357c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803583:	85 c0                	test   %eax,%eax
+  803585:	74 26                	je     8035ad <vsnprintf+0x47>
+  803587:	85 d2                	test   %edx,%edx
+  803589:	7e 22                	jle    8035ad <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80358b:	ff 75 14             	push   0x14(%ebp)
+  80358e:	ff 75 10             	push   0x10(%ebp)
+  803591:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803594:	50                   	push   %eax
+  803595:	68 e8 2f 80 00       	push   $0x802fe8
+  80359a:	e8 83 fa ff ff       	call   803022 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80359f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8035a2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8035a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035a8:	83 c4 10             	add    $0x10,%esp
+}
+  8035ab:	c9                   	leave
+  8035ac:	c3                   	ret
+		return -E_INVAL;
+  8035ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035b2:	eb f7                	jmp    8035ab <vsnprintf+0x45>
+
+008035b4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8035b4:	55                   	push   %ebp
+  8035b5:	89 e5                	mov    %esp,%ebp
+  8035b7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8035ba:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8035bd:	50                   	push   %eax
+  8035be:	ff 75 10             	push   0x10(%ebp)
+  8035c1:	ff 75 0c             	push   0xc(%ebp)
+  8035c4:	ff 75 08             	push   0x8(%ebp)
+  8035c7:	e8 9a ff ff ff       	call   803566 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8035cc:	c9                   	leave
+  8035cd:	c3                   	ret
+
+008035ce <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035ce:	55                   	push   %ebp
+  8035cf:	89 e5                	mov    %esp,%ebp
+  8035d1:	56                   	push   %esi
+  8035d2:	53                   	push   %ebx
+  8035d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8035dc:	85 c0                	test   %eax,%eax
+  8035de:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8035e3:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8035e6:	83 ec 0c             	sub    $0xc,%esp
+  8035e9:	50                   	push   %eax
+  8035ea:	e8 ce d1 ff ff       	call   8007bd <sys_ipc_recv>
+  8035ef:	83 c4 10             	add    $0x10,%esp
+  8035f2:	85 c0                	test   %eax,%eax
+  8035f4:	0f 88 8b 00 00 00    	js     803685 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8035fa:	85 f6                	test   %esi,%esi
+  8035fc:	74 2a                	je     803628 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8035fe:	89 e2                	mov    %esp,%edx
+  803600:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803605:	29 d0                	sub    %edx,%eax
+  803607:	89 c2                	mov    %eax,%edx
+  803609:	c1 ea 0f             	shr    $0xf,%edx
+  80360c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803611:	b8 00 00 00 00       	mov    $0x0,%eax
+  803616:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803619:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803620:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803626:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803628:	85 db                	test   %ebx,%ebx
+  80362a:	74 2a                	je     803656 <ipc_recv+0x88>
+  80362c:	89 e2                	mov    %esp,%edx
+  80362e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803633:	29 d0                	sub    %edx,%eax
+  803635:	89 c2                	mov    %eax,%edx
+  803637:	c1 ea 0f             	shr    $0xf,%edx
+  80363a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80363f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803644:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803647:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80364e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803654:	89 03                	mov    %eax,(%ebx)
+  803656:	89 e2                	mov    %esp,%edx
+  803658:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80365d:	29 d0                	sub    %edx,%eax
+  80365f:	89 c2                	mov    %eax,%edx
+  803661:	c1 ea 0f             	shr    $0xf,%edx
+  803664:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366e:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803671:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803678:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80367e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803681:	5b                   	pop    %ebx
+  803682:	5e                   	pop    %esi
+  803683:	5d                   	pop    %ebp
+  803684:	c3                   	ret
+		if(from_env_store != NULL)
+  803685:	85 f6                	test   %esi,%esi
+  803687:	74 06                	je     80368f <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803689:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80368f:	85 db                	test   %ebx,%ebx
+  803691:	74 eb                	je     80367e <ipc_recv+0xb0>
+			*perm_store = 0;
+  803693:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803699:	eb e3                	jmp    80367e <ipc_recv+0xb0>
+
+0080369b <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80369b:	55                   	push   %ebp
+  80369c:	89 e5                	mov    %esp,%ebp
+  80369e:	57                   	push   %edi
+  80369f:	56                   	push   %esi
+  8036a0:	53                   	push   %ebx
+  8036a1:	83 ec 14             	sub    $0x14,%esp
+  8036a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036aa:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036ad:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036b7:	0f 44 c2             	cmove  %edx,%eax
+  8036ba:	ff 75 10             	push   0x10(%ebp)
+  8036bd:	50                   	push   %eax
+  8036be:	e8 5c d1 ff ff       	call   80081f <sys_ipc_recv_pages>
+  8036c3:	83 c4 10             	add    $0x10,%esp
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	0f 88 ba 00 00 00    	js     803788 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8036ce:	85 ff                	test   %edi,%edi
+  8036d0:	74 2a                	je     8036fc <ipc_recv_pages+0x61>
+  8036d2:	89 e2                	mov    %esp,%edx
+  8036d4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036d9:	29 d0                	sub    %edx,%eax
+  8036db:	89 c2                	mov    %eax,%edx
+  8036dd:	c1 ea 0f             	shr    $0xf,%edx
+  8036e0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ea:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8036ed:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8036f4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8036fa:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8036fc:	85 f6                	test   %esi,%esi
+  8036fe:	74 2a                	je     80372a <ipc_recv_pages+0x8f>
+  803700:	89 e2                	mov    %esp,%edx
+  803702:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803707:	29 d0                	sub    %edx,%eax
+  803709:	89 c2                	mov    %eax,%edx
+  80370b:	c1 ea 0f             	shr    $0xf,%edx
+  80370e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803713:	b8 00 00 00 00       	mov    $0x0,%eax
+  803718:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80371b:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803722:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803728:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80372a:	85 db                	test   %ebx,%ebx
+  80372c:	74 2a                	je     803758 <ipc_recv_pages+0xbd>
+  80372e:	89 e2                	mov    %esp,%edx
+  803730:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803735:	29 d0                	sub    %edx,%eax
+  803737:	89 c2                	mov    %eax,%edx
+  803739:	c1 ea 0f             	shr    $0xf,%edx
+  80373c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803741:	b8 00 00 00 00       	mov    $0x0,%eax
+  803746:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803749:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803750:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803756:	89 03                	mov    %eax,(%ebx)
+  803758:	89 e2                	mov    %esp,%edx
+  80375a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80375f:	29 d0                	sub    %edx,%eax
+  803761:	89 c2                	mov    %eax,%edx
+  803763:	c1 ea 0f             	shr    $0xf,%edx
+  803766:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80376b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803770:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803773:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80377a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803783:	5b                   	pop    %ebx
+  803784:	5e                   	pop    %esi
+  803785:	5f                   	pop    %edi
+  803786:	5d                   	pop    %ebp
+  803787:	c3                   	ret
+		if (from_env_store)
+  803788:	85 ff                	test   %edi,%edi
+  80378a:	74 06                	je     803792 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80378c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803792:	85 f6                	test   %esi,%esi
+  803794:	74 06                	je     80379c <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803796:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80379c:	85 db                	test   %ebx,%ebx
+  80379e:	74 e0                	je     803780 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8037a0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037a6:	eb d8                	jmp    803780 <ipc_recv_pages+0xe5>
+
+008037a8 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8037a8:	55                   	push   %ebp
+  8037a9:	89 e5                	mov    %esp,%ebp
+  8037ab:	57                   	push   %edi
+  8037ac:	56                   	push   %esi
+  8037ad:	53                   	push   %ebx
+  8037ae:	83 ec 1c             	sub    $0x1c,%esp
+  8037b1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8037b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037b7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037bd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8037c1:	75 2b                	jne    8037ee <ipc_try_send_pages+0x46>
+  8037c3:	89 e2                	mov    %esp,%edx
+  8037c5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037ca:	29 d0                	sub    %edx,%eax
+  8037cc:	89 c2                	mov    %eax,%edx
+  8037ce:	c1 ea 0f             	shr    $0xf,%edx
+  8037d1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037db:	0f 42 c2             	cmovb  %edx,%eax
+  8037de:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037e5:	8b 70 48             	mov    0x48(%eax),%esi
+  8037e8:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037ee:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8037f4:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8037f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037fc:	85 ff                	test   %edi,%edi
+  8037fe:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803803:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803806:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80380c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803812:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803818:	83 ec 0c             	sub    $0xc,%esp
+  80381b:	ff 75 14             	push   0x14(%ebp)
+  80381e:	ff 75 18             	push   0x18(%ebp)
+  803821:	57                   	push   %edi
+  803822:	ff 75 0c             	push   0xc(%ebp)
+  803825:	ff 75 08             	push   0x8(%ebp)
+  803828:	e8 d1 cf ff ff       	call   8007fe <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80382d:	83 c4 20             	add    $0x20,%esp
+  803830:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803833:	75 21                	jne    803856 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803835:	83 ec 04             	sub    $0x4,%esp
+  803838:	6a ff                	push   $0xffffffff
+  80383a:	53                   	push   %ebx
+  80383b:	ff 75 e4             	push   -0x1c(%ebp)
+  80383e:	e8 c8 d1 ff ff       	call   800a0b <sys_futex_wait>
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803849:	74 c7                	je     803812 <ipc_try_send_pages+0x6a>
+  80384b:	85 c0                	test   %eax,%eax
+  80384d:	79 c3                	jns    803812 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80384f:	e8 9a cd ff ff       	call   8005ee <sys_yield>
+  803854:	eb bc                	jmp    803812 <ipc_try_send_pages+0x6a>
+	}
+}
+  803856:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803859:	5b                   	pop    %ebx
+  80385a:	5e                   	pop    %esi
+  80385b:	5f                   	pop    %edi
+  80385c:	5d                   	pop    %ebp
+  80385d:	c3                   	ret
+
+0080385e <ipc_send>:
+{
+  80385e:	55                   	push   %ebp
+  80385f:	89 e5                	mov    %esp,%ebp
+  803861:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803864:	ff 75 14             	push   0x14(%ebp)
+  803867:	6a 01                	push   $0x1
+  803869:	ff 75 10             	push   0x10(%ebp)
+  80386c:	ff 75 0c             	push   0xc(%ebp)
+  80386f:	ff 75 08             	push   0x8(%ebp)
+  803872:	e8 31 ff ff ff       	call   8037a8 <ipc_try_send_pages>
+  803877:	83 c4 20             	add    $0x20,%esp
+  80387a:	85 c0                	test   %eax,%eax
+  80387c:	78 02                	js     803880 <ipc_send+0x22>
+}
+  80387e:	c9                   	leave
+  80387f:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803880:	50                   	push   %eax
+  803881:	68 cb 3f 80 00       	push   $0x803fcb
+  803886:	6a 3f                	push   $0x3f
+  803888:	68 e0 3f 80 00       	push   $0x803fe0
+  80388d:	e8 b6 f5 ff ff       	call   802e48 <_panic>
+
+00803892 <ipc_send_pages>:
+{
+  803892:	55                   	push   %ebp
+  803893:	89 e5                	mov    %esp,%ebp
+  803895:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803898:	ff 75 18             	push   0x18(%ebp)
+  80389b:	ff 75 14             	push   0x14(%ebp)
+  80389e:	ff 75 10             	push   0x10(%ebp)
+  8038a1:	ff 75 0c             	push   0xc(%ebp)
+  8038a4:	ff 75 08             	push   0x8(%ebp)
+  8038a7:	e8 fc fe ff ff       	call   8037a8 <ipc_try_send_pages>
+  8038ac:	83 c4 20             	add    $0x20,%esp
+  8038af:	85 c0                	test   %eax,%eax
+  8038b1:	78 02                	js     8038b5 <ipc_send_pages+0x23>
+}
+  8038b3:	c9                   	leave
+  8038b4:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8038b5:	50                   	push   %eax
+  8038b6:	68 ea 3f 80 00       	push   $0x803fea
+  8038bb:	6a 64                	push   $0x64
+  8038bd:	68 e0 3f 80 00       	push   $0x803fe0
+  8038c2:	e8 81 f5 ff ff       	call   802e48 <_panic>
+
+008038c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8038c7:	55                   	push   %ebp
+  8038c8:	89 e5                	mov    %esp,%ebp
+  8038ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8038cd:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038d2:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8038d8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038de:	8b 52 50             	mov    0x50(%edx),%edx
+  8038e1:	39 ca                	cmp    %ecx,%edx
+  8038e3:	74 11                	je     8038f6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038e5:	83 c0 01             	add    $0x1,%eax
+  8038e8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038ed:	75 e3                	jne    8038d2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f4:	eb 0e                	jmp    803904 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8038f6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8038fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803901:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803904:	5d                   	pop    %ebp
+  803905:	c3                   	ret
+
+00803906 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803906:	55                   	push   %ebp
+  803907:	89 e5                	mov    %esp,%ebp
+  803909:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80390c:	89 c2                	mov    %eax,%edx
+  80390e:	c1 ea 16             	shr    $0x16,%edx
+  803911:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803918:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80391d:	f6 c1 01             	test   $0x1,%cl
+  803920:	74 1e                	je     803940 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803922:	c1 e8 0c             	shr    $0xc,%eax
+  803925:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80392c:	a8 01                	test   $0x1,%al
+  80392e:	74 10                	je     803940 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803930:	c1 e8 0c             	shr    $0xc,%eax
+  803933:	c1 e0 04             	shl    $0x4,%eax
+  803936:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80393d:	0f b7 d2             	movzwl %dx,%edx
+}
+  803940:	89 d0                	mov    %edx,%eax
+  803942:	5d                   	pop    %ebp
+  803943:	c3                   	ret
+
+00803944 <__udivdi3>:
+  803944:	57                   	push   %edi
+  803945:	56                   	push   %esi
+  803946:	53                   	push   %ebx
+  803947:	83 ec 20             	sub    $0x20,%esp
+  80394a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80394e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803952:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803956:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80395a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80395e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803962:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803966:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80396a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80396f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803974:	ba 00 00 00 00       	mov    $0x0,%edx
+  803979:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803980:	00 
+  803981:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803988:	00 
+  803989:	eb 08                	jmp    803993 <__udivdi3+0x4f>
+  80398b:	83 e9 01             	sub    $0x1,%ecx
+  80398e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803991:	74 68                	je     8039fb <__udivdi3+0xb7>
+  803993:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803997:	01 c0                	add    %eax,%eax
+  803999:	89 c6                	mov    %eax,%esi
+  80399b:	89 d7                	mov    %edx,%edi
+  80399d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039a1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039a5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039a8:	d3 ea                	shr    %cl,%edx
+  8039aa:	f6 c1 20             	test   $0x20,%cl
+  8039ad:	74 04                	je     8039b3 <__udivdi3+0x6f>
+  8039af:	89 d0                	mov    %edx,%eax
+  8039b1:	31 d2                	xor    %edx,%edx
+  8039b3:	83 e0 01             	and    $0x1,%eax
+  8039b6:	89 04 24             	mov    %eax,(%esp)
+  8039b9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8039c0:	00 
+  8039c1:	8b 04 24             	mov    (%esp),%eax
+  8039c4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039c8:	09 f0                	or     %esi,%eax
+  8039ca:	09 fa                	or     %edi,%edx
+  8039cc:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039d0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039d4:	39 f0                	cmp    %esi,%eax
+  8039d6:	89 d3                	mov    %edx,%ebx
+  8039d8:	19 fb                	sbb    %edi,%ebx
+  8039da:	72 af                	jb     80398b <__udivdi3+0x47>
+  8039dc:	29 f0                	sub    %esi,%eax
+  8039de:	19 fa                	sbb    %edi,%edx
+  8039e0:	89 cf                	mov    %ecx,%edi
+  8039e2:	c1 ef 05             	shr    $0x5,%edi
+  8039e5:	83 e7 01             	and    $0x1,%edi
+  8039e8:	89 fe                	mov    %edi,%esi
+  8039ea:	83 f6 01             	xor    $0x1,%esi
+  8039ed:	d3 e6                	shl    %cl,%esi
+  8039ef:	d3 e7                	shl    %cl,%edi
+  8039f1:	09 74 24 18          	or     %esi,0x18(%esp)
+  8039f5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8039f9:	eb 90                	jmp    80398b <__udivdi3+0x47>
+  8039fb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039ff:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a03:	83 c4 20             	add    $0x20,%esp
+  803a06:	5b                   	pop    %ebx
+  803a07:	5e                   	pop    %esi
+  803a08:	5f                   	pop    %edi
+  803a09:	c3                   	ret
+
+00803a0a <__umoddi3>:
+  803a0a:	57                   	push   %edi
+  803a0b:	56                   	push   %esi
+  803a0c:	53                   	push   %ebx
+  803a0d:	83 ec 08             	sub    $0x8,%esp
+  803a10:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a14:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a18:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a1c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a20:	57                   	push   %edi
+  803a21:	56                   	push   %esi
+  803a22:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a26:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a2a:	52                   	push   %edx
+  803a2b:	50                   	push   %eax
+  803a2c:	e8 13 ff ff ff       	call   803944 <__udivdi3>
+  803a31:	89 c3                	mov    %eax,%ebx
+  803a33:	0f af d6             	imul   %esi,%edx
+  803a36:	89 f9                	mov    %edi,%ecx
+  803a38:	0f af cb             	imul   %ebx,%ecx
+  803a3b:	01 d1                	add    %edx,%ecx
+  803a3d:	89 d8                	mov    %ebx,%eax
+  803a3f:	f7 e6                	mul    %esi
+  803a41:	89 c6                	mov    %eax,%esi
+  803a43:	89 d7                	mov    %edx,%edi
+  803a45:	01 cf                	add    %ecx,%edi
+  803a47:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a4b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a4f:	29 f0                	sub    %esi,%eax
+  803a51:	19 fa                	sbb    %edi,%edx
+  803a53:	83 c4 18             	add    $0x18,%esp
+  803a56:	5b                   	pop    %ebx
+  803a57:	5e                   	pop    %esi
+  803a58:	5f                   	pop    %edi
+  803a59:	c3                   	ret
+
+00803a5a <__divdi3>:
+  803a5a:	53                   	push   %ebx
+  803a5b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a5f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a63:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a67:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a6b:	85 d2                	test   %edx,%edx
+  803a6d:	78 12                	js     803a81 <__divdi3+0x27>
+  803a6f:	85 db                	test   %ebx,%ebx
+  803a71:	78 2e                	js     803aa1 <__divdi3+0x47>
+  803a73:	53                   	push   %ebx
+  803a74:	51                   	push   %ecx
+  803a75:	52                   	push   %edx
+  803a76:	50                   	push   %eax
+  803a77:	e8 c8 fe ff ff       	call   803944 <__udivdi3>
+  803a7c:	83 c4 10             	add    $0x10,%esp
+  803a7f:	eb 1e                	jmp    803a9f <__divdi3+0x45>
+  803a81:	f7 d8                	neg    %eax
+  803a83:	83 d2 00             	adc    $0x0,%edx
+  803a86:	f7 da                	neg    %edx
+  803a88:	85 db                	test   %ebx,%ebx
+  803a8a:	78 2a                	js     803ab6 <__divdi3+0x5c>
+  803a8c:	53                   	push   %ebx
+  803a8d:	51                   	push   %ecx
+  803a8e:	52                   	push   %edx
+  803a8f:	50                   	push   %eax
+  803a90:	e8 af fe ff ff       	call   803944 <__udivdi3>
+  803a95:	83 c4 10             	add    $0x10,%esp
+  803a98:	f7 d8                	neg    %eax
+  803a9a:	83 d2 00             	adc    $0x0,%edx
+  803a9d:	f7 da                	neg    %edx
+  803a9f:	5b                   	pop    %ebx
+  803aa0:	c3                   	ret
+  803aa1:	f7 d9                	neg    %ecx
+  803aa3:	83 d3 00             	adc    $0x0,%ebx
+  803aa6:	f7 db                	neg    %ebx
+  803aa8:	53                   	push   %ebx
+  803aa9:	51                   	push   %ecx
+  803aaa:	52                   	push   %edx
+  803aab:	50                   	push   %eax
+  803aac:	e8 93 fe ff ff       	call   803944 <__udivdi3>
+  803ab1:	83 c4 10             	add    $0x10,%esp
+  803ab4:	eb e2                	jmp    803a98 <__divdi3+0x3e>
+  803ab6:	f7 d9                	neg    %ecx
+  803ab8:	83 d3 00             	adc    $0x0,%ebx
+  803abb:	f7 db                	neg    %ebx
+  803abd:	53                   	push   %ebx
+  803abe:	51                   	push   %ecx
+  803abf:	52                   	push   %edx
+  803ac0:	50                   	push   %eax
+  803ac1:	e8 7e fe ff ff       	call   803944 <__udivdi3>
+  803ac6:	83 c4 10             	add    $0x10,%esp
+  803ac9:	eb d4                	jmp    803a9f <__divdi3+0x45>
+
+00803acb <__moddi3>:
+  803acb:	57                   	push   %edi
+  803acc:	56                   	push   %esi
+  803acd:	53                   	push   %ebx
+  803ace:	83 ec 08             	sub    $0x8,%esp
+  803ad1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ad5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ad9:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803add:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803ae1:	57                   	push   %edi
+  803ae2:	56                   	push   %esi
+  803ae3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803ae7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803aeb:	52                   	push   %edx
+  803aec:	50                   	push   %eax
+  803aed:	e8 68 ff ff ff       	call   803a5a <__divdi3>
+  803af2:	89 c3                	mov    %eax,%ebx
+  803af4:	0f af d6             	imul   %esi,%edx
+  803af7:	89 f9                	mov    %edi,%ecx
+  803af9:	0f af cb             	imul   %ebx,%ecx
+  803afc:	01 d1                	add    %edx,%ecx
+  803afe:	89 d8                	mov    %ebx,%eax
+  803b00:	f7 e6                	mul    %esi
+  803b02:	89 c6                	mov    %eax,%esi
+  803b04:	89 d7                	mov    %edx,%edi
+  803b06:	01 cf                	add    %ecx,%edi
+  803b08:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b0c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b10:	29 f0                	sub    %esi,%eax
+  803b12:	19 fa                	sbb    %edi,%edx
+  803b14:	83 c4 18             	add    $0x18,%esp
+  803b17:	5b                   	pop    %ebx
+  803b18:	5e                   	pop    %esi
+  803b19:	5f                   	pop    %edi
+  803b1a:	c3                   	ret
@@ -0,0 +1,8639 @@
+
+obj/user/echobulk.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f0 02 00 00       	call   800321 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+
+static char buf[NSBULK_PAGES * PGSIZE];
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 80 40 80 00       	push   $0x804080
+  800041:	e8 17 04 00 00       	call   80045d <cprintf>
+	exit();
+  800046:	e8 63 03 00 00       	call   8003ae <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <echo_bulk>:
+	return reqs + 1;
+}
+
+static uint32_t
+echo_bulk(int sock, uint32_t *bytes)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	57                   	push   %edi
+  800054:	56                   	push   %esi
+  800055:	53                   	push   %ebx
+  800056:	83 ec 50             	sub    $0x50,%esp
+  800059:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct msghdr msg;
+	uint32_t reqs = 0;
+	int n;
+
+	// Split the buffer, as a server reading a header and a body would.
+	iov[0].iov_base = buf;
+  80005c:	c7 45 d8 00 60 80 00 	movl   $0x806000,-0x28(%ebp)
+	iov[0].iov_len = HDRSIZE;
+  800063:	c7 45 dc 00 10 00 00 	movl   $0x1000,-0x24(%ebp)
+	iov[1].iov_base = buf + HDRSIZE;
+  80006a:	c7 45 e0 00 70 80 00 	movl   $0x807000,-0x20(%ebp)
+	iov[1].iov_len = sizeof(buf) - HDRSIZE;
+  800071:	c7 45 e4 00 f0 00 00 	movl   $0xf000,-0x1c(%ebp)
+	memset(&msg, 0, sizeof(msg));
+  800078:	6a 14                	push   $0x14
+  80007a:	6a 00                	push   $0x0
+  80007c:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  80007f:	50                   	push   %eax
+  800080:	e8 4a 0c 00 00       	call   800ccf <memset>
+	msg.msg_iov = iov;
+  800085:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800088:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	msg.msg_iovlen = 2;
+  80008b:	c7 45 d0 02 00 00 00 	movl   $0x2,-0x30(%ebp)
+
+	while ((n = recvmsg(sock, &msg, MSG_BATCH)) > 0) {
+  800092:	83 c4 10             	add    $0x10,%esp
+	uint32_t reqs = 0;
+  800095:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+	while ((n = recvmsg(sock, &msg, MSG_BATCH)) > 0) {
+  80009c:	8d 75 c4             	lea    -0x3c(%ebp),%esi
+  80009f:	eb 17                	jmp    8000b8 <echo_bulk+0x68>
+		iov[1].iov_len = n > HDRSIZE ? n - HDRSIZE : 0;
+		iov[0].iov_len = MIN(n, HDRSIZE);
+		if (sendmsg(sock, &msg, 0) != n)
+			die("Failed to send bytes to client");
+		iov[0].iov_len = HDRSIZE;
+  8000a1:	c7 45 dc 00 10 00 00 	movl   $0x1000,-0x24(%ebp)
+		iov[1].iov_len = sizeof(buf) - HDRSIZE;
+  8000a8:	c7 45 e4 00 f0 00 00 	movl   $0xf000,-0x1c(%ebp)
+		*bytes += n;
+  8000af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8000b2:	01 18                	add    %ebx,(%eax)
+		reqs += 2;
+  8000b4:	83 45 b4 02          	addl   $0x2,-0x4c(%ebp)
+	while ((n = recvmsg(sock, &msg, MSG_BATCH)) > 0) {
+  8000b8:	83 ec 04             	sub    $0x4,%esp
+  8000bb:	68 00 01 00 00       	push   $0x100
+  8000c0:	56                   	push   %esi
+  8000c1:	57                   	push   %edi
+  8000c2:	e8 66 1f 00 00       	call   80202d <recvmsg>
+  8000c7:	89 c3                	mov    %eax,%ebx
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	85 c0                	test   %eax,%eax
+  8000ce:	7e 3e                	jle    80010e <echo_bulk+0xbe>
+		iov[1].iov_len = n > HDRSIZE ? n - HDRSIZE : 0;
+  8000d0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8000d5:	39 c3                	cmp    %eax,%ebx
+  8000d7:	0f 4d c3             	cmovge %ebx,%eax
+  8000da:	2d 00 10 00 00       	sub    $0x1000,%eax
+  8000df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		iov[0].iov_len = MIN(n, HDRSIZE);
+  8000e2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8000e7:	39 c3                	cmp    %eax,%ebx
+  8000e9:	0f 4e c3             	cmovle %ebx,%eax
+  8000ec:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		if (sendmsg(sock, &msg, 0) != n)
+  8000ef:	83 ec 04             	sub    $0x4,%esp
+  8000f2:	6a 00                	push   $0x0
+  8000f4:	56                   	push   %esi
+  8000f5:	57                   	push   %edi
+  8000f6:	e8 f0 1e 00 00       	call   801feb <sendmsg>
+  8000fb:	83 c4 10             	add    $0x10,%esp
+  8000fe:	39 d8                	cmp    %ebx,%eax
+  800100:	74 9f                	je     8000a1 <echo_bulk+0x51>
+			die("Failed to send bytes to client");
+  800102:	b8 c4 40 80 00       	mov    $0x8040c4,%eax
+  800107:	e8 29 ff ff ff       	call   800035 <die>
+  80010c:	eb 93                	jmp    8000a1 <echo_bulk+0x51>
+	}
+	return reqs + 1;
+  80010e:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  800111:	83 c0 01             	add    $0x1,%eax
+}
+  800114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800117:	5b                   	pop    %ebx
+  800118:	5e                   	pop    %esi
+  800119:	5f                   	pop    %edi
+  80011a:	5d                   	pop    %ebp
+  80011b:	c3                   	ret
+
+0080011c <echo_small>:
+{
+  80011c:	55                   	push   %ebp
+  80011d:	89 e5                	mov    %esp,%ebp
+  80011f:	57                   	push   %edi
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	83 ec 1c             	sub    $0x1c,%esp
+  800125:	8b 75 08             	mov    0x8(%ebp),%esi
+  800128:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t reqs = 0;
+  80012b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	while ((n = read(sock, buf, SMALL)) > 0) {
+  800132:	eb 06                	jmp    80013a <echo_small+0x1e>
+		*bytes += n;
+  800134:	01 1f                	add    %ebx,(%edi)
+		reqs += 2;
+  800136:	83 45 e4 02          	addl   $0x2,-0x1c(%ebp)
+	while ((n = read(sock, buf, SMALL)) > 0) {
+  80013a:	83 ec 04             	sub    $0x4,%esp
+  80013d:	68 00 04 00 00       	push   $0x400
+  800142:	68 00 60 80 00       	push   $0x806000
+  800147:	56                   	push   %esi
+  800148:	e8 99 15 00 00       	call   8016e6 <read>
+  80014d:	89 c3                	mov    %eax,%ebx
+  80014f:	83 c4 10             	add    $0x10,%esp
+  800152:	85 c0                	test   %eax,%eax
+  800154:	7e 22                	jle    800178 <echo_small+0x5c>
+		if (write(sock, buf, n) != n)
+  800156:	83 ec 04             	sub    $0x4,%esp
+  800159:	53                   	push   %ebx
+  80015a:	68 00 60 80 00       	push   $0x806000
+  80015f:	56                   	push   %esi
+  800160:	e8 79 16 00 00       	call   8017de <write>
+  800165:	83 c4 10             	add    $0x10,%esp
+  800168:	39 d8                	cmp    %ebx,%eax
+  80016a:	74 c8                	je     800134 <echo_small+0x18>
+			die("Failed to send bytes to client");
+  80016c:	b8 c4 40 80 00       	mov    $0x8040c4,%eax
+  800171:	e8 bf fe ff ff       	call   800035 <die>
+  800176:	eb bc                	jmp    800134 <echo_small+0x18>
+	return reqs + 1;
+  800178:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80017b:	83 c0 01             	add    $0x1,%eax
+}
+  80017e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+
+00800186 <run>:
+
+static void
+run(int serversock, const char *what,
+    uint32_t (*echo)(int sock, uint32_t *bytes))
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	57                   	push   %edi
+  80018a:	56                   	push   %esi
+  80018b:	53                   	push   %ebx
+  80018c:	83 ec 44             	sub    $0x44,%esp
+  80018f:	89 c6                	mov    %eax,%esi
+  800191:	89 d7                	mov    %edx,%edi
+  800193:	89 cb                	mov    %ecx,%ebx
+	struct sockaddr_in client;
+	unsigned int len = sizeof(client);
+  800195:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+	uint32_t bytes = 0, reqs;
+  80019c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+	unsigned start, ms;
+	int sock;
+
+	cprintf("echobulk: %s: listening\n", what);
+  8001a3:	52                   	push   %edx
+  8001a4:	68 84 40 80 00       	push   $0x804084
+  8001a9:	e8 af 02 00 00       	call   80045d <cprintf>
+	if ((sock = accept(serversock, (struct sockaddr *) &client, &len)) < 0)
+  8001ae:	83 c4 0c             	add    $0xc,%esp
+  8001b1:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  8001b4:	50                   	push   %eax
+  8001b5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8001b8:	50                   	push   %eax
+  8001b9:	56                   	push   %esi
+  8001ba:	e8 58 1d 00 00       	call   801f17 <accept>
+  8001bf:	89 c6                	mov    %eax,%esi
+  8001c1:	83 c4 10             	add    $0x10,%esp
+  8001c4:	85 c0                	test   %eax,%eax
+  8001c6:	78 6f                	js     800237 <run+0xb1>
+		die("Failed to accept client connection");
+	start = sys_time_msec();
+  8001c8:	e8 0f 10 00 00       	call   8011dc <sys_time_msec>
+  8001cd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	reqs = echo(sock, &bytes);
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  8001d6:	50                   	push   %eax
+  8001d7:	56                   	push   %esi
+  8001d8:	ff d3                	call   *%ebx
+  8001da:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	ms = sys_time_msec() - start;
+  8001dd:	e8 fa 0f 00 00       	call   8011dc <sys_time_msec>
+  8001e2:	89 c3                	mov    %eax,%ebx
+  8001e4:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  8001e7:	29 d3                	sub    %edx,%ebx
+	close(sock);
+  8001e9:	89 34 24             	mov    %esi,(%esp)
+  8001ec:	e8 b6 13 00 00       	call   8015a7 <close>
+	cprintf("echobulk: %s: %u bytes in %u ms, %u KB/s, "
+  8001f1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8001f4:	83 c4 08             	add    $0x8,%esp
+  8001f7:	89 c8                	mov    %ecx,%eax
+  8001f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fe:	f7 75 c0             	divl   -0x40(%ebp)
+  800201:	50                   	push   %eax
+		"%u bytes per request\n", what, bytes, ms,
+		bytes / (ms ? ms : 1) * 1000 / 1024, bytes / reqs);
+  800202:	85 db                	test   %ebx,%ebx
+  800204:	be 01 00 00 00       	mov    $0x1,%esi
+  800209:	0f 45 f3             	cmovne %ebx,%esi
+  80020c:	89 c8                	mov    %ecx,%eax
+  80020e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800213:	f7 f6                	div    %esi
+  800215:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+	cprintf("echobulk: %s: %u bytes in %u ms, %u KB/s, "
+  80021b:	c1 e8 0a             	shr    $0xa,%eax
+  80021e:	50                   	push   %eax
+  80021f:	53                   	push   %ebx
+  800220:	51                   	push   %ecx
+  800221:	57                   	push   %edi
+  800222:	68 08 41 80 00       	push   $0x804108
+  800227:	e8 31 02 00 00       	call   80045d <cprintf>
+}
+  80022c:	83 c4 20             	add    $0x20,%esp
+  80022f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800232:	5b                   	pop    %ebx
+  800233:	5e                   	pop    %esi
+  800234:	5f                   	pop    %edi
+  800235:	5d                   	pop    %ebp
+  800236:	c3                   	ret
+		die("Failed to accept client connection");
+  800237:	b8 e4 40 80 00       	mov    $0x8040e4,%eax
+  80023c:	e8 f4 fd ff ff       	call   800035 <die>
+  800241:	eb 85                	jmp    8001c8 <run+0x42>
+
+00800243 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	56                   	push   %esi
+  800247:	53                   	push   %ebx
+  800248:	83 ec 14             	sub    $0x14,%esp
+	struct sockaddr_in addr;
+	int s;
+
+	binaryname = "echobulk";
+  80024b:	c7 05 00 50 80 00 9d 	movl   $0x80409d,0x805000
+  800252:	40 80 00 
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800255:	6a 06                	push   $0x6
+  800257:	6a 01                	push   $0x1
+  800259:	6a 02                	push   $0x2
+  80025b:	e8 9a 1e 00 00       	call   8020fa <socket>
+  800260:	89 c3                	mov    %eax,%ebx
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	85 c0                	test   %eax,%eax
+  800267:	0f 88 8d 00 00 00    	js     8002fa <umain+0xb7>
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+  80026d:	83 ec 04             	sub    $0x4,%esp
+  800270:	6a 10                	push   $0x10
+  800272:	6a 00                	push   $0x0
+  800274:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  800277:	56                   	push   %esi
+  800278:	e8 52 0a 00 00       	call   800ccf <memset>
+	addr.sin_family = AF_INET;
+  80027d:	c6 45 e9 02          	movb   $0x2,-0x17(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  800281:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800288:	e8 c0 39 00 00       	call   803c4d <htonl>
+  80028d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	addr.sin_port = htons(PORT);
+  800290:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800297:	e8 97 39 00 00       	call   803c33 <htons>
+  80029c:	66 89 45 ea          	mov    %ax,-0x16(%ebp)
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  8002a0:	83 c4 0c             	add    $0xc,%esp
+  8002a3:	6a 10                	push   $0x10
+  8002a5:	56                   	push   %esi
+  8002a6:	53                   	push   %ebx
+  8002a7:	e8 ad 1c 00 00       	call   801f59 <bind>
+  8002ac:	83 c4 10             	add    $0x10,%esp
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	78 56                	js     800309 <umain+0xc6>
+		die("Failed to bind the server socket");
+	if (listen(s, 1) < 0)
+  8002b3:	83 ec 08             	sub    $0x8,%esp
+  8002b6:	6a 01                	push   $0x1
+  8002b8:	53                   	push   %ebx
+  8002b9:	e8 0a 1d 00 00       	call   801fc8 <listen>
+  8002be:	83 c4 10             	add    $0x10,%esp
+  8002c1:	85 c0                	test   %eax,%eax
+  8002c3:	78 50                	js     800315 <umain+0xd2>
+		die("Failed to listen on server socket");
+
+	run(s, "small", echo_small);
+  8002c5:	b9 1c 01 80 00       	mov    $0x80011c,%ecx
+  8002ca:	ba be 40 80 00       	mov    $0x8040be,%edx
+  8002cf:	89 d8                	mov    %ebx,%eax
+  8002d1:	e8 b0 fe ff ff       	call   800186 <run>
+	run(s, "bulk", echo_bulk);
+  8002d6:	b9 50 00 80 00       	mov    $0x800050,%ecx
+  8002db:	ba a1 40 80 00       	mov    $0x8040a1,%edx
+  8002e0:	89 d8                	mov    %ebx,%eax
+  8002e2:	e8 9f fe ff ff       	call   800186 <run>
+	close(s);
+  8002e7:	83 ec 0c             	sub    $0xc,%esp
+  8002ea:	53                   	push   %ebx
+  8002eb:	e8 b7 12 00 00       	call   8015a7 <close>
+}
+  8002f0:	83 c4 10             	add    $0x10,%esp
+  8002f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002f6:	5b                   	pop    %ebx
+  8002f7:	5e                   	pop    %esi
+  8002f8:	5d                   	pop    %ebp
+  8002f9:	c3                   	ret
+		die("Failed to create socket");
+  8002fa:	b8 a6 40 80 00       	mov    $0x8040a6,%eax
+  8002ff:	e8 31 fd ff ff       	call   800035 <die>
+  800304:	e9 64 ff ff ff       	jmp    80026d <umain+0x2a>
+		die("Failed to bind the server socket");
+  800309:	b8 48 41 80 00       	mov    $0x804148,%eax
+  80030e:	e8 22 fd ff ff       	call   800035 <die>
+  800313:	eb 9e                	jmp    8002b3 <umain+0x70>
+		die("Failed to listen on server socket");
+  800315:	b8 6c 41 80 00       	mov    $0x80416c,%eax
+  80031a:	e8 16 fd ff ff       	call   800035 <die>
+  80031f:	eb a4                	jmp    8002c5 <umain+0x82>
+
+00800321 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800321:	55                   	push   %ebp
+  800322:	89 e5                	mov    %esp,%ebp
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800329:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80032c:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80032e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800333:	29 d0                	sub    %edx,%eax
+  800335:	89 c2                	mov    %eax,%edx
+  800337:	c1 ea 0f             	shr    $0xf,%edx
+  80033a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800347:	c7 04 85 60 63 81 00 	movl   $0x0,0x816360(,%eax,4)
+  80034e:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800352:	e8 f3 0b 00 00       	call   800f4a <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800357:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80035c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800362:	89 e1                	mov    %esp,%ecx
+  800364:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800369:	29 ca                	sub    %ecx,%edx
+  80036b:	89 d1                	mov    %edx,%ecx
+  80036d:	c1 e9 0f             	shr    $0xf,%ecx
+  800370:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800376:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037b:	0f 42 d1             	cmovb  %ecx,%edx
+  80037e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800383:	89 04 95 60 63 81 00 	mov    %eax,0x816360(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80038a:	85 db                	test   %ebx,%ebx
+  80038c:	7e 07                	jle    800395 <libmain+0x74>
+		binaryname = argv[0];
+  80038e:	8b 06                	mov    (%esi),%eax
+  800390:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800395:	83 ec 08             	sub    $0x8,%esp
+  800398:	56                   	push   %esi
+  800399:	53                   	push   %ebx
+  80039a:	e8 a4 fe ff ff       	call   800243 <umain>
+
+	// exit gracefully
+	exit();
+  80039f:	e8 0a 00 00 00       	call   8003ae <exit>
+}
+  8003a4:	83 c4 10             	add    $0x10,%esp
+  8003a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003aa:	5b                   	pop    %ebx
+  8003ab:	5e                   	pop    %esi
+  8003ac:	5d                   	pop    %ebp
+  8003ad:	c3                   	ret
+
+008003ae <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003ae:	55                   	push   %ebp
+  8003af:	89 e5                	mov    %esp,%ebp
+  8003b1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003b4:	e8 1b 12 00 00       	call   8015d4 <close_all>
+	sys_env_destroy(0);
+  8003b9:	83 ec 0c             	sub    $0xc,%esp
+  8003bc:	6a 00                	push   $0x0
+  8003be:	e8 46 0b 00 00       	call   800f09 <sys_env_destroy>
+}
+  8003c3:	83 c4 10             	add    $0x10,%esp
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+008003c8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	53                   	push   %ebx
+  8003cc:	83 ec 04             	sub    $0x4,%esp
+  8003cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003d2:	8b 13                	mov    (%ebx),%edx
+  8003d4:	8d 42 01             	lea    0x1(%edx),%eax
+  8003d7:	89 03                	mov    %eax,(%ebx)
+  8003d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003dc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003e0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003e5:	74 09                	je     8003f0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003e7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003ee:	c9                   	leave
+  8003ef:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003f0:	83 ec 08             	sub    $0x8,%esp
+  8003f3:	68 ff 00 00 00       	push   $0xff
+  8003f8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003fb:	50                   	push   %eax
+  8003fc:	e8 cb 0a 00 00       	call   800ecc <sys_cputs>
+		b->idx = 0;
+  800401:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800407:	83 c4 10             	add    $0x10,%esp
+  80040a:	eb db                	jmp    8003e7 <putch+0x1f>
+
+0080040c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80040c:	55                   	push   %ebp
+  80040d:	89 e5                	mov    %esp,%ebp
+  80040f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800415:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80041c:	00 00 00 
+	b.cnt = 0;
+  80041f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800426:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800429:	ff 75 0c             	push   0xc(%ebp)
+  80042c:	ff 75 08             	push   0x8(%ebp)
+  80042f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800435:	50                   	push   %eax
+  800436:	68 c8 03 80 00       	push   $0x8003c8
+  80043b:	e8 1c 01 00 00       	call   80055c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800440:	83 c4 08             	add    $0x8,%esp
+  800443:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800449:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80044f:	50                   	push   %eax
+  800450:	e8 77 0a 00 00       	call   800ecc <sys_cputs>
+
+	return b.cnt;
+}
+  800455:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+
+0080045d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80045d:	55                   	push   %ebp
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800463:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800466:	50                   	push   %eax
+  800467:	ff 75 08             	push   0x8(%ebp)
+  80046a:	e8 9d ff ff ff       	call   80040c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80046f:	c9                   	leave
+  800470:	c3                   	ret
+
+00800471 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800471:	55                   	push   %ebp
+  800472:	89 e5                	mov    %esp,%ebp
+  800474:	57                   	push   %edi
+  800475:	56                   	push   %esi
+  800476:	53                   	push   %ebx
+  800477:	83 ec 1c             	sub    $0x1c,%esp
+  80047a:	89 c3                	mov    %eax,%ebx
+  80047c:	89 d6                	mov    %edx,%esi
+  80047e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800481:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800484:	89 d1                	mov    %edx,%ecx
+  800486:	89 c2                	mov    %eax,%edx
+  800488:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80048b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80048e:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800491:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800494:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80049b:	39 c2                	cmp    %eax,%edx
+  80049d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004a0:	73 4b                	jae    8004ed <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8004a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a5:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8004a8:	85 ff                	test   %edi,%edi
+  8004aa:	7e 11                	jle    8004bd <printnum+0x4c>
+			putch(padc, putdat);
+  8004ac:	83 ec 08             	sub    $0x8,%esp
+  8004af:	56                   	push   %esi
+  8004b0:	ff 75 18             	push   0x18(%ebp)
+  8004b3:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8004b5:	83 c4 10             	add    $0x10,%esp
+  8004b8:	83 ef 01             	sub    $0x1,%edi
+  8004bb:	75 ef                	jne    8004ac <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004bd:	83 ec 08             	sub    $0x8,%esp
+  8004c0:	56                   	push   %esi
+  8004c1:	83 ec 04             	sub    $0x4,%esp
+  8004c4:	ff 75 e4             	push   -0x1c(%ebp)
+  8004c7:	ff 75 e0             	push   -0x20(%ebp)
+  8004ca:	ff 75 dc             	push   -0x24(%ebp)
+  8004cd:	ff 75 d8             	push   -0x28(%ebp)
+  8004d0:	e8 95 3a 00 00       	call   803f6a <__umoddi3>
+  8004d5:	83 c4 14             	add    $0x14,%esp
+  8004d8:	0f be 80 98 41 80 00 	movsbl 0x804198(%eax),%eax
+  8004df:	50                   	push   %eax
+  8004e0:	ff d3                	call   *%ebx
+}
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004e8:	5b                   	pop    %ebx
+  8004e9:	5e                   	pop    %esi
+  8004ea:	5f                   	pop    %edi
+  8004eb:	5d                   	pop    %ebp
+  8004ec:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004ed:	83 ec 0c             	sub    $0xc,%esp
+  8004f0:	ff 75 18             	push   0x18(%ebp)
+  8004f3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f6:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004f9:	52                   	push   %edx
+  8004fa:	50                   	push   %eax
+  8004fb:	83 ec 08             	sub    $0x8,%esp
+  8004fe:	ff 75 e4             	push   -0x1c(%ebp)
+  800501:	ff 75 e0             	push   -0x20(%ebp)
+  800504:	ff 75 dc             	push   -0x24(%ebp)
+  800507:	ff 75 d8             	push   -0x28(%ebp)
+  80050a:	e8 95 39 00 00       	call   803ea4 <__udivdi3>
+  80050f:	83 c4 18             	add    $0x18,%esp
+  800512:	52                   	push   %edx
+  800513:	50                   	push   %eax
+  800514:	89 f2                	mov    %esi,%edx
+  800516:	89 d8                	mov    %ebx,%eax
+  800518:	e8 54 ff ff ff       	call   800471 <printnum>
+  80051d:	83 c4 20             	add    $0x20,%esp
+  800520:	eb 9b                	jmp    8004bd <printnum+0x4c>
+
+00800522 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800522:	55                   	push   %ebp
+  800523:	89 e5                	mov    %esp,%ebp
+  800525:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800528:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80052c:	8b 10                	mov    (%eax),%edx
+  80052e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800531:	73 0a                	jae    80053d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800533:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800536:	89 08                	mov    %ecx,(%eax)
+  800538:	8b 45 08             	mov    0x8(%ebp),%eax
+  80053b:	88 02                	mov    %al,(%edx)
+}
+  80053d:	5d                   	pop    %ebp
+  80053e:	c3                   	ret
+
+0080053f <printfmt>:
+{
+  80053f:	55                   	push   %ebp
+  800540:	89 e5                	mov    %esp,%ebp
+  800542:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800545:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800548:	50                   	push   %eax
+  800549:	ff 75 10             	push   0x10(%ebp)
+  80054c:	ff 75 0c             	push   0xc(%ebp)
+  80054f:	ff 75 08             	push   0x8(%ebp)
+  800552:	e8 05 00 00 00       	call   80055c <vprintfmt>
+}
+  800557:	83 c4 10             	add    $0x10,%esp
+  80055a:	c9                   	leave
+  80055b:	c3                   	ret
+
+0080055c <vprintfmt>:
+{
+  80055c:	55                   	push   %ebp
+  80055d:	89 e5                	mov    %esp,%ebp
+  80055f:	57                   	push   %edi
+  800560:	56                   	push   %esi
+  800561:	53                   	push   %ebx
+  800562:	83 ec 2c             	sub    $0x2c,%esp
+  800565:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800568:	89 df                	mov    %ebx,%edi
+  80056a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80056d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800570:	8d 70 01             	lea    0x1(%eax),%esi
+  800573:	0f b6 00             	movzbl (%eax),%eax
+  800576:	83 f8 25             	cmp    $0x25,%eax
+  800579:	74 1e                	je     800599 <vprintfmt+0x3d>
+			if (ch == '\0')
+  80057b:	85 c0                	test   %eax,%eax
+  80057d:	0f 84 15 05 00 00    	je     800a98 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	53                   	push   %ebx
+  800587:	50                   	push   %eax
+  800588:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80058a:	83 c6 01             	add    $0x1,%esi
+  80058d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	83 f8 25             	cmp    $0x25,%eax
+  800597:	75 e2                	jne    80057b <vprintfmt+0x1f>
+		padc = ' ';
+  800599:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80059d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005a4:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8005ab:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8005b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b7:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ba:	8d 56 01             	lea    0x1(%esi),%edx
+  8005bd:	0f b6 0e             	movzbl (%esi),%ecx
+  8005c0:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005c3:	3c 55                	cmp    $0x55,%al
+  8005c5:	0f 87 3b 04 00 00    	ja     800a06 <vprintfmt+0x4aa>
+  8005cb:	0f b6 c0             	movzbl %al,%eax
+  8005ce:	ff 24 85 00 43 80 00 	jmp    *0x804300(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8005d5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005d8:	eb 93                	jmp    80056d <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005da:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8005dc:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005e0:	eb d8                	jmp    8005ba <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e2:	89 d6                	mov    %edx,%esi
+  8005e4:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005e8:	eb d0                	jmp    8005ba <vprintfmt+0x5e>
+  8005ea:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8005ed:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005f0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8005f3:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8005f7:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005fa:	83 f9 09             	cmp    $0x9,%ecx
+  8005fd:	77 6f                	ja     80066e <vprintfmt+0x112>
+  8005ff:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800602:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800605:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800608:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80060c:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80060f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800612:	83 fe 09             	cmp    $0x9,%esi
+  800615:	76 eb                	jbe    800602 <vprintfmt+0xa6>
+  800617:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80061a:	89 d6                	mov    %edx,%esi
+  80061c:	eb 13                	jmp    800631 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80061e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800621:	8b 00                	mov    (%eax),%eax
+  800623:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8d 40 04             	lea    0x4(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80062f:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800631:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800635:	79 83                	jns    8005ba <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800637:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80063a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80063d:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800644:	e9 71 ff ff ff       	jmp    8005ba <vprintfmt+0x5e>
+			if (width < 0)
+  800649:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80064c:	85 c9                	test   %ecx,%ecx
+  80064e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800653:	0f 49 c1             	cmovns %ecx,%eax
+  800656:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800659:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80065b:	e9 5a ff ff ff       	jmp    8005ba <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800660:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800662:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800669:	e9 4c ff ff ff       	jmp    8005ba <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80066e:	89 d6                	mov    %edx,%esi
+  800670:	eb bf                	jmp    800631 <vprintfmt+0xd5>
+			lflag++;
+  800672:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800676:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800678:	e9 3d ff ff ff       	jmp    8005ba <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80067d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 70 04             	lea    0x4(%eax),%esi
+  800686:	83 ec 08             	sub    $0x8,%esp
+  800689:	53                   	push   %ebx
+  80068a:	ff 30                	push   (%eax)
+  80068c:	ff d7                	call   *%edi
+			break;
+  80068e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800691:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800694:	e9 d4 fe ff ff       	jmp    80056d <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800699:	89 55 10             	mov    %edx,0x10(%ebp)
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8006a2:	8b 10                	mov    (%eax),%edx
+  8006a4:	89 d0                	mov    %edx,%eax
+  8006a6:	f7 d8                	neg    %eax
+  8006a8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006ab:	83 f8 12             	cmp    $0x12,%eax
+  8006ae:	7f 23                	jg     8006d3 <vprintfmt+0x177>
+  8006b0:	8b 14 85 60 44 80 00 	mov    0x804460(,%eax,4),%edx
+  8006b7:	85 d2                	test   %edx,%edx
+  8006b9:	74 18                	je     8006d3 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8006bb:	52                   	push   %edx
+  8006bc:	68 bb 45 80 00       	push   $0x8045bb
+  8006c1:	53                   	push   %ebx
+  8006c2:	57                   	push   %edi
+  8006c3:	e8 77 fe ff ff       	call   80053f <printfmt>
+  8006c8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006cb:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006ce:	e9 9a fe ff ff       	jmp    80056d <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8006d3:	50                   	push   %eax
+  8006d4:	68 b0 41 80 00       	push   $0x8041b0
+  8006d9:	53                   	push   %ebx
+  8006da:	57                   	push   %edi
+  8006db:	e8 5f fe ff ff       	call   80053f <printfmt>
+  8006e0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006e3:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006e6:	e9 82 fe ff ff       	jmp    80056d <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006eb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	83 c0 04             	add    $0x4,%eax
+  8006f4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fa:	8b 00                	mov    (%eax),%eax
+  8006fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006ff:	85 c0                	test   %eax,%eax
+  800701:	0f 84 61 03 00 00    	je     800a68 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800707:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80070b:	7e 06                	jle    800713 <vprintfmt+0x1b7>
+  80070d:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800711:	75 29                	jne    80073c <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800713:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800716:	8d 70 01             	lea    0x1(%eax),%esi
+  800719:	0f b6 00             	movzbl (%eax),%eax
+  80071c:	0f be d0             	movsbl %al,%edx
+  80071f:	85 d2                	test   %edx,%edx
+  800721:	0f 84 bb 00 00 00    	je     8007e2 <vprintfmt+0x286>
+  800727:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80072a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80072d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800730:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800733:	eb 7a                	jmp    8007af <vprintfmt+0x253>
+				p = "(null)";
+  800735:	c7 45 d0 a9 41 80 00 	movl   $0x8041a9,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80073c:	83 ec 08             	sub    $0x8,%esp
+  80073f:	ff 75 d4             	push   -0x2c(%ebp)
+  800742:	ff 75 d0             	push   -0x30(%ebp)
+  800745:	e8 e0 03 00 00       	call   800b2a <strnlen>
+  80074a:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80074d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800750:	83 c4 10             	add    $0x10,%esp
+  800753:	85 d2                	test   %edx,%edx
+  800755:	0f 8e d6 02 00 00    	jle    800a31 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80075b:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	53                   	push   %ebx
+  800763:	56                   	push   %esi
+  800764:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800766:	83 c4 10             	add    $0x10,%esp
+  800769:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80076d:	75 f0                	jne    80075f <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80076f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800772:	8d 70 01             	lea    0x1(%eax),%esi
+  800775:	0f b6 00             	movzbl (%eax),%eax
+  800778:	0f be d0             	movsbl %al,%edx
+  80077b:	85 d2                	test   %edx,%edx
+  80077d:	0f 84 da 02 00 00    	je     800a5d <vprintfmt+0x501>
+  800783:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800786:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800789:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80078c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80078f:	eb 1e                	jmp    8007af <vprintfmt+0x253>
+					putch(ch, putdat);
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	ff 75 0c             	push   0xc(%ebp)
+  800797:	52                   	push   %edx
+  800798:	ff 55 08             	call   *0x8(%ebp)
+  80079b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80079e:	83 eb 01             	sub    $0x1,%ebx
+  8007a1:	83 c6 01             	add    $0x1,%esi
+  8007a4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007a8:	0f be d0             	movsbl %al,%edx
+  8007ab:	85 d2                	test   %edx,%edx
+  8007ad:	74 2a                	je     8007d9 <vprintfmt+0x27d>
+  8007af:	85 ff                	test   %edi,%edi
+  8007b1:	78 05                	js     8007b8 <vprintfmt+0x25c>
+  8007b3:	83 ef 01             	sub    $0x1,%edi
+  8007b6:	78 59                	js     800811 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007b8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007bc:	74 d3                	je     800791 <vprintfmt+0x235>
+  8007be:	0f be c0             	movsbl %al,%eax
+  8007c1:	83 e8 20             	sub    $0x20,%eax
+  8007c4:	83 f8 5e             	cmp    $0x5e,%eax
+  8007c7:	76 c8                	jbe    800791 <vprintfmt+0x235>
+					putch('?', putdat);
+  8007c9:	83 ec 08             	sub    $0x8,%esp
+  8007cc:	ff 75 0c             	push   0xc(%ebp)
+  8007cf:	6a 3f                	push   $0x3f
+  8007d1:	ff 55 08             	call   *0x8(%ebp)
+  8007d4:	83 c4 10             	add    $0x10,%esp
+  8007d7:	eb c5                	jmp    80079e <vprintfmt+0x242>
+  8007d9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8007e2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007e5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007e9:	7e 1b                	jle    800806 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8007eb:	83 ec 08             	sub    $0x8,%esp
+  8007ee:	53                   	push   %ebx
+  8007ef:	6a 20                	push   $0x20
+  8007f1:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007f3:	83 c4 10             	add    $0x10,%esp
+  8007f6:	83 ee 01             	sub    $0x1,%esi
+  8007f9:	75 f0                	jne    8007eb <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007fb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800801:	e9 67 fd ff ff       	jmp    80056d <vprintfmt+0x11>
+  800806:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080c:	e9 5c fd ff ff       	jmp    80056d <vprintfmt+0x11>
+  800811:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800814:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800817:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80081a:	eb c6                	jmp    8007e2 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80081c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80081f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800822:	83 f9 01             	cmp    $0x1,%ecx
+  800825:	7f 1f                	jg     800846 <vprintfmt+0x2ea>
+	else if (lflag)
+  800827:	85 c9                	test   %ecx,%ecx
+  800829:	74 67                	je     800892 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	8b 30                	mov    (%eax),%esi
+  800830:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800833:	89 f0                	mov    %esi,%eax
+  800835:	c1 f8 1f             	sar    $0x1f,%eax
+  800838:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80083b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083e:	8d 40 04             	lea    0x4(%eax),%eax
+  800841:	89 45 14             	mov    %eax,0x14(%ebp)
+  800844:	eb 17                	jmp    80085d <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800846:	8b 45 14             	mov    0x14(%ebp),%eax
+  800849:	8b 50 04             	mov    0x4(%eax),%edx
+  80084c:	8b 00                	mov    (%eax),%eax
+  80084e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800851:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8d 40 08             	lea    0x8(%eax),%eax
+  80085a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80085d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800860:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800863:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800868:	85 c9                	test   %ecx,%ecx
+  80086a:	0f 89 12 01 00 00    	jns    800982 <vprintfmt+0x426>
+				putch('-', putdat);
+  800870:	83 ec 08             	sub    $0x8,%esp
+  800873:	53                   	push   %ebx
+  800874:	6a 2d                	push   $0x2d
+  800876:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800878:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80087b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80087e:	f7 da                	neg    %edx
+  800880:	83 d1 00             	adc    $0x0,%ecx
+  800883:	f7 d9                	neg    %ecx
+  800885:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800888:	be 0a 00 00 00       	mov    $0xa,%esi
+  80088d:	e9 f0 00 00 00       	jmp    800982 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800892:	8b 45 14             	mov    0x14(%ebp),%eax
+  800895:	8b 30                	mov    (%eax),%esi
+  800897:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80089a:	89 f0                	mov    %esi,%eax
+  80089c:	c1 f8 1f             	sar    $0x1f,%eax
+  80089f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ab:	eb b0                	jmp    80085d <vprintfmt+0x301>
+	if (lflag >= 2)
+  8008ad:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008b0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b3:	83 f9 01             	cmp    $0x1,%ecx
+  8008b6:	7f 1e                	jg     8008d6 <vprintfmt+0x37a>
+	else if (lflag)
+  8008b8:	85 c9                	test   %ecx,%ecx
+  8008ba:	74 32                	je     8008ee <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8008bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bf:	8b 10                	mov    (%eax),%edx
+  8008c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008cc:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8008d1:	e9 ac 00 00 00       	jmp    800982 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d9:	8b 10                	mov    (%eax),%edx
+  8008db:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008de:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e4:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8008e9:	e9 94 00 00 00       	jmp    800982 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 10                	mov    (%eax),%edx
+  8008f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008fe:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800903:	eb 7d                	jmp    800982 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800905:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800908:	89 55 10             	mov    %edx,0x10(%ebp)
+  80090b:	83 f9 01             	cmp    $0x1,%ecx
+  80090e:	7f 1b                	jg     80092b <vprintfmt+0x3cf>
+	else if (lflag)
+  800910:	85 c9                	test   %ecx,%ecx
+  800912:	74 2c                	je     800940 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800914:	8b 45 14             	mov    0x14(%ebp),%eax
+  800917:	8b 10                	mov    (%eax),%edx
+  800919:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80091e:	8d 40 04             	lea    0x4(%eax),%eax
+  800921:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800924:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800929:	eb 57                	jmp    800982 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80092b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092e:	8b 10                	mov    (%eax),%edx
+  800930:	8b 48 04             	mov    0x4(%eax),%ecx
+  800933:	8d 40 08             	lea    0x8(%eax),%eax
+  800936:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800939:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80093e:	eb 42                	jmp    800982 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800940:	8b 45 14             	mov    0x14(%ebp),%eax
+  800943:	8b 10                	mov    (%eax),%edx
+  800945:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094a:	8d 40 04             	lea    0x4(%eax),%eax
+  80094d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800950:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800955:	eb 2b                	jmp    800982 <vprintfmt+0x426>
+			putch('0', putdat);
+  800957:	89 55 10             	mov    %edx,0x10(%ebp)
+  80095a:	83 ec 08             	sub    $0x8,%esp
+  80095d:	53                   	push   %ebx
+  80095e:	6a 30                	push   $0x30
+  800960:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800962:	83 c4 08             	add    $0x8,%esp
+  800965:	53                   	push   %ebx
+  800966:	6a 78                	push   $0x78
+  800968:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80096a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096d:	8b 10                	mov    (%eax),%edx
+  80096f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800974:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800977:	8d 40 04             	lea    0x4(%eax),%eax
+  80097a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80097d:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800982:	83 ec 0c             	sub    $0xc,%esp
+  800985:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800989:	50                   	push   %eax
+  80098a:	ff 75 e4             	push   -0x1c(%ebp)
+  80098d:	56                   	push   %esi
+  80098e:	51                   	push   %ecx
+  80098f:	52                   	push   %edx
+  800990:	89 da                	mov    %ebx,%edx
+  800992:	89 f8                	mov    %edi,%eax
+  800994:	e8 d8 fa ff ff       	call   800471 <printnum>
+			break;
+  800999:	83 c4 20             	add    $0x20,%esp
+  80099c:	e9 cc fb ff ff       	jmp    80056d <vprintfmt+0x11>
+	if (lflag >= 2)
+  8009a1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009a4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009a7:	83 f9 01             	cmp    $0x1,%ecx
+  8009aa:	7f 1b                	jg     8009c7 <vprintfmt+0x46b>
+	else if (lflag)
+  8009ac:	85 c9                	test   %ecx,%ecx
+  8009ae:	74 2c                	je     8009dc <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8009b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b3:	8b 10                	mov    (%eax),%edx
+  8009b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8009bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009c0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009c5:	eb bb                	jmp    800982 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ca:	8b 10                	mov    (%eax),%edx
+  8009cc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8009d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009d5:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8009da:	eb a6                	jmp    800982 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009df:	8b 10                	mov    (%eax),%edx
+  8009e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ec:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8009f1:	eb 8f                	jmp    800982 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8009f3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009f6:	83 ec 08             	sub    $0x8,%esp
+  8009f9:	53                   	push   %ebx
+  8009fa:	6a 25                	push   $0x25
+  8009fc:	ff d7                	call   *%edi
+			break;
+  8009fe:	83 c4 10             	add    $0x10,%esp
+  800a01:	e9 67 fb ff ff       	jmp    80056d <vprintfmt+0x11>
+			putch('%', putdat);
+  800a06:	83 ec 08             	sub    $0x8,%esp
+  800a09:	53                   	push   %ebx
+  800a0a:	6a 25                	push   $0x25
+  800a0c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a0e:	83 c4 10             	add    $0x10,%esp
+  800a11:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a15:	0f 84 ba fb ff ff    	je     8005d5 <vprintfmt+0x79>
+  800a1b:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a1e:	89 f0                	mov    %esi,%eax
+  800a20:	83 e8 01             	sub    $0x1,%eax
+  800a23:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a27:	75 f7                	jne    800a20 <vprintfmt+0x4c4>
+  800a29:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a2c:	e9 3c fb ff ff       	jmp    80056d <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a31:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a34:	8d 70 01             	lea    0x1(%eax),%esi
+  800a37:	0f b6 00             	movzbl (%eax),%eax
+  800a3a:	0f be d0             	movsbl %al,%edx
+  800a3d:	85 d2                	test   %edx,%edx
+  800a3f:	74 11                	je     800a52 <vprintfmt+0x4f6>
+  800a41:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a44:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a47:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a4a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a4d:	e9 5d fd ff ff       	jmp    8007af <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a52:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a55:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a58:	e9 10 fb ff ff       	jmp    80056d <vprintfmt+0x11>
+  800a5d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a60:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a63:	e9 05 fb ff ff       	jmp    80056d <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a68:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a6c:	7e 0a                	jle    800a78 <vprintfmt+0x51c>
+  800a6e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a72:	0f 85 bd fc ff ff    	jne    800735 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a78:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a7d:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a82:	be aa 41 80 00       	mov    $0x8041aa,%esi
+  800a87:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a8a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a8d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a90:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a93:	e9 17 fd ff ff       	jmp    8007af <vprintfmt+0x253>
+}
+  800a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a9b:	5b                   	pop    %ebx
+  800a9c:	5e                   	pop    %esi
+  800a9d:	5f                   	pop    %edi
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	83 ec 18             	sub    $0x18,%esp
+  800aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800aac:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800aaf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ab3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ab6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800abd:	85 c0                	test   %eax,%eax
+  800abf:	74 26                	je     800ae7 <vsnprintf+0x47>
+  800ac1:	85 d2                	test   %edx,%edx
+  800ac3:	7e 22                	jle    800ae7 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ac5:	ff 75 14             	push   0x14(%ebp)
+  800ac8:	ff 75 10             	push   0x10(%ebp)
+  800acb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ace:	50                   	push   %eax
+  800acf:	68 22 05 80 00       	push   $0x800522
+  800ad4:	e8 83 fa ff ff       	call   80055c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ad9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800adc:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800adf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ae2:	83 c4 10             	add    $0x10,%esp
+}
+  800ae5:	c9                   	leave
+  800ae6:	c3                   	ret
+		return -E_INVAL;
+  800ae7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aec:	eb f7                	jmp    800ae5 <vsnprintf+0x45>
+
+00800aee <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800aee:	55                   	push   %ebp
+  800aef:	89 e5                	mov    %esp,%ebp
+  800af1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800af4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800af7:	50                   	push   %eax
+  800af8:	ff 75 10             	push   0x10(%ebp)
+  800afb:	ff 75 0c             	push   0xc(%ebp)
+  800afe:	ff 75 08             	push   0x8(%ebp)
+  800b01:	e8 9a ff ff ff       	call   800aa0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b06:	c9                   	leave
+  800b07:	c3                   	ret
+
+00800b08 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b08:	55                   	push   %ebp
+  800b09:	89 e5                	mov    %esp,%ebp
+  800b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b0e:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b11:	74 10                	je     800b23 <strlen+0x1b>
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b18:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b1b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b1f:	75 f7                	jne    800b18 <strlen+0x10>
+	return n;
+}
+  800b21:	5d                   	pop    %ebp
+  800b22:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b23:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b28:	eb f7                	jmp    800b21 <strlen+0x19>
+
+00800b2a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b30:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b33:	85 d2                	test   %edx,%edx
+  800b35:	74 16                	je     800b4d <strnlen+0x23>
+  800b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b40:	74 09                	je     800b4b <strnlen+0x21>
+		n++;
+  800b42:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b45:	39 d0                	cmp    %edx,%eax
+  800b47:	75 f3                	jne    800b3c <strnlen+0x12>
+		n++;
+  800b49:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b52:	eb f7                	jmp    800b4b <strnlen+0x21>
+
+00800b54 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	53                   	push   %ebx
+  800b58:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b5b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b63:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b67:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b6a:	83 c0 01             	add    $0x1,%eax
+  800b6d:	84 d2                	test   %dl,%dl
+  800b6f:	75 f2                	jne    800b63 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b71:	89 c8                	mov    %ecx,%eax
+  800b73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b76:	c9                   	leave
+  800b77:	c3                   	ret
+
+00800b78 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	53                   	push   %ebx
+  800b7c:	83 ec 10             	sub    $0x10,%esp
+  800b7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b82:	53                   	push   %ebx
+  800b83:	e8 80 ff ff ff       	call   800b08 <strlen>
+  800b88:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b8b:	ff 75 0c             	push   0xc(%ebp)
+  800b8e:	01 d8                	add    %ebx,%eax
+  800b90:	50                   	push   %eax
+  800b91:	e8 be ff ff ff       	call   800b54 <strcpy>
+	return dst;
+}
+  800b96:	89 d8                	mov    %ebx,%eax
+  800b98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b9b:	c9                   	leave
+  800b9c:	c3                   	ret
+
+00800b9d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	56                   	push   %esi
+  800ba1:	53                   	push   %ebx
+  800ba2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ba5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bab:	85 db                	test   %ebx,%ebx
+  800bad:	74 17                	je     800bc6 <strncpy+0x29>
+  800baf:	01 f3                	add    %esi,%ebx
+  800bb1:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800bb3:	83 c0 01             	add    $0x1,%eax
+  800bb6:	0f b6 0a             	movzbl (%edx),%ecx
+  800bb9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bbc:	80 f9 01             	cmp    $0x1,%cl
+  800bbf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bc2:	39 c3                	cmp    %eax,%ebx
+  800bc4:	75 ed                	jne    800bb3 <strncpy+0x16>
+	}
+	return ret;
+}
+  800bc6:	89 f0                	mov    %esi,%eax
+  800bc8:	5b                   	pop    %ebx
+  800bc9:	5e                   	pop    %esi
+  800bca:	5d                   	pop    %ebp
+  800bcb:	c3                   	ret
+
+00800bcc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bcc:	55                   	push   %ebp
+  800bcd:	89 e5                	mov    %esp,%ebp
+  800bcf:	56                   	push   %esi
+  800bd0:	53                   	push   %ebx
+  800bd1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bd4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bda:	89 f0                	mov    %esi,%eax
+  800bdc:	85 db                	test   %ebx,%ebx
+  800bde:	74 1e                	je     800bfe <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800be0:	83 eb 01             	sub    $0x1,%ebx
+  800be3:	74 16                	je     800bfb <strlcpy+0x2f>
+  800be5:	01 f3                	add    %esi,%ebx
+  800be7:	0f b6 0a             	movzbl (%edx),%ecx
+  800bea:	84 c9                	test   %cl,%cl
+  800bec:	74 0d                	je     800bfb <strlcpy+0x2f>
+			*dst++ = *src++;
+  800bee:	83 c2 01             	add    $0x1,%edx
+  800bf1:	83 c0 01             	add    $0x1,%eax
+  800bf4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800bf7:	39 d8                	cmp    %ebx,%eax
+  800bf9:	75 ec                	jne    800be7 <strlcpy+0x1b>
+		*dst = '\0';
+  800bfb:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bfe:	29 f0                	sub    %esi,%eax
+}
+  800c00:	5b                   	pop    %ebx
+  800c01:	5e                   	pop    %esi
+  800c02:	5d                   	pop    %ebp
+  800c03:	c3                   	ret
+
+00800c04 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c0d:	0f b6 01             	movzbl (%ecx),%eax
+  800c10:	84 c0                	test   %al,%al
+  800c12:	74 11                	je     800c25 <strcmp+0x21>
+  800c14:	38 02                	cmp    %al,(%edx)
+  800c16:	75 0d                	jne    800c25 <strcmp+0x21>
+		p++, q++;
+  800c18:	83 c1 01             	add    $0x1,%ecx
+  800c1b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c1e:	0f b6 01             	movzbl (%ecx),%eax
+  800c21:	84 c0                	test   %al,%al
+  800c23:	75 ef                	jne    800c14 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c25:	0f b6 c0             	movzbl %al,%eax
+  800c28:	0f b6 12             	movzbl (%edx),%edx
+  800c2b:	29 d0                	sub    %edx,%eax
+}
+  800c2d:	5d                   	pop    %ebp
+  800c2e:	c3                   	ret
+
+00800c2f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	53                   	push   %ebx
+  800c33:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c39:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c41:	85 d2                	test   %edx,%edx
+  800c43:	74 2e                	je     800c73 <strncmp+0x44>
+  800c45:	0f b6 01             	movzbl (%ecx),%eax
+  800c48:	84 c0                	test   %al,%al
+  800c4a:	74 16                	je     800c62 <strncmp+0x33>
+  800c4c:	3a 03                	cmp    (%ebx),%al
+  800c4e:	75 12                	jne    800c62 <strncmp+0x33>
+		n--, p++, q++;
+  800c50:	83 c1 01             	add    $0x1,%ecx
+  800c53:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800c56:	83 ea 01             	sub    $0x1,%edx
+  800c59:	75 ea                	jne    800c45 <strncmp+0x16>
+		return 0;
+  800c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c60:	eb 11                	jmp    800c73 <strncmp+0x44>
+  800c62:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800c67:	85 d2                	test   %edx,%edx
+  800c69:	74 08                	je     800c73 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c6b:	0f b6 01             	movzbl (%ecx),%eax
+  800c6e:	0f b6 13             	movzbl (%ebx),%edx
+  800c71:	29 d0                	sub    %edx,%eax
+}
+  800c73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c76:	c9                   	leave
+  800c77:	c3                   	ret
+
+00800c78 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c82:	0f b6 10             	movzbl (%eax),%edx
+  800c85:	84 d2                	test   %dl,%dl
+  800c87:	74 15                	je     800c9e <strchr+0x26>
+		if (*s == c)
+  800c89:	38 d1                	cmp    %dl,%cl
+  800c8b:	74 0f                	je     800c9c <strchr+0x24>
+	for (; *s; s++)
+  800c8d:	83 c0 01             	add    $0x1,%eax
+  800c90:	0f b6 10             	movzbl (%eax),%edx
+  800c93:	84 d2                	test   %dl,%dl
+  800c95:	75 f2                	jne    800c89 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800c97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+	return 0;
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca3:	eb f7                	jmp    800c9c <strchr+0x24>
+
+00800ca5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ca5:	55                   	push   %ebp
+  800ca6:	89 e5                	mov    %esp,%ebp
+  800ca8:	53                   	push   %ebx
+  800ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800caf:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800cb2:	38 d3                	cmp    %dl,%bl
+  800cb4:	74 14                	je     800cca <strfind+0x25>
+  800cb6:	89 d1                	mov    %edx,%ecx
+  800cb8:	84 db                	test   %bl,%bl
+  800cba:	74 0e                	je     800cca <strfind+0x25>
+	for (; *s; s++)
+  800cbc:	83 c0 01             	add    $0x1,%eax
+  800cbf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cc2:	38 ca                	cmp    %cl,%dl
+  800cc4:	74 04                	je     800cca <strfind+0x25>
+  800cc6:	84 d2                	test   %dl,%dl
+  800cc8:	75 f2                	jne    800cbc <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800cca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ccd:	c9                   	leave
+  800cce:	c3                   	ret
+
+00800ccf <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cd6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cd9:	85 c9                	test   %ecx,%ecx
+  800cdb:	74 20                	je     800cfd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cdd:	89 f8                	mov    %edi,%eax
+  800cdf:	09 c8                	or     %ecx,%eax
+  800ce1:	a8 03                	test   $0x3,%al
+  800ce3:	75 12                	jne    800cf7 <memset+0x28>
+		c &= 0xFF;
+  800ce5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ce9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cef:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cf2:	fc                   	cld
+  800cf3:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cf5:	eb 06                	jmp    800cfd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cf7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cfa:	fc                   	cld
+  800cfb:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cfd:	89 f8                	mov    %edi,%eax
+  800cff:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d02:	c9                   	leave
+  800d03:	c3                   	ret
+
+00800d04 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d04:	55                   	push   %ebp
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	57                   	push   %edi
+  800d08:	56                   	push   %esi
+  800d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d0f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d12:	39 c6                	cmp    %eax,%esi
+  800d14:	73 32                	jae    800d48 <memmove+0x44>
+  800d16:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d19:	39 d0                	cmp    %edx,%eax
+  800d1b:	73 2b                	jae    800d48 <memmove+0x44>
+		s += n;
+		d += n;
+  800d1d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d20:	89 d6                	mov    %edx,%esi
+  800d22:	09 fe                	or     %edi,%esi
+  800d24:	09 ce                	or     %ecx,%esi
+  800d26:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d2c:	75 0e                	jne    800d3c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d2e:	83 ef 04             	sub    $0x4,%edi
+  800d31:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d34:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d37:	fd                   	std
+  800d38:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d3a:	eb 09                	jmp    800d45 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d3c:	83 ef 01             	sub    $0x1,%edi
+  800d3f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d42:	fd                   	std
+  800d43:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d45:	fc                   	cld
+  800d46:	eb 1a                	jmp    800d62 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d48:	89 f2                	mov    %esi,%edx
+  800d4a:	09 c2                	or     %eax,%edx
+  800d4c:	09 ca                	or     %ecx,%edx
+  800d4e:	f6 c2 03             	test   $0x3,%dl
+  800d51:	75 0a                	jne    800d5d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d53:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d56:	89 c7                	mov    %eax,%edi
+  800d58:	fc                   	cld
+  800d59:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d5b:	eb 05                	jmp    800d62 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d5d:	89 c7                	mov    %eax,%edi
+  800d5f:	fc                   	cld
+  800d60:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+
+00800d66 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d6c:	ff 75 10             	push   0x10(%ebp)
+  800d6f:	ff 75 0c             	push   0xc(%ebp)
+  800d72:	ff 75 08             	push   0x8(%ebp)
+  800d75:	e8 8a ff ff ff       	call   800d04 <memmove>
+}
+  800d7a:	c9                   	leave
+  800d7b:	c3                   	ret
+
+00800d7c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	56                   	push   %esi
+  800d80:	53                   	push   %ebx
+  800d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d84:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d87:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d8a:	85 f6                	test   %esi,%esi
+  800d8c:	74 29                	je     800db7 <memcmp+0x3b>
+  800d8e:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800d90:	0f b6 08             	movzbl (%eax),%ecx
+  800d93:	0f b6 1a             	movzbl (%edx),%ebx
+  800d96:	38 d9                	cmp    %bl,%cl
+  800d98:	75 11                	jne    800dab <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d9a:	83 c0 01             	add    $0x1,%eax
+  800d9d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800da0:	39 c6                	cmp    %eax,%esi
+  800da2:	75 ec                	jne    800d90 <memcmp+0x14>
+	}
+
+	return 0;
+  800da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da9:	eb 08                	jmp    800db3 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800dab:	0f b6 c1             	movzbl %cl,%eax
+  800dae:	0f b6 db             	movzbl %bl,%ebx
+  800db1:	29 d8                	sub    %ebx,%eax
+}
+  800db3:	5b                   	pop    %ebx
+  800db4:	5e                   	pop    %esi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+	return 0;
+  800db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbc:	eb f5                	jmp    800db3 <memcmp+0x37>
+
+00800dbe <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dc7:	89 c2                	mov    %eax,%edx
+  800dc9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dcc:	39 d0                	cmp    %edx,%eax
+  800dce:	73 0d                	jae    800ddd <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dd0:	38 08                	cmp    %cl,(%eax)
+  800dd2:	74 0d                	je     800de1 <memfind+0x23>
+	for (; s < ends; s++)
+  800dd4:	83 c0 01             	add    $0x1,%eax
+  800dd7:	39 c2                	cmp    %eax,%edx
+  800dd9:	75 f5                	jne    800dd0 <memfind+0x12>
+  800ddb:	eb 06                	jmp    800de3 <memfind+0x25>
+  800ddd:	89 c2                	mov    %eax,%edx
+  800ddf:	eb 02                	jmp    800de3 <memfind+0x25>
+  800de1:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800de3:	89 d0                	mov    %edx,%eax
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+
+00800de7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+  800ded:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800df3:	0f b6 02             	movzbl (%edx),%eax
+  800df6:	3c 20                	cmp    $0x20,%al
+  800df8:	74 04                	je     800dfe <strtol+0x17>
+  800dfa:	3c 09                	cmp    $0x9,%al
+  800dfc:	75 0e                	jne    800e0c <strtol+0x25>
+		s++;
+  800dfe:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e01:	0f b6 02             	movzbl (%edx),%eax
+  800e04:	3c 20                	cmp    $0x20,%al
+  800e06:	74 f6                	je     800dfe <strtol+0x17>
+  800e08:	3c 09                	cmp    $0x9,%al
+  800e0a:	74 f2                	je     800dfe <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e0c:	3c 2b                	cmp    $0x2b,%al
+  800e0e:	74 2a                	je     800e3a <strtol+0x53>
+	int neg = 0;
+  800e10:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e15:	3c 2d                	cmp    $0x2d,%al
+  800e17:	74 2b                	je     800e44 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e19:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e1f:	75 0f                	jne    800e30 <strtol+0x49>
+  800e21:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e24:	74 28                	je     800e4e <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e26:	85 db                	test   %ebx,%ebx
+  800e28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e2d:	0f 44 d8             	cmove  %eax,%ebx
+  800e30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e35:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e38:	eb 46                	jmp    800e80 <strtol+0x99>
+		s++;
+  800e3a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e42:	eb d5                	jmp    800e19 <strtol+0x32>
+		s++, neg = 1;
+  800e44:	83 c2 01             	add    $0x1,%edx
+  800e47:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e4c:	eb cb                	jmp    800e19 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e4e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e52:	74 0e                	je     800e62 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800e54:	85 db                	test   %ebx,%ebx
+  800e56:	75 d8                	jne    800e30 <strtol+0x49>
+		s++, base = 8;
+  800e58:	83 c2 01             	add    $0x1,%edx
+  800e5b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e60:	eb ce                	jmp    800e30 <strtol+0x49>
+		s += 2, base = 16;
+  800e62:	83 c2 02             	add    $0x2,%edx
+  800e65:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e6a:	eb c4                	jmp    800e30 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e6c:	0f be c0             	movsbl %al,%eax
+  800e6f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e72:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e75:	7d 3a                	jge    800eb1 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800e77:	83 c2 01             	add    $0x1,%edx
+  800e7a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e7e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e80:	0f b6 02             	movzbl (%edx),%eax
+  800e83:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e86:	89 f3                	mov    %esi,%ebx
+  800e88:	80 fb 09             	cmp    $0x9,%bl
+  800e8b:	76 df                	jbe    800e6c <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800e8d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e90:	89 f3                	mov    %esi,%ebx
+  800e92:	80 fb 19             	cmp    $0x19,%bl
+  800e95:	77 08                	ja     800e9f <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800e97:	0f be c0             	movsbl %al,%eax
+  800e9a:	83 e8 57             	sub    $0x57,%eax
+  800e9d:	eb d3                	jmp    800e72 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e9f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ea2:	89 f3                	mov    %esi,%ebx
+  800ea4:	80 fb 19             	cmp    $0x19,%bl
+  800ea7:	77 08                	ja     800eb1 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800ea9:	0f be c0             	movsbl %al,%eax
+  800eac:	83 e8 37             	sub    $0x37,%eax
+  800eaf:	eb c1                	jmp    800e72 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800eb1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eb5:	74 05                	je     800ebc <strtol+0xd5>
+		*endptr = (char *) s;
+  800eb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eba:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ebc:	89 c8                	mov    %ecx,%eax
+  800ebe:	f7 d8                	neg    %eax
+  800ec0:	85 ff                	test   %edi,%edi
+  800ec2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ec5:	89 c8                	mov    %ecx,%eax
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+
+00800ecc <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	57                   	push   %edi
+  800ed0:	56                   	push   %esi
+  800ed1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	89 c3                	mov    %eax,%ebx
+  800edf:	89 c7                	mov    %eax,%edi
+  800ee1:	89 c6                	mov    %eax,%esi
+  800ee3:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ee5:	5b                   	pop    %ebx
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5f                   	pop    %edi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+
+00800eea <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	57                   	push   %edi
+  800eee:	56                   	push   %esi
+  800eef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800efa:	89 d1                	mov    %edx,%ecx
+  800efc:	89 d3                	mov    %edx,%ebx
+  800efe:	89 d7                	mov    %edx,%edi
+  800f00:	89 d6                	mov    %edx,%esi
+  800f02:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f04:	5b                   	pop    %ebx
+  800f05:	5e                   	pop    %esi
+  800f06:	5f                   	pop    %edi
+  800f07:	5d                   	pop    %ebp
+  800f08:	c3                   	ret
+
+00800f09 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f1f:	89 cb                	mov    %ecx,%ebx
+  800f21:	89 cf                	mov    %ecx,%edi
+  800f23:	89 ce                	mov    %ecx,%esi
+  800f25:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f27:	85 c0                	test   %eax,%eax
+  800f29:	7f 08                	jg     800f33 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2e:	5b                   	pop    %ebx
+  800f2f:	5e                   	pop    %esi
+  800f30:	5f                   	pop    %edi
+  800f31:	5d                   	pop    %ebp
+  800f32:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f33:	83 ec 0c             	sub    $0xc,%esp
+  800f36:	50                   	push   %eax
+  800f37:	6a 03                	push   $0x3
+  800f39:	68 cb 44 80 00       	push   $0x8044cb
+  800f3e:	6a 23                	push   $0x23
+  800f40:	68 e8 44 80 00       	push   $0x8044e8
+  800f45:	e8 79 28 00 00       	call   8037c3 <_panic>
+
+00800f4a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	57                   	push   %edi
+  800f4e:	56                   	push   %esi
+  800f4f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f55:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f5a:	89 d1                	mov    %edx,%ecx
+  800f5c:	89 d3                	mov    %edx,%ebx
+  800f5e:	89 d7                	mov    %edx,%edi
+  800f60:	89 d6                	mov    %edx,%esi
+  800f62:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+
+00800f69 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	56                   	push   %esi
+  800f6e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f74:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f79:	89 d1                	mov    %edx,%ecx
+  800f7b:	89 d3                	mov    %edx,%ebx
+  800f7d:	89 d7                	mov    %edx,%edi
+  800f7f:	89 d6                	mov    %edx,%esi
+  800f81:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+
+00800f88 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f91:	be 00 00 00 00       	mov    $0x0,%esi
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fa1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa4:	89 f7                	mov    %esi,%edi
+  800fa6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa8:	85 c0                	test   %eax,%eax
+  800faa:	7f 08                	jg     800fb4 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	50                   	push   %eax
+  800fb8:	6a 04                	push   $0x4
+  800fba:	68 cb 44 80 00       	push   $0x8044cb
+  800fbf:	6a 23                	push   $0x23
+  800fc1:	68 e8 44 80 00       	push   $0x8044e8
+  800fc6:	e8 f8 27 00 00       	call   8037c3 <_panic>
+
+00800fcb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fe8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fea:	85 c0                	test   %eax,%eax
+  800fec:	7f 08                	jg     800ff6 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff6:	83 ec 0c             	sub    $0xc,%esp
+  800ff9:	50                   	push   %eax
+  800ffa:	6a 05                	push   $0x5
+  800ffc:	68 cb 44 80 00       	push   $0x8044cb
+  801001:	6a 23                	push   $0x23
+  801003:	68 e8 44 80 00       	push   $0x8044e8
+  801008:	e8 b6 27 00 00       	call   8037c3 <_panic>
+
+0080100d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80100d:	55                   	push   %ebp
+  80100e:	89 e5                	mov    %esp,%ebp
+  801010:	57                   	push   %edi
+  801011:	56                   	push   %esi
+  801012:	53                   	push   %ebx
+  801013:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801016:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801021:	b8 06 00 00 00       	mov    $0x6,%eax
+  801026:	89 df                	mov    %ebx,%edi
+  801028:	89 de                	mov    %ebx,%esi
+  80102a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102c:	85 c0                	test   %eax,%eax
+  80102e:	7f 08                	jg     801038 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	50                   	push   %eax
+  80103c:	6a 06                	push   $0x6
+  80103e:	68 cb 44 80 00       	push   $0x8044cb
+  801043:	6a 23                	push   $0x23
+  801045:	68 e8 44 80 00       	push   $0x8044e8
+  80104a:	e8 74 27 00 00       	call   8037c3 <_panic>
+
+0080104f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+  801055:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801058:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801063:	b8 08 00 00 00       	mov    $0x8,%eax
+  801068:	89 df                	mov    %ebx,%edi
+  80106a:	89 de                	mov    %ebx,%esi
+  80106c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	7f 08                	jg     80107a <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801072:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801075:	5b                   	pop    %ebx
+  801076:	5e                   	pop    %esi
+  801077:	5f                   	pop    %edi
+  801078:	5d                   	pop    %ebp
+  801079:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+  80107d:	50                   	push   %eax
+  80107e:	6a 08                	push   $0x8
+  801080:	68 cb 44 80 00       	push   $0x8044cb
+  801085:	6a 23                	push   $0x23
+  801087:	68 e8 44 80 00       	push   $0x8044e8
+  80108c:	e8 32 27 00 00       	call   8037c3 <_panic>
+
+00801091 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801091:	55                   	push   %ebp
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	57                   	push   %edi
+  801095:	56                   	push   %esi
+  801096:	53                   	push   %ebx
+  801097:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010aa:	89 df                	mov    %ebx,%edi
+  8010ac:	89 de                	mov    %ebx,%esi
+  8010ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b0:	85 c0                	test   %eax,%eax
+  8010b2:	7f 08                	jg     8010bc <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b7:	5b                   	pop    %ebx
+  8010b8:	5e                   	pop    %esi
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010bc:	83 ec 0c             	sub    $0xc,%esp
+  8010bf:	50                   	push   %eax
+  8010c0:	6a 09                	push   $0x9
+  8010c2:	68 cb 44 80 00       	push   $0x8044cb
+  8010c7:	6a 23                	push   $0x23
+  8010c9:	68 e8 44 80 00       	push   $0x8044e8
+  8010ce:	e8 f0 26 00 00       	call   8037c3 <_panic>
+
+008010d3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010d3:	55                   	push   %ebp
+  8010d4:	89 e5                	mov    %esp,%ebp
+  8010d6:	57                   	push   %edi
+  8010d7:	56                   	push   %esi
+  8010d8:	53                   	push   %ebx
+  8010d9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ec:	89 df                	mov    %ebx,%edi
+  8010ee:	89 de                	mov    %ebx,%esi
+  8010f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f2:	85 c0                	test   %eax,%eax
+  8010f4:	7f 08                	jg     8010fe <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f9:	5b                   	pop    %ebx
+  8010fa:	5e                   	pop    %esi
+  8010fb:	5f                   	pop    %edi
+  8010fc:	5d                   	pop    %ebp
+  8010fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010fe:	83 ec 0c             	sub    $0xc,%esp
+  801101:	50                   	push   %eax
+  801102:	6a 0a                	push   $0xa
+  801104:	68 cb 44 80 00       	push   $0x8044cb
+  801109:	6a 23                	push   $0x23
+  80110b:	68 e8 44 80 00       	push   $0x8044e8
+  801110:	e8 ae 26 00 00       	call   8037c3 <_panic>
+
+00801115 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801115:	55                   	push   %ebp
+  801116:	89 e5                	mov    %esp,%ebp
+  801118:	57                   	push   %edi
+  801119:	56                   	push   %esi
+  80111a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801121:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801126:	be 00 00 00 00       	mov    $0x0,%esi
+  80112b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801131:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+
+00801138 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801141:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801146:	8b 55 08             	mov    0x8(%ebp),%edx
+  801149:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80114e:	89 cb                	mov    %ecx,%ebx
+  801150:	89 cf                	mov    %ecx,%edi
+  801152:	89 ce                	mov    %ecx,%esi
+  801154:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801156:	85 c0                	test   %eax,%eax
+  801158:	7f 08                	jg     801162 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80115a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801162:	83 ec 0c             	sub    $0xc,%esp
+  801165:	50                   	push   %eax
+  801166:	6a 0d                	push   $0xd
+  801168:	68 cb 44 80 00       	push   $0x8044cb
+  80116d:	6a 23                	push   $0x23
+  80116f:	68 e8 44 80 00       	push   $0x8044e8
+  801174:	e8 4a 26 00 00       	call   8037c3 <_panic>
+
+00801179 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801185:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80118a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801190:	8b 75 18             	mov    0x18(%ebp),%esi
+  801193:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  8011a0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ae:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011b3:	89 df                	mov    %ebx,%edi
+  8011b5:	89 de                	mov    %ebx,%esi
+  8011b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b9:	85 c0                	test   %eax,%eax
+  8011bb:	7f 08                	jg     8011c5 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8011bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c0:	5b                   	pop    %ebx
+  8011c1:	5e                   	pop    %esi
+  8011c2:	5f                   	pop    %edi
+  8011c3:	5d                   	pop    %ebp
+  8011c4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c5:	83 ec 0c             	sub    $0xc,%esp
+  8011c8:	50                   	push   %eax
+  8011c9:	6a 0d                	push   $0xd
+  8011cb:	68 cb 44 80 00       	push   $0x8044cb
+  8011d0:	6a 23                	push   $0x23
+  8011d2:	68 e8 44 80 00       	push   $0x8044e8
+  8011d7:	e8 e7 25 00 00       	call   8037c3 <_panic>
+
+008011dc <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	57                   	push   %edi
+  8011e0:	56                   	push   %esi
+  8011e1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011ec:	89 d1                	mov    %edx,%ecx
+  8011ee:	89 d3                	mov    %edx,%ebx
+  8011f0:	89 d7                	mov    %edx,%edi
+  8011f2:	89 d6                	mov    %edx,%esi
+  8011f4:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+
+008011fb <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801211:	89 df                	mov    %ebx,%edi
+  801213:	89 de                	mov    %ebx,%esi
+  801215:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801217:	5b                   	pop    %ebx
+  801218:	5e                   	pop    %esi
+  801219:	5f                   	pop    %edi
+  80121a:	5d                   	pop    %ebp
+  80121b:	c3                   	ret
+
+0080121c <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	57                   	push   %edi
+  801220:	56                   	push   %esi
+  801221:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801222:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80122f:	89 cb                	mov    %ecx,%ebx
+  801231:	89 cf                	mov    %ecx,%edi
+  801233:	89 ce                	mov    %ecx,%esi
+  801235:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801237:	5b                   	pop    %ebx
+  801238:	5e                   	pop    %esi
+  801239:	5f                   	pop    %edi
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+
+0080123c <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801242:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801252:	89 df                	mov    %ebx,%edi
+  801254:	89 de                	mov    %ebx,%esi
+  801256:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801258:	5b                   	pop    %ebx
+  801259:	5e                   	pop    %esi
+  80125a:	5f                   	pop    %edi
+  80125b:	5d                   	pop    %ebp
+  80125c:	c3                   	ret
+
+0080125d <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80125d:	55                   	push   %ebp
+  80125e:	89 e5                	mov    %esp,%ebp
+  801260:	57                   	push   %edi
+  801261:	56                   	push   %esi
+  801262:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801263:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801268:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801273:	89 df                	mov    %ebx,%edi
+  801275:	89 de                	mov    %ebx,%esi
+  801277:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801279:	5b                   	pop    %ebx
+  80127a:	5e                   	pop    %esi
+  80127b:	5f                   	pop    %edi
+  80127c:	5d                   	pop    %ebp
+  80127d:	c3                   	ret
+
+0080127e <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	57                   	push   %edi
+  801282:	56                   	push   %esi
+  801283:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801284:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801289:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801291:	89 cb                	mov    %ecx,%ebx
+  801293:	89 cf                	mov    %ecx,%edi
+  801295:	89 ce                	mov    %ecx,%esi
+  801297:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+
+0080129e <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	57                   	push   %edi
+  8012a2:	56                   	push   %esi
+  8012a3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012af:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012b4:	89 df                	mov    %ebx,%edi
+  8012b6:	89 de                	mov    %ebx,%esi
+  8012b8:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8012ba:	5b                   	pop    %ebx
+  8012bb:	5e                   	pop    %esi
+  8012bc:	5f                   	pop    %edi
+  8012bd:	5d                   	pop    %ebp
+  8012be:	c3                   	ret
+
+008012bf <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	57                   	push   %edi
+  8012c3:	56                   	push   %esi
+  8012c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cd:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012d2:	89 cb                	mov    %ecx,%ebx
+  8012d4:	89 cf                	mov    %ecx,%edi
+  8012d6:	89 ce                	mov    %ecx,%esi
+  8012d8:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8012da:	5b                   	pop    %ebx
+  8012db:	5e                   	pop    %esi
+  8012dc:	5f                   	pop    %edi
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+
+008012df <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	56                   	push   %esi
+  8012e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f8:	89 f7                	mov    %esi,%edi
+  8012fa:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8012fc:	5b                   	pop    %ebx
+  8012fd:	5e                   	pop    %esi
+  8012fe:	5f                   	pop    %edi
+  8012ff:	5d                   	pop    %ebp
+  801300:	c3                   	ret
+
+00801301 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	57                   	push   %edi
+  801305:	56                   	push   %esi
+  801306:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801307:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801312:	b8 17 00 00 00       	mov    $0x17,%eax
+  801317:	89 df                	mov    %ebx,%edi
+  801319:	89 de                	mov    %ebx,%esi
+  80131b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80131d:	5b                   	pop    %ebx
+  80131e:	5e                   	pop    %esi
+  80131f:	5f                   	pop    %edi
+  801320:	5d                   	pop    %ebp
+  801321:	c3                   	ret
+
+00801322 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	57                   	push   %edi
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801328:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801330:	b8 18 00 00 00       	mov    $0x18,%eax
+  801335:	89 cb                	mov    %ecx,%ebx
+  801337:	89 cf                	mov    %ecx,%edi
+  801339:	89 ce                	mov    %ecx,%esi
+  80133b:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80133d:	5b                   	pop    %ebx
+  80133e:	5e                   	pop    %esi
+  80133f:	5f                   	pop    %edi
+  801340:	5d                   	pop    %ebp
+  801341:	c3                   	ret
+
+00801342 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	57                   	push   %edi
+  801346:	56                   	push   %esi
+  801347:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801348:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80134c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	b8 19 00 00 00       	mov    $0x19,%eax
+  801359:	89 df                	mov    %ebx,%edi
+  80135b:	89 de                	mov    %ebx,%esi
+  80135d:	cd 30                	int    $0x30
+}
+  80135f:	5b                   	pop    %ebx
+  801360:	5e                   	pop    %esi
+  801361:	5f                   	pop    %edi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+
+00801364 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	57                   	push   %edi
+  801368:	56                   	push   %esi
+  801369:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80136a:	be 00 00 00 00       	mov    $0x0,%esi
+  80136f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801372:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801375:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80137a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137d:	89 f7                	mov    %esi,%edi
+  80137f:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801381:	5b                   	pop    %ebx
+  801382:	5e                   	pop    %esi
+  801383:	5f                   	pop    %edi
+  801384:	5d                   	pop    %ebp
+  801385:	c3                   	ret
+
+00801386 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801386:	55                   	push   %ebp
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	57                   	push   %edi
+  80138a:	56                   	push   %esi
+  80138b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80138c:	be 00 00 00 00       	mov    $0x0,%esi
+  801391:	8b 55 08             	mov    0x8(%ebp),%edx
+  801394:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801397:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80139c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139f:	89 f7                	mov    %esi,%edi
+  8013a1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5f                   	pop    %edi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+
+008013a8 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8013a8:	55                   	push   %ebp
+  8013a9:	89 e5                	mov    %esp,%ebp
+  8013ab:	57                   	push   %edi
+  8013ac:	56                   	push   %esi
+  8013ad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013be:	89 df                	mov    %ebx,%edi
+  8013c0:	89 de                	mov    %ebx,%esi
+  8013c2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8013c4:	5b                   	pop    %ebx
+  8013c5:	5e                   	pop    %esi
+  8013c6:	5f                   	pop    %edi
+  8013c7:	5d                   	pop    %ebp
+  8013c8:	c3                   	ret
+
+008013c9 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013da:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e2:	89 f7                	mov    %esi,%edi
+  8013e4:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8013e6:	5b                   	pop    %ebx
+  8013e7:	5e                   	pop    %esi
+  8013e8:	5f                   	pop    %edi
+  8013e9:	5d                   	pop    %ebp
+  8013ea:	c3                   	ret
+
+008013eb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013f6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013f9:	5d                   	pop    %ebp
+  8013fa:	c3                   	ret
+
+008013fb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801401:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801406:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80140b:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+
+00801412 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80141a:	89 c2                	mov    %eax,%edx
+  80141c:	c1 ea 16             	shr    $0x16,%edx
+  80141f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801426:	f6 c2 01             	test   $0x1,%dl
+  801429:	74 29                	je     801454 <fd_alloc+0x42>
+  80142b:	89 c2                	mov    %eax,%edx
+  80142d:	c1 ea 0c             	shr    $0xc,%edx
+  801430:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801437:	f6 c2 01             	test   $0x1,%dl
+  80143a:	74 18                	je     801454 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80143c:	05 00 10 00 00       	add    $0x1000,%eax
+  801441:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801446:	75 d2                	jne    80141a <fd_alloc+0x8>
+  801448:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80144d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801452:	eb 05                	jmp    801459 <fd_alloc+0x47>
+			return 0;
+  801454:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145c:	89 02                	mov    %eax,(%edx)
+}
+  80145e:	89 c8                	mov    %ecx,%eax
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+
+00801462 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801468:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80146d:	77 30                	ja     80149f <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80146f:	c1 e0 0c             	shl    $0xc,%eax
+  801472:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801477:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80147d:	f6 c2 01             	test   $0x1,%dl
+  801480:	74 24                	je     8014a6 <fd_lookup+0x44>
+  801482:	89 c2                	mov    %eax,%edx
+  801484:	c1 ea 0c             	shr    $0xc,%edx
+  801487:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80148e:	f6 c2 01             	test   $0x1,%dl
+  801491:	74 1a                	je     8014ad <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801493:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801496:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801498:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80149d:	5d                   	pop    %ebp
+  80149e:	c3                   	ret
+		return -E_INVAL;
+  80149f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a4:	eb f7                	jmp    80149d <fd_lookup+0x3b>
+		return -E_INVAL;
+  8014a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ab:	eb f0                	jmp    80149d <fd_lookup+0x3b>
+  8014ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b2:	eb e9                	jmp    80149d <fd_lookup+0x3b>
+
+008014b4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014b4:	55                   	push   %ebp
+  8014b5:	89 e5                	mov    %esp,%ebp
+  8014b7:	53                   	push   %ebx
+  8014b8:	83 ec 04             	sub    $0x4,%esp
+  8014bb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c3:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8014c8:	39 13                	cmp    %edx,(%ebx)
+  8014ca:	74 54                	je     801520 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8014cc:	83 c0 01             	add    $0x1,%eax
+  8014cf:	8b 1c 85 74 45 80 00 	mov    0x804574(,%eax,4),%ebx
+  8014d6:	85 db                	test   %ebx,%ebx
+  8014d8:	75 ee                	jne    8014c8 <dev_lookup+0x14>
+  8014da:	89 e1                	mov    %esp,%ecx
+  8014dc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8014e1:	29 c8                	sub    %ecx,%eax
+  8014e3:	89 c1                	mov    %eax,%ecx
+  8014e5:	c1 e9 0f             	shr    $0xf,%ecx
+  8014e8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f2:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014f5:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  8014fc:	8b 40 48             	mov    0x48(%eax),%eax
+  8014ff:	83 ec 04             	sub    $0x4,%esp
+  801502:	52                   	push   %edx
+  801503:	50                   	push   %eax
+  801504:	68 f8 44 80 00       	push   $0x8044f8
+  801509:	e8 4f ef ff ff       	call   80045d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801516:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801519:	89 1a                	mov    %ebx,(%edx)
+}
+  80151b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151e:	c9                   	leave
+  80151f:	c3                   	ret
+			return 0;
+  801520:	b8 00 00 00 00       	mov    $0x0,%eax
+  801525:	eb ef                	jmp    801516 <dev_lookup+0x62>
+
+00801527 <fd_close>:
+{
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	57                   	push   %edi
+  80152b:	56                   	push   %esi
+  80152c:	53                   	push   %ebx
+  80152d:	83 ec 24             	sub    $0x24,%esp
+  801530:	8b 75 08             	mov    0x8(%ebp),%esi
+  801533:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801536:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801539:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80153a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801540:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801543:	50                   	push   %eax
+  801544:	e8 19 ff ff ff       	call   801462 <fd_lookup>
+  801549:	89 c3                	mov    %eax,%ebx
+  80154b:	83 c4 10             	add    $0x10,%esp
+  80154e:	85 c0                	test   %eax,%eax
+  801550:	78 05                	js     801557 <fd_close+0x30>
+	    || fd != fd2)
+  801552:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801555:	74 0f                	je     801566 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801557:	85 ff                	test   %edi,%edi
+  801559:	0f 44 df             	cmove  %edi,%ebx
+}
+  80155c:	89 d8                	mov    %ebx,%eax
+  80155e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801561:	5b                   	pop    %ebx
+  801562:	5e                   	pop    %esi
+  801563:	5f                   	pop    %edi
+  801564:	5d                   	pop    %ebp
+  801565:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801566:	83 ec 08             	sub    $0x8,%esp
+  801569:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80156c:	50                   	push   %eax
+  80156d:	ff 36                	push   (%esi)
+  80156f:	e8 40 ff ff ff       	call   8014b4 <dev_lookup>
+  801574:	89 c3                	mov    %eax,%ebx
+  801576:	83 c4 10             	add    $0x10,%esp
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	78 1a                	js     801597 <fd_close+0x70>
+		if (dev->dev_close)
+  80157d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801580:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801583:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801588:	85 c0                	test   %eax,%eax
+  80158a:	74 0b                	je     801597 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80158c:	83 ec 0c             	sub    $0xc,%esp
+  80158f:	56                   	push   %esi
+  801590:	ff d0                	call   *%eax
+  801592:	89 c3                	mov    %eax,%ebx
+  801594:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801597:	83 ec 08             	sub    $0x8,%esp
+  80159a:	56                   	push   %esi
+  80159b:	6a 00                	push   $0x0
+  80159d:	e8 6b fa ff ff       	call   80100d <sys_page_unmap>
+	return r;
+  8015a2:	83 c4 10             	add    $0x10,%esp
+  8015a5:	eb b5                	jmp    80155c <fd_close+0x35>
+
+008015a7 <close>:
+
+int
+close(int fdnum)
+{
+  8015a7:	55                   	push   %ebp
+  8015a8:	89 e5                	mov    %esp,%ebp
+  8015aa:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b0:	50                   	push   %eax
+  8015b1:	ff 75 08             	push   0x8(%ebp)
+  8015b4:	e8 a9 fe ff ff       	call   801462 <fd_lookup>
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	85 c0                	test   %eax,%eax
+  8015be:	79 02                	jns    8015c2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015c0:	c9                   	leave
+  8015c1:	c3                   	ret
+		return fd_close(fd, 1);
+  8015c2:	83 ec 08             	sub    $0x8,%esp
+  8015c5:	6a 01                	push   $0x1
+  8015c7:	ff 75 f4             	push   -0xc(%ebp)
+  8015ca:	e8 58 ff ff ff       	call   801527 <fd_close>
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	eb ec                	jmp    8015c0 <close+0x19>
+
+008015d4 <close_all>:
+
+void
+close_all(void)
+{
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	53                   	push   %ebx
+  8015d8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015db:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015e0:	83 ec 0c             	sub    $0xc,%esp
+  8015e3:	53                   	push   %ebx
+  8015e4:	e8 be ff ff ff       	call   8015a7 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015e9:	83 c3 01             	add    $0x1,%ebx
+  8015ec:	83 c4 10             	add    $0x10,%esp
+  8015ef:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8015f5:	75 e9                	jne    8015e0 <close_all+0xc>
+}
+  8015f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015fa:	c9                   	leave
+  8015fb:	c3                   	ret
+
+008015fc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015fc:	55                   	push   %ebp
+  8015fd:	89 e5                	mov    %esp,%ebp
+  8015ff:	57                   	push   %edi
+  801600:	56                   	push   %esi
+  801601:	53                   	push   %ebx
+  801602:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801605:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801608:	50                   	push   %eax
+  801609:	ff 75 08             	push   0x8(%ebp)
+  80160c:	e8 51 fe ff ff       	call   801462 <fd_lookup>
+  801611:	89 c3                	mov    %eax,%ebx
+  801613:	83 c4 10             	add    $0x10,%esp
+  801616:	85 c0                	test   %eax,%eax
+  801618:	78 7f                	js     801699 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80161a:	83 ec 0c             	sub    $0xc,%esp
+  80161d:	ff 75 0c             	push   0xc(%ebp)
+  801620:	e8 82 ff ff ff       	call   8015a7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801625:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801628:	c1 e6 0c             	shl    $0xc,%esi
+  80162b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801631:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801634:	89 3c 24             	mov    %edi,(%esp)
+  801637:	e8 bf fd ff ff       	call   8013fb <fd2data>
+  80163c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80163e:	89 34 24             	mov    %esi,(%esp)
+  801641:	e8 b5 fd ff ff       	call   8013fb <fd2data>
+  801646:	83 c4 10             	add    $0x10,%esp
+  801649:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80164c:	89 d8                	mov    %ebx,%eax
+  80164e:	c1 e8 16             	shr    $0x16,%eax
+  801651:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801658:	a8 01                	test   $0x1,%al
+  80165a:	74 11                	je     80166d <dup+0x71>
+  80165c:	89 d8                	mov    %ebx,%eax
+  80165e:	c1 e8 0c             	shr    $0xc,%eax
+  801661:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801668:	f6 c2 01             	test   $0x1,%dl
+  80166b:	75 36                	jne    8016a3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80166d:	89 f8                	mov    %edi,%eax
+  80166f:	c1 e8 0c             	shr    $0xc,%eax
+  801672:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801679:	83 ec 0c             	sub    $0xc,%esp
+  80167c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801681:	50                   	push   %eax
+  801682:	56                   	push   %esi
+  801683:	6a 00                	push   $0x0
+  801685:	57                   	push   %edi
+  801686:	6a 00                	push   $0x0
+  801688:	e8 3e f9 ff ff       	call   800fcb <sys_page_map>
+  80168d:	89 c3                	mov    %eax,%ebx
+  80168f:	83 c4 20             	add    $0x20,%esp
+  801692:	85 c0                	test   %eax,%eax
+  801694:	78 33                	js     8016c9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801696:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801699:	89 d8                	mov    %ebx,%eax
+  80169b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169e:	5b                   	pop    %ebx
+  80169f:	5e                   	pop    %esi
+  8016a0:	5f                   	pop    %edi
+  8016a1:	5d                   	pop    %ebp
+  8016a2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016a3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016aa:	83 ec 0c             	sub    $0xc,%esp
+  8016ad:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016b2:	50                   	push   %eax
+  8016b3:	ff 75 d4             	push   -0x2c(%ebp)
+  8016b6:	6a 00                	push   $0x0
+  8016b8:	53                   	push   %ebx
+  8016b9:	6a 00                	push   $0x0
+  8016bb:	e8 0b f9 ff ff       	call   800fcb <sys_page_map>
+  8016c0:	89 c3                	mov    %eax,%ebx
+  8016c2:	83 c4 20             	add    $0x20,%esp
+  8016c5:	85 c0                	test   %eax,%eax
+  8016c7:	79 a4                	jns    80166d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016c9:	83 ec 08             	sub    $0x8,%esp
+  8016cc:	56                   	push   %esi
+  8016cd:	6a 00                	push   $0x0
+  8016cf:	e8 39 f9 ff ff       	call   80100d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016d4:	83 c4 08             	add    $0x8,%esp
+  8016d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8016da:	6a 00                	push   $0x0
+  8016dc:	e8 2c f9 ff ff       	call   80100d <sys_page_unmap>
+	return r;
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	eb b3                	jmp    801699 <dup+0x9d>
+
+008016e6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	56                   	push   %esi
+  8016ea:	53                   	push   %ebx
+  8016eb:	83 ec 18             	sub    $0x18,%esp
+  8016ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f4:	50                   	push   %eax
+  8016f5:	53                   	push   %ebx
+  8016f6:	e8 67 fd ff ff       	call   801462 <fd_lookup>
+  8016fb:	83 c4 10             	add    $0x10,%esp
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	78 3c                	js     80173e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801702:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801705:	83 ec 08             	sub    $0x8,%esp
+  801708:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170b:	50                   	push   %eax
+  80170c:	ff 36                	push   (%esi)
+  80170e:	e8 a1 fd ff ff       	call   8014b4 <dev_lookup>
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 24                	js     80173e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80171a:	8b 46 08             	mov    0x8(%esi),%eax
+  80171d:	83 e0 03             	and    $0x3,%eax
+  801720:	83 f8 01             	cmp    $0x1,%eax
+  801723:	74 20                	je     801745 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801725:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801728:	8b 40 08             	mov    0x8(%eax),%eax
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	74 54                	je     801783 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80172f:	83 ec 04             	sub    $0x4,%esp
+  801732:	ff 75 10             	push   0x10(%ebp)
+  801735:	ff 75 0c             	push   0xc(%ebp)
+  801738:	56                   	push   %esi
+  801739:	ff d0                	call   *%eax
+  80173b:	83 c4 10             	add    $0x10,%esp
+}
+  80173e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801741:	5b                   	pop    %ebx
+  801742:	5e                   	pop    %esi
+  801743:	5d                   	pop    %ebp
+  801744:	c3                   	ret
+  801745:	89 e2                	mov    %esp,%edx
+  801747:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80174c:	29 d0                	sub    %edx,%eax
+  80174e:	89 c2                	mov    %eax,%edx
+  801750:	c1 ea 0f             	shr    $0xf,%edx
+  801753:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175d:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801760:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  801767:	8b 40 48             	mov    0x48(%eax),%eax
+  80176a:	83 ec 04             	sub    $0x4,%esp
+  80176d:	53                   	push   %ebx
+  80176e:	50                   	push   %eax
+  80176f:	68 39 45 80 00       	push   $0x804539
+  801774:	e8 e4 ec ff ff       	call   80045d <cprintf>
+		return -E_INVAL;
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801781:	eb bb                	jmp    80173e <read+0x58>
+		return -E_NOT_SUPP;
+  801783:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801788:	eb b4                	jmp    80173e <read+0x58>
+
+0080178a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	57                   	push   %edi
+  80178e:	56                   	push   %esi
+  80178f:	53                   	push   %ebx
+  801790:	83 ec 0c             	sub    $0xc,%esp
+  801793:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801796:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801799:	85 f6                	test   %esi,%esi
+  80179b:	74 30                	je     8017cd <readn+0x43>
+  80179d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017a7:	83 ec 04             	sub    $0x4,%esp
+  8017aa:	89 f2                	mov    %esi,%edx
+  8017ac:	29 c2                	sub    %eax,%edx
+  8017ae:	52                   	push   %edx
+  8017af:	01 f8                	add    %edi,%eax
+  8017b1:	50                   	push   %eax
+  8017b2:	ff 75 08             	push   0x8(%ebp)
+  8017b5:	e8 2c ff ff ff       	call   8016e6 <read>
+		if (m < 0)
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	78 15                	js     8017d6 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8017c1:	74 11                	je     8017d4 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8017c3:	01 c3                	add    %eax,%ebx
+  8017c5:	89 d8                	mov    %ebx,%eax
+  8017c7:	39 f3                	cmp    %esi,%ebx
+  8017c9:	72 dc                	jb     8017a7 <readn+0x1d>
+  8017cb:	eb 09                	jmp    8017d6 <readn+0x4c>
+  8017cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d2:	eb 02                	jmp    8017d6 <readn+0x4c>
+  8017d4:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8017d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d9:	5b                   	pop    %ebx
+  8017da:	5e                   	pop    %esi
+  8017db:	5f                   	pop    %edi
+  8017dc:	5d                   	pop    %ebp
+  8017dd:	c3                   	ret
+
+008017de <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+  8017e1:	56                   	push   %esi
+  8017e2:	53                   	push   %ebx
+  8017e3:	83 ec 18             	sub    $0x18,%esp
+  8017e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ec:	50                   	push   %eax
+  8017ed:	53                   	push   %ebx
+  8017ee:	e8 6f fc ff ff       	call   801462 <fd_lookup>
+  8017f3:	83 c4 10             	add    $0x10,%esp
+  8017f6:	85 c0                	test   %eax,%eax
+  8017f8:	78 37                	js     801831 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017fa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017fd:	83 ec 08             	sub    $0x8,%esp
+  801800:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801803:	50                   	push   %eax
+  801804:	ff 36                	push   (%esi)
+  801806:	e8 a9 fc ff ff       	call   8014b4 <dev_lookup>
+  80180b:	83 c4 10             	add    $0x10,%esp
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	78 1f                	js     801831 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801812:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801816:	74 20                	je     801838 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80181b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	74 54                	je     801876 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801822:	83 ec 04             	sub    $0x4,%esp
+  801825:	ff 75 10             	push   0x10(%ebp)
+  801828:	ff 75 0c             	push   0xc(%ebp)
+  80182b:	56                   	push   %esi
+  80182c:	ff d0                	call   *%eax
+  80182e:	83 c4 10             	add    $0x10,%esp
+}
+  801831:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801834:	5b                   	pop    %ebx
+  801835:	5e                   	pop    %esi
+  801836:	5d                   	pop    %ebp
+  801837:	c3                   	ret
+  801838:	89 e2                	mov    %esp,%edx
+  80183a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80183f:	29 d0                	sub    %edx,%eax
+  801841:	89 c2                	mov    %eax,%edx
+  801843:	c1 ea 0f             	shr    $0xf,%edx
+  801846:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80184b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801850:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801853:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  80185a:	8b 40 48             	mov    0x48(%eax),%eax
+  80185d:	83 ec 04             	sub    $0x4,%esp
+  801860:	53                   	push   %ebx
+  801861:	50                   	push   %eax
+  801862:	68 55 45 80 00       	push   $0x804555
+  801867:	e8 f1 eb ff ff       	call   80045d <cprintf>
+		return -E_INVAL;
+  80186c:	83 c4 10             	add    $0x10,%esp
+  80186f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801874:	eb bb                	jmp    801831 <write+0x53>
+		return -E_NOT_SUPP;
+  801876:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80187b:	eb b4                	jmp    801831 <write+0x53>
+
+0080187d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80187d:	55                   	push   %ebp
+  80187e:	89 e5                	mov    %esp,%ebp
+  801880:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801883:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801886:	50                   	push   %eax
+  801887:	ff 75 08             	push   0x8(%ebp)
+  80188a:	e8 d3 fb ff ff       	call   801462 <fd_lookup>
+  80188f:	83 c4 10             	add    $0x10,%esp
+  801892:	85 c0                	test   %eax,%eax
+  801894:	78 0e                	js     8018a4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801896:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80189f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a4:	c9                   	leave
+  8018a5:	c3                   	ret
+
+008018a6 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	53                   	push   %ebx
+  8018aa:	83 ec 1c             	sub    $0x1c,%esp
+  8018ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018b3:	50                   	push   %eax
+  8018b4:	ff 75 08             	push   0x8(%ebp)
+  8018b7:	e8 a6 fb ff ff       	call   801462 <fd_lookup>
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	85 c0                	test   %eax,%eax
+  8018c1:	78 33                	js     8018f6 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8018c3:	83 fb 03             	cmp    $0x3,%ebx
+  8018c6:	74 28                	je     8018f0 <fcntl+0x4a>
+  8018c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018cd:	83 fb 04             	cmp    $0x4,%ebx
+  8018d0:	75 24                	jne    8018f6 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8018d2:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8018d5:	8b 41 08             	mov    0x8(%ecx),%eax
+  8018d8:	80 e4 ef             	and    $0xef,%ah
+  8018db:	8b 55 10             	mov    0x10(%ebp),%edx
+  8018de:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8018e4:	09 d0                	or     %edx,%eax
+  8018e6:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8018e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ee:	eb 06                	jmp    8018f6 <fcntl+0x50>
+		return fd->fd_omode;
+  8018f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f3:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8018f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018f9:	c9                   	leave
+  8018fa:	c3                   	ret
+
+008018fb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018fb:	55                   	push   %ebp
+  8018fc:	89 e5                	mov    %esp,%ebp
+  8018fe:	56                   	push   %esi
+  8018ff:	53                   	push   %ebx
+  801900:	83 ec 18             	sub    $0x18,%esp
+  801903:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801906:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801909:	50                   	push   %eax
+  80190a:	53                   	push   %ebx
+  80190b:	e8 52 fb ff ff       	call   801462 <fd_lookup>
+  801910:	83 c4 10             	add    $0x10,%esp
+  801913:	85 c0                	test   %eax,%eax
+  801915:	78 34                	js     80194b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801917:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80191a:	83 ec 08             	sub    $0x8,%esp
+  80191d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801920:	50                   	push   %eax
+  801921:	ff 36                	push   (%esi)
+  801923:	e8 8c fb ff ff       	call   8014b4 <dev_lookup>
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	85 c0                	test   %eax,%eax
+  80192d:	78 1c                	js     80194b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80192f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801933:	74 1d                	je     801952 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801935:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801938:	8b 40 18             	mov    0x18(%eax),%eax
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	74 51                	je     801990 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80193f:	83 ec 08             	sub    $0x8,%esp
+  801942:	ff 75 0c             	push   0xc(%ebp)
+  801945:	56                   	push   %esi
+  801946:	ff d0                	call   *%eax
+  801948:	83 c4 10             	add    $0x10,%esp
+}
+  80194b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80194e:	5b                   	pop    %ebx
+  80194f:	5e                   	pop    %esi
+  801950:	5d                   	pop    %ebp
+  801951:	c3                   	ret
+  801952:	89 e2                	mov    %esp,%edx
+  801954:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801959:	29 d0                	sub    %edx,%eax
+  80195b:	89 c2                	mov    %eax,%edx
+  80195d:	c1 ea 0f             	shr    $0xf,%edx
+  801960:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196a:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80196d:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  801974:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801977:	83 ec 04             	sub    $0x4,%esp
+  80197a:	53                   	push   %ebx
+  80197b:	50                   	push   %eax
+  80197c:	68 18 45 80 00       	push   $0x804518
+  801981:	e8 d7 ea ff ff       	call   80045d <cprintf>
+		return -E_INVAL;
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80198e:	eb bb                	jmp    80194b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801990:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801995:	eb b4                	jmp    80194b <ftruncate+0x50>
+
+00801997 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	56                   	push   %esi
+  80199b:	53                   	push   %ebx
+  80199c:	83 ec 18             	sub    $0x18,%esp
+  80199f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019a5:	50                   	push   %eax
+  8019a6:	ff 75 08             	push   0x8(%ebp)
+  8019a9:	e8 b4 fa ff ff       	call   801462 <fd_lookup>
+  8019ae:	83 c4 10             	add    $0x10,%esp
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 53                	js     801a08 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019b5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019b8:	83 ec 08             	sub    $0x8,%esp
+  8019bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019be:	50                   	push   %eax
+  8019bf:	ff 36                	push   (%esi)
+  8019c1:	e8 ee fa ff ff       	call   8014b4 <dev_lookup>
+  8019c6:	83 c4 10             	add    $0x10,%esp
+  8019c9:	85 c0                	test   %eax,%eax
+  8019cb:	78 3b                	js     801a08 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8019cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019d4:	74 39                	je     801a0f <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019d6:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019d9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019e0:	00 00 00 
+	stat->st_isdir = 0;
+  8019e3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019ea:	00 00 00 
+	stat->st_version = 0;
+  8019ed:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8019f4:	00 00 00 
+	stat->st_dev = dev;
+  8019f7:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019fd:	83 ec 08             	sub    $0x8,%esp
+  801a00:	53                   	push   %ebx
+  801a01:	56                   	push   %esi
+  801a02:	ff 50 14             	call   *0x14(%eax)
+  801a05:	83 c4 10             	add    $0x10,%esp
+}
+  801a08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a0b:	5b                   	pop    %ebx
+  801a0c:	5e                   	pop    %esi
+  801a0d:	5d                   	pop    %ebp
+  801a0e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a0f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a14:	eb f2                	jmp    801a08 <fstat+0x71>
+
+00801a16 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a16:	55                   	push   %ebp
+  801a17:	89 e5                	mov    %esp,%ebp
+  801a19:	56                   	push   %esi
+  801a1a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a1b:	83 ec 08             	sub    $0x8,%esp
+  801a1e:	6a 00                	push   $0x0
+  801a20:	ff 75 08             	push   0x8(%ebp)
+  801a23:	e8 b7 01 00 00       	call   801bdf <open>
+  801a28:	89 c3                	mov    %eax,%ebx
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	78 1b                	js     801a4c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a31:	83 ec 08             	sub    $0x8,%esp
+  801a34:	ff 75 0c             	push   0xc(%ebp)
+  801a37:	50                   	push   %eax
+  801a38:	e8 5a ff ff ff       	call   801997 <fstat>
+  801a3d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a3f:	89 1c 24             	mov    %ebx,(%esp)
+  801a42:	e8 60 fb ff ff       	call   8015a7 <close>
+	return r;
+  801a47:	83 c4 10             	add    $0x10,%esp
+  801a4a:	89 f3                	mov    %esi,%ebx
+}
+  801a4c:	89 d8                	mov    %ebx,%eax
+  801a4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a51:	5b                   	pop    %ebx
+  801a52:	5e                   	pop    %esi
+  801a53:	5d                   	pop    %ebp
+  801a54:	c3                   	ret
+
+00801a55 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a55:	55                   	push   %ebp
+  801a56:	89 e5                	mov    %esp,%ebp
+  801a58:	56                   	push   %esi
+  801a59:	53                   	push   %ebx
+  801a5a:	89 c6                	mov    %eax,%esi
+  801a5c:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801a5e:	83 3d 00 60 81 00 00 	cmpl   $0x0,0x816000
+  801a65:	74 27                	je     801a8e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a67:	6a 07                	push   $0x7
+  801a69:	68 00 70 81 00       	push   $0x817000
+  801a6e:	56                   	push   %esi
+  801a6f:	ff 35 00 60 81 00    	push   0x816000
+  801a75:	e8 1f 20 00 00       	call   803a99 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a7a:	83 c4 0c             	add    $0xc,%esp
+  801a7d:	6a 00                	push   $0x0
+  801a7f:	53                   	push   %ebx
+  801a80:	6a 00                	push   $0x0
+  801a82:	e8 82 1d 00 00       	call   803809 <ipc_recv>
+}
+  801a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8a:	5b                   	pop    %ebx
+  801a8b:	5e                   	pop    %esi
+  801a8c:	5d                   	pop    %ebp
+  801a8d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a8e:	83 ec 0c             	sub    $0xc,%esp
+  801a91:	6a 02                	push   $0x2
+  801a93:	e8 6a 20 00 00       	call   803b02 <ipc_find_env>
+  801a98:	a3 00 60 81 00       	mov    %eax,0x816000
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	eb c5                	jmp    801a67 <fsipc+0x12>
+
+00801aa2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801aa2:	55                   	push   %ebp
+  801aa3:	89 e5                	mov    %esp,%ebp
+  801aa5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aab:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aae:	a3 00 70 81 00       	mov    %eax,0x817000
+	fsipcbuf.set_size.req_size = newsize;
+  801ab3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab6:	a3 04 70 81 00       	mov    %eax,0x817004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801abb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac0:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ac5:	e8 8b ff ff ff       	call   801a55 <fsipc>
+}
+  801aca:	c9                   	leave
+  801acb:	c3                   	ret
+
+00801acc <devfile_flush>:
+{
+  801acc:	55                   	push   %ebp
+  801acd:	89 e5                	mov    %esp,%ebp
+  801acf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ad8:	a3 00 70 81 00       	mov    %eax,0x817000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801add:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae2:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ae7:	e8 69 ff ff ff       	call   801a55 <fsipc>
+}
+  801aec:	c9                   	leave
+  801aed:	c3                   	ret
+
+00801aee <devfile_stat>:
+{
+  801aee:	55                   	push   %ebp
+  801aef:	89 e5                	mov    %esp,%ebp
+  801af1:	53                   	push   %ebx
+  801af2:	83 ec 04             	sub    $0x4,%esp
+  801af5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801afe:	a3 00 70 81 00       	mov    %eax,0x817000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b08:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b0d:	e8 43 ff ff ff       	call   801a55 <fsipc>
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	78 37                	js     801b4d <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b16:	83 ec 08             	sub    $0x8,%esp
+  801b19:	68 00 70 81 00       	push   $0x817000
+  801b1e:	53                   	push   %ebx
+  801b1f:	e8 30 f0 ff ff       	call   800b54 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b24:	a1 80 70 81 00       	mov    0x817080,%eax
+  801b29:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b2f:	a1 84 70 81 00       	mov    0x817084,%eax
+  801b34:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801b3a:	a1 88 70 81 00       	mov    0x817088,%eax
+  801b3f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b50:	c9                   	leave
+  801b51:	c3                   	ret
+
+00801b52 <devfile_write>:
+{
+  801b52:	55                   	push   %ebp
+  801b53:	89 e5                	mov    %esp,%ebp
+  801b55:	83 ec 0c             	sub    $0xc,%esp
+  801b58:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801b5b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b60:	39 d0                	cmp    %edx,%eax
+  801b62:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b65:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b68:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b6b:	89 15 00 70 81 00    	mov    %edx,0x817000
+	fsipcbuf.write.req_n = count;
+  801b71:	a3 04 70 81 00       	mov    %eax,0x817004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801b76:	50                   	push   %eax
+  801b77:	ff 75 0c             	push   0xc(%ebp)
+  801b7a:	68 08 70 81 00       	push   $0x817008
+  801b7f:	e8 80 f1 ff ff       	call   800d04 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801b84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b89:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b8e:	e8 c2 fe ff ff       	call   801a55 <fsipc>
+}
+  801b93:	c9                   	leave
+  801b94:	c3                   	ret
+
+00801b95 <devfile_read>:
+{
+  801b95:	55                   	push   %ebp
+  801b96:	89 e5                	mov    %esp,%ebp
+  801b98:	53                   	push   %ebx
+  801b99:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ba2:	a3 00 70 81 00       	mov    %eax,0x817000
+	fsipcbuf.read.req_n = n;
+  801ba7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801baa:	a3 04 70 81 00       	mov    %eax,0x817004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801baf:	ba 00 70 81 00       	mov    $0x817000,%edx
+  801bb4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bb9:	e8 97 fe ff ff       	call   801a55 <fsipc>
+  801bbe:	89 c3                	mov    %eax,%ebx
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 14                	js     801bd8 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801bc4:	83 ec 04             	sub    $0x4,%esp
+  801bc7:	50                   	push   %eax
+  801bc8:	68 00 70 81 00       	push   $0x817000
+  801bcd:	ff 75 0c             	push   0xc(%ebp)
+  801bd0:	e8 2f f1 ff ff       	call   800d04 <memmove>
+	return r;
+  801bd5:	83 c4 10             	add    $0x10,%esp
+}
+  801bd8:	89 d8                	mov    %ebx,%eax
+  801bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bdd:	c9                   	leave
+  801bde:	c3                   	ret
+
+00801bdf <open>:
+{
+  801bdf:	55                   	push   %ebp
+  801be0:	89 e5                	mov    %esp,%ebp
+  801be2:	53                   	push   %ebx
+  801be3:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801be6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be9:	50                   	push   %eax
+  801bea:	e8 23 f8 ff ff       	call   801412 <fd_alloc>
+  801bef:	89 c3                	mov    %eax,%ebx
+  801bf1:	83 c4 10             	add    $0x10,%esp
+  801bf4:	85 c0                	test   %eax,%eax
+  801bf6:	78 2a                	js     801c22 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801bf8:	83 ec 0c             	sub    $0xc,%esp
+  801bfb:	ff 75 08             	push   0x8(%ebp)
+  801bfe:	e8 05 ef ff ff       	call   800b08 <strlen>
+  801c03:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801c06:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801c0b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c10:	7e 17                	jle    801c29 <open+0x4a>
+	fd_close(fd, 1);
+  801c12:	83 ec 08             	sub    $0x8,%esp
+  801c15:	6a 01                	push   $0x1
+  801c17:	ff 75 f4             	push   -0xc(%ebp)
+  801c1a:	e8 08 f9 ff ff       	call   801527 <fd_close>
+	return r;
+  801c1f:	83 c4 10             	add    $0x10,%esp
+}
+  801c22:	89 d8                	mov    %ebx,%eax
+  801c24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801c29:	83 ec 08             	sub    $0x8,%esp
+  801c2c:	ff 75 08             	push   0x8(%ebp)
+  801c2f:	68 00 70 81 00       	push   $0x817000
+  801c34:	e8 1b ef ff ff       	call   800b54 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3c:	a3 00 74 81 00       	mov    %eax,0x817400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801c41:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c44:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c49:	e8 07 fe ff ff       	call   801a55 <fsipc>
+  801c4e:	89 c3                	mov    %eax,%ebx
+  801c50:	83 c4 10             	add    $0x10,%esp
+  801c53:	85 c0                	test   %eax,%eax
+  801c55:	78 bb                	js     801c12 <open+0x33>
+	return fd2num(fd); 	
+  801c57:	83 ec 0c             	sub    $0xc,%esp
+  801c5a:	ff 75 f4             	push   -0xc(%ebp)
+  801c5d:	e8 89 f7 ff ff       	call   8013eb <fd2num>
+  801c62:	89 c3                	mov    %eax,%ebx
+  801c64:	83 c4 10             	add    $0x10,%esp
+  801c67:	eb b9                	jmp    801c22 <open+0x43>
+
+00801c69 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	53                   	push   %ebx
+  801c6d:	83 ec 1c             	sub    $0x1c,%esp
+  801c70:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c76:	50                   	push   %eax
+  801c77:	ff 75 08             	push   0x8(%ebp)
+  801c7a:	e8 e3 f7 ff ff       	call   801462 <fd_lookup>
+  801c7f:	83 c4 10             	add    $0x10,%esp
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	78 5a                	js     801ce0 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801c86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c89:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801c8f:	39 10                	cmp    %edx,(%eax)
+  801c91:	75 66                	jne    801cf9 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801c93:	83 3d 00 60 81 00 00 	cmpl   $0x0,0x816000
+  801c9a:	74 49                	je     801ce5 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801c9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c9f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ca2:	a3 00 70 81 00       	mov    %eax,0x817000
+	fsipcbuf.map.req_offset = offset;
+  801ca7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801caa:	a3 04 70 81 00       	mov    %eax,0x817004
+	fsipcbuf.map.req_npages = maxpages;
+  801caf:	89 1d 08 70 81 00    	mov    %ebx,0x817008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801cb5:	6a 07                	push   $0x7
+  801cb7:	68 00 70 81 00       	push   $0x817000
+  801cbc:	6a 09                	push   $0x9
+  801cbe:	ff 35 00 60 81 00    	push   0x816000
+  801cc4:	e8 d0 1d 00 00       	call   803a99 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801cc9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801cd0:	6a 00                	push   $0x0
+  801cd2:	53                   	push   %ebx
+  801cd3:	ff 75 10             	push   0x10(%ebp)
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	e8 f9 1b 00 00       	call   8038d6 <ipc_recv_pages>
+  801cdd:	83 c4 20             	add    $0x20,%esp
+}
+  801ce0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ce3:	c9                   	leave
+  801ce4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ce5:	83 ec 0c             	sub    $0xc,%esp
+  801ce8:	6a 02                	push   $0x2
+  801cea:	e8 13 1e 00 00       	call   803b02 <ipc_find_env>
+  801cef:	a3 00 60 81 00       	mov    %eax,0x816000
+  801cf4:	83 c4 10             	add    $0x10,%esp
+  801cf7:	eb a3                	jmp    801c9c <fmap+0x33>
+		return -E_INVAL;
+  801cf9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cfe:	eb e0                	jmp    801ce0 <fmap+0x77>
+
+00801d00 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801d00:	55                   	push   %ebp
+  801d01:	89 e5                	mov    %esp,%ebp
+  801d03:	53                   	push   %ebx
+  801d04:	83 ec 10             	sub    $0x10,%esp
+  801d07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801d0a:	53                   	push   %ebx
+  801d0b:	e8 f8 ed ff ff       	call   800b08 <strlen>
+  801d10:	83 c4 10             	add    $0x10,%esp
+  801d13:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d18:	7f 25                	jg     801d3f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+  801d1d:	53                   	push   %ebx
+  801d1e:	68 00 70 81 00       	push   $0x817000
+  801d23:	e8 2c ee ff ff       	call   800b54 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801d28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d32:	e8 1e fd ff ff       	call   801a55 <fsipc>
+  801d37:	83 c4 10             	add    $0x10,%esp
+}
+  801d3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+		return -E_BAD_PATH;
+  801d3f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801d44:	eb f4                	jmp    801d3a <remove+0x3a>
+
+00801d46 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d46:	55                   	push   %ebp
+  801d47:	89 e5                	mov    %esp,%ebp
+  801d49:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801d4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d51:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d56:	e8 fa fc ff ff       	call   801a55 <fsipc>
+}
+  801d5b:	c9                   	leave
+  801d5c:	c3                   	ret
+
+00801d5d <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d5d:	55                   	push   %ebp
+  801d5e:	89 e5                	mov    %esp,%ebp
+  801d60:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801d63:	68 88 45 80 00       	push   $0x804588
+  801d68:	ff 75 0c             	push   0xc(%ebp)
+  801d6b:	e8 e4 ed ff ff       	call   800b54 <strcpy>
+	return 0;
+}
+  801d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d75:	c9                   	leave
+  801d76:	c3                   	ret
+
+00801d77 <devsock_close>:
+{
+  801d77:	55                   	push   %ebp
+  801d78:	89 e5                	mov    %esp,%ebp
+  801d7a:	53                   	push   %ebx
+  801d7b:	83 ec 10             	sub    $0x10,%esp
+  801d7e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801d81:	53                   	push   %ebx
+  801d82:	e8 ba 1d 00 00       	call   803b41 <pageref>
+  801d87:	89 c2                	mov    %eax,%edx
+  801d89:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d91:	83 fa 01             	cmp    $0x1,%edx
+  801d94:	74 05                	je     801d9b <devsock_close+0x24>
+}
+  801d96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d99:	c9                   	leave
+  801d9a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d9b:	83 ec 0c             	sub    $0xc,%esp
+  801d9e:	ff 73 0c             	push   0xc(%ebx)
+  801da1:	e8 b0 05 00 00       	call   802356 <nsipc_close>
+  801da6:	83 c4 10             	add    $0x10,%esp
+  801da9:	eb eb                	jmp    801d96 <devsock_close+0x1f>
+
+00801dab <devsock_write>:
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	53                   	push   %ebx
+  801daf:	83 ec 14             	sub    $0x14,%esp
+  801db2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801db5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801db8:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801dbb:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801dbe:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801dc1:	8b 41 08             	mov    0x8(%ecx),%eax
+  801dc4:	c1 f8 09             	sar    $0x9,%eax
+  801dc7:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801dca:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801dd0:	77 13                	ja     801de5 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801dd2:	50                   	push   %eax
+  801dd3:	52                   	push   %edx
+  801dd4:	53                   	push   %ebx
+  801dd5:	ff 71 0c             	push   0xc(%ecx)
+  801dd8:	e8 5c 06 00 00       	call   802439 <nsipc_send>
+  801ddd:	83 c4 10             	add    $0x10,%esp
+}
+  801de0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801de3:	c9                   	leave
+  801de4:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801de5:	50                   	push   %eax
+  801de6:	6a 01                	push   $0x1
+  801de8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801deb:	50                   	push   %eax
+  801dec:	ff 71 0c             	push   0xc(%ecx)
+  801def:	e8 a6 06 00 00       	call   80249a <nsipc_sendmsg>
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	eb e7                	jmp    801de0 <devsock_write+0x35>
+
+00801df9 <devsock_read>:
+{
+  801df9:	55                   	push   %ebp
+  801dfa:	89 e5                	mov    %esp,%ebp
+  801dfc:	53                   	push   %ebx
+  801dfd:	83 ec 14             	sub    $0x14,%esp
+  801e00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e06:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801e09:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801e0c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801e0f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e12:	c1 f8 09             	sar    $0x9,%eax
+  801e15:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801e18:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801e1e:	77 13                	ja     801e33 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801e20:	50                   	push   %eax
+  801e21:	52                   	push   %edx
+  801e22:	53                   	push   %ebx
+  801e23:	ff 71 0c             	push   0xc(%ecx)
+  801e26:	e8 9c 05 00 00       	call   8023c7 <nsipc_recv>
+  801e2b:	83 c4 10             	add    $0x10,%esp
+}
+  801e2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e31:	c9                   	leave
+  801e32:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801e33:	50                   	push   %eax
+  801e34:	6a 01                	push   $0x1
+  801e36:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e39:	50                   	push   %eax
+  801e3a:	ff 71 0c             	push   0xc(%ecx)
+  801e3d:	e8 02 0a 00 00       	call   802844 <nsipc_recvmsg>
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	eb e7                	jmp    801e2e <devsock_read+0x35>
+
+00801e47 <fd2sockid>:
+{
+  801e47:	55                   	push   %ebp
+  801e48:	89 e5                	mov    %esp,%ebp
+  801e4a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e4d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e50:	52                   	push   %edx
+  801e51:	50                   	push   %eax
+  801e52:	e8 0b f6 ff ff       	call   801462 <fd_lookup>
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	85 c0                	test   %eax,%eax
+  801e5c:	78 10                	js     801e6e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801e5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e61:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801e67:	39 08                	cmp    %ecx,(%eax)
+  801e69:	75 05                	jne    801e70 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801e6b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801e6e:	c9                   	leave
+  801e6f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e70:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e75:	eb f7                	jmp    801e6e <fd2sockid+0x27>
+
+00801e77 <sock_flags>:
+{
+  801e77:	55                   	push   %ebp
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801e7d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e80:	52                   	push   %edx
+  801e81:	50                   	push   %eax
+  801e82:	e8 db f5 ff ff       	call   801462 <fd_lookup>
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 0e                	js     801e9c <sock_flags+0x25>
+  801e8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e91:	8b 40 08             	mov    0x8(%eax),%eax
+  801e94:	c1 e8 09             	shr    $0x9,%eax
+  801e97:	83 e0 08             	and    $0x8,%eax
+}
+  801e9a:	c9                   	leave
+  801e9b:	c3                   	ret
+		return 0;
+  801e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea1:	eb f7                	jmp    801e9a <sock_flags+0x23>
+
+00801ea3 <alloc_sockfd>:
+{
+  801ea3:	55                   	push   %ebp
+  801ea4:	89 e5                	mov    %esp,%ebp
+  801ea6:	56                   	push   %esi
+  801ea7:	53                   	push   %ebx
+  801ea8:	83 ec 1c             	sub    $0x1c,%esp
+  801eab:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ead:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb0:	50                   	push   %eax
+  801eb1:	e8 5c f5 ff ff       	call   801412 <fd_alloc>
+  801eb6:	89 c3                	mov    %eax,%ebx
+  801eb8:	83 c4 10             	add    $0x10,%esp
+  801ebb:	85 c0                	test   %eax,%eax
+  801ebd:	78 43                	js     801f02 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ebf:	83 ec 04             	sub    $0x4,%esp
+  801ec2:	68 07 04 00 00       	push   $0x407
+  801ec7:	ff 75 f4             	push   -0xc(%ebp)
+  801eca:	6a 00                	push   $0x0
+  801ecc:	e8 b7 f0 ff ff       	call   800f88 <sys_page_alloc>
+  801ed1:	89 c3                	mov    %eax,%ebx
+  801ed3:	83 c4 10             	add    $0x10,%esp
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	78 28                	js     801f02 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801eda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801edd:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801ee3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ee5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ee8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801eef:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	50                   	push   %eax
+  801ef6:	e8 f0 f4 ff ff       	call   8013eb <fd2num>
+  801efb:	89 c3                	mov    %eax,%ebx
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	eb 0c                	jmp    801f0e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	56                   	push   %esi
+  801f06:	e8 4b 04 00 00       	call   802356 <nsipc_close>
+		return r;
+  801f0b:	83 c4 10             	add    $0x10,%esp
+}
+  801f0e:	89 d8                	mov    %ebx,%eax
+  801f10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f13:	5b                   	pop    %ebx
+  801f14:	5e                   	pop    %esi
+  801f15:	5d                   	pop    %ebp
+  801f16:	c3                   	ret
+
+00801f17 <accept>:
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	56                   	push   %esi
+  801f1b:	53                   	push   %ebx
+  801f1c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f1f:	89 f0                	mov    %esi,%eax
+  801f21:	e8 21 ff ff ff       	call   801e47 <fd2sockid>
+  801f26:	89 c3                	mov    %eax,%ebx
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	78 24                	js     801f50 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801f2c:	89 f0                	mov    %esi,%eax
+  801f2e:	e8 44 ff ff ff       	call   801e77 <sock_flags>
+  801f33:	50                   	push   %eax
+  801f34:	ff 75 10             	push   0x10(%ebp)
+  801f37:	ff 75 0c             	push   0xc(%ebp)
+  801f3a:	53                   	push   %ebx
+  801f3b:	e8 6b 03 00 00       	call   8022ab <nsipc_accept>
+  801f40:	89 c3                	mov    %eax,%ebx
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	85 c0                	test   %eax,%eax
+  801f47:	78 07                	js     801f50 <accept+0x39>
+	return alloc_sockfd(r);
+  801f49:	e8 55 ff ff ff       	call   801ea3 <alloc_sockfd>
+  801f4e:	89 c3                	mov    %eax,%ebx
+}
+  801f50:	89 d8                	mov    %ebx,%eax
+  801f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5d                   	pop    %ebp
+  801f58:	c3                   	ret
+
+00801f59 <bind>:
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f62:	e8 e0 fe ff ff       	call   801e47 <fd2sockid>
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 12                	js     801f7d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f6b:	83 ec 04             	sub    $0x4,%esp
+  801f6e:	ff 75 10             	push   0x10(%ebp)
+  801f71:	ff 75 0c             	push   0xc(%ebp)
+  801f74:	50                   	push   %eax
+  801f75:	e8 85 03 00 00       	call   8022ff <nsipc_bind>
+  801f7a:	83 c4 10             	add    $0x10,%esp
+}
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+
+00801f7f <shutdown>:
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	e8 ba fe ff ff       	call   801e47 <fd2sockid>
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	78 0f                	js     801fa0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f91:	83 ec 08             	sub    $0x8,%esp
+  801f94:	ff 75 0c             	push   0xc(%ebp)
+  801f97:	50                   	push   %eax
+  801f98:	e8 97 03 00 00       	call   802334 <nsipc_shutdown>
+  801f9d:	83 c4 10             	add    $0x10,%esp
+}
+  801fa0:	c9                   	leave
+  801fa1:	c3                   	ret
+
+00801fa2 <connect>:
+{
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fab:	e8 97 fe ff ff       	call   801e47 <fd2sockid>
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	78 12                	js     801fc6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801fb4:	83 ec 04             	sub    $0x4,%esp
+  801fb7:	ff 75 10             	push   0x10(%ebp)
+  801fba:	ff 75 0c             	push   0xc(%ebp)
+  801fbd:	50                   	push   %eax
+  801fbe:	e8 ad 03 00 00       	call   802370 <nsipc_connect>
+  801fc3:	83 c4 10             	add    $0x10,%esp
+}
+  801fc6:	c9                   	leave
+  801fc7:	c3                   	ret
+
+00801fc8 <listen>:
+{
+  801fc8:	55                   	push   %ebp
+  801fc9:	89 e5                	mov    %esp,%ebp
+  801fcb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd1:	e8 71 fe ff ff       	call   801e47 <fd2sockid>
+  801fd6:	85 c0                	test   %eax,%eax
+  801fd8:	78 0f                	js     801fe9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801fda:	83 ec 08             	sub    $0x8,%esp
+  801fdd:	ff 75 0c             	push   0xc(%ebp)
+  801fe0:	50                   	push   %eax
+  801fe1:	e8 bf 03 00 00       	call   8023a5 <nsipc_listen>
+  801fe6:	83 c4 10             	add    $0x10,%esp
+}
+  801fe9:	c9                   	leave
+  801fea:	c3                   	ret
+
+00801feb <sendmsg>:
+{
+  801feb:	55                   	push   %ebp
+  801fec:	89 e5                	mov    %esp,%ebp
+  801fee:	57                   	push   %edi
+  801fef:	56                   	push   %esi
+  801ff0:	53                   	push   %ebx
+  801ff1:	83 ec 0c             	sub    $0xc,%esp
+  801ff4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ff7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801ffa:	89 f0                	mov    %esi,%eax
+  801ffc:	e8 46 fe ff ff       	call   801e47 <fd2sockid>
+  802001:	89 c3                	mov    %eax,%ebx
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 1c                	js     802023 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802007:	89 f0                	mov    %esi,%eax
+  802009:	e8 69 fe ff ff       	call   801e77 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80200e:	0b 45 10             	or     0x10(%ebp),%eax
+  802011:	50                   	push   %eax
+  802012:	ff 77 0c             	push   0xc(%edi)
+  802015:	ff 77 08             	push   0x8(%edi)
+  802018:	53                   	push   %ebx
+  802019:	e8 7c 04 00 00       	call   80249a <nsipc_sendmsg>
+  80201e:	89 c3                	mov    %eax,%ebx
+  802020:	83 c4 10             	add    $0x10,%esp
+}
+  802023:	89 d8                	mov    %ebx,%eax
+  802025:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802028:	5b                   	pop    %ebx
+  802029:	5e                   	pop    %esi
+  80202a:	5f                   	pop    %edi
+  80202b:	5d                   	pop    %ebp
+  80202c:	c3                   	ret
+
+0080202d <recvmsg>:
+{
+  80202d:	55                   	push   %ebp
+  80202e:	89 e5                	mov    %esp,%ebp
+  802030:	57                   	push   %edi
+  802031:	56                   	push   %esi
+  802032:	53                   	push   %ebx
+  802033:	83 ec 0c             	sub    $0xc,%esp
+  802036:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802039:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80203c:	89 f8                	mov    %edi,%eax
+  80203e:	e8 04 fe ff ff       	call   801e47 <fd2sockid>
+  802043:	89 c3                	mov    %eax,%ebx
+  802045:	85 c0                	test   %eax,%eax
+  802047:	78 2a                	js     802073 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802049:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802050:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802057:	89 f8                	mov    %edi,%eax
+  802059:	e8 19 fe ff ff       	call   801e77 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80205e:	0b 45 10             	or     0x10(%ebp),%eax
+  802061:	50                   	push   %eax
+  802062:	ff 76 0c             	push   0xc(%esi)
+  802065:	ff 76 08             	push   0x8(%esi)
+  802068:	53                   	push   %ebx
+  802069:	e8 d6 07 00 00       	call   802844 <nsipc_recvmsg>
+  80206e:	89 c3                	mov    %eax,%ebx
+  802070:	83 c4 10             	add    $0x10,%esp
+}
+  802073:	89 d8                	mov    %ebx,%eax
+  802075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802078:	5b                   	pop    %ebx
+  802079:	5e                   	pop    %esi
+  80207a:	5f                   	pop    %edi
+  80207b:	5d                   	pop    %ebp
+  80207c:	c3                   	ret
+
+0080207d <sendfile>:
+{
+  80207d:	55                   	push   %ebp
+  80207e:	89 e5                	mov    %esp,%ebp
+  802080:	56                   	push   %esi
+  802081:	53                   	push   %ebx
+  802082:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802085:	89 f0                	mov    %esi,%eax
+  802087:	e8 bb fd ff ff       	call   801e47 <fd2sockid>
+  80208c:	89 c3                	mov    %eax,%ebx
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	78 1f                	js     8020b1 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802092:	89 f0                	mov    %esi,%eax
+  802094:	e8 de fd ff ff       	call   801e77 <sock_flags>
+  802099:	83 ec 0c             	sub    $0xc,%esp
+  80209c:	50                   	push   %eax
+  80209d:	ff 75 14             	push   0x14(%ebp)
+  8020a0:	ff 75 10             	push   0x10(%ebp)
+  8020a3:	ff 75 0c             	push   0xc(%ebp)
+  8020a6:	53                   	push   %ebx
+  8020a7:	e8 64 06 00 00       	call   802710 <nsipc_sendfile>
+  8020ac:	89 c3                	mov    %eax,%ebx
+  8020ae:	83 c4 20             	add    $0x20,%esp
+}
+  8020b1:	89 d8                	mov    %ebx,%eax
+  8020b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b6:	5b                   	pop    %ebx
+  8020b7:	5e                   	pop    %esi
+  8020b8:	5d                   	pop    %ebp
+  8020b9:	c3                   	ret
+
+008020ba <evctl>:
+{
+  8020ba:	55                   	push   %ebp
+  8020bb:	89 e5                	mov    %esp,%ebp
+  8020bd:	53                   	push   %ebx
+  8020be:	83 ec 04             	sub    $0x4,%esp
+  8020c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8020c4:	89 d8                	mov    %ebx,%eax
+  8020c6:	e8 7c fd ff ff       	call   801e47 <fd2sockid>
+  8020cb:	85 c0                	test   %eax,%eax
+  8020cd:	78 10                	js     8020df <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8020cf:	83 ec 04             	sub    $0x4,%esp
+  8020d2:	53                   	push   %ebx
+  8020d3:	ff 75 0c             	push   0xc(%ebp)
+  8020d6:	50                   	push   %eax
+  8020d7:	e8 d2 0b 00 00       	call   802cae <nsipc_evctl>
+  8020dc:	83 c4 10             	add    $0x10,%esp
+}
+  8020df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e2:	c9                   	leave
+  8020e3:	c3                   	ret
+
+008020e4 <evwait>:
+{
+  8020e4:	55                   	push   %ebp
+  8020e5:	89 e5                	mov    %esp,%ebp
+  8020e7:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8020ea:	ff 75 10             	push   0x10(%ebp)
+  8020ed:	ff 75 0c             	push   0xc(%ebp)
+  8020f0:	ff 75 08             	push   0x8(%ebp)
+  8020f3:	e8 e0 0b 00 00       	call   802cd8 <nsipc_evwait>
+}
+  8020f8:	c9                   	leave
+  8020f9:	c3                   	ret
+
+008020fa <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8020fa:	55                   	push   %ebp
+  8020fb:	89 e5                	mov    %esp,%ebp
+  8020fd:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802100:	ff 75 10             	push   0x10(%ebp)
+  802103:	ff 75 0c             	push   0xc(%ebp)
+  802106:	ff 75 08             	push   0x8(%ebp)
+  802109:	e8 31 0c 00 00       	call   802d3f <nsipc_socket>
+  80210e:	83 c4 10             	add    $0x10,%esp
+  802111:	85 c0                	test   %eax,%eax
+  802113:	78 05                	js     80211a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802115:	e8 89 fd ff ff       	call   801ea3 <alloc_sockfd>
+}
+  80211a:	c9                   	leave
+  80211b:	c3                   	ret
+
+0080211c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	53                   	push   %ebx
+  802120:	83 ec 04             	sub    $0x4,%esp
+  802123:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802125:	83 3d 24 63 81 00 00 	cmpl   $0x0,0x816324
+  80212c:	74 26                	je     802154 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80212e:	6a 07                	push   $0x7
+  802130:	68 00 80 81 00       	push   $0x818000
+  802135:	53                   	push   %ebx
+  802136:	ff 35 24 63 81 00    	push   0x816324
+  80213c:	e8 58 19 00 00       	call   803a99 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802141:	83 c4 0c             	add    $0xc,%esp
+  802144:	6a 00                	push   $0x0
+  802146:	6a 00                	push   $0x0
+  802148:	6a 00                	push   $0x0
+  80214a:	e8 ba 16 00 00       	call   803809 <ipc_recv>
+}
+  80214f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802152:	c9                   	leave
+  802153:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802154:	83 ec 0c             	sub    $0xc,%esp
+  802157:	6a 03                	push   $0x3
+  802159:	e8 a4 19 00 00       	call   803b02 <ipc_find_env>
+  80215e:	a3 24 63 81 00       	mov    %eax,0x816324
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	eb c6                	jmp    80212e <nsipc+0x12>
+
+00802168 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802168:	55                   	push   %ebp
+  802169:	89 e5                	mov    %esp,%ebp
+  80216b:	56                   	push   %esi
+  80216c:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80216d:	8b 35 30 63 81 00    	mov    0x816330,%esi
+		return 0;
+  802173:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802178:	85 f6                	test   %esi,%esi
+  80217a:	75 33                	jne    8021af <nsbulk_map+0x47>
+  80217c:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802181:	83 ec 04             	sub    $0x4,%esp
+  802184:	6a 07                	push   $0x7
+  802186:	53                   	push   %ebx
+  802187:	6a 00                	push   $0x0
+  802189:	e8 fa ed ff ff       	call   800f88 <sys_page_alloc>
+  80218e:	83 c4 10             	add    $0x10,%esp
+  802191:	85 c0                	test   %eax,%eax
+  802193:	78 1a                	js     8021af <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802195:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80219b:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8021a1:	75 de                	jne    802181 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8021a3:	c7 05 30 63 81 00 01 	movl   $0x1,0x816330
+  8021aa:	00 00 00 
+	return 0;
+  8021ad:	89 f0                	mov    %esi,%eax
+}
+  8021af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b2:	5b                   	pop    %ebx
+  8021b3:	5e                   	pop    %esi
+  8021b4:	5d                   	pop    %ebp
+  8021b5:	c3                   	ret
+
+008021b6 <nsbulk_own>:
+{
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	57                   	push   %edi
+  8021ba:	56                   	push   %esi
+  8021bb:	53                   	push   %ebx
+  8021bc:	83 ec 0c             	sub    $0xc,%esp
+  8021bf:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8021c1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8021c4:	85 d2                	test   %edx,%edx
+  8021c6:	7f 0e                	jg     8021d6 <nsbulk_own+0x20>
+	return 0;
+  8021c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021cd:	eb 47                	jmp    802216 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8021cf:	83 c3 01             	add    $0x1,%ebx
+  8021d2:	39 fb                	cmp    %edi,%ebx
+  8021d4:	7d 3b                	jge    802211 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8021d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8021db:	89 d9                	mov    %ebx,%ecx
+  8021dd:	d3 e6                	shl    %cl,%esi
+  8021df:	89 f0                	mov    %esi,%eax
+  8021e1:	23 05 2c 63 81 00    	and    0x81632c,%eax
+  8021e7:	74 e6                	je     8021cf <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8021e9:	83 ec 04             	sub    $0x4,%esp
+  8021ec:	6a 07                	push   $0x7
+  8021ee:	89 d8                	mov    %ebx,%eax
+  8021f0:	c1 e0 0c             	shl    $0xc,%eax
+  8021f3:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8021f8:	50                   	push   %eax
+  8021f9:	6a 00                	push   $0x0
+  8021fb:	e8 88 ed ff ff       	call   800f88 <sys_page_alloc>
+  802200:	83 c4 10             	add    $0x10,%esp
+  802203:	85 c0                	test   %eax,%eax
+  802205:	78 0f                	js     802216 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802207:	f7 d6                	not    %esi
+  802209:	21 35 2c 63 81 00    	and    %esi,0x81632c
+  80220f:	eb be                	jmp    8021cf <nsbulk_own+0x19>
+	return 0;
+  802211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802219:	5b                   	pop    %ebx
+  80221a:	5e                   	pop    %esi
+  80221b:	5f                   	pop    %edi
+  80221c:	5d                   	pop    %ebp
+  80221d:	c3                   	ret
+
+0080221e <nsipc_bulk>:
+{
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	57                   	push   %edi
+  802222:	56                   	push   %esi
+  802223:	53                   	push   %ebx
+  802224:	83 ec 1c             	sub    $0x1c,%esp
+  802227:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80222a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80222c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802232:	c1 fb 0c             	sar    $0xc,%ebx
+  802235:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802238:	83 3d 24 63 81 00 00 	cmpl   $0x0,0x816324
+  80223f:	74 56                	je     802297 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802241:	85 ff                	test   %edi,%edi
+  802243:	7e 24                	jle    802269 <nsipc_bulk+0x4b>
+  802245:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80224b:	74 1c                	je     802269 <nsipc_bulk+0x4b>
+  80224d:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802253:	c1 e3 0c             	shl    $0xc,%ebx
+  802256:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80225b:	0f b6 10             	movzbl (%eax),%edx
+  80225e:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802260:	05 00 10 00 00       	add    $0x1000,%eax
+  802265:	39 d8                	cmp    %ebx,%eax
+  802267:	75 f2                	jne    80225b <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802269:	83 ec 0c             	sub    $0xc,%esp
+  80226c:	56                   	push   %esi
+  80226d:	57                   	push   %edi
+  80226e:	68 00 00 00 e0       	push   $0xe0000000
+  802273:	ff 75 e4             	push   -0x1c(%ebp)
+  802276:	ff 35 24 63 81 00    	push   0x816324
+  80227c:	e8 4c 18 00 00       	call   803acd <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802281:	83 c4 1c             	add    $0x1c,%esp
+  802284:	6a 00                	push   $0x0
+  802286:	6a 00                	push   $0x0
+  802288:	6a 00                	push   $0x0
+  80228a:	e8 7a 15 00 00       	call   803809 <ipc_recv>
+}
+  80228f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802292:	5b                   	pop    %ebx
+  802293:	5e                   	pop    %esi
+  802294:	5f                   	pop    %edi
+  802295:	5d                   	pop    %ebp
+  802296:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802297:	83 ec 0c             	sub    $0xc,%esp
+  80229a:	6a 03                	push   $0x3
+  80229c:	e8 61 18 00 00       	call   803b02 <ipc_find_env>
+  8022a1:	a3 24 63 81 00       	mov    %eax,0x816324
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	eb 96                	jmp    802241 <nsipc_bulk+0x23>
+
+008022ab <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8022ab:	55                   	push   %ebp
+  8022ac:	89 e5                	mov    %esp,%ebp
+  8022ae:	53                   	push   %ebx
+  8022af:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8022b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b5:	a3 00 80 81 00       	mov    %eax,0x818000
+	nsipcbuf.accept.req_flags = flags;
+  8022ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022bd:	a3 04 80 81 00       	mov    %eax,0x818004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8022c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c7:	e8 50 fe ff ff       	call   80211c <nsipc>
+  8022cc:	89 c3                	mov    %eax,%ebx
+  8022ce:	85 c0                	test   %eax,%eax
+  8022d0:	79 07                	jns    8022d9 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022d2:	89 d8                	mov    %ebx,%eax
+  8022d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d7:	c9                   	leave
+  8022d8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022d9:	83 ec 04             	sub    $0x4,%esp
+  8022dc:	ff 35 10 80 81 00    	push   0x818010
+  8022e2:	68 00 80 81 00       	push   $0x818000
+  8022e7:	ff 75 0c             	push   0xc(%ebp)
+  8022ea:	e8 15 ea ff ff       	call   800d04 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022ef:	8b 15 10 80 81 00    	mov    0x818010,%edx
+  8022f5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022f8:	89 10                	mov    %edx,(%eax)
+  8022fa:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022fd:	eb d3                	jmp    8022d2 <nsipc_accept+0x27>
+
+008022ff <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022ff:	55                   	push   %ebp
+  802300:	89 e5                	mov    %esp,%ebp
+  802302:	53                   	push   %ebx
+  802303:	83 ec 08             	sub    $0x8,%esp
+  802306:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802309:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230c:	a3 00 80 81 00       	mov    %eax,0x818000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802311:	53                   	push   %ebx
+  802312:	ff 75 0c             	push   0xc(%ebp)
+  802315:	68 04 80 81 00       	push   $0x818004
+  80231a:	e8 e5 e9 ff ff       	call   800d04 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80231f:	89 1d 14 80 81 00    	mov    %ebx,0x818014
+	return nsipc(NSREQ_BIND);
+  802325:	b8 02 00 00 00       	mov    $0x2,%eax
+  80232a:	e8 ed fd ff ff       	call   80211c <nsipc>
+}
+  80232f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802332:	c9                   	leave
+  802333:	c3                   	ret
+
+00802334 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80233a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233d:	a3 00 80 81 00       	mov    %eax,0x818000
+	nsipcbuf.shutdown.req_how = how;
+  802342:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802345:	a3 04 80 81 00       	mov    %eax,0x818004
+	return nsipc(NSREQ_SHUTDOWN);
+  80234a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80234f:	e8 c8 fd ff ff       	call   80211c <nsipc>
+}
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+00802356 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80235c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235f:	a3 00 80 81 00       	mov    %eax,0x818000
+	return nsipc(NSREQ_CLOSE);
+  802364:	b8 04 00 00 00       	mov    $0x4,%eax
+  802369:	e8 ae fd ff ff       	call   80211c <nsipc>
+}
+  80236e:	c9                   	leave
+  80236f:	c3                   	ret
+
+00802370 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	53                   	push   %ebx
+  802374:	83 ec 08             	sub    $0x8,%esp
+  802377:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80237a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237d:	a3 00 80 81 00       	mov    %eax,0x818000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802382:	53                   	push   %ebx
+  802383:	ff 75 0c             	push   0xc(%ebp)
+  802386:	68 04 80 81 00       	push   $0x818004
+  80238b:	e8 74 e9 ff ff       	call   800d04 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802390:	89 1d 14 80 81 00    	mov    %ebx,0x818014
+	return nsipc(NSREQ_CONNECT);
+  802396:	b8 05 00 00 00       	mov    $0x5,%eax
+  80239b:	e8 7c fd ff ff       	call   80211c <nsipc>
+}
+  8023a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a3:	c9                   	leave
+  8023a4:	c3                   	ret
+
+008023a5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8023a5:	55                   	push   %ebp
+  8023a6:	89 e5                	mov    %esp,%ebp
+  8023a8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8023ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ae:	a3 00 80 81 00       	mov    %eax,0x818000
+	nsipcbuf.listen.req_backlog = backlog;
+  8023b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023b6:	a3 04 80 81 00       	mov    %eax,0x818004
+	return nsipc(NSREQ_LISTEN);
+  8023bb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023c0:	e8 57 fd ff ff       	call   80211c <nsipc>
+}
+  8023c5:	c9                   	leave
+  8023c6:	c3                   	ret
+
+008023c7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8023c7:	55                   	push   %ebp
+  8023c8:	89 e5                	mov    %esp,%ebp
+  8023ca:	56                   	push   %esi
+  8023cb:	53                   	push   %ebx
+  8023cc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8023cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d2:	a3 00 80 81 00       	mov    %eax,0x818000
+	nsipcbuf.recv.req_len = len;
+  8023d7:	89 35 04 80 81 00    	mov    %esi,0x818004
+	nsipcbuf.recv.req_flags = flags;
+  8023dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023e0:	a3 08 80 81 00       	mov    %eax,0x818008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023e5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023ea:	e8 2d fd ff ff       	call   80211c <nsipc>
+  8023ef:	89 c3                	mov    %eax,%ebx
+  8023f1:	85 c0                	test   %eax,%eax
+  8023f3:	78 22                	js     802417 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023f5:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023fa:	39 c6                	cmp    %eax,%esi
+  8023fc:	0f 4e c6             	cmovle %esi,%eax
+  8023ff:	39 c3                	cmp    %eax,%ebx
+  802401:	7f 1d                	jg     802420 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802403:	83 ec 04             	sub    $0x4,%esp
+  802406:	53                   	push   %ebx
+  802407:	68 00 80 81 00       	push   $0x818000
+  80240c:	ff 75 0c             	push   0xc(%ebp)
+  80240f:	e8 f0 e8 ff ff       	call   800d04 <memmove>
+  802414:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802417:	89 d8                	mov    %ebx,%eax
+  802419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80241c:	5b                   	pop    %ebx
+  80241d:	5e                   	pop    %esi
+  80241e:	5d                   	pop    %ebp
+  80241f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802420:	68 94 45 80 00       	push   $0x804594
+  802425:	68 a9 45 80 00       	push   $0x8045a9
+  80242a:	68 b2 00 00 00       	push   $0xb2
+  80242f:	68 be 45 80 00       	push   $0x8045be
+  802434:	e8 8a 13 00 00       	call   8037c3 <_panic>
+
+00802439 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	53                   	push   %ebx
+  80243d:	83 ec 04             	sub    $0x4,%esp
+  802440:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802443:	8b 45 08             	mov    0x8(%ebp),%eax
+  802446:	a3 00 80 81 00       	mov    %eax,0x818000
+	assert(size < 1600);
+  80244b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802451:	7f 2e                	jg     802481 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802453:	83 ec 04             	sub    $0x4,%esp
+  802456:	53                   	push   %ebx
+  802457:	ff 75 0c             	push   0xc(%ebp)
+  80245a:	68 0c 80 81 00       	push   $0x81800c
+  80245f:	e8 a0 e8 ff ff       	call   800d04 <memmove>
+	nsipcbuf.send.req_size = size;
+  802464:	89 1d 04 80 81 00    	mov    %ebx,0x818004
+	nsipcbuf.send.req_flags = flags;
+  80246a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80246d:	a3 08 80 81 00       	mov    %eax,0x818008
+	return nsipc(NSREQ_SEND);
+  802472:	b8 08 00 00 00       	mov    $0x8,%eax
+  802477:	e8 a0 fc ff ff       	call   80211c <nsipc>
+}
+  80247c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80247f:	c9                   	leave
+  802480:	c3                   	ret
+	assert(size < 1600);
+  802481:	68 ca 45 80 00       	push   $0x8045ca
+  802486:	68 a9 45 80 00       	push   $0x8045a9
+  80248b:	68 bd 00 00 00       	push   $0xbd
+  802490:	68 be 45 80 00       	push   $0x8045be
+  802495:	e8 29 13 00 00       	call   8037c3 <_panic>
+
+0080249a <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80249a:	55                   	push   %ebp
+  80249b:	89 e5                	mov    %esp,%ebp
+  80249d:	57                   	push   %edi
+  80249e:	56                   	push   %esi
+  80249f:	53                   	push   %ebx
+  8024a0:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8024a3:	e8 c0 fc ff ff       	call   802168 <nsbulk_map>
+  8024a8:	85 c0                	test   %eax,%eax
+  8024aa:	78 55                	js     802501 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8024ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8024b3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8024ba:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024c1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024c4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024c7:	0f 8d 24 02 00 00    	jge    8026f1 <nsipc_sendmsg+0x257>
+  8024cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024d0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024d3:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8024d6:	89 d8                	mov    %ebx,%eax
+  8024d8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024dd:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8024df:	83 ec 0c             	sub    $0xc,%esp
+  8024e2:	68 20 60 81 00       	push   $0x816020
+  8024e7:	e8 5a 0f 00 00       	call   803446 <pgbatch_init>
+  8024ec:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024ef:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8024f1:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8024f4:	e9 82 00 00 00       	jmp    80257b <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8024f9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024fc:	85 db                	test   %ebx,%ebx
+  8024fe:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802501:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802504:	5b                   	pop    %ebx
+  802505:	5e                   	pop    %esi
+  802506:	5f                   	pop    %edi
+  802507:	5d                   	pop    %ebp
+  802508:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802509:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80250e:	29 c8                	sub    %ecx,%eax
+  802510:	39 d0                	cmp    %edx,%eax
+  802512:	0f 46 d0             	cmovbe %eax,%edx
+  802515:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802517:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80251d:	85 ff                	test   %edi,%edi
+  80251f:	0f 49 c7             	cmovns %edi,%eax
+  802522:	c1 f8 0c             	sar    $0xc,%eax
+  802525:	ba 01 00 00 00       	mov    $0x1,%edx
+  80252a:	e8 87 fc ff ff       	call   8021b6 <nsbulk_own>
+  80252f:	85 c0                	test   %eax,%eax
+  802531:	0f 88 17 01 00 00    	js     80264e <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802537:	83 ec 04             	sub    $0x4,%esp
+  80253a:	56                   	push   %esi
+  80253b:	ff 75 e0             	push   -0x20(%ebp)
+  80253e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802541:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802546:	50                   	push   %eax
+  802547:	e8 b8 e7 ff ff       	call   800d04 <memmove>
+  80254c:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80254f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802552:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802555:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802558:	0f 84 fd 00 00 00    	je     80265b <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80255e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802561:	01 f7                	add    %esi,%edi
+  802563:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802566:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802569:	0f 8d 01 01 00 00    	jge    802670 <nsipc_sendmsg+0x1d6>
+  80256f:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802575:	0f 8f f0 00 00 00    	jg     80266b <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80257b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80257e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802581:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802584:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802587:	89 c2                	mov    %eax,%edx
+  802589:	03 13                	add    (%ebx),%edx
+  80258b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80258e:	8b 73 04             	mov    0x4(%ebx),%esi
+  802591:	29 c6                	sub    %eax,%esi
+  802593:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802598:	29 f9                	sub    %edi,%ecx
+  80259a:	39 ce                	cmp    %ecx,%esi
+  80259c:	89 ca                	mov    %ecx,%edx
+  80259e:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8025a1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8025a4:	89 f9                	mov    %edi,%ecx
+  8025a6:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8025ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025af:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8025b4:	09 c8                	or     %ecx,%eax
+  8025b6:	0f 85 4d ff ff ff    	jne    802509 <nsipc_sendmsg+0x6f>
+  8025bc:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8025c2:	0f 86 41 ff ff ff    	jbe    802509 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025c8:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8025ce:	85 ff                	test   %edi,%edi
+  8025d0:	0f 49 c7             	cmovns %edi,%eax
+  8025d3:	c1 f8 0c             	sar    $0xc,%eax
+  8025d6:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8025d8:	89 d1                	mov    %edx,%ecx
+  8025da:	c1 e9 0c             	shr    $0xc,%ecx
+  8025dd:	01 c8                	add    %ecx,%eax
+  8025df:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025e2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025e5:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8025e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025ea:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8025ef:	29 c8                	sub    %ecx,%eax
+  8025f1:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8025f4:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8025f7:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025fe:	89 f9                	mov    %edi,%ecx
+  802600:	d3 e0                	shl    %cl,%eax
+  802602:	09 05 2c 63 81 00    	or     %eax,0x81632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802608:	83 ec 08             	sub    $0x8,%esp
+  80260b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80260d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802610:	50                   	push   %eax
+  802611:	6a 00                	push   $0x0
+  802613:	56                   	push   %esi
+  802614:	6a 00                	push   $0x0
+  802616:	68 20 60 81 00       	push   $0x816020
+  80261b:	e8 e4 0e 00 00       	call   803504 <pgbatch_map>
+  802620:	83 c4 20             	add    $0x20,%esp
+  802623:	85 c0                	test   %eax,%eax
+  802625:	0f 88 ce fe ff ff    	js     8024f9 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80262b:	83 c7 01             	add    $0x1,%edi
+  80262e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802634:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802637:	39 c7                	cmp    %eax,%edi
+  802639:	75 be                	jne    8025f9 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80263b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80263e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802641:	89 d6                	mov    %edx,%esi
+  802643:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802649:	e9 01 ff ff ff       	jmp    80254f <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80264e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802651:	85 db                	test   %ebx,%ebx
+  802653:	0f 45 c3             	cmovne %ebx,%eax
+  802656:	e9 a6 fe ff ff       	jmp    802501 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80265b:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80265f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802666:	e9 f3 fe ff ff       	jmp    80255e <nsipc_sendmsg+0xc4>
+  80266b:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80266e:	eb 03                	jmp    802673 <nsipc_sendmsg+0x1d9>
+  802670:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802673:	83 ec 0c             	sub    $0xc,%esp
+  802676:	68 20 60 81 00       	push   $0x816020
+  80267b:	e8 d4 0d 00 00       	call   803454 <pgbatch_flush>
+  802680:	83 c4 10             	add    $0x10,%esp
+  802683:	85 c0                	test   %eax,%eax
+  802685:	78 50                	js     8026d7 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802687:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268a:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80268f:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802695:	89 fb                	mov    %edi,%ebx
+  802697:	29 f3                	sub    %esi,%ebx
+  802699:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80269f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a2:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8026a7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8026ac:	89 fa                	mov    %edi,%edx
+  8026ae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8026b3:	e8 66 fb ff ff       	call   80221e <nsipc_bulk>
+  8026b8:	85 c0                	test   %eax,%eax
+  8026ba:	78 28                	js     8026e4 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8026bc:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8026bf:	39 c3                	cmp    %eax,%ebx
+  8026c1:	75 0c                	jne    8026cf <nsipc_sendmsg+0x235>
+  8026c3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026c6:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8026c9:	0f 8f f2 fd ff ff    	jg     8024c1 <nsipc_sendmsg+0x27>
+		sent += r;
+  8026cf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8026d2:	e9 2a fe ff ff       	jmp    802501 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8026d7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026da:	85 db                	test   %ebx,%ebx
+  8026dc:	0f 45 c3             	cmovne %ebx,%eax
+  8026df:	e9 1d fe ff ff       	jmp    802501 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8026e4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026e7:	85 db                	test   %ebx,%ebx
+  8026e9:	0f 45 c3             	cmovne %ebx,%eax
+  8026ec:	e9 10 fe ff ff       	jmp    802501 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8026f1:	83 ec 0c             	sub    $0xc,%esp
+  8026f4:	68 20 60 81 00       	push   $0x816020
+  8026f9:	e8 48 0d 00 00       	call   803446 <pgbatch_init>
+  8026fe:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802701:	be 00 00 00 00       	mov    $0x0,%esi
+  802706:	bf 00 00 00 00       	mov    $0x0,%edi
+  80270b:	e9 63 ff ff ff       	jmp    802673 <nsipc_sendmsg+0x1d9>
+
+00802710 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	57                   	push   %edi
+  802714:	56                   	push   %esi
+  802715:	53                   	push   %ebx
+  802716:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802719:	83 3d 28 63 81 00 00 	cmpl   $0x0,0x816328
+  802720:	0f 84 c8 00 00 00    	je     8027ee <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802726:	83 3d 24 63 81 00 00 	cmpl   $0x0,0x816324
+  80272d:	0f 84 e4 00 00 00    	je     802817 <nsipc_sendfile+0x107>
+{
+  802733:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802738:	89 fb                	mov    %edi,%ebx
+  80273a:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80273d:	0f 83 f0 00 00 00    	jae    802833 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802743:	89 fa                	mov    %edi,%edx
+  802745:	03 55 10             	add    0x10(%ebp),%edx
+  802748:	89 d0                	mov    %edx,%eax
+  80274a:	c1 f8 1f             	sar    $0x1f,%eax
+  80274d:	c1 e8 14             	shr    $0x14,%eax
+  802750:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802753:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802759:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80275b:	6a 10                	push   $0x10
+  80275d:	68 00 20 01 e0       	push   $0xe0012000
+  802762:	52                   	push   %edx
+  802763:	ff 75 0c             	push   0xc(%ebp)
+  802766:	e8 fe f4 ff ff       	call   801c69 <fmap>
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	0f 8e b8 00 00 00    	jle    80282e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802776:	39 c6                	cmp    %eax,%esi
+  802778:	0f 8d b5 00 00 00    	jge    802833 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80277e:	29 f0                	sub    %esi,%eax
+  802780:	8b 55 14             	mov    0x14(%ebp),%edx
+  802783:	29 da                	sub    %ebx,%edx
+  802785:	39 d0                	cmp    %edx,%eax
+  802787:	89 d3                	mov    %edx,%ebx
+  802789:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80278c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278f:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802794:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80279a:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8027a0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8027a3:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8027a8:	83 ec 0c             	sub    $0xc,%esp
+  8027ab:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8027ad:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8027b4:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8027b7:	83 c0 01             	add    $0x1,%eax
+  8027ba:	50                   	push   %eax
+  8027bb:	68 00 10 01 e0       	push   $0xe0011000
+  8027c0:	6a 11                	push   $0x11
+  8027c2:	ff 35 24 63 81 00    	push   0x816324
+  8027c8:	e8 00 13 00 00       	call   803acd <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8027cd:	83 c4 1c             	add    $0x1c,%esp
+  8027d0:	6a 00                	push   $0x0
+  8027d2:	6a 00                	push   $0x0
+  8027d4:	6a 00                	push   $0x0
+  8027d6:	e8 2e 10 00 00       	call   803809 <ipc_recv>
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	78 5b                	js     80283d <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8027e2:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8027e4:	39 c3                	cmp    %eax,%ebx
+  8027e6:	0f 8e 4c ff ff ff    	jle    802738 <nsipc_sendfile+0x28>
+  8027ec:	eb 45                	jmp    802833 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8027ee:	83 ec 04             	sub    $0x4,%esp
+  8027f1:	6a 07                	push   $0x7
+  8027f3:	68 00 10 01 e0       	push   $0xe0011000
+  8027f8:	6a 00                	push   $0x0
+  8027fa:	e8 89 e7 ff ff       	call   800f88 <sys_page_alloc>
+  8027ff:	89 c7                	mov    %eax,%edi
+  802801:	83 c4 10             	add    $0x10,%esp
+  802804:	85 c0                	test   %eax,%eax
+  802806:	78 2b                	js     802833 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802808:	c7 05 28 63 81 00 01 	movl   $0x1,0x816328
+  80280f:	00 00 00 
+  802812:	e9 0f ff ff ff       	jmp    802726 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802817:	83 ec 0c             	sub    $0xc,%esp
+  80281a:	6a 03                	push   $0x3
+  80281c:	e8 e1 12 00 00       	call   803b02 <ipc_find_env>
+  802821:	a3 24 63 81 00       	mov    %eax,0x816324
+  802826:	83 c4 10             	add    $0x10,%esp
+  802829:	e9 05 ff ff ff       	jmp    802733 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80282e:	85 ff                	test   %edi,%edi
+  802830:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802833:	89 f8                	mov    %edi,%eax
+  802835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802838:	5b                   	pop    %ebx
+  802839:	5e                   	pop    %esi
+  80283a:	5f                   	pop    %edi
+  80283b:	5d                   	pop    %ebp
+  80283c:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80283d:	85 ff                	test   %edi,%edi
+  80283f:	0f 44 f8             	cmove  %eax,%edi
+  802842:	eb ef                	jmp    802833 <nsipc_sendfile+0x123>
+
+00802844 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802844:	55                   	push   %ebp
+  802845:	89 e5                	mov    %esp,%ebp
+  802847:	57                   	push   %edi
+  802848:	56                   	push   %esi
+  802849:	53                   	push   %ebx
+  80284a:	83 ec 1c             	sub    $0x1c,%esp
+  80284d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802850:	e8 13 f9 ff ff       	call   802168 <nsbulk_map>
+  802855:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802858:	85 c0                	test   %eax,%eax
+  80285a:	0f 88 ba 00 00 00    	js     80291a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802860:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802864:	0f 8e bb 00 00 00    	jle    802925 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80286a:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80286f:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802874:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802879:	89 f8                	mov    %edi,%eax
+  80287b:	29 f0                	sub    %esi,%eax
+  80287d:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802881:	39 c8                	cmp    %ecx,%eax
+  802883:	0f 47 c1             	cmova  %ecx,%eax
+  802886:	01 f0                	add    %esi,%eax
+  802888:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80288a:	83 c2 01             	add    $0x1,%edx
+  80288d:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802890:	7e 07                	jle    802899 <nsipc_recvmsg+0x55>
+  802892:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802897:	7e e0                	jle    802879 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802899:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80289f:	c1 fa 0c             	sar    $0xc,%edx
+  8028a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a7:	e8 0a f9 ff ff       	call   8021b6 <nsbulk_own>
+  8028ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028af:	85 c0                	test   %eax,%eax
+  8028b1:	78 67                	js     80291a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8028b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8028bb:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8028c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028c4:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8028c9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8028ce:	89 f2                	mov    %esi,%edx
+  8028d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8028d5:	e8 44 f9 ff ff       	call   80221e <nsipc_bulk>
+  8028da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	78 39                	js     80291a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8028e1:	39 f0                	cmp    %esi,%eax
+  8028e3:	7f 4a                	jg     80292f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8028e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ea:	85 c0                	test   %eax,%eax
+  8028ec:	7e 2c                	jle    80291a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8028ee:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8028f1:	29 fe                	sub    %edi,%esi
+  8028f3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028f6:	39 c6                	cmp    %eax,%esi
+  8028f8:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8028fb:	83 ec 04             	sub    $0x4,%esp
+  8028fe:	56                   	push   %esi
+  8028ff:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802905:	50                   	push   %eax
+  802906:	ff 33                	push   (%ebx)
+  802908:	e8 f7 e3 ff ff       	call   800d04 <memmove>
+		n += m;
+  80290d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80290f:	83 c3 08             	add    $0x8,%ebx
+  802912:	83 c4 10             	add    $0x10,%esp
+  802915:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802918:	7f d4                	jg     8028ee <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80291a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80291d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802920:	5b                   	pop    %ebx
+  802921:	5e                   	pop    %esi
+  802922:	5f                   	pop    %edi
+  802923:	5d                   	pop    %ebp
+  802924:	c3                   	ret
+	int r, i, n, len = 0;
+  802925:	be 00 00 00 00       	mov    $0x0,%esi
+  80292a:	e9 6a ff ff ff       	jmp    802899 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80292f:	68 a0 45 80 00       	push   $0x8045a0
+  802934:	68 a9 45 80 00       	push   $0x8045a9
+  802939:	68 3b 01 00 00       	push   $0x13b
+  80293e:	68 be 45 80 00       	push   $0x8045be
+  802943:	e8 7b 0e 00 00       	call   8037c3 <_panic>
+
+00802948 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802948:	55                   	push   %ebp
+  802949:	89 e5                	mov    %esp,%ebp
+  80294b:	57                   	push   %edi
+  80294c:	56                   	push   %esi
+  80294d:	53                   	push   %ebx
+  80294e:	83 ec 0c             	sub    $0xc,%esp
+  802951:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802954:	8b 75 10             	mov    0x10(%ebp),%esi
+  802957:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80295a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80295d:	a3 00 80 81 00       	mov    %eax,0x818000
+	nsipcbuf.select.req_readset = *readset;
+  802962:	8b 07                	mov    (%edi),%eax
+  802964:	a3 04 80 81 00       	mov    %eax,0x818004
+  802969:	8b 47 04             	mov    0x4(%edi),%eax
+  80296c:	a3 08 80 81 00       	mov    %eax,0x818008
+  802971:	8b 47 08             	mov    0x8(%edi),%eax
+  802974:	a3 0c 80 81 00       	mov    %eax,0x81800c
+  802979:	8b 47 0c             	mov    0xc(%edi),%eax
+  80297c:	a3 10 80 81 00       	mov    %eax,0x818010
+  802981:	8b 47 10             	mov    0x10(%edi),%eax
+  802984:	a3 14 80 81 00       	mov    %eax,0x818014
+  802989:	8b 47 14             	mov    0x14(%edi),%eax
+  80298c:	a3 18 80 81 00       	mov    %eax,0x818018
+  802991:	8b 47 18             	mov    0x18(%edi),%eax
+  802994:	a3 1c 80 81 00       	mov    %eax,0x81801c
+  802999:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80299c:	a3 20 80 81 00       	mov    %eax,0x818020
+  8029a1:	8b 47 20             	mov    0x20(%edi),%eax
+  8029a4:	a3 24 80 81 00       	mov    %eax,0x818024
+  8029a9:	8b 47 24             	mov    0x24(%edi),%eax
+  8029ac:	a3 28 80 81 00       	mov    %eax,0x818028
+  8029b1:	8b 47 28             	mov    0x28(%edi),%eax
+  8029b4:	a3 2c 80 81 00       	mov    %eax,0x81802c
+  8029b9:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8029bc:	a3 30 80 81 00       	mov    %eax,0x818030
+  8029c1:	8b 47 30             	mov    0x30(%edi),%eax
+  8029c4:	a3 34 80 81 00       	mov    %eax,0x818034
+  8029c9:	8b 47 34             	mov    0x34(%edi),%eax
+  8029cc:	a3 38 80 81 00       	mov    %eax,0x818038
+  8029d1:	8b 47 38             	mov    0x38(%edi),%eax
+  8029d4:	a3 3c 80 81 00       	mov    %eax,0x81803c
+  8029d9:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8029dc:	a3 40 80 81 00       	mov    %eax,0x818040
+	nsipcbuf.select.req_writeset = *writeset;
+  8029e1:	8b 06                	mov    (%esi),%eax
+  8029e3:	a3 44 80 81 00       	mov    %eax,0x818044
+  8029e8:	8b 46 04             	mov    0x4(%esi),%eax
+  8029eb:	a3 48 80 81 00       	mov    %eax,0x818048
+  8029f0:	8b 46 08             	mov    0x8(%esi),%eax
+  8029f3:	a3 4c 80 81 00       	mov    %eax,0x81804c
+  8029f8:	8b 46 0c             	mov    0xc(%esi),%eax
+  8029fb:	a3 50 80 81 00       	mov    %eax,0x818050
+  802a00:	8b 46 10             	mov    0x10(%esi),%eax
+  802a03:	a3 54 80 81 00       	mov    %eax,0x818054
+  802a08:	8b 46 14             	mov    0x14(%esi),%eax
+  802a0b:	a3 58 80 81 00       	mov    %eax,0x818058
+  802a10:	8b 46 18             	mov    0x18(%esi),%eax
+  802a13:	a3 5c 80 81 00       	mov    %eax,0x81805c
+  802a18:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a1b:	a3 60 80 81 00       	mov    %eax,0x818060
+  802a20:	8b 46 20             	mov    0x20(%esi),%eax
+  802a23:	a3 64 80 81 00       	mov    %eax,0x818064
+  802a28:	8b 46 24             	mov    0x24(%esi),%eax
+  802a2b:	a3 68 80 81 00       	mov    %eax,0x818068
+  802a30:	8b 46 28             	mov    0x28(%esi),%eax
+  802a33:	a3 6c 80 81 00       	mov    %eax,0x81806c
+  802a38:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802a3b:	a3 70 80 81 00       	mov    %eax,0x818070
+  802a40:	8b 46 30             	mov    0x30(%esi),%eax
+  802a43:	a3 74 80 81 00       	mov    %eax,0x818074
+  802a48:	8b 46 34             	mov    0x34(%esi),%eax
+  802a4b:	a3 78 80 81 00       	mov    %eax,0x818078
+  802a50:	8b 46 38             	mov    0x38(%esi),%eax
+  802a53:	a3 7c 80 81 00       	mov    %eax,0x81807c
+  802a58:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802a5b:	a3 80 80 81 00       	mov    %eax,0x818080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802a60:	8b 03                	mov    (%ebx),%eax
+  802a62:	a3 84 80 81 00       	mov    %eax,0x818084
+  802a67:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a6a:	a3 88 80 81 00       	mov    %eax,0x818088
+  802a6f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802a72:	a3 8c 80 81 00       	mov    %eax,0x81808c
+  802a77:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802a7a:	a3 90 80 81 00       	mov    %eax,0x818090
+  802a7f:	8b 43 10             	mov    0x10(%ebx),%eax
+  802a82:	a3 94 80 81 00       	mov    %eax,0x818094
+  802a87:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a8a:	a3 98 80 81 00       	mov    %eax,0x818098
+  802a8f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a92:	a3 9c 80 81 00       	mov    %eax,0x81809c
+  802a97:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802a9a:	a3 a0 80 81 00       	mov    %eax,0x8180a0
+  802a9f:	8b 43 20             	mov    0x20(%ebx),%eax
+  802aa2:	a3 a4 80 81 00       	mov    %eax,0x8180a4
+  802aa7:	8b 43 24             	mov    0x24(%ebx),%eax
+  802aaa:	a3 a8 80 81 00       	mov    %eax,0x8180a8
+  802aaf:	8b 43 28             	mov    0x28(%ebx),%eax
+  802ab2:	a3 ac 80 81 00       	mov    %eax,0x8180ac
+  802ab7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802aba:	a3 b0 80 81 00       	mov    %eax,0x8180b0
+  802abf:	8b 43 30             	mov    0x30(%ebx),%eax
+  802ac2:	a3 b4 80 81 00       	mov    %eax,0x8180b4
+  802ac7:	8b 43 34             	mov    0x34(%ebx),%eax
+  802aca:	a3 b8 80 81 00       	mov    %eax,0x8180b8
+  802acf:	8b 43 38             	mov    0x38(%ebx),%eax
+  802ad2:	a3 bc 80 81 00       	mov    %eax,0x8180bc
+  802ad7:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802ada:	a3 c0 80 81 00       	mov    %eax,0x8180c0
+	nsipcbuf.select.req_timeout = msec;
+  802adf:	8b 45 18             	mov    0x18(%ebp),%eax
+  802ae2:	a3 c4 80 81 00       	mov    %eax,0x8180c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802ae7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802aec:	e8 2b f6 ff ff       	call   80211c <nsipc>
+  802af1:	85 c0                	test   %eax,%eax
+  802af3:	0f 88 ad 01 00 00    	js     802ca6 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802af9:	8b 15 04 80 81 00    	mov    0x818004,%edx
+  802aff:	89 17                	mov    %edx,(%edi)
+  802b01:	8b 15 08 80 81 00    	mov    0x818008,%edx
+  802b07:	89 57 04             	mov    %edx,0x4(%edi)
+  802b0a:	8b 15 0c 80 81 00    	mov    0x81800c,%edx
+  802b10:	89 57 08             	mov    %edx,0x8(%edi)
+  802b13:	8b 15 10 80 81 00    	mov    0x818010,%edx
+  802b19:	89 57 0c             	mov    %edx,0xc(%edi)
+  802b1c:	8b 15 14 80 81 00    	mov    0x818014,%edx
+  802b22:	89 57 10             	mov    %edx,0x10(%edi)
+  802b25:	8b 15 18 80 81 00    	mov    0x818018,%edx
+  802b2b:	89 57 14             	mov    %edx,0x14(%edi)
+  802b2e:	8b 15 1c 80 81 00    	mov    0x81801c,%edx
+  802b34:	89 57 18             	mov    %edx,0x18(%edi)
+  802b37:	8b 15 20 80 81 00    	mov    0x818020,%edx
+  802b3d:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802b40:	8b 15 24 80 81 00    	mov    0x818024,%edx
+  802b46:	89 57 20             	mov    %edx,0x20(%edi)
+  802b49:	8b 15 28 80 81 00    	mov    0x818028,%edx
+  802b4f:	89 57 24             	mov    %edx,0x24(%edi)
+  802b52:	8b 15 2c 80 81 00    	mov    0x81802c,%edx
+  802b58:	89 57 28             	mov    %edx,0x28(%edi)
+  802b5b:	8b 15 30 80 81 00    	mov    0x818030,%edx
+  802b61:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802b64:	8b 15 34 80 81 00    	mov    0x818034,%edx
+  802b6a:	89 57 30             	mov    %edx,0x30(%edi)
+  802b6d:	8b 15 38 80 81 00    	mov    0x818038,%edx
+  802b73:	89 57 34             	mov    %edx,0x34(%edi)
+  802b76:	8b 15 3c 80 81 00    	mov    0x81803c,%edx
+  802b7c:	89 57 38             	mov    %edx,0x38(%edi)
+  802b7f:	8b 15 40 80 81 00    	mov    0x818040,%edx
+  802b85:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802b88:	8b 15 44 80 81 00    	mov    0x818044,%edx
+  802b8e:	89 16                	mov    %edx,(%esi)
+  802b90:	8b 15 48 80 81 00    	mov    0x818048,%edx
+  802b96:	89 56 04             	mov    %edx,0x4(%esi)
+  802b99:	8b 15 4c 80 81 00    	mov    0x81804c,%edx
+  802b9f:	89 56 08             	mov    %edx,0x8(%esi)
+  802ba2:	8b 15 50 80 81 00    	mov    0x818050,%edx
+  802ba8:	89 56 0c             	mov    %edx,0xc(%esi)
+  802bab:	8b 15 54 80 81 00    	mov    0x818054,%edx
+  802bb1:	89 56 10             	mov    %edx,0x10(%esi)
+  802bb4:	8b 15 58 80 81 00    	mov    0x818058,%edx
+  802bba:	89 56 14             	mov    %edx,0x14(%esi)
+  802bbd:	8b 15 5c 80 81 00    	mov    0x81805c,%edx
+  802bc3:	89 56 18             	mov    %edx,0x18(%esi)
+  802bc6:	8b 15 60 80 81 00    	mov    0x818060,%edx
+  802bcc:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802bcf:	8b 15 64 80 81 00    	mov    0x818064,%edx
+  802bd5:	89 56 20             	mov    %edx,0x20(%esi)
+  802bd8:	8b 15 68 80 81 00    	mov    0x818068,%edx
+  802bde:	89 56 24             	mov    %edx,0x24(%esi)
+  802be1:	8b 15 6c 80 81 00    	mov    0x81806c,%edx
+  802be7:	89 56 28             	mov    %edx,0x28(%esi)
+  802bea:	8b 15 70 80 81 00    	mov    0x818070,%edx
+  802bf0:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802bf3:	8b 15 74 80 81 00    	mov    0x818074,%edx
+  802bf9:	89 56 30             	mov    %edx,0x30(%esi)
+  802bfc:	8b 15 78 80 81 00    	mov    0x818078,%edx
+  802c02:	89 56 34             	mov    %edx,0x34(%esi)
+  802c05:	8b 15 7c 80 81 00    	mov    0x81807c,%edx
+  802c0b:	89 56 38             	mov    %edx,0x38(%esi)
+  802c0e:	8b 15 80 80 81 00    	mov    0x818080,%edx
+  802c14:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802c17:	8b 15 84 80 81 00    	mov    0x818084,%edx
+  802c1d:	89 13                	mov    %edx,(%ebx)
+  802c1f:	8b 15 88 80 81 00    	mov    0x818088,%edx
+  802c25:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c28:	8b 15 8c 80 81 00    	mov    0x81808c,%edx
+  802c2e:	89 53 08             	mov    %edx,0x8(%ebx)
+  802c31:	8b 15 90 80 81 00    	mov    0x818090,%edx
+  802c37:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802c3a:	8b 15 94 80 81 00    	mov    0x818094,%edx
+  802c40:	89 53 10             	mov    %edx,0x10(%ebx)
+  802c43:	8b 15 98 80 81 00    	mov    0x818098,%edx
+  802c49:	89 53 14             	mov    %edx,0x14(%ebx)
+  802c4c:	8b 15 9c 80 81 00    	mov    0x81809c,%edx
+  802c52:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c55:	8b 15 a0 80 81 00    	mov    0x8180a0,%edx
+  802c5b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802c5e:	8b 15 a4 80 81 00    	mov    0x8180a4,%edx
+  802c64:	89 53 20             	mov    %edx,0x20(%ebx)
+  802c67:	8b 15 a8 80 81 00    	mov    0x8180a8,%edx
+  802c6d:	89 53 24             	mov    %edx,0x24(%ebx)
+  802c70:	8b 15 ac 80 81 00    	mov    0x8180ac,%edx
+  802c76:	89 53 28             	mov    %edx,0x28(%ebx)
+  802c79:	8b 15 b0 80 81 00    	mov    0x8180b0,%edx
+  802c7f:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802c82:	8b 15 b4 80 81 00    	mov    0x8180b4,%edx
+  802c88:	89 53 30             	mov    %edx,0x30(%ebx)
+  802c8b:	8b 15 b8 80 81 00    	mov    0x8180b8,%edx
+  802c91:	89 53 34             	mov    %edx,0x34(%ebx)
+  802c94:	8b 15 bc 80 81 00    	mov    0x8180bc,%edx
+  802c9a:	89 53 38             	mov    %edx,0x38(%ebx)
+  802c9d:	8b 15 c0 80 81 00    	mov    0x8180c0,%edx
+  802ca3:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802ca6:	83 c4 0c             	add    $0xc,%esp
+  802ca9:	5b                   	pop    %ebx
+  802caa:	5e                   	pop    %esi
+  802cab:	5f                   	pop    %edi
+  802cac:	5d                   	pop    %ebp
+  802cad:	c3                   	ret
+
+00802cae <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802cb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb7:	a3 00 80 81 00       	mov    %eax,0x818000
+	nsipcbuf.evctl.req_events = events;
+  802cbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cbf:	a3 04 80 81 00       	mov    %eax,0x818004
+	nsipcbuf.evctl.req_data = data;
+  802cc4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cc7:	a3 08 80 81 00       	mov    %eax,0x818008
+	return nsipc(NSREQ_EVCTL);
+  802ccc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802cd1:	e8 46 f4 ff ff       	call   80211c <nsipc>
+}
+  802cd6:	c9                   	leave
+  802cd7:	c3                   	ret
+
+00802cd8 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802cd8:	55                   	push   %ebp
+  802cd9:	89 e5                	mov    %esp,%ebp
+  802cdb:	56                   	push   %esi
+  802cdc:	53                   	push   %ebx
+  802cdd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802ce0:	89 35 00 80 81 00    	mov    %esi,0x818000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802ce6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ce9:	a3 04 80 81 00       	mov    %eax,0x818004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802cee:	b8 10 00 00 00       	mov    $0x10,%eax
+  802cf3:	e8 24 f4 ff ff       	call   80211c <nsipc>
+  802cf8:	89 c3                	mov    %eax,%ebx
+  802cfa:	85 c0                	test   %eax,%eax
+  802cfc:	7e 1f                	jle    802d1d <nsipc_evwait+0x45>
+		assert(r <= max);
+  802cfe:	39 c6                	cmp    %eax,%esi
+  802d00:	7c 24                	jl     802d26 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802d02:	83 ec 04             	sub    $0x4,%esp
+  802d05:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802d0c:	50                   	push   %eax
+  802d0d:	68 00 80 81 00       	push   $0x818000
+  802d12:	ff 75 08             	push   0x8(%ebp)
+  802d15:	e8 ea df ff ff       	call   800d04 <memmove>
+  802d1a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802d1d:	89 d8                	mov    %ebx,%eax
+  802d1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d22:	5b                   	pop    %ebx
+  802d23:	5e                   	pop    %esi
+  802d24:	5d                   	pop    %ebp
+  802d25:	c3                   	ret
+		assert(r <= max);
+  802d26:	68 d6 45 80 00       	push   $0x8045d6
+  802d2b:	68 a9 45 80 00       	push   $0x8045a9
+  802d30:	68 6a 01 00 00       	push   $0x16a
+  802d35:	68 be 45 80 00       	push   $0x8045be
+  802d3a:	e8 84 0a 00 00       	call   8037c3 <_panic>
+
+00802d3f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d48:	a3 00 80 81 00       	mov    %eax,0x818000
+	nsipcbuf.socket.req_type = type;
+  802d4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d50:	a3 04 80 81 00       	mov    %eax,0x818004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d55:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d58:	a3 08 80 81 00       	mov    %eax,0x818008
+	return nsipc(NSREQ_SOCKET);
+  802d5d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d62:	e8 b5 f3 ff ff       	call   80211c <nsipc>
+}
+  802d67:	c9                   	leave
+  802d68:	c3                   	ret
+
+00802d69 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802d69:	55                   	push   %ebp
+  802d6a:	89 e5                	mov    %esp,%ebp
+  802d6c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802d6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d72:	a3 00 80 81 00       	mov    %eax,0x818000
+	return nsipc(NSREQ_OFFLOAD);
+  802d77:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802d7c:	e8 9b f3 ff ff       	call   80211c <nsipc>
+}
+  802d81:	c9                   	leave
+  802d82:	c3                   	ret
+
+00802d83 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802d83:	55                   	push   %ebp
+  802d84:	89 e5                	mov    %esp,%ebp
+  802d86:	53                   	push   %ebx
+  802d87:	83 ec 04             	sub    $0x4,%esp
+  802d8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802d8d:	b8 12 00 00 00       	mov    $0x12,%eax
+  802d92:	e8 85 f3 ff ff       	call   80211c <nsipc>
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	78 50                	js     802deb <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802d9b:	8b 15 00 80 81 00    	mov    0x818000,%edx
+  802da1:	89 13                	mov    %edx,(%ebx)
+  802da3:	8b 15 04 80 81 00    	mov    0x818004,%edx
+  802da9:	89 53 04             	mov    %edx,0x4(%ebx)
+  802dac:	8b 15 08 80 81 00    	mov    0x818008,%edx
+  802db2:	89 53 08             	mov    %edx,0x8(%ebx)
+  802db5:	8b 15 0c 80 81 00    	mov    0x81800c,%edx
+  802dbb:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802dbe:	8b 15 10 80 81 00    	mov    0x818010,%edx
+  802dc4:	89 53 10             	mov    %edx,0x10(%ebx)
+  802dc7:	8b 15 14 80 81 00    	mov    0x818014,%edx
+  802dcd:	89 53 14             	mov    %edx,0x14(%ebx)
+  802dd0:	8b 15 18 80 81 00    	mov    0x818018,%edx
+  802dd6:	89 53 18             	mov    %edx,0x18(%ebx)
+  802dd9:	8b 15 1c 80 81 00    	mov    0x81801c,%edx
+  802ddf:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802de2:	8b 15 20 80 81 00    	mov    0x818020,%edx
+  802de8:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802deb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dee:	c9                   	leave
+  802def:	c3                   	ret
+
+00802df0 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802df0:	55                   	push   %ebp
+  802df1:	89 e5                	mov    %esp,%ebp
+  802df3:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802df6:	6a 03                	push   $0x3
+  802df8:	e8 05 0d 00 00       	call   803b02 <ipc_find_env>
+  802dfd:	a3 24 63 81 00       	mov    %eax,0x816324
+	nsipcbuf.shard.req_shard = shard;
+  802e02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e05:	a3 00 80 81 00       	mov    %eax,0x818000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802e0a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802e0f:	e8 08 f3 ff ff       	call   80211c <nsipc>
+  802e14:	83 c4 10             	add    $0x10,%esp
+  802e17:	85 c0                	test   %eax,%eax
+  802e19:	78 0a                	js     802e25 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802e1b:	a3 24 63 81 00       	mov    %eax,0x816324
+	return 0;
+  802e20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e25:	c9                   	leave
+  802e26:	c3                   	ret
+
+00802e27 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802e27:	55                   	push   %ebp
+  802e28:	89 e5                	mov    %esp,%ebp
+  802e2a:	57                   	push   %edi
+  802e2b:	56                   	push   %esi
+  802e2c:	53                   	push   %ebx
+  802e2d:	83 ec 1c             	sub    $0x1c,%esp
+  802e30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e33:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802e36:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e40:	89 e0                	mov    %esp,%eax
+  802e42:	89 f2                	mov    %esi,%edx
+  802e44:	29 c2                	sub    %eax,%edx
+  802e46:	89 d0                	mov    %edx,%eax
+  802e48:	c1 e8 0f             	shr    $0xf,%eax
+  802e4b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802e51:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802e54:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  802e5b:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802e5e:	83 ec 0c             	sub    $0xc,%esp
+  802e61:	ff 75 e0             	push   -0x20(%ebp)
+  802e64:	e8 d8 0c 00 00       	call   803b41 <pageref>
+  802e69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e6c:	83 c4 04             	add    $0x4,%esp
+  802e6f:	ff 75 dc             	push   -0x24(%ebp)
+  802e72:	e8 ca 0c 00 00       	call   803b41 <pageref>
+  802e77:	89 e2                	mov    %esp,%edx
+  802e79:	89 f1                	mov    %esi,%ecx
+  802e7b:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802e7d:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802e80:	89 ca                	mov    %ecx,%edx
+  802e82:	c1 ea 0f             	shr    $0xf,%edx
+  802e85:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802e8b:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802e8e:	8b 14 95 60 63 81 00 	mov    0x816360(,%edx,4),%edx
+  802e95:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802e98:	39 d7                	cmp    %edx,%edi
+  802e9a:	74 40                	je     802edc <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802e9c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e9f:	75 9f                	jne    802e40 <_pipeisclosed+0x19>
+  802ea1:	89 e2                	mov    %esp,%edx
+  802ea3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802ea8:	29 d0                	sub    %edx,%eax
+  802eaa:	89 c2                	mov    %eax,%edx
+  802eac:	c1 ea 0f             	shr    $0xf,%edx
+  802eaf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb9:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ebc:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  802ec3:	8b 40 58             	mov    0x58(%eax),%eax
+  802ec6:	6a 01                	push   $0x1
+  802ec8:	50                   	push   %eax
+  802ec9:	57                   	push   %edi
+  802eca:	68 df 45 80 00       	push   $0x8045df
+  802ecf:	e8 89 d5 ff ff       	call   80045d <cprintf>
+  802ed4:	83 c4 10             	add    $0x10,%esp
+  802ed7:	e9 5f ff ff ff       	jmp    802e3b <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802edc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802edf:	0f 94 c0             	sete   %al
+  802ee2:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ee8:	5b                   	pop    %ebx
+  802ee9:	5e                   	pop    %esi
+  802eea:	5f                   	pop    %edi
+  802eeb:	5d                   	pop    %ebp
+  802eec:	c3                   	ret
+
+00802eed <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802eed:	55                   	push   %ebp
+  802eee:	89 e5                	mov    %esp,%ebp
+  802ef0:	53                   	push   %ebx
+  802ef1:	83 ec 0c             	sub    $0xc,%esp
+  802ef4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ef7:	53                   	push   %ebx
+  802ef8:	6a 00                	push   $0x0
+  802efa:	e8 0e e1 ff ff       	call   80100d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802eff:	89 1c 24             	mov    %ebx,(%esp)
+  802f02:	e8 f4 e4 ff ff       	call   8013fb <fd2data>
+  802f07:	83 c4 08             	add    $0x8,%esp
+  802f0a:	50                   	push   %eax
+  802f0b:	6a 00                	push   $0x0
+  802f0d:	e8 fb e0 ff ff       	call   80100d <sys_page_unmap>
+}
+  802f12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f15:	c9                   	leave
+  802f16:	c3                   	ret
+
+00802f17 <devpipe_read>:
+{
+  802f17:	55                   	push   %ebp
+  802f18:	89 e5                	mov    %esp,%ebp
+  802f1a:	57                   	push   %edi
+  802f1b:	56                   	push   %esi
+  802f1c:	53                   	push   %ebx
+  802f1d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802f20:	ff 75 08             	push   0x8(%ebp)
+  802f23:	e8 d3 e4 ff ff       	call   8013fb <fd2data>
+  802f28:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f2a:	8b 70 04             	mov    0x4(%eax),%esi
+  802f2d:	8b 00                	mov    (%eax),%eax
+  802f2f:	83 c4 10             	add    $0x10,%esp
+  802f32:	39 f0                	cmp    %esi,%eax
+  802f34:	75 36                	jne    802f6c <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802f36:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802f39:	89 da                	mov    %ebx,%edx
+  802f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f3e:	e8 e4 fe ff ff       	call   802e27 <_pipeisclosed>
+  802f43:	85 c0                	test   %eax,%eax
+  802f45:	0f 85 d4 00 00 00    	jne    80301f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802f4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f50:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802f54:	83 ec 04             	sub    $0x4,%esp
+  802f57:	6a ff                	push   $0xffffffff
+  802f59:	56                   	push   %esi
+  802f5a:	57                   	push   %edi
+  802f5b:	e8 26 e4 ff ff       	call   801386 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f60:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f63:	8b 03                	mov    (%ebx),%eax
+  802f65:	83 c4 10             	add    $0x10,%esp
+  802f68:	39 c6                	cmp    %eax,%esi
+  802f6a:	74 cd                	je     802f39 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f6c:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f6f:	8b 03                	mov    (%ebx),%eax
+  802f71:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802f77:	29 c6                	sub    %eax,%esi
+  802f79:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f7e:	f7 e6                	mul    %esi
+  802f80:	c1 ea 0c             	shr    $0xc,%edx
+  802f83:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f89:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802f8b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f8e:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802f92:	8b 0b                	mov    (%ebx),%ecx
+  802f94:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f99:	f7 e1                	mul    %ecx
+  802f9b:	c1 ea 0b             	shr    $0xb,%edx
+  802f9e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802fa4:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802fa6:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802fab:	29 cf                	sub    %ecx,%edi
+  802fad:	39 f7                	cmp    %esi,%edi
+  802faf:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802fb2:	83 ec 04             	sub    $0x4,%esp
+  802fb5:	57                   	push   %edi
+  802fb6:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802fba:	50                   	push   %eax
+  802fbb:	ff 75 0c             	push   0xc(%ebp)
+  802fbe:	e8 41 dd ff ff       	call   800d04 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802fc3:	83 c4 0c             	add    $0xc,%esp
+  802fc6:	89 f0                	mov    %esi,%eax
+  802fc8:	29 f8                	sub    %edi,%eax
+  802fca:	50                   	push   %eax
+  802fcb:	8d 43 10             	lea    0x10(%ebx),%eax
+  802fce:	50                   	push   %eax
+  802fcf:	89 f8                	mov    %edi,%eax
+  802fd1:	03 45 0c             	add    0xc(%ebp),%eax
+  802fd4:	50                   	push   %eax
+  802fd5:	e8 2a dd ff ff       	call   800d04 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802fda:	8b 0b                	mov    (%ebx),%ecx
+  802fdc:	01 f1                	add    %esi,%ecx
+  802fde:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fe3:	f7 e1                	mul    %ecx
+  802fe5:	c1 ea 0c             	shr    $0xc,%edx
+  802fe8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802fee:	29 c1                	sub    %eax,%ecx
+  802ff0:	89 0b                	mov    %ecx,(%ebx)
+  802ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff7:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802ffb:	83 c4 10             	add    $0x10,%esp
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	75 0a                	jne    80300c <devpipe_read+0xf5>
+	return n;
+  803002:	89 f0                	mov    %esi,%eax
+}
+  803004:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803007:	5b                   	pop    %ebx
+  803008:	5e                   	pop    %esi
+  803009:	5f                   	pop    %edi
+  80300a:	5d                   	pop    %ebp
+  80300b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80300c:	83 ec 08             	sub    $0x8,%esp
+  80300f:	68 00 04 00 00       	push   $0x400
+  803014:	53                   	push   %ebx
+  803015:	e8 8e e3 ff ff       	call   8013a8 <sys_futex_wake>
+  80301a:	83 c4 10             	add    $0x10,%esp
+  80301d:	eb e3                	jmp    803002 <devpipe_read+0xeb>
+			return 0;
+  80301f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803024:	eb de                	jmp    803004 <devpipe_read+0xed>
+
+00803026 <devpipe_write>:
+{
+  803026:	55                   	push   %ebp
+  803027:	89 e5                	mov    %esp,%ebp
+  803029:	57                   	push   %edi
+  80302a:	56                   	push   %esi
+  80302b:	53                   	push   %ebx
+  80302c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80302f:	ff 75 08             	push   0x8(%ebp)
+  803032:	e8 c4 e3 ff ff       	call   8013fb <fd2data>
+  803037:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803039:	83 c4 10             	add    $0x10,%esp
+  80303c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803043:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803048:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80304c:	0f 84 43 01 00 00    	je     803195 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803052:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803055:	8b 06                	mov    (%esi),%eax
+  803057:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80305d:	29 c1                	sub    %eax,%ecx
+  80305f:	89 c8                	mov    %ecx,%eax
+  803061:	f7 e7                	mul    %edi
+  803063:	c1 ea 0c             	shr    $0xc,%edx
+  803066:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80306c:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80306e:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803074:	75 52                	jne    8030c8 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803076:	89 f2                	mov    %esi,%edx
+  803078:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307b:	e8 a7 fd ff ff       	call   802e27 <_pipeisclosed>
+  803080:	85 c0                	test   %eax,%eax
+  803082:	0f 85 28 01 00 00    	jne    8031b0 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803088:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80308a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80308d:	8b 06                	mov    (%esi),%eax
+  80308f:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803095:	29 c1                	sub    %eax,%ecx
+  803097:	89 c8                	mov    %ecx,%eax
+  803099:	f7 e7                	mul    %edi
+  80309b:	c1 ea 0c             	shr    $0xc,%edx
+  80309e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030a4:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8030a6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8030ac:	75 a4                	jne    803052 <devpipe_write+0x2c>
+  8030ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030b3:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8030b7:	83 ec 04             	sub    $0x4,%esp
+  8030ba:	6a ff                	push   $0xffffffff
+  8030bc:	53                   	push   %ebx
+  8030bd:	56                   	push   %esi
+  8030be:	e8 c3 e2 ff ff       	call   801386 <sys_futex_wait>
+}
+  8030c3:	83 c4 10             	add    $0x10,%esp
+  8030c6:	eb 8a                	jmp    803052 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030c8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030cb:	8b 06                	mov    (%esi),%eax
+  8030cd:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030d3:	29 c1                	sub    %eax,%ecx
+  8030d5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030da:	f7 e1                	mul    %ecx
+  8030dc:	c1 ea 0c             	shr    $0xc,%edx
+  8030df:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030e5:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8030e7:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8030ec:	89 d8                	mov    %ebx,%eax
+  8030ee:	29 c8                	sub    %ecx,%eax
+  8030f0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8030f3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030f6:	29 ca                	sub    %ecx,%edx
+  8030f8:	39 d0                	cmp    %edx,%eax
+  8030fa:	0f 46 d0             	cmovbe %eax,%edx
+  8030fd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803100:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803103:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803108:	f7 e1                	mul    %ecx
+  80310a:	c1 ea 0b             	shr    $0xb,%edx
+  80310d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803113:	89 ca                	mov    %ecx,%edx
+  803115:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803117:	29 d3                	sub    %edx,%ebx
+  803119:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80311c:	39 c3                	cmp    %eax,%ebx
+  80311e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803121:	83 ec 04             	sub    $0x4,%esp
+  803124:	53                   	push   %ebx
+  803125:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803128:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80312b:	51                   	push   %ecx
+  80312c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803130:	50                   	push   %eax
+  803131:	e8 ce db ff ff       	call   800d04 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803136:	83 c4 0c             	add    $0xc,%esp
+  803139:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80313c:	29 d8                	sub    %ebx,%eax
+  80313e:	50                   	push   %eax
+  80313f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803142:	01 cb                	add    %ecx,%ebx
+  803144:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803147:	53                   	push   %ebx
+  803148:	8d 46 10             	lea    0x10(%esi),%eax
+  80314b:	50                   	push   %eax
+  80314c:	e8 b3 db ff ff       	call   800d04 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803151:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803154:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803157:	01 c1                	add    %eax,%ecx
+  803159:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80315e:	f7 e1                	mul    %ecx
+  803160:	c1 ea 0c             	shr    $0xc,%edx
+  803163:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803169:	89 ca                	mov    %ecx,%edx
+  80316b:	29 c2                	sub    %eax,%edx
+  80316d:	89 56 04             	mov    %edx,0x4(%esi)
+  803170:	b8 00 00 00 00       	mov    $0x0,%eax
+  803175:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803179:	83 c4 10             	add    $0x10,%esp
+  80317c:	85 c0                	test   %eax,%eax
+  80317e:	75 1a                	jne    80319a <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803180:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803183:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803186:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803189:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80318c:	0f 82 c0 fe ff ff    	jb     803052 <devpipe_write+0x2c>
+  803192:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803195:	8b 45 10             	mov    0x10(%ebp),%eax
+  803198:	eb 1b                	jmp    8031b5 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  80319a:	83 ec 08             	sub    $0x8,%esp
+  80319d:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8031a2:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8031a5:	50                   	push   %eax
+  8031a6:	e8 fd e1 ff ff       	call   8013a8 <sys_futex_wake>
+  8031ab:	83 c4 10             	add    $0x10,%esp
+  8031ae:	eb d0                	jmp    803180 <devpipe_write+0x15a>
+				return 0;
+  8031b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031b8:	5b                   	pop    %ebx
+  8031b9:	5e                   	pop    %esi
+  8031ba:	5f                   	pop    %edi
+  8031bb:	5d                   	pop    %ebp
+  8031bc:	c3                   	ret
+
+008031bd <devpipe_stat>:
+{
+  8031bd:	55                   	push   %ebp
+  8031be:	89 e5                	mov    %esp,%ebp
+  8031c0:	56                   	push   %esi
+  8031c1:	53                   	push   %ebx
+  8031c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031c5:	83 ec 0c             	sub    $0xc,%esp
+  8031c8:	ff 75 08             	push   0x8(%ebp)
+  8031cb:	e8 2b e2 ff ff       	call   8013fb <fd2data>
+  8031d0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8031d2:	83 c4 08             	add    $0x8,%esp
+  8031d5:	68 f2 45 80 00       	push   $0x8045f2
+  8031da:	53                   	push   %ebx
+  8031db:	e8 74 d9 ff ff       	call   800b54 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031e0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8031e3:	8b 06                	mov    (%esi),%eax
+  8031e5:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8031eb:	29 c1                	sub    %eax,%ecx
+  8031ed:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031f2:	89 c8                	mov    %ecx,%eax
+  8031f4:	f7 e2                	mul    %edx
+  8031f6:	c1 ea 0c             	shr    $0xc,%edx
+  8031f9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031ff:	29 d1                	sub    %edx,%ecx
+  803201:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803207:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80320e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803211:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803218:	50 80 00 
+}
+  80321b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803220:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803223:	5b                   	pop    %ebx
+  803224:	5e                   	pop    %esi
+  803225:	5d                   	pop    %ebp
+  803226:	c3                   	ret
+
+00803227 <devpipe_poll>:
+{
+  803227:	55                   	push   %ebp
+  803228:	89 e5                	mov    %esp,%ebp
+  80322a:	57                   	push   %edi
+  80322b:	56                   	push   %esi
+  80322c:	53                   	push   %ebx
+  80322d:	83 ec 18             	sub    $0x18,%esp
+  803230:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803233:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803236:	57                   	push   %edi
+  803237:	e8 bf e1 ff ff       	call   8013fb <fd2data>
+  80323c:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80323e:	83 c4 10             	add    $0x10,%esp
+  803241:	89 f3                	mov    %esi,%ebx
+  803243:	83 e3 01             	and    $0x1,%ebx
+  803246:	75 27                	jne    80326f <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803248:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80324e:	75 48                	jne    803298 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803250:	89 ca                	mov    %ecx,%edx
+  803252:	89 f8                	mov    %edi,%eax
+  803254:	e8 ce fb ff ff       	call   802e27 <_pipeisclosed>
+  803259:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80325b:	89 d8                	mov    %ebx,%eax
+  80325d:	83 c8 10             	or     $0x10,%eax
+  803260:	85 d2                	test   %edx,%edx
+  803262:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803265:	89 d8                	mov    %ebx,%eax
+  803267:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80326a:	5b                   	pop    %ebx
+  80326b:	5e                   	pop    %esi
+  80326c:	5f                   	pop    %edi
+  80326d:	5d                   	pop    %ebp
+  80326e:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80326f:	8b 58 04             	mov    0x4(%eax),%ebx
+  803272:	8b 00                	mov    (%eax),%eax
+  803274:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80327a:	29 c3                	sub    %eax,%ebx
+  80327c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803281:	89 d8                	mov    %ebx,%eax
+  803283:	f7 e2                	mul    %edx
+  803285:	c1 ea 0c             	shr    $0xc,%edx
+  803288:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80328e:	39 d3                	cmp    %edx,%ebx
+  803290:	0f 95 c3             	setne  %bl
+  803293:	0f b6 db             	movzbl %bl,%ebx
+  803296:	eb b0                	jmp    803248 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803298:	8b 71 04             	mov    0x4(%ecx),%esi
+  80329b:	8b 01                	mov    (%ecx),%eax
+  80329d:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8032a3:	29 c6                	sub    %eax,%esi
+  8032a5:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8032aa:	89 f0                	mov    %esi,%eax
+  8032ac:	f7 e2                	mul    %edx
+  8032ae:	c1 ea 0c             	shr    $0xc,%edx
+  8032b1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032b7:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8032b9:	89 d8                	mov    %ebx,%eax
+  8032bb:	83 c8 04             	or     $0x4,%eax
+  8032be:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8032c4:	0f 42 d8             	cmovb  %eax,%ebx
+  8032c7:	eb 87                	jmp    803250 <devpipe_poll+0x29>
+
+008032c9 <pipe>:
+{
+  8032c9:	55                   	push   %ebp
+  8032ca:	89 e5                	mov    %esp,%ebp
+  8032cc:	56                   	push   %esi
+  8032cd:	53                   	push   %ebx
+  8032ce:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8032d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032d4:	50                   	push   %eax
+  8032d5:	e8 38 e1 ff ff       	call   801412 <fd_alloc>
+  8032da:	89 c3                	mov    %eax,%ebx
+  8032dc:	83 c4 10             	add    $0x10,%esp
+  8032df:	85 c0                	test   %eax,%eax
+  8032e1:	0f 88 23 01 00 00    	js     80340a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032e7:	83 ec 04             	sub    $0x4,%esp
+  8032ea:	68 07 04 00 00       	push   $0x407
+  8032ef:	ff 75 f4             	push   -0xc(%ebp)
+  8032f2:	6a 00                	push   $0x0
+  8032f4:	e8 8f dc ff ff       	call   800f88 <sys_page_alloc>
+  8032f9:	89 c3                	mov    %eax,%ebx
+  8032fb:	83 c4 10             	add    $0x10,%esp
+  8032fe:	85 c0                	test   %eax,%eax
+  803300:	0f 88 04 01 00 00    	js     80340a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803306:	83 ec 0c             	sub    $0xc,%esp
+  803309:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80330c:	50                   	push   %eax
+  80330d:	e8 00 e1 ff ff       	call   801412 <fd_alloc>
+  803312:	89 c3                	mov    %eax,%ebx
+  803314:	83 c4 10             	add    $0x10,%esp
+  803317:	85 c0                	test   %eax,%eax
+  803319:	0f 88 db 00 00 00    	js     8033fa <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80331f:	83 ec 04             	sub    $0x4,%esp
+  803322:	68 07 04 00 00       	push   $0x407
+  803327:	ff 75 f0             	push   -0x10(%ebp)
+  80332a:	6a 00                	push   $0x0
+  80332c:	e8 57 dc ff ff       	call   800f88 <sys_page_alloc>
+  803331:	89 c3                	mov    %eax,%ebx
+  803333:	83 c4 10             	add    $0x10,%esp
+  803336:	85 c0                	test   %eax,%eax
+  803338:	0f 88 bc 00 00 00    	js     8033fa <pipe+0x131>
+	va = fd2data(fd0);
+  80333e:	83 ec 0c             	sub    $0xc,%esp
+  803341:	ff 75 f4             	push   -0xc(%ebp)
+  803344:	e8 b2 e0 ff ff       	call   8013fb <fd2data>
+  803349:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80334b:	83 c4 0c             	add    $0xc,%esp
+  80334e:	68 07 04 00 00       	push   $0x407
+  803353:	50                   	push   %eax
+  803354:	6a 00                	push   $0x0
+  803356:	e8 2d dc ff ff       	call   800f88 <sys_page_alloc>
+  80335b:	89 c3                	mov    %eax,%ebx
+  80335d:	83 c4 10             	add    $0x10,%esp
+  803360:	85 c0                	test   %eax,%eax
+  803362:	0f 88 82 00 00 00    	js     8033ea <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803368:	83 ec 0c             	sub    $0xc,%esp
+  80336b:	ff 75 f0             	push   -0x10(%ebp)
+  80336e:	e8 88 e0 ff ff       	call   8013fb <fd2data>
+  803373:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80337a:	50                   	push   %eax
+  80337b:	6a 00                	push   $0x0
+  80337d:	56                   	push   %esi
+  80337e:	6a 00                	push   $0x0
+  803380:	e8 46 dc ff ff       	call   800fcb <sys_page_map>
+  803385:	89 c3                	mov    %eax,%ebx
+  803387:	83 c4 20             	add    $0x20,%esp
+  80338a:	85 c0                	test   %eax,%eax
+  80338c:	78 4e                	js     8033dc <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80338e:	a1 60 50 80 00       	mov    0x805060,%eax
+  803393:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803396:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803398:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80339b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8033a2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8033a5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8033a7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8033aa:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8033b1:	83 ec 0c             	sub    $0xc,%esp
+  8033b4:	ff 75 f4             	push   -0xc(%ebp)
+  8033b7:	e8 2f e0 ff ff       	call   8013eb <fd2num>
+  8033bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033bf:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8033c1:	83 c4 04             	add    $0x4,%esp
+  8033c4:	ff 75 f0             	push   -0x10(%ebp)
+  8033c7:	e8 1f e0 ff ff       	call   8013eb <fd2num>
+  8033cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033cf:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8033d2:	83 c4 10             	add    $0x10,%esp
+  8033d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033da:	eb 2e                	jmp    80340a <pipe+0x141>
+	sys_page_unmap(0, va);
+  8033dc:	83 ec 08             	sub    $0x8,%esp
+  8033df:	56                   	push   %esi
+  8033e0:	6a 00                	push   $0x0
+  8033e2:	e8 26 dc ff ff       	call   80100d <sys_page_unmap>
+  8033e7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8033ea:	83 ec 08             	sub    $0x8,%esp
+  8033ed:	ff 75 f0             	push   -0x10(%ebp)
+  8033f0:	6a 00                	push   $0x0
+  8033f2:	e8 16 dc ff ff       	call   80100d <sys_page_unmap>
+  8033f7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033fa:	83 ec 08             	sub    $0x8,%esp
+  8033fd:	ff 75 f4             	push   -0xc(%ebp)
+  803400:	6a 00                	push   $0x0
+  803402:	e8 06 dc ff ff       	call   80100d <sys_page_unmap>
+  803407:	83 c4 10             	add    $0x10,%esp
+}
+  80340a:	89 d8                	mov    %ebx,%eax
+  80340c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80340f:	5b                   	pop    %ebx
+  803410:	5e                   	pop    %esi
+  803411:	5d                   	pop    %ebp
+  803412:	c3                   	ret
+
+00803413 <pipeisclosed>:
+{
+  803413:	55                   	push   %ebp
+  803414:	89 e5                	mov    %esp,%ebp
+  803416:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803419:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80341c:	50                   	push   %eax
+  80341d:	ff 75 08             	push   0x8(%ebp)
+  803420:	e8 3d e0 ff ff       	call   801462 <fd_lookup>
+  803425:	83 c4 10             	add    $0x10,%esp
+  803428:	85 c0                	test   %eax,%eax
+  80342a:	78 18                	js     803444 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80342c:	83 ec 0c             	sub    $0xc,%esp
+  80342f:	ff 75 f4             	push   -0xc(%ebp)
+  803432:	e8 c4 df ff ff       	call   8013fb <fd2data>
+  803437:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80343c:	e8 e6 f9 ff ff       	call   802e27 <_pipeisclosed>
+  803441:	83 c4 10             	add    $0x10,%esp
+}
+  803444:	c9                   	leave
+  803445:	c3                   	ret
+
+00803446 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803446:	55                   	push   %ebp
+  803447:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803449:	8b 45 08             	mov    0x8(%ebp),%eax
+  80344c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803452:	5d                   	pop    %ebp
+  803453:	c3                   	ret
+
+00803454 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803454:	55                   	push   %ebp
+  803455:	89 e5                	mov    %esp,%ebp
+  803457:	53                   	push   %ebx
+  803458:	83 ec 04             	sub    $0x4,%esp
+  80345b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80345e:	8b 03                	mov    (%ebx),%eax
+  803460:	85 c0                	test   %eax,%eax
+  803462:	75 05                	jne    803469 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803464:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803467:	c9                   	leave
+  803468:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803469:	83 ec 08             	sub    $0x8,%esp
+  80346c:	50                   	push   %eax
+  80346d:	8d 43 04             	lea    0x4(%ebx),%eax
+  803470:	50                   	push   %eax
+  803471:	e8 e7 dd ff ff       	call   80125d <sys_page_batch>
+	pb->pb_n = 0;
+  803476:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80347c:	83 c4 10             	add    $0x10,%esp
+  80347f:	eb e3                	jmp    803464 <pgbatch_flush+0x10>
+
+00803481 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803481:	55                   	push   %ebp
+  803482:	89 e5                	mov    %esp,%ebp
+  803484:	56                   	push   %esi
+  803485:	53                   	push   %ebx
+  803486:	89 c3                	mov    %eax,%ebx
+  803488:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80348a:	83 38 20             	cmpl   $0x20,(%eax)
+  80348d:	74 2c                	je     8034bb <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  80348f:	8b 03                	mov    (%ebx),%eax
+  803491:	8d 50 01             	lea    0x1(%eax),%edx
+  803494:	89 13                	mov    %edx,(%ebx)
+  803496:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803499:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  80349d:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  80349f:	83 ec 04             	sub    $0x4,%esp
+  8034a2:	6a 18                	push   $0x18
+  8034a4:	6a 00                	push   $0x0
+  8034a6:	50                   	push   %eax
+  8034a7:	e8 23 d8 ff ff       	call   800ccf <memset>
+	return 0;
+  8034ac:	83 c4 10             	add    $0x10,%esp
+  8034af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034b7:	5b                   	pop    %ebx
+  8034b8:	5e                   	pop    %esi
+  8034b9:	5d                   	pop    %ebp
+  8034ba:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8034bb:	83 ec 0c             	sub    $0xc,%esp
+  8034be:	50                   	push   %eax
+  8034bf:	e8 90 ff ff ff       	call   803454 <pgbatch_flush>
+  8034c4:	83 c4 10             	add    $0x10,%esp
+  8034c7:	85 c0                	test   %eax,%eax
+  8034c9:	79 c4                	jns    80348f <pgbatch_slot+0xe>
+  8034cb:	eb e7                	jmp    8034b4 <pgbatch_slot+0x33>
+
+008034cd <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8034cd:	55                   	push   %ebp
+  8034ce:	89 e5                	mov    %esp,%ebp
+  8034d0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034d3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034d9:	e8 a3 ff ff ff       	call   803481 <pgbatch_slot>
+  8034de:	85 c0                	test   %eax,%eax
+  8034e0:	78 20                	js     803502 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8034e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034e5:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8034eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034ee:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034f4:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034f7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034fa:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803502:	c9                   	leave
+  803503:	c3                   	ret
+
+00803504 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803504:	55                   	push   %ebp
+  803505:	89 e5                	mov    %esp,%ebp
+  803507:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80350a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80350d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803510:	e8 6c ff ff ff       	call   803481 <pgbatch_slot>
+  803515:	85 c0                	test   %eax,%eax
+  803517:	78 2c                	js     803545 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803519:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80351c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803522:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803525:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803528:	8b 55 10             	mov    0x10(%ebp),%edx
+  80352b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80352e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803531:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803534:	8b 55 18             	mov    0x18(%ebp),%edx
+  803537:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80353a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80353d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803540:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803545:	c9                   	leave
+  803546:	c3                   	ret
+
+00803547 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803547:	55                   	push   %ebp
+  803548:	89 e5                	mov    %esp,%ebp
+  80354a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80354d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803550:	8b 45 08             	mov    0x8(%ebp),%eax
+  803553:	e8 29 ff ff ff       	call   803481 <pgbatch_slot>
+  803558:	85 c0                	test   %eax,%eax
+  80355a:	78 1a                	js     803576 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80355c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80355f:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803565:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803568:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80356b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80356e:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803571:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803576:	c9                   	leave
+  803577:	c3                   	ret
+
+00803578 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803578:	55                   	push   %ebp
+  803579:	89 e5                	mov    %esp,%ebp
+  80357b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80357e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803581:	8b 45 08             	mov    0x8(%ebp),%eax
+  803584:	e8 f8 fe ff ff       	call   803481 <pgbatch_slot>
+  803589:	85 c0                	test   %eax,%eax
+  80358b:	78 20                	js     8035ad <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  80358d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803590:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803596:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803599:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80359c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80359f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8035a2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035a5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ad:	c9                   	leave
+  8035ae:	c3                   	ret
+
+008035af <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8035af:	55                   	push   %ebp
+  8035b0:	89 e5                	mov    %esp,%ebp
+  8035b2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035b5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8035b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035bb:	e8 c1 fe ff ff       	call   803481 <pgbatch_slot>
+  8035c0:	85 c0                	test   %eax,%eax
+  8035c2:	78 26                	js     8035ea <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8035c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035c7:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8035cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035d0:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8035d3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035d6:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8035d9:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035dc:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8035df:	8b 55 18             	mov    0x18(%ebp),%edx
+  8035e2:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ea:	c9                   	leave
+  8035eb:	c3                   	ret
+
+008035ec <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8035ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f1:	c3                   	ret
+
+008035f2 <devcons_poll>:
+{
+  8035f2:	55                   	push   %ebp
+  8035f3:	89 e5                	mov    %esp,%ebp
+  8035f5:	53                   	push   %ebx
+  8035f6:	83 ec 04             	sub    $0x4,%esp
+  8035f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8035fc:	89 da                	mov    %ebx,%edx
+  8035fe:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803601:	83 3d 34 63 81 00 00 	cmpl   $0x0,0x816334
+  803608:	74 0c                	je     803616 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80360a:	89 d8                	mov    %ebx,%eax
+  80360c:	83 e0 01             	and    $0x1,%eax
+  80360f:	09 d0                	or     %edx,%eax
+}
+  803611:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803614:	c9                   	leave
+  803615:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803616:	e8 cf d8 ff ff       	call   800eea <sys_cgetc>
+  80361b:	a3 34 63 81 00       	mov    %eax,0x816334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803620:	89 da                	mov    %ebx,%edx
+  803622:	83 e2 04             	and    $0x4,%edx
+  803625:	85 c0                	test   %eax,%eax
+  803627:	74 e6                	je     80360f <devcons_poll+0x1d>
+  803629:	eb df                	jmp    80360a <devcons_poll+0x18>
+
+0080362b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80362b:	55                   	push   %ebp
+  80362c:	89 e5                	mov    %esp,%ebp
+  80362e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803631:	68 fe 45 80 00       	push   $0x8045fe
+  803636:	ff 75 0c             	push   0xc(%ebp)
+  803639:	e8 16 d5 ff ff       	call   800b54 <strcpy>
+	return 0;
+}
+  80363e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803643:	c9                   	leave
+  803644:	c3                   	ret
+
+00803645 <devcons_write>:
+{
+  803645:	55                   	push   %ebp
+  803646:	89 e5                	mov    %esp,%ebp
+  803648:	57                   	push   %edi
+  803649:	56                   	push   %esi
+  80364a:	53                   	push   %ebx
+  80364b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803651:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803654:	85 ff                	test   %edi,%edi
+  803656:	74 51                	je     8036a9 <devcons_write+0x64>
+  803658:	be 00 00 00 00       	mov    $0x0,%esi
+  80365d:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803662:	89 fb                	mov    %edi,%ebx
+  803664:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803666:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80366b:	39 d3                	cmp    %edx,%ebx
+  80366d:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803670:	83 ec 04             	sub    $0x4,%esp
+  803673:	53                   	push   %ebx
+  803674:	03 45 0c             	add    0xc(%ebp),%eax
+  803677:	50                   	push   %eax
+  803678:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80367e:	50                   	push   %eax
+  80367f:	e8 80 d6 ff ff       	call   800d04 <memmove>
+		sys_cputs(buf, m);
+  803684:	83 c4 08             	add    $0x8,%esp
+  803687:	53                   	push   %ebx
+  803688:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80368e:	50                   	push   %eax
+  80368f:	e8 38 d8 ff ff       	call   800ecc <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803694:	01 de                	add    %ebx,%esi
+  803696:	89 f0                	mov    %esi,%eax
+  803698:	83 c4 10             	add    $0x10,%esp
+  80369b:	39 fe                	cmp    %edi,%esi
+  80369d:	72 c3                	jb     803662 <devcons_write+0x1d>
+}
+  80369f:	89 f0                	mov    %esi,%eax
+  8036a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a4:	5b                   	pop    %ebx
+  8036a5:	5e                   	pop    %esi
+  8036a6:	5f                   	pop    %edi
+  8036a7:	5d                   	pop    %ebp
+  8036a8:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8036a9:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8036ae:	eb ef                	jmp    80369f <devcons_write+0x5a>
+
+008036b0 <devcons_read>:
+{
+  8036b0:	55                   	push   %ebp
+  8036b1:	89 e5                	mov    %esp,%ebp
+  8036b3:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8036b6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8036bb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036bf:	74 36                	je     8036f7 <devcons_read+0x47>
+	c = cons_peek;
+  8036c1:	a1 34 63 81 00       	mov    0x816334,%eax
+	cons_peek = 0;
+  8036c6:	c7 05 34 63 81 00 00 	movl   $0x0,0x816334
+  8036cd:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8036d0:	85 c0                	test   %eax,%eax
+  8036d2:	75 10                	jne    8036e4 <devcons_read+0x34>
+  8036d4:	e8 11 d8 ff ff       	call   800eea <sys_cgetc>
+  8036d9:	85 c0                	test   %eax,%eax
+  8036db:	75 07                	jne    8036e4 <devcons_read+0x34>
+		sys_yield();
+  8036dd:	e8 87 d8 ff ff       	call   800f69 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8036e2:	eb f0                	jmp    8036d4 <devcons_read+0x24>
+	if (c < 0)
+  8036e4:	85 c0                	test   %eax,%eax
+  8036e6:	78 0f                	js     8036f7 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8036e8:	83 f8 04             	cmp    $0x4,%eax
+  8036eb:	74 0c                	je     8036f9 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8036ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036f0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8036f2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8036f7:	c9                   	leave
+  8036f8:	c3                   	ret
+		return 0;
+  8036f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fe:	eb f7                	jmp    8036f7 <devcons_read+0x47>
+
+00803700 <cputchar>:
+{
+  803700:	55                   	push   %ebp
+  803701:	89 e5                	mov    %esp,%ebp
+  803703:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803706:	8b 45 08             	mov    0x8(%ebp),%eax
+  803709:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80370c:	6a 01                	push   $0x1
+  80370e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803711:	50                   	push   %eax
+  803712:	e8 b5 d7 ff ff       	call   800ecc <sys_cputs>
+}
+  803717:	83 c4 10             	add    $0x10,%esp
+  80371a:	c9                   	leave
+  80371b:	c3                   	ret
+
+0080371c <getchar>:
+{
+  80371c:	55                   	push   %ebp
+  80371d:	89 e5                	mov    %esp,%ebp
+  80371f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803722:	6a 01                	push   $0x1
+  803724:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803727:	50                   	push   %eax
+  803728:	6a 00                	push   $0x0
+  80372a:	e8 b7 df ff ff       	call   8016e6 <read>
+	if (r < 0)
+  80372f:	83 c4 10             	add    $0x10,%esp
+  803732:	85 c0                	test   %eax,%eax
+  803734:	78 06                	js     80373c <getchar+0x20>
+	if (r < 1)
+  803736:	74 06                	je     80373e <getchar+0x22>
+	return c;
+  803738:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80373c:	c9                   	leave
+  80373d:	c3                   	ret
+		return -E_EOF;
+  80373e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803743:	eb f7                	jmp    80373c <getchar+0x20>
+
+00803745 <iscons>:
+{
+  803745:	55                   	push   %ebp
+  803746:	89 e5                	mov    %esp,%ebp
+  803748:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80374b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80374e:	50                   	push   %eax
+  80374f:	ff 75 08             	push   0x8(%ebp)
+  803752:	e8 0b dd ff ff       	call   801462 <fd_lookup>
+  803757:	83 c4 10             	add    $0x10,%esp
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	78 11                	js     80376f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80375e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803761:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803767:	39 10                	cmp    %edx,(%eax)
+  803769:	0f 94 c0             	sete   %al
+  80376c:	0f b6 c0             	movzbl %al,%eax
+}
+  80376f:	c9                   	leave
+  803770:	c3                   	ret
+
+00803771 <opencons>:
+{
+  803771:	55                   	push   %ebp
+  803772:	89 e5                	mov    %esp,%ebp
+  803774:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803777:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80377a:	50                   	push   %eax
+  80377b:	e8 92 dc ff ff       	call   801412 <fd_alloc>
+  803780:	83 c4 10             	add    $0x10,%esp
+  803783:	85 c0                	test   %eax,%eax
+  803785:	78 3a                	js     8037c1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803787:	83 ec 04             	sub    $0x4,%esp
+  80378a:	68 07 04 00 00       	push   $0x407
+  80378f:	ff 75 f4             	push   -0xc(%ebp)
+  803792:	6a 00                	push   $0x0
+  803794:	e8 ef d7 ff ff       	call   800f88 <sys_page_alloc>
+  803799:	83 c4 10             	add    $0x10,%esp
+  80379c:	85 c0                	test   %eax,%eax
+  80379e:	78 21                	js     8037c1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8037a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037a3:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8037a9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8037ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037ae:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8037b5:	83 ec 0c             	sub    $0xc,%esp
+  8037b8:	50                   	push   %eax
+  8037b9:	e8 2d dc ff ff       	call   8013eb <fd2num>
+  8037be:	83 c4 10             	add    $0x10,%esp
+}
+  8037c1:	c9                   	leave
+  8037c2:	c3                   	ret
+
+008037c3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8037c3:	55                   	push   %ebp
+  8037c4:	89 e5                	mov    %esp,%ebp
+  8037c6:	56                   	push   %esi
+  8037c7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8037c8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8037cb:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8037d1:	e8 74 d7 ff ff       	call   800f4a <sys_getenvid>
+  8037d6:	83 ec 0c             	sub    $0xc,%esp
+  8037d9:	ff 75 0c             	push   0xc(%ebp)
+  8037dc:	ff 75 08             	push   0x8(%ebp)
+  8037df:	56                   	push   %esi
+  8037e0:	50                   	push   %eax
+  8037e1:	68 0c 46 80 00       	push   $0x80460c
+  8037e6:	e8 72 cc ff ff       	call   80045d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8037eb:	83 c4 18             	add    $0x18,%esp
+  8037ee:	53                   	push   %ebx
+  8037ef:	ff 75 10             	push   0x10(%ebp)
+  8037f2:	e8 15 cc ff ff       	call   80040c <vcprintf>
+	cprintf("\n");
+  8037f7:	c7 04 24 f0 45 80 00 	movl   $0x8045f0,(%esp)
+  8037fe:	e8 5a cc ff ff       	call   80045d <cprintf>
+  803803:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803806:	cc                   	int3
+	while (1)
+  803807:	eb fd                	jmp    803806 <_panic+0x43>
+
+00803809 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803809:	55                   	push   %ebp
+  80380a:	89 e5                	mov    %esp,%ebp
+  80380c:	56                   	push   %esi
+  80380d:	53                   	push   %ebx
+  80380e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803811:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803814:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803817:	85 c0                	test   %eax,%eax
+  803819:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80381e:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803821:	83 ec 0c             	sub    $0xc,%esp
+  803824:	50                   	push   %eax
+  803825:	e8 0e d9 ff ff       	call   801138 <sys_ipc_recv>
+  80382a:	83 c4 10             	add    $0x10,%esp
+  80382d:	85 c0                	test   %eax,%eax
+  80382f:	0f 88 8b 00 00 00    	js     8038c0 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803835:	85 f6                	test   %esi,%esi
+  803837:	74 2a                	je     803863 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803839:	89 e2                	mov    %esp,%edx
+  80383b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803840:	29 d0                	sub    %edx,%eax
+  803842:	89 c2                	mov    %eax,%edx
+  803844:	c1 ea 0f             	shr    $0xf,%edx
+  803847:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80384c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803851:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803854:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  80385b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803861:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803863:	85 db                	test   %ebx,%ebx
+  803865:	74 2a                	je     803891 <ipc_recv+0x88>
+  803867:	89 e2                	mov    %esp,%edx
+  803869:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80386e:	29 d0                	sub    %edx,%eax
+  803870:	89 c2                	mov    %eax,%edx
+  803872:	c1 ea 0f             	shr    $0xf,%edx
+  803875:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80387a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387f:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803882:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  803889:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80388f:	89 03                	mov    %eax,(%ebx)
+  803891:	89 e2                	mov    %esp,%edx
+  803893:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803898:	29 d0                	sub    %edx,%eax
+  80389a:	89 c2                	mov    %eax,%edx
+  80389c:	c1 ea 0f             	shr    $0xf,%edx
+  80389f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a9:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8038ac:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  8038b3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8038b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038bc:	5b                   	pop    %ebx
+  8038bd:	5e                   	pop    %esi
+  8038be:	5d                   	pop    %ebp
+  8038bf:	c3                   	ret
+		if(from_env_store != NULL)
+  8038c0:	85 f6                	test   %esi,%esi
+  8038c2:	74 06                	je     8038ca <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8038c4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8038ca:	85 db                	test   %ebx,%ebx
+  8038cc:	74 eb                	je     8038b9 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8038ce:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8038d4:	eb e3                	jmp    8038b9 <ipc_recv+0xb0>
+
+008038d6 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8038d6:	55                   	push   %ebp
+  8038d7:	89 e5                	mov    %esp,%ebp
+  8038d9:	57                   	push   %edi
+  8038da:	56                   	push   %esi
+  8038db:	53                   	push   %ebx
+  8038dc:	83 ec 14             	sub    $0x14,%esp
+  8038df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038e5:	8b 75 14             	mov    0x14(%ebp),%esi
+  8038e8:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8038eb:	85 c0                	test   %eax,%eax
+  8038ed:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8038f2:	0f 44 c2             	cmove  %edx,%eax
+  8038f5:	ff 75 10             	push   0x10(%ebp)
+  8038f8:	50                   	push   %eax
+  8038f9:	e8 9c d8 ff ff       	call   80119a <sys_ipc_recv_pages>
+  8038fe:	83 c4 10             	add    $0x10,%esp
+  803901:	85 c0                	test   %eax,%eax
+  803903:	0f 88 ba 00 00 00    	js     8039c3 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803909:	85 ff                	test   %edi,%edi
+  80390b:	74 2a                	je     803937 <ipc_recv_pages+0x61>
+  80390d:	89 e2                	mov    %esp,%edx
+  80390f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803914:	29 d0                	sub    %edx,%eax
+  803916:	89 c2                	mov    %eax,%edx
+  803918:	c1 ea 0f             	shr    $0xf,%edx
+  80391b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803920:	b8 00 00 00 00       	mov    $0x0,%eax
+  803925:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803928:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  80392f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803935:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803937:	85 f6                	test   %esi,%esi
+  803939:	74 2a                	je     803965 <ipc_recv_pages+0x8f>
+  80393b:	89 e2                	mov    %esp,%edx
+  80393d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803942:	29 d0                	sub    %edx,%eax
+  803944:	89 c2                	mov    %eax,%edx
+  803946:	c1 ea 0f             	shr    $0xf,%edx
+  803949:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80394e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803953:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803956:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  80395d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803963:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803965:	85 db                	test   %ebx,%ebx
+  803967:	74 2a                	je     803993 <ipc_recv_pages+0xbd>
+  803969:	89 e2                	mov    %esp,%edx
+  80396b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803970:	29 d0                	sub    %edx,%eax
+  803972:	89 c2                	mov    %eax,%edx
+  803974:	c1 ea 0f             	shr    $0xf,%edx
+  803977:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80397c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803981:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803984:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  80398b:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803991:	89 03                	mov    %eax,(%ebx)
+  803993:	89 e2                	mov    %esp,%edx
+  803995:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80399a:	29 d0                	sub    %edx,%eax
+  80399c:	89 c2                	mov    %eax,%edx
+  80399e:	c1 ea 0f             	shr    $0xf,%edx
+  8039a1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ab:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8039ae:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  8039b5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8039bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039be:	5b                   	pop    %ebx
+  8039bf:	5e                   	pop    %esi
+  8039c0:	5f                   	pop    %edi
+  8039c1:	5d                   	pop    %ebp
+  8039c2:	c3                   	ret
+		if (from_env_store)
+  8039c3:	85 ff                	test   %edi,%edi
+  8039c5:	74 06                	je     8039cd <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8039c7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8039cd:	85 f6                	test   %esi,%esi
+  8039cf:	74 06                	je     8039d7 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8039d1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8039d7:	85 db                	test   %ebx,%ebx
+  8039d9:	74 e0                	je     8039bb <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8039db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8039e1:	eb d8                	jmp    8039bb <ipc_recv_pages+0xe5>
+
+008039e3 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8039e3:	55                   	push   %ebp
+  8039e4:	89 e5                	mov    %esp,%ebp
+  8039e6:	57                   	push   %edi
+  8039e7:	56                   	push   %esi
+  8039e8:	53                   	push   %ebx
+  8039e9:	83 ec 1c             	sub    $0x1c,%esp
+  8039ec:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8039ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039f2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8039f8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8039fc:	75 2b                	jne    803a29 <ipc_try_send_pages+0x46>
+  8039fe:	89 e2                	mov    %esp,%edx
+  803a00:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803a05:	29 d0                	sub    %edx,%eax
+  803a07:	89 c2                	mov    %eax,%edx
+  803a09:	c1 ea 0f             	shr    $0xf,%edx
+  803a0c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a16:	0f 42 c2             	cmovb  %edx,%eax
+  803a19:	8b 04 85 60 63 81 00 	mov    0x816360(,%eax,4),%eax
+  803a20:	8b 70 48             	mov    0x48(%eax),%esi
+  803a23:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803a29:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803a2f:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803a34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803a37:	85 ff                	test   %edi,%edi
+  803a39:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803a3e:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803a41:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803a47:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803a4d:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803a53:	83 ec 0c             	sub    $0xc,%esp
+  803a56:	ff 75 14             	push   0x14(%ebp)
+  803a59:	ff 75 18             	push   0x18(%ebp)
+  803a5c:	57                   	push   %edi
+  803a5d:	ff 75 0c             	push   0xc(%ebp)
+  803a60:	ff 75 08             	push   0x8(%ebp)
+  803a63:	e8 11 d7 ff ff       	call   801179 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803a68:	83 c4 20             	add    $0x20,%esp
+  803a6b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803a6e:	75 21                	jne    803a91 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803a70:	83 ec 04             	sub    $0x4,%esp
+  803a73:	6a ff                	push   $0xffffffff
+  803a75:	53                   	push   %ebx
+  803a76:	ff 75 e4             	push   -0x1c(%ebp)
+  803a79:	e8 08 d9 ff ff       	call   801386 <sys_futex_wait>
+  803a7e:	83 c4 10             	add    $0x10,%esp
+  803a81:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803a84:	74 c7                	je     803a4d <ipc_try_send_pages+0x6a>
+  803a86:	85 c0                	test   %eax,%eax
+  803a88:	79 c3                	jns    803a4d <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803a8a:	e8 da d4 ff ff       	call   800f69 <sys_yield>
+  803a8f:	eb bc                	jmp    803a4d <ipc_try_send_pages+0x6a>
+	}
+}
+  803a91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a94:	5b                   	pop    %ebx
+  803a95:	5e                   	pop    %esi
+  803a96:	5f                   	pop    %edi
+  803a97:	5d                   	pop    %ebp
+  803a98:	c3                   	ret
+
+00803a99 <ipc_send>:
+{
+  803a99:	55                   	push   %ebp
+  803a9a:	89 e5                	mov    %esp,%ebp
+  803a9c:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803a9f:	ff 75 14             	push   0x14(%ebp)
+  803aa2:	6a 01                	push   $0x1
+  803aa4:	ff 75 10             	push   0x10(%ebp)
+  803aa7:	ff 75 0c             	push   0xc(%ebp)
+  803aaa:	ff 75 08             	push   0x8(%ebp)
+  803aad:	e8 31 ff ff ff       	call   8039e3 <ipc_try_send_pages>
+  803ab2:	83 c4 20             	add    $0x20,%esp
+  803ab5:	85 c0                	test   %eax,%eax
+  803ab7:	78 02                	js     803abb <ipc_send+0x22>
+}
+  803ab9:	c9                   	leave
+  803aba:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803abb:	50                   	push   %eax
+  803abc:	68 2f 46 80 00       	push   $0x80462f
+  803ac1:	6a 3f                	push   $0x3f
+  803ac3:	68 44 46 80 00       	push   $0x804644
+  803ac8:	e8 f6 fc ff ff       	call   8037c3 <_panic>
+
+00803acd <ipc_send_pages>:
+{
+  803acd:	55                   	push   %ebp
+  803ace:	89 e5                	mov    %esp,%ebp
+  803ad0:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803ad3:	ff 75 18             	push   0x18(%ebp)
+  803ad6:	ff 75 14             	push   0x14(%ebp)
+  803ad9:	ff 75 10             	push   0x10(%ebp)
+  803adc:	ff 75 0c             	push   0xc(%ebp)
+  803adf:	ff 75 08             	push   0x8(%ebp)
+  803ae2:	e8 fc fe ff ff       	call   8039e3 <ipc_try_send_pages>
+  803ae7:	83 c4 20             	add    $0x20,%esp
+  803aea:	85 c0                	test   %eax,%eax
+  803aec:	78 02                	js     803af0 <ipc_send_pages+0x23>
+}
+  803aee:	c9                   	leave
+  803aef:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803af0:	50                   	push   %eax
+  803af1:	68 4e 46 80 00       	push   $0x80464e
+  803af6:	6a 64                	push   $0x64
+  803af8:	68 44 46 80 00       	push   $0x804644
+  803afd:	e8 c1 fc ff ff       	call   8037c3 <_panic>
+
+00803b02 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803b02:	55                   	push   %ebp
+  803b03:	89 e5                	mov    %esp,%ebp
+  803b05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803b08:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803b0d:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803b13:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b19:	8b 52 50             	mov    0x50(%edx),%edx
+  803b1c:	39 ca                	cmp    %ecx,%edx
+  803b1e:	74 11                	je     803b31 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803b20:	83 c0 01             	add    $0x1,%eax
+  803b23:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803b28:	75 e3                	jne    803b0d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2f:	eb 0e                	jmp    803b3f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803b31:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803b37:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b3c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803b3f:	5d                   	pop    %ebp
+  803b40:	c3                   	ret
+
+00803b41 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b41:	55                   	push   %ebp
+  803b42:	89 e5                	mov    %esp,%ebp
+  803b44:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b47:	89 c2                	mov    %eax,%edx
+  803b49:	c1 ea 16             	shr    $0x16,%edx
+  803b4c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803b53:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b58:	f6 c1 01             	test   $0x1,%cl
+  803b5b:	74 1e                	je     803b7b <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803b5d:	c1 e8 0c             	shr    $0xc,%eax
+  803b60:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803b67:	a8 01                	test   $0x1,%al
+  803b69:	74 10                	je     803b7b <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803b6b:	c1 e8 0c             	shr    $0xc,%eax
+  803b6e:	c1 e0 04             	shl    $0x4,%eax
+  803b71:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803b78:	0f b7 d2             	movzwl %dx,%edx
+}
+  803b7b:	89 d0                	mov    %edx,%eax
+  803b7d:	5d                   	pop    %ebp
+  803b7e:	c3                   	ret
+
+00803b7f <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  803b7f:	55                   	push   %ebp
+  803b80:	89 e5                	mov    %esp,%ebp
+  803b82:	57                   	push   %edi
+  803b83:	56                   	push   %esi
+  803b84:	53                   	push   %ebx
+  803b85:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  803b88:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b8b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  803b8e:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  803b91:	bf 38 63 81 00       	mov    $0x816338,%edi
+  803b96:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  803b99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b9e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803ba1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  803ba4:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803ba9:	f6 e2                	mul    %dl
+  803bab:	66 c1 e8 0b          	shr    $0xb,%ax
+  803baf:	89 c7                	mov    %eax,%edi
+  803bb1:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803bb4:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803bb7:	01 db                	add    %ebx,%ebx
+  803bb9:	89 d0                	mov    %edx,%eax
+  803bbb:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  803bbd:	89 d6                	mov    %edx,%esi
+  803bbf:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  803bc1:	89 cb                	mov    %ecx,%ebx
+  803bc3:	83 c1 01             	add    $0x1,%ecx
+  803bc6:	0f b6 fb             	movzbl %bl,%edi
+  803bc9:	83 c0 30             	add    $0x30,%eax
+  803bcc:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  803bd0:	89 f0                	mov    %esi,%eax
+  803bd2:	3c 09                	cmp    $0x9,%al
+  803bd4:	77 ce                	ja     803ba4 <inet_ntoa+0x25>
+  803bd6:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803bd9:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803bdc:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  803bde:	84 c9                	test   %cl,%cl
+  803be0:	74 4d                	je     803c2f <inet_ntoa+0xb0>
+  803be2:	0f b6 db             	movzbl %bl,%ebx
+  803be5:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803be8:	01 d8                	add    %ebx,%eax
+  803bea:	89 f9                	mov    %edi,%ecx
+  803bec:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  803bef:	83 c1 01             	add    $0x1,%ecx
+  803bf2:	0f b6 10             	movzbl (%eax),%edx
+  803bf5:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  803bf8:	89 c2                	mov    %eax,%edx
+  803bfa:	83 e8 01             	sub    $0x1,%eax
+  803bfd:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803c00:	39 da                	cmp    %ebx,%edx
+  803c02:	75 eb                	jne    803bef <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  803c04:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803c07:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  803c0b:	8d 78 01             	lea    0x1(%eax),%edi
+  803c0e:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  803c11:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  803c14:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803c17:	39 ce                	cmp    %ecx,%esi
+  803c19:	0f 85 77 ff ff ff    	jne    803b96 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  803c1f:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  803c22:	b8 38 63 81 00       	mov    $0x816338,%eax
+  803c27:	83 c4 1c             	add    $0x1c,%esp
+  803c2a:	5b                   	pop    %ebx
+  803c2b:	5e                   	pop    %esi
+  803c2c:	5f                   	pop    %edi
+  803c2d:	5d                   	pop    %ebp
+  803c2e:	c3                   	ret
+    while(i--)
+  803c2f:	89 f8                	mov    %edi,%eax
+  803c31:	eb d8                	jmp    803c0b <inet_ntoa+0x8c>
+
+00803c33 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  803c33:	55                   	push   %ebp
+  803c34:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803c36:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803c3a:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  803c3e:	5d                   	pop    %ebp
+  803c3f:	c3                   	ret
+
+00803c40 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  803c40:	55                   	push   %ebp
+  803c41:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803c43:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803c47:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  803c4b:	5d                   	pop    %ebp
+  803c4c:	c3                   	ret
+
+00803c4d <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  803c4d:	55                   	push   %ebp
+  803c4e:	89 e5                	mov    %esp,%ebp
+  803c50:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  803c53:	89 d0                	mov    %edx,%eax
+  803c55:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  803c58:	89 d1                	mov    %edx,%ecx
+  803c5a:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803c5d:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  803c5f:	89 d1                	mov    %edx,%ecx
+  803c61:	c1 e1 08             	shl    $0x8,%ecx
+  803c64:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803c6a:	09 c8                	or     %ecx,%eax
+  803c6c:	c1 ea 08             	shr    $0x8,%edx
+  803c6f:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803c75:	09 d0                	or     %edx,%eax
+}
+  803c77:	5d                   	pop    %ebp
+  803c78:	c3                   	ret
+
+00803c79 <inet_aton>:
+{
+  803c79:	55                   	push   %ebp
+  803c7a:	89 e5                	mov    %esp,%ebp
+  803c7c:	57                   	push   %edi
+  803c7d:	56                   	push   %esi
+  803c7e:	53                   	push   %ebx
+  803c7f:	83 ec 2c             	sub    $0x2c,%esp
+  803c82:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  803c85:	0f b6 0a             	movzbl (%edx),%ecx
+  803c88:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803c8b:	83 e9 30             	sub    $0x30,%ecx
+  803c8e:	80 f9 09             	cmp    $0x9,%cl
+  803c91:	0f 87 b6 01 00 00    	ja     803e4d <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  803c97:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  803c9a:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803c9d:	e9 aa 00 00 00       	jmp    803d4c <inet_aton+0xd3>
+      c = *++cp;
+  803ca2:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  803ca6:	89 c1                	mov    %eax,%ecx
+  803ca8:	83 e1 df             	and    $0xffffffdf,%ecx
+  803cab:	80 f9 58             	cmp    $0x58,%cl
+  803cae:	74 10                	je     803cc0 <inet_aton+0x47>
+      c = *++cp;
+  803cb0:	83 c2 01             	add    $0x1,%edx
+  803cb3:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  803cb6:	bf 08 00 00 00       	mov    $0x8,%edi
+  803cbb:	e9 9a 00 00 00       	jmp    803d5a <inet_aton+0xe1>
+        c = *++cp;
+  803cc0:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803cc4:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  803cc7:	bf 10 00 00 00       	mov    $0x10,%edi
+  803ccc:	e9 89 00 00 00       	jmp    803d5a <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  803cd1:	0f af d7             	imul   %edi,%edx
+  803cd4:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  803cd8:	0f be 01             	movsbl (%ecx),%eax
+  803cdb:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  803cde:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803ce1:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803ce4:	80 fb 09             	cmp    $0x9,%bl
+  803ce7:	76 e8                	jbe    803cd1 <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  803ce9:	83 ff 10             	cmp    $0x10,%edi
+  803cec:	75 2e                	jne    803d1c <inet_aton+0xa3>
+  803cee:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803cf2:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803cf5:	83 e3 df             	and    $0xffffffdf,%ebx
+  803cf8:	83 eb 41             	sub    $0x41,%ebx
+  803cfb:	80 fb 05             	cmp    $0x5,%bl
+  803cfe:	77 1c                	ja     803d1c <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  803d00:	c1 e2 04             	shl    $0x4,%edx
+  803d03:	83 c0 0a             	add    $0xa,%eax
+  803d06:	89 f3                	mov    %esi,%ebx
+  803d08:	80 fb 1a             	cmp    $0x1a,%bl
+  803d0b:	19 db                	sbb    %ebx,%ebx
+  803d0d:	83 e3 20             	and    $0x20,%ebx
+  803d10:	83 c3 41             	add    $0x41,%ebx
+  803d13:	29 d8                	sub    %ebx,%eax
+  803d15:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  803d17:	0f be 01             	movsbl (%ecx),%eax
+  803d1a:	eb bf                	jmp    803cdb <inet_aton+0x62>
+    if (c == '.') {
+  803d1c:	83 f8 2e             	cmp    $0x2e,%eax
+  803d1f:	75 46                	jne    803d67 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  803d21:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803d24:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803d27:	39 f0                	cmp    %esi,%eax
+  803d29:	0f 84 25 01 00 00    	je     803e54 <inet_aton+0x1db>
+      *pp++ = val;
+  803d2f:	83 c0 04             	add    $0x4,%eax
+  803d32:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803d35:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  803d38:	89 ca                	mov    %ecx,%edx
+  803d3a:	0f b6 09             	movzbl (%ecx),%ecx
+  803d3d:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803d40:	83 e9 30             	sub    $0x30,%ecx
+  803d43:	80 f9 09             	cmp    $0x9,%cl
+  803d46:	0f 87 17 01 00 00    	ja     803e63 <inet_aton+0x1ea>
+    base = 10;
+  803d4c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  803d51:	83 f8 30             	cmp    $0x30,%eax
+  803d54:	0f 84 48 ff ff ff    	je     803ca2 <inet_aton+0x29>
+  803d5a:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  803d5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d62:	e9 77 ff ff ff       	jmp    803cde <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803d67:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803d6b:	89 d6                	mov    %edx,%esi
+  803d6d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803d70:	85 c0                	test   %eax,%eax
+  803d72:	74 2e                	je     803da2 <inet_aton+0x129>
+    return (0);
+  803d74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803d79:	89 fa                	mov    %edi,%edx
+  803d7b:	80 fa 1f             	cmp    $0x1f,%dl
+  803d7e:	0f 86 d5 00 00 00    	jbe    803e59 <inet_aton+0x1e0>
+  803d84:	84 c0                	test   %al,%al
+  803d86:	0f 88 cd 00 00 00    	js     803e59 <inet_aton+0x1e0>
+  803d8c:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803d8f:	83 f9 04             	cmp    $0x4,%ecx
+  803d92:	76 0e                	jbe    803da2 <inet_aton+0x129>
+    return (0);
+  803d94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803d99:	83 f8 20             	cmp    $0x20,%eax
+  803d9c:	0f 85 b7 00 00 00    	jne    803e59 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  803da2:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803da5:	89 d8                	mov    %ebx,%eax
+  803da7:	29 c8                	sub    %ecx,%eax
+  803da9:	c1 f8 02             	sar    $0x2,%eax
+  803dac:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  803daf:	83 f8 02             	cmp    $0x2,%eax
+  803db2:	74 7a                	je     803e2e <inet_aton+0x1b5>
+  803db4:	83 f9 03             	cmp    $0x3,%ecx
+  803db7:	7f 49                	jg     803e02 <inet_aton+0x189>
+  803db9:	85 c9                	test   %ecx,%ecx
+  803dbb:	0f 84 98 00 00 00    	je     803e59 <inet_aton+0x1e0>
+  803dc1:	83 f9 02             	cmp    $0x2,%ecx
+  803dc4:	75 19                	jne    803ddf <inet_aton+0x166>
+      return (0);
+  803dc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  803dcb:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803dd1:	0f 87 82 00 00 00    	ja     803e59 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  803dd7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803dda:	c1 e0 18             	shl    $0x18,%eax
+  803ddd:	09 c6                	or     %eax,%esi
+  return (1);
+  803ddf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  803de4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803de8:	74 6f                	je     803e59 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  803dea:	83 ec 0c             	sub    $0xc,%esp
+  803ded:	56                   	push   %esi
+  803dee:	e8 5a fe ff ff       	call   803c4d <htonl>
+  803df3:	83 c4 10             	add    $0x10,%esp
+  803df6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803df9:	89 06                	mov    %eax,(%esi)
+  return (1);
+  803dfb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803e00:	eb 57                	jmp    803e59 <inet_aton+0x1e0>
+  switch (n) {
+  803e02:	83 f9 04             	cmp    $0x4,%ecx
+  803e05:	75 d8                	jne    803ddf <inet_aton+0x166>
+      return (0);
+  803e07:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  803e0c:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803e12:	77 45                	ja     803e59 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  803e14:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803e17:	c1 e0 18             	shl    $0x18,%eax
+  803e1a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803e1d:	c1 e1 10             	shl    $0x10,%ecx
+  803e20:	09 c8                	or     %ecx,%eax
+  803e22:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803e25:	c1 e1 08             	shl    $0x8,%ecx
+  803e28:	09 c8                	or     %ecx,%eax
+  803e2a:	09 c6                	or     %eax,%esi
+    break;
+  803e2c:	eb b1                	jmp    803ddf <inet_aton+0x166>
+      return (0);
+  803e2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  803e33:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803e39:	77 1e                	ja     803e59 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  803e3b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803e3e:	c1 e0 18             	shl    $0x18,%eax
+  803e41:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803e44:	c1 e1 10             	shl    $0x10,%ecx
+  803e47:	09 c8                	or     %ecx,%eax
+  803e49:	09 c6                	or     %eax,%esi
+    break;
+  803e4b:	eb 92                	jmp    803ddf <inet_aton+0x166>
+      return (0);
+  803e4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e52:	eb 05                	jmp    803e59 <inet_aton+0x1e0>
+        return (0);
+  803e54:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  803e59:	89 c8                	mov    %ecx,%eax
+  803e5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e5e:	5b                   	pop    %ebx
+  803e5f:	5e                   	pop    %esi
+  803e60:	5f                   	pop    %edi
+  803e61:	5d                   	pop    %ebp
+  803e62:	c3                   	ret
+      return (0);
+  803e63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e68:	eb ef                	jmp    803e59 <inet_aton+0x1e0>
+
+00803e6a <inet_addr>:
+{
+  803e6a:	55                   	push   %ebp
+  803e6b:	89 e5                	mov    %esp,%ebp
+  803e6d:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  803e70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e73:	50                   	push   %eax
+  803e74:	ff 75 08             	push   0x8(%ebp)
+  803e77:	e8 fd fd ff ff       	call   803c79 <inet_aton>
+  803e7c:	89 c2                	mov    %eax,%edx
+  803e7e:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  803e81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  803e86:	85 d2                	test   %edx,%edx
+  803e88:	75 02                	jne    803e8c <inet_addr+0x22>
+}
+  803e8a:	c9                   	leave
+  803e8b:	c3                   	ret
+    return (val.s_addr);
+  803e8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e8f:	eb f9                	jmp    803e8a <inet_addr+0x20>
+
+00803e91 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  803e91:	55                   	push   %ebp
+  803e92:	89 e5                	mov    %esp,%ebp
+  803e94:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  803e97:	ff 75 08             	push   0x8(%ebp)
+  803e9a:	e8 ae fd ff ff       	call   803c4d <htonl>
+  803e9f:	83 c4 10             	add    $0x10,%esp
+}
+  803ea2:	c9                   	leave
+  803ea3:	c3                   	ret
+
+00803ea4 <__udivdi3>:
+  803ea4:	57                   	push   %edi
+  803ea5:	56                   	push   %esi
+  803ea6:	53                   	push   %ebx
+  803ea7:	83 ec 20             	sub    $0x20,%esp
+  803eaa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803eae:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803eb2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803eb6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803eba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803ebe:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803ec2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803ec6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803eca:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ed9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803ee0:	00 
+  803ee1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ee8:	00 
+  803ee9:	eb 08                	jmp    803ef3 <__udivdi3+0x4f>
+  803eeb:	83 e9 01             	sub    $0x1,%ecx
+  803eee:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803ef1:	74 68                	je     803f5b <__udivdi3+0xb7>
+  803ef3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803ef7:	01 c0                	add    %eax,%eax
+  803ef9:	89 c6                	mov    %eax,%esi
+  803efb:	89 d7                	mov    %edx,%edi
+  803efd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f01:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f05:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f08:	d3 ea                	shr    %cl,%edx
+  803f0a:	f6 c1 20             	test   $0x20,%cl
+  803f0d:	74 04                	je     803f13 <__udivdi3+0x6f>
+  803f0f:	89 d0                	mov    %edx,%eax
+  803f11:	31 d2                	xor    %edx,%edx
+  803f13:	83 e0 01             	and    $0x1,%eax
+  803f16:	89 04 24             	mov    %eax,(%esp)
+  803f19:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f20:	00 
+  803f21:	8b 04 24             	mov    (%esp),%eax
+  803f24:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f28:	09 f0                	or     %esi,%eax
+  803f2a:	09 fa                	or     %edi,%edx
+  803f2c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f30:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f34:	39 f0                	cmp    %esi,%eax
+  803f36:	89 d3                	mov    %edx,%ebx
+  803f38:	19 fb                	sbb    %edi,%ebx
+  803f3a:	72 af                	jb     803eeb <__udivdi3+0x47>
+  803f3c:	29 f0                	sub    %esi,%eax
+  803f3e:	19 fa                	sbb    %edi,%edx
+  803f40:	89 cf                	mov    %ecx,%edi
+  803f42:	c1 ef 05             	shr    $0x5,%edi
+  803f45:	83 e7 01             	and    $0x1,%edi
+  803f48:	89 fe                	mov    %edi,%esi
+  803f4a:	83 f6 01             	xor    $0x1,%esi
+  803f4d:	d3 e6                	shl    %cl,%esi
+  803f4f:	d3 e7                	shl    %cl,%edi
+  803f51:	09 74 24 18          	or     %esi,0x18(%esp)
+  803f55:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803f59:	eb 90                	jmp    803eeb <__udivdi3+0x47>
+  803f5b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f5f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f63:	83 c4 20             	add    $0x20,%esp
+  803f66:	5b                   	pop    %ebx
+  803f67:	5e                   	pop    %esi
+  803f68:	5f                   	pop    %edi
+  803f69:	c3                   	ret
+
+00803f6a <__umoddi3>:
+  803f6a:	57                   	push   %edi
+  803f6b:	56                   	push   %esi
+  803f6c:	53                   	push   %ebx
+  803f6d:	83 ec 08             	sub    $0x8,%esp
+  803f70:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f74:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f78:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803f7c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803f80:	57                   	push   %edi
+  803f81:	56                   	push   %esi
+  803f82:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f86:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f8a:	52                   	push   %edx
+  803f8b:	50                   	push   %eax
+  803f8c:	e8 13 ff ff ff       	call   803ea4 <__udivdi3>
+  803f91:	89 c3                	mov    %eax,%ebx
+  803f93:	0f af d6             	imul   %esi,%edx
+  803f96:	89 f9                	mov    %edi,%ecx
+  803f98:	0f af cb             	imul   %ebx,%ecx
+  803f9b:	01 d1                	add    %edx,%ecx
+  803f9d:	89 d8                	mov    %ebx,%eax
+  803f9f:	f7 e6                	mul    %esi
+  803fa1:	89 c6                	mov    %eax,%esi
+  803fa3:	89 d7                	mov    %edx,%edi
+  803fa5:	01 cf                	add    %ecx,%edi
+  803fa7:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803fab:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803faf:	29 f0                	sub    %esi,%eax
+  803fb1:	19 fa                	sbb    %edi,%edx
+  803fb3:	83 c4 18             	add    $0x18,%esp
+  803fb6:	5b                   	pop    %ebx
+  803fb7:	5e                   	pop    %esi
+  803fb8:	5f                   	pop    %edi
+  803fb9:	c3                   	ret
+
+00803fba <__divdi3>:
+  803fba:	53                   	push   %ebx
+  803fbb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803fbf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803fc3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803fc7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803fcb:	85 d2                	test   %edx,%edx
+  803fcd:	78 12                	js     803fe1 <__divdi3+0x27>
+  803fcf:	85 db                	test   %ebx,%ebx
+  803fd1:	78 2e                	js     804001 <__divdi3+0x47>
+  803fd3:	53                   	push   %ebx
+  803fd4:	51                   	push   %ecx
+  803fd5:	52                   	push   %edx
+  803fd6:	50                   	push   %eax
+  803fd7:	e8 c8 fe ff ff       	call   803ea4 <__udivdi3>
+  803fdc:	83 c4 10             	add    $0x10,%esp
+  803fdf:	eb 1e                	jmp    803fff <__divdi3+0x45>
+  803fe1:	f7 d8                	neg    %eax
+  803fe3:	83 d2 00             	adc    $0x0,%edx
+  803fe6:	f7 da                	neg    %edx
+  803fe8:	85 db                	test   %ebx,%ebx
+  803fea:	78 2a                	js     804016 <__divdi3+0x5c>
+  803fec:	53                   	push   %ebx
+  803fed:	51                   	push   %ecx
+  803fee:	52                   	push   %edx
+  803fef:	50                   	push   %eax
+  803ff0:	e8 af fe ff ff       	call   803ea4 <__udivdi3>
+  803ff5:	83 c4 10             	add    $0x10,%esp
+  803ff8:	f7 d8                	neg    %eax
+  803ffa:	83 d2 00             	adc    $0x0,%edx
+  803ffd:	f7 da                	neg    %edx
+  803fff:	5b                   	pop    %ebx
+  804000:	c3                   	ret
+  804001:	f7 d9                	neg    %ecx
+  804003:	83 d3 00             	adc    $0x0,%ebx
+  804006:	f7 db                	neg    %ebx
+  804008:	53                   	push   %ebx
+  804009:	51                   	push   %ecx
+  80400a:	52                   	push   %edx
+  80400b:	50                   	push   %eax
+  80400c:	e8 93 fe ff ff       	call   803ea4 <__udivdi3>
+  804011:	83 c4 10             	add    $0x10,%esp
+  804014:	eb e2                	jmp    803ff8 <__divdi3+0x3e>
+  804016:	f7 d9                	neg    %ecx
+  804018:	83 d3 00             	adc    $0x0,%ebx
+  80401b:	f7 db                	neg    %ebx
+  80401d:	53                   	push   %ebx
+  80401e:	51                   	push   %ecx
+  80401f:	52                   	push   %edx
+  804020:	50                   	push   %eax
+  804021:	e8 7e fe ff ff       	call   803ea4 <__udivdi3>
+  804026:	83 c4 10             	add    $0x10,%esp
+  804029:	eb d4                	jmp    803fff <__divdi3+0x45>
+
+0080402b <__moddi3>:
+  80402b:	57                   	push   %edi
+  80402c:	56                   	push   %esi
+  80402d:	53                   	push   %ebx
+  80402e:	83 ec 08             	sub    $0x8,%esp
+  804031:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804035:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804039:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80403d:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804041:	57                   	push   %edi
+  804042:	56                   	push   %esi
+  804043:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804047:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80404b:	52                   	push   %edx
+  80404c:	50                   	push   %eax
+  80404d:	e8 68 ff ff ff       	call   803fba <__divdi3>
+  804052:	89 c3                	mov    %eax,%ebx
+  804054:	0f af d6             	imul   %esi,%edx
+  804057:	89 f9                	mov    %edi,%ecx
+  804059:	0f af cb             	imul   %ebx,%ecx
+  80405c:	01 d1                	add    %edx,%ecx
+  80405e:	89 d8                	mov    %ebx,%eax
+  804060:	f7 e6                	mul    %esi
+  804062:	89 c6                	mov    %eax,%esi
+  804064:	89 d7                	mov    %edx,%edi
+  804066:	01 cf                	add    %ecx,%edi
+  804068:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80406c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804070:	29 f0                	sub    %esi,%eax
+  804072:	19 fa                	sbb    %edi,%edx
+  804074:	83 c4 18             	add    $0x18,%esp
+  804077:	5b                   	pop    %ebx
+  804078:	5e                   	pop    %esi
+  804079:	5f                   	pop    %edi
+  80407a:	c3                   	ret
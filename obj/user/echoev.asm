@@ -0,0 +1,8635 @@
+
+obj/user/echoev.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5b 03 00 00       	call   80038c <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+static struct pollfd evs[MAXEV];
+static char buf[2048];
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 00 41 80 00       	push   $0x804100
+  800041:	e8 c8 04 00 00       	call   80050e <cprintf>
+	exit();
+  800046:	e8 ce 03 00 00       	call   800419 <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	57                   	push   %edi
+  800054:	56                   	push   %esi
+  800055:	53                   	push   %ebx
+  800056:	83 ec 60             	sub    $0x60,%esp
+	unsigned int len;
+	uint32_t conns = 0, closed = 0, bytes = 0, waits = 0, events = 0;
+	unsigned start = 0, ms;
+	int s, c, i, n, r;
+
+	binaryname = "echoev";
+  800059:	c7 05 00 50 80 00 04 	movl   $0x804104,0x805000
+  800060:	41 80 00 
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800063:	6a 06                	push   $0x6
+  800065:	6a 01                	push   $0x1
+  800067:	6a 02                	push   $0x2
+  800069:	e8 3d 21 00 00       	call   8021ab <socket>
+  80006e:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	85 c0                	test   %eax,%eax
+  800076:	0f 88 d0 00 00 00    	js     80014c <umain+0xfc>
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+  80007c:	83 ec 04             	sub    $0x4,%esp
+  80007f:	6a 10                	push   $0x10
+  800081:	6a 00                	push   $0x0
+  800083:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800086:	53                   	push   %ebx
+  800087:	e8 f4 0c 00 00       	call   800d80 <memset>
+	addr.sin_family = AF_INET;
+  80008c:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  800090:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800097:	e8 1c 3c 00 00       	call   803cb8 <htonl>
+  80009c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	addr.sin_port = htons(PORT);
+  80009f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8000a6:	e8 f3 3b 00 00       	call   803c9e <htons>
+  8000ab:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  8000af:	83 c4 0c             	add    $0xc,%esp
+  8000b2:	6a 10                	push   $0x10
+  8000b4:	53                   	push   %ebx
+  8000b5:	ff 75 b4             	push   -0x4c(%ebp)
+  8000b8:	e8 4d 1f 00 00       	call   80200a <bind>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	0f 88 93 00 00 00    	js     80015b <umain+0x10b>
+		die("Failed to bind the server socket");
+	if (listen(s, NCONN) < 0)
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 f4 01 00 00       	push   $0x1f4
+  8000d0:	ff 75 b4             	push   -0x4c(%ebp)
+  8000d3:	e8 a1 1f 00 00       	call   802079 <listen>
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	85 c0                	test   %eax,%eax
+  8000dd:	0f 88 87 00 00 00    	js     80016a <umain+0x11a>
+		die("Failed to listen on server socket");
+	if ((r = fcntl(s, F_SETFL, O_NONBLOCK)) < 0
+  8000e3:	83 ec 04             	sub    $0x4,%esp
+  8000e6:	68 00 10 00 00       	push   $0x1000
+  8000eb:	6a 04                	push   $0x4
+  8000ed:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  8000f0:	57                   	push   %edi
+  8000f1:	e8 61 18 00 00       	call   801957 <fcntl>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	78 7c                	js     800179 <umain+0x129>
+	    || (r = evctl(s, POLLIN)) < 0)
+  8000fd:	83 ec 08             	sub    $0x8,%esp
+  800100:	6a 01                	push   $0x1
+  800102:	57                   	push   %edi
+  800103:	e8 63 20 00 00       	call   80216b <evctl>
+  800108:	83 c4 10             	add    $0x10,%esp
+  80010b:	85 c0                	test   %eax,%eax
+  80010d:	78 6a                	js     800179 <umain+0x129>
+		panic("echoev: %e", r);
+	cprintf("echoev: listening\n");
+  80010f:	83 ec 0c             	sub    $0xc,%esp
+  800112:	68 3c 41 80 00       	push   $0x80413c
+  800117:	e8 f2 03 00 00       	call   80050e <cprintf>
+  80011c:	83 c4 10             	add    $0x10,%esp
+	unsigned start = 0, ms;
+  80011f:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+	uint32_t conns = 0, closed = 0, bytes = 0, waits = 0, events = 0;
+  800126:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%ebp)
+  80012d:	c7 45 98 00 00 00 00 	movl   $0x0,-0x68(%ebp)
+  800134:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+  80013b:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+  800142:	bf 00 00 00 00       	mov    $0x0,%edi
+  800147:	e9 ac 01 00 00       	jmp    8002f8 <umain+0x2a8>
+		die("Failed to create socket");
+  80014c:	b8 0b 41 80 00       	mov    $0x80410b,%eax
+  800151:	e8 df fe ff ff       	call   800035 <die>
+  800156:	e9 21 ff ff ff       	jmp    80007c <umain+0x2c>
+		die("Failed to bind the server socket");
+  80015b:	b8 68 41 80 00       	mov    $0x804168,%eax
+  800160:	e8 d0 fe ff ff       	call   800035 <die>
+  800165:	e9 5e ff ff ff       	jmp    8000c8 <umain+0x78>
+		die("Failed to listen on server socket");
+  80016a:	b8 8c 41 80 00       	mov    $0x80418c,%eax
+  80016f:	e8 c1 fe ff ff       	call   800035 <die>
+  800174:	e9 6a ff ff ff       	jmp    8000e3 <umain+0x93>
+		panic("echoev: %e", r);
+  800179:	50                   	push   %eax
+  80017a:	68 23 41 80 00       	push   $0x804123
+  80017f:	6a 3f                	push   $0x3f
+  800181:	68 2e 41 80 00       	push   $0x80412e
+  800186:	e8 a8 02 00 00       	call   800433 <_panic>
+
+	while (closed < NCONN) {
+		if ((n = evwait(evs, MAXEV, -1)) < 0)
+			panic("evwait: %e", n);
+  80018b:	50                   	push   %eax
+  80018c:	68 4f 41 80 00       	push   $0x80414f
+  800191:	6a 44                	push   $0x44
+  800193:	68 2e 41 80 00       	push   $0x80412e
+  800198:	e8 96 02 00 00       	call   800433 <_panic>
+  80019d:	8b 7d a8             	mov    -0x58(%ebp),%edi
+  8001a0:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  8001a3:	89 c6                	mov    %eax,%esi
+  8001a5:	eb 3e                	jmp    8001e5 <umain+0x195>
+					len = sizeof(addr);
+					c = accept(s, (struct sockaddr *) &addr, &len);
+					if (c == -E_AGAIN)
+						break;
+					if (c < 0)
+						panic("accept: %e", c);
+  8001a7:	50                   	push   %eax
+  8001a8:	68 5a 41 80 00       	push   $0x80415a
+  8001ad:	6a 4f                	push   $0x4f
+  8001af:	68 2e 41 80 00       	push   $0x80412e
+  8001b4:	e8 7a 02 00 00       	call   800433 <_panic>
+					if (conns++ == 0)
+						start = sys_time_msec();
+					if ((r = fcntl(c, F_SETFL, O_NONBLOCK)) < 0
+  8001b9:	83 ec 04             	sub    $0x4,%esp
+  8001bc:	68 00 10 00 00       	push   $0x1000
+  8001c1:	6a 04                	push   $0x4
+  8001c3:	53                   	push   %ebx
+  8001c4:	e8 8e 17 00 00       	call   801957 <fcntl>
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	85 c0                	test   %eax,%eax
+  8001ce:	78 4d                	js     80021d <umain+0x1cd>
+					    || (r = evctl(c, POLLIN)) < 0)
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	6a 01                	push   $0x1
+  8001d5:	53                   	push   %ebx
+  8001d6:	e8 90 1f 00 00       	call   80216b <evctl>
+  8001db:	83 c7 01             	add    $0x1,%edi
+  8001de:	83 c4 10             	add    $0x10,%esp
+  8001e1:	85 c0                	test   %eax,%eax
+  8001e3:	78 38                	js     80021d <umain+0x1cd>
+					len = sizeof(addr);
+  8001e5:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+					c = accept(s, (struct sockaddr *) &addr, &len);
+  8001ec:	83 ec 04             	sub    $0x4,%esp
+  8001ef:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  8001f2:	50                   	push   %eax
+  8001f3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8001f6:	50                   	push   %eax
+  8001f7:	56                   	push   %esi
+  8001f8:	e8 cb 1d 00 00       	call   801fc8 <accept>
+  8001fd:	89 c3                	mov    %eax,%ebx
+					if (c == -E_AGAIN)
+  8001ff:	83 c4 10             	add    $0x10,%esp
+  800202:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  800205:	0f 84 bc 00 00 00    	je     8002c7 <umain+0x277>
+					if (c < 0)
+  80020b:	85 c0                	test   %eax,%eax
+  80020d:	78 98                	js     8001a7 <umain+0x157>
+					if (conns++ == 0)
+  80020f:	85 ff                	test   %edi,%edi
+  800211:	75 a6                	jne    8001b9 <umain+0x169>
+						start = sys_time_msec();
+  800213:	e8 75 10 00 00       	call   80128d <sys_time_msec>
+  800218:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  80021b:	eb 9c                	jmp    8001b9 <umain+0x169>
+						panic("echoev: %e", r);
+  80021d:	50                   	push   %eax
+  80021e:	68 23 41 80 00       	push   $0x804123
+  800223:	6a 54                	push   $0x54
+  800225:	68 2e 41 80 00       	push   $0x80412e
+  80022a:	e8 04 02 00 00       	call   800433 <_panic>
+			sys_yield();
+  80022f:	e8 e6 0d 00 00       	call   80101a <sys_yield>
+			continue;
+  800234:	eb 0e                	jmp    800244 <umain+0x1f4>
+			die("Failed to send bytes to client");
+  800236:	b8 b0 41 80 00       	mov    $0x8041b0,%eax
+  80023b:	e8 f5 fd ff ff       	call   800035 <die>
+		p += r;
+  800240:	01 df                	add    %ebx,%edi
+		n -= r;
+  800242:	29 de                	sub    %ebx,%esi
+	while (n > 0) {
+  800244:	85 f6                	test   %esi,%esi
+  800246:	7e 1d                	jle    800265 <umain+0x215>
+		if ((r = write(fd, p, n)) == -E_AGAIN) {
+  800248:	83 ec 04             	sub    $0x4,%esp
+  80024b:	56                   	push   %esi
+  80024c:	57                   	push   %edi
+  80024d:	ff 75 c4             	push   -0x3c(%ebp)
+  800250:	e8 3a 16 00 00       	call   80188f <write>
+  800255:	89 c3                	mov    %eax,%ebx
+  800257:	83 c4 10             	add    $0x10,%esp
+  80025a:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80025d:	74 d0                	je     80022f <umain+0x1df>
+		if (r <= 0)
+  80025f:	85 c0                	test   %eax,%eax
+  800261:	7f dd                	jg     800240 <umain+0x1f0>
+  800263:	eb d1                	jmp    800236 <umain+0x1e6>
+				continue;
+			}
+			// Edge-triggered: drain the socket.
+			while ((r = read(evs[i].fd, buf, sizeof(buf))) > 0) {
+				echo(evs[i].fd, buf, r);
+				bytes += r;
+  800265:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  800268:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  80026b:	01 45 b8             	add    %eax,-0x48(%ebp)
+			while ((r = read(evs[i].fd, buf, sizeof(buf))) > 0) {
+  80026e:	83 ec 04             	sub    $0x4,%esp
+  800271:	68 00 08 00 00       	push   $0x800
+  800276:	68 00 60 80 00       	push   $0x806000
+  80027b:	ff 34 dd 00 68 80 00 	push   0x806800(,%ebx,8)
+  800282:	e8 10 15 00 00       	call   801797 <read>
+  800287:	83 c4 10             	add    $0x10,%esp
+  80028a:	85 c0                	test   %eax,%eax
+  80028c:	7e 19                	jle    8002a7 <umain+0x257>
+				echo(evs[i].fd, buf, r);
+  80028e:	8b 0c dd 00 68 80 00 	mov    0x806800(,%ebx,8),%ecx
+  800295:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+			while ((r = read(evs[i].fd, buf, sizeof(buf))) > 0) {
+  800298:	89 c6                	mov    %eax,%esi
+				echo(evs[i].fd, buf, r);
+  80029a:	bf 00 60 80 00       	mov    $0x806000,%edi
+  80029f:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+  8002a2:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  8002a5:	eb a1                	jmp    800248 <umain+0x1f8>
+			}
+			if (r != -E_AGAIN) {
+  8002a7:	8b 75 b0             	mov    -0x50(%ebp),%esi
+  8002aa:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8002ad:	74 1e                	je     8002cd <umain+0x27d>
+				close(evs[i].fd);
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	ff 34 dd 00 68 80 00 	push   0x806800(,%ebx,8)
+  8002b9:	e8 9a 13 00 00       	call   801658 <close>
+				closed++;
+  8002be:	83 45 a0 01          	addl   $0x1,-0x60(%ebp)
+  8002c2:	83 c4 10             	add    $0x10,%esp
+  8002c5:	eb 06                	jmp    8002cd <umain+0x27d>
+  8002c7:	89 7d a8             	mov    %edi,-0x58(%ebp)
+  8002ca:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+		for (i = 0; i < n; i++) {
+  8002cd:	83 c6 01             	add    $0x1,%esi
+  8002d0:	39 75 ac             	cmp    %esi,-0x54(%ebp)
+  8002d3:	74 17                	je     8002ec <umain+0x29c>
+			if (evs[i].fd == s) {
+  8002d5:	89 f3                	mov    %esi,%ebx
+  8002d7:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  8002da:	39 04 f5 00 68 80 00 	cmp    %eax,0x806800(,%esi,8)
+  8002e1:	0f 84 b6 fe ff ff    	je     80019d <umain+0x14d>
+  8002e7:	89 75 b0             	mov    %esi,-0x50(%ebp)
+  8002ea:	eb 82                	jmp    80026e <umain+0x21e>
+  8002ec:	8b 7d a8             	mov    -0x58(%ebp),%edi
+	while (closed < NCONN) {
+  8002ef:	81 7d a0 f3 01 00 00 	cmpl   $0x1f3,-0x60(%ebp)
+  8002f6:	77 3a                	ja     800332 <umain+0x2e2>
+		if ((n = evwait(evs, MAXEV, -1)) < 0)
+  8002f8:	83 ec 04             	sub    $0x4,%esp
+  8002fb:	6a ff                	push   $0xffffffff
+  8002fd:	68 00 02 00 00       	push   $0x200
+  800302:	68 00 68 80 00       	push   $0x806800
+  800307:	e8 89 1e 00 00       	call   802195 <evwait>
+  80030c:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  80030f:	83 c4 10             	add    $0x10,%esp
+  800312:	85 c0                	test   %eax,%eax
+  800314:	0f 88 71 fe ff ff    	js     80018b <umain+0x13b>
+		waits++;
+  80031a:	83 45 98 01          	addl   $0x1,-0x68(%ebp)
+		events += n;
+  80031e:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  800321:	01 4d 9c             	add    %ecx,-0x64(%ebp)
+		for (i = 0; i < n; i++) {
+  800324:	85 c9                	test   %ecx,%ecx
+  800326:	7e c7                	jle    8002ef <umain+0x29f>
+  800328:	be 00 00 00 00       	mov    $0x0,%esi
+					c = accept(s, (struct sockaddr *) &addr, &len);
+  80032d:	89 7d a8             	mov    %edi,-0x58(%ebp)
+  800330:	eb a3                	jmp    8002d5 <umain+0x285>
+			}
+		}
+	}
+	ms = sys_time_msec() - start;
+  800332:	e8 56 0f 00 00       	call   80128d <sys_time_msec>
+  800337:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+  80033a:	29 c8                	sub    %ecx,%eax
+  80033c:	89 c3                	mov    %eax,%ebx
+	close(s);
+  80033e:	83 ec 0c             	sub    $0xc,%esp
+  800341:	ff 75 b4             	push   -0x4c(%ebp)
+  800344:	e8 0f 13 00 00       	call   801658 <close>
+
+	cprintf("echoev: %u connections, %u bytes in %u ms\n",
+  800349:	53                   	push   %ebx
+  80034a:	ff 75 b8             	push   -0x48(%ebp)
+  80034d:	57                   	push   %edi
+  80034e:	68 d0 41 80 00       	push   $0x8041d0
+  800353:	e8 b6 01 00 00       	call   80050e <cprintf>
+		conns, bytes, ms);
+	cprintf("echoev: %u events in %u waits, %u per wait\n",
+  800358:	83 c4 20             	add    $0x20,%esp
+  80035b:	8b 7d 98             	mov    -0x68(%ebp),%edi
+  80035e:	85 ff                	test   %edi,%edi
+  800360:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800365:	0f 45 cf             	cmovne %edi,%ecx
+  800368:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  80036b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800370:	f7 f1                	div    %ecx
+  800372:	50                   	push   %eax
+  800373:	57                   	push   %edi
+  800374:	ff 75 9c             	push   -0x64(%ebp)
+  800377:	68 fc 41 80 00       	push   $0x8041fc
+  80037c:	e8 8d 01 00 00       	call   80050e <cprintf>
+		events, waits, events / (waits ? waits : 1));
+}
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800387:	5b                   	pop    %ebx
+  800388:	5e                   	pop    %esi
+  800389:	5f                   	pop    %edi
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+
+0080038c <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80038c:	55                   	push   %ebp
+  80038d:	89 e5                	mov    %esp,%ebp
+  80038f:	56                   	push   %esi
+  800390:	53                   	push   %ebx
+  800391:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800394:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800397:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800399:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80039e:	29 d0                	sub    %edx,%eax
+  8003a0:	89 c2                	mov    %eax,%edx
+  8003a2:	c1 ea 0f             	shr    $0xf,%edx
+  8003a5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8003b2:	c7 04 85 60 7b 80 00 	movl   $0x0,0x807b60(,%eax,4)
+  8003b9:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8003bd:	e8 39 0c 00 00       	call   800ffb <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8003c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003c7:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8003cd:	89 e1                	mov    %esp,%ecx
+  8003cf:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8003d4:	29 ca                	sub    %ecx,%edx
+  8003d6:	89 d1                	mov    %edx,%ecx
+  8003d8:	c1 e9 0f             	shr    $0xf,%ecx
+  8003db:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8003e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e6:	0f 42 d1             	cmovb  %ecx,%edx
+  8003e9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003ee:	89 04 95 60 7b 80 00 	mov    %eax,0x807b60(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003f5:	85 db                	test   %ebx,%ebx
+  8003f7:	7e 07                	jle    800400 <libmain+0x74>
+		binaryname = argv[0];
+  8003f9:	8b 06                	mov    (%esi),%eax
+  8003fb:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800400:	83 ec 08             	sub    $0x8,%esp
+  800403:	56                   	push   %esi
+  800404:	53                   	push   %ebx
+  800405:	e8 46 fc ff ff       	call   800050 <umain>
+
+	// exit gracefully
+	exit();
+  80040a:	e8 0a 00 00 00       	call   800419 <exit>
+}
+  80040f:	83 c4 10             	add    $0x10,%esp
+  800412:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800415:	5b                   	pop    %ebx
+  800416:	5e                   	pop    %esi
+  800417:	5d                   	pop    %ebp
+  800418:	c3                   	ret
+
+00800419 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800419:	55                   	push   %ebp
+  80041a:	89 e5                	mov    %esp,%ebp
+  80041c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80041f:	e8 61 12 00 00       	call   801685 <close_all>
+	sys_env_destroy(0);
+  800424:	83 ec 0c             	sub    $0xc,%esp
+  800427:	6a 00                	push   $0x0
+  800429:	e8 8c 0b 00 00       	call   800fba <sys_env_destroy>
+}
+  80042e:	83 c4 10             	add    $0x10,%esp
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	56                   	push   %esi
+  800437:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800438:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80043b:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800441:	e8 b5 0b 00 00       	call   800ffb <sys_getenvid>
+  800446:	83 ec 0c             	sub    $0xc,%esp
+  800449:	ff 75 0c             	push   0xc(%ebp)
+  80044c:	ff 75 08             	push   0x8(%ebp)
+  80044f:	56                   	push   %esi
+  800450:	50                   	push   %eax
+  800451:	68 34 42 80 00       	push   $0x804234
+  800456:	e8 b3 00 00 00       	call   80050e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80045b:	83 c4 18             	add    $0x18,%esp
+  80045e:	53                   	push   %ebx
+  80045f:	ff 75 10             	push   0x10(%ebp)
+  800462:	e8 56 00 00 00       	call   8004bd <vcprintf>
+	cprintf("\n");
+  800467:	c7 04 24 b0 46 80 00 	movl   $0x8046b0,(%esp)
+  80046e:	e8 9b 00 00 00       	call   80050e <cprintf>
+  800473:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800476:	cc                   	int3
+	while (1)
+  800477:	eb fd                	jmp    800476 <_panic+0x43>
+
+00800479 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800479:	55                   	push   %ebp
+  80047a:	89 e5                	mov    %esp,%ebp
+  80047c:	53                   	push   %ebx
+  80047d:	83 ec 04             	sub    $0x4,%esp
+  800480:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800483:	8b 13                	mov    (%ebx),%edx
+  800485:	8d 42 01             	lea    0x1(%edx),%eax
+  800488:	89 03                	mov    %eax,(%ebx)
+  80048a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80048d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800491:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800496:	74 09                	je     8004a1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800498:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80049c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80049f:	c9                   	leave
+  8004a0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+  8004a4:	68 ff 00 00 00       	push   $0xff
+  8004a9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004ac:	50                   	push   %eax
+  8004ad:	e8 cb 0a 00 00       	call   800f7d <sys_cputs>
+		b->idx = 0;
+  8004b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004b8:	83 c4 10             	add    $0x10,%esp
+  8004bb:	eb db                	jmp    800498 <putch+0x1f>
+
+008004bd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004bd:	55                   	push   %ebp
+  8004be:	89 e5                	mov    %esp,%ebp
+  8004c0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004c6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004cd:	00 00 00 
+	b.cnt = 0;
+  8004d0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004d7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004da:	ff 75 0c             	push   0xc(%ebp)
+  8004dd:	ff 75 08             	push   0x8(%ebp)
+  8004e0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004e6:	50                   	push   %eax
+  8004e7:	68 79 04 80 00       	push   $0x800479
+  8004ec:	e8 1c 01 00 00       	call   80060d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004f1:	83 c4 08             	add    $0x8,%esp
+  8004f4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004fa:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800500:	50                   	push   %eax
+  800501:	e8 77 0a 00 00       	call   800f7d <sys_cputs>
+
+	return b.cnt;
+}
+  800506:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+
+0080050e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80050e:	55                   	push   %ebp
+  80050f:	89 e5                	mov    %esp,%ebp
+  800511:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800514:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800517:	50                   	push   %eax
+  800518:	ff 75 08             	push   0x8(%ebp)
+  80051b:	e8 9d ff ff ff       	call   8004bd <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800520:	c9                   	leave
+  800521:	c3                   	ret
+
+00800522 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800522:	55                   	push   %ebp
+  800523:	89 e5                	mov    %esp,%ebp
+  800525:	57                   	push   %edi
+  800526:	56                   	push   %esi
+  800527:	53                   	push   %ebx
+  800528:	83 ec 1c             	sub    $0x1c,%esp
+  80052b:	89 c3                	mov    %eax,%ebx
+  80052d:	89 d6                	mov    %edx,%esi
+  80052f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800532:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800535:	89 d1                	mov    %edx,%ecx
+  800537:	89 c2                	mov    %eax,%edx
+  800539:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80053f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800542:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800545:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80054c:	39 c2                	cmp    %eax,%edx
+  80054e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800551:	73 4b                	jae    80059e <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800553:	8b 45 14             	mov    0x14(%ebp),%eax
+  800556:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800559:	85 ff                	test   %edi,%edi
+  80055b:	7e 11                	jle    80056e <printnum+0x4c>
+			putch(padc, putdat);
+  80055d:	83 ec 08             	sub    $0x8,%esp
+  800560:	56                   	push   %esi
+  800561:	ff 75 18             	push   0x18(%ebp)
+  800564:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800566:	83 c4 10             	add    $0x10,%esp
+  800569:	83 ef 01             	sub    $0x1,%edi
+  80056c:	75 ef                	jne    80055d <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80056e:	83 ec 08             	sub    $0x8,%esp
+  800571:	56                   	push   %esi
+  800572:	83 ec 04             	sub    $0x4,%esp
+  800575:	ff 75 e4             	push   -0x1c(%ebp)
+  800578:	ff 75 e0             	push   -0x20(%ebp)
+  80057b:	ff 75 dc             	push   -0x24(%ebp)
+  80057e:	ff 75 d8             	push   -0x28(%ebp)
+  800581:	e8 4f 3a 00 00       	call   803fd5 <__umoddi3>
+  800586:	83 c4 14             	add    $0x14,%esp
+  800589:	0f be 80 57 42 80 00 	movsbl 0x804257(%eax),%eax
+  800590:	50                   	push   %eax
+  800591:	ff d3                	call   *%ebx
+}
+  800593:	83 c4 10             	add    $0x10,%esp
+  800596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800599:	5b                   	pop    %ebx
+  80059a:	5e                   	pop    %esi
+  80059b:	5f                   	pop    %edi
+  80059c:	5d                   	pop    %ebp
+  80059d:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80059e:	83 ec 0c             	sub    $0xc,%esp
+  8005a1:	ff 75 18             	push   0x18(%ebp)
+  8005a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005a7:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8005aa:	52                   	push   %edx
+  8005ab:	50                   	push   %eax
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	ff 75 e4             	push   -0x1c(%ebp)
+  8005b2:	ff 75 e0             	push   -0x20(%ebp)
+  8005b5:	ff 75 dc             	push   -0x24(%ebp)
+  8005b8:	ff 75 d8             	push   -0x28(%ebp)
+  8005bb:	e8 4f 39 00 00       	call   803f0f <__udivdi3>
+  8005c0:	83 c4 18             	add    $0x18,%esp
+  8005c3:	52                   	push   %edx
+  8005c4:	50                   	push   %eax
+  8005c5:	89 f2                	mov    %esi,%edx
+  8005c7:	89 d8                	mov    %ebx,%eax
+  8005c9:	e8 54 ff ff ff       	call   800522 <printnum>
+  8005ce:	83 c4 20             	add    $0x20,%esp
+  8005d1:	eb 9b                	jmp    80056e <printnum+0x4c>
+
+008005d3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005d3:	55                   	push   %ebp
+  8005d4:	89 e5                	mov    %esp,%ebp
+  8005d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005d9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005dd:	8b 10                	mov    (%eax),%edx
+  8005df:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005e2:	73 0a                	jae    8005ee <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005e4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005e7:	89 08                	mov    %ecx,(%eax)
+  8005e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005ec:	88 02                	mov    %al,(%edx)
+}
+  8005ee:	5d                   	pop    %ebp
+  8005ef:	c3                   	ret
+
+008005f0 <printfmt>:
+{
+  8005f0:	55                   	push   %ebp
+  8005f1:	89 e5                	mov    %esp,%ebp
+  8005f3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005f6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005f9:	50                   	push   %eax
+  8005fa:	ff 75 10             	push   0x10(%ebp)
+  8005fd:	ff 75 0c             	push   0xc(%ebp)
+  800600:	ff 75 08             	push   0x8(%ebp)
+  800603:	e8 05 00 00 00       	call   80060d <vprintfmt>
+}
+  800608:	83 c4 10             	add    $0x10,%esp
+  80060b:	c9                   	leave
+  80060c:	c3                   	ret
+
+0080060d <vprintfmt>:
+{
+  80060d:	55                   	push   %ebp
+  80060e:	89 e5                	mov    %esp,%ebp
+  800610:	57                   	push   %edi
+  800611:	56                   	push   %esi
+  800612:	53                   	push   %ebx
+  800613:	83 ec 2c             	sub    $0x2c,%esp
+  800616:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800619:	89 df                	mov    %ebx,%edi
+  80061b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80061e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800621:	8d 70 01             	lea    0x1(%eax),%esi
+  800624:	0f b6 00             	movzbl (%eax),%eax
+  800627:	83 f8 25             	cmp    $0x25,%eax
+  80062a:	74 1e                	je     80064a <vprintfmt+0x3d>
+			if (ch == '\0')
+  80062c:	85 c0                	test   %eax,%eax
+  80062e:	0f 84 15 05 00 00    	je     800b49 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800634:	83 ec 08             	sub    $0x8,%esp
+  800637:	53                   	push   %ebx
+  800638:	50                   	push   %eax
+  800639:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80063b:	83 c6 01             	add    $0x1,%esi
+  80063e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800642:	83 c4 10             	add    $0x10,%esp
+  800645:	83 f8 25             	cmp    $0x25,%eax
+  800648:	75 e2                	jne    80062c <vprintfmt+0x1f>
+		padc = ' ';
+  80064a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80064e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800655:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80065c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800663:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800668:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80066b:	8d 56 01             	lea    0x1(%esi),%edx
+  80066e:	0f b6 0e             	movzbl (%esi),%ecx
+  800671:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800674:	3c 55                	cmp    $0x55,%al
+  800676:	0f 87 3b 04 00 00    	ja     800ab7 <vprintfmt+0x4aa>
+  80067c:	0f b6 c0             	movzbl %al,%eax
+  80067f:	ff 24 85 c0 43 80 00 	jmp    *0x8043c0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800686:	89 75 10             	mov    %esi,0x10(%ebp)
+  800689:	eb 93                	jmp    80061e <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80068b:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80068d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800691:	eb d8                	jmp    80066b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800693:	89 d6                	mov    %edx,%esi
+  800695:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800699:	eb d0                	jmp    80066b <vprintfmt+0x5e>
+  80069b:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80069e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8006a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8006a4:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8006a8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006ab:	83 f9 09             	cmp    $0x9,%ecx
+  8006ae:	77 6f                	ja     80071f <vprintfmt+0x112>
+  8006b0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8006b3:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8006b6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8006b9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8006bd:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8006c0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8006c3:	83 fe 09             	cmp    $0x9,%esi
+  8006c6:	76 eb                	jbe    8006b3 <vprintfmt+0xa6>
+  8006c8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8006cb:	89 d6                	mov    %edx,%esi
+  8006cd:	eb 13                	jmp    8006e2 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8006cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d2:	8b 00                	mov    (%eax),%eax
+  8006d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8d 40 04             	lea    0x4(%eax),%eax
+  8006dd:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006e0:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8006e2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006e6:	79 83                	jns    80066b <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8006e8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ee:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8006f5:	e9 71 ff ff ff       	jmp    80066b <vprintfmt+0x5e>
+			if (width < 0)
+  8006fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006fd:	85 c9                	test   %ecx,%ecx
+  8006ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800704:	0f 49 c1             	cmovns %ecx,%eax
+  800707:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80070a:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80070c:	e9 5a ff ff ff       	jmp    80066b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800711:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800713:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80071a:	e9 4c ff ff ff       	jmp    80066b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80071f:	89 d6                	mov    %edx,%esi
+  800721:	eb bf                	jmp    8006e2 <vprintfmt+0xd5>
+			lflag++;
+  800723:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800727:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800729:	e9 3d ff ff ff       	jmp    80066b <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80072e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8d 70 04             	lea    0x4(%eax),%esi
+  800737:	83 ec 08             	sub    $0x8,%esp
+  80073a:	53                   	push   %ebx
+  80073b:	ff 30                	push   (%eax)
+  80073d:	ff d7                	call   *%edi
+			break;
+  80073f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800742:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800745:	e9 d4 fe ff ff       	jmp    80061e <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80074a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	89 d0                	mov    %edx,%eax
+  800757:	f7 d8                	neg    %eax
+  800759:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80075c:	83 f8 12             	cmp    $0x12,%eax
+  80075f:	7f 23                	jg     800784 <vprintfmt+0x177>
+  800761:	8b 14 85 20 45 80 00 	mov    0x804520(,%eax,4),%edx
+  800768:	85 d2                	test   %edx,%edx
+  80076a:	74 18                	je     800784 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80076c:	52                   	push   %edx
+  80076d:	68 7b 46 80 00       	push   $0x80467b
+  800772:	53                   	push   %ebx
+  800773:	57                   	push   %edi
+  800774:	e8 77 fe ff ff       	call   8005f0 <printfmt>
+  800779:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80077c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80077f:	e9 9a fe ff ff       	jmp    80061e <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800784:	50                   	push   %eax
+  800785:	68 6f 42 80 00       	push   $0x80426f
+  80078a:	53                   	push   %ebx
+  80078b:	57                   	push   %edi
+  80078c:	e8 5f fe ff ff       	call   8005f0 <printfmt>
+  800791:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800794:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800797:	e9 82 fe ff ff       	jmp    80061e <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80079c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80079f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a2:	83 c0 04             	add    $0x4,%eax
+  8007a5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ab:	8b 00                	mov    (%eax),%eax
+  8007ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007b0:	85 c0                	test   %eax,%eax
+  8007b2:	0f 84 61 03 00 00    	je     800b19 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8007b8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007bc:	7e 06                	jle    8007c4 <vprintfmt+0x1b7>
+  8007be:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007c2:	75 29                	jne    8007ed <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007c7:	8d 70 01             	lea    0x1(%eax),%esi
+  8007ca:	0f b6 00             	movzbl (%eax),%eax
+  8007cd:	0f be d0             	movsbl %al,%edx
+  8007d0:	85 d2                	test   %edx,%edx
+  8007d2:	0f 84 bb 00 00 00    	je     800893 <vprintfmt+0x286>
+  8007d8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007db:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007de:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007e1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007e4:	eb 7a                	jmp    800860 <vprintfmt+0x253>
+				p = "(null)";
+  8007e6:	c7 45 d0 68 42 80 00 	movl   $0x804268,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007ed:	83 ec 08             	sub    $0x8,%esp
+  8007f0:	ff 75 d4             	push   -0x2c(%ebp)
+  8007f3:	ff 75 d0             	push   -0x30(%ebp)
+  8007f6:	e8 e0 03 00 00       	call   800bdb <strnlen>
+  8007fb:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8007fe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800801:	83 c4 10             	add    $0x10,%esp
+  800804:	85 d2                	test   %edx,%edx
+  800806:	0f 8e d6 02 00 00    	jle    800ae2 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80080c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800810:	83 ec 08             	sub    $0x8,%esp
+  800813:	53                   	push   %ebx
+  800814:	56                   	push   %esi
+  800815:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800817:	83 c4 10             	add    $0x10,%esp
+  80081a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80081e:	75 f0                	jne    800810 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800820:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800823:	8d 70 01             	lea    0x1(%eax),%esi
+  800826:	0f b6 00             	movzbl (%eax),%eax
+  800829:	0f be d0             	movsbl %al,%edx
+  80082c:	85 d2                	test   %edx,%edx
+  80082e:	0f 84 da 02 00 00    	je     800b0e <vprintfmt+0x501>
+  800834:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800837:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80083a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80083d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800840:	eb 1e                	jmp    800860 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800842:	83 ec 08             	sub    $0x8,%esp
+  800845:	ff 75 0c             	push   0xc(%ebp)
+  800848:	52                   	push   %edx
+  800849:	ff 55 08             	call   *0x8(%ebp)
+  80084c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80084f:	83 eb 01             	sub    $0x1,%ebx
+  800852:	83 c6 01             	add    $0x1,%esi
+  800855:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800859:	0f be d0             	movsbl %al,%edx
+  80085c:	85 d2                	test   %edx,%edx
+  80085e:	74 2a                	je     80088a <vprintfmt+0x27d>
+  800860:	85 ff                	test   %edi,%edi
+  800862:	78 05                	js     800869 <vprintfmt+0x25c>
+  800864:	83 ef 01             	sub    $0x1,%edi
+  800867:	78 59                	js     8008c2 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800869:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80086d:	74 d3                	je     800842 <vprintfmt+0x235>
+  80086f:	0f be c0             	movsbl %al,%eax
+  800872:	83 e8 20             	sub    $0x20,%eax
+  800875:	83 f8 5e             	cmp    $0x5e,%eax
+  800878:	76 c8                	jbe    800842 <vprintfmt+0x235>
+					putch('?', putdat);
+  80087a:	83 ec 08             	sub    $0x8,%esp
+  80087d:	ff 75 0c             	push   0xc(%ebp)
+  800880:	6a 3f                	push   $0x3f
+  800882:	ff 55 08             	call   *0x8(%ebp)
+  800885:	83 c4 10             	add    $0x10,%esp
+  800888:	eb c5                	jmp    80084f <vprintfmt+0x242>
+  80088a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80088d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800890:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800893:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800896:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80089a:	7e 1b                	jle    8008b7 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80089c:	83 ec 08             	sub    $0x8,%esp
+  80089f:	53                   	push   %ebx
+  8008a0:	6a 20                	push   $0x20
+  8008a2:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8008a4:	83 c4 10             	add    $0x10,%esp
+  8008a7:	83 ee 01             	sub    $0x1,%esi
+  8008aa:	75 f0                	jne    80089c <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008ac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b2:	e9 67 fd ff ff       	jmp    80061e <vprintfmt+0x11>
+  8008b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008bd:	e9 5c fd ff ff       	jmp    80061e <vprintfmt+0x11>
+  8008c2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8008c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008cb:	eb c6                	jmp    800893 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8008cd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008d0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008d3:	83 f9 01             	cmp    $0x1,%ecx
+  8008d6:	7f 1f                	jg     8008f7 <vprintfmt+0x2ea>
+	else if (lflag)
+  8008d8:	85 c9                	test   %ecx,%ecx
+  8008da:	74 67                	je     800943 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8008dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008df:	8b 30                	mov    (%eax),%esi
+  8008e1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008e4:	89 f0                	mov    %esi,%eax
+  8008e6:	c1 f8 1f             	sar    $0x1f,%eax
+  8008e9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f5:	eb 17                	jmp    80090e <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8008f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fa:	8b 50 04             	mov    0x4(%eax),%edx
+  8008fd:	8b 00                	mov    (%eax),%eax
+  8008ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800902:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800905:	8b 45 14             	mov    0x14(%ebp),%eax
+  800908:	8d 40 08             	lea    0x8(%eax),%eax
+  80090b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80090e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800911:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800914:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800919:	85 c9                	test   %ecx,%ecx
+  80091b:	0f 89 12 01 00 00    	jns    800a33 <vprintfmt+0x426>
+				putch('-', putdat);
+  800921:	83 ec 08             	sub    $0x8,%esp
+  800924:	53                   	push   %ebx
+  800925:	6a 2d                	push   $0x2d
+  800927:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800929:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80092c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80092f:	f7 da                	neg    %edx
+  800931:	83 d1 00             	adc    $0x0,%ecx
+  800934:	f7 d9                	neg    %ecx
+  800936:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800939:	be 0a 00 00 00       	mov    $0xa,%esi
+  80093e:	e9 f0 00 00 00       	jmp    800a33 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800943:	8b 45 14             	mov    0x14(%ebp),%eax
+  800946:	8b 30                	mov    (%eax),%esi
+  800948:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80094b:	89 f0                	mov    %esi,%eax
+  80094d:	c1 f8 1f             	sar    $0x1f,%eax
+  800950:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800953:	8b 45 14             	mov    0x14(%ebp),%eax
+  800956:	8d 40 04             	lea    0x4(%eax),%eax
+  800959:	89 45 14             	mov    %eax,0x14(%ebp)
+  80095c:	eb b0                	jmp    80090e <vprintfmt+0x301>
+	if (lflag >= 2)
+  80095e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800961:	89 55 10             	mov    %edx,0x10(%ebp)
+  800964:	83 f9 01             	cmp    $0x1,%ecx
+  800967:	7f 1e                	jg     800987 <vprintfmt+0x37a>
+	else if (lflag)
+  800969:	85 c9                	test   %ecx,%ecx
+  80096b:	74 32                	je     80099f <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80096d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800970:	8b 10                	mov    (%eax),%edx
+  800972:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800977:	8d 40 04             	lea    0x4(%eax),%eax
+  80097a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80097d:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800982:	e9 ac 00 00 00       	jmp    800a33 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800987:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098a:	8b 10                	mov    (%eax),%edx
+  80098c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80098f:	8d 40 08             	lea    0x8(%eax),%eax
+  800992:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800995:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80099a:	e9 94 00 00 00       	jmp    800a33 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80099f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a2:	8b 10                	mov    (%eax),%edx
+  8009a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009af:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8009b4:	eb 7d                	jmp    800a33 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8009b6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009b9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009bc:	83 f9 01             	cmp    $0x1,%ecx
+  8009bf:	7f 1b                	jg     8009dc <vprintfmt+0x3cf>
+	else if (lflag)
+  8009c1:	85 c9                	test   %ecx,%ecx
+  8009c3:	74 2c                	je     8009f1 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8009c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c8:	8b 10                	mov    (%eax),%edx
+  8009ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009d5:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8009da:	eb 57                	jmp    800a33 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009df:	8b 10                	mov    (%eax),%edx
+  8009e1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009ea:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8009ef:	eb 42                	jmp    800a33 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f4:	8b 10                	mov    (%eax),%edx
+  8009f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a01:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800a06:	eb 2b                	jmp    800a33 <vprintfmt+0x426>
+			putch('0', putdat);
+  800a08:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a0b:	83 ec 08             	sub    $0x8,%esp
+  800a0e:	53                   	push   %ebx
+  800a0f:	6a 30                	push   $0x30
+  800a11:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800a13:	83 c4 08             	add    $0x8,%esp
+  800a16:	53                   	push   %ebx
+  800a17:	6a 78                	push   $0x78
+  800a19:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1e:	8b 10                	mov    (%eax),%edx
+  800a20:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a25:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a28:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a2e:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800a33:	83 ec 0c             	sub    $0xc,%esp
+  800a36:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800a3a:	50                   	push   %eax
+  800a3b:	ff 75 e4             	push   -0x1c(%ebp)
+  800a3e:	56                   	push   %esi
+  800a3f:	51                   	push   %ecx
+  800a40:	52                   	push   %edx
+  800a41:	89 da                	mov    %ebx,%edx
+  800a43:	89 f8                	mov    %edi,%eax
+  800a45:	e8 d8 fa ff ff       	call   800522 <printnum>
+			break;
+  800a4a:	83 c4 20             	add    $0x20,%esp
+  800a4d:	e9 cc fb ff ff       	jmp    80061e <vprintfmt+0x11>
+	if (lflag >= 2)
+  800a52:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a55:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a58:	83 f9 01             	cmp    $0x1,%ecx
+  800a5b:	7f 1b                	jg     800a78 <vprintfmt+0x46b>
+	else if (lflag)
+  800a5d:	85 c9                	test   %ecx,%ecx
+  800a5f:	74 2c                	je     800a8d <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800a61:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a64:	8b 10                	mov    (%eax),%edx
+  800a66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a6b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a71:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800a76:	eb bb                	jmp    800a33 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a78:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7b:	8b 10                	mov    (%eax),%edx
+  800a7d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a80:	8d 40 08             	lea    0x8(%eax),%eax
+  800a83:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a86:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800a8b:	eb a6                	jmp    800a33 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a90:	8b 10                	mov    (%eax),%edx
+  800a92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a97:	8d 40 04             	lea    0x4(%eax),%eax
+  800a9a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a9d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800aa2:	eb 8f                	jmp    800a33 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800aa4:	89 55 10             	mov    %edx,0x10(%ebp)
+  800aa7:	83 ec 08             	sub    $0x8,%esp
+  800aaa:	53                   	push   %ebx
+  800aab:	6a 25                	push   $0x25
+  800aad:	ff d7                	call   *%edi
+			break;
+  800aaf:	83 c4 10             	add    $0x10,%esp
+  800ab2:	e9 67 fb ff ff       	jmp    80061e <vprintfmt+0x11>
+			putch('%', putdat);
+  800ab7:	83 ec 08             	sub    $0x8,%esp
+  800aba:	53                   	push   %ebx
+  800abb:	6a 25                	push   $0x25
+  800abd:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800abf:	83 c4 10             	add    $0x10,%esp
+  800ac2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800ac6:	0f 84 ba fb ff ff    	je     800686 <vprintfmt+0x79>
+  800acc:	89 75 10             	mov    %esi,0x10(%ebp)
+  800acf:	89 f0                	mov    %esi,%eax
+  800ad1:	83 e8 01             	sub    $0x1,%eax
+  800ad4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800ad8:	75 f7                	jne    800ad1 <vprintfmt+0x4c4>
+  800ada:	89 45 10             	mov    %eax,0x10(%ebp)
+  800add:	e9 3c fb ff ff       	jmp    80061e <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ae2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ae5:	8d 70 01             	lea    0x1(%eax),%esi
+  800ae8:	0f b6 00             	movzbl (%eax),%eax
+  800aeb:	0f be d0             	movsbl %al,%edx
+  800aee:	85 d2                	test   %edx,%edx
+  800af0:	74 11                	je     800b03 <vprintfmt+0x4f6>
+  800af2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800af5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800af8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800afb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800afe:	e9 5d fd ff ff       	jmp    800860 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b03:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b06:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b09:	e9 10 fb ff ff       	jmp    80061e <vprintfmt+0x11>
+  800b0e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b11:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b14:	e9 05 fb ff ff       	jmp    80061e <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800b19:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b1d:	7e 0a                	jle    800b29 <vprintfmt+0x51c>
+  800b1f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800b23:	0f 85 bd fc ff ff    	jne    8007e6 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b29:	ba 28 00 00 00       	mov    $0x28,%edx
+  800b2e:	b8 28 00 00 00       	mov    $0x28,%eax
+  800b33:	be 69 42 80 00       	mov    $0x804269,%esi
+  800b38:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b3b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b3e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b41:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b44:	e9 17 fd ff ff       	jmp    800860 <vprintfmt+0x253>
+}
+  800b49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b4c:	5b                   	pop    %ebx
+  800b4d:	5e                   	pop    %esi
+  800b4e:	5f                   	pop    %edi
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+
+00800b51 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	83 ec 18             	sub    $0x18,%esp
+  800b57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b5d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b60:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b64:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b67:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b6e:	85 c0                	test   %eax,%eax
+  800b70:	74 26                	je     800b98 <vsnprintf+0x47>
+  800b72:	85 d2                	test   %edx,%edx
+  800b74:	7e 22                	jle    800b98 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b76:	ff 75 14             	push   0x14(%ebp)
+  800b79:	ff 75 10             	push   0x10(%ebp)
+  800b7c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b7f:	50                   	push   %eax
+  800b80:	68 d3 05 80 00       	push   $0x8005d3
+  800b85:	e8 83 fa ff ff       	call   80060d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b8a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b8d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b93:	83 c4 10             	add    $0x10,%esp
+}
+  800b96:	c9                   	leave
+  800b97:	c3                   	ret
+		return -E_INVAL;
+  800b98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b9d:	eb f7                	jmp    800b96 <vsnprintf+0x45>
+
+00800b9f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ba5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ba8:	50                   	push   %eax
+  800ba9:	ff 75 10             	push   0x10(%ebp)
+  800bac:	ff 75 0c             	push   0xc(%ebp)
+  800baf:	ff 75 08             	push   0x8(%ebp)
+  800bb2:	e8 9a ff ff ff       	call   800b51 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800bb7:	c9                   	leave
+  800bb8:	c3                   	ret
+
+00800bb9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bbf:	80 3a 00             	cmpb   $0x0,(%edx)
+  800bc2:	74 10                	je     800bd4 <strlen+0x1b>
+  800bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800bc9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bcc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bd0:	75 f7                	jne    800bc9 <strlen+0x10>
+	return n;
+}
+  800bd2:	5d                   	pop    %ebp
+  800bd3:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800bd9:	eb f7                	jmp    800bd2 <strlen+0x19>
+
+00800bdb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bdb:	55                   	push   %ebp
+  800bdc:	89 e5                	mov    %esp,%ebp
+  800bde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800be1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800be4:	85 d2                	test   %edx,%edx
+  800be6:	74 16                	je     800bfe <strnlen+0x23>
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bed:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bf1:	74 09                	je     800bfc <strnlen+0x21>
+		n++;
+  800bf3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bf6:	39 d0                	cmp    %edx,%eax
+  800bf8:	75 f3                	jne    800bed <strnlen+0x12>
+		n++;
+  800bfa:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c03:	eb f7                	jmp    800bfc <strnlen+0x21>
+
+00800c05 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	53                   	push   %ebx
+  800c09:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c14:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c18:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c1b:	83 c0 01             	add    $0x1,%eax
+  800c1e:	84 d2                	test   %dl,%dl
+  800c20:	75 f2                	jne    800c14 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c22:	89 c8                	mov    %ecx,%eax
+  800c24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c27:	c9                   	leave
+  800c28:	c3                   	ret
+
+00800c29 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c29:	55                   	push   %ebp
+  800c2a:	89 e5                	mov    %esp,%ebp
+  800c2c:	53                   	push   %ebx
+  800c2d:	83 ec 10             	sub    $0x10,%esp
+  800c30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c33:	53                   	push   %ebx
+  800c34:	e8 80 ff ff ff       	call   800bb9 <strlen>
+  800c39:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c3c:	ff 75 0c             	push   0xc(%ebp)
+  800c3f:	01 d8                	add    %ebx,%eax
+  800c41:	50                   	push   %eax
+  800c42:	e8 be ff ff ff       	call   800c05 <strcpy>
+	return dst;
+}
+  800c47:	89 d8                	mov    %ebx,%eax
+  800c49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c4c:	c9                   	leave
+  800c4d:	c3                   	ret
+
+00800c4e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	56                   	push   %esi
+  800c52:	53                   	push   %ebx
+  800c53:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c5c:	85 db                	test   %ebx,%ebx
+  800c5e:	74 17                	je     800c77 <strncpy+0x29>
+  800c60:	01 f3                	add    %esi,%ebx
+  800c62:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800c64:	83 c0 01             	add    $0x1,%eax
+  800c67:	0f b6 0a             	movzbl (%edx),%ecx
+  800c6a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c6d:	80 f9 01             	cmp    $0x1,%cl
+  800c70:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c73:	39 c3                	cmp    %eax,%ebx
+  800c75:	75 ed                	jne    800c64 <strncpy+0x16>
+	}
+	return ret;
+}
+  800c77:	89 f0                	mov    %esi,%eax
+  800c79:	5b                   	pop    %ebx
+  800c7a:	5e                   	pop    %esi
+  800c7b:	5d                   	pop    %ebp
+  800c7c:	c3                   	ret
+
+00800c7d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c7d:	55                   	push   %ebp
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	56                   	push   %esi
+  800c81:	53                   	push   %ebx
+  800c82:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c8b:	89 f0                	mov    %esi,%eax
+  800c8d:	85 db                	test   %ebx,%ebx
+  800c8f:	74 1e                	je     800caf <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800c91:	83 eb 01             	sub    $0x1,%ebx
+  800c94:	74 16                	je     800cac <strlcpy+0x2f>
+  800c96:	01 f3                	add    %esi,%ebx
+  800c98:	0f b6 0a             	movzbl (%edx),%ecx
+  800c9b:	84 c9                	test   %cl,%cl
+  800c9d:	74 0d                	je     800cac <strlcpy+0x2f>
+			*dst++ = *src++;
+  800c9f:	83 c2 01             	add    $0x1,%edx
+  800ca2:	83 c0 01             	add    $0x1,%eax
+  800ca5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ca8:	39 d8                	cmp    %ebx,%eax
+  800caa:	75 ec                	jne    800c98 <strlcpy+0x1b>
+		*dst = '\0';
+  800cac:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800caf:	29 f0                	sub    %esi,%eax
+}
+  800cb1:	5b                   	pop    %ebx
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+
+00800cb5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800cbe:	0f b6 01             	movzbl (%ecx),%eax
+  800cc1:	84 c0                	test   %al,%al
+  800cc3:	74 11                	je     800cd6 <strcmp+0x21>
+  800cc5:	38 02                	cmp    %al,(%edx)
+  800cc7:	75 0d                	jne    800cd6 <strcmp+0x21>
+		p++, q++;
+  800cc9:	83 c1 01             	add    $0x1,%ecx
+  800ccc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ccf:	0f b6 01             	movzbl (%ecx),%eax
+  800cd2:	84 c0                	test   %al,%al
+  800cd4:	75 ef                	jne    800cc5 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cd6:	0f b6 c0             	movzbl %al,%eax
+  800cd9:	0f b6 12             	movzbl (%edx),%edx
+  800cdc:	29 d0                	sub    %edx,%eax
+}
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+
+00800ce0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	53                   	push   %ebx
+  800ce4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ce7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cea:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800ced:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800cf2:	85 d2                	test   %edx,%edx
+  800cf4:	74 2e                	je     800d24 <strncmp+0x44>
+  800cf6:	0f b6 01             	movzbl (%ecx),%eax
+  800cf9:	84 c0                	test   %al,%al
+  800cfb:	74 16                	je     800d13 <strncmp+0x33>
+  800cfd:	3a 03                	cmp    (%ebx),%al
+  800cff:	75 12                	jne    800d13 <strncmp+0x33>
+		n--, p++, q++;
+  800d01:	83 c1 01             	add    $0x1,%ecx
+  800d04:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800d07:	83 ea 01             	sub    $0x1,%edx
+  800d0a:	75 ea                	jne    800cf6 <strncmp+0x16>
+		return 0;
+  800d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d11:	eb 11                	jmp    800d24 <strncmp+0x44>
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800d18:	85 d2                	test   %edx,%edx
+  800d1a:	74 08                	je     800d24 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d1c:	0f b6 01             	movzbl (%ecx),%eax
+  800d1f:	0f b6 13             	movzbl (%ebx),%edx
+  800d22:	29 d0                	sub    %edx,%eax
+}
+  800d24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d27:	c9                   	leave
+  800d28:	c3                   	ret
+
+00800d29 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d33:	0f b6 10             	movzbl (%eax),%edx
+  800d36:	84 d2                	test   %dl,%dl
+  800d38:	74 15                	je     800d4f <strchr+0x26>
+		if (*s == c)
+  800d3a:	38 d1                	cmp    %dl,%cl
+  800d3c:	74 0f                	je     800d4d <strchr+0x24>
+	for (; *s; s++)
+  800d3e:	83 c0 01             	add    $0x1,%eax
+  800d41:	0f b6 10             	movzbl (%eax),%edx
+  800d44:	84 d2                	test   %dl,%dl
+  800d46:	75 f2                	jne    800d3a <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800d48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+	return 0;
+  800d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d54:	eb f7                	jmp    800d4d <strchr+0x24>
+
+00800d56 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	53                   	push   %ebx
+  800d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800d60:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800d63:	38 d3                	cmp    %dl,%bl
+  800d65:	74 14                	je     800d7b <strfind+0x25>
+  800d67:	89 d1                	mov    %edx,%ecx
+  800d69:	84 db                	test   %bl,%bl
+  800d6b:	74 0e                	je     800d7b <strfind+0x25>
+	for (; *s; s++)
+  800d6d:	83 c0 01             	add    $0x1,%eax
+  800d70:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d73:	38 ca                	cmp    %cl,%dl
+  800d75:	74 04                	je     800d7b <strfind+0x25>
+  800d77:	84 d2                	test   %dl,%dl
+  800d79:	75 f2                	jne    800d6d <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800d7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d7e:	c9                   	leave
+  800d7f:	c3                   	ret
+
+00800d80 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d8a:	85 c9                	test   %ecx,%ecx
+  800d8c:	74 20                	je     800dae <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d8e:	89 f8                	mov    %edi,%eax
+  800d90:	09 c8                	or     %ecx,%eax
+  800d92:	a8 03                	test   $0x3,%al
+  800d94:	75 12                	jne    800da8 <memset+0x28>
+		c &= 0xFF;
+  800d96:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d9a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800da0:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800da3:	fc                   	cld
+  800da4:	f3 ab                	rep stos %eax,%es:(%edi)
+  800da6:	eb 06                	jmp    800dae <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800da8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dab:	fc                   	cld
+  800dac:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800dae:	89 f8                	mov    %edi,%eax
+  800db0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800db3:	c9                   	leave
+  800db4:	c3                   	ret
+
+00800db5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	57                   	push   %edi
+  800db9:	56                   	push   %esi
+  800dba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dbd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800dc0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800dc3:	39 c6                	cmp    %eax,%esi
+  800dc5:	73 32                	jae    800df9 <memmove+0x44>
+  800dc7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800dca:	39 d0                	cmp    %edx,%eax
+  800dcc:	73 2b                	jae    800df9 <memmove+0x44>
+		s += n;
+		d += n;
+  800dce:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dd1:	89 d6                	mov    %edx,%esi
+  800dd3:	09 fe                	or     %edi,%esi
+  800dd5:	09 ce                	or     %ecx,%esi
+  800dd7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ddd:	75 0e                	jne    800ded <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ddf:	83 ef 04             	sub    $0x4,%edi
+  800de2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800de5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800de8:	fd                   	std
+  800de9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800deb:	eb 09                	jmp    800df6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ded:	83 ef 01             	sub    $0x1,%edi
+  800df0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800df3:	fd                   	std
+  800df4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800df6:	fc                   	cld
+  800df7:	eb 1a                	jmp    800e13 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800df9:	89 f2                	mov    %esi,%edx
+  800dfb:	09 c2                	or     %eax,%edx
+  800dfd:	09 ca                	or     %ecx,%edx
+  800dff:	f6 c2 03             	test   $0x3,%dl
+  800e02:	75 0a                	jne    800e0e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e04:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e07:	89 c7                	mov    %eax,%edi
+  800e09:	fc                   	cld
+  800e0a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e0c:	eb 05                	jmp    800e13 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e0e:	89 c7                	mov    %eax,%edi
+  800e10:	fc                   	cld
+  800e11:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+
+00800e17 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e1d:	ff 75 10             	push   0x10(%ebp)
+  800e20:	ff 75 0c             	push   0xc(%ebp)
+  800e23:	ff 75 08             	push   0x8(%ebp)
+  800e26:	e8 8a ff ff ff       	call   800db5 <memmove>
+}
+  800e2b:	c9                   	leave
+  800e2c:	c3                   	ret
+
+00800e2d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+  800e32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e38:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e3b:	85 f6                	test   %esi,%esi
+  800e3d:	74 29                	je     800e68 <memcmp+0x3b>
+  800e3f:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800e41:	0f b6 08             	movzbl (%eax),%ecx
+  800e44:	0f b6 1a             	movzbl (%edx),%ebx
+  800e47:	38 d9                	cmp    %bl,%cl
+  800e49:	75 11                	jne    800e5c <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e4b:	83 c0 01             	add    $0x1,%eax
+  800e4e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e51:	39 c6                	cmp    %eax,%esi
+  800e53:	75 ec                	jne    800e41 <memcmp+0x14>
+	}
+
+	return 0;
+  800e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5a:	eb 08                	jmp    800e64 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800e5c:	0f b6 c1             	movzbl %cl,%eax
+  800e5f:	0f b6 db             	movzbl %bl,%ebx
+  800e62:	29 d8                	sub    %ebx,%eax
+}
+  800e64:	5b                   	pop    %ebx
+  800e65:	5e                   	pop    %esi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+	return 0;
+  800e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6d:	eb f5                	jmp    800e64 <memcmp+0x37>
+
+00800e6f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e78:	89 c2                	mov    %eax,%edx
+  800e7a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e7d:	39 d0                	cmp    %edx,%eax
+  800e7f:	73 0d                	jae    800e8e <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e81:	38 08                	cmp    %cl,(%eax)
+  800e83:	74 0d                	je     800e92 <memfind+0x23>
+	for (; s < ends; s++)
+  800e85:	83 c0 01             	add    $0x1,%eax
+  800e88:	39 c2                	cmp    %eax,%edx
+  800e8a:	75 f5                	jne    800e81 <memfind+0x12>
+  800e8c:	eb 06                	jmp    800e94 <memfind+0x25>
+  800e8e:	89 c2                	mov    %eax,%edx
+  800e90:	eb 02                	jmp    800e94 <memfind+0x25>
+  800e92:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800e94:	89 d0                	mov    %edx,%eax
+  800e96:	5d                   	pop    %ebp
+  800e97:	c3                   	ret
+
+00800e98 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	57                   	push   %edi
+  800e9c:	56                   	push   %esi
+  800e9d:	53                   	push   %ebx
+  800e9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ea4:	0f b6 02             	movzbl (%edx),%eax
+  800ea7:	3c 20                	cmp    $0x20,%al
+  800ea9:	74 04                	je     800eaf <strtol+0x17>
+  800eab:	3c 09                	cmp    $0x9,%al
+  800ead:	75 0e                	jne    800ebd <strtol+0x25>
+		s++;
+  800eaf:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800eb2:	0f b6 02             	movzbl (%edx),%eax
+  800eb5:	3c 20                	cmp    $0x20,%al
+  800eb7:	74 f6                	je     800eaf <strtol+0x17>
+  800eb9:	3c 09                	cmp    $0x9,%al
+  800ebb:	74 f2                	je     800eaf <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ebd:	3c 2b                	cmp    $0x2b,%al
+  800ebf:	74 2a                	je     800eeb <strtol+0x53>
+	int neg = 0;
+  800ec1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ec6:	3c 2d                	cmp    $0x2d,%al
+  800ec8:	74 2b                	je     800ef5 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eca:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ed0:	75 0f                	jne    800ee1 <strtol+0x49>
+  800ed2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ed5:	74 28                	je     800eff <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ed7:	85 db                	test   %ebx,%ebx
+  800ed9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ede:	0f 44 d8             	cmove  %eax,%ebx
+  800ee1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ee9:	eb 46                	jmp    800f31 <strtol+0x99>
+		s++;
+  800eeb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800eee:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef3:	eb d5                	jmp    800eca <strtol+0x32>
+		s++, neg = 1;
+  800ef5:	83 c2 01             	add    $0x1,%edx
+  800ef8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800efd:	eb cb                	jmp    800eca <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eff:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f03:	74 0e                	je     800f13 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800f05:	85 db                	test   %ebx,%ebx
+  800f07:	75 d8                	jne    800ee1 <strtol+0x49>
+		s++, base = 8;
+  800f09:	83 c2 01             	add    $0x1,%edx
+  800f0c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f11:	eb ce                	jmp    800ee1 <strtol+0x49>
+		s += 2, base = 16;
+  800f13:	83 c2 02             	add    $0x2,%edx
+  800f16:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f1b:	eb c4                	jmp    800ee1 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f1d:	0f be c0             	movsbl %al,%eax
+  800f20:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800f23:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f26:	7d 3a                	jge    800f62 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800f28:	83 c2 01             	add    $0x1,%edx
+  800f2b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f2f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800f31:	0f b6 02             	movzbl (%edx),%eax
+  800f34:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f37:	89 f3                	mov    %esi,%ebx
+  800f39:	80 fb 09             	cmp    $0x9,%bl
+  800f3c:	76 df                	jbe    800f1d <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800f3e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f41:	89 f3                	mov    %esi,%ebx
+  800f43:	80 fb 19             	cmp    $0x19,%bl
+  800f46:	77 08                	ja     800f50 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800f48:	0f be c0             	movsbl %al,%eax
+  800f4b:	83 e8 57             	sub    $0x57,%eax
+  800f4e:	eb d3                	jmp    800f23 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f50:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f53:	89 f3                	mov    %esi,%ebx
+  800f55:	80 fb 19             	cmp    $0x19,%bl
+  800f58:	77 08                	ja     800f62 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800f5a:	0f be c0             	movsbl %al,%eax
+  800f5d:	83 e8 37             	sub    $0x37,%eax
+  800f60:	eb c1                	jmp    800f23 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f62:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f66:	74 05                	je     800f6d <strtol+0xd5>
+		*endptr = (char *) s;
+  800f68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f6b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f6d:	89 c8                	mov    %ecx,%eax
+  800f6f:	f7 d8                	neg    %eax
+  800f71:	85 ff                	test   %edi,%edi
+  800f73:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f76:	89 c8                	mov    %ecx,%eax
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+
+00800f7d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f7d:	55                   	push   %ebp
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	57                   	push   %edi
+  800f81:	56                   	push   %esi
+  800f82:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8e:	89 c3                	mov    %eax,%ebx
+  800f90:	89 c7                	mov    %eax,%edi
+  800f92:	89 c6                	mov    %eax,%esi
+  800f94:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fab:	89 d1                	mov    %edx,%ecx
+  800fad:	89 d3                	mov    %edx,%ebx
+  800faf:	89 d7                	mov    %edx,%edi
+  800fb1:	89 d6                	mov    %edx,%esi
+  800fb3:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+
+00800fba <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+  800fc0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fd0:	89 cb                	mov    %ecx,%ebx
+  800fd2:	89 cf                	mov    %ecx,%edi
+  800fd4:	89 ce                	mov    %ecx,%esi
+  800fd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 08                	jg     800fe4 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe4:	83 ec 0c             	sub    $0xc,%esp
+  800fe7:	50                   	push   %eax
+  800fe8:	6a 03                	push   $0x3
+  800fea:	68 8b 45 80 00       	push   $0x80458b
+  800fef:	6a 23                	push   $0x23
+  800ff1:	68 a8 45 80 00       	push   $0x8045a8
+  800ff6:	e8 38 f4 ff ff       	call   800433 <_panic>
+
+00800ffb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	57                   	push   %edi
+  800fff:	56                   	push   %esi
+  801000:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801001:	ba 00 00 00 00       	mov    $0x0,%edx
+  801006:	b8 02 00 00 00       	mov    $0x2,%eax
+  80100b:	89 d1                	mov    %edx,%ecx
+  80100d:	89 d3                	mov    %edx,%ebx
+  80100f:	89 d7                	mov    %edx,%edi
+  801011:	89 d6                	mov    %edx,%esi
+  801013:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801015:	5b                   	pop    %ebx
+  801016:	5e                   	pop    %esi
+  801017:	5f                   	pop    %edi
+  801018:	5d                   	pop    %ebp
+  801019:	c3                   	ret
+
+0080101a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80101a:	55                   	push   %ebp
+  80101b:	89 e5                	mov    %esp,%ebp
+  80101d:	57                   	push   %edi
+  80101e:	56                   	push   %esi
+  80101f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801020:	ba 00 00 00 00       	mov    $0x0,%edx
+  801025:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80102a:	89 d1                	mov    %edx,%ecx
+  80102c:	89 d3                	mov    %edx,%ebx
+  80102e:	89 d7                	mov    %edx,%edi
+  801030:	89 d6                	mov    %edx,%esi
+  801032:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801034:	5b                   	pop    %ebx
+  801035:	5e                   	pop    %esi
+  801036:	5f                   	pop    %edi
+  801037:	5d                   	pop    %ebp
+  801038:	c3                   	ret
+
+00801039 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	57                   	push   %edi
+  80103d:	56                   	push   %esi
+  80103e:	53                   	push   %ebx
+  80103f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801042:	be 00 00 00 00       	mov    $0x0,%esi
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801052:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801055:	89 f7                	mov    %esi,%edi
+  801057:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801059:	85 c0                	test   %eax,%eax
+  80105b:	7f 08                	jg     801065 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80105d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801060:	5b                   	pop    %ebx
+  801061:	5e                   	pop    %esi
+  801062:	5f                   	pop    %edi
+  801063:	5d                   	pop    %ebp
+  801064:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801065:	83 ec 0c             	sub    $0xc,%esp
+  801068:	50                   	push   %eax
+  801069:	6a 04                	push   $0x4
+  80106b:	68 8b 45 80 00       	push   $0x80458b
+  801070:	6a 23                	push   $0x23
+  801072:	68 a8 45 80 00       	push   $0x8045a8
+  801077:	e8 b7 f3 ff ff       	call   800433 <_panic>
+
+0080107c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80107c:	55                   	push   %ebp
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	57                   	push   %edi
+  801080:	56                   	push   %esi
+  801081:	53                   	push   %ebx
+  801082:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801090:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801093:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801096:	8b 75 18             	mov    0x18(%ebp),%esi
+  801099:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109b:	85 c0                	test   %eax,%eax
+  80109d:	7f 08                	jg     8010a7 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80109f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a2:	5b                   	pop    %ebx
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	50                   	push   %eax
+  8010ab:	6a 05                	push   $0x5
+  8010ad:	68 8b 45 80 00       	push   $0x80458b
+  8010b2:	6a 23                	push   $0x23
+  8010b4:	68 a8 45 80 00       	push   $0x8045a8
+  8010b9:	e8 75 f3 ff ff       	call   800433 <_panic>
+
+008010be <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	56                   	push   %esi
+  8010c3:	53                   	push   %ebx
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010d7:	89 df                	mov    %ebx,%edi
+  8010d9:	89 de                	mov    %ebx,%esi
+  8010db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010dd:	85 c0                	test   %eax,%eax
+  8010df:	7f 08                	jg     8010e9 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e4:	5b                   	pop    %ebx
+  8010e5:	5e                   	pop    %esi
+  8010e6:	5f                   	pop    %edi
+  8010e7:	5d                   	pop    %ebp
+  8010e8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  8010ec:	50                   	push   %eax
+  8010ed:	6a 06                	push   $0x6
+  8010ef:	68 8b 45 80 00       	push   $0x80458b
+  8010f4:	6a 23                	push   $0x23
+  8010f6:	68 a8 45 80 00       	push   $0x8045a8
+  8010fb:	e8 33 f3 ff ff       	call   800433 <_panic>
+
+00801100 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	57                   	push   %edi
+  801104:	56                   	push   %esi
+  801105:	53                   	push   %ebx
+  801106:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801109:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801111:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801114:	b8 08 00 00 00       	mov    $0x8,%eax
+  801119:	89 df                	mov    %ebx,%edi
+  80111b:	89 de                	mov    %ebx,%esi
+  80111d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111f:	85 c0                	test   %eax,%eax
+  801121:	7f 08                	jg     80112b <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801123:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801126:	5b                   	pop    %ebx
+  801127:	5e                   	pop    %esi
+  801128:	5f                   	pop    %edi
+  801129:	5d                   	pop    %ebp
+  80112a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	50                   	push   %eax
+  80112f:	6a 08                	push   $0x8
+  801131:	68 8b 45 80 00       	push   $0x80458b
+  801136:	6a 23                	push   $0x23
+  801138:	68 a8 45 80 00       	push   $0x8045a8
+  80113d:	e8 f1 f2 ff ff       	call   800433 <_panic>
+
+00801142 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	57                   	push   %edi
+  801146:	56                   	push   %esi
+  801147:	53                   	push   %ebx
+  801148:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80114b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801150:	8b 55 08             	mov    0x8(%ebp),%edx
+  801153:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801156:	b8 09 00 00 00       	mov    $0x9,%eax
+  80115b:	89 df                	mov    %ebx,%edi
+  80115d:	89 de                	mov    %ebx,%esi
+  80115f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801161:	85 c0                	test   %eax,%eax
+  801163:	7f 08                	jg     80116d <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801165:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801168:	5b                   	pop    %ebx
+  801169:	5e                   	pop    %esi
+  80116a:	5f                   	pop    %edi
+  80116b:	5d                   	pop    %ebp
+  80116c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80116d:	83 ec 0c             	sub    $0xc,%esp
+  801170:	50                   	push   %eax
+  801171:	6a 09                	push   $0x9
+  801173:	68 8b 45 80 00       	push   $0x80458b
+  801178:	6a 23                	push   $0x23
+  80117a:	68 a8 45 80 00       	push   $0x8045a8
+  80117f:	e8 af f2 ff ff       	call   800433 <_panic>
+
+00801184 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	57                   	push   %edi
+  801188:	56                   	push   %esi
+  801189:	53                   	push   %ebx
+  80118a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80118d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+  801195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801198:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80119d:	89 df                	mov    %ebx,%edi
+  80119f:	89 de                	mov    %ebx,%esi
+  8011a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a3:	85 c0                	test   %eax,%eax
+  8011a5:	7f 08                	jg     8011af <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011aa:	5b                   	pop    %ebx
+  8011ab:	5e                   	pop    %esi
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011af:	83 ec 0c             	sub    $0xc,%esp
+  8011b2:	50                   	push   %eax
+  8011b3:	6a 0a                	push   $0xa
+  8011b5:	68 8b 45 80 00       	push   $0x80458b
+  8011ba:	6a 23                	push   $0x23
+  8011bc:	68 a8 45 80 00       	push   $0x8045a8
+  8011c1:	e8 6d f2 ff ff       	call   800433 <_panic>
+
+008011c6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	57                   	push   %edi
+  8011ca:	56                   	push   %esi
+  8011cb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+
+008011e9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ff:	89 cb                	mov    %ecx,%ebx
+  801201:	89 cf                	mov    %ecx,%edi
+  801203:	89 ce                	mov    %ecx,%esi
+  801205:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801207:	85 c0                	test   %eax,%eax
+  801209:	7f 08                	jg     801213 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80120b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120e:	5b                   	pop    %ebx
+  80120f:	5e                   	pop    %esi
+  801210:	5f                   	pop    %edi
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801213:	83 ec 0c             	sub    $0xc,%esp
+  801216:	50                   	push   %eax
+  801217:	6a 0d                	push   $0xd
+  801219:	68 8b 45 80 00       	push   $0x80458b
+  80121e:	6a 23                	push   $0x23
+  801220:	68 a8 45 80 00       	push   $0x8045a8
+  801225:	e8 09 f2 ff ff       	call   800433 <_panic>
+
+0080122a <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	57                   	push   %edi
+  80122e:	56                   	push   %esi
+  80122f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801230:	8b 55 08             	mov    0x8(%ebp),%edx
+  801233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801236:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80123b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801241:	8b 75 18             	mov    0x18(%ebp),%esi
+  801244:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+
+0080124b <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+  801251:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801264:	89 df                	mov    %ebx,%edi
+  801266:	89 de                	mov    %ebx,%esi
+  801268:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80126a:	85 c0                	test   %eax,%eax
+  80126c:	7f 08                	jg     801276 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80126e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801271:	5b                   	pop    %ebx
+  801272:	5e                   	pop    %esi
+  801273:	5f                   	pop    %edi
+  801274:	5d                   	pop    %ebp
+  801275:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801276:	83 ec 0c             	sub    $0xc,%esp
+  801279:	50                   	push   %eax
+  80127a:	6a 0d                	push   $0xd
+  80127c:	68 8b 45 80 00       	push   $0x80458b
+  801281:	6a 23                	push   $0x23
+  801283:	68 a8 45 80 00       	push   $0x8045a8
+  801288:	e8 a6 f1 ff ff       	call   800433 <_panic>
+
+0080128d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	57                   	push   %edi
+  801291:	56                   	push   %esi
+  801292:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801293:	ba 00 00 00 00       	mov    $0x0,%edx
+  801298:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80129d:	89 d1                	mov    %edx,%ecx
+  80129f:	89 d3                	mov    %edx,%ebx
+  8012a1:	89 d7                	mov    %edx,%edi
+  8012a3:	89 d6                	mov    %edx,%esi
+  8012a5:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+
+008012ac <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012c2:	89 df                	mov    %ebx,%edi
+  8012c4:	89 de                	mov    %ebx,%esi
+  8012c6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8012c8:	5b                   	pop    %ebx
+  8012c9:	5e                   	pop    %esi
+  8012ca:	5f                   	pop    %edi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	c3                   	ret
+
+008012cd <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	57                   	push   %edi
+  8012d1:	56                   	push   %esi
+  8012d2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012e0:	89 cb                	mov    %ecx,%ebx
+  8012e2:	89 cf                	mov    %ecx,%edi
+  8012e4:	89 ce                	mov    %ecx,%esi
+  8012e6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8012e8:	5b                   	pop    %ebx
+  8012e9:	5e                   	pop    %esi
+  8012ea:	5f                   	pop    %edi
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+
+008012ed <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8012ed:	55                   	push   %ebp
+  8012ee:	89 e5                	mov    %esp,%ebp
+  8012f0:	57                   	push   %edi
+  8012f1:	56                   	push   %esi
+  8012f2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fe:	b8 11 00 00 00       	mov    $0x11,%eax
+  801303:	89 df                	mov    %ebx,%edi
+  801305:	89 de                	mov    %ebx,%esi
+  801307:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5f                   	pop    %edi
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+
+0080130e <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	57                   	push   %edi
+  801312:	56                   	push   %esi
+  801313:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801314:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801319:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801324:	89 df                	mov    %ebx,%edi
+  801326:	89 de                	mov    %ebx,%esi
+  801328:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80132a:	5b                   	pop    %ebx
+  80132b:	5e                   	pop    %esi
+  80132c:	5f                   	pop    %edi
+  80132d:	5d                   	pop    %ebp
+  80132e:	c3                   	ret
+
+0080132f <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	57                   	push   %edi
+  801333:	56                   	push   %esi
+  801334:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801335:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801342:	89 cb                	mov    %ecx,%ebx
+  801344:	89 cf                	mov    %ecx,%edi
+  801346:	89 ce                	mov    %ecx,%esi
+  801348:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80134a:	5b                   	pop    %ebx
+  80134b:	5e                   	pop    %esi
+  80134c:	5f                   	pop    %edi
+  80134d:	5d                   	pop    %ebp
+  80134e:	c3                   	ret
+
+0080134f <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80134f:	55                   	push   %ebp
+  801350:	89 e5                	mov    %esp,%ebp
+  801352:	57                   	push   %edi
+  801353:	56                   	push   %esi
+  801354:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801355:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801360:	b8 14 00 00 00       	mov    $0x14,%eax
+  801365:	89 df                	mov    %ebx,%edi
+  801367:	89 de                	mov    %ebx,%esi
+  801369:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80136b:	5b                   	pop    %ebx
+  80136c:	5e                   	pop    %esi
+  80136d:	5f                   	pop    %edi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+
+00801370 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801370:	55                   	push   %ebp
+  801371:	89 e5                	mov    %esp,%ebp
+  801373:	57                   	push   %edi
+  801374:	56                   	push   %esi
+  801375:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801376:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801383:	89 cb                	mov    %ecx,%ebx
+  801385:	89 cf                	mov    %ecx,%edi
+  801387:	89 ce                	mov    %ecx,%esi
+  801389:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	56                   	push   %esi
+  801395:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801396:	be 00 00 00 00       	mov    $0x0,%esi
+  80139b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a9:	89 f7                	mov    %esi,%edi
+  8013ab:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8013ad:	5b                   	pop    %ebx
+  8013ae:	5e                   	pop    %esi
+  8013af:	5f                   	pop    %edi
+  8013b0:	5d                   	pop    %ebp
+  8013b1:	c3                   	ret
+
+008013b2 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8013b2:	55                   	push   %ebp
+  8013b3:	89 e5                	mov    %esp,%ebp
+  8013b5:	57                   	push   %edi
+  8013b6:	56                   	push   %esi
+  8013b7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c3:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013c8:	89 df                	mov    %ebx,%edi
+  8013ca:	89 de                	mov    %ebx,%esi
+  8013cc:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5e                   	pop    %esi
+  8013d0:	5f                   	pop    %edi
+  8013d1:	5d                   	pop    %ebp
+  8013d2:	c3                   	ret
+
+008013d3 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8013d3:	55                   	push   %ebp
+  8013d4:	89 e5                	mov    %esp,%ebp
+  8013d6:	57                   	push   %edi
+  8013d7:	56                   	push   %esi
+  8013d8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013e6:	89 cb                	mov    %ecx,%ebx
+  8013e8:	89 cf                	mov    %ecx,%edi
+  8013ea:	89 ce                	mov    %ecx,%esi
+  8013ec:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8013ee:	5b                   	pop    %ebx
+  8013ef:	5e                   	pop    %esi
+  8013f0:	5f                   	pop    %edi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+
+008013f3 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8013f3:	55                   	push   %ebp
+  8013f4:	89 e5                	mov    %esp,%ebp
+  8013f6:	57                   	push   %edi
+  8013f7:	56                   	push   %esi
+  8013f8:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8013f9:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8013fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801402:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801405:	b8 19 00 00 00       	mov    $0x19,%eax
+  80140a:	89 df                	mov    %ebx,%edi
+  80140c:	89 de                	mov    %ebx,%esi
+  80140e:	cd 30                	int    $0x30
+}
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	57                   	push   %edi
+  801419:	56                   	push   %esi
+  80141a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80141b:	be 00 00 00 00       	mov    $0x0,%esi
+  801420:	8b 55 08             	mov    0x8(%ebp),%edx
+  801423:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801426:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80142b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142e:	89 f7                	mov    %esi,%edi
+  801430:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801432:	5b                   	pop    %ebx
+  801433:	5e                   	pop    %esi
+  801434:	5f                   	pop    %edi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+
+00801437 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80143d:	be 00 00 00 00       	mov    $0x0,%esi
+  801442:	8b 55 08             	mov    0x8(%ebp),%edx
+  801445:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801448:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80144d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801450:	89 f7                	mov    %esi,%edi
+  801452:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5f                   	pop    %edi
+  801457:	5d                   	pop    %ebp
+  801458:	c3                   	ret
+
+00801459 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80145f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801464:	8b 55 08             	mov    0x8(%ebp),%edx
+  801467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80146f:	89 df                	mov    %ebx,%edi
+  801471:	89 de                	mov    %ebx,%esi
+  801473:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801475:	5b                   	pop    %ebx
+  801476:	5e                   	pop    %esi
+  801477:	5f                   	pop    %edi
+  801478:	5d                   	pop    %ebp
+  801479:	c3                   	ret
+
+0080147a <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	56                   	push   %esi
+  80147f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801480:	be 00 00 00 00       	mov    $0x0,%esi
+  801485:	8b 55 08             	mov    0x8(%ebp),%edx
+  801488:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801490:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801493:	89 f7                	mov    %esi,%edi
+  801495:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801497:	5b                   	pop    %ebx
+  801498:	5e                   	pop    %esi
+  801499:	5f                   	pop    %edi
+  80149a:	5d                   	pop    %ebp
+  80149b:	c3                   	ret
+
+0080149c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80149f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a2:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014a7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014aa:	5d                   	pop    %ebp
+  8014ab:	c3                   	ret
+
+008014ac <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b2:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014b7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014bc:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8014c1:	5d                   	pop    %ebp
+  8014c2:	c3                   	ret
+
+008014c3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014c3:	55                   	push   %ebp
+  8014c4:	89 e5                	mov    %esp,%ebp
+  8014c6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014cb:	89 c2                	mov    %eax,%edx
+  8014cd:	c1 ea 16             	shr    $0x16,%edx
+  8014d0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014d7:	f6 c2 01             	test   $0x1,%dl
+  8014da:	74 29                	je     801505 <fd_alloc+0x42>
+  8014dc:	89 c2                	mov    %eax,%edx
+  8014de:	c1 ea 0c             	shr    $0xc,%edx
+  8014e1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014e8:	f6 c2 01             	test   $0x1,%dl
+  8014eb:	74 18                	je     801505 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  8014ed:	05 00 10 00 00       	add    $0x1000,%eax
+  8014f2:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8014f7:	75 d2                	jne    8014cb <fd_alloc+0x8>
+  8014f9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014fe:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801503:	eb 05                	jmp    80150a <fd_alloc+0x47>
+			return 0;
+  801505:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80150a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150d:	89 02                	mov    %eax,(%edx)
+}
+  80150f:	89 c8                	mov    %ecx,%eax
+  801511:	5d                   	pop    %ebp
+  801512:	c3                   	ret
+
+00801513 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801519:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80151e:	77 30                	ja     801550 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801520:	c1 e0 0c             	shl    $0xc,%eax
+  801523:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801528:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80152e:	f6 c2 01             	test   $0x1,%dl
+  801531:	74 24                	je     801557 <fd_lookup+0x44>
+  801533:	89 c2                	mov    %eax,%edx
+  801535:	c1 ea 0c             	shr    $0xc,%edx
+  801538:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80153f:	f6 c2 01             	test   $0x1,%dl
+  801542:	74 1a                	je     80155e <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801544:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801547:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801549:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+		return -E_INVAL;
+  801550:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801555:	eb f7                	jmp    80154e <fd_lookup+0x3b>
+		return -E_INVAL;
+  801557:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155c:	eb f0                	jmp    80154e <fd_lookup+0x3b>
+  80155e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801563:	eb e9                	jmp    80154e <fd_lookup+0x3b>
+
+00801565 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801565:	55                   	push   %ebp
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	53                   	push   %ebx
+  801569:	83 ec 04             	sub    $0x4,%esp
+  80156c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80156f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801574:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801579:	39 13                	cmp    %edx,(%ebx)
+  80157b:	74 54                	je     8015d1 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80157d:	83 c0 01             	add    $0x1,%eax
+  801580:	8b 1c 85 34 46 80 00 	mov    0x804634(,%eax,4),%ebx
+  801587:	85 db                	test   %ebx,%ebx
+  801589:	75 ee                	jne    801579 <dev_lookup+0x14>
+  80158b:	89 e1                	mov    %esp,%ecx
+  80158d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801592:	29 c8                	sub    %ecx,%eax
+  801594:	89 c1                	mov    %eax,%ecx
+  801596:	c1 e9 0f             	shr    $0xf,%ecx
+  801599:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a3:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015a6:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  8015ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8015b0:	83 ec 04             	sub    $0x4,%esp
+  8015b3:	52                   	push   %edx
+  8015b4:	50                   	push   %eax
+  8015b5:	68 b8 45 80 00       	push   $0x8045b8
+  8015ba:	e8 4f ef ff ff       	call   80050e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015bf:	83 c4 10             	add    $0x10,%esp
+  8015c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ca:	89 1a                	mov    %ebx,(%edx)
+}
+  8015cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015cf:	c9                   	leave
+  8015d0:	c3                   	ret
+			return 0;
+  8015d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d6:	eb ef                	jmp    8015c7 <dev_lookup+0x62>
+
+008015d8 <fd_close>:
+{
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	57                   	push   %edi
+  8015dc:	56                   	push   %esi
+  8015dd:	53                   	push   %ebx
+  8015de:	83 ec 24             	sub    $0x24,%esp
+  8015e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015e7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015ea:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015eb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015f1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015f4:	50                   	push   %eax
+  8015f5:	e8 19 ff ff ff       	call   801513 <fd_lookup>
+  8015fa:	89 c3                	mov    %eax,%ebx
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	78 05                	js     801608 <fd_close+0x30>
+	    || fd != fd2)
+  801603:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801606:	74 0f                	je     801617 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801608:	85 ff                	test   %edi,%edi
+  80160a:	0f 44 df             	cmove  %edi,%ebx
+}
+  80160d:	89 d8                	mov    %ebx,%eax
+  80160f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801612:	5b                   	pop    %ebx
+  801613:	5e                   	pop    %esi
+  801614:	5f                   	pop    %edi
+  801615:	5d                   	pop    %ebp
+  801616:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801617:	83 ec 08             	sub    $0x8,%esp
+  80161a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80161d:	50                   	push   %eax
+  80161e:	ff 36                	push   (%esi)
+  801620:	e8 40 ff ff ff       	call   801565 <dev_lookup>
+  801625:	89 c3                	mov    %eax,%ebx
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 1a                	js     801648 <fd_close+0x70>
+		if (dev->dev_close)
+  80162e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801631:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801634:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	74 0b                	je     801648 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80163d:	83 ec 0c             	sub    $0xc,%esp
+  801640:	56                   	push   %esi
+  801641:	ff d0                	call   *%eax
+  801643:	89 c3                	mov    %eax,%ebx
+  801645:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801648:	83 ec 08             	sub    $0x8,%esp
+  80164b:	56                   	push   %esi
+  80164c:	6a 00                	push   $0x0
+  80164e:	e8 6b fa ff ff       	call   8010be <sys_page_unmap>
+	return r;
+  801653:	83 c4 10             	add    $0x10,%esp
+  801656:	eb b5                	jmp    80160d <fd_close+0x35>
+
+00801658 <close>:
+
+int
+close(int fdnum)
+{
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80165e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801661:	50                   	push   %eax
+  801662:	ff 75 08             	push   0x8(%ebp)
+  801665:	e8 a9 fe ff ff       	call   801513 <fd_lookup>
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	79 02                	jns    801673 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801671:	c9                   	leave
+  801672:	c3                   	ret
+		return fd_close(fd, 1);
+  801673:	83 ec 08             	sub    $0x8,%esp
+  801676:	6a 01                	push   $0x1
+  801678:	ff 75 f4             	push   -0xc(%ebp)
+  80167b:	e8 58 ff ff ff       	call   8015d8 <fd_close>
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	eb ec                	jmp    801671 <close+0x19>
+
+00801685 <close_all>:
+
+void
+close_all(void)
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	53                   	push   %ebx
+  801689:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80168c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801691:	83 ec 0c             	sub    $0xc,%esp
+  801694:	53                   	push   %ebx
+  801695:	e8 be ff ff ff       	call   801658 <close>
+	for (i = 0; i < MAXFD; i++)
+  80169a:	83 c3 01             	add    $0x1,%ebx
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8016a6:	75 e9                	jne    801691 <close_all+0xc>
+}
+  8016a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ab:	c9                   	leave
+  8016ac:	c3                   	ret
+
+008016ad <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	57                   	push   %edi
+  8016b1:	56                   	push   %esi
+  8016b2:	53                   	push   %ebx
+  8016b3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016b9:	50                   	push   %eax
+  8016ba:	ff 75 08             	push   0x8(%ebp)
+  8016bd:	e8 51 fe ff ff       	call   801513 <fd_lookup>
+  8016c2:	89 c3                	mov    %eax,%ebx
+  8016c4:	83 c4 10             	add    $0x10,%esp
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	78 7f                	js     80174a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016cb:	83 ec 0c             	sub    $0xc,%esp
+  8016ce:	ff 75 0c             	push   0xc(%ebp)
+  8016d1:	e8 82 ff ff ff       	call   801658 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016d9:	c1 e6 0c             	shl    $0xc,%esi
+  8016dc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016e5:	89 3c 24             	mov    %edi,(%esp)
+  8016e8:	e8 bf fd ff ff       	call   8014ac <fd2data>
+  8016ed:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016ef:	89 34 24             	mov    %esi,(%esp)
+  8016f2:	e8 b5 fd ff ff       	call   8014ac <fd2data>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8016fd:	89 d8                	mov    %ebx,%eax
+  8016ff:	c1 e8 16             	shr    $0x16,%eax
+  801702:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801709:	a8 01                	test   $0x1,%al
+  80170b:	74 11                	je     80171e <dup+0x71>
+  80170d:	89 d8                	mov    %ebx,%eax
+  80170f:	c1 e8 0c             	shr    $0xc,%eax
+  801712:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801719:	f6 c2 01             	test   $0x1,%dl
+  80171c:	75 36                	jne    801754 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80171e:	89 f8                	mov    %edi,%eax
+  801720:	c1 e8 0c             	shr    $0xc,%eax
+  801723:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80172a:	83 ec 0c             	sub    $0xc,%esp
+  80172d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801732:	50                   	push   %eax
+  801733:	56                   	push   %esi
+  801734:	6a 00                	push   $0x0
+  801736:	57                   	push   %edi
+  801737:	6a 00                	push   $0x0
+  801739:	e8 3e f9 ff ff       	call   80107c <sys_page_map>
+  80173e:	89 c3                	mov    %eax,%ebx
+  801740:	83 c4 20             	add    $0x20,%esp
+  801743:	85 c0                	test   %eax,%eax
+  801745:	78 33                	js     80177a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801747:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80174a:	89 d8                	mov    %ebx,%eax
+  80174c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174f:	5b                   	pop    %ebx
+  801750:	5e                   	pop    %esi
+  801751:	5f                   	pop    %edi
+  801752:	5d                   	pop    %ebp
+  801753:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801754:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80175b:	83 ec 0c             	sub    $0xc,%esp
+  80175e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801763:	50                   	push   %eax
+  801764:	ff 75 d4             	push   -0x2c(%ebp)
+  801767:	6a 00                	push   $0x0
+  801769:	53                   	push   %ebx
+  80176a:	6a 00                	push   $0x0
+  80176c:	e8 0b f9 ff ff       	call   80107c <sys_page_map>
+  801771:	89 c3                	mov    %eax,%ebx
+  801773:	83 c4 20             	add    $0x20,%esp
+  801776:	85 c0                	test   %eax,%eax
+  801778:	79 a4                	jns    80171e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80177a:	83 ec 08             	sub    $0x8,%esp
+  80177d:	56                   	push   %esi
+  80177e:	6a 00                	push   $0x0
+  801780:	e8 39 f9 ff ff       	call   8010be <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801785:	83 c4 08             	add    $0x8,%esp
+  801788:	ff 75 d4             	push   -0x2c(%ebp)
+  80178b:	6a 00                	push   $0x0
+  80178d:	e8 2c f9 ff ff       	call   8010be <sys_page_unmap>
+	return r;
+  801792:	83 c4 10             	add    $0x10,%esp
+  801795:	eb b3                	jmp    80174a <dup+0x9d>
+
+00801797 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	56                   	push   %esi
+  80179b:	53                   	push   %ebx
+  80179c:	83 ec 18             	sub    $0x18,%esp
+  80179f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a5:	50                   	push   %eax
+  8017a6:	53                   	push   %ebx
+  8017a7:	e8 67 fd ff ff       	call   801513 <fd_lookup>
+  8017ac:	83 c4 10             	add    $0x10,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 3c                	js     8017ef <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017b6:	83 ec 08             	sub    $0x8,%esp
+  8017b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017bc:	50                   	push   %eax
+  8017bd:	ff 36                	push   (%esi)
+  8017bf:	e8 a1 fd ff ff       	call   801565 <dev_lookup>
+  8017c4:	83 c4 10             	add    $0x10,%esp
+  8017c7:	85 c0                	test   %eax,%eax
+  8017c9:	78 24                	js     8017ef <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017cb:	8b 46 08             	mov    0x8(%esi),%eax
+  8017ce:	83 e0 03             	and    $0x3,%eax
+  8017d1:	83 f8 01             	cmp    $0x1,%eax
+  8017d4:	74 20                	je     8017f6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d9:	8b 40 08             	mov    0x8(%eax),%eax
+  8017dc:	85 c0                	test   %eax,%eax
+  8017de:	74 54                	je     801834 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017e0:	83 ec 04             	sub    $0x4,%esp
+  8017e3:	ff 75 10             	push   0x10(%ebp)
+  8017e6:	ff 75 0c             	push   0xc(%ebp)
+  8017e9:	56                   	push   %esi
+  8017ea:	ff d0                	call   *%eax
+  8017ec:	83 c4 10             	add    $0x10,%esp
+}
+  8017ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017f2:	5b                   	pop    %ebx
+  8017f3:	5e                   	pop    %esi
+  8017f4:	5d                   	pop    %ebp
+  8017f5:	c3                   	ret
+  8017f6:	89 e2                	mov    %esp,%edx
+  8017f8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017fd:	29 d0                	sub    %edx,%eax
+  8017ff:	89 c2                	mov    %eax,%edx
+  801801:	c1 ea 0f             	shr    $0xf,%edx
+  801804:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180e:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801811:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  801818:	8b 40 48             	mov    0x48(%eax),%eax
+  80181b:	83 ec 04             	sub    $0x4,%esp
+  80181e:	53                   	push   %ebx
+  80181f:	50                   	push   %eax
+  801820:	68 f9 45 80 00       	push   $0x8045f9
+  801825:	e8 e4 ec ff ff       	call   80050e <cprintf>
+		return -E_INVAL;
+  80182a:	83 c4 10             	add    $0x10,%esp
+  80182d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801832:	eb bb                	jmp    8017ef <read+0x58>
+		return -E_NOT_SUPP;
+  801834:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801839:	eb b4                	jmp    8017ef <read+0x58>
+
+0080183b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	57                   	push   %edi
+  80183f:	56                   	push   %esi
+  801840:	53                   	push   %ebx
+  801841:	83 ec 0c             	sub    $0xc,%esp
+  801844:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801847:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80184a:	85 f6                	test   %esi,%esi
+  80184c:	74 30                	je     80187e <readn+0x43>
+  80184e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801858:	83 ec 04             	sub    $0x4,%esp
+  80185b:	89 f2                	mov    %esi,%edx
+  80185d:	29 c2                	sub    %eax,%edx
+  80185f:	52                   	push   %edx
+  801860:	01 f8                	add    %edi,%eax
+  801862:	50                   	push   %eax
+  801863:	ff 75 08             	push   0x8(%ebp)
+  801866:	e8 2c ff ff ff       	call   801797 <read>
+		if (m < 0)
+  80186b:	83 c4 10             	add    $0x10,%esp
+  80186e:	85 c0                	test   %eax,%eax
+  801870:	78 15                	js     801887 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801872:	74 11                	je     801885 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801874:	01 c3                	add    %eax,%ebx
+  801876:	89 d8                	mov    %ebx,%eax
+  801878:	39 f3                	cmp    %esi,%ebx
+  80187a:	72 dc                	jb     801858 <readn+0x1d>
+  80187c:	eb 09                	jmp    801887 <readn+0x4c>
+  80187e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801883:	eb 02                	jmp    801887 <readn+0x4c>
+  801885:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188a:	5b                   	pop    %ebx
+  80188b:	5e                   	pop    %esi
+  80188c:	5f                   	pop    %edi
+  80188d:	5d                   	pop    %ebp
+  80188e:	c3                   	ret
+
+0080188f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80188f:	55                   	push   %ebp
+  801890:	89 e5                	mov    %esp,%ebp
+  801892:	56                   	push   %esi
+  801893:	53                   	push   %ebx
+  801894:	83 ec 18             	sub    $0x18,%esp
+  801897:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80189a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80189d:	50                   	push   %eax
+  80189e:	53                   	push   %ebx
+  80189f:	e8 6f fc ff ff       	call   801513 <fd_lookup>
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  8018a7:	85 c0                	test   %eax,%eax
+  8018a9:	78 37                	js     8018e2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ab:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018ae:	83 ec 08             	sub    $0x8,%esp
+  8018b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018b4:	50                   	push   %eax
+  8018b5:	ff 36                	push   (%esi)
+  8018b7:	e8 a9 fc ff ff       	call   801565 <dev_lookup>
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	85 c0                	test   %eax,%eax
+  8018c1:	78 1f                	js     8018e2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018c3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018c7:	74 20                	je     8018e9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	74 54                	je     801927 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018d3:	83 ec 04             	sub    $0x4,%esp
+  8018d6:	ff 75 10             	push   0x10(%ebp)
+  8018d9:	ff 75 0c             	push   0xc(%ebp)
+  8018dc:	56                   	push   %esi
+  8018dd:	ff d0                	call   *%eax
+  8018df:	83 c4 10             	add    $0x10,%esp
+}
+  8018e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e5:	5b                   	pop    %ebx
+  8018e6:	5e                   	pop    %esi
+  8018e7:	5d                   	pop    %ebp
+  8018e8:	c3                   	ret
+  8018e9:	89 e2                	mov    %esp,%edx
+  8018eb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8018f0:	29 d0                	sub    %edx,%eax
+  8018f2:	89 c2                	mov    %eax,%edx
+  8018f4:	c1 ea 0f             	shr    $0xf,%edx
+  8018f7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801901:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801904:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  80190b:	8b 40 48             	mov    0x48(%eax),%eax
+  80190e:	83 ec 04             	sub    $0x4,%esp
+  801911:	53                   	push   %ebx
+  801912:	50                   	push   %eax
+  801913:	68 15 46 80 00       	push   $0x804615
+  801918:	e8 f1 eb ff ff       	call   80050e <cprintf>
+		return -E_INVAL;
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801925:	eb bb                	jmp    8018e2 <write+0x53>
+		return -E_NOT_SUPP;
+  801927:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80192c:	eb b4                	jmp    8018e2 <write+0x53>
+
+0080192e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80192e:	55                   	push   %ebp
+  80192f:	89 e5                	mov    %esp,%ebp
+  801931:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801934:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801937:	50                   	push   %eax
+  801938:	ff 75 08             	push   0x8(%ebp)
+  80193b:	e8 d3 fb ff ff       	call   801513 <fd_lookup>
+  801940:	83 c4 10             	add    $0x10,%esp
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 0e                	js     801955 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801947:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80194a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801950:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801955:	c9                   	leave
+  801956:	c3                   	ret
+
+00801957 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	53                   	push   %ebx
+  80195b:	83 ec 1c             	sub    $0x1c,%esp
+  80195e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801961:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801964:	50                   	push   %eax
+  801965:	ff 75 08             	push   0x8(%ebp)
+  801968:	e8 a6 fb ff ff       	call   801513 <fd_lookup>
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	85 c0                	test   %eax,%eax
+  801972:	78 33                	js     8019a7 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801974:	83 fb 03             	cmp    $0x3,%ebx
+  801977:	74 28                	je     8019a1 <fcntl+0x4a>
+  801979:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197e:	83 fb 04             	cmp    $0x4,%ebx
+  801981:	75 24                	jne    8019a7 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801983:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801986:	8b 41 08             	mov    0x8(%ecx),%eax
+  801989:	80 e4 ef             	and    $0xef,%ah
+  80198c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80198f:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801995:	09 d0                	or     %edx,%eax
+  801997:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80199a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199f:	eb 06                	jmp    8019a7 <fcntl+0x50>
+		return fd->fd_omode;
+  8019a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a4:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8019a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019aa:	c9                   	leave
+  8019ab:	c3                   	ret
+
+008019ac <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	56                   	push   %esi
+  8019b0:	53                   	push   %ebx
+  8019b1:	83 ec 18             	sub    $0x18,%esp
+  8019b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019ba:	50                   	push   %eax
+  8019bb:	53                   	push   %ebx
+  8019bc:	e8 52 fb ff ff       	call   801513 <fd_lookup>
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	78 34                	js     8019fc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019c8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019cb:	83 ec 08             	sub    $0x8,%esp
+  8019ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d1:	50                   	push   %eax
+  8019d2:	ff 36                	push   (%esi)
+  8019d4:	e8 8c fb ff ff       	call   801565 <dev_lookup>
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	78 1c                	js     8019fc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019e0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019e4:	74 1d                	je     801a03 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e9:	8b 40 18             	mov    0x18(%eax),%eax
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	74 51                	je     801a41 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019f0:	83 ec 08             	sub    $0x8,%esp
+  8019f3:	ff 75 0c             	push   0xc(%ebp)
+  8019f6:	56                   	push   %esi
+  8019f7:	ff d0                	call   *%eax
+  8019f9:	83 c4 10             	add    $0x10,%esp
+}
+  8019fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ff:	5b                   	pop    %ebx
+  801a00:	5e                   	pop    %esi
+  801a01:	5d                   	pop    %ebp
+  801a02:	c3                   	ret
+  801a03:	89 e2                	mov    %esp,%edx
+  801a05:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a0a:	29 d0                	sub    %edx,%eax
+  801a0c:	89 c2                	mov    %eax,%edx
+  801a0e:	c1 ea 0f             	shr    $0xf,%edx
+  801a11:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1b:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801a1e:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  801a25:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a28:	83 ec 04             	sub    $0x4,%esp
+  801a2b:	53                   	push   %ebx
+  801a2c:	50                   	push   %eax
+  801a2d:	68 d8 45 80 00       	push   $0x8045d8
+  801a32:	e8 d7 ea ff ff       	call   80050e <cprintf>
+		return -E_INVAL;
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a3f:	eb bb                	jmp    8019fc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a41:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a46:	eb b4                	jmp    8019fc <ftruncate+0x50>
+
+00801a48 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	56                   	push   %esi
+  801a4c:	53                   	push   %ebx
+  801a4d:	83 ec 18             	sub    $0x18,%esp
+  801a50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a53:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a56:	50                   	push   %eax
+  801a57:	ff 75 08             	push   0x8(%ebp)
+  801a5a:	e8 b4 fa ff ff       	call   801513 <fd_lookup>
+  801a5f:	83 c4 10             	add    $0x10,%esp
+  801a62:	85 c0                	test   %eax,%eax
+  801a64:	78 53                	js     801ab9 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a66:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a69:	83 ec 08             	sub    $0x8,%esp
+  801a6c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a6f:	50                   	push   %eax
+  801a70:	ff 36                	push   (%esi)
+  801a72:	e8 ee fa ff ff       	call   801565 <dev_lookup>
+  801a77:	83 c4 10             	add    $0x10,%esp
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 3b                	js     801ab9 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801a7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a81:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a85:	74 39                	je     801ac0 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a87:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a8a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a91:	00 00 00 
+	stat->st_isdir = 0;
+  801a94:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a9b:	00 00 00 
+	stat->st_version = 0;
+  801a9e:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801aa5:	00 00 00 
+	stat->st_dev = dev;
+  801aa8:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801aae:	83 ec 08             	sub    $0x8,%esp
+  801ab1:	53                   	push   %ebx
+  801ab2:	56                   	push   %esi
+  801ab3:	ff 50 14             	call   *0x14(%eax)
+  801ab6:	83 c4 10             	add    $0x10,%esp
+}
+  801ab9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abc:	5b                   	pop    %ebx
+  801abd:	5e                   	pop    %esi
+  801abe:	5d                   	pop    %ebp
+  801abf:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ac0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac5:	eb f2                	jmp    801ab9 <fstat+0x71>
+
+00801ac7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	56                   	push   %esi
+  801acb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801acc:	83 ec 08             	sub    $0x8,%esp
+  801acf:	6a 00                	push   $0x0
+  801ad1:	ff 75 08             	push   0x8(%ebp)
+  801ad4:	e8 b7 01 00 00       	call   801c90 <open>
+  801ad9:	89 c3                	mov    %eax,%ebx
+  801adb:	83 c4 10             	add    $0x10,%esp
+  801ade:	85 c0                	test   %eax,%eax
+  801ae0:	78 1b                	js     801afd <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801ae2:	83 ec 08             	sub    $0x8,%esp
+  801ae5:	ff 75 0c             	push   0xc(%ebp)
+  801ae8:	50                   	push   %eax
+  801ae9:	e8 5a ff ff ff       	call   801a48 <fstat>
+  801aee:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801af0:	89 1c 24             	mov    %ebx,(%esp)
+  801af3:	e8 60 fb ff ff       	call   801658 <close>
+	return r;
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	89 f3                	mov    %esi,%ebx
+}
+  801afd:	89 d8                	mov    %ebx,%eax
+  801aff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b02:	5b                   	pop    %ebx
+  801b03:	5e                   	pop    %esi
+  801b04:	5d                   	pop    %ebp
+  801b05:	c3                   	ret
+
+00801b06 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	56                   	push   %esi
+  801b0a:	53                   	push   %ebx
+  801b0b:	89 c6                	mov    %eax,%esi
+  801b0d:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801b0f:	83 3d 00 78 80 00 00 	cmpl   $0x0,0x807800
+  801b16:	74 27                	je     801b3f <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b18:	6a 07                	push   $0x7
+  801b1a:	68 00 80 80 00       	push   $0x808000
+  801b1f:	56                   	push   %esi
+  801b20:	ff 35 00 78 80 00    	push   0x807800
+  801b26:	e8 d9 1f 00 00       	call   803b04 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b2b:	83 c4 0c             	add    $0xc,%esp
+  801b2e:	6a 00                	push   $0x0
+  801b30:	53                   	push   %ebx
+  801b31:	6a 00                	push   $0x0
+  801b33:	e8 3c 1d 00 00       	call   803874 <ipc_recv>
+}
+  801b38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3b:	5b                   	pop    %ebx
+  801b3c:	5e                   	pop    %esi
+  801b3d:	5d                   	pop    %ebp
+  801b3e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	6a 02                	push   $0x2
+  801b44:	e8 24 20 00 00       	call   803b6d <ipc_find_env>
+  801b49:	a3 00 78 80 00       	mov    %eax,0x807800
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	eb c5                	jmp    801b18 <fsipc+0x12>
+
+00801b53 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b53:	55                   	push   %ebp
+  801b54:	89 e5                	mov    %esp,%ebp
+  801b56:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b5f:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801b64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b67:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b71:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b76:	e8 8b ff ff ff       	call   801b06 <fsipc>
+}
+  801b7b:	c9                   	leave
+  801b7c:	c3                   	ret
+
+00801b7d <devfile_flush>:
+{
+  801b7d:	55                   	push   %ebp
+  801b7e:	89 e5                	mov    %esp,%ebp
+  801b80:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b86:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b89:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801b8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b93:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b98:	e8 69 ff ff ff       	call   801b06 <fsipc>
+}
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+
+00801b9f <devfile_stat>:
+{
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	53                   	push   %ebx
+  801ba3:	83 ec 04             	sub    $0x4,%esp
+  801ba6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bac:	8b 40 0c             	mov    0xc(%eax),%eax
+  801baf:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb9:	b8 05 00 00 00       	mov    $0x5,%eax
+  801bbe:	e8 43 ff ff ff       	call   801b06 <fsipc>
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 37                	js     801bfe <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801bc7:	83 ec 08             	sub    $0x8,%esp
+  801bca:	68 00 80 80 00       	push   $0x808000
+  801bcf:	53                   	push   %ebx
+  801bd0:	e8 30 f0 ff ff       	call   800c05 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801bd5:	a1 80 80 80 00       	mov    0x808080,%eax
+  801bda:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801be0:	a1 84 80 80 00       	mov    0x808084,%eax
+  801be5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801beb:	a1 88 80 80 00       	mov    0x808088,%eax
+  801bf0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801bf6:	83 c4 10             	add    $0x10,%esp
+  801bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c01:	c9                   	leave
+  801c02:	c3                   	ret
+
+00801c03 <devfile_write>:
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	83 ec 0c             	sub    $0xc,%esp
+  801c09:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801c0c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c11:	39 d0                	cmp    %edx,%eax
+  801c13:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c16:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c19:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c1c:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = count;
+  801c22:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801c27:	50                   	push   %eax
+  801c28:	ff 75 0c             	push   0xc(%ebp)
+  801c2b:	68 08 80 80 00       	push   $0x808008
+  801c30:	e8 80 f1 ff ff       	call   800db5 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801c35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c3f:	e8 c2 fe ff ff       	call   801b06 <fsipc>
+}
+  801c44:	c9                   	leave
+  801c45:	c3                   	ret
+
+00801c46 <devfile_read>:
+{
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	53                   	push   %ebx
+  801c4a:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c50:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c53:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801c58:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c5b:	a3 04 80 80 00       	mov    %eax,0x808004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801c60:	ba 00 80 80 00       	mov    $0x808000,%edx
+  801c65:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c6a:	e8 97 fe ff ff       	call   801b06 <fsipc>
+  801c6f:	89 c3                	mov    %eax,%ebx
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	78 14                	js     801c89 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801c75:	83 ec 04             	sub    $0x4,%esp
+  801c78:	50                   	push   %eax
+  801c79:	68 00 80 80 00       	push   $0x808000
+  801c7e:	ff 75 0c             	push   0xc(%ebp)
+  801c81:	e8 2f f1 ff ff       	call   800db5 <memmove>
+	return r;
+  801c86:	83 c4 10             	add    $0x10,%esp
+}
+  801c89:	89 d8                	mov    %ebx,%eax
+  801c8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8e:	c9                   	leave
+  801c8f:	c3                   	ret
+
+00801c90 <open>:
+{
+  801c90:	55                   	push   %ebp
+  801c91:	89 e5                	mov    %esp,%ebp
+  801c93:	53                   	push   %ebx
+  801c94:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801c97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c9a:	50                   	push   %eax
+  801c9b:	e8 23 f8 ff ff       	call   8014c3 <fd_alloc>
+  801ca0:	89 c3                	mov    %eax,%ebx
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 2a                	js     801cd3 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801ca9:	83 ec 0c             	sub    $0xc,%esp
+  801cac:	ff 75 08             	push   0x8(%ebp)
+  801caf:	e8 05 ef ff ff       	call   800bb9 <strlen>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801cb7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801cbc:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801cc1:	7e 17                	jle    801cda <open+0x4a>
+	fd_close(fd, 1);
+  801cc3:	83 ec 08             	sub    $0x8,%esp
+  801cc6:	6a 01                	push   $0x1
+  801cc8:	ff 75 f4             	push   -0xc(%ebp)
+  801ccb:	e8 08 f9 ff ff       	call   8015d8 <fd_close>
+	return r;
+  801cd0:	83 c4 10             	add    $0x10,%esp
+}
+  801cd3:	89 d8                	mov    %ebx,%eax
+  801cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd8:	c9                   	leave
+  801cd9:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801cda:	83 ec 08             	sub    $0x8,%esp
+  801cdd:	ff 75 08             	push   0x8(%ebp)
+  801ce0:	68 00 80 80 00       	push   $0x808000
+  801ce5:	e8 1b ef ff ff       	call   800c05 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801cea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ced:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801cf2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cf5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cfa:	e8 07 fe ff ff       	call   801b06 <fsipc>
+  801cff:	89 c3                	mov    %eax,%ebx
+  801d01:	83 c4 10             	add    $0x10,%esp
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	78 bb                	js     801cc3 <open+0x33>
+	return fd2num(fd); 	
+  801d08:	83 ec 0c             	sub    $0xc,%esp
+  801d0b:	ff 75 f4             	push   -0xc(%ebp)
+  801d0e:	e8 89 f7 ff ff       	call   80149c <fd2num>
+  801d13:	89 c3                	mov    %eax,%ebx
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	eb b9                	jmp    801cd3 <open+0x43>
+
+00801d1a <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	53                   	push   %ebx
+  801d1e:	83 ec 1c             	sub    $0x1c,%esp
+  801d21:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d27:	50                   	push   %eax
+  801d28:	ff 75 08             	push   0x8(%ebp)
+  801d2b:	e8 e3 f7 ff ff       	call   801513 <fd_lookup>
+  801d30:	83 c4 10             	add    $0x10,%esp
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	78 5a                	js     801d91 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801d37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3a:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801d40:	39 10                	cmp    %edx,(%eax)
+  801d42:	75 66                	jne    801daa <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801d44:	83 3d 00 78 80 00 00 	cmpl   $0x0,0x807800
+  801d4b:	74 49                	je     801d96 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d50:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d53:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801d58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d5b:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_npages = maxpages;
+  801d60:	89 1d 08 80 80 00    	mov    %ebx,0x808008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d66:	6a 07                	push   $0x7
+  801d68:	68 00 80 80 00       	push   $0x808000
+  801d6d:	6a 09                	push   $0x9
+  801d6f:	ff 35 00 78 80 00    	push   0x807800
+  801d75:	e8 8a 1d 00 00       	call   803b04 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801d7a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801d81:	6a 00                	push   $0x0
+  801d83:	53                   	push   %ebx
+  801d84:	ff 75 10             	push   0x10(%ebp)
+  801d87:	6a 00                	push   $0x0
+  801d89:	e8 b3 1b 00 00       	call   803941 <ipc_recv_pages>
+  801d8e:	83 c4 20             	add    $0x20,%esp
+}
+  801d91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d96:	83 ec 0c             	sub    $0xc,%esp
+  801d99:	6a 02                	push   $0x2
+  801d9b:	e8 cd 1d 00 00       	call   803b6d <ipc_find_env>
+  801da0:	a3 00 78 80 00       	mov    %eax,0x807800
+  801da5:	83 c4 10             	add    $0x10,%esp
+  801da8:	eb a3                	jmp    801d4d <fmap+0x33>
+		return -E_INVAL;
+  801daa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801daf:	eb e0                	jmp    801d91 <fmap+0x77>
+
+00801db1 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801db1:	55                   	push   %ebp
+  801db2:	89 e5                	mov    %esp,%ebp
+  801db4:	53                   	push   %ebx
+  801db5:	83 ec 10             	sub    $0x10,%esp
+  801db8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801dbb:	53                   	push   %ebx
+  801dbc:	e8 f8 ed ff ff       	call   800bb9 <strlen>
+  801dc1:	83 c4 10             	add    $0x10,%esp
+  801dc4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dc9:	7f 25                	jg     801df0 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801dcb:	83 ec 08             	sub    $0x8,%esp
+  801dce:	53                   	push   %ebx
+  801dcf:	68 00 80 80 00       	push   $0x808000
+  801dd4:	e8 2c ee ff ff       	call   800c05 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dde:	b8 07 00 00 00       	mov    $0x7,%eax
+  801de3:	e8 1e fd ff ff       	call   801b06 <fsipc>
+  801de8:	83 c4 10             	add    $0x10,%esp
+}
+  801deb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+		return -E_BAD_PATH;
+  801df0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801df5:	eb f4                	jmp    801deb <remove+0x3a>
+
+00801df7 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801df7:	55                   	push   %ebp
+  801df8:	89 e5                	mov    %esp,%ebp
+  801dfa:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801dfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e02:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e07:	e8 fa fc ff ff       	call   801b06 <fsipc>
+}
+  801e0c:	c9                   	leave
+  801e0d:	c3                   	ret
+
+00801e0e <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801e14:	68 48 46 80 00       	push   $0x804648
+  801e19:	ff 75 0c             	push   0xc(%ebp)
+  801e1c:	e8 e4 ed ff ff       	call   800c05 <strcpy>
+	return 0;
+}
+  801e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e26:	c9                   	leave
+  801e27:	c3                   	ret
+
+00801e28 <devsock_close>:
+{
+  801e28:	55                   	push   %ebp
+  801e29:	89 e5                	mov    %esp,%ebp
+  801e2b:	53                   	push   %ebx
+  801e2c:	83 ec 10             	sub    $0x10,%esp
+  801e2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801e32:	53                   	push   %ebx
+  801e33:	e8 74 1d 00 00       	call   803bac <pageref>
+  801e38:	89 c2                	mov    %eax,%edx
+  801e3a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801e42:	83 fa 01             	cmp    $0x1,%edx
+  801e45:	74 05                	je     801e4c <devsock_close+0x24>
+}
+  801e47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4a:	c9                   	leave
+  801e4b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801e4c:	83 ec 0c             	sub    $0xc,%esp
+  801e4f:	ff 73 0c             	push   0xc(%ebx)
+  801e52:	e8 b0 05 00 00       	call   802407 <nsipc_close>
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	eb eb                	jmp    801e47 <devsock_close+0x1f>
+
+00801e5c <devsock_write>:
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	53                   	push   %ebx
+  801e60:	83 ec 14             	sub    $0x14,%esp
+  801e63:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e66:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e69:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801e6c:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801e6f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801e72:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e75:	c1 f8 09             	sar    $0x9,%eax
+  801e78:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801e7b:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801e81:	77 13                	ja     801e96 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801e83:	50                   	push   %eax
+  801e84:	52                   	push   %edx
+  801e85:	53                   	push   %ebx
+  801e86:	ff 71 0c             	push   0xc(%ecx)
+  801e89:	e8 5c 06 00 00       	call   8024ea <nsipc_send>
+  801e8e:	83 c4 10             	add    $0x10,%esp
+}
+  801e91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801e96:	50                   	push   %eax
+  801e97:	6a 01                	push   $0x1
+  801e99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e9c:	50                   	push   %eax
+  801e9d:	ff 71 0c             	push   0xc(%ecx)
+  801ea0:	e8 a6 06 00 00       	call   80254b <nsipc_sendmsg>
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	eb e7                	jmp    801e91 <devsock_write+0x35>
+
+00801eaa <devsock_read>:
+{
+  801eaa:	55                   	push   %ebp
+  801eab:	89 e5                	mov    %esp,%ebp
+  801ead:	53                   	push   %ebx
+  801eae:	83 ec 14             	sub    $0x14,%esp
+  801eb1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801eb4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801eb7:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801eba:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801ebd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801ec0:	8b 41 08             	mov    0x8(%ecx),%eax
+  801ec3:	c1 f8 09             	sar    $0x9,%eax
+  801ec6:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801ec9:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801ecf:	77 13                	ja     801ee4 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801ed1:	50                   	push   %eax
+  801ed2:	52                   	push   %edx
+  801ed3:	53                   	push   %ebx
+  801ed4:	ff 71 0c             	push   0xc(%ecx)
+  801ed7:	e8 9c 05 00 00       	call   802478 <nsipc_recv>
+  801edc:	83 c4 10             	add    $0x10,%esp
+}
+  801edf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee2:	c9                   	leave
+  801ee3:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801ee4:	50                   	push   %eax
+  801ee5:	6a 01                	push   $0x1
+  801ee7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eea:	50                   	push   %eax
+  801eeb:	ff 71 0c             	push   0xc(%ecx)
+  801eee:	e8 02 0a 00 00       	call   8028f5 <nsipc_recvmsg>
+  801ef3:	83 c4 10             	add    $0x10,%esp
+  801ef6:	eb e7                	jmp    801edf <devsock_read+0x35>
+
+00801ef8 <fd2sockid>:
+{
+  801ef8:	55                   	push   %ebp
+  801ef9:	89 e5                	mov    %esp,%ebp
+  801efb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801efe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f01:	52                   	push   %edx
+  801f02:	50                   	push   %eax
+  801f03:	e8 0b f6 ff ff       	call   801513 <fd_lookup>
+  801f08:	83 c4 10             	add    $0x10,%esp
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	78 10                	js     801f1f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801f0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f12:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801f18:	39 08                	cmp    %ecx,(%eax)
+  801f1a:	75 05                	jne    801f21 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801f1c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801f1f:	c9                   	leave
+  801f20:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f21:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f26:	eb f7                	jmp    801f1f <fd2sockid+0x27>
+
+00801f28 <sock_flags>:
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801f2e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f31:	52                   	push   %edx
+  801f32:	50                   	push   %eax
+  801f33:	e8 db f5 ff ff       	call   801513 <fd_lookup>
+  801f38:	83 c4 10             	add    $0x10,%esp
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 0e                	js     801f4d <sock_flags+0x25>
+  801f3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f42:	8b 40 08             	mov    0x8(%eax),%eax
+  801f45:	c1 e8 09             	shr    $0x9,%eax
+  801f48:	83 e0 08             	and    $0x8,%eax
+}
+  801f4b:	c9                   	leave
+  801f4c:	c3                   	ret
+		return 0;
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f52:	eb f7                	jmp    801f4b <sock_flags+0x23>
+
+00801f54 <alloc_sockfd>:
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	56                   	push   %esi
+  801f58:	53                   	push   %ebx
+  801f59:	83 ec 1c             	sub    $0x1c,%esp
+  801f5c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801f5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f61:	50                   	push   %eax
+  801f62:	e8 5c f5 ff ff       	call   8014c3 <fd_alloc>
+  801f67:	89 c3                	mov    %eax,%ebx
+  801f69:	83 c4 10             	add    $0x10,%esp
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	78 43                	js     801fb3 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801f70:	83 ec 04             	sub    $0x4,%esp
+  801f73:	68 07 04 00 00       	push   $0x407
+  801f78:	ff 75 f4             	push   -0xc(%ebp)
+  801f7b:	6a 00                	push   $0x0
+  801f7d:	e8 b7 f0 ff ff       	call   801039 <sys_page_alloc>
+  801f82:	89 c3                	mov    %eax,%ebx
+  801f84:	83 c4 10             	add    $0x10,%esp
+  801f87:	85 c0                	test   %eax,%eax
+  801f89:	78 28                	js     801fb3 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801f8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f8e:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801f94:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801f96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f99:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801fa0:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801fa3:	83 ec 0c             	sub    $0xc,%esp
+  801fa6:	50                   	push   %eax
+  801fa7:	e8 f0 f4 ff ff       	call   80149c <fd2num>
+  801fac:	89 c3                	mov    %eax,%ebx
+  801fae:	83 c4 10             	add    $0x10,%esp
+  801fb1:	eb 0c                	jmp    801fbf <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801fb3:	83 ec 0c             	sub    $0xc,%esp
+  801fb6:	56                   	push   %esi
+  801fb7:	e8 4b 04 00 00       	call   802407 <nsipc_close>
+		return r;
+  801fbc:	83 c4 10             	add    $0x10,%esp
+}
+  801fbf:	89 d8                	mov    %ebx,%eax
+  801fc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc4:	5b                   	pop    %ebx
+  801fc5:	5e                   	pop    %esi
+  801fc6:	5d                   	pop    %ebp
+  801fc7:	c3                   	ret
+
+00801fc8 <accept>:
+{
+  801fc8:	55                   	push   %ebp
+  801fc9:	89 e5                	mov    %esp,%ebp
+  801fcb:	56                   	push   %esi
+  801fcc:	53                   	push   %ebx
+  801fcd:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801fd0:	89 f0                	mov    %esi,%eax
+  801fd2:	e8 21 ff ff ff       	call   801ef8 <fd2sockid>
+  801fd7:	89 c3                	mov    %eax,%ebx
+  801fd9:	85 c0                	test   %eax,%eax
+  801fdb:	78 24                	js     802001 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801fdd:	89 f0                	mov    %esi,%eax
+  801fdf:	e8 44 ff ff ff       	call   801f28 <sock_flags>
+  801fe4:	50                   	push   %eax
+  801fe5:	ff 75 10             	push   0x10(%ebp)
+  801fe8:	ff 75 0c             	push   0xc(%ebp)
+  801feb:	53                   	push   %ebx
+  801fec:	e8 6b 03 00 00       	call   80235c <nsipc_accept>
+  801ff1:	89 c3                	mov    %eax,%ebx
+  801ff3:	83 c4 10             	add    $0x10,%esp
+  801ff6:	85 c0                	test   %eax,%eax
+  801ff8:	78 07                	js     802001 <accept+0x39>
+	return alloc_sockfd(r);
+  801ffa:	e8 55 ff ff ff       	call   801f54 <alloc_sockfd>
+  801fff:	89 c3                	mov    %eax,%ebx
+}
+  802001:	89 d8                	mov    %ebx,%eax
+  802003:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802006:	5b                   	pop    %ebx
+  802007:	5e                   	pop    %esi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+
+0080200a <bind>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802010:	8b 45 08             	mov    0x8(%ebp),%eax
+  802013:	e8 e0 fe ff ff       	call   801ef8 <fd2sockid>
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	78 12                	js     80202e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80201c:	83 ec 04             	sub    $0x4,%esp
+  80201f:	ff 75 10             	push   0x10(%ebp)
+  802022:	ff 75 0c             	push   0xc(%ebp)
+  802025:	50                   	push   %eax
+  802026:	e8 85 03 00 00       	call   8023b0 <nsipc_bind>
+  80202b:	83 c4 10             	add    $0x10,%esp
+}
+  80202e:	c9                   	leave
+  80202f:	c3                   	ret
+
+00802030 <shutdown>:
+{
+  802030:	55                   	push   %ebp
+  802031:	89 e5                	mov    %esp,%ebp
+  802033:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802036:	8b 45 08             	mov    0x8(%ebp),%eax
+  802039:	e8 ba fe ff ff       	call   801ef8 <fd2sockid>
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	78 0f                	js     802051 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802042:	83 ec 08             	sub    $0x8,%esp
+  802045:	ff 75 0c             	push   0xc(%ebp)
+  802048:	50                   	push   %eax
+  802049:	e8 97 03 00 00       	call   8023e5 <nsipc_shutdown>
+  80204e:	83 c4 10             	add    $0x10,%esp
+}
+  802051:	c9                   	leave
+  802052:	c3                   	ret
+
+00802053 <connect>:
+{
+  802053:	55                   	push   %ebp
+  802054:	89 e5                	mov    %esp,%ebp
+  802056:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802059:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205c:	e8 97 fe ff ff       	call   801ef8 <fd2sockid>
+  802061:	85 c0                	test   %eax,%eax
+  802063:	78 12                	js     802077 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802065:	83 ec 04             	sub    $0x4,%esp
+  802068:	ff 75 10             	push   0x10(%ebp)
+  80206b:	ff 75 0c             	push   0xc(%ebp)
+  80206e:	50                   	push   %eax
+  80206f:	e8 ad 03 00 00       	call   802421 <nsipc_connect>
+  802074:	83 c4 10             	add    $0x10,%esp
+}
+  802077:	c9                   	leave
+  802078:	c3                   	ret
+
+00802079 <listen>:
+{
+  802079:	55                   	push   %ebp
+  80207a:	89 e5                	mov    %esp,%ebp
+  80207c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80207f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802082:	e8 71 fe ff ff       	call   801ef8 <fd2sockid>
+  802087:	85 c0                	test   %eax,%eax
+  802089:	78 0f                	js     80209a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80208b:	83 ec 08             	sub    $0x8,%esp
+  80208e:	ff 75 0c             	push   0xc(%ebp)
+  802091:	50                   	push   %eax
+  802092:	e8 bf 03 00 00       	call   802456 <nsipc_listen>
+  802097:	83 c4 10             	add    $0x10,%esp
+}
+  80209a:	c9                   	leave
+  80209b:	c3                   	ret
+
+0080209c <sendmsg>:
+{
+  80209c:	55                   	push   %ebp
+  80209d:	89 e5                	mov    %esp,%ebp
+  80209f:	57                   	push   %edi
+  8020a0:	56                   	push   %esi
+  8020a1:	53                   	push   %ebx
+  8020a2:	83 ec 0c             	sub    $0xc,%esp
+  8020a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020a8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8020ab:	89 f0                	mov    %esi,%eax
+  8020ad:	e8 46 fe ff ff       	call   801ef8 <fd2sockid>
+  8020b2:	89 c3                	mov    %eax,%ebx
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	78 1c                	js     8020d4 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8020b8:	89 f0                	mov    %esi,%eax
+  8020ba:	e8 69 fe ff ff       	call   801f28 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8020bf:	0b 45 10             	or     0x10(%ebp),%eax
+  8020c2:	50                   	push   %eax
+  8020c3:	ff 77 0c             	push   0xc(%edi)
+  8020c6:	ff 77 08             	push   0x8(%edi)
+  8020c9:	53                   	push   %ebx
+  8020ca:	e8 7c 04 00 00       	call   80254b <nsipc_sendmsg>
+  8020cf:	89 c3                	mov    %eax,%ebx
+  8020d1:	83 c4 10             	add    $0x10,%esp
+}
+  8020d4:	89 d8                	mov    %ebx,%eax
+  8020d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d9:	5b                   	pop    %ebx
+  8020da:	5e                   	pop    %esi
+  8020db:	5f                   	pop    %edi
+  8020dc:	5d                   	pop    %ebp
+  8020dd:	c3                   	ret
+
+008020de <recvmsg>:
+{
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	57                   	push   %edi
+  8020e2:	56                   	push   %esi
+  8020e3:	53                   	push   %ebx
+  8020e4:	83 ec 0c             	sub    $0xc,%esp
+  8020e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8020ed:	89 f8                	mov    %edi,%eax
+  8020ef:	e8 04 fe ff ff       	call   801ef8 <fd2sockid>
+  8020f4:	89 c3                	mov    %eax,%ebx
+  8020f6:	85 c0                	test   %eax,%eax
+  8020f8:	78 2a                	js     802124 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8020fa:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802101:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802108:	89 f8                	mov    %edi,%eax
+  80210a:	e8 19 fe ff ff       	call   801f28 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80210f:	0b 45 10             	or     0x10(%ebp),%eax
+  802112:	50                   	push   %eax
+  802113:	ff 76 0c             	push   0xc(%esi)
+  802116:	ff 76 08             	push   0x8(%esi)
+  802119:	53                   	push   %ebx
+  80211a:	e8 d6 07 00 00       	call   8028f5 <nsipc_recvmsg>
+  80211f:	89 c3                	mov    %eax,%ebx
+  802121:	83 c4 10             	add    $0x10,%esp
+}
+  802124:	89 d8                	mov    %ebx,%eax
+  802126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802129:	5b                   	pop    %ebx
+  80212a:	5e                   	pop    %esi
+  80212b:	5f                   	pop    %edi
+  80212c:	5d                   	pop    %ebp
+  80212d:	c3                   	ret
+
+0080212e <sendfile>:
+{
+  80212e:	55                   	push   %ebp
+  80212f:	89 e5                	mov    %esp,%ebp
+  802131:	56                   	push   %esi
+  802132:	53                   	push   %ebx
+  802133:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802136:	89 f0                	mov    %esi,%eax
+  802138:	e8 bb fd ff ff       	call   801ef8 <fd2sockid>
+  80213d:	89 c3                	mov    %eax,%ebx
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 1f                	js     802162 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802143:	89 f0                	mov    %esi,%eax
+  802145:	e8 de fd ff ff       	call   801f28 <sock_flags>
+  80214a:	83 ec 0c             	sub    $0xc,%esp
+  80214d:	50                   	push   %eax
+  80214e:	ff 75 14             	push   0x14(%ebp)
+  802151:	ff 75 10             	push   0x10(%ebp)
+  802154:	ff 75 0c             	push   0xc(%ebp)
+  802157:	53                   	push   %ebx
+  802158:	e8 64 06 00 00       	call   8027c1 <nsipc_sendfile>
+  80215d:	89 c3                	mov    %eax,%ebx
+  80215f:	83 c4 20             	add    $0x20,%esp
+}
+  802162:	89 d8                	mov    %ebx,%eax
+  802164:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802167:	5b                   	pop    %ebx
+  802168:	5e                   	pop    %esi
+  802169:	5d                   	pop    %ebp
+  80216a:	c3                   	ret
+
+0080216b <evctl>:
+{
+  80216b:	55                   	push   %ebp
+  80216c:	89 e5                	mov    %esp,%ebp
+  80216e:	53                   	push   %ebx
+  80216f:	83 ec 04             	sub    $0x4,%esp
+  802172:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802175:	89 d8                	mov    %ebx,%eax
+  802177:	e8 7c fd ff ff       	call   801ef8 <fd2sockid>
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	78 10                	js     802190 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802180:	83 ec 04             	sub    $0x4,%esp
+  802183:	53                   	push   %ebx
+  802184:	ff 75 0c             	push   0xc(%ebp)
+  802187:	50                   	push   %eax
+  802188:	e8 d2 0b 00 00       	call   802d5f <nsipc_evctl>
+  80218d:	83 c4 10             	add    $0x10,%esp
+}
+  802190:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802193:	c9                   	leave
+  802194:	c3                   	ret
+
+00802195 <evwait>:
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80219b:	ff 75 10             	push   0x10(%ebp)
+  80219e:	ff 75 0c             	push   0xc(%ebp)
+  8021a1:	ff 75 08             	push   0x8(%ebp)
+  8021a4:	e8 e0 0b 00 00       	call   802d89 <nsipc_evwait>
+}
+  8021a9:	c9                   	leave
+  8021aa:	c3                   	ret
+
+008021ab <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021ab:	55                   	push   %ebp
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021b1:	ff 75 10             	push   0x10(%ebp)
+  8021b4:	ff 75 0c             	push   0xc(%ebp)
+  8021b7:	ff 75 08             	push   0x8(%ebp)
+  8021ba:	e8 31 0c 00 00       	call   802df0 <nsipc_socket>
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 05                	js     8021cb <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8021c6:	e8 89 fd ff ff       	call   801f54 <alloc_sockfd>
+}
+  8021cb:	c9                   	leave
+  8021cc:	c3                   	ret
+
+008021cd <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8021cd:	55                   	push   %ebp
+  8021ce:	89 e5                	mov    %esp,%ebp
+  8021d0:	53                   	push   %ebx
+  8021d1:	83 ec 04             	sub    $0x4,%esp
+  8021d4:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8021d6:	83 3d 24 7b 80 00 00 	cmpl   $0x0,0x807b24
+  8021dd:	74 26                	je     802205 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8021df:	6a 07                	push   $0x7
+  8021e1:	68 00 90 80 00       	push   $0x809000
+  8021e6:	53                   	push   %ebx
+  8021e7:	ff 35 24 7b 80 00    	push   0x807b24
+  8021ed:	e8 12 19 00 00       	call   803b04 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8021f2:	83 c4 0c             	add    $0xc,%esp
+  8021f5:	6a 00                	push   $0x0
+  8021f7:	6a 00                	push   $0x0
+  8021f9:	6a 00                	push   $0x0
+  8021fb:	e8 74 16 00 00       	call   803874 <ipc_recv>
+}
+  802200:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802203:	c9                   	leave
+  802204:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802205:	83 ec 0c             	sub    $0xc,%esp
+  802208:	6a 03                	push   $0x3
+  80220a:	e8 5e 19 00 00       	call   803b6d <ipc_find_env>
+  80220f:	a3 24 7b 80 00       	mov    %eax,0x807b24
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	eb c6                	jmp    8021df <nsipc+0x12>
+
+00802219 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	56                   	push   %esi
+  80221d:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80221e:	8b 35 30 7b 80 00    	mov    0x807b30,%esi
+		return 0;
+  802224:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802229:	85 f6                	test   %esi,%esi
+  80222b:	75 33                	jne    802260 <nsbulk_map+0x47>
+  80222d:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802232:	83 ec 04             	sub    $0x4,%esp
+  802235:	6a 07                	push   $0x7
+  802237:	53                   	push   %ebx
+  802238:	6a 00                	push   $0x0
+  80223a:	e8 fa ed ff ff       	call   801039 <sys_page_alloc>
+  80223f:	83 c4 10             	add    $0x10,%esp
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 1a                	js     802260 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802246:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80224c:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802252:	75 de                	jne    802232 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802254:	c7 05 30 7b 80 00 01 	movl   $0x1,0x807b30
+  80225b:	00 00 00 
+	return 0;
+  80225e:	89 f0                	mov    %esi,%eax
+}
+  802260:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802263:	5b                   	pop    %ebx
+  802264:	5e                   	pop    %esi
+  802265:	5d                   	pop    %ebp
+  802266:	c3                   	ret
+
+00802267 <nsbulk_own>:
+{
+  802267:	55                   	push   %ebp
+  802268:	89 e5                	mov    %esp,%ebp
+  80226a:	57                   	push   %edi
+  80226b:	56                   	push   %esi
+  80226c:	53                   	push   %ebx
+  80226d:	83 ec 0c             	sub    $0xc,%esp
+  802270:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802272:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802275:	85 d2                	test   %edx,%edx
+  802277:	7f 0e                	jg     802287 <nsbulk_own+0x20>
+	return 0;
+  802279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227e:	eb 47                	jmp    8022c7 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802280:	83 c3 01             	add    $0x1,%ebx
+  802283:	39 fb                	cmp    %edi,%ebx
+  802285:	7d 3b                	jge    8022c2 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802287:	be 01 00 00 00       	mov    $0x1,%esi
+  80228c:	89 d9                	mov    %ebx,%ecx
+  80228e:	d3 e6                	shl    %cl,%esi
+  802290:	89 f0                	mov    %esi,%eax
+  802292:	23 05 2c 7b 80 00    	and    0x807b2c,%eax
+  802298:	74 e6                	je     802280 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80229a:	83 ec 04             	sub    $0x4,%esp
+  80229d:	6a 07                	push   $0x7
+  80229f:	89 d8                	mov    %ebx,%eax
+  8022a1:	c1 e0 0c             	shl    $0xc,%eax
+  8022a4:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8022a9:	50                   	push   %eax
+  8022aa:	6a 00                	push   $0x0
+  8022ac:	e8 88 ed ff ff       	call   801039 <sys_page_alloc>
+  8022b1:	83 c4 10             	add    $0x10,%esp
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	78 0f                	js     8022c7 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8022b8:	f7 d6                	not    %esi
+  8022ba:	21 35 2c 7b 80 00    	and    %esi,0x807b2c
+  8022c0:	eb be                	jmp    802280 <nsbulk_own+0x19>
+	return 0;
+  8022c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	5d                   	pop    %ebp
+  8022ce:	c3                   	ret
+
+008022cf <nsipc_bulk>:
+{
+  8022cf:	55                   	push   %ebp
+  8022d0:	89 e5                	mov    %esp,%ebp
+  8022d2:	57                   	push   %edi
+  8022d3:	56                   	push   %esi
+  8022d4:	53                   	push   %ebx
+  8022d5:	83 ec 1c             	sub    $0x1c,%esp
+  8022d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022db:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8022dd:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8022e3:	c1 fb 0c             	sar    $0xc,%ebx
+  8022e6:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8022e9:	83 3d 24 7b 80 00 00 	cmpl   $0x0,0x807b24
+  8022f0:	74 56                	je     802348 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8022f2:	85 ff                	test   %edi,%edi
+  8022f4:	7e 24                	jle    80231a <nsipc_bulk+0x4b>
+  8022f6:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8022fc:	74 1c                	je     80231a <nsipc_bulk+0x4b>
+  8022fe:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802304:	c1 e3 0c             	shl    $0xc,%ebx
+  802307:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80230c:	0f b6 10             	movzbl (%eax),%edx
+  80230f:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802311:	05 00 10 00 00       	add    $0x1000,%eax
+  802316:	39 d8                	cmp    %ebx,%eax
+  802318:	75 f2                	jne    80230c <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80231a:	83 ec 0c             	sub    $0xc,%esp
+  80231d:	56                   	push   %esi
+  80231e:	57                   	push   %edi
+  80231f:	68 00 00 00 e0       	push   $0xe0000000
+  802324:	ff 75 e4             	push   -0x1c(%ebp)
+  802327:	ff 35 24 7b 80 00    	push   0x807b24
+  80232d:	e8 06 18 00 00       	call   803b38 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802332:	83 c4 1c             	add    $0x1c,%esp
+  802335:	6a 00                	push   $0x0
+  802337:	6a 00                	push   $0x0
+  802339:	6a 00                	push   $0x0
+  80233b:	e8 34 15 00 00       	call   803874 <ipc_recv>
+}
+  802340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802343:	5b                   	pop    %ebx
+  802344:	5e                   	pop    %esi
+  802345:	5f                   	pop    %edi
+  802346:	5d                   	pop    %ebp
+  802347:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802348:	83 ec 0c             	sub    $0xc,%esp
+  80234b:	6a 03                	push   $0x3
+  80234d:	e8 1b 18 00 00       	call   803b6d <ipc_find_env>
+  802352:	a3 24 7b 80 00       	mov    %eax,0x807b24
+  802357:	83 c4 10             	add    $0x10,%esp
+  80235a:	eb 96                	jmp    8022f2 <nsipc_bulk+0x23>
+
+0080235c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  80235c:	55                   	push   %ebp
+  80235d:	89 e5                	mov    %esp,%ebp
+  80235f:	53                   	push   %ebx
+  802360:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802363:	8b 45 08             	mov    0x8(%ebp),%eax
+  802366:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_flags = flags;
+  80236b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80236e:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802373:	b8 01 00 00 00       	mov    $0x1,%eax
+  802378:	e8 50 fe ff ff       	call   8021cd <nsipc>
+  80237d:	89 c3                	mov    %eax,%ebx
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	79 07                	jns    80238a <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802383:	89 d8                	mov    %ebx,%eax
+  802385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802388:	c9                   	leave
+  802389:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80238a:	83 ec 04             	sub    $0x4,%esp
+  80238d:	ff 35 10 90 80 00    	push   0x809010
+  802393:	68 00 90 80 00       	push   $0x809000
+  802398:	ff 75 0c             	push   0xc(%ebp)
+  80239b:	e8 15 ea ff ff       	call   800db5 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8023a0:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  8023a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023a9:	89 10                	mov    %edx,(%eax)
+  8023ab:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8023ae:	eb d3                	jmp    802383 <nsipc_accept+0x27>
+
+008023b0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8023b0:	55                   	push   %ebp
+  8023b1:	89 e5                	mov    %esp,%ebp
+  8023b3:	53                   	push   %ebx
+  8023b4:	83 ec 08             	sub    $0x8,%esp
+  8023b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8023ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bd:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8023c2:	53                   	push   %ebx
+  8023c3:	ff 75 0c             	push   0xc(%ebp)
+  8023c6:	68 04 90 80 00       	push   $0x809004
+  8023cb:	e8 e5 e9 ff ff       	call   800db5 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8023d0:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8023d6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023db:	e8 ed fd ff ff       	call   8021cd <nsipc>
+}
+  8023e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e3:	c9                   	leave
+  8023e4:	c3                   	ret
+
+008023e5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8023e5:	55                   	push   %ebp
+  8023e6:	89 e5                	mov    %esp,%ebp
+  8023e8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8023eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ee:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8023f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f6:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8023fb:	b8 03 00 00 00       	mov    $0x3,%eax
+  802400:	e8 c8 fd ff ff       	call   8021cd <nsipc>
+}
+  802405:	c9                   	leave
+  802406:	c3                   	ret
+
+00802407 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802407:	55                   	push   %ebp
+  802408:	89 e5                	mov    %esp,%ebp
+  80240a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80240d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802410:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802415:	b8 04 00 00 00       	mov    $0x4,%eax
+  80241a:	e8 ae fd ff ff       	call   8021cd <nsipc>
+}
+  80241f:	c9                   	leave
+  802420:	c3                   	ret
+
+00802421 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	53                   	push   %ebx
+  802425:	83 ec 08             	sub    $0x8,%esp
+  802428:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80242b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242e:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802433:	53                   	push   %ebx
+  802434:	ff 75 0c             	push   0xc(%ebp)
+  802437:	68 04 90 80 00       	push   $0x809004
+  80243c:	e8 74 e9 ff ff       	call   800db5 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802441:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802447:	b8 05 00 00 00       	mov    $0x5,%eax
+  80244c:	e8 7c fd ff ff       	call   8021cd <nsipc>
+}
+  802451:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802454:	c9                   	leave
+  802455:	c3                   	ret
+
+00802456 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802456:	55                   	push   %ebp
+  802457:	89 e5                	mov    %esp,%ebp
+  802459:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80245c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802464:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802467:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  80246c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802471:	e8 57 fd ff ff       	call   8021cd <nsipc>
+}
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+00802478 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802478:	55                   	push   %ebp
+  802479:	89 e5                	mov    %esp,%ebp
+  80247b:	56                   	push   %esi
+  80247c:	53                   	push   %ebx
+  80247d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802480:	8b 45 08             	mov    0x8(%ebp),%eax
+  802483:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802488:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  80248e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802491:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802496:	b8 07 00 00 00       	mov    $0x7,%eax
+  80249b:	e8 2d fd ff ff       	call   8021cd <nsipc>
+  8024a0:	89 c3                	mov    %eax,%ebx
+  8024a2:	85 c0                	test   %eax,%eax
+  8024a4:	78 22                	js     8024c8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8024a6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8024ab:	39 c6                	cmp    %eax,%esi
+  8024ad:	0f 4e c6             	cmovle %esi,%eax
+  8024b0:	39 c3                	cmp    %eax,%ebx
+  8024b2:	7f 1d                	jg     8024d1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8024b4:	83 ec 04             	sub    $0x4,%esp
+  8024b7:	53                   	push   %ebx
+  8024b8:	68 00 90 80 00       	push   $0x809000
+  8024bd:	ff 75 0c             	push   0xc(%ebp)
+  8024c0:	e8 f0 e8 ff ff       	call   800db5 <memmove>
+  8024c5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8024c8:	89 d8                	mov    %ebx,%eax
+  8024ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024cd:	5b                   	pop    %ebx
+  8024ce:	5e                   	pop    %esi
+  8024cf:	5d                   	pop    %ebp
+  8024d0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8024d1:	68 54 46 80 00       	push   $0x804654
+  8024d6:	68 69 46 80 00       	push   $0x804669
+  8024db:	68 b2 00 00 00       	push   $0xb2
+  8024e0:	68 7e 46 80 00       	push   $0x80467e
+  8024e5:	e8 49 df ff ff       	call   800433 <_panic>
+
+008024ea <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8024ea:	55                   	push   %ebp
+  8024eb:	89 e5                	mov    %esp,%ebp
+  8024ed:	53                   	push   %ebx
+  8024ee:	83 ec 04             	sub    $0x4,%esp
+  8024f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8024f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f7:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8024fc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802502:	7f 2e                	jg     802532 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802504:	83 ec 04             	sub    $0x4,%esp
+  802507:	53                   	push   %ebx
+  802508:	ff 75 0c             	push   0xc(%ebp)
+  80250b:	68 0c 90 80 00       	push   $0x80900c
+  802510:	e8 a0 e8 ff ff       	call   800db5 <memmove>
+	nsipcbuf.send.req_size = size;
+  802515:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80251b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80251e:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802523:	b8 08 00 00 00       	mov    $0x8,%eax
+  802528:	e8 a0 fc ff ff       	call   8021cd <nsipc>
+}
+  80252d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802530:	c9                   	leave
+  802531:	c3                   	ret
+	assert(size < 1600);
+  802532:	68 8a 46 80 00       	push   $0x80468a
+  802537:	68 69 46 80 00       	push   $0x804669
+  80253c:	68 bd 00 00 00       	push   $0xbd
+  802541:	68 7e 46 80 00       	push   $0x80467e
+  802546:	e8 e8 de ff ff       	call   800433 <_panic>
+
+0080254b <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80254b:	55                   	push   %ebp
+  80254c:	89 e5                	mov    %esp,%ebp
+  80254e:	57                   	push   %edi
+  80254f:	56                   	push   %esi
+  802550:	53                   	push   %ebx
+  802551:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802554:	e8 c0 fc ff ff       	call   802219 <nsbulk_map>
+  802559:	85 c0                	test   %eax,%eax
+  80255b:	78 55                	js     8025b2 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  80255d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802564:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  80256b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802572:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802575:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802578:	0f 8d 24 02 00 00    	jge    8027a2 <nsipc_sendmsg+0x257>
+  80257e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802581:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802584:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802587:	89 d8                	mov    %ebx,%eax
+  802589:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80258e:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802590:	83 ec 0c             	sub    $0xc,%esp
+  802593:	68 20 78 80 00       	push   $0x807820
+  802598:	e8 5a 0f 00 00       	call   8034f7 <pgbatch_init>
+  80259d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8025a0:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8025a2:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8025a5:	e9 82 00 00 00       	jmp    80262c <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8025aa:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025ad:	85 db                	test   %ebx,%ebx
+  8025af:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8025b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b5:	5b                   	pop    %ebx
+  8025b6:	5e                   	pop    %esi
+  8025b7:	5f                   	pop    %edi
+  8025b8:	5d                   	pop    %ebp
+  8025b9:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8025ba:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025bf:	29 c8                	sub    %ecx,%eax
+  8025c1:	39 d0                	cmp    %edx,%eax
+  8025c3:	0f 46 d0             	cmovbe %eax,%edx
+  8025c6:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8025c8:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8025ce:	85 ff                	test   %edi,%edi
+  8025d0:	0f 49 c7             	cmovns %edi,%eax
+  8025d3:	c1 f8 0c             	sar    $0xc,%eax
+  8025d6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025db:	e8 87 fc ff ff       	call   802267 <nsbulk_own>
+  8025e0:	85 c0                	test   %eax,%eax
+  8025e2:	0f 88 17 01 00 00    	js     8026ff <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8025e8:	83 ec 04             	sub    $0x4,%esp
+  8025eb:	56                   	push   %esi
+  8025ec:	ff 75 e0             	push   -0x20(%ebp)
+  8025ef:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025f2:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8025f7:	50                   	push   %eax
+  8025f8:	e8 b8 e7 ff ff       	call   800db5 <memmove>
+  8025fd:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802600:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802603:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802606:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802609:	0f 84 fd 00 00 00    	je     80270c <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80260f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802612:	01 f7                	add    %esi,%edi
+  802614:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802617:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80261a:	0f 8d 01 01 00 00    	jge    802721 <nsipc_sendmsg+0x1d6>
+  802620:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802626:	0f 8f f0 00 00 00    	jg     80271c <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80262c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80262f:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802632:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802635:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802638:	89 c2                	mov    %eax,%edx
+  80263a:	03 13                	add    (%ebx),%edx
+  80263c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80263f:	8b 73 04             	mov    0x4(%ebx),%esi
+  802642:	29 c6                	sub    %eax,%esi
+  802644:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802649:	29 f9                	sub    %edi,%ecx
+  80264b:	39 ce                	cmp    %ecx,%esi
+  80264d:	89 ca                	mov    %ecx,%edx
+  80264f:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802652:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802655:	89 f9                	mov    %edi,%ecx
+  802657:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  80265d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802660:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802665:	09 c8                	or     %ecx,%eax
+  802667:	0f 85 4d ff ff ff    	jne    8025ba <nsipc_sendmsg+0x6f>
+  80266d:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802673:	0f 86 41 ff ff ff    	jbe    8025ba <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802679:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80267f:	85 ff                	test   %edi,%edi
+  802681:	0f 49 c7             	cmovns %edi,%eax
+  802684:	c1 f8 0c             	sar    $0xc,%eax
+  802687:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802689:	89 d1                	mov    %edx,%ecx
+  80268b:	c1 e9 0c             	shr    $0xc,%ecx
+  80268e:	01 c8                	add    %ecx,%eax
+  802690:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802693:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802696:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802698:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80269b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8026a0:	29 c8                	sub    %ecx,%eax
+  8026a2:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8026a5:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8026a8:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8026aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026af:	89 f9                	mov    %edi,%ecx
+  8026b1:	d3 e0                	shl    %cl,%eax
+  8026b3:	09 05 2c 7b 80 00    	or     %eax,0x807b2c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8026b9:	83 ec 08             	sub    $0x8,%esp
+  8026bc:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8026be:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8026c1:	50                   	push   %eax
+  8026c2:	6a 00                	push   $0x0
+  8026c4:	56                   	push   %esi
+  8026c5:	6a 00                	push   $0x0
+  8026c7:	68 20 78 80 00       	push   $0x807820
+  8026cc:	e8 e4 0e 00 00       	call   8035b5 <pgbatch_map>
+  8026d1:	83 c4 20             	add    $0x20,%esp
+  8026d4:	85 c0                	test   %eax,%eax
+  8026d6:	0f 88 ce fe ff ff    	js     8025aa <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8026dc:	83 c7 01             	add    $0x1,%edi
+  8026df:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8026e5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8026e8:	39 c7                	cmp    %eax,%edi
+  8026ea:	75 be                	jne    8026aa <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8026ec:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8026ef:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8026f2:	89 d6                	mov    %edx,%esi
+  8026f4:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8026fa:	e9 01 ff ff ff       	jmp    802600 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8026ff:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802702:	85 db                	test   %ebx,%ebx
+  802704:	0f 45 c3             	cmovne %ebx,%eax
+  802707:	e9 a6 fe ff ff       	jmp    8025b2 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80270c:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802710:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802717:	e9 f3 fe ff ff       	jmp    80260f <nsipc_sendmsg+0xc4>
+  80271c:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80271f:	eb 03                	jmp    802724 <nsipc_sendmsg+0x1d9>
+  802721:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802724:	83 ec 0c             	sub    $0xc,%esp
+  802727:	68 20 78 80 00       	push   $0x807820
+  80272c:	e8 d4 0d 00 00       	call   803505 <pgbatch_flush>
+  802731:	83 c4 10             	add    $0x10,%esp
+  802734:	85 c0                	test   %eax,%eax
+  802736:	78 50                	js     802788 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802738:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273b:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802740:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802746:	89 fb                	mov    %edi,%ebx
+  802748:	29 f3                	sub    %esi,%ebx
+  80274a:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802750:	8b 45 14             	mov    0x14(%ebp),%eax
+  802753:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802758:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80275d:	89 fa                	mov    %edi,%edx
+  80275f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802764:	e8 66 fb ff ff       	call   8022cf <nsipc_bulk>
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	78 28                	js     802795 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80276d:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802770:	39 c3                	cmp    %eax,%ebx
+  802772:	75 0c                	jne    802780 <nsipc_sendmsg+0x235>
+  802774:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802777:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80277a:	0f 8f f2 fd ff ff    	jg     802572 <nsipc_sendmsg+0x27>
+		sent += r;
+  802780:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802783:	e9 2a fe ff ff       	jmp    8025b2 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802788:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80278b:	85 db                	test   %ebx,%ebx
+  80278d:	0f 45 c3             	cmovne %ebx,%eax
+  802790:	e9 1d fe ff ff       	jmp    8025b2 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802795:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802798:	85 db                	test   %ebx,%ebx
+  80279a:	0f 45 c3             	cmovne %ebx,%eax
+  80279d:	e9 10 fe ff ff       	jmp    8025b2 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8027a2:	83 ec 0c             	sub    $0xc,%esp
+  8027a5:	68 20 78 80 00       	push   $0x807820
+  8027aa:	e8 48 0d 00 00       	call   8034f7 <pgbatch_init>
+  8027af:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8027b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027bc:	e9 63 ff ff ff       	jmp    802724 <nsipc_sendmsg+0x1d9>
+
+008027c1 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8027c1:	55                   	push   %ebp
+  8027c2:	89 e5                	mov    %esp,%ebp
+  8027c4:	57                   	push   %edi
+  8027c5:	56                   	push   %esi
+  8027c6:	53                   	push   %ebx
+  8027c7:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8027ca:	83 3d 28 7b 80 00 00 	cmpl   $0x0,0x807b28
+  8027d1:	0f 84 c8 00 00 00    	je     80289f <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8027d7:	83 3d 24 7b 80 00 00 	cmpl   $0x0,0x807b24
+  8027de:	0f 84 e4 00 00 00    	je     8028c8 <nsipc_sendfile+0x107>
+{
+  8027e4:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8027e9:	89 fb                	mov    %edi,%ebx
+  8027eb:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8027ee:	0f 83 f0 00 00 00    	jae    8028e4 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8027f4:	89 fa                	mov    %edi,%edx
+  8027f6:	03 55 10             	add    0x10(%ebp),%edx
+  8027f9:	89 d0                	mov    %edx,%eax
+  8027fb:	c1 f8 1f             	sar    $0x1f,%eax
+  8027fe:	c1 e8 14             	shr    $0x14,%eax
+  802801:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802804:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80280a:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80280c:	6a 10                	push   $0x10
+  80280e:	68 00 20 01 e0       	push   $0xe0012000
+  802813:	52                   	push   %edx
+  802814:	ff 75 0c             	push   0xc(%ebp)
+  802817:	e8 fe f4 ff ff       	call   801d1a <fmap>
+  80281c:	83 c4 10             	add    $0x10,%esp
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	0f 8e b8 00 00 00    	jle    8028df <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802827:	39 c6                	cmp    %eax,%esi
+  802829:	0f 8d b5 00 00 00    	jge    8028e4 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80282f:	29 f0                	sub    %esi,%eax
+  802831:	8b 55 14             	mov    0x14(%ebp),%edx
+  802834:	29 da                	sub    %ebx,%edx
+  802836:	39 d0                	cmp    %edx,%eax
+  802838:	89 d3                	mov    %edx,%ebx
+  80283a:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80283d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802840:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802845:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80284b:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802851:	8b 45 18             	mov    0x18(%ebp),%eax
+  802854:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802859:	83 ec 0c             	sub    $0xc,%esp
+  80285c:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80285e:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802865:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802868:	83 c0 01             	add    $0x1,%eax
+  80286b:	50                   	push   %eax
+  80286c:	68 00 10 01 e0       	push   $0xe0011000
+  802871:	6a 11                	push   $0x11
+  802873:	ff 35 24 7b 80 00    	push   0x807b24
+  802879:	e8 ba 12 00 00       	call   803b38 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80287e:	83 c4 1c             	add    $0x1c,%esp
+  802881:	6a 00                	push   $0x0
+  802883:	6a 00                	push   $0x0
+  802885:	6a 00                	push   $0x0
+  802887:	e8 e8 0f 00 00       	call   803874 <ipc_recv>
+  80288c:	83 c4 10             	add    $0x10,%esp
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	78 5b                	js     8028ee <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802893:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802895:	39 c3                	cmp    %eax,%ebx
+  802897:	0f 8e 4c ff ff ff    	jle    8027e9 <nsipc_sendfile+0x28>
+  80289d:	eb 45                	jmp    8028e4 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80289f:	83 ec 04             	sub    $0x4,%esp
+  8028a2:	6a 07                	push   $0x7
+  8028a4:	68 00 10 01 e0       	push   $0xe0011000
+  8028a9:	6a 00                	push   $0x0
+  8028ab:	e8 89 e7 ff ff       	call   801039 <sys_page_alloc>
+  8028b0:	89 c7                	mov    %eax,%edi
+  8028b2:	83 c4 10             	add    $0x10,%esp
+  8028b5:	85 c0                	test   %eax,%eax
+  8028b7:	78 2b                	js     8028e4 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8028b9:	c7 05 28 7b 80 00 01 	movl   $0x1,0x807b28
+  8028c0:	00 00 00 
+  8028c3:	e9 0f ff ff ff       	jmp    8027d7 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028c8:	83 ec 0c             	sub    $0xc,%esp
+  8028cb:	6a 03                	push   $0x3
+  8028cd:	e8 9b 12 00 00       	call   803b6d <ipc_find_env>
+  8028d2:	a3 24 7b 80 00       	mov    %eax,0x807b24
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	e9 05 ff ff ff       	jmp    8027e4 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8028df:	85 ff                	test   %edi,%edi
+  8028e1:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8028e4:	89 f8                	mov    %edi,%eax
+  8028e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028e9:	5b                   	pop    %ebx
+  8028ea:	5e                   	pop    %esi
+  8028eb:	5f                   	pop    %edi
+  8028ec:	5d                   	pop    %ebp
+  8028ed:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8028ee:	85 ff                	test   %edi,%edi
+  8028f0:	0f 44 f8             	cmove  %eax,%edi
+  8028f3:	eb ef                	jmp    8028e4 <nsipc_sendfile+0x123>
+
+008028f5 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	57                   	push   %edi
+  8028f9:	56                   	push   %esi
+  8028fa:	53                   	push   %ebx
+  8028fb:	83 ec 1c             	sub    $0x1c,%esp
+  8028fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802901:	e8 13 f9 ff ff       	call   802219 <nsbulk_map>
+  802906:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802909:	85 c0                	test   %eax,%eax
+  80290b:	0f 88 ba 00 00 00    	js     8029cb <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802911:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802915:	0f 8e bb 00 00 00    	jle    8029d6 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80291b:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802920:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802925:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80292a:	89 f8                	mov    %edi,%eax
+  80292c:	29 f0                	sub    %esi,%eax
+  80292e:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802932:	39 c8                	cmp    %ecx,%eax
+  802934:	0f 47 c1             	cmova  %ecx,%eax
+  802937:	01 f0                	add    %esi,%eax
+  802939:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80293b:	83 c2 01             	add    $0x1,%edx
+  80293e:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802941:	7e 07                	jle    80294a <nsipc_recvmsg+0x55>
+  802943:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802948:	7e e0                	jle    80292a <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80294a:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802950:	c1 fa 0c             	sar    $0xc,%edx
+  802953:	b8 00 00 00 00       	mov    $0x0,%eax
+  802958:	e8 0a f9 ff ff       	call   802267 <nsbulk_own>
+  80295d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802960:	85 c0                	test   %eax,%eax
+  802962:	78 67                	js     8029cb <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802964:	8b 45 08             	mov    0x8(%ebp),%eax
+  802967:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80296c:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802972:	8b 45 14             	mov    0x14(%ebp),%eax
+  802975:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80297a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80297f:	89 f2                	mov    %esi,%edx
+  802981:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802986:	e8 44 f9 ff ff       	call   8022cf <nsipc_bulk>
+  80298b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80298e:	85 c0                	test   %eax,%eax
+  802990:	78 39                	js     8029cb <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802992:	39 f0                	cmp    %esi,%eax
+  802994:	7f 4a                	jg     8029e0 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802996:	bf 00 00 00 00       	mov    $0x0,%edi
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	7e 2c                	jle    8029cb <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80299f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8029a2:	29 fe                	sub    %edi,%esi
+  8029a4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029a7:	39 c6                	cmp    %eax,%esi
+  8029a9:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8029ac:	83 ec 04             	sub    $0x4,%esp
+  8029af:	56                   	push   %esi
+  8029b0:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8029b6:	50                   	push   %eax
+  8029b7:	ff 33                	push   (%ebx)
+  8029b9:	e8 f7 e3 ff ff       	call   800db5 <memmove>
+		n += m;
+  8029be:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8029c0:	83 c3 08             	add    $0x8,%ebx
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8029c9:	7f d4                	jg     80299f <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8029cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029d1:	5b                   	pop    %ebx
+  8029d2:	5e                   	pop    %esi
+  8029d3:	5f                   	pop    %edi
+  8029d4:	5d                   	pop    %ebp
+  8029d5:	c3                   	ret
+	int r, i, n, len = 0;
+  8029d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029db:	e9 6a ff ff ff       	jmp    80294a <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8029e0:	68 60 46 80 00       	push   $0x804660
+  8029e5:	68 69 46 80 00       	push   $0x804669
+  8029ea:	68 3b 01 00 00       	push   $0x13b
+  8029ef:	68 7e 46 80 00       	push   $0x80467e
+  8029f4:	e8 3a da ff ff       	call   800433 <_panic>
+
+008029f9 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8029f9:	55                   	push   %ebp
+  8029fa:	89 e5                	mov    %esp,%ebp
+  8029fc:	57                   	push   %edi
+  8029fd:	56                   	push   %esi
+  8029fe:	53                   	push   %ebx
+  8029ff:	83 ec 0c             	sub    $0xc,%esp
+  802a02:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802a05:	8b 75 10             	mov    0x10(%ebp),%esi
+  802a08:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.select.req_readset = *readset;
+  802a13:	8b 07                	mov    (%edi),%eax
+  802a15:	a3 04 90 80 00       	mov    %eax,0x809004
+  802a1a:	8b 47 04             	mov    0x4(%edi),%eax
+  802a1d:	a3 08 90 80 00       	mov    %eax,0x809008
+  802a22:	8b 47 08             	mov    0x8(%edi),%eax
+  802a25:	a3 0c 90 80 00       	mov    %eax,0x80900c
+  802a2a:	8b 47 0c             	mov    0xc(%edi),%eax
+  802a2d:	a3 10 90 80 00       	mov    %eax,0x809010
+  802a32:	8b 47 10             	mov    0x10(%edi),%eax
+  802a35:	a3 14 90 80 00       	mov    %eax,0x809014
+  802a3a:	8b 47 14             	mov    0x14(%edi),%eax
+  802a3d:	a3 18 90 80 00       	mov    %eax,0x809018
+  802a42:	8b 47 18             	mov    0x18(%edi),%eax
+  802a45:	a3 1c 90 80 00       	mov    %eax,0x80901c
+  802a4a:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802a4d:	a3 20 90 80 00       	mov    %eax,0x809020
+  802a52:	8b 47 20             	mov    0x20(%edi),%eax
+  802a55:	a3 24 90 80 00       	mov    %eax,0x809024
+  802a5a:	8b 47 24             	mov    0x24(%edi),%eax
+  802a5d:	a3 28 90 80 00       	mov    %eax,0x809028
+  802a62:	8b 47 28             	mov    0x28(%edi),%eax
+  802a65:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  802a6a:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802a6d:	a3 30 90 80 00       	mov    %eax,0x809030
+  802a72:	8b 47 30             	mov    0x30(%edi),%eax
+  802a75:	a3 34 90 80 00       	mov    %eax,0x809034
+  802a7a:	8b 47 34             	mov    0x34(%edi),%eax
+  802a7d:	a3 38 90 80 00       	mov    %eax,0x809038
+  802a82:	8b 47 38             	mov    0x38(%edi),%eax
+  802a85:	a3 3c 90 80 00       	mov    %eax,0x80903c
+  802a8a:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802a8d:	a3 40 90 80 00       	mov    %eax,0x809040
+	nsipcbuf.select.req_writeset = *writeset;
+  802a92:	8b 06                	mov    (%esi),%eax
+  802a94:	a3 44 90 80 00       	mov    %eax,0x809044
+  802a99:	8b 46 04             	mov    0x4(%esi),%eax
+  802a9c:	a3 48 90 80 00       	mov    %eax,0x809048
+  802aa1:	8b 46 08             	mov    0x8(%esi),%eax
+  802aa4:	a3 4c 90 80 00       	mov    %eax,0x80904c
+  802aa9:	8b 46 0c             	mov    0xc(%esi),%eax
+  802aac:	a3 50 90 80 00       	mov    %eax,0x809050
+  802ab1:	8b 46 10             	mov    0x10(%esi),%eax
+  802ab4:	a3 54 90 80 00       	mov    %eax,0x809054
+  802ab9:	8b 46 14             	mov    0x14(%esi),%eax
+  802abc:	a3 58 90 80 00       	mov    %eax,0x809058
+  802ac1:	8b 46 18             	mov    0x18(%esi),%eax
+  802ac4:	a3 5c 90 80 00       	mov    %eax,0x80905c
+  802ac9:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802acc:	a3 60 90 80 00       	mov    %eax,0x809060
+  802ad1:	8b 46 20             	mov    0x20(%esi),%eax
+  802ad4:	a3 64 90 80 00       	mov    %eax,0x809064
+  802ad9:	8b 46 24             	mov    0x24(%esi),%eax
+  802adc:	a3 68 90 80 00       	mov    %eax,0x809068
+  802ae1:	8b 46 28             	mov    0x28(%esi),%eax
+  802ae4:	a3 6c 90 80 00       	mov    %eax,0x80906c
+  802ae9:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802aec:	a3 70 90 80 00       	mov    %eax,0x809070
+  802af1:	8b 46 30             	mov    0x30(%esi),%eax
+  802af4:	a3 74 90 80 00       	mov    %eax,0x809074
+  802af9:	8b 46 34             	mov    0x34(%esi),%eax
+  802afc:	a3 78 90 80 00       	mov    %eax,0x809078
+  802b01:	8b 46 38             	mov    0x38(%esi),%eax
+  802b04:	a3 7c 90 80 00       	mov    %eax,0x80907c
+  802b09:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802b0c:	a3 80 90 80 00       	mov    %eax,0x809080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802b11:	8b 03                	mov    (%ebx),%eax
+  802b13:	a3 84 90 80 00       	mov    %eax,0x809084
+  802b18:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b1b:	a3 88 90 80 00       	mov    %eax,0x809088
+  802b20:	8b 43 08             	mov    0x8(%ebx),%eax
+  802b23:	a3 8c 90 80 00       	mov    %eax,0x80908c
+  802b28:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802b2b:	a3 90 90 80 00       	mov    %eax,0x809090
+  802b30:	8b 43 10             	mov    0x10(%ebx),%eax
+  802b33:	a3 94 90 80 00       	mov    %eax,0x809094
+  802b38:	8b 43 14             	mov    0x14(%ebx),%eax
+  802b3b:	a3 98 90 80 00       	mov    %eax,0x809098
+  802b40:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b43:	a3 9c 90 80 00       	mov    %eax,0x80909c
+  802b48:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802b4b:	a3 a0 90 80 00       	mov    %eax,0x8090a0
+  802b50:	8b 43 20             	mov    0x20(%ebx),%eax
+  802b53:	a3 a4 90 80 00       	mov    %eax,0x8090a4
+  802b58:	8b 43 24             	mov    0x24(%ebx),%eax
+  802b5b:	a3 a8 90 80 00       	mov    %eax,0x8090a8
+  802b60:	8b 43 28             	mov    0x28(%ebx),%eax
+  802b63:	a3 ac 90 80 00       	mov    %eax,0x8090ac
+  802b68:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802b6b:	a3 b0 90 80 00       	mov    %eax,0x8090b0
+  802b70:	8b 43 30             	mov    0x30(%ebx),%eax
+  802b73:	a3 b4 90 80 00       	mov    %eax,0x8090b4
+  802b78:	8b 43 34             	mov    0x34(%ebx),%eax
+  802b7b:	a3 b8 90 80 00       	mov    %eax,0x8090b8
+  802b80:	8b 43 38             	mov    0x38(%ebx),%eax
+  802b83:	a3 bc 90 80 00       	mov    %eax,0x8090bc
+  802b88:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802b8b:	a3 c0 90 80 00       	mov    %eax,0x8090c0
+	nsipcbuf.select.req_timeout = msec;
+  802b90:	8b 45 18             	mov    0x18(%ebp),%eax
+  802b93:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802b98:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802b9d:	e8 2b f6 ff ff       	call   8021cd <nsipc>
+  802ba2:	85 c0                	test   %eax,%eax
+  802ba4:	0f 88 ad 01 00 00    	js     802d57 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802baa:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  802bb0:	89 17                	mov    %edx,(%edi)
+  802bb2:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  802bb8:	89 57 04             	mov    %edx,0x4(%edi)
+  802bbb:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  802bc1:	89 57 08             	mov    %edx,0x8(%edi)
+  802bc4:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  802bca:	89 57 0c             	mov    %edx,0xc(%edi)
+  802bcd:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  802bd3:	89 57 10             	mov    %edx,0x10(%edi)
+  802bd6:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  802bdc:	89 57 14             	mov    %edx,0x14(%edi)
+  802bdf:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  802be5:	89 57 18             	mov    %edx,0x18(%edi)
+  802be8:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  802bee:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802bf1:	8b 15 24 90 80 00    	mov    0x809024,%edx
+  802bf7:	89 57 20             	mov    %edx,0x20(%edi)
+  802bfa:	8b 15 28 90 80 00    	mov    0x809028,%edx
+  802c00:	89 57 24             	mov    %edx,0x24(%edi)
+  802c03:	8b 15 2c 90 80 00    	mov    0x80902c,%edx
+  802c09:	89 57 28             	mov    %edx,0x28(%edi)
+  802c0c:	8b 15 30 90 80 00    	mov    0x809030,%edx
+  802c12:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802c15:	8b 15 34 90 80 00    	mov    0x809034,%edx
+  802c1b:	89 57 30             	mov    %edx,0x30(%edi)
+  802c1e:	8b 15 38 90 80 00    	mov    0x809038,%edx
+  802c24:	89 57 34             	mov    %edx,0x34(%edi)
+  802c27:	8b 15 3c 90 80 00    	mov    0x80903c,%edx
+  802c2d:	89 57 38             	mov    %edx,0x38(%edi)
+  802c30:	8b 15 40 90 80 00    	mov    0x809040,%edx
+  802c36:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802c39:	8b 15 44 90 80 00    	mov    0x809044,%edx
+  802c3f:	89 16                	mov    %edx,(%esi)
+  802c41:	8b 15 48 90 80 00    	mov    0x809048,%edx
+  802c47:	89 56 04             	mov    %edx,0x4(%esi)
+  802c4a:	8b 15 4c 90 80 00    	mov    0x80904c,%edx
+  802c50:	89 56 08             	mov    %edx,0x8(%esi)
+  802c53:	8b 15 50 90 80 00    	mov    0x809050,%edx
+  802c59:	89 56 0c             	mov    %edx,0xc(%esi)
+  802c5c:	8b 15 54 90 80 00    	mov    0x809054,%edx
+  802c62:	89 56 10             	mov    %edx,0x10(%esi)
+  802c65:	8b 15 58 90 80 00    	mov    0x809058,%edx
+  802c6b:	89 56 14             	mov    %edx,0x14(%esi)
+  802c6e:	8b 15 5c 90 80 00    	mov    0x80905c,%edx
+  802c74:	89 56 18             	mov    %edx,0x18(%esi)
+  802c77:	8b 15 60 90 80 00    	mov    0x809060,%edx
+  802c7d:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802c80:	8b 15 64 90 80 00    	mov    0x809064,%edx
+  802c86:	89 56 20             	mov    %edx,0x20(%esi)
+  802c89:	8b 15 68 90 80 00    	mov    0x809068,%edx
+  802c8f:	89 56 24             	mov    %edx,0x24(%esi)
+  802c92:	8b 15 6c 90 80 00    	mov    0x80906c,%edx
+  802c98:	89 56 28             	mov    %edx,0x28(%esi)
+  802c9b:	8b 15 70 90 80 00    	mov    0x809070,%edx
+  802ca1:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802ca4:	8b 15 74 90 80 00    	mov    0x809074,%edx
+  802caa:	89 56 30             	mov    %edx,0x30(%esi)
+  802cad:	8b 15 78 90 80 00    	mov    0x809078,%edx
+  802cb3:	89 56 34             	mov    %edx,0x34(%esi)
+  802cb6:	8b 15 7c 90 80 00    	mov    0x80907c,%edx
+  802cbc:	89 56 38             	mov    %edx,0x38(%esi)
+  802cbf:	8b 15 80 90 80 00    	mov    0x809080,%edx
+  802cc5:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802cc8:	8b 15 84 90 80 00    	mov    0x809084,%edx
+  802cce:	89 13                	mov    %edx,(%ebx)
+  802cd0:	8b 15 88 90 80 00    	mov    0x809088,%edx
+  802cd6:	89 53 04             	mov    %edx,0x4(%ebx)
+  802cd9:	8b 15 8c 90 80 00    	mov    0x80908c,%edx
+  802cdf:	89 53 08             	mov    %edx,0x8(%ebx)
+  802ce2:	8b 15 90 90 80 00    	mov    0x809090,%edx
+  802ce8:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802ceb:	8b 15 94 90 80 00    	mov    0x809094,%edx
+  802cf1:	89 53 10             	mov    %edx,0x10(%ebx)
+  802cf4:	8b 15 98 90 80 00    	mov    0x809098,%edx
+  802cfa:	89 53 14             	mov    %edx,0x14(%ebx)
+  802cfd:	8b 15 9c 90 80 00    	mov    0x80909c,%edx
+  802d03:	89 53 18             	mov    %edx,0x18(%ebx)
+  802d06:	8b 15 a0 90 80 00    	mov    0x8090a0,%edx
+  802d0c:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802d0f:	8b 15 a4 90 80 00    	mov    0x8090a4,%edx
+  802d15:	89 53 20             	mov    %edx,0x20(%ebx)
+  802d18:	8b 15 a8 90 80 00    	mov    0x8090a8,%edx
+  802d1e:	89 53 24             	mov    %edx,0x24(%ebx)
+  802d21:	8b 15 ac 90 80 00    	mov    0x8090ac,%edx
+  802d27:	89 53 28             	mov    %edx,0x28(%ebx)
+  802d2a:	8b 15 b0 90 80 00    	mov    0x8090b0,%edx
+  802d30:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802d33:	8b 15 b4 90 80 00    	mov    0x8090b4,%edx
+  802d39:	89 53 30             	mov    %edx,0x30(%ebx)
+  802d3c:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  802d42:	89 53 34             	mov    %edx,0x34(%ebx)
+  802d45:	8b 15 bc 90 80 00    	mov    0x8090bc,%edx
+  802d4b:	89 53 38             	mov    %edx,0x38(%ebx)
+  802d4e:	8b 15 c0 90 80 00    	mov    0x8090c0,%edx
+  802d54:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802d57:	83 c4 0c             	add    $0xc,%esp
+  802d5a:	5b                   	pop    %ebx
+  802d5b:	5e                   	pop    %esi
+  802d5c:	5f                   	pop    %edi
+  802d5d:	5d                   	pop    %ebp
+  802d5e:	c3                   	ret
+
+00802d5f <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802d5f:	55                   	push   %ebp
+  802d60:	89 e5                	mov    %esp,%ebp
+  802d62:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d68:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.evctl.req_events = events;
+  802d6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d70:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.evctl.req_data = data;
+  802d75:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d78:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_EVCTL);
+  802d7d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802d82:	e8 46 f4 ff ff       	call   8021cd <nsipc>
+}
+  802d87:	c9                   	leave
+  802d88:	c3                   	ret
+
+00802d89 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802d89:	55                   	push   %ebp
+  802d8a:	89 e5                	mov    %esp,%ebp
+  802d8c:	56                   	push   %esi
+  802d8d:	53                   	push   %ebx
+  802d8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802d91:	89 35 00 90 80 00    	mov    %esi,0x809000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802d97:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d9a:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802d9f:	b8 10 00 00 00       	mov    $0x10,%eax
+  802da4:	e8 24 f4 ff ff       	call   8021cd <nsipc>
+  802da9:	89 c3                	mov    %eax,%ebx
+  802dab:	85 c0                	test   %eax,%eax
+  802dad:	7e 1f                	jle    802dce <nsipc_evwait+0x45>
+		assert(r <= max);
+  802daf:	39 c6                	cmp    %eax,%esi
+  802db1:	7c 24                	jl     802dd7 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802db3:	83 ec 04             	sub    $0x4,%esp
+  802db6:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802dbd:	50                   	push   %eax
+  802dbe:	68 00 90 80 00       	push   $0x809000
+  802dc3:	ff 75 08             	push   0x8(%ebp)
+  802dc6:	e8 ea df ff ff       	call   800db5 <memmove>
+  802dcb:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802dce:	89 d8                	mov    %ebx,%eax
+  802dd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dd3:	5b                   	pop    %ebx
+  802dd4:	5e                   	pop    %esi
+  802dd5:	5d                   	pop    %ebp
+  802dd6:	c3                   	ret
+		assert(r <= max);
+  802dd7:	68 96 46 80 00       	push   $0x804696
+  802ddc:	68 69 46 80 00       	push   $0x804669
+  802de1:	68 6a 01 00 00       	push   $0x16a
+  802de6:	68 7e 46 80 00       	push   $0x80467e
+  802deb:	e8 43 d6 ff ff       	call   800433 <_panic>
+
+00802df0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802df0:	55                   	push   %ebp
+  802df1:	89 e5                	mov    %esp,%ebp
+  802df3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802df6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802dfe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e01:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e06:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e09:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802e0e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e13:	e8 b5 f3 ff ff       	call   8021cd <nsipc>
+}
+  802e18:	c9                   	leave
+  802e19:	c3                   	ret
+
+00802e1a <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802e1a:	55                   	push   %ebp
+  802e1b:	89 e5                	mov    %esp,%ebp
+  802e1d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802e20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e23:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_OFFLOAD);
+  802e28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e2d:	e8 9b f3 ff ff       	call   8021cd <nsipc>
+}
+  802e32:	c9                   	leave
+  802e33:	c3                   	ret
+
+00802e34 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802e34:	55                   	push   %ebp
+  802e35:	89 e5                	mov    %esp,%ebp
+  802e37:	53                   	push   %ebx
+  802e38:	83 ec 04             	sub    $0x4,%esp
+  802e3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802e3e:	b8 12 00 00 00       	mov    $0x12,%eax
+  802e43:	e8 85 f3 ff ff       	call   8021cd <nsipc>
+  802e48:	85 c0                	test   %eax,%eax
+  802e4a:	78 50                	js     802e9c <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802e4c:	8b 15 00 90 80 00    	mov    0x809000,%edx
+  802e52:	89 13                	mov    %edx,(%ebx)
+  802e54:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  802e5a:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e5d:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  802e63:	89 53 08             	mov    %edx,0x8(%ebx)
+  802e66:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  802e6c:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802e6f:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  802e75:	89 53 10             	mov    %edx,0x10(%ebx)
+  802e78:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  802e7e:	89 53 14             	mov    %edx,0x14(%ebx)
+  802e81:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  802e87:	89 53 18             	mov    %edx,0x18(%ebx)
+  802e8a:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  802e90:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802e93:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  802e99:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802e9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e9f:	c9                   	leave
+  802ea0:	c3                   	ret
+
+00802ea1 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802ea1:	55                   	push   %ebp
+  802ea2:	89 e5                	mov    %esp,%ebp
+  802ea4:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ea7:	6a 03                	push   $0x3
+  802ea9:	e8 bf 0c 00 00       	call   803b6d <ipc_find_env>
+  802eae:	a3 24 7b 80 00       	mov    %eax,0x807b24
+	nsipcbuf.shard.req_shard = shard;
+  802eb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb6:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802ebb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802ec0:	e8 08 f3 ff ff       	call   8021cd <nsipc>
+  802ec5:	83 c4 10             	add    $0x10,%esp
+  802ec8:	85 c0                	test   %eax,%eax
+  802eca:	78 0a                	js     802ed6 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802ecc:	a3 24 7b 80 00       	mov    %eax,0x807b24
+	return 0;
+  802ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed6:	c9                   	leave
+  802ed7:	c3                   	ret
+
+00802ed8 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802ed8:	55                   	push   %ebp
+  802ed9:	89 e5                	mov    %esp,%ebp
+  802edb:	57                   	push   %edi
+  802edc:	56                   	push   %esi
+  802edd:	53                   	push   %ebx
+  802ede:	83 ec 1c             	sub    $0x1c,%esp
+  802ee1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802ee4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802ee7:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ef1:	89 e0                	mov    %esp,%eax
+  802ef3:	89 f2                	mov    %esi,%edx
+  802ef5:	29 c2                	sub    %eax,%edx
+  802ef7:	89 d0                	mov    %edx,%eax
+  802ef9:	c1 e8 0f             	shr    $0xf,%eax
+  802efc:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802f02:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802f05:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  802f0c:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802f0f:	83 ec 0c             	sub    $0xc,%esp
+  802f12:	ff 75 e0             	push   -0x20(%ebp)
+  802f15:	e8 92 0c 00 00       	call   803bac <pageref>
+  802f1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f1d:	83 c4 04             	add    $0x4,%esp
+  802f20:	ff 75 dc             	push   -0x24(%ebp)
+  802f23:	e8 84 0c 00 00       	call   803bac <pageref>
+  802f28:	89 e2                	mov    %esp,%edx
+  802f2a:	89 f1                	mov    %esi,%ecx
+  802f2c:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802f2e:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802f31:	89 ca                	mov    %ecx,%edx
+  802f33:	c1 ea 0f             	shr    $0xf,%edx
+  802f36:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802f3c:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802f3f:	8b 14 95 60 7b 80 00 	mov    0x807b60(,%edx,4),%edx
+  802f46:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f49:	39 d7                	cmp    %edx,%edi
+  802f4b:	74 40                	je     802f8d <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802f4d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f50:	75 9f                	jne    802ef1 <_pipeisclosed+0x19>
+  802f52:	89 e2                	mov    %esp,%edx
+  802f54:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802f59:	29 d0                	sub    %edx,%eax
+  802f5b:	89 c2                	mov    %eax,%edx
+  802f5d:	c1 ea 0f             	shr    $0xf,%edx
+  802f60:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6a:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f6d:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  802f74:	8b 40 58             	mov    0x58(%eax),%eax
+  802f77:	6a 01                	push   $0x1
+  802f79:	50                   	push   %eax
+  802f7a:	57                   	push   %edi
+  802f7b:	68 9f 46 80 00       	push   $0x80469f
+  802f80:	e8 89 d5 ff ff       	call   80050e <cprintf>
+  802f85:	83 c4 10             	add    $0x10,%esp
+  802f88:	e9 5f ff ff ff       	jmp    802eec <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802f8d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f90:	0f 94 c0             	sete   %al
+  802f93:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802f96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f99:	5b                   	pop    %ebx
+  802f9a:	5e                   	pop    %esi
+  802f9b:	5f                   	pop    %edi
+  802f9c:	5d                   	pop    %ebp
+  802f9d:	c3                   	ret
+
+00802f9e <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f9e:	55                   	push   %ebp
+  802f9f:	89 e5                	mov    %esp,%ebp
+  802fa1:	53                   	push   %ebx
+  802fa2:	83 ec 0c             	sub    $0xc,%esp
+  802fa5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802fa8:	53                   	push   %ebx
+  802fa9:	6a 00                	push   $0x0
+  802fab:	e8 0e e1 ff ff       	call   8010be <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802fb0:	89 1c 24             	mov    %ebx,(%esp)
+  802fb3:	e8 f4 e4 ff ff       	call   8014ac <fd2data>
+  802fb8:	83 c4 08             	add    $0x8,%esp
+  802fbb:	50                   	push   %eax
+  802fbc:	6a 00                	push   $0x0
+  802fbe:	e8 fb e0 ff ff       	call   8010be <sys_page_unmap>
+}
+  802fc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fc6:	c9                   	leave
+  802fc7:	c3                   	ret
+
+00802fc8 <devpipe_read>:
+{
+  802fc8:	55                   	push   %ebp
+  802fc9:	89 e5                	mov    %esp,%ebp
+  802fcb:	57                   	push   %edi
+  802fcc:	56                   	push   %esi
+  802fcd:	53                   	push   %ebx
+  802fce:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802fd1:	ff 75 08             	push   0x8(%ebp)
+  802fd4:	e8 d3 e4 ff ff       	call   8014ac <fd2data>
+  802fd9:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802fdb:	8b 70 04             	mov    0x4(%eax),%esi
+  802fde:	8b 00                	mov    (%eax),%eax
+  802fe0:	83 c4 10             	add    $0x10,%esp
+  802fe3:	39 f0                	cmp    %esi,%eax
+  802fe5:	75 36                	jne    80301d <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802fe7:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802fea:	89 da                	mov    %ebx,%edx
+  802fec:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fef:	e8 e4 fe ff ff       	call   802ed8 <_pipeisclosed>
+  802ff4:	85 c0                	test   %eax,%eax
+  802ff6:	0f 85 d4 00 00 00    	jne    8030d0 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802ffc:	b8 01 00 00 00       	mov    $0x1,%eax
+  803001:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803005:	83 ec 04             	sub    $0x4,%esp
+  803008:	6a ff                	push   $0xffffffff
+  80300a:	56                   	push   %esi
+  80300b:	57                   	push   %edi
+  80300c:	e8 26 e4 ff ff       	call   801437 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803011:	8b 73 04             	mov    0x4(%ebx),%esi
+  803014:	8b 03                	mov    (%ebx),%eax
+  803016:	83 c4 10             	add    $0x10,%esp
+  803019:	39 c6                	cmp    %eax,%esi
+  80301b:	74 cd                	je     802fea <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80301d:	8b 73 04             	mov    0x4(%ebx),%esi
+  803020:	8b 03                	mov    (%ebx),%eax
+  803022:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803028:	29 c6                	sub    %eax,%esi
+  80302a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80302f:	f7 e6                	mul    %esi
+  803031:	c1 ea 0c             	shr    $0xc,%edx
+  803034:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80303a:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  80303c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80303f:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803043:	8b 0b                	mov    (%ebx),%ecx
+  803045:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80304a:	f7 e1                	mul    %ecx
+  80304c:	c1 ea 0b             	shr    $0xb,%edx
+  80304f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803055:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803057:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80305c:	29 cf                	sub    %ecx,%edi
+  80305e:	39 f7                	cmp    %esi,%edi
+  803060:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803063:	83 ec 04             	sub    $0x4,%esp
+  803066:	57                   	push   %edi
+  803067:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  80306b:	50                   	push   %eax
+  80306c:	ff 75 0c             	push   0xc(%ebp)
+  80306f:	e8 41 dd ff ff       	call   800db5 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803074:	83 c4 0c             	add    $0xc,%esp
+  803077:	89 f0                	mov    %esi,%eax
+  803079:	29 f8                	sub    %edi,%eax
+  80307b:	50                   	push   %eax
+  80307c:	8d 43 10             	lea    0x10(%ebx),%eax
+  80307f:	50                   	push   %eax
+  803080:	89 f8                	mov    %edi,%eax
+  803082:	03 45 0c             	add    0xc(%ebp),%eax
+  803085:	50                   	push   %eax
+  803086:	e8 2a dd ff ff       	call   800db5 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80308b:	8b 0b                	mov    (%ebx),%ecx
+  80308d:	01 f1                	add    %esi,%ecx
+  80308f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803094:	f7 e1                	mul    %ecx
+  803096:	c1 ea 0c             	shr    $0xc,%edx
+  803099:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80309f:	29 c1                	sub    %eax,%ecx
+  8030a1:	89 0b                	mov    %ecx,(%ebx)
+  8030a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a8:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8030ac:	83 c4 10             	add    $0x10,%esp
+  8030af:	85 c0                	test   %eax,%eax
+  8030b1:	75 0a                	jne    8030bd <devpipe_read+0xf5>
+	return n;
+  8030b3:	89 f0                	mov    %esi,%eax
+}
+  8030b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b8:	5b                   	pop    %ebx
+  8030b9:	5e                   	pop    %esi
+  8030ba:	5f                   	pop    %edi
+  8030bb:	5d                   	pop    %ebp
+  8030bc:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8030bd:	83 ec 08             	sub    $0x8,%esp
+  8030c0:	68 00 04 00 00       	push   $0x400
+  8030c5:	53                   	push   %ebx
+  8030c6:	e8 8e e3 ff ff       	call   801459 <sys_futex_wake>
+  8030cb:	83 c4 10             	add    $0x10,%esp
+  8030ce:	eb e3                	jmp    8030b3 <devpipe_read+0xeb>
+			return 0;
+  8030d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d5:	eb de                	jmp    8030b5 <devpipe_read+0xed>
+
+008030d7 <devpipe_write>:
+{
+  8030d7:	55                   	push   %ebp
+  8030d8:	89 e5                	mov    %esp,%ebp
+  8030da:	57                   	push   %edi
+  8030db:	56                   	push   %esi
+  8030dc:	53                   	push   %ebx
+  8030dd:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8030e0:	ff 75 08             	push   0x8(%ebp)
+  8030e3:	e8 c4 e3 ff ff       	call   8014ac <fd2data>
+  8030e8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8030ea:	83 c4 10             	add    $0x10,%esp
+  8030ed:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030f4:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8030f9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030fd:	0f 84 43 01 00 00    	je     803246 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803103:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803106:	8b 06                	mov    (%esi),%eax
+  803108:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80310e:	29 c1                	sub    %eax,%ecx
+  803110:	89 c8                	mov    %ecx,%eax
+  803112:	f7 e7                	mul    %edi
+  803114:	c1 ea 0c             	shr    $0xc,%edx
+  803117:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80311d:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80311f:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803125:	75 52                	jne    803179 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803127:	89 f2                	mov    %esi,%edx
+  803129:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312c:	e8 a7 fd ff ff       	call   802ed8 <_pipeisclosed>
+  803131:	85 c0                	test   %eax,%eax
+  803133:	0f 85 28 01 00 00    	jne    803261 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803139:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80313b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80313e:	8b 06                	mov    (%esi),%eax
+  803140:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803146:	29 c1                	sub    %eax,%ecx
+  803148:	89 c8                	mov    %ecx,%eax
+  80314a:	f7 e7                	mul    %edi
+  80314c:	c1 ea 0c             	shr    $0xc,%edx
+  80314f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803155:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803157:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80315d:	75 a4                	jne    803103 <devpipe_write+0x2c>
+  80315f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803164:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803168:	83 ec 04             	sub    $0x4,%esp
+  80316b:	6a ff                	push   $0xffffffff
+  80316d:	53                   	push   %ebx
+  80316e:	56                   	push   %esi
+  80316f:	e8 c3 e2 ff ff       	call   801437 <sys_futex_wait>
+}
+  803174:	83 c4 10             	add    $0x10,%esp
+  803177:	eb 8a                	jmp    803103 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803179:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80317c:	8b 06                	mov    (%esi),%eax
+  80317e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803184:	29 c1                	sub    %eax,%ecx
+  803186:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80318b:	f7 e1                	mul    %ecx
+  80318d:	c1 ea 0c             	shr    $0xc,%edx
+  803190:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803196:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803198:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80319d:	89 d8                	mov    %ebx,%eax
+  80319f:	29 c8                	sub    %ecx,%eax
+  8031a1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8031a4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031a7:	29 ca                	sub    %ecx,%edx
+  8031a9:	39 d0                	cmp    %edx,%eax
+  8031ab:	0f 46 d0             	cmovbe %eax,%edx
+  8031ae:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8031b1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8031b4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031b9:	f7 e1                	mul    %ecx
+  8031bb:	c1 ea 0b             	shr    $0xb,%edx
+  8031be:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8031c4:	89 ca                	mov    %ecx,%edx
+  8031c6:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8031c8:	29 d3                	sub    %edx,%ebx
+  8031ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8031cd:	39 c3                	cmp    %eax,%ebx
+  8031cf:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8031d2:	83 ec 04             	sub    $0x4,%esp
+  8031d5:	53                   	push   %ebx
+  8031d6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031d9:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8031dc:	51                   	push   %ecx
+  8031dd:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8031e1:	50                   	push   %eax
+  8031e2:	e8 ce db ff ff       	call   800db5 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8031e7:	83 c4 0c             	add    $0xc,%esp
+  8031ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8031ed:	29 d8                	sub    %ebx,%eax
+  8031ef:	50                   	push   %eax
+  8031f0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031f3:	01 cb                	add    %ecx,%ebx
+  8031f5:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8031f8:	53                   	push   %ebx
+  8031f9:	8d 46 10             	lea    0x10(%esi),%eax
+  8031fc:	50                   	push   %eax
+  8031fd:	e8 b3 db ff ff       	call   800db5 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803202:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803205:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803208:	01 c1                	add    %eax,%ecx
+  80320a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80320f:	f7 e1                	mul    %ecx
+  803211:	c1 ea 0c             	shr    $0xc,%edx
+  803214:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80321a:	89 ca                	mov    %ecx,%edx
+  80321c:	29 c2                	sub    %eax,%edx
+  80321e:	89 56 04             	mov    %edx,0x4(%esi)
+  803221:	b8 00 00 00 00       	mov    $0x0,%eax
+  803226:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80322a:	83 c4 10             	add    $0x10,%esp
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	75 1a                	jne    80324b <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803231:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803234:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803237:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80323a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80323d:	0f 82 c0 fe ff ff    	jb     803103 <devpipe_write+0x2c>
+  803243:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803246:	8b 45 10             	mov    0x10(%ebp),%eax
+  803249:	eb 1b                	jmp    803266 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  80324b:	83 ec 08             	sub    $0x8,%esp
+  80324e:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803253:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803256:	50                   	push   %eax
+  803257:	e8 fd e1 ff ff       	call   801459 <sys_futex_wake>
+  80325c:	83 c4 10             	add    $0x10,%esp
+  80325f:	eb d0                	jmp    803231 <devpipe_write+0x15a>
+				return 0;
+  803261:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803266:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803269:	5b                   	pop    %ebx
+  80326a:	5e                   	pop    %esi
+  80326b:	5f                   	pop    %edi
+  80326c:	5d                   	pop    %ebp
+  80326d:	c3                   	ret
+
+0080326e <devpipe_stat>:
+{
+  80326e:	55                   	push   %ebp
+  80326f:	89 e5                	mov    %esp,%ebp
+  803271:	56                   	push   %esi
+  803272:	53                   	push   %ebx
+  803273:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803276:	83 ec 0c             	sub    $0xc,%esp
+  803279:	ff 75 08             	push   0x8(%ebp)
+  80327c:	e8 2b e2 ff ff       	call   8014ac <fd2data>
+  803281:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803283:	83 c4 08             	add    $0x8,%esp
+  803286:	68 b2 46 80 00       	push   $0x8046b2
+  80328b:	53                   	push   %ebx
+  80328c:	e8 74 d9 ff ff       	call   800c05 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803291:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803294:	8b 06                	mov    (%esi),%eax
+  803296:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80329c:	29 c1                	sub    %eax,%ecx
+  80329e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8032a3:	89 c8                	mov    %ecx,%eax
+  8032a5:	f7 e2                	mul    %edx
+  8032a7:	c1 ea 0c             	shr    $0xc,%edx
+  8032aa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032b0:	29 d1                	sub    %edx,%ecx
+  8032b2:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8032b8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8032bf:	00 00 00 
+	stat->st_dev = &devpipe;
+  8032c2:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8032c9:	50 80 00 
+}
+  8032cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032d4:	5b                   	pop    %ebx
+  8032d5:	5e                   	pop    %esi
+  8032d6:	5d                   	pop    %ebp
+  8032d7:	c3                   	ret
+
+008032d8 <devpipe_poll>:
+{
+  8032d8:	55                   	push   %ebp
+  8032d9:	89 e5                	mov    %esp,%ebp
+  8032db:	57                   	push   %edi
+  8032dc:	56                   	push   %esi
+  8032dd:	53                   	push   %ebx
+  8032de:	83 ec 18             	sub    $0x18,%esp
+  8032e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8032e7:	57                   	push   %edi
+  8032e8:	e8 bf e1 ff ff       	call   8014ac <fd2data>
+  8032ed:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8032ef:	83 c4 10             	add    $0x10,%esp
+  8032f2:	89 f3                	mov    %esi,%ebx
+  8032f4:	83 e3 01             	and    $0x1,%ebx
+  8032f7:	75 27                	jne    803320 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8032f9:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8032ff:	75 48                	jne    803349 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803301:	89 ca                	mov    %ecx,%edx
+  803303:	89 f8                	mov    %edi,%eax
+  803305:	e8 ce fb ff ff       	call   802ed8 <_pipeisclosed>
+  80330a:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80330c:	89 d8                	mov    %ebx,%eax
+  80330e:	83 c8 10             	or     $0x10,%eax
+  803311:	85 d2                	test   %edx,%edx
+  803313:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803316:	89 d8                	mov    %ebx,%eax
+  803318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80331b:	5b                   	pop    %ebx
+  80331c:	5e                   	pop    %esi
+  80331d:	5f                   	pop    %edi
+  80331e:	5d                   	pop    %ebp
+  80331f:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803320:	8b 58 04             	mov    0x4(%eax),%ebx
+  803323:	8b 00                	mov    (%eax),%eax
+  803325:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80332b:	29 c3                	sub    %eax,%ebx
+  80332d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803332:	89 d8                	mov    %ebx,%eax
+  803334:	f7 e2                	mul    %edx
+  803336:	c1 ea 0c             	shr    $0xc,%edx
+  803339:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80333f:	39 d3                	cmp    %edx,%ebx
+  803341:	0f 95 c3             	setne  %bl
+  803344:	0f b6 db             	movzbl %bl,%ebx
+  803347:	eb b0                	jmp    8032f9 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803349:	8b 71 04             	mov    0x4(%ecx),%esi
+  80334c:	8b 01                	mov    (%ecx),%eax
+  80334e:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803354:	29 c6                	sub    %eax,%esi
+  803356:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80335b:	89 f0                	mov    %esi,%eax
+  80335d:	f7 e2                	mul    %edx
+  80335f:	c1 ea 0c             	shr    $0xc,%edx
+  803362:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803368:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80336a:	89 d8                	mov    %ebx,%eax
+  80336c:	83 c8 04             	or     $0x4,%eax
+  80336f:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803375:	0f 42 d8             	cmovb  %eax,%ebx
+  803378:	eb 87                	jmp    803301 <devpipe_poll+0x29>
+
+0080337a <pipe>:
+{
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	56                   	push   %esi
+  80337e:	53                   	push   %ebx
+  80337f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803382:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803385:	50                   	push   %eax
+  803386:	e8 38 e1 ff ff       	call   8014c3 <fd_alloc>
+  80338b:	89 c3                	mov    %eax,%ebx
+  80338d:	83 c4 10             	add    $0x10,%esp
+  803390:	85 c0                	test   %eax,%eax
+  803392:	0f 88 23 01 00 00    	js     8034bb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803398:	83 ec 04             	sub    $0x4,%esp
+  80339b:	68 07 04 00 00       	push   $0x407
+  8033a0:	ff 75 f4             	push   -0xc(%ebp)
+  8033a3:	6a 00                	push   $0x0
+  8033a5:	e8 8f dc ff ff       	call   801039 <sys_page_alloc>
+  8033aa:	89 c3                	mov    %eax,%ebx
+  8033ac:	83 c4 10             	add    $0x10,%esp
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	0f 88 04 01 00 00    	js     8034bb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8033b7:	83 ec 0c             	sub    $0xc,%esp
+  8033ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8033bd:	50                   	push   %eax
+  8033be:	e8 00 e1 ff ff       	call   8014c3 <fd_alloc>
+  8033c3:	89 c3                	mov    %eax,%ebx
+  8033c5:	83 c4 10             	add    $0x10,%esp
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	0f 88 db 00 00 00    	js     8034ab <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033d0:	83 ec 04             	sub    $0x4,%esp
+  8033d3:	68 07 04 00 00       	push   $0x407
+  8033d8:	ff 75 f0             	push   -0x10(%ebp)
+  8033db:	6a 00                	push   $0x0
+  8033dd:	e8 57 dc ff ff       	call   801039 <sys_page_alloc>
+  8033e2:	89 c3                	mov    %eax,%ebx
+  8033e4:	83 c4 10             	add    $0x10,%esp
+  8033e7:	85 c0                	test   %eax,%eax
+  8033e9:	0f 88 bc 00 00 00    	js     8034ab <pipe+0x131>
+	va = fd2data(fd0);
+  8033ef:	83 ec 0c             	sub    $0xc,%esp
+  8033f2:	ff 75 f4             	push   -0xc(%ebp)
+  8033f5:	e8 b2 e0 ff ff       	call   8014ac <fd2data>
+  8033fa:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033fc:	83 c4 0c             	add    $0xc,%esp
+  8033ff:	68 07 04 00 00       	push   $0x407
+  803404:	50                   	push   %eax
+  803405:	6a 00                	push   $0x0
+  803407:	e8 2d dc ff ff       	call   801039 <sys_page_alloc>
+  80340c:	89 c3                	mov    %eax,%ebx
+  80340e:	83 c4 10             	add    $0x10,%esp
+  803411:	85 c0                	test   %eax,%eax
+  803413:	0f 88 82 00 00 00    	js     80349b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803419:	83 ec 0c             	sub    $0xc,%esp
+  80341c:	ff 75 f0             	push   -0x10(%ebp)
+  80341f:	e8 88 e0 ff ff       	call   8014ac <fd2data>
+  803424:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80342b:	50                   	push   %eax
+  80342c:	6a 00                	push   $0x0
+  80342e:	56                   	push   %esi
+  80342f:	6a 00                	push   $0x0
+  803431:	e8 46 dc ff ff       	call   80107c <sys_page_map>
+  803436:	89 c3                	mov    %eax,%ebx
+  803438:	83 c4 20             	add    $0x20,%esp
+  80343b:	85 c0                	test   %eax,%eax
+  80343d:	78 4e                	js     80348d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80343f:	a1 60 50 80 00       	mov    0x805060,%eax
+  803444:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803447:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803449:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80344c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803453:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803456:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803458:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80345b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803462:	83 ec 0c             	sub    $0xc,%esp
+  803465:	ff 75 f4             	push   -0xc(%ebp)
+  803468:	e8 2f e0 ff ff       	call   80149c <fd2num>
+  80346d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803470:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803472:	83 c4 04             	add    $0x4,%esp
+  803475:	ff 75 f0             	push   -0x10(%ebp)
+  803478:	e8 1f e0 ff ff       	call   80149c <fd2num>
+  80347d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803480:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803483:	83 c4 10             	add    $0x10,%esp
+  803486:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80348b:	eb 2e                	jmp    8034bb <pipe+0x141>
+	sys_page_unmap(0, va);
+  80348d:	83 ec 08             	sub    $0x8,%esp
+  803490:	56                   	push   %esi
+  803491:	6a 00                	push   $0x0
+  803493:	e8 26 dc ff ff       	call   8010be <sys_page_unmap>
+  803498:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80349b:	83 ec 08             	sub    $0x8,%esp
+  80349e:	ff 75 f0             	push   -0x10(%ebp)
+  8034a1:	6a 00                	push   $0x0
+  8034a3:	e8 16 dc ff ff       	call   8010be <sys_page_unmap>
+  8034a8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8034ab:	83 ec 08             	sub    $0x8,%esp
+  8034ae:	ff 75 f4             	push   -0xc(%ebp)
+  8034b1:	6a 00                	push   $0x0
+  8034b3:	e8 06 dc ff ff       	call   8010be <sys_page_unmap>
+  8034b8:	83 c4 10             	add    $0x10,%esp
+}
+  8034bb:	89 d8                	mov    %ebx,%eax
+  8034bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034c0:	5b                   	pop    %ebx
+  8034c1:	5e                   	pop    %esi
+  8034c2:	5d                   	pop    %ebp
+  8034c3:	c3                   	ret
+
+008034c4 <pipeisclosed>:
+{
+  8034c4:	55                   	push   %ebp
+  8034c5:	89 e5                	mov    %esp,%ebp
+  8034c7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034cd:	50                   	push   %eax
+  8034ce:	ff 75 08             	push   0x8(%ebp)
+  8034d1:	e8 3d e0 ff ff       	call   801513 <fd_lookup>
+  8034d6:	83 c4 10             	add    $0x10,%esp
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	78 18                	js     8034f5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8034dd:	83 ec 0c             	sub    $0xc,%esp
+  8034e0:	ff 75 f4             	push   -0xc(%ebp)
+  8034e3:	e8 c4 df ff ff       	call   8014ac <fd2data>
+  8034e8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8034ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034ed:	e8 e6 f9 ff ff       	call   802ed8 <_pipeisclosed>
+  8034f2:	83 c4 10             	add    $0x10,%esp
+}
+  8034f5:	c9                   	leave
+  8034f6:	c3                   	ret
+
+008034f7 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8034f7:	55                   	push   %ebp
+  8034f8:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8034fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034fd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803503:	5d                   	pop    %ebp
+  803504:	c3                   	ret
+
+00803505 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803505:	55                   	push   %ebp
+  803506:	89 e5                	mov    %esp,%ebp
+  803508:	53                   	push   %ebx
+  803509:	83 ec 04             	sub    $0x4,%esp
+  80350c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80350f:	8b 03                	mov    (%ebx),%eax
+  803511:	85 c0                	test   %eax,%eax
+  803513:	75 05                	jne    80351a <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803518:	c9                   	leave
+  803519:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80351a:	83 ec 08             	sub    $0x8,%esp
+  80351d:	50                   	push   %eax
+  80351e:	8d 43 04             	lea    0x4(%ebx),%eax
+  803521:	50                   	push   %eax
+  803522:	e8 e7 dd ff ff       	call   80130e <sys_page_batch>
+	pb->pb_n = 0;
+  803527:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80352d:	83 c4 10             	add    $0x10,%esp
+  803530:	eb e3                	jmp    803515 <pgbatch_flush+0x10>
+
+00803532 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803532:	55                   	push   %ebp
+  803533:	89 e5                	mov    %esp,%ebp
+  803535:	56                   	push   %esi
+  803536:	53                   	push   %ebx
+  803537:	89 c3                	mov    %eax,%ebx
+  803539:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80353b:	83 38 20             	cmpl   $0x20,(%eax)
+  80353e:	74 2c                	je     80356c <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803540:	8b 03                	mov    (%ebx),%eax
+  803542:	8d 50 01             	lea    0x1(%eax),%edx
+  803545:	89 13                	mov    %edx,(%ebx)
+  803547:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80354a:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  80354e:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803550:	83 ec 04             	sub    $0x4,%esp
+  803553:	6a 18                	push   $0x18
+  803555:	6a 00                	push   $0x0
+  803557:	50                   	push   %eax
+  803558:	e8 23 d8 ff ff       	call   800d80 <memset>
+	return 0;
+  80355d:	83 c4 10             	add    $0x10,%esp
+  803560:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803565:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803568:	5b                   	pop    %ebx
+  803569:	5e                   	pop    %esi
+  80356a:	5d                   	pop    %ebp
+  80356b:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80356c:	83 ec 0c             	sub    $0xc,%esp
+  80356f:	50                   	push   %eax
+  803570:	e8 90 ff ff ff       	call   803505 <pgbatch_flush>
+  803575:	83 c4 10             	add    $0x10,%esp
+  803578:	85 c0                	test   %eax,%eax
+  80357a:	79 c4                	jns    803540 <pgbatch_slot+0xe>
+  80357c:	eb e7                	jmp    803565 <pgbatch_slot+0x33>
+
+0080357e <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80357e:	55                   	push   %ebp
+  80357f:	89 e5                	mov    %esp,%ebp
+  803581:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803584:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803587:	8b 45 08             	mov    0x8(%ebp),%eax
+  80358a:	e8 a3 ff ff ff       	call   803532 <pgbatch_slot>
+  80358f:	85 c0                	test   %eax,%eax
+  803591:	78 20                	js     8035b3 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803593:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803596:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80359c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80359f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8035a2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035a5:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8035a8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035ab:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035b3:	c9                   	leave
+  8035b4:	c3                   	ret
+
+008035b5 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8035b5:	55                   	push   %ebp
+  8035b6:	89 e5                	mov    %esp,%ebp
+  8035b8:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035bb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8035be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c1:	e8 6c ff ff ff       	call   803532 <pgbatch_slot>
+  8035c6:	85 c0                	test   %eax,%eax
+  8035c8:	78 2c                	js     8035f6 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8035ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035cd:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8035d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035d6:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8035d9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035dc:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8035df:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035e2:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8035e5:	8b 55 18             	mov    0x18(%ebp),%edx
+  8035e8:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8035eb:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8035ee:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035f6:	c9                   	leave
+  8035f7:	c3                   	ret
+
+008035f8 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  8035f8:	55                   	push   %ebp
+  8035f9:	89 e5                	mov    %esp,%ebp
+  8035fb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035fe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803601:	8b 45 08             	mov    0x8(%ebp),%eax
+  803604:	e8 29 ff ff ff       	call   803532 <pgbatch_slot>
+  803609:	85 c0                	test   %eax,%eax
+  80360b:	78 1a                	js     803627 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80360d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803610:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803616:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803619:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80361c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80361f:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803622:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803627:	c9                   	leave
+  803628:	c3                   	ret
+
+00803629 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803629:	55                   	push   %ebp
+  80362a:	89 e5                	mov    %esp,%ebp
+  80362c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80362f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803632:	8b 45 08             	mov    0x8(%ebp),%eax
+  803635:	e8 f8 fe ff ff       	call   803532 <pgbatch_slot>
+  80363a:	85 c0                	test   %eax,%eax
+  80363c:	78 20                	js     80365e <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  80363e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803641:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803647:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80364a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80364d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803650:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803653:	8b 55 14             	mov    0x14(%ebp),%edx
+  803656:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803659:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80365e:	c9                   	leave
+  80365f:	c3                   	ret
+
+00803660 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803660:	55                   	push   %ebp
+  803661:	89 e5                	mov    %esp,%ebp
+  803663:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803666:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803669:	8b 45 08             	mov    0x8(%ebp),%eax
+  80366c:	e8 c1 fe ff ff       	call   803532 <pgbatch_slot>
+  803671:	85 c0                	test   %eax,%eax
+  803673:	78 26                	js     80369b <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803675:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803678:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80367e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803681:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803684:	8b 55 10             	mov    0x10(%ebp),%edx
+  803687:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80368a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80368d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803690:	8b 55 18             	mov    0x18(%ebp),%edx
+  803693:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803696:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80369b:	c9                   	leave
+  80369c:	c3                   	ret
+
+0080369d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80369d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a2:	c3                   	ret
+
+008036a3 <devcons_poll>:
+{
+  8036a3:	55                   	push   %ebp
+  8036a4:	89 e5                	mov    %esp,%ebp
+  8036a6:	53                   	push   %ebx
+  8036a7:	83 ec 04             	sub    $0x4,%esp
+  8036aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8036ad:	89 da                	mov    %ebx,%edx
+  8036af:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8036b2:	83 3d 34 7b 80 00 00 	cmpl   $0x0,0x807b34
+  8036b9:	74 0c                	je     8036c7 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8036bb:	89 d8                	mov    %ebx,%eax
+  8036bd:	83 e0 01             	and    $0x1,%eax
+  8036c0:	09 d0                	or     %edx,%eax
+}
+  8036c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c5:	c9                   	leave
+  8036c6:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8036c7:	e8 cf d8 ff ff       	call   800f9b <sys_cgetc>
+  8036cc:	a3 34 7b 80 00       	mov    %eax,0x807b34
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8036d1:	89 da                	mov    %ebx,%edx
+  8036d3:	83 e2 04             	and    $0x4,%edx
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	74 e6                	je     8036c0 <devcons_poll+0x1d>
+  8036da:	eb df                	jmp    8036bb <devcons_poll+0x18>
+
+008036dc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8036dc:	55                   	push   %ebp
+  8036dd:	89 e5                	mov    %esp,%ebp
+  8036df:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8036e2:	68 be 46 80 00       	push   $0x8046be
+  8036e7:	ff 75 0c             	push   0xc(%ebp)
+  8036ea:	e8 16 d5 ff ff       	call   800c05 <strcpy>
+	return 0;
+}
+  8036ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f4:	c9                   	leave
+  8036f5:	c3                   	ret
+
+008036f6 <devcons_write>:
+{
+  8036f6:	55                   	push   %ebp
+  8036f7:	89 e5                	mov    %esp,%ebp
+  8036f9:	57                   	push   %edi
+  8036fa:	56                   	push   %esi
+  8036fb:	53                   	push   %ebx
+  8036fc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803702:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803705:	85 ff                	test   %edi,%edi
+  803707:	74 51                	je     80375a <devcons_write+0x64>
+  803709:	be 00 00 00 00       	mov    $0x0,%esi
+  80370e:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803713:	89 fb                	mov    %edi,%ebx
+  803715:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803717:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80371c:	39 d3                	cmp    %edx,%ebx
+  80371e:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803721:	83 ec 04             	sub    $0x4,%esp
+  803724:	53                   	push   %ebx
+  803725:	03 45 0c             	add    0xc(%ebp),%eax
+  803728:	50                   	push   %eax
+  803729:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80372f:	50                   	push   %eax
+  803730:	e8 80 d6 ff ff       	call   800db5 <memmove>
+		sys_cputs(buf, m);
+  803735:	83 c4 08             	add    $0x8,%esp
+  803738:	53                   	push   %ebx
+  803739:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80373f:	50                   	push   %eax
+  803740:	e8 38 d8 ff ff       	call   800f7d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803745:	01 de                	add    %ebx,%esi
+  803747:	89 f0                	mov    %esi,%eax
+  803749:	83 c4 10             	add    $0x10,%esp
+  80374c:	39 fe                	cmp    %edi,%esi
+  80374e:	72 c3                	jb     803713 <devcons_write+0x1d>
+}
+  803750:	89 f0                	mov    %esi,%eax
+  803752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803755:	5b                   	pop    %ebx
+  803756:	5e                   	pop    %esi
+  803757:	5f                   	pop    %edi
+  803758:	5d                   	pop    %ebp
+  803759:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80375a:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80375f:	eb ef                	jmp    803750 <devcons_write+0x5a>
+
+00803761 <devcons_read>:
+{
+  803761:	55                   	push   %ebp
+  803762:	89 e5                	mov    %esp,%ebp
+  803764:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803767:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80376c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803770:	74 36                	je     8037a8 <devcons_read+0x47>
+	c = cons_peek;
+  803772:	a1 34 7b 80 00       	mov    0x807b34,%eax
+	cons_peek = 0;
+  803777:	c7 05 34 7b 80 00 00 	movl   $0x0,0x807b34
+  80377e:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803781:	85 c0                	test   %eax,%eax
+  803783:	75 10                	jne    803795 <devcons_read+0x34>
+  803785:	e8 11 d8 ff ff       	call   800f9b <sys_cgetc>
+  80378a:	85 c0                	test   %eax,%eax
+  80378c:	75 07                	jne    803795 <devcons_read+0x34>
+		sys_yield();
+  80378e:	e8 87 d8 ff ff       	call   80101a <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803793:	eb f0                	jmp    803785 <devcons_read+0x24>
+	if (c < 0)
+  803795:	85 c0                	test   %eax,%eax
+  803797:	78 0f                	js     8037a8 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803799:	83 f8 04             	cmp    $0x4,%eax
+  80379c:	74 0c                	je     8037aa <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80379e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037a1:	88 02                	mov    %al,(%edx)
+	return 1;
+  8037a3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8037a8:	c9                   	leave
+  8037a9:	c3                   	ret
+		return 0;
+  8037aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037af:	eb f7                	jmp    8037a8 <devcons_read+0x47>
+
+008037b1 <cputchar>:
+{
+  8037b1:	55                   	push   %ebp
+  8037b2:	89 e5                	mov    %esp,%ebp
+  8037b4:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8037b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ba:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8037bd:	6a 01                	push   $0x1
+  8037bf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8037c2:	50                   	push   %eax
+  8037c3:	e8 b5 d7 ff ff       	call   800f7d <sys_cputs>
+}
+  8037c8:	83 c4 10             	add    $0x10,%esp
+  8037cb:	c9                   	leave
+  8037cc:	c3                   	ret
+
+008037cd <getchar>:
+{
+  8037cd:	55                   	push   %ebp
+  8037ce:	89 e5                	mov    %esp,%ebp
+  8037d0:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8037d3:	6a 01                	push   $0x1
+  8037d5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8037d8:	50                   	push   %eax
+  8037d9:	6a 00                	push   $0x0
+  8037db:	e8 b7 df ff ff       	call   801797 <read>
+	if (r < 0)
+  8037e0:	83 c4 10             	add    $0x10,%esp
+  8037e3:	85 c0                	test   %eax,%eax
+  8037e5:	78 06                	js     8037ed <getchar+0x20>
+	if (r < 1)
+  8037e7:	74 06                	je     8037ef <getchar+0x22>
+	return c;
+  8037e9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8037ed:	c9                   	leave
+  8037ee:	c3                   	ret
+		return -E_EOF;
+  8037ef:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8037f4:	eb f7                	jmp    8037ed <getchar+0x20>
+
+008037f6 <iscons>:
+{
+  8037f6:	55                   	push   %ebp
+  8037f7:	89 e5                	mov    %esp,%ebp
+  8037f9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8037fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037ff:	50                   	push   %eax
+  803800:	ff 75 08             	push   0x8(%ebp)
+  803803:	e8 0b dd ff ff       	call   801513 <fd_lookup>
+  803808:	83 c4 10             	add    $0x10,%esp
+  80380b:	85 c0                	test   %eax,%eax
+  80380d:	78 11                	js     803820 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80380f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803812:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803818:	39 10                	cmp    %edx,(%eax)
+  80381a:	0f 94 c0             	sete   %al
+  80381d:	0f b6 c0             	movzbl %al,%eax
+}
+  803820:	c9                   	leave
+  803821:	c3                   	ret
+
+00803822 <opencons>:
+{
+  803822:	55                   	push   %ebp
+  803823:	89 e5                	mov    %esp,%ebp
+  803825:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803828:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80382b:	50                   	push   %eax
+  80382c:	e8 92 dc ff ff       	call   8014c3 <fd_alloc>
+  803831:	83 c4 10             	add    $0x10,%esp
+  803834:	85 c0                	test   %eax,%eax
+  803836:	78 3a                	js     803872 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803838:	83 ec 04             	sub    $0x4,%esp
+  80383b:	68 07 04 00 00       	push   $0x407
+  803840:	ff 75 f4             	push   -0xc(%ebp)
+  803843:	6a 00                	push   $0x0
+  803845:	e8 ef d7 ff ff       	call   801039 <sys_page_alloc>
+  80384a:	83 c4 10             	add    $0x10,%esp
+  80384d:	85 c0                	test   %eax,%eax
+  80384f:	78 21                	js     803872 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803851:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803854:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80385a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80385c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80385f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803866:	83 ec 0c             	sub    $0xc,%esp
+  803869:	50                   	push   %eax
+  80386a:	e8 2d dc ff ff       	call   80149c <fd2num>
+  80386f:	83 c4 10             	add    $0x10,%esp
+}
+  803872:	c9                   	leave
+  803873:	c3                   	ret
+
+00803874 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803874:	55                   	push   %ebp
+  803875:	89 e5                	mov    %esp,%ebp
+  803877:	56                   	push   %esi
+  803878:	53                   	push   %ebx
+  803879:	8b 75 08             	mov    0x8(%ebp),%esi
+  80387c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80387f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803882:	85 c0                	test   %eax,%eax
+  803884:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803889:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80388c:	83 ec 0c             	sub    $0xc,%esp
+  80388f:	50                   	push   %eax
+  803890:	e8 54 d9 ff ff       	call   8011e9 <sys_ipc_recv>
+  803895:	83 c4 10             	add    $0x10,%esp
+  803898:	85 c0                	test   %eax,%eax
+  80389a:	0f 88 8b 00 00 00    	js     80392b <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8038a0:	85 f6                	test   %esi,%esi
+  8038a2:	74 2a                	je     8038ce <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8038a4:	89 e2                	mov    %esp,%edx
+  8038a6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038ab:	29 d0                	sub    %edx,%eax
+  8038ad:	89 c2                	mov    %eax,%edx
+  8038af:	c1 ea 0f             	shr    $0xf,%edx
+  8038b2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038bc:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8038bf:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  8038c6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8038cc:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8038ce:	85 db                	test   %ebx,%ebx
+  8038d0:	74 2a                	je     8038fc <ipc_recv+0x88>
+  8038d2:	89 e2                	mov    %esp,%edx
+  8038d4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038d9:	29 d0                	sub    %edx,%eax
+  8038db:	89 c2                	mov    %eax,%edx
+  8038dd:	c1 ea 0f             	shr    $0xf,%edx
+  8038e0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ea:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8038ed:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  8038f4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8038fa:	89 03                	mov    %eax,(%ebx)
+  8038fc:	89 e2                	mov    %esp,%edx
+  8038fe:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803903:	29 d0                	sub    %edx,%eax
+  803905:	89 c2                	mov    %eax,%edx
+  803907:	c1 ea 0f             	shr    $0xf,%edx
+  80390a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80390f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803914:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803917:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  80391e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803924:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803927:	5b                   	pop    %ebx
+  803928:	5e                   	pop    %esi
+  803929:	5d                   	pop    %ebp
+  80392a:	c3                   	ret
+		if(from_env_store != NULL)
+  80392b:	85 f6                	test   %esi,%esi
+  80392d:	74 06                	je     803935 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80392f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803935:	85 db                	test   %ebx,%ebx
+  803937:	74 eb                	je     803924 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803939:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80393f:	eb e3                	jmp    803924 <ipc_recv+0xb0>
+
+00803941 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803941:	55                   	push   %ebp
+  803942:	89 e5                	mov    %esp,%ebp
+  803944:	57                   	push   %edi
+  803945:	56                   	push   %esi
+  803946:	53                   	push   %ebx
+  803947:	83 ec 14             	sub    $0x14,%esp
+  80394a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80394d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803950:	8b 75 14             	mov    0x14(%ebp),%esi
+  803953:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803956:	85 c0                	test   %eax,%eax
+  803958:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80395d:	0f 44 c2             	cmove  %edx,%eax
+  803960:	ff 75 10             	push   0x10(%ebp)
+  803963:	50                   	push   %eax
+  803964:	e8 e2 d8 ff ff       	call   80124b <sys_ipc_recv_pages>
+  803969:	83 c4 10             	add    $0x10,%esp
+  80396c:	85 c0                	test   %eax,%eax
+  80396e:	0f 88 ba 00 00 00    	js     803a2e <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803974:	85 ff                	test   %edi,%edi
+  803976:	74 2a                	je     8039a2 <ipc_recv_pages+0x61>
+  803978:	89 e2                	mov    %esp,%edx
+  80397a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80397f:	29 d0                	sub    %edx,%eax
+  803981:	89 c2                	mov    %eax,%edx
+  803983:	c1 ea 0f             	shr    $0xf,%edx
+  803986:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80398b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803990:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803993:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  80399a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8039a0:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8039a2:	85 f6                	test   %esi,%esi
+  8039a4:	74 2a                	je     8039d0 <ipc_recv_pages+0x8f>
+  8039a6:	89 e2                	mov    %esp,%edx
+  8039a8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8039ad:	29 d0                	sub    %edx,%eax
+  8039af:	89 c2                	mov    %eax,%edx
+  8039b1:	c1 ea 0f             	shr    $0xf,%edx
+  8039b4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039be:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8039c1:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  8039c8:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8039ce:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8039d0:	85 db                	test   %ebx,%ebx
+  8039d2:	74 2a                	je     8039fe <ipc_recv_pages+0xbd>
+  8039d4:	89 e2                	mov    %esp,%edx
+  8039d6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8039db:	29 d0                	sub    %edx,%eax
+  8039dd:	89 c2                	mov    %eax,%edx
+  8039df:	c1 ea 0f             	shr    $0xf,%edx
+  8039e2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ec:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8039ef:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  8039f6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8039fc:	89 03                	mov    %eax,(%ebx)
+  8039fe:	89 e2                	mov    %esp,%edx
+  803a00:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803a05:	29 d0                	sub    %edx,%eax
+  803a07:	89 c2                	mov    %eax,%edx
+  803a09:	c1 ea 0f             	shr    $0xf,%edx
+  803a0c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a16:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803a19:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  803a20:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803a26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a29:	5b                   	pop    %ebx
+  803a2a:	5e                   	pop    %esi
+  803a2b:	5f                   	pop    %edi
+  803a2c:	5d                   	pop    %ebp
+  803a2d:	c3                   	ret
+		if (from_env_store)
+  803a2e:	85 ff                	test   %edi,%edi
+  803a30:	74 06                	je     803a38 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803a32:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803a38:	85 f6                	test   %esi,%esi
+  803a3a:	74 06                	je     803a42 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803a3c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803a42:	85 db                	test   %ebx,%ebx
+  803a44:	74 e0                	je     803a26 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803a46:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803a4c:	eb d8                	jmp    803a26 <ipc_recv_pages+0xe5>
+
+00803a4e <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803a4e:	55                   	push   %ebp
+  803a4f:	89 e5                	mov    %esp,%ebp
+  803a51:	57                   	push   %edi
+  803a52:	56                   	push   %esi
+  803a53:	53                   	push   %ebx
+  803a54:	83 ec 1c             	sub    $0x1c,%esp
+  803a57:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803a5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a5d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803a63:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a67:	75 2b                	jne    803a94 <ipc_try_send_pages+0x46>
+  803a69:	89 e2                	mov    %esp,%edx
+  803a6b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803a70:	29 d0                	sub    %edx,%eax
+  803a72:	89 c2                	mov    %eax,%edx
+  803a74:	c1 ea 0f             	shr    $0xf,%edx
+  803a77:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a81:	0f 42 c2             	cmovb  %edx,%eax
+  803a84:	8b 04 85 60 7b 80 00 	mov    0x807b60(,%eax,4),%eax
+  803a8b:	8b 70 48             	mov    0x48(%eax),%esi
+  803a8e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803a94:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803a9a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803a9f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803aa2:	85 ff                	test   %edi,%edi
+  803aa4:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803aa9:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803aac:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803ab2:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803ab8:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803abe:	83 ec 0c             	sub    $0xc,%esp
+  803ac1:	ff 75 14             	push   0x14(%ebp)
+  803ac4:	ff 75 18             	push   0x18(%ebp)
+  803ac7:	57                   	push   %edi
+  803ac8:	ff 75 0c             	push   0xc(%ebp)
+  803acb:	ff 75 08             	push   0x8(%ebp)
+  803ace:	e8 57 d7 ff ff       	call   80122a <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803ad3:	83 c4 20             	add    $0x20,%esp
+  803ad6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803ad9:	75 21                	jne    803afc <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803adb:	83 ec 04             	sub    $0x4,%esp
+  803ade:	6a ff                	push   $0xffffffff
+  803ae0:	53                   	push   %ebx
+  803ae1:	ff 75 e4             	push   -0x1c(%ebp)
+  803ae4:	e8 4e d9 ff ff       	call   801437 <sys_futex_wait>
+  803ae9:	83 c4 10             	add    $0x10,%esp
+  803aec:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803aef:	74 c7                	je     803ab8 <ipc_try_send_pages+0x6a>
+  803af1:	85 c0                	test   %eax,%eax
+  803af3:	79 c3                	jns    803ab8 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803af5:	e8 20 d5 ff ff       	call   80101a <sys_yield>
+  803afa:	eb bc                	jmp    803ab8 <ipc_try_send_pages+0x6a>
+	}
+}
+  803afc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803aff:	5b                   	pop    %ebx
+  803b00:	5e                   	pop    %esi
+  803b01:	5f                   	pop    %edi
+  803b02:	5d                   	pop    %ebp
+  803b03:	c3                   	ret
+
+00803b04 <ipc_send>:
+{
+  803b04:	55                   	push   %ebp
+  803b05:	89 e5                	mov    %esp,%ebp
+  803b07:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803b0a:	ff 75 14             	push   0x14(%ebp)
+  803b0d:	6a 01                	push   $0x1
+  803b0f:	ff 75 10             	push   0x10(%ebp)
+  803b12:	ff 75 0c             	push   0xc(%ebp)
+  803b15:	ff 75 08             	push   0x8(%ebp)
+  803b18:	e8 31 ff ff ff       	call   803a4e <ipc_try_send_pages>
+  803b1d:	83 c4 20             	add    $0x20,%esp
+  803b20:	85 c0                	test   %eax,%eax
+  803b22:	78 02                	js     803b26 <ipc_send+0x22>
+}
+  803b24:	c9                   	leave
+  803b25:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803b26:	50                   	push   %eax
+  803b27:	68 ca 46 80 00       	push   $0x8046ca
+  803b2c:	6a 3f                	push   $0x3f
+  803b2e:	68 df 46 80 00       	push   $0x8046df
+  803b33:	e8 fb c8 ff ff       	call   800433 <_panic>
+
+00803b38 <ipc_send_pages>:
+{
+  803b38:	55                   	push   %ebp
+  803b39:	89 e5                	mov    %esp,%ebp
+  803b3b:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803b3e:	ff 75 18             	push   0x18(%ebp)
+  803b41:	ff 75 14             	push   0x14(%ebp)
+  803b44:	ff 75 10             	push   0x10(%ebp)
+  803b47:	ff 75 0c             	push   0xc(%ebp)
+  803b4a:	ff 75 08             	push   0x8(%ebp)
+  803b4d:	e8 fc fe ff ff       	call   803a4e <ipc_try_send_pages>
+  803b52:	83 c4 20             	add    $0x20,%esp
+  803b55:	85 c0                	test   %eax,%eax
+  803b57:	78 02                	js     803b5b <ipc_send_pages+0x23>
+}
+  803b59:	c9                   	leave
+  803b5a:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803b5b:	50                   	push   %eax
+  803b5c:	68 e9 46 80 00       	push   $0x8046e9
+  803b61:	6a 64                	push   $0x64
+  803b63:	68 df 46 80 00       	push   $0x8046df
+  803b68:	e8 c6 c8 ff ff       	call   800433 <_panic>
+
+00803b6d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803b6d:	55                   	push   %ebp
+  803b6e:	89 e5                	mov    %esp,%ebp
+  803b70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803b73:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803b78:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803b7e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b84:	8b 52 50             	mov    0x50(%edx),%edx
+  803b87:	39 ca                	cmp    %ecx,%edx
+  803b89:	74 11                	je     803b9c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803b8b:	83 c0 01             	add    $0x1,%eax
+  803b8e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803b93:	75 e3                	jne    803b78 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9a:	eb 0e                	jmp    803baa <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803b9c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803ba2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ba7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803baa:	5d                   	pop    %ebp
+  803bab:	c3                   	ret
+
+00803bac <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803bac:	55                   	push   %ebp
+  803bad:	89 e5                	mov    %esp,%ebp
+  803baf:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803bb2:	89 c2                	mov    %eax,%edx
+  803bb4:	c1 ea 16             	shr    $0x16,%edx
+  803bb7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803bc3:	f6 c1 01             	test   $0x1,%cl
+  803bc6:	74 1e                	je     803be6 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803bc8:	c1 e8 0c             	shr    $0xc,%eax
+  803bcb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803bd2:	a8 01                	test   $0x1,%al
+  803bd4:	74 10                	je     803be6 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803bd6:	c1 e8 0c             	shr    $0xc,%eax
+  803bd9:	c1 e0 04             	shl    $0x4,%eax
+  803bdc:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803be3:	0f b7 d2             	movzwl %dx,%edx
+}
+  803be6:	89 d0                	mov    %edx,%eax
+  803be8:	5d                   	pop    %ebp
+  803be9:	c3                   	ret
+
+00803bea <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  803bea:	55                   	push   %ebp
+  803beb:	89 e5                	mov    %esp,%ebp
+  803bed:	57                   	push   %edi
+  803bee:	56                   	push   %esi
+  803bef:	53                   	push   %ebx
+  803bf0:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  803bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bf6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  803bf9:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  803bfc:	bf 38 7b 80 00       	mov    $0x807b38,%edi
+  803c01:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  803c04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c09:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803c0c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  803c0f:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803c14:	f6 e2                	mul    %dl
+  803c16:	66 c1 e8 0b          	shr    $0xb,%ax
+  803c1a:	89 c7                	mov    %eax,%edi
+  803c1c:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803c1f:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803c22:	01 db                	add    %ebx,%ebx
+  803c24:	89 d0                	mov    %edx,%eax
+  803c26:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  803c28:	89 d6                	mov    %edx,%esi
+  803c2a:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  803c2c:	89 cb                	mov    %ecx,%ebx
+  803c2e:	83 c1 01             	add    $0x1,%ecx
+  803c31:	0f b6 fb             	movzbl %bl,%edi
+  803c34:	83 c0 30             	add    $0x30,%eax
+  803c37:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  803c3b:	89 f0                	mov    %esi,%eax
+  803c3d:	3c 09                	cmp    $0x9,%al
+  803c3f:	77 ce                	ja     803c0f <inet_ntoa+0x25>
+  803c41:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803c44:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803c47:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  803c49:	84 c9                	test   %cl,%cl
+  803c4b:	74 4d                	je     803c9a <inet_ntoa+0xb0>
+  803c4d:	0f b6 db             	movzbl %bl,%ebx
+  803c50:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803c53:	01 d8                	add    %ebx,%eax
+  803c55:	89 f9                	mov    %edi,%ecx
+  803c57:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  803c5a:	83 c1 01             	add    $0x1,%ecx
+  803c5d:	0f b6 10             	movzbl (%eax),%edx
+  803c60:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  803c63:	89 c2                	mov    %eax,%edx
+  803c65:	83 e8 01             	sub    $0x1,%eax
+  803c68:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803c6b:	39 da                	cmp    %ebx,%edx
+  803c6d:	75 eb                	jne    803c5a <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  803c6f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803c72:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  803c76:	8d 78 01             	lea    0x1(%eax),%edi
+  803c79:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  803c7c:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  803c7f:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803c82:	39 ce                	cmp    %ecx,%esi
+  803c84:	0f 85 77 ff ff ff    	jne    803c01 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  803c8a:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  803c8d:	b8 38 7b 80 00       	mov    $0x807b38,%eax
+  803c92:	83 c4 1c             	add    $0x1c,%esp
+  803c95:	5b                   	pop    %ebx
+  803c96:	5e                   	pop    %esi
+  803c97:	5f                   	pop    %edi
+  803c98:	5d                   	pop    %ebp
+  803c99:	c3                   	ret
+    while(i--)
+  803c9a:	89 f8                	mov    %edi,%eax
+  803c9c:	eb d8                	jmp    803c76 <inet_ntoa+0x8c>
+
+00803c9e <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  803c9e:	55                   	push   %ebp
+  803c9f:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803ca1:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803ca5:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  803ca9:	5d                   	pop    %ebp
+  803caa:	c3                   	ret
+
+00803cab <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  803cab:	55                   	push   %ebp
+  803cac:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803cae:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803cb2:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  803cb6:	5d                   	pop    %ebp
+  803cb7:	c3                   	ret
+
+00803cb8 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  803cb8:	55                   	push   %ebp
+  803cb9:	89 e5                	mov    %esp,%ebp
+  803cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  803cbe:	89 d0                	mov    %edx,%eax
+  803cc0:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  803cc3:	89 d1                	mov    %edx,%ecx
+  803cc5:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803cc8:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  803cca:	89 d1                	mov    %edx,%ecx
+  803ccc:	c1 e1 08             	shl    $0x8,%ecx
+  803ccf:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803cd5:	09 c8                	or     %ecx,%eax
+  803cd7:	c1 ea 08             	shr    $0x8,%edx
+  803cda:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803ce0:	09 d0                	or     %edx,%eax
+}
+  803ce2:	5d                   	pop    %ebp
+  803ce3:	c3                   	ret
+
+00803ce4 <inet_aton>:
+{
+  803ce4:	55                   	push   %ebp
+  803ce5:	89 e5                	mov    %esp,%ebp
+  803ce7:	57                   	push   %edi
+  803ce8:	56                   	push   %esi
+  803ce9:	53                   	push   %ebx
+  803cea:	83 ec 2c             	sub    $0x2c,%esp
+  803ced:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  803cf0:	0f b6 0a             	movzbl (%edx),%ecx
+  803cf3:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803cf6:	83 e9 30             	sub    $0x30,%ecx
+  803cf9:	80 f9 09             	cmp    $0x9,%cl
+  803cfc:	0f 87 b6 01 00 00    	ja     803eb8 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  803d02:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  803d05:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803d08:	e9 aa 00 00 00       	jmp    803db7 <inet_aton+0xd3>
+      c = *++cp;
+  803d0d:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  803d11:	89 c1                	mov    %eax,%ecx
+  803d13:	83 e1 df             	and    $0xffffffdf,%ecx
+  803d16:	80 f9 58             	cmp    $0x58,%cl
+  803d19:	74 10                	je     803d2b <inet_aton+0x47>
+      c = *++cp;
+  803d1b:	83 c2 01             	add    $0x1,%edx
+  803d1e:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  803d21:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d26:	e9 9a 00 00 00       	jmp    803dc5 <inet_aton+0xe1>
+        c = *++cp;
+  803d2b:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803d2f:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  803d32:	bf 10 00 00 00       	mov    $0x10,%edi
+  803d37:	e9 89 00 00 00       	jmp    803dc5 <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  803d3c:	0f af d7             	imul   %edi,%edx
+  803d3f:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  803d43:	0f be 01             	movsbl (%ecx),%eax
+  803d46:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  803d49:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803d4c:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803d4f:	80 fb 09             	cmp    $0x9,%bl
+  803d52:	76 e8                	jbe    803d3c <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  803d54:	83 ff 10             	cmp    $0x10,%edi
+  803d57:	75 2e                	jne    803d87 <inet_aton+0xa3>
+  803d59:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803d5d:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803d60:	83 e3 df             	and    $0xffffffdf,%ebx
+  803d63:	83 eb 41             	sub    $0x41,%ebx
+  803d66:	80 fb 05             	cmp    $0x5,%bl
+  803d69:	77 1c                	ja     803d87 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  803d6b:	c1 e2 04             	shl    $0x4,%edx
+  803d6e:	83 c0 0a             	add    $0xa,%eax
+  803d71:	89 f3                	mov    %esi,%ebx
+  803d73:	80 fb 1a             	cmp    $0x1a,%bl
+  803d76:	19 db                	sbb    %ebx,%ebx
+  803d78:	83 e3 20             	and    $0x20,%ebx
+  803d7b:	83 c3 41             	add    $0x41,%ebx
+  803d7e:	29 d8                	sub    %ebx,%eax
+  803d80:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  803d82:	0f be 01             	movsbl (%ecx),%eax
+  803d85:	eb bf                	jmp    803d46 <inet_aton+0x62>
+    if (c == '.') {
+  803d87:	83 f8 2e             	cmp    $0x2e,%eax
+  803d8a:	75 46                	jne    803dd2 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  803d8c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803d8f:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803d92:	39 f0                	cmp    %esi,%eax
+  803d94:	0f 84 25 01 00 00    	je     803ebf <inet_aton+0x1db>
+      *pp++ = val;
+  803d9a:	83 c0 04             	add    $0x4,%eax
+  803d9d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803da0:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  803da3:	89 ca                	mov    %ecx,%edx
+  803da5:	0f b6 09             	movzbl (%ecx),%ecx
+  803da8:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803dab:	83 e9 30             	sub    $0x30,%ecx
+  803dae:	80 f9 09             	cmp    $0x9,%cl
+  803db1:	0f 87 17 01 00 00    	ja     803ece <inet_aton+0x1ea>
+    base = 10;
+  803db7:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  803dbc:	83 f8 30             	cmp    $0x30,%eax
+  803dbf:	0f 84 48 ff ff ff    	je     803d0d <inet_aton+0x29>
+  803dc5:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  803dc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dcd:	e9 77 ff ff ff       	jmp    803d49 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803dd2:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803dd6:	89 d6                	mov    %edx,%esi
+  803dd8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803ddb:	85 c0                	test   %eax,%eax
+  803ddd:	74 2e                	je     803e0d <inet_aton+0x129>
+    return (0);
+  803ddf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803de4:	89 fa                	mov    %edi,%edx
+  803de6:	80 fa 1f             	cmp    $0x1f,%dl
+  803de9:	0f 86 d5 00 00 00    	jbe    803ec4 <inet_aton+0x1e0>
+  803def:	84 c0                	test   %al,%al
+  803df1:	0f 88 cd 00 00 00    	js     803ec4 <inet_aton+0x1e0>
+  803df7:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803dfa:	83 f9 04             	cmp    $0x4,%ecx
+  803dfd:	76 0e                	jbe    803e0d <inet_aton+0x129>
+    return (0);
+  803dff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803e04:	83 f8 20             	cmp    $0x20,%eax
+  803e07:	0f 85 b7 00 00 00    	jne    803ec4 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  803e0d:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803e10:	89 d8                	mov    %ebx,%eax
+  803e12:	29 c8                	sub    %ecx,%eax
+  803e14:	c1 f8 02             	sar    $0x2,%eax
+  803e17:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  803e1a:	83 f8 02             	cmp    $0x2,%eax
+  803e1d:	74 7a                	je     803e99 <inet_aton+0x1b5>
+  803e1f:	83 f9 03             	cmp    $0x3,%ecx
+  803e22:	7f 49                	jg     803e6d <inet_aton+0x189>
+  803e24:	85 c9                	test   %ecx,%ecx
+  803e26:	0f 84 98 00 00 00    	je     803ec4 <inet_aton+0x1e0>
+  803e2c:	83 f9 02             	cmp    $0x2,%ecx
+  803e2f:	75 19                	jne    803e4a <inet_aton+0x166>
+      return (0);
+  803e31:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  803e36:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803e3c:	0f 87 82 00 00 00    	ja     803ec4 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  803e42:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803e45:	c1 e0 18             	shl    $0x18,%eax
+  803e48:	09 c6                	or     %eax,%esi
+  return (1);
+  803e4a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  803e4f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803e53:	74 6f                	je     803ec4 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  803e55:	83 ec 0c             	sub    $0xc,%esp
+  803e58:	56                   	push   %esi
+  803e59:	e8 5a fe ff ff       	call   803cb8 <htonl>
+  803e5e:	83 c4 10             	add    $0x10,%esp
+  803e61:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803e64:	89 06                	mov    %eax,(%esi)
+  return (1);
+  803e66:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803e6b:	eb 57                	jmp    803ec4 <inet_aton+0x1e0>
+  switch (n) {
+  803e6d:	83 f9 04             	cmp    $0x4,%ecx
+  803e70:	75 d8                	jne    803e4a <inet_aton+0x166>
+      return (0);
+  803e72:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  803e77:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803e7d:	77 45                	ja     803ec4 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  803e7f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803e82:	c1 e0 18             	shl    $0x18,%eax
+  803e85:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803e88:	c1 e1 10             	shl    $0x10,%ecx
+  803e8b:	09 c8                	or     %ecx,%eax
+  803e8d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803e90:	c1 e1 08             	shl    $0x8,%ecx
+  803e93:	09 c8                	or     %ecx,%eax
+  803e95:	09 c6                	or     %eax,%esi
+    break;
+  803e97:	eb b1                	jmp    803e4a <inet_aton+0x166>
+      return (0);
+  803e99:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  803e9e:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803ea4:	77 1e                	ja     803ec4 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  803ea6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803ea9:	c1 e0 18             	shl    $0x18,%eax
+  803eac:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803eaf:	c1 e1 10             	shl    $0x10,%ecx
+  803eb2:	09 c8                	or     %ecx,%eax
+  803eb4:	09 c6                	or     %eax,%esi
+    break;
+  803eb6:	eb 92                	jmp    803e4a <inet_aton+0x166>
+      return (0);
+  803eb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ebd:	eb 05                	jmp    803ec4 <inet_aton+0x1e0>
+        return (0);
+  803ebf:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  803ec4:	89 c8                	mov    %ecx,%eax
+  803ec6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ec9:	5b                   	pop    %ebx
+  803eca:	5e                   	pop    %esi
+  803ecb:	5f                   	pop    %edi
+  803ecc:	5d                   	pop    %ebp
+  803ecd:	c3                   	ret
+      return (0);
+  803ece:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ed3:	eb ef                	jmp    803ec4 <inet_aton+0x1e0>
+
+00803ed5 <inet_addr>:
+{
+  803ed5:	55                   	push   %ebp
+  803ed6:	89 e5                	mov    %esp,%ebp
+  803ed8:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  803edb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ede:	50                   	push   %eax
+  803edf:	ff 75 08             	push   0x8(%ebp)
+  803ee2:	e8 fd fd ff ff       	call   803ce4 <inet_aton>
+  803ee7:	89 c2                	mov    %eax,%edx
+  803ee9:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  803eec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  803ef1:	85 d2                	test   %edx,%edx
+  803ef3:	75 02                	jne    803ef7 <inet_addr+0x22>
+}
+  803ef5:	c9                   	leave
+  803ef6:	c3                   	ret
+    return (val.s_addr);
+  803ef7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803efa:	eb f9                	jmp    803ef5 <inet_addr+0x20>
+
+00803efc <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  803efc:	55                   	push   %ebp
+  803efd:	89 e5                	mov    %esp,%ebp
+  803eff:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  803f02:	ff 75 08             	push   0x8(%ebp)
+  803f05:	e8 ae fd ff ff       	call   803cb8 <htonl>
+  803f0a:	83 c4 10             	add    $0x10,%esp
+}
+  803f0d:	c9                   	leave
+  803f0e:	c3                   	ret
+
+00803f0f <__udivdi3>:
+  803f0f:	57                   	push   %edi
+  803f10:	56                   	push   %esi
+  803f11:	53                   	push   %ebx
+  803f12:	83 ec 20             	sub    $0x20,%esp
+  803f15:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803f19:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803f1d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f21:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f25:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803f29:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803f2d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803f31:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803f35:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f44:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803f4b:	00 
+  803f4c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803f53:	00 
+  803f54:	eb 08                	jmp    803f5e <__udivdi3+0x4f>
+  803f56:	83 e9 01             	sub    $0x1,%ecx
+  803f59:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803f5c:	74 68                	je     803fc6 <__udivdi3+0xb7>
+  803f5e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803f62:	01 c0                	add    %eax,%eax
+  803f64:	89 c6                	mov    %eax,%esi
+  803f66:	89 d7                	mov    %edx,%edi
+  803f68:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f6c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f70:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f73:	d3 ea                	shr    %cl,%edx
+  803f75:	f6 c1 20             	test   $0x20,%cl
+  803f78:	74 04                	je     803f7e <__udivdi3+0x6f>
+  803f7a:	89 d0                	mov    %edx,%eax
+  803f7c:	31 d2                	xor    %edx,%edx
+  803f7e:	83 e0 01             	and    $0x1,%eax
+  803f81:	89 04 24             	mov    %eax,(%esp)
+  803f84:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f8b:	00 
+  803f8c:	8b 04 24             	mov    (%esp),%eax
+  803f8f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f93:	09 f0                	or     %esi,%eax
+  803f95:	09 fa                	or     %edi,%edx
+  803f97:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f9b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f9f:	39 f0                	cmp    %esi,%eax
+  803fa1:	89 d3                	mov    %edx,%ebx
+  803fa3:	19 fb                	sbb    %edi,%ebx
+  803fa5:	72 af                	jb     803f56 <__udivdi3+0x47>
+  803fa7:	29 f0                	sub    %esi,%eax
+  803fa9:	19 fa                	sbb    %edi,%edx
+  803fab:	89 cf                	mov    %ecx,%edi
+  803fad:	c1 ef 05             	shr    $0x5,%edi
+  803fb0:	83 e7 01             	and    $0x1,%edi
+  803fb3:	89 fe                	mov    %edi,%esi
+  803fb5:	83 f6 01             	xor    $0x1,%esi
+  803fb8:	d3 e6                	shl    %cl,%esi
+  803fba:	d3 e7                	shl    %cl,%edi
+  803fbc:	09 74 24 18          	or     %esi,0x18(%esp)
+  803fc0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803fc4:	eb 90                	jmp    803f56 <__udivdi3+0x47>
+  803fc6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803fca:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803fce:	83 c4 20             	add    $0x20,%esp
+  803fd1:	5b                   	pop    %ebx
+  803fd2:	5e                   	pop    %esi
+  803fd3:	5f                   	pop    %edi
+  803fd4:	c3                   	ret
+
+00803fd5 <__umoddi3>:
+  803fd5:	57                   	push   %edi
+  803fd6:	56                   	push   %esi
+  803fd7:	53                   	push   %ebx
+  803fd8:	83 ec 08             	sub    $0x8,%esp
+  803fdb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803fdf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803fe3:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803fe7:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803feb:	57                   	push   %edi
+  803fec:	56                   	push   %esi
+  803fed:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803ff1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803ff5:	52                   	push   %edx
+  803ff6:	50                   	push   %eax
+  803ff7:	e8 13 ff ff ff       	call   803f0f <__udivdi3>
+  803ffc:	89 c3                	mov    %eax,%ebx
+  803ffe:	0f af d6             	imul   %esi,%edx
+  804001:	89 f9                	mov    %edi,%ecx
+  804003:	0f af cb             	imul   %ebx,%ecx
+  804006:	01 d1                	add    %edx,%ecx
+  804008:	89 d8                	mov    %ebx,%eax
+  80400a:	f7 e6                	mul    %esi
+  80400c:	89 c6                	mov    %eax,%esi
+  80400e:	89 d7                	mov    %edx,%edi
+  804010:	01 cf                	add    %ecx,%edi
+  804012:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804016:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80401a:	29 f0                	sub    %esi,%eax
+  80401c:	19 fa                	sbb    %edi,%edx
+  80401e:	83 c4 18             	add    $0x18,%esp
+  804021:	5b                   	pop    %ebx
+  804022:	5e                   	pop    %esi
+  804023:	5f                   	pop    %edi
+  804024:	c3                   	ret
+
+00804025 <__divdi3>:
+  804025:	53                   	push   %ebx
+  804026:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80402a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80402e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804032:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804036:	85 d2                	test   %edx,%edx
+  804038:	78 12                	js     80404c <__divdi3+0x27>
+  80403a:	85 db                	test   %ebx,%ebx
+  80403c:	78 2e                	js     80406c <__divdi3+0x47>
+  80403e:	53                   	push   %ebx
+  80403f:	51                   	push   %ecx
+  804040:	52                   	push   %edx
+  804041:	50                   	push   %eax
+  804042:	e8 c8 fe ff ff       	call   803f0f <__udivdi3>
+  804047:	83 c4 10             	add    $0x10,%esp
+  80404a:	eb 1e                	jmp    80406a <__divdi3+0x45>
+  80404c:	f7 d8                	neg    %eax
+  80404e:	83 d2 00             	adc    $0x0,%edx
+  804051:	f7 da                	neg    %edx
+  804053:	85 db                	test   %ebx,%ebx
+  804055:	78 2a                	js     804081 <__divdi3+0x5c>
+  804057:	53                   	push   %ebx
+  804058:	51                   	push   %ecx
+  804059:	52                   	push   %edx
+  80405a:	50                   	push   %eax
+  80405b:	e8 af fe ff ff       	call   803f0f <__udivdi3>
+  804060:	83 c4 10             	add    $0x10,%esp
+  804063:	f7 d8                	neg    %eax
+  804065:	83 d2 00             	adc    $0x0,%edx
+  804068:	f7 da                	neg    %edx
+  80406a:	5b                   	pop    %ebx
+  80406b:	c3                   	ret
+  80406c:	f7 d9                	neg    %ecx
+  80406e:	83 d3 00             	adc    $0x0,%ebx
+  804071:	f7 db                	neg    %ebx
+  804073:	53                   	push   %ebx
+  804074:	51                   	push   %ecx
+  804075:	52                   	push   %edx
+  804076:	50                   	push   %eax
+  804077:	e8 93 fe ff ff       	call   803f0f <__udivdi3>
+  80407c:	83 c4 10             	add    $0x10,%esp
+  80407f:	eb e2                	jmp    804063 <__divdi3+0x3e>
+  804081:	f7 d9                	neg    %ecx
+  804083:	83 d3 00             	adc    $0x0,%ebx
+  804086:	f7 db                	neg    %ebx
+  804088:	53                   	push   %ebx
+  804089:	51                   	push   %ecx
+  80408a:	52                   	push   %edx
+  80408b:	50                   	push   %eax
+  80408c:	e8 7e fe ff ff       	call   803f0f <__udivdi3>
+  804091:	83 c4 10             	add    $0x10,%esp
+  804094:	eb d4                	jmp    80406a <__divdi3+0x45>
+
+00804096 <__moddi3>:
+  804096:	57                   	push   %edi
+  804097:	56                   	push   %esi
+  804098:	53                   	push   %ebx
+  804099:	83 ec 08             	sub    $0x8,%esp
+  80409c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8040a0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8040a4:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8040a8:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8040ac:	57                   	push   %edi
+  8040ad:	56                   	push   %esi
+  8040ae:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8040b2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8040b6:	52                   	push   %edx
+  8040b7:	50                   	push   %eax
+  8040b8:	e8 68 ff ff ff       	call   804025 <__divdi3>
+  8040bd:	89 c3                	mov    %eax,%ebx
+  8040bf:	0f af d6             	imul   %esi,%edx
+  8040c2:	89 f9                	mov    %edi,%ecx
+  8040c4:	0f af cb             	imul   %ebx,%ecx
+  8040c7:	01 d1                	add    %edx,%ecx
+  8040c9:	89 d8                	mov    %ebx,%eax
+  8040cb:	f7 e6                	mul    %esi
+  8040cd:	89 c6                	mov    %eax,%esi
+  8040cf:	89 d7                	mov    %edx,%edi
+  8040d1:	01 cf                	add    %ecx,%edi
+  8040d3:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8040d7:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8040db:	29 f0                	sub    %esi,%eax
+  8040dd:	19 fa                	sbb    %edi,%edx
+  8040df:	83 c4 18             	add    $0x18,%esp
+  8040e2:	5b                   	pop    %ebx
+  8040e3:	5e                   	pop    %esi
+  8040e4:	5f                   	pop    %edi
+  8040e5:	c3                   	ret
@@ -0,0 +1,8680 @@
+
+obj/user/echosrv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 72 03 00 00       	call   8003a3 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+#define BUFFSIZE 32
+#define MAXPENDING 5    // Max connection requests
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 50 41 80 00       	push   $0x804150
+  800041:	e8 99 04 00 00       	call   8004df <cprintf>
+	exit();
+  800046:	e8 e5 03 00 00       	call   800430 <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <ns_runs>:
+
+// How many times the network server and its helper envs have been
+// scheduled so far.  While no traffic arrives this should stay flat.
+static uint32_t
+ns_runs(void)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	53                   	push   %ebx
+  800054:	83 ec 10             	sub    $0x10,%esp
+	envid_t ns = ipc_find_env(ENV_TYPE_NS);
+  800057:	6a 03                	push   $0x3
+  800059:	e8 08 17 00 00       	call   801766 <ipc_find_env>
+  80005e:	89 c1                	mov    %eax,%ecx
+  800060:	83 c4 10             	add    $0x10,%esp
+	uint32_t runs = 0;
+	int i;
+
+	for (i = 0; i < NENV; i++)
+  800063:	b8 00 00 00 00       	mov    $0x0,%eax
+	uint32_t runs = 0;
+  800068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80006d:	eb 1b                	jmp    80008a <ns_runs+0x3a>
+		if (envs[i].env_status != ENV_FREE
+		    && (envs[i].env_id == ns || envs[i].env_parent_id == ns))
+			runs += envs[i].env_runs;
+  80006f:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  800075:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80007b:	8b 52 58             	mov    0x58(%edx),%edx
+  80007e:	01 d3                	add    %edx,%ebx
+	for (i = 0; i < NENV; i++)
+  800080:	83 c0 01             	add    $0x1,%eax
+  800083:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800088:	74 3b                	je     8000c5 <ns_runs+0x75>
+		if (envs[i].env_status != ENV_FREE
+  80008a:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  800090:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800096:	8b 52 54             	mov    0x54(%edx),%edx
+  800099:	85 d2                	test   %edx,%edx
+  80009b:	74 e3                	je     800080 <ns_runs+0x30>
+		    && (envs[i].env_id == ns || envs[i].env_parent_id == ns))
+  80009d:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8000a3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000a9:	8b 52 48             	mov    0x48(%edx),%edx
+  8000ac:	39 ca                	cmp    %ecx,%edx
+  8000ae:	74 bf                	je     80006f <ns_runs+0x1f>
+  8000b0:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8000b6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000bc:	8b 52 4c             	mov    0x4c(%edx),%edx
+  8000bf:	39 ca                	cmp    %ecx,%edx
+  8000c1:	75 bd                	jne    800080 <ns_runs+0x30>
+  8000c3:	eb aa                	jmp    80006f <ns_runs+0x1f>
+	return runs;
+}
+  8000c5:	89 d8                	mov    %ebx,%eax
+  8000c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000ca:	c9                   	leave
+  8000cb:	c3                   	ret
+
+008000cc <handle_client>:
+
+void
+handle_client(int sock)
+{
+  8000cc:	55                   	push   %ebp
+  8000cd:	89 e5                	mov    %esp,%ebp
+  8000cf:	57                   	push   %edi
+  8000d0:	56                   	push   %esi
+  8000d1:	53                   	push   %ebx
+  8000d2:	81 ec fc 00 00 00    	sub    $0xfc,%esp
+  8000d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	char buffer[BUFFSIZE];
+	int received = -1, echoes = 0;
+	unsigned start = sys_time_msec(), ms;
+  8000db:	e8 7e 11 00 00       	call   80125e <sys_time_msec>
+  8000e0:	89 85 00 ff ff ff    	mov    %eax,-0x100(%ebp)
+	struct NetStats ns0, ns1;
+
+	sys_net_stats(&ns0);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8000ef:	50                   	push   %eax
+  8000f0:	e8 4c 12 00 00       	call   801341 <sys_net_stats>
+
+	// Receive message
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8000f5:	83 c4 0c             	add    $0xc,%esp
+  8000f8:	6a 20                	push   $0x20
+  8000fa:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8000fd:	50                   	push   %eax
+  8000fe:	56                   	push   %esi
+  8000ff:	e8 9c 19 00 00       	call   801aa0 <read>
+  800104:	83 c4 10             	add    $0x10,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 13                	js     80011e <handle_client+0x52>
+  80010b:	89 c3                	mov    %eax,%ebx
+		die("Failed to receive initial bytes from client");
+
+	// Send bytes and check for more incoming data in loop
+	while (received > 0) {
+  80010d:	7e 19                	jle    800128 <handle_client+0x5c>
+  80010f:	c7 85 04 ff ff ff 00 	movl   $0x0,-0xfc(%ebp)
+  800116:	00 00 00 
+		// Send back received data
+		if (write(sock, buffer, received) != received)
+  800119:	8d 7d c8             	lea    -0x38(%ebp),%edi
+  80011c:	eb 53                	jmp    800171 <handle_client+0xa5>
+		die("Failed to receive initial bytes from client");
+  80011e:	b8 54 41 80 00       	mov    $0x804154,%eax
+  800123:	e8 0d ff ff ff       	call   800035 <die>
+
+		// Check for more data
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+			die("Failed to receive additional bytes from client");
+	}
+	close(sock);
+  800128:	83 ec 0c             	sub    $0xc,%esp
+  80012b:	56                   	push   %esi
+  80012c:	e8 30 18 00 00       	call   801961 <close>
+	ms = sys_time_msec() - start;
+  800131:	e8 28 11 00 00       	call   80125e <sys_time_msec>
+  800136:	8b 95 00 ff ff ff    	mov    -0x100(%ebp),%edx
+  80013c:	29 d0                	sub    %edx,%eax
+  80013e:	89 c3                	mov    %eax,%ebx
+	sys_net_stats(&ns1);
+  800140:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+  800146:	89 04 24             	mov    %eax,(%esp)
+  800149:	e8 f3 11 00 00       	call   801341 <sys_net_stats>
+  80014e:	83 c4 10             	add    $0x10,%esp
+  800151:	eb 78                	jmp    8001cb <handle_client+0xff>
+		echoes++;
+  800153:	83 85 04 ff ff ff 01 	addl   $0x1,-0xfc(%ebp)
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80015a:	83 ec 04             	sub    $0x4,%esp
+  80015d:	6a 20                	push   $0x20
+  80015f:	57                   	push   %edi
+  800160:	56                   	push   %esi
+  800161:	e8 3a 19 00 00       	call   801aa0 <read>
+  800166:	89 c3                	mov    %eax,%ebx
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	85 c0                	test   %eax,%eax
+  80016d:	78 20                	js     80018f <handle_client+0xc3>
+	while (received > 0) {
+  80016f:	7e 28                	jle    800199 <handle_client+0xcd>
+		if (write(sock, buffer, received) != received)
+  800171:	83 ec 04             	sub    $0x4,%esp
+  800174:	53                   	push   %ebx
+  800175:	57                   	push   %edi
+  800176:	56                   	push   %esi
+  800177:	e8 1c 1a 00 00       	call   801b98 <write>
+  80017c:	83 c4 10             	add    $0x10,%esp
+  80017f:	39 d8                	cmp    %ebx,%eax
+  800181:	74 d0                	je     800153 <handle_client+0x87>
+			die("Failed to send bytes to client");
+  800183:	b8 80 41 80 00       	mov    $0x804180,%eax
+  800188:	e8 a8 fe ff ff       	call   800035 <die>
+  80018d:	eb c4                	jmp    800153 <handle_client+0x87>
+			die("Failed to receive additional bytes from client");
+  80018f:	b8 a0 41 80 00       	mov    $0x8041a0,%eax
+  800194:	e8 9c fe ff ff       	call   800035 <die>
+	close(sock);
+  800199:	83 ec 0c             	sub    $0xc,%esp
+  80019c:	56                   	push   %esi
+  80019d:	e8 bf 17 00 00       	call   801961 <close>
+	ms = sys_time_msec() - start;
+  8001a2:	e8 b7 10 00 00       	call   80125e <sys_time_msec>
+  8001a7:	8b 95 00 ff ff ff    	mov    -0x100(%ebp),%edx
+  8001ad:	29 d0                	sub    %edx,%eax
+  8001af:	89 c3                	mov    %eax,%ebx
+	sys_net_stats(&ns1);
+  8001b1:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+  8001b7:	89 04 24             	mov    %eax,(%esp)
+  8001ba:	e8 82 11 00 00       	call   801341 <sys_net_stats>
+	if (echoes)
+  8001bf:	83 c4 10             	add    $0x10,%esp
+  8001c2:	83 bd 04 ff ff ff 00 	cmpl   $0x0,-0xfc(%ebp)
+  8001c9:	75 18                	jne    8001e3 <handle_client+0x117>
+		cprintf("%d echoes in %u ms, %u us per round trip\n", echoes,
+			ms, ms * 1000 / echoes);
+	if (ns1.ns_rx_packets != ns0.ns_rx_packets)
+  8001cb:	8b 8d 10 ff ff ff    	mov    -0xf0(%ebp),%ecx
+  8001d1:	8b b5 6c ff ff ff    	mov    -0x94(%ebp),%esi
+  8001d7:	39 f1                	cmp    %esi,%ecx
+  8001d9:	75 2d                	jne    800208 <handle_client+0x13c>
+		cprintf("received %u packets, %u bytes/s, %u copied by the kernel\n",
+			ns1.ns_rx_packets - ns0.ns_rx_packets,
+			(ns1.ns_rx_bytes - ns0.ns_rx_bytes) * 1000 / (ms ? ms : 1),
+			ns1.ns_rx_copies - ns0.ns_rx_copies);
+}
+  8001db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001de:	5b                   	pop    %ebx
+  8001df:	5e                   	pop    %esi
+  8001e0:	5f                   	pop    %edi
+  8001e1:	5d                   	pop    %ebp
+  8001e2:	c3                   	ret
+			ms, ms * 1000 / echoes);
+  8001e3:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+		cprintf("%d echoes in %u ms, %u us per round trip\n", echoes,
+  8001e9:	8b 8d 04 ff ff ff    	mov    -0xfc(%ebp),%ecx
+  8001ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f4:	f7 f1                	div    %ecx
+  8001f6:	50                   	push   %eax
+  8001f7:	53                   	push   %ebx
+  8001f8:	51                   	push   %ecx
+  8001f9:	68 d0 41 80 00       	push   $0x8041d0
+  8001fe:	e8 dc 02 00 00       	call   8004df <cprintf>
+  800203:	83 c4 10             	add    $0x10,%esp
+  800206:	eb c3                	jmp    8001cb <handle_client+0xff>
+		cprintf("received %u packets, %u bytes/s, %u copied by the kernel\n",
+  800208:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+  80020e:	2b 85 74 ff ff ff    	sub    -0x8c(%ebp),%eax
+  800214:	50                   	push   %eax
+			(ns1.ns_rx_bytes - ns0.ns_rx_bytes) * 1000 / (ms ? ms : 1),
+  800215:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+  80021b:	2b 85 70 ff ff ff    	sub    -0x90(%ebp),%eax
+  800221:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+		cprintf("received %u packets, %u bytes/s, %u copied by the kernel\n",
+  800227:	85 db                	test   %ebx,%ebx
+  800229:	ba 01 00 00 00       	mov    $0x1,%edx
+  80022e:	0f 44 da             	cmove  %edx,%ebx
+  800231:	ba 00 00 00 00       	mov    $0x0,%edx
+  800236:	f7 f3                	div    %ebx
+  800238:	50                   	push   %eax
+  800239:	29 f1                	sub    %esi,%ecx
+  80023b:	51                   	push   %ecx
+  80023c:	68 fc 41 80 00       	push   $0x8041fc
+  800241:	e8 99 02 00 00       	call   8004df <cprintf>
+  800246:	83 c4 10             	add    $0x10,%esp
+}
+  800249:	eb 90                	jmp    8001db <handle_client+0x10f>
+
+0080024b <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	57                   	push   %edi
+  80024f:	56                   	push   %esi
+  800250:	53                   	push   %ebx
+  800251:	83 ec 50             	sub    $0x50,%esp
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800254:	6a 06                	push   $0x6
+  800256:	6a 01                	push   $0x1
+  800258:	6a 02                	push   $0x2
+  80025a:	e8 55 22 00 00       	call   8024b4 <socket>
+  80025f:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	85 c0                	test   %eax,%eax
+  800267:	0f 88 87 00 00 00    	js     8002f4 <umain+0xa9>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  80026d:	83 ec 0c             	sub    $0xc,%esp
+  800270:	68 18 41 80 00       	push   $0x804118
+  800275:	e8 65 02 00 00       	call   8004df <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  80027a:	83 c4 0c             	add    $0xc,%esp
+  80027d:	6a 10                	push   $0x10
+  80027f:	6a 00                	push   $0x0
+  800281:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800284:	53                   	push   %ebx
+  800285:	e8 c7 0a 00 00       	call   800d51 <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  80028a:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = htonl(INADDR_ANY);   // IP address
+  80028e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800295:	e8 35 3a 00 00       	call   803ccf <htonl>
+  80029a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  80029d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8002a4:	e8 0c 3a 00 00       	call   803cb5 <htons>
+  8002a9:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to bind\n");
+  8002ad:	c7 04 24 27 41 80 00 	movl   $0x804127,(%esp)
+  8002b4:	e8 26 02 00 00       	call   8004df <cprintf>
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &echoserver,
+  8002b9:	83 c4 0c             	add    $0xc,%esp
+  8002bc:	6a 10                	push   $0x10
+  8002be:	53                   	push   %ebx
+  8002bf:	ff 75 b0             	push   -0x50(%ebp)
+  8002c2:	e8 4c 20 00 00       	call   802313 <bind>
+  8002c7:	83 c4 10             	add    $0x10,%esp
+  8002ca:	85 c0                	test   %eax,%eax
+  8002cc:	78 35                	js     800303 <umain+0xb8>
+		 sizeof(echoserver)) < 0) {
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  8002ce:	83 ec 08             	sub    $0x8,%esp
+  8002d1:	6a 05                	push   $0x5
+  8002d3:	ff 75 b0             	push   -0x50(%ebp)
+  8002d6:	e8 a7 20 00 00       	call   802382 <listen>
+  8002db:	83 c4 10             	add    $0x10,%esp
+  8002de:	85 c0                	test   %eax,%eax
+  8002e0:	78 2d                	js     80030f <umain+0xc4>
+		die("Failed to listen on server socket");
+
+	cprintf("bound\n");
+  8002e2:	83 ec 0c             	sub    $0xc,%esp
+  8002e5:	68 37 41 80 00       	push   $0x804137
+  8002ea:	e8 f0 01 00 00       	call   8004df <cprintf>
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	eb 77                	jmp    80036b <umain+0x120>
+		die("Failed to create socket");
+  8002f4:	b8 00 41 80 00       	mov    $0x804100,%eax
+  8002f9:	e8 37 fd ff ff       	call   800035 <die>
+  8002fe:	e9 6a ff ff ff       	jmp    80026d <umain+0x22>
+		die("Failed to bind the server socket");
+  800303:	b8 38 42 80 00       	mov    $0x804238,%eax
+  800308:	e8 28 fd ff ff       	call   800035 <die>
+  80030d:	eb bf                	jmp    8002ce <umain+0x83>
+		die("Failed to listen on server socket");
+  80030f:	b8 5c 42 80 00       	mov    $0x80425c,%eax
+  800314:	e8 1c fd ff ff       	call   800035 <die>
+  800319:	eb c7                	jmp    8002e2 <umain+0x97>
+
+		// Wait for client connection
+		if ((clientsock =
+		     accept(serversock, (struct sockaddr *) &echoclient,
+			    &clientlen)) < 0) {
+			die("Failed to accept client connection");
+  80031b:	b8 80 42 80 00       	mov    $0x804280,%eax
+  800320:	e8 10 fd ff ff       	call   800035 <die>
+		}
+		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+  800325:	83 ec 0c             	sub    $0xc,%esp
+  800328:	ff 75 cc             	push   -0x34(%ebp)
+  80032b:	e8 d1 38 00 00       	call   803c01 <inet_ntoa>
+  800330:	83 c4 08             	add    $0x8,%esp
+  800333:	50                   	push   %eax
+  800334:	68 3e 41 80 00       	push   $0x80413e
+  800339:	e8 a1 01 00 00       	call   8004df <cprintf>
+		cprintf("network envs ran %u times in %u ms while waiting\n",
+			ns_runs() - runs, sys_time_msec() - idle);
+  80033e:	e8 1b 0f 00 00       	call   80125e <sys_time_msec>
+		cprintf("network envs ran %u times in %u ms while waiting\n",
+  800343:	29 f8                	sub    %edi,%eax
+  800345:	89 c6                	mov    %eax,%esi
+			ns_runs() - runs, sys_time_msec() - idle);
+  800347:	e8 04 fd ff ff       	call   800050 <ns_runs>
+		cprintf("network envs ran %u times in %u ms while waiting\n",
+  80034c:	83 c4 0c             	add    $0xc,%esp
+  80034f:	56                   	push   %esi
+  800350:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  800353:	29 d0                	sub    %edx,%eax
+  800355:	50                   	push   %eax
+  800356:	68 a4 42 80 00       	push   $0x8042a4
+  80035b:	e8 7f 01 00 00       	call   8004df <cprintf>
+		handle_client(clientsock);
+  800360:	89 1c 24             	mov    %ebx,(%esp)
+  800363:	e8 64 fd ff ff       	call   8000cc <handle_client>
+	while (1) {
+  800368:	83 c4 10             	add    $0x10,%esp
+		unsigned int clientlen = sizeof(echoclient);
+  80036b:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		uint32_t runs = ns_runs();
+  800372:	e8 d9 fc ff ff       	call   800050 <ns_runs>
+  800377:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+		unsigned idle = sys_time_msec();
+  80037a:	e8 df 0e 00 00       	call   80125e <sys_time_msec>
+  80037f:	89 c7                	mov    %eax,%edi
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  800381:	83 ec 04             	sub    $0x4,%esp
+  800384:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  800387:	50                   	push   %eax
+  800388:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80038b:	50                   	push   %eax
+  80038c:	ff 75 b0             	push   -0x50(%ebp)
+  80038f:	e8 3d 1f 00 00       	call   8022d1 <accept>
+  800394:	89 c3                	mov    %eax,%ebx
+		if ((clientsock =
+  800396:	83 c4 10             	add    $0x10,%esp
+  800399:	85 c0                	test   %eax,%eax
+  80039b:	0f 88 7a ff ff ff    	js     80031b <umain+0xd0>
+  8003a1:	eb 82                	jmp    800325 <umain+0xda>
+
+008003a3 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003a3:	55                   	push   %ebp
+  8003a4:	89 e5                	mov    %esp,%ebp
+  8003a6:	56                   	push   %esi
+  8003a7:	53                   	push   %ebx
+  8003a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8003ae:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8003b0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8003b5:	29 d0                	sub    %edx,%eax
+  8003b7:	89 c2                	mov    %eax,%edx
+  8003b9:	c1 ea 0f             	shr    $0xf,%edx
+  8003bc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c6:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8003c9:	c7 04 85 60 63 80 00 	movl   $0x0,0x806360(,%eax,4)
+  8003d0:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8003d4:	e8 f3 0b 00 00       	call   800fcc <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8003d9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003de:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8003e4:	89 e1                	mov    %esp,%ecx
+  8003e6:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8003eb:	29 ca                	sub    %ecx,%edx
+  8003ed:	89 d1                	mov    %edx,%ecx
+  8003ef:	c1 e9 0f             	shr    $0xf,%ecx
+  8003f2:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8003f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fd:	0f 42 d1             	cmovb  %ecx,%edx
+  800400:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800405:	89 04 95 60 63 80 00 	mov    %eax,0x806360(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80040c:	85 db                	test   %ebx,%ebx
+  80040e:	7e 07                	jle    800417 <libmain+0x74>
+		binaryname = argv[0];
+  800410:	8b 06                	mov    (%esi),%eax
+  800412:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800417:	83 ec 08             	sub    $0x8,%esp
+  80041a:	56                   	push   %esi
+  80041b:	53                   	push   %ebx
+  80041c:	e8 2a fe ff ff       	call   80024b <umain>
+
+	// exit gracefully
+	exit();
+  800421:	e8 0a 00 00 00       	call   800430 <exit>
+}
+  800426:	83 c4 10             	add    $0x10,%esp
+  800429:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80042c:	5b                   	pop    %ebx
+  80042d:	5e                   	pop    %esi
+  80042e:	5d                   	pop    %ebp
+  80042f:	c3                   	ret
+
+00800430 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800430:	55                   	push   %ebp
+  800431:	89 e5                	mov    %esp,%ebp
+  800433:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800436:	e8 53 15 00 00       	call   80198e <close_all>
+	sys_env_destroy(0);
+  80043b:	83 ec 0c             	sub    $0xc,%esp
+  80043e:	6a 00                	push   $0x0
+  800440:	e8 46 0b 00 00       	call   800f8b <sys_env_destroy>
+}
+  800445:	83 c4 10             	add    $0x10,%esp
+  800448:	c9                   	leave
+  800449:	c3                   	ret
+
+0080044a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80044a:	55                   	push   %ebp
+  80044b:	89 e5                	mov    %esp,%ebp
+  80044d:	53                   	push   %ebx
+  80044e:	83 ec 04             	sub    $0x4,%esp
+  800451:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800454:	8b 13                	mov    (%ebx),%edx
+  800456:	8d 42 01             	lea    0x1(%edx),%eax
+  800459:	89 03                	mov    %eax,(%ebx)
+  80045b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80045e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800462:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800467:	74 09                	je     800472 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800469:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80046d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800470:	c9                   	leave
+  800471:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800472:	83 ec 08             	sub    $0x8,%esp
+  800475:	68 ff 00 00 00       	push   $0xff
+  80047a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80047d:	50                   	push   %eax
+  80047e:	e8 cb 0a 00 00       	call   800f4e <sys_cputs>
+		b->idx = 0;
+  800483:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800489:	83 c4 10             	add    $0x10,%esp
+  80048c:	eb db                	jmp    800469 <putch+0x1f>
+
+0080048e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80048e:	55                   	push   %ebp
+  80048f:	89 e5                	mov    %esp,%ebp
+  800491:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800497:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80049e:	00 00 00 
+	b.cnt = 0;
+  8004a1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004a8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004ab:	ff 75 0c             	push   0xc(%ebp)
+  8004ae:	ff 75 08             	push   0x8(%ebp)
+  8004b1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004b7:	50                   	push   %eax
+  8004b8:	68 4a 04 80 00       	push   $0x80044a
+  8004bd:	e8 1c 01 00 00       	call   8005de <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004c2:	83 c4 08             	add    $0x8,%esp
+  8004c5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004cb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004d1:	50                   	push   %eax
+  8004d2:	e8 77 0a 00 00       	call   800f4e <sys_cputs>
+
+	return b.cnt;
+}
+  8004d7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004dd:	c9                   	leave
+  8004de:	c3                   	ret
+
+008004df <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004df:	55                   	push   %ebp
+  8004e0:	89 e5                	mov    %esp,%ebp
+  8004e2:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004e5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004e8:	50                   	push   %eax
+  8004e9:	ff 75 08             	push   0x8(%ebp)
+  8004ec:	e8 9d ff ff ff       	call   80048e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004f1:	c9                   	leave
+  8004f2:	c3                   	ret
+
+008004f3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004f3:	55                   	push   %ebp
+  8004f4:	89 e5                	mov    %esp,%ebp
+  8004f6:	57                   	push   %edi
+  8004f7:	56                   	push   %esi
+  8004f8:	53                   	push   %ebx
+  8004f9:	83 ec 1c             	sub    $0x1c,%esp
+  8004fc:	89 c3                	mov    %eax,%ebx
+  8004fe:	89 d6                	mov    %edx,%esi
+  800500:	8b 45 08             	mov    0x8(%ebp),%eax
+  800503:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800506:	89 d1                	mov    %edx,%ecx
+  800508:	89 c2                	mov    %eax,%edx
+  80050a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800510:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800513:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800516:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80051d:	39 c2                	cmp    %eax,%edx
+  80051f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800522:	73 4b                	jae    80056f <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80052a:	85 ff                	test   %edi,%edi
+  80052c:	7e 11                	jle    80053f <printnum+0x4c>
+			putch(padc, putdat);
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	56                   	push   %esi
+  800532:	ff 75 18             	push   0x18(%ebp)
+  800535:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800537:	83 c4 10             	add    $0x10,%esp
+  80053a:	83 ef 01             	sub    $0x1,%edi
+  80053d:	75 ef                	jne    80052e <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80053f:	83 ec 08             	sub    $0x8,%esp
+  800542:	56                   	push   %esi
+  800543:	83 ec 04             	sub    $0x4,%esp
+  800546:	ff 75 e4             	push   -0x1c(%ebp)
+  800549:	ff 75 e0             	push   -0x20(%ebp)
+  80054c:	ff 75 dc             	push   -0x24(%ebp)
+  80054f:	ff 75 d8             	push   -0x28(%ebp)
+  800552:	e8 95 3a 00 00       	call   803fec <__umoddi3>
+  800557:	83 c4 14             	add    $0x14,%esp
+  80055a:	0f be 80 e0 42 80 00 	movsbl 0x8042e0(%eax),%eax
+  800561:	50                   	push   %eax
+  800562:	ff d3                	call   *%ebx
+}
+  800564:	83 c4 10             	add    $0x10,%esp
+  800567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80056a:	5b                   	pop    %ebx
+  80056b:	5e                   	pop    %esi
+  80056c:	5f                   	pop    %edi
+  80056d:	5d                   	pop    %ebp
+  80056e:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80056f:	83 ec 0c             	sub    $0xc,%esp
+  800572:	ff 75 18             	push   0x18(%ebp)
+  800575:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800578:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80057b:	52                   	push   %edx
+  80057c:	50                   	push   %eax
+  80057d:	83 ec 08             	sub    $0x8,%esp
+  800580:	ff 75 e4             	push   -0x1c(%ebp)
+  800583:	ff 75 e0             	push   -0x20(%ebp)
+  800586:	ff 75 dc             	push   -0x24(%ebp)
+  800589:	ff 75 d8             	push   -0x28(%ebp)
+  80058c:	e8 95 39 00 00       	call   803f26 <__udivdi3>
+  800591:	83 c4 18             	add    $0x18,%esp
+  800594:	52                   	push   %edx
+  800595:	50                   	push   %eax
+  800596:	89 f2                	mov    %esi,%edx
+  800598:	89 d8                	mov    %ebx,%eax
+  80059a:	e8 54 ff ff ff       	call   8004f3 <printnum>
+  80059f:	83 c4 20             	add    $0x20,%esp
+  8005a2:	eb 9b                	jmp    80053f <printnum+0x4c>
+
+008005a4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005a4:	55                   	push   %ebp
+  8005a5:	89 e5                	mov    %esp,%ebp
+  8005a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005aa:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005ae:	8b 10                	mov    (%eax),%edx
+  8005b0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005b3:	73 0a                	jae    8005bf <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005b5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005b8:	89 08                	mov    %ecx,(%eax)
+  8005ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005bd:	88 02                	mov    %al,(%edx)
+}
+  8005bf:	5d                   	pop    %ebp
+  8005c0:	c3                   	ret
+
+008005c1 <printfmt>:
+{
+  8005c1:	55                   	push   %ebp
+  8005c2:	89 e5                	mov    %esp,%ebp
+  8005c4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005c7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005ca:	50                   	push   %eax
+  8005cb:	ff 75 10             	push   0x10(%ebp)
+  8005ce:	ff 75 0c             	push   0xc(%ebp)
+  8005d1:	ff 75 08             	push   0x8(%ebp)
+  8005d4:	e8 05 00 00 00       	call   8005de <vprintfmt>
+}
+  8005d9:	83 c4 10             	add    $0x10,%esp
+  8005dc:	c9                   	leave
+  8005dd:	c3                   	ret
+
+008005de <vprintfmt>:
+{
+  8005de:	55                   	push   %ebp
+  8005df:	89 e5                	mov    %esp,%ebp
+  8005e1:	57                   	push   %edi
+  8005e2:	56                   	push   %esi
+  8005e3:	53                   	push   %ebx
+  8005e4:	83 ec 2c             	sub    $0x2c,%esp
+  8005e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005ea:	89 df                	mov    %ebx,%edi
+  8005ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005ef:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005f2:	8d 70 01             	lea    0x1(%eax),%esi
+  8005f5:	0f b6 00             	movzbl (%eax),%eax
+  8005f8:	83 f8 25             	cmp    $0x25,%eax
+  8005fb:	74 1e                	je     80061b <vprintfmt+0x3d>
+			if (ch == '\0')
+  8005fd:	85 c0                	test   %eax,%eax
+  8005ff:	0f 84 15 05 00 00    	je     800b1a <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800605:	83 ec 08             	sub    $0x8,%esp
+  800608:	53                   	push   %ebx
+  800609:	50                   	push   %eax
+  80060a:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80060c:	83 c6 01             	add    $0x1,%esi
+  80060f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800613:	83 c4 10             	add    $0x10,%esp
+  800616:	83 f8 25             	cmp    $0x25,%eax
+  800619:	75 e2                	jne    8005fd <vprintfmt+0x1f>
+		padc = ' ';
+  80061b:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80061f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800626:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80062d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800634:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800639:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80063c:	8d 56 01             	lea    0x1(%esi),%edx
+  80063f:	0f b6 0e             	movzbl (%esi),%ecx
+  800642:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800645:	3c 55                	cmp    $0x55,%al
+  800647:	0f 87 3b 04 00 00    	ja     800a88 <vprintfmt+0x4aa>
+  80064d:	0f b6 c0             	movzbl %al,%eax
+  800650:	ff 24 85 60 44 80 00 	jmp    *0x804460(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800657:	89 75 10             	mov    %esi,0x10(%ebp)
+  80065a:	eb 93                	jmp    8005ef <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80065c:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80065e:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800662:	eb d8                	jmp    80063c <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800664:	89 d6                	mov    %edx,%esi
+  800666:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80066a:	eb d0                	jmp    80063c <vprintfmt+0x5e>
+  80066c:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80066f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800672:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800675:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800679:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80067c:	83 f9 09             	cmp    $0x9,%ecx
+  80067f:	77 6f                	ja     8006f0 <vprintfmt+0x112>
+  800681:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800684:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800687:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80068a:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80068e:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800691:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800694:	83 fe 09             	cmp    $0x9,%esi
+  800697:	76 eb                	jbe    800684 <vprintfmt+0xa6>
+  800699:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80069c:	89 d6                	mov    %edx,%esi
+  80069e:	eb 13                	jmp    8006b3 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 00                	mov    (%eax),%eax
+  8006a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ae:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006b1:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8006b3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006b7:	79 83                	jns    80063c <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8006b9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006bf:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8006c6:	e9 71 ff ff ff       	jmp    80063c <vprintfmt+0x5e>
+			if (width < 0)
+  8006cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006ce:	85 c9                	test   %ecx,%ecx
+  8006d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d5:	0f 49 c1             	cmovns %ecx,%eax
+  8006d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006db:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006dd:	e9 5a ff ff ff       	jmp    80063c <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006e2:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8006e4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006eb:	e9 4c ff ff ff       	jmp    80063c <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f0:	89 d6                	mov    %edx,%esi
+  8006f2:	eb bf                	jmp    8006b3 <vprintfmt+0xd5>
+			lflag++;
+  8006f4:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f8:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006fa:	e9 3d ff ff ff       	jmp    80063c <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8006ff:	89 55 10             	mov    %edx,0x10(%ebp)
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8d 70 04             	lea    0x4(%eax),%esi
+  800708:	83 ec 08             	sub    $0x8,%esp
+  80070b:	53                   	push   %ebx
+  80070c:	ff 30                	push   (%eax)
+  80070e:	ff d7                	call   *%edi
+			break;
+  800710:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800713:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800716:	e9 d4 fe ff ff       	jmp    8005ef <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80071b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	89 d0                	mov    %edx,%eax
+  800728:	f7 d8                	neg    %eax
+  80072a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80072d:	83 f8 12             	cmp    $0x12,%eax
+  800730:	7f 23                	jg     800755 <vprintfmt+0x177>
+  800732:	8b 14 85 c0 45 80 00 	mov    0x8045c0(,%eax,4),%edx
+  800739:	85 d2                	test   %edx,%edx
+  80073b:	74 18                	je     800755 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80073d:	52                   	push   %edx
+  80073e:	68 53 47 80 00       	push   $0x804753
+  800743:	53                   	push   %ebx
+  800744:	57                   	push   %edi
+  800745:	e8 77 fe ff ff       	call   8005c1 <printfmt>
+  80074a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80074d:	89 75 14             	mov    %esi,0x14(%ebp)
+  800750:	e9 9a fe ff ff       	jmp    8005ef <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800755:	50                   	push   %eax
+  800756:	68 f8 42 80 00       	push   $0x8042f8
+  80075b:	53                   	push   %ebx
+  80075c:	57                   	push   %edi
+  80075d:	e8 5f fe ff ff       	call   8005c1 <printfmt>
+  800762:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800765:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800768:	e9 82 fe ff ff       	jmp    8005ef <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80076d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	83 c0 04             	add    $0x4,%eax
+  800776:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 00                	mov    (%eax),%eax
+  80077e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800781:	85 c0                	test   %eax,%eax
+  800783:	0f 84 61 03 00 00    	je     800aea <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800789:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80078d:	7e 06                	jle    800795 <vprintfmt+0x1b7>
+  80078f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800793:	75 29                	jne    8007be <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800795:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800798:	8d 70 01             	lea    0x1(%eax),%esi
+  80079b:	0f b6 00             	movzbl (%eax),%eax
+  80079e:	0f be d0             	movsbl %al,%edx
+  8007a1:	85 d2                	test   %edx,%edx
+  8007a3:	0f 84 bb 00 00 00    	je     800864 <vprintfmt+0x286>
+  8007a9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007ac:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007af:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007b2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007b5:	eb 7a                	jmp    800831 <vprintfmt+0x253>
+				p = "(null)";
+  8007b7:	c7 45 d0 f1 42 80 00 	movl   $0x8042f1,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	ff 75 d4             	push   -0x2c(%ebp)
+  8007c4:	ff 75 d0             	push   -0x30(%ebp)
+  8007c7:	e8 e0 03 00 00       	call   800bac <strnlen>
+  8007cc:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8007cf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	85 d2                	test   %edx,%edx
+  8007d7:	0f 8e d6 02 00 00    	jle    800ab3 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8007dd:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8007e1:	83 ec 08             	sub    $0x8,%esp
+  8007e4:	53                   	push   %ebx
+  8007e5:	56                   	push   %esi
+  8007e6:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007e8:	83 c4 10             	add    $0x10,%esp
+  8007eb:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8007ef:	75 f0                	jne    8007e1 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007f1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007f4:	8d 70 01             	lea    0x1(%eax),%esi
+  8007f7:	0f b6 00             	movzbl (%eax),%eax
+  8007fa:	0f be d0             	movsbl %al,%edx
+  8007fd:	85 d2                	test   %edx,%edx
+  8007ff:	0f 84 da 02 00 00    	je     800adf <vprintfmt+0x501>
+  800805:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800808:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80080b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80080e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800811:	eb 1e                	jmp    800831 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800813:	83 ec 08             	sub    $0x8,%esp
+  800816:	ff 75 0c             	push   0xc(%ebp)
+  800819:	52                   	push   %edx
+  80081a:	ff 55 08             	call   *0x8(%ebp)
+  80081d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800820:	83 eb 01             	sub    $0x1,%ebx
+  800823:	83 c6 01             	add    $0x1,%esi
+  800826:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80082a:	0f be d0             	movsbl %al,%edx
+  80082d:	85 d2                	test   %edx,%edx
+  80082f:	74 2a                	je     80085b <vprintfmt+0x27d>
+  800831:	85 ff                	test   %edi,%edi
+  800833:	78 05                	js     80083a <vprintfmt+0x25c>
+  800835:	83 ef 01             	sub    $0x1,%edi
+  800838:	78 59                	js     800893 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80083a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80083e:	74 d3                	je     800813 <vprintfmt+0x235>
+  800840:	0f be c0             	movsbl %al,%eax
+  800843:	83 e8 20             	sub    $0x20,%eax
+  800846:	83 f8 5e             	cmp    $0x5e,%eax
+  800849:	76 c8                	jbe    800813 <vprintfmt+0x235>
+					putch('?', putdat);
+  80084b:	83 ec 08             	sub    $0x8,%esp
+  80084e:	ff 75 0c             	push   0xc(%ebp)
+  800851:	6a 3f                	push   $0x3f
+  800853:	ff 55 08             	call   *0x8(%ebp)
+  800856:	83 c4 10             	add    $0x10,%esp
+  800859:	eb c5                	jmp    800820 <vprintfmt+0x242>
+  80085b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80085e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800861:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800864:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800867:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80086b:	7e 1b                	jle    800888 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80086d:	83 ec 08             	sub    $0x8,%esp
+  800870:	53                   	push   %ebx
+  800871:	6a 20                	push   $0x20
+  800873:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800875:	83 c4 10             	add    $0x10,%esp
+  800878:	83 ee 01             	sub    $0x1,%esi
+  80087b:	75 f0                	jne    80086d <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80087d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800880:	89 45 14             	mov    %eax,0x14(%ebp)
+  800883:	e9 67 fd ff ff       	jmp    8005ef <vprintfmt+0x11>
+  800888:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088e:	e9 5c fd ff ff       	jmp    8005ef <vprintfmt+0x11>
+  800893:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800896:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800899:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80089c:	eb c6                	jmp    800864 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80089e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008a1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008a4:	83 f9 01             	cmp    $0x1,%ecx
+  8008a7:	7f 1f                	jg     8008c8 <vprintfmt+0x2ea>
+	else if (lflag)
+  8008a9:	85 c9                	test   %ecx,%ecx
+  8008ab:	74 67                	je     800914 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8008ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b0:	8b 30                	mov    (%eax),%esi
+  8008b2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008b5:	89 f0                	mov    %esi,%eax
+  8008b7:	c1 f8 1f             	sar    $0x1f,%eax
+  8008ba:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c6:	eb 17                	jmp    8008df <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8008c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cb:	8b 50 04             	mov    0x4(%eax),%edx
+  8008ce:	8b 00                	mov    (%eax),%eax
+  8008d0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008d3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d9:	8d 40 08             	lea    0x8(%eax),%eax
+  8008dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008df:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008e2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008e5:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8008ea:	85 c9                	test   %ecx,%ecx
+  8008ec:	0f 89 12 01 00 00    	jns    800a04 <vprintfmt+0x426>
+				putch('-', putdat);
+  8008f2:	83 ec 08             	sub    $0x8,%esp
+  8008f5:	53                   	push   %ebx
+  8008f6:	6a 2d                	push   $0x2d
+  8008f8:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8008fa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008fd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800900:	f7 da                	neg    %edx
+  800902:	83 d1 00             	adc    $0x0,%ecx
+  800905:	f7 d9                	neg    %ecx
+  800907:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80090a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80090f:	e9 f0 00 00 00       	jmp    800a04 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800914:	8b 45 14             	mov    0x14(%ebp),%eax
+  800917:	8b 30                	mov    (%eax),%esi
+  800919:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80091c:	89 f0                	mov    %esi,%eax
+  80091e:	c1 f8 1f             	sar    $0x1f,%eax
+  800921:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8d 40 04             	lea    0x4(%eax),%eax
+  80092a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092d:	eb b0                	jmp    8008df <vprintfmt+0x301>
+	if (lflag >= 2)
+  80092f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800932:	89 55 10             	mov    %edx,0x10(%ebp)
+  800935:	83 f9 01             	cmp    $0x1,%ecx
+  800938:	7f 1e                	jg     800958 <vprintfmt+0x37a>
+	else if (lflag)
+  80093a:	85 c9                	test   %ecx,%ecx
+  80093c:	74 32                	je     800970 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80093e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800941:	8b 10                	mov    (%eax),%edx
+  800943:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800948:	8d 40 04             	lea    0x4(%eax),%eax
+  80094b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80094e:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800953:	e9 ac 00 00 00       	jmp    800a04 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800958:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095b:	8b 10                	mov    (%eax),%edx
+  80095d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800960:	8d 40 08             	lea    0x8(%eax),%eax
+  800963:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800966:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80096b:	e9 94 00 00 00       	jmp    800a04 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800970:	8b 45 14             	mov    0x14(%ebp),%eax
+  800973:	8b 10                	mov    (%eax),%edx
+  800975:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097a:	8d 40 04             	lea    0x4(%eax),%eax
+  80097d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800980:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800985:	eb 7d                	jmp    800a04 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800987:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80098a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80098d:	83 f9 01             	cmp    $0x1,%ecx
+  800990:	7f 1b                	jg     8009ad <vprintfmt+0x3cf>
+	else if (lflag)
+  800992:	85 c9                	test   %ecx,%ecx
+  800994:	74 2c                	je     8009c2 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800996:	8b 45 14             	mov    0x14(%ebp),%eax
+  800999:	8b 10                	mov    (%eax),%edx
+  80099b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009a6:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8009ab:	eb 57                	jmp    800a04 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b0:	8b 10                	mov    (%eax),%edx
+  8009b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8009b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009bb:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8009c0:	eb 42                	jmp    800a04 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c5:	8b 10                	mov    (%eax),%edx
+  8009c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009d2:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8009d7:	eb 2b                	jmp    800a04 <vprintfmt+0x426>
+			putch('0', putdat);
+  8009d9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009dc:	83 ec 08             	sub    $0x8,%esp
+  8009df:	53                   	push   %ebx
+  8009e0:	6a 30                	push   $0x30
+  8009e2:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8009e4:	83 c4 08             	add    $0x8,%esp
+  8009e7:	53                   	push   %ebx
+  8009e8:	6a 78                	push   $0x78
+  8009ea:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8009ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ef:	8b 10                	mov    (%eax),%edx
+  8009f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009f6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ff:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800a04:	83 ec 0c             	sub    $0xc,%esp
+  800a07:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800a0b:	50                   	push   %eax
+  800a0c:	ff 75 e4             	push   -0x1c(%ebp)
+  800a0f:	56                   	push   %esi
+  800a10:	51                   	push   %ecx
+  800a11:	52                   	push   %edx
+  800a12:	89 da                	mov    %ebx,%edx
+  800a14:	89 f8                	mov    %edi,%eax
+  800a16:	e8 d8 fa ff ff       	call   8004f3 <printnum>
+			break;
+  800a1b:	83 c4 20             	add    $0x20,%esp
+  800a1e:	e9 cc fb ff ff       	jmp    8005ef <vprintfmt+0x11>
+	if (lflag >= 2)
+  800a23:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a26:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a29:	83 f9 01             	cmp    $0x1,%ecx
+  800a2c:	7f 1b                	jg     800a49 <vprintfmt+0x46b>
+	else if (lflag)
+  800a2e:	85 c9                	test   %ecx,%ecx
+  800a30:	74 2c                	je     800a5e <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800a32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a35:	8b 10                	mov    (%eax),%edx
+  800a37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a42:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800a47:	eb bb                	jmp    800a04 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a49:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4c:	8b 10                	mov    (%eax),%edx
+  800a4e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a51:	8d 40 08             	lea    0x8(%eax),%eax
+  800a54:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a57:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800a5c:	eb a6                	jmp    800a04 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a61:	8b 10                	mov    (%eax),%edx
+  800a63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a68:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a6e:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800a73:	eb 8f                	jmp    800a04 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800a75:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a78:	83 ec 08             	sub    $0x8,%esp
+  800a7b:	53                   	push   %ebx
+  800a7c:	6a 25                	push   $0x25
+  800a7e:	ff d7                	call   *%edi
+			break;
+  800a80:	83 c4 10             	add    $0x10,%esp
+  800a83:	e9 67 fb ff ff       	jmp    8005ef <vprintfmt+0x11>
+			putch('%', putdat);
+  800a88:	83 ec 08             	sub    $0x8,%esp
+  800a8b:	53                   	push   %ebx
+  800a8c:	6a 25                	push   $0x25
+  800a8e:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a90:	83 c4 10             	add    $0x10,%esp
+  800a93:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a97:	0f 84 ba fb ff ff    	je     800657 <vprintfmt+0x79>
+  800a9d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800aa0:	89 f0                	mov    %esi,%eax
+  800aa2:	83 e8 01             	sub    $0x1,%eax
+  800aa5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800aa9:	75 f7                	jne    800aa2 <vprintfmt+0x4c4>
+  800aab:	89 45 10             	mov    %eax,0x10(%ebp)
+  800aae:	e9 3c fb ff ff       	jmp    8005ef <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ab3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ab6:	8d 70 01             	lea    0x1(%eax),%esi
+  800ab9:	0f b6 00             	movzbl (%eax),%eax
+  800abc:	0f be d0             	movsbl %al,%edx
+  800abf:	85 d2                	test   %edx,%edx
+  800ac1:	74 11                	je     800ad4 <vprintfmt+0x4f6>
+  800ac3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ac6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ac9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800acc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800acf:	e9 5d fd ff ff       	jmp    800831 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ad4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ad7:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ada:	e9 10 fb ff ff       	jmp    8005ef <vprintfmt+0x11>
+  800adf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ae2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ae5:	e9 05 fb ff ff       	jmp    8005ef <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800aea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800aee:	7e 0a                	jle    800afa <vprintfmt+0x51c>
+  800af0:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800af4:	0f 85 bd fc ff ff    	jne    8007b7 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800afa:	ba 28 00 00 00       	mov    $0x28,%edx
+  800aff:	b8 28 00 00 00       	mov    $0x28,%eax
+  800b04:	be f2 42 80 00       	mov    $0x8042f2,%esi
+  800b09:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b0c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b0f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b12:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b15:	e9 17 fd ff ff       	jmp    800831 <vprintfmt+0x253>
+}
+  800b1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b1d:	5b                   	pop    %ebx
+  800b1e:	5e                   	pop    %esi
+  800b1f:	5f                   	pop    %edi
+  800b20:	5d                   	pop    %ebp
+  800b21:	c3                   	ret
+
+00800b22 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b22:	55                   	push   %ebp
+  800b23:	89 e5                	mov    %esp,%ebp
+  800b25:	83 ec 18             	sub    $0x18,%esp
+  800b28:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b2e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b31:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b35:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b38:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b3f:	85 c0                	test   %eax,%eax
+  800b41:	74 26                	je     800b69 <vsnprintf+0x47>
+  800b43:	85 d2                	test   %edx,%edx
+  800b45:	7e 22                	jle    800b69 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b47:	ff 75 14             	push   0x14(%ebp)
+  800b4a:	ff 75 10             	push   0x10(%ebp)
+  800b4d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b50:	50                   	push   %eax
+  800b51:	68 a4 05 80 00       	push   $0x8005a4
+  800b56:	e8 83 fa ff ff       	call   8005de <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b5b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b5e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b64:	83 c4 10             	add    $0x10,%esp
+}
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+		return -E_INVAL;
+  800b69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b6e:	eb f7                	jmp    800b67 <vsnprintf+0x45>
+
+00800b70 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b76:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b79:	50                   	push   %eax
+  800b7a:	ff 75 10             	push   0x10(%ebp)
+  800b7d:	ff 75 0c             	push   0xc(%ebp)
+  800b80:	ff 75 08             	push   0x8(%ebp)
+  800b83:	e8 9a ff ff ff       	call   800b22 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b88:	c9                   	leave
+  800b89:	c3                   	ret
+
+00800b8a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b8a:	55                   	push   %ebp
+  800b8b:	89 e5                	mov    %esp,%ebp
+  800b8d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b90:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b93:	74 10                	je     800ba5 <strlen+0x1b>
+  800b95:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b9a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b9d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ba1:	75 f7                	jne    800b9a <strlen+0x10>
+	return n;
+}
+  800ba3:	5d                   	pop    %ebp
+  800ba4:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800baa:	eb f7                	jmp    800ba3 <strlen+0x19>
+
+00800bac <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bb2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bb5:	85 d2                	test   %edx,%edx
+  800bb7:	74 16                	je     800bcf <strnlen+0x23>
+  800bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbe:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bc2:	74 09                	je     800bcd <strnlen+0x21>
+		n++;
+  800bc4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bc7:	39 d0                	cmp    %edx,%eax
+  800bc9:	75 f3                	jne    800bbe <strnlen+0x12>
+		n++;
+  800bcb:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800bcd:	5d                   	pop    %ebp
+  800bce:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd4:	eb f7                	jmp    800bcd <strnlen+0x21>
+
+00800bd6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bd6:	55                   	push   %ebp
+  800bd7:	89 e5                	mov    %esp,%ebp
+  800bd9:	53                   	push   %ebx
+  800bda:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800be9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bec:	83 c0 01             	add    $0x1,%eax
+  800bef:	84 d2                	test   %dl,%dl
+  800bf1:	75 f2                	jne    800be5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bf3:	89 c8                	mov    %ecx,%eax
+  800bf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf8:	c9                   	leave
+  800bf9:	c3                   	ret
+
+00800bfa <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	53                   	push   %ebx
+  800bfe:	83 ec 10             	sub    $0x10,%esp
+  800c01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c04:	53                   	push   %ebx
+  800c05:	e8 80 ff ff ff       	call   800b8a <strlen>
+  800c0a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c0d:	ff 75 0c             	push   0xc(%ebp)
+  800c10:	01 d8                	add    %ebx,%eax
+  800c12:	50                   	push   %eax
+  800c13:	e8 be ff ff ff       	call   800bd6 <strcpy>
+	return dst;
+}
+  800c18:	89 d8                	mov    %ebx,%eax
+  800c1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c1d:	c9                   	leave
+  800c1e:	c3                   	ret
+
+00800c1f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	56                   	push   %esi
+  800c23:	53                   	push   %ebx
+  800c24:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c2d:	85 db                	test   %ebx,%ebx
+  800c2f:	74 17                	je     800c48 <strncpy+0x29>
+  800c31:	01 f3                	add    %esi,%ebx
+  800c33:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800c35:	83 c0 01             	add    $0x1,%eax
+  800c38:	0f b6 0a             	movzbl (%edx),%ecx
+  800c3b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c3e:	80 f9 01             	cmp    $0x1,%cl
+  800c41:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c44:	39 c3                	cmp    %eax,%ebx
+  800c46:	75 ed                	jne    800c35 <strncpy+0x16>
+	}
+	return ret;
+}
+  800c48:	89 f0                	mov    %esi,%eax
+  800c4a:	5b                   	pop    %ebx
+  800c4b:	5e                   	pop    %esi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+
+00800c4e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	56                   	push   %esi
+  800c52:	53                   	push   %ebx
+  800c53:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c5c:	89 f0                	mov    %esi,%eax
+  800c5e:	85 db                	test   %ebx,%ebx
+  800c60:	74 1e                	je     800c80 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800c62:	83 eb 01             	sub    $0x1,%ebx
+  800c65:	74 16                	je     800c7d <strlcpy+0x2f>
+  800c67:	01 f3                	add    %esi,%ebx
+  800c69:	0f b6 0a             	movzbl (%edx),%ecx
+  800c6c:	84 c9                	test   %cl,%cl
+  800c6e:	74 0d                	je     800c7d <strlcpy+0x2f>
+			*dst++ = *src++;
+  800c70:	83 c2 01             	add    $0x1,%edx
+  800c73:	83 c0 01             	add    $0x1,%eax
+  800c76:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800c79:	39 d8                	cmp    %ebx,%eax
+  800c7b:	75 ec                	jne    800c69 <strlcpy+0x1b>
+		*dst = '\0';
+  800c7d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c80:	29 f0                	sub    %esi,%eax
+}
+  800c82:	5b                   	pop    %ebx
+  800c83:	5e                   	pop    %esi
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+
+00800c86 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c8f:	0f b6 01             	movzbl (%ecx),%eax
+  800c92:	84 c0                	test   %al,%al
+  800c94:	74 11                	je     800ca7 <strcmp+0x21>
+  800c96:	38 02                	cmp    %al,(%edx)
+  800c98:	75 0d                	jne    800ca7 <strcmp+0x21>
+		p++, q++;
+  800c9a:	83 c1 01             	add    $0x1,%ecx
+  800c9d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ca0:	0f b6 01             	movzbl (%ecx),%eax
+  800ca3:	84 c0                	test   %al,%al
+  800ca5:	75 ef                	jne    800c96 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ca7:	0f b6 c0             	movzbl %al,%eax
+  800caa:	0f b6 12             	movzbl (%edx),%edx
+  800cad:	29 d0                	sub    %edx,%eax
+}
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+
+00800cb1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	53                   	push   %ebx
+  800cb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cb8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cbb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800cc3:	85 d2                	test   %edx,%edx
+  800cc5:	74 2e                	je     800cf5 <strncmp+0x44>
+  800cc7:	0f b6 01             	movzbl (%ecx),%eax
+  800cca:	84 c0                	test   %al,%al
+  800ccc:	74 16                	je     800ce4 <strncmp+0x33>
+  800cce:	3a 03                	cmp    (%ebx),%al
+  800cd0:	75 12                	jne    800ce4 <strncmp+0x33>
+		n--, p++, q++;
+  800cd2:	83 c1 01             	add    $0x1,%ecx
+  800cd5:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800cd8:	83 ea 01             	sub    $0x1,%edx
+  800cdb:	75 ea                	jne    800cc7 <strncmp+0x16>
+		return 0;
+  800cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce2:	eb 11                	jmp    800cf5 <strncmp+0x44>
+  800ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800ce9:	85 d2                	test   %edx,%edx
+  800ceb:	74 08                	je     800cf5 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ced:	0f b6 01             	movzbl (%ecx),%eax
+  800cf0:	0f b6 13             	movzbl (%ebx),%edx
+  800cf3:	29 d0                	sub    %edx,%eax
+}
+  800cf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cf8:	c9                   	leave
+  800cf9:	c3                   	ret
+
+00800cfa <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d00:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d04:	0f b6 10             	movzbl (%eax),%edx
+  800d07:	84 d2                	test   %dl,%dl
+  800d09:	74 15                	je     800d20 <strchr+0x26>
+		if (*s == c)
+  800d0b:	38 d1                	cmp    %dl,%cl
+  800d0d:	74 0f                	je     800d1e <strchr+0x24>
+	for (; *s; s++)
+  800d0f:	83 c0 01             	add    $0x1,%eax
+  800d12:	0f b6 10             	movzbl (%eax),%edx
+  800d15:	84 d2                	test   %dl,%dl
+  800d17:	75 f2                	jne    800d0b <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800d19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+	return 0;
+  800d20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d25:	eb f7                	jmp    800d1e <strchr+0x24>
+
+00800d27 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	53                   	push   %ebx
+  800d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800d31:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800d34:	38 d3                	cmp    %dl,%bl
+  800d36:	74 14                	je     800d4c <strfind+0x25>
+  800d38:	89 d1                	mov    %edx,%ecx
+  800d3a:	84 db                	test   %bl,%bl
+  800d3c:	74 0e                	je     800d4c <strfind+0x25>
+	for (; *s; s++)
+  800d3e:	83 c0 01             	add    $0x1,%eax
+  800d41:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d44:	38 ca                	cmp    %cl,%dl
+  800d46:	74 04                	je     800d4c <strfind+0x25>
+  800d48:	84 d2                	test   %dl,%dl
+  800d4a:	75 f2                	jne    800d3e <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800d4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d4f:	c9                   	leave
+  800d50:	c3                   	ret
+
+00800d51 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	57                   	push   %edi
+  800d55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d58:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d5b:	85 c9                	test   %ecx,%ecx
+  800d5d:	74 20                	je     800d7f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d5f:	89 f8                	mov    %edi,%eax
+  800d61:	09 c8                	or     %ecx,%eax
+  800d63:	a8 03                	test   $0x3,%al
+  800d65:	75 12                	jne    800d79 <memset+0x28>
+		c &= 0xFF;
+  800d67:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d6b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d71:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d74:	fc                   	cld
+  800d75:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d77:	eb 06                	jmp    800d7f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d7c:	fc                   	cld
+  800d7d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d7f:	89 f8                	mov    %edi,%eax
+  800d81:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d84:	c9                   	leave
+  800d85:	c3                   	ret
+
+00800d86 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d94:	39 c6                	cmp    %eax,%esi
+  800d96:	73 32                	jae    800dca <memmove+0x44>
+  800d98:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d9b:	39 d0                	cmp    %edx,%eax
+  800d9d:	73 2b                	jae    800dca <memmove+0x44>
+		s += n;
+		d += n;
+  800d9f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800da2:	89 d6                	mov    %edx,%esi
+  800da4:	09 fe                	or     %edi,%esi
+  800da6:	09 ce                	or     %ecx,%esi
+  800da8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800dae:	75 0e                	jne    800dbe <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800db0:	83 ef 04             	sub    $0x4,%edi
+  800db3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800db6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800db9:	fd                   	std
+  800dba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dbc:	eb 09                	jmp    800dc7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dbe:	83 ef 01             	sub    $0x1,%edi
+  800dc1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dc4:	fd                   	std
+  800dc5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dc7:	fc                   	cld
+  800dc8:	eb 1a                	jmp    800de4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dca:	89 f2                	mov    %esi,%edx
+  800dcc:	09 c2                	or     %eax,%edx
+  800dce:	09 ca                	or     %ecx,%edx
+  800dd0:	f6 c2 03             	test   $0x3,%dl
+  800dd3:	75 0a                	jne    800ddf <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dd5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dd8:	89 c7                	mov    %eax,%edi
+  800dda:	fc                   	cld
+  800ddb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ddd:	eb 05                	jmp    800de4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ddf:	89 c7                	mov    %eax,%edi
+  800de1:	fc                   	cld
+  800de2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dee:	ff 75 10             	push   0x10(%ebp)
+  800df1:	ff 75 0c             	push   0xc(%ebp)
+  800df4:	ff 75 08             	push   0x8(%ebp)
+  800df7:	e8 8a ff ff ff       	call   800d86 <memmove>
+}
+  800dfc:	c9                   	leave
+  800dfd:	c3                   	ret
+
+00800dfe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	56                   	push   %esi
+  800e02:	53                   	push   %ebx
+  800e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e09:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e0c:	85 f6                	test   %esi,%esi
+  800e0e:	74 29                	je     800e39 <memcmp+0x3b>
+  800e10:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800e12:	0f b6 08             	movzbl (%eax),%ecx
+  800e15:	0f b6 1a             	movzbl (%edx),%ebx
+  800e18:	38 d9                	cmp    %bl,%cl
+  800e1a:	75 11                	jne    800e2d <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e1c:	83 c0 01             	add    $0x1,%eax
+  800e1f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e22:	39 c6                	cmp    %eax,%esi
+  800e24:	75 ec                	jne    800e12 <memcmp+0x14>
+	}
+
+	return 0;
+  800e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2b:	eb 08                	jmp    800e35 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800e2d:	0f b6 c1             	movzbl %cl,%eax
+  800e30:	0f b6 db             	movzbl %bl,%ebx
+  800e33:	29 d8                	sub    %ebx,%eax
+}
+  800e35:	5b                   	pop    %ebx
+  800e36:	5e                   	pop    %esi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+	return 0;
+  800e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3e:	eb f5                	jmp    800e35 <memcmp+0x37>
+
+00800e40 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e49:	89 c2                	mov    %eax,%edx
+  800e4b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e4e:	39 d0                	cmp    %edx,%eax
+  800e50:	73 0d                	jae    800e5f <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e52:	38 08                	cmp    %cl,(%eax)
+  800e54:	74 0d                	je     800e63 <memfind+0x23>
+	for (; s < ends; s++)
+  800e56:	83 c0 01             	add    $0x1,%eax
+  800e59:	39 c2                	cmp    %eax,%edx
+  800e5b:	75 f5                	jne    800e52 <memfind+0x12>
+  800e5d:	eb 06                	jmp    800e65 <memfind+0x25>
+  800e5f:	89 c2                	mov    %eax,%edx
+  800e61:	eb 02                	jmp    800e65 <memfind+0x25>
+  800e63:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800e65:	89 d0                	mov    %edx,%eax
+  800e67:	5d                   	pop    %ebp
+  800e68:	c3                   	ret
+
+00800e69 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	57                   	push   %edi
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  800e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e75:	0f b6 02             	movzbl (%edx),%eax
+  800e78:	3c 20                	cmp    $0x20,%al
+  800e7a:	74 04                	je     800e80 <strtol+0x17>
+  800e7c:	3c 09                	cmp    $0x9,%al
+  800e7e:	75 0e                	jne    800e8e <strtol+0x25>
+		s++;
+  800e80:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e83:	0f b6 02             	movzbl (%edx),%eax
+  800e86:	3c 20                	cmp    $0x20,%al
+  800e88:	74 f6                	je     800e80 <strtol+0x17>
+  800e8a:	3c 09                	cmp    $0x9,%al
+  800e8c:	74 f2                	je     800e80 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e8e:	3c 2b                	cmp    $0x2b,%al
+  800e90:	74 2a                	je     800ebc <strtol+0x53>
+	int neg = 0;
+  800e92:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e97:	3c 2d                	cmp    $0x2d,%al
+  800e99:	74 2b                	je     800ec6 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e9b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ea1:	75 0f                	jne    800eb2 <strtol+0x49>
+  800ea3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ea6:	74 28                	je     800ed0 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ea8:	85 db                	test   %ebx,%ebx
+  800eaa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eaf:	0f 44 d8             	cmove  %eax,%ebx
+  800eb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800eba:	eb 46                	jmp    800f02 <strtol+0x99>
+		s++;
+  800ebc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ebf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ec4:	eb d5                	jmp    800e9b <strtol+0x32>
+		s++, neg = 1;
+  800ec6:	83 c2 01             	add    $0x1,%edx
+  800ec9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ece:	eb cb                	jmp    800e9b <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ed0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ed4:	74 0e                	je     800ee4 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800ed6:	85 db                	test   %ebx,%ebx
+  800ed8:	75 d8                	jne    800eb2 <strtol+0x49>
+		s++, base = 8;
+  800eda:	83 c2 01             	add    $0x1,%edx
+  800edd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ee2:	eb ce                	jmp    800eb2 <strtol+0x49>
+		s += 2, base = 16;
+  800ee4:	83 c2 02             	add    $0x2,%edx
+  800ee7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800eec:	eb c4                	jmp    800eb2 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800eee:	0f be c0             	movsbl %al,%eax
+  800ef1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ef4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ef7:	7d 3a                	jge    800f33 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800ef9:	83 c2 01             	add    $0x1,%edx
+  800efc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f00:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800f02:	0f b6 02             	movzbl (%edx),%eax
+  800f05:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f08:	89 f3                	mov    %esi,%ebx
+  800f0a:	80 fb 09             	cmp    $0x9,%bl
+  800f0d:	76 df                	jbe    800eee <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800f0f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f12:	89 f3                	mov    %esi,%ebx
+  800f14:	80 fb 19             	cmp    $0x19,%bl
+  800f17:	77 08                	ja     800f21 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800f19:	0f be c0             	movsbl %al,%eax
+  800f1c:	83 e8 57             	sub    $0x57,%eax
+  800f1f:	eb d3                	jmp    800ef4 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f21:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f24:	89 f3                	mov    %esi,%ebx
+  800f26:	80 fb 19             	cmp    $0x19,%bl
+  800f29:	77 08                	ja     800f33 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800f2b:	0f be c0             	movsbl %al,%eax
+  800f2e:	83 e8 37             	sub    $0x37,%eax
+  800f31:	eb c1                	jmp    800ef4 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f33:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f37:	74 05                	je     800f3e <strtol+0xd5>
+		*endptr = (char *) s;
+  800f39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f3c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f3e:	89 c8                	mov    %ecx,%eax
+  800f40:	f7 d8                	neg    %eax
+  800f42:	85 ff                	test   %edi,%edi
+  800f44:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f47:	89 c8                	mov    %ecx,%eax
+  800f49:	5b                   	pop    %ebx
+  800f4a:	5e                   	pop    %esi
+  800f4b:	5f                   	pop    %edi
+  800f4c:	5d                   	pop    %ebp
+  800f4d:	c3                   	ret
+
+00800f4e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5f:	89 c3                	mov    %eax,%ebx
+  800f61:	89 c7                	mov    %eax,%edi
+  800f63:	89 c6                	mov    %eax,%esi
+  800f65:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+
+00800f6c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f77:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f7c:	89 d1                	mov    %edx,%ecx
+  800f7e:	89 d3                	mov    %edx,%ebx
+  800f80:	89 d7                	mov    %edx,%edi
+  800f82:	89 d6                	mov    %edx,%esi
+  800f84:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+
+00800f8b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	57                   	push   %edi
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+  800f91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fa1:	89 cb                	mov    %ecx,%ebx
+  800fa3:	89 cf                	mov    %ecx,%edi
+  800fa5:	89 ce                	mov    %ecx,%esi
+  800fa7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa9:	85 c0                	test   %eax,%eax
+  800fab:	7f 08                	jg     800fb5 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5f                   	pop    %edi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb5:	83 ec 0c             	sub    $0xc,%esp
+  800fb8:	50                   	push   %eax
+  800fb9:	6a 03                	push   $0x3
+  800fbb:	68 2b 46 80 00       	push   $0x80462b
+  800fc0:	6a 23                	push   $0x23
+  800fc2:	68 48 46 80 00       	push   $0x804648
+  800fc7:	e8 b1 2b 00 00       	call   803b7d <_panic>
+
+00800fcc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	57                   	push   %edi
+  800fd0:	56                   	push   %esi
+  800fd1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fdc:	89 d1                	mov    %edx,%ecx
+  800fde:	89 d3                	mov    %edx,%ebx
+  800fe0:	89 d7                	mov    %edx,%edi
+  800fe2:	89 d6                	mov    %edx,%esi
+  800fe4:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fe6:	5b                   	pop    %ebx
+  800fe7:	5e                   	pop    %esi
+  800fe8:	5f                   	pop    %edi
+  800fe9:	5d                   	pop    %ebp
+  800fea:	c3                   	ret
+
+00800feb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800feb:	55                   	push   %ebp
+  800fec:	89 e5                	mov    %esp,%ebp
+  800fee:	57                   	push   %edi
+  800fef:	56                   	push   %esi
+  800ff0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ffb:	89 d1                	mov    %edx,%ecx
+  800ffd:	89 d3                	mov    %edx,%ebx
+  800fff:	89 d7                	mov    %edx,%edi
+  801001:	89 d6                	mov    %edx,%esi
+  801003:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801005:	5b                   	pop    %ebx
+  801006:	5e                   	pop    %esi
+  801007:	5f                   	pop    %edi
+  801008:	5d                   	pop    %ebp
+  801009:	c3                   	ret
+
+0080100a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80100a:	55                   	push   %ebp
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	57                   	push   %edi
+  80100e:	56                   	push   %esi
+  80100f:	53                   	push   %ebx
+  801010:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801013:	be 00 00 00 00       	mov    $0x0,%esi
+  801018:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801023:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801026:	89 f7                	mov    %esi,%edi
+  801028:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	7f 08                	jg     801036 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80102e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801031:	5b                   	pop    %ebx
+  801032:	5e                   	pop    %esi
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801036:	83 ec 0c             	sub    $0xc,%esp
+  801039:	50                   	push   %eax
+  80103a:	6a 04                	push   $0x4
+  80103c:	68 2b 46 80 00       	push   $0x80462b
+  801041:	6a 23                	push   $0x23
+  801043:	68 48 46 80 00       	push   $0x804648
+  801048:	e8 30 2b 00 00       	call   803b7d <_panic>
+
+0080104d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	57                   	push   %edi
+  801051:	56                   	push   %esi
+  801052:	53                   	push   %ebx
+  801053:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801056:	8b 55 08             	mov    0x8(%ebp),%edx
+  801059:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801061:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801064:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801067:	8b 75 18             	mov    0x18(%ebp),%esi
+  80106a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106c:	85 c0                	test   %eax,%eax
+  80106e:	7f 08                	jg     801078 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801070:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801073:	5b                   	pop    %ebx
+  801074:	5e                   	pop    %esi
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801078:	83 ec 0c             	sub    $0xc,%esp
+  80107b:	50                   	push   %eax
+  80107c:	6a 05                	push   $0x5
+  80107e:	68 2b 46 80 00       	push   $0x80462b
+  801083:	6a 23                	push   $0x23
+  801085:	68 48 46 80 00       	push   $0x804648
+  80108a:	e8 ee 2a 00 00       	call   803b7d <_panic>
+
+0080108f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	57                   	push   %edi
+  801093:	56                   	push   %esi
+  801094:	53                   	push   %ebx
+  801095:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801098:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010a8:	89 df                	mov    %ebx,%edi
+  8010aa:	89 de                	mov    %ebx,%esi
+  8010ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	7f 08                	jg     8010ba <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ba:	83 ec 0c             	sub    $0xc,%esp
+  8010bd:	50                   	push   %eax
+  8010be:	6a 06                	push   $0x6
+  8010c0:	68 2b 46 80 00       	push   $0x80462b
+  8010c5:	6a 23                	push   $0x23
+  8010c7:	68 48 46 80 00       	push   $0x804648
+  8010cc:	e8 ac 2a 00 00       	call   803b7d <_panic>
+
+008010d1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	57                   	push   %edi
+  8010d5:	56                   	push   %esi
+  8010d6:	53                   	push   %ebx
+  8010d7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ea:	89 df                	mov    %ebx,%edi
+  8010ec:	89 de                	mov    %ebx,%esi
+  8010ee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f0:	85 c0                	test   %eax,%eax
+  8010f2:	7f 08                	jg     8010fc <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f7:	5b                   	pop    %ebx
+  8010f8:	5e                   	pop    %esi
+  8010f9:	5f                   	pop    %edi
+  8010fa:	5d                   	pop    %ebp
+  8010fb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010fc:	83 ec 0c             	sub    $0xc,%esp
+  8010ff:	50                   	push   %eax
+  801100:	6a 08                	push   $0x8
+  801102:	68 2b 46 80 00       	push   $0x80462b
+  801107:	6a 23                	push   $0x23
+  801109:	68 48 46 80 00       	push   $0x804648
+  80110e:	e8 6a 2a 00 00       	call   803b7d <_panic>
+
+00801113 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80111c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801121:	8b 55 08             	mov    0x8(%ebp),%edx
+  801124:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801127:	b8 09 00 00 00       	mov    $0x9,%eax
+  80112c:	89 df                	mov    %ebx,%edi
+  80112e:	89 de                	mov    %ebx,%esi
+  801130:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801132:	85 c0                	test   %eax,%eax
+  801134:	7f 08                	jg     80113e <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	50                   	push   %eax
+  801142:	6a 09                	push   $0x9
+  801144:	68 2b 46 80 00       	push   $0x80462b
+  801149:	6a 23                	push   $0x23
+  80114b:	68 48 46 80 00       	push   $0x804648
+  801150:	e8 28 2a 00 00       	call   803b7d <_panic>
+
+00801155 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+  80115b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80115e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801169:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80116e:	89 df                	mov    %ebx,%edi
+  801170:	89 de                	mov    %ebx,%esi
+  801172:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801174:	85 c0                	test   %eax,%eax
+  801176:	7f 08                	jg     801180 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801178:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117b:	5b                   	pop    %ebx
+  80117c:	5e                   	pop    %esi
+  80117d:	5f                   	pop    %edi
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801180:	83 ec 0c             	sub    $0xc,%esp
+  801183:	50                   	push   %eax
+  801184:	6a 0a                	push   $0xa
+  801186:	68 2b 46 80 00       	push   $0x80462b
+  80118b:	6a 23                	push   $0x23
+  80118d:	68 48 46 80 00       	push   $0x804648
+  801192:	e8 e6 29 00 00       	call   803b7d <_panic>
+
+00801197 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	57                   	push   %edi
+  80119b:	56                   	push   %esi
+  80119c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80119d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011b5:	5b                   	pop    %ebx
+  8011b6:	5e                   	pop    %esi
+  8011b7:	5f                   	pop    %edi
+  8011b8:	5d                   	pop    %ebp
+  8011b9:	c3                   	ret
+
+008011ba <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+  8011c0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d0:	89 cb                	mov    %ecx,%ebx
+  8011d2:	89 cf                	mov    %ecx,%edi
+  8011d4:	89 ce                	mov    %ecx,%esi
+  8011d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d8:	85 c0                	test   %eax,%eax
+  8011da:	7f 08                	jg     8011e4 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011df:	5b                   	pop    %ebx
+  8011e0:	5e                   	pop    %esi
+  8011e1:	5f                   	pop    %edi
+  8011e2:	5d                   	pop    %ebp
+  8011e3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e4:	83 ec 0c             	sub    $0xc,%esp
+  8011e7:	50                   	push   %eax
+  8011e8:	6a 0d                	push   $0xd
+  8011ea:	68 2b 46 80 00       	push   $0x80462b
+  8011ef:	6a 23                	push   $0x23
+  8011f1:	68 48 46 80 00       	push   $0x804648
+  8011f6:	e8 82 29 00 00       	call   803b7d <_panic>
+
+008011fb <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801201:	8b 55 08             	mov    0x8(%ebp),%edx
+  801204:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801207:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80120c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801212:	8b 75 18             	mov    0x18(%ebp),%esi
+  801215:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801217:	5b                   	pop    %ebx
+  801218:	5e                   	pop    %esi
+  801219:	5f                   	pop    %edi
+  80121a:	5d                   	pop    %ebp
+  80121b:	c3                   	ret
+
+0080121c <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	57                   	push   %edi
+  801220:	56                   	push   %esi
+  801221:	53                   	push   %ebx
+  801222:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801230:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801235:	89 df                	mov    %ebx,%edi
+  801237:	89 de                	mov    %ebx,%esi
+  801239:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80123b:	85 c0                	test   %eax,%eax
+  80123d:	7f 08                	jg     801247 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80123f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801242:	5b                   	pop    %ebx
+  801243:	5e                   	pop    %esi
+  801244:	5f                   	pop    %edi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801247:	83 ec 0c             	sub    $0xc,%esp
+  80124a:	50                   	push   %eax
+  80124b:	6a 0d                	push   $0xd
+  80124d:	68 2b 46 80 00       	push   $0x80462b
+  801252:	6a 23                	push   $0x23
+  801254:	68 48 46 80 00       	push   $0x804648
+  801259:	e8 1f 29 00 00       	call   803b7d <_panic>
+
+0080125e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	57                   	push   %edi
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801264:	ba 00 00 00 00       	mov    $0x0,%edx
+  801269:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80126e:	89 d1                	mov    %edx,%ecx
+  801270:	89 d3                	mov    %edx,%ebx
+  801272:	89 d7                	mov    %edx,%edi
+  801274:	89 d6                	mov    %edx,%esi
+  801276:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801278:	5b                   	pop    %ebx
+  801279:	5e                   	pop    %esi
+  80127a:	5f                   	pop    %edi
+  80127b:	5d                   	pop    %ebp
+  80127c:	c3                   	ret
+
+0080127d <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	57                   	push   %edi
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801288:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801293:	89 df                	mov    %ebx,%edi
+  801295:	89 de                	mov    %ebx,%esi
+  801297:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+
+0080129e <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	57                   	push   %edi
+  8012a2:	56                   	push   %esi
+  8012a3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ac:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012b1:	89 cb                	mov    %ecx,%ebx
+  8012b3:	89 cf                	mov    %ecx,%edi
+  8012b5:	89 ce                	mov    %ecx,%esi
+  8012b7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8012b9:	5b                   	pop    %ebx
+  8012ba:	5e                   	pop    %esi
+  8012bb:	5f                   	pop    %edi
+  8012bc:	5d                   	pop    %ebp
+  8012bd:	c3                   	ret
+
+008012be <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cf:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012d4:	89 df                	mov    %ebx,%edi
+  8012d6:	89 de                	mov    %ebx,%esi
+  8012d8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8012da:	5b                   	pop    %ebx
+  8012db:	5e                   	pop    %esi
+  8012dc:	5f                   	pop    %edi
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+
+008012df <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	56                   	push   %esi
+  8012e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012f5:	89 df                	mov    %ebx,%edi
+  8012f7:	89 de                	mov    %ebx,%esi
+  8012f9:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8012fb:	5b                   	pop    %ebx
+  8012fc:	5e                   	pop    %esi
+  8012fd:	5f                   	pop    %edi
+  8012fe:	5d                   	pop    %ebp
+  8012ff:	c3                   	ret
+
+00801300 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801300:	55                   	push   %ebp
+  801301:	89 e5                	mov    %esp,%ebp
+  801303:	57                   	push   %edi
+  801304:	56                   	push   %esi
+  801305:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801306:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801313:	89 cb                	mov    %ecx,%ebx
+  801315:	89 cf                	mov    %ecx,%edi
+  801317:	89 ce                	mov    %ecx,%esi
+  801319:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80131b:	5b                   	pop    %ebx
+  80131c:	5e                   	pop    %esi
+  80131d:	5f                   	pop    %edi
+  80131e:	5d                   	pop    %ebp
+  80131f:	c3                   	ret
+
+00801320 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801320:	55                   	push   %ebp
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	57                   	push   %edi
+  801324:	56                   	push   %esi
+  801325:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801326:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801331:	b8 14 00 00 00       	mov    $0x14,%eax
+  801336:	89 df                	mov    %ebx,%edi
+  801338:	89 de                	mov    %ebx,%esi
+  80133a:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80133c:	5b                   	pop    %ebx
+  80133d:	5e                   	pop    %esi
+  80133e:	5f                   	pop    %edi
+  80133f:	5d                   	pop    %ebp
+  801340:	c3                   	ret
+
+00801341 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	57                   	push   %edi
+  801345:	56                   	push   %esi
+  801346:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801347:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80134c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801354:	89 cb                	mov    %ecx,%ebx
+  801356:	89 cf                	mov    %ecx,%edi
+  801358:	89 ce                	mov    %ecx,%esi
+  80135a:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80135c:	5b                   	pop    %ebx
+  80135d:	5e                   	pop    %esi
+  80135e:	5f                   	pop    %edi
+  80135f:	5d                   	pop    %ebp
+  801360:	c3                   	ret
+
+00801361 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801361:	55                   	push   %ebp
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	57                   	push   %edi
+  801365:	56                   	push   %esi
+  801366:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801367:	be 00 00 00 00       	mov    $0x0,%esi
+  80136c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801372:	b8 16 00 00 00       	mov    $0x16,%eax
+  801377:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137a:	89 f7                	mov    %esi,%edi
+  80137c:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80137e:	5b                   	pop    %ebx
+  80137f:	5e                   	pop    %esi
+  801380:	5f                   	pop    %edi
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	57                   	push   %edi
+  801387:	56                   	push   %esi
+  801388:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801389:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801391:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801394:	b8 17 00 00 00       	mov    $0x17,%eax
+  801399:	89 df                	mov    %ebx,%edi
+  80139b:	89 de                	mov    %ebx,%esi
+  80139d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80139f:	5b                   	pop    %ebx
+  8013a0:	5e                   	pop    %esi
+  8013a1:	5f                   	pop    %edi
+  8013a2:	5d                   	pop    %ebp
+  8013a3:	c3                   	ret
+
+008013a4 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  8013a7:	57                   	push   %edi
+  8013a8:	56                   	push   %esi
+  8013a9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013b7:	89 cb                	mov    %ecx,%ebx
+  8013b9:	89 cf                	mov    %ecx,%edi
+  8013bb:	89 ce                	mov    %ecx,%esi
+  8013bd:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8013bf:	5b                   	pop    %ebx
+  8013c0:	5e                   	pop    %esi
+  8013c1:	5f                   	pop    %edi
+  8013c2:	5d                   	pop    %ebp
+  8013c3:	c3                   	ret
+
+008013c4 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8013c4:	55                   	push   %ebp
+  8013c5:	89 e5                	mov    %esp,%ebp
+  8013c7:	57                   	push   %edi
+  8013c8:	56                   	push   %esi
+  8013c9:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8013ca:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8013ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013db:	89 df                	mov    %ebx,%edi
+  8013dd:	89 de                	mov    %ebx,%esi
+  8013df:	cd 30                	int    $0x30
+}
+  8013e1:	5b                   	pop    %ebx
+  8013e2:	5e                   	pop    %esi
+  8013e3:	5f                   	pop    %edi
+  8013e4:	5d                   	pop    %ebp
+  8013e5:	c3                   	ret
+
+008013e6 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+  8013e9:	57                   	push   %edi
+  8013ea:	56                   	push   %esi
+  8013eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ff:	89 f7                	mov    %esi,%edi
+  801401:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801403:	5b                   	pop    %ebx
+  801404:	5e                   	pop    %esi
+  801405:	5f                   	pop    %edi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+
+00801408 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	57                   	push   %edi
+  80140c:	56                   	push   %esi
+  80140d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80140e:	be 00 00 00 00       	mov    $0x0,%esi
+  801413:	8b 55 08             	mov    0x8(%ebp),%edx
+  801416:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801419:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80141e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801421:	89 f7                	mov    %esi,%edi
+  801423:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801425:	5b                   	pop    %ebx
+  801426:	5e                   	pop    %esi
+  801427:	5f                   	pop    %edi
+  801428:	5d                   	pop    %ebp
+  801429:	c3                   	ret
+
+0080142a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801430:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801435:	8b 55 08             	mov    0x8(%ebp),%edx
+  801438:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801440:	89 df                	mov    %ebx,%edi
+  801442:	89 de                	mov    %ebx,%esi
+  801444:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801446:	5b                   	pop    %ebx
+  801447:	5e                   	pop    %esi
+  801448:	5f                   	pop    %edi
+  801449:	5d                   	pop    %ebp
+  80144a:	c3                   	ret
+
+0080144b <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80144b:	55                   	push   %ebp
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	57                   	push   %edi
+  80144f:	56                   	push   %esi
+  801450:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801451:	be 00 00 00 00       	mov    $0x0,%esi
+  801456:	8b 55 08             	mov    0x8(%ebp),%edx
+  801459:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801461:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801464:	89 f7                	mov    %esi,%edi
+  801466:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801468:	5b                   	pop    %ebx
+  801469:	5e                   	pop    %esi
+  80146a:	5f                   	pop    %edi
+  80146b:	5d                   	pop    %ebp
+  80146c:	c3                   	ret
+
+0080146d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80146d:	55                   	push   %ebp
+  80146e:	89 e5                	mov    %esp,%ebp
+  801470:	56                   	push   %esi
+  801471:	53                   	push   %ebx
+  801472:	8b 75 08             	mov    0x8(%ebp),%esi
+  801475:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801478:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801482:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801485:	83 ec 0c             	sub    $0xc,%esp
+  801488:	50                   	push   %eax
+  801489:	e8 2c fd ff ff       	call   8011ba <sys_ipc_recv>
+  80148e:	83 c4 10             	add    $0x10,%esp
+  801491:	85 c0                	test   %eax,%eax
+  801493:	0f 88 8b 00 00 00    	js     801524 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801499:	85 f6                	test   %esi,%esi
+  80149b:	74 2a                	je     8014c7 <ipc_recv+0x5a>
+  80149d:	89 e2                	mov    %esp,%edx
+  80149f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8014a4:	29 d0                	sub    %edx,%eax
+  8014a6:	89 c2                	mov    %eax,%edx
+  8014a8:	c1 ea 0f             	shr    $0xf,%edx
+  8014ab:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b5:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8014b8:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8014bf:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8014c5:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8014c7:	85 db                	test   %ebx,%ebx
+  8014c9:	74 2a                	je     8014f5 <ipc_recv+0x88>
+  8014cb:	89 e2                	mov    %esp,%edx
+  8014cd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8014d2:	29 d0                	sub    %edx,%eax
+  8014d4:	89 c2                	mov    %eax,%edx
+  8014d6:	c1 ea 0f             	shr    $0xf,%edx
+  8014d9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e3:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8014e6:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8014ed:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8014f3:	89 03                	mov    %eax,(%ebx)
+  8014f5:	89 e2                	mov    %esp,%edx
+  8014f7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8014fc:	29 d0                	sub    %edx,%eax
+  8014fe:	89 c2                	mov    %eax,%edx
+  801500:	c1 ea 0f             	shr    $0xf,%edx
+  801503:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150d:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801510:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801517:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80151d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801520:	5b                   	pop    %ebx
+  801521:	5e                   	pop    %esi
+  801522:	5d                   	pop    %ebp
+  801523:	c3                   	ret
+		if(from_env_store != NULL)
+  801524:	85 f6                	test   %esi,%esi
+  801526:	74 06                	je     80152e <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801528:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80152e:	85 db                	test   %ebx,%ebx
+  801530:	74 eb                	je     80151d <ipc_recv+0xb0>
+			*perm_store = 0;
+  801532:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801538:	eb e3                	jmp    80151d <ipc_recv+0xb0>
+
+0080153a <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	57                   	push   %edi
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  801540:	83 ec 14             	sub    $0x14,%esp
+  801543:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801546:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801549:	8b 75 14             	mov    0x14(%ebp),%esi
+  80154c:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801556:	0f 44 c2             	cmove  %edx,%eax
+  801559:	ff 75 10             	push   0x10(%ebp)
+  80155c:	50                   	push   %eax
+  80155d:	e8 ba fc ff ff       	call   80121c <sys_ipc_recv_pages>
+  801562:	83 c4 10             	add    $0x10,%esp
+  801565:	85 c0                	test   %eax,%eax
+  801567:	0f 88 ba 00 00 00    	js     801627 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80156d:	85 ff                	test   %edi,%edi
+  80156f:	74 2a                	je     80159b <ipc_recv_pages+0x61>
+  801571:	89 e2                	mov    %esp,%edx
+  801573:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801578:	29 d0                	sub    %edx,%eax
+  80157a:	89 c2                	mov    %eax,%edx
+  80157c:	c1 ea 0f             	shr    $0xf,%edx
+  80157f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801584:	b8 00 00 00 00       	mov    $0x0,%eax
+  801589:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80158c:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801593:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801599:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80159b:	85 f6                	test   %esi,%esi
+  80159d:	74 2a                	je     8015c9 <ipc_recv_pages+0x8f>
+  80159f:	89 e2                	mov    %esp,%edx
+  8015a1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015a6:	29 d0                	sub    %edx,%eax
+  8015a8:	89 c2                	mov    %eax,%edx
+  8015aa:	c1 ea 0f             	shr    $0xf,%edx
+  8015ad:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b7:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8015ba:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8015c1:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8015c7:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8015c9:	85 db                	test   %ebx,%ebx
+  8015cb:	74 2a                	je     8015f7 <ipc_recv_pages+0xbd>
+  8015cd:	89 e2                	mov    %esp,%edx
+  8015cf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015d4:	29 d0                	sub    %edx,%eax
+  8015d6:	89 c2                	mov    %eax,%edx
+  8015d8:	c1 ea 0f             	shr    $0xf,%edx
+  8015db:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e5:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8015e8:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8015ef:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8015f5:	89 03                	mov    %eax,(%ebx)
+  8015f7:	89 e2                	mov    %esp,%edx
+  8015f9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015fe:	29 d0                	sub    %edx,%eax
+  801600:	89 c2                	mov    %eax,%edx
+  801602:	c1 ea 0f             	shr    $0xf,%edx
+  801605:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80160a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160f:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801612:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801619:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80161f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801622:	5b                   	pop    %ebx
+  801623:	5e                   	pop    %esi
+  801624:	5f                   	pop    %edi
+  801625:	5d                   	pop    %ebp
+  801626:	c3                   	ret
+		if (from_env_store)
+  801627:	85 ff                	test   %edi,%edi
+  801629:	74 06                	je     801631 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80162b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801631:	85 f6                	test   %esi,%esi
+  801633:	74 06                	je     80163b <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801635:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80163b:	85 db                	test   %ebx,%ebx
+  80163d:	74 e0                	je     80161f <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  80163f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801645:	eb d8                	jmp    80161f <ipc_recv_pages+0xe5>
+
+00801647 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801647:	55                   	push   %ebp
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	57                   	push   %edi
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+  80164d:	83 ec 1c             	sub    $0x1c,%esp
+  801650:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801653:	8b 75 08             	mov    0x8(%ebp),%esi
+  801656:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80165c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801660:	75 2b                	jne    80168d <ipc_try_send_pages+0x46>
+  801662:	89 e2                	mov    %esp,%edx
+  801664:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801669:	29 d0                	sub    %edx,%eax
+  80166b:	89 c2                	mov    %eax,%edx
+  80166d:	c1 ea 0f             	shr    $0xf,%edx
+  801670:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167a:	0f 42 c2             	cmovb  %edx,%eax
+  80167d:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801684:	8b 70 48             	mov    0x48(%eax),%esi
+  801687:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80168d:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801693:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801698:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80169b:	85 ff                	test   %edi,%edi
+  80169d:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8016a2:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8016a5:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8016ab:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8016b1:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8016b7:	83 ec 0c             	sub    $0xc,%esp
+  8016ba:	ff 75 14             	push   0x14(%ebp)
+  8016bd:	ff 75 18             	push   0x18(%ebp)
+  8016c0:	57                   	push   %edi
+  8016c1:	ff 75 0c             	push   0xc(%ebp)
+  8016c4:	ff 75 08             	push   0x8(%ebp)
+  8016c7:	e8 2f fb ff ff       	call   8011fb <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8016cc:	83 c4 20             	add    $0x20,%esp
+  8016cf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8016d2:	75 21                	jne    8016f5 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8016d4:	83 ec 04             	sub    $0x4,%esp
+  8016d7:	6a ff                	push   $0xffffffff
+  8016d9:	53                   	push   %ebx
+  8016da:	ff 75 e4             	push   -0x1c(%ebp)
+  8016dd:	e8 26 fd ff ff       	call   801408 <sys_futex_wait>
+  8016e2:	83 c4 10             	add    $0x10,%esp
+  8016e5:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8016e8:	74 c7                	je     8016b1 <ipc_try_send_pages+0x6a>
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	79 c3                	jns    8016b1 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8016ee:	e8 f8 f8 ff ff       	call   800feb <sys_yield>
+  8016f3:	eb bc                	jmp    8016b1 <ipc_try_send_pages+0x6a>
+	}
+}
+  8016f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f8:	5b                   	pop    %ebx
+  8016f9:	5e                   	pop    %esi
+  8016fa:	5f                   	pop    %edi
+  8016fb:	5d                   	pop    %ebp
+  8016fc:	c3                   	ret
+
+008016fd <ipc_send>:
+{
+  8016fd:	55                   	push   %ebp
+  8016fe:	89 e5                	mov    %esp,%ebp
+  801700:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801703:	ff 75 14             	push   0x14(%ebp)
+  801706:	6a 01                	push   $0x1
+  801708:	ff 75 10             	push   0x10(%ebp)
+  80170b:	ff 75 0c             	push   0xc(%ebp)
+  80170e:	ff 75 08             	push   0x8(%ebp)
+  801711:	e8 31 ff ff ff       	call   801647 <ipc_try_send_pages>
+  801716:	83 c4 20             	add    $0x20,%esp
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 02                	js     80171f <ipc_send+0x22>
+}
+  80171d:	c9                   	leave
+  80171e:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80171f:	50                   	push   %eax
+  801720:	68 56 46 80 00       	push   $0x804656
+  801725:	6a 3f                	push   $0x3f
+  801727:	68 6b 46 80 00       	push   $0x80466b
+  80172c:	e8 4c 24 00 00       	call   803b7d <_panic>
+
+00801731 <ipc_send_pages>:
+{
+  801731:	55                   	push   %ebp
+  801732:	89 e5                	mov    %esp,%ebp
+  801734:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801737:	ff 75 18             	push   0x18(%ebp)
+  80173a:	ff 75 14             	push   0x14(%ebp)
+  80173d:	ff 75 10             	push   0x10(%ebp)
+  801740:	ff 75 0c             	push   0xc(%ebp)
+  801743:	ff 75 08             	push   0x8(%ebp)
+  801746:	e8 fc fe ff ff       	call   801647 <ipc_try_send_pages>
+  80174b:	83 c4 20             	add    $0x20,%esp
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	78 02                	js     801754 <ipc_send_pages+0x23>
+}
+  801752:	c9                   	leave
+  801753:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801754:	50                   	push   %eax
+  801755:	68 75 46 80 00       	push   $0x804675
+  80175a:	6a 64                	push   $0x64
+  80175c:	68 6b 46 80 00       	push   $0x80466b
+  801761:	e8 17 24 00 00       	call   803b7d <_panic>
+
+00801766 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801766:	55                   	push   %ebp
+  801767:	89 e5                	mov    %esp,%ebp
+  801769:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80176c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801771:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801777:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80177d:	8b 52 50             	mov    0x50(%edx),%edx
+  801780:	39 ca                	cmp    %ecx,%edx
+  801782:	74 11                	je     801795 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801784:	83 c0 01             	add    $0x1,%eax
+  801787:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80178c:	75 e3                	jne    801771 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80178e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801793:	eb 0e                	jmp    8017a3 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801795:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80179b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017a0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8017a3:	5d                   	pop    %ebp
+  8017a4:	c3                   	ret
+
+008017a5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017a5:	55                   	push   %ebp
+  8017a6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ab:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017b0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017b3:	5d                   	pop    %ebp
+  8017b4:	c3                   	ret
+
+008017b5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017b5:	55                   	push   %ebp
+  8017b6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017bb:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017c5:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8017ca:	5d                   	pop    %ebp
+  8017cb:	c3                   	ret
+
+008017cc <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017cc:	55                   	push   %ebp
+  8017cd:	89 e5                	mov    %esp,%ebp
+  8017cf:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017d4:	89 c2                	mov    %eax,%edx
+  8017d6:	c1 ea 16             	shr    $0x16,%edx
+  8017d9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017e0:	f6 c2 01             	test   $0x1,%dl
+  8017e3:	74 29                	je     80180e <fd_alloc+0x42>
+  8017e5:	89 c2                	mov    %eax,%edx
+  8017e7:	c1 ea 0c             	shr    $0xc,%edx
+  8017ea:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017f1:	f6 c2 01             	test   $0x1,%dl
+  8017f4:	74 18                	je     80180e <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  8017f6:	05 00 10 00 00       	add    $0x1000,%eax
+  8017fb:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801800:	75 d2                	jne    8017d4 <fd_alloc+0x8>
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801807:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80180c:	eb 05                	jmp    801813 <fd_alloc+0x47>
+			return 0;
+  80180e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801813:	8b 55 08             	mov    0x8(%ebp),%edx
+  801816:	89 02                	mov    %eax,(%edx)
+}
+  801818:	89 c8                	mov    %ecx,%eax
+  80181a:	5d                   	pop    %ebp
+  80181b:	c3                   	ret
+
+0080181c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80181c:	55                   	push   %ebp
+  80181d:	89 e5                	mov    %esp,%ebp
+  80181f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801822:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801827:	77 30                	ja     801859 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801829:	c1 e0 0c             	shl    $0xc,%eax
+  80182c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801831:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801837:	f6 c2 01             	test   $0x1,%dl
+  80183a:	74 24                	je     801860 <fd_lookup+0x44>
+  80183c:	89 c2                	mov    %eax,%edx
+  80183e:	c1 ea 0c             	shr    $0xc,%edx
+  801841:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801848:	f6 c2 01             	test   $0x1,%dl
+  80184b:	74 1a                	je     801867 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80184d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801850:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801852:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801857:	5d                   	pop    %ebp
+  801858:	c3                   	ret
+		return -E_INVAL;
+  801859:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185e:	eb f7                	jmp    801857 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801860:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801865:	eb f0                	jmp    801857 <fd_lookup+0x3b>
+  801867:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186c:	eb e9                	jmp    801857 <fd_lookup+0x3b>
+
+0080186e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	53                   	push   %ebx
+  801872:	83 ec 04             	sub    $0x4,%esp
+  801875:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187d:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801882:	39 13                	cmp    %edx,(%ebx)
+  801884:	74 54                	je     8018da <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801886:	83 c0 01             	add    $0x1,%eax
+  801889:	8b 1c 85 0c 47 80 00 	mov    0x80470c(,%eax,4),%ebx
+  801890:	85 db                	test   %ebx,%ebx
+  801892:	75 ee                	jne    801882 <dev_lookup+0x14>
+  801894:	89 e1                	mov    %esp,%ecx
+  801896:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80189b:	29 c8                	sub    %ecx,%eax
+  80189d:	89 c1                	mov    %eax,%ecx
+  80189f:	c1 e9 0f             	shr    $0xf,%ecx
+  8018a2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ac:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018af:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8018b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8018b9:	83 ec 04             	sub    $0x4,%esp
+  8018bc:	52                   	push   %edx
+  8018bd:	50                   	push   %eax
+  8018be:	68 90 46 80 00       	push   $0x804690
+  8018c3:	e8 17 ec ff ff       	call   8004df <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018c8:	83 c4 10             	add    $0x10,%esp
+  8018cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018d3:	89 1a                	mov    %ebx,(%edx)
+}
+  8018d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d8:	c9                   	leave
+  8018d9:	c3                   	ret
+			return 0;
+  8018da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018df:	eb ef                	jmp    8018d0 <dev_lookup+0x62>
+
+008018e1 <fd_close>:
+{
+  8018e1:	55                   	push   %ebp
+  8018e2:	89 e5                	mov    %esp,%ebp
+  8018e4:	57                   	push   %edi
+  8018e5:	56                   	push   %esi
+  8018e6:	53                   	push   %ebx
+  8018e7:	83 ec 24             	sub    $0x24,%esp
+  8018ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018f0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018f3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018f4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018fa:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018fd:	50                   	push   %eax
+  8018fe:	e8 19 ff ff ff       	call   80181c <fd_lookup>
+  801903:	89 c3                	mov    %eax,%ebx
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 05                	js     801911 <fd_close+0x30>
+	    || fd != fd2)
+  80190c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80190f:	74 0f                	je     801920 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801911:	85 ff                	test   %edi,%edi
+  801913:	0f 44 df             	cmove  %edi,%ebx
+}
+  801916:	89 d8                	mov    %ebx,%eax
+  801918:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191b:	5b                   	pop    %ebx
+  80191c:	5e                   	pop    %esi
+  80191d:	5f                   	pop    %edi
+  80191e:	5d                   	pop    %ebp
+  80191f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801920:	83 ec 08             	sub    $0x8,%esp
+  801923:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801926:	50                   	push   %eax
+  801927:	ff 36                	push   (%esi)
+  801929:	e8 40 ff ff ff       	call   80186e <dev_lookup>
+  80192e:	89 c3                	mov    %eax,%ebx
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	85 c0                	test   %eax,%eax
+  801935:	78 1a                	js     801951 <fd_close+0x70>
+		if (dev->dev_close)
+  801937:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80193a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80193d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801942:	85 c0                	test   %eax,%eax
+  801944:	74 0b                	je     801951 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801946:	83 ec 0c             	sub    $0xc,%esp
+  801949:	56                   	push   %esi
+  80194a:	ff d0                	call   *%eax
+  80194c:	89 c3                	mov    %eax,%ebx
+  80194e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801951:	83 ec 08             	sub    $0x8,%esp
+  801954:	56                   	push   %esi
+  801955:	6a 00                	push   $0x0
+  801957:	e8 33 f7 ff ff       	call   80108f <sys_page_unmap>
+	return r;
+  80195c:	83 c4 10             	add    $0x10,%esp
+  80195f:	eb b5                	jmp    801916 <fd_close+0x35>
+
+00801961 <close>:
+
+int
+close(int fdnum)
+{
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801967:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196a:	50                   	push   %eax
+  80196b:	ff 75 08             	push   0x8(%ebp)
+  80196e:	e8 a9 fe ff ff       	call   80181c <fd_lookup>
+  801973:	83 c4 10             	add    $0x10,%esp
+  801976:	85 c0                	test   %eax,%eax
+  801978:	79 02                	jns    80197c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80197a:	c9                   	leave
+  80197b:	c3                   	ret
+		return fd_close(fd, 1);
+  80197c:	83 ec 08             	sub    $0x8,%esp
+  80197f:	6a 01                	push   $0x1
+  801981:	ff 75 f4             	push   -0xc(%ebp)
+  801984:	e8 58 ff ff ff       	call   8018e1 <fd_close>
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	eb ec                	jmp    80197a <close+0x19>
+
+0080198e <close_all>:
+
+void
+close_all(void)
+{
+  80198e:	55                   	push   %ebp
+  80198f:	89 e5                	mov    %esp,%ebp
+  801991:	53                   	push   %ebx
+  801992:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801995:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80199a:	83 ec 0c             	sub    $0xc,%esp
+  80199d:	53                   	push   %ebx
+  80199e:	e8 be ff ff ff       	call   801961 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019a3:	83 c3 01             	add    $0x1,%ebx
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8019af:	75 e9                	jne    80199a <close_all+0xc>
+}
+  8019b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b4:	c9                   	leave
+  8019b5:	c3                   	ret
+
+008019b6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019b6:	55                   	push   %ebp
+  8019b7:	89 e5                	mov    %esp,%ebp
+  8019b9:	57                   	push   %edi
+  8019ba:	56                   	push   %esi
+  8019bb:	53                   	push   %ebx
+  8019bc:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019c2:	50                   	push   %eax
+  8019c3:	ff 75 08             	push   0x8(%ebp)
+  8019c6:	e8 51 fe ff ff       	call   80181c <fd_lookup>
+  8019cb:	89 c3                	mov    %eax,%ebx
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 7f                	js     801a53 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019d4:	83 ec 0c             	sub    $0xc,%esp
+  8019d7:	ff 75 0c             	push   0xc(%ebp)
+  8019da:	e8 82 ff ff ff       	call   801961 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019e2:	c1 e6 0c             	shl    $0xc,%esi
+  8019e5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019ee:	89 3c 24             	mov    %edi,(%esp)
+  8019f1:	e8 bf fd ff ff       	call   8017b5 <fd2data>
+  8019f6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019f8:	89 34 24             	mov    %esi,(%esp)
+  8019fb:	e8 b5 fd ff ff       	call   8017b5 <fd2data>
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801a06:	89 d8                	mov    %ebx,%eax
+  801a08:	c1 e8 16             	shr    $0x16,%eax
+  801a0b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a12:	a8 01                	test   $0x1,%al
+  801a14:	74 11                	je     801a27 <dup+0x71>
+  801a16:	89 d8                	mov    %ebx,%eax
+  801a18:	c1 e8 0c             	shr    $0xc,%eax
+  801a1b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a22:	f6 c2 01             	test   $0x1,%dl
+  801a25:	75 36                	jne    801a5d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a27:	89 f8                	mov    %edi,%eax
+  801a29:	c1 e8 0c             	shr    $0xc,%eax
+  801a2c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a33:	83 ec 0c             	sub    $0xc,%esp
+  801a36:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a3b:	50                   	push   %eax
+  801a3c:	56                   	push   %esi
+  801a3d:	6a 00                	push   $0x0
+  801a3f:	57                   	push   %edi
+  801a40:	6a 00                	push   $0x0
+  801a42:	e8 06 f6 ff ff       	call   80104d <sys_page_map>
+  801a47:	89 c3                	mov    %eax,%ebx
+  801a49:	83 c4 20             	add    $0x20,%esp
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	78 33                	js     801a83 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a53:	89 d8                	mov    %ebx,%eax
+  801a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a58:	5b                   	pop    %ebx
+  801a59:	5e                   	pop    %esi
+  801a5a:	5f                   	pop    %edi
+  801a5b:	5d                   	pop    %ebp
+  801a5c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a5d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a64:	83 ec 0c             	sub    $0xc,%esp
+  801a67:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a6c:	50                   	push   %eax
+  801a6d:	ff 75 d4             	push   -0x2c(%ebp)
+  801a70:	6a 00                	push   $0x0
+  801a72:	53                   	push   %ebx
+  801a73:	6a 00                	push   $0x0
+  801a75:	e8 d3 f5 ff ff       	call   80104d <sys_page_map>
+  801a7a:	89 c3                	mov    %eax,%ebx
+  801a7c:	83 c4 20             	add    $0x20,%esp
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	79 a4                	jns    801a27 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a83:	83 ec 08             	sub    $0x8,%esp
+  801a86:	56                   	push   %esi
+  801a87:	6a 00                	push   $0x0
+  801a89:	e8 01 f6 ff ff       	call   80108f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a8e:	83 c4 08             	add    $0x8,%esp
+  801a91:	ff 75 d4             	push   -0x2c(%ebp)
+  801a94:	6a 00                	push   $0x0
+  801a96:	e8 f4 f5 ff ff       	call   80108f <sys_page_unmap>
+	return r;
+  801a9b:	83 c4 10             	add    $0x10,%esp
+  801a9e:	eb b3                	jmp    801a53 <dup+0x9d>
+
+00801aa0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801aa0:	55                   	push   %ebp
+  801aa1:	89 e5                	mov    %esp,%ebp
+  801aa3:	56                   	push   %esi
+  801aa4:	53                   	push   %ebx
+  801aa5:	83 ec 18             	sub    $0x18,%esp
+  801aa8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aae:	50                   	push   %eax
+  801aaf:	53                   	push   %ebx
+  801ab0:	e8 67 fd ff ff       	call   80181c <fd_lookup>
+  801ab5:	83 c4 10             	add    $0x10,%esp
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	78 3c                	js     801af8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801abc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801abf:	83 ec 08             	sub    $0x8,%esp
+  801ac2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac5:	50                   	push   %eax
+  801ac6:	ff 36                	push   (%esi)
+  801ac8:	e8 a1 fd ff ff       	call   80186e <dev_lookup>
+  801acd:	83 c4 10             	add    $0x10,%esp
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 24                	js     801af8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ad4:	8b 46 08             	mov    0x8(%esi),%eax
+  801ad7:	83 e0 03             	and    $0x3,%eax
+  801ada:	83 f8 01             	cmp    $0x1,%eax
+  801add:	74 20                	je     801aff <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801adf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae2:	8b 40 08             	mov    0x8(%eax),%eax
+  801ae5:	85 c0                	test   %eax,%eax
+  801ae7:	74 54                	je     801b3d <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ae9:	83 ec 04             	sub    $0x4,%esp
+  801aec:	ff 75 10             	push   0x10(%ebp)
+  801aef:	ff 75 0c             	push   0xc(%ebp)
+  801af2:	56                   	push   %esi
+  801af3:	ff d0                	call   *%eax
+  801af5:	83 c4 10             	add    $0x10,%esp
+}
+  801af8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afb:	5b                   	pop    %ebx
+  801afc:	5e                   	pop    %esi
+  801afd:	5d                   	pop    %ebp
+  801afe:	c3                   	ret
+  801aff:	89 e2                	mov    %esp,%edx
+  801b01:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b06:	29 d0                	sub    %edx,%eax
+  801b08:	89 c2                	mov    %eax,%edx
+  801b0a:	c1 ea 0f             	shr    $0xf,%edx
+  801b0d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b17:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b1a:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801b21:	8b 40 48             	mov    0x48(%eax),%eax
+  801b24:	83 ec 04             	sub    $0x4,%esp
+  801b27:	53                   	push   %ebx
+  801b28:	50                   	push   %eax
+  801b29:	68 d1 46 80 00       	push   $0x8046d1
+  801b2e:	e8 ac e9 ff ff       	call   8004df <cprintf>
+		return -E_INVAL;
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3b:	eb bb                	jmp    801af8 <read+0x58>
+		return -E_NOT_SUPP;
+  801b3d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b42:	eb b4                	jmp    801af8 <read+0x58>
+
+00801b44 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b44:	55                   	push   %ebp
+  801b45:	89 e5                	mov    %esp,%ebp
+  801b47:	57                   	push   %edi
+  801b48:	56                   	push   %esi
+  801b49:	53                   	push   %ebx
+  801b4a:	83 ec 0c             	sub    $0xc,%esp
+  801b4d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b50:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b53:	85 f6                	test   %esi,%esi
+  801b55:	74 30                	je     801b87 <readn+0x43>
+  801b57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b61:	83 ec 04             	sub    $0x4,%esp
+  801b64:	89 f2                	mov    %esi,%edx
+  801b66:	29 c2                	sub    %eax,%edx
+  801b68:	52                   	push   %edx
+  801b69:	01 f8                	add    %edi,%eax
+  801b6b:	50                   	push   %eax
+  801b6c:	ff 75 08             	push   0x8(%ebp)
+  801b6f:	e8 2c ff ff ff       	call   801aa0 <read>
+		if (m < 0)
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 15                	js     801b90 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801b7b:	74 11                	je     801b8e <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801b7d:	01 c3                	add    %eax,%ebx
+  801b7f:	89 d8                	mov    %ebx,%eax
+  801b81:	39 f3                	cmp    %esi,%ebx
+  801b83:	72 dc                	jb     801b61 <readn+0x1d>
+  801b85:	eb 09                	jmp    801b90 <readn+0x4c>
+  801b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8c:	eb 02                	jmp    801b90 <readn+0x4c>
+  801b8e:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b93:	5b                   	pop    %ebx
+  801b94:	5e                   	pop    %esi
+  801b95:	5f                   	pop    %edi
+  801b96:	5d                   	pop    %ebp
+  801b97:	c3                   	ret
+
+00801b98 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b98:	55                   	push   %ebp
+  801b99:	89 e5                	mov    %esp,%ebp
+  801b9b:	56                   	push   %esi
+  801b9c:	53                   	push   %ebx
+  801b9d:	83 ec 18             	sub    $0x18,%esp
+  801ba0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ba3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ba6:	50                   	push   %eax
+  801ba7:	53                   	push   %ebx
+  801ba8:	e8 6f fc ff ff       	call   80181c <fd_lookup>
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	78 37                	js     801beb <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bb4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bb7:	83 ec 08             	sub    $0x8,%esp
+  801bba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bbd:	50                   	push   %eax
+  801bbe:	ff 36                	push   (%esi)
+  801bc0:	e8 a9 fc ff ff       	call   80186e <dev_lookup>
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 1f                	js     801beb <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bcc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bd0:	74 20                	je     801bf2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd8:	85 c0                	test   %eax,%eax
+  801bda:	74 54                	je     801c30 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bdc:	83 ec 04             	sub    $0x4,%esp
+  801bdf:	ff 75 10             	push   0x10(%ebp)
+  801be2:	ff 75 0c             	push   0xc(%ebp)
+  801be5:	56                   	push   %esi
+  801be6:	ff d0                	call   *%eax
+  801be8:	83 c4 10             	add    $0x10,%esp
+}
+  801beb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bee:	5b                   	pop    %ebx
+  801bef:	5e                   	pop    %esi
+  801bf0:	5d                   	pop    %ebp
+  801bf1:	c3                   	ret
+  801bf2:	89 e2                	mov    %esp,%edx
+  801bf4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bf9:	29 d0                	sub    %edx,%eax
+  801bfb:	89 c2                	mov    %eax,%edx
+  801bfd:	c1 ea 0f             	shr    $0xf,%edx
+  801c00:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c0d:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801c14:	8b 40 48             	mov    0x48(%eax),%eax
+  801c17:	83 ec 04             	sub    $0x4,%esp
+  801c1a:	53                   	push   %ebx
+  801c1b:	50                   	push   %eax
+  801c1c:	68 ed 46 80 00       	push   $0x8046ed
+  801c21:	e8 b9 e8 ff ff       	call   8004df <cprintf>
+		return -E_INVAL;
+  801c26:	83 c4 10             	add    $0x10,%esp
+  801c29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c2e:	eb bb                	jmp    801beb <write+0x53>
+		return -E_NOT_SUPP;
+  801c30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c35:	eb b4                	jmp    801beb <write+0x53>
+
+00801c37 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c40:	50                   	push   %eax
+  801c41:	ff 75 08             	push   0x8(%ebp)
+  801c44:	e8 d3 fb ff ff       	call   80181c <fd_lookup>
+  801c49:	83 c4 10             	add    $0x10,%esp
+  801c4c:	85 c0                	test   %eax,%eax
+  801c4e:	78 0e                	js     801c5e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c56:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5e:	c9                   	leave
+  801c5f:	c3                   	ret
+
+00801c60 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801c60:	55                   	push   %ebp
+  801c61:	89 e5                	mov    %esp,%ebp
+  801c63:	53                   	push   %ebx
+  801c64:	83 ec 1c             	sub    $0x1c,%esp
+  801c67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6d:	50                   	push   %eax
+  801c6e:	ff 75 08             	push   0x8(%ebp)
+  801c71:	e8 a6 fb ff ff       	call   80181c <fd_lookup>
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 33                	js     801cb0 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801c7d:	83 fb 03             	cmp    $0x3,%ebx
+  801c80:	74 28                	je     801caa <fcntl+0x4a>
+  801c82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c87:	83 fb 04             	cmp    $0x4,%ebx
+  801c8a:	75 24                	jne    801cb0 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801c8c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801c8f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c92:	80 e4 ef             	and    $0xef,%ah
+  801c95:	8b 55 10             	mov    0x10(%ebp),%edx
+  801c98:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801c9e:	09 d0                	or     %edx,%eax
+  801ca0:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca8:	eb 06                	jmp    801cb0 <fcntl+0x50>
+		return fd->fd_omode;
+  801caa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cad:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801cb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb3:	c9                   	leave
+  801cb4:	c3                   	ret
+
+00801cb5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	56                   	push   %esi
+  801cb9:	53                   	push   %ebx
+  801cba:	83 ec 18             	sub    $0x18,%esp
+  801cbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cc0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cc3:	50                   	push   %eax
+  801cc4:	53                   	push   %ebx
+  801cc5:	e8 52 fb ff ff       	call   80181c <fd_lookup>
+  801cca:	83 c4 10             	add    $0x10,%esp
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	78 34                	js     801d05 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cd1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cd4:	83 ec 08             	sub    $0x8,%esp
+  801cd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cda:	50                   	push   %eax
+  801cdb:	ff 36                	push   (%esi)
+  801cdd:	e8 8c fb ff ff       	call   80186e <dev_lookup>
+  801ce2:	83 c4 10             	add    $0x10,%esp
+  801ce5:	85 c0                	test   %eax,%eax
+  801ce7:	78 1c                	js     801d05 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ce9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ced:	74 1d                	je     801d0c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801cef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf2:	8b 40 18             	mov    0x18(%eax),%eax
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	74 51                	je     801d4a <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cf9:	83 ec 08             	sub    $0x8,%esp
+  801cfc:	ff 75 0c             	push   0xc(%ebp)
+  801cff:	56                   	push   %esi
+  801d00:	ff d0                	call   *%eax
+  801d02:	83 c4 10             	add    $0x10,%esp
+}
+  801d05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d08:	5b                   	pop    %ebx
+  801d09:	5e                   	pop    %esi
+  801d0a:	5d                   	pop    %ebp
+  801d0b:	c3                   	ret
+  801d0c:	89 e2                	mov    %esp,%edx
+  801d0e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d13:	29 d0                	sub    %edx,%eax
+  801d15:	89 c2                	mov    %eax,%edx
+  801d17:	c1 ea 0f             	shr    $0xf,%edx
+  801d1a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d24:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801d27:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801d2e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d31:	83 ec 04             	sub    $0x4,%esp
+  801d34:	53                   	push   %ebx
+  801d35:	50                   	push   %eax
+  801d36:	68 b0 46 80 00       	push   $0x8046b0
+  801d3b:	e8 9f e7 ff ff       	call   8004df <cprintf>
+		return -E_INVAL;
+  801d40:	83 c4 10             	add    $0x10,%esp
+  801d43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d48:	eb bb                	jmp    801d05 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d4a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d4f:	eb b4                	jmp    801d05 <ftruncate+0x50>
+
+00801d51 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	56                   	push   %esi
+  801d55:	53                   	push   %ebx
+  801d56:	83 ec 18             	sub    $0x18,%esp
+  801d59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d5c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d5f:	50                   	push   %eax
+  801d60:	ff 75 08             	push   0x8(%ebp)
+  801d63:	e8 b4 fa ff ff       	call   80181c <fd_lookup>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	78 53                	js     801dc2 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d6f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d72:	83 ec 08             	sub    $0x8,%esp
+  801d75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d78:	50                   	push   %eax
+  801d79:	ff 36                	push   (%esi)
+  801d7b:	e8 ee fa ff ff       	call   80186e <dev_lookup>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 3b                	js     801dc2 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801d87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d8e:	74 39                	je     801dc9 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d90:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d93:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d9a:	00 00 00 
+	stat->st_isdir = 0;
+  801d9d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801da4:	00 00 00 
+	stat->st_version = 0;
+  801da7:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801dae:	00 00 00 
+	stat->st_dev = dev;
+  801db1:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801db7:	83 ec 08             	sub    $0x8,%esp
+  801dba:	53                   	push   %ebx
+  801dbb:	56                   	push   %esi
+  801dbc:	ff 50 14             	call   *0x14(%eax)
+  801dbf:	83 c4 10             	add    $0x10,%esp
+}
+  801dc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc5:	5b                   	pop    %ebx
+  801dc6:	5e                   	pop    %esi
+  801dc7:	5d                   	pop    %ebp
+  801dc8:	c3                   	ret
+		return -E_NOT_SUPP;
+  801dc9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dce:	eb f2                	jmp    801dc2 <fstat+0x71>
+
+00801dd0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	56                   	push   %esi
+  801dd4:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801dd5:	83 ec 08             	sub    $0x8,%esp
+  801dd8:	6a 00                	push   $0x0
+  801dda:	ff 75 08             	push   0x8(%ebp)
+  801ddd:	e8 b7 01 00 00       	call   801f99 <open>
+  801de2:	89 c3                	mov    %eax,%ebx
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 1b                	js     801e06 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801deb:	83 ec 08             	sub    $0x8,%esp
+  801dee:	ff 75 0c             	push   0xc(%ebp)
+  801df1:	50                   	push   %eax
+  801df2:	e8 5a ff ff ff       	call   801d51 <fstat>
+  801df7:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801df9:	89 1c 24             	mov    %ebx,(%esp)
+  801dfc:	e8 60 fb ff ff       	call   801961 <close>
+	return r;
+  801e01:	83 c4 10             	add    $0x10,%esp
+  801e04:	89 f3                	mov    %esi,%ebx
+}
+  801e06:	89 d8                	mov    %ebx,%eax
+  801e08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e0b:	5b                   	pop    %ebx
+  801e0c:	5e                   	pop    %esi
+  801e0d:	5d                   	pop    %ebp
+  801e0e:	c3                   	ret
+
+00801e0f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e0f:	55                   	push   %ebp
+  801e10:	89 e5                	mov    %esp,%ebp
+  801e12:	56                   	push   %esi
+  801e13:	53                   	push   %ebx
+  801e14:	89 c6                	mov    %eax,%esi
+  801e16:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801e18:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801e1f:	74 27                	je     801e48 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e21:	6a 07                	push   $0x7
+  801e23:	68 00 70 80 00       	push   $0x807000
+  801e28:	56                   	push   %esi
+  801e29:	ff 35 00 60 80 00    	push   0x806000
+  801e2f:	e8 c9 f8 ff ff       	call   8016fd <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e34:	83 c4 0c             	add    $0xc,%esp
+  801e37:	6a 00                	push   $0x0
+  801e39:	53                   	push   %ebx
+  801e3a:	6a 00                	push   $0x0
+  801e3c:	e8 2c f6 ff ff       	call   80146d <ipc_recv>
+}
+  801e41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e44:	5b                   	pop    %ebx
+  801e45:	5e                   	pop    %esi
+  801e46:	5d                   	pop    %ebp
+  801e47:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e48:	83 ec 0c             	sub    $0xc,%esp
+  801e4b:	6a 02                	push   $0x2
+  801e4d:	e8 14 f9 ff ff       	call   801766 <ipc_find_env>
+  801e52:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	eb c5                	jmp    801e21 <fsipc+0x12>
+
+00801e5c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e62:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e65:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e68:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801e6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e70:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e7f:	e8 8b ff ff ff       	call   801e0f <fsipc>
+}
+  801e84:	c9                   	leave
+  801e85:	c3                   	ret
+
+00801e86 <devfile_flush>:
+{
+  801e86:	55                   	push   %ebp
+  801e87:	89 e5                	mov    %esp,%ebp
+  801e89:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e8f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e92:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e9c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ea1:	e8 69 ff ff ff       	call   801e0f <fsipc>
+}
+  801ea6:	c9                   	leave
+  801ea7:	c3                   	ret
+
+00801ea8 <devfile_stat>:
+{
+  801ea8:	55                   	push   %ebp
+  801ea9:	89 e5                	mov    %esp,%ebp
+  801eab:	53                   	push   %ebx
+  801eac:	83 ec 04             	sub    $0x4,%esp
+  801eaf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eb8:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ebd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ec7:	e8 43 ff ff ff       	call   801e0f <fsipc>
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 37                	js     801f07 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	68 00 70 80 00       	push   $0x807000
+  801ed8:	53                   	push   %ebx
+  801ed9:	e8 f8 ec ff ff       	call   800bd6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ede:	a1 80 70 80 00       	mov    0x807080,%eax
+  801ee3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ee9:	a1 84 70 80 00       	mov    0x807084,%eax
+  801eee:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801ef4:	a1 88 70 80 00       	mov    0x807088,%eax
+  801ef9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f0a:	c9                   	leave
+  801f0b:	c3                   	ret
+
+00801f0c <devfile_write>:
+{
+  801f0c:	55                   	push   %ebp
+  801f0d:	89 e5                	mov    %esp,%ebp
+  801f0f:	83 ec 0c             	sub    $0xc,%esp
+  801f12:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801f15:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f1a:	39 d0                	cmp    %edx,%eax
+  801f1c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f22:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f25:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801f2b:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801f30:	50                   	push   %eax
+  801f31:	ff 75 0c             	push   0xc(%ebp)
+  801f34:	68 08 70 80 00       	push   $0x807008
+  801f39:	e8 48 ee ff ff       	call   800d86 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f43:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f48:	e8 c2 fe ff ff       	call   801e0f <fsipc>
+}
+  801f4d:	c9                   	leave
+  801f4e:	c3                   	ret
+
+00801f4f <devfile_read>:
+{
+  801f4f:	55                   	push   %ebp
+  801f50:	89 e5                	mov    %esp,%ebp
+  801f52:	53                   	push   %ebx
+  801f53:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f59:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f5c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801f61:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f64:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801f69:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801f6e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f73:	e8 97 fe ff ff       	call   801e0f <fsipc>
+  801f78:	89 c3                	mov    %eax,%ebx
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	78 14                	js     801f92 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801f7e:	83 ec 04             	sub    $0x4,%esp
+  801f81:	50                   	push   %eax
+  801f82:	68 00 70 80 00       	push   $0x807000
+  801f87:	ff 75 0c             	push   0xc(%ebp)
+  801f8a:	e8 f7 ed ff ff       	call   800d86 <memmove>
+	return r;
+  801f8f:	83 c4 10             	add    $0x10,%esp
+}
+  801f92:	89 d8                	mov    %ebx,%eax
+  801f94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f97:	c9                   	leave
+  801f98:	c3                   	ret
+
+00801f99 <open>:
+{
+  801f99:	55                   	push   %ebp
+  801f9a:	89 e5                	mov    %esp,%ebp
+  801f9c:	53                   	push   %ebx
+  801f9d:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801fa0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fa3:	50                   	push   %eax
+  801fa4:	e8 23 f8 ff ff       	call   8017cc <fd_alloc>
+  801fa9:	89 c3                	mov    %eax,%ebx
+  801fab:	83 c4 10             	add    $0x10,%esp
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	78 2a                	js     801fdc <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801fb2:	83 ec 0c             	sub    $0xc,%esp
+  801fb5:	ff 75 08             	push   0x8(%ebp)
+  801fb8:	e8 cd eb ff ff       	call   800b8a <strlen>
+  801fbd:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801fc0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801fc5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801fca:	7e 17                	jle    801fe3 <open+0x4a>
+	fd_close(fd, 1);
+  801fcc:	83 ec 08             	sub    $0x8,%esp
+  801fcf:	6a 01                	push   $0x1
+  801fd1:	ff 75 f4             	push   -0xc(%ebp)
+  801fd4:	e8 08 f9 ff ff       	call   8018e1 <fd_close>
+	return r;
+  801fd9:	83 c4 10             	add    $0x10,%esp
+}
+  801fdc:	89 d8                	mov    %ebx,%eax
+  801fde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe1:	c9                   	leave
+  801fe2:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801fe3:	83 ec 08             	sub    $0x8,%esp
+  801fe6:	ff 75 08             	push   0x8(%ebp)
+  801fe9:	68 00 70 80 00       	push   $0x807000
+  801fee:	e8 e3 eb ff ff       	call   800bd6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ff3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff6:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801ffb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ffe:	b8 01 00 00 00       	mov    $0x1,%eax
+  802003:	e8 07 fe ff ff       	call   801e0f <fsipc>
+  802008:	89 c3                	mov    %eax,%ebx
+  80200a:	83 c4 10             	add    $0x10,%esp
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	78 bb                	js     801fcc <open+0x33>
+	return fd2num(fd); 	
+  802011:	83 ec 0c             	sub    $0xc,%esp
+  802014:	ff 75 f4             	push   -0xc(%ebp)
+  802017:	e8 89 f7 ff ff       	call   8017a5 <fd2num>
+  80201c:	89 c3                	mov    %eax,%ebx
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	eb b9                	jmp    801fdc <open+0x43>
+
+00802023 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802023:	55                   	push   %ebp
+  802024:	89 e5                	mov    %esp,%ebp
+  802026:	53                   	push   %ebx
+  802027:	83 ec 1c             	sub    $0x1c,%esp
+  80202a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80202d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802030:	50                   	push   %eax
+  802031:	ff 75 08             	push   0x8(%ebp)
+  802034:	e8 e3 f7 ff ff       	call   80181c <fd_lookup>
+  802039:	83 c4 10             	add    $0x10,%esp
+  80203c:	85 c0                	test   %eax,%eax
+  80203e:	78 5a                	js     80209a <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802040:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802043:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802049:	39 10                	cmp    %edx,(%eax)
+  80204b:	75 66                	jne    8020b3 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  80204d:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  802054:	74 49                	je     80209f <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802056:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802059:	8b 40 0c             	mov    0xc(%eax),%eax
+  80205c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802061:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802064:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802069:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80206f:	6a 07                	push   $0x7
+  802071:	68 00 70 80 00       	push   $0x807000
+  802076:	6a 09                	push   $0x9
+  802078:	ff 35 00 60 80 00    	push   0x806000
+  80207e:	e8 7a f6 ff ff       	call   8016fd <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802083:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80208a:	6a 00                	push   $0x0
+  80208c:	53                   	push   %ebx
+  80208d:	ff 75 10             	push   0x10(%ebp)
+  802090:	6a 00                	push   $0x0
+  802092:	e8 a3 f4 ff ff       	call   80153a <ipc_recv_pages>
+  802097:	83 c4 20             	add    $0x20,%esp
+}
+  80209a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209d:	c9                   	leave
+  80209e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80209f:	83 ec 0c             	sub    $0xc,%esp
+  8020a2:	6a 02                	push   $0x2
+  8020a4:	e8 bd f6 ff ff       	call   801766 <ipc_find_env>
+  8020a9:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020ae:	83 c4 10             	add    $0x10,%esp
+  8020b1:	eb a3                	jmp    802056 <fmap+0x33>
+		return -E_INVAL;
+  8020b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b8:	eb e0                	jmp    80209a <fmap+0x77>
+
+008020ba <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8020ba:	55                   	push   %ebp
+  8020bb:	89 e5                	mov    %esp,%ebp
+  8020bd:	53                   	push   %ebx
+  8020be:	83 ec 10             	sub    $0x10,%esp
+  8020c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8020c4:	53                   	push   %ebx
+  8020c5:	e8 c0 ea ff ff       	call   800b8a <strlen>
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020d2:	7f 25                	jg     8020f9 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8020d4:	83 ec 08             	sub    $0x8,%esp
+  8020d7:	53                   	push   %ebx
+  8020d8:	68 00 70 80 00       	push   $0x807000
+  8020dd:	e8 f4 ea ff ff       	call   800bd6 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8020e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020ec:	e8 1e fd ff ff       	call   801e0f <fsipc>
+  8020f1:	83 c4 10             	add    $0x10,%esp
+}
+  8020f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+		return -E_BAD_PATH;
+  8020f9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020fe:	eb f4                	jmp    8020f4 <remove+0x3a>
+
+00802100 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802106:	ba 00 00 00 00       	mov    $0x0,%edx
+  80210b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802110:	e8 fa fc ff ff       	call   801e0f <fsipc>
+}
+  802115:	c9                   	leave
+  802116:	c3                   	ret
+
+00802117 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802117:	55                   	push   %ebp
+  802118:	89 e5                	mov    %esp,%ebp
+  80211a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80211d:	68 20 47 80 00       	push   $0x804720
+  802122:	ff 75 0c             	push   0xc(%ebp)
+  802125:	e8 ac ea ff ff       	call   800bd6 <strcpy>
+	return 0;
+}
+  80212a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212f:	c9                   	leave
+  802130:	c3                   	ret
+
+00802131 <devsock_close>:
+{
+  802131:	55                   	push   %ebp
+  802132:	89 e5                	mov    %esp,%ebp
+  802134:	53                   	push   %ebx
+  802135:	83 ec 10             	sub    $0x10,%esp
+  802138:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80213b:	53                   	push   %ebx
+  80213c:	e8 82 1a 00 00       	call   803bc3 <pageref>
+  802141:	89 c2                	mov    %eax,%edx
+  802143:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802146:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80214b:	83 fa 01             	cmp    $0x1,%edx
+  80214e:	74 05                	je     802155 <devsock_close+0x24>
+}
+  802150:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802155:	83 ec 0c             	sub    $0xc,%esp
+  802158:	ff 73 0c             	push   0xc(%ebx)
+  80215b:	e8 b0 05 00 00       	call   802710 <nsipc_close>
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	eb eb                	jmp    802150 <devsock_close+0x1f>
+
+00802165 <devsock_write>:
+{
+  802165:	55                   	push   %ebp
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	53                   	push   %ebx
+  802169:	83 ec 14             	sub    $0x14,%esp
+  80216c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80216f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802172:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802175:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802178:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80217b:	8b 41 08             	mov    0x8(%ecx),%eax
+  80217e:	c1 f8 09             	sar    $0x9,%eax
+  802181:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802184:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80218a:	77 13                	ja     80219f <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  80218c:	50                   	push   %eax
+  80218d:	52                   	push   %edx
+  80218e:	53                   	push   %ebx
+  80218f:	ff 71 0c             	push   0xc(%ecx)
+  802192:	e8 5c 06 00 00       	call   8027f3 <nsipc_send>
+  802197:	83 c4 10             	add    $0x10,%esp
+}
+  80219a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219d:	c9                   	leave
+  80219e:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80219f:	50                   	push   %eax
+  8021a0:	6a 01                	push   $0x1
+  8021a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021a5:	50                   	push   %eax
+  8021a6:	ff 71 0c             	push   0xc(%ecx)
+  8021a9:	e8 a6 06 00 00       	call   802854 <nsipc_sendmsg>
+  8021ae:	83 c4 10             	add    $0x10,%esp
+  8021b1:	eb e7                	jmp    80219a <devsock_write+0x35>
+
+008021b3 <devsock_read>:
+{
+  8021b3:	55                   	push   %ebp
+  8021b4:	89 e5                	mov    %esp,%ebp
+  8021b6:	53                   	push   %ebx
+  8021b7:	83 ec 14             	sub    $0x14,%esp
+  8021ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021c0:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8021c3:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8021c6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8021c9:	8b 41 08             	mov    0x8(%ecx),%eax
+  8021cc:	c1 f8 09             	sar    $0x9,%eax
+  8021cf:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8021d2:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8021d8:	77 13                	ja     8021ed <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8021da:	50                   	push   %eax
+  8021db:	52                   	push   %edx
+  8021dc:	53                   	push   %ebx
+  8021dd:	ff 71 0c             	push   0xc(%ecx)
+  8021e0:	e8 9c 05 00 00       	call   802781 <nsipc_recv>
+  8021e5:	83 c4 10             	add    $0x10,%esp
+}
+  8021e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021eb:	c9                   	leave
+  8021ec:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8021ed:	50                   	push   %eax
+  8021ee:	6a 01                	push   $0x1
+  8021f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021f3:	50                   	push   %eax
+  8021f4:	ff 71 0c             	push   0xc(%ecx)
+  8021f7:	e8 02 0a 00 00       	call   802bfe <nsipc_recvmsg>
+  8021fc:	83 c4 10             	add    $0x10,%esp
+  8021ff:	eb e7                	jmp    8021e8 <devsock_read+0x35>
+
+00802201 <fd2sockid>:
+{
+  802201:	55                   	push   %ebp
+  802202:	89 e5                	mov    %esp,%ebp
+  802204:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802207:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80220a:	52                   	push   %edx
+  80220b:	50                   	push   %eax
+  80220c:	e8 0b f6 ff ff       	call   80181c <fd_lookup>
+  802211:	83 c4 10             	add    $0x10,%esp
+  802214:	85 c0                	test   %eax,%eax
+  802216:	78 10                	js     802228 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802218:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80221b:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802221:	39 08                	cmp    %ecx,(%eax)
+  802223:	75 05                	jne    80222a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802225:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802228:	c9                   	leave
+  802229:	c3                   	ret
+		return -E_NOT_SUPP;
+  80222a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80222f:	eb f7                	jmp    802228 <fd2sockid+0x27>
+
+00802231 <sock_flags>:
+{
+  802231:	55                   	push   %ebp
+  802232:	89 e5                	mov    %esp,%ebp
+  802234:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802237:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80223a:	52                   	push   %edx
+  80223b:	50                   	push   %eax
+  80223c:	e8 db f5 ff ff       	call   80181c <fd_lookup>
+  802241:	83 c4 10             	add    $0x10,%esp
+  802244:	85 c0                	test   %eax,%eax
+  802246:	78 0e                	js     802256 <sock_flags+0x25>
+  802248:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224b:	8b 40 08             	mov    0x8(%eax),%eax
+  80224e:	c1 e8 09             	shr    $0x9,%eax
+  802251:	83 e0 08             	and    $0x8,%eax
+}
+  802254:	c9                   	leave
+  802255:	c3                   	ret
+		return 0;
+  802256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225b:	eb f7                	jmp    802254 <sock_flags+0x23>
+
+0080225d <alloc_sockfd>:
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	56                   	push   %esi
+  802261:	53                   	push   %ebx
+  802262:	83 ec 1c             	sub    $0x1c,%esp
+  802265:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802267:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80226a:	50                   	push   %eax
+  80226b:	e8 5c f5 ff ff       	call   8017cc <fd_alloc>
+  802270:	89 c3                	mov    %eax,%ebx
+  802272:	83 c4 10             	add    $0x10,%esp
+  802275:	85 c0                	test   %eax,%eax
+  802277:	78 43                	js     8022bc <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802279:	83 ec 04             	sub    $0x4,%esp
+  80227c:	68 07 04 00 00       	push   $0x407
+  802281:	ff 75 f4             	push   -0xc(%ebp)
+  802284:	6a 00                	push   $0x0
+  802286:	e8 7f ed ff ff       	call   80100a <sys_page_alloc>
+  80228b:	89 c3                	mov    %eax,%ebx
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	85 c0                	test   %eax,%eax
+  802292:	78 28                	js     8022bc <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802294:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802297:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  80229d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80229f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8022a9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8022ac:	83 ec 0c             	sub    $0xc,%esp
+  8022af:	50                   	push   %eax
+  8022b0:	e8 f0 f4 ff ff       	call   8017a5 <fd2num>
+  8022b5:	89 c3                	mov    %eax,%ebx
+  8022b7:	83 c4 10             	add    $0x10,%esp
+  8022ba:	eb 0c                	jmp    8022c8 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8022bc:	83 ec 0c             	sub    $0xc,%esp
+  8022bf:	56                   	push   %esi
+  8022c0:	e8 4b 04 00 00       	call   802710 <nsipc_close>
+		return r;
+  8022c5:	83 c4 10             	add    $0x10,%esp
+}
+  8022c8:	89 d8                	mov    %ebx,%eax
+  8022ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022cd:	5b                   	pop    %ebx
+  8022ce:	5e                   	pop    %esi
+  8022cf:	5d                   	pop    %ebp
+  8022d0:	c3                   	ret
+
+008022d1 <accept>:
+{
+  8022d1:	55                   	push   %ebp
+  8022d2:	89 e5                	mov    %esp,%ebp
+  8022d4:	56                   	push   %esi
+  8022d5:	53                   	push   %ebx
+  8022d6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8022d9:	89 f0                	mov    %esi,%eax
+  8022db:	e8 21 ff ff ff       	call   802201 <fd2sockid>
+  8022e0:	89 c3                	mov    %eax,%ebx
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	78 24                	js     80230a <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8022e6:	89 f0                	mov    %esi,%eax
+  8022e8:	e8 44 ff ff ff       	call   802231 <sock_flags>
+  8022ed:	50                   	push   %eax
+  8022ee:	ff 75 10             	push   0x10(%ebp)
+  8022f1:	ff 75 0c             	push   0xc(%ebp)
+  8022f4:	53                   	push   %ebx
+  8022f5:	e8 6b 03 00 00       	call   802665 <nsipc_accept>
+  8022fa:	89 c3                	mov    %eax,%ebx
+  8022fc:	83 c4 10             	add    $0x10,%esp
+  8022ff:	85 c0                	test   %eax,%eax
+  802301:	78 07                	js     80230a <accept+0x39>
+	return alloc_sockfd(r);
+  802303:	e8 55 ff ff ff       	call   80225d <alloc_sockfd>
+  802308:	89 c3                	mov    %eax,%ebx
+}
+  80230a:	89 d8                	mov    %ebx,%eax
+  80230c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80230f:	5b                   	pop    %ebx
+  802310:	5e                   	pop    %esi
+  802311:	5d                   	pop    %ebp
+  802312:	c3                   	ret
+
+00802313 <bind>:
+{
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231c:	e8 e0 fe ff ff       	call   802201 <fd2sockid>
+  802321:	85 c0                	test   %eax,%eax
+  802323:	78 12                	js     802337 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802325:	83 ec 04             	sub    $0x4,%esp
+  802328:	ff 75 10             	push   0x10(%ebp)
+  80232b:	ff 75 0c             	push   0xc(%ebp)
+  80232e:	50                   	push   %eax
+  80232f:	e8 85 03 00 00       	call   8026b9 <nsipc_bind>
+  802334:	83 c4 10             	add    $0x10,%esp
+}
+  802337:	c9                   	leave
+  802338:	c3                   	ret
+
+00802339 <shutdown>:
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80233f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802342:	e8 ba fe ff ff       	call   802201 <fd2sockid>
+  802347:	85 c0                	test   %eax,%eax
+  802349:	78 0f                	js     80235a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80234b:	83 ec 08             	sub    $0x8,%esp
+  80234e:	ff 75 0c             	push   0xc(%ebp)
+  802351:	50                   	push   %eax
+  802352:	e8 97 03 00 00       	call   8026ee <nsipc_shutdown>
+  802357:	83 c4 10             	add    $0x10,%esp
+}
+  80235a:	c9                   	leave
+  80235b:	c3                   	ret
+
+0080235c <connect>:
+{
+  80235c:	55                   	push   %ebp
+  80235d:	89 e5                	mov    %esp,%ebp
+  80235f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802362:	8b 45 08             	mov    0x8(%ebp),%eax
+  802365:	e8 97 fe ff ff       	call   802201 <fd2sockid>
+  80236a:	85 c0                	test   %eax,%eax
+  80236c:	78 12                	js     802380 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80236e:	83 ec 04             	sub    $0x4,%esp
+  802371:	ff 75 10             	push   0x10(%ebp)
+  802374:	ff 75 0c             	push   0xc(%ebp)
+  802377:	50                   	push   %eax
+  802378:	e8 ad 03 00 00       	call   80272a <nsipc_connect>
+  80237d:	83 c4 10             	add    $0x10,%esp
+}
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+
+00802382 <listen>:
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802388:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238b:	e8 71 fe ff ff       	call   802201 <fd2sockid>
+  802390:	85 c0                	test   %eax,%eax
+  802392:	78 0f                	js     8023a3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802394:	83 ec 08             	sub    $0x8,%esp
+  802397:	ff 75 0c             	push   0xc(%ebp)
+  80239a:	50                   	push   %eax
+  80239b:	e8 bf 03 00 00       	call   80275f <nsipc_listen>
+  8023a0:	83 c4 10             	add    $0x10,%esp
+}
+  8023a3:	c9                   	leave
+  8023a4:	c3                   	ret
+
+008023a5 <sendmsg>:
+{
+  8023a5:	55                   	push   %ebp
+  8023a6:	89 e5                	mov    %esp,%ebp
+  8023a8:	57                   	push   %edi
+  8023a9:	56                   	push   %esi
+  8023aa:	53                   	push   %ebx
+  8023ab:	83 ec 0c             	sub    $0xc,%esp
+  8023ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8023b4:	89 f0                	mov    %esi,%eax
+  8023b6:	e8 46 fe ff ff       	call   802201 <fd2sockid>
+  8023bb:	89 c3                	mov    %eax,%ebx
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	78 1c                	js     8023dd <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8023c1:	89 f0                	mov    %esi,%eax
+  8023c3:	e8 69 fe ff ff       	call   802231 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8023c8:	0b 45 10             	or     0x10(%ebp),%eax
+  8023cb:	50                   	push   %eax
+  8023cc:	ff 77 0c             	push   0xc(%edi)
+  8023cf:	ff 77 08             	push   0x8(%edi)
+  8023d2:	53                   	push   %ebx
+  8023d3:	e8 7c 04 00 00       	call   802854 <nsipc_sendmsg>
+  8023d8:	89 c3                	mov    %eax,%ebx
+  8023da:	83 c4 10             	add    $0x10,%esp
+}
+  8023dd:	89 d8                	mov    %ebx,%eax
+  8023df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e2:	5b                   	pop    %ebx
+  8023e3:	5e                   	pop    %esi
+  8023e4:	5f                   	pop    %edi
+  8023e5:	5d                   	pop    %ebp
+  8023e6:	c3                   	ret
+
+008023e7 <recvmsg>:
+{
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	57                   	push   %edi
+  8023eb:	56                   	push   %esi
+  8023ec:	53                   	push   %ebx
+  8023ed:	83 ec 0c             	sub    $0xc,%esp
+  8023f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8023f6:	89 f8                	mov    %edi,%eax
+  8023f8:	e8 04 fe ff ff       	call   802201 <fd2sockid>
+  8023fd:	89 c3                	mov    %eax,%ebx
+  8023ff:	85 c0                	test   %eax,%eax
+  802401:	78 2a                	js     80242d <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802403:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80240a:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802411:	89 f8                	mov    %edi,%eax
+  802413:	e8 19 fe ff ff       	call   802231 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802418:	0b 45 10             	or     0x10(%ebp),%eax
+  80241b:	50                   	push   %eax
+  80241c:	ff 76 0c             	push   0xc(%esi)
+  80241f:	ff 76 08             	push   0x8(%esi)
+  802422:	53                   	push   %ebx
+  802423:	e8 d6 07 00 00       	call   802bfe <nsipc_recvmsg>
+  802428:	89 c3                	mov    %eax,%ebx
+  80242a:	83 c4 10             	add    $0x10,%esp
+}
+  80242d:	89 d8                	mov    %ebx,%eax
+  80242f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802432:	5b                   	pop    %ebx
+  802433:	5e                   	pop    %esi
+  802434:	5f                   	pop    %edi
+  802435:	5d                   	pop    %ebp
+  802436:	c3                   	ret
+
+00802437 <sendfile>:
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	56                   	push   %esi
+  80243b:	53                   	push   %ebx
+  80243c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80243f:	89 f0                	mov    %esi,%eax
+  802441:	e8 bb fd ff ff       	call   802201 <fd2sockid>
+  802446:	89 c3                	mov    %eax,%ebx
+  802448:	85 c0                	test   %eax,%eax
+  80244a:	78 1f                	js     80246b <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80244c:	89 f0                	mov    %esi,%eax
+  80244e:	e8 de fd ff ff       	call   802231 <sock_flags>
+  802453:	83 ec 0c             	sub    $0xc,%esp
+  802456:	50                   	push   %eax
+  802457:	ff 75 14             	push   0x14(%ebp)
+  80245a:	ff 75 10             	push   0x10(%ebp)
+  80245d:	ff 75 0c             	push   0xc(%ebp)
+  802460:	53                   	push   %ebx
+  802461:	e8 64 06 00 00       	call   802aca <nsipc_sendfile>
+  802466:	89 c3                	mov    %eax,%ebx
+  802468:	83 c4 20             	add    $0x20,%esp
+}
+  80246b:	89 d8                	mov    %ebx,%eax
+  80246d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802470:	5b                   	pop    %ebx
+  802471:	5e                   	pop    %esi
+  802472:	5d                   	pop    %ebp
+  802473:	c3                   	ret
+
+00802474 <evctl>:
+{
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	53                   	push   %ebx
+  802478:	83 ec 04             	sub    $0x4,%esp
+  80247b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80247e:	89 d8                	mov    %ebx,%eax
+  802480:	e8 7c fd ff ff       	call   802201 <fd2sockid>
+  802485:	85 c0                	test   %eax,%eax
+  802487:	78 10                	js     802499 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802489:	83 ec 04             	sub    $0x4,%esp
+  80248c:	53                   	push   %ebx
+  80248d:	ff 75 0c             	push   0xc(%ebp)
+  802490:	50                   	push   %eax
+  802491:	e8 d2 0b 00 00       	call   803068 <nsipc_evctl>
+  802496:	83 c4 10             	add    $0x10,%esp
+}
+  802499:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80249c:	c9                   	leave
+  80249d:	c3                   	ret
+
+0080249e <evwait>:
+{
+  80249e:	55                   	push   %ebp
+  80249f:	89 e5                	mov    %esp,%ebp
+  8024a1:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8024a4:	ff 75 10             	push   0x10(%ebp)
+  8024a7:	ff 75 0c             	push   0xc(%ebp)
+  8024aa:	ff 75 08             	push   0x8(%ebp)
+  8024ad:	e8 e0 0b 00 00       	call   803092 <nsipc_evwait>
+}
+  8024b2:	c9                   	leave
+  8024b3:	c3                   	ret
+
+008024b4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8024b4:	55                   	push   %ebp
+  8024b5:	89 e5                	mov    %esp,%ebp
+  8024b7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8024ba:	ff 75 10             	push   0x10(%ebp)
+  8024bd:	ff 75 0c             	push   0xc(%ebp)
+  8024c0:	ff 75 08             	push   0x8(%ebp)
+  8024c3:	e8 31 0c 00 00       	call   8030f9 <nsipc_socket>
+  8024c8:	83 c4 10             	add    $0x10,%esp
+  8024cb:	85 c0                	test   %eax,%eax
+  8024cd:	78 05                	js     8024d4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8024cf:	e8 89 fd ff ff       	call   80225d <alloc_sockfd>
+}
+  8024d4:	c9                   	leave
+  8024d5:	c3                   	ret
+
+008024d6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8024d6:	55                   	push   %ebp
+  8024d7:	89 e5                	mov    %esp,%ebp
+  8024d9:	53                   	push   %ebx
+  8024da:	83 ec 04             	sub    $0x4,%esp
+  8024dd:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8024df:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8024e6:	74 26                	je     80250e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8024e8:	6a 07                	push   $0x7
+  8024ea:	68 00 80 80 00       	push   $0x808000
+  8024ef:	53                   	push   %ebx
+  8024f0:	ff 35 24 63 80 00    	push   0x806324
+  8024f6:	e8 02 f2 ff ff       	call   8016fd <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8024fb:	83 c4 0c             	add    $0xc,%esp
+  8024fe:	6a 00                	push   $0x0
+  802500:	6a 00                	push   $0x0
+  802502:	6a 00                	push   $0x0
+  802504:	e8 64 ef ff ff       	call   80146d <ipc_recv>
+}
+  802509:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80250e:	83 ec 0c             	sub    $0xc,%esp
+  802511:	6a 03                	push   $0x3
+  802513:	e8 4e f2 ff ff       	call   801766 <ipc_find_env>
+  802518:	a3 24 63 80 00       	mov    %eax,0x806324
+  80251d:	83 c4 10             	add    $0x10,%esp
+  802520:	eb c6                	jmp    8024e8 <nsipc+0x12>
+
+00802522 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802522:	55                   	push   %ebp
+  802523:	89 e5                	mov    %esp,%ebp
+  802525:	56                   	push   %esi
+  802526:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802527:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  80252d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802532:	85 f6                	test   %esi,%esi
+  802534:	75 33                	jne    802569 <nsbulk_map+0x47>
+  802536:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80253b:	83 ec 04             	sub    $0x4,%esp
+  80253e:	6a 07                	push   $0x7
+  802540:	53                   	push   %ebx
+  802541:	6a 00                	push   $0x0
+  802543:	e8 c2 ea ff ff       	call   80100a <sys_page_alloc>
+  802548:	83 c4 10             	add    $0x10,%esp
+  80254b:	85 c0                	test   %eax,%eax
+  80254d:	78 1a                	js     802569 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80254f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802555:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80255b:	75 de                	jne    80253b <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  80255d:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  802564:	00 00 00 
+	return 0;
+  802567:	89 f0                	mov    %esi,%eax
+}
+  802569:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80256c:	5b                   	pop    %ebx
+  80256d:	5e                   	pop    %esi
+  80256e:	5d                   	pop    %ebp
+  80256f:	c3                   	ret
+
+00802570 <nsbulk_own>:
+{
+  802570:	55                   	push   %ebp
+  802571:	89 e5                	mov    %esp,%ebp
+  802573:	57                   	push   %edi
+  802574:	56                   	push   %esi
+  802575:	53                   	push   %ebx
+  802576:	83 ec 0c             	sub    $0xc,%esp
+  802579:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80257b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80257e:	85 d2                	test   %edx,%edx
+  802580:	7f 0e                	jg     802590 <nsbulk_own+0x20>
+	return 0;
+  802582:	b8 00 00 00 00       	mov    $0x0,%eax
+  802587:	eb 47                	jmp    8025d0 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802589:	83 c3 01             	add    $0x1,%ebx
+  80258c:	39 fb                	cmp    %edi,%ebx
+  80258e:	7d 3b                	jge    8025cb <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802590:	be 01 00 00 00       	mov    $0x1,%esi
+  802595:	89 d9                	mov    %ebx,%ecx
+  802597:	d3 e6                	shl    %cl,%esi
+  802599:	89 f0                	mov    %esi,%eax
+  80259b:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  8025a1:	74 e6                	je     802589 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8025a3:	83 ec 04             	sub    $0x4,%esp
+  8025a6:	6a 07                	push   $0x7
+  8025a8:	89 d8                	mov    %ebx,%eax
+  8025aa:	c1 e0 0c             	shl    $0xc,%eax
+  8025ad:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8025b2:	50                   	push   %eax
+  8025b3:	6a 00                	push   $0x0
+  8025b5:	e8 50 ea ff ff       	call   80100a <sys_page_alloc>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+  8025bd:	85 c0                	test   %eax,%eax
+  8025bf:	78 0f                	js     8025d0 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8025c1:	f7 d6                	not    %esi
+  8025c3:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  8025c9:	eb be                	jmp    802589 <nsbulk_own+0x19>
+	return 0;
+  8025cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d3:	5b                   	pop    %ebx
+  8025d4:	5e                   	pop    %esi
+  8025d5:	5f                   	pop    %edi
+  8025d6:	5d                   	pop    %ebp
+  8025d7:	c3                   	ret
+
+008025d8 <nsipc_bulk>:
+{
+  8025d8:	55                   	push   %ebp
+  8025d9:	89 e5                	mov    %esp,%ebp
+  8025db:	57                   	push   %edi
+  8025dc:	56                   	push   %esi
+  8025dd:	53                   	push   %ebx
+  8025de:	83 ec 1c             	sub    $0x1c,%esp
+  8025e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025e4:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8025e6:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8025ec:	c1 fb 0c             	sar    $0xc,%ebx
+  8025ef:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8025f2:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8025f9:	74 56                	je     802651 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8025fb:	85 ff                	test   %edi,%edi
+  8025fd:	7e 24                	jle    802623 <nsipc_bulk+0x4b>
+  8025ff:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802605:	74 1c                	je     802623 <nsipc_bulk+0x4b>
+  802607:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80260d:	c1 e3 0c             	shl    $0xc,%ebx
+  802610:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802615:	0f b6 10             	movzbl (%eax),%edx
+  802618:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80261a:	05 00 10 00 00       	add    $0x1000,%eax
+  80261f:	39 d8                	cmp    %ebx,%eax
+  802621:	75 f2                	jne    802615 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802623:	83 ec 0c             	sub    $0xc,%esp
+  802626:	56                   	push   %esi
+  802627:	57                   	push   %edi
+  802628:	68 00 00 00 e0       	push   $0xe0000000
+  80262d:	ff 75 e4             	push   -0x1c(%ebp)
+  802630:	ff 35 24 63 80 00    	push   0x806324
+  802636:	e8 f6 f0 ff ff       	call   801731 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80263b:	83 c4 1c             	add    $0x1c,%esp
+  80263e:	6a 00                	push   $0x0
+  802640:	6a 00                	push   $0x0
+  802642:	6a 00                	push   $0x0
+  802644:	e8 24 ee ff ff       	call   80146d <ipc_recv>
+}
+  802649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264c:	5b                   	pop    %ebx
+  80264d:	5e                   	pop    %esi
+  80264e:	5f                   	pop    %edi
+  80264f:	5d                   	pop    %ebp
+  802650:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802651:	83 ec 0c             	sub    $0xc,%esp
+  802654:	6a 03                	push   $0x3
+  802656:	e8 0b f1 ff ff       	call   801766 <ipc_find_env>
+  80265b:	a3 24 63 80 00       	mov    %eax,0x806324
+  802660:	83 c4 10             	add    $0x10,%esp
+  802663:	eb 96                	jmp    8025fb <nsipc_bulk+0x23>
+
+00802665 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802665:	55                   	push   %ebp
+  802666:	89 e5                	mov    %esp,%ebp
+  802668:	53                   	push   %ebx
+  802669:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80266c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80266f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802674:	8b 45 14             	mov    0x14(%ebp),%eax
+  802677:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80267c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802681:	e8 50 fe ff ff       	call   8024d6 <nsipc>
+  802686:	89 c3                	mov    %eax,%ebx
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	79 07                	jns    802693 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80268c:	89 d8                	mov    %ebx,%eax
+  80268e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802693:	83 ec 04             	sub    $0x4,%esp
+  802696:	ff 35 10 80 80 00    	push   0x808010
+  80269c:	68 00 80 80 00       	push   $0x808000
+  8026a1:	ff 75 0c             	push   0xc(%ebp)
+  8026a4:	e8 dd e6 ff ff       	call   800d86 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8026a9:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8026af:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026b2:	89 10                	mov    %edx,(%eax)
+  8026b4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8026b7:	eb d3                	jmp    80268c <nsipc_accept+0x27>
+
+008026b9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8026b9:	55                   	push   %ebp
+  8026ba:	89 e5                	mov    %esp,%ebp
+  8026bc:	53                   	push   %ebx
+  8026bd:	83 ec 08             	sub    $0x8,%esp
+  8026c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8026c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c6:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8026cb:	53                   	push   %ebx
+  8026cc:	ff 75 0c             	push   0xc(%ebp)
+  8026cf:	68 04 80 80 00       	push   $0x808004
+  8026d4:	e8 ad e6 ff ff       	call   800d86 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8026d9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8026df:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026e4:	e8 ed fd ff ff       	call   8024d6 <nsipc>
+}
+  8026e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ec:	c9                   	leave
+  8026ed:	c3                   	ret
+
+008026ee <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8026ee:	55                   	push   %ebp
+  8026ef:	89 e5                	mov    %esp,%ebp
+  8026f1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8026f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8026fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026ff:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802704:	b8 03 00 00 00       	mov    $0x3,%eax
+  802709:	e8 c8 fd ff ff       	call   8024d6 <nsipc>
+}
+  80270e:	c9                   	leave
+  80270f:	c3                   	ret
+
+00802710 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802716:	8b 45 08             	mov    0x8(%ebp),%eax
+  802719:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80271e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802723:	e8 ae fd ff ff       	call   8024d6 <nsipc>
+}
+  802728:	c9                   	leave
+  802729:	c3                   	ret
+
+0080272a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	53                   	push   %ebx
+  80272e:	83 ec 08             	sub    $0x8,%esp
+  802731:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802734:	8b 45 08             	mov    0x8(%ebp),%eax
+  802737:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80273c:	53                   	push   %ebx
+  80273d:	ff 75 0c             	push   0xc(%ebp)
+  802740:	68 04 80 80 00       	push   $0x808004
+  802745:	e8 3c e6 ff ff       	call   800d86 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80274a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802750:	b8 05 00 00 00       	mov    $0x5,%eax
+  802755:	e8 7c fd ff ff       	call   8024d6 <nsipc>
+}
+  80275a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80275d:	c9                   	leave
+  80275e:	c3                   	ret
+
+0080275f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80275f:	55                   	push   %ebp
+  802760:	89 e5                	mov    %esp,%ebp
+  802762:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802765:	8b 45 08             	mov    0x8(%ebp),%eax
+  802768:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80276d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802770:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802775:	b8 06 00 00 00       	mov    $0x6,%eax
+  80277a:	e8 57 fd ff ff       	call   8024d6 <nsipc>
+}
+  80277f:	c9                   	leave
+  802780:	c3                   	ret
+
+00802781 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802781:	55                   	push   %ebp
+  802782:	89 e5                	mov    %esp,%ebp
+  802784:	56                   	push   %esi
+  802785:	53                   	push   %ebx
+  802786:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802789:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802791:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80279a:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80279f:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027a4:	e8 2d fd ff ff       	call   8024d6 <nsipc>
+  8027a9:	89 c3                	mov    %eax,%ebx
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	78 22                	js     8027d1 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8027af:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8027b4:	39 c6                	cmp    %eax,%esi
+  8027b6:	0f 4e c6             	cmovle %esi,%eax
+  8027b9:	39 c3                	cmp    %eax,%ebx
+  8027bb:	7f 1d                	jg     8027da <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8027bd:	83 ec 04             	sub    $0x4,%esp
+  8027c0:	53                   	push   %ebx
+  8027c1:	68 00 80 80 00       	push   $0x808000
+  8027c6:	ff 75 0c             	push   0xc(%ebp)
+  8027c9:	e8 b8 e5 ff ff       	call   800d86 <memmove>
+  8027ce:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8027d1:	89 d8                	mov    %ebx,%eax
+  8027d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027d6:	5b                   	pop    %ebx
+  8027d7:	5e                   	pop    %esi
+  8027d8:	5d                   	pop    %ebp
+  8027d9:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8027da:	68 2c 47 80 00       	push   $0x80472c
+  8027df:	68 41 47 80 00       	push   $0x804741
+  8027e4:	68 b2 00 00 00       	push   $0xb2
+  8027e9:	68 56 47 80 00       	push   $0x804756
+  8027ee:	e8 8a 13 00 00       	call   803b7d <_panic>
+
+008027f3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8027f3:	55                   	push   %ebp
+  8027f4:	89 e5                	mov    %esp,%ebp
+  8027f6:	53                   	push   %ebx
+  8027f7:	83 ec 04             	sub    $0x4,%esp
+  8027fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8027fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802800:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802805:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80280b:	7f 2e                	jg     80283b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80280d:	83 ec 04             	sub    $0x4,%esp
+  802810:	53                   	push   %ebx
+  802811:	ff 75 0c             	push   0xc(%ebp)
+  802814:	68 0c 80 80 00       	push   $0x80800c
+  802819:	e8 68 e5 ff ff       	call   800d86 <memmove>
+	nsipcbuf.send.req_size = size;
+  80281e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802824:	8b 45 14             	mov    0x14(%ebp),%eax
+  802827:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80282c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802831:	e8 a0 fc ff ff       	call   8024d6 <nsipc>
+}
+  802836:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802839:	c9                   	leave
+  80283a:	c3                   	ret
+	assert(size < 1600);
+  80283b:	68 62 47 80 00       	push   $0x804762
+  802840:	68 41 47 80 00       	push   $0x804741
+  802845:	68 bd 00 00 00       	push   $0xbd
+  80284a:	68 56 47 80 00       	push   $0x804756
+  80284f:	e8 29 13 00 00       	call   803b7d <_panic>
+
+00802854 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802854:	55                   	push   %ebp
+  802855:	89 e5                	mov    %esp,%ebp
+  802857:	57                   	push   %edi
+  802858:	56                   	push   %esi
+  802859:	53                   	push   %ebx
+  80285a:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  80285d:	e8 c0 fc ff ff       	call   802522 <nsbulk_map>
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 55                	js     8028bb <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802866:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  80286d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802874:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80287b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80287e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802881:	0f 8d 24 02 00 00    	jge    802aab <nsipc_sendmsg+0x257>
+  802887:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80288a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80288d:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802890:	89 d8                	mov    %ebx,%eax
+  802892:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802897:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802899:	83 ec 0c             	sub    $0xc,%esp
+  80289c:	68 20 60 80 00       	push   $0x806020
+  8028a1:	e8 5a 0f 00 00       	call   803800 <pgbatch_init>
+  8028a6:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8028a9:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8028ab:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8028ae:	e9 82 00 00 00       	jmp    802935 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8028b3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8028b6:	85 db                	test   %ebx,%ebx
+  8028b8:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8028bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028be:	5b                   	pop    %ebx
+  8028bf:	5e                   	pop    %esi
+  8028c0:	5f                   	pop    %edi
+  8028c1:	5d                   	pop    %ebp
+  8028c2:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8028c3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028c8:	29 c8                	sub    %ecx,%eax
+  8028ca:	39 d0                	cmp    %edx,%eax
+  8028cc:	0f 46 d0             	cmovbe %eax,%edx
+  8028cf:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8028d1:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8028d7:	85 ff                	test   %edi,%edi
+  8028d9:	0f 49 c7             	cmovns %edi,%eax
+  8028dc:	c1 f8 0c             	sar    $0xc,%eax
+  8028df:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028e4:	e8 87 fc ff ff       	call   802570 <nsbulk_own>
+  8028e9:	85 c0                	test   %eax,%eax
+  8028eb:	0f 88 17 01 00 00    	js     802a08 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8028f1:	83 ec 04             	sub    $0x4,%esp
+  8028f4:	56                   	push   %esi
+  8028f5:	ff 75 e0             	push   -0x20(%ebp)
+  8028f8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8028fb:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802900:	50                   	push   %eax
+  802901:	e8 80 e4 ff ff       	call   800d86 <memmove>
+  802906:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802909:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80290c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80290f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802912:	0f 84 fd 00 00 00    	je     802a15 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802918:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80291b:	01 f7                	add    %esi,%edi
+  80291d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802920:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802923:	0f 8d 01 01 00 00    	jge    802a2a <nsipc_sendmsg+0x1d6>
+  802929:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80292f:	0f 8f f0 00 00 00    	jg     802a25 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802935:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802938:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80293b:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80293e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802941:	89 c2                	mov    %eax,%edx
+  802943:	03 13                	add    (%ebx),%edx
+  802945:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802948:	8b 73 04             	mov    0x4(%ebx),%esi
+  80294b:	29 c6                	sub    %eax,%esi
+  80294d:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802952:	29 f9                	sub    %edi,%ecx
+  802954:	39 ce                	cmp    %ecx,%esi
+  802956:	89 ca                	mov    %ecx,%edx
+  802958:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  80295b:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80295e:	89 f9                	mov    %edi,%ecx
+  802960:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802966:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802969:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80296e:	09 c8                	or     %ecx,%eax
+  802970:	0f 85 4d ff ff ff    	jne    8028c3 <nsipc_sendmsg+0x6f>
+  802976:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80297c:	0f 86 41 ff ff ff    	jbe    8028c3 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802982:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802988:	85 ff                	test   %edi,%edi
+  80298a:	0f 49 c7             	cmovns %edi,%eax
+  80298d:	c1 f8 0c             	sar    $0xc,%eax
+  802990:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802992:	89 d1                	mov    %edx,%ecx
+  802994:	c1 e9 0c             	shr    $0xc,%ecx
+  802997:	01 c8                	add    %ecx,%eax
+  802999:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80299c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80299f:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8029a1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8029a4:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8029a9:	29 c8                	sub    %ecx,%eax
+  8029ab:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8029ae:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8029b1:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8029b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029b8:	89 f9                	mov    %edi,%ecx
+  8029ba:	d3 e0                	shl    %cl,%eax
+  8029bc:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8029c2:	83 ec 08             	sub    $0x8,%esp
+  8029c5:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8029c7:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8029ca:	50                   	push   %eax
+  8029cb:	6a 00                	push   $0x0
+  8029cd:	56                   	push   %esi
+  8029ce:	6a 00                	push   $0x0
+  8029d0:	68 20 60 80 00       	push   $0x806020
+  8029d5:	e8 e4 0e 00 00       	call   8038be <pgbatch_map>
+  8029da:	83 c4 20             	add    $0x20,%esp
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	0f 88 ce fe ff ff    	js     8028b3 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8029e5:	83 c7 01             	add    $0x1,%edi
+  8029e8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8029ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8029f1:	39 c7                	cmp    %eax,%edi
+  8029f3:	75 be                	jne    8029b3 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8029f5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8029f8:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8029fb:	89 d6                	mov    %edx,%esi
+  8029fd:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802a03:	e9 01 ff ff ff       	jmp    802909 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802a08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802a0b:	85 db                	test   %ebx,%ebx
+  802a0d:	0f 45 c3             	cmovne %ebx,%eax
+  802a10:	e9 a6 fe ff ff       	jmp    8028bb <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802a15:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802a19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802a20:	e9 f3 fe ff ff       	jmp    802918 <nsipc_sendmsg+0xc4>
+  802a25:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802a28:	eb 03                	jmp    802a2d <nsipc_sendmsg+0x1d9>
+  802a2a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802a2d:	83 ec 0c             	sub    $0xc,%esp
+  802a30:	68 20 60 80 00       	push   $0x806020
+  802a35:	e8 d4 0d 00 00       	call   80380e <pgbatch_flush>
+  802a3a:	83 c4 10             	add    $0x10,%esp
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	78 50                	js     802a91 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a44:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802a49:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802a4f:	89 fb                	mov    %edi,%ebx
+  802a51:	29 f3                	sub    %esi,%ebx
+  802a53:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802a59:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a5c:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802a61:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802a66:	89 fa                	mov    %edi,%edx
+  802a68:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802a6d:	e8 66 fb ff ff       	call   8025d8 <nsipc_bulk>
+  802a72:	85 c0                	test   %eax,%eax
+  802a74:	78 28                	js     802a9e <nsipc_sendmsg+0x24a>
+		sent += r;
+  802a76:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802a79:	39 c3                	cmp    %eax,%ebx
+  802a7b:	75 0c                	jne    802a89 <nsipc_sendmsg+0x235>
+  802a7d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a80:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802a83:	0f 8f f2 fd ff ff    	jg     80287b <nsipc_sendmsg+0x27>
+		sent += r;
+  802a89:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802a8c:	e9 2a fe ff ff       	jmp    8028bb <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802a91:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802a94:	85 db                	test   %ebx,%ebx
+  802a96:	0f 45 c3             	cmovne %ebx,%eax
+  802a99:	e9 1d fe ff ff       	jmp    8028bb <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802a9e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802aa1:	85 db                	test   %ebx,%ebx
+  802aa3:	0f 45 c3             	cmovne %ebx,%eax
+  802aa6:	e9 10 fe ff ff       	jmp    8028bb <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802aab:	83 ec 0c             	sub    $0xc,%esp
+  802aae:	68 20 60 80 00       	push   $0x806020
+  802ab3:	e8 48 0d 00 00       	call   803800 <pgbatch_init>
+  802ab8:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802abb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ac5:	e9 63 ff ff ff       	jmp    802a2d <nsipc_sendmsg+0x1d9>
+
+00802aca <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802aca:	55                   	push   %ebp
+  802acb:	89 e5                	mov    %esp,%ebp
+  802acd:	57                   	push   %edi
+  802ace:	56                   	push   %esi
+  802acf:	53                   	push   %ebx
+  802ad0:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802ad3:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802ada:	0f 84 c8 00 00 00    	je     802ba8 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802ae0:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802ae7:	0f 84 e4 00 00 00    	je     802bd1 <nsipc_sendfile+0x107>
+{
+  802aed:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802af2:	89 fb                	mov    %edi,%ebx
+  802af4:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802af7:	0f 83 f0 00 00 00    	jae    802bed <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802afd:	89 fa                	mov    %edi,%edx
+  802aff:	03 55 10             	add    0x10(%ebp),%edx
+  802b02:	89 d0                	mov    %edx,%eax
+  802b04:	c1 f8 1f             	sar    $0x1f,%eax
+  802b07:	c1 e8 14             	shr    $0x14,%eax
+  802b0a:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802b0d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802b13:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802b15:	6a 10                	push   $0x10
+  802b17:	68 00 20 01 e0       	push   $0xe0012000
+  802b1c:	52                   	push   %edx
+  802b1d:	ff 75 0c             	push   0xc(%ebp)
+  802b20:	e8 fe f4 ff ff       	call   802023 <fmap>
+  802b25:	83 c4 10             	add    $0x10,%esp
+  802b28:	85 c0                	test   %eax,%eax
+  802b2a:	0f 8e b8 00 00 00    	jle    802be8 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802b30:	39 c6                	cmp    %eax,%esi
+  802b32:	0f 8d b5 00 00 00    	jge    802bed <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802b38:	29 f0                	sub    %esi,%eax
+  802b3a:	8b 55 14             	mov    0x14(%ebp),%edx
+  802b3d:	29 da                	sub    %ebx,%edx
+  802b3f:	39 d0                	cmp    %edx,%eax
+  802b41:	89 d3                	mov    %edx,%ebx
+  802b43:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802b46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b49:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802b4e:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802b54:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802b5a:	8b 45 18             	mov    0x18(%ebp),%eax
+  802b5d:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802b62:	83 ec 0c             	sub    $0xc,%esp
+  802b65:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802b67:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802b6e:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802b71:	83 c0 01             	add    $0x1,%eax
+  802b74:	50                   	push   %eax
+  802b75:	68 00 10 01 e0       	push   $0xe0011000
+  802b7a:	6a 11                	push   $0x11
+  802b7c:	ff 35 24 63 80 00    	push   0x806324
+  802b82:	e8 aa eb ff ff       	call   801731 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802b87:	83 c4 1c             	add    $0x1c,%esp
+  802b8a:	6a 00                	push   $0x0
+  802b8c:	6a 00                	push   $0x0
+  802b8e:	6a 00                	push   $0x0
+  802b90:	e8 d8 e8 ff ff       	call   80146d <ipc_recv>
+  802b95:	83 c4 10             	add    $0x10,%esp
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	78 5b                	js     802bf7 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802b9c:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802b9e:	39 c3                	cmp    %eax,%ebx
+  802ba0:	0f 8e 4c ff ff ff    	jle    802af2 <nsipc_sendfile+0x28>
+  802ba6:	eb 45                	jmp    802bed <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802ba8:	83 ec 04             	sub    $0x4,%esp
+  802bab:	6a 07                	push   $0x7
+  802bad:	68 00 10 01 e0       	push   $0xe0011000
+  802bb2:	6a 00                	push   $0x0
+  802bb4:	e8 51 e4 ff ff       	call   80100a <sys_page_alloc>
+  802bb9:	89 c7                	mov    %eax,%edi
+  802bbb:	83 c4 10             	add    $0x10,%esp
+  802bbe:	85 c0                	test   %eax,%eax
+  802bc0:	78 2b                	js     802bed <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802bc2:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802bc9:	00 00 00 
+  802bcc:	e9 0f ff ff ff       	jmp    802ae0 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bd1:	83 ec 0c             	sub    $0xc,%esp
+  802bd4:	6a 03                	push   $0x3
+  802bd6:	e8 8b eb ff ff       	call   801766 <ipc_find_env>
+  802bdb:	a3 24 63 80 00       	mov    %eax,0x806324
+  802be0:	83 c4 10             	add    $0x10,%esp
+  802be3:	e9 05 ff ff ff       	jmp    802aed <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802be8:	85 ff                	test   %edi,%edi
+  802bea:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802bed:	89 f8                	mov    %edi,%eax
+  802bef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bf2:	5b                   	pop    %ebx
+  802bf3:	5e                   	pop    %esi
+  802bf4:	5f                   	pop    %edi
+  802bf5:	5d                   	pop    %ebp
+  802bf6:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802bf7:	85 ff                	test   %edi,%edi
+  802bf9:	0f 44 f8             	cmove  %eax,%edi
+  802bfc:	eb ef                	jmp    802bed <nsipc_sendfile+0x123>
+
+00802bfe <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802bfe:	55                   	push   %ebp
+  802bff:	89 e5                	mov    %esp,%ebp
+  802c01:	57                   	push   %edi
+  802c02:	56                   	push   %esi
+  802c03:	53                   	push   %ebx
+  802c04:	83 ec 1c             	sub    $0x1c,%esp
+  802c07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802c0a:	e8 13 f9 ff ff       	call   802522 <nsbulk_map>
+  802c0f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c12:	85 c0                	test   %eax,%eax
+  802c14:	0f 88 ba 00 00 00    	js     802cd4 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802c1a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c1e:	0f 8e bb 00 00 00    	jle    802cdf <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802c24:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802c29:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802c2e:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802c33:	89 f8                	mov    %edi,%eax
+  802c35:	29 f0                	sub    %esi,%eax
+  802c37:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802c3b:	39 c8                	cmp    %ecx,%eax
+  802c3d:	0f 47 c1             	cmova  %ecx,%eax
+  802c40:	01 f0                	add    %esi,%eax
+  802c42:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802c44:	83 c2 01             	add    $0x1,%edx
+  802c47:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802c4a:	7e 07                	jle    802c53 <nsipc_recvmsg+0x55>
+  802c4c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802c51:	7e e0                	jle    802c33 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802c53:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802c59:	c1 fa 0c             	sar    $0xc,%edx
+  802c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c61:	e8 0a f9 ff ff       	call   802570 <nsbulk_own>
+  802c66:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c69:	85 c0                	test   %eax,%eax
+  802c6b:	78 67                	js     802cd4 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802c6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c70:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802c75:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802c7b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c7e:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802c83:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802c88:	89 f2                	mov    %esi,%edx
+  802c8a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802c8f:	e8 44 f9 ff ff       	call   8025d8 <nsipc_bulk>
+  802c94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c97:	85 c0                	test   %eax,%eax
+  802c99:	78 39                	js     802cd4 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802c9b:	39 f0                	cmp    %esi,%eax
+  802c9d:	7f 4a                	jg     802ce9 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca4:	85 c0                	test   %eax,%eax
+  802ca6:	7e 2c                	jle    802cd4 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802ca8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802cab:	29 fe                	sub    %edi,%esi
+  802cad:	8b 43 04             	mov    0x4(%ebx),%eax
+  802cb0:	39 c6                	cmp    %eax,%esi
+  802cb2:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802cb5:	83 ec 04             	sub    $0x4,%esp
+  802cb8:	56                   	push   %esi
+  802cb9:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802cbf:	50                   	push   %eax
+  802cc0:	ff 33                	push   (%ebx)
+  802cc2:	e8 bf e0 ff ff       	call   800d86 <memmove>
+		n += m;
+  802cc7:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802cc9:	83 c3 08             	add    $0x8,%ebx
+  802ccc:	83 c4 10             	add    $0x10,%esp
+  802ccf:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802cd2:	7f d4                	jg     802ca8 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802cd4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cda:	5b                   	pop    %ebx
+  802cdb:	5e                   	pop    %esi
+  802cdc:	5f                   	pop    %edi
+  802cdd:	5d                   	pop    %ebp
+  802cde:	c3                   	ret
+	int r, i, n, len = 0;
+  802cdf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce4:	e9 6a ff ff ff       	jmp    802c53 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802ce9:	68 38 47 80 00       	push   $0x804738
+  802cee:	68 41 47 80 00       	push   $0x804741
+  802cf3:	68 3b 01 00 00       	push   $0x13b
+  802cf8:	68 56 47 80 00       	push   $0x804756
+  802cfd:	e8 7b 0e 00 00       	call   803b7d <_panic>
+
+00802d02 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	57                   	push   %edi
+  802d06:	56                   	push   %esi
+  802d07:	53                   	push   %ebx
+  802d08:	83 ec 0c             	sub    $0xc,%esp
+  802d0b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d0e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802d11:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802d14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d17:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802d1c:	8b 07                	mov    (%edi),%eax
+  802d1e:	a3 04 80 80 00       	mov    %eax,0x808004
+  802d23:	8b 47 04             	mov    0x4(%edi),%eax
+  802d26:	a3 08 80 80 00       	mov    %eax,0x808008
+  802d2b:	8b 47 08             	mov    0x8(%edi),%eax
+  802d2e:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802d33:	8b 47 0c             	mov    0xc(%edi),%eax
+  802d36:	a3 10 80 80 00       	mov    %eax,0x808010
+  802d3b:	8b 47 10             	mov    0x10(%edi),%eax
+  802d3e:	a3 14 80 80 00       	mov    %eax,0x808014
+  802d43:	8b 47 14             	mov    0x14(%edi),%eax
+  802d46:	a3 18 80 80 00       	mov    %eax,0x808018
+  802d4b:	8b 47 18             	mov    0x18(%edi),%eax
+  802d4e:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802d53:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802d56:	a3 20 80 80 00       	mov    %eax,0x808020
+  802d5b:	8b 47 20             	mov    0x20(%edi),%eax
+  802d5e:	a3 24 80 80 00       	mov    %eax,0x808024
+  802d63:	8b 47 24             	mov    0x24(%edi),%eax
+  802d66:	a3 28 80 80 00       	mov    %eax,0x808028
+  802d6b:	8b 47 28             	mov    0x28(%edi),%eax
+  802d6e:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802d73:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802d76:	a3 30 80 80 00       	mov    %eax,0x808030
+  802d7b:	8b 47 30             	mov    0x30(%edi),%eax
+  802d7e:	a3 34 80 80 00       	mov    %eax,0x808034
+  802d83:	8b 47 34             	mov    0x34(%edi),%eax
+  802d86:	a3 38 80 80 00       	mov    %eax,0x808038
+  802d8b:	8b 47 38             	mov    0x38(%edi),%eax
+  802d8e:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802d93:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802d96:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802d9b:	8b 06                	mov    (%esi),%eax
+  802d9d:	a3 44 80 80 00       	mov    %eax,0x808044
+  802da2:	8b 46 04             	mov    0x4(%esi),%eax
+  802da5:	a3 48 80 80 00       	mov    %eax,0x808048
+  802daa:	8b 46 08             	mov    0x8(%esi),%eax
+  802dad:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802db2:	8b 46 0c             	mov    0xc(%esi),%eax
+  802db5:	a3 50 80 80 00       	mov    %eax,0x808050
+  802dba:	8b 46 10             	mov    0x10(%esi),%eax
+  802dbd:	a3 54 80 80 00       	mov    %eax,0x808054
+  802dc2:	8b 46 14             	mov    0x14(%esi),%eax
+  802dc5:	a3 58 80 80 00       	mov    %eax,0x808058
+  802dca:	8b 46 18             	mov    0x18(%esi),%eax
+  802dcd:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802dd2:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802dd5:	a3 60 80 80 00       	mov    %eax,0x808060
+  802dda:	8b 46 20             	mov    0x20(%esi),%eax
+  802ddd:	a3 64 80 80 00       	mov    %eax,0x808064
+  802de2:	8b 46 24             	mov    0x24(%esi),%eax
+  802de5:	a3 68 80 80 00       	mov    %eax,0x808068
+  802dea:	8b 46 28             	mov    0x28(%esi),%eax
+  802ded:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802df2:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802df5:	a3 70 80 80 00       	mov    %eax,0x808070
+  802dfa:	8b 46 30             	mov    0x30(%esi),%eax
+  802dfd:	a3 74 80 80 00       	mov    %eax,0x808074
+  802e02:	8b 46 34             	mov    0x34(%esi),%eax
+  802e05:	a3 78 80 80 00       	mov    %eax,0x808078
+  802e0a:	8b 46 38             	mov    0x38(%esi),%eax
+  802e0d:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802e12:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802e15:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802e1a:	8b 03                	mov    (%ebx),%eax
+  802e1c:	a3 84 80 80 00       	mov    %eax,0x808084
+  802e21:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e24:	a3 88 80 80 00       	mov    %eax,0x808088
+  802e29:	8b 43 08             	mov    0x8(%ebx),%eax
+  802e2c:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802e31:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802e34:	a3 90 80 80 00       	mov    %eax,0x808090
+  802e39:	8b 43 10             	mov    0x10(%ebx),%eax
+  802e3c:	a3 94 80 80 00       	mov    %eax,0x808094
+  802e41:	8b 43 14             	mov    0x14(%ebx),%eax
+  802e44:	a3 98 80 80 00       	mov    %eax,0x808098
+  802e49:	8b 43 18             	mov    0x18(%ebx),%eax
+  802e4c:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802e51:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802e54:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802e59:	8b 43 20             	mov    0x20(%ebx),%eax
+  802e5c:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802e61:	8b 43 24             	mov    0x24(%ebx),%eax
+  802e64:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802e69:	8b 43 28             	mov    0x28(%ebx),%eax
+  802e6c:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802e71:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802e74:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802e79:	8b 43 30             	mov    0x30(%ebx),%eax
+  802e7c:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802e81:	8b 43 34             	mov    0x34(%ebx),%eax
+  802e84:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802e89:	8b 43 38             	mov    0x38(%ebx),%eax
+  802e8c:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802e91:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802e94:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802e99:	8b 45 18             	mov    0x18(%ebp),%eax
+  802e9c:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802ea1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802ea6:	e8 2b f6 ff ff       	call   8024d6 <nsipc>
+  802eab:	85 c0                	test   %eax,%eax
+  802ead:	0f 88 ad 01 00 00    	js     803060 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802eb3:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802eb9:	89 17                	mov    %edx,(%edi)
+  802ebb:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802ec1:	89 57 04             	mov    %edx,0x4(%edi)
+  802ec4:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802eca:	89 57 08             	mov    %edx,0x8(%edi)
+  802ecd:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802ed3:	89 57 0c             	mov    %edx,0xc(%edi)
+  802ed6:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802edc:	89 57 10             	mov    %edx,0x10(%edi)
+  802edf:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802ee5:	89 57 14             	mov    %edx,0x14(%edi)
+  802ee8:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802eee:	89 57 18             	mov    %edx,0x18(%edi)
+  802ef1:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802ef7:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802efa:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802f00:	89 57 20             	mov    %edx,0x20(%edi)
+  802f03:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802f09:	89 57 24             	mov    %edx,0x24(%edi)
+  802f0c:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802f12:	89 57 28             	mov    %edx,0x28(%edi)
+  802f15:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802f1b:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802f1e:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802f24:	89 57 30             	mov    %edx,0x30(%edi)
+  802f27:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802f2d:	89 57 34             	mov    %edx,0x34(%edi)
+  802f30:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802f36:	89 57 38             	mov    %edx,0x38(%edi)
+  802f39:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802f3f:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802f42:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802f48:	89 16                	mov    %edx,(%esi)
+  802f4a:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802f50:	89 56 04             	mov    %edx,0x4(%esi)
+  802f53:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802f59:	89 56 08             	mov    %edx,0x8(%esi)
+  802f5c:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802f62:	89 56 0c             	mov    %edx,0xc(%esi)
+  802f65:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802f6b:	89 56 10             	mov    %edx,0x10(%esi)
+  802f6e:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802f74:	89 56 14             	mov    %edx,0x14(%esi)
+  802f77:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802f7d:	89 56 18             	mov    %edx,0x18(%esi)
+  802f80:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802f86:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802f89:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802f8f:	89 56 20             	mov    %edx,0x20(%esi)
+  802f92:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802f98:	89 56 24             	mov    %edx,0x24(%esi)
+  802f9b:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802fa1:	89 56 28             	mov    %edx,0x28(%esi)
+  802fa4:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802faa:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802fad:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802fb3:	89 56 30             	mov    %edx,0x30(%esi)
+  802fb6:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802fbc:	89 56 34             	mov    %edx,0x34(%esi)
+  802fbf:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802fc5:	89 56 38             	mov    %edx,0x38(%esi)
+  802fc8:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802fce:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802fd1:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802fd7:	89 13                	mov    %edx,(%ebx)
+  802fd9:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802fdf:	89 53 04             	mov    %edx,0x4(%ebx)
+  802fe2:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802fe8:	89 53 08             	mov    %edx,0x8(%ebx)
+  802feb:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802ff1:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802ff4:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802ffa:	89 53 10             	mov    %edx,0x10(%ebx)
+  802ffd:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803003:	89 53 14             	mov    %edx,0x14(%ebx)
+  803006:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  80300c:	89 53 18             	mov    %edx,0x18(%ebx)
+  80300f:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  803015:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803018:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  80301e:	89 53 20             	mov    %edx,0x20(%ebx)
+  803021:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  803027:	89 53 24             	mov    %edx,0x24(%ebx)
+  80302a:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  803030:	89 53 28             	mov    %edx,0x28(%ebx)
+  803033:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  803039:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  80303c:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803042:	89 53 30             	mov    %edx,0x30(%ebx)
+  803045:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  80304b:	89 53 34             	mov    %edx,0x34(%ebx)
+  80304e:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803054:	89 53 38             	mov    %edx,0x38(%ebx)
+  803057:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  80305d:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803060:	83 c4 0c             	add    $0xc,%esp
+  803063:	5b                   	pop    %ebx
+  803064:	5e                   	pop    %esi
+  803065:	5f                   	pop    %edi
+  803066:	5d                   	pop    %ebp
+  803067:	c3                   	ret
+
+00803068 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803068:	55                   	push   %ebp
+  803069:	89 e5                	mov    %esp,%ebp
+  80306b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80306e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803071:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803076:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803079:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  80307e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803081:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  803086:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80308b:	e8 46 f4 ff ff       	call   8024d6 <nsipc>
+}
+  803090:	c9                   	leave
+  803091:	c3                   	ret
+
+00803092 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803092:	55                   	push   %ebp
+  803093:	89 e5                	mov    %esp,%ebp
+  803095:	56                   	push   %esi
+  803096:	53                   	push   %ebx
+  803097:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  80309a:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8030a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030a3:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  8030a8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8030ad:	e8 24 f4 ff ff       	call   8024d6 <nsipc>
+  8030b2:	89 c3                	mov    %eax,%ebx
+  8030b4:	85 c0                	test   %eax,%eax
+  8030b6:	7e 1f                	jle    8030d7 <nsipc_evwait+0x45>
+		assert(r <= max);
+  8030b8:	39 c6                	cmp    %eax,%esi
+  8030ba:	7c 24                	jl     8030e0 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8030bc:	83 ec 04             	sub    $0x4,%esp
+  8030bf:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8030c6:	50                   	push   %eax
+  8030c7:	68 00 80 80 00       	push   $0x808000
+  8030cc:	ff 75 08             	push   0x8(%ebp)
+  8030cf:	e8 b2 dc ff ff       	call   800d86 <memmove>
+  8030d4:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8030d7:	89 d8                	mov    %ebx,%eax
+  8030d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030dc:	5b                   	pop    %ebx
+  8030dd:	5e                   	pop    %esi
+  8030de:	5d                   	pop    %ebp
+  8030df:	c3                   	ret
+		assert(r <= max);
+  8030e0:	68 6e 47 80 00       	push   $0x80476e
+  8030e5:	68 41 47 80 00       	push   $0x804741
+  8030ea:	68 6a 01 00 00       	push   $0x16a
+  8030ef:	68 56 47 80 00       	push   $0x804756
+  8030f4:	e8 84 0a 00 00       	call   803b7d <_panic>
+
+008030f9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8030f9:	55                   	push   %ebp
+  8030fa:	89 e5                	mov    %esp,%ebp
+  8030fc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8030ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803102:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803107:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80310a:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80310f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803112:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803117:	b8 09 00 00 00       	mov    $0x9,%eax
+  80311c:	e8 b5 f3 ff ff       	call   8024d6 <nsipc>
+}
+  803121:	c9                   	leave
+  803122:	c3                   	ret
+
+00803123 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803123:	55                   	push   %ebp
+  803124:	89 e5                	mov    %esp,%ebp
+  803126:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803129:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803131:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803136:	e8 9b f3 ff ff       	call   8024d6 <nsipc>
+}
+  80313b:	c9                   	leave
+  80313c:	c3                   	ret
+
+0080313d <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  80313d:	55                   	push   %ebp
+  80313e:	89 e5                	mov    %esp,%ebp
+  803140:	53                   	push   %ebx
+  803141:	83 ec 04             	sub    $0x4,%esp
+  803144:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803147:	b8 12 00 00 00       	mov    $0x12,%eax
+  80314c:	e8 85 f3 ff ff       	call   8024d6 <nsipc>
+  803151:	85 c0                	test   %eax,%eax
+  803153:	78 50                	js     8031a5 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803155:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  80315b:	89 13                	mov    %edx,(%ebx)
+  80315d:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803163:	89 53 04             	mov    %edx,0x4(%ebx)
+  803166:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80316c:	89 53 08             	mov    %edx,0x8(%ebx)
+  80316f:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803175:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803178:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80317e:	89 53 10             	mov    %edx,0x10(%ebx)
+  803181:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803187:	89 53 14             	mov    %edx,0x14(%ebx)
+  80318a:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803190:	89 53 18             	mov    %edx,0x18(%ebx)
+  803193:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803199:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80319c:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8031a2:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8031a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031a8:	c9                   	leave
+  8031a9:	c3                   	ret
+
+008031aa <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8031aa:	55                   	push   %ebp
+  8031ab:	89 e5                	mov    %esp,%ebp
+  8031ad:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8031b0:	6a 03                	push   $0x3
+  8031b2:	e8 af e5 ff ff       	call   801766 <ipc_find_env>
+  8031b7:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  8031bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031bf:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8031c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8031c9:	e8 08 f3 ff ff       	call   8024d6 <nsipc>
+  8031ce:	83 c4 10             	add    $0x10,%esp
+  8031d1:	85 c0                	test   %eax,%eax
+  8031d3:	78 0a                	js     8031df <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8031d5:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  8031da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031df:	c9                   	leave
+  8031e0:	c3                   	ret
+
+008031e1 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8031e1:	55                   	push   %ebp
+  8031e2:	89 e5                	mov    %esp,%ebp
+  8031e4:	57                   	push   %edi
+  8031e5:	56                   	push   %esi
+  8031e6:	53                   	push   %ebx
+  8031e7:	83 ec 1c             	sub    $0x1c,%esp
+  8031ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8031ed:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8031f0:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8031f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031fa:	89 e0                	mov    %esp,%eax
+  8031fc:	89 f2                	mov    %esi,%edx
+  8031fe:	29 c2                	sub    %eax,%edx
+  803200:	89 d0                	mov    %edx,%eax
+  803202:	c1 e8 0f             	shr    $0xf,%eax
+  803205:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80320b:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80320e:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803215:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803218:	83 ec 0c             	sub    $0xc,%esp
+  80321b:	ff 75 e0             	push   -0x20(%ebp)
+  80321e:	e8 a0 09 00 00       	call   803bc3 <pageref>
+  803223:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803226:	83 c4 04             	add    $0x4,%esp
+  803229:	ff 75 dc             	push   -0x24(%ebp)
+  80322c:	e8 92 09 00 00       	call   803bc3 <pageref>
+  803231:	89 e2                	mov    %esp,%edx
+  803233:	89 f1                	mov    %esi,%ecx
+  803235:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  803237:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80323a:	89 ca                	mov    %ecx,%edx
+  80323c:	c1 ea 0f             	shr    $0xf,%edx
+  80323f:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803245:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803248:	8b 14 95 60 63 80 00 	mov    0x806360(,%edx,4),%edx
+  80324f:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803252:	39 d7                	cmp    %edx,%edi
+  803254:	74 40                	je     803296 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803256:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803259:	75 9f                	jne    8031fa <_pipeisclosed+0x19>
+  80325b:	89 e2                	mov    %esp,%edx
+  80325d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803262:	29 d0                	sub    %edx,%eax
+  803264:	89 c2                	mov    %eax,%edx
+  803266:	c1 ea 0f             	shr    $0xf,%edx
+  803269:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80326e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803273:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803276:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80327d:	8b 40 58             	mov    0x58(%eax),%eax
+  803280:	6a 01                	push   $0x1
+  803282:	50                   	push   %eax
+  803283:	57                   	push   %edi
+  803284:	68 77 47 80 00       	push   $0x804777
+  803289:	e8 51 d2 ff ff       	call   8004df <cprintf>
+  80328e:	83 c4 10             	add    $0x10,%esp
+  803291:	e9 5f ff ff ff       	jmp    8031f5 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803296:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803299:	0f 94 c0             	sete   %al
+  80329c:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80329f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032a2:	5b                   	pop    %ebx
+  8032a3:	5e                   	pop    %esi
+  8032a4:	5f                   	pop    %edi
+  8032a5:	5d                   	pop    %ebp
+  8032a6:	c3                   	ret
+
+008032a7 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8032a7:	55                   	push   %ebp
+  8032a8:	89 e5                	mov    %esp,%ebp
+  8032aa:	53                   	push   %ebx
+  8032ab:	83 ec 0c             	sub    $0xc,%esp
+  8032ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8032b1:	53                   	push   %ebx
+  8032b2:	6a 00                	push   $0x0
+  8032b4:	e8 d6 dd ff ff       	call   80108f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8032b9:	89 1c 24             	mov    %ebx,(%esp)
+  8032bc:	e8 f4 e4 ff ff       	call   8017b5 <fd2data>
+  8032c1:	83 c4 08             	add    $0x8,%esp
+  8032c4:	50                   	push   %eax
+  8032c5:	6a 00                	push   $0x0
+  8032c7:	e8 c3 dd ff ff       	call   80108f <sys_page_unmap>
+}
+  8032cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032cf:	c9                   	leave
+  8032d0:	c3                   	ret
+
+008032d1 <devpipe_read>:
+{
+  8032d1:	55                   	push   %ebp
+  8032d2:	89 e5                	mov    %esp,%ebp
+  8032d4:	57                   	push   %edi
+  8032d5:	56                   	push   %esi
+  8032d6:	53                   	push   %ebx
+  8032d7:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8032da:	ff 75 08             	push   0x8(%ebp)
+  8032dd:	e8 d3 e4 ff ff       	call   8017b5 <fd2data>
+  8032e2:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8032e4:	8b 70 04             	mov    0x4(%eax),%esi
+  8032e7:	8b 00                	mov    (%eax),%eax
+  8032e9:	83 c4 10             	add    $0x10,%esp
+  8032ec:	39 f0                	cmp    %esi,%eax
+  8032ee:	75 36                	jne    803326 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8032f0:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8032f3:	89 da                	mov    %ebx,%edx
+  8032f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032f8:	e8 e4 fe ff ff       	call   8031e1 <_pipeisclosed>
+  8032fd:	85 c0                	test   %eax,%eax
+  8032ff:	0f 85 d4 00 00 00    	jne    8033d9 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803305:	b8 01 00 00 00       	mov    $0x1,%eax
+  80330a:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80330e:	83 ec 04             	sub    $0x4,%esp
+  803311:	6a ff                	push   $0xffffffff
+  803313:	56                   	push   %esi
+  803314:	57                   	push   %edi
+  803315:	e8 ee e0 ff ff       	call   801408 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80331a:	8b 73 04             	mov    0x4(%ebx),%esi
+  80331d:	8b 03                	mov    (%ebx),%eax
+  80331f:	83 c4 10             	add    $0x10,%esp
+  803322:	39 c6                	cmp    %eax,%esi
+  803324:	74 cd                	je     8032f3 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803326:	8b 73 04             	mov    0x4(%ebx),%esi
+  803329:	8b 03                	mov    (%ebx),%eax
+  80332b:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803331:	29 c6                	sub    %eax,%esi
+  803333:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803338:	f7 e6                	mul    %esi
+  80333a:	c1 ea 0c             	shr    $0xc,%edx
+  80333d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803343:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803345:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803348:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80334c:	8b 0b                	mov    (%ebx),%ecx
+  80334e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803353:	f7 e1                	mul    %ecx
+  803355:	c1 ea 0b             	shr    $0xb,%edx
+  803358:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80335e:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803360:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803365:	29 cf                	sub    %ecx,%edi
+  803367:	39 f7                	cmp    %esi,%edi
+  803369:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80336c:	83 ec 04             	sub    $0x4,%esp
+  80336f:	57                   	push   %edi
+  803370:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803374:	50                   	push   %eax
+  803375:	ff 75 0c             	push   0xc(%ebp)
+  803378:	e8 09 da ff ff       	call   800d86 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  80337d:	83 c4 0c             	add    $0xc,%esp
+  803380:	89 f0                	mov    %esi,%eax
+  803382:	29 f8                	sub    %edi,%eax
+  803384:	50                   	push   %eax
+  803385:	8d 43 10             	lea    0x10(%ebx),%eax
+  803388:	50                   	push   %eax
+  803389:	89 f8                	mov    %edi,%eax
+  80338b:	03 45 0c             	add    0xc(%ebp),%eax
+  80338e:	50                   	push   %eax
+  80338f:	e8 f2 d9 ff ff       	call   800d86 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803394:	8b 0b                	mov    (%ebx),%ecx
+  803396:	01 f1                	add    %esi,%ecx
+  803398:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80339d:	f7 e1                	mul    %ecx
+  80339f:	c1 ea 0c             	shr    $0xc,%edx
+  8033a2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8033a8:	29 c1                	sub    %eax,%ecx
+  8033aa:	89 0b                	mov    %ecx,(%ebx)
+  8033ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b1:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8033b5:	83 c4 10             	add    $0x10,%esp
+  8033b8:	85 c0                	test   %eax,%eax
+  8033ba:	75 0a                	jne    8033c6 <devpipe_read+0xf5>
+	return n;
+  8033bc:	89 f0                	mov    %esi,%eax
+}
+  8033be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033c1:	5b                   	pop    %ebx
+  8033c2:	5e                   	pop    %esi
+  8033c3:	5f                   	pop    %edi
+  8033c4:	5d                   	pop    %ebp
+  8033c5:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8033c6:	83 ec 08             	sub    $0x8,%esp
+  8033c9:	68 00 04 00 00       	push   $0x400
+  8033ce:	53                   	push   %ebx
+  8033cf:	e8 56 e0 ff ff       	call   80142a <sys_futex_wake>
+  8033d4:	83 c4 10             	add    $0x10,%esp
+  8033d7:	eb e3                	jmp    8033bc <devpipe_read+0xeb>
+			return 0;
+  8033d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033de:	eb de                	jmp    8033be <devpipe_read+0xed>
+
+008033e0 <devpipe_write>:
+{
+  8033e0:	55                   	push   %ebp
+  8033e1:	89 e5                	mov    %esp,%ebp
+  8033e3:	57                   	push   %edi
+  8033e4:	56                   	push   %esi
+  8033e5:	53                   	push   %ebx
+  8033e6:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8033e9:	ff 75 08             	push   0x8(%ebp)
+  8033ec:	e8 c4 e3 ff ff       	call   8017b5 <fd2data>
+  8033f1:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8033f3:	83 c4 10             	add    $0x10,%esp
+  8033f6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8033fd:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803402:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803406:	0f 84 43 01 00 00    	je     80354f <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80340c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80340f:	8b 06                	mov    (%esi),%eax
+  803411:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803417:	29 c1                	sub    %eax,%ecx
+  803419:	89 c8                	mov    %ecx,%eax
+  80341b:	f7 e7                	mul    %edi
+  80341d:	c1 ea 0c             	shr    $0xc,%edx
+  803420:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803426:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803428:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80342e:	75 52                	jne    803482 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803430:	89 f2                	mov    %esi,%edx
+  803432:	8b 45 08             	mov    0x8(%ebp),%eax
+  803435:	e8 a7 fd ff ff       	call   8031e1 <_pipeisclosed>
+  80343a:	85 c0                	test   %eax,%eax
+  80343c:	0f 85 28 01 00 00    	jne    80356a <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803442:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803444:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803447:	8b 06                	mov    (%esi),%eax
+  803449:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80344f:	29 c1                	sub    %eax,%ecx
+  803451:	89 c8                	mov    %ecx,%eax
+  803453:	f7 e7                	mul    %edi
+  803455:	c1 ea 0c             	shr    $0xc,%edx
+  803458:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80345e:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803460:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803466:	75 a4                	jne    80340c <devpipe_write+0x2c>
+  803468:	b8 01 00 00 00       	mov    $0x1,%eax
+  80346d:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803471:	83 ec 04             	sub    $0x4,%esp
+  803474:	6a ff                	push   $0xffffffff
+  803476:	53                   	push   %ebx
+  803477:	56                   	push   %esi
+  803478:	e8 8b df ff ff       	call   801408 <sys_futex_wait>
+}
+  80347d:	83 c4 10             	add    $0x10,%esp
+  803480:	eb 8a                	jmp    80340c <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803482:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803485:	8b 06                	mov    (%esi),%eax
+  803487:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80348d:	29 c1                	sub    %eax,%ecx
+  80348f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803494:	f7 e1                	mul    %ecx
+  803496:	c1 ea 0c             	shr    $0xc,%edx
+  803499:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80349f:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8034a1:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8034a6:	89 d8                	mov    %ebx,%eax
+  8034a8:	29 c8                	sub    %ecx,%eax
+  8034aa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034ad:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8034b0:	29 ca                	sub    %ecx,%edx
+  8034b2:	39 d0                	cmp    %edx,%eax
+  8034b4:	0f 46 d0             	cmovbe %eax,%edx
+  8034b7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8034ba:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8034bd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034c2:	f7 e1                	mul    %ecx
+  8034c4:	c1 ea 0b             	shr    $0xb,%edx
+  8034c7:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8034cd:	89 ca                	mov    %ecx,%edx
+  8034cf:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8034d1:	29 d3                	sub    %edx,%ebx
+  8034d3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8034d6:	39 c3                	cmp    %eax,%ebx
+  8034d8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8034db:	83 ec 04             	sub    $0x4,%esp
+  8034de:	53                   	push   %ebx
+  8034df:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8034e2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8034e5:	51                   	push   %ecx
+  8034e6:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8034ea:	50                   	push   %eax
+  8034eb:	e8 96 d8 ff ff       	call   800d86 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8034f0:	83 c4 0c             	add    $0xc,%esp
+  8034f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8034f6:	29 d8                	sub    %ebx,%eax
+  8034f8:	50                   	push   %eax
+  8034f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8034fc:	01 cb                	add    %ecx,%ebx
+  8034fe:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803501:	53                   	push   %ebx
+  803502:	8d 46 10             	lea    0x10(%esi),%eax
+  803505:	50                   	push   %eax
+  803506:	e8 7b d8 ff ff       	call   800d86 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80350b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80350e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803511:	01 c1                	add    %eax,%ecx
+  803513:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803518:	f7 e1                	mul    %ecx
+  80351a:	c1 ea 0c             	shr    $0xc,%edx
+  80351d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803523:	89 ca                	mov    %ecx,%edx
+  803525:	29 c2                	sub    %eax,%edx
+  803527:	89 56 04             	mov    %edx,0x4(%esi)
+  80352a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352f:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803533:	83 c4 10             	add    $0x10,%esp
+  803536:	85 c0                	test   %eax,%eax
+  803538:	75 1a                	jne    803554 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80353a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80353d:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803540:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803543:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803546:	0f 82 c0 fe ff ff    	jb     80340c <devpipe_write+0x2c>
+  80354c:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80354f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803552:	eb 1b                	jmp    80356f <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803554:	83 ec 08             	sub    $0x8,%esp
+  803557:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  80355c:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80355f:	50                   	push   %eax
+  803560:	e8 c5 de ff ff       	call   80142a <sys_futex_wake>
+  803565:	83 c4 10             	add    $0x10,%esp
+  803568:	eb d0                	jmp    80353a <devpipe_write+0x15a>
+				return 0;
+  80356a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80356f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803572:	5b                   	pop    %ebx
+  803573:	5e                   	pop    %esi
+  803574:	5f                   	pop    %edi
+  803575:	5d                   	pop    %ebp
+  803576:	c3                   	ret
+
+00803577 <devpipe_stat>:
+{
+  803577:	55                   	push   %ebp
+  803578:	89 e5                	mov    %esp,%ebp
+  80357a:	56                   	push   %esi
+  80357b:	53                   	push   %ebx
+  80357c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80357f:	83 ec 0c             	sub    $0xc,%esp
+  803582:	ff 75 08             	push   0x8(%ebp)
+  803585:	e8 2b e2 ff ff       	call   8017b5 <fd2data>
+  80358a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80358c:	83 c4 08             	add    $0x8,%esp
+  80358f:	68 8a 47 80 00       	push   $0x80478a
+  803594:	53                   	push   %ebx
+  803595:	e8 3c d6 ff ff       	call   800bd6 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80359a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80359d:	8b 06                	mov    (%esi),%eax
+  80359f:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8035a5:	29 c1                	sub    %eax,%ecx
+  8035a7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8035ac:	89 c8                	mov    %ecx,%eax
+  8035ae:	f7 e2                	mul    %edx
+  8035b0:	c1 ea 0c             	shr    $0xc,%edx
+  8035b3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8035b9:	29 d1                	sub    %edx,%ecx
+  8035bb:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8035c1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8035c8:	00 00 00 
+	stat->st_dev = &devpipe;
+  8035cb:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8035d2:	50 80 00 
+}
+  8035d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035dd:	5b                   	pop    %ebx
+  8035de:	5e                   	pop    %esi
+  8035df:	5d                   	pop    %ebp
+  8035e0:	c3                   	ret
+
+008035e1 <devpipe_poll>:
+{
+  8035e1:	55                   	push   %ebp
+  8035e2:	89 e5                	mov    %esp,%ebp
+  8035e4:	57                   	push   %edi
+  8035e5:	56                   	push   %esi
+  8035e6:	53                   	push   %ebx
+  8035e7:	83 ec 18             	sub    $0x18,%esp
+  8035ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8035f0:	57                   	push   %edi
+  8035f1:	e8 bf e1 ff ff       	call   8017b5 <fd2data>
+  8035f6:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8035f8:	83 c4 10             	add    $0x10,%esp
+  8035fb:	89 f3                	mov    %esi,%ebx
+  8035fd:	83 e3 01             	and    $0x1,%ebx
+  803600:	75 27                	jne    803629 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803602:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803608:	75 48                	jne    803652 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80360a:	89 ca                	mov    %ecx,%edx
+  80360c:	89 f8                	mov    %edi,%eax
+  80360e:	e8 ce fb ff ff       	call   8031e1 <_pipeisclosed>
+  803613:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803615:	89 d8                	mov    %ebx,%eax
+  803617:	83 c8 10             	or     $0x10,%eax
+  80361a:	85 d2                	test   %edx,%edx
+  80361c:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80361f:	89 d8                	mov    %ebx,%eax
+  803621:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803624:	5b                   	pop    %ebx
+  803625:	5e                   	pop    %esi
+  803626:	5f                   	pop    %edi
+  803627:	5d                   	pop    %ebp
+  803628:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803629:	8b 58 04             	mov    0x4(%eax),%ebx
+  80362c:	8b 00                	mov    (%eax),%eax
+  80362e:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803634:	29 c3                	sub    %eax,%ebx
+  803636:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80363b:	89 d8                	mov    %ebx,%eax
+  80363d:	f7 e2                	mul    %edx
+  80363f:	c1 ea 0c             	shr    $0xc,%edx
+  803642:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803648:	39 d3                	cmp    %edx,%ebx
+  80364a:	0f 95 c3             	setne  %bl
+  80364d:	0f b6 db             	movzbl %bl,%ebx
+  803650:	eb b0                	jmp    803602 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803652:	8b 71 04             	mov    0x4(%ecx),%esi
+  803655:	8b 01                	mov    (%ecx),%eax
+  803657:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80365d:	29 c6                	sub    %eax,%esi
+  80365f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803664:	89 f0                	mov    %esi,%eax
+  803666:	f7 e2                	mul    %edx
+  803668:	c1 ea 0c             	shr    $0xc,%edx
+  80366b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803671:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803673:	89 d8                	mov    %ebx,%eax
+  803675:	83 c8 04             	or     $0x4,%eax
+  803678:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80367e:	0f 42 d8             	cmovb  %eax,%ebx
+  803681:	eb 87                	jmp    80360a <devpipe_poll+0x29>
+
+00803683 <pipe>:
+{
+  803683:	55                   	push   %ebp
+  803684:	89 e5                	mov    %esp,%ebp
+  803686:	56                   	push   %esi
+  803687:	53                   	push   %ebx
+  803688:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80368b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80368e:	50                   	push   %eax
+  80368f:	e8 38 e1 ff ff       	call   8017cc <fd_alloc>
+  803694:	89 c3                	mov    %eax,%ebx
+  803696:	83 c4 10             	add    $0x10,%esp
+  803699:	85 c0                	test   %eax,%eax
+  80369b:	0f 88 23 01 00 00    	js     8037c4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036a1:	83 ec 04             	sub    $0x4,%esp
+  8036a4:	68 07 04 00 00       	push   $0x407
+  8036a9:	ff 75 f4             	push   -0xc(%ebp)
+  8036ac:	6a 00                	push   $0x0
+  8036ae:	e8 57 d9 ff ff       	call   80100a <sys_page_alloc>
+  8036b3:	89 c3                	mov    %eax,%ebx
+  8036b5:	83 c4 10             	add    $0x10,%esp
+  8036b8:	85 c0                	test   %eax,%eax
+  8036ba:	0f 88 04 01 00 00    	js     8037c4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8036c0:	83 ec 0c             	sub    $0xc,%esp
+  8036c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8036c6:	50                   	push   %eax
+  8036c7:	e8 00 e1 ff ff       	call   8017cc <fd_alloc>
+  8036cc:	89 c3                	mov    %eax,%ebx
+  8036ce:	83 c4 10             	add    $0x10,%esp
+  8036d1:	85 c0                	test   %eax,%eax
+  8036d3:	0f 88 db 00 00 00    	js     8037b4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036d9:	83 ec 04             	sub    $0x4,%esp
+  8036dc:	68 07 04 00 00       	push   $0x407
+  8036e1:	ff 75 f0             	push   -0x10(%ebp)
+  8036e4:	6a 00                	push   $0x0
+  8036e6:	e8 1f d9 ff ff       	call   80100a <sys_page_alloc>
+  8036eb:	89 c3                	mov    %eax,%ebx
+  8036ed:	83 c4 10             	add    $0x10,%esp
+  8036f0:	85 c0                	test   %eax,%eax
+  8036f2:	0f 88 bc 00 00 00    	js     8037b4 <pipe+0x131>
+	va = fd2data(fd0);
+  8036f8:	83 ec 0c             	sub    $0xc,%esp
+  8036fb:	ff 75 f4             	push   -0xc(%ebp)
+  8036fe:	e8 b2 e0 ff ff       	call   8017b5 <fd2data>
+  803703:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803705:	83 c4 0c             	add    $0xc,%esp
+  803708:	68 07 04 00 00       	push   $0x407
+  80370d:	50                   	push   %eax
+  80370e:	6a 00                	push   $0x0
+  803710:	e8 f5 d8 ff ff       	call   80100a <sys_page_alloc>
+  803715:	89 c3                	mov    %eax,%ebx
+  803717:	83 c4 10             	add    $0x10,%esp
+  80371a:	85 c0                	test   %eax,%eax
+  80371c:	0f 88 82 00 00 00    	js     8037a4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803722:	83 ec 0c             	sub    $0xc,%esp
+  803725:	ff 75 f0             	push   -0x10(%ebp)
+  803728:	e8 88 e0 ff ff       	call   8017b5 <fd2data>
+  80372d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803734:	50                   	push   %eax
+  803735:	6a 00                	push   $0x0
+  803737:	56                   	push   %esi
+  803738:	6a 00                	push   $0x0
+  80373a:	e8 0e d9 ff ff       	call   80104d <sys_page_map>
+  80373f:	89 c3                	mov    %eax,%ebx
+  803741:	83 c4 20             	add    $0x20,%esp
+  803744:	85 c0                	test   %eax,%eax
+  803746:	78 4e                	js     803796 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803748:	a1 60 50 80 00       	mov    0x805060,%eax
+  80374d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803750:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803752:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803755:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80375c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80375f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803761:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803764:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80376b:	83 ec 0c             	sub    $0xc,%esp
+  80376e:	ff 75 f4             	push   -0xc(%ebp)
+  803771:	e8 2f e0 ff ff       	call   8017a5 <fd2num>
+  803776:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803779:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80377b:	83 c4 04             	add    $0x4,%esp
+  80377e:	ff 75 f0             	push   -0x10(%ebp)
+  803781:	e8 1f e0 ff ff       	call   8017a5 <fd2num>
+  803786:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803789:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80378c:	83 c4 10             	add    $0x10,%esp
+  80378f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803794:	eb 2e                	jmp    8037c4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803796:	83 ec 08             	sub    $0x8,%esp
+  803799:	56                   	push   %esi
+  80379a:	6a 00                	push   $0x0
+  80379c:	e8 ee d8 ff ff       	call   80108f <sys_page_unmap>
+  8037a1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8037a4:	83 ec 08             	sub    $0x8,%esp
+  8037a7:	ff 75 f0             	push   -0x10(%ebp)
+  8037aa:	6a 00                	push   $0x0
+  8037ac:	e8 de d8 ff ff       	call   80108f <sys_page_unmap>
+  8037b1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8037b4:	83 ec 08             	sub    $0x8,%esp
+  8037b7:	ff 75 f4             	push   -0xc(%ebp)
+  8037ba:	6a 00                	push   $0x0
+  8037bc:	e8 ce d8 ff ff       	call   80108f <sys_page_unmap>
+  8037c1:	83 c4 10             	add    $0x10,%esp
+}
+  8037c4:	89 d8                	mov    %ebx,%eax
+  8037c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037c9:	5b                   	pop    %ebx
+  8037ca:	5e                   	pop    %esi
+  8037cb:	5d                   	pop    %ebp
+  8037cc:	c3                   	ret
+
+008037cd <pipeisclosed>:
+{
+  8037cd:	55                   	push   %ebp
+  8037ce:	89 e5                	mov    %esp,%ebp
+  8037d0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8037d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037d6:	50                   	push   %eax
+  8037d7:	ff 75 08             	push   0x8(%ebp)
+  8037da:	e8 3d e0 ff ff       	call   80181c <fd_lookup>
+  8037df:	83 c4 10             	add    $0x10,%esp
+  8037e2:	85 c0                	test   %eax,%eax
+  8037e4:	78 18                	js     8037fe <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8037e6:	83 ec 0c             	sub    $0xc,%esp
+  8037e9:	ff 75 f4             	push   -0xc(%ebp)
+  8037ec:	e8 c4 df ff ff       	call   8017b5 <fd2data>
+  8037f1:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8037f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037f6:	e8 e6 f9 ff ff       	call   8031e1 <_pipeisclosed>
+  8037fb:	83 c4 10             	add    $0x10,%esp
+}
+  8037fe:	c9                   	leave
+  8037ff:	c3                   	ret
+
+00803800 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803800:	55                   	push   %ebp
+  803801:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803803:	8b 45 08             	mov    0x8(%ebp),%eax
+  803806:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80380c:	5d                   	pop    %ebp
+  80380d:	c3                   	ret
+
+0080380e <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80380e:	55                   	push   %ebp
+  80380f:	89 e5                	mov    %esp,%ebp
+  803811:	53                   	push   %ebx
+  803812:	83 ec 04             	sub    $0x4,%esp
+  803815:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803818:	8b 03                	mov    (%ebx),%eax
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	75 05                	jne    803823 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80381e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803821:	c9                   	leave
+  803822:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803823:	83 ec 08             	sub    $0x8,%esp
+  803826:	50                   	push   %eax
+  803827:	8d 43 04             	lea    0x4(%ebx),%eax
+  80382a:	50                   	push   %eax
+  80382b:	e8 af da ff ff       	call   8012df <sys_page_batch>
+	pb->pb_n = 0;
+  803830:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803836:	83 c4 10             	add    $0x10,%esp
+  803839:	eb e3                	jmp    80381e <pgbatch_flush+0x10>
+
+0080383b <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80383b:	55                   	push   %ebp
+  80383c:	89 e5                	mov    %esp,%ebp
+  80383e:	56                   	push   %esi
+  80383f:	53                   	push   %ebx
+  803840:	89 c3                	mov    %eax,%ebx
+  803842:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803844:	83 38 20             	cmpl   $0x20,(%eax)
+  803847:	74 2c                	je     803875 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803849:	8b 03                	mov    (%ebx),%eax
+  80384b:	8d 50 01             	lea    0x1(%eax),%edx
+  80384e:	89 13                	mov    %edx,(%ebx)
+  803850:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803853:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803857:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803859:	83 ec 04             	sub    $0x4,%esp
+  80385c:	6a 18                	push   $0x18
+  80385e:	6a 00                	push   $0x0
+  803860:	50                   	push   %eax
+  803861:	e8 eb d4 ff ff       	call   800d51 <memset>
+	return 0;
+  803866:	83 c4 10             	add    $0x10,%esp
+  803869:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80386e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803871:	5b                   	pop    %ebx
+  803872:	5e                   	pop    %esi
+  803873:	5d                   	pop    %ebp
+  803874:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803875:	83 ec 0c             	sub    $0xc,%esp
+  803878:	50                   	push   %eax
+  803879:	e8 90 ff ff ff       	call   80380e <pgbatch_flush>
+  80387e:	83 c4 10             	add    $0x10,%esp
+  803881:	85 c0                	test   %eax,%eax
+  803883:	79 c4                	jns    803849 <pgbatch_slot+0xe>
+  803885:	eb e7                	jmp    80386e <pgbatch_slot+0x33>
+
+00803887 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803887:	55                   	push   %ebp
+  803888:	89 e5                	mov    %esp,%ebp
+  80388a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80388d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803890:	8b 45 08             	mov    0x8(%ebp),%eax
+  803893:	e8 a3 ff ff ff       	call   80383b <pgbatch_slot>
+  803898:	85 c0                	test   %eax,%eax
+  80389a:	78 20                	js     8038bc <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  80389c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80389f:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8038a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8038a8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8038ab:	8b 55 10             	mov    0x10(%ebp),%edx
+  8038ae:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8038b1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8038b4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8038b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038bc:	c9                   	leave
+  8038bd:	c3                   	ret
+
+008038be <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8038be:	55                   	push   %ebp
+  8038bf:	89 e5                	mov    %esp,%ebp
+  8038c1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8038c4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8038c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038ca:	e8 6c ff ff ff       	call   80383b <pgbatch_slot>
+  8038cf:	85 c0                	test   %eax,%eax
+  8038d1:	78 2c                	js     8038ff <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8038d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038d6:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8038dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8038df:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8038e2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8038e5:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8038e8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8038eb:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8038ee:	8b 55 18             	mov    0x18(%ebp),%edx
+  8038f1:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8038f4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8038f7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8038fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ff:	c9                   	leave
+  803900:	c3                   	ret
+
+00803901 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803901:	55                   	push   %ebp
+  803902:	89 e5                	mov    %esp,%ebp
+  803904:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803907:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80390a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80390d:	e8 29 ff ff ff       	call   80383b <pgbatch_slot>
+  803912:	85 c0                	test   %eax,%eax
+  803914:	78 1a                	js     803930 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803916:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803919:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80391f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803922:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803925:	8b 55 10             	mov    0x10(%ebp),%edx
+  803928:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80392b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803930:	c9                   	leave
+  803931:	c3                   	ret
+
+00803932 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803932:	55                   	push   %ebp
+  803933:	89 e5                	mov    %esp,%ebp
+  803935:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803938:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80393b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80393e:	e8 f8 fe ff ff       	call   80383b <pgbatch_slot>
+  803943:	85 c0                	test   %eax,%eax
+  803945:	78 20                	js     803967 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803947:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80394a:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803950:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803953:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803956:	8b 55 10             	mov    0x10(%ebp),%edx
+  803959:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80395c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80395f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803962:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803967:	c9                   	leave
+  803968:	c3                   	ret
+
+00803969 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803969:	55                   	push   %ebp
+  80396a:	89 e5                	mov    %esp,%ebp
+  80396c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80396f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803972:	8b 45 08             	mov    0x8(%ebp),%eax
+  803975:	e8 c1 fe ff ff       	call   80383b <pgbatch_slot>
+  80397a:	85 c0                	test   %eax,%eax
+  80397c:	78 26                	js     8039a4 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80397e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803981:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803987:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80398a:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  80398d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803990:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803993:	8b 55 14             	mov    0x14(%ebp),%edx
+  803996:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803999:	8b 55 18             	mov    0x18(%ebp),%edx
+  80399c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80399f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a4:	c9                   	leave
+  8039a5:	c3                   	ret
+
+008039a6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8039a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ab:	c3                   	ret
+
+008039ac <devcons_poll>:
+{
+  8039ac:	55                   	push   %ebp
+  8039ad:	89 e5                	mov    %esp,%ebp
+  8039af:	53                   	push   %ebx
+  8039b0:	83 ec 04             	sub    $0x4,%esp
+  8039b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8039b6:	89 da                	mov    %ebx,%edx
+  8039b8:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8039bb:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  8039c2:	74 0c                	je     8039d0 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8039c4:	89 d8                	mov    %ebx,%eax
+  8039c6:	83 e0 01             	and    $0x1,%eax
+  8039c9:	09 d0                	or     %edx,%eax
+}
+  8039cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039ce:	c9                   	leave
+  8039cf:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8039d0:	e8 97 d5 ff ff       	call   800f6c <sys_cgetc>
+  8039d5:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8039da:	89 da                	mov    %ebx,%edx
+  8039dc:	83 e2 04             	and    $0x4,%edx
+  8039df:	85 c0                	test   %eax,%eax
+  8039e1:	74 e6                	je     8039c9 <devcons_poll+0x1d>
+  8039e3:	eb df                	jmp    8039c4 <devcons_poll+0x18>
+
+008039e5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8039e5:	55                   	push   %ebp
+  8039e6:	89 e5                	mov    %esp,%ebp
+  8039e8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8039eb:	68 96 47 80 00       	push   $0x804796
+  8039f0:	ff 75 0c             	push   0xc(%ebp)
+  8039f3:	e8 de d1 ff ff       	call   800bd6 <strcpy>
+	return 0;
+}
+  8039f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039fd:	c9                   	leave
+  8039fe:	c3                   	ret
+
+008039ff <devcons_write>:
+{
+  8039ff:	55                   	push   %ebp
+  803a00:	89 e5                	mov    %esp,%ebp
+  803a02:	57                   	push   %edi
+  803a03:	56                   	push   %esi
+  803a04:	53                   	push   %ebx
+  803a05:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803a0b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803a0e:	85 ff                	test   %edi,%edi
+  803a10:	74 51                	je     803a63 <devcons_write+0x64>
+  803a12:	be 00 00 00 00       	mov    $0x0,%esi
+  803a17:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803a1c:	89 fb                	mov    %edi,%ebx
+  803a1e:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803a20:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803a25:	39 d3                	cmp    %edx,%ebx
+  803a27:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803a2a:	83 ec 04             	sub    $0x4,%esp
+  803a2d:	53                   	push   %ebx
+  803a2e:	03 45 0c             	add    0xc(%ebp),%eax
+  803a31:	50                   	push   %eax
+  803a32:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803a38:	50                   	push   %eax
+  803a39:	e8 48 d3 ff ff       	call   800d86 <memmove>
+		sys_cputs(buf, m);
+  803a3e:	83 c4 08             	add    $0x8,%esp
+  803a41:	53                   	push   %ebx
+  803a42:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803a48:	50                   	push   %eax
+  803a49:	e8 00 d5 ff ff       	call   800f4e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803a4e:	01 de                	add    %ebx,%esi
+  803a50:	89 f0                	mov    %esi,%eax
+  803a52:	83 c4 10             	add    $0x10,%esp
+  803a55:	39 fe                	cmp    %edi,%esi
+  803a57:	72 c3                	jb     803a1c <devcons_write+0x1d>
+}
+  803a59:	89 f0                	mov    %esi,%eax
+  803a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a5e:	5b                   	pop    %ebx
+  803a5f:	5e                   	pop    %esi
+  803a60:	5f                   	pop    %edi
+  803a61:	5d                   	pop    %ebp
+  803a62:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803a63:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803a68:	eb ef                	jmp    803a59 <devcons_write+0x5a>
+
+00803a6a <devcons_read>:
+{
+  803a6a:	55                   	push   %ebp
+  803a6b:	89 e5                	mov    %esp,%ebp
+  803a6d:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803a70:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803a75:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a79:	74 36                	je     803ab1 <devcons_read+0x47>
+	c = cons_peek;
+  803a7b:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  803a80:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  803a87:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803a8a:	85 c0                	test   %eax,%eax
+  803a8c:	75 10                	jne    803a9e <devcons_read+0x34>
+  803a8e:	e8 d9 d4 ff ff       	call   800f6c <sys_cgetc>
+  803a93:	85 c0                	test   %eax,%eax
+  803a95:	75 07                	jne    803a9e <devcons_read+0x34>
+		sys_yield();
+  803a97:	e8 4f d5 ff ff       	call   800feb <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803a9c:	eb f0                	jmp    803a8e <devcons_read+0x24>
+	if (c < 0)
+  803a9e:	85 c0                	test   %eax,%eax
+  803aa0:	78 0f                	js     803ab1 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803aa2:	83 f8 04             	cmp    $0x4,%eax
+  803aa5:	74 0c                	je     803ab3 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803aa7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803aaa:	88 02                	mov    %al,(%edx)
+	return 1;
+  803aac:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803ab1:	c9                   	leave
+  803ab2:	c3                   	ret
+		return 0;
+  803ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab8:	eb f7                	jmp    803ab1 <devcons_read+0x47>
+
+00803aba <cputchar>:
+{
+  803aba:	55                   	push   %ebp
+  803abb:	89 e5                	mov    %esp,%ebp
+  803abd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803ac0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803ac6:	6a 01                	push   $0x1
+  803ac8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803acb:	50                   	push   %eax
+  803acc:	e8 7d d4 ff ff       	call   800f4e <sys_cputs>
+}
+  803ad1:	83 c4 10             	add    $0x10,%esp
+  803ad4:	c9                   	leave
+  803ad5:	c3                   	ret
+
+00803ad6 <getchar>:
+{
+  803ad6:	55                   	push   %ebp
+  803ad7:	89 e5                	mov    %esp,%ebp
+  803ad9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803adc:	6a 01                	push   $0x1
+  803ade:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803ae1:	50                   	push   %eax
+  803ae2:	6a 00                	push   $0x0
+  803ae4:	e8 b7 df ff ff       	call   801aa0 <read>
+	if (r < 0)
+  803ae9:	83 c4 10             	add    $0x10,%esp
+  803aec:	85 c0                	test   %eax,%eax
+  803aee:	78 06                	js     803af6 <getchar+0x20>
+	if (r < 1)
+  803af0:	74 06                	je     803af8 <getchar+0x22>
+	return c;
+  803af2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803af6:	c9                   	leave
+  803af7:	c3                   	ret
+		return -E_EOF;
+  803af8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803afd:	eb f7                	jmp    803af6 <getchar+0x20>
+
+00803aff <iscons>:
+{
+  803aff:	55                   	push   %ebp
+  803b00:	89 e5                	mov    %esp,%ebp
+  803b02:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b08:	50                   	push   %eax
+  803b09:	ff 75 08             	push   0x8(%ebp)
+  803b0c:	e8 0b dd ff ff       	call   80181c <fd_lookup>
+  803b11:	83 c4 10             	add    $0x10,%esp
+  803b14:	85 c0                	test   %eax,%eax
+  803b16:	78 11                	js     803b29 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803b18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b1b:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803b21:	39 10                	cmp    %edx,(%eax)
+  803b23:	0f 94 c0             	sete   %al
+  803b26:	0f b6 c0             	movzbl %al,%eax
+}
+  803b29:	c9                   	leave
+  803b2a:	c3                   	ret
+
+00803b2b <opencons>:
+{
+  803b2b:	55                   	push   %ebp
+  803b2c:	89 e5                	mov    %esp,%ebp
+  803b2e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803b31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b34:	50                   	push   %eax
+  803b35:	e8 92 dc ff ff       	call   8017cc <fd_alloc>
+  803b3a:	83 c4 10             	add    $0x10,%esp
+  803b3d:	85 c0                	test   %eax,%eax
+  803b3f:	78 3a                	js     803b7b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803b41:	83 ec 04             	sub    $0x4,%esp
+  803b44:	68 07 04 00 00       	push   $0x407
+  803b49:	ff 75 f4             	push   -0xc(%ebp)
+  803b4c:	6a 00                	push   $0x0
+  803b4e:	e8 b7 d4 ff ff       	call   80100a <sys_page_alloc>
+  803b53:	83 c4 10             	add    $0x10,%esp
+  803b56:	85 c0                	test   %eax,%eax
+  803b58:	78 21                	js     803b7b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803b5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b5d:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803b63:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803b65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b68:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803b6f:	83 ec 0c             	sub    $0xc,%esp
+  803b72:	50                   	push   %eax
+  803b73:	e8 2d dc ff ff       	call   8017a5 <fd2num>
+  803b78:	83 c4 10             	add    $0x10,%esp
+}
+  803b7b:	c9                   	leave
+  803b7c:	c3                   	ret
+
+00803b7d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803b7d:	55                   	push   %ebp
+  803b7e:	89 e5                	mov    %esp,%ebp
+  803b80:	56                   	push   %esi
+  803b81:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803b82:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803b85:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803b8b:	e8 3c d4 ff ff       	call   800fcc <sys_getenvid>
+  803b90:	83 ec 0c             	sub    $0xc,%esp
+  803b93:	ff 75 0c             	push   0xc(%ebp)
+  803b96:	ff 75 08             	push   0x8(%ebp)
+  803b99:	56                   	push   %esi
+  803b9a:	50                   	push   %eax
+  803b9b:	68 a4 47 80 00       	push   $0x8047a4
+  803ba0:	e8 3a c9 ff ff       	call   8004df <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803ba5:	83 c4 18             	add    $0x18,%esp
+  803ba8:	53                   	push   %ebx
+  803ba9:	ff 75 10             	push   0x10(%ebp)
+  803bac:	e8 dd c8 ff ff       	call   80048e <vcprintf>
+	cprintf("\n");
+  803bb1:	c7 04 24 88 47 80 00 	movl   $0x804788,(%esp)
+  803bb8:	e8 22 c9 ff ff       	call   8004df <cprintf>
+  803bbd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803bc0:	cc                   	int3
+	while (1)
+  803bc1:	eb fd                	jmp    803bc0 <_panic+0x43>
+
+00803bc3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803bc3:	55                   	push   %ebp
+  803bc4:	89 e5                	mov    %esp,%ebp
+  803bc6:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803bc9:	89 c2                	mov    %eax,%edx
+  803bcb:	c1 ea 16             	shr    $0x16,%edx
+  803bce:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803bda:	f6 c1 01             	test   $0x1,%cl
+  803bdd:	74 1e                	je     803bfd <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803bdf:	c1 e8 0c             	shr    $0xc,%eax
+  803be2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803be9:	a8 01                	test   $0x1,%al
+  803beb:	74 10                	je     803bfd <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803bed:	c1 e8 0c             	shr    $0xc,%eax
+  803bf0:	c1 e0 04             	shl    $0x4,%eax
+  803bf3:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803bfa:	0f b7 d2             	movzwl %dx,%edx
+}
+  803bfd:	89 d0                	mov    %edx,%eax
+  803bff:	5d                   	pop    %ebp
+  803c00:	c3                   	ret
+
+00803c01 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  803c01:	55                   	push   %ebp
+  803c02:	89 e5                	mov    %esp,%ebp
+  803c04:	57                   	push   %edi
+  803c05:	56                   	push   %esi
+  803c06:	53                   	push   %ebx
+  803c07:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  803c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c0d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  803c10:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  803c13:	bf 38 63 80 00       	mov    $0x806338,%edi
+  803c18:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  803c1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c20:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803c23:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  803c26:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803c2b:	f6 e2                	mul    %dl
+  803c2d:	66 c1 e8 0b          	shr    $0xb,%ax
+  803c31:	89 c7                	mov    %eax,%edi
+  803c33:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803c36:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803c39:	01 db                	add    %ebx,%ebx
+  803c3b:	89 d0                	mov    %edx,%eax
+  803c3d:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  803c3f:	89 d6                	mov    %edx,%esi
+  803c41:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  803c43:	89 cb                	mov    %ecx,%ebx
+  803c45:	83 c1 01             	add    $0x1,%ecx
+  803c48:	0f b6 fb             	movzbl %bl,%edi
+  803c4b:	83 c0 30             	add    $0x30,%eax
+  803c4e:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  803c52:	89 f0                	mov    %esi,%eax
+  803c54:	3c 09                	cmp    $0x9,%al
+  803c56:	77 ce                	ja     803c26 <inet_ntoa+0x25>
+  803c58:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803c5b:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803c5e:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  803c60:	84 c9                	test   %cl,%cl
+  803c62:	74 4d                	je     803cb1 <inet_ntoa+0xb0>
+  803c64:	0f b6 db             	movzbl %bl,%ebx
+  803c67:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803c6a:	01 d8                	add    %ebx,%eax
+  803c6c:	89 f9                	mov    %edi,%ecx
+  803c6e:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  803c71:	83 c1 01             	add    $0x1,%ecx
+  803c74:	0f b6 10             	movzbl (%eax),%edx
+  803c77:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  803c7a:	89 c2                	mov    %eax,%edx
+  803c7c:	83 e8 01             	sub    $0x1,%eax
+  803c7f:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803c82:	39 da                	cmp    %ebx,%edx
+  803c84:	75 eb                	jne    803c71 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  803c86:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803c89:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  803c8d:	8d 78 01             	lea    0x1(%eax),%edi
+  803c90:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  803c93:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  803c96:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803c99:	39 ce                	cmp    %ecx,%esi
+  803c9b:	0f 85 77 ff ff ff    	jne    803c18 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  803ca1:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  803ca4:	b8 38 63 80 00       	mov    $0x806338,%eax
+  803ca9:	83 c4 1c             	add    $0x1c,%esp
+  803cac:	5b                   	pop    %ebx
+  803cad:	5e                   	pop    %esi
+  803cae:	5f                   	pop    %edi
+  803caf:	5d                   	pop    %ebp
+  803cb0:	c3                   	ret
+    while(i--)
+  803cb1:	89 f8                	mov    %edi,%eax
+  803cb3:	eb d8                	jmp    803c8d <inet_ntoa+0x8c>
+
+00803cb5 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  803cb5:	55                   	push   %ebp
+  803cb6:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803cb8:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803cbc:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  803cc0:	5d                   	pop    %ebp
+  803cc1:	c3                   	ret
+
+00803cc2 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  803cc2:	55                   	push   %ebp
+  803cc3:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803cc5:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803cc9:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  803ccd:	5d                   	pop    %ebp
+  803cce:	c3                   	ret
+
+00803ccf <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  803ccf:	55                   	push   %ebp
+  803cd0:	89 e5                	mov    %esp,%ebp
+  803cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  803cd5:	89 d0                	mov    %edx,%eax
+  803cd7:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  803cda:	89 d1                	mov    %edx,%ecx
+  803cdc:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803cdf:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  803ce1:	89 d1                	mov    %edx,%ecx
+  803ce3:	c1 e1 08             	shl    $0x8,%ecx
+  803ce6:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803cec:	09 c8                	or     %ecx,%eax
+  803cee:	c1 ea 08             	shr    $0x8,%edx
+  803cf1:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803cf7:	09 d0                	or     %edx,%eax
+}
+  803cf9:	5d                   	pop    %ebp
+  803cfa:	c3                   	ret
+
+00803cfb <inet_aton>:
+{
+  803cfb:	55                   	push   %ebp
+  803cfc:	89 e5                	mov    %esp,%ebp
+  803cfe:	57                   	push   %edi
+  803cff:	56                   	push   %esi
+  803d00:	53                   	push   %ebx
+  803d01:	83 ec 2c             	sub    $0x2c,%esp
+  803d04:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  803d07:	0f b6 0a             	movzbl (%edx),%ecx
+  803d0a:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803d0d:	83 e9 30             	sub    $0x30,%ecx
+  803d10:	80 f9 09             	cmp    $0x9,%cl
+  803d13:	0f 87 b6 01 00 00    	ja     803ecf <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  803d19:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  803d1c:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803d1f:	e9 aa 00 00 00       	jmp    803dce <inet_aton+0xd3>
+      c = *++cp;
+  803d24:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  803d28:	89 c1                	mov    %eax,%ecx
+  803d2a:	83 e1 df             	and    $0xffffffdf,%ecx
+  803d2d:	80 f9 58             	cmp    $0x58,%cl
+  803d30:	74 10                	je     803d42 <inet_aton+0x47>
+      c = *++cp;
+  803d32:	83 c2 01             	add    $0x1,%edx
+  803d35:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  803d38:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d3d:	e9 9a 00 00 00       	jmp    803ddc <inet_aton+0xe1>
+        c = *++cp;
+  803d42:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803d46:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  803d49:	bf 10 00 00 00       	mov    $0x10,%edi
+  803d4e:	e9 89 00 00 00       	jmp    803ddc <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  803d53:	0f af d7             	imul   %edi,%edx
+  803d56:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  803d5a:	0f be 01             	movsbl (%ecx),%eax
+  803d5d:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  803d60:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803d63:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803d66:	80 fb 09             	cmp    $0x9,%bl
+  803d69:	76 e8                	jbe    803d53 <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  803d6b:	83 ff 10             	cmp    $0x10,%edi
+  803d6e:	75 2e                	jne    803d9e <inet_aton+0xa3>
+  803d70:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803d74:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803d77:	83 e3 df             	and    $0xffffffdf,%ebx
+  803d7a:	83 eb 41             	sub    $0x41,%ebx
+  803d7d:	80 fb 05             	cmp    $0x5,%bl
+  803d80:	77 1c                	ja     803d9e <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  803d82:	c1 e2 04             	shl    $0x4,%edx
+  803d85:	83 c0 0a             	add    $0xa,%eax
+  803d88:	89 f3                	mov    %esi,%ebx
+  803d8a:	80 fb 1a             	cmp    $0x1a,%bl
+  803d8d:	19 db                	sbb    %ebx,%ebx
+  803d8f:	83 e3 20             	and    $0x20,%ebx
+  803d92:	83 c3 41             	add    $0x41,%ebx
+  803d95:	29 d8                	sub    %ebx,%eax
+  803d97:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  803d99:	0f be 01             	movsbl (%ecx),%eax
+  803d9c:	eb bf                	jmp    803d5d <inet_aton+0x62>
+    if (c == '.') {
+  803d9e:	83 f8 2e             	cmp    $0x2e,%eax
+  803da1:	75 46                	jne    803de9 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  803da3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803da6:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803da9:	39 f0                	cmp    %esi,%eax
+  803dab:	0f 84 25 01 00 00    	je     803ed6 <inet_aton+0x1db>
+      *pp++ = val;
+  803db1:	83 c0 04             	add    $0x4,%eax
+  803db4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803db7:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  803dba:	89 ca                	mov    %ecx,%edx
+  803dbc:	0f b6 09             	movzbl (%ecx),%ecx
+  803dbf:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803dc2:	83 e9 30             	sub    $0x30,%ecx
+  803dc5:	80 f9 09             	cmp    $0x9,%cl
+  803dc8:	0f 87 17 01 00 00    	ja     803ee5 <inet_aton+0x1ea>
+    base = 10;
+  803dce:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  803dd3:	83 f8 30             	cmp    $0x30,%eax
+  803dd6:	0f 84 48 ff ff ff    	je     803d24 <inet_aton+0x29>
+  803ddc:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  803ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803de4:	e9 77 ff ff ff       	jmp    803d60 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803de9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803ded:	89 d6                	mov    %edx,%esi
+  803def:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803df2:	85 c0                	test   %eax,%eax
+  803df4:	74 2e                	je     803e24 <inet_aton+0x129>
+    return (0);
+  803df6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803dfb:	89 fa                	mov    %edi,%edx
+  803dfd:	80 fa 1f             	cmp    $0x1f,%dl
+  803e00:	0f 86 d5 00 00 00    	jbe    803edb <inet_aton+0x1e0>
+  803e06:	84 c0                	test   %al,%al
+  803e08:	0f 88 cd 00 00 00    	js     803edb <inet_aton+0x1e0>
+  803e0e:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803e11:	83 f9 04             	cmp    $0x4,%ecx
+  803e14:	76 0e                	jbe    803e24 <inet_aton+0x129>
+    return (0);
+  803e16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803e1b:	83 f8 20             	cmp    $0x20,%eax
+  803e1e:	0f 85 b7 00 00 00    	jne    803edb <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  803e24:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803e27:	89 d8                	mov    %ebx,%eax
+  803e29:	29 c8                	sub    %ecx,%eax
+  803e2b:	c1 f8 02             	sar    $0x2,%eax
+  803e2e:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  803e31:	83 f8 02             	cmp    $0x2,%eax
+  803e34:	74 7a                	je     803eb0 <inet_aton+0x1b5>
+  803e36:	83 f9 03             	cmp    $0x3,%ecx
+  803e39:	7f 49                	jg     803e84 <inet_aton+0x189>
+  803e3b:	85 c9                	test   %ecx,%ecx
+  803e3d:	0f 84 98 00 00 00    	je     803edb <inet_aton+0x1e0>
+  803e43:	83 f9 02             	cmp    $0x2,%ecx
+  803e46:	75 19                	jne    803e61 <inet_aton+0x166>
+      return (0);
+  803e48:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  803e4d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803e53:	0f 87 82 00 00 00    	ja     803edb <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  803e59:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803e5c:	c1 e0 18             	shl    $0x18,%eax
+  803e5f:	09 c6                	or     %eax,%esi
+  return (1);
+  803e61:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  803e66:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803e6a:	74 6f                	je     803edb <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  803e6c:	83 ec 0c             	sub    $0xc,%esp
+  803e6f:	56                   	push   %esi
+  803e70:	e8 5a fe ff ff       	call   803ccf <htonl>
+  803e75:	83 c4 10             	add    $0x10,%esp
+  803e78:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803e7b:	89 06                	mov    %eax,(%esi)
+  return (1);
+  803e7d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803e82:	eb 57                	jmp    803edb <inet_aton+0x1e0>
+  switch (n) {
+  803e84:	83 f9 04             	cmp    $0x4,%ecx
+  803e87:	75 d8                	jne    803e61 <inet_aton+0x166>
+      return (0);
+  803e89:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  803e8e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803e94:	77 45                	ja     803edb <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  803e96:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803e99:	c1 e0 18             	shl    $0x18,%eax
+  803e9c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803e9f:	c1 e1 10             	shl    $0x10,%ecx
+  803ea2:	09 c8                	or     %ecx,%eax
+  803ea4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803ea7:	c1 e1 08             	shl    $0x8,%ecx
+  803eaa:	09 c8                	or     %ecx,%eax
+  803eac:	09 c6                	or     %eax,%esi
+    break;
+  803eae:	eb b1                	jmp    803e61 <inet_aton+0x166>
+      return (0);
+  803eb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  803eb5:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803ebb:	77 1e                	ja     803edb <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  803ebd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803ec0:	c1 e0 18             	shl    $0x18,%eax
+  803ec3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803ec6:	c1 e1 10             	shl    $0x10,%ecx
+  803ec9:	09 c8                	or     %ecx,%eax
+  803ecb:	09 c6                	or     %eax,%esi
+    break;
+  803ecd:	eb 92                	jmp    803e61 <inet_aton+0x166>
+      return (0);
+  803ecf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ed4:	eb 05                	jmp    803edb <inet_aton+0x1e0>
+        return (0);
+  803ed6:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  803edb:	89 c8                	mov    %ecx,%eax
+  803edd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ee0:	5b                   	pop    %ebx
+  803ee1:	5e                   	pop    %esi
+  803ee2:	5f                   	pop    %edi
+  803ee3:	5d                   	pop    %ebp
+  803ee4:	c3                   	ret
+      return (0);
+  803ee5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803eea:	eb ef                	jmp    803edb <inet_aton+0x1e0>
+
+00803eec <inet_addr>:
+{
+  803eec:	55                   	push   %ebp
+  803eed:	89 e5                	mov    %esp,%ebp
+  803eef:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  803ef2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ef5:	50                   	push   %eax
+  803ef6:	ff 75 08             	push   0x8(%ebp)
+  803ef9:	e8 fd fd ff ff       	call   803cfb <inet_aton>
+  803efe:	89 c2                	mov    %eax,%edx
+  803f00:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  803f03:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  803f08:	85 d2                	test   %edx,%edx
+  803f0a:	75 02                	jne    803f0e <inet_addr+0x22>
+}
+  803f0c:	c9                   	leave
+  803f0d:	c3                   	ret
+    return (val.s_addr);
+  803f0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f11:	eb f9                	jmp    803f0c <inet_addr+0x20>
+
+00803f13 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  803f13:	55                   	push   %ebp
+  803f14:	89 e5                	mov    %esp,%ebp
+  803f16:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  803f19:	ff 75 08             	push   0x8(%ebp)
+  803f1c:	e8 ae fd ff ff       	call   803ccf <htonl>
+  803f21:	83 c4 10             	add    $0x10,%esp
+}
+  803f24:	c9                   	leave
+  803f25:	c3                   	ret
+
+00803f26 <__udivdi3>:
+  803f26:	57                   	push   %edi
+  803f27:	56                   	push   %esi
+  803f28:	53                   	push   %ebx
+  803f29:	83 ec 20             	sub    $0x20,%esp
+  803f2c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803f30:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803f34:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f38:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f3c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803f40:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803f44:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803f48:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803f4c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f56:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f5b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803f62:	00 
+  803f63:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803f6a:	00 
+  803f6b:	eb 08                	jmp    803f75 <__udivdi3+0x4f>
+  803f6d:	83 e9 01             	sub    $0x1,%ecx
+  803f70:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803f73:	74 68                	je     803fdd <__udivdi3+0xb7>
+  803f75:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803f79:	01 c0                	add    %eax,%eax
+  803f7b:	89 c6                	mov    %eax,%esi
+  803f7d:	89 d7                	mov    %edx,%edi
+  803f7f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f83:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f87:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f8a:	d3 ea                	shr    %cl,%edx
+  803f8c:	f6 c1 20             	test   $0x20,%cl
+  803f8f:	74 04                	je     803f95 <__udivdi3+0x6f>
+  803f91:	89 d0                	mov    %edx,%eax
+  803f93:	31 d2                	xor    %edx,%edx
+  803f95:	83 e0 01             	and    $0x1,%eax
+  803f98:	89 04 24             	mov    %eax,(%esp)
+  803f9b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803fa2:	00 
+  803fa3:	8b 04 24             	mov    (%esp),%eax
+  803fa6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803faa:	09 f0                	or     %esi,%eax
+  803fac:	09 fa                	or     %edi,%edx
+  803fae:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803fb2:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803fb6:	39 f0                	cmp    %esi,%eax
+  803fb8:	89 d3                	mov    %edx,%ebx
+  803fba:	19 fb                	sbb    %edi,%ebx
+  803fbc:	72 af                	jb     803f6d <__udivdi3+0x47>
+  803fbe:	29 f0                	sub    %esi,%eax
+  803fc0:	19 fa                	sbb    %edi,%edx
+  803fc2:	89 cf                	mov    %ecx,%edi
+  803fc4:	c1 ef 05             	shr    $0x5,%edi
+  803fc7:	83 e7 01             	and    $0x1,%edi
+  803fca:	89 fe                	mov    %edi,%esi
+  803fcc:	83 f6 01             	xor    $0x1,%esi
+  803fcf:	d3 e6                	shl    %cl,%esi
+  803fd1:	d3 e7                	shl    %cl,%edi
+  803fd3:	09 74 24 18          	or     %esi,0x18(%esp)
+  803fd7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803fdb:	eb 90                	jmp    803f6d <__udivdi3+0x47>
+  803fdd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803fe1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803fe5:	83 c4 20             	add    $0x20,%esp
+  803fe8:	5b                   	pop    %ebx
+  803fe9:	5e                   	pop    %esi
+  803fea:	5f                   	pop    %edi
+  803feb:	c3                   	ret
+
+00803fec <__umoddi3>:
+  803fec:	57                   	push   %edi
+  803fed:	56                   	push   %esi
+  803fee:	53                   	push   %ebx
+  803fef:	83 ec 08             	sub    $0x8,%esp
+  803ff2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ff6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ffa:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803ffe:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804002:	57                   	push   %edi
+  804003:	56                   	push   %esi
+  804004:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804008:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80400c:	52                   	push   %edx
+  80400d:	50                   	push   %eax
+  80400e:	e8 13 ff ff ff       	call   803f26 <__udivdi3>
+  804013:	89 c3                	mov    %eax,%ebx
+  804015:	0f af d6             	imul   %esi,%edx
+  804018:	89 f9                	mov    %edi,%ecx
+  80401a:	0f af cb             	imul   %ebx,%ecx
+  80401d:	01 d1                	add    %edx,%ecx
+  80401f:	89 d8                	mov    %ebx,%eax
+  804021:	f7 e6                	mul    %esi
+  804023:	89 c6                	mov    %eax,%esi
+  804025:	89 d7                	mov    %edx,%edi
+  804027:	01 cf                	add    %ecx,%edi
+  804029:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80402d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804031:	29 f0                	sub    %esi,%eax
+  804033:	19 fa                	sbb    %edi,%edx
+  804035:	83 c4 18             	add    $0x18,%esp
+  804038:	5b                   	pop    %ebx
+  804039:	5e                   	pop    %esi
+  80403a:	5f                   	pop    %edi
+  80403b:	c3                   	ret
+
+0080403c <__divdi3>:
+  80403c:	53                   	push   %ebx
+  80403d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804041:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804045:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804049:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80404d:	85 d2                	test   %edx,%edx
+  80404f:	78 12                	js     804063 <__divdi3+0x27>
+  804051:	85 db                	test   %ebx,%ebx
+  804053:	78 2e                	js     804083 <__divdi3+0x47>
+  804055:	53                   	push   %ebx
+  804056:	51                   	push   %ecx
+  804057:	52                   	push   %edx
+  804058:	50                   	push   %eax
+  804059:	e8 c8 fe ff ff       	call   803f26 <__udivdi3>
+  80405e:	83 c4 10             	add    $0x10,%esp
+  804061:	eb 1e                	jmp    804081 <__divdi3+0x45>
+  804063:	f7 d8                	neg    %eax
+  804065:	83 d2 00             	adc    $0x0,%edx
+  804068:	f7 da                	neg    %edx
+  80406a:	85 db                	test   %ebx,%ebx
+  80406c:	78 2a                	js     804098 <__divdi3+0x5c>
+  80406e:	53                   	push   %ebx
+  80406f:	51                   	push   %ecx
+  804070:	52                   	push   %edx
+  804071:	50                   	push   %eax
+  804072:	e8 af fe ff ff       	call   803f26 <__udivdi3>
+  804077:	83 c4 10             	add    $0x10,%esp
+  80407a:	f7 d8                	neg    %eax
+  80407c:	83 d2 00             	adc    $0x0,%edx
+  80407f:	f7 da                	neg    %edx
+  804081:	5b                   	pop    %ebx
+  804082:	c3                   	ret
+  804083:	f7 d9                	neg    %ecx
+  804085:	83 d3 00             	adc    $0x0,%ebx
+  804088:	f7 db                	neg    %ebx
+  80408a:	53                   	push   %ebx
+  80408b:	51                   	push   %ecx
+  80408c:	52                   	push   %edx
+  80408d:	50                   	push   %eax
+  80408e:	e8 93 fe ff ff       	call   803f26 <__udivdi3>
+  804093:	83 c4 10             	add    $0x10,%esp
+  804096:	eb e2                	jmp    80407a <__divdi3+0x3e>
+  804098:	f7 d9                	neg    %ecx
+  80409a:	83 d3 00             	adc    $0x0,%ebx
+  80409d:	f7 db                	neg    %ebx
+  80409f:	53                   	push   %ebx
+  8040a0:	51                   	push   %ecx
+  8040a1:	52                   	push   %edx
+  8040a2:	50                   	push   %eax
+  8040a3:	e8 7e fe ff ff       	call   803f26 <__udivdi3>
+  8040a8:	83 c4 10             	add    $0x10,%esp
+  8040ab:	eb d4                	jmp    804081 <__divdi3+0x45>
+
+008040ad <__moddi3>:
+  8040ad:	57                   	push   %edi
+  8040ae:	56                   	push   %esi
+  8040af:	53                   	push   %ebx
+  8040b0:	83 ec 08             	sub    $0x8,%esp
+  8040b3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8040b7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8040bb:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8040bf:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8040c3:	57                   	push   %edi
+  8040c4:	56                   	push   %esi
+  8040c5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8040c9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8040cd:	52                   	push   %edx
+  8040ce:	50                   	push   %eax
+  8040cf:	e8 68 ff ff ff       	call   80403c <__divdi3>
+  8040d4:	89 c3                	mov    %eax,%ebx
+  8040d6:	0f af d6             	imul   %esi,%edx
+  8040d9:	89 f9                	mov    %edi,%ecx
+  8040db:	0f af cb             	imul   %ebx,%ecx
+  8040de:	01 d1                	add    %edx,%ecx
+  8040e0:	89 d8                	mov    %ebx,%eax
+  8040e2:	f7 e6                	mul    %esi
+  8040e4:	89 c6                	mov    %eax,%esi
+  8040e6:	89 d7                	mov    %edx,%edi
+  8040e8:	01 cf                	add    %ecx,%edi
+  8040ea:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8040ee:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8040f2:	29 f0                	sub    %esi,%eax
+  8040f4:	19 fa                	sbb    %edi,%edx
+  8040f6:	83 c4 18             	add    $0x18,%esp
+  8040f9:	5b                   	pop    %ebx
+  8040fa:	5e                   	pop    %esi
+  8040fb:	5f                   	pop    %edi
+  8040fc:	c3                   	ret
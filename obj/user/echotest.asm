@@ -0,0 +1,8468 @@
+
+obj/user/echotest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ae 01 00 00       	call   8001df <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+
+const char *msg = "Hello world!\n";
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 40 3f 80 00       	push   $0x803f40
+  800041:	e8 d5 02 00 00       	call   80031b <cprintf>
+	exit();
+  800046:	e8 21 02 00 00       	call   80026c <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <umain>:
+
+void umain(int argc, char **argv)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	57                   	push   %edi
+  800054:	56                   	push   %esi
+  800055:	53                   	push   %ebx
+  800056:	83 ec 58             	sub    $0x58,%esp
+	struct sockaddr_in echoserver;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	cprintf("Connecting to:\n");
+  800059:	68 44 3f 80 00       	push   $0x803f44
+  80005e:	e8 b8 02 00 00       	call   80031b <cprintf>
+	cprintf("\tip address %s = %x\n", IPADDR, inet_addr(IPADDR));
+  800063:	c7 04 24 54 3f 80 00 	movl   $0x803f54,(%esp)
+  80006a:	e8 b9 3c 00 00       	call   803d28 <inet_addr>
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	50                   	push   %eax
+  800073:	68 54 3f 80 00       	push   $0x803f54
+  800078:	68 5e 3f 80 00       	push   $0x803f5e
+  80007d:	e8 99 02 00 00       	call   80031b <cprintf>
+
+	// Create the TCP socket
+	if ((sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800082:	83 c4 0c             	add    $0xc,%esp
+  800085:	6a 06                	push   $0x6
+  800087:	6a 01                	push   $0x1
+  800089:	6a 02                	push   $0x2
+  80008b:	e8 28 1f 00 00       	call   801fb8 <socket>
+  800090:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	0f 88 ba 00 00 00    	js     800158 <umain+0x108>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  80009e:	83 ec 0c             	sub    $0xc,%esp
+  8000a1:	68 8b 3f 80 00       	push   $0x803f8b
+  8000a6:	e8 70 02 00 00       	call   80031b <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  8000ab:	83 c4 0c             	add    $0xc,%esp
+  8000ae:	6a 10                	push   $0x10
+  8000b0:	6a 00                	push   $0x0
+  8000b2:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 d2 0a 00 00       	call   800b8d <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8000bb:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = inet_addr(IPADDR);   // IP address
+  8000bf:	c7 04 24 54 3f 80 00 	movl   $0x803f54,(%esp)
+  8000c6:	e8 5d 3c 00 00       	call   803d28 <inet_addr>
+  8000cb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  8000ce:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+  8000d5:	e8 17 3a 00 00       	call   803af1 <htons>
+  8000da:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to connect to server\n");
+  8000de:	c7 04 24 9a 3f 80 00 	movl   $0x803f9a,(%esp)
+  8000e5:	e8 31 02 00 00       	call   80031b <cprintf>
+
+	// Establish connection
+	if (connect(sock, (struct sockaddr *) &echoserver, sizeof(echoserver)) < 0)
+  8000ea:	83 c4 0c             	add    $0xc,%esp
+  8000ed:	6a 10                	push   $0x10
+  8000ef:	53                   	push   %ebx
+  8000f0:	ff 75 b4             	push   -0x4c(%ebp)
+  8000f3:	e8 68 1d 00 00       	call   801e60 <connect>
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	85 c0                	test   %eax,%eax
+  8000fd:	78 68                	js     800167 <umain+0x117>
+		die("Failed to connect with server");
+
+	cprintf("connected to server\n");
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	68 d5 3f 80 00       	push   $0x803fd5
+  800107:	e8 0f 02 00 00       	call   80031b <cprintf>
+
+	// Send the word to the server
+	echolen = strlen(msg);
+  80010c:	83 c4 04             	add    $0x4,%esp
+  80010f:	ff 35 00 50 80 00    	push   0x805000
+  800115:	e8 ac 08 00 00       	call   8009c6 <strlen>
+  80011a:	89 c6                	mov    %eax,%esi
+  80011c:	89 45 b0             	mov    %eax,-0x50(%ebp)
+	if (write(sock, msg, echolen) != echolen)
+  80011f:	83 c4 0c             	add    $0xc,%esp
+  800122:	50                   	push   %eax
+  800123:	ff 35 00 50 80 00    	push   0x805000
+  800129:	ff 75 b4             	push   -0x4c(%ebp)
+  80012c:	e8 6b 15 00 00       	call   80169c <write>
+  800131:	83 c4 10             	add    $0x10,%esp
+  800134:	39 c6                	cmp    %eax,%esi
+  800136:	75 3b                	jne    800173 <umain+0x123>
+		die("Mismatch in number of sent bytes");
+
+	// Receive the word back from the server
+	cprintf("Received: \n");
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	68 ea 3f 80 00       	push   $0x803fea
+  800140:	e8 d6 01 00 00       	call   80031b <cprintf>
+	while (received < echolen) {
+  800145:	83 c4 10             	add    $0x10,%esp
+  800148:	83 7d b0 00          	cmpl   $0x0,-0x50(%ebp)
+  80014c:	74 6e                	je     8001bc <umain+0x16c>
+	int received = 0;
+  80014e:	be 00 00 00 00       	mov    $0x0,%esi
+		int bytes = 0;
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800153:	8d 7d b8             	lea    -0x48(%ebp),%edi
+  800156:	eb 41                	jmp    800199 <umain+0x149>
+		die("Failed to create socket");
+  800158:	b8 73 3f 80 00       	mov    $0x803f73,%eax
+  80015d:	e8 d3 fe ff ff       	call   800035 <die>
+  800162:	e9 37 ff ff ff       	jmp    80009e <umain+0x4e>
+		die("Failed to connect with server");
+  800167:	b8 b7 3f 80 00       	mov    $0x803fb7,%eax
+  80016c:	e8 c4 fe ff ff       	call   800035 <die>
+  800171:	eb 8c                	jmp    8000ff <umain+0xaf>
+		die("Mismatch in number of sent bytes");
+  800173:	b8 04 40 80 00       	mov    $0x804004,%eax
+  800178:	e8 b8 fe ff ff       	call   800035 <die>
+  80017d:	eb b9                	jmp    800138 <umain+0xe8>
+			die("Failed to receive bytes from server");
+		}
+		received += bytes;
+  80017f:	01 de                	add    %ebx,%esi
+		buffer[bytes] = '\0';        // Assure null terminated string
+  800181:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+		cprintf(buffer);
+  800186:	83 ec 0c             	sub    $0xc,%esp
+  800189:	57                   	push   %edi
+  80018a:	e8 8c 01 00 00       	call   80031b <cprintf>
+	while (received < echolen) {
+  80018f:	83 c4 10             	add    $0x10,%esp
+  800192:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  800195:	39 c6                	cmp    %eax,%esi
+  800197:	73 23                	jae    8001bc <umain+0x16c>
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800199:	83 ec 04             	sub    $0x4,%esp
+  80019c:	6a 1f                	push   $0x1f
+  80019e:	57                   	push   %edi
+  80019f:	ff 75 b4             	push   -0x4c(%ebp)
+  8001a2:	e8 fd 13 00 00       	call   8015a4 <read>
+  8001a7:	89 c3                	mov    %eax,%ebx
+  8001a9:	83 c4 10             	add    $0x10,%esp
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	7f cf                	jg     80017f <umain+0x12f>
+			die("Failed to receive bytes from server");
+  8001b0:	b8 28 40 80 00       	mov    $0x804028,%eax
+  8001b5:	e8 7b fe ff ff       	call   800035 <die>
+  8001ba:	eb c3                	jmp    80017f <umain+0x12f>
+	}
+	cprintf("\n");
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	68 f4 3f 80 00       	push   $0x803ff4
+  8001c4:	e8 52 01 00 00       	call   80031b <cprintf>
+
+	close(sock);
+  8001c9:	83 c4 04             	add    $0x4,%esp
+  8001cc:	ff 75 b4             	push   -0x4c(%ebp)
+  8001cf:	e8 91 12 00 00       	call   801465 <close>
+}
+  8001d4:	83 c4 10             	add    $0x10,%esp
+  8001d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001da:	5b                   	pop    %ebx
+  8001db:	5e                   	pop    %esi
+  8001dc:	5f                   	pop    %edi
+  8001dd:	5d                   	pop    %ebp
+  8001de:	c3                   	ret
+
+008001df <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001df:	55                   	push   %ebp
+  8001e0:	89 e5                	mov    %esp,%ebp
+  8001e2:	56                   	push   %esi
+  8001e3:	53                   	push   %ebx
+  8001e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8001ea:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8001ec:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8001f1:	29 d0                	sub    %edx,%eax
+  8001f3:	89 c2                	mov    %eax,%edx
+  8001f5:	c1 ea 0f             	shr    $0xf,%edx
+  8001f8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8001fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800202:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800205:	c7 04 85 60 63 80 00 	movl   $0x0,0x806360(,%eax,4)
+  80020c:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800210:	e8 f3 0b 00 00       	call   800e08 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800215:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80021a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800220:	89 e1                	mov    %esp,%ecx
+  800222:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800227:	29 ca                	sub    %ecx,%edx
+  800229:	89 d1                	mov    %edx,%ecx
+  80022b:	c1 e9 0f             	shr    $0xf,%ecx
+  80022e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800234:	ba 00 00 00 00       	mov    $0x0,%edx
+  800239:	0f 42 d1             	cmovb  %ecx,%edx
+  80023c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800241:	89 04 95 60 63 80 00 	mov    %eax,0x806360(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800248:	85 db                	test   %ebx,%ebx
+  80024a:	7e 07                	jle    800253 <libmain+0x74>
+		binaryname = argv[0];
+  80024c:	8b 06                	mov    (%esi),%eax
+  80024e:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  800253:	83 ec 08             	sub    $0x8,%esp
+  800256:	56                   	push   %esi
+  800257:	53                   	push   %ebx
+  800258:	e8 f3 fd ff ff       	call   800050 <umain>
+
+	// exit gracefully
+	exit();
+  80025d:	e8 0a 00 00 00       	call   80026c <exit>
+}
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800268:	5b                   	pop    %ebx
+  800269:	5e                   	pop    %esi
+  80026a:	5d                   	pop    %ebp
+  80026b:	c3                   	ret
+
+0080026c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800272:	e8 1b 12 00 00       	call   801492 <close_all>
+	sys_env_destroy(0);
+  800277:	83 ec 0c             	sub    $0xc,%esp
+  80027a:	6a 00                	push   $0x0
+  80027c:	e8 46 0b 00 00       	call   800dc7 <sys_env_destroy>
+}
+  800281:	83 c4 10             	add    $0x10,%esp
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+00800286 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800286:	55                   	push   %ebp
+  800287:	89 e5                	mov    %esp,%ebp
+  800289:	53                   	push   %ebx
+  80028a:	83 ec 04             	sub    $0x4,%esp
+  80028d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800290:	8b 13                	mov    (%ebx),%edx
+  800292:	8d 42 01             	lea    0x1(%edx),%eax
+  800295:	89 03                	mov    %eax,(%ebx)
+  800297:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80029a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80029e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002a3:	74 09                	je     8002ae <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002ac:	c9                   	leave
+  8002ad:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ae:	83 ec 08             	sub    $0x8,%esp
+  8002b1:	68 ff 00 00 00       	push   $0xff
+  8002b6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b9:	50                   	push   %eax
+  8002ba:	e8 cb 0a 00 00       	call   800d8a <sys_cputs>
+		b->idx = 0;
+  8002bf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c5:	83 c4 10             	add    $0x10,%esp
+  8002c8:	eb db                	jmp    8002a5 <putch+0x1f>
+
+008002ca <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002d3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002da:	00 00 00 
+	b.cnt = 0;
+  8002dd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002e7:	ff 75 0c             	push   0xc(%ebp)
+  8002ea:	ff 75 08             	push   0x8(%ebp)
+  8002ed:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002f3:	50                   	push   %eax
+  8002f4:	68 86 02 80 00       	push   $0x800286
+  8002f9:	e8 1c 01 00 00       	call   80041a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002fe:	83 c4 08             	add    $0x8,%esp
+  800301:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800307:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80030d:	50                   	push   %eax
+  80030e:	e8 77 0a 00 00       	call   800d8a <sys_cputs>
+
+	return b.cnt;
+}
+  800313:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+
+0080031b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800321:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800324:	50                   	push   %eax
+  800325:	ff 75 08             	push   0x8(%ebp)
+  800328:	e8 9d ff ff ff       	call   8002ca <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80032d:	c9                   	leave
+  80032e:	c3                   	ret
+
+0080032f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	57                   	push   %edi
+  800333:	56                   	push   %esi
+  800334:	53                   	push   %ebx
+  800335:	83 ec 1c             	sub    $0x1c,%esp
+  800338:	89 c3                	mov    %eax,%ebx
+  80033a:	89 d6                	mov    %edx,%esi
+  80033c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800342:	89 d1                	mov    %edx,%ecx
+  800344:	89 c2                	mov    %eax,%edx
+  800346:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800349:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80034c:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80034f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800352:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800359:	39 c2                	cmp    %eax,%edx
+  80035b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80035e:	73 4b                	jae    8003ab <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800360:	8b 45 14             	mov    0x14(%ebp),%eax
+  800363:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800366:	85 ff                	test   %edi,%edi
+  800368:	7e 11                	jle    80037b <printnum+0x4c>
+			putch(padc, putdat);
+  80036a:	83 ec 08             	sub    $0x8,%esp
+  80036d:	56                   	push   %esi
+  80036e:	ff 75 18             	push   0x18(%ebp)
+  800371:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800373:	83 c4 10             	add    $0x10,%esp
+  800376:	83 ef 01             	sub    $0x1,%edi
+  800379:	75 ef                	jne    80036a <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80037b:	83 ec 08             	sub    $0x8,%esp
+  80037e:	56                   	push   %esi
+  80037f:	83 ec 04             	sub    $0x4,%esp
+  800382:	ff 75 e4             	push   -0x1c(%ebp)
+  800385:	ff 75 e0             	push   -0x20(%ebp)
+  800388:	ff 75 dc             	push   -0x24(%ebp)
+  80038b:	ff 75 d8             	push   -0x28(%ebp)
+  80038e:	e8 95 3a 00 00       	call   803e28 <__umoddi3>
+  800393:	83 c4 14             	add    $0x14,%esp
+  800396:	0f be 80 56 40 80 00 	movsbl 0x804056(%eax),%eax
+  80039d:	50                   	push   %eax
+  80039e:	ff d3                	call   *%ebx
+}
+  8003a0:	83 c4 10             	add    $0x10,%esp
+  8003a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a6:	5b                   	pop    %ebx
+  8003a7:	5e                   	pop    %esi
+  8003a8:	5f                   	pop    %edi
+  8003a9:	5d                   	pop    %ebp
+  8003aa:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003ab:	83 ec 0c             	sub    $0xc,%esp
+  8003ae:	ff 75 18             	push   0x18(%ebp)
+  8003b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b4:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003b7:	52                   	push   %edx
+  8003b8:	50                   	push   %eax
+  8003b9:	83 ec 08             	sub    $0x8,%esp
+  8003bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8003bf:	ff 75 e0             	push   -0x20(%ebp)
+  8003c2:	ff 75 dc             	push   -0x24(%ebp)
+  8003c5:	ff 75 d8             	push   -0x28(%ebp)
+  8003c8:	e8 95 39 00 00       	call   803d62 <__udivdi3>
+  8003cd:	83 c4 18             	add    $0x18,%esp
+  8003d0:	52                   	push   %edx
+  8003d1:	50                   	push   %eax
+  8003d2:	89 f2                	mov    %esi,%edx
+  8003d4:	89 d8                	mov    %ebx,%eax
+  8003d6:	e8 54 ff ff ff       	call   80032f <printnum>
+  8003db:	83 c4 20             	add    $0x20,%esp
+  8003de:	eb 9b                	jmp    80037b <printnum+0x4c>
+
+008003e0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003e0:	55                   	push   %ebp
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003e6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003ea:	8b 10                	mov    (%eax),%edx
+  8003ec:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003ef:	73 0a                	jae    8003fb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003f1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003f4:	89 08                	mov    %ecx,(%eax)
+  8003f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f9:	88 02                	mov    %al,(%edx)
+}
+  8003fb:	5d                   	pop    %ebp
+  8003fc:	c3                   	ret
+
+008003fd <printfmt>:
+{
+  8003fd:	55                   	push   %ebp
+  8003fe:	89 e5                	mov    %esp,%ebp
+  800400:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800403:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800406:	50                   	push   %eax
+  800407:	ff 75 10             	push   0x10(%ebp)
+  80040a:	ff 75 0c             	push   0xc(%ebp)
+  80040d:	ff 75 08             	push   0x8(%ebp)
+  800410:	e8 05 00 00 00       	call   80041a <vprintfmt>
+}
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	c9                   	leave
+  800419:	c3                   	ret
+
+0080041a <vprintfmt>:
+{
+  80041a:	55                   	push   %ebp
+  80041b:	89 e5                	mov    %esp,%ebp
+  80041d:	57                   	push   %edi
+  80041e:	56                   	push   %esi
+  80041f:	53                   	push   %ebx
+  800420:	83 ec 2c             	sub    $0x2c,%esp
+  800423:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800426:	89 df                	mov    %ebx,%edi
+  800428:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80042b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80042e:	8d 70 01             	lea    0x1(%eax),%esi
+  800431:	0f b6 00             	movzbl (%eax),%eax
+  800434:	83 f8 25             	cmp    $0x25,%eax
+  800437:	74 1e                	je     800457 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800439:	85 c0                	test   %eax,%eax
+  80043b:	0f 84 15 05 00 00    	je     800956 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800441:	83 ec 08             	sub    $0x8,%esp
+  800444:	53                   	push   %ebx
+  800445:	50                   	push   %eax
+  800446:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800448:	83 c6 01             	add    $0x1,%esi
+  80044b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044f:	83 c4 10             	add    $0x10,%esp
+  800452:	83 f8 25             	cmp    $0x25,%eax
+  800455:	75 e2                	jne    800439 <vprintfmt+0x1f>
+		padc = ' ';
+  800457:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80045b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800462:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800469:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800470:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800475:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800478:	8d 56 01             	lea    0x1(%esi),%edx
+  80047b:	0f b6 0e             	movzbl (%esi),%ecx
+  80047e:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800481:	3c 55                	cmp    $0x55,%al
+  800483:	0f 87 3b 04 00 00    	ja     8008c4 <vprintfmt+0x4aa>
+  800489:	0f b6 c0             	movzbl %al,%eax
+  80048c:	ff 24 85 c0 41 80 00 	jmp    *0x8041c0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800493:	89 75 10             	mov    %esi,0x10(%ebp)
+  800496:	eb 93                	jmp    80042b <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800498:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80049a:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80049e:	eb d8                	jmp    800478 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a0:	89 d6                	mov    %edx,%esi
+  8004a2:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004a6:	eb d0                	jmp    800478 <vprintfmt+0x5e>
+  8004a8:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8004ab:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8004b1:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8004b5:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004b8:	83 f9 09             	cmp    $0x9,%ecx
+  8004bb:	77 6f                	ja     80052c <vprintfmt+0x112>
+  8004bd:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8004c0:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8004c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8004ca:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8004cd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004d0:	83 fe 09             	cmp    $0x9,%esi
+  8004d3:	76 eb                	jbe    8004c0 <vprintfmt+0xa6>
+  8004d5:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8004d8:	89 d6                	mov    %edx,%esi
+  8004da:	eb 13                	jmp    8004ef <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8b 00                	mov    (%eax),%eax
+  8004e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004ea:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ed:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8004ef:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004f3:	79 83                	jns    800478 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8004f5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004fb:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800502:	e9 71 ff ff ff       	jmp    800478 <vprintfmt+0x5e>
+			if (width < 0)
+  800507:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80050a:	85 c9                	test   %ecx,%ecx
+  80050c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800511:	0f 49 c1             	cmovns %ecx,%eax
+  800514:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800517:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800519:	e9 5a ff ff ff       	jmp    800478 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80051e:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800520:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800527:	e9 4c ff ff ff       	jmp    800478 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80052c:	89 d6                	mov    %edx,%esi
+  80052e:	eb bf                	jmp    8004ef <vprintfmt+0xd5>
+			lflag++;
+  800530:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800534:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800536:	e9 3d ff ff ff       	jmp    800478 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80053b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8d 70 04             	lea    0x4(%eax),%esi
+  800544:	83 ec 08             	sub    $0x8,%esp
+  800547:	53                   	push   %ebx
+  800548:	ff 30                	push   (%eax)
+  80054a:	ff d7                	call   *%edi
+			break;
+  80054c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80054f:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800552:	e9 d4 fe ff ff       	jmp    80042b <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800557:	89 55 10             	mov    %edx,0x10(%ebp)
+  80055a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055d:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800560:	8b 10                	mov    (%eax),%edx
+  800562:	89 d0                	mov    %edx,%eax
+  800564:	f7 d8                	neg    %eax
+  800566:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800569:	83 f8 12             	cmp    $0x12,%eax
+  80056c:	7f 23                	jg     800591 <vprintfmt+0x177>
+  80056e:	8b 14 85 20 43 80 00 	mov    0x804320(,%eax,4),%edx
+  800575:	85 d2                	test   %edx,%edx
+  800577:	74 18                	je     800591 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800579:	52                   	push   %edx
+  80057a:	68 7b 44 80 00       	push   $0x80447b
+  80057f:	53                   	push   %ebx
+  800580:	57                   	push   %edi
+  800581:	e8 77 fe ff ff       	call   8003fd <printfmt>
+  800586:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800589:	89 75 14             	mov    %esi,0x14(%ebp)
+  80058c:	e9 9a fe ff ff       	jmp    80042b <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800591:	50                   	push   %eax
+  800592:	68 6e 40 80 00       	push   $0x80406e
+  800597:	53                   	push   %ebx
+  800598:	57                   	push   %edi
+  800599:	e8 5f fe ff ff       	call   8003fd <printfmt>
+  80059e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005a1:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005a4:	e9 82 fe ff ff       	jmp    80042b <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	83 c0 04             	add    $0x4,%eax
+  8005b2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 00                	mov    (%eax),%eax
+  8005ba:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005bd:	85 c0                	test   %eax,%eax
+  8005bf:	0f 84 61 03 00 00    	je     800926 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8005c5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005c9:	7e 06                	jle    8005d1 <vprintfmt+0x1b7>
+  8005cb:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005cf:	75 29                	jne    8005fa <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005d1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005d4:	8d 70 01             	lea    0x1(%eax),%esi
+  8005d7:	0f b6 00             	movzbl (%eax),%eax
+  8005da:	0f be d0             	movsbl %al,%edx
+  8005dd:	85 d2                	test   %edx,%edx
+  8005df:	0f 84 bb 00 00 00    	je     8006a0 <vprintfmt+0x286>
+  8005e5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005e8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005eb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005ee:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005f1:	eb 7a                	jmp    80066d <vprintfmt+0x253>
+				p = "(null)";
+  8005f3:	c7 45 d0 67 40 80 00 	movl   $0x804067,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005fa:	83 ec 08             	sub    $0x8,%esp
+  8005fd:	ff 75 d4             	push   -0x2c(%ebp)
+  800600:	ff 75 d0             	push   -0x30(%ebp)
+  800603:	e8 e0 03 00 00       	call   8009e8 <strnlen>
+  800608:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80060b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80060e:	83 c4 10             	add    $0x10,%esp
+  800611:	85 d2                	test   %edx,%edx
+  800613:	0f 8e d6 02 00 00    	jle    8008ef <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800619:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80061d:	83 ec 08             	sub    $0x8,%esp
+  800620:	53                   	push   %ebx
+  800621:	56                   	push   %esi
+  800622:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800624:	83 c4 10             	add    $0x10,%esp
+  800627:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80062b:	75 f0                	jne    80061d <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80062d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800630:	8d 70 01             	lea    0x1(%eax),%esi
+  800633:	0f b6 00             	movzbl (%eax),%eax
+  800636:	0f be d0             	movsbl %al,%edx
+  800639:	85 d2                	test   %edx,%edx
+  80063b:	0f 84 da 02 00 00    	je     80091b <vprintfmt+0x501>
+  800641:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800644:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800647:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80064a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80064d:	eb 1e                	jmp    80066d <vprintfmt+0x253>
+					putch(ch, putdat);
+  80064f:	83 ec 08             	sub    $0x8,%esp
+  800652:	ff 75 0c             	push   0xc(%ebp)
+  800655:	52                   	push   %edx
+  800656:	ff 55 08             	call   *0x8(%ebp)
+  800659:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80065c:	83 eb 01             	sub    $0x1,%ebx
+  80065f:	83 c6 01             	add    $0x1,%esi
+  800662:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800666:	0f be d0             	movsbl %al,%edx
+  800669:	85 d2                	test   %edx,%edx
+  80066b:	74 2a                	je     800697 <vprintfmt+0x27d>
+  80066d:	85 ff                	test   %edi,%edi
+  80066f:	78 05                	js     800676 <vprintfmt+0x25c>
+  800671:	83 ef 01             	sub    $0x1,%edi
+  800674:	78 59                	js     8006cf <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800676:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80067a:	74 d3                	je     80064f <vprintfmt+0x235>
+  80067c:	0f be c0             	movsbl %al,%eax
+  80067f:	83 e8 20             	sub    $0x20,%eax
+  800682:	83 f8 5e             	cmp    $0x5e,%eax
+  800685:	76 c8                	jbe    80064f <vprintfmt+0x235>
+					putch('?', putdat);
+  800687:	83 ec 08             	sub    $0x8,%esp
+  80068a:	ff 75 0c             	push   0xc(%ebp)
+  80068d:	6a 3f                	push   $0x3f
+  80068f:	ff 55 08             	call   *0x8(%ebp)
+  800692:	83 c4 10             	add    $0x10,%esp
+  800695:	eb c5                	jmp    80065c <vprintfmt+0x242>
+  800697:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80069a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80069d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8006a0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006a3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006a7:	7e 1b                	jle    8006c4 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8006a9:	83 ec 08             	sub    $0x8,%esp
+  8006ac:	53                   	push   %ebx
+  8006ad:	6a 20                	push   $0x20
+  8006af:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006b1:	83 c4 10             	add    $0x10,%esp
+  8006b4:	83 ee 01             	sub    $0x1,%esi
+  8006b7:	75 f0                	jne    8006a9 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006b9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bf:	e9 67 fd ff ff       	jmp    80042b <vprintfmt+0x11>
+  8006c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ca:	e9 5c fd ff ff       	jmp    80042b <vprintfmt+0x11>
+  8006cf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006d8:	eb c6                	jmp    8006a0 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8006da:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006dd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006e0:	83 f9 01             	cmp    $0x1,%ecx
+  8006e3:	7f 1f                	jg     800704 <vprintfmt+0x2ea>
+	else if (lflag)
+  8006e5:	85 c9                	test   %ecx,%ecx
+  8006e7:	74 67                	je     800750 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8006e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ec:	8b 30                	mov    (%eax),%esi
+  8006ee:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006f1:	89 f0                	mov    %esi,%eax
+  8006f3:	c1 f8 1f             	sar    $0x1f,%eax
+  8006f6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  800702:	eb 17                	jmp    80071b <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 50 04             	mov    0x4(%eax),%edx
+  80070a:	8b 00                	mov    (%eax),%eax
+  80070c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800712:	8b 45 14             	mov    0x14(%ebp),%eax
+  800715:	8d 40 08             	lea    0x8(%eax),%eax
+  800718:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80071b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80071e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800721:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800726:	85 c9                	test   %ecx,%ecx
+  800728:	0f 89 12 01 00 00    	jns    800840 <vprintfmt+0x426>
+				putch('-', putdat);
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	53                   	push   %ebx
+  800732:	6a 2d                	push   $0x2d
+  800734:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800736:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800739:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80073c:	f7 da                	neg    %edx
+  80073e:	83 d1 00             	adc    $0x0,%ecx
+  800741:	f7 d9                	neg    %ecx
+  800743:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800746:	be 0a 00 00 00       	mov    $0xa,%esi
+  80074b:	e9 f0 00 00 00       	jmp    800840 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 30                	mov    (%eax),%esi
+  800755:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800758:	89 f0                	mov    %esi,%eax
+  80075a:	c1 f8 1f             	sar    $0x1f,%eax
+  80075d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8d 40 04             	lea    0x4(%eax),%eax
+  800766:	89 45 14             	mov    %eax,0x14(%ebp)
+  800769:	eb b0                	jmp    80071b <vprintfmt+0x301>
+	if (lflag >= 2)
+  80076b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80076e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800771:	83 f9 01             	cmp    $0x1,%ecx
+  800774:	7f 1e                	jg     800794 <vprintfmt+0x37a>
+	else if (lflag)
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	74 32                	je     8007ac <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80078a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80078f:	e9 ac 00 00 00       	jmp    800840 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800794:	8b 45 14             	mov    0x14(%ebp),%eax
+  800797:	8b 10                	mov    (%eax),%edx
+  800799:	8b 48 04             	mov    0x4(%eax),%ecx
+  80079c:	8d 40 08             	lea    0x8(%eax),%eax
+  80079f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a2:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8007a7:	e9 94 00 00 00       	jmp    800840 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8b 10                	mov    (%eax),%edx
+  8007b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007bc:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8007c1:	eb 7d                	jmp    800840 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8007c3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007c6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007c9:	83 f9 01             	cmp    $0x1,%ecx
+  8007cc:	7f 1b                	jg     8007e9 <vprintfmt+0x3cf>
+	else if (lflag)
+  8007ce:	85 c9                	test   %ecx,%ecx
+  8007d0:	74 2c                	je     8007fe <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8b 10                	mov    (%eax),%edx
+  8007d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007e2:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8007e7:	eb 57                	jmp    800840 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ec:	8b 10                	mov    (%eax),%edx
+  8007ee:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f7:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8007fc:	eb 42                	jmp    800840 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800801:	8b 10                	mov    (%eax),%edx
+  800803:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800808:	8d 40 04             	lea    0x4(%eax),%eax
+  80080b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80080e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800813:	eb 2b                	jmp    800840 <vprintfmt+0x426>
+			putch('0', putdat);
+  800815:	89 55 10             	mov    %edx,0x10(%ebp)
+  800818:	83 ec 08             	sub    $0x8,%esp
+  80081b:	53                   	push   %ebx
+  80081c:	6a 30                	push   $0x30
+  80081e:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800820:	83 c4 08             	add    $0x8,%esp
+  800823:	53                   	push   %ebx
+  800824:	6a 78                	push   $0x78
+  800826:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800828:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082b:	8b 10                	mov    (%eax),%edx
+  80082d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800832:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800835:	8d 40 04             	lea    0x4(%eax),%eax
+  800838:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80083b:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800840:	83 ec 0c             	sub    $0xc,%esp
+  800843:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800847:	50                   	push   %eax
+  800848:	ff 75 e4             	push   -0x1c(%ebp)
+  80084b:	56                   	push   %esi
+  80084c:	51                   	push   %ecx
+  80084d:	52                   	push   %edx
+  80084e:	89 da                	mov    %ebx,%edx
+  800850:	89 f8                	mov    %edi,%eax
+  800852:	e8 d8 fa ff ff       	call   80032f <printnum>
+			break;
+  800857:	83 c4 20             	add    $0x20,%esp
+  80085a:	e9 cc fb ff ff       	jmp    80042b <vprintfmt+0x11>
+	if (lflag >= 2)
+  80085f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800862:	89 55 10             	mov    %edx,0x10(%ebp)
+  800865:	83 f9 01             	cmp    $0x1,%ecx
+  800868:	7f 1b                	jg     800885 <vprintfmt+0x46b>
+	else if (lflag)
+  80086a:	85 c9                	test   %ecx,%ecx
+  80086c:	74 2c                	je     80089a <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80086e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800871:	8b 10                	mov    (%eax),%edx
+  800873:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800878:	8d 40 04             	lea    0x4(%eax),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087e:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800883:	eb bb                	jmp    800840 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800885:	8b 45 14             	mov    0x14(%ebp),%eax
+  800888:	8b 10                	mov    (%eax),%edx
+  80088a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80088d:	8d 40 08             	lea    0x8(%eax),%eax
+  800890:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800893:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800898:	eb a6                	jmp    800840 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80089a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089d:	8b 10                	mov    (%eax),%edx
+  80089f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008aa:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8008af:	eb 8f                	jmp    800840 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8008b1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b4:	83 ec 08             	sub    $0x8,%esp
+  8008b7:	53                   	push   %ebx
+  8008b8:	6a 25                	push   $0x25
+  8008ba:	ff d7                	call   *%edi
+			break;
+  8008bc:	83 c4 10             	add    $0x10,%esp
+  8008bf:	e9 67 fb ff ff       	jmp    80042b <vprintfmt+0x11>
+			putch('%', putdat);
+  8008c4:	83 ec 08             	sub    $0x8,%esp
+  8008c7:	53                   	push   %ebx
+  8008c8:	6a 25                	push   $0x25
+  8008ca:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008cc:	83 c4 10             	add    $0x10,%esp
+  8008cf:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008d3:	0f 84 ba fb ff ff    	je     800493 <vprintfmt+0x79>
+  8008d9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008dc:	89 f0                	mov    %esi,%eax
+  8008de:	83 e8 01             	sub    $0x1,%eax
+  8008e1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008e5:	75 f7                	jne    8008de <vprintfmt+0x4c4>
+  8008e7:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008ea:	e9 3c fb ff ff       	jmp    80042b <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ef:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008f2:	8d 70 01             	lea    0x1(%eax),%esi
+  8008f5:	0f b6 00             	movzbl (%eax),%eax
+  8008f8:	0f be d0             	movsbl %al,%edx
+  8008fb:	85 d2                	test   %edx,%edx
+  8008fd:	74 11                	je     800910 <vprintfmt+0x4f6>
+  8008ff:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800902:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800905:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800908:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80090b:	e9 5d fd ff ff       	jmp    80066d <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800910:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800913:	89 45 14             	mov    %eax,0x14(%ebp)
+  800916:	e9 10 fb ff ff       	jmp    80042b <vprintfmt+0x11>
+  80091b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80091e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800921:	e9 05 fb ff ff       	jmp    80042b <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800926:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80092a:	7e 0a                	jle    800936 <vprintfmt+0x51c>
+  80092c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800930:	0f 85 bd fc ff ff    	jne    8005f3 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800936:	ba 28 00 00 00       	mov    $0x28,%edx
+  80093b:	b8 28 00 00 00       	mov    $0x28,%eax
+  800940:	be 68 40 80 00       	mov    $0x804068,%esi
+  800945:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800948:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80094b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80094e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800951:	e9 17 fd ff ff       	jmp    80066d <vprintfmt+0x253>
+}
+  800956:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800959:	5b                   	pop    %ebx
+  80095a:	5e                   	pop    %esi
+  80095b:	5f                   	pop    %edi
+  80095c:	5d                   	pop    %ebp
+  80095d:	c3                   	ret
+
+0080095e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	83 ec 18             	sub    $0x18,%esp
+  800964:	8b 45 08             	mov    0x8(%ebp),%eax
+  800967:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80096a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80096d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800971:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800974:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80097b:	85 c0                	test   %eax,%eax
+  80097d:	74 26                	je     8009a5 <vsnprintf+0x47>
+  80097f:	85 d2                	test   %edx,%edx
+  800981:	7e 22                	jle    8009a5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800983:	ff 75 14             	push   0x14(%ebp)
+  800986:	ff 75 10             	push   0x10(%ebp)
+  800989:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80098c:	50                   	push   %eax
+  80098d:	68 e0 03 80 00       	push   $0x8003e0
+  800992:	e8 83 fa ff ff       	call   80041a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800997:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80099a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80099d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009a0:	83 c4 10             	add    $0x10,%esp
+}
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+		return -E_INVAL;
+  8009a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009aa:	eb f7                	jmp    8009a3 <vsnprintf+0x45>
+
+008009ac <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009ac:	55                   	push   %ebp
+  8009ad:	89 e5                	mov    %esp,%ebp
+  8009af:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009b2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009b5:	50                   	push   %eax
+  8009b6:	ff 75 10             	push   0x10(%ebp)
+  8009b9:	ff 75 0c             	push   0xc(%ebp)
+  8009bc:	ff 75 08             	push   0x8(%ebp)
+  8009bf:	e8 9a ff ff ff       	call   80095e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009c4:	c9                   	leave
+  8009c5:	c3                   	ret
+
+008009c6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009cc:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009cf:	74 10                	je     8009e1 <strlen+0x1b>
+  8009d1:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8009d6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009d9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009dd:	75 f7                	jne    8009d6 <strlen+0x10>
+	return n;
+}
+  8009df:	5d                   	pop    %ebp
+  8009e0:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8009e1:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8009e6:	eb f7                	jmp    8009df <strlen+0x19>
+
+008009e8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009f1:	85 d2                	test   %edx,%edx
+  8009f3:	74 16                	je     800a0b <strnlen+0x23>
+  8009f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fa:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009fe:	74 09                	je     800a09 <strnlen+0x21>
+		n++;
+  800a00:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a03:	39 d0                	cmp    %edx,%eax
+  800a05:	75 f3                	jne    8009fa <strnlen+0x12>
+		n++;
+  800a07:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a10:	eb f7                	jmp    800a09 <strnlen+0x21>
+
+00800a12 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	53                   	push   %ebx
+  800a16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a21:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a25:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a28:	83 c0 01             	add    $0x1,%eax
+  800a2b:	84 d2                	test   %dl,%dl
+  800a2d:	75 f2                	jne    800a21 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a2f:	89 c8                	mov    %ecx,%eax
+  800a31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a34:	c9                   	leave
+  800a35:	c3                   	ret
+
+00800a36 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	53                   	push   %ebx
+  800a3a:	83 ec 10             	sub    $0x10,%esp
+  800a3d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a40:	53                   	push   %ebx
+  800a41:	e8 80 ff ff ff       	call   8009c6 <strlen>
+  800a46:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a49:	ff 75 0c             	push   0xc(%ebp)
+  800a4c:	01 d8                	add    %ebx,%eax
+  800a4e:	50                   	push   %eax
+  800a4f:	e8 be ff ff ff       	call   800a12 <strcpy>
+	return dst;
+}
+  800a54:	89 d8                	mov    %ebx,%eax
+  800a56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a59:	c9                   	leave
+  800a5a:	c3                   	ret
+
+00800a5b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	56                   	push   %esi
+  800a5f:	53                   	push   %ebx
+  800a60:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a69:	85 db                	test   %ebx,%ebx
+  800a6b:	74 17                	je     800a84 <strncpy+0x29>
+  800a6d:	01 f3                	add    %esi,%ebx
+  800a6f:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a71:	83 c0 01             	add    $0x1,%eax
+  800a74:	0f b6 0a             	movzbl (%edx),%ecx
+  800a77:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a7a:	80 f9 01             	cmp    $0x1,%cl
+  800a7d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a80:	39 c3                	cmp    %eax,%ebx
+  800a82:	75 ed                	jne    800a71 <strncpy+0x16>
+	}
+	return ret;
+}
+  800a84:	89 f0                	mov    %esi,%eax
+  800a86:	5b                   	pop    %ebx
+  800a87:	5e                   	pop    %esi
+  800a88:	5d                   	pop    %ebp
+  800a89:	c3                   	ret
+
+00800a8a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a8a:	55                   	push   %ebp
+  800a8b:	89 e5                	mov    %esp,%ebp
+  800a8d:	56                   	push   %esi
+  800a8e:	53                   	push   %ebx
+  800a8f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a92:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a98:	89 f0                	mov    %esi,%eax
+  800a9a:	85 db                	test   %ebx,%ebx
+  800a9c:	74 1e                	je     800abc <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a9e:	83 eb 01             	sub    $0x1,%ebx
+  800aa1:	74 16                	je     800ab9 <strlcpy+0x2f>
+  800aa3:	01 f3                	add    %esi,%ebx
+  800aa5:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa8:	84 c9                	test   %cl,%cl
+  800aaa:	74 0d                	je     800ab9 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800aac:	83 c2 01             	add    $0x1,%edx
+  800aaf:	83 c0 01             	add    $0x1,%eax
+  800ab2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ab5:	39 d8                	cmp    %ebx,%eax
+  800ab7:	75 ec                	jne    800aa5 <strlcpy+0x1b>
+		*dst = '\0';
+  800ab9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800abc:	29 f0                	sub    %esi,%eax
+}
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5d                   	pop    %ebp
+  800ac1:	c3                   	ret
+
+00800ac2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ac2:	55                   	push   %ebp
+  800ac3:	89 e5                	mov    %esp,%ebp
+  800ac5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800acb:	0f b6 01             	movzbl (%ecx),%eax
+  800ace:	84 c0                	test   %al,%al
+  800ad0:	74 11                	je     800ae3 <strcmp+0x21>
+  800ad2:	38 02                	cmp    %al,(%edx)
+  800ad4:	75 0d                	jne    800ae3 <strcmp+0x21>
+		p++, q++;
+  800ad6:	83 c1 01             	add    $0x1,%ecx
+  800ad9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800adc:	0f b6 01             	movzbl (%ecx),%eax
+  800adf:	84 c0                	test   %al,%al
+  800ae1:	75 ef                	jne    800ad2 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae3:	0f b6 c0             	movzbl %al,%eax
+  800ae6:	0f b6 12             	movzbl (%edx),%edx
+  800ae9:	29 d0                	sub    %edx,%eax
+}
+  800aeb:	5d                   	pop    %ebp
+  800aec:	c3                   	ret
+
+00800aed <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	53                   	push   %ebx
+  800af1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800af7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800aff:	85 d2                	test   %edx,%edx
+  800b01:	74 2e                	je     800b31 <strncmp+0x44>
+  800b03:	0f b6 01             	movzbl (%ecx),%eax
+  800b06:	84 c0                	test   %al,%al
+  800b08:	74 16                	je     800b20 <strncmp+0x33>
+  800b0a:	3a 03                	cmp    (%ebx),%al
+  800b0c:	75 12                	jne    800b20 <strncmp+0x33>
+		n--, p++, q++;
+  800b0e:	83 c1 01             	add    $0x1,%ecx
+  800b11:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b14:	83 ea 01             	sub    $0x1,%edx
+  800b17:	75 ea                	jne    800b03 <strncmp+0x16>
+		return 0;
+  800b19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1e:	eb 11                	jmp    800b31 <strncmp+0x44>
+  800b20:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b25:	85 d2                	test   %edx,%edx
+  800b27:	74 08                	je     800b31 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b29:	0f b6 01             	movzbl (%ecx),%eax
+  800b2c:	0f b6 13             	movzbl (%ebx),%edx
+  800b2f:	29 d0                	sub    %edx,%eax
+}
+  800b31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b34:	c9                   	leave
+  800b35:	c3                   	ret
+
+00800b36 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b36:	55                   	push   %ebp
+  800b37:	89 e5                	mov    %esp,%ebp
+  800b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b40:	0f b6 10             	movzbl (%eax),%edx
+  800b43:	84 d2                	test   %dl,%dl
+  800b45:	74 15                	je     800b5c <strchr+0x26>
+		if (*s == c)
+  800b47:	38 d1                	cmp    %dl,%cl
+  800b49:	74 0f                	je     800b5a <strchr+0x24>
+	for (; *s; s++)
+  800b4b:	83 c0 01             	add    $0x1,%eax
+  800b4e:	0f b6 10             	movzbl (%eax),%edx
+  800b51:	84 d2                	test   %dl,%dl
+  800b53:	75 f2                	jne    800b47 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b5a:	5d                   	pop    %ebp
+  800b5b:	c3                   	ret
+	return 0;
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b61:	eb f7                	jmp    800b5a <strchr+0x24>
+
+00800b63 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	53                   	push   %ebx
+  800b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b6d:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b70:	38 d3                	cmp    %dl,%bl
+  800b72:	74 14                	je     800b88 <strfind+0x25>
+  800b74:	89 d1                	mov    %edx,%ecx
+  800b76:	84 db                	test   %bl,%bl
+  800b78:	74 0e                	je     800b88 <strfind+0x25>
+	for (; *s; s++)
+  800b7a:	83 c0 01             	add    $0x1,%eax
+  800b7d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b80:	38 ca                	cmp    %cl,%dl
+  800b82:	74 04                	je     800b88 <strfind+0x25>
+  800b84:	84 d2                	test   %dl,%dl
+  800b86:	75 f2                	jne    800b7a <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b8b:	c9                   	leave
+  800b8c:	c3                   	ret
+
+00800b8d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b8d:	55                   	push   %ebp
+  800b8e:	89 e5                	mov    %esp,%ebp
+  800b90:	57                   	push   %edi
+  800b91:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b94:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b97:	85 c9                	test   %ecx,%ecx
+  800b99:	74 20                	je     800bbb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b9b:	89 f8                	mov    %edi,%eax
+  800b9d:	09 c8                	or     %ecx,%eax
+  800b9f:	a8 03                	test   $0x3,%al
+  800ba1:	75 12                	jne    800bb5 <memset+0x28>
+		c &= 0xFF;
+  800ba3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ba7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bad:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bb0:	fc                   	cld
+  800bb1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bb3:	eb 06                	jmp    800bbb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb8:	fc                   	cld
+  800bb9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bbb:	89 f8                	mov    %edi,%eax
+  800bbd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bc0:	c9                   	leave
+  800bc1:	c3                   	ret
+
+00800bc2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	57                   	push   %edi
+  800bc6:	56                   	push   %esi
+  800bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bca:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bcd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bd0:	39 c6                	cmp    %eax,%esi
+  800bd2:	73 32                	jae    800c06 <memmove+0x44>
+  800bd4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bd7:	39 d0                	cmp    %edx,%eax
+  800bd9:	73 2b                	jae    800c06 <memmove+0x44>
+		s += n;
+		d += n;
+  800bdb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bde:	89 d6                	mov    %edx,%esi
+  800be0:	09 fe                	or     %edi,%esi
+  800be2:	09 ce                	or     %ecx,%esi
+  800be4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bea:	75 0e                	jne    800bfa <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bec:	83 ef 04             	sub    $0x4,%edi
+  800bef:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bf2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bf5:	fd                   	std
+  800bf6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bf8:	eb 09                	jmp    800c03 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bfa:	83 ef 01             	sub    $0x1,%edi
+  800bfd:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c00:	fd                   	std
+  800c01:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c03:	fc                   	cld
+  800c04:	eb 1a                	jmp    800c20 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c06:	89 f2                	mov    %esi,%edx
+  800c08:	09 c2                	or     %eax,%edx
+  800c0a:	09 ca                	or     %ecx,%edx
+  800c0c:	f6 c2 03             	test   $0x3,%dl
+  800c0f:	75 0a                	jne    800c1b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c11:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c14:	89 c7                	mov    %eax,%edi
+  800c16:	fc                   	cld
+  800c17:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c19:	eb 05                	jmp    800c20 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c1b:	89 c7                	mov    %eax,%edi
+  800c1d:	fc                   	cld
+  800c1e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c20:	5e                   	pop    %esi
+  800c21:	5f                   	pop    %edi
+  800c22:	5d                   	pop    %ebp
+  800c23:	c3                   	ret
+
+00800c24 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c2a:	ff 75 10             	push   0x10(%ebp)
+  800c2d:	ff 75 0c             	push   0xc(%ebp)
+  800c30:	ff 75 08             	push   0x8(%ebp)
+  800c33:	e8 8a ff ff ff       	call   800bc2 <memmove>
+}
+  800c38:	c9                   	leave
+  800c39:	c3                   	ret
+
+00800c3a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	56                   	push   %esi
+  800c3e:	53                   	push   %ebx
+  800c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c42:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c45:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c48:	85 f6                	test   %esi,%esi
+  800c4a:	74 29                	je     800c75 <memcmp+0x3b>
+  800c4c:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800c4e:	0f b6 08             	movzbl (%eax),%ecx
+  800c51:	0f b6 1a             	movzbl (%edx),%ebx
+  800c54:	38 d9                	cmp    %bl,%cl
+  800c56:	75 11                	jne    800c69 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c58:	83 c0 01             	add    $0x1,%eax
+  800c5b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c5e:	39 c6                	cmp    %eax,%esi
+  800c60:	75 ec                	jne    800c4e <memcmp+0x14>
+	}
+
+	return 0;
+  800c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c67:	eb 08                	jmp    800c71 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c69:	0f b6 c1             	movzbl %cl,%eax
+  800c6c:	0f b6 db             	movzbl %bl,%ebx
+  800c6f:	29 d8                	sub    %ebx,%eax
+}
+  800c71:	5b                   	pop    %ebx
+  800c72:	5e                   	pop    %esi
+  800c73:	5d                   	pop    %ebp
+  800c74:	c3                   	ret
+	return 0;
+  800c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7a:	eb f5                	jmp    800c71 <memcmp+0x37>
+
+00800c7c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c85:	89 c2                	mov    %eax,%edx
+  800c87:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c8a:	39 d0                	cmp    %edx,%eax
+  800c8c:	73 0d                	jae    800c9b <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c8e:	38 08                	cmp    %cl,(%eax)
+  800c90:	74 0d                	je     800c9f <memfind+0x23>
+	for (; s < ends; s++)
+  800c92:	83 c0 01             	add    $0x1,%eax
+  800c95:	39 c2                	cmp    %eax,%edx
+  800c97:	75 f5                	jne    800c8e <memfind+0x12>
+  800c99:	eb 06                	jmp    800ca1 <memfind+0x25>
+  800c9b:	89 c2                	mov    %eax,%edx
+  800c9d:	eb 02                	jmp    800ca1 <memfind+0x25>
+  800c9f:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800ca1:	89 d0                	mov    %edx,%eax
+  800ca3:	5d                   	pop    %ebp
+  800ca4:	c3                   	ret
+
+00800ca5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ca5:	55                   	push   %ebp
+  800ca6:	89 e5                	mov    %esp,%ebp
+  800ca8:	57                   	push   %edi
+  800ca9:	56                   	push   %esi
+  800caa:	53                   	push   %ebx
+  800cab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cb1:	0f b6 02             	movzbl (%edx),%eax
+  800cb4:	3c 20                	cmp    $0x20,%al
+  800cb6:	74 04                	je     800cbc <strtol+0x17>
+  800cb8:	3c 09                	cmp    $0x9,%al
+  800cba:	75 0e                	jne    800cca <strtol+0x25>
+		s++;
+  800cbc:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cbf:	0f b6 02             	movzbl (%edx),%eax
+  800cc2:	3c 20                	cmp    $0x20,%al
+  800cc4:	74 f6                	je     800cbc <strtol+0x17>
+  800cc6:	3c 09                	cmp    $0x9,%al
+  800cc8:	74 f2                	je     800cbc <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cca:	3c 2b                	cmp    $0x2b,%al
+  800ccc:	74 2a                	je     800cf8 <strtol+0x53>
+	int neg = 0;
+  800cce:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cd3:	3c 2d                	cmp    $0x2d,%al
+  800cd5:	74 2b                	je     800d02 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cd7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cdd:	75 0f                	jne    800cee <strtol+0x49>
+  800cdf:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ce2:	74 28                	je     800d0c <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ce4:	85 db                	test   %ebx,%ebx
+  800ce6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ceb:	0f 44 d8             	cmove  %eax,%ebx
+  800cee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cf6:	eb 46                	jmp    800d3e <strtol+0x99>
+		s++;
+  800cf8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d00:	eb d5                	jmp    800cd7 <strtol+0x32>
+		s++, neg = 1;
+  800d02:	83 c2 01             	add    $0x1,%edx
+  800d05:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d0a:	eb cb                	jmp    800cd7 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d0c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d10:	74 0e                	je     800d20 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d12:	85 db                	test   %ebx,%ebx
+  800d14:	75 d8                	jne    800cee <strtol+0x49>
+		s++, base = 8;
+  800d16:	83 c2 01             	add    $0x1,%edx
+  800d19:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d1e:	eb ce                	jmp    800cee <strtol+0x49>
+		s += 2, base = 16;
+  800d20:	83 c2 02             	add    $0x2,%edx
+  800d23:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d28:	eb c4                	jmp    800cee <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d2a:	0f be c0             	movsbl %al,%eax
+  800d2d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d30:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d33:	7d 3a                	jge    800d6f <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d35:	83 c2 01             	add    $0x1,%edx
+  800d38:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d3c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d3e:	0f b6 02             	movzbl (%edx),%eax
+  800d41:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d44:	89 f3                	mov    %esi,%ebx
+  800d46:	80 fb 09             	cmp    $0x9,%bl
+  800d49:	76 df                	jbe    800d2a <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800d4b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d4e:	89 f3                	mov    %esi,%ebx
+  800d50:	80 fb 19             	cmp    $0x19,%bl
+  800d53:	77 08                	ja     800d5d <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800d55:	0f be c0             	movsbl %al,%eax
+  800d58:	83 e8 57             	sub    $0x57,%eax
+  800d5b:	eb d3                	jmp    800d30 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d5d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d60:	89 f3                	mov    %esi,%ebx
+  800d62:	80 fb 19             	cmp    $0x19,%bl
+  800d65:	77 08                	ja     800d6f <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d67:	0f be c0             	movsbl %al,%eax
+  800d6a:	83 e8 37             	sub    $0x37,%eax
+  800d6d:	eb c1                	jmp    800d30 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d6f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d73:	74 05                	je     800d7a <strtol+0xd5>
+		*endptr = (char *) s;
+  800d75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d78:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d7a:	89 c8                	mov    %ecx,%eax
+  800d7c:	f7 d8                	neg    %eax
+  800d7e:	85 ff                	test   %edi,%edi
+  800d80:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d83:	89 c8                	mov    %ecx,%eax
+  800d85:	5b                   	pop    %ebx
+  800d86:	5e                   	pop    %esi
+  800d87:	5f                   	pop    %edi
+  800d88:	5d                   	pop    %ebp
+  800d89:	c3                   	ret
+
+00800d8a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	57                   	push   %edi
+  800d8e:	56                   	push   %esi
+  800d8f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9b:	89 c3                	mov    %eax,%ebx
+  800d9d:	89 c7                	mov    %eax,%edi
+  800d9f:	89 c6                	mov    %eax,%esi
+  800da1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800da3:	5b                   	pop    %ebx
+  800da4:	5e                   	pop    %esi
+  800da5:	5f                   	pop    %edi
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+
+00800da8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	57                   	push   %edi
+  800dac:	56                   	push   %esi
+  800dad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dae:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db8:	89 d1                	mov    %edx,%ecx
+  800dba:	89 d3                	mov    %edx,%ebx
+  800dbc:	89 d7                	mov    %edx,%edi
+  800dbe:	89 d6                	mov    %edx,%esi
+  800dc0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dc2:	5b                   	pop    %ebx
+  800dc3:	5e                   	pop    %esi
+  800dc4:	5f                   	pop    %edi
+  800dc5:	5d                   	pop    %ebp
+  800dc6:	c3                   	ret
+
+00800dc7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dc7:	55                   	push   %ebp
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	57                   	push   %edi
+  800dcb:	56                   	push   %esi
+  800dcc:	53                   	push   %ebx
+  800dcd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ddd:	89 cb                	mov    %ecx,%ebx
+  800ddf:	89 cf                	mov    %ecx,%edi
+  800de1:	89 ce                	mov    %ecx,%esi
+  800de3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de5:	85 c0                	test   %eax,%eax
+  800de7:	7f 08                	jg     800df1 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  800df4:	50                   	push   %eax
+  800df5:	6a 03                	push   $0x3
+  800df7:	68 8b 43 80 00       	push   $0x80438b
+  800dfc:	6a 23                	push   $0x23
+  800dfe:	68 a8 43 80 00       	push   $0x8043a8
+  800e03:	e8 79 28 00 00       	call   803681 <_panic>
+
+00800e08 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e13:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e18:	89 d1                	mov    %edx,%ecx
+  800e1a:	89 d3                	mov    %edx,%ebx
+  800e1c:	89 d7                	mov    %edx,%edi
+  800e1e:	89 d6                	mov    %edx,%esi
+  800e20:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e32:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e37:	89 d1                	mov    %edx,%ecx
+  800e39:	89 d3                	mov    %edx,%ebx
+  800e3b:	89 d7                	mov    %edx,%edi
+  800e3d:	89 d6                	mov    %edx,%esi
+  800e3f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+
+00800e46 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e62:	89 f7                	mov    %esi,%edi
+  800e64:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e66:	85 c0                	test   %eax,%eax
+  800e68:	7f 08                	jg     800e72 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6d:	5b                   	pop    %ebx
+  800e6e:	5e                   	pop    %esi
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e72:	83 ec 0c             	sub    $0xc,%esp
+  800e75:	50                   	push   %eax
+  800e76:	6a 04                	push   $0x4
+  800e78:	68 8b 43 80 00       	push   $0x80438b
+  800e7d:	6a 23                	push   $0x23
+  800e7f:	68 a8 43 80 00       	push   $0x8043a8
+  800e84:	e8 f8 27 00 00       	call   803681 <_panic>
+
+00800e89 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e98:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea3:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ea6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	7f 08                	jg     800eb4 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800eac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eaf:	5b                   	pop    %ebx
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5f                   	pop    %edi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	50                   	push   %eax
+  800eb8:	6a 05                	push   $0x5
+  800eba:	68 8b 43 80 00       	push   $0x80438b
+  800ebf:	6a 23                	push   $0x23
+  800ec1:	68 a8 43 80 00       	push   $0x8043a8
+  800ec6:	e8 b6 27 00 00       	call   803681 <_panic>
+
+00800ecb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	56                   	push   %esi
+  800ed0:	53                   	push   %ebx
+  800ed1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ee4:	89 df                	mov    %ebx,%edi
+  800ee6:	89 de                	mov    %ebx,%esi
+  800ee8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eea:	85 c0                	test   %eax,%eax
+  800eec:	7f 08                	jg     800ef6 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef1:	5b                   	pop    %ebx
+  800ef2:	5e                   	pop    %esi
+  800ef3:	5f                   	pop    %edi
+  800ef4:	5d                   	pop    %ebp
+  800ef5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef6:	83 ec 0c             	sub    $0xc,%esp
+  800ef9:	50                   	push   %eax
+  800efa:	6a 06                	push   $0x6
+  800efc:	68 8b 43 80 00       	push   $0x80438b
+  800f01:	6a 23                	push   $0x23
+  800f03:	68 a8 43 80 00       	push   $0x8043a8
+  800f08:	e8 74 27 00 00       	call   803681 <_panic>
+
+00800f0d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	56                   	push   %esi
+  800f12:	53                   	push   %ebx
+  800f13:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f21:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f26:	89 df                	mov    %ebx,%edi
+  800f28:	89 de                	mov    %ebx,%esi
+  800f2a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2c:	85 c0                	test   %eax,%eax
+  800f2e:	7f 08                	jg     800f38 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f33:	5b                   	pop    %ebx
+  800f34:	5e                   	pop    %esi
+  800f35:	5f                   	pop    %edi
+  800f36:	5d                   	pop    %ebp
+  800f37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+  800f3b:	50                   	push   %eax
+  800f3c:	6a 08                	push   $0x8
+  800f3e:	68 8b 43 80 00       	push   $0x80438b
+  800f43:	6a 23                	push   $0x23
+  800f45:	68 a8 43 80 00       	push   $0x8043a8
+  800f4a:	e8 32 27 00 00       	call   803681 <_panic>
+
+00800f4f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	57                   	push   %edi
+  800f53:	56                   	push   %esi
+  800f54:	53                   	push   %ebx
+  800f55:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f63:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f68:	89 df                	mov    %ebx,%edi
+  800f6a:	89 de                	mov    %ebx,%esi
+  800f6c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6e:	85 c0                	test   %eax,%eax
+  800f70:	7f 08                	jg     800f7a <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f75:	5b                   	pop    %ebx
+  800f76:	5e                   	pop    %esi
+  800f77:	5f                   	pop    %edi
+  800f78:	5d                   	pop    %ebp
+  800f79:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+  800f7d:	50                   	push   %eax
+  800f7e:	6a 09                	push   $0x9
+  800f80:	68 8b 43 80 00       	push   $0x80438b
+  800f85:	6a 23                	push   $0x23
+  800f87:	68 a8 43 80 00       	push   $0x8043a8
+  800f8c:	e8 f0 26 00 00       	call   803681 <_panic>
+
+00800f91 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	56                   	push   %esi
+  800f96:	53                   	push   %ebx
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800faa:	89 df                	mov    %ebx,%edi
+  800fac:	89 de                	mov    %ebx,%esi
+  800fae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb0:	85 c0                	test   %eax,%eax
+  800fb2:	7f 08                	jg     800fbc <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb7:	5b                   	pop    %ebx
+  800fb8:	5e                   	pop    %esi
+  800fb9:	5f                   	pop    %edi
+  800fba:	5d                   	pop    %ebp
+  800fbb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbc:	83 ec 0c             	sub    $0xc,%esp
+  800fbf:	50                   	push   %eax
+  800fc0:	6a 0a                	push   $0xa
+  800fc2:	68 8b 43 80 00       	push   $0x80438b
+  800fc7:	6a 23                	push   $0x23
+  800fc9:	68 a8 43 80 00       	push   $0x8043a8
+  800fce:	e8 ae 26 00 00       	call   803681 <_panic>
+
+00800fd3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fef:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+
+00800ff6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+  800ffc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801004:	8b 55 08             	mov    0x8(%ebp),%edx
+  801007:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80100c:	89 cb                	mov    %ecx,%ebx
+  80100e:	89 cf                	mov    %ecx,%edi
+  801010:	89 ce                	mov    %ecx,%esi
+  801012:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801014:	85 c0                	test   %eax,%eax
+  801016:	7f 08                	jg     801020 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801020:	83 ec 0c             	sub    $0xc,%esp
+  801023:	50                   	push   %eax
+  801024:	6a 0d                	push   $0xd
+  801026:	68 8b 43 80 00       	push   $0x80438b
+  80102b:	6a 23                	push   $0x23
+  80102d:	68 a8 43 80 00       	push   $0x8043a8
+  801032:	e8 4a 26 00 00       	call   803681 <_panic>
+
+00801037 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801040:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801043:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801048:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801051:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+
+00801058 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+  80105e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801061:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801071:	89 df                	mov    %ebx,%edi
+  801073:	89 de                	mov    %ebx,%esi
+  801075:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801077:	85 c0                	test   %eax,%eax
+  801079:	7f 08                	jg     801083 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80107b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107e:	5b                   	pop    %ebx
+  80107f:	5e                   	pop    %esi
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801083:	83 ec 0c             	sub    $0xc,%esp
+  801086:	50                   	push   %eax
+  801087:	6a 0d                	push   $0xd
+  801089:	68 8b 43 80 00       	push   $0x80438b
+  80108e:	6a 23                	push   $0x23
+  801090:	68 a8 43 80 00       	push   $0x8043a8
+  801095:	e8 e7 25 00 00       	call   803681 <_panic>
+
+0080109a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	57                   	push   %edi
+  80109e:	56                   	push   %esi
+  80109f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010aa:	89 d1                	mov    %edx,%ecx
+  8010ac:	89 d3                	mov    %edx,%ebx
+  8010ae:	89 d7                	mov    %edx,%edi
+  8010b0:	89 d6                	mov    %edx,%esi
+  8010b2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+
+008010b9 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	57                   	push   %edi
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ca:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010cf:	89 df                	mov    %ebx,%edi
+  8010d1:	89 de                	mov    %ebx,%esi
+  8010d3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8010d5:	5b                   	pop    %ebx
+  8010d6:	5e                   	pop    %esi
+  8010d7:	5f                   	pop    %edi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+
+008010da <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	57                   	push   %edi
+  8010de:	56                   	push   %esi
+  8010df:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010ed:	89 cb                	mov    %ecx,%ebx
+  8010ef:	89 cf                	mov    %ecx,%edi
+  8010f1:	89 ce                	mov    %ecx,%esi
+  8010f3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801100:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801110:	89 df                	mov    %ebx,%edi
+  801112:	89 de                	mov    %ebx,%esi
+  801114:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801116:	5b                   	pop    %ebx
+  801117:	5e                   	pop    %esi
+  801118:	5f                   	pop    %edi
+  801119:	5d                   	pop    %ebp
+  80111a:	c3                   	ret
+
+0080111b <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80111b:	55                   	push   %ebp
+  80111c:	89 e5                	mov    %esp,%ebp
+  80111e:	57                   	push   %edi
+  80111f:	56                   	push   %esi
+  801120:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801121:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801131:	89 df                	mov    %ebx,%edi
+  801133:	89 de                	mov    %ebx,%esi
+  801135:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5f                   	pop    %edi
+  80113a:	5d                   	pop    %ebp
+  80113b:	c3                   	ret
+
+0080113c <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801142:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80114f:	89 cb                	mov    %ecx,%ebx
+  801151:	89 cf                	mov    %ecx,%edi
+  801153:	89 ce                	mov    %ecx,%esi
+  801155:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801157:	5b                   	pop    %ebx
+  801158:	5e                   	pop    %esi
+  801159:	5f                   	pop    %edi
+  80115a:	5d                   	pop    %ebp
+  80115b:	c3                   	ret
+
+0080115c <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	89 de                	mov    %ebx,%esi
+  801176:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+
+0080117d <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801183:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801190:	89 cb                	mov    %ecx,%ebx
+  801192:	89 cf                	mov    %ecx,%edi
+  801194:	89 ce                	mov    %ecx,%esi
+  801196:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+
+0080119d <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	57                   	push   %edi
+  8011a1:	56                   	push   %esi
+  8011a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ae:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b6:	89 f7                	mov    %esi,%edi
+  8011b8:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8011ba:	5b                   	pop    %ebx
+  8011bb:	5e                   	pop    %esi
+  8011bc:	5f                   	pop    %edi
+  8011bd:	5d                   	pop    %ebp
+  8011be:	c3                   	ret
+
+008011bf <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	57                   	push   %edi
+  8011c3:	56                   	push   %esi
+  8011c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011d5:	89 df                	mov    %ebx,%edi
+  8011d7:	89 de                	mov    %ebx,%esi
+  8011d9:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+
+008011e0 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8011e0:	55                   	push   %ebp
+  8011e1:	89 e5                	mov    %esp,%ebp
+  8011e3:	57                   	push   %edi
+  8011e4:	56                   	push   %esi
+  8011e5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ee:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011f3:	89 cb                	mov    %ecx,%ebx
+  8011f5:	89 cf                	mov    %ecx,%edi
+  8011f7:	89 ce                	mov    %ecx,%esi
+  8011f9:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8011fb:	5b                   	pop    %ebx
+  8011fc:	5e                   	pop    %esi
+  8011fd:	5f                   	pop    %edi
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+
+00801200 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801206:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80120a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 19 00 00 00       	mov    $0x19,%eax
+  801217:	89 df                	mov    %ebx,%edi
+  801219:	89 de                	mov    %ebx,%esi
+  80121b:	cd 30                	int    $0x30
+}
+  80121d:	5b                   	pop    %ebx
+  80121e:	5e                   	pop    %esi
+  80121f:	5f                   	pop    %edi
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+
+00801222 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	57                   	push   %edi
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801228:	be 00 00 00 00       	mov    $0x0,%esi
+  80122d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801230:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801233:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123b:	89 f7                	mov    %esi,%edi
+  80123d:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80123f:	5b                   	pop    %ebx
+  801240:	5e                   	pop    %esi
+  801241:	5f                   	pop    %edi
+  801242:	5d                   	pop    %ebp
+  801243:	c3                   	ret
+
+00801244 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	57                   	push   %edi
+  801248:	56                   	push   %esi
+  801249:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124a:	be 00 00 00 00       	mov    $0x0,%esi
+  80124f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801252:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801255:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80125a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125d:	89 f7                	mov    %esi,%edi
+  80125f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801261:	5b                   	pop    %ebx
+  801262:	5e                   	pop    %esi
+  801263:	5f                   	pop    %edi
+  801264:	5d                   	pop    %ebp
+  801265:	c3                   	ret
+
+00801266 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80127c:	89 df                	mov    %ebx,%edi
+  80127e:	89 de                	mov    %ebx,%esi
+  801280:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801282:	5b                   	pop    %ebx
+  801283:	5e                   	pop    %esi
+  801284:	5f                   	pop    %edi
+  801285:	5d                   	pop    %ebp
+  801286:	c3                   	ret
+
+00801287 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801287:	55                   	push   %ebp
+  801288:	89 e5                	mov    %esp,%ebp
+  80128a:	57                   	push   %edi
+  80128b:	56                   	push   %esi
+  80128c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128d:	be 00 00 00 00       	mov    $0x0,%esi
+  801292:	8b 55 08             	mov    0x8(%ebp),%edx
+  801295:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801298:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80129d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a0:	89 f7                	mov    %esi,%edi
+  8012a2:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+
+008012a9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012af:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012b4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012b7:	5d                   	pop    %ebp
+  8012b8:	c3                   	ret
+
+008012b9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012bf:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012c4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012c9:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+
+008012d0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012d8:	89 c2                	mov    %eax,%edx
+  8012da:	c1 ea 16             	shr    $0x16,%edx
+  8012dd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012e4:	f6 c2 01             	test   $0x1,%dl
+  8012e7:	74 29                	je     801312 <fd_alloc+0x42>
+  8012e9:	89 c2                	mov    %eax,%edx
+  8012eb:	c1 ea 0c             	shr    $0xc,%edx
+  8012ee:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012f5:	f6 c2 01             	test   $0x1,%dl
+  8012f8:	74 18                	je     801312 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  8012fa:	05 00 10 00 00       	add    $0x1000,%eax
+  8012ff:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801304:	75 d2                	jne    8012d8 <fd_alloc+0x8>
+  801306:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80130b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801310:	eb 05                	jmp    801317 <fd_alloc+0x47>
+			return 0;
+  801312:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801317:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131a:	89 02                	mov    %eax,(%edx)
+}
+  80131c:	89 c8                	mov    %ecx,%eax
+  80131e:	5d                   	pop    %ebp
+  80131f:	c3                   	ret
+
+00801320 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801320:	55                   	push   %ebp
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801326:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80132b:	77 30                	ja     80135d <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80132d:	c1 e0 0c             	shl    $0xc,%eax
+  801330:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801335:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80133b:	f6 c2 01             	test   $0x1,%dl
+  80133e:	74 24                	je     801364 <fd_lookup+0x44>
+  801340:	89 c2                	mov    %eax,%edx
+  801342:	c1 ea 0c             	shr    $0xc,%edx
+  801345:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80134c:	f6 c2 01             	test   $0x1,%dl
+  80134f:	74 1a                	je     80136b <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801351:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801354:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801356:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80135b:	5d                   	pop    %ebp
+  80135c:	c3                   	ret
+		return -E_INVAL;
+  80135d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801362:	eb f7                	jmp    80135b <fd_lookup+0x3b>
+		return -E_INVAL;
+  801364:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801369:	eb f0                	jmp    80135b <fd_lookup+0x3b>
+  80136b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801370:	eb e9                	jmp    80135b <fd_lookup+0x3b>
+
+00801372 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	53                   	push   %ebx
+  801376:	83 ec 04             	sub    $0x4,%esp
+  801379:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80137c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801381:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801386:	39 13                	cmp    %edx,(%ebx)
+  801388:	74 54                	je     8013de <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80138a:	83 c0 01             	add    $0x1,%eax
+  80138d:	8b 1c 85 34 44 80 00 	mov    0x804434(,%eax,4),%ebx
+  801394:	85 db                	test   %ebx,%ebx
+  801396:	75 ee                	jne    801386 <dev_lookup+0x14>
+  801398:	89 e1                	mov    %esp,%ecx
+  80139a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80139f:	29 c8                	sub    %ecx,%eax
+  8013a1:	89 c1                	mov    %eax,%ecx
+  8013a3:	c1 e9 0f             	shr    $0xf,%ecx
+  8013a6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8013ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b0:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013b3:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8013ba:	8b 40 48             	mov    0x48(%eax),%eax
+  8013bd:	83 ec 04             	sub    $0x4,%esp
+  8013c0:	52                   	push   %edx
+  8013c1:	50                   	push   %eax
+  8013c2:	68 b8 43 80 00       	push   $0x8043b8
+  8013c7:	e8 4f ef ff ff       	call   80031b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013cc:	83 c4 10             	add    $0x10,%esp
+  8013cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d7:	89 1a                	mov    %ebx,(%edx)
+}
+  8013d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013dc:	c9                   	leave
+  8013dd:	c3                   	ret
+			return 0;
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e3:	eb ef                	jmp    8013d4 <dev_lookup+0x62>
+
+008013e5 <fd_close>:
+{
+  8013e5:	55                   	push   %ebp
+  8013e6:	89 e5                	mov    %esp,%ebp
+  8013e8:	57                   	push   %edi
+  8013e9:	56                   	push   %esi
+  8013ea:	53                   	push   %ebx
+  8013eb:	83 ec 24             	sub    $0x24,%esp
+  8013ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013f1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013f4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013f7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013f8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013fe:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801401:	50                   	push   %eax
+  801402:	e8 19 ff ff ff       	call   801320 <fd_lookup>
+  801407:	89 c3                	mov    %eax,%ebx
+  801409:	83 c4 10             	add    $0x10,%esp
+  80140c:	85 c0                	test   %eax,%eax
+  80140e:	78 05                	js     801415 <fd_close+0x30>
+	    || fd != fd2)
+  801410:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801413:	74 0f                	je     801424 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801415:	85 ff                	test   %edi,%edi
+  801417:	0f 44 df             	cmove  %edi,%ebx
+}
+  80141a:	89 d8                	mov    %ebx,%eax
+  80141c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801424:	83 ec 08             	sub    $0x8,%esp
+  801427:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80142a:	50                   	push   %eax
+  80142b:	ff 36                	push   (%esi)
+  80142d:	e8 40 ff ff ff       	call   801372 <dev_lookup>
+  801432:	89 c3                	mov    %eax,%ebx
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 1a                	js     801455 <fd_close+0x70>
+		if (dev->dev_close)
+  80143b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80143e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801441:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801446:	85 c0                	test   %eax,%eax
+  801448:	74 0b                	je     801455 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80144a:	83 ec 0c             	sub    $0xc,%esp
+  80144d:	56                   	push   %esi
+  80144e:	ff d0                	call   *%eax
+  801450:	89 c3                	mov    %eax,%ebx
+  801452:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801455:	83 ec 08             	sub    $0x8,%esp
+  801458:	56                   	push   %esi
+  801459:	6a 00                	push   $0x0
+  80145b:	e8 6b fa ff ff       	call   800ecb <sys_page_unmap>
+	return r;
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	eb b5                	jmp    80141a <fd_close+0x35>
+
+00801465 <close>:
+
+int
+close(int fdnum)
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80146b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80146e:	50                   	push   %eax
+  80146f:	ff 75 08             	push   0x8(%ebp)
+  801472:	e8 a9 fe ff ff       	call   801320 <fd_lookup>
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	79 02                	jns    801480 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+		return fd_close(fd, 1);
+  801480:	83 ec 08             	sub    $0x8,%esp
+  801483:	6a 01                	push   $0x1
+  801485:	ff 75 f4             	push   -0xc(%ebp)
+  801488:	e8 58 ff ff ff       	call   8013e5 <fd_close>
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	eb ec                	jmp    80147e <close+0x19>
+
+00801492 <close_all>:
+
+void
+close_all(void)
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	53                   	push   %ebx
+  801496:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801499:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	53                   	push   %ebx
+  8014a2:	e8 be ff ff ff       	call   801465 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014a7:	83 c3 01             	add    $0x1,%ebx
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8014b3:	75 e9                	jne    80149e <close_all+0xc>
+}
+  8014b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b8:	c9                   	leave
+  8014b9:	c3                   	ret
+
+008014ba <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+  8014c0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014c3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014c6:	50                   	push   %eax
+  8014c7:	ff 75 08             	push   0x8(%ebp)
+  8014ca:	e8 51 fe ff ff       	call   801320 <fd_lookup>
+  8014cf:	89 c3                	mov    %eax,%ebx
+  8014d1:	83 c4 10             	add    $0x10,%esp
+  8014d4:	85 c0                	test   %eax,%eax
+  8014d6:	78 7f                	js     801557 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014d8:	83 ec 0c             	sub    $0xc,%esp
+  8014db:	ff 75 0c             	push   0xc(%ebp)
+  8014de:	e8 82 ff ff ff       	call   801465 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014e6:	c1 e6 0c             	shl    $0xc,%esi
+  8014e9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014f2:	89 3c 24             	mov    %edi,(%esp)
+  8014f5:	e8 bf fd ff ff       	call   8012b9 <fd2data>
+  8014fa:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014fc:	89 34 24             	mov    %esi,(%esp)
+  8014ff:	e8 b5 fd ff ff       	call   8012b9 <fd2data>
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80150a:	89 d8                	mov    %ebx,%eax
+  80150c:	c1 e8 16             	shr    $0x16,%eax
+  80150f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801516:	a8 01                	test   $0x1,%al
+  801518:	74 11                	je     80152b <dup+0x71>
+  80151a:	89 d8                	mov    %ebx,%eax
+  80151c:	c1 e8 0c             	shr    $0xc,%eax
+  80151f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801526:	f6 c2 01             	test   $0x1,%dl
+  801529:	75 36                	jne    801561 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80152b:	89 f8                	mov    %edi,%eax
+  80152d:	c1 e8 0c             	shr    $0xc,%eax
+  801530:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801537:	83 ec 0c             	sub    $0xc,%esp
+  80153a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80153f:	50                   	push   %eax
+  801540:	56                   	push   %esi
+  801541:	6a 00                	push   $0x0
+  801543:	57                   	push   %edi
+  801544:	6a 00                	push   $0x0
+  801546:	e8 3e f9 ff ff       	call   800e89 <sys_page_map>
+  80154b:	89 c3                	mov    %eax,%ebx
+  80154d:	83 c4 20             	add    $0x20,%esp
+  801550:	85 c0                	test   %eax,%eax
+  801552:	78 33                	js     801587 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801554:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801557:	89 d8                	mov    %ebx,%eax
+  801559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155c:	5b                   	pop    %ebx
+  80155d:	5e                   	pop    %esi
+  80155e:	5f                   	pop    %edi
+  80155f:	5d                   	pop    %ebp
+  801560:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801561:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801568:	83 ec 0c             	sub    $0xc,%esp
+  80156b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801570:	50                   	push   %eax
+  801571:	ff 75 d4             	push   -0x2c(%ebp)
+  801574:	6a 00                	push   $0x0
+  801576:	53                   	push   %ebx
+  801577:	6a 00                	push   $0x0
+  801579:	e8 0b f9 ff ff       	call   800e89 <sys_page_map>
+  80157e:	89 c3                	mov    %eax,%ebx
+  801580:	83 c4 20             	add    $0x20,%esp
+  801583:	85 c0                	test   %eax,%eax
+  801585:	79 a4                	jns    80152b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801587:	83 ec 08             	sub    $0x8,%esp
+  80158a:	56                   	push   %esi
+  80158b:	6a 00                	push   $0x0
+  80158d:	e8 39 f9 ff ff       	call   800ecb <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801592:	83 c4 08             	add    $0x8,%esp
+  801595:	ff 75 d4             	push   -0x2c(%ebp)
+  801598:	6a 00                	push   $0x0
+  80159a:	e8 2c f9 ff ff       	call   800ecb <sys_page_unmap>
+	return r;
+  80159f:	83 c4 10             	add    $0x10,%esp
+  8015a2:	eb b3                	jmp    801557 <dup+0x9d>
+
+008015a4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	56                   	push   %esi
+  8015a8:	53                   	push   %ebx
+  8015a9:	83 ec 18             	sub    $0x18,%esp
+  8015ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015b2:	50                   	push   %eax
+  8015b3:	53                   	push   %ebx
+  8015b4:	e8 67 fd ff ff       	call   801320 <fd_lookup>
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	85 c0                	test   %eax,%eax
+  8015be:	78 3c                	js     8015fc <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015c0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015c3:	83 ec 08             	sub    $0x8,%esp
+  8015c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c9:	50                   	push   %eax
+  8015ca:	ff 36                	push   (%esi)
+  8015cc:	e8 a1 fd ff ff       	call   801372 <dev_lookup>
+  8015d1:	83 c4 10             	add    $0x10,%esp
+  8015d4:	85 c0                	test   %eax,%eax
+  8015d6:	78 24                	js     8015fc <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015d8:	8b 46 08             	mov    0x8(%esi),%eax
+  8015db:	83 e0 03             	and    $0x3,%eax
+  8015de:	83 f8 01             	cmp    $0x1,%eax
+  8015e1:	74 20                	je     801603 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015e6:	8b 40 08             	mov    0x8(%eax),%eax
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	74 54                	je     801641 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015ed:	83 ec 04             	sub    $0x4,%esp
+  8015f0:	ff 75 10             	push   0x10(%ebp)
+  8015f3:	ff 75 0c             	push   0xc(%ebp)
+  8015f6:	56                   	push   %esi
+  8015f7:	ff d0                	call   *%eax
+  8015f9:	83 c4 10             	add    $0x10,%esp
+}
+  8015fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015ff:	5b                   	pop    %ebx
+  801600:	5e                   	pop    %esi
+  801601:	5d                   	pop    %ebp
+  801602:	c3                   	ret
+  801603:	89 e2                	mov    %esp,%edx
+  801605:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80160a:	29 d0                	sub    %edx,%eax
+  80160c:	89 c2                	mov    %eax,%edx
+  80160e:	c1 ea 0f             	shr    $0xf,%edx
+  801611:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161b:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80161e:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801625:	8b 40 48             	mov    0x48(%eax),%eax
+  801628:	83 ec 04             	sub    $0x4,%esp
+  80162b:	53                   	push   %ebx
+  80162c:	50                   	push   %eax
+  80162d:	68 f9 43 80 00       	push   $0x8043f9
+  801632:	e8 e4 ec ff ff       	call   80031b <cprintf>
+		return -E_INVAL;
+  801637:	83 c4 10             	add    $0x10,%esp
+  80163a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80163f:	eb bb                	jmp    8015fc <read+0x58>
+		return -E_NOT_SUPP;
+  801641:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801646:	eb b4                	jmp    8015fc <read+0x58>
+
+00801648 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	57                   	push   %edi
+  80164c:	56                   	push   %esi
+  80164d:	53                   	push   %ebx
+  80164e:	83 ec 0c             	sub    $0xc,%esp
+  801651:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801654:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801657:	85 f6                	test   %esi,%esi
+  801659:	74 30                	je     80168b <readn+0x43>
+  80165b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801660:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801665:	83 ec 04             	sub    $0x4,%esp
+  801668:	89 f2                	mov    %esi,%edx
+  80166a:	29 c2                	sub    %eax,%edx
+  80166c:	52                   	push   %edx
+  80166d:	01 f8                	add    %edi,%eax
+  80166f:	50                   	push   %eax
+  801670:	ff 75 08             	push   0x8(%ebp)
+  801673:	e8 2c ff ff ff       	call   8015a4 <read>
+		if (m < 0)
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	78 15                	js     801694 <readn+0x4c>
+			return m;
+		if (m == 0)
+  80167f:	74 11                	je     801692 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801681:	01 c3                	add    %eax,%ebx
+  801683:	89 d8                	mov    %ebx,%eax
+  801685:	39 f3                	cmp    %esi,%ebx
+  801687:	72 dc                	jb     801665 <readn+0x1d>
+  801689:	eb 09                	jmp    801694 <readn+0x4c>
+  80168b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801690:	eb 02                	jmp    801694 <readn+0x4c>
+  801692:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801694:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801697:	5b                   	pop    %ebx
+  801698:	5e                   	pop    %esi
+  801699:	5f                   	pop    %edi
+  80169a:	5d                   	pop    %ebp
+  80169b:	c3                   	ret
+
+0080169c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80169c:	55                   	push   %ebp
+  80169d:	89 e5                	mov    %esp,%ebp
+  80169f:	56                   	push   %esi
+  8016a0:	53                   	push   %ebx
+  8016a1:	83 ec 18             	sub    $0x18,%esp
+  8016a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016aa:	50                   	push   %eax
+  8016ab:	53                   	push   %ebx
+  8016ac:	e8 6f fc ff ff       	call   801320 <fd_lookup>
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	78 37                	js     8016ef <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016b8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016bb:	83 ec 08             	sub    $0x8,%esp
+  8016be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c1:	50                   	push   %eax
+  8016c2:	ff 36                	push   (%esi)
+  8016c4:	e8 a9 fc ff ff       	call   801372 <dev_lookup>
+  8016c9:	83 c4 10             	add    $0x10,%esp
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	78 1f                	js     8016ef <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016d0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016d4:	74 20                	je     8016f6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	74 54                	je     801734 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016e0:	83 ec 04             	sub    $0x4,%esp
+  8016e3:	ff 75 10             	push   0x10(%ebp)
+  8016e6:	ff 75 0c             	push   0xc(%ebp)
+  8016e9:	56                   	push   %esi
+  8016ea:	ff d0                	call   *%eax
+  8016ec:	83 c4 10             	add    $0x10,%esp
+}
+  8016ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5d                   	pop    %ebp
+  8016f5:	c3                   	ret
+  8016f6:	89 e2                	mov    %esp,%edx
+  8016f8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016fd:	29 d0                	sub    %edx,%eax
+  8016ff:	89 c2                	mov    %eax,%edx
+  801701:	c1 ea 0f             	shr    $0xf,%edx
+  801704:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170e:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801711:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801718:	8b 40 48             	mov    0x48(%eax),%eax
+  80171b:	83 ec 04             	sub    $0x4,%esp
+  80171e:	53                   	push   %ebx
+  80171f:	50                   	push   %eax
+  801720:	68 15 44 80 00       	push   $0x804415
+  801725:	e8 f1 eb ff ff       	call   80031b <cprintf>
+		return -E_INVAL;
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801732:	eb bb                	jmp    8016ef <write+0x53>
+		return -E_NOT_SUPP;
+  801734:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801739:	eb b4                	jmp    8016ef <write+0x53>
+
+0080173b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801741:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801744:	50                   	push   %eax
+  801745:	ff 75 08             	push   0x8(%ebp)
+  801748:	e8 d3 fb ff ff       	call   801320 <fd_lookup>
+  80174d:	83 c4 10             	add    $0x10,%esp
+  801750:	85 c0                	test   %eax,%eax
+  801752:	78 0e                	js     801762 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801754:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801757:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80175a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80175d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801762:	c9                   	leave
+  801763:	c3                   	ret
+
+00801764 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801764:	55                   	push   %ebp
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	53                   	push   %ebx
+  801768:	83 ec 1c             	sub    $0x1c,%esp
+  80176b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80176e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801771:	50                   	push   %eax
+  801772:	ff 75 08             	push   0x8(%ebp)
+  801775:	e8 a6 fb ff ff       	call   801320 <fd_lookup>
+  80177a:	83 c4 10             	add    $0x10,%esp
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 33                	js     8017b4 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801781:	83 fb 03             	cmp    $0x3,%ebx
+  801784:	74 28                	je     8017ae <fcntl+0x4a>
+  801786:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178b:	83 fb 04             	cmp    $0x4,%ebx
+  80178e:	75 24                	jne    8017b4 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801790:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801793:	8b 41 08             	mov    0x8(%ecx),%eax
+  801796:	80 e4 ef             	and    $0xef,%ah
+  801799:	8b 55 10             	mov    0x10(%ebp),%edx
+  80179c:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8017a2:	09 d0                	or     %edx,%eax
+  8017a4:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8017a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ac:	eb 06                	jmp    8017b4 <fcntl+0x50>
+		return fd->fd_omode;
+  8017ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b1:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8017b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b7:	c9                   	leave
+  8017b8:	c3                   	ret
+
+008017b9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+  8017bc:	56                   	push   %esi
+  8017bd:	53                   	push   %ebx
+  8017be:	83 ec 18             	sub    $0x18,%esp
+  8017c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c7:	50                   	push   %eax
+  8017c8:	53                   	push   %ebx
+  8017c9:	e8 52 fb ff ff       	call   801320 <fd_lookup>
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	85 c0                	test   %eax,%eax
+  8017d3:	78 34                	js     801809 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d8:	83 ec 08             	sub    $0x8,%esp
+  8017db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017de:	50                   	push   %eax
+  8017df:	ff 36                	push   (%esi)
+  8017e1:	e8 8c fb ff ff       	call   801372 <dev_lookup>
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	78 1c                	js     801809 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017ed:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017f1:	74 1d                	je     801810 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f6:	8b 40 18             	mov    0x18(%eax),%eax
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	74 51                	je     80184e <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017fd:	83 ec 08             	sub    $0x8,%esp
+  801800:	ff 75 0c             	push   0xc(%ebp)
+  801803:	56                   	push   %esi
+  801804:	ff d0                	call   *%eax
+  801806:	83 c4 10             	add    $0x10,%esp
+}
+  801809:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80180c:	5b                   	pop    %ebx
+  80180d:	5e                   	pop    %esi
+  80180e:	5d                   	pop    %ebp
+  80180f:	c3                   	ret
+  801810:	89 e2                	mov    %esp,%edx
+  801812:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801817:	29 d0                	sub    %edx,%eax
+  801819:	89 c2                	mov    %eax,%edx
+  80181b:	c1 ea 0f             	shr    $0xf,%edx
+  80181e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801823:	b8 00 00 00 00       	mov    $0x0,%eax
+  801828:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80182b:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801832:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801835:	83 ec 04             	sub    $0x4,%esp
+  801838:	53                   	push   %ebx
+  801839:	50                   	push   %eax
+  80183a:	68 d8 43 80 00       	push   $0x8043d8
+  80183f:	e8 d7 ea ff ff       	call   80031b <cprintf>
+		return -E_INVAL;
+  801844:	83 c4 10             	add    $0x10,%esp
+  801847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184c:	eb bb                	jmp    801809 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80184e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801853:	eb b4                	jmp    801809 <ftruncate+0x50>
+
+00801855 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801855:	55                   	push   %ebp
+  801856:	89 e5                	mov    %esp,%ebp
+  801858:	56                   	push   %esi
+  801859:	53                   	push   %ebx
+  80185a:	83 ec 18             	sub    $0x18,%esp
+  80185d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801860:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801863:	50                   	push   %eax
+  801864:	ff 75 08             	push   0x8(%ebp)
+  801867:	e8 b4 fa ff ff       	call   801320 <fd_lookup>
+  80186c:	83 c4 10             	add    $0x10,%esp
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	78 53                	js     8018c6 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801873:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801876:	83 ec 08             	sub    $0x8,%esp
+  801879:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80187c:	50                   	push   %eax
+  80187d:	ff 36                	push   (%esi)
+  80187f:	e8 ee fa ff ff       	call   801372 <dev_lookup>
+  801884:	83 c4 10             	add    $0x10,%esp
+  801887:	85 c0                	test   %eax,%eax
+  801889:	78 3b                	js     8018c6 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80188b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80188e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801892:	74 39                	je     8018cd <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801894:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801897:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80189e:	00 00 00 
+	stat->st_isdir = 0;
+  8018a1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018a8:	00 00 00 
+	stat->st_version = 0;
+  8018ab:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8018b2:	00 00 00 
+	stat->st_dev = dev;
+  8018b5:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018bb:	83 ec 08             	sub    $0x8,%esp
+  8018be:	53                   	push   %ebx
+  8018bf:	56                   	push   %esi
+  8018c0:	ff 50 14             	call   *0x14(%eax)
+  8018c3:	83 c4 10             	add    $0x10,%esp
+}
+  8018c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c9:	5b                   	pop    %ebx
+  8018ca:	5e                   	pop    %esi
+  8018cb:	5d                   	pop    %ebp
+  8018cc:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018d2:	eb f2                	jmp    8018c6 <fstat+0x71>
+
+008018d4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	56                   	push   %esi
+  8018d8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018d9:	83 ec 08             	sub    $0x8,%esp
+  8018dc:	6a 00                	push   $0x0
+  8018de:	ff 75 08             	push   0x8(%ebp)
+  8018e1:	e8 b7 01 00 00       	call   801a9d <open>
+  8018e6:	89 c3                	mov    %eax,%ebx
+  8018e8:	83 c4 10             	add    $0x10,%esp
+  8018eb:	85 c0                	test   %eax,%eax
+  8018ed:	78 1b                	js     80190a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+  8018f2:	ff 75 0c             	push   0xc(%ebp)
+  8018f5:	50                   	push   %eax
+  8018f6:	e8 5a ff ff ff       	call   801855 <fstat>
+  8018fb:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018fd:	89 1c 24             	mov    %ebx,(%esp)
+  801900:	e8 60 fb ff ff       	call   801465 <close>
+	return r;
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	89 f3                	mov    %esi,%ebx
+}
+  80190a:	89 d8                	mov    %ebx,%eax
+  80190c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80190f:	5b                   	pop    %ebx
+  801910:	5e                   	pop    %esi
+  801911:	5d                   	pop    %ebp
+  801912:	c3                   	ret
+
+00801913 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801913:	55                   	push   %ebp
+  801914:	89 e5                	mov    %esp,%ebp
+  801916:	56                   	push   %esi
+  801917:	53                   	push   %ebx
+  801918:	89 c6                	mov    %eax,%esi
+  80191a:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80191c:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801923:	74 27                	je     80194c <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801925:	6a 07                	push   $0x7
+  801927:	68 00 70 80 00       	push   $0x807000
+  80192c:	56                   	push   %esi
+  80192d:	ff 35 00 60 80 00    	push   0x806000
+  801933:	e8 1f 20 00 00       	call   803957 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801938:	83 c4 0c             	add    $0xc,%esp
+  80193b:	6a 00                	push   $0x0
+  80193d:	53                   	push   %ebx
+  80193e:	6a 00                	push   $0x0
+  801940:	e8 82 1d 00 00       	call   8036c7 <ipc_recv>
+}
+  801945:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801948:	5b                   	pop    %ebx
+  801949:	5e                   	pop    %esi
+  80194a:	5d                   	pop    %ebp
+  80194b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80194c:	83 ec 0c             	sub    $0xc,%esp
+  80194f:	6a 02                	push   $0x2
+  801951:	e8 6a 20 00 00       	call   8039c0 <ipc_find_env>
+  801956:	a3 00 60 80 00       	mov    %eax,0x806000
+  80195b:	83 c4 10             	add    $0x10,%esp
+  80195e:	eb c5                	jmp    801925 <fsipc+0x12>
+
+00801960 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801960:	55                   	push   %ebp
+  801961:	89 e5                	mov    %esp,%ebp
+  801963:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801966:	8b 45 08             	mov    0x8(%ebp),%eax
+  801969:	8b 40 0c             	mov    0xc(%eax),%eax
+  80196c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801971:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801974:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801979:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801983:	e8 8b ff ff ff       	call   801913 <fsipc>
+}
+  801988:	c9                   	leave
+  801989:	c3                   	ret
+
+0080198a <devfile_flush>:
+{
+  80198a:	55                   	push   %ebp
+  80198b:	89 e5                	mov    %esp,%ebp
+  80198d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801990:	8b 45 08             	mov    0x8(%ebp),%eax
+  801993:	8b 40 0c             	mov    0xc(%eax),%eax
+  801996:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80199b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019a5:	e8 69 ff ff ff       	call   801913 <fsipc>
+}
+  8019aa:	c9                   	leave
+  8019ab:	c3                   	ret
+
+008019ac <devfile_stat>:
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	53                   	push   %ebx
+  8019b0:	83 ec 04             	sub    $0x4,%esp
+  8019b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019bc:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019cb:	e8 43 ff ff ff       	call   801913 <fsipc>
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 37                	js     801a0b <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019d4:	83 ec 08             	sub    $0x8,%esp
+  8019d7:	68 00 70 80 00       	push   $0x807000
+  8019dc:	53                   	push   %ebx
+  8019dd:	e8 30 f0 ff ff       	call   800a12 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019e2:	a1 80 70 80 00       	mov    0x807080,%eax
+  8019e7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019ed:	a1 84 70 80 00       	mov    0x807084,%eax
+  8019f2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8019f8:	a1 88 70 80 00       	mov    0x807088,%eax
+  8019fd:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801a03:	83 c4 10             	add    $0x10,%esp
+  801a06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a0e:	c9                   	leave
+  801a0f:	c3                   	ret
+
+00801a10 <devfile_write>:
+{
+  801a10:	55                   	push   %ebp
+  801a11:	89 e5                	mov    %esp,%ebp
+  801a13:	83 ec 0c             	sub    $0xc,%esp
+  801a16:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801a19:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a1e:	39 d0                	cmp    %edx,%eax
+  801a20:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a23:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a26:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a29:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801a2f:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801a34:	50                   	push   %eax
+  801a35:	ff 75 0c             	push   0xc(%ebp)
+  801a38:	68 08 70 80 00       	push   $0x807008
+  801a3d:	e8 80 f1 ff ff       	call   800bc2 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801a42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a47:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a4c:	e8 c2 fe ff ff       	call   801913 <fsipc>
+}
+  801a51:	c9                   	leave
+  801a52:	c3                   	ret
+
+00801a53 <devfile_read>:
+{
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	53                   	push   %ebx
+  801a57:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a60:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801a65:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a68:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801a6d:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a72:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a77:	e8 97 fe ff ff       	call   801913 <fsipc>
+  801a7c:	89 c3                	mov    %eax,%ebx
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	78 14                	js     801a96 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801a82:	83 ec 04             	sub    $0x4,%esp
+  801a85:	50                   	push   %eax
+  801a86:	68 00 70 80 00       	push   $0x807000
+  801a8b:	ff 75 0c             	push   0xc(%ebp)
+  801a8e:	e8 2f f1 ff ff       	call   800bc2 <memmove>
+	return r;
+  801a93:	83 c4 10             	add    $0x10,%esp
+}
+  801a96:	89 d8                	mov    %ebx,%eax
+  801a98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a9b:	c9                   	leave
+  801a9c:	c3                   	ret
+
+00801a9d <open>:
+{
+  801a9d:	55                   	push   %ebp
+  801a9e:	89 e5                	mov    %esp,%ebp
+  801aa0:	53                   	push   %ebx
+  801aa1:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801aa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa7:	50                   	push   %eax
+  801aa8:	e8 23 f8 ff ff       	call   8012d0 <fd_alloc>
+  801aad:	89 c3                	mov    %eax,%ebx
+  801aaf:	83 c4 10             	add    $0x10,%esp
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	78 2a                	js     801ae0 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801ab6:	83 ec 0c             	sub    $0xc,%esp
+  801ab9:	ff 75 08             	push   0x8(%ebp)
+  801abc:	e8 05 ef ff ff       	call   8009c6 <strlen>
+  801ac1:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801ac4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801ac9:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ace:	7e 17                	jle    801ae7 <open+0x4a>
+	fd_close(fd, 1);
+  801ad0:	83 ec 08             	sub    $0x8,%esp
+  801ad3:	6a 01                	push   $0x1
+  801ad5:	ff 75 f4             	push   -0xc(%ebp)
+  801ad8:	e8 08 f9 ff ff       	call   8013e5 <fd_close>
+	return r;
+  801add:	83 c4 10             	add    $0x10,%esp
+}
+  801ae0:	89 d8                	mov    %ebx,%eax
+  801ae2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae5:	c9                   	leave
+  801ae6:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801ae7:	83 ec 08             	sub    $0x8,%esp
+  801aea:	ff 75 08             	push   0x8(%ebp)
+  801aed:	68 00 70 80 00       	push   $0x807000
+  801af2:	e8 1b ef ff ff       	call   800a12 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801af7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801afa:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801aff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b02:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b07:	e8 07 fe ff ff       	call   801913 <fsipc>
+  801b0c:	89 c3                	mov    %eax,%ebx
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 bb                	js     801ad0 <open+0x33>
+	return fd2num(fd); 	
+  801b15:	83 ec 0c             	sub    $0xc,%esp
+  801b18:	ff 75 f4             	push   -0xc(%ebp)
+  801b1b:	e8 89 f7 ff ff       	call   8012a9 <fd2num>
+  801b20:	89 c3                	mov    %eax,%ebx
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	eb b9                	jmp    801ae0 <open+0x43>
+
+00801b27 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801b27:	55                   	push   %ebp
+  801b28:	89 e5                	mov    %esp,%ebp
+  801b2a:	53                   	push   %ebx
+  801b2b:	83 ec 1c             	sub    $0x1c,%esp
+  801b2e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b34:	50                   	push   %eax
+  801b35:	ff 75 08             	push   0x8(%ebp)
+  801b38:	e8 e3 f7 ff ff       	call   801320 <fd_lookup>
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	78 5a                	js     801b9e <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b47:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801b4d:	39 10                	cmp    %edx,(%eax)
+  801b4f:	75 66                	jne    801bb7 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801b51:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801b58:	74 49                	je     801ba3 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801b5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b60:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801b65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b68:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801b6d:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b73:	6a 07                	push   $0x7
+  801b75:	68 00 70 80 00       	push   $0x807000
+  801b7a:	6a 09                	push   $0x9
+  801b7c:	ff 35 00 60 80 00    	push   0x806000
+  801b82:	e8 d0 1d 00 00       	call   803957 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801b87:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b8e:	6a 00                	push   $0x0
+  801b90:	53                   	push   %ebx
+  801b91:	ff 75 10             	push   0x10(%ebp)
+  801b94:	6a 00                	push   $0x0
+  801b96:	e8 f9 1b 00 00       	call   803794 <ipc_recv_pages>
+  801b9b:	83 c4 20             	add    $0x20,%esp
+}
+  801b9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba1:	c9                   	leave
+  801ba2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ba3:	83 ec 0c             	sub    $0xc,%esp
+  801ba6:	6a 02                	push   $0x2
+  801ba8:	e8 13 1e 00 00       	call   8039c0 <ipc_find_env>
+  801bad:	a3 00 60 80 00       	mov    %eax,0x806000
+  801bb2:	83 c4 10             	add    $0x10,%esp
+  801bb5:	eb a3                	jmp    801b5a <fmap+0x33>
+		return -E_INVAL;
+  801bb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bbc:	eb e0                	jmp    801b9e <fmap+0x77>
+
+00801bbe <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801bbe:	55                   	push   %ebp
+  801bbf:	89 e5                	mov    %esp,%ebp
+  801bc1:	53                   	push   %ebx
+  801bc2:	83 ec 10             	sub    $0x10,%esp
+  801bc5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801bc8:	53                   	push   %ebx
+  801bc9:	e8 f8 ed ff ff       	call   8009c6 <strlen>
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bd6:	7f 25                	jg     801bfd <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+  801bdb:	53                   	push   %ebx
+  801bdc:	68 00 70 80 00       	push   $0x807000
+  801be1:	e8 2c ee ff ff       	call   800a12 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801beb:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bf0:	e8 1e fd ff ff       	call   801913 <fsipc>
+  801bf5:	83 c4 10             	add    $0x10,%esp
+}
+  801bf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfb:	c9                   	leave
+  801bfc:	c3                   	ret
+		return -E_BAD_PATH;
+  801bfd:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c02:	eb f4                	jmp    801bf8 <remove+0x3a>
+
+00801c04 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c14:	e8 fa fc ff ff       	call   801913 <fsipc>
+}
+  801c19:	c9                   	leave
+  801c1a:	c3                   	ret
+
+00801c1b <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c21:	68 48 44 80 00       	push   $0x804448
+  801c26:	ff 75 0c             	push   0xc(%ebp)
+  801c29:	e8 e4 ed ff ff       	call   800a12 <strcpy>
+	return 0;
+}
+  801c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c33:	c9                   	leave
+  801c34:	c3                   	ret
+
+00801c35 <devsock_close>:
+{
+  801c35:	55                   	push   %ebp
+  801c36:	89 e5                	mov    %esp,%ebp
+  801c38:	53                   	push   %ebx
+  801c39:	83 ec 10             	sub    $0x10,%esp
+  801c3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c3f:	53                   	push   %ebx
+  801c40:	e8 ba 1d 00 00       	call   8039ff <pageref>
+  801c45:	89 c2                	mov    %eax,%edx
+  801c47:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c4f:	83 fa 01             	cmp    $0x1,%edx
+  801c52:	74 05                	je     801c59 <devsock_close+0x24>
+}
+  801c54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c57:	c9                   	leave
+  801c58:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c59:	83 ec 0c             	sub    $0xc,%esp
+  801c5c:	ff 73 0c             	push   0xc(%ebx)
+  801c5f:	e8 b0 05 00 00       	call   802214 <nsipc_close>
+  801c64:	83 c4 10             	add    $0x10,%esp
+  801c67:	eb eb                	jmp    801c54 <devsock_close+0x1f>
+
+00801c69 <devsock_write>:
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	53                   	push   %ebx
+  801c6d:	83 ec 14             	sub    $0x14,%esp
+  801c70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c76:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801c79:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801c7c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c7f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c82:	c1 f8 09             	sar    $0x9,%eax
+  801c85:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c88:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c8e:	77 13                	ja     801ca3 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801c90:	50                   	push   %eax
+  801c91:	52                   	push   %edx
+  801c92:	53                   	push   %ebx
+  801c93:	ff 71 0c             	push   0xc(%ecx)
+  801c96:	e8 5c 06 00 00       	call   8022f7 <nsipc_send>
+  801c9b:	83 c4 10             	add    $0x10,%esp
+}
+  801c9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801ca3:	50                   	push   %eax
+  801ca4:	6a 01                	push   $0x1
+  801ca6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca9:	50                   	push   %eax
+  801caa:	ff 71 0c             	push   0xc(%ecx)
+  801cad:	e8 a6 06 00 00       	call   802358 <nsipc_sendmsg>
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	eb e7                	jmp    801c9e <devsock_write+0x35>
+
+00801cb7 <devsock_read>:
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+  801cba:	53                   	push   %ebx
+  801cbb:	83 ec 14             	sub    $0x14,%esp
+  801cbe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cc1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cc4:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801cc7:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801cca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801ccd:	8b 41 08             	mov    0x8(%ecx),%eax
+  801cd0:	c1 f8 09             	sar    $0x9,%eax
+  801cd3:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801cd6:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801cdc:	77 13                	ja     801cf1 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801cde:	50                   	push   %eax
+  801cdf:	52                   	push   %edx
+  801ce0:	53                   	push   %ebx
+  801ce1:	ff 71 0c             	push   0xc(%ecx)
+  801ce4:	e8 9c 05 00 00       	call   802285 <nsipc_recv>
+  801ce9:	83 c4 10             	add    $0x10,%esp
+}
+  801cec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cef:	c9                   	leave
+  801cf0:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801cf1:	50                   	push   %eax
+  801cf2:	6a 01                	push   $0x1
+  801cf4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf7:	50                   	push   %eax
+  801cf8:	ff 71 0c             	push   0xc(%ecx)
+  801cfb:	e8 02 0a 00 00       	call   802702 <nsipc_recvmsg>
+  801d00:	83 c4 10             	add    $0x10,%esp
+  801d03:	eb e7                	jmp    801cec <devsock_read+0x35>
+
+00801d05 <fd2sockid>:
+{
+  801d05:	55                   	push   %ebp
+  801d06:	89 e5                	mov    %esp,%ebp
+  801d08:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d0b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d0e:	52                   	push   %edx
+  801d0f:	50                   	push   %eax
+  801d10:	e8 0b f6 ff ff       	call   801320 <fd_lookup>
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	78 10                	js     801d2c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1f:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801d25:	39 08                	cmp    %ecx,(%eax)
+  801d27:	75 05                	jne    801d2e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d29:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d2c:	c9                   	leave
+  801d2d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d2e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d33:	eb f7                	jmp    801d2c <fd2sockid+0x27>
+
+00801d35 <sock_flags>:
+{
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801d3b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d3e:	52                   	push   %edx
+  801d3f:	50                   	push   %eax
+  801d40:	e8 db f5 ff ff       	call   801320 <fd_lookup>
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 0e                	js     801d5a <sock_flags+0x25>
+  801d4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d4f:	8b 40 08             	mov    0x8(%eax),%eax
+  801d52:	c1 e8 09             	shr    $0x9,%eax
+  801d55:	83 e0 08             	and    $0x8,%eax
+}
+  801d58:	c9                   	leave
+  801d59:	c3                   	ret
+		return 0;
+  801d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5f:	eb f7                	jmp    801d58 <sock_flags+0x23>
+
+00801d61 <alloc_sockfd>:
+{
+  801d61:	55                   	push   %ebp
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	56                   	push   %esi
+  801d65:	53                   	push   %ebx
+  801d66:	83 ec 1c             	sub    $0x1c,%esp
+  801d69:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6e:	50                   	push   %eax
+  801d6f:	e8 5c f5 ff ff       	call   8012d0 <fd_alloc>
+  801d74:	89 c3                	mov    %eax,%ebx
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 43                	js     801dc0 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d7d:	83 ec 04             	sub    $0x4,%esp
+  801d80:	68 07 04 00 00       	push   $0x407
+  801d85:	ff 75 f4             	push   -0xc(%ebp)
+  801d88:	6a 00                	push   $0x0
+  801d8a:	e8 b7 f0 ff ff       	call   800e46 <sys_page_alloc>
+  801d8f:	89 c3                	mov    %eax,%ebx
+  801d91:	83 c4 10             	add    $0x10,%esp
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 28                	js     801dc0 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d9b:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801da1:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801da3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801dad:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801db0:	83 ec 0c             	sub    $0xc,%esp
+  801db3:	50                   	push   %eax
+  801db4:	e8 f0 f4 ff ff       	call   8012a9 <fd2num>
+  801db9:	89 c3                	mov    %eax,%ebx
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	eb 0c                	jmp    801dcc <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801dc0:	83 ec 0c             	sub    $0xc,%esp
+  801dc3:	56                   	push   %esi
+  801dc4:	e8 4b 04 00 00       	call   802214 <nsipc_close>
+		return r;
+  801dc9:	83 c4 10             	add    $0x10,%esp
+}
+  801dcc:	89 d8                	mov    %ebx,%eax
+  801dce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd1:	5b                   	pop    %ebx
+  801dd2:	5e                   	pop    %esi
+  801dd3:	5d                   	pop    %ebp
+  801dd4:	c3                   	ret
+
+00801dd5 <accept>:
+{
+  801dd5:	55                   	push   %ebp
+  801dd6:	89 e5                	mov    %esp,%ebp
+  801dd8:	56                   	push   %esi
+  801dd9:	53                   	push   %ebx
+  801dda:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801ddd:	89 f0                	mov    %esi,%eax
+  801ddf:	e8 21 ff ff ff       	call   801d05 <fd2sockid>
+  801de4:	89 c3                	mov    %eax,%ebx
+  801de6:	85 c0                	test   %eax,%eax
+  801de8:	78 24                	js     801e0e <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801dea:	89 f0                	mov    %esi,%eax
+  801dec:	e8 44 ff ff ff       	call   801d35 <sock_flags>
+  801df1:	50                   	push   %eax
+  801df2:	ff 75 10             	push   0x10(%ebp)
+  801df5:	ff 75 0c             	push   0xc(%ebp)
+  801df8:	53                   	push   %ebx
+  801df9:	e8 6b 03 00 00       	call   802169 <nsipc_accept>
+  801dfe:	89 c3                	mov    %eax,%ebx
+  801e00:	83 c4 10             	add    $0x10,%esp
+  801e03:	85 c0                	test   %eax,%eax
+  801e05:	78 07                	js     801e0e <accept+0x39>
+	return alloc_sockfd(r);
+  801e07:	e8 55 ff ff ff       	call   801d61 <alloc_sockfd>
+  801e0c:	89 c3                	mov    %eax,%ebx
+}
+  801e0e:	89 d8                	mov    %ebx,%eax
+  801e10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e13:	5b                   	pop    %ebx
+  801e14:	5e                   	pop    %esi
+  801e15:	5d                   	pop    %ebp
+  801e16:	c3                   	ret
+
+00801e17 <bind>:
+{
+  801e17:	55                   	push   %ebp
+  801e18:	89 e5                	mov    %esp,%ebp
+  801e1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e20:	e8 e0 fe ff ff       	call   801d05 <fd2sockid>
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 12                	js     801e3b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e29:	83 ec 04             	sub    $0x4,%esp
+  801e2c:	ff 75 10             	push   0x10(%ebp)
+  801e2f:	ff 75 0c             	push   0xc(%ebp)
+  801e32:	50                   	push   %eax
+  801e33:	e8 85 03 00 00       	call   8021bd <nsipc_bind>
+  801e38:	83 c4 10             	add    $0x10,%esp
+}
+  801e3b:	c9                   	leave
+  801e3c:	c3                   	ret
+
+00801e3d <shutdown>:
+{
+  801e3d:	55                   	push   %ebp
+  801e3e:	89 e5                	mov    %esp,%ebp
+  801e40:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e46:	e8 ba fe ff ff       	call   801d05 <fd2sockid>
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	78 0f                	js     801e5e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e4f:	83 ec 08             	sub    $0x8,%esp
+  801e52:	ff 75 0c             	push   0xc(%ebp)
+  801e55:	50                   	push   %eax
+  801e56:	e8 97 03 00 00       	call   8021f2 <nsipc_shutdown>
+  801e5b:	83 c4 10             	add    $0x10,%esp
+}
+  801e5e:	c9                   	leave
+  801e5f:	c3                   	ret
+
+00801e60 <connect>:
+{
+  801e60:	55                   	push   %ebp
+  801e61:	89 e5                	mov    %esp,%ebp
+  801e63:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e69:	e8 97 fe ff ff       	call   801d05 <fd2sockid>
+  801e6e:	85 c0                	test   %eax,%eax
+  801e70:	78 12                	js     801e84 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e72:	83 ec 04             	sub    $0x4,%esp
+  801e75:	ff 75 10             	push   0x10(%ebp)
+  801e78:	ff 75 0c             	push   0xc(%ebp)
+  801e7b:	50                   	push   %eax
+  801e7c:	e8 ad 03 00 00       	call   80222e <nsipc_connect>
+  801e81:	83 c4 10             	add    $0x10,%esp
+}
+  801e84:	c9                   	leave
+  801e85:	c3                   	ret
+
+00801e86 <listen>:
+{
+  801e86:	55                   	push   %ebp
+  801e87:	89 e5                	mov    %esp,%ebp
+  801e89:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e8f:	e8 71 fe ff ff       	call   801d05 <fd2sockid>
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	78 0f                	js     801ea7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e98:	83 ec 08             	sub    $0x8,%esp
+  801e9b:	ff 75 0c             	push   0xc(%ebp)
+  801e9e:	50                   	push   %eax
+  801e9f:	e8 bf 03 00 00       	call   802263 <nsipc_listen>
+  801ea4:	83 c4 10             	add    $0x10,%esp
+}
+  801ea7:	c9                   	leave
+  801ea8:	c3                   	ret
+
+00801ea9 <sendmsg>:
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	57                   	push   %edi
+  801ead:	56                   	push   %esi
+  801eae:	53                   	push   %ebx
+  801eaf:	83 ec 0c             	sub    $0xc,%esp
+  801eb2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801eb5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801eb8:	89 f0                	mov    %esi,%eax
+  801eba:	e8 46 fe ff ff       	call   801d05 <fd2sockid>
+  801ebf:	89 c3                	mov    %eax,%ebx
+  801ec1:	85 c0                	test   %eax,%eax
+  801ec3:	78 1c                	js     801ee1 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801ec5:	89 f0                	mov    %esi,%eax
+  801ec7:	e8 69 fe ff ff       	call   801d35 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801ecc:	0b 45 10             	or     0x10(%ebp),%eax
+  801ecf:	50                   	push   %eax
+  801ed0:	ff 77 0c             	push   0xc(%edi)
+  801ed3:	ff 77 08             	push   0x8(%edi)
+  801ed6:	53                   	push   %ebx
+  801ed7:	e8 7c 04 00 00       	call   802358 <nsipc_sendmsg>
+  801edc:	89 c3                	mov    %eax,%ebx
+  801ede:	83 c4 10             	add    $0x10,%esp
+}
+  801ee1:	89 d8                	mov    %ebx,%eax
+  801ee3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee6:	5b                   	pop    %ebx
+  801ee7:	5e                   	pop    %esi
+  801ee8:	5f                   	pop    %edi
+  801ee9:	5d                   	pop    %ebp
+  801eea:	c3                   	ret
+
+00801eeb <recvmsg>:
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	57                   	push   %edi
+  801eef:	56                   	push   %esi
+  801ef0:	53                   	push   %ebx
+  801ef1:	83 ec 0c             	sub    $0xc,%esp
+  801ef4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ef7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801efa:	89 f8                	mov    %edi,%eax
+  801efc:	e8 04 fe ff ff       	call   801d05 <fd2sockid>
+  801f01:	89 c3                	mov    %eax,%ebx
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	78 2a                	js     801f31 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801f07:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801f0e:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801f15:	89 f8                	mov    %edi,%eax
+  801f17:	e8 19 fe ff ff       	call   801d35 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f1c:	0b 45 10             	or     0x10(%ebp),%eax
+  801f1f:	50                   	push   %eax
+  801f20:	ff 76 0c             	push   0xc(%esi)
+  801f23:	ff 76 08             	push   0x8(%esi)
+  801f26:	53                   	push   %ebx
+  801f27:	e8 d6 07 00 00       	call   802702 <nsipc_recvmsg>
+  801f2c:	89 c3                	mov    %eax,%ebx
+  801f2e:	83 c4 10             	add    $0x10,%esp
+}
+  801f31:	89 d8                	mov    %ebx,%eax
+  801f33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f36:	5b                   	pop    %ebx
+  801f37:	5e                   	pop    %esi
+  801f38:	5f                   	pop    %edi
+  801f39:	5d                   	pop    %ebp
+  801f3a:	c3                   	ret
+
+00801f3b <sendfile>:
+{
+  801f3b:	55                   	push   %ebp
+  801f3c:	89 e5                	mov    %esp,%ebp
+  801f3e:	56                   	push   %esi
+  801f3f:	53                   	push   %ebx
+  801f40:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f43:	89 f0                	mov    %esi,%eax
+  801f45:	e8 bb fd ff ff       	call   801d05 <fd2sockid>
+  801f4a:	89 c3                	mov    %eax,%ebx
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	78 1f                	js     801f6f <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801f50:	89 f0                	mov    %esi,%eax
+  801f52:	e8 de fd ff ff       	call   801d35 <sock_flags>
+  801f57:	83 ec 0c             	sub    $0xc,%esp
+  801f5a:	50                   	push   %eax
+  801f5b:	ff 75 14             	push   0x14(%ebp)
+  801f5e:	ff 75 10             	push   0x10(%ebp)
+  801f61:	ff 75 0c             	push   0xc(%ebp)
+  801f64:	53                   	push   %ebx
+  801f65:	e8 64 06 00 00       	call   8025ce <nsipc_sendfile>
+  801f6a:	89 c3                	mov    %eax,%ebx
+  801f6c:	83 c4 20             	add    $0x20,%esp
+}
+  801f6f:	89 d8                	mov    %ebx,%eax
+  801f71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f74:	5b                   	pop    %ebx
+  801f75:	5e                   	pop    %esi
+  801f76:	5d                   	pop    %ebp
+  801f77:	c3                   	ret
+
+00801f78 <evctl>:
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	53                   	push   %ebx
+  801f7c:	83 ec 04             	sub    $0x4,%esp
+  801f7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801f82:	89 d8                	mov    %ebx,%eax
+  801f84:	e8 7c fd ff ff       	call   801d05 <fd2sockid>
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	78 10                	js     801f9d <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801f8d:	83 ec 04             	sub    $0x4,%esp
+  801f90:	53                   	push   %ebx
+  801f91:	ff 75 0c             	push   0xc(%ebp)
+  801f94:	50                   	push   %eax
+  801f95:	e8 d2 0b 00 00       	call   802b6c <nsipc_evctl>
+  801f9a:	83 c4 10             	add    $0x10,%esp
+}
+  801f9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa0:	c9                   	leave
+  801fa1:	c3                   	ret
+
+00801fa2 <evwait>:
+{
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801fa8:	ff 75 10             	push   0x10(%ebp)
+  801fab:	ff 75 0c             	push   0xc(%ebp)
+  801fae:	ff 75 08             	push   0x8(%ebp)
+  801fb1:	e8 e0 0b 00 00       	call   802b96 <nsipc_evwait>
+}
+  801fb6:	c9                   	leave
+  801fb7:	c3                   	ret
+
+00801fb8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801fb8:	55                   	push   %ebp
+  801fb9:	89 e5                	mov    %esp,%ebp
+  801fbb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801fbe:	ff 75 10             	push   0x10(%ebp)
+  801fc1:	ff 75 0c             	push   0xc(%ebp)
+  801fc4:	ff 75 08             	push   0x8(%ebp)
+  801fc7:	e8 31 0c 00 00       	call   802bfd <nsipc_socket>
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	85 c0                	test   %eax,%eax
+  801fd1:	78 05                	js     801fd8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801fd3:	e8 89 fd ff ff       	call   801d61 <alloc_sockfd>
+}
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+
+00801fda <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801fda:	55                   	push   %ebp
+  801fdb:	89 e5                	mov    %esp,%ebp
+  801fdd:	53                   	push   %ebx
+  801fde:	83 ec 04             	sub    $0x4,%esp
+  801fe1:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801fe3:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801fea:	74 26                	je     802012 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801fec:	6a 07                	push   $0x7
+  801fee:	68 00 80 80 00       	push   $0x808000
+  801ff3:	53                   	push   %ebx
+  801ff4:	ff 35 24 63 80 00    	push   0x806324
+  801ffa:	e8 58 19 00 00       	call   803957 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801fff:	83 c4 0c             	add    $0xc,%esp
+  802002:	6a 00                	push   $0x0
+  802004:	6a 00                	push   $0x0
+  802006:	6a 00                	push   $0x0
+  802008:	e8 ba 16 00 00       	call   8036c7 <ipc_recv>
+}
+  80200d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802010:	c9                   	leave
+  802011:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802012:	83 ec 0c             	sub    $0xc,%esp
+  802015:	6a 03                	push   $0x3
+  802017:	e8 a4 19 00 00       	call   8039c0 <ipc_find_env>
+  80201c:	a3 24 63 80 00       	mov    %eax,0x806324
+  802021:	83 c4 10             	add    $0x10,%esp
+  802024:	eb c6                	jmp    801fec <nsipc+0x12>
+
+00802026 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802026:	55                   	push   %ebp
+  802027:	89 e5                	mov    %esp,%ebp
+  802029:	56                   	push   %esi
+  80202a:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80202b:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  802031:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802036:	85 f6                	test   %esi,%esi
+  802038:	75 33                	jne    80206d <nsbulk_map+0x47>
+  80203a:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80203f:	83 ec 04             	sub    $0x4,%esp
+  802042:	6a 07                	push   $0x7
+  802044:	53                   	push   %ebx
+  802045:	6a 00                	push   $0x0
+  802047:	e8 fa ed ff ff       	call   800e46 <sys_page_alloc>
+  80204c:	83 c4 10             	add    $0x10,%esp
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	78 1a                	js     80206d <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802053:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802059:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80205f:	75 de                	jne    80203f <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802061:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  802068:	00 00 00 
+	return 0;
+  80206b:	89 f0                	mov    %esi,%eax
+}
+  80206d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802070:	5b                   	pop    %ebx
+  802071:	5e                   	pop    %esi
+  802072:	5d                   	pop    %ebp
+  802073:	c3                   	ret
+
+00802074 <nsbulk_own>:
+{
+  802074:	55                   	push   %ebp
+  802075:	89 e5                	mov    %esp,%ebp
+  802077:	57                   	push   %edi
+  802078:	56                   	push   %esi
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80207f:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802082:	85 d2                	test   %edx,%edx
+  802084:	7f 0e                	jg     802094 <nsbulk_own+0x20>
+	return 0;
+  802086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208b:	eb 47                	jmp    8020d4 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80208d:	83 c3 01             	add    $0x1,%ebx
+  802090:	39 fb                	cmp    %edi,%ebx
+  802092:	7d 3b                	jge    8020cf <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802094:	be 01 00 00 00       	mov    $0x1,%esi
+  802099:	89 d9                	mov    %ebx,%ecx
+  80209b:	d3 e6                	shl    %cl,%esi
+  80209d:	89 f0                	mov    %esi,%eax
+  80209f:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  8020a5:	74 e6                	je     80208d <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8020a7:	83 ec 04             	sub    $0x4,%esp
+  8020aa:	6a 07                	push   $0x7
+  8020ac:	89 d8                	mov    %ebx,%eax
+  8020ae:	c1 e0 0c             	shl    $0xc,%eax
+  8020b1:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8020b6:	50                   	push   %eax
+  8020b7:	6a 00                	push   $0x0
+  8020b9:	e8 88 ed ff ff       	call   800e46 <sys_page_alloc>
+  8020be:	83 c4 10             	add    $0x10,%esp
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	78 0f                	js     8020d4 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8020c5:	f7 d6                	not    %esi
+  8020c7:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  8020cd:	eb be                	jmp    80208d <nsbulk_own+0x19>
+	return 0;
+  8020cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d7:	5b                   	pop    %ebx
+  8020d8:	5e                   	pop    %esi
+  8020d9:	5f                   	pop    %edi
+  8020da:	5d                   	pop    %ebp
+  8020db:	c3                   	ret
+
+008020dc <nsipc_bulk>:
+{
+  8020dc:	55                   	push   %ebp
+  8020dd:	89 e5                	mov    %esp,%ebp
+  8020df:	57                   	push   %edi
+  8020e0:	56                   	push   %esi
+  8020e1:	53                   	push   %ebx
+  8020e2:	83 ec 1c             	sub    $0x1c,%esp
+  8020e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020e8:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8020ea:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8020f0:	c1 fb 0c             	sar    $0xc,%ebx
+  8020f3:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8020f6:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8020fd:	74 56                	je     802155 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8020ff:	85 ff                	test   %edi,%edi
+  802101:	7e 24                	jle    802127 <nsipc_bulk+0x4b>
+  802103:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802109:	74 1c                	je     802127 <nsipc_bulk+0x4b>
+  80210b:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802111:	c1 e3 0c             	shl    $0xc,%ebx
+  802114:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802119:	0f b6 10             	movzbl (%eax),%edx
+  80211c:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80211e:	05 00 10 00 00       	add    $0x1000,%eax
+  802123:	39 d8                	cmp    %ebx,%eax
+  802125:	75 f2                	jne    802119 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802127:	83 ec 0c             	sub    $0xc,%esp
+  80212a:	56                   	push   %esi
+  80212b:	57                   	push   %edi
+  80212c:	68 00 00 00 e0       	push   $0xe0000000
+  802131:	ff 75 e4             	push   -0x1c(%ebp)
+  802134:	ff 35 24 63 80 00    	push   0x806324
+  80213a:	e8 4c 18 00 00       	call   80398b <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80213f:	83 c4 1c             	add    $0x1c,%esp
+  802142:	6a 00                	push   $0x0
+  802144:	6a 00                	push   $0x0
+  802146:	6a 00                	push   $0x0
+  802148:	e8 7a 15 00 00       	call   8036c7 <ipc_recv>
+}
+  80214d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802150:	5b                   	pop    %ebx
+  802151:	5e                   	pop    %esi
+  802152:	5f                   	pop    %edi
+  802153:	5d                   	pop    %ebp
+  802154:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802155:	83 ec 0c             	sub    $0xc,%esp
+  802158:	6a 03                	push   $0x3
+  80215a:	e8 61 18 00 00       	call   8039c0 <ipc_find_env>
+  80215f:	a3 24 63 80 00       	mov    %eax,0x806324
+  802164:	83 c4 10             	add    $0x10,%esp
+  802167:	eb 96                	jmp    8020ff <nsipc_bulk+0x23>
+
+00802169 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	53                   	push   %ebx
+  80216d:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802170:	8b 45 08             	mov    0x8(%ebp),%eax
+  802173:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802178:	8b 45 14             	mov    0x14(%ebp),%eax
+  80217b:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802180:	b8 01 00 00 00       	mov    $0x1,%eax
+  802185:	e8 50 fe ff ff       	call   801fda <nsipc>
+  80218a:	89 c3                	mov    %eax,%ebx
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	79 07                	jns    802197 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802190:	89 d8                	mov    %ebx,%eax
+  802192:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802195:	c9                   	leave
+  802196:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802197:	83 ec 04             	sub    $0x4,%esp
+  80219a:	ff 35 10 80 80 00    	push   0x808010
+  8021a0:	68 00 80 80 00       	push   $0x808000
+  8021a5:	ff 75 0c             	push   0xc(%ebp)
+  8021a8:	e8 15 ea ff ff       	call   800bc2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8021ad:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8021b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021b6:	89 10                	mov    %edx,(%eax)
+  8021b8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8021bb:	eb d3                	jmp    802190 <nsipc_accept+0x27>
+
+008021bd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8021bd:	55                   	push   %ebp
+  8021be:	89 e5                	mov    %esp,%ebp
+  8021c0:	53                   	push   %ebx
+  8021c1:	83 ec 08             	sub    $0x8,%esp
+  8021c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8021c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ca:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8021cf:	53                   	push   %ebx
+  8021d0:	ff 75 0c             	push   0xc(%ebp)
+  8021d3:	68 04 80 80 00       	push   $0x808004
+  8021d8:	e8 e5 e9 ff ff       	call   800bc2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8021dd:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8021e3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021e8:	e8 ed fd ff ff       	call   801fda <nsipc>
+}
+  8021ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+
+008021f2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8021f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802200:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802203:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802208:	b8 03 00 00 00       	mov    $0x3,%eax
+  80220d:	e8 c8 fd ff ff       	call   801fda <nsipc>
+}
+  802212:	c9                   	leave
+  802213:	c3                   	ret
+
+00802214 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80221a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802222:	b8 04 00 00 00       	mov    $0x4,%eax
+  802227:	e8 ae fd ff ff       	call   801fda <nsipc>
+}
+  80222c:	c9                   	leave
+  80222d:	c3                   	ret
+
+0080222e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	53                   	push   %ebx
+  802232:	83 ec 08             	sub    $0x8,%esp
+  802235:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802238:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223b:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802240:	53                   	push   %ebx
+  802241:	ff 75 0c             	push   0xc(%ebp)
+  802244:	68 04 80 80 00       	push   $0x808004
+  802249:	e8 74 e9 ff ff       	call   800bc2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80224e:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802254:	b8 05 00 00 00       	mov    $0x5,%eax
+  802259:	e8 7c fd ff ff       	call   801fda <nsipc>
+}
+  80225e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802261:	c9                   	leave
+  802262:	c3                   	ret
+
+00802263 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+  802266:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802271:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802274:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802279:	b8 06 00 00 00       	mov    $0x6,%eax
+  80227e:	e8 57 fd ff ff       	call   801fda <nsipc>
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	56                   	push   %esi
+  802289:	53                   	push   %ebx
+  80228a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80228d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802290:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802295:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80229b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80229e:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8022a3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8022a8:	e8 2d fd ff ff       	call   801fda <nsipc>
+  8022ad:	89 c3                	mov    %eax,%ebx
+  8022af:	85 c0                	test   %eax,%eax
+  8022b1:	78 22                	js     8022d5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8022b3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8022b8:	39 c6                	cmp    %eax,%esi
+  8022ba:	0f 4e c6             	cmovle %esi,%eax
+  8022bd:	39 c3                	cmp    %eax,%ebx
+  8022bf:	7f 1d                	jg     8022de <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8022c1:	83 ec 04             	sub    $0x4,%esp
+  8022c4:	53                   	push   %ebx
+  8022c5:	68 00 80 80 00       	push   $0x808000
+  8022ca:	ff 75 0c             	push   0xc(%ebp)
+  8022cd:	e8 f0 e8 ff ff       	call   800bc2 <memmove>
+  8022d2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8022d5:	89 d8                	mov    %ebx,%eax
+  8022d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022da:	5b                   	pop    %ebx
+  8022db:	5e                   	pop    %esi
+  8022dc:	5d                   	pop    %ebp
+  8022dd:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8022de:	68 54 44 80 00       	push   $0x804454
+  8022e3:	68 69 44 80 00       	push   $0x804469
+  8022e8:	68 b2 00 00 00       	push   $0xb2
+  8022ed:	68 7e 44 80 00       	push   $0x80447e
+  8022f2:	e8 8a 13 00 00       	call   803681 <_panic>
+
+008022f7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8022f7:	55                   	push   %ebp
+  8022f8:	89 e5                	mov    %esp,%ebp
+  8022fa:	53                   	push   %ebx
+  8022fb:	83 ec 04             	sub    $0x4,%esp
+  8022fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802301:	8b 45 08             	mov    0x8(%ebp),%eax
+  802304:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802309:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80230f:	7f 2e                	jg     80233f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802311:	83 ec 04             	sub    $0x4,%esp
+  802314:	53                   	push   %ebx
+  802315:	ff 75 0c             	push   0xc(%ebp)
+  802318:	68 0c 80 80 00       	push   $0x80800c
+  80231d:	e8 a0 e8 ff ff       	call   800bc2 <memmove>
+	nsipcbuf.send.req_size = size;
+  802322:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802328:	8b 45 14             	mov    0x14(%ebp),%eax
+  80232b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802330:	b8 08 00 00 00       	mov    $0x8,%eax
+  802335:	e8 a0 fc ff ff       	call   801fda <nsipc>
+}
+  80233a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233d:	c9                   	leave
+  80233e:	c3                   	ret
+	assert(size < 1600);
+  80233f:	68 8a 44 80 00       	push   $0x80448a
+  802344:	68 69 44 80 00       	push   $0x804469
+  802349:	68 bd 00 00 00       	push   $0xbd
+  80234e:	68 7e 44 80 00       	push   $0x80447e
+  802353:	e8 29 13 00 00       	call   803681 <_panic>
+
+00802358 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	57                   	push   %edi
+  80235c:	56                   	push   %esi
+  80235d:	53                   	push   %ebx
+  80235e:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802361:	e8 c0 fc ff ff       	call   802026 <nsbulk_map>
+  802366:	85 c0                	test   %eax,%eax
+  802368:	78 55                	js     8023bf <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  80236a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802371:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802378:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80237f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802382:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802385:	0f 8d 24 02 00 00    	jge    8025af <nsipc_sendmsg+0x257>
+  80238b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80238e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802391:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802394:	89 d8                	mov    %ebx,%eax
+  802396:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80239b:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80239d:	83 ec 0c             	sub    $0xc,%esp
+  8023a0:	68 20 60 80 00       	push   $0x806020
+  8023a5:	e8 5a 0f 00 00       	call   803304 <pgbatch_init>
+  8023aa:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8023ad:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8023af:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8023b2:	e9 82 00 00 00       	jmp    802439 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8023b7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8023ba:	85 db                	test   %ebx,%ebx
+  8023bc:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8023bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c2:	5b                   	pop    %ebx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5f                   	pop    %edi
+  8023c5:	5d                   	pop    %ebp
+  8023c6:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8023c7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8023cc:	29 c8                	sub    %ecx,%eax
+  8023ce:	39 d0                	cmp    %edx,%eax
+  8023d0:	0f 46 d0             	cmovbe %eax,%edx
+  8023d3:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8023d5:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8023db:	85 ff                	test   %edi,%edi
+  8023dd:	0f 49 c7             	cmovns %edi,%eax
+  8023e0:	c1 f8 0c             	sar    $0xc,%eax
+  8023e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8023e8:	e8 87 fc ff ff       	call   802074 <nsbulk_own>
+  8023ed:	85 c0                	test   %eax,%eax
+  8023ef:	0f 88 17 01 00 00    	js     80250c <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8023f5:	83 ec 04             	sub    $0x4,%esp
+  8023f8:	56                   	push   %esi
+  8023f9:	ff 75 e0             	push   -0x20(%ebp)
+  8023fc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8023ff:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802404:	50                   	push   %eax
+  802405:	e8 b8 e7 ff ff       	call   800bc2 <memmove>
+  80240a:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80240d:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802410:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802413:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802416:	0f 84 fd 00 00 00    	je     802519 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80241c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80241f:	01 f7                	add    %esi,%edi
+  802421:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802424:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802427:	0f 8d 01 01 00 00    	jge    80252e <nsipc_sendmsg+0x1d6>
+  80242d:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802433:	0f 8f f0 00 00 00    	jg     802529 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802439:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80243c:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80243f:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802442:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802445:	89 c2                	mov    %eax,%edx
+  802447:	03 13                	add    (%ebx),%edx
+  802449:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80244c:	8b 73 04             	mov    0x4(%ebx),%esi
+  80244f:	29 c6                	sub    %eax,%esi
+  802451:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802456:	29 f9                	sub    %edi,%ecx
+  802458:	39 ce                	cmp    %ecx,%esi
+  80245a:	89 ca                	mov    %ecx,%edx
+  80245c:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  80245f:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802462:	89 f9                	mov    %edi,%ecx
+  802464:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  80246a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80246d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802472:	09 c8                	or     %ecx,%eax
+  802474:	0f 85 4d ff ff ff    	jne    8023c7 <nsipc_sendmsg+0x6f>
+  80247a:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802480:	0f 86 41 ff ff ff    	jbe    8023c7 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802486:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80248c:	85 ff                	test   %edi,%edi
+  80248e:	0f 49 c7             	cmovns %edi,%eax
+  802491:	c1 f8 0c             	sar    $0xc,%eax
+  802494:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802496:	89 d1                	mov    %edx,%ecx
+  802498:	c1 e9 0c             	shr    $0xc,%ecx
+  80249b:	01 c8                	add    %ecx,%eax
+  80249d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024a0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024a3:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8024a5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8024a8:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8024ad:	29 c8                	sub    %ecx,%eax
+  8024af:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8024b2:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8024b5:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024bc:	89 f9                	mov    %edi,%ecx
+  8024be:	d3 e0                	shl    %cl,%eax
+  8024c0:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8024c6:	83 ec 08             	sub    $0x8,%esp
+  8024c9:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8024cb:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8024ce:	50                   	push   %eax
+  8024cf:	6a 00                	push   $0x0
+  8024d1:	56                   	push   %esi
+  8024d2:	6a 00                	push   $0x0
+  8024d4:	68 20 60 80 00       	push   $0x806020
+  8024d9:	e8 e4 0e 00 00       	call   8033c2 <pgbatch_map>
+  8024de:	83 c4 20             	add    $0x20,%esp
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	0f 88 ce fe ff ff    	js     8023b7 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8024e9:	83 c7 01             	add    $0x1,%edi
+  8024ec:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8024f2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8024f5:	39 c7                	cmp    %eax,%edi
+  8024f7:	75 be                	jne    8024b7 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8024f9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8024fc:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8024ff:	89 d6                	mov    %edx,%esi
+  802501:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802507:	e9 01 ff ff ff       	jmp    80240d <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80250c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80250f:	85 db                	test   %ebx,%ebx
+  802511:	0f 45 c3             	cmovne %ebx,%eax
+  802514:	e9 a6 fe ff ff       	jmp    8023bf <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802519:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80251d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802524:	e9 f3 fe ff ff       	jmp    80241c <nsipc_sendmsg+0xc4>
+  802529:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80252c:	eb 03                	jmp    802531 <nsipc_sendmsg+0x1d9>
+  80252e:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802531:	83 ec 0c             	sub    $0xc,%esp
+  802534:	68 20 60 80 00       	push   $0x806020
+  802539:	e8 d4 0d 00 00       	call   803312 <pgbatch_flush>
+  80253e:	83 c4 10             	add    $0x10,%esp
+  802541:	85 c0                	test   %eax,%eax
+  802543:	78 50                	js     802595 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802545:	8b 45 08             	mov    0x8(%ebp),%eax
+  802548:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80254d:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802553:	89 fb                	mov    %edi,%ebx
+  802555:	29 f3                	sub    %esi,%ebx
+  802557:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80255d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802560:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802565:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80256a:	89 fa                	mov    %edi,%edx
+  80256c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802571:	e8 66 fb ff ff       	call   8020dc <nsipc_bulk>
+  802576:	85 c0                	test   %eax,%eax
+  802578:	78 28                	js     8025a2 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80257a:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80257d:	39 c3                	cmp    %eax,%ebx
+  80257f:	75 0c                	jne    80258d <nsipc_sendmsg+0x235>
+  802581:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802584:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802587:	0f 8f f2 fd ff ff    	jg     80237f <nsipc_sendmsg+0x27>
+		sent += r;
+  80258d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802590:	e9 2a fe ff ff       	jmp    8023bf <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802595:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802598:	85 db                	test   %ebx,%ebx
+  80259a:	0f 45 c3             	cmovne %ebx,%eax
+  80259d:	e9 1d fe ff ff       	jmp    8023bf <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8025a2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025a5:	85 db                	test   %ebx,%ebx
+  8025a7:	0f 45 c3             	cmovne %ebx,%eax
+  8025aa:	e9 10 fe ff ff       	jmp    8023bf <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8025af:	83 ec 0c             	sub    $0xc,%esp
+  8025b2:	68 20 60 80 00       	push   $0x806020
+  8025b7:	e8 48 0d 00 00       	call   803304 <pgbatch_init>
+  8025bc:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8025bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c9:	e9 63 ff ff ff       	jmp    802531 <nsipc_sendmsg+0x1d9>
+
+008025ce <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8025ce:	55                   	push   %ebp
+  8025cf:	89 e5                	mov    %esp,%ebp
+  8025d1:	57                   	push   %edi
+  8025d2:	56                   	push   %esi
+  8025d3:	53                   	push   %ebx
+  8025d4:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8025d7:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  8025de:	0f 84 c8 00 00 00    	je     8026ac <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8025e4:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8025eb:	0f 84 e4 00 00 00    	je     8026d5 <nsipc_sendfile+0x107>
+{
+  8025f1:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8025f6:	89 fb                	mov    %edi,%ebx
+  8025f8:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8025fb:	0f 83 f0 00 00 00    	jae    8026f1 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802601:	89 fa                	mov    %edi,%edx
+  802603:	03 55 10             	add    0x10(%ebp),%edx
+  802606:	89 d0                	mov    %edx,%eax
+  802608:	c1 f8 1f             	sar    $0x1f,%eax
+  80260b:	c1 e8 14             	shr    $0x14,%eax
+  80260e:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802611:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802617:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802619:	6a 10                	push   $0x10
+  80261b:	68 00 20 01 e0       	push   $0xe0012000
+  802620:	52                   	push   %edx
+  802621:	ff 75 0c             	push   0xc(%ebp)
+  802624:	e8 fe f4 ff ff       	call   801b27 <fmap>
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	85 c0                	test   %eax,%eax
+  80262e:	0f 8e b8 00 00 00    	jle    8026ec <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802634:	39 c6                	cmp    %eax,%esi
+  802636:	0f 8d b5 00 00 00    	jge    8026f1 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80263c:	29 f0                	sub    %esi,%eax
+  80263e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802641:	29 da                	sub    %ebx,%edx
+  802643:	39 d0                	cmp    %edx,%eax
+  802645:	89 d3                	mov    %edx,%ebx
+  802647:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80264a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264d:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802652:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802658:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  80265e:	8b 45 18             	mov    0x18(%ebp),%eax
+  802661:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802666:	83 ec 0c             	sub    $0xc,%esp
+  802669:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80266b:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802672:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802675:	83 c0 01             	add    $0x1,%eax
+  802678:	50                   	push   %eax
+  802679:	68 00 10 01 e0       	push   $0xe0011000
+  80267e:	6a 11                	push   $0x11
+  802680:	ff 35 24 63 80 00    	push   0x806324
+  802686:	e8 00 13 00 00       	call   80398b <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80268b:	83 c4 1c             	add    $0x1c,%esp
+  80268e:	6a 00                	push   $0x0
+  802690:	6a 00                	push   $0x0
+  802692:	6a 00                	push   $0x0
+  802694:	e8 2e 10 00 00       	call   8036c7 <ipc_recv>
+  802699:	83 c4 10             	add    $0x10,%esp
+  80269c:	85 c0                	test   %eax,%eax
+  80269e:	78 5b                	js     8026fb <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8026a0:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8026a2:	39 c3                	cmp    %eax,%ebx
+  8026a4:	0f 8e 4c ff ff ff    	jle    8025f6 <nsipc_sendfile+0x28>
+  8026aa:	eb 45                	jmp    8026f1 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8026ac:	83 ec 04             	sub    $0x4,%esp
+  8026af:	6a 07                	push   $0x7
+  8026b1:	68 00 10 01 e0       	push   $0xe0011000
+  8026b6:	6a 00                	push   $0x0
+  8026b8:	e8 89 e7 ff ff       	call   800e46 <sys_page_alloc>
+  8026bd:	89 c7                	mov    %eax,%edi
+  8026bf:	83 c4 10             	add    $0x10,%esp
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	78 2b                	js     8026f1 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8026c6:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  8026cd:	00 00 00 
+  8026d0:	e9 0f ff ff ff       	jmp    8025e4 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8026d5:	83 ec 0c             	sub    $0xc,%esp
+  8026d8:	6a 03                	push   $0x3
+  8026da:	e8 e1 12 00 00       	call   8039c0 <ipc_find_env>
+  8026df:	a3 24 63 80 00       	mov    %eax,0x806324
+  8026e4:	83 c4 10             	add    $0x10,%esp
+  8026e7:	e9 05 ff ff ff       	jmp    8025f1 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8026ec:	85 ff                	test   %edi,%edi
+  8026ee:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8026f1:	89 f8                	mov    %edi,%eax
+  8026f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f6:	5b                   	pop    %ebx
+  8026f7:	5e                   	pop    %esi
+  8026f8:	5f                   	pop    %edi
+  8026f9:	5d                   	pop    %ebp
+  8026fa:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8026fb:	85 ff                	test   %edi,%edi
+  8026fd:	0f 44 f8             	cmove  %eax,%edi
+  802700:	eb ef                	jmp    8026f1 <nsipc_sendfile+0x123>
+
+00802702 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	57                   	push   %edi
+  802706:	56                   	push   %esi
+  802707:	53                   	push   %ebx
+  802708:	83 ec 1c             	sub    $0x1c,%esp
+  80270b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80270e:	e8 13 f9 ff ff       	call   802026 <nsbulk_map>
+  802713:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802716:	85 c0                	test   %eax,%eax
+  802718:	0f 88 ba 00 00 00    	js     8027d8 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80271e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802722:	0f 8e bb 00 00 00    	jle    8027e3 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802728:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80272d:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802732:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802737:	89 f8                	mov    %edi,%eax
+  802739:	29 f0                	sub    %esi,%eax
+  80273b:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80273f:	39 c8                	cmp    %ecx,%eax
+  802741:	0f 47 c1             	cmova  %ecx,%eax
+  802744:	01 f0                	add    %esi,%eax
+  802746:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802748:	83 c2 01             	add    $0x1,%edx
+  80274b:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80274e:	7e 07                	jle    802757 <nsipc_recvmsg+0x55>
+  802750:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802755:	7e e0                	jle    802737 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802757:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80275d:	c1 fa 0c             	sar    $0xc,%edx
+  802760:	b8 00 00 00 00       	mov    $0x0,%eax
+  802765:	e8 0a f9 ff ff       	call   802074 <nsbulk_own>
+  80276a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	78 67                	js     8027d8 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802771:	8b 45 08             	mov    0x8(%ebp),%eax
+  802774:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802779:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80277f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802782:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802787:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80278c:	89 f2                	mov    %esi,%edx
+  80278e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802793:	e8 44 f9 ff ff       	call   8020dc <nsipc_bulk>
+  802798:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80279b:	85 c0                	test   %eax,%eax
+  80279d:	78 39                	js     8027d8 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  80279f:	39 f0                	cmp    %esi,%eax
+  8027a1:	7f 4a                	jg     8027ed <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8027a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027a8:	85 c0                	test   %eax,%eax
+  8027aa:	7e 2c                	jle    8027d8 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8027ac:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8027af:	29 fe                	sub    %edi,%esi
+  8027b1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027b4:	39 c6                	cmp    %eax,%esi
+  8027b6:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8027b9:	83 ec 04             	sub    $0x4,%esp
+  8027bc:	56                   	push   %esi
+  8027bd:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8027c3:	50                   	push   %eax
+  8027c4:	ff 33                	push   (%ebx)
+  8027c6:	e8 f7 e3 ff ff       	call   800bc2 <memmove>
+		n += m;
+  8027cb:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8027cd:	83 c3 08             	add    $0x8,%ebx
+  8027d0:	83 c4 10             	add    $0x10,%esp
+  8027d3:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8027d6:	7f d4                	jg     8027ac <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8027d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027de:	5b                   	pop    %ebx
+  8027df:	5e                   	pop    %esi
+  8027e0:	5f                   	pop    %edi
+  8027e1:	5d                   	pop    %ebp
+  8027e2:	c3                   	ret
+	int r, i, n, len = 0;
+  8027e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e8:	e9 6a ff ff ff       	jmp    802757 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8027ed:	68 60 44 80 00       	push   $0x804460
+  8027f2:	68 69 44 80 00       	push   $0x804469
+  8027f7:	68 3b 01 00 00       	push   $0x13b
+  8027fc:	68 7e 44 80 00       	push   $0x80447e
+  802801:	e8 7b 0e 00 00       	call   803681 <_panic>
+
+00802806 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802806:	55                   	push   %ebp
+  802807:	89 e5                	mov    %esp,%ebp
+  802809:	57                   	push   %edi
+  80280a:	56                   	push   %esi
+  80280b:	53                   	push   %ebx
+  80280c:	83 ec 0c             	sub    $0xc,%esp
+  80280f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802812:	8b 75 10             	mov    0x10(%ebp),%esi
+  802815:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802818:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802820:	8b 07                	mov    (%edi),%eax
+  802822:	a3 04 80 80 00       	mov    %eax,0x808004
+  802827:	8b 47 04             	mov    0x4(%edi),%eax
+  80282a:	a3 08 80 80 00       	mov    %eax,0x808008
+  80282f:	8b 47 08             	mov    0x8(%edi),%eax
+  802832:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802837:	8b 47 0c             	mov    0xc(%edi),%eax
+  80283a:	a3 10 80 80 00       	mov    %eax,0x808010
+  80283f:	8b 47 10             	mov    0x10(%edi),%eax
+  802842:	a3 14 80 80 00       	mov    %eax,0x808014
+  802847:	8b 47 14             	mov    0x14(%edi),%eax
+  80284a:	a3 18 80 80 00       	mov    %eax,0x808018
+  80284f:	8b 47 18             	mov    0x18(%edi),%eax
+  802852:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802857:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80285a:	a3 20 80 80 00       	mov    %eax,0x808020
+  80285f:	8b 47 20             	mov    0x20(%edi),%eax
+  802862:	a3 24 80 80 00       	mov    %eax,0x808024
+  802867:	8b 47 24             	mov    0x24(%edi),%eax
+  80286a:	a3 28 80 80 00       	mov    %eax,0x808028
+  80286f:	8b 47 28             	mov    0x28(%edi),%eax
+  802872:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802877:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80287a:	a3 30 80 80 00       	mov    %eax,0x808030
+  80287f:	8b 47 30             	mov    0x30(%edi),%eax
+  802882:	a3 34 80 80 00       	mov    %eax,0x808034
+  802887:	8b 47 34             	mov    0x34(%edi),%eax
+  80288a:	a3 38 80 80 00       	mov    %eax,0x808038
+  80288f:	8b 47 38             	mov    0x38(%edi),%eax
+  802892:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802897:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80289a:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  80289f:	8b 06                	mov    (%esi),%eax
+  8028a1:	a3 44 80 80 00       	mov    %eax,0x808044
+  8028a6:	8b 46 04             	mov    0x4(%esi),%eax
+  8028a9:	a3 48 80 80 00       	mov    %eax,0x808048
+  8028ae:	8b 46 08             	mov    0x8(%esi),%eax
+  8028b1:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8028b6:	8b 46 0c             	mov    0xc(%esi),%eax
+  8028b9:	a3 50 80 80 00       	mov    %eax,0x808050
+  8028be:	8b 46 10             	mov    0x10(%esi),%eax
+  8028c1:	a3 54 80 80 00       	mov    %eax,0x808054
+  8028c6:	8b 46 14             	mov    0x14(%esi),%eax
+  8028c9:	a3 58 80 80 00       	mov    %eax,0x808058
+  8028ce:	8b 46 18             	mov    0x18(%esi),%eax
+  8028d1:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8028d6:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8028d9:	a3 60 80 80 00       	mov    %eax,0x808060
+  8028de:	8b 46 20             	mov    0x20(%esi),%eax
+  8028e1:	a3 64 80 80 00       	mov    %eax,0x808064
+  8028e6:	8b 46 24             	mov    0x24(%esi),%eax
+  8028e9:	a3 68 80 80 00       	mov    %eax,0x808068
+  8028ee:	8b 46 28             	mov    0x28(%esi),%eax
+  8028f1:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8028f6:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8028f9:	a3 70 80 80 00       	mov    %eax,0x808070
+  8028fe:	8b 46 30             	mov    0x30(%esi),%eax
+  802901:	a3 74 80 80 00       	mov    %eax,0x808074
+  802906:	8b 46 34             	mov    0x34(%esi),%eax
+  802909:	a3 78 80 80 00       	mov    %eax,0x808078
+  80290e:	8b 46 38             	mov    0x38(%esi),%eax
+  802911:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802916:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802919:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80291e:	8b 03                	mov    (%ebx),%eax
+  802920:	a3 84 80 80 00       	mov    %eax,0x808084
+  802925:	8b 43 04             	mov    0x4(%ebx),%eax
+  802928:	a3 88 80 80 00       	mov    %eax,0x808088
+  80292d:	8b 43 08             	mov    0x8(%ebx),%eax
+  802930:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802935:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802938:	a3 90 80 80 00       	mov    %eax,0x808090
+  80293d:	8b 43 10             	mov    0x10(%ebx),%eax
+  802940:	a3 94 80 80 00       	mov    %eax,0x808094
+  802945:	8b 43 14             	mov    0x14(%ebx),%eax
+  802948:	a3 98 80 80 00       	mov    %eax,0x808098
+  80294d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802950:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802955:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802958:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  80295d:	8b 43 20             	mov    0x20(%ebx),%eax
+  802960:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802965:	8b 43 24             	mov    0x24(%ebx),%eax
+  802968:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80296d:	8b 43 28             	mov    0x28(%ebx),%eax
+  802970:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802975:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802978:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  80297d:	8b 43 30             	mov    0x30(%ebx),%eax
+  802980:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802985:	8b 43 34             	mov    0x34(%ebx),%eax
+  802988:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80298d:	8b 43 38             	mov    0x38(%ebx),%eax
+  802990:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802995:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802998:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80299d:	8b 45 18             	mov    0x18(%ebp),%eax
+  8029a0:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8029a5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8029aa:	e8 2b f6 ff ff       	call   801fda <nsipc>
+  8029af:	85 c0                	test   %eax,%eax
+  8029b1:	0f 88 ad 01 00 00    	js     802b64 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8029b7:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8029bd:	89 17                	mov    %edx,(%edi)
+  8029bf:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8029c5:	89 57 04             	mov    %edx,0x4(%edi)
+  8029c8:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8029ce:	89 57 08             	mov    %edx,0x8(%edi)
+  8029d1:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8029d7:	89 57 0c             	mov    %edx,0xc(%edi)
+  8029da:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8029e0:	89 57 10             	mov    %edx,0x10(%edi)
+  8029e3:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8029e9:	89 57 14             	mov    %edx,0x14(%edi)
+  8029ec:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8029f2:	89 57 18             	mov    %edx,0x18(%edi)
+  8029f5:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8029fb:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8029fe:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802a04:	89 57 20             	mov    %edx,0x20(%edi)
+  802a07:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802a0d:	89 57 24             	mov    %edx,0x24(%edi)
+  802a10:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802a16:	89 57 28             	mov    %edx,0x28(%edi)
+  802a19:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802a1f:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802a22:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802a28:	89 57 30             	mov    %edx,0x30(%edi)
+  802a2b:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802a31:	89 57 34             	mov    %edx,0x34(%edi)
+  802a34:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802a3a:	89 57 38             	mov    %edx,0x38(%edi)
+  802a3d:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802a43:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802a46:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802a4c:	89 16                	mov    %edx,(%esi)
+  802a4e:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802a54:	89 56 04             	mov    %edx,0x4(%esi)
+  802a57:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802a5d:	89 56 08             	mov    %edx,0x8(%esi)
+  802a60:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802a66:	89 56 0c             	mov    %edx,0xc(%esi)
+  802a69:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802a6f:	89 56 10             	mov    %edx,0x10(%esi)
+  802a72:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802a78:	89 56 14             	mov    %edx,0x14(%esi)
+  802a7b:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802a81:	89 56 18             	mov    %edx,0x18(%esi)
+  802a84:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802a8a:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802a8d:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802a93:	89 56 20             	mov    %edx,0x20(%esi)
+  802a96:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802a9c:	89 56 24             	mov    %edx,0x24(%esi)
+  802a9f:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802aa5:	89 56 28             	mov    %edx,0x28(%esi)
+  802aa8:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802aae:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802ab1:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802ab7:	89 56 30             	mov    %edx,0x30(%esi)
+  802aba:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802ac0:	89 56 34             	mov    %edx,0x34(%esi)
+  802ac3:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802ac9:	89 56 38             	mov    %edx,0x38(%esi)
+  802acc:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802ad2:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802ad5:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802adb:	89 13                	mov    %edx,(%ebx)
+  802add:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802ae3:	89 53 04             	mov    %edx,0x4(%ebx)
+  802ae6:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802aec:	89 53 08             	mov    %edx,0x8(%ebx)
+  802aef:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802af5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802af8:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802afe:	89 53 10             	mov    %edx,0x10(%ebx)
+  802b01:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802b07:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b0a:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802b10:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b13:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802b19:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b1c:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802b22:	89 53 20             	mov    %edx,0x20(%ebx)
+  802b25:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802b2b:	89 53 24             	mov    %edx,0x24(%ebx)
+  802b2e:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802b34:	89 53 28             	mov    %edx,0x28(%ebx)
+  802b37:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802b3d:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802b40:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802b46:	89 53 30             	mov    %edx,0x30(%ebx)
+  802b49:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802b4f:	89 53 34             	mov    %edx,0x34(%ebx)
+  802b52:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802b58:	89 53 38             	mov    %edx,0x38(%ebx)
+  802b5b:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802b61:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802b64:	83 c4 0c             	add    $0xc,%esp
+  802b67:	5b                   	pop    %ebx
+  802b68:	5e                   	pop    %esi
+  802b69:	5f                   	pop    %edi
+  802b6a:	5d                   	pop    %ebp
+  802b6b:	c3                   	ret
+
+00802b6c <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802b6c:	55                   	push   %ebp
+  802b6d:	89 e5                	mov    %esp,%ebp
+  802b6f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802b72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b75:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802b7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b7d:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802b82:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b85:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802b8a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802b8f:	e8 46 f4 ff ff       	call   801fda <nsipc>
+}
+  802b94:	c9                   	leave
+  802b95:	c3                   	ret
+
+00802b96 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802b96:	55                   	push   %ebp
+  802b97:	89 e5                	mov    %esp,%ebp
+  802b99:	56                   	push   %esi
+  802b9a:	53                   	push   %ebx
+  802b9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802b9e:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802ba4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ba7:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802bac:	b8 10 00 00 00       	mov    $0x10,%eax
+  802bb1:	e8 24 f4 ff ff       	call   801fda <nsipc>
+  802bb6:	89 c3                	mov    %eax,%ebx
+  802bb8:	85 c0                	test   %eax,%eax
+  802bba:	7e 1f                	jle    802bdb <nsipc_evwait+0x45>
+		assert(r <= max);
+  802bbc:	39 c6                	cmp    %eax,%esi
+  802bbe:	7c 24                	jl     802be4 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802bc0:	83 ec 04             	sub    $0x4,%esp
+  802bc3:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802bca:	50                   	push   %eax
+  802bcb:	68 00 80 80 00       	push   $0x808000
+  802bd0:	ff 75 08             	push   0x8(%ebp)
+  802bd3:	e8 ea df ff ff       	call   800bc2 <memmove>
+  802bd8:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802bdb:	89 d8                	mov    %ebx,%eax
+  802bdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be0:	5b                   	pop    %ebx
+  802be1:	5e                   	pop    %esi
+  802be2:	5d                   	pop    %ebp
+  802be3:	c3                   	ret
+		assert(r <= max);
+  802be4:	68 96 44 80 00       	push   $0x804496
+  802be9:	68 69 44 80 00       	push   $0x804469
+  802bee:	68 6a 01 00 00       	push   $0x16a
+  802bf3:	68 7e 44 80 00       	push   $0x80447e
+  802bf8:	e8 84 0a 00 00       	call   803681 <_panic>
+
+00802bfd <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802bfd:	55                   	push   %ebp
+  802bfe:	89 e5                	mov    %esp,%ebp
+  802c00:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c06:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802c0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c0e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c13:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c16:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802c1b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c20:	e8 b5 f3 ff ff       	call   801fda <nsipc>
+}
+  802c25:	c9                   	leave
+  802c26:	c3                   	ret
+
+00802c27 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802c27:	55                   	push   %ebp
+  802c28:	89 e5                	mov    %esp,%ebp
+  802c2a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c30:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802c35:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c3a:	e8 9b f3 ff ff       	call   801fda <nsipc>
+}
+  802c3f:	c9                   	leave
+  802c40:	c3                   	ret
+
+00802c41 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802c41:	55                   	push   %ebp
+  802c42:	89 e5                	mov    %esp,%ebp
+  802c44:	53                   	push   %ebx
+  802c45:	83 ec 04             	sub    $0x4,%esp
+  802c48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802c4b:	b8 12 00 00 00       	mov    $0x12,%eax
+  802c50:	e8 85 f3 ff ff       	call   801fda <nsipc>
+  802c55:	85 c0                	test   %eax,%eax
+  802c57:	78 50                	js     802ca9 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802c59:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802c5f:	89 13                	mov    %edx,(%ebx)
+  802c61:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802c67:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c6a:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802c70:	89 53 08             	mov    %edx,0x8(%ebx)
+  802c73:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802c79:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802c7c:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802c82:	89 53 10             	mov    %edx,0x10(%ebx)
+  802c85:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802c8b:	89 53 14             	mov    %edx,0x14(%ebx)
+  802c8e:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802c94:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c97:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802c9d:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802ca0:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802ca6:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802ca9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cac:	c9                   	leave
+  802cad:	c3                   	ret
+
+00802cae <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cb4:	6a 03                	push   $0x3
+  802cb6:	e8 05 0d 00 00       	call   8039c0 <ipc_find_env>
+  802cbb:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc3:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802cc8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802ccd:	e8 08 f3 ff ff       	call   801fda <nsipc>
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  802cd5:	85 c0                	test   %eax,%eax
+  802cd7:	78 0a                	js     802ce3 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802cd9:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802cde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ce3:	c9                   	leave
+  802ce4:	c3                   	ret
+
+00802ce5 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802ce5:	55                   	push   %ebp
+  802ce6:	89 e5                	mov    %esp,%ebp
+  802ce8:	57                   	push   %edi
+  802ce9:	56                   	push   %esi
+  802cea:	53                   	push   %ebx
+  802ceb:	83 ec 1c             	sub    $0x1c,%esp
+  802cee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802cf1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802cf4:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802cf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cfe:	89 e0                	mov    %esp,%eax
+  802d00:	89 f2                	mov    %esi,%edx
+  802d02:	29 c2                	sub    %eax,%edx
+  802d04:	89 d0                	mov    %edx,%eax
+  802d06:	c1 e8 0f             	shr    $0xf,%eax
+  802d09:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802d0f:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802d12:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  802d19:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802d1c:	83 ec 0c             	sub    $0xc,%esp
+  802d1f:	ff 75 e0             	push   -0x20(%ebp)
+  802d22:	e8 d8 0c 00 00       	call   8039ff <pageref>
+  802d27:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d2a:	83 c4 04             	add    $0x4,%esp
+  802d2d:	ff 75 dc             	push   -0x24(%ebp)
+  802d30:	e8 ca 0c 00 00       	call   8039ff <pageref>
+  802d35:	89 e2                	mov    %esp,%edx
+  802d37:	89 f1                	mov    %esi,%ecx
+  802d39:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802d3b:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802d3e:	89 ca                	mov    %ecx,%edx
+  802d40:	c1 ea 0f             	shr    $0xf,%edx
+  802d43:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802d49:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802d4c:	8b 14 95 60 63 80 00 	mov    0x806360(,%edx,4),%edx
+  802d53:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802d56:	39 d7                	cmp    %edx,%edi
+  802d58:	74 40                	je     802d9a <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802d5a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d5d:	75 9f                	jne    802cfe <_pipeisclosed+0x19>
+  802d5f:	89 e2                	mov    %esp,%edx
+  802d61:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802d66:	29 d0                	sub    %edx,%eax
+  802d68:	89 c2                	mov    %eax,%edx
+  802d6a:	c1 ea 0f             	shr    $0xf,%edx
+  802d6d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d77:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d7a:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  802d81:	8b 40 58             	mov    0x58(%eax),%eax
+  802d84:	6a 01                	push   $0x1
+  802d86:	50                   	push   %eax
+  802d87:	57                   	push   %edi
+  802d88:	68 9f 44 80 00       	push   $0x80449f
+  802d8d:	e8 89 d5 ff ff       	call   80031b <cprintf>
+  802d92:	83 c4 10             	add    $0x10,%esp
+  802d95:	e9 5f ff ff ff       	jmp    802cf9 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802d9a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d9d:	0f 94 c0             	sete   %al
+  802da0:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802da3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da6:	5b                   	pop    %ebx
+  802da7:	5e                   	pop    %esi
+  802da8:	5f                   	pop    %edi
+  802da9:	5d                   	pop    %ebp
+  802daa:	c3                   	ret
+
+00802dab <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802dab:	55                   	push   %ebp
+  802dac:	89 e5                	mov    %esp,%ebp
+  802dae:	53                   	push   %ebx
+  802daf:	83 ec 0c             	sub    $0xc,%esp
+  802db2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802db5:	53                   	push   %ebx
+  802db6:	6a 00                	push   $0x0
+  802db8:	e8 0e e1 ff ff       	call   800ecb <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802dbd:	89 1c 24             	mov    %ebx,(%esp)
+  802dc0:	e8 f4 e4 ff ff       	call   8012b9 <fd2data>
+  802dc5:	83 c4 08             	add    $0x8,%esp
+  802dc8:	50                   	push   %eax
+  802dc9:	6a 00                	push   $0x0
+  802dcb:	e8 fb e0 ff ff       	call   800ecb <sys_page_unmap>
+}
+  802dd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dd3:	c9                   	leave
+  802dd4:	c3                   	ret
+
+00802dd5 <devpipe_read>:
+{
+  802dd5:	55                   	push   %ebp
+  802dd6:	89 e5                	mov    %esp,%ebp
+  802dd8:	57                   	push   %edi
+  802dd9:	56                   	push   %esi
+  802dda:	53                   	push   %ebx
+  802ddb:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802dde:	ff 75 08             	push   0x8(%ebp)
+  802de1:	e8 d3 e4 ff ff       	call   8012b9 <fd2data>
+  802de6:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802de8:	8b 70 04             	mov    0x4(%eax),%esi
+  802deb:	8b 00                	mov    (%eax),%eax
+  802ded:	83 c4 10             	add    $0x10,%esp
+  802df0:	39 f0                	cmp    %esi,%eax
+  802df2:	75 36                	jne    802e2a <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802df4:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802df7:	89 da                	mov    %ebx,%edx
+  802df9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dfc:	e8 e4 fe ff ff       	call   802ce5 <_pipeisclosed>
+  802e01:	85 c0                	test   %eax,%eax
+  802e03:	0f 85 d4 00 00 00    	jne    802edd <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802e09:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e0e:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802e12:	83 ec 04             	sub    $0x4,%esp
+  802e15:	6a ff                	push   $0xffffffff
+  802e17:	56                   	push   %esi
+  802e18:	57                   	push   %edi
+  802e19:	e8 26 e4 ff ff       	call   801244 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e1e:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e21:	8b 03                	mov    (%ebx),%eax
+  802e23:	83 c4 10             	add    $0x10,%esp
+  802e26:	39 c6                	cmp    %eax,%esi
+  802e28:	74 cd                	je     802df7 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e2a:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e2d:	8b 03                	mov    (%ebx),%eax
+  802e2f:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802e35:	29 c6                	sub    %eax,%esi
+  802e37:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e3c:	f7 e6                	mul    %esi
+  802e3e:	c1 ea 0c             	shr    $0xc,%edx
+  802e41:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e47:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802e49:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e4c:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802e50:	8b 0b                	mov    (%ebx),%ecx
+  802e52:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e57:	f7 e1                	mul    %ecx
+  802e59:	c1 ea 0b             	shr    $0xb,%edx
+  802e5c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802e62:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802e64:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802e69:	29 cf                	sub    %ecx,%edi
+  802e6b:	39 f7                	cmp    %esi,%edi
+  802e6d:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802e70:	83 ec 04             	sub    $0x4,%esp
+  802e73:	57                   	push   %edi
+  802e74:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802e78:	50                   	push   %eax
+  802e79:	ff 75 0c             	push   0xc(%ebp)
+  802e7c:	e8 41 dd ff ff       	call   800bc2 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802e81:	83 c4 0c             	add    $0xc,%esp
+  802e84:	89 f0                	mov    %esi,%eax
+  802e86:	29 f8                	sub    %edi,%eax
+  802e88:	50                   	push   %eax
+  802e89:	8d 43 10             	lea    0x10(%ebx),%eax
+  802e8c:	50                   	push   %eax
+  802e8d:	89 f8                	mov    %edi,%eax
+  802e8f:	03 45 0c             	add    0xc(%ebp),%eax
+  802e92:	50                   	push   %eax
+  802e93:	e8 2a dd ff ff       	call   800bc2 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802e98:	8b 0b                	mov    (%ebx),%ecx
+  802e9a:	01 f1                	add    %esi,%ecx
+  802e9c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ea1:	f7 e1                	mul    %ecx
+  802ea3:	c1 ea 0c             	shr    $0xc,%edx
+  802ea6:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802eac:	29 c1                	sub    %eax,%ecx
+  802eae:	89 0b                	mov    %ecx,(%ebx)
+  802eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb5:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802eb9:	83 c4 10             	add    $0x10,%esp
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	75 0a                	jne    802eca <devpipe_read+0xf5>
+	return n;
+  802ec0:	89 f0                	mov    %esi,%eax
+}
+  802ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ec5:	5b                   	pop    %ebx
+  802ec6:	5e                   	pop    %esi
+  802ec7:	5f                   	pop    %edi
+  802ec8:	5d                   	pop    %ebp
+  802ec9:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802eca:	83 ec 08             	sub    $0x8,%esp
+  802ecd:	68 00 04 00 00       	push   $0x400
+  802ed2:	53                   	push   %ebx
+  802ed3:	e8 8e e3 ff ff       	call   801266 <sys_futex_wake>
+  802ed8:	83 c4 10             	add    $0x10,%esp
+  802edb:	eb e3                	jmp    802ec0 <devpipe_read+0xeb>
+			return 0;
+  802edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee2:	eb de                	jmp    802ec2 <devpipe_read+0xed>
+
+00802ee4 <devpipe_write>:
+{
+  802ee4:	55                   	push   %ebp
+  802ee5:	89 e5                	mov    %esp,%ebp
+  802ee7:	57                   	push   %edi
+  802ee8:	56                   	push   %esi
+  802ee9:	53                   	push   %ebx
+  802eea:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802eed:	ff 75 08             	push   0x8(%ebp)
+  802ef0:	e8 c4 e3 ff ff       	call   8012b9 <fd2data>
+  802ef5:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802ef7:	83 c4 10             	add    $0x10,%esp
+  802efa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f01:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802f06:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f0a:	0f 84 43 01 00 00    	je     803053 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f10:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f13:	8b 06                	mov    (%esi),%eax
+  802f15:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f1b:	29 c1                	sub    %eax,%ecx
+  802f1d:	89 c8                	mov    %ecx,%eax
+  802f1f:	f7 e7                	mul    %edi
+  802f21:	c1 ea 0c             	shr    $0xc,%edx
+  802f24:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f2a:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802f2c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802f32:	75 52                	jne    802f86 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802f34:	89 f2                	mov    %esi,%edx
+  802f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f39:	e8 a7 fd ff ff       	call   802ce5 <_pipeisclosed>
+  802f3e:	85 c0                	test   %eax,%eax
+  802f40:	0f 85 28 01 00 00    	jne    80306e <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802f46:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f48:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f4b:	8b 06                	mov    (%esi),%eax
+  802f4d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f53:	29 c1                	sub    %eax,%ecx
+  802f55:	89 c8                	mov    %ecx,%eax
+  802f57:	f7 e7                	mul    %edi
+  802f59:	c1 ea 0c             	shr    $0xc,%edx
+  802f5c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f62:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802f64:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802f6a:	75 a4                	jne    802f10 <devpipe_write+0x2c>
+  802f6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f71:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802f75:	83 ec 04             	sub    $0x4,%esp
+  802f78:	6a ff                	push   $0xffffffff
+  802f7a:	53                   	push   %ebx
+  802f7b:	56                   	push   %esi
+  802f7c:	e8 c3 e2 ff ff       	call   801244 <sys_futex_wait>
+}
+  802f81:	83 c4 10             	add    $0x10,%esp
+  802f84:	eb 8a                	jmp    802f10 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f86:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f89:	8b 06                	mov    (%esi),%eax
+  802f8b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f91:	29 c1                	sub    %eax,%ecx
+  802f93:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f98:	f7 e1                	mul    %ecx
+  802f9a:	c1 ea 0c             	shr    $0xc,%edx
+  802f9d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fa3:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802fa5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802faa:	89 d8                	mov    %ebx,%eax
+  802fac:	29 c8                	sub    %ecx,%eax
+  802fae:	8b 55 10             	mov    0x10(%ebp),%edx
+  802fb1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802fb4:	29 ca                	sub    %ecx,%edx
+  802fb6:	39 d0                	cmp    %edx,%eax
+  802fb8:	0f 46 d0             	cmovbe %eax,%edx
+  802fbb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802fbe:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fc1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fc6:	f7 e1                	mul    %ecx
+  802fc8:	c1 ea 0b             	shr    $0xb,%edx
+  802fcb:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802fd1:	89 ca                	mov    %ecx,%edx
+  802fd3:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802fd5:	29 d3                	sub    %edx,%ebx
+  802fd7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802fda:	39 c3                	cmp    %eax,%ebx
+  802fdc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802fdf:	83 ec 04             	sub    $0x4,%esp
+  802fe2:	53                   	push   %ebx
+  802fe3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802fe6:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802fe9:	51                   	push   %ecx
+  802fea:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802fee:	50                   	push   %eax
+  802fef:	e8 ce db ff ff       	call   800bc2 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802ff4:	83 c4 0c             	add    $0xc,%esp
+  802ff7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ffa:	29 d8                	sub    %ebx,%eax
+  802ffc:	50                   	push   %eax
+  802ffd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803000:	01 cb                	add    %ecx,%ebx
+  803002:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803005:	53                   	push   %ebx
+  803006:	8d 46 10             	lea    0x10(%esi),%eax
+  803009:	50                   	push   %eax
+  80300a:	e8 b3 db ff ff       	call   800bc2 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80300f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803012:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803015:	01 c1                	add    %eax,%ecx
+  803017:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80301c:	f7 e1                	mul    %ecx
+  80301e:	c1 ea 0c             	shr    $0xc,%edx
+  803021:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803027:	89 ca                	mov    %ecx,%edx
+  803029:	29 c2                	sub    %eax,%edx
+  80302b:	89 56 04             	mov    %edx,0x4(%esi)
+  80302e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803033:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803037:	83 c4 10             	add    $0x10,%esp
+  80303a:	85 c0                	test   %eax,%eax
+  80303c:	75 1a                	jne    803058 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80303e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803041:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803044:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803047:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80304a:	0f 82 c0 fe ff ff    	jb     802f10 <devpipe_write+0x2c>
+  803050:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803053:	8b 45 10             	mov    0x10(%ebp),%eax
+  803056:	eb 1b                	jmp    803073 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803058:	83 ec 08             	sub    $0x8,%esp
+  80305b:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803060:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803063:	50                   	push   %eax
+  803064:	e8 fd e1 ff ff       	call   801266 <sys_futex_wake>
+  803069:	83 c4 10             	add    $0x10,%esp
+  80306c:	eb d0                	jmp    80303e <devpipe_write+0x15a>
+				return 0;
+  80306e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803076:	5b                   	pop    %ebx
+  803077:	5e                   	pop    %esi
+  803078:	5f                   	pop    %edi
+  803079:	5d                   	pop    %ebp
+  80307a:	c3                   	ret
+
+0080307b <devpipe_stat>:
+{
+  80307b:	55                   	push   %ebp
+  80307c:	89 e5                	mov    %esp,%ebp
+  80307e:	56                   	push   %esi
+  80307f:	53                   	push   %ebx
+  803080:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803083:	83 ec 0c             	sub    $0xc,%esp
+  803086:	ff 75 08             	push   0x8(%ebp)
+  803089:	e8 2b e2 ff ff       	call   8012b9 <fd2data>
+  80308e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803090:	83 c4 08             	add    $0x8,%esp
+  803093:	68 b2 44 80 00       	push   $0x8044b2
+  803098:	53                   	push   %ebx
+  803099:	e8 74 d9 ff ff       	call   800a12 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80309e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030a1:	8b 06                	mov    (%esi),%eax
+  8030a3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030a9:	29 c1                	sub    %eax,%ecx
+  8030ab:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030b0:	89 c8                	mov    %ecx,%eax
+  8030b2:	f7 e2                	mul    %edx
+  8030b4:	c1 ea 0c             	shr    $0xc,%edx
+  8030b7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030bd:	29 d1                	sub    %edx,%ecx
+  8030bf:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8030c5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8030cc:	00 00 00 
+	stat->st_dev = &devpipe;
+  8030cf:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8030d6:	50 80 00 
+}
+  8030d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030e1:	5b                   	pop    %ebx
+  8030e2:	5e                   	pop    %esi
+  8030e3:	5d                   	pop    %ebp
+  8030e4:	c3                   	ret
+
+008030e5 <devpipe_poll>:
+{
+  8030e5:	55                   	push   %ebp
+  8030e6:	89 e5                	mov    %esp,%ebp
+  8030e8:	57                   	push   %edi
+  8030e9:	56                   	push   %esi
+  8030ea:	53                   	push   %ebx
+  8030eb:	83 ec 18             	sub    $0x18,%esp
+  8030ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8030f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8030f4:	57                   	push   %edi
+  8030f5:	e8 bf e1 ff ff       	call   8012b9 <fd2data>
+  8030fa:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8030fc:	83 c4 10             	add    $0x10,%esp
+  8030ff:	89 f3                	mov    %esi,%ebx
+  803101:	83 e3 01             	and    $0x1,%ebx
+  803104:	75 27                	jne    80312d <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803106:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80310c:	75 48                	jne    803156 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80310e:	89 ca                	mov    %ecx,%edx
+  803110:	89 f8                	mov    %edi,%eax
+  803112:	e8 ce fb ff ff       	call   802ce5 <_pipeisclosed>
+  803117:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803119:	89 d8                	mov    %ebx,%eax
+  80311b:	83 c8 10             	or     $0x10,%eax
+  80311e:	85 d2                	test   %edx,%edx
+  803120:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803123:	89 d8                	mov    %ebx,%eax
+  803125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803128:	5b                   	pop    %ebx
+  803129:	5e                   	pop    %esi
+  80312a:	5f                   	pop    %edi
+  80312b:	5d                   	pop    %ebp
+  80312c:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80312d:	8b 58 04             	mov    0x4(%eax),%ebx
+  803130:	8b 00                	mov    (%eax),%eax
+  803132:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803138:	29 c3                	sub    %eax,%ebx
+  80313a:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80313f:	89 d8                	mov    %ebx,%eax
+  803141:	f7 e2                	mul    %edx
+  803143:	c1 ea 0c             	shr    $0xc,%edx
+  803146:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80314c:	39 d3                	cmp    %edx,%ebx
+  80314e:	0f 95 c3             	setne  %bl
+  803151:	0f b6 db             	movzbl %bl,%ebx
+  803154:	eb b0                	jmp    803106 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803156:	8b 71 04             	mov    0x4(%ecx),%esi
+  803159:	8b 01                	mov    (%ecx),%eax
+  80315b:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803161:	29 c6                	sub    %eax,%esi
+  803163:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803168:	89 f0                	mov    %esi,%eax
+  80316a:	f7 e2                	mul    %edx
+  80316c:	c1 ea 0c             	shr    $0xc,%edx
+  80316f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803175:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803177:	89 d8                	mov    %ebx,%eax
+  803179:	83 c8 04             	or     $0x4,%eax
+  80317c:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803182:	0f 42 d8             	cmovb  %eax,%ebx
+  803185:	eb 87                	jmp    80310e <devpipe_poll+0x29>
+
+00803187 <pipe>:
+{
+  803187:	55                   	push   %ebp
+  803188:	89 e5                	mov    %esp,%ebp
+  80318a:	56                   	push   %esi
+  80318b:	53                   	push   %ebx
+  80318c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80318f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803192:	50                   	push   %eax
+  803193:	e8 38 e1 ff ff       	call   8012d0 <fd_alloc>
+  803198:	89 c3                	mov    %eax,%ebx
+  80319a:	83 c4 10             	add    $0x10,%esp
+  80319d:	85 c0                	test   %eax,%eax
+  80319f:	0f 88 23 01 00 00    	js     8032c8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031a5:	83 ec 04             	sub    $0x4,%esp
+  8031a8:	68 07 04 00 00       	push   $0x407
+  8031ad:	ff 75 f4             	push   -0xc(%ebp)
+  8031b0:	6a 00                	push   $0x0
+  8031b2:	e8 8f dc ff ff       	call   800e46 <sys_page_alloc>
+  8031b7:	89 c3                	mov    %eax,%ebx
+  8031b9:	83 c4 10             	add    $0x10,%esp
+  8031bc:	85 c0                	test   %eax,%eax
+  8031be:	0f 88 04 01 00 00    	js     8032c8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031c4:	83 ec 0c             	sub    $0xc,%esp
+  8031c7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031ca:	50                   	push   %eax
+  8031cb:	e8 00 e1 ff ff       	call   8012d0 <fd_alloc>
+  8031d0:	89 c3                	mov    %eax,%ebx
+  8031d2:	83 c4 10             	add    $0x10,%esp
+  8031d5:	85 c0                	test   %eax,%eax
+  8031d7:	0f 88 db 00 00 00    	js     8032b8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031dd:	83 ec 04             	sub    $0x4,%esp
+  8031e0:	68 07 04 00 00       	push   $0x407
+  8031e5:	ff 75 f0             	push   -0x10(%ebp)
+  8031e8:	6a 00                	push   $0x0
+  8031ea:	e8 57 dc ff ff       	call   800e46 <sys_page_alloc>
+  8031ef:	89 c3                	mov    %eax,%ebx
+  8031f1:	83 c4 10             	add    $0x10,%esp
+  8031f4:	85 c0                	test   %eax,%eax
+  8031f6:	0f 88 bc 00 00 00    	js     8032b8 <pipe+0x131>
+	va = fd2data(fd0);
+  8031fc:	83 ec 0c             	sub    $0xc,%esp
+  8031ff:	ff 75 f4             	push   -0xc(%ebp)
+  803202:	e8 b2 e0 ff ff       	call   8012b9 <fd2data>
+  803207:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803209:	83 c4 0c             	add    $0xc,%esp
+  80320c:	68 07 04 00 00       	push   $0x407
+  803211:	50                   	push   %eax
+  803212:	6a 00                	push   $0x0
+  803214:	e8 2d dc ff ff       	call   800e46 <sys_page_alloc>
+  803219:	89 c3                	mov    %eax,%ebx
+  80321b:	83 c4 10             	add    $0x10,%esp
+  80321e:	85 c0                	test   %eax,%eax
+  803220:	0f 88 82 00 00 00    	js     8032a8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803226:	83 ec 0c             	sub    $0xc,%esp
+  803229:	ff 75 f0             	push   -0x10(%ebp)
+  80322c:	e8 88 e0 ff ff       	call   8012b9 <fd2data>
+  803231:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803238:	50                   	push   %eax
+  803239:	6a 00                	push   $0x0
+  80323b:	56                   	push   %esi
+  80323c:	6a 00                	push   $0x0
+  80323e:	e8 46 dc ff ff       	call   800e89 <sys_page_map>
+  803243:	89 c3                	mov    %eax,%ebx
+  803245:	83 c4 20             	add    $0x20,%esp
+  803248:	85 c0                	test   %eax,%eax
+  80324a:	78 4e                	js     80329a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80324c:	a1 60 50 80 00       	mov    0x805060,%eax
+  803251:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803254:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803256:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803259:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803260:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803263:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803265:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803268:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80326f:	83 ec 0c             	sub    $0xc,%esp
+  803272:	ff 75 f4             	push   -0xc(%ebp)
+  803275:	e8 2f e0 ff ff       	call   8012a9 <fd2num>
+  80327a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80327d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80327f:	83 c4 04             	add    $0x4,%esp
+  803282:	ff 75 f0             	push   -0x10(%ebp)
+  803285:	e8 1f e0 ff ff       	call   8012a9 <fd2num>
+  80328a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80328d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803290:	83 c4 10             	add    $0x10,%esp
+  803293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803298:	eb 2e                	jmp    8032c8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80329a:	83 ec 08             	sub    $0x8,%esp
+  80329d:	56                   	push   %esi
+  80329e:	6a 00                	push   $0x0
+  8032a0:	e8 26 dc ff ff       	call   800ecb <sys_page_unmap>
+  8032a5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032a8:	83 ec 08             	sub    $0x8,%esp
+  8032ab:	ff 75 f0             	push   -0x10(%ebp)
+  8032ae:	6a 00                	push   $0x0
+  8032b0:	e8 16 dc ff ff       	call   800ecb <sys_page_unmap>
+  8032b5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032b8:	83 ec 08             	sub    $0x8,%esp
+  8032bb:	ff 75 f4             	push   -0xc(%ebp)
+  8032be:	6a 00                	push   $0x0
+  8032c0:	e8 06 dc ff ff       	call   800ecb <sys_page_unmap>
+  8032c5:	83 c4 10             	add    $0x10,%esp
+}
+  8032c8:	89 d8                	mov    %ebx,%eax
+  8032ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032cd:	5b                   	pop    %ebx
+  8032ce:	5e                   	pop    %esi
+  8032cf:	5d                   	pop    %ebp
+  8032d0:	c3                   	ret
+
+008032d1 <pipeisclosed>:
+{
+  8032d1:	55                   	push   %ebp
+  8032d2:	89 e5                	mov    %esp,%ebp
+  8032d4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032da:	50                   	push   %eax
+  8032db:	ff 75 08             	push   0x8(%ebp)
+  8032de:	e8 3d e0 ff ff       	call   801320 <fd_lookup>
+  8032e3:	83 c4 10             	add    $0x10,%esp
+  8032e6:	85 c0                	test   %eax,%eax
+  8032e8:	78 18                	js     803302 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032ea:	83 ec 0c             	sub    $0xc,%esp
+  8032ed:	ff 75 f4             	push   -0xc(%ebp)
+  8032f0:	e8 c4 df ff ff       	call   8012b9 <fd2data>
+  8032f5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032fa:	e8 e6 f9 ff ff       	call   802ce5 <_pipeisclosed>
+  8032ff:	83 c4 10             	add    $0x10,%esp
+}
+  803302:	c9                   	leave
+  803303:	c3                   	ret
+
+00803304 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803304:	55                   	push   %ebp
+  803305:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803307:	8b 45 08             	mov    0x8(%ebp),%eax
+  80330a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803310:	5d                   	pop    %ebp
+  803311:	c3                   	ret
+
+00803312 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803312:	55                   	push   %ebp
+  803313:	89 e5                	mov    %esp,%ebp
+  803315:	53                   	push   %ebx
+  803316:	83 ec 04             	sub    $0x4,%esp
+  803319:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80331c:	8b 03                	mov    (%ebx),%eax
+  80331e:	85 c0                	test   %eax,%eax
+  803320:	75 05                	jne    803327 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803322:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803325:	c9                   	leave
+  803326:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803327:	83 ec 08             	sub    $0x8,%esp
+  80332a:	50                   	push   %eax
+  80332b:	8d 43 04             	lea    0x4(%ebx),%eax
+  80332e:	50                   	push   %eax
+  80332f:	e8 e7 dd ff ff       	call   80111b <sys_page_batch>
+	pb->pb_n = 0;
+  803334:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80333a:	83 c4 10             	add    $0x10,%esp
+  80333d:	eb e3                	jmp    803322 <pgbatch_flush+0x10>
+
+0080333f <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80333f:	55                   	push   %ebp
+  803340:	89 e5                	mov    %esp,%ebp
+  803342:	56                   	push   %esi
+  803343:	53                   	push   %ebx
+  803344:	89 c3                	mov    %eax,%ebx
+  803346:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803348:	83 38 20             	cmpl   $0x20,(%eax)
+  80334b:	74 2c                	je     803379 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  80334d:	8b 03                	mov    (%ebx),%eax
+  80334f:	8d 50 01             	lea    0x1(%eax),%edx
+  803352:	89 13                	mov    %edx,(%ebx)
+  803354:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803357:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  80335b:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  80335d:	83 ec 04             	sub    $0x4,%esp
+  803360:	6a 18                	push   $0x18
+  803362:	6a 00                	push   $0x0
+  803364:	50                   	push   %eax
+  803365:	e8 23 d8 ff ff       	call   800b8d <memset>
+	return 0;
+  80336a:	83 c4 10             	add    $0x10,%esp
+  80336d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803372:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803375:	5b                   	pop    %ebx
+  803376:	5e                   	pop    %esi
+  803377:	5d                   	pop    %ebp
+  803378:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803379:	83 ec 0c             	sub    $0xc,%esp
+  80337c:	50                   	push   %eax
+  80337d:	e8 90 ff ff ff       	call   803312 <pgbatch_flush>
+  803382:	83 c4 10             	add    $0x10,%esp
+  803385:	85 c0                	test   %eax,%eax
+  803387:	79 c4                	jns    80334d <pgbatch_slot+0xe>
+  803389:	eb e7                	jmp    803372 <pgbatch_slot+0x33>
+
+0080338b <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80338b:	55                   	push   %ebp
+  80338c:	89 e5                	mov    %esp,%ebp
+  80338e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803391:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803394:	8b 45 08             	mov    0x8(%ebp),%eax
+  803397:	e8 a3 ff ff ff       	call   80333f <pgbatch_slot>
+  80339c:	85 c0                	test   %eax,%eax
+  80339e:	78 20                	js     8033c0 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8033a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033a3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8033a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033ac:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033af:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033b2:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8033b5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033b8:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c0:	c9                   	leave
+  8033c1:	c3                   	ret
+
+008033c2 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8033c2:	55                   	push   %ebp
+  8033c3:	89 e5                	mov    %esp,%ebp
+  8033c5:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033c8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ce:	e8 6c ff ff ff       	call   80333f <pgbatch_slot>
+  8033d3:	85 c0                	test   %eax,%eax
+  8033d5:	78 2c                	js     803403 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8033d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033da:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8033e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033e3:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8033e6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033e9:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8033ec:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033ef:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8033f2:	8b 55 18             	mov    0x18(%ebp),%edx
+  8033f5:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8033f8:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8033fb:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803403:	c9                   	leave
+  803404:	c3                   	ret
+
+00803405 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803405:	55                   	push   %ebp
+  803406:	89 e5                	mov    %esp,%ebp
+  803408:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80340b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80340e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803411:	e8 29 ff ff ff       	call   80333f <pgbatch_slot>
+  803416:	85 c0                	test   %eax,%eax
+  803418:	78 1a                	js     803434 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80341a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80341d:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803423:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803426:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803429:	8b 55 10             	mov    0x10(%ebp),%edx
+  80342c:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80342f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803434:	c9                   	leave
+  803435:	c3                   	ret
+
+00803436 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803436:	55                   	push   %ebp
+  803437:	89 e5                	mov    %esp,%ebp
+  803439:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80343c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80343f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803442:	e8 f8 fe ff ff       	call   80333f <pgbatch_slot>
+  803447:	85 c0                	test   %eax,%eax
+  803449:	78 20                	js     80346b <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  80344b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80344e:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803454:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803457:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80345a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80345d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803460:	8b 55 14             	mov    0x14(%ebp),%edx
+  803463:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803466:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80346b:	c9                   	leave
+  80346c:	c3                   	ret
+
+0080346d <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  80346d:	55                   	push   %ebp
+  80346e:	89 e5                	mov    %esp,%ebp
+  803470:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803473:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803476:	8b 45 08             	mov    0x8(%ebp),%eax
+  803479:	e8 c1 fe ff ff       	call   80333f <pgbatch_slot>
+  80347e:	85 c0                	test   %eax,%eax
+  803480:	78 26                	js     8034a8 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803482:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803485:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80348b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80348e:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803491:	8b 55 10             	mov    0x10(%ebp),%edx
+  803494:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803497:	8b 55 14             	mov    0x14(%ebp),%edx
+  80349a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80349d:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034a0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034a8:	c9                   	leave
+  8034a9:	c3                   	ret
+
+008034aa <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8034aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034af:	c3                   	ret
+
+008034b0 <devcons_poll>:
+{
+  8034b0:	55                   	push   %ebp
+  8034b1:	89 e5                	mov    %esp,%ebp
+  8034b3:	53                   	push   %ebx
+  8034b4:	83 ec 04             	sub    $0x4,%esp
+  8034b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8034ba:	89 da                	mov    %ebx,%edx
+  8034bc:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8034bf:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  8034c6:	74 0c                	je     8034d4 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8034c8:	89 d8                	mov    %ebx,%eax
+  8034ca:	83 e0 01             	and    $0x1,%eax
+  8034cd:	09 d0                	or     %edx,%eax
+}
+  8034cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034d2:	c9                   	leave
+  8034d3:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8034d4:	e8 cf d8 ff ff       	call   800da8 <sys_cgetc>
+  8034d9:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8034de:	89 da                	mov    %ebx,%edx
+  8034e0:	83 e2 04             	and    $0x4,%edx
+  8034e3:	85 c0                	test   %eax,%eax
+  8034e5:	74 e6                	je     8034cd <devcons_poll+0x1d>
+  8034e7:	eb df                	jmp    8034c8 <devcons_poll+0x18>
+
+008034e9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8034e9:	55                   	push   %ebp
+  8034ea:	89 e5                	mov    %esp,%ebp
+  8034ec:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8034ef:	68 be 44 80 00       	push   $0x8044be
+  8034f4:	ff 75 0c             	push   0xc(%ebp)
+  8034f7:	e8 16 d5 ff ff       	call   800a12 <strcpy>
+	return 0;
+}
+  8034fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803501:	c9                   	leave
+  803502:	c3                   	ret
+
+00803503 <devcons_write>:
+{
+  803503:	55                   	push   %ebp
+  803504:	89 e5                	mov    %esp,%ebp
+  803506:	57                   	push   %edi
+  803507:	56                   	push   %esi
+  803508:	53                   	push   %ebx
+  803509:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80350f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803512:	85 ff                	test   %edi,%edi
+  803514:	74 51                	je     803567 <devcons_write+0x64>
+  803516:	be 00 00 00 00       	mov    $0x0,%esi
+  80351b:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803520:	89 fb                	mov    %edi,%ebx
+  803522:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803524:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803529:	39 d3                	cmp    %edx,%ebx
+  80352b:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80352e:	83 ec 04             	sub    $0x4,%esp
+  803531:	53                   	push   %ebx
+  803532:	03 45 0c             	add    0xc(%ebp),%eax
+  803535:	50                   	push   %eax
+  803536:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80353c:	50                   	push   %eax
+  80353d:	e8 80 d6 ff ff       	call   800bc2 <memmove>
+		sys_cputs(buf, m);
+  803542:	83 c4 08             	add    $0x8,%esp
+  803545:	53                   	push   %ebx
+  803546:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80354c:	50                   	push   %eax
+  80354d:	e8 38 d8 ff ff       	call   800d8a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803552:	01 de                	add    %ebx,%esi
+  803554:	89 f0                	mov    %esi,%eax
+  803556:	83 c4 10             	add    $0x10,%esp
+  803559:	39 fe                	cmp    %edi,%esi
+  80355b:	72 c3                	jb     803520 <devcons_write+0x1d>
+}
+  80355d:	89 f0                	mov    %esi,%eax
+  80355f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803562:	5b                   	pop    %ebx
+  803563:	5e                   	pop    %esi
+  803564:	5f                   	pop    %edi
+  803565:	5d                   	pop    %ebp
+  803566:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803567:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80356c:	eb ef                	jmp    80355d <devcons_write+0x5a>
+
+0080356e <devcons_read>:
+{
+  80356e:	55                   	push   %ebp
+  80356f:	89 e5                	mov    %esp,%ebp
+  803571:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803574:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803579:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80357d:	74 36                	je     8035b5 <devcons_read+0x47>
+	c = cons_peek;
+  80357f:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  803584:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  80358b:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80358e:	85 c0                	test   %eax,%eax
+  803590:	75 10                	jne    8035a2 <devcons_read+0x34>
+  803592:	e8 11 d8 ff ff       	call   800da8 <sys_cgetc>
+  803597:	85 c0                	test   %eax,%eax
+  803599:	75 07                	jne    8035a2 <devcons_read+0x34>
+		sys_yield();
+  80359b:	e8 87 d8 ff ff       	call   800e27 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8035a0:	eb f0                	jmp    803592 <devcons_read+0x24>
+	if (c < 0)
+  8035a2:	85 c0                	test   %eax,%eax
+  8035a4:	78 0f                	js     8035b5 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8035a6:	83 f8 04             	cmp    $0x4,%eax
+  8035a9:	74 0c                	je     8035b7 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8035ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035ae:	88 02                	mov    %al,(%edx)
+	return 1;
+  8035b0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035b5:	c9                   	leave
+  8035b6:	c3                   	ret
+		return 0;
+  8035b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bc:	eb f7                	jmp    8035b5 <devcons_read+0x47>
+
+008035be <cputchar>:
+{
+  8035be:	55                   	push   %ebp
+  8035bf:	89 e5                	mov    %esp,%ebp
+  8035c1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8035c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8035ca:	6a 01                	push   $0x1
+  8035cc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035cf:	50                   	push   %eax
+  8035d0:	e8 b5 d7 ff ff       	call   800d8a <sys_cputs>
+}
+  8035d5:	83 c4 10             	add    $0x10,%esp
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+
+008035da <getchar>:
+{
+  8035da:	55                   	push   %ebp
+  8035db:	89 e5                	mov    %esp,%ebp
+  8035dd:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8035e0:	6a 01                	push   $0x1
+  8035e2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035e5:	50                   	push   %eax
+  8035e6:	6a 00                	push   $0x0
+  8035e8:	e8 b7 df ff ff       	call   8015a4 <read>
+	if (r < 0)
+  8035ed:	83 c4 10             	add    $0x10,%esp
+  8035f0:	85 c0                	test   %eax,%eax
+  8035f2:	78 06                	js     8035fa <getchar+0x20>
+	if (r < 1)
+  8035f4:	74 06                	je     8035fc <getchar+0x22>
+	return c;
+  8035f6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8035fa:	c9                   	leave
+  8035fb:	c3                   	ret
+		return -E_EOF;
+  8035fc:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803601:	eb f7                	jmp    8035fa <getchar+0x20>
+
+00803603 <iscons>:
+{
+  803603:	55                   	push   %ebp
+  803604:	89 e5                	mov    %esp,%ebp
+  803606:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803609:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80360c:	50                   	push   %eax
+  80360d:	ff 75 08             	push   0x8(%ebp)
+  803610:	e8 0b dd ff ff       	call   801320 <fd_lookup>
+  803615:	83 c4 10             	add    $0x10,%esp
+  803618:	85 c0                	test   %eax,%eax
+  80361a:	78 11                	js     80362d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80361c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80361f:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803625:	39 10                	cmp    %edx,(%eax)
+  803627:	0f 94 c0             	sete   %al
+  80362a:	0f b6 c0             	movzbl %al,%eax
+}
+  80362d:	c9                   	leave
+  80362e:	c3                   	ret
+
+0080362f <opencons>:
+{
+  80362f:	55                   	push   %ebp
+  803630:	89 e5                	mov    %esp,%ebp
+  803632:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803635:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803638:	50                   	push   %eax
+  803639:	e8 92 dc ff ff       	call   8012d0 <fd_alloc>
+  80363e:	83 c4 10             	add    $0x10,%esp
+  803641:	85 c0                	test   %eax,%eax
+  803643:	78 3a                	js     80367f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803645:	83 ec 04             	sub    $0x4,%esp
+  803648:	68 07 04 00 00       	push   $0x407
+  80364d:	ff 75 f4             	push   -0xc(%ebp)
+  803650:	6a 00                	push   $0x0
+  803652:	e8 ef d7 ff ff       	call   800e46 <sys_page_alloc>
+  803657:	83 c4 10             	add    $0x10,%esp
+  80365a:	85 c0                	test   %eax,%eax
+  80365c:	78 21                	js     80367f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80365e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803661:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803667:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803669:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80366c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803673:	83 ec 0c             	sub    $0xc,%esp
+  803676:	50                   	push   %eax
+  803677:	e8 2d dc ff ff       	call   8012a9 <fd2num>
+  80367c:	83 c4 10             	add    $0x10,%esp
+}
+  80367f:	c9                   	leave
+  803680:	c3                   	ret
+
+00803681 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803681:	55                   	push   %ebp
+  803682:	89 e5                	mov    %esp,%ebp
+  803684:	56                   	push   %esi
+  803685:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803686:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803689:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  80368f:	e8 74 d7 ff ff       	call   800e08 <sys_getenvid>
+  803694:	83 ec 0c             	sub    $0xc,%esp
+  803697:	ff 75 0c             	push   0xc(%ebp)
+  80369a:	ff 75 08             	push   0x8(%ebp)
+  80369d:	56                   	push   %esi
+  80369e:	50                   	push   %eax
+  80369f:	68 cc 44 80 00       	push   $0x8044cc
+  8036a4:	e8 72 cc ff ff       	call   80031b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8036a9:	83 c4 18             	add    $0x18,%esp
+  8036ac:	53                   	push   %ebx
+  8036ad:	ff 75 10             	push   0x10(%ebp)
+  8036b0:	e8 15 cc ff ff       	call   8002ca <vcprintf>
+	cprintf("\n");
+  8036b5:	c7 04 24 f4 3f 80 00 	movl   $0x803ff4,(%esp)
+  8036bc:	e8 5a cc ff ff       	call   80031b <cprintf>
+  8036c1:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8036c4:	cc                   	int3
+	while (1)
+  8036c5:	eb fd                	jmp    8036c4 <_panic+0x43>
+
+008036c7 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036c7:	55                   	push   %ebp
+  8036c8:	89 e5                	mov    %esp,%ebp
+  8036ca:	56                   	push   %esi
+  8036cb:	53                   	push   %ebx
+  8036cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8036d5:	85 c0                	test   %eax,%eax
+  8036d7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036dc:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8036df:	83 ec 0c             	sub    $0xc,%esp
+  8036e2:	50                   	push   %eax
+  8036e3:	e8 0e d9 ff ff       	call   800ff6 <sys_ipc_recv>
+  8036e8:	83 c4 10             	add    $0x10,%esp
+  8036eb:	85 c0                	test   %eax,%eax
+  8036ed:	0f 88 8b 00 00 00    	js     80377e <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8036f3:	85 f6                	test   %esi,%esi
+  8036f5:	74 2a                	je     803721 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8036f7:	89 e2                	mov    %esp,%edx
+  8036f9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036fe:	29 d0                	sub    %edx,%eax
+  803700:	89 c2                	mov    %eax,%edx
+  803702:	c1 ea 0f             	shr    $0xf,%edx
+  803705:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80370a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370f:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803712:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803719:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80371f:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803721:	85 db                	test   %ebx,%ebx
+  803723:	74 2a                	je     80374f <ipc_recv+0x88>
+  803725:	89 e2                	mov    %esp,%edx
+  803727:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80372c:	29 d0                	sub    %edx,%eax
+  80372e:	89 c2                	mov    %eax,%edx
+  803730:	c1 ea 0f             	shr    $0xf,%edx
+  803733:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803740:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803747:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80374d:	89 03                	mov    %eax,(%ebx)
+  80374f:	89 e2                	mov    %esp,%edx
+  803751:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803756:	29 d0                	sub    %edx,%eax
+  803758:	89 c2                	mov    %eax,%edx
+  80375a:	c1 ea 0f             	shr    $0xf,%edx
+  80375d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803762:	b8 00 00 00 00       	mov    $0x0,%eax
+  803767:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80376a:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803771:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803777:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80377a:	5b                   	pop    %ebx
+  80377b:	5e                   	pop    %esi
+  80377c:	5d                   	pop    %ebp
+  80377d:	c3                   	ret
+		if(from_env_store != NULL)
+  80377e:	85 f6                	test   %esi,%esi
+  803780:	74 06                	je     803788 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803782:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803788:	85 db                	test   %ebx,%ebx
+  80378a:	74 eb                	je     803777 <ipc_recv+0xb0>
+			*perm_store = 0;
+  80378c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803792:	eb e3                	jmp    803777 <ipc_recv+0xb0>
+
+00803794 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803794:	55                   	push   %ebp
+  803795:	89 e5                	mov    %esp,%ebp
+  803797:	57                   	push   %edi
+  803798:	56                   	push   %esi
+  803799:	53                   	push   %ebx
+  80379a:	83 ec 14             	sub    $0x14,%esp
+  80379d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037a3:	8b 75 14             	mov    0x14(%ebp),%esi
+  8037a6:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8037a9:	85 c0                	test   %eax,%eax
+  8037ab:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8037b0:	0f 44 c2             	cmove  %edx,%eax
+  8037b3:	ff 75 10             	push   0x10(%ebp)
+  8037b6:	50                   	push   %eax
+  8037b7:	e8 9c d8 ff ff       	call   801058 <sys_ipc_recv_pages>
+  8037bc:	83 c4 10             	add    $0x10,%esp
+  8037bf:	85 c0                	test   %eax,%eax
+  8037c1:	0f 88 ba 00 00 00    	js     803881 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8037c7:	85 ff                	test   %edi,%edi
+  8037c9:	74 2a                	je     8037f5 <ipc_recv_pages+0x61>
+  8037cb:	89 e2                	mov    %esp,%edx
+  8037cd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037d2:	29 d0                	sub    %edx,%eax
+  8037d4:	89 c2                	mov    %eax,%edx
+  8037d6:	c1 ea 0f             	shr    $0xf,%edx
+  8037d9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e3:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8037e6:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8037ed:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8037f3:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8037f5:	85 f6                	test   %esi,%esi
+  8037f7:	74 2a                	je     803823 <ipc_recv_pages+0x8f>
+  8037f9:	89 e2                	mov    %esp,%edx
+  8037fb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803800:	29 d0                	sub    %edx,%eax
+  803802:	89 c2                	mov    %eax,%edx
+  803804:	c1 ea 0f             	shr    $0xf,%edx
+  803807:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80380c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803811:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803814:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80381b:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803821:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803823:	85 db                	test   %ebx,%ebx
+  803825:	74 2a                	je     803851 <ipc_recv_pages+0xbd>
+  803827:	89 e2                	mov    %esp,%edx
+  803829:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80382e:	29 d0                	sub    %edx,%eax
+  803830:	89 c2                	mov    %eax,%edx
+  803832:	c1 ea 0f             	shr    $0xf,%edx
+  803835:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80383a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383f:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803842:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803849:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80384f:	89 03                	mov    %eax,(%ebx)
+  803851:	89 e2                	mov    %esp,%edx
+  803853:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803858:	29 d0                	sub    %edx,%eax
+  80385a:	89 c2                	mov    %eax,%edx
+  80385c:	c1 ea 0f             	shr    $0xf,%edx
+  80385f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803864:	b8 00 00 00 00       	mov    $0x0,%eax
+  803869:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80386c:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803873:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80387c:	5b                   	pop    %ebx
+  80387d:	5e                   	pop    %esi
+  80387e:	5f                   	pop    %edi
+  80387f:	5d                   	pop    %ebp
+  803880:	c3                   	ret
+		if (from_env_store)
+  803881:	85 ff                	test   %edi,%edi
+  803883:	74 06                	je     80388b <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803885:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  80388b:	85 f6                	test   %esi,%esi
+  80388d:	74 06                	je     803895 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80388f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803895:	85 db                	test   %ebx,%ebx
+  803897:	74 e0                	je     803879 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803899:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80389f:	eb d8                	jmp    803879 <ipc_recv_pages+0xe5>
+
+008038a1 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8038a1:	55                   	push   %ebp
+  8038a2:	89 e5                	mov    %esp,%ebp
+  8038a4:	57                   	push   %edi
+  8038a5:	56                   	push   %esi
+  8038a6:	53                   	push   %ebx
+  8038a7:	83 ec 1c             	sub    $0x1c,%esp
+  8038aa:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8038ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038b0:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038b6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038ba:	75 2b                	jne    8038e7 <ipc_try_send_pages+0x46>
+  8038bc:	89 e2                	mov    %esp,%edx
+  8038be:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038c3:	29 d0                	sub    %edx,%eax
+  8038c5:	89 c2                	mov    %eax,%edx
+  8038c7:	c1 ea 0f             	shr    $0xf,%edx
+  8038ca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d4:	0f 42 c2             	cmovb  %edx,%eax
+  8038d7:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8038de:	8b 70 48             	mov    0x48(%eax),%esi
+  8038e1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038e7:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8038ed:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8038f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038f5:	85 ff                	test   %edi,%edi
+  8038f7:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8038fc:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8038ff:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803905:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80390b:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803911:	83 ec 0c             	sub    $0xc,%esp
+  803914:	ff 75 14             	push   0x14(%ebp)
+  803917:	ff 75 18             	push   0x18(%ebp)
+  80391a:	57                   	push   %edi
+  80391b:	ff 75 0c             	push   0xc(%ebp)
+  80391e:	ff 75 08             	push   0x8(%ebp)
+  803921:	e8 11 d7 ff ff       	call   801037 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803926:	83 c4 20             	add    $0x20,%esp
+  803929:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80392c:	75 21                	jne    80394f <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80392e:	83 ec 04             	sub    $0x4,%esp
+  803931:	6a ff                	push   $0xffffffff
+  803933:	53                   	push   %ebx
+  803934:	ff 75 e4             	push   -0x1c(%ebp)
+  803937:	e8 08 d9 ff ff       	call   801244 <sys_futex_wait>
+  80393c:	83 c4 10             	add    $0x10,%esp
+  80393f:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803942:	74 c7                	je     80390b <ipc_try_send_pages+0x6a>
+  803944:	85 c0                	test   %eax,%eax
+  803946:	79 c3                	jns    80390b <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803948:	e8 da d4 ff ff       	call   800e27 <sys_yield>
+  80394d:	eb bc                	jmp    80390b <ipc_try_send_pages+0x6a>
+	}
+}
+  80394f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803952:	5b                   	pop    %ebx
+  803953:	5e                   	pop    %esi
+  803954:	5f                   	pop    %edi
+  803955:	5d                   	pop    %ebp
+  803956:	c3                   	ret
+
+00803957 <ipc_send>:
+{
+  803957:	55                   	push   %ebp
+  803958:	89 e5                	mov    %esp,%ebp
+  80395a:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80395d:	ff 75 14             	push   0x14(%ebp)
+  803960:	6a 01                	push   $0x1
+  803962:	ff 75 10             	push   0x10(%ebp)
+  803965:	ff 75 0c             	push   0xc(%ebp)
+  803968:	ff 75 08             	push   0x8(%ebp)
+  80396b:	e8 31 ff ff ff       	call   8038a1 <ipc_try_send_pages>
+  803970:	83 c4 20             	add    $0x20,%esp
+  803973:	85 c0                	test   %eax,%eax
+  803975:	78 02                	js     803979 <ipc_send+0x22>
+}
+  803977:	c9                   	leave
+  803978:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803979:	50                   	push   %eax
+  80397a:	68 ef 44 80 00       	push   $0x8044ef
+  80397f:	6a 3f                	push   $0x3f
+  803981:	68 04 45 80 00       	push   $0x804504
+  803986:	e8 f6 fc ff ff       	call   803681 <_panic>
+
+0080398b <ipc_send_pages>:
+{
+  80398b:	55                   	push   %ebp
+  80398c:	89 e5                	mov    %esp,%ebp
+  80398e:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803991:	ff 75 18             	push   0x18(%ebp)
+  803994:	ff 75 14             	push   0x14(%ebp)
+  803997:	ff 75 10             	push   0x10(%ebp)
+  80399a:	ff 75 0c             	push   0xc(%ebp)
+  80399d:	ff 75 08             	push   0x8(%ebp)
+  8039a0:	e8 fc fe ff ff       	call   8038a1 <ipc_try_send_pages>
+  8039a5:	83 c4 20             	add    $0x20,%esp
+  8039a8:	85 c0                	test   %eax,%eax
+  8039aa:	78 02                	js     8039ae <ipc_send_pages+0x23>
+}
+  8039ac:	c9                   	leave
+  8039ad:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8039ae:	50                   	push   %eax
+  8039af:	68 0e 45 80 00       	push   $0x80450e
+  8039b4:	6a 64                	push   $0x64
+  8039b6:	68 04 45 80 00       	push   $0x804504
+  8039bb:	e8 c1 fc ff ff       	call   803681 <_panic>
+
+008039c0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8039c0:	55                   	push   %ebp
+  8039c1:	89 e5                	mov    %esp,%ebp
+  8039c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8039c6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8039cb:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8039d1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039d7:	8b 52 50             	mov    0x50(%edx),%edx
+  8039da:	39 ca                	cmp    %ecx,%edx
+  8039dc:	74 11                	je     8039ef <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8039de:	83 c0 01             	add    $0x1,%eax
+  8039e1:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8039e6:	75 e3                	jne    8039cb <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8039e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ed:	eb 0e                	jmp    8039fd <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8039ef:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8039f5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039fa:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8039fd:	5d                   	pop    %ebp
+  8039fe:	c3                   	ret
+
+008039ff <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8039ff:	55                   	push   %ebp
+  803a00:	89 e5                	mov    %esp,%ebp
+  803a02:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a05:	89 c2                	mov    %eax,%edx
+  803a07:	c1 ea 16             	shr    $0x16,%edx
+  803a0a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a11:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a16:	f6 c1 01             	test   $0x1,%cl
+  803a19:	74 1e                	je     803a39 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803a1b:	c1 e8 0c             	shr    $0xc,%eax
+  803a1e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a25:	a8 01                	test   $0x1,%al
+  803a27:	74 10                	je     803a39 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a29:	c1 e8 0c             	shr    $0xc,%eax
+  803a2c:	c1 e0 04             	shl    $0x4,%eax
+  803a2f:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803a36:	0f b7 d2             	movzwl %dx,%edx
+}
+  803a39:	89 d0                	mov    %edx,%eax
+  803a3b:	5d                   	pop    %ebp
+  803a3c:	c3                   	ret
+
+00803a3d <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  803a3d:	55                   	push   %ebp
+  803a3e:	89 e5                	mov    %esp,%ebp
+  803a40:	57                   	push   %edi
+  803a41:	56                   	push   %esi
+  803a42:	53                   	push   %ebx
+  803a43:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  803a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a49:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  803a4c:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  803a4f:	bf 38 63 80 00       	mov    $0x806338,%edi
+  803a54:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  803a57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a5c:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803a5f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  803a62:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803a67:	f6 e2                	mul    %dl
+  803a69:	66 c1 e8 0b          	shr    $0xb,%ax
+  803a6d:	89 c7                	mov    %eax,%edi
+  803a6f:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803a72:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803a75:	01 db                	add    %ebx,%ebx
+  803a77:	89 d0                	mov    %edx,%eax
+  803a79:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  803a7b:	89 d6                	mov    %edx,%esi
+  803a7d:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  803a7f:	89 cb                	mov    %ecx,%ebx
+  803a81:	83 c1 01             	add    $0x1,%ecx
+  803a84:	0f b6 fb             	movzbl %bl,%edi
+  803a87:	83 c0 30             	add    $0x30,%eax
+  803a8a:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  803a8e:	89 f0                	mov    %esi,%eax
+  803a90:	3c 09                	cmp    $0x9,%al
+  803a92:	77 ce                	ja     803a62 <inet_ntoa+0x25>
+  803a94:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803a97:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803a9a:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  803a9c:	84 c9                	test   %cl,%cl
+  803a9e:	74 4d                	je     803aed <inet_ntoa+0xb0>
+  803aa0:	0f b6 db             	movzbl %bl,%ebx
+  803aa3:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803aa6:	01 d8                	add    %ebx,%eax
+  803aa8:	89 f9                	mov    %edi,%ecx
+  803aaa:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  803aad:	83 c1 01             	add    $0x1,%ecx
+  803ab0:	0f b6 10             	movzbl (%eax),%edx
+  803ab3:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  803ab6:	89 c2                	mov    %eax,%edx
+  803ab8:	83 e8 01             	sub    $0x1,%eax
+  803abb:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803abe:	39 da                	cmp    %ebx,%edx
+  803ac0:	75 eb                	jne    803aad <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  803ac2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803ac5:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  803ac9:	8d 78 01             	lea    0x1(%eax),%edi
+  803acc:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  803acf:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  803ad2:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803ad5:	39 ce                	cmp    %ecx,%esi
+  803ad7:	0f 85 77 ff ff ff    	jne    803a54 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  803add:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  803ae0:	b8 38 63 80 00       	mov    $0x806338,%eax
+  803ae5:	83 c4 1c             	add    $0x1c,%esp
+  803ae8:	5b                   	pop    %ebx
+  803ae9:	5e                   	pop    %esi
+  803aea:	5f                   	pop    %edi
+  803aeb:	5d                   	pop    %ebp
+  803aec:	c3                   	ret
+    while(i--)
+  803aed:	89 f8                	mov    %edi,%eax
+  803aef:	eb d8                	jmp    803ac9 <inet_ntoa+0x8c>
+
+00803af1 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  803af1:	55                   	push   %ebp
+  803af2:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803af4:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803af8:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  803afc:	5d                   	pop    %ebp
+  803afd:	c3                   	ret
+
+00803afe <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  803afe:	55                   	push   %ebp
+  803aff:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803b01:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803b05:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  803b09:	5d                   	pop    %ebp
+  803b0a:	c3                   	ret
+
+00803b0b <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  803b0b:	55                   	push   %ebp
+  803b0c:	89 e5                	mov    %esp,%ebp
+  803b0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  803b11:	89 d0                	mov    %edx,%eax
+  803b13:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  803b16:	89 d1                	mov    %edx,%ecx
+  803b18:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803b1b:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  803b1d:	89 d1                	mov    %edx,%ecx
+  803b1f:	c1 e1 08             	shl    $0x8,%ecx
+  803b22:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803b28:	09 c8                	or     %ecx,%eax
+  803b2a:	c1 ea 08             	shr    $0x8,%edx
+  803b2d:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803b33:	09 d0                	or     %edx,%eax
+}
+  803b35:	5d                   	pop    %ebp
+  803b36:	c3                   	ret
+
+00803b37 <inet_aton>:
+{
+  803b37:	55                   	push   %ebp
+  803b38:	89 e5                	mov    %esp,%ebp
+  803b3a:	57                   	push   %edi
+  803b3b:	56                   	push   %esi
+  803b3c:	53                   	push   %ebx
+  803b3d:	83 ec 2c             	sub    $0x2c,%esp
+  803b40:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  803b43:	0f b6 0a             	movzbl (%edx),%ecx
+  803b46:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803b49:	83 e9 30             	sub    $0x30,%ecx
+  803b4c:	80 f9 09             	cmp    $0x9,%cl
+  803b4f:	0f 87 b6 01 00 00    	ja     803d0b <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  803b55:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  803b58:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803b5b:	e9 aa 00 00 00       	jmp    803c0a <inet_aton+0xd3>
+      c = *++cp;
+  803b60:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  803b64:	89 c1                	mov    %eax,%ecx
+  803b66:	83 e1 df             	and    $0xffffffdf,%ecx
+  803b69:	80 f9 58             	cmp    $0x58,%cl
+  803b6c:	74 10                	je     803b7e <inet_aton+0x47>
+      c = *++cp;
+  803b6e:	83 c2 01             	add    $0x1,%edx
+  803b71:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  803b74:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b79:	e9 9a 00 00 00       	jmp    803c18 <inet_aton+0xe1>
+        c = *++cp;
+  803b7e:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803b82:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  803b85:	bf 10 00 00 00       	mov    $0x10,%edi
+  803b8a:	e9 89 00 00 00       	jmp    803c18 <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  803b8f:	0f af d7             	imul   %edi,%edx
+  803b92:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  803b96:	0f be 01             	movsbl (%ecx),%eax
+  803b99:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  803b9c:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803b9f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803ba2:	80 fb 09             	cmp    $0x9,%bl
+  803ba5:	76 e8                	jbe    803b8f <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  803ba7:	83 ff 10             	cmp    $0x10,%edi
+  803baa:	75 2e                	jne    803bda <inet_aton+0xa3>
+  803bac:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803bb0:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803bb3:	83 e3 df             	and    $0xffffffdf,%ebx
+  803bb6:	83 eb 41             	sub    $0x41,%ebx
+  803bb9:	80 fb 05             	cmp    $0x5,%bl
+  803bbc:	77 1c                	ja     803bda <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  803bbe:	c1 e2 04             	shl    $0x4,%edx
+  803bc1:	83 c0 0a             	add    $0xa,%eax
+  803bc4:	89 f3                	mov    %esi,%ebx
+  803bc6:	80 fb 1a             	cmp    $0x1a,%bl
+  803bc9:	19 db                	sbb    %ebx,%ebx
+  803bcb:	83 e3 20             	and    $0x20,%ebx
+  803bce:	83 c3 41             	add    $0x41,%ebx
+  803bd1:	29 d8                	sub    %ebx,%eax
+  803bd3:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  803bd5:	0f be 01             	movsbl (%ecx),%eax
+  803bd8:	eb bf                	jmp    803b99 <inet_aton+0x62>
+    if (c == '.') {
+  803bda:	83 f8 2e             	cmp    $0x2e,%eax
+  803bdd:	75 46                	jne    803c25 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  803bdf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803be2:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803be5:	39 f0                	cmp    %esi,%eax
+  803be7:	0f 84 25 01 00 00    	je     803d12 <inet_aton+0x1db>
+      *pp++ = val;
+  803bed:	83 c0 04             	add    $0x4,%eax
+  803bf0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803bf3:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  803bf6:	89 ca                	mov    %ecx,%edx
+  803bf8:	0f b6 09             	movzbl (%ecx),%ecx
+  803bfb:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803bfe:	83 e9 30             	sub    $0x30,%ecx
+  803c01:	80 f9 09             	cmp    $0x9,%cl
+  803c04:	0f 87 17 01 00 00    	ja     803d21 <inet_aton+0x1ea>
+    base = 10;
+  803c0a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  803c0f:	83 f8 30             	cmp    $0x30,%eax
+  803c12:	0f 84 48 ff ff ff    	je     803b60 <inet_aton+0x29>
+  803c18:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  803c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c20:	e9 77 ff ff ff       	jmp    803b9c <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803c25:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803c29:	89 d6                	mov    %edx,%esi
+  803c2b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803c2e:	85 c0                	test   %eax,%eax
+  803c30:	74 2e                	je     803c60 <inet_aton+0x129>
+    return (0);
+  803c32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803c37:	89 fa                	mov    %edi,%edx
+  803c39:	80 fa 1f             	cmp    $0x1f,%dl
+  803c3c:	0f 86 d5 00 00 00    	jbe    803d17 <inet_aton+0x1e0>
+  803c42:	84 c0                	test   %al,%al
+  803c44:	0f 88 cd 00 00 00    	js     803d17 <inet_aton+0x1e0>
+  803c4a:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803c4d:	83 f9 04             	cmp    $0x4,%ecx
+  803c50:	76 0e                	jbe    803c60 <inet_aton+0x129>
+    return (0);
+  803c52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803c57:	83 f8 20             	cmp    $0x20,%eax
+  803c5a:	0f 85 b7 00 00 00    	jne    803d17 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  803c60:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803c63:	89 d8                	mov    %ebx,%eax
+  803c65:	29 c8                	sub    %ecx,%eax
+  803c67:	c1 f8 02             	sar    $0x2,%eax
+  803c6a:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  803c6d:	83 f8 02             	cmp    $0x2,%eax
+  803c70:	74 7a                	je     803cec <inet_aton+0x1b5>
+  803c72:	83 f9 03             	cmp    $0x3,%ecx
+  803c75:	7f 49                	jg     803cc0 <inet_aton+0x189>
+  803c77:	85 c9                	test   %ecx,%ecx
+  803c79:	0f 84 98 00 00 00    	je     803d17 <inet_aton+0x1e0>
+  803c7f:	83 f9 02             	cmp    $0x2,%ecx
+  803c82:	75 19                	jne    803c9d <inet_aton+0x166>
+      return (0);
+  803c84:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  803c89:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803c8f:	0f 87 82 00 00 00    	ja     803d17 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  803c95:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803c98:	c1 e0 18             	shl    $0x18,%eax
+  803c9b:	09 c6                	or     %eax,%esi
+  return (1);
+  803c9d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  803ca2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803ca6:	74 6f                	je     803d17 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  803ca8:	83 ec 0c             	sub    $0xc,%esp
+  803cab:	56                   	push   %esi
+  803cac:	e8 5a fe ff ff       	call   803b0b <htonl>
+  803cb1:	83 c4 10             	add    $0x10,%esp
+  803cb4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803cb7:	89 06                	mov    %eax,(%esi)
+  return (1);
+  803cb9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803cbe:	eb 57                	jmp    803d17 <inet_aton+0x1e0>
+  switch (n) {
+  803cc0:	83 f9 04             	cmp    $0x4,%ecx
+  803cc3:	75 d8                	jne    803c9d <inet_aton+0x166>
+      return (0);
+  803cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  803cca:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803cd0:	77 45                	ja     803d17 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  803cd2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803cd5:	c1 e0 18             	shl    $0x18,%eax
+  803cd8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803cdb:	c1 e1 10             	shl    $0x10,%ecx
+  803cde:	09 c8                	or     %ecx,%eax
+  803ce0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803ce3:	c1 e1 08             	shl    $0x8,%ecx
+  803ce6:	09 c8                	or     %ecx,%eax
+  803ce8:	09 c6                	or     %eax,%esi
+    break;
+  803cea:	eb b1                	jmp    803c9d <inet_aton+0x166>
+      return (0);
+  803cec:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  803cf1:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803cf7:	77 1e                	ja     803d17 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  803cf9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803cfc:	c1 e0 18             	shl    $0x18,%eax
+  803cff:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803d02:	c1 e1 10             	shl    $0x10,%ecx
+  803d05:	09 c8                	or     %ecx,%eax
+  803d07:	09 c6                	or     %eax,%esi
+    break;
+  803d09:	eb 92                	jmp    803c9d <inet_aton+0x166>
+      return (0);
+  803d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d10:	eb 05                	jmp    803d17 <inet_aton+0x1e0>
+        return (0);
+  803d12:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  803d17:	89 c8                	mov    %ecx,%eax
+  803d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d1c:	5b                   	pop    %ebx
+  803d1d:	5e                   	pop    %esi
+  803d1e:	5f                   	pop    %edi
+  803d1f:	5d                   	pop    %ebp
+  803d20:	c3                   	ret
+      return (0);
+  803d21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d26:	eb ef                	jmp    803d17 <inet_aton+0x1e0>
+
+00803d28 <inet_addr>:
+{
+  803d28:	55                   	push   %ebp
+  803d29:	89 e5                	mov    %esp,%ebp
+  803d2b:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  803d2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d31:	50                   	push   %eax
+  803d32:	ff 75 08             	push   0x8(%ebp)
+  803d35:	e8 fd fd ff ff       	call   803b37 <inet_aton>
+  803d3a:	89 c2                	mov    %eax,%edx
+  803d3c:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  803d3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  803d44:	85 d2                	test   %edx,%edx
+  803d46:	75 02                	jne    803d4a <inet_addr+0x22>
+}
+  803d48:	c9                   	leave
+  803d49:	c3                   	ret
+    return (val.s_addr);
+  803d4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d4d:	eb f9                	jmp    803d48 <inet_addr+0x20>
+
+00803d4f <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  803d4f:	55                   	push   %ebp
+  803d50:	89 e5                	mov    %esp,%ebp
+  803d52:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  803d55:	ff 75 08             	push   0x8(%ebp)
+  803d58:	e8 ae fd ff ff       	call   803b0b <htonl>
+  803d5d:	83 c4 10             	add    $0x10,%esp
+}
+  803d60:	c9                   	leave
+  803d61:	c3                   	ret
+
+00803d62 <__udivdi3>:
+  803d62:	57                   	push   %edi
+  803d63:	56                   	push   %esi
+  803d64:	53                   	push   %ebx
+  803d65:	83 ec 20             	sub    $0x20,%esp
+  803d68:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803d6c:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803d70:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803d74:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803d78:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803d7c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803d80:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803d84:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803d88:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d92:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d97:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803d9e:	00 
+  803d9f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803da6:	00 
+  803da7:	eb 08                	jmp    803db1 <__udivdi3+0x4f>
+  803da9:	83 e9 01             	sub    $0x1,%ecx
+  803dac:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803daf:	74 68                	je     803e19 <__udivdi3+0xb7>
+  803db1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803db5:	01 c0                	add    %eax,%eax
+  803db7:	89 c6                	mov    %eax,%esi
+  803db9:	89 d7                	mov    %edx,%edi
+  803dbb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803dbf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803dc3:	0f ad d0             	shrd   %cl,%edx,%eax
+  803dc6:	d3 ea                	shr    %cl,%edx
+  803dc8:	f6 c1 20             	test   $0x20,%cl
+  803dcb:	74 04                	je     803dd1 <__udivdi3+0x6f>
+  803dcd:	89 d0                	mov    %edx,%eax
+  803dcf:	31 d2                	xor    %edx,%edx
+  803dd1:	83 e0 01             	and    $0x1,%eax
+  803dd4:	89 04 24             	mov    %eax,(%esp)
+  803dd7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803dde:	00 
+  803ddf:	8b 04 24             	mov    (%esp),%eax
+  803de2:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803de6:	09 f0                	or     %esi,%eax
+  803de8:	09 fa                	or     %edi,%edx
+  803dea:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803dee:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803df2:	39 f0                	cmp    %esi,%eax
+  803df4:	89 d3                	mov    %edx,%ebx
+  803df6:	19 fb                	sbb    %edi,%ebx
+  803df8:	72 af                	jb     803da9 <__udivdi3+0x47>
+  803dfa:	29 f0                	sub    %esi,%eax
+  803dfc:	19 fa                	sbb    %edi,%edx
+  803dfe:	89 cf                	mov    %ecx,%edi
+  803e00:	c1 ef 05             	shr    $0x5,%edi
+  803e03:	83 e7 01             	and    $0x1,%edi
+  803e06:	89 fe                	mov    %edi,%esi
+  803e08:	83 f6 01             	xor    $0x1,%esi
+  803e0b:	d3 e6                	shl    %cl,%esi
+  803e0d:	d3 e7                	shl    %cl,%edi
+  803e0f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803e13:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803e17:	eb 90                	jmp    803da9 <__udivdi3+0x47>
+  803e19:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e1d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e21:	83 c4 20             	add    $0x20,%esp
+  803e24:	5b                   	pop    %ebx
+  803e25:	5e                   	pop    %esi
+  803e26:	5f                   	pop    %edi
+  803e27:	c3                   	ret
+
+00803e28 <__umoddi3>:
+  803e28:	57                   	push   %edi
+  803e29:	56                   	push   %esi
+  803e2a:	53                   	push   %ebx
+  803e2b:	83 ec 08             	sub    $0x8,%esp
+  803e2e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e32:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e36:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803e3a:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803e3e:	57                   	push   %edi
+  803e3f:	56                   	push   %esi
+  803e40:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803e44:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803e48:	52                   	push   %edx
+  803e49:	50                   	push   %eax
+  803e4a:	e8 13 ff ff ff       	call   803d62 <__udivdi3>
+  803e4f:	89 c3                	mov    %eax,%ebx
+  803e51:	0f af d6             	imul   %esi,%edx
+  803e54:	89 f9                	mov    %edi,%ecx
+  803e56:	0f af cb             	imul   %ebx,%ecx
+  803e59:	01 d1                	add    %edx,%ecx
+  803e5b:	89 d8                	mov    %ebx,%eax
+  803e5d:	f7 e6                	mul    %esi
+  803e5f:	89 c6                	mov    %eax,%esi
+  803e61:	89 d7                	mov    %edx,%edi
+  803e63:	01 cf                	add    %ecx,%edi
+  803e65:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803e69:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803e6d:	29 f0                	sub    %esi,%eax
+  803e6f:	19 fa                	sbb    %edi,%edx
+  803e71:	83 c4 18             	add    $0x18,%esp
+  803e74:	5b                   	pop    %ebx
+  803e75:	5e                   	pop    %esi
+  803e76:	5f                   	pop    %edi
+  803e77:	c3                   	ret
+
+00803e78 <__divdi3>:
+  803e78:	53                   	push   %ebx
+  803e79:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803e7d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803e81:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803e85:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803e89:	85 d2                	test   %edx,%edx
+  803e8b:	78 12                	js     803e9f <__divdi3+0x27>
+  803e8d:	85 db                	test   %ebx,%ebx
+  803e8f:	78 2e                	js     803ebf <__divdi3+0x47>
+  803e91:	53                   	push   %ebx
+  803e92:	51                   	push   %ecx
+  803e93:	52                   	push   %edx
+  803e94:	50                   	push   %eax
+  803e95:	e8 c8 fe ff ff       	call   803d62 <__udivdi3>
+  803e9a:	83 c4 10             	add    $0x10,%esp
+  803e9d:	eb 1e                	jmp    803ebd <__divdi3+0x45>
+  803e9f:	f7 d8                	neg    %eax
+  803ea1:	83 d2 00             	adc    $0x0,%edx
+  803ea4:	f7 da                	neg    %edx
+  803ea6:	85 db                	test   %ebx,%ebx
+  803ea8:	78 2a                	js     803ed4 <__divdi3+0x5c>
+  803eaa:	53                   	push   %ebx
+  803eab:	51                   	push   %ecx
+  803eac:	52                   	push   %edx
+  803ead:	50                   	push   %eax
+  803eae:	e8 af fe ff ff       	call   803d62 <__udivdi3>
+  803eb3:	83 c4 10             	add    $0x10,%esp
+  803eb6:	f7 d8                	neg    %eax
+  803eb8:	83 d2 00             	adc    $0x0,%edx
+  803ebb:	f7 da                	neg    %edx
+  803ebd:	5b                   	pop    %ebx
+  803ebe:	c3                   	ret
+  803ebf:	f7 d9                	neg    %ecx
+  803ec1:	83 d3 00             	adc    $0x0,%ebx
+  803ec4:	f7 db                	neg    %ebx
+  803ec6:	53                   	push   %ebx
+  803ec7:	51                   	push   %ecx
+  803ec8:	52                   	push   %edx
+  803ec9:	50                   	push   %eax
+  803eca:	e8 93 fe ff ff       	call   803d62 <__udivdi3>
+  803ecf:	83 c4 10             	add    $0x10,%esp
+  803ed2:	eb e2                	jmp    803eb6 <__divdi3+0x3e>
+  803ed4:	f7 d9                	neg    %ecx
+  803ed6:	83 d3 00             	adc    $0x0,%ebx
+  803ed9:	f7 db                	neg    %ebx
+  803edb:	53                   	push   %ebx
+  803edc:	51                   	push   %ecx
+  803edd:	52                   	push   %edx
+  803ede:	50                   	push   %eax
+  803edf:	e8 7e fe ff ff       	call   803d62 <__udivdi3>
+  803ee4:	83 c4 10             	add    $0x10,%esp
+  803ee7:	eb d4                	jmp    803ebd <__divdi3+0x45>
+
+00803ee9 <__moddi3>:
+  803ee9:	57                   	push   %edi
+  803eea:	56                   	push   %esi
+  803eeb:	53                   	push   %ebx
+  803eec:	83 ec 08             	sub    $0x8,%esp
+  803eef:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ef3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ef7:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803efb:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803eff:	57                   	push   %edi
+  803f00:	56                   	push   %esi
+  803f01:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f05:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f09:	52                   	push   %edx
+  803f0a:	50                   	push   %eax
+  803f0b:	e8 68 ff ff ff       	call   803e78 <__divdi3>
+  803f10:	89 c3                	mov    %eax,%ebx
+  803f12:	0f af d6             	imul   %esi,%edx
+  803f15:	89 f9                	mov    %edi,%ecx
+  803f17:	0f af cb             	imul   %ebx,%ecx
+  803f1a:	01 d1                	add    %edx,%ecx
+  803f1c:	89 d8                	mov    %ebx,%eax
+  803f1e:	f7 e6                	mul    %esi
+  803f20:	89 c6                	mov    %eax,%esi
+  803f22:	89 d7                	mov    %edx,%edi
+  803f24:	01 cf                	add    %ecx,%edi
+  803f26:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803f2a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803f2e:	29 f0                	sub    %esi,%eax
+  803f30:	19 fa                	sbb    %edi,%edx
+  803f32:	83 c4 18             	add    $0x18,%esp
+  803f35:	5b                   	pop    %ebx
+  803f36:	5e                   	pop    %esi
+  803f37:	5f                   	pop    %edi
+  803f38:	c3                   	ret
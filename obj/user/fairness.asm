@@ -0,0 +1,7910 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8e 00 00 00       	call   8000bf <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003d:	e8 a6 0c 00 00       	call   800ce8 <sys_getenvid>
+  800042:	89 c3                	mov    %eax,%ebx
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800044:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800046:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80004b:	29 d0                	sub    %edx,%eax
+  80004d:	89 c2                	mov    %eax,%edx
+  80004f:	c1 ea 0f             	shr    $0xf,%edx
+  800052:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005c:	0f 42 c2             	cmovb  %edx,%eax
+
+	if (thisenv == &envs[1]) {
+  80005f:	81 3c 85 40 63 80 00 	cmpl   $0xeec000bc,0x806340(,%eax,4)
+  800066:	bc 00 c0 ee 
+  80006a:	74 2d                	je     800099 <umain+0x64>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80006c:	a1 04 01 c0 ee       	mov    0xeec00104,%eax
+  800071:	83 ec 04             	sub    $0x4,%esp
+  800074:	50                   	push   %eax
+  800075:	53                   	push   %ebx
+  800076:	68 11 3b 80 00       	push   $0x803b11
+  80007b:	e8 7b 01 00 00       	call   8001fb <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  800083:	a1 04 01 c0 ee       	mov    0xeec00104,%eax
+  800088:	6a 00                	push   $0x0
+  80008a:	6a 00                	push   $0x0
+  80008c:	6a 00                	push   $0x0
+  80008e:	50                   	push   %eax
+  80008f:	e8 85 13 00 00       	call   801419 <ipc_send>
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	eb ea                	jmp    800083 <umain+0x4e>
+			ipc_recv(&who, 0, 0);
+  800099:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80009c:	83 ec 04             	sub    $0x4,%esp
+  80009f:	6a 00                	push   $0x0
+  8000a1:	6a 00                	push   $0x0
+  8000a3:	56                   	push   %esi
+  8000a4:	e8 e0 10 00 00       	call   801189 <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  8000a9:	83 c4 0c             	add    $0xc,%esp
+  8000ac:	ff 75 f4             	push   -0xc(%ebp)
+  8000af:	53                   	push   %ebx
+  8000b0:	68 00 3b 80 00       	push   $0x803b00
+  8000b5:	e8 41 01 00 00       	call   8001fb <cprintf>
+  8000ba:	83 c4 10             	add    $0x10,%esp
+  8000bd:	eb dd                	jmp    80009c <umain+0x67>
+
+008000bf <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000bf:	55                   	push   %ebp
+  8000c0:	89 e5                	mov    %esp,%ebp
+  8000c2:	56                   	push   %esi
+  8000c3:	53                   	push   %ebx
+  8000c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ca:	89 e2                	mov    %esp,%edx
+  8000cc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000d1:	29 d0                	sub    %edx,%eax
+  8000d3:	89 c2                	mov    %eax,%edx
+  8000d5:	c1 ea 0f             	shr    $0xf,%edx
+  8000d8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e2:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8000e5:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  8000ec:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8000f0:	e8 f3 0b 00 00       	call   800ce8 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8000f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000fa:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800100:	89 e1                	mov    %esp,%ecx
+  800102:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800107:	29 ca                	sub    %ecx,%edx
+  800109:	89 d1                	mov    %edx,%ecx
+  80010b:	c1 e9 0f             	shr    $0xf,%ecx
+  80010e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800114:	ba 00 00 00 00       	mov    $0x0,%edx
+  800119:	0f 42 d1             	cmovb  %ecx,%edx
+  80011c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800121:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800128:	85 db                	test   %ebx,%ebx
+  80012a:	7e 07                	jle    800133 <libmain+0x74>
+		binaryname = argv[0];
+  80012c:	8b 06                	mov    (%esi),%eax
+  80012e:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	e8 f8 fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  80013d:	e8 0a 00 00 00       	call   80014c <exit>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800152:	e8 53 15 00 00       	call   8016aa <close_all>
+	sys_env_destroy(0);
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	6a 00                	push   $0x0
+  80015c:	e8 46 0b 00 00       	call   800ca7 <sys_env_destroy>
+}
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+
+00800166 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	53                   	push   %ebx
+  80016a:	83 ec 04             	sub    $0x4,%esp
+  80016d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800170:	8b 13                	mov    (%ebx),%edx
+  800172:	8d 42 01             	lea    0x1(%edx),%eax
+  800175:	89 03                	mov    %eax,(%ebx)
+  800177:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80017a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80017e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800183:	74 09                	je     80018e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800185:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800189:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80018e:	83 ec 08             	sub    $0x8,%esp
+  800191:	68 ff 00 00 00       	push   $0xff
+  800196:	8d 43 08             	lea    0x8(%ebx),%eax
+  800199:	50                   	push   %eax
+  80019a:	e8 cb 0a 00 00       	call   800c6a <sys_cputs>
+		b->idx = 0;
+  80019f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a5:	83 c4 10             	add    $0x10,%esp
+  8001a8:	eb db                	jmp    800185 <putch+0x1f>
+
+008001aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001b3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ba:	00 00 00 
+	b.cnt = 0;
+  8001bd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001c7:	ff 75 0c             	push   0xc(%ebp)
+  8001ca:	ff 75 08             	push   0x8(%ebp)
+  8001cd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d3:	50                   	push   %eax
+  8001d4:	68 66 01 80 00       	push   $0x800166
+  8001d9:	e8 1c 01 00 00       	call   8002fa <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001de:	83 c4 08             	add    $0x8,%esp
+  8001e1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ed:	50                   	push   %eax
+  8001ee:	e8 77 0a 00 00       	call   800c6a <sys_cputs>
+
+	return b.cnt;
+}
+  8001f3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+
+008001fb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800201:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800204:	50                   	push   %eax
+  800205:	ff 75 08             	push   0x8(%ebp)
+  800208:	e8 9d ff ff ff       	call   8001aa <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+0080020f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80020f:	55                   	push   %ebp
+  800210:	89 e5                	mov    %esp,%ebp
+  800212:	57                   	push   %edi
+  800213:	56                   	push   %esi
+  800214:	53                   	push   %ebx
+  800215:	83 ec 1c             	sub    $0x1c,%esp
+  800218:	89 c3                	mov    %eax,%ebx
+  80021a:	89 d6                	mov    %edx,%esi
+  80021c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800222:	89 d1                	mov    %edx,%ecx
+  800224:	89 c2                	mov    %eax,%edx
+  800226:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800229:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80022c:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800232:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800239:	39 c2                	cmp    %eax,%edx
+  80023b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80023e:	73 4b                	jae    80028b <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800240:	8b 45 14             	mov    0x14(%ebp),%eax
+  800243:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800246:	85 ff                	test   %edi,%edi
+  800248:	7e 11                	jle    80025b <printnum+0x4c>
+			putch(padc, putdat);
+  80024a:	83 ec 08             	sub    $0x8,%esp
+  80024d:	56                   	push   %esi
+  80024e:	ff 75 18             	push   0x18(%ebp)
+  800251:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800253:	83 c4 10             	add    $0x10,%esp
+  800256:	83 ef 01             	sub    $0x1,%edi
+  800259:	75 ef                	jne    80024a <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80025b:	83 ec 08             	sub    $0x8,%esp
+  80025e:	56                   	push   %esi
+  80025f:	83 ec 04             	sub    $0x4,%esp
+  800262:	ff 75 e4             	push   -0x1c(%ebp)
+  800265:	ff 75 e0             	push   -0x20(%ebp)
+  800268:	ff 75 dc             	push   -0x24(%ebp)
+  80026b:	ff 75 d8             	push   -0x28(%ebp)
+  80026e:	e8 70 37 00 00       	call   8039e3 <__umoddi3>
+  800273:	83 c4 14             	add    $0x14,%esp
+  800276:	0f be 80 32 3b 80 00 	movsbl 0x803b32(%eax),%eax
+  80027d:	50                   	push   %eax
+  80027e:	ff d3                	call   *%ebx
+}
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800286:	5b                   	pop    %ebx
+  800287:	5e                   	pop    %esi
+  800288:	5f                   	pop    %edi
+  800289:	5d                   	pop    %ebp
+  80028a:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80028b:	83 ec 0c             	sub    $0xc,%esp
+  80028e:	ff 75 18             	push   0x18(%ebp)
+  800291:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800294:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800297:	52                   	push   %edx
+  800298:	50                   	push   %eax
+  800299:	83 ec 08             	sub    $0x8,%esp
+  80029c:	ff 75 e4             	push   -0x1c(%ebp)
+  80029f:	ff 75 e0             	push   -0x20(%ebp)
+  8002a2:	ff 75 dc             	push   -0x24(%ebp)
+  8002a5:	ff 75 d8             	push   -0x28(%ebp)
+  8002a8:	e8 70 36 00 00       	call   80391d <__udivdi3>
+  8002ad:	83 c4 18             	add    $0x18,%esp
+  8002b0:	52                   	push   %edx
+  8002b1:	50                   	push   %eax
+  8002b2:	89 f2                	mov    %esi,%edx
+  8002b4:	89 d8                	mov    %ebx,%eax
+  8002b6:	e8 54 ff ff ff       	call   80020f <printnum>
+  8002bb:	83 c4 20             	add    $0x20,%esp
+  8002be:	eb 9b                	jmp    80025b <printnum+0x4c>
+
+008002c0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c0:	55                   	push   %ebp
+  8002c1:	89 e5                	mov    %esp,%ebp
+  8002c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002c6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ca:	8b 10                	mov    (%eax),%edx
+  8002cc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002cf:	73 0a                	jae    8002db <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d4:	89 08                	mov    %ecx,(%eax)
+  8002d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d9:	88 02                	mov    %al,(%edx)
+}
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+
+008002dd <printfmt>:
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002e6:	50                   	push   %eax
+  8002e7:	ff 75 10             	push   0x10(%ebp)
+  8002ea:	ff 75 0c             	push   0xc(%ebp)
+  8002ed:	ff 75 08             	push   0x8(%ebp)
+  8002f0:	e8 05 00 00 00       	call   8002fa <vprintfmt>
+}
+  8002f5:	83 c4 10             	add    $0x10,%esp
+  8002f8:	c9                   	leave
+  8002f9:	c3                   	ret
+
+008002fa <vprintfmt>:
+{
+  8002fa:	55                   	push   %ebp
+  8002fb:	89 e5                	mov    %esp,%ebp
+  8002fd:	57                   	push   %edi
+  8002fe:	56                   	push   %esi
+  8002ff:	53                   	push   %ebx
+  800300:	83 ec 2c             	sub    $0x2c,%esp
+  800303:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800306:	89 df                	mov    %ebx,%edi
+  800308:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80030b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80030e:	8d 70 01             	lea    0x1(%eax),%esi
+  800311:	0f b6 00             	movzbl (%eax),%eax
+  800314:	83 f8 25             	cmp    $0x25,%eax
+  800317:	74 1e                	je     800337 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800319:	85 c0                	test   %eax,%eax
+  80031b:	0f 84 15 05 00 00    	je     800836 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800321:	83 ec 08             	sub    $0x8,%esp
+  800324:	53                   	push   %ebx
+  800325:	50                   	push   %eax
+  800326:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800328:	83 c6 01             	add    $0x1,%esi
+  80032b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	83 f8 25             	cmp    $0x25,%eax
+  800335:	75 e2                	jne    800319 <vprintfmt+0x1f>
+		padc = ' ';
+  800337:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80033b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800342:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800349:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800355:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800358:	8d 56 01             	lea    0x1(%esi),%edx
+  80035b:	0f b6 0e             	movzbl (%esi),%ecx
+  80035e:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800361:	3c 55                	cmp    $0x55,%al
+  800363:	0f 87 3b 04 00 00    	ja     8007a4 <vprintfmt+0x4aa>
+  800369:	0f b6 c0             	movzbl %al,%eax
+  80036c:	ff 24 85 a0 3c 80 00 	jmp    *0x803ca0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800373:	89 75 10             	mov    %esi,0x10(%ebp)
+  800376:	eb 93                	jmp    80030b <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800378:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80037a:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80037e:	eb d8                	jmp    800358 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800380:	89 d6                	mov    %edx,%esi
+  800382:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800386:	eb d0                	jmp    800358 <vprintfmt+0x5e>
+  800388:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80038b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80038e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800391:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800395:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800398:	83 f9 09             	cmp    $0x9,%ecx
+  80039b:	77 6f                	ja     80040c <vprintfmt+0x112>
+  80039d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8003a0:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8003a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003aa:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8003ad:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003b0:	83 fe 09             	cmp    $0x9,%esi
+  8003b3:	76 eb                	jbe    8003a0 <vprintfmt+0xa6>
+  8003b5:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8003b8:	89 d6                	mov    %edx,%esi
+  8003ba:	eb 13                	jmp    8003cf <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8b 00                	mov    (%eax),%eax
+  8003c1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ca:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cd:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8003cf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003d3:	79 83                	jns    800358 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8003d5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003db:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003e2:	e9 71 ff ff ff       	jmp    800358 <vprintfmt+0x5e>
+			if (width < 0)
+  8003e7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ea:	85 c9                	test   %ecx,%ecx
+  8003ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f1:	0f 49 c1             	cmovns %ecx,%eax
+  8003f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f7:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003f9:	e9 5a ff ff ff       	jmp    800358 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fe:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800400:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800407:	e9 4c ff ff ff       	jmp    800358 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040c:	89 d6                	mov    %edx,%esi
+  80040e:	eb bf                	jmp    8003cf <vprintfmt+0xd5>
+			lflag++;
+  800410:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800414:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800416:	e9 3d ff ff ff       	jmp    800358 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80041b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80041e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800421:	8d 70 04             	lea    0x4(%eax),%esi
+  800424:	83 ec 08             	sub    $0x8,%esp
+  800427:	53                   	push   %ebx
+  800428:	ff 30                	push   (%eax)
+  80042a:	ff d7                	call   *%edi
+			break;
+  80042c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80042f:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800432:	e9 d4 fe ff ff       	jmp    80030b <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800437:	89 55 10             	mov    %edx,0x10(%ebp)
+  80043a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043d:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800440:	8b 10                	mov    (%eax),%edx
+  800442:	89 d0                	mov    %edx,%eax
+  800444:	f7 d8                	neg    %eax
+  800446:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800449:	83 f8 12             	cmp    $0x12,%eax
+  80044c:	7f 23                	jg     800471 <vprintfmt+0x177>
+  80044e:	8b 14 85 00 3e 80 00 	mov    0x803e00(,%eax,4),%edx
+  800455:	85 d2                	test   %edx,%edx
+  800457:	74 18                	je     800471 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800459:	52                   	push   %edx
+  80045a:	68 93 3f 80 00       	push   $0x803f93
+  80045f:	53                   	push   %ebx
+  800460:	57                   	push   %edi
+  800461:	e8 77 fe ff ff       	call   8002dd <printfmt>
+  800466:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800469:	89 75 14             	mov    %esi,0x14(%ebp)
+  80046c:	e9 9a fe ff ff       	jmp    80030b <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800471:	50                   	push   %eax
+  800472:	68 4a 3b 80 00       	push   $0x803b4a
+  800477:	53                   	push   %ebx
+  800478:	57                   	push   %edi
+  800479:	e8 5f fe ff ff       	call   8002dd <printfmt>
+  80047e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800481:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800484:	e9 82 fe ff ff       	jmp    80030b <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800489:	89 55 10             	mov    %edx,0x10(%ebp)
+  80048c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048f:	83 c0 04             	add    $0x4,%eax
+  800492:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800495:	8b 45 14             	mov    0x14(%ebp),%eax
+  800498:	8b 00                	mov    (%eax),%eax
+  80049a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80049d:	85 c0                	test   %eax,%eax
+  80049f:	0f 84 61 03 00 00    	je     800806 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8004a5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004a9:	7e 06                	jle    8004b1 <vprintfmt+0x1b7>
+  8004ab:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004af:	75 29                	jne    8004da <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004b1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004b4:	8d 70 01             	lea    0x1(%eax),%esi
+  8004b7:	0f b6 00             	movzbl (%eax),%eax
+  8004ba:	0f be d0             	movsbl %al,%edx
+  8004bd:	85 d2                	test   %edx,%edx
+  8004bf:	0f 84 bb 00 00 00    	je     800580 <vprintfmt+0x286>
+  8004c5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004c8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004cb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004ce:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004d1:	eb 7a                	jmp    80054d <vprintfmt+0x253>
+				p = "(null)";
+  8004d3:	c7 45 d0 43 3b 80 00 	movl   $0x803b43,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	ff 75 d4             	push   -0x2c(%ebp)
+  8004e0:	ff 75 d0             	push   -0x30(%ebp)
+  8004e3:	e8 e0 03 00 00       	call   8008c8 <strnlen>
+  8004e8:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004eb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004ee:	83 c4 10             	add    $0x10,%esp
+  8004f1:	85 d2                	test   %edx,%edx
+  8004f3:	0f 8e d6 02 00 00    	jle    8007cf <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8004f9:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	53                   	push   %ebx
+  800501:	56                   	push   %esi
+  800502:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800504:	83 c4 10             	add    $0x10,%esp
+  800507:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80050b:	75 f0                	jne    8004fd <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80050d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800510:	8d 70 01             	lea    0x1(%eax),%esi
+  800513:	0f b6 00             	movzbl (%eax),%eax
+  800516:	0f be d0             	movsbl %al,%edx
+  800519:	85 d2                	test   %edx,%edx
+  80051b:	0f 84 da 02 00 00    	je     8007fb <vprintfmt+0x501>
+  800521:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800524:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800527:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80052a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80052d:	eb 1e                	jmp    80054d <vprintfmt+0x253>
+					putch(ch, putdat);
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	ff 75 0c             	push   0xc(%ebp)
+  800535:	52                   	push   %edx
+  800536:	ff 55 08             	call   *0x8(%ebp)
+  800539:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80053c:	83 eb 01             	sub    $0x1,%ebx
+  80053f:	83 c6 01             	add    $0x1,%esi
+  800542:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800546:	0f be d0             	movsbl %al,%edx
+  800549:	85 d2                	test   %edx,%edx
+  80054b:	74 2a                	je     800577 <vprintfmt+0x27d>
+  80054d:	85 ff                	test   %edi,%edi
+  80054f:	78 05                	js     800556 <vprintfmt+0x25c>
+  800551:	83 ef 01             	sub    $0x1,%edi
+  800554:	78 59                	js     8005af <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800556:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80055a:	74 d3                	je     80052f <vprintfmt+0x235>
+  80055c:	0f be c0             	movsbl %al,%eax
+  80055f:	83 e8 20             	sub    $0x20,%eax
+  800562:	83 f8 5e             	cmp    $0x5e,%eax
+  800565:	76 c8                	jbe    80052f <vprintfmt+0x235>
+					putch('?', putdat);
+  800567:	83 ec 08             	sub    $0x8,%esp
+  80056a:	ff 75 0c             	push   0xc(%ebp)
+  80056d:	6a 3f                	push   $0x3f
+  80056f:	ff 55 08             	call   *0x8(%ebp)
+  800572:	83 c4 10             	add    $0x10,%esp
+  800575:	eb c5                	jmp    80053c <vprintfmt+0x242>
+  800577:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80057a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80057d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800580:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800583:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800587:	7e 1b                	jle    8005a4 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800589:	83 ec 08             	sub    $0x8,%esp
+  80058c:	53                   	push   %ebx
+  80058d:	6a 20                	push   $0x20
+  80058f:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	83 ee 01             	sub    $0x1,%esi
+  800597:	75 f0                	jne    800589 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800599:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80059c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059f:	e9 67 fd ff ff       	jmp    80030b <vprintfmt+0x11>
+  8005a4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005aa:	e9 5c fd ff ff       	jmp    80030b <vprintfmt+0x11>
+  8005af:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005b8:	eb c6                	jmp    800580 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8005ba:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005bd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005c0:	83 f9 01             	cmp    $0x1,%ecx
+  8005c3:	7f 1f                	jg     8005e4 <vprintfmt+0x2ea>
+	else if (lflag)
+  8005c5:	85 c9                	test   %ecx,%ecx
+  8005c7:	74 67                	je     800630 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8b 30                	mov    (%eax),%esi
+  8005ce:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005d1:	89 f0                	mov    %esi,%eax
+  8005d3:	c1 f8 1f             	sar    $0x1f,%eax
+  8005d6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e2:	eb 17                	jmp    8005fb <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ea:	8b 00                	mov    (%eax),%eax
+  8005ec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ef:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005fb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800601:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800606:	85 c9                	test   %ecx,%ecx
+  800608:	0f 89 12 01 00 00    	jns    800720 <vprintfmt+0x426>
+				putch('-', putdat);
+  80060e:	83 ec 08             	sub    $0x8,%esp
+  800611:	53                   	push   %ebx
+  800612:	6a 2d                	push   $0x2d
+  800614:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800616:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800619:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80061c:	f7 da                	neg    %edx
+  80061e:	83 d1 00             	adc    $0x0,%ecx
+  800621:	f7 d9                	neg    %ecx
+  800623:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800626:	be 0a 00 00 00       	mov    $0xa,%esi
+  80062b:	e9 f0 00 00 00       	jmp    800720 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8b 30                	mov    (%eax),%esi
+  800635:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800638:	89 f0                	mov    %esi,%eax
+  80063a:	c1 f8 1f             	sar    $0x1f,%eax
+  80063d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8d 40 04             	lea    0x4(%eax),%eax
+  800646:	89 45 14             	mov    %eax,0x14(%ebp)
+  800649:	eb b0                	jmp    8005fb <vprintfmt+0x301>
+	if (lflag >= 2)
+  80064b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80064e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800651:	83 f9 01             	cmp    $0x1,%ecx
+  800654:	7f 1e                	jg     800674 <vprintfmt+0x37a>
+	else if (lflag)
+  800656:	85 c9                	test   %ecx,%ecx
+  800658:	74 32                	je     80068c <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800664:	8d 40 04             	lea    0x4(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80066f:	e9 ac 00 00 00       	jmp    800720 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 10                	mov    (%eax),%edx
+  800679:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067c:	8d 40 08             	lea    0x8(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800682:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800687:	e9 94 00 00 00       	jmp    800720 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8006a1:	eb 7d                	jmp    800720 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8006a3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006a6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ac:	7f 1b                	jg     8006c9 <vprintfmt+0x3cf>
+	else if (lflag)
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	74 2c                	je     8006de <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c2:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8006c7:	eb 57                	jmp    800720 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8b 10                	mov    (%eax),%edx
+  8006ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d7:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8006dc:	eb 42                	jmp    800720 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 10                	mov    (%eax),%edx
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ee:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8006f3:	eb 2b                	jmp    800720 <vprintfmt+0x426>
+			putch('0', putdat);
+  8006f5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f8:	83 ec 08             	sub    $0x8,%esp
+  8006fb:	53                   	push   %ebx
+  8006fc:	6a 30                	push   $0x30
+  8006fe:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800700:	83 c4 08             	add    $0x8,%esp
+  800703:	53                   	push   %ebx
+  800704:	6a 78                	push   $0x78
+  800706:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 10                	mov    (%eax),%edx
+  80070d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800712:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800715:	8d 40 04             	lea    0x4(%eax),%eax
+  800718:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071b:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800720:	83 ec 0c             	sub    $0xc,%esp
+  800723:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800727:	50                   	push   %eax
+  800728:	ff 75 e4             	push   -0x1c(%ebp)
+  80072b:	56                   	push   %esi
+  80072c:	51                   	push   %ecx
+  80072d:	52                   	push   %edx
+  80072e:	89 da                	mov    %ebx,%edx
+  800730:	89 f8                	mov    %edi,%eax
+  800732:	e8 d8 fa ff ff       	call   80020f <printnum>
+			break;
+  800737:	83 c4 20             	add    $0x20,%esp
+  80073a:	e9 cc fb ff ff       	jmp    80030b <vprintfmt+0x11>
+	if (lflag >= 2)
+  80073f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800742:	89 55 10             	mov    %edx,0x10(%ebp)
+  800745:	83 f9 01             	cmp    $0x1,%ecx
+  800748:	7f 1b                	jg     800765 <vprintfmt+0x46b>
+	else if (lflag)
+  80074a:	85 c9                	test   %ecx,%ecx
+  80074c:	74 2c                	je     80077a <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800758:	8d 40 04             	lea    0x4(%eax),%eax
+  80075b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80075e:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800763:	eb bb                	jmp    800720 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	8b 10                	mov    (%eax),%edx
+  80076a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076d:	8d 40 08             	lea    0x8(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800773:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800778:	eb a6                	jmp    800720 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078a:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80078f:	eb 8f                	jmp    800720 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800791:	89 55 10             	mov    %edx,0x10(%ebp)
+  800794:	83 ec 08             	sub    $0x8,%esp
+  800797:	53                   	push   %ebx
+  800798:	6a 25                	push   $0x25
+  80079a:	ff d7                	call   *%edi
+			break;
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	e9 67 fb ff ff       	jmp    80030b <vprintfmt+0x11>
+			putch('%', putdat);
+  8007a4:	83 ec 08             	sub    $0x8,%esp
+  8007a7:	53                   	push   %ebx
+  8007a8:	6a 25                	push   $0x25
+  8007aa:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007b3:	0f 84 ba fb ff ff    	je     800373 <vprintfmt+0x79>
+  8007b9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007bc:	89 f0                	mov    %esi,%eax
+  8007be:	83 e8 01             	sub    $0x1,%eax
+  8007c1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007c5:	75 f7                	jne    8007be <vprintfmt+0x4c4>
+  8007c7:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007ca:	e9 3c fb ff ff       	jmp    80030b <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007cf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007d2:	8d 70 01             	lea    0x1(%eax),%esi
+  8007d5:	0f b6 00             	movzbl (%eax),%eax
+  8007d8:	0f be d0             	movsbl %al,%edx
+  8007db:	85 d2                	test   %edx,%edx
+  8007dd:	74 11                	je     8007f0 <vprintfmt+0x4f6>
+  8007df:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007e2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007e5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007eb:	e9 5d fd ff ff       	jmp    80054d <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007f0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f6:	e9 10 fb ff ff       	jmp    80030b <vprintfmt+0x11>
+  8007fb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800801:	e9 05 fb ff ff       	jmp    80030b <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800806:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80080a:	7e 0a                	jle    800816 <vprintfmt+0x51c>
+  80080c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800810:	0f 85 bd fc ff ff    	jne    8004d3 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800816:	ba 28 00 00 00       	mov    $0x28,%edx
+  80081b:	b8 28 00 00 00       	mov    $0x28,%eax
+  800820:	be 44 3b 80 00       	mov    $0x803b44,%esi
+  800825:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800828:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80082b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80082e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800831:	e9 17 fd ff ff       	jmp    80054d <vprintfmt+0x253>
+}
+  800836:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800839:	5b                   	pop    %ebx
+  80083a:	5e                   	pop    %esi
+  80083b:	5f                   	pop    %edi
+  80083c:	5d                   	pop    %ebp
+  80083d:	c3                   	ret
+
+0080083e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80083e:	55                   	push   %ebp
+  80083f:	89 e5                	mov    %esp,%ebp
+  800841:	83 ec 18             	sub    $0x18,%esp
+  800844:	8b 45 08             	mov    0x8(%ebp),%eax
+  800847:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80084a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80084d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800851:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800854:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80085b:	85 c0                	test   %eax,%eax
+  80085d:	74 26                	je     800885 <vsnprintf+0x47>
+  80085f:	85 d2                	test   %edx,%edx
+  800861:	7e 22                	jle    800885 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800863:	ff 75 14             	push   0x14(%ebp)
+  800866:	ff 75 10             	push   0x10(%ebp)
+  800869:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80086c:	50                   	push   %eax
+  80086d:	68 c0 02 80 00       	push   $0x8002c0
+  800872:	e8 83 fa ff ff       	call   8002fa <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800877:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80087a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80087d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800880:	83 c4 10             	add    $0x10,%esp
+}
+  800883:	c9                   	leave
+  800884:	c3                   	ret
+		return -E_INVAL;
+  800885:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80088a:	eb f7                	jmp    800883 <vsnprintf+0x45>
+
+0080088c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80088c:	55                   	push   %ebp
+  80088d:	89 e5                	mov    %esp,%ebp
+  80088f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800892:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800895:	50                   	push   %eax
+  800896:	ff 75 10             	push   0x10(%ebp)
+  800899:	ff 75 0c             	push   0xc(%ebp)
+  80089c:	ff 75 08             	push   0x8(%ebp)
+  80089f:	e8 9a ff ff ff       	call   80083e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008a4:	c9                   	leave
+  8008a5:	c3                   	ret
+
+008008a6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ac:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008af:	74 10                	je     8008c1 <strlen+0x1b>
+  8008b1:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8008b6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008b9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008bd:	75 f7                	jne    8008b6 <strlen+0x10>
+	return n;
+}
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8008c6:	eb f7                	jmp    8008bf <strlen+0x19>
+
+008008c8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d1:	85 d2                	test   %edx,%edx
+  8008d3:	74 16                	je     8008eb <strnlen+0x23>
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008de:	74 09                	je     8008e9 <strnlen+0x21>
+		n++;
+  8008e0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e3:	39 d0                	cmp    %edx,%eax
+  8008e5:	75 f3                	jne    8008da <strnlen+0x12>
+		n++;
+  8008e7:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8008e9:	5d                   	pop    %ebp
+  8008ea:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f0:	eb f7                	jmp    8008e9 <strnlen+0x21>
+
+008008f2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f2:	55                   	push   %ebp
+  8008f3:	89 e5                	mov    %esp,%ebp
+  8008f5:	53                   	push   %ebx
+  8008f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800901:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800905:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800908:	83 c0 01             	add    $0x1,%eax
+  80090b:	84 d2                	test   %dl,%dl
+  80090d:	75 f2                	jne    800901 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80090f:	89 c8                	mov    %ecx,%eax
+  800911:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800914:	c9                   	leave
+  800915:	c3                   	ret
+
+00800916 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	53                   	push   %ebx
+  80091a:	83 ec 10             	sub    $0x10,%esp
+  80091d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800920:	53                   	push   %ebx
+  800921:	e8 80 ff ff ff       	call   8008a6 <strlen>
+  800926:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800929:	ff 75 0c             	push   0xc(%ebp)
+  80092c:	01 d8                	add    %ebx,%eax
+  80092e:	50                   	push   %eax
+  80092f:	e8 be ff ff ff       	call   8008f2 <strcpy>
+	return dst;
+}
+  800934:	89 d8                	mov    %ebx,%eax
+  800936:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800939:	c9                   	leave
+  80093a:	c3                   	ret
+
+0080093b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	56                   	push   %esi
+  80093f:	53                   	push   %ebx
+  800940:	8b 75 08             	mov    0x8(%ebp),%esi
+  800943:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800946:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800949:	85 db                	test   %ebx,%ebx
+  80094b:	74 17                	je     800964 <strncpy+0x29>
+  80094d:	01 f3                	add    %esi,%ebx
+  80094f:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800951:	83 c0 01             	add    $0x1,%eax
+  800954:	0f b6 0a             	movzbl (%edx),%ecx
+  800957:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095a:	80 f9 01             	cmp    $0x1,%cl
+  80095d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800960:	39 c3                	cmp    %eax,%ebx
+  800962:	75 ed                	jne    800951 <strncpy+0x16>
+	}
+	return ret;
+}
+  800964:	89 f0                	mov    %esi,%eax
+  800966:	5b                   	pop    %ebx
+  800967:	5e                   	pop    %esi
+  800968:	5d                   	pop    %ebp
+  800969:	c3                   	ret
+
+0080096a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	56                   	push   %esi
+  80096e:	53                   	push   %ebx
+  80096f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800972:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800975:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800978:	89 f0                	mov    %esi,%eax
+  80097a:	85 db                	test   %ebx,%ebx
+  80097c:	74 1e                	je     80099c <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  80097e:	83 eb 01             	sub    $0x1,%ebx
+  800981:	74 16                	je     800999 <strlcpy+0x2f>
+  800983:	01 f3                	add    %esi,%ebx
+  800985:	0f b6 0a             	movzbl (%edx),%ecx
+  800988:	84 c9                	test   %cl,%cl
+  80098a:	74 0d                	je     800999 <strlcpy+0x2f>
+			*dst++ = *src++;
+  80098c:	83 c2 01             	add    $0x1,%edx
+  80098f:	83 c0 01             	add    $0x1,%eax
+  800992:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800995:	39 d8                	cmp    %ebx,%eax
+  800997:	75 ec                	jne    800985 <strlcpy+0x1b>
+		*dst = '\0';
+  800999:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80099c:	29 f0                	sub    %esi,%eax
+}
+  80099e:	5b                   	pop    %ebx
+  80099f:	5e                   	pop    %esi
+  8009a0:	5d                   	pop    %ebp
+  8009a1:	c3                   	ret
+
+008009a2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ab:	0f b6 01             	movzbl (%ecx),%eax
+  8009ae:	84 c0                	test   %al,%al
+  8009b0:	74 11                	je     8009c3 <strcmp+0x21>
+  8009b2:	38 02                	cmp    %al,(%edx)
+  8009b4:	75 0d                	jne    8009c3 <strcmp+0x21>
+		p++, q++;
+  8009b6:	83 c1 01             	add    $0x1,%ecx
+  8009b9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009bc:	0f b6 01             	movzbl (%ecx),%eax
+  8009bf:	84 c0                	test   %al,%al
+  8009c1:	75 ef                	jne    8009b2 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c3:	0f b6 c0             	movzbl %al,%eax
+  8009c6:	0f b6 12             	movzbl (%edx),%edx
+  8009c9:	29 d0                	sub    %edx,%eax
+}
+  8009cb:	5d                   	pop    %ebp
+  8009cc:	c3                   	ret
+
+008009cd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009cd:	55                   	push   %ebp
+  8009ce:	89 e5                	mov    %esp,%ebp
+  8009d0:	53                   	push   %ebx
+  8009d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009d7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8009da:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8009df:	85 d2                	test   %edx,%edx
+  8009e1:	74 2e                	je     800a11 <strncmp+0x44>
+  8009e3:	0f b6 01             	movzbl (%ecx),%eax
+  8009e6:	84 c0                	test   %al,%al
+  8009e8:	74 16                	je     800a00 <strncmp+0x33>
+  8009ea:	3a 03                	cmp    (%ebx),%al
+  8009ec:	75 12                	jne    800a00 <strncmp+0x33>
+		n--, p++, q++;
+  8009ee:	83 c1 01             	add    $0x1,%ecx
+  8009f1:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8009f4:	83 ea 01             	sub    $0x1,%edx
+  8009f7:	75 ea                	jne    8009e3 <strncmp+0x16>
+		return 0;
+  8009f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fe:	eb 11                	jmp    800a11 <strncmp+0x44>
+  800a00:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a05:	85 d2                	test   %edx,%edx
+  800a07:	74 08                	je     800a11 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a09:	0f b6 01             	movzbl (%ecx),%eax
+  800a0c:	0f b6 13             	movzbl (%ebx),%edx
+  800a0f:	29 d0                	sub    %edx,%eax
+}
+  800a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+
+00800a16 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a20:	0f b6 10             	movzbl (%eax),%edx
+  800a23:	84 d2                	test   %dl,%dl
+  800a25:	74 15                	je     800a3c <strchr+0x26>
+		if (*s == c)
+  800a27:	38 d1                	cmp    %dl,%cl
+  800a29:	74 0f                	je     800a3a <strchr+0x24>
+	for (; *s; s++)
+  800a2b:	83 c0 01             	add    $0x1,%eax
+  800a2e:	0f b6 10             	movzbl (%eax),%edx
+  800a31:	84 d2                	test   %dl,%dl
+  800a33:	75 f2                	jne    800a27 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3a:	5d                   	pop    %ebp
+  800a3b:	c3                   	ret
+	return 0;
+  800a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a41:	eb f7                	jmp    800a3a <strchr+0x24>
+
+00800a43 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	53                   	push   %ebx
+  800a47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a4d:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a50:	38 d3                	cmp    %dl,%bl
+  800a52:	74 14                	je     800a68 <strfind+0x25>
+  800a54:	89 d1                	mov    %edx,%ecx
+  800a56:	84 db                	test   %bl,%bl
+  800a58:	74 0e                	je     800a68 <strfind+0x25>
+	for (; *s; s++)
+  800a5a:	83 c0 01             	add    $0x1,%eax
+  800a5d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a60:	38 ca                	cmp    %cl,%dl
+  800a62:	74 04                	je     800a68 <strfind+0x25>
+  800a64:	84 d2                	test   %dl,%dl
+  800a66:	75 f2                	jne    800a5a <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800a68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6b:	c9                   	leave
+  800a6c:	c3                   	ret
+
+00800a6d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	57                   	push   %edi
+  800a71:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a74:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a77:	85 c9                	test   %ecx,%ecx
+  800a79:	74 20                	je     800a9b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a7b:	89 f8                	mov    %edi,%eax
+  800a7d:	09 c8                	or     %ecx,%eax
+  800a7f:	a8 03                	test   $0x3,%al
+  800a81:	75 12                	jne    800a95 <memset+0x28>
+		c &= 0xFF;
+  800a83:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a87:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a8d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a90:	fc                   	cld
+  800a91:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a93:	eb 06                	jmp    800a9b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a98:	fc                   	cld
+  800a99:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a9b:	89 f8                	mov    %edi,%eax
+  800a9d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aa0:	c9                   	leave
+  800aa1:	c3                   	ret
+
+00800aa2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	57                   	push   %edi
+  800aa6:	56                   	push   %esi
+  800aa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ab0:	39 c6                	cmp    %eax,%esi
+  800ab2:	73 32                	jae    800ae6 <memmove+0x44>
+  800ab4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ab7:	39 d0                	cmp    %edx,%eax
+  800ab9:	73 2b                	jae    800ae6 <memmove+0x44>
+		s += n;
+		d += n;
+  800abb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800abe:	89 d6                	mov    %edx,%esi
+  800ac0:	09 fe                	or     %edi,%esi
+  800ac2:	09 ce                	or     %ecx,%esi
+  800ac4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aca:	75 0e                	jne    800ada <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800acc:	83 ef 04             	sub    $0x4,%edi
+  800acf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ad2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ad5:	fd                   	std
+  800ad6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad8:	eb 09                	jmp    800ae3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ada:	83 ef 01             	sub    $0x1,%edi
+  800add:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ae0:	fd                   	std
+  800ae1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ae3:	fc                   	cld
+  800ae4:	eb 1a                	jmp    800b00 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ae6:	89 f2                	mov    %esi,%edx
+  800ae8:	09 c2                	or     %eax,%edx
+  800aea:	09 ca                	or     %ecx,%edx
+  800aec:	f6 c2 03             	test   $0x3,%dl
+  800aef:	75 0a                	jne    800afb <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800af1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800af4:	89 c7                	mov    %eax,%edi
+  800af6:	fc                   	cld
+  800af7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af9:	eb 05                	jmp    800b00 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800afb:	89 c7                	mov    %eax,%edi
+  800afd:	fc                   	cld
+  800afe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b00:	5e                   	pop    %esi
+  800b01:	5f                   	pop    %edi
+  800b02:	5d                   	pop    %ebp
+  800b03:	c3                   	ret
+
+00800b04 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b04:	55                   	push   %ebp
+  800b05:	89 e5                	mov    %esp,%ebp
+  800b07:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b0a:	ff 75 10             	push   0x10(%ebp)
+  800b0d:	ff 75 0c             	push   0xc(%ebp)
+  800b10:	ff 75 08             	push   0x8(%ebp)
+  800b13:	e8 8a ff ff ff       	call   800aa2 <memmove>
+}
+  800b18:	c9                   	leave
+  800b19:	c3                   	ret
+
+00800b1a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	56                   	push   %esi
+  800b1e:	53                   	push   %ebx
+  800b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b25:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b28:	85 f6                	test   %esi,%esi
+  800b2a:	74 29                	je     800b55 <memcmp+0x3b>
+  800b2c:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b2e:	0f b6 08             	movzbl (%eax),%ecx
+  800b31:	0f b6 1a             	movzbl (%edx),%ebx
+  800b34:	38 d9                	cmp    %bl,%cl
+  800b36:	75 11                	jne    800b49 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b38:	83 c0 01             	add    $0x1,%eax
+  800b3b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b3e:	39 c6                	cmp    %eax,%esi
+  800b40:	75 ec                	jne    800b2e <memcmp+0x14>
+	}
+
+	return 0;
+  800b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b47:	eb 08                	jmp    800b51 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b49:	0f b6 c1             	movzbl %cl,%eax
+  800b4c:	0f b6 db             	movzbl %bl,%ebx
+  800b4f:	29 d8                	sub    %ebx,%eax
+}
+  800b51:	5b                   	pop    %ebx
+  800b52:	5e                   	pop    %esi
+  800b53:	5d                   	pop    %ebp
+  800b54:	c3                   	ret
+	return 0;
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5a:	eb f5                	jmp    800b51 <memcmp+0x37>
+
+00800b5c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b65:	89 c2                	mov    %eax,%edx
+  800b67:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b6a:	39 d0                	cmp    %edx,%eax
+  800b6c:	73 0d                	jae    800b7b <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b6e:	38 08                	cmp    %cl,(%eax)
+  800b70:	74 0d                	je     800b7f <memfind+0x23>
+	for (; s < ends; s++)
+  800b72:	83 c0 01             	add    $0x1,%eax
+  800b75:	39 c2                	cmp    %eax,%edx
+  800b77:	75 f5                	jne    800b6e <memfind+0x12>
+  800b79:	eb 06                	jmp    800b81 <memfind+0x25>
+  800b7b:	89 c2                	mov    %eax,%edx
+  800b7d:	eb 02                	jmp    800b81 <memfind+0x25>
+  800b7f:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800b81:	89 d0                	mov    %edx,%eax
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+
+00800b85 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	57                   	push   %edi
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  800b8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b91:	0f b6 02             	movzbl (%edx),%eax
+  800b94:	3c 20                	cmp    $0x20,%al
+  800b96:	74 04                	je     800b9c <strtol+0x17>
+  800b98:	3c 09                	cmp    $0x9,%al
+  800b9a:	75 0e                	jne    800baa <strtol+0x25>
+		s++;
+  800b9c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b9f:	0f b6 02             	movzbl (%edx),%eax
+  800ba2:	3c 20                	cmp    $0x20,%al
+  800ba4:	74 f6                	je     800b9c <strtol+0x17>
+  800ba6:	3c 09                	cmp    $0x9,%al
+  800ba8:	74 f2                	je     800b9c <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800baa:	3c 2b                	cmp    $0x2b,%al
+  800bac:	74 2a                	je     800bd8 <strtol+0x53>
+	int neg = 0;
+  800bae:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bb3:	3c 2d                	cmp    $0x2d,%al
+  800bb5:	74 2b                	je     800be2 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bbd:	75 0f                	jne    800bce <strtol+0x49>
+  800bbf:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bc2:	74 28                	je     800bec <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bc4:	85 db                	test   %ebx,%ebx
+  800bc6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bcb:	0f 44 d8             	cmove  %eax,%ebx
+  800bce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bd6:	eb 46                	jmp    800c1e <strtol+0x99>
+		s++;
+  800bd8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be0:	eb d5                	jmp    800bb7 <strtol+0x32>
+		s++, neg = 1;
+  800be2:	83 c2 01             	add    $0x1,%edx
+  800be5:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bea:	eb cb                	jmp    800bb7 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bec:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bf0:	74 0e                	je     800c00 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800bf2:	85 db                	test   %ebx,%ebx
+  800bf4:	75 d8                	jne    800bce <strtol+0x49>
+		s++, base = 8;
+  800bf6:	83 c2 01             	add    $0x1,%edx
+  800bf9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bfe:	eb ce                	jmp    800bce <strtol+0x49>
+		s += 2, base = 16;
+  800c00:	83 c2 02             	add    $0x2,%edx
+  800c03:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c08:	eb c4                	jmp    800bce <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c0a:	0f be c0             	movsbl %al,%eax
+  800c0d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c10:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c13:	7d 3a                	jge    800c4f <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c15:	83 c2 01             	add    $0x1,%edx
+  800c18:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c1c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c1e:	0f b6 02             	movzbl (%edx),%eax
+  800c21:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c24:	89 f3                	mov    %esi,%ebx
+  800c26:	80 fb 09             	cmp    $0x9,%bl
+  800c29:	76 df                	jbe    800c0a <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c2b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c2e:	89 f3                	mov    %esi,%ebx
+  800c30:	80 fb 19             	cmp    $0x19,%bl
+  800c33:	77 08                	ja     800c3d <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c35:	0f be c0             	movsbl %al,%eax
+  800c38:	83 e8 57             	sub    $0x57,%eax
+  800c3b:	eb d3                	jmp    800c10 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c3d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c40:	89 f3                	mov    %esi,%ebx
+  800c42:	80 fb 19             	cmp    $0x19,%bl
+  800c45:	77 08                	ja     800c4f <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c47:	0f be c0             	movsbl %al,%eax
+  800c4a:	83 e8 37             	sub    $0x37,%eax
+  800c4d:	eb c1                	jmp    800c10 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c4f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c53:	74 05                	je     800c5a <strtol+0xd5>
+		*endptr = (char *) s;
+  800c55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c58:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c5a:	89 c8                	mov    %ecx,%eax
+  800c5c:	f7 d8                	neg    %eax
+  800c5e:	85 ff                	test   %edi,%edi
+  800c60:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c63:	89 c8                	mov    %ecx,%eax
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+
+00800c6a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	56                   	push   %esi
+  800c6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7b:	89 c3                	mov    %eax,%ebx
+  800c7d:	89 c7                	mov    %eax,%edi
+  800c7f:	89 c6                	mov    %eax,%esi
+  800c81:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c83:	5b                   	pop    %ebx
+  800c84:	5e                   	pop    %esi
+  800c85:	5f                   	pop    %edi
+  800c86:	5d                   	pop    %ebp
+  800c87:	c3                   	ret
+
+00800c88 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c93:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c98:	89 d1                	mov    %edx,%ecx
+  800c9a:	89 d3                	mov    %edx,%ebx
+  800c9c:	89 d7                	mov    %edx,%edi
+  800c9e:	89 d6                	mov    %edx,%esi
+  800ca0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ca2:	5b                   	pop    %ebx
+  800ca3:	5e                   	pop    %esi
+  800ca4:	5f                   	pop    %edi
+  800ca5:	5d                   	pop    %ebp
+  800ca6:	c3                   	ret
+
+00800ca7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	57                   	push   %edi
+  800cab:	56                   	push   %esi
+  800cac:	53                   	push   %ebx
+  800cad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cbd:	89 cb                	mov    %ecx,%ebx
+  800cbf:	89 cf                	mov    %ecx,%edi
+  800cc1:	89 ce                	mov    %ecx,%esi
+  800cc3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc5:	85 c0                	test   %eax,%eax
+  800cc7:	7f 08                	jg     800cd1 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5f                   	pop    %edi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  800cd4:	50                   	push   %eax
+  800cd5:	6a 03                	push   $0x3
+  800cd7:	68 6b 3e 80 00       	push   $0x803e6b
+  800cdc:	6a 23                	push   $0x23
+  800cde:	68 88 3e 80 00       	push   $0x803e88
+  800ce3:	e8 b1 2b 00 00       	call   803899 <_panic>
+
+00800ce8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ce8:	55                   	push   %ebp
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	57                   	push   %edi
+  800cec:	56                   	push   %esi
+  800ced:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cf8:	89 d1                	mov    %edx,%ecx
+  800cfa:	89 d3                	mov    %edx,%ebx
+  800cfc:	89 d7                	mov    %edx,%edi
+  800cfe:	89 d6                	mov    %edx,%esi
+  800d00:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d02:	5b                   	pop    %ebx
+  800d03:	5e                   	pop    %esi
+  800d04:	5f                   	pop    %edi
+  800d05:	5d                   	pop    %ebp
+  800d06:	c3                   	ret
+
+00800d07 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	57                   	push   %edi
+  800d0b:	56                   	push   %esi
+  800d0c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d12:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d17:	89 d1                	mov    %edx,%ecx
+  800d19:	89 d3                	mov    %edx,%ebx
+  800d1b:	89 d7                	mov    %edx,%edi
+  800d1d:	89 d6                	mov    %edx,%esi
+  800d1f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d21:	5b                   	pop    %ebx
+  800d22:	5e                   	pop    %esi
+  800d23:	5f                   	pop    %edi
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+
+00800d26 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d42:	89 f7                	mov    %esi,%edi
+  800d44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d46:	85 c0                	test   %eax,%eax
+  800d48:	7f 08                	jg     800d52 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+  800d55:	50                   	push   %eax
+  800d56:	6a 04                	push   $0x4
+  800d58:	68 6b 3e 80 00       	push   $0x803e6b
+  800d5d:	6a 23                	push   $0x23
+  800d5f:	68 88 3e 80 00       	push   $0x803e88
+  800d64:	e8 30 2b 00 00       	call   803899 <_panic>
+
+00800d69 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d78:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d80:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d83:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d88:	85 c0                	test   %eax,%eax
+  800d8a:	7f 08                	jg     800d94 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d94:	83 ec 0c             	sub    $0xc,%esp
+  800d97:	50                   	push   %eax
+  800d98:	6a 05                	push   $0x5
+  800d9a:	68 6b 3e 80 00       	push   $0x803e6b
+  800d9f:	6a 23                	push   $0x23
+  800da1:	68 88 3e 80 00       	push   $0x803e88
+  800da6:	e8 ee 2a 00 00       	call   803899 <_panic>
+
+00800dab <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dc4:	89 df                	mov    %ebx,%edi
+  800dc6:	89 de                	mov    %ebx,%esi
+  800dc8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	7f 08                	jg     800dd6 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+  800dd9:	50                   	push   %eax
+  800dda:	6a 06                	push   $0x6
+  800ddc:	68 6b 3e 80 00       	push   $0x803e6b
+  800de1:	6a 23                	push   $0x23
+  800de3:	68 88 3e 80 00       	push   $0x803e88
+  800de8:	e8 ac 2a 00 00       	call   803899 <_panic>
+
+00800ded <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	57                   	push   %edi
+  800df1:	56                   	push   %esi
+  800df2:	53                   	push   %ebx
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e01:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e06:	89 df                	mov    %ebx,%edi
+  800e08:	89 de                	mov    %ebx,%esi
+  800e0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0c:	85 c0                	test   %eax,%eax
+  800e0e:	7f 08                	jg     800e18 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e18:	83 ec 0c             	sub    $0xc,%esp
+  800e1b:	50                   	push   %eax
+  800e1c:	6a 08                	push   $0x8
+  800e1e:	68 6b 3e 80 00       	push   $0x803e6b
+  800e23:	6a 23                	push   $0x23
+  800e25:	68 88 3e 80 00       	push   $0x803e88
+  800e2a:	e8 6a 2a 00 00       	call   803899 <_panic>
+
+00800e2f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+  800e35:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e48:	89 df                	mov    %ebx,%edi
+  800e4a:	89 de                	mov    %ebx,%esi
+  800e4c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4e:	85 c0                	test   %eax,%eax
+  800e50:	7f 08                	jg     800e5a <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5f                   	pop    %edi
+  800e58:	5d                   	pop    %ebp
+  800e59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	50                   	push   %eax
+  800e5e:	6a 09                	push   $0x9
+  800e60:	68 6b 3e 80 00       	push   $0x803e6b
+  800e65:	6a 23                	push   $0x23
+  800e67:	68 88 3e 80 00       	push   $0x803e88
+  800e6c:	e8 28 2a 00 00       	call   803899 <_panic>
+
+00800e71 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e85:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e8a:	89 df                	mov    %ebx,%edi
+  800e8c:	89 de                	mov    %ebx,%esi
+  800e8e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	7f 08                	jg     800e9c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+  800e9f:	50                   	push   %eax
+  800ea0:	6a 0a                	push   $0xa
+  800ea2:	68 6b 3e 80 00       	push   $0x803e6b
+  800ea7:	6a 23                	push   $0x23
+  800ea9:	68 88 3e 80 00       	push   $0x803e88
+  800eae:	e8 e6 29 00 00       	call   803899 <_panic>
+
+00800eb3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ec4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ecf:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+
+00800ed6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800edf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eec:	89 cb                	mov    %ecx,%ebx
+  800eee:	89 cf                	mov    %ecx,%edi
+  800ef0:	89 ce                	mov    %ecx,%esi
+  800ef2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	7f 08                	jg     800f00 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ef8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efb:	5b                   	pop    %ebx
+  800efc:	5e                   	pop    %esi
+  800efd:	5f                   	pop    %edi
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	50                   	push   %eax
+  800f04:	6a 0d                	push   $0xd
+  800f06:	68 6b 3e 80 00       	push   $0x803e6b
+  800f0b:	6a 23                	push   $0x23
+  800f0d:	68 88 3e 80 00       	push   $0x803e88
+  800f12:	e8 82 29 00 00       	call   803899 <_panic>
+
+00800f17 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	57                   	push   %edi
+  800f1b:	56                   	push   %esi
+  800f1c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f31:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f33:	5b                   	pop    %ebx
+  800f34:	5e                   	pop    %esi
+  800f35:	5f                   	pop    %edi
+  800f36:	5d                   	pop    %ebp
+  800f37:	c3                   	ret
+
+00800f38 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f51:	89 df                	mov    %ebx,%edi
+  800f53:	89 de                	mov    %ebx,%esi
+  800f55:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f57:	85 c0                	test   %eax,%eax
+  800f59:	7f 08                	jg     800f63 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f63:	83 ec 0c             	sub    $0xc,%esp
+  800f66:	50                   	push   %eax
+  800f67:	6a 0d                	push   $0xd
+  800f69:	68 6b 3e 80 00       	push   $0x803e6b
+  800f6e:	6a 23                	push   $0x23
+  800f70:	68 88 3e 80 00       	push   $0x803e88
+  800f75:	e8 1f 29 00 00       	call   803899 <_panic>
+
+00800f7a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f85:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f8a:	89 d1                	mov    %edx,%ecx
+  800f8c:	89 d3                	mov    %edx,%ebx
+  800f8e:	89 d7                	mov    %edx,%edi
+  800f90:	89 d6                	mov    %edx,%esi
+  800f92:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f94:	5b                   	pop    %ebx
+  800f95:	5e                   	pop    %esi
+  800f96:	5f                   	pop    %edi
+  800f97:	5d                   	pop    %ebp
+  800f98:	c3                   	ret
+
+00800f99 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	57                   	push   %edi
+  800f9d:	56                   	push   %esi
+  800f9e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800faf:	89 df                	mov    %ebx,%edi
+  800fb1:	89 de                	mov    %ebx,%esi
+  800fb3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+
+00800fba <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fcd:	89 cb                	mov    %ecx,%ebx
+  800fcf:	89 cf                	mov    %ecx,%edi
+  800fd1:	89 ce                	mov    %ecx,%esi
+  800fd3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800fd5:	5b                   	pop    %ebx
+  800fd6:	5e                   	pop    %esi
+  800fd7:	5f                   	pop    %edi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+
+00800fda <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	57                   	push   %edi
+  800fde:	56                   	push   %esi
+  800fdf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800feb:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ff0:	89 df                	mov    %ebx,%edi
+  800ff2:	89 de                	mov    %ebx,%esi
+  800ff4:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800ff6:	5b                   	pop    %ebx
+  800ff7:	5e                   	pop    %esi
+  800ff8:	5f                   	pop    %edi
+  800ff9:	5d                   	pop    %ebp
+  800ffa:	c3                   	ret
+
+00800ffb <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	57                   	push   %edi
+  800fff:	56                   	push   %esi
+  801000:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801011:	89 df                	mov    %ebx,%edi
+  801013:	89 de                	mov    %ebx,%esi
+  801015:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+
+0080101c <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801022:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80102f:	89 cb                	mov    %ecx,%ebx
+  801031:	89 cf                	mov    %ecx,%edi
+  801033:	89 ce                	mov    %ecx,%esi
+  801035:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	57                   	push   %edi
+  801040:	56                   	push   %esi
+  801041:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801042:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801052:	89 df                	mov    %ebx,%edi
+  801054:	89 de                	mov    %ebx,%esi
+  801056:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801058:	5b                   	pop    %ebx
+  801059:	5e                   	pop    %esi
+  80105a:	5f                   	pop    %edi
+  80105b:	5d                   	pop    %ebp
+  80105c:	c3                   	ret
+
+0080105d <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801063:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801070:	89 cb                	mov    %ecx,%ebx
+  801072:	89 cf                	mov    %ecx,%edi
+  801074:	89 ce                	mov    %ecx,%esi
+  801076:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+
+0080107d <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801083:	be 00 00 00 00       	mov    $0x0,%esi
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801093:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801096:	89 f7                	mov    %esi,%edi
+  801098:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80109a:	5b                   	pop    %ebx
+  80109b:	5e                   	pop    %esi
+  80109c:	5f                   	pop    %edi
+  80109d:	5d                   	pop    %ebp
+  80109e:	c3                   	ret
+
+0080109f <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  8010a2:	57                   	push   %edi
+  8010a3:	56                   	push   %esi
+  8010a4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010b5:	89 df                	mov    %ebx,%edi
+  8010b7:	89 de                	mov    %ebx,%esi
+  8010b9:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8010bb:	5b                   	pop    %ebx
+  8010bc:	5e                   	pop    %esi
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+
+008010c0 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ce:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d3:	89 cb                	mov    %ecx,%ebx
+  8010d5:	89 cf                	mov    %ecx,%edi
+  8010d7:	89 ce                	mov    %ecx,%esi
+  8010d9:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+
+008010e0 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	57                   	push   %edi
+  8010e4:	56                   	push   %esi
+  8010e5:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8010e6:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8010ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010f7:	89 df                	mov    %ebx,%edi
+  8010f9:	89 de                	mov    %ebx,%esi
+  8010fb:	cd 30                	int    $0x30
+}
+  8010fd:	5b                   	pop    %ebx
+  8010fe:	5e                   	pop    %esi
+  8010ff:	5f                   	pop    %edi
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+
+00801102 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801108:	be 00 00 00 00       	mov    $0x0,%esi
+  80110d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801110:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801113:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801118:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111b:	89 f7                	mov    %esi,%edi
+  80111d:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80111f:	5b                   	pop    %ebx
+  801120:	5e                   	pop    %esi
+  801121:	5f                   	pop    %edi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+
+00801124 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112a:	be 00 00 00 00       	mov    $0x0,%esi
+  80112f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801132:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801135:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80113a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113d:	89 f7                	mov    %esi,%edi
+  80113f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	57                   	push   %edi
+  80114a:	56                   	push   %esi
+  80114b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801151:	8b 55 08             	mov    0x8(%ebp),%edx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80115c:	89 df                	mov    %ebx,%edi
+  80115e:	89 de                	mov    %ebx,%esi
+  801160:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+
+00801167 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116d:	be 00 00 00 00       	mov    $0x0,%esi
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80117d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801180:	89 f7                	mov    %esi,%edi
+  801182:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+  80118e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801191:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801194:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801197:	85 c0                	test   %eax,%eax
+  801199:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80119e:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+  8011a4:	50                   	push   %eax
+  8011a5:	e8 2c fd ff ff       	call   800ed6 <sys_ipc_recv>
+  8011aa:	83 c4 10             	add    $0x10,%esp
+  8011ad:	85 c0                	test   %eax,%eax
+  8011af:	0f 88 8b 00 00 00    	js     801240 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8011b5:	85 f6                	test   %esi,%esi
+  8011b7:	74 2a                	je     8011e3 <ipc_recv+0x5a>
+  8011b9:	89 e2                	mov    %esp,%edx
+  8011bb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8011c0:	29 d0                	sub    %edx,%eax
+  8011c2:	89 c2                	mov    %eax,%edx
+  8011c4:	c1 ea 0f             	shr    $0xf,%edx
+  8011c7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8011cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d1:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8011d4:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8011db:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8011e1:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8011e3:	85 db                	test   %ebx,%ebx
+  8011e5:	74 2a                	je     801211 <ipc_recv+0x88>
+  8011e7:	89 e2                	mov    %esp,%edx
+  8011e9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8011ee:	29 d0                	sub    %edx,%eax
+  8011f0:	89 c2                	mov    %eax,%edx
+  8011f2:	c1 ea 0f             	shr    $0xf,%edx
+  8011f5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8011fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ff:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801202:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801209:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80120f:	89 03                	mov    %eax,(%ebx)
+  801211:	89 e2                	mov    %esp,%edx
+  801213:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801218:	29 d0                	sub    %edx,%eax
+  80121a:	89 c2                	mov    %eax,%edx
+  80121c:	c1 ea 0f             	shr    $0xf,%edx
+  80121f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801224:	b8 00 00 00 00       	mov    $0x0,%eax
+  801229:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80122c:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801233:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801239:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5d                   	pop    %ebp
+  80123f:	c3                   	ret
+		if(from_env_store != NULL)
+  801240:	85 f6                	test   %esi,%esi
+  801242:	74 06                	je     80124a <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801244:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80124a:	85 db                	test   %ebx,%ebx
+  80124c:	74 eb                	je     801239 <ipc_recv+0xb0>
+			*perm_store = 0;
+  80124e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801254:	eb e3                	jmp    801239 <ipc_recv+0xb0>
+
+00801256 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+  80125c:	83 ec 14             	sub    $0x14,%esp
+  80125f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801262:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801265:	8b 75 14             	mov    0x14(%ebp),%esi
+  801268:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  80126b:	85 c0                	test   %eax,%eax
+  80126d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801272:	0f 44 c2             	cmove  %edx,%eax
+  801275:	ff 75 10             	push   0x10(%ebp)
+  801278:	50                   	push   %eax
+  801279:	e8 ba fc ff ff       	call   800f38 <sys_ipc_recv_pages>
+  80127e:	83 c4 10             	add    $0x10,%esp
+  801281:	85 c0                	test   %eax,%eax
+  801283:	0f 88 ba 00 00 00    	js     801343 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801289:	85 ff                	test   %edi,%edi
+  80128b:	74 2a                	je     8012b7 <ipc_recv_pages+0x61>
+  80128d:	89 e2                	mov    %esp,%edx
+  80128f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801294:	29 d0                	sub    %edx,%eax
+  801296:	89 c2                	mov    %eax,%edx
+  801298:	c1 ea 0f             	shr    $0xf,%edx
+  80129b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8012a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a5:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8012a8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8012af:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8012b5:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8012b7:	85 f6                	test   %esi,%esi
+  8012b9:	74 2a                	je     8012e5 <ipc_recv_pages+0x8f>
+  8012bb:	89 e2                	mov    %esp,%edx
+  8012bd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8012c2:	29 d0                	sub    %edx,%eax
+  8012c4:	89 c2                	mov    %eax,%edx
+  8012c6:	c1 ea 0f             	shr    $0xf,%edx
+  8012c9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8012ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d3:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8012d6:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8012dd:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8012e3:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8012e5:	85 db                	test   %ebx,%ebx
+  8012e7:	74 2a                	je     801313 <ipc_recv_pages+0xbd>
+  8012e9:	89 e2                	mov    %esp,%edx
+  8012eb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8012f0:	29 d0                	sub    %edx,%eax
+  8012f2:	89 c2                	mov    %eax,%edx
+  8012f4:	c1 ea 0f             	shr    $0xf,%edx
+  8012f7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8012fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801301:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801304:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80130b:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801311:	89 03                	mov    %eax,(%ebx)
+  801313:	89 e2                	mov    %esp,%edx
+  801315:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80131a:	29 d0                	sub    %edx,%eax
+  80131c:	89 c2                	mov    %eax,%edx
+  80131e:	c1 ea 0f             	shr    $0xf,%edx
+  801321:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132b:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80132e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801335:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80133b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133e:	5b                   	pop    %ebx
+  80133f:	5e                   	pop    %esi
+  801340:	5f                   	pop    %edi
+  801341:	5d                   	pop    %ebp
+  801342:	c3                   	ret
+		if (from_env_store)
+  801343:	85 ff                	test   %edi,%edi
+  801345:	74 06                	je     80134d <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801347:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  80134d:	85 f6                	test   %esi,%esi
+  80134f:	74 06                	je     801357 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801351:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801357:	85 db                	test   %ebx,%ebx
+  801359:	74 e0                	je     80133b <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  80135b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801361:	eb d8                	jmp    80133b <ipc_recv_pages+0xe5>
+
+00801363 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	57                   	push   %edi
+  801367:	56                   	push   %esi
+  801368:	53                   	push   %ebx
+  801369:	83 ec 1c             	sub    $0x1c,%esp
+  80136c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80136f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801372:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801378:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80137c:	75 2b                	jne    8013a9 <ipc_try_send_pages+0x46>
+  80137e:	89 e2                	mov    %esp,%edx
+  801380:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801385:	29 d0                	sub    %edx,%eax
+  801387:	89 c2                	mov    %eax,%edx
+  801389:	c1 ea 0f             	shr    $0xf,%edx
+  80138c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801391:	b8 00 00 00 00       	mov    $0x0,%eax
+  801396:	0f 42 c2             	cmovb  %edx,%eax
+  801399:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8013a0:	8b 70 48             	mov    0x48(%eax),%esi
+  8013a3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8013a9:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8013af:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8013b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8013b7:	85 ff                	test   %edi,%edi
+  8013b9:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8013be:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8013c1:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8013c7:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8013cd:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	ff 75 14             	push   0x14(%ebp)
+  8013d9:	ff 75 18             	push   0x18(%ebp)
+  8013dc:	57                   	push   %edi
+  8013dd:	ff 75 0c             	push   0xc(%ebp)
+  8013e0:	ff 75 08             	push   0x8(%ebp)
+  8013e3:	e8 2f fb ff ff       	call   800f17 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8013e8:	83 c4 20             	add    $0x20,%esp
+  8013eb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8013ee:	75 21                	jne    801411 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8013f0:	83 ec 04             	sub    $0x4,%esp
+  8013f3:	6a ff                	push   $0xffffffff
+  8013f5:	53                   	push   %ebx
+  8013f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8013f9:	e8 26 fd ff ff       	call   801124 <sys_futex_wait>
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801404:	74 c7                	je     8013cd <ipc_try_send_pages+0x6a>
+  801406:	85 c0                	test   %eax,%eax
+  801408:	79 c3                	jns    8013cd <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80140a:	e8 f8 f8 ff ff       	call   800d07 <sys_yield>
+  80140f:	eb bc                	jmp    8013cd <ipc_try_send_pages+0x6a>
+	}
+}
+  801411:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801414:	5b                   	pop    %ebx
+  801415:	5e                   	pop    %esi
+  801416:	5f                   	pop    %edi
+  801417:	5d                   	pop    %ebp
+  801418:	c3                   	ret
+
+00801419 <ipc_send>:
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80141f:	ff 75 14             	push   0x14(%ebp)
+  801422:	6a 01                	push   $0x1
+  801424:	ff 75 10             	push   0x10(%ebp)
+  801427:	ff 75 0c             	push   0xc(%ebp)
+  80142a:	ff 75 08             	push   0x8(%ebp)
+  80142d:	e8 31 ff ff ff       	call   801363 <ipc_try_send_pages>
+  801432:	83 c4 20             	add    $0x20,%esp
+  801435:	85 c0                	test   %eax,%eax
+  801437:	78 02                	js     80143b <ipc_send+0x22>
+}
+  801439:	c9                   	leave
+  80143a:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80143b:	50                   	push   %eax
+  80143c:	68 96 3e 80 00       	push   $0x803e96
+  801441:	6a 3f                	push   $0x3f
+  801443:	68 ab 3e 80 00       	push   $0x803eab
+  801448:	e8 4c 24 00 00       	call   803899 <_panic>
+
+0080144d <ipc_send_pages>:
+{
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801453:	ff 75 18             	push   0x18(%ebp)
+  801456:	ff 75 14             	push   0x14(%ebp)
+  801459:	ff 75 10             	push   0x10(%ebp)
+  80145c:	ff 75 0c             	push   0xc(%ebp)
+  80145f:	ff 75 08             	push   0x8(%ebp)
+  801462:	e8 fc fe ff ff       	call   801363 <ipc_try_send_pages>
+  801467:	83 c4 20             	add    $0x20,%esp
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	78 02                	js     801470 <ipc_send_pages+0x23>
+}
+  80146e:	c9                   	leave
+  80146f:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801470:	50                   	push   %eax
+  801471:	68 b5 3e 80 00       	push   $0x803eb5
+  801476:	6a 64                	push   $0x64
+  801478:	68 ab 3e 80 00       	push   $0x803eab
+  80147d:	e8 17 24 00 00       	call   803899 <_panic>
+
+00801482 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801488:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80148d:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801493:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801499:	8b 52 50             	mov    0x50(%edx),%edx
+  80149c:	39 ca                	cmp    %ecx,%edx
+  80149e:	74 11                	je     8014b1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8014a0:	83 c0 01             	add    $0x1,%eax
+  8014a3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8014a8:	75 e3                	jne    80148d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8014aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014af:	eb 0e                	jmp    8014bf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8014b1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8014b7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014bc:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+
+008014c1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014cc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014cf:	5d                   	pop    %ebp
+  8014d0:	c3                   	ret
+
+008014d1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014d1:	55                   	push   %ebp
+  8014d2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014dc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014e1:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8014e6:	5d                   	pop    %ebp
+  8014e7:	c3                   	ret
+
+008014e8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014e8:	55                   	push   %ebp
+  8014e9:	89 e5                	mov    %esp,%ebp
+  8014eb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014f0:	89 c2                	mov    %eax,%edx
+  8014f2:	c1 ea 16             	shr    $0x16,%edx
+  8014f5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014fc:	f6 c2 01             	test   $0x1,%dl
+  8014ff:	74 29                	je     80152a <fd_alloc+0x42>
+  801501:	89 c2                	mov    %eax,%edx
+  801503:	c1 ea 0c             	shr    $0xc,%edx
+  801506:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80150d:	f6 c2 01             	test   $0x1,%dl
+  801510:	74 18                	je     80152a <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801512:	05 00 10 00 00       	add    $0x1000,%eax
+  801517:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80151c:	75 d2                	jne    8014f0 <fd_alloc+0x8>
+  80151e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801523:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801528:	eb 05                	jmp    80152f <fd_alloc+0x47>
+			return 0;
+  80152a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80152f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801532:	89 02                	mov    %eax,(%edx)
+}
+  801534:	89 c8                	mov    %ecx,%eax
+  801536:	5d                   	pop    %ebp
+  801537:	c3                   	ret
+
+00801538 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80153e:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801543:	77 30                	ja     801575 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801545:	c1 e0 0c             	shl    $0xc,%eax
+  801548:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80154d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801553:	f6 c2 01             	test   $0x1,%dl
+  801556:	74 24                	je     80157c <fd_lookup+0x44>
+  801558:	89 c2                	mov    %eax,%edx
+  80155a:	c1 ea 0c             	shr    $0xc,%edx
+  80155d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801564:	f6 c2 01             	test   $0x1,%dl
+  801567:	74 1a                	je     801583 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801569:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80156c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+		return -E_INVAL;
+  801575:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157a:	eb f7                	jmp    801573 <fd_lookup+0x3b>
+		return -E_INVAL;
+  80157c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801581:	eb f0                	jmp    801573 <fd_lookup+0x3b>
+  801583:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801588:	eb e9                	jmp    801573 <fd_lookup+0x3b>
+
+0080158a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80158a:	55                   	push   %ebp
+  80158b:	89 e5                	mov    %esp,%ebp
+  80158d:	53                   	push   %ebx
+  80158e:	83 ec 04             	sub    $0x4,%esp
+  801591:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801594:	b8 00 00 00 00       	mov    $0x0,%eax
+  801599:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  80159e:	39 13                	cmp    %edx,(%ebx)
+  8015a0:	74 54                	je     8015f6 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8015a2:	83 c0 01             	add    $0x1,%eax
+  8015a5:	8b 1c 85 4c 3f 80 00 	mov    0x803f4c(,%eax,4),%ebx
+  8015ac:	85 db                	test   %ebx,%ebx
+  8015ae:	75 ee                	jne    80159e <dev_lookup+0x14>
+  8015b0:	89 e1                	mov    %esp,%ecx
+  8015b2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015b7:	29 c8                	sub    %ecx,%eax
+  8015b9:	89 c1                	mov    %eax,%ecx
+  8015bb:	c1 e9 0f             	shr    $0xf,%ecx
+  8015be:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c8:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015cb:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8015d2:	8b 40 48             	mov    0x48(%eax),%eax
+  8015d5:	83 ec 04             	sub    $0x4,%esp
+  8015d8:	52                   	push   %edx
+  8015d9:	50                   	push   %eax
+  8015da:	68 d0 3e 80 00       	push   $0x803ed0
+  8015df:	e8 17 ec ff ff       	call   8001fb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015e4:	83 c4 10             	add    $0x10,%esp
+  8015e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ef:	89 1a                	mov    %ebx,(%edx)
+}
+  8015f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+			return 0;
+  8015f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fb:	eb ef                	jmp    8015ec <dev_lookup+0x62>
+
+008015fd <fd_close>:
+{
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	57                   	push   %edi
+  801601:	56                   	push   %esi
+  801602:	53                   	push   %ebx
+  801603:	83 ec 24             	sub    $0x24,%esp
+  801606:	8b 75 08             	mov    0x8(%ebp),%esi
+  801609:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80160c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80160f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801610:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801616:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801619:	50                   	push   %eax
+  80161a:	e8 19 ff ff ff       	call   801538 <fd_lookup>
+  80161f:	89 c3                	mov    %eax,%ebx
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	85 c0                	test   %eax,%eax
+  801626:	78 05                	js     80162d <fd_close+0x30>
+	    || fd != fd2)
+  801628:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80162b:	74 0f                	je     80163c <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80162d:	85 ff                	test   %edi,%edi
+  80162f:	0f 44 df             	cmove  %edi,%ebx
+}
+  801632:	89 d8                	mov    %ebx,%eax
+  801634:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801637:	5b                   	pop    %ebx
+  801638:	5e                   	pop    %esi
+  801639:	5f                   	pop    %edi
+  80163a:	5d                   	pop    %ebp
+  80163b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80163c:	83 ec 08             	sub    $0x8,%esp
+  80163f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801642:	50                   	push   %eax
+  801643:	ff 36                	push   (%esi)
+  801645:	e8 40 ff ff ff       	call   80158a <dev_lookup>
+  80164a:	89 c3                	mov    %eax,%ebx
+  80164c:	83 c4 10             	add    $0x10,%esp
+  80164f:	85 c0                	test   %eax,%eax
+  801651:	78 1a                	js     80166d <fd_close+0x70>
+		if (dev->dev_close)
+  801653:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801656:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801659:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	74 0b                	je     80166d <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801662:	83 ec 0c             	sub    $0xc,%esp
+  801665:	56                   	push   %esi
+  801666:	ff d0                	call   *%eax
+  801668:	89 c3                	mov    %eax,%ebx
+  80166a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80166d:	83 ec 08             	sub    $0x8,%esp
+  801670:	56                   	push   %esi
+  801671:	6a 00                	push   $0x0
+  801673:	e8 33 f7 ff ff       	call   800dab <sys_page_unmap>
+	return r;
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	eb b5                	jmp    801632 <fd_close+0x35>
+
+0080167d <close>:
+
+int
+close(int fdnum)
+{
+  80167d:	55                   	push   %ebp
+  80167e:	89 e5                	mov    %esp,%ebp
+  801680:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801683:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801686:	50                   	push   %eax
+  801687:	ff 75 08             	push   0x8(%ebp)
+  80168a:	e8 a9 fe ff ff       	call   801538 <fd_lookup>
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	85 c0                	test   %eax,%eax
+  801694:	79 02                	jns    801698 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801696:	c9                   	leave
+  801697:	c3                   	ret
+		return fd_close(fd, 1);
+  801698:	83 ec 08             	sub    $0x8,%esp
+  80169b:	6a 01                	push   $0x1
+  80169d:	ff 75 f4             	push   -0xc(%ebp)
+  8016a0:	e8 58 ff ff ff       	call   8015fd <fd_close>
+  8016a5:	83 c4 10             	add    $0x10,%esp
+  8016a8:	eb ec                	jmp    801696 <close+0x19>
+
+008016aa <close_all>:
+
+void
+close_all(void)
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	53                   	push   %ebx
+  8016ae:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016b6:	83 ec 0c             	sub    $0xc,%esp
+  8016b9:	53                   	push   %ebx
+  8016ba:	e8 be ff ff ff       	call   80167d <close>
+	for (i = 0; i < MAXFD; i++)
+  8016bf:	83 c3 01             	add    $0x1,%ebx
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8016cb:	75 e9                	jne    8016b6 <close_all+0xc>
+}
+  8016cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d0:	c9                   	leave
+  8016d1:	c3                   	ret
+
+008016d2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016d2:	55                   	push   %ebp
+  8016d3:	89 e5                	mov    %esp,%ebp
+  8016d5:	57                   	push   %edi
+  8016d6:	56                   	push   %esi
+  8016d7:	53                   	push   %ebx
+  8016d8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016db:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016de:	50                   	push   %eax
+  8016df:	ff 75 08             	push   0x8(%ebp)
+  8016e2:	e8 51 fe ff ff       	call   801538 <fd_lookup>
+  8016e7:	89 c3                	mov    %eax,%ebx
+  8016e9:	83 c4 10             	add    $0x10,%esp
+  8016ec:	85 c0                	test   %eax,%eax
+  8016ee:	78 7f                	js     80176f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016f0:	83 ec 0c             	sub    $0xc,%esp
+  8016f3:	ff 75 0c             	push   0xc(%ebp)
+  8016f6:	e8 82 ff ff ff       	call   80167d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016fe:	c1 e6 0c             	shl    $0xc,%esi
+  801701:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801707:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80170a:	89 3c 24             	mov    %edi,(%esp)
+  80170d:	e8 bf fd ff ff       	call   8014d1 <fd2data>
+  801712:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801714:	89 34 24             	mov    %esi,(%esp)
+  801717:	e8 b5 fd ff ff       	call   8014d1 <fd2data>
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801722:	89 d8                	mov    %ebx,%eax
+  801724:	c1 e8 16             	shr    $0x16,%eax
+  801727:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80172e:	a8 01                	test   $0x1,%al
+  801730:	74 11                	je     801743 <dup+0x71>
+  801732:	89 d8                	mov    %ebx,%eax
+  801734:	c1 e8 0c             	shr    $0xc,%eax
+  801737:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80173e:	f6 c2 01             	test   $0x1,%dl
+  801741:	75 36                	jne    801779 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801743:	89 f8                	mov    %edi,%eax
+  801745:	c1 e8 0c             	shr    $0xc,%eax
+  801748:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80174f:	83 ec 0c             	sub    $0xc,%esp
+  801752:	25 07 0e 00 00       	and    $0xe07,%eax
+  801757:	50                   	push   %eax
+  801758:	56                   	push   %esi
+  801759:	6a 00                	push   $0x0
+  80175b:	57                   	push   %edi
+  80175c:	6a 00                	push   $0x0
+  80175e:	e8 06 f6 ff ff       	call   800d69 <sys_page_map>
+  801763:	89 c3                	mov    %eax,%ebx
+  801765:	83 c4 20             	add    $0x20,%esp
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	78 33                	js     80179f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80176c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80176f:	89 d8                	mov    %ebx,%eax
+  801771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801774:	5b                   	pop    %ebx
+  801775:	5e                   	pop    %esi
+  801776:	5f                   	pop    %edi
+  801777:	5d                   	pop    %ebp
+  801778:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801779:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801780:	83 ec 0c             	sub    $0xc,%esp
+  801783:	25 07 0e 00 00       	and    $0xe07,%eax
+  801788:	50                   	push   %eax
+  801789:	ff 75 d4             	push   -0x2c(%ebp)
+  80178c:	6a 00                	push   $0x0
+  80178e:	53                   	push   %ebx
+  80178f:	6a 00                	push   $0x0
+  801791:	e8 d3 f5 ff ff       	call   800d69 <sys_page_map>
+  801796:	89 c3                	mov    %eax,%ebx
+  801798:	83 c4 20             	add    $0x20,%esp
+  80179b:	85 c0                	test   %eax,%eax
+  80179d:	79 a4                	jns    801743 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80179f:	83 ec 08             	sub    $0x8,%esp
+  8017a2:	56                   	push   %esi
+  8017a3:	6a 00                	push   $0x0
+  8017a5:	e8 01 f6 ff ff       	call   800dab <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017aa:	83 c4 08             	add    $0x8,%esp
+  8017ad:	ff 75 d4             	push   -0x2c(%ebp)
+  8017b0:	6a 00                	push   $0x0
+  8017b2:	e8 f4 f5 ff ff       	call   800dab <sys_page_unmap>
+	return r;
+  8017b7:	83 c4 10             	add    $0x10,%esp
+  8017ba:	eb b3                	jmp    80176f <dup+0x9d>
+
+008017bc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017bc:	55                   	push   %ebp
+  8017bd:	89 e5                	mov    %esp,%ebp
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+  8017c1:	83 ec 18             	sub    $0x18,%esp
+  8017c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017c7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ca:	50                   	push   %eax
+  8017cb:	53                   	push   %ebx
+  8017cc:	e8 67 fd ff ff       	call   801538 <fd_lookup>
+  8017d1:	83 c4 10             	add    $0x10,%esp
+  8017d4:	85 c0                	test   %eax,%eax
+  8017d6:	78 3c                	js     801814 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e1:	50                   	push   %eax
+  8017e2:	ff 36                	push   (%esi)
+  8017e4:	e8 a1 fd ff ff       	call   80158a <dev_lookup>
+  8017e9:	83 c4 10             	add    $0x10,%esp
+  8017ec:	85 c0                	test   %eax,%eax
+  8017ee:	78 24                	js     801814 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017f0:	8b 46 08             	mov    0x8(%esi),%eax
+  8017f3:	83 e0 03             	and    $0x3,%eax
+  8017f6:	83 f8 01             	cmp    $0x1,%eax
+  8017f9:	74 20                	je     80181b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fe:	8b 40 08             	mov    0x8(%eax),%eax
+  801801:	85 c0                	test   %eax,%eax
+  801803:	74 54                	je     801859 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801805:	83 ec 04             	sub    $0x4,%esp
+  801808:	ff 75 10             	push   0x10(%ebp)
+  80180b:	ff 75 0c             	push   0xc(%ebp)
+  80180e:	56                   	push   %esi
+  80180f:	ff d0                	call   *%eax
+  801811:	83 c4 10             	add    $0x10,%esp
+}
+  801814:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801817:	5b                   	pop    %ebx
+  801818:	5e                   	pop    %esi
+  801819:	5d                   	pop    %ebp
+  80181a:	c3                   	ret
+  80181b:	89 e2                	mov    %esp,%edx
+  80181d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801822:	29 d0                	sub    %edx,%eax
+  801824:	89 c2                	mov    %eax,%edx
+  801826:	c1 ea 0f             	shr    $0xf,%edx
+  801829:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80182e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801833:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801836:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80183d:	8b 40 48             	mov    0x48(%eax),%eax
+  801840:	83 ec 04             	sub    $0x4,%esp
+  801843:	53                   	push   %ebx
+  801844:	50                   	push   %eax
+  801845:	68 11 3f 80 00       	push   $0x803f11
+  80184a:	e8 ac e9 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  80184f:	83 c4 10             	add    $0x10,%esp
+  801852:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801857:	eb bb                	jmp    801814 <read+0x58>
+		return -E_NOT_SUPP;
+  801859:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80185e:	eb b4                	jmp    801814 <read+0x58>
+
+00801860 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801860:	55                   	push   %ebp
+  801861:	89 e5                	mov    %esp,%ebp
+  801863:	57                   	push   %edi
+  801864:	56                   	push   %esi
+  801865:	53                   	push   %ebx
+  801866:	83 ec 0c             	sub    $0xc,%esp
+  801869:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80186c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80186f:	85 f6                	test   %esi,%esi
+  801871:	74 30                	je     8018a3 <readn+0x43>
+  801873:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801878:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80187d:	83 ec 04             	sub    $0x4,%esp
+  801880:	89 f2                	mov    %esi,%edx
+  801882:	29 c2                	sub    %eax,%edx
+  801884:	52                   	push   %edx
+  801885:	01 f8                	add    %edi,%eax
+  801887:	50                   	push   %eax
+  801888:	ff 75 08             	push   0x8(%ebp)
+  80188b:	e8 2c ff ff ff       	call   8017bc <read>
+		if (m < 0)
+  801890:	83 c4 10             	add    $0x10,%esp
+  801893:	85 c0                	test   %eax,%eax
+  801895:	78 15                	js     8018ac <readn+0x4c>
+			return m;
+		if (m == 0)
+  801897:	74 11                	je     8018aa <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801899:	01 c3                	add    %eax,%ebx
+  80189b:	89 d8                	mov    %ebx,%eax
+  80189d:	39 f3                	cmp    %esi,%ebx
+  80189f:	72 dc                	jb     80187d <readn+0x1d>
+  8018a1:	eb 09                	jmp    8018ac <readn+0x4c>
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a8:	eb 02                	jmp    8018ac <readn+0x4c>
+  8018aa:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8018ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018af:	5b                   	pop    %ebx
+  8018b0:	5e                   	pop    %esi
+  8018b1:	5f                   	pop    %edi
+  8018b2:	5d                   	pop    %ebp
+  8018b3:	c3                   	ret
+
+008018b4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	56                   	push   %esi
+  8018b8:	53                   	push   %ebx
+  8018b9:	83 ec 18             	sub    $0x18,%esp
+  8018bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018c2:	50                   	push   %eax
+  8018c3:	53                   	push   %ebx
+  8018c4:	e8 6f fc ff ff       	call   801538 <fd_lookup>
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	78 37                	js     801907 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d3:	83 ec 08             	sub    $0x8,%esp
+  8018d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d9:	50                   	push   %eax
+  8018da:	ff 36                	push   (%esi)
+  8018dc:	e8 a9 fc ff ff       	call   80158a <dev_lookup>
+  8018e1:	83 c4 10             	add    $0x10,%esp
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	78 1f                	js     801907 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018e8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018ec:	74 20                	je     80190e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	74 54                	je     80194c <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018f8:	83 ec 04             	sub    $0x4,%esp
+  8018fb:	ff 75 10             	push   0x10(%ebp)
+  8018fe:	ff 75 0c             	push   0xc(%ebp)
+  801901:	56                   	push   %esi
+  801902:	ff d0                	call   *%eax
+  801904:	83 c4 10             	add    $0x10,%esp
+}
+  801907:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80190a:	5b                   	pop    %ebx
+  80190b:	5e                   	pop    %esi
+  80190c:	5d                   	pop    %ebp
+  80190d:	c3                   	ret
+  80190e:	89 e2                	mov    %esp,%edx
+  801910:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801915:	29 d0                	sub    %edx,%eax
+  801917:	89 c2                	mov    %eax,%edx
+  801919:	c1 ea 0f             	shr    $0xf,%edx
+  80191c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801921:	b8 00 00 00 00       	mov    $0x0,%eax
+  801926:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801929:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801930:	8b 40 48             	mov    0x48(%eax),%eax
+  801933:	83 ec 04             	sub    $0x4,%esp
+  801936:	53                   	push   %ebx
+  801937:	50                   	push   %eax
+  801938:	68 2d 3f 80 00       	push   $0x803f2d
+  80193d:	e8 b9 e8 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801942:	83 c4 10             	add    $0x10,%esp
+  801945:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194a:	eb bb                	jmp    801907 <write+0x53>
+		return -E_NOT_SUPP;
+  80194c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801951:	eb b4                	jmp    801907 <write+0x53>
+
+00801953 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801953:	55                   	push   %ebp
+  801954:	89 e5                	mov    %esp,%ebp
+  801956:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801959:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195c:	50                   	push   %eax
+  80195d:	ff 75 08             	push   0x8(%ebp)
+  801960:	e8 d3 fb ff ff       	call   801538 <fd_lookup>
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	85 c0                	test   %eax,%eax
+  80196a:	78 0e                	js     80197a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80196c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80196f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801972:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801975:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80197a:	c9                   	leave
+  80197b:	c3                   	ret
+
+0080197c <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80197c:	55                   	push   %ebp
+  80197d:	89 e5                	mov    %esp,%ebp
+  80197f:	53                   	push   %ebx
+  801980:	83 ec 1c             	sub    $0x1c,%esp
+  801983:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801986:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801989:	50                   	push   %eax
+  80198a:	ff 75 08             	push   0x8(%ebp)
+  80198d:	e8 a6 fb ff ff       	call   801538 <fd_lookup>
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	85 c0                	test   %eax,%eax
+  801997:	78 33                	js     8019cc <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801999:	83 fb 03             	cmp    $0x3,%ebx
+  80199c:	74 28                	je     8019c6 <fcntl+0x4a>
+  80199e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a3:	83 fb 04             	cmp    $0x4,%ebx
+  8019a6:	75 24                	jne    8019cc <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8019a8:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8019ab:	8b 41 08             	mov    0x8(%ecx),%eax
+  8019ae:	80 e4 ef             	and    $0xef,%ah
+  8019b1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8019b4:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8019ba:	09 d0                	or     %edx,%eax
+  8019bc:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8019bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c4:	eb 06                	jmp    8019cc <fcntl+0x50>
+		return fd->fd_omode;
+  8019c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c9:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8019cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+
+008019d1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019d1:	55                   	push   %ebp
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	56                   	push   %esi
+  8019d5:	53                   	push   %ebx
+  8019d6:	83 ec 18             	sub    $0x18,%esp
+  8019d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019dc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019df:	50                   	push   %eax
+  8019e0:	53                   	push   %ebx
+  8019e1:	e8 52 fb ff ff       	call   801538 <fd_lookup>
+  8019e6:	83 c4 10             	add    $0x10,%esp
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	78 34                	js     801a21 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019ed:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019f0:	83 ec 08             	sub    $0x8,%esp
+  8019f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f6:	50                   	push   %eax
+  8019f7:	ff 36                	push   (%esi)
+  8019f9:	e8 8c fb ff ff       	call   80158a <dev_lookup>
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 1c                	js     801a21 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a05:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a09:	74 1d                	je     801a28 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a0e:	8b 40 18             	mov    0x18(%eax),%eax
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	74 51                	je     801a66 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a15:	83 ec 08             	sub    $0x8,%esp
+  801a18:	ff 75 0c             	push   0xc(%ebp)
+  801a1b:	56                   	push   %esi
+  801a1c:	ff d0                	call   *%eax
+  801a1e:	83 c4 10             	add    $0x10,%esp
+}
+  801a21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a24:	5b                   	pop    %ebx
+  801a25:	5e                   	pop    %esi
+  801a26:	5d                   	pop    %ebp
+  801a27:	c3                   	ret
+  801a28:	89 e2                	mov    %esp,%edx
+  801a2a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a2f:	29 d0                	sub    %edx,%eax
+  801a31:	89 c2                	mov    %eax,%edx
+  801a33:	c1 ea 0f             	shr    $0xf,%edx
+  801a36:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a40:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801a43:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801a4a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a4d:	83 ec 04             	sub    $0x4,%esp
+  801a50:	53                   	push   %ebx
+  801a51:	50                   	push   %eax
+  801a52:	68 f0 3e 80 00       	push   $0x803ef0
+  801a57:	e8 9f e7 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801a5c:	83 c4 10             	add    $0x10,%esp
+  801a5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a64:	eb bb                	jmp    801a21 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a6b:	eb b4                	jmp    801a21 <ftruncate+0x50>
+
+00801a6d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a6d:	55                   	push   %ebp
+  801a6e:	89 e5                	mov    %esp,%ebp
+  801a70:	56                   	push   %esi
+  801a71:	53                   	push   %ebx
+  801a72:	83 ec 18             	sub    $0x18,%esp
+  801a75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a7b:	50                   	push   %eax
+  801a7c:	ff 75 08             	push   0x8(%ebp)
+  801a7f:	e8 b4 fa ff ff       	call   801538 <fd_lookup>
+  801a84:	83 c4 10             	add    $0x10,%esp
+  801a87:	85 c0                	test   %eax,%eax
+  801a89:	78 53                	js     801ade <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a8b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a8e:	83 ec 08             	sub    $0x8,%esp
+  801a91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a94:	50                   	push   %eax
+  801a95:	ff 36                	push   (%esi)
+  801a97:	e8 ee fa ff ff       	call   80158a <dev_lookup>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	85 c0                	test   %eax,%eax
+  801aa1:	78 3b                	js     801ade <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801aa3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801aaa:	74 39                	je     801ae5 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801aac:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801aaf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ab6:	00 00 00 
+	stat->st_isdir = 0;
+  801ab9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ac0:	00 00 00 
+	stat->st_version = 0;
+  801ac3:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801aca:	00 00 00 
+	stat->st_dev = dev;
+  801acd:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ad3:	83 ec 08             	sub    $0x8,%esp
+  801ad6:	53                   	push   %ebx
+  801ad7:	56                   	push   %esi
+  801ad8:	ff 50 14             	call   *0x14(%eax)
+  801adb:	83 c4 10             	add    $0x10,%esp
+}
+  801ade:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae1:	5b                   	pop    %ebx
+  801ae2:	5e                   	pop    %esi
+  801ae3:	5d                   	pop    %ebp
+  801ae4:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ae5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aea:	eb f2                	jmp    801ade <fstat+0x71>
+
+00801aec <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801aec:	55                   	push   %ebp
+  801aed:	89 e5                	mov    %esp,%ebp
+  801aef:	56                   	push   %esi
+  801af0:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801af1:	83 ec 08             	sub    $0x8,%esp
+  801af4:	6a 00                	push   $0x0
+  801af6:	ff 75 08             	push   0x8(%ebp)
+  801af9:	e8 b7 01 00 00       	call   801cb5 <open>
+  801afe:	89 c3                	mov    %eax,%ebx
+  801b00:	83 c4 10             	add    $0x10,%esp
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	78 1b                	js     801b22 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b07:	83 ec 08             	sub    $0x8,%esp
+  801b0a:	ff 75 0c             	push   0xc(%ebp)
+  801b0d:	50                   	push   %eax
+  801b0e:	e8 5a ff ff ff       	call   801a6d <fstat>
+  801b13:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b15:	89 1c 24             	mov    %ebx,(%esp)
+  801b18:	e8 60 fb ff ff       	call   80167d <close>
+	return r;
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	89 f3                	mov    %esi,%ebx
+}
+  801b22:	89 d8                	mov    %ebx,%eax
+  801b24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b27:	5b                   	pop    %ebx
+  801b28:	5e                   	pop    %esi
+  801b29:	5d                   	pop    %ebp
+  801b2a:	c3                   	ret
+
+00801b2b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b2b:	55                   	push   %ebp
+  801b2c:	89 e5                	mov    %esp,%ebp
+  801b2e:	56                   	push   %esi
+  801b2f:	53                   	push   %ebx
+  801b30:	89 c6                	mov    %eax,%esi
+  801b32:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801b34:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801b3b:	74 27                	je     801b64 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b3d:	6a 07                	push   $0x7
+  801b3f:	68 00 70 80 00       	push   $0x807000
+  801b44:	56                   	push   %esi
+  801b45:	ff 35 00 60 80 00    	push   0x806000
+  801b4b:	e8 c9 f8 ff ff       	call   801419 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b50:	83 c4 0c             	add    $0xc,%esp
+  801b53:	6a 00                	push   $0x0
+  801b55:	53                   	push   %ebx
+  801b56:	6a 00                	push   $0x0
+  801b58:	e8 2c f6 ff ff       	call   801189 <ipc_recv>
+}
+  801b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b60:	5b                   	pop    %ebx
+  801b61:	5e                   	pop    %esi
+  801b62:	5d                   	pop    %ebp
+  801b63:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b64:	83 ec 0c             	sub    $0xc,%esp
+  801b67:	6a 02                	push   $0x2
+  801b69:	e8 14 f9 ff ff       	call   801482 <ipc_find_env>
+  801b6e:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b73:	83 c4 10             	add    $0x10,%esp
+  801b76:	eb c5                	jmp    801b3d <fsipc+0x12>
+
+00801b78 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b81:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b84:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801b89:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b8c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b96:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b9b:	e8 8b ff ff ff       	call   801b2b <fsipc>
+}
+  801ba0:	c9                   	leave
+  801ba1:	c3                   	ret
+
+00801ba2 <devfile_flush>:
+{
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ba8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bab:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bae:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb8:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bbd:	e8 69 ff ff ff       	call   801b2b <fsipc>
+}
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+00801bc4 <devfile_stat>:
+{
+  801bc4:	55                   	push   %ebp
+  801bc5:	89 e5                	mov    %esp,%ebp
+  801bc7:	53                   	push   %ebx
+  801bc8:	83 ec 04             	sub    $0x4,%esp
+  801bcb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801bce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd4:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bde:	b8 05 00 00 00       	mov    $0x5,%eax
+  801be3:	e8 43 ff ff ff       	call   801b2b <fsipc>
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	78 37                	js     801c23 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801bec:	83 ec 08             	sub    $0x8,%esp
+  801bef:	68 00 70 80 00       	push   $0x807000
+  801bf4:	53                   	push   %ebx
+  801bf5:	e8 f8 ec ff ff       	call   8008f2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801bfa:	a1 80 70 80 00       	mov    0x807080,%eax
+  801bff:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c05:	a1 84 70 80 00       	mov    0x807084,%eax
+  801c0a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801c10:	a1 88 70 80 00       	mov    0x807088,%eax
+  801c15:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801c1b:	83 c4 10             	add    $0x10,%esp
+  801c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c26:	c9                   	leave
+  801c27:	c3                   	ret
+
+00801c28 <devfile_write>:
+{
+  801c28:	55                   	push   %ebp
+  801c29:	89 e5                	mov    %esp,%ebp
+  801c2b:	83 ec 0c             	sub    $0xc,%esp
+  801c2e:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801c31:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c36:	39 d0                	cmp    %edx,%eax
+  801c38:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c3e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c41:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801c47:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801c4c:	50                   	push   %eax
+  801c4d:	ff 75 0c             	push   0xc(%ebp)
+  801c50:	68 08 70 80 00       	push   $0x807008
+  801c55:	e8 48 ee ff ff       	call   800aa2 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c64:	e8 c2 fe ff ff       	call   801b2b <fsipc>
+}
+  801c69:	c9                   	leave
+  801c6a:	c3                   	ret
+
+00801c6b <devfile_read>:
+{
+  801c6b:	55                   	push   %ebp
+  801c6c:	89 e5                	mov    %esp,%ebp
+  801c6e:	53                   	push   %ebx
+  801c6f:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c75:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c78:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801c7d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c80:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801c85:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801c8a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c8f:	e8 97 fe ff ff       	call   801b2b <fsipc>
+  801c94:	89 c3                	mov    %eax,%ebx
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	78 14                	js     801cae <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801c9a:	83 ec 04             	sub    $0x4,%esp
+  801c9d:	50                   	push   %eax
+  801c9e:	68 00 70 80 00       	push   $0x807000
+  801ca3:	ff 75 0c             	push   0xc(%ebp)
+  801ca6:	e8 f7 ed ff ff       	call   800aa2 <memmove>
+	return r;
+  801cab:	83 c4 10             	add    $0x10,%esp
+}
+  801cae:	89 d8                	mov    %ebx,%eax
+  801cb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb3:	c9                   	leave
+  801cb4:	c3                   	ret
+
+00801cb5 <open>:
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	53                   	push   %ebx
+  801cb9:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801cbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbf:	50                   	push   %eax
+  801cc0:	e8 23 f8 ff ff       	call   8014e8 <fd_alloc>
+  801cc5:	89 c3                	mov    %eax,%ebx
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	78 2a                	js     801cf8 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801cce:	83 ec 0c             	sub    $0xc,%esp
+  801cd1:	ff 75 08             	push   0x8(%ebp)
+  801cd4:	e8 cd eb ff ff       	call   8008a6 <strlen>
+  801cd9:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801cdc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801ce1:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ce6:	7e 17                	jle    801cff <open+0x4a>
+	fd_close(fd, 1);
+  801ce8:	83 ec 08             	sub    $0x8,%esp
+  801ceb:	6a 01                	push   $0x1
+  801ced:	ff 75 f4             	push   -0xc(%ebp)
+  801cf0:	e8 08 f9 ff ff       	call   8015fd <fd_close>
+	return r;
+  801cf5:	83 c4 10             	add    $0x10,%esp
+}
+  801cf8:	89 d8                	mov    %ebx,%eax
+  801cfa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cfd:	c9                   	leave
+  801cfe:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801cff:	83 ec 08             	sub    $0x8,%esp
+  801d02:	ff 75 08             	push   0x8(%ebp)
+  801d05:	68 00 70 80 00       	push   $0x807000
+  801d0a:	e8 e3 eb ff ff       	call   8008f2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d12:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801d17:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d1f:	e8 07 fe ff ff       	call   801b2b <fsipc>
+  801d24:	89 c3                	mov    %eax,%ebx
+  801d26:	83 c4 10             	add    $0x10,%esp
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	78 bb                	js     801ce8 <open+0x33>
+	return fd2num(fd); 	
+  801d2d:	83 ec 0c             	sub    $0xc,%esp
+  801d30:	ff 75 f4             	push   -0xc(%ebp)
+  801d33:	e8 89 f7 ff ff       	call   8014c1 <fd2num>
+  801d38:	89 c3                	mov    %eax,%ebx
+  801d3a:	83 c4 10             	add    $0x10,%esp
+  801d3d:	eb b9                	jmp    801cf8 <open+0x43>
+
+00801d3f <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801d3f:	55                   	push   %ebp
+  801d40:	89 e5                	mov    %esp,%ebp
+  801d42:	53                   	push   %ebx
+  801d43:	83 ec 1c             	sub    $0x1c,%esp
+  801d46:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4c:	50                   	push   %eax
+  801d4d:	ff 75 08             	push   0x8(%ebp)
+  801d50:	e8 e3 f7 ff ff       	call   801538 <fd_lookup>
+  801d55:	83 c4 10             	add    $0x10,%esp
+  801d58:	85 c0                	test   %eax,%eax
+  801d5a:	78 5a                	js     801db6 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5f:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801d65:	39 10                	cmp    %edx,(%eax)
+  801d67:	75 66                	jne    801dcf <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801d69:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801d70:	74 49                	je     801dbb <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d75:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d78:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801d7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d80:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801d85:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d8b:	6a 07                	push   $0x7
+  801d8d:	68 00 70 80 00       	push   $0x807000
+  801d92:	6a 09                	push   $0x9
+  801d94:	ff 35 00 60 80 00    	push   0x806000
+  801d9a:	e8 7a f6 ff ff       	call   801419 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801d9f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801da6:	6a 00                	push   $0x0
+  801da8:	53                   	push   %ebx
+  801da9:	ff 75 10             	push   0x10(%ebp)
+  801dac:	6a 00                	push   $0x0
+  801dae:	e8 a3 f4 ff ff       	call   801256 <ipc_recv_pages>
+  801db3:	83 c4 20             	add    $0x20,%esp
+}
+  801db6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dbb:	83 ec 0c             	sub    $0xc,%esp
+  801dbe:	6a 02                	push   $0x2
+  801dc0:	e8 bd f6 ff ff       	call   801482 <ipc_find_env>
+  801dc5:	a3 00 60 80 00       	mov    %eax,0x806000
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	eb a3                	jmp    801d72 <fmap+0x33>
+		return -E_INVAL;
+  801dcf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd4:	eb e0                	jmp    801db6 <fmap+0x77>
+
+00801dd6 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801dd6:	55                   	push   %ebp
+  801dd7:	89 e5                	mov    %esp,%ebp
+  801dd9:	53                   	push   %ebx
+  801dda:	83 ec 10             	sub    $0x10,%esp
+  801ddd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801de0:	53                   	push   %ebx
+  801de1:	e8 c0 ea ff ff       	call   8008a6 <strlen>
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dee:	7f 25                	jg     801e15 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801df0:	83 ec 08             	sub    $0x8,%esp
+  801df3:	53                   	push   %ebx
+  801df4:	68 00 70 80 00       	push   $0x807000
+  801df9:	e8 f4 ea ff ff       	call   8008f2 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e03:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e08:	e8 1e fd ff ff       	call   801b2b <fsipc>
+  801e0d:	83 c4 10             	add    $0x10,%esp
+}
+  801e10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e13:	c9                   	leave
+  801e14:	c3                   	ret
+		return -E_BAD_PATH;
+  801e15:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e1a:	eb f4                	jmp    801e10 <remove+0x3a>
+
+00801e1c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e1c:	55                   	push   %ebp
+  801e1d:	89 e5                	mov    %esp,%ebp
+  801e1f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801e22:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e27:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e2c:	e8 fa fc ff ff       	call   801b2b <fsipc>
+}
+  801e31:	c9                   	leave
+  801e32:	c3                   	ret
+
+00801e33 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801e39:	68 60 3f 80 00       	push   $0x803f60
+  801e3e:	ff 75 0c             	push   0xc(%ebp)
+  801e41:	e8 ac ea ff ff       	call   8008f2 <strcpy>
+	return 0;
+}
+  801e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4b:	c9                   	leave
+  801e4c:	c3                   	ret
+
+00801e4d <devsock_close>:
+{
+  801e4d:	55                   	push   %ebp
+  801e4e:	89 e5                	mov    %esp,%ebp
+  801e50:	53                   	push   %ebx
+  801e51:	83 ec 10             	sub    $0x10,%esp
+  801e54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801e57:	53                   	push   %ebx
+  801e58:	e8 82 1a 00 00       	call   8038df <pageref>
+  801e5d:	89 c2                	mov    %eax,%edx
+  801e5f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e62:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801e67:	83 fa 01             	cmp    $0x1,%edx
+  801e6a:	74 05                	je     801e71 <devsock_close+0x24>
+}
+  801e6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801e71:	83 ec 0c             	sub    $0xc,%esp
+  801e74:	ff 73 0c             	push   0xc(%ebx)
+  801e77:	e8 b0 05 00 00       	call   80242c <nsipc_close>
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	eb eb                	jmp    801e6c <devsock_close+0x1f>
+
+00801e81 <devsock_write>:
+{
+  801e81:	55                   	push   %ebp
+  801e82:	89 e5                	mov    %esp,%ebp
+  801e84:	53                   	push   %ebx
+  801e85:	83 ec 14             	sub    $0x14,%esp
+  801e88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e8e:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801e91:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801e94:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801e97:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e9a:	c1 f8 09             	sar    $0x9,%eax
+  801e9d:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801ea0:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801ea6:	77 13                	ja     801ebb <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801ea8:	50                   	push   %eax
+  801ea9:	52                   	push   %edx
+  801eaa:	53                   	push   %ebx
+  801eab:	ff 71 0c             	push   0xc(%ecx)
+  801eae:	e8 5c 06 00 00       	call   80250f <nsipc_send>
+  801eb3:	83 c4 10             	add    $0x10,%esp
+}
+  801eb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb9:	c9                   	leave
+  801eba:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801ebb:	50                   	push   %eax
+  801ebc:	6a 01                	push   $0x1
+  801ebe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ec1:	50                   	push   %eax
+  801ec2:	ff 71 0c             	push   0xc(%ecx)
+  801ec5:	e8 a6 06 00 00       	call   802570 <nsipc_sendmsg>
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	eb e7                	jmp    801eb6 <devsock_write+0x35>
+
+00801ecf <devsock_read>:
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	53                   	push   %ebx
+  801ed3:	83 ec 14             	sub    $0x14,%esp
+  801ed6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ed9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801edc:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801edf:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801ee2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801ee5:	8b 41 08             	mov    0x8(%ecx),%eax
+  801ee8:	c1 f8 09             	sar    $0x9,%eax
+  801eeb:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801eee:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801ef4:	77 13                	ja     801f09 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801ef6:	50                   	push   %eax
+  801ef7:	52                   	push   %edx
+  801ef8:	53                   	push   %ebx
+  801ef9:	ff 71 0c             	push   0xc(%ecx)
+  801efc:	e8 9c 05 00 00       	call   80249d <nsipc_recv>
+  801f01:	83 c4 10             	add    $0x10,%esp
+}
+  801f04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f07:	c9                   	leave
+  801f08:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801f09:	50                   	push   %eax
+  801f0a:	6a 01                	push   $0x1
+  801f0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f0f:	50                   	push   %eax
+  801f10:	ff 71 0c             	push   0xc(%ecx)
+  801f13:	e8 02 0a 00 00       	call   80291a <nsipc_recvmsg>
+  801f18:	83 c4 10             	add    $0x10,%esp
+  801f1b:	eb e7                	jmp    801f04 <devsock_read+0x35>
+
+00801f1d <fd2sockid>:
+{
+  801f1d:	55                   	push   %ebp
+  801f1e:	89 e5                	mov    %esp,%ebp
+  801f20:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801f23:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f26:	52                   	push   %edx
+  801f27:	50                   	push   %eax
+  801f28:	e8 0b f6 ff ff       	call   801538 <fd_lookup>
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	78 10                	js     801f44 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801f34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f37:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801f3d:	39 08                	cmp    %ecx,(%eax)
+  801f3f:	75 05                	jne    801f46 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801f41:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f46:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f4b:	eb f7                	jmp    801f44 <fd2sockid+0x27>
+
+00801f4d <sock_flags>:
+{
+  801f4d:	55                   	push   %ebp
+  801f4e:	89 e5                	mov    %esp,%ebp
+  801f50:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801f53:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f56:	52                   	push   %edx
+  801f57:	50                   	push   %eax
+  801f58:	e8 db f5 ff ff       	call   801538 <fd_lookup>
+  801f5d:	83 c4 10             	add    $0x10,%esp
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	78 0e                	js     801f72 <sock_flags+0x25>
+  801f64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f67:	8b 40 08             	mov    0x8(%eax),%eax
+  801f6a:	c1 e8 09             	shr    $0x9,%eax
+  801f6d:	83 e0 08             	and    $0x8,%eax
+}
+  801f70:	c9                   	leave
+  801f71:	c3                   	ret
+		return 0;
+  801f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f77:	eb f7                	jmp    801f70 <sock_flags+0x23>
+
+00801f79 <alloc_sockfd>:
+{
+  801f79:	55                   	push   %ebp
+  801f7a:	89 e5                	mov    %esp,%ebp
+  801f7c:	56                   	push   %esi
+  801f7d:	53                   	push   %ebx
+  801f7e:	83 ec 1c             	sub    $0x1c,%esp
+  801f81:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801f83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f86:	50                   	push   %eax
+  801f87:	e8 5c f5 ff ff       	call   8014e8 <fd_alloc>
+  801f8c:	89 c3                	mov    %eax,%ebx
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	78 43                	js     801fd8 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801f95:	83 ec 04             	sub    $0x4,%esp
+  801f98:	68 07 04 00 00       	push   $0x407
+  801f9d:	ff 75 f4             	push   -0xc(%ebp)
+  801fa0:	6a 00                	push   $0x0
+  801fa2:	e8 7f ed ff ff       	call   800d26 <sys_page_alloc>
+  801fa7:	89 c3                	mov    %eax,%ebx
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 28                	js     801fd8 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801fb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fb3:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801fb9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801fbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fbe:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801fc5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801fc8:	83 ec 0c             	sub    $0xc,%esp
+  801fcb:	50                   	push   %eax
+  801fcc:	e8 f0 f4 ff ff       	call   8014c1 <fd2num>
+  801fd1:	89 c3                	mov    %eax,%ebx
+  801fd3:	83 c4 10             	add    $0x10,%esp
+  801fd6:	eb 0c                	jmp    801fe4 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801fd8:	83 ec 0c             	sub    $0xc,%esp
+  801fdb:	56                   	push   %esi
+  801fdc:	e8 4b 04 00 00       	call   80242c <nsipc_close>
+		return r;
+  801fe1:	83 c4 10             	add    $0x10,%esp
+}
+  801fe4:	89 d8                	mov    %ebx,%eax
+  801fe6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe9:	5b                   	pop    %ebx
+  801fea:	5e                   	pop    %esi
+  801feb:	5d                   	pop    %ebp
+  801fec:	c3                   	ret
+
+00801fed <accept>:
+{
+  801fed:	55                   	push   %ebp
+  801fee:	89 e5                	mov    %esp,%ebp
+  801ff0:	56                   	push   %esi
+  801ff1:	53                   	push   %ebx
+  801ff2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801ff5:	89 f0                	mov    %esi,%eax
+  801ff7:	e8 21 ff ff ff       	call   801f1d <fd2sockid>
+  801ffc:	89 c3                	mov    %eax,%ebx
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	78 24                	js     802026 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802002:	89 f0                	mov    %esi,%eax
+  802004:	e8 44 ff ff ff       	call   801f4d <sock_flags>
+  802009:	50                   	push   %eax
+  80200a:	ff 75 10             	push   0x10(%ebp)
+  80200d:	ff 75 0c             	push   0xc(%ebp)
+  802010:	53                   	push   %ebx
+  802011:	e8 6b 03 00 00       	call   802381 <nsipc_accept>
+  802016:	89 c3                	mov    %eax,%ebx
+  802018:	83 c4 10             	add    $0x10,%esp
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 07                	js     802026 <accept+0x39>
+	return alloc_sockfd(r);
+  80201f:	e8 55 ff ff ff       	call   801f79 <alloc_sockfd>
+  802024:	89 c3                	mov    %eax,%ebx
+}
+  802026:	89 d8                	mov    %ebx,%eax
+  802028:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202b:	5b                   	pop    %ebx
+  80202c:	5e                   	pop    %esi
+  80202d:	5d                   	pop    %ebp
+  80202e:	c3                   	ret
+
+0080202f <bind>:
+{
+  80202f:	55                   	push   %ebp
+  802030:	89 e5                	mov    %esp,%ebp
+  802032:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802035:	8b 45 08             	mov    0x8(%ebp),%eax
+  802038:	e8 e0 fe ff ff       	call   801f1d <fd2sockid>
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 12                	js     802053 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802041:	83 ec 04             	sub    $0x4,%esp
+  802044:	ff 75 10             	push   0x10(%ebp)
+  802047:	ff 75 0c             	push   0xc(%ebp)
+  80204a:	50                   	push   %eax
+  80204b:	e8 85 03 00 00       	call   8023d5 <nsipc_bind>
+  802050:	83 c4 10             	add    $0x10,%esp
+}
+  802053:	c9                   	leave
+  802054:	c3                   	ret
+
+00802055 <shutdown>:
+{
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80205b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205e:	e8 ba fe ff ff       	call   801f1d <fd2sockid>
+  802063:	85 c0                	test   %eax,%eax
+  802065:	78 0f                	js     802076 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802067:	83 ec 08             	sub    $0x8,%esp
+  80206a:	ff 75 0c             	push   0xc(%ebp)
+  80206d:	50                   	push   %eax
+  80206e:	e8 97 03 00 00       	call   80240a <nsipc_shutdown>
+  802073:	83 c4 10             	add    $0x10,%esp
+}
+  802076:	c9                   	leave
+  802077:	c3                   	ret
+
+00802078 <connect>:
+{
+  802078:	55                   	push   %ebp
+  802079:	89 e5                	mov    %esp,%ebp
+  80207b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80207e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802081:	e8 97 fe ff ff       	call   801f1d <fd2sockid>
+  802086:	85 c0                	test   %eax,%eax
+  802088:	78 12                	js     80209c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80208a:	83 ec 04             	sub    $0x4,%esp
+  80208d:	ff 75 10             	push   0x10(%ebp)
+  802090:	ff 75 0c             	push   0xc(%ebp)
+  802093:	50                   	push   %eax
+  802094:	e8 ad 03 00 00       	call   802446 <nsipc_connect>
+  802099:	83 c4 10             	add    $0x10,%esp
+}
+  80209c:	c9                   	leave
+  80209d:	c3                   	ret
+
+0080209e <listen>:
+{
+  80209e:	55                   	push   %ebp
+  80209f:	89 e5                	mov    %esp,%ebp
+  8020a1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a7:	e8 71 fe ff ff       	call   801f1d <fd2sockid>
+  8020ac:	85 c0                	test   %eax,%eax
+  8020ae:	78 0f                	js     8020bf <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8020b0:	83 ec 08             	sub    $0x8,%esp
+  8020b3:	ff 75 0c             	push   0xc(%ebp)
+  8020b6:	50                   	push   %eax
+  8020b7:	e8 bf 03 00 00       	call   80247b <nsipc_listen>
+  8020bc:	83 c4 10             	add    $0x10,%esp
+}
+  8020bf:	c9                   	leave
+  8020c0:	c3                   	ret
+
+008020c1 <sendmsg>:
+{
+  8020c1:	55                   	push   %ebp
+  8020c2:	89 e5                	mov    %esp,%ebp
+  8020c4:	57                   	push   %edi
+  8020c5:	56                   	push   %esi
+  8020c6:	53                   	push   %ebx
+  8020c7:	83 ec 0c             	sub    $0xc,%esp
+  8020ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020cd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8020d0:	89 f0                	mov    %esi,%eax
+  8020d2:	e8 46 fe ff ff       	call   801f1d <fd2sockid>
+  8020d7:	89 c3                	mov    %eax,%ebx
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	78 1c                	js     8020f9 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8020dd:	89 f0                	mov    %esi,%eax
+  8020df:	e8 69 fe ff ff       	call   801f4d <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8020e4:	0b 45 10             	or     0x10(%ebp),%eax
+  8020e7:	50                   	push   %eax
+  8020e8:	ff 77 0c             	push   0xc(%edi)
+  8020eb:	ff 77 08             	push   0x8(%edi)
+  8020ee:	53                   	push   %ebx
+  8020ef:	e8 7c 04 00 00       	call   802570 <nsipc_sendmsg>
+  8020f4:	89 c3                	mov    %eax,%ebx
+  8020f6:	83 c4 10             	add    $0x10,%esp
+}
+  8020f9:	89 d8                	mov    %ebx,%eax
+  8020fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020fe:	5b                   	pop    %ebx
+  8020ff:	5e                   	pop    %esi
+  802100:	5f                   	pop    %edi
+  802101:	5d                   	pop    %ebp
+  802102:	c3                   	ret
+
+00802103 <recvmsg>:
+{
+  802103:	55                   	push   %ebp
+  802104:	89 e5                	mov    %esp,%ebp
+  802106:	57                   	push   %edi
+  802107:	56                   	push   %esi
+  802108:	53                   	push   %ebx
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80210f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802112:	89 f8                	mov    %edi,%eax
+  802114:	e8 04 fe ff ff       	call   801f1d <fd2sockid>
+  802119:	89 c3                	mov    %eax,%ebx
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	78 2a                	js     802149 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80211f:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802126:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80212d:	89 f8                	mov    %edi,%eax
+  80212f:	e8 19 fe ff ff       	call   801f4d <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802134:	0b 45 10             	or     0x10(%ebp),%eax
+  802137:	50                   	push   %eax
+  802138:	ff 76 0c             	push   0xc(%esi)
+  80213b:	ff 76 08             	push   0x8(%esi)
+  80213e:	53                   	push   %ebx
+  80213f:	e8 d6 07 00 00       	call   80291a <nsipc_recvmsg>
+  802144:	89 c3                	mov    %eax,%ebx
+  802146:	83 c4 10             	add    $0x10,%esp
+}
+  802149:	89 d8                	mov    %ebx,%eax
+  80214b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214e:	5b                   	pop    %ebx
+  80214f:	5e                   	pop    %esi
+  802150:	5f                   	pop    %edi
+  802151:	5d                   	pop    %ebp
+  802152:	c3                   	ret
+
+00802153 <sendfile>:
+{
+  802153:	55                   	push   %ebp
+  802154:	89 e5                	mov    %esp,%ebp
+  802156:	56                   	push   %esi
+  802157:	53                   	push   %ebx
+  802158:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80215b:	89 f0                	mov    %esi,%eax
+  80215d:	e8 bb fd ff ff       	call   801f1d <fd2sockid>
+  802162:	89 c3                	mov    %eax,%ebx
+  802164:	85 c0                	test   %eax,%eax
+  802166:	78 1f                	js     802187 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802168:	89 f0                	mov    %esi,%eax
+  80216a:	e8 de fd ff ff       	call   801f4d <sock_flags>
+  80216f:	83 ec 0c             	sub    $0xc,%esp
+  802172:	50                   	push   %eax
+  802173:	ff 75 14             	push   0x14(%ebp)
+  802176:	ff 75 10             	push   0x10(%ebp)
+  802179:	ff 75 0c             	push   0xc(%ebp)
+  80217c:	53                   	push   %ebx
+  80217d:	e8 64 06 00 00       	call   8027e6 <nsipc_sendfile>
+  802182:	89 c3                	mov    %eax,%ebx
+  802184:	83 c4 20             	add    $0x20,%esp
+}
+  802187:	89 d8                	mov    %ebx,%eax
+  802189:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218c:	5b                   	pop    %ebx
+  80218d:	5e                   	pop    %esi
+  80218e:	5d                   	pop    %ebp
+  80218f:	c3                   	ret
+
+00802190 <evctl>:
+{
+  802190:	55                   	push   %ebp
+  802191:	89 e5                	mov    %esp,%ebp
+  802193:	53                   	push   %ebx
+  802194:	83 ec 04             	sub    $0x4,%esp
+  802197:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80219a:	89 d8                	mov    %ebx,%eax
+  80219c:	e8 7c fd ff ff       	call   801f1d <fd2sockid>
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 10                	js     8021b5 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8021a5:	83 ec 04             	sub    $0x4,%esp
+  8021a8:	53                   	push   %ebx
+  8021a9:	ff 75 0c             	push   0xc(%ebp)
+  8021ac:	50                   	push   %eax
+  8021ad:	e8 d2 0b 00 00       	call   802d84 <nsipc_evctl>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+}
+  8021b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b8:	c9                   	leave
+  8021b9:	c3                   	ret
+
+008021ba <evwait>:
+{
+  8021ba:	55                   	push   %ebp
+  8021bb:	89 e5                	mov    %esp,%ebp
+  8021bd:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8021c0:	ff 75 10             	push   0x10(%ebp)
+  8021c3:	ff 75 0c             	push   0xc(%ebp)
+  8021c6:	ff 75 08             	push   0x8(%ebp)
+  8021c9:	e8 e0 0b 00 00       	call   802dae <nsipc_evwait>
+}
+  8021ce:	c9                   	leave
+  8021cf:	c3                   	ret
+
+008021d0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021d6:	ff 75 10             	push   0x10(%ebp)
+  8021d9:	ff 75 0c             	push   0xc(%ebp)
+  8021dc:	ff 75 08             	push   0x8(%ebp)
+  8021df:	e8 31 0c 00 00       	call   802e15 <nsipc_socket>
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	78 05                	js     8021f0 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8021eb:	e8 89 fd ff ff       	call   801f79 <alloc_sockfd>
+}
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+
+008021f2 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	53                   	push   %ebx
+  8021f6:	83 ec 04             	sub    $0x4,%esp
+  8021f9:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8021fb:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802202:	74 26                	je     80222a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802204:	6a 07                	push   $0x7
+  802206:	68 00 80 80 00       	push   $0x808000
+  80220b:	53                   	push   %ebx
+  80220c:	ff 35 24 63 80 00    	push   0x806324
+  802212:	e8 02 f2 ff ff       	call   801419 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802217:	83 c4 0c             	add    $0xc,%esp
+  80221a:	6a 00                	push   $0x0
+  80221c:	6a 00                	push   $0x0
+  80221e:	6a 00                	push   $0x0
+  802220:	e8 64 ef ff ff       	call   801189 <ipc_recv>
+}
+  802225:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802228:	c9                   	leave
+  802229:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80222a:	83 ec 0c             	sub    $0xc,%esp
+  80222d:	6a 03                	push   $0x3
+  80222f:	e8 4e f2 ff ff       	call   801482 <ipc_find_env>
+  802234:	a3 24 63 80 00       	mov    %eax,0x806324
+  802239:	83 c4 10             	add    $0x10,%esp
+  80223c:	eb c6                	jmp    802204 <nsipc+0x12>
+
+0080223e <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80223e:	55                   	push   %ebp
+  80223f:	89 e5                	mov    %esp,%ebp
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802243:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  802249:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80224e:	85 f6                	test   %esi,%esi
+  802250:	75 33                	jne    802285 <nsbulk_map+0x47>
+  802252:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802257:	83 ec 04             	sub    $0x4,%esp
+  80225a:	6a 07                	push   $0x7
+  80225c:	53                   	push   %ebx
+  80225d:	6a 00                	push   $0x0
+  80225f:	e8 c2 ea ff ff       	call   800d26 <sys_page_alloc>
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	85 c0                	test   %eax,%eax
+  802269:	78 1a                	js     802285 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80226b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802271:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802277:	75 de                	jne    802257 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802279:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  802280:	00 00 00 
+	return 0;
+  802283:	89 f0                	mov    %esi,%eax
+}
+  802285:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802288:	5b                   	pop    %ebx
+  802289:	5e                   	pop    %esi
+  80228a:	5d                   	pop    %ebp
+  80228b:	c3                   	ret
+
+0080228c <nsbulk_own>:
+{
+  80228c:	55                   	push   %ebp
+  80228d:	89 e5                	mov    %esp,%ebp
+  80228f:	57                   	push   %edi
+  802290:	56                   	push   %esi
+  802291:	53                   	push   %ebx
+  802292:	83 ec 0c             	sub    $0xc,%esp
+  802295:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802297:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80229a:	85 d2                	test   %edx,%edx
+  80229c:	7f 0e                	jg     8022ac <nsbulk_own+0x20>
+	return 0;
+  80229e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a3:	eb 47                	jmp    8022ec <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8022a5:	83 c3 01             	add    $0x1,%ebx
+  8022a8:	39 fb                	cmp    %edi,%ebx
+  8022aa:	7d 3b                	jge    8022e7 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8022ac:	be 01 00 00 00       	mov    $0x1,%esi
+  8022b1:	89 d9                	mov    %ebx,%ecx
+  8022b3:	d3 e6                	shl    %cl,%esi
+  8022b5:	89 f0                	mov    %esi,%eax
+  8022b7:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  8022bd:	74 e6                	je     8022a5 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8022bf:	83 ec 04             	sub    $0x4,%esp
+  8022c2:	6a 07                	push   $0x7
+  8022c4:	89 d8                	mov    %ebx,%eax
+  8022c6:	c1 e0 0c             	shl    $0xc,%eax
+  8022c9:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8022ce:	50                   	push   %eax
+  8022cf:	6a 00                	push   $0x0
+  8022d1:	e8 50 ea ff ff       	call   800d26 <sys_page_alloc>
+  8022d6:	83 c4 10             	add    $0x10,%esp
+  8022d9:	85 c0                	test   %eax,%eax
+  8022db:	78 0f                	js     8022ec <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8022dd:	f7 d6                	not    %esi
+  8022df:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  8022e5:	eb be                	jmp    8022a5 <nsbulk_own+0x19>
+	return 0;
+  8022e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ef:	5b                   	pop    %ebx
+  8022f0:	5e                   	pop    %esi
+  8022f1:	5f                   	pop    %edi
+  8022f2:	5d                   	pop    %ebp
+  8022f3:	c3                   	ret
+
+008022f4 <nsipc_bulk>:
+{
+  8022f4:	55                   	push   %ebp
+  8022f5:	89 e5                	mov    %esp,%ebp
+  8022f7:	57                   	push   %edi
+  8022f8:	56                   	push   %esi
+  8022f9:	53                   	push   %ebx
+  8022fa:	83 ec 1c             	sub    $0x1c,%esp
+  8022fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802300:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802302:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802308:	c1 fb 0c             	sar    $0xc,%ebx
+  80230b:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80230e:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802315:	74 56                	je     80236d <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802317:	85 ff                	test   %edi,%edi
+  802319:	7e 24                	jle    80233f <nsipc_bulk+0x4b>
+  80231b:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802321:	74 1c                	je     80233f <nsipc_bulk+0x4b>
+  802323:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802329:	c1 e3 0c             	shl    $0xc,%ebx
+  80232c:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802331:	0f b6 10             	movzbl (%eax),%edx
+  802334:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802336:	05 00 10 00 00       	add    $0x1000,%eax
+  80233b:	39 d8                	cmp    %ebx,%eax
+  80233d:	75 f2                	jne    802331 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80233f:	83 ec 0c             	sub    $0xc,%esp
+  802342:	56                   	push   %esi
+  802343:	57                   	push   %edi
+  802344:	68 00 00 00 e0       	push   $0xe0000000
+  802349:	ff 75 e4             	push   -0x1c(%ebp)
+  80234c:	ff 35 24 63 80 00    	push   0x806324
+  802352:	e8 f6 f0 ff ff       	call   80144d <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802357:	83 c4 1c             	add    $0x1c,%esp
+  80235a:	6a 00                	push   $0x0
+  80235c:	6a 00                	push   $0x0
+  80235e:	6a 00                	push   $0x0
+  802360:	e8 24 ee ff ff       	call   801189 <ipc_recv>
+}
+  802365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802368:	5b                   	pop    %ebx
+  802369:	5e                   	pop    %esi
+  80236a:	5f                   	pop    %edi
+  80236b:	5d                   	pop    %ebp
+  80236c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80236d:	83 ec 0c             	sub    $0xc,%esp
+  802370:	6a 03                	push   $0x3
+  802372:	e8 0b f1 ff ff       	call   801482 <ipc_find_env>
+  802377:	a3 24 63 80 00       	mov    %eax,0x806324
+  80237c:	83 c4 10             	add    $0x10,%esp
+  80237f:	eb 96                	jmp    802317 <nsipc_bulk+0x23>
+
+00802381 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+  802384:	53                   	push   %ebx
+  802385:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802388:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802390:	8b 45 14             	mov    0x14(%ebp),%eax
+  802393:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802398:	b8 01 00 00 00       	mov    $0x1,%eax
+  80239d:	e8 50 fe ff ff       	call   8021f2 <nsipc>
+  8023a2:	89 c3                	mov    %eax,%ebx
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	79 07                	jns    8023af <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8023a8:	89 d8                	mov    %ebx,%eax
+  8023aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ad:	c9                   	leave
+  8023ae:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8023af:	83 ec 04             	sub    $0x4,%esp
+  8023b2:	ff 35 10 80 80 00    	push   0x808010
+  8023b8:	68 00 80 80 00       	push   $0x808000
+  8023bd:	ff 75 0c             	push   0xc(%ebp)
+  8023c0:	e8 dd e6 ff ff       	call   800aa2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8023c5:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8023cb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023ce:	89 10                	mov    %edx,(%eax)
+  8023d0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8023d3:	eb d3                	jmp    8023a8 <nsipc_accept+0x27>
+
+008023d5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8023d5:	55                   	push   %ebp
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	53                   	push   %ebx
+  8023d9:	83 ec 08             	sub    $0x8,%esp
+  8023dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8023df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8023e7:	53                   	push   %ebx
+  8023e8:	ff 75 0c             	push   0xc(%ebp)
+  8023eb:	68 04 80 80 00       	push   $0x808004
+  8023f0:	e8 ad e6 ff ff       	call   800aa2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8023f5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8023fb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802400:	e8 ed fd ff ff       	call   8021f2 <nsipc>
+}
+  802405:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802408:	c9                   	leave
+  802409:	c3                   	ret
+
+0080240a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80240a:	55                   	push   %ebp
+  80240b:	89 e5                	mov    %esp,%ebp
+  80240d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802410:	8b 45 08             	mov    0x8(%ebp),%eax
+  802413:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802418:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80241b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802420:	b8 03 00 00 00       	mov    $0x3,%eax
+  802425:	e8 c8 fd ff ff       	call   8021f2 <nsipc>
+}
+  80242a:	c9                   	leave
+  80242b:	c3                   	ret
+
+0080242c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80242c:	55                   	push   %ebp
+  80242d:	89 e5                	mov    %esp,%ebp
+  80242f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802432:	8b 45 08             	mov    0x8(%ebp),%eax
+  802435:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80243a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80243f:	e8 ae fd ff ff       	call   8021f2 <nsipc>
+}
+  802444:	c9                   	leave
+  802445:	c3                   	ret
+
+00802446 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802446:	55                   	push   %ebp
+  802447:	89 e5                	mov    %esp,%ebp
+  802449:	53                   	push   %ebx
+  80244a:	83 ec 08             	sub    $0x8,%esp
+  80244d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802450:	8b 45 08             	mov    0x8(%ebp),%eax
+  802453:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802458:	53                   	push   %ebx
+  802459:	ff 75 0c             	push   0xc(%ebp)
+  80245c:	68 04 80 80 00       	push   $0x808004
+  802461:	e8 3c e6 ff ff       	call   800aa2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802466:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80246c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802471:	e8 7c fd ff ff       	call   8021f2 <nsipc>
+}
+  802476:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+
+0080247b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80247b:	55                   	push   %ebp
+  80247c:	89 e5                	mov    %esp,%ebp
+  80247e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802481:	8b 45 08             	mov    0x8(%ebp),%eax
+  802484:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802489:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80248c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802491:	b8 06 00 00 00       	mov    $0x6,%eax
+  802496:	e8 57 fd ff ff       	call   8021f2 <nsipc>
+}
+  80249b:	c9                   	leave
+  80249c:	c3                   	ret
+
+0080249d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80249d:	55                   	push   %ebp
+  80249e:	89 e5                	mov    %esp,%ebp
+  8024a0:	56                   	push   %esi
+  8024a1:	53                   	push   %ebx
+  8024a2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8024a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8024ad:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8024b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024b6:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8024bb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024c0:	e8 2d fd ff ff       	call   8021f2 <nsipc>
+  8024c5:	89 c3                	mov    %eax,%ebx
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	78 22                	js     8024ed <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8024cb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8024d0:	39 c6                	cmp    %eax,%esi
+  8024d2:	0f 4e c6             	cmovle %esi,%eax
+  8024d5:	39 c3                	cmp    %eax,%ebx
+  8024d7:	7f 1d                	jg     8024f6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8024d9:	83 ec 04             	sub    $0x4,%esp
+  8024dc:	53                   	push   %ebx
+  8024dd:	68 00 80 80 00       	push   $0x808000
+  8024e2:	ff 75 0c             	push   0xc(%ebp)
+  8024e5:	e8 b8 e5 ff ff       	call   800aa2 <memmove>
+  8024ea:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8024ed:	89 d8                	mov    %ebx,%eax
+  8024ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f2:	5b                   	pop    %ebx
+  8024f3:	5e                   	pop    %esi
+  8024f4:	5d                   	pop    %ebp
+  8024f5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8024f6:	68 6c 3f 80 00       	push   $0x803f6c
+  8024fb:	68 81 3f 80 00       	push   $0x803f81
+  802500:	68 b2 00 00 00       	push   $0xb2
+  802505:	68 96 3f 80 00       	push   $0x803f96
+  80250a:	e8 8a 13 00 00       	call   803899 <_panic>
+
+0080250f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80250f:	55                   	push   %ebp
+  802510:	89 e5                	mov    %esp,%ebp
+  802512:	53                   	push   %ebx
+  802513:	83 ec 04             	sub    $0x4,%esp
+  802516:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802519:	8b 45 08             	mov    0x8(%ebp),%eax
+  80251c:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802521:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802527:	7f 2e                	jg     802557 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802529:	83 ec 04             	sub    $0x4,%esp
+  80252c:	53                   	push   %ebx
+  80252d:	ff 75 0c             	push   0xc(%ebp)
+  802530:	68 0c 80 80 00       	push   $0x80800c
+  802535:	e8 68 e5 ff ff       	call   800aa2 <memmove>
+	nsipcbuf.send.req_size = size;
+  80253a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802540:	8b 45 14             	mov    0x14(%ebp),%eax
+  802543:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802548:	b8 08 00 00 00       	mov    $0x8,%eax
+  80254d:	e8 a0 fc ff ff       	call   8021f2 <nsipc>
+}
+  802552:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+	assert(size < 1600);
+  802557:	68 a2 3f 80 00       	push   $0x803fa2
+  80255c:	68 81 3f 80 00       	push   $0x803f81
+  802561:	68 bd 00 00 00       	push   $0xbd
+  802566:	68 96 3f 80 00       	push   $0x803f96
+  80256b:	e8 29 13 00 00       	call   803899 <_panic>
+
+00802570 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802570:	55                   	push   %ebp
+  802571:	89 e5                	mov    %esp,%ebp
+  802573:	57                   	push   %edi
+  802574:	56                   	push   %esi
+  802575:	53                   	push   %ebx
+  802576:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802579:	e8 c0 fc ff ff       	call   80223e <nsbulk_map>
+  80257e:	85 c0                	test   %eax,%eax
+  802580:	78 55                	js     8025d7 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802582:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802589:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802590:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802597:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80259a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80259d:	0f 8d 24 02 00 00    	jge    8027c7 <nsipc_sendmsg+0x257>
+  8025a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025a6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8025a9:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8025ac:	89 d8                	mov    %ebx,%eax
+  8025ae:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8025b3:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8025b5:	83 ec 0c             	sub    $0xc,%esp
+  8025b8:	68 20 60 80 00       	push   $0x806020
+  8025bd:	e8 5a 0f 00 00       	call   80351c <pgbatch_init>
+  8025c2:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8025c5:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8025c7:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8025ca:	e9 82 00 00 00       	jmp    802651 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8025cf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025d2:	85 db                	test   %ebx,%ebx
+  8025d4:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8025d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025da:	5b                   	pop    %ebx
+  8025db:	5e                   	pop    %esi
+  8025dc:	5f                   	pop    %edi
+  8025dd:	5d                   	pop    %ebp
+  8025de:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8025df:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025e4:	29 c8                	sub    %ecx,%eax
+  8025e6:	39 d0                	cmp    %edx,%eax
+  8025e8:	0f 46 d0             	cmovbe %eax,%edx
+  8025eb:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8025ed:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8025f3:	85 ff                	test   %edi,%edi
+  8025f5:	0f 49 c7             	cmovns %edi,%eax
+  8025f8:	c1 f8 0c             	sar    $0xc,%eax
+  8025fb:	ba 01 00 00 00       	mov    $0x1,%edx
+  802600:	e8 87 fc ff ff       	call   80228c <nsbulk_own>
+  802605:	85 c0                	test   %eax,%eax
+  802607:	0f 88 17 01 00 00    	js     802724 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80260d:	83 ec 04             	sub    $0x4,%esp
+  802610:	56                   	push   %esi
+  802611:	ff 75 e0             	push   -0x20(%ebp)
+  802614:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802617:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80261c:	50                   	push   %eax
+  80261d:	e8 80 e4 ff ff       	call   800aa2 <memmove>
+  802622:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802625:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802628:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80262b:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80262e:	0f 84 fd 00 00 00    	je     802731 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802634:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802637:	01 f7                	add    %esi,%edi
+  802639:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80263c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80263f:	0f 8d 01 01 00 00    	jge    802746 <nsipc_sendmsg+0x1d6>
+  802645:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80264b:	0f 8f f0 00 00 00    	jg     802741 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802651:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802654:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802657:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80265a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80265d:	89 c2                	mov    %eax,%edx
+  80265f:	03 13                	add    (%ebx),%edx
+  802661:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802664:	8b 73 04             	mov    0x4(%ebx),%esi
+  802667:	29 c6                	sub    %eax,%esi
+  802669:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  80266e:	29 f9                	sub    %edi,%ecx
+  802670:	39 ce                	cmp    %ecx,%esi
+  802672:	89 ca                	mov    %ecx,%edx
+  802674:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802677:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80267a:	89 f9                	mov    %edi,%ecx
+  80267c:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802682:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802685:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80268a:	09 c8                	or     %ecx,%eax
+  80268c:	0f 85 4d ff ff ff    	jne    8025df <nsipc_sendmsg+0x6f>
+  802692:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802698:	0f 86 41 ff ff ff    	jbe    8025df <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80269e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8026a4:	85 ff                	test   %edi,%edi
+  8026a6:	0f 49 c7             	cmovns %edi,%eax
+  8026a9:	c1 f8 0c             	sar    $0xc,%eax
+  8026ac:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8026ae:	89 d1                	mov    %edx,%ecx
+  8026b0:	c1 e9 0c             	shr    $0xc,%ecx
+  8026b3:	01 c8                	add    %ecx,%eax
+  8026b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8026b8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026bb:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8026bd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026c0:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8026c5:	29 c8                	sub    %ecx,%eax
+  8026c7:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8026ca:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8026cd:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8026cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026d4:	89 f9                	mov    %edi,%ecx
+  8026d6:	d3 e0                	shl    %cl,%eax
+  8026d8:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8026de:	83 ec 08             	sub    $0x8,%esp
+  8026e1:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8026e3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8026e6:	50                   	push   %eax
+  8026e7:	6a 00                	push   $0x0
+  8026e9:	56                   	push   %esi
+  8026ea:	6a 00                	push   $0x0
+  8026ec:	68 20 60 80 00       	push   $0x806020
+  8026f1:	e8 e4 0e 00 00       	call   8035da <pgbatch_map>
+  8026f6:	83 c4 20             	add    $0x20,%esp
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	0f 88 ce fe ff ff    	js     8025cf <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802701:	83 c7 01             	add    $0x1,%edi
+  802704:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80270a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80270d:	39 c7                	cmp    %eax,%edi
+  80270f:	75 be                	jne    8026cf <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802711:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802714:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802717:	89 d6                	mov    %edx,%esi
+  802719:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80271f:	e9 01 ff ff ff       	jmp    802625 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802724:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802727:	85 db                	test   %ebx,%ebx
+  802729:	0f 45 c3             	cmovne %ebx,%eax
+  80272c:	e9 a6 fe ff ff       	jmp    8025d7 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802731:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802735:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80273c:	e9 f3 fe ff ff       	jmp    802634 <nsipc_sendmsg+0xc4>
+  802741:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802744:	eb 03                	jmp    802749 <nsipc_sendmsg+0x1d9>
+  802746:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802749:	83 ec 0c             	sub    $0xc,%esp
+  80274c:	68 20 60 80 00       	push   $0x806020
+  802751:	e8 d4 0d 00 00       	call   80352a <pgbatch_flush>
+  802756:	83 c4 10             	add    $0x10,%esp
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	78 50                	js     8027ad <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  80275d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802760:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802765:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  80276b:	89 fb                	mov    %edi,%ebx
+  80276d:	29 f3                	sub    %esi,%ebx
+  80276f:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802775:	8b 45 14             	mov    0x14(%ebp),%eax
+  802778:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  80277d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802782:	89 fa                	mov    %edi,%edx
+  802784:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802789:	e8 66 fb ff ff       	call   8022f4 <nsipc_bulk>
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	78 28                	js     8027ba <nsipc_sendmsg+0x24a>
+		sent += r;
+  802792:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802795:	39 c3                	cmp    %eax,%ebx
+  802797:	75 0c                	jne    8027a5 <nsipc_sendmsg+0x235>
+  802799:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80279c:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80279f:	0f 8f f2 fd ff ff    	jg     802597 <nsipc_sendmsg+0x27>
+		sent += r;
+  8027a5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027a8:	e9 2a fe ff ff       	jmp    8025d7 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8027ad:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8027b0:	85 db                	test   %ebx,%ebx
+  8027b2:	0f 45 c3             	cmovne %ebx,%eax
+  8027b5:	e9 1d fe ff ff       	jmp    8025d7 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8027ba:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8027bd:	85 db                	test   %ebx,%ebx
+  8027bf:	0f 45 c3             	cmovne %ebx,%eax
+  8027c2:	e9 10 fe ff ff       	jmp    8025d7 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8027c7:	83 ec 0c             	sub    $0xc,%esp
+  8027ca:	68 20 60 80 00       	push   $0x806020
+  8027cf:	e8 48 0d 00 00       	call   80351c <pgbatch_init>
+  8027d4:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8027d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e1:	e9 63 ff ff ff       	jmp    802749 <nsipc_sendmsg+0x1d9>
+
+008027e6 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	57                   	push   %edi
+  8027ea:	56                   	push   %esi
+  8027eb:	53                   	push   %ebx
+  8027ec:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8027ef:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  8027f6:	0f 84 c8 00 00 00    	je     8028c4 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8027fc:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802803:	0f 84 e4 00 00 00    	je     8028ed <nsipc_sendfile+0x107>
+{
+  802809:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80280e:	89 fb                	mov    %edi,%ebx
+  802810:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802813:	0f 83 f0 00 00 00    	jae    802909 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802819:	89 fa                	mov    %edi,%edx
+  80281b:	03 55 10             	add    0x10(%ebp),%edx
+  80281e:	89 d0                	mov    %edx,%eax
+  802820:	c1 f8 1f             	sar    $0x1f,%eax
+  802823:	c1 e8 14             	shr    $0x14,%eax
+  802826:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802829:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80282f:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802831:	6a 10                	push   $0x10
+  802833:	68 00 20 01 e0       	push   $0xe0012000
+  802838:	52                   	push   %edx
+  802839:	ff 75 0c             	push   0xc(%ebp)
+  80283c:	e8 fe f4 ff ff       	call   801d3f <fmap>
+  802841:	83 c4 10             	add    $0x10,%esp
+  802844:	85 c0                	test   %eax,%eax
+  802846:	0f 8e b8 00 00 00    	jle    802904 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80284c:	39 c6                	cmp    %eax,%esi
+  80284e:	0f 8d b5 00 00 00    	jge    802909 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802854:	29 f0                	sub    %esi,%eax
+  802856:	8b 55 14             	mov    0x14(%ebp),%edx
+  802859:	29 da                	sub    %ebx,%edx
+  80285b:	39 d0                	cmp    %edx,%eax
+  80285d:	89 d3                	mov    %edx,%ebx
+  80285f:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802862:	8b 45 08             	mov    0x8(%ebp),%eax
+  802865:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  80286a:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802870:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802876:	8b 45 18             	mov    0x18(%ebp),%eax
+  802879:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80287e:	83 ec 0c             	sub    $0xc,%esp
+  802881:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802883:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  80288a:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80288d:	83 c0 01             	add    $0x1,%eax
+  802890:	50                   	push   %eax
+  802891:	68 00 10 01 e0       	push   $0xe0011000
+  802896:	6a 11                	push   $0x11
+  802898:	ff 35 24 63 80 00    	push   0x806324
+  80289e:	e8 aa eb ff ff       	call   80144d <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8028a3:	83 c4 1c             	add    $0x1c,%esp
+  8028a6:	6a 00                	push   $0x0
+  8028a8:	6a 00                	push   $0x0
+  8028aa:	6a 00                	push   $0x0
+  8028ac:	e8 d8 e8 ff ff       	call   801189 <ipc_recv>
+  8028b1:	83 c4 10             	add    $0x10,%esp
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	78 5b                	js     802913 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8028b8:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8028ba:	39 c3                	cmp    %eax,%ebx
+  8028bc:	0f 8e 4c ff ff ff    	jle    80280e <nsipc_sendfile+0x28>
+  8028c2:	eb 45                	jmp    802909 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8028c4:	83 ec 04             	sub    $0x4,%esp
+  8028c7:	6a 07                	push   $0x7
+  8028c9:	68 00 10 01 e0       	push   $0xe0011000
+  8028ce:	6a 00                	push   $0x0
+  8028d0:	e8 51 e4 ff ff       	call   800d26 <sys_page_alloc>
+  8028d5:	89 c7                	mov    %eax,%edi
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	78 2b                	js     802909 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8028de:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  8028e5:	00 00 00 
+  8028e8:	e9 0f ff ff ff       	jmp    8027fc <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028ed:	83 ec 0c             	sub    $0xc,%esp
+  8028f0:	6a 03                	push   $0x3
+  8028f2:	e8 8b eb ff ff       	call   801482 <ipc_find_env>
+  8028f7:	a3 24 63 80 00       	mov    %eax,0x806324
+  8028fc:	83 c4 10             	add    $0x10,%esp
+  8028ff:	e9 05 ff ff ff       	jmp    802809 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802904:	85 ff                	test   %edi,%edi
+  802906:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802909:	89 f8                	mov    %edi,%eax
+  80290b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80290e:	5b                   	pop    %ebx
+  80290f:	5e                   	pop    %esi
+  802910:	5f                   	pop    %edi
+  802911:	5d                   	pop    %ebp
+  802912:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802913:	85 ff                	test   %edi,%edi
+  802915:	0f 44 f8             	cmove  %eax,%edi
+  802918:	eb ef                	jmp    802909 <nsipc_sendfile+0x123>
+
+0080291a <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	57                   	push   %edi
+  80291e:	56                   	push   %esi
+  80291f:	53                   	push   %ebx
+  802920:	83 ec 1c             	sub    $0x1c,%esp
+  802923:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802926:	e8 13 f9 ff ff       	call   80223e <nsbulk_map>
+  80292b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	0f 88 ba 00 00 00    	js     8029f0 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802936:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80293a:	0f 8e bb 00 00 00    	jle    8029fb <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802940:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802945:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80294a:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80294f:	89 f8                	mov    %edi,%eax
+  802951:	29 f0                	sub    %esi,%eax
+  802953:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802957:	39 c8                	cmp    %ecx,%eax
+  802959:	0f 47 c1             	cmova  %ecx,%eax
+  80295c:	01 f0                	add    %esi,%eax
+  80295e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802960:	83 c2 01             	add    $0x1,%edx
+  802963:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802966:	7e 07                	jle    80296f <nsipc_recvmsg+0x55>
+  802968:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80296d:	7e e0                	jle    80294f <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80296f:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802975:	c1 fa 0c             	sar    $0xc,%edx
+  802978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297d:	e8 0a f9 ff ff       	call   80228c <nsbulk_own>
+  802982:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802985:	85 c0                	test   %eax,%eax
+  802987:	78 67                	js     8029f0 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298c:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802991:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802997:	8b 45 14             	mov    0x14(%ebp),%eax
+  80299a:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80299f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8029a4:	89 f2                	mov    %esi,%edx
+  8029a6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8029ab:	e8 44 f9 ff ff       	call   8022f4 <nsipc_bulk>
+  8029b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	78 39                	js     8029f0 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8029b7:	39 f0                	cmp    %esi,%eax
+  8029b9:	7f 4a                	jg     802a05 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8029bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c0:	85 c0                	test   %eax,%eax
+  8029c2:	7e 2c                	jle    8029f0 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8029c4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8029c7:	29 fe                	sub    %edi,%esi
+  8029c9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029cc:	39 c6                	cmp    %eax,%esi
+  8029ce:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8029d1:	83 ec 04             	sub    $0x4,%esp
+  8029d4:	56                   	push   %esi
+  8029d5:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8029db:	50                   	push   %eax
+  8029dc:	ff 33                	push   (%ebx)
+  8029de:	e8 bf e0 ff ff       	call   800aa2 <memmove>
+		n += m;
+  8029e3:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8029e5:	83 c3 08             	add    $0x8,%ebx
+  8029e8:	83 c4 10             	add    $0x10,%esp
+  8029eb:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8029ee:	7f d4                	jg     8029c4 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8029f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f6:	5b                   	pop    %ebx
+  8029f7:	5e                   	pop    %esi
+  8029f8:	5f                   	pop    %edi
+  8029f9:	5d                   	pop    %ebp
+  8029fa:	c3                   	ret
+	int r, i, n, len = 0;
+  8029fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802a00:	e9 6a ff ff ff       	jmp    80296f <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802a05:	68 78 3f 80 00       	push   $0x803f78
+  802a0a:	68 81 3f 80 00       	push   $0x803f81
+  802a0f:	68 3b 01 00 00       	push   $0x13b
+  802a14:	68 96 3f 80 00       	push   $0x803f96
+  802a19:	e8 7b 0e 00 00       	call   803899 <_panic>
+
+00802a1e <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	57                   	push   %edi
+  802a22:	56                   	push   %esi
+  802a23:	53                   	push   %ebx
+  802a24:	83 ec 0c             	sub    $0xc,%esp
+  802a27:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802a2a:	8b 75 10             	mov    0x10(%ebp),%esi
+  802a2d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a33:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802a38:	8b 07                	mov    (%edi),%eax
+  802a3a:	a3 04 80 80 00       	mov    %eax,0x808004
+  802a3f:	8b 47 04             	mov    0x4(%edi),%eax
+  802a42:	a3 08 80 80 00       	mov    %eax,0x808008
+  802a47:	8b 47 08             	mov    0x8(%edi),%eax
+  802a4a:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802a4f:	8b 47 0c             	mov    0xc(%edi),%eax
+  802a52:	a3 10 80 80 00       	mov    %eax,0x808010
+  802a57:	8b 47 10             	mov    0x10(%edi),%eax
+  802a5a:	a3 14 80 80 00       	mov    %eax,0x808014
+  802a5f:	8b 47 14             	mov    0x14(%edi),%eax
+  802a62:	a3 18 80 80 00       	mov    %eax,0x808018
+  802a67:	8b 47 18             	mov    0x18(%edi),%eax
+  802a6a:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802a6f:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802a72:	a3 20 80 80 00       	mov    %eax,0x808020
+  802a77:	8b 47 20             	mov    0x20(%edi),%eax
+  802a7a:	a3 24 80 80 00       	mov    %eax,0x808024
+  802a7f:	8b 47 24             	mov    0x24(%edi),%eax
+  802a82:	a3 28 80 80 00       	mov    %eax,0x808028
+  802a87:	8b 47 28             	mov    0x28(%edi),%eax
+  802a8a:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802a8f:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802a92:	a3 30 80 80 00       	mov    %eax,0x808030
+  802a97:	8b 47 30             	mov    0x30(%edi),%eax
+  802a9a:	a3 34 80 80 00       	mov    %eax,0x808034
+  802a9f:	8b 47 34             	mov    0x34(%edi),%eax
+  802aa2:	a3 38 80 80 00       	mov    %eax,0x808038
+  802aa7:	8b 47 38             	mov    0x38(%edi),%eax
+  802aaa:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802aaf:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802ab2:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802ab7:	8b 06                	mov    (%esi),%eax
+  802ab9:	a3 44 80 80 00       	mov    %eax,0x808044
+  802abe:	8b 46 04             	mov    0x4(%esi),%eax
+  802ac1:	a3 48 80 80 00       	mov    %eax,0x808048
+  802ac6:	8b 46 08             	mov    0x8(%esi),%eax
+  802ac9:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802ace:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ad1:	a3 50 80 80 00       	mov    %eax,0x808050
+  802ad6:	8b 46 10             	mov    0x10(%esi),%eax
+  802ad9:	a3 54 80 80 00       	mov    %eax,0x808054
+  802ade:	8b 46 14             	mov    0x14(%esi),%eax
+  802ae1:	a3 58 80 80 00       	mov    %eax,0x808058
+  802ae6:	8b 46 18             	mov    0x18(%esi),%eax
+  802ae9:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802aee:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802af1:	a3 60 80 80 00       	mov    %eax,0x808060
+  802af6:	8b 46 20             	mov    0x20(%esi),%eax
+  802af9:	a3 64 80 80 00       	mov    %eax,0x808064
+  802afe:	8b 46 24             	mov    0x24(%esi),%eax
+  802b01:	a3 68 80 80 00       	mov    %eax,0x808068
+  802b06:	8b 46 28             	mov    0x28(%esi),%eax
+  802b09:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802b0e:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802b11:	a3 70 80 80 00       	mov    %eax,0x808070
+  802b16:	8b 46 30             	mov    0x30(%esi),%eax
+  802b19:	a3 74 80 80 00       	mov    %eax,0x808074
+  802b1e:	8b 46 34             	mov    0x34(%esi),%eax
+  802b21:	a3 78 80 80 00       	mov    %eax,0x808078
+  802b26:	8b 46 38             	mov    0x38(%esi),%eax
+  802b29:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802b2e:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802b31:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802b36:	8b 03                	mov    (%ebx),%eax
+  802b38:	a3 84 80 80 00       	mov    %eax,0x808084
+  802b3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b40:	a3 88 80 80 00       	mov    %eax,0x808088
+  802b45:	8b 43 08             	mov    0x8(%ebx),%eax
+  802b48:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802b4d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802b50:	a3 90 80 80 00       	mov    %eax,0x808090
+  802b55:	8b 43 10             	mov    0x10(%ebx),%eax
+  802b58:	a3 94 80 80 00       	mov    %eax,0x808094
+  802b5d:	8b 43 14             	mov    0x14(%ebx),%eax
+  802b60:	a3 98 80 80 00       	mov    %eax,0x808098
+  802b65:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b68:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802b6d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802b70:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802b75:	8b 43 20             	mov    0x20(%ebx),%eax
+  802b78:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802b7d:	8b 43 24             	mov    0x24(%ebx),%eax
+  802b80:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802b85:	8b 43 28             	mov    0x28(%ebx),%eax
+  802b88:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802b8d:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802b90:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802b95:	8b 43 30             	mov    0x30(%ebx),%eax
+  802b98:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802b9d:	8b 43 34             	mov    0x34(%ebx),%eax
+  802ba0:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802ba5:	8b 43 38             	mov    0x38(%ebx),%eax
+  802ba8:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802bad:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802bb0:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802bb5:	8b 45 18             	mov    0x18(%ebp),%eax
+  802bb8:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802bbd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802bc2:	e8 2b f6 ff ff       	call   8021f2 <nsipc>
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	0f 88 ad 01 00 00    	js     802d7c <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802bcf:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802bd5:	89 17                	mov    %edx,(%edi)
+  802bd7:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802bdd:	89 57 04             	mov    %edx,0x4(%edi)
+  802be0:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802be6:	89 57 08             	mov    %edx,0x8(%edi)
+  802be9:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802bef:	89 57 0c             	mov    %edx,0xc(%edi)
+  802bf2:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802bf8:	89 57 10             	mov    %edx,0x10(%edi)
+  802bfb:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802c01:	89 57 14             	mov    %edx,0x14(%edi)
+  802c04:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802c0a:	89 57 18             	mov    %edx,0x18(%edi)
+  802c0d:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802c13:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802c16:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802c1c:	89 57 20             	mov    %edx,0x20(%edi)
+  802c1f:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802c25:	89 57 24             	mov    %edx,0x24(%edi)
+  802c28:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802c2e:	89 57 28             	mov    %edx,0x28(%edi)
+  802c31:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802c37:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802c3a:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802c40:	89 57 30             	mov    %edx,0x30(%edi)
+  802c43:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802c49:	89 57 34             	mov    %edx,0x34(%edi)
+  802c4c:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802c52:	89 57 38             	mov    %edx,0x38(%edi)
+  802c55:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802c5b:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802c5e:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802c64:	89 16                	mov    %edx,(%esi)
+  802c66:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802c6c:	89 56 04             	mov    %edx,0x4(%esi)
+  802c6f:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802c75:	89 56 08             	mov    %edx,0x8(%esi)
+  802c78:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802c7e:	89 56 0c             	mov    %edx,0xc(%esi)
+  802c81:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802c87:	89 56 10             	mov    %edx,0x10(%esi)
+  802c8a:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802c90:	89 56 14             	mov    %edx,0x14(%esi)
+  802c93:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802c99:	89 56 18             	mov    %edx,0x18(%esi)
+  802c9c:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802ca2:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802ca5:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802cab:	89 56 20             	mov    %edx,0x20(%esi)
+  802cae:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802cb4:	89 56 24             	mov    %edx,0x24(%esi)
+  802cb7:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802cbd:	89 56 28             	mov    %edx,0x28(%esi)
+  802cc0:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802cc6:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802cc9:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802ccf:	89 56 30             	mov    %edx,0x30(%esi)
+  802cd2:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802cd8:	89 56 34             	mov    %edx,0x34(%esi)
+  802cdb:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802ce1:	89 56 38             	mov    %edx,0x38(%esi)
+  802ce4:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802cea:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802ced:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802cf3:	89 13                	mov    %edx,(%ebx)
+  802cf5:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802cfb:	89 53 04             	mov    %edx,0x4(%ebx)
+  802cfe:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802d04:	89 53 08             	mov    %edx,0x8(%ebx)
+  802d07:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802d0d:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802d10:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802d16:	89 53 10             	mov    %edx,0x10(%ebx)
+  802d19:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802d1f:	89 53 14             	mov    %edx,0x14(%ebx)
+  802d22:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802d28:	89 53 18             	mov    %edx,0x18(%ebx)
+  802d2b:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802d31:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802d34:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802d3a:	89 53 20             	mov    %edx,0x20(%ebx)
+  802d3d:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802d43:	89 53 24             	mov    %edx,0x24(%ebx)
+  802d46:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802d4c:	89 53 28             	mov    %edx,0x28(%ebx)
+  802d4f:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802d55:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802d58:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802d5e:	89 53 30             	mov    %edx,0x30(%ebx)
+  802d61:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802d67:	89 53 34             	mov    %edx,0x34(%ebx)
+  802d6a:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802d70:	89 53 38             	mov    %edx,0x38(%ebx)
+  802d73:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802d79:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802d7c:	83 c4 0c             	add    $0xc,%esp
+  802d7f:	5b                   	pop    %ebx
+  802d80:	5e                   	pop    %esi
+  802d81:	5f                   	pop    %edi
+  802d82:	5d                   	pop    %ebp
+  802d83:	c3                   	ret
+
+00802d84 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+  802d87:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802d8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802d92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d95:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802d9a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d9d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802da2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802da7:	e8 46 f4 ff ff       	call   8021f2 <nsipc>
+}
+  802dac:	c9                   	leave
+  802dad:	c3                   	ret
+
+00802dae <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	56                   	push   %esi
+  802db2:	53                   	push   %ebx
+  802db3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802db6:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802dbc:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dbf:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802dc4:	b8 10 00 00 00       	mov    $0x10,%eax
+  802dc9:	e8 24 f4 ff ff       	call   8021f2 <nsipc>
+  802dce:	89 c3                	mov    %eax,%ebx
+  802dd0:	85 c0                	test   %eax,%eax
+  802dd2:	7e 1f                	jle    802df3 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802dd4:	39 c6                	cmp    %eax,%esi
+  802dd6:	7c 24                	jl     802dfc <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802dd8:	83 ec 04             	sub    $0x4,%esp
+  802ddb:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802de2:	50                   	push   %eax
+  802de3:	68 00 80 80 00       	push   $0x808000
+  802de8:	ff 75 08             	push   0x8(%ebp)
+  802deb:	e8 b2 dc ff ff       	call   800aa2 <memmove>
+  802df0:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802df3:	89 d8                	mov    %ebx,%eax
+  802df5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802df8:	5b                   	pop    %ebx
+  802df9:	5e                   	pop    %esi
+  802dfa:	5d                   	pop    %ebp
+  802dfb:	c3                   	ret
+		assert(r <= max);
+  802dfc:	68 ae 3f 80 00       	push   $0x803fae
+  802e01:	68 81 3f 80 00       	push   $0x803f81
+  802e06:	68 6a 01 00 00       	push   $0x16a
+  802e0b:	68 96 3f 80 00       	push   $0x803f96
+  802e10:	e8 84 0a 00 00       	call   803899 <_panic>
+
+00802e15 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e15:	55                   	push   %ebp
+  802e16:	89 e5                	mov    %esp,%ebp
+  802e18:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e1e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802e23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e26:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e2b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e2e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802e33:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e38:	e8 b5 f3 ff ff       	call   8021f2 <nsipc>
+}
+  802e3d:	c9                   	leave
+  802e3e:	c3                   	ret
+
+00802e3f <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e48:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802e4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e52:	e8 9b f3 ff ff       	call   8021f2 <nsipc>
+}
+  802e57:	c9                   	leave
+  802e58:	c3                   	ret
+
+00802e59 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802e59:	55                   	push   %ebp
+  802e5a:	89 e5                	mov    %esp,%ebp
+  802e5c:	53                   	push   %ebx
+  802e5d:	83 ec 04             	sub    $0x4,%esp
+  802e60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802e63:	b8 12 00 00 00       	mov    $0x12,%eax
+  802e68:	e8 85 f3 ff ff       	call   8021f2 <nsipc>
+  802e6d:	85 c0                	test   %eax,%eax
+  802e6f:	78 50                	js     802ec1 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802e71:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802e77:	89 13                	mov    %edx,(%ebx)
+  802e79:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802e7f:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e82:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802e88:	89 53 08             	mov    %edx,0x8(%ebx)
+  802e8b:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802e91:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802e94:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802e9a:	89 53 10             	mov    %edx,0x10(%ebx)
+  802e9d:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802ea3:	89 53 14             	mov    %edx,0x14(%ebx)
+  802ea6:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802eac:	89 53 18             	mov    %edx,0x18(%ebx)
+  802eaf:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802eb5:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802eb8:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802ebe:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802ec1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ec4:	c9                   	leave
+  802ec5:	c3                   	ret
+
+00802ec6 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802ec6:	55                   	push   %ebp
+  802ec7:	89 e5                	mov    %esp,%ebp
+  802ec9:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ecc:	6a 03                	push   $0x3
+  802ece:	e8 af e5 ff ff       	call   801482 <ipc_find_env>
+  802ed3:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802ed8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802edb:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802ee0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802ee5:	e8 08 f3 ff ff       	call   8021f2 <nsipc>
+  802eea:	83 c4 10             	add    $0x10,%esp
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	78 0a                	js     802efb <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802ef1:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802efb:	c9                   	leave
+  802efc:	c3                   	ret
+
+00802efd <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802efd:	55                   	push   %ebp
+  802efe:	89 e5                	mov    %esp,%ebp
+  802f00:	57                   	push   %edi
+  802f01:	56                   	push   %esi
+  802f02:	53                   	push   %ebx
+  802f03:	83 ec 1c             	sub    $0x1c,%esp
+  802f06:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f09:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802f0c:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802f11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f16:	89 e0                	mov    %esp,%eax
+  802f18:	89 f2                	mov    %esi,%edx
+  802f1a:	29 c2                	sub    %eax,%edx
+  802f1c:	89 d0                	mov    %edx,%eax
+  802f1e:	c1 e8 0f             	shr    $0xf,%eax
+  802f21:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802f27:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802f2a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802f31:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802f34:	83 ec 0c             	sub    $0xc,%esp
+  802f37:	ff 75 e0             	push   -0x20(%ebp)
+  802f3a:	e8 a0 09 00 00       	call   8038df <pageref>
+  802f3f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f42:	83 c4 04             	add    $0x4,%esp
+  802f45:	ff 75 dc             	push   -0x24(%ebp)
+  802f48:	e8 92 09 00 00       	call   8038df <pageref>
+  802f4d:	89 e2                	mov    %esp,%edx
+  802f4f:	89 f1                	mov    %esi,%ecx
+  802f51:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802f53:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802f56:	89 ca                	mov    %ecx,%edx
+  802f58:	c1 ea 0f             	shr    $0xf,%edx
+  802f5b:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802f61:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802f64:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802f6b:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f6e:	39 d7                	cmp    %edx,%edi
+  802f70:	74 40                	je     802fb2 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802f72:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f75:	75 9f                	jne    802f16 <_pipeisclosed+0x19>
+  802f77:	89 e2                	mov    %esp,%edx
+  802f79:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802f7e:	29 d0                	sub    %edx,%eax
+  802f80:	89 c2                	mov    %eax,%edx
+  802f82:	c1 ea 0f             	shr    $0xf,%edx
+  802f85:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8f:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f92:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802f99:	8b 40 58             	mov    0x58(%eax),%eax
+  802f9c:	6a 01                	push   $0x1
+  802f9e:	50                   	push   %eax
+  802f9f:	57                   	push   %edi
+  802fa0:	68 b7 3f 80 00       	push   $0x803fb7
+  802fa5:	e8 51 d2 ff ff       	call   8001fb <cprintf>
+  802faa:	83 c4 10             	add    $0x10,%esp
+  802fad:	e9 5f ff ff ff       	jmp    802f11 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802fb2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fb5:	0f 94 c0             	sete   %al
+  802fb8:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbe:	5b                   	pop    %ebx
+  802fbf:	5e                   	pop    %esi
+  802fc0:	5f                   	pop    %edi
+  802fc1:	5d                   	pop    %ebp
+  802fc2:	c3                   	ret
+
+00802fc3 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802fc3:	55                   	push   %ebp
+  802fc4:	89 e5                	mov    %esp,%ebp
+  802fc6:	53                   	push   %ebx
+  802fc7:	83 ec 0c             	sub    $0xc,%esp
+  802fca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802fcd:	53                   	push   %ebx
+  802fce:	6a 00                	push   $0x0
+  802fd0:	e8 d6 dd ff ff       	call   800dab <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802fd5:	89 1c 24             	mov    %ebx,(%esp)
+  802fd8:	e8 f4 e4 ff ff       	call   8014d1 <fd2data>
+  802fdd:	83 c4 08             	add    $0x8,%esp
+  802fe0:	50                   	push   %eax
+  802fe1:	6a 00                	push   $0x0
+  802fe3:	e8 c3 dd ff ff       	call   800dab <sys_page_unmap>
+}
+  802fe8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802feb:	c9                   	leave
+  802fec:	c3                   	ret
+
+00802fed <devpipe_read>:
+{
+  802fed:	55                   	push   %ebp
+  802fee:	89 e5                	mov    %esp,%ebp
+  802ff0:	57                   	push   %edi
+  802ff1:	56                   	push   %esi
+  802ff2:	53                   	push   %ebx
+  802ff3:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802ff6:	ff 75 08             	push   0x8(%ebp)
+  802ff9:	e8 d3 e4 ff ff       	call   8014d1 <fd2data>
+  802ffe:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803000:	8b 70 04             	mov    0x4(%eax),%esi
+  803003:	8b 00                	mov    (%eax),%eax
+  803005:	83 c4 10             	add    $0x10,%esp
+  803008:	39 f0                	cmp    %esi,%eax
+  80300a:	75 36                	jne    803042 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80300c:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80300f:	89 da                	mov    %ebx,%edx
+  803011:	8b 45 08             	mov    0x8(%ebp),%eax
+  803014:	e8 e4 fe ff ff       	call   802efd <_pipeisclosed>
+  803019:	85 c0                	test   %eax,%eax
+  80301b:	0f 85 d4 00 00 00    	jne    8030f5 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803021:	b8 01 00 00 00       	mov    $0x1,%eax
+  803026:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80302a:	83 ec 04             	sub    $0x4,%esp
+  80302d:	6a ff                	push   $0xffffffff
+  80302f:	56                   	push   %esi
+  803030:	57                   	push   %edi
+  803031:	e8 ee e0 ff ff       	call   801124 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803036:	8b 73 04             	mov    0x4(%ebx),%esi
+  803039:	8b 03                	mov    (%ebx),%eax
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	39 c6                	cmp    %eax,%esi
+  803040:	74 cd                	je     80300f <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803042:	8b 73 04             	mov    0x4(%ebx),%esi
+  803045:	8b 03                	mov    (%ebx),%eax
+  803047:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80304d:	29 c6                	sub    %eax,%esi
+  80304f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803054:	f7 e6                	mul    %esi
+  803056:	c1 ea 0c             	shr    $0xc,%edx
+  803059:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80305f:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803061:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803064:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803068:	8b 0b                	mov    (%ebx),%ecx
+  80306a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80306f:	f7 e1                	mul    %ecx
+  803071:	c1 ea 0b             	shr    $0xb,%edx
+  803074:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80307a:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80307c:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803081:	29 cf                	sub    %ecx,%edi
+  803083:	39 f7                	cmp    %esi,%edi
+  803085:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803088:	83 ec 04             	sub    $0x4,%esp
+  80308b:	57                   	push   %edi
+  80308c:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803090:	50                   	push   %eax
+  803091:	ff 75 0c             	push   0xc(%ebp)
+  803094:	e8 09 da ff ff       	call   800aa2 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803099:	83 c4 0c             	add    $0xc,%esp
+  80309c:	89 f0                	mov    %esi,%eax
+  80309e:	29 f8                	sub    %edi,%eax
+  8030a0:	50                   	push   %eax
+  8030a1:	8d 43 10             	lea    0x10(%ebx),%eax
+  8030a4:	50                   	push   %eax
+  8030a5:	89 f8                	mov    %edi,%eax
+  8030a7:	03 45 0c             	add    0xc(%ebp),%eax
+  8030aa:	50                   	push   %eax
+  8030ab:	e8 f2 d9 ff ff       	call   800aa2 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8030b0:	8b 0b                	mov    (%ebx),%ecx
+  8030b2:	01 f1                	add    %esi,%ecx
+  8030b4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030b9:	f7 e1                	mul    %ecx
+  8030bb:	c1 ea 0c             	shr    $0xc,%edx
+  8030be:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8030c4:	29 c1                	sub    %eax,%ecx
+  8030c6:	89 0b                	mov    %ecx,(%ebx)
+  8030c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cd:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8030d1:	83 c4 10             	add    $0x10,%esp
+  8030d4:	85 c0                	test   %eax,%eax
+  8030d6:	75 0a                	jne    8030e2 <devpipe_read+0xf5>
+	return n;
+  8030d8:	89 f0                	mov    %esi,%eax
+}
+  8030da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030dd:	5b                   	pop    %ebx
+  8030de:	5e                   	pop    %esi
+  8030df:	5f                   	pop    %edi
+  8030e0:	5d                   	pop    %ebp
+  8030e1:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8030e2:	83 ec 08             	sub    $0x8,%esp
+  8030e5:	68 00 04 00 00       	push   $0x400
+  8030ea:	53                   	push   %ebx
+  8030eb:	e8 56 e0 ff ff       	call   801146 <sys_futex_wake>
+  8030f0:	83 c4 10             	add    $0x10,%esp
+  8030f3:	eb e3                	jmp    8030d8 <devpipe_read+0xeb>
+			return 0;
+  8030f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030fa:	eb de                	jmp    8030da <devpipe_read+0xed>
+
+008030fc <devpipe_write>:
+{
+  8030fc:	55                   	push   %ebp
+  8030fd:	89 e5                	mov    %esp,%ebp
+  8030ff:	57                   	push   %edi
+  803100:	56                   	push   %esi
+  803101:	53                   	push   %ebx
+  803102:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803105:	ff 75 08             	push   0x8(%ebp)
+  803108:	e8 c4 e3 ff ff       	call   8014d1 <fd2data>
+  80310d:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80310f:	83 c4 10             	add    $0x10,%esp
+  803112:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803119:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80311e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803122:	0f 84 43 01 00 00    	je     80326b <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803128:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80312b:	8b 06                	mov    (%esi),%eax
+  80312d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803133:	29 c1                	sub    %eax,%ecx
+  803135:	89 c8                	mov    %ecx,%eax
+  803137:	f7 e7                	mul    %edi
+  803139:	c1 ea 0c             	shr    $0xc,%edx
+  80313c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803142:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803144:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80314a:	75 52                	jne    80319e <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80314c:	89 f2                	mov    %esi,%edx
+  80314e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803151:	e8 a7 fd ff ff       	call   802efd <_pipeisclosed>
+  803156:	85 c0                	test   %eax,%eax
+  803158:	0f 85 28 01 00 00    	jne    803286 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80315e:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803160:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803163:	8b 06                	mov    (%esi),%eax
+  803165:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80316b:	29 c1                	sub    %eax,%ecx
+  80316d:	89 c8                	mov    %ecx,%eax
+  80316f:	f7 e7                	mul    %edi
+  803171:	c1 ea 0c             	shr    $0xc,%edx
+  803174:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80317a:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80317c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803182:	75 a4                	jne    803128 <devpipe_write+0x2c>
+  803184:	b8 01 00 00 00       	mov    $0x1,%eax
+  803189:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80318d:	83 ec 04             	sub    $0x4,%esp
+  803190:	6a ff                	push   $0xffffffff
+  803192:	53                   	push   %ebx
+  803193:	56                   	push   %esi
+  803194:	e8 8b df ff ff       	call   801124 <sys_futex_wait>
+}
+  803199:	83 c4 10             	add    $0x10,%esp
+  80319c:	eb 8a                	jmp    803128 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80319e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8031a1:	8b 06                	mov    (%esi),%eax
+  8031a3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8031a9:	29 c1                	sub    %eax,%ecx
+  8031ab:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031b0:	f7 e1                	mul    %ecx
+  8031b2:	c1 ea 0c             	shr    $0xc,%edx
+  8031b5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031bb:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8031bd:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8031c2:	89 d8                	mov    %ebx,%eax
+  8031c4:	29 c8                	sub    %ecx,%eax
+  8031c6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8031c9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031cc:	29 ca                	sub    %ecx,%edx
+  8031ce:	39 d0                	cmp    %edx,%eax
+  8031d0:	0f 46 d0             	cmovbe %eax,%edx
+  8031d3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8031d6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8031d9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031de:	f7 e1                	mul    %ecx
+  8031e0:	c1 ea 0b             	shr    $0xb,%edx
+  8031e3:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8031e9:	89 ca                	mov    %ecx,%edx
+  8031eb:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8031ed:	29 d3                	sub    %edx,%ebx
+  8031ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8031f2:	39 c3                	cmp    %eax,%ebx
+  8031f4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8031f7:	83 ec 04             	sub    $0x4,%esp
+  8031fa:	53                   	push   %ebx
+  8031fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031fe:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803201:	51                   	push   %ecx
+  803202:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803206:	50                   	push   %eax
+  803207:	e8 96 d8 ff ff       	call   800aa2 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80320c:	83 c4 0c             	add    $0xc,%esp
+  80320f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803212:	29 d8                	sub    %ebx,%eax
+  803214:	50                   	push   %eax
+  803215:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803218:	01 cb                	add    %ecx,%ebx
+  80321a:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80321d:	53                   	push   %ebx
+  80321e:	8d 46 10             	lea    0x10(%esi),%eax
+  803221:	50                   	push   %eax
+  803222:	e8 7b d8 ff ff       	call   800aa2 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803227:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80322a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80322d:	01 c1                	add    %eax,%ecx
+  80322f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803234:	f7 e1                	mul    %ecx
+  803236:	c1 ea 0c             	shr    $0xc,%edx
+  803239:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80323f:	89 ca                	mov    %ecx,%edx
+  803241:	29 c2                	sub    %eax,%edx
+  803243:	89 56 04             	mov    %edx,0x4(%esi)
+  803246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324b:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80324f:	83 c4 10             	add    $0x10,%esp
+  803252:	85 c0                	test   %eax,%eax
+  803254:	75 1a                	jne    803270 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803256:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803259:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80325c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80325f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803262:	0f 82 c0 fe ff ff    	jb     803128 <devpipe_write+0x2c>
+  803268:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80326b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80326e:	eb 1b                	jmp    80328b <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803270:	83 ec 08             	sub    $0x8,%esp
+  803273:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803278:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80327b:	50                   	push   %eax
+  80327c:	e8 c5 de ff ff       	call   801146 <sys_futex_wake>
+  803281:	83 c4 10             	add    $0x10,%esp
+  803284:	eb d0                	jmp    803256 <devpipe_write+0x15a>
+				return 0;
+  803286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80328e:	5b                   	pop    %ebx
+  80328f:	5e                   	pop    %esi
+  803290:	5f                   	pop    %edi
+  803291:	5d                   	pop    %ebp
+  803292:	c3                   	ret
+
+00803293 <devpipe_stat>:
+{
+  803293:	55                   	push   %ebp
+  803294:	89 e5                	mov    %esp,%ebp
+  803296:	56                   	push   %esi
+  803297:	53                   	push   %ebx
+  803298:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80329b:	83 ec 0c             	sub    $0xc,%esp
+  80329e:	ff 75 08             	push   0x8(%ebp)
+  8032a1:	e8 2b e2 ff ff       	call   8014d1 <fd2data>
+  8032a6:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8032a8:	83 c4 08             	add    $0x8,%esp
+  8032ab:	68 ca 3f 80 00       	push   $0x803fca
+  8032b0:	53                   	push   %ebx
+  8032b1:	e8 3c d6 ff ff       	call   8008f2 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032b6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8032b9:	8b 06                	mov    (%esi),%eax
+  8032bb:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8032c1:	29 c1                	sub    %eax,%ecx
+  8032c3:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8032c8:	89 c8                	mov    %ecx,%eax
+  8032ca:	f7 e2                	mul    %edx
+  8032cc:	c1 ea 0c             	shr    $0xc,%edx
+  8032cf:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032d5:	29 d1                	sub    %edx,%ecx
+  8032d7:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8032dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8032e4:	00 00 00 
+	stat->st_dev = &devpipe;
+  8032e7:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8032ee:	50 80 00 
+}
+  8032f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032f9:	5b                   	pop    %ebx
+  8032fa:	5e                   	pop    %esi
+  8032fb:	5d                   	pop    %ebp
+  8032fc:	c3                   	ret
+
+008032fd <devpipe_poll>:
+{
+  8032fd:	55                   	push   %ebp
+  8032fe:	89 e5                	mov    %esp,%ebp
+  803300:	57                   	push   %edi
+  803301:	56                   	push   %esi
+  803302:	53                   	push   %ebx
+  803303:	83 ec 18             	sub    $0x18,%esp
+  803306:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803309:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80330c:	57                   	push   %edi
+  80330d:	e8 bf e1 ff ff       	call   8014d1 <fd2data>
+  803312:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803314:	83 c4 10             	add    $0x10,%esp
+  803317:	89 f3                	mov    %esi,%ebx
+  803319:	83 e3 01             	and    $0x1,%ebx
+  80331c:	75 27                	jne    803345 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80331e:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803324:	75 48                	jne    80336e <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803326:	89 ca                	mov    %ecx,%edx
+  803328:	89 f8                	mov    %edi,%eax
+  80332a:	e8 ce fb ff ff       	call   802efd <_pipeisclosed>
+  80332f:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803331:	89 d8                	mov    %ebx,%eax
+  803333:	83 c8 10             	or     $0x10,%eax
+  803336:	85 d2                	test   %edx,%edx
+  803338:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80333b:	89 d8                	mov    %ebx,%eax
+  80333d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803340:	5b                   	pop    %ebx
+  803341:	5e                   	pop    %esi
+  803342:	5f                   	pop    %edi
+  803343:	5d                   	pop    %ebp
+  803344:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803345:	8b 58 04             	mov    0x4(%eax),%ebx
+  803348:	8b 00                	mov    (%eax),%eax
+  80334a:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803350:	29 c3                	sub    %eax,%ebx
+  803352:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803357:	89 d8                	mov    %ebx,%eax
+  803359:	f7 e2                	mul    %edx
+  80335b:	c1 ea 0c             	shr    $0xc,%edx
+  80335e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803364:	39 d3                	cmp    %edx,%ebx
+  803366:	0f 95 c3             	setne  %bl
+  803369:	0f b6 db             	movzbl %bl,%ebx
+  80336c:	eb b0                	jmp    80331e <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80336e:	8b 71 04             	mov    0x4(%ecx),%esi
+  803371:	8b 01                	mov    (%ecx),%eax
+  803373:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803379:	29 c6                	sub    %eax,%esi
+  80337b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803380:	89 f0                	mov    %esi,%eax
+  803382:	f7 e2                	mul    %edx
+  803384:	c1 ea 0c             	shr    $0xc,%edx
+  803387:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80338d:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80338f:	89 d8                	mov    %ebx,%eax
+  803391:	83 c8 04             	or     $0x4,%eax
+  803394:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80339a:	0f 42 d8             	cmovb  %eax,%ebx
+  80339d:	eb 87                	jmp    803326 <devpipe_poll+0x29>
+
+0080339f <pipe>:
+{
+  80339f:	55                   	push   %ebp
+  8033a0:	89 e5                	mov    %esp,%ebp
+  8033a2:	56                   	push   %esi
+  8033a3:	53                   	push   %ebx
+  8033a4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8033a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033aa:	50                   	push   %eax
+  8033ab:	e8 38 e1 ff ff       	call   8014e8 <fd_alloc>
+  8033b0:	89 c3                	mov    %eax,%ebx
+  8033b2:	83 c4 10             	add    $0x10,%esp
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	0f 88 23 01 00 00    	js     8034e0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033bd:	83 ec 04             	sub    $0x4,%esp
+  8033c0:	68 07 04 00 00       	push   $0x407
+  8033c5:	ff 75 f4             	push   -0xc(%ebp)
+  8033c8:	6a 00                	push   $0x0
+  8033ca:	e8 57 d9 ff ff       	call   800d26 <sys_page_alloc>
+  8033cf:	89 c3                	mov    %eax,%ebx
+  8033d1:	83 c4 10             	add    $0x10,%esp
+  8033d4:	85 c0                	test   %eax,%eax
+  8033d6:	0f 88 04 01 00 00    	js     8034e0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8033dc:	83 ec 0c             	sub    $0xc,%esp
+  8033df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8033e2:	50                   	push   %eax
+  8033e3:	e8 00 e1 ff ff       	call   8014e8 <fd_alloc>
+  8033e8:	89 c3                	mov    %eax,%ebx
+  8033ea:	83 c4 10             	add    $0x10,%esp
+  8033ed:	85 c0                	test   %eax,%eax
+  8033ef:	0f 88 db 00 00 00    	js     8034d0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033f5:	83 ec 04             	sub    $0x4,%esp
+  8033f8:	68 07 04 00 00       	push   $0x407
+  8033fd:	ff 75 f0             	push   -0x10(%ebp)
+  803400:	6a 00                	push   $0x0
+  803402:	e8 1f d9 ff ff       	call   800d26 <sys_page_alloc>
+  803407:	89 c3                	mov    %eax,%ebx
+  803409:	83 c4 10             	add    $0x10,%esp
+  80340c:	85 c0                	test   %eax,%eax
+  80340e:	0f 88 bc 00 00 00    	js     8034d0 <pipe+0x131>
+	va = fd2data(fd0);
+  803414:	83 ec 0c             	sub    $0xc,%esp
+  803417:	ff 75 f4             	push   -0xc(%ebp)
+  80341a:	e8 b2 e0 ff ff       	call   8014d1 <fd2data>
+  80341f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803421:	83 c4 0c             	add    $0xc,%esp
+  803424:	68 07 04 00 00       	push   $0x407
+  803429:	50                   	push   %eax
+  80342a:	6a 00                	push   $0x0
+  80342c:	e8 f5 d8 ff ff       	call   800d26 <sys_page_alloc>
+  803431:	89 c3                	mov    %eax,%ebx
+  803433:	83 c4 10             	add    $0x10,%esp
+  803436:	85 c0                	test   %eax,%eax
+  803438:	0f 88 82 00 00 00    	js     8034c0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80343e:	83 ec 0c             	sub    $0xc,%esp
+  803441:	ff 75 f0             	push   -0x10(%ebp)
+  803444:	e8 88 e0 ff ff       	call   8014d1 <fd2data>
+  803449:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803450:	50                   	push   %eax
+  803451:	6a 00                	push   $0x0
+  803453:	56                   	push   %esi
+  803454:	6a 00                	push   $0x0
+  803456:	e8 0e d9 ff ff       	call   800d69 <sys_page_map>
+  80345b:	89 c3                	mov    %eax,%ebx
+  80345d:	83 c4 20             	add    $0x20,%esp
+  803460:	85 c0                	test   %eax,%eax
+  803462:	78 4e                	js     8034b2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803464:	a1 60 50 80 00       	mov    0x805060,%eax
+  803469:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80346c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80346e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803471:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803478:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80347b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80347d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803480:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803487:	83 ec 0c             	sub    $0xc,%esp
+  80348a:	ff 75 f4             	push   -0xc(%ebp)
+  80348d:	e8 2f e0 ff ff       	call   8014c1 <fd2num>
+  803492:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803495:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803497:	83 c4 04             	add    $0x4,%esp
+  80349a:	ff 75 f0             	push   -0x10(%ebp)
+  80349d:	e8 1f e0 ff ff       	call   8014c1 <fd2num>
+  8034a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034a5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8034a8:	83 c4 10             	add    $0x10,%esp
+  8034ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034b0:	eb 2e                	jmp    8034e0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8034b2:	83 ec 08             	sub    $0x8,%esp
+  8034b5:	56                   	push   %esi
+  8034b6:	6a 00                	push   $0x0
+  8034b8:	e8 ee d8 ff ff       	call   800dab <sys_page_unmap>
+  8034bd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8034c0:	83 ec 08             	sub    $0x8,%esp
+  8034c3:	ff 75 f0             	push   -0x10(%ebp)
+  8034c6:	6a 00                	push   $0x0
+  8034c8:	e8 de d8 ff ff       	call   800dab <sys_page_unmap>
+  8034cd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8034d0:	83 ec 08             	sub    $0x8,%esp
+  8034d3:	ff 75 f4             	push   -0xc(%ebp)
+  8034d6:	6a 00                	push   $0x0
+  8034d8:	e8 ce d8 ff ff       	call   800dab <sys_page_unmap>
+  8034dd:	83 c4 10             	add    $0x10,%esp
+}
+  8034e0:	89 d8                	mov    %ebx,%eax
+  8034e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034e5:	5b                   	pop    %ebx
+  8034e6:	5e                   	pop    %esi
+  8034e7:	5d                   	pop    %ebp
+  8034e8:	c3                   	ret
+
+008034e9 <pipeisclosed>:
+{
+  8034e9:	55                   	push   %ebp
+  8034ea:	89 e5                	mov    %esp,%ebp
+  8034ec:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034f2:	50                   	push   %eax
+  8034f3:	ff 75 08             	push   0x8(%ebp)
+  8034f6:	e8 3d e0 ff ff       	call   801538 <fd_lookup>
+  8034fb:	83 c4 10             	add    $0x10,%esp
+  8034fe:	85 c0                	test   %eax,%eax
+  803500:	78 18                	js     80351a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803502:	83 ec 0c             	sub    $0xc,%esp
+  803505:	ff 75 f4             	push   -0xc(%ebp)
+  803508:	e8 c4 df ff ff       	call   8014d1 <fd2data>
+  80350d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80350f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803512:	e8 e6 f9 ff ff       	call   802efd <_pipeisclosed>
+  803517:	83 c4 10             	add    $0x10,%esp
+}
+  80351a:	c9                   	leave
+  80351b:	c3                   	ret
+
+0080351c <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80351c:	55                   	push   %ebp
+  80351d:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80351f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803522:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803528:	5d                   	pop    %ebp
+  803529:	c3                   	ret
+
+0080352a <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80352a:	55                   	push   %ebp
+  80352b:	89 e5                	mov    %esp,%ebp
+  80352d:	53                   	push   %ebx
+  80352e:	83 ec 04             	sub    $0x4,%esp
+  803531:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803534:	8b 03                	mov    (%ebx),%eax
+  803536:	85 c0                	test   %eax,%eax
+  803538:	75 05                	jne    80353f <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80353a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80353d:	c9                   	leave
+  80353e:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80353f:	83 ec 08             	sub    $0x8,%esp
+  803542:	50                   	push   %eax
+  803543:	8d 43 04             	lea    0x4(%ebx),%eax
+  803546:	50                   	push   %eax
+  803547:	e8 af da ff ff       	call   800ffb <sys_page_batch>
+	pb->pb_n = 0;
+  80354c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	eb e3                	jmp    80353a <pgbatch_flush+0x10>
+
+00803557 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803557:	55                   	push   %ebp
+  803558:	89 e5                	mov    %esp,%ebp
+  80355a:	56                   	push   %esi
+  80355b:	53                   	push   %ebx
+  80355c:	89 c3                	mov    %eax,%ebx
+  80355e:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803560:	83 38 20             	cmpl   $0x20,(%eax)
+  803563:	74 2c                	je     803591 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803565:	8b 03                	mov    (%ebx),%eax
+  803567:	8d 50 01             	lea    0x1(%eax),%edx
+  80356a:	89 13                	mov    %edx,(%ebx)
+  80356c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80356f:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803573:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803575:	83 ec 04             	sub    $0x4,%esp
+  803578:	6a 18                	push   $0x18
+  80357a:	6a 00                	push   $0x0
+  80357c:	50                   	push   %eax
+  80357d:	e8 eb d4 ff ff       	call   800a6d <memset>
+	return 0;
+  803582:	83 c4 10             	add    $0x10,%esp
+  803585:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80358a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80358d:	5b                   	pop    %ebx
+  80358e:	5e                   	pop    %esi
+  80358f:	5d                   	pop    %ebp
+  803590:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803591:	83 ec 0c             	sub    $0xc,%esp
+  803594:	50                   	push   %eax
+  803595:	e8 90 ff ff ff       	call   80352a <pgbatch_flush>
+  80359a:	83 c4 10             	add    $0x10,%esp
+  80359d:	85 c0                	test   %eax,%eax
+  80359f:	79 c4                	jns    803565 <pgbatch_slot+0xe>
+  8035a1:	eb e7                	jmp    80358a <pgbatch_slot+0x33>
+
+008035a3 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8035a3:	55                   	push   %ebp
+  8035a4:	89 e5                	mov    %esp,%ebp
+  8035a6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035a9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8035ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035af:	e8 a3 ff ff ff       	call   803557 <pgbatch_slot>
+  8035b4:	85 c0                	test   %eax,%eax
+  8035b6:	78 20                	js     8035d8 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8035b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035bb:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8035c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035c4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8035c7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035ca:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8035cd:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035d0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+
+008035da <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8035da:	55                   	push   %ebp
+  8035db:	89 e5                	mov    %esp,%ebp
+  8035dd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035e0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8035e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e6:	e8 6c ff ff ff       	call   803557 <pgbatch_slot>
+  8035eb:	85 c0                	test   %eax,%eax
+  8035ed:	78 2c                	js     80361b <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8035ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035f2:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8035f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035fb:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8035fe:	8b 55 10             	mov    0x10(%ebp),%edx
+  803601:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803604:	8b 55 14             	mov    0x14(%ebp),%edx
+  803607:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80360a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80360d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803610:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803613:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803616:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80361b:	c9                   	leave
+  80361c:	c3                   	ret
+
+0080361d <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80361d:	55                   	push   %ebp
+  80361e:	89 e5                	mov    %esp,%ebp
+  803620:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803623:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803626:	8b 45 08             	mov    0x8(%ebp),%eax
+  803629:	e8 29 ff ff ff       	call   803557 <pgbatch_slot>
+  80362e:	85 c0                	test   %eax,%eax
+  803630:	78 1a                	js     80364c <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803635:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80363b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80363e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803641:	8b 55 10             	mov    0x10(%ebp),%edx
+  803644:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803647:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80364c:	c9                   	leave
+  80364d:	c3                   	ret
+
+0080364e <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80364e:	55                   	push   %ebp
+  80364f:	89 e5                	mov    %esp,%ebp
+  803651:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803654:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803657:	8b 45 08             	mov    0x8(%ebp),%eax
+  80365a:	e8 f8 fe ff ff       	call   803557 <pgbatch_slot>
+  80365f:	85 c0                	test   %eax,%eax
+  803661:	78 20                	js     803683 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803663:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803666:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80366c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80366f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803672:	8b 55 10             	mov    0x10(%ebp),%edx
+  803675:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803678:	8b 55 14             	mov    0x14(%ebp),%edx
+  80367b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80367e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803683:	c9                   	leave
+  803684:	c3                   	ret
+
+00803685 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803685:	55                   	push   %ebp
+  803686:	89 e5                	mov    %esp,%ebp
+  803688:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80368b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80368e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803691:	e8 c1 fe ff ff       	call   803557 <pgbatch_slot>
+  803696:	85 c0                	test   %eax,%eax
+  803698:	78 26                	js     8036c0 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80369a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80369d:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8036a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036a6:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8036a9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036ac:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8036af:	8b 55 14             	mov    0x14(%ebp),%edx
+  8036b2:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8036b5:	8b 55 18             	mov    0x18(%ebp),%edx
+  8036b8:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8036bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036c0:	c9                   	leave
+  8036c1:	c3                   	ret
+
+008036c2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8036c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c7:	c3                   	ret
+
+008036c8 <devcons_poll>:
+{
+  8036c8:	55                   	push   %ebp
+  8036c9:	89 e5                	mov    %esp,%ebp
+  8036cb:	53                   	push   %ebx
+  8036cc:	83 ec 04             	sub    $0x4,%esp
+  8036cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8036d2:	89 da                	mov    %ebx,%edx
+  8036d4:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8036d7:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  8036de:	74 0c                	je     8036ec <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8036e0:	89 d8                	mov    %ebx,%eax
+  8036e2:	83 e0 01             	and    $0x1,%eax
+  8036e5:	09 d0                	or     %edx,%eax
+}
+  8036e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036ea:	c9                   	leave
+  8036eb:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8036ec:	e8 97 d5 ff ff       	call   800c88 <sys_cgetc>
+  8036f1:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8036f6:	89 da                	mov    %ebx,%edx
+  8036f8:	83 e2 04             	and    $0x4,%edx
+  8036fb:	85 c0                	test   %eax,%eax
+  8036fd:	74 e6                	je     8036e5 <devcons_poll+0x1d>
+  8036ff:	eb df                	jmp    8036e0 <devcons_poll+0x18>
+
+00803701 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803701:	55                   	push   %ebp
+  803702:	89 e5                	mov    %esp,%ebp
+  803704:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803707:	68 d6 3f 80 00       	push   $0x803fd6
+  80370c:	ff 75 0c             	push   0xc(%ebp)
+  80370f:	e8 de d1 ff ff       	call   8008f2 <strcpy>
+	return 0;
+}
+  803714:	b8 00 00 00 00       	mov    $0x0,%eax
+  803719:	c9                   	leave
+  80371a:	c3                   	ret
+
+0080371b <devcons_write>:
+{
+  80371b:	55                   	push   %ebp
+  80371c:	89 e5                	mov    %esp,%ebp
+  80371e:	57                   	push   %edi
+  80371f:	56                   	push   %esi
+  803720:	53                   	push   %ebx
+  803721:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803727:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80372a:	85 ff                	test   %edi,%edi
+  80372c:	74 51                	je     80377f <devcons_write+0x64>
+  80372e:	be 00 00 00 00       	mov    $0x0,%esi
+  803733:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803738:	89 fb                	mov    %edi,%ebx
+  80373a:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80373c:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803741:	39 d3                	cmp    %edx,%ebx
+  803743:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803746:	83 ec 04             	sub    $0x4,%esp
+  803749:	53                   	push   %ebx
+  80374a:	03 45 0c             	add    0xc(%ebp),%eax
+  80374d:	50                   	push   %eax
+  80374e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803754:	50                   	push   %eax
+  803755:	e8 48 d3 ff ff       	call   800aa2 <memmove>
+		sys_cputs(buf, m);
+  80375a:	83 c4 08             	add    $0x8,%esp
+  80375d:	53                   	push   %ebx
+  80375e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803764:	50                   	push   %eax
+  803765:	e8 00 d5 ff ff       	call   800c6a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80376a:	01 de                	add    %ebx,%esi
+  80376c:	89 f0                	mov    %esi,%eax
+  80376e:	83 c4 10             	add    $0x10,%esp
+  803771:	39 fe                	cmp    %edi,%esi
+  803773:	72 c3                	jb     803738 <devcons_write+0x1d>
+}
+  803775:	89 f0                	mov    %esi,%eax
+  803777:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80377a:	5b                   	pop    %ebx
+  80377b:	5e                   	pop    %esi
+  80377c:	5f                   	pop    %edi
+  80377d:	5d                   	pop    %ebp
+  80377e:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80377f:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803784:	eb ef                	jmp    803775 <devcons_write+0x5a>
+
+00803786 <devcons_read>:
+{
+  803786:	55                   	push   %ebp
+  803787:	89 e5                	mov    %esp,%ebp
+  803789:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803791:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803795:	74 36                	je     8037cd <devcons_read+0x47>
+	c = cons_peek;
+  803797:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  80379c:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8037a3:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8037a6:	85 c0                	test   %eax,%eax
+  8037a8:	75 10                	jne    8037ba <devcons_read+0x34>
+  8037aa:	e8 d9 d4 ff ff       	call   800c88 <sys_cgetc>
+  8037af:	85 c0                	test   %eax,%eax
+  8037b1:	75 07                	jne    8037ba <devcons_read+0x34>
+		sys_yield();
+  8037b3:	e8 4f d5 ff ff       	call   800d07 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8037b8:	eb f0                	jmp    8037aa <devcons_read+0x24>
+	if (c < 0)
+  8037ba:	85 c0                	test   %eax,%eax
+  8037bc:	78 0f                	js     8037cd <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8037be:	83 f8 04             	cmp    $0x4,%eax
+  8037c1:	74 0c                	je     8037cf <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8037c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037c6:	88 02                	mov    %al,(%edx)
+	return 1;
+  8037c8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8037cd:	c9                   	leave
+  8037ce:	c3                   	ret
+		return 0;
+  8037cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d4:	eb f7                	jmp    8037cd <devcons_read+0x47>
+
+008037d6 <cputchar>:
+{
+  8037d6:	55                   	push   %ebp
+  8037d7:	89 e5                	mov    %esp,%ebp
+  8037d9:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8037dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037df:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8037e2:	6a 01                	push   $0x1
+  8037e4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8037e7:	50                   	push   %eax
+  8037e8:	e8 7d d4 ff ff       	call   800c6a <sys_cputs>
+}
+  8037ed:	83 c4 10             	add    $0x10,%esp
+  8037f0:	c9                   	leave
+  8037f1:	c3                   	ret
+
+008037f2 <getchar>:
+{
+  8037f2:	55                   	push   %ebp
+  8037f3:	89 e5                	mov    %esp,%ebp
+  8037f5:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8037f8:	6a 01                	push   $0x1
+  8037fa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8037fd:	50                   	push   %eax
+  8037fe:	6a 00                	push   $0x0
+  803800:	e8 b7 df ff ff       	call   8017bc <read>
+	if (r < 0)
+  803805:	83 c4 10             	add    $0x10,%esp
+  803808:	85 c0                	test   %eax,%eax
+  80380a:	78 06                	js     803812 <getchar+0x20>
+	if (r < 1)
+  80380c:	74 06                	je     803814 <getchar+0x22>
+	return c;
+  80380e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803812:	c9                   	leave
+  803813:	c3                   	ret
+		return -E_EOF;
+  803814:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803819:	eb f7                	jmp    803812 <getchar+0x20>
+
+0080381b <iscons>:
+{
+  80381b:	55                   	push   %ebp
+  80381c:	89 e5                	mov    %esp,%ebp
+  80381e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803821:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803824:	50                   	push   %eax
+  803825:	ff 75 08             	push   0x8(%ebp)
+  803828:	e8 0b dd ff ff       	call   801538 <fd_lookup>
+  80382d:	83 c4 10             	add    $0x10,%esp
+  803830:	85 c0                	test   %eax,%eax
+  803832:	78 11                	js     803845 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803834:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803837:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80383d:	39 10                	cmp    %edx,(%eax)
+  80383f:	0f 94 c0             	sete   %al
+  803842:	0f b6 c0             	movzbl %al,%eax
+}
+  803845:	c9                   	leave
+  803846:	c3                   	ret
+
+00803847 <opencons>:
+{
+  803847:	55                   	push   %ebp
+  803848:	89 e5                	mov    %esp,%ebp
+  80384a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80384d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803850:	50                   	push   %eax
+  803851:	e8 92 dc ff ff       	call   8014e8 <fd_alloc>
+  803856:	83 c4 10             	add    $0x10,%esp
+  803859:	85 c0                	test   %eax,%eax
+  80385b:	78 3a                	js     803897 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80385d:	83 ec 04             	sub    $0x4,%esp
+  803860:	68 07 04 00 00       	push   $0x407
+  803865:	ff 75 f4             	push   -0xc(%ebp)
+  803868:	6a 00                	push   $0x0
+  80386a:	e8 b7 d4 ff ff       	call   800d26 <sys_page_alloc>
+  80386f:	83 c4 10             	add    $0x10,%esp
+  803872:	85 c0                	test   %eax,%eax
+  803874:	78 21                	js     803897 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803879:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80387f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803881:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803884:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80388b:	83 ec 0c             	sub    $0xc,%esp
+  80388e:	50                   	push   %eax
+  80388f:	e8 2d dc ff ff       	call   8014c1 <fd2num>
+  803894:	83 c4 10             	add    $0x10,%esp
+}
+  803897:	c9                   	leave
+  803898:	c3                   	ret
+
+00803899 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803899:	55                   	push   %ebp
+  80389a:	89 e5                	mov    %esp,%ebp
+  80389c:	56                   	push   %esi
+  80389d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80389e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8038a1:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8038a7:	e8 3c d4 ff ff       	call   800ce8 <sys_getenvid>
+  8038ac:	83 ec 0c             	sub    $0xc,%esp
+  8038af:	ff 75 0c             	push   0xc(%ebp)
+  8038b2:	ff 75 08             	push   0x8(%ebp)
+  8038b5:	56                   	push   %esi
+  8038b6:	50                   	push   %eax
+  8038b7:	68 e4 3f 80 00       	push   $0x803fe4
+  8038bc:	e8 3a c9 ff ff       	call   8001fb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8038c1:	83 c4 18             	add    $0x18,%esp
+  8038c4:	53                   	push   %ebx
+  8038c5:	ff 75 10             	push   0x10(%ebp)
+  8038c8:	e8 dd c8 ff ff       	call   8001aa <vcprintf>
+	cprintf("\n");
+  8038cd:	c7 04 24 c8 3f 80 00 	movl   $0x803fc8,(%esp)
+  8038d4:	e8 22 c9 ff ff       	call   8001fb <cprintf>
+  8038d9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8038dc:	cc                   	int3
+	while (1)
+  8038dd:	eb fd                	jmp    8038dc <_panic+0x43>
+
+008038df <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8038df:	55                   	push   %ebp
+  8038e0:	89 e5                	mov    %esp,%ebp
+  8038e2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8038e5:	89 c2                	mov    %eax,%edx
+  8038e7:	c1 ea 16             	shr    $0x16,%edx
+  8038ea:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8038f1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8038f6:	f6 c1 01             	test   $0x1,%cl
+  8038f9:	74 1e                	je     803919 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8038fb:	c1 e8 0c             	shr    $0xc,%eax
+  8038fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803905:	a8 01                	test   $0x1,%al
+  803907:	74 10                	je     803919 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803909:	c1 e8 0c             	shr    $0xc,%eax
+  80390c:	c1 e0 04             	shl    $0x4,%eax
+  80390f:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803916:	0f b7 d2             	movzwl %dx,%edx
+}
+  803919:	89 d0                	mov    %edx,%eax
+  80391b:	5d                   	pop    %ebp
+  80391c:	c3                   	ret
+
+0080391d <__udivdi3>:
+  80391d:	57                   	push   %edi
+  80391e:	56                   	push   %esi
+  80391f:	53                   	push   %ebx
+  803920:	83 ec 20             	sub    $0x20,%esp
+  803923:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803927:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80392b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80392f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803933:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803937:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80393b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80393f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803943:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803952:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803959:	00 
+  80395a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803961:	00 
+  803962:	eb 08                	jmp    80396c <__udivdi3+0x4f>
+  803964:	83 e9 01             	sub    $0x1,%ecx
+  803967:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80396a:	74 68                	je     8039d4 <__udivdi3+0xb7>
+  80396c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803970:	01 c0                	add    %eax,%eax
+  803972:	89 c6                	mov    %eax,%esi
+  803974:	89 d7                	mov    %edx,%edi
+  803976:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80397a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80397e:	0f ad d0             	shrd   %cl,%edx,%eax
+  803981:	d3 ea                	shr    %cl,%edx
+  803983:	f6 c1 20             	test   $0x20,%cl
+  803986:	74 04                	je     80398c <__udivdi3+0x6f>
+  803988:	89 d0                	mov    %edx,%eax
+  80398a:	31 d2                	xor    %edx,%edx
+  80398c:	83 e0 01             	and    $0x1,%eax
+  80398f:	89 04 24             	mov    %eax,(%esp)
+  803992:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803999:	00 
+  80399a:	8b 04 24             	mov    (%esp),%eax
+  80399d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039a1:	09 f0                	or     %esi,%eax
+  8039a3:	09 fa                	or     %edi,%edx
+  8039a5:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039a9:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039ad:	39 f0                	cmp    %esi,%eax
+  8039af:	89 d3                	mov    %edx,%ebx
+  8039b1:	19 fb                	sbb    %edi,%ebx
+  8039b3:	72 af                	jb     803964 <__udivdi3+0x47>
+  8039b5:	29 f0                	sub    %esi,%eax
+  8039b7:	19 fa                	sbb    %edi,%edx
+  8039b9:	89 cf                	mov    %ecx,%edi
+  8039bb:	c1 ef 05             	shr    $0x5,%edi
+  8039be:	83 e7 01             	and    $0x1,%edi
+  8039c1:	89 fe                	mov    %edi,%esi
+  8039c3:	83 f6 01             	xor    $0x1,%esi
+  8039c6:	d3 e6                	shl    %cl,%esi
+  8039c8:	d3 e7                	shl    %cl,%edi
+  8039ca:	09 74 24 18          	or     %esi,0x18(%esp)
+  8039ce:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8039d2:	eb 90                	jmp    803964 <__udivdi3+0x47>
+  8039d4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039d8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039dc:	83 c4 20             	add    $0x20,%esp
+  8039df:	5b                   	pop    %ebx
+  8039e0:	5e                   	pop    %esi
+  8039e1:	5f                   	pop    %edi
+  8039e2:	c3                   	ret
+
+008039e3 <__umoddi3>:
+  8039e3:	57                   	push   %edi
+  8039e4:	56                   	push   %esi
+  8039e5:	53                   	push   %ebx
+  8039e6:	83 ec 08             	sub    $0x8,%esp
+  8039e9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039ed:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039f1:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8039f5:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8039f9:	57                   	push   %edi
+  8039fa:	56                   	push   %esi
+  8039fb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039ff:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a03:	52                   	push   %edx
+  803a04:	50                   	push   %eax
+  803a05:	e8 13 ff ff ff       	call   80391d <__udivdi3>
+  803a0a:	89 c3                	mov    %eax,%ebx
+  803a0c:	0f af d6             	imul   %esi,%edx
+  803a0f:	89 f9                	mov    %edi,%ecx
+  803a11:	0f af cb             	imul   %ebx,%ecx
+  803a14:	01 d1                	add    %edx,%ecx
+  803a16:	89 d8                	mov    %ebx,%eax
+  803a18:	f7 e6                	mul    %esi
+  803a1a:	89 c6                	mov    %eax,%esi
+  803a1c:	89 d7                	mov    %edx,%edi
+  803a1e:	01 cf                	add    %ecx,%edi
+  803a20:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a24:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a28:	29 f0                	sub    %esi,%eax
+  803a2a:	19 fa                	sbb    %edi,%edx
+  803a2c:	83 c4 18             	add    $0x18,%esp
+  803a2f:	5b                   	pop    %ebx
+  803a30:	5e                   	pop    %esi
+  803a31:	5f                   	pop    %edi
+  803a32:	c3                   	ret
+
+00803a33 <__divdi3>:
+  803a33:	53                   	push   %ebx
+  803a34:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a38:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a3c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a40:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a44:	85 d2                	test   %edx,%edx
+  803a46:	78 12                	js     803a5a <__divdi3+0x27>
+  803a48:	85 db                	test   %ebx,%ebx
+  803a4a:	78 2e                	js     803a7a <__divdi3+0x47>
+  803a4c:	53                   	push   %ebx
+  803a4d:	51                   	push   %ecx
+  803a4e:	52                   	push   %edx
+  803a4f:	50                   	push   %eax
+  803a50:	e8 c8 fe ff ff       	call   80391d <__udivdi3>
+  803a55:	83 c4 10             	add    $0x10,%esp
+  803a58:	eb 1e                	jmp    803a78 <__divdi3+0x45>
+  803a5a:	f7 d8                	neg    %eax
+  803a5c:	83 d2 00             	adc    $0x0,%edx
+  803a5f:	f7 da                	neg    %edx
+  803a61:	85 db                	test   %ebx,%ebx
+  803a63:	78 2a                	js     803a8f <__divdi3+0x5c>
+  803a65:	53                   	push   %ebx
+  803a66:	51                   	push   %ecx
+  803a67:	52                   	push   %edx
+  803a68:	50                   	push   %eax
+  803a69:	e8 af fe ff ff       	call   80391d <__udivdi3>
+  803a6e:	83 c4 10             	add    $0x10,%esp
+  803a71:	f7 d8                	neg    %eax
+  803a73:	83 d2 00             	adc    $0x0,%edx
+  803a76:	f7 da                	neg    %edx
+  803a78:	5b                   	pop    %ebx
+  803a79:	c3                   	ret
+  803a7a:	f7 d9                	neg    %ecx
+  803a7c:	83 d3 00             	adc    $0x0,%ebx
+  803a7f:	f7 db                	neg    %ebx
+  803a81:	53                   	push   %ebx
+  803a82:	51                   	push   %ecx
+  803a83:	52                   	push   %edx
+  803a84:	50                   	push   %eax
+  803a85:	e8 93 fe ff ff       	call   80391d <__udivdi3>
+  803a8a:	83 c4 10             	add    $0x10,%esp
+  803a8d:	eb e2                	jmp    803a71 <__divdi3+0x3e>
+  803a8f:	f7 d9                	neg    %ecx
+  803a91:	83 d3 00             	adc    $0x0,%ebx
+  803a94:	f7 db                	neg    %ebx
+  803a96:	53                   	push   %ebx
+  803a97:	51                   	push   %ecx
+  803a98:	52                   	push   %edx
+  803a99:	50                   	push   %eax
+  803a9a:	e8 7e fe ff ff       	call   80391d <__udivdi3>
+  803a9f:	83 c4 10             	add    $0x10,%esp
+  803aa2:	eb d4                	jmp    803a78 <__divdi3+0x45>
+
+00803aa4 <__moddi3>:
+  803aa4:	57                   	push   %edi
+  803aa5:	56                   	push   %esi
+  803aa6:	53                   	push   %ebx
+  803aa7:	83 ec 08             	sub    $0x8,%esp
+  803aaa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803aae:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ab2:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803ab6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803aba:	57                   	push   %edi
+  803abb:	56                   	push   %esi
+  803abc:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803ac0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803ac4:	52                   	push   %edx
+  803ac5:	50                   	push   %eax
+  803ac6:	e8 68 ff ff ff       	call   803a33 <__divdi3>
+  803acb:	89 c3                	mov    %eax,%ebx
+  803acd:	0f af d6             	imul   %esi,%edx
+  803ad0:	89 f9                	mov    %edi,%ecx
+  803ad2:	0f af cb             	imul   %ebx,%ecx
+  803ad5:	01 d1                	add    %edx,%ecx
+  803ad7:	89 d8                	mov    %ebx,%eax
+  803ad9:	f7 e6                	mul    %esi
+  803adb:	89 c6                	mov    %eax,%esi
+  803add:	89 d7                	mov    %edx,%edi
+  803adf:	01 cf                	add    %ecx,%edi
+  803ae1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803ae5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803ae9:	29 f0                	sub    %esi,%eax
+  803aeb:	19 fa                	sbb    %edi,%edx
+  803aed:	83 c4 18             	add    $0x18,%esp
+  803af0:	5b                   	pop    %ebx
+  803af1:	5e                   	pop    %esi
+  803af2:	5f                   	pop    %edi
+  803af3:	c3                   	ret
@@ -0,0 +1,8016 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9b 00 00 00       	call   8000cc <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003f:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  800041:	53                   	push   %ebx
+  800042:	68 80 3b 80 00       	push   $0x803b80
+  800047:	e8 02 02 00 00       	call   80024e <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004c:	83 c4 0c             	add    $0xc,%esp
+  80004f:	6a 07                	push   $0x7
+  800051:	89 d8                	mov    %ebx,%eax
+  800053:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800058:	50                   	push   %eax
+  800059:	6a 00                	push   $0x0
+  80005b:	e8 19 0d 00 00       	call   800d79 <sys_page_alloc>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 16                	js     80007d <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800067:	53                   	push   %ebx
+  800068:	68 cc 3b 80 00       	push   $0x803bcc
+  80006d:	6a 64                	push   $0x64
+  80006f:	53                   	push   %ebx
+  800070:	e8 6a 08 00 00       	call   8008df <snprintf>
+}
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007b:	c9                   	leave
+  80007c:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	50                   	push   %eax
+  800081:	53                   	push   %ebx
+  800082:	68 a0 3b 80 00       	push   $0x803ba0
+  800087:	6a 0e                	push   $0xe
+  800089:	68 8a 3b 80 00       	push   $0x803b8a
+  80008e:	e8 e0 00 00 00       	call   800173 <_panic>
+
+00800093 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800099:	68 35 00 80 00       	push   $0x800035
+  80009e:	e8 39 11 00 00       	call   8011dc <set_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a3:	83 c4 08             	add    $0x8,%esp
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	68 9c 3b 80 00       	push   $0x803b9c
+  8000b0:	e8 99 01 00 00       	call   80024e <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b5:	83 c4 08             	add    $0x8,%esp
+  8000b8:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bd:	68 9c 3b 80 00       	push   $0x803b9c
+  8000c2:	e8 87 01 00 00       	call   80024e <cprintf>
+}
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	c9                   	leave
+  8000cb:	c3                   	ret
+
+008000cc <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000cc:	55                   	push   %ebp
+  8000cd:	89 e5                	mov    %esp,%ebp
+  8000cf:	56                   	push   %esi
+  8000d0:	53                   	push   %ebx
+  8000d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000d7:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000d9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000de:	29 d0                	sub    %edx,%eax
+  8000e0:	89 c2                	mov    %eax,%edx
+  8000e2:	c1 ea 0f             	shr    $0xf,%edx
+  8000e5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8000f2:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  8000f9:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8000fd:	e8 39 0c 00 00       	call   800d3b <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800102:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800107:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80010d:	89 e1                	mov    %esp,%ecx
+  80010f:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800114:	29 ca                	sub    %ecx,%edx
+  800116:	89 d1                	mov    %edx,%ecx
+  800118:	c1 e9 0f             	shr    $0xf,%ecx
+  80011b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800121:	ba 00 00 00 00       	mov    $0x0,%edx
+  800126:	0f 42 d1             	cmovb  %ecx,%edx
+  800129:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80012e:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800135:	85 db                	test   %ebx,%ebx
+  800137:	7e 07                	jle    800140 <libmain+0x74>
+		binaryname = argv[0];
+  800139:	8b 06                	mov    (%esi),%eax
+  80013b:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	56                   	push   %esi
+  800144:	53                   	push   %ebx
+  800145:	e8 49 ff ff ff       	call   800093 <umain>
+
+	// exit gracefully
+	exit();
+  80014a:	e8 0a 00 00 00       	call   800159 <exit>
+}
+  80014f:	83 c4 10             	add    $0x10,%esp
+  800152:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800155:	5b                   	pop    %ebx
+  800156:	5e                   	pop    %esi
+  800157:	5d                   	pop    %ebp
+  800158:	c3                   	ret
+
+00800159 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800159:	55                   	push   %ebp
+  80015a:	89 e5                	mov    %esp,%ebp
+  80015c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80015f:	e8 c5 12 00 00       	call   801429 <close_all>
+	sys_env_destroy(0);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	6a 00                	push   $0x0
+  800169:	e8 8c 0b 00 00       	call   800cfa <sys_env_destroy>
+}
+  80016e:	83 c4 10             	add    $0x10,%esp
+  800171:	c9                   	leave
+  800172:	c3                   	ret
+
+00800173 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800173:	55                   	push   %ebp
+  800174:	89 e5                	mov    %esp,%ebp
+  800176:	56                   	push   %esi
+  800177:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800178:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80017b:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800181:	e8 b5 0b 00 00       	call   800d3b <sys_getenvid>
+  800186:	83 ec 0c             	sub    $0xc,%esp
+  800189:	ff 75 0c             	push   0xc(%ebp)
+  80018c:	ff 75 08             	push   0x8(%ebp)
+  80018f:	56                   	push   %esi
+  800190:	50                   	push   %eax
+  800191:	68 f8 3b 80 00       	push   $0x803bf8
+  800196:	e8 b3 00 00 00       	call   80024e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80019b:	83 c4 18             	add    $0x18,%esp
+  80019e:	53                   	push   %ebx
+  80019f:	ff 75 10             	push   0x10(%ebp)
+  8001a2:	e8 56 00 00 00       	call   8001fd <vcprintf>
+	cprintf("\n");
+  8001a7:	c7 04 24 70 40 80 00 	movl   $0x804070,(%esp)
+  8001ae:	e8 9b 00 00 00       	call   80024e <cprintf>
+  8001b3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001b6:	cc                   	int3
+	while (1)
+  8001b7:	eb fd                	jmp    8001b6 <_panic+0x43>
+
+008001b9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001b9:	55                   	push   %ebp
+  8001ba:	89 e5                	mov    %esp,%ebp
+  8001bc:	53                   	push   %ebx
+  8001bd:	83 ec 04             	sub    $0x4,%esp
+  8001c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001c3:	8b 13                	mov    (%ebx),%edx
+  8001c5:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c8:	89 03                	mov    %eax,(%ebx)
+  8001ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001cd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001d1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001d6:	74 09                	je     8001e1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001d8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001df:	c9                   	leave
+  8001e0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001e1:	83 ec 08             	sub    $0x8,%esp
+  8001e4:	68 ff 00 00 00       	push   $0xff
+  8001e9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001ec:	50                   	push   %eax
+  8001ed:	e8 cb 0a 00 00       	call   800cbd <sys_cputs>
+		b->idx = 0;
+  8001f2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f8:	83 c4 10             	add    $0x10,%esp
+  8001fb:	eb db                	jmp    8001d8 <putch+0x1f>
+
+008001fd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001fd:	55                   	push   %ebp
+  8001fe:	89 e5                	mov    %esp,%ebp
+  800200:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800206:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80020d:	00 00 00 
+	b.cnt = 0;
+  800210:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800217:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80021a:	ff 75 0c             	push   0xc(%ebp)
+  80021d:	ff 75 08             	push   0x8(%ebp)
+  800220:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800226:	50                   	push   %eax
+  800227:	68 b9 01 80 00       	push   $0x8001b9
+  80022c:	e8 1c 01 00 00       	call   80034d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800231:	83 c4 08             	add    $0x8,%esp
+  800234:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80023a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800240:	50                   	push   %eax
+  800241:	e8 77 0a 00 00       	call   800cbd <sys_cputs>
+
+	return b.cnt;
+}
+  800246:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80024c:	c9                   	leave
+  80024d:	c3                   	ret
+
+0080024e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80024e:	55                   	push   %ebp
+  80024f:	89 e5                	mov    %esp,%ebp
+  800251:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800254:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800257:	50                   	push   %eax
+  800258:	ff 75 08             	push   0x8(%ebp)
+  80025b:	e8 9d ff ff ff       	call   8001fd <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800260:	c9                   	leave
+  800261:	c3                   	ret
+
+00800262 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800262:	55                   	push   %ebp
+  800263:	89 e5                	mov    %esp,%ebp
+  800265:	57                   	push   %edi
+  800266:	56                   	push   %esi
+  800267:	53                   	push   %ebx
+  800268:	83 ec 1c             	sub    $0x1c,%esp
+  80026b:	89 c3                	mov    %eax,%ebx
+  80026d:	89 d6                	mov    %edx,%esi
+  80026f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800272:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800275:	89 d1                	mov    %edx,%ecx
+  800277:	89 c2                	mov    %eax,%edx
+  800279:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80027c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80027f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800282:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800285:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80028c:	39 c2                	cmp    %eax,%edx
+  80028e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800291:	73 4b                	jae    8002de <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800293:	8b 45 14             	mov    0x14(%ebp),%eax
+  800296:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800299:	85 ff                	test   %edi,%edi
+  80029b:	7e 11                	jle    8002ae <printnum+0x4c>
+			putch(padc, putdat);
+  80029d:	83 ec 08             	sub    $0x8,%esp
+  8002a0:	56                   	push   %esi
+  8002a1:	ff 75 18             	push   0x18(%ebp)
+  8002a4:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	83 ef 01             	sub    $0x1,%edi
+  8002ac:	75 ef                	jne    80029d <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002ae:	83 ec 08             	sub    $0x8,%esp
+  8002b1:	56                   	push   %esi
+  8002b2:	83 ec 04             	sub    $0x4,%esp
+  8002b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b8:	ff 75 e0             	push   -0x20(%ebp)
+  8002bb:	ff 75 dc             	push   -0x24(%ebp)
+  8002be:	ff 75 d8             	push   -0x28(%ebp)
+  8002c1:	e8 8e 37 00 00       	call   803a54 <__umoddi3>
+  8002c6:	83 c4 14             	add    $0x14,%esp
+  8002c9:	0f be 80 1b 3c 80 00 	movsbl 0x803c1b(%eax),%eax
+  8002d0:	50                   	push   %eax
+  8002d1:	ff d3                	call   *%ebx
+}
+  8002d3:	83 c4 10             	add    $0x10,%esp
+  8002d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d9:	5b                   	pop    %ebx
+  8002da:	5e                   	pop    %esi
+  8002db:	5f                   	pop    %edi
+  8002dc:	5d                   	pop    %ebp
+  8002dd:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002de:	83 ec 0c             	sub    $0xc,%esp
+  8002e1:	ff 75 18             	push   0x18(%ebp)
+  8002e4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e7:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002ea:	52                   	push   %edx
+  8002eb:	50                   	push   %eax
+  8002ec:	83 ec 08             	sub    $0x8,%esp
+  8002ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f2:	ff 75 e0             	push   -0x20(%ebp)
+  8002f5:	ff 75 dc             	push   -0x24(%ebp)
+  8002f8:	ff 75 d8             	push   -0x28(%ebp)
+  8002fb:	e8 8e 36 00 00       	call   80398e <__udivdi3>
+  800300:	83 c4 18             	add    $0x18,%esp
+  800303:	52                   	push   %edx
+  800304:	50                   	push   %eax
+  800305:	89 f2                	mov    %esi,%edx
+  800307:	89 d8                	mov    %ebx,%eax
+  800309:	e8 54 ff ff ff       	call   800262 <printnum>
+  80030e:	83 c4 20             	add    $0x20,%esp
+  800311:	eb 9b                	jmp    8002ae <printnum+0x4c>
+
+00800313 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800313:	55                   	push   %ebp
+  800314:	89 e5                	mov    %esp,%ebp
+  800316:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800319:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80031d:	8b 10                	mov    (%eax),%edx
+  80031f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800322:	73 0a                	jae    80032e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800324:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800327:	89 08                	mov    %ecx,(%eax)
+  800329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032c:	88 02                	mov    %al,(%edx)
+}
+  80032e:	5d                   	pop    %ebp
+  80032f:	c3                   	ret
+
+00800330 <printfmt>:
+{
+  800330:	55                   	push   %ebp
+  800331:	89 e5                	mov    %esp,%ebp
+  800333:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800336:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800339:	50                   	push   %eax
+  80033a:	ff 75 10             	push   0x10(%ebp)
+  80033d:	ff 75 0c             	push   0xc(%ebp)
+  800340:	ff 75 08             	push   0x8(%ebp)
+  800343:	e8 05 00 00 00       	call   80034d <vprintfmt>
+}
+  800348:	83 c4 10             	add    $0x10,%esp
+  80034b:	c9                   	leave
+  80034c:	c3                   	ret
+
+0080034d <vprintfmt>:
+{
+  80034d:	55                   	push   %ebp
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	57                   	push   %edi
+  800351:	56                   	push   %esi
+  800352:	53                   	push   %ebx
+  800353:	83 ec 2c             	sub    $0x2c,%esp
+  800356:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800359:	89 df                	mov    %ebx,%edi
+  80035b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80035e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800361:	8d 70 01             	lea    0x1(%eax),%esi
+  800364:	0f b6 00             	movzbl (%eax),%eax
+  800367:	83 f8 25             	cmp    $0x25,%eax
+  80036a:	74 1e                	je     80038a <vprintfmt+0x3d>
+			if (ch == '\0')
+  80036c:	85 c0                	test   %eax,%eax
+  80036e:	0f 84 15 05 00 00    	je     800889 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800374:	83 ec 08             	sub    $0x8,%esp
+  800377:	53                   	push   %ebx
+  800378:	50                   	push   %eax
+  800379:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80037b:	83 c6 01             	add    $0x1,%esi
+  80037e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800382:	83 c4 10             	add    $0x10,%esp
+  800385:	83 f8 25             	cmp    $0x25,%eax
+  800388:	75 e2                	jne    80036c <vprintfmt+0x1f>
+		padc = ' ';
+  80038a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80038e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800395:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80039c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8003a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a8:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ab:	8d 56 01             	lea    0x1(%esi),%edx
+  8003ae:	0f b6 0e             	movzbl (%esi),%ecx
+  8003b1:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003b4:	3c 55                	cmp    $0x55,%al
+  8003b6:	0f 87 3b 04 00 00    	ja     8007f7 <vprintfmt+0x4aa>
+  8003bc:	0f b6 c0             	movzbl %al,%eax
+  8003bf:	ff 24 85 80 3d 80 00 	jmp    *0x803d80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8003c6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003c9:	eb 93                	jmp    80035e <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cb:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8003cd:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003d1:	eb d8                	jmp    8003ab <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d3:	89 d6                	mov    %edx,%esi
+  8003d5:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003d9:	eb d0                	jmp    8003ab <vprintfmt+0x5e>
+  8003db:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8003de:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8003e4:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8003e8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003eb:	83 f9 09             	cmp    $0x9,%ecx
+  8003ee:	77 6f                	ja     80045f <vprintfmt+0x112>
+  8003f0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8003f3:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8003f6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003f9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003fd:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800400:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800403:	83 fe 09             	cmp    $0x9,%esi
+  800406:	76 eb                	jbe    8003f3 <vprintfmt+0xa6>
+  800408:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80040b:	89 d6                	mov    %edx,%esi
+  80040d:	eb 13                	jmp    800422 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80040f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800412:	8b 00                	mov    (%eax),%eax
+  800414:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800417:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041a:	8d 40 04             	lea    0x4(%eax),%eax
+  80041d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800420:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800422:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800426:	79 83                	jns    8003ab <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800428:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80042b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80042e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800435:	e9 71 ff ff ff       	jmp    8003ab <vprintfmt+0x5e>
+			if (width < 0)
+  80043a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80043d:	85 c9                	test   %ecx,%ecx
+  80043f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800444:	0f 49 c1             	cmovns %ecx,%eax
+  800447:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044a:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80044c:	e9 5a ff ff ff       	jmp    8003ab <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800451:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800453:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045a:	e9 4c ff ff ff       	jmp    8003ab <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80045f:	89 d6                	mov    %edx,%esi
+  800461:	eb bf                	jmp    800422 <vprintfmt+0xd5>
+			lflag++;
+  800463:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800467:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800469:	e9 3d ff ff ff       	jmp    8003ab <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80046e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800471:	8b 45 14             	mov    0x14(%ebp),%eax
+  800474:	8d 70 04             	lea    0x4(%eax),%esi
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	ff 30                	push   (%eax)
+  80047d:	ff d7                	call   *%edi
+			break;
+  80047f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800482:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800485:	e9 d4 fe ff ff       	jmp    80035e <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80048a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80048d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800490:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800493:	8b 10                	mov    (%eax),%edx
+  800495:	89 d0                	mov    %edx,%eax
+  800497:	f7 d8                	neg    %eax
+  800499:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80049c:	83 f8 12             	cmp    $0x12,%eax
+  80049f:	7f 23                	jg     8004c4 <vprintfmt+0x177>
+  8004a1:	8b 14 85 e0 3e 80 00 	mov    0x803ee0(,%eax,4),%edx
+  8004a8:	85 d2                	test   %edx,%edx
+  8004aa:	74 18                	je     8004c4 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8004ac:	52                   	push   %edx
+  8004ad:	68 3b 40 80 00       	push   $0x80403b
+  8004b2:	53                   	push   %ebx
+  8004b3:	57                   	push   %edi
+  8004b4:	e8 77 fe ff ff       	call   800330 <printfmt>
+  8004b9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bc:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004bf:	e9 9a fe ff ff       	jmp    80035e <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8004c4:	50                   	push   %eax
+  8004c5:	68 33 3c 80 00       	push   $0x803c33
+  8004ca:	53                   	push   %ebx
+  8004cb:	57                   	push   %edi
+  8004cc:	e8 5f fe ff ff       	call   800330 <printfmt>
+  8004d1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d4:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d7:	e9 82 fe ff ff       	jmp    80035e <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004dc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	83 c0 04             	add    $0x4,%eax
+  8004e5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004eb:	8b 00                	mov    (%eax),%eax
+  8004ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004f0:	85 c0                	test   %eax,%eax
+  8004f2:	0f 84 61 03 00 00    	je     800859 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8004f8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004fc:	7e 06                	jle    800504 <vprintfmt+0x1b7>
+  8004fe:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800502:	75 29                	jne    80052d <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800504:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800507:	8d 70 01             	lea    0x1(%eax),%esi
+  80050a:	0f b6 00             	movzbl (%eax),%eax
+  80050d:	0f be d0             	movsbl %al,%edx
+  800510:	85 d2                	test   %edx,%edx
+  800512:	0f 84 bb 00 00 00    	je     8005d3 <vprintfmt+0x286>
+  800518:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80051b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80051e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800521:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800524:	eb 7a                	jmp    8005a0 <vprintfmt+0x253>
+				p = "(null)";
+  800526:	c7 45 d0 2c 3c 80 00 	movl   $0x803c2c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052d:	83 ec 08             	sub    $0x8,%esp
+  800530:	ff 75 d4             	push   -0x2c(%ebp)
+  800533:	ff 75 d0             	push   -0x30(%ebp)
+  800536:	e8 e0 03 00 00       	call   80091b <strnlen>
+  80053b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80053e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800541:	83 c4 10             	add    $0x10,%esp
+  800544:	85 d2                	test   %edx,%edx
+  800546:	0f 8e d6 02 00 00    	jle    800822 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80054c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800550:	83 ec 08             	sub    $0x8,%esp
+  800553:	53                   	push   %ebx
+  800554:	56                   	push   %esi
+  800555:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800557:	83 c4 10             	add    $0x10,%esp
+  80055a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80055e:	75 f0                	jne    800550 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800560:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800563:	8d 70 01             	lea    0x1(%eax),%esi
+  800566:	0f b6 00             	movzbl (%eax),%eax
+  800569:	0f be d0             	movsbl %al,%edx
+  80056c:	85 d2                	test   %edx,%edx
+  80056e:	0f 84 da 02 00 00    	je     80084e <vprintfmt+0x501>
+  800574:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800577:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80057a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80057d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800580:	eb 1e                	jmp    8005a0 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800582:	83 ec 08             	sub    $0x8,%esp
+  800585:	ff 75 0c             	push   0xc(%ebp)
+  800588:	52                   	push   %edx
+  800589:	ff 55 08             	call   *0x8(%ebp)
+  80058c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80058f:	83 eb 01             	sub    $0x1,%ebx
+  800592:	83 c6 01             	add    $0x1,%esi
+  800595:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800599:	0f be d0             	movsbl %al,%edx
+  80059c:	85 d2                	test   %edx,%edx
+  80059e:	74 2a                	je     8005ca <vprintfmt+0x27d>
+  8005a0:	85 ff                	test   %edi,%edi
+  8005a2:	78 05                	js     8005a9 <vprintfmt+0x25c>
+  8005a4:	83 ef 01             	sub    $0x1,%edi
+  8005a7:	78 59                	js     800602 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ad:	74 d3                	je     800582 <vprintfmt+0x235>
+  8005af:	0f be c0             	movsbl %al,%eax
+  8005b2:	83 e8 20             	sub    $0x20,%eax
+  8005b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8005b8:	76 c8                	jbe    800582 <vprintfmt+0x235>
+					putch('?', putdat);
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	ff 75 0c             	push   0xc(%ebp)
+  8005c0:	6a 3f                	push   $0x3f
+  8005c2:	ff 55 08             	call   *0x8(%ebp)
+  8005c5:	83 c4 10             	add    $0x10,%esp
+  8005c8:	eb c5                	jmp    80058f <vprintfmt+0x242>
+  8005ca:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005cd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8005d3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005d6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005da:	7e 1b                	jle    8005f7 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8005dc:	83 ec 08             	sub    $0x8,%esp
+  8005df:	53                   	push   %ebx
+  8005e0:	6a 20                	push   $0x20
+  8005e2:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005e4:	83 c4 10             	add    $0x10,%esp
+  8005e7:	83 ee 01             	sub    $0x1,%esi
+  8005ea:	75 f0                	jne    8005dc <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005ec:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f2:	e9 67 fd ff ff       	jmp    80035e <vprintfmt+0x11>
+  8005f7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fd:	e9 5c fd ff ff       	jmp    80035e <vprintfmt+0x11>
+  800602:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800605:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800608:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80060b:	eb c6                	jmp    8005d3 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80060d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800610:	89 55 10             	mov    %edx,0x10(%ebp)
+  800613:	83 f9 01             	cmp    $0x1,%ecx
+  800616:	7f 1f                	jg     800637 <vprintfmt+0x2ea>
+	else if (lflag)
+  800618:	85 c9                	test   %ecx,%ecx
+  80061a:	74 67                	je     800683 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80061c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061f:	8b 30                	mov    (%eax),%esi
+  800621:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800624:	89 f0                	mov    %esi,%eax
+  800626:	c1 f8 1f             	sar    $0x1f,%eax
+  800629:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8d 40 04             	lea    0x4(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+  800635:	eb 17                	jmp    80064e <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800637:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063a:	8b 50 04             	mov    0x4(%eax),%edx
+  80063d:	8b 00                	mov    (%eax),%eax
+  80063f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800642:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8d 40 08             	lea    0x8(%eax),%eax
+  80064b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80064e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800651:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800654:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800659:	85 c9                	test   %ecx,%ecx
+  80065b:	0f 89 12 01 00 00    	jns    800773 <vprintfmt+0x426>
+				putch('-', putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	53                   	push   %ebx
+  800665:	6a 2d                	push   $0x2d
+  800667:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800669:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80066c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80066f:	f7 da                	neg    %edx
+  800671:	83 d1 00             	adc    $0x0,%ecx
+  800674:	f7 d9                	neg    %ecx
+  800676:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800679:	be 0a 00 00 00       	mov    $0xa,%esi
+  80067e:	e9 f0 00 00 00       	jmp    800773 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8b 30                	mov    (%eax),%esi
+  800688:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80068b:	89 f0                	mov    %esi,%eax
+  80068d:	c1 f8 1f             	sar    $0x1f,%eax
+  800690:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069c:	eb b0                	jmp    80064e <vprintfmt+0x301>
+	if (lflag >= 2)
+  80069e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006a1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a4:	83 f9 01             	cmp    $0x1,%ecx
+  8006a7:	7f 1e                	jg     8006c7 <vprintfmt+0x37a>
+	else if (lflag)
+  8006a9:	85 c9                	test   %ecx,%ecx
+  8006ab:	74 32                	je     8006df <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006bd:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8006c2:	e9 ac 00 00 00       	jmp    800773 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ca:	8b 10                	mov    (%eax),%edx
+  8006cc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d5:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8006da:	e9 94 00 00 00       	jmp    800773 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8b 10                	mov    (%eax),%edx
+  8006e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ef:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8006f4:	eb 7d                	jmp    800773 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8006f6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006f9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006fc:	83 f9 01             	cmp    $0x1,%ecx
+  8006ff:	7f 1b                	jg     80071c <vprintfmt+0x3cf>
+	else if (lflag)
+  800701:	85 c9                	test   %ecx,%ecx
+  800703:	74 2c                	je     800731 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070f:	8d 40 04             	lea    0x4(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800715:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80071a:	eb 57                	jmp    800773 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	8b 48 04             	mov    0x4(%eax),%ecx
+  800724:	8d 40 08             	lea    0x8(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80072f:	eb 42                	jmp    800773 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 10                	mov    (%eax),%edx
+  800736:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073b:	8d 40 04             	lea    0x4(%eax),%eax
+  80073e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800741:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800746:	eb 2b                	jmp    800773 <vprintfmt+0x426>
+			putch('0', putdat);
+  800748:	89 55 10             	mov    %edx,0x10(%ebp)
+  80074b:	83 ec 08             	sub    $0x8,%esp
+  80074e:	53                   	push   %ebx
+  80074f:	6a 30                	push   $0x30
+  800751:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800753:	83 c4 08             	add    $0x8,%esp
+  800756:	53                   	push   %ebx
+  800757:	6a 78                	push   $0x78
+  800759:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8b 10                	mov    (%eax),%edx
+  800760:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800765:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800768:	8d 40 04             	lea    0x4(%eax),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076e:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800773:	83 ec 0c             	sub    $0xc,%esp
+  800776:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80077a:	50                   	push   %eax
+  80077b:	ff 75 e4             	push   -0x1c(%ebp)
+  80077e:	56                   	push   %esi
+  80077f:	51                   	push   %ecx
+  800780:	52                   	push   %edx
+  800781:	89 da                	mov    %ebx,%edx
+  800783:	89 f8                	mov    %edi,%eax
+  800785:	e8 d8 fa ff ff       	call   800262 <printnum>
+			break;
+  80078a:	83 c4 20             	add    $0x20,%esp
+  80078d:	e9 cc fb ff ff       	jmp    80035e <vprintfmt+0x11>
+	if (lflag >= 2)
+  800792:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800795:	89 55 10             	mov    %edx,0x10(%ebp)
+  800798:	83 f9 01             	cmp    $0x1,%ecx
+  80079b:	7f 1b                	jg     8007b8 <vprintfmt+0x46b>
+	else if (lflag)
+  80079d:	85 c9                	test   %ecx,%ecx
+  80079f:	74 2c                	je     8007cd <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 10                	mov    (%eax),%edx
+  8007a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8007b6:	eb bb                	jmp    800773 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c6:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8007cb:	eb a6                	jmp    800773 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 10                	mov    (%eax),%edx
+  8007d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007dd:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8007e2:	eb 8f                	jmp    800773 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8007e4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+  8007ea:	53                   	push   %ebx
+  8007eb:	6a 25                	push   $0x25
+  8007ed:	ff d7                	call   *%edi
+			break;
+  8007ef:	83 c4 10             	add    $0x10,%esp
+  8007f2:	e9 67 fb ff ff       	jmp    80035e <vprintfmt+0x11>
+			putch('%', putdat);
+  8007f7:	83 ec 08             	sub    $0x8,%esp
+  8007fa:	53                   	push   %ebx
+  8007fb:	6a 25                	push   $0x25
+  8007fd:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ff:	83 c4 10             	add    $0x10,%esp
+  800802:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800806:	0f 84 ba fb ff ff    	je     8003c6 <vprintfmt+0x79>
+  80080c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80080f:	89 f0                	mov    %esi,%eax
+  800811:	83 e8 01             	sub    $0x1,%eax
+  800814:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800818:	75 f7                	jne    800811 <vprintfmt+0x4c4>
+  80081a:	89 45 10             	mov    %eax,0x10(%ebp)
+  80081d:	e9 3c fb ff ff       	jmp    80035e <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800822:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800825:	8d 70 01             	lea    0x1(%eax),%esi
+  800828:	0f b6 00             	movzbl (%eax),%eax
+  80082b:	0f be d0             	movsbl %al,%edx
+  80082e:	85 d2                	test   %edx,%edx
+  800830:	74 11                	je     800843 <vprintfmt+0x4f6>
+  800832:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800835:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800838:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80083b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80083e:	e9 5d fd ff ff       	jmp    8005a0 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800843:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+  800849:	e9 10 fb ff ff       	jmp    80035e <vprintfmt+0x11>
+  80084e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800851:	89 45 14             	mov    %eax,0x14(%ebp)
+  800854:	e9 05 fb ff ff       	jmp    80035e <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800859:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80085d:	7e 0a                	jle    800869 <vprintfmt+0x51c>
+  80085f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800863:	0f 85 bd fc ff ff    	jne    800526 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800869:	ba 28 00 00 00       	mov    $0x28,%edx
+  80086e:	b8 28 00 00 00       	mov    $0x28,%eax
+  800873:	be 2d 3c 80 00       	mov    $0x803c2d,%esi
+  800878:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80087b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80087e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800881:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800884:	e9 17 fd ff ff       	jmp    8005a0 <vprintfmt+0x253>
+}
+  800889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80088c:	5b                   	pop    %ebx
+  80088d:	5e                   	pop    %esi
+  80088e:	5f                   	pop    %edi
+  80088f:	5d                   	pop    %ebp
+  800890:	c3                   	ret
+
+00800891 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800891:	55                   	push   %ebp
+  800892:	89 e5                	mov    %esp,%ebp
+  800894:	83 ec 18             	sub    $0x18,%esp
+  800897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80089d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008a0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008a4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008ae:	85 c0                	test   %eax,%eax
+  8008b0:	74 26                	je     8008d8 <vsnprintf+0x47>
+  8008b2:	85 d2                	test   %edx,%edx
+  8008b4:	7e 22                	jle    8008d8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008b6:	ff 75 14             	push   0x14(%ebp)
+  8008b9:	ff 75 10             	push   0x10(%ebp)
+  8008bc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008bf:	50                   	push   %eax
+  8008c0:	68 13 03 80 00       	push   $0x800313
+  8008c5:	e8 83 fa ff ff       	call   80034d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008cd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d3:	83 c4 10             	add    $0x10,%esp
+}
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+		return -E_INVAL;
+  8008d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008dd:	eb f7                	jmp    8008d6 <vsnprintf+0x45>
+
+008008df <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008e5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008e8:	50                   	push   %eax
+  8008e9:	ff 75 10             	push   0x10(%ebp)
+  8008ec:	ff 75 0c             	push   0xc(%ebp)
+  8008ef:	ff 75 08             	push   0x8(%ebp)
+  8008f2:	e8 9a ff ff ff       	call   800891 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008f7:	c9                   	leave
+  8008f8:	c3                   	ret
+
+008008f9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ff:	80 3a 00             	cmpb   $0x0,(%edx)
+  800902:	74 10                	je     800914 <strlen+0x1b>
+  800904:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800909:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80090c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800910:	75 f7                	jne    800909 <strlen+0x10>
+	return n;
+}
+  800912:	5d                   	pop    %ebp
+  800913:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800914:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800919:	eb f7                	jmp    800912 <strlen+0x19>
+
+0080091b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800921:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800924:	85 d2                	test   %edx,%edx
+  800926:	74 16                	je     80093e <strnlen+0x23>
+  800928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800931:	74 09                	je     80093c <strnlen+0x21>
+		n++;
+  800933:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800936:	39 d0                	cmp    %edx,%eax
+  800938:	75 f3                	jne    80092d <strnlen+0x12>
+		n++;
+  80093a:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800943:	eb f7                	jmp    80093c <strnlen+0x21>
+
+00800945 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	53                   	push   %ebx
+  800949:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80094c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80094f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800954:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800958:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80095b:	83 c0 01             	add    $0x1,%eax
+  80095e:	84 d2                	test   %dl,%dl
+  800960:	75 f2                	jne    800954 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800962:	89 c8                	mov    %ecx,%eax
+  800964:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800967:	c9                   	leave
+  800968:	c3                   	ret
+
+00800969 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800969:	55                   	push   %ebp
+  80096a:	89 e5                	mov    %esp,%ebp
+  80096c:	53                   	push   %ebx
+  80096d:	83 ec 10             	sub    $0x10,%esp
+  800970:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800973:	53                   	push   %ebx
+  800974:	e8 80 ff ff ff       	call   8008f9 <strlen>
+  800979:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80097c:	ff 75 0c             	push   0xc(%ebp)
+  80097f:	01 d8                	add    %ebx,%eax
+  800981:	50                   	push   %eax
+  800982:	e8 be ff ff ff       	call   800945 <strcpy>
+	return dst;
+}
+  800987:	89 d8                	mov    %ebx,%eax
+  800989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098c:	c9                   	leave
+  80098d:	c3                   	ret
+
+0080098e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	56                   	push   %esi
+  800992:	53                   	push   %ebx
+  800993:	8b 75 08             	mov    0x8(%ebp),%esi
+  800996:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800999:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80099c:	85 db                	test   %ebx,%ebx
+  80099e:	74 17                	je     8009b7 <strncpy+0x29>
+  8009a0:	01 f3                	add    %esi,%ebx
+  8009a2:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8009a4:	83 c0 01             	add    $0x1,%eax
+  8009a7:	0f b6 0a             	movzbl (%edx),%ecx
+  8009aa:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009ad:	80 f9 01             	cmp    $0x1,%cl
+  8009b0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009b3:	39 c3                	cmp    %eax,%ebx
+  8009b5:	75 ed                	jne    8009a4 <strncpy+0x16>
+	}
+	return ret;
+}
+  8009b7:	89 f0                	mov    %esi,%eax
+  8009b9:	5b                   	pop    %ebx
+  8009ba:	5e                   	pop    %esi
+  8009bb:	5d                   	pop    %ebp
+  8009bc:	c3                   	ret
+
+008009bd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	56                   	push   %esi
+  8009c1:	53                   	push   %ebx
+  8009c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009cb:	89 f0                	mov    %esi,%eax
+  8009cd:	85 db                	test   %ebx,%ebx
+  8009cf:	74 1e                	je     8009ef <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  8009d1:	83 eb 01             	sub    $0x1,%ebx
+  8009d4:	74 16                	je     8009ec <strlcpy+0x2f>
+  8009d6:	01 f3                	add    %esi,%ebx
+  8009d8:	0f b6 0a             	movzbl (%edx),%ecx
+  8009db:	84 c9                	test   %cl,%cl
+  8009dd:	74 0d                	je     8009ec <strlcpy+0x2f>
+			*dst++ = *src++;
+  8009df:	83 c2 01             	add    $0x1,%edx
+  8009e2:	83 c0 01             	add    $0x1,%eax
+  8009e5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  8009e8:	39 d8                	cmp    %ebx,%eax
+  8009ea:	75 ec                	jne    8009d8 <strlcpy+0x1b>
+		*dst = '\0';
+  8009ec:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009ef:	29 f0                	sub    %esi,%eax
+}
+  8009f1:	5b                   	pop    %ebx
+  8009f2:	5e                   	pop    %esi
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+
+008009f5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009fe:	0f b6 01             	movzbl (%ecx),%eax
+  800a01:	84 c0                	test   %al,%al
+  800a03:	74 11                	je     800a16 <strcmp+0x21>
+  800a05:	38 02                	cmp    %al,(%edx)
+  800a07:	75 0d                	jne    800a16 <strcmp+0x21>
+		p++, q++;
+  800a09:	83 c1 01             	add    $0x1,%ecx
+  800a0c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a0f:	0f b6 01             	movzbl (%ecx),%eax
+  800a12:	84 c0                	test   %al,%al
+  800a14:	75 ef                	jne    800a05 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a16:	0f b6 c0             	movzbl %al,%eax
+  800a19:	0f b6 12             	movzbl (%edx),%edx
+  800a1c:	29 d0                	sub    %edx,%eax
+}
+  800a1e:	5d                   	pop    %ebp
+  800a1f:	c3                   	ret
+
+00800a20 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a20:	55                   	push   %ebp
+  800a21:	89 e5                	mov    %esp,%ebp
+  800a23:	53                   	push   %ebx
+  800a24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a2a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a32:	85 d2                	test   %edx,%edx
+  800a34:	74 2e                	je     800a64 <strncmp+0x44>
+  800a36:	0f b6 01             	movzbl (%ecx),%eax
+  800a39:	84 c0                	test   %al,%al
+  800a3b:	74 16                	je     800a53 <strncmp+0x33>
+  800a3d:	3a 03                	cmp    (%ebx),%al
+  800a3f:	75 12                	jne    800a53 <strncmp+0x33>
+		n--, p++, q++;
+  800a41:	83 c1 01             	add    $0x1,%ecx
+  800a44:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a47:	83 ea 01             	sub    $0x1,%edx
+  800a4a:	75 ea                	jne    800a36 <strncmp+0x16>
+		return 0;
+  800a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a51:	eb 11                	jmp    800a64 <strncmp+0x44>
+  800a53:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a58:	85 d2                	test   %edx,%edx
+  800a5a:	74 08                	je     800a64 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a5c:	0f b6 01             	movzbl (%ecx),%eax
+  800a5f:	0f b6 13             	movzbl (%ebx),%edx
+  800a62:	29 d0                	sub    %edx,%eax
+}
+  800a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a67:	c9                   	leave
+  800a68:	c3                   	ret
+
+00800a69 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a73:	0f b6 10             	movzbl (%eax),%edx
+  800a76:	84 d2                	test   %dl,%dl
+  800a78:	74 15                	je     800a8f <strchr+0x26>
+		if (*s == c)
+  800a7a:	38 d1                	cmp    %dl,%cl
+  800a7c:	74 0f                	je     800a8d <strchr+0x24>
+	for (; *s; s++)
+  800a7e:	83 c0 01             	add    $0x1,%eax
+  800a81:	0f b6 10             	movzbl (%eax),%edx
+  800a84:	84 d2                	test   %dl,%dl
+  800a86:	75 f2                	jne    800a7a <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+	return 0;
+  800a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a94:	eb f7                	jmp    800a8d <strchr+0x24>
+
+00800a96 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	53                   	push   %ebx
+  800a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800aa0:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800aa3:	38 d3                	cmp    %dl,%bl
+  800aa5:	74 14                	je     800abb <strfind+0x25>
+  800aa7:	89 d1                	mov    %edx,%ecx
+  800aa9:	84 db                	test   %bl,%bl
+  800aab:	74 0e                	je     800abb <strfind+0x25>
+	for (; *s; s++)
+  800aad:	83 c0 01             	add    $0x1,%eax
+  800ab0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ab3:	38 ca                	cmp    %cl,%dl
+  800ab5:	74 04                	je     800abb <strfind+0x25>
+  800ab7:	84 d2                	test   %dl,%dl
+  800ab9:	75 f2                	jne    800aad <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800abb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abe:	c9                   	leave
+  800abf:	c3                   	ret
+
+00800ac0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	57                   	push   %edi
+  800ac4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800aca:	85 c9                	test   %ecx,%ecx
+  800acc:	74 20                	je     800aee <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ace:	89 f8                	mov    %edi,%eax
+  800ad0:	09 c8                	or     %ecx,%eax
+  800ad2:	a8 03                	test   $0x3,%al
+  800ad4:	75 12                	jne    800ae8 <memset+0x28>
+		c &= 0xFF;
+  800ad6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ada:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ae0:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ae3:	fc                   	cld
+  800ae4:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ae6:	eb 06                	jmp    800aee <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ae8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aeb:	fc                   	cld
+  800aec:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800aee:	89 f8                	mov    %edi,%eax
+  800af0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+
+00800af5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800af5:	55                   	push   %ebp
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	57                   	push   %edi
+  800af9:	56                   	push   %esi
+  800afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b00:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b03:	39 c6                	cmp    %eax,%esi
+  800b05:	73 32                	jae    800b39 <memmove+0x44>
+  800b07:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b0a:	39 d0                	cmp    %edx,%eax
+  800b0c:	73 2b                	jae    800b39 <memmove+0x44>
+		s += n;
+		d += n;
+  800b0e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b11:	89 d6                	mov    %edx,%esi
+  800b13:	09 fe                	or     %edi,%esi
+  800b15:	09 ce                	or     %ecx,%esi
+  800b17:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b1d:	75 0e                	jne    800b2d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b1f:	83 ef 04             	sub    $0x4,%edi
+  800b22:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b25:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b28:	fd                   	std
+  800b29:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b2b:	eb 09                	jmp    800b36 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b2d:	83 ef 01             	sub    $0x1,%edi
+  800b30:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b33:	fd                   	std
+  800b34:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b36:	fc                   	cld
+  800b37:	eb 1a                	jmp    800b53 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b39:	89 f2                	mov    %esi,%edx
+  800b3b:	09 c2                	or     %eax,%edx
+  800b3d:	09 ca                	or     %ecx,%edx
+  800b3f:	f6 c2 03             	test   $0x3,%dl
+  800b42:	75 0a                	jne    800b4e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b44:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b47:	89 c7                	mov    %eax,%edi
+  800b49:	fc                   	cld
+  800b4a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b4c:	eb 05                	jmp    800b53 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b4e:	89 c7                	mov    %eax,%edi
+  800b50:	fc                   	cld
+  800b51:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b53:	5e                   	pop    %esi
+  800b54:	5f                   	pop    %edi
+  800b55:	5d                   	pop    %ebp
+  800b56:	c3                   	ret
+
+00800b57 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b5d:	ff 75 10             	push   0x10(%ebp)
+  800b60:	ff 75 0c             	push   0xc(%ebp)
+  800b63:	ff 75 08             	push   0x8(%ebp)
+  800b66:	e8 8a ff ff ff       	call   800af5 <memmove>
+}
+  800b6b:	c9                   	leave
+  800b6c:	c3                   	ret
+
+00800b6d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	56                   	push   %esi
+  800b71:	53                   	push   %ebx
+  800b72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b75:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b78:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b7b:	85 f6                	test   %esi,%esi
+  800b7d:	74 29                	je     800ba8 <memcmp+0x3b>
+  800b7f:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b81:	0f b6 08             	movzbl (%eax),%ecx
+  800b84:	0f b6 1a             	movzbl (%edx),%ebx
+  800b87:	38 d9                	cmp    %bl,%cl
+  800b89:	75 11                	jne    800b9c <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b8b:	83 c0 01             	add    $0x1,%eax
+  800b8e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b91:	39 c6                	cmp    %eax,%esi
+  800b93:	75 ec                	jne    800b81 <memcmp+0x14>
+	}
+
+	return 0;
+  800b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9a:	eb 08                	jmp    800ba4 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b9c:	0f b6 c1             	movzbl %cl,%eax
+  800b9f:	0f b6 db             	movzbl %bl,%ebx
+  800ba2:	29 d8                	sub    %ebx,%eax
+}
+  800ba4:	5b                   	pop    %ebx
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	c3                   	ret
+	return 0;
+  800ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bad:	eb f5                	jmp    800ba4 <memcmp+0x37>
+
+00800baf <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bb8:	89 c2                	mov    %eax,%edx
+  800bba:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bbd:	39 d0                	cmp    %edx,%eax
+  800bbf:	73 0d                	jae    800bce <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bc1:	38 08                	cmp    %cl,(%eax)
+  800bc3:	74 0d                	je     800bd2 <memfind+0x23>
+	for (; s < ends; s++)
+  800bc5:	83 c0 01             	add    $0x1,%eax
+  800bc8:	39 c2                	cmp    %eax,%edx
+  800bca:	75 f5                	jne    800bc1 <memfind+0x12>
+  800bcc:	eb 06                	jmp    800bd4 <memfind+0x25>
+  800bce:	89 c2                	mov    %eax,%edx
+  800bd0:	eb 02                	jmp    800bd4 <memfind+0x25>
+  800bd2:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800bd4:	89 d0                	mov    %edx,%eax
+  800bd6:	5d                   	pop    %ebp
+  800bd7:	c3                   	ret
+
+00800bd8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	57                   	push   %edi
+  800bdc:	56                   	push   %esi
+  800bdd:	53                   	push   %ebx
+  800bde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800be4:	0f b6 02             	movzbl (%edx),%eax
+  800be7:	3c 20                	cmp    $0x20,%al
+  800be9:	74 04                	je     800bef <strtol+0x17>
+  800beb:	3c 09                	cmp    $0x9,%al
+  800bed:	75 0e                	jne    800bfd <strtol+0x25>
+		s++;
+  800bef:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bf2:	0f b6 02             	movzbl (%edx),%eax
+  800bf5:	3c 20                	cmp    $0x20,%al
+  800bf7:	74 f6                	je     800bef <strtol+0x17>
+  800bf9:	3c 09                	cmp    $0x9,%al
+  800bfb:	74 f2                	je     800bef <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bfd:	3c 2b                	cmp    $0x2b,%al
+  800bff:	74 2a                	je     800c2b <strtol+0x53>
+	int neg = 0;
+  800c01:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c06:	3c 2d                	cmp    $0x2d,%al
+  800c08:	74 2b                	je     800c35 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c0a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c10:	75 0f                	jne    800c21 <strtol+0x49>
+  800c12:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c15:	74 28                	je     800c3f <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c17:	85 db                	test   %ebx,%ebx
+  800c19:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c1e:	0f 44 d8             	cmove  %eax,%ebx
+  800c21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c26:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c29:	eb 46                	jmp    800c71 <strtol+0x99>
+		s++;
+  800c2b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c33:	eb d5                	jmp    800c0a <strtol+0x32>
+		s++, neg = 1;
+  800c35:	83 c2 01             	add    $0x1,%edx
+  800c38:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c3d:	eb cb                	jmp    800c0a <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c3f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c43:	74 0e                	je     800c53 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c45:	85 db                	test   %ebx,%ebx
+  800c47:	75 d8                	jne    800c21 <strtol+0x49>
+		s++, base = 8;
+  800c49:	83 c2 01             	add    $0x1,%edx
+  800c4c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c51:	eb ce                	jmp    800c21 <strtol+0x49>
+		s += 2, base = 16;
+  800c53:	83 c2 02             	add    $0x2,%edx
+  800c56:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c5b:	eb c4                	jmp    800c21 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c5d:	0f be c0             	movsbl %al,%eax
+  800c60:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c63:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c66:	7d 3a                	jge    800ca2 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c68:	83 c2 01             	add    $0x1,%edx
+  800c6b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c6f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c71:	0f b6 02             	movzbl (%edx),%eax
+  800c74:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c77:	89 f3                	mov    %esi,%ebx
+  800c79:	80 fb 09             	cmp    $0x9,%bl
+  800c7c:	76 df                	jbe    800c5d <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c7e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c81:	89 f3                	mov    %esi,%ebx
+  800c83:	80 fb 19             	cmp    $0x19,%bl
+  800c86:	77 08                	ja     800c90 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c88:	0f be c0             	movsbl %al,%eax
+  800c8b:	83 e8 57             	sub    $0x57,%eax
+  800c8e:	eb d3                	jmp    800c63 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c90:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c93:	89 f3                	mov    %esi,%ebx
+  800c95:	80 fb 19             	cmp    $0x19,%bl
+  800c98:	77 08                	ja     800ca2 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c9a:	0f be c0             	movsbl %al,%eax
+  800c9d:	83 e8 37             	sub    $0x37,%eax
+  800ca0:	eb c1                	jmp    800c63 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ca2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ca6:	74 05                	je     800cad <strtol+0xd5>
+		*endptr = (char *) s;
+  800ca8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cab:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800cad:	89 c8                	mov    %ecx,%eax
+  800caf:	f7 d8                	neg    %eax
+  800cb1:	85 ff                	test   %edi,%edi
+  800cb3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cb6:	89 c8                	mov    %ecx,%eax
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5f                   	pop    %edi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+
+00800cbd <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	57                   	push   %edi
+  800cc1:	56                   	push   %esi
+  800cc2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cce:	89 c3                	mov    %eax,%ebx
+  800cd0:	89 c7                	mov    %eax,%edi
+  800cd2:	89 c6                	mov    %eax,%esi
+  800cd4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cd6:	5b                   	pop    %ebx
+  800cd7:	5e                   	pop    %esi
+  800cd8:	5f                   	pop    %edi
+  800cd9:	5d                   	pop    %ebp
+  800cda:	c3                   	ret
+
+00800cdb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	57                   	push   %edi
+  800cdf:	56                   	push   %esi
+  800ce0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ceb:	89 d1                	mov    %edx,%ecx
+  800ced:	89 d3                	mov    %edx,%ebx
+  800cef:	89 d7                	mov    %edx,%edi
+  800cf1:	89 d6                	mov    %edx,%esi
+  800cf3:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5e                   	pop    %esi
+  800cf7:	5f                   	pop    %edi
+  800cf8:	5d                   	pop    %ebp
+  800cf9:	c3                   	ret
+
+00800cfa <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	57                   	push   %edi
+  800cfe:	56                   	push   %esi
+  800cff:	53                   	push   %ebx
+  800d00:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d10:	89 cb                	mov    %ecx,%ebx
+  800d12:	89 cf                	mov    %ecx,%edi
+  800d14:	89 ce                	mov    %ecx,%esi
+  800d16:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d18:	85 c0                	test   %eax,%eax
+  800d1a:	7f 08                	jg     800d24 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1f:	5b                   	pop    %ebx
+  800d20:	5e                   	pop    %esi
+  800d21:	5f                   	pop    %edi
+  800d22:	5d                   	pop    %ebp
+  800d23:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+  800d27:	50                   	push   %eax
+  800d28:	6a 03                	push   $0x3
+  800d2a:	68 4b 3f 80 00       	push   $0x803f4b
+  800d2f:	6a 23                	push   $0x23
+  800d31:	68 68 3f 80 00       	push   $0x803f68
+  800d36:	e8 38 f4 ff ff       	call   800173 <_panic>
+
+00800d3b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d3b:	55                   	push   %ebp
+  800d3c:	89 e5                	mov    %esp,%ebp
+  800d3e:	57                   	push   %edi
+  800d3f:	56                   	push   %esi
+  800d40:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d46:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d4b:	89 d1                	mov    %edx,%ecx
+  800d4d:	89 d3                	mov    %edx,%ebx
+  800d4f:	89 d7                	mov    %edx,%edi
+  800d51:	89 d6                	mov    %edx,%esi
+  800d53:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d55:	5b                   	pop    %ebx
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+
+00800d5a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	57                   	push   %edi
+  800d5e:	56                   	push   %esi
+  800d5f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d65:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d6a:	89 d1                	mov    %edx,%ecx
+  800d6c:	89 d3                	mov    %edx,%ebx
+  800d6e:	89 d7                	mov    %edx,%edi
+  800d70:	89 d6                	mov    %edx,%esi
+  800d72:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d74:	5b                   	pop    %ebx
+  800d75:	5e                   	pop    %esi
+  800d76:	5f                   	pop    %edi
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+
+00800d79 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d82:	be 00 00 00 00       	mov    $0x0,%esi
+  800d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d95:	89 f7                	mov    %esi,%edi
+  800d97:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	7f 08                	jg     800da5 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  800da8:	50                   	push   %eax
+  800da9:	6a 04                	push   $0x4
+  800dab:	68 4b 3f 80 00       	push   $0x803f4b
+  800db0:	6a 23                	push   $0x23
+  800db2:	68 68 3f 80 00       	push   $0x803f68
+  800db7:	e8 b7 f3 ff ff       	call   800173 <_panic>
+
+00800dbc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd6:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dd9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 08                	jg     800de7 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	50                   	push   %eax
+  800deb:	6a 05                	push   $0x5
+  800ded:	68 4b 3f 80 00       	push   $0x803f4b
+  800df2:	6a 23                	push   $0x23
+  800df4:	68 68 3f 80 00       	push   $0x803f68
+  800df9:	e8 75 f3 ff ff       	call   800173 <_panic>
+
+00800dfe <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e12:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e17:	89 df                	mov    %ebx,%edi
+  800e19:	89 de                	mov    %ebx,%esi
+  800e1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1d:	85 c0                	test   %eax,%eax
+  800e1f:	7f 08                	jg     800e29 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	50                   	push   %eax
+  800e2d:	6a 06                	push   $0x6
+  800e2f:	68 4b 3f 80 00       	push   $0x803f4b
+  800e34:	6a 23                	push   $0x23
+  800e36:	68 68 3f 80 00       	push   $0x803f68
+  800e3b:	e8 33 f3 ff ff       	call   800173 <_panic>
+
+00800e40 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+  800e46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e54:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e59:	89 df                	mov    %ebx,%edi
+  800e5b:	89 de                	mov    %ebx,%esi
+  800e5d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e5f:	85 c0                	test   %eax,%eax
+  800e61:	7f 08                	jg     800e6b <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  800e6e:	50                   	push   %eax
+  800e6f:	6a 08                	push   $0x8
+  800e71:	68 4b 3f 80 00       	push   $0x803f4b
+  800e76:	6a 23                	push   $0x23
+  800e78:	68 68 3f 80 00       	push   $0x803f68
+  800e7d:	e8 f1 f2 ff ff       	call   800173 <_panic>
+
+00800e82 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+  800e88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e96:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e9b:	89 df                	mov    %ebx,%edi
+  800e9d:	89 de                	mov    %ebx,%esi
+  800e9f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea1:	85 c0                	test   %eax,%eax
+  800ea3:	7f 08                	jg     800ead <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea8:	5b                   	pop    %ebx
+  800ea9:	5e                   	pop    %esi
+  800eaa:	5f                   	pop    %edi
+  800eab:	5d                   	pop    %ebp
+  800eac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ead:	83 ec 0c             	sub    $0xc,%esp
+  800eb0:	50                   	push   %eax
+  800eb1:	6a 09                	push   $0x9
+  800eb3:	68 4b 3f 80 00       	push   $0x803f4b
+  800eb8:	6a 23                	push   $0x23
+  800eba:	68 68 3f 80 00       	push   $0x803f68
+  800ebf:	e8 af f2 ff ff       	call   800173 <_panic>
+
+00800ec4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	56                   	push   %esi
+  800ec9:	53                   	push   %ebx
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ecd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800edd:	89 df                	mov    %ebx,%edi
+  800edf:	89 de                	mov    %ebx,%esi
+  800ee1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee3:	85 c0                	test   %eax,%eax
+  800ee5:	7f 08                	jg     800eef <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ee7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eea:	5b                   	pop    %ebx
+  800eeb:	5e                   	pop    %esi
+  800eec:	5f                   	pop    %edi
+  800eed:	5d                   	pop    %ebp
+  800eee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+  800ef2:	50                   	push   %eax
+  800ef3:	6a 0a                	push   $0xa
+  800ef5:	68 4b 3f 80 00       	push   $0x803f4b
+  800efa:	6a 23                	push   $0x23
+  800efc:	68 68 3f 80 00       	push   $0x803f68
+  800f01:	e8 6d f2 ff ff       	call   800173 <_panic>
+
+00800f06 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f06:	55                   	push   %ebp
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	57                   	push   %edi
+  800f0a:	56                   	push   %esi
+  800f0b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f12:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f17:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f22:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+
+00800f29 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	56                   	push   %esi
+  800f2e:	53                   	push   %ebx
+  800f2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f3f:	89 cb                	mov    %ecx,%ebx
+  800f41:	89 cf                	mov    %ecx,%edi
+  800f43:	89 ce                	mov    %ecx,%esi
+  800f45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 08                	jg     800f53 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f53:	83 ec 0c             	sub    $0xc,%esp
+  800f56:	50                   	push   %eax
+  800f57:	6a 0d                	push   $0xd
+  800f59:	68 4b 3f 80 00       	push   $0x803f4b
+  800f5e:	6a 23                	push   $0x23
+  800f60:	68 68 3f 80 00       	push   $0x803f68
+  800f65:	e8 09 f2 ff ff       	call   800173 <_panic>
+
+00800f6a <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f76:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f81:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f84:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+
+00800f8b <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	57                   	push   %edi
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+  800f91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fa4:	89 df                	mov    %ebx,%edi
+  800fa6:	89 de                	mov    %ebx,%esi
+  800fa8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800faa:	85 c0                	test   %eax,%eax
+  800fac:	7f 08                	jg     800fb6 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800fae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb1:	5b                   	pop    %ebx
+  800fb2:	5e                   	pop    %esi
+  800fb3:	5f                   	pop    %edi
+  800fb4:	5d                   	pop    %ebp
+  800fb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+  800fb9:	50                   	push   %eax
+  800fba:	6a 0d                	push   $0xd
+  800fbc:	68 4b 3f 80 00       	push   $0x803f4b
+  800fc1:	6a 23                	push   $0x23
+  800fc3:	68 68 3f 80 00       	push   $0x803f68
+  800fc8:	e8 a6 f1 ff ff       	call   800173 <_panic>
+
+00800fcd <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fcd:	55                   	push   %ebp
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	57                   	push   %edi
+  800fd1:	56                   	push   %esi
+  800fd2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fdd:	89 d1                	mov    %edx,%ecx
+  800fdf:	89 d3                	mov    %edx,%ebx
+  800fe1:	89 d7                	mov    %edx,%edi
+  800fe3:	89 d6                	mov    %edx,%esi
+  800fe5:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fe7:	5b                   	pop    %ebx
+  800fe8:	5e                   	pop    %esi
+  800fe9:	5f                   	pop    %edi
+  800fea:	5d                   	pop    %ebp
+  800feb:	c3                   	ret
+
+00800fec <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800fec:	55                   	push   %ebp
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	57                   	push   %edi
+  800ff0:	56                   	push   %esi
+  800ff1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801002:	89 df                	mov    %ebx,%edi
+  801004:	89 de                	mov    %ebx,%esi
+  801006:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801008:	5b                   	pop    %ebx
+  801009:	5e                   	pop    %esi
+  80100a:	5f                   	pop    %edi
+  80100b:	5d                   	pop    %ebp
+  80100c:	c3                   	ret
+
+0080100d <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80100d:	55                   	push   %ebp
+  80100e:	89 e5                	mov    %esp,%ebp
+  801010:	57                   	push   %edi
+  801011:	56                   	push   %esi
+  801012:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801013:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801018:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801020:	89 cb                	mov    %ecx,%ebx
+  801022:	89 cf                	mov    %ecx,%edi
+  801024:	89 ce                	mov    %ecx,%esi
+  801026:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801028:	5b                   	pop    %ebx
+  801029:	5e                   	pop    %esi
+  80102a:	5f                   	pop    %edi
+  80102b:	5d                   	pop    %ebp
+  80102c:	c3                   	ret
+
+0080102d <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	57                   	push   %edi
+  801031:	56                   	push   %esi
+  801032:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801033:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801038:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801043:	89 df                	mov    %ebx,%edi
+  801045:	89 de                	mov    %ebx,%esi
+  801047:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801049:	5b                   	pop    %ebx
+  80104a:	5e                   	pop    %esi
+  80104b:	5f                   	pop    %edi
+  80104c:	5d                   	pop    %ebp
+  80104d:	c3                   	ret
+
+0080104e <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	57                   	push   %edi
+  801052:	56                   	push   %esi
+  801053:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801054:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801059:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801064:	89 df                	mov    %ebx,%edi
+  801066:	89 de                	mov    %ebx,%esi
+  801068:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+
+0080106f <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801075:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801082:	89 cb                	mov    %ecx,%ebx
+  801084:	89 cf                	mov    %ecx,%edi
+  801086:	89 ce                	mov    %ecx,%esi
+  801088:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80108a:	5b                   	pop    %ebx
+  80108b:	5e                   	pop    %esi
+  80108c:	5f                   	pop    %edi
+  80108d:	5d                   	pop    %ebp
+  80108e:	c3                   	ret
+
+0080108f <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	57                   	push   %edi
+  801093:	56                   	push   %esi
+  801094:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801095:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010a5:	89 df                	mov    %ebx,%edi
+  8010a7:	89 de                	mov    %ebx,%esi
+  8010a9:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5e                   	pop    %esi
+  8010ad:	5f                   	pop    %edi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+
+008010b0 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	57                   	push   %edi
+  8010b4:	56                   	push   %esi
+  8010b5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010c3:	89 cb                	mov    %ecx,%ebx
+  8010c5:	89 cf                	mov    %ecx,%edi
+  8010c7:	89 ce                	mov    %ecx,%esi
+  8010c9:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+
+008010d0 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	57                   	push   %edi
+  8010d4:	56                   	push   %esi
+  8010d5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e9:	89 f7                	mov    %esi,%edi
+  8010eb:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8010ed:	5b                   	pop    %ebx
+  8010ee:	5e                   	pop    %esi
+  8010ef:	5f                   	pop    %edi
+  8010f0:	5d                   	pop    %ebp
+  8010f1:	c3                   	ret
+
+008010f2 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	57                   	push   %edi
+  8010f6:	56                   	push   %esi
+  8010f7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801103:	b8 17 00 00 00       	mov    $0x17,%eax
+  801108:	89 df                	mov    %ebx,%edi
+  80110a:	89 de                	mov    %ebx,%esi
+  80110c:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80110e:	5b                   	pop    %ebx
+  80110f:	5e                   	pop    %esi
+  801110:	5f                   	pop    %edi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+
+00801113 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801119:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801121:	b8 18 00 00 00       	mov    $0x18,%eax
+  801126:	89 cb                	mov    %ecx,%ebx
+  801128:	89 cf                	mov    %ecx,%edi
+  80112a:	89 ce                	mov    %ecx,%esi
+  80112c:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80112e:	5b                   	pop    %ebx
+  80112f:	5e                   	pop    %esi
+  801130:	5f                   	pop    %edi
+  801131:	5d                   	pop    %ebp
+  801132:	c3                   	ret
+
+00801133 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801133:	55                   	push   %ebp
+  801134:	89 e5                	mov    %esp,%ebp
+  801136:	57                   	push   %edi
+  801137:	56                   	push   %esi
+  801138:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801139:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80113d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801142:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801145:	b8 19 00 00 00       	mov    $0x19,%eax
+  80114a:	89 df                	mov    %ebx,%edi
+  80114c:	89 de                	mov    %ebx,%esi
+  80114e:	cd 30                	int    $0x30
+}
+  801150:	5b                   	pop    %ebx
+  801151:	5e                   	pop    %esi
+  801152:	5f                   	pop    %edi
+  801153:	5d                   	pop    %ebp
+  801154:	c3                   	ret
+
+00801155 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115b:	be 00 00 00 00       	mov    $0x0,%esi
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  801163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801166:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80116b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116e:	89 f7                	mov    %esi,%edi
+  801170:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801172:	5b                   	pop    %ebx
+  801173:	5e                   	pop    %esi
+  801174:	5f                   	pop    %edi
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+
+00801177 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	57                   	push   %edi
+  80117b:	56                   	push   %esi
+  80117c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80117d:	be 00 00 00 00       	mov    $0x0,%esi
+  801182:	8b 55 08             	mov    0x8(%ebp),%edx
+  801185:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801188:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80118d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801190:	89 f7                	mov    %esi,%edi
+  801192:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801194:	5b                   	pop    %ebx
+  801195:	5e                   	pop    %esi
+  801196:	5f                   	pop    %edi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+
+00801199 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801199:	55                   	push   %ebp
+  80119a:	89 e5                	mov    %esp,%ebp
+  80119c:	57                   	push   %edi
+  80119d:	56                   	push   %esi
+  80119e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80119f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011aa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8011af:	89 df                	mov    %ebx,%edi
+  8011b1:	89 de                	mov    %ebx,%esi
+  8011b3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011b5:	5b                   	pop    %ebx
+  8011b6:	5e                   	pop    %esi
+  8011b7:	5f                   	pop    %edi
+  8011b8:	5d                   	pop    %ebp
+  8011b9:	c3                   	ret
+
+008011ba <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8011d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d3:	89 f7                	mov    %esi,%edi
+  8011d5:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+
+008011dc <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8011e2:	83 3d c0 63 80 00 00 	cmpl   $0x0,0x8063c0
+  8011e9:	74 0a                	je     8011f5 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8011eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ee:	a3 c0 63 80 00       	mov    %eax,0x8063c0
+}
+  8011f3:	c9                   	leave
+  8011f4:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8011f5:	83 ec 04             	sub    $0x4,%esp
+  8011f8:	6a 07                	push   $0x7
+  8011fa:	68 00 f0 bf ee       	push   $0xeebff000
+  8011ff:	6a 00                	push   $0x0
+  801201:	e8 73 fb ff ff       	call   800d79 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801206:	83 c4 08             	add    $0x8,%esp
+  801209:	68 1a 12 80 00       	push   $0x80121a
+  80120e:	6a 00                	push   $0x0
+  801210:	e8 af fc ff ff       	call   800ec4 <sys_env_set_pgfault_upcall>
+  801215:	83 c4 10             	add    $0x10,%esp
+  801218:	eb d1                	jmp    8011eb <set_pgfault_handler+0xf>
+
+0080121a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80121a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80121b:	a1 c0 63 80 00       	mov    0x8063c0,%eax
+	call *%eax
+  801220:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801222:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  801225:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  801229:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80122c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  801230:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  801232:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  801236:	83 c4 08             	add    $0x8,%esp
+	popal;
+  801239:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80123a:	83 c4 04             	add    $0x4,%esp
+	popf
+  80123d:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80123e:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80123f:	c3                   	ret
+
+00801240 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801243:	8b 45 08             	mov    0x8(%ebp),%eax
+  801246:	05 00 00 00 30       	add    $0x30000000,%eax
+  80124b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80124e:	5d                   	pop    %ebp
+  80124f:	c3                   	ret
+
+00801250 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801253:	8b 45 08             	mov    0x8(%ebp),%eax
+  801256:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80125b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801260:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+
+00801267 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80126f:	89 c2                	mov    %eax,%edx
+  801271:	c1 ea 16             	shr    $0x16,%edx
+  801274:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80127b:	f6 c2 01             	test   $0x1,%dl
+  80127e:	74 29                	je     8012a9 <fd_alloc+0x42>
+  801280:	89 c2                	mov    %eax,%edx
+  801282:	c1 ea 0c             	shr    $0xc,%edx
+  801285:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80128c:	f6 c2 01             	test   $0x1,%dl
+  80128f:	74 18                	je     8012a9 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801291:	05 00 10 00 00       	add    $0x1000,%eax
+  801296:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80129b:	75 d2                	jne    80126f <fd_alloc+0x8>
+  80129d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012a2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012a7:	eb 05                	jmp    8012ae <fd_alloc+0x47>
+			return 0;
+  8012a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b1:	89 02                	mov    %eax,(%edx)
+}
+  8012b3:	89 c8                	mov    %ecx,%eax
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+
+008012b7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012bd:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8012c2:	77 30                	ja     8012f4 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012c4:	c1 e0 0c             	shl    $0xc,%eax
+  8012c7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8012cc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012d2:	f6 c2 01             	test   $0x1,%dl
+  8012d5:	74 24                	je     8012fb <fd_lookup+0x44>
+  8012d7:	89 c2                	mov    %eax,%edx
+  8012d9:	c1 ea 0c             	shr    $0xc,%edx
+  8012dc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012e3:	f6 c2 01             	test   $0x1,%dl
+  8012e6:	74 1a                	je     801302 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012eb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012f2:	5d                   	pop    %ebp
+  8012f3:	c3                   	ret
+		return -E_INVAL;
+  8012f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f9:	eb f7                	jmp    8012f2 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8012fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801300:	eb f0                	jmp    8012f2 <fd_lookup+0x3b>
+  801302:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801307:	eb e9                	jmp    8012f2 <fd_lookup+0x3b>
+
+00801309 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	53                   	push   %ebx
+  80130d:	83 ec 04             	sub    $0x4,%esp
+  801310:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801313:	b8 00 00 00 00       	mov    $0x0,%eax
+  801318:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  80131d:	39 13                	cmp    %edx,(%ebx)
+  80131f:	74 54                	je     801375 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801321:	83 c0 01             	add    $0x1,%eax
+  801324:	8b 1c 85 f4 3f 80 00 	mov    0x803ff4(,%eax,4),%ebx
+  80132b:	85 db                	test   %ebx,%ebx
+  80132d:	75 ee                	jne    80131d <dev_lookup+0x14>
+  80132f:	89 e1                	mov    %esp,%ecx
+  801331:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801336:	29 c8                	sub    %ecx,%eax
+  801338:	89 c1                	mov    %eax,%ecx
+  80133a:	c1 e9 0f             	shr    $0xf,%ecx
+  80133d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801342:	b8 00 00 00 00       	mov    $0x0,%eax
+  801347:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80134a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801351:	8b 40 48             	mov    0x48(%eax),%eax
+  801354:	83 ec 04             	sub    $0x4,%esp
+  801357:	52                   	push   %edx
+  801358:	50                   	push   %eax
+  801359:	68 78 3f 80 00       	push   $0x803f78
+  80135e:	e8 eb ee ff ff       	call   80024e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801363:	83 c4 10             	add    $0x10,%esp
+  801366:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80136b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80136e:	89 1a                	mov    %ebx,(%edx)
+}
+  801370:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801373:	c9                   	leave
+  801374:	c3                   	ret
+			return 0;
+  801375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137a:	eb ef                	jmp    80136b <dev_lookup+0x62>
+
+0080137c <fd_close>:
+{
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	57                   	push   %edi
+  801380:	56                   	push   %esi
+  801381:	53                   	push   %ebx
+  801382:	83 ec 24             	sub    $0x24,%esp
+  801385:	8b 75 08             	mov    0x8(%ebp),%esi
+  801388:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80138b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80138e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80138f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801395:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801398:	50                   	push   %eax
+  801399:	e8 19 ff ff ff       	call   8012b7 <fd_lookup>
+  80139e:	89 c3                	mov    %eax,%ebx
+  8013a0:	83 c4 10             	add    $0x10,%esp
+  8013a3:	85 c0                	test   %eax,%eax
+  8013a5:	78 05                	js     8013ac <fd_close+0x30>
+	    || fd != fd2)
+  8013a7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013aa:	74 0f                	je     8013bb <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8013ac:	85 ff                	test   %edi,%edi
+  8013ae:	0f 44 df             	cmove  %edi,%ebx
+}
+  8013b1:	89 d8                	mov    %ebx,%eax
+  8013b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b6:	5b                   	pop    %ebx
+  8013b7:	5e                   	pop    %esi
+  8013b8:	5f                   	pop    %edi
+  8013b9:	5d                   	pop    %ebp
+  8013ba:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013bb:	83 ec 08             	sub    $0x8,%esp
+  8013be:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013c1:	50                   	push   %eax
+  8013c2:	ff 36                	push   (%esi)
+  8013c4:	e8 40 ff ff ff       	call   801309 <dev_lookup>
+  8013c9:	89 c3                	mov    %eax,%ebx
+  8013cb:	83 c4 10             	add    $0x10,%esp
+  8013ce:	85 c0                	test   %eax,%eax
+  8013d0:	78 1a                	js     8013ec <fd_close+0x70>
+		if (dev->dev_close)
+  8013d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013d5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	74 0b                	je     8013ec <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8013e1:	83 ec 0c             	sub    $0xc,%esp
+  8013e4:	56                   	push   %esi
+  8013e5:	ff d0                	call   *%eax
+  8013e7:	89 c3                	mov    %eax,%ebx
+  8013e9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013ec:	83 ec 08             	sub    $0x8,%esp
+  8013ef:	56                   	push   %esi
+  8013f0:	6a 00                	push   $0x0
+  8013f2:	e8 07 fa ff ff       	call   800dfe <sys_page_unmap>
+	return r;
+  8013f7:	83 c4 10             	add    $0x10,%esp
+  8013fa:	eb b5                	jmp    8013b1 <fd_close+0x35>
+
+008013fc <close>:
+
+int
+close(int fdnum)
+{
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801402:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801405:	50                   	push   %eax
+  801406:	ff 75 08             	push   0x8(%ebp)
+  801409:	e8 a9 fe ff ff       	call   8012b7 <fd_lookup>
+  80140e:	83 c4 10             	add    $0x10,%esp
+  801411:	85 c0                	test   %eax,%eax
+  801413:	79 02                	jns    801417 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+		return fd_close(fd, 1);
+  801417:	83 ec 08             	sub    $0x8,%esp
+  80141a:	6a 01                	push   $0x1
+  80141c:	ff 75 f4             	push   -0xc(%ebp)
+  80141f:	e8 58 ff ff ff       	call   80137c <fd_close>
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	eb ec                	jmp    801415 <close+0x19>
+
+00801429 <close_all>:
+
+void
+close_all(void)
+{
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	53                   	push   %ebx
+  80142d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801430:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801435:	83 ec 0c             	sub    $0xc,%esp
+  801438:	53                   	push   %ebx
+  801439:	e8 be ff ff ff       	call   8013fc <close>
+	for (i = 0; i < MAXFD; i++)
+  80143e:	83 c3 01             	add    $0x1,%ebx
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80144a:	75 e9                	jne    801435 <close_all+0xc>
+}
+  80144c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+
+00801451 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801451:	55                   	push   %ebp
+  801452:	89 e5                	mov    %esp,%ebp
+  801454:	57                   	push   %edi
+  801455:	56                   	push   %esi
+  801456:	53                   	push   %ebx
+  801457:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80145a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80145d:	50                   	push   %eax
+  80145e:	ff 75 08             	push   0x8(%ebp)
+  801461:	e8 51 fe ff ff       	call   8012b7 <fd_lookup>
+  801466:	89 c3                	mov    %eax,%ebx
+  801468:	83 c4 10             	add    $0x10,%esp
+  80146b:	85 c0                	test   %eax,%eax
+  80146d:	78 7f                	js     8014ee <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	ff 75 0c             	push   0xc(%ebp)
+  801475:	e8 82 ff ff ff       	call   8013fc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80147a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80147d:	c1 e6 0c             	shl    $0xc,%esi
+  801480:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801489:	89 3c 24             	mov    %edi,(%esp)
+  80148c:	e8 bf fd ff ff       	call   801250 <fd2data>
+  801491:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801493:	89 34 24             	mov    %esi,(%esp)
+  801496:	e8 b5 fd ff ff       	call   801250 <fd2data>
+  80149b:	83 c4 10             	add    $0x10,%esp
+  80149e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8014a1:	89 d8                	mov    %ebx,%eax
+  8014a3:	c1 e8 16             	shr    $0x16,%eax
+  8014a6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014ad:	a8 01                	test   $0x1,%al
+  8014af:	74 11                	je     8014c2 <dup+0x71>
+  8014b1:	89 d8                	mov    %ebx,%eax
+  8014b3:	c1 e8 0c             	shr    $0xc,%eax
+  8014b6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014bd:	f6 c2 01             	test   $0x1,%dl
+  8014c0:	75 36                	jne    8014f8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014c2:	89 f8                	mov    %edi,%eax
+  8014c4:	c1 e8 0c             	shr    $0xc,%eax
+  8014c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014ce:	83 ec 0c             	sub    $0xc,%esp
+  8014d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014d6:	50                   	push   %eax
+  8014d7:	56                   	push   %esi
+  8014d8:	6a 00                	push   $0x0
+  8014da:	57                   	push   %edi
+  8014db:	6a 00                	push   $0x0
+  8014dd:	e8 da f8 ff ff       	call   800dbc <sys_page_map>
+  8014e2:	89 c3                	mov    %eax,%ebx
+  8014e4:	83 c4 20             	add    $0x20,%esp
+  8014e7:	85 c0                	test   %eax,%eax
+  8014e9:	78 33                	js     80151e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014eb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014ee:	89 d8                	mov    %ebx,%eax
+  8014f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f3:	5b                   	pop    %ebx
+  8014f4:	5e                   	pop    %esi
+  8014f5:	5f                   	pop    %edi
+  8014f6:	5d                   	pop    %ebp
+  8014f7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014f8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014ff:	83 ec 0c             	sub    $0xc,%esp
+  801502:	25 07 0e 00 00       	and    $0xe07,%eax
+  801507:	50                   	push   %eax
+  801508:	ff 75 d4             	push   -0x2c(%ebp)
+  80150b:	6a 00                	push   $0x0
+  80150d:	53                   	push   %ebx
+  80150e:	6a 00                	push   $0x0
+  801510:	e8 a7 f8 ff ff       	call   800dbc <sys_page_map>
+  801515:	89 c3                	mov    %eax,%ebx
+  801517:	83 c4 20             	add    $0x20,%esp
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	79 a4                	jns    8014c2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80151e:	83 ec 08             	sub    $0x8,%esp
+  801521:	56                   	push   %esi
+  801522:	6a 00                	push   $0x0
+  801524:	e8 d5 f8 ff ff       	call   800dfe <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801529:	83 c4 08             	add    $0x8,%esp
+  80152c:	ff 75 d4             	push   -0x2c(%ebp)
+  80152f:	6a 00                	push   $0x0
+  801531:	e8 c8 f8 ff ff       	call   800dfe <sys_page_unmap>
+	return r;
+  801536:	83 c4 10             	add    $0x10,%esp
+  801539:	eb b3                	jmp    8014ee <dup+0x9d>
+
+0080153b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80153b:	55                   	push   %ebp
+  80153c:	89 e5                	mov    %esp,%ebp
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  801540:	83 ec 18             	sub    $0x18,%esp
+  801543:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801546:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801549:	50                   	push   %eax
+  80154a:	53                   	push   %ebx
+  80154b:	e8 67 fd ff ff       	call   8012b7 <fd_lookup>
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	85 c0                	test   %eax,%eax
+  801555:	78 3c                	js     801593 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801557:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80155a:	83 ec 08             	sub    $0x8,%esp
+  80155d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801560:	50                   	push   %eax
+  801561:	ff 36                	push   (%esi)
+  801563:	e8 a1 fd ff ff       	call   801309 <dev_lookup>
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	78 24                	js     801593 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80156f:	8b 46 08             	mov    0x8(%esi),%eax
+  801572:	83 e0 03             	and    $0x3,%eax
+  801575:	83 f8 01             	cmp    $0x1,%eax
+  801578:	74 20                	je     80159a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80157a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80157d:	8b 40 08             	mov    0x8(%eax),%eax
+  801580:	85 c0                	test   %eax,%eax
+  801582:	74 54                	je     8015d8 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801584:	83 ec 04             	sub    $0x4,%esp
+  801587:	ff 75 10             	push   0x10(%ebp)
+  80158a:	ff 75 0c             	push   0xc(%ebp)
+  80158d:	56                   	push   %esi
+  80158e:	ff d0                	call   *%eax
+  801590:	83 c4 10             	add    $0x10,%esp
+}
+  801593:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801596:	5b                   	pop    %ebx
+  801597:	5e                   	pop    %esi
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+  80159a:	89 e2                	mov    %esp,%edx
+  80159c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015a1:	29 d0                	sub    %edx,%eax
+  8015a3:	89 c2                	mov    %eax,%edx
+  8015a5:	c1 ea 0f             	shr    $0xf,%edx
+  8015a8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b2:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015b5:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8015bc:	8b 40 48             	mov    0x48(%eax),%eax
+  8015bf:	83 ec 04             	sub    $0x4,%esp
+  8015c2:	53                   	push   %ebx
+  8015c3:	50                   	push   %eax
+  8015c4:	68 b9 3f 80 00       	push   $0x803fb9
+  8015c9:	e8 80 ec ff ff       	call   80024e <cprintf>
+		return -E_INVAL;
+  8015ce:	83 c4 10             	add    $0x10,%esp
+  8015d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d6:	eb bb                	jmp    801593 <read+0x58>
+		return -E_NOT_SUPP;
+  8015d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015dd:	eb b4                	jmp    801593 <read+0x58>
+
+008015df <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	57                   	push   %edi
+  8015e3:	56                   	push   %esi
+  8015e4:	53                   	push   %ebx
+  8015e5:	83 ec 0c             	sub    $0xc,%esp
+  8015e8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8015eb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015ee:	85 f6                	test   %esi,%esi
+  8015f0:	74 30                	je     801622 <readn+0x43>
+  8015f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015fc:	83 ec 04             	sub    $0x4,%esp
+  8015ff:	89 f2                	mov    %esi,%edx
+  801601:	29 c2                	sub    %eax,%edx
+  801603:	52                   	push   %edx
+  801604:	01 f8                	add    %edi,%eax
+  801606:	50                   	push   %eax
+  801607:	ff 75 08             	push   0x8(%ebp)
+  80160a:	e8 2c ff ff ff       	call   80153b <read>
+		if (m < 0)
+  80160f:	83 c4 10             	add    $0x10,%esp
+  801612:	85 c0                	test   %eax,%eax
+  801614:	78 15                	js     80162b <readn+0x4c>
+			return m;
+		if (m == 0)
+  801616:	74 11                	je     801629 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801618:	01 c3                	add    %eax,%ebx
+  80161a:	89 d8                	mov    %ebx,%eax
+  80161c:	39 f3                	cmp    %esi,%ebx
+  80161e:	72 dc                	jb     8015fc <readn+0x1d>
+  801620:	eb 09                	jmp    80162b <readn+0x4c>
+  801622:	b8 00 00 00 00       	mov    $0x0,%eax
+  801627:	eb 02                	jmp    80162b <readn+0x4c>
+  801629:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80162b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162e:	5b                   	pop    %ebx
+  80162f:	5e                   	pop    %esi
+  801630:	5f                   	pop    %edi
+  801631:	5d                   	pop    %ebp
+  801632:	c3                   	ret
+
+00801633 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801633:	55                   	push   %ebp
+  801634:	89 e5                	mov    %esp,%ebp
+  801636:	56                   	push   %esi
+  801637:	53                   	push   %ebx
+  801638:	83 ec 18             	sub    $0x18,%esp
+  80163b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80163e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801641:	50                   	push   %eax
+  801642:	53                   	push   %ebx
+  801643:	e8 6f fc ff ff       	call   8012b7 <fd_lookup>
+  801648:	83 c4 10             	add    $0x10,%esp
+  80164b:	85 c0                	test   %eax,%eax
+  80164d:	78 37                	js     801686 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80164f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801652:	83 ec 08             	sub    $0x8,%esp
+  801655:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801658:	50                   	push   %eax
+  801659:	ff 36                	push   (%esi)
+  80165b:	e8 a9 fc ff ff       	call   801309 <dev_lookup>
+  801660:	83 c4 10             	add    $0x10,%esp
+  801663:	85 c0                	test   %eax,%eax
+  801665:	78 1f                	js     801686 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801667:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80166b:	74 20                	je     80168d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80166d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801670:	8b 40 0c             	mov    0xc(%eax),%eax
+  801673:	85 c0                	test   %eax,%eax
+  801675:	74 54                	je     8016cb <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801677:	83 ec 04             	sub    $0x4,%esp
+  80167a:	ff 75 10             	push   0x10(%ebp)
+  80167d:	ff 75 0c             	push   0xc(%ebp)
+  801680:	56                   	push   %esi
+  801681:	ff d0                	call   *%eax
+  801683:	83 c4 10             	add    $0x10,%esp
+}
+  801686:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801689:	5b                   	pop    %ebx
+  80168a:	5e                   	pop    %esi
+  80168b:	5d                   	pop    %ebp
+  80168c:	c3                   	ret
+  80168d:	89 e2                	mov    %esp,%edx
+  80168f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801694:	29 d0                	sub    %edx,%eax
+  801696:	89 c2                	mov    %eax,%edx
+  801698:	c1 ea 0f             	shr    $0xf,%edx
+  80169b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016a8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8016af:	8b 40 48             	mov    0x48(%eax),%eax
+  8016b2:	83 ec 04             	sub    $0x4,%esp
+  8016b5:	53                   	push   %ebx
+  8016b6:	50                   	push   %eax
+  8016b7:	68 d5 3f 80 00       	push   $0x803fd5
+  8016bc:	e8 8d eb ff ff       	call   80024e <cprintf>
+		return -E_INVAL;
+  8016c1:	83 c4 10             	add    $0x10,%esp
+  8016c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c9:	eb bb                	jmp    801686 <write+0x53>
+		return -E_NOT_SUPP;
+  8016cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d0:	eb b4                	jmp    801686 <write+0x53>
+
+008016d2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016d2:	55                   	push   %ebp
+  8016d3:	89 e5                	mov    %esp,%ebp
+  8016d5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016db:	50                   	push   %eax
+  8016dc:	ff 75 08             	push   0x8(%ebp)
+  8016df:	e8 d3 fb ff ff       	call   8012b7 <fd_lookup>
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	78 0e                	js     8016f9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+
+008016fb <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	53                   	push   %ebx
+  8016ff:	83 ec 1c             	sub    $0x1c,%esp
+  801702:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801705:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801708:	50                   	push   %eax
+  801709:	ff 75 08             	push   0x8(%ebp)
+  80170c:	e8 a6 fb ff ff       	call   8012b7 <fd_lookup>
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	85 c0                	test   %eax,%eax
+  801716:	78 33                	js     80174b <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801718:	83 fb 03             	cmp    $0x3,%ebx
+  80171b:	74 28                	je     801745 <fcntl+0x4a>
+  80171d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801722:	83 fb 04             	cmp    $0x4,%ebx
+  801725:	75 24                	jne    80174b <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801727:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80172a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80172d:	80 e4 ef             	and    $0xef,%ah
+  801730:	8b 55 10             	mov    0x10(%ebp),%edx
+  801733:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801739:	09 d0                	or     %edx,%eax
+  80173b:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80173e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801743:	eb 06                	jmp    80174b <fcntl+0x50>
+		return fd->fd_omode;
+  801745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801748:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80174b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80174e:	c9                   	leave
+  80174f:	c3                   	ret
+
+00801750 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	56                   	push   %esi
+  801754:	53                   	push   %ebx
+  801755:	83 ec 18             	sub    $0x18,%esp
+  801758:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80175b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80175e:	50                   	push   %eax
+  80175f:	53                   	push   %ebx
+  801760:	e8 52 fb ff ff       	call   8012b7 <fd_lookup>
+  801765:	83 c4 10             	add    $0x10,%esp
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	78 34                	js     8017a0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80176c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80176f:	83 ec 08             	sub    $0x8,%esp
+  801772:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801775:	50                   	push   %eax
+  801776:	ff 36                	push   (%esi)
+  801778:	e8 8c fb ff ff       	call   801309 <dev_lookup>
+  80177d:	83 c4 10             	add    $0x10,%esp
+  801780:	85 c0                	test   %eax,%eax
+  801782:	78 1c                	js     8017a0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801784:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801788:	74 1d                	je     8017a7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80178a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80178d:	8b 40 18             	mov    0x18(%eax),%eax
+  801790:	85 c0                	test   %eax,%eax
+  801792:	74 51                	je     8017e5 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801794:	83 ec 08             	sub    $0x8,%esp
+  801797:	ff 75 0c             	push   0xc(%ebp)
+  80179a:	56                   	push   %esi
+  80179b:	ff d0                	call   *%eax
+  80179d:	83 c4 10             	add    $0x10,%esp
+}
+  8017a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a3:	5b                   	pop    %ebx
+  8017a4:	5e                   	pop    %esi
+  8017a5:	5d                   	pop    %ebp
+  8017a6:	c3                   	ret
+  8017a7:	89 e2                	mov    %esp,%edx
+  8017a9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017ae:	29 d0                	sub    %edx,%eax
+  8017b0:	89 c2                	mov    %eax,%edx
+  8017b2:	c1 ea 0f             	shr    $0xf,%edx
+  8017b5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bf:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8017c2:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8017c9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017cc:	83 ec 04             	sub    $0x4,%esp
+  8017cf:	53                   	push   %ebx
+  8017d0:	50                   	push   %eax
+  8017d1:	68 98 3f 80 00       	push   $0x803f98
+  8017d6:	e8 73 ea ff ff       	call   80024e <cprintf>
+		return -E_INVAL;
+  8017db:	83 c4 10             	add    $0x10,%esp
+  8017de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e3:	eb bb                	jmp    8017a0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017e5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ea:	eb b4                	jmp    8017a0 <ftruncate+0x50>
+
+008017ec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017ec:	55                   	push   %ebp
+  8017ed:	89 e5                	mov    %esp,%ebp
+  8017ef:	56                   	push   %esi
+  8017f0:	53                   	push   %ebx
+  8017f1:	83 ec 18             	sub    $0x18,%esp
+  8017f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017fa:	50                   	push   %eax
+  8017fb:	ff 75 08             	push   0x8(%ebp)
+  8017fe:	e8 b4 fa ff ff       	call   8012b7 <fd_lookup>
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 53                	js     80185d <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80180a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  801810:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801813:	50                   	push   %eax
+  801814:	ff 36                	push   (%esi)
+  801816:	e8 ee fa ff ff       	call   801309 <dev_lookup>
+  80181b:	83 c4 10             	add    $0x10,%esp
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	78 3b                	js     80185d <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801822:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801825:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801829:	74 39                	je     801864 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80182b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80182e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801835:	00 00 00 
+	stat->st_isdir = 0;
+  801838:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80183f:	00 00 00 
+	stat->st_version = 0;
+  801842:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801849:	00 00 00 
+	stat->st_dev = dev;
+  80184c:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801852:	83 ec 08             	sub    $0x8,%esp
+  801855:	53                   	push   %ebx
+  801856:	56                   	push   %esi
+  801857:	ff 50 14             	call   *0x14(%eax)
+  80185a:	83 c4 10             	add    $0x10,%esp
+}
+  80185d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5d                   	pop    %ebp
+  801863:	c3                   	ret
+		return -E_NOT_SUPP;
+  801864:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801869:	eb f2                	jmp    80185d <fstat+0x71>
+
+0080186b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80186b:	55                   	push   %ebp
+  80186c:	89 e5                	mov    %esp,%ebp
+  80186e:	56                   	push   %esi
+  80186f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801870:	83 ec 08             	sub    $0x8,%esp
+  801873:	6a 00                	push   $0x0
+  801875:	ff 75 08             	push   0x8(%ebp)
+  801878:	e8 b7 01 00 00       	call   801a34 <open>
+  80187d:	89 c3                	mov    %eax,%ebx
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	85 c0                	test   %eax,%eax
+  801884:	78 1b                	js     8018a1 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801886:	83 ec 08             	sub    $0x8,%esp
+  801889:	ff 75 0c             	push   0xc(%ebp)
+  80188c:	50                   	push   %eax
+  80188d:	e8 5a ff ff ff       	call   8017ec <fstat>
+  801892:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801894:	89 1c 24             	mov    %ebx,(%esp)
+  801897:	e8 60 fb ff ff       	call   8013fc <close>
+	return r;
+  80189c:	83 c4 10             	add    $0x10,%esp
+  80189f:	89 f3                	mov    %esi,%ebx
+}
+  8018a1:	89 d8                	mov    %ebx,%eax
+  8018a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a6:	5b                   	pop    %ebx
+  8018a7:	5e                   	pop    %esi
+  8018a8:	5d                   	pop    %ebp
+  8018a9:	c3                   	ret
+
+008018aa <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8018aa:	55                   	push   %ebp
+  8018ab:	89 e5                	mov    %esp,%ebp
+  8018ad:	56                   	push   %esi
+  8018ae:	53                   	push   %ebx
+  8018af:	89 c6                	mov    %eax,%esi
+  8018b1:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8018b3:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8018ba:	74 27                	je     8018e3 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018bc:	6a 07                	push   $0x7
+  8018be:	68 00 70 80 00       	push   $0x807000
+  8018c3:	56                   	push   %esi
+  8018c4:	ff 35 00 60 80 00    	push   0x806000
+  8018ca:	e8 d9 1f 00 00       	call   8038a8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018cf:	83 c4 0c             	add    $0xc,%esp
+  8018d2:	6a 00                	push   $0x0
+  8018d4:	53                   	push   %ebx
+  8018d5:	6a 00                	push   $0x0
+  8018d7:	e8 3c 1d 00 00       	call   803618 <ipc_recv>
+}
+  8018dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018df:	5b                   	pop    %ebx
+  8018e0:	5e                   	pop    %esi
+  8018e1:	5d                   	pop    %ebp
+  8018e2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018e3:	83 ec 0c             	sub    $0xc,%esp
+  8018e6:	6a 02                	push   $0x2
+  8018e8:	e8 24 20 00 00       	call   803911 <ipc_find_env>
+  8018ed:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018f2:	83 c4 10             	add    $0x10,%esp
+  8018f5:	eb c5                	jmp    8018bc <fsipc+0x12>
+
+008018f7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018f7:	55                   	push   %ebp
+  8018f8:	89 e5                	mov    %esp,%ebp
+  8018fa:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801900:	8b 40 0c             	mov    0xc(%eax),%eax
+  801903:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801908:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80190b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801910:	ba 00 00 00 00       	mov    $0x0,%edx
+  801915:	b8 02 00 00 00       	mov    $0x2,%eax
+  80191a:	e8 8b ff ff ff       	call   8018aa <fsipc>
+}
+  80191f:	c9                   	leave
+  801920:	c3                   	ret
+
+00801921 <devfile_flush>:
+{
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801932:	ba 00 00 00 00       	mov    $0x0,%edx
+  801937:	b8 06 00 00 00       	mov    $0x6,%eax
+  80193c:	e8 69 ff ff ff       	call   8018aa <fsipc>
+}
+  801941:	c9                   	leave
+  801942:	c3                   	ret
+
+00801943 <devfile_stat>:
+{
+  801943:	55                   	push   %ebp
+  801944:	89 e5                	mov    %esp,%ebp
+  801946:	53                   	push   %ebx
+  801947:	83 ec 04             	sub    $0x4,%esp
+  80194a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80194d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801950:	8b 40 0c             	mov    0xc(%eax),%eax
+  801953:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801958:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801962:	e8 43 ff ff ff       	call   8018aa <fsipc>
+  801967:	85 c0                	test   %eax,%eax
+  801969:	78 37                	js     8019a2 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80196b:	83 ec 08             	sub    $0x8,%esp
+  80196e:	68 00 70 80 00       	push   $0x807000
+  801973:	53                   	push   %ebx
+  801974:	e8 cc ef ff ff       	call   800945 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801979:	a1 80 70 80 00       	mov    0x807080,%eax
+  80197e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801984:	a1 84 70 80 00       	mov    0x807084,%eax
+  801989:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80198f:	a1 88 70 80 00       	mov    0x807088,%eax
+  801994:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80199a:	83 c4 10             	add    $0x10,%esp
+  80199d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a5:	c9                   	leave
+  8019a6:	c3                   	ret
+
+008019a7 <devfile_write>:
+{
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	83 ec 0c             	sub    $0xc,%esp
+  8019ad:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8019b0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019b5:	39 d0                	cmp    %edx,%eax
+  8019b7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bd:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019c0:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8019c6:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8019cb:	50                   	push   %eax
+  8019cc:	ff 75 0c             	push   0xc(%ebp)
+  8019cf:	68 08 70 80 00       	push   $0x807008
+  8019d4:	e8 1c f1 ff ff       	call   800af5 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8019d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019de:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019e3:	e8 c2 fe ff ff       	call   8018aa <fsipc>
+}
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+008019ea <devfile_read>:
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	53                   	push   %ebx
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8019fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8019ff:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801a04:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a09:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a0e:	e8 97 fe ff ff       	call   8018aa <fsipc>
+  801a13:	89 c3                	mov    %eax,%ebx
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	78 14                	js     801a2d <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801a19:	83 ec 04             	sub    $0x4,%esp
+  801a1c:	50                   	push   %eax
+  801a1d:	68 00 70 80 00       	push   $0x807000
+  801a22:	ff 75 0c             	push   0xc(%ebp)
+  801a25:	e8 cb f0 ff ff       	call   800af5 <memmove>
+	return r;
+  801a2a:	83 c4 10             	add    $0x10,%esp
+}
+  801a2d:	89 d8                	mov    %ebx,%eax
+  801a2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a32:	c9                   	leave
+  801a33:	c3                   	ret
+
+00801a34 <open>:
+{
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+  801a37:	53                   	push   %ebx
+  801a38:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3e:	50                   	push   %eax
+  801a3f:	e8 23 f8 ff ff       	call   801267 <fd_alloc>
+  801a44:	89 c3                	mov    %eax,%ebx
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	78 2a                	js     801a77 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801a4d:	83 ec 0c             	sub    $0xc,%esp
+  801a50:	ff 75 08             	push   0x8(%ebp)
+  801a53:	e8 a1 ee ff ff       	call   8008f9 <strlen>
+  801a58:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801a5b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801a60:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a65:	7e 17                	jle    801a7e <open+0x4a>
+	fd_close(fd, 1);
+  801a67:	83 ec 08             	sub    $0x8,%esp
+  801a6a:	6a 01                	push   $0x1
+  801a6c:	ff 75 f4             	push   -0xc(%ebp)
+  801a6f:	e8 08 f9 ff ff       	call   80137c <fd_close>
+	return r;
+  801a74:	83 c4 10             	add    $0x10,%esp
+}
+  801a77:	89 d8                	mov    %ebx,%eax
+  801a79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a7e:	83 ec 08             	sub    $0x8,%esp
+  801a81:	ff 75 08             	push   0x8(%ebp)
+  801a84:	68 00 70 80 00       	push   $0x807000
+  801a89:	e8 b7 ee ff ff       	call   800945 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a91:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a99:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a9e:	e8 07 fe ff ff       	call   8018aa <fsipc>
+  801aa3:	89 c3                	mov    %eax,%ebx
+  801aa5:	83 c4 10             	add    $0x10,%esp
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	78 bb                	js     801a67 <open+0x33>
+	return fd2num(fd); 	
+  801aac:	83 ec 0c             	sub    $0xc,%esp
+  801aaf:	ff 75 f4             	push   -0xc(%ebp)
+  801ab2:	e8 89 f7 ff ff       	call   801240 <fd2num>
+  801ab7:	89 c3                	mov    %eax,%ebx
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	eb b9                	jmp    801a77 <open+0x43>
+
+00801abe <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	53                   	push   %ebx
+  801ac2:	83 ec 1c             	sub    $0x1c,%esp
+  801ac5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ac8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801acb:	50                   	push   %eax
+  801acc:	ff 75 08             	push   0x8(%ebp)
+  801acf:	e8 e3 f7 ff ff       	call   8012b7 <fd_lookup>
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 5a                	js     801b35 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801adb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ade:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801ae4:	39 10                	cmp    %edx,(%eax)
+  801ae6:	75 66                	jne    801b4e <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801ae8:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801aef:	74 49                	je     801b3a <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801af1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801af4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801af7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801afc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aff:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801b04:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b0a:	6a 07                	push   $0x7
+  801b0c:	68 00 70 80 00       	push   $0x807000
+  801b11:	6a 09                	push   $0x9
+  801b13:	ff 35 00 60 80 00    	push   0x806000
+  801b19:	e8 8a 1d 00 00       	call   8038a8 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801b1e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b25:	6a 00                	push   $0x0
+  801b27:	53                   	push   %ebx
+  801b28:	ff 75 10             	push   0x10(%ebp)
+  801b2b:	6a 00                	push   $0x0
+  801b2d:	e8 b3 1b 00 00       	call   8036e5 <ipc_recv_pages>
+  801b32:	83 c4 20             	add    $0x20,%esp
+}
+  801b35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b38:	c9                   	leave
+  801b39:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b3a:	83 ec 0c             	sub    $0xc,%esp
+  801b3d:	6a 02                	push   $0x2
+  801b3f:	e8 cd 1d 00 00       	call   803911 <ipc_find_env>
+  801b44:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	eb a3                	jmp    801af1 <fmap+0x33>
+		return -E_INVAL;
+  801b4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b53:	eb e0                	jmp    801b35 <fmap+0x77>
+
+00801b55 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b55:	55                   	push   %ebp
+  801b56:	89 e5                	mov    %esp,%ebp
+  801b58:	53                   	push   %ebx
+  801b59:	83 ec 10             	sub    $0x10,%esp
+  801b5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b5f:	53                   	push   %ebx
+  801b60:	e8 94 ed ff ff       	call   8008f9 <strlen>
+  801b65:	83 c4 10             	add    $0x10,%esp
+  801b68:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b6d:	7f 25                	jg     801b94 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b6f:	83 ec 08             	sub    $0x8,%esp
+  801b72:	53                   	push   %ebx
+  801b73:	68 00 70 80 00       	push   $0x807000
+  801b78:	e8 c8 ed ff ff       	call   800945 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b82:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b87:	e8 1e fd ff ff       	call   8018aa <fsipc>
+  801b8c:	83 c4 10             	add    $0x10,%esp
+}
+  801b8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b92:	c9                   	leave
+  801b93:	c3                   	ret
+		return -E_BAD_PATH;
+  801b94:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b99:	eb f4                	jmp    801b8f <remove+0x3a>
+
+00801b9b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b9b:	55                   	push   %ebp
+  801b9c:	89 e5                	mov    %esp,%ebp
+  801b9e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ba1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba6:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bab:	e8 fa fc ff ff       	call   8018aa <fsipc>
+}
+  801bb0:	c9                   	leave
+  801bb1:	c3                   	ret
+
+00801bb2 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801bb2:	55                   	push   %ebp
+  801bb3:	89 e5                	mov    %esp,%ebp
+  801bb5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801bb8:	68 08 40 80 00       	push   $0x804008
+  801bbd:	ff 75 0c             	push   0xc(%ebp)
+  801bc0:	e8 80 ed ff ff       	call   800945 <strcpy>
+	return 0;
+}
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bca:	c9                   	leave
+  801bcb:	c3                   	ret
+
+00801bcc <devsock_close>:
+{
+  801bcc:	55                   	push   %ebp
+  801bcd:	89 e5                	mov    %esp,%ebp
+  801bcf:	53                   	push   %ebx
+  801bd0:	83 ec 10             	sub    $0x10,%esp
+  801bd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801bd6:	53                   	push   %ebx
+  801bd7:	e8 74 1d 00 00       	call   803950 <pageref>
+  801bdc:	89 c2                	mov    %eax,%edx
+  801bde:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801be1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801be6:	83 fa 01             	cmp    $0x1,%edx
+  801be9:	74 05                	je     801bf0 <devsock_close+0x24>
+}
+  801beb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bee:	c9                   	leave
+  801bef:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801bf0:	83 ec 0c             	sub    $0xc,%esp
+  801bf3:	ff 73 0c             	push   0xc(%ebx)
+  801bf6:	e8 b0 05 00 00       	call   8021ab <nsipc_close>
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	eb eb                	jmp    801beb <devsock_close+0x1f>
+
+00801c00 <devsock_write>:
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	53                   	push   %ebx
+  801c04:	83 ec 14             	sub    $0x14,%esp
+  801c07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c0d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801c10:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801c13:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c16:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c19:	c1 f8 09             	sar    $0x9,%eax
+  801c1c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c1f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c25:	77 13                	ja     801c3a <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801c27:	50                   	push   %eax
+  801c28:	52                   	push   %edx
+  801c29:	53                   	push   %ebx
+  801c2a:	ff 71 0c             	push   0xc(%ecx)
+  801c2d:	e8 5c 06 00 00       	call   80228e <nsipc_send>
+  801c32:	83 c4 10             	add    $0x10,%esp
+}
+  801c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c38:	c9                   	leave
+  801c39:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c3a:	50                   	push   %eax
+  801c3b:	6a 01                	push   $0x1
+  801c3d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c40:	50                   	push   %eax
+  801c41:	ff 71 0c             	push   0xc(%ecx)
+  801c44:	e8 a6 06 00 00       	call   8022ef <nsipc_sendmsg>
+  801c49:	83 c4 10             	add    $0x10,%esp
+  801c4c:	eb e7                	jmp    801c35 <devsock_write+0x35>
+
+00801c4e <devsock_read>:
+{
+  801c4e:	55                   	push   %ebp
+  801c4f:	89 e5                	mov    %esp,%ebp
+  801c51:	53                   	push   %ebx
+  801c52:	83 ec 14             	sub    $0x14,%esp
+  801c55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c5b:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801c5e:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801c61:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c64:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c67:	c1 f8 09             	sar    $0x9,%eax
+  801c6a:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c6d:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c73:	77 13                	ja     801c88 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801c75:	50                   	push   %eax
+  801c76:	52                   	push   %edx
+  801c77:	53                   	push   %ebx
+  801c78:	ff 71 0c             	push   0xc(%ecx)
+  801c7b:	e8 9c 05 00 00       	call   80221c <nsipc_recv>
+  801c80:	83 c4 10             	add    $0x10,%esp
+}
+  801c83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c86:	c9                   	leave
+  801c87:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c88:	50                   	push   %eax
+  801c89:	6a 01                	push   $0x1
+  801c8b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c8e:	50                   	push   %eax
+  801c8f:	ff 71 0c             	push   0xc(%ecx)
+  801c92:	e8 02 0a 00 00       	call   802699 <nsipc_recvmsg>
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	eb e7                	jmp    801c83 <devsock_read+0x35>
+
+00801c9c <fd2sockid>:
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ca2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ca5:	52                   	push   %edx
+  801ca6:	50                   	push   %eax
+  801ca7:	e8 0b f6 ff ff       	call   8012b7 <fd_lookup>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 10                	js     801cc3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb6:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801cbc:	39 08                	cmp    %ecx,(%eax)
+  801cbe:	75 05                	jne    801cc5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cc0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cc3:	c9                   	leave
+  801cc4:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cc5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cca:	eb f7                	jmp    801cc3 <fd2sockid+0x27>
+
+00801ccc <sock_flags>:
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801cd2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cd5:	52                   	push   %edx
+  801cd6:	50                   	push   %eax
+  801cd7:	e8 db f5 ff ff       	call   8012b7 <fd_lookup>
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	78 0e                	js     801cf1 <sock_flags+0x25>
+  801ce3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce6:	8b 40 08             	mov    0x8(%eax),%eax
+  801ce9:	c1 e8 09             	shr    $0x9,%eax
+  801cec:	83 e0 08             	and    $0x8,%eax
+}
+  801cef:	c9                   	leave
+  801cf0:	c3                   	ret
+		return 0;
+  801cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf6:	eb f7                	jmp    801cef <sock_flags+0x23>
+
+00801cf8 <alloc_sockfd>:
+{
+  801cf8:	55                   	push   %ebp
+  801cf9:	89 e5                	mov    %esp,%ebp
+  801cfb:	56                   	push   %esi
+  801cfc:	53                   	push   %ebx
+  801cfd:	83 ec 1c             	sub    $0x1c,%esp
+  801d00:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d05:	50                   	push   %eax
+  801d06:	e8 5c f5 ff ff       	call   801267 <fd_alloc>
+  801d0b:	89 c3                	mov    %eax,%ebx
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 43                	js     801d57 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d14:	83 ec 04             	sub    $0x4,%esp
+  801d17:	68 07 04 00 00       	push   $0x407
+  801d1c:	ff 75 f4             	push   -0xc(%ebp)
+  801d1f:	6a 00                	push   $0x0
+  801d21:	e8 53 f0 ff ff       	call   800d79 <sys_page_alloc>
+  801d26:	89 c3                	mov    %eax,%ebx
+  801d28:	83 c4 10             	add    $0x10,%esp
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	78 28                	js     801d57 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d32:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801d38:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d44:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d47:	83 ec 0c             	sub    $0xc,%esp
+  801d4a:	50                   	push   %eax
+  801d4b:	e8 f0 f4 ff ff       	call   801240 <fd2num>
+  801d50:	89 c3                	mov    %eax,%ebx
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	eb 0c                	jmp    801d63 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d57:	83 ec 0c             	sub    $0xc,%esp
+  801d5a:	56                   	push   %esi
+  801d5b:	e8 4b 04 00 00       	call   8021ab <nsipc_close>
+		return r;
+  801d60:	83 c4 10             	add    $0x10,%esp
+}
+  801d63:	89 d8                	mov    %ebx,%eax
+  801d65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d68:	5b                   	pop    %ebx
+  801d69:	5e                   	pop    %esi
+  801d6a:	5d                   	pop    %ebp
+  801d6b:	c3                   	ret
+
+00801d6c <accept>:
+{
+  801d6c:	55                   	push   %ebp
+  801d6d:	89 e5                	mov    %esp,%ebp
+  801d6f:	56                   	push   %esi
+  801d70:	53                   	push   %ebx
+  801d71:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d74:	89 f0                	mov    %esi,%eax
+  801d76:	e8 21 ff ff ff       	call   801c9c <fd2sockid>
+  801d7b:	89 c3                	mov    %eax,%ebx
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 24                	js     801da5 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801d81:	89 f0                	mov    %esi,%eax
+  801d83:	e8 44 ff ff ff       	call   801ccc <sock_flags>
+  801d88:	50                   	push   %eax
+  801d89:	ff 75 10             	push   0x10(%ebp)
+  801d8c:	ff 75 0c             	push   0xc(%ebp)
+  801d8f:	53                   	push   %ebx
+  801d90:	e8 6b 03 00 00       	call   802100 <nsipc_accept>
+  801d95:	89 c3                	mov    %eax,%ebx
+  801d97:	83 c4 10             	add    $0x10,%esp
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 07                	js     801da5 <accept+0x39>
+	return alloc_sockfd(r);
+  801d9e:	e8 55 ff ff ff       	call   801cf8 <alloc_sockfd>
+  801da3:	89 c3                	mov    %eax,%ebx
+}
+  801da5:	89 d8                	mov    %ebx,%eax
+  801da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801daa:	5b                   	pop    %ebx
+  801dab:	5e                   	pop    %esi
+  801dac:	5d                   	pop    %ebp
+  801dad:	c3                   	ret
+
+00801dae <bind>:
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db7:	e8 e0 fe ff ff       	call   801c9c <fd2sockid>
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 12                	js     801dd2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dc0:	83 ec 04             	sub    $0x4,%esp
+  801dc3:	ff 75 10             	push   0x10(%ebp)
+  801dc6:	ff 75 0c             	push   0xc(%ebp)
+  801dc9:	50                   	push   %eax
+  801dca:	e8 85 03 00 00       	call   802154 <nsipc_bind>
+  801dcf:	83 c4 10             	add    $0x10,%esp
+}
+  801dd2:	c9                   	leave
+  801dd3:	c3                   	ret
+
+00801dd4 <shutdown>:
+{
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ddd:	e8 ba fe ff ff       	call   801c9c <fd2sockid>
+  801de2:	85 c0                	test   %eax,%eax
+  801de4:	78 0f                	js     801df5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801de6:	83 ec 08             	sub    $0x8,%esp
+  801de9:	ff 75 0c             	push   0xc(%ebp)
+  801dec:	50                   	push   %eax
+  801ded:	e8 97 03 00 00       	call   802189 <nsipc_shutdown>
+  801df2:	83 c4 10             	add    $0x10,%esp
+}
+  801df5:	c9                   	leave
+  801df6:	c3                   	ret
+
+00801df7 <connect>:
+{
+  801df7:	55                   	push   %ebp
+  801df8:	89 e5                	mov    %esp,%ebp
+  801dfa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e00:	e8 97 fe ff ff       	call   801c9c <fd2sockid>
+  801e05:	85 c0                	test   %eax,%eax
+  801e07:	78 12                	js     801e1b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e09:	83 ec 04             	sub    $0x4,%esp
+  801e0c:	ff 75 10             	push   0x10(%ebp)
+  801e0f:	ff 75 0c             	push   0xc(%ebp)
+  801e12:	50                   	push   %eax
+  801e13:	e8 ad 03 00 00       	call   8021c5 <nsipc_connect>
+  801e18:	83 c4 10             	add    $0x10,%esp
+}
+  801e1b:	c9                   	leave
+  801e1c:	c3                   	ret
+
+00801e1d <listen>:
+{
+  801e1d:	55                   	push   %ebp
+  801e1e:	89 e5                	mov    %esp,%ebp
+  801e20:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e26:	e8 71 fe ff ff       	call   801c9c <fd2sockid>
+  801e2b:	85 c0                	test   %eax,%eax
+  801e2d:	78 0f                	js     801e3e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e2f:	83 ec 08             	sub    $0x8,%esp
+  801e32:	ff 75 0c             	push   0xc(%ebp)
+  801e35:	50                   	push   %eax
+  801e36:	e8 bf 03 00 00       	call   8021fa <nsipc_listen>
+  801e3b:	83 c4 10             	add    $0x10,%esp
+}
+  801e3e:	c9                   	leave
+  801e3f:	c3                   	ret
+
+00801e40 <sendmsg>:
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	57                   	push   %edi
+  801e44:	56                   	push   %esi
+  801e45:	53                   	push   %ebx
+  801e46:	83 ec 0c             	sub    $0xc,%esp
+  801e49:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801e4f:	89 f0                	mov    %esi,%eax
+  801e51:	e8 46 fe ff ff       	call   801c9c <fd2sockid>
+  801e56:	89 c3                	mov    %eax,%ebx
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	78 1c                	js     801e78 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801e5c:	89 f0                	mov    %esi,%eax
+  801e5e:	e8 69 fe ff ff       	call   801ccc <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e63:	0b 45 10             	or     0x10(%ebp),%eax
+  801e66:	50                   	push   %eax
+  801e67:	ff 77 0c             	push   0xc(%edi)
+  801e6a:	ff 77 08             	push   0x8(%edi)
+  801e6d:	53                   	push   %ebx
+  801e6e:	e8 7c 04 00 00       	call   8022ef <nsipc_sendmsg>
+  801e73:	89 c3                	mov    %eax,%ebx
+  801e75:	83 c4 10             	add    $0x10,%esp
+}
+  801e78:	89 d8                	mov    %ebx,%eax
+  801e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7d:	5b                   	pop    %ebx
+  801e7e:	5e                   	pop    %esi
+  801e7f:	5f                   	pop    %edi
+  801e80:	5d                   	pop    %ebp
+  801e81:	c3                   	ret
+
+00801e82 <recvmsg>:
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	57                   	push   %edi
+  801e86:	56                   	push   %esi
+  801e87:	53                   	push   %ebx
+  801e88:	83 ec 0c             	sub    $0xc,%esp
+  801e8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e91:	89 f8                	mov    %edi,%eax
+  801e93:	e8 04 fe ff ff       	call   801c9c <fd2sockid>
+  801e98:	89 c3                	mov    %eax,%ebx
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	78 2a                	js     801ec8 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801e9e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801ea5:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801eac:	89 f8                	mov    %edi,%eax
+  801eae:	e8 19 fe ff ff       	call   801ccc <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801eb3:	0b 45 10             	or     0x10(%ebp),%eax
+  801eb6:	50                   	push   %eax
+  801eb7:	ff 76 0c             	push   0xc(%esi)
+  801eba:	ff 76 08             	push   0x8(%esi)
+  801ebd:	53                   	push   %ebx
+  801ebe:	e8 d6 07 00 00       	call   802699 <nsipc_recvmsg>
+  801ec3:	89 c3                	mov    %eax,%ebx
+  801ec5:	83 c4 10             	add    $0x10,%esp
+}
+  801ec8:	89 d8                	mov    %ebx,%eax
+  801eca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ecd:	5b                   	pop    %ebx
+  801ece:	5e                   	pop    %esi
+  801ecf:	5f                   	pop    %edi
+  801ed0:	5d                   	pop    %ebp
+  801ed1:	c3                   	ret
+
+00801ed2 <sendfile>:
+{
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	56                   	push   %esi
+  801ed6:	53                   	push   %ebx
+  801ed7:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801eda:	89 f0                	mov    %esi,%eax
+  801edc:	e8 bb fd ff ff       	call   801c9c <fd2sockid>
+  801ee1:	89 c3                	mov    %eax,%ebx
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	78 1f                	js     801f06 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801ee7:	89 f0                	mov    %esi,%eax
+  801ee9:	e8 de fd ff ff       	call   801ccc <sock_flags>
+  801eee:	83 ec 0c             	sub    $0xc,%esp
+  801ef1:	50                   	push   %eax
+  801ef2:	ff 75 14             	push   0x14(%ebp)
+  801ef5:	ff 75 10             	push   0x10(%ebp)
+  801ef8:	ff 75 0c             	push   0xc(%ebp)
+  801efb:	53                   	push   %ebx
+  801efc:	e8 64 06 00 00       	call   802565 <nsipc_sendfile>
+  801f01:	89 c3                	mov    %eax,%ebx
+  801f03:	83 c4 20             	add    $0x20,%esp
+}
+  801f06:	89 d8                	mov    %ebx,%eax
+  801f08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f0b:	5b                   	pop    %ebx
+  801f0c:	5e                   	pop    %esi
+  801f0d:	5d                   	pop    %ebp
+  801f0e:	c3                   	ret
+
+00801f0f <evctl>:
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	53                   	push   %ebx
+  801f13:	83 ec 04             	sub    $0x4,%esp
+  801f16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801f19:	89 d8                	mov    %ebx,%eax
+  801f1b:	e8 7c fd ff ff       	call   801c9c <fd2sockid>
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	78 10                	js     801f34 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801f24:	83 ec 04             	sub    $0x4,%esp
+  801f27:	53                   	push   %ebx
+  801f28:	ff 75 0c             	push   0xc(%ebp)
+  801f2b:	50                   	push   %eax
+  801f2c:	e8 d2 0b 00 00       	call   802b03 <nsipc_evctl>
+  801f31:	83 c4 10             	add    $0x10,%esp
+}
+  801f34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f37:	c9                   	leave
+  801f38:	c3                   	ret
+
+00801f39 <evwait>:
+{
+  801f39:	55                   	push   %ebp
+  801f3a:	89 e5                	mov    %esp,%ebp
+  801f3c:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801f3f:	ff 75 10             	push   0x10(%ebp)
+  801f42:	ff 75 0c             	push   0xc(%ebp)
+  801f45:	ff 75 08             	push   0x8(%ebp)
+  801f48:	e8 e0 0b 00 00       	call   802b2d <nsipc_evwait>
+}
+  801f4d:	c9                   	leave
+  801f4e:	c3                   	ret
+
+00801f4f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801f4f:	55                   	push   %ebp
+  801f50:	89 e5                	mov    %esp,%ebp
+  801f52:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f55:	ff 75 10             	push   0x10(%ebp)
+  801f58:	ff 75 0c             	push   0xc(%ebp)
+  801f5b:	ff 75 08             	push   0x8(%ebp)
+  801f5e:	e8 31 0c 00 00       	call   802b94 <nsipc_socket>
+  801f63:	83 c4 10             	add    $0x10,%esp
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	78 05                	js     801f6f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f6a:	e8 89 fd ff ff       	call   801cf8 <alloc_sockfd>
+}
+  801f6f:	c9                   	leave
+  801f70:	c3                   	ret
+
+00801f71 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f71:	55                   	push   %ebp
+  801f72:	89 e5                	mov    %esp,%ebp
+  801f74:	53                   	push   %ebx
+  801f75:	83 ec 04             	sub    $0x4,%esp
+  801f78:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801f7a:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801f81:	74 26                	je     801fa9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f83:	6a 07                	push   $0x7
+  801f85:	68 00 80 80 00       	push   $0x808000
+  801f8a:	53                   	push   %ebx
+  801f8b:	ff 35 24 63 80 00    	push   0x806324
+  801f91:	e8 12 19 00 00       	call   8038a8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f96:	83 c4 0c             	add    $0xc,%esp
+  801f99:	6a 00                	push   $0x0
+  801f9b:	6a 00                	push   $0x0
+  801f9d:	6a 00                	push   $0x0
+  801f9f:	e8 74 16 00 00       	call   803618 <ipc_recv>
+}
+  801fa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa7:	c9                   	leave
+  801fa8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801fa9:	83 ec 0c             	sub    $0xc,%esp
+  801fac:	6a 03                	push   $0x3
+  801fae:	e8 5e 19 00 00       	call   803911 <ipc_find_env>
+  801fb3:	a3 24 63 80 00       	mov    %eax,0x806324
+  801fb8:	83 c4 10             	add    $0x10,%esp
+  801fbb:	eb c6                	jmp    801f83 <nsipc+0x12>
+
+00801fbd <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801fbd:	55                   	push   %ebp
+  801fbe:	89 e5                	mov    %esp,%ebp
+  801fc0:	56                   	push   %esi
+  801fc1:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801fc2:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  801fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801fcd:	85 f6                	test   %esi,%esi
+  801fcf:	75 33                	jne    802004 <nsbulk_map+0x47>
+  801fd1:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801fd6:	83 ec 04             	sub    $0x4,%esp
+  801fd9:	6a 07                	push   $0x7
+  801fdb:	53                   	push   %ebx
+  801fdc:	6a 00                	push   $0x0
+  801fde:	e8 96 ed ff ff       	call   800d79 <sys_page_alloc>
+  801fe3:	83 c4 10             	add    $0x10,%esp
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 1a                	js     802004 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801fea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ff0:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801ff6:	75 de                	jne    801fd6 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801ff8:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  801fff:	00 00 00 
+	return 0;
+  802002:	89 f0                	mov    %esi,%eax
+}
+  802004:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802007:	5b                   	pop    %ebx
+  802008:	5e                   	pop    %esi
+  802009:	5d                   	pop    %ebp
+  80200a:	c3                   	ret
+
+0080200b <nsbulk_own>:
+{
+  80200b:	55                   	push   %ebp
+  80200c:	89 e5                	mov    %esp,%ebp
+  80200e:	57                   	push   %edi
+  80200f:	56                   	push   %esi
+  802010:	53                   	push   %ebx
+  802011:	83 ec 0c             	sub    $0xc,%esp
+  802014:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802016:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802019:	85 d2                	test   %edx,%edx
+  80201b:	7f 0e                	jg     80202b <nsbulk_own+0x20>
+	return 0;
+  80201d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802022:	eb 47                	jmp    80206b <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802024:	83 c3 01             	add    $0x1,%ebx
+  802027:	39 fb                	cmp    %edi,%ebx
+  802029:	7d 3b                	jge    802066 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80202b:	be 01 00 00 00       	mov    $0x1,%esi
+  802030:	89 d9                	mov    %ebx,%ecx
+  802032:	d3 e6                	shl    %cl,%esi
+  802034:	89 f0                	mov    %esi,%eax
+  802036:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  80203c:	74 e6                	je     802024 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80203e:	83 ec 04             	sub    $0x4,%esp
+  802041:	6a 07                	push   $0x7
+  802043:	89 d8                	mov    %ebx,%eax
+  802045:	c1 e0 0c             	shl    $0xc,%eax
+  802048:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80204d:	50                   	push   %eax
+  80204e:	6a 00                	push   $0x0
+  802050:	e8 24 ed ff ff       	call   800d79 <sys_page_alloc>
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 0f                	js     80206b <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80205c:	f7 d6                	not    %esi
+  80205e:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  802064:	eb be                	jmp    802024 <nsbulk_own+0x19>
+	return 0;
+  802066:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80206b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206e:	5b                   	pop    %ebx
+  80206f:	5e                   	pop    %esi
+  802070:	5f                   	pop    %edi
+  802071:	5d                   	pop    %ebp
+  802072:	c3                   	ret
+
+00802073 <nsipc_bulk>:
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	57                   	push   %edi
+  802077:	56                   	push   %esi
+  802078:	53                   	push   %ebx
+  802079:	83 ec 1c             	sub    $0x1c,%esp
+  80207c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80207f:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802081:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802087:	c1 fb 0c             	sar    $0xc,%ebx
+  80208a:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80208d:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802094:	74 56                	je     8020ec <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802096:	85 ff                	test   %edi,%edi
+  802098:	7e 24                	jle    8020be <nsipc_bulk+0x4b>
+  80209a:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8020a0:	74 1c                	je     8020be <nsipc_bulk+0x4b>
+  8020a2:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8020a8:	c1 e3 0c             	shl    $0xc,%ebx
+  8020ab:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8020b0:	0f b6 10             	movzbl (%eax),%edx
+  8020b3:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8020b5:	05 00 10 00 00       	add    $0x1000,%eax
+  8020ba:	39 d8                	cmp    %ebx,%eax
+  8020bc:	75 f2                	jne    8020b0 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8020be:	83 ec 0c             	sub    $0xc,%esp
+  8020c1:	56                   	push   %esi
+  8020c2:	57                   	push   %edi
+  8020c3:	68 00 00 00 e0       	push   $0xe0000000
+  8020c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8020cb:	ff 35 24 63 80 00    	push   0x806324
+  8020d1:	e8 06 18 00 00       	call   8038dc <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8020d6:	83 c4 1c             	add    $0x1c,%esp
+  8020d9:	6a 00                	push   $0x0
+  8020db:	6a 00                	push   $0x0
+  8020dd:	6a 00                	push   $0x0
+  8020df:	e8 34 15 00 00       	call   803618 <ipc_recv>
+}
+  8020e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e7:	5b                   	pop    %ebx
+  8020e8:	5e                   	pop    %esi
+  8020e9:	5f                   	pop    %edi
+  8020ea:	5d                   	pop    %ebp
+  8020eb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8020ec:	83 ec 0c             	sub    $0xc,%esp
+  8020ef:	6a 03                	push   $0x3
+  8020f1:	e8 1b 18 00 00       	call   803911 <ipc_find_env>
+  8020f6:	a3 24 63 80 00       	mov    %eax,0x806324
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	eb 96                	jmp    802096 <nsipc_bulk+0x23>
+
+00802100 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	53                   	push   %ebx
+  802104:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802107:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  80210f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802112:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802117:	b8 01 00 00 00       	mov    $0x1,%eax
+  80211c:	e8 50 fe ff ff       	call   801f71 <nsipc>
+  802121:	89 c3                	mov    %eax,%ebx
+  802123:	85 c0                	test   %eax,%eax
+  802125:	79 07                	jns    80212e <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802127:	89 d8                	mov    %ebx,%eax
+  802129:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80212c:	c9                   	leave
+  80212d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80212e:	83 ec 04             	sub    $0x4,%esp
+  802131:	ff 35 10 80 80 00    	push   0x808010
+  802137:	68 00 80 80 00       	push   $0x808000
+  80213c:	ff 75 0c             	push   0xc(%ebp)
+  80213f:	e8 b1 e9 ff ff       	call   800af5 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802144:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80214a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80214d:	89 10                	mov    %edx,(%eax)
+  80214f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802152:	eb d3                	jmp    802127 <nsipc_accept+0x27>
+
+00802154 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	53                   	push   %ebx
+  802158:	83 ec 08             	sub    $0x8,%esp
+  80215b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80215e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802161:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802166:	53                   	push   %ebx
+  802167:	ff 75 0c             	push   0xc(%ebp)
+  80216a:	68 04 80 80 00       	push   $0x808004
+  80216f:	e8 81 e9 ff ff       	call   800af5 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802174:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80217a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80217f:	e8 ed fd ff ff       	call   801f71 <nsipc>
+}
+  802184:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802187:	c9                   	leave
+  802188:	c3                   	ret
+
+00802189 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802189:	55                   	push   %ebp
+  80218a:	89 e5                	mov    %esp,%ebp
+  80218c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80218f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802192:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802197:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80219a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80219f:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021a4:	e8 c8 fd ff ff       	call   801f71 <nsipc>
+}
+  8021a9:	c9                   	leave
+  8021aa:	c3                   	ret
+
+008021ab <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8021ab:	55                   	push   %ebp
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8021b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b4:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8021b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021be:	e8 ae fd ff ff       	call   801f71 <nsipc>
+}
+  8021c3:	c9                   	leave
+  8021c4:	c3                   	ret
+
+008021c5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8021c5:	55                   	push   %ebp
+  8021c6:	89 e5                	mov    %esp,%ebp
+  8021c8:	53                   	push   %ebx
+  8021c9:	83 ec 08             	sub    $0x8,%esp
+  8021cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8021cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8021d7:	53                   	push   %ebx
+  8021d8:	ff 75 0c             	push   0xc(%ebp)
+  8021db:	68 04 80 80 00       	push   $0x808004
+  8021e0:	e8 10 e9 ff ff       	call   800af5 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8021e5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8021eb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021f0:	e8 7c fd ff ff       	call   801f71 <nsipc>
+}
+  8021f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f8:	c9                   	leave
+  8021f9:	c3                   	ret
+
+008021fa <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802200:	8b 45 08             	mov    0x8(%ebp),%eax
+  802203:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802208:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80220b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802210:	b8 06 00 00 00       	mov    $0x6,%eax
+  802215:	e8 57 fd ff ff       	call   801f71 <nsipc>
+}
+  80221a:	c9                   	leave
+  80221b:	c3                   	ret
+
+0080221c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80221c:	55                   	push   %ebp
+  80221d:	89 e5                	mov    %esp,%ebp
+  80221f:	56                   	push   %esi
+  802220:	53                   	push   %ebx
+  802221:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802224:	8b 45 08             	mov    0x8(%ebp),%eax
+  802227:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80222c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802232:	8b 45 14             	mov    0x14(%ebp),%eax
+  802235:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80223a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80223f:	e8 2d fd ff ff       	call   801f71 <nsipc>
+  802244:	89 c3                	mov    %eax,%ebx
+  802246:	85 c0                	test   %eax,%eax
+  802248:	78 22                	js     80226c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80224a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80224f:	39 c6                	cmp    %eax,%esi
+  802251:	0f 4e c6             	cmovle %esi,%eax
+  802254:	39 c3                	cmp    %eax,%ebx
+  802256:	7f 1d                	jg     802275 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802258:	83 ec 04             	sub    $0x4,%esp
+  80225b:	53                   	push   %ebx
+  80225c:	68 00 80 80 00       	push   $0x808000
+  802261:	ff 75 0c             	push   0xc(%ebp)
+  802264:	e8 8c e8 ff ff       	call   800af5 <memmove>
+  802269:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80226c:	89 d8                	mov    %ebx,%eax
+  80226e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802271:	5b                   	pop    %ebx
+  802272:	5e                   	pop    %esi
+  802273:	5d                   	pop    %ebp
+  802274:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802275:	68 14 40 80 00       	push   $0x804014
+  80227a:	68 29 40 80 00       	push   $0x804029
+  80227f:	68 b2 00 00 00       	push   $0xb2
+  802284:	68 3e 40 80 00       	push   $0x80403e
+  802289:	e8 e5 de ff ff       	call   800173 <_panic>
+
+0080228e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80228e:	55                   	push   %ebp
+  80228f:	89 e5                	mov    %esp,%ebp
+  802291:	53                   	push   %ebx
+  802292:	83 ec 04             	sub    $0x4,%esp
+  802295:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802298:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229b:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8022a0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8022a6:	7f 2e                	jg     8022d6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8022a8:	83 ec 04             	sub    $0x4,%esp
+  8022ab:	53                   	push   %ebx
+  8022ac:	ff 75 0c             	push   0xc(%ebp)
+  8022af:	68 0c 80 80 00       	push   $0x80800c
+  8022b4:	e8 3c e8 ff ff       	call   800af5 <memmove>
+	nsipcbuf.send.req_size = size;
+  8022b9:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8022bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022c2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8022c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8022cc:	e8 a0 fc ff ff       	call   801f71 <nsipc>
+}
+  8022d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d4:	c9                   	leave
+  8022d5:	c3                   	ret
+	assert(size < 1600);
+  8022d6:	68 4a 40 80 00       	push   $0x80404a
+  8022db:	68 29 40 80 00       	push   $0x804029
+  8022e0:	68 bd 00 00 00       	push   $0xbd
+  8022e5:	68 3e 40 80 00       	push   $0x80403e
+  8022ea:	e8 84 de ff ff       	call   800173 <_panic>
+
+008022ef <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	57                   	push   %edi
+  8022f3:	56                   	push   %esi
+  8022f4:	53                   	push   %ebx
+  8022f5:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8022f8:	e8 c0 fc ff ff       	call   801fbd <nsbulk_map>
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	78 55                	js     802356 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802301:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802308:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  80230f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802316:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802319:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80231c:	0f 8d 24 02 00 00    	jge    802546 <nsipc_sendmsg+0x257>
+  802322:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802325:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802328:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80232b:	89 d8                	mov    %ebx,%eax
+  80232d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802332:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802334:	83 ec 0c             	sub    $0xc,%esp
+  802337:	68 20 60 80 00       	push   $0x806020
+  80233c:	e8 5a 0f 00 00       	call   80329b <pgbatch_init>
+  802341:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802344:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802346:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802349:	e9 82 00 00 00       	jmp    8023d0 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80234e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802351:	85 db                	test   %ebx,%ebx
+  802353:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802359:	5b                   	pop    %ebx
+  80235a:	5e                   	pop    %esi
+  80235b:	5f                   	pop    %edi
+  80235c:	5d                   	pop    %ebp
+  80235d:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80235e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802363:	29 c8                	sub    %ecx,%eax
+  802365:	39 d0                	cmp    %edx,%eax
+  802367:	0f 46 d0             	cmovbe %eax,%edx
+  80236a:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80236c:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802372:	85 ff                	test   %edi,%edi
+  802374:	0f 49 c7             	cmovns %edi,%eax
+  802377:	c1 f8 0c             	sar    $0xc,%eax
+  80237a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80237f:	e8 87 fc ff ff       	call   80200b <nsbulk_own>
+  802384:	85 c0                	test   %eax,%eax
+  802386:	0f 88 17 01 00 00    	js     8024a3 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80238c:	83 ec 04             	sub    $0x4,%esp
+  80238f:	56                   	push   %esi
+  802390:	ff 75 e0             	push   -0x20(%ebp)
+  802393:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802396:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80239b:	50                   	push   %eax
+  80239c:	e8 54 e7 ff ff       	call   800af5 <memmove>
+  8023a1:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8023a4:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8023a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023aa:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8023ad:	0f 84 fd 00 00 00    	je     8024b0 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8023b3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8023b6:	01 f7                	add    %esi,%edi
+  8023b8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023bb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023be:	0f 8d 01 01 00 00    	jge    8024c5 <nsipc_sendmsg+0x1d6>
+  8023c4:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8023ca:	0f 8f f0 00 00 00    	jg     8024c0 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8023d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d3:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8023d6:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8023d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023dc:	89 c2                	mov    %eax,%edx
+  8023de:	03 13                	add    (%ebx),%edx
+  8023e0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8023e3:	8b 73 04             	mov    0x4(%ebx),%esi
+  8023e6:	29 c6                	sub    %eax,%esi
+  8023e8:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8023ed:	29 f9                	sub    %edi,%ecx
+  8023ef:	39 ce                	cmp    %ecx,%esi
+  8023f1:	89 ca                	mov    %ecx,%edx
+  8023f3:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8023f6:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8023f9:	89 f9                	mov    %edi,%ecx
+  8023fb:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802401:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802404:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802409:	09 c8                	or     %ecx,%eax
+  80240b:	0f 85 4d ff ff ff    	jne    80235e <nsipc_sendmsg+0x6f>
+  802411:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802417:	0f 86 41 ff ff ff    	jbe    80235e <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80241d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802423:	85 ff                	test   %edi,%edi
+  802425:	0f 49 c7             	cmovns %edi,%eax
+  802428:	c1 f8 0c             	sar    $0xc,%eax
+  80242b:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80242d:	89 d1                	mov    %edx,%ecx
+  80242f:	c1 e9 0c             	shr    $0xc,%ecx
+  802432:	01 c8                	add    %ecx,%eax
+  802434:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802437:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80243a:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80243c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80243f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802444:	29 c8                	sub    %ecx,%eax
+  802446:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802449:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80244c:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80244e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802453:	89 f9                	mov    %edi,%ecx
+  802455:	d3 e0                	shl    %cl,%eax
+  802457:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80245d:	83 ec 08             	sub    $0x8,%esp
+  802460:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802462:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802465:	50                   	push   %eax
+  802466:	6a 00                	push   $0x0
+  802468:	56                   	push   %esi
+  802469:	6a 00                	push   $0x0
+  80246b:	68 20 60 80 00       	push   $0x806020
+  802470:	e8 e4 0e 00 00       	call   803359 <pgbatch_map>
+  802475:	83 c4 20             	add    $0x20,%esp
+  802478:	85 c0                	test   %eax,%eax
+  80247a:	0f 88 ce fe ff ff    	js     80234e <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802480:	83 c7 01             	add    $0x1,%edi
+  802483:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802489:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80248c:	39 c7                	cmp    %eax,%edi
+  80248e:	75 be                	jne    80244e <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802490:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802493:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802496:	89 d6                	mov    %edx,%esi
+  802498:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80249e:	e9 01 ff ff ff       	jmp    8023a4 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8024a3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024a6:	85 db                	test   %ebx,%ebx
+  8024a8:	0f 45 c3             	cmovne %ebx,%eax
+  8024ab:	e9 a6 fe ff ff       	jmp    802356 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8024b0:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8024b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8024bb:	e9 f3 fe ff ff       	jmp    8023b3 <nsipc_sendmsg+0xc4>
+  8024c0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8024c3:	eb 03                	jmp    8024c8 <nsipc_sendmsg+0x1d9>
+  8024c5:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8024c8:	83 ec 0c             	sub    $0xc,%esp
+  8024cb:	68 20 60 80 00       	push   $0x806020
+  8024d0:	e8 d4 0d 00 00       	call   8032a9 <pgbatch_flush>
+  8024d5:	83 c4 10             	add    $0x10,%esp
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	78 50                	js     80252c <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8024dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024df:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8024e4:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8024ea:	89 fb                	mov    %edi,%ebx
+  8024ec:	29 f3                	sub    %esi,%ebx
+  8024ee:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8024f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024f7:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8024fc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802501:	89 fa                	mov    %edi,%edx
+  802503:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802508:	e8 66 fb ff ff       	call   802073 <nsipc_bulk>
+  80250d:	85 c0                	test   %eax,%eax
+  80250f:	78 28                	js     802539 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802511:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802514:	39 c3                	cmp    %eax,%ebx
+  802516:	75 0c                	jne    802524 <nsipc_sendmsg+0x235>
+  802518:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80251b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80251e:	0f 8f f2 fd ff ff    	jg     802316 <nsipc_sendmsg+0x27>
+		sent += r;
+  802524:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802527:	e9 2a fe ff ff       	jmp    802356 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80252c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80252f:	85 db                	test   %ebx,%ebx
+  802531:	0f 45 c3             	cmovne %ebx,%eax
+  802534:	e9 1d fe ff ff       	jmp    802356 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802539:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80253c:	85 db                	test   %ebx,%ebx
+  80253e:	0f 45 c3             	cmovne %ebx,%eax
+  802541:	e9 10 fe ff ff       	jmp    802356 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802546:	83 ec 0c             	sub    $0xc,%esp
+  802549:	68 20 60 80 00       	push   $0x806020
+  80254e:	e8 48 0d 00 00       	call   80329b <pgbatch_init>
+  802553:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802556:	be 00 00 00 00       	mov    $0x0,%esi
+  80255b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802560:	e9 63 ff ff ff       	jmp    8024c8 <nsipc_sendmsg+0x1d9>
+
+00802565 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802565:	55                   	push   %ebp
+  802566:	89 e5                	mov    %esp,%ebp
+  802568:	57                   	push   %edi
+  802569:	56                   	push   %esi
+  80256a:	53                   	push   %ebx
+  80256b:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80256e:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802575:	0f 84 c8 00 00 00    	je     802643 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80257b:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802582:	0f 84 e4 00 00 00    	je     80266c <nsipc_sendfile+0x107>
+{
+  802588:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80258d:	89 fb                	mov    %edi,%ebx
+  80258f:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802592:	0f 83 f0 00 00 00    	jae    802688 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802598:	89 fa                	mov    %edi,%edx
+  80259a:	03 55 10             	add    0x10(%ebp),%edx
+  80259d:	89 d0                	mov    %edx,%eax
+  80259f:	c1 f8 1f             	sar    $0x1f,%eax
+  8025a2:	c1 e8 14             	shr    $0x14,%eax
+  8025a5:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8025a8:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8025ae:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8025b0:	6a 10                	push   $0x10
+  8025b2:	68 00 20 01 e0       	push   $0xe0012000
+  8025b7:	52                   	push   %edx
+  8025b8:	ff 75 0c             	push   0xc(%ebp)
+  8025bb:	e8 fe f4 ff ff       	call   801abe <fmap>
+  8025c0:	83 c4 10             	add    $0x10,%esp
+  8025c3:	85 c0                	test   %eax,%eax
+  8025c5:	0f 8e b8 00 00 00    	jle    802683 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8025cb:	39 c6                	cmp    %eax,%esi
+  8025cd:	0f 8d b5 00 00 00    	jge    802688 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8025d3:	29 f0                	sub    %esi,%eax
+  8025d5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8025d8:	29 da                	sub    %ebx,%edx
+  8025da:	39 d0                	cmp    %edx,%eax
+  8025dc:	89 d3                	mov    %edx,%ebx
+  8025de:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8025e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e4:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8025e9:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8025ef:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8025f5:	8b 45 18             	mov    0x18(%ebp),%eax
+  8025f8:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025fd:	83 ec 0c             	sub    $0xc,%esp
+  802600:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802602:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802609:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80260c:	83 c0 01             	add    $0x1,%eax
+  80260f:	50                   	push   %eax
+  802610:	68 00 10 01 e0       	push   $0xe0011000
+  802615:	6a 11                	push   $0x11
+  802617:	ff 35 24 63 80 00    	push   0x806324
+  80261d:	e8 ba 12 00 00       	call   8038dc <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802622:	83 c4 1c             	add    $0x1c,%esp
+  802625:	6a 00                	push   $0x0
+  802627:	6a 00                	push   $0x0
+  802629:	6a 00                	push   $0x0
+  80262b:	e8 e8 0f 00 00       	call   803618 <ipc_recv>
+  802630:	83 c4 10             	add    $0x10,%esp
+  802633:	85 c0                	test   %eax,%eax
+  802635:	78 5b                	js     802692 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802637:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802639:	39 c3                	cmp    %eax,%ebx
+  80263b:	0f 8e 4c ff ff ff    	jle    80258d <nsipc_sendfile+0x28>
+  802641:	eb 45                	jmp    802688 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802643:	83 ec 04             	sub    $0x4,%esp
+  802646:	6a 07                	push   $0x7
+  802648:	68 00 10 01 e0       	push   $0xe0011000
+  80264d:	6a 00                	push   $0x0
+  80264f:	e8 25 e7 ff ff       	call   800d79 <sys_page_alloc>
+  802654:	89 c7                	mov    %eax,%edi
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	85 c0                	test   %eax,%eax
+  80265b:	78 2b                	js     802688 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80265d:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802664:	00 00 00 
+  802667:	e9 0f ff ff ff       	jmp    80257b <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80266c:	83 ec 0c             	sub    $0xc,%esp
+  80266f:	6a 03                	push   $0x3
+  802671:	e8 9b 12 00 00       	call   803911 <ipc_find_env>
+  802676:	a3 24 63 80 00       	mov    %eax,0x806324
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	e9 05 ff ff ff       	jmp    802588 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802683:	85 ff                	test   %edi,%edi
+  802685:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802688:	89 f8                	mov    %edi,%eax
+  80268a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80268d:	5b                   	pop    %ebx
+  80268e:	5e                   	pop    %esi
+  80268f:	5f                   	pop    %edi
+  802690:	5d                   	pop    %ebp
+  802691:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802692:	85 ff                	test   %edi,%edi
+  802694:	0f 44 f8             	cmove  %eax,%edi
+  802697:	eb ef                	jmp    802688 <nsipc_sendfile+0x123>
+
+00802699 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802699:	55                   	push   %ebp
+  80269a:	89 e5                	mov    %esp,%ebp
+  80269c:	57                   	push   %edi
+  80269d:	56                   	push   %esi
+  80269e:	53                   	push   %ebx
+  80269f:	83 ec 1c             	sub    $0x1c,%esp
+  8026a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8026a5:	e8 13 f9 ff ff       	call   801fbd <nsbulk_map>
+  8026aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026ad:	85 c0                	test   %eax,%eax
+  8026af:	0f 88 ba 00 00 00    	js     80276f <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026b5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8026b9:	0f 8e bb 00 00 00    	jle    80277a <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8026bf:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026c4:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8026c9:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8026ce:	89 f8                	mov    %edi,%eax
+  8026d0:	29 f0                	sub    %esi,%eax
+  8026d2:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8026d6:	39 c8                	cmp    %ecx,%eax
+  8026d8:	0f 47 c1             	cmova  %ecx,%eax
+  8026db:	01 f0                	add    %esi,%eax
+  8026dd:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026df:	83 c2 01             	add    $0x1,%edx
+  8026e2:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8026e5:	7e 07                	jle    8026ee <nsipc_recvmsg+0x55>
+  8026e7:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8026ec:	7e e0                	jle    8026ce <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8026ee:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8026f4:	c1 fa 0c             	sar    $0xc,%edx
+  8026f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fc:	e8 0a f9 ff ff       	call   80200b <nsbulk_own>
+  802701:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802704:	85 c0                	test   %eax,%eax
+  802706:	78 67                	js     80276f <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802708:	8b 45 08             	mov    0x8(%ebp),%eax
+  80270b:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802710:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802716:	8b 45 14             	mov    0x14(%ebp),%eax
+  802719:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80271e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802723:	89 f2                	mov    %esi,%edx
+  802725:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80272a:	e8 44 f9 ff ff       	call   802073 <nsipc_bulk>
+  80272f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802732:	85 c0                	test   %eax,%eax
+  802734:	78 39                	js     80276f <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802736:	39 f0                	cmp    %esi,%eax
+  802738:	7f 4a                	jg     802784 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80273a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	7e 2c                	jle    80276f <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802743:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802746:	29 fe                	sub    %edi,%esi
+  802748:	8b 43 04             	mov    0x4(%ebx),%eax
+  80274b:	39 c6                	cmp    %eax,%esi
+  80274d:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802750:	83 ec 04             	sub    $0x4,%esp
+  802753:	56                   	push   %esi
+  802754:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80275a:	50                   	push   %eax
+  80275b:	ff 33                	push   (%ebx)
+  80275d:	e8 93 e3 ff ff       	call   800af5 <memmove>
+		n += m;
+  802762:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802764:	83 c3 08             	add    $0x8,%ebx
+  802767:	83 c4 10             	add    $0x10,%esp
+  80276a:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80276d:	7f d4                	jg     802743 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80276f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802775:	5b                   	pop    %ebx
+  802776:	5e                   	pop    %esi
+  802777:	5f                   	pop    %edi
+  802778:	5d                   	pop    %ebp
+  802779:	c3                   	ret
+	int r, i, n, len = 0;
+  80277a:	be 00 00 00 00       	mov    $0x0,%esi
+  80277f:	e9 6a ff ff ff       	jmp    8026ee <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802784:	68 20 40 80 00       	push   $0x804020
+  802789:	68 29 40 80 00       	push   $0x804029
+  80278e:	68 3b 01 00 00       	push   $0x13b
+  802793:	68 3e 40 80 00       	push   $0x80403e
+  802798:	e8 d6 d9 ff ff       	call   800173 <_panic>
+
+0080279d <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80279d:	55                   	push   %ebp
+  80279e:	89 e5                	mov    %esp,%ebp
+  8027a0:	57                   	push   %edi
+  8027a1:	56                   	push   %esi
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 0c             	sub    $0xc,%esp
+  8027a6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8027a9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8027ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8027af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8027b7:	8b 07                	mov    (%edi),%eax
+  8027b9:	a3 04 80 80 00       	mov    %eax,0x808004
+  8027be:	8b 47 04             	mov    0x4(%edi),%eax
+  8027c1:	a3 08 80 80 00       	mov    %eax,0x808008
+  8027c6:	8b 47 08             	mov    0x8(%edi),%eax
+  8027c9:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8027ce:	8b 47 0c             	mov    0xc(%edi),%eax
+  8027d1:	a3 10 80 80 00       	mov    %eax,0x808010
+  8027d6:	8b 47 10             	mov    0x10(%edi),%eax
+  8027d9:	a3 14 80 80 00       	mov    %eax,0x808014
+  8027de:	8b 47 14             	mov    0x14(%edi),%eax
+  8027e1:	a3 18 80 80 00       	mov    %eax,0x808018
+  8027e6:	8b 47 18             	mov    0x18(%edi),%eax
+  8027e9:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8027ee:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8027f1:	a3 20 80 80 00       	mov    %eax,0x808020
+  8027f6:	8b 47 20             	mov    0x20(%edi),%eax
+  8027f9:	a3 24 80 80 00       	mov    %eax,0x808024
+  8027fe:	8b 47 24             	mov    0x24(%edi),%eax
+  802801:	a3 28 80 80 00       	mov    %eax,0x808028
+  802806:	8b 47 28             	mov    0x28(%edi),%eax
+  802809:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80280e:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802811:	a3 30 80 80 00       	mov    %eax,0x808030
+  802816:	8b 47 30             	mov    0x30(%edi),%eax
+  802819:	a3 34 80 80 00       	mov    %eax,0x808034
+  80281e:	8b 47 34             	mov    0x34(%edi),%eax
+  802821:	a3 38 80 80 00       	mov    %eax,0x808038
+  802826:	8b 47 38             	mov    0x38(%edi),%eax
+  802829:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  80282e:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802831:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802836:	8b 06                	mov    (%esi),%eax
+  802838:	a3 44 80 80 00       	mov    %eax,0x808044
+  80283d:	8b 46 04             	mov    0x4(%esi),%eax
+  802840:	a3 48 80 80 00       	mov    %eax,0x808048
+  802845:	8b 46 08             	mov    0x8(%esi),%eax
+  802848:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  80284d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802850:	a3 50 80 80 00       	mov    %eax,0x808050
+  802855:	8b 46 10             	mov    0x10(%esi),%eax
+  802858:	a3 54 80 80 00       	mov    %eax,0x808054
+  80285d:	8b 46 14             	mov    0x14(%esi),%eax
+  802860:	a3 58 80 80 00       	mov    %eax,0x808058
+  802865:	8b 46 18             	mov    0x18(%esi),%eax
+  802868:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  80286d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802870:	a3 60 80 80 00       	mov    %eax,0x808060
+  802875:	8b 46 20             	mov    0x20(%esi),%eax
+  802878:	a3 64 80 80 00       	mov    %eax,0x808064
+  80287d:	8b 46 24             	mov    0x24(%esi),%eax
+  802880:	a3 68 80 80 00       	mov    %eax,0x808068
+  802885:	8b 46 28             	mov    0x28(%esi),%eax
+  802888:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  80288d:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802890:	a3 70 80 80 00       	mov    %eax,0x808070
+  802895:	8b 46 30             	mov    0x30(%esi),%eax
+  802898:	a3 74 80 80 00       	mov    %eax,0x808074
+  80289d:	8b 46 34             	mov    0x34(%esi),%eax
+  8028a0:	a3 78 80 80 00       	mov    %eax,0x808078
+  8028a5:	8b 46 38             	mov    0x38(%esi),%eax
+  8028a8:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8028ad:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8028b0:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8028b5:	8b 03                	mov    (%ebx),%eax
+  8028b7:	a3 84 80 80 00       	mov    %eax,0x808084
+  8028bc:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028bf:	a3 88 80 80 00       	mov    %eax,0x808088
+  8028c4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8028c7:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8028cc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8028cf:	a3 90 80 80 00       	mov    %eax,0x808090
+  8028d4:	8b 43 10             	mov    0x10(%ebx),%eax
+  8028d7:	a3 94 80 80 00       	mov    %eax,0x808094
+  8028dc:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028df:	a3 98 80 80 00       	mov    %eax,0x808098
+  8028e4:	8b 43 18             	mov    0x18(%ebx),%eax
+  8028e7:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8028ec:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8028ef:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8028f4:	8b 43 20             	mov    0x20(%ebx),%eax
+  8028f7:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8028fc:	8b 43 24             	mov    0x24(%ebx),%eax
+  8028ff:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802904:	8b 43 28             	mov    0x28(%ebx),%eax
+  802907:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  80290c:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  80290f:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802914:	8b 43 30             	mov    0x30(%ebx),%eax
+  802917:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  80291c:	8b 43 34             	mov    0x34(%ebx),%eax
+  80291f:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802924:	8b 43 38             	mov    0x38(%ebx),%eax
+  802927:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  80292c:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80292f:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802934:	8b 45 18             	mov    0x18(%ebp),%eax
+  802937:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80293c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802941:	e8 2b f6 ff ff       	call   801f71 <nsipc>
+  802946:	85 c0                	test   %eax,%eax
+  802948:	0f 88 ad 01 00 00    	js     802afb <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80294e:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802954:	89 17                	mov    %edx,(%edi)
+  802956:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80295c:	89 57 04             	mov    %edx,0x4(%edi)
+  80295f:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802965:	89 57 08             	mov    %edx,0x8(%edi)
+  802968:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80296e:	89 57 0c             	mov    %edx,0xc(%edi)
+  802971:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802977:	89 57 10             	mov    %edx,0x10(%edi)
+  80297a:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802980:	89 57 14             	mov    %edx,0x14(%edi)
+  802983:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802989:	89 57 18             	mov    %edx,0x18(%edi)
+  80298c:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802992:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802995:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  80299b:	89 57 20             	mov    %edx,0x20(%edi)
+  80299e:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8029a4:	89 57 24             	mov    %edx,0x24(%edi)
+  8029a7:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8029ad:	89 57 28             	mov    %edx,0x28(%edi)
+  8029b0:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8029b6:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8029b9:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8029bf:	89 57 30             	mov    %edx,0x30(%edi)
+  8029c2:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8029c8:	89 57 34             	mov    %edx,0x34(%edi)
+  8029cb:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8029d1:	89 57 38             	mov    %edx,0x38(%edi)
+  8029d4:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8029da:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8029dd:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8029e3:	89 16                	mov    %edx,(%esi)
+  8029e5:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8029eb:	89 56 04             	mov    %edx,0x4(%esi)
+  8029ee:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8029f4:	89 56 08             	mov    %edx,0x8(%esi)
+  8029f7:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8029fd:	89 56 0c             	mov    %edx,0xc(%esi)
+  802a00:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802a06:	89 56 10             	mov    %edx,0x10(%esi)
+  802a09:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802a0f:	89 56 14             	mov    %edx,0x14(%esi)
+  802a12:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802a18:	89 56 18             	mov    %edx,0x18(%esi)
+  802a1b:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802a21:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802a24:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802a2a:	89 56 20             	mov    %edx,0x20(%esi)
+  802a2d:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802a33:	89 56 24             	mov    %edx,0x24(%esi)
+  802a36:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802a3c:	89 56 28             	mov    %edx,0x28(%esi)
+  802a3f:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802a45:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802a48:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802a4e:	89 56 30             	mov    %edx,0x30(%esi)
+  802a51:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802a57:	89 56 34             	mov    %edx,0x34(%esi)
+  802a5a:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802a60:	89 56 38             	mov    %edx,0x38(%esi)
+  802a63:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802a69:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802a6c:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802a72:	89 13                	mov    %edx,(%ebx)
+  802a74:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802a7a:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a7d:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802a83:	89 53 08             	mov    %edx,0x8(%ebx)
+  802a86:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802a8c:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802a8f:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802a95:	89 53 10             	mov    %edx,0x10(%ebx)
+  802a98:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802a9e:	89 53 14             	mov    %edx,0x14(%ebx)
+  802aa1:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802aa7:	89 53 18             	mov    %edx,0x18(%ebx)
+  802aaa:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802ab0:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802ab3:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802ab9:	89 53 20             	mov    %edx,0x20(%ebx)
+  802abc:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802ac2:	89 53 24             	mov    %edx,0x24(%ebx)
+  802ac5:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802acb:	89 53 28             	mov    %edx,0x28(%ebx)
+  802ace:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802ad4:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802ad7:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802add:	89 53 30             	mov    %edx,0x30(%ebx)
+  802ae0:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802ae6:	89 53 34             	mov    %edx,0x34(%ebx)
+  802ae9:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802aef:	89 53 38             	mov    %edx,0x38(%ebx)
+  802af2:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802af8:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802afb:	83 c4 0c             	add    $0xc,%esp
+  802afe:	5b                   	pop    %ebx
+  802aff:	5e                   	pop    %esi
+  802b00:	5f                   	pop    %edi
+  802b01:	5d                   	pop    %ebp
+  802b02:	c3                   	ret
+
+00802b03 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802b11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b14:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802b19:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b1c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802b21:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802b26:	e8 46 f4 ff ff       	call   801f71 <nsipc>
+}
+  802b2b:	c9                   	leave
+  802b2c:	c3                   	ret
+
+00802b2d <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	56                   	push   %esi
+  802b31:	53                   	push   %ebx
+  802b32:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802b35:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802b3b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b3e:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802b43:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b48:	e8 24 f4 ff ff       	call   801f71 <nsipc>
+  802b4d:	89 c3                	mov    %eax,%ebx
+  802b4f:	85 c0                	test   %eax,%eax
+  802b51:	7e 1f                	jle    802b72 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802b53:	39 c6                	cmp    %eax,%esi
+  802b55:	7c 24                	jl     802b7b <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802b57:	83 ec 04             	sub    $0x4,%esp
+  802b5a:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802b61:	50                   	push   %eax
+  802b62:	68 00 80 80 00       	push   $0x808000
+  802b67:	ff 75 08             	push   0x8(%ebp)
+  802b6a:	e8 86 df ff ff       	call   800af5 <memmove>
+  802b6f:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802b72:	89 d8                	mov    %ebx,%eax
+  802b74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b77:	5b                   	pop    %ebx
+  802b78:	5e                   	pop    %esi
+  802b79:	5d                   	pop    %ebp
+  802b7a:	c3                   	ret
+		assert(r <= max);
+  802b7b:	68 56 40 80 00       	push   $0x804056
+  802b80:	68 29 40 80 00       	push   $0x804029
+  802b85:	68 6a 01 00 00       	push   $0x16a
+  802b8a:	68 3e 40 80 00       	push   $0x80403e
+  802b8f:	e8 df d5 ff ff       	call   800173 <_panic>
+
+00802b94 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b94:	55                   	push   %ebp
+  802b95:	89 e5                	mov    %esp,%ebp
+  802b97:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802ba2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ba5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802baa:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bad:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802bb2:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bb7:	e8 b5 f3 ff ff       	call   801f71 <nsipc>
+}
+  802bbc:	c9                   	leave
+  802bbd:	c3                   	ret
+
+00802bbe <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802bc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc7:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802bcc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802bd1:	e8 9b f3 ff ff       	call   801f71 <nsipc>
+}
+  802bd6:	c9                   	leave
+  802bd7:	c3                   	ret
+
+00802bd8 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	53                   	push   %ebx
+  802bdc:	83 ec 04             	sub    $0x4,%esp
+  802bdf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802be2:	b8 12 00 00 00       	mov    $0x12,%eax
+  802be7:	e8 85 f3 ff ff       	call   801f71 <nsipc>
+  802bec:	85 c0                	test   %eax,%eax
+  802bee:	78 50                	js     802c40 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802bf0:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802bf6:	89 13                	mov    %edx,(%ebx)
+  802bf8:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802bfe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c01:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802c07:	89 53 08             	mov    %edx,0x8(%ebx)
+  802c0a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802c10:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802c13:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802c19:	89 53 10             	mov    %edx,0x10(%ebx)
+  802c1c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802c22:	89 53 14             	mov    %edx,0x14(%ebx)
+  802c25:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802c2b:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c2e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802c34:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802c37:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802c3d:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802c40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c43:	c9                   	leave
+  802c44:	c3                   	ret
+
+00802c45 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802c45:	55                   	push   %ebp
+  802c46:	89 e5                	mov    %esp,%ebp
+  802c48:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c4b:	6a 03                	push   $0x3
+  802c4d:	e8 bf 0c 00 00       	call   803911 <ipc_find_env>
+  802c52:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c5a:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802c5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802c64:	e8 08 f3 ff ff       	call   801f71 <nsipc>
+  802c69:	83 c4 10             	add    $0x10,%esp
+  802c6c:	85 c0                	test   %eax,%eax
+  802c6e:	78 0a                	js     802c7a <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802c70:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802c75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	57                   	push   %edi
+  802c80:	56                   	push   %esi
+  802c81:	53                   	push   %ebx
+  802c82:	83 ec 1c             	sub    $0x1c,%esp
+  802c85:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c88:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802c8b:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802c90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c95:	89 e0                	mov    %esp,%eax
+  802c97:	89 f2                	mov    %esi,%edx
+  802c99:	29 c2                	sub    %eax,%edx
+  802c9b:	89 d0                	mov    %edx,%eax
+  802c9d:	c1 e8 0f             	shr    $0xf,%eax
+  802ca0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802ca6:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802ca9:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802cb0:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802cb3:	83 ec 0c             	sub    $0xc,%esp
+  802cb6:	ff 75 e0             	push   -0x20(%ebp)
+  802cb9:	e8 92 0c 00 00       	call   803950 <pageref>
+  802cbe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802cc1:	83 c4 04             	add    $0x4,%esp
+  802cc4:	ff 75 dc             	push   -0x24(%ebp)
+  802cc7:	e8 84 0c 00 00       	call   803950 <pageref>
+  802ccc:	89 e2                	mov    %esp,%edx
+  802cce:	89 f1                	mov    %esi,%ecx
+  802cd0:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802cd2:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802cd5:	89 ca                	mov    %ecx,%edx
+  802cd7:	c1 ea 0f             	shr    $0xf,%edx
+  802cda:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802ce0:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802ce3:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802cea:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802ced:	39 d7                	cmp    %edx,%edi
+  802cef:	74 40                	je     802d31 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802cf1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cf4:	75 9f                	jne    802c95 <_pipeisclosed+0x19>
+  802cf6:	89 e2                	mov    %esp,%edx
+  802cf8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802cfd:	29 d0                	sub    %edx,%eax
+  802cff:	89 c2                	mov    %eax,%edx
+  802d01:	c1 ea 0f             	shr    $0xf,%edx
+  802d04:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0e:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d11:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802d18:	8b 40 58             	mov    0x58(%eax),%eax
+  802d1b:	6a 01                	push   $0x1
+  802d1d:	50                   	push   %eax
+  802d1e:	57                   	push   %edi
+  802d1f:	68 5f 40 80 00       	push   $0x80405f
+  802d24:	e8 25 d5 ff ff       	call   80024e <cprintf>
+  802d29:	83 c4 10             	add    $0x10,%esp
+  802d2c:	e9 5f ff ff ff       	jmp    802c90 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802d31:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d34:	0f 94 c0             	sete   %al
+  802d37:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d3d:	5b                   	pop    %ebx
+  802d3e:	5e                   	pop    %esi
+  802d3f:	5f                   	pop    %edi
+  802d40:	5d                   	pop    %ebp
+  802d41:	c3                   	ret
+
+00802d42 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802d42:	55                   	push   %ebp
+  802d43:	89 e5                	mov    %esp,%ebp
+  802d45:	53                   	push   %ebx
+  802d46:	83 ec 0c             	sub    $0xc,%esp
+  802d49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802d4c:	53                   	push   %ebx
+  802d4d:	6a 00                	push   $0x0
+  802d4f:	e8 aa e0 ff ff       	call   800dfe <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d54:	89 1c 24             	mov    %ebx,(%esp)
+  802d57:	e8 f4 e4 ff ff       	call   801250 <fd2data>
+  802d5c:	83 c4 08             	add    $0x8,%esp
+  802d5f:	50                   	push   %eax
+  802d60:	6a 00                	push   $0x0
+  802d62:	e8 97 e0 ff ff       	call   800dfe <sys_page_unmap>
+}
+  802d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d6a:	c9                   	leave
+  802d6b:	c3                   	ret
+
+00802d6c <devpipe_read>:
+{
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	57                   	push   %edi
+  802d70:	56                   	push   %esi
+  802d71:	53                   	push   %ebx
+  802d72:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802d75:	ff 75 08             	push   0x8(%ebp)
+  802d78:	e8 d3 e4 ff ff       	call   801250 <fd2data>
+  802d7d:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d7f:	8b 70 04             	mov    0x4(%eax),%esi
+  802d82:	8b 00                	mov    (%eax),%eax
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	39 f0                	cmp    %esi,%eax
+  802d89:	75 36                	jne    802dc1 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802d8b:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802d8e:	89 da                	mov    %ebx,%edx
+  802d90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d93:	e8 e4 fe ff ff       	call   802c7c <_pipeisclosed>
+  802d98:	85 c0                	test   %eax,%eax
+  802d9a:	0f 85 d4 00 00 00    	jne    802e74 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802da0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802da5:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802da9:	83 ec 04             	sub    $0x4,%esp
+  802dac:	6a ff                	push   $0xffffffff
+  802dae:	56                   	push   %esi
+  802daf:	57                   	push   %edi
+  802db0:	e8 c2 e3 ff ff       	call   801177 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802db5:	8b 73 04             	mov    0x4(%ebx),%esi
+  802db8:	8b 03                	mov    (%ebx),%eax
+  802dba:	83 c4 10             	add    $0x10,%esp
+  802dbd:	39 c6                	cmp    %eax,%esi
+  802dbf:	74 cd                	je     802d8e <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802dc1:	8b 73 04             	mov    0x4(%ebx),%esi
+  802dc4:	8b 03                	mov    (%ebx),%eax
+  802dc6:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802dcc:	29 c6                	sub    %eax,%esi
+  802dce:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dd3:	f7 e6                	mul    %esi
+  802dd5:	c1 ea 0c             	shr    $0xc,%edx
+  802dd8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802dde:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802de0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802de3:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802de7:	8b 0b                	mov    (%ebx),%ecx
+  802de9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dee:	f7 e1                	mul    %ecx
+  802df0:	c1 ea 0b             	shr    $0xb,%edx
+  802df3:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802df9:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802dfb:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802e00:	29 cf                	sub    %ecx,%edi
+  802e02:	39 f7                	cmp    %esi,%edi
+  802e04:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802e07:	83 ec 04             	sub    $0x4,%esp
+  802e0a:	57                   	push   %edi
+  802e0b:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802e0f:	50                   	push   %eax
+  802e10:	ff 75 0c             	push   0xc(%ebp)
+  802e13:	e8 dd dc ff ff       	call   800af5 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802e18:	83 c4 0c             	add    $0xc,%esp
+  802e1b:	89 f0                	mov    %esi,%eax
+  802e1d:	29 f8                	sub    %edi,%eax
+  802e1f:	50                   	push   %eax
+  802e20:	8d 43 10             	lea    0x10(%ebx),%eax
+  802e23:	50                   	push   %eax
+  802e24:	89 f8                	mov    %edi,%eax
+  802e26:	03 45 0c             	add    0xc(%ebp),%eax
+  802e29:	50                   	push   %eax
+  802e2a:	e8 c6 dc ff ff       	call   800af5 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802e2f:	8b 0b                	mov    (%ebx),%ecx
+  802e31:	01 f1                	add    %esi,%ecx
+  802e33:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e38:	f7 e1                	mul    %ecx
+  802e3a:	c1 ea 0c             	shr    $0xc,%edx
+  802e3d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802e43:	29 c1                	sub    %eax,%ecx
+  802e45:	89 0b                	mov    %ecx,(%ebx)
+  802e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e4c:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802e50:	83 c4 10             	add    $0x10,%esp
+  802e53:	85 c0                	test   %eax,%eax
+  802e55:	75 0a                	jne    802e61 <devpipe_read+0xf5>
+	return n;
+  802e57:	89 f0                	mov    %esi,%eax
+}
+  802e59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e5c:	5b                   	pop    %ebx
+  802e5d:	5e                   	pop    %esi
+  802e5e:	5f                   	pop    %edi
+  802e5f:	5d                   	pop    %ebp
+  802e60:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802e61:	83 ec 08             	sub    $0x8,%esp
+  802e64:	68 00 04 00 00       	push   $0x400
+  802e69:	53                   	push   %ebx
+  802e6a:	e8 2a e3 ff ff       	call   801199 <sys_futex_wake>
+  802e6f:	83 c4 10             	add    $0x10,%esp
+  802e72:	eb e3                	jmp    802e57 <devpipe_read+0xeb>
+			return 0;
+  802e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e79:	eb de                	jmp    802e59 <devpipe_read+0xed>
+
+00802e7b <devpipe_write>:
+{
+  802e7b:	55                   	push   %ebp
+  802e7c:	89 e5                	mov    %esp,%ebp
+  802e7e:	57                   	push   %edi
+  802e7f:	56                   	push   %esi
+  802e80:	53                   	push   %ebx
+  802e81:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802e84:	ff 75 08             	push   0x8(%ebp)
+  802e87:	e8 c4 e3 ff ff       	call   801250 <fd2data>
+  802e8c:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802e8e:	83 c4 10             	add    $0x10,%esp
+  802e91:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e98:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802e9d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ea1:	0f 84 43 01 00 00    	je     802fea <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ea7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802eaa:	8b 06                	mov    (%esi),%eax
+  802eac:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802eb2:	29 c1                	sub    %eax,%ecx
+  802eb4:	89 c8                	mov    %ecx,%eax
+  802eb6:	f7 e7                	mul    %edi
+  802eb8:	c1 ea 0c             	shr    $0xc,%edx
+  802ebb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ec1:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802ec3:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802ec9:	75 52                	jne    802f1d <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802ecb:	89 f2                	mov    %esi,%edx
+  802ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ed0:	e8 a7 fd ff ff       	call   802c7c <_pipeisclosed>
+  802ed5:	85 c0                	test   %eax,%eax
+  802ed7:	0f 85 28 01 00 00    	jne    803005 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802edd:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802edf:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ee2:	8b 06                	mov    (%esi),%eax
+  802ee4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802eea:	29 c1                	sub    %eax,%ecx
+  802eec:	89 c8                	mov    %ecx,%eax
+  802eee:	f7 e7                	mul    %edi
+  802ef0:	c1 ea 0c             	shr    $0xc,%edx
+  802ef3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ef9:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802efb:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802f01:	75 a4                	jne    802ea7 <devpipe_write+0x2c>
+  802f03:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f08:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802f0c:	83 ec 04             	sub    $0x4,%esp
+  802f0f:	6a ff                	push   $0xffffffff
+  802f11:	53                   	push   %ebx
+  802f12:	56                   	push   %esi
+  802f13:	e8 5f e2 ff ff       	call   801177 <sys_futex_wait>
+}
+  802f18:	83 c4 10             	add    $0x10,%esp
+  802f1b:	eb 8a                	jmp    802ea7 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f1d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f20:	8b 06                	mov    (%esi),%eax
+  802f22:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f28:	29 c1                	sub    %eax,%ecx
+  802f2a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f2f:	f7 e1                	mul    %ecx
+  802f31:	c1 ea 0c             	shr    $0xc,%edx
+  802f34:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f3a:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802f3c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802f41:	89 d8                	mov    %ebx,%eax
+  802f43:	29 c8                	sub    %ecx,%eax
+  802f45:	8b 55 10             	mov    0x10(%ebp),%edx
+  802f48:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f4b:	29 ca                	sub    %ecx,%edx
+  802f4d:	39 d0                	cmp    %edx,%eax
+  802f4f:	0f 46 d0             	cmovbe %eax,%edx
+  802f52:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802f55:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f58:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f5d:	f7 e1                	mul    %ecx
+  802f5f:	c1 ea 0b             	shr    $0xb,%edx
+  802f62:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f68:	89 ca                	mov    %ecx,%edx
+  802f6a:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802f6c:	29 d3                	sub    %edx,%ebx
+  802f6e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f71:	39 c3                	cmp    %eax,%ebx
+  802f73:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802f76:	83 ec 04             	sub    $0x4,%esp
+  802f79:	53                   	push   %ebx
+  802f7a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f7d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802f80:	51                   	push   %ecx
+  802f81:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802f85:	50                   	push   %eax
+  802f86:	e8 6a db ff ff       	call   800af5 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802f8b:	83 c4 0c             	add    $0xc,%esp
+  802f8e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f91:	29 d8                	sub    %ebx,%eax
+  802f93:	50                   	push   %eax
+  802f94:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f97:	01 cb                	add    %ecx,%ebx
+  802f99:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f9c:	53                   	push   %ebx
+  802f9d:	8d 46 10             	lea    0x10(%esi),%eax
+  802fa0:	50                   	push   %eax
+  802fa1:	e8 4f db ff ff       	call   800af5 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802fa6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fa9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802fac:	01 c1                	add    %eax,%ecx
+  802fae:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fb3:	f7 e1                	mul    %ecx
+  802fb5:	c1 ea 0c             	shr    $0xc,%edx
+  802fb8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802fbe:	89 ca                	mov    %ecx,%edx
+  802fc0:	29 c2                	sub    %eax,%edx
+  802fc2:	89 56 04             	mov    %edx,0x4(%esi)
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802fce:	83 c4 10             	add    $0x10,%esp
+  802fd1:	85 c0                	test   %eax,%eax
+  802fd3:	75 1a                	jne    802fef <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802fd5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802fd8:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802fdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fde:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802fe1:	0f 82 c0 fe ff ff    	jb     802ea7 <devpipe_write+0x2c>
+  802fe7:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802fea:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fed:	eb 1b                	jmp    80300a <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802fef:	83 ec 08             	sub    $0x8,%esp
+  802ff2:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802ff7:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802ffa:	50                   	push   %eax
+  802ffb:	e8 99 e1 ff ff       	call   801199 <sys_futex_wake>
+  803000:	83 c4 10             	add    $0x10,%esp
+  803003:	eb d0                	jmp    802fd5 <devpipe_write+0x15a>
+				return 0;
+  803005:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80300a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80300d:	5b                   	pop    %ebx
+  80300e:	5e                   	pop    %esi
+  80300f:	5f                   	pop    %edi
+  803010:	5d                   	pop    %ebp
+  803011:	c3                   	ret
+
+00803012 <devpipe_stat>:
+{
+  803012:	55                   	push   %ebp
+  803013:	89 e5                	mov    %esp,%ebp
+  803015:	56                   	push   %esi
+  803016:	53                   	push   %ebx
+  803017:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80301a:	83 ec 0c             	sub    $0xc,%esp
+  80301d:	ff 75 08             	push   0x8(%ebp)
+  803020:	e8 2b e2 ff ff       	call   801250 <fd2data>
+  803025:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803027:	83 c4 08             	add    $0x8,%esp
+  80302a:	68 72 40 80 00       	push   $0x804072
+  80302f:	53                   	push   %ebx
+  803030:	e8 10 d9 ff ff       	call   800945 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803035:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803038:	8b 06                	mov    (%esi),%eax
+  80303a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803040:	29 c1                	sub    %eax,%ecx
+  803042:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803047:	89 c8                	mov    %ecx,%eax
+  803049:	f7 e2                	mul    %edx
+  80304b:	c1 ea 0c             	shr    $0xc,%edx
+  80304e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803054:	29 d1                	sub    %edx,%ecx
+  803056:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80305c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803063:	00 00 00 
+	stat->st_dev = &devpipe;
+  803066:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80306d:	50 80 00 
+}
+  803070:	b8 00 00 00 00       	mov    $0x0,%eax
+  803075:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803078:	5b                   	pop    %ebx
+  803079:	5e                   	pop    %esi
+  80307a:	5d                   	pop    %ebp
+  80307b:	c3                   	ret
+
+0080307c <devpipe_poll>:
+{
+  80307c:	55                   	push   %ebp
+  80307d:	89 e5                	mov    %esp,%ebp
+  80307f:	57                   	push   %edi
+  803080:	56                   	push   %esi
+  803081:	53                   	push   %ebx
+  803082:	83 ec 18             	sub    $0x18,%esp
+  803085:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803088:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80308b:	57                   	push   %edi
+  80308c:	e8 bf e1 ff ff       	call   801250 <fd2data>
+  803091:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803093:	83 c4 10             	add    $0x10,%esp
+  803096:	89 f3                	mov    %esi,%ebx
+  803098:	83 e3 01             	and    $0x1,%ebx
+  80309b:	75 27                	jne    8030c4 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80309d:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8030a3:	75 48                	jne    8030ed <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8030a5:	89 ca                	mov    %ecx,%edx
+  8030a7:	89 f8                	mov    %edi,%eax
+  8030a9:	e8 ce fb ff ff       	call   802c7c <_pipeisclosed>
+  8030ae:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8030b0:	89 d8                	mov    %ebx,%eax
+  8030b2:	83 c8 10             	or     $0x10,%eax
+  8030b5:	85 d2                	test   %edx,%edx
+  8030b7:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8030ba:	89 d8                	mov    %ebx,%eax
+  8030bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030bf:	5b                   	pop    %ebx
+  8030c0:	5e                   	pop    %esi
+  8030c1:	5f                   	pop    %edi
+  8030c2:	5d                   	pop    %ebp
+  8030c3:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030c4:	8b 58 04             	mov    0x4(%eax),%ebx
+  8030c7:	8b 00                	mov    (%eax),%eax
+  8030c9:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8030cf:	29 c3                	sub    %eax,%ebx
+  8030d1:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030d6:	89 d8                	mov    %ebx,%eax
+  8030d8:	f7 e2                	mul    %edx
+  8030da:	c1 ea 0c             	shr    $0xc,%edx
+  8030dd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8030e3:	39 d3                	cmp    %edx,%ebx
+  8030e5:	0f 95 c3             	setne  %bl
+  8030e8:	0f b6 db             	movzbl %bl,%ebx
+  8030eb:	eb b0                	jmp    80309d <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030ed:	8b 71 04             	mov    0x4(%ecx),%esi
+  8030f0:	8b 01                	mov    (%ecx),%eax
+  8030f2:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8030f8:	29 c6                	sub    %eax,%esi
+  8030fa:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030ff:	89 f0                	mov    %esi,%eax
+  803101:	f7 e2                	mul    %edx
+  803103:	c1 ea 0c             	shr    $0xc,%edx
+  803106:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80310c:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80310e:	89 d8                	mov    %ebx,%eax
+  803110:	83 c8 04             	or     $0x4,%eax
+  803113:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803119:	0f 42 d8             	cmovb  %eax,%ebx
+  80311c:	eb 87                	jmp    8030a5 <devpipe_poll+0x29>
+
+0080311e <pipe>:
+{
+  80311e:	55                   	push   %ebp
+  80311f:	89 e5                	mov    %esp,%ebp
+  803121:	56                   	push   %esi
+  803122:	53                   	push   %ebx
+  803123:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803126:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803129:	50                   	push   %eax
+  80312a:	e8 38 e1 ff ff       	call   801267 <fd_alloc>
+  80312f:	89 c3                	mov    %eax,%ebx
+  803131:	83 c4 10             	add    $0x10,%esp
+  803134:	85 c0                	test   %eax,%eax
+  803136:	0f 88 23 01 00 00    	js     80325f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80313c:	83 ec 04             	sub    $0x4,%esp
+  80313f:	68 07 04 00 00       	push   $0x407
+  803144:	ff 75 f4             	push   -0xc(%ebp)
+  803147:	6a 00                	push   $0x0
+  803149:	e8 2b dc ff ff       	call   800d79 <sys_page_alloc>
+  80314e:	89 c3                	mov    %eax,%ebx
+  803150:	83 c4 10             	add    $0x10,%esp
+  803153:	85 c0                	test   %eax,%eax
+  803155:	0f 88 04 01 00 00    	js     80325f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80315b:	83 ec 0c             	sub    $0xc,%esp
+  80315e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803161:	50                   	push   %eax
+  803162:	e8 00 e1 ff ff       	call   801267 <fd_alloc>
+  803167:	89 c3                	mov    %eax,%ebx
+  803169:	83 c4 10             	add    $0x10,%esp
+  80316c:	85 c0                	test   %eax,%eax
+  80316e:	0f 88 db 00 00 00    	js     80324f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803174:	83 ec 04             	sub    $0x4,%esp
+  803177:	68 07 04 00 00       	push   $0x407
+  80317c:	ff 75 f0             	push   -0x10(%ebp)
+  80317f:	6a 00                	push   $0x0
+  803181:	e8 f3 db ff ff       	call   800d79 <sys_page_alloc>
+  803186:	89 c3                	mov    %eax,%ebx
+  803188:	83 c4 10             	add    $0x10,%esp
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	0f 88 bc 00 00 00    	js     80324f <pipe+0x131>
+	va = fd2data(fd0);
+  803193:	83 ec 0c             	sub    $0xc,%esp
+  803196:	ff 75 f4             	push   -0xc(%ebp)
+  803199:	e8 b2 e0 ff ff       	call   801250 <fd2data>
+  80319e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031a0:	83 c4 0c             	add    $0xc,%esp
+  8031a3:	68 07 04 00 00       	push   $0x407
+  8031a8:	50                   	push   %eax
+  8031a9:	6a 00                	push   $0x0
+  8031ab:	e8 c9 db ff ff       	call   800d79 <sys_page_alloc>
+  8031b0:	89 c3                	mov    %eax,%ebx
+  8031b2:	83 c4 10             	add    $0x10,%esp
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	0f 88 82 00 00 00    	js     80323f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031bd:	83 ec 0c             	sub    $0xc,%esp
+  8031c0:	ff 75 f0             	push   -0x10(%ebp)
+  8031c3:	e8 88 e0 ff ff       	call   801250 <fd2data>
+  8031c8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8031cf:	50                   	push   %eax
+  8031d0:	6a 00                	push   $0x0
+  8031d2:	56                   	push   %esi
+  8031d3:	6a 00                	push   $0x0
+  8031d5:	e8 e2 db ff ff       	call   800dbc <sys_page_map>
+  8031da:	89 c3                	mov    %eax,%ebx
+  8031dc:	83 c4 20             	add    $0x20,%esp
+  8031df:	85 c0                	test   %eax,%eax
+  8031e1:	78 4e                	js     803231 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031e3:	a1 60 50 80 00       	mov    0x805060,%eax
+  8031e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031eb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031f7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031fa:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031ff:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803206:	83 ec 0c             	sub    $0xc,%esp
+  803209:	ff 75 f4             	push   -0xc(%ebp)
+  80320c:	e8 2f e0 ff ff       	call   801240 <fd2num>
+  803211:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803214:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803216:	83 c4 04             	add    $0x4,%esp
+  803219:	ff 75 f0             	push   -0x10(%ebp)
+  80321c:	e8 1f e0 ff ff       	call   801240 <fd2num>
+  803221:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803224:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803227:	83 c4 10             	add    $0x10,%esp
+  80322a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80322f:	eb 2e                	jmp    80325f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803231:	83 ec 08             	sub    $0x8,%esp
+  803234:	56                   	push   %esi
+  803235:	6a 00                	push   $0x0
+  803237:	e8 c2 db ff ff       	call   800dfe <sys_page_unmap>
+  80323c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80323f:	83 ec 08             	sub    $0x8,%esp
+  803242:	ff 75 f0             	push   -0x10(%ebp)
+  803245:	6a 00                	push   $0x0
+  803247:	e8 b2 db ff ff       	call   800dfe <sys_page_unmap>
+  80324c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80324f:	83 ec 08             	sub    $0x8,%esp
+  803252:	ff 75 f4             	push   -0xc(%ebp)
+  803255:	6a 00                	push   $0x0
+  803257:	e8 a2 db ff ff       	call   800dfe <sys_page_unmap>
+  80325c:	83 c4 10             	add    $0x10,%esp
+}
+  80325f:	89 d8                	mov    %ebx,%eax
+  803261:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803264:	5b                   	pop    %ebx
+  803265:	5e                   	pop    %esi
+  803266:	5d                   	pop    %ebp
+  803267:	c3                   	ret
+
+00803268 <pipeisclosed>:
+{
+  803268:	55                   	push   %ebp
+  803269:	89 e5                	mov    %esp,%ebp
+  80326b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80326e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803271:	50                   	push   %eax
+  803272:	ff 75 08             	push   0x8(%ebp)
+  803275:	e8 3d e0 ff ff       	call   8012b7 <fd_lookup>
+  80327a:	83 c4 10             	add    $0x10,%esp
+  80327d:	85 c0                	test   %eax,%eax
+  80327f:	78 18                	js     803299 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803281:	83 ec 0c             	sub    $0xc,%esp
+  803284:	ff 75 f4             	push   -0xc(%ebp)
+  803287:	e8 c4 df ff ff       	call   801250 <fd2data>
+  80328c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80328e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803291:	e8 e6 f9 ff ff       	call   802c7c <_pipeisclosed>
+  803296:	83 c4 10             	add    $0x10,%esp
+}
+  803299:	c9                   	leave
+  80329a:	c3                   	ret
+
+0080329b <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80329b:	55                   	push   %ebp
+  80329c:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80329e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032a7:	5d                   	pop    %ebp
+  8032a8:	c3                   	ret
+
+008032a9 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8032a9:	55                   	push   %ebp
+  8032aa:	89 e5                	mov    %esp,%ebp
+  8032ac:	53                   	push   %ebx
+  8032ad:	83 ec 04             	sub    $0x4,%esp
+  8032b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8032b3:	8b 03                	mov    (%ebx),%eax
+  8032b5:	85 c0                	test   %eax,%eax
+  8032b7:	75 05                	jne    8032be <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8032b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032bc:	c9                   	leave
+  8032bd:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8032be:	83 ec 08             	sub    $0x8,%esp
+  8032c1:	50                   	push   %eax
+  8032c2:	8d 43 04             	lea    0x4(%ebx),%eax
+  8032c5:	50                   	push   %eax
+  8032c6:	e8 83 dd ff ff       	call   80104e <sys_page_batch>
+	pb->pb_n = 0;
+  8032cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	eb e3                	jmp    8032b9 <pgbatch_flush+0x10>
+
+008032d6 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8032d6:	55                   	push   %ebp
+  8032d7:	89 e5                	mov    %esp,%ebp
+  8032d9:	56                   	push   %esi
+  8032da:	53                   	push   %ebx
+  8032db:	89 c3                	mov    %eax,%ebx
+  8032dd:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032df:	83 38 20             	cmpl   $0x20,(%eax)
+  8032e2:	74 2c                	je     803310 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8032e4:	8b 03                	mov    (%ebx),%eax
+  8032e6:	8d 50 01             	lea    0x1(%eax),%edx
+  8032e9:	89 13                	mov    %edx,(%ebx)
+  8032eb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8032ee:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8032f2:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8032f4:	83 ec 04             	sub    $0x4,%esp
+  8032f7:	6a 18                	push   $0x18
+  8032f9:	6a 00                	push   $0x0
+  8032fb:	50                   	push   %eax
+  8032fc:	e8 bf d7 ff ff       	call   800ac0 <memset>
+	return 0;
+  803301:	83 c4 10             	add    $0x10,%esp
+  803304:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803309:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80330c:	5b                   	pop    %ebx
+  80330d:	5e                   	pop    %esi
+  80330e:	5d                   	pop    %ebp
+  80330f:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803310:	83 ec 0c             	sub    $0xc,%esp
+  803313:	50                   	push   %eax
+  803314:	e8 90 ff ff ff       	call   8032a9 <pgbatch_flush>
+  803319:	83 c4 10             	add    $0x10,%esp
+  80331c:	85 c0                	test   %eax,%eax
+  80331e:	79 c4                	jns    8032e4 <pgbatch_slot+0xe>
+  803320:	eb e7                	jmp    803309 <pgbatch_slot+0x33>
+
+00803322 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803322:	55                   	push   %ebp
+  803323:	89 e5                	mov    %esp,%ebp
+  803325:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803328:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80332b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332e:	e8 a3 ff ff ff       	call   8032d6 <pgbatch_slot>
+  803333:	85 c0                	test   %eax,%eax
+  803335:	78 20                	js     803357 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803337:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80333a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803340:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803343:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803346:	8b 55 10             	mov    0x10(%ebp),%edx
+  803349:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80334c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80334f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803357:	c9                   	leave
+  803358:	c3                   	ret
+
+00803359 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803359:	55                   	push   %ebp
+  80335a:	89 e5                	mov    %esp,%ebp
+  80335c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80335f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803362:	8b 45 08             	mov    0x8(%ebp),%eax
+  803365:	e8 6c ff ff ff       	call   8032d6 <pgbatch_slot>
+  80336a:	85 c0                	test   %eax,%eax
+  80336c:	78 2c                	js     80339a <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80336e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803371:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803377:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80337a:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80337d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803380:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803383:	8b 55 14             	mov    0x14(%ebp),%edx
+  803386:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803389:	8b 55 18             	mov    0x18(%ebp),%edx
+  80338c:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80338f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803392:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803395:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80339a:	c9                   	leave
+  80339b:	c3                   	ret
+
+0080339c <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80339c:	55                   	push   %ebp
+  80339d:	89 e5                	mov    %esp,%ebp
+  80339f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033a2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033a8:	e8 29 ff ff ff       	call   8032d6 <pgbatch_slot>
+  8033ad:	85 c0                	test   %eax,%eax
+  8033af:	78 1a                	js     8033cb <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8033b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033b4:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8033ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033bd:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033c3:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8033c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033cb:	c9                   	leave
+  8033cc:	c3                   	ret
+
+008033cd <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8033cd:	55                   	push   %ebp
+  8033ce:	89 e5                	mov    %esp,%ebp
+  8033d0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033d3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d9:	e8 f8 fe ff ff       	call   8032d6 <pgbatch_slot>
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	78 20                	js     803402 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8033e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033e5:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8033eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033ee:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033f4:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8033f7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033fa:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803402:	c9                   	leave
+  803403:	c3                   	ret
+
+00803404 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803404:	55                   	push   %ebp
+  803405:	89 e5                	mov    %esp,%ebp
+  803407:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80340a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80340d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803410:	e8 c1 fe ff ff       	call   8032d6 <pgbatch_slot>
+  803415:	85 c0                	test   %eax,%eax
+  803417:	78 26                	js     80343f <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803419:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80341c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803422:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803425:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803428:	8b 55 10             	mov    0x10(%ebp),%edx
+  80342b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80342e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803431:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803434:	8b 55 18             	mov    0x18(%ebp),%edx
+  803437:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80343a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80343f:	c9                   	leave
+  803440:	c3                   	ret
+
+00803441 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803441:	b8 00 00 00 00       	mov    $0x0,%eax
+  803446:	c3                   	ret
+
+00803447 <devcons_poll>:
+{
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	53                   	push   %ebx
+  80344b:	83 ec 04             	sub    $0x4,%esp
+  80344e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803451:	89 da                	mov    %ebx,%edx
+  803453:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803456:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  80345d:	74 0c                	je     80346b <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80345f:	89 d8                	mov    %ebx,%eax
+  803461:	83 e0 01             	and    $0x1,%eax
+  803464:	09 d0                	or     %edx,%eax
+}
+  803466:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803469:	c9                   	leave
+  80346a:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80346b:	e8 6b d8 ff ff       	call   800cdb <sys_cgetc>
+  803470:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803475:	89 da                	mov    %ebx,%edx
+  803477:	83 e2 04             	and    $0x4,%edx
+  80347a:	85 c0                	test   %eax,%eax
+  80347c:	74 e6                	je     803464 <devcons_poll+0x1d>
+  80347e:	eb df                	jmp    80345f <devcons_poll+0x18>
+
+00803480 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803480:	55                   	push   %ebp
+  803481:	89 e5                	mov    %esp,%ebp
+  803483:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803486:	68 7e 40 80 00       	push   $0x80407e
+  80348b:	ff 75 0c             	push   0xc(%ebp)
+  80348e:	e8 b2 d4 ff ff       	call   800945 <strcpy>
+	return 0;
+}
+  803493:	b8 00 00 00 00       	mov    $0x0,%eax
+  803498:	c9                   	leave
+  803499:	c3                   	ret
+
+0080349a <devcons_write>:
+{
+  80349a:	55                   	push   %ebp
+  80349b:	89 e5                	mov    %esp,%ebp
+  80349d:	57                   	push   %edi
+  80349e:	56                   	push   %esi
+  80349f:	53                   	push   %ebx
+  8034a0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8034a6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8034a9:	85 ff                	test   %edi,%edi
+  8034ab:	74 51                	je     8034fe <devcons_write+0x64>
+  8034ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8034b7:	89 fb                	mov    %edi,%ebx
+  8034b9:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8034bb:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8034c0:	39 d3                	cmp    %edx,%ebx
+  8034c2:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8034c5:	83 ec 04             	sub    $0x4,%esp
+  8034c8:	53                   	push   %ebx
+  8034c9:	03 45 0c             	add    0xc(%ebp),%eax
+  8034cc:	50                   	push   %eax
+  8034cd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034d3:	50                   	push   %eax
+  8034d4:	e8 1c d6 ff ff       	call   800af5 <memmove>
+		sys_cputs(buf, m);
+  8034d9:	83 c4 08             	add    $0x8,%esp
+  8034dc:	53                   	push   %ebx
+  8034dd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034e3:	50                   	push   %eax
+  8034e4:	e8 d4 d7 ff ff       	call   800cbd <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8034e9:	01 de                	add    %ebx,%esi
+  8034eb:	89 f0                	mov    %esi,%eax
+  8034ed:	83 c4 10             	add    $0x10,%esp
+  8034f0:	39 fe                	cmp    %edi,%esi
+  8034f2:	72 c3                	jb     8034b7 <devcons_write+0x1d>
+}
+  8034f4:	89 f0                	mov    %esi,%eax
+  8034f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034f9:	5b                   	pop    %ebx
+  8034fa:	5e                   	pop    %esi
+  8034fb:	5f                   	pop    %edi
+  8034fc:	5d                   	pop    %ebp
+  8034fd:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8034fe:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803503:	eb ef                	jmp    8034f4 <devcons_write+0x5a>
+
+00803505 <devcons_read>:
+{
+  803505:	55                   	push   %ebp
+  803506:	89 e5                	mov    %esp,%ebp
+  803508:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80350b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803510:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803514:	74 36                	je     80354c <devcons_read+0x47>
+	c = cons_peek;
+  803516:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  80351b:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  803522:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803525:	85 c0                	test   %eax,%eax
+  803527:	75 10                	jne    803539 <devcons_read+0x34>
+  803529:	e8 ad d7 ff ff       	call   800cdb <sys_cgetc>
+  80352e:	85 c0                	test   %eax,%eax
+  803530:	75 07                	jne    803539 <devcons_read+0x34>
+		sys_yield();
+  803532:	e8 23 d8 ff ff       	call   800d5a <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803537:	eb f0                	jmp    803529 <devcons_read+0x24>
+	if (c < 0)
+  803539:	85 c0                	test   %eax,%eax
+  80353b:	78 0f                	js     80354c <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80353d:	83 f8 04             	cmp    $0x4,%eax
+  803540:	74 0c                	je     80354e <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803542:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803545:	88 02                	mov    %al,(%edx)
+	return 1;
+  803547:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80354c:	c9                   	leave
+  80354d:	c3                   	ret
+		return 0;
+  80354e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803553:	eb f7                	jmp    80354c <devcons_read+0x47>
+
+00803555 <cputchar>:
+{
+  803555:	55                   	push   %ebp
+  803556:	89 e5                	mov    %esp,%ebp
+  803558:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80355b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80355e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803561:	6a 01                	push   $0x1
+  803563:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803566:	50                   	push   %eax
+  803567:	e8 51 d7 ff ff       	call   800cbd <sys_cputs>
+}
+  80356c:	83 c4 10             	add    $0x10,%esp
+  80356f:	c9                   	leave
+  803570:	c3                   	ret
+
+00803571 <getchar>:
+{
+  803571:	55                   	push   %ebp
+  803572:	89 e5                	mov    %esp,%ebp
+  803574:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803577:	6a 01                	push   $0x1
+  803579:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80357c:	50                   	push   %eax
+  80357d:	6a 00                	push   $0x0
+  80357f:	e8 b7 df ff ff       	call   80153b <read>
+	if (r < 0)
+  803584:	83 c4 10             	add    $0x10,%esp
+  803587:	85 c0                	test   %eax,%eax
+  803589:	78 06                	js     803591 <getchar+0x20>
+	if (r < 1)
+  80358b:	74 06                	je     803593 <getchar+0x22>
+	return c;
+  80358d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803591:	c9                   	leave
+  803592:	c3                   	ret
+		return -E_EOF;
+  803593:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803598:	eb f7                	jmp    803591 <getchar+0x20>
+
+0080359a <iscons>:
+{
+  80359a:	55                   	push   %ebp
+  80359b:	89 e5                	mov    %esp,%ebp
+  80359d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035a3:	50                   	push   %eax
+  8035a4:	ff 75 08             	push   0x8(%ebp)
+  8035a7:	e8 0b dd ff ff       	call   8012b7 <fd_lookup>
+  8035ac:	83 c4 10             	add    $0x10,%esp
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	78 11                	js     8035c4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8035b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035b6:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035bc:	39 10                	cmp    %edx,(%eax)
+  8035be:	0f 94 c0             	sete   %al
+  8035c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8035c4:	c9                   	leave
+  8035c5:	c3                   	ret
+
+008035c6 <opencons>:
+{
+  8035c6:	55                   	push   %ebp
+  8035c7:	89 e5                	mov    %esp,%ebp
+  8035c9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8035cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035cf:	50                   	push   %eax
+  8035d0:	e8 92 dc ff ff       	call   801267 <fd_alloc>
+  8035d5:	83 c4 10             	add    $0x10,%esp
+  8035d8:	85 c0                	test   %eax,%eax
+  8035da:	78 3a                	js     803616 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8035dc:	83 ec 04             	sub    $0x4,%esp
+  8035df:	68 07 04 00 00       	push   $0x407
+  8035e4:	ff 75 f4             	push   -0xc(%ebp)
+  8035e7:	6a 00                	push   $0x0
+  8035e9:	e8 8b d7 ff ff       	call   800d79 <sys_page_alloc>
+  8035ee:	83 c4 10             	add    $0x10,%esp
+  8035f1:	85 c0                	test   %eax,%eax
+  8035f3:	78 21                	js     803616 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8035f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035f8:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035fe:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803600:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803603:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80360a:	83 ec 0c             	sub    $0xc,%esp
+  80360d:	50                   	push   %eax
+  80360e:	e8 2d dc ff ff       	call   801240 <fd2num>
+  803613:	83 c4 10             	add    $0x10,%esp
+}
+  803616:	c9                   	leave
+  803617:	c3                   	ret
+
+00803618 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803618:	55                   	push   %ebp
+  803619:	89 e5                	mov    %esp,%ebp
+  80361b:	56                   	push   %esi
+  80361c:	53                   	push   %ebx
+  80361d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803620:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803623:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803626:	85 c0                	test   %eax,%eax
+  803628:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80362d:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803630:	83 ec 0c             	sub    $0xc,%esp
+  803633:	50                   	push   %eax
+  803634:	e8 f0 d8 ff ff       	call   800f29 <sys_ipc_recv>
+  803639:	83 c4 10             	add    $0x10,%esp
+  80363c:	85 c0                	test   %eax,%eax
+  80363e:	0f 88 8b 00 00 00    	js     8036cf <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803644:	85 f6                	test   %esi,%esi
+  803646:	74 2a                	je     803672 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803648:	89 e2                	mov    %esp,%edx
+  80364a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80364f:	29 d0                	sub    %edx,%eax
+  803651:	89 c2                	mov    %eax,%edx
+  803653:	c1 ea 0f             	shr    $0xf,%edx
+  803656:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80365b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803660:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803663:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80366a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803670:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803672:	85 db                	test   %ebx,%ebx
+  803674:	74 2a                	je     8036a0 <ipc_recv+0x88>
+  803676:	89 e2                	mov    %esp,%edx
+  803678:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80367d:	29 d0                	sub    %edx,%eax
+  80367f:	89 c2                	mov    %eax,%edx
+  803681:	c1 ea 0f             	shr    $0xf,%edx
+  803684:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803691:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803698:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80369e:	89 03                	mov    %eax,(%ebx)
+  8036a0:	89 e2                	mov    %esp,%edx
+  8036a2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036a7:	29 d0                	sub    %edx,%eax
+  8036a9:	89 c2                	mov    %eax,%edx
+  8036ab:	c1 ea 0f             	shr    $0xf,%edx
+  8036ae:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b8:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036bb:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8036c2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8036c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036cb:	5b                   	pop    %ebx
+  8036cc:	5e                   	pop    %esi
+  8036cd:	5d                   	pop    %ebp
+  8036ce:	c3                   	ret
+		if(from_env_store != NULL)
+  8036cf:	85 f6                	test   %esi,%esi
+  8036d1:	74 06                	je     8036d9 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8036d3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8036d9:	85 db                	test   %ebx,%ebx
+  8036db:	74 eb                	je     8036c8 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8036dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036e3:	eb e3                	jmp    8036c8 <ipc_recv+0xb0>
+
+008036e5 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8036e5:	55                   	push   %ebp
+  8036e6:	89 e5                	mov    %esp,%ebp
+  8036e8:	57                   	push   %edi
+  8036e9:	56                   	push   %esi
+  8036ea:	53                   	push   %ebx
+  8036eb:	83 ec 14             	sub    $0x14,%esp
+  8036ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036f4:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036f7:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8036fa:	85 c0                	test   %eax,%eax
+  8036fc:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803701:	0f 44 c2             	cmove  %edx,%eax
+  803704:	ff 75 10             	push   0x10(%ebp)
+  803707:	50                   	push   %eax
+  803708:	e8 7e d8 ff ff       	call   800f8b <sys_ipc_recv_pages>
+  80370d:	83 c4 10             	add    $0x10,%esp
+  803710:	85 c0                	test   %eax,%eax
+  803712:	0f 88 ba 00 00 00    	js     8037d2 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803718:	85 ff                	test   %edi,%edi
+  80371a:	74 2a                	je     803746 <ipc_recv_pages+0x61>
+  80371c:	89 e2                	mov    %esp,%edx
+  80371e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803723:	29 d0                	sub    %edx,%eax
+  803725:	89 c2                	mov    %eax,%edx
+  803727:	c1 ea 0f             	shr    $0xf,%edx
+  80372a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80372f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803734:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803737:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80373e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803744:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803746:	85 f6                	test   %esi,%esi
+  803748:	74 2a                	je     803774 <ipc_recv_pages+0x8f>
+  80374a:	89 e2                	mov    %esp,%edx
+  80374c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803751:	29 d0                	sub    %edx,%eax
+  803753:	89 c2                	mov    %eax,%edx
+  803755:	c1 ea 0f             	shr    $0xf,%edx
+  803758:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80375d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803762:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803765:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80376c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803772:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803774:	85 db                	test   %ebx,%ebx
+  803776:	74 2a                	je     8037a2 <ipc_recv_pages+0xbd>
+  803778:	89 e2                	mov    %esp,%edx
+  80377a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80377f:	29 d0                	sub    %edx,%eax
+  803781:	89 c2                	mov    %eax,%edx
+  803783:	c1 ea 0f             	shr    $0xf,%edx
+  803786:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80378b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803790:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803793:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80379a:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8037a0:	89 03                	mov    %eax,(%ebx)
+  8037a2:	89 e2                	mov    %esp,%edx
+  8037a4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037a9:	29 d0                	sub    %edx,%eax
+  8037ab:	89 c2                	mov    %eax,%edx
+  8037ad:	c1 ea 0f             	shr    $0xf,%edx
+  8037b0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ba:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8037bd:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037c4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8037ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037cd:	5b                   	pop    %ebx
+  8037ce:	5e                   	pop    %esi
+  8037cf:	5f                   	pop    %edi
+  8037d0:	5d                   	pop    %ebp
+  8037d1:	c3                   	ret
+		if (from_env_store)
+  8037d2:	85 ff                	test   %edi,%edi
+  8037d4:	74 06                	je     8037dc <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8037d6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8037dc:	85 f6                	test   %esi,%esi
+  8037de:	74 06                	je     8037e6 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8037e0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8037e6:	85 db                	test   %ebx,%ebx
+  8037e8:	74 e0                	je     8037ca <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8037ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037f0:	eb d8                	jmp    8037ca <ipc_recv_pages+0xe5>
+
+008037f2 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8037f2:	55                   	push   %ebp
+  8037f3:	89 e5                	mov    %esp,%ebp
+  8037f5:	57                   	push   %edi
+  8037f6:	56                   	push   %esi
+  8037f7:	53                   	push   %ebx
+  8037f8:	83 ec 1c             	sub    $0x1c,%esp
+  8037fb:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8037fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  803801:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803807:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80380b:	75 2b                	jne    803838 <ipc_try_send_pages+0x46>
+  80380d:	89 e2                	mov    %esp,%edx
+  80380f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803814:	29 d0                	sub    %edx,%eax
+  803816:	89 c2                	mov    %eax,%edx
+  803818:	c1 ea 0f             	shr    $0xf,%edx
+  80381b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803820:	b8 00 00 00 00       	mov    $0x0,%eax
+  803825:	0f 42 c2             	cmovb  %edx,%eax
+  803828:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80382f:	8b 70 48             	mov    0x48(%eax),%esi
+  803832:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803838:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80383e:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803843:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803846:	85 ff                	test   %edi,%edi
+  803848:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80384d:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803850:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803856:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80385c:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803862:	83 ec 0c             	sub    $0xc,%esp
+  803865:	ff 75 14             	push   0x14(%ebp)
+  803868:	ff 75 18             	push   0x18(%ebp)
+  80386b:	57                   	push   %edi
+  80386c:	ff 75 0c             	push   0xc(%ebp)
+  80386f:	ff 75 08             	push   0x8(%ebp)
+  803872:	e8 f3 d6 ff ff       	call   800f6a <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803877:	83 c4 20             	add    $0x20,%esp
+  80387a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80387d:	75 21                	jne    8038a0 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80387f:	83 ec 04             	sub    $0x4,%esp
+  803882:	6a ff                	push   $0xffffffff
+  803884:	53                   	push   %ebx
+  803885:	ff 75 e4             	push   -0x1c(%ebp)
+  803888:	e8 ea d8 ff ff       	call   801177 <sys_futex_wait>
+  80388d:	83 c4 10             	add    $0x10,%esp
+  803890:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803893:	74 c7                	je     80385c <ipc_try_send_pages+0x6a>
+  803895:	85 c0                	test   %eax,%eax
+  803897:	79 c3                	jns    80385c <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803899:	e8 bc d4 ff ff       	call   800d5a <sys_yield>
+  80389e:	eb bc                	jmp    80385c <ipc_try_send_pages+0x6a>
+	}
+}
+  8038a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038a3:	5b                   	pop    %ebx
+  8038a4:	5e                   	pop    %esi
+  8038a5:	5f                   	pop    %edi
+  8038a6:	5d                   	pop    %ebp
+  8038a7:	c3                   	ret
+
+008038a8 <ipc_send>:
+{
+  8038a8:	55                   	push   %ebp
+  8038a9:	89 e5                	mov    %esp,%ebp
+  8038ab:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8038ae:	ff 75 14             	push   0x14(%ebp)
+  8038b1:	6a 01                	push   $0x1
+  8038b3:	ff 75 10             	push   0x10(%ebp)
+  8038b6:	ff 75 0c             	push   0xc(%ebp)
+  8038b9:	ff 75 08             	push   0x8(%ebp)
+  8038bc:	e8 31 ff ff ff       	call   8037f2 <ipc_try_send_pages>
+  8038c1:	83 c4 20             	add    $0x20,%esp
+  8038c4:	85 c0                	test   %eax,%eax
+  8038c6:	78 02                	js     8038ca <ipc_send+0x22>
+}
+  8038c8:	c9                   	leave
+  8038c9:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8038ca:	50                   	push   %eax
+  8038cb:	68 8a 40 80 00       	push   $0x80408a
+  8038d0:	6a 3f                	push   $0x3f
+  8038d2:	68 9f 40 80 00       	push   $0x80409f
+  8038d7:	e8 97 c8 ff ff       	call   800173 <_panic>
+
+008038dc <ipc_send_pages>:
+{
+  8038dc:	55                   	push   %ebp
+  8038dd:	89 e5                	mov    %esp,%ebp
+  8038df:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8038e2:	ff 75 18             	push   0x18(%ebp)
+  8038e5:	ff 75 14             	push   0x14(%ebp)
+  8038e8:	ff 75 10             	push   0x10(%ebp)
+  8038eb:	ff 75 0c             	push   0xc(%ebp)
+  8038ee:	ff 75 08             	push   0x8(%ebp)
+  8038f1:	e8 fc fe ff ff       	call   8037f2 <ipc_try_send_pages>
+  8038f6:	83 c4 20             	add    $0x20,%esp
+  8038f9:	85 c0                	test   %eax,%eax
+  8038fb:	78 02                	js     8038ff <ipc_send_pages+0x23>
+}
+  8038fd:	c9                   	leave
+  8038fe:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8038ff:	50                   	push   %eax
+  803900:	68 a9 40 80 00       	push   $0x8040a9
+  803905:	6a 64                	push   $0x64
+  803907:	68 9f 40 80 00       	push   $0x80409f
+  80390c:	e8 62 c8 ff ff       	call   800173 <_panic>
+
+00803911 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803911:	55                   	push   %ebp
+  803912:	89 e5                	mov    %esp,%ebp
+  803914:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803917:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80391c:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803922:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803928:	8b 52 50             	mov    0x50(%edx),%edx
+  80392b:	39 ca                	cmp    %ecx,%edx
+  80392d:	74 11                	je     803940 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80392f:	83 c0 01             	add    $0x1,%eax
+  803932:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803937:	75 e3                	jne    80391c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80393e:	eb 0e                	jmp    80394e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803940:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803946:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80394b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80394e:	5d                   	pop    %ebp
+  80394f:	c3                   	ret
+
+00803950 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803950:	55                   	push   %ebp
+  803951:	89 e5                	mov    %esp,%ebp
+  803953:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803956:	89 c2                	mov    %eax,%edx
+  803958:	c1 ea 16             	shr    $0x16,%edx
+  80395b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803962:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803967:	f6 c1 01             	test   $0x1,%cl
+  80396a:	74 1e                	je     80398a <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80396c:	c1 e8 0c             	shr    $0xc,%eax
+  80396f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803976:	a8 01                	test   $0x1,%al
+  803978:	74 10                	je     80398a <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80397a:	c1 e8 0c             	shr    $0xc,%eax
+  80397d:	c1 e0 04             	shl    $0x4,%eax
+  803980:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803987:	0f b7 d2             	movzwl %dx,%edx
+}
+  80398a:	89 d0                	mov    %edx,%eax
+  80398c:	5d                   	pop    %ebp
+  80398d:	c3                   	ret
+
+0080398e <__udivdi3>:
+  80398e:	57                   	push   %edi
+  80398f:	56                   	push   %esi
+  803990:	53                   	push   %ebx
+  803991:	83 ec 20             	sub    $0x20,%esp
+  803994:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803998:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80399c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039a0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039a4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039a8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039ac:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8039b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8039b4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8039ca:	00 
+  8039cb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8039d2:	00 
+  8039d3:	eb 08                	jmp    8039dd <__udivdi3+0x4f>
+  8039d5:	83 e9 01             	sub    $0x1,%ecx
+  8039d8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039db:	74 68                	je     803a45 <__udivdi3+0xb7>
+  8039dd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8039e1:	01 c0                	add    %eax,%eax
+  8039e3:	89 c6                	mov    %eax,%esi
+  8039e5:	89 d7                	mov    %edx,%edi
+  8039e7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039eb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039ef:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039f2:	d3 ea                	shr    %cl,%edx
+  8039f4:	f6 c1 20             	test   $0x20,%cl
+  8039f7:	74 04                	je     8039fd <__udivdi3+0x6f>
+  8039f9:	89 d0                	mov    %edx,%eax
+  8039fb:	31 d2                	xor    %edx,%edx
+  8039fd:	83 e0 01             	and    $0x1,%eax
+  803a00:	89 04 24             	mov    %eax,(%esp)
+  803a03:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803a0a:	00 
+  803a0b:	8b 04 24             	mov    (%esp),%eax
+  803a0e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803a12:	09 f0                	or     %esi,%eax
+  803a14:	09 fa                	or     %edi,%edx
+  803a16:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803a1a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803a1e:	39 f0                	cmp    %esi,%eax
+  803a20:	89 d3                	mov    %edx,%ebx
+  803a22:	19 fb                	sbb    %edi,%ebx
+  803a24:	72 af                	jb     8039d5 <__udivdi3+0x47>
+  803a26:	29 f0                	sub    %esi,%eax
+  803a28:	19 fa                	sbb    %edi,%edx
+  803a2a:	89 cf                	mov    %ecx,%edi
+  803a2c:	c1 ef 05             	shr    $0x5,%edi
+  803a2f:	83 e7 01             	and    $0x1,%edi
+  803a32:	89 fe                	mov    %edi,%esi
+  803a34:	83 f6 01             	xor    $0x1,%esi
+  803a37:	d3 e6                	shl    %cl,%esi
+  803a39:	d3 e7                	shl    %cl,%edi
+  803a3b:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a3f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a43:	eb 90                	jmp    8039d5 <__udivdi3+0x47>
+  803a45:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a49:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a4d:	83 c4 20             	add    $0x20,%esp
+  803a50:	5b                   	pop    %ebx
+  803a51:	5e                   	pop    %esi
+  803a52:	5f                   	pop    %edi
+  803a53:	c3                   	ret
+
+00803a54 <__umoddi3>:
+  803a54:	57                   	push   %edi
+  803a55:	56                   	push   %esi
+  803a56:	53                   	push   %ebx
+  803a57:	83 ec 08             	sub    $0x8,%esp
+  803a5a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a5e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a62:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a66:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a6a:	57                   	push   %edi
+  803a6b:	56                   	push   %esi
+  803a6c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a70:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a74:	52                   	push   %edx
+  803a75:	50                   	push   %eax
+  803a76:	e8 13 ff ff ff       	call   80398e <__udivdi3>
+  803a7b:	89 c3                	mov    %eax,%ebx
+  803a7d:	0f af d6             	imul   %esi,%edx
+  803a80:	89 f9                	mov    %edi,%ecx
+  803a82:	0f af cb             	imul   %ebx,%ecx
+  803a85:	01 d1                	add    %edx,%ecx
+  803a87:	89 d8                	mov    %ebx,%eax
+  803a89:	f7 e6                	mul    %esi
+  803a8b:	89 c6                	mov    %eax,%esi
+  803a8d:	89 d7                	mov    %edx,%edi
+  803a8f:	01 cf                	add    %ecx,%edi
+  803a91:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a95:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a99:	29 f0                	sub    %esi,%eax
+  803a9b:	19 fa                	sbb    %edi,%edx
+  803a9d:	83 c4 18             	add    $0x18,%esp
+  803aa0:	5b                   	pop    %ebx
+  803aa1:	5e                   	pop    %esi
+  803aa2:	5f                   	pop    %edi
+  803aa3:	c3                   	ret
+
+00803aa4 <__divdi3>:
+  803aa4:	53                   	push   %ebx
+  803aa5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803aa9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803aad:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ab1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803ab5:	85 d2                	test   %edx,%edx
+  803ab7:	78 12                	js     803acb <__divdi3+0x27>
+  803ab9:	85 db                	test   %ebx,%ebx
+  803abb:	78 2e                	js     803aeb <__divdi3+0x47>
+  803abd:	53                   	push   %ebx
+  803abe:	51                   	push   %ecx
+  803abf:	52                   	push   %edx
+  803ac0:	50                   	push   %eax
+  803ac1:	e8 c8 fe ff ff       	call   80398e <__udivdi3>
+  803ac6:	83 c4 10             	add    $0x10,%esp
+  803ac9:	eb 1e                	jmp    803ae9 <__divdi3+0x45>
+  803acb:	f7 d8                	neg    %eax
+  803acd:	83 d2 00             	adc    $0x0,%edx
+  803ad0:	f7 da                	neg    %edx
+  803ad2:	85 db                	test   %ebx,%ebx
+  803ad4:	78 2a                	js     803b00 <__divdi3+0x5c>
+  803ad6:	53                   	push   %ebx
+  803ad7:	51                   	push   %ecx
+  803ad8:	52                   	push   %edx
+  803ad9:	50                   	push   %eax
+  803ada:	e8 af fe ff ff       	call   80398e <__udivdi3>
+  803adf:	83 c4 10             	add    $0x10,%esp
+  803ae2:	f7 d8                	neg    %eax
+  803ae4:	83 d2 00             	adc    $0x0,%edx
+  803ae7:	f7 da                	neg    %edx
+  803ae9:	5b                   	pop    %ebx
+  803aea:	c3                   	ret
+  803aeb:	f7 d9                	neg    %ecx
+  803aed:	83 d3 00             	adc    $0x0,%ebx
+  803af0:	f7 db                	neg    %ebx
+  803af2:	53                   	push   %ebx
+  803af3:	51                   	push   %ecx
+  803af4:	52                   	push   %edx
+  803af5:	50                   	push   %eax
+  803af6:	e8 93 fe ff ff       	call   80398e <__udivdi3>
+  803afb:	83 c4 10             	add    $0x10,%esp
+  803afe:	eb e2                	jmp    803ae2 <__divdi3+0x3e>
+  803b00:	f7 d9                	neg    %ecx
+  803b02:	83 d3 00             	adc    $0x0,%ebx
+  803b05:	f7 db                	neg    %ebx
+  803b07:	53                   	push   %ebx
+  803b08:	51                   	push   %ecx
+  803b09:	52                   	push   %edx
+  803b0a:	50                   	push   %eax
+  803b0b:	e8 7e fe ff ff       	call   80398e <__udivdi3>
+  803b10:	83 c4 10             	add    $0x10,%esp
+  803b13:	eb d4                	jmp    803ae9 <__divdi3+0x45>
+
+00803b15 <__moddi3>:
+  803b15:	57                   	push   %edi
+  803b16:	56                   	push   %esi
+  803b17:	53                   	push   %ebx
+  803b18:	83 ec 08             	sub    $0x8,%esp
+  803b1b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b1f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b23:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803b27:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803b2b:	57                   	push   %edi
+  803b2c:	56                   	push   %esi
+  803b2d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b31:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b35:	52                   	push   %edx
+  803b36:	50                   	push   %eax
+  803b37:	e8 68 ff ff ff       	call   803aa4 <__divdi3>
+  803b3c:	89 c3                	mov    %eax,%ebx
+  803b3e:	0f af d6             	imul   %esi,%edx
+  803b41:	89 f9                	mov    %edi,%ecx
+  803b43:	0f af cb             	imul   %ebx,%ecx
+  803b46:	01 d1                	add    %edx,%ecx
+  803b48:	89 d8                	mov    %ebx,%eax
+  803b4a:	f7 e6                	mul    %esi
+  803b4c:	89 c6                	mov    %eax,%esi
+  803b4e:	89 d7                	mov    %edx,%edi
+  803b50:	01 cf                	add    %ecx,%edi
+  803b52:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b56:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b5a:	29 f0                	sub    %esi,%eax
+  803b5c:	19 fa                	sbb    %edi,%edx
+  803b5e:	83 c4 18             	add    $0x18,%esp
+  803b61:	5b                   	pop    %ebx
+  803b62:	5e                   	pop    %esi
+  803b63:	5f                   	pop    %edi
+  803b64:	c3                   	ret
@@ -0,0 +1,8011 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 86 00 00 00       	call   8000b7 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003f:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  800041:	53                   	push   %ebx
+  800042:	68 60 3b 80 00       	push   $0x803b60
+  800047:	e8 ed 01 00 00       	call   800239 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004c:	83 c4 0c             	add    $0xc,%esp
+  80004f:	6a 07                	push   $0x7
+  800051:	89 d8                	mov    %ebx,%eax
+  800053:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800058:	50                   	push   %eax
+  800059:	6a 00                	push   $0x0
+  80005b:	e8 04 0d 00 00       	call   800d64 <sys_page_alloc>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 16                	js     80007d <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800067:	53                   	push   %ebx
+  800068:	68 ac 3b 80 00       	push   $0x803bac
+  80006d:	6a 64                	push   $0x64
+  80006f:	53                   	push   %ebx
+  800070:	e8 55 08 00 00       	call   8008ca <snprintf>
+}
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007b:	c9                   	leave
+  80007c:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	50                   	push   %eax
+  800081:	53                   	push   %ebx
+  800082:	68 80 3b 80 00       	push   $0x803b80
+  800087:	6a 0f                	push   $0xf
+  800089:	68 6a 3b 80 00       	push   $0x803b6a
+  80008e:	e8 cb 00 00 00       	call   80015e <_panic>
+
+00800093 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800099:	68 35 00 80 00       	push   $0x800035
+  80009e:	e8 24 11 00 00       	call   8011c7 <set_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a3:	83 c4 08             	add    $0x8,%esp
+  8000a6:	6a 04                	push   $0x4
+  8000a8:	68 ef be ad de       	push   $0xdeadbeef
+  8000ad:	e8 f6 0b 00 00       	call   800ca8 <sys_cputs>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	56                   	push   %esi
+  8000bb:	53                   	push   %ebx
+  8000bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000c2:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000c9:	29 d0                	sub    %edx,%eax
+  8000cb:	89 c2                	mov    %eax,%edx
+  8000cd:	c1 ea 0f             	shr    $0xf,%edx
+  8000d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000da:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8000dd:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  8000e4:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8000e8:	e8 39 0c 00 00       	call   800d26 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8000ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f2:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8000f8:	89 e1                	mov    %esp,%ecx
+  8000fa:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8000ff:	29 ca                	sub    %ecx,%edx
+  800101:	89 d1                	mov    %edx,%ecx
+  800103:	c1 e9 0f             	shr    $0xf,%ecx
+  800106:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80010c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800111:	0f 42 d1             	cmovb  %ecx,%edx
+  800114:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800119:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800120:	85 db                	test   %ebx,%ebx
+  800122:	7e 07                	jle    80012b <libmain+0x74>
+		binaryname = argv[0];
+  800124:	8b 06                	mov    (%esi),%eax
+  800126:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80012b:	83 ec 08             	sub    $0x8,%esp
+  80012e:	56                   	push   %esi
+  80012f:	53                   	push   %ebx
+  800130:	e8 5e ff ff ff       	call   800093 <umain>
+
+	// exit gracefully
+	exit();
+  800135:	e8 0a 00 00 00       	call   800144 <exit>
+}
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800140:	5b                   	pop    %ebx
+  800141:	5e                   	pop    %esi
+  800142:	5d                   	pop    %ebp
+  800143:	c3                   	ret
+
+00800144 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80014a:	e8 c5 12 00 00       	call   801414 <close_all>
+	sys_env_destroy(0);
+  80014f:	83 ec 0c             	sub    $0xc,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	e8 8c 0b 00 00       	call   800ce5 <sys_env_destroy>
+}
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	c9                   	leave
+  80015d:	c3                   	ret
+
+0080015e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	56                   	push   %esi
+  800162:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800163:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800166:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80016c:	e8 b5 0b 00 00       	call   800d26 <sys_getenvid>
+  800171:	83 ec 0c             	sub    $0xc,%esp
+  800174:	ff 75 0c             	push   0xc(%ebp)
+  800177:	ff 75 08             	push   0x8(%ebp)
+  80017a:	56                   	push   %esi
+  80017b:	50                   	push   %eax
+  80017c:	68 d8 3b 80 00       	push   $0x803bd8
+  800181:	e8 b3 00 00 00       	call   800239 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800186:	83 c4 18             	add    $0x18,%esp
+  800189:	53                   	push   %ebx
+  80018a:	ff 75 10             	push   0x10(%ebp)
+  80018d:	e8 56 00 00 00       	call   8001e8 <vcprintf>
+	cprintf("\n");
+  800192:	c7 04 24 50 40 80 00 	movl   $0x804050,(%esp)
+  800199:	e8 9b 00 00 00       	call   800239 <cprintf>
+  80019e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001a1:	cc                   	int3
+	while (1)
+  8001a2:	eb fd                	jmp    8001a1 <_panic+0x43>
+
+008001a4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	53                   	push   %ebx
+  8001a8:	83 ec 04             	sub    $0x4,%esp
+  8001ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001ae:	8b 13                	mov    (%ebx),%edx
+  8001b0:	8d 42 01             	lea    0x1(%edx),%eax
+  8001b3:	89 03                	mov    %eax,(%ebx)
+  8001b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001bc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001c1:	74 09                	je     8001cc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001c3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ca:	c9                   	leave
+  8001cb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001cc:	83 ec 08             	sub    $0x8,%esp
+  8001cf:	68 ff 00 00 00       	push   $0xff
+  8001d4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d7:	50                   	push   %eax
+  8001d8:	e8 cb 0a 00 00       	call   800ca8 <sys_cputs>
+		b->idx = 0;
+  8001dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	eb db                	jmp    8001c3 <putch+0x1f>
+
+008001e8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e8:	55                   	push   %ebp
+  8001e9:	89 e5                	mov    %esp,%ebp
+  8001eb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001f1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f8:	00 00 00 
+	b.cnt = 0;
+  8001fb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800202:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800205:	ff 75 0c             	push   0xc(%ebp)
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800211:	50                   	push   %eax
+  800212:	68 a4 01 80 00       	push   $0x8001a4
+  800217:	e8 1c 01 00 00       	call   800338 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80021c:	83 c4 08             	add    $0x8,%esp
+  80021f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800225:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80022b:	50                   	push   %eax
+  80022c:	e8 77 0a 00 00       	call   800ca8 <sys_cputs>
+
+	return b.cnt;
+}
+  800231:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800237:	c9                   	leave
+  800238:	c3                   	ret
+
+00800239 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800239:	55                   	push   %ebp
+  80023a:	89 e5                	mov    %esp,%ebp
+  80023c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80023f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800242:	50                   	push   %eax
+  800243:	ff 75 08             	push   0x8(%ebp)
+  800246:	e8 9d ff ff ff       	call   8001e8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+0080024d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	57                   	push   %edi
+  800251:	56                   	push   %esi
+  800252:	53                   	push   %ebx
+  800253:	83 ec 1c             	sub    $0x1c,%esp
+  800256:	89 c3                	mov    %eax,%ebx
+  800258:	89 d6                	mov    %edx,%esi
+  80025a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80025d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800260:	89 d1                	mov    %edx,%ecx
+  800262:	89 c2                	mov    %eax,%edx
+  800264:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800267:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80026a:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80026d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800270:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800277:	39 c2                	cmp    %eax,%edx
+  800279:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80027c:	73 4b                	jae    8002c9 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80027e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800281:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800284:	85 ff                	test   %edi,%edi
+  800286:	7e 11                	jle    800299 <printnum+0x4c>
+			putch(padc, putdat);
+  800288:	83 ec 08             	sub    $0x8,%esp
+  80028b:	56                   	push   %esi
+  80028c:	ff 75 18             	push   0x18(%ebp)
+  80028f:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800291:	83 c4 10             	add    $0x10,%esp
+  800294:	83 ef 01             	sub    $0x1,%edi
+  800297:	75 ef                	jne    800288 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800299:	83 ec 08             	sub    $0x8,%esp
+  80029c:	56                   	push   %esi
+  80029d:	83 ec 04             	sub    $0x4,%esp
+  8002a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a3:	ff 75 e0             	push   -0x20(%ebp)
+  8002a6:	ff 75 dc             	push   -0x24(%ebp)
+  8002a9:	ff 75 d8             	push   -0x28(%ebp)
+  8002ac:	e8 8e 37 00 00       	call   803a3f <__umoddi3>
+  8002b1:	83 c4 14             	add    $0x14,%esp
+  8002b4:	0f be 80 fb 3b 80 00 	movsbl 0x803bfb(%eax),%eax
+  8002bb:	50                   	push   %eax
+  8002bc:	ff d3                	call   *%ebx
+}
+  8002be:	83 c4 10             	add    $0x10,%esp
+  8002c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c4:	5b                   	pop    %ebx
+  8002c5:	5e                   	pop    %esi
+  8002c6:	5f                   	pop    %edi
+  8002c7:	5d                   	pop    %ebp
+  8002c8:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002c9:	83 ec 0c             	sub    $0xc,%esp
+  8002cc:	ff 75 18             	push   0x18(%ebp)
+  8002cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002d2:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002d5:	52                   	push   %edx
+  8002d6:	50                   	push   %eax
+  8002d7:	83 ec 08             	sub    $0x8,%esp
+  8002da:	ff 75 e4             	push   -0x1c(%ebp)
+  8002dd:	ff 75 e0             	push   -0x20(%ebp)
+  8002e0:	ff 75 dc             	push   -0x24(%ebp)
+  8002e3:	ff 75 d8             	push   -0x28(%ebp)
+  8002e6:	e8 8e 36 00 00       	call   803979 <__udivdi3>
+  8002eb:	83 c4 18             	add    $0x18,%esp
+  8002ee:	52                   	push   %edx
+  8002ef:	50                   	push   %eax
+  8002f0:	89 f2                	mov    %esi,%edx
+  8002f2:	89 d8                	mov    %ebx,%eax
+  8002f4:	e8 54 ff ff ff       	call   80024d <printnum>
+  8002f9:	83 c4 20             	add    $0x20,%esp
+  8002fc:	eb 9b                	jmp    800299 <printnum+0x4c>
+
+008002fe <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800304:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800308:	8b 10                	mov    (%eax),%edx
+  80030a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80030d:	73 0a                	jae    800319 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80030f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800312:	89 08                	mov    %ecx,(%eax)
+  800314:	8b 45 08             	mov    0x8(%ebp),%eax
+  800317:	88 02                	mov    %al,(%edx)
+}
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+
+0080031b <printfmt>:
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800321:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800324:	50                   	push   %eax
+  800325:	ff 75 10             	push   0x10(%ebp)
+  800328:	ff 75 0c             	push   0xc(%ebp)
+  80032b:	ff 75 08             	push   0x8(%ebp)
+  80032e:	e8 05 00 00 00       	call   800338 <vprintfmt>
+}
+  800333:	83 c4 10             	add    $0x10,%esp
+  800336:	c9                   	leave
+  800337:	c3                   	ret
+
+00800338 <vprintfmt>:
+{
+  800338:	55                   	push   %ebp
+  800339:	89 e5                	mov    %esp,%ebp
+  80033b:	57                   	push   %edi
+  80033c:	56                   	push   %esi
+  80033d:	53                   	push   %ebx
+  80033e:	83 ec 2c             	sub    $0x2c,%esp
+  800341:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800344:	89 df                	mov    %ebx,%edi
+  800346:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800349:	8b 45 10             	mov    0x10(%ebp),%eax
+  80034c:	8d 70 01             	lea    0x1(%eax),%esi
+  80034f:	0f b6 00             	movzbl (%eax),%eax
+  800352:	83 f8 25             	cmp    $0x25,%eax
+  800355:	74 1e                	je     800375 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800357:	85 c0                	test   %eax,%eax
+  800359:	0f 84 15 05 00 00    	je     800874 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	53                   	push   %ebx
+  800363:	50                   	push   %eax
+  800364:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800366:	83 c6 01             	add    $0x1,%esi
+  800369:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80036d:	83 c4 10             	add    $0x10,%esp
+  800370:	83 f8 25             	cmp    $0x25,%eax
+  800373:	75 e2                	jne    800357 <vprintfmt+0x1f>
+		padc = ' ';
+  800375:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800379:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800380:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800387:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80038e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800393:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800396:	8d 56 01             	lea    0x1(%esi),%edx
+  800399:	0f b6 0e             	movzbl (%esi),%ecx
+  80039c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80039f:	3c 55                	cmp    $0x55,%al
+  8003a1:	0f 87 3b 04 00 00    	ja     8007e2 <vprintfmt+0x4aa>
+  8003a7:	0f b6 c0             	movzbl %al,%eax
+  8003aa:	ff 24 85 60 3d 80 00 	jmp    *0x803d60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8003b1:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003b4:	eb 93                	jmp    800349 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b6:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8003b8:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003bc:	eb d8                	jmp    800396 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003be:	89 d6                	mov    %edx,%esi
+  8003c0:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003c4:	eb d0                	jmp    800396 <vprintfmt+0x5e>
+  8003c6:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8003c9:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8003cf:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8003d3:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003d6:	83 f9 09             	cmp    $0x9,%ecx
+  8003d9:	77 6f                	ja     80044a <vprintfmt+0x112>
+  8003db:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8003de:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8003e1:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003e4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003e8:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8003eb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003ee:	83 fe 09             	cmp    $0x9,%esi
+  8003f1:	76 eb                	jbe    8003de <vprintfmt+0xa6>
+  8003f3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8003f6:	89 d6                	mov    %edx,%esi
+  8003f8:	eb 13                	jmp    80040d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8003fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fd:	8b 00                	mov    (%eax),%eax
+  8003ff:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800402:	8b 45 14             	mov    0x14(%ebp),%eax
+  800405:	8d 40 04             	lea    0x4(%eax),%eax
+  800408:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80040d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800411:	79 83                	jns    800396 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800413:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800416:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800419:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800420:	e9 71 ff ff ff       	jmp    800396 <vprintfmt+0x5e>
+			if (width < 0)
+  800425:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800428:	85 c9                	test   %ecx,%ecx
+  80042a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042f:	0f 49 c1             	cmovns %ecx,%eax
+  800432:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800435:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800437:	e9 5a ff ff ff       	jmp    800396 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043c:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80043e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800445:	e9 4c ff ff ff       	jmp    800396 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80044a:	89 d6                	mov    %edx,%esi
+  80044c:	eb bf                	jmp    80040d <vprintfmt+0xd5>
+			lflag++;
+  80044e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800452:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800454:	e9 3d ff ff ff       	jmp    800396 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800459:	89 55 10             	mov    %edx,0x10(%ebp)
+  80045c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045f:	8d 70 04             	lea    0x4(%eax),%esi
+  800462:	83 ec 08             	sub    $0x8,%esp
+  800465:	53                   	push   %ebx
+  800466:	ff 30                	push   (%eax)
+  800468:	ff d7                	call   *%edi
+			break;
+  80046a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80046d:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800470:	e9 d4 fe ff ff       	jmp    800349 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800475:	89 55 10             	mov    %edx,0x10(%ebp)
+  800478:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047b:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80047e:	8b 10                	mov    (%eax),%edx
+  800480:	89 d0                	mov    %edx,%eax
+  800482:	f7 d8                	neg    %eax
+  800484:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800487:	83 f8 12             	cmp    $0x12,%eax
+  80048a:	7f 23                	jg     8004af <vprintfmt+0x177>
+  80048c:	8b 14 85 c0 3e 80 00 	mov    0x803ec0(,%eax,4),%edx
+  800493:	85 d2                	test   %edx,%edx
+  800495:	74 18                	je     8004af <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800497:	52                   	push   %edx
+  800498:	68 1b 40 80 00       	push   $0x80401b
+  80049d:	53                   	push   %ebx
+  80049e:	57                   	push   %edi
+  80049f:	e8 77 fe ff ff       	call   80031b <printfmt>
+  8004a4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004a7:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004aa:	e9 9a fe ff ff       	jmp    800349 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8004af:	50                   	push   %eax
+  8004b0:	68 13 3c 80 00       	push   $0x803c13
+  8004b5:	53                   	push   %ebx
+  8004b6:	57                   	push   %edi
+  8004b7:	e8 5f fe ff ff       	call   80031b <printfmt>
+  8004bc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bf:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004c2:	e9 82 fe ff ff       	jmp    800349 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004c7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cd:	83 c0 04             	add    $0x4,%eax
+  8004d0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d6:	8b 00                	mov    (%eax),%eax
+  8004d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004db:	85 c0                	test   %eax,%eax
+  8004dd:	0f 84 61 03 00 00    	je     800844 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8004e3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004e7:	7e 06                	jle    8004ef <vprintfmt+0x1b7>
+  8004e9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004ed:	75 29                	jne    800518 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ef:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004f2:	8d 70 01             	lea    0x1(%eax),%esi
+  8004f5:	0f b6 00             	movzbl (%eax),%eax
+  8004f8:	0f be d0             	movsbl %al,%edx
+  8004fb:	85 d2                	test   %edx,%edx
+  8004fd:	0f 84 bb 00 00 00    	je     8005be <vprintfmt+0x286>
+  800503:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800506:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800509:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80050c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80050f:	eb 7a                	jmp    80058b <vprintfmt+0x253>
+				p = "(null)";
+  800511:	c7 45 d0 0c 3c 80 00 	movl   $0x803c0c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800518:	83 ec 08             	sub    $0x8,%esp
+  80051b:	ff 75 d4             	push   -0x2c(%ebp)
+  80051e:	ff 75 d0             	push   -0x30(%ebp)
+  800521:	e8 e0 03 00 00       	call   800906 <strnlen>
+  800526:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800529:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80052c:	83 c4 10             	add    $0x10,%esp
+  80052f:	85 d2                	test   %edx,%edx
+  800531:	0f 8e d6 02 00 00    	jle    80080d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800537:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80053b:	83 ec 08             	sub    $0x8,%esp
+  80053e:	53                   	push   %ebx
+  80053f:	56                   	push   %esi
+  800540:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800542:	83 c4 10             	add    $0x10,%esp
+  800545:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800549:	75 f0                	jne    80053b <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80054b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80054e:	8d 70 01             	lea    0x1(%eax),%esi
+  800551:	0f b6 00             	movzbl (%eax),%eax
+  800554:	0f be d0             	movsbl %al,%edx
+  800557:	85 d2                	test   %edx,%edx
+  800559:	0f 84 da 02 00 00    	je     800839 <vprintfmt+0x501>
+  80055f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800562:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800565:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800568:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80056b:	eb 1e                	jmp    80058b <vprintfmt+0x253>
+					putch(ch, putdat);
+  80056d:	83 ec 08             	sub    $0x8,%esp
+  800570:	ff 75 0c             	push   0xc(%ebp)
+  800573:	52                   	push   %edx
+  800574:	ff 55 08             	call   *0x8(%ebp)
+  800577:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80057a:	83 eb 01             	sub    $0x1,%ebx
+  80057d:	83 c6 01             	add    $0x1,%esi
+  800580:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800584:	0f be d0             	movsbl %al,%edx
+  800587:	85 d2                	test   %edx,%edx
+  800589:	74 2a                	je     8005b5 <vprintfmt+0x27d>
+  80058b:	85 ff                	test   %edi,%edi
+  80058d:	78 05                	js     800594 <vprintfmt+0x25c>
+  80058f:	83 ef 01             	sub    $0x1,%edi
+  800592:	78 59                	js     8005ed <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800594:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800598:	74 d3                	je     80056d <vprintfmt+0x235>
+  80059a:	0f be c0             	movsbl %al,%eax
+  80059d:	83 e8 20             	sub    $0x20,%eax
+  8005a0:	83 f8 5e             	cmp    $0x5e,%eax
+  8005a3:	76 c8                	jbe    80056d <vprintfmt+0x235>
+					putch('?', putdat);
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	ff 75 0c             	push   0xc(%ebp)
+  8005ab:	6a 3f                	push   $0x3f
+  8005ad:	ff 55 08             	call   *0x8(%ebp)
+  8005b0:	83 c4 10             	add    $0x10,%esp
+  8005b3:	eb c5                	jmp    80057a <vprintfmt+0x242>
+  8005b5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8005be:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005c1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005c5:	7e 1b                	jle    8005e2 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	53                   	push   %ebx
+  8005cb:	6a 20                	push   $0x20
+  8005cd:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005cf:	83 c4 10             	add    $0x10,%esp
+  8005d2:	83 ee 01             	sub    $0x1,%esi
+  8005d5:	75 f0                	jne    8005c7 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005dd:	e9 67 fd ff ff       	jmp    800349 <vprintfmt+0x11>
+  8005e2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e8:	e9 5c fd ff ff       	jmp    800349 <vprintfmt+0x11>
+  8005ed:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005f6:	eb c6                	jmp    8005be <vprintfmt+0x286>
+	if (lflag >= 2)
+  8005f8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005fb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005fe:	83 f9 01             	cmp    $0x1,%ecx
+  800601:	7f 1f                	jg     800622 <vprintfmt+0x2ea>
+	else if (lflag)
+  800603:	85 c9                	test   %ecx,%ecx
+  800605:	74 67                	je     80066e <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 30                	mov    (%eax),%esi
+  80060c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80060f:	89 f0                	mov    %esi,%eax
+  800611:	c1 f8 1f             	sar    $0x1f,%eax
+  800614:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800620:	eb 17                	jmp    800639 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 50 04             	mov    0x4(%eax),%edx
+  800628:	8b 00                	mov    (%eax),%eax
+  80062a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 08             	lea    0x8(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800639:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80063f:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800644:	85 c9                	test   %ecx,%ecx
+  800646:	0f 89 12 01 00 00    	jns    80075e <vprintfmt+0x426>
+				putch('-', putdat);
+  80064c:	83 ec 08             	sub    $0x8,%esp
+  80064f:	53                   	push   %ebx
+  800650:	6a 2d                	push   $0x2d
+  800652:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800654:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800657:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80065a:	f7 da                	neg    %edx
+  80065c:	83 d1 00             	adc    $0x0,%ecx
+  80065f:	f7 d9                	neg    %ecx
+  800661:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800664:	be 0a 00 00 00       	mov    $0xa,%esi
+  800669:	e9 f0 00 00 00       	jmp    80075e <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 30                	mov    (%eax),%esi
+  800673:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800676:	89 f0                	mov    %esi,%eax
+  800678:	c1 f8 1f             	sar    $0x1f,%eax
+  80067b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+  800687:	eb b0                	jmp    800639 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800689:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80068c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80068f:	83 f9 01             	cmp    $0x1,%ecx
+  800692:	7f 1e                	jg     8006b2 <vprintfmt+0x37a>
+	else if (lflag)
+  800694:	85 c9                	test   %ecx,%ecx
+  800696:	74 32                	je     8006ca <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8006ad:	e9 ac 00 00 00       	jmp    80075e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006c0:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8006c5:	e9 94 00 00 00       	jmp    80075e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8b 10                	mov    (%eax),%edx
+  8006cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006da:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8006df:	eb 7d                	jmp    80075e <vprintfmt+0x426>
+	if (lflag >= 2)
+  8006e1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006e4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006e7:	83 f9 01             	cmp    $0x1,%ecx
+  8006ea:	7f 1b                	jg     800707 <vprintfmt+0x3cf>
+	else if (lflag)
+  8006ec:	85 c9                	test   %ecx,%ecx
+  8006ee:	74 2c                	je     80071c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800700:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800705:	eb 57                	jmp    80075e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070f:	8d 40 08             	lea    0x8(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800715:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80071a:	eb 42                	jmp    80075e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800731:	eb 2b                	jmp    80075e <vprintfmt+0x426>
+			putch('0', putdat);
+  800733:	89 55 10             	mov    %edx,0x10(%ebp)
+  800736:	83 ec 08             	sub    $0x8,%esp
+  800739:	53                   	push   %ebx
+  80073a:	6a 30                	push   $0x30
+  80073c:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80073e:	83 c4 08             	add    $0x8,%esp
+  800741:	53                   	push   %ebx
+  800742:	6a 78                	push   $0x78
+  800744:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800750:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800753:	8d 40 04             	lea    0x4(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800759:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80075e:	83 ec 0c             	sub    $0xc,%esp
+  800761:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800765:	50                   	push   %eax
+  800766:	ff 75 e4             	push   -0x1c(%ebp)
+  800769:	56                   	push   %esi
+  80076a:	51                   	push   %ecx
+  80076b:	52                   	push   %edx
+  80076c:	89 da                	mov    %ebx,%edx
+  80076e:	89 f8                	mov    %edi,%eax
+  800770:	e8 d8 fa ff ff       	call   80024d <printnum>
+			break;
+  800775:	83 c4 20             	add    $0x20,%esp
+  800778:	e9 cc fb ff ff       	jmp    800349 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80077d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800780:	89 55 10             	mov    %edx,0x10(%ebp)
+  800783:	83 f9 01             	cmp    $0x1,%ecx
+  800786:	7f 1b                	jg     8007a3 <vprintfmt+0x46b>
+	else if (lflag)
+  800788:	85 c9                	test   %ecx,%ecx
+  80078a:	74 2c                	je     8007b8 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 10                	mov    (%eax),%edx
+  800791:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800796:	8d 40 04             	lea    0x4(%eax),%eax
+  800799:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8007a1:	eb bb                	jmp    80075e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8007b6:	eb a6                	jmp    80075e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c8:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8007cd:	eb 8f                	jmp    80075e <vprintfmt+0x426>
+			putch(ch, putdat);
+  8007cf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d2:	83 ec 08             	sub    $0x8,%esp
+  8007d5:	53                   	push   %ebx
+  8007d6:	6a 25                	push   $0x25
+  8007d8:	ff d7                	call   *%edi
+			break;
+  8007da:	83 c4 10             	add    $0x10,%esp
+  8007dd:	e9 67 fb ff ff       	jmp    800349 <vprintfmt+0x11>
+			putch('%', putdat);
+  8007e2:	83 ec 08             	sub    $0x8,%esp
+  8007e5:	53                   	push   %ebx
+  8007e6:	6a 25                	push   $0x25
+  8007e8:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ea:	83 c4 10             	add    $0x10,%esp
+  8007ed:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007f1:	0f 84 ba fb ff ff    	je     8003b1 <vprintfmt+0x79>
+  8007f7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007fa:	89 f0                	mov    %esi,%eax
+  8007fc:	83 e8 01             	sub    $0x1,%eax
+  8007ff:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800803:	75 f7                	jne    8007fc <vprintfmt+0x4c4>
+  800805:	89 45 10             	mov    %eax,0x10(%ebp)
+  800808:	e9 3c fb ff ff       	jmp    800349 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80080d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800810:	8d 70 01             	lea    0x1(%eax),%esi
+  800813:	0f b6 00             	movzbl (%eax),%eax
+  800816:	0f be d0             	movsbl %al,%edx
+  800819:	85 d2                	test   %edx,%edx
+  80081b:	74 11                	je     80082e <vprintfmt+0x4f6>
+  80081d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800820:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800823:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800826:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800829:	e9 5d fd ff ff       	jmp    80058b <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80082e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800831:	89 45 14             	mov    %eax,0x14(%ebp)
+  800834:	e9 10 fb ff ff       	jmp    800349 <vprintfmt+0x11>
+  800839:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80083c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80083f:	e9 05 fb ff ff       	jmp    800349 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800844:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800848:	7e 0a                	jle    800854 <vprintfmt+0x51c>
+  80084a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80084e:	0f 85 bd fc ff ff    	jne    800511 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800854:	ba 28 00 00 00       	mov    $0x28,%edx
+  800859:	b8 28 00 00 00       	mov    $0x28,%eax
+  80085e:	be 0d 3c 80 00       	mov    $0x803c0d,%esi
+  800863:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800866:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800869:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80086c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80086f:	e9 17 fd ff ff       	jmp    80058b <vprintfmt+0x253>
+}
+  800874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800877:	5b                   	pop    %ebx
+  800878:	5e                   	pop    %esi
+  800879:	5f                   	pop    %edi
+  80087a:	5d                   	pop    %ebp
+  80087b:	c3                   	ret
+
+0080087c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80087c:	55                   	push   %ebp
+  80087d:	89 e5                	mov    %esp,%ebp
+  80087f:	83 ec 18             	sub    $0x18,%esp
+  800882:	8b 45 08             	mov    0x8(%ebp),%eax
+  800885:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800888:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80088b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80088f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800892:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800899:	85 c0                	test   %eax,%eax
+  80089b:	74 26                	je     8008c3 <vsnprintf+0x47>
+  80089d:	85 d2                	test   %edx,%edx
+  80089f:	7e 22                	jle    8008c3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008a1:	ff 75 14             	push   0x14(%ebp)
+  8008a4:	ff 75 10             	push   0x10(%ebp)
+  8008a7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008aa:	50                   	push   %eax
+  8008ab:	68 fe 02 80 00       	push   $0x8002fe
+  8008b0:	e8 83 fa ff ff       	call   800338 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008b5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008b8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008be:	83 c4 10             	add    $0x10,%esp
+}
+  8008c1:	c9                   	leave
+  8008c2:	c3                   	ret
+		return -E_INVAL;
+  8008c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008c8:	eb f7                	jmp    8008c1 <vsnprintf+0x45>
+
+008008ca <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008d0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008d3:	50                   	push   %eax
+  8008d4:	ff 75 10             	push   0x10(%ebp)
+  8008d7:	ff 75 0c             	push   0xc(%ebp)
+  8008da:	ff 75 08             	push   0x8(%ebp)
+  8008dd:	e8 9a ff ff ff       	call   80087c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008e2:	c9                   	leave
+  8008e3:	c3                   	ret
+
+008008e4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ea:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008ed:	74 10                	je     8008ff <strlen+0x1b>
+  8008ef:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8008f4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008f7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008fb:	75 f7                	jne    8008f4 <strlen+0x10>
+	return n;
+}
+  8008fd:	5d                   	pop    %ebp
+  8008fe:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800904:	eb f7                	jmp    8008fd <strlen+0x19>
+
+00800906 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80090f:	85 d2                	test   %edx,%edx
+  800911:	74 16                	je     800929 <strnlen+0x23>
+  800913:	b8 00 00 00 00       	mov    $0x0,%eax
+  800918:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80091c:	74 09                	je     800927 <strnlen+0x21>
+		n++;
+  80091e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800921:	39 d0                	cmp    %edx,%eax
+  800923:	75 f3                	jne    800918 <strnlen+0x12>
+		n++;
+  800925:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800927:	5d                   	pop    %ebp
+  800928:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092e:	eb f7                	jmp    800927 <strnlen+0x21>
+
+00800930 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	53                   	push   %ebx
+  800934:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800937:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80093a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800943:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800946:	83 c0 01             	add    $0x1,%eax
+  800949:	84 d2                	test   %dl,%dl
+  80094b:	75 f2                	jne    80093f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80094d:	89 c8                	mov    %ecx,%eax
+  80094f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800952:	c9                   	leave
+  800953:	c3                   	ret
+
+00800954 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800954:	55                   	push   %ebp
+  800955:	89 e5                	mov    %esp,%ebp
+  800957:	53                   	push   %ebx
+  800958:	83 ec 10             	sub    $0x10,%esp
+  80095b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80095e:	53                   	push   %ebx
+  80095f:	e8 80 ff ff ff       	call   8008e4 <strlen>
+  800964:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800967:	ff 75 0c             	push   0xc(%ebp)
+  80096a:	01 d8                	add    %ebx,%eax
+  80096c:	50                   	push   %eax
+  80096d:	e8 be ff ff ff       	call   800930 <strcpy>
+	return dst;
+}
+  800972:	89 d8                	mov    %ebx,%eax
+  800974:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800977:	c9                   	leave
+  800978:	c3                   	ret
+
+00800979 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800979:	55                   	push   %ebp
+  80097a:	89 e5                	mov    %esp,%ebp
+  80097c:	56                   	push   %esi
+  80097d:	53                   	push   %ebx
+  80097e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800981:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800984:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800987:	85 db                	test   %ebx,%ebx
+  800989:	74 17                	je     8009a2 <strncpy+0x29>
+  80098b:	01 f3                	add    %esi,%ebx
+  80098d:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80098f:	83 c0 01             	add    $0x1,%eax
+  800992:	0f b6 0a             	movzbl (%edx),%ecx
+  800995:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800998:	80 f9 01             	cmp    $0x1,%cl
+  80099b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80099e:	39 c3                	cmp    %eax,%ebx
+  8009a0:	75 ed                	jne    80098f <strncpy+0x16>
+	}
+	return ret;
+}
+  8009a2:	89 f0                	mov    %esi,%eax
+  8009a4:	5b                   	pop    %ebx
+  8009a5:	5e                   	pop    %esi
+  8009a6:	5d                   	pop    %ebp
+  8009a7:	c3                   	ret
+
+008009a8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	56                   	push   %esi
+  8009ac:	53                   	push   %ebx
+  8009ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009b6:	89 f0                	mov    %esi,%eax
+  8009b8:	85 db                	test   %ebx,%ebx
+  8009ba:	74 1e                	je     8009da <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  8009bc:	83 eb 01             	sub    $0x1,%ebx
+  8009bf:	74 16                	je     8009d7 <strlcpy+0x2f>
+  8009c1:	01 f3                	add    %esi,%ebx
+  8009c3:	0f b6 0a             	movzbl (%edx),%ecx
+  8009c6:	84 c9                	test   %cl,%cl
+  8009c8:	74 0d                	je     8009d7 <strlcpy+0x2f>
+			*dst++ = *src++;
+  8009ca:	83 c2 01             	add    $0x1,%edx
+  8009cd:	83 c0 01             	add    $0x1,%eax
+  8009d0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  8009d3:	39 d8                	cmp    %ebx,%eax
+  8009d5:	75 ec                	jne    8009c3 <strlcpy+0x1b>
+		*dst = '\0';
+  8009d7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009da:	29 f0                	sub    %esi,%eax
+}
+  8009dc:	5b                   	pop    %ebx
+  8009dd:	5e                   	pop    %esi
+  8009de:	5d                   	pop    %ebp
+  8009df:	c3                   	ret
+
+008009e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009e0:	55                   	push   %ebp
+  8009e1:	89 e5                	mov    %esp,%ebp
+  8009e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009e9:	0f b6 01             	movzbl (%ecx),%eax
+  8009ec:	84 c0                	test   %al,%al
+  8009ee:	74 11                	je     800a01 <strcmp+0x21>
+  8009f0:	38 02                	cmp    %al,(%edx)
+  8009f2:	75 0d                	jne    800a01 <strcmp+0x21>
+		p++, q++;
+  8009f4:	83 c1 01             	add    $0x1,%ecx
+  8009f7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009fa:	0f b6 01             	movzbl (%ecx),%eax
+  8009fd:	84 c0                	test   %al,%al
+  8009ff:	75 ef                	jne    8009f0 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a01:	0f b6 c0             	movzbl %al,%eax
+  800a04:	0f b6 12             	movzbl (%edx),%edx
+  800a07:	29 d0                	sub    %edx,%eax
+}
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+
+00800a0b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	53                   	push   %ebx
+  800a0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a15:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a18:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a1d:	85 d2                	test   %edx,%edx
+  800a1f:	74 2e                	je     800a4f <strncmp+0x44>
+  800a21:	0f b6 01             	movzbl (%ecx),%eax
+  800a24:	84 c0                	test   %al,%al
+  800a26:	74 16                	je     800a3e <strncmp+0x33>
+  800a28:	3a 03                	cmp    (%ebx),%al
+  800a2a:	75 12                	jne    800a3e <strncmp+0x33>
+		n--, p++, q++;
+  800a2c:	83 c1 01             	add    $0x1,%ecx
+  800a2f:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a32:	83 ea 01             	sub    $0x1,%edx
+  800a35:	75 ea                	jne    800a21 <strncmp+0x16>
+		return 0;
+  800a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3c:	eb 11                	jmp    800a4f <strncmp+0x44>
+  800a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a43:	85 d2                	test   %edx,%edx
+  800a45:	74 08                	je     800a4f <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a47:	0f b6 01             	movzbl (%ecx),%eax
+  800a4a:	0f b6 13             	movzbl (%ebx),%edx
+  800a4d:	29 d0                	sub    %edx,%eax
+}
+  800a4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+
+00800a54 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a5e:	0f b6 10             	movzbl (%eax),%edx
+  800a61:	84 d2                	test   %dl,%dl
+  800a63:	74 15                	je     800a7a <strchr+0x26>
+		if (*s == c)
+  800a65:	38 d1                	cmp    %dl,%cl
+  800a67:	74 0f                	je     800a78 <strchr+0x24>
+	for (; *s; s++)
+  800a69:	83 c0 01             	add    $0x1,%eax
+  800a6c:	0f b6 10             	movzbl (%eax),%edx
+  800a6f:	84 d2                	test   %dl,%dl
+  800a71:	75 f2                	jne    800a65 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a78:	5d                   	pop    %ebp
+  800a79:	c3                   	ret
+	return 0;
+  800a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7f:	eb f7                	jmp    800a78 <strchr+0x24>
+
+00800a81 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a81:	55                   	push   %ebp
+  800a82:	89 e5                	mov    %esp,%ebp
+  800a84:	53                   	push   %ebx
+  800a85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a88:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a8b:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a8e:	38 d3                	cmp    %dl,%bl
+  800a90:	74 14                	je     800aa6 <strfind+0x25>
+  800a92:	89 d1                	mov    %edx,%ecx
+  800a94:	84 db                	test   %bl,%bl
+  800a96:	74 0e                	je     800aa6 <strfind+0x25>
+	for (; *s; s++)
+  800a98:	83 c0 01             	add    $0x1,%eax
+  800a9b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a9e:	38 ca                	cmp    %cl,%dl
+  800aa0:	74 04                	je     800aa6 <strfind+0x25>
+  800aa2:	84 d2                	test   %dl,%dl
+  800aa4:	75 f2                	jne    800a98 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800aa6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+00800aab <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	57                   	push   %edi
+  800aaf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ab5:	85 c9                	test   %ecx,%ecx
+  800ab7:	74 20                	je     800ad9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ab9:	89 f8                	mov    %edi,%eax
+  800abb:	09 c8                	or     %ecx,%eax
+  800abd:	a8 03                	test   $0x3,%al
+  800abf:	75 12                	jne    800ad3 <memset+0x28>
+		c &= 0xFF;
+  800ac1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ac5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800acb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ace:	fc                   	cld
+  800acf:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad1:	eb 06                	jmp    800ad9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ad6:	fc                   	cld
+  800ad7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ad9:	89 f8                	mov    %edi,%eax
+  800adb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ade:	c9                   	leave
+  800adf:	c3                   	ret
+
+00800ae0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	57                   	push   %edi
+  800ae4:	56                   	push   %esi
+  800ae5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aeb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aee:	39 c6                	cmp    %eax,%esi
+  800af0:	73 32                	jae    800b24 <memmove+0x44>
+  800af2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800af5:	39 d0                	cmp    %edx,%eax
+  800af7:	73 2b                	jae    800b24 <memmove+0x44>
+		s += n;
+		d += n;
+  800af9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afc:	89 d6                	mov    %edx,%esi
+  800afe:	09 fe                	or     %edi,%esi
+  800b00:	09 ce                	or     %ecx,%esi
+  800b02:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b08:	75 0e                	jne    800b18 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b0a:	83 ef 04             	sub    $0x4,%edi
+  800b0d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b10:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b13:	fd                   	std
+  800b14:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b16:	eb 09                	jmp    800b21 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b18:	83 ef 01             	sub    $0x1,%edi
+  800b1b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b1e:	fd                   	std
+  800b1f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b21:	fc                   	cld
+  800b22:	eb 1a                	jmp    800b3e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b24:	89 f2                	mov    %esi,%edx
+  800b26:	09 c2                	or     %eax,%edx
+  800b28:	09 ca                	or     %ecx,%edx
+  800b2a:	f6 c2 03             	test   $0x3,%dl
+  800b2d:	75 0a                	jne    800b39 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b2f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b32:	89 c7                	mov    %eax,%edi
+  800b34:	fc                   	cld
+  800b35:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b37:	eb 05                	jmp    800b3e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b39:	89 c7                	mov    %eax,%edi
+  800b3b:	fc                   	cld
+  800b3c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b48:	ff 75 10             	push   0x10(%ebp)
+  800b4b:	ff 75 0c             	push   0xc(%ebp)
+  800b4e:	ff 75 08             	push   0x8(%ebp)
+  800b51:	e8 8a ff ff ff       	call   800ae0 <memmove>
+}
+  800b56:	c9                   	leave
+  800b57:	c3                   	ret
+
+00800b58 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	56                   	push   %esi
+  800b5c:	53                   	push   %ebx
+  800b5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b63:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b66:	85 f6                	test   %esi,%esi
+  800b68:	74 29                	je     800b93 <memcmp+0x3b>
+  800b6a:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b6c:	0f b6 08             	movzbl (%eax),%ecx
+  800b6f:	0f b6 1a             	movzbl (%edx),%ebx
+  800b72:	38 d9                	cmp    %bl,%cl
+  800b74:	75 11                	jne    800b87 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b76:	83 c0 01             	add    $0x1,%eax
+  800b79:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b7c:	39 c6                	cmp    %eax,%esi
+  800b7e:	75 ec                	jne    800b6c <memcmp+0x14>
+	}
+
+	return 0;
+  800b80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b85:	eb 08                	jmp    800b8f <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b87:	0f b6 c1             	movzbl %cl,%eax
+  800b8a:	0f b6 db             	movzbl %bl,%ebx
+  800b8d:	29 d8                	sub    %ebx,%eax
+}
+  800b8f:	5b                   	pop    %ebx
+  800b90:	5e                   	pop    %esi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+	return 0;
+  800b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b98:	eb f5                	jmp    800b8f <memcmp+0x37>
+
+00800b9a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ba3:	89 c2                	mov    %eax,%edx
+  800ba5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba8:	39 d0                	cmp    %edx,%eax
+  800baa:	73 0d                	jae    800bb9 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bac:	38 08                	cmp    %cl,(%eax)
+  800bae:	74 0d                	je     800bbd <memfind+0x23>
+	for (; s < ends; s++)
+  800bb0:	83 c0 01             	add    $0x1,%eax
+  800bb3:	39 c2                	cmp    %eax,%edx
+  800bb5:	75 f5                	jne    800bac <memfind+0x12>
+  800bb7:	eb 06                	jmp    800bbf <memfind+0x25>
+  800bb9:	89 c2                	mov    %eax,%edx
+  800bbb:	eb 02                	jmp    800bbf <memfind+0x25>
+  800bbd:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800bbf:	89 d0                	mov    %edx,%eax
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	c3                   	ret
+
+00800bc3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	57                   	push   %edi
+  800bc7:	56                   	push   %esi
+  800bc8:	53                   	push   %ebx
+  800bc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bcf:	0f b6 02             	movzbl (%edx),%eax
+  800bd2:	3c 20                	cmp    $0x20,%al
+  800bd4:	74 04                	je     800bda <strtol+0x17>
+  800bd6:	3c 09                	cmp    $0x9,%al
+  800bd8:	75 0e                	jne    800be8 <strtol+0x25>
+		s++;
+  800bda:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bdd:	0f b6 02             	movzbl (%edx),%eax
+  800be0:	3c 20                	cmp    $0x20,%al
+  800be2:	74 f6                	je     800bda <strtol+0x17>
+  800be4:	3c 09                	cmp    $0x9,%al
+  800be6:	74 f2                	je     800bda <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800be8:	3c 2b                	cmp    $0x2b,%al
+  800bea:	74 2a                	je     800c16 <strtol+0x53>
+	int neg = 0;
+  800bec:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bf1:	3c 2d                	cmp    $0x2d,%al
+  800bf3:	74 2b                	je     800c20 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bf5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bfb:	75 0f                	jne    800c0c <strtol+0x49>
+  800bfd:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c00:	74 28                	je     800c2a <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c02:	85 db                	test   %ebx,%ebx
+  800c04:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c09:	0f 44 d8             	cmove  %eax,%ebx
+  800c0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c11:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c14:	eb 46                	jmp    800c5c <strtol+0x99>
+		s++;
+  800c16:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c19:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c1e:	eb d5                	jmp    800bf5 <strtol+0x32>
+		s++, neg = 1;
+  800c20:	83 c2 01             	add    $0x1,%edx
+  800c23:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c28:	eb cb                	jmp    800bf5 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c2a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c2e:	74 0e                	je     800c3e <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c30:	85 db                	test   %ebx,%ebx
+  800c32:	75 d8                	jne    800c0c <strtol+0x49>
+		s++, base = 8;
+  800c34:	83 c2 01             	add    $0x1,%edx
+  800c37:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c3c:	eb ce                	jmp    800c0c <strtol+0x49>
+		s += 2, base = 16;
+  800c3e:	83 c2 02             	add    $0x2,%edx
+  800c41:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c46:	eb c4                	jmp    800c0c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c48:	0f be c0             	movsbl %al,%eax
+  800c4b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c4e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c51:	7d 3a                	jge    800c8d <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c53:	83 c2 01             	add    $0x1,%edx
+  800c56:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c5a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c5c:	0f b6 02             	movzbl (%edx),%eax
+  800c5f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c62:	89 f3                	mov    %esi,%ebx
+  800c64:	80 fb 09             	cmp    $0x9,%bl
+  800c67:	76 df                	jbe    800c48 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c69:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c6c:	89 f3                	mov    %esi,%ebx
+  800c6e:	80 fb 19             	cmp    $0x19,%bl
+  800c71:	77 08                	ja     800c7b <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c73:	0f be c0             	movsbl %al,%eax
+  800c76:	83 e8 57             	sub    $0x57,%eax
+  800c79:	eb d3                	jmp    800c4e <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c7b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c7e:	89 f3                	mov    %esi,%ebx
+  800c80:	80 fb 19             	cmp    $0x19,%bl
+  800c83:	77 08                	ja     800c8d <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c85:	0f be c0             	movsbl %al,%eax
+  800c88:	83 e8 37             	sub    $0x37,%eax
+  800c8b:	eb c1                	jmp    800c4e <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c8d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c91:	74 05                	je     800c98 <strtol+0xd5>
+		*endptr = (char *) s;
+  800c93:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c96:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c98:	89 c8                	mov    %ecx,%eax
+  800c9a:	f7 d8                	neg    %eax
+  800c9c:	85 ff                	test   %edi,%edi
+  800c9e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ca1:	89 c8                	mov    %ecx,%eax
+  800ca3:	5b                   	pop    %ebx
+  800ca4:	5e                   	pop    %esi
+  800ca5:	5f                   	pop    %edi
+  800ca6:	5d                   	pop    %ebp
+  800ca7:	c3                   	ret
+
+00800ca8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	57                   	push   %edi
+  800cac:	56                   	push   %esi
+  800cad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb9:	89 c3                	mov    %eax,%ebx
+  800cbb:	89 c7                	mov    %eax,%edi
+  800cbd:	89 c6                	mov    %eax,%esi
+  800cbf:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cc1:	5b                   	pop    %ebx
+  800cc2:	5e                   	pop    %esi
+  800cc3:	5f                   	pop    %edi
+  800cc4:	5d                   	pop    %ebp
+  800cc5:	c3                   	ret
+
+00800cc6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	57                   	push   %edi
+  800cca:	56                   	push   %esi
+  800ccb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cd6:	89 d1                	mov    %edx,%ecx
+  800cd8:	89 d3                	mov    %edx,%ebx
+  800cda:	89 d7                	mov    %edx,%edi
+  800cdc:	89 d6                	mov    %edx,%esi
+  800cde:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ce0:	5b                   	pop    %ebx
+  800ce1:	5e                   	pop    %esi
+  800ce2:	5f                   	pop    %edi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+
+00800ce5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ce5:	55                   	push   %ebp
+  800ce6:	89 e5                	mov    %esp,%ebp
+  800ce8:	57                   	push   %edi
+  800ce9:	56                   	push   %esi
+  800cea:	53                   	push   %ebx
+  800ceb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cfb:	89 cb                	mov    %ecx,%ebx
+  800cfd:	89 cf                	mov    %ecx,%edi
+  800cff:	89 ce                	mov    %ecx,%esi
+  800d01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d03:	85 c0                	test   %eax,%eax
+  800d05:	7f 08                	jg     800d0f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0f:	83 ec 0c             	sub    $0xc,%esp
+  800d12:	50                   	push   %eax
+  800d13:	6a 03                	push   $0x3
+  800d15:	68 2b 3f 80 00       	push   $0x803f2b
+  800d1a:	6a 23                	push   $0x23
+  800d1c:	68 48 3f 80 00       	push   $0x803f48
+  800d21:	e8 38 f4 ff ff       	call   80015e <_panic>
+
+00800d26 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d31:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d36:	89 d1                	mov    %edx,%ecx
+  800d38:	89 d3                	mov    %edx,%ebx
+  800d3a:	89 d7                	mov    %edx,%edi
+  800d3c:	89 d6                	mov    %edx,%esi
+  800d3e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+
+00800d45 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d50:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d55:	89 d1                	mov    %edx,%ecx
+  800d57:	89 d3                	mov    %edx,%ebx
+  800d59:	89 d7                	mov    %edx,%edi
+  800d5b:	89 d6                	mov    %edx,%esi
+  800d5d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d5f:	5b                   	pop    %ebx
+  800d60:	5e                   	pop    %esi
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+
+00800d64 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6d:	be 00 00 00 00       	mov    $0x0,%esi
+  800d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d78:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d80:	89 f7                	mov    %esi,%edi
+  800d82:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d84:	85 c0                	test   %eax,%eax
+  800d86:	7f 08                	jg     800d90 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d90:	83 ec 0c             	sub    $0xc,%esp
+  800d93:	50                   	push   %eax
+  800d94:	6a 04                	push   $0x4
+  800d96:	68 2b 3f 80 00       	push   $0x803f2b
+  800d9b:	6a 23                	push   $0x23
+  800d9d:	68 48 3f 80 00       	push   $0x803f48
+  800da2:	e8 b7 f3 ff ff       	call   80015e <_panic>
+
+00800da7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	57                   	push   %edi
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+  800dad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dc4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc6:	85 c0                	test   %eax,%eax
+  800dc8:	7f 08                	jg     800dd2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5e                   	pop    %esi
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd2:	83 ec 0c             	sub    $0xc,%esp
+  800dd5:	50                   	push   %eax
+  800dd6:	6a 05                	push   $0x5
+  800dd8:	68 2b 3f 80 00       	push   $0x803f2b
+  800ddd:	6a 23                	push   $0x23
+  800ddf:	68 48 3f 80 00       	push   $0x803f48
+  800de4:	e8 75 f3 ff ff       	call   80015e <_panic>
+
+00800de9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	57                   	push   %edi
+  800ded:	56                   	push   %esi
+  800dee:	53                   	push   %ebx
+  800def:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e02:	89 df                	mov    %ebx,%edi
+  800e04:	89 de                	mov    %ebx,%esi
+  800e06:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e08:	85 c0                	test   %eax,%eax
+  800e0a:	7f 08                	jg     800e14 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5f                   	pop    %edi
+  800e12:	5d                   	pop    %ebp
+  800e13:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+  800e17:	50                   	push   %eax
+  800e18:	6a 06                	push   $0x6
+  800e1a:	68 2b 3f 80 00       	push   $0x803f2b
+  800e1f:	6a 23                	push   $0x23
+  800e21:	68 48 3f 80 00       	push   $0x803f48
+  800e26:	e8 33 f3 ff ff       	call   80015e <_panic>
+
+00800e2b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	57                   	push   %edi
+  800e2f:	56                   	push   %esi
+  800e30:	53                   	push   %ebx
+  800e31:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e44:	89 df                	mov    %ebx,%edi
+  800e46:	89 de                	mov    %ebx,%esi
+  800e48:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4a:	85 c0                	test   %eax,%eax
+  800e4c:	7f 08                	jg     800e56 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e51:	5b                   	pop    %ebx
+  800e52:	5e                   	pop    %esi
+  800e53:	5f                   	pop    %edi
+  800e54:	5d                   	pop    %ebp
+  800e55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e56:	83 ec 0c             	sub    $0xc,%esp
+  800e59:	50                   	push   %eax
+  800e5a:	6a 08                	push   $0x8
+  800e5c:	68 2b 3f 80 00       	push   $0x803f2b
+  800e61:	6a 23                	push   $0x23
+  800e63:	68 48 3f 80 00       	push   $0x803f48
+  800e68:	e8 f1 f2 ff ff       	call   80015e <_panic>
+
+00800e6d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	57                   	push   %edi
+  800e71:	56                   	push   %esi
+  800e72:	53                   	push   %ebx
+  800e73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e81:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e86:	89 df                	mov    %ebx,%edi
+  800e88:	89 de                	mov    %ebx,%esi
+  800e8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8c:	85 c0                	test   %eax,%eax
+  800e8e:	7f 08                	jg     800e98 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e93:	5b                   	pop    %ebx
+  800e94:	5e                   	pop    %esi
+  800e95:	5f                   	pop    %edi
+  800e96:	5d                   	pop    %ebp
+  800e97:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e98:	83 ec 0c             	sub    $0xc,%esp
+  800e9b:	50                   	push   %eax
+  800e9c:	6a 09                	push   $0x9
+  800e9e:	68 2b 3f 80 00       	push   $0x803f2b
+  800ea3:	6a 23                	push   $0x23
+  800ea5:	68 48 3f 80 00       	push   $0x803f48
+  800eaa:	e8 af f2 ff ff       	call   80015e <_panic>
+
+00800eaf <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	57                   	push   %edi
+  800eb3:	56                   	push   %esi
+  800eb4:	53                   	push   %ebx
+  800eb5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec8:	89 df                	mov    %ebx,%edi
+  800eca:	89 de                	mov    %ebx,%esi
+  800ecc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ece:	85 c0                	test   %eax,%eax
+  800ed0:	7f 08                	jg     800eda <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ed2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed5:	5b                   	pop    %ebx
+  800ed6:	5e                   	pop    %esi
+  800ed7:	5f                   	pop    %edi
+  800ed8:	5d                   	pop    %ebp
+  800ed9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+  800edd:	50                   	push   %eax
+  800ede:	6a 0a                	push   $0xa
+  800ee0:	68 2b 3f 80 00       	push   $0x803f2b
+  800ee5:	6a 23                	push   $0x23
+  800ee7:	68 48 3f 80 00       	push   $0x803f48
+  800eec:	e8 6d f2 ff ff       	call   80015e <_panic>
+
+00800ef1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	57                   	push   %edi
+  800ef5:	56                   	push   %esi
+  800ef6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f02:	be 00 00 00 00       	mov    $0x0,%esi
+  800f07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5f                   	pop    %edi
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+
+00800f14 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	56                   	push   %esi
+  800f19:	53                   	push   %ebx
+  800f1a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f2a:	89 cb                	mov    %ecx,%ebx
+  800f2c:	89 cf                	mov    %ecx,%edi
+  800f2e:	89 ce                	mov    %ecx,%esi
+  800f30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7f 08                	jg     800f3e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  800f41:	50                   	push   %eax
+  800f42:	6a 0d                	push   $0xd
+  800f44:	68 2b 3f 80 00       	push   $0x803f2b
+  800f49:	6a 23                	push   $0x23
+  800f4b:	68 48 3f 80 00       	push   $0x803f48
+  800f50:	e8 09 f2 ff ff       	call   80015e <_panic>
+
+00800f55 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f61:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f69:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f6f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+
+00800f76 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	57                   	push   %edi
+  800f7a:	56                   	push   %esi
+  800f7b:	53                   	push   %ebx
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f8f:	89 df                	mov    %ebx,%edi
+  800f91:	89 de                	mov    %ebx,%esi
+  800f93:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f95:	85 c0                	test   %eax,%eax
+  800f97:	7f 08                	jg     800fa1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9c:	5b                   	pop    %ebx
+  800f9d:	5e                   	pop    %esi
+  800f9e:	5f                   	pop    %edi
+  800f9f:	5d                   	pop    %ebp
+  800fa0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa1:	83 ec 0c             	sub    $0xc,%esp
+  800fa4:	50                   	push   %eax
+  800fa5:	6a 0d                	push   $0xd
+  800fa7:	68 2b 3f 80 00       	push   $0x803f2b
+  800fac:	6a 23                	push   $0x23
+  800fae:	68 48 3f 80 00       	push   $0x803f48
+  800fb3:	e8 a6 f1 ff ff       	call   80015e <_panic>
+
+00800fb8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fc8:	89 d1                	mov    %edx,%ecx
+  800fca:	89 d3                	mov    %edx,%ebx
+  800fcc:	89 d7                	mov    %edx,%edi
+  800fce:	89 d6                	mov    %edx,%esi
+  800fd0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fd2:	5b                   	pop    %ebx
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5f                   	pop    %edi
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	c3                   	ret
+
+00800fd7 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	57                   	push   %edi
+  800fdb:	56                   	push   %esi
+  800fdc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fed:	89 df                	mov    %ebx,%edi
+  800fef:	89 de                	mov    %ebx,%esi
+  800ff1:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+
+00800ff8 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800ff8:	55                   	push   %ebp
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	57                   	push   %edi
+  800ffc:	56                   	push   %esi
+  800ffd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	b8 10 00 00 00       	mov    $0x10,%eax
+  80100b:	89 cb                	mov    %ecx,%ebx
+  80100d:	89 cf                	mov    %ecx,%edi
+  80100f:	89 ce                	mov    %ecx,%esi
+  801011:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801013:	5b                   	pop    %ebx
+  801014:	5e                   	pop    %esi
+  801015:	5f                   	pop    %edi
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+
+00801018 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	56                   	push   %esi
+  80101d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801023:	8b 55 08             	mov    0x8(%ebp),%edx
+  801026:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801029:	b8 11 00 00 00       	mov    $0x11,%eax
+  80102e:	89 df                	mov    %ebx,%edi
+  801030:	89 de                	mov    %ebx,%esi
+  801032:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801034:	5b                   	pop    %ebx
+  801035:	5e                   	pop    %esi
+  801036:	5f                   	pop    %edi
+  801037:	5d                   	pop    %ebp
+  801038:	c3                   	ret
+
+00801039 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	57                   	push   %edi
+  80103d:	56                   	push   %esi
+  80103e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80104f:	89 df                	mov    %ebx,%edi
+  801051:	89 de                	mov    %ebx,%esi
+  801053:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801055:	5b                   	pop    %ebx
+  801056:	5e                   	pop    %esi
+  801057:	5f                   	pop    %edi
+  801058:	5d                   	pop    %ebp
+  801059:	c3                   	ret
+
+0080105a <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	57                   	push   %edi
+  80105e:	56                   	push   %esi
+  80105f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801060:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801065:	8b 55 08             	mov    0x8(%ebp),%edx
+  801068:	b8 13 00 00 00       	mov    $0x13,%eax
+  80106d:	89 cb                	mov    %ecx,%ebx
+  80106f:	89 cf                	mov    %ecx,%edi
+  801071:	89 ce                	mov    %ecx,%esi
+  801073:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801075:	5b                   	pop    %ebx
+  801076:	5e                   	pop    %esi
+  801077:	5f                   	pop    %edi
+  801078:	5d                   	pop    %ebp
+  801079:	c3                   	ret
+
+0080107a <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	57                   	push   %edi
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801080:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801090:	89 df                	mov    %ebx,%edi
+  801092:	89 de                	mov    %ebx,%esi
+  801094:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801096:	5b                   	pop    %ebx
+  801097:	5e                   	pop    %esi
+  801098:	5f                   	pop    %edi
+  801099:	5d                   	pop    %ebp
+  80109a:	c3                   	ret
+
+0080109b <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	57                   	push   %edi
+  80109f:	56                   	push   %esi
+  8010a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010ae:	89 cb                	mov    %ecx,%ebx
+  8010b0:	89 cf                	mov    %ecx,%edi
+  8010b2:	89 ce                	mov    %ecx,%esi
+  8010b4:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8010b6:	5b                   	pop    %ebx
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5f                   	pop    %edi
+  8010b9:	5d                   	pop    %ebp
+  8010ba:	c3                   	ret
+
+008010bb <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d4:	89 f7                	mov    %esi,%edi
+  8010d6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5e                   	pop    %esi
+  8010da:	5f                   	pop    %edi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+
+008010dd <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8010dd:	55                   	push   %ebp
+  8010de:	89 e5                	mov    %esp,%ebp
+  8010e0:	57                   	push   %edi
+  8010e1:	56                   	push   %esi
+  8010e2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010f3:	89 df                	mov    %ebx,%edi
+  8010f5:	89 de                	mov    %ebx,%esi
+  8010f7:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8010f9:	5b                   	pop    %ebx
+  8010fa:	5e                   	pop    %esi
+  8010fb:	5f                   	pop    %edi
+  8010fc:	5d                   	pop    %ebp
+  8010fd:	c3                   	ret
+
+008010fe <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801104:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801111:	89 cb                	mov    %ecx,%ebx
+  801113:	89 cf                	mov    %ecx,%edi
+  801115:	89 ce                	mov    %ecx,%esi
+  801117:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801119:	5b                   	pop    %ebx
+  80111a:	5e                   	pop    %esi
+  80111b:	5f                   	pop    %edi
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+
+0080111e <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+  801121:	57                   	push   %edi
+  801122:	56                   	push   %esi
+  801123:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801124:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801128:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801130:	b8 19 00 00 00       	mov    $0x19,%eax
+  801135:	89 df                	mov    %ebx,%edi
+  801137:	89 de                	mov    %ebx,%esi
+  801139:	cd 30                	int    $0x30
+}
+  80113b:	5b                   	pop    %ebx
+  80113c:	5e                   	pop    %esi
+  80113d:	5f                   	pop    %edi
+  80113e:	5d                   	pop    %ebp
+  80113f:	c3                   	ret
+
+00801140 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801146:	be 00 00 00 00       	mov    $0x0,%esi
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801151:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801156:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801159:	89 f7                	mov    %esi,%edi
+  80115b:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+
+00801162 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	57                   	push   %edi
+  801166:	56                   	push   %esi
+  801167:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801168:	be 00 00 00 00       	mov    $0x0,%esi
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801178:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117b:	89 f7                	mov    %esi,%edi
+  80117d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80117f:	5b                   	pop    %ebx
+  801180:	5e                   	pop    %esi
+  801181:	5f                   	pop    %edi
+  801182:	5d                   	pop    %ebp
+  801183:	c3                   	ret
+
+00801184 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	57                   	push   %edi
+  801188:	56                   	push   %esi
+  801189:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801192:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801195:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80119a:	89 df                	mov    %ebx,%edi
+  80119c:	89 de                	mov    %ebx,%esi
+  80119e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5e                   	pop    %esi
+  8011a2:	5f                   	pop    %edi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+
+008011a5 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	57                   	push   %edi
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8011bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011be:	89 f7                	mov    %esi,%edi
+  8011c0:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8011c2:	5b                   	pop    %ebx
+  8011c3:	5e                   	pop    %esi
+  8011c4:	5f                   	pop    %edi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	c3                   	ret
+
+008011c7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8011cd:	83 3d c0 63 80 00 00 	cmpl   $0x0,0x8063c0
+  8011d4:	74 0a                	je     8011e0 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8011d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d9:	a3 c0 63 80 00       	mov    %eax,0x8063c0
+}
+  8011de:	c9                   	leave
+  8011df:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8011e0:	83 ec 04             	sub    $0x4,%esp
+  8011e3:	6a 07                	push   $0x7
+  8011e5:	68 00 f0 bf ee       	push   $0xeebff000
+  8011ea:	6a 00                	push   $0x0
+  8011ec:	e8 73 fb ff ff       	call   800d64 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8011f1:	83 c4 08             	add    $0x8,%esp
+  8011f4:	68 05 12 80 00       	push   $0x801205
+  8011f9:	6a 00                	push   $0x0
+  8011fb:	e8 af fc ff ff       	call   800eaf <sys_env_set_pgfault_upcall>
+  801200:	83 c4 10             	add    $0x10,%esp
+  801203:	eb d1                	jmp    8011d6 <set_pgfault_handler+0xf>
+
+00801205 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801205:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801206:	a1 c0 63 80 00       	mov    0x8063c0,%eax
+	call *%eax
+  80120b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80120d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  801210:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  801214:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  801217:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  80121b:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  80121d:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  801221:	83 c4 08             	add    $0x8,%esp
+	popal;
+  801224:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  801225:	83 c4 04             	add    $0x4,%esp
+	popf
+  801228:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  801229:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80122a:	c3                   	ret
+
+0080122b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80122e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801231:	05 00 00 00 30       	add    $0x30000000,%eax
+  801236:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+
+0080123b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80123e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801241:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801246:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80124b:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+
+00801252 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801252:	55                   	push   %ebp
+  801253:	89 e5                	mov    %esp,%ebp
+  801255:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80125a:	89 c2                	mov    %eax,%edx
+  80125c:	c1 ea 16             	shr    $0x16,%edx
+  80125f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801266:	f6 c2 01             	test   $0x1,%dl
+  801269:	74 29                	je     801294 <fd_alloc+0x42>
+  80126b:	89 c2                	mov    %eax,%edx
+  80126d:	c1 ea 0c             	shr    $0xc,%edx
+  801270:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801277:	f6 c2 01             	test   $0x1,%dl
+  80127a:	74 18                	je     801294 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80127c:	05 00 10 00 00       	add    $0x1000,%eax
+  801281:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801286:	75 d2                	jne    80125a <fd_alloc+0x8>
+  801288:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80128d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801292:	eb 05                	jmp    801299 <fd_alloc+0x47>
+			return 0;
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801299:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129c:	89 02                	mov    %eax,(%edx)
+}
+  80129e:	89 c8                	mov    %ecx,%eax
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+
+008012a2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012a8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8012ad:	77 30                	ja     8012df <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012af:	c1 e0 0c             	shl    $0xc,%eax
+  8012b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8012b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012bd:	f6 c2 01             	test   $0x1,%dl
+  8012c0:	74 24                	je     8012e6 <fd_lookup+0x44>
+  8012c2:	89 c2                	mov    %eax,%edx
+  8012c4:	c1 ea 0c             	shr    $0xc,%edx
+  8012c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012ce:	f6 c2 01             	test   $0x1,%dl
+  8012d1:	74 1a                	je     8012ed <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012d6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+		return -E_INVAL;
+  8012df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e4:	eb f7                	jmp    8012dd <fd_lookup+0x3b>
+		return -E_INVAL;
+  8012e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012eb:	eb f0                	jmp    8012dd <fd_lookup+0x3b>
+  8012ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f2:	eb e9                	jmp    8012dd <fd_lookup+0x3b>
+
+008012f4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012f4:	55                   	push   %ebp
+  8012f5:	89 e5                	mov    %esp,%ebp
+  8012f7:	53                   	push   %ebx
+  8012f8:	83 ec 04             	sub    $0x4,%esp
+  8012fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801303:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801308:	39 13                	cmp    %edx,(%ebx)
+  80130a:	74 54                	je     801360 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80130c:	83 c0 01             	add    $0x1,%eax
+  80130f:	8b 1c 85 d4 3f 80 00 	mov    0x803fd4(,%eax,4),%ebx
+  801316:	85 db                	test   %ebx,%ebx
+  801318:	75 ee                	jne    801308 <dev_lookup+0x14>
+  80131a:	89 e1                	mov    %esp,%ecx
+  80131c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801321:	29 c8                	sub    %ecx,%eax
+  801323:	89 c1                	mov    %eax,%ecx
+  801325:	c1 e9 0f             	shr    $0xf,%ecx
+  801328:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80132d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801332:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801335:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80133c:	8b 40 48             	mov    0x48(%eax),%eax
+  80133f:	83 ec 04             	sub    $0x4,%esp
+  801342:	52                   	push   %edx
+  801343:	50                   	push   %eax
+  801344:	68 58 3f 80 00       	push   $0x803f58
+  801349:	e8 eb ee ff ff       	call   800239 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801356:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801359:	89 1a                	mov    %ebx,(%edx)
+}
+  80135b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80135e:	c9                   	leave
+  80135f:	c3                   	ret
+			return 0;
+  801360:	b8 00 00 00 00       	mov    $0x0,%eax
+  801365:	eb ef                	jmp    801356 <dev_lookup+0x62>
+
+00801367 <fd_close>:
+{
+  801367:	55                   	push   %ebp
+  801368:	89 e5                	mov    %esp,%ebp
+  80136a:	57                   	push   %edi
+  80136b:	56                   	push   %esi
+  80136c:	53                   	push   %ebx
+  80136d:	83 ec 24             	sub    $0x24,%esp
+  801370:	8b 75 08             	mov    0x8(%ebp),%esi
+  801373:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801376:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801379:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80137a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801380:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801383:	50                   	push   %eax
+  801384:	e8 19 ff ff ff       	call   8012a2 <fd_lookup>
+  801389:	89 c3                	mov    %eax,%ebx
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	78 05                	js     801397 <fd_close+0x30>
+	    || fd != fd2)
+  801392:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801395:	74 0f                	je     8013a6 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801397:	85 ff                	test   %edi,%edi
+  801399:	0f 44 df             	cmove  %edi,%ebx
+}
+  80139c:	89 d8                	mov    %ebx,%eax
+  80139e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a1:	5b                   	pop    %ebx
+  8013a2:	5e                   	pop    %esi
+  8013a3:	5f                   	pop    %edi
+  8013a4:	5d                   	pop    %ebp
+  8013a5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013a6:	83 ec 08             	sub    $0x8,%esp
+  8013a9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013ac:	50                   	push   %eax
+  8013ad:	ff 36                	push   (%esi)
+  8013af:	e8 40 ff ff ff       	call   8012f4 <dev_lookup>
+  8013b4:	89 c3                	mov    %eax,%ebx
+  8013b6:	83 c4 10             	add    $0x10,%esp
+  8013b9:	85 c0                	test   %eax,%eax
+  8013bb:	78 1a                	js     8013d7 <fd_close+0x70>
+		if (dev->dev_close)
+  8013bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013c0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013c8:	85 c0                	test   %eax,%eax
+  8013ca:	74 0b                	je     8013d7 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8013cc:	83 ec 0c             	sub    $0xc,%esp
+  8013cf:	56                   	push   %esi
+  8013d0:	ff d0                	call   *%eax
+  8013d2:	89 c3                	mov    %eax,%ebx
+  8013d4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013d7:	83 ec 08             	sub    $0x8,%esp
+  8013da:	56                   	push   %esi
+  8013db:	6a 00                	push   $0x0
+  8013dd:	e8 07 fa ff ff       	call   800de9 <sys_page_unmap>
+	return r;
+  8013e2:	83 c4 10             	add    $0x10,%esp
+  8013e5:	eb b5                	jmp    80139c <fd_close+0x35>
+
+008013e7 <close>:
+
+int
+close(int fdnum)
+{
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f0:	50                   	push   %eax
+  8013f1:	ff 75 08             	push   0x8(%ebp)
+  8013f4:	e8 a9 fe ff ff       	call   8012a2 <fd_lookup>
+  8013f9:	83 c4 10             	add    $0x10,%esp
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	79 02                	jns    801402 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801400:	c9                   	leave
+  801401:	c3                   	ret
+		return fd_close(fd, 1);
+  801402:	83 ec 08             	sub    $0x8,%esp
+  801405:	6a 01                	push   $0x1
+  801407:	ff 75 f4             	push   -0xc(%ebp)
+  80140a:	e8 58 ff ff ff       	call   801367 <fd_close>
+  80140f:	83 c4 10             	add    $0x10,%esp
+  801412:	eb ec                	jmp    801400 <close+0x19>
+
+00801414 <close_all>:
+
+void
+close_all(void)
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	53                   	push   %ebx
+  801418:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80141b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801420:	83 ec 0c             	sub    $0xc,%esp
+  801423:	53                   	push   %ebx
+  801424:	e8 be ff ff ff       	call   8013e7 <close>
+	for (i = 0; i < MAXFD; i++)
+  801429:	83 c3 01             	add    $0x1,%ebx
+  80142c:	83 c4 10             	add    $0x10,%esp
+  80142f:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801435:	75 e9                	jne    801420 <close_all+0xc>
+}
+  801437:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143a:	c9                   	leave
+  80143b:	c3                   	ret
+
+0080143c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80143c:	55                   	push   %ebp
+  80143d:	89 e5                	mov    %esp,%ebp
+  80143f:	57                   	push   %edi
+  801440:	56                   	push   %esi
+  801441:	53                   	push   %ebx
+  801442:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801445:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801448:	50                   	push   %eax
+  801449:	ff 75 08             	push   0x8(%ebp)
+  80144c:	e8 51 fe ff ff       	call   8012a2 <fd_lookup>
+  801451:	89 c3                	mov    %eax,%ebx
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	85 c0                	test   %eax,%eax
+  801458:	78 7f                	js     8014d9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80145a:	83 ec 0c             	sub    $0xc,%esp
+  80145d:	ff 75 0c             	push   0xc(%ebp)
+  801460:	e8 82 ff ff ff       	call   8013e7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801465:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801468:	c1 e6 0c             	shl    $0xc,%esi
+  80146b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801474:	89 3c 24             	mov    %edi,(%esp)
+  801477:	e8 bf fd ff ff       	call   80123b <fd2data>
+  80147c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80147e:	89 34 24             	mov    %esi,(%esp)
+  801481:	e8 b5 fd ff ff       	call   80123b <fd2data>
+  801486:	83 c4 10             	add    $0x10,%esp
+  801489:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80148c:	89 d8                	mov    %ebx,%eax
+  80148e:	c1 e8 16             	shr    $0x16,%eax
+  801491:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801498:	a8 01                	test   $0x1,%al
+  80149a:	74 11                	je     8014ad <dup+0x71>
+  80149c:	89 d8                	mov    %ebx,%eax
+  80149e:	c1 e8 0c             	shr    $0xc,%eax
+  8014a1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014a8:	f6 c2 01             	test   $0x1,%dl
+  8014ab:	75 36                	jne    8014e3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014ad:	89 f8                	mov    %edi,%eax
+  8014af:	c1 e8 0c             	shr    $0xc,%eax
+  8014b2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014b9:	83 ec 0c             	sub    $0xc,%esp
+  8014bc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014c1:	50                   	push   %eax
+  8014c2:	56                   	push   %esi
+  8014c3:	6a 00                	push   $0x0
+  8014c5:	57                   	push   %edi
+  8014c6:	6a 00                	push   $0x0
+  8014c8:	e8 da f8 ff ff       	call   800da7 <sys_page_map>
+  8014cd:	89 c3                	mov    %eax,%ebx
+  8014cf:	83 c4 20             	add    $0x20,%esp
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	78 33                	js     801509 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014d9:	89 d8                	mov    %ebx,%eax
+  8014db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014de:	5b                   	pop    %ebx
+  8014df:	5e                   	pop    %esi
+  8014e0:	5f                   	pop    %edi
+  8014e1:	5d                   	pop    %ebp
+  8014e2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014ea:	83 ec 0c             	sub    $0xc,%esp
+  8014ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014f2:	50                   	push   %eax
+  8014f3:	ff 75 d4             	push   -0x2c(%ebp)
+  8014f6:	6a 00                	push   $0x0
+  8014f8:	53                   	push   %ebx
+  8014f9:	6a 00                	push   $0x0
+  8014fb:	e8 a7 f8 ff ff       	call   800da7 <sys_page_map>
+  801500:	89 c3                	mov    %eax,%ebx
+  801502:	83 c4 20             	add    $0x20,%esp
+  801505:	85 c0                	test   %eax,%eax
+  801507:	79 a4                	jns    8014ad <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801509:	83 ec 08             	sub    $0x8,%esp
+  80150c:	56                   	push   %esi
+  80150d:	6a 00                	push   $0x0
+  80150f:	e8 d5 f8 ff ff       	call   800de9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801514:	83 c4 08             	add    $0x8,%esp
+  801517:	ff 75 d4             	push   -0x2c(%ebp)
+  80151a:	6a 00                	push   $0x0
+  80151c:	e8 c8 f8 ff ff       	call   800de9 <sys_page_unmap>
+	return r;
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	eb b3                	jmp    8014d9 <dup+0x9d>
+
+00801526 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+  801529:	56                   	push   %esi
+  80152a:	53                   	push   %ebx
+  80152b:	83 ec 18             	sub    $0x18,%esp
+  80152e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801531:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801534:	50                   	push   %eax
+  801535:	53                   	push   %ebx
+  801536:	e8 67 fd ff ff       	call   8012a2 <fd_lookup>
+  80153b:	83 c4 10             	add    $0x10,%esp
+  80153e:	85 c0                	test   %eax,%eax
+  801540:	78 3c                	js     80157e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801542:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801545:	83 ec 08             	sub    $0x8,%esp
+  801548:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154b:	50                   	push   %eax
+  80154c:	ff 36                	push   (%esi)
+  80154e:	e8 a1 fd ff ff       	call   8012f4 <dev_lookup>
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	85 c0                	test   %eax,%eax
+  801558:	78 24                	js     80157e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80155a:	8b 46 08             	mov    0x8(%esi),%eax
+  80155d:	83 e0 03             	and    $0x3,%eax
+  801560:	83 f8 01             	cmp    $0x1,%eax
+  801563:	74 20                	je     801585 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801565:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801568:	8b 40 08             	mov    0x8(%eax),%eax
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	74 54                	je     8015c3 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80156f:	83 ec 04             	sub    $0x4,%esp
+  801572:	ff 75 10             	push   0x10(%ebp)
+  801575:	ff 75 0c             	push   0xc(%ebp)
+  801578:	56                   	push   %esi
+  801579:	ff d0                	call   *%eax
+  80157b:	83 c4 10             	add    $0x10,%esp
+}
+  80157e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801581:	5b                   	pop    %ebx
+  801582:	5e                   	pop    %esi
+  801583:	5d                   	pop    %ebp
+  801584:	c3                   	ret
+  801585:	89 e2                	mov    %esp,%edx
+  801587:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80158c:	29 d0                	sub    %edx,%eax
+  80158e:	89 c2                	mov    %eax,%edx
+  801590:	c1 ea 0f             	shr    $0xf,%edx
+  801593:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801598:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159d:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015a0:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8015a7:	8b 40 48             	mov    0x48(%eax),%eax
+  8015aa:	83 ec 04             	sub    $0x4,%esp
+  8015ad:	53                   	push   %ebx
+  8015ae:	50                   	push   %eax
+  8015af:	68 99 3f 80 00       	push   $0x803f99
+  8015b4:	e8 80 ec ff ff       	call   800239 <cprintf>
+		return -E_INVAL;
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c1:	eb bb                	jmp    80157e <read+0x58>
+		return -E_NOT_SUPP;
+  8015c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c8:	eb b4                	jmp    80157e <read+0x58>
+
+008015ca <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015ca:	55                   	push   %ebp
+  8015cb:	89 e5                	mov    %esp,%ebp
+  8015cd:	57                   	push   %edi
+  8015ce:	56                   	push   %esi
+  8015cf:	53                   	push   %ebx
+  8015d0:	83 ec 0c             	sub    $0xc,%esp
+  8015d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8015d6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015d9:	85 f6                	test   %esi,%esi
+  8015db:	74 30                	je     80160d <readn+0x43>
+  8015dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015e7:	83 ec 04             	sub    $0x4,%esp
+  8015ea:	89 f2                	mov    %esi,%edx
+  8015ec:	29 c2                	sub    %eax,%edx
+  8015ee:	52                   	push   %edx
+  8015ef:	01 f8                	add    %edi,%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	ff 75 08             	push   0x8(%ebp)
+  8015f5:	e8 2c ff ff ff       	call   801526 <read>
+		if (m < 0)
+  8015fa:	83 c4 10             	add    $0x10,%esp
+  8015fd:	85 c0                	test   %eax,%eax
+  8015ff:	78 15                	js     801616 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801601:	74 11                	je     801614 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801603:	01 c3                	add    %eax,%ebx
+  801605:	89 d8                	mov    %ebx,%eax
+  801607:	39 f3                	cmp    %esi,%ebx
+  801609:	72 dc                	jb     8015e7 <readn+0x1d>
+  80160b:	eb 09                	jmp    801616 <readn+0x4c>
+  80160d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801612:	eb 02                	jmp    801616 <readn+0x4c>
+  801614:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801616:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801619:	5b                   	pop    %ebx
+  80161a:	5e                   	pop    %esi
+  80161b:	5f                   	pop    %edi
+  80161c:	5d                   	pop    %ebp
+  80161d:	c3                   	ret
+
+0080161e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80161e:	55                   	push   %ebp
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	56                   	push   %esi
+  801622:	53                   	push   %ebx
+  801623:	83 ec 18             	sub    $0x18,%esp
+  801626:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801629:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80162c:	50                   	push   %eax
+  80162d:	53                   	push   %ebx
+  80162e:	e8 6f fc ff ff       	call   8012a2 <fd_lookup>
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	85 c0                	test   %eax,%eax
+  801638:	78 37                	js     801671 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80163a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80163d:	83 ec 08             	sub    $0x8,%esp
+  801640:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801643:	50                   	push   %eax
+  801644:	ff 36                	push   (%esi)
+  801646:	e8 a9 fc ff ff       	call   8012f4 <dev_lookup>
+  80164b:	83 c4 10             	add    $0x10,%esp
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	78 1f                	js     801671 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801652:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801656:	74 20                	je     801678 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801658:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80165b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	74 54                	je     8016b6 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801662:	83 ec 04             	sub    $0x4,%esp
+  801665:	ff 75 10             	push   0x10(%ebp)
+  801668:	ff 75 0c             	push   0xc(%ebp)
+  80166b:	56                   	push   %esi
+  80166c:	ff d0                	call   *%eax
+  80166e:	83 c4 10             	add    $0x10,%esp
+}
+  801671:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+  801678:	89 e2                	mov    %esp,%edx
+  80167a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80167f:	29 d0                	sub    %edx,%eax
+  801681:	89 c2                	mov    %eax,%edx
+  801683:	c1 ea 0f             	shr    $0xf,%edx
+  801686:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80168b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801690:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801693:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80169a:	8b 40 48             	mov    0x48(%eax),%eax
+  80169d:	83 ec 04             	sub    $0x4,%esp
+  8016a0:	53                   	push   %ebx
+  8016a1:	50                   	push   %eax
+  8016a2:	68 b5 3f 80 00       	push   $0x803fb5
+  8016a7:	e8 8d eb ff ff       	call   800239 <cprintf>
+		return -E_INVAL;
+  8016ac:	83 c4 10             	add    $0x10,%esp
+  8016af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b4:	eb bb                	jmp    801671 <write+0x53>
+		return -E_NOT_SUPP;
+  8016b6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016bb:	eb b4                	jmp    801671 <write+0x53>
+
+008016bd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c6:	50                   	push   %eax
+  8016c7:	ff 75 08             	push   0x8(%ebp)
+  8016ca:	e8 d3 fb ff ff       	call   8012a2 <fd_lookup>
+  8016cf:	83 c4 10             	add    $0x10,%esp
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	78 0e                	js     8016e4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016dc:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+008016e6 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	53                   	push   %ebx
+  8016ea:	83 ec 1c             	sub    $0x1c,%esp
+  8016ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016f3:	50                   	push   %eax
+  8016f4:	ff 75 08             	push   0x8(%ebp)
+  8016f7:	e8 a6 fb ff ff       	call   8012a2 <fd_lookup>
+  8016fc:	83 c4 10             	add    $0x10,%esp
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	78 33                	js     801736 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801703:	83 fb 03             	cmp    $0x3,%ebx
+  801706:	74 28                	je     801730 <fcntl+0x4a>
+  801708:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80170d:	83 fb 04             	cmp    $0x4,%ebx
+  801710:	75 24                	jne    801736 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801712:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801715:	8b 41 08             	mov    0x8(%ecx),%eax
+  801718:	80 e4 ef             	and    $0xef,%ah
+  80171b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80171e:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801724:	09 d0                	or     %edx,%eax
+  801726:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172e:	eb 06                	jmp    801736 <fcntl+0x50>
+		return fd->fd_omode;
+  801730:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801733:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801736:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801739:	c9                   	leave
+  80173a:	c3                   	ret
+
+0080173b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	56                   	push   %esi
+  80173f:	53                   	push   %ebx
+  801740:	83 ec 18             	sub    $0x18,%esp
+  801743:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801746:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801749:	50                   	push   %eax
+  80174a:	53                   	push   %ebx
+  80174b:	e8 52 fb ff ff       	call   8012a2 <fd_lookup>
+  801750:	83 c4 10             	add    $0x10,%esp
+  801753:	85 c0                	test   %eax,%eax
+  801755:	78 34                	js     80178b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801757:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80175a:	83 ec 08             	sub    $0x8,%esp
+  80175d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801760:	50                   	push   %eax
+  801761:	ff 36                	push   (%esi)
+  801763:	e8 8c fb ff ff       	call   8012f4 <dev_lookup>
+  801768:	83 c4 10             	add    $0x10,%esp
+  80176b:	85 c0                	test   %eax,%eax
+  80176d:	78 1c                	js     80178b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80176f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801773:	74 1d                	je     801792 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801775:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801778:	8b 40 18             	mov    0x18(%eax),%eax
+  80177b:	85 c0                	test   %eax,%eax
+  80177d:	74 51                	je     8017d0 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80177f:	83 ec 08             	sub    $0x8,%esp
+  801782:	ff 75 0c             	push   0xc(%ebp)
+  801785:	56                   	push   %esi
+  801786:	ff d0                	call   *%eax
+  801788:	83 c4 10             	add    $0x10,%esp
+}
+  80178b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+  801792:	89 e2                	mov    %esp,%edx
+  801794:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801799:	29 d0                	sub    %edx,%eax
+  80179b:	89 c2                	mov    %eax,%edx
+  80179d:	c1 ea 0f             	shr    $0xf,%edx
+  8017a0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017aa:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8017ad:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8017b4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017b7:	83 ec 04             	sub    $0x4,%esp
+  8017ba:	53                   	push   %ebx
+  8017bb:	50                   	push   %eax
+  8017bc:	68 78 3f 80 00       	push   $0x803f78
+  8017c1:	e8 73 ea ff ff       	call   800239 <cprintf>
+		return -E_INVAL;
+  8017c6:	83 c4 10             	add    $0x10,%esp
+  8017c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ce:	eb bb                	jmp    80178b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017d0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d5:	eb b4                	jmp    80178b <ftruncate+0x50>
+
+008017d7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	56                   	push   %esi
+  8017db:	53                   	push   %ebx
+  8017dc:	83 ec 18             	sub    $0x18,%esp
+  8017df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e5:	50                   	push   %eax
+  8017e6:	ff 75 08             	push   0x8(%ebp)
+  8017e9:	e8 b4 fa ff ff       	call   8012a2 <fd_lookup>
+  8017ee:	83 c4 10             	add    $0x10,%esp
+  8017f1:	85 c0                	test   %eax,%eax
+  8017f3:	78 53                	js     801848 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f8:	83 ec 08             	sub    $0x8,%esp
+  8017fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fe:	50                   	push   %eax
+  8017ff:	ff 36                	push   (%esi)
+  801801:	e8 ee fa ff ff       	call   8012f4 <dev_lookup>
+  801806:	83 c4 10             	add    $0x10,%esp
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	78 3b                	js     801848 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80180d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801810:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801814:	74 39                	je     80184f <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801816:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801819:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801820:	00 00 00 
+	stat->st_isdir = 0;
+  801823:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80182a:	00 00 00 
+	stat->st_version = 0;
+  80182d:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801834:	00 00 00 
+	stat->st_dev = dev;
+  801837:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80183d:	83 ec 08             	sub    $0x8,%esp
+  801840:	53                   	push   %ebx
+  801841:	56                   	push   %esi
+  801842:	ff 50 14             	call   *0x14(%eax)
+  801845:	83 c4 10             	add    $0x10,%esp
+}
+  801848:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184b:	5b                   	pop    %ebx
+  80184c:	5e                   	pop    %esi
+  80184d:	5d                   	pop    %ebp
+  80184e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80184f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801854:	eb f2                	jmp    801848 <fstat+0x71>
+
+00801856 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801856:	55                   	push   %ebp
+  801857:	89 e5                	mov    %esp,%ebp
+  801859:	56                   	push   %esi
+  80185a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80185b:	83 ec 08             	sub    $0x8,%esp
+  80185e:	6a 00                	push   $0x0
+  801860:	ff 75 08             	push   0x8(%ebp)
+  801863:	e8 b7 01 00 00       	call   801a1f <open>
+  801868:	89 c3                	mov    %eax,%ebx
+  80186a:	83 c4 10             	add    $0x10,%esp
+  80186d:	85 c0                	test   %eax,%eax
+  80186f:	78 1b                	js     80188c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801871:	83 ec 08             	sub    $0x8,%esp
+  801874:	ff 75 0c             	push   0xc(%ebp)
+  801877:	50                   	push   %eax
+  801878:	e8 5a ff ff ff       	call   8017d7 <fstat>
+  80187d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80187f:	89 1c 24             	mov    %ebx,(%esp)
+  801882:	e8 60 fb ff ff       	call   8013e7 <close>
+	return r;
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	89 f3                	mov    %esi,%ebx
+}
+  80188c:	89 d8                	mov    %ebx,%eax
+  80188e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801891:	5b                   	pop    %ebx
+  801892:	5e                   	pop    %esi
+  801893:	5d                   	pop    %ebp
+  801894:	c3                   	ret
+
+00801895 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+  80189a:	89 c6                	mov    %eax,%esi
+  80189c:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80189e:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8018a5:	74 27                	je     8018ce <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018a7:	6a 07                	push   $0x7
+  8018a9:	68 00 70 80 00       	push   $0x807000
+  8018ae:	56                   	push   %esi
+  8018af:	ff 35 00 60 80 00    	push   0x806000
+  8018b5:	e8 d9 1f 00 00       	call   803893 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018ba:	83 c4 0c             	add    $0xc,%esp
+  8018bd:	6a 00                	push   $0x0
+  8018bf:	53                   	push   %ebx
+  8018c0:	6a 00                	push   $0x0
+  8018c2:	e8 3c 1d 00 00       	call   803603 <ipc_recv>
+}
+  8018c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ca:	5b                   	pop    %ebx
+  8018cb:	5e                   	pop    %esi
+  8018cc:	5d                   	pop    %ebp
+  8018cd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ce:	83 ec 0c             	sub    $0xc,%esp
+  8018d1:	6a 02                	push   $0x2
+  8018d3:	e8 24 20 00 00       	call   8038fc <ipc_find_env>
+  8018d8:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018dd:	83 c4 10             	add    $0x10,%esp
+  8018e0:	eb c5                	jmp    8018a7 <fsipc+0x12>
+
+008018e2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018e2:	55                   	push   %ebp
+  8018e3:	89 e5                	mov    %esp,%ebp
+  8018e5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018eb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ee:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8018f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f6:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801900:	b8 02 00 00 00       	mov    $0x2,%eax
+  801905:	e8 8b ff ff ff       	call   801895 <fsipc>
+}
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+0080190c <devfile_flush>:
+{
+  80190c:	55                   	push   %ebp
+  80190d:	89 e5                	mov    %esp,%ebp
+  80190f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801912:	8b 45 08             	mov    0x8(%ebp),%eax
+  801915:	8b 40 0c             	mov    0xc(%eax),%eax
+  801918:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80191d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801922:	b8 06 00 00 00       	mov    $0x6,%eax
+  801927:	e8 69 ff ff ff       	call   801895 <fsipc>
+}
+  80192c:	c9                   	leave
+  80192d:	c3                   	ret
+
+0080192e <devfile_stat>:
+{
+  80192e:	55                   	push   %ebp
+  80192f:	89 e5                	mov    %esp,%ebp
+  801931:	53                   	push   %ebx
+  801932:	83 ec 04             	sub    $0x4,%esp
+  801935:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801938:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80193e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801943:	ba 00 00 00 00       	mov    $0x0,%edx
+  801948:	b8 05 00 00 00       	mov    $0x5,%eax
+  80194d:	e8 43 ff ff ff       	call   801895 <fsipc>
+  801952:	85 c0                	test   %eax,%eax
+  801954:	78 37                	js     80198d <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	68 00 70 80 00       	push   $0x807000
+  80195e:	53                   	push   %ebx
+  80195f:	e8 cc ef ff ff       	call   800930 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801964:	a1 80 70 80 00       	mov    0x807080,%eax
+  801969:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80196f:	a1 84 70 80 00       	mov    0x807084,%eax
+  801974:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80197a:	a1 88 70 80 00       	mov    0x807088,%eax
+  80197f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801985:	83 c4 10             	add    $0x10,%esp
+  801988:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80198d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801990:	c9                   	leave
+  801991:	c3                   	ret
+
+00801992 <devfile_write>:
+{
+  801992:	55                   	push   %ebp
+  801993:	89 e5                	mov    %esp,%ebp
+  801995:	83 ec 0c             	sub    $0xc,%esp
+  801998:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80199b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019a0:	39 d0                	cmp    %edx,%eax
+  8019a2:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a8:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019ab:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8019b1:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8019b6:	50                   	push   %eax
+  8019b7:	ff 75 0c             	push   0xc(%ebp)
+  8019ba:	68 08 70 80 00       	push   $0x807008
+  8019bf:	e8 1c f1 ff ff       	call   800ae0 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8019c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019ce:	e8 c2 fe ff ff       	call   801895 <fsipc>
+}
+  8019d3:	c9                   	leave
+  8019d4:	c3                   	ret
+
+008019d5 <devfile_read>:
+{
+  8019d5:	55                   	push   %ebp
+  8019d6:	89 e5                	mov    %esp,%ebp
+  8019d8:	53                   	push   %ebx
+  8019d9:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8019e7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8019ea:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8019ef:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8019f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019f9:	e8 97 fe ff ff       	call   801895 <fsipc>
+  8019fe:	89 c3                	mov    %eax,%ebx
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	78 14                	js     801a18 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801a04:	83 ec 04             	sub    $0x4,%esp
+  801a07:	50                   	push   %eax
+  801a08:	68 00 70 80 00       	push   $0x807000
+  801a0d:	ff 75 0c             	push   0xc(%ebp)
+  801a10:	e8 cb f0 ff ff       	call   800ae0 <memmove>
+	return r;
+  801a15:	83 c4 10             	add    $0x10,%esp
+}
+  801a18:	89 d8                	mov    %ebx,%eax
+  801a1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a1d:	c9                   	leave
+  801a1e:	c3                   	ret
+
+00801a1f <open>:
+{
+  801a1f:	55                   	push   %ebp
+  801a20:	89 e5                	mov    %esp,%ebp
+  801a22:	53                   	push   %ebx
+  801a23:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801a26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a29:	50                   	push   %eax
+  801a2a:	e8 23 f8 ff ff       	call   801252 <fd_alloc>
+  801a2f:	89 c3                	mov    %eax,%ebx
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	78 2a                	js     801a62 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801a38:	83 ec 0c             	sub    $0xc,%esp
+  801a3b:	ff 75 08             	push   0x8(%ebp)
+  801a3e:	e8 a1 ee ff ff       	call   8008e4 <strlen>
+  801a43:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801a46:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801a4b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a50:	7e 17                	jle    801a69 <open+0x4a>
+	fd_close(fd, 1);
+  801a52:	83 ec 08             	sub    $0x8,%esp
+  801a55:	6a 01                	push   $0x1
+  801a57:	ff 75 f4             	push   -0xc(%ebp)
+  801a5a:	e8 08 f9 ff ff       	call   801367 <fd_close>
+	return r;
+  801a5f:	83 c4 10             	add    $0x10,%esp
+}
+  801a62:	89 d8                	mov    %ebx,%eax
+  801a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a67:	c9                   	leave
+  801a68:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a69:	83 ec 08             	sub    $0x8,%esp
+  801a6c:	ff 75 08             	push   0x8(%ebp)
+  801a6f:	68 00 70 80 00       	push   $0x807000
+  801a74:	e8 b7 ee ff ff       	call   800930 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a7c:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a84:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a89:	e8 07 fe ff ff       	call   801895 <fsipc>
+  801a8e:	89 c3                	mov    %eax,%ebx
+  801a90:	83 c4 10             	add    $0x10,%esp
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	78 bb                	js     801a52 <open+0x33>
+	return fd2num(fd); 	
+  801a97:	83 ec 0c             	sub    $0xc,%esp
+  801a9a:	ff 75 f4             	push   -0xc(%ebp)
+  801a9d:	e8 89 f7 ff ff       	call   80122b <fd2num>
+  801aa2:	89 c3                	mov    %eax,%ebx
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	eb b9                	jmp    801a62 <open+0x43>
+
+00801aa9 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801aa9:	55                   	push   %ebp
+  801aaa:	89 e5                	mov    %esp,%ebp
+  801aac:	53                   	push   %ebx
+  801aad:	83 ec 1c             	sub    $0x1c,%esp
+  801ab0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ab3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab6:	50                   	push   %eax
+  801ab7:	ff 75 08             	push   0x8(%ebp)
+  801aba:	e8 e3 f7 ff ff       	call   8012a2 <fd_lookup>
+  801abf:	83 c4 10             	add    $0x10,%esp
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	78 5a                	js     801b20 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ac6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac9:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801acf:	39 10                	cmp    %edx,(%eax)
+  801ad1:	75 66                	jne    801b39 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801ad3:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801ada:	74 49                	je     801b25 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801adc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801adf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801ae7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aea:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801aef:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801af5:	6a 07                	push   $0x7
+  801af7:	68 00 70 80 00       	push   $0x807000
+  801afc:	6a 09                	push   $0x9
+  801afe:	ff 35 00 60 80 00    	push   0x806000
+  801b04:	e8 8a 1d 00 00       	call   803893 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801b09:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b10:	6a 00                	push   $0x0
+  801b12:	53                   	push   %ebx
+  801b13:	ff 75 10             	push   0x10(%ebp)
+  801b16:	6a 00                	push   $0x0
+  801b18:	e8 b3 1b 00 00       	call   8036d0 <ipc_recv_pages>
+  801b1d:	83 c4 20             	add    $0x20,%esp
+}
+  801b20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b23:	c9                   	leave
+  801b24:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b25:	83 ec 0c             	sub    $0xc,%esp
+  801b28:	6a 02                	push   $0x2
+  801b2a:	e8 cd 1d 00 00       	call   8038fc <ipc_find_env>
+  801b2f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	eb a3                	jmp    801adc <fmap+0x33>
+		return -E_INVAL;
+  801b39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3e:	eb e0                	jmp    801b20 <fmap+0x77>
+
+00801b40 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b40:	55                   	push   %ebp
+  801b41:	89 e5                	mov    %esp,%ebp
+  801b43:	53                   	push   %ebx
+  801b44:	83 ec 10             	sub    $0x10,%esp
+  801b47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b4a:	53                   	push   %ebx
+  801b4b:	e8 94 ed ff ff       	call   8008e4 <strlen>
+  801b50:	83 c4 10             	add    $0x10,%esp
+  801b53:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b58:	7f 25                	jg     801b7f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b5a:	83 ec 08             	sub    $0x8,%esp
+  801b5d:	53                   	push   %ebx
+  801b5e:	68 00 70 80 00       	push   $0x807000
+  801b63:	e8 c8 ed ff ff       	call   800930 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b72:	e8 1e fd ff ff       	call   801895 <fsipc>
+  801b77:	83 c4 10             	add    $0x10,%esp
+}
+  801b7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b7d:	c9                   	leave
+  801b7e:	c3                   	ret
+		return -E_BAD_PATH;
+  801b7f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b84:	eb f4                	jmp    801b7a <remove+0x3a>
+
+00801b86 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b91:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b96:	e8 fa fc ff ff       	call   801895 <fsipc>
+}
+  801b9b:	c9                   	leave
+  801b9c:	c3                   	ret
+
+00801b9d <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b9d:	55                   	push   %ebp
+  801b9e:	89 e5                	mov    %esp,%ebp
+  801ba0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ba3:	68 e8 3f 80 00       	push   $0x803fe8
+  801ba8:	ff 75 0c             	push   0xc(%ebp)
+  801bab:	e8 80 ed ff ff       	call   800930 <strcpy>
+	return 0;
+}
+  801bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+00801bb7 <devsock_close>:
+{
+  801bb7:	55                   	push   %ebp
+  801bb8:	89 e5                	mov    %esp,%ebp
+  801bba:	53                   	push   %ebx
+  801bbb:	83 ec 10             	sub    $0x10,%esp
+  801bbe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801bc1:	53                   	push   %ebx
+  801bc2:	e8 74 1d 00 00       	call   80393b <pageref>
+  801bc7:	89 c2                	mov    %eax,%edx
+  801bc9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801bd1:	83 fa 01             	cmp    $0x1,%edx
+  801bd4:	74 05                	je     801bdb <devsock_close+0x24>
+}
+  801bd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd9:	c9                   	leave
+  801bda:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801bdb:	83 ec 0c             	sub    $0xc,%esp
+  801bde:	ff 73 0c             	push   0xc(%ebx)
+  801be1:	e8 b0 05 00 00       	call   802196 <nsipc_close>
+  801be6:	83 c4 10             	add    $0x10,%esp
+  801be9:	eb eb                	jmp    801bd6 <devsock_close+0x1f>
+
+00801beb <devsock_write>:
+{
+  801beb:	55                   	push   %ebp
+  801bec:	89 e5                	mov    %esp,%ebp
+  801bee:	53                   	push   %ebx
+  801bef:	83 ec 14             	sub    $0x14,%esp
+  801bf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bf5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bf8:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801bfb:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801bfe:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c01:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c04:	c1 f8 09             	sar    $0x9,%eax
+  801c07:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c0a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c10:	77 13                	ja     801c25 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801c12:	50                   	push   %eax
+  801c13:	52                   	push   %edx
+  801c14:	53                   	push   %ebx
+  801c15:	ff 71 0c             	push   0xc(%ecx)
+  801c18:	e8 5c 06 00 00       	call   802279 <nsipc_send>
+  801c1d:	83 c4 10             	add    $0x10,%esp
+}
+  801c20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c23:	c9                   	leave
+  801c24:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c25:	50                   	push   %eax
+  801c26:	6a 01                	push   $0x1
+  801c28:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c2b:	50                   	push   %eax
+  801c2c:	ff 71 0c             	push   0xc(%ecx)
+  801c2f:	e8 a6 06 00 00       	call   8022da <nsipc_sendmsg>
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	eb e7                	jmp    801c20 <devsock_write+0x35>
+
+00801c39 <devsock_read>:
+{
+  801c39:	55                   	push   %ebp
+  801c3a:	89 e5                	mov    %esp,%ebp
+  801c3c:	53                   	push   %ebx
+  801c3d:	83 ec 14             	sub    $0x14,%esp
+  801c40:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c43:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c46:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801c49:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801c4c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c4f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c52:	c1 f8 09             	sar    $0x9,%eax
+  801c55:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c58:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c5e:	77 13                	ja     801c73 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801c60:	50                   	push   %eax
+  801c61:	52                   	push   %edx
+  801c62:	53                   	push   %ebx
+  801c63:	ff 71 0c             	push   0xc(%ecx)
+  801c66:	e8 9c 05 00 00       	call   802207 <nsipc_recv>
+  801c6b:	83 c4 10             	add    $0x10,%esp
+}
+  801c6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c73:	50                   	push   %eax
+  801c74:	6a 01                	push   $0x1
+  801c76:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c79:	50                   	push   %eax
+  801c7a:	ff 71 0c             	push   0xc(%ecx)
+  801c7d:	e8 02 0a 00 00       	call   802684 <nsipc_recvmsg>
+  801c82:	83 c4 10             	add    $0x10,%esp
+  801c85:	eb e7                	jmp    801c6e <devsock_read+0x35>
+
+00801c87 <fd2sockid>:
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c8d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c90:	52                   	push   %edx
+  801c91:	50                   	push   %eax
+  801c92:	e8 0b f6 ff ff       	call   8012a2 <fd_lookup>
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	78 10                	js     801cae <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca1:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801ca7:	39 08                	cmp    %ecx,(%eax)
+  801ca9:	75 05                	jne    801cb0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cab:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cae:	c9                   	leave
+  801caf:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cb0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cb5:	eb f7                	jmp    801cae <fd2sockid+0x27>
+
+00801cb7 <sock_flags>:
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+  801cba:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801cbd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cc0:	52                   	push   %edx
+  801cc1:	50                   	push   %eax
+  801cc2:	e8 db f5 ff ff       	call   8012a2 <fd_lookup>
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	78 0e                	js     801cdc <sock_flags+0x25>
+  801cce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd1:	8b 40 08             	mov    0x8(%eax),%eax
+  801cd4:	c1 e8 09             	shr    $0x9,%eax
+  801cd7:	83 e0 08             	and    $0x8,%eax
+}
+  801cda:	c9                   	leave
+  801cdb:	c3                   	ret
+		return 0;
+  801cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce1:	eb f7                	jmp    801cda <sock_flags+0x23>
+
+00801ce3 <alloc_sockfd>:
+{
+  801ce3:	55                   	push   %ebp
+  801ce4:	89 e5                	mov    %esp,%ebp
+  801ce6:	56                   	push   %esi
+  801ce7:	53                   	push   %ebx
+  801ce8:	83 ec 1c             	sub    $0x1c,%esp
+  801ceb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ced:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cf0:	50                   	push   %eax
+  801cf1:	e8 5c f5 ff ff       	call   801252 <fd_alloc>
+  801cf6:	89 c3                	mov    %eax,%ebx
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	78 43                	js     801d42 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cff:	83 ec 04             	sub    $0x4,%esp
+  801d02:	68 07 04 00 00       	push   $0x407
+  801d07:	ff 75 f4             	push   -0xc(%ebp)
+  801d0a:	6a 00                	push   $0x0
+  801d0c:	e8 53 f0 ff ff       	call   800d64 <sys_page_alloc>
+  801d11:	89 c3                	mov    %eax,%ebx
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	85 c0                	test   %eax,%eax
+  801d18:	78 28                	js     801d42 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1d:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801d23:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d28:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d2f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d32:	83 ec 0c             	sub    $0xc,%esp
+  801d35:	50                   	push   %eax
+  801d36:	e8 f0 f4 ff ff       	call   80122b <fd2num>
+  801d3b:	89 c3                	mov    %eax,%ebx
+  801d3d:	83 c4 10             	add    $0x10,%esp
+  801d40:	eb 0c                	jmp    801d4e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d42:	83 ec 0c             	sub    $0xc,%esp
+  801d45:	56                   	push   %esi
+  801d46:	e8 4b 04 00 00       	call   802196 <nsipc_close>
+		return r;
+  801d4b:	83 c4 10             	add    $0x10,%esp
+}
+  801d4e:	89 d8                	mov    %ebx,%eax
+  801d50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d53:	5b                   	pop    %ebx
+  801d54:	5e                   	pop    %esi
+  801d55:	5d                   	pop    %ebp
+  801d56:	c3                   	ret
+
+00801d57 <accept>:
+{
+  801d57:	55                   	push   %ebp
+  801d58:	89 e5                	mov    %esp,%ebp
+  801d5a:	56                   	push   %esi
+  801d5b:	53                   	push   %ebx
+  801d5c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d5f:	89 f0                	mov    %esi,%eax
+  801d61:	e8 21 ff ff ff       	call   801c87 <fd2sockid>
+  801d66:	89 c3                	mov    %eax,%ebx
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 24                	js     801d90 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801d6c:	89 f0                	mov    %esi,%eax
+  801d6e:	e8 44 ff ff ff       	call   801cb7 <sock_flags>
+  801d73:	50                   	push   %eax
+  801d74:	ff 75 10             	push   0x10(%ebp)
+  801d77:	ff 75 0c             	push   0xc(%ebp)
+  801d7a:	53                   	push   %ebx
+  801d7b:	e8 6b 03 00 00       	call   8020eb <nsipc_accept>
+  801d80:	89 c3                	mov    %eax,%ebx
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	78 07                	js     801d90 <accept+0x39>
+	return alloc_sockfd(r);
+  801d89:	e8 55 ff ff ff       	call   801ce3 <alloc_sockfd>
+  801d8e:	89 c3                	mov    %eax,%ebx
+}
+  801d90:	89 d8                	mov    %ebx,%eax
+  801d92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d95:	5b                   	pop    %ebx
+  801d96:	5e                   	pop    %esi
+  801d97:	5d                   	pop    %ebp
+  801d98:	c3                   	ret
+
+00801d99 <bind>:
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da2:	e8 e0 fe ff ff       	call   801c87 <fd2sockid>
+  801da7:	85 c0                	test   %eax,%eax
+  801da9:	78 12                	js     801dbd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dab:	83 ec 04             	sub    $0x4,%esp
+  801dae:	ff 75 10             	push   0x10(%ebp)
+  801db1:	ff 75 0c             	push   0xc(%ebp)
+  801db4:	50                   	push   %eax
+  801db5:	e8 85 03 00 00       	call   80213f <nsipc_bind>
+  801dba:	83 c4 10             	add    $0x10,%esp
+}
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+
+00801dbf <shutdown>:
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc8:	e8 ba fe ff ff       	call   801c87 <fd2sockid>
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 0f                	js     801de0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dd1:	83 ec 08             	sub    $0x8,%esp
+  801dd4:	ff 75 0c             	push   0xc(%ebp)
+  801dd7:	50                   	push   %eax
+  801dd8:	e8 97 03 00 00       	call   802174 <nsipc_shutdown>
+  801ddd:	83 c4 10             	add    $0x10,%esp
+}
+  801de0:	c9                   	leave
+  801de1:	c3                   	ret
+
+00801de2 <connect>:
+{
+  801de2:	55                   	push   %ebp
+  801de3:	89 e5                	mov    %esp,%ebp
+  801de5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801deb:	e8 97 fe ff ff       	call   801c87 <fd2sockid>
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	78 12                	js     801e06 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801df4:	83 ec 04             	sub    $0x4,%esp
+  801df7:	ff 75 10             	push   0x10(%ebp)
+  801dfa:	ff 75 0c             	push   0xc(%ebp)
+  801dfd:	50                   	push   %eax
+  801dfe:	e8 ad 03 00 00       	call   8021b0 <nsipc_connect>
+  801e03:	83 c4 10             	add    $0x10,%esp
+}
+  801e06:	c9                   	leave
+  801e07:	c3                   	ret
+
+00801e08 <listen>:
+{
+  801e08:	55                   	push   %ebp
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e11:	e8 71 fe ff ff       	call   801c87 <fd2sockid>
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	78 0f                	js     801e29 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e1a:	83 ec 08             	sub    $0x8,%esp
+  801e1d:	ff 75 0c             	push   0xc(%ebp)
+  801e20:	50                   	push   %eax
+  801e21:	e8 bf 03 00 00       	call   8021e5 <nsipc_listen>
+  801e26:	83 c4 10             	add    $0x10,%esp
+}
+  801e29:	c9                   	leave
+  801e2a:	c3                   	ret
+
+00801e2b <sendmsg>:
+{
+  801e2b:	55                   	push   %ebp
+  801e2c:	89 e5                	mov    %esp,%ebp
+  801e2e:	57                   	push   %edi
+  801e2f:	56                   	push   %esi
+  801e30:	53                   	push   %ebx
+  801e31:	83 ec 0c             	sub    $0xc,%esp
+  801e34:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e37:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801e3a:	89 f0                	mov    %esi,%eax
+  801e3c:	e8 46 fe ff ff       	call   801c87 <fd2sockid>
+  801e41:	89 c3                	mov    %eax,%ebx
+  801e43:	85 c0                	test   %eax,%eax
+  801e45:	78 1c                	js     801e63 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801e47:	89 f0                	mov    %esi,%eax
+  801e49:	e8 69 fe ff ff       	call   801cb7 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e4e:	0b 45 10             	or     0x10(%ebp),%eax
+  801e51:	50                   	push   %eax
+  801e52:	ff 77 0c             	push   0xc(%edi)
+  801e55:	ff 77 08             	push   0x8(%edi)
+  801e58:	53                   	push   %ebx
+  801e59:	e8 7c 04 00 00       	call   8022da <nsipc_sendmsg>
+  801e5e:	89 c3                	mov    %eax,%ebx
+  801e60:	83 c4 10             	add    $0x10,%esp
+}
+  801e63:	89 d8                	mov    %ebx,%eax
+  801e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e68:	5b                   	pop    %ebx
+  801e69:	5e                   	pop    %esi
+  801e6a:	5f                   	pop    %edi
+  801e6b:	5d                   	pop    %ebp
+  801e6c:	c3                   	ret
+
+00801e6d <recvmsg>:
+{
+  801e6d:	55                   	push   %ebp
+  801e6e:	89 e5                	mov    %esp,%ebp
+  801e70:	57                   	push   %edi
+  801e71:	56                   	push   %esi
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 0c             	sub    $0xc,%esp
+  801e76:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e79:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e7c:	89 f8                	mov    %edi,%eax
+  801e7e:	e8 04 fe ff ff       	call   801c87 <fd2sockid>
+  801e83:	89 c3                	mov    %eax,%ebx
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	78 2a                	js     801eb3 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801e89:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801e90:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801e97:	89 f8                	mov    %edi,%eax
+  801e99:	e8 19 fe ff ff       	call   801cb7 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e9e:	0b 45 10             	or     0x10(%ebp),%eax
+  801ea1:	50                   	push   %eax
+  801ea2:	ff 76 0c             	push   0xc(%esi)
+  801ea5:	ff 76 08             	push   0x8(%esi)
+  801ea8:	53                   	push   %ebx
+  801ea9:	e8 d6 07 00 00       	call   802684 <nsipc_recvmsg>
+  801eae:	89 c3                	mov    %eax,%ebx
+  801eb0:	83 c4 10             	add    $0x10,%esp
+}
+  801eb3:	89 d8                	mov    %ebx,%eax
+  801eb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb8:	5b                   	pop    %ebx
+  801eb9:	5e                   	pop    %esi
+  801eba:	5f                   	pop    %edi
+  801ebb:	5d                   	pop    %ebp
+  801ebc:	c3                   	ret
+
+00801ebd <sendfile>:
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	56                   	push   %esi
+  801ec1:	53                   	push   %ebx
+  801ec2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801ec5:	89 f0                	mov    %esi,%eax
+  801ec7:	e8 bb fd ff ff       	call   801c87 <fd2sockid>
+  801ecc:	89 c3                	mov    %eax,%ebx
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 1f                	js     801ef1 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801ed2:	89 f0                	mov    %esi,%eax
+  801ed4:	e8 de fd ff ff       	call   801cb7 <sock_flags>
+  801ed9:	83 ec 0c             	sub    $0xc,%esp
+  801edc:	50                   	push   %eax
+  801edd:	ff 75 14             	push   0x14(%ebp)
+  801ee0:	ff 75 10             	push   0x10(%ebp)
+  801ee3:	ff 75 0c             	push   0xc(%ebp)
+  801ee6:	53                   	push   %ebx
+  801ee7:	e8 64 06 00 00       	call   802550 <nsipc_sendfile>
+  801eec:	89 c3                	mov    %eax,%ebx
+  801eee:	83 c4 20             	add    $0x20,%esp
+}
+  801ef1:	89 d8                	mov    %ebx,%eax
+  801ef3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef6:	5b                   	pop    %ebx
+  801ef7:	5e                   	pop    %esi
+  801ef8:	5d                   	pop    %ebp
+  801ef9:	c3                   	ret
+
+00801efa <evctl>:
+{
+  801efa:	55                   	push   %ebp
+  801efb:	89 e5                	mov    %esp,%ebp
+  801efd:	53                   	push   %ebx
+  801efe:	83 ec 04             	sub    $0x4,%esp
+  801f01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801f04:	89 d8                	mov    %ebx,%eax
+  801f06:	e8 7c fd ff ff       	call   801c87 <fd2sockid>
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	78 10                	js     801f1f <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801f0f:	83 ec 04             	sub    $0x4,%esp
+  801f12:	53                   	push   %ebx
+  801f13:	ff 75 0c             	push   0xc(%ebp)
+  801f16:	50                   	push   %eax
+  801f17:	e8 d2 0b 00 00       	call   802aee <nsipc_evctl>
+  801f1c:	83 c4 10             	add    $0x10,%esp
+}
+  801f1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f22:	c9                   	leave
+  801f23:	c3                   	ret
+
+00801f24 <evwait>:
+{
+  801f24:	55                   	push   %ebp
+  801f25:	89 e5                	mov    %esp,%ebp
+  801f27:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801f2a:	ff 75 10             	push   0x10(%ebp)
+  801f2d:	ff 75 0c             	push   0xc(%ebp)
+  801f30:	ff 75 08             	push   0x8(%ebp)
+  801f33:	e8 e0 0b 00 00       	call   802b18 <nsipc_evwait>
+}
+  801f38:	c9                   	leave
+  801f39:	c3                   	ret
+
+00801f3a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801f3a:	55                   	push   %ebp
+  801f3b:	89 e5                	mov    %esp,%ebp
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f40:	ff 75 10             	push   0x10(%ebp)
+  801f43:	ff 75 0c             	push   0xc(%ebp)
+  801f46:	ff 75 08             	push   0x8(%ebp)
+  801f49:	e8 31 0c 00 00       	call   802b7f <nsipc_socket>
+  801f4e:	83 c4 10             	add    $0x10,%esp
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	78 05                	js     801f5a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f55:	e8 89 fd ff ff       	call   801ce3 <alloc_sockfd>
+}
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+
+00801f5c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	53                   	push   %ebx
+  801f60:	83 ec 04             	sub    $0x4,%esp
+  801f63:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801f65:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801f6c:	74 26                	je     801f94 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f6e:	6a 07                	push   $0x7
+  801f70:	68 00 80 80 00       	push   $0x808000
+  801f75:	53                   	push   %ebx
+  801f76:	ff 35 24 63 80 00    	push   0x806324
+  801f7c:	e8 12 19 00 00       	call   803893 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f81:	83 c4 0c             	add    $0xc,%esp
+  801f84:	6a 00                	push   $0x0
+  801f86:	6a 00                	push   $0x0
+  801f88:	6a 00                	push   $0x0
+  801f8a:	e8 74 16 00 00       	call   803603 <ipc_recv>
+}
+  801f8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+  801f97:	6a 03                	push   $0x3
+  801f99:	e8 5e 19 00 00       	call   8038fc <ipc_find_env>
+  801f9e:	a3 24 63 80 00       	mov    %eax,0x806324
+  801fa3:	83 c4 10             	add    $0x10,%esp
+  801fa6:	eb c6                	jmp    801f6e <nsipc+0x12>
+
+00801fa8 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801fa8:	55                   	push   %ebp
+  801fa9:	89 e5                	mov    %esp,%ebp
+  801fab:	56                   	push   %esi
+  801fac:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801fad:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  801fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801fb8:	85 f6                	test   %esi,%esi
+  801fba:	75 33                	jne    801fef <nsbulk_map+0x47>
+  801fbc:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801fc1:	83 ec 04             	sub    $0x4,%esp
+  801fc4:	6a 07                	push   $0x7
+  801fc6:	53                   	push   %ebx
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	e8 96 ed ff ff       	call   800d64 <sys_page_alloc>
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 1a                	js     801fef <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801fd5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fdb:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801fe1:	75 de                	jne    801fc1 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801fe3:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  801fea:	00 00 00 
+	return 0;
+  801fed:	89 f0                	mov    %esi,%eax
+}
+  801fef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff2:	5b                   	pop    %ebx
+  801ff3:	5e                   	pop    %esi
+  801ff4:	5d                   	pop    %ebp
+  801ff5:	c3                   	ret
+
+00801ff6 <nsbulk_own>:
+{
+  801ff6:	55                   	push   %ebp
+  801ff7:	89 e5                	mov    %esp,%ebp
+  801ff9:	57                   	push   %edi
+  801ffa:	56                   	push   %esi
+  801ffb:	53                   	push   %ebx
+  801ffc:	83 ec 0c             	sub    $0xc,%esp
+  801fff:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802001:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802004:	85 d2                	test   %edx,%edx
+  802006:	7f 0e                	jg     802016 <nsbulk_own+0x20>
+	return 0;
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200d:	eb 47                	jmp    802056 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80200f:	83 c3 01             	add    $0x1,%ebx
+  802012:	39 fb                	cmp    %edi,%ebx
+  802014:	7d 3b                	jge    802051 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802016:	be 01 00 00 00       	mov    $0x1,%esi
+  80201b:	89 d9                	mov    %ebx,%ecx
+  80201d:	d3 e6                	shl    %cl,%esi
+  80201f:	89 f0                	mov    %esi,%eax
+  802021:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  802027:	74 e6                	je     80200f <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802029:	83 ec 04             	sub    $0x4,%esp
+  80202c:	6a 07                	push   $0x7
+  80202e:	89 d8                	mov    %ebx,%eax
+  802030:	c1 e0 0c             	shl    $0xc,%eax
+  802033:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802038:	50                   	push   %eax
+  802039:	6a 00                	push   $0x0
+  80203b:	e8 24 ed ff ff       	call   800d64 <sys_page_alloc>
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 0f                	js     802056 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802047:	f7 d6                	not    %esi
+  802049:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  80204f:	eb be                	jmp    80200f <nsbulk_own+0x19>
+	return 0;
+  802051:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802056:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802059:	5b                   	pop    %ebx
+  80205a:	5e                   	pop    %esi
+  80205b:	5f                   	pop    %edi
+  80205c:	5d                   	pop    %ebp
+  80205d:	c3                   	ret
+
+0080205e <nsipc_bulk>:
+{
+  80205e:	55                   	push   %ebp
+  80205f:	89 e5                	mov    %esp,%ebp
+  802061:	57                   	push   %edi
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	83 ec 1c             	sub    $0x1c,%esp
+  802067:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80206a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80206c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802072:	c1 fb 0c             	sar    $0xc,%ebx
+  802075:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802078:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80207f:	74 56                	je     8020d7 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802081:	85 ff                	test   %edi,%edi
+  802083:	7e 24                	jle    8020a9 <nsipc_bulk+0x4b>
+  802085:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80208b:	74 1c                	je     8020a9 <nsipc_bulk+0x4b>
+  80208d:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802093:	c1 e3 0c             	shl    $0xc,%ebx
+  802096:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80209b:	0f b6 10             	movzbl (%eax),%edx
+  80209e:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8020a0:	05 00 10 00 00       	add    $0x1000,%eax
+  8020a5:	39 d8                	cmp    %ebx,%eax
+  8020a7:	75 f2                	jne    80209b <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8020a9:	83 ec 0c             	sub    $0xc,%esp
+  8020ac:	56                   	push   %esi
+  8020ad:	57                   	push   %edi
+  8020ae:	68 00 00 00 e0       	push   $0xe0000000
+  8020b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8020b6:	ff 35 24 63 80 00    	push   0x806324
+  8020bc:	e8 06 18 00 00       	call   8038c7 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8020c1:	83 c4 1c             	add    $0x1c,%esp
+  8020c4:	6a 00                	push   $0x0
+  8020c6:	6a 00                	push   $0x0
+  8020c8:	6a 00                	push   $0x0
+  8020ca:	e8 34 15 00 00       	call   803603 <ipc_recv>
+}
+  8020cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d2:	5b                   	pop    %ebx
+  8020d3:	5e                   	pop    %esi
+  8020d4:	5f                   	pop    %edi
+  8020d5:	5d                   	pop    %ebp
+  8020d6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8020d7:	83 ec 0c             	sub    $0xc,%esp
+  8020da:	6a 03                	push   $0x3
+  8020dc:	e8 1b 18 00 00       	call   8038fc <ipc_find_env>
+  8020e1:	a3 24 63 80 00       	mov    %eax,0x806324
+  8020e6:	83 c4 10             	add    $0x10,%esp
+  8020e9:	eb 96                	jmp    802081 <nsipc_bulk+0x23>
+
+008020eb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8020eb:	55                   	push   %ebp
+  8020ec:	89 e5                	mov    %esp,%ebp
+  8020ee:	53                   	push   %ebx
+  8020ef:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8020f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8020fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020fd:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802102:	b8 01 00 00 00       	mov    $0x1,%eax
+  802107:	e8 50 fe ff ff       	call   801f5c <nsipc>
+  80210c:	89 c3                	mov    %eax,%ebx
+  80210e:	85 c0                	test   %eax,%eax
+  802110:	79 07                	jns    802119 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802112:	89 d8                	mov    %ebx,%eax
+  802114:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802119:	83 ec 04             	sub    $0x4,%esp
+  80211c:	ff 35 10 80 80 00    	push   0x808010
+  802122:	68 00 80 80 00       	push   $0x808000
+  802127:	ff 75 0c             	push   0xc(%ebp)
+  80212a:	e8 b1 e9 ff ff       	call   800ae0 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80212f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802135:	8b 45 10             	mov    0x10(%ebp),%eax
+  802138:	89 10                	mov    %edx,(%eax)
+  80213a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80213d:	eb d3                	jmp    802112 <nsipc_accept+0x27>
+
+0080213f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80213f:	55                   	push   %ebp
+  802140:	89 e5                	mov    %esp,%ebp
+  802142:	53                   	push   %ebx
+  802143:	83 ec 08             	sub    $0x8,%esp
+  802146:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802149:	8b 45 08             	mov    0x8(%ebp),%eax
+  80214c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802151:	53                   	push   %ebx
+  802152:	ff 75 0c             	push   0xc(%ebp)
+  802155:	68 04 80 80 00       	push   $0x808004
+  80215a:	e8 81 e9 ff ff       	call   800ae0 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80215f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802165:	b8 02 00 00 00       	mov    $0x2,%eax
+  80216a:	e8 ed fd ff ff       	call   801f5c <nsipc>
+}
+  80216f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802172:	c9                   	leave
+  802173:	c3                   	ret
+
+00802174 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802174:	55                   	push   %ebp
+  802175:	89 e5                	mov    %esp,%ebp
+  802177:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80217a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802182:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802185:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80218a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80218f:	e8 c8 fd ff ff       	call   801f5c <nsipc>
+}
+  802194:	c9                   	leave
+  802195:	c3                   	ret
+
+00802196 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802196:	55                   	push   %ebp
+  802197:	89 e5                	mov    %esp,%ebp
+  802199:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80219c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219f:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8021a4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021a9:	e8 ae fd ff ff       	call   801f5c <nsipc>
+}
+  8021ae:	c9                   	leave
+  8021af:	c3                   	ret
+
+008021b0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	53                   	push   %ebx
+  8021b4:	83 ec 08             	sub    $0x8,%esp
+  8021b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8021ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bd:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8021c2:	53                   	push   %ebx
+  8021c3:	ff 75 0c             	push   0xc(%ebp)
+  8021c6:	68 04 80 80 00       	push   $0x808004
+  8021cb:	e8 10 e9 ff ff       	call   800ae0 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8021d0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8021d6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021db:	e8 7c fd ff ff       	call   801f5c <nsipc>
+}
+  8021e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e3:	c9                   	leave
+  8021e4:	c3                   	ret
+
+008021e5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8021e5:	55                   	push   %ebp
+  8021e6:	89 e5                	mov    %esp,%ebp
+  8021e8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8021eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ee:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8021f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8021fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  802200:	e8 57 fd ff ff       	call   801f5c <nsipc>
+}
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+
+00802207 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	56                   	push   %esi
+  80220b:	53                   	push   %ebx
+  80220c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80220f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802212:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802217:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80221d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802220:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802225:	b8 07 00 00 00       	mov    $0x7,%eax
+  80222a:	e8 2d fd ff ff       	call   801f5c <nsipc>
+  80222f:	89 c3                	mov    %eax,%ebx
+  802231:	85 c0                	test   %eax,%eax
+  802233:	78 22                	js     802257 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802235:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80223a:	39 c6                	cmp    %eax,%esi
+  80223c:	0f 4e c6             	cmovle %esi,%eax
+  80223f:	39 c3                	cmp    %eax,%ebx
+  802241:	7f 1d                	jg     802260 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802243:	83 ec 04             	sub    $0x4,%esp
+  802246:	53                   	push   %ebx
+  802247:	68 00 80 80 00       	push   $0x808000
+  80224c:	ff 75 0c             	push   0xc(%ebp)
+  80224f:	e8 8c e8 ff ff       	call   800ae0 <memmove>
+  802254:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802257:	89 d8                	mov    %ebx,%eax
+  802259:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80225c:	5b                   	pop    %ebx
+  80225d:	5e                   	pop    %esi
+  80225e:	5d                   	pop    %ebp
+  80225f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802260:	68 f4 3f 80 00       	push   $0x803ff4
+  802265:	68 09 40 80 00       	push   $0x804009
+  80226a:	68 b2 00 00 00       	push   $0xb2
+  80226f:	68 1e 40 80 00       	push   $0x80401e
+  802274:	e8 e5 de ff ff       	call   80015e <_panic>
+
+00802279 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	53                   	push   %ebx
+  80227d:	83 ec 04             	sub    $0x4,%esp
+  802280:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802283:	8b 45 08             	mov    0x8(%ebp),%eax
+  802286:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80228b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802291:	7f 2e                	jg     8022c1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802293:	83 ec 04             	sub    $0x4,%esp
+  802296:	53                   	push   %ebx
+  802297:	ff 75 0c             	push   0xc(%ebp)
+  80229a:	68 0c 80 80 00       	push   $0x80800c
+  80229f:	e8 3c e8 ff ff       	call   800ae0 <memmove>
+	nsipcbuf.send.req_size = size;
+  8022a4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8022aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022ad:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8022b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8022b7:	e8 a0 fc ff ff       	call   801f5c <nsipc>
+}
+  8022bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bf:	c9                   	leave
+  8022c0:	c3                   	ret
+	assert(size < 1600);
+  8022c1:	68 2a 40 80 00       	push   $0x80402a
+  8022c6:	68 09 40 80 00       	push   $0x804009
+  8022cb:	68 bd 00 00 00       	push   $0xbd
+  8022d0:	68 1e 40 80 00       	push   $0x80401e
+  8022d5:	e8 84 de ff ff       	call   80015e <_panic>
+
+008022da <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8022da:	55                   	push   %ebp
+  8022db:	89 e5                	mov    %esp,%ebp
+  8022dd:	57                   	push   %edi
+  8022de:	56                   	push   %esi
+  8022df:	53                   	push   %ebx
+  8022e0:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8022e3:	e8 c0 fc ff ff       	call   801fa8 <nsbulk_map>
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	78 55                	js     802341 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8022ec:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8022f3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8022fa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802301:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802304:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802307:	0f 8d 24 02 00 00    	jge    802531 <nsipc_sendmsg+0x257>
+  80230d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802310:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802313:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802316:	89 d8                	mov    %ebx,%eax
+  802318:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80231d:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80231f:	83 ec 0c             	sub    $0xc,%esp
+  802322:	68 20 60 80 00       	push   $0x806020
+  802327:	e8 5a 0f 00 00       	call   803286 <pgbatch_init>
+  80232c:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80232f:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802331:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802334:	e9 82 00 00 00       	jmp    8023bb <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802339:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80233c:	85 db                	test   %ebx,%ebx
+  80233e:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802344:	5b                   	pop    %ebx
+  802345:	5e                   	pop    %esi
+  802346:	5f                   	pop    %edi
+  802347:	5d                   	pop    %ebp
+  802348:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802349:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80234e:	29 c8                	sub    %ecx,%eax
+  802350:	39 d0                	cmp    %edx,%eax
+  802352:	0f 46 d0             	cmovbe %eax,%edx
+  802355:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802357:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80235d:	85 ff                	test   %edi,%edi
+  80235f:	0f 49 c7             	cmovns %edi,%eax
+  802362:	c1 f8 0c             	sar    $0xc,%eax
+  802365:	ba 01 00 00 00       	mov    $0x1,%edx
+  80236a:	e8 87 fc ff ff       	call   801ff6 <nsbulk_own>
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	0f 88 17 01 00 00    	js     80248e <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802377:	83 ec 04             	sub    $0x4,%esp
+  80237a:	56                   	push   %esi
+  80237b:	ff 75 e0             	push   -0x20(%ebp)
+  80237e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802381:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802386:	50                   	push   %eax
+  802387:	e8 54 e7 ff ff       	call   800ae0 <memmove>
+  80238c:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80238f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802392:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802395:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802398:	0f 84 fd 00 00 00    	je     80249b <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80239e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8023a1:	01 f7                	add    %esi,%edi
+  8023a3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023a6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023a9:	0f 8d 01 01 00 00    	jge    8024b0 <nsipc_sendmsg+0x1d6>
+  8023af:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8023b5:	0f 8f f0 00 00 00    	jg     8024ab <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8023bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023be:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8023c1:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8023c4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023c7:	89 c2                	mov    %eax,%edx
+  8023c9:	03 13                	add    (%ebx),%edx
+  8023cb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8023ce:	8b 73 04             	mov    0x4(%ebx),%esi
+  8023d1:	29 c6                	sub    %eax,%esi
+  8023d3:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8023d8:	29 f9                	sub    %edi,%ecx
+  8023da:	39 ce                	cmp    %ecx,%esi
+  8023dc:	89 ca                	mov    %ecx,%edx
+  8023de:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8023e1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8023e4:	89 f9                	mov    %edi,%ecx
+  8023e6:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8023ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023ef:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023f4:	09 c8                	or     %ecx,%eax
+  8023f6:	0f 85 4d ff ff ff    	jne    802349 <nsipc_sendmsg+0x6f>
+  8023fc:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802402:	0f 86 41 ff ff ff    	jbe    802349 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802408:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80240e:	85 ff                	test   %edi,%edi
+  802410:	0f 49 c7             	cmovns %edi,%eax
+  802413:	c1 f8 0c             	sar    $0xc,%eax
+  802416:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802418:	89 d1                	mov    %edx,%ecx
+  80241a:	c1 e9 0c             	shr    $0xc,%ecx
+  80241d:	01 c8                	add    %ecx,%eax
+  80241f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802422:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802425:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802427:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80242a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80242f:	29 c8                	sub    %ecx,%eax
+  802431:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802434:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802437:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802439:	b8 01 00 00 00       	mov    $0x1,%eax
+  80243e:	89 f9                	mov    %edi,%ecx
+  802440:	d3 e0                	shl    %cl,%eax
+  802442:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802448:	83 ec 08             	sub    $0x8,%esp
+  80244b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80244d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802450:	50                   	push   %eax
+  802451:	6a 00                	push   $0x0
+  802453:	56                   	push   %esi
+  802454:	6a 00                	push   $0x0
+  802456:	68 20 60 80 00       	push   $0x806020
+  80245b:	e8 e4 0e 00 00       	call   803344 <pgbatch_map>
+  802460:	83 c4 20             	add    $0x20,%esp
+  802463:	85 c0                	test   %eax,%eax
+  802465:	0f 88 ce fe ff ff    	js     802339 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80246b:	83 c7 01             	add    $0x1,%edi
+  80246e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802474:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802477:	39 c7                	cmp    %eax,%edi
+  802479:	75 be                	jne    802439 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80247b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80247e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802481:	89 d6                	mov    %edx,%esi
+  802483:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802489:	e9 01 ff ff ff       	jmp    80238f <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80248e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802491:	85 db                	test   %ebx,%ebx
+  802493:	0f 45 c3             	cmovne %ebx,%eax
+  802496:	e9 a6 fe ff ff       	jmp    802341 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80249b:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80249f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8024a6:	e9 f3 fe ff ff       	jmp    80239e <nsipc_sendmsg+0xc4>
+  8024ab:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8024ae:	eb 03                	jmp    8024b3 <nsipc_sendmsg+0x1d9>
+  8024b0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8024b3:	83 ec 0c             	sub    $0xc,%esp
+  8024b6:	68 20 60 80 00       	push   $0x806020
+  8024bb:	e8 d4 0d 00 00       	call   803294 <pgbatch_flush>
+  8024c0:	83 c4 10             	add    $0x10,%esp
+  8024c3:	85 c0                	test   %eax,%eax
+  8024c5:	78 50                	js     802517 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8024c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ca:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8024cf:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8024d5:	89 fb                	mov    %edi,%ebx
+  8024d7:	29 f3                	sub    %esi,%ebx
+  8024d9:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8024df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e2:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8024e7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8024ec:	89 fa                	mov    %edi,%edx
+  8024ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8024f3:	e8 66 fb ff ff       	call   80205e <nsipc_bulk>
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	78 28                	js     802524 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8024fc:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8024ff:	39 c3                	cmp    %eax,%ebx
+  802501:	75 0c                	jne    80250f <nsipc_sendmsg+0x235>
+  802503:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802506:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802509:	0f 8f f2 fd ff ff    	jg     802301 <nsipc_sendmsg+0x27>
+		sent += r;
+  80250f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802512:	e9 2a fe ff ff       	jmp    802341 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802517:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80251a:	85 db                	test   %ebx,%ebx
+  80251c:	0f 45 c3             	cmovne %ebx,%eax
+  80251f:	e9 1d fe ff ff       	jmp    802341 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802524:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802527:	85 db                	test   %ebx,%ebx
+  802529:	0f 45 c3             	cmovne %ebx,%eax
+  80252c:	e9 10 fe ff ff       	jmp    802341 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802531:	83 ec 0c             	sub    $0xc,%esp
+  802534:	68 20 60 80 00       	push   $0x806020
+  802539:	e8 48 0d 00 00       	call   803286 <pgbatch_init>
+  80253e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802541:	be 00 00 00 00       	mov    $0x0,%esi
+  802546:	bf 00 00 00 00       	mov    $0x0,%edi
+  80254b:	e9 63 ff ff ff       	jmp    8024b3 <nsipc_sendmsg+0x1d9>
+
+00802550 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	57                   	push   %edi
+  802554:	56                   	push   %esi
+  802555:	53                   	push   %ebx
+  802556:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802559:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802560:	0f 84 c8 00 00 00    	je     80262e <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802566:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80256d:	0f 84 e4 00 00 00    	je     802657 <nsipc_sendfile+0x107>
+{
+  802573:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802578:	89 fb                	mov    %edi,%ebx
+  80257a:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80257d:	0f 83 f0 00 00 00    	jae    802673 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802583:	89 fa                	mov    %edi,%edx
+  802585:	03 55 10             	add    0x10(%ebp),%edx
+  802588:	89 d0                	mov    %edx,%eax
+  80258a:	c1 f8 1f             	sar    $0x1f,%eax
+  80258d:	c1 e8 14             	shr    $0x14,%eax
+  802590:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802593:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802599:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80259b:	6a 10                	push   $0x10
+  80259d:	68 00 20 01 e0       	push   $0xe0012000
+  8025a2:	52                   	push   %edx
+  8025a3:	ff 75 0c             	push   0xc(%ebp)
+  8025a6:	e8 fe f4 ff ff       	call   801aa9 <fmap>
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	0f 8e b8 00 00 00    	jle    80266e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8025b6:	39 c6                	cmp    %eax,%esi
+  8025b8:	0f 8d b5 00 00 00    	jge    802673 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8025be:	29 f0                	sub    %esi,%eax
+  8025c0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8025c3:	29 da                	sub    %ebx,%edx
+  8025c5:	39 d0                	cmp    %edx,%eax
+  8025c7:	89 d3                	mov    %edx,%ebx
+  8025c9:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8025cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025cf:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8025d4:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8025da:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8025e0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8025e3:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025e8:	83 ec 0c             	sub    $0xc,%esp
+  8025eb:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8025ed:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8025f4:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025f7:	83 c0 01             	add    $0x1,%eax
+  8025fa:	50                   	push   %eax
+  8025fb:	68 00 10 01 e0       	push   $0xe0011000
+  802600:	6a 11                	push   $0x11
+  802602:	ff 35 24 63 80 00    	push   0x806324
+  802608:	e8 ba 12 00 00       	call   8038c7 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80260d:	83 c4 1c             	add    $0x1c,%esp
+  802610:	6a 00                	push   $0x0
+  802612:	6a 00                	push   $0x0
+  802614:	6a 00                	push   $0x0
+  802616:	e8 e8 0f 00 00       	call   803603 <ipc_recv>
+  80261b:	83 c4 10             	add    $0x10,%esp
+  80261e:	85 c0                	test   %eax,%eax
+  802620:	78 5b                	js     80267d <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802622:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802624:	39 c3                	cmp    %eax,%ebx
+  802626:	0f 8e 4c ff ff ff    	jle    802578 <nsipc_sendfile+0x28>
+  80262c:	eb 45                	jmp    802673 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80262e:	83 ec 04             	sub    $0x4,%esp
+  802631:	6a 07                	push   $0x7
+  802633:	68 00 10 01 e0       	push   $0xe0011000
+  802638:	6a 00                	push   $0x0
+  80263a:	e8 25 e7 ff ff       	call   800d64 <sys_page_alloc>
+  80263f:	89 c7                	mov    %eax,%edi
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	85 c0                	test   %eax,%eax
+  802646:	78 2b                	js     802673 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802648:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  80264f:	00 00 00 
+  802652:	e9 0f ff ff ff       	jmp    802566 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802657:	83 ec 0c             	sub    $0xc,%esp
+  80265a:	6a 03                	push   $0x3
+  80265c:	e8 9b 12 00 00       	call   8038fc <ipc_find_env>
+  802661:	a3 24 63 80 00       	mov    %eax,0x806324
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	e9 05 ff ff ff       	jmp    802573 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80266e:	85 ff                	test   %edi,%edi
+  802670:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802673:	89 f8                	mov    %edi,%eax
+  802675:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802678:	5b                   	pop    %ebx
+  802679:	5e                   	pop    %esi
+  80267a:	5f                   	pop    %edi
+  80267b:	5d                   	pop    %ebp
+  80267c:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80267d:	85 ff                	test   %edi,%edi
+  80267f:	0f 44 f8             	cmove  %eax,%edi
+  802682:	eb ef                	jmp    802673 <nsipc_sendfile+0x123>
+
+00802684 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802684:	55                   	push   %ebp
+  802685:	89 e5                	mov    %esp,%ebp
+  802687:	57                   	push   %edi
+  802688:	56                   	push   %esi
+  802689:	53                   	push   %ebx
+  80268a:	83 ec 1c             	sub    $0x1c,%esp
+  80268d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802690:	e8 13 f9 ff ff       	call   801fa8 <nsbulk_map>
+  802695:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802698:	85 c0                	test   %eax,%eax
+  80269a:	0f 88 ba 00 00 00    	js     80275a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026a0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8026a4:	0f 8e bb 00 00 00    	jle    802765 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8026aa:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026af:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8026b4:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8026b9:	89 f8                	mov    %edi,%eax
+  8026bb:	29 f0                	sub    %esi,%eax
+  8026bd:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8026c1:	39 c8                	cmp    %ecx,%eax
+  8026c3:	0f 47 c1             	cmova  %ecx,%eax
+  8026c6:	01 f0                	add    %esi,%eax
+  8026c8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026ca:	83 c2 01             	add    $0x1,%edx
+  8026cd:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8026d0:	7e 07                	jle    8026d9 <nsipc_recvmsg+0x55>
+  8026d2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8026d7:	7e e0                	jle    8026b9 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8026d9:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8026df:	c1 fa 0c             	sar    $0xc,%edx
+  8026e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e7:	e8 0a f9 ff ff       	call   801ff6 <nsbulk_own>
+  8026ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026ef:	85 c0                	test   %eax,%eax
+  8026f1:	78 67                	js     80275a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8026f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8026fb:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802701:	8b 45 14             	mov    0x14(%ebp),%eax
+  802704:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802709:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80270e:	89 f2                	mov    %esi,%edx
+  802710:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802715:	e8 44 f9 ff ff       	call   80205e <nsipc_bulk>
+  80271a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80271d:	85 c0                	test   %eax,%eax
+  80271f:	78 39                	js     80275a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802721:	39 f0                	cmp    %esi,%eax
+  802723:	7f 4a                	jg     80276f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	7e 2c                	jle    80275a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80272e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802731:	29 fe                	sub    %edi,%esi
+  802733:	8b 43 04             	mov    0x4(%ebx),%eax
+  802736:	39 c6                	cmp    %eax,%esi
+  802738:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80273b:	83 ec 04             	sub    $0x4,%esp
+  80273e:	56                   	push   %esi
+  80273f:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802745:	50                   	push   %eax
+  802746:	ff 33                	push   (%ebx)
+  802748:	e8 93 e3 ff ff       	call   800ae0 <memmove>
+		n += m;
+  80274d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80274f:	83 c3 08             	add    $0x8,%ebx
+  802752:	83 c4 10             	add    $0x10,%esp
+  802755:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802758:	7f d4                	jg     80272e <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80275a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80275d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802760:	5b                   	pop    %ebx
+  802761:	5e                   	pop    %esi
+  802762:	5f                   	pop    %edi
+  802763:	5d                   	pop    %ebp
+  802764:	c3                   	ret
+	int r, i, n, len = 0;
+  802765:	be 00 00 00 00       	mov    $0x0,%esi
+  80276a:	e9 6a ff ff ff       	jmp    8026d9 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80276f:	68 00 40 80 00       	push   $0x804000
+  802774:	68 09 40 80 00       	push   $0x804009
+  802779:	68 3b 01 00 00       	push   $0x13b
+  80277e:	68 1e 40 80 00       	push   $0x80401e
+  802783:	e8 d6 d9 ff ff       	call   80015e <_panic>
+
+00802788 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802788:	55                   	push   %ebp
+  802789:	89 e5                	mov    %esp,%ebp
+  80278b:	57                   	push   %edi
+  80278c:	56                   	push   %esi
+  80278d:	53                   	push   %ebx
+  80278e:	83 ec 0c             	sub    $0xc,%esp
+  802791:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802794:	8b 75 10             	mov    0x10(%ebp),%esi
+  802797:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80279a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8027a2:	8b 07                	mov    (%edi),%eax
+  8027a4:	a3 04 80 80 00       	mov    %eax,0x808004
+  8027a9:	8b 47 04             	mov    0x4(%edi),%eax
+  8027ac:	a3 08 80 80 00       	mov    %eax,0x808008
+  8027b1:	8b 47 08             	mov    0x8(%edi),%eax
+  8027b4:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8027b9:	8b 47 0c             	mov    0xc(%edi),%eax
+  8027bc:	a3 10 80 80 00       	mov    %eax,0x808010
+  8027c1:	8b 47 10             	mov    0x10(%edi),%eax
+  8027c4:	a3 14 80 80 00       	mov    %eax,0x808014
+  8027c9:	8b 47 14             	mov    0x14(%edi),%eax
+  8027cc:	a3 18 80 80 00       	mov    %eax,0x808018
+  8027d1:	8b 47 18             	mov    0x18(%edi),%eax
+  8027d4:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8027d9:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8027dc:	a3 20 80 80 00       	mov    %eax,0x808020
+  8027e1:	8b 47 20             	mov    0x20(%edi),%eax
+  8027e4:	a3 24 80 80 00       	mov    %eax,0x808024
+  8027e9:	8b 47 24             	mov    0x24(%edi),%eax
+  8027ec:	a3 28 80 80 00       	mov    %eax,0x808028
+  8027f1:	8b 47 28             	mov    0x28(%edi),%eax
+  8027f4:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8027f9:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8027fc:	a3 30 80 80 00       	mov    %eax,0x808030
+  802801:	8b 47 30             	mov    0x30(%edi),%eax
+  802804:	a3 34 80 80 00       	mov    %eax,0x808034
+  802809:	8b 47 34             	mov    0x34(%edi),%eax
+  80280c:	a3 38 80 80 00       	mov    %eax,0x808038
+  802811:	8b 47 38             	mov    0x38(%edi),%eax
+  802814:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802819:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80281c:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802821:	8b 06                	mov    (%esi),%eax
+  802823:	a3 44 80 80 00       	mov    %eax,0x808044
+  802828:	8b 46 04             	mov    0x4(%esi),%eax
+  80282b:	a3 48 80 80 00       	mov    %eax,0x808048
+  802830:	8b 46 08             	mov    0x8(%esi),%eax
+  802833:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802838:	8b 46 0c             	mov    0xc(%esi),%eax
+  80283b:	a3 50 80 80 00       	mov    %eax,0x808050
+  802840:	8b 46 10             	mov    0x10(%esi),%eax
+  802843:	a3 54 80 80 00       	mov    %eax,0x808054
+  802848:	8b 46 14             	mov    0x14(%esi),%eax
+  80284b:	a3 58 80 80 00       	mov    %eax,0x808058
+  802850:	8b 46 18             	mov    0x18(%esi),%eax
+  802853:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802858:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80285b:	a3 60 80 80 00       	mov    %eax,0x808060
+  802860:	8b 46 20             	mov    0x20(%esi),%eax
+  802863:	a3 64 80 80 00       	mov    %eax,0x808064
+  802868:	8b 46 24             	mov    0x24(%esi),%eax
+  80286b:	a3 68 80 80 00       	mov    %eax,0x808068
+  802870:	8b 46 28             	mov    0x28(%esi),%eax
+  802873:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802878:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80287b:	a3 70 80 80 00       	mov    %eax,0x808070
+  802880:	8b 46 30             	mov    0x30(%esi),%eax
+  802883:	a3 74 80 80 00       	mov    %eax,0x808074
+  802888:	8b 46 34             	mov    0x34(%esi),%eax
+  80288b:	a3 78 80 80 00       	mov    %eax,0x808078
+  802890:	8b 46 38             	mov    0x38(%esi),%eax
+  802893:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802898:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80289b:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8028a0:	8b 03                	mov    (%ebx),%eax
+  8028a2:	a3 84 80 80 00       	mov    %eax,0x808084
+  8028a7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028aa:	a3 88 80 80 00       	mov    %eax,0x808088
+  8028af:	8b 43 08             	mov    0x8(%ebx),%eax
+  8028b2:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8028b7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8028ba:	a3 90 80 80 00       	mov    %eax,0x808090
+  8028bf:	8b 43 10             	mov    0x10(%ebx),%eax
+  8028c2:	a3 94 80 80 00       	mov    %eax,0x808094
+  8028c7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028ca:	a3 98 80 80 00       	mov    %eax,0x808098
+  8028cf:	8b 43 18             	mov    0x18(%ebx),%eax
+  8028d2:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8028d7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8028da:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8028df:	8b 43 20             	mov    0x20(%ebx),%eax
+  8028e2:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8028e7:	8b 43 24             	mov    0x24(%ebx),%eax
+  8028ea:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8028ef:	8b 43 28             	mov    0x28(%ebx),%eax
+  8028f2:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8028f7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8028fa:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8028ff:	8b 43 30             	mov    0x30(%ebx),%eax
+  802902:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802907:	8b 43 34             	mov    0x34(%ebx),%eax
+  80290a:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80290f:	8b 43 38             	mov    0x38(%ebx),%eax
+  802912:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802917:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80291a:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80291f:	8b 45 18             	mov    0x18(%ebp),%eax
+  802922:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802927:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80292c:	e8 2b f6 ff ff       	call   801f5c <nsipc>
+  802931:	85 c0                	test   %eax,%eax
+  802933:	0f 88 ad 01 00 00    	js     802ae6 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802939:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80293f:	89 17                	mov    %edx,(%edi)
+  802941:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802947:	89 57 04             	mov    %edx,0x4(%edi)
+  80294a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802950:	89 57 08             	mov    %edx,0x8(%edi)
+  802953:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802959:	89 57 0c             	mov    %edx,0xc(%edi)
+  80295c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802962:	89 57 10             	mov    %edx,0x10(%edi)
+  802965:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80296b:	89 57 14             	mov    %edx,0x14(%edi)
+  80296e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802974:	89 57 18             	mov    %edx,0x18(%edi)
+  802977:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80297d:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802980:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802986:	89 57 20             	mov    %edx,0x20(%edi)
+  802989:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  80298f:	89 57 24             	mov    %edx,0x24(%edi)
+  802992:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802998:	89 57 28             	mov    %edx,0x28(%edi)
+  80299b:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8029a1:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8029a4:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8029aa:	89 57 30             	mov    %edx,0x30(%edi)
+  8029ad:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8029b3:	89 57 34             	mov    %edx,0x34(%edi)
+  8029b6:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8029bc:	89 57 38             	mov    %edx,0x38(%edi)
+  8029bf:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8029c5:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8029c8:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8029ce:	89 16                	mov    %edx,(%esi)
+  8029d0:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8029d6:	89 56 04             	mov    %edx,0x4(%esi)
+  8029d9:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8029df:	89 56 08             	mov    %edx,0x8(%esi)
+  8029e2:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8029e8:	89 56 0c             	mov    %edx,0xc(%esi)
+  8029eb:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  8029f1:	89 56 10             	mov    %edx,0x10(%esi)
+  8029f4:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8029fa:	89 56 14             	mov    %edx,0x14(%esi)
+  8029fd:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802a03:	89 56 18             	mov    %edx,0x18(%esi)
+  802a06:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802a0c:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802a0f:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802a15:	89 56 20             	mov    %edx,0x20(%esi)
+  802a18:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802a1e:	89 56 24             	mov    %edx,0x24(%esi)
+  802a21:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802a27:	89 56 28             	mov    %edx,0x28(%esi)
+  802a2a:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802a30:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802a33:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802a39:	89 56 30             	mov    %edx,0x30(%esi)
+  802a3c:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802a42:	89 56 34             	mov    %edx,0x34(%esi)
+  802a45:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802a4b:	89 56 38             	mov    %edx,0x38(%esi)
+  802a4e:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802a54:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802a57:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802a5d:	89 13                	mov    %edx,(%ebx)
+  802a5f:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802a65:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a68:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802a6e:	89 53 08             	mov    %edx,0x8(%ebx)
+  802a71:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802a77:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802a7a:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802a80:	89 53 10             	mov    %edx,0x10(%ebx)
+  802a83:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802a89:	89 53 14             	mov    %edx,0x14(%ebx)
+  802a8c:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802a92:	89 53 18             	mov    %edx,0x18(%ebx)
+  802a95:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802a9b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802a9e:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802aa4:	89 53 20             	mov    %edx,0x20(%ebx)
+  802aa7:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802aad:	89 53 24             	mov    %edx,0x24(%ebx)
+  802ab0:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802ab6:	89 53 28             	mov    %edx,0x28(%ebx)
+  802ab9:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802abf:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802ac2:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802ac8:	89 53 30             	mov    %edx,0x30(%ebx)
+  802acb:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802ad1:	89 53 34             	mov    %edx,0x34(%ebx)
+  802ad4:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802ada:	89 53 38             	mov    %edx,0x38(%ebx)
+  802add:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802ae3:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802ae6:	83 c4 0c             	add    $0xc,%esp
+  802ae9:	5b                   	pop    %ebx
+  802aea:	5e                   	pop    %esi
+  802aeb:	5f                   	pop    %edi
+  802aec:	5d                   	pop    %ebp
+  802aed:	c3                   	ret
+
+00802aee <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802aee:	55                   	push   %ebp
+  802aef:	89 e5                	mov    %esp,%ebp
+  802af1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802af4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802afc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aff:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802b04:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b07:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802b0c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802b11:	e8 46 f4 ff ff       	call   801f5c <nsipc>
+}
+  802b16:	c9                   	leave
+  802b17:	c3                   	ret
+
+00802b18 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802b18:	55                   	push   %ebp
+  802b19:	89 e5                	mov    %esp,%ebp
+  802b1b:	56                   	push   %esi
+  802b1c:	53                   	push   %ebx
+  802b1d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802b20:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802b26:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b29:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802b2e:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b33:	e8 24 f4 ff ff       	call   801f5c <nsipc>
+  802b38:	89 c3                	mov    %eax,%ebx
+  802b3a:	85 c0                	test   %eax,%eax
+  802b3c:	7e 1f                	jle    802b5d <nsipc_evwait+0x45>
+		assert(r <= max);
+  802b3e:	39 c6                	cmp    %eax,%esi
+  802b40:	7c 24                	jl     802b66 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802b42:	83 ec 04             	sub    $0x4,%esp
+  802b45:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802b4c:	50                   	push   %eax
+  802b4d:	68 00 80 80 00       	push   $0x808000
+  802b52:	ff 75 08             	push   0x8(%ebp)
+  802b55:	e8 86 df ff ff       	call   800ae0 <memmove>
+  802b5a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802b5d:	89 d8                	mov    %ebx,%eax
+  802b5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b62:	5b                   	pop    %ebx
+  802b63:	5e                   	pop    %esi
+  802b64:	5d                   	pop    %ebp
+  802b65:	c3                   	ret
+		assert(r <= max);
+  802b66:	68 36 40 80 00       	push   $0x804036
+  802b6b:	68 09 40 80 00       	push   $0x804009
+  802b70:	68 6a 01 00 00       	push   $0x16a
+  802b75:	68 1e 40 80 00       	push   $0x80401e
+  802b7a:	e8 df d5 ff ff       	call   80015e <_panic>
+
+00802b7f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b7f:	55                   	push   %ebp
+  802b80:	89 e5                	mov    %esp,%ebp
+  802b82:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b88:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b90:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b95:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b98:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b9d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ba2:	e8 b5 f3 ff ff       	call   801f5c <nsipc>
+}
+  802ba7:	c9                   	leave
+  802ba8:	c3                   	ret
+
+00802ba9 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802ba9:	55                   	push   %ebp
+  802baa:	89 e5                	mov    %esp,%ebp
+  802bac:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802baf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb2:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802bb7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802bbc:	e8 9b f3 ff ff       	call   801f5c <nsipc>
+}
+  802bc1:	c9                   	leave
+  802bc2:	c3                   	ret
+
+00802bc3 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802bc3:	55                   	push   %ebp
+  802bc4:	89 e5                	mov    %esp,%ebp
+  802bc6:	53                   	push   %ebx
+  802bc7:	83 ec 04             	sub    $0x4,%esp
+  802bca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802bcd:	b8 12 00 00 00       	mov    $0x12,%eax
+  802bd2:	e8 85 f3 ff ff       	call   801f5c <nsipc>
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	78 50                	js     802c2b <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802bdb:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802be1:	89 13                	mov    %edx,(%ebx)
+  802be3:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802be9:	89 53 04             	mov    %edx,0x4(%ebx)
+  802bec:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802bf2:	89 53 08             	mov    %edx,0x8(%ebx)
+  802bf5:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802bfb:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802bfe:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802c04:	89 53 10             	mov    %edx,0x10(%ebx)
+  802c07:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802c0d:	89 53 14             	mov    %edx,0x14(%ebx)
+  802c10:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802c16:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c19:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802c1f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802c22:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802c28:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802c2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2e:	c9                   	leave
+  802c2f:	c3                   	ret
+
+00802c30 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802c30:	55                   	push   %ebp
+  802c31:	89 e5                	mov    %esp,%ebp
+  802c33:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c36:	6a 03                	push   $0x3
+  802c38:	e8 bf 0c 00 00       	call   8038fc <ipc_find_env>
+  802c3d:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802c42:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c45:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802c4a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802c4f:	e8 08 f3 ff ff       	call   801f5c <nsipc>
+  802c54:	83 c4 10             	add    $0x10,%esp
+  802c57:	85 c0                	test   %eax,%eax
+  802c59:	78 0a                	js     802c65 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802c5b:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802c60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c65:	c9                   	leave
+  802c66:	c3                   	ret
+
+00802c67 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802c67:	55                   	push   %ebp
+  802c68:	89 e5                	mov    %esp,%ebp
+  802c6a:	57                   	push   %edi
+  802c6b:	56                   	push   %esi
+  802c6c:	53                   	push   %ebx
+  802c6d:	83 ec 1c             	sub    $0x1c,%esp
+  802c70:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c73:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802c76:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802c7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c80:	89 e0                	mov    %esp,%eax
+  802c82:	89 f2                	mov    %esi,%edx
+  802c84:	29 c2                	sub    %eax,%edx
+  802c86:	89 d0                	mov    %edx,%eax
+  802c88:	c1 e8 0f             	shr    $0xf,%eax
+  802c8b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802c91:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802c94:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802c9b:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802c9e:	83 ec 0c             	sub    $0xc,%esp
+  802ca1:	ff 75 e0             	push   -0x20(%ebp)
+  802ca4:	e8 92 0c 00 00       	call   80393b <pageref>
+  802ca9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802cac:	83 c4 04             	add    $0x4,%esp
+  802caf:	ff 75 dc             	push   -0x24(%ebp)
+  802cb2:	e8 84 0c 00 00       	call   80393b <pageref>
+  802cb7:	89 e2                	mov    %esp,%edx
+  802cb9:	89 f1                	mov    %esi,%ecx
+  802cbb:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802cbd:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802cc0:	89 ca                	mov    %ecx,%edx
+  802cc2:	c1 ea 0f             	shr    $0xf,%edx
+  802cc5:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802ccb:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802cce:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802cd5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802cd8:	39 d7                	cmp    %edx,%edi
+  802cda:	74 40                	je     802d1c <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802cdc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cdf:	75 9f                	jne    802c80 <_pipeisclosed+0x19>
+  802ce1:	89 e2                	mov    %esp,%edx
+  802ce3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802ce8:	29 d0                	sub    %edx,%eax
+  802cea:	89 c2                	mov    %eax,%edx
+  802cec:	c1 ea 0f             	shr    $0xf,%edx
+  802cef:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf9:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802cfc:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802d03:	8b 40 58             	mov    0x58(%eax),%eax
+  802d06:	6a 01                	push   $0x1
+  802d08:	50                   	push   %eax
+  802d09:	57                   	push   %edi
+  802d0a:	68 3f 40 80 00       	push   $0x80403f
+  802d0f:	e8 25 d5 ff ff       	call   800239 <cprintf>
+  802d14:	83 c4 10             	add    $0x10,%esp
+  802d17:	e9 5f ff ff ff       	jmp    802c7b <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802d1c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d1f:	0f 94 c0             	sete   %al
+  802d22:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802d25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d28:	5b                   	pop    %ebx
+  802d29:	5e                   	pop    %esi
+  802d2a:	5f                   	pop    %edi
+  802d2b:	5d                   	pop    %ebp
+  802d2c:	c3                   	ret
+
+00802d2d <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802d2d:	55                   	push   %ebp
+  802d2e:	89 e5                	mov    %esp,%ebp
+  802d30:	53                   	push   %ebx
+  802d31:	83 ec 0c             	sub    $0xc,%esp
+  802d34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802d37:	53                   	push   %ebx
+  802d38:	6a 00                	push   $0x0
+  802d3a:	e8 aa e0 ff ff       	call   800de9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d3f:	89 1c 24             	mov    %ebx,(%esp)
+  802d42:	e8 f4 e4 ff ff       	call   80123b <fd2data>
+  802d47:	83 c4 08             	add    $0x8,%esp
+  802d4a:	50                   	push   %eax
+  802d4b:	6a 00                	push   $0x0
+  802d4d:	e8 97 e0 ff ff       	call   800de9 <sys_page_unmap>
+}
+  802d52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d55:	c9                   	leave
+  802d56:	c3                   	ret
+
+00802d57 <devpipe_read>:
+{
+  802d57:	55                   	push   %ebp
+  802d58:	89 e5                	mov    %esp,%ebp
+  802d5a:	57                   	push   %edi
+  802d5b:	56                   	push   %esi
+  802d5c:	53                   	push   %ebx
+  802d5d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802d60:	ff 75 08             	push   0x8(%ebp)
+  802d63:	e8 d3 e4 ff ff       	call   80123b <fd2data>
+  802d68:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d6a:	8b 70 04             	mov    0x4(%eax),%esi
+  802d6d:	8b 00                	mov    (%eax),%eax
+  802d6f:	83 c4 10             	add    $0x10,%esp
+  802d72:	39 f0                	cmp    %esi,%eax
+  802d74:	75 36                	jne    802dac <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802d76:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802d79:	89 da                	mov    %ebx,%edx
+  802d7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7e:	e8 e4 fe ff ff       	call   802c67 <_pipeisclosed>
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	0f 85 d4 00 00 00    	jne    802e5f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802d8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d90:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	6a ff                	push   $0xffffffff
+  802d99:	56                   	push   %esi
+  802d9a:	57                   	push   %edi
+  802d9b:	e8 c2 e3 ff ff       	call   801162 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802da0:	8b 73 04             	mov    0x4(%ebx),%esi
+  802da3:	8b 03                	mov    (%ebx),%eax
+  802da5:	83 c4 10             	add    $0x10,%esp
+  802da8:	39 c6                	cmp    %eax,%esi
+  802daa:	74 cd                	je     802d79 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802dac:	8b 73 04             	mov    0x4(%ebx),%esi
+  802daf:	8b 03                	mov    (%ebx),%eax
+  802db1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802db7:	29 c6                	sub    %eax,%esi
+  802db9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dbe:	f7 e6                	mul    %esi
+  802dc0:	c1 ea 0c             	shr    $0xc,%edx
+  802dc3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802dc9:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802dcb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802dce:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802dd2:	8b 0b                	mov    (%ebx),%ecx
+  802dd4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dd9:	f7 e1                	mul    %ecx
+  802ddb:	c1 ea 0b             	shr    $0xb,%edx
+  802dde:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802de4:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802de6:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802deb:	29 cf                	sub    %ecx,%edi
+  802ded:	39 f7                	cmp    %esi,%edi
+  802def:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802df2:	83 ec 04             	sub    $0x4,%esp
+  802df5:	57                   	push   %edi
+  802df6:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802dfa:	50                   	push   %eax
+  802dfb:	ff 75 0c             	push   0xc(%ebp)
+  802dfe:	e8 dd dc ff ff       	call   800ae0 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802e03:	83 c4 0c             	add    $0xc,%esp
+  802e06:	89 f0                	mov    %esi,%eax
+  802e08:	29 f8                	sub    %edi,%eax
+  802e0a:	50                   	push   %eax
+  802e0b:	8d 43 10             	lea    0x10(%ebx),%eax
+  802e0e:	50                   	push   %eax
+  802e0f:	89 f8                	mov    %edi,%eax
+  802e11:	03 45 0c             	add    0xc(%ebp),%eax
+  802e14:	50                   	push   %eax
+  802e15:	e8 c6 dc ff ff       	call   800ae0 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802e1a:	8b 0b                	mov    (%ebx),%ecx
+  802e1c:	01 f1                	add    %esi,%ecx
+  802e1e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e23:	f7 e1                	mul    %ecx
+  802e25:	c1 ea 0c             	shr    $0xc,%edx
+  802e28:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802e2e:	29 c1                	sub    %eax,%ecx
+  802e30:	89 0b                	mov    %ecx,(%ebx)
+  802e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e37:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802e3b:	83 c4 10             	add    $0x10,%esp
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	75 0a                	jne    802e4c <devpipe_read+0xf5>
+	return n;
+  802e42:	89 f0                	mov    %esi,%eax
+}
+  802e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e47:	5b                   	pop    %ebx
+  802e48:	5e                   	pop    %esi
+  802e49:	5f                   	pop    %edi
+  802e4a:	5d                   	pop    %ebp
+  802e4b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802e4c:	83 ec 08             	sub    $0x8,%esp
+  802e4f:	68 00 04 00 00       	push   $0x400
+  802e54:	53                   	push   %ebx
+  802e55:	e8 2a e3 ff ff       	call   801184 <sys_futex_wake>
+  802e5a:	83 c4 10             	add    $0x10,%esp
+  802e5d:	eb e3                	jmp    802e42 <devpipe_read+0xeb>
+			return 0;
+  802e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e64:	eb de                	jmp    802e44 <devpipe_read+0xed>
+
+00802e66 <devpipe_write>:
+{
+  802e66:	55                   	push   %ebp
+  802e67:	89 e5                	mov    %esp,%ebp
+  802e69:	57                   	push   %edi
+  802e6a:	56                   	push   %esi
+  802e6b:	53                   	push   %ebx
+  802e6c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802e6f:	ff 75 08             	push   0x8(%ebp)
+  802e72:	e8 c4 e3 ff ff       	call   80123b <fd2data>
+  802e77:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802e79:	83 c4 10             	add    $0x10,%esp
+  802e7c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e83:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802e88:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e8c:	0f 84 43 01 00 00    	je     802fd5 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e92:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e95:	8b 06                	mov    (%esi),%eax
+  802e97:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e9d:	29 c1                	sub    %eax,%ecx
+  802e9f:	89 c8                	mov    %ecx,%eax
+  802ea1:	f7 e7                	mul    %edi
+  802ea3:	c1 ea 0c             	shr    $0xc,%edx
+  802ea6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802eac:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802eae:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802eb4:	75 52                	jne    802f08 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802eb6:	89 f2                	mov    %esi,%edx
+  802eb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebb:	e8 a7 fd ff ff       	call   802c67 <_pipeisclosed>
+  802ec0:	85 c0                	test   %eax,%eax
+  802ec2:	0f 85 28 01 00 00    	jne    802ff0 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802ec8:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802eca:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ecd:	8b 06                	mov    (%esi),%eax
+  802ecf:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802ed5:	29 c1                	sub    %eax,%ecx
+  802ed7:	89 c8                	mov    %ecx,%eax
+  802ed9:	f7 e7                	mul    %edi
+  802edb:	c1 ea 0c             	shr    $0xc,%edx
+  802ede:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ee4:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802ee6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802eec:	75 a4                	jne    802e92 <devpipe_write+0x2c>
+  802eee:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ef3:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802ef7:	83 ec 04             	sub    $0x4,%esp
+  802efa:	6a ff                	push   $0xffffffff
+  802efc:	53                   	push   %ebx
+  802efd:	56                   	push   %esi
+  802efe:	e8 5f e2 ff ff       	call   801162 <sys_futex_wait>
+}
+  802f03:	83 c4 10             	add    $0x10,%esp
+  802f06:	eb 8a                	jmp    802e92 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f08:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f0b:	8b 06                	mov    (%esi),%eax
+  802f0d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f13:	29 c1                	sub    %eax,%ecx
+  802f15:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f1a:	f7 e1                	mul    %ecx
+  802f1c:	c1 ea 0c             	shr    $0xc,%edx
+  802f1f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f25:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802f27:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802f2c:	89 d8                	mov    %ebx,%eax
+  802f2e:	29 c8                	sub    %ecx,%eax
+  802f30:	8b 55 10             	mov    0x10(%ebp),%edx
+  802f33:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f36:	29 ca                	sub    %ecx,%edx
+  802f38:	39 d0                	cmp    %edx,%eax
+  802f3a:	0f 46 d0             	cmovbe %eax,%edx
+  802f3d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802f40:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f43:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f48:	f7 e1                	mul    %ecx
+  802f4a:	c1 ea 0b             	shr    $0xb,%edx
+  802f4d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f53:	89 ca                	mov    %ecx,%edx
+  802f55:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802f57:	29 d3                	sub    %edx,%ebx
+  802f59:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f5c:	39 c3                	cmp    %eax,%ebx
+  802f5e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802f61:	83 ec 04             	sub    $0x4,%esp
+  802f64:	53                   	push   %ebx
+  802f65:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f68:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802f6b:	51                   	push   %ecx
+  802f6c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802f70:	50                   	push   %eax
+  802f71:	e8 6a db ff ff       	call   800ae0 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802f76:	83 c4 0c             	add    $0xc,%esp
+  802f79:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f7c:	29 d8                	sub    %ebx,%eax
+  802f7e:	50                   	push   %eax
+  802f7f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f82:	01 cb                	add    %ecx,%ebx
+  802f84:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f87:	53                   	push   %ebx
+  802f88:	8d 46 10             	lea    0x10(%esi),%eax
+  802f8b:	50                   	push   %eax
+  802f8c:	e8 4f db ff ff       	call   800ae0 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802f91:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f94:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f97:	01 c1                	add    %eax,%ecx
+  802f99:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f9e:	f7 e1                	mul    %ecx
+  802fa0:	c1 ea 0c             	shr    $0xc,%edx
+  802fa3:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802fa9:	89 ca                	mov    %ecx,%edx
+  802fab:	29 c2                	sub    %eax,%edx
+  802fad:	89 56 04             	mov    %edx,0x4(%esi)
+  802fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb5:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802fb9:	83 c4 10             	add    $0x10,%esp
+  802fbc:	85 c0                	test   %eax,%eax
+  802fbe:	75 1a                	jne    802fda <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802fc0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802fc3:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802fc6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fc9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802fcc:	0f 82 c0 fe ff ff    	jb     802e92 <devpipe_write+0x2c>
+  802fd2:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802fd5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fd8:	eb 1b                	jmp    802ff5 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802fda:	83 ec 08             	sub    $0x8,%esp
+  802fdd:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802fe2:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802fe5:	50                   	push   %eax
+  802fe6:	e8 99 e1 ff ff       	call   801184 <sys_futex_wake>
+  802feb:	83 c4 10             	add    $0x10,%esp
+  802fee:	eb d0                	jmp    802fc0 <devpipe_write+0x15a>
+				return 0;
+  802ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff8:	5b                   	pop    %ebx
+  802ff9:	5e                   	pop    %esi
+  802ffa:	5f                   	pop    %edi
+  802ffb:	5d                   	pop    %ebp
+  802ffc:	c3                   	ret
+
+00802ffd <devpipe_stat>:
+{
+  802ffd:	55                   	push   %ebp
+  802ffe:	89 e5                	mov    %esp,%ebp
+  803000:	56                   	push   %esi
+  803001:	53                   	push   %ebx
+  803002:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803005:	83 ec 0c             	sub    $0xc,%esp
+  803008:	ff 75 08             	push   0x8(%ebp)
+  80300b:	e8 2b e2 ff ff       	call   80123b <fd2data>
+  803010:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803012:	83 c4 08             	add    $0x8,%esp
+  803015:	68 52 40 80 00       	push   $0x804052
+  80301a:	53                   	push   %ebx
+  80301b:	e8 10 d9 ff ff       	call   800930 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803020:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803023:	8b 06                	mov    (%esi),%eax
+  803025:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80302b:	29 c1                	sub    %eax,%ecx
+  80302d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803032:	89 c8                	mov    %ecx,%eax
+  803034:	f7 e2                	mul    %edx
+  803036:	c1 ea 0c             	shr    $0xc,%edx
+  803039:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80303f:	29 d1                	sub    %edx,%ecx
+  803041:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803047:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80304e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803051:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803058:	50 80 00 
+}
+  80305b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803060:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803063:	5b                   	pop    %ebx
+  803064:	5e                   	pop    %esi
+  803065:	5d                   	pop    %ebp
+  803066:	c3                   	ret
+
+00803067 <devpipe_poll>:
+{
+  803067:	55                   	push   %ebp
+  803068:	89 e5                	mov    %esp,%ebp
+  80306a:	57                   	push   %edi
+  80306b:	56                   	push   %esi
+  80306c:	53                   	push   %ebx
+  80306d:	83 ec 18             	sub    $0x18,%esp
+  803070:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803073:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803076:	57                   	push   %edi
+  803077:	e8 bf e1 ff ff       	call   80123b <fd2data>
+  80307c:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80307e:	83 c4 10             	add    $0x10,%esp
+  803081:	89 f3                	mov    %esi,%ebx
+  803083:	83 e3 01             	and    $0x1,%ebx
+  803086:	75 27                	jne    8030af <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803088:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80308e:	75 48                	jne    8030d8 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803090:	89 ca                	mov    %ecx,%edx
+  803092:	89 f8                	mov    %edi,%eax
+  803094:	e8 ce fb ff ff       	call   802c67 <_pipeisclosed>
+  803099:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80309b:	89 d8                	mov    %ebx,%eax
+  80309d:	83 c8 10             	or     $0x10,%eax
+  8030a0:	85 d2                	test   %edx,%edx
+  8030a2:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8030a5:	89 d8                	mov    %ebx,%eax
+  8030a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030aa:	5b                   	pop    %ebx
+  8030ab:	5e                   	pop    %esi
+  8030ac:	5f                   	pop    %edi
+  8030ad:	5d                   	pop    %ebp
+  8030ae:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030af:	8b 58 04             	mov    0x4(%eax),%ebx
+  8030b2:	8b 00                	mov    (%eax),%eax
+  8030b4:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8030ba:	29 c3                	sub    %eax,%ebx
+  8030bc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030c1:	89 d8                	mov    %ebx,%eax
+  8030c3:	f7 e2                	mul    %edx
+  8030c5:	c1 ea 0c             	shr    $0xc,%edx
+  8030c8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8030ce:	39 d3                	cmp    %edx,%ebx
+  8030d0:	0f 95 c3             	setne  %bl
+  8030d3:	0f b6 db             	movzbl %bl,%ebx
+  8030d6:	eb b0                	jmp    803088 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030d8:	8b 71 04             	mov    0x4(%ecx),%esi
+  8030db:	8b 01                	mov    (%ecx),%eax
+  8030dd:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8030e3:	29 c6                	sub    %eax,%esi
+  8030e5:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030ea:	89 f0                	mov    %esi,%eax
+  8030ec:	f7 e2                	mul    %edx
+  8030ee:	c1 ea 0c             	shr    $0xc,%edx
+  8030f1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030f7:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8030f9:	89 d8                	mov    %ebx,%eax
+  8030fb:	83 c8 04             	or     $0x4,%eax
+  8030fe:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803104:	0f 42 d8             	cmovb  %eax,%ebx
+  803107:	eb 87                	jmp    803090 <devpipe_poll+0x29>
+
+00803109 <pipe>:
+{
+  803109:	55                   	push   %ebp
+  80310a:	89 e5                	mov    %esp,%ebp
+  80310c:	56                   	push   %esi
+  80310d:	53                   	push   %ebx
+  80310e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803111:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803114:	50                   	push   %eax
+  803115:	e8 38 e1 ff ff       	call   801252 <fd_alloc>
+  80311a:	89 c3                	mov    %eax,%ebx
+  80311c:	83 c4 10             	add    $0x10,%esp
+  80311f:	85 c0                	test   %eax,%eax
+  803121:	0f 88 23 01 00 00    	js     80324a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803127:	83 ec 04             	sub    $0x4,%esp
+  80312a:	68 07 04 00 00       	push   $0x407
+  80312f:	ff 75 f4             	push   -0xc(%ebp)
+  803132:	6a 00                	push   $0x0
+  803134:	e8 2b dc ff ff       	call   800d64 <sys_page_alloc>
+  803139:	89 c3                	mov    %eax,%ebx
+  80313b:	83 c4 10             	add    $0x10,%esp
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	0f 88 04 01 00 00    	js     80324a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803146:	83 ec 0c             	sub    $0xc,%esp
+  803149:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80314c:	50                   	push   %eax
+  80314d:	e8 00 e1 ff ff       	call   801252 <fd_alloc>
+  803152:	89 c3                	mov    %eax,%ebx
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	85 c0                	test   %eax,%eax
+  803159:	0f 88 db 00 00 00    	js     80323a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80315f:	83 ec 04             	sub    $0x4,%esp
+  803162:	68 07 04 00 00       	push   $0x407
+  803167:	ff 75 f0             	push   -0x10(%ebp)
+  80316a:	6a 00                	push   $0x0
+  80316c:	e8 f3 db ff ff       	call   800d64 <sys_page_alloc>
+  803171:	89 c3                	mov    %eax,%ebx
+  803173:	83 c4 10             	add    $0x10,%esp
+  803176:	85 c0                	test   %eax,%eax
+  803178:	0f 88 bc 00 00 00    	js     80323a <pipe+0x131>
+	va = fd2data(fd0);
+  80317e:	83 ec 0c             	sub    $0xc,%esp
+  803181:	ff 75 f4             	push   -0xc(%ebp)
+  803184:	e8 b2 e0 ff ff       	call   80123b <fd2data>
+  803189:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80318b:	83 c4 0c             	add    $0xc,%esp
+  80318e:	68 07 04 00 00       	push   $0x407
+  803193:	50                   	push   %eax
+  803194:	6a 00                	push   $0x0
+  803196:	e8 c9 db ff ff       	call   800d64 <sys_page_alloc>
+  80319b:	89 c3                	mov    %eax,%ebx
+  80319d:	83 c4 10             	add    $0x10,%esp
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	0f 88 82 00 00 00    	js     80322a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031a8:	83 ec 0c             	sub    $0xc,%esp
+  8031ab:	ff 75 f0             	push   -0x10(%ebp)
+  8031ae:	e8 88 e0 ff ff       	call   80123b <fd2data>
+  8031b3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8031ba:	50                   	push   %eax
+  8031bb:	6a 00                	push   $0x0
+  8031bd:	56                   	push   %esi
+  8031be:	6a 00                	push   $0x0
+  8031c0:	e8 e2 db ff ff       	call   800da7 <sys_page_map>
+  8031c5:	89 c3                	mov    %eax,%ebx
+  8031c7:	83 c4 20             	add    $0x20,%esp
+  8031ca:	85 c0                	test   %eax,%eax
+  8031cc:	78 4e                	js     80321c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031ce:	a1 60 50 80 00       	mov    0x805060,%eax
+  8031d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031d6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031d8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031db:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031e2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031e5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031ea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031f1:	83 ec 0c             	sub    $0xc,%esp
+  8031f4:	ff 75 f4             	push   -0xc(%ebp)
+  8031f7:	e8 2f e0 ff ff       	call   80122b <fd2num>
+  8031fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031ff:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803201:	83 c4 04             	add    $0x4,%esp
+  803204:	ff 75 f0             	push   -0x10(%ebp)
+  803207:	e8 1f e0 ff ff       	call   80122b <fd2num>
+  80320c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80320f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803212:	83 c4 10             	add    $0x10,%esp
+  803215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80321a:	eb 2e                	jmp    80324a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80321c:	83 ec 08             	sub    $0x8,%esp
+  80321f:	56                   	push   %esi
+  803220:	6a 00                	push   $0x0
+  803222:	e8 c2 db ff ff       	call   800de9 <sys_page_unmap>
+  803227:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80322a:	83 ec 08             	sub    $0x8,%esp
+  80322d:	ff 75 f0             	push   -0x10(%ebp)
+  803230:	6a 00                	push   $0x0
+  803232:	e8 b2 db ff ff       	call   800de9 <sys_page_unmap>
+  803237:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80323a:	83 ec 08             	sub    $0x8,%esp
+  80323d:	ff 75 f4             	push   -0xc(%ebp)
+  803240:	6a 00                	push   $0x0
+  803242:	e8 a2 db ff ff       	call   800de9 <sys_page_unmap>
+  803247:	83 c4 10             	add    $0x10,%esp
+}
+  80324a:	89 d8                	mov    %ebx,%eax
+  80324c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80324f:	5b                   	pop    %ebx
+  803250:	5e                   	pop    %esi
+  803251:	5d                   	pop    %ebp
+  803252:	c3                   	ret
+
+00803253 <pipeisclosed>:
+{
+  803253:	55                   	push   %ebp
+  803254:	89 e5                	mov    %esp,%ebp
+  803256:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803259:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80325c:	50                   	push   %eax
+  80325d:	ff 75 08             	push   0x8(%ebp)
+  803260:	e8 3d e0 ff ff       	call   8012a2 <fd_lookup>
+  803265:	83 c4 10             	add    $0x10,%esp
+  803268:	85 c0                	test   %eax,%eax
+  80326a:	78 18                	js     803284 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80326c:	83 ec 0c             	sub    $0xc,%esp
+  80326f:	ff 75 f4             	push   -0xc(%ebp)
+  803272:	e8 c4 df ff ff       	call   80123b <fd2data>
+  803277:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803279:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80327c:	e8 e6 f9 ff ff       	call   802c67 <_pipeisclosed>
+  803281:	83 c4 10             	add    $0x10,%esp
+}
+  803284:	c9                   	leave
+  803285:	c3                   	ret
+
+00803286 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803286:	55                   	push   %ebp
+  803287:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803289:	8b 45 08             	mov    0x8(%ebp),%eax
+  80328c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803292:	5d                   	pop    %ebp
+  803293:	c3                   	ret
+
+00803294 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803294:	55                   	push   %ebp
+  803295:	89 e5                	mov    %esp,%ebp
+  803297:	53                   	push   %ebx
+  803298:	83 ec 04             	sub    $0x4,%esp
+  80329b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80329e:	8b 03                	mov    (%ebx),%eax
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	75 05                	jne    8032a9 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8032a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a7:	c9                   	leave
+  8032a8:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8032a9:	83 ec 08             	sub    $0x8,%esp
+  8032ac:	50                   	push   %eax
+  8032ad:	8d 43 04             	lea    0x4(%ebx),%eax
+  8032b0:	50                   	push   %eax
+  8032b1:	e8 83 dd ff ff       	call   801039 <sys_page_batch>
+	pb->pb_n = 0;
+  8032b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8032bc:	83 c4 10             	add    $0x10,%esp
+  8032bf:	eb e3                	jmp    8032a4 <pgbatch_flush+0x10>
+
+008032c1 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8032c1:	55                   	push   %ebp
+  8032c2:	89 e5                	mov    %esp,%ebp
+  8032c4:	56                   	push   %esi
+  8032c5:	53                   	push   %ebx
+  8032c6:	89 c3                	mov    %eax,%ebx
+  8032c8:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032ca:	83 38 20             	cmpl   $0x20,(%eax)
+  8032cd:	74 2c                	je     8032fb <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8032cf:	8b 03                	mov    (%ebx),%eax
+  8032d1:	8d 50 01             	lea    0x1(%eax),%edx
+  8032d4:	89 13                	mov    %edx,(%ebx)
+  8032d6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8032d9:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8032dd:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8032df:	83 ec 04             	sub    $0x4,%esp
+  8032e2:	6a 18                	push   $0x18
+  8032e4:	6a 00                	push   $0x0
+  8032e6:	50                   	push   %eax
+  8032e7:	e8 bf d7 ff ff       	call   800aab <memset>
+	return 0;
+  8032ec:	83 c4 10             	add    $0x10,%esp
+  8032ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032f7:	5b                   	pop    %ebx
+  8032f8:	5e                   	pop    %esi
+  8032f9:	5d                   	pop    %ebp
+  8032fa:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032fb:	83 ec 0c             	sub    $0xc,%esp
+  8032fe:	50                   	push   %eax
+  8032ff:	e8 90 ff ff ff       	call   803294 <pgbatch_flush>
+  803304:	83 c4 10             	add    $0x10,%esp
+  803307:	85 c0                	test   %eax,%eax
+  803309:	79 c4                	jns    8032cf <pgbatch_slot+0xe>
+  80330b:	eb e7                	jmp    8032f4 <pgbatch_slot+0x33>
+
+0080330d <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80330d:	55                   	push   %ebp
+  80330e:	89 e5                	mov    %esp,%ebp
+  803310:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803313:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803316:	8b 45 08             	mov    0x8(%ebp),%eax
+  803319:	e8 a3 ff ff ff       	call   8032c1 <pgbatch_slot>
+  80331e:	85 c0                	test   %eax,%eax
+  803320:	78 20                	js     803342 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803322:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803325:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80332b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80332e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803331:	8b 55 10             	mov    0x10(%ebp),%edx
+  803334:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803337:	8b 55 14             	mov    0x14(%ebp),%edx
+  80333a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80333d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803342:	c9                   	leave
+  803343:	c3                   	ret
+
+00803344 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803344:	55                   	push   %ebp
+  803345:	89 e5                	mov    %esp,%ebp
+  803347:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80334a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80334d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803350:	e8 6c ff ff ff       	call   8032c1 <pgbatch_slot>
+  803355:	85 c0                	test   %eax,%eax
+  803357:	78 2c                	js     803385 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80335c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803362:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803365:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803368:	8b 55 10             	mov    0x10(%ebp),%edx
+  80336b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80336e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803371:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803374:	8b 55 18             	mov    0x18(%ebp),%edx
+  803377:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80337a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80337d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803380:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803385:	c9                   	leave
+  803386:	c3                   	ret
+
+00803387 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803387:	55                   	push   %ebp
+  803388:	89 e5                	mov    %esp,%ebp
+  80338a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80338d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803390:	8b 45 08             	mov    0x8(%ebp),%eax
+  803393:	e8 29 ff ff ff       	call   8032c1 <pgbatch_slot>
+  803398:	85 c0                	test   %eax,%eax
+  80339a:	78 1a                	js     8033b6 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80339c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80339f:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8033a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033a8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033ab:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033ae:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8033b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033b6:	c9                   	leave
+  8033b7:	c3                   	ret
+
+008033b8 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8033b8:	55                   	push   %ebp
+  8033b9:	89 e5                	mov    %esp,%ebp
+  8033bb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033be:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c4:	e8 f8 fe ff ff       	call   8032c1 <pgbatch_slot>
+  8033c9:	85 c0                	test   %eax,%eax
+  8033cb:	78 20                	js     8033ed <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8033cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033d0:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8033d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033d9:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033dc:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033df:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8033e2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033e5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ed:	c9                   	leave
+  8033ee:	c3                   	ret
+
+008033ef <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8033ef:	55                   	push   %ebp
+  8033f0:	89 e5                	mov    %esp,%ebp
+  8033f2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033f5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033fb:	e8 c1 fe ff ff       	call   8032c1 <pgbatch_slot>
+  803400:	85 c0                	test   %eax,%eax
+  803402:	78 26                	js     80342a <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803404:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803407:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80340d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803410:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803413:	8b 55 10             	mov    0x10(%ebp),%edx
+  803416:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803419:	8b 55 14             	mov    0x14(%ebp),%edx
+  80341c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80341f:	8b 55 18             	mov    0x18(%ebp),%edx
+  803422:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803425:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80342a:	c9                   	leave
+  80342b:	c3                   	ret
+
+0080342c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80342c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803431:	c3                   	ret
+
+00803432 <devcons_poll>:
+{
+  803432:	55                   	push   %ebp
+  803433:	89 e5                	mov    %esp,%ebp
+  803435:	53                   	push   %ebx
+  803436:	83 ec 04             	sub    $0x4,%esp
+  803439:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80343c:	89 da                	mov    %ebx,%edx
+  80343e:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803441:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803448:	74 0c                	je     803456 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80344a:	89 d8                	mov    %ebx,%eax
+  80344c:	83 e0 01             	and    $0x1,%eax
+  80344f:	09 d0                	or     %edx,%eax
+}
+  803451:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803454:	c9                   	leave
+  803455:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803456:	e8 6b d8 ff ff       	call   800cc6 <sys_cgetc>
+  80345b:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803460:	89 da                	mov    %ebx,%edx
+  803462:	83 e2 04             	and    $0x4,%edx
+  803465:	85 c0                	test   %eax,%eax
+  803467:	74 e6                	je     80344f <devcons_poll+0x1d>
+  803469:	eb df                	jmp    80344a <devcons_poll+0x18>
+
+0080346b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80346b:	55                   	push   %ebp
+  80346c:	89 e5                	mov    %esp,%ebp
+  80346e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803471:	68 5e 40 80 00       	push   $0x80405e
+  803476:	ff 75 0c             	push   0xc(%ebp)
+  803479:	e8 b2 d4 ff ff       	call   800930 <strcpy>
+	return 0;
+}
+  80347e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803483:	c9                   	leave
+  803484:	c3                   	ret
+
+00803485 <devcons_write>:
+{
+  803485:	55                   	push   %ebp
+  803486:	89 e5                	mov    %esp,%ebp
+  803488:	57                   	push   %edi
+  803489:	56                   	push   %esi
+  80348a:	53                   	push   %ebx
+  80348b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803491:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803494:	85 ff                	test   %edi,%edi
+  803496:	74 51                	je     8034e9 <devcons_write+0x64>
+  803498:	be 00 00 00 00       	mov    $0x0,%esi
+  80349d:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8034a2:	89 fb                	mov    %edi,%ebx
+  8034a4:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8034a6:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8034ab:	39 d3                	cmp    %edx,%ebx
+  8034ad:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8034b0:	83 ec 04             	sub    $0x4,%esp
+  8034b3:	53                   	push   %ebx
+  8034b4:	03 45 0c             	add    0xc(%ebp),%eax
+  8034b7:	50                   	push   %eax
+  8034b8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034be:	50                   	push   %eax
+  8034bf:	e8 1c d6 ff ff       	call   800ae0 <memmove>
+		sys_cputs(buf, m);
+  8034c4:	83 c4 08             	add    $0x8,%esp
+  8034c7:	53                   	push   %ebx
+  8034c8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034ce:	50                   	push   %eax
+  8034cf:	e8 d4 d7 ff ff       	call   800ca8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8034d4:	01 de                	add    %ebx,%esi
+  8034d6:	89 f0                	mov    %esi,%eax
+  8034d8:	83 c4 10             	add    $0x10,%esp
+  8034db:	39 fe                	cmp    %edi,%esi
+  8034dd:	72 c3                	jb     8034a2 <devcons_write+0x1d>
+}
+  8034df:	89 f0                	mov    %esi,%eax
+  8034e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034e4:	5b                   	pop    %ebx
+  8034e5:	5e                   	pop    %esi
+  8034e6:	5f                   	pop    %edi
+  8034e7:	5d                   	pop    %ebp
+  8034e8:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8034e9:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8034ee:	eb ef                	jmp    8034df <devcons_write+0x5a>
+
+008034f0 <devcons_read>:
+{
+  8034f0:	55                   	push   %ebp
+  8034f1:	89 e5                	mov    %esp,%ebp
+  8034f3:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8034f6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8034fb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034ff:	74 36                	je     803537 <devcons_read+0x47>
+	c = cons_peek;
+  803501:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  803506:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  80350d:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803510:	85 c0                	test   %eax,%eax
+  803512:	75 10                	jne    803524 <devcons_read+0x34>
+  803514:	e8 ad d7 ff ff       	call   800cc6 <sys_cgetc>
+  803519:	85 c0                	test   %eax,%eax
+  80351b:	75 07                	jne    803524 <devcons_read+0x34>
+		sys_yield();
+  80351d:	e8 23 d8 ff ff       	call   800d45 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803522:	eb f0                	jmp    803514 <devcons_read+0x24>
+	if (c < 0)
+  803524:	85 c0                	test   %eax,%eax
+  803526:	78 0f                	js     803537 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803528:	83 f8 04             	cmp    $0x4,%eax
+  80352b:	74 0c                	je     803539 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80352d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803530:	88 02                	mov    %al,(%edx)
+	return 1;
+  803532:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803537:	c9                   	leave
+  803538:	c3                   	ret
+		return 0;
+  803539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353e:	eb f7                	jmp    803537 <devcons_read+0x47>
+
+00803540 <cputchar>:
+{
+  803540:	55                   	push   %ebp
+  803541:	89 e5                	mov    %esp,%ebp
+  803543:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803546:	8b 45 08             	mov    0x8(%ebp),%eax
+  803549:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80354c:	6a 01                	push   $0x1
+  80354e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803551:	50                   	push   %eax
+  803552:	e8 51 d7 ff ff       	call   800ca8 <sys_cputs>
+}
+  803557:	83 c4 10             	add    $0x10,%esp
+  80355a:	c9                   	leave
+  80355b:	c3                   	ret
+
+0080355c <getchar>:
+{
+  80355c:	55                   	push   %ebp
+  80355d:	89 e5                	mov    %esp,%ebp
+  80355f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803562:	6a 01                	push   $0x1
+  803564:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803567:	50                   	push   %eax
+  803568:	6a 00                	push   $0x0
+  80356a:	e8 b7 df ff ff       	call   801526 <read>
+	if (r < 0)
+  80356f:	83 c4 10             	add    $0x10,%esp
+  803572:	85 c0                	test   %eax,%eax
+  803574:	78 06                	js     80357c <getchar+0x20>
+	if (r < 1)
+  803576:	74 06                	je     80357e <getchar+0x22>
+	return c;
+  803578:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80357c:	c9                   	leave
+  80357d:	c3                   	ret
+		return -E_EOF;
+  80357e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803583:	eb f7                	jmp    80357c <getchar+0x20>
+
+00803585 <iscons>:
+{
+  803585:	55                   	push   %ebp
+  803586:	89 e5                	mov    %esp,%ebp
+  803588:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80358b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80358e:	50                   	push   %eax
+  80358f:	ff 75 08             	push   0x8(%ebp)
+  803592:	e8 0b dd ff ff       	call   8012a2 <fd_lookup>
+  803597:	83 c4 10             	add    $0x10,%esp
+  80359a:	85 c0                	test   %eax,%eax
+  80359c:	78 11                	js     8035af <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80359e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035a1:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035a7:	39 10                	cmp    %edx,(%eax)
+  8035a9:	0f 94 c0             	sete   %al
+  8035ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8035af:	c9                   	leave
+  8035b0:	c3                   	ret
+
+008035b1 <opencons>:
+{
+  8035b1:	55                   	push   %ebp
+  8035b2:	89 e5                	mov    %esp,%ebp
+  8035b4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8035b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035ba:	50                   	push   %eax
+  8035bb:	e8 92 dc ff ff       	call   801252 <fd_alloc>
+  8035c0:	83 c4 10             	add    $0x10,%esp
+  8035c3:	85 c0                	test   %eax,%eax
+  8035c5:	78 3a                	js     803601 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8035c7:	83 ec 04             	sub    $0x4,%esp
+  8035ca:	68 07 04 00 00       	push   $0x407
+  8035cf:	ff 75 f4             	push   -0xc(%ebp)
+  8035d2:	6a 00                	push   $0x0
+  8035d4:	e8 8b d7 ff ff       	call   800d64 <sys_page_alloc>
+  8035d9:	83 c4 10             	add    $0x10,%esp
+  8035dc:	85 c0                	test   %eax,%eax
+  8035de:	78 21                	js     803601 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8035e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035e3:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035e9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8035eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035ee:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8035f5:	83 ec 0c             	sub    $0xc,%esp
+  8035f8:	50                   	push   %eax
+  8035f9:	e8 2d dc ff ff       	call   80122b <fd2num>
+  8035fe:	83 c4 10             	add    $0x10,%esp
+}
+  803601:	c9                   	leave
+  803602:	c3                   	ret
+
+00803603 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803603:	55                   	push   %ebp
+  803604:	89 e5                	mov    %esp,%ebp
+  803606:	56                   	push   %esi
+  803607:	53                   	push   %ebx
+  803608:	8b 75 08             	mov    0x8(%ebp),%esi
+  80360b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80360e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803611:	85 c0                	test   %eax,%eax
+  803613:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803618:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80361b:	83 ec 0c             	sub    $0xc,%esp
+  80361e:	50                   	push   %eax
+  80361f:	e8 f0 d8 ff ff       	call   800f14 <sys_ipc_recv>
+  803624:	83 c4 10             	add    $0x10,%esp
+  803627:	85 c0                	test   %eax,%eax
+  803629:	0f 88 8b 00 00 00    	js     8036ba <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80362f:	85 f6                	test   %esi,%esi
+  803631:	74 2a                	je     80365d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803633:	89 e2                	mov    %esp,%edx
+  803635:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80363a:	29 d0                	sub    %edx,%eax
+  80363c:	89 c2                	mov    %eax,%edx
+  80363e:	c1 ea 0f             	shr    $0xf,%edx
+  803641:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80364e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803655:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80365b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80365d:	85 db                	test   %ebx,%ebx
+  80365f:	74 2a                	je     80368b <ipc_recv+0x88>
+  803661:	89 e2                	mov    %esp,%edx
+  803663:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803668:	29 d0                	sub    %edx,%eax
+  80366a:	89 c2                	mov    %eax,%edx
+  80366c:	c1 ea 0f             	shr    $0xf,%edx
+  80366f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803674:	b8 00 00 00 00       	mov    $0x0,%eax
+  803679:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80367c:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803683:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803689:	89 03                	mov    %eax,(%ebx)
+  80368b:	89 e2                	mov    %esp,%edx
+  80368d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803692:	29 d0                	sub    %edx,%eax
+  803694:	89 c2                	mov    %eax,%edx
+  803696:	c1 ea 0f             	shr    $0xf,%edx
+  803699:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a3:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036a6:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8036ad:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8036b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036b6:	5b                   	pop    %ebx
+  8036b7:	5e                   	pop    %esi
+  8036b8:	5d                   	pop    %ebp
+  8036b9:	c3                   	ret
+		if(from_env_store != NULL)
+  8036ba:	85 f6                	test   %esi,%esi
+  8036bc:	74 06                	je     8036c4 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8036be:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8036c4:	85 db                	test   %ebx,%ebx
+  8036c6:	74 eb                	je     8036b3 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8036c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036ce:	eb e3                	jmp    8036b3 <ipc_recv+0xb0>
+
+008036d0 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8036d0:	55                   	push   %ebp
+  8036d1:	89 e5                	mov    %esp,%ebp
+  8036d3:	57                   	push   %edi
+  8036d4:	56                   	push   %esi
+  8036d5:	53                   	push   %ebx
+  8036d6:	83 ec 14             	sub    $0x14,%esp
+  8036d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036df:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036e2:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8036e5:	85 c0                	test   %eax,%eax
+  8036e7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036ec:	0f 44 c2             	cmove  %edx,%eax
+  8036ef:	ff 75 10             	push   0x10(%ebp)
+  8036f2:	50                   	push   %eax
+  8036f3:	e8 7e d8 ff ff       	call   800f76 <sys_ipc_recv_pages>
+  8036f8:	83 c4 10             	add    $0x10,%esp
+  8036fb:	85 c0                	test   %eax,%eax
+  8036fd:	0f 88 ba 00 00 00    	js     8037bd <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803703:	85 ff                	test   %edi,%edi
+  803705:	74 2a                	je     803731 <ipc_recv_pages+0x61>
+  803707:	89 e2                	mov    %esp,%edx
+  803709:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80370e:	29 d0                	sub    %edx,%eax
+  803710:	89 c2                	mov    %eax,%edx
+  803712:	c1 ea 0f             	shr    $0xf,%edx
+  803715:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80371a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371f:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803722:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803729:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80372f:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803731:	85 f6                	test   %esi,%esi
+  803733:	74 2a                	je     80375f <ipc_recv_pages+0x8f>
+  803735:	89 e2                	mov    %esp,%edx
+  803737:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80373c:	29 d0                	sub    %edx,%eax
+  80373e:	89 c2                	mov    %eax,%edx
+  803740:	c1 ea 0f             	shr    $0xf,%edx
+  803743:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803750:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803757:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80375d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80375f:	85 db                	test   %ebx,%ebx
+  803761:	74 2a                	je     80378d <ipc_recv_pages+0xbd>
+  803763:	89 e2                	mov    %esp,%edx
+  803765:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80376a:	29 d0                	sub    %edx,%eax
+  80376c:	89 c2                	mov    %eax,%edx
+  80376e:	c1 ea 0f             	shr    $0xf,%edx
+  803771:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377b:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80377e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803785:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80378b:	89 03                	mov    %eax,(%ebx)
+  80378d:	89 e2                	mov    %esp,%edx
+  80378f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803794:	29 d0                	sub    %edx,%eax
+  803796:	89 c2                	mov    %eax,%edx
+  803798:	c1 ea 0f             	shr    $0xf,%edx
+  80379b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a5:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8037a8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037af:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8037b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b8:	5b                   	pop    %ebx
+  8037b9:	5e                   	pop    %esi
+  8037ba:	5f                   	pop    %edi
+  8037bb:	5d                   	pop    %ebp
+  8037bc:	c3                   	ret
+		if (from_env_store)
+  8037bd:	85 ff                	test   %edi,%edi
+  8037bf:	74 06                	je     8037c7 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8037c1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8037c7:	85 f6                	test   %esi,%esi
+  8037c9:	74 06                	je     8037d1 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8037cb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8037d1:	85 db                	test   %ebx,%ebx
+  8037d3:	74 e0                	je     8037b5 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8037d5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037db:	eb d8                	jmp    8037b5 <ipc_recv_pages+0xe5>
+
+008037dd <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8037dd:	55                   	push   %ebp
+  8037de:	89 e5                	mov    %esp,%ebp
+  8037e0:	57                   	push   %edi
+  8037e1:	56                   	push   %esi
+  8037e2:	53                   	push   %ebx
+  8037e3:	83 ec 1c             	sub    $0x1c,%esp
+  8037e6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8037e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037ec:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037f2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8037f6:	75 2b                	jne    803823 <ipc_try_send_pages+0x46>
+  8037f8:	89 e2                	mov    %esp,%edx
+  8037fa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037ff:	29 d0                	sub    %edx,%eax
+  803801:	89 c2                	mov    %eax,%edx
+  803803:	c1 ea 0f             	shr    $0xf,%edx
+  803806:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80380b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803810:	0f 42 c2             	cmovb  %edx,%eax
+  803813:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80381a:	8b 70 48             	mov    0x48(%eax),%esi
+  80381d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803823:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803829:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80382e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803831:	85 ff                	test   %edi,%edi
+  803833:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803838:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80383b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803841:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803847:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80384d:	83 ec 0c             	sub    $0xc,%esp
+  803850:	ff 75 14             	push   0x14(%ebp)
+  803853:	ff 75 18             	push   0x18(%ebp)
+  803856:	57                   	push   %edi
+  803857:	ff 75 0c             	push   0xc(%ebp)
+  80385a:	ff 75 08             	push   0x8(%ebp)
+  80385d:	e8 f3 d6 ff ff       	call   800f55 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803862:	83 c4 20             	add    $0x20,%esp
+  803865:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803868:	75 21                	jne    80388b <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80386a:	83 ec 04             	sub    $0x4,%esp
+  80386d:	6a ff                	push   $0xffffffff
+  80386f:	53                   	push   %ebx
+  803870:	ff 75 e4             	push   -0x1c(%ebp)
+  803873:	e8 ea d8 ff ff       	call   801162 <sys_futex_wait>
+  803878:	83 c4 10             	add    $0x10,%esp
+  80387b:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80387e:	74 c7                	je     803847 <ipc_try_send_pages+0x6a>
+  803880:	85 c0                	test   %eax,%eax
+  803882:	79 c3                	jns    803847 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803884:	e8 bc d4 ff ff       	call   800d45 <sys_yield>
+  803889:	eb bc                	jmp    803847 <ipc_try_send_pages+0x6a>
+	}
+}
+  80388b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80388e:	5b                   	pop    %ebx
+  80388f:	5e                   	pop    %esi
+  803890:	5f                   	pop    %edi
+  803891:	5d                   	pop    %ebp
+  803892:	c3                   	ret
+
+00803893 <ipc_send>:
+{
+  803893:	55                   	push   %ebp
+  803894:	89 e5                	mov    %esp,%ebp
+  803896:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803899:	ff 75 14             	push   0x14(%ebp)
+  80389c:	6a 01                	push   $0x1
+  80389e:	ff 75 10             	push   0x10(%ebp)
+  8038a1:	ff 75 0c             	push   0xc(%ebp)
+  8038a4:	ff 75 08             	push   0x8(%ebp)
+  8038a7:	e8 31 ff ff ff       	call   8037dd <ipc_try_send_pages>
+  8038ac:	83 c4 20             	add    $0x20,%esp
+  8038af:	85 c0                	test   %eax,%eax
+  8038b1:	78 02                	js     8038b5 <ipc_send+0x22>
+}
+  8038b3:	c9                   	leave
+  8038b4:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8038b5:	50                   	push   %eax
+  8038b6:	68 6a 40 80 00       	push   $0x80406a
+  8038bb:	6a 3f                	push   $0x3f
+  8038bd:	68 7f 40 80 00       	push   $0x80407f
+  8038c2:	e8 97 c8 ff ff       	call   80015e <_panic>
+
+008038c7 <ipc_send_pages>:
+{
+  8038c7:	55                   	push   %ebp
+  8038c8:	89 e5                	mov    %esp,%ebp
+  8038ca:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8038cd:	ff 75 18             	push   0x18(%ebp)
+  8038d0:	ff 75 14             	push   0x14(%ebp)
+  8038d3:	ff 75 10             	push   0x10(%ebp)
+  8038d6:	ff 75 0c             	push   0xc(%ebp)
+  8038d9:	ff 75 08             	push   0x8(%ebp)
+  8038dc:	e8 fc fe ff ff       	call   8037dd <ipc_try_send_pages>
+  8038e1:	83 c4 20             	add    $0x20,%esp
+  8038e4:	85 c0                	test   %eax,%eax
+  8038e6:	78 02                	js     8038ea <ipc_send_pages+0x23>
+}
+  8038e8:	c9                   	leave
+  8038e9:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8038ea:	50                   	push   %eax
+  8038eb:	68 89 40 80 00       	push   $0x804089
+  8038f0:	6a 64                	push   $0x64
+  8038f2:	68 7f 40 80 00       	push   $0x80407f
+  8038f7:	e8 62 c8 ff ff       	call   80015e <_panic>
+
+008038fc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8038fc:	55                   	push   %ebp
+  8038fd:	89 e5                	mov    %esp,%ebp
+  8038ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803902:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803907:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80390d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803913:	8b 52 50             	mov    0x50(%edx),%edx
+  803916:	39 ca                	cmp    %ecx,%edx
+  803918:	74 11                	je     80392b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80391a:	83 c0 01             	add    $0x1,%eax
+  80391d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803922:	75 e3                	jne    803907 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803924:	b8 00 00 00 00       	mov    $0x0,%eax
+  803929:	eb 0e                	jmp    803939 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80392b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803931:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803936:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803939:	5d                   	pop    %ebp
+  80393a:	c3                   	ret
+
+0080393b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80393b:	55                   	push   %ebp
+  80393c:	89 e5                	mov    %esp,%ebp
+  80393e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803941:	89 c2                	mov    %eax,%edx
+  803943:	c1 ea 16             	shr    $0x16,%edx
+  803946:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80394d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803952:	f6 c1 01             	test   $0x1,%cl
+  803955:	74 1e                	je     803975 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803957:	c1 e8 0c             	shr    $0xc,%eax
+  80395a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803961:	a8 01                	test   $0x1,%al
+  803963:	74 10                	je     803975 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803965:	c1 e8 0c             	shr    $0xc,%eax
+  803968:	c1 e0 04             	shl    $0x4,%eax
+  80396b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803972:	0f b7 d2             	movzwl %dx,%edx
+}
+  803975:	89 d0                	mov    %edx,%eax
+  803977:	5d                   	pop    %ebp
+  803978:	c3                   	ret
+
+00803979 <__udivdi3>:
+  803979:	57                   	push   %edi
+  80397a:	56                   	push   %esi
+  80397b:	53                   	push   %ebx
+  80397c:	83 ec 20             	sub    $0x20,%esp
+  80397f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803983:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803987:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80398b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80398f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803993:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803997:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80399b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80399f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039ae:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8039b5:	00 
+  8039b6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8039bd:	00 
+  8039be:	eb 08                	jmp    8039c8 <__udivdi3+0x4f>
+  8039c0:	83 e9 01             	sub    $0x1,%ecx
+  8039c3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039c6:	74 68                	je     803a30 <__udivdi3+0xb7>
+  8039c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8039cc:	01 c0                	add    %eax,%eax
+  8039ce:	89 c6                	mov    %eax,%esi
+  8039d0:	89 d7                	mov    %edx,%edi
+  8039d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039dd:	d3 ea                	shr    %cl,%edx
+  8039df:	f6 c1 20             	test   $0x20,%cl
+  8039e2:	74 04                	je     8039e8 <__udivdi3+0x6f>
+  8039e4:	89 d0                	mov    %edx,%eax
+  8039e6:	31 d2                	xor    %edx,%edx
+  8039e8:	83 e0 01             	and    $0x1,%eax
+  8039eb:	89 04 24             	mov    %eax,(%esp)
+  8039ee:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8039f5:	00 
+  8039f6:	8b 04 24             	mov    (%esp),%eax
+  8039f9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039fd:	09 f0                	or     %esi,%eax
+  8039ff:	09 fa                	or     %edi,%edx
+  803a01:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803a05:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803a09:	39 f0                	cmp    %esi,%eax
+  803a0b:	89 d3                	mov    %edx,%ebx
+  803a0d:	19 fb                	sbb    %edi,%ebx
+  803a0f:	72 af                	jb     8039c0 <__udivdi3+0x47>
+  803a11:	29 f0                	sub    %esi,%eax
+  803a13:	19 fa                	sbb    %edi,%edx
+  803a15:	89 cf                	mov    %ecx,%edi
+  803a17:	c1 ef 05             	shr    $0x5,%edi
+  803a1a:	83 e7 01             	and    $0x1,%edi
+  803a1d:	89 fe                	mov    %edi,%esi
+  803a1f:	83 f6 01             	xor    $0x1,%esi
+  803a22:	d3 e6                	shl    %cl,%esi
+  803a24:	d3 e7                	shl    %cl,%edi
+  803a26:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a2a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a2e:	eb 90                	jmp    8039c0 <__udivdi3+0x47>
+  803a30:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a34:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a38:	83 c4 20             	add    $0x20,%esp
+  803a3b:	5b                   	pop    %ebx
+  803a3c:	5e                   	pop    %esi
+  803a3d:	5f                   	pop    %edi
+  803a3e:	c3                   	ret
+
+00803a3f <__umoddi3>:
+  803a3f:	57                   	push   %edi
+  803a40:	56                   	push   %esi
+  803a41:	53                   	push   %ebx
+  803a42:	83 ec 08             	sub    $0x8,%esp
+  803a45:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a49:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a4d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a51:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a55:	57                   	push   %edi
+  803a56:	56                   	push   %esi
+  803a57:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a5b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a5f:	52                   	push   %edx
+  803a60:	50                   	push   %eax
+  803a61:	e8 13 ff ff ff       	call   803979 <__udivdi3>
+  803a66:	89 c3                	mov    %eax,%ebx
+  803a68:	0f af d6             	imul   %esi,%edx
+  803a6b:	89 f9                	mov    %edi,%ecx
+  803a6d:	0f af cb             	imul   %ebx,%ecx
+  803a70:	01 d1                	add    %edx,%ecx
+  803a72:	89 d8                	mov    %ebx,%eax
+  803a74:	f7 e6                	mul    %esi
+  803a76:	89 c6                	mov    %eax,%esi
+  803a78:	89 d7                	mov    %edx,%edi
+  803a7a:	01 cf                	add    %ecx,%edi
+  803a7c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a80:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a84:	29 f0                	sub    %esi,%eax
+  803a86:	19 fa                	sbb    %edi,%edx
+  803a88:	83 c4 18             	add    $0x18,%esp
+  803a8b:	5b                   	pop    %ebx
+  803a8c:	5e                   	pop    %esi
+  803a8d:	5f                   	pop    %edi
+  803a8e:	c3                   	ret
+
+00803a8f <__divdi3>:
+  803a8f:	53                   	push   %ebx
+  803a90:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a94:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a98:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a9c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803aa0:	85 d2                	test   %edx,%edx
+  803aa2:	78 12                	js     803ab6 <__divdi3+0x27>
+  803aa4:	85 db                	test   %ebx,%ebx
+  803aa6:	78 2e                	js     803ad6 <__divdi3+0x47>
+  803aa8:	53                   	push   %ebx
+  803aa9:	51                   	push   %ecx
+  803aaa:	52                   	push   %edx
+  803aab:	50                   	push   %eax
+  803aac:	e8 c8 fe ff ff       	call   803979 <__udivdi3>
+  803ab1:	83 c4 10             	add    $0x10,%esp
+  803ab4:	eb 1e                	jmp    803ad4 <__divdi3+0x45>
+  803ab6:	f7 d8                	neg    %eax
+  803ab8:	83 d2 00             	adc    $0x0,%edx
+  803abb:	f7 da                	neg    %edx
+  803abd:	85 db                	test   %ebx,%ebx
+  803abf:	78 2a                	js     803aeb <__divdi3+0x5c>
+  803ac1:	53                   	push   %ebx
+  803ac2:	51                   	push   %ecx
+  803ac3:	52                   	push   %edx
+  803ac4:	50                   	push   %eax
+  803ac5:	e8 af fe ff ff       	call   803979 <__udivdi3>
+  803aca:	83 c4 10             	add    $0x10,%esp
+  803acd:	f7 d8                	neg    %eax
+  803acf:	83 d2 00             	adc    $0x0,%edx
+  803ad2:	f7 da                	neg    %edx
+  803ad4:	5b                   	pop    %ebx
+  803ad5:	c3                   	ret
+  803ad6:	f7 d9                	neg    %ecx
+  803ad8:	83 d3 00             	adc    $0x0,%ebx
+  803adb:	f7 db                	neg    %ebx
+  803add:	53                   	push   %ebx
+  803ade:	51                   	push   %ecx
+  803adf:	52                   	push   %edx
+  803ae0:	50                   	push   %eax
+  803ae1:	e8 93 fe ff ff       	call   803979 <__udivdi3>
+  803ae6:	83 c4 10             	add    $0x10,%esp
+  803ae9:	eb e2                	jmp    803acd <__divdi3+0x3e>
+  803aeb:	f7 d9                	neg    %ecx
+  803aed:	83 d3 00             	adc    $0x0,%ebx
+  803af0:	f7 db                	neg    %ebx
+  803af2:	53                   	push   %ebx
+  803af3:	51                   	push   %ecx
+  803af4:	52                   	push   %edx
+  803af5:	50                   	push   %eax
+  803af6:	e8 7e fe ff ff       	call   803979 <__udivdi3>
+  803afb:	83 c4 10             	add    $0x10,%esp
+  803afe:	eb d4                	jmp    803ad4 <__divdi3+0x45>
+
+00803b00 <__moddi3>:
+  803b00:	57                   	push   %edi
+  803b01:	56                   	push   %esi
+  803b02:	53                   	push   %ebx
+  803b03:	83 ec 08             	sub    $0x8,%esp
+  803b06:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b0a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b0e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803b12:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803b16:	57                   	push   %edi
+  803b17:	56                   	push   %esi
+  803b18:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b1c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b20:	52                   	push   %edx
+  803b21:	50                   	push   %eax
+  803b22:	e8 68 ff ff ff       	call   803a8f <__divdi3>
+  803b27:	89 c3                	mov    %eax,%ebx
+  803b29:	0f af d6             	imul   %esi,%edx
+  803b2c:	89 f9                	mov    %edi,%ecx
+  803b2e:	0f af cb             	imul   %ebx,%ecx
+  803b31:	01 d1                	add    %edx,%ecx
+  803b33:	89 d8                	mov    %ebx,%eax
+  803b35:	f7 e6                	mul    %esi
+  803b37:	89 c6                	mov    %eax,%esi
+  803b39:	89 d7                	mov    %edx,%edi
+  803b3b:	01 cf                	add    %ecx,%edi
+  803b3d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b41:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b45:	29 f0                	sub    %esi,%eax
+  803b47:	19 fa                	sbb    %edi,%edx
+  803b49:	83 c4 18             	add    $0x18,%esp
+  803b4c:	5b                   	pop    %ebx
+  803b4d:	5e                   	pop    %esi
+  803b4e:	5f                   	pop    %edi
+  803b4f:	c3                   	ret
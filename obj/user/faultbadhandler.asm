@@ -0,0 +1,7870 @@
+
+obj/user/faultbadhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 36 00 00 00       	call   800067 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 0c             	sub    $0xc,%esp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  80003b:	6a 07                	push   $0x7
+  80003d:	68 00 f0 bf ee       	push   $0xeebff000
+  800042:	6a 00                	push   $0x0
+  800044:	e8 81 01 00 00       	call   8001ca <sys_page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xDeadBeef);
+  800049:	83 c4 08             	add    $0x8,%esp
+  80004c:	68 ef be ad de       	push   $0xdeadbeef
+  800051:	6a 00                	push   $0x0
+  800053:	e8 bd 02 00 00       	call   800315 <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800058:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005f:	00 00 00 
+}
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	c9                   	leave
+  800066:	c3                   	ret
+
+00800067 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800067:	55                   	push   %ebp
+  800068:	89 e5                	mov    %esp,%ebp
+  80006a:	56                   	push   %esi
+  80006b:	53                   	push   %ebx
+  80006c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006f:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800072:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800074:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800079:	29 d0                	sub    %edx,%eax
+  80007b:	89 c2                	mov    %eax,%edx
+  80007d:	c1 ea 0f             	shr    $0xf,%edx
+  800080:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80008d:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800094:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800098:	e8 ef 00 00 00       	call   80018c <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80009d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a2:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8000a8:	89 e1                	mov    %esp,%ecx
+  8000aa:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8000af:	29 ca                	sub    %ecx,%edx
+  8000b1:	89 d1                	mov    %edx,%ecx
+  8000b3:	c1 e9 0f             	shr    $0xf,%ecx
+  8000b6:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c1:	0f 42 d1             	cmovb  %ecx,%edx
+  8000c4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c9:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000d0:	85 db                	test   %ebx,%ebx
+  8000d2:	7e 07                	jle    8000db <libmain+0x74>
+		binaryname = argv[0];
+  8000d4:	8b 06                	mov    (%esi),%eax
+  8000d6:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000db:	83 ec 08             	sub    $0x8,%esp
+  8000de:	56                   	push   %esi
+  8000df:	53                   	push   %ebx
+  8000e0:	e8 50 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000e5:	e8 0a 00 00 00       	call   8000f4 <exit>
+}
+  8000ea:	83 c4 10             	add    $0x10,%esp
+  8000ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000f0:	5b                   	pop    %ebx
+  8000f1:	5e                   	pop    %esi
+  8000f2:	5d                   	pop    %ebp
+  8000f3:	c3                   	ret
+
+008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000fa:	e8 17 07 00 00       	call   800816 <close_all>
+	sys_env_destroy(0);
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	6a 00                	push   $0x0
+  800104:	e8 42 00 00 00       	call   80014b <sys_env_destroy>
+}
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	c9                   	leave
+  80010d:	c3                   	ret
+
+0080010e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80010e:	55                   	push   %ebp
+  80010f:	89 e5                	mov    %esp,%ebp
+  800111:	57                   	push   %edi
+  800112:	56                   	push   %esi
+  800113:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800114:	b8 00 00 00 00       	mov    $0x0,%eax
+  800119:	8b 55 08             	mov    0x8(%ebp),%edx
+  80011c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80011f:	89 c3                	mov    %eax,%ebx
+  800121:	89 c7                	mov    %eax,%edi
+  800123:	89 c6                	mov    %eax,%esi
+  800125:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800127:	5b                   	pop    %ebx
+  800128:	5e                   	pop    %esi
+  800129:	5f                   	pop    %edi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+
+0080012c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	57                   	push   %edi
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800132:	ba 00 00 00 00       	mov    $0x0,%edx
+  800137:	b8 01 00 00 00       	mov    $0x1,%eax
+  80013c:	89 d1                	mov    %edx,%ecx
+  80013e:	89 d3                	mov    %edx,%ebx
+  800140:	89 d7                	mov    %edx,%edi
+  800142:	89 d6                	mov    %edx,%esi
+  800144:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800146:	5b                   	pop    %ebx
+  800147:	5e                   	pop    %esi
+  800148:	5f                   	pop    %edi
+  800149:	5d                   	pop    %ebp
+  80014a:	c3                   	ret
+
+0080014b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80014b:	55                   	push   %ebp
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	57                   	push   %edi
+  80014f:	56                   	push   %esi
+  800150:	53                   	push   %ebx
+  800151:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800154:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80015c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800161:	89 cb                	mov    %ecx,%ebx
+  800163:	89 cf                	mov    %ecx,%edi
+  800165:	89 ce                	mov    %ecx,%esi
+  800167:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	7f 08                	jg     800175 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80016d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800170:	5b                   	pop    %ebx
+  800171:	5e                   	pop    %esi
+  800172:	5f                   	pop    %edi
+  800173:	5d                   	pop    %ebp
+  800174:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800175:	83 ec 0c             	sub    $0xc,%esp
+  800178:	50                   	push   %eax
+  800179:	6a 03                	push   $0x3
+  80017b:	68 aa 3a 80 00       	push   $0x803aaa
+  800180:	6a 23                	push   $0x23
+  800182:	68 c7 3a 80 00       	push   $0x803ac7
+  800187:	e8 79 28 00 00       	call   802a05 <_panic>
+
+0080018c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	57                   	push   %edi
+  800190:	56                   	push   %esi
+  800191:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800192:	ba 00 00 00 00       	mov    $0x0,%edx
+  800197:	b8 02 00 00 00       	mov    $0x2,%eax
+  80019c:	89 d1                	mov    %edx,%ecx
+  80019e:	89 d3                	mov    %edx,%ebx
+  8001a0:	89 d7                	mov    %edx,%edi
+  8001a2:	89 d6                	mov    %edx,%esi
+  8001a4:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001a6:	5b                   	pop    %ebx
+  8001a7:	5e                   	pop    %esi
+  8001a8:	5f                   	pop    %edi
+  8001a9:	5d                   	pop    %ebp
+  8001aa:	c3                   	ret
+
+008001ab <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001ab:	55                   	push   %ebp
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	57                   	push   %edi
+  8001af:	56                   	push   %esi
+  8001b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8001b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001bb:	89 d1                	mov    %edx,%ecx
+  8001bd:	89 d3                	mov    %edx,%ebx
+  8001bf:	89 d7                	mov    %edx,%edi
+  8001c1:	89 d6                	mov    %edx,%esi
+  8001c3:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001c5:	5b                   	pop    %ebx
+  8001c6:	5e                   	pop    %esi
+  8001c7:	5f                   	pop    %edi
+  8001c8:	5d                   	pop    %ebp
+  8001c9:	c3                   	ret
+
+008001ca <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	57                   	push   %edi
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001de:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001e6:	89 f7                	mov    %esi,%edi
+  8001e8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	7f 08                	jg     8001f6 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f1:	5b                   	pop    %ebx
+  8001f2:	5e                   	pop    %esi
+  8001f3:	5f                   	pop    %edi
+  8001f4:	5d                   	pop    %ebp
+  8001f5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001f6:	83 ec 0c             	sub    $0xc,%esp
+  8001f9:	50                   	push   %eax
+  8001fa:	6a 04                	push   $0x4
+  8001fc:	68 aa 3a 80 00       	push   $0x803aaa
+  800201:	6a 23                	push   $0x23
+  800203:	68 c7 3a 80 00       	push   $0x803ac7
+  800208:	e8 f8 27 00 00       	call   802a05 <_panic>
+
+0080020d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80020d:	55                   	push   %ebp
+  80020e:	89 e5                	mov    %esp,%ebp
+  800210:	57                   	push   %edi
+  800211:	56                   	push   %esi
+  800212:	53                   	push   %ebx
+  800213:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800216:	8b 55 08             	mov    0x8(%ebp),%edx
+  800219:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80021c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800221:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800224:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800227:	8b 75 18             	mov    0x18(%ebp),%esi
+  80022a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80022c:	85 c0                	test   %eax,%eax
+  80022e:	7f 08                	jg     800238 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800233:	5b                   	pop    %ebx
+  800234:	5e                   	pop    %esi
+  800235:	5f                   	pop    %edi
+  800236:	5d                   	pop    %ebp
+  800237:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800238:	83 ec 0c             	sub    $0xc,%esp
+  80023b:	50                   	push   %eax
+  80023c:	6a 05                	push   $0x5
+  80023e:	68 aa 3a 80 00       	push   $0x803aaa
+  800243:	6a 23                	push   $0x23
+  800245:	68 c7 3a 80 00       	push   $0x803ac7
+  80024a:	e8 b6 27 00 00       	call   802a05 <_panic>
+
+0080024f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	57                   	push   %edi
+  800253:	56                   	push   %esi
+  800254:	53                   	push   %ebx
+  800255:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800258:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80025d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800260:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800263:	b8 06 00 00 00       	mov    $0x6,%eax
+  800268:	89 df                	mov    %ebx,%edi
+  80026a:	89 de                	mov    %ebx,%esi
+  80026c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80026e:	85 c0                	test   %eax,%eax
+  800270:	7f 08                	jg     80027a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800275:	5b                   	pop    %ebx
+  800276:	5e                   	pop    %esi
+  800277:	5f                   	pop    %edi
+  800278:	5d                   	pop    %ebp
+  800279:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80027a:	83 ec 0c             	sub    $0xc,%esp
+  80027d:	50                   	push   %eax
+  80027e:	6a 06                	push   $0x6
+  800280:	68 aa 3a 80 00       	push   $0x803aaa
+  800285:	6a 23                	push   $0x23
+  800287:	68 c7 3a 80 00       	push   $0x803ac7
+  80028c:	e8 74 27 00 00       	call   802a05 <_panic>
+
+00800291 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	57                   	push   %edi
+  800295:	56                   	push   %esi
+  800296:	53                   	push   %ebx
+  800297:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80029a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80029f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002aa:	89 df                	mov    %ebx,%edi
+  8002ac:	89 de                	mov    %ebx,%esi
+  8002ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002b0:	85 c0                	test   %eax,%eax
+  8002b2:	7f 08                	jg     8002bc <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b7:	5b                   	pop    %ebx
+  8002b8:	5e                   	pop    %esi
+  8002b9:	5f                   	pop    %edi
+  8002ba:	5d                   	pop    %ebp
+  8002bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002bc:	83 ec 0c             	sub    $0xc,%esp
+  8002bf:	50                   	push   %eax
+  8002c0:	6a 08                	push   $0x8
+  8002c2:	68 aa 3a 80 00       	push   $0x803aaa
+  8002c7:	6a 23                	push   $0x23
+  8002c9:	68 c7 3a 80 00       	push   $0x803ac7
+  8002ce:	e8 32 27 00 00       	call   802a05 <_panic>
+
+008002d3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002d3:	55                   	push   %ebp
+  8002d4:	89 e5                	mov    %esp,%ebp
+  8002d6:	57                   	push   %edi
+  8002d7:	56                   	push   %esi
+  8002d8:	53                   	push   %ebx
+  8002d9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002ec:	89 df                	mov    %ebx,%edi
+  8002ee:	89 de                	mov    %ebx,%esi
+  8002f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002f2:	85 c0                	test   %eax,%eax
+  8002f4:	7f 08                	jg     8002fe <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f9:	5b                   	pop    %ebx
+  8002fa:	5e                   	pop    %esi
+  8002fb:	5f                   	pop    %edi
+  8002fc:	5d                   	pop    %ebp
+  8002fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002fe:	83 ec 0c             	sub    $0xc,%esp
+  800301:	50                   	push   %eax
+  800302:	6a 09                	push   $0x9
+  800304:	68 aa 3a 80 00       	push   $0x803aaa
+  800309:	6a 23                	push   $0x23
+  80030b:	68 c7 3a 80 00       	push   $0x803ac7
+  800310:	e8 f0 26 00 00       	call   802a05 <_panic>
+
+00800315 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800315:	55                   	push   %ebp
+  800316:	89 e5                	mov    %esp,%ebp
+  800318:	57                   	push   %edi
+  800319:	56                   	push   %esi
+  80031a:	53                   	push   %ebx
+  80031b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80031e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800323:	8b 55 08             	mov    0x8(%ebp),%edx
+  800326:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800329:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80032e:	89 df                	mov    %ebx,%edi
+  800330:	89 de                	mov    %ebx,%esi
+  800332:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800334:	85 c0                	test   %eax,%eax
+  800336:	7f 08                	jg     800340 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033b:	5b                   	pop    %ebx
+  80033c:	5e                   	pop    %esi
+  80033d:	5f                   	pop    %edi
+  80033e:	5d                   	pop    %ebp
+  80033f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800340:	83 ec 0c             	sub    $0xc,%esp
+  800343:	50                   	push   %eax
+  800344:	6a 0a                	push   $0xa
+  800346:	68 aa 3a 80 00       	push   $0x803aaa
+  80034b:	6a 23                	push   $0x23
+  80034d:	68 c7 3a 80 00       	push   $0x803ac7
+  800352:	e8 ae 26 00 00       	call   802a05 <_panic>
+
+00800357 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800357:	55                   	push   %ebp
+  800358:	89 e5                	mov    %esp,%ebp
+  80035a:	57                   	push   %edi
+  80035b:	56                   	push   %esi
+  80035c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80035d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800363:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800368:	be 00 00 00 00       	mov    $0x0,%esi
+  80036d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800370:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800373:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800375:	5b                   	pop    %ebx
+  800376:	5e                   	pop    %esi
+  800377:	5f                   	pop    %edi
+  800378:	5d                   	pop    %ebp
+  800379:	c3                   	ret
+
+0080037a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80037a:	55                   	push   %ebp
+  80037b:	89 e5                	mov    %esp,%ebp
+  80037d:	57                   	push   %edi
+  80037e:	56                   	push   %esi
+  80037f:	53                   	push   %ebx
+  800380:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800383:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800388:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800390:	89 cb                	mov    %ecx,%ebx
+  800392:	89 cf                	mov    %ecx,%edi
+  800394:	89 ce                	mov    %ecx,%esi
+  800396:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800398:	85 c0                	test   %eax,%eax
+  80039a:	7f 08                	jg     8003a4 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80039c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039f:	5b                   	pop    %ebx
+  8003a0:	5e                   	pop    %esi
+  8003a1:	5f                   	pop    %edi
+  8003a2:	5d                   	pop    %ebp
+  8003a3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003a4:	83 ec 0c             	sub    $0xc,%esp
+  8003a7:	50                   	push   %eax
+  8003a8:	6a 0d                	push   $0xd
+  8003aa:	68 aa 3a 80 00       	push   $0x803aaa
+  8003af:	6a 23                	push   $0x23
+  8003b1:	68 c7 3a 80 00       	push   $0x803ac7
+  8003b6:	e8 4a 26 00 00       	call   802a05 <_panic>
+
+008003bb <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8003bb:	55                   	push   %ebp
+  8003bc:	89 e5                	mov    %esp,%ebp
+  8003be:	57                   	push   %edi
+  8003bf:	56                   	push   %esi
+  8003c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003d2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003d5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003d7:	5b                   	pop    %ebx
+  8003d8:	5e                   	pop    %esi
+  8003d9:	5f                   	pop    %edi
+  8003da:	5d                   	pop    %ebp
+  8003db:	c3                   	ret
+
+008003dc <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003dc:	55                   	push   %ebp
+  8003dd:	89 e5                	mov    %esp,%ebp
+  8003df:	57                   	push   %edi
+  8003e0:	56                   	push   %esi
+  8003e1:	53                   	push   %ebx
+  8003e2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003f5:	89 df                	mov    %ebx,%edi
+  8003f7:	89 de                	mov    %ebx,%esi
+  8003f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003fb:	85 c0                	test   %eax,%eax
+  8003fd:	7f 08                	jg     800407 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800402:	5b                   	pop    %ebx
+  800403:	5e                   	pop    %esi
+  800404:	5f                   	pop    %edi
+  800405:	5d                   	pop    %ebp
+  800406:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800407:	83 ec 0c             	sub    $0xc,%esp
+  80040a:	50                   	push   %eax
+  80040b:	6a 0d                	push   $0xd
+  80040d:	68 aa 3a 80 00       	push   $0x803aaa
+  800412:	6a 23                	push   $0x23
+  800414:	68 c7 3a 80 00       	push   $0x803ac7
+  800419:	e8 e7 25 00 00       	call   802a05 <_panic>
+
+0080041e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80041e:	55                   	push   %ebp
+  80041f:	89 e5                	mov    %esp,%ebp
+  800421:	57                   	push   %edi
+  800422:	56                   	push   %esi
+  800423:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800424:	ba 00 00 00 00       	mov    $0x0,%edx
+  800429:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80042e:	89 d1                	mov    %edx,%ecx
+  800430:	89 d3                	mov    %edx,%ebx
+  800432:	89 d7                	mov    %edx,%edi
+  800434:	89 d6                	mov    %edx,%esi
+  800436:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800438:	5b                   	pop    %ebx
+  800439:	5e                   	pop    %esi
+  80043a:	5f                   	pop    %edi
+  80043b:	5d                   	pop    %ebp
+  80043c:	c3                   	ret
+
+0080043d <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80043d:	55                   	push   %ebp
+  80043e:	89 e5                	mov    %esp,%ebp
+  800440:	57                   	push   %edi
+  800441:	56                   	push   %esi
+  800442:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800443:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80044b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80044e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800453:	89 df                	mov    %ebx,%edi
+  800455:	89 de                	mov    %ebx,%esi
+  800457:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800459:	5b                   	pop    %ebx
+  80045a:	5e                   	pop    %esi
+  80045b:	5f                   	pop    %edi
+  80045c:	5d                   	pop    %ebp
+  80045d:	c3                   	ret
+
+0080045e <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80045e:	55                   	push   %ebp
+  80045f:	89 e5                	mov    %esp,%ebp
+  800461:	57                   	push   %edi
+  800462:	56                   	push   %esi
+  800463:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800464:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800469:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800471:	89 cb                	mov    %ecx,%ebx
+  800473:	89 cf                	mov    %ecx,%edi
+  800475:	89 ce                	mov    %ecx,%esi
+  800477:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800479:	5b                   	pop    %ebx
+  80047a:	5e                   	pop    %esi
+  80047b:	5f                   	pop    %edi
+  80047c:	5d                   	pop    %ebp
+  80047d:	c3                   	ret
+
+0080047e <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80047e:	55                   	push   %ebp
+  80047f:	89 e5                	mov    %esp,%ebp
+  800481:	57                   	push   %edi
+  800482:	56                   	push   %esi
+  800483:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800484:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800489:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80048f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800494:	89 df                	mov    %ebx,%edi
+  800496:	89 de                	mov    %ebx,%esi
+  800498:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80049a:	5b                   	pop    %ebx
+  80049b:	5e                   	pop    %esi
+  80049c:	5f                   	pop    %edi
+  80049d:	5d                   	pop    %ebp
+  80049e:	c3                   	ret
+
+0080049f <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80049f:	55                   	push   %ebp
+  8004a0:	89 e5                	mov    %esp,%ebp
+  8004a2:	57                   	push   %edi
+  8004a3:	56                   	push   %esi
+  8004a4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004b5:	89 df                	mov    %ebx,%edi
+  8004b7:	89 de                	mov    %ebx,%esi
+  8004b9:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8004bb:	5b                   	pop    %ebx
+  8004bc:	5e                   	pop    %esi
+  8004bd:	5f                   	pop    %edi
+  8004be:	5d                   	pop    %ebp
+  8004bf:	c3                   	ret
+
+008004c0 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8004c0:	55                   	push   %ebp
+  8004c1:	89 e5                	mov    %esp,%ebp
+  8004c3:	57                   	push   %edi
+  8004c4:	56                   	push   %esi
+  8004c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ce:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004d3:	89 cb                	mov    %ecx,%ebx
+  8004d5:	89 cf                	mov    %ecx,%edi
+  8004d7:	89 ce                	mov    %ecx,%esi
+  8004d9:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004db:	5b                   	pop    %ebx
+  8004dc:	5e                   	pop    %esi
+  8004dd:	5f                   	pop    %edi
+  8004de:	5d                   	pop    %ebp
+  8004df:	c3                   	ret
+
+008004e0 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004e0:	55                   	push   %ebp
+  8004e1:	89 e5                	mov    %esp,%ebp
+  8004e3:	57                   	push   %edi
+  8004e4:	56                   	push   %esi
+  8004e5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004f6:	89 df                	mov    %ebx,%edi
+  8004f8:	89 de                	mov    %ebx,%esi
+  8004fa:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004fc:	5b                   	pop    %ebx
+  8004fd:	5e                   	pop    %esi
+  8004fe:	5f                   	pop    %edi
+  8004ff:	5d                   	pop    %ebp
+  800500:	c3                   	ret
+
+00800501 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  800501:	55                   	push   %ebp
+  800502:	89 e5                	mov    %esp,%ebp
+  800504:	57                   	push   %edi
+  800505:	56                   	push   %esi
+  800506:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800507:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80050c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80050f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800514:	89 cb                	mov    %ecx,%ebx
+  800516:	89 cf                	mov    %ecx,%edi
+  800518:	89 ce                	mov    %ecx,%esi
+  80051a:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80051c:	5b                   	pop    %ebx
+  80051d:	5e                   	pop    %esi
+  80051e:	5f                   	pop    %edi
+  80051f:	5d                   	pop    %ebp
+  800520:	c3                   	ret
+
+00800521 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  800521:	55                   	push   %ebp
+  800522:	89 e5                	mov    %esp,%ebp
+  800524:	57                   	push   %edi
+  800525:	56                   	push   %esi
+  800526:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800527:	be 00 00 00 00       	mov    $0x0,%esi
+  80052c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800532:	b8 16 00 00 00       	mov    $0x16,%eax
+  800537:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80053a:	89 f7                	mov    %esi,%edi
+  80053c:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80053e:	5b                   	pop    %ebx
+  80053f:	5e                   	pop    %esi
+  800540:	5f                   	pop    %edi
+  800541:	5d                   	pop    %ebp
+  800542:	c3                   	ret
+
+00800543 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800543:	55                   	push   %ebp
+  800544:	89 e5                	mov    %esp,%ebp
+  800546:	57                   	push   %edi
+  800547:	56                   	push   %esi
+  800548:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80054e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800551:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800554:	b8 17 00 00 00       	mov    $0x17,%eax
+  800559:	89 df                	mov    %ebx,%edi
+  80055b:	89 de                	mov    %ebx,%esi
+  80055d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80055f:	5b                   	pop    %ebx
+  800560:	5e                   	pop    %esi
+  800561:	5f                   	pop    %edi
+  800562:	5d                   	pop    %ebp
+  800563:	c3                   	ret
+
+00800564 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800564:	55                   	push   %ebp
+  800565:	89 e5                	mov    %esp,%ebp
+  800567:	57                   	push   %edi
+  800568:	56                   	push   %esi
+  800569:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80056a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800572:	b8 18 00 00 00       	mov    $0x18,%eax
+  800577:	89 cb                	mov    %ecx,%ebx
+  800579:	89 cf                	mov    %ecx,%edi
+  80057b:	89 ce                	mov    %ecx,%esi
+  80057d:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80057f:	5b                   	pop    %ebx
+  800580:	5e                   	pop    %esi
+  800581:	5f                   	pop    %edi
+  800582:	5d                   	pop    %ebp
+  800583:	c3                   	ret
+
+00800584 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800584:	55                   	push   %ebp
+  800585:	89 e5                	mov    %esp,%ebp
+  800587:	57                   	push   %edi
+  800588:	56                   	push   %esi
+  800589:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80058a:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80058e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800593:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800596:	b8 19 00 00 00       	mov    $0x19,%eax
+  80059b:	89 df                	mov    %ebx,%edi
+  80059d:	89 de                	mov    %ebx,%esi
+  80059f:	cd 30                	int    $0x30
+}
+  8005a1:	5b                   	pop    %ebx
+  8005a2:	5e                   	pop    %esi
+  8005a3:	5f                   	pop    %edi
+  8005a4:	5d                   	pop    %ebp
+  8005a5:	c3                   	ret
+
+008005a6 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8005a6:	55                   	push   %ebp
+  8005a7:	89 e5                	mov    %esp,%ebp
+  8005a9:	57                   	push   %edi
+  8005aa:	56                   	push   %esi
+  8005ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005b7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005bf:	89 f7                	mov    %esi,%edi
+  8005c1:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8005c3:	5b                   	pop    %ebx
+  8005c4:	5e                   	pop    %esi
+  8005c5:	5f                   	pop    %edi
+  8005c6:	5d                   	pop    %ebp
+  8005c7:	c3                   	ret
+
+008005c8 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8005c8:	55                   	push   %ebp
+  8005c9:	89 e5                	mov    %esp,%ebp
+  8005cb:	57                   	push   %edi
+  8005cc:	56                   	push   %esi
+  8005cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005e1:	89 f7                	mov    %esi,%edi
+  8005e3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005e5:	5b                   	pop    %ebx
+  8005e6:	5e                   	pop    %esi
+  8005e7:	5f                   	pop    %edi
+  8005e8:	5d                   	pop    %ebp
+  8005e9:	c3                   	ret
+
+008005ea <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005ea:	55                   	push   %ebp
+  8005eb:	89 e5                	mov    %esp,%ebp
+  8005ed:	57                   	push   %edi
+  8005ee:	56                   	push   %esi
+  8005ef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800600:	89 df                	mov    %ebx,%edi
+  800602:	89 de                	mov    %ebx,%esi
+  800604:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  800606:	5b                   	pop    %ebx
+  800607:	5e                   	pop    %esi
+  800608:	5f                   	pop    %edi
+  800609:	5d                   	pop    %ebp
+  80060a:	c3                   	ret
+
+0080060b <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80060b:	55                   	push   %ebp
+  80060c:	89 e5                	mov    %esp,%ebp
+  80060e:	57                   	push   %edi
+  80060f:	56                   	push   %esi
+  800610:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800611:	be 00 00 00 00       	mov    $0x0,%esi
+  800616:	8b 55 08             	mov    0x8(%ebp),%edx
+  800619:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80061c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800621:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800624:	89 f7                	mov    %esi,%edi
+  800626:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  800628:	5b                   	pop    %ebx
+  800629:	5e                   	pop    %esi
+  80062a:	5f                   	pop    %edi
+  80062b:	5d                   	pop    %ebp
+  80062c:	c3                   	ret
+
+0080062d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80062d:	55                   	push   %ebp
+  80062e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800630:	8b 45 08             	mov    0x8(%ebp),%eax
+  800633:	05 00 00 00 30       	add    $0x30000000,%eax
+  800638:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80063b:	5d                   	pop    %ebp
+  80063c:	c3                   	ret
+
+0080063d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80063d:	55                   	push   %ebp
+  80063e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800640:	8b 45 08             	mov    0x8(%ebp),%eax
+  800643:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800648:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80064d:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800652:	5d                   	pop    %ebp
+  800653:	c3                   	ret
+
+00800654 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800654:	55                   	push   %ebp
+  800655:	89 e5                	mov    %esp,%ebp
+  800657:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80065c:	89 c2                	mov    %eax,%edx
+  80065e:	c1 ea 16             	shr    $0x16,%edx
+  800661:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800668:	f6 c2 01             	test   $0x1,%dl
+  80066b:	74 29                	je     800696 <fd_alloc+0x42>
+  80066d:	89 c2                	mov    %eax,%edx
+  80066f:	c1 ea 0c             	shr    $0xc,%edx
+  800672:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800679:	f6 c2 01             	test   $0x1,%dl
+  80067c:	74 18                	je     800696 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80067e:	05 00 10 00 00       	add    $0x1000,%eax
+  800683:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  800688:	75 d2                	jne    80065c <fd_alloc+0x8>
+  80068a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80068f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800694:	eb 05                	jmp    80069b <fd_alloc+0x47>
+			return 0;
+  800696:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80069b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80069e:	89 02                	mov    %eax,(%edx)
+}
+  8006a0:	89 c8                	mov    %ecx,%eax
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+  8006a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8006aa:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8006af:	77 30                	ja     8006e1 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8006b1:	c1 e0 0c             	shl    $0xc,%eax
+  8006b4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8006b9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006bf:	f6 c2 01             	test   $0x1,%dl
+  8006c2:	74 24                	je     8006e8 <fd_lookup+0x44>
+  8006c4:	89 c2                	mov    %eax,%edx
+  8006c6:	c1 ea 0c             	shr    $0xc,%edx
+  8006c9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006d0:	f6 c2 01             	test   $0x1,%dl
+  8006d3:	74 1a                	je     8006ef <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006d8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006df:	5d                   	pop    %ebp
+  8006e0:	c3                   	ret
+		return -E_INVAL;
+  8006e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e6:	eb f7                	jmp    8006df <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006ed:	eb f0                	jmp    8006df <fd_lookup+0x3b>
+  8006ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006f4:	eb e9                	jmp    8006df <fd_lookup+0x3b>
+
+008006f6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006f6:	55                   	push   %ebp
+  8006f7:	89 e5                	mov    %esp,%ebp
+  8006f9:	53                   	push   %ebx
+  8006fa:	83 ec 04             	sub    $0x4,%esp
+  8006fd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800700:	b8 00 00 00 00       	mov    $0x0,%eax
+  800705:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  80070a:	39 13                	cmp    %edx,(%ebx)
+  80070c:	74 54                	je     800762 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80070e:	83 c0 01             	add    $0x1,%eax
+  800711:	8b 1c 85 54 3b 80 00 	mov    0x803b54(,%eax,4),%ebx
+  800718:	85 db                	test   %ebx,%ebx
+  80071a:	75 ee                	jne    80070a <dev_lookup+0x14>
+  80071c:	89 e1                	mov    %esp,%ecx
+  80071e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800723:	29 c8                	sub    %ecx,%eax
+  800725:	89 c1                	mov    %eax,%ecx
+  800727:	c1 e9 0f             	shr    $0xf,%ecx
+  80072a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80072f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800734:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800737:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80073e:	8b 40 48             	mov    0x48(%eax),%eax
+  800741:	83 ec 04             	sub    $0x4,%esp
+  800744:	52                   	push   %edx
+  800745:	50                   	push   %eax
+  800746:	68 d8 3a 80 00       	push   $0x803ad8
+  80074b:	e8 90 23 00 00       	call   802ae0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800750:	83 c4 10             	add    $0x10,%esp
+  800753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800758:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80075b:	89 1a                	mov    %ebx,(%edx)
+}
+  80075d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800760:	c9                   	leave
+  800761:	c3                   	ret
+			return 0;
+  800762:	b8 00 00 00 00       	mov    $0x0,%eax
+  800767:	eb ef                	jmp    800758 <dev_lookup+0x62>
+
+00800769 <fd_close>:
+{
+  800769:	55                   	push   %ebp
+  80076a:	89 e5                	mov    %esp,%ebp
+  80076c:	57                   	push   %edi
+  80076d:	56                   	push   %esi
+  80076e:	53                   	push   %ebx
+  80076f:	83 ec 24             	sub    $0x24,%esp
+  800772:	8b 75 08             	mov    0x8(%ebp),%esi
+  800775:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800778:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80077b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80077c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800782:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800785:	50                   	push   %eax
+  800786:	e8 19 ff ff ff       	call   8006a4 <fd_lookup>
+  80078b:	89 c3                	mov    %eax,%ebx
+  80078d:	83 c4 10             	add    $0x10,%esp
+  800790:	85 c0                	test   %eax,%eax
+  800792:	78 05                	js     800799 <fd_close+0x30>
+	    || fd != fd2)
+  800794:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800797:	74 0f                	je     8007a8 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  800799:	85 ff                	test   %edi,%edi
+  80079b:	0f 44 df             	cmove  %edi,%ebx
+}
+  80079e:	89 d8                	mov    %ebx,%eax
+  8007a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a3:	5b                   	pop    %ebx
+  8007a4:	5e                   	pop    %esi
+  8007a5:	5f                   	pop    %edi
+  8007a6:	5d                   	pop    %ebp
+  8007a7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007a8:	83 ec 08             	sub    $0x8,%esp
+  8007ab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007ae:	50                   	push   %eax
+  8007af:	ff 36                	push   (%esi)
+  8007b1:	e8 40 ff ff ff       	call   8006f6 <dev_lookup>
+  8007b6:	89 c3                	mov    %eax,%ebx
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	85 c0                	test   %eax,%eax
+  8007bd:	78 1a                	js     8007d9 <fd_close+0x70>
+		if (dev->dev_close)
+  8007bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007c2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8007c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007ca:	85 c0                	test   %eax,%eax
+  8007cc:	74 0b                	je     8007d9 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8007ce:	83 ec 0c             	sub    $0xc,%esp
+  8007d1:	56                   	push   %esi
+  8007d2:	ff d0                	call   *%eax
+  8007d4:	89 c3                	mov    %eax,%ebx
+  8007d6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	56                   	push   %esi
+  8007dd:	6a 00                	push   $0x0
+  8007df:	e8 6b fa ff ff       	call   80024f <sys_page_unmap>
+	return r;
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	eb b5                	jmp    80079e <fd_close+0x35>
+
+008007e9 <close>:
+
+int
+close(int fdnum)
+{
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007f2:	50                   	push   %eax
+  8007f3:	ff 75 08             	push   0x8(%ebp)
+  8007f6:	e8 a9 fe ff ff       	call   8006a4 <fd_lookup>
+  8007fb:	83 c4 10             	add    $0x10,%esp
+  8007fe:	85 c0                	test   %eax,%eax
+  800800:	79 02                	jns    800804 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800802:	c9                   	leave
+  800803:	c3                   	ret
+		return fd_close(fd, 1);
+  800804:	83 ec 08             	sub    $0x8,%esp
+  800807:	6a 01                	push   $0x1
+  800809:	ff 75 f4             	push   -0xc(%ebp)
+  80080c:	e8 58 ff ff ff       	call   800769 <fd_close>
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	eb ec                	jmp    800802 <close+0x19>
+
+00800816 <close_all>:
+
+void
+close_all(void)
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	53                   	push   %ebx
+  80081a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80081d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800822:	83 ec 0c             	sub    $0xc,%esp
+  800825:	53                   	push   %ebx
+  800826:	e8 be ff ff ff       	call   8007e9 <close>
+	for (i = 0; i < MAXFD; i++)
+  80082b:	83 c3 01             	add    $0x1,%ebx
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800837:	75 e9                	jne    800822 <close_all+0xc>
+}
+  800839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083c:	c9                   	leave
+  80083d:	c3                   	ret
+
+0080083e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80083e:	55                   	push   %ebp
+  80083f:	89 e5                	mov    %esp,%ebp
+  800841:	57                   	push   %edi
+  800842:	56                   	push   %esi
+  800843:	53                   	push   %ebx
+  800844:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800847:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80084a:	50                   	push   %eax
+  80084b:	ff 75 08             	push   0x8(%ebp)
+  80084e:	e8 51 fe ff ff       	call   8006a4 <fd_lookup>
+  800853:	89 c3                	mov    %eax,%ebx
+  800855:	83 c4 10             	add    $0x10,%esp
+  800858:	85 c0                	test   %eax,%eax
+  80085a:	78 7f                	js     8008db <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80085c:	83 ec 0c             	sub    $0xc,%esp
+  80085f:	ff 75 0c             	push   0xc(%ebp)
+  800862:	e8 82 ff ff ff       	call   8007e9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800867:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80086a:	c1 e6 0c             	shl    $0xc,%esi
+  80086d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800873:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800876:	89 3c 24             	mov    %edi,(%esp)
+  800879:	e8 bf fd ff ff       	call   80063d <fd2data>
+  80087e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800880:	89 34 24             	mov    %esi,(%esp)
+  800883:	e8 b5 fd ff ff       	call   80063d <fd2data>
+  800888:	83 c4 10             	add    $0x10,%esp
+  80088b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80088e:	89 d8                	mov    %ebx,%eax
+  800890:	c1 e8 16             	shr    $0x16,%eax
+  800893:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80089a:	a8 01                	test   $0x1,%al
+  80089c:	74 11                	je     8008af <dup+0x71>
+  80089e:	89 d8                	mov    %ebx,%eax
+  8008a0:	c1 e8 0c             	shr    $0xc,%eax
+  8008a3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008aa:	f6 c2 01             	test   $0x1,%dl
+  8008ad:	75 36                	jne    8008e5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8008af:	89 f8                	mov    %edi,%eax
+  8008b1:	c1 e8 0c             	shr    $0xc,%eax
+  8008b4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008bb:	83 ec 0c             	sub    $0xc,%esp
+  8008be:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008c3:	50                   	push   %eax
+  8008c4:	56                   	push   %esi
+  8008c5:	6a 00                	push   $0x0
+  8008c7:	57                   	push   %edi
+  8008c8:	6a 00                	push   $0x0
+  8008ca:	e8 3e f9 ff ff       	call   80020d <sys_page_map>
+  8008cf:	89 c3                	mov    %eax,%ebx
+  8008d1:	83 c4 20             	add    $0x20,%esp
+  8008d4:	85 c0                	test   %eax,%eax
+  8008d6:	78 33                	js     80090b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008db:	89 d8                	mov    %ebx,%eax
+  8008dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008e0:	5b                   	pop    %ebx
+  8008e1:	5e                   	pop    %esi
+  8008e2:	5f                   	pop    %edi
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008e5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008ec:	83 ec 0c             	sub    $0xc,%esp
+  8008ef:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008f4:	50                   	push   %eax
+  8008f5:	ff 75 d4             	push   -0x2c(%ebp)
+  8008f8:	6a 00                	push   $0x0
+  8008fa:	53                   	push   %ebx
+  8008fb:	6a 00                	push   $0x0
+  8008fd:	e8 0b f9 ff ff       	call   80020d <sys_page_map>
+  800902:	89 c3                	mov    %eax,%ebx
+  800904:	83 c4 20             	add    $0x20,%esp
+  800907:	85 c0                	test   %eax,%eax
+  800909:	79 a4                	jns    8008af <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80090b:	83 ec 08             	sub    $0x8,%esp
+  80090e:	56                   	push   %esi
+  80090f:	6a 00                	push   $0x0
+  800911:	e8 39 f9 ff ff       	call   80024f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800916:	83 c4 08             	add    $0x8,%esp
+  800919:	ff 75 d4             	push   -0x2c(%ebp)
+  80091c:	6a 00                	push   $0x0
+  80091e:	e8 2c f9 ff ff       	call   80024f <sys_page_unmap>
+	return r;
+  800923:	83 c4 10             	add    $0x10,%esp
+  800926:	eb b3                	jmp    8008db <dup+0x9d>
+
+00800928 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	56                   	push   %esi
+  80092c:	53                   	push   %ebx
+  80092d:	83 ec 18             	sub    $0x18,%esp
+  800930:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800933:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800936:	50                   	push   %eax
+  800937:	53                   	push   %ebx
+  800938:	e8 67 fd ff ff       	call   8006a4 <fd_lookup>
+  80093d:	83 c4 10             	add    $0x10,%esp
+  800940:	85 c0                	test   %eax,%eax
+  800942:	78 3c                	js     800980 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800944:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800947:	83 ec 08             	sub    $0x8,%esp
+  80094a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80094d:	50                   	push   %eax
+  80094e:	ff 36                	push   (%esi)
+  800950:	e8 a1 fd ff ff       	call   8006f6 <dev_lookup>
+  800955:	83 c4 10             	add    $0x10,%esp
+  800958:	85 c0                	test   %eax,%eax
+  80095a:	78 24                	js     800980 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80095c:	8b 46 08             	mov    0x8(%esi),%eax
+  80095f:	83 e0 03             	and    $0x3,%eax
+  800962:	83 f8 01             	cmp    $0x1,%eax
+  800965:	74 20                	je     800987 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800967:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80096a:	8b 40 08             	mov    0x8(%eax),%eax
+  80096d:	85 c0                	test   %eax,%eax
+  80096f:	74 54                	je     8009c5 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800971:	83 ec 04             	sub    $0x4,%esp
+  800974:	ff 75 10             	push   0x10(%ebp)
+  800977:	ff 75 0c             	push   0xc(%ebp)
+  80097a:	56                   	push   %esi
+  80097b:	ff d0                	call   *%eax
+  80097d:	83 c4 10             	add    $0x10,%esp
+}
+  800980:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800983:	5b                   	pop    %ebx
+  800984:	5e                   	pop    %esi
+  800985:	5d                   	pop    %ebp
+  800986:	c3                   	ret
+  800987:	89 e2                	mov    %esp,%edx
+  800989:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80098e:	29 d0                	sub    %edx,%eax
+  800990:	89 c2                	mov    %eax,%edx
+  800992:	c1 ea 0f             	shr    $0xf,%edx
+  800995:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80099a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009a2:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8009a9:	8b 40 48             	mov    0x48(%eax),%eax
+  8009ac:	83 ec 04             	sub    $0x4,%esp
+  8009af:	53                   	push   %ebx
+  8009b0:	50                   	push   %eax
+  8009b1:	68 19 3b 80 00       	push   $0x803b19
+  8009b6:	e8 25 21 00 00       	call   802ae0 <cprintf>
+		return -E_INVAL;
+  8009bb:	83 c4 10             	add    $0x10,%esp
+  8009be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009c3:	eb bb                	jmp    800980 <read+0x58>
+		return -E_NOT_SUPP;
+  8009c5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009ca:	eb b4                	jmp    800980 <read+0x58>
+
+008009cc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009cc:	55                   	push   %ebp
+  8009cd:	89 e5                	mov    %esp,%ebp
+  8009cf:	57                   	push   %edi
+  8009d0:	56                   	push   %esi
+  8009d1:	53                   	push   %ebx
+  8009d2:	83 ec 0c             	sub    $0xc,%esp
+  8009d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009db:	85 f6                	test   %esi,%esi
+  8009dd:	74 30                	je     800a0f <readn+0x43>
+  8009df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e4:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009e9:	83 ec 04             	sub    $0x4,%esp
+  8009ec:	89 f2                	mov    %esi,%edx
+  8009ee:	29 c2                	sub    %eax,%edx
+  8009f0:	52                   	push   %edx
+  8009f1:	01 f8                	add    %edi,%eax
+  8009f3:	50                   	push   %eax
+  8009f4:	ff 75 08             	push   0x8(%ebp)
+  8009f7:	e8 2c ff ff ff       	call   800928 <read>
+		if (m < 0)
+  8009fc:	83 c4 10             	add    $0x10,%esp
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	78 15                	js     800a18 <readn+0x4c>
+			return m;
+		if (m == 0)
+  800a03:	74 11                	je     800a16 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  800a05:	01 c3                	add    %eax,%ebx
+  800a07:	89 d8                	mov    %ebx,%eax
+  800a09:	39 f3                	cmp    %esi,%ebx
+  800a0b:	72 dc                	jb     8009e9 <readn+0x1d>
+  800a0d:	eb 09                	jmp    800a18 <readn+0x4c>
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a14:	eb 02                	jmp    800a18 <readn+0x4c>
+  800a16:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  800a18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a1b:	5b                   	pop    %ebx
+  800a1c:	5e                   	pop    %esi
+  800a1d:	5f                   	pop    %edi
+  800a1e:	5d                   	pop    %ebp
+  800a1f:	c3                   	ret
+
+00800a20 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a20:	55                   	push   %ebp
+  800a21:	89 e5                	mov    %esp,%ebp
+  800a23:	56                   	push   %esi
+  800a24:	53                   	push   %ebx
+  800a25:	83 ec 18             	sub    $0x18,%esp
+  800a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a2b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a2e:	50                   	push   %eax
+  800a2f:	53                   	push   %ebx
+  800a30:	e8 6f fc ff ff       	call   8006a4 <fd_lookup>
+  800a35:	83 c4 10             	add    $0x10,%esp
+  800a38:	85 c0                	test   %eax,%eax
+  800a3a:	78 37                	js     800a73 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a3c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a3f:	83 ec 08             	sub    $0x8,%esp
+  800a42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a45:	50                   	push   %eax
+  800a46:	ff 36                	push   (%esi)
+  800a48:	e8 a9 fc ff ff       	call   8006f6 <dev_lookup>
+  800a4d:	83 c4 10             	add    $0x10,%esp
+  800a50:	85 c0                	test   %eax,%eax
+  800a52:	78 1f                	js     800a73 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a54:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a58:	74 20                	je     800a7a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a60:	85 c0                	test   %eax,%eax
+  800a62:	74 54                	je     800ab8 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a64:	83 ec 04             	sub    $0x4,%esp
+  800a67:	ff 75 10             	push   0x10(%ebp)
+  800a6a:	ff 75 0c             	push   0xc(%ebp)
+  800a6d:	56                   	push   %esi
+  800a6e:	ff d0                	call   *%eax
+  800a70:	83 c4 10             	add    $0x10,%esp
+}
+  800a73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a76:	5b                   	pop    %ebx
+  800a77:	5e                   	pop    %esi
+  800a78:	5d                   	pop    %ebp
+  800a79:	c3                   	ret
+  800a7a:	89 e2                	mov    %esp,%edx
+  800a7c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a81:	29 d0                	sub    %edx,%eax
+  800a83:	89 c2                	mov    %eax,%edx
+  800a85:	c1 ea 0f             	shr    $0xf,%edx
+  800a88:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a92:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a95:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a9c:	8b 40 48             	mov    0x48(%eax),%eax
+  800a9f:	83 ec 04             	sub    $0x4,%esp
+  800aa2:	53                   	push   %ebx
+  800aa3:	50                   	push   %eax
+  800aa4:	68 35 3b 80 00       	push   $0x803b35
+  800aa9:	e8 32 20 00 00       	call   802ae0 <cprintf>
+		return -E_INVAL;
+  800aae:	83 c4 10             	add    $0x10,%esp
+  800ab1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab6:	eb bb                	jmp    800a73 <write+0x53>
+		return -E_NOT_SUPP;
+  800ab8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800abd:	eb b4                	jmp    800a73 <write+0x53>
+
+00800abf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ac5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ac8:	50                   	push   %eax
+  800ac9:	ff 75 08             	push   0x8(%ebp)
+  800acc:	e8 d3 fb ff ff       	call   8006a4 <fd_lookup>
+  800ad1:	83 c4 10             	add    $0x10,%esp
+  800ad4:	85 c0                	test   %eax,%eax
+  800ad6:	78 0e                	js     800ae6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800ad8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800adb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ade:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae6:	c9                   	leave
+  800ae7:	c3                   	ret
+
+00800ae8 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	53                   	push   %ebx
+  800aec:	83 ec 1c             	sub    $0x1c,%esp
+  800aef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800af2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800af5:	50                   	push   %eax
+  800af6:	ff 75 08             	push   0x8(%ebp)
+  800af9:	e8 a6 fb ff ff       	call   8006a4 <fd_lookup>
+  800afe:	83 c4 10             	add    $0x10,%esp
+  800b01:	85 c0                	test   %eax,%eax
+  800b03:	78 33                	js     800b38 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800b05:	83 fb 03             	cmp    $0x3,%ebx
+  800b08:	74 28                	je     800b32 <fcntl+0x4a>
+  800b0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b0f:	83 fb 04             	cmp    $0x4,%ebx
+  800b12:	75 24                	jne    800b38 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800b14:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800b17:	8b 41 08             	mov    0x8(%ecx),%eax
+  800b1a:	80 e4 ef             	and    $0xef,%ah
+  800b1d:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b20:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800b26:	09 d0                	or     %edx,%eax
+  800b28:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b30:	eb 06                	jmp    800b38 <fcntl+0x50>
+		return fd->fd_omode;
+  800b32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b35:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b3b:	c9                   	leave
+  800b3c:	c3                   	ret
+
+00800b3d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	56                   	push   %esi
+  800b41:	53                   	push   %ebx
+  800b42:	83 ec 18             	sub    $0x18,%esp
+  800b45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b48:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b4b:	50                   	push   %eax
+  800b4c:	53                   	push   %ebx
+  800b4d:	e8 52 fb ff ff       	call   8006a4 <fd_lookup>
+  800b52:	83 c4 10             	add    $0x10,%esp
+  800b55:	85 c0                	test   %eax,%eax
+  800b57:	78 34                	js     800b8d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b59:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b5c:	83 ec 08             	sub    $0x8,%esp
+  800b5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b62:	50                   	push   %eax
+  800b63:	ff 36                	push   (%esi)
+  800b65:	e8 8c fb ff ff       	call   8006f6 <dev_lookup>
+  800b6a:	83 c4 10             	add    $0x10,%esp
+  800b6d:	85 c0                	test   %eax,%eax
+  800b6f:	78 1c                	js     800b8d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b71:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b75:	74 1d                	je     800b94 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b7a:	8b 40 18             	mov    0x18(%eax),%eax
+  800b7d:	85 c0                	test   %eax,%eax
+  800b7f:	74 51                	je     800bd2 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b81:	83 ec 08             	sub    $0x8,%esp
+  800b84:	ff 75 0c             	push   0xc(%ebp)
+  800b87:	56                   	push   %esi
+  800b88:	ff d0                	call   *%eax
+  800b8a:	83 c4 10             	add    $0x10,%esp
+}
+  800b8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b90:	5b                   	pop    %ebx
+  800b91:	5e                   	pop    %esi
+  800b92:	5d                   	pop    %ebp
+  800b93:	c3                   	ret
+  800b94:	89 e2                	mov    %esp,%edx
+  800b96:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b9b:	29 d0                	sub    %edx,%eax
+  800b9d:	89 c2                	mov    %eax,%edx
+  800b9f:	c1 ea 0f             	shr    $0xf,%edx
+  800ba2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bac:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800baf:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800bb6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bb9:	83 ec 04             	sub    $0x4,%esp
+  800bbc:	53                   	push   %ebx
+  800bbd:	50                   	push   %eax
+  800bbe:	68 f8 3a 80 00       	push   $0x803af8
+  800bc3:	e8 18 1f 00 00       	call   802ae0 <cprintf>
+		return -E_INVAL;
+  800bc8:	83 c4 10             	add    $0x10,%esp
+  800bcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd0:	eb bb                	jmp    800b8d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bd2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bd7:	eb b4                	jmp    800b8d <ftruncate+0x50>
+
+00800bd9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	56                   	push   %esi
+  800bdd:	53                   	push   %ebx
+  800bde:	83 ec 18             	sub    $0x18,%esp
+  800be1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800be4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800be7:	50                   	push   %eax
+  800be8:	ff 75 08             	push   0x8(%ebp)
+  800beb:	e8 b4 fa ff ff       	call   8006a4 <fd_lookup>
+  800bf0:	83 c4 10             	add    $0x10,%esp
+  800bf3:	85 c0                	test   %eax,%eax
+  800bf5:	78 53                	js     800c4a <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bf7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bfa:	83 ec 08             	sub    $0x8,%esp
+  800bfd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c00:	50                   	push   %eax
+  800c01:	ff 36                	push   (%esi)
+  800c03:	e8 ee fa ff ff       	call   8006f6 <dev_lookup>
+  800c08:	83 c4 10             	add    $0x10,%esp
+  800c0b:	85 c0                	test   %eax,%eax
+  800c0d:	78 3b                	js     800c4a <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c12:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c16:	74 39                	je     800c51 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c18:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c1b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c22:	00 00 00 
+	stat->st_isdir = 0;
+  800c25:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c2c:	00 00 00 
+	stat->st_version = 0;
+  800c2f:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c36:	00 00 00 
+	stat->st_dev = dev;
+  800c39:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c3f:	83 ec 08             	sub    $0x8,%esp
+  800c42:	53                   	push   %ebx
+  800c43:	56                   	push   %esi
+  800c44:	ff 50 14             	call   *0x14(%eax)
+  800c47:	83 c4 10             	add    $0x10,%esp
+}
+  800c4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c4d:	5b                   	pop    %ebx
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c51:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c56:	eb f2                	jmp    800c4a <fstat+0x71>
+
+00800c58 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	56                   	push   %esi
+  800c5c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c5d:	83 ec 08             	sub    $0x8,%esp
+  800c60:	6a 00                	push   $0x0
+  800c62:	ff 75 08             	push   0x8(%ebp)
+  800c65:	e8 b7 01 00 00       	call   800e21 <open>
+  800c6a:	89 c3                	mov    %eax,%ebx
+  800c6c:	83 c4 10             	add    $0x10,%esp
+  800c6f:	85 c0                	test   %eax,%eax
+  800c71:	78 1b                	js     800c8e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c73:	83 ec 08             	sub    $0x8,%esp
+  800c76:	ff 75 0c             	push   0xc(%ebp)
+  800c79:	50                   	push   %eax
+  800c7a:	e8 5a ff ff ff       	call   800bd9 <fstat>
+  800c7f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c81:	89 1c 24             	mov    %ebx,(%esp)
+  800c84:	e8 60 fb ff ff       	call   8007e9 <close>
+	return r;
+  800c89:	83 c4 10             	add    $0x10,%esp
+  800c8c:	89 f3                	mov    %esi,%ebx
+}
+  800c8e:	89 d8                	mov    %ebx,%eax
+  800c90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+
+00800c97 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  800c9c:	89 c6                	mov    %eax,%esi
+  800c9e:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800ca0:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800ca7:	74 27                	je     800cd0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ca9:	6a 07                	push   $0x7
+  800cab:	68 00 60 80 00       	push   $0x806000
+  800cb0:	56                   	push   %esi
+  800cb1:	ff 35 00 50 80 00    	push   0x805000
+  800cb7:	e8 23 2b 00 00       	call   8037df <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800cbc:	83 c4 0c             	add    $0xc,%esp
+  800cbf:	6a 00                	push   $0x0
+  800cc1:	53                   	push   %ebx
+  800cc2:	6a 00                	push   $0x0
+  800cc4:	e8 86 28 00 00       	call   80354f <ipc_recv>
+}
+  800cc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5d                   	pop    %ebp
+  800ccf:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cd0:	83 ec 0c             	sub    $0xc,%esp
+  800cd3:	6a 02                	push   $0x2
+  800cd5:	e8 6e 2b 00 00       	call   803848 <ipc_find_env>
+  800cda:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cdf:	83 c4 10             	add    $0x10,%esp
+  800ce2:	eb c5                	jmp    800ca9 <fsipc+0x12>
+
+00800ce4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ced:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cf0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cf8:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800cfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d02:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d07:	e8 8b ff ff ff       	call   800c97 <fsipc>
+}
+  800d0c:	c9                   	leave
+  800d0d:	c3                   	ret
+
+00800d0e <devfile_flush>:
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d17:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d1a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d24:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d29:	e8 69 ff ff ff       	call   800c97 <fsipc>
+}
+  800d2e:	c9                   	leave
+  800d2f:	c3                   	ret
+
+00800d30 <devfile_stat>:
+{
+  800d30:	55                   	push   %ebp
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	53                   	push   %ebx
+  800d34:	83 ec 04             	sub    $0x4,%esp
+  800d37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d40:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d4f:	e8 43 ff ff ff       	call   800c97 <fsipc>
+  800d54:	85 c0                	test   %eax,%eax
+  800d56:	78 37                	js     800d8f <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d58:	83 ec 08             	sub    $0x8,%esp
+  800d5b:	68 00 60 80 00       	push   $0x806000
+  800d60:	53                   	push   %ebx
+  800d61:	e8 71 24 00 00       	call   8031d7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d66:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d6b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d71:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d76:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d7c:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d81:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d87:	83 c4 10             	add    $0x10,%esp
+  800d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d92:	c9                   	leave
+  800d93:	c3                   	ret
+
+00800d94 <devfile_write>:
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	83 ec 0c             	sub    $0xc,%esp
+  800d9a:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d9d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800da2:	39 d0                	cmp    %edx,%eax
+  800da4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dad:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800db3:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800db8:	50                   	push   %eax
+  800db9:	ff 75 0c             	push   0xc(%ebp)
+  800dbc:	68 08 60 80 00       	push   $0x806008
+  800dc1:	e8 c1 25 00 00       	call   803387 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcb:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dd0:	e8 c2 fe ff ff       	call   800c97 <fsipc>
+}
+  800dd5:	c9                   	leave
+  800dd6:	c3                   	ret
+
+00800dd7 <devfile_read>:
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	53                   	push   %ebx
+  800ddb:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800dde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800de4:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800de9:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dec:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800df1:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800df6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dfb:	e8 97 fe ff ff       	call   800c97 <fsipc>
+  800e00:	89 c3                	mov    %eax,%ebx
+  800e02:	85 c0                	test   %eax,%eax
+  800e04:	78 14                	js     800e1a <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800e06:	83 ec 04             	sub    $0x4,%esp
+  800e09:	50                   	push   %eax
+  800e0a:	68 00 60 80 00       	push   $0x806000
+  800e0f:	ff 75 0c             	push   0xc(%ebp)
+  800e12:	e8 70 25 00 00       	call   803387 <memmove>
+	return r;
+  800e17:	83 c4 10             	add    $0x10,%esp
+}
+  800e1a:	89 d8                	mov    %ebx,%eax
+  800e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e1f:	c9                   	leave
+  800e20:	c3                   	ret
+
+00800e21 <open>:
+{
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	53                   	push   %ebx
+  800e25:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800e28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e2b:	50                   	push   %eax
+  800e2c:	e8 23 f8 ff ff       	call   800654 <fd_alloc>
+  800e31:	89 c3                	mov    %eax,%ebx
+  800e33:	83 c4 10             	add    $0x10,%esp
+  800e36:	85 c0                	test   %eax,%eax
+  800e38:	78 2a                	js     800e64 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e3a:	83 ec 0c             	sub    $0xc,%esp
+  800e3d:	ff 75 08             	push   0x8(%ebp)
+  800e40:	e8 46 23 00 00       	call   80318b <strlen>
+  800e45:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e48:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e4d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e52:	7e 17                	jle    800e6b <open+0x4a>
+	fd_close(fd, 1);
+  800e54:	83 ec 08             	sub    $0x8,%esp
+  800e57:	6a 01                	push   $0x1
+  800e59:	ff 75 f4             	push   -0xc(%ebp)
+  800e5c:	e8 08 f9 ff ff       	call   800769 <fd_close>
+	return r;
+  800e61:	83 c4 10             	add    $0x10,%esp
+}
+  800e64:	89 d8                	mov    %ebx,%eax
+  800e66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e69:	c9                   	leave
+  800e6a:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e6b:	83 ec 08             	sub    $0x8,%esp
+  800e6e:	ff 75 08             	push   0x8(%ebp)
+  800e71:	68 00 60 80 00       	push   $0x806000
+  800e76:	e8 5c 23 00 00       	call   8031d7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e7e:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e83:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e86:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e8b:	e8 07 fe ff ff       	call   800c97 <fsipc>
+  800e90:	89 c3                	mov    %eax,%ebx
+  800e92:	83 c4 10             	add    $0x10,%esp
+  800e95:	85 c0                	test   %eax,%eax
+  800e97:	78 bb                	js     800e54 <open+0x33>
+	return fd2num(fd); 	
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	ff 75 f4             	push   -0xc(%ebp)
+  800e9f:	e8 89 f7 ff ff       	call   80062d <fd2num>
+  800ea4:	89 c3                	mov    %eax,%ebx
+  800ea6:	83 c4 10             	add    $0x10,%esp
+  800ea9:	eb b9                	jmp    800e64 <open+0x43>
+
+00800eab <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	53                   	push   %ebx
+  800eaf:	83 ec 1c             	sub    $0x1c,%esp
+  800eb2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800eb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800eb8:	50                   	push   %eax
+  800eb9:	ff 75 08             	push   0x8(%ebp)
+  800ebc:	e8 e3 f7 ff ff       	call   8006a4 <fd_lookup>
+  800ec1:	83 c4 10             	add    $0x10,%esp
+  800ec4:	85 c0                	test   %eax,%eax
+  800ec6:	78 5a                	js     800f22 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800ec8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ecb:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800ed1:	39 10                	cmp    %edx,(%eax)
+  800ed3:	75 66                	jne    800f3b <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800ed5:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800edc:	74 49                	je     800f27 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800ede:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ee4:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800ee9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eec:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800ef1:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ef7:	6a 07                	push   $0x7
+  800ef9:	68 00 60 80 00       	push   $0x806000
+  800efe:	6a 09                	push   $0x9
+  800f00:	ff 35 00 50 80 00    	push   0x805000
+  800f06:	e8 d4 28 00 00       	call   8037df <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800f0b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800f12:	6a 00                	push   $0x0
+  800f14:	53                   	push   %ebx
+  800f15:	ff 75 10             	push   0x10(%ebp)
+  800f18:	6a 00                	push   $0x0
+  800f1a:	e8 fd 26 00 00       	call   80361c <ipc_recv_pages>
+  800f1f:	83 c4 20             	add    $0x20,%esp
+}
+  800f22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f25:	c9                   	leave
+  800f26:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+  800f2a:	6a 02                	push   $0x2
+  800f2c:	e8 17 29 00 00       	call   803848 <ipc_find_env>
+  800f31:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f36:	83 c4 10             	add    $0x10,%esp
+  800f39:	eb a3                	jmp    800ede <fmap+0x33>
+		return -E_INVAL;
+  800f3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f40:	eb e0                	jmp    800f22 <fmap+0x77>
+
+00800f42 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	53                   	push   %ebx
+  800f46:	83 ec 10             	sub    $0x10,%esp
+  800f49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f4c:	53                   	push   %ebx
+  800f4d:	e8 39 22 00 00       	call   80318b <strlen>
+  800f52:	83 c4 10             	add    $0x10,%esp
+  800f55:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f5a:	7f 25                	jg     800f81 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f5c:	83 ec 08             	sub    $0x8,%esp
+  800f5f:	53                   	push   %ebx
+  800f60:	68 00 60 80 00       	push   $0x806000
+  800f65:	e8 6d 22 00 00       	call   8031d7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6f:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f74:	e8 1e fd ff ff       	call   800c97 <fsipc>
+  800f79:	83 c4 10             	add    $0x10,%esp
+}
+  800f7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f7f:	c9                   	leave
+  800f80:	c3                   	ret
+		return -E_BAD_PATH;
+  800f81:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f86:	eb f4                	jmp    800f7c <remove+0x3a>
+
+00800f88 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f93:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f98:	e8 fa fc ff ff       	call   800c97 <fsipc>
+}
+  800f9d:	c9                   	leave
+  800f9e:	c3                   	ret
+
+00800f9f <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800fa5:	68 68 3b 80 00       	push   $0x803b68
+  800faa:	ff 75 0c             	push   0xc(%ebp)
+  800fad:	e8 25 22 00 00       	call   8031d7 <strcpy>
+	return 0;
+}
+  800fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb7:	c9                   	leave
+  800fb8:	c3                   	ret
+
+00800fb9 <devsock_close>:
+{
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 10             	sub    $0x10,%esp
+  800fc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800fc3:	53                   	push   %ebx
+  800fc4:	e8 be 28 00 00       	call   803887 <pageref>
+  800fc9:	89 c2                	mov    %eax,%edx
+  800fcb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800fce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fd3:	83 fa 01             	cmp    $0x1,%edx
+  800fd6:	74 05                	je     800fdd <devsock_close+0x24>
+}
+  800fd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fdb:	c9                   	leave
+  800fdc:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fdd:	83 ec 0c             	sub    $0xc,%esp
+  800fe0:	ff 73 0c             	push   0xc(%ebx)
+  800fe3:	e8 b0 05 00 00       	call   801598 <nsipc_close>
+  800fe8:	83 c4 10             	add    $0x10,%esp
+  800feb:	eb eb                	jmp    800fd8 <devsock_close+0x1f>
+
+00800fed <devsock_write>:
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	53                   	push   %ebx
+  800ff1:	83 ec 14             	sub    $0x14,%esp
+  800ff4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ff7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ffa:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800ffd:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801000:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801003:	8b 41 08             	mov    0x8(%ecx),%eax
+  801006:	c1 f8 09             	sar    $0x9,%eax
+  801009:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80100c:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801012:	77 13                	ja     801027 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801014:	50                   	push   %eax
+  801015:	52                   	push   %edx
+  801016:	53                   	push   %ebx
+  801017:	ff 71 0c             	push   0xc(%ecx)
+  80101a:	e8 5c 06 00 00       	call   80167b <nsipc_send>
+  80101f:	83 c4 10             	add    $0x10,%esp
+}
+  801022:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801025:	c9                   	leave
+  801026:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801027:	50                   	push   %eax
+  801028:	6a 01                	push   $0x1
+  80102a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80102d:	50                   	push   %eax
+  80102e:	ff 71 0c             	push   0xc(%ecx)
+  801031:	e8 a6 06 00 00       	call   8016dc <nsipc_sendmsg>
+  801036:	83 c4 10             	add    $0x10,%esp
+  801039:	eb e7                	jmp    801022 <devsock_write+0x35>
+
+0080103b <devsock_read>:
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	53                   	push   %ebx
+  80103f:	83 ec 14             	sub    $0x14,%esp
+  801042:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801045:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801048:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80104b:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80104e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801051:	8b 41 08             	mov    0x8(%ecx),%eax
+  801054:	c1 f8 09             	sar    $0x9,%eax
+  801057:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80105a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801060:	77 13                	ja     801075 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801062:	50                   	push   %eax
+  801063:	52                   	push   %edx
+  801064:	53                   	push   %ebx
+  801065:	ff 71 0c             	push   0xc(%ecx)
+  801068:	e8 9c 05 00 00       	call   801609 <nsipc_recv>
+  80106d:	83 c4 10             	add    $0x10,%esp
+}
+  801070:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801073:	c9                   	leave
+  801074:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801075:	50                   	push   %eax
+  801076:	6a 01                	push   $0x1
+  801078:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80107b:	50                   	push   %eax
+  80107c:	ff 71 0c             	push   0xc(%ecx)
+  80107f:	e8 02 0a 00 00       	call   801a86 <nsipc_recvmsg>
+  801084:	83 c4 10             	add    $0x10,%esp
+  801087:	eb e7                	jmp    801070 <devsock_read+0x35>
+
+00801089 <fd2sockid>:
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80108f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801092:	52                   	push   %edx
+  801093:	50                   	push   %eax
+  801094:	e8 0b f6 ff ff       	call   8006a4 <fd_lookup>
+  801099:	83 c4 10             	add    $0x10,%esp
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	78 10                	js     8010b0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8010a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a3:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8010a9:	39 08                	cmp    %ecx,(%eax)
+  8010ab:	75 05                	jne    8010b2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8010ad:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8010b0:	c9                   	leave
+  8010b1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8010b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8010b7:	eb f7                	jmp    8010b0 <fd2sockid+0x27>
+
+008010b9 <sock_flags>:
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8010bf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8010c2:	52                   	push   %edx
+  8010c3:	50                   	push   %eax
+  8010c4:	e8 db f5 ff ff       	call   8006a4 <fd_lookup>
+  8010c9:	83 c4 10             	add    $0x10,%esp
+  8010cc:	85 c0                	test   %eax,%eax
+  8010ce:	78 0e                	js     8010de <sock_flags+0x25>
+  8010d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010d3:	8b 40 08             	mov    0x8(%eax),%eax
+  8010d6:	c1 e8 09             	shr    $0x9,%eax
+  8010d9:	83 e0 08             	and    $0x8,%eax
+}
+  8010dc:	c9                   	leave
+  8010dd:	c3                   	ret
+		return 0;
+  8010de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e3:	eb f7                	jmp    8010dc <sock_flags+0x23>
+
+008010e5 <alloc_sockfd>:
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+  8010ea:	83 ec 1c             	sub    $0x1c,%esp
+  8010ed:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010f2:	50                   	push   %eax
+  8010f3:	e8 5c f5 ff ff       	call   800654 <fd_alloc>
+  8010f8:	89 c3                	mov    %eax,%ebx
+  8010fa:	83 c4 10             	add    $0x10,%esp
+  8010fd:	85 c0                	test   %eax,%eax
+  8010ff:	78 43                	js     801144 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801101:	83 ec 04             	sub    $0x4,%esp
+  801104:	68 07 04 00 00       	push   $0x407
+  801109:	ff 75 f4             	push   -0xc(%ebp)
+  80110c:	6a 00                	push   $0x0
+  80110e:	e8 b7 f0 ff ff       	call   8001ca <sys_page_alloc>
+  801113:	89 c3                	mov    %eax,%ebx
+  801115:	83 c4 10             	add    $0x10,%esp
+  801118:	85 c0                	test   %eax,%eax
+  80111a:	78 28                	js     801144 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80111c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80111f:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801125:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801127:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80112a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801131:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	50                   	push   %eax
+  801138:	e8 f0 f4 ff ff       	call   80062d <fd2num>
+  80113d:	89 c3                	mov    %eax,%ebx
+  80113f:	83 c4 10             	add    $0x10,%esp
+  801142:	eb 0c                	jmp    801150 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801144:	83 ec 0c             	sub    $0xc,%esp
+  801147:	56                   	push   %esi
+  801148:	e8 4b 04 00 00       	call   801598 <nsipc_close>
+		return r;
+  80114d:	83 c4 10             	add    $0x10,%esp
+}
+  801150:	89 d8                	mov    %ebx,%eax
+  801152:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801155:	5b                   	pop    %ebx
+  801156:	5e                   	pop    %esi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+
+00801159 <accept>:
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	56                   	push   %esi
+  80115d:	53                   	push   %ebx
+  80115e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801161:	89 f0                	mov    %esi,%eax
+  801163:	e8 21 ff ff ff       	call   801089 <fd2sockid>
+  801168:	89 c3                	mov    %eax,%ebx
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	78 24                	js     801192 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80116e:	89 f0                	mov    %esi,%eax
+  801170:	e8 44 ff ff ff       	call   8010b9 <sock_flags>
+  801175:	50                   	push   %eax
+  801176:	ff 75 10             	push   0x10(%ebp)
+  801179:	ff 75 0c             	push   0xc(%ebp)
+  80117c:	53                   	push   %ebx
+  80117d:	e8 6b 03 00 00       	call   8014ed <nsipc_accept>
+  801182:	89 c3                	mov    %eax,%ebx
+  801184:	83 c4 10             	add    $0x10,%esp
+  801187:	85 c0                	test   %eax,%eax
+  801189:	78 07                	js     801192 <accept+0x39>
+	return alloc_sockfd(r);
+  80118b:	e8 55 ff ff ff       	call   8010e5 <alloc_sockfd>
+  801190:	89 c3                	mov    %eax,%ebx
+}
+  801192:	89 d8                	mov    %ebx,%eax
+  801194:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+
+0080119b <bind>:
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011a4:	e8 e0 fe ff ff       	call   801089 <fd2sockid>
+  8011a9:	85 c0                	test   %eax,%eax
+  8011ab:	78 12                	js     8011bf <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8011ad:	83 ec 04             	sub    $0x4,%esp
+  8011b0:	ff 75 10             	push   0x10(%ebp)
+  8011b3:	ff 75 0c             	push   0xc(%ebp)
+  8011b6:	50                   	push   %eax
+  8011b7:	e8 85 03 00 00       	call   801541 <nsipc_bind>
+  8011bc:	83 c4 10             	add    $0x10,%esp
+}
+  8011bf:	c9                   	leave
+  8011c0:	c3                   	ret
+
+008011c1 <shutdown>:
+{
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ca:	e8 ba fe ff ff       	call   801089 <fd2sockid>
+  8011cf:	85 c0                	test   %eax,%eax
+  8011d1:	78 0f                	js     8011e2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011d3:	83 ec 08             	sub    $0x8,%esp
+  8011d6:	ff 75 0c             	push   0xc(%ebp)
+  8011d9:	50                   	push   %eax
+  8011da:	e8 97 03 00 00       	call   801576 <nsipc_shutdown>
+  8011df:	83 c4 10             	add    $0x10,%esp
+}
+  8011e2:	c9                   	leave
+  8011e3:	c3                   	ret
+
+008011e4 <connect>:
+{
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ed:	e8 97 fe ff ff       	call   801089 <fd2sockid>
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	78 12                	js     801208 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011f6:	83 ec 04             	sub    $0x4,%esp
+  8011f9:	ff 75 10             	push   0x10(%ebp)
+  8011fc:	ff 75 0c             	push   0xc(%ebp)
+  8011ff:	50                   	push   %eax
+  801200:	e8 ad 03 00 00       	call   8015b2 <nsipc_connect>
+  801205:	83 c4 10             	add    $0x10,%esp
+}
+  801208:	c9                   	leave
+  801209:	c3                   	ret
+
+0080120a <listen>:
+{
+  80120a:	55                   	push   %ebp
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801210:	8b 45 08             	mov    0x8(%ebp),%eax
+  801213:	e8 71 fe ff ff       	call   801089 <fd2sockid>
+  801218:	85 c0                	test   %eax,%eax
+  80121a:	78 0f                	js     80122b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80121c:	83 ec 08             	sub    $0x8,%esp
+  80121f:	ff 75 0c             	push   0xc(%ebp)
+  801222:	50                   	push   %eax
+  801223:	e8 bf 03 00 00       	call   8015e7 <nsipc_listen>
+  801228:	83 c4 10             	add    $0x10,%esp
+}
+  80122b:	c9                   	leave
+  80122c:	c3                   	ret
+
+0080122d <sendmsg>:
+{
+  80122d:	55                   	push   %ebp
+  80122e:	89 e5                	mov    %esp,%ebp
+  801230:	57                   	push   %edi
+  801231:	56                   	push   %esi
+  801232:	53                   	push   %ebx
+  801233:	83 ec 0c             	sub    $0xc,%esp
+  801236:	8b 75 08             	mov    0x8(%ebp),%esi
+  801239:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80123c:	89 f0                	mov    %esi,%eax
+  80123e:	e8 46 fe ff ff       	call   801089 <fd2sockid>
+  801243:	89 c3                	mov    %eax,%ebx
+  801245:	85 c0                	test   %eax,%eax
+  801247:	78 1c                	js     801265 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801249:	89 f0                	mov    %esi,%eax
+  80124b:	e8 69 fe ff ff       	call   8010b9 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801250:	0b 45 10             	or     0x10(%ebp),%eax
+  801253:	50                   	push   %eax
+  801254:	ff 77 0c             	push   0xc(%edi)
+  801257:	ff 77 08             	push   0x8(%edi)
+  80125a:	53                   	push   %ebx
+  80125b:	e8 7c 04 00 00       	call   8016dc <nsipc_sendmsg>
+  801260:	89 c3                	mov    %eax,%ebx
+  801262:	83 c4 10             	add    $0x10,%esp
+}
+  801265:	89 d8                	mov    %ebx,%eax
+  801267:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126a:	5b                   	pop    %ebx
+  80126b:	5e                   	pop    %esi
+  80126c:	5f                   	pop    %edi
+  80126d:	5d                   	pop    %ebp
+  80126e:	c3                   	ret
+
+0080126f <recvmsg>:
+{
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	57                   	push   %edi
+  801273:	56                   	push   %esi
+  801274:	53                   	push   %ebx
+  801275:	83 ec 0c             	sub    $0xc,%esp
+  801278:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80127b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80127e:	89 f8                	mov    %edi,%eax
+  801280:	e8 04 fe ff ff       	call   801089 <fd2sockid>
+  801285:	89 c3                	mov    %eax,%ebx
+  801287:	85 c0                	test   %eax,%eax
+  801289:	78 2a                	js     8012b5 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80128b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801292:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801299:	89 f8                	mov    %edi,%eax
+  80129b:	e8 19 fe ff ff       	call   8010b9 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8012a0:	0b 45 10             	or     0x10(%ebp),%eax
+  8012a3:	50                   	push   %eax
+  8012a4:	ff 76 0c             	push   0xc(%esi)
+  8012a7:	ff 76 08             	push   0x8(%esi)
+  8012aa:	53                   	push   %ebx
+  8012ab:	e8 d6 07 00 00       	call   801a86 <nsipc_recvmsg>
+  8012b0:	89 c3                	mov    %eax,%ebx
+  8012b2:	83 c4 10             	add    $0x10,%esp
+}
+  8012b5:	89 d8                	mov    %ebx,%eax
+  8012b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ba:	5b                   	pop    %ebx
+  8012bb:	5e                   	pop    %esi
+  8012bc:	5f                   	pop    %edi
+  8012bd:	5d                   	pop    %ebp
+  8012be:	c3                   	ret
+
+008012bf <sendfile>:
+{
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+  8012c4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8012c7:	89 f0                	mov    %esi,%eax
+  8012c9:	e8 bb fd ff ff       	call   801089 <fd2sockid>
+  8012ce:	89 c3                	mov    %eax,%ebx
+  8012d0:	85 c0                	test   %eax,%eax
+  8012d2:	78 1f                	js     8012f3 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012d4:	89 f0                	mov    %esi,%eax
+  8012d6:	e8 de fd ff ff       	call   8010b9 <sock_flags>
+  8012db:	83 ec 0c             	sub    $0xc,%esp
+  8012de:	50                   	push   %eax
+  8012df:	ff 75 14             	push   0x14(%ebp)
+  8012e2:	ff 75 10             	push   0x10(%ebp)
+  8012e5:	ff 75 0c             	push   0xc(%ebp)
+  8012e8:	53                   	push   %ebx
+  8012e9:	e8 64 06 00 00       	call   801952 <nsipc_sendfile>
+  8012ee:	89 c3                	mov    %eax,%ebx
+  8012f0:	83 c4 20             	add    $0x20,%esp
+}
+  8012f3:	89 d8                	mov    %ebx,%eax
+  8012f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012f8:	5b                   	pop    %ebx
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	c3                   	ret
+
+008012fc <evctl>:
+{
+  8012fc:	55                   	push   %ebp
+  8012fd:	89 e5                	mov    %esp,%ebp
+  8012ff:	53                   	push   %ebx
+  801300:	83 ec 04             	sub    $0x4,%esp
+  801303:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801306:	89 d8                	mov    %ebx,%eax
+  801308:	e8 7c fd ff ff       	call   801089 <fd2sockid>
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	78 10                	js     801321 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801311:	83 ec 04             	sub    $0x4,%esp
+  801314:	53                   	push   %ebx
+  801315:	ff 75 0c             	push   0xc(%ebp)
+  801318:	50                   	push   %eax
+  801319:	e8 d2 0b 00 00       	call   801ef0 <nsipc_evctl>
+  80131e:	83 c4 10             	add    $0x10,%esp
+}
+  801321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801324:	c9                   	leave
+  801325:	c3                   	ret
+
+00801326 <evwait>:
+{
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80132c:	ff 75 10             	push   0x10(%ebp)
+  80132f:	ff 75 0c             	push   0xc(%ebp)
+  801332:	ff 75 08             	push   0x8(%ebp)
+  801335:	e8 e0 0b 00 00       	call   801f1a <nsipc_evwait>
+}
+  80133a:	c9                   	leave
+  80133b:	c3                   	ret
+
+0080133c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801342:	ff 75 10             	push   0x10(%ebp)
+  801345:	ff 75 0c             	push   0xc(%ebp)
+  801348:	ff 75 08             	push   0x8(%ebp)
+  80134b:	e8 31 0c 00 00       	call   801f81 <nsipc_socket>
+  801350:	83 c4 10             	add    $0x10,%esp
+  801353:	85 c0                	test   %eax,%eax
+  801355:	78 05                	js     80135c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801357:	e8 89 fd ff ff       	call   8010e5 <alloc_sockfd>
+}
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+
+0080135e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	53                   	push   %ebx
+  801362:	83 ec 04             	sub    $0x4,%esp
+  801365:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801367:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80136e:	74 26                	je     801396 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801370:	6a 07                	push   $0x7
+  801372:	68 00 70 80 00       	push   $0x807000
+  801377:	53                   	push   %ebx
+  801378:	ff 35 24 53 80 00    	push   0x805324
+  80137e:	e8 5c 24 00 00       	call   8037df <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801383:	83 c4 0c             	add    $0xc,%esp
+  801386:	6a 00                	push   $0x0
+  801388:	6a 00                	push   $0x0
+  80138a:	6a 00                	push   $0x0
+  80138c:	e8 be 21 00 00       	call   80354f <ipc_recv>
+}
+  801391:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801394:	c9                   	leave
+  801395:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801396:	83 ec 0c             	sub    $0xc,%esp
+  801399:	6a 03                	push   $0x3
+  80139b:	e8 a8 24 00 00       	call   803848 <ipc_find_env>
+  8013a0:	a3 24 53 80 00       	mov    %eax,0x805324
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	eb c6                	jmp    801370 <nsipc+0x12>
+
+008013aa <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	56                   	push   %esi
+  8013ae:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8013af:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8013ba:	85 f6                	test   %esi,%esi
+  8013bc:	75 33                	jne    8013f1 <nsbulk_map+0x47>
+  8013be:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8013c3:	83 ec 04             	sub    $0x4,%esp
+  8013c6:	6a 07                	push   $0x7
+  8013c8:	53                   	push   %ebx
+  8013c9:	6a 00                	push   $0x0
+  8013cb:	e8 fa ed ff ff       	call   8001ca <sys_page_alloc>
+  8013d0:	83 c4 10             	add    $0x10,%esp
+  8013d3:	85 c0                	test   %eax,%eax
+  8013d5:	78 1a                	js     8013f1 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013d7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013dd:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013e3:	75 de                	jne    8013c3 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013e5:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013ec:	00 00 00 
+	return 0;
+  8013ef:	89 f0                	mov    %esi,%eax
+}
+  8013f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f4:	5b                   	pop    %ebx
+  8013f5:	5e                   	pop    %esi
+  8013f6:	5d                   	pop    %ebp
+  8013f7:	c3                   	ret
+
+008013f8 <nsbulk_own>:
+{
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	57                   	push   %edi
+  8013fc:	56                   	push   %esi
+  8013fd:	53                   	push   %ebx
+  8013fe:	83 ec 0c             	sub    $0xc,%esp
+  801401:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801403:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801406:	85 d2                	test   %edx,%edx
+  801408:	7f 0e                	jg     801418 <nsbulk_own+0x20>
+	return 0;
+  80140a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140f:	eb 47                	jmp    801458 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801411:	83 c3 01             	add    $0x1,%ebx
+  801414:	39 fb                	cmp    %edi,%ebx
+  801416:	7d 3b                	jge    801453 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801418:	be 01 00 00 00       	mov    $0x1,%esi
+  80141d:	89 d9                	mov    %ebx,%ecx
+  80141f:	d3 e6                	shl    %cl,%esi
+  801421:	89 f0                	mov    %esi,%eax
+  801423:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  801429:	74 e6                	je     801411 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80142b:	83 ec 04             	sub    $0x4,%esp
+  80142e:	6a 07                	push   $0x7
+  801430:	89 d8                	mov    %ebx,%eax
+  801432:	c1 e0 0c             	shl    $0xc,%eax
+  801435:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80143a:	50                   	push   %eax
+  80143b:	6a 00                	push   $0x0
+  80143d:	e8 88 ed ff ff       	call   8001ca <sys_page_alloc>
+  801442:	83 c4 10             	add    $0x10,%esp
+  801445:	85 c0                	test   %eax,%eax
+  801447:	78 0f                	js     801458 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801449:	f7 d6                	not    %esi
+  80144b:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801451:	eb be                	jmp    801411 <nsbulk_own+0x19>
+	return 0;
+  801453:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145b:	5b                   	pop    %ebx
+  80145c:	5e                   	pop    %esi
+  80145d:	5f                   	pop    %edi
+  80145e:	5d                   	pop    %ebp
+  80145f:	c3                   	ret
+
+00801460 <nsipc_bulk>:
+{
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	57                   	push   %edi
+  801464:	56                   	push   %esi
+  801465:	53                   	push   %ebx
+  801466:	83 ec 1c             	sub    $0x1c,%esp
+  801469:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80146c:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80146e:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801474:	c1 fb 0c             	sar    $0xc,%ebx
+  801477:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80147a:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801481:	74 56                	je     8014d9 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801483:	85 ff                	test   %edi,%edi
+  801485:	7e 24                	jle    8014ab <nsipc_bulk+0x4b>
+  801487:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80148d:	74 1c                	je     8014ab <nsipc_bulk+0x4b>
+  80148f:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801495:	c1 e3 0c             	shl    $0xc,%ebx
+  801498:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80149d:	0f b6 10             	movzbl (%eax),%edx
+  8014a0:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8014a2:	05 00 10 00 00       	add    $0x1000,%eax
+  8014a7:	39 d8                	cmp    %ebx,%eax
+  8014a9:	75 f2                	jne    80149d <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8014ab:	83 ec 0c             	sub    $0xc,%esp
+  8014ae:	56                   	push   %esi
+  8014af:	57                   	push   %edi
+  8014b0:	68 00 00 00 e0       	push   $0xe0000000
+  8014b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8014b8:	ff 35 24 53 80 00    	push   0x805324
+  8014be:	e8 50 23 00 00       	call   803813 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8014c3:	83 c4 1c             	add    $0x1c,%esp
+  8014c6:	6a 00                	push   $0x0
+  8014c8:	6a 00                	push   $0x0
+  8014ca:	6a 00                	push   $0x0
+  8014cc:	e8 7e 20 00 00       	call   80354f <ipc_recv>
+}
+  8014d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d4:	5b                   	pop    %ebx
+  8014d5:	5e                   	pop    %esi
+  8014d6:	5f                   	pop    %edi
+  8014d7:	5d                   	pop    %ebp
+  8014d8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014d9:	83 ec 0c             	sub    $0xc,%esp
+  8014dc:	6a 03                	push   $0x3
+  8014de:	e8 65 23 00 00       	call   803848 <ipc_find_env>
+  8014e3:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014e8:	83 c4 10             	add    $0x10,%esp
+  8014eb:	eb 96                	jmp    801483 <nsipc_bulk+0x23>
+
+008014ed <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	53                   	push   %ebx
+  8014f1:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f7:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014ff:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801504:	b8 01 00 00 00       	mov    $0x1,%eax
+  801509:	e8 50 fe ff ff       	call   80135e <nsipc>
+  80150e:	89 c3                	mov    %eax,%ebx
+  801510:	85 c0                	test   %eax,%eax
+  801512:	79 07                	jns    80151b <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801514:	89 d8                	mov    %ebx,%eax
+  801516:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801519:	c9                   	leave
+  80151a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80151b:	83 ec 04             	sub    $0x4,%esp
+  80151e:	ff 35 10 70 80 00    	push   0x807010
+  801524:	68 00 70 80 00       	push   $0x807000
+  801529:	ff 75 0c             	push   0xc(%ebp)
+  80152c:	e8 56 1e 00 00       	call   803387 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801531:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801537:	8b 45 10             	mov    0x10(%ebp),%eax
+  80153a:	89 10                	mov    %edx,(%eax)
+  80153c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80153f:	eb d3                	jmp    801514 <nsipc_accept+0x27>
+
+00801541 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	53                   	push   %ebx
+  801545:	83 ec 08             	sub    $0x8,%esp
+  801548:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80154b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80154e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801553:	53                   	push   %ebx
+  801554:	ff 75 0c             	push   0xc(%ebp)
+  801557:	68 04 70 80 00       	push   $0x807004
+  80155c:	e8 26 1e 00 00       	call   803387 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801561:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801567:	b8 02 00 00 00       	mov    $0x2,%eax
+  80156c:	e8 ed fd ff ff       	call   80135e <nsipc>
+}
+  801571:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801574:	c9                   	leave
+  801575:	c3                   	ret
+
+00801576 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80157c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80157f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801584:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801587:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80158c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801591:	e8 c8 fd ff ff       	call   80135e <nsipc>
+}
+  801596:	c9                   	leave
+  801597:	c3                   	ret
+
+00801598 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80159e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8015a6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015ab:	e8 ae fd ff ff       	call   80135e <nsipc>
+}
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+
+008015b2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8015b2:	55                   	push   %ebp
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	53                   	push   %ebx
+  8015b6:	83 ec 08             	sub    $0x8,%esp
+  8015b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8015bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015bf:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8015c4:	53                   	push   %ebx
+  8015c5:	ff 75 0c             	push   0xc(%ebp)
+  8015c8:	68 04 70 80 00       	push   $0x807004
+  8015cd:	e8 b5 1d 00 00       	call   803387 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015d2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015d8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015dd:	e8 7c fd ff ff       	call   80135e <nsipc>
+}
+  8015e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015e5:	c9                   	leave
+  8015e6:	c3                   	ret
+
+008015e7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015f8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015fd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801602:	e8 57 fd ff ff       	call   80135e <nsipc>
+}
+  801607:	c9                   	leave
+  801608:	c3                   	ret
+
+00801609 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801609:	55                   	push   %ebp
+  80160a:	89 e5                	mov    %esp,%ebp
+  80160c:	56                   	push   %esi
+  80160d:	53                   	push   %ebx
+  80160e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801611:	8b 45 08             	mov    0x8(%ebp),%eax
+  801614:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801619:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80161f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801622:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801627:	b8 07 00 00 00       	mov    $0x7,%eax
+  80162c:	e8 2d fd ff ff       	call   80135e <nsipc>
+  801631:	89 c3                	mov    %eax,%ebx
+  801633:	85 c0                	test   %eax,%eax
+  801635:	78 22                	js     801659 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801637:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80163c:	39 c6                	cmp    %eax,%esi
+  80163e:	0f 4e c6             	cmovle %esi,%eax
+  801641:	39 c3                	cmp    %eax,%ebx
+  801643:	7f 1d                	jg     801662 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801645:	83 ec 04             	sub    $0x4,%esp
+  801648:	53                   	push   %ebx
+  801649:	68 00 70 80 00       	push   $0x807000
+  80164e:	ff 75 0c             	push   0xc(%ebp)
+  801651:	e8 31 1d 00 00       	call   803387 <memmove>
+  801656:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801659:	89 d8                	mov    %ebx,%eax
+  80165b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80165e:	5b                   	pop    %ebx
+  80165f:	5e                   	pop    %esi
+  801660:	5d                   	pop    %ebp
+  801661:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801662:	68 74 3b 80 00       	push   $0x803b74
+  801667:	68 89 3b 80 00       	push   $0x803b89
+  80166c:	68 b2 00 00 00       	push   $0xb2
+  801671:	68 9e 3b 80 00       	push   $0x803b9e
+  801676:	e8 8a 13 00 00       	call   802a05 <_panic>
+
+0080167b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	53                   	push   %ebx
+  80167f:	83 ec 04             	sub    $0x4,%esp
+  801682:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801685:	8b 45 08             	mov    0x8(%ebp),%eax
+  801688:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80168d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801693:	7f 2e                	jg     8016c3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801695:	83 ec 04             	sub    $0x4,%esp
+  801698:	53                   	push   %ebx
+  801699:	ff 75 0c             	push   0xc(%ebp)
+  80169c:	68 0c 70 80 00       	push   $0x80700c
+  8016a1:	e8 e1 1c 00 00       	call   803387 <memmove>
+	nsipcbuf.send.req_size = size;
+  8016a6:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8016ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8016af:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8016b4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016b9:	e8 a0 fc ff ff       	call   80135e <nsipc>
+}
+  8016be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016c1:	c9                   	leave
+  8016c2:	c3                   	ret
+	assert(size < 1600);
+  8016c3:	68 aa 3b 80 00       	push   $0x803baa
+  8016c8:	68 89 3b 80 00       	push   $0x803b89
+  8016cd:	68 bd 00 00 00       	push   $0xbd
+  8016d2:	68 9e 3b 80 00       	push   $0x803b9e
+  8016d7:	e8 29 13 00 00       	call   802a05 <_panic>
+
+008016dc <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	57                   	push   %edi
+  8016e0:	56                   	push   %esi
+  8016e1:	53                   	push   %ebx
+  8016e2:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016e5:	e8 c0 fc ff ff       	call   8013aa <nsbulk_map>
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	78 55                	js     801743 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016ee:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016f5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016fc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801703:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801706:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801709:	0f 8d 24 02 00 00    	jge    801933 <nsipc_sendmsg+0x257>
+  80170f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801712:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801715:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  801718:	89 d8                	mov    %ebx,%eax
+  80171a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80171f:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  801721:	83 ec 0c             	sub    $0xc,%esp
+  801724:	68 20 50 80 00       	push   $0x805020
+  801729:	e8 5a 0f 00 00       	call   802688 <pgbatch_init>
+  80172e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801731:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801733:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  801736:	e9 82 00 00 00       	jmp    8017bd <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80173b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80173e:	85 db                	test   %ebx,%ebx
+  801740:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801743:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801746:	5b                   	pop    %ebx
+  801747:	5e                   	pop    %esi
+  801748:	5f                   	pop    %edi
+  801749:	5d                   	pop    %ebp
+  80174a:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80174b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801750:	29 c8                	sub    %ecx,%eax
+  801752:	39 d0                	cmp    %edx,%eax
+  801754:	0f 46 d0             	cmovbe %eax,%edx
+  801757:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  801759:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80175f:	85 ff                	test   %edi,%edi
+  801761:	0f 49 c7             	cmovns %edi,%eax
+  801764:	c1 f8 0c             	sar    $0xc,%eax
+  801767:	ba 01 00 00 00       	mov    $0x1,%edx
+  80176c:	e8 87 fc ff ff       	call   8013f8 <nsbulk_own>
+  801771:	85 c0                	test   %eax,%eax
+  801773:	0f 88 17 01 00 00    	js     801890 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  801779:	83 ec 04             	sub    $0x4,%esp
+  80177c:	56                   	push   %esi
+  80177d:	ff 75 e0             	push   -0x20(%ebp)
+  801780:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801783:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801788:	50                   	push   %eax
+  801789:	e8 f9 1b 00 00       	call   803387 <memmove>
+  80178e:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801791:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801794:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801797:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80179a:	0f 84 fd 00 00 00    	je     80189d <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8017a0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8017a3:	01 f7                	add    %esi,%edi
+  8017a5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8017a8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8017ab:	0f 8d 01 01 00 00    	jge    8018b2 <nsipc_sendmsg+0x1d6>
+  8017b1:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8017b7:	0f 8f f0 00 00 00    	jg     8018ad <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8017bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c0:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8017c3:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8017c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017c9:	89 c2                	mov    %eax,%edx
+  8017cb:	03 13                	add    (%ebx),%edx
+  8017cd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017d0:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017d3:	29 c6                	sub    %eax,%esi
+  8017d5:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017da:	29 f9                	sub    %edi,%ecx
+  8017dc:	39 ce                	cmp    %ecx,%esi
+  8017de:	89 ca                	mov    %ecx,%edx
+  8017e0:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017e3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017e6:	89 f9                	mov    %edi,%ecx
+  8017e8:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017f1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017f6:	09 c8                	or     %ecx,%eax
+  8017f8:	0f 85 4d ff ff ff    	jne    80174b <nsipc_sendmsg+0x6f>
+  8017fe:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801804:	0f 86 41 ff ff ff    	jbe    80174b <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80180a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801810:	85 ff                	test   %edi,%edi
+  801812:	0f 49 c7             	cmovns %edi,%eax
+  801815:	c1 f8 0c             	sar    $0xc,%eax
+  801818:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80181a:	89 d1                	mov    %edx,%ecx
+  80181c:	c1 e9 0c             	shr    $0xc,%ecx
+  80181f:	01 c8                	add    %ecx,%eax
+  801821:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801824:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801827:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  801829:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80182c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801831:	29 c8                	sub    %ecx,%eax
+  801833:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801836:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801839:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80183b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801840:	89 f9                	mov    %edi,%ecx
+  801842:	d3 e0                	shl    %cl,%eax
+  801844:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80184a:	83 ec 08             	sub    $0x8,%esp
+  80184d:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80184f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801852:	50                   	push   %eax
+  801853:	6a 00                	push   $0x0
+  801855:	56                   	push   %esi
+  801856:	6a 00                	push   $0x0
+  801858:	68 20 50 80 00       	push   $0x805020
+  80185d:	e8 e4 0e 00 00       	call   802746 <pgbatch_map>
+  801862:	83 c4 20             	add    $0x20,%esp
+  801865:	85 c0                	test   %eax,%eax
+  801867:	0f 88 ce fe ff ff    	js     80173b <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80186d:	83 c7 01             	add    $0x1,%edi
+  801870:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801876:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801879:	39 c7                	cmp    %eax,%edi
+  80187b:	75 be                	jne    80183b <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80187d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801880:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801883:	89 d6                	mov    %edx,%esi
+  801885:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80188b:	e9 01 ff ff ff       	jmp    801791 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801893:	85 db                	test   %ebx,%ebx
+  801895:	0f 45 c3             	cmovne %ebx,%eax
+  801898:	e9 a6 fe ff ff       	jmp    801743 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80189d:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8018a1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8018a8:	e9 f3 fe ff ff       	jmp    8017a0 <nsipc_sendmsg+0xc4>
+  8018ad:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8018b0:	eb 03                	jmp    8018b5 <nsipc_sendmsg+0x1d9>
+  8018b2:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8018b5:	83 ec 0c             	sub    $0xc,%esp
+  8018b8:	68 20 50 80 00       	push   $0x805020
+  8018bd:	e8 d4 0d 00 00       	call   802696 <pgbatch_flush>
+  8018c2:	83 c4 10             	add    $0x10,%esp
+  8018c5:	85 c0                	test   %eax,%eax
+  8018c7:	78 50                	js     801919 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8018c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cc:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018d1:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018d7:	89 fb                	mov    %edi,%ebx
+  8018d9:	29 f3                	sub    %esi,%ebx
+  8018db:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018e4:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018e9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018ee:	89 fa                	mov    %edi,%edx
+  8018f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018f5:	e8 66 fb ff ff       	call   801460 <nsipc_bulk>
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 28                	js     801926 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018fe:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  801901:	39 c3                	cmp    %eax,%ebx
+  801903:	75 0c                	jne    801911 <nsipc_sendmsg+0x235>
+  801905:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801908:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80190b:	0f 8f f2 fd ff ff    	jg     801703 <nsipc_sendmsg+0x27>
+		sent += r;
+  801911:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801914:	e9 2a fe ff ff       	jmp    801743 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801919:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80191c:	85 db                	test   %ebx,%ebx
+  80191e:	0f 45 c3             	cmovne %ebx,%eax
+  801921:	e9 1d fe ff ff       	jmp    801743 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801926:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801929:	85 db                	test   %ebx,%ebx
+  80192b:	0f 45 c3             	cmovne %ebx,%eax
+  80192e:	e9 10 fe ff ff       	jmp    801743 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801933:	83 ec 0c             	sub    $0xc,%esp
+  801936:	68 20 50 80 00       	push   $0x805020
+  80193b:	e8 48 0d 00 00       	call   802688 <pgbatch_init>
+  801940:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801943:	be 00 00 00 00       	mov    $0x0,%esi
+  801948:	bf 00 00 00 00       	mov    $0x0,%edi
+  80194d:	e9 63 ff ff ff       	jmp    8018b5 <nsipc_sendmsg+0x1d9>
+
+00801952 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801952:	55                   	push   %ebp
+  801953:	89 e5                	mov    %esp,%ebp
+  801955:	57                   	push   %edi
+  801956:	56                   	push   %esi
+  801957:	53                   	push   %ebx
+  801958:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80195b:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  801962:	0f 84 c8 00 00 00    	je     801a30 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  801968:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80196f:	0f 84 e4 00 00 00    	je     801a59 <nsipc_sendfile+0x107>
+{
+  801975:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80197a:	89 fb                	mov    %edi,%ebx
+  80197c:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80197f:	0f 83 f0 00 00 00    	jae    801a75 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  801985:	89 fa                	mov    %edi,%edx
+  801987:	03 55 10             	add    0x10(%ebp),%edx
+  80198a:	89 d0                	mov    %edx,%eax
+  80198c:	c1 f8 1f             	sar    $0x1f,%eax
+  80198f:	c1 e8 14             	shr    $0x14,%eax
+  801992:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  801995:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80199b:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80199d:	6a 10                	push   $0x10
+  80199f:	68 00 20 01 e0       	push   $0xe0012000
+  8019a4:	52                   	push   %edx
+  8019a5:	ff 75 0c             	push   0xc(%ebp)
+  8019a8:	e8 fe f4 ff ff       	call   800eab <fmap>
+  8019ad:	83 c4 10             	add    $0x10,%esp
+  8019b0:	85 c0                	test   %eax,%eax
+  8019b2:	0f 8e b8 00 00 00    	jle    801a70 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8019b8:	39 c6                	cmp    %eax,%esi
+  8019ba:	0f 8d b5 00 00 00    	jge    801a75 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8019c0:	29 f0                	sub    %esi,%eax
+  8019c2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8019c5:	29 da                	sub    %ebx,%edx
+  8019c7:	39 d0                	cmp    %edx,%eax
+  8019c9:	89 d3                	mov    %edx,%ebx
+  8019cb:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019d6:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019dc:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019e2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019e5:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019ea:	83 ec 0c             	sub    $0xc,%esp
+  8019ed:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019ef:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019f6:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019f9:	83 c0 01             	add    $0x1,%eax
+  8019fc:	50                   	push   %eax
+  8019fd:	68 00 10 01 e0       	push   $0xe0011000
+  801a02:	6a 11                	push   $0x11
+  801a04:	ff 35 24 53 80 00    	push   0x805324
+  801a0a:	e8 04 1e 00 00       	call   803813 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a0f:	83 c4 1c             	add    $0x1c,%esp
+  801a12:	6a 00                	push   $0x0
+  801a14:	6a 00                	push   $0x0
+  801a16:	6a 00                	push   $0x0
+  801a18:	e8 32 1b 00 00       	call   80354f <ipc_recv>
+  801a1d:	83 c4 10             	add    $0x10,%esp
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	78 5b                	js     801a7f <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  801a24:	01 c7                	add    %eax,%edi
+		if (r < n)
+  801a26:	39 c3                	cmp    %eax,%ebx
+  801a28:	0f 8e 4c ff ff ff    	jle    80197a <nsipc_sendfile+0x28>
+  801a2e:	eb 45                	jmp    801a75 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a30:	83 ec 04             	sub    $0x4,%esp
+  801a33:	6a 07                	push   $0x7
+  801a35:	68 00 10 01 e0       	push   $0xe0011000
+  801a3a:	6a 00                	push   $0x0
+  801a3c:	e8 89 e7 ff ff       	call   8001ca <sys_page_alloc>
+  801a41:	89 c7                	mov    %eax,%edi
+  801a43:	83 c4 10             	add    $0x10,%esp
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	78 2b                	js     801a75 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a4a:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a51:	00 00 00 
+  801a54:	e9 0f ff ff ff       	jmp    801968 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a59:	83 ec 0c             	sub    $0xc,%esp
+  801a5c:	6a 03                	push   $0x3
+  801a5e:	e8 e5 1d 00 00       	call   803848 <ipc_find_env>
+  801a63:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a68:	83 c4 10             	add    $0x10,%esp
+  801a6b:	e9 05 ff ff ff       	jmp    801975 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a70:	85 ff                	test   %edi,%edi
+  801a72:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a75:	89 f8                	mov    %edi,%eax
+  801a77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a7a:	5b                   	pop    %ebx
+  801a7b:	5e                   	pop    %esi
+  801a7c:	5f                   	pop    %edi
+  801a7d:	5d                   	pop    %ebp
+  801a7e:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a7f:	85 ff                	test   %edi,%edi
+  801a81:	0f 44 f8             	cmove  %eax,%edi
+  801a84:	eb ef                	jmp    801a75 <nsipc_sendfile+0x123>
+
+00801a86 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a86:	55                   	push   %ebp
+  801a87:	89 e5                	mov    %esp,%ebp
+  801a89:	57                   	push   %edi
+  801a8a:	56                   	push   %esi
+  801a8b:	53                   	push   %ebx
+  801a8c:	83 ec 1c             	sub    $0x1c,%esp
+  801a8f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a92:	e8 13 f9 ff ff       	call   8013aa <nsbulk_map>
+  801a97:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	0f 88 ba 00 00 00    	js     801b5c <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801aa2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801aa6:	0f 8e bb 00 00 00    	jle    801b67 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801aac:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ab1:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801ab6:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801abb:	89 f8                	mov    %edi,%eax
+  801abd:	29 f0                	sub    %esi,%eax
+  801abf:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801ac3:	39 c8                	cmp    %ecx,%eax
+  801ac5:	0f 47 c1             	cmova  %ecx,%eax
+  801ac8:	01 f0                	add    %esi,%eax
+  801aca:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801acc:	83 c2 01             	add    $0x1,%edx
+  801acf:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801ad2:	7e 07                	jle    801adb <nsipc_recvmsg+0x55>
+  801ad4:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801ad9:	7e e0                	jle    801abb <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801adb:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801ae1:	c1 fa 0c             	sar    $0xc,%edx
+  801ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae9:	e8 0a f9 ff ff       	call   8013f8 <nsbulk_own>
+  801aee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	78 67                	js     801b5c <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801af5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af8:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801afd:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801b03:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b06:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801b0b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801b10:	89 f2                	mov    %esi,%edx
+  801b12:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b17:	e8 44 f9 ff ff       	call   801460 <nsipc_bulk>
+  801b1c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b1f:	85 c0                	test   %eax,%eax
+  801b21:	78 39                	js     801b5c <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801b23:	39 f0                	cmp    %esi,%eax
+  801b25:	7f 4a                	jg     801b71 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801b27:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	7e 2c                	jle    801b5c <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b30:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b33:	29 fe                	sub    %edi,%esi
+  801b35:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b38:	39 c6                	cmp    %eax,%esi
+  801b3a:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b3d:	83 ec 04             	sub    $0x4,%esp
+  801b40:	56                   	push   %esi
+  801b41:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b47:	50                   	push   %eax
+  801b48:	ff 33                	push   (%ebx)
+  801b4a:	e8 38 18 00 00       	call   803387 <memmove>
+		n += m;
+  801b4f:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b51:	83 c3 08             	add    $0x8,%ebx
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b5a:	7f d4                	jg     801b30 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b5c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b62:	5b                   	pop    %ebx
+  801b63:	5e                   	pop    %esi
+  801b64:	5f                   	pop    %edi
+  801b65:	5d                   	pop    %ebp
+  801b66:	c3                   	ret
+	int r, i, n, len = 0;
+  801b67:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6c:	e9 6a ff ff ff       	jmp    801adb <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b71:	68 80 3b 80 00       	push   $0x803b80
+  801b76:	68 89 3b 80 00       	push   $0x803b89
+  801b7b:	68 3b 01 00 00       	push   $0x13b
+  801b80:	68 9e 3b 80 00       	push   $0x803b9e
+  801b85:	e8 7b 0e 00 00       	call   802a05 <_panic>
+
+00801b8a <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b8a:	55                   	push   %ebp
+  801b8b:	89 e5                	mov    %esp,%ebp
+  801b8d:	57                   	push   %edi
+  801b8e:	56                   	push   %esi
+  801b8f:	53                   	push   %ebx
+  801b90:	83 ec 0c             	sub    $0xc,%esp
+  801b93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b96:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b99:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801ba4:	8b 07                	mov    (%edi),%eax
+  801ba6:	a3 04 70 80 00       	mov    %eax,0x807004
+  801bab:	8b 47 04             	mov    0x4(%edi),%eax
+  801bae:	a3 08 70 80 00       	mov    %eax,0x807008
+  801bb3:	8b 47 08             	mov    0x8(%edi),%eax
+  801bb6:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801bbb:	8b 47 0c             	mov    0xc(%edi),%eax
+  801bbe:	a3 10 70 80 00       	mov    %eax,0x807010
+  801bc3:	8b 47 10             	mov    0x10(%edi),%eax
+  801bc6:	a3 14 70 80 00       	mov    %eax,0x807014
+  801bcb:	8b 47 14             	mov    0x14(%edi),%eax
+  801bce:	a3 18 70 80 00       	mov    %eax,0x807018
+  801bd3:	8b 47 18             	mov    0x18(%edi),%eax
+  801bd6:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bdb:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bde:	a3 20 70 80 00       	mov    %eax,0x807020
+  801be3:	8b 47 20             	mov    0x20(%edi),%eax
+  801be6:	a3 24 70 80 00       	mov    %eax,0x807024
+  801beb:	8b 47 24             	mov    0x24(%edi),%eax
+  801bee:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bf3:	8b 47 28             	mov    0x28(%edi),%eax
+  801bf6:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801bfb:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801bfe:	a3 30 70 80 00       	mov    %eax,0x807030
+  801c03:	8b 47 30             	mov    0x30(%edi),%eax
+  801c06:	a3 34 70 80 00       	mov    %eax,0x807034
+  801c0b:	8b 47 34             	mov    0x34(%edi),%eax
+  801c0e:	a3 38 70 80 00       	mov    %eax,0x807038
+  801c13:	8b 47 38             	mov    0x38(%edi),%eax
+  801c16:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801c1b:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801c1e:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801c23:	8b 06                	mov    (%esi),%eax
+  801c25:	a3 44 70 80 00       	mov    %eax,0x807044
+  801c2a:	8b 46 04             	mov    0x4(%esi),%eax
+  801c2d:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c32:	8b 46 08             	mov    0x8(%esi),%eax
+  801c35:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c3a:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c3d:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c42:	8b 46 10             	mov    0x10(%esi),%eax
+  801c45:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c4a:	8b 46 14             	mov    0x14(%esi),%eax
+  801c4d:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c52:	8b 46 18             	mov    0x18(%esi),%eax
+  801c55:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c5a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c5d:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c62:	8b 46 20             	mov    0x20(%esi),%eax
+  801c65:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c6a:	8b 46 24             	mov    0x24(%esi),%eax
+  801c6d:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c72:	8b 46 28             	mov    0x28(%esi),%eax
+  801c75:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c7a:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c7d:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c82:	8b 46 30             	mov    0x30(%esi),%eax
+  801c85:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c8a:	8b 46 34             	mov    0x34(%esi),%eax
+  801c8d:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c92:	8b 46 38             	mov    0x38(%esi),%eax
+  801c95:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c9a:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c9d:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801ca2:	8b 03                	mov    (%ebx),%eax
+  801ca4:	a3 84 70 80 00       	mov    %eax,0x807084
+  801ca9:	8b 43 04             	mov    0x4(%ebx),%eax
+  801cac:	a3 88 70 80 00       	mov    %eax,0x807088
+  801cb1:	8b 43 08             	mov    0x8(%ebx),%eax
+  801cb4:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801cb9:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cbc:	a3 90 70 80 00       	mov    %eax,0x807090
+  801cc1:	8b 43 10             	mov    0x10(%ebx),%eax
+  801cc4:	a3 94 70 80 00       	mov    %eax,0x807094
+  801cc9:	8b 43 14             	mov    0x14(%ebx),%eax
+  801ccc:	a3 98 70 80 00       	mov    %eax,0x807098
+  801cd1:	8b 43 18             	mov    0x18(%ebx),%eax
+  801cd4:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801cd9:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cdc:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801ce1:	8b 43 20             	mov    0x20(%ebx),%eax
+  801ce4:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801ce9:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cec:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cf1:	8b 43 28             	mov    0x28(%ebx),%eax
+  801cf4:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801cf9:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801cfc:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801d01:	8b 43 30             	mov    0x30(%ebx),%eax
+  801d04:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801d09:	8b 43 34             	mov    0x34(%ebx),%eax
+  801d0c:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801d11:	8b 43 38             	mov    0x38(%ebx),%eax
+  801d14:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801d19:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801d1c:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801d21:	8b 45 18             	mov    0x18(%ebp),%eax
+  801d24:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801d29:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d2e:	e8 2b f6 ff ff       	call   80135e <nsipc>
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	0f 88 ad 01 00 00    	js     801ee8 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d3b:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d41:	89 17                	mov    %edx,(%edi)
+  801d43:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d49:	89 57 04             	mov    %edx,0x4(%edi)
+  801d4c:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d52:	89 57 08             	mov    %edx,0x8(%edi)
+  801d55:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d5b:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d5e:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d64:	89 57 10             	mov    %edx,0x10(%edi)
+  801d67:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d6d:	89 57 14             	mov    %edx,0x14(%edi)
+  801d70:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d76:	89 57 18             	mov    %edx,0x18(%edi)
+  801d79:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d7f:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d82:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d88:	89 57 20             	mov    %edx,0x20(%edi)
+  801d8b:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d91:	89 57 24             	mov    %edx,0x24(%edi)
+  801d94:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d9a:	89 57 28             	mov    %edx,0x28(%edi)
+  801d9d:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801da3:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801da6:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801dac:	89 57 30             	mov    %edx,0x30(%edi)
+  801daf:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801db5:	89 57 34             	mov    %edx,0x34(%edi)
+  801db8:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801dbe:	89 57 38             	mov    %edx,0x38(%edi)
+  801dc1:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801dc7:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801dca:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801dd0:	89 16                	mov    %edx,(%esi)
+  801dd2:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801dd8:	89 56 04             	mov    %edx,0x4(%esi)
+  801ddb:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801de1:	89 56 08             	mov    %edx,0x8(%esi)
+  801de4:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dea:	89 56 0c             	mov    %edx,0xc(%esi)
+  801ded:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801df3:	89 56 10             	mov    %edx,0x10(%esi)
+  801df6:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801dfc:	89 56 14             	mov    %edx,0x14(%esi)
+  801dff:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801e05:	89 56 18             	mov    %edx,0x18(%esi)
+  801e08:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801e0e:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801e11:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801e17:	89 56 20             	mov    %edx,0x20(%esi)
+  801e1a:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801e20:	89 56 24             	mov    %edx,0x24(%esi)
+  801e23:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801e29:	89 56 28             	mov    %edx,0x28(%esi)
+  801e2c:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e32:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e35:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e3b:	89 56 30             	mov    %edx,0x30(%esi)
+  801e3e:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e44:	89 56 34             	mov    %edx,0x34(%esi)
+  801e47:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e4d:	89 56 38             	mov    %edx,0x38(%esi)
+  801e50:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e56:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e59:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e5f:	89 13                	mov    %edx,(%ebx)
+  801e61:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e67:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e6a:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e70:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e73:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e79:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e7c:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e82:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e85:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e8b:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e8e:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e94:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e97:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e9d:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801ea0:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801ea6:	89 53 20             	mov    %edx,0x20(%ebx)
+  801ea9:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801eaf:	89 53 24             	mov    %edx,0x24(%ebx)
+  801eb2:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801eb8:	89 53 28             	mov    %edx,0x28(%ebx)
+  801ebb:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801ec1:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801ec4:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801eca:	89 53 30             	mov    %edx,0x30(%ebx)
+  801ecd:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801ed3:	89 53 34             	mov    %edx,0x34(%ebx)
+  801ed6:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801edc:	89 53 38             	mov    %edx,0x38(%ebx)
+  801edf:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801ee5:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801ee8:	83 c4 0c             	add    $0xc,%esp
+  801eeb:	5b                   	pop    %ebx
+  801eec:	5e                   	pop    %esi
+  801eed:	5f                   	pop    %edi
+  801eee:	5d                   	pop    %ebp
+  801eef:	c3                   	ret
+
+00801ef0 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801efe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f01:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801f06:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f09:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801f0e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801f13:	e8 46 f4 ff ff       	call   80135e <nsipc>
+}
+  801f18:	c9                   	leave
+  801f19:	c3                   	ret
+
+00801f1a <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801f1a:	55                   	push   %ebp
+  801f1b:	89 e5                	mov    %esp,%ebp
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+  801f1f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801f22:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801f28:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f2b:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f30:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f35:	e8 24 f4 ff ff       	call   80135e <nsipc>
+  801f3a:	89 c3                	mov    %eax,%ebx
+  801f3c:	85 c0                	test   %eax,%eax
+  801f3e:	7e 1f                	jle    801f5f <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f40:	39 c6                	cmp    %eax,%esi
+  801f42:	7c 24                	jl     801f68 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f44:	83 ec 04             	sub    $0x4,%esp
+  801f47:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f4e:	50                   	push   %eax
+  801f4f:	68 00 70 80 00       	push   $0x807000
+  801f54:	ff 75 08             	push   0x8(%ebp)
+  801f57:	e8 2b 14 00 00       	call   803387 <memmove>
+  801f5c:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f5f:	89 d8                	mov    %ebx,%eax
+  801f61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f64:	5b                   	pop    %ebx
+  801f65:	5e                   	pop    %esi
+  801f66:	5d                   	pop    %ebp
+  801f67:	c3                   	ret
+		assert(r <= max);
+  801f68:	68 b6 3b 80 00       	push   $0x803bb6
+  801f6d:	68 89 3b 80 00       	push   $0x803b89
+  801f72:	68 6a 01 00 00       	push   $0x16a
+  801f77:	68 9e 3b 80 00       	push   $0x803b9e
+  801f7c:	e8 84 0a 00 00       	call   802a05 <_panic>
+
+00801f81 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f81:	55                   	push   %ebp
+  801f82:	89 e5                	mov    %esp,%ebp
+  801f84:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f92:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f97:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f9a:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f9f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fa4:	e8 b5 f3 ff ff       	call   80135e <nsipc>
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+00801fab <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb4:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801fb9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fbe:	e8 9b f3 ff ff       	call   80135e <nsipc>
+}
+  801fc3:	c9                   	leave
+  801fc4:	c3                   	ret
+
+00801fc5 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801fc5:	55                   	push   %ebp
+  801fc6:	89 e5                	mov    %esp,%ebp
+  801fc8:	53                   	push   %ebx
+  801fc9:	83 ec 04             	sub    $0x4,%esp
+  801fcc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fcf:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fd4:	e8 85 f3 ff ff       	call   80135e <nsipc>
+  801fd9:	85 c0                	test   %eax,%eax
+  801fdb:	78 50                	js     80202d <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fdd:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fe3:	89 13                	mov    %edx,(%ebx)
+  801fe5:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801feb:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fee:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801ff4:	89 53 08             	mov    %edx,0x8(%ebx)
+  801ff7:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801ffd:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802000:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802006:	89 53 10             	mov    %edx,0x10(%ebx)
+  802009:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  80200f:	89 53 14             	mov    %edx,0x14(%ebx)
+  802012:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  802018:	89 53 18             	mov    %edx,0x18(%ebx)
+  80201b:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802021:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802024:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  80202a:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80202d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802030:	c9                   	leave
+  802031:	c3                   	ret
+
+00802032 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802032:	55                   	push   %ebp
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802038:	6a 03                	push   $0x3
+  80203a:	e8 09 18 00 00       	call   803848 <ipc_find_env>
+  80203f:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802044:	8b 45 08             	mov    0x8(%ebp),%eax
+  802047:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80204c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802051:	e8 08 f3 ff ff       	call   80135e <nsipc>
+  802056:	83 c4 10             	add    $0x10,%esp
+  802059:	85 c0                	test   %eax,%eax
+  80205b:	78 0a                	js     802067 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80205d:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802062:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802067:	c9                   	leave
+  802068:	c3                   	ret
+
+00802069 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802069:	55                   	push   %ebp
+  80206a:	89 e5                	mov    %esp,%ebp
+  80206c:	57                   	push   %edi
+  80206d:	56                   	push   %esi
+  80206e:	53                   	push   %ebx
+  80206f:	83 ec 1c             	sub    $0x1c,%esp
+  802072:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802075:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802078:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80207d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802082:	89 e0                	mov    %esp,%eax
+  802084:	89 f2                	mov    %esi,%edx
+  802086:	29 c2                	sub    %eax,%edx
+  802088:	89 d0                	mov    %edx,%eax
+  80208a:	c1 e8 0f             	shr    $0xf,%eax
+  80208d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802093:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802096:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80209d:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8020a0:	83 ec 0c             	sub    $0xc,%esp
+  8020a3:	ff 75 e0             	push   -0x20(%ebp)
+  8020a6:	e8 dc 17 00 00       	call   803887 <pageref>
+  8020ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020ae:	83 c4 04             	add    $0x4,%esp
+  8020b1:	ff 75 dc             	push   -0x24(%ebp)
+  8020b4:	e8 ce 17 00 00       	call   803887 <pageref>
+  8020b9:	89 e2                	mov    %esp,%edx
+  8020bb:	89 f1                	mov    %esi,%ecx
+  8020bd:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8020bf:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8020c2:	89 ca                	mov    %ecx,%edx
+  8020c4:	c1 ea 0f             	shr    $0xf,%edx
+  8020c7:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8020cd:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020d0:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020d7:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020da:	39 d7                	cmp    %edx,%edi
+  8020dc:	74 40                	je     80211e <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020de:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020e1:	75 9f                	jne    802082 <_pipeisclosed+0x19>
+  8020e3:	89 e2                	mov    %esp,%edx
+  8020e5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020ea:	29 d0                	sub    %edx,%eax
+  8020ec:	89 c2                	mov    %eax,%edx
+  8020ee:	c1 ea 0f             	shr    $0xf,%edx
+  8020f1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fb:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020fe:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802105:	8b 40 58             	mov    0x58(%eax),%eax
+  802108:	6a 01                	push   $0x1
+  80210a:	50                   	push   %eax
+  80210b:	57                   	push   %edi
+  80210c:	68 bf 3b 80 00       	push   $0x803bbf
+  802111:	e8 ca 09 00 00       	call   802ae0 <cprintf>
+  802116:	83 c4 10             	add    $0x10,%esp
+  802119:	e9 5f ff ff ff       	jmp    80207d <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80211e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802121:	0f 94 c0             	sete   %al
+  802124:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212a:	5b                   	pop    %ebx
+  80212b:	5e                   	pop    %esi
+  80212c:	5f                   	pop    %edi
+  80212d:	5d                   	pop    %ebp
+  80212e:	c3                   	ret
+
+0080212f <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80212f:	55                   	push   %ebp
+  802130:	89 e5                	mov    %esp,%ebp
+  802132:	53                   	push   %ebx
+  802133:	83 ec 0c             	sub    $0xc,%esp
+  802136:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802139:	53                   	push   %ebx
+  80213a:	6a 00                	push   $0x0
+  80213c:	e8 0e e1 ff ff       	call   80024f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802141:	89 1c 24             	mov    %ebx,(%esp)
+  802144:	e8 f4 e4 ff ff       	call   80063d <fd2data>
+  802149:	83 c4 08             	add    $0x8,%esp
+  80214c:	50                   	push   %eax
+  80214d:	6a 00                	push   $0x0
+  80214f:	e8 fb e0 ff ff       	call   80024f <sys_page_unmap>
+}
+  802154:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802157:	c9                   	leave
+  802158:	c3                   	ret
+
+00802159 <devpipe_read>:
+{
+  802159:	55                   	push   %ebp
+  80215a:	89 e5                	mov    %esp,%ebp
+  80215c:	57                   	push   %edi
+  80215d:	56                   	push   %esi
+  80215e:	53                   	push   %ebx
+  80215f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802162:	ff 75 08             	push   0x8(%ebp)
+  802165:	e8 d3 e4 ff ff       	call   80063d <fd2data>
+  80216a:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80216c:	8b 70 04             	mov    0x4(%eax),%esi
+  80216f:	8b 00                	mov    (%eax),%eax
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	39 f0                	cmp    %esi,%eax
+  802176:	75 36                	jne    8021ae <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802178:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80217b:	89 da                	mov    %ebx,%edx
+  80217d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802180:	e8 e4 fe ff ff       	call   802069 <_pipeisclosed>
+  802185:	85 c0                	test   %eax,%eax
+  802187:	0f 85 d4 00 00 00    	jne    802261 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80218d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802192:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802196:	83 ec 04             	sub    $0x4,%esp
+  802199:	6a ff                	push   $0xffffffff
+  80219b:	56                   	push   %esi
+  80219c:	57                   	push   %edi
+  80219d:	e8 26 e4 ff ff       	call   8005c8 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8021a2:	8b 73 04             	mov    0x4(%ebx),%esi
+  8021a5:	8b 03                	mov    (%ebx),%eax
+  8021a7:	83 c4 10             	add    $0x10,%esp
+  8021aa:	39 c6                	cmp    %eax,%esi
+  8021ac:	74 cd                	je     80217b <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8021ae:	8b 73 04             	mov    0x4(%ebx),%esi
+  8021b1:	8b 03                	mov    (%ebx),%eax
+  8021b3:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8021b9:	29 c6                	sub    %eax,%esi
+  8021bb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021c0:	f7 e6                	mul    %esi
+  8021c2:	c1 ea 0c             	shr    $0xc,%edx
+  8021c5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021cb:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8021cd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021d0:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021d4:	8b 0b                	mov    (%ebx),%ecx
+  8021d6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021db:	f7 e1                	mul    %ecx
+  8021dd:	c1 ea 0b             	shr    $0xb,%edx
+  8021e0:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021e6:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021e8:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021ed:	29 cf                	sub    %ecx,%edi
+  8021ef:	39 f7                	cmp    %esi,%edi
+  8021f1:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021f4:	83 ec 04             	sub    $0x4,%esp
+  8021f7:	57                   	push   %edi
+  8021f8:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021fc:	50                   	push   %eax
+  8021fd:	ff 75 0c             	push   0xc(%ebp)
+  802200:	e8 82 11 00 00       	call   803387 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802205:	83 c4 0c             	add    $0xc,%esp
+  802208:	89 f0                	mov    %esi,%eax
+  80220a:	29 f8                	sub    %edi,%eax
+  80220c:	50                   	push   %eax
+  80220d:	8d 43 10             	lea    0x10(%ebx),%eax
+  802210:	50                   	push   %eax
+  802211:	89 f8                	mov    %edi,%eax
+  802213:	03 45 0c             	add    0xc(%ebp),%eax
+  802216:	50                   	push   %eax
+  802217:	e8 6b 11 00 00       	call   803387 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80221c:	8b 0b                	mov    (%ebx),%ecx
+  80221e:	01 f1                	add    %esi,%ecx
+  802220:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802225:	f7 e1                	mul    %ecx
+  802227:	c1 ea 0c             	shr    $0xc,%edx
+  80222a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802230:	29 c1                	sub    %eax,%ecx
+  802232:	89 0b                	mov    %ecx,(%ebx)
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+  802239:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80223d:	83 c4 10             	add    $0x10,%esp
+  802240:	85 c0                	test   %eax,%eax
+  802242:	75 0a                	jne    80224e <devpipe_read+0xf5>
+	return n;
+  802244:	89 f0                	mov    %esi,%eax
+}
+  802246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802249:	5b                   	pop    %ebx
+  80224a:	5e                   	pop    %esi
+  80224b:	5f                   	pop    %edi
+  80224c:	5d                   	pop    %ebp
+  80224d:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80224e:	83 ec 08             	sub    $0x8,%esp
+  802251:	68 00 04 00 00       	push   $0x400
+  802256:	53                   	push   %ebx
+  802257:	e8 8e e3 ff ff       	call   8005ea <sys_futex_wake>
+  80225c:	83 c4 10             	add    $0x10,%esp
+  80225f:	eb e3                	jmp    802244 <devpipe_read+0xeb>
+			return 0;
+  802261:	b8 00 00 00 00       	mov    $0x0,%eax
+  802266:	eb de                	jmp    802246 <devpipe_read+0xed>
+
+00802268 <devpipe_write>:
+{
+  802268:	55                   	push   %ebp
+  802269:	89 e5                	mov    %esp,%ebp
+  80226b:	57                   	push   %edi
+  80226c:	56                   	push   %esi
+  80226d:	53                   	push   %ebx
+  80226e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802271:	ff 75 08             	push   0x8(%ebp)
+  802274:	e8 c4 e3 ff ff       	call   80063d <fd2data>
+  802279:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80227b:	83 c4 10             	add    $0x10,%esp
+  80227e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802285:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80228a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80228e:	0f 84 43 01 00 00    	je     8023d7 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802294:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802297:	8b 06                	mov    (%esi),%eax
+  802299:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80229f:	29 c1                	sub    %eax,%ecx
+  8022a1:	89 c8                	mov    %ecx,%eax
+  8022a3:	f7 e7                	mul    %edi
+  8022a5:	c1 ea 0c             	shr    $0xc,%edx
+  8022a8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022ae:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8022b0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022b6:	75 52                	jne    80230a <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8022b8:	89 f2                	mov    %esi,%edx
+  8022ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022bd:	e8 a7 fd ff ff       	call   802069 <_pipeisclosed>
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	0f 85 28 01 00 00    	jne    8023f2 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8022ca:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022cc:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022cf:	8b 06                	mov    (%esi),%eax
+  8022d1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022d7:	29 c1                	sub    %eax,%ecx
+  8022d9:	89 c8                	mov    %ecx,%eax
+  8022db:	f7 e7                	mul    %edi
+  8022dd:	c1 ea 0c             	shr    $0xc,%edx
+  8022e0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022e6:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022e8:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022ee:	75 a4                	jne    802294 <devpipe_write+0x2c>
+  8022f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022f5:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022f9:	83 ec 04             	sub    $0x4,%esp
+  8022fc:	6a ff                	push   $0xffffffff
+  8022fe:	53                   	push   %ebx
+  8022ff:	56                   	push   %esi
+  802300:	e8 c3 e2 ff ff       	call   8005c8 <sys_futex_wait>
+}
+  802305:	83 c4 10             	add    $0x10,%esp
+  802308:	eb 8a                	jmp    802294 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80230a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80230d:	8b 06                	mov    (%esi),%eax
+  80230f:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802315:	29 c1                	sub    %eax,%ecx
+  802317:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80231c:	f7 e1                	mul    %ecx
+  80231e:	c1 ea 0c             	shr    $0xc,%edx
+  802321:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802327:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802329:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80232e:	89 d8                	mov    %ebx,%eax
+  802330:	29 c8                	sub    %ecx,%eax
+  802332:	8b 55 10             	mov    0x10(%ebp),%edx
+  802335:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802338:	29 ca                	sub    %ecx,%edx
+  80233a:	39 d0                	cmp    %edx,%eax
+  80233c:	0f 46 d0             	cmovbe %eax,%edx
+  80233f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802342:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802345:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80234a:	f7 e1                	mul    %ecx
+  80234c:	c1 ea 0b             	shr    $0xb,%edx
+  80234f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802355:	89 ca                	mov    %ecx,%edx
+  802357:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802359:	29 d3                	sub    %edx,%ebx
+  80235b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80235e:	39 c3                	cmp    %eax,%ebx
+  802360:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802363:	83 ec 04             	sub    $0x4,%esp
+  802366:	53                   	push   %ebx
+  802367:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80236a:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80236d:	51                   	push   %ecx
+  80236e:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802372:	50                   	push   %eax
+  802373:	e8 0f 10 00 00       	call   803387 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802378:	83 c4 0c             	add    $0xc,%esp
+  80237b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80237e:	29 d8                	sub    %ebx,%eax
+  802380:	50                   	push   %eax
+  802381:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802384:	01 cb                	add    %ecx,%ebx
+  802386:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802389:	53                   	push   %ebx
+  80238a:	8d 46 10             	lea    0x10(%esi),%eax
+  80238d:	50                   	push   %eax
+  80238e:	e8 f4 0f 00 00       	call   803387 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802393:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802396:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802399:	01 c1                	add    %eax,%ecx
+  80239b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023a0:	f7 e1                	mul    %ecx
+  8023a2:	c1 ea 0c             	shr    $0xc,%edx
+  8023a5:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8023ab:	89 ca                	mov    %ecx,%edx
+  8023ad:	29 c2                	sub    %eax,%edx
+  8023af:	89 56 04             	mov    %edx,0x4(%esi)
+  8023b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b7:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8023bb:	83 c4 10             	add    $0x10,%esp
+  8023be:	85 c0                	test   %eax,%eax
+  8023c0:	75 1a                	jne    8023dc <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8023c2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8023c5:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8023c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023cb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023ce:	0f 82 c0 fe ff ff    	jb     802294 <devpipe_write+0x2c>
+  8023d4:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023d7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023da:	eb 1b                	jmp    8023f7 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023dc:	83 ec 08             	sub    $0x8,%esp
+  8023df:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023e4:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023e7:	50                   	push   %eax
+  8023e8:	e8 fd e1 ff ff       	call   8005ea <sys_futex_wake>
+  8023ed:	83 c4 10             	add    $0x10,%esp
+  8023f0:	eb d0                	jmp    8023c2 <devpipe_write+0x15a>
+				return 0;
+  8023f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023fa:	5b                   	pop    %ebx
+  8023fb:	5e                   	pop    %esi
+  8023fc:	5f                   	pop    %edi
+  8023fd:	5d                   	pop    %ebp
+  8023fe:	c3                   	ret
+
+008023ff <devpipe_stat>:
+{
+  8023ff:	55                   	push   %ebp
+  802400:	89 e5                	mov    %esp,%ebp
+  802402:	56                   	push   %esi
+  802403:	53                   	push   %ebx
+  802404:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	ff 75 08             	push   0x8(%ebp)
+  80240d:	e8 2b e2 ff ff       	call   80063d <fd2data>
+  802412:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802414:	83 c4 08             	add    $0x8,%esp
+  802417:	68 d2 3b 80 00       	push   $0x803bd2
+  80241c:	53                   	push   %ebx
+  80241d:	e8 b5 0d 00 00       	call   8031d7 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802422:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802425:	8b 06                	mov    (%esi),%eax
+  802427:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80242d:	29 c1                	sub    %eax,%ecx
+  80242f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802434:	89 c8                	mov    %ecx,%eax
+  802436:	f7 e2                	mul    %edx
+  802438:	c1 ea 0c             	shr    $0xc,%edx
+  80243b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802441:	29 d1                	sub    %edx,%ecx
+  802443:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802449:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802450:	00 00 00 
+	stat->st_dev = &devpipe;
+  802453:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  80245a:	40 80 00 
+}
+  80245d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802462:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802465:	5b                   	pop    %ebx
+  802466:	5e                   	pop    %esi
+  802467:	5d                   	pop    %ebp
+  802468:	c3                   	ret
+
+00802469 <devpipe_poll>:
+{
+  802469:	55                   	push   %ebp
+  80246a:	89 e5                	mov    %esp,%ebp
+  80246c:	57                   	push   %edi
+  80246d:	56                   	push   %esi
+  80246e:	53                   	push   %ebx
+  80246f:	83 ec 18             	sub    $0x18,%esp
+  802472:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802475:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802478:	57                   	push   %edi
+  802479:	e8 bf e1 ff ff       	call   80063d <fd2data>
+  80247e:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802480:	83 c4 10             	add    $0x10,%esp
+  802483:	89 f3                	mov    %esi,%ebx
+  802485:	83 e3 01             	and    $0x1,%ebx
+  802488:	75 27                	jne    8024b1 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80248a:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802490:	75 48                	jne    8024da <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802492:	89 ca                	mov    %ecx,%edx
+  802494:	89 f8                	mov    %edi,%eax
+  802496:	e8 ce fb ff ff       	call   802069 <_pipeisclosed>
+  80249b:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80249d:	89 d8                	mov    %ebx,%eax
+  80249f:	83 c8 10             	or     $0x10,%eax
+  8024a2:	85 d2                	test   %edx,%edx
+  8024a4:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8024a7:	89 d8                	mov    %ebx,%eax
+  8024a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ac:	5b                   	pop    %ebx
+  8024ad:	5e                   	pop    %esi
+  8024ae:	5f                   	pop    %edi
+  8024af:	5d                   	pop    %ebp
+  8024b0:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024b1:	8b 58 04             	mov    0x4(%eax),%ebx
+  8024b4:	8b 00                	mov    (%eax),%eax
+  8024b6:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8024bc:	29 c3                	sub    %eax,%ebx
+  8024be:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024c3:	89 d8                	mov    %ebx,%eax
+  8024c5:	f7 e2                	mul    %edx
+  8024c7:	c1 ea 0c             	shr    $0xc,%edx
+  8024ca:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024d0:	39 d3                	cmp    %edx,%ebx
+  8024d2:	0f 95 c3             	setne  %bl
+  8024d5:	0f b6 db             	movzbl %bl,%ebx
+  8024d8:	eb b0                	jmp    80248a <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024da:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024dd:	8b 01                	mov    (%ecx),%eax
+  8024df:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024e5:	29 c6                	sub    %eax,%esi
+  8024e7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024ec:	89 f0                	mov    %esi,%eax
+  8024ee:	f7 e2                	mul    %edx
+  8024f0:	c1 ea 0c             	shr    $0xc,%edx
+  8024f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024f9:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024fb:	89 d8                	mov    %ebx,%eax
+  8024fd:	83 c8 04             	or     $0x4,%eax
+  802500:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  802506:	0f 42 d8             	cmovb  %eax,%ebx
+  802509:	eb 87                	jmp    802492 <devpipe_poll+0x29>
+
+0080250b <pipe>:
+{
+  80250b:	55                   	push   %ebp
+  80250c:	89 e5                	mov    %esp,%ebp
+  80250e:	56                   	push   %esi
+  80250f:	53                   	push   %ebx
+  802510:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802513:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802516:	50                   	push   %eax
+  802517:	e8 38 e1 ff ff       	call   800654 <fd_alloc>
+  80251c:	89 c3                	mov    %eax,%ebx
+  80251e:	83 c4 10             	add    $0x10,%esp
+  802521:	85 c0                	test   %eax,%eax
+  802523:	0f 88 23 01 00 00    	js     80264c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802529:	83 ec 04             	sub    $0x4,%esp
+  80252c:	68 07 04 00 00       	push   $0x407
+  802531:	ff 75 f4             	push   -0xc(%ebp)
+  802534:	6a 00                	push   $0x0
+  802536:	e8 8f dc ff ff       	call   8001ca <sys_page_alloc>
+  80253b:	89 c3                	mov    %eax,%ebx
+  80253d:	83 c4 10             	add    $0x10,%esp
+  802540:	85 c0                	test   %eax,%eax
+  802542:	0f 88 04 01 00 00    	js     80264c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802548:	83 ec 0c             	sub    $0xc,%esp
+  80254b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80254e:	50                   	push   %eax
+  80254f:	e8 00 e1 ff ff       	call   800654 <fd_alloc>
+  802554:	89 c3                	mov    %eax,%ebx
+  802556:	83 c4 10             	add    $0x10,%esp
+  802559:	85 c0                	test   %eax,%eax
+  80255b:	0f 88 db 00 00 00    	js     80263c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802561:	83 ec 04             	sub    $0x4,%esp
+  802564:	68 07 04 00 00       	push   $0x407
+  802569:	ff 75 f0             	push   -0x10(%ebp)
+  80256c:	6a 00                	push   $0x0
+  80256e:	e8 57 dc ff ff       	call   8001ca <sys_page_alloc>
+  802573:	89 c3                	mov    %eax,%ebx
+  802575:	83 c4 10             	add    $0x10,%esp
+  802578:	85 c0                	test   %eax,%eax
+  80257a:	0f 88 bc 00 00 00    	js     80263c <pipe+0x131>
+	va = fd2data(fd0);
+  802580:	83 ec 0c             	sub    $0xc,%esp
+  802583:	ff 75 f4             	push   -0xc(%ebp)
+  802586:	e8 b2 e0 ff ff       	call   80063d <fd2data>
+  80258b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80258d:	83 c4 0c             	add    $0xc,%esp
+  802590:	68 07 04 00 00       	push   $0x407
+  802595:	50                   	push   %eax
+  802596:	6a 00                	push   $0x0
+  802598:	e8 2d dc ff ff       	call   8001ca <sys_page_alloc>
+  80259d:	89 c3                	mov    %eax,%ebx
+  80259f:	83 c4 10             	add    $0x10,%esp
+  8025a2:	85 c0                	test   %eax,%eax
+  8025a4:	0f 88 82 00 00 00    	js     80262c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025aa:	83 ec 0c             	sub    $0xc,%esp
+  8025ad:	ff 75 f0             	push   -0x10(%ebp)
+  8025b0:	e8 88 e0 ff ff       	call   80063d <fd2data>
+  8025b5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025bc:	50                   	push   %eax
+  8025bd:	6a 00                	push   $0x0
+  8025bf:	56                   	push   %esi
+  8025c0:	6a 00                	push   $0x0
+  8025c2:	e8 46 dc ff ff       	call   80020d <sys_page_map>
+  8025c7:	89 c3                	mov    %eax,%ebx
+  8025c9:	83 c4 20             	add    $0x20,%esp
+  8025cc:	85 c0                	test   %eax,%eax
+  8025ce:	78 4e                	js     80261e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025d0:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025d8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025dd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025e4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025e7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025ec:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025f3:	83 ec 0c             	sub    $0xc,%esp
+  8025f6:	ff 75 f4             	push   -0xc(%ebp)
+  8025f9:	e8 2f e0 ff ff       	call   80062d <fd2num>
+  8025fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802601:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802603:	83 c4 04             	add    $0x4,%esp
+  802606:	ff 75 f0             	push   -0x10(%ebp)
+  802609:	e8 1f e0 ff ff       	call   80062d <fd2num>
+  80260e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802611:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802614:	83 c4 10             	add    $0x10,%esp
+  802617:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80261c:	eb 2e                	jmp    80264c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80261e:	83 ec 08             	sub    $0x8,%esp
+  802621:	56                   	push   %esi
+  802622:	6a 00                	push   $0x0
+  802624:	e8 26 dc ff ff       	call   80024f <sys_page_unmap>
+  802629:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80262c:	83 ec 08             	sub    $0x8,%esp
+  80262f:	ff 75 f0             	push   -0x10(%ebp)
+  802632:	6a 00                	push   $0x0
+  802634:	e8 16 dc ff ff       	call   80024f <sys_page_unmap>
+  802639:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80263c:	83 ec 08             	sub    $0x8,%esp
+  80263f:	ff 75 f4             	push   -0xc(%ebp)
+  802642:	6a 00                	push   $0x0
+  802644:	e8 06 dc ff ff       	call   80024f <sys_page_unmap>
+  802649:	83 c4 10             	add    $0x10,%esp
+}
+  80264c:	89 d8                	mov    %ebx,%eax
+  80264e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802651:	5b                   	pop    %ebx
+  802652:	5e                   	pop    %esi
+  802653:	5d                   	pop    %ebp
+  802654:	c3                   	ret
+
+00802655 <pipeisclosed>:
+{
+  802655:	55                   	push   %ebp
+  802656:	89 e5                	mov    %esp,%ebp
+  802658:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80265b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80265e:	50                   	push   %eax
+  80265f:	ff 75 08             	push   0x8(%ebp)
+  802662:	e8 3d e0 ff ff       	call   8006a4 <fd_lookup>
+  802667:	83 c4 10             	add    $0x10,%esp
+  80266a:	85 c0                	test   %eax,%eax
+  80266c:	78 18                	js     802686 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80266e:	83 ec 0c             	sub    $0xc,%esp
+  802671:	ff 75 f4             	push   -0xc(%ebp)
+  802674:	e8 c4 df ff ff       	call   80063d <fd2data>
+  802679:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80267b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80267e:	e8 e6 f9 ff ff       	call   802069 <_pipeisclosed>
+  802683:	83 c4 10             	add    $0x10,%esp
+}
+  802686:	c9                   	leave
+  802687:	c3                   	ret
+
+00802688 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  802688:	55                   	push   %ebp
+  802689:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80268b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802694:	5d                   	pop    %ebp
+  802695:	c3                   	ret
+
+00802696 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  802696:	55                   	push   %ebp
+  802697:	89 e5                	mov    %esp,%ebp
+  802699:	53                   	push   %ebx
+  80269a:	83 ec 04             	sub    $0x4,%esp
+  80269d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8026a0:	8b 03                	mov    (%ebx),%eax
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	75 05                	jne    8026ab <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8026a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a9:	c9                   	leave
+  8026aa:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8026ab:	83 ec 08             	sub    $0x8,%esp
+  8026ae:	50                   	push   %eax
+  8026af:	8d 43 04             	lea    0x4(%ebx),%eax
+  8026b2:	50                   	push   %eax
+  8026b3:	e8 e7 dd ff ff       	call   80049f <sys_page_batch>
+	pb->pb_n = 0;
+  8026b8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	eb e3                	jmp    8026a6 <pgbatch_flush+0x10>
+
+008026c3 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8026c3:	55                   	push   %ebp
+  8026c4:	89 e5                	mov    %esp,%ebp
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	89 c3                	mov    %eax,%ebx
+  8026ca:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026cc:	83 38 20             	cmpl   $0x20,(%eax)
+  8026cf:	74 2c                	je     8026fd <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026d1:	8b 03                	mov    (%ebx),%eax
+  8026d3:	8d 50 01             	lea    0x1(%eax),%edx
+  8026d6:	89 13                	mov    %edx,(%ebx)
+  8026d8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026db:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026df:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026e1:	83 ec 04             	sub    $0x4,%esp
+  8026e4:	6a 18                	push   $0x18
+  8026e6:	6a 00                	push   $0x0
+  8026e8:	50                   	push   %eax
+  8026e9:	e8 64 0c 00 00       	call   803352 <memset>
+	return 0;
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026f9:	5b                   	pop    %ebx
+  8026fa:	5e                   	pop    %esi
+  8026fb:	5d                   	pop    %ebp
+  8026fc:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026fd:	83 ec 0c             	sub    $0xc,%esp
+  802700:	50                   	push   %eax
+  802701:	e8 90 ff ff ff       	call   802696 <pgbatch_flush>
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	85 c0                	test   %eax,%eax
+  80270b:	79 c4                	jns    8026d1 <pgbatch_slot+0xe>
+  80270d:	eb e7                	jmp    8026f6 <pgbatch_slot+0x33>
+
+0080270f <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80270f:	55                   	push   %ebp
+  802710:	89 e5                	mov    %esp,%ebp
+  802712:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802715:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802718:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271b:	e8 a3 ff ff ff       	call   8026c3 <pgbatch_slot>
+  802720:	85 c0                	test   %eax,%eax
+  802722:	78 20                	js     802744 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  802724:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802727:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80272d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802730:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802733:	8b 55 10             	mov    0x10(%ebp),%edx
+  802736:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802739:	8b 55 14             	mov    0x14(%ebp),%edx
+  80273c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80273f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802744:	c9                   	leave
+  802745:	c3                   	ret
+
+00802746 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  802746:	55                   	push   %ebp
+  802747:	89 e5                	mov    %esp,%ebp
+  802749:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80274c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80274f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802752:	e8 6c ff ff ff       	call   8026c3 <pgbatch_slot>
+  802757:	85 c0                	test   %eax,%eax
+  802759:	78 2c                	js     802787 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80275b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80275e:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802764:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802767:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80276a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80276d:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802770:	8b 55 14             	mov    0x14(%ebp),%edx
+  802773:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  802776:	8b 55 18             	mov    0x18(%ebp),%edx
+  802779:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80277c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80277f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802787:	c9                   	leave
+  802788:	c3                   	ret
+
+00802789 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  802789:	55                   	push   %ebp
+  80278a:	89 e5                	mov    %esp,%ebp
+  80278c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80278f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802792:	8b 45 08             	mov    0x8(%ebp),%eax
+  802795:	e8 29 ff ff ff       	call   8026c3 <pgbatch_slot>
+  80279a:	85 c0                	test   %eax,%eax
+  80279c:	78 1a                	js     8027b8 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80279e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a1:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8027a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027aa:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027ad:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027b0:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8027b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027b8:	c9                   	leave
+  8027b9:	c3                   	ret
+
+008027ba <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8027ba:	55                   	push   %ebp
+  8027bb:	89 e5                	mov    %esp,%ebp
+  8027bd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027c0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c6:	e8 f8 fe ff ff       	call   8026c3 <pgbatch_slot>
+  8027cb:	85 c0                	test   %eax,%eax
+  8027cd:	78 20                	js     8027ef <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d2:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027db:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027de:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027e1:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027e4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027e7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ef:	c9                   	leave
+  8027f0:	c3                   	ret
+
+008027f1 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027fd:	e8 c1 fe ff ff       	call   8026c3 <pgbatch_slot>
+  802802:	85 c0                	test   %eax,%eax
+  802804:	78 26                	js     80282c <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  802806:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802809:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80280f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802812:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  802815:	8b 55 10             	mov    0x10(%ebp),%edx
+  802818:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80281b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80281e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  802821:	8b 55 18             	mov    0x18(%ebp),%edx
+  802824:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802827:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+0080282e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80282e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802833:	c3                   	ret
+
+00802834 <devcons_poll>:
+{
+  802834:	55                   	push   %ebp
+  802835:	89 e5                	mov    %esp,%ebp
+  802837:	53                   	push   %ebx
+  802838:	83 ec 04             	sub    $0x4,%esp
+  80283b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80283e:	89 da                	mov    %ebx,%edx
+  802840:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802843:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80284a:	74 0c                	je     802858 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80284c:	89 d8                	mov    %ebx,%eax
+  80284e:	83 e0 01             	and    $0x1,%eax
+  802851:	09 d0                	or     %edx,%eax
+}
+  802853:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802856:	c9                   	leave
+  802857:	c3                   	ret
+		cons_peek = sys_cgetc();
+  802858:	e8 cf d8 ff ff       	call   80012c <sys_cgetc>
+  80285d:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802862:	89 da                	mov    %ebx,%edx
+  802864:	83 e2 04             	and    $0x4,%edx
+  802867:	85 c0                	test   %eax,%eax
+  802869:	74 e6                	je     802851 <devcons_poll+0x1d>
+  80286b:	eb df                	jmp    80284c <devcons_poll+0x18>
+
+0080286d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80286d:	55                   	push   %ebp
+  80286e:	89 e5                	mov    %esp,%ebp
+  802870:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802873:	68 de 3b 80 00       	push   $0x803bde
+  802878:	ff 75 0c             	push   0xc(%ebp)
+  80287b:	e8 57 09 00 00       	call   8031d7 <strcpy>
+	return 0;
+}
+  802880:	b8 00 00 00 00       	mov    $0x0,%eax
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+00802887 <devcons_write>:
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	57                   	push   %edi
+  80288b:	56                   	push   %esi
+  80288c:	53                   	push   %ebx
+  80288d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802893:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802896:	85 ff                	test   %edi,%edi
+  802898:	74 51                	je     8028eb <devcons_write+0x64>
+  80289a:	be 00 00 00 00       	mov    $0x0,%esi
+  80289f:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8028a4:	89 fb                	mov    %edi,%ebx
+  8028a6:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8028a8:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8028ad:	39 d3                	cmp    %edx,%ebx
+  8028af:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8028b2:	83 ec 04             	sub    $0x4,%esp
+  8028b5:	53                   	push   %ebx
+  8028b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8028b9:	50                   	push   %eax
+  8028ba:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028c0:	50                   	push   %eax
+  8028c1:	e8 c1 0a 00 00       	call   803387 <memmove>
+		sys_cputs(buf, m);
+  8028c6:	83 c4 08             	add    $0x8,%esp
+  8028c9:	53                   	push   %ebx
+  8028ca:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028d0:	50                   	push   %eax
+  8028d1:	e8 38 d8 ff ff       	call   80010e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028d6:	01 de                	add    %ebx,%esi
+  8028d8:	89 f0                	mov    %esi,%eax
+  8028da:	83 c4 10             	add    $0x10,%esp
+  8028dd:	39 fe                	cmp    %edi,%esi
+  8028df:	72 c3                	jb     8028a4 <devcons_write+0x1d>
+}
+  8028e1:	89 f0                	mov    %esi,%eax
+  8028e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028e6:	5b                   	pop    %ebx
+  8028e7:	5e                   	pop    %esi
+  8028e8:	5f                   	pop    %edi
+  8028e9:	5d                   	pop    %ebp
+  8028ea:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028eb:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028f0:	eb ef                	jmp    8028e1 <devcons_write+0x5a>
+
+008028f2 <devcons_read>:
+{
+  8028f2:	55                   	push   %ebp
+  8028f3:	89 e5                	mov    %esp,%ebp
+  8028f5:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028f8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028fd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802901:	74 36                	je     802939 <devcons_read+0x47>
+	c = cons_peek;
+  802903:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  802908:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  80290f:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802912:	85 c0                	test   %eax,%eax
+  802914:	75 10                	jne    802926 <devcons_read+0x34>
+  802916:	e8 11 d8 ff ff       	call   80012c <sys_cgetc>
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	75 07                	jne    802926 <devcons_read+0x34>
+		sys_yield();
+  80291f:	e8 87 d8 ff ff       	call   8001ab <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802924:	eb f0                	jmp    802916 <devcons_read+0x24>
+	if (c < 0)
+  802926:	85 c0                	test   %eax,%eax
+  802928:	78 0f                	js     802939 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80292a:	83 f8 04             	cmp    $0x4,%eax
+  80292d:	74 0c                	je     80293b <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80292f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802932:	88 02                	mov    %al,(%edx)
+	return 1;
+  802934:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802939:	c9                   	leave
+  80293a:	c3                   	ret
+		return 0;
+  80293b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802940:	eb f7                	jmp    802939 <devcons_read+0x47>
+
+00802942 <cputchar>:
+{
+  802942:	55                   	push   %ebp
+  802943:	89 e5                	mov    %esp,%ebp
+  802945:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80294e:	6a 01                	push   $0x1
+  802950:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802953:	50                   	push   %eax
+  802954:	e8 b5 d7 ff ff       	call   80010e <sys_cputs>
+}
+  802959:	83 c4 10             	add    $0x10,%esp
+  80295c:	c9                   	leave
+  80295d:	c3                   	ret
+
+0080295e <getchar>:
+{
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802964:	6a 01                	push   $0x1
+  802966:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802969:	50                   	push   %eax
+  80296a:	6a 00                	push   $0x0
+  80296c:	e8 b7 df ff ff       	call   800928 <read>
+	if (r < 0)
+  802971:	83 c4 10             	add    $0x10,%esp
+  802974:	85 c0                	test   %eax,%eax
+  802976:	78 06                	js     80297e <getchar+0x20>
+	if (r < 1)
+  802978:	74 06                	je     802980 <getchar+0x22>
+	return c;
+  80297a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80297e:	c9                   	leave
+  80297f:	c3                   	ret
+		return -E_EOF;
+  802980:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802985:	eb f7                	jmp    80297e <getchar+0x20>
+
+00802987 <iscons>:
+{
+  802987:	55                   	push   %ebp
+  802988:	89 e5                	mov    %esp,%ebp
+  80298a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80298d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802990:	50                   	push   %eax
+  802991:	ff 75 08             	push   0x8(%ebp)
+  802994:	e8 0b dd ff ff       	call   8006a4 <fd_lookup>
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	78 11                	js     8029b1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8029a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029a3:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029a9:	39 10                	cmp    %edx,(%eax)
+  8029ab:	0f 94 c0             	sete   %al
+  8029ae:	0f b6 c0             	movzbl %al,%eax
+}
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+
+008029b3 <opencons>:
+{
+  8029b3:	55                   	push   %ebp
+  8029b4:	89 e5                	mov    %esp,%ebp
+  8029b6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8029b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029bc:	50                   	push   %eax
+  8029bd:	e8 92 dc ff ff       	call   800654 <fd_alloc>
+  8029c2:	83 c4 10             	add    $0x10,%esp
+  8029c5:	85 c0                	test   %eax,%eax
+  8029c7:	78 3a                	js     802a03 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029c9:	83 ec 04             	sub    $0x4,%esp
+  8029cc:	68 07 04 00 00       	push   $0x407
+  8029d1:	ff 75 f4             	push   -0xc(%ebp)
+  8029d4:	6a 00                	push   $0x0
+  8029d6:	e8 ef d7 ff ff       	call   8001ca <sys_page_alloc>
+  8029db:	83 c4 10             	add    $0x10,%esp
+  8029de:	85 c0                	test   %eax,%eax
+  8029e0:	78 21                	js     802a03 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029e5:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029eb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029f0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029f7:	83 ec 0c             	sub    $0xc,%esp
+  8029fa:	50                   	push   %eax
+  8029fb:	e8 2d dc ff ff       	call   80062d <fd2num>
+  802a00:	83 c4 10             	add    $0x10,%esp
+}
+  802a03:	c9                   	leave
+  802a04:	c3                   	ret
+
+00802a05 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802a05:	55                   	push   %ebp
+  802a06:	89 e5                	mov    %esp,%ebp
+  802a08:	56                   	push   %esi
+  802a09:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802a0a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a0d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a13:	e8 74 d7 ff ff       	call   80018c <sys_getenvid>
+  802a18:	83 ec 0c             	sub    $0xc,%esp
+  802a1b:	ff 75 0c             	push   0xc(%ebp)
+  802a1e:	ff 75 08             	push   0x8(%ebp)
+  802a21:	56                   	push   %esi
+  802a22:	50                   	push   %eax
+  802a23:	68 ec 3b 80 00       	push   $0x803bec
+  802a28:	e8 b3 00 00 00       	call   802ae0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802a2d:	83 c4 18             	add    $0x18,%esp
+  802a30:	53                   	push   %ebx
+  802a31:	ff 75 10             	push   0x10(%ebp)
+  802a34:	e8 56 00 00 00       	call   802a8f <vcprintf>
+	cprintf("\n");
+  802a39:	c7 04 24 d0 3b 80 00 	movl   $0x803bd0,(%esp)
+  802a40:	e8 9b 00 00 00       	call   802ae0 <cprintf>
+  802a45:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a48:	cc                   	int3
+	while (1)
+  802a49:	eb fd                	jmp    802a48 <_panic+0x43>
+
+00802a4b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a4b:	55                   	push   %ebp
+  802a4c:	89 e5                	mov    %esp,%ebp
+  802a4e:	53                   	push   %ebx
+  802a4f:	83 ec 04             	sub    $0x4,%esp
+  802a52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a55:	8b 13                	mov    (%ebx),%edx
+  802a57:	8d 42 01             	lea    0x1(%edx),%eax
+  802a5a:	89 03                	mov    %eax,(%ebx)
+  802a5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a5f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a63:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a68:	74 09                	je     802a73 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a6a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a71:	c9                   	leave
+  802a72:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a73:	83 ec 08             	sub    $0x8,%esp
+  802a76:	68 ff 00 00 00       	push   $0xff
+  802a7b:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a7e:	50                   	push   %eax
+  802a7f:	e8 8a d6 ff ff       	call   80010e <sys_cputs>
+		b->idx = 0;
+  802a84:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a8a:	83 c4 10             	add    $0x10,%esp
+  802a8d:	eb db                	jmp    802a6a <putch+0x1f>
+
+00802a8f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a98:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a9f:	00 00 00 
+	b.cnt = 0;
+  802aa2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802aa9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802aac:	ff 75 0c             	push   0xc(%ebp)
+  802aaf:	ff 75 08             	push   0x8(%ebp)
+  802ab2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802ab8:	50                   	push   %eax
+  802ab9:	68 4b 2a 80 00       	push   $0x802a4b
+  802abe:	e8 1c 01 00 00       	call   802bdf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802ac3:	83 c4 08             	add    $0x8,%esp
+  802ac6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802acc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802ad2:	50                   	push   %eax
+  802ad3:	e8 36 d6 ff ff       	call   80010e <sys_cputs>
+
+	return b.cnt;
+}
+  802ad8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+00802ae0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802ae6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802ae9:	50                   	push   %eax
+  802aea:	ff 75 08             	push   0x8(%ebp)
+  802aed:	e8 9d ff ff ff       	call   802a8f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802af2:	c9                   	leave
+  802af3:	c3                   	ret
+
+00802af4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802af4:	55                   	push   %ebp
+  802af5:	89 e5                	mov    %esp,%ebp
+  802af7:	57                   	push   %edi
+  802af8:	56                   	push   %esi
+  802af9:	53                   	push   %ebx
+  802afa:	83 ec 1c             	sub    $0x1c,%esp
+  802afd:	89 c3                	mov    %eax,%ebx
+  802aff:	89 d6                	mov    %edx,%esi
+  802b01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b07:	89 d1                	mov    %edx,%ecx
+  802b09:	89 c2                	mov    %eax,%edx
+  802b0b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802b0e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b11:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802b14:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b17:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b1e:	39 c2                	cmp    %eax,%edx
+  802b20:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802b23:	73 4b                	jae    802b70 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802b25:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b28:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b2b:	85 ff                	test   %edi,%edi
+  802b2d:	7e 11                	jle    802b40 <printnum+0x4c>
+			putch(padc, putdat);
+  802b2f:	83 ec 08             	sub    $0x8,%esp
+  802b32:	56                   	push   %esi
+  802b33:	ff 75 18             	push   0x18(%ebp)
+  802b36:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b38:	83 c4 10             	add    $0x10,%esp
+  802b3b:	83 ef 01             	sub    $0x1,%edi
+  802b3e:	75 ef                	jne    802b2f <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b40:	83 ec 08             	sub    $0x8,%esp
+  802b43:	56                   	push   %esi
+  802b44:	83 ec 04             	sub    $0x4,%esp
+  802b47:	ff 75 e4             	push   -0x1c(%ebp)
+  802b4a:	ff 75 e0             	push   -0x20(%ebp)
+  802b4d:	ff 75 dc             	push   -0x24(%ebp)
+  802b50:	ff 75 d8             	push   -0x28(%ebp)
+  802b53:	e8 33 0e 00 00       	call   80398b <__umoddi3>
+  802b58:	83 c4 14             	add    $0x14,%esp
+  802b5b:	0f be 80 0f 3c 80 00 	movsbl 0x803c0f(%eax),%eax
+  802b62:	50                   	push   %eax
+  802b63:	ff d3                	call   *%ebx
+}
+  802b65:	83 c4 10             	add    $0x10,%esp
+  802b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6b:	5b                   	pop    %ebx
+  802b6c:	5e                   	pop    %esi
+  802b6d:	5f                   	pop    %edi
+  802b6e:	5d                   	pop    %ebp
+  802b6f:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b70:	83 ec 0c             	sub    $0xc,%esp
+  802b73:	ff 75 18             	push   0x18(%ebp)
+  802b76:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b79:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b7c:	52                   	push   %edx
+  802b7d:	50                   	push   %eax
+  802b7e:	83 ec 08             	sub    $0x8,%esp
+  802b81:	ff 75 e4             	push   -0x1c(%ebp)
+  802b84:	ff 75 e0             	push   -0x20(%ebp)
+  802b87:	ff 75 dc             	push   -0x24(%ebp)
+  802b8a:	ff 75 d8             	push   -0x28(%ebp)
+  802b8d:	e8 33 0d 00 00       	call   8038c5 <__udivdi3>
+  802b92:	83 c4 18             	add    $0x18,%esp
+  802b95:	52                   	push   %edx
+  802b96:	50                   	push   %eax
+  802b97:	89 f2                	mov    %esi,%edx
+  802b99:	89 d8                	mov    %ebx,%eax
+  802b9b:	e8 54 ff ff ff       	call   802af4 <printnum>
+  802ba0:	83 c4 20             	add    $0x20,%esp
+  802ba3:	eb 9b                	jmp    802b40 <printnum+0x4c>
+
+00802ba5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802ba5:	55                   	push   %ebp
+  802ba6:	89 e5                	mov    %esp,%ebp
+  802ba8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802bab:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802baf:	8b 10                	mov    (%eax),%edx
+  802bb1:	3b 50 04             	cmp    0x4(%eax),%edx
+  802bb4:	73 0a                	jae    802bc0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802bb6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802bb9:	89 08                	mov    %ecx,(%eax)
+  802bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbe:	88 02                	mov    %al,(%edx)
+}
+  802bc0:	5d                   	pop    %ebp
+  802bc1:	c3                   	ret
+
+00802bc2 <printfmt>:
+{
+  802bc2:	55                   	push   %ebp
+  802bc3:	89 e5                	mov    %esp,%ebp
+  802bc5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802bc8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802bcb:	50                   	push   %eax
+  802bcc:	ff 75 10             	push   0x10(%ebp)
+  802bcf:	ff 75 0c             	push   0xc(%ebp)
+  802bd2:	ff 75 08             	push   0x8(%ebp)
+  802bd5:	e8 05 00 00 00       	call   802bdf <vprintfmt>
+}
+  802bda:	83 c4 10             	add    $0x10,%esp
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+
+00802bdf <vprintfmt>:
+{
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	57                   	push   %edi
+  802be3:	56                   	push   %esi
+  802be4:	53                   	push   %ebx
+  802be5:	83 ec 2c             	sub    $0x2c,%esp
+  802be8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802beb:	89 df                	mov    %ebx,%edi
+  802bed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bf0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bf3:	8d 70 01             	lea    0x1(%eax),%esi
+  802bf6:	0f b6 00             	movzbl (%eax),%eax
+  802bf9:	83 f8 25             	cmp    $0x25,%eax
+  802bfc:	74 1e                	je     802c1c <vprintfmt+0x3d>
+			if (ch == '\0')
+  802bfe:	85 c0                	test   %eax,%eax
+  802c00:	0f 84 15 05 00 00    	je     80311b <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802c06:	83 ec 08             	sub    $0x8,%esp
+  802c09:	53                   	push   %ebx
+  802c0a:	50                   	push   %eax
+  802c0b:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802c0d:	83 c6 01             	add    $0x1,%esi
+  802c10:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802c14:	83 c4 10             	add    $0x10,%esp
+  802c17:	83 f8 25             	cmp    $0x25,%eax
+  802c1a:	75 e2                	jne    802bfe <vprintfmt+0x1f>
+		padc = ' ';
+  802c1c:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802c20:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802c27:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802c2e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c3a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c3d:	8d 56 01             	lea    0x1(%esi),%edx
+  802c40:	0f b6 0e             	movzbl (%esi),%ecx
+  802c43:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c46:	3c 55                	cmp    $0x55,%al
+  802c48:	0f 87 3b 04 00 00    	ja     803089 <vprintfmt+0x4aa>
+  802c4e:	0f b6 c0             	movzbl %al,%eax
+  802c51:	ff 24 85 80 3d 80 00 	jmp    *0x803d80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c58:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c5b:	eb 93                	jmp    802bf0 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c5d:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c5f:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c63:	eb d8                	jmp    802c3d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c65:	89 d6                	mov    %edx,%esi
+  802c67:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c6b:	eb d0                	jmp    802c3d <vprintfmt+0x5e>
+  802c6d:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c70:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c73:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c76:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c7a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c7d:	83 f9 09             	cmp    $0x9,%ecx
+  802c80:	77 6f                	ja     802cf1 <vprintfmt+0x112>
+  802c82:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c85:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c88:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c8b:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c8f:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c92:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c95:	83 fe 09             	cmp    $0x9,%esi
+  802c98:	76 eb                	jbe    802c85 <vprintfmt+0xa6>
+  802c9a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c9d:	89 d6                	mov    %edx,%esi
+  802c9f:	eb 13                	jmp    802cb4 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802ca1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ca4:	8b 00                	mov    (%eax),%eax
+  802ca6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ca9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cac:	8d 40 04             	lea    0x4(%eax),%eax
+  802caf:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cb2:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802cb4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802cb8:	79 83                	jns    802c3d <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802cba:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802cbd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802cc0:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802cc7:	e9 71 ff ff ff       	jmp    802c3d <vprintfmt+0x5e>
+			if (width < 0)
+  802ccc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ccf:	85 c9                	test   %ecx,%ecx
+  802cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd6:	0f 49 c1             	cmovns %ecx,%eax
+  802cd9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cdc:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cde:	e9 5a ff ff ff       	jmp    802c3d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802ce3:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802ce5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cec:	e9 4c ff ff ff       	jmp    802c3d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cf1:	89 d6                	mov    %edx,%esi
+  802cf3:	eb bf                	jmp    802cb4 <vprintfmt+0xd5>
+			lflag++;
+  802cf5:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cf9:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cfb:	e9 3d ff ff ff       	jmp    802c3d <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802d00:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d03:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d06:	8d 70 04             	lea    0x4(%eax),%esi
+  802d09:	83 ec 08             	sub    $0x8,%esp
+  802d0c:	53                   	push   %ebx
+  802d0d:	ff 30                	push   (%eax)
+  802d0f:	ff d7                	call   *%edi
+			break;
+  802d11:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802d14:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802d17:	e9 d4 fe ff ff       	jmp    802bf0 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802d1c:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d22:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802d25:	8b 10                	mov    (%eax),%edx
+  802d27:	89 d0                	mov    %edx,%eax
+  802d29:	f7 d8                	neg    %eax
+  802d2b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802d2e:	83 f8 12             	cmp    $0x12,%eax
+  802d31:	7f 23                	jg     802d56 <vprintfmt+0x177>
+  802d33:	8b 14 85 e0 3e 80 00 	mov    0x803ee0(,%eax,4),%edx
+  802d3a:	85 d2                	test   %edx,%edx
+  802d3c:	74 18                	je     802d56 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d3e:	52                   	push   %edx
+  802d3f:	68 9b 3b 80 00       	push   $0x803b9b
+  802d44:	53                   	push   %ebx
+  802d45:	57                   	push   %edi
+  802d46:	e8 77 fe ff ff       	call   802bc2 <printfmt>
+  802d4b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d4e:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d51:	e9 9a fe ff ff       	jmp    802bf0 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d56:	50                   	push   %eax
+  802d57:	68 27 3c 80 00       	push   $0x803c27
+  802d5c:	53                   	push   %ebx
+  802d5d:	57                   	push   %edi
+  802d5e:	e8 5f fe ff ff       	call   802bc2 <printfmt>
+  802d63:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d66:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d69:	e9 82 fe ff ff       	jmp    802bf0 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d6e:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d71:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d74:	83 c0 04             	add    $0x4,%eax
+  802d77:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d7d:	8b 00                	mov    (%eax),%eax
+  802d7f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d82:	85 c0                	test   %eax,%eax
+  802d84:	0f 84 61 03 00 00    	je     8030eb <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d8a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d8e:	7e 06                	jle    802d96 <vprintfmt+0x1b7>
+  802d90:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d94:	75 29                	jne    802dbf <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d96:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d99:	8d 70 01             	lea    0x1(%eax),%esi
+  802d9c:	0f b6 00             	movzbl (%eax),%eax
+  802d9f:	0f be d0             	movsbl %al,%edx
+  802da2:	85 d2                	test   %edx,%edx
+  802da4:	0f 84 bb 00 00 00    	je     802e65 <vprintfmt+0x286>
+  802daa:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802dad:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802db0:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802db3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802db6:	eb 7a                	jmp    802e32 <vprintfmt+0x253>
+				p = "(null)";
+  802db8:	c7 45 d0 20 3c 80 00 	movl   $0x803c20,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dbf:	83 ec 08             	sub    $0x8,%esp
+  802dc2:	ff 75 d4             	push   -0x2c(%ebp)
+  802dc5:	ff 75 d0             	push   -0x30(%ebp)
+  802dc8:	e8 e0 03 00 00       	call   8031ad <strnlen>
+  802dcd:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802dd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802dd3:	83 c4 10             	add    $0x10,%esp
+  802dd6:	85 d2                	test   %edx,%edx
+  802dd8:	0f 8e d6 02 00 00    	jle    8030b4 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802dde:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802de2:	83 ec 08             	sub    $0x8,%esp
+  802de5:	53                   	push   %ebx
+  802de6:	56                   	push   %esi
+  802de7:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802de9:	83 c4 10             	add    $0x10,%esp
+  802dec:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802df0:	75 f0                	jne    802de2 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802df2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802df5:	8d 70 01             	lea    0x1(%eax),%esi
+  802df8:	0f b6 00             	movzbl (%eax),%eax
+  802dfb:	0f be d0             	movsbl %al,%edx
+  802dfe:	85 d2                	test   %edx,%edx
+  802e00:	0f 84 da 02 00 00    	je     8030e0 <vprintfmt+0x501>
+  802e06:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802e09:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802e0c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802e0f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e12:	eb 1e                	jmp    802e32 <vprintfmt+0x253>
+					putch(ch, putdat);
+  802e14:	83 ec 08             	sub    $0x8,%esp
+  802e17:	ff 75 0c             	push   0xc(%ebp)
+  802e1a:	52                   	push   %edx
+  802e1b:	ff 55 08             	call   *0x8(%ebp)
+  802e1e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802e21:	83 eb 01             	sub    $0x1,%ebx
+  802e24:	83 c6 01             	add    $0x1,%esi
+  802e27:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e2b:	0f be d0             	movsbl %al,%edx
+  802e2e:	85 d2                	test   %edx,%edx
+  802e30:	74 2a                	je     802e5c <vprintfmt+0x27d>
+  802e32:	85 ff                	test   %edi,%edi
+  802e34:	78 05                	js     802e3b <vprintfmt+0x25c>
+  802e36:	83 ef 01             	sub    $0x1,%edi
+  802e39:	78 59                	js     802e94 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e3b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e3f:	74 d3                	je     802e14 <vprintfmt+0x235>
+  802e41:	0f be c0             	movsbl %al,%eax
+  802e44:	83 e8 20             	sub    $0x20,%eax
+  802e47:	83 f8 5e             	cmp    $0x5e,%eax
+  802e4a:	76 c8                	jbe    802e14 <vprintfmt+0x235>
+					putch('?', putdat);
+  802e4c:	83 ec 08             	sub    $0x8,%esp
+  802e4f:	ff 75 0c             	push   0xc(%ebp)
+  802e52:	6a 3f                	push   $0x3f
+  802e54:	ff 55 08             	call   *0x8(%ebp)
+  802e57:	83 c4 10             	add    $0x10,%esp
+  802e5a:	eb c5                	jmp    802e21 <vprintfmt+0x242>
+  802e5c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e5f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e65:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e68:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e6c:	7e 1b                	jle    802e89 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e6e:	83 ec 08             	sub    $0x8,%esp
+  802e71:	53                   	push   %ebx
+  802e72:	6a 20                	push   $0x20
+  802e74:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e76:	83 c4 10             	add    $0x10,%esp
+  802e79:	83 ee 01             	sub    $0x1,%esi
+  802e7c:	75 f0                	jne    802e6e <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e7e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e81:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e84:	e9 67 fd ff ff       	jmp    802bf0 <vprintfmt+0x11>
+  802e89:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e8c:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e8f:	e9 5c fd ff ff       	jmp    802bf0 <vprintfmt+0x11>
+  802e94:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e97:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e9d:	eb c6                	jmp    802e65 <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e9f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802ea2:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ea5:	83 f9 01             	cmp    $0x1,%ecx
+  802ea8:	7f 1f                	jg     802ec9 <vprintfmt+0x2ea>
+	else if (lflag)
+  802eaa:	85 c9                	test   %ecx,%ecx
+  802eac:	74 67                	je     802f15 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802eae:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eb1:	8b 30                	mov    (%eax),%esi
+  802eb3:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802eb6:	89 f0                	mov    %esi,%eax
+  802eb8:	c1 f8 1f             	sar    $0x1f,%eax
+  802ebb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802ebe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ec1:	8d 40 04             	lea    0x4(%eax),%eax
+  802ec4:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ec7:	eb 17                	jmp    802ee0 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802ec9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ecc:	8b 50 04             	mov    0x4(%eax),%edx
+  802ecf:	8b 00                	mov    (%eax),%eax
+  802ed1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ed4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802ed7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eda:	8d 40 08             	lea    0x8(%eax),%eax
+  802edd:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802ee0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ee3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802ee6:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802eeb:	85 c9                	test   %ecx,%ecx
+  802eed:	0f 89 12 01 00 00    	jns    803005 <vprintfmt+0x426>
+				putch('-', putdat);
+  802ef3:	83 ec 08             	sub    $0x8,%esp
+  802ef6:	53                   	push   %ebx
+  802ef7:	6a 2d                	push   $0x2d
+  802ef9:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802efb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802efe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f01:	f7 da                	neg    %edx
+  802f03:	83 d1 00             	adc    $0x0,%ecx
+  802f06:	f7 d9                	neg    %ecx
+  802f08:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802f0b:	be 0a 00 00 00       	mov    $0xa,%esi
+  802f10:	e9 f0 00 00 00       	jmp    803005 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802f15:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f18:	8b 30                	mov    (%eax),%esi
+  802f1a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f1d:	89 f0                	mov    %esi,%eax
+  802f1f:	c1 f8 1f             	sar    $0x1f,%eax
+  802f22:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f25:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f28:	8d 40 04             	lea    0x4(%eax),%eax
+  802f2b:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f2e:	eb b0                	jmp    802ee0 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f30:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f33:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f36:	83 f9 01             	cmp    $0x1,%ecx
+  802f39:	7f 1e                	jg     802f59 <vprintfmt+0x37a>
+	else if (lflag)
+  802f3b:	85 c9                	test   %ecx,%ecx
+  802f3d:	74 32                	je     802f71 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f3f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f42:	8b 10                	mov    (%eax),%edx
+  802f44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f49:	8d 40 04             	lea    0x4(%eax),%eax
+  802f4c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f4f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f54:	e9 ac 00 00 00       	jmp    803005 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f59:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f5c:	8b 10                	mov    (%eax),%edx
+  802f5e:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f61:	8d 40 08             	lea    0x8(%eax),%eax
+  802f64:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f67:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f6c:	e9 94 00 00 00       	jmp    803005 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f71:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f74:	8b 10                	mov    (%eax),%edx
+  802f76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f7b:	8d 40 04             	lea    0x4(%eax),%eax
+  802f7e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f81:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f86:	eb 7d                	jmp    803005 <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f88:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f8b:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f8e:	83 f9 01             	cmp    $0x1,%ecx
+  802f91:	7f 1b                	jg     802fae <vprintfmt+0x3cf>
+	else if (lflag)
+  802f93:	85 c9                	test   %ecx,%ecx
+  802f95:	74 2c                	je     802fc3 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f97:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f9a:	8b 10                	mov    (%eax),%edx
+  802f9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fa1:	8d 40 04             	lea    0x4(%eax),%eax
+  802fa4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fa7:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802fac:	eb 57                	jmp    803005 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802fae:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fb1:	8b 10                	mov    (%eax),%edx
+  802fb3:	8b 48 04             	mov    0x4(%eax),%ecx
+  802fb6:	8d 40 08             	lea    0x8(%eax),%eax
+  802fb9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fbc:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802fc1:	eb 42                	jmp    803005 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802fc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc6:	8b 10                	mov    (%eax),%edx
+  802fc8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fcd:	8d 40 04             	lea    0x4(%eax),%eax
+  802fd0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fd3:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fd8:	eb 2b                	jmp    803005 <vprintfmt+0x426>
+			putch('0', putdat);
+  802fda:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fdd:	83 ec 08             	sub    $0x8,%esp
+  802fe0:	53                   	push   %ebx
+  802fe1:	6a 30                	push   $0x30
+  802fe3:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fe5:	83 c4 08             	add    $0x8,%esp
+  802fe8:	53                   	push   %ebx
+  802fe9:	6a 78                	push   $0x78
+  802feb:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fed:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ff0:	8b 10                	mov    (%eax),%edx
+  802ff2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ff7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ffa:	8d 40 04             	lea    0x4(%eax),%eax
+  802ffd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803000:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  803005:	83 ec 0c             	sub    $0xc,%esp
+  803008:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80300c:	50                   	push   %eax
+  80300d:	ff 75 e4             	push   -0x1c(%ebp)
+  803010:	56                   	push   %esi
+  803011:	51                   	push   %ecx
+  803012:	52                   	push   %edx
+  803013:	89 da                	mov    %ebx,%edx
+  803015:	89 f8                	mov    %edi,%eax
+  803017:	e8 d8 fa ff ff       	call   802af4 <printnum>
+			break;
+  80301c:	83 c4 20             	add    $0x20,%esp
+  80301f:	e9 cc fb ff ff       	jmp    802bf0 <vprintfmt+0x11>
+	if (lflag >= 2)
+  803024:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803027:	89 55 10             	mov    %edx,0x10(%ebp)
+  80302a:	83 f9 01             	cmp    $0x1,%ecx
+  80302d:	7f 1b                	jg     80304a <vprintfmt+0x46b>
+	else if (lflag)
+  80302f:	85 c9                	test   %ecx,%ecx
+  803031:	74 2c                	je     80305f <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803033:	8b 45 14             	mov    0x14(%ebp),%eax
+  803036:	8b 10                	mov    (%eax),%edx
+  803038:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80303d:	8d 40 04             	lea    0x4(%eax),%eax
+  803040:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803043:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  803048:	eb bb                	jmp    803005 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80304a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80304d:	8b 10                	mov    (%eax),%edx
+  80304f:	8b 48 04             	mov    0x4(%eax),%ecx
+  803052:	8d 40 08             	lea    0x8(%eax),%eax
+  803055:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803058:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80305d:	eb a6                	jmp    803005 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80305f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803062:	8b 10                	mov    (%eax),%edx
+  803064:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803069:	8d 40 04             	lea    0x4(%eax),%eax
+  80306c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80306f:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  803074:	eb 8f                	jmp    803005 <vprintfmt+0x426>
+			putch(ch, putdat);
+  803076:	89 55 10             	mov    %edx,0x10(%ebp)
+  803079:	83 ec 08             	sub    $0x8,%esp
+  80307c:	53                   	push   %ebx
+  80307d:	6a 25                	push   $0x25
+  80307f:	ff d7                	call   *%edi
+			break;
+  803081:	83 c4 10             	add    $0x10,%esp
+  803084:	e9 67 fb ff ff       	jmp    802bf0 <vprintfmt+0x11>
+			putch('%', putdat);
+  803089:	83 ec 08             	sub    $0x8,%esp
+  80308c:	53                   	push   %ebx
+  80308d:	6a 25                	push   $0x25
+  80308f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803091:	83 c4 10             	add    $0x10,%esp
+  803094:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  803098:	0f 84 ba fb ff ff    	je     802c58 <vprintfmt+0x79>
+  80309e:	89 75 10             	mov    %esi,0x10(%ebp)
+  8030a1:	89 f0                	mov    %esi,%eax
+  8030a3:	83 e8 01             	sub    $0x1,%eax
+  8030a6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8030aa:	75 f7                	jne    8030a3 <vprintfmt+0x4c4>
+  8030ac:	89 45 10             	mov    %eax,0x10(%ebp)
+  8030af:	e9 3c fb ff ff       	jmp    802bf0 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030b4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8030b7:	8d 70 01             	lea    0x1(%eax),%esi
+  8030ba:	0f b6 00             	movzbl (%eax),%eax
+  8030bd:	0f be d0             	movsbl %al,%edx
+  8030c0:	85 d2                	test   %edx,%edx
+  8030c2:	74 11                	je     8030d5 <vprintfmt+0x4f6>
+  8030c4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030c7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030ca:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030cd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030d0:	e9 5d fd ff ff       	jmp    802e32 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030db:	e9 10 fb ff ff       	jmp    802bf0 <vprintfmt+0x11>
+  8030e0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030e6:	e9 05 fb ff ff       	jmp    802bf0 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030eb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030ef:	7e 0a                	jle    8030fb <vprintfmt+0x51c>
+  8030f1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030f5:	0f 85 bd fc ff ff    	jne    802db8 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030fb:	ba 28 00 00 00       	mov    $0x28,%edx
+  803100:	b8 28 00 00 00       	mov    $0x28,%eax
+  803105:	be 21 3c 80 00       	mov    $0x803c21,%esi
+  80310a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80310d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803110:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803113:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803116:	e9 17 fd ff ff       	jmp    802e32 <vprintfmt+0x253>
+}
+  80311b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80311e:	5b                   	pop    %ebx
+  80311f:	5e                   	pop    %esi
+  803120:	5f                   	pop    %edi
+  803121:	5d                   	pop    %ebp
+  803122:	c3                   	ret
+
+00803123 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803123:	55                   	push   %ebp
+  803124:	89 e5                	mov    %esp,%ebp
+  803126:	83 ec 18             	sub    $0x18,%esp
+  803129:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80312f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803132:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803136:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803139:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803140:	85 c0                	test   %eax,%eax
+  803142:	74 26                	je     80316a <vsnprintf+0x47>
+  803144:	85 d2                	test   %edx,%edx
+  803146:	7e 22                	jle    80316a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803148:	ff 75 14             	push   0x14(%ebp)
+  80314b:	ff 75 10             	push   0x10(%ebp)
+  80314e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803151:	50                   	push   %eax
+  803152:	68 a5 2b 80 00       	push   $0x802ba5
+  803157:	e8 83 fa ff ff       	call   802bdf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80315c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80315f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803162:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803165:	83 c4 10             	add    $0x10,%esp
+}
+  803168:	c9                   	leave
+  803169:	c3                   	ret
+		return -E_INVAL;
+  80316a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80316f:	eb f7                	jmp    803168 <vsnprintf+0x45>
+
+00803171 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803171:	55                   	push   %ebp
+  803172:	89 e5                	mov    %esp,%ebp
+  803174:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803177:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80317a:	50                   	push   %eax
+  80317b:	ff 75 10             	push   0x10(%ebp)
+  80317e:	ff 75 0c             	push   0xc(%ebp)
+  803181:	ff 75 08             	push   0x8(%ebp)
+  803184:	e8 9a ff ff ff       	call   803123 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803189:	c9                   	leave
+  80318a:	c3                   	ret
+
+0080318b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80318b:	55                   	push   %ebp
+  80318c:	89 e5                	mov    %esp,%ebp
+  80318e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803191:	80 3a 00             	cmpb   $0x0,(%edx)
+  803194:	74 10                	je     8031a6 <strlen+0x1b>
+  803196:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80319b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80319e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8031a2:	75 f7                	jne    80319b <strlen+0x10>
+	return n;
+}
+  8031a4:	5d                   	pop    %ebp
+  8031a5:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8031a6:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8031ab:	eb f7                	jmp    8031a4 <strlen+0x19>
+
+008031ad <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8031ad:	55                   	push   %ebp
+  8031ae:	89 e5                	mov    %esp,%ebp
+  8031b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031b6:	85 d2                	test   %edx,%edx
+  8031b8:	74 16                	je     8031d0 <strnlen+0x23>
+  8031ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8031c3:	74 09                	je     8031ce <strnlen+0x21>
+		n++;
+  8031c5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031c8:	39 d0                	cmp    %edx,%eax
+  8031ca:	75 f3                	jne    8031bf <strnlen+0x12>
+		n++;
+  8031cc:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8031ce:	5d                   	pop    %ebp
+  8031cf:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d5:	eb f7                	jmp    8031ce <strnlen+0x21>
+
+008031d7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031d7:	55                   	push   %ebp
+  8031d8:	89 e5                	mov    %esp,%ebp
+  8031da:	53                   	push   %ebx
+  8031db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031ea:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031ed:	83 c0 01             	add    $0x1,%eax
+  8031f0:	84 d2                	test   %dl,%dl
+  8031f2:	75 f2                	jne    8031e6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031f4:	89 c8                	mov    %ecx,%eax
+  8031f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031f9:	c9                   	leave
+  8031fa:	c3                   	ret
+
+008031fb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031fb:	55                   	push   %ebp
+  8031fc:	89 e5                	mov    %esp,%ebp
+  8031fe:	53                   	push   %ebx
+  8031ff:	83 ec 10             	sub    $0x10,%esp
+  803202:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  803205:	53                   	push   %ebx
+  803206:	e8 80 ff ff ff       	call   80318b <strlen>
+  80320b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80320e:	ff 75 0c             	push   0xc(%ebp)
+  803211:	01 d8                	add    %ebx,%eax
+  803213:	50                   	push   %eax
+  803214:	e8 be ff ff ff       	call   8031d7 <strcpy>
+	return dst;
+}
+  803219:	89 d8                	mov    %ebx,%eax
+  80321b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+
+00803220 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803220:	55                   	push   %ebp
+  803221:	89 e5                	mov    %esp,%ebp
+  803223:	56                   	push   %esi
+  803224:	53                   	push   %ebx
+  803225:	8b 75 08             	mov    0x8(%ebp),%esi
+  803228:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80322b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80322e:	85 db                	test   %ebx,%ebx
+  803230:	74 17                	je     803249 <strncpy+0x29>
+  803232:	01 f3                	add    %esi,%ebx
+  803234:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  803236:	83 c0 01             	add    $0x1,%eax
+  803239:	0f b6 0a             	movzbl (%edx),%ecx
+  80323c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80323f:	80 f9 01             	cmp    $0x1,%cl
+  803242:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  803245:	39 c3                	cmp    %eax,%ebx
+  803247:	75 ed                	jne    803236 <strncpy+0x16>
+	}
+	return ret;
+}
+  803249:	89 f0                	mov    %esi,%eax
+  80324b:	5b                   	pop    %ebx
+  80324c:	5e                   	pop    %esi
+  80324d:	5d                   	pop    %ebp
+  80324e:	c3                   	ret
+
+0080324f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80324f:	55                   	push   %ebp
+  803250:	89 e5                	mov    %esp,%ebp
+  803252:	56                   	push   %esi
+  803253:	53                   	push   %ebx
+  803254:	8b 75 08             	mov    0x8(%ebp),%esi
+  803257:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80325a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80325d:	89 f0                	mov    %esi,%eax
+  80325f:	85 db                	test   %ebx,%ebx
+  803261:	74 1e                	je     803281 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  803263:	83 eb 01             	sub    $0x1,%ebx
+  803266:	74 16                	je     80327e <strlcpy+0x2f>
+  803268:	01 f3                	add    %esi,%ebx
+  80326a:	0f b6 0a             	movzbl (%edx),%ecx
+  80326d:	84 c9                	test   %cl,%cl
+  80326f:	74 0d                	je     80327e <strlcpy+0x2f>
+			*dst++ = *src++;
+  803271:	83 c2 01             	add    $0x1,%edx
+  803274:	83 c0 01             	add    $0x1,%eax
+  803277:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80327a:	39 d8                	cmp    %ebx,%eax
+  80327c:	75 ec                	jne    80326a <strlcpy+0x1b>
+		*dst = '\0';
+  80327e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803281:	29 f0                	sub    %esi,%eax
+}
+  803283:	5b                   	pop    %ebx
+  803284:	5e                   	pop    %esi
+  803285:	5d                   	pop    %ebp
+  803286:	c3                   	ret
+
+00803287 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80328d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803290:	0f b6 01             	movzbl (%ecx),%eax
+  803293:	84 c0                	test   %al,%al
+  803295:	74 11                	je     8032a8 <strcmp+0x21>
+  803297:	38 02                	cmp    %al,(%edx)
+  803299:	75 0d                	jne    8032a8 <strcmp+0x21>
+		p++, q++;
+  80329b:	83 c1 01             	add    $0x1,%ecx
+  80329e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8032a1:	0f b6 01             	movzbl (%ecx),%eax
+  8032a4:	84 c0                	test   %al,%al
+  8032a6:	75 ef                	jne    803297 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032a8:	0f b6 c0             	movzbl %al,%eax
+  8032ab:	0f b6 12             	movzbl (%edx),%edx
+  8032ae:	29 d0                	sub    %edx,%eax
+}
+  8032b0:	5d                   	pop    %ebp
+  8032b1:	c3                   	ret
+
+008032b2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8032b2:	55                   	push   %ebp
+  8032b3:	89 e5                	mov    %esp,%ebp
+  8032b5:	53                   	push   %ebx
+  8032b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8032bc:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8032bf:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8032c4:	85 d2                	test   %edx,%edx
+  8032c6:	74 2e                	je     8032f6 <strncmp+0x44>
+  8032c8:	0f b6 01             	movzbl (%ecx),%eax
+  8032cb:	84 c0                	test   %al,%al
+  8032cd:	74 16                	je     8032e5 <strncmp+0x33>
+  8032cf:	3a 03                	cmp    (%ebx),%al
+  8032d1:	75 12                	jne    8032e5 <strncmp+0x33>
+		n--, p++, q++;
+  8032d3:	83 c1 01             	add    $0x1,%ecx
+  8032d6:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032d9:	83 ea 01             	sub    $0x1,%edx
+  8032dc:	75 ea                	jne    8032c8 <strncmp+0x16>
+		return 0;
+  8032de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e3:	eb 11                	jmp    8032f6 <strncmp+0x44>
+  8032e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032ea:	85 d2                	test   %edx,%edx
+  8032ec:	74 08                	je     8032f6 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032ee:	0f b6 01             	movzbl (%ecx),%eax
+  8032f1:	0f b6 13             	movzbl (%ebx),%edx
+  8032f4:	29 d0                	sub    %edx,%eax
+}
+  8032f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032f9:	c9                   	leave
+  8032fa:	c3                   	ret
+
+008032fb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032fb:	55                   	push   %ebp
+  8032fc:	89 e5                	mov    %esp,%ebp
+  8032fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803301:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  803305:	0f b6 10             	movzbl (%eax),%edx
+  803308:	84 d2                	test   %dl,%dl
+  80330a:	74 15                	je     803321 <strchr+0x26>
+		if (*s == c)
+  80330c:	38 d1                	cmp    %dl,%cl
+  80330e:	74 0f                	je     80331f <strchr+0x24>
+	for (; *s; s++)
+  803310:	83 c0 01             	add    $0x1,%eax
+  803313:	0f b6 10             	movzbl (%eax),%edx
+  803316:	84 d2                	test   %dl,%dl
+  803318:	75 f2                	jne    80330c <strchr+0x11>
+			return (char *) s;
+	return 0;
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331f:	5d                   	pop    %ebp
+  803320:	c3                   	ret
+	return 0;
+  803321:	b8 00 00 00 00       	mov    $0x0,%eax
+  803326:	eb f7                	jmp    80331f <strchr+0x24>
+
+00803328 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  803328:	55                   	push   %ebp
+  803329:	89 e5                	mov    %esp,%ebp
+  80332b:	53                   	push   %ebx
+  80332c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  803332:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  803335:	38 d3                	cmp    %dl,%bl
+  803337:	74 14                	je     80334d <strfind+0x25>
+  803339:	89 d1                	mov    %edx,%ecx
+  80333b:	84 db                	test   %bl,%bl
+  80333d:	74 0e                	je     80334d <strfind+0x25>
+	for (; *s; s++)
+  80333f:	83 c0 01             	add    $0x1,%eax
+  803342:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  803345:	38 ca                	cmp    %cl,%dl
+  803347:	74 04                	je     80334d <strfind+0x25>
+  803349:	84 d2                	test   %dl,%dl
+  80334b:	75 f2                	jne    80333f <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  80334d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803350:	c9                   	leave
+  803351:	c3                   	ret
+
+00803352 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	57                   	push   %edi
+  803356:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803359:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80335c:	85 c9                	test   %ecx,%ecx
+  80335e:	74 20                	je     803380 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803360:	89 f8                	mov    %edi,%eax
+  803362:	09 c8                	or     %ecx,%eax
+  803364:	a8 03                	test   $0x3,%al
+  803366:	75 12                	jne    80337a <memset+0x28>
+		c &= 0xFF;
+  803368:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80336c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803372:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  803375:	fc                   	cld
+  803376:	f3 ab                	rep stos %eax,%es:(%edi)
+  803378:	eb 06                	jmp    803380 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80337a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80337d:	fc                   	cld
+  80337e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803380:	89 f8                	mov    %edi,%eax
+  803382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803385:	c9                   	leave
+  803386:	c3                   	ret
+
+00803387 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803387:	55                   	push   %ebp
+  803388:	89 e5                	mov    %esp,%ebp
+  80338a:	57                   	push   %edi
+  80338b:	56                   	push   %esi
+  80338c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80338f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803392:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803395:	39 c6                	cmp    %eax,%esi
+  803397:	73 32                	jae    8033cb <memmove+0x44>
+  803399:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80339c:	39 d0                	cmp    %edx,%eax
+  80339e:	73 2b                	jae    8033cb <memmove+0x44>
+		s += n;
+		d += n;
+  8033a0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033a3:	89 d6                	mov    %edx,%esi
+  8033a5:	09 fe                	or     %edi,%esi
+  8033a7:	09 ce                	or     %ecx,%esi
+  8033a9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8033af:	75 0e                	jne    8033bf <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8033b1:	83 ef 04             	sub    $0x4,%edi
+  8033b4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8033b7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8033ba:	fd                   	std
+  8033bb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033bd:	eb 09                	jmp    8033c8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8033bf:	83 ef 01             	sub    $0x1,%edi
+  8033c2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8033c5:	fd                   	std
+  8033c6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8033c8:	fc                   	cld
+  8033c9:	eb 1a                	jmp    8033e5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033cb:	89 f2                	mov    %esi,%edx
+  8033cd:	09 c2                	or     %eax,%edx
+  8033cf:	09 ca                	or     %ecx,%edx
+  8033d1:	f6 c2 03             	test   $0x3,%dl
+  8033d4:	75 0a                	jne    8033e0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033d6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033d9:	89 c7                	mov    %eax,%edi
+  8033db:	fc                   	cld
+  8033dc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033de:	eb 05                	jmp    8033e5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033e0:	89 c7                	mov    %eax,%edi
+  8033e2:	fc                   	cld
+  8033e3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033e5:	5e                   	pop    %esi
+  8033e6:	5f                   	pop    %edi
+  8033e7:	5d                   	pop    %ebp
+  8033e8:	c3                   	ret
+
+008033e9 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033e9:	55                   	push   %ebp
+  8033ea:	89 e5                	mov    %esp,%ebp
+  8033ec:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033ef:	ff 75 10             	push   0x10(%ebp)
+  8033f2:	ff 75 0c             	push   0xc(%ebp)
+  8033f5:	ff 75 08             	push   0x8(%ebp)
+  8033f8:	e8 8a ff ff ff       	call   803387 <memmove>
+}
+  8033fd:	c9                   	leave
+  8033fe:	c3                   	ret
+
+008033ff <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033ff:	55                   	push   %ebp
+  803400:	89 e5                	mov    %esp,%ebp
+  803402:	56                   	push   %esi
+  803403:	53                   	push   %ebx
+  803404:	8b 45 08             	mov    0x8(%ebp),%eax
+  803407:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80340a:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80340d:	85 f6                	test   %esi,%esi
+  80340f:	74 29                	je     80343a <memcmp+0x3b>
+  803411:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  803413:	0f b6 08             	movzbl (%eax),%ecx
+  803416:	0f b6 1a             	movzbl (%edx),%ebx
+  803419:	38 d9                	cmp    %bl,%cl
+  80341b:	75 11                	jne    80342e <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80341d:	83 c0 01             	add    $0x1,%eax
+  803420:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803423:	39 c6                	cmp    %eax,%esi
+  803425:	75 ec                	jne    803413 <memcmp+0x14>
+	}
+
+	return 0;
+  803427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342c:	eb 08                	jmp    803436 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  80342e:	0f b6 c1             	movzbl %cl,%eax
+  803431:	0f b6 db             	movzbl %bl,%ebx
+  803434:	29 d8                	sub    %ebx,%eax
+}
+  803436:	5b                   	pop    %ebx
+  803437:	5e                   	pop    %esi
+  803438:	5d                   	pop    %ebp
+  803439:	c3                   	ret
+	return 0;
+  80343a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80343f:	eb f5                	jmp    803436 <memcmp+0x37>
+
+00803441 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803441:	55                   	push   %ebp
+  803442:	89 e5                	mov    %esp,%ebp
+  803444:	8b 45 08             	mov    0x8(%ebp),%eax
+  803447:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80344a:	89 c2                	mov    %eax,%edx
+  80344c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80344f:	39 d0                	cmp    %edx,%eax
+  803451:	73 0d                	jae    803460 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803453:	38 08                	cmp    %cl,(%eax)
+  803455:	74 0d                	je     803464 <memfind+0x23>
+	for (; s < ends; s++)
+  803457:	83 c0 01             	add    $0x1,%eax
+  80345a:	39 c2                	cmp    %eax,%edx
+  80345c:	75 f5                	jne    803453 <memfind+0x12>
+  80345e:	eb 06                	jmp    803466 <memfind+0x25>
+  803460:	89 c2                	mov    %eax,%edx
+  803462:	eb 02                	jmp    803466 <memfind+0x25>
+  803464:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  803466:	89 d0                	mov    %edx,%eax
+  803468:	5d                   	pop    %ebp
+  803469:	c3                   	ret
+
+0080346a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80346a:	55                   	push   %ebp
+  80346b:	89 e5                	mov    %esp,%ebp
+  80346d:	57                   	push   %edi
+  80346e:	56                   	push   %esi
+  80346f:	53                   	push   %ebx
+  803470:	8b 55 08             	mov    0x8(%ebp),%edx
+  803473:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803476:	0f b6 02             	movzbl (%edx),%eax
+  803479:	3c 20                	cmp    $0x20,%al
+  80347b:	74 04                	je     803481 <strtol+0x17>
+  80347d:	3c 09                	cmp    $0x9,%al
+  80347f:	75 0e                	jne    80348f <strtol+0x25>
+		s++;
+  803481:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803484:	0f b6 02             	movzbl (%edx),%eax
+  803487:	3c 20                	cmp    $0x20,%al
+  803489:	74 f6                	je     803481 <strtol+0x17>
+  80348b:	3c 09                	cmp    $0x9,%al
+  80348d:	74 f2                	je     803481 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  80348f:	3c 2b                	cmp    $0x2b,%al
+  803491:	74 2a                	je     8034bd <strtol+0x53>
+	int neg = 0;
+  803493:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803498:	3c 2d                	cmp    $0x2d,%al
+  80349a:	74 2b                	je     8034c7 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80349c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8034a2:	75 0f                	jne    8034b3 <strtol+0x49>
+  8034a4:	80 3a 30             	cmpb   $0x30,(%edx)
+  8034a7:	74 28                	je     8034d1 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8034a9:	85 db                	test   %ebx,%ebx
+  8034ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8034b0:	0f 44 d8             	cmove  %eax,%ebx
+  8034b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034b8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8034bb:	eb 46                	jmp    803503 <strtol+0x99>
+		s++;
+  8034bd:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8034c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c5:	eb d5                	jmp    80349c <strtol+0x32>
+		s++, neg = 1;
+  8034c7:	83 c2 01             	add    $0x1,%edx
+  8034ca:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034cf:	eb cb                	jmp    80349c <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034d1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034d5:	74 0e                	je     8034e5 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034d7:	85 db                	test   %ebx,%ebx
+  8034d9:	75 d8                	jne    8034b3 <strtol+0x49>
+		s++, base = 8;
+  8034db:	83 c2 01             	add    $0x1,%edx
+  8034de:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034e3:	eb ce                	jmp    8034b3 <strtol+0x49>
+		s += 2, base = 16;
+  8034e5:	83 c2 02             	add    $0x2,%edx
+  8034e8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034ed:	eb c4                	jmp    8034b3 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034ef:	0f be c0             	movsbl %al,%eax
+  8034f2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034f5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034f8:	7d 3a                	jge    803534 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034fa:	83 c2 01             	add    $0x1,%edx
+  8034fd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803501:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803503:	0f b6 02             	movzbl (%edx),%eax
+  803506:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803509:	89 f3                	mov    %esi,%ebx
+  80350b:	80 fb 09             	cmp    $0x9,%bl
+  80350e:	76 df                	jbe    8034ef <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  803510:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803513:	89 f3                	mov    %esi,%ebx
+  803515:	80 fb 19             	cmp    $0x19,%bl
+  803518:	77 08                	ja     803522 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  80351a:	0f be c0             	movsbl %al,%eax
+  80351d:	83 e8 57             	sub    $0x57,%eax
+  803520:	eb d3                	jmp    8034f5 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  803522:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803525:	89 f3                	mov    %esi,%ebx
+  803527:	80 fb 19             	cmp    $0x19,%bl
+  80352a:	77 08                	ja     803534 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  80352c:	0f be c0             	movsbl %al,%eax
+  80352f:	83 e8 37             	sub    $0x37,%eax
+  803532:	eb c1                	jmp    8034f5 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803534:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803538:	74 05                	je     80353f <strtol+0xd5>
+		*endptr = (char *) s;
+  80353a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80353d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80353f:	89 c8                	mov    %ecx,%eax
+  803541:	f7 d8                	neg    %eax
+  803543:	85 ff                	test   %edi,%edi
+  803545:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803548:	89 c8                	mov    %ecx,%eax
+  80354a:	5b                   	pop    %ebx
+  80354b:	5e                   	pop    %esi
+  80354c:	5f                   	pop    %edi
+  80354d:	5d                   	pop    %ebp
+  80354e:	c3                   	ret
+
+0080354f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80354f:	55                   	push   %ebp
+  803550:	89 e5                	mov    %esp,%ebp
+  803552:	56                   	push   %esi
+  803553:	53                   	push   %ebx
+  803554:	8b 75 08             	mov    0x8(%ebp),%esi
+  803557:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80355a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80355d:	85 c0                	test   %eax,%eax
+  80355f:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803564:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803567:	83 ec 0c             	sub    $0xc,%esp
+  80356a:	50                   	push   %eax
+  80356b:	e8 0a ce ff ff       	call   80037a <sys_ipc_recv>
+  803570:	83 c4 10             	add    $0x10,%esp
+  803573:	85 c0                	test   %eax,%eax
+  803575:	0f 88 8b 00 00 00    	js     803606 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80357b:	85 f6                	test   %esi,%esi
+  80357d:	74 2a                	je     8035a9 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80357f:	89 e2                	mov    %esp,%edx
+  803581:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803586:	29 d0                	sub    %edx,%eax
+  803588:	89 c2                	mov    %eax,%edx
+  80358a:	c1 ea 0f             	shr    $0xf,%edx
+  80358d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803592:	b8 00 00 00 00       	mov    $0x0,%eax
+  803597:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80359a:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035a1:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8035a7:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8035a9:	85 db                	test   %ebx,%ebx
+  8035ab:	74 2a                	je     8035d7 <ipc_recv+0x88>
+  8035ad:	89 e2                	mov    %esp,%edx
+  8035af:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035b4:	29 d0                	sub    %edx,%eax
+  8035b6:	89 c2                	mov    %eax,%edx
+  8035b8:	c1 ea 0f             	shr    $0xf,%edx
+  8035bb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c5:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035c8:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035cf:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035d5:	89 03                	mov    %eax,(%ebx)
+  8035d7:	89 e2                	mov    %esp,%edx
+  8035d9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035de:	29 d0                	sub    %edx,%eax
+  8035e0:	89 c2                	mov    %eax,%edx
+  8035e2:	c1 ea 0f             	shr    $0xf,%edx
+  8035e5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ef:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035f2:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035f9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803602:	5b                   	pop    %ebx
+  803603:	5e                   	pop    %esi
+  803604:	5d                   	pop    %ebp
+  803605:	c3                   	ret
+		if(from_env_store != NULL)
+  803606:	85 f6                	test   %esi,%esi
+  803608:	74 06                	je     803610 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80360a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803610:	85 db                	test   %ebx,%ebx
+  803612:	74 eb                	je     8035ff <ipc_recv+0xb0>
+			*perm_store = 0;
+  803614:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80361a:	eb e3                	jmp    8035ff <ipc_recv+0xb0>
+
+0080361c <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80361c:	55                   	push   %ebp
+  80361d:	89 e5                	mov    %esp,%ebp
+  80361f:	57                   	push   %edi
+  803620:	56                   	push   %esi
+  803621:	53                   	push   %ebx
+  803622:	83 ec 14             	sub    $0x14,%esp
+  803625:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803628:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80362b:	8b 75 14             	mov    0x14(%ebp),%esi
+  80362e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803631:	85 c0                	test   %eax,%eax
+  803633:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803638:	0f 44 c2             	cmove  %edx,%eax
+  80363b:	ff 75 10             	push   0x10(%ebp)
+  80363e:	50                   	push   %eax
+  80363f:	e8 98 cd ff ff       	call   8003dc <sys_ipc_recv_pages>
+  803644:	83 c4 10             	add    $0x10,%esp
+  803647:	85 c0                	test   %eax,%eax
+  803649:	0f 88 ba 00 00 00    	js     803709 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80364f:	85 ff                	test   %edi,%edi
+  803651:	74 2a                	je     80367d <ipc_recv_pages+0x61>
+  803653:	89 e2                	mov    %esp,%edx
+  803655:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80365a:	29 d0                	sub    %edx,%eax
+  80365c:	89 c2                	mov    %eax,%edx
+  80365e:	c1 ea 0f             	shr    $0xf,%edx
+  803661:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80366e:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803675:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80367b:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80367d:	85 f6                	test   %esi,%esi
+  80367f:	74 2a                	je     8036ab <ipc_recv_pages+0x8f>
+  803681:	89 e2                	mov    %esp,%edx
+  803683:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803688:	29 d0                	sub    %edx,%eax
+  80368a:	89 c2                	mov    %eax,%edx
+  80368c:	c1 ea 0f             	shr    $0xf,%edx
+  80368f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803694:	b8 00 00 00 00       	mov    $0x0,%eax
+  803699:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80369c:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036a3:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8036a9:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8036ab:	85 db                	test   %ebx,%ebx
+  8036ad:	74 2a                	je     8036d9 <ipc_recv_pages+0xbd>
+  8036af:	89 e2                	mov    %esp,%edx
+  8036b1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036b6:	29 d0                	sub    %edx,%eax
+  8036b8:	89 c2                	mov    %eax,%edx
+  8036ba:	c1 ea 0f             	shr    $0xf,%edx
+  8036bd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c7:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036ca:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036d1:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036d7:	89 03                	mov    %eax,(%ebx)
+  8036d9:	89 e2                	mov    %esp,%edx
+  8036db:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036e0:	29 d0                	sub    %edx,%eax
+  8036e2:	89 c2                	mov    %eax,%edx
+  8036e4:	c1 ea 0f             	shr    $0xf,%edx
+  8036e7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f1:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036f4:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036fb:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803701:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803704:	5b                   	pop    %ebx
+  803705:	5e                   	pop    %esi
+  803706:	5f                   	pop    %edi
+  803707:	5d                   	pop    %ebp
+  803708:	c3                   	ret
+		if (from_env_store)
+  803709:	85 ff                	test   %edi,%edi
+  80370b:	74 06                	je     803713 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80370d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803713:	85 f6                	test   %esi,%esi
+  803715:	74 06                	je     80371d <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803717:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80371d:	85 db                	test   %ebx,%ebx
+  80371f:	74 e0                	je     803701 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803721:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803727:	eb d8                	jmp    803701 <ipc_recv_pages+0xe5>
+
+00803729 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803729:	55                   	push   %ebp
+  80372a:	89 e5                	mov    %esp,%ebp
+  80372c:	57                   	push   %edi
+  80372d:	56                   	push   %esi
+  80372e:	53                   	push   %ebx
+  80372f:	83 ec 1c             	sub    $0x1c,%esp
+  803732:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803735:	8b 75 08             	mov    0x8(%ebp),%esi
+  803738:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80373e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803742:	75 2b                	jne    80376f <ipc_try_send_pages+0x46>
+  803744:	89 e2                	mov    %esp,%edx
+  803746:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80374b:	29 d0                	sub    %edx,%eax
+  80374d:	89 c2                	mov    %eax,%edx
+  80374f:	c1 ea 0f             	shr    $0xf,%edx
+  803752:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375c:	0f 42 c2             	cmovb  %edx,%eax
+  80375f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803766:	8b 70 48             	mov    0x48(%eax),%esi
+  803769:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80376f:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803775:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80377a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80377d:	85 ff                	test   %edi,%edi
+  80377f:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803784:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803787:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80378d:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803793:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803799:	83 ec 0c             	sub    $0xc,%esp
+  80379c:	ff 75 14             	push   0x14(%ebp)
+  80379f:	ff 75 18             	push   0x18(%ebp)
+  8037a2:	57                   	push   %edi
+  8037a3:	ff 75 0c             	push   0xc(%ebp)
+  8037a6:	ff 75 08             	push   0x8(%ebp)
+  8037a9:	e8 0d cc ff ff       	call   8003bb <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8037ae:	83 c4 20             	add    $0x20,%esp
+  8037b1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037b4:	75 21                	jne    8037d7 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8037b6:	83 ec 04             	sub    $0x4,%esp
+  8037b9:	6a ff                	push   $0xffffffff
+  8037bb:	53                   	push   %ebx
+  8037bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8037bf:	e8 04 ce ff ff       	call   8005c8 <sys_futex_wait>
+  8037c4:	83 c4 10             	add    $0x10,%esp
+  8037c7:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037ca:	74 c7                	je     803793 <ipc_try_send_pages+0x6a>
+  8037cc:	85 c0                	test   %eax,%eax
+  8037ce:	79 c3                	jns    803793 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037d0:	e8 d6 c9 ff ff       	call   8001ab <sys_yield>
+  8037d5:	eb bc                	jmp    803793 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037da:	5b                   	pop    %ebx
+  8037db:	5e                   	pop    %esi
+  8037dc:	5f                   	pop    %edi
+  8037dd:	5d                   	pop    %ebp
+  8037de:	c3                   	ret
+
+008037df <ipc_send>:
+{
+  8037df:	55                   	push   %ebp
+  8037e0:	89 e5                	mov    %esp,%ebp
+  8037e2:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037e5:	ff 75 14             	push   0x14(%ebp)
+  8037e8:	6a 01                	push   $0x1
+  8037ea:	ff 75 10             	push   0x10(%ebp)
+  8037ed:	ff 75 0c             	push   0xc(%ebp)
+  8037f0:	ff 75 08             	push   0x8(%ebp)
+  8037f3:	e8 31 ff ff ff       	call   803729 <ipc_try_send_pages>
+  8037f8:	83 c4 20             	add    $0x20,%esp
+  8037fb:	85 c0                	test   %eax,%eax
+  8037fd:	78 02                	js     803801 <ipc_send+0x22>
+}
+  8037ff:	c9                   	leave
+  803800:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803801:	50                   	push   %eax
+  803802:	68 4b 3f 80 00       	push   $0x803f4b
+  803807:	6a 3f                	push   $0x3f
+  803809:	68 60 3f 80 00       	push   $0x803f60
+  80380e:	e8 f2 f1 ff ff       	call   802a05 <_panic>
+
+00803813 <ipc_send_pages>:
+{
+  803813:	55                   	push   %ebp
+  803814:	89 e5                	mov    %esp,%ebp
+  803816:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803819:	ff 75 18             	push   0x18(%ebp)
+  80381c:	ff 75 14             	push   0x14(%ebp)
+  80381f:	ff 75 10             	push   0x10(%ebp)
+  803822:	ff 75 0c             	push   0xc(%ebp)
+  803825:	ff 75 08             	push   0x8(%ebp)
+  803828:	e8 fc fe ff ff       	call   803729 <ipc_try_send_pages>
+  80382d:	83 c4 20             	add    $0x20,%esp
+  803830:	85 c0                	test   %eax,%eax
+  803832:	78 02                	js     803836 <ipc_send_pages+0x23>
+}
+  803834:	c9                   	leave
+  803835:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803836:	50                   	push   %eax
+  803837:	68 6a 3f 80 00       	push   $0x803f6a
+  80383c:	6a 64                	push   $0x64
+  80383e:	68 60 3f 80 00       	push   $0x803f60
+  803843:	e8 bd f1 ff ff       	call   802a05 <_panic>
+
+00803848 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803848:	55                   	push   %ebp
+  803849:	89 e5                	mov    %esp,%ebp
+  80384b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80384e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803853:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803859:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80385f:	8b 52 50             	mov    0x50(%edx),%edx
+  803862:	39 ca                	cmp    %ecx,%edx
+  803864:	74 11                	je     803877 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803866:	83 c0 01             	add    $0x1,%eax
+  803869:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80386e:	75 e3                	jne    803853 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803870:	b8 00 00 00 00       	mov    $0x0,%eax
+  803875:	eb 0e                	jmp    803885 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803877:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80387d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803882:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803885:	5d                   	pop    %ebp
+  803886:	c3                   	ret
+
+00803887 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803887:	55                   	push   %ebp
+  803888:	89 e5                	mov    %esp,%ebp
+  80388a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80388d:	89 c2                	mov    %eax,%edx
+  80388f:	c1 ea 16             	shr    $0x16,%edx
+  803892:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803899:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80389e:	f6 c1 01             	test   $0x1,%cl
+  8038a1:	74 1e                	je     8038c1 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8038a3:	c1 e8 0c             	shr    $0xc,%eax
+  8038a6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8038ad:	a8 01                	test   $0x1,%al
+  8038af:	74 10                	je     8038c1 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8038b1:	c1 e8 0c             	shr    $0xc,%eax
+  8038b4:	c1 e0 04             	shl    $0x4,%eax
+  8038b7:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8038be:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038c1:	89 d0                	mov    %edx,%eax
+  8038c3:	5d                   	pop    %ebp
+  8038c4:	c3                   	ret
+
+008038c5 <__udivdi3>:
+  8038c5:	57                   	push   %edi
+  8038c6:	56                   	push   %esi
+  8038c7:	53                   	push   %ebx
+  8038c8:	83 ec 20             	sub    $0x20,%esp
+  8038cb:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038cf:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038d3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038d7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038db:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038e3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038e7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038eb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038fa:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803901:	00 
+  803902:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803909:	00 
+  80390a:	eb 08                	jmp    803914 <__udivdi3+0x4f>
+  80390c:	83 e9 01             	sub    $0x1,%ecx
+  80390f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803912:	74 68                	je     80397c <__udivdi3+0xb7>
+  803914:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803918:	01 c0                	add    %eax,%eax
+  80391a:	89 c6                	mov    %eax,%esi
+  80391c:	89 d7                	mov    %edx,%edi
+  80391e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803922:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803926:	0f ad d0             	shrd   %cl,%edx,%eax
+  803929:	d3 ea                	shr    %cl,%edx
+  80392b:	f6 c1 20             	test   $0x20,%cl
+  80392e:	74 04                	je     803934 <__udivdi3+0x6f>
+  803930:	89 d0                	mov    %edx,%eax
+  803932:	31 d2                	xor    %edx,%edx
+  803934:	83 e0 01             	and    $0x1,%eax
+  803937:	89 04 24             	mov    %eax,(%esp)
+  80393a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803941:	00 
+  803942:	8b 04 24             	mov    (%esp),%eax
+  803945:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803949:	09 f0                	or     %esi,%eax
+  80394b:	09 fa                	or     %edi,%edx
+  80394d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803951:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803955:	39 f0                	cmp    %esi,%eax
+  803957:	89 d3                	mov    %edx,%ebx
+  803959:	19 fb                	sbb    %edi,%ebx
+  80395b:	72 af                	jb     80390c <__udivdi3+0x47>
+  80395d:	29 f0                	sub    %esi,%eax
+  80395f:	19 fa                	sbb    %edi,%edx
+  803961:	89 cf                	mov    %ecx,%edi
+  803963:	c1 ef 05             	shr    $0x5,%edi
+  803966:	83 e7 01             	and    $0x1,%edi
+  803969:	89 fe                	mov    %edi,%esi
+  80396b:	83 f6 01             	xor    $0x1,%esi
+  80396e:	d3 e6                	shl    %cl,%esi
+  803970:	d3 e7                	shl    %cl,%edi
+  803972:	09 74 24 18          	or     %esi,0x18(%esp)
+  803976:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80397a:	eb 90                	jmp    80390c <__udivdi3+0x47>
+  80397c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803980:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803984:	83 c4 20             	add    $0x20,%esp
+  803987:	5b                   	pop    %ebx
+  803988:	5e                   	pop    %esi
+  803989:	5f                   	pop    %edi
+  80398a:	c3                   	ret
+
+0080398b <__umoddi3>:
+  80398b:	57                   	push   %edi
+  80398c:	56                   	push   %esi
+  80398d:	53                   	push   %ebx
+  80398e:	83 ec 08             	sub    $0x8,%esp
+  803991:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803995:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803999:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80399d:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8039a1:	57                   	push   %edi
+  8039a2:	56                   	push   %esi
+  8039a3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039a7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039ab:	52                   	push   %edx
+  8039ac:	50                   	push   %eax
+  8039ad:	e8 13 ff ff ff       	call   8038c5 <__udivdi3>
+  8039b2:	89 c3                	mov    %eax,%ebx
+  8039b4:	0f af d6             	imul   %esi,%edx
+  8039b7:	89 f9                	mov    %edi,%ecx
+  8039b9:	0f af cb             	imul   %ebx,%ecx
+  8039bc:	01 d1                	add    %edx,%ecx
+  8039be:	89 d8                	mov    %ebx,%eax
+  8039c0:	f7 e6                	mul    %esi
+  8039c2:	89 c6                	mov    %eax,%esi
+  8039c4:	89 d7                	mov    %edx,%edi
+  8039c6:	01 cf                	add    %ecx,%edi
+  8039c8:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039cc:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039d0:	29 f0                	sub    %esi,%eax
+  8039d2:	19 fa                	sbb    %edi,%edx
+  8039d4:	83 c4 18             	add    $0x18,%esp
+  8039d7:	5b                   	pop    %ebx
+  8039d8:	5e                   	pop    %esi
+  8039d9:	5f                   	pop    %edi
+  8039da:	c3                   	ret
+
+008039db <__divdi3>:
+  8039db:	53                   	push   %ebx
+  8039dc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039e0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039e4:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039e8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039ec:	85 d2                	test   %edx,%edx
+  8039ee:	78 12                	js     803a02 <__divdi3+0x27>
+  8039f0:	85 db                	test   %ebx,%ebx
+  8039f2:	78 2e                	js     803a22 <__divdi3+0x47>
+  8039f4:	53                   	push   %ebx
+  8039f5:	51                   	push   %ecx
+  8039f6:	52                   	push   %edx
+  8039f7:	50                   	push   %eax
+  8039f8:	e8 c8 fe ff ff       	call   8038c5 <__udivdi3>
+  8039fd:	83 c4 10             	add    $0x10,%esp
+  803a00:	eb 1e                	jmp    803a20 <__divdi3+0x45>
+  803a02:	f7 d8                	neg    %eax
+  803a04:	83 d2 00             	adc    $0x0,%edx
+  803a07:	f7 da                	neg    %edx
+  803a09:	85 db                	test   %ebx,%ebx
+  803a0b:	78 2a                	js     803a37 <__divdi3+0x5c>
+  803a0d:	53                   	push   %ebx
+  803a0e:	51                   	push   %ecx
+  803a0f:	52                   	push   %edx
+  803a10:	50                   	push   %eax
+  803a11:	e8 af fe ff ff       	call   8038c5 <__udivdi3>
+  803a16:	83 c4 10             	add    $0x10,%esp
+  803a19:	f7 d8                	neg    %eax
+  803a1b:	83 d2 00             	adc    $0x0,%edx
+  803a1e:	f7 da                	neg    %edx
+  803a20:	5b                   	pop    %ebx
+  803a21:	c3                   	ret
+  803a22:	f7 d9                	neg    %ecx
+  803a24:	83 d3 00             	adc    $0x0,%ebx
+  803a27:	f7 db                	neg    %ebx
+  803a29:	53                   	push   %ebx
+  803a2a:	51                   	push   %ecx
+  803a2b:	52                   	push   %edx
+  803a2c:	50                   	push   %eax
+  803a2d:	e8 93 fe ff ff       	call   8038c5 <__udivdi3>
+  803a32:	83 c4 10             	add    $0x10,%esp
+  803a35:	eb e2                	jmp    803a19 <__divdi3+0x3e>
+  803a37:	f7 d9                	neg    %ecx
+  803a39:	83 d3 00             	adc    $0x0,%ebx
+  803a3c:	f7 db                	neg    %ebx
+  803a3e:	53                   	push   %ebx
+  803a3f:	51                   	push   %ecx
+  803a40:	52                   	push   %edx
+  803a41:	50                   	push   %eax
+  803a42:	e8 7e fe ff ff       	call   8038c5 <__udivdi3>
+  803a47:	83 c4 10             	add    $0x10,%esp
+  803a4a:	eb d4                	jmp    803a20 <__divdi3+0x45>
+
+00803a4c <__moddi3>:
+  803a4c:	57                   	push   %edi
+  803a4d:	56                   	push   %esi
+  803a4e:	53                   	push   %ebx
+  803a4f:	83 ec 08             	sub    $0x8,%esp
+  803a52:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a56:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a5a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a5e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a62:	57                   	push   %edi
+  803a63:	56                   	push   %esi
+  803a64:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a68:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a6c:	52                   	push   %edx
+  803a6d:	50                   	push   %eax
+  803a6e:	e8 68 ff ff ff       	call   8039db <__divdi3>
+  803a73:	89 c3                	mov    %eax,%ebx
+  803a75:	0f af d6             	imul   %esi,%edx
+  803a78:	89 f9                	mov    %edi,%ecx
+  803a7a:	0f af cb             	imul   %ebx,%ecx
+  803a7d:	01 d1                	add    %edx,%ecx
+  803a7f:	89 d8                	mov    %ebx,%eax
+  803a81:	f7 e6                	mul    %esi
+  803a83:	89 c6                	mov    %eax,%esi
+  803a85:	89 d7                	mov    %edx,%edi
+  803a87:	01 cf                	add    %ecx,%edi
+  803a89:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a8d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a91:	29 f0                	sub    %esi,%eax
+  803a93:	19 fa                	sbb    %edi,%edx
+  803a95:	83 c4 18             	add    $0x18,%esp
+  803a98:	5b                   	pop    %ebx
+  803a99:	5e                   	pop    %esi
+  803a9a:	5f                   	pop    %edi
+  803a9b:	c3                   	ret
@@ -0,0 +1,7985 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 51 00 00 00       	call   800082 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 0c             	sub    $0xc,%esp
+  80003b:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003e:	8b 42 04             	mov    0x4(%edx),%eax
+  800041:	83 e0 07             	and    $0x7,%eax
+  800044:	50                   	push   %eax
+  800045:	ff 32                	push   (%edx)
+  800047:	68 20 3b 80 00       	push   $0x803b20
+  80004c:	e8 6d 01 00 00       	call   8001be <cprintf>
+	sys_env_destroy(sys_getenvid());
+  800051:	e8 55 0c 00 00       	call   800cab <sys_getenvid>
+  800056:	89 04 24             	mov    %eax,(%esp)
+  800059:	e8 0c 0c 00 00       	call   800c6a <sys_env_destroy>
+}
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	c9                   	leave
+  800062:	c3                   	ret
+
+00800063 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800063:	55                   	push   %ebp
+  800064:	89 e5                	mov    %esp,%ebp
+  800066:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800069:	68 35 00 80 00       	push   $0x800035
+  80006e:	e8 d9 10 00 00       	call   80114c <set_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800073:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  80007a:	00 00 00 
+}
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	c9                   	leave
+  800081:	c3                   	ret
+
+00800082 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800082:	55                   	push   %ebp
+  800083:	89 e5                	mov    %esp,%ebp
+  800085:	56                   	push   %esi
+  800086:	53                   	push   %ebx
+  800087:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80008a:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80008d:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80008f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800094:	29 d0                	sub    %edx,%eax
+  800096:	89 c2                	mov    %eax,%edx
+  800098:	c1 ea 0f             	shr    $0xf,%edx
+  80009b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8000a8:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  8000af:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8000b3:	e8 f3 0b 00 00       	call   800cab <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8000b8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000bd:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8000c3:	89 e1                	mov    %esp,%ecx
+  8000c5:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8000ca:	29 ca                	sub    %ecx,%edx
+  8000cc:	89 d1                	mov    %edx,%ecx
+  8000ce:	c1 e9 0f             	shr    $0xf,%ecx
+  8000d1:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000dc:	0f 42 d1             	cmovb  %ecx,%edx
+  8000df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e4:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000eb:	85 db                	test   %ebx,%ebx
+  8000ed:	7e 07                	jle    8000f6 <libmain+0x74>
+		binaryname = argv[0];
+  8000ef:	8b 06                	mov    (%esi),%eax
+  8000f1:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000f6:	83 ec 08             	sub    $0x8,%esp
+  8000f9:	56                   	push   %esi
+  8000fa:	53                   	push   %ebx
+  8000fb:	e8 63 ff ff ff       	call   800063 <umain>
+
+	// exit gracefully
+	exit();
+  800100:	e8 0a 00 00 00       	call   80010f <exit>
+}
+  800105:	83 c4 10             	add    $0x10,%esp
+  800108:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010b:	5b                   	pop    %ebx
+  80010c:	5e                   	pop    %esi
+  80010d:	5d                   	pop    %ebp
+  80010e:	c3                   	ret
+
+0080010f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80010f:	55                   	push   %ebp
+  800110:	89 e5                	mov    %esp,%ebp
+  800112:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800115:	e8 7f 12 00 00       	call   801399 <close_all>
+	sys_env_destroy(0);
+  80011a:	83 ec 0c             	sub    $0xc,%esp
+  80011d:	6a 00                	push   $0x0
+  80011f:	e8 46 0b 00 00       	call   800c6a <sys_env_destroy>
+}
+  800124:	83 c4 10             	add    $0x10,%esp
+  800127:	c9                   	leave
+  800128:	c3                   	ret
+
+00800129 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800129:	55                   	push   %ebp
+  80012a:	89 e5                	mov    %esp,%ebp
+  80012c:	53                   	push   %ebx
+  80012d:	83 ec 04             	sub    $0x4,%esp
+  800130:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800133:	8b 13                	mov    (%ebx),%edx
+  800135:	8d 42 01             	lea    0x1(%edx),%eax
+  800138:	89 03                	mov    %eax,(%ebx)
+  80013a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80013d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800141:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800146:	74 09                	je     800151 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800148:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80014c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80014f:	c9                   	leave
+  800150:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800151:	83 ec 08             	sub    $0x8,%esp
+  800154:	68 ff 00 00 00       	push   $0xff
+  800159:	8d 43 08             	lea    0x8(%ebx),%eax
+  80015c:	50                   	push   %eax
+  80015d:	e8 cb 0a 00 00       	call   800c2d <sys_cputs>
+		b->idx = 0;
+  800162:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	eb db                	jmp    800148 <putch+0x1f>
+
+0080016d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800176:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80017d:	00 00 00 
+	b.cnt = 0;
+  800180:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800187:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80018a:	ff 75 0c             	push   0xc(%ebp)
+  80018d:	ff 75 08             	push   0x8(%ebp)
+  800190:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800196:	50                   	push   %eax
+  800197:	68 29 01 80 00       	push   $0x800129
+  80019c:	e8 1c 01 00 00       	call   8002bd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001a1:	83 c4 08             	add    $0x8,%esp
+  8001a4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001aa:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001b0:	50                   	push   %eax
+  8001b1:	e8 77 0a 00 00       	call   800c2d <sys_cputs>
+
+	return b.cnt;
+}
+  8001b6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+
+008001be <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001be:	55                   	push   %ebp
+  8001bf:	89 e5                	mov    %esp,%ebp
+  8001c1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001c4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c7:	50                   	push   %eax
+  8001c8:	ff 75 08             	push   0x8(%ebp)
+  8001cb:	e8 9d ff ff ff       	call   80016d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001d0:	c9                   	leave
+  8001d1:	c3                   	ret
+
+008001d2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001d2:	55                   	push   %ebp
+  8001d3:	89 e5                	mov    %esp,%ebp
+  8001d5:	57                   	push   %edi
+  8001d6:	56                   	push   %esi
+  8001d7:	53                   	push   %ebx
+  8001d8:	83 ec 1c             	sub    $0x1c,%esp
+  8001db:	89 c3                	mov    %eax,%ebx
+  8001dd:	89 d6                	mov    %edx,%esi
+  8001df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001e5:	89 d1                	mov    %edx,%ecx
+  8001e7:	89 c2                	mov    %eax,%edx
+  8001e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001ec:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ef:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001fc:	39 c2                	cmp    %eax,%edx
+  8001fe:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800201:	73 4b                	jae    80024e <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800203:	8b 45 14             	mov    0x14(%ebp),%eax
+  800206:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800209:	85 ff                	test   %edi,%edi
+  80020b:	7e 11                	jle    80021e <printnum+0x4c>
+			putch(padc, putdat);
+  80020d:	83 ec 08             	sub    $0x8,%esp
+  800210:	56                   	push   %esi
+  800211:	ff 75 18             	push   0x18(%ebp)
+  800214:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800216:	83 c4 10             	add    $0x10,%esp
+  800219:	83 ef 01             	sub    $0x1,%edi
+  80021c:	75 ef                	jne    80020d <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80021e:	83 ec 08             	sub    $0x8,%esp
+  800221:	56                   	push   %esi
+  800222:	83 ec 04             	sub    $0x4,%esp
+  800225:	ff 75 e4             	push   -0x1c(%ebp)
+  800228:	ff 75 e0             	push   -0x20(%ebp)
+  80022b:	ff 75 dc             	push   -0x24(%ebp)
+  80022e:	ff 75 d8             	push   -0x28(%ebp)
+  800231:	e8 d4 37 00 00       	call   803a0a <__umoddi3>
+  800236:	83 c4 14             	add    $0x14,%esp
+  800239:	0f be 80 46 3b 80 00 	movsbl 0x803b46(%eax),%eax
+  800240:	50                   	push   %eax
+  800241:	ff d3                	call   *%ebx
+}
+  800243:	83 c4 10             	add    $0x10,%esp
+  800246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800249:	5b                   	pop    %ebx
+  80024a:	5e                   	pop    %esi
+  80024b:	5f                   	pop    %edi
+  80024c:	5d                   	pop    %ebp
+  80024d:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80024e:	83 ec 0c             	sub    $0xc,%esp
+  800251:	ff 75 18             	push   0x18(%ebp)
+  800254:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800257:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80025a:	52                   	push   %edx
+  80025b:	50                   	push   %eax
+  80025c:	83 ec 08             	sub    $0x8,%esp
+  80025f:	ff 75 e4             	push   -0x1c(%ebp)
+  800262:	ff 75 e0             	push   -0x20(%ebp)
+  800265:	ff 75 dc             	push   -0x24(%ebp)
+  800268:	ff 75 d8             	push   -0x28(%ebp)
+  80026b:	e8 d4 36 00 00       	call   803944 <__udivdi3>
+  800270:	83 c4 18             	add    $0x18,%esp
+  800273:	52                   	push   %edx
+  800274:	50                   	push   %eax
+  800275:	89 f2                	mov    %esi,%edx
+  800277:	89 d8                	mov    %ebx,%eax
+  800279:	e8 54 ff ff ff       	call   8001d2 <printnum>
+  80027e:	83 c4 20             	add    $0x20,%esp
+  800281:	eb 9b                	jmp    80021e <printnum+0x4c>
+
+00800283 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800283:	55                   	push   %ebp
+  800284:	89 e5                	mov    %esp,%ebp
+  800286:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800289:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80028d:	8b 10                	mov    (%eax),%edx
+  80028f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800292:	73 0a                	jae    80029e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800294:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800297:	89 08                	mov    %ecx,(%eax)
+  800299:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029c:	88 02                	mov    %al,(%edx)
+}
+  80029e:	5d                   	pop    %ebp
+  80029f:	c3                   	ret
+
+008002a0 <printfmt>:
+{
+  8002a0:	55                   	push   %ebp
+  8002a1:	89 e5                	mov    %esp,%ebp
+  8002a3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002a6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002a9:	50                   	push   %eax
+  8002aa:	ff 75 10             	push   0x10(%ebp)
+  8002ad:	ff 75 0c             	push   0xc(%ebp)
+  8002b0:	ff 75 08             	push   0x8(%ebp)
+  8002b3:	e8 05 00 00 00       	call   8002bd <vprintfmt>
+}
+  8002b8:	83 c4 10             	add    $0x10,%esp
+  8002bb:	c9                   	leave
+  8002bc:	c3                   	ret
+
+008002bd <vprintfmt>:
+{
+  8002bd:	55                   	push   %ebp
+  8002be:	89 e5                	mov    %esp,%ebp
+  8002c0:	57                   	push   %edi
+  8002c1:	56                   	push   %esi
+  8002c2:	53                   	push   %ebx
+  8002c3:	83 ec 2c             	sub    $0x2c,%esp
+  8002c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002c9:	89 df                	mov    %ebx,%edi
+  8002cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002d1:	8d 70 01             	lea    0x1(%eax),%esi
+  8002d4:	0f b6 00             	movzbl (%eax),%eax
+  8002d7:	83 f8 25             	cmp    $0x25,%eax
+  8002da:	74 1e                	je     8002fa <vprintfmt+0x3d>
+			if (ch == '\0')
+  8002dc:	85 c0                	test   %eax,%eax
+  8002de:	0f 84 15 05 00 00    	je     8007f9 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8002e4:	83 ec 08             	sub    $0x8,%esp
+  8002e7:	53                   	push   %ebx
+  8002e8:	50                   	push   %eax
+  8002e9:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002eb:	83 c6 01             	add    $0x1,%esi
+  8002ee:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	83 f8 25             	cmp    $0x25,%eax
+  8002f8:	75 e2                	jne    8002dc <vprintfmt+0x1f>
+		padc = ' ';
+  8002fa:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8002fe:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800305:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80030c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800313:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800318:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80031b:	8d 56 01             	lea    0x1(%esi),%edx
+  80031e:	0f b6 0e             	movzbl (%esi),%ecx
+  800321:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800324:	3c 55                	cmp    $0x55,%al
+  800326:	0f 87 3b 04 00 00    	ja     800767 <vprintfmt+0x4aa>
+  80032c:	0f b6 c0             	movzbl %al,%eax
+  80032f:	ff 24 85 c0 3c 80 00 	jmp    *0x803cc0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800336:	89 75 10             	mov    %esi,0x10(%ebp)
+  800339:	eb 93                	jmp    8002ce <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80033b:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80033d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800341:	eb d8                	jmp    80031b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800343:	89 d6                	mov    %edx,%esi
+  800345:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800349:	eb d0                	jmp    80031b <vprintfmt+0x5e>
+  80034b:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80034e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800351:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800354:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800358:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80035b:	83 f9 09             	cmp    $0x9,%ecx
+  80035e:	77 6f                	ja     8003cf <vprintfmt+0x112>
+  800360:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800363:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800366:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800369:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80036d:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800370:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800373:	83 fe 09             	cmp    $0x9,%esi
+  800376:	76 eb                	jbe    800363 <vprintfmt+0xa6>
+  800378:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80037b:	89 d6                	mov    %edx,%esi
+  80037d:	eb 13                	jmp    800392 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80037f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800382:	8b 00                	mov    (%eax),%eax
+  800384:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800387:	8b 45 14             	mov    0x14(%ebp),%eax
+  80038a:	8d 40 04             	lea    0x4(%eax),%eax
+  80038d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800390:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800392:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800396:	79 83                	jns    80031b <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800398:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80039b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80039e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003a5:	e9 71 ff ff ff       	jmp    80031b <vprintfmt+0x5e>
+			if (width < 0)
+  8003aa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ad:	85 c9                	test   %ecx,%ecx
+  8003af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b4:	0f 49 c1             	cmovns %ecx,%eax
+  8003b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ba:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003bc:	e9 5a ff ff ff       	jmp    80031b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c1:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8003c3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003ca:	e9 4c ff ff ff       	jmp    80031b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cf:	89 d6                	mov    %edx,%esi
+  8003d1:	eb bf                	jmp    800392 <vprintfmt+0xd5>
+			lflag++;
+  8003d3:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d7:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003d9:	e9 3d ff ff ff       	jmp    80031b <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8003de:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e4:	8d 70 04             	lea    0x4(%eax),%esi
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	53                   	push   %ebx
+  8003eb:	ff 30                	push   (%eax)
+  8003ed:	ff d7                	call   *%edi
+			break;
+  8003ef:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003f2:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8003f5:	e9 d4 fe ff ff       	jmp    8002ce <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8003fa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800400:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800403:	8b 10                	mov    (%eax),%edx
+  800405:	89 d0                	mov    %edx,%eax
+  800407:	f7 d8                	neg    %eax
+  800409:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80040c:	83 f8 12             	cmp    $0x12,%eax
+  80040f:	7f 23                	jg     800434 <vprintfmt+0x177>
+  800411:	8b 14 85 20 3e 80 00 	mov    0x803e20(,%eax,4),%edx
+  800418:	85 d2                	test   %edx,%edx
+  80041a:	74 18                	je     800434 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80041c:	52                   	push   %edx
+  80041d:	68 7b 3f 80 00       	push   $0x803f7b
+  800422:	53                   	push   %ebx
+  800423:	57                   	push   %edi
+  800424:	e8 77 fe ff ff       	call   8002a0 <printfmt>
+  800429:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80042c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80042f:	e9 9a fe ff ff       	jmp    8002ce <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800434:	50                   	push   %eax
+  800435:	68 5e 3b 80 00       	push   $0x803b5e
+  80043a:	53                   	push   %ebx
+  80043b:	57                   	push   %edi
+  80043c:	e8 5f fe ff ff       	call   8002a0 <printfmt>
+  800441:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800444:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800447:	e9 82 fe ff ff       	jmp    8002ce <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80044c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80044f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800452:	83 c0 04             	add    $0x4,%eax
+  800455:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800458:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045b:	8b 00                	mov    (%eax),%eax
+  80045d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800460:	85 c0                	test   %eax,%eax
+  800462:	0f 84 61 03 00 00    	je     8007c9 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800468:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80046c:	7e 06                	jle    800474 <vprintfmt+0x1b7>
+  80046e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800472:	75 29                	jne    80049d <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800474:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800477:	8d 70 01             	lea    0x1(%eax),%esi
+  80047a:	0f b6 00             	movzbl (%eax),%eax
+  80047d:	0f be d0             	movsbl %al,%edx
+  800480:	85 d2                	test   %edx,%edx
+  800482:	0f 84 bb 00 00 00    	je     800543 <vprintfmt+0x286>
+  800488:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80048b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80048e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800491:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800494:	eb 7a                	jmp    800510 <vprintfmt+0x253>
+				p = "(null)";
+  800496:	c7 45 d0 57 3b 80 00 	movl   $0x803b57,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	ff 75 d4             	push   -0x2c(%ebp)
+  8004a3:	ff 75 d0             	push   -0x30(%ebp)
+  8004a6:	e8 e0 03 00 00       	call   80088b <strnlen>
+  8004ab:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004ae:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  8004b4:	85 d2                	test   %edx,%edx
+  8004b6:	0f 8e d6 02 00 00    	jle    800792 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8004bc:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004c0:	83 ec 08             	sub    $0x8,%esp
+  8004c3:	53                   	push   %ebx
+  8004c4:	56                   	push   %esi
+  8004c5:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c7:	83 c4 10             	add    $0x10,%esp
+  8004ca:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004ce:	75 f0                	jne    8004c0 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004d3:	8d 70 01             	lea    0x1(%eax),%esi
+  8004d6:	0f b6 00             	movzbl (%eax),%eax
+  8004d9:	0f be d0             	movsbl %al,%edx
+  8004dc:	85 d2                	test   %edx,%edx
+  8004de:	0f 84 da 02 00 00    	je     8007be <vprintfmt+0x501>
+  8004e4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004e7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004ea:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004ed:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004f0:	eb 1e                	jmp    800510 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	ff 75 0c             	push   0xc(%ebp)
+  8004f8:	52                   	push   %edx
+  8004f9:	ff 55 08             	call   *0x8(%ebp)
+  8004fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ff:	83 eb 01             	sub    $0x1,%ebx
+  800502:	83 c6 01             	add    $0x1,%esi
+  800505:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800509:	0f be d0             	movsbl %al,%edx
+  80050c:	85 d2                	test   %edx,%edx
+  80050e:	74 2a                	je     80053a <vprintfmt+0x27d>
+  800510:	85 ff                	test   %edi,%edi
+  800512:	78 05                	js     800519 <vprintfmt+0x25c>
+  800514:	83 ef 01             	sub    $0x1,%edi
+  800517:	78 59                	js     800572 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800519:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051d:	74 d3                	je     8004f2 <vprintfmt+0x235>
+  80051f:	0f be c0             	movsbl %al,%eax
+  800522:	83 e8 20             	sub    $0x20,%eax
+  800525:	83 f8 5e             	cmp    $0x5e,%eax
+  800528:	76 c8                	jbe    8004f2 <vprintfmt+0x235>
+					putch('?', putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	ff 75 0c             	push   0xc(%ebp)
+  800530:	6a 3f                	push   $0x3f
+  800532:	ff 55 08             	call   *0x8(%ebp)
+  800535:	83 c4 10             	add    $0x10,%esp
+  800538:	eb c5                	jmp    8004ff <vprintfmt+0x242>
+  80053a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80053d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800540:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800543:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800546:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80054a:	7e 1b                	jle    800567 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80054c:	83 ec 08             	sub    $0x8,%esp
+  80054f:	53                   	push   %ebx
+  800550:	6a 20                	push   $0x20
+  800552:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800554:	83 c4 10             	add    $0x10,%esp
+  800557:	83 ee 01             	sub    $0x1,%esi
+  80055a:	75 f0                	jne    80054c <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80055c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800562:	e9 67 fd ff ff       	jmp    8002ce <vprintfmt+0x11>
+  800567:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80056a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056d:	e9 5c fd ff ff       	jmp    8002ce <vprintfmt+0x11>
+  800572:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800575:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800578:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80057b:	eb c6                	jmp    800543 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80057d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800580:	89 55 10             	mov    %edx,0x10(%ebp)
+  800583:	83 f9 01             	cmp    $0x1,%ecx
+  800586:	7f 1f                	jg     8005a7 <vprintfmt+0x2ea>
+	else if (lflag)
+  800588:	85 c9                	test   %ecx,%ecx
+  80058a:	74 67                	je     8005f3 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8b 30                	mov    (%eax),%esi
+  800591:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800594:	89 f0                	mov    %esi,%eax
+  800596:	c1 f8 1f             	sar    $0x1f,%eax
+  800599:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a5:	eb 17                	jmp    8005be <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8005a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005aa:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ad:	8b 00                	mov    (%eax),%eax
+  8005af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005be:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005c4:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8005c9:	85 c9                	test   %ecx,%ecx
+  8005cb:	0f 89 12 01 00 00    	jns    8006e3 <vprintfmt+0x426>
+				putch('-', putdat);
+  8005d1:	83 ec 08             	sub    $0x8,%esp
+  8005d4:	53                   	push   %ebx
+  8005d5:	6a 2d                	push   $0x2d
+  8005d7:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8005d9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005dc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005df:	f7 da                	neg    %edx
+  8005e1:	83 d1 00             	adc    $0x0,%ecx
+  8005e4:	f7 d9                	neg    %ecx
+  8005e6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005e9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005ee:	e9 f0 00 00 00       	jmp    8006e3 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8b 30                	mov    (%eax),%esi
+  8005f8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005fb:	89 f0                	mov    %esi,%eax
+  8005fd:	c1 f8 1f             	sar    $0x1f,%eax
+  800600:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8d 40 04             	lea    0x4(%eax),%eax
+  800609:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060c:	eb b0                	jmp    8005be <vprintfmt+0x301>
+	if (lflag >= 2)
+  80060e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800611:	89 55 10             	mov    %edx,0x10(%ebp)
+  800614:	83 f9 01             	cmp    $0x1,%ecx
+  800617:	7f 1e                	jg     800637 <vprintfmt+0x37a>
+	else if (lflag)
+  800619:	85 c9                	test   %ecx,%ecx
+  80061b:	74 32                	je     80064f <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 10                	mov    (%eax),%edx
+  800622:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800627:	8d 40 04             	lea    0x4(%eax),%eax
+  80062a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062d:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800632:	e9 ac 00 00 00       	jmp    8006e3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800637:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063a:	8b 10                	mov    (%eax),%edx
+  80063c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063f:	8d 40 08             	lea    0x8(%eax),%eax
+  800642:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800645:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80064a:	e9 94 00 00 00       	jmp    8006e3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8b 10                	mov    (%eax),%edx
+  800654:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800659:	8d 40 04             	lea    0x4(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800664:	eb 7d                	jmp    8006e3 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800666:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800669:	89 55 10             	mov    %edx,0x10(%ebp)
+  80066c:	83 f9 01             	cmp    $0x1,%ecx
+  80066f:	7f 1b                	jg     80068c <vprintfmt+0x3cf>
+	else if (lflag)
+  800671:	85 c9                	test   %ecx,%ecx
+  800673:	74 2c                	je     8006a1 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800675:	8b 45 14             	mov    0x14(%ebp),%eax
+  800678:	8b 10                	mov    (%eax),%edx
+  80067a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067f:	8d 40 04             	lea    0x4(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800685:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80068a:	eb 57                	jmp    8006e3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	8b 48 04             	mov    0x4(%eax),%ecx
+  800694:	8d 40 08             	lea    0x8(%eax),%eax
+  800697:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80069f:	eb 42                	jmp    8006e3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 10                	mov    (%eax),%edx
+  8006a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8006b6:	eb 2b                	jmp    8006e3 <vprintfmt+0x426>
+			putch('0', putdat);
+  8006b8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006bb:	83 ec 08             	sub    $0x8,%esp
+  8006be:	53                   	push   %ebx
+  8006bf:	6a 30                	push   $0x30
+  8006c1:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8006c3:	83 c4 08             	add    $0x8,%esp
+  8006c6:	53                   	push   %ebx
+  8006c7:	6a 78                	push   $0x78
+  8006c9:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ce:	8b 10                	mov    (%eax),%edx
+  8006d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006d5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006de:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8006e3:	83 ec 0c             	sub    $0xc,%esp
+  8006e6:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006ea:	50                   	push   %eax
+  8006eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8006ee:	56                   	push   %esi
+  8006ef:	51                   	push   %ecx
+  8006f0:	52                   	push   %edx
+  8006f1:	89 da                	mov    %ebx,%edx
+  8006f3:	89 f8                	mov    %edi,%eax
+  8006f5:	e8 d8 fa ff ff       	call   8001d2 <printnum>
+			break;
+  8006fa:	83 c4 20             	add    $0x20,%esp
+  8006fd:	e9 cc fb ff ff       	jmp    8002ce <vprintfmt+0x11>
+	if (lflag >= 2)
+  800702:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800705:	89 55 10             	mov    %edx,0x10(%ebp)
+  800708:	83 f9 01             	cmp    $0x1,%ecx
+  80070b:	7f 1b                	jg     800728 <vprintfmt+0x46b>
+	else if (lflag)
+  80070d:	85 c9                	test   %ecx,%ecx
+  80070f:	74 2c                	je     80073d <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 10                	mov    (%eax),%edx
+  800716:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800721:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800726:	eb bb                	jmp    8006e3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800728:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072b:	8b 10                	mov    (%eax),%edx
+  80072d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800730:	8d 40 08             	lea    0x8(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800736:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80073b:	eb a6                	jmp    8006e3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	8b 10                	mov    (%eax),%edx
+  800742:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800747:	8d 40 04             	lea    0x4(%eax),%eax
+  80074a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800752:	eb 8f                	jmp    8006e3 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800754:	89 55 10             	mov    %edx,0x10(%ebp)
+  800757:	83 ec 08             	sub    $0x8,%esp
+  80075a:	53                   	push   %ebx
+  80075b:	6a 25                	push   $0x25
+  80075d:	ff d7                	call   *%edi
+			break;
+  80075f:	83 c4 10             	add    $0x10,%esp
+  800762:	e9 67 fb ff ff       	jmp    8002ce <vprintfmt+0x11>
+			putch('%', putdat);
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	53                   	push   %ebx
+  80076b:	6a 25                	push   $0x25
+  80076d:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80076f:	83 c4 10             	add    $0x10,%esp
+  800772:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800776:	0f 84 ba fb ff ff    	je     800336 <vprintfmt+0x79>
+  80077c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80077f:	89 f0                	mov    %esi,%eax
+  800781:	83 e8 01             	sub    $0x1,%eax
+  800784:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800788:	75 f7                	jne    800781 <vprintfmt+0x4c4>
+  80078a:	89 45 10             	mov    %eax,0x10(%ebp)
+  80078d:	e9 3c fb ff ff       	jmp    8002ce <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800792:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800795:	8d 70 01             	lea    0x1(%eax),%esi
+  800798:	0f b6 00             	movzbl (%eax),%eax
+  80079b:	0f be d0             	movsbl %al,%edx
+  80079e:	85 d2                	test   %edx,%edx
+  8007a0:	74 11                	je     8007b3 <vprintfmt+0x4f6>
+  8007a2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007a5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007a8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007ab:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007ae:	e9 5d fd ff ff       	jmp    800510 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007b3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b9:	e9 10 fb ff ff       	jmp    8002ce <vprintfmt+0x11>
+  8007be:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c4:	e9 05 fb ff ff       	jmp    8002ce <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8007c9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007cd:	7e 0a                	jle    8007d9 <vprintfmt+0x51c>
+  8007cf:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007d3:	0f 85 bd fc ff ff    	jne    800496 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007d9:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007de:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007e3:	be 58 3b 80 00       	mov    $0x803b58,%esi
+  8007e8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007eb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007ee:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007f1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007f4:	e9 17 fd ff ff       	jmp    800510 <vprintfmt+0x253>
+}
+  8007f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007fc:	5b                   	pop    %ebx
+  8007fd:	5e                   	pop    %esi
+  8007fe:	5f                   	pop    %edi
+  8007ff:	5d                   	pop    %ebp
+  800800:	c3                   	ret
+
+00800801 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	83 ec 18             	sub    $0x18,%esp
+  800807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80080d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800810:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800814:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800817:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80081e:	85 c0                	test   %eax,%eax
+  800820:	74 26                	je     800848 <vsnprintf+0x47>
+  800822:	85 d2                	test   %edx,%edx
+  800824:	7e 22                	jle    800848 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800826:	ff 75 14             	push   0x14(%ebp)
+  800829:	ff 75 10             	push   0x10(%ebp)
+  80082c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80082f:	50                   	push   %eax
+  800830:	68 83 02 80 00       	push   $0x800283
+  800835:	e8 83 fa ff ff       	call   8002bd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80083a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80083d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800840:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800843:	83 c4 10             	add    $0x10,%esp
+}
+  800846:	c9                   	leave
+  800847:	c3                   	ret
+		return -E_INVAL;
+  800848:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80084d:	eb f7                	jmp    800846 <vsnprintf+0x45>
+
+0080084f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800855:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800858:	50                   	push   %eax
+  800859:	ff 75 10             	push   0x10(%ebp)
+  80085c:	ff 75 0c             	push   0xc(%ebp)
+  80085f:	ff 75 08             	push   0x8(%ebp)
+  800862:	e8 9a ff ff ff       	call   800801 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+
+00800869 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800869:	55                   	push   %ebp
+  80086a:	89 e5                	mov    %esp,%ebp
+  80086c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80086f:	80 3a 00             	cmpb   $0x0,(%edx)
+  800872:	74 10                	je     800884 <strlen+0x1b>
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800879:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80087c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800880:	75 f7                	jne    800879 <strlen+0x10>
+	return n;
+}
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800884:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800889:	eb f7                	jmp    800882 <strlen+0x19>
+
+0080088b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800891:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800894:	85 d2                	test   %edx,%edx
+  800896:	74 16                	je     8008ae <strnlen+0x23>
+  800898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008a1:	74 09                	je     8008ac <strnlen+0x21>
+		n++;
+  8008a3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a6:	39 d0                	cmp    %edx,%eax
+  8008a8:	75 f3                	jne    80089d <strnlen+0x12>
+		n++;
+  8008aa:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8008ac:	5d                   	pop    %ebp
+  8008ad:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b3:	eb f7                	jmp    8008ac <strnlen+0x21>
+
+008008b5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	53                   	push   %ebx
+  8008b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008c8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008cb:	83 c0 01             	add    $0x1,%eax
+  8008ce:	84 d2                	test   %dl,%dl
+  8008d0:	75 f2                	jne    8008c4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008d2:	89 c8                	mov    %ecx,%eax
+  8008d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d7:	c9                   	leave
+  8008d8:	c3                   	ret
+
+008008d9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	53                   	push   %ebx
+  8008dd:	83 ec 10             	sub    $0x10,%esp
+  8008e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008e3:	53                   	push   %ebx
+  8008e4:	e8 80 ff ff ff       	call   800869 <strlen>
+  8008e9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008ec:	ff 75 0c             	push   0xc(%ebp)
+  8008ef:	01 d8                	add    %ebx,%eax
+  8008f1:	50                   	push   %eax
+  8008f2:	e8 be ff ff ff       	call   8008b5 <strcpy>
+	return dst;
+}
+  8008f7:	89 d8                	mov    %ebx,%eax
+  8008f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008fc:	c9                   	leave
+  8008fd:	c3                   	ret
+
+008008fe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	56                   	push   %esi
+  800902:	53                   	push   %ebx
+  800903:	8b 75 08             	mov    0x8(%ebp),%esi
+  800906:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800909:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80090c:	85 db                	test   %ebx,%ebx
+  80090e:	74 17                	je     800927 <strncpy+0x29>
+  800910:	01 f3                	add    %esi,%ebx
+  800912:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800914:	83 c0 01             	add    $0x1,%eax
+  800917:	0f b6 0a             	movzbl (%edx),%ecx
+  80091a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80091d:	80 f9 01             	cmp    $0x1,%cl
+  800920:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800923:	39 c3                	cmp    %eax,%ebx
+  800925:	75 ed                	jne    800914 <strncpy+0x16>
+	}
+	return ret;
+}
+  800927:	89 f0                	mov    %esi,%eax
+  800929:	5b                   	pop    %ebx
+  80092a:	5e                   	pop    %esi
+  80092b:	5d                   	pop    %ebp
+  80092c:	c3                   	ret
+
+0080092d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	56                   	push   %esi
+  800931:	53                   	push   %ebx
+  800932:	8b 75 08             	mov    0x8(%ebp),%esi
+  800935:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800938:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80093b:	89 f0                	mov    %esi,%eax
+  80093d:	85 db                	test   %ebx,%ebx
+  80093f:	74 1e                	je     80095f <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800941:	83 eb 01             	sub    $0x1,%ebx
+  800944:	74 16                	je     80095c <strlcpy+0x2f>
+  800946:	01 f3                	add    %esi,%ebx
+  800948:	0f b6 0a             	movzbl (%edx),%ecx
+  80094b:	84 c9                	test   %cl,%cl
+  80094d:	74 0d                	je     80095c <strlcpy+0x2f>
+			*dst++ = *src++;
+  80094f:	83 c2 01             	add    $0x1,%edx
+  800952:	83 c0 01             	add    $0x1,%eax
+  800955:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800958:	39 d8                	cmp    %ebx,%eax
+  80095a:	75 ec                	jne    800948 <strlcpy+0x1b>
+		*dst = '\0';
+  80095c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80095f:	29 f0                	sub    %esi,%eax
+}
+  800961:	5b                   	pop    %ebx
+  800962:	5e                   	pop    %esi
+  800963:	5d                   	pop    %ebp
+  800964:	c3                   	ret
+
+00800965 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80096b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80096e:	0f b6 01             	movzbl (%ecx),%eax
+  800971:	84 c0                	test   %al,%al
+  800973:	74 11                	je     800986 <strcmp+0x21>
+  800975:	38 02                	cmp    %al,(%edx)
+  800977:	75 0d                	jne    800986 <strcmp+0x21>
+		p++, q++;
+  800979:	83 c1 01             	add    $0x1,%ecx
+  80097c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80097f:	0f b6 01             	movzbl (%ecx),%eax
+  800982:	84 c0                	test   %al,%al
+  800984:	75 ef                	jne    800975 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800986:	0f b6 c0             	movzbl %al,%eax
+  800989:	0f b6 12             	movzbl (%edx),%edx
+  80098c:	29 d0                	sub    %edx,%eax
+}
+  80098e:	5d                   	pop    %ebp
+  80098f:	c3                   	ret
+
+00800990 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	53                   	push   %ebx
+  800994:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800997:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80099a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  80099d:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8009a2:	85 d2                	test   %edx,%edx
+  8009a4:	74 2e                	je     8009d4 <strncmp+0x44>
+  8009a6:	0f b6 01             	movzbl (%ecx),%eax
+  8009a9:	84 c0                	test   %al,%al
+  8009ab:	74 16                	je     8009c3 <strncmp+0x33>
+  8009ad:	3a 03                	cmp    (%ebx),%al
+  8009af:	75 12                	jne    8009c3 <strncmp+0x33>
+		n--, p++, q++;
+  8009b1:	83 c1 01             	add    $0x1,%ecx
+  8009b4:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8009b7:	83 ea 01             	sub    $0x1,%edx
+  8009ba:	75 ea                	jne    8009a6 <strncmp+0x16>
+		return 0;
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	eb 11                	jmp    8009d4 <strncmp+0x44>
+  8009c3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8009c8:	85 d2                	test   %edx,%edx
+  8009ca:	74 08                	je     8009d4 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009cc:	0f b6 01             	movzbl (%ecx),%eax
+  8009cf:	0f b6 13             	movzbl (%ebx),%edx
+  8009d2:	29 d0                	sub    %edx,%eax
+}
+  8009d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d7:	c9                   	leave
+  8009d8:	c3                   	ret
+
+008009d9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009df:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e3:	0f b6 10             	movzbl (%eax),%edx
+  8009e6:	84 d2                	test   %dl,%dl
+  8009e8:	74 15                	je     8009ff <strchr+0x26>
+		if (*s == c)
+  8009ea:	38 d1                	cmp    %dl,%cl
+  8009ec:	74 0f                	je     8009fd <strchr+0x24>
+	for (; *s; s++)
+  8009ee:	83 c0 01             	add    $0x1,%eax
+  8009f1:	0f b6 10             	movzbl (%eax),%edx
+  8009f4:	84 d2                	test   %dl,%dl
+  8009f6:	75 f2                	jne    8009ea <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8009f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+	return 0;
+  8009ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a04:	eb f7                	jmp    8009fd <strchr+0x24>
+
+00800a06 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a06:	55                   	push   %ebp
+  800a07:	89 e5                	mov    %esp,%ebp
+  800a09:	53                   	push   %ebx
+  800a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a10:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a13:	38 d3                	cmp    %dl,%bl
+  800a15:	74 14                	je     800a2b <strfind+0x25>
+  800a17:	89 d1                	mov    %edx,%ecx
+  800a19:	84 db                	test   %bl,%bl
+  800a1b:	74 0e                	je     800a2b <strfind+0x25>
+	for (; *s; s++)
+  800a1d:	83 c0 01             	add    $0x1,%eax
+  800a20:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a23:	38 ca                	cmp    %cl,%dl
+  800a25:	74 04                	je     800a2b <strfind+0x25>
+  800a27:	84 d2                	test   %dl,%dl
+  800a29:	75 f2                	jne    800a1d <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800a2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a2e:	c9                   	leave
+  800a2f:	c3                   	ret
+
+00800a30 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	57                   	push   %edi
+  800a34:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a3a:	85 c9                	test   %ecx,%ecx
+  800a3c:	74 20                	je     800a5e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a3e:	89 f8                	mov    %edi,%eax
+  800a40:	09 c8                	or     %ecx,%eax
+  800a42:	a8 03                	test   $0x3,%al
+  800a44:	75 12                	jne    800a58 <memset+0x28>
+		c &= 0xFF;
+  800a46:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a4a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a50:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a53:	fc                   	cld
+  800a54:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a56:	eb 06                	jmp    800a5e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a5b:	fc                   	cld
+  800a5c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a5e:	89 f8                	mov    %edi,%eax
+  800a60:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+
+00800a65 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	57                   	push   %edi
+  800a69:	56                   	push   %esi
+  800a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a70:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a73:	39 c6                	cmp    %eax,%esi
+  800a75:	73 32                	jae    800aa9 <memmove+0x44>
+  800a77:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a7a:	39 d0                	cmp    %edx,%eax
+  800a7c:	73 2b                	jae    800aa9 <memmove+0x44>
+		s += n;
+		d += n;
+  800a7e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a81:	89 d6                	mov    %edx,%esi
+  800a83:	09 fe                	or     %edi,%esi
+  800a85:	09 ce                	or     %ecx,%esi
+  800a87:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a8d:	75 0e                	jne    800a9d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a8f:	83 ef 04             	sub    $0x4,%edi
+  800a92:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a95:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a98:	fd                   	std
+  800a99:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a9b:	eb 09                	jmp    800aa6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a9d:	83 ef 01             	sub    $0x1,%edi
+  800aa0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aa3:	fd                   	std
+  800aa4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aa6:	fc                   	cld
+  800aa7:	eb 1a                	jmp    800ac3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa9:	89 f2                	mov    %esi,%edx
+  800aab:	09 c2                	or     %eax,%edx
+  800aad:	09 ca                	or     %ecx,%edx
+  800aaf:	f6 c2 03             	test   $0x3,%dl
+  800ab2:	75 0a                	jne    800abe <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ab4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ab7:	89 c7                	mov    %eax,%edi
+  800ab9:	fc                   	cld
+  800aba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800abc:	eb 05                	jmp    800ac3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800abe:	89 c7                	mov    %eax,%edi
+  800ac0:	fc                   	cld
+  800ac1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ac3:	5e                   	pop    %esi
+  800ac4:	5f                   	pop    %edi
+  800ac5:	5d                   	pop    %ebp
+  800ac6:	c3                   	ret
+
+00800ac7 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800ac7:	55                   	push   %ebp
+  800ac8:	89 e5                	mov    %esp,%ebp
+  800aca:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800acd:	ff 75 10             	push   0x10(%ebp)
+  800ad0:	ff 75 0c             	push   0xc(%ebp)
+  800ad3:	ff 75 08             	push   0x8(%ebp)
+  800ad6:	e8 8a ff ff ff       	call   800a65 <memmove>
+}
+  800adb:	c9                   	leave
+  800adc:	c3                   	ret
+
+00800add <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	56                   	push   %esi
+  800ae1:	53                   	push   %ebx
+  800ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae8:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aeb:	85 f6                	test   %esi,%esi
+  800aed:	74 29                	je     800b18 <memcmp+0x3b>
+  800aef:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800af1:	0f b6 08             	movzbl (%eax),%ecx
+  800af4:	0f b6 1a             	movzbl (%edx),%ebx
+  800af7:	38 d9                	cmp    %bl,%cl
+  800af9:	75 11                	jne    800b0c <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800afb:	83 c0 01             	add    $0x1,%eax
+  800afe:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b01:	39 c6                	cmp    %eax,%esi
+  800b03:	75 ec                	jne    800af1 <memcmp+0x14>
+	}
+
+	return 0;
+  800b05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0a:	eb 08                	jmp    800b14 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b0c:	0f b6 c1             	movzbl %cl,%eax
+  800b0f:	0f b6 db             	movzbl %bl,%ebx
+  800b12:	29 d8                	sub    %ebx,%eax
+}
+  800b14:	5b                   	pop    %ebx
+  800b15:	5e                   	pop    %esi
+  800b16:	5d                   	pop    %ebp
+  800b17:	c3                   	ret
+	return 0;
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	eb f5                	jmp    800b14 <memcmp+0x37>
+
+00800b1f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b28:	89 c2                	mov    %eax,%edx
+  800b2a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b2d:	39 d0                	cmp    %edx,%eax
+  800b2f:	73 0d                	jae    800b3e <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b31:	38 08                	cmp    %cl,(%eax)
+  800b33:	74 0d                	je     800b42 <memfind+0x23>
+	for (; s < ends; s++)
+  800b35:	83 c0 01             	add    $0x1,%eax
+  800b38:	39 c2                	cmp    %eax,%edx
+  800b3a:	75 f5                	jne    800b31 <memfind+0x12>
+  800b3c:	eb 06                	jmp    800b44 <memfind+0x25>
+  800b3e:	89 c2                	mov    %eax,%edx
+  800b40:	eb 02                	jmp    800b44 <memfind+0x25>
+  800b42:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800b44:	89 d0                	mov    %edx,%eax
+  800b46:	5d                   	pop    %ebp
+  800b47:	c3                   	ret
+
+00800b48 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b48:	55                   	push   %ebp
+  800b49:	89 e5                	mov    %esp,%ebp
+  800b4b:	57                   	push   %edi
+  800b4c:	56                   	push   %esi
+  800b4d:	53                   	push   %ebx
+  800b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b54:	0f b6 02             	movzbl (%edx),%eax
+  800b57:	3c 20                	cmp    $0x20,%al
+  800b59:	74 04                	je     800b5f <strtol+0x17>
+  800b5b:	3c 09                	cmp    $0x9,%al
+  800b5d:	75 0e                	jne    800b6d <strtol+0x25>
+		s++;
+  800b5f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b62:	0f b6 02             	movzbl (%edx),%eax
+  800b65:	3c 20                	cmp    $0x20,%al
+  800b67:	74 f6                	je     800b5f <strtol+0x17>
+  800b69:	3c 09                	cmp    $0x9,%al
+  800b6b:	74 f2                	je     800b5f <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b6d:	3c 2b                	cmp    $0x2b,%al
+  800b6f:	74 2a                	je     800b9b <strtol+0x53>
+	int neg = 0;
+  800b71:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b76:	3c 2d                	cmp    $0x2d,%al
+  800b78:	74 2b                	je     800ba5 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b80:	75 0f                	jne    800b91 <strtol+0x49>
+  800b82:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b85:	74 28                	je     800baf <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b87:	85 db                	test   %ebx,%ebx
+  800b89:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b8e:	0f 44 d8             	cmove  %eax,%ebx
+  800b91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b96:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b99:	eb 46                	jmp    800be1 <strtol+0x99>
+		s++;
+  800b9b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba3:	eb d5                	jmp    800b7a <strtol+0x32>
+		s++, neg = 1;
+  800ba5:	83 c2 01             	add    $0x1,%edx
+  800ba8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bad:	eb cb                	jmp    800b7a <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800baf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bb3:	74 0e                	je     800bc3 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800bb5:	85 db                	test   %ebx,%ebx
+  800bb7:	75 d8                	jne    800b91 <strtol+0x49>
+		s++, base = 8;
+  800bb9:	83 c2 01             	add    $0x1,%edx
+  800bbc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bc1:	eb ce                	jmp    800b91 <strtol+0x49>
+		s += 2, base = 16;
+  800bc3:	83 c2 02             	add    $0x2,%edx
+  800bc6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bcb:	eb c4                	jmp    800b91 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bcd:	0f be c0             	movsbl %al,%eax
+  800bd0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bd3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd6:	7d 3a                	jge    800c12 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800bd8:	83 c2 01             	add    $0x1,%edx
+  800bdb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bdf:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800be1:	0f b6 02             	movzbl (%edx),%eax
+  800be4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be7:	89 f3                	mov    %esi,%ebx
+  800be9:	80 fb 09             	cmp    $0x9,%bl
+  800bec:	76 df                	jbe    800bcd <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800bee:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bf1:	89 f3                	mov    %esi,%ebx
+  800bf3:	80 fb 19             	cmp    $0x19,%bl
+  800bf6:	77 08                	ja     800c00 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800bf8:	0f be c0             	movsbl %al,%eax
+  800bfb:	83 e8 57             	sub    $0x57,%eax
+  800bfe:	eb d3                	jmp    800bd3 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c00:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c03:	89 f3                	mov    %esi,%ebx
+  800c05:	80 fb 19             	cmp    $0x19,%bl
+  800c08:	77 08                	ja     800c12 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c0a:	0f be c0             	movsbl %al,%eax
+  800c0d:	83 e8 37             	sub    $0x37,%eax
+  800c10:	eb c1                	jmp    800bd3 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c12:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c16:	74 05                	je     800c1d <strtol+0xd5>
+		*endptr = (char *) s;
+  800c18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c1b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c1d:	89 c8                	mov    %ecx,%eax
+  800c1f:	f7 d8                	neg    %eax
+  800c21:	85 ff                	test   %edi,%edi
+  800c23:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c26:	89 c8                	mov    %ecx,%eax
+  800c28:	5b                   	pop    %ebx
+  800c29:	5e                   	pop    %esi
+  800c2a:	5f                   	pop    %edi
+  800c2b:	5d                   	pop    %ebp
+  800c2c:	c3                   	ret
+
+00800c2d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	57                   	push   %edi
+  800c31:	56                   	push   %esi
+  800c32:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3e:	89 c3                	mov    %eax,%ebx
+  800c40:	89 c7                	mov    %eax,%edi
+  800c42:	89 c6                	mov    %eax,%esi
+  800c44:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c46:	5b                   	pop    %ebx
+  800c47:	5e                   	pop    %esi
+  800c48:	5f                   	pop    %edi
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+
+00800c4b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	57                   	push   %edi
+  800c4f:	56                   	push   %esi
+  800c50:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c56:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c5b:	89 d1                	mov    %edx,%ecx
+  800c5d:	89 d3                	mov    %edx,%ebx
+  800c5f:	89 d7                	mov    %edx,%edi
+  800c61:	89 d6                	mov    %edx,%esi
+  800c63:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+
+00800c6a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	56                   	push   %esi
+  800c6f:	53                   	push   %ebx
+  800c70:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c80:	89 cb                	mov    %ecx,%ebx
+  800c82:	89 cf                	mov    %ecx,%edi
+  800c84:	89 ce                	mov    %ecx,%esi
+  800c86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c88:	85 c0                	test   %eax,%eax
+  800c8a:	7f 08                	jg     800c94 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8f:	5b                   	pop    %ebx
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c94:	83 ec 0c             	sub    $0xc,%esp
+  800c97:	50                   	push   %eax
+  800c98:	6a 03                	push   $0x3
+  800c9a:	68 8b 3e 80 00       	push   $0x803e8b
+  800c9f:	6a 23                	push   $0x23
+  800ca1:	68 a8 3e 80 00       	push   $0x803ea8
+  800ca6:	e8 dd 28 00 00       	call   803588 <_panic>
+
+00800cab <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	57                   	push   %edi
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cbb:	89 d1                	mov    %edx,%ecx
+  800cbd:	89 d3                	mov    %edx,%ebx
+  800cbf:	89 d7                	mov    %edx,%edi
+  800cc1:	89 d6                	mov    %edx,%esi
+  800cc3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+
+00800cca <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cda:	89 d1                	mov    %edx,%ecx
+  800cdc:	89 d3                	mov    %edx,%ebx
+  800cde:	89 d7                	mov    %edx,%edi
+  800ce0:	89 d6                	mov    %edx,%esi
+  800ce2:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ce4:	5b                   	pop    %ebx
+  800ce5:	5e                   	pop    %esi
+  800ce6:	5f                   	pop    %edi
+  800ce7:	5d                   	pop    %ebp
+  800ce8:	c3                   	ret
+
+00800ce9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ce9:	55                   	push   %ebp
+  800cea:	89 e5                	mov    %esp,%ebp
+  800cec:	57                   	push   %edi
+  800ced:	56                   	push   %esi
+  800cee:	53                   	push   %ebx
+  800cef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cf2:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfd:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d05:	89 f7                	mov    %esi,%edi
+  800d07:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d09:	85 c0                	test   %eax,%eax
+  800d0b:	7f 08                	jg     800d15 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d15:	83 ec 0c             	sub    $0xc,%esp
+  800d18:	50                   	push   %eax
+  800d19:	6a 04                	push   $0x4
+  800d1b:	68 8b 3e 80 00       	push   $0x803e8b
+  800d20:	6a 23                	push   $0x23
+  800d22:	68 a8 3e 80 00       	push   $0x803ea8
+  800d27:	e8 5c 28 00 00       	call   803588 <_panic>
+
+00800d2c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	57                   	push   %edi
+  800d30:	56                   	push   %esi
+  800d31:	53                   	push   %ebx
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d43:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d46:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d49:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d4b:	85 c0                	test   %eax,%eax
+  800d4d:	7f 08                	jg     800d57 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d52:	5b                   	pop    %ebx
+  800d53:	5e                   	pop    %esi
+  800d54:	5f                   	pop    %edi
+  800d55:	5d                   	pop    %ebp
+  800d56:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d57:	83 ec 0c             	sub    $0xc,%esp
+  800d5a:	50                   	push   %eax
+  800d5b:	6a 05                	push   $0x5
+  800d5d:	68 8b 3e 80 00       	push   $0x803e8b
+  800d62:	6a 23                	push   $0x23
+  800d64:	68 a8 3e 80 00       	push   $0x803ea8
+  800d69:	e8 1a 28 00 00       	call   803588 <_panic>
+
+00800d6e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d87:	89 df                	mov    %ebx,%edi
+  800d89:	89 de                	mov    %ebx,%esi
+  800d8b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d8d:	85 c0                	test   %eax,%eax
+  800d8f:	7f 08                	jg     800d99 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d94:	5b                   	pop    %ebx
+  800d95:	5e                   	pop    %esi
+  800d96:	5f                   	pop    %edi
+  800d97:	5d                   	pop    %ebp
+  800d98:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+  800d9c:	50                   	push   %eax
+  800d9d:	6a 06                	push   $0x6
+  800d9f:	68 8b 3e 80 00       	push   $0x803e8b
+  800da4:	6a 23                	push   $0x23
+  800da6:	68 a8 3e 80 00       	push   $0x803ea8
+  800dab:	e8 d8 27 00 00       	call   803588 <_panic>
+
+00800db0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc4:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dc9:	89 df                	mov    %ebx,%edi
+  800dcb:	89 de                	mov    %ebx,%esi
+  800dcd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcf:	85 c0                	test   %eax,%eax
+  800dd1:	7f 08                	jg     800ddb <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd6:	5b                   	pop    %ebx
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	50                   	push   %eax
+  800ddf:	6a 08                	push   $0x8
+  800de1:	68 8b 3e 80 00       	push   $0x803e8b
+  800de6:	6a 23                	push   $0x23
+  800de8:	68 a8 3e 80 00       	push   $0x803ea8
+  800ded:	e8 96 27 00 00       	call   803588 <_panic>
+
+00800df2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e0b:	89 df                	mov    %ebx,%edi
+  800e0d:	89 de                	mov    %ebx,%esi
+  800e0f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	7f 08                	jg     800e1d <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5e                   	pop    %esi
+  800e1a:	5f                   	pop    %edi
+  800e1b:	5d                   	pop    %ebp
+  800e1c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1d:	83 ec 0c             	sub    $0xc,%esp
+  800e20:	50                   	push   %eax
+  800e21:	6a 09                	push   $0x9
+  800e23:	68 8b 3e 80 00       	push   $0x803e8b
+  800e28:	6a 23                	push   $0x23
+  800e2a:	68 a8 3e 80 00       	push   $0x803ea8
+  800e2f:	e8 54 27 00 00       	call   803588 <_panic>
+
+00800e34 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e34:	55                   	push   %ebp
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	57                   	push   %edi
+  800e38:	56                   	push   %esi
+  800e39:	53                   	push   %ebx
+  800e3a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e48:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e4d:	89 df                	mov    %ebx,%edi
+  800e4f:	89 de                	mov    %ebx,%esi
+  800e51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	7f 08                	jg     800e5f <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5a:	5b                   	pop    %ebx
+  800e5b:	5e                   	pop    %esi
+  800e5c:	5f                   	pop    %edi
+  800e5d:	5d                   	pop    %ebp
+  800e5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	50                   	push   %eax
+  800e63:	6a 0a                	push   $0xa
+  800e65:	68 8b 3e 80 00       	push   $0x803e8b
+  800e6a:	6a 23                	push   $0x23
+  800e6c:	68 a8 3e 80 00       	push   $0x803ea8
+  800e71:	e8 12 27 00 00       	call   803588 <_panic>
+
+00800e76 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	57                   	push   %edi
+  800e7a:	56                   	push   %esi
+  800e7b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e87:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e92:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e94:	5b                   	pop    %ebx
+  800e95:	5e                   	pop    %esi
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+
+00800e99 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	57                   	push   %edi
+  800e9d:	56                   	push   %esi
+  800e9e:	53                   	push   %ebx
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eaf:	89 cb                	mov    %ecx,%ebx
+  800eb1:	89 cf                	mov    %ecx,%edi
+  800eb3:	89 ce                	mov    %ecx,%esi
+  800eb5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb7:	85 c0                	test   %eax,%eax
+  800eb9:	7f 08                	jg     800ec3 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 0d                	push   $0xd
+  800ec9:	68 8b 3e 80 00       	push   $0x803e8b
+  800ece:	6a 23                	push   $0x23
+  800ed0:	68 a8 3e 80 00       	push   $0x803ea8
+  800ed5:	e8 ae 26 00 00       	call   803588 <_panic>
+
+00800eda <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eeb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ef4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800ef6:	5b                   	pop    %ebx
+  800ef7:	5e                   	pop    %esi
+  800ef8:	5f                   	pop    %edi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	c3                   	ret
+
+00800efb <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	57                   	push   %edi
+  800eff:	56                   	push   %esi
+  800f00:	53                   	push   %ebx
+  800f01:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f14:	89 df                	mov    %ebx,%edi
+  800f16:	89 de                	mov    %ebx,%esi
+  800f18:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1a:	85 c0                	test   %eax,%eax
+  800f1c:	7f 08                	jg     800f26 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f21:	5b                   	pop    %ebx
+  800f22:	5e                   	pop    %esi
+  800f23:	5f                   	pop    %edi
+  800f24:	5d                   	pop    %ebp
+  800f25:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f26:	83 ec 0c             	sub    $0xc,%esp
+  800f29:	50                   	push   %eax
+  800f2a:	6a 0d                	push   $0xd
+  800f2c:	68 8b 3e 80 00       	push   $0x803e8b
+  800f31:	6a 23                	push   $0x23
+  800f33:	68 a8 3e 80 00       	push   $0x803ea8
+  800f38:	e8 4b 26 00 00       	call   803588 <_panic>
+
+00800f3d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f3d:	55                   	push   %ebp
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	57                   	push   %edi
+  800f41:	56                   	push   %esi
+  800f42:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f48:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f4d:	89 d1                	mov    %edx,%ecx
+  800f4f:	89 d3                	mov    %edx,%ebx
+  800f51:	89 d7                	mov    %edx,%edi
+  800f53:	89 d6                	mov    %edx,%esi
+  800f55:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5f                   	pop    %edi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	c3                   	ret
+
+00800f5c <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f72:	89 df                	mov    %ebx,%edi
+  800f74:	89 de                	mov    %ebx,%esi
+  800f76:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+
+00800f7d <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800f7d:	55                   	push   %ebp
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	57                   	push   %edi
+  800f81:	56                   	push   %esi
+  800f82:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f90:	89 cb                	mov    %ecx,%ebx
+  800f92:	89 cf                	mov    %ecx,%edi
+  800f94:	89 ce                	mov    %ecx,%esi
+  800f96:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800f98:	5b                   	pop    %ebx
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+
+00800f9d <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fae:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fb3:	89 df                	mov    %ebx,%edi
+  800fb5:	89 de                	mov    %ebx,%esi
+  800fb7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+
+00800fbe <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcf:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fd4:	89 df                	mov    %ebx,%edi
+  800fd6:	89 de                	mov    %ebx,%esi
+  800fd8:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5e                   	pop    %esi
+  800fdc:	5f                   	pop    %edi
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+
+00800fdf <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fed:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ff2:	89 cb                	mov    %ecx,%ebx
+  800ff4:	89 cf                	mov    %ecx,%edi
+  800ff6:	89 ce                	mov    %ecx,%esi
+  800ff8:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5e                   	pop    %esi
+  800ffc:	5f                   	pop    %edi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+
+00800fff <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801005:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801010:	b8 14 00 00 00       	mov    $0x14,%eax
+  801015:	89 df                	mov    %ebx,%edi
+  801017:	89 de                	mov    %ebx,%esi
+  801019:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+
+00801020 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801026:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801033:	89 cb                	mov    %ecx,%ebx
+  801035:	89 cf                	mov    %ecx,%edi
+  801037:	89 ce                	mov    %ecx,%esi
+  801039:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80103b:	5b                   	pop    %ebx
+  80103c:	5e                   	pop    %esi
+  80103d:	5f                   	pop    %edi
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+
+00801040 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801040:	55                   	push   %ebp
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	57                   	push   %edi
+  801044:	56                   	push   %esi
+  801045:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801046:	be 00 00 00 00       	mov    $0x0,%esi
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801051:	b8 16 00 00 00       	mov    $0x16,%eax
+  801056:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801059:	89 f7                	mov    %esi,%edi
+  80105b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80105d:	5b                   	pop    %ebx
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+
+00801062 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	b8 17 00 00 00       	mov    $0x17,%eax
+  801078:	89 df                	mov    %ebx,%edi
+  80107a:	89 de                	mov    %ebx,%esi
+  80107c:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80107e:	5b                   	pop    %ebx
+  80107f:	5e                   	pop    %esi
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+
+00801083 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	56                   	push   %esi
+  801088:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801089:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80108e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801091:	b8 18 00 00 00       	mov    $0x18,%eax
+  801096:	89 cb                	mov    %ecx,%ebx
+  801098:	89 cf                	mov    %ecx,%edi
+  80109a:	89 ce                	mov    %ecx,%esi
+  80109c:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+
+008010a3 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	56                   	push   %esi
+  8010a8:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8010a9:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8010ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010ba:	89 df                	mov    %ebx,%edi
+  8010bc:	89 de                	mov    %ebx,%esi
+  8010be:	cd 30                	int    $0x30
+}
+  8010c0:	5b                   	pop    %ebx
+  8010c1:	5e                   	pop    %esi
+  8010c2:	5f                   	pop    %edi
+  8010c3:	5d                   	pop    %ebp
+  8010c4:	c3                   	ret
+
+008010c5 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010de:	89 f7                	mov    %esi,%edi
+  8010e0:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8010e2:	5b                   	pop    %ebx
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5f                   	pop    %edi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+
+008010e7 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8010e7:	55                   	push   %ebp
+  8010e8:	89 e5                	mov    %esp,%ebp
+  8010ea:	57                   	push   %edi
+  8010eb:	56                   	push   %esi
+  8010ec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801100:	89 f7                	mov    %esi,%edi
+  801102:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801104:	5b                   	pop    %ebx
+  801105:	5e                   	pop    %esi
+  801106:	5f                   	pop    %edi
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+
+00801109 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80111f:	89 df                	mov    %ebx,%edi
+  801121:	89 de                	mov    %ebx,%esi
+  801123:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5f                   	pop    %edi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+
+0080112a <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	57                   	push   %edi
+  80112e:	56                   	push   %esi
+  80112f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801130:	be 00 00 00 00       	mov    $0x0,%esi
+  801135:	8b 55 08             	mov    0x8(%ebp),%edx
+  801138:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801140:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801143:	89 f7                	mov    %esi,%edi
+  801145:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801152:	83 3d c0 63 80 00 00 	cmpl   $0x0,0x8063c0
+  801159:	74 0a                	je     801165 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80115b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80115e:	a3 c0 63 80 00       	mov    %eax,0x8063c0
+}
+  801163:	c9                   	leave
+  801164:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  801165:	83 ec 04             	sub    $0x4,%esp
+  801168:	6a 07                	push   $0x7
+  80116a:	68 00 f0 bf ee       	push   $0xeebff000
+  80116f:	6a 00                	push   $0x0
+  801171:	e8 73 fb ff ff       	call   800ce9 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801176:	83 c4 08             	add    $0x8,%esp
+  801179:	68 8a 11 80 00       	push   $0x80118a
+  80117e:	6a 00                	push   $0x0
+  801180:	e8 af fc ff ff       	call   800e34 <sys_env_set_pgfault_upcall>
+  801185:	83 c4 10             	add    $0x10,%esp
+  801188:	eb d1                	jmp    80115b <set_pgfault_handler+0xf>
+
+0080118a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80118a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80118b:	a1 c0 63 80 00       	mov    0x8063c0,%eax
+	call *%eax
+  801190:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801192:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  801195:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  801199:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80119c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  8011a0:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  8011a2:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8011a6:	83 c4 08             	add    $0x8,%esp
+	popal;
+  8011a9:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8011aa:	83 c4 04             	add    $0x4,%esp
+	popf
+  8011ad:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  8011ae:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  8011af:	c3                   	ret
+
+008011b0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011b6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011bb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+
+008011c0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011cb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011d0:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+
+008011d7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011df:	89 c2                	mov    %eax,%edx
+  8011e1:	c1 ea 16             	shr    $0x16,%edx
+  8011e4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011eb:	f6 c2 01             	test   $0x1,%dl
+  8011ee:	74 29                	je     801219 <fd_alloc+0x42>
+  8011f0:	89 c2                	mov    %eax,%edx
+  8011f2:	c1 ea 0c             	shr    $0xc,%edx
+  8011f5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011fc:	f6 c2 01             	test   $0x1,%dl
+  8011ff:	74 18                	je     801219 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801201:	05 00 10 00 00       	add    $0x1000,%eax
+  801206:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80120b:	75 d2                	jne    8011df <fd_alloc+0x8>
+  80120d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801212:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801217:	eb 05                	jmp    80121e <fd_alloc+0x47>
+			return 0;
+  801219:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80121e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801221:	89 02                	mov    %eax,(%edx)
+}
+  801223:	89 c8                	mov    %ecx,%eax
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+
+00801227 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80122d:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801232:	77 30                	ja     801264 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801234:	c1 e0 0c             	shl    $0xc,%eax
+  801237:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80123c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801242:	f6 c2 01             	test   $0x1,%dl
+  801245:	74 24                	je     80126b <fd_lookup+0x44>
+  801247:	89 c2                	mov    %eax,%edx
+  801249:	c1 ea 0c             	shr    $0xc,%edx
+  80124c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801253:	f6 c2 01             	test   $0x1,%dl
+  801256:	74 1a                	je     801272 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801258:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80125b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80125d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801262:	5d                   	pop    %ebp
+  801263:	c3                   	ret
+		return -E_INVAL;
+  801264:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801269:	eb f7                	jmp    801262 <fd_lookup+0x3b>
+		return -E_INVAL;
+  80126b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801270:	eb f0                	jmp    801262 <fd_lookup+0x3b>
+  801272:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801277:	eb e9                	jmp    801262 <fd_lookup+0x3b>
+
+00801279 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	53                   	push   %ebx
+  80127d:	83 ec 04             	sub    $0x4,%esp
+  801280:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801283:	b8 00 00 00 00       	mov    $0x0,%eax
+  801288:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  80128d:	39 13                	cmp    %edx,(%ebx)
+  80128f:	74 54                	je     8012e5 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801291:	83 c0 01             	add    $0x1,%eax
+  801294:	8b 1c 85 34 3f 80 00 	mov    0x803f34(,%eax,4),%ebx
+  80129b:	85 db                	test   %ebx,%ebx
+  80129d:	75 ee                	jne    80128d <dev_lookup+0x14>
+  80129f:	89 e1                	mov    %esp,%ecx
+  8012a1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8012a6:	29 c8                	sub    %ecx,%eax
+  8012a8:	89 c1                	mov    %eax,%ecx
+  8012aa:	c1 e9 0f             	shr    $0xf,%ecx
+  8012ad:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012ba:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8012c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8012c4:	83 ec 04             	sub    $0x4,%esp
+  8012c7:	52                   	push   %edx
+  8012c8:	50                   	push   %eax
+  8012c9:	68 b8 3e 80 00       	push   $0x803eb8
+  8012ce:	e8 eb ee ff ff       	call   8001be <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012d3:	83 c4 10             	add    $0x10,%esp
+  8012d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012de:	89 1a                	mov    %ebx,(%edx)
+}
+  8012e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012e3:	c9                   	leave
+  8012e4:	c3                   	ret
+			return 0;
+  8012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ea:	eb ef                	jmp    8012db <dev_lookup+0x62>
+
+008012ec <fd_close>:
+{
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	57                   	push   %edi
+  8012f0:	56                   	push   %esi
+  8012f1:	53                   	push   %ebx
+  8012f2:	83 ec 24             	sub    $0x24,%esp
+  8012f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012f8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012fb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012fe:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012ff:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801305:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801308:	50                   	push   %eax
+  801309:	e8 19 ff ff ff       	call   801227 <fd_lookup>
+  80130e:	89 c3                	mov    %eax,%ebx
+  801310:	83 c4 10             	add    $0x10,%esp
+  801313:	85 c0                	test   %eax,%eax
+  801315:	78 05                	js     80131c <fd_close+0x30>
+	    || fd != fd2)
+  801317:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80131a:	74 0f                	je     80132b <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80131c:	85 ff                	test   %edi,%edi
+  80131e:	0f 44 df             	cmove  %edi,%ebx
+}
+  801321:	89 d8                	mov    %ebx,%eax
+  801323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801326:	5b                   	pop    %ebx
+  801327:	5e                   	pop    %esi
+  801328:	5f                   	pop    %edi
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80132b:	83 ec 08             	sub    $0x8,%esp
+  80132e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801331:	50                   	push   %eax
+  801332:	ff 36                	push   (%esi)
+  801334:	e8 40 ff ff ff       	call   801279 <dev_lookup>
+  801339:	89 c3                	mov    %eax,%ebx
+  80133b:	83 c4 10             	add    $0x10,%esp
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 1a                	js     80135c <fd_close+0x70>
+		if (dev->dev_close)
+  801342:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801345:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801348:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80134d:	85 c0                	test   %eax,%eax
+  80134f:	74 0b                	je     80135c <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801351:	83 ec 0c             	sub    $0xc,%esp
+  801354:	56                   	push   %esi
+  801355:	ff d0                	call   *%eax
+  801357:	89 c3                	mov    %eax,%ebx
+  801359:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80135c:	83 ec 08             	sub    $0x8,%esp
+  80135f:	56                   	push   %esi
+  801360:	6a 00                	push   $0x0
+  801362:	e8 07 fa ff ff       	call   800d6e <sys_page_unmap>
+	return r;
+  801367:	83 c4 10             	add    $0x10,%esp
+  80136a:	eb b5                	jmp    801321 <fd_close+0x35>
+
+0080136c <close>:
+
+int
+close(int fdnum)
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801372:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801375:	50                   	push   %eax
+  801376:	ff 75 08             	push   0x8(%ebp)
+  801379:	e8 a9 fe ff ff       	call   801227 <fd_lookup>
+  80137e:	83 c4 10             	add    $0x10,%esp
+  801381:	85 c0                	test   %eax,%eax
+  801383:	79 02                	jns    801387 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801385:	c9                   	leave
+  801386:	c3                   	ret
+		return fd_close(fd, 1);
+  801387:	83 ec 08             	sub    $0x8,%esp
+  80138a:	6a 01                	push   $0x1
+  80138c:	ff 75 f4             	push   -0xc(%ebp)
+  80138f:	e8 58 ff ff ff       	call   8012ec <fd_close>
+  801394:	83 c4 10             	add    $0x10,%esp
+  801397:	eb ec                	jmp    801385 <close+0x19>
+
+00801399 <close_all>:
+
+void
+close_all(void)
+{
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	53                   	push   %ebx
+  80139d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013a5:	83 ec 0c             	sub    $0xc,%esp
+  8013a8:	53                   	push   %ebx
+  8013a9:	e8 be ff ff ff       	call   80136c <close>
+	for (i = 0; i < MAXFD; i++)
+  8013ae:	83 c3 01             	add    $0x1,%ebx
+  8013b1:	83 c4 10             	add    $0x10,%esp
+  8013b4:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8013ba:	75 e9                	jne    8013a5 <close_all+0xc>
+}
+  8013bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013bf:	c9                   	leave
+  8013c0:	c3                   	ret
+
+008013c1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	57                   	push   %edi
+  8013c5:	56                   	push   %esi
+  8013c6:	53                   	push   %ebx
+  8013c7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013ca:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013cd:	50                   	push   %eax
+  8013ce:	ff 75 08             	push   0x8(%ebp)
+  8013d1:	e8 51 fe ff ff       	call   801227 <fd_lookup>
+  8013d6:	89 c3                	mov    %eax,%ebx
+  8013d8:	83 c4 10             	add    $0x10,%esp
+  8013db:	85 c0                	test   %eax,%eax
+  8013dd:	78 7f                	js     80145e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013df:	83 ec 0c             	sub    $0xc,%esp
+  8013e2:	ff 75 0c             	push   0xc(%ebp)
+  8013e5:	e8 82 ff ff ff       	call   80136c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013ed:	c1 e6 0c             	shl    $0xc,%esi
+  8013f0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013f9:	89 3c 24             	mov    %edi,(%esp)
+  8013fc:	e8 bf fd ff ff       	call   8011c0 <fd2data>
+  801401:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801403:	89 34 24             	mov    %esi,(%esp)
+  801406:	e8 b5 fd ff ff       	call   8011c0 <fd2data>
+  80140b:	83 c4 10             	add    $0x10,%esp
+  80140e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801411:	89 d8                	mov    %ebx,%eax
+  801413:	c1 e8 16             	shr    $0x16,%eax
+  801416:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80141d:	a8 01                	test   $0x1,%al
+  80141f:	74 11                	je     801432 <dup+0x71>
+  801421:	89 d8                	mov    %ebx,%eax
+  801423:	c1 e8 0c             	shr    $0xc,%eax
+  801426:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80142d:	f6 c2 01             	test   $0x1,%dl
+  801430:	75 36                	jne    801468 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801432:	89 f8                	mov    %edi,%eax
+  801434:	c1 e8 0c             	shr    $0xc,%eax
+  801437:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80143e:	83 ec 0c             	sub    $0xc,%esp
+  801441:	25 07 0e 00 00       	and    $0xe07,%eax
+  801446:	50                   	push   %eax
+  801447:	56                   	push   %esi
+  801448:	6a 00                	push   $0x0
+  80144a:	57                   	push   %edi
+  80144b:	6a 00                	push   $0x0
+  80144d:	e8 da f8 ff ff       	call   800d2c <sys_page_map>
+  801452:	89 c3                	mov    %eax,%ebx
+  801454:	83 c4 20             	add    $0x20,%esp
+  801457:	85 c0                	test   %eax,%eax
+  801459:	78 33                	js     80148e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80145b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80145e:	89 d8                	mov    %ebx,%eax
+  801460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801463:	5b                   	pop    %ebx
+  801464:	5e                   	pop    %esi
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801468:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	25 07 0e 00 00       	and    $0xe07,%eax
+  801477:	50                   	push   %eax
+  801478:	ff 75 d4             	push   -0x2c(%ebp)
+  80147b:	6a 00                	push   $0x0
+  80147d:	53                   	push   %ebx
+  80147e:	6a 00                	push   $0x0
+  801480:	e8 a7 f8 ff ff       	call   800d2c <sys_page_map>
+  801485:	89 c3                	mov    %eax,%ebx
+  801487:	83 c4 20             	add    $0x20,%esp
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	79 a4                	jns    801432 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80148e:	83 ec 08             	sub    $0x8,%esp
+  801491:	56                   	push   %esi
+  801492:	6a 00                	push   $0x0
+  801494:	e8 d5 f8 ff ff       	call   800d6e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801499:	83 c4 08             	add    $0x8,%esp
+  80149c:	ff 75 d4             	push   -0x2c(%ebp)
+  80149f:	6a 00                	push   $0x0
+  8014a1:	e8 c8 f8 ff ff       	call   800d6e <sys_page_unmap>
+	return r;
+  8014a6:	83 c4 10             	add    $0x10,%esp
+  8014a9:	eb b3                	jmp    80145e <dup+0x9d>
+
+008014ab <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	56                   	push   %esi
+  8014af:	53                   	push   %ebx
+  8014b0:	83 ec 18             	sub    $0x18,%esp
+  8014b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014b9:	50                   	push   %eax
+  8014ba:	53                   	push   %ebx
+  8014bb:	e8 67 fd ff ff       	call   801227 <fd_lookup>
+  8014c0:	83 c4 10             	add    $0x10,%esp
+  8014c3:	85 c0                	test   %eax,%eax
+  8014c5:	78 3c                	js     801503 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014c7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014ca:	83 ec 08             	sub    $0x8,%esp
+  8014cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d0:	50                   	push   %eax
+  8014d1:	ff 36                	push   (%esi)
+  8014d3:	e8 a1 fd ff ff       	call   801279 <dev_lookup>
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	78 24                	js     801503 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014df:	8b 46 08             	mov    0x8(%esi),%eax
+  8014e2:	83 e0 03             	and    $0x3,%eax
+  8014e5:	83 f8 01             	cmp    $0x1,%eax
+  8014e8:	74 20                	je     80150a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ed:	8b 40 08             	mov    0x8(%eax),%eax
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	74 54                	je     801548 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014f4:	83 ec 04             	sub    $0x4,%esp
+  8014f7:	ff 75 10             	push   0x10(%ebp)
+  8014fa:	ff 75 0c             	push   0xc(%ebp)
+  8014fd:	56                   	push   %esi
+  8014fe:	ff d0                	call   *%eax
+  801500:	83 c4 10             	add    $0x10,%esp
+}
+  801503:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801506:	5b                   	pop    %ebx
+  801507:	5e                   	pop    %esi
+  801508:	5d                   	pop    %ebp
+  801509:	c3                   	ret
+  80150a:	89 e2                	mov    %esp,%edx
+  80150c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801511:	29 d0                	sub    %edx,%eax
+  801513:	89 c2                	mov    %eax,%edx
+  801515:	c1 ea 0f             	shr    $0xf,%edx
+  801518:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80151d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801522:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801525:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80152c:	8b 40 48             	mov    0x48(%eax),%eax
+  80152f:	83 ec 04             	sub    $0x4,%esp
+  801532:	53                   	push   %ebx
+  801533:	50                   	push   %eax
+  801534:	68 f9 3e 80 00       	push   $0x803ef9
+  801539:	e8 80 ec ff ff       	call   8001be <cprintf>
+		return -E_INVAL;
+  80153e:	83 c4 10             	add    $0x10,%esp
+  801541:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801546:	eb bb                	jmp    801503 <read+0x58>
+		return -E_NOT_SUPP;
+  801548:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80154d:	eb b4                	jmp    801503 <read+0x58>
+
+0080154f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80154f:	55                   	push   %ebp
+  801550:	89 e5                	mov    %esp,%ebp
+  801552:	57                   	push   %edi
+  801553:	56                   	push   %esi
+  801554:	53                   	push   %ebx
+  801555:	83 ec 0c             	sub    $0xc,%esp
+  801558:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80155b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80155e:	85 f6                	test   %esi,%esi
+  801560:	74 30                	je     801592 <readn+0x43>
+  801562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801567:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80156c:	83 ec 04             	sub    $0x4,%esp
+  80156f:	89 f2                	mov    %esi,%edx
+  801571:	29 c2                	sub    %eax,%edx
+  801573:	52                   	push   %edx
+  801574:	01 f8                	add    %edi,%eax
+  801576:	50                   	push   %eax
+  801577:	ff 75 08             	push   0x8(%ebp)
+  80157a:	e8 2c ff ff ff       	call   8014ab <read>
+		if (m < 0)
+  80157f:	83 c4 10             	add    $0x10,%esp
+  801582:	85 c0                	test   %eax,%eax
+  801584:	78 15                	js     80159b <readn+0x4c>
+			return m;
+		if (m == 0)
+  801586:	74 11                	je     801599 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801588:	01 c3                	add    %eax,%ebx
+  80158a:	89 d8                	mov    %ebx,%eax
+  80158c:	39 f3                	cmp    %esi,%ebx
+  80158e:	72 dc                	jb     80156c <readn+0x1d>
+  801590:	eb 09                	jmp    80159b <readn+0x4c>
+  801592:	b8 00 00 00 00       	mov    $0x0,%eax
+  801597:	eb 02                	jmp    80159b <readn+0x4c>
+  801599:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80159b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159e:	5b                   	pop    %ebx
+  80159f:	5e                   	pop    %esi
+  8015a0:	5f                   	pop    %edi
+  8015a1:	5d                   	pop    %ebp
+  8015a2:	c3                   	ret
+
+008015a3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015a3:	55                   	push   %ebp
+  8015a4:	89 e5                	mov    %esp,%ebp
+  8015a6:	56                   	push   %esi
+  8015a7:	53                   	push   %ebx
+  8015a8:	83 ec 18             	sub    $0x18,%esp
+  8015ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015b1:	50                   	push   %eax
+  8015b2:	53                   	push   %ebx
+  8015b3:	e8 6f fc ff ff       	call   801227 <fd_lookup>
+  8015b8:	83 c4 10             	add    $0x10,%esp
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	78 37                	js     8015f6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015bf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015c2:	83 ec 08             	sub    $0x8,%esp
+  8015c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c8:	50                   	push   %eax
+  8015c9:	ff 36                	push   (%esi)
+  8015cb:	e8 a9 fc ff ff       	call   801279 <dev_lookup>
+  8015d0:	83 c4 10             	add    $0x10,%esp
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	78 1f                	js     8015f6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015d7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015db:	74 20                	je     8015fd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015e0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015e3:	85 c0                	test   %eax,%eax
+  8015e5:	74 54                	je     80163b <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015e7:	83 ec 04             	sub    $0x4,%esp
+  8015ea:	ff 75 10             	push   0x10(%ebp)
+  8015ed:	ff 75 0c             	push   0xc(%ebp)
+  8015f0:	56                   	push   %esi
+  8015f1:	ff d0                	call   *%eax
+  8015f3:	83 c4 10             	add    $0x10,%esp
+}
+  8015f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f9:	5b                   	pop    %ebx
+  8015fa:	5e                   	pop    %esi
+  8015fb:	5d                   	pop    %ebp
+  8015fc:	c3                   	ret
+  8015fd:	89 e2                	mov    %esp,%edx
+  8015ff:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801604:	29 d0                	sub    %edx,%eax
+  801606:	89 c2                	mov    %eax,%edx
+  801608:	c1 ea 0f             	shr    $0xf,%edx
+  80160b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801610:	b8 00 00 00 00       	mov    $0x0,%eax
+  801615:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801618:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80161f:	8b 40 48             	mov    0x48(%eax),%eax
+  801622:	83 ec 04             	sub    $0x4,%esp
+  801625:	53                   	push   %ebx
+  801626:	50                   	push   %eax
+  801627:	68 15 3f 80 00       	push   $0x803f15
+  80162c:	e8 8d eb ff ff       	call   8001be <cprintf>
+		return -E_INVAL;
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801639:	eb bb                	jmp    8015f6 <write+0x53>
+		return -E_NOT_SUPP;
+  80163b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801640:	eb b4                	jmp    8015f6 <write+0x53>
+
+00801642 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801648:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80164b:	50                   	push   %eax
+  80164c:	ff 75 08             	push   0x8(%ebp)
+  80164f:	e8 d3 fb ff ff       	call   801227 <fd_lookup>
+  801654:	83 c4 10             	add    $0x10,%esp
+  801657:	85 c0                	test   %eax,%eax
+  801659:	78 0e                	js     801669 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80165b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80165e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801661:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801664:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801669:	c9                   	leave
+  80166a:	c3                   	ret
+
+0080166b <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80166b:	55                   	push   %ebp
+  80166c:	89 e5                	mov    %esp,%ebp
+  80166e:	53                   	push   %ebx
+  80166f:	83 ec 1c             	sub    $0x1c,%esp
+  801672:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801675:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801678:	50                   	push   %eax
+  801679:	ff 75 08             	push   0x8(%ebp)
+  80167c:	e8 a6 fb ff ff       	call   801227 <fd_lookup>
+  801681:	83 c4 10             	add    $0x10,%esp
+  801684:	85 c0                	test   %eax,%eax
+  801686:	78 33                	js     8016bb <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801688:	83 fb 03             	cmp    $0x3,%ebx
+  80168b:	74 28                	je     8016b5 <fcntl+0x4a>
+  80168d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801692:	83 fb 04             	cmp    $0x4,%ebx
+  801695:	75 24                	jne    8016bb <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801697:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80169a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80169d:	80 e4 ef             	and    $0xef,%ah
+  8016a0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8016a3:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8016a9:	09 d0                	or     %edx,%eax
+  8016ab:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8016ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b3:	eb 06                	jmp    8016bb <fcntl+0x50>
+		return fd->fd_omode;
+  8016b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b8:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8016bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016be:	c9                   	leave
+  8016bf:	c3                   	ret
+
+008016c0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016c0:	55                   	push   %ebp
+  8016c1:	89 e5                	mov    %esp,%ebp
+  8016c3:	56                   	push   %esi
+  8016c4:	53                   	push   %ebx
+  8016c5:	83 ec 18             	sub    $0x18,%esp
+  8016c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016ce:	50                   	push   %eax
+  8016cf:	53                   	push   %ebx
+  8016d0:	e8 52 fb ff ff       	call   801227 <fd_lookup>
+  8016d5:	83 c4 10             	add    $0x10,%esp
+  8016d8:	85 c0                	test   %eax,%eax
+  8016da:	78 34                	js     801710 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016df:	83 ec 08             	sub    $0x8,%esp
+  8016e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e5:	50                   	push   %eax
+  8016e6:	ff 36                	push   (%esi)
+  8016e8:	e8 8c fb ff ff       	call   801279 <dev_lookup>
+  8016ed:	83 c4 10             	add    $0x10,%esp
+  8016f0:	85 c0                	test   %eax,%eax
+  8016f2:	78 1c                	js     801710 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016f4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016f8:	74 1d                	je     801717 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fd:	8b 40 18             	mov    0x18(%eax),%eax
+  801700:	85 c0                	test   %eax,%eax
+  801702:	74 51                	je     801755 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801704:	83 ec 08             	sub    $0x8,%esp
+  801707:	ff 75 0c             	push   0xc(%ebp)
+  80170a:	56                   	push   %esi
+  80170b:	ff d0                	call   *%eax
+  80170d:	83 c4 10             	add    $0x10,%esp
+}
+  801710:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801713:	5b                   	pop    %ebx
+  801714:	5e                   	pop    %esi
+  801715:	5d                   	pop    %ebp
+  801716:	c3                   	ret
+  801717:	89 e2                	mov    %esp,%edx
+  801719:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80171e:	29 d0                	sub    %edx,%eax
+  801720:	89 c2                	mov    %eax,%edx
+  801722:	c1 ea 0f             	shr    $0xf,%edx
+  801725:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80172a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172f:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801732:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801739:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80173c:	83 ec 04             	sub    $0x4,%esp
+  80173f:	53                   	push   %ebx
+  801740:	50                   	push   %eax
+  801741:	68 d8 3e 80 00       	push   $0x803ed8
+  801746:	e8 73 ea ff ff       	call   8001be <cprintf>
+		return -E_INVAL;
+  80174b:	83 c4 10             	add    $0x10,%esp
+  80174e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801753:	eb bb                	jmp    801710 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801755:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80175a:	eb b4                	jmp    801710 <ftruncate+0x50>
+
+0080175c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	56                   	push   %esi
+  801760:	53                   	push   %ebx
+  801761:	83 ec 18             	sub    $0x18,%esp
+  801764:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801767:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80176a:	50                   	push   %eax
+  80176b:	ff 75 08             	push   0x8(%ebp)
+  80176e:	e8 b4 fa ff ff       	call   801227 <fd_lookup>
+  801773:	83 c4 10             	add    $0x10,%esp
+  801776:	85 c0                	test   %eax,%eax
+  801778:	78 53                	js     8017cd <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80177a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80177d:	83 ec 08             	sub    $0x8,%esp
+  801780:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801783:	50                   	push   %eax
+  801784:	ff 36                	push   (%esi)
+  801786:	e8 ee fa ff ff       	call   801279 <dev_lookup>
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	85 c0                	test   %eax,%eax
+  801790:	78 3b                	js     8017cd <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801792:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801795:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801799:	74 39                	je     8017d4 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80179b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80179e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017a5:	00 00 00 
+	stat->st_isdir = 0;
+  8017a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017af:	00 00 00 
+	stat->st_version = 0;
+  8017b2:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8017b9:	00 00 00 
+	stat->st_dev = dev;
+  8017bc:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017c2:	83 ec 08             	sub    $0x8,%esp
+  8017c5:	53                   	push   %ebx
+  8017c6:	56                   	push   %esi
+  8017c7:	ff 50 14             	call   *0x14(%eax)
+  8017ca:	83 c4 10             	add    $0x10,%esp
+}
+  8017cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d0:	5b                   	pop    %ebx
+  8017d1:	5e                   	pop    %esi
+  8017d2:	5d                   	pop    %ebp
+  8017d3:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017d4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d9:	eb f2                	jmp    8017cd <fstat+0x71>
+
+008017db <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	56                   	push   %esi
+  8017df:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017e0:	83 ec 08             	sub    $0x8,%esp
+  8017e3:	6a 00                	push   $0x0
+  8017e5:	ff 75 08             	push   0x8(%ebp)
+  8017e8:	e8 b7 01 00 00       	call   8019a4 <open>
+  8017ed:	89 c3                	mov    %eax,%ebx
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	78 1b                	js     801811 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017f6:	83 ec 08             	sub    $0x8,%esp
+  8017f9:	ff 75 0c             	push   0xc(%ebp)
+  8017fc:	50                   	push   %eax
+  8017fd:	e8 5a ff ff ff       	call   80175c <fstat>
+  801802:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801804:	89 1c 24             	mov    %ebx,(%esp)
+  801807:	e8 60 fb ff ff       	call   80136c <close>
+	return r;
+  80180c:	83 c4 10             	add    $0x10,%esp
+  80180f:	89 f3                	mov    %esi,%ebx
+}
+  801811:	89 d8                	mov    %ebx,%eax
+  801813:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801816:	5b                   	pop    %ebx
+  801817:	5e                   	pop    %esi
+  801818:	5d                   	pop    %ebp
+  801819:	c3                   	ret
+
+0080181a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80181a:	55                   	push   %ebp
+  80181b:	89 e5                	mov    %esp,%ebp
+  80181d:	56                   	push   %esi
+  80181e:	53                   	push   %ebx
+  80181f:	89 c6                	mov    %eax,%esi
+  801821:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801823:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80182a:	74 27                	je     801853 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80182c:	6a 07                	push   $0x7
+  80182e:	68 00 70 80 00       	push   $0x807000
+  801833:	56                   	push   %esi
+  801834:	ff 35 00 60 80 00    	push   0x806000
+  80183a:	e8 1f 20 00 00       	call   80385e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80183f:	83 c4 0c             	add    $0xc,%esp
+  801842:	6a 00                	push   $0x0
+  801844:	53                   	push   %ebx
+  801845:	6a 00                	push   $0x0
+  801847:	e8 82 1d 00 00       	call   8035ce <ipc_recv>
+}
+  80184c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184f:	5b                   	pop    %ebx
+  801850:	5e                   	pop    %esi
+  801851:	5d                   	pop    %ebp
+  801852:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801853:	83 ec 0c             	sub    $0xc,%esp
+  801856:	6a 02                	push   $0x2
+  801858:	e8 6a 20 00 00       	call   8038c7 <ipc_find_env>
+  80185d:	a3 00 60 80 00       	mov    %eax,0x806000
+  801862:	83 c4 10             	add    $0x10,%esp
+  801865:	eb c5                	jmp    80182c <fsipc+0x12>
+
+00801867 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801867:	55                   	push   %ebp
+  801868:	89 e5                	mov    %esp,%ebp
+  80186a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80186d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801870:	8b 40 0c             	mov    0xc(%eax),%eax
+  801873:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801878:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80187b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801880:	ba 00 00 00 00       	mov    $0x0,%edx
+  801885:	b8 02 00 00 00       	mov    $0x2,%eax
+  80188a:	e8 8b ff ff ff       	call   80181a <fsipc>
+}
+  80188f:	c9                   	leave
+  801890:	c3                   	ret
+
+00801891 <devfile_flush>:
+{
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+  801894:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80189d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8018a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018ac:	e8 69 ff ff ff       	call   80181a <fsipc>
+}
+  8018b1:	c9                   	leave
+  8018b2:	c3                   	ret
+
+008018b3 <devfile_stat>:
+{
+  8018b3:	55                   	push   %ebp
+  8018b4:	89 e5                	mov    %esp,%ebp
+  8018b6:	53                   	push   %ebx
+  8018b7:	83 ec 04             	sub    $0x4,%esp
+  8018ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018c3:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018cd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018d2:	e8 43 ff ff ff       	call   80181a <fsipc>
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 37                	js     801912 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018db:	83 ec 08             	sub    $0x8,%esp
+  8018de:	68 00 70 80 00       	push   $0x807000
+  8018e3:	53                   	push   %ebx
+  8018e4:	e8 cc ef ff ff       	call   8008b5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8018e9:	a1 80 70 80 00       	mov    0x807080,%eax
+  8018ee:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018f4:	a1 84 70 80 00       	mov    0x807084,%eax
+  8018f9:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8018ff:	a1 88 70 80 00       	mov    0x807088,%eax
+  801904:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80190a:	83 c4 10             	add    $0x10,%esp
+  80190d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801912:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801915:	c9                   	leave
+  801916:	c3                   	ret
+
+00801917 <devfile_write>:
+{
+  801917:	55                   	push   %ebp
+  801918:	89 e5                	mov    %esp,%ebp
+  80191a:	83 ec 0c             	sub    $0xc,%esp
+  80191d:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801920:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801925:	39 d0                	cmp    %edx,%eax
+  801927:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80192a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192d:	8b 52 0c             	mov    0xc(%edx),%edx
+  801930:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801936:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  80193b:	50                   	push   %eax
+  80193c:	ff 75 0c             	push   0xc(%ebp)
+  80193f:	68 08 70 80 00       	push   $0x807008
+  801944:	e8 1c f1 ff ff       	call   800a65 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801949:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801953:	e8 c2 fe ff ff       	call   80181a <fsipc>
+}
+  801958:	c9                   	leave
+  801959:	c3                   	ret
+
+0080195a <devfile_read>:
+{
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	53                   	push   %ebx
+  80195e:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801961:	8b 45 08             	mov    0x8(%ebp),%eax
+  801964:	8b 40 0c             	mov    0xc(%eax),%eax
+  801967:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80196c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80196f:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801974:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801979:	b8 03 00 00 00       	mov    $0x3,%eax
+  80197e:	e8 97 fe ff ff       	call   80181a <fsipc>
+  801983:	89 c3                	mov    %eax,%ebx
+  801985:	85 c0                	test   %eax,%eax
+  801987:	78 14                	js     80199d <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801989:	83 ec 04             	sub    $0x4,%esp
+  80198c:	50                   	push   %eax
+  80198d:	68 00 70 80 00       	push   $0x807000
+  801992:	ff 75 0c             	push   0xc(%ebp)
+  801995:	e8 cb f0 ff ff       	call   800a65 <memmove>
+	return r;
+  80199a:	83 c4 10             	add    $0x10,%esp
+}
+  80199d:	89 d8                	mov    %ebx,%eax
+  80199f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a2:	c9                   	leave
+  8019a3:	c3                   	ret
+
+008019a4 <open>:
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	53                   	push   %ebx
+  8019a8:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8019ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ae:	50                   	push   %eax
+  8019af:	e8 23 f8 ff ff       	call   8011d7 <fd_alloc>
+  8019b4:	89 c3                	mov    %eax,%ebx
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	78 2a                	js     8019e7 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8019bd:	83 ec 0c             	sub    $0xc,%esp
+  8019c0:	ff 75 08             	push   0x8(%ebp)
+  8019c3:	e8 a1 ee ff ff       	call   800869 <strlen>
+  8019c8:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8019cb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8019d0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8019d5:	7e 17                	jle    8019ee <open+0x4a>
+	fd_close(fd, 1);
+  8019d7:	83 ec 08             	sub    $0x8,%esp
+  8019da:	6a 01                	push   $0x1
+  8019dc:	ff 75 f4             	push   -0xc(%ebp)
+  8019df:	e8 08 f9 ff ff       	call   8012ec <fd_close>
+	return r;
+  8019e4:	83 c4 10             	add    $0x10,%esp
+}
+  8019e7:	89 d8                	mov    %ebx,%eax
+  8019e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ec:	c9                   	leave
+  8019ed:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8019ee:	83 ec 08             	sub    $0x8,%esp
+  8019f1:	ff 75 08             	push   0x8(%ebp)
+  8019f4:	68 00 70 80 00       	push   $0x807000
+  8019f9:	e8 b7 ee ff ff       	call   8008b5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8019fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a01:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a06:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a09:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a0e:	e8 07 fe ff ff       	call   80181a <fsipc>
+  801a13:	89 c3                	mov    %eax,%ebx
+  801a15:	83 c4 10             	add    $0x10,%esp
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	78 bb                	js     8019d7 <open+0x33>
+	return fd2num(fd); 	
+  801a1c:	83 ec 0c             	sub    $0xc,%esp
+  801a1f:	ff 75 f4             	push   -0xc(%ebp)
+  801a22:	e8 89 f7 ff ff       	call   8011b0 <fd2num>
+  801a27:	89 c3                	mov    %eax,%ebx
+  801a29:	83 c4 10             	add    $0x10,%esp
+  801a2c:	eb b9                	jmp    8019e7 <open+0x43>
+
+00801a2e <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801a2e:	55                   	push   %ebp
+  801a2f:	89 e5                	mov    %esp,%ebp
+  801a31:	53                   	push   %ebx
+  801a32:	83 ec 1c             	sub    $0x1c,%esp
+  801a35:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a38:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3b:	50                   	push   %eax
+  801a3c:	ff 75 08             	push   0x8(%ebp)
+  801a3f:	e8 e3 f7 ff ff       	call   801227 <fd_lookup>
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	78 5a                	js     801aa5 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4e:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801a54:	39 10                	cmp    %edx,(%eax)
+  801a56:	75 66                	jne    801abe <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801a58:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801a5f:	74 49                	je     801aaa <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801a61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a64:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a67:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801a6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a6f:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801a74:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a7a:	6a 07                	push   $0x7
+  801a7c:	68 00 70 80 00       	push   $0x807000
+  801a81:	6a 09                	push   $0x9
+  801a83:	ff 35 00 60 80 00    	push   0x806000
+  801a89:	e8 d0 1d 00 00       	call   80385e <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801a8e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a95:	6a 00                	push   $0x0
+  801a97:	53                   	push   %ebx
+  801a98:	ff 75 10             	push   0x10(%ebp)
+  801a9b:	6a 00                	push   $0x0
+  801a9d:	e8 f9 1b 00 00       	call   80369b <ipc_recv_pages>
+  801aa2:	83 c4 20             	add    $0x20,%esp
+}
+  801aa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aa8:	c9                   	leave
+  801aa9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801aaa:	83 ec 0c             	sub    $0xc,%esp
+  801aad:	6a 02                	push   $0x2
+  801aaf:	e8 13 1e 00 00       	call   8038c7 <ipc_find_env>
+  801ab4:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	eb a3                	jmp    801a61 <fmap+0x33>
+		return -E_INVAL;
+  801abe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac3:	eb e0                	jmp    801aa5 <fmap+0x77>
+
+00801ac5 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	53                   	push   %ebx
+  801ac9:	83 ec 10             	sub    $0x10,%esp
+  801acc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801acf:	53                   	push   %ebx
+  801ad0:	e8 94 ed ff ff       	call   800869 <strlen>
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801add:	7f 25                	jg     801b04 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801adf:	83 ec 08             	sub    $0x8,%esp
+  801ae2:	53                   	push   %ebx
+  801ae3:	68 00 70 80 00       	push   $0x807000
+  801ae8:	e8 c8 ed ff ff       	call   8008b5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801aed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af2:	b8 07 00 00 00       	mov    $0x7,%eax
+  801af7:	e8 1e fd ff ff       	call   80181a <fsipc>
+  801afc:	83 c4 10             	add    $0x10,%esp
+}
+  801aff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b02:	c9                   	leave
+  801b03:	c3                   	ret
+		return -E_BAD_PATH;
+  801b04:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b09:	eb f4                	jmp    801aff <remove+0x3a>
+
+00801b0b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b0b:	55                   	push   %ebp
+  801b0c:	89 e5                	mov    %esp,%ebp
+  801b0e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b16:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b1b:	e8 fa fc ff ff       	call   80181a <fsipc>
+}
+  801b20:	c9                   	leave
+  801b21:	c3                   	ret
+
+00801b22 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b28:	68 48 3f 80 00       	push   $0x803f48
+  801b2d:	ff 75 0c             	push   0xc(%ebp)
+  801b30:	e8 80 ed ff ff       	call   8008b5 <strcpy>
+	return 0;
+}
+  801b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+
+00801b3c <devsock_close>:
+{
+  801b3c:	55                   	push   %ebp
+  801b3d:	89 e5                	mov    %esp,%ebp
+  801b3f:	53                   	push   %ebx
+  801b40:	83 ec 10             	sub    $0x10,%esp
+  801b43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b46:	53                   	push   %ebx
+  801b47:	e8 ba 1d 00 00       	call   803906 <pageref>
+  801b4c:	89 c2                	mov    %eax,%edx
+  801b4e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b51:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b56:	83 fa 01             	cmp    $0x1,%edx
+  801b59:	74 05                	je     801b60 <devsock_close+0x24>
+}
+  801b5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b60:	83 ec 0c             	sub    $0xc,%esp
+  801b63:	ff 73 0c             	push   0xc(%ebx)
+  801b66:	e8 b0 05 00 00       	call   80211b <nsipc_close>
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	eb eb                	jmp    801b5b <devsock_close+0x1f>
+
+00801b70 <devsock_write>:
+{
+  801b70:	55                   	push   %ebp
+  801b71:	89 e5                	mov    %esp,%ebp
+  801b73:	53                   	push   %ebx
+  801b74:	83 ec 14             	sub    $0x14,%esp
+  801b77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b7a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b7d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801b80:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801b83:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801b86:	8b 41 08             	mov    0x8(%ecx),%eax
+  801b89:	c1 f8 09             	sar    $0x9,%eax
+  801b8c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801b8f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801b95:	77 13                	ja     801baa <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801b97:	50                   	push   %eax
+  801b98:	52                   	push   %edx
+  801b99:	53                   	push   %ebx
+  801b9a:	ff 71 0c             	push   0xc(%ecx)
+  801b9d:	e8 5c 06 00 00       	call   8021fe <nsipc_send>
+  801ba2:	83 c4 10             	add    $0x10,%esp
+}
+  801ba5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba8:	c9                   	leave
+  801ba9:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801baa:	50                   	push   %eax
+  801bab:	6a 01                	push   $0x1
+  801bad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bb0:	50                   	push   %eax
+  801bb1:	ff 71 0c             	push   0xc(%ecx)
+  801bb4:	e8 a6 06 00 00       	call   80225f <nsipc_sendmsg>
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	eb e7                	jmp    801ba5 <devsock_write+0x35>
+
+00801bbe <devsock_read>:
+{
+  801bbe:	55                   	push   %ebp
+  801bbf:	89 e5                	mov    %esp,%ebp
+  801bc1:	53                   	push   %ebx
+  801bc2:	83 ec 14             	sub    $0x14,%esp
+  801bc5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bc8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bcb:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801bce:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801bd1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801bd4:	8b 41 08             	mov    0x8(%ecx),%eax
+  801bd7:	c1 f8 09             	sar    $0x9,%eax
+  801bda:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801bdd:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801be3:	77 13                	ja     801bf8 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801be5:	50                   	push   %eax
+  801be6:	52                   	push   %edx
+  801be7:	53                   	push   %ebx
+  801be8:	ff 71 0c             	push   0xc(%ecx)
+  801beb:	e8 9c 05 00 00       	call   80218c <nsipc_recv>
+  801bf0:	83 c4 10             	add    $0x10,%esp
+}
+  801bf3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801bf8:	50                   	push   %eax
+  801bf9:	6a 01                	push   $0x1
+  801bfb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bfe:	50                   	push   %eax
+  801bff:	ff 71 0c             	push   0xc(%ecx)
+  801c02:	e8 02 0a 00 00       	call   802609 <nsipc_recvmsg>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	eb e7                	jmp    801bf3 <devsock_read+0x35>
+
+00801c0c <fd2sockid>:
+{
+  801c0c:	55                   	push   %ebp
+  801c0d:	89 e5                	mov    %esp,%ebp
+  801c0f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c12:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c15:	52                   	push   %edx
+  801c16:	50                   	push   %eax
+  801c17:	e8 0b f6 ff ff       	call   801227 <fd_lookup>
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	85 c0                	test   %eax,%eax
+  801c21:	78 10                	js     801c33 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c26:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801c2c:	39 08                	cmp    %ecx,(%eax)
+  801c2e:	75 05                	jne    801c35 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c30:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c33:	c9                   	leave
+  801c34:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c35:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c3a:	eb f7                	jmp    801c33 <fd2sockid+0x27>
+
+00801c3c <sock_flags>:
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801c42:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c45:	52                   	push   %edx
+  801c46:	50                   	push   %eax
+  801c47:	e8 db f5 ff ff       	call   801227 <fd_lookup>
+  801c4c:	83 c4 10             	add    $0x10,%esp
+  801c4f:	85 c0                	test   %eax,%eax
+  801c51:	78 0e                	js     801c61 <sock_flags+0x25>
+  801c53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c56:	8b 40 08             	mov    0x8(%eax),%eax
+  801c59:	c1 e8 09             	shr    $0x9,%eax
+  801c5c:	83 e0 08             	and    $0x8,%eax
+}
+  801c5f:	c9                   	leave
+  801c60:	c3                   	ret
+		return 0;
+  801c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c66:	eb f7                	jmp    801c5f <sock_flags+0x23>
+
+00801c68 <alloc_sockfd>:
+{
+  801c68:	55                   	push   %ebp
+  801c69:	89 e5                	mov    %esp,%ebp
+  801c6b:	56                   	push   %esi
+  801c6c:	53                   	push   %ebx
+  801c6d:	83 ec 1c             	sub    $0x1c,%esp
+  801c70:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801c72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c75:	50                   	push   %eax
+  801c76:	e8 5c f5 ff ff       	call   8011d7 <fd_alloc>
+  801c7b:	89 c3                	mov    %eax,%ebx
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	78 43                	js     801cc7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801c84:	83 ec 04             	sub    $0x4,%esp
+  801c87:	68 07 04 00 00       	push   $0x407
+  801c8c:	ff 75 f4             	push   -0xc(%ebp)
+  801c8f:	6a 00                	push   $0x0
+  801c91:	e8 53 f0 ff ff       	call   800ce9 <sys_page_alloc>
+  801c96:	89 c3                	mov    %eax,%ebx
+  801c98:	83 c4 10             	add    $0x10,%esp
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	78 28                	js     801cc7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca2:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801ca8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801caa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cad:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801cb4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801cb7:	83 ec 0c             	sub    $0xc,%esp
+  801cba:	50                   	push   %eax
+  801cbb:	e8 f0 f4 ff ff       	call   8011b0 <fd2num>
+  801cc0:	89 c3                	mov    %eax,%ebx
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	eb 0c                	jmp    801cd3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801cc7:	83 ec 0c             	sub    $0xc,%esp
+  801cca:	56                   	push   %esi
+  801ccb:	e8 4b 04 00 00       	call   80211b <nsipc_close>
+		return r;
+  801cd0:	83 c4 10             	add    $0x10,%esp
+}
+  801cd3:	89 d8                	mov    %ebx,%eax
+  801cd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cd8:	5b                   	pop    %ebx
+  801cd9:	5e                   	pop    %esi
+  801cda:	5d                   	pop    %ebp
+  801cdb:	c3                   	ret
+
+00801cdc <accept>:
+{
+  801cdc:	55                   	push   %ebp
+  801cdd:	89 e5                	mov    %esp,%ebp
+  801cdf:	56                   	push   %esi
+  801ce0:	53                   	push   %ebx
+  801ce1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801ce4:	89 f0                	mov    %esi,%eax
+  801ce6:	e8 21 ff ff ff       	call   801c0c <fd2sockid>
+  801ceb:	89 c3                	mov    %eax,%ebx
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	78 24                	js     801d15 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801cf1:	89 f0                	mov    %esi,%eax
+  801cf3:	e8 44 ff ff ff       	call   801c3c <sock_flags>
+  801cf8:	50                   	push   %eax
+  801cf9:	ff 75 10             	push   0x10(%ebp)
+  801cfc:	ff 75 0c             	push   0xc(%ebp)
+  801cff:	53                   	push   %ebx
+  801d00:	e8 6b 03 00 00       	call   802070 <nsipc_accept>
+  801d05:	89 c3                	mov    %eax,%ebx
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 07                	js     801d15 <accept+0x39>
+	return alloc_sockfd(r);
+  801d0e:	e8 55 ff ff ff       	call   801c68 <alloc_sockfd>
+  801d13:	89 c3                	mov    %eax,%ebx
+}
+  801d15:	89 d8                	mov    %ebx,%eax
+  801d17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1a:	5b                   	pop    %ebx
+  801d1b:	5e                   	pop    %esi
+  801d1c:	5d                   	pop    %ebp
+  801d1d:	c3                   	ret
+
+00801d1e <bind>:
+{
+  801d1e:	55                   	push   %ebp
+  801d1f:	89 e5                	mov    %esp,%ebp
+  801d21:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d27:	e8 e0 fe ff ff       	call   801c0c <fd2sockid>
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 12                	js     801d42 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d30:	83 ec 04             	sub    $0x4,%esp
+  801d33:	ff 75 10             	push   0x10(%ebp)
+  801d36:	ff 75 0c             	push   0xc(%ebp)
+  801d39:	50                   	push   %eax
+  801d3a:	e8 85 03 00 00       	call   8020c4 <nsipc_bind>
+  801d3f:	83 c4 10             	add    $0x10,%esp
+}
+  801d42:	c9                   	leave
+  801d43:	c3                   	ret
+
+00801d44 <shutdown>:
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4d:	e8 ba fe ff ff       	call   801c0c <fd2sockid>
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 0f                	js     801d65 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d56:	83 ec 08             	sub    $0x8,%esp
+  801d59:	ff 75 0c             	push   0xc(%ebp)
+  801d5c:	50                   	push   %eax
+  801d5d:	e8 97 03 00 00       	call   8020f9 <nsipc_shutdown>
+  801d62:	83 c4 10             	add    $0x10,%esp
+}
+  801d65:	c9                   	leave
+  801d66:	c3                   	ret
+
+00801d67 <connect>:
+{
+  801d67:	55                   	push   %ebp
+  801d68:	89 e5                	mov    %esp,%ebp
+  801d6a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d70:	e8 97 fe ff ff       	call   801c0c <fd2sockid>
+  801d75:	85 c0                	test   %eax,%eax
+  801d77:	78 12                	js     801d8b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d79:	83 ec 04             	sub    $0x4,%esp
+  801d7c:	ff 75 10             	push   0x10(%ebp)
+  801d7f:	ff 75 0c             	push   0xc(%ebp)
+  801d82:	50                   	push   %eax
+  801d83:	e8 ad 03 00 00       	call   802135 <nsipc_connect>
+  801d88:	83 c4 10             	add    $0x10,%esp
+}
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+00801d8d <listen>:
+{
+  801d8d:	55                   	push   %ebp
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d96:	e8 71 fe ff ff       	call   801c0c <fd2sockid>
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 0f                	js     801dae <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d9f:	83 ec 08             	sub    $0x8,%esp
+  801da2:	ff 75 0c             	push   0xc(%ebp)
+  801da5:	50                   	push   %eax
+  801da6:	e8 bf 03 00 00       	call   80216a <nsipc_listen>
+  801dab:	83 c4 10             	add    $0x10,%esp
+}
+  801dae:	c9                   	leave
+  801daf:	c3                   	ret
+
+00801db0 <sendmsg>:
+{
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	57                   	push   %edi
+  801db4:	56                   	push   %esi
+  801db5:	53                   	push   %ebx
+  801db6:	83 ec 0c             	sub    $0xc,%esp
+  801db9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dbc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801dbf:	89 f0                	mov    %esi,%eax
+  801dc1:	e8 46 fe ff ff       	call   801c0c <fd2sockid>
+  801dc6:	89 c3                	mov    %eax,%ebx
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	78 1c                	js     801de8 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801dcc:	89 f0                	mov    %esi,%eax
+  801dce:	e8 69 fe ff ff       	call   801c3c <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801dd3:	0b 45 10             	or     0x10(%ebp),%eax
+  801dd6:	50                   	push   %eax
+  801dd7:	ff 77 0c             	push   0xc(%edi)
+  801dda:	ff 77 08             	push   0x8(%edi)
+  801ddd:	53                   	push   %ebx
+  801dde:	e8 7c 04 00 00       	call   80225f <nsipc_sendmsg>
+  801de3:	89 c3                	mov    %eax,%ebx
+  801de5:	83 c4 10             	add    $0x10,%esp
+}
+  801de8:	89 d8                	mov    %ebx,%eax
+  801dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ded:	5b                   	pop    %ebx
+  801dee:	5e                   	pop    %esi
+  801def:	5f                   	pop    %edi
+  801df0:	5d                   	pop    %ebp
+  801df1:	c3                   	ret
+
+00801df2 <recvmsg>:
+{
+  801df2:	55                   	push   %ebp
+  801df3:	89 e5                	mov    %esp,%ebp
+  801df5:	57                   	push   %edi
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 0c             	sub    $0xc,%esp
+  801dfb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801dfe:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e01:	89 f8                	mov    %edi,%eax
+  801e03:	e8 04 fe ff ff       	call   801c0c <fd2sockid>
+  801e08:	89 c3                	mov    %eax,%ebx
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 2a                	js     801e38 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801e0e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801e15:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801e1c:	89 f8                	mov    %edi,%eax
+  801e1e:	e8 19 fe ff ff       	call   801c3c <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e23:	0b 45 10             	or     0x10(%ebp),%eax
+  801e26:	50                   	push   %eax
+  801e27:	ff 76 0c             	push   0xc(%esi)
+  801e2a:	ff 76 08             	push   0x8(%esi)
+  801e2d:	53                   	push   %ebx
+  801e2e:	e8 d6 07 00 00       	call   802609 <nsipc_recvmsg>
+  801e33:	89 c3                	mov    %eax,%ebx
+  801e35:	83 c4 10             	add    $0x10,%esp
+}
+  801e38:	89 d8                	mov    %ebx,%eax
+  801e3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e3d:	5b                   	pop    %ebx
+  801e3e:	5e                   	pop    %esi
+  801e3f:	5f                   	pop    %edi
+  801e40:	5d                   	pop    %ebp
+  801e41:	c3                   	ret
+
+00801e42 <sendfile>:
+{
+  801e42:	55                   	push   %ebp
+  801e43:	89 e5                	mov    %esp,%ebp
+  801e45:	56                   	push   %esi
+  801e46:	53                   	push   %ebx
+  801e47:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e4a:	89 f0                	mov    %esi,%eax
+  801e4c:	e8 bb fd ff ff       	call   801c0c <fd2sockid>
+  801e51:	89 c3                	mov    %eax,%ebx
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	78 1f                	js     801e76 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801e57:	89 f0                	mov    %esi,%eax
+  801e59:	e8 de fd ff ff       	call   801c3c <sock_flags>
+  801e5e:	83 ec 0c             	sub    $0xc,%esp
+  801e61:	50                   	push   %eax
+  801e62:	ff 75 14             	push   0x14(%ebp)
+  801e65:	ff 75 10             	push   0x10(%ebp)
+  801e68:	ff 75 0c             	push   0xc(%ebp)
+  801e6b:	53                   	push   %ebx
+  801e6c:	e8 64 06 00 00       	call   8024d5 <nsipc_sendfile>
+  801e71:	89 c3                	mov    %eax,%ebx
+  801e73:	83 c4 20             	add    $0x20,%esp
+}
+  801e76:	89 d8                	mov    %ebx,%eax
+  801e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7b:	5b                   	pop    %ebx
+  801e7c:	5e                   	pop    %esi
+  801e7d:	5d                   	pop    %ebp
+  801e7e:	c3                   	ret
+
+00801e7f <evctl>:
+{
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	53                   	push   %ebx
+  801e83:	83 ec 04             	sub    $0x4,%esp
+  801e86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801e89:	89 d8                	mov    %ebx,%eax
+  801e8b:	e8 7c fd ff ff       	call   801c0c <fd2sockid>
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 10                	js     801ea4 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801e94:	83 ec 04             	sub    $0x4,%esp
+  801e97:	53                   	push   %ebx
+  801e98:	ff 75 0c             	push   0xc(%ebp)
+  801e9b:	50                   	push   %eax
+  801e9c:	e8 d2 0b 00 00       	call   802a73 <nsipc_evctl>
+  801ea1:	83 c4 10             	add    $0x10,%esp
+}
+  801ea4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea7:	c9                   	leave
+  801ea8:	c3                   	ret
+
+00801ea9 <evwait>:
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801eaf:	ff 75 10             	push   0x10(%ebp)
+  801eb2:	ff 75 0c             	push   0xc(%ebp)
+  801eb5:	ff 75 08             	push   0x8(%ebp)
+  801eb8:	e8 e0 0b 00 00       	call   802a9d <nsipc_evwait>
+}
+  801ebd:	c9                   	leave
+  801ebe:	c3                   	ret
+
+00801ebf <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ebf:	55                   	push   %ebp
+  801ec0:	89 e5                	mov    %esp,%ebp
+  801ec2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ec5:	ff 75 10             	push   0x10(%ebp)
+  801ec8:	ff 75 0c             	push   0xc(%ebp)
+  801ecb:	ff 75 08             	push   0x8(%ebp)
+  801ece:	e8 31 0c 00 00       	call   802b04 <nsipc_socket>
+  801ed3:	83 c4 10             	add    $0x10,%esp
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	78 05                	js     801edf <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801eda:	e8 89 fd ff ff       	call   801c68 <alloc_sockfd>
+}
+  801edf:	c9                   	leave
+  801ee0:	c3                   	ret
+
+00801ee1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ee1:	55                   	push   %ebp
+  801ee2:	89 e5                	mov    %esp,%ebp
+  801ee4:	53                   	push   %ebx
+  801ee5:	83 ec 04             	sub    $0x4,%esp
+  801ee8:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801eea:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801ef1:	74 26                	je     801f19 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ef3:	6a 07                	push   $0x7
+  801ef5:	68 00 80 80 00       	push   $0x808000
+  801efa:	53                   	push   %ebx
+  801efb:	ff 35 24 63 80 00    	push   0x806324
+  801f01:	e8 58 19 00 00       	call   80385e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f06:	83 c4 0c             	add    $0xc,%esp
+  801f09:	6a 00                	push   $0x0
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	6a 00                	push   $0x0
+  801f0f:	e8 ba 16 00 00       	call   8035ce <ipc_recv>
+}
+  801f14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f17:	c9                   	leave
+  801f18:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f19:	83 ec 0c             	sub    $0xc,%esp
+  801f1c:	6a 03                	push   $0x3
+  801f1e:	e8 a4 19 00 00       	call   8038c7 <ipc_find_env>
+  801f23:	a3 24 63 80 00       	mov    %eax,0x806324
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	eb c6                	jmp    801ef3 <nsipc+0x12>
+
+00801f2d <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	56                   	push   %esi
+  801f31:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801f32:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  801f38:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801f3d:	85 f6                	test   %esi,%esi
+  801f3f:	75 33                	jne    801f74 <nsbulk_map+0x47>
+  801f41:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801f46:	83 ec 04             	sub    $0x4,%esp
+  801f49:	6a 07                	push   $0x7
+  801f4b:	53                   	push   %ebx
+  801f4c:	6a 00                	push   $0x0
+  801f4e:	e8 96 ed ff ff       	call   800ce9 <sys_page_alloc>
+  801f53:	83 c4 10             	add    $0x10,%esp
+  801f56:	85 c0                	test   %eax,%eax
+  801f58:	78 1a                	js     801f74 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801f5a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f60:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801f66:	75 de                	jne    801f46 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801f68:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  801f6f:	00 00 00 
+	return 0;
+  801f72:	89 f0                	mov    %esi,%eax
+}
+  801f74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f77:	5b                   	pop    %ebx
+  801f78:	5e                   	pop    %esi
+  801f79:	5d                   	pop    %ebp
+  801f7a:	c3                   	ret
+
+00801f7b <nsbulk_own>:
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	57                   	push   %edi
+  801f7f:	56                   	push   %esi
+  801f80:	53                   	push   %ebx
+  801f81:	83 ec 0c             	sub    $0xc,%esp
+  801f84:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801f86:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801f89:	85 d2                	test   %edx,%edx
+  801f8b:	7f 0e                	jg     801f9b <nsbulk_own+0x20>
+	return 0;
+  801f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f92:	eb 47                	jmp    801fdb <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801f94:	83 c3 01             	add    $0x1,%ebx
+  801f97:	39 fb                	cmp    %edi,%ebx
+  801f99:	7d 3b                	jge    801fd6 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801f9b:	be 01 00 00 00       	mov    $0x1,%esi
+  801fa0:	89 d9                	mov    %ebx,%ecx
+  801fa2:	d3 e6                	shl    %cl,%esi
+  801fa4:	89 f0                	mov    %esi,%eax
+  801fa6:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  801fac:	74 e6                	je     801f94 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801fae:	83 ec 04             	sub    $0x4,%esp
+  801fb1:	6a 07                	push   $0x7
+  801fb3:	89 d8                	mov    %ebx,%eax
+  801fb5:	c1 e0 0c             	shl    $0xc,%eax
+  801fb8:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801fbd:	50                   	push   %eax
+  801fbe:	6a 00                	push   $0x0
+  801fc0:	e8 24 ed ff ff       	call   800ce9 <sys_page_alloc>
+  801fc5:	83 c4 10             	add    $0x10,%esp
+  801fc8:	85 c0                	test   %eax,%eax
+  801fca:	78 0f                	js     801fdb <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801fcc:	f7 d6                	not    %esi
+  801fce:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  801fd4:	eb be                	jmp    801f94 <nsbulk_own+0x19>
+	return 0;
+  801fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fde:	5b                   	pop    %ebx
+  801fdf:	5e                   	pop    %esi
+  801fe0:	5f                   	pop    %edi
+  801fe1:	5d                   	pop    %ebp
+  801fe2:	c3                   	ret
+
+00801fe3 <nsipc_bulk>:
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	57                   	push   %edi
+  801fe7:	56                   	push   %esi
+  801fe8:	53                   	push   %ebx
+  801fe9:	83 ec 1c             	sub    $0x1c,%esp
+  801fec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fef:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801ff1:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801ff7:	c1 fb 0c             	sar    $0xc,%ebx
+  801ffa:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  801ffd:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802004:	74 56                	je     80205c <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802006:	85 ff                	test   %edi,%edi
+  802008:	7e 24                	jle    80202e <nsipc_bulk+0x4b>
+  80200a:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802010:	74 1c                	je     80202e <nsipc_bulk+0x4b>
+  802012:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802018:	c1 e3 0c             	shl    $0xc,%ebx
+  80201b:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802020:	0f b6 10             	movzbl (%eax),%edx
+  802023:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802025:	05 00 10 00 00       	add    $0x1000,%eax
+  80202a:	39 d8                	cmp    %ebx,%eax
+  80202c:	75 f2                	jne    802020 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80202e:	83 ec 0c             	sub    $0xc,%esp
+  802031:	56                   	push   %esi
+  802032:	57                   	push   %edi
+  802033:	68 00 00 00 e0       	push   $0xe0000000
+  802038:	ff 75 e4             	push   -0x1c(%ebp)
+  80203b:	ff 35 24 63 80 00    	push   0x806324
+  802041:	e8 4c 18 00 00       	call   803892 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802046:	83 c4 1c             	add    $0x1c,%esp
+  802049:	6a 00                	push   $0x0
+  80204b:	6a 00                	push   $0x0
+  80204d:	6a 00                	push   $0x0
+  80204f:	e8 7a 15 00 00       	call   8035ce <ipc_recv>
+}
+  802054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802057:	5b                   	pop    %ebx
+  802058:	5e                   	pop    %esi
+  802059:	5f                   	pop    %edi
+  80205a:	5d                   	pop    %ebp
+  80205b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80205c:	83 ec 0c             	sub    $0xc,%esp
+  80205f:	6a 03                	push   $0x3
+  802061:	e8 61 18 00 00       	call   8038c7 <ipc_find_env>
+  802066:	a3 24 63 80 00       	mov    %eax,0x806324
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	eb 96                	jmp    802006 <nsipc_bulk+0x23>
+
+00802070 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	53                   	push   %ebx
+  802074:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802077:	8b 45 08             	mov    0x8(%ebp),%eax
+  80207a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  80207f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802082:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802087:	b8 01 00 00 00       	mov    $0x1,%eax
+  80208c:	e8 50 fe ff ff       	call   801ee1 <nsipc>
+  802091:	89 c3                	mov    %eax,%ebx
+  802093:	85 c0                	test   %eax,%eax
+  802095:	79 07                	jns    80209e <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802097:	89 d8                	mov    %ebx,%eax
+  802099:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209c:	c9                   	leave
+  80209d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80209e:	83 ec 04             	sub    $0x4,%esp
+  8020a1:	ff 35 10 80 80 00    	push   0x808010
+  8020a7:	68 00 80 80 00       	push   $0x808000
+  8020ac:	ff 75 0c             	push   0xc(%ebp)
+  8020af:	e8 b1 e9 ff ff       	call   800a65 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8020b4:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8020ba:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020bd:	89 10                	mov    %edx,(%eax)
+  8020bf:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8020c2:	eb d3                	jmp    802097 <nsipc_accept+0x27>
+
+008020c4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8020c4:	55                   	push   %ebp
+  8020c5:	89 e5                	mov    %esp,%ebp
+  8020c7:	53                   	push   %ebx
+  8020c8:	83 ec 08             	sub    $0x8,%esp
+  8020cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8020ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d1:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8020d6:	53                   	push   %ebx
+  8020d7:	ff 75 0c             	push   0xc(%ebp)
+  8020da:	68 04 80 80 00       	push   $0x808004
+  8020df:	e8 81 e9 ff ff       	call   800a65 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8020e4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8020ea:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020ef:	e8 ed fd ff ff       	call   801ee1 <nsipc>
+}
+  8020f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+
+008020f9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8020ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802102:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802107:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80210a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80210f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802114:	e8 c8 fd ff ff       	call   801ee1 <nsipc>
+}
+  802119:	c9                   	leave
+  80211a:	c3                   	ret
+
+0080211b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802121:	8b 45 08             	mov    0x8(%ebp),%eax
+  802124:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802129:	b8 04 00 00 00       	mov    $0x4,%eax
+  80212e:	e8 ae fd ff ff       	call   801ee1 <nsipc>
+}
+  802133:	c9                   	leave
+  802134:	c3                   	ret
+
+00802135 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802135:	55                   	push   %ebp
+  802136:	89 e5                	mov    %esp,%ebp
+  802138:	53                   	push   %ebx
+  802139:	83 ec 08             	sub    $0x8,%esp
+  80213c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80213f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802142:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802147:	53                   	push   %ebx
+  802148:	ff 75 0c             	push   0xc(%ebp)
+  80214b:	68 04 80 80 00       	push   $0x808004
+  802150:	e8 10 e9 ff ff       	call   800a65 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802155:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80215b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802160:	e8 7c fd ff ff       	call   801ee1 <nsipc>
+}
+  802165:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802168:	c9                   	leave
+  802169:	c3                   	ret
+
+0080216a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802170:	8b 45 08             	mov    0x8(%ebp),%eax
+  802173:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802178:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80217b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802180:	b8 06 00 00 00       	mov    $0x6,%eax
+  802185:	e8 57 fd ff ff       	call   801ee1 <nsipc>
+}
+  80218a:	c9                   	leave
+  80218b:	c3                   	ret
+
+0080218c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80218c:	55                   	push   %ebp
+  80218d:	89 e5                	mov    %esp,%ebp
+  80218f:	56                   	push   %esi
+  802190:	53                   	push   %ebx
+  802191:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802194:	8b 45 08             	mov    0x8(%ebp),%eax
+  802197:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80219c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8021a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021a5:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8021aa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021af:	e8 2d fd ff ff       	call   801ee1 <nsipc>
+  8021b4:	89 c3                	mov    %eax,%ebx
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	78 22                	js     8021dc <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8021ba:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8021bf:	39 c6                	cmp    %eax,%esi
+  8021c1:	0f 4e c6             	cmovle %esi,%eax
+  8021c4:	39 c3                	cmp    %eax,%ebx
+  8021c6:	7f 1d                	jg     8021e5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8021c8:	83 ec 04             	sub    $0x4,%esp
+  8021cb:	53                   	push   %ebx
+  8021cc:	68 00 80 80 00       	push   $0x808000
+  8021d1:	ff 75 0c             	push   0xc(%ebp)
+  8021d4:	e8 8c e8 ff ff       	call   800a65 <memmove>
+  8021d9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8021dc:	89 d8                	mov    %ebx,%eax
+  8021de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e1:	5b                   	pop    %ebx
+  8021e2:	5e                   	pop    %esi
+  8021e3:	5d                   	pop    %ebp
+  8021e4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8021e5:	68 54 3f 80 00       	push   $0x803f54
+  8021ea:	68 69 3f 80 00       	push   $0x803f69
+  8021ef:	68 b2 00 00 00       	push   $0xb2
+  8021f4:	68 7e 3f 80 00       	push   $0x803f7e
+  8021f9:	e8 8a 13 00 00       	call   803588 <_panic>
+
+008021fe <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	53                   	push   %ebx
+  802202:	83 ec 04             	sub    $0x4,%esp
+  802205:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802208:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220b:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802210:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802216:	7f 2e                	jg     802246 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802218:	83 ec 04             	sub    $0x4,%esp
+  80221b:	53                   	push   %ebx
+  80221c:	ff 75 0c             	push   0xc(%ebp)
+  80221f:	68 0c 80 80 00       	push   $0x80800c
+  802224:	e8 3c e8 ff ff       	call   800a65 <memmove>
+	nsipcbuf.send.req_size = size;
+  802229:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80222f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802232:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802237:	b8 08 00 00 00       	mov    $0x8,%eax
+  80223c:	e8 a0 fc ff ff       	call   801ee1 <nsipc>
+}
+  802241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802244:	c9                   	leave
+  802245:	c3                   	ret
+	assert(size < 1600);
+  802246:	68 8a 3f 80 00       	push   $0x803f8a
+  80224b:	68 69 3f 80 00       	push   $0x803f69
+  802250:	68 bd 00 00 00       	push   $0xbd
+  802255:	68 7e 3f 80 00       	push   $0x803f7e
+  80225a:	e8 29 13 00 00       	call   803588 <_panic>
+
+0080225f <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80225f:	55                   	push   %ebp
+  802260:	89 e5                	mov    %esp,%ebp
+  802262:	57                   	push   %edi
+  802263:	56                   	push   %esi
+  802264:	53                   	push   %ebx
+  802265:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802268:	e8 c0 fc ff ff       	call   801f2d <nsbulk_map>
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	78 55                	js     8022c6 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802271:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802278:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  80227f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802286:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802289:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80228c:	0f 8d 24 02 00 00    	jge    8024b6 <nsipc_sendmsg+0x257>
+  802292:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802295:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802298:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80229b:	89 d8                	mov    %ebx,%eax
+  80229d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022a2:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8022a4:	83 ec 0c             	sub    $0xc,%esp
+  8022a7:	68 20 60 80 00       	push   $0x806020
+  8022ac:	e8 5a 0f 00 00       	call   80320b <pgbatch_init>
+  8022b1:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8022b4:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8022b6:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8022b9:	e9 82 00 00 00       	jmp    802340 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8022be:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8022c1:	85 db                	test   %ebx,%ebx
+  8022c3:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8022c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c9:	5b                   	pop    %ebx
+  8022ca:	5e                   	pop    %esi
+  8022cb:	5f                   	pop    %edi
+  8022cc:	5d                   	pop    %ebp
+  8022cd:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8022ce:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8022d3:	29 c8                	sub    %ecx,%eax
+  8022d5:	39 d0                	cmp    %edx,%eax
+  8022d7:	0f 46 d0             	cmovbe %eax,%edx
+  8022da:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8022dc:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8022e2:	85 ff                	test   %edi,%edi
+  8022e4:	0f 49 c7             	cmovns %edi,%eax
+  8022e7:	c1 f8 0c             	sar    $0xc,%eax
+  8022ea:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022ef:	e8 87 fc ff ff       	call   801f7b <nsbulk_own>
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	0f 88 17 01 00 00    	js     802413 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8022fc:	83 ec 04             	sub    $0x4,%esp
+  8022ff:	56                   	push   %esi
+  802300:	ff 75 e0             	push   -0x20(%ebp)
+  802303:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802306:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80230b:	50                   	push   %eax
+  80230c:	e8 54 e7 ff ff       	call   800a65 <memmove>
+  802311:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802314:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802317:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80231a:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80231d:	0f 84 fd 00 00 00    	je     802420 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802323:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802326:	01 f7                	add    %esi,%edi
+  802328:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80232b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80232e:	0f 8d 01 01 00 00    	jge    802435 <nsipc_sendmsg+0x1d6>
+  802334:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80233a:	0f 8f f0 00 00 00    	jg     802430 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802340:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802343:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802346:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802349:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80234c:	89 c2                	mov    %eax,%edx
+  80234e:	03 13                	add    (%ebx),%edx
+  802350:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802353:	8b 73 04             	mov    0x4(%ebx),%esi
+  802356:	29 c6                	sub    %eax,%esi
+  802358:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  80235d:	29 f9                	sub    %edi,%ecx
+  80235f:	39 ce                	cmp    %ecx,%esi
+  802361:	89 ca                	mov    %ecx,%edx
+  802363:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802366:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802369:	89 f9                	mov    %edi,%ecx
+  80236b:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802371:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802374:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802379:	09 c8                	or     %ecx,%eax
+  80237b:	0f 85 4d ff ff ff    	jne    8022ce <nsipc_sendmsg+0x6f>
+  802381:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802387:	0f 86 41 ff ff ff    	jbe    8022ce <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80238d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802393:	85 ff                	test   %edi,%edi
+  802395:	0f 49 c7             	cmovns %edi,%eax
+  802398:	c1 f8 0c             	sar    $0xc,%eax
+  80239b:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80239d:	89 d1                	mov    %edx,%ecx
+  80239f:	c1 e9 0c             	shr    $0xc,%ecx
+  8023a2:	01 c8                	add    %ecx,%eax
+  8023a4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023a7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023aa:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8023ac:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8023af:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8023b4:	29 c8                	sub    %ecx,%eax
+  8023b6:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8023b9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8023bc:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023c3:	89 f9                	mov    %edi,%ecx
+  8023c5:	d3 e0                	shl    %cl,%eax
+  8023c7:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8023cd:	83 ec 08             	sub    $0x8,%esp
+  8023d0:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8023d2:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8023d5:	50                   	push   %eax
+  8023d6:	6a 00                	push   $0x0
+  8023d8:	56                   	push   %esi
+  8023d9:	6a 00                	push   $0x0
+  8023db:	68 20 60 80 00       	push   $0x806020
+  8023e0:	e8 e4 0e 00 00       	call   8032c9 <pgbatch_map>
+  8023e5:	83 c4 20             	add    $0x20,%esp
+  8023e8:	85 c0                	test   %eax,%eax
+  8023ea:	0f 88 ce fe ff ff    	js     8022be <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8023f0:	83 c7 01             	add    $0x1,%edi
+  8023f3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8023f9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8023fc:	39 c7                	cmp    %eax,%edi
+  8023fe:	75 be                	jne    8023be <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802400:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802403:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802406:	89 d6                	mov    %edx,%esi
+  802408:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80240e:	e9 01 ff ff ff       	jmp    802314 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802413:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802416:	85 db                	test   %ebx,%ebx
+  802418:	0f 45 c3             	cmovne %ebx,%eax
+  80241b:	e9 a6 fe ff ff       	jmp    8022c6 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802420:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802424:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80242b:	e9 f3 fe ff ff       	jmp    802323 <nsipc_sendmsg+0xc4>
+  802430:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802433:	eb 03                	jmp    802438 <nsipc_sendmsg+0x1d9>
+  802435:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802438:	83 ec 0c             	sub    $0xc,%esp
+  80243b:	68 20 60 80 00       	push   $0x806020
+  802440:	e8 d4 0d 00 00       	call   803219 <pgbatch_flush>
+  802445:	83 c4 10             	add    $0x10,%esp
+  802448:	85 c0                	test   %eax,%eax
+  80244a:	78 50                	js     80249c <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  80244c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244f:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802454:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  80245a:	89 fb                	mov    %edi,%ebx
+  80245c:	29 f3                	sub    %esi,%ebx
+  80245e:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802464:	8b 45 14             	mov    0x14(%ebp),%eax
+  802467:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  80246c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802471:	89 fa                	mov    %edi,%edx
+  802473:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802478:	e8 66 fb ff ff       	call   801fe3 <nsipc_bulk>
+  80247d:	85 c0                	test   %eax,%eax
+  80247f:	78 28                	js     8024a9 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802481:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802484:	39 c3                	cmp    %eax,%ebx
+  802486:	75 0c                	jne    802494 <nsipc_sendmsg+0x235>
+  802488:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80248b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80248e:	0f 8f f2 fd ff ff    	jg     802286 <nsipc_sendmsg+0x27>
+		sent += r;
+  802494:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802497:	e9 2a fe ff ff       	jmp    8022c6 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80249c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80249f:	85 db                	test   %ebx,%ebx
+  8024a1:	0f 45 c3             	cmovne %ebx,%eax
+  8024a4:	e9 1d fe ff ff       	jmp    8022c6 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8024a9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024ac:	85 db                	test   %ebx,%ebx
+  8024ae:	0f 45 c3             	cmovne %ebx,%eax
+  8024b1:	e9 10 fe ff ff       	jmp    8022c6 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8024b6:	83 ec 0c             	sub    $0xc,%esp
+  8024b9:	68 20 60 80 00       	push   $0x806020
+  8024be:	e8 48 0d 00 00       	call   80320b <pgbatch_init>
+  8024c3:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8024cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d0:	e9 63 ff ff ff       	jmp    802438 <nsipc_sendmsg+0x1d9>
+
+008024d5 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8024d5:	55                   	push   %ebp
+  8024d6:	89 e5                	mov    %esp,%ebp
+  8024d8:	57                   	push   %edi
+  8024d9:	56                   	push   %esi
+  8024da:	53                   	push   %ebx
+  8024db:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8024de:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  8024e5:	0f 84 c8 00 00 00    	je     8025b3 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8024eb:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8024f2:	0f 84 e4 00 00 00    	je     8025dc <nsipc_sendfile+0x107>
+{
+  8024f8:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8024fd:	89 fb                	mov    %edi,%ebx
+  8024ff:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802502:	0f 83 f0 00 00 00    	jae    8025f8 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802508:	89 fa                	mov    %edi,%edx
+  80250a:	03 55 10             	add    0x10(%ebp),%edx
+  80250d:	89 d0                	mov    %edx,%eax
+  80250f:	c1 f8 1f             	sar    $0x1f,%eax
+  802512:	c1 e8 14             	shr    $0x14,%eax
+  802515:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802518:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80251e:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802520:	6a 10                	push   $0x10
+  802522:	68 00 20 01 e0       	push   $0xe0012000
+  802527:	52                   	push   %edx
+  802528:	ff 75 0c             	push   0xc(%ebp)
+  80252b:	e8 fe f4 ff ff       	call   801a2e <fmap>
+  802530:	83 c4 10             	add    $0x10,%esp
+  802533:	85 c0                	test   %eax,%eax
+  802535:	0f 8e b8 00 00 00    	jle    8025f3 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80253b:	39 c6                	cmp    %eax,%esi
+  80253d:	0f 8d b5 00 00 00    	jge    8025f8 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802543:	29 f0                	sub    %esi,%eax
+  802545:	8b 55 14             	mov    0x14(%ebp),%edx
+  802548:	29 da                	sub    %ebx,%edx
+  80254a:	39 d0                	cmp    %edx,%eax
+  80254c:	89 d3                	mov    %edx,%ebx
+  80254e:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802551:	8b 45 08             	mov    0x8(%ebp),%eax
+  802554:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802559:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80255f:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802565:	8b 45 18             	mov    0x18(%ebp),%eax
+  802568:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80256d:	83 ec 0c             	sub    $0xc,%esp
+  802570:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802572:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802579:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80257c:	83 c0 01             	add    $0x1,%eax
+  80257f:	50                   	push   %eax
+  802580:	68 00 10 01 e0       	push   $0xe0011000
+  802585:	6a 11                	push   $0x11
+  802587:	ff 35 24 63 80 00    	push   0x806324
+  80258d:	e8 00 13 00 00       	call   803892 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802592:	83 c4 1c             	add    $0x1c,%esp
+  802595:	6a 00                	push   $0x0
+  802597:	6a 00                	push   $0x0
+  802599:	6a 00                	push   $0x0
+  80259b:	e8 2e 10 00 00       	call   8035ce <ipc_recv>
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	78 5b                	js     802602 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8025a7:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8025a9:	39 c3                	cmp    %eax,%ebx
+  8025ab:	0f 8e 4c ff ff ff    	jle    8024fd <nsipc_sendfile+0x28>
+  8025b1:	eb 45                	jmp    8025f8 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8025b3:	83 ec 04             	sub    $0x4,%esp
+  8025b6:	6a 07                	push   $0x7
+  8025b8:	68 00 10 01 e0       	push   $0xe0011000
+  8025bd:	6a 00                	push   $0x0
+  8025bf:	e8 25 e7 ff ff       	call   800ce9 <sys_page_alloc>
+  8025c4:	89 c7                	mov    %eax,%edi
+  8025c6:	83 c4 10             	add    $0x10,%esp
+  8025c9:	85 c0                	test   %eax,%eax
+  8025cb:	78 2b                	js     8025f8 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8025cd:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  8025d4:	00 00 00 
+  8025d7:	e9 0f ff ff ff       	jmp    8024eb <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8025dc:	83 ec 0c             	sub    $0xc,%esp
+  8025df:	6a 03                	push   $0x3
+  8025e1:	e8 e1 12 00 00       	call   8038c7 <ipc_find_env>
+  8025e6:	a3 24 63 80 00       	mov    %eax,0x806324
+  8025eb:	83 c4 10             	add    $0x10,%esp
+  8025ee:	e9 05 ff ff ff       	jmp    8024f8 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8025f3:	85 ff                	test   %edi,%edi
+  8025f5:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8025f8:	89 f8                	mov    %edi,%eax
+  8025fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025fd:	5b                   	pop    %ebx
+  8025fe:	5e                   	pop    %esi
+  8025ff:	5f                   	pop    %edi
+  802600:	5d                   	pop    %ebp
+  802601:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802602:	85 ff                	test   %edi,%edi
+  802604:	0f 44 f8             	cmove  %eax,%edi
+  802607:	eb ef                	jmp    8025f8 <nsipc_sendfile+0x123>
+
+00802609 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802609:	55                   	push   %ebp
+  80260a:	89 e5                	mov    %esp,%ebp
+  80260c:	57                   	push   %edi
+  80260d:	56                   	push   %esi
+  80260e:	53                   	push   %ebx
+  80260f:	83 ec 1c             	sub    $0x1c,%esp
+  802612:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802615:	e8 13 f9 ff ff       	call   801f2d <nsbulk_map>
+  80261a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80261d:	85 c0                	test   %eax,%eax
+  80261f:	0f 88 ba 00 00 00    	js     8026df <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802625:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802629:	0f 8e bb 00 00 00    	jle    8026ea <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80262f:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802634:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802639:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80263e:	89 f8                	mov    %edi,%eax
+  802640:	29 f0                	sub    %esi,%eax
+  802642:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802646:	39 c8                	cmp    %ecx,%eax
+  802648:	0f 47 c1             	cmova  %ecx,%eax
+  80264b:	01 f0                	add    %esi,%eax
+  80264d:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80264f:	83 c2 01             	add    $0x1,%edx
+  802652:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802655:	7e 07                	jle    80265e <nsipc_recvmsg+0x55>
+  802657:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80265c:	7e e0                	jle    80263e <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80265e:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802664:	c1 fa 0c             	sar    $0xc,%edx
+  802667:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266c:	e8 0a f9 ff ff       	call   801f7b <nsbulk_own>
+  802671:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802674:	85 c0                	test   %eax,%eax
+  802676:	78 67                	js     8026df <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802678:	8b 45 08             	mov    0x8(%ebp),%eax
+  80267b:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802680:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802686:	8b 45 14             	mov    0x14(%ebp),%eax
+  802689:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80268e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802693:	89 f2                	mov    %esi,%edx
+  802695:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80269a:	e8 44 f9 ff ff       	call   801fe3 <nsipc_bulk>
+  80269f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	78 39                	js     8026df <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8026a6:	39 f0                	cmp    %esi,%eax
+  8026a8:	7f 4a                	jg     8026f4 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8026aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026af:	85 c0                	test   %eax,%eax
+  8026b1:	7e 2c                	jle    8026df <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8026b3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8026b6:	29 fe                	sub    %edi,%esi
+  8026b8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026bb:	39 c6                	cmp    %eax,%esi
+  8026bd:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8026c0:	83 ec 04             	sub    $0x4,%esp
+  8026c3:	56                   	push   %esi
+  8026c4:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8026ca:	50                   	push   %eax
+  8026cb:	ff 33                	push   (%ebx)
+  8026cd:	e8 93 e3 ff ff       	call   800a65 <memmove>
+		n += m;
+  8026d2:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8026d4:	83 c3 08             	add    $0x8,%ebx
+  8026d7:	83 c4 10             	add    $0x10,%esp
+  8026da:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8026dd:	7f d4                	jg     8026b3 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8026df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e5:	5b                   	pop    %ebx
+  8026e6:	5e                   	pop    %esi
+  8026e7:	5f                   	pop    %edi
+  8026e8:	5d                   	pop    %ebp
+  8026e9:	c3                   	ret
+	int r, i, n, len = 0;
+  8026ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ef:	e9 6a ff ff ff       	jmp    80265e <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8026f4:	68 60 3f 80 00       	push   $0x803f60
+  8026f9:	68 69 3f 80 00       	push   $0x803f69
+  8026fe:	68 3b 01 00 00       	push   $0x13b
+  802703:	68 7e 3f 80 00       	push   $0x803f7e
+  802708:	e8 7b 0e 00 00       	call   803588 <_panic>
+
+0080270d <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80270d:	55                   	push   %ebp
+  80270e:	89 e5                	mov    %esp,%ebp
+  802710:	57                   	push   %edi
+  802711:	56                   	push   %esi
+  802712:	53                   	push   %ebx
+  802713:	83 ec 0c             	sub    $0xc,%esp
+  802716:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802719:	8b 75 10             	mov    0x10(%ebp),%esi
+  80271c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80271f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802722:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802727:	8b 07                	mov    (%edi),%eax
+  802729:	a3 04 80 80 00       	mov    %eax,0x808004
+  80272e:	8b 47 04             	mov    0x4(%edi),%eax
+  802731:	a3 08 80 80 00       	mov    %eax,0x808008
+  802736:	8b 47 08             	mov    0x8(%edi),%eax
+  802739:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  80273e:	8b 47 0c             	mov    0xc(%edi),%eax
+  802741:	a3 10 80 80 00       	mov    %eax,0x808010
+  802746:	8b 47 10             	mov    0x10(%edi),%eax
+  802749:	a3 14 80 80 00       	mov    %eax,0x808014
+  80274e:	8b 47 14             	mov    0x14(%edi),%eax
+  802751:	a3 18 80 80 00       	mov    %eax,0x808018
+  802756:	8b 47 18             	mov    0x18(%edi),%eax
+  802759:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  80275e:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802761:	a3 20 80 80 00       	mov    %eax,0x808020
+  802766:	8b 47 20             	mov    0x20(%edi),%eax
+  802769:	a3 24 80 80 00       	mov    %eax,0x808024
+  80276e:	8b 47 24             	mov    0x24(%edi),%eax
+  802771:	a3 28 80 80 00       	mov    %eax,0x808028
+  802776:	8b 47 28             	mov    0x28(%edi),%eax
+  802779:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80277e:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802781:	a3 30 80 80 00       	mov    %eax,0x808030
+  802786:	8b 47 30             	mov    0x30(%edi),%eax
+  802789:	a3 34 80 80 00       	mov    %eax,0x808034
+  80278e:	8b 47 34             	mov    0x34(%edi),%eax
+  802791:	a3 38 80 80 00       	mov    %eax,0x808038
+  802796:	8b 47 38             	mov    0x38(%edi),%eax
+  802799:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  80279e:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8027a1:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8027a6:	8b 06                	mov    (%esi),%eax
+  8027a8:	a3 44 80 80 00       	mov    %eax,0x808044
+  8027ad:	8b 46 04             	mov    0x4(%esi),%eax
+  8027b0:	a3 48 80 80 00       	mov    %eax,0x808048
+  8027b5:	8b 46 08             	mov    0x8(%esi),%eax
+  8027b8:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8027bd:	8b 46 0c             	mov    0xc(%esi),%eax
+  8027c0:	a3 50 80 80 00       	mov    %eax,0x808050
+  8027c5:	8b 46 10             	mov    0x10(%esi),%eax
+  8027c8:	a3 54 80 80 00       	mov    %eax,0x808054
+  8027cd:	8b 46 14             	mov    0x14(%esi),%eax
+  8027d0:	a3 58 80 80 00       	mov    %eax,0x808058
+  8027d5:	8b 46 18             	mov    0x18(%esi),%eax
+  8027d8:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8027dd:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027e0:	a3 60 80 80 00       	mov    %eax,0x808060
+  8027e5:	8b 46 20             	mov    0x20(%esi),%eax
+  8027e8:	a3 64 80 80 00       	mov    %eax,0x808064
+  8027ed:	8b 46 24             	mov    0x24(%esi),%eax
+  8027f0:	a3 68 80 80 00       	mov    %eax,0x808068
+  8027f5:	8b 46 28             	mov    0x28(%esi),%eax
+  8027f8:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8027fd:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802800:	a3 70 80 80 00       	mov    %eax,0x808070
+  802805:	8b 46 30             	mov    0x30(%esi),%eax
+  802808:	a3 74 80 80 00       	mov    %eax,0x808074
+  80280d:	8b 46 34             	mov    0x34(%esi),%eax
+  802810:	a3 78 80 80 00       	mov    %eax,0x808078
+  802815:	8b 46 38             	mov    0x38(%esi),%eax
+  802818:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  80281d:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802820:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802825:	8b 03                	mov    (%ebx),%eax
+  802827:	a3 84 80 80 00       	mov    %eax,0x808084
+  80282c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80282f:	a3 88 80 80 00       	mov    %eax,0x808088
+  802834:	8b 43 08             	mov    0x8(%ebx),%eax
+  802837:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  80283c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80283f:	a3 90 80 80 00       	mov    %eax,0x808090
+  802844:	8b 43 10             	mov    0x10(%ebx),%eax
+  802847:	a3 94 80 80 00       	mov    %eax,0x808094
+  80284c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80284f:	a3 98 80 80 00       	mov    %eax,0x808098
+  802854:	8b 43 18             	mov    0x18(%ebx),%eax
+  802857:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  80285c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80285f:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802864:	8b 43 20             	mov    0x20(%ebx),%eax
+  802867:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  80286c:	8b 43 24             	mov    0x24(%ebx),%eax
+  80286f:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802874:	8b 43 28             	mov    0x28(%ebx),%eax
+  802877:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  80287c:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  80287f:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802884:	8b 43 30             	mov    0x30(%ebx),%eax
+  802887:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  80288c:	8b 43 34             	mov    0x34(%ebx),%eax
+  80288f:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802894:	8b 43 38             	mov    0x38(%ebx),%eax
+  802897:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  80289c:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80289f:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8028a4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8028a7:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8028ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8028b1:	e8 2b f6 ff ff       	call   801ee1 <nsipc>
+  8028b6:	85 c0                	test   %eax,%eax
+  8028b8:	0f 88 ad 01 00 00    	js     802a6b <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8028be:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8028c4:	89 17                	mov    %edx,(%edi)
+  8028c6:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8028cc:	89 57 04             	mov    %edx,0x4(%edi)
+  8028cf:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8028d5:	89 57 08             	mov    %edx,0x8(%edi)
+  8028d8:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8028de:	89 57 0c             	mov    %edx,0xc(%edi)
+  8028e1:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8028e7:	89 57 10             	mov    %edx,0x10(%edi)
+  8028ea:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8028f0:	89 57 14             	mov    %edx,0x14(%edi)
+  8028f3:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8028f9:	89 57 18             	mov    %edx,0x18(%edi)
+  8028fc:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802902:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802905:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  80290b:	89 57 20             	mov    %edx,0x20(%edi)
+  80290e:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802914:	89 57 24             	mov    %edx,0x24(%edi)
+  802917:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  80291d:	89 57 28             	mov    %edx,0x28(%edi)
+  802920:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802926:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802929:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  80292f:	89 57 30             	mov    %edx,0x30(%edi)
+  802932:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802938:	89 57 34             	mov    %edx,0x34(%edi)
+  80293b:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802941:	89 57 38             	mov    %edx,0x38(%edi)
+  802944:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  80294a:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  80294d:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802953:	89 16                	mov    %edx,(%esi)
+  802955:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  80295b:	89 56 04             	mov    %edx,0x4(%esi)
+  80295e:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802964:	89 56 08             	mov    %edx,0x8(%esi)
+  802967:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  80296d:	89 56 0c             	mov    %edx,0xc(%esi)
+  802970:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802976:	89 56 10             	mov    %edx,0x10(%esi)
+  802979:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  80297f:	89 56 14             	mov    %edx,0x14(%esi)
+  802982:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802988:	89 56 18             	mov    %edx,0x18(%esi)
+  80298b:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802991:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802994:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  80299a:	89 56 20             	mov    %edx,0x20(%esi)
+  80299d:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8029a3:	89 56 24             	mov    %edx,0x24(%esi)
+  8029a6:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8029ac:	89 56 28             	mov    %edx,0x28(%esi)
+  8029af:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  8029b5:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8029b8:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8029be:	89 56 30             	mov    %edx,0x30(%esi)
+  8029c1:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8029c7:	89 56 34             	mov    %edx,0x34(%esi)
+  8029ca:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8029d0:	89 56 38             	mov    %edx,0x38(%esi)
+  8029d3:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8029d9:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  8029dc:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8029e2:	89 13                	mov    %edx,(%ebx)
+  8029e4:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  8029ea:	89 53 04             	mov    %edx,0x4(%ebx)
+  8029ed:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  8029f3:	89 53 08             	mov    %edx,0x8(%ebx)
+  8029f6:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8029fc:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8029ff:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802a05:	89 53 10             	mov    %edx,0x10(%ebx)
+  802a08:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802a0e:	89 53 14             	mov    %edx,0x14(%ebx)
+  802a11:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802a17:	89 53 18             	mov    %edx,0x18(%ebx)
+  802a1a:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802a20:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802a23:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802a29:	89 53 20             	mov    %edx,0x20(%ebx)
+  802a2c:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802a32:	89 53 24             	mov    %edx,0x24(%ebx)
+  802a35:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802a3b:	89 53 28             	mov    %edx,0x28(%ebx)
+  802a3e:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802a44:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802a47:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802a4d:	89 53 30             	mov    %edx,0x30(%ebx)
+  802a50:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802a56:	89 53 34             	mov    %edx,0x34(%ebx)
+  802a59:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802a5f:	89 53 38             	mov    %edx,0x38(%ebx)
+  802a62:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802a68:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802a6b:	83 c4 0c             	add    $0xc,%esp
+  802a6e:	5b                   	pop    %ebx
+  802a6f:	5e                   	pop    %esi
+  802a70:	5f                   	pop    %edi
+  802a71:	5d                   	pop    %ebp
+  802a72:	c3                   	ret
+
+00802a73 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802a81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a84:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802a89:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a8c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802a91:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a96:	e8 46 f4 ff ff       	call   801ee1 <nsipc>
+}
+  802a9b:	c9                   	leave
+  802a9c:	c3                   	ret
+
+00802a9d <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802a9d:	55                   	push   %ebp
+  802a9e:	89 e5                	mov    %esp,%ebp
+  802aa0:	56                   	push   %esi
+  802aa1:	53                   	push   %ebx
+  802aa2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802aa5:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802aab:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aae:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802ab3:	b8 10 00 00 00       	mov    $0x10,%eax
+  802ab8:	e8 24 f4 ff ff       	call   801ee1 <nsipc>
+  802abd:	89 c3                	mov    %eax,%ebx
+  802abf:	85 c0                	test   %eax,%eax
+  802ac1:	7e 1f                	jle    802ae2 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802ac3:	39 c6                	cmp    %eax,%esi
+  802ac5:	7c 24                	jl     802aeb <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802ac7:	83 ec 04             	sub    $0x4,%esp
+  802aca:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802ad1:	50                   	push   %eax
+  802ad2:	68 00 80 80 00       	push   $0x808000
+  802ad7:	ff 75 08             	push   0x8(%ebp)
+  802ada:	e8 86 df ff ff       	call   800a65 <memmove>
+  802adf:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802ae2:	89 d8                	mov    %ebx,%eax
+  802ae4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae7:	5b                   	pop    %ebx
+  802ae8:	5e                   	pop    %esi
+  802ae9:	5d                   	pop    %ebp
+  802aea:	c3                   	ret
+		assert(r <= max);
+  802aeb:	68 96 3f 80 00       	push   $0x803f96
+  802af0:	68 69 3f 80 00       	push   $0x803f69
+  802af5:	68 6a 01 00 00       	push   $0x16a
+  802afa:	68 7e 3f 80 00       	push   $0x803f7e
+  802aff:	e8 84 0a 00 00       	call   803588 <_panic>
+
+00802b04 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+  802b07:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b15:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b1a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b1d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b22:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b27:	e8 b5 f3 ff ff       	call   801ee1 <nsipc>
+}
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+
+00802b2e <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802b2e:	55                   	push   %ebp
+  802b2f:	89 e5                	mov    %esp,%ebp
+  802b31:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b37:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802b3c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b41:	e8 9b f3 ff ff       	call   801ee1 <nsipc>
+}
+  802b46:	c9                   	leave
+  802b47:	c3                   	ret
+
+00802b48 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802b48:	55                   	push   %ebp
+  802b49:	89 e5                	mov    %esp,%ebp
+  802b4b:	53                   	push   %ebx
+  802b4c:	83 ec 04             	sub    $0x4,%esp
+  802b4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802b52:	b8 12 00 00 00       	mov    $0x12,%eax
+  802b57:	e8 85 f3 ff ff       	call   801ee1 <nsipc>
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	78 50                	js     802bb0 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802b60:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802b66:	89 13                	mov    %edx,(%ebx)
+  802b68:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802b6e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b71:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802b77:	89 53 08             	mov    %edx,0x8(%ebx)
+  802b7a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802b80:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802b83:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b89:	89 53 10             	mov    %edx,0x10(%ebx)
+  802b8c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802b92:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b95:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802b9b:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b9e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802ba4:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802ba7:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802bad:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802bb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb3:	c9                   	leave
+  802bb4:	c3                   	ret
+
+00802bb5 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802bb5:	55                   	push   %ebp
+  802bb6:	89 e5                	mov    %esp,%ebp
+  802bb8:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bbb:	6a 03                	push   $0x3
+  802bbd:	e8 05 0d 00 00       	call   8038c7 <ipc_find_env>
+  802bc2:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bca:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802bcf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802bd4:	e8 08 f3 ff ff       	call   801ee1 <nsipc>
+  802bd9:	83 c4 10             	add    $0x10,%esp
+  802bdc:	85 c0                	test   %eax,%eax
+  802bde:	78 0a                	js     802bea <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802be0:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802be5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bea:	c9                   	leave
+  802beb:	c3                   	ret
+
+00802bec <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	57                   	push   %edi
+  802bf0:	56                   	push   %esi
+  802bf1:	53                   	push   %ebx
+  802bf2:	83 ec 1c             	sub    $0x1c,%esp
+  802bf5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802bf8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802bfb:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802c00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c05:	89 e0                	mov    %esp,%eax
+  802c07:	89 f2                	mov    %esi,%edx
+  802c09:	29 c2                	sub    %eax,%edx
+  802c0b:	89 d0                	mov    %edx,%eax
+  802c0d:	c1 e8 0f             	shr    $0xf,%eax
+  802c10:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802c16:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802c19:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802c20:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802c23:	83 ec 0c             	sub    $0xc,%esp
+  802c26:	ff 75 e0             	push   -0x20(%ebp)
+  802c29:	e8 d8 0c 00 00       	call   803906 <pageref>
+  802c2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c31:	83 c4 04             	add    $0x4,%esp
+  802c34:	ff 75 dc             	push   -0x24(%ebp)
+  802c37:	e8 ca 0c 00 00       	call   803906 <pageref>
+  802c3c:	89 e2                	mov    %esp,%edx
+  802c3e:	89 f1                	mov    %esi,%ecx
+  802c40:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802c42:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802c45:	89 ca                	mov    %ecx,%edx
+  802c47:	c1 ea 0f             	shr    $0xf,%edx
+  802c4a:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802c50:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802c53:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802c5a:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802c5d:	39 d7                	cmp    %edx,%edi
+  802c5f:	74 40                	je     802ca1 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802c61:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c64:	75 9f                	jne    802c05 <_pipeisclosed+0x19>
+  802c66:	89 e2                	mov    %esp,%edx
+  802c68:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802c6d:	29 d0                	sub    %edx,%eax
+  802c6f:	89 c2                	mov    %eax,%edx
+  802c71:	c1 ea 0f             	shr    $0xf,%edx
+  802c74:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7e:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802c81:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802c88:	8b 40 58             	mov    0x58(%eax),%eax
+  802c8b:	6a 01                	push   $0x1
+  802c8d:	50                   	push   %eax
+  802c8e:	57                   	push   %edi
+  802c8f:	68 9f 3f 80 00       	push   $0x803f9f
+  802c94:	e8 25 d5 ff ff       	call   8001be <cprintf>
+  802c99:	83 c4 10             	add    $0x10,%esp
+  802c9c:	e9 5f ff ff ff       	jmp    802c00 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802ca1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ca4:	0f 94 c0             	sete   %al
+  802ca7:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802caa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cad:	5b                   	pop    %ebx
+  802cae:	5e                   	pop    %esi
+  802caf:	5f                   	pop    %edi
+  802cb0:	5d                   	pop    %ebp
+  802cb1:	c3                   	ret
+
+00802cb2 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802cb2:	55                   	push   %ebp
+  802cb3:	89 e5                	mov    %esp,%ebp
+  802cb5:	53                   	push   %ebx
+  802cb6:	83 ec 0c             	sub    $0xc,%esp
+  802cb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802cbc:	53                   	push   %ebx
+  802cbd:	6a 00                	push   $0x0
+  802cbf:	e8 aa e0 ff ff       	call   800d6e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802cc4:	89 1c 24             	mov    %ebx,(%esp)
+  802cc7:	e8 f4 e4 ff ff       	call   8011c0 <fd2data>
+  802ccc:	83 c4 08             	add    $0x8,%esp
+  802ccf:	50                   	push   %eax
+  802cd0:	6a 00                	push   $0x0
+  802cd2:	e8 97 e0 ff ff       	call   800d6e <sys_page_unmap>
+}
+  802cd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cda:	c9                   	leave
+  802cdb:	c3                   	ret
+
+00802cdc <devpipe_read>:
+{
+  802cdc:	55                   	push   %ebp
+  802cdd:	89 e5                	mov    %esp,%ebp
+  802cdf:	57                   	push   %edi
+  802ce0:	56                   	push   %esi
+  802ce1:	53                   	push   %ebx
+  802ce2:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802ce5:	ff 75 08             	push   0x8(%ebp)
+  802ce8:	e8 d3 e4 ff ff       	call   8011c0 <fd2data>
+  802ced:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802cef:	8b 70 04             	mov    0x4(%eax),%esi
+  802cf2:	8b 00                	mov    (%eax),%eax
+  802cf4:	83 c4 10             	add    $0x10,%esp
+  802cf7:	39 f0                	cmp    %esi,%eax
+  802cf9:	75 36                	jne    802d31 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802cfb:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802cfe:	89 da                	mov    %ebx,%edx
+  802d00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d03:	e8 e4 fe ff ff       	call   802bec <_pipeisclosed>
+  802d08:	85 c0                	test   %eax,%eax
+  802d0a:	0f 85 d4 00 00 00    	jne    802de4 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802d10:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d15:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802d19:	83 ec 04             	sub    $0x4,%esp
+  802d1c:	6a ff                	push   $0xffffffff
+  802d1e:	56                   	push   %esi
+  802d1f:	57                   	push   %edi
+  802d20:	e8 c2 e3 ff ff       	call   8010e7 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d25:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d28:	8b 03                	mov    (%ebx),%eax
+  802d2a:	83 c4 10             	add    $0x10,%esp
+  802d2d:	39 c6                	cmp    %eax,%esi
+  802d2f:	74 cd                	je     802cfe <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d31:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d34:	8b 03                	mov    (%ebx),%eax
+  802d36:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802d3c:	29 c6                	sub    %eax,%esi
+  802d3e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d43:	f7 e6                	mul    %esi
+  802d45:	c1 ea 0c             	shr    $0xc,%edx
+  802d48:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802d4e:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802d50:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d53:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802d57:	8b 0b                	mov    (%ebx),%ecx
+  802d59:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d5e:	f7 e1                	mul    %ecx
+  802d60:	c1 ea 0b             	shr    $0xb,%edx
+  802d63:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802d69:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802d6b:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802d70:	29 cf                	sub    %ecx,%edi
+  802d72:	39 f7                	cmp    %esi,%edi
+  802d74:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802d77:	83 ec 04             	sub    $0x4,%esp
+  802d7a:	57                   	push   %edi
+  802d7b:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802d7f:	50                   	push   %eax
+  802d80:	ff 75 0c             	push   0xc(%ebp)
+  802d83:	e8 dd dc ff ff       	call   800a65 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802d88:	83 c4 0c             	add    $0xc,%esp
+  802d8b:	89 f0                	mov    %esi,%eax
+  802d8d:	29 f8                	sub    %edi,%eax
+  802d8f:	50                   	push   %eax
+  802d90:	8d 43 10             	lea    0x10(%ebx),%eax
+  802d93:	50                   	push   %eax
+  802d94:	89 f8                	mov    %edi,%eax
+  802d96:	03 45 0c             	add    0xc(%ebp),%eax
+  802d99:	50                   	push   %eax
+  802d9a:	e8 c6 dc ff ff       	call   800a65 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802d9f:	8b 0b                	mov    (%ebx),%ecx
+  802da1:	01 f1                	add    %esi,%ecx
+  802da3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802da8:	f7 e1                	mul    %ecx
+  802daa:	c1 ea 0c             	shr    $0xc,%edx
+  802dad:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802db3:	29 c1                	sub    %eax,%ecx
+  802db5:	89 0b                	mov    %ecx,(%ebx)
+  802db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbc:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802dc0:	83 c4 10             	add    $0x10,%esp
+  802dc3:	85 c0                	test   %eax,%eax
+  802dc5:	75 0a                	jne    802dd1 <devpipe_read+0xf5>
+	return n;
+  802dc7:	89 f0                	mov    %esi,%eax
+}
+  802dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dcc:	5b                   	pop    %ebx
+  802dcd:	5e                   	pop    %esi
+  802dce:	5f                   	pop    %edi
+  802dcf:	5d                   	pop    %ebp
+  802dd0:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802dd1:	83 ec 08             	sub    $0x8,%esp
+  802dd4:	68 00 04 00 00       	push   $0x400
+  802dd9:	53                   	push   %ebx
+  802dda:	e8 2a e3 ff ff       	call   801109 <sys_futex_wake>
+  802ddf:	83 c4 10             	add    $0x10,%esp
+  802de2:	eb e3                	jmp    802dc7 <devpipe_read+0xeb>
+			return 0;
+  802de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de9:	eb de                	jmp    802dc9 <devpipe_read+0xed>
+
+00802deb <devpipe_write>:
+{
+  802deb:	55                   	push   %ebp
+  802dec:	89 e5                	mov    %esp,%ebp
+  802dee:	57                   	push   %edi
+  802def:	56                   	push   %esi
+  802df0:	53                   	push   %ebx
+  802df1:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802df4:	ff 75 08             	push   0x8(%ebp)
+  802df7:	e8 c4 e3 ff ff       	call   8011c0 <fd2data>
+  802dfc:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802dfe:	83 c4 10             	add    $0x10,%esp
+  802e01:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e08:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802e0d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e11:	0f 84 43 01 00 00    	je     802f5a <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e17:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e1a:	8b 06                	mov    (%esi),%eax
+  802e1c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e22:	29 c1                	sub    %eax,%ecx
+  802e24:	89 c8                	mov    %ecx,%eax
+  802e26:	f7 e7                	mul    %edi
+  802e28:	c1 ea 0c             	shr    $0xc,%edx
+  802e2b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e31:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802e33:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802e39:	75 52                	jne    802e8d <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802e3b:	89 f2                	mov    %esi,%edx
+  802e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e40:	e8 a7 fd ff ff       	call   802bec <_pipeisclosed>
+  802e45:	85 c0                	test   %eax,%eax
+  802e47:	0f 85 28 01 00 00    	jne    802f75 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802e4d:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e4f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e52:	8b 06                	mov    (%esi),%eax
+  802e54:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e5a:	29 c1                	sub    %eax,%ecx
+  802e5c:	89 c8                	mov    %ecx,%eax
+  802e5e:	f7 e7                	mul    %edi
+  802e60:	c1 ea 0c             	shr    $0xc,%edx
+  802e63:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e69:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802e6b:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802e71:	75 a4                	jne    802e17 <devpipe_write+0x2c>
+  802e73:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e78:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802e7c:	83 ec 04             	sub    $0x4,%esp
+  802e7f:	6a ff                	push   $0xffffffff
+  802e81:	53                   	push   %ebx
+  802e82:	56                   	push   %esi
+  802e83:	e8 5f e2 ff ff       	call   8010e7 <sys_futex_wait>
+}
+  802e88:	83 c4 10             	add    $0x10,%esp
+  802e8b:	eb 8a                	jmp    802e17 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e8d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e90:	8b 06                	mov    (%esi),%eax
+  802e92:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e98:	29 c1                	sub    %eax,%ecx
+  802e9a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e9f:	f7 e1                	mul    %ecx
+  802ea1:	c1 ea 0c             	shr    $0xc,%edx
+  802ea4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802eaa:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802eac:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802eb1:	89 d8                	mov    %ebx,%eax
+  802eb3:	29 c8                	sub    %ecx,%eax
+  802eb5:	8b 55 10             	mov    0x10(%ebp),%edx
+  802eb8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ebb:	29 ca                	sub    %ecx,%edx
+  802ebd:	39 d0                	cmp    %edx,%eax
+  802ebf:	0f 46 d0             	cmovbe %eax,%edx
+  802ec2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802ec5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ec8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ecd:	f7 e1                	mul    %ecx
+  802ecf:	c1 ea 0b             	shr    $0xb,%edx
+  802ed2:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802ed8:	89 ca                	mov    %ecx,%edx
+  802eda:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802edc:	29 d3                	sub    %edx,%ebx
+  802ede:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ee1:	39 c3                	cmp    %eax,%ebx
+  802ee3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802ee6:	83 ec 04             	sub    $0x4,%esp
+  802ee9:	53                   	push   %ebx
+  802eea:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802eed:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802ef0:	51                   	push   %ecx
+  802ef1:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802ef5:	50                   	push   %eax
+  802ef6:	e8 6a db ff ff       	call   800a65 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802efb:	83 c4 0c             	add    $0xc,%esp
+  802efe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f01:	29 d8                	sub    %ebx,%eax
+  802f03:	50                   	push   %eax
+  802f04:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f07:	01 cb                	add    %ecx,%ebx
+  802f09:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f0c:	53                   	push   %ebx
+  802f0d:	8d 46 10             	lea    0x10(%esi),%eax
+  802f10:	50                   	push   %eax
+  802f11:	e8 4f db ff ff       	call   800a65 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802f16:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f19:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f1c:	01 c1                	add    %eax,%ecx
+  802f1e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f23:	f7 e1                	mul    %ecx
+  802f25:	c1 ea 0c             	shr    $0xc,%edx
+  802f28:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f2e:	89 ca                	mov    %ecx,%edx
+  802f30:	29 c2                	sub    %eax,%edx
+  802f32:	89 56 04             	mov    %edx,0x4(%esi)
+  802f35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3a:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802f3e:	83 c4 10             	add    $0x10,%esp
+  802f41:	85 c0                	test   %eax,%eax
+  802f43:	75 1a                	jne    802f5f <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802f45:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f48:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802f4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f4e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f51:	0f 82 c0 fe ff ff    	jb     802e17 <devpipe_write+0x2c>
+  802f57:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802f5a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f5d:	eb 1b                	jmp    802f7a <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802f5f:	83 ec 08             	sub    $0x8,%esp
+  802f62:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802f67:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802f6a:	50                   	push   %eax
+  802f6b:	e8 99 e1 ff ff       	call   801109 <sys_futex_wake>
+  802f70:	83 c4 10             	add    $0x10,%esp
+  802f73:	eb d0                	jmp    802f45 <devpipe_write+0x15a>
+				return 0;
+  802f75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f7d:	5b                   	pop    %ebx
+  802f7e:	5e                   	pop    %esi
+  802f7f:	5f                   	pop    %edi
+  802f80:	5d                   	pop    %ebp
+  802f81:	c3                   	ret
+
+00802f82 <devpipe_stat>:
+{
+  802f82:	55                   	push   %ebp
+  802f83:	89 e5                	mov    %esp,%ebp
+  802f85:	56                   	push   %esi
+  802f86:	53                   	push   %ebx
+  802f87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f8a:	83 ec 0c             	sub    $0xc,%esp
+  802f8d:	ff 75 08             	push   0x8(%ebp)
+  802f90:	e8 2b e2 ff ff       	call   8011c0 <fd2data>
+  802f95:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f97:	83 c4 08             	add    $0x8,%esp
+  802f9a:	68 b2 3f 80 00       	push   $0x803fb2
+  802f9f:	53                   	push   %ebx
+  802fa0:	e8 10 d9 ff ff       	call   8008b5 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fa5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fa8:	8b 06                	mov    (%esi),%eax
+  802faa:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fb0:	29 c1                	sub    %eax,%ecx
+  802fb2:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802fb7:	89 c8                	mov    %ecx,%eax
+  802fb9:	f7 e2                	mul    %edx
+  802fbb:	c1 ea 0c             	shr    $0xc,%edx
+  802fbe:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fc4:	29 d1                	sub    %edx,%ecx
+  802fc6:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fcc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fd3:	00 00 00 
+	stat->st_dev = &devpipe;
+  802fd6:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  802fdd:	50 80 00 
+}
+  802fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fe8:	5b                   	pop    %ebx
+  802fe9:	5e                   	pop    %esi
+  802fea:	5d                   	pop    %ebp
+  802feb:	c3                   	ret
+
+00802fec <devpipe_poll>:
+{
+  802fec:	55                   	push   %ebp
+  802fed:	89 e5                	mov    %esp,%ebp
+  802fef:	57                   	push   %edi
+  802ff0:	56                   	push   %esi
+  802ff1:	53                   	push   %ebx
+  802ff2:	83 ec 18             	sub    $0x18,%esp
+  802ff5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ff8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ffb:	57                   	push   %edi
+  802ffc:	e8 bf e1 ff ff       	call   8011c0 <fd2data>
+  803001:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803003:	83 c4 10             	add    $0x10,%esp
+  803006:	89 f3                	mov    %esi,%ebx
+  803008:	83 e3 01             	and    $0x1,%ebx
+  80300b:	75 27                	jne    803034 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80300d:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803013:	75 48                	jne    80305d <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803015:	89 ca                	mov    %ecx,%edx
+  803017:	89 f8                	mov    %edi,%eax
+  803019:	e8 ce fb ff ff       	call   802bec <_pipeisclosed>
+  80301e:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803020:	89 d8                	mov    %ebx,%eax
+  803022:	83 c8 10             	or     $0x10,%eax
+  803025:	85 d2                	test   %edx,%edx
+  803027:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80302a:	89 d8                	mov    %ebx,%eax
+  80302c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80302f:	5b                   	pop    %ebx
+  803030:	5e                   	pop    %esi
+  803031:	5f                   	pop    %edi
+  803032:	5d                   	pop    %ebp
+  803033:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803034:	8b 58 04             	mov    0x4(%eax),%ebx
+  803037:	8b 00                	mov    (%eax),%eax
+  803039:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80303f:	29 c3                	sub    %eax,%ebx
+  803041:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803046:	89 d8                	mov    %ebx,%eax
+  803048:	f7 e2                	mul    %edx
+  80304a:	c1 ea 0c             	shr    $0xc,%edx
+  80304d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803053:	39 d3                	cmp    %edx,%ebx
+  803055:	0f 95 c3             	setne  %bl
+  803058:	0f b6 db             	movzbl %bl,%ebx
+  80305b:	eb b0                	jmp    80300d <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80305d:	8b 71 04             	mov    0x4(%ecx),%esi
+  803060:	8b 01                	mov    (%ecx),%eax
+  803062:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803068:	29 c6                	sub    %eax,%esi
+  80306a:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80306f:	89 f0                	mov    %esi,%eax
+  803071:	f7 e2                	mul    %edx
+  803073:	c1 ea 0c             	shr    $0xc,%edx
+  803076:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80307c:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80307e:	89 d8                	mov    %ebx,%eax
+  803080:	83 c8 04             	or     $0x4,%eax
+  803083:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803089:	0f 42 d8             	cmovb  %eax,%ebx
+  80308c:	eb 87                	jmp    803015 <devpipe_poll+0x29>
+
+0080308e <pipe>:
+{
+  80308e:	55                   	push   %ebp
+  80308f:	89 e5                	mov    %esp,%ebp
+  803091:	56                   	push   %esi
+  803092:	53                   	push   %ebx
+  803093:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803096:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803099:	50                   	push   %eax
+  80309a:	e8 38 e1 ff ff       	call   8011d7 <fd_alloc>
+  80309f:	89 c3                	mov    %eax,%ebx
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	0f 88 23 01 00 00    	js     8031cf <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030ac:	83 ec 04             	sub    $0x4,%esp
+  8030af:	68 07 04 00 00       	push   $0x407
+  8030b4:	ff 75 f4             	push   -0xc(%ebp)
+  8030b7:	6a 00                	push   $0x0
+  8030b9:	e8 2b dc ff ff       	call   800ce9 <sys_page_alloc>
+  8030be:	89 c3                	mov    %eax,%ebx
+  8030c0:	83 c4 10             	add    $0x10,%esp
+  8030c3:	85 c0                	test   %eax,%eax
+  8030c5:	0f 88 04 01 00 00    	js     8031cf <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030cb:	83 ec 0c             	sub    $0xc,%esp
+  8030ce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030d1:	50                   	push   %eax
+  8030d2:	e8 00 e1 ff ff       	call   8011d7 <fd_alloc>
+  8030d7:	89 c3                	mov    %eax,%ebx
+  8030d9:	83 c4 10             	add    $0x10,%esp
+  8030dc:	85 c0                	test   %eax,%eax
+  8030de:	0f 88 db 00 00 00    	js     8031bf <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030e4:	83 ec 04             	sub    $0x4,%esp
+  8030e7:	68 07 04 00 00       	push   $0x407
+  8030ec:	ff 75 f0             	push   -0x10(%ebp)
+  8030ef:	6a 00                	push   $0x0
+  8030f1:	e8 f3 db ff ff       	call   800ce9 <sys_page_alloc>
+  8030f6:	89 c3                	mov    %eax,%ebx
+  8030f8:	83 c4 10             	add    $0x10,%esp
+  8030fb:	85 c0                	test   %eax,%eax
+  8030fd:	0f 88 bc 00 00 00    	js     8031bf <pipe+0x131>
+	va = fd2data(fd0);
+  803103:	83 ec 0c             	sub    $0xc,%esp
+  803106:	ff 75 f4             	push   -0xc(%ebp)
+  803109:	e8 b2 e0 ff ff       	call   8011c0 <fd2data>
+  80310e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803110:	83 c4 0c             	add    $0xc,%esp
+  803113:	68 07 04 00 00       	push   $0x407
+  803118:	50                   	push   %eax
+  803119:	6a 00                	push   $0x0
+  80311b:	e8 c9 db ff ff       	call   800ce9 <sys_page_alloc>
+  803120:	89 c3                	mov    %eax,%ebx
+  803122:	83 c4 10             	add    $0x10,%esp
+  803125:	85 c0                	test   %eax,%eax
+  803127:	0f 88 82 00 00 00    	js     8031af <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80312d:	83 ec 0c             	sub    $0xc,%esp
+  803130:	ff 75 f0             	push   -0x10(%ebp)
+  803133:	e8 88 e0 ff ff       	call   8011c0 <fd2data>
+  803138:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80313f:	50                   	push   %eax
+  803140:	6a 00                	push   $0x0
+  803142:	56                   	push   %esi
+  803143:	6a 00                	push   $0x0
+  803145:	e8 e2 db ff ff       	call   800d2c <sys_page_map>
+  80314a:	89 c3                	mov    %eax,%ebx
+  80314c:	83 c4 20             	add    $0x20,%esp
+  80314f:	85 c0                	test   %eax,%eax
+  803151:	78 4e                	js     8031a1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803153:	a1 60 50 80 00       	mov    0x805060,%eax
+  803158:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80315b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80315d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803160:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803167:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80316a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80316c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80316f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803176:	83 ec 0c             	sub    $0xc,%esp
+  803179:	ff 75 f4             	push   -0xc(%ebp)
+  80317c:	e8 2f e0 ff ff       	call   8011b0 <fd2num>
+  803181:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803184:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803186:	83 c4 04             	add    $0x4,%esp
+  803189:	ff 75 f0             	push   -0x10(%ebp)
+  80318c:	e8 1f e0 ff ff       	call   8011b0 <fd2num>
+  803191:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803194:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803197:	83 c4 10             	add    $0x10,%esp
+  80319a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80319f:	eb 2e                	jmp    8031cf <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031a1:	83 ec 08             	sub    $0x8,%esp
+  8031a4:	56                   	push   %esi
+  8031a5:	6a 00                	push   $0x0
+  8031a7:	e8 c2 db ff ff       	call   800d6e <sys_page_unmap>
+  8031ac:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031af:	83 ec 08             	sub    $0x8,%esp
+  8031b2:	ff 75 f0             	push   -0x10(%ebp)
+  8031b5:	6a 00                	push   $0x0
+  8031b7:	e8 b2 db ff ff       	call   800d6e <sys_page_unmap>
+  8031bc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031bf:	83 ec 08             	sub    $0x8,%esp
+  8031c2:	ff 75 f4             	push   -0xc(%ebp)
+  8031c5:	6a 00                	push   $0x0
+  8031c7:	e8 a2 db ff ff       	call   800d6e <sys_page_unmap>
+  8031cc:	83 c4 10             	add    $0x10,%esp
+}
+  8031cf:	89 d8                	mov    %ebx,%eax
+  8031d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031d4:	5b                   	pop    %ebx
+  8031d5:	5e                   	pop    %esi
+  8031d6:	5d                   	pop    %ebp
+  8031d7:	c3                   	ret
+
+008031d8 <pipeisclosed>:
+{
+  8031d8:	55                   	push   %ebp
+  8031d9:	89 e5                	mov    %esp,%ebp
+  8031db:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031e1:	50                   	push   %eax
+  8031e2:	ff 75 08             	push   0x8(%ebp)
+  8031e5:	e8 3d e0 ff ff       	call   801227 <fd_lookup>
+  8031ea:	83 c4 10             	add    $0x10,%esp
+  8031ed:	85 c0                	test   %eax,%eax
+  8031ef:	78 18                	js     803209 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8031f1:	83 ec 0c             	sub    $0xc,%esp
+  8031f4:	ff 75 f4             	push   -0xc(%ebp)
+  8031f7:	e8 c4 df ff ff       	call   8011c0 <fd2data>
+  8031fc:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8031fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803201:	e8 e6 f9 ff ff       	call   802bec <_pipeisclosed>
+  803206:	83 c4 10             	add    $0x10,%esp
+}
+  803209:	c9                   	leave
+  80320a:	c3                   	ret
+
+0080320b <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80320b:	55                   	push   %ebp
+  80320c:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80320e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803211:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803217:	5d                   	pop    %ebp
+  803218:	c3                   	ret
+
+00803219 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803219:	55                   	push   %ebp
+  80321a:	89 e5                	mov    %esp,%ebp
+  80321c:	53                   	push   %ebx
+  80321d:	83 ec 04             	sub    $0x4,%esp
+  803220:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803223:	8b 03                	mov    (%ebx),%eax
+  803225:	85 c0                	test   %eax,%eax
+  803227:	75 05                	jne    80322e <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803229:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80322c:	c9                   	leave
+  80322d:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80322e:	83 ec 08             	sub    $0x8,%esp
+  803231:	50                   	push   %eax
+  803232:	8d 43 04             	lea    0x4(%ebx),%eax
+  803235:	50                   	push   %eax
+  803236:	e8 83 dd ff ff       	call   800fbe <sys_page_batch>
+	pb->pb_n = 0;
+  80323b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803241:	83 c4 10             	add    $0x10,%esp
+  803244:	eb e3                	jmp    803229 <pgbatch_flush+0x10>
+
+00803246 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803246:	55                   	push   %ebp
+  803247:	89 e5                	mov    %esp,%ebp
+  803249:	56                   	push   %esi
+  80324a:	53                   	push   %ebx
+  80324b:	89 c3                	mov    %eax,%ebx
+  80324d:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80324f:	83 38 20             	cmpl   $0x20,(%eax)
+  803252:	74 2c                	je     803280 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803254:	8b 03                	mov    (%ebx),%eax
+  803256:	8d 50 01             	lea    0x1(%eax),%edx
+  803259:	89 13                	mov    %edx,(%ebx)
+  80325b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80325e:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803262:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803264:	83 ec 04             	sub    $0x4,%esp
+  803267:	6a 18                	push   $0x18
+  803269:	6a 00                	push   $0x0
+  80326b:	50                   	push   %eax
+  80326c:	e8 bf d7 ff ff       	call   800a30 <memset>
+	return 0;
+  803271:	83 c4 10             	add    $0x10,%esp
+  803274:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80327c:	5b                   	pop    %ebx
+  80327d:	5e                   	pop    %esi
+  80327e:	5d                   	pop    %ebp
+  80327f:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803280:	83 ec 0c             	sub    $0xc,%esp
+  803283:	50                   	push   %eax
+  803284:	e8 90 ff ff ff       	call   803219 <pgbatch_flush>
+  803289:	83 c4 10             	add    $0x10,%esp
+  80328c:	85 c0                	test   %eax,%eax
+  80328e:	79 c4                	jns    803254 <pgbatch_slot+0xe>
+  803290:	eb e7                	jmp    803279 <pgbatch_slot+0x33>
+
+00803292 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803292:	55                   	push   %ebp
+  803293:	89 e5                	mov    %esp,%ebp
+  803295:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803298:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80329b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329e:	e8 a3 ff ff ff       	call   803246 <pgbatch_slot>
+  8032a3:	85 c0                	test   %eax,%eax
+  8032a5:	78 20                	js     8032c7 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8032a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032aa:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8032b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032b3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032b6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032b9:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8032bc:	8b 55 14             	mov    0x14(%ebp),%edx
+  8032bf:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8032c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c7:	c9                   	leave
+  8032c8:	c3                   	ret
+
+008032c9 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8032c9:	55                   	push   %ebp
+  8032ca:	89 e5                	mov    %esp,%ebp
+  8032cc:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032cf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d5:	e8 6c ff ff ff       	call   803246 <pgbatch_slot>
+  8032da:	85 c0                	test   %eax,%eax
+  8032dc:	78 2c                	js     80330a <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8032de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e1:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8032e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032ea:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8032ed:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032f0:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8032f3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8032f6:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8032f9:	8b 55 18             	mov    0x18(%ebp),%edx
+  8032fc:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8032ff:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803302:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803305:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80330a:	c9                   	leave
+  80330b:	c3                   	ret
+
+0080330c <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80330c:	55                   	push   %ebp
+  80330d:	89 e5                	mov    %esp,%ebp
+  80330f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803312:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803315:	8b 45 08             	mov    0x8(%ebp),%eax
+  803318:	e8 29 ff ff ff       	call   803246 <pgbatch_slot>
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	78 1a                	js     80333b <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803321:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803324:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80332a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80332d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803330:	8b 55 10             	mov    0x10(%ebp),%edx
+  803333:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803336:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80333b:	c9                   	leave
+  80333c:	c3                   	ret
+
+0080333d <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80333d:	55                   	push   %ebp
+  80333e:	89 e5                	mov    %esp,%ebp
+  803340:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803343:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803346:	8b 45 08             	mov    0x8(%ebp),%eax
+  803349:	e8 f8 fe ff ff       	call   803246 <pgbatch_slot>
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	78 20                	js     803372 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803352:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803355:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80335b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80335e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803361:	8b 55 10             	mov    0x10(%ebp),%edx
+  803364:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803367:	8b 55 14             	mov    0x14(%ebp),%edx
+  80336a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80336d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803372:	c9                   	leave
+  803373:	c3                   	ret
+
+00803374 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803374:	55                   	push   %ebp
+  803375:	89 e5                	mov    %esp,%ebp
+  803377:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80337a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80337d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803380:	e8 c1 fe ff ff       	call   803246 <pgbatch_slot>
+  803385:	85 c0                	test   %eax,%eax
+  803387:	78 26                	js     8033af <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803389:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80338c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803392:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803395:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803398:	8b 55 10             	mov    0x10(%ebp),%edx
+  80339b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80339e:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033a1:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8033a4:	8b 55 18             	mov    0x18(%ebp),%edx
+  8033a7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033af:	c9                   	leave
+  8033b0:	c3                   	ret
+
+008033b1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8033b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b6:	c3                   	ret
+
+008033b7 <devcons_poll>:
+{
+  8033b7:	55                   	push   %ebp
+  8033b8:	89 e5                	mov    %esp,%ebp
+  8033ba:	53                   	push   %ebx
+  8033bb:	83 ec 04             	sub    $0x4,%esp
+  8033be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8033c1:	89 da                	mov    %ebx,%edx
+  8033c3:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8033c6:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  8033cd:	74 0c                	je     8033db <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8033cf:	89 d8                	mov    %ebx,%eax
+  8033d1:	83 e0 01             	and    $0x1,%eax
+  8033d4:	09 d0                	or     %edx,%eax
+}
+  8033d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8033db:	e8 6b d8 ff ff       	call   800c4b <sys_cgetc>
+  8033e0:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8033e5:	89 da                	mov    %ebx,%edx
+  8033e7:	83 e2 04             	and    $0x4,%edx
+  8033ea:	85 c0                	test   %eax,%eax
+  8033ec:	74 e6                	je     8033d4 <devcons_poll+0x1d>
+  8033ee:	eb df                	jmp    8033cf <devcons_poll+0x18>
+
+008033f0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8033f0:	55                   	push   %ebp
+  8033f1:	89 e5                	mov    %esp,%ebp
+  8033f3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8033f6:	68 be 3f 80 00       	push   $0x803fbe
+  8033fb:	ff 75 0c             	push   0xc(%ebp)
+  8033fe:	e8 b2 d4 ff ff       	call   8008b5 <strcpy>
+	return 0;
+}
+  803403:	b8 00 00 00 00       	mov    $0x0,%eax
+  803408:	c9                   	leave
+  803409:	c3                   	ret
+
+0080340a <devcons_write>:
+{
+  80340a:	55                   	push   %ebp
+  80340b:	89 e5                	mov    %esp,%ebp
+  80340d:	57                   	push   %edi
+  80340e:	56                   	push   %esi
+  80340f:	53                   	push   %ebx
+  803410:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803416:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803419:	85 ff                	test   %edi,%edi
+  80341b:	74 51                	je     80346e <devcons_write+0x64>
+  80341d:	be 00 00 00 00       	mov    $0x0,%esi
+  803422:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803427:	89 fb                	mov    %edi,%ebx
+  803429:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80342b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803430:	39 d3                	cmp    %edx,%ebx
+  803432:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803435:	83 ec 04             	sub    $0x4,%esp
+  803438:	53                   	push   %ebx
+  803439:	03 45 0c             	add    0xc(%ebp),%eax
+  80343c:	50                   	push   %eax
+  80343d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803443:	50                   	push   %eax
+  803444:	e8 1c d6 ff ff       	call   800a65 <memmove>
+		sys_cputs(buf, m);
+  803449:	83 c4 08             	add    $0x8,%esp
+  80344c:	53                   	push   %ebx
+  80344d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803453:	50                   	push   %eax
+  803454:	e8 d4 d7 ff ff       	call   800c2d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803459:	01 de                	add    %ebx,%esi
+  80345b:	89 f0                	mov    %esi,%eax
+  80345d:	83 c4 10             	add    $0x10,%esp
+  803460:	39 fe                	cmp    %edi,%esi
+  803462:	72 c3                	jb     803427 <devcons_write+0x1d>
+}
+  803464:	89 f0                	mov    %esi,%eax
+  803466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803469:	5b                   	pop    %ebx
+  80346a:	5e                   	pop    %esi
+  80346b:	5f                   	pop    %edi
+  80346c:	5d                   	pop    %ebp
+  80346d:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80346e:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803473:	eb ef                	jmp    803464 <devcons_write+0x5a>
+
+00803475 <devcons_read>:
+{
+  803475:	55                   	push   %ebp
+  803476:	89 e5                	mov    %esp,%ebp
+  803478:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80347b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803480:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803484:	74 36                	je     8034bc <devcons_read+0x47>
+	c = cons_peek;
+  803486:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  80348b:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  803492:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803495:	85 c0                	test   %eax,%eax
+  803497:	75 10                	jne    8034a9 <devcons_read+0x34>
+  803499:	e8 ad d7 ff ff       	call   800c4b <sys_cgetc>
+  80349e:	85 c0                	test   %eax,%eax
+  8034a0:	75 07                	jne    8034a9 <devcons_read+0x34>
+		sys_yield();
+  8034a2:	e8 23 d8 ff ff       	call   800cca <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034a7:	eb f0                	jmp    803499 <devcons_read+0x24>
+	if (c < 0)
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	78 0f                	js     8034bc <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8034ad:	83 f8 04             	cmp    $0x4,%eax
+  8034b0:	74 0c                	je     8034be <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8034b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034b5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8034b7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8034bc:	c9                   	leave
+  8034bd:	c3                   	ret
+		return 0;
+  8034be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c3:	eb f7                	jmp    8034bc <devcons_read+0x47>
+
+008034c5 <cputchar>:
+{
+  8034c5:	55                   	push   %ebp
+  8034c6:	89 e5                	mov    %esp,%ebp
+  8034c8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8034cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ce:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8034d1:	6a 01                	push   $0x1
+  8034d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034d6:	50                   	push   %eax
+  8034d7:	e8 51 d7 ff ff       	call   800c2d <sys_cputs>
+}
+  8034dc:	83 c4 10             	add    $0x10,%esp
+  8034df:	c9                   	leave
+  8034e0:	c3                   	ret
+
+008034e1 <getchar>:
+{
+  8034e1:	55                   	push   %ebp
+  8034e2:	89 e5                	mov    %esp,%ebp
+  8034e4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8034e7:	6a 01                	push   $0x1
+  8034e9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034ec:	50                   	push   %eax
+  8034ed:	6a 00                	push   $0x0
+  8034ef:	e8 b7 df ff ff       	call   8014ab <read>
+	if (r < 0)
+  8034f4:	83 c4 10             	add    $0x10,%esp
+  8034f7:	85 c0                	test   %eax,%eax
+  8034f9:	78 06                	js     803501 <getchar+0x20>
+	if (r < 1)
+  8034fb:	74 06                	je     803503 <getchar+0x22>
+	return c;
+  8034fd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803501:	c9                   	leave
+  803502:	c3                   	ret
+		return -E_EOF;
+  803503:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803508:	eb f7                	jmp    803501 <getchar+0x20>
+
+0080350a <iscons>:
+{
+  80350a:	55                   	push   %ebp
+  80350b:	89 e5                	mov    %esp,%ebp
+  80350d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803510:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803513:	50                   	push   %eax
+  803514:	ff 75 08             	push   0x8(%ebp)
+  803517:	e8 0b dd ff ff       	call   801227 <fd_lookup>
+  80351c:	83 c4 10             	add    $0x10,%esp
+  80351f:	85 c0                	test   %eax,%eax
+  803521:	78 11                	js     803534 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803523:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803526:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80352c:	39 10                	cmp    %edx,(%eax)
+  80352e:	0f 94 c0             	sete   %al
+  803531:	0f b6 c0             	movzbl %al,%eax
+}
+  803534:	c9                   	leave
+  803535:	c3                   	ret
+
+00803536 <opencons>:
+{
+  803536:	55                   	push   %ebp
+  803537:	89 e5                	mov    %esp,%ebp
+  803539:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80353c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80353f:	50                   	push   %eax
+  803540:	e8 92 dc ff ff       	call   8011d7 <fd_alloc>
+  803545:	83 c4 10             	add    $0x10,%esp
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	78 3a                	js     803586 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80354c:	83 ec 04             	sub    $0x4,%esp
+  80354f:	68 07 04 00 00       	push   $0x407
+  803554:	ff 75 f4             	push   -0xc(%ebp)
+  803557:	6a 00                	push   $0x0
+  803559:	e8 8b d7 ff ff       	call   800ce9 <sys_page_alloc>
+  80355e:	83 c4 10             	add    $0x10,%esp
+  803561:	85 c0                	test   %eax,%eax
+  803563:	78 21                	js     803586 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803565:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803568:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80356e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803570:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803573:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80357a:	83 ec 0c             	sub    $0xc,%esp
+  80357d:	50                   	push   %eax
+  80357e:	e8 2d dc ff ff       	call   8011b0 <fd2num>
+  803583:	83 c4 10             	add    $0x10,%esp
+}
+  803586:	c9                   	leave
+  803587:	c3                   	ret
+
+00803588 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803588:	55                   	push   %ebp
+  803589:	89 e5                	mov    %esp,%ebp
+  80358b:	56                   	push   %esi
+  80358c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80358d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803590:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803596:	e8 10 d7 ff ff       	call   800cab <sys_getenvid>
+  80359b:	83 ec 0c             	sub    $0xc,%esp
+  80359e:	ff 75 0c             	push   0xc(%ebp)
+  8035a1:	ff 75 08             	push   0x8(%ebp)
+  8035a4:	56                   	push   %esi
+  8035a5:	50                   	push   %eax
+  8035a6:	68 cc 3f 80 00       	push   $0x803fcc
+  8035ab:	e8 0e cc ff ff       	call   8001be <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8035b0:	83 c4 18             	add    $0x18,%esp
+  8035b3:	53                   	push   %ebx
+  8035b4:	ff 75 10             	push   0x10(%ebp)
+  8035b7:	e8 b1 cb ff ff       	call   80016d <vcprintf>
+	cprintf("\n");
+  8035bc:	c7 04 24 b0 3f 80 00 	movl   $0x803fb0,(%esp)
+  8035c3:	e8 f6 cb ff ff       	call   8001be <cprintf>
+  8035c8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8035cb:	cc                   	int3
+	while (1)
+  8035cc:	eb fd                	jmp    8035cb <_panic+0x43>
+
+008035ce <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035ce:	55                   	push   %ebp
+  8035cf:	89 e5                	mov    %esp,%ebp
+  8035d1:	56                   	push   %esi
+  8035d2:	53                   	push   %ebx
+  8035d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8035dc:	85 c0                	test   %eax,%eax
+  8035de:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8035e3:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8035e6:	83 ec 0c             	sub    $0xc,%esp
+  8035e9:	50                   	push   %eax
+  8035ea:	e8 aa d8 ff ff       	call   800e99 <sys_ipc_recv>
+  8035ef:	83 c4 10             	add    $0x10,%esp
+  8035f2:	85 c0                	test   %eax,%eax
+  8035f4:	0f 88 8b 00 00 00    	js     803685 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8035fa:	85 f6                	test   %esi,%esi
+  8035fc:	74 2a                	je     803628 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8035fe:	89 e2                	mov    %esp,%edx
+  803600:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803605:	29 d0                	sub    %edx,%eax
+  803607:	89 c2                	mov    %eax,%edx
+  803609:	c1 ea 0f             	shr    $0xf,%edx
+  80360c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803611:	b8 00 00 00 00       	mov    $0x0,%eax
+  803616:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803619:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803620:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803626:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803628:	85 db                	test   %ebx,%ebx
+  80362a:	74 2a                	je     803656 <ipc_recv+0x88>
+  80362c:	89 e2                	mov    %esp,%edx
+  80362e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803633:	29 d0                	sub    %edx,%eax
+  803635:	89 c2                	mov    %eax,%edx
+  803637:	c1 ea 0f             	shr    $0xf,%edx
+  80363a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80363f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803644:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803647:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80364e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803654:	89 03                	mov    %eax,(%ebx)
+  803656:	89 e2                	mov    %esp,%edx
+  803658:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80365d:	29 d0                	sub    %edx,%eax
+  80365f:	89 c2                	mov    %eax,%edx
+  803661:	c1 ea 0f             	shr    $0xf,%edx
+  803664:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366e:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803671:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803678:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80367e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803681:	5b                   	pop    %ebx
+  803682:	5e                   	pop    %esi
+  803683:	5d                   	pop    %ebp
+  803684:	c3                   	ret
+		if(from_env_store != NULL)
+  803685:	85 f6                	test   %esi,%esi
+  803687:	74 06                	je     80368f <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803689:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80368f:	85 db                	test   %ebx,%ebx
+  803691:	74 eb                	je     80367e <ipc_recv+0xb0>
+			*perm_store = 0;
+  803693:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803699:	eb e3                	jmp    80367e <ipc_recv+0xb0>
+
+0080369b <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80369b:	55                   	push   %ebp
+  80369c:	89 e5                	mov    %esp,%ebp
+  80369e:	57                   	push   %edi
+  80369f:	56                   	push   %esi
+  8036a0:	53                   	push   %ebx
+  8036a1:	83 ec 14             	sub    $0x14,%esp
+  8036a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036aa:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036ad:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036b7:	0f 44 c2             	cmove  %edx,%eax
+  8036ba:	ff 75 10             	push   0x10(%ebp)
+  8036bd:	50                   	push   %eax
+  8036be:	e8 38 d8 ff ff       	call   800efb <sys_ipc_recv_pages>
+  8036c3:	83 c4 10             	add    $0x10,%esp
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	0f 88 ba 00 00 00    	js     803788 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8036ce:	85 ff                	test   %edi,%edi
+  8036d0:	74 2a                	je     8036fc <ipc_recv_pages+0x61>
+  8036d2:	89 e2                	mov    %esp,%edx
+  8036d4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036d9:	29 d0                	sub    %edx,%eax
+  8036db:	89 c2                	mov    %eax,%edx
+  8036dd:	c1 ea 0f             	shr    $0xf,%edx
+  8036e0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ea:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8036ed:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8036f4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8036fa:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8036fc:	85 f6                	test   %esi,%esi
+  8036fe:	74 2a                	je     80372a <ipc_recv_pages+0x8f>
+  803700:	89 e2                	mov    %esp,%edx
+  803702:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803707:	29 d0                	sub    %edx,%eax
+  803709:	89 c2                	mov    %eax,%edx
+  80370b:	c1 ea 0f             	shr    $0xf,%edx
+  80370e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803713:	b8 00 00 00 00       	mov    $0x0,%eax
+  803718:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80371b:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803722:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803728:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80372a:	85 db                	test   %ebx,%ebx
+  80372c:	74 2a                	je     803758 <ipc_recv_pages+0xbd>
+  80372e:	89 e2                	mov    %esp,%edx
+  803730:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803735:	29 d0                	sub    %edx,%eax
+  803737:	89 c2                	mov    %eax,%edx
+  803739:	c1 ea 0f             	shr    $0xf,%edx
+  80373c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803741:	b8 00 00 00 00       	mov    $0x0,%eax
+  803746:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803749:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803750:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803756:	89 03                	mov    %eax,(%ebx)
+  803758:	89 e2                	mov    %esp,%edx
+  80375a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80375f:	29 d0                	sub    %edx,%eax
+  803761:	89 c2                	mov    %eax,%edx
+  803763:	c1 ea 0f             	shr    $0xf,%edx
+  803766:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80376b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803770:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803773:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80377a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803783:	5b                   	pop    %ebx
+  803784:	5e                   	pop    %esi
+  803785:	5f                   	pop    %edi
+  803786:	5d                   	pop    %ebp
+  803787:	c3                   	ret
+		if (from_env_store)
+  803788:	85 ff                	test   %edi,%edi
+  80378a:	74 06                	je     803792 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80378c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803792:	85 f6                	test   %esi,%esi
+  803794:	74 06                	je     80379c <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803796:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80379c:	85 db                	test   %ebx,%ebx
+  80379e:	74 e0                	je     803780 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8037a0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037a6:	eb d8                	jmp    803780 <ipc_recv_pages+0xe5>
+
+008037a8 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8037a8:	55                   	push   %ebp
+  8037a9:	89 e5                	mov    %esp,%ebp
+  8037ab:	57                   	push   %edi
+  8037ac:	56                   	push   %esi
+  8037ad:	53                   	push   %ebx
+  8037ae:	83 ec 1c             	sub    $0x1c,%esp
+  8037b1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8037b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037b7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037bd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8037c1:	75 2b                	jne    8037ee <ipc_try_send_pages+0x46>
+  8037c3:	89 e2                	mov    %esp,%edx
+  8037c5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037ca:	29 d0                	sub    %edx,%eax
+  8037cc:	89 c2                	mov    %eax,%edx
+  8037ce:	c1 ea 0f             	shr    $0xf,%edx
+  8037d1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037db:	0f 42 c2             	cmovb  %edx,%eax
+  8037de:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037e5:	8b 70 48             	mov    0x48(%eax),%esi
+  8037e8:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037ee:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8037f4:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8037f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037fc:	85 ff                	test   %edi,%edi
+  8037fe:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803803:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803806:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80380c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803812:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803818:	83 ec 0c             	sub    $0xc,%esp
+  80381b:	ff 75 14             	push   0x14(%ebp)
+  80381e:	ff 75 18             	push   0x18(%ebp)
+  803821:	57                   	push   %edi
+  803822:	ff 75 0c             	push   0xc(%ebp)
+  803825:	ff 75 08             	push   0x8(%ebp)
+  803828:	e8 ad d6 ff ff       	call   800eda <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80382d:	83 c4 20             	add    $0x20,%esp
+  803830:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803833:	75 21                	jne    803856 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803835:	83 ec 04             	sub    $0x4,%esp
+  803838:	6a ff                	push   $0xffffffff
+  80383a:	53                   	push   %ebx
+  80383b:	ff 75 e4             	push   -0x1c(%ebp)
+  80383e:	e8 a4 d8 ff ff       	call   8010e7 <sys_futex_wait>
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803849:	74 c7                	je     803812 <ipc_try_send_pages+0x6a>
+  80384b:	85 c0                	test   %eax,%eax
+  80384d:	79 c3                	jns    803812 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80384f:	e8 76 d4 ff ff       	call   800cca <sys_yield>
+  803854:	eb bc                	jmp    803812 <ipc_try_send_pages+0x6a>
+	}
+}
+  803856:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803859:	5b                   	pop    %ebx
+  80385a:	5e                   	pop    %esi
+  80385b:	5f                   	pop    %edi
+  80385c:	5d                   	pop    %ebp
+  80385d:	c3                   	ret
+
+0080385e <ipc_send>:
+{
+  80385e:	55                   	push   %ebp
+  80385f:	89 e5                	mov    %esp,%ebp
+  803861:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803864:	ff 75 14             	push   0x14(%ebp)
+  803867:	6a 01                	push   $0x1
+  803869:	ff 75 10             	push   0x10(%ebp)
+  80386c:	ff 75 0c             	push   0xc(%ebp)
+  80386f:	ff 75 08             	push   0x8(%ebp)
+  803872:	e8 31 ff ff ff       	call   8037a8 <ipc_try_send_pages>
+  803877:	83 c4 20             	add    $0x20,%esp
+  80387a:	85 c0                	test   %eax,%eax
+  80387c:	78 02                	js     803880 <ipc_send+0x22>
+}
+  80387e:	c9                   	leave
+  80387f:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803880:	50                   	push   %eax
+  803881:	68 ef 3f 80 00       	push   $0x803fef
+  803886:	6a 3f                	push   $0x3f
+  803888:	68 04 40 80 00       	push   $0x804004
+  80388d:	e8 f6 fc ff ff       	call   803588 <_panic>
+
+00803892 <ipc_send_pages>:
+{
+  803892:	55                   	push   %ebp
+  803893:	89 e5                	mov    %esp,%ebp
+  803895:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803898:	ff 75 18             	push   0x18(%ebp)
+  80389b:	ff 75 14             	push   0x14(%ebp)
+  80389e:	ff 75 10             	push   0x10(%ebp)
+  8038a1:	ff 75 0c             	push   0xc(%ebp)
+  8038a4:	ff 75 08             	push   0x8(%ebp)
+  8038a7:	e8 fc fe ff ff       	call   8037a8 <ipc_try_send_pages>
+  8038ac:	83 c4 20             	add    $0x20,%esp
+  8038af:	85 c0                	test   %eax,%eax
+  8038b1:	78 02                	js     8038b5 <ipc_send_pages+0x23>
+}
+  8038b3:	c9                   	leave
+  8038b4:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8038b5:	50                   	push   %eax
+  8038b6:	68 0e 40 80 00       	push   $0x80400e
+  8038bb:	6a 64                	push   $0x64
+  8038bd:	68 04 40 80 00       	push   $0x804004
+  8038c2:	e8 c1 fc ff ff       	call   803588 <_panic>
+
+008038c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8038c7:	55                   	push   %ebp
+  8038c8:	89 e5                	mov    %esp,%ebp
+  8038ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8038cd:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038d2:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8038d8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038de:	8b 52 50             	mov    0x50(%edx),%edx
+  8038e1:	39 ca                	cmp    %ecx,%edx
+  8038e3:	74 11                	je     8038f6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038e5:	83 c0 01             	add    $0x1,%eax
+  8038e8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038ed:	75 e3                	jne    8038d2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f4:	eb 0e                	jmp    803904 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8038f6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8038fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803901:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803904:	5d                   	pop    %ebp
+  803905:	c3                   	ret
+
+00803906 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803906:	55                   	push   %ebp
+  803907:	89 e5                	mov    %esp,%ebp
+  803909:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80390c:	89 c2                	mov    %eax,%edx
+  80390e:	c1 ea 16             	shr    $0x16,%edx
+  803911:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803918:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80391d:	f6 c1 01             	test   $0x1,%cl
+  803920:	74 1e                	je     803940 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803922:	c1 e8 0c             	shr    $0xc,%eax
+  803925:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80392c:	a8 01                	test   $0x1,%al
+  80392e:	74 10                	je     803940 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803930:	c1 e8 0c             	shr    $0xc,%eax
+  803933:	c1 e0 04             	shl    $0x4,%eax
+  803936:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80393d:	0f b7 d2             	movzwl %dx,%edx
+}
+  803940:	89 d0                	mov    %edx,%eax
+  803942:	5d                   	pop    %ebp
+  803943:	c3                   	ret
+
+00803944 <__udivdi3>:
+  803944:	57                   	push   %edi
+  803945:	56                   	push   %esi
+  803946:	53                   	push   %ebx
+  803947:	83 ec 20             	sub    $0x20,%esp
+  80394a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80394e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803952:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803956:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80395a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80395e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803962:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803966:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80396a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80396f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803974:	ba 00 00 00 00       	mov    $0x0,%edx
+  803979:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803980:	00 
+  803981:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803988:	00 
+  803989:	eb 08                	jmp    803993 <__udivdi3+0x4f>
+  80398b:	83 e9 01             	sub    $0x1,%ecx
+  80398e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803991:	74 68                	je     8039fb <__udivdi3+0xb7>
+  803993:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803997:	01 c0                	add    %eax,%eax
+  803999:	89 c6                	mov    %eax,%esi
+  80399b:	89 d7                	mov    %edx,%edi
+  80399d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039a1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039a5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039a8:	d3 ea                	shr    %cl,%edx
+  8039aa:	f6 c1 20             	test   $0x20,%cl
+  8039ad:	74 04                	je     8039b3 <__udivdi3+0x6f>
+  8039af:	89 d0                	mov    %edx,%eax
+  8039b1:	31 d2                	xor    %edx,%edx
+  8039b3:	83 e0 01             	and    $0x1,%eax
+  8039b6:	89 04 24             	mov    %eax,(%esp)
+  8039b9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8039c0:	00 
+  8039c1:	8b 04 24             	mov    (%esp),%eax
+  8039c4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039c8:	09 f0                	or     %esi,%eax
+  8039ca:	09 fa                	or     %edi,%edx
+  8039cc:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039d0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039d4:	39 f0                	cmp    %esi,%eax
+  8039d6:	89 d3                	mov    %edx,%ebx
+  8039d8:	19 fb                	sbb    %edi,%ebx
+  8039da:	72 af                	jb     80398b <__udivdi3+0x47>
+  8039dc:	29 f0                	sub    %esi,%eax
+  8039de:	19 fa                	sbb    %edi,%edx
+  8039e0:	89 cf                	mov    %ecx,%edi
+  8039e2:	c1 ef 05             	shr    $0x5,%edi
+  8039e5:	83 e7 01             	and    $0x1,%edi
+  8039e8:	89 fe                	mov    %edi,%esi
+  8039ea:	83 f6 01             	xor    $0x1,%esi
+  8039ed:	d3 e6                	shl    %cl,%esi
+  8039ef:	d3 e7                	shl    %cl,%edi
+  8039f1:	09 74 24 18          	or     %esi,0x18(%esp)
+  8039f5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8039f9:	eb 90                	jmp    80398b <__udivdi3+0x47>
+  8039fb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039ff:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a03:	83 c4 20             	add    $0x20,%esp
+  803a06:	5b                   	pop    %ebx
+  803a07:	5e                   	pop    %esi
+  803a08:	5f                   	pop    %edi
+  803a09:	c3                   	ret
+
+00803a0a <__umoddi3>:
+  803a0a:	57                   	push   %edi
+  803a0b:	56                   	push   %esi
+  803a0c:	53                   	push   %ebx
+  803a0d:	83 ec 08             	sub    $0x8,%esp
+  803a10:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a14:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a18:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a1c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a20:	57                   	push   %edi
+  803a21:	56                   	push   %esi
+  803a22:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a26:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a2a:	52                   	push   %edx
+  803a2b:	50                   	push   %eax
+  803a2c:	e8 13 ff ff ff       	call   803944 <__udivdi3>
+  803a31:	89 c3                	mov    %eax,%ebx
+  803a33:	0f af d6             	imul   %esi,%edx
+  803a36:	89 f9                	mov    %edi,%ecx
+  803a38:	0f af cb             	imul   %ebx,%ecx
+  803a3b:	01 d1                	add    %edx,%ecx
+  803a3d:	89 d8                	mov    %ebx,%eax
+  803a3f:	f7 e6                	mul    %esi
+  803a41:	89 c6                	mov    %eax,%esi
+  803a43:	89 d7                	mov    %edx,%edi
+  803a45:	01 cf                	add    %ecx,%edi
+  803a47:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a4b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a4f:	29 f0                	sub    %esi,%eax
+  803a51:	19 fa                	sbb    %edi,%edx
+  803a53:	83 c4 18             	add    $0x18,%esp
+  803a56:	5b                   	pop    %ebx
+  803a57:	5e                   	pop    %esi
+  803a58:	5f                   	pop    %edi
+  803a59:	c3                   	ret
+
+00803a5a <__divdi3>:
+  803a5a:	53                   	push   %ebx
+  803a5b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a5f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a63:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a67:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a6b:	85 d2                	test   %edx,%edx
+  803a6d:	78 12                	js     803a81 <__divdi3+0x27>
+  803a6f:	85 db                	test   %ebx,%ebx
+  803a71:	78 2e                	js     803aa1 <__divdi3+0x47>
+  803a73:	53                   	push   %ebx
+  803a74:	51                   	push   %ecx
+  803a75:	52                   	push   %edx
+  803a76:	50                   	push   %eax
+  803a77:	e8 c8 fe ff ff       	call   803944 <__udivdi3>
+  803a7c:	83 c4 10             	add    $0x10,%esp
+  803a7f:	eb 1e                	jmp    803a9f <__divdi3+0x45>
+  803a81:	f7 d8                	neg    %eax
+  803a83:	83 d2 00             	adc    $0x0,%edx
+  803a86:	f7 da                	neg    %edx
+  803a88:	85 db                	test   %ebx,%ebx
+  803a8a:	78 2a                	js     803ab6 <__divdi3+0x5c>
+  803a8c:	53                   	push   %ebx
+  803a8d:	51                   	push   %ecx
+  803a8e:	52                   	push   %edx
+  803a8f:	50                   	push   %eax
+  803a90:	e8 af fe ff ff       	call   803944 <__udivdi3>
+  803a95:	83 c4 10             	add    $0x10,%esp
+  803a98:	f7 d8                	neg    %eax
+  803a9a:	83 d2 00             	adc    $0x0,%edx
+  803a9d:	f7 da                	neg    %edx
+  803a9f:	5b                   	pop    %ebx
+  803aa0:	c3                   	ret
+  803aa1:	f7 d9                	neg    %ecx
+  803aa3:	83 d3 00             	adc    $0x0,%ebx
+  803aa6:	f7 db                	neg    %ebx
+  803aa8:	53                   	push   %ebx
+  803aa9:	51                   	push   %ecx
+  803aaa:	52                   	push   %edx
+  803aab:	50                   	push   %eax
+  803aac:	e8 93 fe ff ff       	call   803944 <__udivdi3>
+  803ab1:	83 c4 10             	add    $0x10,%esp
+  803ab4:	eb e2                	jmp    803a98 <__divdi3+0x3e>
+  803ab6:	f7 d9                	neg    %ecx
+  803ab8:	83 d3 00             	adc    $0x0,%ebx
+  803abb:	f7 db                	neg    %ebx
+  803abd:	53                   	push   %ebx
+  803abe:	51                   	push   %ecx
+  803abf:	52                   	push   %edx
+  803ac0:	50                   	push   %eax
+  803ac1:	e8 7e fe ff ff       	call   803944 <__udivdi3>
+  803ac6:	83 c4 10             	add    $0x10,%esp
+  803ac9:	eb d4                	jmp    803a9f <__divdi3+0x45>
+
+00803acb <__moddi3>:
+  803acb:	57                   	push   %edi
+  803acc:	56                   	push   %esi
+  803acd:	53                   	push   %ebx
+  803ace:	83 ec 08             	sub    $0x8,%esp
+  803ad1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ad5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ad9:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803add:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803ae1:	57                   	push   %edi
+  803ae2:	56                   	push   %esi
+  803ae3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803ae7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803aeb:	52                   	push   %edx
+  803aec:	50                   	push   %eax
+  803aed:	e8 68 ff ff ff       	call   803a5a <__divdi3>
+  803af2:	89 c3                	mov    %eax,%ebx
+  803af4:	0f af d6             	imul   %esi,%edx
+  803af7:	89 f9                	mov    %edi,%ecx
+  803af9:	0f af cb             	imul   %ebx,%ecx
+  803afc:	01 d1                	add    %edx,%ecx
+  803afe:	89 d8                	mov    %ebx,%eax
+  803b00:	f7 e6                	mul    %esi
+  803b02:	89 c6                	mov    %eax,%esi
+  803b04:	89 d7                	mov    %edx,%edi
+  803b06:	01 cf                	add    %ecx,%edi
+  803b08:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b0c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b10:	29 f0                	sub    %esi,%eax
+  803b12:	19 fa                	sbb    %edi,%edx
+  803b14:	83 c4 18             	add    $0x18,%esp
+  803b17:	5b                   	pop    %ebx
+  803b18:	5e                   	pop    %esi
+  803b19:	5f                   	pop    %edi
+  803b1a:	c3                   	ret
@@ -0,0 +1,7959 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 25 00 00 00       	call   800056 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  80003b:	68 1c 06 80 00       	push   $0x80061c
+  800040:	6a 00                	push   $0x0
+  800042:	e8 bd 02 00 00       	call   800304 <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800047:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004e:	00 00 00 
+}
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	c9                   	leave
+  800055:	c3                   	ret
+
+00800056 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800056:	55                   	push   %ebp
+  800057:	89 e5                	mov    %esp,%ebp
+  800059:	56                   	push   %esi
+  80005a:	53                   	push   %ebx
+  80005b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800061:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800063:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800068:	29 d0                	sub    %edx,%eax
+  80006a:	89 c2                	mov    %eax,%edx
+  80006c:	c1 ea 0f             	shr    $0xf,%edx
+  80006f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800074:	b8 00 00 00 00       	mov    $0x0,%eax
+  800079:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80007c:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800083:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800087:	e8 ef 00 00 00       	call   80017b <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80008c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800091:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800097:	89 e1                	mov    %esp,%ecx
+  800099:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80009e:	29 ca                	sub    %ecx,%edx
+  8000a0:	89 d1                	mov    %edx,%ecx
+  8000a2:	c1 e9 0f             	shr    $0xf,%ecx
+  8000a5:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	0f 42 d1             	cmovb  %ecx,%edx
+  8000b3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b8:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x74>
+		binaryname = argv[0];
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 61 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e9:	e8 3d 07 00 00       	call   80082b <close_all>
+	sys_env_destroy(0);
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	e8 42 00 00 00       	call   80013a <sys_env_destroy>
+}
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	c9                   	leave
+  8000fc:	c3                   	ret
+
+008000fd <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	57                   	push   %edi
+  800101:	56                   	push   %esi
+  800102:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800103:	b8 00 00 00 00       	mov    $0x0,%eax
+  800108:	8b 55 08             	mov    0x8(%ebp),%edx
+  80010b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80010e:	89 c3                	mov    %eax,%ebx
+  800110:	89 c7                	mov    %eax,%edi
+  800112:	89 c6                	mov    %eax,%esi
+  800114:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800116:	5b                   	pop    %ebx
+  800117:	5e                   	pop    %esi
+  800118:	5f                   	pop    %edi
+  800119:	5d                   	pop    %ebp
+  80011a:	c3                   	ret
+
+0080011b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80011b:	55                   	push   %ebp
+  80011c:	89 e5                	mov    %esp,%ebp
+  80011e:	57                   	push   %edi
+  80011f:	56                   	push   %esi
+  800120:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800121:	ba 00 00 00 00       	mov    $0x0,%edx
+  800126:	b8 01 00 00 00       	mov    $0x1,%eax
+  80012b:	89 d1                	mov    %edx,%ecx
+  80012d:	89 d3                	mov    %edx,%ebx
+  80012f:	89 d7                	mov    %edx,%edi
+  800131:	89 d6                	mov    %edx,%esi
+  800133:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800135:	5b                   	pop    %ebx
+  800136:	5e                   	pop    %esi
+  800137:	5f                   	pop    %edi
+  800138:	5d                   	pop    %ebp
+  800139:	c3                   	ret
+
+0080013a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80013a:	55                   	push   %ebp
+  80013b:	89 e5                	mov    %esp,%ebp
+  80013d:	57                   	push   %edi
+  80013e:	56                   	push   %esi
+  80013f:	53                   	push   %ebx
+  800140:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800143:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800148:	8b 55 08             	mov    0x8(%ebp),%edx
+  80014b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800150:	89 cb                	mov    %ecx,%ebx
+  800152:	89 cf                	mov    %ecx,%edi
+  800154:	89 ce                	mov    %ecx,%esi
+  800156:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800158:	85 c0                	test   %eax,%eax
+  80015a:	7f 08                	jg     800164 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80015c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80015f:	5b                   	pop    %ebx
+  800160:	5e                   	pop    %esi
+  800161:	5f                   	pop    %edi
+  800162:	5d                   	pop    %ebp
+  800163:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	6a 03                	push   $0x3
+  80016a:	68 0a 3b 80 00       	push   $0x803b0a
+  80016f:	6a 23                	push   $0x23
+  800171:	68 27 3b 80 00       	push   $0x803b27
+  800176:	e8 9f 28 00 00       	call   802a1a <_panic>
+
+0080017b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	56                   	push   %esi
+  800180:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800181:	ba 00 00 00 00       	mov    $0x0,%edx
+  800186:	b8 02 00 00 00       	mov    $0x2,%eax
+  80018b:	89 d1                	mov    %edx,%ecx
+  80018d:	89 d3                	mov    %edx,%ebx
+  80018f:	89 d7                	mov    %edx,%edi
+  800191:	89 d6                	mov    %edx,%esi
+  800193:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800195:	5b                   	pop    %ebx
+  800196:	5e                   	pop    %esi
+  800197:	5f                   	pop    %edi
+  800198:	5d                   	pop    %ebp
+  800199:	c3                   	ret
+
+0080019a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80019a:	55                   	push   %ebp
+  80019b:	89 e5                	mov    %esp,%ebp
+  80019d:	57                   	push   %edi
+  80019e:	56                   	push   %esi
+  80019f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8001a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001aa:	89 d1                	mov    %edx,%ecx
+  8001ac:	89 d3                	mov    %edx,%ebx
+  8001ae:	89 d7                	mov    %edx,%edi
+  8001b0:	89 d6                	mov    %edx,%esi
+  8001b2:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001b4:	5b                   	pop    %ebx
+  8001b5:	5e                   	pop    %esi
+  8001b6:	5f                   	pop    %edi
+  8001b7:	5d                   	pop    %ebp
+  8001b8:	c3                   	ret
+
+008001b9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001b9:	55                   	push   %ebp
+  8001ba:	89 e5                	mov    %esp,%ebp
+  8001bc:	57                   	push   %edi
+  8001bd:	56                   	push   %esi
+  8001be:	53                   	push   %ebx
+  8001bf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001cd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001d5:	89 f7                	mov    %esi,%edi
+  8001d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001d9:	85 c0                	test   %eax,%eax
+  8001db:	7f 08                	jg     8001e5 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e0:	5b                   	pop    %ebx
+  8001e1:	5e                   	pop    %esi
+  8001e2:	5f                   	pop    %edi
+  8001e3:	5d                   	pop    %ebp
+  8001e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001e5:	83 ec 0c             	sub    $0xc,%esp
+  8001e8:	50                   	push   %eax
+  8001e9:	6a 04                	push   $0x4
+  8001eb:	68 0a 3b 80 00       	push   $0x803b0a
+  8001f0:	6a 23                	push   $0x23
+  8001f2:	68 27 3b 80 00       	push   $0x803b27
+  8001f7:	e8 1e 28 00 00       	call   802a1a <_panic>
+
+008001fc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001fc:	55                   	push   %ebp
+  8001fd:	89 e5                	mov    %esp,%ebp
+  8001ff:	57                   	push   %edi
+  800200:	56                   	push   %esi
+  800201:	53                   	push   %ebx
+  800202:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800205:	8b 55 08             	mov    0x8(%ebp),%edx
+  800208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80020b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800210:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800213:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800216:	8b 75 18             	mov    0x18(%ebp),%esi
+  800219:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	7f 08                	jg     800227 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80021f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800222:	5b                   	pop    %ebx
+  800223:	5e                   	pop    %esi
+  800224:	5f                   	pop    %edi
+  800225:	5d                   	pop    %ebp
+  800226:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800227:	83 ec 0c             	sub    $0xc,%esp
+  80022a:	50                   	push   %eax
+  80022b:	6a 05                	push   $0x5
+  80022d:	68 0a 3b 80 00       	push   $0x803b0a
+  800232:	6a 23                	push   $0x23
+  800234:	68 27 3b 80 00       	push   $0x803b27
+  800239:	e8 dc 27 00 00       	call   802a1a <_panic>
+
+0080023e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80023e:	55                   	push   %ebp
+  80023f:	89 e5                	mov    %esp,%ebp
+  800241:	57                   	push   %edi
+  800242:	56                   	push   %esi
+  800243:	53                   	push   %ebx
+  800244:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80024c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80024f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800252:	b8 06 00 00 00       	mov    $0x6,%eax
+  800257:	89 df                	mov    %ebx,%edi
+  800259:	89 de                	mov    %ebx,%esi
+  80025b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80025d:	85 c0                	test   %eax,%eax
+  80025f:	7f 08                	jg     800269 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800264:	5b                   	pop    %ebx
+  800265:	5e                   	pop    %esi
+  800266:	5f                   	pop    %edi
+  800267:	5d                   	pop    %ebp
+  800268:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800269:	83 ec 0c             	sub    $0xc,%esp
+  80026c:	50                   	push   %eax
+  80026d:	6a 06                	push   $0x6
+  80026f:	68 0a 3b 80 00       	push   $0x803b0a
+  800274:	6a 23                	push   $0x23
+  800276:	68 27 3b 80 00       	push   $0x803b27
+  80027b:	e8 9a 27 00 00       	call   802a1a <_panic>
+
+00800280 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	57                   	push   %edi
+  800284:	56                   	push   %esi
+  800285:	53                   	push   %ebx
+  800286:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800289:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80028e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800291:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800294:	b8 08 00 00 00       	mov    $0x8,%eax
+  800299:	89 df                	mov    %ebx,%edi
+  80029b:	89 de                	mov    %ebx,%esi
+  80029d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80029f:	85 c0                	test   %eax,%eax
+  8002a1:	7f 08                	jg     8002ab <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a6:	5b                   	pop    %ebx
+  8002a7:	5e                   	pop    %esi
+  8002a8:	5f                   	pop    %edi
+  8002a9:	5d                   	pop    %ebp
+  8002aa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ab:	83 ec 0c             	sub    $0xc,%esp
+  8002ae:	50                   	push   %eax
+  8002af:	6a 08                	push   $0x8
+  8002b1:	68 0a 3b 80 00       	push   $0x803b0a
+  8002b6:	6a 23                	push   $0x23
+  8002b8:	68 27 3b 80 00       	push   $0x803b27
+  8002bd:	e8 58 27 00 00       	call   802a1a <_panic>
+
+008002c2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002c2:	55                   	push   %ebp
+  8002c3:	89 e5                	mov    %esp,%ebp
+  8002c5:	57                   	push   %edi
+  8002c6:	56                   	push   %esi
+  8002c7:	53                   	push   %ebx
+  8002c8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002db:	89 df                	mov    %ebx,%edi
+  8002dd:	89 de                	mov    %ebx,%esi
+  8002df:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002e1:	85 c0                	test   %eax,%eax
+  8002e3:	7f 08                	jg     8002ed <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e8:	5b                   	pop    %ebx
+  8002e9:	5e                   	pop    %esi
+  8002ea:	5f                   	pop    %edi
+  8002eb:	5d                   	pop    %ebp
+  8002ec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ed:	83 ec 0c             	sub    $0xc,%esp
+  8002f0:	50                   	push   %eax
+  8002f1:	6a 09                	push   $0x9
+  8002f3:	68 0a 3b 80 00       	push   $0x803b0a
+  8002f8:	6a 23                	push   $0x23
+  8002fa:	68 27 3b 80 00       	push   $0x803b27
+  8002ff:	e8 16 27 00 00       	call   802a1a <_panic>
+
+00800304 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	57                   	push   %edi
+  800308:	56                   	push   %esi
+  800309:	53                   	push   %ebx
+  80030a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80030d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800312:	8b 55 08             	mov    0x8(%ebp),%edx
+  800315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800318:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80031d:	89 df                	mov    %ebx,%edi
+  80031f:	89 de                	mov    %ebx,%esi
+  800321:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800323:	85 c0                	test   %eax,%eax
+  800325:	7f 08                	jg     80032f <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80032f:	83 ec 0c             	sub    $0xc,%esp
+  800332:	50                   	push   %eax
+  800333:	6a 0a                	push   $0xa
+  800335:	68 0a 3b 80 00       	push   $0x803b0a
+  80033a:	6a 23                	push   $0x23
+  80033c:	68 27 3b 80 00       	push   $0x803b27
+  800341:	e8 d4 26 00 00       	call   802a1a <_panic>
+
+00800346 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800346:	55                   	push   %ebp
+  800347:	89 e5                	mov    %esp,%ebp
+  800349:	57                   	push   %edi
+  80034a:	56                   	push   %esi
+  80034b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80034c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800352:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800357:	be 00 00 00 00       	mov    $0x0,%esi
+  80035c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80035f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800362:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800364:	5b                   	pop    %ebx
+  800365:	5e                   	pop    %esi
+  800366:	5f                   	pop    %edi
+  800367:	5d                   	pop    %ebp
+  800368:	c3                   	ret
+
+00800369 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800369:	55                   	push   %ebp
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	57                   	push   %edi
+  80036d:	56                   	push   %esi
+  80036e:	53                   	push   %ebx
+  80036f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800372:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800377:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80037f:	89 cb                	mov    %ecx,%ebx
+  800381:	89 cf                	mov    %ecx,%edi
+  800383:	89 ce                	mov    %ecx,%esi
+  800385:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800387:	85 c0                	test   %eax,%eax
+  800389:	7f 08                	jg     800393 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80038b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038e:	5b                   	pop    %ebx
+  80038f:	5e                   	pop    %esi
+  800390:	5f                   	pop    %edi
+  800391:	5d                   	pop    %ebp
+  800392:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800393:	83 ec 0c             	sub    $0xc,%esp
+  800396:	50                   	push   %eax
+  800397:	6a 0d                	push   $0xd
+  800399:	68 0a 3b 80 00       	push   $0x803b0a
+  80039e:	6a 23                	push   $0x23
+  8003a0:	68 27 3b 80 00       	push   $0x803b27
+  8003a5:	e8 70 26 00 00       	call   802a1a <_panic>
+
+008003aa <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	57                   	push   %edi
+  8003ae:	56                   	push   %esi
+  8003af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003be:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003c1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003c4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003c6:	5b                   	pop    %ebx
+  8003c7:	5e                   	pop    %esi
+  8003c8:	5f                   	pop    %edi
+  8003c9:	5d                   	pop    %ebp
+  8003ca:	c3                   	ret
+
+008003cb <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003cb:	55                   	push   %ebp
+  8003cc:	89 e5                	mov    %esp,%ebp
+  8003ce:	57                   	push   %edi
+  8003cf:	56                   	push   %esi
+  8003d0:	53                   	push   %ebx
+  8003d1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003df:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003e4:	89 df                	mov    %ebx,%edi
+  8003e6:	89 de                	mov    %ebx,%esi
+  8003e8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003ea:	85 c0                	test   %eax,%eax
+  8003ec:	7f 08                	jg     8003f6 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f1:	5b                   	pop    %ebx
+  8003f2:	5e                   	pop    %esi
+  8003f3:	5f                   	pop    %edi
+  8003f4:	5d                   	pop    %ebp
+  8003f5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003f6:	83 ec 0c             	sub    $0xc,%esp
+  8003f9:	50                   	push   %eax
+  8003fa:	6a 0d                	push   $0xd
+  8003fc:	68 0a 3b 80 00       	push   $0x803b0a
+  800401:	6a 23                	push   $0x23
+  800403:	68 27 3b 80 00       	push   $0x803b27
+  800408:	e8 0d 26 00 00       	call   802a1a <_panic>
+
+0080040d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	57                   	push   %edi
+  800411:	56                   	push   %esi
+  800412:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800413:	ba 00 00 00 00       	mov    $0x0,%edx
+  800418:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80041d:	89 d1                	mov    %edx,%ecx
+  80041f:	89 d3                	mov    %edx,%ebx
+  800421:	89 d7                	mov    %edx,%edi
+  800423:	89 d6                	mov    %edx,%esi
+  800425:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800427:	5b                   	pop    %ebx
+  800428:	5e                   	pop    %esi
+  800429:	5f                   	pop    %edi
+  80042a:	5d                   	pop    %ebp
+  80042b:	c3                   	ret
+
+0080042c <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800432:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800437:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800442:	89 df                	mov    %ebx,%edi
+  800444:	89 de                	mov    %ebx,%esi
+  800446:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800448:	5b                   	pop    %ebx
+  800449:	5e                   	pop    %esi
+  80044a:	5f                   	pop    %edi
+  80044b:	5d                   	pop    %ebp
+  80044c:	c3                   	ret
+
+0080044d <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80044d:	55                   	push   %ebp
+  80044e:	89 e5                	mov    %esp,%ebp
+  800450:	57                   	push   %edi
+  800451:	56                   	push   %esi
+  800452:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800453:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800460:	89 cb                	mov    %ecx,%ebx
+  800462:	89 cf                	mov    %ecx,%edi
+  800464:	89 ce                	mov    %ecx,%esi
+  800466:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800468:	5b                   	pop    %ebx
+  800469:	5e                   	pop    %esi
+  80046a:	5f                   	pop    %edi
+  80046b:	5d                   	pop    %ebp
+  80046c:	c3                   	ret
+
+0080046d <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80046d:	55                   	push   %ebp
+  80046e:	89 e5                	mov    %esp,%ebp
+  800470:	57                   	push   %edi
+  800471:	56                   	push   %esi
+  800472:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800473:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800478:	8b 55 08             	mov    0x8(%ebp),%edx
+  80047b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80047e:	b8 11 00 00 00       	mov    $0x11,%eax
+  800483:	89 df                	mov    %ebx,%edi
+  800485:	89 de                	mov    %ebx,%esi
+  800487:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800489:	5b                   	pop    %ebx
+  80048a:	5e                   	pop    %esi
+  80048b:	5f                   	pop    %edi
+  80048c:	5d                   	pop    %ebp
+  80048d:	c3                   	ret
+
+0080048e <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80048e:	55                   	push   %ebp
+  80048f:	89 e5                	mov    %esp,%ebp
+  800491:	57                   	push   %edi
+  800492:	56                   	push   %esi
+  800493:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80049f:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004a4:	89 df                	mov    %ebx,%edi
+  8004a6:	89 de                	mov    %ebx,%esi
+  8004a8:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8004aa:	5b                   	pop    %ebx
+  8004ab:	5e                   	pop    %esi
+  8004ac:	5f                   	pop    %edi
+  8004ad:	5d                   	pop    %ebp
+  8004ae:	c3                   	ret
+
+008004af <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8004af:	55                   	push   %ebp
+  8004b0:	89 e5                	mov    %esp,%ebp
+  8004b2:	57                   	push   %edi
+  8004b3:	56                   	push   %esi
+  8004b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004bd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004c2:	89 cb                	mov    %ecx,%ebx
+  8004c4:	89 cf                	mov    %ecx,%edi
+  8004c6:	89 ce                	mov    %ecx,%esi
+  8004c8:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004ca:	5b                   	pop    %ebx
+  8004cb:	5e                   	pop    %esi
+  8004cc:	5f                   	pop    %edi
+  8004cd:	5d                   	pop    %ebp
+  8004ce:	c3                   	ret
+
+008004cf <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004cf:	55                   	push   %ebp
+  8004d0:	89 e5                	mov    %esp,%ebp
+  8004d2:	57                   	push   %edi
+  8004d3:	56                   	push   %esi
+  8004d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004e5:	89 df                	mov    %ebx,%edi
+  8004e7:	89 de                	mov    %ebx,%esi
+  8004e9:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004eb:	5b                   	pop    %ebx
+  8004ec:	5e                   	pop    %esi
+  8004ed:	5f                   	pop    %edi
+  8004ee:	5d                   	pop    %ebp
+  8004ef:	c3                   	ret
+
+008004f0 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004f0:	55                   	push   %ebp
+  8004f1:	89 e5                	mov    %esp,%ebp
+  8004f3:	57                   	push   %edi
+  8004f4:	56                   	push   %esi
+  8004f5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004fe:	b8 15 00 00 00       	mov    $0x15,%eax
+  800503:	89 cb                	mov    %ecx,%ebx
+  800505:	89 cf                	mov    %ecx,%edi
+  800507:	89 ce                	mov    %ecx,%esi
+  800509:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80050b:	5b                   	pop    %ebx
+  80050c:	5e                   	pop    %esi
+  80050d:	5f                   	pop    %edi
+  80050e:	5d                   	pop    %ebp
+  80050f:	c3                   	ret
+
+00800510 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  800510:	55                   	push   %ebp
+  800511:	89 e5                	mov    %esp,%ebp
+  800513:	57                   	push   %edi
+  800514:	56                   	push   %esi
+  800515:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800516:	be 00 00 00 00       	mov    $0x0,%esi
+  80051b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800521:	b8 16 00 00 00       	mov    $0x16,%eax
+  800526:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800529:	89 f7                	mov    %esi,%edi
+  80052b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80052d:	5b                   	pop    %ebx
+  80052e:	5e                   	pop    %esi
+  80052f:	5f                   	pop    %edi
+  800530:	5d                   	pop    %ebp
+  800531:	c3                   	ret
+
+00800532 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800532:	55                   	push   %ebp
+  800533:	89 e5                	mov    %esp,%ebp
+  800535:	57                   	push   %edi
+  800536:	56                   	push   %esi
+  800537:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800538:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80053d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800540:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800543:	b8 17 00 00 00       	mov    $0x17,%eax
+  800548:	89 df                	mov    %ebx,%edi
+  80054a:	89 de                	mov    %ebx,%esi
+  80054c:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80054e:	5b                   	pop    %ebx
+  80054f:	5e                   	pop    %esi
+  800550:	5f                   	pop    %edi
+  800551:	5d                   	pop    %ebp
+  800552:	c3                   	ret
+
+00800553 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800553:	55                   	push   %ebp
+  800554:	89 e5                	mov    %esp,%ebp
+  800556:	57                   	push   %edi
+  800557:	56                   	push   %esi
+  800558:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800559:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80055e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800561:	b8 18 00 00 00       	mov    $0x18,%eax
+  800566:	89 cb                	mov    %ecx,%ebx
+  800568:	89 cf                	mov    %ecx,%edi
+  80056a:	89 ce                	mov    %ecx,%esi
+  80056c:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80056e:	5b                   	pop    %ebx
+  80056f:	5e                   	pop    %esi
+  800570:	5f                   	pop    %edi
+  800571:	5d                   	pop    %ebp
+  800572:	c3                   	ret
+
+00800573 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800573:	55                   	push   %ebp
+  800574:	89 e5                	mov    %esp,%ebp
+  800576:	57                   	push   %edi
+  800577:	56                   	push   %esi
+  800578:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  800579:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80057d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800582:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800585:	b8 19 00 00 00       	mov    $0x19,%eax
+  80058a:	89 df                	mov    %ebx,%edi
+  80058c:	89 de                	mov    %ebx,%esi
+  80058e:	cd 30                	int    $0x30
+}
+  800590:	5b                   	pop    %ebx
+  800591:	5e                   	pop    %esi
+  800592:	5f                   	pop    %edi
+  800593:	5d                   	pop    %ebp
+  800594:	c3                   	ret
+
+00800595 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  800595:	55                   	push   %ebp
+  800596:	89 e5                	mov    %esp,%ebp
+  800598:	57                   	push   %edi
+  800599:	56                   	push   %esi
+  80059a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80059b:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005ae:	89 f7                	mov    %esi,%edi
+  8005b0:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8005b2:	5b                   	pop    %ebx
+  8005b3:	5e                   	pop    %esi
+  8005b4:	5f                   	pop    %edi
+  8005b5:	5d                   	pop    %ebp
+  8005b6:	c3                   	ret
+
+008005b7 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8005b7:	55                   	push   %ebp
+  8005b8:	89 e5                	mov    %esp,%ebp
+  8005ba:	57                   	push   %edi
+  8005bb:	56                   	push   %esi
+  8005bc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005d0:	89 f7                	mov    %esi,%edi
+  8005d2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005d4:	5b                   	pop    %ebx
+  8005d5:	5e                   	pop    %esi
+  8005d6:	5f                   	pop    %edi
+  8005d7:	5d                   	pop    %ebp
+  8005d8:	c3                   	ret
+
+008005d9 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005d9:	55                   	push   %ebp
+  8005da:	89 e5                	mov    %esp,%ebp
+  8005dc:	57                   	push   %edi
+  8005dd:	56                   	push   %esi
+  8005de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ea:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005ef:	89 df                	mov    %ebx,%edi
+  8005f1:	89 de                	mov    %ebx,%esi
+  8005f3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005f5:	5b                   	pop    %ebx
+  8005f6:	5e                   	pop    %esi
+  8005f7:	5f                   	pop    %edi
+  8005f8:	5d                   	pop    %ebp
+  8005f9:	c3                   	ret
+
+008005fa <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005fa:	55                   	push   %ebp
+  8005fb:	89 e5                	mov    %esp,%ebp
+  8005fd:	57                   	push   %edi
+  8005fe:	56                   	push   %esi
+  8005ff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800600:	be 00 00 00 00       	mov    $0x0,%esi
+  800605:	8b 55 08             	mov    0x8(%ebp),%edx
+  800608:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80060b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800610:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800613:	89 f7                	mov    %esi,%edi
+  800615:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  800617:	5b                   	pop    %ebx
+  800618:	5e                   	pop    %esi
+  800619:	5f                   	pop    %edi
+  80061a:	5d                   	pop    %ebp
+  80061b:	c3                   	ret
+
+0080061c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80061c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80061d:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  800622:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  800624:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  800627:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  80062b:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80062e:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  800632:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  800634:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  800638:	83 c4 08             	add    $0x8,%esp
+	popal;
+  80063b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80063c:	83 c4 04             	add    $0x4,%esp
+	popf
+  80063f:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  800640:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  800641:	c3                   	ret
+
+00800642 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800642:	55                   	push   %ebp
+  800643:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800645:	8b 45 08             	mov    0x8(%ebp),%eax
+  800648:	05 00 00 00 30       	add    $0x30000000,%eax
+  80064d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800650:	5d                   	pop    %ebp
+  800651:	c3                   	ret
+
+00800652 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800652:	55                   	push   %ebp
+  800653:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800655:	8b 45 08             	mov    0x8(%ebp),%eax
+  800658:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80065d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800662:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800667:	5d                   	pop    %ebp
+  800668:	c3                   	ret
+
+00800669 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800669:	55                   	push   %ebp
+  80066a:	89 e5                	mov    %esp,%ebp
+  80066c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  800671:	89 c2                	mov    %eax,%edx
+  800673:	c1 ea 16             	shr    $0x16,%edx
+  800676:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80067d:	f6 c2 01             	test   $0x1,%dl
+  800680:	74 29                	je     8006ab <fd_alloc+0x42>
+  800682:	89 c2                	mov    %eax,%edx
+  800684:	c1 ea 0c             	shr    $0xc,%edx
+  800687:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80068e:	f6 c2 01             	test   $0x1,%dl
+  800691:	74 18                	je     8006ab <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800693:	05 00 10 00 00       	add    $0x1000,%eax
+  800698:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80069d:	75 d2                	jne    800671 <fd_alloc+0x8>
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006a4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006a9:	eb 05                	jmp    8006b0 <fd_alloc+0x47>
+			return 0;
+  8006ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006b3:	89 02                	mov    %eax,(%edx)
+}
+  8006b5:	89 c8                	mov    %ecx,%eax
+  8006b7:	5d                   	pop    %ebp
+  8006b8:	c3                   	ret
+
+008006b9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006b9:	55                   	push   %ebp
+  8006ba:	89 e5                	mov    %esp,%ebp
+  8006bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8006bf:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8006c4:	77 30                	ja     8006f6 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8006c6:	c1 e0 0c             	shl    $0xc,%eax
+  8006c9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8006ce:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006d4:	f6 c2 01             	test   $0x1,%dl
+  8006d7:	74 24                	je     8006fd <fd_lookup+0x44>
+  8006d9:	89 c2                	mov    %eax,%edx
+  8006db:	c1 ea 0c             	shr    $0xc,%edx
+  8006de:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006e5:	f6 c2 01             	test   $0x1,%dl
+  8006e8:	74 1a                	je     800704 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ed:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006f4:	5d                   	pop    %ebp
+  8006f5:	c3                   	ret
+		return -E_INVAL;
+  8006f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006fb:	eb f7                	jmp    8006f4 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800702:	eb f0                	jmp    8006f4 <fd_lookup+0x3b>
+  800704:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800709:	eb e9                	jmp    8006f4 <fd_lookup+0x3b>
+
+0080070b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80070b:	55                   	push   %ebp
+  80070c:	89 e5                	mov    %esp,%ebp
+  80070e:	53                   	push   %ebx
+  80070f:	83 ec 04             	sub    $0x4,%esp
+  800712:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071a:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  80071f:	39 13                	cmp    %edx,(%ebx)
+  800721:	74 54                	je     800777 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  800723:	83 c0 01             	add    $0x1,%eax
+  800726:	8b 1c 85 b4 3b 80 00 	mov    0x803bb4(,%eax,4),%ebx
+  80072d:	85 db                	test   %ebx,%ebx
+  80072f:	75 ee                	jne    80071f <dev_lookup+0x14>
+  800731:	89 e1                	mov    %esp,%ecx
+  800733:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800738:	29 c8                	sub    %ecx,%eax
+  80073a:	89 c1                	mov    %eax,%ecx
+  80073c:	c1 e9 0f             	shr    $0xf,%ecx
+  80073f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80074c:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800753:	8b 40 48             	mov    0x48(%eax),%eax
+  800756:	83 ec 04             	sub    $0x4,%esp
+  800759:	52                   	push   %edx
+  80075a:	50                   	push   %eax
+  80075b:	68 38 3b 80 00       	push   $0x803b38
+  800760:	e8 90 23 00 00       	call   802af5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80076d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800770:	89 1a                	mov    %ebx,(%edx)
+}
+  800772:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800775:	c9                   	leave
+  800776:	c3                   	ret
+			return 0;
+  800777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077c:	eb ef                	jmp    80076d <dev_lookup+0x62>
+
+0080077e <fd_close>:
+{
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	57                   	push   %edi
+  800782:	56                   	push   %esi
+  800783:	53                   	push   %ebx
+  800784:	83 ec 24             	sub    $0x24,%esp
+  800787:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80078d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800790:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800791:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800797:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80079a:	50                   	push   %eax
+  80079b:	e8 19 ff ff ff       	call   8006b9 <fd_lookup>
+  8007a0:	89 c3                	mov    %eax,%ebx
+  8007a2:	83 c4 10             	add    $0x10,%esp
+  8007a5:	85 c0                	test   %eax,%eax
+  8007a7:	78 05                	js     8007ae <fd_close+0x30>
+	    || fd != fd2)
+  8007a9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007ac:	74 0f                	je     8007bd <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8007ae:	85 ff                	test   %edi,%edi
+  8007b0:	0f 44 df             	cmove  %edi,%ebx
+}
+  8007b3:	89 d8                	mov    %ebx,%eax
+  8007b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007b8:	5b                   	pop    %ebx
+  8007b9:	5e                   	pop    %esi
+  8007ba:	5f                   	pop    %edi
+  8007bb:	5d                   	pop    %ebp
+  8007bc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007c3:	50                   	push   %eax
+  8007c4:	ff 36                	push   (%esi)
+  8007c6:	e8 40 ff ff ff       	call   80070b <dev_lookup>
+  8007cb:	89 c3                	mov    %eax,%ebx
+  8007cd:	83 c4 10             	add    $0x10,%esp
+  8007d0:	85 c0                	test   %eax,%eax
+  8007d2:	78 1a                	js     8007ee <fd_close+0x70>
+		if (dev->dev_close)
+  8007d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007d7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8007da:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007df:	85 c0                	test   %eax,%eax
+  8007e1:	74 0b                	je     8007ee <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8007e3:	83 ec 0c             	sub    $0xc,%esp
+  8007e6:	56                   	push   %esi
+  8007e7:	ff d0                	call   *%eax
+  8007e9:	89 c3                	mov    %eax,%ebx
+  8007eb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007ee:	83 ec 08             	sub    $0x8,%esp
+  8007f1:	56                   	push   %esi
+  8007f2:	6a 00                	push   $0x0
+  8007f4:	e8 45 fa ff ff       	call   80023e <sys_page_unmap>
+	return r;
+  8007f9:	83 c4 10             	add    $0x10,%esp
+  8007fc:	eb b5                	jmp    8007b3 <fd_close+0x35>
+
+008007fe <close>:
+
+int
+close(int fdnum)
+{
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800804:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800807:	50                   	push   %eax
+  800808:	ff 75 08             	push   0x8(%ebp)
+  80080b:	e8 a9 fe ff ff       	call   8006b9 <fd_lookup>
+  800810:	83 c4 10             	add    $0x10,%esp
+  800813:	85 c0                	test   %eax,%eax
+  800815:	79 02                	jns    800819 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800817:	c9                   	leave
+  800818:	c3                   	ret
+		return fd_close(fd, 1);
+  800819:	83 ec 08             	sub    $0x8,%esp
+  80081c:	6a 01                	push   $0x1
+  80081e:	ff 75 f4             	push   -0xc(%ebp)
+  800821:	e8 58 ff ff ff       	call   80077e <fd_close>
+  800826:	83 c4 10             	add    $0x10,%esp
+  800829:	eb ec                	jmp    800817 <close+0x19>
+
+0080082b <close_all>:
+
+void
+close_all(void)
+{
+  80082b:	55                   	push   %ebp
+  80082c:	89 e5                	mov    %esp,%ebp
+  80082e:	53                   	push   %ebx
+  80082f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800832:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800837:	83 ec 0c             	sub    $0xc,%esp
+  80083a:	53                   	push   %ebx
+  80083b:	e8 be ff ff ff       	call   8007fe <close>
+	for (i = 0; i < MAXFD; i++)
+  800840:	83 c3 01             	add    $0x1,%ebx
+  800843:	83 c4 10             	add    $0x10,%esp
+  800846:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80084c:	75 e9                	jne    800837 <close_all+0xc>
+}
+  80084e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800851:	c9                   	leave
+  800852:	c3                   	ret
+
+00800853 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	57                   	push   %edi
+  800857:	56                   	push   %esi
+  800858:	53                   	push   %ebx
+  800859:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80085c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80085f:	50                   	push   %eax
+  800860:	ff 75 08             	push   0x8(%ebp)
+  800863:	e8 51 fe ff ff       	call   8006b9 <fd_lookup>
+  800868:	89 c3                	mov    %eax,%ebx
+  80086a:	83 c4 10             	add    $0x10,%esp
+  80086d:	85 c0                	test   %eax,%eax
+  80086f:	78 7f                	js     8008f0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800871:	83 ec 0c             	sub    $0xc,%esp
+  800874:	ff 75 0c             	push   0xc(%ebp)
+  800877:	e8 82 ff ff ff       	call   8007fe <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80087c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80087f:	c1 e6 0c             	shl    $0xc,%esi
+  800882:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800888:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80088b:	89 3c 24             	mov    %edi,(%esp)
+  80088e:	e8 bf fd ff ff       	call   800652 <fd2data>
+  800893:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800895:	89 34 24             	mov    %esi,(%esp)
+  800898:	e8 b5 fd ff ff       	call   800652 <fd2data>
+  80089d:	83 c4 10             	add    $0x10,%esp
+  8008a0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8008a3:	89 d8                	mov    %ebx,%eax
+  8008a5:	c1 e8 16             	shr    $0x16,%eax
+  8008a8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008af:	a8 01                	test   $0x1,%al
+  8008b1:	74 11                	je     8008c4 <dup+0x71>
+  8008b3:	89 d8                	mov    %ebx,%eax
+  8008b5:	c1 e8 0c             	shr    $0xc,%eax
+  8008b8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008bf:	f6 c2 01             	test   $0x1,%dl
+  8008c2:	75 36                	jne    8008fa <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8008c4:	89 f8                	mov    %edi,%eax
+  8008c6:	c1 e8 0c             	shr    $0xc,%eax
+  8008c9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008d0:	83 ec 0c             	sub    $0xc,%esp
+  8008d3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008d8:	50                   	push   %eax
+  8008d9:	56                   	push   %esi
+  8008da:	6a 00                	push   $0x0
+  8008dc:	57                   	push   %edi
+  8008dd:	6a 00                	push   $0x0
+  8008df:	e8 18 f9 ff ff       	call   8001fc <sys_page_map>
+  8008e4:	89 c3                	mov    %eax,%ebx
+  8008e6:	83 c4 20             	add    $0x20,%esp
+  8008e9:	85 c0                	test   %eax,%eax
+  8008eb:	78 33                	js     800920 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008f0:	89 d8                	mov    %ebx,%eax
+  8008f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008f5:	5b                   	pop    %ebx
+  8008f6:	5e                   	pop    %esi
+  8008f7:	5f                   	pop    %edi
+  8008f8:	5d                   	pop    %ebp
+  8008f9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008fa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800901:	83 ec 0c             	sub    $0xc,%esp
+  800904:	25 07 0e 00 00       	and    $0xe07,%eax
+  800909:	50                   	push   %eax
+  80090a:	ff 75 d4             	push   -0x2c(%ebp)
+  80090d:	6a 00                	push   $0x0
+  80090f:	53                   	push   %ebx
+  800910:	6a 00                	push   $0x0
+  800912:	e8 e5 f8 ff ff       	call   8001fc <sys_page_map>
+  800917:	89 c3                	mov    %eax,%ebx
+  800919:	83 c4 20             	add    $0x20,%esp
+  80091c:	85 c0                	test   %eax,%eax
+  80091e:	79 a4                	jns    8008c4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800920:	83 ec 08             	sub    $0x8,%esp
+  800923:	56                   	push   %esi
+  800924:	6a 00                	push   $0x0
+  800926:	e8 13 f9 ff ff       	call   80023e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80092b:	83 c4 08             	add    $0x8,%esp
+  80092e:	ff 75 d4             	push   -0x2c(%ebp)
+  800931:	6a 00                	push   $0x0
+  800933:	e8 06 f9 ff ff       	call   80023e <sys_page_unmap>
+	return r;
+  800938:	83 c4 10             	add    $0x10,%esp
+  80093b:	eb b3                	jmp    8008f0 <dup+0x9d>
+
+0080093d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	56                   	push   %esi
+  800941:	53                   	push   %ebx
+  800942:	83 ec 18             	sub    $0x18,%esp
+  800945:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800948:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80094b:	50                   	push   %eax
+  80094c:	53                   	push   %ebx
+  80094d:	e8 67 fd ff ff       	call   8006b9 <fd_lookup>
+  800952:	83 c4 10             	add    $0x10,%esp
+  800955:	85 c0                	test   %eax,%eax
+  800957:	78 3c                	js     800995 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800959:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80095c:	83 ec 08             	sub    $0x8,%esp
+  80095f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800962:	50                   	push   %eax
+  800963:	ff 36                	push   (%esi)
+  800965:	e8 a1 fd ff ff       	call   80070b <dev_lookup>
+  80096a:	83 c4 10             	add    $0x10,%esp
+  80096d:	85 c0                	test   %eax,%eax
+  80096f:	78 24                	js     800995 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800971:	8b 46 08             	mov    0x8(%esi),%eax
+  800974:	83 e0 03             	and    $0x3,%eax
+  800977:	83 f8 01             	cmp    $0x1,%eax
+  80097a:	74 20                	je     80099c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80097c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80097f:	8b 40 08             	mov    0x8(%eax),%eax
+  800982:	85 c0                	test   %eax,%eax
+  800984:	74 54                	je     8009da <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800986:	83 ec 04             	sub    $0x4,%esp
+  800989:	ff 75 10             	push   0x10(%ebp)
+  80098c:	ff 75 0c             	push   0xc(%ebp)
+  80098f:	56                   	push   %esi
+  800990:	ff d0                	call   *%eax
+  800992:	83 c4 10             	add    $0x10,%esp
+}
+  800995:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800998:	5b                   	pop    %ebx
+  800999:	5e                   	pop    %esi
+  80099a:	5d                   	pop    %ebp
+  80099b:	c3                   	ret
+  80099c:	89 e2                	mov    %esp,%edx
+  80099e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8009a3:	29 d0                	sub    %edx,%eax
+  8009a5:	89 c2                	mov    %eax,%edx
+  8009a7:	c1 ea 0f             	shr    $0xf,%edx
+  8009aa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8009af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b4:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009b7:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8009be:	8b 40 48             	mov    0x48(%eax),%eax
+  8009c1:	83 ec 04             	sub    $0x4,%esp
+  8009c4:	53                   	push   %ebx
+  8009c5:	50                   	push   %eax
+  8009c6:	68 79 3b 80 00       	push   $0x803b79
+  8009cb:	e8 25 21 00 00       	call   802af5 <cprintf>
+		return -E_INVAL;
+  8009d0:	83 c4 10             	add    $0x10,%esp
+  8009d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009d8:	eb bb                	jmp    800995 <read+0x58>
+		return -E_NOT_SUPP;
+  8009da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009df:	eb b4                	jmp    800995 <read+0x58>
+
+008009e1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009e1:	55                   	push   %ebp
+  8009e2:	89 e5                	mov    %esp,%ebp
+  8009e4:	57                   	push   %edi
+  8009e5:	56                   	push   %esi
+  8009e6:	53                   	push   %ebx
+  8009e7:	83 ec 0c             	sub    $0xc,%esp
+  8009ea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009ed:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009f0:	85 f6                	test   %esi,%esi
+  8009f2:	74 30                	je     800a24 <readn+0x43>
+  8009f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009f9:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009fe:	83 ec 04             	sub    $0x4,%esp
+  800a01:	89 f2                	mov    %esi,%edx
+  800a03:	29 c2                	sub    %eax,%edx
+  800a05:	52                   	push   %edx
+  800a06:	01 f8                	add    %edi,%eax
+  800a08:	50                   	push   %eax
+  800a09:	ff 75 08             	push   0x8(%ebp)
+  800a0c:	e8 2c ff ff ff       	call   80093d <read>
+		if (m < 0)
+  800a11:	83 c4 10             	add    $0x10,%esp
+  800a14:	85 c0                	test   %eax,%eax
+  800a16:	78 15                	js     800a2d <readn+0x4c>
+			return m;
+		if (m == 0)
+  800a18:	74 11                	je     800a2b <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  800a1a:	01 c3                	add    %eax,%ebx
+  800a1c:	89 d8                	mov    %ebx,%eax
+  800a1e:	39 f3                	cmp    %esi,%ebx
+  800a20:	72 dc                	jb     8009fe <readn+0x1d>
+  800a22:	eb 09                	jmp    800a2d <readn+0x4c>
+  800a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a29:	eb 02                	jmp    800a2d <readn+0x4c>
+  800a2b:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  800a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a30:	5b                   	pop    %ebx
+  800a31:	5e                   	pop    %esi
+  800a32:	5f                   	pop    %edi
+  800a33:	5d                   	pop    %ebp
+  800a34:	c3                   	ret
+
+00800a35 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	56                   	push   %esi
+  800a39:	53                   	push   %ebx
+  800a3a:	83 ec 18             	sub    $0x18,%esp
+  800a3d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a40:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a43:	50                   	push   %eax
+  800a44:	53                   	push   %ebx
+  800a45:	e8 6f fc ff ff       	call   8006b9 <fd_lookup>
+  800a4a:	83 c4 10             	add    $0x10,%esp
+  800a4d:	85 c0                	test   %eax,%eax
+  800a4f:	78 37                	js     800a88 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a51:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a54:	83 ec 08             	sub    $0x8,%esp
+  800a57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a5a:	50                   	push   %eax
+  800a5b:	ff 36                	push   (%esi)
+  800a5d:	e8 a9 fc ff ff       	call   80070b <dev_lookup>
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	85 c0                	test   %eax,%eax
+  800a67:	78 1f                	js     800a88 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a69:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a6d:	74 20                	je     800a8f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a72:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a75:	85 c0                	test   %eax,%eax
+  800a77:	74 54                	je     800acd <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a79:	83 ec 04             	sub    $0x4,%esp
+  800a7c:	ff 75 10             	push   0x10(%ebp)
+  800a7f:	ff 75 0c             	push   0xc(%ebp)
+  800a82:	56                   	push   %esi
+  800a83:	ff d0                	call   *%eax
+  800a85:	83 c4 10             	add    $0x10,%esp
+}
+  800a88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a8b:	5b                   	pop    %ebx
+  800a8c:	5e                   	pop    %esi
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+  800a8f:	89 e2                	mov    %esp,%edx
+  800a91:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a96:	29 d0                	sub    %edx,%eax
+  800a98:	89 c2                	mov    %eax,%edx
+  800a9a:	c1 ea 0f             	shr    $0xf,%edx
+  800a9d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa7:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800aaa:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800ab1:	8b 40 48             	mov    0x48(%eax),%eax
+  800ab4:	83 ec 04             	sub    $0x4,%esp
+  800ab7:	53                   	push   %ebx
+  800ab8:	50                   	push   %eax
+  800ab9:	68 95 3b 80 00       	push   $0x803b95
+  800abe:	e8 32 20 00 00       	call   802af5 <cprintf>
+		return -E_INVAL;
+  800ac3:	83 c4 10             	add    $0x10,%esp
+  800ac6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800acb:	eb bb                	jmp    800a88 <write+0x53>
+		return -E_NOT_SUPP;
+  800acd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad2:	eb b4                	jmp    800a88 <write+0x53>
+
+00800ad4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ada:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800add:	50                   	push   %eax
+  800ade:	ff 75 08             	push   0x8(%ebp)
+  800ae1:	e8 d3 fb ff ff       	call   8006b9 <fd_lookup>
+  800ae6:	83 c4 10             	add    $0x10,%esp
+  800ae9:	85 c0                	test   %eax,%eax
+  800aeb:	78 0e                	js     800afb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800aed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800af3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800af6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afb:	c9                   	leave
+  800afc:	c3                   	ret
+
+00800afd <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	53                   	push   %ebx
+  800b01:	83 ec 1c             	sub    $0x1c,%esp
+  800b04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b0a:	50                   	push   %eax
+  800b0b:	ff 75 08             	push   0x8(%ebp)
+  800b0e:	e8 a6 fb ff ff       	call   8006b9 <fd_lookup>
+  800b13:	83 c4 10             	add    $0x10,%esp
+  800b16:	85 c0                	test   %eax,%eax
+  800b18:	78 33                	js     800b4d <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800b1a:	83 fb 03             	cmp    $0x3,%ebx
+  800b1d:	74 28                	je     800b47 <fcntl+0x4a>
+  800b1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b24:	83 fb 04             	cmp    $0x4,%ebx
+  800b27:	75 24                	jne    800b4d <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800b29:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800b2c:	8b 41 08             	mov    0x8(%ecx),%eax
+  800b2f:	80 e4 ef             	and    $0xef,%ah
+  800b32:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b35:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800b3b:	09 d0                	or     %edx,%eax
+  800b3d:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b45:	eb 06                	jmp    800b4d <fcntl+0x50>
+		return fd->fd_omode;
+  800b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4a:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b50:	c9                   	leave
+  800b51:	c3                   	ret
+
+00800b52 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	56                   	push   %esi
+  800b56:	53                   	push   %ebx
+  800b57:	83 ec 18             	sub    $0x18,%esp
+  800b5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b5d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b60:	50                   	push   %eax
+  800b61:	53                   	push   %ebx
+  800b62:	e8 52 fb ff ff       	call   8006b9 <fd_lookup>
+  800b67:	83 c4 10             	add    $0x10,%esp
+  800b6a:	85 c0                	test   %eax,%eax
+  800b6c:	78 34                	js     800ba2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b6e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b71:	83 ec 08             	sub    $0x8,%esp
+  800b74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b77:	50                   	push   %eax
+  800b78:	ff 36                	push   (%esi)
+  800b7a:	e8 8c fb ff ff       	call   80070b <dev_lookup>
+  800b7f:	83 c4 10             	add    $0x10,%esp
+  800b82:	85 c0                	test   %eax,%eax
+  800b84:	78 1c                	js     800ba2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b86:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b8a:	74 1d                	je     800ba9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b8f:	8b 40 18             	mov    0x18(%eax),%eax
+  800b92:	85 c0                	test   %eax,%eax
+  800b94:	74 51                	je     800be7 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b96:	83 ec 08             	sub    $0x8,%esp
+  800b99:	ff 75 0c             	push   0xc(%ebp)
+  800b9c:	56                   	push   %esi
+  800b9d:	ff d0                	call   *%eax
+  800b9f:	83 c4 10             	add    $0x10,%esp
+}
+  800ba2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ba5:	5b                   	pop    %ebx
+  800ba6:	5e                   	pop    %esi
+  800ba7:	5d                   	pop    %ebp
+  800ba8:	c3                   	ret
+  800ba9:	89 e2                	mov    %esp,%edx
+  800bab:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800bb0:	29 d0                	sub    %edx,%eax
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	c1 ea 0f             	shr    $0xf,%edx
+  800bb7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc1:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800bc4:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800bcb:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bce:	83 ec 04             	sub    $0x4,%esp
+  800bd1:	53                   	push   %ebx
+  800bd2:	50                   	push   %eax
+  800bd3:	68 58 3b 80 00       	push   $0x803b58
+  800bd8:	e8 18 1f 00 00       	call   802af5 <cprintf>
+		return -E_INVAL;
+  800bdd:	83 c4 10             	add    $0x10,%esp
+  800be0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800be5:	eb bb                	jmp    800ba2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800be7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bec:	eb b4                	jmp    800ba2 <ftruncate+0x50>
+
+00800bee <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+  800bf3:	83 ec 18             	sub    $0x18,%esp
+  800bf6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bf9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bfc:	50                   	push   %eax
+  800bfd:	ff 75 08             	push   0x8(%ebp)
+  800c00:	e8 b4 fa ff ff       	call   8006b9 <fd_lookup>
+  800c05:	83 c4 10             	add    $0x10,%esp
+  800c08:	85 c0                	test   %eax,%eax
+  800c0a:	78 53                	js     800c5f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c0c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c0f:	83 ec 08             	sub    $0x8,%esp
+  800c12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c15:	50                   	push   %eax
+  800c16:	ff 36                	push   (%esi)
+  800c18:	e8 ee fa ff ff       	call   80070b <dev_lookup>
+  800c1d:	83 c4 10             	add    $0x10,%esp
+  800c20:	85 c0                	test   %eax,%eax
+  800c22:	78 3b                	js     800c5f <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800c24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c27:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c2b:	74 39                	je     800c66 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c2d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c30:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c37:	00 00 00 
+	stat->st_isdir = 0;
+  800c3a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c41:	00 00 00 
+	stat->st_version = 0;
+  800c44:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c4b:	00 00 00 
+	stat->st_dev = dev;
+  800c4e:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c54:	83 ec 08             	sub    $0x8,%esp
+  800c57:	53                   	push   %ebx
+  800c58:	56                   	push   %esi
+  800c59:	ff 50 14             	call   *0x14(%eax)
+  800c5c:	83 c4 10             	add    $0x10,%esp
+}
+  800c5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c62:	5b                   	pop    %ebx
+  800c63:	5e                   	pop    %esi
+  800c64:	5d                   	pop    %ebp
+  800c65:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c6b:	eb f2                	jmp    800c5f <fstat+0x71>
+
+00800c6d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c72:	83 ec 08             	sub    $0x8,%esp
+  800c75:	6a 00                	push   $0x0
+  800c77:	ff 75 08             	push   0x8(%ebp)
+  800c7a:	e8 b7 01 00 00       	call   800e36 <open>
+  800c7f:	89 c3                	mov    %eax,%ebx
+  800c81:	83 c4 10             	add    $0x10,%esp
+  800c84:	85 c0                	test   %eax,%eax
+  800c86:	78 1b                	js     800ca3 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c88:	83 ec 08             	sub    $0x8,%esp
+  800c8b:	ff 75 0c             	push   0xc(%ebp)
+  800c8e:	50                   	push   %eax
+  800c8f:	e8 5a ff ff ff       	call   800bee <fstat>
+  800c94:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c96:	89 1c 24             	mov    %ebx,(%esp)
+  800c99:	e8 60 fb ff ff       	call   8007fe <close>
+	return r;
+  800c9e:	83 c4 10             	add    $0x10,%esp
+  800ca1:	89 f3                	mov    %esi,%ebx
+}
+  800ca3:	89 d8                	mov    %ebx,%eax
+  800ca5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+  800cb1:	89 c6                	mov    %eax,%esi
+  800cb3:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800cb5:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800cbc:	74 27                	je     800ce5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cbe:	6a 07                	push   $0x7
+  800cc0:	68 00 60 80 00       	push   $0x806000
+  800cc5:	56                   	push   %esi
+  800cc6:	ff 35 00 50 80 00    	push   0x805000
+  800ccc:	e8 61 2b 00 00       	call   803832 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800cd1:	83 c4 0c             	add    $0xc,%esp
+  800cd4:	6a 00                	push   $0x0
+  800cd6:	53                   	push   %ebx
+  800cd7:	6a 00                	push   $0x0
+  800cd9:	e8 c4 28 00 00       	call   8035a2 <ipc_recv>
+}
+  800cde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce1:	5b                   	pop    %ebx
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ce5:	83 ec 0c             	sub    $0xc,%esp
+  800ce8:	6a 02                	push   $0x2
+  800cea:	e8 ac 2b 00 00       	call   80389b <ipc_find_env>
+  800cef:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cf4:	83 c4 10             	add    $0x10,%esp
+  800cf7:	eb c5                	jmp    800cbe <fsipc+0x12>
+
+00800cf9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800cff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d02:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d05:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800d0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d0d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d17:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d1c:	e8 8b ff ff ff       	call   800cac <fsipc>
+}
+  800d21:	c9                   	leave
+  800d22:	c3                   	ret
+
+00800d23 <devfile_flush>:
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d2f:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d39:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d3e:	e8 69 ff ff ff       	call   800cac <fsipc>
+}
+  800d43:	c9                   	leave
+  800d44:	c3                   	ret
+
+00800d45 <devfile_stat>:
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	53                   	push   %ebx
+  800d49:	83 ec 04             	sub    $0x4,%esp
+  800d4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d52:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d55:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d64:	e8 43 ff ff ff       	call   800cac <fsipc>
+  800d69:	85 c0                	test   %eax,%eax
+  800d6b:	78 37                	js     800da4 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d6d:	83 ec 08             	sub    $0x8,%esp
+  800d70:	68 00 60 80 00       	push   $0x806000
+  800d75:	53                   	push   %ebx
+  800d76:	e8 71 24 00 00       	call   8031ec <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d7b:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d80:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d86:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d8b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d91:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d96:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d9c:	83 c4 10             	add    $0x10,%esp
+  800d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800da7:	c9                   	leave
+  800da8:	c3                   	ret
+
+00800da9 <devfile_write>:
+{
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	83 ec 0c             	sub    $0xc,%esp
+  800daf:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800db2:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800db7:	39 d0                	cmp    %edx,%eax
+  800db9:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbf:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dc2:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800dc8:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800dcd:	50                   	push   %eax
+  800dce:	ff 75 0c             	push   0xc(%ebp)
+  800dd1:	68 08 60 80 00       	push   $0x806008
+  800dd6:	e8 c1 25 00 00       	call   80339c <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800de5:	e8 c2 fe ff ff       	call   800cac <fsipc>
+}
+  800dea:	c9                   	leave
+  800deb:	c3                   	ret
+
+00800dec <devfile_read>:
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	53                   	push   %ebx
+  800df0:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800df3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800df9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800dfe:	8b 45 10             	mov    0x10(%ebp),%eax
+  800e01:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800e06:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800e0b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e10:	e8 97 fe ff ff       	call   800cac <fsipc>
+  800e15:	89 c3                	mov    %eax,%ebx
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	78 14                	js     800e2f <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800e1b:	83 ec 04             	sub    $0x4,%esp
+  800e1e:	50                   	push   %eax
+  800e1f:	68 00 60 80 00       	push   $0x806000
+  800e24:	ff 75 0c             	push   0xc(%ebp)
+  800e27:	e8 70 25 00 00       	call   80339c <memmove>
+	return r;
+  800e2c:	83 c4 10             	add    $0x10,%esp
+}
+  800e2f:	89 d8                	mov    %ebx,%eax
+  800e31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e34:	c9                   	leave
+  800e35:	c3                   	ret
+
+00800e36 <open>:
+{
+  800e36:	55                   	push   %ebp
+  800e37:	89 e5                	mov    %esp,%ebp
+  800e39:	53                   	push   %ebx
+  800e3a:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800e3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e40:	50                   	push   %eax
+  800e41:	e8 23 f8 ff ff       	call   800669 <fd_alloc>
+  800e46:	89 c3                	mov    %eax,%ebx
+  800e48:	83 c4 10             	add    $0x10,%esp
+  800e4b:	85 c0                	test   %eax,%eax
+  800e4d:	78 2a                	js     800e79 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+  800e52:	ff 75 08             	push   0x8(%ebp)
+  800e55:	e8 46 23 00 00       	call   8031a0 <strlen>
+  800e5a:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e5d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e62:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e67:	7e 17                	jle    800e80 <open+0x4a>
+	fd_close(fd, 1);
+  800e69:	83 ec 08             	sub    $0x8,%esp
+  800e6c:	6a 01                	push   $0x1
+  800e6e:	ff 75 f4             	push   -0xc(%ebp)
+  800e71:	e8 08 f9 ff ff       	call   80077e <fd_close>
+	return r;
+  800e76:	83 c4 10             	add    $0x10,%esp
+}
+  800e79:	89 d8                	mov    %ebx,%eax
+  800e7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e7e:	c9                   	leave
+  800e7f:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e80:	83 ec 08             	sub    $0x8,%esp
+  800e83:	ff 75 08             	push   0x8(%ebp)
+  800e86:	68 00 60 80 00       	push   $0x806000
+  800e8b:	e8 5c 23 00 00       	call   8031ec <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e90:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e93:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e98:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea0:	e8 07 fe ff ff       	call   800cac <fsipc>
+  800ea5:	89 c3                	mov    %eax,%ebx
+  800ea7:	83 c4 10             	add    $0x10,%esp
+  800eaa:	85 c0                	test   %eax,%eax
+  800eac:	78 bb                	js     800e69 <open+0x33>
+	return fd2num(fd); 	
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	ff 75 f4             	push   -0xc(%ebp)
+  800eb4:	e8 89 f7 ff ff       	call   800642 <fd2num>
+  800eb9:	89 c3                	mov    %eax,%ebx
+  800ebb:	83 c4 10             	add    $0x10,%esp
+  800ebe:	eb b9                	jmp    800e79 <open+0x43>
+
+00800ec0 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	53                   	push   %ebx
+  800ec4:	83 ec 1c             	sub    $0x1c,%esp
+  800ec7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800eca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ecd:	50                   	push   %eax
+  800ece:	ff 75 08             	push   0x8(%ebp)
+  800ed1:	e8 e3 f7 ff ff       	call   8006b9 <fd_lookup>
+  800ed6:	83 c4 10             	add    $0x10,%esp
+  800ed9:	85 c0                	test   %eax,%eax
+  800edb:	78 5a                	js     800f37 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800edd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee0:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800ee6:	39 10                	cmp    %edx,(%eax)
+  800ee8:	75 66                	jne    800f50 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800eea:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800ef1:	74 49                	je     800f3c <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800ef3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ef6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ef9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800efe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f01:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800f06:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800f0c:	6a 07                	push   $0x7
+  800f0e:	68 00 60 80 00       	push   $0x806000
+  800f13:	6a 09                	push   $0x9
+  800f15:	ff 35 00 50 80 00    	push   0x805000
+  800f1b:	e8 12 29 00 00       	call   803832 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800f20:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800f27:	6a 00                	push   $0x0
+  800f29:	53                   	push   %ebx
+  800f2a:	ff 75 10             	push   0x10(%ebp)
+  800f2d:	6a 00                	push   $0x0
+  800f2f:	e8 3b 27 00 00       	call   80366f <ipc_recv_pages>
+  800f34:	83 c4 20             	add    $0x20,%esp
+}
+  800f37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f3a:	c9                   	leave
+  800f3b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f3c:	83 ec 0c             	sub    $0xc,%esp
+  800f3f:	6a 02                	push   $0x2
+  800f41:	e8 55 29 00 00       	call   80389b <ipc_find_env>
+  800f46:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f4b:	83 c4 10             	add    $0x10,%esp
+  800f4e:	eb a3                	jmp    800ef3 <fmap+0x33>
+		return -E_INVAL;
+  800f50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f55:	eb e0                	jmp    800f37 <fmap+0x77>
+
+00800f57 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	53                   	push   %ebx
+  800f5b:	83 ec 10             	sub    $0x10,%esp
+  800f5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f61:	53                   	push   %ebx
+  800f62:	e8 39 22 00 00       	call   8031a0 <strlen>
+  800f67:	83 c4 10             	add    $0x10,%esp
+  800f6a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f6f:	7f 25                	jg     800f96 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f71:	83 ec 08             	sub    $0x8,%esp
+  800f74:	53                   	push   %ebx
+  800f75:	68 00 60 80 00       	push   $0x806000
+  800f7a:	e8 6d 22 00 00       	call   8031ec <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f84:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f89:	e8 1e fd ff ff       	call   800cac <fsipc>
+  800f8e:	83 c4 10             	add    $0x10,%esp
+}
+  800f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f94:	c9                   	leave
+  800f95:	c3                   	ret
+		return -E_BAD_PATH;
+  800f96:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f9b:	eb f4                	jmp    800f91 <remove+0x3a>
+
+00800f9d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800fa3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fad:	e8 fa fc ff ff       	call   800cac <fsipc>
+}
+  800fb2:	c9                   	leave
+  800fb3:	c3                   	ret
+
+00800fb4 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800fba:	68 c8 3b 80 00       	push   $0x803bc8
+  800fbf:	ff 75 0c             	push   0xc(%ebp)
+  800fc2:	e8 25 22 00 00       	call   8031ec <strcpy>
+	return 0;
+}
+  800fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcc:	c9                   	leave
+  800fcd:	c3                   	ret
+
+00800fce <devsock_close>:
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	53                   	push   %ebx
+  800fd2:	83 ec 10             	sub    $0x10,%esp
+  800fd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800fd8:	53                   	push   %ebx
+  800fd9:	e8 fc 28 00 00       	call   8038da <pageref>
+  800fde:	89 c2                	mov    %eax,%edx
+  800fe0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fe8:	83 fa 01             	cmp    $0x1,%edx
+  800feb:	74 05                	je     800ff2 <devsock_close+0x24>
+}
+  800fed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ff0:	c9                   	leave
+  800ff1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800ff2:	83 ec 0c             	sub    $0xc,%esp
+  800ff5:	ff 73 0c             	push   0xc(%ebx)
+  800ff8:	e8 b0 05 00 00       	call   8015ad <nsipc_close>
+  800ffd:	83 c4 10             	add    $0x10,%esp
+  801000:	eb eb                	jmp    800fed <devsock_close+0x1f>
+
+00801002 <devsock_write>:
+{
+  801002:	55                   	push   %ebp
+  801003:	89 e5                	mov    %esp,%ebp
+  801005:	53                   	push   %ebx
+  801006:	83 ec 14             	sub    $0x14,%esp
+  801009:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80100c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80100f:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801012:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801015:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801018:	8b 41 08             	mov    0x8(%ecx),%eax
+  80101b:	c1 f8 09             	sar    $0x9,%eax
+  80101e:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801021:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801027:	77 13                	ja     80103c <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801029:	50                   	push   %eax
+  80102a:	52                   	push   %edx
+  80102b:	53                   	push   %ebx
+  80102c:	ff 71 0c             	push   0xc(%ecx)
+  80102f:	e8 5c 06 00 00       	call   801690 <nsipc_send>
+  801034:	83 c4 10             	add    $0x10,%esp
+}
+  801037:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80103a:	c9                   	leave
+  80103b:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80103c:	50                   	push   %eax
+  80103d:	6a 01                	push   $0x1
+  80103f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801042:	50                   	push   %eax
+  801043:	ff 71 0c             	push   0xc(%ecx)
+  801046:	e8 a6 06 00 00       	call   8016f1 <nsipc_sendmsg>
+  80104b:	83 c4 10             	add    $0x10,%esp
+  80104e:	eb e7                	jmp    801037 <devsock_write+0x35>
+
+00801050 <devsock_read>:
+{
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  801053:	53                   	push   %ebx
+  801054:	83 ec 14             	sub    $0x14,%esp
+  801057:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80105a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80105d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801060:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801063:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801066:	8b 41 08             	mov    0x8(%ecx),%eax
+  801069:	c1 f8 09             	sar    $0x9,%eax
+  80106c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80106f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801075:	77 13                	ja     80108a <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801077:	50                   	push   %eax
+  801078:	52                   	push   %edx
+  801079:	53                   	push   %ebx
+  80107a:	ff 71 0c             	push   0xc(%ecx)
+  80107d:	e8 9c 05 00 00       	call   80161e <nsipc_recv>
+  801082:	83 c4 10             	add    $0x10,%esp
+}
+  801085:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801088:	c9                   	leave
+  801089:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80108a:	50                   	push   %eax
+  80108b:	6a 01                	push   $0x1
+  80108d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801090:	50                   	push   %eax
+  801091:	ff 71 0c             	push   0xc(%ecx)
+  801094:	e8 02 0a 00 00       	call   801a9b <nsipc_recvmsg>
+  801099:	83 c4 10             	add    $0x10,%esp
+  80109c:	eb e7                	jmp    801085 <devsock_read+0x35>
+
+0080109e <fd2sockid>:
+{
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8010a4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8010a7:	52                   	push   %edx
+  8010a8:	50                   	push   %eax
+  8010a9:	e8 0b f6 ff ff       	call   8006b9 <fd_lookup>
+  8010ae:	83 c4 10             	add    $0x10,%esp
+  8010b1:	85 c0                	test   %eax,%eax
+  8010b3:	78 10                	js     8010c5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8010b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b8:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8010be:	39 08                	cmp    %ecx,(%eax)
+  8010c0:	75 05                	jne    8010c7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8010c2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8010c5:	c9                   	leave
+  8010c6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8010c7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8010cc:	eb f7                	jmp    8010c5 <fd2sockid+0x27>
+
+008010ce <sock_flags>:
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8010d4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8010d7:	52                   	push   %edx
+  8010d8:	50                   	push   %eax
+  8010d9:	e8 db f5 ff ff       	call   8006b9 <fd_lookup>
+  8010de:	83 c4 10             	add    $0x10,%esp
+  8010e1:	85 c0                	test   %eax,%eax
+  8010e3:	78 0e                	js     8010f3 <sock_flags+0x25>
+  8010e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010e8:	8b 40 08             	mov    0x8(%eax),%eax
+  8010eb:	c1 e8 09             	shr    $0x9,%eax
+  8010ee:	83 e0 08             	and    $0x8,%eax
+}
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+		return 0;
+  8010f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f8:	eb f7                	jmp    8010f1 <sock_flags+0x23>
+
+008010fa <alloc_sockfd>:
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	56                   	push   %esi
+  8010fe:	53                   	push   %ebx
+  8010ff:	83 ec 1c             	sub    $0x1c,%esp
+  801102:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801104:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801107:	50                   	push   %eax
+  801108:	e8 5c f5 ff ff       	call   800669 <fd_alloc>
+  80110d:	89 c3                	mov    %eax,%ebx
+  80110f:	83 c4 10             	add    $0x10,%esp
+  801112:	85 c0                	test   %eax,%eax
+  801114:	78 43                	js     801159 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801116:	83 ec 04             	sub    $0x4,%esp
+  801119:	68 07 04 00 00       	push   $0x407
+  80111e:	ff 75 f4             	push   -0xc(%ebp)
+  801121:	6a 00                	push   $0x0
+  801123:	e8 91 f0 ff ff       	call   8001b9 <sys_page_alloc>
+  801128:	89 c3                	mov    %eax,%ebx
+  80112a:	83 c4 10             	add    $0x10,%esp
+  80112d:	85 c0                	test   %eax,%eax
+  80112f:	78 28                	js     801159 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801131:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801134:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  80113a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80113c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80113f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801146:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801149:	83 ec 0c             	sub    $0xc,%esp
+  80114c:	50                   	push   %eax
+  80114d:	e8 f0 f4 ff ff       	call   800642 <fd2num>
+  801152:	89 c3                	mov    %eax,%ebx
+  801154:	83 c4 10             	add    $0x10,%esp
+  801157:	eb 0c                	jmp    801165 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801159:	83 ec 0c             	sub    $0xc,%esp
+  80115c:	56                   	push   %esi
+  80115d:	e8 4b 04 00 00       	call   8015ad <nsipc_close>
+		return r;
+  801162:	83 c4 10             	add    $0x10,%esp
+}
+  801165:	89 d8                	mov    %ebx,%eax
+  801167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80116a:	5b                   	pop    %ebx
+  80116b:	5e                   	pop    %esi
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+
+0080116e <accept>:
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	56                   	push   %esi
+  801172:	53                   	push   %ebx
+  801173:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801176:	89 f0                	mov    %esi,%eax
+  801178:	e8 21 ff ff ff       	call   80109e <fd2sockid>
+  80117d:	89 c3                	mov    %eax,%ebx
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	78 24                	js     8011a7 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801183:	89 f0                	mov    %esi,%eax
+  801185:	e8 44 ff ff ff       	call   8010ce <sock_flags>
+  80118a:	50                   	push   %eax
+  80118b:	ff 75 10             	push   0x10(%ebp)
+  80118e:	ff 75 0c             	push   0xc(%ebp)
+  801191:	53                   	push   %ebx
+  801192:	e8 6b 03 00 00       	call   801502 <nsipc_accept>
+  801197:	89 c3                	mov    %eax,%ebx
+  801199:	83 c4 10             	add    $0x10,%esp
+  80119c:	85 c0                	test   %eax,%eax
+  80119e:	78 07                	js     8011a7 <accept+0x39>
+	return alloc_sockfd(r);
+  8011a0:	e8 55 ff ff ff       	call   8010fa <alloc_sockfd>
+  8011a5:	89 c3                	mov    %eax,%ebx
+}
+  8011a7:	89 d8                	mov    %ebx,%eax
+  8011a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5e                   	pop    %esi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+
+008011b0 <bind>:
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011b9:	e8 e0 fe ff ff       	call   80109e <fd2sockid>
+  8011be:	85 c0                	test   %eax,%eax
+  8011c0:	78 12                	js     8011d4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8011c2:	83 ec 04             	sub    $0x4,%esp
+  8011c5:	ff 75 10             	push   0x10(%ebp)
+  8011c8:	ff 75 0c             	push   0xc(%ebp)
+  8011cb:	50                   	push   %eax
+  8011cc:	e8 85 03 00 00       	call   801556 <nsipc_bind>
+  8011d1:	83 c4 10             	add    $0x10,%esp
+}
+  8011d4:	c9                   	leave
+  8011d5:	c3                   	ret
+
+008011d6 <shutdown>:
+{
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011df:	e8 ba fe ff ff       	call   80109e <fd2sockid>
+  8011e4:	85 c0                	test   %eax,%eax
+  8011e6:	78 0f                	js     8011f7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011e8:	83 ec 08             	sub    $0x8,%esp
+  8011eb:	ff 75 0c             	push   0xc(%ebp)
+  8011ee:	50                   	push   %eax
+  8011ef:	e8 97 03 00 00       	call   80158b <nsipc_shutdown>
+  8011f4:	83 c4 10             	add    $0x10,%esp
+}
+  8011f7:	c9                   	leave
+  8011f8:	c3                   	ret
+
+008011f9 <connect>:
+{
+  8011f9:	55                   	push   %ebp
+  8011fa:	89 e5                	mov    %esp,%ebp
+  8011fc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801202:	e8 97 fe ff ff       	call   80109e <fd2sockid>
+  801207:	85 c0                	test   %eax,%eax
+  801209:	78 12                	js     80121d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80120b:	83 ec 04             	sub    $0x4,%esp
+  80120e:	ff 75 10             	push   0x10(%ebp)
+  801211:	ff 75 0c             	push   0xc(%ebp)
+  801214:	50                   	push   %eax
+  801215:	e8 ad 03 00 00       	call   8015c7 <nsipc_connect>
+  80121a:	83 c4 10             	add    $0x10,%esp
+}
+  80121d:	c9                   	leave
+  80121e:	c3                   	ret
+
+0080121f <listen>:
+{
+  80121f:	55                   	push   %ebp
+  801220:	89 e5                	mov    %esp,%ebp
+  801222:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801225:	8b 45 08             	mov    0x8(%ebp),%eax
+  801228:	e8 71 fe ff ff       	call   80109e <fd2sockid>
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	78 0f                	js     801240 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801231:	83 ec 08             	sub    $0x8,%esp
+  801234:	ff 75 0c             	push   0xc(%ebp)
+  801237:	50                   	push   %eax
+  801238:	e8 bf 03 00 00       	call   8015fc <nsipc_listen>
+  80123d:	83 c4 10             	add    $0x10,%esp
+}
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+
+00801242 <sendmsg>:
+{
+  801242:	55                   	push   %ebp
+  801243:	89 e5                	mov    %esp,%ebp
+  801245:	57                   	push   %edi
+  801246:	56                   	push   %esi
+  801247:	53                   	push   %ebx
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80124e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801251:	89 f0                	mov    %esi,%eax
+  801253:	e8 46 fe ff ff       	call   80109e <fd2sockid>
+  801258:	89 c3                	mov    %eax,%ebx
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	78 1c                	js     80127a <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80125e:	89 f0                	mov    %esi,%eax
+  801260:	e8 69 fe ff ff       	call   8010ce <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801265:	0b 45 10             	or     0x10(%ebp),%eax
+  801268:	50                   	push   %eax
+  801269:	ff 77 0c             	push   0xc(%edi)
+  80126c:	ff 77 08             	push   0x8(%edi)
+  80126f:	53                   	push   %ebx
+  801270:	e8 7c 04 00 00       	call   8016f1 <nsipc_sendmsg>
+  801275:	89 c3                	mov    %eax,%ebx
+  801277:	83 c4 10             	add    $0x10,%esp
+}
+  80127a:	89 d8                	mov    %ebx,%eax
+  80127c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <recvmsg>:
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+  80128d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801290:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801293:	89 f8                	mov    %edi,%eax
+  801295:	e8 04 fe ff ff       	call   80109e <fd2sockid>
+  80129a:	89 c3                	mov    %eax,%ebx
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	78 2a                	js     8012ca <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8012a0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8012a7:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8012ae:	89 f8                	mov    %edi,%eax
+  8012b0:	e8 19 fe ff ff       	call   8010ce <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8012b5:	0b 45 10             	or     0x10(%ebp),%eax
+  8012b8:	50                   	push   %eax
+  8012b9:	ff 76 0c             	push   0xc(%esi)
+  8012bc:	ff 76 08             	push   0x8(%esi)
+  8012bf:	53                   	push   %ebx
+  8012c0:	e8 d6 07 00 00       	call   801a9b <nsipc_recvmsg>
+  8012c5:	89 c3                	mov    %eax,%ebx
+  8012c7:	83 c4 10             	add    $0x10,%esp
+}
+  8012ca:	89 d8                	mov    %ebx,%eax
+  8012cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5e                   	pop    %esi
+  8012d1:	5f                   	pop    %edi
+  8012d2:	5d                   	pop    %ebp
+  8012d3:	c3                   	ret
+
+008012d4 <sendfile>:
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	56                   	push   %esi
+  8012d8:	53                   	push   %ebx
+  8012d9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8012dc:	89 f0                	mov    %esi,%eax
+  8012de:	e8 bb fd ff ff       	call   80109e <fd2sockid>
+  8012e3:	89 c3                	mov    %eax,%ebx
+  8012e5:	85 c0                	test   %eax,%eax
+  8012e7:	78 1f                	js     801308 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012e9:	89 f0                	mov    %esi,%eax
+  8012eb:	e8 de fd ff ff       	call   8010ce <sock_flags>
+  8012f0:	83 ec 0c             	sub    $0xc,%esp
+  8012f3:	50                   	push   %eax
+  8012f4:	ff 75 14             	push   0x14(%ebp)
+  8012f7:	ff 75 10             	push   0x10(%ebp)
+  8012fa:	ff 75 0c             	push   0xc(%ebp)
+  8012fd:	53                   	push   %ebx
+  8012fe:	e8 64 06 00 00       	call   801967 <nsipc_sendfile>
+  801303:	89 c3                	mov    %eax,%ebx
+  801305:	83 c4 20             	add    $0x20,%esp
+}
+  801308:	89 d8                	mov    %ebx,%eax
+  80130a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80130d:	5b                   	pop    %ebx
+  80130e:	5e                   	pop    %esi
+  80130f:	5d                   	pop    %ebp
+  801310:	c3                   	ret
+
+00801311 <evctl>:
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	53                   	push   %ebx
+  801315:	83 ec 04             	sub    $0x4,%esp
+  801318:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80131b:	89 d8                	mov    %ebx,%eax
+  80131d:	e8 7c fd ff ff       	call   80109e <fd2sockid>
+  801322:	85 c0                	test   %eax,%eax
+  801324:	78 10                	js     801336 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801326:	83 ec 04             	sub    $0x4,%esp
+  801329:	53                   	push   %ebx
+  80132a:	ff 75 0c             	push   0xc(%ebp)
+  80132d:	50                   	push   %eax
+  80132e:	e8 d2 0b 00 00       	call   801f05 <nsipc_evctl>
+  801333:	83 c4 10             	add    $0x10,%esp
+}
+  801336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801339:	c9                   	leave
+  80133a:	c3                   	ret
+
+0080133b <evwait>:
+{
+  80133b:	55                   	push   %ebp
+  80133c:	89 e5                	mov    %esp,%ebp
+  80133e:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801341:	ff 75 10             	push   0x10(%ebp)
+  801344:	ff 75 0c             	push   0xc(%ebp)
+  801347:	ff 75 08             	push   0x8(%ebp)
+  80134a:	e8 e0 0b 00 00       	call   801f2f <nsipc_evwait>
+}
+  80134f:	c9                   	leave
+  801350:	c3                   	ret
+
+00801351 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801357:	ff 75 10             	push   0x10(%ebp)
+  80135a:	ff 75 0c             	push   0xc(%ebp)
+  80135d:	ff 75 08             	push   0x8(%ebp)
+  801360:	e8 31 0c 00 00       	call   801f96 <nsipc_socket>
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	85 c0                	test   %eax,%eax
+  80136a:	78 05                	js     801371 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80136c:	e8 89 fd ff ff       	call   8010fa <alloc_sockfd>
+}
+  801371:	c9                   	leave
+  801372:	c3                   	ret
+
+00801373 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	53                   	push   %ebx
+  801377:	83 ec 04             	sub    $0x4,%esp
+  80137a:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80137c:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801383:	74 26                	je     8013ab <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801385:	6a 07                	push   $0x7
+  801387:	68 00 70 80 00       	push   $0x807000
+  80138c:	53                   	push   %ebx
+  80138d:	ff 35 24 53 80 00    	push   0x805324
+  801393:	e8 9a 24 00 00       	call   803832 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801398:	83 c4 0c             	add    $0xc,%esp
+  80139b:	6a 00                	push   $0x0
+  80139d:	6a 00                	push   $0x0
+  80139f:	6a 00                	push   $0x0
+  8013a1:	e8 fc 21 00 00       	call   8035a2 <ipc_recv>
+}
+  8013a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013a9:	c9                   	leave
+  8013aa:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+  8013ae:	6a 03                	push   $0x3
+  8013b0:	e8 e6 24 00 00       	call   80389b <ipc_find_env>
+  8013b5:	a3 24 53 80 00       	mov    %eax,0x805324
+  8013ba:	83 c4 10             	add    $0x10,%esp
+  8013bd:	eb c6                	jmp    801385 <nsipc+0x12>
+
+008013bf <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	56                   	push   %esi
+  8013c3:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8013c4:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  8013ca:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8013cf:	85 f6                	test   %esi,%esi
+  8013d1:	75 33                	jne    801406 <nsbulk_map+0x47>
+  8013d3:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8013d8:	83 ec 04             	sub    $0x4,%esp
+  8013db:	6a 07                	push   $0x7
+  8013dd:	53                   	push   %ebx
+  8013de:	6a 00                	push   $0x0
+  8013e0:	e8 d4 ed ff ff       	call   8001b9 <sys_page_alloc>
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	85 c0                	test   %eax,%eax
+  8013ea:	78 1a                	js     801406 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013ec:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013f2:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013f8:	75 de                	jne    8013d8 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013fa:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  801401:	00 00 00 
+	return 0;
+  801404:	89 f0                	mov    %esi,%eax
+}
+  801406:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801409:	5b                   	pop    %ebx
+  80140a:	5e                   	pop    %esi
+  80140b:	5d                   	pop    %ebp
+  80140c:	c3                   	ret
+
+0080140d <nsbulk_own>:
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	57                   	push   %edi
+  801411:	56                   	push   %esi
+  801412:	53                   	push   %ebx
+  801413:	83 ec 0c             	sub    $0xc,%esp
+  801416:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801418:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80141b:	85 d2                	test   %edx,%edx
+  80141d:	7f 0e                	jg     80142d <nsbulk_own+0x20>
+	return 0;
+  80141f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801424:	eb 47                	jmp    80146d <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801426:	83 c3 01             	add    $0x1,%ebx
+  801429:	39 fb                	cmp    %edi,%ebx
+  80142b:	7d 3b                	jge    801468 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80142d:	be 01 00 00 00       	mov    $0x1,%esi
+  801432:	89 d9                	mov    %ebx,%ecx
+  801434:	d3 e6                	shl    %cl,%esi
+  801436:	89 f0                	mov    %esi,%eax
+  801438:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  80143e:	74 e6                	je     801426 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801440:	83 ec 04             	sub    $0x4,%esp
+  801443:	6a 07                	push   $0x7
+  801445:	89 d8                	mov    %ebx,%eax
+  801447:	c1 e0 0c             	shl    $0xc,%eax
+  80144a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80144f:	50                   	push   %eax
+  801450:	6a 00                	push   $0x0
+  801452:	e8 62 ed ff ff       	call   8001b9 <sys_page_alloc>
+  801457:	83 c4 10             	add    $0x10,%esp
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	78 0f                	js     80146d <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80145e:	f7 d6                	not    %esi
+  801460:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801466:	eb be                	jmp    801426 <nsbulk_own+0x19>
+	return 0;
+  801468:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80146d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+
+00801475 <nsipc_bulk>:
+{
+  801475:	55                   	push   %ebp
+  801476:	89 e5                	mov    %esp,%ebp
+  801478:	57                   	push   %edi
+  801479:	56                   	push   %esi
+  80147a:	53                   	push   %ebx
+  80147b:	83 ec 1c             	sub    $0x1c,%esp
+  80147e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801481:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801483:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801489:	c1 fb 0c             	sar    $0xc,%ebx
+  80148c:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80148f:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801496:	74 56                	je     8014ee <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801498:	85 ff                	test   %edi,%edi
+  80149a:	7e 24                	jle    8014c0 <nsipc_bulk+0x4b>
+  80149c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8014a2:	74 1c                	je     8014c0 <nsipc_bulk+0x4b>
+  8014a4:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8014aa:	c1 e3 0c             	shl    $0xc,%ebx
+  8014ad:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8014b2:	0f b6 10             	movzbl (%eax),%edx
+  8014b5:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8014b7:	05 00 10 00 00       	add    $0x1000,%eax
+  8014bc:	39 d8                	cmp    %ebx,%eax
+  8014be:	75 f2                	jne    8014b2 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8014c0:	83 ec 0c             	sub    $0xc,%esp
+  8014c3:	56                   	push   %esi
+  8014c4:	57                   	push   %edi
+  8014c5:	68 00 00 00 e0       	push   $0xe0000000
+  8014ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8014cd:	ff 35 24 53 80 00    	push   0x805324
+  8014d3:	e8 8e 23 00 00       	call   803866 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8014d8:	83 c4 1c             	add    $0x1c,%esp
+  8014db:	6a 00                	push   $0x0
+  8014dd:	6a 00                	push   $0x0
+  8014df:	6a 00                	push   $0x0
+  8014e1:	e8 bc 20 00 00       	call   8035a2 <ipc_recv>
+}
+  8014e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e9:	5b                   	pop    %ebx
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5f                   	pop    %edi
+  8014ec:	5d                   	pop    %ebp
+  8014ed:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014ee:	83 ec 0c             	sub    $0xc,%esp
+  8014f1:	6a 03                	push   $0x3
+  8014f3:	e8 a3 23 00 00       	call   80389b <ipc_find_env>
+  8014f8:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014fd:	83 c4 10             	add    $0x10,%esp
+  801500:	eb 96                	jmp    801498 <nsipc_bulk+0x23>
+
+00801502 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	53                   	push   %ebx
+  801506:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801509:	8b 45 08             	mov    0x8(%ebp),%eax
+  80150c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  801511:	8b 45 14             	mov    0x14(%ebp),%eax
+  801514:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801519:	b8 01 00 00 00       	mov    $0x1,%eax
+  80151e:	e8 50 fe ff ff       	call   801373 <nsipc>
+  801523:	89 c3                	mov    %eax,%ebx
+  801525:	85 c0                	test   %eax,%eax
+  801527:	79 07                	jns    801530 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801529:	89 d8                	mov    %ebx,%eax
+  80152b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80152e:	c9                   	leave
+  80152f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801530:	83 ec 04             	sub    $0x4,%esp
+  801533:	ff 35 10 70 80 00    	push   0x807010
+  801539:	68 00 70 80 00       	push   $0x807000
+  80153e:	ff 75 0c             	push   0xc(%ebp)
+  801541:	e8 56 1e 00 00       	call   80339c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801546:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80154c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80154f:	89 10                	mov    %edx,(%eax)
+  801551:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801554:	eb d3                	jmp    801529 <nsipc_accept+0x27>
+
+00801556 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801556:	55                   	push   %ebp
+  801557:	89 e5                	mov    %esp,%ebp
+  801559:	53                   	push   %ebx
+  80155a:	83 ec 08             	sub    $0x8,%esp
+  80155d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801560:	8b 45 08             	mov    0x8(%ebp),%eax
+  801563:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801568:	53                   	push   %ebx
+  801569:	ff 75 0c             	push   0xc(%ebp)
+  80156c:	68 04 70 80 00       	push   $0x807004
+  801571:	e8 26 1e 00 00       	call   80339c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801576:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80157c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801581:	e8 ed fd ff ff       	call   801373 <nsipc>
+}
+  801586:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801589:	c9                   	leave
+  80158a:	c3                   	ret
+
+0080158b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801591:	8b 45 08             	mov    0x8(%ebp),%eax
+  801594:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801599:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80159c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8015a1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015a6:	e8 c8 fd ff ff       	call   801373 <nsipc>
+}
+  8015ab:	c9                   	leave
+  8015ac:	c3                   	ret
+
+008015ad <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8015ad:	55                   	push   %ebp
+  8015ae:	89 e5                	mov    %esp,%ebp
+  8015b0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8015b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b6:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8015bb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015c0:	e8 ae fd ff ff       	call   801373 <nsipc>
+}
+  8015c5:	c9                   	leave
+  8015c6:	c3                   	ret
+
+008015c7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	53                   	push   %ebx
+  8015cb:	83 ec 08             	sub    $0x8,%esp
+  8015ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8015d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d4:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8015d9:	53                   	push   %ebx
+  8015da:	ff 75 0c             	push   0xc(%ebp)
+  8015dd:	68 04 70 80 00       	push   $0x807004
+  8015e2:	e8 b5 1d 00 00       	call   80339c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015e7:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015ed:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015f2:	e8 7c fd ff ff       	call   801373 <nsipc>
+}
+  8015f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015fa:	c9                   	leave
+  8015fb:	c3                   	ret
+
+008015fc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015fc:	55                   	push   %ebp
+  8015fd:	89 e5                	mov    %esp,%ebp
+  8015ff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801602:	8b 45 08             	mov    0x8(%ebp),%eax
+  801605:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80160a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80160d:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801612:	b8 06 00 00 00       	mov    $0x6,%eax
+  801617:	e8 57 fd ff ff       	call   801373 <nsipc>
+}
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+0080161e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80161e:	55                   	push   %ebp
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	56                   	push   %esi
+  801622:	53                   	push   %ebx
+  801623:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801626:	8b 45 08             	mov    0x8(%ebp),%eax
+  801629:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80162e:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801634:	8b 45 14             	mov    0x14(%ebp),%eax
+  801637:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80163c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801641:	e8 2d fd ff ff       	call   801373 <nsipc>
+  801646:	89 c3                	mov    %eax,%ebx
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	78 22                	js     80166e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80164c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801651:	39 c6                	cmp    %eax,%esi
+  801653:	0f 4e c6             	cmovle %esi,%eax
+  801656:	39 c3                	cmp    %eax,%ebx
+  801658:	7f 1d                	jg     801677 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80165a:	83 ec 04             	sub    $0x4,%esp
+  80165d:	53                   	push   %ebx
+  80165e:	68 00 70 80 00       	push   $0x807000
+  801663:	ff 75 0c             	push   0xc(%ebp)
+  801666:	e8 31 1d 00 00       	call   80339c <memmove>
+  80166b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80166e:	89 d8                	mov    %ebx,%eax
+  801670:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801673:	5b                   	pop    %ebx
+  801674:	5e                   	pop    %esi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801677:	68 d4 3b 80 00       	push   $0x803bd4
+  80167c:	68 e9 3b 80 00       	push   $0x803be9
+  801681:	68 b2 00 00 00       	push   $0xb2
+  801686:	68 fe 3b 80 00       	push   $0x803bfe
+  80168b:	e8 8a 13 00 00       	call   802a1a <_panic>
+
+00801690 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	53                   	push   %ebx
+  801694:	83 ec 04             	sub    $0x4,%esp
+  801697:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80169a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169d:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8016a2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8016a8:	7f 2e                	jg     8016d8 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8016aa:	83 ec 04             	sub    $0x4,%esp
+  8016ad:	53                   	push   %ebx
+  8016ae:	ff 75 0c             	push   0xc(%ebp)
+  8016b1:	68 0c 70 80 00       	push   $0x80700c
+  8016b6:	e8 e1 1c 00 00       	call   80339c <memmove>
+	nsipcbuf.send.req_size = size;
+  8016bb:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8016c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8016c4:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8016c9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016ce:	e8 a0 fc ff ff       	call   801373 <nsipc>
+}
+  8016d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d6:	c9                   	leave
+  8016d7:	c3                   	ret
+	assert(size < 1600);
+  8016d8:	68 0a 3c 80 00       	push   $0x803c0a
+  8016dd:	68 e9 3b 80 00       	push   $0x803be9
+  8016e2:	68 bd 00 00 00       	push   $0xbd
+  8016e7:	68 fe 3b 80 00       	push   $0x803bfe
+  8016ec:	e8 29 13 00 00       	call   802a1a <_panic>
+
+008016f1 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	57                   	push   %edi
+  8016f5:	56                   	push   %esi
+  8016f6:	53                   	push   %ebx
+  8016f7:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016fa:	e8 c0 fc ff ff       	call   8013bf <nsbulk_map>
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	78 55                	js     801758 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  801703:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  80170a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  801711:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801718:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80171b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80171e:	0f 8d 24 02 00 00    	jge    801948 <nsipc_sendmsg+0x257>
+  801724:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801727:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80172a:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80172d:	89 d8                	mov    %ebx,%eax
+  80172f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801734:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  801736:	83 ec 0c             	sub    $0xc,%esp
+  801739:	68 20 50 80 00       	push   $0x805020
+  80173e:	e8 5a 0f 00 00       	call   80269d <pgbatch_init>
+  801743:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801746:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801748:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80174b:	e9 82 00 00 00       	jmp    8017d2 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  801750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801753:	85 db                	test   %ebx,%ebx
+  801755:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801758:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80175b:	5b                   	pop    %ebx
+  80175c:	5e                   	pop    %esi
+  80175d:	5f                   	pop    %edi
+  80175e:	5d                   	pop    %ebp
+  80175f:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  801760:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801765:	29 c8                	sub    %ecx,%eax
+  801767:	39 d0                	cmp    %edx,%eax
+  801769:	0f 46 d0             	cmovbe %eax,%edx
+  80176c:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80176e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801774:	85 ff                	test   %edi,%edi
+  801776:	0f 49 c7             	cmovns %edi,%eax
+  801779:	c1 f8 0c             	sar    $0xc,%eax
+  80177c:	ba 01 00 00 00       	mov    $0x1,%edx
+  801781:	e8 87 fc ff ff       	call   80140d <nsbulk_own>
+  801786:	85 c0                	test   %eax,%eax
+  801788:	0f 88 17 01 00 00    	js     8018a5 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80178e:	83 ec 04             	sub    $0x4,%esp
+  801791:	56                   	push   %esi
+  801792:	ff 75 e0             	push   -0x20(%ebp)
+  801795:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801798:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80179d:	50                   	push   %eax
+  80179e:	e8 f9 1b 00 00       	call   80339c <memmove>
+  8017a3:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8017a6:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8017a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017ac:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8017af:	0f 84 fd 00 00 00    	je     8018b2 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8017b5:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8017b8:	01 f7                	add    %esi,%edi
+  8017ba:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8017bd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8017c0:	0f 8d 01 01 00 00    	jge    8018c7 <nsipc_sendmsg+0x1d6>
+  8017c6:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8017cc:	0f 8f f0 00 00 00    	jg     8018c2 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8017d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017d5:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8017d8:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8017db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017de:	89 c2                	mov    %eax,%edx
+  8017e0:	03 13                	add    (%ebx),%edx
+  8017e2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017e5:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017e8:	29 c6                	sub    %eax,%esi
+  8017ea:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017ef:	29 f9                	sub    %edi,%ecx
+  8017f1:	39 ce                	cmp    %ecx,%esi
+  8017f3:	89 ca                	mov    %ecx,%edx
+  8017f5:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017f8:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017fb:	89 f9                	mov    %edi,%ecx
+  8017fd:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  801803:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801806:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80180b:	09 c8                	or     %ecx,%eax
+  80180d:	0f 85 4d ff ff ff    	jne    801760 <nsipc_sendmsg+0x6f>
+  801813:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801819:	0f 86 41 ff ff ff    	jbe    801760 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80181f:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801825:	85 ff                	test   %edi,%edi
+  801827:	0f 49 c7             	cmovns %edi,%eax
+  80182a:	c1 f8 0c             	sar    $0xc,%eax
+  80182d:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80182f:	89 d1                	mov    %edx,%ecx
+  801831:	c1 e9 0c             	shr    $0xc,%ecx
+  801834:	01 c8                	add    %ecx,%eax
+  801836:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801839:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80183c:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80183e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801841:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801846:	29 c8                	sub    %ecx,%eax
+  801848:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80184b:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80184e:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801850:	b8 01 00 00 00       	mov    $0x1,%eax
+  801855:	89 f9                	mov    %edi,%ecx
+  801857:	d3 e0                	shl    %cl,%eax
+  801859:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80185f:	83 ec 08             	sub    $0x8,%esp
+  801862:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801864:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801867:	50                   	push   %eax
+  801868:	6a 00                	push   $0x0
+  80186a:	56                   	push   %esi
+  80186b:	6a 00                	push   $0x0
+  80186d:	68 20 50 80 00       	push   $0x805020
+  801872:	e8 e4 0e 00 00       	call   80275b <pgbatch_map>
+  801877:	83 c4 20             	add    $0x20,%esp
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	0f 88 ce fe ff ff    	js     801750 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  801882:	83 c7 01             	add    $0x1,%edi
+  801885:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80188b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80188e:	39 c7                	cmp    %eax,%edi
+  801890:	75 be                	jne    801850 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  801892:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801895:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801898:	89 d6                	mov    %edx,%esi
+  80189a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8018a0:	e9 01 ff ff ff       	jmp    8017a6 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8018a5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018a8:	85 db                	test   %ebx,%ebx
+  8018aa:	0f 45 c3             	cmovne %ebx,%eax
+  8018ad:	e9 a6 fe ff ff       	jmp    801758 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8018b2:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8018b6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8018bd:	e9 f3 fe ff ff       	jmp    8017b5 <nsipc_sendmsg+0xc4>
+  8018c2:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8018c5:	eb 03                	jmp    8018ca <nsipc_sendmsg+0x1d9>
+  8018c7:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8018ca:	83 ec 0c             	sub    $0xc,%esp
+  8018cd:	68 20 50 80 00       	push   $0x805020
+  8018d2:	e8 d4 0d 00 00       	call   8026ab <pgbatch_flush>
+  8018d7:	83 c4 10             	add    $0x10,%esp
+  8018da:	85 c0                	test   %eax,%eax
+  8018dc:	78 50                	js     80192e <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8018de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018e6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018ec:	89 fb                	mov    %edi,%ebx
+  8018ee:	29 f3                	sub    %esi,%ebx
+  8018f0:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018f9:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018fe:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801903:	89 fa                	mov    %edi,%edx
+  801905:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80190a:	e8 66 fb ff ff       	call   801475 <nsipc_bulk>
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	78 28                	js     80193b <nsipc_sendmsg+0x24a>
+		sent += r;
+  801913:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  801916:	39 c3                	cmp    %eax,%ebx
+  801918:	75 0c                	jne    801926 <nsipc_sendmsg+0x235>
+  80191a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80191d:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801920:	0f 8f f2 fd ff ff    	jg     801718 <nsipc_sendmsg+0x27>
+		sent += r;
+  801926:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801929:	e9 2a fe ff ff       	jmp    801758 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80192e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801931:	85 db                	test   %ebx,%ebx
+  801933:	0f 45 c3             	cmovne %ebx,%eax
+  801936:	e9 1d fe ff ff       	jmp    801758 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80193b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80193e:	85 db                	test   %ebx,%ebx
+  801940:	0f 45 c3             	cmovne %ebx,%eax
+  801943:	e9 10 fe ff ff       	jmp    801758 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801948:	83 ec 0c             	sub    $0xc,%esp
+  80194b:	68 20 50 80 00       	push   $0x805020
+  801950:	e8 48 0d 00 00       	call   80269d <pgbatch_init>
+  801955:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801958:	be 00 00 00 00       	mov    $0x0,%esi
+  80195d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801962:	e9 63 ff ff ff       	jmp    8018ca <nsipc_sendmsg+0x1d9>
+
+00801967 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801967:	55                   	push   %ebp
+  801968:	89 e5                	mov    %esp,%ebp
+  80196a:	57                   	push   %edi
+  80196b:	56                   	push   %esi
+  80196c:	53                   	push   %ebx
+  80196d:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  801970:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  801977:	0f 84 c8 00 00 00    	je     801a45 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80197d:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801984:	0f 84 e4 00 00 00    	je     801a6e <nsipc_sendfile+0x107>
+{
+  80198a:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80198f:	89 fb                	mov    %edi,%ebx
+  801991:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801994:	0f 83 f0 00 00 00    	jae    801a8a <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80199a:	89 fa                	mov    %edi,%edx
+  80199c:	03 55 10             	add    0x10(%ebp),%edx
+  80199f:	89 d0                	mov    %edx,%eax
+  8019a1:	c1 f8 1f             	sar    $0x1f,%eax
+  8019a4:	c1 e8 14             	shr    $0x14,%eax
+  8019a7:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8019aa:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8019b0:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8019b2:	6a 10                	push   $0x10
+  8019b4:	68 00 20 01 e0       	push   $0xe0012000
+  8019b9:	52                   	push   %edx
+  8019ba:	ff 75 0c             	push   0xc(%ebp)
+  8019bd:	e8 fe f4 ff ff       	call   800ec0 <fmap>
+  8019c2:	83 c4 10             	add    $0x10,%esp
+  8019c5:	85 c0                	test   %eax,%eax
+  8019c7:	0f 8e b8 00 00 00    	jle    801a85 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8019cd:	39 c6                	cmp    %eax,%esi
+  8019cf:	0f 8d b5 00 00 00    	jge    801a8a <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8019d5:	29 f0                	sub    %esi,%eax
+  8019d7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8019da:	29 da                	sub    %ebx,%edx
+  8019dc:	39 d0                	cmp    %edx,%eax
+  8019de:	89 d3                	mov    %edx,%ebx
+  8019e0:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8019e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e6:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019eb:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019f1:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019f7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019fa:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019ff:	83 ec 0c             	sub    $0xc,%esp
+  801a02:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  801a04:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  801a0b:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  801a0e:	83 c0 01             	add    $0x1,%eax
+  801a11:	50                   	push   %eax
+  801a12:	68 00 10 01 e0       	push   $0xe0011000
+  801a17:	6a 11                	push   $0x11
+  801a19:	ff 35 24 53 80 00    	push   0x805324
+  801a1f:	e8 42 1e 00 00       	call   803866 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a24:	83 c4 1c             	add    $0x1c,%esp
+  801a27:	6a 00                	push   $0x0
+  801a29:	6a 00                	push   $0x0
+  801a2b:	6a 00                	push   $0x0
+  801a2d:	e8 70 1b 00 00       	call   8035a2 <ipc_recv>
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	85 c0                	test   %eax,%eax
+  801a37:	78 5b                	js     801a94 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  801a39:	01 c7                	add    %eax,%edi
+		if (r < n)
+  801a3b:	39 c3                	cmp    %eax,%ebx
+  801a3d:	0f 8e 4c ff ff ff    	jle    80198f <nsipc_sendfile+0x28>
+  801a43:	eb 45                	jmp    801a8a <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a45:	83 ec 04             	sub    $0x4,%esp
+  801a48:	6a 07                	push   $0x7
+  801a4a:	68 00 10 01 e0       	push   $0xe0011000
+  801a4f:	6a 00                	push   $0x0
+  801a51:	e8 63 e7 ff ff       	call   8001b9 <sys_page_alloc>
+  801a56:	89 c7                	mov    %eax,%edi
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	78 2b                	js     801a8a <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a5f:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a66:	00 00 00 
+  801a69:	e9 0f ff ff ff       	jmp    80197d <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a6e:	83 ec 0c             	sub    $0xc,%esp
+  801a71:	6a 03                	push   $0x3
+  801a73:	e8 23 1e 00 00       	call   80389b <ipc_find_env>
+  801a78:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a7d:	83 c4 10             	add    $0x10,%esp
+  801a80:	e9 05 ff ff ff       	jmp    80198a <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a85:	85 ff                	test   %edi,%edi
+  801a87:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a8a:	89 f8                	mov    %edi,%eax
+  801a8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a8f:	5b                   	pop    %ebx
+  801a90:	5e                   	pop    %esi
+  801a91:	5f                   	pop    %edi
+  801a92:	5d                   	pop    %ebp
+  801a93:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a94:	85 ff                	test   %edi,%edi
+  801a96:	0f 44 f8             	cmove  %eax,%edi
+  801a99:	eb ef                	jmp    801a8a <nsipc_sendfile+0x123>
+
+00801a9b <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	57                   	push   %edi
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+  801aa1:	83 ec 1c             	sub    $0x1c,%esp
+  801aa4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801aa7:	e8 13 f9 ff ff       	call   8013bf <nsbulk_map>
+  801aac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801aaf:	85 c0                	test   %eax,%eax
+  801ab1:	0f 88 ba 00 00 00    	js     801b71 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ab7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801abb:	0f 8e bb 00 00 00    	jle    801b7c <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801ac1:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ac6:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801acb:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801ad0:	89 f8                	mov    %edi,%eax
+  801ad2:	29 f0                	sub    %esi,%eax
+  801ad4:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801ad8:	39 c8                	cmp    %ecx,%eax
+  801ada:	0f 47 c1             	cmova  %ecx,%eax
+  801add:	01 f0                	add    %esi,%eax
+  801adf:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ae1:	83 c2 01             	add    $0x1,%edx
+  801ae4:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801ae7:	7e 07                	jle    801af0 <nsipc_recvmsg+0x55>
+  801ae9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801aee:	7e e0                	jle    801ad0 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801af0:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801af6:	c1 fa 0c             	sar    $0xc,%edx
+  801af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afe:	e8 0a f9 ff ff       	call   80140d <nsbulk_own>
+  801b03:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	78 67                	js     801b71 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b0d:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801b12:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801b18:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b1b:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801b20:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801b25:	89 f2                	mov    %esi,%edx
+  801b27:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b2c:	e8 44 f9 ff ff       	call   801475 <nsipc_bulk>
+  801b31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 39                	js     801b71 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801b38:	39 f0                	cmp    %esi,%eax
+  801b3a:	7f 4a                	jg     801b86 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801b3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b41:	85 c0                	test   %eax,%eax
+  801b43:	7e 2c                	jle    801b71 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b45:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b48:	29 fe                	sub    %edi,%esi
+  801b4a:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b4d:	39 c6                	cmp    %eax,%esi
+  801b4f:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b52:	83 ec 04             	sub    $0x4,%esp
+  801b55:	56                   	push   %esi
+  801b56:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b5c:	50                   	push   %eax
+  801b5d:	ff 33                	push   (%ebx)
+  801b5f:	e8 38 18 00 00       	call   80339c <memmove>
+		n += m;
+  801b64:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b66:	83 c3 08             	add    $0x8,%ebx
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b6f:	7f d4                	jg     801b45 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b71:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b77:	5b                   	pop    %ebx
+  801b78:	5e                   	pop    %esi
+  801b79:	5f                   	pop    %edi
+  801b7a:	5d                   	pop    %ebp
+  801b7b:	c3                   	ret
+	int r, i, n, len = 0;
+  801b7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b81:	e9 6a ff ff ff       	jmp    801af0 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b86:	68 e0 3b 80 00       	push   $0x803be0
+  801b8b:	68 e9 3b 80 00       	push   $0x803be9
+  801b90:	68 3b 01 00 00       	push   $0x13b
+  801b95:	68 fe 3b 80 00       	push   $0x803bfe
+  801b9a:	e8 7b 0e 00 00       	call   802a1a <_panic>
+
+00801b9f <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	57                   	push   %edi
+  801ba3:	56                   	push   %esi
+  801ba4:	53                   	push   %ebx
+  801ba5:	83 ec 0c             	sub    $0xc,%esp
+  801ba8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801bab:	8b 75 10             	mov    0x10(%ebp),%esi
+  801bae:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801bb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801bb9:	8b 07                	mov    (%edi),%eax
+  801bbb:	a3 04 70 80 00       	mov    %eax,0x807004
+  801bc0:	8b 47 04             	mov    0x4(%edi),%eax
+  801bc3:	a3 08 70 80 00       	mov    %eax,0x807008
+  801bc8:	8b 47 08             	mov    0x8(%edi),%eax
+  801bcb:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801bd0:	8b 47 0c             	mov    0xc(%edi),%eax
+  801bd3:	a3 10 70 80 00       	mov    %eax,0x807010
+  801bd8:	8b 47 10             	mov    0x10(%edi),%eax
+  801bdb:	a3 14 70 80 00       	mov    %eax,0x807014
+  801be0:	8b 47 14             	mov    0x14(%edi),%eax
+  801be3:	a3 18 70 80 00       	mov    %eax,0x807018
+  801be8:	8b 47 18             	mov    0x18(%edi),%eax
+  801beb:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bf0:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bf3:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bf8:	8b 47 20             	mov    0x20(%edi),%eax
+  801bfb:	a3 24 70 80 00       	mov    %eax,0x807024
+  801c00:	8b 47 24             	mov    0x24(%edi),%eax
+  801c03:	a3 28 70 80 00       	mov    %eax,0x807028
+  801c08:	8b 47 28             	mov    0x28(%edi),%eax
+  801c0b:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801c10:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801c13:	a3 30 70 80 00       	mov    %eax,0x807030
+  801c18:	8b 47 30             	mov    0x30(%edi),%eax
+  801c1b:	a3 34 70 80 00       	mov    %eax,0x807034
+  801c20:	8b 47 34             	mov    0x34(%edi),%eax
+  801c23:	a3 38 70 80 00       	mov    %eax,0x807038
+  801c28:	8b 47 38             	mov    0x38(%edi),%eax
+  801c2b:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801c30:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801c33:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801c38:	8b 06                	mov    (%esi),%eax
+  801c3a:	a3 44 70 80 00       	mov    %eax,0x807044
+  801c3f:	8b 46 04             	mov    0x4(%esi),%eax
+  801c42:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c47:	8b 46 08             	mov    0x8(%esi),%eax
+  801c4a:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c4f:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c52:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c57:	8b 46 10             	mov    0x10(%esi),%eax
+  801c5a:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c5f:	8b 46 14             	mov    0x14(%esi),%eax
+  801c62:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c67:	8b 46 18             	mov    0x18(%esi),%eax
+  801c6a:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c6f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c72:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c77:	8b 46 20             	mov    0x20(%esi),%eax
+  801c7a:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c7f:	8b 46 24             	mov    0x24(%esi),%eax
+  801c82:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c87:	8b 46 28             	mov    0x28(%esi),%eax
+  801c8a:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c8f:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c92:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c97:	8b 46 30             	mov    0x30(%esi),%eax
+  801c9a:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c9f:	8b 46 34             	mov    0x34(%esi),%eax
+  801ca2:	a3 78 70 80 00       	mov    %eax,0x807078
+  801ca7:	8b 46 38             	mov    0x38(%esi),%eax
+  801caa:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801caf:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801cb2:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801cb7:	8b 03                	mov    (%ebx),%eax
+  801cb9:	a3 84 70 80 00       	mov    %eax,0x807084
+  801cbe:	8b 43 04             	mov    0x4(%ebx),%eax
+  801cc1:	a3 88 70 80 00       	mov    %eax,0x807088
+  801cc6:	8b 43 08             	mov    0x8(%ebx),%eax
+  801cc9:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801cce:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cd1:	a3 90 70 80 00       	mov    %eax,0x807090
+  801cd6:	8b 43 10             	mov    0x10(%ebx),%eax
+  801cd9:	a3 94 70 80 00       	mov    %eax,0x807094
+  801cde:	8b 43 14             	mov    0x14(%ebx),%eax
+  801ce1:	a3 98 70 80 00       	mov    %eax,0x807098
+  801ce6:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ce9:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801cee:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cf1:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cf6:	8b 43 20             	mov    0x20(%ebx),%eax
+  801cf9:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801cfe:	8b 43 24             	mov    0x24(%ebx),%eax
+  801d01:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801d06:	8b 43 28             	mov    0x28(%ebx),%eax
+  801d09:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801d0e:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801d11:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801d16:	8b 43 30             	mov    0x30(%ebx),%eax
+  801d19:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801d1e:	8b 43 34             	mov    0x34(%ebx),%eax
+  801d21:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801d26:	8b 43 38             	mov    0x38(%ebx),%eax
+  801d29:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801d2e:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801d31:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801d36:	8b 45 18             	mov    0x18(%ebp),%eax
+  801d39:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801d3e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d43:	e8 2b f6 ff ff       	call   801373 <nsipc>
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	0f 88 ad 01 00 00    	js     801efd <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d50:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d56:	89 17                	mov    %edx,(%edi)
+  801d58:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d5e:	89 57 04             	mov    %edx,0x4(%edi)
+  801d61:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d67:	89 57 08             	mov    %edx,0x8(%edi)
+  801d6a:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d70:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d73:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d79:	89 57 10             	mov    %edx,0x10(%edi)
+  801d7c:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d82:	89 57 14             	mov    %edx,0x14(%edi)
+  801d85:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d8b:	89 57 18             	mov    %edx,0x18(%edi)
+  801d8e:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d94:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d97:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d9d:	89 57 20             	mov    %edx,0x20(%edi)
+  801da0:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801da6:	89 57 24             	mov    %edx,0x24(%edi)
+  801da9:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801daf:	89 57 28             	mov    %edx,0x28(%edi)
+  801db2:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801db8:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801dbb:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801dc1:	89 57 30             	mov    %edx,0x30(%edi)
+  801dc4:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801dca:	89 57 34             	mov    %edx,0x34(%edi)
+  801dcd:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801dd3:	89 57 38             	mov    %edx,0x38(%edi)
+  801dd6:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801ddc:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801ddf:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801de5:	89 16                	mov    %edx,(%esi)
+  801de7:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801ded:	89 56 04             	mov    %edx,0x4(%esi)
+  801df0:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801df6:	89 56 08             	mov    %edx,0x8(%esi)
+  801df9:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dff:	89 56 0c             	mov    %edx,0xc(%esi)
+  801e02:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801e08:	89 56 10             	mov    %edx,0x10(%esi)
+  801e0b:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801e11:	89 56 14             	mov    %edx,0x14(%esi)
+  801e14:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801e1a:	89 56 18             	mov    %edx,0x18(%esi)
+  801e1d:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801e23:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801e26:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801e2c:	89 56 20             	mov    %edx,0x20(%esi)
+  801e2f:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801e35:	89 56 24             	mov    %edx,0x24(%esi)
+  801e38:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801e3e:	89 56 28             	mov    %edx,0x28(%esi)
+  801e41:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e47:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e4a:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e50:	89 56 30             	mov    %edx,0x30(%esi)
+  801e53:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e59:	89 56 34             	mov    %edx,0x34(%esi)
+  801e5c:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e62:	89 56 38             	mov    %edx,0x38(%esi)
+  801e65:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e6b:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e6e:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e74:	89 13                	mov    %edx,(%ebx)
+  801e76:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e7c:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e7f:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e85:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e88:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e8e:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e91:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e97:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e9a:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801ea0:	89 53 14             	mov    %edx,0x14(%ebx)
+  801ea3:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801ea9:	89 53 18             	mov    %edx,0x18(%ebx)
+  801eac:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801eb2:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801eb5:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801ebb:	89 53 20             	mov    %edx,0x20(%ebx)
+  801ebe:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801ec4:	89 53 24             	mov    %edx,0x24(%ebx)
+  801ec7:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801ecd:	89 53 28             	mov    %edx,0x28(%ebx)
+  801ed0:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801ed6:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801ed9:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801edf:	89 53 30             	mov    %edx,0x30(%ebx)
+  801ee2:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801ee8:	89 53 34             	mov    %edx,0x34(%ebx)
+  801eeb:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801ef1:	89 53 38             	mov    %edx,0x38(%ebx)
+  801ef4:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801efa:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801efd:	83 c4 0c             	add    $0xc,%esp
+  801f00:	5b                   	pop    %ebx
+  801f01:	5e                   	pop    %esi
+  801f02:	5f                   	pop    %edi
+  801f03:	5d                   	pop    %ebp
+  801f04:	c3                   	ret
+
+00801f05 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801f05:	55                   	push   %ebp
+  801f06:	89 e5                	mov    %esp,%ebp
+  801f08:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801f13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f16:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801f1b:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f1e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801f23:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801f28:	e8 46 f4 ff ff       	call   801373 <nsipc>
+}
+  801f2d:	c9                   	leave
+  801f2e:	c3                   	ret
+
+00801f2f <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801f2f:	55                   	push   %ebp
+  801f30:	89 e5                	mov    %esp,%ebp
+  801f32:	56                   	push   %esi
+  801f33:	53                   	push   %ebx
+  801f34:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801f37:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801f3d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f40:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f45:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f4a:	e8 24 f4 ff ff       	call   801373 <nsipc>
+  801f4f:	89 c3                	mov    %eax,%ebx
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	7e 1f                	jle    801f74 <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f55:	39 c6                	cmp    %eax,%esi
+  801f57:	7c 24                	jl     801f7d <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f59:	83 ec 04             	sub    $0x4,%esp
+  801f5c:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f63:	50                   	push   %eax
+  801f64:	68 00 70 80 00       	push   $0x807000
+  801f69:	ff 75 08             	push   0x8(%ebp)
+  801f6c:	e8 2b 14 00 00       	call   80339c <memmove>
+  801f71:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f74:	89 d8                	mov    %ebx,%eax
+  801f76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f79:	5b                   	pop    %ebx
+  801f7a:	5e                   	pop    %esi
+  801f7b:	5d                   	pop    %ebp
+  801f7c:	c3                   	ret
+		assert(r <= max);
+  801f7d:	68 16 3c 80 00       	push   $0x803c16
+  801f82:	68 e9 3b 80 00       	push   $0x803be9
+  801f87:	68 6a 01 00 00       	push   $0x16a
+  801f8c:	68 fe 3b 80 00       	push   $0x803bfe
+  801f91:	e8 84 0a 00 00       	call   802a1a <_panic>
+
+00801f96 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f96:	55                   	push   %ebp
+  801f97:	89 e5                	mov    %esp,%ebp
+  801f99:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801fa4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa7:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801fac:	8b 45 10             	mov    0x10(%ebp),%eax
+  801faf:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801fb4:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fb9:	e8 b5 f3 ff ff       	call   801373 <nsipc>
+}
+  801fbe:	c9                   	leave
+  801fbf:	c3                   	ret
+
+00801fc0 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801fc0:	55                   	push   %ebp
+  801fc1:	89 e5                	mov    %esp,%ebp
+  801fc3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801fc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc9:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801fce:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fd3:	e8 9b f3 ff ff       	call   801373 <nsipc>
+}
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+
+00801fda <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801fda:	55                   	push   %ebp
+  801fdb:	89 e5                	mov    %esp,%ebp
+  801fdd:	53                   	push   %ebx
+  801fde:	83 ec 04             	sub    $0x4,%esp
+  801fe1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fe4:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fe9:	e8 85 f3 ff ff       	call   801373 <nsipc>
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	78 50                	js     802042 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801ff2:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801ff8:	89 13                	mov    %edx,(%ebx)
+  801ffa:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  802000:	89 53 04             	mov    %edx,0x4(%ebx)
+  802003:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  802009:	89 53 08             	mov    %edx,0x8(%ebx)
+  80200c:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  802012:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802015:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80201b:	89 53 10             	mov    %edx,0x10(%ebx)
+  80201e:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  802024:	89 53 14             	mov    %edx,0x14(%ebx)
+  802027:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  80202d:	89 53 18             	mov    %edx,0x18(%ebx)
+  802030:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802036:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802039:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  80203f:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802042:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802045:	c9                   	leave
+  802046:	c3                   	ret
+
+00802047 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802047:	55                   	push   %ebp
+  802048:	89 e5                	mov    %esp,%ebp
+  80204a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80204d:	6a 03                	push   $0x3
+  80204f:	e8 47 18 00 00       	call   80389b <ipc_find_env>
+  802054:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802059:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802061:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802066:	e8 08 f3 ff ff       	call   801373 <nsipc>
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	85 c0                	test   %eax,%eax
+  802070:	78 0a                	js     80207c <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802072:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802077:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80207c:	c9                   	leave
+  80207d:	c3                   	ret
+
+0080207e <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	57                   	push   %edi
+  802082:	56                   	push   %esi
+  802083:	53                   	push   %ebx
+  802084:	83 ec 1c             	sub    $0x1c,%esp
+  802087:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80208a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80208d:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802092:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802097:	89 e0                	mov    %esp,%eax
+  802099:	89 f2                	mov    %esi,%edx
+  80209b:	29 c2                	sub    %eax,%edx
+  80209d:	89 d0                	mov    %edx,%eax
+  80209f:	c1 e8 0f             	shr    $0xf,%eax
+  8020a2:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8020a8:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8020ab:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020b2:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8020b5:	83 ec 0c             	sub    $0xc,%esp
+  8020b8:	ff 75 e0             	push   -0x20(%ebp)
+  8020bb:	e8 1a 18 00 00       	call   8038da <pageref>
+  8020c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020c3:	83 c4 04             	add    $0x4,%esp
+  8020c6:	ff 75 dc             	push   -0x24(%ebp)
+  8020c9:	e8 0c 18 00 00       	call   8038da <pageref>
+  8020ce:	89 e2                	mov    %esp,%edx
+  8020d0:	89 f1                	mov    %esi,%ecx
+  8020d2:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8020d4:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8020d7:	89 ca                	mov    %ecx,%edx
+  8020d9:	c1 ea 0f             	shr    $0xf,%edx
+  8020dc:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8020e2:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020e5:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020ec:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020ef:	39 d7                	cmp    %edx,%edi
+  8020f1:	74 40                	je     802133 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020f3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020f6:	75 9f                	jne    802097 <_pipeisclosed+0x19>
+  8020f8:	89 e2                	mov    %esp,%edx
+  8020fa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020ff:	29 d0                	sub    %edx,%eax
+  802101:	89 c2                	mov    %eax,%edx
+  802103:	c1 ea 0f             	shr    $0xf,%edx
+  802106:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80210b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802110:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802113:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80211a:	8b 40 58             	mov    0x58(%eax),%eax
+  80211d:	6a 01                	push   $0x1
+  80211f:	50                   	push   %eax
+  802120:	57                   	push   %edi
+  802121:	68 1f 3c 80 00       	push   $0x803c1f
+  802126:	e8 ca 09 00 00       	call   802af5 <cprintf>
+  80212b:	83 c4 10             	add    $0x10,%esp
+  80212e:	e9 5f ff ff ff       	jmp    802092 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802133:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802136:	0f 94 c0             	sete   %al
+  802139:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80213c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80213f:	5b                   	pop    %ebx
+  802140:	5e                   	pop    %esi
+  802141:	5f                   	pop    %edi
+  802142:	5d                   	pop    %ebp
+  802143:	c3                   	ret
+
+00802144 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802144:	55                   	push   %ebp
+  802145:	89 e5                	mov    %esp,%ebp
+  802147:	53                   	push   %ebx
+  802148:	83 ec 0c             	sub    $0xc,%esp
+  80214b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80214e:	53                   	push   %ebx
+  80214f:	6a 00                	push   $0x0
+  802151:	e8 e8 e0 ff ff       	call   80023e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802156:	89 1c 24             	mov    %ebx,(%esp)
+  802159:	e8 f4 e4 ff ff       	call   800652 <fd2data>
+  80215e:	83 c4 08             	add    $0x8,%esp
+  802161:	50                   	push   %eax
+  802162:	6a 00                	push   $0x0
+  802164:	e8 d5 e0 ff ff       	call   80023e <sys_page_unmap>
+}
+  802169:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80216c:	c9                   	leave
+  80216d:	c3                   	ret
+
+0080216e <devpipe_read>:
+{
+  80216e:	55                   	push   %ebp
+  80216f:	89 e5                	mov    %esp,%ebp
+  802171:	57                   	push   %edi
+  802172:	56                   	push   %esi
+  802173:	53                   	push   %ebx
+  802174:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802177:	ff 75 08             	push   0x8(%ebp)
+  80217a:	e8 d3 e4 ff ff       	call   800652 <fd2data>
+  80217f:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802181:	8b 70 04             	mov    0x4(%eax),%esi
+  802184:	8b 00                	mov    (%eax),%eax
+  802186:	83 c4 10             	add    $0x10,%esp
+  802189:	39 f0                	cmp    %esi,%eax
+  80218b:	75 36                	jne    8021c3 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80218d:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802190:	89 da                	mov    %ebx,%edx
+  802192:	8b 45 08             	mov    0x8(%ebp),%eax
+  802195:	e8 e4 fe ff ff       	call   80207e <_pipeisclosed>
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	0f 85 d4 00 00 00    	jne    802276 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8021a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021a7:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8021ab:	83 ec 04             	sub    $0x4,%esp
+  8021ae:	6a ff                	push   $0xffffffff
+  8021b0:	56                   	push   %esi
+  8021b1:	57                   	push   %edi
+  8021b2:	e8 00 e4 ff ff       	call   8005b7 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8021b7:	8b 73 04             	mov    0x4(%ebx),%esi
+  8021ba:	8b 03                	mov    (%ebx),%eax
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	39 c6                	cmp    %eax,%esi
+  8021c1:	74 cd                	je     802190 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8021c3:	8b 73 04             	mov    0x4(%ebx),%esi
+  8021c6:	8b 03                	mov    (%ebx),%eax
+  8021c8:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8021ce:	29 c6                	sub    %eax,%esi
+  8021d0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021d5:	f7 e6                	mul    %esi
+  8021d7:	c1 ea 0c             	shr    $0xc,%edx
+  8021da:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021e0:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8021e2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021e5:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021e9:	8b 0b                	mov    (%ebx),%ecx
+  8021eb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021f0:	f7 e1                	mul    %ecx
+  8021f2:	c1 ea 0b             	shr    $0xb,%edx
+  8021f5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021fb:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021fd:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802202:	29 cf                	sub    %ecx,%edi
+  802204:	39 f7                	cmp    %esi,%edi
+  802206:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802209:	83 ec 04             	sub    $0x4,%esp
+  80220c:	57                   	push   %edi
+  80220d:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802211:	50                   	push   %eax
+  802212:	ff 75 0c             	push   0xc(%ebp)
+  802215:	e8 82 11 00 00       	call   80339c <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  80221a:	83 c4 0c             	add    $0xc,%esp
+  80221d:	89 f0                	mov    %esi,%eax
+  80221f:	29 f8                	sub    %edi,%eax
+  802221:	50                   	push   %eax
+  802222:	8d 43 10             	lea    0x10(%ebx),%eax
+  802225:	50                   	push   %eax
+  802226:	89 f8                	mov    %edi,%eax
+  802228:	03 45 0c             	add    0xc(%ebp),%eax
+  80222b:	50                   	push   %eax
+  80222c:	e8 6b 11 00 00       	call   80339c <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802231:	8b 0b                	mov    (%ebx),%ecx
+  802233:	01 f1                	add    %esi,%ecx
+  802235:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80223a:	f7 e1                	mul    %ecx
+  80223c:	c1 ea 0c             	shr    $0xc,%edx
+  80223f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802245:	29 c1                	sub    %eax,%ecx
+  802247:	89 0b                	mov    %ecx,(%ebx)
+  802249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224e:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802252:	83 c4 10             	add    $0x10,%esp
+  802255:	85 c0                	test   %eax,%eax
+  802257:	75 0a                	jne    802263 <devpipe_read+0xf5>
+	return n;
+  802259:	89 f0                	mov    %esi,%eax
+}
+  80225b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80225e:	5b                   	pop    %ebx
+  80225f:	5e                   	pop    %esi
+  802260:	5f                   	pop    %edi
+  802261:	5d                   	pop    %ebp
+  802262:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802263:	83 ec 08             	sub    $0x8,%esp
+  802266:	68 00 04 00 00       	push   $0x400
+  80226b:	53                   	push   %ebx
+  80226c:	e8 68 e3 ff ff       	call   8005d9 <sys_futex_wake>
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	eb e3                	jmp    802259 <devpipe_read+0xeb>
+			return 0;
+  802276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227b:	eb de                	jmp    80225b <devpipe_read+0xed>
+
+0080227d <devpipe_write>:
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	57                   	push   %edi
+  802281:	56                   	push   %esi
+  802282:	53                   	push   %ebx
+  802283:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802286:	ff 75 08             	push   0x8(%ebp)
+  802289:	e8 c4 e3 ff ff       	call   800652 <fd2data>
+  80228e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802290:	83 c4 10             	add    $0x10,%esp
+  802293:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80229a:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80229f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8022a3:	0f 84 43 01 00 00    	je     8023ec <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022a9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022ac:	8b 06                	mov    (%esi),%eax
+  8022ae:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022b4:	29 c1                	sub    %eax,%ecx
+  8022b6:	89 c8                	mov    %ecx,%eax
+  8022b8:	f7 e7                	mul    %edi
+  8022ba:	c1 ea 0c             	shr    $0xc,%edx
+  8022bd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022c3:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8022c5:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022cb:	75 52                	jne    80231f <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8022cd:	89 f2                	mov    %esi,%edx
+  8022cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d2:	e8 a7 fd ff ff       	call   80207e <_pipeisclosed>
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	0f 85 28 01 00 00    	jne    802407 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8022df:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022e1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022e4:	8b 06                	mov    (%esi),%eax
+  8022e6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022ec:	29 c1                	sub    %eax,%ecx
+  8022ee:	89 c8                	mov    %ecx,%eax
+  8022f0:	f7 e7                	mul    %edi
+  8022f2:	c1 ea 0c             	shr    $0xc,%edx
+  8022f5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022fb:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022fd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802303:	75 a4                	jne    8022a9 <devpipe_write+0x2c>
+  802305:	b8 01 00 00 00       	mov    $0x1,%eax
+  80230a:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80230e:	83 ec 04             	sub    $0x4,%esp
+  802311:	6a ff                	push   $0xffffffff
+  802313:	53                   	push   %ebx
+  802314:	56                   	push   %esi
+  802315:	e8 9d e2 ff ff       	call   8005b7 <sys_futex_wait>
+}
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	eb 8a                	jmp    8022a9 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80231f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802322:	8b 06                	mov    (%esi),%eax
+  802324:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80232a:	29 c1                	sub    %eax,%ecx
+  80232c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802331:	f7 e1                	mul    %ecx
+  802333:	c1 ea 0c             	shr    $0xc,%edx
+  802336:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80233c:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80233e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802343:	89 d8                	mov    %ebx,%eax
+  802345:	29 c8                	sub    %ecx,%eax
+  802347:	8b 55 10             	mov    0x10(%ebp),%edx
+  80234a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80234d:	29 ca                	sub    %ecx,%edx
+  80234f:	39 d0                	cmp    %edx,%eax
+  802351:	0f 46 d0             	cmovbe %eax,%edx
+  802354:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802357:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80235a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80235f:	f7 e1                	mul    %ecx
+  802361:	c1 ea 0b             	shr    $0xb,%edx
+  802364:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80236a:	89 ca                	mov    %ecx,%edx
+  80236c:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80236e:	29 d3                	sub    %edx,%ebx
+  802370:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802373:	39 c3                	cmp    %eax,%ebx
+  802375:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802378:	83 ec 04             	sub    $0x4,%esp
+  80237b:	53                   	push   %ebx
+  80237c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80237f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802382:	51                   	push   %ecx
+  802383:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802387:	50                   	push   %eax
+  802388:	e8 0f 10 00 00       	call   80339c <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80238d:	83 c4 0c             	add    $0xc,%esp
+  802390:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802393:	29 d8                	sub    %ebx,%eax
+  802395:	50                   	push   %eax
+  802396:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802399:	01 cb                	add    %ecx,%ebx
+  80239b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80239e:	53                   	push   %ebx
+  80239f:	8d 46 10             	lea    0x10(%esi),%eax
+  8023a2:	50                   	push   %eax
+  8023a3:	e8 f4 0f 00 00       	call   80339c <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8023a8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8023ab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023ae:	01 c1                	add    %eax,%ecx
+  8023b0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023b5:	f7 e1                	mul    %ecx
+  8023b7:	c1 ea 0c             	shr    $0xc,%edx
+  8023ba:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8023c0:	89 ca                	mov    %ecx,%edx
+  8023c2:	29 c2                	sub    %eax,%edx
+  8023c4:	89 56 04             	mov    %edx,0x4(%esi)
+  8023c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cc:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8023d0:	83 c4 10             	add    $0x10,%esp
+  8023d3:	85 c0                	test   %eax,%eax
+  8023d5:	75 1a                	jne    8023f1 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8023d7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8023da:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8023dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023e0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023e3:	0f 82 c0 fe ff ff    	jb     8022a9 <devpipe_write+0x2c>
+  8023e9:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023ec:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023ef:	eb 1b                	jmp    80240c <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023f1:	83 ec 08             	sub    $0x8,%esp
+  8023f4:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023f9:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023fc:	50                   	push   %eax
+  8023fd:	e8 d7 e1 ff ff       	call   8005d9 <sys_futex_wake>
+  802402:	83 c4 10             	add    $0x10,%esp
+  802405:	eb d0                	jmp    8023d7 <devpipe_write+0x15a>
+				return 0;
+  802407:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80240c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240f:	5b                   	pop    %ebx
+  802410:	5e                   	pop    %esi
+  802411:	5f                   	pop    %edi
+  802412:	5d                   	pop    %ebp
+  802413:	c3                   	ret
+
+00802414 <devpipe_stat>:
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	56                   	push   %esi
+  802418:	53                   	push   %ebx
+  802419:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80241c:	83 ec 0c             	sub    $0xc,%esp
+  80241f:	ff 75 08             	push   0x8(%ebp)
+  802422:	e8 2b e2 ff ff       	call   800652 <fd2data>
+  802427:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802429:	83 c4 08             	add    $0x8,%esp
+  80242c:	68 32 3c 80 00       	push   $0x803c32
+  802431:	53                   	push   %ebx
+  802432:	e8 b5 0d 00 00       	call   8031ec <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802437:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80243a:	8b 06                	mov    (%esi),%eax
+  80243c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802442:	29 c1                	sub    %eax,%ecx
+  802444:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802449:	89 c8                	mov    %ecx,%eax
+  80244b:	f7 e2                	mul    %edx
+  80244d:	c1 ea 0c             	shr    $0xc,%edx
+  802450:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802456:	29 d1                	sub    %edx,%ecx
+  802458:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80245e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802465:	00 00 00 
+	stat->st_dev = &devpipe;
+  802468:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  80246f:	40 80 00 
+}
+  802472:	b8 00 00 00 00       	mov    $0x0,%eax
+  802477:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80247a:	5b                   	pop    %ebx
+  80247b:	5e                   	pop    %esi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+
+0080247e <devpipe_poll>:
+{
+  80247e:	55                   	push   %ebp
+  80247f:	89 e5                	mov    %esp,%ebp
+  802481:	57                   	push   %edi
+  802482:	56                   	push   %esi
+  802483:	53                   	push   %ebx
+  802484:	83 ec 18             	sub    $0x18,%esp
+  802487:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80248a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80248d:	57                   	push   %edi
+  80248e:	e8 bf e1 ff ff       	call   800652 <fd2data>
+  802493:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802495:	83 c4 10             	add    $0x10,%esp
+  802498:	89 f3                	mov    %esi,%ebx
+  80249a:	83 e3 01             	and    $0x1,%ebx
+  80249d:	75 27                	jne    8024c6 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80249f:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8024a5:	75 48                	jne    8024ef <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8024a7:	89 ca                	mov    %ecx,%edx
+  8024a9:	89 f8                	mov    %edi,%eax
+  8024ab:	e8 ce fb ff ff       	call   80207e <_pipeisclosed>
+  8024b0:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8024b2:	89 d8                	mov    %ebx,%eax
+  8024b4:	83 c8 10             	or     $0x10,%eax
+  8024b7:	85 d2                	test   %edx,%edx
+  8024b9:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8024bc:	89 d8                	mov    %ebx,%eax
+  8024be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c1:	5b                   	pop    %ebx
+  8024c2:	5e                   	pop    %esi
+  8024c3:	5f                   	pop    %edi
+  8024c4:	5d                   	pop    %ebp
+  8024c5:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024c6:	8b 58 04             	mov    0x4(%eax),%ebx
+  8024c9:	8b 00                	mov    (%eax),%eax
+  8024cb:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8024d1:	29 c3                	sub    %eax,%ebx
+  8024d3:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024d8:	89 d8                	mov    %ebx,%eax
+  8024da:	f7 e2                	mul    %edx
+  8024dc:	c1 ea 0c             	shr    $0xc,%edx
+  8024df:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024e5:	39 d3                	cmp    %edx,%ebx
+  8024e7:	0f 95 c3             	setne  %bl
+  8024ea:	0f b6 db             	movzbl %bl,%ebx
+  8024ed:	eb b0                	jmp    80249f <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024ef:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024f2:	8b 01                	mov    (%ecx),%eax
+  8024f4:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024fa:	29 c6                	sub    %eax,%esi
+  8024fc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802501:	89 f0                	mov    %esi,%eax
+  802503:	f7 e2                	mul    %edx
+  802505:	c1 ea 0c             	shr    $0xc,%edx
+  802508:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80250e:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  802510:	89 d8                	mov    %ebx,%eax
+  802512:	83 c8 04             	or     $0x4,%eax
+  802515:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80251b:	0f 42 d8             	cmovb  %eax,%ebx
+  80251e:	eb 87                	jmp    8024a7 <devpipe_poll+0x29>
+
+00802520 <pipe>:
+{
+  802520:	55                   	push   %ebp
+  802521:	89 e5                	mov    %esp,%ebp
+  802523:	56                   	push   %esi
+  802524:	53                   	push   %ebx
+  802525:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802528:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80252b:	50                   	push   %eax
+  80252c:	e8 38 e1 ff ff       	call   800669 <fd_alloc>
+  802531:	89 c3                	mov    %eax,%ebx
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	85 c0                	test   %eax,%eax
+  802538:	0f 88 23 01 00 00    	js     802661 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80253e:	83 ec 04             	sub    $0x4,%esp
+  802541:	68 07 04 00 00       	push   $0x407
+  802546:	ff 75 f4             	push   -0xc(%ebp)
+  802549:	6a 00                	push   $0x0
+  80254b:	e8 69 dc ff ff       	call   8001b9 <sys_page_alloc>
+  802550:	89 c3                	mov    %eax,%ebx
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	85 c0                	test   %eax,%eax
+  802557:	0f 88 04 01 00 00    	js     802661 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80255d:	83 ec 0c             	sub    $0xc,%esp
+  802560:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802563:	50                   	push   %eax
+  802564:	e8 00 e1 ff ff       	call   800669 <fd_alloc>
+  802569:	89 c3                	mov    %eax,%ebx
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	0f 88 db 00 00 00    	js     802651 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802576:	83 ec 04             	sub    $0x4,%esp
+  802579:	68 07 04 00 00       	push   $0x407
+  80257e:	ff 75 f0             	push   -0x10(%ebp)
+  802581:	6a 00                	push   $0x0
+  802583:	e8 31 dc ff ff       	call   8001b9 <sys_page_alloc>
+  802588:	89 c3                	mov    %eax,%ebx
+  80258a:	83 c4 10             	add    $0x10,%esp
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	0f 88 bc 00 00 00    	js     802651 <pipe+0x131>
+	va = fd2data(fd0);
+  802595:	83 ec 0c             	sub    $0xc,%esp
+  802598:	ff 75 f4             	push   -0xc(%ebp)
+  80259b:	e8 b2 e0 ff ff       	call   800652 <fd2data>
+  8025a0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025a2:	83 c4 0c             	add    $0xc,%esp
+  8025a5:	68 07 04 00 00       	push   $0x407
+  8025aa:	50                   	push   %eax
+  8025ab:	6a 00                	push   $0x0
+  8025ad:	e8 07 dc ff ff       	call   8001b9 <sys_page_alloc>
+  8025b2:	89 c3                	mov    %eax,%ebx
+  8025b4:	83 c4 10             	add    $0x10,%esp
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	0f 88 82 00 00 00    	js     802641 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025bf:	83 ec 0c             	sub    $0xc,%esp
+  8025c2:	ff 75 f0             	push   -0x10(%ebp)
+  8025c5:	e8 88 e0 ff ff       	call   800652 <fd2data>
+  8025ca:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025d1:	50                   	push   %eax
+  8025d2:	6a 00                	push   $0x0
+  8025d4:	56                   	push   %esi
+  8025d5:	6a 00                	push   $0x0
+  8025d7:	e8 20 dc ff ff       	call   8001fc <sys_page_map>
+  8025dc:	89 c3                	mov    %eax,%ebx
+  8025de:	83 c4 20             	add    $0x20,%esp
+  8025e1:	85 c0                	test   %eax,%eax
+  8025e3:	78 4e                	js     802633 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025e5:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025ea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025ed:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025f2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025f9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025fc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802601:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802608:	83 ec 0c             	sub    $0xc,%esp
+  80260b:	ff 75 f4             	push   -0xc(%ebp)
+  80260e:	e8 2f e0 ff ff       	call   800642 <fd2num>
+  802613:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802616:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802618:	83 c4 04             	add    $0x4,%esp
+  80261b:	ff 75 f0             	push   -0x10(%ebp)
+  80261e:	e8 1f e0 ff ff       	call   800642 <fd2num>
+  802623:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802626:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802631:	eb 2e                	jmp    802661 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802633:	83 ec 08             	sub    $0x8,%esp
+  802636:	56                   	push   %esi
+  802637:	6a 00                	push   $0x0
+  802639:	e8 00 dc ff ff       	call   80023e <sys_page_unmap>
+  80263e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802641:	83 ec 08             	sub    $0x8,%esp
+  802644:	ff 75 f0             	push   -0x10(%ebp)
+  802647:	6a 00                	push   $0x0
+  802649:	e8 f0 db ff ff       	call   80023e <sys_page_unmap>
+  80264e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802651:	83 ec 08             	sub    $0x8,%esp
+  802654:	ff 75 f4             	push   -0xc(%ebp)
+  802657:	6a 00                	push   $0x0
+  802659:	e8 e0 db ff ff       	call   80023e <sys_page_unmap>
+  80265e:	83 c4 10             	add    $0x10,%esp
+}
+  802661:	89 d8                	mov    %ebx,%eax
+  802663:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802666:	5b                   	pop    %ebx
+  802667:	5e                   	pop    %esi
+  802668:	5d                   	pop    %ebp
+  802669:	c3                   	ret
+
+0080266a <pipeisclosed>:
+{
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+  80266d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802670:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802673:	50                   	push   %eax
+  802674:	ff 75 08             	push   0x8(%ebp)
+  802677:	e8 3d e0 ff ff       	call   8006b9 <fd_lookup>
+  80267c:	83 c4 10             	add    $0x10,%esp
+  80267f:	85 c0                	test   %eax,%eax
+  802681:	78 18                	js     80269b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802683:	83 ec 0c             	sub    $0xc,%esp
+  802686:	ff 75 f4             	push   -0xc(%ebp)
+  802689:	e8 c4 df ff ff       	call   800652 <fd2data>
+  80268e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802690:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802693:	e8 e6 f9 ff ff       	call   80207e <_pipeisclosed>
+  802698:	83 c4 10             	add    $0x10,%esp
+}
+  80269b:	c9                   	leave
+  80269c:	c3                   	ret
+
+0080269d <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80269d:	55                   	push   %ebp
+  80269e:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8026a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8026a9:	5d                   	pop    %ebp
+  8026aa:	c3                   	ret
+
+008026ab <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	53                   	push   %ebx
+  8026af:	83 ec 04             	sub    $0x4,%esp
+  8026b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8026b5:	8b 03                	mov    (%ebx),%eax
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	75 05                	jne    8026c0 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8026bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026be:	c9                   	leave
+  8026bf:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8026c0:	83 ec 08             	sub    $0x8,%esp
+  8026c3:	50                   	push   %eax
+  8026c4:	8d 43 04             	lea    0x4(%ebx),%eax
+  8026c7:	50                   	push   %eax
+  8026c8:	e8 c1 dd ff ff       	call   80048e <sys_page_batch>
+	pb->pb_n = 0;
+  8026cd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8026d3:	83 c4 10             	add    $0x10,%esp
+  8026d6:	eb e3                	jmp    8026bb <pgbatch_flush+0x10>
+
+008026d8 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	56                   	push   %esi
+  8026dc:	53                   	push   %ebx
+  8026dd:	89 c3                	mov    %eax,%ebx
+  8026df:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026e1:	83 38 20             	cmpl   $0x20,(%eax)
+  8026e4:	74 2c                	je     802712 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026e6:	8b 03                	mov    (%ebx),%eax
+  8026e8:	8d 50 01             	lea    0x1(%eax),%edx
+  8026eb:	89 13                	mov    %edx,(%ebx)
+  8026ed:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026f0:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026f4:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026f6:	83 ec 04             	sub    $0x4,%esp
+  8026f9:	6a 18                	push   $0x18
+  8026fb:	6a 00                	push   $0x0
+  8026fd:	50                   	push   %eax
+  8026fe:	e8 64 0c 00 00       	call   803367 <memset>
+	return 0;
+  802703:	83 c4 10             	add    $0x10,%esp
+  802706:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80270b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80270e:	5b                   	pop    %ebx
+  80270f:	5e                   	pop    %esi
+  802710:	5d                   	pop    %ebp
+  802711:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  802712:	83 ec 0c             	sub    $0xc,%esp
+  802715:	50                   	push   %eax
+  802716:	e8 90 ff ff ff       	call   8026ab <pgbatch_flush>
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	79 c4                	jns    8026e6 <pgbatch_slot+0xe>
+  802722:	eb e7                	jmp    80270b <pgbatch_slot+0x33>
+
+00802724 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  802724:	55                   	push   %ebp
+  802725:	89 e5                	mov    %esp,%ebp
+  802727:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80272a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80272d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802730:	e8 a3 ff ff ff       	call   8026d8 <pgbatch_slot>
+  802735:	85 c0                	test   %eax,%eax
+  802737:	78 20                	js     802759 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  802739:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80273c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  802742:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802745:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802748:	8b 55 10             	mov    0x10(%ebp),%edx
+  80274b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80274e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802751:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802754:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802759:	c9                   	leave
+  80275a:	c3                   	ret
+
+0080275b <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80275b:	55                   	push   %ebp
+  80275c:	89 e5                	mov    %esp,%ebp
+  80275e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802761:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802764:	8b 45 08             	mov    0x8(%ebp),%eax
+  802767:	e8 6c ff ff ff       	call   8026d8 <pgbatch_slot>
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	78 2c                	js     80279c <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  802770:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802773:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802779:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80277c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80277f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802782:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802785:	8b 55 14             	mov    0x14(%ebp),%edx
+  802788:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80278b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80278e:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802791:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802794:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802797:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80279c:	c9                   	leave
+  80279d:	c3                   	ret
+
+0080279e <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80279e:	55                   	push   %ebp
+  80279f:	89 e5                	mov    %esp,%ebp
+  8027a1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027a4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027aa:	e8 29 ff ff ff       	call   8026d8 <pgbatch_slot>
+  8027af:	85 c0                	test   %eax,%eax
+  8027b1:	78 1a                	js     8027cd <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8027b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b6:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8027bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027bf:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027c2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027c5:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8027c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027cd:	c9                   	leave
+  8027ce:	c3                   	ret
+
+008027cf <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8027cf:	55                   	push   %ebp
+  8027d0:	89 e5                	mov    %esp,%ebp
+  8027d2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027d5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027db:	e8 f8 fe ff ff       	call   8026d8 <pgbatch_slot>
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	78 20                	js     802804 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027e7:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027f0:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027f3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027f6:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027f9:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027fc:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802804:	c9                   	leave
+  802805:	c3                   	ret
+
+00802806 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  802806:	55                   	push   %ebp
+  802807:	89 e5                	mov    %esp,%ebp
+  802809:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80280c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80280f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802812:	e8 c1 fe ff ff       	call   8026d8 <pgbatch_slot>
+  802817:	85 c0                	test   %eax,%eax
+  802819:	78 26                	js     802841 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80281b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281e:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  802824:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802827:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  80282a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80282d:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802830:	8b 55 14             	mov    0x14(%ebp),%edx
+  802833:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  802836:	8b 55 18             	mov    0x18(%ebp),%edx
+  802839:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80283c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802841:	c9                   	leave
+  802842:	c3                   	ret
+
+00802843 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802843:	b8 00 00 00 00       	mov    $0x0,%eax
+  802848:	c3                   	ret
+
+00802849 <devcons_poll>:
+{
+  802849:	55                   	push   %ebp
+  80284a:	89 e5                	mov    %esp,%ebp
+  80284c:	53                   	push   %ebx
+  80284d:	83 ec 04             	sub    $0x4,%esp
+  802850:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802853:	89 da                	mov    %ebx,%edx
+  802855:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802858:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80285f:	74 0c                	je     80286d <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802861:	89 d8                	mov    %ebx,%eax
+  802863:	83 e0 01             	and    $0x1,%eax
+  802866:	09 d0                	or     %edx,%eax
+}
+  802868:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80286b:	c9                   	leave
+  80286c:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80286d:	e8 a9 d8 ff ff       	call   80011b <sys_cgetc>
+  802872:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802877:	89 da                	mov    %ebx,%edx
+  802879:	83 e2 04             	and    $0x4,%edx
+  80287c:	85 c0                	test   %eax,%eax
+  80287e:	74 e6                	je     802866 <devcons_poll+0x1d>
+  802880:	eb df                	jmp    802861 <devcons_poll+0x18>
+
+00802882 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802882:	55                   	push   %ebp
+  802883:	89 e5                	mov    %esp,%ebp
+  802885:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802888:	68 3e 3c 80 00       	push   $0x803c3e
+  80288d:	ff 75 0c             	push   0xc(%ebp)
+  802890:	e8 57 09 00 00       	call   8031ec <strcpy>
+	return 0;
+}
+  802895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289a:	c9                   	leave
+  80289b:	c3                   	ret
+
+0080289c <devcons_write>:
+{
+  80289c:	55                   	push   %ebp
+  80289d:	89 e5                	mov    %esp,%ebp
+  80289f:	57                   	push   %edi
+  8028a0:	56                   	push   %esi
+  8028a1:	53                   	push   %ebx
+  8028a2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8028a8:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8028ab:	85 ff                	test   %edi,%edi
+  8028ad:	74 51                	je     802900 <devcons_write+0x64>
+  8028af:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b4:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8028b9:	89 fb                	mov    %edi,%ebx
+  8028bb:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8028bd:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8028c2:	39 d3                	cmp    %edx,%ebx
+  8028c4:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8028c7:	83 ec 04             	sub    $0x4,%esp
+  8028ca:	53                   	push   %ebx
+  8028cb:	03 45 0c             	add    0xc(%ebp),%eax
+  8028ce:	50                   	push   %eax
+  8028cf:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028d5:	50                   	push   %eax
+  8028d6:	e8 c1 0a 00 00       	call   80339c <memmove>
+		sys_cputs(buf, m);
+  8028db:	83 c4 08             	add    $0x8,%esp
+  8028de:	53                   	push   %ebx
+  8028df:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028e5:	50                   	push   %eax
+  8028e6:	e8 12 d8 ff ff       	call   8000fd <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028eb:	01 de                	add    %ebx,%esi
+  8028ed:	89 f0                	mov    %esi,%eax
+  8028ef:	83 c4 10             	add    $0x10,%esp
+  8028f2:	39 fe                	cmp    %edi,%esi
+  8028f4:	72 c3                	jb     8028b9 <devcons_write+0x1d>
+}
+  8028f6:	89 f0                	mov    %esi,%eax
+  8028f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028fb:	5b                   	pop    %ebx
+  8028fc:	5e                   	pop    %esi
+  8028fd:	5f                   	pop    %edi
+  8028fe:	5d                   	pop    %ebp
+  8028ff:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  802900:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  802905:	eb ef                	jmp    8028f6 <devcons_write+0x5a>
+
+00802907 <devcons_read>:
+{
+  802907:	55                   	push   %ebp
+  802908:	89 e5                	mov    %esp,%ebp
+  80290a:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80290d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  802912:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802916:	74 36                	je     80294e <devcons_read+0x47>
+	c = cons_peek;
+  802918:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  80291d:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  802924:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802927:	85 c0                	test   %eax,%eax
+  802929:	75 10                	jne    80293b <devcons_read+0x34>
+  80292b:	e8 eb d7 ff ff       	call   80011b <sys_cgetc>
+  802930:	85 c0                	test   %eax,%eax
+  802932:	75 07                	jne    80293b <devcons_read+0x34>
+		sys_yield();
+  802934:	e8 61 d8 ff ff       	call   80019a <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802939:	eb f0                	jmp    80292b <devcons_read+0x24>
+	if (c < 0)
+  80293b:	85 c0                	test   %eax,%eax
+  80293d:	78 0f                	js     80294e <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80293f:	83 f8 04             	cmp    $0x4,%eax
+  802942:	74 0c                	je     802950 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802944:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802947:	88 02                	mov    %al,(%edx)
+	return 1;
+  802949:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80294e:	c9                   	leave
+  80294f:	c3                   	ret
+		return 0;
+  802950:	b8 00 00 00 00       	mov    $0x0,%eax
+  802955:	eb f7                	jmp    80294e <devcons_read+0x47>
+
+00802957 <cputchar>:
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80295d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802960:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802963:	6a 01                	push   $0x1
+  802965:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802968:	50                   	push   %eax
+  802969:	e8 8f d7 ff ff       	call   8000fd <sys_cputs>
+}
+  80296e:	83 c4 10             	add    $0x10,%esp
+  802971:	c9                   	leave
+  802972:	c3                   	ret
+
+00802973 <getchar>:
+{
+  802973:	55                   	push   %ebp
+  802974:	89 e5                	mov    %esp,%ebp
+  802976:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802979:	6a 01                	push   $0x1
+  80297b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80297e:	50                   	push   %eax
+  80297f:	6a 00                	push   $0x0
+  802981:	e8 b7 df ff ff       	call   80093d <read>
+	if (r < 0)
+  802986:	83 c4 10             	add    $0x10,%esp
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	78 06                	js     802993 <getchar+0x20>
+	if (r < 1)
+  80298d:	74 06                	je     802995 <getchar+0x22>
+	return c;
+  80298f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802993:	c9                   	leave
+  802994:	c3                   	ret
+		return -E_EOF;
+  802995:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80299a:	eb f7                	jmp    802993 <getchar+0x20>
+
+0080299c <iscons>:
+{
+  80299c:	55                   	push   %ebp
+  80299d:	89 e5                	mov    %esp,%ebp
+  80299f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029a5:	50                   	push   %eax
+  8029a6:	ff 75 08             	push   0x8(%ebp)
+  8029a9:	e8 0b dd ff ff       	call   8006b9 <fd_lookup>
+  8029ae:	83 c4 10             	add    $0x10,%esp
+  8029b1:	85 c0                	test   %eax,%eax
+  8029b3:	78 11                	js     8029c6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8029b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029b8:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029be:	39 10                	cmp    %edx,(%eax)
+  8029c0:	0f 94 c0             	sete   %al
+  8029c3:	0f b6 c0             	movzbl %al,%eax
+}
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+
+008029c8 <opencons>:
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8029ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029d1:	50                   	push   %eax
+  8029d2:	e8 92 dc ff ff       	call   800669 <fd_alloc>
+  8029d7:	83 c4 10             	add    $0x10,%esp
+  8029da:	85 c0                	test   %eax,%eax
+  8029dc:	78 3a                	js     802a18 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029de:	83 ec 04             	sub    $0x4,%esp
+  8029e1:	68 07 04 00 00       	push   $0x407
+  8029e6:	ff 75 f4             	push   -0xc(%ebp)
+  8029e9:	6a 00                	push   $0x0
+  8029eb:	e8 c9 d7 ff ff       	call   8001b9 <sys_page_alloc>
+  8029f0:	83 c4 10             	add    $0x10,%esp
+  8029f3:	85 c0                	test   %eax,%eax
+  8029f5:	78 21                	js     802a18 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029fa:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802a00:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a05:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a0c:	83 ec 0c             	sub    $0xc,%esp
+  802a0f:	50                   	push   %eax
+  802a10:	e8 2d dc ff ff       	call   800642 <fd2num>
+  802a15:	83 c4 10             	add    $0x10,%esp
+}
+  802a18:	c9                   	leave
+  802a19:	c3                   	ret
+
+00802a1a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802a1a:	55                   	push   %ebp
+  802a1b:	89 e5                	mov    %esp,%ebp
+  802a1d:	56                   	push   %esi
+  802a1e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802a1f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a22:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a28:	e8 4e d7 ff ff       	call   80017b <sys_getenvid>
+  802a2d:	83 ec 0c             	sub    $0xc,%esp
+  802a30:	ff 75 0c             	push   0xc(%ebp)
+  802a33:	ff 75 08             	push   0x8(%ebp)
+  802a36:	56                   	push   %esi
+  802a37:	50                   	push   %eax
+  802a38:	68 4c 3c 80 00       	push   $0x803c4c
+  802a3d:	e8 b3 00 00 00       	call   802af5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802a42:	83 c4 18             	add    $0x18,%esp
+  802a45:	53                   	push   %ebx
+  802a46:	ff 75 10             	push   0x10(%ebp)
+  802a49:	e8 56 00 00 00       	call   802aa4 <vcprintf>
+	cprintf("\n");
+  802a4e:	c7 04 24 30 3c 80 00 	movl   $0x803c30,(%esp)
+  802a55:	e8 9b 00 00 00       	call   802af5 <cprintf>
+  802a5a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a5d:	cc                   	int3
+	while (1)
+  802a5e:	eb fd                	jmp    802a5d <_panic+0x43>
+
+00802a60 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a60:	55                   	push   %ebp
+  802a61:	89 e5                	mov    %esp,%ebp
+  802a63:	53                   	push   %ebx
+  802a64:	83 ec 04             	sub    $0x4,%esp
+  802a67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a6a:	8b 13                	mov    (%ebx),%edx
+  802a6c:	8d 42 01             	lea    0x1(%edx),%eax
+  802a6f:	89 03                	mov    %eax,(%ebx)
+  802a71:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a74:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a78:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a7d:	74 09                	je     802a88 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a7f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a86:	c9                   	leave
+  802a87:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a88:	83 ec 08             	sub    $0x8,%esp
+  802a8b:	68 ff 00 00 00       	push   $0xff
+  802a90:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a93:	50                   	push   %eax
+  802a94:	e8 64 d6 ff ff       	call   8000fd <sys_cputs>
+		b->idx = 0;
+  802a99:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a9f:	83 c4 10             	add    $0x10,%esp
+  802aa2:	eb db                	jmp    802a7f <putch+0x1f>
+
+00802aa4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802aad:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802ab4:	00 00 00 
+	b.cnt = 0;
+  802ab7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802abe:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802ac1:	ff 75 0c             	push   0xc(%ebp)
+  802ac4:	ff 75 08             	push   0x8(%ebp)
+  802ac7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802acd:	50                   	push   %eax
+  802ace:	68 60 2a 80 00       	push   $0x802a60
+  802ad3:	e8 1c 01 00 00       	call   802bf4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802ad8:	83 c4 08             	add    $0x8,%esp
+  802adb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802ae1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802ae7:	50                   	push   %eax
+  802ae8:	e8 10 d6 ff ff       	call   8000fd <sys_cputs>
+
+	return b.cnt;
+}
+  802aed:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802af3:	c9                   	leave
+  802af4:	c3                   	ret
+
+00802af5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802af5:	55                   	push   %ebp
+  802af6:	89 e5                	mov    %esp,%ebp
+  802af8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802afb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802afe:	50                   	push   %eax
+  802aff:	ff 75 08             	push   0x8(%ebp)
+  802b02:	e8 9d ff ff ff       	call   802aa4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802b07:	c9                   	leave
+  802b08:	c3                   	ret
+
+00802b09 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	57                   	push   %edi
+  802b0d:	56                   	push   %esi
+  802b0e:	53                   	push   %ebx
+  802b0f:	83 ec 1c             	sub    $0x1c,%esp
+  802b12:	89 c3                	mov    %eax,%ebx
+  802b14:	89 d6                	mov    %edx,%esi
+  802b16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b19:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b1c:	89 d1                	mov    %edx,%ecx
+  802b1e:	89 c2                	mov    %eax,%edx
+  802b20:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802b23:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b26:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802b29:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b2c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b33:	39 c2                	cmp    %eax,%edx
+  802b35:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802b38:	73 4b                	jae    802b85 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802b3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b3d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b40:	85 ff                	test   %edi,%edi
+  802b42:	7e 11                	jle    802b55 <printnum+0x4c>
+			putch(padc, putdat);
+  802b44:	83 ec 08             	sub    $0x8,%esp
+  802b47:	56                   	push   %esi
+  802b48:	ff 75 18             	push   0x18(%ebp)
+  802b4b:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	83 ef 01             	sub    $0x1,%edi
+  802b53:	75 ef                	jne    802b44 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b55:	83 ec 08             	sub    $0x8,%esp
+  802b58:	56                   	push   %esi
+  802b59:	83 ec 04             	sub    $0x4,%esp
+  802b5c:	ff 75 e4             	push   -0x1c(%ebp)
+  802b5f:	ff 75 e0             	push   -0x20(%ebp)
+  802b62:	ff 75 dc             	push   -0x24(%ebp)
+  802b65:	ff 75 d8             	push   -0x28(%ebp)
+  802b68:	e8 71 0e 00 00       	call   8039de <__umoddi3>
+  802b6d:	83 c4 14             	add    $0x14,%esp
+  802b70:	0f be 80 6f 3c 80 00 	movsbl 0x803c6f(%eax),%eax
+  802b77:	50                   	push   %eax
+  802b78:	ff d3                	call   *%ebx
+}
+  802b7a:	83 c4 10             	add    $0x10,%esp
+  802b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b80:	5b                   	pop    %ebx
+  802b81:	5e                   	pop    %esi
+  802b82:	5f                   	pop    %edi
+  802b83:	5d                   	pop    %ebp
+  802b84:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b85:	83 ec 0c             	sub    $0xc,%esp
+  802b88:	ff 75 18             	push   0x18(%ebp)
+  802b8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b8e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b91:	52                   	push   %edx
+  802b92:	50                   	push   %eax
+  802b93:	83 ec 08             	sub    $0x8,%esp
+  802b96:	ff 75 e4             	push   -0x1c(%ebp)
+  802b99:	ff 75 e0             	push   -0x20(%ebp)
+  802b9c:	ff 75 dc             	push   -0x24(%ebp)
+  802b9f:	ff 75 d8             	push   -0x28(%ebp)
+  802ba2:	e8 71 0d 00 00       	call   803918 <__udivdi3>
+  802ba7:	83 c4 18             	add    $0x18,%esp
+  802baa:	52                   	push   %edx
+  802bab:	50                   	push   %eax
+  802bac:	89 f2                	mov    %esi,%edx
+  802bae:	89 d8                	mov    %ebx,%eax
+  802bb0:	e8 54 ff ff ff       	call   802b09 <printnum>
+  802bb5:	83 c4 20             	add    $0x20,%esp
+  802bb8:	eb 9b                	jmp    802b55 <printnum+0x4c>
+
+00802bba <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802bba:	55                   	push   %ebp
+  802bbb:	89 e5                	mov    %esp,%ebp
+  802bbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802bc0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802bc4:	8b 10                	mov    (%eax),%edx
+  802bc6:	3b 50 04             	cmp    0x4(%eax),%edx
+  802bc9:	73 0a                	jae    802bd5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802bcb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802bce:	89 08                	mov    %ecx,(%eax)
+  802bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd3:	88 02                	mov    %al,(%edx)
+}
+  802bd5:	5d                   	pop    %ebp
+  802bd6:	c3                   	ret
+
+00802bd7 <printfmt>:
+{
+  802bd7:	55                   	push   %ebp
+  802bd8:	89 e5                	mov    %esp,%ebp
+  802bda:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802bdd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802be0:	50                   	push   %eax
+  802be1:	ff 75 10             	push   0x10(%ebp)
+  802be4:	ff 75 0c             	push   0xc(%ebp)
+  802be7:	ff 75 08             	push   0x8(%ebp)
+  802bea:	e8 05 00 00 00       	call   802bf4 <vprintfmt>
+}
+  802bef:	83 c4 10             	add    $0x10,%esp
+  802bf2:	c9                   	leave
+  802bf3:	c3                   	ret
+
+00802bf4 <vprintfmt>:
+{
+  802bf4:	55                   	push   %ebp
+  802bf5:	89 e5                	mov    %esp,%ebp
+  802bf7:	57                   	push   %edi
+  802bf8:	56                   	push   %esi
+  802bf9:	53                   	push   %ebx
+  802bfa:	83 ec 2c             	sub    $0x2c,%esp
+  802bfd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c00:	89 df                	mov    %ebx,%edi
+  802c02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802c05:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c08:	8d 70 01             	lea    0x1(%eax),%esi
+  802c0b:	0f b6 00             	movzbl (%eax),%eax
+  802c0e:	83 f8 25             	cmp    $0x25,%eax
+  802c11:	74 1e                	je     802c31 <vprintfmt+0x3d>
+			if (ch == '\0')
+  802c13:	85 c0                	test   %eax,%eax
+  802c15:	0f 84 15 05 00 00    	je     803130 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802c1b:	83 ec 08             	sub    $0x8,%esp
+  802c1e:	53                   	push   %ebx
+  802c1f:	50                   	push   %eax
+  802c20:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802c22:	83 c6 01             	add    $0x1,%esi
+  802c25:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802c29:	83 c4 10             	add    $0x10,%esp
+  802c2c:	83 f8 25             	cmp    $0x25,%eax
+  802c2f:	75 e2                	jne    802c13 <vprintfmt+0x1f>
+		padc = ' ';
+  802c31:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802c35:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802c3c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802c43:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c4f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c52:	8d 56 01             	lea    0x1(%esi),%edx
+  802c55:	0f b6 0e             	movzbl (%esi),%ecx
+  802c58:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c5b:	3c 55                	cmp    $0x55,%al
+  802c5d:	0f 87 3b 04 00 00    	ja     80309e <vprintfmt+0x4aa>
+  802c63:	0f b6 c0             	movzbl %al,%eax
+  802c66:	ff 24 85 e0 3d 80 00 	jmp    *0x803de0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c6d:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c70:	eb 93                	jmp    802c05 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c72:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c74:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c78:	eb d8                	jmp    802c52 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c7a:	89 d6                	mov    %edx,%esi
+  802c7c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c80:	eb d0                	jmp    802c52 <vprintfmt+0x5e>
+  802c82:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c85:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c88:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c8b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c8f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c92:	83 f9 09             	cmp    $0x9,%ecx
+  802c95:	77 6f                	ja     802d06 <vprintfmt+0x112>
+  802c97:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c9a:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c9d:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802ca0:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802ca4:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802ca7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802caa:	83 fe 09             	cmp    $0x9,%esi
+  802cad:	76 eb                	jbe    802c9a <vprintfmt+0xa6>
+  802caf:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802cb2:	89 d6                	mov    %edx,%esi
+  802cb4:	eb 13                	jmp    802cc9 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802cb6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cb9:	8b 00                	mov    (%eax),%eax
+  802cbb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802cbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cc1:	8d 40 04             	lea    0x4(%eax),%eax
+  802cc4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc7:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802cc9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802ccd:	79 83                	jns    802c52 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802ccf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802cd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802cd5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802cdc:	e9 71 ff ff ff       	jmp    802c52 <vprintfmt+0x5e>
+			if (width < 0)
+  802ce1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ce4:	85 c9                	test   %ecx,%ecx
+  802ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ceb:	0f 49 c1             	cmovns %ecx,%eax
+  802cee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cf1:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cf3:	e9 5a ff ff ff       	jmp    802c52 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cf8:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cfa:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802d01:	e9 4c ff ff ff       	jmp    802c52 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802d06:	89 d6                	mov    %edx,%esi
+  802d08:	eb bf                	jmp    802cc9 <vprintfmt+0xd5>
+			lflag++;
+  802d0a:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802d0e:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802d10:	e9 3d ff ff ff       	jmp    802c52 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802d15:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d18:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d1b:	8d 70 04             	lea    0x4(%eax),%esi
+  802d1e:	83 ec 08             	sub    $0x8,%esp
+  802d21:	53                   	push   %ebx
+  802d22:	ff 30                	push   (%eax)
+  802d24:	ff d7                	call   *%edi
+			break;
+  802d26:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802d29:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802d2c:	e9 d4 fe ff ff       	jmp    802c05 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802d31:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d34:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d37:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802d3a:	8b 10                	mov    (%eax),%edx
+  802d3c:	89 d0                	mov    %edx,%eax
+  802d3e:	f7 d8                	neg    %eax
+  802d40:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802d43:	83 f8 12             	cmp    $0x12,%eax
+  802d46:	7f 23                	jg     802d6b <vprintfmt+0x177>
+  802d48:	8b 14 85 40 3f 80 00 	mov    0x803f40(,%eax,4),%edx
+  802d4f:	85 d2                	test   %edx,%edx
+  802d51:	74 18                	je     802d6b <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d53:	52                   	push   %edx
+  802d54:	68 fb 3b 80 00       	push   $0x803bfb
+  802d59:	53                   	push   %ebx
+  802d5a:	57                   	push   %edi
+  802d5b:	e8 77 fe ff ff       	call   802bd7 <printfmt>
+  802d60:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d63:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d66:	e9 9a fe ff ff       	jmp    802c05 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d6b:	50                   	push   %eax
+  802d6c:	68 87 3c 80 00       	push   $0x803c87
+  802d71:	53                   	push   %ebx
+  802d72:	57                   	push   %edi
+  802d73:	e8 5f fe ff ff       	call   802bd7 <printfmt>
+  802d78:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d7b:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d7e:	e9 82 fe ff ff       	jmp    802c05 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d83:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d86:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d89:	83 c0 04             	add    $0x4,%eax
+  802d8c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d92:	8b 00                	mov    (%eax),%eax
+  802d94:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	0f 84 61 03 00 00    	je     803100 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d9f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802da3:	7e 06                	jle    802dab <vprintfmt+0x1b7>
+  802da5:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802da9:	75 29                	jne    802dd4 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dab:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dae:	8d 70 01             	lea    0x1(%eax),%esi
+  802db1:	0f b6 00             	movzbl (%eax),%eax
+  802db4:	0f be d0             	movsbl %al,%edx
+  802db7:	85 d2                	test   %edx,%edx
+  802db9:	0f 84 bb 00 00 00    	je     802e7a <vprintfmt+0x286>
+  802dbf:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802dc2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802dc5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802dc8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dcb:	eb 7a                	jmp    802e47 <vprintfmt+0x253>
+				p = "(null)";
+  802dcd:	c7 45 d0 80 3c 80 00 	movl   $0x803c80,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dd4:	83 ec 08             	sub    $0x8,%esp
+  802dd7:	ff 75 d4             	push   -0x2c(%ebp)
+  802dda:	ff 75 d0             	push   -0x30(%ebp)
+  802ddd:	e8 e0 03 00 00       	call   8031c2 <strnlen>
+  802de2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802de5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802de8:	83 c4 10             	add    $0x10,%esp
+  802deb:	85 d2                	test   %edx,%edx
+  802ded:	0f 8e d6 02 00 00    	jle    8030c9 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802df3:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802df7:	83 ec 08             	sub    $0x8,%esp
+  802dfa:	53                   	push   %ebx
+  802dfb:	56                   	push   %esi
+  802dfc:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dfe:	83 c4 10             	add    $0x10,%esp
+  802e01:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802e05:	75 f0                	jne    802df7 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802e07:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802e0a:	8d 70 01             	lea    0x1(%eax),%esi
+  802e0d:	0f b6 00             	movzbl (%eax),%eax
+  802e10:	0f be d0             	movsbl %al,%edx
+  802e13:	85 d2                	test   %edx,%edx
+  802e15:	0f 84 da 02 00 00    	je     8030f5 <vprintfmt+0x501>
+  802e1b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802e1e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802e21:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802e24:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e27:	eb 1e                	jmp    802e47 <vprintfmt+0x253>
+					putch(ch, putdat);
+  802e29:	83 ec 08             	sub    $0x8,%esp
+  802e2c:	ff 75 0c             	push   0xc(%ebp)
+  802e2f:	52                   	push   %edx
+  802e30:	ff 55 08             	call   *0x8(%ebp)
+  802e33:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802e36:	83 eb 01             	sub    $0x1,%ebx
+  802e39:	83 c6 01             	add    $0x1,%esi
+  802e3c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e40:	0f be d0             	movsbl %al,%edx
+  802e43:	85 d2                	test   %edx,%edx
+  802e45:	74 2a                	je     802e71 <vprintfmt+0x27d>
+  802e47:	85 ff                	test   %edi,%edi
+  802e49:	78 05                	js     802e50 <vprintfmt+0x25c>
+  802e4b:	83 ef 01             	sub    $0x1,%edi
+  802e4e:	78 59                	js     802ea9 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e50:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e54:	74 d3                	je     802e29 <vprintfmt+0x235>
+  802e56:	0f be c0             	movsbl %al,%eax
+  802e59:	83 e8 20             	sub    $0x20,%eax
+  802e5c:	83 f8 5e             	cmp    $0x5e,%eax
+  802e5f:	76 c8                	jbe    802e29 <vprintfmt+0x235>
+					putch('?', putdat);
+  802e61:	83 ec 08             	sub    $0x8,%esp
+  802e64:	ff 75 0c             	push   0xc(%ebp)
+  802e67:	6a 3f                	push   $0x3f
+  802e69:	ff 55 08             	call   *0x8(%ebp)
+  802e6c:	83 c4 10             	add    $0x10,%esp
+  802e6f:	eb c5                	jmp    802e36 <vprintfmt+0x242>
+  802e71:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e74:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e7a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e7d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e81:	7e 1b                	jle    802e9e <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e83:	83 ec 08             	sub    $0x8,%esp
+  802e86:	53                   	push   %ebx
+  802e87:	6a 20                	push   $0x20
+  802e89:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e8b:	83 c4 10             	add    $0x10,%esp
+  802e8e:	83 ee 01             	sub    $0x1,%esi
+  802e91:	75 f0                	jne    802e83 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e93:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e96:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e99:	e9 67 fd ff ff       	jmp    802c05 <vprintfmt+0x11>
+  802e9e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802ea1:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ea4:	e9 5c fd ff ff       	jmp    802c05 <vprintfmt+0x11>
+  802ea9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802eac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802eaf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802eb2:	eb c6                	jmp    802e7a <vprintfmt+0x286>
+	if (lflag >= 2)
+  802eb4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802eb7:	89 55 10             	mov    %edx,0x10(%ebp)
+  802eba:	83 f9 01             	cmp    $0x1,%ecx
+  802ebd:	7f 1f                	jg     802ede <vprintfmt+0x2ea>
+	else if (lflag)
+  802ebf:	85 c9                	test   %ecx,%ecx
+  802ec1:	74 67                	je     802f2a <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802ec3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ec6:	8b 30                	mov    (%eax),%esi
+  802ec8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802ecb:	89 f0                	mov    %esi,%eax
+  802ecd:	c1 f8 1f             	sar    $0x1f,%eax
+  802ed0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802ed3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ed6:	8d 40 04             	lea    0x4(%eax),%eax
+  802ed9:	89 45 14             	mov    %eax,0x14(%ebp)
+  802edc:	eb 17                	jmp    802ef5 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802ede:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ee1:	8b 50 04             	mov    0x4(%eax),%edx
+  802ee4:	8b 00                	mov    (%eax),%eax
+  802ee6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ee9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802eec:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eef:	8d 40 08             	lea    0x8(%eax),%eax
+  802ef2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802ef5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ef8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802efb:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802f00:	85 c9                	test   %ecx,%ecx
+  802f02:	0f 89 12 01 00 00    	jns    80301a <vprintfmt+0x426>
+				putch('-', putdat);
+  802f08:	83 ec 08             	sub    $0x8,%esp
+  802f0b:	53                   	push   %ebx
+  802f0c:	6a 2d                	push   $0x2d
+  802f0e:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802f10:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802f13:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f16:	f7 da                	neg    %edx
+  802f18:	83 d1 00             	adc    $0x0,%ecx
+  802f1b:	f7 d9                	neg    %ecx
+  802f1d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802f20:	be 0a 00 00 00       	mov    $0xa,%esi
+  802f25:	e9 f0 00 00 00       	jmp    80301a <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802f2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2d:	8b 30                	mov    (%eax),%esi
+  802f2f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f32:	89 f0                	mov    %esi,%eax
+  802f34:	c1 f8 1f             	sar    $0x1f,%eax
+  802f37:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f3d:	8d 40 04             	lea    0x4(%eax),%eax
+  802f40:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f43:	eb b0                	jmp    802ef5 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f45:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f48:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f4b:	83 f9 01             	cmp    $0x1,%ecx
+  802f4e:	7f 1e                	jg     802f6e <vprintfmt+0x37a>
+	else if (lflag)
+  802f50:	85 c9                	test   %ecx,%ecx
+  802f52:	74 32                	je     802f86 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f54:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f57:	8b 10                	mov    (%eax),%edx
+  802f59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f5e:	8d 40 04             	lea    0x4(%eax),%eax
+  802f61:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f64:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f69:	e9 ac 00 00 00       	jmp    80301a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f71:	8b 10                	mov    (%eax),%edx
+  802f73:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f76:	8d 40 08             	lea    0x8(%eax),%eax
+  802f79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f7c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f81:	e9 94 00 00 00       	jmp    80301a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f86:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f89:	8b 10                	mov    (%eax),%edx
+  802f8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f90:	8d 40 04             	lea    0x4(%eax),%eax
+  802f93:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f96:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f9b:	eb 7d                	jmp    80301a <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f9d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802fa0:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fa3:	83 f9 01             	cmp    $0x1,%ecx
+  802fa6:	7f 1b                	jg     802fc3 <vprintfmt+0x3cf>
+	else if (lflag)
+  802fa8:	85 c9                	test   %ecx,%ecx
+  802faa:	74 2c                	je     802fd8 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802fac:	8b 45 14             	mov    0x14(%ebp),%eax
+  802faf:	8b 10                	mov    (%eax),%edx
+  802fb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fb6:	8d 40 04             	lea    0x4(%eax),%eax
+  802fb9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fbc:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802fc1:	eb 57                	jmp    80301a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802fc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc6:	8b 10                	mov    (%eax),%edx
+  802fc8:	8b 48 04             	mov    0x4(%eax),%ecx
+  802fcb:	8d 40 08             	lea    0x8(%eax),%eax
+  802fce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fd1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802fd6:	eb 42                	jmp    80301a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802fd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fdb:	8b 10                	mov    (%eax),%edx
+  802fdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fe2:	8d 40 04             	lea    0x4(%eax),%eax
+  802fe5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fe8:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fed:	eb 2b                	jmp    80301a <vprintfmt+0x426>
+			putch('0', putdat);
+  802fef:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ff2:	83 ec 08             	sub    $0x8,%esp
+  802ff5:	53                   	push   %ebx
+  802ff6:	6a 30                	push   $0x30
+  802ff8:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802ffa:	83 c4 08             	add    $0x8,%esp
+  802ffd:	53                   	push   %ebx
+  802ffe:	6a 78                	push   $0x78
+  803000:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  803002:	8b 45 14             	mov    0x14(%ebp),%eax
+  803005:	8b 10                	mov    (%eax),%edx
+  803007:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80300c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80300f:	8d 40 04             	lea    0x4(%eax),%eax
+  803012:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803015:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80301a:	83 ec 0c             	sub    $0xc,%esp
+  80301d:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  803021:	50                   	push   %eax
+  803022:	ff 75 e4             	push   -0x1c(%ebp)
+  803025:	56                   	push   %esi
+  803026:	51                   	push   %ecx
+  803027:	52                   	push   %edx
+  803028:	89 da                	mov    %ebx,%edx
+  80302a:	89 f8                	mov    %edi,%eax
+  80302c:	e8 d8 fa ff ff       	call   802b09 <printnum>
+			break;
+  803031:	83 c4 20             	add    $0x20,%esp
+  803034:	e9 cc fb ff ff       	jmp    802c05 <vprintfmt+0x11>
+	if (lflag >= 2)
+  803039:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80303c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80303f:	83 f9 01             	cmp    $0x1,%ecx
+  803042:	7f 1b                	jg     80305f <vprintfmt+0x46b>
+	else if (lflag)
+  803044:	85 c9                	test   %ecx,%ecx
+  803046:	74 2c                	je     803074 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803048:	8b 45 14             	mov    0x14(%ebp),%eax
+  80304b:	8b 10                	mov    (%eax),%edx
+  80304d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803052:	8d 40 04             	lea    0x4(%eax),%eax
+  803055:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803058:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80305d:	eb bb                	jmp    80301a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80305f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803062:	8b 10                	mov    (%eax),%edx
+  803064:	8b 48 04             	mov    0x4(%eax),%ecx
+  803067:	8d 40 08             	lea    0x8(%eax),%eax
+  80306a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80306d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  803072:	eb a6                	jmp    80301a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803074:	8b 45 14             	mov    0x14(%ebp),%eax
+  803077:	8b 10                	mov    (%eax),%edx
+  803079:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80307e:	8d 40 04             	lea    0x4(%eax),%eax
+  803081:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803084:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  803089:	eb 8f                	jmp    80301a <vprintfmt+0x426>
+			putch(ch, putdat);
+  80308b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80308e:	83 ec 08             	sub    $0x8,%esp
+  803091:	53                   	push   %ebx
+  803092:	6a 25                	push   $0x25
+  803094:	ff d7                	call   *%edi
+			break;
+  803096:	83 c4 10             	add    $0x10,%esp
+  803099:	e9 67 fb ff ff       	jmp    802c05 <vprintfmt+0x11>
+			putch('%', putdat);
+  80309e:	83 ec 08             	sub    $0x8,%esp
+  8030a1:	53                   	push   %ebx
+  8030a2:	6a 25                	push   $0x25
+  8030a4:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8030a6:	83 c4 10             	add    $0x10,%esp
+  8030a9:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8030ad:	0f 84 ba fb ff ff    	je     802c6d <vprintfmt+0x79>
+  8030b3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8030b6:	89 f0                	mov    %esi,%eax
+  8030b8:	83 e8 01             	sub    $0x1,%eax
+  8030bb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8030bf:	75 f7                	jne    8030b8 <vprintfmt+0x4c4>
+  8030c1:	89 45 10             	mov    %eax,0x10(%ebp)
+  8030c4:	e9 3c fb ff ff       	jmp    802c05 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030c9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8030cc:	8d 70 01             	lea    0x1(%eax),%esi
+  8030cf:	0f b6 00             	movzbl (%eax),%eax
+  8030d2:	0f be d0             	movsbl %al,%edx
+  8030d5:	85 d2                	test   %edx,%edx
+  8030d7:	74 11                	je     8030ea <vprintfmt+0x4f6>
+  8030d9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030dc:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030df:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030e2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030e5:	e9 5d fd ff ff       	jmp    802e47 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030f0:	e9 10 fb ff ff       	jmp    802c05 <vprintfmt+0x11>
+  8030f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030fb:	e9 05 fb ff ff       	jmp    802c05 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  803100:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803104:	7e 0a                	jle    803110 <vprintfmt+0x51c>
+  803106:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80310a:	0f 85 bd fc ff ff    	jne    802dcd <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803110:	ba 28 00 00 00       	mov    $0x28,%edx
+  803115:	b8 28 00 00 00       	mov    $0x28,%eax
+  80311a:	be 81 3c 80 00       	mov    $0x803c81,%esi
+  80311f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  803122:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803125:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803128:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80312b:	e9 17 fd ff ff       	jmp    802e47 <vprintfmt+0x253>
+}
+  803130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803133:	5b                   	pop    %ebx
+  803134:	5e                   	pop    %esi
+  803135:	5f                   	pop    %edi
+  803136:	5d                   	pop    %ebp
+  803137:	c3                   	ret
+
+00803138 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803138:	55                   	push   %ebp
+  803139:	89 e5                	mov    %esp,%ebp
+  80313b:	83 ec 18             	sub    $0x18,%esp
+  80313e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803141:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803144:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803147:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80314b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80314e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803155:	85 c0                	test   %eax,%eax
+  803157:	74 26                	je     80317f <vsnprintf+0x47>
+  803159:	85 d2                	test   %edx,%edx
+  80315b:	7e 22                	jle    80317f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80315d:	ff 75 14             	push   0x14(%ebp)
+  803160:	ff 75 10             	push   0x10(%ebp)
+  803163:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803166:	50                   	push   %eax
+  803167:	68 ba 2b 80 00       	push   $0x802bba
+  80316c:	e8 83 fa ff ff       	call   802bf4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803171:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803174:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803177:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80317a:	83 c4 10             	add    $0x10,%esp
+}
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+		return -E_INVAL;
+  80317f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803184:	eb f7                	jmp    80317d <vsnprintf+0x45>
+
+00803186 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803186:	55                   	push   %ebp
+  803187:	89 e5                	mov    %esp,%ebp
+  803189:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80318c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80318f:	50                   	push   %eax
+  803190:	ff 75 10             	push   0x10(%ebp)
+  803193:	ff 75 0c             	push   0xc(%ebp)
+  803196:	ff 75 08             	push   0x8(%ebp)
+  803199:	e8 9a ff ff ff       	call   803138 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80319e:	c9                   	leave
+  80319f:	c3                   	ret
+
+008031a0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8031a0:	55                   	push   %ebp
+  8031a1:	89 e5                	mov    %esp,%ebp
+  8031a3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8031a6:	80 3a 00             	cmpb   $0x0,(%edx)
+  8031a9:	74 10                	je     8031bb <strlen+0x1b>
+  8031ab:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8031b0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8031b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8031b7:	75 f7                	jne    8031b0 <strlen+0x10>
+	return n;
+}
+  8031b9:	5d                   	pop    %ebp
+  8031ba:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8031bb:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8031c0:	eb f7                	jmp    8031b9 <strlen+0x19>
+
+008031c2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8031c2:	55                   	push   %ebp
+  8031c3:	89 e5                	mov    %esp,%ebp
+  8031c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031cb:	85 d2                	test   %edx,%edx
+  8031cd:	74 16                	je     8031e5 <strnlen+0x23>
+  8031cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8031d8:	74 09                	je     8031e3 <strnlen+0x21>
+		n++;
+  8031da:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031dd:	39 d0                	cmp    %edx,%eax
+  8031df:	75 f3                	jne    8031d4 <strnlen+0x12>
+		n++;
+  8031e1:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8031e3:	5d                   	pop    %ebp
+  8031e4:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ea:	eb f7                	jmp    8031e3 <strnlen+0x21>
+
+008031ec <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031ec:	55                   	push   %ebp
+  8031ed:	89 e5                	mov    %esp,%ebp
+  8031ef:	53                   	push   %ebx
+  8031f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031fb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031ff:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  803202:	83 c0 01             	add    $0x1,%eax
+  803205:	84 d2                	test   %dl,%dl
+  803207:	75 f2                	jne    8031fb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  803209:	89 c8                	mov    %ecx,%eax
+  80320b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80320e:	c9                   	leave
+  80320f:	c3                   	ret
+
+00803210 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  803210:	55                   	push   %ebp
+  803211:	89 e5                	mov    %esp,%ebp
+  803213:	53                   	push   %ebx
+  803214:	83 ec 10             	sub    $0x10,%esp
+  803217:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80321a:	53                   	push   %ebx
+  80321b:	e8 80 ff ff ff       	call   8031a0 <strlen>
+  803220:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  803223:	ff 75 0c             	push   0xc(%ebp)
+  803226:	01 d8                	add    %ebx,%eax
+  803228:	50                   	push   %eax
+  803229:	e8 be ff ff ff       	call   8031ec <strcpy>
+	return dst;
+}
+  80322e:	89 d8                	mov    %ebx,%eax
+  803230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803233:	c9                   	leave
+  803234:	c3                   	ret
+
+00803235 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	56                   	push   %esi
+  803239:	53                   	push   %ebx
+  80323a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80323d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803240:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  803243:	85 db                	test   %ebx,%ebx
+  803245:	74 17                	je     80325e <strncpy+0x29>
+  803247:	01 f3                	add    %esi,%ebx
+  803249:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80324b:	83 c0 01             	add    $0x1,%eax
+  80324e:	0f b6 0a             	movzbl (%edx),%ecx
+  803251:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803254:	80 f9 01             	cmp    $0x1,%cl
+  803257:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80325a:	39 c3                	cmp    %eax,%ebx
+  80325c:	75 ed                	jne    80324b <strncpy+0x16>
+	}
+	return ret;
+}
+  80325e:	89 f0                	mov    %esi,%eax
+  803260:	5b                   	pop    %ebx
+  803261:	5e                   	pop    %esi
+  803262:	5d                   	pop    %ebp
+  803263:	c3                   	ret
+
+00803264 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803264:	55                   	push   %ebp
+  803265:	89 e5                	mov    %esp,%ebp
+  803267:	56                   	push   %esi
+  803268:	53                   	push   %ebx
+  803269:	8b 75 08             	mov    0x8(%ebp),%esi
+  80326c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80326f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803272:	89 f0                	mov    %esi,%eax
+  803274:	85 db                	test   %ebx,%ebx
+  803276:	74 1e                	je     803296 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  803278:	83 eb 01             	sub    $0x1,%ebx
+  80327b:	74 16                	je     803293 <strlcpy+0x2f>
+  80327d:	01 f3                	add    %esi,%ebx
+  80327f:	0f b6 0a             	movzbl (%edx),%ecx
+  803282:	84 c9                	test   %cl,%cl
+  803284:	74 0d                	je     803293 <strlcpy+0x2f>
+			*dst++ = *src++;
+  803286:	83 c2 01             	add    $0x1,%edx
+  803289:	83 c0 01             	add    $0x1,%eax
+  80328c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80328f:	39 d8                	cmp    %ebx,%eax
+  803291:	75 ec                	jne    80327f <strlcpy+0x1b>
+		*dst = '\0';
+  803293:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803296:	29 f0                	sub    %esi,%eax
+}
+  803298:	5b                   	pop    %ebx
+  803299:	5e                   	pop    %esi
+  80329a:	5d                   	pop    %ebp
+  80329b:	c3                   	ret
+
+0080329c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80329c:	55                   	push   %ebp
+  80329d:	89 e5                	mov    %esp,%ebp
+  80329f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8032a5:	0f b6 01             	movzbl (%ecx),%eax
+  8032a8:	84 c0                	test   %al,%al
+  8032aa:	74 11                	je     8032bd <strcmp+0x21>
+  8032ac:	38 02                	cmp    %al,(%edx)
+  8032ae:	75 0d                	jne    8032bd <strcmp+0x21>
+		p++, q++;
+  8032b0:	83 c1 01             	add    $0x1,%ecx
+  8032b3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8032b6:	0f b6 01             	movzbl (%ecx),%eax
+  8032b9:	84 c0                	test   %al,%al
+  8032bb:	75 ef                	jne    8032ac <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032bd:	0f b6 c0             	movzbl %al,%eax
+  8032c0:	0f b6 12             	movzbl (%edx),%edx
+  8032c3:	29 d0                	sub    %edx,%eax
+}
+  8032c5:	5d                   	pop    %ebp
+  8032c6:	c3                   	ret
+
+008032c7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8032c7:	55                   	push   %ebp
+  8032c8:	89 e5                	mov    %esp,%ebp
+  8032ca:	53                   	push   %ebx
+  8032cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8032d1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8032d4:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8032d9:	85 d2                	test   %edx,%edx
+  8032db:	74 2e                	je     80330b <strncmp+0x44>
+  8032dd:	0f b6 01             	movzbl (%ecx),%eax
+  8032e0:	84 c0                	test   %al,%al
+  8032e2:	74 16                	je     8032fa <strncmp+0x33>
+  8032e4:	3a 03                	cmp    (%ebx),%al
+  8032e6:	75 12                	jne    8032fa <strncmp+0x33>
+		n--, p++, q++;
+  8032e8:	83 c1 01             	add    $0x1,%ecx
+  8032eb:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032ee:	83 ea 01             	sub    $0x1,%edx
+  8032f1:	75 ea                	jne    8032dd <strncmp+0x16>
+		return 0;
+  8032f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f8:	eb 11                	jmp    80330b <strncmp+0x44>
+  8032fa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032ff:	85 d2                	test   %edx,%edx
+  803301:	74 08                	je     80330b <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803303:	0f b6 01             	movzbl (%ecx),%eax
+  803306:	0f b6 13             	movzbl (%ebx),%edx
+  803309:	29 d0                	sub    %edx,%eax
+}
+  80330b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80330e:	c9                   	leave
+  80330f:	c3                   	ret
+
+00803310 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  803310:	55                   	push   %ebp
+  803311:	89 e5                	mov    %esp,%ebp
+  803313:	8b 45 08             	mov    0x8(%ebp),%eax
+  803316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80331a:	0f b6 10             	movzbl (%eax),%edx
+  80331d:	84 d2                	test   %dl,%dl
+  80331f:	74 15                	je     803336 <strchr+0x26>
+		if (*s == c)
+  803321:	38 d1                	cmp    %dl,%cl
+  803323:	74 0f                	je     803334 <strchr+0x24>
+	for (; *s; s++)
+  803325:	83 c0 01             	add    $0x1,%eax
+  803328:	0f b6 10             	movzbl (%eax),%edx
+  80332b:	84 d2                	test   %dl,%dl
+  80332d:	75 f2                	jne    803321 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  80332f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803334:	5d                   	pop    %ebp
+  803335:	c3                   	ret
+	return 0;
+  803336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333b:	eb f7                	jmp    803334 <strchr+0x24>
+
+0080333d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80333d:	55                   	push   %ebp
+  80333e:	89 e5                	mov    %esp,%ebp
+  803340:	53                   	push   %ebx
+  803341:	8b 45 08             	mov    0x8(%ebp),%eax
+  803344:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  803347:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  80334a:	38 d3                	cmp    %dl,%bl
+  80334c:	74 14                	je     803362 <strfind+0x25>
+  80334e:	89 d1                	mov    %edx,%ecx
+  803350:	84 db                	test   %bl,%bl
+  803352:	74 0e                	je     803362 <strfind+0x25>
+	for (; *s; s++)
+  803354:	83 c0 01             	add    $0x1,%eax
+  803357:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80335a:	38 ca                	cmp    %cl,%dl
+  80335c:	74 04                	je     803362 <strfind+0x25>
+  80335e:	84 d2                	test   %dl,%dl
+  803360:	75 f2                	jne    803354 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  803362:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803365:	c9                   	leave
+  803366:	c3                   	ret
+
+00803367 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803367:	55                   	push   %ebp
+  803368:	89 e5                	mov    %esp,%ebp
+  80336a:	57                   	push   %edi
+  80336b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80336e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  803371:	85 c9                	test   %ecx,%ecx
+  803373:	74 20                	je     803395 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803375:	89 f8                	mov    %edi,%eax
+  803377:	09 c8                	or     %ecx,%eax
+  803379:	a8 03                	test   $0x3,%al
+  80337b:	75 12                	jne    80338f <memset+0x28>
+		c &= 0xFF;
+  80337d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803381:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803387:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80338a:	fc                   	cld
+  80338b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80338d:	eb 06                	jmp    803395 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80338f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803392:	fc                   	cld
+  803393:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803395:	89 f8                	mov    %edi,%eax
+  803397:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80339a:	c9                   	leave
+  80339b:	c3                   	ret
+
+0080339c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80339c:	55                   	push   %ebp
+  80339d:	89 e5                	mov    %esp,%ebp
+  80339f:	57                   	push   %edi
+  8033a0:	56                   	push   %esi
+  8033a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033a4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8033aa:	39 c6                	cmp    %eax,%esi
+  8033ac:	73 32                	jae    8033e0 <memmove+0x44>
+  8033ae:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8033b1:	39 d0                	cmp    %edx,%eax
+  8033b3:	73 2b                	jae    8033e0 <memmove+0x44>
+		s += n;
+		d += n;
+  8033b5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033b8:	89 d6                	mov    %edx,%esi
+  8033ba:	09 fe                	or     %edi,%esi
+  8033bc:	09 ce                	or     %ecx,%esi
+  8033be:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8033c4:	75 0e                	jne    8033d4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8033c6:	83 ef 04             	sub    $0x4,%edi
+  8033c9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8033cc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8033cf:	fd                   	std
+  8033d0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033d2:	eb 09                	jmp    8033dd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8033d4:	83 ef 01             	sub    $0x1,%edi
+  8033d7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8033da:	fd                   	std
+  8033db:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8033dd:	fc                   	cld
+  8033de:	eb 1a                	jmp    8033fa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033e0:	89 f2                	mov    %esi,%edx
+  8033e2:	09 c2                	or     %eax,%edx
+  8033e4:	09 ca                	or     %ecx,%edx
+  8033e6:	f6 c2 03             	test   $0x3,%dl
+  8033e9:	75 0a                	jne    8033f5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033eb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033ee:	89 c7                	mov    %eax,%edi
+  8033f0:	fc                   	cld
+  8033f1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033f3:	eb 05                	jmp    8033fa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033f5:	89 c7                	mov    %eax,%edi
+  8033f7:	fc                   	cld
+  8033f8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033fa:	5e                   	pop    %esi
+  8033fb:	5f                   	pop    %edi
+  8033fc:	5d                   	pop    %ebp
+  8033fd:	c3                   	ret
+
+008033fe <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033fe:	55                   	push   %ebp
+  8033ff:	89 e5                	mov    %esp,%ebp
+  803401:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803404:	ff 75 10             	push   0x10(%ebp)
+  803407:	ff 75 0c             	push   0xc(%ebp)
+  80340a:	ff 75 08             	push   0x8(%ebp)
+  80340d:	e8 8a ff ff ff       	call   80339c <memmove>
+}
+  803412:	c9                   	leave
+  803413:	c3                   	ret
+
+00803414 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803414:	55                   	push   %ebp
+  803415:	89 e5                	mov    %esp,%ebp
+  803417:	56                   	push   %esi
+  803418:	53                   	push   %ebx
+  803419:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80341f:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803422:	85 f6                	test   %esi,%esi
+  803424:	74 29                	je     80344f <memcmp+0x3b>
+  803426:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  803428:	0f b6 08             	movzbl (%eax),%ecx
+  80342b:	0f b6 1a             	movzbl (%edx),%ebx
+  80342e:	38 d9                	cmp    %bl,%cl
+  803430:	75 11                	jne    803443 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803432:	83 c0 01             	add    $0x1,%eax
+  803435:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803438:	39 c6                	cmp    %eax,%esi
+  80343a:	75 ec                	jne    803428 <memcmp+0x14>
+	}
+
+	return 0;
+  80343c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803441:	eb 08                	jmp    80344b <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  803443:	0f b6 c1             	movzbl %cl,%eax
+  803446:	0f b6 db             	movzbl %bl,%ebx
+  803449:	29 d8                	sub    %ebx,%eax
+}
+  80344b:	5b                   	pop    %ebx
+  80344c:	5e                   	pop    %esi
+  80344d:	5d                   	pop    %ebp
+  80344e:	c3                   	ret
+	return 0;
+  80344f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803454:	eb f5                	jmp    80344b <memcmp+0x37>
+
+00803456 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803456:	55                   	push   %ebp
+  803457:	89 e5                	mov    %esp,%ebp
+  803459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80345c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80345f:	89 c2                	mov    %eax,%edx
+  803461:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803464:	39 d0                	cmp    %edx,%eax
+  803466:	73 0d                	jae    803475 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803468:	38 08                	cmp    %cl,(%eax)
+  80346a:	74 0d                	je     803479 <memfind+0x23>
+	for (; s < ends; s++)
+  80346c:	83 c0 01             	add    $0x1,%eax
+  80346f:	39 c2                	cmp    %eax,%edx
+  803471:	75 f5                	jne    803468 <memfind+0x12>
+  803473:	eb 06                	jmp    80347b <memfind+0x25>
+  803475:	89 c2                	mov    %eax,%edx
+  803477:	eb 02                	jmp    80347b <memfind+0x25>
+  803479:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  80347b:	89 d0                	mov    %edx,%eax
+  80347d:	5d                   	pop    %ebp
+  80347e:	c3                   	ret
+
+0080347f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80347f:	55                   	push   %ebp
+  803480:	89 e5                	mov    %esp,%ebp
+  803482:	57                   	push   %edi
+  803483:	56                   	push   %esi
+  803484:	53                   	push   %ebx
+  803485:	8b 55 08             	mov    0x8(%ebp),%edx
+  803488:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80348b:	0f b6 02             	movzbl (%edx),%eax
+  80348e:	3c 20                	cmp    $0x20,%al
+  803490:	74 04                	je     803496 <strtol+0x17>
+  803492:	3c 09                	cmp    $0x9,%al
+  803494:	75 0e                	jne    8034a4 <strtol+0x25>
+		s++;
+  803496:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803499:	0f b6 02             	movzbl (%edx),%eax
+  80349c:	3c 20                	cmp    $0x20,%al
+  80349e:	74 f6                	je     803496 <strtol+0x17>
+  8034a0:	3c 09                	cmp    $0x9,%al
+  8034a2:	74 f2                	je     803496 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  8034a4:	3c 2b                	cmp    $0x2b,%al
+  8034a6:	74 2a                	je     8034d2 <strtol+0x53>
+	int neg = 0;
+  8034a8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8034ad:	3c 2d                	cmp    $0x2d,%al
+  8034af:	74 2b                	je     8034dc <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034b1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8034b7:	75 0f                	jne    8034c8 <strtol+0x49>
+  8034b9:	80 3a 30             	cmpb   $0x30,(%edx)
+  8034bc:	74 28                	je     8034e6 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8034be:	85 db                	test   %ebx,%ebx
+  8034c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8034c5:	0f 44 d8             	cmove  %eax,%ebx
+  8034c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034cd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8034d0:	eb 46                	jmp    803518 <strtol+0x99>
+		s++;
+  8034d2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8034d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034da:	eb d5                	jmp    8034b1 <strtol+0x32>
+		s++, neg = 1;
+  8034dc:	83 c2 01             	add    $0x1,%edx
+  8034df:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034e4:	eb cb                	jmp    8034b1 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034e6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034ea:	74 0e                	je     8034fa <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034ec:	85 db                	test   %ebx,%ebx
+  8034ee:	75 d8                	jne    8034c8 <strtol+0x49>
+		s++, base = 8;
+  8034f0:	83 c2 01             	add    $0x1,%edx
+  8034f3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034f8:	eb ce                	jmp    8034c8 <strtol+0x49>
+		s += 2, base = 16;
+  8034fa:	83 c2 02             	add    $0x2,%edx
+  8034fd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803502:	eb c4                	jmp    8034c8 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803504:	0f be c0             	movsbl %al,%eax
+  803507:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80350a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80350d:	7d 3a                	jge    803549 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  80350f:	83 c2 01             	add    $0x1,%edx
+  803512:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803516:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803518:	0f b6 02             	movzbl (%edx),%eax
+  80351b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80351e:	89 f3                	mov    %esi,%ebx
+  803520:	80 fb 09             	cmp    $0x9,%bl
+  803523:	76 df                	jbe    803504 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  803525:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803528:	89 f3                	mov    %esi,%ebx
+  80352a:	80 fb 19             	cmp    $0x19,%bl
+  80352d:	77 08                	ja     803537 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  80352f:	0f be c0             	movsbl %al,%eax
+  803532:	83 e8 57             	sub    $0x57,%eax
+  803535:	eb d3                	jmp    80350a <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  803537:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80353a:	89 f3                	mov    %esi,%ebx
+  80353c:	80 fb 19             	cmp    $0x19,%bl
+  80353f:	77 08                	ja     803549 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  803541:	0f be c0             	movsbl %al,%eax
+  803544:	83 e8 37             	sub    $0x37,%eax
+  803547:	eb c1                	jmp    80350a <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803549:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80354d:	74 05                	je     803554 <strtol+0xd5>
+		*endptr = (char *) s;
+  80354f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803552:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803554:	89 c8                	mov    %ecx,%eax
+  803556:	f7 d8                	neg    %eax
+  803558:	85 ff                	test   %edi,%edi
+  80355a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80355d:	89 c8                	mov    %ecx,%eax
+  80355f:	5b                   	pop    %ebx
+  803560:	5e                   	pop    %esi
+  803561:	5f                   	pop    %edi
+  803562:	5d                   	pop    %ebp
+  803563:	c3                   	ret
+
+00803564 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803564:	55                   	push   %ebp
+  803565:	89 e5                	mov    %esp,%ebp
+  803567:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80356a:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803571:	74 0a                	je     80357d <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803573:	8b 45 08             	mov    0x8(%ebp),%eax
+  803576:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80357b:	c9                   	leave
+  80357c:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  80357d:	83 ec 04             	sub    $0x4,%esp
+  803580:	6a 07                	push   $0x7
+  803582:	68 00 f0 bf ee       	push   $0xeebff000
+  803587:	6a 00                	push   $0x0
+  803589:	e8 2b cc ff ff       	call   8001b9 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80358e:	83 c4 08             	add    $0x8,%esp
+  803591:	68 1c 06 80 00       	push   $0x80061c
+  803596:	6a 00                	push   $0x0
+  803598:	e8 67 cd ff ff       	call   800304 <sys_env_set_pgfault_upcall>
+  80359d:	83 c4 10             	add    $0x10,%esp
+  8035a0:	eb d1                	jmp    803573 <set_pgfault_handler+0xf>
+
+008035a2 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035a2:	55                   	push   %ebp
+  8035a3:	89 e5                	mov    %esp,%ebp
+  8035a5:	56                   	push   %esi
+  8035a6:	53                   	push   %ebx
+  8035a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8035b0:	85 c0                	test   %eax,%eax
+  8035b2:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8035b7:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8035ba:	83 ec 0c             	sub    $0xc,%esp
+  8035bd:	50                   	push   %eax
+  8035be:	e8 a6 cd ff ff       	call   800369 <sys_ipc_recv>
+  8035c3:	83 c4 10             	add    $0x10,%esp
+  8035c6:	85 c0                	test   %eax,%eax
+  8035c8:	0f 88 8b 00 00 00    	js     803659 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8035ce:	85 f6                	test   %esi,%esi
+  8035d0:	74 2a                	je     8035fc <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8035d2:	89 e2                	mov    %esp,%edx
+  8035d4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035d9:	29 d0                	sub    %edx,%eax
+  8035db:	89 c2                	mov    %eax,%edx
+  8035dd:	c1 ea 0f             	shr    $0xf,%edx
+  8035e0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ea:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8035ed:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035f4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8035fa:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8035fc:	85 db                	test   %ebx,%ebx
+  8035fe:	74 2a                	je     80362a <ipc_recv+0x88>
+  803600:	89 e2                	mov    %esp,%edx
+  803602:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803607:	29 d0                	sub    %edx,%eax
+  803609:	89 c2                	mov    %eax,%edx
+  80360b:	c1 ea 0f             	shr    $0xf,%edx
+  80360e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803613:	b8 00 00 00 00       	mov    $0x0,%eax
+  803618:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80361b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803622:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803628:	89 03                	mov    %eax,(%ebx)
+  80362a:	89 e2                	mov    %esp,%edx
+  80362c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803631:	29 d0                	sub    %edx,%eax
+  803633:	89 c2                	mov    %eax,%edx
+  803635:	c1 ea 0f             	shr    $0xf,%edx
+  803638:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80363d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803642:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803645:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80364c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803652:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803655:	5b                   	pop    %ebx
+  803656:	5e                   	pop    %esi
+  803657:	5d                   	pop    %ebp
+  803658:	c3                   	ret
+		if(from_env_store != NULL)
+  803659:	85 f6                	test   %esi,%esi
+  80365b:	74 06                	je     803663 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80365d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803663:	85 db                	test   %ebx,%ebx
+  803665:	74 eb                	je     803652 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803667:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80366d:	eb e3                	jmp    803652 <ipc_recv+0xb0>
+
+0080366f <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80366f:	55                   	push   %ebp
+  803670:	89 e5                	mov    %esp,%ebp
+  803672:	57                   	push   %edi
+  803673:	56                   	push   %esi
+  803674:	53                   	push   %ebx
+  803675:	83 ec 14             	sub    $0x14,%esp
+  803678:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80367b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80367e:	8b 75 14             	mov    0x14(%ebp),%esi
+  803681:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803684:	85 c0                	test   %eax,%eax
+  803686:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80368b:	0f 44 c2             	cmove  %edx,%eax
+  80368e:	ff 75 10             	push   0x10(%ebp)
+  803691:	50                   	push   %eax
+  803692:	e8 34 cd ff ff       	call   8003cb <sys_ipc_recv_pages>
+  803697:	83 c4 10             	add    $0x10,%esp
+  80369a:	85 c0                	test   %eax,%eax
+  80369c:	0f 88 ba 00 00 00    	js     80375c <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8036a2:	85 ff                	test   %edi,%edi
+  8036a4:	74 2a                	je     8036d0 <ipc_recv_pages+0x61>
+  8036a6:	89 e2                	mov    %esp,%edx
+  8036a8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036ad:	29 d0                	sub    %edx,%eax
+  8036af:	89 c2                	mov    %eax,%edx
+  8036b1:	c1 ea 0f             	shr    $0xf,%edx
+  8036b4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036be:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8036c1:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036c8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8036ce:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8036d0:	85 f6                	test   %esi,%esi
+  8036d2:	74 2a                	je     8036fe <ipc_recv_pages+0x8f>
+  8036d4:	89 e2                	mov    %esp,%edx
+  8036d6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036db:	29 d0                	sub    %edx,%eax
+  8036dd:	89 c2                	mov    %eax,%edx
+  8036df:	c1 ea 0f             	shr    $0xf,%edx
+  8036e2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ec:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8036ef:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036f6:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8036fc:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8036fe:	85 db                	test   %ebx,%ebx
+  803700:	74 2a                	je     80372c <ipc_recv_pages+0xbd>
+  803702:	89 e2                	mov    %esp,%edx
+  803704:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803709:	29 d0                	sub    %edx,%eax
+  80370b:	89 c2                	mov    %eax,%edx
+  80370d:	c1 ea 0f             	shr    $0xf,%edx
+  803710:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371a:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80371d:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803724:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80372a:	89 03                	mov    %eax,(%ebx)
+  80372c:	89 e2                	mov    %esp,%edx
+  80372e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803733:	29 d0                	sub    %edx,%eax
+  803735:	89 c2                	mov    %eax,%edx
+  803737:	c1 ea 0f             	shr    $0xf,%edx
+  80373a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80373f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803744:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803747:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80374e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803757:	5b                   	pop    %ebx
+  803758:	5e                   	pop    %esi
+  803759:	5f                   	pop    %edi
+  80375a:	5d                   	pop    %ebp
+  80375b:	c3                   	ret
+		if (from_env_store)
+  80375c:	85 ff                	test   %edi,%edi
+  80375e:	74 06                	je     803766 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803760:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803766:	85 f6                	test   %esi,%esi
+  803768:	74 06                	je     803770 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80376a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803770:	85 db                	test   %ebx,%ebx
+  803772:	74 e0                	je     803754 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803774:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80377a:	eb d8                	jmp    803754 <ipc_recv_pages+0xe5>
+
+0080377c <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80377c:	55                   	push   %ebp
+  80377d:	89 e5                	mov    %esp,%ebp
+  80377f:	57                   	push   %edi
+  803780:	56                   	push   %esi
+  803781:	53                   	push   %ebx
+  803782:	83 ec 1c             	sub    $0x1c,%esp
+  803785:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803788:	8b 75 08             	mov    0x8(%ebp),%esi
+  80378b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803791:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803795:	75 2b                	jne    8037c2 <ipc_try_send_pages+0x46>
+  803797:	89 e2                	mov    %esp,%edx
+  803799:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80379e:	29 d0                	sub    %edx,%eax
+  8037a0:	89 c2                	mov    %eax,%edx
+  8037a2:	c1 ea 0f             	shr    $0xf,%edx
+  8037a5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037af:	0f 42 c2             	cmovb  %edx,%eax
+  8037b2:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8037b9:	8b 70 48             	mov    0x48(%eax),%esi
+  8037bc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037c2:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8037c8:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8037cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037d0:	85 ff                	test   %edi,%edi
+  8037d2:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8037d7:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8037da:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8037e0:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8037e6:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8037ec:	83 ec 0c             	sub    $0xc,%esp
+  8037ef:	ff 75 14             	push   0x14(%ebp)
+  8037f2:	ff 75 18             	push   0x18(%ebp)
+  8037f5:	57                   	push   %edi
+  8037f6:	ff 75 0c             	push   0xc(%ebp)
+  8037f9:	ff 75 08             	push   0x8(%ebp)
+  8037fc:	e8 a9 cb ff ff       	call   8003aa <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803801:	83 c4 20             	add    $0x20,%esp
+  803804:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803807:	75 21                	jne    80382a <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803809:	83 ec 04             	sub    $0x4,%esp
+  80380c:	6a ff                	push   $0xffffffff
+  80380e:	53                   	push   %ebx
+  80380f:	ff 75 e4             	push   -0x1c(%ebp)
+  803812:	e8 a0 cd ff ff       	call   8005b7 <sys_futex_wait>
+  803817:	83 c4 10             	add    $0x10,%esp
+  80381a:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80381d:	74 c7                	je     8037e6 <ipc_try_send_pages+0x6a>
+  80381f:	85 c0                	test   %eax,%eax
+  803821:	79 c3                	jns    8037e6 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803823:	e8 72 c9 ff ff       	call   80019a <sys_yield>
+  803828:	eb bc                	jmp    8037e6 <ipc_try_send_pages+0x6a>
+	}
+}
+  80382a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382d:	5b                   	pop    %ebx
+  80382e:	5e                   	pop    %esi
+  80382f:	5f                   	pop    %edi
+  803830:	5d                   	pop    %ebp
+  803831:	c3                   	ret
+
+00803832 <ipc_send>:
+{
+  803832:	55                   	push   %ebp
+  803833:	89 e5                	mov    %esp,%ebp
+  803835:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803838:	ff 75 14             	push   0x14(%ebp)
+  80383b:	6a 01                	push   $0x1
+  80383d:	ff 75 10             	push   0x10(%ebp)
+  803840:	ff 75 0c             	push   0xc(%ebp)
+  803843:	ff 75 08             	push   0x8(%ebp)
+  803846:	e8 31 ff ff ff       	call   80377c <ipc_try_send_pages>
+  80384b:	83 c4 20             	add    $0x20,%esp
+  80384e:	85 c0                	test   %eax,%eax
+  803850:	78 02                	js     803854 <ipc_send+0x22>
+}
+  803852:	c9                   	leave
+  803853:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803854:	50                   	push   %eax
+  803855:	68 ab 3f 80 00       	push   $0x803fab
+  80385a:	6a 3f                	push   $0x3f
+  80385c:	68 c0 3f 80 00       	push   $0x803fc0
+  803861:	e8 b4 f1 ff ff       	call   802a1a <_panic>
+
+00803866 <ipc_send_pages>:
+{
+  803866:	55                   	push   %ebp
+  803867:	89 e5                	mov    %esp,%ebp
+  803869:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80386c:	ff 75 18             	push   0x18(%ebp)
+  80386f:	ff 75 14             	push   0x14(%ebp)
+  803872:	ff 75 10             	push   0x10(%ebp)
+  803875:	ff 75 0c             	push   0xc(%ebp)
+  803878:	ff 75 08             	push   0x8(%ebp)
+  80387b:	e8 fc fe ff ff       	call   80377c <ipc_try_send_pages>
+  803880:	83 c4 20             	add    $0x20,%esp
+  803883:	85 c0                	test   %eax,%eax
+  803885:	78 02                	js     803889 <ipc_send_pages+0x23>
+}
+  803887:	c9                   	leave
+  803888:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803889:	50                   	push   %eax
+  80388a:	68 ca 3f 80 00       	push   $0x803fca
+  80388f:	6a 64                	push   $0x64
+  803891:	68 c0 3f 80 00       	push   $0x803fc0
+  803896:	e8 7f f1 ff ff       	call   802a1a <_panic>
+
+0080389b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80389b:	55                   	push   %ebp
+  80389c:	89 e5                	mov    %esp,%ebp
+  80389e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8038a1:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038a6:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8038ac:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038b2:	8b 52 50             	mov    0x50(%edx),%edx
+  8038b5:	39 ca                	cmp    %ecx,%edx
+  8038b7:	74 11                	je     8038ca <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038b9:	83 c0 01             	add    $0x1,%eax
+  8038bc:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038c1:	75 e3                	jne    8038a6 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c8:	eb 0e                	jmp    8038d8 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8038ca:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8038d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038d5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8038d8:	5d                   	pop    %ebp
+  8038d9:	c3                   	ret
+
+008038da <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8038da:	55                   	push   %ebp
+  8038db:	89 e5                	mov    %esp,%ebp
+  8038dd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8038e0:	89 c2                	mov    %eax,%edx
+  8038e2:	c1 ea 16             	shr    $0x16,%edx
+  8038e5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8038ec:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8038f1:	f6 c1 01             	test   $0x1,%cl
+  8038f4:	74 1e                	je     803914 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8038f6:	c1 e8 0c             	shr    $0xc,%eax
+  8038f9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803900:	a8 01                	test   $0x1,%al
+  803902:	74 10                	je     803914 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803904:	c1 e8 0c             	shr    $0xc,%eax
+  803907:	c1 e0 04             	shl    $0x4,%eax
+  80390a:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803911:	0f b7 d2             	movzwl %dx,%edx
+}
+  803914:	89 d0                	mov    %edx,%eax
+  803916:	5d                   	pop    %ebp
+  803917:	c3                   	ret
+
+00803918 <__udivdi3>:
+  803918:	57                   	push   %edi
+  803919:	56                   	push   %esi
+  80391a:	53                   	push   %ebx
+  80391b:	83 ec 20             	sub    $0x20,%esp
+  80391e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803922:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803926:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80392a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80392e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803932:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803936:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80393a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80393e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803943:	b8 00 00 00 00       	mov    $0x0,%eax
+  803948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80394d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803954:	00 
+  803955:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80395c:	00 
+  80395d:	eb 08                	jmp    803967 <__udivdi3+0x4f>
+  80395f:	83 e9 01             	sub    $0x1,%ecx
+  803962:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803965:	74 68                	je     8039cf <__udivdi3+0xb7>
+  803967:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80396b:	01 c0                	add    %eax,%eax
+  80396d:	89 c6                	mov    %eax,%esi
+  80396f:	89 d7                	mov    %edx,%edi
+  803971:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803975:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803979:	0f ad d0             	shrd   %cl,%edx,%eax
+  80397c:	d3 ea                	shr    %cl,%edx
+  80397e:	f6 c1 20             	test   $0x20,%cl
+  803981:	74 04                	je     803987 <__udivdi3+0x6f>
+  803983:	89 d0                	mov    %edx,%eax
+  803985:	31 d2                	xor    %edx,%edx
+  803987:	83 e0 01             	and    $0x1,%eax
+  80398a:	89 04 24             	mov    %eax,(%esp)
+  80398d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803994:	00 
+  803995:	8b 04 24             	mov    (%esp),%eax
+  803998:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80399c:	09 f0                	or     %esi,%eax
+  80399e:	09 fa                	or     %edi,%edx
+  8039a0:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039a4:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039a8:	39 f0                	cmp    %esi,%eax
+  8039aa:	89 d3                	mov    %edx,%ebx
+  8039ac:	19 fb                	sbb    %edi,%ebx
+  8039ae:	72 af                	jb     80395f <__udivdi3+0x47>
+  8039b0:	29 f0                	sub    %esi,%eax
+  8039b2:	19 fa                	sbb    %edi,%edx
+  8039b4:	89 cf                	mov    %ecx,%edi
+  8039b6:	c1 ef 05             	shr    $0x5,%edi
+  8039b9:	83 e7 01             	and    $0x1,%edi
+  8039bc:	89 fe                	mov    %edi,%esi
+  8039be:	83 f6 01             	xor    $0x1,%esi
+  8039c1:	d3 e6                	shl    %cl,%esi
+  8039c3:	d3 e7                	shl    %cl,%edi
+  8039c5:	09 74 24 18          	or     %esi,0x18(%esp)
+  8039c9:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8039cd:	eb 90                	jmp    80395f <__udivdi3+0x47>
+  8039cf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039d3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039d7:	83 c4 20             	add    $0x20,%esp
+  8039da:	5b                   	pop    %ebx
+  8039db:	5e                   	pop    %esi
+  8039dc:	5f                   	pop    %edi
+  8039dd:	c3                   	ret
+
+008039de <__umoddi3>:
+  8039de:	57                   	push   %edi
+  8039df:	56                   	push   %esi
+  8039e0:	53                   	push   %ebx
+  8039e1:	83 ec 08             	sub    $0x8,%esp
+  8039e4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039e8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039ec:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8039f0:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8039f4:	57                   	push   %edi
+  8039f5:	56                   	push   %esi
+  8039f6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039fa:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039fe:	52                   	push   %edx
+  8039ff:	50                   	push   %eax
+  803a00:	e8 13 ff ff ff       	call   803918 <__udivdi3>
+  803a05:	89 c3                	mov    %eax,%ebx
+  803a07:	0f af d6             	imul   %esi,%edx
+  803a0a:	89 f9                	mov    %edi,%ecx
+  803a0c:	0f af cb             	imul   %ebx,%ecx
+  803a0f:	01 d1                	add    %edx,%ecx
+  803a11:	89 d8                	mov    %ebx,%eax
+  803a13:	f7 e6                	mul    %esi
+  803a15:	89 c6                	mov    %eax,%esi
+  803a17:	89 d7                	mov    %edx,%edi
+  803a19:	01 cf                	add    %ecx,%edi
+  803a1b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a1f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a23:	29 f0                	sub    %esi,%eax
+  803a25:	19 fa                	sbb    %edi,%edx
+  803a27:	83 c4 18             	add    $0x18,%esp
+  803a2a:	5b                   	pop    %ebx
+  803a2b:	5e                   	pop    %esi
+  803a2c:	5f                   	pop    %edi
+  803a2d:	c3                   	ret
+
+00803a2e <__divdi3>:
+  803a2e:	53                   	push   %ebx
+  803a2f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a33:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a37:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a3b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a3f:	85 d2                	test   %edx,%edx
+  803a41:	78 12                	js     803a55 <__divdi3+0x27>
+  803a43:	85 db                	test   %ebx,%ebx
+  803a45:	78 2e                	js     803a75 <__divdi3+0x47>
+  803a47:	53                   	push   %ebx
+  803a48:	51                   	push   %ecx
+  803a49:	52                   	push   %edx
+  803a4a:	50                   	push   %eax
+  803a4b:	e8 c8 fe ff ff       	call   803918 <__udivdi3>
+  803a50:	83 c4 10             	add    $0x10,%esp
+  803a53:	eb 1e                	jmp    803a73 <__divdi3+0x45>
+  803a55:	f7 d8                	neg    %eax
+  803a57:	83 d2 00             	adc    $0x0,%edx
+  803a5a:	f7 da                	neg    %edx
+  803a5c:	85 db                	test   %ebx,%ebx
+  803a5e:	78 2a                	js     803a8a <__divdi3+0x5c>
+  803a60:	53                   	push   %ebx
+  803a61:	51                   	push   %ecx
+  803a62:	52                   	push   %edx
+  803a63:	50                   	push   %eax
+  803a64:	e8 af fe ff ff       	call   803918 <__udivdi3>
+  803a69:	83 c4 10             	add    $0x10,%esp
+  803a6c:	f7 d8                	neg    %eax
+  803a6e:	83 d2 00             	adc    $0x0,%edx
+  803a71:	f7 da                	neg    %edx
+  803a73:	5b                   	pop    %ebx
+  803a74:	c3                   	ret
+  803a75:	f7 d9                	neg    %ecx
+  803a77:	83 d3 00             	adc    $0x0,%ebx
+  803a7a:	f7 db                	neg    %ebx
+  803a7c:	53                   	push   %ebx
+  803a7d:	51                   	push   %ecx
+  803a7e:	52                   	push   %edx
+  803a7f:	50                   	push   %eax
+  803a80:	e8 93 fe ff ff       	call   803918 <__udivdi3>
+  803a85:	83 c4 10             	add    $0x10,%esp
+  803a88:	eb e2                	jmp    803a6c <__divdi3+0x3e>
+  803a8a:	f7 d9                	neg    %ecx
+  803a8c:	83 d3 00             	adc    $0x0,%ebx
+  803a8f:	f7 db                	neg    %ebx
+  803a91:	53                   	push   %ebx
+  803a92:	51                   	push   %ecx
+  803a93:	52                   	push   %edx
+  803a94:	50                   	push   %eax
+  803a95:	e8 7e fe ff ff       	call   803918 <__udivdi3>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+  803a9d:	eb d4                	jmp    803a73 <__divdi3+0x45>
+
+00803a9f <__moddi3>:
+  803a9f:	57                   	push   %edi
+  803aa0:	56                   	push   %esi
+  803aa1:	53                   	push   %ebx
+  803aa2:	83 ec 08             	sub    $0x8,%esp
+  803aa5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803aa9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803aad:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803ab1:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803ab5:	57                   	push   %edi
+  803ab6:	56                   	push   %esi
+  803ab7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803abb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803abf:	52                   	push   %edx
+  803ac0:	50                   	push   %eax
+  803ac1:	e8 68 ff ff ff       	call   803a2e <__divdi3>
+  803ac6:	89 c3                	mov    %eax,%ebx
+  803ac8:	0f af d6             	imul   %esi,%edx
+  803acb:	89 f9                	mov    %edi,%ecx
+  803acd:	0f af cb             	imul   %ebx,%ecx
+  803ad0:	01 d1                	add    %edx,%ecx
+  803ad2:	89 d8                	mov    %ebx,%eax
+  803ad4:	f7 e6                	mul    %esi
+  803ad6:	89 c6                	mov    %eax,%esi
+  803ad8:	89 d7                	mov    %edx,%edi
+  803ada:	01 cf                	add    %ecx,%edi
+  803adc:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803ae0:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803ae4:	29 f0                	sub    %esi,%eax
+  803ae6:	19 fa                	sbb    %edi,%edx
+  803ae8:	83 c4 18             	add    $0x18,%esp
+  803aeb:	5b                   	pop    %ebx
+  803aec:	5e                   	pop    %esi
+  803aed:	5f                   	pop    %edi
+  803aee:	c3                   	ret
@@ -0,0 +1,7861 @@
+
+obj/user/faultread.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1f 00 00 00       	call   800050 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0!\n", *(unsigned*)0);
+  80003b:	ff 35 00 00 00 00    	push   0x0
+  800041:	68 a0 3a 80 00       	push   $0x803aa0
+  800046:	e8 41 01 00 00       	call   80018c <cprintf>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	56                   	push   %esi
+  800054:	53                   	push   %ebx
+  800055:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800058:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80005b:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80005d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800062:	29 d0                	sub    %edx,%eax
+  800064:	89 c2                	mov    %eax,%edx
+  800066:	c1 ea 0f             	shr    $0xf,%edx
+  800069:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800076:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  80007d:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800081:	e8 f3 0b 00 00       	call   800c79 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800086:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80008b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800091:	89 e1                	mov    %esp,%ecx
+  800093:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800098:	29 ca                	sub    %ecx,%edx
+  80009a:	89 d1                	mov    %edx,%ecx
+  80009c:	c1 e9 0f             	shr    $0xf,%ecx
+  80009f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	0f 42 d1             	cmovb  %ecx,%edx
+  8000ad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b2:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000b9:	85 db                	test   %ebx,%ebx
+  8000bb:	7e 07                	jle    8000c4 <libmain+0x74>
+		binaryname = argv[0];
+  8000bd:	8b 06                	mov    (%esi),%eax
+  8000bf:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	56                   	push   %esi
+  8000c8:	53                   	push   %ebx
+  8000c9:	e8 67 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000ce:	e8 0a 00 00 00       	call   8000dd <exit>
+}
+  8000d3:	83 c4 10             	add    $0x10,%esp
+  8000d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d9:	5b                   	pop    %ebx
+  8000da:	5e                   	pop    %esi
+  8000db:	5d                   	pop    %ebp
+  8000dc:	c3                   	ret
+
+008000dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000dd:	55                   	push   %ebp
+  8000de:	89 e5                	mov    %esp,%ebp
+  8000e0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e3:	e8 1b 12 00 00       	call   801303 <close_all>
+	sys_env_destroy(0);
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	6a 00                	push   $0x0
+  8000ed:	e8 46 0b 00 00       	call   800c38 <sys_env_destroy>
+}
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	c9                   	leave
+  8000f6:	c3                   	ret
+
+008000f7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000f7:	55                   	push   %ebp
+  8000f8:	89 e5                	mov    %esp,%ebp
+  8000fa:	53                   	push   %ebx
+  8000fb:	83 ec 04             	sub    $0x4,%esp
+  8000fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800101:	8b 13                	mov    (%ebx),%edx
+  800103:	8d 42 01             	lea    0x1(%edx),%eax
+  800106:	89 03                	mov    %eax,(%ebx)
+  800108:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80010b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80010f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800114:	74 09                	je     80011f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800116:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80011a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80011d:	c9                   	leave
+  80011e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80011f:	83 ec 08             	sub    $0x8,%esp
+  800122:	68 ff 00 00 00       	push   $0xff
+  800127:	8d 43 08             	lea    0x8(%ebx),%eax
+  80012a:	50                   	push   %eax
+  80012b:	e8 cb 0a 00 00       	call   800bfb <sys_cputs>
+		b->idx = 0;
+  800130:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800136:	83 c4 10             	add    $0x10,%esp
+  800139:	eb db                	jmp    800116 <putch+0x1f>
+
+0080013b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80013b:	55                   	push   %ebp
+  80013c:	89 e5                	mov    %esp,%ebp
+  80013e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800144:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80014b:	00 00 00 
+	b.cnt = 0;
+  80014e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800155:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800158:	ff 75 0c             	push   0xc(%ebp)
+  80015b:	ff 75 08             	push   0x8(%ebp)
+  80015e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800164:	50                   	push   %eax
+  800165:	68 f7 00 80 00       	push   $0x8000f7
+  80016a:	e8 1c 01 00 00       	call   80028b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80016f:	83 c4 08             	add    $0x8,%esp
+  800172:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800178:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80017e:	50                   	push   %eax
+  80017f:	e8 77 0a 00 00       	call   800bfb <sys_cputs>
+
+	return b.cnt;
+}
+  800184:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+
+0080018c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800192:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800195:	50                   	push   %eax
+  800196:	ff 75 08             	push   0x8(%ebp)
+  800199:	e8 9d ff ff ff       	call   80013b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80019e:	c9                   	leave
+  80019f:	c3                   	ret
+
+008001a0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	57                   	push   %edi
+  8001a4:	56                   	push   %esi
+  8001a5:	53                   	push   %ebx
+  8001a6:	83 ec 1c             	sub    $0x1c,%esp
+  8001a9:	89 c3                	mov    %eax,%ebx
+  8001ab:	89 d6                	mov    %edx,%esi
+  8001ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b3:	89 d1                	mov    %edx,%ecx
+  8001b5:	89 c2                	mov    %eax,%edx
+  8001b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001ba:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001bd:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001ca:	39 c2                	cmp    %eax,%edx
+  8001cc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001cf:	73 4b                	jae    80021c <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8001d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8001d4:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8001d7:	85 ff                	test   %edi,%edi
+  8001d9:	7e 11                	jle    8001ec <printnum+0x4c>
+			putch(padc, putdat);
+  8001db:	83 ec 08             	sub    $0x8,%esp
+  8001de:	56                   	push   %esi
+  8001df:	ff 75 18             	push   0x18(%ebp)
+  8001e2:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8001e4:	83 c4 10             	add    $0x10,%esp
+  8001e7:	83 ef 01             	sub    $0x1,%edi
+  8001ea:	75 ef                	jne    8001db <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001ec:	83 ec 08             	sub    $0x8,%esp
+  8001ef:	56                   	push   %esi
+  8001f0:	83 ec 04             	sub    $0x4,%esp
+  8001f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f6:	ff 75 e0             	push   -0x20(%ebp)
+  8001f9:	ff 75 dc             	push   -0x24(%ebp)
+  8001fc:	ff 75 d8             	push   -0x28(%ebp)
+  8001ff:	e8 70 37 00 00       	call   803974 <__umoddi3>
+  800204:	83 c4 14             	add    $0x14,%esp
+  800207:	0f be 80 c8 3a 80 00 	movsbl 0x803ac8(%eax),%eax
+  80020e:	50                   	push   %eax
+  80020f:	ff d3                	call   *%ebx
+}
+  800211:	83 c4 10             	add    $0x10,%esp
+  800214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800217:	5b                   	pop    %ebx
+  800218:	5e                   	pop    %esi
+  800219:	5f                   	pop    %edi
+  80021a:	5d                   	pop    %ebp
+  80021b:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80021c:	83 ec 0c             	sub    $0xc,%esp
+  80021f:	ff 75 18             	push   0x18(%ebp)
+  800222:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800225:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800228:	52                   	push   %edx
+  800229:	50                   	push   %eax
+  80022a:	83 ec 08             	sub    $0x8,%esp
+  80022d:	ff 75 e4             	push   -0x1c(%ebp)
+  800230:	ff 75 e0             	push   -0x20(%ebp)
+  800233:	ff 75 dc             	push   -0x24(%ebp)
+  800236:	ff 75 d8             	push   -0x28(%ebp)
+  800239:	e8 70 36 00 00       	call   8038ae <__udivdi3>
+  80023e:	83 c4 18             	add    $0x18,%esp
+  800241:	52                   	push   %edx
+  800242:	50                   	push   %eax
+  800243:	89 f2                	mov    %esi,%edx
+  800245:	89 d8                	mov    %ebx,%eax
+  800247:	e8 54 ff ff ff       	call   8001a0 <printnum>
+  80024c:	83 c4 20             	add    $0x20,%esp
+  80024f:	eb 9b                	jmp    8001ec <printnum+0x4c>
+
+00800251 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800251:	55                   	push   %ebp
+  800252:	89 e5                	mov    %esp,%ebp
+  800254:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800257:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80025b:	8b 10                	mov    (%eax),%edx
+  80025d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800260:	73 0a                	jae    80026c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800262:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800265:	89 08                	mov    %ecx,(%eax)
+  800267:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026a:	88 02                	mov    %al,(%edx)
+}
+  80026c:	5d                   	pop    %ebp
+  80026d:	c3                   	ret
+
+0080026e <printfmt>:
+{
+  80026e:	55                   	push   %ebp
+  80026f:	89 e5                	mov    %esp,%ebp
+  800271:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800274:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800277:	50                   	push   %eax
+  800278:	ff 75 10             	push   0x10(%ebp)
+  80027b:	ff 75 0c             	push   0xc(%ebp)
+  80027e:	ff 75 08             	push   0x8(%ebp)
+  800281:	e8 05 00 00 00       	call   80028b <vprintfmt>
+}
+  800286:	83 c4 10             	add    $0x10,%esp
+  800289:	c9                   	leave
+  80028a:	c3                   	ret
+
+0080028b <vprintfmt>:
+{
+  80028b:	55                   	push   %ebp
+  80028c:	89 e5                	mov    %esp,%ebp
+  80028e:	57                   	push   %edi
+  80028f:	56                   	push   %esi
+  800290:	53                   	push   %ebx
+  800291:	83 ec 2c             	sub    $0x2c,%esp
+  800294:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800297:	89 df                	mov    %ebx,%edi
+  800299:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80029c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80029f:	8d 70 01             	lea    0x1(%eax),%esi
+  8002a2:	0f b6 00             	movzbl (%eax),%eax
+  8002a5:	83 f8 25             	cmp    $0x25,%eax
+  8002a8:	74 1e                	je     8002c8 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8002aa:	85 c0                	test   %eax,%eax
+  8002ac:	0f 84 15 05 00 00    	je     8007c7 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8002b2:	83 ec 08             	sub    $0x8,%esp
+  8002b5:	53                   	push   %ebx
+  8002b6:	50                   	push   %eax
+  8002b7:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002b9:	83 c6 01             	add    $0x1,%esi
+  8002bc:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002c0:	83 c4 10             	add    $0x10,%esp
+  8002c3:	83 f8 25             	cmp    $0x25,%eax
+  8002c6:	75 e2                	jne    8002aa <vprintfmt+0x1f>
+		padc = ' ';
+  8002c8:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8002cc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002d3:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8002da:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8002e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002e6:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002e9:	8d 56 01             	lea    0x1(%esi),%edx
+  8002ec:	0f b6 0e             	movzbl (%esi),%ecx
+  8002ef:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8002f2:	3c 55                	cmp    $0x55,%al
+  8002f4:	0f 87 3b 04 00 00    	ja     800735 <vprintfmt+0x4aa>
+  8002fa:	0f b6 c0             	movzbl %al,%eax
+  8002fd:	ff 24 85 40 3c 80 00 	jmp    *0x803c40(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800304:	89 75 10             	mov    %esi,0x10(%ebp)
+  800307:	eb 93                	jmp    80029c <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800309:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80030b:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80030f:	eb d8                	jmp    8002e9 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800311:	89 d6                	mov    %edx,%esi
+  800313:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800317:	eb d0                	jmp    8002e9 <vprintfmt+0x5e>
+  800319:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80031c:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80031f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800322:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800326:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800329:	83 f9 09             	cmp    $0x9,%ecx
+  80032c:	77 6f                	ja     80039d <vprintfmt+0x112>
+  80032e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800331:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800334:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800337:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80033b:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80033e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800341:	83 fe 09             	cmp    $0x9,%esi
+  800344:	76 eb                	jbe    800331 <vprintfmt+0xa6>
+  800346:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800349:	89 d6                	mov    %edx,%esi
+  80034b:	eb 13                	jmp    800360 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80034d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800350:	8b 00                	mov    (%eax),%eax
+  800352:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800355:	8b 45 14             	mov    0x14(%ebp),%eax
+  800358:	8d 40 04             	lea    0x4(%eax),%eax
+  80035b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80035e:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800360:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800364:	79 83                	jns    8002e9 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800366:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800369:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80036c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800373:	e9 71 ff ff ff       	jmp    8002e9 <vprintfmt+0x5e>
+			if (width < 0)
+  800378:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80037b:	85 c9                	test   %ecx,%ecx
+  80037d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800382:	0f 49 c1             	cmovns %ecx,%eax
+  800385:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800388:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80038a:	e9 5a ff ff ff       	jmp    8002e9 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038f:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800391:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800398:	e9 4c ff ff ff       	jmp    8002e9 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039d:	89 d6                	mov    %edx,%esi
+  80039f:	eb bf                	jmp    800360 <vprintfmt+0xd5>
+			lflag++;
+  8003a1:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a5:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003a7:	e9 3d ff ff ff       	jmp    8002e9 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8003ac:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b2:	8d 70 04             	lea    0x4(%eax),%esi
+  8003b5:	83 ec 08             	sub    $0x8,%esp
+  8003b8:	53                   	push   %ebx
+  8003b9:	ff 30                	push   (%eax)
+  8003bb:	ff d7                	call   *%edi
+			break;
+  8003bd:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c0:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8003c3:	e9 d4 fe ff ff       	jmp    80029c <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8003c8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ce:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8003d1:	8b 10                	mov    (%eax),%edx
+  8003d3:	89 d0                	mov    %edx,%eax
+  8003d5:	f7 d8                	neg    %eax
+  8003d7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003da:	83 f8 12             	cmp    $0x12,%eax
+  8003dd:	7f 23                	jg     800402 <vprintfmt+0x177>
+  8003df:	8b 14 85 a0 3d 80 00 	mov    0x803da0(,%eax,4),%edx
+  8003e6:	85 d2                	test   %edx,%edx
+  8003e8:	74 18                	je     800402 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8003ea:	52                   	push   %edx
+  8003eb:	68 fb 3e 80 00       	push   $0x803efb
+  8003f0:	53                   	push   %ebx
+  8003f1:	57                   	push   %edi
+  8003f2:	e8 77 fe ff ff       	call   80026e <printfmt>
+  8003f7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003fa:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003fd:	e9 9a fe ff ff       	jmp    80029c <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800402:	50                   	push   %eax
+  800403:	68 e0 3a 80 00       	push   $0x803ae0
+  800408:	53                   	push   %ebx
+  800409:	57                   	push   %edi
+  80040a:	e8 5f fe ff ff       	call   80026e <printfmt>
+  80040f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800412:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800415:	e9 82 fe ff ff       	jmp    80029c <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80041a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80041d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800420:	83 c0 04             	add    $0x4,%eax
+  800423:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800426:	8b 45 14             	mov    0x14(%ebp),%eax
+  800429:	8b 00                	mov    (%eax),%eax
+  80042b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80042e:	85 c0                	test   %eax,%eax
+  800430:	0f 84 61 03 00 00    	je     800797 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800436:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80043a:	7e 06                	jle    800442 <vprintfmt+0x1b7>
+  80043c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800440:	75 29                	jne    80046b <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800442:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800445:	8d 70 01             	lea    0x1(%eax),%esi
+  800448:	0f b6 00             	movzbl (%eax),%eax
+  80044b:	0f be d0             	movsbl %al,%edx
+  80044e:	85 d2                	test   %edx,%edx
+  800450:	0f 84 bb 00 00 00    	je     800511 <vprintfmt+0x286>
+  800456:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800459:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80045c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80045f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800462:	eb 7a                	jmp    8004de <vprintfmt+0x253>
+				p = "(null)";
+  800464:	c7 45 d0 d9 3a 80 00 	movl   $0x803ad9,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046b:	83 ec 08             	sub    $0x8,%esp
+  80046e:	ff 75 d4             	push   -0x2c(%ebp)
+  800471:	ff 75 d0             	push   -0x30(%ebp)
+  800474:	e8 e0 03 00 00       	call   800859 <strnlen>
+  800479:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80047c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80047f:	83 c4 10             	add    $0x10,%esp
+  800482:	85 d2                	test   %edx,%edx
+  800484:	0f 8e d6 02 00 00    	jle    800760 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80048a:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80048e:	83 ec 08             	sub    $0x8,%esp
+  800491:	53                   	push   %ebx
+  800492:	56                   	push   %esi
+  800493:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80049c:	75 f0                	jne    80048e <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80049e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004a1:	8d 70 01             	lea    0x1(%eax),%esi
+  8004a4:	0f b6 00             	movzbl (%eax),%eax
+  8004a7:	0f be d0             	movsbl %al,%edx
+  8004aa:	85 d2                	test   %edx,%edx
+  8004ac:	0f 84 da 02 00 00    	je     80078c <vprintfmt+0x501>
+  8004b2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004b5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004b8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004bb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004be:	eb 1e                	jmp    8004de <vprintfmt+0x253>
+					putch(ch, putdat);
+  8004c0:	83 ec 08             	sub    $0x8,%esp
+  8004c3:	ff 75 0c             	push   0xc(%ebp)
+  8004c6:	52                   	push   %edx
+  8004c7:	ff 55 08             	call   *0x8(%ebp)
+  8004ca:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004cd:	83 eb 01             	sub    $0x1,%ebx
+  8004d0:	83 c6 01             	add    $0x1,%esi
+  8004d3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004d7:	0f be d0             	movsbl %al,%edx
+  8004da:	85 d2                	test   %edx,%edx
+  8004dc:	74 2a                	je     800508 <vprintfmt+0x27d>
+  8004de:	85 ff                	test   %edi,%edi
+  8004e0:	78 05                	js     8004e7 <vprintfmt+0x25c>
+  8004e2:	83 ef 01             	sub    $0x1,%edi
+  8004e5:	78 59                	js     800540 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004e7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004eb:	74 d3                	je     8004c0 <vprintfmt+0x235>
+  8004ed:	0f be c0             	movsbl %al,%eax
+  8004f0:	83 e8 20             	sub    $0x20,%eax
+  8004f3:	83 f8 5e             	cmp    $0x5e,%eax
+  8004f6:	76 c8                	jbe    8004c0 <vprintfmt+0x235>
+					putch('?', putdat);
+  8004f8:	83 ec 08             	sub    $0x8,%esp
+  8004fb:	ff 75 0c             	push   0xc(%ebp)
+  8004fe:	6a 3f                	push   $0x3f
+  800500:	ff 55 08             	call   *0x8(%ebp)
+  800503:	83 c4 10             	add    $0x10,%esp
+  800506:	eb c5                	jmp    8004cd <vprintfmt+0x242>
+  800508:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80050b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80050e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800511:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800514:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800518:	7e 1b                	jle    800535 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80051a:	83 ec 08             	sub    $0x8,%esp
+  80051d:	53                   	push   %ebx
+  80051e:	6a 20                	push   $0x20
+  800520:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800522:	83 c4 10             	add    $0x10,%esp
+  800525:	83 ee 01             	sub    $0x1,%esi
+  800528:	75 f0                	jne    80051a <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80052a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80052d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800530:	e9 67 fd ff ff       	jmp    80029c <vprintfmt+0x11>
+  800535:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800538:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053b:	e9 5c fd ff ff       	jmp    80029c <vprintfmt+0x11>
+  800540:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800543:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800546:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800549:	eb c6                	jmp    800511 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80054b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80054e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800551:	83 f9 01             	cmp    $0x1,%ecx
+  800554:	7f 1f                	jg     800575 <vprintfmt+0x2ea>
+	else if (lflag)
+  800556:	85 c9                	test   %ecx,%ecx
+  800558:	74 67                	je     8005c1 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80055a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055d:	8b 30                	mov    (%eax),%esi
+  80055f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800562:	89 f0                	mov    %esi,%eax
+  800564:	c1 f8 1f             	sar    $0x1f,%eax
+  800567:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80056a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056d:	8d 40 04             	lea    0x4(%eax),%eax
+  800570:	89 45 14             	mov    %eax,0x14(%ebp)
+  800573:	eb 17                	jmp    80058c <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800575:	8b 45 14             	mov    0x14(%ebp),%eax
+  800578:	8b 50 04             	mov    0x4(%eax),%edx
+  80057b:	8b 00                	mov    (%eax),%eax
+  80057d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800580:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800583:	8b 45 14             	mov    0x14(%ebp),%eax
+  800586:	8d 40 08             	lea    0x8(%eax),%eax
+  800589:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80058c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80058f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800592:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800597:	85 c9                	test   %ecx,%ecx
+  800599:	0f 89 12 01 00 00    	jns    8006b1 <vprintfmt+0x426>
+				putch('-', putdat);
+  80059f:	83 ec 08             	sub    $0x8,%esp
+  8005a2:	53                   	push   %ebx
+  8005a3:	6a 2d                	push   $0x2d
+  8005a5:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8005a7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005aa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ad:	f7 da                	neg    %edx
+  8005af:	83 d1 00             	adc    $0x0,%ecx
+  8005b2:	f7 d9                	neg    %ecx
+  8005b4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005b7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005bc:	e9 f0 00 00 00       	jmp    8006b1 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8005c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c4:	8b 30                	mov    (%eax),%esi
+  8005c6:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005c9:	89 f0                	mov    %esi,%eax
+  8005cb:	c1 f8 1f             	sar    $0x1f,%eax
+  8005ce:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005da:	eb b0                	jmp    80058c <vprintfmt+0x301>
+	if (lflag >= 2)
+  8005dc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005df:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e2:	83 f9 01             	cmp    $0x1,%ecx
+  8005e5:	7f 1e                	jg     800605 <vprintfmt+0x37a>
+	else if (lflag)
+  8005e7:	85 c9                	test   %ecx,%ecx
+  8005e9:	74 32                	je     80061d <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 10                	mov    (%eax),%edx
+  8005f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005fb:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800600:	e9 ac 00 00 00       	jmp    8006b1 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800605:	8b 45 14             	mov    0x14(%ebp),%eax
+  800608:	8b 10                	mov    (%eax),%edx
+  80060a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80060d:	8d 40 08             	lea    0x8(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800613:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800618:	e9 94 00 00 00       	jmp    8006b1 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 10                	mov    (%eax),%edx
+  800622:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800627:	8d 40 04             	lea    0x4(%eax),%eax
+  80062a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062d:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800632:	eb 7d                	jmp    8006b1 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800634:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800637:	89 55 10             	mov    %edx,0x10(%ebp)
+  80063a:	83 f9 01             	cmp    $0x1,%ecx
+  80063d:	7f 1b                	jg     80065a <vprintfmt+0x3cf>
+	else if (lflag)
+  80063f:	85 c9                	test   %ecx,%ecx
+  800641:	74 2c                	je     80066f <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 10                	mov    (%eax),%edx
+  800648:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064d:	8d 40 04             	lea    0x4(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800653:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800658:	eb 57                	jmp    8006b1 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800662:	8d 40 08             	lea    0x8(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800668:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80066d:	eb 42                	jmp    8006b1 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067f:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800684:	eb 2b                	jmp    8006b1 <vprintfmt+0x426>
+			putch('0', putdat);
+  800686:	89 55 10             	mov    %edx,0x10(%ebp)
+  800689:	83 ec 08             	sub    $0x8,%esp
+  80068c:	53                   	push   %ebx
+  80068d:	6a 30                	push   $0x30
+  80068f:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800691:	83 c4 08             	add    $0x8,%esp
+  800694:	53                   	push   %ebx
+  800695:	6a 78                	push   $0x78
+  800697:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800699:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069c:	8b 10                	mov    (%eax),%edx
+  80069e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006a3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ac:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8006b1:	83 ec 0c             	sub    $0xc,%esp
+  8006b4:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006b8:	50                   	push   %eax
+  8006b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8006bc:	56                   	push   %esi
+  8006bd:	51                   	push   %ecx
+  8006be:	52                   	push   %edx
+  8006bf:	89 da                	mov    %ebx,%edx
+  8006c1:	89 f8                	mov    %edi,%eax
+  8006c3:	e8 d8 fa ff ff       	call   8001a0 <printnum>
+			break;
+  8006c8:	83 c4 20             	add    $0x20,%esp
+  8006cb:	e9 cc fb ff ff       	jmp    80029c <vprintfmt+0x11>
+	if (lflag >= 2)
+  8006d0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006d3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006d6:	83 f9 01             	cmp    $0x1,%ecx
+  8006d9:	7f 1b                	jg     8006f6 <vprintfmt+0x46b>
+	else if (lflag)
+  8006db:	85 c9                	test   %ecx,%ecx
+  8006dd:	74 2c                	je     80070b <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8b 10                	mov    (%eax),%edx
+  8006e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ef:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8006f4:	eb bb                	jmp    8006b1 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8b 10                	mov    (%eax),%edx
+  8006fb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006fe:	8d 40 08             	lea    0x8(%eax),%eax
+  800701:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800704:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800709:	eb a6                	jmp    8006b1 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 10                	mov    (%eax),%edx
+  800710:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800715:	8d 40 04             	lea    0x4(%eax),%eax
+  800718:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800720:	eb 8f                	jmp    8006b1 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800722:	89 55 10             	mov    %edx,0x10(%ebp)
+  800725:	83 ec 08             	sub    $0x8,%esp
+  800728:	53                   	push   %ebx
+  800729:	6a 25                	push   $0x25
+  80072b:	ff d7                	call   *%edi
+			break;
+  80072d:	83 c4 10             	add    $0x10,%esp
+  800730:	e9 67 fb ff ff       	jmp    80029c <vprintfmt+0x11>
+			putch('%', putdat);
+  800735:	83 ec 08             	sub    $0x8,%esp
+  800738:	53                   	push   %ebx
+  800739:	6a 25                	push   $0x25
+  80073b:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80073d:	83 c4 10             	add    $0x10,%esp
+  800740:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800744:	0f 84 ba fb ff ff    	je     800304 <vprintfmt+0x79>
+  80074a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80074d:	89 f0                	mov    %esi,%eax
+  80074f:	83 e8 01             	sub    $0x1,%eax
+  800752:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800756:	75 f7                	jne    80074f <vprintfmt+0x4c4>
+  800758:	89 45 10             	mov    %eax,0x10(%ebp)
+  80075b:	e9 3c fb ff ff       	jmp    80029c <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800760:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800763:	8d 70 01             	lea    0x1(%eax),%esi
+  800766:	0f b6 00             	movzbl (%eax),%eax
+  800769:	0f be d0             	movsbl %al,%edx
+  80076c:	85 d2                	test   %edx,%edx
+  80076e:	74 11                	je     800781 <vprintfmt+0x4f6>
+  800770:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800773:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800776:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800779:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80077c:	e9 5d fd ff ff       	jmp    8004de <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800781:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+  800787:	e9 10 fb ff ff       	jmp    80029c <vprintfmt+0x11>
+  80078c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80078f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800792:	e9 05 fb ff ff       	jmp    80029c <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800797:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80079b:	7e 0a                	jle    8007a7 <vprintfmt+0x51c>
+  80079d:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007a1:	0f 85 bd fc ff ff    	jne    800464 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007a7:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007ac:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007b1:	be da 3a 80 00       	mov    $0x803ada,%esi
+  8007b6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007b9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007bc:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007bf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c2:	e9 17 fd ff ff       	jmp    8004de <vprintfmt+0x253>
+}
+  8007c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ca:	5b                   	pop    %ebx
+  8007cb:	5e                   	pop    %esi
+  8007cc:	5f                   	pop    %edi
+  8007cd:	5d                   	pop    %ebp
+  8007ce:	c3                   	ret
+
+008007cf <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	83 ec 18             	sub    $0x18,%esp
+  8007d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007de:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007e2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007ec:	85 c0                	test   %eax,%eax
+  8007ee:	74 26                	je     800816 <vsnprintf+0x47>
+  8007f0:	85 d2                	test   %edx,%edx
+  8007f2:	7e 22                	jle    800816 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007f4:	ff 75 14             	push   0x14(%ebp)
+  8007f7:	ff 75 10             	push   0x10(%ebp)
+  8007fa:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	68 51 02 80 00       	push   $0x800251
+  800803:	e8 83 fa ff ff       	call   80028b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800808:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80080b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80080e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800811:	83 c4 10             	add    $0x10,%esp
+}
+  800814:	c9                   	leave
+  800815:	c3                   	ret
+		return -E_INVAL;
+  800816:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80081b:	eb f7                	jmp    800814 <vsnprintf+0x45>
+
+0080081d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800823:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800826:	50                   	push   %eax
+  800827:	ff 75 10             	push   0x10(%ebp)
+  80082a:	ff 75 0c             	push   0xc(%ebp)
+  80082d:	ff 75 08             	push   0x8(%ebp)
+  800830:	e8 9a ff ff ff       	call   8007cf <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800835:	c9                   	leave
+  800836:	c3                   	ret
+
+00800837 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800837:	55                   	push   %ebp
+  800838:	89 e5                	mov    %esp,%ebp
+  80083a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80083d:	80 3a 00             	cmpb   $0x0,(%edx)
+  800840:	74 10                	je     800852 <strlen+0x1b>
+  800842:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800847:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80084a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80084e:	75 f7                	jne    800847 <strlen+0x10>
+	return n;
+}
+  800850:	5d                   	pop    %ebp
+  800851:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800852:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800857:	eb f7                	jmp    800850 <strlen+0x19>
+
+00800859 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800862:	85 d2                	test   %edx,%edx
+  800864:	74 16                	je     80087c <strnlen+0x23>
+  800866:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80086f:	74 09                	je     80087a <strnlen+0x21>
+		n++;
+  800871:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800874:	39 d0                	cmp    %edx,%eax
+  800876:	75 f3                	jne    80086b <strnlen+0x12>
+		n++;
+  800878:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80087a:	5d                   	pop    %ebp
+  80087b:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800881:	eb f7                	jmp    80087a <strnlen+0x21>
+
+00800883 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800883:	55                   	push   %ebp
+  800884:	89 e5                	mov    %esp,%ebp
+  800886:	53                   	push   %ebx
+  800887:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80088d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800892:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800896:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800899:	83 c0 01             	add    $0x1,%eax
+  80089c:	84 d2                	test   %dl,%dl
+  80089e:	75 f2                	jne    800892 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008a0:	89 c8                	mov    %ecx,%eax
+  8008a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a5:	c9                   	leave
+  8008a6:	c3                   	ret
+
+008008a7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	53                   	push   %ebx
+  8008ab:	83 ec 10             	sub    $0x10,%esp
+  8008ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b1:	53                   	push   %ebx
+  8008b2:	e8 80 ff ff ff       	call   800837 <strlen>
+  8008b7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008ba:	ff 75 0c             	push   0xc(%ebp)
+  8008bd:	01 d8                	add    %ebx,%eax
+  8008bf:	50                   	push   %eax
+  8008c0:	e8 be ff ff ff       	call   800883 <strcpy>
+	return dst;
+}
+  8008c5:	89 d8                	mov    %ebx,%eax
+  8008c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ca:	c9                   	leave
+  8008cb:	c3                   	ret
+
+008008cc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	56                   	push   %esi
+  8008d0:	53                   	push   %ebx
+  8008d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008da:	85 db                	test   %ebx,%ebx
+  8008dc:	74 17                	je     8008f5 <strncpy+0x29>
+  8008de:	01 f3                	add    %esi,%ebx
+  8008e0:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8008e2:	83 c0 01             	add    $0x1,%eax
+  8008e5:	0f b6 0a             	movzbl (%edx),%ecx
+  8008e8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008eb:	80 f9 01             	cmp    $0x1,%cl
+  8008ee:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f1:	39 c3                	cmp    %eax,%ebx
+  8008f3:	75 ed                	jne    8008e2 <strncpy+0x16>
+	}
+	return ret;
+}
+  8008f5:	89 f0                	mov    %esi,%eax
+  8008f7:	5b                   	pop    %ebx
+  8008f8:	5e                   	pop    %esi
+  8008f9:	5d                   	pop    %ebp
+  8008fa:	c3                   	ret
+
+008008fb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	56                   	push   %esi
+  8008ff:	53                   	push   %ebx
+  800900:	8b 75 08             	mov    0x8(%ebp),%esi
+  800903:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800906:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800909:	89 f0                	mov    %esi,%eax
+  80090b:	85 db                	test   %ebx,%ebx
+  80090d:	74 1e                	je     80092d <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  80090f:	83 eb 01             	sub    $0x1,%ebx
+  800912:	74 16                	je     80092a <strlcpy+0x2f>
+  800914:	01 f3                	add    %esi,%ebx
+  800916:	0f b6 0a             	movzbl (%edx),%ecx
+  800919:	84 c9                	test   %cl,%cl
+  80091b:	74 0d                	je     80092a <strlcpy+0x2f>
+			*dst++ = *src++;
+  80091d:	83 c2 01             	add    $0x1,%edx
+  800920:	83 c0 01             	add    $0x1,%eax
+  800923:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800926:	39 d8                	cmp    %ebx,%eax
+  800928:	75 ec                	jne    800916 <strlcpy+0x1b>
+		*dst = '\0';
+  80092a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80092d:	29 f0                	sub    %esi,%eax
+}
+  80092f:	5b                   	pop    %ebx
+  800930:	5e                   	pop    %esi
+  800931:	5d                   	pop    %ebp
+  800932:	c3                   	ret
+
+00800933 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800939:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80093c:	0f b6 01             	movzbl (%ecx),%eax
+  80093f:	84 c0                	test   %al,%al
+  800941:	74 11                	je     800954 <strcmp+0x21>
+  800943:	38 02                	cmp    %al,(%edx)
+  800945:	75 0d                	jne    800954 <strcmp+0x21>
+		p++, q++;
+  800947:	83 c1 01             	add    $0x1,%ecx
+  80094a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80094d:	0f b6 01             	movzbl (%ecx),%eax
+  800950:	84 c0                	test   %al,%al
+  800952:	75 ef                	jne    800943 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800954:	0f b6 c0             	movzbl %al,%eax
+  800957:	0f b6 12             	movzbl (%edx),%edx
+  80095a:	29 d0                	sub    %edx,%eax
+}
+  80095c:	5d                   	pop    %ebp
+  80095d:	c3                   	ret
+
+0080095e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	53                   	push   %ebx
+  800962:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800965:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800968:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  80096b:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800970:	85 d2                	test   %edx,%edx
+  800972:	74 2e                	je     8009a2 <strncmp+0x44>
+  800974:	0f b6 01             	movzbl (%ecx),%eax
+  800977:	84 c0                	test   %al,%al
+  800979:	74 16                	je     800991 <strncmp+0x33>
+  80097b:	3a 03                	cmp    (%ebx),%al
+  80097d:	75 12                	jne    800991 <strncmp+0x33>
+		n--, p++, q++;
+  80097f:	83 c1 01             	add    $0x1,%ecx
+  800982:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800985:	83 ea 01             	sub    $0x1,%edx
+  800988:	75 ea                	jne    800974 <strncmp+0x16>
+		return 0;
+  80098a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098f:	eb 11                	jmp    8009a2 <strncmp+0x44>
+  800991:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800996:	85 d2                	test   %edx,%edx
+  800998:	74 08                	je     8009a2 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80099a:	0f b6 01             	movzbl (%ecx),%eax
+  80099d:	0f b6 13             	movzbl (%ebx),%edx
+  8009a0:	29 d0                	sub    %edx,%eax
+}
+  8009a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a5:	c9                   	leave
+  8009a6:	c3                   	ret
+
+008009a7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009b1:	0f b6 10             	movzbl (%eax),%edx
+  8009b4:	84 d2                	test   %dl,%dl
+  8009b6:	74 15                	je     8009cd <strchr+0x26>
+		if (*s == c)
+  8009b8:	38 d1                	cmp    %dl,%cl
+  8009ba:	74 0f                	je     8009cb <strchr+0x24>
+	for (; *s; s++)
+  8009bc:	83 c0 01             	add    $0x1,%eax
+  8009bf:	0f b6 10             	movzbl (%eax),%edx
+  8009c2:	84 d2                	test   %dl,%dl
+  8009c4:	75 f2                	jne    8009b8 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8009c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009cb:	5d                   	pop    %ebp
+  8009cc:	c3                   	ret
+	return 0;
+  8009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d2:	eb f7                	jmp    8009cb <strchr+0x24>
+
+008009d4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	53                   	push   %ebx
+  8009d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009db:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  8009de:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  8009e1:	38 d3                	cmp    %dl,%bl
+  8009e3:	74 14                	je     8009f9 <strfind+0x25>
+  8009e5:	89 d1                	mov    %edx,%ecx
+  8009e7:	84 db                	test   %bl,%bl
+  8009e9:	74 0e                	je     8009f9 <strfind+0x25>
+	for (; *s; s++)
+  8009eb:	83 c0 01             	add    $0x1,%eax
+  8009ee:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009f1:	38 ca                	cmp    %cl,%dl
+  8009f3:	74 04                	je     8009f9 <strfind+0x25>
+  8009f5:	84 d2                	test   %dl,%dl
+  8009f7:	75 f2                	jne    8009eb <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  8009f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fc:	c9                   	leave
+  8009fd:	c3                   	ret
+
+008009fe <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	57                   	push   %edi
+  800a02:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a05:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a08:	85 c9                	test   %ecx,%ecx
+  800a0a:	74 20                	je     800a2c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a0c:	89 f8                	mov    %edi,%eax
+  800a0e:	09 c8                	or     %ecx,%eax
+  800a10:	a8 03                	test   $0x3,%al
+  800a12:	75 12                	jne    800a26 <memset+0x28>
+		c &= 0xFF;
+  800a14:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a18:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a1e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a21:	fc                   	cld
+  800a22:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a24:	eb 06                	jmp    800a2c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a29:	fc                   	cld
+  800a2a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a2c:	89 f8                	mov    %edi,%eax
+  800a2e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a31:	c9                   	leave
+  800a32:	c3                   	ret
+
+00800a33 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	57                   	push   %edi
+  800a37:	56                   	push   %esi
+  800a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a3e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a41:	39 c6                	cmp    %eax,%esi
+  800a43:	73 32                	jae    800a77 <memmove+0x44>
+  800a45:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a48:	39 d0                	cmp    %edx,%eax
+  800a4a:	73 2b                	jae    800a77 <memmove+0x44>
+		s += n;
+		d += n;
+  800a4c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a4f:	89 d6                	mov    %edx,%esi
+  800a51:	09 fe                	or     %edi,%esi
+  800a53:	09 ce                	or     %ecx,%esi
+  800a55:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a5b:	75 0e                	jne    800a6b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a5d:	83 ef 04             	sub    $0x4,%edi
+  800a60:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a63:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a66:	fd                   	std
+  800a67:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a69:	eb 09                	jmp    800a74 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a6b:	83 ef 01             	sub    $0x1,%edi
+  800a6e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a71:	fd                   	std
+  800a72:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a74:	fc                   	cld
+  800a75:	eb 1a                	jmp    800a91 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a77:	89 f2                	mov    %esi,%edx
+  800a79:	09 c2                	or     %eax,%edx
+  800a7b:	09 ca                	or     %ecx,%edx
+  800a7d:	f6 c2 03             	test   $0x3,%dl
+  800a80:	75 0a                	jne    800a8c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a82:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a85:	89 c7                	mov    %eax,%edi
+  800a87:	fc                   	cld
+  800a88:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8a:	eb 05                	jmp    800a91 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a8c:	89 c7                	mov    %eax,%edi
+  800a8e:	fc                   	cld
+  800a8f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a91:	5e                   	pop    %esi
+  800a92:	5f                   	pop    %edi
+  800a93:	5d                   	pop    %ebp
+  800a94:	c3                   	ret
+
+00800a95 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800a95:	55                   	push   %ebp
+  800a96:	89 e5                	mov    %esp,%ebp
+  800a98:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a9b:	ff 75 10             	push   0x10(%ebp)
+  800a9e:	ff 75 0c             	push   0xc(%ebp)
+  800aa1:	ff 75 08             	push   0x8(%ebp)
+  800aa4:	e8 8a ff ff ff       	call   800a33 <memmove>
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+00800aab <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	56                   	push   %esi
+  800aaf:	53                   	push   %ebx
+  800ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab6:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ab9:	85 f6                	test   %esi,%esi
+  800abb:	74 29                	je     800ae6 <memcmp+0x3b>
+  800abd:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800abf:	0f b6 08             	movzbl (%eax),%ecx
+  800ac2:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac5:	38 d9                	cmp    %bl,%cl
+  800ac7:	75 11                	jne    800ada <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ac9:	83 c0 01             	add    $0x1,%eax
+  800acc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800acf:	39 c6                	cmp    %eax,%esi
+  800ad1:	75 ec                	jne    800abf <memcmp+0x14>
+	}
+
+	return 0;
+  800ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad8:	eb 08                	jmp    800ae2 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ada:	0f b6 c1             	movzbl %cl,%eax
+  800add:	0f b6 db             	movzbl %bl,%ebx
+  800ae0:	29 d8                	sub    %ebx,%eax
+}
+  800ae2:	5b                   	pop    %ebx
+  800ae3:	5e                   	pop    %esi
+  800ae4:	5d                   	pop    %ebp
+  800ae5:	c3                   	ret
+	return 0;
+  800ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aeb:	eb f5                	jmp    800ae2 <memcmp+0x37>
+
+00800aed <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800af6:	89 c2                	mov    %eax,%edx
+  800af8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800afb:	39 d0                	cmp    %edx,%eax
+  800afd:	73 0d                	jae    800b0c <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aff:	38 08                	cmp    %cl,(%eax)
+  800b01:	74 0d                	je     800b10 <memfind+0x23>
+	for (; s < ends; s++)
+  800b03:	83 c0 01             	add    $0x1,%eax
+  800b06:	39 c2                	cmp    %eax,%edx
+  800b08:	75 f5                	jne    800aff <memfind+0x12>
+  800b0a:	eb 06                	jmp    800b12 <memfind+0x25>
+  800b0c:	89 c2                	mov    %eax,%edx
+  800b0e:	eb 02                	jmp    800b12 <memfind+0x25>
+  800b10:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800b12:	89 d0                	mov    %edx,%eax
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+
+00800b16 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	57                   	push   %edi
+  800b1a:	56                   	push   %esi
+  800b1b:	53                   	push   %ebx
+  800b1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b22:	0f b6 02             	movzbl (%edx),%eax
+  800b25:	3c 20                	cmp    $0x20,%al
+  800b27:	74 04                	je     800b2d <strtol+0x17>
+  800b29:	3c 09                	cmp    $0x9,%al
+  800b2b:	75 0e                	jne    800b3b <strtol+0x25>
+		s++;
+  800b2d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b30:	0f b6 02             	movzbl (%edx),%eax
+  800b33:	3c 20                	cmp    $0x20,%al
+  800b35:	74 f6                	je     800b2d <strtol+0x17>
+  800b37:	3c 09                	cmp    $0x9,%al
+  800b39:	74 f2                	je     800b2d <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b3b:	3c 2b                	cmp    $0x2b,%al
+  800b3d:	74 2a                	je     800b69 <strtol+0x53>
+	int neg = 0;
+  800b3f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b44:	3c 2d                	cmp    $0x2d,%al
+  800b46:	74 2b                	je     800b73 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b48:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b4e:	75 0f                	jne    800b5f <strtol+0x49>
+  800b50:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b53:	74 28                	je     800b7d <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b55:	85 db                	test   %ebx,%ebx
+  800b57:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b5c:	0f 44 d8             	cmove  %eax,%ebx
+  800b5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b64:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b67:	eb 46                	jmp    800baf <strtol+0x99>
+		s++;
+  800b69:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b71:	eb d5                	jmp    800b48 <strtol+0x32>
+		s++, neg = 1;
+  800b73:	83 c2 01             	add    $0x1,%edx
+  800b76:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b7b:	eb cb                	jmp    800b48 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b81:	74 0e                	je     800b91 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800b83:	85 db                	test   %ebx,%ebx
+  800b85:	75 d8                	jne    800b5f <strtol+0x49>
+		s++, base = 8;
+  800b87:	83 c2 01             	add    $0x1,%edx
+  800b8a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b8f:	eb ce                	jmp    800b5f <strtol+0x49>
+		s += 2, base = 16;
+  800b91:	83 c2 02             	add    $0x2,%edx
+  800b94:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b99:	eb c4                	jmp    800b5f <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b9b:	0f be c0             	movsbl %al,%eax
+  800b9e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ba1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ba4:	7d 3a                	jge    800be0 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800ba6:	83 c2 01             	add    $0x1,%edx
+  800ba9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bad:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800baf:	0f b6 02             	movzbl (%edx),%eax
+  800bb2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bb5:	89 f3                	mov    %esi,%ebx
+  800bb7:	80 fb 09             	cmp    $0x9,%bl
+  800bba:	76 df                	jbe    800b9b <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800bbc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bbf:	89 f3                	mov    %esi,%ebx
+  800bc1:	80 fb 19             	cmp    $0x19,%bl
+  800bc4:	77 08                	ja     800bce <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800bc6:	0f be c0             	movsbl %al,%eax
+  800bc9:	83 e8 57             	sub    $0x57,%eax
+  800bcc:	eb d3                	jmp    800ba1 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bce:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bd1:	89 f3                	mov    %esi,%ebx
+  800bd3:	80 fb 19             	cmp    $0x19,%bl
+  800bd6:	77 08                	ja     800be0 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800bd8:	0f be c0             	movsbl %al,%eax
+  800bdb:	83 e8 37             	sub    $0x37,%eax
+  800bde:	eb c1                	jmp    800ba1 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800be0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800be4:	74 05                	je     800beb <strtol+0xd5>
+		*endptr = (char *) s;
+  800be6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800beb:	89 c8                	mov    %ecx,%eax
+  800bed:	f7 d8                	neg    %eax
+  800bef:	85 ff                	test   %edi,%edi
+  800bf1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bf4:	89 c8                	mov    %ecx,%eax
+  800bf6:	5b                   	pop    %ebx
+  800bf7:	5e                   	pop    %esi
+  800bf8:	5f                   	pop    %edi
+  800bf9:	5d                   	pop    %ebp
+  800bfa:	c3                   	ret
+
+00800bfb <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bfb:	55                   	push   %ebp
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	57                   	push   %edi
+  800bff:	56                   	push   %esi
+  800c00:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0c:	89 c3                	mov    %eax,%ebx
+  800c0e:	89 c7                	mov    %eax,%edi
+  800c10:	89 c6                	mov    %eax,%esi
+  800c12:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c14:	5b                   	pop    %ebx
+  800c15:	5e                   	pop    %esi
+  800c16:	5f                   	pop    %edi
+  800c17:	5d                   	pop    %ebp
+  800c18:	c3                   	ret
+
+00800c19 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c19:	55                   	push   %ebp
+  800c1a:	89 e5                	mov    %esp,%ebp
+  800c1c:	57                   	push   %edi
+  800c1d:	56                   	push   %esi
+  800c1e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c24:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c29:	89 d1                	mov    %edx,%ecx
+  800c2b:	89 d3                	mov    %edx,%ebx
+  800c2d:	89 d7                	mov    %edx,%edi
+  800c2f:	89 d6                	mov    %edx,%esi
+  800c31:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c33:	5b                   	pop    %ebx
+  800c34:	5e                   	pop    %esi
+  800c35:	5f                   	pop    %edi
+  800c36:	5d                   	pop    %ebp
+  800c37:	c3                   	ret
+
+00800c38 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	57                   	push   %edi
+  800c3c:	56                   	push   %esi
+  800c3d:	53                   	push   %ebx
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c49:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c4e:	89 cb                	mov    %ecx,%ebx
+  800c50:	89 cf                	mov    %ecx,%edi
+  800c52:	89 ce                	mov    %ecx,%esi
+  800c54:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c56:	85 c0                	test   %eax,%eax
+  800c58:	7f 08                	jg     800c62 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5d:	5b                   	pop    %ebx
+  800c5e:	5e                   	pop    %esi
+  800c5f:	5f                   	pop    %edi
+  800c60:	5d                   	pop    %ebp
+  800c61:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c62:	83 ec 0c             	sub    $0xc,%esp
+  800c65:	50                   	push   %eax
+  800c66:	6a 03                	push   $0x3
+  800c68:	68 0b 3e 80 00       	push   $0x803e0b
+  800c6d:	6a 23                	push   $0x23
+  800c6f:	68 28 3e 80 00       	push   $0x803e28
+  800c74:	e8 79 28 00 00       	call   8034f2 <_panic>
+
+00800c79 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	57                   	push   %edi
+  800c7d:	56                   	push   %esi
+  800c7e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c84:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c89:	89 d1                	mov    %edx,%ecx
+  800c8b:	89 d3                	mov    %edx,%ebx
+  800c8d:	89 d7                	mov    %edx,%edi
+  800c8f:	89 d6                	mov    %edx,%esi
+  800c91:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5f                   	pop    %edi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+
+00800c98 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c98:	55                   	push   %ebp
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	57                   	push   %edi
+  800c9c:	56                   	push   %esi
+  800c9d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca8:	89 d1                	mov    %edx,%ecx
+  800caa:	89 d3                	mov    %edx,%ebx
+  800cac:	89 d7                	mov    %edx,%edi
+  800cae:	89 d6                	mov    %edx,%esi
+  800cb0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cb2:	5b                   	pop    %ebx
+  800cb3:	5e                   	pop    %esi
+  800cb4:	5f                   	pop    %edi
+  800cb5:	5d                   	pop    %ebp
+  800cb6:	c3                   	ret
+
+00800cb7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	57                   	push   %edi
+  800cbb:	56                   	push   %esi
+  800cbc:	53                   	push   %ebx
+  800cbd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cc0:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccb:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd3:	89 f7                	mov    %esi,%edi
+  800cd5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd7:	85 c0                	test   %eax,%eax
+  800cd9:	7f 08                	jg     800ce3 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cde:	5b                   	pop    %ebx
+  800cdf:	5e                   	pop    %esi
+  800ce0:	5f                   	pop    %edi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce3:	83 ec 0c             	sub    $0xc,%esp
+  800ce6:	50                   	push   %eax
+  800ce7:	6a 04                	push   $0x4
+  800ce9:	68 0b 3e 80 00       	push   $0x803e0b
+  800cee:	6a 23                	push   $0x23
+  800cf0:	68 28 3e 80 00       	push   $0x803e28
+  800cf5:	e8 f8 27 00 00       	call   8034f2 <_panic>
+
+00800cfa <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	57                   	push   %edi
+  800cfe:	56                   	push   %esi
+  800cff:	53                   	push   %ebx
+  800d00:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d09:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d11:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d14:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d17:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d19:	85 c0                	test   %eax,%eax
+  800d1b:	7f 08                	jg     800d25 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+  800d28:	50                   	push   %eax
+  800d29:	6a 05                	push   $0x5
+  800d2b:	68 0b 3e 80 00       	push   $0x803e0b
+  800d30:	6a 23                	push   $0x23
+  800d32:	68 28 3e 80 00       	push   $0x803e28
+  800d37:	e8 b6 27 00 00       	call   8034f2 <_panic>
+
+00800d3c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d50:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d55:	89 df                	mov    %ebx,%edi
+  800d57:	89 de                	mov    %ebx,%esi
+  800d59:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d5b:	85 c0                	test   %eax,%eax
+  800d5d:	7f 08                	jg     800d67 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d62:	5b                   	pop    %ebx
+  800d63:	5e                   	pop    %esi
+  800d64:	5f                   	pop    %edi
+  800d65:	5d                   	pop    %ebp
+  800d66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d67:	83 ec 0c             	sub    $0xc,%esp
+  800d6a:	50                   	push   %eax
+  800d6b:	6a 06                	push   $0x6
+  800d6d:	68 0b 3e 80 00       	push   $0x803e0b
+  800d72:	6a 23                	push   $0x23
+  800d74:	68 28 3e 80 00       	push   $0x803e28
+  800d79:	e8 74 27 00 00       	call   8034f2 <_panic>
+
+00800d7e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d92:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d97:	89 df                	mov    %ebx,%edi
+  800d99:	89 de                	mov    %ebx,%esi
+  800d9b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d9d:	85 c0                	test   %eax,%eax
+  800d9f:	7f 08                	jg     800da9 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800da1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da4:	5b                   	pop    %ebx
+  800da5:	5e                   	pop    %esi
+  800da6:	5f                   	pop    %edi
+  800da7:	5d                   	pop    %ebp
+  800da8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da9:	83 ec 0c             	sub    $0xc,%esp
+  800dac:	50                   	push   %eax
+  800dad:	6a 08                	push   $0x8
+  800daf:	68 0b 3e 80 00       	push   $0x803e0b
+  800db4:	6a 23                	push   $0x23
+  800db6:	68 28 3e 80 00       	push   $0x803e28
+  800dbb:	e8 32 27 00 00       	call   8034f2 <_panic>
+
+00800dc0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dc0:	55                   	push   %ebp
+  800dc1:	89 e5                	mov    %esp,%ebp
+  800dc3:	57                   	push   %edi
+  800dc4:	56                   	push   %esi
+  800dc5:	53                   	push   %ebx
+  800dc6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dd9:	89 df                	mov    %ebx,%edi
+  800ddb:	89 de                	mov    %ebx,%esi
+  800ddd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddf:	85 c0                	test   %eax,%eax
+  800de1:	7f 08                	jg     800deb <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800de3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+  800dee:	50                   	push   %eax
+  800def:	6a 09                	push   $0x9
+  800df1:	68 0b 3e 80 00       	push   $0x803e0b
+  800df6:	6a 23                	push   $0x23
+  800df8:	68 28 3e 80 00       	push   $0x803e28
+  800dfd:	e8 f0 26 00 00       	call   8034f2 <_panic>
+
+00800e02 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e02:	55                   	push   %ebp
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	57                   	push   %edi
+  800e06:	56                   	push   %esi
+  800e07:	53                   	push   %ebx
+  800e08:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e1b:	89 df                	mov    %ebx,%edi
+  800e1d:	89 de                	mov    %ebx,%esi
+  800e1f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e21:	85 c0                	test   %eax,%eax
+  800e23:	7f 08                	jg     800e2d <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e28:	5b                   	pop    %ebx
+  800e29:	5e                   	pop    %esi
+  800e2a:	5f                   	pop    %edi
+  800e2b:	5d                   	pop    %ebp
+  800e2c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+  800e30:	50                   	push   %eax
+  800e31:	6a 0a                	push   $0xa
+  800e33:	68 0b 3e 80 00       	push   $0x803e0b
+  800e38:	6a 23                	push   $0x23
+  800e3a:	68 28 3e 80 00       	push   $0x803e28
+  800e3f:	e8 ae 26 00 00       	call   8034f2 <_panic>
+
+00800e44 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e44:	55                   	push   %ebp
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	57                   	push   %edi
+  800e48:	56                   	push   %esi
+  800e49:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e50:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e55:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e60:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+
+00800e67 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e78:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e7d:	89 cb                	mov    %ecx,%ebx
+  800e7f:	89 cf                	mov    %ecx,%edi
+  800e81:	89 ce                	mov    %ecx,%esi
+  800e83:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e85:	85 c0                	test   %eax,%eax
+  800e87:	7f 08                	jg     800e91 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8c:	5b                   	pop    %ebx
+  800e8d:	5e                   	pop    %esi
+  800e8e:	5f                   	pop    %edi
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e91:	83 ec 0c             	sub    $0xc,%esp
+  800e94:	50                   	push   %eax
+  800e95:	6a 0d                	push   $0xd
+  800e97:	68 0b 3e 80 00       	push   $0x803e0b
+  800e9c:	6a 23                	push   $0x23
+  800e9e:	68 28 3e 80 00       	push   $0x803e28
+  800ea3:	e8 4a 26 00 00       	call   8034f2 <_panic>
+
+00800ea8 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	57                   	push   %edi
+  800eac:	56                   	push   %esi
+  800ead:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ebf:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ec2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+
+00800ec9 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	56                   	push   %esi
+  800ece:	53                   	push   %ebx
+  800ecf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ee2:	89 df                	mov    %ebx,%edi
+  800ee4:	89 de                	mov    %ebx,%esi
+  800ee6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee8:	85 c0                	test   %eax,%eax
+  800eea:	7f 08                	jg     800ef4 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+  800ef7:	50                   	push   %eax
+  800ef8:	6a 0d                	push   $0xd
+  800efa:	68 0b 3e 80 00       	push   $0x803e0b
+  800eff:	6a 23                	push   $0x23
+  800f01:	68 28 3e 80 00       	push   $0x803e28
+  800f06:	e8 e7 25 00 00       	call   8034f2 <_panic>
+
+00800f0b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	57                   	push   %edi
+  800f0f:	56                   	push   %esi
+  800f10:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f16:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f1b:	89 d1                	mov    %edx,%ecx
+  800f1d:	89 d3                	mov    %edx,%ebx
+  800f1f:	89 d7                	mov    %edx,%edi
+  800f21:	89 d6                	mov    %edx,%esi
+  800f23:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f25:	5b                   	pop    %ebx
+  800f26:	5e                   	pop    %esi
+  800f27:	5f                   	pop    %edi
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+
+00800f2a <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f40:	89 df                	mov    %ebx,%edi
+  800f42:	89 de                	mov    %ebx,%esi
+  800f44:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+
+00800f4b <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	57                   	push   %edi
+  800f4f:	56                   	push   %esi
+  800f50:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f59:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f5e:	89 cb                	mov    %ecx,%ebx
+  800f60:	89 cf                	mov    %ecx,%edi
+  800f62:	89 ce                	mov    %ecx,%esi
+  800f64:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800f66:	5b                   	pop    %ebx
+  800f67:	5e                   	pop    %esi
+  800f68:	5f                   	pop    %edi
+  800f69:	5d                   	pop    %ebp
+  800f6a:	c3                   	ret
+
+00800f6b <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f81:	89 df                	mov    %ebx,%edi
+  800f83:	89 de                	mov    %ebx,%esi
+  800f85:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fa2:	89 df                	mov    %ebx,%edi
+  800fa4:	89 de                	mov    %ebx,%esi
+  800fa6:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fc0:	89 cb                	mov    %ecx,%ebx
+  800fc2:	89 cf                	mov    %ecx,%edi
+  800fc4:	89 ce                	mov    %ecx,%esi
+  800fc6:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  800fc8:	5b                   	pop    %ebx
+  800fc9:	5e                   	pop    %esi
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+
+00800fcd <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  800fcd:	55                   	push   %ebp
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	57                   	push   %edi
+  800fd1:	56                   	push   %esi
+  800fd2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fe3:	89 df                	mov    %ebx,%edi
+  800fe5:	89 de                	mov    %ebx,%esi
+  800fe7:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+
+00800fee <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffc:	b8 15 00 00 00       	mov    $0x15,%eax
+  801001:	89 cb                	mov    %ecx,%ebx
+  801003:	89 cf                	mov    %ecx,%edi
+  801005:	89 ce                	mov    %ecx,%esi
+  801007:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+
+0080100e <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	57                   	push   %edi
+  801012:	56                   	push   %esi
+  801013:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801014:	be 00 00 00 00       	mov    $0x0,%esi
+  801019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801024:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801027:	89 f7                	mov    %esi,%edi
+  801029:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80102b:	5b                   	pop    %ebx
+  80102c:	5e                   	pop    %esi
+  80102d:	5f                   	pop    %edi
+  80102e:	5d                   	pop    %ebp
+  80102f:	c3                   	ret
+
+00801030 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801030:	55                   	push   %ebp
+  801031:	89 e5                	mov    %esp,%ebp
+  801033:	57                   	push   %edi
+  801034:	56                   	push   %esi
+  801035:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801036:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801041:	b8 17 00 00 00       	mov    $0x17,%eax
+  801046:	89 df                	mov    %ebx,%edi
+  801048:	89 de                	mov    %ebx,%esi
+  80104a:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80104c:	5b                   	pop    %ebx
+  80104d:	5e                   	pop    %esi
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+
+00801051 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	56                   	push   %esi
+  801056:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80105c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801064:	89 cb                	mov    %ecx,%ebx
+  801066:	89 cf                	mov    %ecx,%edi
+  801068:	89 ce                	mov    %ecx,%esi
+  80106a:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5f                   	pop    %edi
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+
+00801071 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	57                   	push   %edi
+  801075:	56                   	push   %esi
+  801076:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801077:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80107b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801080:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801083:	b8 19 00 00 00       	mov    $0x19,%eax
+  801088:	89 df                	mov    %ebx,%edi
+  80108a:	89 de                	mov    %ebx,%esi
+  80108c:	cd 30                	int    $0x30
+}
+  80108e:	5b                   	pop    %ebx
+  80108f:	5e                   	pop    %esi
+  801090:	5f                   	pop    %edi
+  801091:	5d                   	pop    %ebp
+  801092:	c3                   	ret
+
+00801093 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801099:	be 00 00 00 00       	mov    $0x0,%esi
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ac:	89 f7                	mov    %esi,%edi
+  8010ae:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8010b0:	5b                   	pop    %ebx
+  8010b1:	5e                   	pop    %esi
+  8010b2:	5f                   	pop    %edi
+  8010b3:	5d                   	pop    %ebp
+  8010b4:	c3                   	ret
+
+008010b5 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ce:	89 f7                	mov    %esi,%edi
+  8010d0:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+
+008010d7 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010ed:	89 df                	mov    %ebx,%edi
+  8010ef:	89 de                	mov    %ebx,%esi
+  8010f1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801109:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80110e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801111:	89 f7                	mov    %esi,%edi
+  801113:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801115:	5b                   	pop    %ebx
+  801116:	5e                   	pop    %esi
+  801117:	5f                   	pop    %edi
+  801118:	5d                   	pop    %ebp
+  801119:	c3                   	ret
+
+0080111a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80111d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801120:	05 00 00 00 30       	add    $0x30000000,%eax
+  801125:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+
+0080112a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80112d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801130:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801135:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80113a:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80113f:	5d                   	pop    %ebp
+  801140:	c3                   	ret
+
+00801141 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801141:	55                   	push   %ebp
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801149:	89 c2                	mov    %eax,%edx
+  80114b:	c1 ea 16             	shr    $0x16,%edx
+  80114e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801155:	f6 c2 01             	test   $0x1,%dl
+  801158:	74 29                	je     801183 <fd_alloc+0x42>
+  80115a:	89 c2                	mov    %eax,%edx
+  80115c:	c1 ea 0c             	shr    $0xc,%edx
+  80115f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801166:	f6 c2 01             	test   $0x1,%dl
+  801169:	74 18                	je     801183 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80116b:	05 00 10 00 00       	add    $0x1000,%eax
+  801170:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801175:	75 d2                	jne    801149 <fd_alloc+0x8>
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80117c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801181:	eb 05                	jmp    801188 <fd_alloc+0x47>
+			return 0;
+  801183:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	89 02                	mov    %eax,(%edx)
+}
+  80118d:	89 c8                	mov    %ecx,%eax
+  80118f:	5d                   	pop    %ebp
+  801190:	c3                   	ret
+
+00801191 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801197:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80119c:	77 30                	ja     8011ce <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80119e:	c1 e0 0c             	shl    $0xc,%eax
+  8011a1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8011a6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011ac:	f6 c2 01             	test   $0x1,%dl
+  8011af:	74 24                	je     8011d5 <fd_lookup+0x44>
+  8011b1:	89 c2                	mov    %eax,%edx
+  8011b3:	c1 ea 0c             	shr    $0xc,%edx
+  8011b6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011bd:	f6 c2 01             	test   $0x1,%dl
+  8011c0:	74 1a                	je     8011dc <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011c5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011cc:	5d                   	pop    %ebp
+  8011cd:	c3                   	ret
+		return -E_INVAL;
+  8011ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011d3:	eb f7                	jmp    8011cc <fd_lookup+0x3b>
+		return -E_INVAL;
+  8011d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011da:	eb f0                	jmp    8011cc <fd_lookup+0x3b>
+  8011dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e1:	eb e9                	jmp    8011cc <fd_lookup+0x3b>
+
+008011e3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	53                   	push   %ebx
+  8011e7:	83 ec 04             	sub    $0x4,%esp
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f2:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8011f7:	39 13                	cmp    %edx,(%ebx)
+  8011f9:	74 54                	je     80124f <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8011fb:	83 c0 01             	add    $0x1,%eax
+  8011fe:	8b 1c 85 b4 3e 80 00 	mov    0x803eb4(,%eax,4),%ebx
+  801205:	85 db                	test   %ebx,%ebx
+  801207:	75 ee                	jne    8011f7 <dev_lookup+0x14>
+  801209:	89 e1                	mov    %esp,%ecx
+  80120b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801210:	29 c8                	sub    %ecx,%eax
+  801212:	89 c1                	mov    %eax,%ecx
+  801214:	c1 e9 0f             	shr    $0xf,%ecx
+  801217:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80121c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801221:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801224:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80122b:	8b 40 48             	mov    0x48(%eax),%eax
+  80122e:	83 ec 04             	sub    $0x4,%esp
+  801231:	52                   	push   %edx
+  801232:	50                   	push   %eax
+  801233:	68 38 3e 80 00       	push   $0x803e38
+  801238:	e8 4f ef ff ff       	call   80018c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80123d:	83 c4 10             	add    $0x10,%esp
+  801240:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801245:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801248:	89 1a                	mov    %ebx,(%edx)
+}
+  80124a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80124d:	c9                   	leave
+  80124e:	c3                   	ret
+			return 0;
+  80124f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801254:	eb ef                	jmp    801245 <dev_lookup+0x62>
+
+00801256 <fd_close>:
+{
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+  80125c:	83 ec 24             	sub    $0x24,%esp
+  80125f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801262:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801265:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801268:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801269:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80126f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801272:	50                   	push   %eax
+  801273:	e8 19 ff ff ff       	call   801191 <fd_lookup>
+  801278:	89 c3                	mov    %eax,%ebx
+  80127a:	83 c4 10             	add    $0x10,%esp
+  80127d:	85 c0                	test   %eax,%eax
+  80127f:	78 05                	js     801286 <fd_close+0x30>
+	    || fd != fd2)
+  801281:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801284:	74 0f                	je     801295 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801286:	85 ff                	test   %edi,%edi
+  801288:	0f 44 df             	cmove  %edi,%ebx
+}
+  80128b:	89 d8                	mov    %ebx,%eax
+  80128d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801290:	5b                   	pop    %ebx
+  801291:	5e                   	pop    %esi
+  801292:	5f                   	pop    %edi
+  801293:	5d                   	pop    %ebp
+  801294:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801295:	83 ec 08             	sub    $0x8,%esp
+  801298:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80129b:	50                   	push   %eax
+  80129c:	ff 36                	push   (%esi)
+  80129e:	e8 40 ff ff ff       	call   8011e3 <dev_lookup>
+  8012a3:	89 c3                	mov    %eax,%ebx
+  8012a5:	83 c4 10             	add    $0x10,%esp
+  8012a8:	85 c0                	test   %eax,%eax
+  8012aa:	78 1a                	js     8012c6 <fd_close+0x70>
+		if (dev->dev_close)
+  8012ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012af:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012b7:	85 c0                	test   %eax,%eax
+  8012b9:	74 0b                	je     8012c6 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8012bb:	83 ec 0c             	sub    $0xc,%esp
+  8012be:	56                   	push   %esi
+  8012bf:	ff d0                	call   *%eax
+  8012c1:	89 c3                	mov    %eax,%ebx
+  8012c3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012c6:	83 ec 08             	sub    $0x8,%esp
+  8012c9:	56                   	push   %esi
+  8012ca:	6a 00                	push   $0x0
+  8012cc:	e8 6b fa ff ff       	call   800d3c <sys_page_unmap>
+	return r;
+  8012d1:	83 c4 10             	add    $0x10,%esp
+  8012d4:	eb b5                	jmp    80128b <fd_close+0x35>
+
+008012d6 <close>:
+
+int
+close(int fdnum)
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012df:	50                   	push   %eax
+  8012e0:	ff 75 08             	push   0x8(%ebp)
+  8012e3:	e8 a9 fe ff ff       	call   801191 <fd_lookup>
+  8012e8:	83 c4 10             	add    $0x10,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	79 02                	jns    8012f1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012ef:	c9                   	leave
+  8012f0:	c3                   	ret
+		return fd_close(fd, 1);
+  8012f1:	83 ec 08             	sub    $0x8,%esp
+  8012f4:	6a 01                	push   $0x1
+  8012f6:	ff 75 f4             	push   -0xc(%ebp)
+  8012f9:	e8 58 ff ff ff       	call   801256 <fd_close>
+  8012fe:	83 c4 10             	add    $0x10,%esp
+  801301:	eb ec                	jmp    8012ef <close+0x19>
+
+00801303 <close_all>:
+
+void
+close_all(void)
+{
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	53                   	push   %ebx
+  801307:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80130a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80130f:	83 ec 0c             	sub    $0xc,%esp
+  801312:	53                   	push   %ebx
+  801313:	e8 be ff ff ff       	call   8012d6 <close>
+	for (i = 0; i < MAXFD; i++)
+  801318:	83 c3 01             	add    $0x1,%ebx
+  80131b:	83 c4 10             	add    $0x10,%esp
+  80131e:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801324:	75 e9                	jne    80130f <close_all+0xc>
+}
+  801326:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801329:	c9                   	leave
+  80132a:	c3                   	ret
+
+0080132b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80132b:	55                   	push   %ebp
+  80132c:	89 e5                	mov    %esp,%ebp
+  80132e:	57                   	push   %edi
+  80132f:	56                   	push   %esi
+  801330:	53                   	push   %ebx
+  801331:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801334:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801337:	50                   	push   %eax
+  801338:	ff 75 08             	push   0x8(%ebp)
+  80133b:	e8 51 fe ff ff       	call   801191 <fd_lookup>
+  801340:	89 c3                	mov    %eax,%ebx
+  801342:	83 c4 10             	add    $0x10,%esp
+  801345:	85 c0                	test   %eax,%eax
+  801347:	78 7f                	js     8013c8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801349:	83 ec 0c             	sub    $0xc,%esp
+  80134c:	ff 75 0c             	push   0xc(%ebp)
+  80134f:	e8 82 ff ff ff       	call   8012d6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801354:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801357:	c1 e6 0c             	shl    $0xc,%esi
+  80135a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801360:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801363:	89 3c 24             	mov    %edi,(%esp)
+  801366:	e8 bf fd ff ff       	call   80112a <fd2data>
+  80136b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80136d:	89 34 24             	mov    %esi,(%esp)
+  801370:	e8 b5 fd ff ff       	call   80112a <fd2data>
+  801375:	83 c4 10             	add    $0x10,%esp
+  801378:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80137b:	89 d8                	mov    %ebx,%eax
+  80137d:	c1 e8 16             	shr    $0x16,%eax
+  801380:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801387:	a8 01                	test   $0x1,%al
+  801389:	74 11                	je     80139c <dup+0x71>
+  80138b:	89 d8                	mov    %ebx,%eax
+  80138d:	c1 e8 0c             	shr    $0xc,%eax
+  801390:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801397:	f6 c2 01             	test   $0x1,%dl
+  80139a:	75 36                	jne    8013d2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80139c:	89 f8                	mov    %edi,%eax
+  80139e:	c1 e8 0c             	shr    $0xc,%eax
+  8013a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b0:	50                   	push   %eax
+  8013b1:	56                   	push   %esi
+  8013b2:	6a 00                	push   $0x0
+  8013b4:	57                   	push   %edi
+  8013b5:	6a 00                	push   $0x0
+  8013b7:	e8 3e f9 ff ff       	call   800cfa <sys_page_map>
+  8013bc:	89 c3                	mov    %eax,%ebx
+  8013be:	83 c4 20             	add    $0x20,%esp
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	78 33                	js     8013f8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013c8:	89 d8                	mov    %ebx,%eax
+  8013ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cd:	5b                   	pop    %ebx
+  8013ce:	5e                   	pop    %esi
+  8013cf:	5f                   	pop    %edi
+  8013d0:	5d                   	pop    %ebp
+  8013d1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013d9:	83 ec 0c             	sub    $0xc,%esp
+  8013dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013e1:	50                   	push   %eax
+  8013e2:	ff 75 d4             	push   -0x2c(%ebp)
+  8013e5:	6a 00                	push   $0x0
+  8013e7:	53                   	push   %ebx
+  8013e8:	6a 00                	push   $0x0
+  8013ea:	e8 0b f9 ff ff       	call   800cfa <sys_page_map>
+  8013ef:	89 c3                	mov    %eax,%ebx
+  8013f1:	83 c4 20             	add    $0x20,%esp
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	79 a4                	jns    80139c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013f8:	83 ec 08             	sub    $0x8,%esp
+  8013fb:	56                   	push   %esi
+  8013fc:	6a 00                	push   $0x0
+  8013fe:	e8 39 f9 ff ff       	call   800d3c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801403:	83 c4 08             	add    $0x8,%esp
+  801406:	ff 75 d4             	push   -0x2c(%ebp)
+  801409:	6a 00                	push   $0x0
+  80140b:	e8 2c f9 ff ff       	call   800d3c <sys_page_unmap>
+	return r;
+  801410:	83 c4 10             	add    $0x10,%esp
+  801413:	eb b3                	jmp    8013c8 <dup+0x9d>
+
+00801415 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	83 ec 18             	sub    $0x18,%esp
+  80141d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801420:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801423:	50                   	push   %eax
+  801424:	53                   	push   %ebx
+  801425:	e8 67 fd ff ff       	call   801191 <fd_lookup>
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	85 c0                	test   %eax,%eax
+  80142f:	78 3c                	js     80146d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801431:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801434:	83 ec 08             	sub    $0x8,%esp
+  801437:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80143a:	50                   	push   %eax
+  80143b:	ff 36                	push   (%esi)
+  80143d:	e8 a1 fd ff ff       	call   8011e3 <dev_lookup>
+  801442:	83 c4 10             	add    $0x10,%esp
+  801445:	85 c0                	test   %eax,%eax
+  801447:	78 24                	js     80146d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801449:	8b 46 08             	mov    0x8(%esi),%eax
+  80144c:	83 e0 03             	and    $0x3,%eax
+  80144f:	83 f8 01             	cmp    $0x1,%eax
+  801452:	74 20                	je     801474 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801457:	8b 40 08             	mov    0x8(%eax),%eax
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	74 54                	je     8014b2 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80145e:	83 ec 04             	sub    $0x4,%esp
+  801461:	ff 75 10             	push   0x10(%ebp)
+  801464:	ff 75 0c             	push   0xc(%ebp)
+  801467:	56                   	push   %esi
+  801468:	ff d0                	call   *%eax
+  80146a:	83 c4 10             	add    $0x10,%esp
+}
+  80146d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5d                   	pop    %ebp
+  801473:	c3                   	ret
+  801474:	89 e2                	mov    %esp,%edx
+  801476:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80147b:	29 d0                	sub    %edx,%eax
+  80147d:	89 c2                	mov    %eax,%edx
+  80147f:	c1 ea 0f             	shr    $0xf,%edx
+  801482:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80148f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  801496:	8b 40 48             	mov    0x48(%eax),%eax
+  801499:	83 ec 04             	sub    $0x4,%esp
+  80149c:	53                   	push   %ebx
+  80149d:	50                   	push   %eax
+  80149e:	68 79 3e 80 00       	push   $0x803e79
+  8014a3:	e8 e4 ec ff ff       	call   80018c <cprintf>
+		return -E_INVAL;
+  8014a8:	83 c4 10             	add    $0x10,%esp
+  8014ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b0:	eb bb                	jmp    80146d <read+0x58>
+		return -E_NOT_SUPP;
+  8014b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014b7:	eb b4                	jmp    80146d <read+0x58>
+
+008014b9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	57                   	push   %edi
+  8014bd:	56                   	push   %esi
+  8014be:	53                   	push   %ebx
+  8014bf:	83 ec 0c             	sub    $0xc,%esp
+  8014c2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014c5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014c8:	85 f6                	test   %esi,%esi
+  8014ca:	74 30                	je     8014fc <readn+0x43>
+  8014cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d1:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014d6:	83 ec 04             	sub    $0x4,%esp
+  8014d9:	89 f2                	mov    %esi,%edx
+  8014db:	29 c2                	sub    %eax,%edx
+  8014dd:	52                   	push   %edx
+  8014de:	01 f8                	add    %edi,%eax
+  8014e0:	50                   	push   %eax
+  8014e1:	ff 75 08             	push   0x8(%ebp)
+  8014e4:	e8 2c ff ff ff       	call   801415 <read>
+		if (m < 0)
+  8014e9:	83 c4 10             	add    $0x10,%esp
+  8014ec:	85 c0                	test   %eax,%eax
+  8014ee:	78 15                	js     801505 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8014f0:	74 11                	je     801503 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8014f2:	01 c3                	add    %eax,%ebx
+  8014f4:	89 d8                	mov    %ebx,%eax
+  8014f6:	39 f3                	cmp    %esi,%ebx
+  8014f8:	72 dc                	jb     8014d6 <readn+0x1d>
+  8014fa:	eb 09                	jmp    801505 <readn+0x4c>
+  8014fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801501:	eb 02                	jmp    801505 <readn+0x4c>
+  801503:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801508:	5b                   	pop    %ebx
+  801509:	5e                   	pop    %esi
+  80150a:	5f                   	pop    %edi
+  80150b:	5d                   	pop    %ebp
+  80150c:	c3                   	ret
+
+0080150d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	56                   	push   %esi
+  801511:	53                   	push   %ebx
+  801512:	83 ec 18             	sub    $0x18,%esp
+  801515:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801518:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80151b:	50                   	push   %eax
+  80151c:	53                   	push   %ebx
+  80151d:	e8 6f fc ff ff       	call   801191 <fd_lookup>
+  801522:	83 c4 10             	add    $0x10,%esp
+  801525:	85 c0                	test   %eax,%eax
+  801527:	78 37                	js     801560 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801529:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80152c:	83 ec 08             	sub    $0x8,%esp
+  80152f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801532:	50                   	push   %eax
+  801533:	ff 36                	push   (%esi)
+  801535:	e8 a9 fc ff ff       	call   8011e3 <dev_lookup>
+  80153a:	83 c4 10             	add    $0x10,%esp
+  80153d:	85 c0                	test   %eax,%eax
+  80153f:	78 1f                	js     801560 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801541:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801545:	74 20                	je     801567 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801547:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80154a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	74 54                	je     8015a5 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801551:	83 ec 04             	sub    $0x4,%esp
+  801554:	ff 75 10             	push   0x10(%ebp)
+  801557:	ff 75 0c             	push   0xc(%ebp)
+  80155a:	56                   	push   %esi
+  80155b:	ff d0                	call   *%eax
+  80155d:	83 c4 10             	add    $0x10,%esp
+}
+  801560:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5d                   	pop    %ebp
+  801566:	c3                   	ret
+  801567:	89 e2                	mov    %esp,%edx
+  801569:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80156e:	29 d0                	sub    %edx,%eax
+  801570:	89 c2                	mov    %eax,%edx
+  801572:	c1 ea 0f             	shr    $0xf,%edx
+  801575:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80157a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801582:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  801589:	8b 40 48             	mov    0x48(%eax),%eax
+  80158c:	83 ec 04             	sub    $0x4,%esp
+  80158f:	53                   	push   %ebx
+  801590:	50                   	push   %eax
+  801591:	68 95 3e 80 00       	push   $0x803e95
+  801596:	e8 f1 eb ff ff       	call   80018c <cprintf>
+		return -E_INVAL;
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a3:	eb bb                	jmp    801560 <write+0x53>
+		return -E_NOT_SUPP;
+  8015a5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015aa:	eb b4                	jmp    801560 <write+0x53>
+
+008015ac <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b5:	50                   	push   %eax
+  8015b6:	ff 75 08             	push   0x8(%ebp)
+  8015b9:	e8 d3 fb ff ff       	call   801191 <fd_lookup>
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	78 0e                	js     8015d3 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015cb:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d3:	c9                   	leave
+  8015d4:	c3                   	ret
+
+008015d5 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	53                   	push   %ebx
+  8015d9:	83 ec 1c             	sub    $0x1c,%esp
+  8015dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e2:	50                   	push   %eax
+  8015e3:	ff 75 08             	push   0x8(%ebp)
+  8015e6:	e8 a6 fb ff ff       	call   801191 <fd_lookup>
+  8015eb:	83 c4 10             	add    $0x10,%esp
+  8015ee:	85 c0                	test   %eax,%eax
+  8015f0:	78 33                	js     801625 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8015f2:	83 fb 03             	cmp    $0x3,%ebx
+  8015f5:	74 28                	je     80161f <fcntl+0x4a>
+  8015f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fc:	83 fb 04             	cmp    $0x4,%ebx
+  8015ff:	75 24                	jne    801625 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801601:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801604:	8b 41 08             	mov    0x8(%ecx),%eax
+  801607:	80 e4 ef             	and    $0xef,%ah
+  80160a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80160d:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801613:	09 d0                	or     %edx,%eax
+  801615:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801618:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161d:	eb 06                	jmp    801625 <fcntl+0x50>
+		return fd->fd_omode;
+  80161f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801622:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801625:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801628:	c9                   	leave
+  801629:	c3                   	ret
+
+0080162a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80162a:	55                   	push   %ebp
+  80162b:	89 e5                	mov    %esp,%ebp
+  80162d:	56                   	push   %esi
+  80162e:	53                   	push   %ebx
+  80162f:	83 ec 18             	sub    $0x18,%esp
+  801632:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801635:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801638:	50                   	push   %eax
+  801639:	53                   	push   %ebx
+  80163a:	e8 52 fb ff ff       	call   801191 <fd_lookup>
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	78 34                	js     80167a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801646:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801649:	83 ec 08             	sub    $0x8,%esp
+  80164c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80164f:	50                   	push   %eax
+  801650:	ff 36                	push   (%esi)
+  801652:	e8 8c fb ff ff       	call   8011e3 <dev_lookup>
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	85 c0                	test   %eax,%eax
+  80165c:	78 1c                	js     80167a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80165e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801662:	74 1d                	je     801681 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801664:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801667:	8b 40 18             	mov    0x18(%eax),%eax
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	74 51                	je     8016bf <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80166e:	83 ec 08             	sub    $0x8,%esp
+  801671:	ff 75 0c             	push   0xc(%ebp)
+  801674:	56                   	push   %esi
+  801675:	ff d0                	call   *%eax
+  801677:	83 c4 10             	add    $0x10,%esp
+}
+  80167a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5d                   	pop    %ebp
+  801680:	c3                   	ret
+  801681:	89 e2                	mov    %esp,%edx
+  801683:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801688:	29 d0                	sub    %edx,%eax
+  80168a:	89 c2                	mov    %eax,%edx
+  80168c:	c1 ea 0f             	shr    $0xf,%edx
+  80168f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801694:	b8 00 00 00 00       	mov    $0x0,%eax
+  801699:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80169c:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8016a3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016a6:	83 ec 04             	sub    $0x4,%esp
+  8016a9:	53                   	push   %ebx
+  8016aa:	50                   	push   %eax
+  8016ab:	68 58 3e 80 00       	push   $0x803e58
+  8016b0:	e8 d7 ea ff ff       	call   80018c <cprintf>
+		return -E_INVAL;
+  8016b5:	83 c4 10             	add    $0x10,%esp
+  8016b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016bd:	eb bb                	jmp    80167a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c4:	eb b4                	jmp    80167a <ftruncate+0x50>
+
+008016c6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016c6:	55                   	push   %ebp
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	83 ec 18             	sub    $0x18,%esp
+  8016ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d4:	50                   	push   %eax
+  8016d5:	ff 75 08             	push   0x8(%ebp)
+  8016d8:	e8 b4 fa ff ff       	call   801191 <fd_lookup>
+  8016dd:	83 c4 10             	add    $0x10,%esp
+  8016e0:	85 c0                	test   %eax,%eax
+  8016e2:	78 53                	js     801737 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016e4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ed:	50                   	push   %eax
+  8016ee:	ff 36                	push   (%esi)
+  8016f0:	e8 ee fa ff ff       	call   8011e3 <dev_lookup>
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	78 3b                	js     801737 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8016fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ff:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801703:	74 39                	je     80173e <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801705:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801708:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80170f:	00 00 00 
+	stat->st_isdir = 0;
+  801712:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801719:	00 00 00 
+	stat->st_version = 0;
+  80171c:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801723:	00 00 00 
+	stat->st_dev = dev;
+  801726:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80172c:	83 ec 08             	sub    $0x8,%esp
+  80172f:	53                   	push   %ebx
+  801730:	56                   	push   %esi
+  801731:	ff 50 14             	call   *0x14(%eax)
+  801734:	83 c4 10             	add    $0x10,%esp
+}
+  801737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5e                   	pop    %esi
+  80173c:	5d                   	pop    %ebp
+  80173d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80173e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801743:	eb f2                	jmp    801737 <fstat+0x71>
+
+00801745 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801745:	55                   	push   %ebp
+  801746:	89 e5                	mov    %esp,%ebp
+  801748:	56                   	push   %esi
+  801749:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80174a:	83 ec 08             	sub    $0x8,%esp
+  80174d:	6a 00                	push   $0x0
+  80174f:	ff 75 08             	push   0x8(%ebp)
+  801752:	e8 b7 01 00 00       	call   80190e <open>
+  801757:	89 c3                	mov    %eax,%ebx
+  801759:	83 c4 10             	add    $0x10,%esp
+  80175c:	85 c0                	test   %eax,%eax
+  80175e:	78 1b                	js     80177b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801760:	83 ec 08             	sub    $0x8,%esp
+  801763:	ff 75 0c             	push   0xc(%ebp)
+  801766:	50                   	push   %eax
+  801767:	e8 5a ff ff ff       	call   8016c6 <fstat>
+  80176c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80176e:	89 1c 24             	mov    %ebx,(%esp)
+  801771:	e8 60 fb ff ff       	call   8012d6 <close>
+	return r;
+  801776:	83 c4 10             	add    $0x10,%esp
+  801779:	89 f3                	mov    %esi,%ebx
+}
+  80177b:	89 d8                	mov    %ebx,%eax
+  80177d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801780:	5b                   	pop    %ebx
+  801781:	5e                   	pop    %esi
+  801782:	5d                   	pop    %ebp
+  801783:	c3                   	ret
+
+00801784 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801784:	55                   	push   %ebp
+  801785:	89 e5                	mov    %esp,%ebp
+  801787:	56                   	push   %esi
+  801788:	53                   	push   %ebx
+  801789:	89 c6                	mov    %eax,%esi
+  80178b:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80178d:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801794:	74 27                	je     8017bd <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801796:	6a 07                	push   $0x7
+  801798:	68 00 60 80 00       	push   $0x806000
+  80179d:	56                   	push   %esi
+  80179e:	ff 35 00 50 80 00    	push   0x805000
+  8017a4:	e8 1f 20 00 00       	call   8037c8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017a9:	83 c4 0c             	add    $0xc,%esp
+  8017ac:	6a 00                	push   $0x0
+  8017ae:	53                   	push   %ebx
+  8017af:	6a 00                	push   $0x0
+  8017b1:	e8 82 1d 00 00       	call   803538 <ipc_recv>
+}
+  8017b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b9:	5b                   	pop    %ebx
+  8017ba:	5e                   	pop    %esi
+  8017bb:	5d                   	pop    %ebp
+  8017bc:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017bd:	83 ec 0c             	sub    $0xc,%esp
+  8017c0:	6a 02                	push   $0x2
+  8017c2:	e8 6a 20 00 00       	call   803831 <ipc_find_env>
+  8017c7:	a3 00 50 80 00       	mov    %eax,0x805000
+  8017cc:	83 c4 10             	add    $0x10,%esp
+  8017cf:	eb c5                	jmp    801796 <fsipc+0x12>
+
+008017d1 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017d1:	55                   	push   %ebp
+  8017d2:	89 e5                	mov    %esp,%ebp
+  8017d4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017da:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017dd:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8017e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017e5:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8017ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ef:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017f4:	e8 8b ff ff ff       	call   801784 <fsipc>
+}
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+008017fb <devfile_flush>:
+{
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801801:	8b 45 08             	mov    0x8(%ebp),%eax
+  801804:	8b 40 0c             	mov    0xc(%eax),%eax
+  801807:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80180c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801811:	b8 06 00 00 00       	mov    $0x6,%eax
+  801816:	e8 69 ff ff ff       	call   801784 <fsipc>
+}
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+
+0080181d <devfile_stat>:
+{
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	53                   	push   %ebx
+  801821:	83 ec 04             	sub    $0x4,%esp
+  801824:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801827:	8b 45 08             	mov    0x8(%ebp),%eax
+  80182a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80182d:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801832:	ba 00 00 00 00       	mov    $0x0,%edx
+  801837:	b8 05 00 00 00       	mov    $0x5,%eax
+  80183c:	e8 43 ff ff ff       	call   801784 <fsipc>
+  801841:	85 c0                	test   %eax,%eax
+  801843:	78 37                	js     80187c <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801845:	83 ec 08             	sub    $0x8,%esp
+  801848:	68 00 60 80 00       	push   $0x806000
+  80184d:	53                   	push   %ebx
+  80184e:	e8 30 f0 ff ff       	call   800883 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801853:	a1 80 60 80 00       	mov    0x806080,%eax
+  801858:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80185e:	a1 84 60 80 00       	mov    0x806084,%eax
+  801863:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801869:	a1 88 60 80 00       	mov    0x806088,%eax
+  80186e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801874:	83 c4 10             	add    $0x10,%esp
+  801877:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80187c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80187f:	c9                   	leave
+  801880:	c3                   	ret
+
+00801881 <devfile_write>:
+{
+  801881:	55                   	push   %ebp
+  801882:	89 e5                	mov    %esp,%ebp
+  801884:	83 ec 0c             	sub    $0xc,%esp
+  801887:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80188a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80188f:	39 d0                	cmp    %edx,%eax
+  801891:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801894:	8b 55 08             	mov    0x8(%ebp),%edx
+  801897:	8b 52 0c             	mov    0xc(%edx),%edx
+  80189a:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  8018a0:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8018a5:	50                   	push   %eax
+  8018a6:	ff 75 0c             	push   0xc(%ebp)
+  8018a9:	68 08 60 80 00       	push   $0x806008
+  8018ae:	e8 80 f1 ff ff       	call   800a33 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8018b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018bd:	e8 c2 fe ff ff       	call   801784 <fsipc>
+}
+  8018c2:	c9                   	leave
+  8018c3:	c3                   	ret
+
+008018c4 <devfile_read>:
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	53                   	push   %ebx
+  8018c8:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ce:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018d1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8018d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018d9:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8018de:	ba 00 60 80 00       	mov    $0x806000,%edx
+  8018e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018e8:	e8 97 fe ff ff       	call   801784 <fsipc>
+  8018ed:	89 c3                	mov    %eax,%ebx
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	78 14                	js     801907 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8018f3:	83 ec 04             	sub    $0x4,%esp
+  8018f6:	50                   	push   %eax
+  8018f7:	68 00 60 80 00       	push   $0x806000
+  8018fc:	ff 75 0c             	push   0xc(%ebp)
+  8018ff:	e8 2f f1 ff ff       	call   800a33 <memmove>
+	return r;
+  801904:	83 c4 10             	add    $0x10,%esp
+}
+  801907:	89 d8                	mov    %ebx,%eax
+  801909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190c:	c9                   	leave
+  80190d:	c3                   	ret
+
+0080190e <open>:
+{
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	53                   	push   %ebx
+  801912:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801915:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801918:	50                   	push   %eax
+  801919:	e8 23 f8 ff ff       	call   801141 <fd_alloc>
+  80191e:	89 c3                	mov    %eax,%ebx
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 2a                	js     801951 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801927:	83 ec 0c             	sub    $0xc,%esp
+  80192a:	ff 75 08             	push   0x8(%ebp)
+  80192d:	e8 05 ef ff ff       	call   800837 <strlen>
+  801932:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801935:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80193a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80193f:	7e 17                	jle    801958 <open+0x4a>
+	fd_close(fd, 1);
+  801941:	83 ec 08             	sub    $0x8,%esp
+  801944:	6a 01                	push   $0x1
+  801946:	ff 75 f4             	push   -0xc(%ebp)
+  801949:	e8 08 f9 ff ff       	call   801256 <fd_close>
+	return r;
+  80194e:	83 c4 10             	add    $0x10,%esp
+}
+  801951:	89 d8                	mov    %ebx,%eax
+  801953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801956:	c9                   	leave
+  801957:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801958:	83 ec 08             	sub    $0x8,%esp
+  80195b:	ff 75 08             	push   0x8(%ebp)
+  80195e:	68 00 60 80 00       	push   $0x806000
+  801963:	e8 1b ef ff ff       	call   800883 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801968:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80196b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801970:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801973:	b8 01 00 00 00       	mov    $0x1,%eax
+  801978:	e8 07 fe ff ff       	call   801784 <fsipc>
+  80197d:	89 c3                	mov    %eax,%ebx
+  80197f:	83 c4 10             	add    $0x10,%esp
+  801982:	85 c0                	test   %eax,%eax
+  801984:	78 bb                	js     801941 <open+0x33>
+	return fd2num(fd); 	
+  801986:	83 ec 0c             	sub    $0xc,%esp
+  801989:	ff 75 f4             	push   -0xc(%ebp)
+  80198c:	e8 89 f7 ff ff       	call   80111a <fd2num>
+  801991:	89 c3                	mov    %eax,%ebx
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	eb b9                	jmp    801951 <open+0x43>
+
+00801998 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801998:	55                   	push   %ebp
+  801999:	89 e5                	mov    %esp,%ebp
+  80199b:	53                   	push   %ebx
+  80199c:	83 ec 1c             	sub    $0x1c,%esp
+  80199f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a5:	50                   	push   %eax
+  8019a6:	ff 75 08             	push   0x8(%ebp)
+  8019a9:	e8 e3 f7 ff ff       	call   801191 <fd_lookup>
+  8019ae:	83 c4 10             	add    $0x10,%esp
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 5a                	js     801a0f <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8019b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019b8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8019be:	39 10                	cmp    %edx,(%eax)
+  8019c0:	75 66                	jne    801a28 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8019c2:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8019c9:	74 49                	je     801a14 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8019cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ce:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  8019d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019d9:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  8019de:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019e4:	6a 07                	push   $0x7
+  8019e6:	68 00 60 80 00       	push   $0x806000
+  8019eb:	6a 09                	push   $0x9
+  8019ed:	ff 35 00 50 80 00    	push   0x805000
+  8019f3:	e8 d0 1d 00 00       	call   8037c8 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8019f8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8019ff:	6a 00                	push   $0x0
+  801a01:	53                   	push   %ebx
+  801a02:	ff 75 10             	push   0x10(%ebp)
+  801a05:	6a 00                	push   $0x0
+  801a07:	e8 f9 1b 00 00       	call   803605 <ipc_recv_pages>
+  801a0c:	83 c4 20             	add    $0x20,%esp
+}
+  801a0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a12:	c9                   	leave
+  801a13:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a14:	83 ec 0c             	sub    $0xc,%esp
+  801a17:	6a 02                	push   $0x2
+  801a19:	e8 13 1e 00 00       	call   803831 <ipc_find_env>
+  801a1e:	a3 00 50 80 00       	mov    %eax,0x805000
+  801a23:	83 c4 10             	add    $0x10,%esp
+  801a26:	eb a3                	jmp    8019cb <fmap+0x33>
+		return -E_INVAL;
+  801a28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2d:	eb e0                	jmp    801a0f <fmap+0x77>
+
+00801a2f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801a2f:	55                   	push   %ebp
+  801a30:	89 e5                	mov    %esp,%ebp
+  801a32:	53                   	push   %ebx
+  801a33:	83 ec 10             	sub    $0x10,%esp
+  801a36:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801a39:	53                   	push   %ebx
+  801a3a:	e8 f8 ed ff ff       	call   800837 <strlen>
+  801a3f:	83 c4 10             	add    $0x10,%esp
+  801a42:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a47:	7f 25                	jg     801a6e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801a49:	83 ec 08             	sub    $0x8,%esp
+  801a4c:	53                   	push   %ebx
+  801a4d:	68 00 60 80 00       	push   $0x806000
+  801a52:	e8 2c ee ff ff       	call   800883 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801a57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a61:	e8 1e fd ff ff       	call   801784 <fsipc>
+  801a66:	83 c4 10             	add    $0x10,%esp
+}
+  801a69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6c:	c9                   	leave
+  801a6d:	c3                   	ret
+		return -E_BAD_PATH;
+  801a6e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801a73:	eb f4                	jmp    801a69 <remove+0x3a>
+
+00801a75 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801a75:	55                   	push   %ebp
+  801a76:	89 e5                	mov    %esp,%ebp
+  801a78:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801a7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a80:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a85:	e8 fa fc ff ff       	call   801784 <fsipc>
+}
+  801a8a:	c9                   	leave
+  801a8b:	c3                   	ret
+
+00801a8c <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a92:	68 c8 3e 80 00       	push   $0x803ec8
+  801a97:	ff 75 0c             	push   0xc(%ebp)
+  801a9a:	e8 e4 ed ff ff       	call   800883 <strcpy>
+	return 0;
+}
+  801a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa4:	c9                   	leave
+  801aa5:	c3                   	ret
+
+00801aa6 <devsock_close>:
+{
+  801aa6:	55                   	push   %ebp
+  801aa7:	89 e5                	mov    %esp,%ebp
+  801aa9:	53                   	push   %ebx
+  801aaa:	83 ec 10             	sub    $0x10,%esp
+  801aad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ab0:	53                   	push   %ebx
+  801ab1:	e8 ba 1d 00 00       	call   803870 <pageref>
+  801ab6:	89 c2                	mov    %eax,%edx
+  801ab8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801abb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ac0:	83 fa 01             	cmp    $0x1,%edx
+  801ac3:	74 05                	je     801aca <devsock_close+0x24>
+}
+  801ac5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac8:	c9                   	leave
+  801ac9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801aca:	83 ec 0c             	sub    $0xc,%esp
+  801acd:	ff 73 0c             	push   0xc(%ebx)
+  801ad0:	e8 b0 05 00 00       	call   802085 <nsipc_close>
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	eb eb                	jmp    801ac5 <devsock_close+0x1f>
+
+00801ada <devsock_write>:
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 14             	sub    $0x14,%esp
+  801ae1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ae4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801ae7:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801aea:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801aed:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801af0:	8b 41 08             	mov    0x8(%ecx),%eax
+  801af3:	c1 f8 09             	sar    $0x9,%eax
+  801af6:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801af9:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801aff:	77 13                	ja     801b14 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801b01:	50                   	push   %eax
+  801b02:	52                   	push   %edx
+  801b03:	53                   	push   %ebx
+  801b04:	ff 71 0c             	push   0xc(%ecx)
+  801b07:	e8 5c 06 00 00       	call   802168 <nsipc_send>
+  801b0c:	83 c4 10             	add    $0x10,%esp
+}
+  801b0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b12:	c9                   	leave
+  801b13:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801b14:	50                   	push   %eax
+  801b15:	6a 01                	push   $0x1
+  801b17:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b1a:	50                   	push   %eax
+  801b1b:	ff 71 0c             	push   0xc(%ecx)
+  801b1e:	e8 a6 06 00 00       	call   8021c9 <nsipc_sendmsg>
+  801b23:	83 c4 10             	add    $0x10,%esp
+  801b26:	eb e7                	jmp    801b0f <devsock_write+0x35>
+
+00801b28 <devsock_read>:
+{
+  801b28:	55                   	push   %ebp
+  801b29:	89 e5                	mov    %esp,%ebp
+  801b2b:	53                   	push   %ebx
+  801b2c:	83 ec 14             	sub    $0x14,%esp
+  801b2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b35:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801b38:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801b3b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801b3e:	8b 41 08             	mov    0x8(%ecx),%eax
+  801b41:	c1 f8 09             	sar    $0x9,%eax
+  801b44:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801b47:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801b4d:	77 13                	ja     801b62 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801b4f:	50                   	push   %eax
+  801b50:	52                   	push   %edx
+  801b51:	53                   	push   %ebx
+  801b52:	ff 71 0c             	push   0xc(%ecx)
+  801b55:	e8 9c 05 00 00       	call   8020f6 <nsipc_recv>
+  801b5a:	83 c4 10             	add    $0x10,%esp
+}
+  801b5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b60:	c9                   	leave
+  801b61:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801b62:	50                   	push   %eax
+  801b63:	6a 01                	push   $0x1
+  801b65:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b68:	50                   	push   %eax
+  801b69:	ff 71 0c             	push   0xc(%ecx)
+  801b6c:	e8 02 0a 00 00       	call   802573 <nsipc_recvmsg>
+  801b71:	83 c4 10             	add    $0x10,%esp
+  801b74:	eb e7                	jmp    801b5d <devsock_read+0x35>
+
+00801b76 <fd2sockid>:
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b7c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b7f:	52                   	push   %edx
+  801b80:	50                   	push   %eax
+  801b81:	e8 0b f6 ff ff       	call   801191 <fd_lookup>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 10                	js     801b9d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b90:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801b96:	39 08                	cmp    %ecx,(%eax)
+  801b98:	75 05                	jne    801b9f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b9a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b9f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ba4:	eb f7                	jmp    801b9d <fd2sockid+0x27>
+
+00801ba6 <sock_flags>:
+{
+  801ba6:	55                   	push   %ebp
+  801ba7:	89 e5                	mov    %esp,%ebp
+  801ba9:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801bac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801baf:	52                   	push   %edx
+  801bb0:	50                   	push   %eax
+  801bb1:	e8 db f5 ff ff       	call   801191 <fd_lookup>
+  801bb6:	83 c4 10             	add    $0x10,%esp
+  801bb9:	85 c0                	test   %eax,%eax
+  801bbb:	78 0e                	js     801bcb <sock_flags+0x25>
+  801bbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc0:	8b 40 08             	mov    0x8(%eax),%eax
+  801bc3:	c1 e8 09             	shr    $0x9,%eax
+  801bc6:	83 e0 08             	and    $0x8,%eax
+}
+  801bc9:	c9                   	leave
+  801bca:	c3                   	ret
+		return 0;
+  801bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd0:	eb f7                	jmp    801bc9 <sock_flags+0x23>
+
+00801bd2 <alloc_sockfd>:
+{
+  801bd2:	55                   	push   %ebp
+  801bd3:	89 e5                	mov    %esp,%ebp
+  801bd5:	56                   	push   %esi
+  801bd6:	53                   	push   %ebx
+  801bd7:	83 ec 1c             	sub    $0x1c,%esp
+  801bda:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801bdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bdf:	50                   	push   %eax
+  801be0:	e8 5c f5 ff ff       	call   801141 <fd_alloc>
+  801be5:	89 c3                	mov    %eax,%ebx
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	78 43                	js     801c31 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801bee:	83 ec 04             	sub    $0x4,%esp
+  801bf1:	68 07 04 00 00       	push   $0x407
+  801bf6:	ff 75 f4             	push   -0xc(%ebp)
+  801bf9:	6a 00                	push   $0x0
+  801bfb:	e8 b7 f0 ff ff       	call   800cb7 <sys_page_alloc>
+  801c00:	89 c3                	mov    %eax,%ebx
+  801c02:	83 c4 10             	add    $0x10,%esp
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	78 28                	js     801c31 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c0c:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801c12:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c17:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801c1e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801c21:	83 ec 0c             	sub    $0xc,%esp
+  801c24:	50                   	push   %eax
+  801c25:	e8 f0 f4 ff ff       	call   80111a <fd2num>
+  801c2a:	89 c3                	mov    %eax,%ebx
+  801c2c:	83 c4 10             	add    $0x10,%esp
+  801c2f:	eb 0c                	jmp    801c3d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c31:	83 ec 0c             	sub    $0xc,%esp
+  801c34:	56                   	push   %esi
+  801c35:	e8 4b 04 00 00       	call   802085 <nsipc_close>
+		return r;
+  801c3a:	83 c4 10             	add    $0x10,%esp
+}
+  801c3d:	89 d8                	mov    %ebx,%eax
+  801c3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c42:	5b                   	pop    %ebx
+  801c43:	5e                   	pop    %esi
+  801c44:	5d                   	pop    %ebp
+  801c45:	c3                   	ret
+
+00801c46 <accept>:
+{
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	56                   	push   %esi
+  801c4a:	53                   	push   %ebx
+  801c4b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801c4e:	89 f0                	mov    %esi,%eax
+  801c50:	e8 21 ff ff ff       	call   801b76 <fd2sockid>
+  801c55:	89 c3                	mov    %eax,%ebx
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	78 24                	js     801c7f <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801c5b:	89 f0                	mov    %esi,%eax
+  801c5d:	e8 44 ff ff ff       	call   801ba6 <sock_flags>
+  801c62:	50                   	push   %eax
+  801c63:	ff 75 10             	push   0x10(%ebp)
+  801c66:	ff 75 0c             	push   0xc(%ebp)
+  801c69:	53                   	push   %ebx
+  801c6a:	e8 6b 03 00 00       	call   801fda <nsipc_accept>
+  801c6f:	89 c3                	mov    %eax,%ebx
+  801c71:	83 c4 10             	add    $0x10,%esp
+  801c74:	85 c0                	test   %eax,%eax
+  801c76:	78 07                	js     801c7f <accept+0x39>
+	return alloc_sockfd(r);
+  801c78:	e8 55 ff ff ff       	call   801bd2 <alloc_sockfd>
+  801c7d:	89 c3                	mov    %eax,%ebx
+}
+  801c7f:	89 d8                	mov    %ebx,%eax
+  801c81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c84:	5b                   	pop    %ebx
+  801c85:	5e                   	pop    %esi
+  801c86:	5d                   	pop    %ebp
+  801c87:	c3                   	ret
+
+00801c88 <bind>:
+{
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c91:	e8 e0 fe ff ff       	call   801b76 <fd2sockid>
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	78 12                	js     801cac <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c9a:	83 ec 04             	sub    $0x4,%esp
+  801c9d:	ff 75 10             	push   0x10(%ebp)
+  801ca0:	ff 75 0c             	push   0xc(%ebp)
+  801ca3:	50                   	push   %eax
+  801ca4:	e8 85 03 00 00       	call   80202e <nsipc_bind>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+}
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+
+00801cae <shutdown>:
+{
+  801cae:	55                   	push   %ebp
+  801caf:	89 e5                	mov    %esp,%ebp
+  801cb1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb7:	e8 ba fe ff ff       	call   801b76 <fd2sockid>
+  801cbc:	85 c0                	test   %eax,%eax
+  801cbe:	78 0f                	js     801ccf <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801cc0:	83 ec 08             	sub    $0x8,%esp
+  801cc3:	ff 75 0c             	push   0xc(%ebp)
+  801cc6:	50                   	push   %eax
+  801cc7:	e8 97 03 00 00       	call   802063 <nsipc_shutdown>
+  801ccc:	83 c4 10             	add    $0x10,%esp
+}
+  801ccf:	c9                   	leave
+  801cd0:	c3                   	ret
+
+00801cd1 <connect>:
+{
+  801cd1:	55                   	push   %ebp
+  801cd2:	89 e5                	mov    %esp,%ebp
+  801cd4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cda:	e8 97 fe ff ff       	call   801b76 <fd2sockid>
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	78 12                	js     801cf5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	ff 75 10             	push   0x10(%ebp)
+  801ce9:	ff 75 0c             	push   0xc(%ebp)
+  801cec:	50                   	push   %eax
+  801ced:	e8 ad 03 00 00       	call   80209f <nsipc_connect>
+  801cf2:	83 c4 10             	add    $0x10,%esp
+}
+  801cf5:	c9                   	leave
+  801cf6:	c3                   	ret
+
+00801cf7 <listen>:
+{
+  801cf7:	55                   	push   %ebp
+  801cf8:	89 e5                	mov    %esp,%ebp
+  801cfa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d00:	e8 71 fe ff ff       	call   801b76 <fd2sockid>
+  801d05:	85 c0                	test   %eax,%eax
+  801d07:	78 0f                	js     801d18 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d09:	83 ec 08             	sub    $0x8,%esp
+  801d0c:	ff 75 0c             	push   0xc(%ebp)
+  801d0f:	50                   	push   %eax
+  801d10:	e8 bf 03 00 00       	call   8020d4 <nsipc_listen>
+  801d15:	83 c4 10             	add    $0x10,%esp
+}
+  801d18:	c9                   	leave
+  801d19:	c3                   	ret
+
+00801d1a <sendmsg>:
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	57                   	push   %edi
+  801d1e:	56                   	push   %esi
+  801d1f:	53                   	push   %ebx
+  801d20:	83 ec 0c             	sub    $0xc,%esp
+  801d23:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d26:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801d29:	89 f0                	mov    %esi,%eax
+  801d2b:	e8 46 fe ff ff       	call   801b76 <fd2sockid>
+  801d30:	89 c3                	mov    %eax,%ebx
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 1c                	js     801d52 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801d36:	89 f0                	mov    %esi,%eax
+  801d38:	e8 69 fe ff ff       	call   801ba6 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801d3d:	0b 45 10             	or     0x10(%ebp),%eax
+  801d40:	50                   	push   %eax
+  801d41:	ff 77 0c             	push   0xc(%edi)
+  801d44:	ff 77 08             	push   0x8(%edi)
+  801d47:	53                   	push   %ebx
+  801d48:	e8 7c 04 00 00       	call   8021c9 <nsipc_sendmsg>
+  801d4d:	89 c3                	mov    %eax,%ebx
+  801d4f:	83 c4 10             	add    $0x10,%esp
+}
+  801d52:	89 d8                	mov    %ebx,%eax
+  801d54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d57:	5b                   	pop    %ebx
+  801d58:	5e                   	pop    %esi
+  801d59:	5f                   	pop    %edi
+  801d5a:	5d                   	pop    %ebp
+  801d5b:	c3                   	ret
+
+00801d5c <recvmsg>:
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	57                   	push   %edi
+  801d60:	56                   	push   %esi
+  801d61:	53                   	push   %ebx
+  801d62:	83 ec 0c             	sub    $0xc,%esp
+  801d65:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d68:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d6b:	89 f8                	mov    %edi,%eax
+  801d6d:	e8 04 fe ff ff       	call   801b76 <fd2sockid>
+  801d72:	89 c3                	mov    %eax,%ebx
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	78 2a                	js     801da2 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801d78:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801d7f:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801d86:	89 f8                	mov    %edi,%eax
+  801d88:	e8 19 fe ff ff       	call   801ba6 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801d8d:	0b 45 10             	or     0x10(%ebp),%eax
+  801d90:	50                   	push   %eax
+  801d91:	ff 76 0c             	push   0xc(%esi)
+  801d94:	ff 76 08             	push   0x8(%esi)
+  801d97:	53                   	push   %ebx
+  801d98:	e8 d6 07 00 00       	call   802573 <nsipc_recvmsg>
+  801d9d:	89 c3                	mov    %eax,%ebx
+  801d9f:	83 c4 10             	add    $0x10,%esp
+}
+  801da2:	89 d8                	mov    %ebx,%eax
+  801da4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da7:	5b                   	pop    %ebx
+  801da8:	5e                   	pop    %esi
+  801da9:	5f                   	pop    %edi
+  801daa:	5d                   	pop    %ebp
+  801dab:	c3                   	ret
+
+00801dac <sendfile>:
+{
+  801dac:	55                   	push   %ebp
+  801dad:	89 e5                	mov    %esp,%ebp
+  801daf:	56                   	push   %esi
+  801db0:	53                   	push   %ebx
+  801db1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801db4:	89 f0                	mov    %esi,%eax
+  801db6:	e8 bb fd ff ff       	call   801b76 <fd2sockid>
+  801dbb:	89 c3                	mov    %eax,%ebx
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 1f                	js     801de0 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801dc1:	89 f0                	mov    %esi,%eax
+  801dc3:	e8 de fd ff ff       	call   801ba6 <sock_flags>
+  801dc8:	83 ec 0c             	sub    $0xc,%esp
+  801dcb:	50                   	push   %eax
+  801dcc:	ff 75 14             	push   0x14(%ebp)
+  801dcf:	ff 75 10             	push   0x10(%ebp)
+  801dd2:	ff 75 0c             	push   0xc(%ebp)
+  801dd5:	53                   	push   %ebx
+  801dd6:	e8 64 06 00 00       	call   80243f <nsipc_sendfile>
+  801ddb:	89 c3                	mov    %eax,%ebx
+  801ddd:	83 c4 20             	add    $0x20,%esp
+}
+  801de0:	89 d8                	mov    %ebx,%eax
+  801de2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de5:	5b                   	pop    %ebx
+  801de6:	5e                   	pop    %esi
+  801de7:	5d                   	pop    %ebp
+  801de8:	c3                   	ret
+
+00801de9 <evctl>:
+{
+  801de9:	55                   	push   %ebp
+  801dea:	89 e5                	mov    %esp,%ebp
+  801dec:	53                   	push   %ebx
+  801ded:	83 ec 04             	sub    $0x4,%esp
+  801df0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801df3:	89 d8                	mov    %ebx,%eax
+  801df5:	e8 7c fd ff ff       	call   801b76 <fd2sockid>
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	78 10                	js     801e0e <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801dfe:	83 ec 04             	sub    $0x4,%esp
+  801e01:	53                   	push   %ebx
+  801e02:	ff 75 0c             	push   0xc(%ebp)
+  801e05:	50                   	push   %eax
+  801e06:	e8 d2 0b 00 00       	call   8029dd <nsipc_evctl>
+  801e0b:	83 c4 10             	add    $0x10,%esp
+}
+  801e0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e11:	c9                   	leave
+  801e12:	c3                   	ret
+
+00801e13 <evwait>:
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801e19:	ff 75 10             	push   0x10(%ebp)
+  801e1c:	ff 75 0c             	push   0xc(%ebp)
+  801e1f:	ff 75 08             	push   0x8(%ebp)
+  801e22:	e8 e0 0b 00 00       	call   802a07 <nsipc_evwait>
+}
+  801e27:	c9                   	leave
+  801e28:	c3                   	ret
+
+00801e29 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e2f:	ff 75 10             	push   0x10(%ebp)
+  801e32:	ff 75 0c             	push   0xc(%ebp)
+  801e35:	ff 75 08             	push   0x8(%ebp)
+  801e38:	e8 31 0c 00 00       	call   802a6e <nsipc_socket>
+  801e3d:	83 c4 10             	add    $0x10,%esp
+  801e40:	85 c0                	test   %eax,%eax
+  801e42:	78 05                	js     801e49 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e44:	e8 89 fd ff ff       	call   801bd2 <alloc_sockfd>
+}
+  801e49:	c9                   	leave
+  801e4a:	c3                   	ret
+
+00801e4b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e4b:	55                   	push   %ebp
+  801e4c:	89 e5                	mov    %esp,%ebp
+  801e4e:	53                   	push   %ebx
+  801e4f:	83 ec 04             	sub    $0x4,%esp
+  801e52:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801e54:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801e5b:	74 26                	je     801e83 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e5d:	6a 07                	push   $0x7
+  801e5f:	68 00 70 80 00       	push   $0x807000
+  801e64:	53                   	push   %ebx
+  801e65:	ff 35 24 53 80 00    	push   0x805324
+  801e6b:	e8 58 19 00 00       	call   8037c8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e70:	83 c4 0c             	add    $0xc,%esp
+  801e73:	6a 00                	push   $0x0
+  801e75:	6a 00                	push   $0x0
+  801e77:	6a 00                	push   $0x0
+  801e79:	e8 ba 16 00 00       	call   803538 <ipc_recv>
+}
+  801e7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e81:	c9                   	leave
+  801e82:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e83:	83 ec 0c             	sub    $0xc,%esp
+  801e86:	6a 03                	push   $0x3
+  801e88:	e8 a4 19 00 00       	call   803831 <ipc_find_env>
+  801e8d:	a3 24 53 80 00       	mov    %eax,0x805324
+  801e92:	83 c4 10             	add    $0x10,%esp
+  801e95:	eb c6                	jmp    801e5d <nsipc+0x12>
+
+00801e97 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801e97:	55                   	push   %ebp
+  801e98:	89 e5                	mov    %esp,%ebp
+  801e9a:	56                   	push   %esi
+  801e9b:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801e9c:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  801ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801ea7:	85 f6                	test   %esi,%esi
+  801ea9:	75 33                	jne    801ede <nsbulk_map+0x47>
+  801eab:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801eb0:	83 ec 04             	sub    $0x4,%esp
+  801eb3:	6a 07                	push   $0x7
+  801eb5:	53                   	push   %ebx
+  801eb6:	6a 00                	push   $0x0
+  801eb8:	e8 fa ed ff ff       	call   800cb7 <sys_page_alloc>
+  801ebd:	83 c4 10             	add    $0x10,%esp
+  801ec0:	85 c0                	test   %eax,%eax
+  801ec2:	78 1a                	js     801ede <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801ec4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801eca:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801ed0:	75 de                	jne    801eb0 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801ed2:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  801ed9:	00 00 00 
+	return 0;
+  801edc:	89 f0                	mov    %esi,%eax
+}
+  801ede:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee1:	5b                   	pop    %ebx
+  801ee2:	5e                   	pop    %esi
+  801ee3:	5d                   	pop    %ebp
+  801ee4:	c3                   	ret
+
+00801ee5 <nsbulk_own>:
+{
+  801ee5:	55                   	push   %ebp
+  801ee6:	89 e5                	mov    %esp,%ebp
+  801ee8:	57                   	push   %edi
+  801ee9:	56                   	push   %esi
+  801eea:	53                   	push   %ebx
+  801eeb:	83 ec 0c             	sub    $0xc,%esp
+  801eee:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801ef0:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801ef3:	85 d2                	test   %edx,%edx
+  801ef5:	7f 0e                	jg     801f05 <nsbulk_own+0x20>
+	return 0;
+  801ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efc:	eb 47                	jmp    801f45 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801efe:	83 c3 01             	add    $0x1,%ebx
+  801f01:	39 fb                	cmp    %edi,%ebx
+  801f03:	7d 3b                	jge    801f40 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801f05:	be 01 00 00 00       	mov    $0x1,%esi
+  801f0a:	89 d9                	mov    %ebx,%ecx
+  801f0c:	d3 e6                	shl    %cl,%esi
+  801f0e:	89 f0                	mov    %esi,%eax
+  801f10:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  801f16:	74 e6                	je     801efe <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801f18:	83 ec 04             	sub    $0x4,%esp
+  801f1b:	6a 07                	push   $0x7
+  801f1d:	89 d8                	mov    %ebx,%eax
+  801f1f:	c1 e0 0c             	shl    $0xc,%eax
+  801f22:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801f27:	50                   	push   %eax
+  801f28:	6a 00                	push   $0x0
+  801f2a:	e8 88 ed ff ff       	call   800cb7 <sys_page_alloc>
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	78 0f                	js     801f45 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801f36:	f7 d6                	not    %esi
+  801f38:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801f3e:	eb be                	jmp    801efe <nsbulk_own+0x19>
+	return 0;
+  801f40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f48:	5b                   	pop    %ebx
+  801f49:	5e                   	pop    %esi
+  801f4a:	5f                   	pop    %edi
+  801f4b:	5d                   	pop    %ebp
+  801f4c:	c3                   	ret
+
+00801f4d <nsipc_bulk>:
+{
+  801f4d:	55                   	push   %ebp
+  801f4e:	89 e5                	mov    %esp,%ebp
+  801f50:	57                   	push   %edi
+  801f51:	56                   	push   %esi
+  801f52:	53                   	push   %ebx
+  801f53:	83 ec 1c             	sub    $0x1c,%esp
+  801f56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f59:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801f5b:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801f61:	c1 fb 0c             	sar    $0xc,%ebx
+  801f64:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  801f67:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801f6e:	74 56                	je     801fc6 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801f70:	85 ff                	test   %edi,%edi
+  801f72:	7e 24                	jle    801f98 <nsipc_bulk+0x4b>
+  801f74:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801f7a:	74 1c                	je     801f98 <nsipc_bulk+0x4b>
+  801f7c:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801f82:	c1 e3 0c             	shl    $0xc,%ebx
+  801f85:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801f8a:	0f b6 10             	movzbl (%eax),%edx
+  801f8d:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801f8f:	05 00 10 00 00       	add    $0x1000,%eax
+  801f94:	39 d8                	cmp    %ebx,%eax
+  801f96:	75 f2                	jne    801f8a <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801f98:	83 ec 0c             	sub    $0xc,%esp
+  801f9b:	56                   	push   %esi
+  801f9c:	57                   	push   %edi
+  801f9d:	68 00 00 00 e0       	push   $0xe0000000
+  801fa2:	ff 75 e4             	push   -0x1c(%ebp)
+  801fa5:	ff 35 24 53 80 00    	push   0x805324
+  801fab:	e8 4c 18 00 00       	call   8037fc <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801fb0:	83 c4 1c             	add    $0x1c,%esp
+  801fb3:	6a 00                	push   $0x0
+  801fb5:	6a 00                	push   $0x0
+  801fb7:	6a 00                	push   $0x0
+  801fb9:	e8 7a 15 00 00       	call   803538 <ipc_recv>
+}
+  801fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc1:	5b                   	pop    %ebx
+  801fc2:	5e                   	pop    %esi
+  801fc3:	5f                   	pop    %edi
+  801fc4:	5d                   	pop    %ebp
+  801fc5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801fc6:	83 ec 0c             	sub    $0xc,%esp
+  801fc9:	6a 03                	push   $0x3
+  801fcb:	e8 61 18 00 00       	call   803831 <ipc_find_env>
+  801fd0:	a3 24 53 80 00       	mov    %eax,0x805324
+  801fd5:	83 c4 10             	add    $0x10,%esp
+  801fd8:	eb 96                	jmp    801f70 <nsipc_bulk+0x23>
+
+00801fda <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  801fda:	55                   	push   %ebp
+  801fdb:	89 e5                	mov    %esp,%ebp
+  801fdd:	53                   	push   %ebx
+  801fde:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801fe1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  801fe9:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fec:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ff1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff6:	e8 50 fe ff ff       	call   801e4b <nsipc>
+  801ffb:	89 c3                	mov    %eax,%ebx
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	79 07                	jns    802008 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802001:	89 d8                	mov    %ebx,%eax
+  802003:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802006:	c9                   	leave
+  802007:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802008:	83 ec 04             	sub    $0x4,%esp
+  80200b:	ff 35 10 70 80 00    	push   0x807010
+  802011:	68 00 70 80 00       	push   $0x807000
+  802016:	ff 75 0c             	push   0xc(%ebp)
+  802019:	e8 15 ea ff ff       	call   800a33 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80201e:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802024:	8b 45 10             	mov    0x10(%ebp),%eax
+  802027:	89 10                	mov    %edx,(%eax)
+  802029:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80202c:	eb d3                	jmp    802001 <nsipc_accept+0x27>
+
+0080202e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	53                   	push   %ebx
+  802032:	83 ec 08             	sub    $0x8,%esp
+  802035:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802038:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203b:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802040:	53                   	push   %ebx
+  802041:	ff 75 0c             	push   0xc(%ebp)
+  802044:	68 04 70 80 00       	push   $0x807004
+  802049:	e8 e5 e9 ff ff       	call   800a33 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80204e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802054:	b8 02 00 00 00       	mov    $0x2,%eax
+  802059:	e8 ed fd ff ff       	call   801e4b <nsipc>
+}
+  80205e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802061:	c9                   	leave
+  802062:	c3                   	ret
+
+00802063 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802063:	55                   	push   %ebp
+  802064:	89 e5                	mov    %esp,%ebp
+  802066:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802069:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802071:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802074:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802079:	b8 03 00 00 00       	mov    $0x3,%eax
+  80207e:	e8 c8 fd ff ff       	call   801e4b <nsipc>
+}
+  802083:	c9                   	leave
+  802084:	c3                   	ret
+
+00802085 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80208b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208e:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802093:	b8 04 00 00 00       	mov    $0x4,%eax
+  802098:	e8 ae fd ff ff       	call   801e4b <nsipc>
+}
+  80209d:	c9                   	leave
+  80209e:	c3                   	ret
+
+0080209f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80209f:	55                   	push   %ebp
+  8020a0:	89 e5                	mov    %esp,%ebp
+  8020a2:	53                   	push   %ebx
+  8020a3:	83 ec 08             	sub    $0x8,%esp
+  8020a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8020a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ac:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8020b1:	53                   	push   %ebx
+  8020b2:	ff 75 0c             	push   0xc(%ebp)
+  8020b5:	68 04 70 80 00       	push   $0x807004
+  8020ba:	e8 74 e9 ff ff       	call   800a33 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8020bf:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8020c5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020ca:	e8 7c fd ff ff       	call   801e4b <nsipc>
+}
+  8020cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d2:	c9                   	leave
+  8020d3:	c3                   	ret
+
+008020d4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8020da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020dd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8020e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020e5:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8020ea:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020ef:	e8 57 fd ff ff       	call   801e4b <nsipc>
+}
+  8020f4:	c9                   	leave
+  8020f5:	c3                   	ret
+
+008020f6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	56                   	push   %esi
+  8020fa:	53                   	push   %ebx
+  8020fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8020fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802101:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802106:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80210c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80210f:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802114:	b8 07 00 00 00       	mov    $0x7,%eax
+  802119:	e8 2d fd ff ff       	call   801e4b <nsipc>
+  80211e:	89 c3                	mov    %eax,%ebx
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 22                	js     802146 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802124:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802129:	39 c6                	cmp    %eax,%esi
+  80212b:	0f 4e c6             	cmovle %esi,%eax
+  80212e:	39 c3                	cmp    %eax,%ebx
+  802130:	7f 1d                	jg     80214f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802132:	83 ec 04             	sub    $0x4,%esp
+  802135:	53                   	push   %ebx
+  802136:	68 00 70 80 00       	push   $0x807000
+  80213b:	ff 75 0c             	push   0xc(%ebp)
+  80213e:	e8 f0 e8 ff ff       	call   800a33 <memmove>
+  802143:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5d                   	pop    %ebp
+  80214e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80214f:	68 d4 3e 80 00       	push   $0x803ed4
+  802154:	68 e9 3e 80 00       	push   $0x803ee9
+  802159:	68 b2 00 00 00       	push   $0xb2
+  80215e:	68 fe 3e 80 00       	push   $0x803efe
+  802163:	e8 8a 13 00 00       	call   8034f2 <_panic>
+
+00802168 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802168:	55                   	push   %ebp
+  802169:	89 e5                	mov    %esp,%ebp
+  80216b:	53                   	push   %ebx
+  80216c:	83 ec 04             	sub    $0x4,%esp
+  80216f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802172:	8b 45 08             	mov    0x8(%ebp),%eax
+  802175:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80217a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802180:	7f 2e                	jg     8021b0 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802182:	83 ec 04             	sub    $0x4,%esp
+  802185:	53                   	push   %ebx
+  802186:	ff 75 0c             	push   0xc(%ebp)
+  802189:	68 0c 70 80 00       	push   $0x80700c
+  80218e:	e8 a0 e8 ff ff       	call   800a33 <memmove>
+	nsipcbuf.send.req_size = size;
+  802193:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802199:	8b 45 14             	mov    0x14(%ebp),%eax
+  80219c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8021a1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021a6:	e8 a0 fc ff ff       	call   801e4b <nsipc>
+}
+  8021ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ae:	c9                   	leave
+  8021af:	c3                   	ret
+	assert(size < 1600);
+  8021b0:	68 0a 3f 80 00       	push   $0x803f0a
+  8021b5:	68 e9 3e 80 00       	push   $0x803ee9
+  8021ba:	68 bd 00 00 00       	push   $0xbd
+  8021bf:	68 fe 3e 80 00       	push   $0x803efe
+  8021c4:	e8 29 13 00 00       	call   8034f2 <_panic>
+
+008021c9 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8021c9:	55                   	push   %ebp
+  8021ca:	89 e5                	mov    %esp,%ebp
+  8021cc:	57                   	push   %edi
+  8021cd:	56                   	push   %esi
+  8021ce:	53                   	push   %ebx
+  8021cf:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8021d2:	e8 c0 fc ff ff       	call   801e97 <nsbulk_map>
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 55                	js     802230 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8021db:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8021e2:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8021e9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8021f0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8021f3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8021f6:	0f 8d 24 02 00 00    	jge    802420 <nsipc_sendmsg+0x257>
+  8021fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021ff:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802202:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802205:	89 d8                	mov    %ebx,%eax
+  802207:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80220c:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80220e:	83 ec 0c             	sub    $0xc,%esp
+  802211:	68 20 50 80 00       	push   $0x805020
+  802216:	e8 5a 0f 00 00       	call   803175 <pgbatch_init>
+  80221b:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80221e:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802220:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802223:	e9 82 00 00 00       	jmp    8022aa <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802228:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80222b:	85 db                	test   %ebx,%ebx
+  80222d:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802233:	5b                   	pop    %ebx
+  802234:	5e                   	pop    %esi
+  802235:	5f                   	pop    %edi
+  802236:	5d                   	pop    %ebp
+  802237:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802238:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80223d:	29 c8                	sub    %ecx,%eax
+  80223f:	39 d0                	cmp    %edx,%eax
+  802241:	0f 46 d0             	cmovbe %eax,%edx
+  802244:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802246:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80224c:	85 ff                	test   %edi,%edi
+  80224e:	0f 49 c7             	cmovns %edi,%eax
+  802251:	c1 f8 0c             	sar    $0xc,%eax
+  802254:	ba 01 00 00 00       	mov    $0x1,%edx
+  802259:	e8 87 fc ff ff       	call   801ee5 <nsbulk_own>
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	0f 88 17 01 00 00    	js     80237d <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802266:	83 ec 04             	sub    $0x4,%esp
+  802269:	56                   	push   %esi
+  80226a:	ff 75 e0             	push   -0x20(%ebp)
+  80226d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802270:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802275:	50                   	push   %eax
+  802276:	e8 b8 e7 ff ff       	call   800a33 <memmove>
+  80227b:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80227e:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802281:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802284:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802287:	0f 84 fd 00 00 00    	je     80238a <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80228d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802290:	01 f7                	add    %esi,%edi
+  802292:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802295:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802298:	0f 8d 01 01 00 00    	jge    80239f <nsipc_sendmsg+0x1d6>
+  80229e:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8022a4:	0f 8f f0 00 00 00    	jg     80239a <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8022aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ad:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8022b0:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8022b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022b6:	89 c2                	mov    %eax,%edx
+  8022b8:	03 13                	add    (%ebx),%edx
+  8022ba:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8022bd:	8b 73 04             	mov    0x4(%ebx),%esi
+  8022c0:	29 c6                	sub    %eax,%esi
+  8022c2:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8022c7:	29 f9                	sub    %edi,%ecx
+  8022c9:	39 ce                	cmp    %ecx,%esi
+  8022cb:	89 ca                	mov    %ecx,%edx
+  8022cd:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8022d0:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8022d3:	89 f9                	mov    %edi,%ecx
+  8022d5:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8022db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8022de:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022e3:	09 c8                	or     %ecx,%eax
+  8022e5:	0f 85 4d ff ff ff    	jne    802238 <nsipc_sendmsg+0x6f>
+  8022eb:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8022f1:	0f 86 41 ff ff ff    	jbe    802238 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8022f7:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8022fd:	85 ff                	test   %edi,%edi
+  8022ff:	0f 49 c7             	cmovns %edi,%eax
+  802302:	c1 f8 0c             	sar    $0xc,%eax
+  802305:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802307:	89 d1                	mov    %edx,%ecx
+  802309:	c1 e9 0c             	shr    $0xc,%ecx
+  80230c:	01 c8                	add    %ecx,%eax
+  80230e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802311:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802314:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802316:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802319:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80231e:	29 c8                	sub    %ecx,%eax
+  802320:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802323:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802326:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802328:	b8 01 00 00 00       	mov    $0x1,%eax
+  80232d:	89 f9                	mov    %edi,%ecx
+  80232f:	d3 e0                	shl    %cl,%eax
+  802331:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802337:	83 ec 08             	sub    $0x8,%esp
+  80233a:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80233c:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80233f:	50                   	push   %eax
+  802340:	6a 00                	push   $0x0
+  802342:	56                   	push   %esi
+  802343:	6a 00                	push   $0x0
+  802345:	68 20 50 80 00       	push   $0x805020
+  80234a:	e8 e4 0e 00 00       	call   803233 <pgbatch_map>
+  80234f:	83 c4 20             	add    $0x20,%esp
+  802352:	85 c0                	test   %eax,%eax
+  802354:	0f 88 ce fe ff ff    	js     802228 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80235a:	83 c7 01             	add    $0x1,%edi
+  80235d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802363:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802366:	39 c7                	cmp    %eax,%edi
+  802368:	75 be                	jne    802328 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80236a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80236d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802370:	89 d6                	mov    %edx,%esi
+  802372:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802378:	e9 01 ff ff ff       	jmp    80227e <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80237d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802380:	85 db                	test   %ebx,%ebx
+  802382:	0f 45 c3             	cmovne %ebx,%eax
+  802385:	e9 a6 fe ff ff       	jmp    802230 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80238a:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80238e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802395:	e9 f3 fe ff ff       	jmp    80228d <nsipc_sendmsg+0xc4>
+  80239a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80239d:	eb 03                	jmp    8023a2 <nsipc_sendmsg+0x1d9>
+  80239f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8023a2:	83 ec 0c             	sub    $0xc,%esp
+  8023a5:	68 20 50 80 00       	push   $0x805020
+  8023aa:	e8 d4 0d 00 00       	call   803183 <pgbatch_flush>
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 50                	js     802406 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8023b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b9:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8023be:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8023c4:	89 fb                	mov    %edi,%ebx
+  8023c6:	29 f3                	sub    %esi,%ebx
+  8023c8:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8023ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023d1:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8023d6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8023db:	89 fa                	mov    %edi,%edx
+  8023dd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8023e2:	e8 66 fb ff ff       	call   801f4d <nsipc_bulk>
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	78 28                	js     802413 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8023eb:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8023ee:	39 c3                	cmp    %eax,%ebx
+  8023f0:	75 0c                	jne    8023fe <nsipc_sendmsg+0x235>
+  8023f2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023f5:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8023f8:	0f 8f f2 fd ff ff    	jg     8021f0 <nsipc_sendmsg+0x27>
+		sent += r;
+  8023fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802401:	e9 2a fe ff ff       	jmp    802230 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802406:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802409:	85 db                	test   %ebx,%ebx
+  80240b:	0f 45 c3             	cmovne %ebx,%eax
+  80240e:	e9 1d fe ff ff       	jmp    802230 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802413:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802416:	85 db                	test   %ebx,%ebx
+  802418:	0f 45 c3             	cmovne %ebx,%eax
+  80241b:	e9 10 fe ff ff       	jmp    802230 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802420:	83 ec 0c             	sub    $0xc,%esp
+  802423:	68 20 50 80 00       	push   $0x805020
+  802428:	e8 48 0d 00 00       	call   803175 <pgbatch_init>
+  80242d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802430:	be 00 00 00 00       	mov    $0x0,%esi
+  802435:	bf 00 00 00 00       	mov    $0x0,%edi
+  80243a:	e9 63 ff ff ff       	jmp    8023a2 <nsipc_sendmsg+0x1d9>
+
+0080243f <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80243f:	55                   	push   %ebp
+  802440:	89 e5                	mov    %esp,%ebp
+  802442:	57                   	push   %edi
+  802443:	56                   	push   %esi
+  802444:	53                   	push   %ebx
+  802445:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802448:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  80244f:	0f 84 c8 00 00 00    	je     80251d <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802455:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80245c:	0f 84 e4 00 00 00    	je     802546 <nsipc_sendfile+0x107>
+{
+  802462:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802467:	89 fb                	mov    %edi,%ebx
+  802469:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80246c:	0f 83 f0 00 00 00    	jae    802562 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802472:	89 fa                	mov    %edi,%edx
+  802474:	03 55 10             	add    0x10(%ebp),%edx
+  802477:	89 d0                	mov    %edx,%eax
+  802479:	c1 f8 1f             	sar    $0x1f,%eax
+  80247c:	c1 e8 14             	shr    $0x14,%eax
+  80247f:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802482:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802488:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80248a:	6a 10                	push   $0x10
+  80248c:	68 00 20 01 e0       	push   $0xe0012000
+  802491:	52                   	push   %edx
+  802492:	ff 75 0c             	push   0xc(%ebp)
+  802495:	e8 fe f4 ff ff       	call   801998 <fmap>
+  80249a:	83 c4 10             	add    $0x10,%esp
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	0f 8e b8 00 00 00    	jle    80255d <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8024a5:	39 c6                	cmp    %eax,%esi
+  8024a7:	0f 8d b5 00 00 00    	jge    802562 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8024ad:	29 f0                	sub    %esi,%eax
+  8024af:	8b 55 14             	mov    0x14(%ebp),%edx
+  8024b2:	29 da                	sub    %ebx,%edx
+  8024b4:	39 d0                	cmp    %edx,%eax
+  8024b6:	89 d3                	mov    %edx,%ebx
+  8024b8:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8024bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024be:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8024c3:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8024c9:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8024cf:	8b 45 18             	mov    0x18(%ebp),%eax
+  8024d2:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8024d7:	83 ec 0c             	sub    $0xc,%esp
+  8024da:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8024dc:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8024e3:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8024e6:	83 c0 01             	add    $0x1,%eax
+  8024e9:	50                   	push   %eax
+  8024ea:	68 00 10 01 e0       	push   $0xe0011000
+  8024ef:	6a 11                	push   $0x11
+  8024f1:	ff 35 24 53 80 00    	push   0x805324
+  8024f7:	e8 00 13 00 00       	call   8037fc <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8024fc:	83 c4 1c             	add    $0x1c,%esp
+  8024ff:	6a 00                	push   $0x0
+  802501:	6a 00                	push   $0x0
+  802503:	6a 00                	push   $0x0
+  802505:	e8 2e 10 00 00       	call   803538 <ipc_recv>
+  80250a:	83 c4 10             	add    $0x10,%esp
+  80250d:	85 c0                	test   %eax,%eax
+  80250f:	78 5b                	js     80256c <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802511:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802513:	39 c3                	cmp    %eax,%ebx
+  802515:	0f 8e 4c ff ff ff    	jle    802467 <nsipc_sendfile+0x28>
+  80251b:	eb 45                	jmp    802562 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80251d:	83 ec 04             	sub    $0x4,%esp
+  802520:	6a 07                	push   $0x7
+  802522:	68 00 10 01 e0       	push   $0xe0011000
+  802527:	6a 00                	push   $0x0
+  802529:	e8 89 e7 ff ff       	call   800cb7 <sys_page_alloc>
+  80252e:	89 c7                	mov    %eax,%edi
+  802530:	83 c4 10             	add    $0x10,%esp
+  802533:	85 c0                	test   %eax,%eax
+  802535:	78 2b                	js     802562 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802537:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  80253e:	00 00 00 
+  802541:	e9 0f ff ff ff       	jmp    802455 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802546:	83 ec 0c             	sub    $0xc,%esp
+  802549:	6a 03                	push   $0x3
+  80254b:	e8 e1 12 00 00       	call   803831 <ipc_find_env>
+  802550:	a3 24 53 80 00       	mov    %eax,0x805324
+  802555:	83 c4 10             	add    $0x10,%esp
+  802558:	e9 05 ff ff ff       	jmp    802462 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80255d:	85 ff                	test   %edi,%edi
+  80255f:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802562:	89 f8                	mov    %edi,%eax
+  802564:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802567:	5b                   	pop    %ebx
+  802568:	5e                   	pop    %esi
+  802569:	5f                   	pop    %edi
+  80256a:	5d                   	pop    %ebp
+  80256b:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80256c:	85 ff                	test   %edi,%edi
+  80256e:	0f 44 f8             	cmove  %eax,%edi
+  802571:	eb ef                	jmp    802562 <nsipc_sendfile+0x123>
+
+00802573 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802573:	55                   	push   %ebp
+  802574:	89 e5                	mov    %esp,%ebp
+  802576:	57                   	push   %edi
+  802577:	56                   	push   %esi
+  802578:	53                   	push   %ebx
+  802579:	83 ec 1c             	sub    $0x1c,%esp
+  80257c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80257f:	e8 13 f9 ff ff       	call   801e97 <nsbulk_map>
+  802584:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802587:	85 c0                	test   %eax,%eax
+  802589:	0f 88 ba 00 00 00    	js     802649 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80258f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802593:	0f 8e bb 00 00 00    	jle    802654 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802599:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80259e:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8025a3:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8025a8:	89 f8                	mov    %edi,%eax
+  8025aa:	29 f0                	sub    %esi,%eax
+  8025ac:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8025b0:	39 c8                	cmp    %ecx,%eax
+  8025b2:	0f 47 c1             	cmova  %ecx,%eax
+  8025b5:	01 f0                	add    %esi,%eax
+  8025b7:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8025b9:	83 c2 01             	add    $0x1,%edx
+  8025bc:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8025bf:	7e 07                	jle    8025c8 <nsipc_recvmsg+0x55>
+  8025c1:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8025c6:	7e e0                	jle    8025a8 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8025c8:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8025ce:	c1 fa 0c             	sar    $0xc,%edx
+  8025d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d6:	e8 0a f9 ff ff       	call   801ee5 <nsbulk_own>
+  8025db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 67                	js     802649 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8025e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e5:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8025ea:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8025f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025f3:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8025f8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8025fd:	89 f2                	mov    %esi,%edx
+  8025ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802604:	e8 44 f9 ff ff       	call   801f4d <nsipc_bulk>
+  802609:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	78 39                	js     802649 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802610:	39 f0                	cmp    %esi,%eax
+  802612:	7f 4a                	jg     80265e <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802614:	bf 00 00 00 00       	mov    $0x0,%edi
+  802619:	85 c0                	test   %eax,%eax
+  80261b:	7e 2c                	jle    802649 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80261d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802620:	29 fe                	sub    %edi,%esi
+  802622:	8b 43 04             	mov    0x4(%ebx),%eax
+  802625:	39 c6                	cmp    %eax,%esi
+  802627:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80262a:	83 ec 04             	sub    $0x4,%esp
+  80262d:	56                   	push   %esi
+  80262e:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802634:	50                   	push   %eax
+  802635:	ff 33                	push   (%ebx)
+  802637:	e8 f7 e3 ff ff       	call   800a33 <memmove>
+		n += m;
+  80263c:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80263e:	83 c3 08             	add    $0x8,%ebx
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802647:	7f d4                	jg     80261d <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802649:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80264c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264f:	5b                   	pop    %ebx
+  802650:	5e                   	pop    %esi
+  802651:	5f                   	pop    %edi
+  802652:	5d                   	pop    %ebp
+  802653:	c3                   	ret
+	int r, i, n, len = 0;
+  802654:	be 00 00 00 00       	mov    $0x0,%esi
+  802659:	e9 6a ff ff ff       	jmp    8025c8 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80265e:	68 e0 3e 80 00       	push   $0x803ee0
+  802663:	68 e9 3e 80 00       	push   $0x803ee9
+  802668:	68 3b 01 00 00       	push   $0x13b
+  80266d:	68 fe 3e 80 00       	push   $0x803efe
+  802672:	e8 7b 0e 00 00       	call   8034f2 <_panic>
+
+00802677 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802677:	55                   	push   %ebp
+  802678:	89 e5                	mov    %esp,%ebp
+  80267a:	57                   	push   %edi
+  80267b:	56                   	push   %esi
+  80267c:	53                   	push   %ebx
+  80267d:	83 ec 0c             	sub    $0xc,%esp
+  802680:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802683:	8b 75 10             	mov    0x10(%ebp),%esi
+  802686:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  802691:	8b 07                	mov    (%edi),%eax
+  802693:	a3 04 70 80 00       	mov    %eax,0x807004
+  802698:	8b 47 04             	mov    0x4(%edi),%eax
+  80269b:	a3 08 70 80 00       	mov    %eax,0x807008
+  8026a0:	8b 47 08             	mov    0x8(%edi),%eax
+  8026a3:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  8026a8:	8b 47 0c             	mov    0xc(%edi),%eax
+  8026ab:	a3 10 70 80 00       	mov    %eax,0x807010
+  8026b0:	8b 47 10             	mov    0x10(%edi),%eax
+  8026b3:	a3 14 70 80 00       	mov    %eax,0x807014
+  8026b8:	8b 47 14             	mov    0x14(%edi),%eax
+  8026bb:	a3 18 70 80 00       	mov    %eax,0x807018
+  8026c0:	8b 47 18             	mov    0x18(%edi),%eax
+  8026c3:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  8026c8:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8026cb:	a3 20 70 80 00       	mov    %eax,0x807020
+  8026d0:	8b 47 20             	mov    0x20(%edi),%eax
+  8026d3:	a3 24 70 80 00       	mov    %eax,0x807024
+  8026d8:	8b 47 24             	mov    0x24(%edi),%eax
+  8026db:	a3 28 70 80 00       	mov    %eax,0x807028
+  8026e0:	8b 47 28             	mov    0x28(%edi),%eax
+  8026e3:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  8026e8:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8026eb:	a3 30 70 80 00       	mov    %eax,0x807030
+  8026f0:	8b 47 30             	mov    0x30(%edi),%eax
+  8026f3:	a3 34 70 80 00       	mov    %eax,0x807034
+  8026f8:	8b 47 34             	mov    0x34(%edi),%eax
+  8026fb:	a3 38 70 80 00       	mov    %eax,0x807038
+  802700:	8b 47 38             	mov    0x38(%edi),%eax
+  802703:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  802708:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80270b:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  802710:	8b 06                	mov    (%esi),%eax
+  802712:	a3 44 70 80 00       	mov    %eax,0x807044
+  802717:	8b 46 04             	mov    0x4(%esi),%eax
+  80271a:	a3 48 70 80 00       	mov    %eax,0x807048
+  80271f:	8b 46 08             	mov    0x8(%esi),%eax
+  802722:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  802727:	8b 46 0c             	mov    0xc(%esi),%eax
+  80272a:	a3 50 70 80 00       	mov    %eax,0x807050
+  80272f:	8b 46 10             	mov    0x10(%esi),%eax
+  802732:	a3 54 70 80 00       	mov    %eax,0x807054
+  802737:	8b 46 14             	mov    0x14(%esi),%eax
+  80273a:	a3 58 70 80 00       	mov    %eax,0x807058
+  80273f:	8b 46 18             	mov    0x18(%esi),%eax
+  802742:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  802747:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80274a:	a3 60 70 80 00       	mov    %eax,0x807060
+  80274f:	8b 46 20             	mov    0x20(%esi),%eax
+  802752:	a3 64 70 80 00       	mov    %eax,0x807064
+  802757:	8b 46 24             	mov    0x24(%esi),%eax
+  80275a:	a3 68 70 80 00       	mov    %eax,0x807068
+  80275f:	8b 46 28             	mov    0x28(%esi),%eax
+  802762:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  802767:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80276a:	a3 70 70 80 00       	mov    %eax,0x807070
+  80276f:	8b 46 30             	mov    0x30(%esi),%eax
+  802772:	a3 74 70 80 00       	mov    %eax,0x807074
+  802777:	8b 46 34             	mov    0x34(%esi),%eax
+  80277a:	a3 78 70 80 00       	mov    %eax,0x807078
+  80277f:	8b 46 38             	mov    0x38(%esi),%eax
+  802782:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  802787:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80278a:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80278f:	8b 03                	mov    (%ebx),%eax
+  802791:	a3 84 70 80 00       	mov    %eax,0x807084
+  802796:	8b 43 04             	mov    0x4(%ebx),%eax
+  802799:	a3 88 70 80 00       	mov    %eax,0x807088
+  80279e:	8b 43 08             	mov    0x8(%ebx),%eax
+  8027a1:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  8027a6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8027a9:	a3 90 70 80 00       	mov    %eax,0x807090
+  8027ae:	8b 43 10             	mov    0x10(%ebx),%eax
+  8027b1:	a3 94 70 80 00       	mov    %eax,0x807094
+  8027b6:	8b 43 14             	mov    0x14(%ebx),%eax
+  8027b9:	a3 98 70 80 00       	mov    %eax,0x807098
+  8027be:	8b 43 18             	mov    0x18(%ebx),%eax
+  8027c1:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  8027c6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8027c9:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  8027ce:	8b 43 20             	mov    0x20(%ebx),%eax
+  8027d1:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  8027d6:	8b 43 24             	mov    0x24(%ebx),%eax
+  8027d9:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  8027de:	8b 43 28             	mov    0x28(%ebx),%eax
+  8027e1:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  8027e6:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8027e9:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  8027ee:	8b 43 30             	mov    0x30(%ebx),%eax
+  8027f1:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  8027f6:	8b 43 34             	mov    0x34(%ebx),%eax
+  8027f9:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  8027fe:	8b 43 38             	mov    0x38(%ebx),%eax
+  802801:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  802806:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802809:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  80280e:	8b 45 18             	mov    0x18(%ebp),%eax
+  802811:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802816:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80281b:	e8 2b f6 ff ff       	call   801e4b <nsipc>
+  802820:	85 c0                	test   %eax,%eax
+  802822:	0f 88 ad 01 00 00    	js     8029d5 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802828:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  80282e:	89 17                	mov    %edx,(%edi)
+  802830:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  802836:	89 57 04             	mov    %edx,0x4(%edi)
+  802839:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  80283f:	89 57 08             	mov    %edx,0x8(%edi)
+  802842:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802848:	89 57 0c             	mov    %edx,0xc(%edi)
+  80284b:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  802851:	89 57 10             	mov    %edx,0x10(%edi)
+  802854:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  80285a:	89 57 14             	mov    %edx,0x14(%edi)
+  80285d:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802863:	89 57 18             	mov    %edx,0x18(%edi)
+  802866:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  80286c:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80286f:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  802875:	89 57 20             	mov    %edx,0x20(%edi)
+  802878:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  80287e:	89 57 24             	mov    %edx,0x24(%edi)
+  802881:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  802887:	89 57 28             	mov    %edx,0x28(%edi)
+  80288a:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  802890:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802893:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  802899:	89 57 30             	mov    %edx,0x30(%edi)
+  80289c:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  8028a2:	89 57 34             	mov    %edx,0x34(%edi)
+  8028a5:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  8028ab:	89 57 38             	mov    %edx,0x38(%edi)
+  8028ae:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  8028b4:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8028b7:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  8028bd:	89 16                	mov    %edx,(%esi)
+  8028bf:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  8028c5:	89 56 04             	mov    %edx,0x4(%esi)
+  8028c8:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  8028ce:	89 56 08             	mov    %edx,0x8(%esi)
+  8028d1:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  8028d7:	89 56 0c             	mov    %edx,0xc(%esi)
+  8028da:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  8028e0:	89 56 10             	mov    %edx,0x10(%esi)
+  8028e3:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  8028e9:	89 56 14             	mov    %edx,0x14(%esi)
+  8028ec:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  8028f2:	89 56 18             	mov    %edx,0x18(%esi)
+  8028f5:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  8028fb:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8028fe:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  802904:	89 56 20             	mov    %edx,0x20(%esi)
+  802907:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  80290d:	89 56 24             	mov    %edx,0x24(%esi)
+  802910:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  802916:	89 56 28             	mov    %edx,0x28(%esi)
+  802919:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  80291f:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802922:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  802928:	89 56 30             	mov    %edx,0x30(%esi)
+  80292b:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  802931:	89 56 34             	mov    %edx,0x34(%esi)
+  802934:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  80293a:	89 56 38             	mov    %edx,0x38(%esi)
+  80293d:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  802943:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802946:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  80294c:	89 13                	mov    %edx,(%ebx)
+  80294e:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  802954:	89 53 04             	mov    %edx,0x4(%ebx)
+  802957:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  80295d:	89 53 08             	mov    %edx,0x8(%ebx)
+  802960:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  802966:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802969:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  80296f:	89 53 10             	mov    %edx,0x10(%ebx)
+  802972:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  802978:	89 53 14             	mov    %edx,0x14(%ebx)
+  80297b:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  802981:	89 53 18             	mov    %edx,0x18(%ebx)
+  802984:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  80298a:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80298d:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  802993:	89 53 20             	mov    %edx,0x20(%ebx)
+  802996:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  80299c:	89 53 24             	mov    %edx,0x24(%ebx)
+  80299f:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  8029a5:	89 53 28             	mov    %edx,0x28(%ebx)
+  8029a8:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  8029ae:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8029b1:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  8029b7:	89 53 30             	mov    %edx,0x30(%ebx)
+  8029ba:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  8029c0:	89 53 34             	mov    %edx,0x34(%ebx)
+  8029c3:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  8029c9:	89 53 38             	mov    %edx,0x38(%ebx)
+  8029cc:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  8029d2:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8029d5:	83 c4 0c             	add    $0xc,%esp
+  8029d8:	5b                   	pop    %ebx
+  8029d9:	5e                   	pop    %esi
+  8029da:	5f                   	pop    %edi
+  8029db:	5d                   	pop    %ebp
+  8029dc:	c3                   	ret
+
+008029dd <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8029dd:	55                   	push   %ebp
+  8029de:	89 e5                	mov    %esp,%ebp
+  8029e0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8029e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  8029eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ee:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  8029f3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029f6:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  8029fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a00:	e8 46 f4 ff ff       	call   801e4b <nsipc>
+}
+  802a05:	c9                   	leave
+  802a06:	c3                   	ret
+
+00802a07 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	56                   	push   %esi
+  802a0b:	53                   	push   %ebx
+  802a0c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802a0f:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802a15:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a18:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802a1d:	b8 10 00 00 00       	mov    $0x10,%eax
+  802a22:	e8 24 f4 ff ff       	call   801e4b <nsipc>
+  802a27:	89 c3                	mov    %eax,%ebx
+  802a29:	85 c0                	test   %eax,%eax
+  802a2b:	7e 1f                	jle    802a4c <nsipc_evwait+0x45>
+		assert(r <= max);
+  802a2d:	39 c6                	cmp    %eax,%esi
+  802a2f:	7c 24                	jl     802a55 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802a31:	83 ec 04             	sub    $0x4,%esp
+  802a34:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802a3b:	50                   	push   %eax
+  802a3c:	68 00 70 80 00       	push   $0x807000
+  802a41:	ff 75 08             	push   0x8(%ebp)
+  802a44:	e8 ea df ff ff       	call   800a33 <memmove>
+  802a49:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a4c:	89 d8                	mov    %ebx,%eax
+  802a4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a51:	5b                   	pop    %ebx
+  802a52:	5e                   	pop    %esi
+  802a53:	5d                   	pop    %ebp
+  802a54:	c3                   	ret
+		assert(r <= max);
+  802a55:	68 16 3f 80 00       	push   $0x803f16
+  802a5a:	68 e9 3e 80 00       	push   $0x803ee9
+  802a5f:	68 6a 01 00 00       	push   $0x16a
+  802a64:	68 fe 3e 80 00       	push   $0x803efe
+  802a69:	e8 84 0a 00 00       	call   8034f2 <_panic>
+
+00802a6e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a6e:	55                   	push   %ebp
+  802a6f:	89 e5                	mov    %esp,%ebp
+  802a71:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a77:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802a7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a7f:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a84:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a87:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802a8c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a91:	e8 b5 f3 ff ff       	call   801e4b <nsipc>
+}
+  802a96:	c9                   	leave
+  802a97:	c3                   	ret
+
+00802a98 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802a98:	55                   	push   %ebp
+  802a99:	89 e5                	mov    %esp,%ebp
+  802a9b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802a9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  802aa6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802aab:	e8 9b f3 ff ff       	call   801e4b <nsipc>
+}
+  802ab0:	c9                   	leave
+  802ab1:	c3                   	ret
+
+00802ab2 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802ab2:	55                   	push   %ebp
+  802ab3:	89 e5                	mov    %esp,%ebp
+  802ab5:	53                   	push   %ebx
+  802ab6:	83 ec 04             	sub    $0x4,%esp
+  802ab9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802abc:	b8 12 00 00 00       	mov    $0x12,%eax
+  802ac1:	e8 85 f3 ff ff       	call   801e4b <nsipc>
+  802ac6:	85 c0                	test   %eax,%eax
+  802ac8:	78 50                	js     802b1a <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802aca:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  802ad0:	89 13                	mov    %edx,(%ebx)
+  802ad2:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  802ad8:	89 53 04             	mov    %edx,0x4(%ebx)
+  802adb:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  802ae1:	89 53 08             	mov    %edx,0x8(%ebx)
+  802ae4:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  802aea:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802aed:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802af3:	89 53 10             	mov    %edx,0x10(%ebx)
+  802af6:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  802afc:	89 53 14             	mov    %edx,0x14(%ebx)
+  802aff:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  802b05:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b08:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802b0e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b11:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802b17:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802b1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b1d:	c9                   	leave
+  802b1e:	c3                   	ret
+
+00802b1f <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802b1f:	55                   	push   %ebp
+  802b20:	89 e5                	mov    %esp,%ebp
+  802b22:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b25:	6a 03                	push   $0x3
+  802b27:	e8 05 0d 00 00       	call   803831 <ipc_find_env>
+  802b2c:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802b31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b34:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802b39:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802b3e:	e8 08 f3 ff ff       	call   801e4b <nsipc>
+  802b43:	83 c4 10             	add    $0x10,%esp
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	78 0a                	js     802b54 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802b4a:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b54:	c9                   	leave
+  802b55:	c3                   	ret
+
+00802b56 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802b56:	55                   	push   %ebp
+  802b57:	89 e5                	mov    %esp,%ebp
+  802b59:	57                   	push   %edi
+  802b5a:	56                   	push   %esi
+  802b5b:	53                   	push   %ebx
+  802b5c:	83 ec 1c             	sub    $0x1c,%esp
+  802b5f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b62:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802b65:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802b6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b6f:	89 e0                	mov    %esp,%eax
+  802b71:	89 f2                	mov    %esi,%edx
+  802b73:	29 c2                	sub    %eax,%edx
+  802b75:	89 d0                	mov    %edx,%eax
+  802b77:	c1 e8 0f             	shr    $0xf,%eax
+  802b7a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802b80:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802b83:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802b8a:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802b8d:	83 ec 0c             	sub    $0xc,%esp
+  802b90:	ff 75 e0             	push   -0x20(%ebp)
+  802b93:	e8 d8 0c 00 00       	call   803870 <pageref>
+  802b98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b9b:	83 c4 04             	add    $0x4,%esp
+  802b9e:	ff 75 dc             	push   -0x24(%ebp)
+  802ba1:	e8 ca 0c 00 00       	call   803870 <pageref>
+  802ba6:	89 e2                	mov    %esp,%edx
+  802ba8:	89 f1                	mov    %esi,%ecx
+  802baa:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802bac:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802baf:	89 ca                	mov    %ecx,%edx
+  802bb1:	c1 ea 0f             	shr    $0xf,%edx
+  802bb4:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802bba:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802bbd:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  802bc4:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802bc7:	39 d7                	cmp    %edx,%edi
+  802bc9:	74 40                	je     802c0b <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802bcb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bce:	75 9f                	jne    802b6f <_pipeisclosed+0x19>
+  802bd0:	89 e2                	mov    %esp,%edx
+  802bd2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802bd7:	29 d0                	sub    %edx,%eax
+  802bd9:	89 c2                	mov    %eax,%edx
+  802bdb:	c1 ea 0f             	shr    $0xf,%edx
+  802bde:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be8:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802beb:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802bf2:	8b 40 58             	mov    0x58(%eax),%eax
+  802bf5:	6a 01                	push   $0x1
+  802bf7:	50                   	push   %eax
+  802bf8:	57                   	push   %edi
+  802bf9:	68 1f 3f 80 00       	push   $0x803f1f
+  802bfe:	e8 89 d5 ff ff       	call   80018c <cprintf>
+  802c03:	83 c4 10             	add    $0x10,%esp
+  802c06:	e9 5f ff ff ff       	jmp    802b6a <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802c0b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c0e:	0f 94 c0             	sete   %al
+  802c11:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802c14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c17:	5b                   	pop    %ebx
+  802c18:	5e                   	pop    %esi
+  802c19:	5f                   	pop    %edi
+  802c1a:	5d                   	pop    %ebp
+  802c1b:	c3                   	ret
+
+00802c1c <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	53                   	push   %ebx
+  802c20:	83 ec 0c             	sub    $0xc,%esp
+  802c23:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c26:	53                   	push   %ebx
+  802c27:	6a 00                	push   $0x0
+  802c29:	e8 0e e1 ff ff       	call   800d3c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c2e:	89 1c 24             	mov    %ebx,(%esp)
+  802c31:	e8 f4 e4 ff ff       	call   80112a <fd2data>
+  802c36:	83 c4 08             	add    $0x8,%esp
+  802c39:	50                   	push   %eax
+  802c3a:	6a 00                	push   $0x0
+  802c3c:	e8 fb e0 ff ff       	call   800d3c <sys_page_unmap>
+}
+  802c41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c44:	c9                   	leave
+  802c45:	c3                   	ret
+
+00802c46 <devpipe_read>:
+{
+  802c46:	55                   	push   %ebp
+  802c47:	89 e5                	mov    %esp,%ebp
+  802c49:	57                   	push   %edi
+  802c4a:	56                   	push   %esi
+  802c4b:	53                   	push   %ebx
+  802c4c:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802c4f:	ff 75 08             	push   0x8(%ebp)
+  802c52:	e8 d3 e4 ff ff       	call   80112a <fd2data>
+  802c57:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802c59:	8b 70 04             	mov    0x4(%eax),%esi
+  802c5c:	8b 00                	mov    (%eax),%eax
+  802c5e:	83 c4 10             	add    $0x10,%esp
+  802c61:	39 f0                	cmp    %esi,%eax
+  802c63:	75 36                	jne    802c9b <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802c65:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802c68:	89 da                	mov    %ebx,%edx
+  802c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6d:	e8 e4 fe ff ff       	call   802b56 <_pipeisclosed>
+  802c72:	85 c0                	test   %eax,%eax
+  802c74:	0f 85 d4 00 00 00    	jne    802d4e <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802c7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c7f:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802c83:	83 ec 04             	sub    $0x4,%esp
+  802c86:	6a ff                	push   $0xffffffff
+  802c88:	56                   	push   %esi
+  802c89:	57                   	push   %edi
+  802c8a:	e8 26 e4 ff ff       	call   8010b5 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802c8f:	8b 73 04             	mov    0x4(%ebx),%esi
+  802c92:	8b 03                	mov    (%ebx),%eax
+  802c94:	83 c4 10             	add    $0x10,%esp
+  802c97:	39 c6                	cmp    %eax,%esi
+  802c99:	74 cd                	je     802c68 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802c9b:	8b 73 04             	mov    0x4(%ebx),%esi
+  802c9e:	8b 03                	mov    (%ebx),%eax
+  802ca0:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802ca6:	29 c6                	sub    %eax,%esi
+  802ca8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802cad:	f7 e6                	mul    %esi
+  802caf:	c1 ea 0c             	shr    $0xc,%edx
+  802cb2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802cb8:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802cba:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802cbd:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802cc1:	8b 0b                	mov    (%ebx),%ecx
+  802cc3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802cc8:	f7 e1                	mul    %ecx
+  802cca:	c1 ea 0b             	shr    $0xb,%edx
+  802ccd:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802cd3:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802cd5:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802cda:	29 cf                	sub    %ecx,%edi
+  802cdc:	39 f7                	cmp    %esi,%edi
+  802cde:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802ce1:	83 ec 04             	sub    $0x4,%esp
+  802ce4:	57                   	push   %edi
+  802ce5:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802ce9:	50                   	push   %eax
+  802cea:	ff 75 0c             	push   0xc(%ebp)
+  802ced:	e8 41 dd ff ff       	call   800a33 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802cf2:	83 c4 0c             	add    $0xc,%esp
+  802cf5:	89 f0                	mov    %esi,%eax
+  802cf7:	29 f8                	sub    %edi,%eax
+  802cf9:	50                   	push   %eax
+  802cfa:	8d 43 10             	lea    0x10(%ebx),%eax
+  802cfd:	50                   	push   %eax
+  802cfe:	89 f8                	mov    %edi,%eax
+  802d00:	03 45 0c             	add    0xc(%ebp),%eax
+  802d03:	50                   	push   %eax
+  802d04:	e8 2a dd ff ff       	call   800a33 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802d09:	8b 0b                	mov    (%ebx),%ecx
+  802d0b:	01 f1                	add    %esi,%ecx
+  802d0d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d12:	f7 e1                	mul    %ecx
+  802d14:	c1 ea 0c             	shr    $0xc,%edx
+  802d17:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802d1d:	29 c1                	sub    %eax,%ecx
+  802d1f:	89 0b                	mov    %ecx,(%ebx)
+  802d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d26:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802d2a:	83 c4 10             	add    $0x10,%esp
+  802d2d:	85 c0                	test   %eax,%eax
+  802d2f:	75 0a                	jne    802d3b <devpipe_read+0xf5>
+	return n;
+  802d31:	89 f0                	mov    %esi,%eax
+}
+  802d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d36:	5b                   	pop    %ebx
+  802d37:	5e                   	pop    %esi
+  802d38:	5f                   	pop    %edi
+  802d39:	5d                   	pop    %ebp
+  802d3a:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802d3b:	83 ec 08             	sub    $0x8,%esp
+  802d3e:	68 00 04 00 00       	push   $0x400
+  802d43:	53                   	push   %ebx
+  802d44:	e8 8e e3 ff ff       	call   8010d7 <sys_futex_wake>
+  802d49:	83 c4 10             	add    $0x10,%esp
+  802d4c:	eb e3                	jmp    802d31 <devpipe_read+0xeb>
+			return 0;
+  802d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d53:	eb de                	jmp    802d33 <devpipe_read+0xed>
+
+00802d55 <devpipe_write>:
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	57                   	push   %edi
+  802d59:	56                   	push   %esi
+  802d5a:	53                   	push   %ebx
+  802d5b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802d5e:	ff 75 08             	push   0x8(%ebp)
+  802d61:	e8 c4 e3 ff ff       	call   80112a <fd2data>
+  802d66:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d72:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802d77:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d7b:	0f 84 43 01 00 00    	je     802ec4 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d81:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802d84:	8b 06                	mov    (%esi),%eax
+  802d86:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802d8c:	29 c1                	sub    %eax,%ecx
+  802d8e:	89 c8                	mov    %ecx,%eax
+  802d90:	f7 e7                	mul    %edi
+  802d92:	c1 ea 0c             	shr    $0xc,%edx
+  802d95:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802d9b:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802d9d:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802da3:	75 52                	jne    802df7 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802da5:	89 f2                	mov    %esi,%edx
+  802da7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802daa:	e8 a7 fd ff ff       	call   802b56 <_pipeisclosed>
+  802daf:	85 c0                	test   %eax,%eax
+  802db1:	0f 85 28 01 00 00    	jne    802edf <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802db7:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802db9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802dbc:	8b 06                	mov    (%esi),%eax
+  802dbe:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802dc4:	29 c1                	sub    %eax,%ecx
+  802dc6:	89 c8                	mov    %ecx,%eax
+  802dc8:	f7 e7                	mul    %edi
+  802dca:	c1 ea 0c             	shr    $0xc,%edx
+  802dcd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802dd3:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802dd5:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802ddb:	75 a4                	jne    802d81 <devpipe_write+0x2c>
+  802ddd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802de2:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802de6:	83 ec 04             	sub    $0x4,%esp
+  802de9:	6a ff                	push   $0xffffffff
+  802deb:	53                   	push   %ebx
+  802dec:	56                   	push   %esi
+  802ded:	e8 c3 e2 ff ff       	call   8010b5 <sys_futex_wait>
+}
+  802df2:	83 c4 10             	add    $0x10,%esp
+  802df5:	eb 8a                	jmp    802d81 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802df7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802dfa:	8b 06                	mov    (%esi),%eax
+  802dfc:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e02:	29 c1                	sub    %eax,%ecx
+  802e04:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e09:	f7 e1                	mul    %ecx
+  802e0b:	c1 ea 0c             	shr    $0xc,%edx
+  802e0e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e14:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802e16:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802e1b:	89 d8                	mov    %ebx,%eax
+  802e1d:	29 c8                	sub    %ecx,%eax
+  802e1f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802e22:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e25:	29 ca                	sub    %ecx,%edx
+  802e27:	39 d0                	cmp    %edx,%eax
+  802e29:	0f 46 d0             	cmovbe %eax,%edx
+  802e2c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802e2f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e32:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e37:	f7 e1                	mul    %ecx
+  802e39:	c1 ea 0b             	shr    $0xb,%edx
+  802e3c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802e42:	89 ca                	mov    %ecx,%edx
+  802e44:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802e46:	29 d3                	sub    %edx,%ebx
+  802e48:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e4b:	39 c3                	cmp    %eax,%ebx
+  802e4d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802e50:	83 ec 04             	sub    $0x4,%esp
+  802e53:	53                   	push   %ebx
+  802e54:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e57:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802e5a:	51                   	push   %ecx
+  802e5b:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802e5f:	50                   	push   %eax
+  802e60:	e8 ce db ff ff       	call   800a33 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802e65:	83 c4 0c             	add    $0xc,%esp
+  802e68:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e6b:	29 d8                	sub    %ebx,%eax
+  802e6d:	50                   	push   %eax
+  802e6e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e71:	01 cb                	add    %ecx,%ebx
+  802e73:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802e76:	53                   	push   %ebx
+  802e77:	8d 46 10             	lea    0x10(%esi),%eax
+  802e7a:	50                   	push   %eax
+  802e7b:	e8 b3 db ff ff       	call   800a33 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802e80:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e83:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e86:	01 c1                	add    %eax,%ecx
+  802e88:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e8d:	f7 e1                	mul    %ecx
+  802e8f:	c1 ea 0c             	shr    $0xc,%edx
+  802e92:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802e98:	89 ca                	mov    %ecx,%edx
+  802e9a:	29 c2                	sub    %eax,%edx
+  802e9c:	89 56 04             	mov    %edx,0x4(%esi)
+  802e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea4:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802ea8:	83 c4 10             	add    $0x10,%esp
+  802eab:	85 c0                	test   %eax,%eax
+  802ead:	75 1a                	jne    802ec9 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802eaf:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802eb2:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802eb5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802eb8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ebb:	0f 82 c0 fe ff ff    	jb     802d81 <devpipe_write+0x2c>
+  802ec1:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802ec4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ec7:	eb 1b                	jmp    802ee4 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802ec9:	83 ec 08             	sub    $0x8,%esp
+  802ecc:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802ed1:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802ed4:	50                   	push   %eax
+  802ed5:	e8 fd e1 ff ff       	call   8010d7 <sys_futex_wake>
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	eb d0                	jmp    802eaf <devpipe_write+0x15a>
+				return 0;
+  802edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ee7:	5b                   	pop    %ebx
+  802ee8:	5e                   	pop    %esi
+  802ee9:	5f                   	pop    %edi
+  802eea:	5d                   	pop    %ebp
+  802eeb:	c3                   	ret
+
+00802eec <devpipe_stat>:
+{
+  802eec:	55                   	push   %ebp
+  802eed:	89 e5                	mov    %esp,%ebp
+  802eef:	56                   	push   %esi
+  802ef0:	53                   	push   %ebx
+  802ef1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ef4:	83 ec 0c             	sub    $0xc,%esp
+  802ef7:	ff 75 08             	push   0x8(%ebp)
+  802efa:	e8 2b e2 ff ff       	call   80112a <fd2data>
+  802eff:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f01:	83 c4 08             	add    $0x8,%esp
+  802f04:	68 32 3f 80 00       	push   $0x803f32
+  802f09:	53                   	push   %ebx
+  802f0a:	e8 74 d9 ff ff       	call   800883 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f0f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f12:	8b 06                	mov    (%esi),%eax
+  802f14:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f1a:	29 c1                	sub    %eax,%ecx
+  802f1c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802f21:	89 c8                	mov    %ecx,%eax
+  802f23:	f7 e2                	mul    %edx
+  802f25:	c1 ea 0c             	shr    $0xc,%edx
+  802f28:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f2e:	29 d1                	sub    %edx,%ecx
+  802f30:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f36:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f3d:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f40:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  802f47:	40 80 00 
+}
+  802f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f52:	5b                   	pop    %ebx
+  802f53:	5e                   	pop    %esi
+  802f54:	5d                   	pop    %ebp
+  802f55:	c3                   	ret
+
+00802f56 <devpipe_poll>:
+{
+  802f56:	55                   	push   %ebp
+  802f57:	89 e5                	mov    %esp,%ebp
+  802f59:	57                   	push   %edi
+  802f5a:	56                   	push   %esi
+  802f5b:	53                   	push   %ebx
+  802f5c:	83 ec 18             	sub    $0x18,%esp
+  802f5f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f62:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f65:	57                   	push   %edi
+  802f66:	e8 bf e1 ff ff       	call   80112a <fd2data>
+  802f6b:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	89 f3                	mov    %esi,%ebx
+  802f72:	83 e3 01             	and    $0x1,%ebx
+  802f75:	75 27                	jne    802f9e <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  802f77:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802f7d:	75 48                	jne    802fc7 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802f7f:	89 ca                	mov    %ecx,%edx
+  802f81:	89 f8                	mov    %edi,%eax
+  802f83:	e8 ce fb ff ff       	call   802b56 <_pipeisclosed>
+  802f88:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  802f8a:	89 d8                	mov    %ebx,%eax
+  802f8c:	83 c8 10             	or     $0x10,%eax
+  802f8f:	85 d2                	test   %edx,%edx
+  802f91:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802f94:	89 d8                	mov    %ebx,%eax
+  802f96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f99:	5b                   	pop    %ebx
+  802f9a:	5e                   	pop    %esi
+  802f9b:	5f                   	pop    %edi
+  802f9c:	5d                   	pop    %ebp
+  802f9d:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f9e:	8b 58 04             	mov    0x4(%eax),%ebx
+  802fa1:	8b 00                	mov    (%eax),%eax
+  802fa3:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  802fa9:	29 c3                	sub    %eax,%ebx
+  802fab:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802fb0:	89 d8                	mov    %ebx,%eax
+  802fb2:	f7 e2                	mul    %edx
+  802fb4:	c1 ea 0c             	shr    $0xc,%edx
+  802fb7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802fbd:	39 d3                	cmp    %edx,%ebx
+  802fbf:	0f 95 c3             	setne  %bl
+  802fc2:	0f b6 db             	movzbl %bl,%ebx
+  802fc5:	eb b0                	jmp    802f77 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fc7:	8b 71 04             	mov    0x4(%ecx),%esi
+  802fca:	8b 01                	mov    (%ecx),%eax
+  802fcc:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802fd2:	29 c6                	sub    %eax,%esi
+  802fd4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802fd9:	89 f0                	mov    %esi,%eax
+  802fdb:	f7 e2                	mul    %edx
+  802fdd:	c1 ea 0c             	shr    $0xc,%edx
+  802fe0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fe6:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  802fe8:	89 d8                	mov    %ebx,%eax
+  802fea:	83 c8 04             	or     $0x4,%eax
+  802fed:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  802ff3:	0f 42 d8             	cmovb  %eax,%ebx
+  802ff6:	eb 87                	jmp    802f7f <devpipe_poll+0x29>
+
+00802ff8 <pipe>:
+{
+  802ff8:	55                   	push   %ebp
+  802ff9:	89 e5                	mov    %esp,%ebp
+  802ffb:	56                   	push   %esi
+  802ffc:	53                   	push   %ebx
+  802ffd:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803000:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803003:	50                   	push   %eax
+  803004:	e8 38 e1 ff ff       	call   801141 <fd_alloc>
+  803009:	89 c3                	mov    %eax,%ebx
+  80300b:	83 c4 10             	add    $0x10,%esp
+  80300e:	85 c0                	test   %eax,%eax
+  803010:	0f 88 23 01 00 00    	js     803139 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803016:	83 ec 04             	sub    $0x4,%esp
+  803019:	68 07 04 00 00       	push   $0x407
+  80301e:	ff 75 f4             	push   -0xc(%ebp)
+  803021:	6a 00                	push   $0x0
+  803023:	e8 8f dc ff ff       	call   800cb7 <sys_page_alloc>
+  803028:	89 c3                	mov    %eax,%ebx
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	0f 88 04 01 00 00    	js     803139 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803035:	83 ec 0c             	sub    $0xc,%esp
+  803038:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80303b:	50                   	push   %eax
+  80303c:	e8 00 e1 ff ff       	call   801141 <fd_alloc>
+  803041:	89 c3                	mov    %eax,%ebx
+  803043:	83 c4 10             	add    $0x10,%esp
+  803046:	85 c0                	test   %eax,%eax
+  803048:	0f 88 db 00 00 00    	js     803129 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80304e:	83 ec 04             	sub    $0x4,%esp
+  803051:	68 07 04 00 00       	push   $0x407
+  803056:	ff 75 f0             	push   -0x10(%ebp)
+  803059:	6a 00                	push   $0x0
+  80305b:	e8 57 dc ff ff       	call   800cb7 <sys_page_alloc>
+  803060:	89 c3                	mov    %eax,%ebx
+  803062:	83 c4 10             	add    $0x10,%esp
+  803065:	85 c0                	test   %eax,%eax
+  803067:	0f 88 bc 00 00 00    	js     803129 <pipe+0x131>
+	va = fd2data(fd0);
+  80306d:	83 ec 0c             	sub    $0xc,%esp
+  803070:	ff 75 f4             	push   -0xc(%ebp)
+  803073:	e8 b2 e0 ff ff       	call   80112a <fd2data>
+  803078:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80307a:	83 c4 0c             	add    $0xc,%esp
+  80307d:	68 07 04 00 00       	push   $0x407
+  803082:	50                   	push   %eax
+  803083:	6a 00                	push   $0x0
+  803085:	e8 2d dc ff ff       	call   800cb7 <sys_page_alloc>
+  80308a:	89 c3                	mov    %eax,%ebx
+  80308c:	83 c4 10             	add    $0x10,%esp
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	0f 88 82 00 00 00    	js     803119 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803097:	83 ec 0c             	sub    $0xc,%esp
+  80309a:	ff 75 f0             	push   -0x10(%ebp)
+  80309d:	e8 88 e0 ff ff       	call   80112a <fd2data>
+  8030a2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030a9:	50                   	push   %eax
+  8030aa:	6a 00                	push   $0x0
+  8030ac:	56                   	push   %esi
+  8030ad:	6a 00                	push   $0x0
+  8030af:	e8 46 dc ff ff       	call   800cfa <sys_page_map>
+  8030b4:	89 c3                	mov    %eax,%ebx
+  8030b6:	83 c4 20             	add    $0x20,%esp
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	78 4e                	js     80310b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030bd:	a1 60 40 80 00       	mov    0x804060,%eax
+  8030c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030c5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8030c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030ca:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8030d1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030d4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8030d6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030d9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8030e0:	83 ec 0c             	sub    $0xc,%esp
+  8030e3:	ff 75 f4             	push   -0xc(%ebp)
+  8030e6:	e8 2f e0 ff ff       	call   80111a <fd2num>
+  8030eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030ee:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030f0:	83 c4 04             	add    $0x4,%esp
+  8030f3:	ff 75 f0             	push   -0x10(%ebp)
+  8030f6:	e8 1f e0 ff ff       	call   80111a <fd2num>
+  8030fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030fe:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803101:	83 c4 10             	add    $0x10,%esp
+  803104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803109:	eb 2e                	jmp    803139 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80310b:	83 ec 08             	sub    $0x8,%esp
+  80310e:	56                   	push   %esi
+  80310f:	6a 00                	push   $0x0
+  803111:	e8 26 dc ff ff       	call   800d3c <sys_page_unmap>
+  803116:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803119:	83 ec 08             	sub    $0x8,%esp
+  80311c:	ff 75 f0             	push   -0x10(%ebp)
+  80311f:	6a 00                	push   $0x0
+  803121:	e8 16 dc ff ff       	call   800d3c <sys_page_unmap>
+  803126:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803129:	83 ec 08             	sub    $0x8,%esp
+  80312c:	ff 75 f4             	push   -0xc(%ebp)
+  80312f:	6a 00                	push   $0x0
+  803131:	e8 06 dc ff ff       	call   800d3c <sys_page_unmap>
+  803136:	83 c4 10             	add    $0x10,%esp
+}
+  803139:	89 d8                	mov    %ebx,%eax
+  80313b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80313e:	5b                   	pop    %ebx
+  80313f:	5e                   	pop    %esi
+  803140:	5d                   	pop    %ebp
+  803141:	c3                   	ret
+
+00803142 <pipeisclosed>:
+{
+  803142:	55                   	push   %ebp
+  803143:	89 e5                	mov    %esp,%ebp
+  803145:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803148:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80314b:	50                   	push   %eax
+  80314c:	ff 75 08             	push   0x8(%ebp)
+  80314f:	e8 3d e0 ff ff       	call   801191 <fd_lookup>
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	85 c0                	test   %eax,%eax
+  803159:	78 18                	js     803173 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80315b:	83 ec 0c             	sub    $0xc,%esp
+  80315e:	ff 75 f4             	push   -0xc(%ebp)
+  803161:	e8 c4 df ff ff       	call   80112a <fd2data>
+  803166:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803168:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80316b:	e8 e6 f9 ff ff       	call   802b56 <_pipeisclosed>
+  803170:	83 c4 10             	add    $0x10,%esp
+}
+  803173:	c9                   	leave
+  803174:	c3                   	ret
+
+00803175 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803175:	55                   	push   %ebp
+  803176:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803178:	8b 45 08             	mov    0x8(%ebp),%eax
+  80317b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803181:	5d                   	pop    %ebp
+  803182:	c3                   	ret
+
+00803183 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803183:	55                   	push   %ebp
+  803184:	89 e5                	mov    %esp,%ebp
+  803186:	53                   	push   %ebx
+  803187:	83 ec 04             	sub    $0x4,%esp
+  80318a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80318d:	8b 03                	mov    (%ebx),%eax
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	75 05                	jne    803198 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803193:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803196:	c9                   	leave
+  803197:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803198:	83 ec 08             	sub    $0x8,%esp
+  80319b:	50                   	push   %eax
+  80319c:	8d 43 04             	lea    0x4(%ebx),%eax
+  80319f:	50                   	push   %eax
+  8031a0:	e8 e7 dd ff ff       	call   800f8c <sys_page_batch>
+	pb->pb_n = 0;
+  8031a5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8031ab:	83 c4 10             	add    $0x10,%esp
+  8031ae:	eb e3                	jmp    803193 <pgbatch_flush+0x10>
+
+008031b0 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8031b0:	55                   	push   %ebp
+  8031b1:	89 e5                	mov    %esp,%ebp
+  8031b3:	56                   	push   %esi
+  8031b4:	53                   	push   %ebx
+  8031b5:	89 c3                	mov    %eax,%ebx
+  8031b7:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8031b9:	83 38 20             	cmpl   $0x20,(%eax)
+  8031bc:	74 2c                	je     8031ea <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8031be:	8b 03                	mov    (%ebx),%eax
+  8031c0:	8d 50 01             	lea    0x1(%eax),%edx
+  8031c3:	89 13                	mov    %edx,(%ebx)
+  8031c5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8031c8:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8031cc:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8031ce:	83 ec 04             	sub    $0x4,%esp
+  8031d1:	6a 18                	push   $0x18
+  8031d3:	6a 00                	push   $0x0
+  8031d5:	50                   	push   %eax
+  8031d6:	e8 23 d8 ff ff       	call   8009fe <memset>
+	return 0;
+  8031db:	83 c4 10             	add    $0x10,%esp
+  8031de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031e6:	5b                   	pop    %ebx
+  8031e7:	5e                   	pop    %esi
+  8031e8:	5d                   	pop    %ebp
+  8031e9:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8031ea:	83 ec 0c             	sub    $0xc,%esp
+  8031ed:	50                   	push   %eax
+  8031ee:	e8 90 ff ff ff       	call   803183 <pgbatch_flush>
+  8031f3:	83 c4 10             	add    $0x10,%esp
+  8031f6:	85 c0                	test   %eax,%eax
+  8031f8:	79 c4                	jns    8031be <pgbatch_slot+0xe>
+  8031fa:	eb e7                	jmp    8031e3 <pgbatch_slot+0x33>
+
+008031fc <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8031fc:	55                   	push   %ebp
+  8031fd:	89 e5                	mov    %esp,%ebp
+  8031ff:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803202:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803205:	8b 45 08             	mov    0x8(%ebp),%eax
+  803208:	e8 a3 ff ff ff       	call   8031b0 <pgbatch_slot>
+  80320d:	85 c0                	test   %eax,%eax
+  80320f:	78 20                	js     803231 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803214:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80321a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80321d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803220:	8b 55 10             	mov    0x10(%ebp),%edx
+  803223:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803226:	8b 55 14             	mov    0x14(%ebp),%edx
+  803229:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80322c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803231:	c9                   	leave
+  803232:	c3                   	ret
+
+00803233 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803233:	55                   	push   %ebp
+  803234:	89 e5                	mov    %esp,%ebp
+  803236:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803239:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80323c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323f:	e8 6c ff ff ff       	call   8031b0 <pgbatch_slot>
+  803244:	85 c0                	test   %eax,%eax
+  803246:	78 2c                	js     803274 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803248:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80324b:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803251:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803254:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803257:	8b 55 10             	mov    0x10(%ebp),%edx
+  80325a:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80325d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803260:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803263:	8b 55 18             	mov    0x18(%ebp),%edx
+  803266:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803269:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80326c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80326f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803274:	c9                   	leave
+  803275:	c3                   	ret
+
+00803276 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803276:	55                   	push   %ebp
+  803277:	89 e5                	mov    %esp,%ebp
+  803279:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80327c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80327f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803282:	e8 29 ff ff ff       	call   8031b0 <pgbatch_slot>
+  803287:	85 c0                	test   %eax,%eax
+  803289:	78 1a                	js     8032a5 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80328b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80328e:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803294:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803297:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80329a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80329d:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8032a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a5:	c9                   	leave
+  8032a6:	c3                   	ret
+
+008032a7 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8032a7:	55                   	push   %ebp
+  8032a8:	89 e5                	mov    %esp,%ebp
+  8032aa:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032ad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b3:	e8 f8 fe ff ff       	call   8031b0 <pgbatch_slot>
+  8032b8:	85 c0                	test   %eax,%eax
+  8032ba:	78 20                	js     8032dc <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8032bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032bf:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8032c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032c8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032cb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032ce:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8032d1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8032d4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8032d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032dc:	c9                   	leave
+  8032dd:	c3                   	ret
+
+008032de <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8032de:	55                   	push   %ebp
+  8032df:	89 e5                	mov    %esp,%ebp
+  8032e1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032e4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ea:	e8 c1 fe ff ff       	call   8031b0 <pgbatch_slot>
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	78 26                	js     803319 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8032f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032f6:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8032fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032ff:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803302:	8b 55 10             	mov    0x10(%ebp),%edx
+  803305:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803308:	8b 55 14             	mov    0x14(%ebp),%edx
+  80330b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80330e:	8b 55 18             	mov    0x18(%ebp),%edx
+  803311:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803314:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803319:	c9                   	leave
+  80331a:	c3                   	ret
+
+0080331b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80331b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803320:	c3                   	ret
+
+00803321 <devcons_poll>:
+{
+  803321:	55                   	push   %ebp
+  803322:	89 e5                	mov    %esp,%ebp
+  803324:	53                   	push   %ebx
+  803325:	83 ec 04             	sub    $0x4,%esp
+  803328:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80332b:	89 da                	mov    %ebx,%edx
+  80332d:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803330:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  803337:	74 0c                	je     803345 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803339:	89 d8                	mov    %ebx,%eax
+  80333b:	83 e0 01             	and    $0x1,%eax
+  80333e:	09 d0                	or     %edx,%eax
+}
+  803340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803343:	c9                   	leave
+  803344:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803345:	e8 cf d8 ff ff       	call   800c19 <sys_cgetc>
+  80334a:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80334f:	89 da                	mov    %ebx,%edx
+  803351:	83 e2 04             	and    $0x4,%edx
+  803354:	85 c0                	test   %eax,%eax
+  803356:	74 e6                	je     80333e <devcons_poll+0x1d>
+  803358:	eb df                	jmp    803339 <devcons_poll+0x18>
+
+0080335a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80335a:	55                   	push   %ebp
+  80335b:	89 e5                	mov    %esp,%ebp
+  80335d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803360:	68 3e 3f 80 00       	push   $0x803f3e
+  803365:	ff 75 0c             	push   0xc(%ebp)
+  803368:	e8 16 d5 ff ff       	call   800883 <strcpy>
+	return 0;
+}
+  80336d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803372:	c9                   	leave
+  803373:	c3                   	ret
+
+00803374 <devcons_write>:
+{
+  803374:	55                   	push   %ebp
+  803375:	89 e5                	mov    %esp,%ebp
+  803377:	57                   	push   %edi
+  803378:	56                   	push   %esi
+  803379:	53                   	push   %ebx
+  80337a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803380:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803383:	85 ff                	test   %edi,%edi
+  803385:	74 51                	je     8033d8 <devcons_write+0x64>
+  803387:	be 00 00 00 00       	mov    $0x0,%esi
+  80338c:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803391:	89 fb                	mov    %edi,%ebx
+  803393:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803395:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80339a:	39 d3                	cmp    %edx,%ebx
+  80339c:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80339f:	83 ec 04             	sub    $0x4,%esp
+  8033a2:	53                   	push   %ebx
+  8033a3:	03 45 0c             	add    0xc(%ebp),%eax
+  8033a6:	50                   	push   %eax
+  8033a7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033ad:	50                   	push   %eax
+  8033ae:	e8 80 d6 ff ff       	call   800a33 <memmove>
+		sys_cputs(buf, m);
+  8033b3:	83 c4 08             	add    $0x8,%esp
+  8033b6:	53                   	push   %ebx
+  8033b7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033bd:	50                   	push   %eax
+  8033be:	e8 38 d8 ff ff       	call   800bfb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8033c3:	01 de                	add    %ebx,%esi
+  8033c5:	89 f0                	mov    %esi,%eax
+  8033c7:	83 c4 10             	add    $0x10,%esp
+  8033ca:	39 fe                	cmp    %edi,%esi
+  8033cc:	72 c3                	jb     803391 <devcons_write+0x1d>
+}
+  8033ce:	89 f0                	mov    %esi,%eax
+  8033d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d3:	5b                   	pop    %ebx
+  8033d4:	5e                   	pop    %esi
+  8033d5:	5f                   	pop    %edi
+  8033d6:	5d                   	pop    %ebp
+  8033d7:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8033d8:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8033dd:	eb ef                	jmp    8033ce <devcons_write+0x5a>
+
+008033df <devcons_read>:
+{
+  8033df:	55                   	push   %ebp
+  8033e0:	89 e5                	mov    %esp,%ebp
+  8033e2:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8033e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8033ea:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033ee:	74 36                	je     803426 <devcons_read+0x47>
+	c = cons_peek;
+  8033f0:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8033f5:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8033fc:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8033ff:	85 c0                	test   %eax,%eax
+  803401:	75 10                	jne    803413 <devcons_read+0x34>
+  803403:	e8 11 d8 ff ff       	call   800c19 <sys_cgetc>
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	75 07                	jne    803413 <devcons_read+0x34>
+		sys_yield();
+  80340c:	e8 87 d8 ff ff       	call   800c98 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803411:	eb f0                	jmp    803403 <devcons_read+0x24>
+	if (c < 0)
+  803413:	85 c0                	test   %eax,%eax
+  803415:	78 0f                	js     803426 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803417:	83 f8 04             	cmp    $0x4,%eax
+  80341a:	74 0c                	je     803428 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80341c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80341f:	88 02                	mov    %al,(%edx)
+	return 1;
+  803421:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803426:	c9                   	leave
+  803427:	c3                   	ret
+		return 0;
+  803428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342d:	eb f7                	jmp    803426 <devcons_read+0x47>
+
+0080342f <cputchar>:
+{
+  80342f:	55                   	push   %ebp
+  803430:	89 e5                	mov    %esp,%ebp
+  803432:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803435:	8b 45 08             	mov    0x8(%ebp),%eax
+  803438:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80343b:	6a 01                	push   $0x1
+  80343d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803440:	50                   	push   %eax
+  803441:	e8 b5 d7 ff ff       	call   800bfb <sys_cputs>
+}
+  803446:	83 c4 10             	add    $0x10,%esp
+  803449:	c9                   	leave
+  80344a:	c3                   	ret
+
+0080344b <getchar>:
+{
+  80344b:	55                   	push   %ebp
+  80344c:	89 e5                	mov    %esp,%ebp
+  80344e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803451:	6a 01                	push   $0x1
+  803453:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803456:	50                   	push   %eax
+  803457:	6a 00                	push   $0x0
+  803459:	e8 b7 df ff ff       	call   801415 <read>
+	if (r < 0)
+  80345e:	83 c4 10             	add    $0x10,%esp
+  803461:	85 c0                	test   %eax,%eax
+  803463:	78 06                	js     80346b <getchar+0x20>
+	if (r < 1)
+  803465:	74 06                	je     80346d <getchar+0x22>
+	return c;
+  803467:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80346b:	c9                   	leave
+  80346c:	c3                   	ret
+		return -E_EOF;
+  80346d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803472:	eb f7                	jmp    80346b <getchar+0x20>
+
+00803474 <iscons>:
+{
+  803474:	55                   	push   %ebp
+  803475:	89 e5                	mov    %esp,%ebp
+  803477:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80347a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80347d:	50                   	push   %eax
+  80347e:	ff 75 08             	push   0x8(%ebp)
+  803481:	e8 0b dd ff ff       	call   801191 <fd_lookup>
+  803486:	83 c4 10             	add    $0x10,%esp
+  803489:	85 c0                	test   %eax,%eax
+  80348b:	78 11                	js     80349e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80348d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803490:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803496:	39 10                	cmp    %edx,(%eax)
+  803498:	0f 94 c0             	sete   %al
+  80349b:	0f b6 c0             	movzbl %al,%eax
+}
+  80349e:	c9                   	leave
+  80349f:	c3                   	ret
+
+008034a0 <opencons>:
+{
+  8034a0:	55                   	push   %ebp
+  8034a1:	89 e5                	mov    %esp,%ebp
+  8034a3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8034a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034a9:	50                   	push   %eax
+  8034aa:	e8 92 dc ff ff       	call   801141 <fd_alloc>
+  8034af:	83 c4 10             	add    $0x10,%esp
+  8034b2:	85 c0                	test   %eax,%eax
+  8034b4:	78 3a                	js     8034f0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034b6:	83 ec 04             	sub    $0x4,%esp
+  8034b9:	68 07 04 00 00       	push   $0x407
+  8034be:	ff 75 f4             	push   -0xc(%ebp)
+  8034c1:	6a 00                	push   $0x0
+  8034c3:	e8 ef d7 ff ff       	call   800cb7 <sys_page_alloc>
+  8034c8:	83 c4 10             	add    $0x10,%esp
+  8034cb:	85 c0                	test   %eax,%eax
+  8034cd:	78 21                	js     8034f0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8034cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034d2:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8034d8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8034da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034dd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8034e4:	83 ec 0c             	sub    $0xc,%esp
+  8034e7:	50                   	push   %eax
+  8034e8:	e8 2d dc ff ff       	call   80111a <fd2num>
+  8034ed:	83 c4 10             	add    $0x10,%esp
+}
+  8034f0:	c9                   	leave
+  8034f1:	c3                   	ret
+
+008034f2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8034f2:	55                   	push   %ebp
+  8034f3:	89 e5                	mov    %esp,%ebp
+  8034f5:	56                   	push   %esi
+  8034f6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8034f7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034fa:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803500:	e8 74 d7 ff ff       	call   800c79 <sys_getenvid>
+  803505:	83 ec 0c             	sub    $0xc,%esp
+  803508:	ff 75 0c             	push   0xc(%ebp)
+  80350b:	ff 75 08             	push   0x8(%ebp)
+  80350e:	56                   	push   %esi
+  80350f:	50                   	push   %eax
+  803510:	68 4c 3f 80 00       	push   $0x803f4c
+  803515:	e8 72 cc ff ff       	call   80018c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80351a:	83 c4 18             	add    $0x18,%esp
+  80351d:	53                   	push   %ebx
+  80351e:	ff 75 10             	push   0x10(%ebp)
+  803521:	e8 15 cc ff ff       	call   80013b <vcprintf>
+	cprintf("\n");
+  803526:	c7 04 24 bc 3a 80 00 	movl   $0x803abc,(%esp)
+  80352d:	e8 5a cc ff ff       	call   80018c <cprintf>
+  803532:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803535:	cc                   	int3
+	while (1)
+  803536:	eb fd                	jmp    803535 <_panic+0x43>
+
+00803538 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803538:	55                   	push   %ebp
+  803539:	89 e5                	mov    %esp,%ebp
+  80353b:	56                   	push   %esi
+  80353c:	53                   	push   %ebx
+  80353d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803540:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803543:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803546:	85 c0                	test   %eax,%eax
+  803548:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80354d:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803550:	83 ec 0c             	sub    $0xc,%esp
+  803553:	50                   	push   %eax
+  803554:	e8 0e d9 ff ff       	call   800e67 <sys_ipc_recv>
+  803559:	83 c4 10             	add    $0x10,%esp
+  80355c:	85 c0                	test   %eax,%eax
+  80355e:	0f 88 8b 00 00 00    	js     8035ef <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803564:	85 f6                	test   %esi,%esi
+  803566:	74 2a                	je     803592 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803568:	89 e2                	mov    %esp,%edx
+  80356a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80356f:	29 d0                	sub    %edx,%eax
+  803571:	89 c2                	mov    %eax,%edx
+  803573:	c1 ea 0f             	shr    $0xf,%edx
+  803576:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80357b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803580:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803583:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80358a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803590:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803592:	85 db                	test   %ebx,%ebx
+  803594:	74 2a                	je     8035c0 <ipc_recv+0x88>
+  803596:	89 e2                	mov    %esp,%edx
+  803598:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80359d:	29 d0                	sub    %edx,%eax
+  80359f:	89 c2                	mov    %eax,%edx
+  8035a1:	c1 ea 0f             	shr    $0xf,%edx
+  8035a4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ae:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035b1:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035b8:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035be:	89 03                	mov    %eax,(%ebx)
+  8035c0:	89 e2                	mov    %esp,%edx
+  8035c2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035c7:	29 d0                	sub    %edx,%eax
+  8035c9:	89 c2                	mov    %eax,%edx
+  8035cb:	c1 ea 0f             	shr    $0xf,%edx
+  8035ce:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d8:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035db:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035e2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035eb:	5b                   	pop    %ebx
+  8035ec:	5e                   	pop    %esi
+  8035ed:	5d                   	pop    %ebp
+  8035ee:	c3                   	ret
+		if(from_env_store != NULL)
+  8035ef:	85 f6                	test   %esi,%esi
+  8035f1:	74 06                	je     8035f9 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035f3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035f9:	85 db                	test   %ebx,%ebx
+  8035fb:	74 eb                	je     8035e8 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803603:	eb e3                	jmp    8035e8 <ipc_recv+0xb0>
+
+00803605 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803605:	55                   	push   %ebp
+  803606:	89 e5                	mov    %esp,%ebp
+  803608:	57                   	push   %edi
+  803609:	56                   	push   %esi
+  80360a:	53                   	push   %ebx
+  80360b:	83 ec 14             	sub    $0x14,%esp
+  80360e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803611:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803614:	8b 75 14             	mov    0x14(%ebp),%esi
+  803617:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803621:	0f 44 c2             	cmove  %edx,%eax
+  803624:	ff 75 10             	push   0x10(%ebp)
+  803627:	50                   	push   %eax
+  803628:	e8 9c d8 ff ff       	call   800ec9 <sys_ipc_recv_pages>
+  80362d:	83 c4 10             	add    $0x10,%esp
+  803630:	85 c0                	test   %eax,%eax
+  803632:	0f 88 ba 00 00 00    	js     8036f2 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803638:	85 ff                	test   %edi,%edi
+  80363a:	74 2a                	je     803666 <ipc_recv_pages+0x61>
+  80363c:	89 e2                	mov    %esp,%edx
+  80363e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803643:	29 d0                	sub    %edx,%eax
+  803645:	89 c2                	mov    %eax,%edx
+  803647:	c1 ea 0f             	shr    $0xf,%edx
+  80364a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80364f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803654:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803657:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80365e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803664:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803666:	85 f6                	test   %esi,%esi
+  803668:	74 2a                	je     803694 <ipc_recv_pages+0x8f>
+  80366a:	89 e2                	mov    %esp,%edx
+  80366c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803671:	29 d0                	sub    %edx,%eax
+  803673:	89 c2                	mov    %eax,%edx
+  803675:	c1 ea 0f             	shr    $0xf,%edx
+  803678:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80367d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803682:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803685:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80368c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803692:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803694:	85 db                	test   %ebx,%ebx
+  803696:	74 2a                	je     8036c2 <ipc_recv_pages+0xbd>
+  803698:	89 e2                	mov    %esp,%edx
+  80369a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80369f:	29 d0                	sub    %edx,%eax
+  8036a1:	89 c2                	mov    %eax,%edx
+  8036a3:	c1 ea 0f             	shr    $0xf,%edx
+  8036a6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b0:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036b3:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036ba:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036c0:	89 03                	mov    %eax,(%ebx)
+  8036c2:	89 e2                	mov    %esp,%edx
+  8036c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036c9:	29 d0                	sub    %edx,%eax
+  8036cb:	89 c2                	mov    %eax,%edx
+  8036cd:	c1 ea 0f             	shr    $0xf,%edx
+  8036d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036da:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036dd:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036e4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ed:	5b                   	pop    %ebx
+  8036ee:	5e                   	pop    %esi
+  8036ef:	5f                   	pop    %edi
+  8036f0:	5d                   	pop    %ebp
+  8036f1:	c3                   	ret
+		if (from_env_store)
+  8036f2:	85 ff                	test   %edi,%edi
+  8036f4:	74 06                	je     8036fc <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036f6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036fc:	85 f6                	test   %esi,%esi
+  8036fe:	74 06                	je     803706 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803700:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803706:	85 db                	test   %ebx,%ebx
+  803708:	74 e0                	je     8036ea <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  80370a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803710:	eb d8                	jmp    8036ea <ipc_recv_pages+0xe5>
+
+00803712 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803712:	55                   	push   %ebp
+  803713:	89 e5                	mov    %esp,%ebp
+  803715:	57                   	push   %edi
+  803716:	56                   	push   %esi
+  803717:	53                   	push   %ebx
+  803718:	83 ec 1c             	sub    $0x1c,%esp
+  80371b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80371e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803721:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803727:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80372b:	75 2b                	jne    803758 <ipc_try_send_pages+0x46>
+  80372d:	89 e2                	mov    %esp,%edx
+  80372f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803734:	29 d0                	sub    %edx,%eax
+  803736:	89 c2                	mov    %eax,%edx
+  803738:	c1 ea 0f             	shr    $0xf,%edx
+  80373b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803740:	b8 00 00 00 00       	mov    $0x0,%eax
+  803745:	0f 42 c2             	cmovb  %edx,%eax
+  803748:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80374f:	8b 70 48             	mov    0x48(%eax),%esi
+  803752:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803758:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80375e:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803763:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803766:	85 ff                	test   %edi,%edi
+  803768:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80376d:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803770:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803776:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80377c:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803782:	83 ec 0c             	sub    $0xc,%esp
+  803785:	ff 75 14             	push   0x14(%ebp)
+  803788:	ff 75 18             	push   0x18(%ebp)
+  80378b:	57                   	push   %edi
+  80378c:	ff 75 0c             	push   0xc(%ebp)
+  80378f:	ff 75 08             	push   0x8(%ebp)
+  803792:	e8 11 d7 ff ff       	call   800ea8 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803797:	83 c4 20             	add    $0x20,%esp
+  80379a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80379d:	75 21                	jne    8037c0 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80379f:	83 ec 04             	sub    $0x4,%esp
+  8037a2:	6a ff                	push   $0xffffffff
+  8037a4:	53                   	push   %ebx
+  8037a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8037a8:	e8 08 d9 ff ff       	call   8010b5 <sys_futex_wait>
+  8037ad:	83 c4 10             	add    $0x10,%esp
+  8037b0:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037b3:	74 c7                	je     80377c <ipc_try_send_pages+0x6a>
+  8037b5:	85 c0                	test   %eax,%eax
+  8037b7:	79 c3                	jns    80377c <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037b9:	e8 da d4 ff ff       	call   800c98 <sys_yield>
+  8037be:	eb bc                	jmp    80377c <ipc_try_send_pages+0x6a>
+	}
+}
+  8037c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c3:	5b                   	pop    %ebx
+  8037c4:	5e                   	pop    %esi
+  8037c5:	5f                   	pop    %edi
+  8037c6:	5d                   	pop    %ebp
+  8037c7:	c3                   	ret
+
+008037c8 <ipc_send>:
+{
+  8037c8:	55                   	push   %ebp
+  8037c9:	89 e5                	mov    %esp,%ebp
+  8037cb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037ce:	ff 75 14             	push   0x14(%ebp)
+  8037d1:	6a 01                	push   $0x1
+  8037d3:	ff 75 10             	push   0x10(%ebp)
+  8037d6:	ff 75 0c             	push   0xc(%ebp)
+  8037d9:	ff 75 08             	push   0x8(%ebp)
+  8037dc:	e8 31 ff ff ff       	call   803712 <ipc_try_send_pages>
+  8037e1:	83 c4 20             	add    $0x20,%esp
+  8037e4:	85 c0                	test   %eax,%eax
+  8037e6:	78 02                	js     8037ea <ipc_send+0x22>
+}
+  8037e8:	c9                   	leave
+  8037e9:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037ea:	50                   	push   %eax
+  8037eb:	68 6f 3f 80 00       	push   $0x803f6f
+  8037f0:	6a 3f                	push   $0x3f
+  8037f2:	68 84 3f 80 00       	push   $0x803f84
+  8037f7:	e8 f6 fc ff ff       	call   8034f2 <_panic>
+
+008037fc <ipc_send_pages>:
+{
+  8037fc:	55                   	push   %ebp
+  8037fd:	89 e5                	mov    %esp,%ebp
+  8037ff:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803802:	ff 75 18             	push   0x18(%ebp)
+  803805:	ff 75 14             	push   0x14(%ebp)
+  803808:	ff 75 10             	push   0x10(%ebp)
+  80380b:	ff 75 0c             	push   0xc(%ebp)
+  80380e:	ff 75 08             	push   0x8(%ebp)
+  803811:	e8 fc fe ff ff       	call   803712 <ipc_try_send_pages>
+  803816:	83 c4 20             	add    $0x20,%esp
+  803819:	85 c0                	test   %eax,%eax
+  80381b:	78 02                	js     80381f <ipc_send_pages+0x23>
+}
+  80381d:	c9                   	leave
+  80381e:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80381f:	50                   	push   %eax
+  803820:	68 8e 3f 80 00       	push   $0x803f8e
+  803825:	6a 64                	push   $0x64
+  803827:	68 84 3f 80 00       	push   $0x803f84
+  80382c:	e8 c1 fc ff ff       	call   8034f2 <_panic>
+
+00803831 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803831:	55                   	push   %ebp
+  803832:	89 e5                	mov    %esp,%ebp
+  803834:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803837:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80383c:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803842:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803848:	8b 52 50             	mov    0x50(%edx),%edx
+  80384b:	39 ca                	cmp    %ecx,%edx
+  80384d:	74 11                	je     803860 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80384f:	83 c0 01             	add    $0x1,%eax
+  803852:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803857:	75 e3                	jne    80383c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385e:	eb 0e                	jmp    80386e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803860:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803866:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80386b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80386e:	5d                   	pop    %ebp
+  80386f:	c3                   	ret
+
+00803870 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803870:	55                   	push   %ebp
+  803871:	89 e5                	mov    %esp,%ebp
+  803873:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803876:	89 c2                	mov    %eax,%edx
+  803878:	c1 ea 16             	shr    $0x16,%edx
+  80387b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803882:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803887:	f6 c1 01             	test   $0x1,%cl
+  80388a:	74 1e                	je     8038aa <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80388c:	c1 e8 0c             	shr    $0xc,%eax
+  80388f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803896:	a8 01                	test   $0x1,%al
+  803898:	74 10                	je     8038aa <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80389a:	c1 e8 0c             	shr    $0xc,%eax
+  80389d:	c1 e0 04             	shl    $0x4,%eax
+  8038a0:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8038a7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038aa:	89 d0                	mov    %edx,%eax
+  8038ac:	5d                   	pop    %ebp
+  8038ad:	c3                   	ret
+
+008038ae <__udivdi3>:
+  8038ae:	57                   	push   %edi
+  8038af:	56                   	push   %esi
+  8038b0:	53                   	push   %ebx
+  8038b1:	83 ec 20             	sub    $0x20,%esp
+  8038b4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038b8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038bc:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038c0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038c4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038c8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038cc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038d4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038e3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038ea:	00 
+  8038eb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038f2:	00 
+  8038f3:	eb 08                	jmp    8038fd <__udivdi3+0x4f>
+  8038f5:	83 e9 01             	sub    $0x1,%ecx
+  8038f8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038fb:	74 68                	je     803965 <__udivdi3+0xb7>
+  8038fd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803901:	01 c0                	add    %eax,%eax
+  803903:	89 c6                	mov    %eax,%esi
+  803905:	89 d7                	mov    %edx,%edi
+  803907:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80390b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80390f:	0f ad d0             	shrd   %cl,%edx,%eax
+  803912:	d3 ea                	shr    %cl,%edx
+  803914:	f6 c1 20             	test   $0x20,%cl
+  803917:	74 04                	je     80391d <__udivdi3+0x6f>
+  803919:	89 d0                	mov    %edx,%eax
+  80391b:	31 d2                	xor    %edx,%edx
+  80391d:	83 e0 01             	and    $0x1,%eax
+  803920:	89 04 24             	mov    %eax,(%esp)
+  803923:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80392a:	00 
+  80392b:	8b 04 24             	mov    (%esp),%eax
+  80392e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803932:	09 f0                	or     %esi,%eax
+  803934:	09 fa                	or     %edi,%edx
+  803936:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80393a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80393e:	39 f0                	cmp    %esi,%eax
+  803940:	89 d3                	mov    %edx,%ebx
+  803942:	19 fb                	sbb    %edi,%ebx
+  803944:	72 af                	jb     8038f5 <__udivdi3+0x47>
+  803946:	29 f0                	sub    %esi,%eax
+  803948:	19 fa                	sbb    %edi,%edx
+  80394a:	89 cf                	mov    %ecx,%edi
+  80394c:	c1 ef 05             	shr    $0x5,%edi
+  80394f:	83 e7 01             	and    $0x1,%edi
+  803952:	89 fe                	mov    %edi,%esi
+  803954:	83 f6 01             	xor    $0x1,%esi
+  803957:	d3 e6                	shl    %cl,%esi
+  803959:	d3 e7                	shl    %cl,%edi
+  80395b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80395f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803963:	eb 90                	jmp    8038f5 <__udivdi3+0x47>
+  803965:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803969:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80396d:	83 c4 20             	add    $0x20,%esp
+  803970:	5b                   	pop    %ebx
+  803971:	5e                   	pop    %esi
+  803972:	5f                   	pop    %edi
+  803973:	c3                   	ret
+
+00803974 <__umoddi3>:
+  803974:	57                   	push   %edi
+  803975:	56                   	push   %esi
+  803976:	53                   	push   %ebx
+  803977:	83 ec 08             	sub    $0x8,%esp
+  80397a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80397e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803982:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803986:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80398a:	57                   	push   %edi
+  80398b:	56                   	push   %esi
+  80398c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803990:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803994:	52                   	push   %edx
+  803995:	50                   	push   %eax
+  803996:	e8 13 ff ff ff       	call   8038ae <__udivdi3>
+  80399b:	89 c3                	mov    %eax,%ebx
+  80399d:	0f af d6             	imul   %esi,%edx
+  8039a0:	89 f9                	mov    %edi,%ecx
+  8039a2:	0f af cb             	imul   %ebx,%ecx
+  8039a5:	01 d1                	add    %edx,%ecx
+  8039a7:	89 d8                	mov    %ebx,%eax
+  8039a9:	f7 e6                	mul    %esi
+  8039ab:	89 c6                	mov    %eax,%esi
+  8039ad:	89 d7                	mov    %edx,%edi
+  8039af:	01 cf                	add    %ecx,%edi
+  8039b1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039b5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039b9:	29 f0                	sub    %esi,%eax
+  8039bb:	19 fa                	sbb    %edi,%edx
+  8039bd:	83 c4 18             	add    $0x18,%esp
+  8039c0:	5b                   	pop    %ebx
+  8039c1:	5e                   	pop    %esi
+  8039c2:	5f                   	pop    %edi
+  8039c3:	c3                   	ret
+
+008039c4 <__divdi3>:
+  8039c4:	53                   	push   %ebx
+  8039c5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039c9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039cd:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039d1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039d5:	85 d2                	test   %edx,%edx
+  8039d7:	78 12                	js     8039eb <__divdi3+0x27>
+  8039d9:	85 db                	test   %ebx,%ebx
+  8039db:	78 2e                	js     803a0b <__divdi3+0x47>
+  8039dd:	53                   	push   %ebx
+  8039de:	51                   	push   %ecx
+  8039df:	52                   	push   %edx
+  8039e0:	50                   	push   %eax
+  8039e1:	e8 c8 fe ff ff       	call   8038ae <__udivdi3>
+  8039e6:	83 c4 10             	add    $0x10,%esp
+  8039e9:	eb 1e                	jmp    803a09 <__divdi3+0x45>
+  8039eb:	f7 d8                	neg    %eax
+  8039ed:	83 d2 00             	adc    $0x0,%edx
+  8039f0:	f7 da                	neg    %edx
+  8039f2:	85 db                	test   %ebx,%ebx
+  8039f4:	78 2a                	js     803a20 <__divdi3+0x5c>
+  8039f6:	53                   	push   %ebx
+  8039f7:	51                   	push   %ecx
+  8039f8:	52                   	push   %edx
+  8039f9:	50                   	push   %eax
+  8039fa:	e8 af fe ff ff       	call   8038ae <__udivdi3>
+  8039ff:	83 c4 10             	add    $0x10,%esp
+  803a02:	f7 d8                	neg    %eax
+  803a04:	83 d2 00             	adc    $0x0,%edx
+  803a07:	f7 da                	neg    %edx
+  803a09:	5b                   	pop    %ebx
+  803a0a:	c3                   	ret
+  803a0b:	f7 d9                	neg    %ecx
+  803a0d:	83 d3 00             	adc    $0x0,%ebx
+  803a10:	f7 db                	neg    %ebx
+  803a12:	53                   	push   %ebx
+  803a13:	51                   	push   %ecx
+  803a14:	52                   	push   %edx
+  803a15:	50                   	push   %eax
+  803a16:	e8 93 fe ff ff       	call   8038ae <__udivdi3>
+  803a1b:	83 c4 10             	add    $0x10,%esp
+  803a1e:	eb e2                	jmp    803a02 <__divdi3+0x3e>
+  803a20:	f7 d9                	neg    %ecx
+  803a22:	83 d3 00             	adc    $0x0,%ebx
+  803a25:	f7 db                	neg    %ebx
+  803a27:	53                   	push   %ebx
+  803a28:	51                   	push   %ecx
+  803a29:	52                   	push   %edx
+  803a2a:	50                   	push   %eax
+  803a2b:	e8 7e fe ff ff       	call   8038ae <__udivdi3>
+  803a30:	83 c4 10             	add    $0x10,%esp
+  803a33:	eb d4                	jmp    803a09 <__divdi3+0x45>
+
+00803a35 <__moddi3>:
+  803a35:	57                   	push   %edi
+  803a36:	56                   	push   %esi
+  803a37:	53                   	push   %ebx
+  803a38:	83 ec 08             	sub    $0x8,%esp
+  803a3b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a3f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a43:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a47:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a4b:	57                   	push   %edi
+  803a4c:	56                   	push   %esi
+  803a4d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a51:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a55:	52                   	push   %edx
+  803a56:	50                   	push   %eax
+  803a57:	e8 68 ff ff ff       	call   8039c4 <__divdi3>
+  803a5c:	89 c3                	mov    %eax,%ebx
+  803a5e:	0f af d6             	imul   %esi,%edx
+  803a61:	89 f9                	mov    %edi,%ecx
+  803a63:	0f af cb             	imul   %ebx,%ecx
+  803a66:	01 d1                	add    %edx,%ecx
+  803a68:	89 d8                	mov    %ebx,%eax
+  803a6a:	f7 e6                	mul    %esi
+  803a6c:	89 c6                	mov    %eax,%esi
+  803a6e:	89 d7                	mov    %edx,%edi
+  803a70:	01 cf                	add    %ecx,%edi
+  803a72:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a76:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a7a:	29 f0                	sub    %esi,%eax
+  803a7c:	19 fa                	sbb    %edi,%edx
+  803a7e:	83 c4 18             	add    $0x18,%esp
+  803a81:	5b                   	pop    %ebx
+  803a82:	5e                   	pop    %esi
+  803a83:	5f                   	pop    %edi
+  803a84:	c3                   	ret
@@ -0,0 +1,8400 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ac 05 00 00       	call   8005dd <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 0c             	sub    $0xc,%esp
+  80003e:	89 c6                	mov    %eax,%esi
+  800040:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800042:	ff 75 08             	push   0x8(%ebp)
+  800045:	52                   	push   %edx
+  800046:	68 b1 40 80 00       	push   $0x8040b1
+  80004b:	68 80 40 80 00       	push   $0x804080
+  800050:	e8 0a 07 00 00       	call   80075f <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800055:	ff 33                	push   (%ebx)
+  800057:	ff 36                	push   (%esi)
+  800059:	68 90 40 80 00       	push   $0x804090
+  80005e:	68 94 40 80 00       	push   $0x804094
+  800063:	e8 f7 06 00 00       	call   80075f <cprintf>
+  800068:	83 c4 20             	add    $0x20,%esp
+  80006b:	8b 03                	mov    (%ebx),%eax
+  80006d:	39 06                	cmp    %eax,(%esi)
+  80006f:	0f 84 2e 02 00 00    	je     8002a3 <check_regs+0x26e>
+  800075:	83 ec 0c             	sub    $0xc,%esp
+  800078:	68 a8 40 80 00       	push   $0x8040a8
+  80007d:	e8 dd 06 00 00       	call   80075f <cprintf>
+  800082:	83 c4 10             	add    $0x10,%esp
+  800085:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  80008a:	ff 73 04             	push   0x4(%ebx)
+  80008d:	ff 76 04             	push   0x4(%esi)
+  800090:	68 b2 40 80 00       	push   $0x8040b2
+  800095:	68 94 40 80 00       	push   $0x804094
+  80009a:	e8 c0 06 00 00       	call   80075f <cprintf>
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a5:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a8:	0f 84 0f 02 00 00    	je     8002bd <check_regs+0x288>
+  8000ae:	83 ec 0c             	sub    $0xc,%esp
+  8000b1:	68 a8 40 80 00       	push   $0x8040a8
+  8000b6:	e8 a4 06 00 00       	call   80075f <cprintf>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c3:	ff 73 08             	push   0x8(%ebx)
+  8000c6:	ff 76 08             	push   0x8(%esi)
+  8000c9:	68 b6 40 80 00       	push   $0x8040b6
+  8000ce:	68 94 40 80 00       	push   $0x804094
+  8000d3:	e8 87 06 00 00       	call   80075f <cprintf>
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000de:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000e1:	0f 84 eb 01 00 00    	je     8002d2 <check_regs+0x29d>
+  8000e7:	83 ec 0c             	sub    $0xc,%esp
+  8000ea:	68 a8 40 80 00       	push   $0x8040a8
+  8000ef:	e8 6b 06 00 00       	call   80075f <cprintf>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fc:	ff 73 10             	push   0x10(%ebx)
+  8000ff:	ff 76 10             	push   0x10(%esi)
+  800102:	68 ba 40 80 00       	push   $0x8040ba
+  800107:	68 94 40 80 00       	push   $0x804094
+  80010c:	e8 4e 06 00 00       	call   80075f <cprintf>
+  800111:	83 c4 10             	add    $0x10,%esp
+  800114:	8b 43 10             	mov    0x10(%ebx),%eax
+  800117:	39 46 10             	cmp    %eax,0x10(%esi)
+  80011a:	0f 84 c7 01 00 00    	je     8002e7 <check_regs+0x2b2>
+  800120:	83 ec 0c             	sub    $0xc,%esp
+  800123:	68 a8 40 80 00       	push   $0x8040a8
+  800128:	e8 32 06 00 00       	call   80075f <cprintf>
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800135:	ff 73 14             	push   0x14(%ebx)
+  800138:	ff 76 14             	push   0x14(%esi)
+  80013b:	68 be 40 80 00       	push   $0x8040be
+  800140:	68 94 40 80 00       	push   $0x804094
+  800145:	e8 15 06 00 00       	call   80075f <cprintf>
+  80014a:	83 c4 10             	add    $0x10,%esp
+  80014d:	8b 43 14             	mov    0x14(%ebx),%eax
+  800150:	39 46 14             	cmp    %eax,0x14(%esi)
+  800153:	0f 84 a3 01 00 00    	je     8002fc <check_regs+0x2c7>
+  800159:	83 ec 0c             	sub    $0xc,%esp
+  80015c:	68 a8 40 80 00       	push   $0x8040a8
+  800161:	e8 f9 05 00 00       	call   80075f <cprintf>
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016e:	ff 73 18             	push   0x18(%ebx)
+  800171:	ff 76 18             	push   0x18(%esi)
+  800174:	68 c2 40 80 00       	push   $0x8040c2
+  800179:	68 94 40 80 00       	push   $0x804094
+  80017e:	e8 dc 05 00 00       	call   80075f <cprintf>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	8b 43 18             	mov    0x18(%ebx),%eax
+  800189:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018c:	0f 84 7f 01 00 00    	je     800311 <check_regs+0x2dc>
+  800192:	83 ec 0c             	sub    $0xc,%esp
+  800195:	68 a8 40 80 00       	push   $0x8040a8
+  80019a:	e8 c0 05 00 00       	call   80075f <cprintf>
+  80019f:	83 c4 10             	add    $0x10,%esp
+  8001a2:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a7:	ff 73 1c             	push   0x1c(%ebx)
+  8001aa:	ff 76 1c             	push   0x1c(%esi)
+  8001ad:	68 c6 40 80 00       	push   $0x8040c6
+  8001b2:	68 94 40 80 00       	push   $0x804094
+  8001b7:	e8 a3 05 00 00       	call   80075f <cprintf>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c2:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c5:	0f 84 5b 01 00 00    	je     800326 <check_regs+0x2f1>
+  8001cb:	83 ec 0c             	sub    $0xc,%esp
+  8001ce:	68 a8 40 80 00       	push   $0x8040a8
+  8001d3:	e8 87 05 00 00       	call   80075f <cprintf>
+  8001d8:	83 c4 10             	add    $0x10,%esp
+  8001db:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001e0:	ff 73 20             	push   0x20(%ebx)
+  8001e3:	ff 76 20             	push   0x20(%esi)
+  8001e6:	68 ca 40 80 00       	push   $0x8040ca
+  8001eb:	68 94 40 80 00       	push   $0x804094
+  8001f0:	e8 6a 05 00 00       	call   80075f <cprintf>
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001fb:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fe:	0f 84 37 01 00 00    	je     80033b <check_regs+0x306>
+  800204:	83 ec 0c             	sub    $0xc,%esp
+  800207:	68 a8 40 80 00       	push   $0x8040a8
+  80020c:	e8 4e 05 00 00       	call   80075f <cprintf>
+  800211:	83 c4 10             	add    $0x10,%esp
+  800214:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800219:	ff 73 24             	push   0x24(%ebx)
+  80021c:	ff 76 24             	push   0x24(%esi)
+  80021f:	68 ce 40 80 00       	push   $0x8040ce
+  800224:	68 94 40 80 00       	push   $0x804094
+  800229:	e8 31 05 00 00       	call   80075f <cprintf>
+  80022e:	83 c4 10             	add    $0x10,%esp
+  800231:	8b 43 24             	mov    0x24(%ebx),%eax
+  800234:	39 46 24             	cmp    %eax,0x24(%esi)
+  800237:	0f 84 13 01 00 00    	je     800350 <check_regs+0x31b>
+  80023d:	83 ec 0c             	sub    $0xc,%esp
+  800240:	68 a8 40 80 00       	push   $0x8040a8
+  800245:	e8 15 05 00 00       	call   80075f <cprintf>
+	CHECK(esp, esp);
+  80024a:	ff 73 28             	push   0x28(%ebx)
+  80024d:	ff 76 28             	push   0x28(%esi)
+  800250:	68 d5 40 80 00       	push   $0x8040d5
+  800255:	68 94 40 80 00       	push   $0x804094
+  80025a:	e8 00 05 00 00       	call   80075f <cprintf>
+  80025f:	83 c4 20             	add    $0x20,%esp
+  800262:	8b 43 28             	mov    0x28(%ebx),%eax
+  800265:	39 46 28             	cmp    %eax,0x28(%esi)
+  800268:	0f 84 53 01 00 00    	je     8003c1 <check_regs+0x38c>
+  80026e:	83 ec 0c             	sub    $0xc,%esp
+  800271:	68 a8 40 80 00       	push   $0x8040a8
+  800276:	e8 e4 04 00 00       	call   80075f <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  80027b:	83 c4 08             	add    $0x8,%esp
+  80027e:	ff 75 0c             	push   0xc(%ebp)
+  800281:	68 d9 40 80 00       	push   $0x8040d9
+  800286:	e8 d4 04 00 00       	call   80075f <cprintf>
+  80028b:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028e:	83 ec 0c             	sub    $0xc,%esp
+  800291:	68 a8 40 80 00       	push   $0x8040a8
+  800296:	e8 c4 04 00 00       	call   80075f <cprintf>
+  80029b:	83 c4 10             	add    $0x10,%esp
+}
+  80029e:	e9 16 01 00 00       	jmp    8003b9 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a3:	83 ec 0c             	sub    $0xc,%esp
+  8002a6:	68 a4 40 80 00       	push   $0x8040a4
+  8002ab:	e8 af 04 00 00       	call   80075f <cprintf>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b8:	e9 cd fd ff ff       	jmp    80008a <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bd:	83 ec 0c             	sub    $0xc,%esp
+  8002c0:	68 a4 40 80 00       	push   $0x8040a4
+  8002c5:	e8 95 04 00 00       	call   80075f <cprintf>
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	e9 f1 fd ff ff       	jmp    8000c3 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d2:	83 ec 0c             	sub    $0xc,%esp
+  8002d5:	68 a4 40 80 00       	push   $0x8040a4
+  8002da:	e8 80 04 00 00       	call   80075f <cprintf>
+  8002df:	83 c4 10             	add    $0x10,%esp
+  8002e2:	e9 15 fe ff ff       	jmp    8000fc <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e7:	83 ec 0c             	sub    $0xc,%esp
+  8002ea:	68 a4 40 80 00       	push   $0x8040a4
+  8002ef:	e8 6b 04 00 00       	call   80075f <cprintf>
+  8002f4:	83 c4 10             	add    $0x10,%esp
+  8002f7:	e9 39 fe ff ff       	jmp    800135 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fc:	83 ec 0c             	sub    $0xc,%esp
+  8002ff:	68 a4 40 80 00       	push   $0x8040a4
+  800304:	e8 56 04 00 00       	call   80075f <cprintf>
+  800309:	83 c4 10             	add    $0x10,%esp
+  80030c:	e9 5d fe ff ff       	jmp    80016e <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  800311:	83 ec 0c             	sub    $0xc,%esp
+  800314:	68 a4 40 80 00       	push   $0x8040a4
+  800319:	e8 41 04 00 00       	call   80075f <cprintf>
+  80031e:	83 c4 10             	add    $0x10,%esp
+  800321:	e9 81 fe ff ff       	jmp    8001a7 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	68 a4 40 80 00       	push   $0x8040a4
+  80032e:	e8 2c 04 00 00       	call   80075f <cprintf>
+  800333:	83 c4 10             	add    $0x10,%esp
+  800336:	e9 a5 fe ff ff       	jmp    8001e0 <check_regs+0x1ab>
+	CHECK(eip, eip);
+  80033b:	83 ec 0c             	sub    $0xc,%esp
+  80033e:	68 a4 40 80 00       	push   $0x8040a4
+  800343:	e8 17 04 00 00       	call   80075f <cprintf>
+  800348:	83 c4 10             	add    $0x10,%esp
+  80034b:	e9 c9 fe ff ff       	jmp    800219 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	68 a4 40 80 00       	push   $0x8040a4
+  800358:	e8 02 04 00 00       	call   80075f <cprintf>
+	CHECK(esp, esp);
+  80035d:	ff 73 28             	push   0x28(%ebx)
+  800360:	ff 76 28             	push   0x28(%esi)
+  800363:	68 d5 40 80 00       	push   $0x8040d5
+  800368:	68 94 40 80 00       	push   $0x804094
+  80036d:	e8 ed 03 00 00       	call   80075f <cprintf>
+  800372:	83 c4 20             	add    $0x20,%esp
+  800375:	8b 43 28             	mov    0x28(%ebx),%eax
+  800378:	39 46 28             	cmp    %eax,0x28(%esi)
+  80037b:	0f 85 ed fe ff ff    	jne    80026e <check_regs+0x239>
+  800381:	83 ec 0c             	sub    $0xc,%esp
+  800384:	68 a4 40 80 00       	push   $0x8040a4
+  800389:	e8 d1 03 00 00       	call   80075f <cprintf>
+	cprintf("Registers %s ", testname);
+  80038e:	83 c4 08             	add    $0x8,%esp
+  800391:	ff 75 0c             	push   0xc(%ebp)
+  800394:	68 d9 40 80 00       	push   $0x8040d9
+  800399:	e8 c1 03 00 00       	call   80075f <cprintf>
+	if (!mismatch)
+  80039e:	83 c4 10             	add    $0x10,%esp
+  8003a1:	85 ff                	test   %edi,%edi
+  8003a3:	0f 85 e5 fe ff ff    	jne    80028e <check_regs+0x259>
+		cprintf("OK\n");
+  8003a9:	83 ec 0c             	sub    $0xc,%esp
+  8003ac:	68 a4 40 80 00       	push   $0x8040a4
+  8003b1:	e8 a9 03 00 00       	call   80075f <cprintf>
+  8003b6:	83 c4 10             	add    $0x10,%esp
+}
+  8003b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bc:	5b                   	pop    %ebx
+  8003bd:	5e                   	pop    %esi
+  8003be:	5f                   	pop    %edi
+  8003bf:	5d                   	pop    %ebp
+  8003c0:	c3                   	ret
+	CHECK(esp, esp);
+  8003c1:	83 ec 0c             	sub    $0xc,%esp
+  8003c4:	68 a4 40 80 00       	push   $0x8040a4
+  8003c9:	e8 91 03 00 00       	call   80075f <cprintf>
+	cprintf("Registers %s ", testname);
+  8003ce:	83 c4 08             	add    $0x8,%esp
+  8003d1:	ff 75 0c             	push   0xc(%ebp)
+  8003d4:	68 d9 40 80 00       	push   $0x8040d9
+  8003d9:	e8 81 03 00 00       	call   80075f <cprintf>
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	e9 a8 fe ff ff       	jmp    80028e <check_regs+0x259>
+
+008003e6 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e6:	55                   	push   %ebp
+  8003e7:	89 e5                	mov    %esp,%ebp
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+  8003ec:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ef:	8b 10                	mov    (%eax),%edx
+  8003f1:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f7:	0f 85 9d 00 00 00    	jne    80049a <pgfault+0xb4>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fd:	8b 50 08             	mov    0x8(%eax),%edx
+  800400:	89 15 40 60 80 00    	mov    %edx,0x806040
+  800406:	8b 50 0c             	mov    0xc(%eax),%edx
+  800409:	89 15 44 60 80 00    	mov    %edx,0x806044
+  80040f:	8b 50 10             	mov    0x10(%eax),%edx
+  800412:	89 15 48 60 80 00    	mov    %edx,0x806048
+  800418:	8b 50 14             	mov    0x14(%eax),%edx
+  80041b:	89 15 4c 60 80 00    	mov    %edx,0x80604c
+  800421:	8b 50 18             	mov    0x18(%eax),%edx
+  800424:	89 15 50 60 80 00    	mov    %edx,0x806050
+  80042a:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042d:	89 15 54 60 80 00    	mov    %edx,0x806054
+  800433:	8b 50 20             	mov    0x20(%eax),%edx
+  800436:	89 15 58 60 80 00    	mov    %edx,0x806058
+  80043c:	8b 50 24             	mov    0x24(%eax),%edx
+  80043f:	89 15 5c 60 80 00    	mov    %edx,0x80605c
+	during.eip = utf->utf_eip;
+  800445:	8b 50 28             	mov    0x28(%eax),%edx
+  800448:	89 15 60 60 80 00    	mov    %edx,0x806060
+	during.eflags = utf->utf_eflags;
+  80044e:	8b 50 2c             	mov    0x2c(%eax),%edx
+  800451:	89 15 64 60 80 00    	mov    %edx,0x806064
+	during.esp = utf->utf_esp;
+  800457:	8b 40 30             	mov    0x30(%eax),%eax
+  80045a:	a3 68 60 80 00       	mov    %eax,0x806068
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  80045f:	83 ec 08             	sub    $0x8,%esp
+  800462:	68 ff 40 80 00       	push   $0x8040ff
+  800467:	68 0d 41 80 00       	push   $0x80410d
+  80046c:	b9 40 60 80 00       	mov    $0x806040,%ecx
+  800471:	ba f8 40 80 00       	mov    $0x8040f8,%edx
+  800476:	b8 80 60 80 00       	mov    $0x806080,%eax
+  80047b:	e8 b5 fb ff ff       	call   800035 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  800480:	83 c4 0c             	add    $0xc,%esp
+  800483:	6a 07                	push   $0x7
+  800485:	68 00 00 40 00       	push   $0x400000
+  80048a:	6a 00                	push   $0x0
+  80048c:	e8 f9 0d 00 00       	call   80128a <sys_page_alloc>
+  800491:	83 c4 10             	add    $0x10,%esp
+  800494:	85 c0                	test   %eax,%eax
+  800496:	78 1a                	js     8004b2 <pgfault+0xcc>
+		panic("sys_page_alloc: %e", r);
+}
+  800498:	c9                   	leave
+  800499:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  80049a:	83 ec 0c             	sub    $0xc,%esp
+  80049d:	ff 70 28             	push   0x28(%eax)
+  8004a0:	52                   	push   %edx
+  8004a1:	68 40 41 80 00       	push   $0x804140
+  8004a6:	6a 50                	push   $0x50
+  8004a8:	68 e7 40 80 00       	push   $0x8040e7
+  8004ad:	e8 d2 01 00 00       	call   800684 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8004b2:	50                   	push   %eax
+  8004b3:	68 14 41 80 00       	push   $0x804114
+  8004b8:	6a 5c                	push   $0x5c
+  8004ba:	68 e7 40 80 00       	push   $0x8040e7
+  8004bf:	e8 c0 01 00 00       	call   800684 <_panic>
+
+008004c4 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8004ca:	68 e6 03 80 00       	push   $0x8003e6
+  8004cf:	e8 19 12 00 00       	call   8016ed <set_pgfault_handler>
+
+	__asm __volatile(
+  8004d4:	50                   	push   %eax
+  8004d5:	9c                   	pushf
+  8004d6:	58                   	pop    %eax
+  8004d7:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004dc:	50                   	push   %eax
+  8004dd:	9d                   	popf
+  8004de:	a3 a4 60 80 00       	mov    %eax,0x8060a4
+  8004e3:	8d 05 1e 05 80 00    	lea    0x80051e,%eax
+  8004e9:	a3 a0 60 80 00       	mov    %eax,0x8060a0
+  8004ee:	58                   	pop    %eax
+  8004ef:	89 3d 80 60 80 00    	mov    %edi,0x806080
+  8004f5:	89 35 84 60 80 00    	mov    %esi,0x806084
+  8004fb:	89 2d 88 60 80 00    	mov    %ebp,0x806088
+  800501:	89 1d 90 60 80 00    	mov    %ebx,0x806090
+  800507:	89 15 94 60 80 00    	mov    %edx,0x806094
+  80050d:	89 0d 98 60 80 00    	mov    %ecx,0x806098
+  800513:	a3 9c 60 80 00       	mov    %eax,0x80609c
+  800518:	89 25 a8 60 80 00    	mov    %esp,0x8060a8
+  80051e:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800525:	00 00 00 
+  800528:	89 3d 00 60 80 00    	mov    %edi,0x806000
+  80052e:	89 35 04 60 80 00    	mov    %esi,0x806004
+  800534:	89 2d 08 60 80 00    	mov    %ebp,0x806008
+  80053a:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+  800540:	89 15 14 60 80 00    	mov    %edx,0x806014
+  800546:	89 0d 18 60 80 00    	mov    %ecx,0x806018
+  80054c:	a3 1c 60 80 00       	mov    %eax,0x80601c
+  800551:	89 25 28 60 80 00    	mov    %esp,0x806028
+  800557:	8b 3d 80 60 80 00    	mov    0x806080,%edi
+  80055d:	8b 35 84 60 80 00    	mov    0x806084,%esi
+  800563:	8b 2d 88 60 80 00    	mov    0x806088,%ebp
+  800569:	8b 1d 90 60 80 00    	mov    0x806090,%ebx
+  80056f:	8b 15 94 60 80 00    	mov    0x806094,%edx
+  800575:	8b 0d 98 60 80 00    	mov    0x806098,%ecx
+  80057b:	a1 9c 60 80 00       	mov    0x80609c,%eax
+  800580:	8b 25 a8 60 80 00    	mov    0x8060a8,%esp
+  800586:	50                   	push   %eax
+  800587:	9c                   	pushf
+  800588:	58                   	pop    %eax
+  800589:	a3 24 60 80 00       	mov    %eax,0x806024
+  80058e:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  80058f:	83 c4 10             	add    $0x10,%esp
+  800592:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  800599:	75 30                	jne    8005cb <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  80059b:	a1 a0 60 80 00       	mov    0x8060a0,%eax
+  8005a0:	a3 20 60 80 00       	mov    %eax,0x806020
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	68 27 41 80 00       	push   $0x804127
+  8005ad:	68 38 41 80 00       	push   $0x804138
+  8005b2:	b9 00 60 80 00       	mov    $0x806000,%ecx
+  8005b7:	ba f8 40 80 00       	mov    $0x8040f8,%edx
+  8005bc:	b8 80 60 80 00       	mov    $0x806080,%eax
+  8005c1:	e8 6f fa ff ff       	call   800035 <check_regs>
+}
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	c9                   	leave
+  8005ca:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005cb:	83 ec 0c             	sub    $0xc,%esp
+  8005ce:	68 74 41 80 00       	push   $0x804174
+  8005d3:	e8 87 01 00 00       	call   80075f <cprintf>
+  8005d8:	83 c4 10             	add    $0x10,%esp
+  8005db:	eb be                	jmp    80059b <umain+0xd7>
+
+008005dd <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005dd:	55                   	push   %ebp
+  8005de:	89 e5                	mov    %esp,%ebp
+  8005e0:	56                   	push   %esi
+  8005e1:	53                   	push   %ebx
+  8005e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8005e8:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8005ea:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8005ef:	29 d0                	sub    %edx,%eax
+  8005f1:	89 c2                	mov    %eax,%edx
+  8005f3:	c1 ea 0f             	shr    $0xf,%edx
+  8005f6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8005fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800600:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800603:	c7 04 85 e0 63 80 00 	movl   $0x0,0x8063e0(,%eax,4)
+  80060a:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80060e:	e8 39 0c 00 00       	call   80124c <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800613:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800618:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80061e:	89 e1                	mov    %esp,%ecx
+  800620:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800625:	29 ca                	sub    %ecx,%edx
+  800627:	89 d1                	mov    %edx,%ecx
+  800629:	c1 e9 0f             	shr    $0xf,%ecx
+  80062c:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800632:	ba 00 00 00 00       	mov    $0x0,%edx
+  800637:	0f 42 d1             	cmovb  %ecx,%edx
+  80063a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80063f:	89 04 95 e0 63 80 00 	mov    %eax,0x8063e0(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800646:	85 db                	test   %ebx,%ebx
+  800648:	7e 07                	jle    800651 <libmain+0x74>
+		binaryname = argv[0];
+  80064a:	8b 06                	mov    (%esi),%eax
+  80064c:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800651:	83 ec 08             	sub    $0x8,%esp
+  800654:	56                   	push   %esi
+  800655:	53                   	push   %ebx
+  800656:	e8 69 fe ff ff       	call   8004c4 <umain>
+
+	// exit gracefully
+	exit();
+  80065b:	e8 0a 00 00 00       	call   80066a <exit>
+}
+  800660:	83 c4 10             	add    $0x10,%esp
+  800663:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800666:	5b                   	pop    %ebx
+  800667:	5e                   	pop    %esi
+  800668:	5d                   	pop    %ebp
+  800669:	c3                   	ret
+
+0080066a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80066a:	55                   	push   %ebp
+  80066b:	89 e5                	mov    %esp,%ebp
+  80066d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800670:	e8 c5 12 00 00       	call   80193a <close_all>
+	sys_env_destroy(0);
+  800675:	83 ec 0c             	sub    $0xc,%esp
+  800678:	6a 00                	push   $0x0
+  80067a:	e8 8c 0b 00 00       	call   80120b <sys_env_destroy>
+}
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	c9                   	leave
+  800683:	c3                   	ret
+
+00800684 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800684:	55                   	push   %ebp
+  800685:	89 e5                	mov    %esp,%ebp
+  800687:	56                   	push   %esi
+  800688:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800689:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80068c:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800692:	e8 b5 0b 00 00       	call   80124c <sys_getenvid>
+  800697:	83 ec 0c             	sub    $0xc,%esp
+  80069a:	ff 75 0c             	push   0xc(%ebp)
+  80069d:	ff 75 08             	push   0x8(%ebp)
+  8006a0:	56                   	push   %esi
+  8006a1:	50                   	push   %eax
+  8006a2:	68 a0 41 80 00       	push   $0x8041a0
+  8006a7:	e8 b3 00 00 00       	call   80075f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006ac:	83 c4 18             	add    $0x18,%esp
+  8006af:	53                   	push   %ebx
+  8006b0:	ff 75 10             	push   0x10(%ebp)
+  8006b3:	e8 56 00 00 00       	call   80070e <vcprintf>
+	cprintf("\n");
+  8006b8:	c7 04 24 b0 40 80 00 	movl   $0x8040b0,(%esp)
+  8006bf:	e8 9b 00 00 00       	call   80075f <cprintf>
+  8006c4:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006c7:	cc                   	int3
+	while (1)
+  8006c8:	eb fd                	jmp    8006c7 <_panic+0x43>
+
+008006ca <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006ca:	55                   	push   %ebp
+  8006cb:	89 e5                	mov    %esp,%ebp
+  8006cd:	53                   	push   %ebx
+  8006ce:	83 ec 04             	sub    $0x4,%esp
+  8006d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8006d4:	8b 13                	mov    (%ebx),%edx
+  8006d6:	8d 42 01             	lea    0x1(%edx),%eax
+  8006d9:	89 03                	mov    %eax,(%ebx)
+  8006db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006de:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006e2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006e7:	74 09                	je     8006f2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006e9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006f0:	c9                   	leave
+  8006f1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	68 ff 00 00 00       	push   $0xff
+  8006fa:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006fd:	50                   	push   %eax
+  8006fe:	e8 cb 0a 00 00       	call   8011ce <sys_cputs>
+		b->idx = 0;
+  800703:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800709:	83 c4 10             	add    $0x10,%esp
+  80070c:	eb db                	jmp    8006e9 <putch+0x1f>
+
+0080070e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800717:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80071e:	00 00 00 
+	b.cnt = 0;
+  800721:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800728:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80072b:	ff 75 0c             	push   0xc(%ebp)
+  80072e:	ff 75 08             	push   0x8(%ebp)
+  800731:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800737:	50                   	push   %eax
+  800738:	68 ca 06 80 00       	push   $0x8006ca
+  80073d:	e8 1c 01 00 00       	call   80085e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800742:	83 c4 08             	add    $0x8,%esp
+  800745:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80074b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800751:	50                   	push   %eax
+  800752:	e8 77 0a 00 00       	call   8011ce <sys_cputs>
+
+	return b.cnt;
+}
+  800757:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80075d:	c9                   	leave
+  80075e:	c3                   	ret
+
+0080075f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80075f:	55                   	push   %ebp
+  800760:	89 e5                	mov    %esp,%ebp
+  800762:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800765:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800768:	50                   	push   %eax
+  800769:	ff 75 08             	push   0x8(%ebp)
+  80076c:	e8 9d ff ff ff       	call   80070e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800771:	c9                   	leave
+  800772:	c3                   	ret
+
+00800773 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800773:	55                   	push   %ebp
+  800774:	89 e5                	mov    %esp,%ebp
+  800776:	57                   	push   %edi
+  800777:	56                   	push   %esi
+  800778:	53                   	push   %ebx
+  800779:	83 ec 1c             	sub    $0x1c,%esp
+  80077c:	89 c3                	mov    %eax,%ebx
+  80077e:	89 d6                	mov    %edx,%esi
+  800780:	8b 45 08             	mov    0x8(%ebp),%eax
+  800783:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800786:	89 d1                	mov    %edx,%ecx
+  800788:	89 c2                	mov    %eax,%edx
+  80078a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80078d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800790:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800793:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800796:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80079d:	39 c2                	cmp    %eax,%edx
+  80079f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8007a2:	73 4b                	jae    8007ef <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8007a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a7:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8007aa:	85 ff                	test   %edi,%edi
+  8007ac:	7e 11                	jle    8007bf <printnum+0x4c>
+			putch(padc, putdat);
+  8007ae:	83 ec 08             	sub    $0x8,%esp
+  8007b1:	56                   	push   %esi
+  8007b2:	ff 75 18             	push   0x18(%ebp)
+  8007b5:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8007b7:	83 c4 10             	add    $0x10,%esp
+  8007ba:	83 ef 01             	sub    $0x1,%edi
+  8007bd:	75 ef                	jne    8007ae <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007bf:	83 ec 08             	sub    $0x8,%esp
+  8007c2:	56                   	push   %esi
+  8007c3:	83 ec 04             	sub    $0x4,%esp
+  8007c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8007c9:	ff 75 e0             	push   -0x20(%ebp)
+  8007cc:	ff 75 dc             	push   -0x24(%ebp)
+  8007cf:	ff 75 d8             	push   -0x28(%ebp)
+  8007d2:	e8 8e 37 00 00       	call   803f65 <__umoddi3>
+  8007d7:	83 c4 14             	add    $0x14,%esp
+  8007da:	0f be 80 c3 41 80 00 	movsbl 0x8041c3(%eax),%eax
+  8007e1:	50                   	push   %eax
+  8007e2:	ff d3                	call   *%ebx
+}
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ea:	5b                   	pop    %ebx
+  8007eb:	5e                   	pop    %esi
+  8007ec:	5f                   	pop    %edi
+  8007ed:	5d                   	pop    %ebp
+  8007ee:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007ef:	83 ec 0c             	sub    $0xc,%esp
+  8007f2:	ff 75 18             	push   0x18(%ebp)
+  8007f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007f8:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8007fb:	52                   	push   %edx
+  8007fc:	50                   	push   %eax
+  8007fd:	83 ec 08             	sub    $0x8,%esp
+  800800:	ff 75 e4             	push   -0x1c(%ebp)
+  800803:	ff 75 e0             	push   -0x20(%ebp)
+  800806:	ff 75 dc             	push   -0x24(%ebp)
+  800809:	ff 75 d8             	push   -0x28(%ebp)
+  80080c:	e8 8e 36 00 00       	call   803e9f <__udivdi3>
+  800811:	83 c4 18             	add    $0x18,%esp
+  800814:	52                   	push   %edx
+  800815:	50                   	push   %eax
+  800816:	89 f2                	mov    %esi,%edx
+  800818:	89 d8                	mov    %ebx,%eax
+  80081a:	e8 54 ff ff ff       	call   800773 <printnum>
+  80081f:	83 c4 20             	add    $0x20,%esp
+  800822:	eb 9b                	jmp    8007bf <printnum+0x4c>
+
+00800824 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80082a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80082e:	8b 10                	mov    (%eax),%edx
+  800830:	3b 50 04             	cmp    0x4(%eax),%edx
+  800833:	73 0a                	jae    80083f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800835:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800838:	89 08                	mov    %ecx,(%eax)
+  80083a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80083d:	88 02                	mov    %al,(%edx)
+}
+  80083f:	5d                   	pop    %ebp
+  800840:	c3                   	ret
+
+00800841 <printfmt>:
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800847:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80084a:	50                   	push   %eax
+  80084b:	ff 75 10             	push   0x10(%ebp)
+  80084e:	ff 75 0c             	push   0xc(%ebp)
+  800851:	ff 75 08             	push   0x8(%ebp)
+  800854:	e8 05 00 00 00       	call   80085e <vprintfmt>
+}
+  800859:	83 c4 10             	add    $0x10,%esp
+  80085c:	c9                   	leave
+  80085d:	c3                   	ret
+
+0080085e <vprintfmt>:
+{
+  80085e:	55                   	push   %ebp
+  80085f:	89 e5                	mov    %esp,%ebp
+  800861:	57                   	push   %edi
+  800862:	56                   	push   %esi
+  800863:	53                   	push   %ebx
+  800864:	83 ec 2c             	sub    $0x2c,%esp
+  800867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80086a:	89 df                	mov    %ebx,%edi
+  80086c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80086f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800872:	8d 70 01             	lea    0x1(%eax),%esi
+  800875:	0f b6 00             	movzbl (%eax),%eax
+  800878:	83 f8 25             	cmp    $0x25,%eax
+  80087b:	74 1e                	je     80089b <vprintfmt+0x3d>
+			if (ch == '\0')
+  80087d:	85 c0                	test   %eax,%eax
+  80087f:	0f 84 15 05 00 00    	je     800d9a <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800885:	83 ec 08             	sub    $0x8,%esp
+  800888:	53                   	push   %ebx
+  800889:	50                   	push   %eax
+  80088a:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80088c:	83 c6 01             	add    $0x1,%esi
+  80088f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800893:	83 c4 10             	add    $0x10,%esp
+  800896:	83 f8 25             	cmp    $0x25,%eax
+  800899:	75 e2                	jne    80087d <vprintfmt+0x1f>
+		padc = ' ';
+  80089b:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80089f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8008a6:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8008ad:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8008b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b9:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008bc:	8d 56 01             	lea    0x1(%esi),%edx
+  8008bf:	0f b6 0e             	movzbl (%esi),%ecx
+  8008c2:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8008c5:	3c 55                	cmp    $0x55,%al
+  8008c7:	0f 87 3b 04 00 00    	ja     800d08 <vprintfmt+0x4aa>
+  8008cd:	0f b6 c0             	movzbl %al,%eax
+  8008d0:	ff 24 85 40 43 80 00 	jmp    *0x804340(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008d7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008da:	eb 93                	jmp    80086f <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008dc:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8008de:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8008e2:	eb d8                	jmp    8008bc <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008e4:	89 d6                	mov    %edx,%esi
+  8008e6:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8008ea:	eb d0                	jmp    8008bc <vprintfmt+0x5e>
+  8008ec:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8008ef:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8008f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8008f5:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8008f9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8008fc:	83 f9 09             	cmp    $0x9,%ecx
+  8008ff:	77 6f                	ja     800970 <vprintfmt+0x112>
+  800901:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800904:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800907:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80090a:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80090e:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800911:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800914:	83 fe 09             	cmp    $0x9,%esi
+  800917:	76 eb                	jbe    800904 <vprintfmt+0xa6>
+  800919:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80091c:	89 d6                	mov    %edx,%esi
+  80091e:	eb 13                	jmp    800933 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800920:	8b 45 14             	mov    0x14(%ebp),%eax
+  800923:	8b 00                	mov    (%eax),%eax
+  800925:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800928:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092b:	8d 40 04             	lea    0x4(%eax),%eax
+  80092e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800931:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800933:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800937:	79 83                	jns    8008bc <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800939:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80093c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80093f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800946:	e9 71 ff ff ff       	jmp    8008bc <vprintfmt+0x5e>
+			if (width < 0)
+  80094b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80094e:	85 c9                	test   %ecx,%ecx
+  800950:	b8 00 00 00 00       	mov    $0x0,%eax
+  800955:	0f 49 c1             	cmovns %ecx,%eax
+  800958:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80095b:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80095d:	e9 5a ff ff ff       	jmp    8008bc <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800962:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800964:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80096b:	e9 4c ff ff ff       	jmp    8008bc <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800970:	89 d6                	mov    %edx,%esi
+  800972:	eb bf                	jmp    800933 <vprintfmt+0xd5>
+			lflag++;
+  800974:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800978:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80097a:	e9 3d ff ff ff       	jmp    8008bc <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80097f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800982:	8b 45 14             	mov    0x14(%ebp),%eax
+  800985:	8d 70 04             	lea    0x4(%eax),%esi
+  800988:	83 ec 08             	sub    $0x8,%esp
+  80098b:	53                   	push   %ebx
+  80098c:	ff 30                	push   (%eax)
+  80098e:	ff d7                	call   *%edi
+			break;
+  800990:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800993:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800996:	e9 d4 fe ff ff       	jmp    80086f <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80099b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80099e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a1:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8009a4:	8b 10                	mov    (%eax),%edx
+  8009a6:	89 d0                	mov    %edx,%eax
+  8009a8:	f7 d8                	neg    %eax
+  8009aa:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009ad:	83 f8 12             	cmp    $0x12,%eax
+  8009b0:	7f 23                	jg     8009d5 <vprintfmt+0x177>
+  8009b2:	8b 14 85 a0 44 80 00 	mov    0x8044a0(,%eax,4),%edx
+  8009b9:	85 d2                	test   %edx,%edx
+  8009bb:	74 18                	je     8009d5 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8009bd:	52                   	push   %edx
+  8009be:	68 fb 45 80 00       	push   $0x8045fb
+  8009c3:	53                   	push   %ebx
+  8009c4:	57                   	push   %edi
+  8009c5:	e8 77 fe ff ff       	call   800841 <printfmt>
+  8009ca:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009cd:	89 75 14             	mov    %esi,0x14(%ebp)
+  8009d0:	e9 9a fe ff ff       	jmp    80086f <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8009d5:	50                   	push   %eax
+  8009d6:	68 db 41 80 00       	push   $0x8041db
+  8009db:	53                   	push   %ebx
+  8009dc:	57                   	push   %edi
+  8009dd:	e8 5f fe ff ff       	call   800841 <printfmt>
+  8009e2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009e5:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8009e8:	e9 82 fe ff ff       	jmp    80086f <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009ed:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f3:	83 c0 04             	add    $0x4,%eax
+  8009f6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8009f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fc:	8b 00                	mov    (%eax),%eax
+  8009fe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800a01:	85 c0                	test   %eax,%eax
+  800a03:	0f 84 61 03 00 00    	je     800d6a <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800a09:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a0d:	7e 06                	jle    800a15 <vprintfmt+0x1b7>
+  800a0f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a13:	75 29                	jne    800a3e <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a15:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a18:	8d 70 01             	lea    0x1(%eax),%esi
+  800a1b:	0f b6 00             	movzbl (%eax),%eax
+  800a1e:	0f be d0             	movsbl %al,%edx
+  800a21:	85 d2                	test   %edx,%edx
+  800a23:	0f 84 bb 00 00 00    	je     800ae4 <vprintfmt+0x286>
+  800a29:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a2c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a2f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a32:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a35:	eb 7a                	jmp    800ab1 <vprintfmt+0x253>
+				p = "(null)";
+  800a37:	c7 45 d0 d4 41 80 00 	movl   $0x8041d4,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a3e:	83 ec 08             	sub    $0x8,%esp
+  800a41:	ff 75 d4             	push   -0x2c(%ebp)
+  800a44:	ff 75 d0             	push   -0x30(%ebp)
+  800a47:	e8 e0 03 00 00       	call   800e2c <strnlen>
+  800a4c:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800a4f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800a52:	83 c4 10             	add    $0x10,%esp
+  800a55:	85 d2                	test   %edx,%edx
+  800a57:	0f 8e d6 02 00 00    	jle    800d33 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800a5d:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800a61:	83 ec 08             	sub    $0x8,%esp
+  800a64:	53                   	push   %ebx
+  800a65:	56                   	push   %esi
+  800a66:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a68:	83 c4 10             	add    $0x10,%esp
+  800a6b:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800a6f:	75 f0                	jne    800a61 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a71:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a74:	8d 70 01             	lea    0x1(%eax),%esi
+  800a77:	0f b6 00             	movzbl (%eax),%eax
+  800a7a:	0f be d0             	movsbl %al,%edx
+  800a7d:	85 d2                	test   %edx,%edx
+  800a7f:	0f 84 da 02 00 00    	je     800d5f <vprintfmt+0x501>
+  800a85:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a88:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a8b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a8e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a91:	eb 1e                	jmp    800ab1 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800a93:	83 ec 08             	sub    $0x8,%esp
+  800a96:	ff 75 0c             	push   0xc(%ebp)
+  800a99:	52                   	push   %edx
+  800a9a:	ff 55 08             	call   *0x8(%ebp)
+  800a9d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800aa0:	83 eb 01             	sub    $0x1,%ebx
+  800aa3:	83 c6 01             	add    $0x1,%esi
+  800aa6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800aaa:	0f be d0             	movsbl %al,%edx
+  800aad:	85 d2                	test   %edx,%edx
+  800aaf:	74 2a                	je     800adb <vprintfmt+0x27d>
+  800ab1:	85 ff                	test   %edi,%edi
+  800ab3:	78 05                	js     800aba <vprintfmt+0x25c>
+  800ab5:	83 ef 01             	sub    $0x1,%edi
+  800ab8:	78 59                	js     800b13 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800aba:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800abe:	74 d3                	je     800a93 <vprintfmt+0x235>
+  800ac0:	0f be c0             	movsbl %al,%eax
+  800ac3:	83 e8 20             	sub    $0x20,%eax
+  800ac6:	83 f8 5e             	cmp    $0x5e,%eax
+  800ac9:	76 c8                	jbe    800a93 <vprintfmt+0x235>
+					putch('?', putdat);
+  800acb:	83 ec 08             	sub    $0x8,%esp
+  800ace:	ff 75 0c             	push   0xc(%ebp)
+  800ad1:	6a 3f                	push   $0x3f
+  800ad3:	ff 55 08             	call   *0x8(%ebp)
+  800ad6:	83 c4 10             	add    $0x10,%esp
+  800ad9:	eb c5                	jmp    800aa0 <vprintfmt+0x242>
+  800adb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ade:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ae1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800ae4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800ae7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800aeb:	7e 1b                	jle    800b08 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800aed:	83 ec 08             	sub    $0x8,%esp
+  800af0:	53                   	push   %ebx
+  800af1:	6a 20                	push   $0x20
+  800af3:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800af5:	83 c4 10             	add    $0x10,%esp
+  800af8:	83 ee 01             	sub    $0x1,%esi
+  800afb:	75 f0                	jne    800aed <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800afd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b00:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b03:	e9 67 fd ff ff       	jmp    80086f <vprintfmt+0x11>
+  800b08:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b0b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b0e:	e9 5c fd ff ff       	jmp    80086f <vprintfmt+0x11>
+  800b13:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b16:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b1c:	eb c6                	jmp    800ae4 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800b1e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b21:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b24:	83 f9 01             	cmp    $0x1,%ecx
+  800b27:	7f 1f                	jg     800b48 <vprintfmt+0x2ea>
+	else if (lflag)
+  800b29:	85 c9                	test   %ecx,%ecx
+  800b2b:	74 67                	je     800b94 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800b2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b30:	8b 30                	mov    (%eax),%esi
+  800b32:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b35:	89 f0                	mov    %esi,%eax
+  800b37:	c1 f8 1f             	sar    $0x1f,%eax
+  800b3a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b40:	8d 40 04             	lea    0x4(%eax),%eax
+  800b43:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b46:	eb 17                	jmp    800b5f <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800b48:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4b:	8b 50 04             	mov    0x4(%eax),%edx
+  800b4e:	8b 00                	mov    (%eax),%eax
+  800b50:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b53:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b56:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b59:	8d 40 08             	lea    0x8(%eax),%eax
+  800b5c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b5f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b62:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b65:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800b6a:	85 c9                	test   %ecx,%ecx
+  800b6c:	0f 89 12 01 00 00    	jns    800c84 <vprintfmt+0x426>
+				putch('-', putdat);
+  800b72:	83 ec 08             	sub    $0x8,%esp
+  800b75:	53                   	push   %ebx
+  800b76:	6a 2d                	push   $0x2d
+  800b78:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800b7a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b7d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b80:	f7 da                	neg    %edx
+  800b82:	83 d1 00             	adc    $0x0,%ecx
+  800b85:	f7 d9                	neg    %ecx
+  800b87:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b8a:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b8f:	e9 f0 00 00 00       	jmp    800c84 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800b94:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b97:	8b 30                	mov    (%eax),%esi
+  800b99:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b9c:	89 f0                	mov    %esi,%eax
+  800b9e:	c1 f8 1f             	sar    $0x1f,%eax
+  800ba1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800ba4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba7:	8d 40 04             	lea    0x4(%eax),%eax
+  800baa:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bad:	eb b0                	jmp    800b5f <vprintfmt+0x301>
+	if (lflag >= 2)
+  800baf:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800bb2:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bb5:	83 f9 01             	cmp    $0x1,%ecx
+  800bb8:	7f 1e                	jg     800bd8 <vprintfmt+0x37a>
+	else if (lflag)
+  800bba:	85 c9                	test   %ecx,%ecx
+  800bbc:	74 32                	je     800bf0 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800bbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc1:	8b 10                	mov    (%eax),%edx
+  800bc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc8:	8d 40 04             	lea    0x4(%eax),%eax
+  800bcb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bce:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800bd3:	e9 ac 00 00 00       	jmp    800c84 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800bd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bdb:	8b 10                	mov    (%eax),%edx
+  800bdd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800be0:	8d 40 08             	lea    0x8(%eax),%eax
+  800be3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800be6:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800beb:	e9 94 00 00 00       	jmp    800c84 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800bf0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf3:	8b 10                	mov    (%eax),%edx
+  800bf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfa:	8d 40 04             	lea    0x4(%eax),%eax
+  800bfd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c00:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800c05:	eb 7d                	jmp    800c84 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800c07:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c0a:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c0d:	83 f9 01             	cmp    $0x1,%ecx
+  800c10:	7f 1b                	jg     800c2d <vprintfmt+0x3cf>
+	else if (lflag)
+  800c12:	85 c9                	test   %ecx,%ecx
+  800c14:	74 2c                	je     800c42 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800c16:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c19:	8b 10                	mov    (%eax),%edx
+  800c1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c20:	8d 40 04             	lea    0x4(%eax),%eax
+  800c23:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c26:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800c2b:	eb 57                	jmp    800c84 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800c2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c30:	8b 10                	mov    (%eax),%edx
+  800c32:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c35:	8d 40 08             	lea    0x8(%eax),%eax
+  800c38:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c3b:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800c40:	eb 42                	jmp    800c84 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800c42:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c45:	8b 10                	mov    (%eax),%edx
+  800c47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c4c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c4f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c52:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800c57:	eb 2b                	jmp    800c84 <vprintfmt+0x426>
+			putch('0', putdat);
+  800c59:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c5c:	83 ec 08             	sub    $0x8,%esp
+  800c5f:	53                   	push   %ebx
+  800c60:	6a 30                	push   $0x30
+  800c62:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800c64:	83 c4 08             	add    $0x8,%esp
+  800c67:	53                   	push   %ebx
+  800c68:	6a 78                	push   $0x78
+  800c6a:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800c6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c6f:	8b 10                	mov    (%eax),%edx
+  800c71:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c76:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c79:	8d 40 04             	lea    0x4(%eax),%eax
+  800c7c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c7f:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800c84:	83 ec 0c             	sub    $0xc,%esp
+  800c87:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800c8b:	50                   	push   %eax
+  800c8c:	ff 75 e4             	push   -0x1c(%ebp)
+  800c8f:	56                   	push   %esi
+  800c90:	51                   	push   %ecx
+  800c91:	52                   	push   %edx
+  800c92:	89 da                	mov    %ebx,%edx
+  800c94:	89 f8                	mov    %edi,%eax
+  800c96:	e8 d8 fa ff ff       	call   800773 <printnum>
+			break;
+  800c9b:	83 c4 20             	add    $0x20,%esp
+  800c9e:	e9 cc fb ff ff       	jmp    80086f <vprintfmt+0x11>
+	if (lflag >= 2)
+  800ca3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ca6:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ca9:	83 f9 01             	cmp    $0x1,%ecx
+  800cac:	7f 1b                	jg     800cc9 <vprintfmt+0x46b>
+	else if (lflag)
+  800cae:	85 c9                	test   %ecx,%ecx
+  800cb0:	74 2c                	je     800cde <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800cb2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cb5:	8b 10                	mov    (%eax),%edx
+  800cb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cbc:	8d 40 04             	lea    0x4(%eax),%eax
+  800cbf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cc2:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800cc7:	eb bb                	jmp    800c84 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800cc9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ccc:	8b 10                	mov    (%eax),%edx
+  800cce:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cd1:	8d 40 08             	lea    0x8(%eax),%eax
+  800cd4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cd7:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800cdc:	eb a6                	jmp    800c84 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800cde:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce1:	8b 10                	mov    (%eax),%edx
+  800ce3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce8:	8d 40 04             	lea    0x4(%eax),%eax
+  800ceb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cee:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800cf3:	eb 8f                	jmp    800c84 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800cf5:	89 55 10             	mov    %edx,0x10(%ebp)
+  800cf8:	83 ec 08             	sub    $0x8,%esp
+  800cfb:	53                   	push   %ebx
+  800cfc:	6a 25                	push   $0x25
+  800cfe:	ff d7                	call   *%edi
+			break;
+  800d00:	83 c4 10             	add    $0x10,%esp
+  800d03:	e9 67 fb ff ff       	jmp    80086f <vprintfmt+0x11>
+			putch('%', putdat);
+  800d08:	83 ec 08             	sub    $0x8,%esp
+  800d0b:	53                   	push   %ebx
+  800d0c:	6a 25                	push   $0x25
+  800d0e:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d10:	83 c4 10             	add    $0x10,%esp
+  800d13:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800d17:	0f 84 ba fb ff ff    	je     8008d7 <vprintfmt+0x79>
+  800d1d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800d20:	89 f0                	mov    %esi,%eax
+  800d22:	83 e8 01             	sub    $0x1,%eax
+  800d25:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d29:	75 f7                	jne    800d22 <vprintfmt+0x4c4>
+  800d2b:	89 45 10             	mov    %eax,0x10(%ebp)
+  800d2e:	e9 3c fb ff ff       	jmp    80086f <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d33:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d36:	8d 70 01             	lea    0x1(%eax),%esi
+  800d39:	0f b6 00             	movzbl (%eax),%eax
+  800d3c:	0f be d0             	movsbl %al,%edx
+  800d3f:	85 d2                	test   %edx,%edx
+  800d41:	74 11                	je     800d54 <vprintfmt+0x4f6>
+  800d43:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d46:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d49:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d4c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d4f:	e9 5d fd ff ff       	jmp    800ab1 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d54:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d57:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d5a:	e9 10 fb ff ff       	jmp    80086f <vprintfmt+0x11>
+  800d5f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d62:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d65:	e9 05 fb ff ff       	jmp    80086f <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800d6a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800d6e:	7e 0a                	jle    800d7a <vprintfmt+0x51c>
+  800d70:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800d74:	0f 85 bd fc ff ff    	jne    800a37 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d7a:	ba 28 00 00 00       	mov    $0x28,%edx
+  800d7f:	b8 28 00 00 00       	mov    $0x28,%eax
+  800d84:	be d5 41 80 00       	mov    $0x8041d5,%esi
+  800d89:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d8c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d8f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d92:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d95:	e9 17 fd ff ff       	jmp    800ab1 <vprintfmt+0x253>
+}
+  800d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+
+00800da2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	83 ec 18             	sub    $0x18,%esp
+  800da8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800dae:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800db1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800db5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800db8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	74 26                	je     800de9 <vsnprintf+0x47>
+  800dc3:	85 d2                	test   %edx,%edx
+  800dc5:	7e 22                	jle    800de9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800dc7:	ff 75 14             	push   0x14(%ebp)
+  800dca:	ff 75 10             	push   0x10(%ebp)
+  800dcd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800dd0:	50                   	push   %eax
+  800dd1:	68 24 08 80 00       	push   $0x800824
+  800dd6:	e8 83 fa ff ff       	call   80085e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ddb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800dde:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800de4:	83 c4 10             	add    $0x10,%esp
+}
+  800de7:	c9                   	leave
+  800de8:	c3                   	ret
+		return -E_INVAL;
+  800de9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dee:	eb f7                	jmp    800de7 <vsnprintf+0x45>
+
+00800df0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800df6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800df9:	50                   	push   %eax
+  800dfa:	ff 75 10             	push   0x10(%ebp)
+  800dfd:	ff 75 0c             	push   0xc(%ebp)
+  800e00:	ff 75 08             	push   0x8(%ebp)
+  800e03:	e8 9a ff ff ff       	call   800da2 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800e08:	c9                   	leave
+  800e09:	c3                   	ret
+
+00800e0a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800e10:	80 3a 00             	cmpb   $0x0,(%edx)
+  800e13:	74 10                	je     800e25 <strlen+0x1b>
+  800e15:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800e1a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800e1d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800e21:	75 f7                	jne    800e1a <strlen+0x10>
+	return n;
+}
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800e25:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800e2a:	eb f7                	jmp    800e23 <strlen+0x19>
+
+00800e2c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e35:	85 d2                	test   %edx,%edx
+  800e37:	74 16                	je     800e4f <strnlen+0x23>
+  800e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800e42:	74 09                	je     800e4d <strnlen+0x21>
+		n++;
+  800e44:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e47:	39 d0                	cmp    %edx,%eax
+  800e49:	75 f3                	jne    800e3e <strnlen+0x12>
+		n++;
+  800e4b:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800e4d:	5d                   	pop    %ebp
+  800e4e:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e54:	eb f7                	jmp    800e4d <strnlen+0x21>
+
+00800e56 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	53                   	push   %ebx
+  800e5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e65:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e69:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e6c:	83 c0 01             	add    $0x1,%eax
+  800e6f:	84 d2                	test   %dl,%dl
+  800e71:	75 f2                	jne    800e65 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800e73:	89 c8                	mov    %ecx,%eax
+  800e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e78:	c9                   	leave
+  800e79:	c3                   	ret
+
+00800e7a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	53                   	push   %ebx
+  800e7e:	83 ec 10             	sub    $0x10,%esp
+  800e81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e84:	53                   	push   %ebx
+  800e85:	e8 80 ff ff ff       	call   800e0a <strlen>
+  800e8a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e8d:	ff 75 0c             	push   0xc(%ebp)
+  800e90:	01 d8                	add    %ebx,%eax
+  800e92:	50                   	push   %eax
+  800e93:	e8 be ff ff ff       	call   800e56 <strcpy>
+	return dst;
+}
+  800e98:	89 d8                	mov    %ebx,%eax
+  800e9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e9d:	c9                   	leave
+  800e9e:	c3                   	ret
+
+00800e9f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800eaa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ead:	85 db                	test   %ebx,%ebx
+  800eaf:	74 17                	je     800ec8 <strncpy+0x29>
+  800eb1:	01 f3                	add    %esi,%ebx
+  800eb3:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800eb5:	83 c0 01             	add    $0x1,%eax
+  800eb8:	0f b6 0a             	movzbl (%edx),%ecx
+  800ebb:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ebe:	80 f9 01             	cmp    $0x1,%cl
+  800ec1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ec4:	39 c3                	cmp    %eax,%ebx
+  800ec6:	75 ed                	jne    800eb5 <strncpy+0x16>
+	}
+	return ret;
+}
+  800ec8:	89 f0                	mov    %esi,%eax
+  800eca:	5b                   	pop    %ebx
+  800ecb:	5e                   	pop    %esi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+
+00800ece <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	56                   	push   %esi
+  800ed2:	53                   	push   %ebx
+  800ed3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ed6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ed9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800edc:	89 f0                	mov    %esi,%eax
+  800ede:	85 db                	test   %ebx,%ebx
+  800ee0:	74 1e                	je     800f00 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800ee2:	83 eb 01             	sub    $0x1,%ebx
+  800ee5:	74 16                	je     800efd <strlcpy+0x2f>
+  800ee7:	01 f3                	add    %esi,%ebx
+  800ee9:	0f b6 0a             	movzbl (%edx),%ecx
+  800eec:	84 c9                	test   %cl,%cl
+  800eee:	74 0d                	je     800efd <strlcpy+0x2f>
+			*dst++ = *src++;
+  800ef0:	83 c2 01             	add    $0x1,%edx
+  800ef3:	83 c0 01             	add    $0x1,%eax
+  800ef6:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ef9:	39 d8                	cmp    %ebx,%eax
+  800efb:	75 ec                	jne    800ee9 <strlcpy+0x1b>
+		*dst = '\0';
+  800efd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800f00:	29 f0                	sub    %esi,%eax
+}
+  800f02:	5b                   	pop    %ebx
+  800f03:	5e                   	pop    %esi
+  800f04:	5d                   	pop    %ebp
+  800f05:	c3                   	ret
+
+00800f06 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800f06:	55                   	push   %ebp
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800f0f:	0f b6 01             	movzbl (%ecx),%eax
+  800f12:	84 c0                	test   %al,%al
+  800f14:	74 11                	je     800f27 <strcmp+0x21>
+  800f16:	38 02                	cmp    %al,(%edx)
+  800f18:	75 0d                	jne    800f27 <strcmp+0x21>
+		p++, q++;
+  800f1a:	83 c1 01             	add    $0x1,%ecx
+  800f1d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800f20:	0f b6 01             	movzbl (%ecx),%eax
+  800f23:	84 c0                	test   %al,%al
+  800f25:	75 ef                	jne    800f16 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f27:	0f b6 c0             	movzbl %al,%eax
+  800f2a:	0f b6 12             	movzbl (%edx),%edx
+  800f2d:	29 d0                	sub    %edx,%eax
+}
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+
+00800f31 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	53                   	push   %ebx
+  800f35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f3b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800f43:	85 d2                	test   %edx,%edx
+  800f45:	74 2e                	je     800f75 <strncmp+0x44>
+  800f47:	0f b6 01             	movzbl (%ecx),%eax
+  800f4a:	84 c0                	test   %al,%al
+  800f4c:	74 16                	je     800f64 <strncmp+0x33>
+  800f4e:	3a 03                	cmp    (%ebx),%al
+  800f50:	75 12                	jne    800f64 <strncmp+0x33>
+		n--, p++, q++;
+  800f52:	83 c1 01             	add    $0x1,%ecx
+  800f55:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800f58:	83 ea 01             	sub    $0x1,%edx
+  800f5b:	75 ea                	jne    800f47 <strncmp+0x16>
+		return 0;
+  800f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f62:	eb 11                	jmp    800f75 <strncmp+0x44>
+  800f64:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800f69:	85 d2                	test   %edx,%edx
+  800f6b:	74 08                	je     800f75 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f6d:	0f b6 01             	movzbl (%ecx),%eax
+  800f70:	0f b6 13             	movzbl (%ebx),%edx
+  800f73:	29 d0                	sub    %edx,%eax
+}
+  800f75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f78:	c9                   	leave
+  800f79:	c3                   	ret
+
+00800f7a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f80:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f84:	0f b6 10             	movzbl (%eax),%edx
+  800f87:	84 d2                	test   %dl,%dl
+  800f89:	74 15                	je     800fa0 <strchr+0x26>
+		if (*s == c)
+  800f8b:	38 d1                	cmp    %dl,%cl
+  800f8d:	74 0f                	je     800f9e <strchr+0x24>
+	for (; *s; s++)
+  800f8f:	83 c0 01             	add    $0x1,%eax
+  800f92:	0f b6 10             	movzbl (%eax),%edx
+  800f95:	84 d2                	test   %dl,%dl
+  800f97:	75 f2                	jne    800f8b <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800f99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+	return 0;
+  800fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa5:	eb f7                	jmp    800f9e <strchr+0x24>
+
+00800fa7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800fa7:	55                   	push   %ebp
+  800fa8:	89 e5                	mov    %esp,%ebp
+  800faa:	53                   	push   %ebx
+  800fab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800fb1:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800fb4:	38 d3                	cmp    %dl,%bl
+  800fb6:	74 14                	je     800fcc <strfind+0x25>
+  800fb8:	89 d1                	mov    %edx,%ecx
+  800fba:	84 db                	test   %bl,%bl
+  800fbc:	74 0e                	je     800fcc <strfind+0x25>
+	for (; *s; s++)
+  800fbe:	83 c0 01             	add    $0x1,%eax
+  800fc1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800fc4:	38 ca                	cmp    %cl,%dl
+  800fc6:	74 04                	je     800fcc <strfind+0x25>
+  800fc8:	84 d2                	test   %dl,%dl
+  800fca:	75 f2                	jne    800fbe <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800fcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fcf:	c9                   	leave
+  800fd0:	c3                   	ret
+
+00800fd1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fd8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800fdb:	85 c9                	test   %ecx,%ecx
+  800fdd:	74 20                	je     800fff <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800fdf:	89 f8                	mov    %edi,%eax
+  800fe1:	09 c8                	or     %ecx,%eax
+  800fe3:	a8 03                	test   $0x3,%al
+  800fe5:	75 12                	jne    800ff9 <memset+0x28>
+		c &= 0xFF;
+  800fe7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800feb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ff1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ff4:	fc                   	cld
+  800ff5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ff7:	eb 06                	jmp    800fff <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ff9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ffc:	fc                   	cld
+  800ffd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800fff:	89 f8                	mov    %edi,%eax
+  801001:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801004:	c9                   	leave
+  801005:	c3                   	ret
+
+00801006 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	57                   	push   %edi
+  80100a:	56                   	push   %esi
+  80100b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80100e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801011:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801014:	39 c6                	cmp    %eax,%esi
+  801016:	73 32                	jae    80104a <memmove+0x44>
+  801018:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80101b:	39 d0                	cmp    %edx,%eax
+  80101d:	73 2b                	jae    80104a <memmove+0x44>
+		s += n;
+		d += n;
+  80101f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801022:	89 d6                	mov    %edx,%esi
+  801024:	09 fe                	or     %edi,%esi
+  801026:	09 ce                	or     %ecx,%esi
+  801028:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80102e:	75 0e                	jne    80103e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801030:	83 ef 04             	sub    $0x4,%edi
+  801033:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801036:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801039:	fd                   	std
+  80103a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80103c:	eb 09                	jmp    801047 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80103e:	83 ef 01             	sub    $0x1,%edi
+  801041:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801044:	fd                   	std
+  801045:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801047:	fc                   	cld
+  801048:	eb 1a                	jmp    801064 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80104a:	89 f2                	mov    %esi,%edx
+  80104c:	09 c2                	or     %eax,%edx
+  80104e:	09 ca                	or     %ecx,%edx
+  801050:	f6 c2 03             	test   $0x3,%dl
+  801053:	75 0a                	jne    80105f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801055:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801058:	89 c7                	mov    %eax,%edi
+  80105a:	fc                   	cld
+  80105b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80105d:	eb 05                	jmp    801064 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80105f:	89 c7                	mov    %eax,%edi
+  801061:	fc                   	cld
+  801062:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+
+00801068 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  801068:	55                   	push   %ebp
+  801069:	89 e5                	mov    %esp,%ebp
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80106e:	ff 75 10             	push   0x10(%ebp)
+  801071:	ff 75 0c             	push   0xc(%ebp)
+  801074:	ff 75 08             	push   0x8(%ebp)
+  801077:	e8 8a ff ff ff       	call   801006 <memmove>
+}
+  80107c:	c9                   	leave
+  80107d:	c3                   	ret
+
+0080107e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	8b 45 08             	mov    0x8(%ebp),%eax
+  801086:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801089:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80108c:	85 f6                	test   %esi,%esi
+  80108e:	74 29                	je     8010b9 <memcmp+0x3b>
+  801090:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  801092:	0f b6 08             	movzbl (%eax),%ecx
+  801095:	0f b6 1a             	movzbl (%edx),%ebx
+  801098:	38 d9                	cmp    %bl,%cl
+  80109a:	75 11                	jne    8010ad <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80109c:	83 c0 01             	add    $0x1,%eax
+  80109f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8010a2:	39 c6                	cmp    %eax,%esi
+  8010a4:	75 ec                	jne    801092 <memcmp+0x14>
+	}
+
+	return 0;
+  8010a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ab:	eb 08                	jmp    8010b5 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  8010ad:	0f b6 c1             	movzbl %cl,%eax
+  8010b0:	0f b6 db             	movzbl %bl,%ebx
+  8010b3:	29 d8                	sub    %ebx,%eax
+}
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+	return 0;
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010be:	eb f5                	jmp    8010b5 <memcmp+0x37>
+
+008010c0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8010c9:	89 c2                	mov    %eax,%edx
+  8010cb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8010ce:	39 d0                	cmp    %edx,%eax
+  8010d0:	73 0d                	jae    8010df <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8010d2:	38 08                	cmp    %cl,(%eax)
+  8010d4:	74 0d                	je     8010e3 <memfind+0x23>
+	for (; s < ends; s++)
+  8010d6:	83 c0 01             	add    $0x1,%eax
+  8010d9:	39 c2                	cmp    %eax,%edx
+  8010db:	75 f5                	jne    8010d2 <memfind+0x12>
+  8010dd:	eb 06                	jmp    8010e5 <memfind+0x25>
+  8010df:	89 c2                	mov    %eax,%edx
+  8010e1:	eb 02                	jmp    8010e5 <memfind+0x25>
+  8010e3:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  8010e5:	89 d0                	mov    %edx,%eax
+  8010e7:	5d                   	pop    %ebp
+  8010e8:	c3                   	ret
+
+008010e9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8010f5:	0f b6 02             	movzbl (%edx),%eax
+  8010f8:	3c 20                	cmp    $0x20,%al
+  8010fa:	74 04                	je     801100 <strtol+0x17>
+  8010fc:	3c 09                	cmp    $0x9,%al
+  8010fe:	75 0e                	jne    80110e <strtol+0x25>
+		s++;
+  801100:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801103:	0f b6 02             	movzbl (%edx),%eax
+  801106:	3c 20                	cmp    $0x20,%al
+  801108:	74 f6                	je     801100 <strtol+0x17>
+  80110a:	3c 09                	cmp    $0x9,%al
+  80110c:	74 f2                	je     801100 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  80110e:	3c 2b                	cmp    $0x2b,%al
+  801110:	74 2a                	je     80113c <strtol+0x53>
+	int neg = 0;
+  801112:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801117:	3c 2d                	cmp    $0x2d,%al
+  801119:	74 2b                	je     801146 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80111b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801121:	75 0f                	jne    801132 <strtol+0x49>
+  801123:	80 3a 30             	cmpb   $0x30,(%edx)
+  801126:	74 28                	je     801150 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801128:	85 db                	test   %ebx,%ebx
+  80112a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80112f:	0f 44 d8             	cmove  %eax,%ebx
+  801132:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801137:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80113a:	eb 46                	jmp    801182 <strtol+0x99>
+		s++;
+  80113c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80113f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801144:	eb d5                	jmp    80111b <strtol+0x32>
+		s++, neg = 1;
+  801146:	83 c2 01             	add    $0x1,%edx
+  801149:	bf 01 00 00 00       	mov    $0x1,%edi
+  80114e:	eb cb                	jmp    80111b <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801150:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801154:	74 0e                	je     801164 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  801156:	85 db                	test   %ebx,%ebx
+  801158:	75 d8                	jne    801132 <strtol+0x49>
+		s++, base = 8;
+  80115a:	83 c2 01             	add    $0x1,%edx
+  80115d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801162:	eb ce                	jmp    801132 <strtol+0x49>
+		s += 2, base = 16;
+  801164:	83 c2 02             	add    $0x2,%edx
+  801167:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80116c:	eb c4                	jmp    801132 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80116e:	0f be c0             	movsbl %al,%eax
+  801171:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801174:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801177:	7d 3a                	jge    8011b3 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  801179:	83 c2 01             	add    $0x1,%edx
+  80117c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801180:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801182:	0f b6 02             	movzbl (%edx),%eax
+  801185:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801188:	89 f3                	mov    %esi,%ebx
+  80118a:	80 fb 09             	cmp    $0x9,%bl
+  80118d:	76 df                	jbe    80116e <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  80118f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801192:	89 f3                	mov    %esi,%ebx
+  801194:	80 fb 19             	cmp    $0x19,%bl
+  801197:	77 08                	ja     8011a1 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  801199:	0f be c0             	movsbl %al,%eax
+  80119c:	83 e8 57             	sub    $0x57,%eax
+  80119f:	eb d3                	jmp    801174 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8011a1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8011a4:	89 f3                	mov    %esi,%ebx
+  8011a6:	80 fb 19             	cmp    $0x19,%bl
+  8011a9:	77 08                	ja     8011b3 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8011ab:	0f be c0             	movsbl %al,%eax
+  8011ae:	83 e8 37             	sub    $0x37,%eax
+  8011b1:	eb c1                	jmp    801174 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8011b3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8011b7:	74 05                	je     8011be <strtol+0xd5>
+		*endptr = (char *) s;
+  8011b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011bc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8011be:	89 c8                	mov    %ecx,%eax
+  8011c0:	f7 d8                	neg    %eax
+  8011c2:	85 ff                	test   %edi,%edi
+  8011c4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8011c7:	89 c8                	mov    %ecx,%eax
+  8011c9:	5b                   	pop    %ebx
+  8011ca:	5e                   	pop    %esi
+  8011cb:	5f                   	pop    %edi
+  8011cc:	5d                   	pop    %ebp
+  8011cd:	c3                   	ret
+
+008011ce <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	57                   	push   %edi
+  8011d2:	56                   	push   %esi
+  8011d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011df:	89 c3                	mov    %eax,%ebx
+  8011e1:	89 c7                	mov    %eax,%edi
+  8011e3:	89 c6                	mov    %eax,%esi
+  8011e5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+
+008011ec <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	57                   	push   %edi
+  8011f0:	56                   	push   %esi
+  8011f1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011fc:	89 d1                	mov    %edx,%ecx
+  8011fe:	89 d3                	mov    %edx,%ebx
+  801200:	89 d7                	mov    %edx,%edi
+  801202:	89 d6                	mov    %edx,%esi
+  801204:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+
+0080120b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+  801211:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801214:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801221:	89 cb                	mov    %ecx,%ebx
+  801223:	89 cf                	mov    %ecx,%edi
+  801225:	89 ce                	mov    %ecx,%esi
+  801227:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801229:	85 c0                	test   %eax,%eax
+  80122b:	7f 08                	jg     801235 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80122d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801230:	5b                   	pop    %ebx
+  801231:	5e                   	pop    %esi
+  801232:	5f                   	pop    %edi
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801235:	83 ec 0c             	sub    $0xc,%esp
+  801238:	50                   	push   %eax
+  801239:	6a 03                	push   $0x3
+  80123b:	68 0b 45 80 00       	push   $0x80450b
+  801240:	6a 23                	push   $0x23
+  801242:	68 28 45 80 00       	push   $0x804528
+  801247:	e8 38 f4 ff ff       	call   800684 <_panic>
+
+0080124c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801252:	ba 00 00 00 00       	mov    $0x0,%edx
+  801257:	b8 02 00 00 00       	mov    $0x2,%eax
+  80125c:	89 d1                	mov    %edx,%ecx
+  80125e:	89 d3                	mov    %edx,%ebx
+  801260:	89 d7                	mov    %edx,%edi
+  801262:	89 d6                	mov    %edx,%esi
+  801264:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+
+0080126b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801271:	ba 00 00 00 00       	mov    $0x0,%edx
+  801276:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80127b:	89 d1                	mov    %edx,%ecx
+  80127d:	89 d3                	mov    %edx,%ebx
+  80127f:	89 d7                	mov    %edx,%edi
+  801281:	89 d6                	mov    %edx,%esi
+  801283:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+
+0080128a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	53                   	push   %ebx
+  801290:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801293:	be 00 00 00 00       	mov    $0x0,%esi
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129e:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a6:	89 f7                	mov    %esi,%edi
+  8012a8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012aa:	85 c0                	test   %eax,%eax
+  8012ac:	7f 08                	jg     8012b6 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8012ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5f                   	pop    %edi
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b6:	83 ec 0c             	sub    $0xc,%esp
+  8012b9:	50                   	push   %eax
+  8012ba:	6a 04                	push   $0x4
+  8012bc:	68 0b 45 80 00       	push   $0x80450b
+  8012c1:	6a 23                	push   $0x23
+  8012c3:	68 28 45 80 00       	push   $0x804528
+  8012c8:	e8 b7 f3 ff ff       	call   800684 <_panic>
+
+008012cd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	57                   	push   %edi
+  8012d1:	56                   	push   %esi
+  8012d2:	53                   	push   %ebx
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012e7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012ea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ec:	85 c0                	test   %eax,%eax
+  8012ee:	7f 08                	jg     8012f8 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8012f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f8:	83 ec 0c             	sub    $0xc,%esp
+  8012fb:	50                   	push   %eax
+  8012fc:	6a 05                	push   $0x5
+  8012fe:	68 0b 45 80 00       	push   $0x80450b
+  801303:	6a 23                	push   $0x23
+  801305:	68 28 45 80 00       	push   $0x804528
+  80130a:	e8 75 f3 ff ff       	call   800684 <_panic>
+
+0080130f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+  801315:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801318:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801323:	b8 06 00 00 00       	mov    $0x6,%eax
+  801328:	89 df                	mov    %ebx,%edi
+  80132a:	89 de                	mov    %ebx,%esi
+  80132c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80132e:	85 c0                	test   %eax,%eax
+  801330:	7f 08                	jg     80133a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801335:	5b                   	pop    %ebx
+  801336:	5e                   	pop    %esi
+  801337:	5f                   	pop    %edi
+  801338:	5d                   	pop    %ebp
+  801339:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80133a:	83 ec 0c             	sub    $0xc,%esp
+  80133d:	50                   	push   %eax
+  80133e:	6a 06                	push   $0x6
+  801340:	68 0b 45 80 00       	push   $0x80450b
+  801345:	6a 23                	push   $0x23
+  801347:	68 28 45 80 00       	push   $0x804528
+  80134c:	e8 33 f3 ff ff       	call   800684 <_panic>
+
+00801351 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	57                   	push   %edi
+  801355:	56                   	push   %esi
+  801356:	53                   	push   %ebx
+  801357:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80135a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801362:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801365:	b8 08 00 00 00       	mov    $0x8,%eax
+  80136a:	89 df                	mov    %ebx,%edi
+  80136c:	89 de                	mov    %ebx,%esi
+  80136e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801370:	85 c0                	test   %eax,%eax
+  801372:	7f 08                	jg     80137c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801374:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5f                   	pop    %edi
+  80137a:	5d                   	pop    %ebp
+  80137b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80137c:	83 ec 0c             	sub    $0xc,%esp
+  80137f:	50                   	push   %eax
+  801380:	6a 08                	push   $0x8
+  801382:	68 0b 45 80 00       	push   $0x80450b
+  801387:	6a 23                	push   $0x23
+  801389:	68 28 45 80 00       	push   $0x804528
+  80138e:	e8 f1 f2 ff ff       	call   800684 <_panic>
+
+00801393 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	57                   	push   %edi
+  801397:	56                   	push   %esi
+  801398:	53                   	push   %ebx
+  801399:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80139c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8013ac:	89 df                	mov    %ebx,%edi
+  8013ae:	89 de                	mov    %ebx,%esi
+  8013b0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013b2:	85 c0                	test   %eax,%eax
+  8013b4:	7f 08                	jg     8013be <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8013b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b9:	5b                   	pop    %ebx
+  8013ba:	5e                   	pop    %esi
+  8013bb:	5f                   	pop    %edi
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013be:	83 ec 0c             	sub    $0xc,%esp
+  8013c1:	50                   	push   %eax
+  8013c2:	6a 09                	push   $0x9
+  8013c4:	68 0b 45 80 00       	push   $0x80450b
+  8013c9:	6a 23                	push   $0x23
+  8013cb:	68 28 45 80 00       	push   $0x804528
+  8013d0:	e8 af f2 ff ff       	call   800684 <_panic>
+
+008013d5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	57                   	push   %edi
+  8013d9:	56                   	push   %esi
+  8013da:	53                   	push   %ebx
+  8013db:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013ee:	89 df                	mov    %ebx,%edi
+  8013f0:	89 de                	mov    %ebx,%esi
+  8013f2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	7f 08                	jg     801400 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8013f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fb:	5b                   	pop    %ebx
+  8013fc:	5e                   	pop    %esi
+  8013fd:	5f                   	pop    %edi
+  8013fe:	5d                   	pop    %ebp
+  8013ff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801400:	83 ec 0c             	sub    $0xc,%esp
+  801403:	50                   	push   %eax
+  801404:	6a 0a                	push   $0xa
+  801406:	68 0b 45 80 00       	push   $0x80450b
+  80140b:	6a 23                	push   $0x23
+  80140d:	68 28 45 80 00       	push   $0x804528
+  801412:	e8 6d f2 ff ff       	call   800684 <_panic>
+
+00801417 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	57                   	push   %edi
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80141d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801423:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801428:	be 00 00 00 00       	mov    $0x0,%esi
+  80142d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801430:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801433:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801435:	5b                   	pop    %ebx
+  801436:	5e                   	pop    %esi
+  801437:	5f                   	pop    %edi
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+
+0080143a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	57                   	push   %edi
+  80143e:	56                   	push   %esi
+  80143f:	53                   	push   %ebx
+  801440:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801443:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801450:	89 cb                	mov    %ecx,%ebx
+  801452:	89 cf                	mov    %ecx,%edi
+  801454:	89 ce                	mov    %ecx,%esi
+  801456:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801458:	85 c0                	test   %eax,%eax
+  80145a:	7f 08                	jg     801464 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80145c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145f:	5b                   	pop    %ebx
+  801460:	5e                   	pop    %esi
+  801461:	5f                   	pop    %edi
+  801462:	5d                   	pop    %ebp
+  801463:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801464:	83 ec 0c             	sub    $0xc,%esp
+  801467:	50                   	push   %eax
+  801468:	6a 0d                	push   $0xd
+  80146a:	68 0b 45 80 00       	push   $0x80450b
+  80146f:	6a 23                	push   $0x23
+  801471:	68 28 45 80 00       	push   $0x804528
+  801476:	e8 09 f2 ff ff       	call   800684 <_panic>
+
+0080147b <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	57                   	push   %edi
+  80147f:	56                   	push   %esi
+  801480:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801481:	8b 55 08             	mov    0x8(%ebp),%edx
+  801484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801487:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80148c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80148f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801492:	8b 75 18             	mov    0x18(%ebp),%esi
+  801495:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801497:	5b                   	pop    %ebx
+  801498:	5e                   	pop    %esi
+  801499:	5f                   	pop    %edi
+  80149a:	5d                   	pop    %ebp
+  80149b:	c3                   	ret
+
+0080149c <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	57                   	push   %edi
+  8014a0:	56                   	push   %esi
+  8014a1:	53                   	push   %ebx
+  8014a2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014b5:	89 df                	mov    %ebx,%edi
+  8014b7:	89 de                	mov    %ebx,%esi
+  8014b9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014bb:	85 c0                	test   %eax,%eax
+  8014bd:	7f 08                	jg     8014c7 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8014bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c2:	5b                   	pop    %ebx
+  8014c3:	5e                   	pop    %esi
+  8014c4:	5f                   	pop    %edi
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014c7:	83 ec 0c             	sub    $0xc,%esp
+  8014ca:	50                   	push   %eax
+  8014cb:	6a 0d                	push   $0xd
+  8014cd:	68 0b 45 80 00       	push   $0x80450b
+  8014d2:	6a 23                	push   $0x23
+  8014d4:	68 28 45 80 00       	push   $0x804528
+  8014d9:	e8 a6 f1 ff ff       	call   800684 <_panic>
+
+008014de <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8014de:	55                   	push   %ebp
+  8014df:	89 e5                	mov    %esp,%ebp
+  8014e1:	57                   	push   %edi
+  8014e2:	56                   	push   %esi
+  8014e3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014ee:	89 d1                	mov    %edx,%ecx
+  8014f0:	89 d3                	mov    %edx,%ebx
+  8014f2:	89 d7                	mov    %edx,%edi
+  8014f4:	89 d6                	mov    %edx,%esi
+  8014f6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014f8:	5b                   	pop    %ebx
+  8014f9:	5e                   	pop    %esi
+  8014fa:	5f                   	pop    %edi
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	c3                   	ret
+
+008014fd <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	57                   	push   %edi
+  801501:	56                   	push   %esi
+  801502:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801503:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801513:	89 df                	mov    %ebx,%edi
+  801515:	89 de                	mov    %ebx,%esi
+  801517:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801519:	5b                   	pop    %ebx
+  80151a:	5e                   	pop    %esi
+  80151b:	5f                   	pop    %edi
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+
+0080151e <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	57                   	push   %edi
+  801522:	56                   	push   %esi
+  801523:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801524:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801531:	89 cb                	mov    %ecx,%ebx
+  801533:	89 cf                	mov    %ecx,%edi
+  801535:	89 ce                	mov    %ecx,%esi
+  801537:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801539:	5b                   	pop    %ebx
+  80153a:	5e                   	pop    %esi
+  80153b:	5f                   	pop    %edi
+  80153c:	5d                   	pop    %ebp
+  80153d:	c3                   	ret
+
+0080153e <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80153e:	55                   	push   %ebp
+  80153f:	89 e5                	mov    %esp,%ebp
+  801541:	57                   	push   %edi
+  801542:	56                   	push   %esi
+  801543:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801544:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801554:	89 df                	mov    %ebx,%edi
+  801556:	89 de                	mov    %ebx,%esi
+  801558:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80155a:	5b                   	pop    %ebx
+  80155b:	5e                   	pop    %esi
+  80155c:	5f                   	pop    %edi
+  80155d:	5d                   	pop    %ebp
+  80155e:	c3                   	ret
+
+0080155f <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	57                   	push   %edi
+  801563:	56                   	push   %esi
+  801564:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801565:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801570:	b8 12 00 00 00       	mov    $0x12,%eax
+  801575:	89 df                	mov    %ebx,%edi
+  801577:	89 de                	mov    %ebx,%esi
+  801579:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80157b:	5b                   	pop    %ebx
+  80157c:	5e                   	pop    %esi
+  80157d:	5f                   	pop    %edi
+  80157e:	5d                   	pop    %ebp
+  80157f:	c3                   	ret
+
+00801580 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801580:	55                   	push   %ebp
+  801581:	89 e5                	mov    %esp,%ebp
+  801583:	57                   	push   %edi
+  801584:	56                   	push   %esi
+  801585:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801586:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801593:	89 cb                	mov    %ecx,%ebx
+  801595:	89 cf                	mov    %ecx,%edi
+  801597:	89 ce                	mov    %ecx,%esi
+  801599:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80159b:	5b                   	pop    %ebx
+  80159c:	5e                   	pop    %esi
+  80159d:	5f                   	pop    %edi
+  80159e:	5d                   	pop    %ebp
+  80159f:	c3                   	ret
+
+008015a0 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	57                   	push   %edi
+  8015a4:	56                   	push   %esi
+  8015a5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8015b6:	89 df                	mov    %ebx,%edi
+  8015b8:	89 de                	mov    %ebx,%esi
+  8015ba:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8015bc:	5b                   	pop    %ebx
+  8015bd:	5e                   	pop    %esi
+  8015be:	5f                   	pop    %edi
+  8015bf:	5d                   	pop    %ebp
+  8015c0:	c3                   	ret
+
+008015c1 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	57                   	push   %edi
+  8015c5:	56                   	push   %esi
+  8015c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	b8 15 00 00 00       	mov    $0x15,%eax
+  8015d4:	89 cb                	mov    %ecx,%ebx
+  8015d6:	89 cf                	mov    %ecx,%edi
+  8015d8:	89 ce                	mov    %ecx,%esi
+  8015da:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8015dc:	5b                   	pop    %ebx
+  8015dd:	5e                   	pop    %esi
+  8015de:	5f                   	pop    %edi
+  8015df:	5d                   	pop    %ebp
+  8015e0:	c3                   	ret
+
+008015e1 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8015e1:	55                   	push   %ebp
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	57                   	push   %edi
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8015f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015fa:	89 f7                	mov    %esi,%edi
+  8015fc:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8015fe:	5b                   	pop    %ebx
+  8015ff:	5e                   	pop    %esi
+  801600:	5f                   	pop    %edi
+  801601:	5d                   	pop    %ebp
+  801602:	c3                   	ret
+
+00801603 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801603:	55                   	push   %ebp
+  801604:	89 e5                	mov    %esp,%ebp
+  801606:	57                   	push   %edi
+  801607:	56                   	push   %esi
+  801608:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801609:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801614:	b8 17 00 00 00       	mov    $0x17,%eax
+  801619:	89 df                	mov    %ebx,%edi
+  80161b:	89 de                	mov    %ebx,%esi
+  80161d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80161f:	5b                   	pop    %ebx
+  801620:	5e                   	pop    %esi
+  801621:	5f                   	pop    %edi
+  801622:	5d                   	pop    %ebp
+  801623:	c3                   	ret
+
+00801624 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801624:	55                   	push   %ebp
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	57                   	push   %edi
+  801628:	56                   	push   %esi
+  801629:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80162a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80162f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801632:	b8 18 00 00 00       	mov    $0x18,%eax
+  801637:	89 cb                	mov    %ecx,%ebx
+  801639:	89 cf                	mov    %ecx,%edi
+  80163b:	89 ce                	mov    %ecx,%esi
+  80163d:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80163f:	5b                   	pop    %ebx
+  801640:	5e                   	pop    %esi
+  801641:	5f                   	pop    %edi
+  801642:	5d                   	pop    %ebp
+  801643:	c3                   	ret
+
+00801644 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	57                   	push   %edi
+  801648:	56                   	push   %esi
+  801649:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80164a:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80164e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801656:	b8 19 00 00 00       	mov    $0x19,%eax
+  80165b:	89 df                	mov    %ebx,%edi
+  80165d:	89 de                	mov    %ebx,%esi
+  80165f:	cd 30                	int    $0x30
+}
+  801661:	5b                   	pop    %ebx
+  801662:	5e                   	pop    %esi
+  801663:	5f                   	pop    %edi
+  801664:	5d                   	pop    %ebp
+  801665:	c3                   	ret
+
+00801666 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801666:	55                   	push   %ebp
+  801667:	89 e5                	mov    %esp,%ebp
+  801669:	57                   	push   %edi
+  80166a:	56                   	push   %esi
+  80166b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	8b 55 08             	mov    0x8(%ebp),%edx
+  801674:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801677:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80167c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80167f:	89 f7                	mov    %esi,%edi
+  801681:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801683:	5b                   	pop    %ebx
+  801684:	5e                   	pop    %esi
+  801685:	5f                   	pop    %edi
+  801686:	5d                   	pop    %ebp
+  801687:	c3                   	ret
+
+00801688 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	57                   	push   %edi
+  80168c:	56                   	push   %esi
+  80168d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80168e:	be 00 00 00 00       	mov    $0x0,%esi
+  801693:	8b 55 08             	mov    0x8(%ebp),%edx
+  801696:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801699:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80169e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a1:	89 f7                	mov    %esi,%edi
+  8016a3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8016a5:	5b                   	pop    %ebx
+  8016a6:	5e                   	pop    %esi
+  8016a7:	5f                   	pop    %edi
+  8016a8:	5d                   	pop    %ebp
+  8016a9:	c3                   	ret
+
+008016aa <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	57                   	push   %edi
+  8016ae:	56                   	push   %esi
+  8016af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8016c0:	89 df                	mov    %ebx,%edi
+  8016c2:	89 de                	mov    %ebx,%esi
+  8016c4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8016c6:	5b                   	pop    %ebx
+  8016c7:	5e                   	pop    %esi
+  8016c8:	5f                   	pop    %edi
+  8016c9:	5d                   	pop    %ebp
+  8016ca:	c3                   	ret
+
+008016cb <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	57                   	push   %edi
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016dc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e4:	89 f7                	mov    %esi,%edi
+  8016e6:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+
+008016ed <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8016ed:	55                   	push   %ebp
+  8016ee:	89 e5                	mov    %esp,%ebp
+  8016f0:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8016f3:	83 3d 60 64 80 00 00 	cmpl   $0x0,0x806460
+  8016fa:	74 0a                	je     801706 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8016fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ff:	a3 60 64 80 00       	mov    %eax,0x806460
+}
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  801706:	83 ec 04             	sub    $0x4,%esp
+  801709:	6a 07                	push   $0x7
+  80170b:	68 00 f0 bf ee       	push   $0xeebff000
+  801710:	6a 00                	push   $0x0
+  801712:	e8 73 fb ff ff       	call   80128a <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801717:	83 c4 08             	add    $0x8,%esp
+  80171a:	68 2b 17 80 00       	push   $0x80172b
+  80171f:	6a 00                	push   $0x0
+  801721:	e8 af fc ff ff       	call   8013d5 <sys_env_set_pgfault_upcall>
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	eb d1                	jmp    8016fc <set_pgfault_handler+0xf>
+
+0080172b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80172b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80172c:	a1 60 64 80 00       	mov    0x806460,%eax
+	call *%eax
+  801731:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801733:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  801736:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  80173a:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80173d:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  801741:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  801743:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  801747:	83 c4 08             	add    $0x8,%esp
+	popal;
+  80174a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80174b:	83 c4 04             	add    $0x4,%esp
+	popf
+  80174e:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80174f:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  801750:	c3                   	ret
+
+00801751 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801754:	8b 45 08             	mov    0x8(%ebp),%eax
+  801757:	05 00 00 00 30       	add    $0x30000000,%eax
+  80175c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80175f:	5d                   	pop    %ebp
+  801760:	c3                   	ret
+
+00801761 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801764:	8b 45 08             	mov    0x8(%ebp),%eax
+  801767:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80176c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801771:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801776:	5d                   	pop    %ebp
+  801777:	c3                   	ret
+
+00801778 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801778:	55                   	push   %ebp
+  801779:	89 e5                	mov    %esp,%ebp
+  80177b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801780:	89 c2                	mov    %eax,%edx
+  801782:	c1 ea 16             	shr    $0x16,%edx
+  801785:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80178c:	f6 c2 01             	test   $0x1,%dl
+  80178f:	74 29                	je     8017ba <fd_alloc+0x42>
+  801791:	89 c2                	mov    %eax,%edx
+  801793:	c1 ea 0c             	shr    $0xc,%edx
+  801796:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80179d:	f6 c2 01             	test   $0x1,%dl
+  8017a0:	74 18                	je     8017ba <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  8017a2:	05 00 10 00 00       	add    $0x1000,%eax
+  8017a7:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8017ac:	75 d2                	jne    801780 <fd_alloc+0x8>
+  8017ae:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017b3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8017b8:	eb 05                	jmp    8017bf <fd_alloc+0x47>
+			return 0;
+  8017ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8017bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c2:	89 02                	mov    %eax,(%edx)
+}
+  8017c4:	89 c8                	mov    %ecx,%eax
+  8017c6:	5d                   	pop    %ebp
+  8017c7:	c3                   	ret
+
+008017c8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8017ce:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8017d3:	77 30                	ja     801805 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8017d5:	c1 e0 0c             	shl    $0xc,%eax
+  8017d8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8017dd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8017e3:	f6 c2 01             	test   $0x1,%dl
+  8017e6:	74 24                	je     80180c <fd_lookup+0x44>
+  8017e8:	89 c2                	mov    %eax,%edx
+  8017ea:	c1 ea 0c             	shr    $0xc,%edx
+  8017ed:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017f4:	f6 c2 01             	test   $0x1,%dl
+  8017f7:	74 1a                	je     801813 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8017f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017fc:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8017fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801803:	5d                   	pop    %ebp
+  801804:	c3                   	ret
+		return -E_INVAL;
+  801805:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80180a:	eb f7                	jmp    801803 <fd_lookup+0x3b>
+		return -E_INVAL;
+  80180c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801811:	eb f0                	jmp    801803 <fd_lookup+0x3b>
+  801813:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801818:	eb e9                	jmp    801803 <fd_lookup+0x3b>
+
+0080181a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80181a:	55                   	push   %ebp
+  80181b:	89 e5                	mov    %esp,%ebp
+  80181d:	53                   	push   %ebx
+  80181e:	83 ec 04             	sub    $0x4,%esp
+  801821:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801824:	b8 00 00 00 00       	mov    $0x0,%eax
+  801829:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  80182e:	39 13                	cmp    %edx,(%ebx)
+  801830:	74 54                	je     801886 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801832:	83 c0 01             	add    $0x1,%eax
+  801835:	8b 1c 85 b4 45 80 00 	mov    0x8045b4(,%eax,4),%ebx
+  80183c:	85 db                	test   %ebx,%ebx
+  80183e:	75 ee                	jne    80182e <dev_lookup+0x14>
+  801840:	89 e1                	mov    %esp,%ecx
+  801842:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801847:	29 c8                	sub    %ecx,%eax
+  801849:	89 c1                	mov    %eax,%ecx
+  80184b:	c1 e9 0f             	shr    $0xf,%ecx
+  80184e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+  801858:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80185b:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  801862:	8b 40 48             	mov    0x48(%eax),%eax
+  801865:	83 ec 04             	sub    $0x4,%esp
+  801868:	52                   	push   %edx
+  801869:	50                   	push   %eax
+  80186a:	68 38 45 80 00       	push   $0x804538
+  80186f:	e8 eb ee ff ff       	call   80075f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801874:	83 c4 10             	add    $0x10,%esp
+  801877:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80187c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80187f:	89 1a                	mov    %ebx,(%edx)
+}
+  801881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801884:	c9                   	leave
+  801885:	c3                   	ret
+			return 0;
+  801886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188b:	eb ef                	jmp    80187c <dev_lookup+0x62>
+
+0080188d <fd_close>:
+{
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	57                   	push   %edi
+  801891:	56                   	push   %esi
+  801892:	53                   	push   %ebx
+  801893:	83 ec 24             	sub    $0x24,%esp
+  801896:	8b 75 08             	mov    0x8(%ebp),%esi
+  801899:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80189c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80189f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018a0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018a6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018a9:	50                   	push   %eax
+  8018aa:	e8 19 ff ff ff       	call   8017c8 <fd_lookup>
+  8018af:	89 c3                	mov    %eax,%ebx
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 05                	js     8018bd <fd_close+0x30>
+	    || fd != fd2)
+  8018b8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018bb:	74 0f                	je     8018cc <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8018bd:	85 ff                	test   %edi,%edi
+  8018bf:	0f 44 df             	cmove  %edi,%ebx
+}
+  8018c2:	89 d8                	mov    %ebx,%eax
+  8018c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c7:	5b                   	pop    %ebx
+  8018c8:	5e                   	pop    %esi
+  8018c9:	5f                   	pop    %edi
+  8018ca:	5d                   	pop    %ebp
+  8018cb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018cc:	83 ec 08             	sub    $0x8,%esp
+  8018cf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8018d2:	50                   	push   %eax
+  8018d3:	ff 36                	push   (%esi)
+  8018d5:	e8 40 ff ff ff       	call   80181a <dev_lookup>
+  8018da:	89 c3                	mov    %eax,%ebx
+  8018dc:	83 c4 10             	add    $0x10,%esp
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	78 1a                	js     8018fd <fd_close+0x70>
+		if (dev->dev_close)
+  8018e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018e6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8018e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	74 0b                	je     8018fd <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8018f2:	83 ec 0c             	sub    $0xc,%esp
+  8018f5:	56                   	push   %esi
+  8018f6:	ff d0                	call   *%eax
+  8018f8:	89 c3                	mov    %eax,%ebx
+  8018fa:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8018fd:	83 ec 08             	sub    $0x8,%esp
+  801900:	56                   	push   %esi
+  801901:	6a 00                	push   $0x0
+  801903:	e8 07 fa ff ff       	call   80130f <sys_page_unmap>
+	return r;
+  801908:	83 c4 10             	add    $0x10,%esp
+  80190b:	eb b5                	jmp    8018c2 <fd_close+0x35>
+
+0080190d <close>:
+
+int
+close(int fdnum)
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801913:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801916:	50                   	push   %eax
+  801917:	ff 75 08             	push   0x8(%ebp)
+  80191a:	e8 a9 fe ff ff       	call   8017c8 <fd_lookup>
+  80191f:	83 c4 10             	add    $0x10,%esp
+  801922:	85 c0                	test   %eax,%eax
+  801924:	79 02                	jns    801928 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801926:	c9                   	leave
+  801927:	c3                   	ret
+		return fd_close(fd, 1);
+  801928:	83 ec 08             	sub    $0x8,%esp
+  80192b:	6a 01                	push   $0x1
+  80192d:	ff 75 f4             	push   -0xc(%ebp)
+  801930:	e8 58 ff ff ff       	call   80188d <fd_close>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	eb ec                	jmp    801926 <close+0x19>
+
+0080193a <close_all>:
+
+void
+close_all(void)
+{
+  80193a:	55                   	push   %ebp
+  80193b:	89 e5                	mov    %esp,%ebp
+  80193d:	53                   	push   %ebx
+  80193e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801941:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801946:	83 ec 0c             	sub    $0xc,%esp
+  801949:	53                   	push   %ebx
+  80194a:	e8 be ff ff ff       	call   80190d <close>
+	for (i = 0; i < MAXFD; i++)
+  80194f:	83 c3 01             	add    $0x1,%ebx
+  801952:	83 c4 10             	add    $0x10,%esp
+  801955:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80195b:	75 e9                	jne    801946 <close_all+0xc>
+}
+  80195d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801960:	c9                   	leave
+  801961:	c3                   	ret
+
+00801962 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	57                   	push   %edi
+  801966:	56                   	push   %esi
+  801967:	53                   	push   %ebx
+  801968:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80196b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80196e:	50                   	push   %eax
+  80196f:	ff 75 08             	push   0x8(%ebp)
+  801972:	e8 51 fe ff ff       	call   8017c8 <fd_lookup>
+  801977:	89 c3                	mov    %eax,%ebx
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 7f                	js     8019ff <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801980:	83 ec 0c             	sub    $0xc,%esp
+  801983:	ff 75 0c             	push   0xc(%ebp)
+  801986:	e8 82 ff ff ff       	call   80190d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80198b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80198e:	c1 e6 0c             	shl    $0xc,%esi
+  801991:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801997:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80199a:	89 3c 24             	mov    %edi,(%esp)
+  80199d:	e8 bf fd ff ff       	call   801761 <fd2data>
+  8019a2:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019a4:	89 34 24             	mov    %esi,(%esp)
+  8019a7:	e8 b5 fd ff ff       	call   801761 <fd2data>
+  8019ac:	83 c4 10             	add    $0x10,%esp
+  8019af:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8019b2:	89 d8                	mov    %ebx,%eax
+  8019b4:	c1 e8 16             	shr    $0x16,%eax
+  8019b7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019be:	a8 01                	test   $0x1,%al
+  8019c0:	74 11                	je     8019d3 <dup+0x71>
+  8019c2:	89 d8                	mov    %ebx,%eax
+  8019c4:	c1 e8 0c             	shr    $0xc,%eax
+  8019c7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019ce:	f6 c2 01             	test   $0x1,%dl
+  8019d1:	75 36                	jne    801a09 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019d3:	89 f8                	mov    %edi,%eax
+  8019d5:	c1 e8 0c             	shr    $0xc,%eax
+  8019d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019df:	83 ec 0c             	sub    $0xc,%esp
+  8019e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019e7:	50                   	push   %eax
+  8019e8:	56                   	push   %esi
+  8019e9:	6a 00                	push   $0x0
+  8019eb:	57                   	push   %edi
+  8019ec:	6a 00                	push   $0x0
+  8019ee:	e8 da f8 ff ff       	call   8012cd <sys_page_map>
+  8019f3:	89 c3                	mov    %eax,%ebx
+  8019f5:	83 c4 20             	add    $0x20,%esp
+  8019f8:	85 c0                	test   %eax,%eax
+  8019fa:	78 33                	js     801a2f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8019fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8019ff:	89 d8                	mov    %ebx,%eax
+  801a01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a04:	5b                   	pop    %ebx
+  801a05:	5e                   	pop    %esi
+  801a06:	5f                   	pop    %edi
+  801a07:	5d                   	pop    %ebp
+  801a08:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a09:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a10:	83 ec 0c             	sub    $0xc,%esp
+  801a13:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a18:	50                   	push   %eax
+  801a19:	ff 75 d4             	push   -0x2c(%ebp)
+  801a1c:	6a 00                	push   $0x0
+  801a1e:	53                   	push   %ebx
+  801a1f:	6a 00                	push   $0x0
+  801a21:	e8 a7 f8 ff ff       	call   8012cd <sys_page_map>
+  801a26:	89 c3                	mov    %eax,%ebx
+  801a28:	83 c4 20             	add    $0x20,%esp
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	79 a4                	jns    8019d3 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a2f:	83 ec 08             	sub    $0x8,%esp
+  801a32:	56                   	push   %esi
+  801a33:	6a 00                	push   $0x0
+  801a35:	e8 d5 f8 ff ff       	call   80130f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a3a:	83 c4 08             	add    $0x8,%esp
+  801a3d:	ff 75 d4             	push   -0x2c(%ebp)
+  801a40:	6a 00                	push   $0x0
+  801a42:	e8 c8 f8 ff ff       	call   80130f <sys_page_unmap>
+	return r;
+  801a47:	83 c4 10             	add    $0x10,%esp
+  801a4a:	eb b3                	jmp    8019ff <dup+0x9d>
+
+00801a4c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	56                   	push   %esi
+  801a50:	53                   	push   %ebx
+  801a51:	83 ec 18             	sub    $0x18,%esp
+  801a54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a57:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	53                   	push   %ebx
+  801a5c:	e8 67 fd ff ff       	call   8017c8 <fd_lookup>
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 3c                	js     801aa4 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a68:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a6b:	83 ec 08             	sub    $0x8,%esp
+  801a6e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a71:	50                   	push   %eax
+  801a72:	ff 36                	push   (%esi)
+  801a74:	e8 a1 fd ff ff       	call   80181a <dev_lookup>
+  801a79:	83 c4 10             	add    $0x10,%esp
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 24                	js     801aa4 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a80:	8b 46 08             	mov    0x8(%esi),%eax
+  801a83:	83 e0 03             	and    $0x3,%eax
+  801a86:	83 f8 01             	cmp    $0x1,%eax
+  801a89:	74 20                	je     801aab <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801a8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8e:	8b 40 08             	mov    0x8(%eax),%eax
+  801a91:	85 c0                	test   %eax,%eax
+  801a93:	74 54                	je     801ae9 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801a95:	83 ec 04             	sub    $0x4,%esp
+  801a98:	ff 75 10             	push   0x10(%ebp)
+  801a9b:	ff 75 0c             	push   0xc(%ebp)
+  801a9e:	56                   	push   %esi
+  801a9f:	ff d0                	call   *%eax
+  801aa1:	83 c4 10             	add    $0x10,%esp
+}
+  801aa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa7:	5b                   	pop    %ebx
+  801aa8:	5e                   	pop    %esi
+  801aa9:	5d                   	pop    %ebp
+  801aaa:	c3                   	ret
+  801aab:	89 e2                	mov    %esp,%edx
+  801aad:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ab2:	29 d0                	sub    %edx,%eax
+  801ab4:	89 c2                	mov    %eax,%edx
+  801ab6:	c1 ea 0f             	shr    $0xf,%edx
+  801ab9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac3:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ac6:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  801acd:	8b 40 48             	mov    0x48(%eax),%eax
+  801ad0:	83 ec 04             	sub    $0x4,%esp
+  801ad3:	53                   	push   %ebx
+  801ad4:	50                   	push   %eax
+  801ad5:	68 79 45 80 00       	push   $0x804579
+  801ada:	e8 80 ec ff ff       	call   80075f <cprintf>
+		return -E_INVAL;
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae7:	eb bb                	jmp    801aa4 <read+0x58>
+		return -E_NOT_SUPP;
+  801ae9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aee:	eb b4                	jmp    801aa4 <read+0x58>
+
+00801af0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	57                   	push   %edi
+  801af4:	56                   	push   %esi
+  801af5:	53                   	push   %ebx
+  801af6:	83 ec 0c             	sub    $0xc,%esp
+  801af9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801afc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801aff:	85 f6                	test   %esi,%esi
+  801b01:	74 30                	je     801b33 <readn+0x43>
+  801b03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b08:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b0d:	83 ec 04             	sub    $0x4,%esp
+  801b10:	89 f2                	mov    %esi,%edx
+  801b12:	29 c2                	sub    %eax,%edx
+  801b14:	52                   	push   %edx
+  801b15:	01 f8                	add    %edi,%eax
+  801b17:	50                   	push   %eax
+  801b18:	ff 75 08             	push   0x8(%ebp)
+  801b1b:	e8 2c ff ff ff       	call   801a4c <read>
+		if (m < 0)
+  801b20:	83 c4 10             	add    $0x10,%esp
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	78 15                	js     801b3c <readn+0x4c>
+			return m;
+		if (m == 0)
+  801b27:	74 11                	je     801b3a <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801b29:	01 c3                	add    %eax,%ebx
+  801b2b:	89 d8                	mov    %ebx,%eax
+  801b2d:	39 f3                	cmp    %esi,%ebx
+  801b2f:	72 dc                	jb     801b0d <readn+0x1d>
+  801b31:	eb 09                	jmp    801b3c <readn+0x4c>
+  801b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b38:	eb 02                	jmp    801b3c <readn+0x4c>
+  801b3a:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801b3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3f:	5b                   	pop    %ebx
+  801b40:	5e                   	pop    %esi
+  801b41:	5f                   	pop    %edi
+  801b42:	5d                   	pop    %ebp
+  801b43:	c3                   	ret
+
+00801b44 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b44:	55                   	push   %ebp
+  801b45:	89 e5                	mov    %esp,%ebp
+  801b47:	56                   	push   %esi
+  801b48:	53                   	push   %ebx
+  801b49:	83 ec 18             	sub    $0x18,%esp
+  801b4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b4f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b52:	50                   	push   %eax
+  801b53:	53                   	push   %ebx
+  801b54:	e8 6f fc ff ff       	call   8017c8 <fd_lookup>
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 37                	js     801b97 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b60:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b63:	83 ec 08             	sub    $0x8,%esp
+  801b66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b69:	50                   	push   %eax
+  801b6a:	ff 36                	push   (%esi)
+  801b6c:	e8 a9 fc ff ff       	call   80181a <dev_lookup>
+  801b71:	83 c4 10             	add    $0x10,%esp
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	78 1f                	js     801b97 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b78:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b7c:	74 20                	je     801b9e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801b7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b81:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	74 54                	je     801bdc <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801b88:	83 ec 04             	sub    $0x4,%esp
+  801b8b:	ff 75 10             	push   0x10(%ebp)
+  801b8e:	ff 75 0c             	push   0xc(%ebp)
+  801b91:	56                   	push   %esi
+  801b92:	ff d0                	call   *%eax
+  801b94:	83 c4 10             	add    $0x10,%esp
+}
+  801b97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b9a:	5b                   	pop    %ebx
+  801b9b:	5e                   	pop    %esi
+  801b9c:	5d                   	pop    %ebp
+  801b9d:	c3                   	ret
+  801b9e:	89 e2                	mov    %esp,%edx
+  801ba0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ba5:	29 d0                	sub    %edx,%eax
+  801ba7:	89 c2                	mov    %eax,%edx
+  801ba9:	c1 ea 0f             	shr    $0xf,%edx
+  801bac:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb6:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bb9:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  801bc0:	8b 40 48             	mov    0x48(%eax),%eax
+  801bc3:	83 ec 04             	sub    $0x4,%esp
+  801bc6:	53                   	push   %ebx
+  801bc7:	50                   	push   %eax
+  801bc8:	68 95 45 80 00       	push   $0x804595
+  801bcd:	e8 8d eb ff ff       	call   80075f <cprintf>
+		return -E_INVAL;
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bda:	eb bb                	jmp    801b97 <write+0x53>
+		return -E_NOT_SUPP;
+  801bdc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801be1:	eb b4                	jmp    801b97 <write+0x53>
+
+00801be3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801be3:	55                   	push   %ebp
+  801be4:	89 e5                	mov    %esp,%ebp
+  801be6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801be9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bec:	50                   	push   %eax
+  801bed:	ff 75 08             	push   0x8(%ebp)
+  801bf0:	e8 d3 fb ff ff       	call   8017c8 <fd_lookup>
+  801bf5:	83 c4 10             	add    $0x10,%esp
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	78 0e                	js     801c0a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801bfc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c02:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c0a:	c9                   	leave
+  801c0b:	c3                   	ret
+
+00801c0c <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801c0c:	55                   	push   %ebp
+  801c0d:	89 e5                	mov    %esp,%ebp
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 1c             	sub    $0x1c,%esp
+  801c13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c19:	50                   	push   %eax
+  801c1a:	ff 75 08             	push   0x8(%ebp)
+  801c1d:	e8 a6 fb ff ff       	call   8017c8 <fd_lookup>
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	85 c0                	test   %eax,%eax
+  801c27:	78 33                	js     801c5c <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801c29:	83 fb 03             	cmp    $0x3,%ebx
+  801c2c:	74 28                	je     801c56 <fcntl+0x4a>
+  801c2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c33:	83 fb 04             	cmp    $0x4,%ebx
+  801c36:	75 24                	jne    801c5c <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801c38:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801c3b:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c3e:	80 e4 ef             	and    $0xef,%ah
+  801c41:	8b 55 10             	mov    0x10(%ebp),%edx
+  801c44:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801c4a:	09 d0                	or     %edx,%eax
+  801c4c:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c54:	eb 06                	jmp    801c5c <fcntl+0x50>
+		return fd->fd_omode;
+  801c56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c59:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801c5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5f:	c9                   	leave
+  801c60:	c3                   	ret
+
+00801c61 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c61:	55                   	push   %ebp
+  801c62:	89 e5                	mov    %esp,%ebp
+  801c64:	56                   	push   %esi
+  801c65:	53                   	push   %ebx
+  801c66:	83 ec 18             	sub    $0x18,%esp
+  801c69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c6c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c6f:	50                   	push   %eax
+  801c70:	53                   	push   %ebx
+  801c71:	e8 52 fb ff ff       	call   8017c8 <fd_lookup>
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 34                	js     801cb1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c7d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c80:	83 ec 08             	sub    $0x8,%esp
+  801c83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c86:	50                   	push   %eax
+  801c87:	ff 36                	push   (%esi)
+  801c89:	e8 8c fb ff ff       	call   80181a <dev_lookup>
+  801c8e:	83 c4 10             	add    $0x10,%esp
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	78 1c                	js     801cb1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c95:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c99:	74 1d                	je     801cb8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c9e:	8b 40 18             	mov    0x18(%eax),%eax
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	74 51                	je     801cf6 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ca5:	83 ec 08             	sub    $0x8,%esp
+  801ca8:	ff 75 0c             	push   0xc(%ebp)
+  801cab:	56                   	push   %esi
+  801cac:	ff d0                	call   *%eax
+  801cae:	83 c4 10             	add    $0x10,%esp
+}
+  801cb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb4:	5b                   	pop    %ebx
+  801cb5:	5e                   	pop    %esi
+  801cb6:	5d                   	pop    %ebp
+  801cb7:	c3                   	ret
+  801cb8:	89 e2                	mov    %esp,%edx
+  801cba:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801cbf:	29 d0                	sub    %edx,%eax
+  801cc1:	89 c2                	mov    %eax,%edx
+  801cc3:	c1 ea 0f             	shr    $0xf,%edx
+  801cc6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd0:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801cd3:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  801cda:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+  801ce0:	53                   	push   %ebx
+  801ce1:	50                   	push   %eax
+  801ce2:	68 58 45 80 00       	push   $0x804558
+  801ce7:	e8 73 ea ff ff       	call   80075f <cprintf>
+		return -E_INVAL;
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf4:	eb bb                	jmp    801cb1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801cf6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cfb:	eb b4                	jmp    801cb1 <ftruncate+0x50>
+
+00801cfd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cfd:	55                   	push   %ebp
+  801cfe:	89 e5                	mov    %esp,%ebp
+  801d00:	56                   	push   %esi
+  801d01:	53                   	push   %ebx
+  801d02:	83 ec 18             	sub    $0x18,%esp
+  801d05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d0b:	50                   	push   %eax
+  801d0c:	ff 75 08             	push   0x8(%ebp)
+  801d0f:	e8 b4 fa ff ff       	call   8017c8 <fd_lookup>
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	85 c0                	test   %eax,%eax
+  801d19:	78 53                	js     801d6e <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d1b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+  801d21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d24:	50                   	push   %eax
+  801d25:	ff 36                	push   (%esi)
+  801d27:	e8 ee fa ff ff       	call   80181a <dev_lookup>
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 3b                	js     801d6e <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d36:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d3a:	74 39                	je     801d75 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d3c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d3f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d46:	00 00 00 
+	stat->st_isdir = 0;
+  801d49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d50:	00 00 00 
+	stat->st_version = 0;
+  801d53:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801d5a:	00 00 00 
+	stat->st_dev = dev;
+  801d5d:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d63:	83 ec 08             	sub    $0x8,%esp
+  801d66:	53                   	push   %ebx
+  801d67:	56                   	push   %esi
+  801d68:	ff 50 14             	call   *0x14(%eax)
+  801d6b:	83 c4 10             	add    $0x10,%esp
+}
+  801d6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d71:	5b                   	pop    %ebx
+  801d72:	5e                   	pop    %esi
+  801d73:	5d                   	pop    %ebp
+  801d74:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d75:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d7a:	eb f2                	jmp    801d6e <fstat+0x71>
+
+00801d7c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	56                   	push   %esi
+  801d80:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d81:	83 ec 08             	sub    $0x8,%esp
+  801d84:	6a 00                	push   $0x0
+  801d86:	ff 75 08             	push   0x8(%ebp)
+  801d89:	e8 b7 01 00 00       	call   801f45 <open>
+  801d8e:	89 c3                	mov    %eax,%ebx
+  801d90:	83 c4 10             	add    $0x10,%esp
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	78 1b                	js     801db2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d97:	83 ec 08             	sub    $0x8,%esp
+  801d9a:	ff 75 0c             	push   0xc(%ebp)
+  801d9d:	50                   	push   %eax
+  801d9e:	e8 5a ff ff ff       	call   801cfd <fstat>
+  801da3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801da5:	89 1c 24             	mov    %ebx,(%esp)
+  801da8:	e8 60 fb ff ff       	call   80190d <close>
+	return r;
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	89 f3                	mov    %esi,%ebx
+}
+  801db2:	89 d8                	mov    %ebx,%eax
+  801db4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db7:	5b                   	pop    %ebx
+  801db8:	5e                   	pop    %esi
+  801db9:	5d                   	pop    %ebp
+  801dba:	c3                   	ret
+
+00801dbb <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	56                   	push   %esi
+  801dbf:	53                   	push   %ebx
+  801dc0:	89 c6                	mov    %eax,%esi
+  801dc2:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801dc4:	83 3d ac 60 80 00 00 	cmpl   $0x0,0x8060ac
+  801dcb:	74 27                	je     801df4 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dcd:	6a 07                	push   $0x7
+  801dcf:	68 00 70 80 00       	push   $0x807000
+  801dd4:	56                   	push   %esi
+  801dd5:	ff 35 ac 60 80 00    	push   0x8060ac
+  801ddb:	e8 d9 1f 00 00       	call   803db9 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801de0:	83 c4 0c             	add    $0xc,%esp
+  801de3:	6a 00                	push   $0x0
+  801de5:	53                   	push   %ebx
+  801de6:	6a 00                	push   $0x0
+  801de8:	e8 3c 1d 00 00       	call   803b29 <ipc_recv>
+}
+  801ded:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df0:	5b                   	pop    %ebx
+  801df1:	5e                   	pop    %esi
+  801df2:	5d                   	pop    %ebp
+  801df3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801df4:	83 ec 0c             	sub    $0xc,%esp
+  801df7:	6a 02                	push   $0x2
+  801df9:	e8 24 20 00 00       	call   803e22 <ipc_find_env>
+  801dfe:	a3 ac 60 80 00       	mov    %eax,0x8060ac
+  801e03:	83 c4 10             	add    $0x10,%esp
+  801e06:	eb c5                	jmp    801dcd <fsipc+0x12>
+
+00801e08 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e08:	55                   	push   %ebp
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e11:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e14:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801e19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e1c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e26:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e2b:	e8 8b ff ff ff       	call   801dbb <fsipc>
+}
+  801e30:	c9                   	leave
+  801e31:	c3                   	ret
+
+00801e32 <devfile_flush>:
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e3e:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e48:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e4d:	e8 69 ff ff ff       	call   801dbb <fsipc>
+}
+  801e52:	c9                   	leave
+  801e53:	c3                   	ret
+
+00801e54 <devfile_stat>:
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	53                   	push   %ebx
+  801e58:	83 ec 04             	sub    $0x4,%esp
+  801e5b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e61:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e64:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e73:	e8 43 ff ff ff       	call   801dbb <fsipc>
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 37                	js     801eb3 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e7c:	83 ec 08             	sub    $0x8,%esp
+  801e7f:	68 00 70 80 00       	push   $0x807000
+  801e84:	53                   	push   %ebx
+  801e85:	e8 cc ef ff ff       	call   800e56 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e8a:	a1 80 70 80 00       	mov    0x807080,%eax
+  801e8f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e95:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e9a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801ea0:	a1 88 70 80 00       	mov    0x807088,%eax
+  801ea5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb6:	c9                   	leave
+  801eb7:	c3                   	ret
+
+00801eb8 <devfile_write>:
+{
+  801eb8:	55                   	push   %ebp
+  801eb9:	89 e5                	mov    %esp,%ebp
+  801ebb:	83 ec 0c             	sub    $0xc,%esp
+  801ebe:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801ec1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ec6:	39 d0                	cmp    %edx,%eax
+  801ec8:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ece:	8b 52 0c             	mov    0xc(%edx),%edx
+  801ed1:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801ed7:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801edc:	50                   	push   %eax
+  801edd:	ff 75 0c             	push   0xc(%ebp)
+  801ee0:	68 08 70 80 00       	push   $0x807008
+  801ee5:	e8 1c f1 ff ff       	call   801006 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801eea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eef:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ef4:	e8 c2 fe ff ff       	call   801dbb <fsipc>
+}
+  801ef9:	c9                   	leave
+  801efa:	c3                   	ret
+
+00801efb <devfile_read>:
+{
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	53                   	push   %ebx
+  801eff:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f05:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f08:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801f0d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f10:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801f15:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801f1a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f1f:	e8 97 fe ff ff       	call   801dbb <fsipc>
+  801f24:	89 c3                	mov    %eax,%ebx
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	78 14                	js     801f3e <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801f2a:	83 ec 04             	sub    $0x4,%esp
+  801f2d:	50                   	push   %eax
+  801f2e:	68 00 70 80 00       	push   $0x807000
+  801f33:	ff 75 0c             	push   0xc(%ebp)
+  801f36:	e8 cb f0 ff ff       	call   801006 <memmove>
+	return r;
+  801f3b:	83 c4 10             	add    $0x10,%esp
+}
+  801f3e:	89 d8                	mov    %ebx,%eax
+  801f40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f43:	c9                   	leave
+  801f44:	c3                   	ret
+
+00801f45 <open>:
+{
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	53                   	push   %ebx
+  801f49:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801f4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f4f:	50                   	push   %eax
+  801f50:	e8 23 f8 ff ff       	call   801778 <fd_alloc>
+  801f55:	89 c3                	mov    %eax,%ebx
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	78 2a                	js     801f88 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801f5e:	83 ec 0c             	sub    $0xc,%esp
+  801f61:	ff 75 08             	push   0x8(%ebp)
+  801f64:	e8 a1 ee ff ff       	call   800e0a <strlen>
+  801f69:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801f6c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801f71:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801f76:	7e 17                	jle    801f8f <open+0x4a>
+	fd_close(fd, 1);
+  801f78:	83 ec 08             	sub    $0x8,%esp
+  801f7b:	6a 01                	push   $0x1
+  801f7d:	ff 75 f4             	push   -0xc(%ebp)
+  801f80:	e8 08 f9 ff ff       	call   80188d <fd_close>
+	return r;
+  801f85:	83 c4 10             	add    $0x10,%esp
+}
+  801f88:	89 d8                	mov    %ebx,%eax
+  801f8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801f8f:	83 ec 08             	sub    $0x8,%esp
+  801f92:	ff 75 08             	push   0x8(%ebp)
+  801f95:	68 00 70 80 00       	push   $0x807000
+  801f9a:	e8 b7 ee ff ff       	call   800e56 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa2:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801fa7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801faa:	b8 01 00 00 00       	mov    $0x1,%eax
+  801faf:	e8 07 fe ff ff       	call   801dbb <fsipc>
+  801fb4:	89 c3                	mov    %eax,%ebx
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	78 bb                	js     801f78 <open+0x33>
+	return fd2num(fd); 	
+  801fbd:	83 ec 0c             	sub    $0xc,%esp
+  801fc0:	ff 75 f4             	push   -0xc(%ebp)
+  801fc3:	e8 89 f7 ff ff       	call   801751 <fd2num>
+  801fc8:	89 c3                	mov    %eax,%ebx
+  801fca:	83 c4 10             	add    $0x10,%esp
+  801fcd:	eb b9                	jmp    801f88 <open+0x43>
+
+00801fcf <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	53                   	push   %ebx
+  801fd3:	83 ec 1c             	sub    $0x1c,%esp
+  801fd6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fdc:	50                   	push   %eax
+  801fdd:	ff 75 08             	push   0x8(%ebp)
+  801fe0:	e8 e3 f7 ff ff       	call   8017c8 <fd_lookup>
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	85 c0                	test   %eax,%eax
+  801fea:	78 5a                	js     802046 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801fec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fef:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801ff5:	39 10                	cmp    %edx,(%eax)
+  801ff7:	75 66                	jne    80205f <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801ff9:	83 3d ac 60 80 00 00 	cmpl   $0x0,0x8060ac
+  802000:	74 49                	je     80204b <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802002:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802005:	8b 40 0c             	mov    0xc(%eax),%eax
+  802008:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80200d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802010:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802015:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80201b:	6a 07                	push   $0x7
+  80201d:	68 00 70 80 00       	push   $0x807000
+  802022:	6a 09                	push   $0x9
+  802024:	ff 35 ac 60 80 00    	push   0x8060ac
+  80202a:	e8 8a 1d 00 00       	call   803db9 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80202f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802036:	6a 00                	push   $0x0
+  802038:	53                   	push   %ebx
+  802039:	ff 75 10             	push   0x10(%ebp)
+  80203c:	6a 00                	push   $0x0
+  80203e:	e8 b3 1b 00 00       	call   803bf6 <ipc_recv_pages>
+  802043:	83 c4 20             	add    $0x20,%esp
+}
+  802046:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802049:	c9                   	leave
+  80204a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80204b:	83 ec 0c             	sub    $0xc,%esp
+  80204e:	6a 02                	push   $0x2
+  802050:	e8 cd 1d 00 00       	call   803e22 <ipc_find_env>
+  802055:	a3 ac 60 80 00       	mov    %eax,0x8060ac
+  80205a:	83 c4 10             	add    $0x10,%esp
+  80205d:	eb a3                	jmp    802002 <fmap+0x33>
+		return -E_INVAL;
+  80205f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802064:	eb e0                	jmp    802046 <fmap+0x77>
+
+00802066 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802066:	55                   	push   %ebp
+  802067:	89 e5                	mov    %esp,%ebp
+  802069:	53                   	push   %ebx
+  80206a:	83 ec 10             	sub    $0x10,%esp
+  80206d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802070:	53                   	push   %ebx
+  802071:	e8 94 ed ff ff       	call   800e0a <strlen>
+  802076:	83 c4 10             	add    $0x10,%esp
+  802079:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80207e:	7f 25                	jg     8020a5 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802080:	83 ec 08             	sub    $0x8,%esp
+  802083:	53                   	push   %ebx
+  802084:	68 00 70 80 00       	push   $0x807000
+  802089:	e8 c8 ed ff ff       	call   800e56 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80208e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802093:	b8 07 00 00 00       	mov    $0x7,%eax
+  802098:	e8 1e fd ff ff       	call   801dbb <fsipc>
+  80209d:	83 c4 10             	add    $0x10,%esp
+}
+  8020a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+		return -E_BAD_PATH;
+  8020a5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020aa:	eb f4                	jmp    8020a0 <remove+0x3a>
+
+008020ac <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020ac:	55                   	push   %ebp
+  8020ad:	89 e5                	mov    %esp,%ebp
+  8020af:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020bc:	e8 fa fc ff ff       	call   801dbb <fsipc>
+}
+  8020c1:	c9                   	leave
+  8020c2:	c3                   	ret
+
+008020c3 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020c3:	55                   	push   %ebp
+  8020c4:	89 e5                	mov    %esp,%ebp
+  8020c6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8020c9:	68 c8 45 80 00       	push   $0x8045c8
+  8020ce:	ff 75 0c             	push   0xc(%ebp)
+  8020d1:	e8 80 ed ff ff       	call   800e56 <strcpy>
+	return 0;
+}
+  8020d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020db:	c9                   	leave
+  8020dc:	c3                   	ret
+
+008020dd <devsock_close>:
+{
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	53                   	push   %ebx
+  8020e1:	83 ec 10             	sub    $0x10,%esp
+  8020e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8020e7:	53                   	push   %ebx
+  8020e8:	e8 74 1d 00 00       	call   803e61 <pageref>
+  8020ed:	89 c2                	mov    %eax,%edx
+  8020ef:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020f2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8020f7:	83 fa 01             	cmp    $0x1,%edx
+  8020fa:	74 05                	je     802101 <devsock_close+0x24>
+}
+  8020fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ff:	c9                   	leave
+  802100:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802101:	83 ec 0c             	sub    $0xc,%esp
+  802104:	ff 73 0c             	push   0xc(%ebx)
+  802107:	e8 b0 05 00 00       	call   8026bc <nsipc_close>
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	eb eb                	jmp    8020fc <devsock_close+0x1f>
+
+00802111 <devsock_write>:
+{
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	53                   	push   %ebx
+  802115:	83 ec 14             	sub    $0x14,%esp
+  802118:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80211b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80211e:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802121:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802124:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802127:	8b 41 08             	mov    0x8(%ecx),%eax
+  80212a:	c1 f8 09             	sar    $0x9,%eax
+  80212d:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802130:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802136:	77 13                	ja     80214b <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802138:	50                   	push   %eax
+  802139:	52                   	push   %edx
+  80213a:	53                   	push   %ebx
+  80213b:	ff 71 0c             	push   0xc(%ecx)
+  80213e:	e8 5c 06 00 00       	call   80279f <nsipc_send>
+  802143:	83 c4 10             	add    $0x10,%esp
+}
+  802146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802149:	c9                   	leave
+  80214a:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80214b:	50                   	push   %eax
+  80214c:	6a 01                	push   $0x1
+  80214e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802151:	50                   	push   %eax
+  802152:	ff 71 0c             	push   0xc(%ecx)
+  802155:	e8 a6 06 00 00       	call   802800 <nsipc_sendmsg>
+  80215a:	83 c4 10             	add    $0x10,%esp
+  80215d:	eb e7                	jmp    802146 <devsock_write+0x35>
+
+0080215f <devsock_read>:
+{
+  80215f:	55                   	push   %ebp
+  802160:	89 e5                	mov    %esp,%ebp
+  802162:	53                   	push   %ebx
+  802163:	83 ec 14             	sub    $0x14,%esp
+  802166:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802169:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80216c:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80216f:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802172:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802175:	8b 41 08             	mov    0x8(%ecx),%eax
+  802178:	c1 f8 09             	sar    $0x9,%eax
+  80217b:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80217e:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802184:	77 13                	ja     802199 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802186:	50                   	push   %eax
+  802187:	52                   	push   %edx
+  802188:	53                   	push   %ebx
+  802189:	ff 71 0c             	push   0xc(%ecx)
+  80218c:	e8 9c 05 00 00       	call   80272d <nsipc_recv>
+  802191:	83 c4 10             	add    $0x10,%esp
+}
+  802194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802199:	50                   	push   %eax
+  80219a:	6a 01                	push   $0x1
+  80219c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80219f:	50                   	push   %eax
+  8021a0:	ff 71 0c             	push   0xc(%ecx)
+  8021a3:	e8 02 0a 00 00       	call   802baa <nsipc_recvmsg>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	eb e7                	jmp    802194 <devsock_read+0x35>
+
+008021ad <fd2sockid>:
+{
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8021b3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021b6:	52                   	push   %edx
+  8021b7:	50                   	push   %eax
+  8021b8:	e8 0b f6 ff ff       	call   8017c8 <fd_lookup>
+  8021bd:	83 c4 10             	add    $0x10,%esp
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 10                	js     8021d4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8021c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c7:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8021cd:	39 08                	cmp    %ecx,(%eax)
+  8021cf:	75 05                	jne    8021d6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8021d1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8021d4:	c9                   	leave
+  8021d5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021db:	eb f7                	jmp    8021d4 <fd2sockid+0x27>
+
+008021dd <sock_flags>:
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8021e3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021e6:	52                   	push   %edx
+  8021e7:	50                   	push   %eax
+  8021e8:	e8 db f5 ff ff       	call   8017c8 <fd_lookup>
+  8021ed:	83 c4 10             	add    $0x10,%esp
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	78 0e                	js     802202 <sock_flags+0x25>
+  8021f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f7:	8b 40 08             	mov    0x8(%eax),%eax
+  8021fa:	c1 e8 09             	shr    $0x9,%eax
+  8021fd:	83 e0 08             	and    $0x8,%eax
+}
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+		return 0;
+  802202:	b8 00 00 00 00       	mov    $0x0,%eax
+  802207:	eb f7                	jmp    802200 <sock_flags+0x23>
+
+00802209 <alloc_sockfd>:
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	56                   	push   %esi
+  80220d:	53                   	push   %ebx
+  80220e:	83 ec 1c             	sub    $0x1c,%esp
+  802211:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802213:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802216:	50                   	push   %eax
+  802217:	e8 5c f5 ff ff       	call   801778 <fd_alloc>
+  80221c:	89 c3                	mov    %eax,%ebx
+  80221e:	83 c4 10             	add    $0x10,%esp
+  802221:	85 c0                	test   %eax,%eax
+  802223:	78 43                	js     802268 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802225:	83 ec 04             	sub    $0x4,%esp
+  802228:	68 07 04 00 00       	push   $0x407
+  80222d:	ff 75 f4             	push   -0xc(%ebp)
+  802230:	6a 00                	push   $0x0
+  802232:	e8 53 f0 ff ff       	call   80128a <sys_page_alloc>
+  802237:	89 c3                	mov    %eax,%ebx
+  802239:	83 c4 10             	add    $0x10,%esp
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 28                	js     802268 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802240:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802243:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802249:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80224b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802255:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802258:	83 ec 0c             	sub    $0xc,%esp
+  80225b:	50                   	push   %eax
+  80225c:	e8 f0 f4 ff ff       	call   801751 <fd2num>
+  802261:	89 c3                	mov    %eax,%ebx
+  802263:	83 c4 10             	add    $0x10,%esp
+  802266:	eb 0c                	jmp    802274 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802268:	83 ec 0c             	sub    $0xc,%esp
+  80226b:	56                   	push   %esi
+  80226c:	e8 4b 04 00 00       	call   8026bc <nsipc_close>
+		return r;
+  802271:	83 c4 10             	add    $0x10,%esp
+}
+  802274:	89 d8                	mov    %ebx,%eax
+  802276:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802279:	5b                   	pop    %ebx
+  80227a:	5e                   	pop    %esi
+  80227b:	5d                   	pop    %ebp
+  80227c:	c3                   	ret
+
+0080227d <accept>:
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	56                   	push   %esi
+  802281:	53                   	push   %ebx
+  802282:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802285:	89 f0                	mov    %esi,%eax
+  802287:	e8 21 ff ff ff       	call   8021ad <fd2sockid>
+  80228c:	89 c3                	mov    %eax,%ebx
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	78 24                	js     8022b6 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802292:	89 f0                	mov    %esi,%eax
+  802294:	e8 44 ff ff ff       	call   8021dd <sock_flags>
+  802299:	50                   	push   %eax
+  80229a:	ff 75 10             	push   0x10(%ebp)
+  80229d:	ff 75 0c             	push   0xc(%ebp)
+  8022a0:	53                   	push   %ebx
+  8022a1:	e8 6b 03 00 00       	call   802611 <nsipc_accept>
+  8022a6:	89 c3                	mov    %eax,%ebx
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	78 07                	js     8022b6 <accept+0x39>
+	return alloc_sockfd(r);
+  8022af:	e8 55 ff ff ff       	call   802209 <alloc_sockfd>
+  8022b4:	89 c3                	mov    %eax,%ebx
+}
+  8022b6:	89 d8                	mov    %ebx,%eax
+  8022b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bb:	5b                   	pop    %ebx
+  8022bc:	5e                   	pop    %esi
+  8022bd:	5d                   	pop    %ebp
+  8022be:	c3                   	ret
+
+008022bf <bind>:
+{
+  8022bf:	55                   	push   %ebp
+  8022c0:	89 e5                	mov    %esp,%ebp
+  8022c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c8:	e8 e0 fe ff ff       	call   8021ad <fd2sockid>
+  8022cd:	85 c0                	test   %eax,%eax
+  8022cf:	78 12                	js     8022e3 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8022d1:	83 ec 04             	sub    $0x4,%esp
+  8022d4:	ff 75 10             	push   0x10(%ebp)
+  8022d7:	ff 75 0c             	push   0xc(%ebp)
+  8022da:	50                   	push   %eax
+  8022db:	e8 85 03 00 00       	call   802665 <nsipc_bind>
+  8022e0:	83 c4 10             	add    $0x10,%esp
+}
+  8022e3:	c9                   	leave
+  8022e4:	c3                   	ret
+
+008022e5 <shutdown>:
+{
+  8022e5:	55                   	push   %ebp
+  8022e6:	89 e5                	mov    %esp,%ebp
+  8022e8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ee:	e8 ba fe ff ff       	call   8021ad <fd2sockid>
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	78 0f                	js     802306 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8022f7:	83 ec 08             	sub    $0x8,%esp
+  8022fa:	ff 75 0c             	push   0xc(%ebp)
+  8022fd:	50                   	push   %eax
+  8022fe:	e8 97 03 00 00       	call   80269a <nsipc_shutdown>
+  802303:	83 c4 10             	add    $0x10,%esp
+}
+  802306:	c9                   	leave
+  802307:	c3                   	ret
+
+00802308 <connect>:
+{
+  802308:	55                   	push   %ebp
+  802309:	89 e5                	mov    %esp,%ebp
+  80230b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80230e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802311:	e8 97 fe ff ff       	call   8021ad <fd2sockid>
+  802316:	85 c0                	test   %eax,%eax
+  802318:	78 12                	js     80232c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80231a:	83 ec 04             	sub    $0x4,%esp
+  80231d:	ff 75 10             	push   0x10(%ebp)
+  802320:	ff 75 0c             	push   0xc(%ebp)
+  802323:	50                   	push   %eax
+  802324:	e8 ad 03 00 00       	call   8026d6 <nsipc_connect>
+  802329:	83 c4 10             	add    $0x10,%esp
+}
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+
+0080232e <listen>:
+{
+  80232e:	55                   	push   %ebp
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802334:	8b 45 08             	mov    0x8(%ebp),%eax
+  802337:	e8 71 fe ff ff       	call   8021ad <fd2sockid>
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	78 0f                	js     80234f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802340:	83 ec 08             	sub    $0x8,%esp
+  802343:	ff 75 0c             	push   0xc(%ebp)
+  802346:	50                   	push   %eax
+  802347:	e8 bf 03 00 00       	call   80270b <nsipc_listen>
+  80234c:	83 c4 10             	add    $0x10,%esp
+}
+  80234f:	c9                   	leave
+  802350:	c3                   	ret
+
+00802351 <sendmsg>:
+{
+  802351:	55                   	push   %ebp
+  802352:	89 e5                	mov    %esp,%ebp
+  802354:	57                   	push   %edi
+  802355:	56                   	push   %esi
+  802356:	53                   	push   %ebx
+  802357:	83 ec 0c             	sub    $0xc,%esp
+  80235a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80235d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802360:	89 f0                	mov    %esi,%eax
+  802362:	e8 46 fe ff ff       	call   8021ad <fd2sockid>
+  802367:	89 c3                	mov    %eax,%ebx
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	78 1c                	js     802389 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80236d:	89 f0                	mov    %esi,%eax
+  80236f:	e8 69 fe ff ff       	call   8021dd <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802374:	0b 45 10             	or     0x10(%ebp),%eax
+  802377:	50                   	push   %eax
+  802378:	ff 77 0c             	push   0xc(%edi)
+  80237b:	ff 77 08             	push   0x8(%edi)
+  80237e:	53                   	push   %ebx
+  80237f:	e8 7c 04 00 00       	call   802800 <nsipc_sendmsg>
+  802384:	89 c3                	mov    %eax,%ebx
+  802386:	83 c4 10             	add    $0x10,%esp
+}
+  802389:	89 d8                	mov    %ebx,%eax
+  80238b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80238e:	5b                   	pop    %ebx
+  80238f:	5e                   	pop    %esi
+  802390:	5f                   	pop    %edi
+  802391:	5d                   	pop    %ebp
+  802392:	c3                   	ret
+
+00802393 <recvmsg>:
+{
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	57                   	push   %edi
+  802397:	56                   	push   %esi
+  802398:	53                   	push   %ebx
+  802399:	83 ec 0c             	sub    $0xc,%esp
+  80239c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80239f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8023a2:	89 f8                	mov    %edi,%eax
+  8023a4:	e8 04 fe ff ff       	call   8021ad <fd2sockid>
+  8023a9:	89 c3                	mov    %eax,%ebx
+  8023ab:	85 c0                	test   %eax,%eax
+  8023ad:	78 2a                	js     8023d9 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8023af:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8023b6:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8023bd:	89 f8                	mov    %edi,%eax
+  8023bf:	e8 19 fe ff ff       	call   8021dd <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8023c4:	0b 45 10             	or     0x10(%ebp),%eax
+  8023c7:	50                   	push   %eax
+  8023c8:	ff 76 0c             	push   0xc(%esi)
+  8023cb:	ff 76 08             	push   0x8(%esi)
+  8023ce:	53                   	push   %ebx
+  8023cf:	e8 d6 07 00 00       	call   802baa <nsipc_recvmsg>
+  8023d4:	89 c3                	mov    %eax,%ebx
+  8023d6:	83 c4 10             	add    $0x10,%esp
+}
+  8023d9:	89 d8                	mov    %ebx,%eax
+  8023db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023de:	5b                   	pop    %ebx
+  8023df:	5e                   	pop    %esi
+  8023e0:	5f                   	pop    %edi
+  8023e1:	5d                   	pop    %ebp
+  8023e2:	c3                   	ret
+
+008023e3 <sendfile>:
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	56                   	push   %esi
+  8023e7:	53                   	push   %ebx
+  8023e8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8023eb:	89 f0                	mov    %esi,%eax
+  8023ed:	e8 bb fd ff ff       	call   8021ad <fd2sockid>
+  8023f2:	89 c3                	mov    %eax,%ebx
+  8023f4:	85 c0                	test   %eax,%eax
+  8023f6:	78 1f                	js     802417 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8023f8:	89 f0                	mov    %esi,%eax
+  8023fa:	e8 de fd ff ff       	call   8021dd <sock_flags>
+  8023ff:	83 ec 0c             	sub    $0xc,%esp
+  802402:	50                   	push   %eax
+  802403:	ff 75 14             	push   0x14(%ebp)
+  802406:	ff 75 10             	push   0x10(%ebp)
+  802409:	ff 75 0c             	push   0xc(%ebp)
+  80240c:	53                   	push   %ebx
+  80240d:	e8 64 06 00 00       	call   802a76 <nsipc_sendfile>
+  802412:	89 c3                	mov    %eax,%ebx
+  802414:	83 c4 20             	add    $0x20,%esp
+}
+  802417:	89 d8                	mov    %ebx,%eax
+  802419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80241c:	5b                   	pop    %ebx
+  80241d:	5e                   	pop    %esi
+  80241e:	5d                   	pop    %ebp
+  80241f:	c3                   	ret
+
+00802420 <evctl>:
+{
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	53                   	push   %ebx
+  802424:	83 ec 04             	sub    $0x4,%esp
+  802427:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80242a:	89 d8                	mov    %ebx,%eax
+  80242c:	e8 7c fd ff ff       	call   8021ad <fd2sockid>
+  802431:	85 c0                	test   %eax,%eax
+  802433:	78 10                	js     802445 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802435:	83 ec 04             	sub    $0x4,%esp
+  802438:	53                   	push   %ebx
+  802439:	ff 75 0c             	push   0xc(%ebp)
+  80243c:	50                   	push   %eax
+  80243d:	e8 d2 0b 00 00       	call   803014 <nsipc_evctl>
+  802442:	83 c4 10             	add    $0x10,%esp
+}
+  802445:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802448:	c9                   	leave
+  802449:	c3                   	ret
+
+0080244a <evwait>:
+{
+  80244a:	55                   	push   %ebp
+  80244b:	89 e5                	mov    %esp,%ebp
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802450:	ff 75 10             	push   0x10(%ebp)
+  802453:	ff 75 0c             	push   0xc(%ebp)
+  802456:	ff 75 08             	push   0x8(%ebp)
+  802459:	e8 e0 0b 00 00       	call   80303e <nsipc_evwait>
+}
+  80245e:	c9                   	leave
+  80245f:	c3                   	ret
+
+00802460 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802460:	55                   	push   %ebp
+  802461:	89 e5                	mov    %esp,%ebp
+  802463:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802466:	ff 75 10             	push   0x10(%ebp)
+  802469:	ff 75 0c             	push   0xc(%ebp)
+  80246c:	ff 75 08             	push   0x8(%ebp)
+  80246f:	e8 31 0c 00 00       	call   8030a5 <nsipc_socket>
+  802474:	83 c4 10             	add    $0x10,%esp
+  802477:	85 c0                	test   %eax,%eax
+  802479:	78 05                	js     802480 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80247b:	e8 89 fd ff ff       	call   802209 <alloc_sockfd>
+}
+  802480:	c9                   	leave
+  802481:	c3                   	ret
+
+00802482 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802482:	55                   	push   %ebp
+  802483:	89 e5                	mov    %esp,%ebp
+  802485:	53                   	push   %ebx
+  802486:	83 ec 04             	sub    $0x4,%esp
+  802489:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80248b:	83 3d c4 63 80 00 00 	cmpl   $0x0,0x8063c4
+  802492:	74 26                	je     8024ba <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802494:	6a 07                	push   $0x7
+  802496:	68 00 80 80 00       	push   $0x808000
+  80249b:	53                   	push   %ebx
+  80249c:	ff 35 c4 63 80 00    	push   0x8063c4
+  8024a2:	e8 12 19 00 00       	call   803db9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8024a7:	83 c4 0c             	add    $0xc,%esp
+  8024aa:	6a 00                	push   $0x0
+  8024ac:	6a 00                	push   $0x0
+  8024ae:	6a 00                	push   $0x0
+  8024b0:	e8 74 16 00 00       	call   803b29 <ipc_recv>
+}
+  8024b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b8:	c9                   	leave
+  8024b9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8024ba:	83 ec 0c             	sub    $0xc,%esp
+  8024bd:	6a 03                	push   $0x3
+  8024bf:	e8 5e 19 00 00       	call   803e22 <ipc_find_env>
+  8024c4:	a3 c4 63 80 00       	mov    %eax,0x8063c4
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	eb c6                	jmp    802494 <nsipc+0x12>
+
+008024ce <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8024ce:	55                   	push   %ebp
+  8024cf:	89 e5                	mov    %esp,%ebp
+  8024d1:	56                   	push   %esi
+  8024d2:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8024d3:	8b 35 d0 63 80 00    	mov    0x8063d0,%esi
+		return 0;
+  8024d9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8024de:	85 f6                	test   %esi,%esi
+  8024e0:	75 33                	jne    802515 <nsbulk_map+0x47>
+  8024e2:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8024e7:	83 ec 04             	sub    $0x4,%esp
+  8024ea:	6a 07                	push   $0x7
+  8024ec:	53                   	push   %ebx
+  8024ed:	6a 00                	push   $0x0
+  8024ef:	e8 96 ed ff ff       	call   80128a <sys_page_alloc>
+  8024f4:	83 c4 10             	add    $0x10,%esp
+  8024f7:	85 c0                	test   %eax,%eax
+  8024f9:	78 1a                	js     802515 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8024fb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802501:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802507:	75 de                	jne    8024e7 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802509:	c7 05 d0 63 80 00 01 	movl   $0x1,0x8063d0
+  802510:	00 00 00 
+	return 0;
+  802513:	89 f0                	mov    %esi,%eax
+}
+  802515:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802518:	5b                   	pop    %ebx
+  802519:	5e                   	pop    %esi
+  80251a:	5d                   	pop    %ebp
+  80251b:	c3                   	ret
+
+0080251c <nsbulk_own>:
+{
+  80251c:	55                   	push   %ebp
+  80251d:	89 e5                	mov    %esp,%ebp
+  80251f:	57                   	push   %edi
+  802520:	56                   	push   %esi
+  802521:	53                   	push   %ebx
+  802522:	83 ec 0c             	sub    $0xc,%esp
+  802525:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802527:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80252a:	85 d2                	test   %edx,%edx
+  80252c:	7f 0e                	jg     80253c <nsbulk_own+0x20>
+	return 0;
+  80252e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802533:	eb 47                	jmp    80257c <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802535:	83 c3 01             	add    $0x1,%ebx
+  802538:	39 fb                	cmp    %edi,%ebx
+  80253a:	7d 3b                	jge    802577 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80253c:	be 01 00 00 00       	mov    $0x1,%esi
+  802541:	89 d9                	mov    %ebx,%ecx
+  802543:	d3 e6                	shl    %cl,%esi
+  802545:	89 f0                	mov    %esi,%eax
+  802547:	23 05 cc 63 80 00    	and    0x8063cc,%eax
+  80254d:	74 e6                	je     802535 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80254f:	83 ec 04             	sub    $0x4,%esp
+  802552:	6a 07                	push   $0x7
+  802554:	89 d8                	mov    %ebx,%eax
+  802556:	c1 e0 0c             	shl    $0xc,%eax
+  802559:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80255e:	50                   	push   %eax
+  80255f:	6a 00                	push   $0x0
+  802561:	e8 24 ed ff ff       	call   80128a <sys_page_alloc>
+  802566:	83 c4 10             	add    $0x10,%esp
+  802569:	85 c0                	test   %eax,%eax
+  80256b:	78 0f                	js     80257c <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80256d:	f7 d6                	not    %esi
+  80256f:	21 35 cc 63 80 00    	and    %esi,0x8063cc
+  802575:	eb be                	jmp    802535 <nsbulk_own+0x19>
+	return 0;
+  802577:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80257f:	5b                   	pop    %ebx
+  802580:	5e                   	pop    %esi
+  802581:	5f                   	pop    %edi
+  802582:	5d                   	pop    %ebp
+  802583:	c3                   	ret
+
+00802584 <nsipc_bulk>:
+{
+  802584:	55                   	push   %ebp
+  802585:	89 e5                	mov    %esp,%ebp
+  802587:	57                   	push   %edi
+  802588:	56                   	push   %esi
+  802589:	53                   	push   %ebx
+  80258a:	83 ec 1c             	sub    $0x1c,%esp
+  80258d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802590:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802592:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802598:	c1 fb 0c             	sar    $0xc,%ebx
+  80259b:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80259e:	83 3d c4 63 80 00 00 	cmpl   $0x0,0x8063c4
+  8025a5:	74 56                	je     8025fd <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8025a7:	85 ff                	test   %edi,%edi
+  8025a9:	7e 24                	jle    8025cf <nsipc_bulk+0x4b>
+  8025ab:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8025b1:	74 1c                	je     8025cf <nsipc_bulk+0x4b>
+  8025b3:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8025b9:	c1 e3 0c             	shl    $0xc,%ebx
+  8025bc:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8025c1:	0f b6 10             	movzbl (%eax),%edx
+  8025c4:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8025c6:	05 00 10 00 00       	add    $0x1000,%eax
+  8025cb:	39 d8                	cmp    %ebx,%eax
+  8025cd:	75 f2                	jne    8025c1 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8025cf:	83 ec 0c             	sub    $0xc,%esp
+  8025d2:	56                   	push   %esi
+  8025d3:	57                   	push   %edi
+  8025d4:	68 00 00 00 e0       	push   $0xe0000000
+  8025d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8025dc:	ff 35 c4 63 80 00    	push   0x8063c4
+  8025e2:	e8 06 18 00 00       	call   803ded <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8025e7:	83 c4 1c             	add    $0x1c,%esp
+  8025ea:	6a 00                	push   $0x0
+  8025ec:	6a 00                	push   $0x0
+  8025ee:	6a 00                	push   $0x0
+  8025f0:	e8 34 15 00 00       	call   803b29 <ipc_recv>
+}
+  8025f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f8:	5b                   	pop    %ebx
+  8025f9:	5e                   	pop    %esi
+  8025fa:	5f                   	pop    %edi
+  8025fb:	5d                   	pop    %ebp
+  8025fc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8025fd:	83 ec 0c             	sub    $0xc,%esp
+  802600:	6a 03                	push   $0x3
+  802602:	e8 1b 18 00 00       	call   803e22 <ipc_find_env>
+  802607:	a3 c4 63 80 00       	mov    %eax,0x8063c4
+  80260c:	83 c4 10             	add    $0x10,%esp
+  80260f:	eb 96                	jmp    8025a7 <nsipc_bulk+0x23>
+
+00802611 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802611:	55                   	push   %ebp
+  802612:	89 e5                	mov    %esp,%ebp
+  802614:	53                   	push   %ebx
+  802615:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802618:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802620:	8b 45 14             	mov    0x14(%ebp),%eax
+  802623:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802628:	b8 01 00 00 00       	mov    $0x1,%eax
+  80262d:	e8 50 fe ff ff       	call   802482 <nsipc>
+  802632:	89 c3                	mov    %eax,%ebx
+  802634:	85 c0                	test   %eax,%eax
+  802636:	79 07                	jns    80263f <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802638:	89 d8                	mov    %ebx,%eax
+  80263a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263d:	c9                   	leave
+  80263e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80263f:	83 ec 04             	sub    $0x4,%esp
+  802642:	ff 35 10 80 80 00    	push   0x808010
+  802648:	68 00 80 80 00       	push   $0x808000
+  80264d:	ff 75 0c             	push   0xc(%ebp)
+  802650:	e8 b1 e9 ff ff       	call   801006 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802655:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80265b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80265e:	89 10                	mov    %edx,(%eax)
+  802660:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802663:	eb d3                	jmp    802638 <nsipc_accept+0x27>
+
+00802665 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802665:	55                   	push   %ebp
+  802666:	89 e5                	mov    %esp,%ebp
+  802668:	53                   	push   %ebx
+  802669:	83 ec 08             	sub    $0x8,%esp
+  80266c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80266f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802672:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802677:	53                   	push   %ebx
+  802678:	ff 75 0c             	push   0xc(%ebp)
+  80267b:	68 04 80 80 00       	push   $0x808004
+  802680:	e8 81 e9 ff ff       	call   801006 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802685:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80268b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802690:	e8 ed fd ff ff       	call   802482 <nsipc>
+}
+  802695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802698:	c9                   	leave
+  802699:	c3                   	ret
+
+0080269a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80269a:	55                   	push   %ebp
+  80269b:	89 e5                	mov    %esp,%ebp
+  80269d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8026a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8026a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026ab:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8026b0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026b5:	e8 c8 fd ff ff       	call   802482 <nsipc>
+}
+  8026ba:	c9                   	leave
+  8026bb:	c3                   	ret
+
+008026bc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8026bc:	55                   	push   %ebp
+  8026bd:	89 e5                	mov    %esp,%ebp
+  8026bf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8026c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c5:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8026ca:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026cf:	e8 ae fd ff ff       	call   802482 <nsipc>
+}
+  8026d4:	c9                   	leave
+  8026d5:	c3                   	ret
+
+008026d6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	53                   	push   %ebx
+  8026da:	83 ec 08             	sub    $0x8,%esp
+  8026dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8026e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e3:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8026e8:	53                   	push   %ebx
+  8026e9:	ff 75 0c             	push   0xc(%ebp)
+  8026ec:	68 04 80 80 00       	push   $0x808004
+  8026f1:	e8 10 e9 ff ff       	call   801006 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8026f6:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8026fc:	b8 05 00 00 00       	mov    $0x5,%eax
+  802701:	e8 7c fd ff ff       	call   802482 <nsipc>
+}
+  802706:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802709:	c9                   	leave
+  80270a:	c3                   	ret
+
+0080270b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80270b:	55                   	push   %ebp
+  80270c:	89 e5                	mov    %esp,%ebp
+  80270e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802711:	8b 45 08             	mov    0x8(%ebp),%eax
+  802714:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802719:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80271c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802721:	b8 06 00 00 00       	mov    $0x6,%eax
+  802726:	e8 57 fd ff ff       	call   802482 <nsipc>
+}
+  80272b:	c9                   	leave
+  80272c:	c3                   	ret
+
+0080272d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80272d:	55                   	push   %ebp
+  80272e:	89 e5                	mov    %esp,%ebp
+  802730:	56                   	push   %esi
+  802731:	53                   	push   %ebx
+  802732:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802735:	8b 45 08             	mov    0x8(%ebp),%eax
+  802738:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80273d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802743:	8b 45 14             	mov    0x14(%ebp),%eax
+  802746:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80274b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802750:	e8 2d fd ff ff       	call   802482 <nsipc>
+  802755:	89 c3                	mov    %eax,%ebx
+  802757:	85 c0                	test   %eax,%eax
+  802759:	78 22                	js     80277d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80275b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802760:	39 c6                	cmp    %eax,%esi
+  802762:	0f 4e c6             	cmovle %esi,%eax
+  802765:	39 c3                	cmp    %eax,%ebx
+  802767:	7f 1d                	jg     802786 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802769:	83 ec 04             	sub    $0x4,%esp
+  80276c:	53                   	push   %ebx
+  80276d:	68 00 80 80 00       	push   $0x808000
+  802772:	ff 75 0c             	push   0xc(%ebp)
+  802775:	e8 8c e8 ff ff       	call   801006 <memmove>
+  80277a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80277d:	89 d8                	mov    %ebx,%eax
+  80277f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802782:	5b                   	pop    %ebx
+  802783:	5e                   	pop    %esi
+  802784:	5d                   	pop    %ebp
+  802785:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802786:	68 d4 45 80 00       	push   $0x8045d4
+  80278b:	68 e9 45 80 00       	push   $0x8045e9
+  802790:	68 b2 00 00 00       	push   $0xb2
+  802795:	68 fe 45 80 00       	push   $0x8045fe
+  80279a:	e8 e5 de ff ff       	call   800684 <_panic>
+
+0080279f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 04             	sub    $0x4,%esp
+  8027a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8027a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ac:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8027b1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8027b7:	7f 2e                	jg     8027e7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8027b9:	83 ec 04             	sub    $0x4,%esp
+  8027bc:	53                   	push   %ebx
+  8027bd:	ff 75 0c             	push   0xc(%ebp)
+  8027c0:	68 0c 80 80 00       	push   $0x80800c
+  8027c5:	e8 3c e8 ff ff       	call   801006 <memmove>
+	nsipcbuf.send.req_size = size;
+  8027ca:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8027d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027d3:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8027d8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027dd:	e8 a0 fc ff ff       	call   802482 <nsipc>
+}
+  8027e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e5:	c9                   	leave
+  8027e6:	c3                   	ret
+	assert(size < 1600);
+  8027e7:	68 0a 46 80 00       	push   $0x80460a
+  8027ec:	68 e9 45 80 00       	push   $0x8045e9
+  8027f1:	68 bd 00 00 00       	push   $0xbd
+  8027f6:	68 fe 45 80 00       	push   $0x8045fe
+  8027fb:	e8 84 de ff ff       	call   800684 <_panic>
+
+00802800 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802800:	55                   	push   %ebp
+  802801:	89 e5                	mov    %esp,%ebp
+  802803:	57                   	push   %edi
+  802804:	56                   	push   %esi
+  802805:	53                   	push   %ebx
+  802806:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802809:	e8 c0 fc ff ff       	call   8024ce <nsbulk_map>
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	78 55                	js     802867 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802812:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802819:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802820:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802827:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80282a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80282d:	0f 8d 24 02 00 00    	jge    802a57 <nsipc_sendmsg+0x257>
+  802833:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802836:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802839:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80283c:	89 d8                	mov    %ebx,%eax
+  80283e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802843:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802845:	83 ec 0c             	sub    $0xc,%esp
+  802848:	68 c0 60 80 00       	push   $0x8060c0
+  80284d:	e8 5a 0f 00 00       	call   8037ac <pgbatch_init>
+  802852:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802855:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802857:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80285a:	e9 82 00 00 00       	jmp    8028e1 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80285f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802862:	85 db                	test   %ebx,%ebx
+  802864:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802867:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80286a:	5b                   	pop    %ebx
+  80286b:	5e                   	pop    %esi
+  80286c:	5f                   	pop    %edi
+  80286d:	5d                   	pop    %ebp
+  80286e:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80286f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802874:	29 c8                	sub    %ecx,%eax
+  802876:	39 d0                	cmp    %edx,%eax
+  802878:	0f 46 d0             	cmovbe %eax,%edx
+  80287b:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80287d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802883:	85 ff                	test   %edi,%edi
+  802885:	0f 49 c7             	cmovns %edi,%eax
+  802888:	c1 f8 0c             	sar    $0xc,%eax
+  80288b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802890:	e8 87 fc ff ff       	call   80251c <nsbulk_own>
+  802895:	85 c0                	test   %eax,%eax
+  802897:	0f 88 17 01 00 00    	js     8029b4 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80289d:	83 ec 04             	sub    $0x4,%esp
+  8028a0:	56                   	push   %esi
+  8028a1:	ff 75 e0             	push   -0x20(%ebp)
+  8028a4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8028a7:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8028ac:	50                   	push   %eax
+  8028ad:	e8 54 e7 ff ff       	call   801006 <memmove>
+  8028b2:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8028b5:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8028b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028bb:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8028be:	0f 84 fd 00 00 00    	je     8029c1 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8028c4:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8028c7:	01 f7                	add    %esi,%edi
+  8028c9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8028cc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8028cf:	0f 8d 01 01 00 00    	jge    8029d6 <nsipc_sendmsg+0x1d6>
+  8028d5:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8028db:	0f 8f f0 00 00 00    	jg     8029d1 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8028e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028e4:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8028e7:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8028ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028ed:	89 c2                	mov    %eax,%edx
+  8028ef:	03 13                	add    (%ebx),%edx
+  8028f1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8028f4:	8b 73 04             	mov    0x4(%ebx),%esi
+  8028f7:	29 c6                	sub    %eax,%esi
+  8028f9:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8028fe:	29 f9                	sub    %edi,%ecx
+  802900:	39 ce                	cmp    %ecx,%esi
+  802902:	89 ca                	mov    %ecx,%edx
+  802904:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802907:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80290a:	89 f9                	mov    %edi,%ecx
+  80290c:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802912:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802915:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80291a:	09 c8                	or     %ecx,%eax
+  80291c:	0f 85 4d ff ff ff    	jne    80286f <nsipc_sendmsg+0x6f>
+  802922:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802928:	0f 86 41 ff ff ff    	jbe    80286f <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80292e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802934:	85 ff                	test   %edi,%edi
+  802936:	0f 49 c7             	cmovns %edi,%eax
+  802939:	c1 f8 0c             	sar    $0xc,%eax
+  80293c:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80293e:	89 d1                	mov    %edx,%ecx
+  802940:	c1 e9 0c             	shr    $0xc,%ecx
+  802943:	01 c8                	add    %ecx,%eax
+  802945:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802948:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80294b:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80294d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802950:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802955:	29 c8                	sub    %ecx,%eax
+  802957:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80295a:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80295d:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80295f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802964:	89 f9                	mov    %edi,%ecx
+  802966:	d3 e0                	shl    %cl,%eax
+  802968:	09 05 cc 63 80 00    	or     %eax,0x8063cc
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80296e:	83 ec 08             	sub    $0x8,%esp
+  802971:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802973:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802976:	50                   	push   %eax
+  802977:	6a 00                	push   $0x0
+  802979:	56                   	push   %esi
+  80297a:	6a 00                	push   $0x0
+  80297c:	68 c0 60 80 00       	push   $0x8060c0
+  802981:	e8 e4 0e 00 00       	call   80386a <pgbatch_map>
+  802986:	83 c4 20             	add    $0x20,%esp
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	0f 88 ce fe ff ff    	js     80285f <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802991:	83 c7 01             	add    $0x1,%edi
+  802994:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80299a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80299d:	39 c7                	cmp    %eax,%edi
+  80299f:	75 be                	jne    80295f <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8029a1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8029a4:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8029a7:	89 d6                	mov    %edx,%esi
+  8029a9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8029af:	e9 01 ff ff ff       	jmp    8028b5 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8029b4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8029b7:	85 db                	test   %ebx,%ebx
+  8029b9:	0f 45 c3             	cmovne %ebx,%eax
+  8029bc:	e9 a6 fe ff ff       	jmp    802867 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8029c1:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8029c5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8029cc:	e9 f3 fe ff ff       	jmp    8028c4 <nsipc_sendmsg+0xc4>
+  8029d1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8029d4:	eb 03                	jmp    8029d9 <nsipc_sendmsg+0x1d9>
+  8029d6:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8029d9:	83 ec 0c             	sub    $0xc,%esp
+  8029dc:	68 c0 60 80 00       	push   $0x8060c0
+  8029e1:	e8 d4 0d 00 00       	call   8037ba <pgbatch_flush>
+  8029e6:	83 c4 10             	add    $0x10,%esp
+  8029e9:	85 c0                	test   %eax,%eax
+  8029eb:	78 50                	js     802a3d <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8029ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f0:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8029f5:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8029fb:	89 fb                	mov    %edi,%ebx
+  8029fd:	29 f3                	sub    %esi,%ebx
+  8029ff:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802a05:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a08:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802a0d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802a12:	89 fa                	mov    %edi,%edx
+  802a14:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802a19:	e8 66 fb ff ff       	call   802584 <nsipc_bulk>
+  802a1e:	85 c0                	test   %eax,%eax
+  802a20:	78 28                	js     802a4a <nsipc_sendmsg+0x24a>
+		sent += r;
+  802a22:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802a25:	39 c3                	cmp    %eax,%ebx
+  802a27:	75 0c                	jne    802a35 <nsipc_sendmsg+0x235>
+  802a29:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a2c:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802a2f:	0f 8f f2 fd ff ff    	jg     802827 <nsipc_sendmsg+0x27>
+		sent += r;
+  802a35:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802a38:	e9 2a fe ff ff       	jmp    802867 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802a3d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802a40:	85 db                	test   %ebx,%ebx
+  802a42:	0f 45 c3             	cmovne %ebx,%eax
+  802a45:	e9 1d fe ff ff       	jmp    802867 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802a4a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802a4d:	85 db                	test   %ebx,%ebx
+  802a4f:	0f 45 c3             	cmovne %ebx,%eax
+  802a52:	e9 10 fe ff ff       	jmp    802867 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802a57:	83 ec 0c             	sub    $0xc,%esp
+  802a5a:	68 c0 60 80 00       	push   $0x8060c0
+  802a5f:	e8 48 0d 00 00       	call   8037ac <pgbatch_init>
+  802a64:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802a67:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a71:	e9 63 ff ff ff       	jmp    8029d9 <nsipc_sendmsg+0x1d9>
+
+00802a76 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802a76:	55                   	push   %ebp
+  802a77:	89 e5                	mov    %esp,%ebp
+  802a79:	57                   	push   %edi
+  802a7a:	56                   	push   %esi
+  802a7b:	53                   	push   %ebx
+  802a7c:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802a7f:	83 3d c8 63 80 00 00 	cmpl   $0x0,0x8063c8
+  802a86:	0f 84 c8 00 00 00    	je     802b54 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802a8c:	83 3d c4 63 80 00 00 	cmpl   $0x0,0x8063c4
+  802a93:	0f 84 e4 00 00 00    	je     802b7d <nsipc_sendfile+0x107>
+{
+  802a99:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802a9e:	89 fb                	mov    %edi,%ebx
+  802aa0:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802aa3:	0f 83 f0 00 00 00    	jae    802b99 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802aa9:	89 fa                	mov    %edi,%edx
+  802aab:	03 55 10             	add    0x10(%ebp),%edx
+  802aae:	89 d0                	mov    %edx,%eax
+  802ab0:	c1 f8 1f             	sar    $0x1f,%eax
+  802ab3:	c1 e8 14             	shr    $0x14,%eax
+  802ab6:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802ab9:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802abf:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802ac1:	6a 10                	push   $0x10
+  802ac3:	68 00 20 01 e0       	push   $0xe0012000
+  802ac8:	52                   	push   %edx
+  802ac9:	ff 75 0c             	push   0xc(%ebp)
+  802acc:	e8 fe f4 ff ff       	call   801fcf <fmap>
+  802ad1:	83 c4 10             	add    $0x10,%esp
+  802ad4:	85 c0                	test   %eax,%eax
+  802ad6:	0f 8e b8 00 00 00    	jle    802b94 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802adc:	39 c6                	cmp    %eax,%esi
+  802ade:	0f 8d b5 00 00 00    	jge    802b99 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802ae4:	29 f0                	sub    %esi,%eax
+  802ae6:	8b 55 14             	mov    0x14(%ebp),%edx
+  802ae9:	29 da                	sub    %ebx,%edx
+  802aeb:	39 d0                	cmp    %edx,%eax
+  802aed:	89 d3                	mov    %edx,%ebx
+  802aef:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af5:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802afa:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802b00:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802b06:	8b 45 18             	mov    0x18(%ebp),%eax
+  802b09:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802b0e:	83 ec 0c             	sub    $0xc,%esp
+  802b11:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802b13:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802b1a:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802b1d:	83 c0 01             	add    $0x1,%eax
+  802b20:	50                   	push   %eax
+  802b21:	68 00 10 01 e0       	push   $0xe0011000
+  802b26:	6a 11                	push   $0x11
+  802b28:	ff 35 c4 63 80 00    	push   0x8063c4
+  802b2e:	e8 ba 12 00 00       	call   803ded <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802b33:	83 c4 1c             	add    $0x1c,%esp
+  802b36:	6a 00                	push   $0x0
+  802b38:	6a 00                	push   $0x0
+  802b3a:	6a 00                	push   $0x0
+  802b3c:	e8 e8 0f 00 00       	call   803b29 <ipc_recv>
+  802b41:	83 c4 10             	add    $0x10,%esp
+  802b44:	85 c0                	test   %eax,%eax
+  802b46:	78 5b                	js     802ba3 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802b48:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802b4a:	39 c3                	cmp    %eax,%ebx
+  802b4c:	0f 8e 4c ff ff ff    	jle    802a9e <nsipc_sendfile+0x28>
+  802b52:	eb 45                	jmp    802b99 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802b54:	83 ec 04             	sub    $0x4,%esp
+  802b57:	6a 07                	push   $0x7
+  802b59:	68 00 10 01 e0       	push   $0xe0011000
+  802b5e:	6a 00                	push   $0x0
+  802b60:	e8 25 e7 ff ff       	call   80128a <sys_page_alloc>
+  802b65:	89 c7                	mov    %eax,%edi
+  802b67:	83 c4 10             	add    $0x10,%esp
+  802b6a:	85 c0                	test   %eax,%eax
+  802b6c:	78 2b                	js     802b99 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802b6e:	c7 05 c8 63 80 00 01 	movl   $0x1,0x8063c8
+  802b75:	00 00 00 
+  802b78:	e9 0f ff ff ff       	jmp    802a8c <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b7d:	83 ec 0c             	sub    $0xc,%esp
+  802b80:	6a 03                	push   $0x3
+  802b82:	e8 9b 12 00 00       	call   803e22 <ipc_find_env>
+  802b87:	a3 c4 63 80 00       	mov    %eax,0x8063c4
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	e9 05 ff ff ff       	jmp    802a99 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802b94:	85 ff                	test   %edi,%edi
+  802b96:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802b99:	89 f8                	mov    %edi,%eax
+  802b9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b9e:	5b                   	pop    %ebx
+  802b9f:	5e                   	pop    %esi
+  802ba0:	5f                   	pop    %edi
+  802ba1:	5d                   	pop    %ebp
+  802ba2:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802ba3:	85 ff                	test   %edi,%edi
+  802ba5:	0f 44 f8             	cmove  %eax,%edi
+  802ba8:	eb ef                	jmp    802b99 <nsipc_sendfile+0x123>
+
+00802baa <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802baa:	55                   	push   %ebp
+  802bab:	89 e5                	mov    %esp,%ebp
+  802bad:	57                   	push   %edi
+  802bae:	56                   	push   %esi
+  802baf:	53                   	push   %ebx
+  802bb0:	83 ec 1c             	sub    $0x1c,%esp
+  802bb3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802bb6:	e8 13 f9 ff ff       	call   8024ce <nsbulk_map>
+  802bbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bbe:	85 c0                	test   %eax,%eax
+  802bc0:	0f 88 ba 00 00 00    	js     802c80 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802bc6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802bca:	0f 8e bb 00 00 00    	jle    802c8b <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802bd0:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802bda:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802bdf:	89 f8                	mov    %edi,%eax
+  802be1:	29 f0                	sub    %esi,%eax
+  802be3:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802be7:	39 c8                	cmp    %ecx,%eax
+  802be9:	0f 47 c1             	cmova  %ecx,%eax
+  802bec:	01 f0                	add    %esi,%eax
+  802bee:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802bf0:	83 c2 01             	add    $0x1,%edx
+  802bf3:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802bf6:	7e 07                	jle    802bff <nsipc_recvmsg+0x55>
+  802bf8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802bfd:	7e e0                	jle    802bdf <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802bff:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802c05:	c1 fa 0c             	sar    $0xc,%edx
+  802c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0d:	e8 0a f9 ff ff       	call   80251c <nsbulk_own>
+  802c12:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c15:	85 c0                	test   %eax,%eax
+  802c17:	78 67                	js     802c80 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1c:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802c21:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802c27:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c2a:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802c2f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802c34:	89 f2                	mov    %esi,%edx
+  802c36:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802c3b:	e8 44 f9 ff ff       	call   802584 <nsipc_bulk>
+  802c40:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c43:	85 c0                	test   %eax,%eax
+  802c45:	78 39                	js     802c80 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802c47:	39 f0                	cmp    %esi,%eax
+  802c49:	7f 4a                	jg     802c95 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802c4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	7e 2c                	jle    802c80 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802c54:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802c57:	29 fe                	sub    %edi,%esi
+  802c59:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c5c:	39 c6                	cmp    %eax,%esi
+  802c5e:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802c61:	83 ec 04             	sub    $0x4,%esp
+  802c64:	56                   	push   %esi
+  802c65:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802c6b:	50                   	push   %eax
+  802c6c:	ff 33                	push   (%ebx)
+  802c6e:	e8 93 e3 ff ff       	call   801006 <memmove>
+		n += m;
+  802c73:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802c75:	83 c3 08             	add    $0x8,%ebx
+  802c78:	83 c4 10             	add    $0x10,%esp
+  802c7b:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802c7e:	7f d4                	jg     802c54 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802c80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c86:	5b                   	pop    %ebx
+  802c87:	5e                   	pop    %esi
+  802c88:	5f                   	pop    %edi
+  802c89:	5d                   	pop    %ebp
+  802c8a:	c3                   	ret
+	int r, i, n, len = 0;
+  802c8b:	be 00 00 00 00       	mov    $0x0,%esi
+  802c90:	e9 6a ff ff ff       	jmp    802bff <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802c95:	68 e0 45 80 00       	push   $0x8045e0
+  802c9a:	68 e9 45 80 00       	push   $0x8045e9
+  802c9f:	68 3b 01 00 00       	push   $0x13b
+  802ca4:	68 fe 45 80 00       	push   $0x8045fe
+  802ca9:	e8 d6 d9 ff ff       	call   800684 <_panic>
+
+00802cae <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	57                   	push   %edi
+  802cb2:	56                   	push   %esi
+  802cb3:	53                   	push   %ebx
+  802cb4:	83 ec 0c             	sub    $0xc,%esp
+  802cb7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802cba:	8b 75 10             	mov    0x10(%ebp),%esi
+  802cbd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802cc8:	8b 07                	mov    (%edi),%eax
+  802cca:	a3 04 80 80 00       	mov    %eax,0x808004
+  802ccf:	8b 47 04             	mov    0x4(%edi),%eax
+  802cd2:	a3 08 80 80 00       	mov    %eax,0x808008
+  802cd7:	8b 47 08             	mov    0x8(%edi),%eax
+  802cda:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802cdf:	8b 47 0c             	mov    0xc(%edi),%eax
+  802ce2:	a3 10 80 80 00       	mov    %eax,0x808010
+  802ce7:	8b 47 10             	mov    0x10(%edi),%eax
+  802cea:	a3 14 80 80 00       	mov    %eax,0x808014
+  802cef:	8b 47 14             	mov    0x14(%edi),%eax
+  802cf2:	a3 18 80 80 00       	mov    %eax,0x808018
+  802cf7:	8b 47 18             	mov    0x18(%edi),%eax
+  802cfa:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802cff:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802d02:	a3 20 80 80 00       	mov    %eax,0x808020
+  802d07:	8b 47 20             	mov    0x20(%edi),%eax
+  802d0a:	a3 24 80 80 00       	mov    %eax,0x808024
+  802d0f:	8b 47 24             	mov    0x24(%edi),%eax
+  802d12:	a3 28 80 80 00       	mov    %eax,0x808028
+  802d17:	8b 47 28             	mov    0x28(%edi),%eax
+  802d1a:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802d1f:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802d22:	a3 30 80 80 00       	mov    %eax,0x808030
+  802d27:	8b 47 30             	mov    0x30(%edi),%eax
+  802d2a:	a3 34 80 80 00       	mov    %eax,0x808034
+  802d2f:	8b 47 34             	mov    0x34(%edi),%eax
+  802d32:	a3 38 80 80 00       	mov    %eax,0x808038
+  802d37:	8b 47 38             	mov    0x38(%edi),%eax
+  802d3a:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802d3f:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802d42:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802d47:	8b 06                	mov    (%esi),%eax
+  802d49:	a3 44 80 80 00       	mov    %eax,0x808044
+  802d4e:	8b 46 04             	mov    0x4(%esi),%eax
+  802d51:	a3 48 80 80 00       	mov    %eax,0x808048
+  802d56:	8b 46 08             	mov    0x8(%esi),%eax
+  802d59:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802d5e:	8b 46 0c             	mov    0xc(%esi),%eax
+  802d61:	a3 50 80 80 00       	mov    %eax,0x808050
+  802d66:	8b 46 10             	mov    0x10(%esi),%eax
+  802d69:	a3 54 80 80 00       	mov    %eax,0x808054
+  802d6e:	8b 46 14             	mov    0x14(%esi),%eax
+  802d71:	a3 58 80 80 00       	mov    %eax,0x808058
+  802d76:	8b 46 18             	mov    0x18(%esi),%eax
+  802d79:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802d7e:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802d81:	a3 60 80 80 00       	mov    %eax,0x808060
+  802d86:	8b 46 20             	mov    0x20(%esi),%eax
+  802d89:	a3 64 80 80 00       	mov    %eax,0x808064
+  802d8e:	8b 46 24             	mov    0x24(%esi),%eax
+  802d91:	a3 68 80 80 00       	mov    %eax,0x808068
+  802d96:	8b 46 28             	mov    0x28(%esi),%eax
+  802d99:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802d9e:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802da1:	a3 70 80 80 00       	mov    %eax,0x808070
+  802da6:	8b 46 30             	mov    0x30(%esi),%eax
+  802da9:	a3 74 80 80 00       	mov    %eax,0x808074
+  802dae:	8b 46 34             	mov    0x34(%esi),%eax
+  802db1:	a3 78 80 80 00       	mov    %eax,0x808078
+  802db6:	8b 46 38             	mov    0x38(%esi),%eax
+  802db9:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802dbe:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802dc1:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802dc6:	8b 03                	mov    (%ebx),%eax
+  802dc8:	a3 84 80 80 00       	mov    %eax,0x808084
+  802dcd:	8b 43 04             	mov    0x4(%ebx),%eax
+  802dd0:	a3 88 80 80 00       	mov    %eax,0x808088
+  802dd5:	8b 43 08             	mov    0x8(%ebx),%eax
+  802dd8:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802ddd:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802de0:	a3 90 80 80 00       	mov    %eax,0x808090
+  802de5:	8b 43 10             	mov    0x10(%ebx),%eax
+  802de8:	a3 94 80 80 00       	mov    %eax,0x808094
+  802ded:	8b 43 14             	mov    0x14(%ebx),%eax
+  802df0:	a3 98 80 80 00       	mov    %eax,0x808098
+  802df5:	8b 43 18             	mov    0x18(%ebx),%eax
+  802df8:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802dfd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802e00:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802e05:	8b 43 20             	mov    0x20(%ebx),%eax
+  802e08:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802e0d:	8b 43 24             	mov    0x24(%ebx),%eax
+  802e10:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802e15:	8b 43 28             	mov    0x28(%ebx),%eax
+  802e18:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802e1d:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802e20:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802e25:	8b 43 30             	mov    0x30(%ebx),%eax
+  802e28:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802e2d:	8b 43 34             	mov    0x34(%ebx),%eax
+  802e30:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802e35:	8b 43 38             	mov    0x38(%ebx),%eax
+  802e38:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802e3d:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802e40:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802e45:	8b 45 18             	mov    0x18(%ebp),%eax
+  802e48:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802e4d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802e52:	e8 2b f6 ff ff       	call   802482 <nsipc>
+  802e57:	85 c0                	test   %eax,%eax
+  802e59:	0f 88 ad 01 00 00    	js     80300c <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802e5f:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802e65:	89 17                	mov    %edx,(%edi)
+  802e67:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802e6d:	89 57 04             	mov    %edx,0x4(%edi)
+  802e70:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802e76:	89 57 08             	mov    %edx,0x8(%edi)
+  802e79:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802e7f:	89 57 0c             	mov    %edx,0xc(%edi)
+  802e82:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802e88:	89 57 10             	mov    %edx,0x10(%edi)
+  802e8b:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802e91:	89 57 14             	mov    %edx,0x14(%edi)
+  802e94:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802e9a:	89 57 18             	mov    %edx,0x18(%edi)
+  802e9d:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802ea3:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802ea6:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802eac:	89 57 20             	mov    %edx,0x20(%edi)
+  802eaf:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802eb5:	89 57 24             	mov    %edx,0x24(%edi)
+  802eb8:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802ebe:	89 57 28             	mov    %edx,0x28(%edi)
+  802ec1:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802ec7:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802eca:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802ed0:	89 57 30             	mov    %edx,0x30(%edi)
+  802ed3:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802ed9:	89 57 34             	mov    %edx,0x34(%edi)
+  802edc:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802ee2:	89 57 38             	mov    %edx,0x38(%edi)
+  802ee5:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802eeb:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802eee:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802ef4:	89 16                	mov    %edx,(%esi)
+  802ef6:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802efc:	89 56 04             	mov    %edx,0x4(%esi)
+  802eff:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802f05:	89 56 08             	mov    %edx,0x8(%esi)
+  802f08:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802f0e:	89 56 0c             	mov    %edx,0xc(%esi)
+  802f11:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802f17:	89 56 10             	mov    %edx,0x10(%esi)
+  802f1a:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802f20:	89 56 14             	mov    %edx,0x14(%esi)
+  802f23:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802f29:	89 56 18             	mov    %edx,0x18(%esi)
+  802f2c:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802f32:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802f35:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802f3b:	89 56 20             	mov    %edx,0x20(%esi)
+  802f3e:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802f44:	89 56 24             	mov    %edx,0x24(%esi)
+  802f47:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802f4d:	89 56 28             	mov    %edx,0x28(%esi)
+  802f50:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802f56:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802f59:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802f5f:	89 56 30             	mov    %edx,0x30(%esi)
+  802f62:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802f68:	89 56 34             	mov    %edx,0x34(%esi)
+  802f6b:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802f71:	89 56 38             	mov    %edx,0x38(%esi)
+  802f74:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802f7a:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802f7d:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802f83:	89 13                	mov    %edx,(%ebx)
+  802f85:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802f8b:	89 53 04             	mov    %edx,0x4(%ebx)
+  802f8e:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802f94:	89 53 08             	mov    %edx,0x8(%ebx)
+  802f97:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802f9d:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802fa0:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802fa6:	89 53 10             	mov    %edx,0x10(%ebx)
+  802fa9:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802faf:	89 53 14             	mov    %edx,0x14(%ebx)
+  802fb2:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802fb8:	89 53 18             	mov    %edx,0x18(%ebx)
+  802fbb:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802fc1:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802fc4:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802fca:	89 53 20             	mov    %edx,0x20(%ebx)
+  802fcd:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802fd3:	89 53 24             	mov    %edx,0x24(%ebx)
+  802fd6:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802fdc:	89 53 28             	mov    %edx,0x28(%ebx)
+  802fdf:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802fe5:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802fe8:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802fee:	89 53 30             	mov    %edx,0x30(%ebx)
+  802ff1:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802ff7:	89 53 34             	mov    %edx,0x34(%ebx)
+  802ffa:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803000:	89 53 38             	mov    %edx,0x38(%ebx)
+  803003:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803009:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80300c:	83 c4 0c             	add    $0xc,%esp
+  80300f:	5b                   	pop    %ebx
+  803010:	5e                   	pop    %esi
+  803011:	5f                   	pop    %edi
+  803012:	5d                   	pop    %ebp
+  803013:	c3                   	ret
+
+00803014 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803014:	55                   	push   %ebp
+  803015:	89 e5                	mov    %esp,%ebp
+  803017:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80301a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803022:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803025:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  80302a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80302d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  803032:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803037:	e8 46 f4 ff ff       	call   802482 <nsipc>
+}
+  80303c:	c9                   	leave
+  80303d:	c3                   	ret
+
+0080303e <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80303e:	55                   	push   %ebp
+  80303f:	89 e5                	mov    %esp,%ebp
+  803041:	56                   	push   %esi
+  803042:	53                   	push   %ebx
+  803043:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803046:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80304c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80304f:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803054:	b8 10 00 00 00       	mov    $0x10,%eax
+  803059:	e8 24 f4 ff ff       	call   802482 <nsipc>
+  80305e:	89 c3                	mov    %eax,%ebx
+  803060:	85 c0                	test   %eax,%eax
+  803062:	7e 1f                	jle    803083 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803064:	39 c6                	cmp    %eax,%esi
+  803066:	7c 24                	jl     80308c <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803068:	83 ec 04             	sub    $0x4,%esp
+  80306b:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803072:	50                   	push   %eax
+  803073:	68 00 80 80 00       	push   $0x808000
+  803078:	ff 75 08             	push   0x8(%ebp)
+  80307b:	e8 86 df ff ff       	call   801006 <memmove>
+  803080:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803083:	89 d8                	mov    %ebx,%eax
+  803085:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803088:	5b                   	pop    %ebx
+  803089:	5e                   	pop    %esi
+  80308a:	5d                   	pop    %ebp
+  80308b:	c3                   	ret
+		assert(r <= max);
+  80308c:	68 16 46 80 00       	push   $0x804616
+  803091:	68 e9 45 80 00       	push   $0x8045e9
+  803096:	68 6a 01 00 00       	push   $0x16a
+  80309b:	68 fe 45 80 00       	push   $0x8045fe
+  8030a0:	e8 df d5 ff ff       	call   800684 <_panic>
+
+008030a5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8030a5:	55                   	push   %ebp
+  8030a6:	89 e5                	mov    %esp,%ebp
+  8030a8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8030ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ae:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8030b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030b6:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8030bb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030be:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8030c3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8030c8:	e8 b5 f3 ff ff       	call   802482 <nsipc>
+}
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+
+008030cf <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8030cf:	55                   	push   %ebp
+  8030d0:	89 e5                	mov    %esp,%ebp
+  8030d2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8030d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d8:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8030dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8030e2:	e8 9b f3 ff ff       	call   802482 <nsipc>
+}
+  8030e7:	c9                   	leave
+  8030e8:	c3                   	ret
+
+008030e9 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8030e9:	55                   	push   %ebp
+  8030ea:	89 e5                	mov    %esp,%ebp
+  8030ec:	53                   	push   %ebx
+  8030ed:	83 ec 04             	sub    $0x4,%esp
+  8030f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8030f3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8030f8:	e8 85 f3 ff ff       	call   802482 <nsipc>
+  8030fd:	85 c0                	test   %eax,%eax
+  8030ff:	78 50                	js     803151 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803101:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  803107:	89 13                	mov    %edx,(%ebx)
+  803109:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80310f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803112:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803118:	89 53 08             	mov    %edx,0x8(%ebx)
+  80311b:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803121:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803124:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80312a:	89 53 10             	mov    %edx,0x10(%ebx)
+  80312d:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803133:	89 53 14             	mov    %edx,0x14(%ebx)
+  803136:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80313c:	89 53 18             	mov    %edx,0x18(%ebx)
+  80313f:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803145:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803148:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80314e:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803154:	c9                   	leave
+  803155:	c3                   	ret
+
+00803156 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803156:	55                   	push   %ebp
+  803157:	89 e5                	mov    %esp,%ebp
+  803159:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80315c:	6a 03                	push   $0x3
+  80315e:	e8 bf 0c 00 00       	call   803e22 <ipc_find_env>
+  803163:	a3 c4 63 80 00       	mov    %eax,0x8063c4
+	nsipcbuf.shard.req_shard = shard;
+  803168:	8b 45 08             	mov    0x8(%ebp),%eax
+  80316b:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803170:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803175:	e8 08 f3 ff ff       	call   802482 <nsipc>
+  80317a:	83 c4 10             	add    $0x10,%esp
+  80317d:	85 c0                	test   %eax,%eax
+  80317f:	78 0a                	js     80318b <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803181:	a3 c4 63 80 00       	mov    %eax,0x8063c4
+	return 0;
+  803186:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80318b:	c9                   	leave
+  80318c:	c3                   	ret
+
+0080318d <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80318d:	55                   	push   %ebp
+  80318e:	89 e5                	mov    %esp,%ebp
+  803190:	57                   	push   %edi
+  803191:	56                   	push   %esi
+  803192:	53                   	push   %ebx
+  803193:	83 ec 1c             	sub    $0x1c,%esp
+  803196:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803199:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80319c:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8031a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031a6:	89 e0                	mov    %esp,%eax
+  8031a8:	89 f2                	mov    %esi,%edx
+  8031aa:	29 c2                	sub    %eax,%edx
+  8031ac:	89 d0                	mov    %edx,%eax
+  8031ae:	c1 e8 0f             	shr    $0xf,%eax
+  8031b1:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8031b7:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8031ba:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  8031c1:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8031c4:	83 ec 0c             	sub    $0xc,%esp
+  8031c7:	ff 75 e0             	push   -0x20(%ebp)
+  8031ca:	e8 92 0c 00 00       	call   803e61 <pageref>
+  8031cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031d2:	83 c4 04             	add    $0x4,%esp
+  8031d5:	ff 75 dc             	push   -0x24(%ebp)
+  8031d8:	e8 84 0c 00 00       	call   803e61 <pageref>
+  8031dd:	89 e2                	mov    %esp,%edx
+  8031df:	89 f1                	mov    %esi,%ecx
+  8031e1:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8031e3:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8031e6:	89 ca                	mov    %ecx,%edx
+  8031e8:	c1 ea 0f             	shr    $0xf,%edx
+  8031eb:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8031f1:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8031f4:	8b 14 95 e0 63 80 00 	mov    0x8063e0(,%edx,4),%edx
+  8031fb:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8031fe:	39 d7                	cmp    %edx,%edi
+  803200:	74 40                	je     803242 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803202:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803205:	75 9f                	jne    8031a6 <_pipeisclosed+0x19>
+  803207:	89 e2                	mov    %esp,%edx
+  803209:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80320e:	29 d0                	sub    %edx,%eax
+  803210:	89 c2                	mov    %eax,%edx
+  803212:	c1 ea 0f             	shr    $0xf,%edx
+  803215:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80321a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321f:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803222:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803229:	8b 40 58             	mov    0x58(%eax),%eax
+  80322c:	6a 01                	push   $0x1
+  80322e:	50                   	push   %eax
+  80322f:	57                   	push   %edi
+  803230:	68 1f 46 80 00       	push   $0x80461f
+  803235:	e8 25 d5 ff ff       	call   80075f <cprintf>
+  80323a:	83 c4 10             	add    $0x10,%esp
+  80323d:	e9 5f ff ff ff       	jmp    8031a1 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803242:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803245:	0f 94 c0             	sete   %al
+  803248:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80324b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80324e:	5b                   	pop    %ebx
+  80324f:	5e                   	pop    %esi
+  803250:	5f                   	pop    %edi
+  803251:	5d                   	pop    %ebp
+  803252:	c3                   	ret
+
+00803253 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803253:	55                   	push   %ebp
+  803254:	89 e5                	mov    %esp,%ebp
+  803256:	53                   	push   %ebx
+  803257:	83 ec 0c             	sub    $0xc,%esp
+  80325a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80325d:	53                   	push   %ebx
+  80325e:	6a 00                	push   $0x0
+  803260:	e8 aa e0 ff ff       	call   80130f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803265:	89 1c 24             	mov    %ebx,(%esp)
+  803268:	e8 f4 e4 ff ff       	call   801761 <fd2data>
+  80326d:	83 c4 08             	add    $0x8,%esp
+  803270:	50                   	push   %eax
+  803271:	6a 00                	push   $0x0
+  803273:	e8 97 e0 ff ff       	call   80130f <sys_page_unmap>
+}
+  803278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80327b:	c9                   	leave
+  80327c:	c3                   	ret
+
+0080327d <devpipe_read>:
+{
+  80327d:	55                   	push   %ebp
+  80327e:	89 e5                	mov    %esp,%ebp
+  803280:	57                   	push   %edi
+  803281:	56                   	push   %esi
+  803282:	53                   	push   %ebx
+  803283:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803286:	ff 75 08             	push   0x8(%ebp)
+  803289:	e8 d3 e4 ff ff       	call   801761 <fd2data>
+  80328e:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803290:	8b 70 04             	mov    0x4(%eax),%esi
+  803293:	8b 00                	mov    (%eax),%eax
+  803295:	83 c4 10             	add    $0x10,%esp
+  803298:	39 f0                	cmp    %esi,%eax
+  80329a:	75 36                	jne    8032d2 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80329c:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80329f:	89 da                	mov    %ebx,%edx
+  8032a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a4:	e8 e4 fe ff ff       	call   80318d <_pipeisclosed>
+  8032a9:	85 c0                	test   %eax,%eax
+  8032ab:	0f 85 d4 00 00 00    	jne    803385 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8032b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032b6:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8032ba:	83 ec 04             	sub    $0x4,%esp
+  8032bd:	6a ff                	push   $0xffffffff
+  8032bf:	56                   	push   %esi
+  8032c0:	57                   	push   %edi
+  8032c1:	e8 c2 e3 ff ff       	call   801688 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8032c6:	8b 73 04             	mov    0x4(%ebx),%esi
+  8032c9:	8b 03                	mov    (%ebx),%eax
+  8032cb:	83 c4 10             	add    $0x10,%esp
+  8032ce:	39 c6                	cmp    %eax,%esi
+  8032d0:	74 cd                	je     80329f <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032d2:	8b 73 04             	mov    0x4(%ebx),%esi
+  8032d5:	8b 03                	mov    (%ebx),%eax
+  8032d7:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8032dd:	29 c6                	sub    %eax,%esi
+  8032df:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8032e4:	f7 e6                	mul    %esi
+  8032e6:	c1 ea 0c             	shr    $0xc,%edx
+  8032e9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032ef:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8032f1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8032f4:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8032f8:	8b 0b                	mov    (%ebx),%ecx
+  8032fa:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8032ff:	f7 e1                	mul    %ecx
+  803301:	c1 ea 0b             	shr    $0xb,%edx
+  803304:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80330a:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80330c:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803311:	29 cf                	sub    %ecx,%edi
+  803313:	39 f7                	cmp    %esi,%edi
+  803315:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803318:	83 ec 04             	sub    $0x4,%esp
+  80331b:	57                   	push   %edi
+  80331c:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803320:	50                   	push   %eax
+  803321:	ff 75 0c             	push   0xc(%ebp)
+  803324:	e8 dd dc ff ff       	call   801006 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803329:	83 c4 0c             	add    $0xc,%esp
+  80332c:	89 f0                	mov    %esi,%eax
+  80332e:	29 f8                	sub    %edi,%eax
+  803330:	50                   	push   %eax
+  803331:	8d 43 10             	lea    0x10(%ebx),%eax
+  803334:	50                   	push   %eax
+  803335:	89 f8                	mov    %edi,%eax
+  803337:	03 45 0c             	add    0xc(%ebp),%eax
+  80333a:	50                   	push   %eax
+  80333b:	e8 c6 dc ff ff       	call   801006 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803340:	8b 0b                	mov    (%ebx),%ecx
+  803342:	01 f1                	add    %esi,%ecx
+  803344:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803349:	f7 e1                	mul    %ecx
+  80334b:	c1 ea 0c             	shr    $0xc,%edx
+  80334e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803354:	29 c1                	sub    %eax,%ecx
+  803356:	89 0b                	mov    %ecx,(%ebx)
+  803358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335d:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803361:	83 c4 10             	add    $0x10,%esp
+  803364:	85 c0                	test   %eax,%eax
+  803366:	75 0a                	jne    803372 <devpipe_read+0xf5>
+	return n;
+  803368:	89 f0                	mov    %esi,%eax
+}
+  80336a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80336d:	5b                   	pop    %ebx
+  80336e:	5e                   	pop    %esi
+  80336f:	5f                   	pop    %edi
+  803370:	5d                   	pop    %ebp
+  803371:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803372:	83 ec 08             	sub    $0x8,%esp
+  803375:	68 00 04 00 00       	push   $0x400
+  80337a:	53                   	push   %ebx
+  80337b:	e8 2a e3 ff ff       	call   8016aa <sys_futex_wake>
+  803380:	83 c4 10             	add    $0x10,%esp
+  803383:	eb e3                	jmp    803368 <devpipe_read+0xeb>
+			return 0;
+  803385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338a:	eb de                	jmp    80336a <devpipe_read+0xed>
+
+0080338c <devpipe_write>:
+{
+  80338c:	55                   	push   %ebp
+  80338d:	89 e5                	mov    %esp,%ebp
+  80338f:	57                   	push   %edi
+  803390:	56                   	push   %esi
+  803391:	53                   	push   %ebx
+  803392:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803395:	ff 75 08             	push   0x8(%ebp)
+  803398:	e8 c4 e3 ff ff       	call   801761 <fd2data>
+  80339d:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80339f:	83 c4 10             	add    $0x10,%esp
+  8033a2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8033a9:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8033ae:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033b2:	0f 84 43 01 00 00    	je     8034fb <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8033b8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8033bb:	8b 06                	mov    (%esi),%eax
+  8033bd:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8033c3:	29 c1                	sub    %eax,%ecx
+  8033c5:	89 c8                	mov    %ecx,%eax
+  8033c7:	f7 e7                	mul    %edi
+  8033c9:	c1 ea 0c             	shr    $0xc,%edx
+  8033cc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8033d2:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8033d4:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8033da:	75 52                	jne    80342e <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8033dc:	89 f2                	mov    %esi,%edx
+  8033de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e1:	e8 a7 fd ff ff       	call   80318d <_pipeisclosed>
+  8033e6:	85 c0                	test   %eax,%eax
+  8033e8:	0f 85 28 01 00 00    	jne    803516 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8033ee:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8033f0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8033f3:	8b 06                	mov    (%esi),%eax
+  8033f5:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8033fb:	29 c1                	sub    %eax,%ecx
+  8033fd:	89 c8                	mov    %ecx,%eax
+  8033ff:	f7 e7                	mul    %edi
+  803401:	c1 ea 0c             	shr    $0xc,%edx
+  803404:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80340a:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80340c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803412:	75 a4                	jne    8033b8 <devpipe_write+0x2c>
+  803414:	b8 01 00 00 00       	mov    $0x1,%eax
+  803419:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80341d:	83 ec 04             	sub    $0x4,%esp
+  803420:	6a ff                	push   $0xffffffff
+  803422:	53                   	push   %ebx
+  803423:	56                   	push   %esi
+  803424:	e8 5f e2 ff ff       	call   801688 <sys_futex_wait>
+}
+  803429:	83 c4 10             	add    $0x10,%esp
+  80342c:	eb 8a                	jmp    8033b8 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80342e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803431:	8b 06                	mov    (%esi),%eax
+  803433:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803439:	29 c1                	sub    %eax,%ecx
+  80343b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803440:	f7 e1                	mul    %ecx
+  803442:	c1 ea 0c             	shr    $0xc,%edx
+  803445:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80344b:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80344d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803452:	89 d8                	mov    %ebx,%eax
+  803454:	29 c8                	sub    %ecx,%eax
+  803456:	8b 55 10             	mov    0x10(%ebp),%edx
+  803459:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80345c:	29 ca                	sub    %ecx,%edx
+  80345e:	39 d0                	cmp    %edx,%eax
+  803460:	0f 46 d0             	cmovbe %eax,%edx
+  803463:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803466:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803469:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80346e:	f7 e1                	mul    %ecx
+  803470:	c1 ea 0b             	shr    $0xb,%edx
+  803473:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803479:	89 ca                	mov    %ecx,%edx
+  80347b:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80347d:	29 d3                	sub    %edx,%ebx
+  80347f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803482:	39 c3                	cmp    %eax,%ebx
+  803484:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803487:	83 ec 04             	sub    $0x4,%esp
+  80348a:	53                   	push   %ebx
+  80348b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80348e:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803491:	51                   	push   %ecx
+  803492:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803496:	50                   	push   %eax
+  803497:	e8 6a db ff ff       	call   801006 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80349c:	83 c4 0c             	add    $0xc,%esp
+  80349f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8034a2:	29 d8                	sub    %ebx,%eax
+  8034a4:	50                   	push   %eax
+  8034a5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8034a8:	01 cb                	add    %ecx,%ebx
+  8034aa:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8034ad:	53                   	push   %ebx
+  8034ae:	8d 46 10             	lea    0x10(%esi),%eax
+  8034b1:	50                   	push   %eax
+  8034b2:	e8 4f db ff ff       	call   801006 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8034b7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8034ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8034bd:	01 c1                	add    %eax,%ecx
+  8034bf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034c4:	f7 e1                	mul    %ecx
+  8034c6:	c1 ea 0c             	shr    $0xc,%edx
+  8034c9:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8034cf:	89 ca                	mov    %ecx,%edx
+  8034d1:	29 c2                	sub    %eax,%edx
+  8034d3:	89 56 04             	mov    %edx,0x4(%esi)
+  8034d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034db:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8034df:	83 c4 10             	add    $0x10,%esp
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	75 1a                	jne    803500 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8034e6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8034e9:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8034ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034ef:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034f2:	0f 82 c0 fe ff ff    	jb     8033b8 <devpipe_write+0x2c>
+  8034f8:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8034fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034fe:	eb 1b                	jmp    80351b <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803500:	83 ec 08             	sub    $0x8,%esp
+  803503:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803508:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80350b:	50                   	push   %eax
+  80350c:	e8 99 e1 ff ff       	call   8016aa <sys_futex_wake>
+  803511:	83 c4 10             	add    $0x10,%esp
+  803514:	eb d0                	jmp    8034e6 <devpipe_write+0x15a>
+				return 0;
+  803516:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80351b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80351e:	5b                   	pop    %ebx
+  80351f:	5e                   	pop    %esi
+  803520:	5f                   	pop    %edi
+  803521:	5d                   	pop    %ebp
+  803522:	c3                   	ret
+
+00803523 <devpipe_stat>:
+{
+  803523:	55                   	push   %ebp
+  803524:	89 e5                	mov    %esp,%ebp
+  803526:	56                   	push   %esi
+  803527:	53                   	push   %ebx
+  803528:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80352b:	83 ec 0c             	sub    $0xc,%esp
+  80352e:	ff 75 08             	push   0x8(%ebp)
+  803531:	e8 2b e2 ff ff       	call   801761 <fd2data>
+  803536:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803538:	83 c4 08             	add    $0x8,%esp
+  80353b:	68 32 46 80 00       	push   $0x804632
+  803540:	53                   	push   %ebx
+  803541:	e8 10 d9 ff ff       	call   800e56 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803546:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803549:	8b 06                	mov    (%esi),%eax
+  80354b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803551:	29 c1                	sub    %eax,%ecx
+  803553:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803558:	89 c8                	mov    %ecx,%eax
+  80355a:	f7 e2                	mul    %edx
+  80355c:	c1 ea 0c             	shr    $0xc,%edx
+  80355f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803565:	29 d1                	sub    %edx,%ecx
+  803567:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80356d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803574:	00 00 00 
+	stat->st_dev = &devpipe;
+  803577:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80357e:	50 80 00 
+}
+  803581:	b8 00 00 00 00       	mov    $0x0,%eax
+  803586:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803589:	5b                   	pop    %ebx
+  80358a:	5e                   	pop    %esi
+  80358b:	5d                   	pop    %ebp
+  80358c:	c3                   	ret
+
+0080358d <devpipe_poll>:
+{
+  80358d:	55                   	push   %ebp
+  80358e:	89 e5                	mov    %esp,%ebp
+  803590:	57                   	push   %edi
+  803591:	56                   	push   %esi
+  803592:	53                   	push   %ebx
+  803593:	83 ec 18             	sub    $0x18,%esp
+  803596:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803599:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80359c:	57                   	push   %edi
+  80359d:	e8 bf e1 ff ff       	call   801761 <fd2data>
+  8035a2:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8035a4:	83 c4 10             	add    $0x10,%esp
+  8035a7:	89 f3                	mov    %esi,%ebx
+  8035a9:	83 e3 01             	and    $0x1,%ebx
+  8035ac:	75 27                	jne    8035d5 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8035ae:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8035b4:	75 48                	jne    8035fe <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8035b6:	89 ca                	mov    %ecx,%edx
+  8035b8:	89 f8                	mov    %edi,%eax
+  8035ba:	e8 ce fb ff ff       	call   80318d <_pipeisclosed>
+  8035bf:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8035c1:	89 d8                	mov    %ebx,%eax
+  8035c3:	83 c8 10             	or     $0x10,%eax
+  8035c6:	85 d2                	test   %edx,%edx
+  8035c8:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8035cb:	89 d8                	mov    %ebx,%eax
+  8035cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035d0:	5b                   	pop    %ebx
+  8035d1:	5e                   	pop    %esi
+  8035d2:	5f                   	pop    %edi
+  8035d3:	5d                   	pop    %ebp
+  8035d4:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035d5:	8b 58 04             	mov    0x4(%eax),%ebx
+  8035d8:	8b 00                	mov    (%eax),%eax
+  8035da:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8035e0:	29 c3                	sub    %eax,%ebx
+  8035e2:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8035e7:	89 d8                	mov    %ebx,%eax
+  8035e9:	f7 e2                	mul    %edx
+  8035eb:	c1 ea 0c             	shr    $0xc,%edx
+  8035ee:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8035f4:	39 d3                	cmp    %edx,%ebx
+  8035f6:	0f 95 c3             	setne  %bl
+  8035f9:	0f b6 db             	movzbl %bl,%ebx
+  8035fc:	eb b0                	jmp    8035ae <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035fe:	8b 71 04             	mov    0x4(%ecx),%esi
+  803601:	8b 01                	mov    (%ecx),%eax
+  803603:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803609:	29 c6                	sub    %eax,%esi
+  80360b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803610:	89 f0                	mov    %esi,%eax
+  803612:	f7 e2                	mul    %edx
+  803614:	c1 ea 0c             	shr    $0xc,%edx
+  803617:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80361d:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80361f:	89 d8                	mov    %ebx,%eax
+  803621:	83 c8 04             	or     $0x4,%eax
+  803624:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80362a:	0f 42 d8             	cmovb  %eax,%ebx
+  80362d:	eb 87                	jmp    8035b6 <devpipe_poll+0x29>
+
+0080362f <pipe>:
+{
+  80362f:	55                   	push   %ebp
+  803630:	89 e5                	mov    %esp,%ebp
+  803632:	56                   	push   %esi
+  803633:	53                   	push   %ebx
+  803634:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803637:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80363a:	50                   	push   %eax
+  80363b:	e8 38 e1 ff ff       	call   801778 <fd_alloc>
+  803640:	89 c3                	mov    %eax,%ebx
+  803642:	83 c4 10             	add    $0x10,%esp
+  803645:	85 c0                	test   %eax,%eax
+  803647:	0f 88 23 01 00 00    	js     803770 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80364d:	83 ec 04             	sub    $0x4,%esp
+  803650:	68 07 04 00 00       	push   $0x407
+  803655:	ff 75 f4             	push   -0xc(%ebp)
+  803658:	6a 00                	push   $0x0
+  80365a:	e8 2b dc ff ff       	call   80128a <sys_page_alloc>
+  80365f:	89 c3                	mov    %eax,%ebx
+  803661:	83 c4 10             	add    $0x10,%esp
+  803664:	85 c0                	test   %eax,%eax
+  803666:	0f 88 04 01 00 00    	js     803770 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80366c:	83 ec 0c             	sub    $0xc,%esp
+  80366f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803672:	50                   	push   %eax
+  803673:	e8 00 e1 ff ff       	call   801778 <fd_alloc>
+  803678:	89 c3                	mov    %eax,%ebx
+  80367a:	83 c4 10             	add    $0x10,%esp
+  80367d:	85 c0                	test   %eax,%eax
+  80367f:	0f 88 db 00 00 00    	js     803760 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803685:	83 ec 04             	sub    $0x4,%esp
+  803688:	68 07 04 00 00       	push   $0x407
+  80368d:	ff 75 f0             	push   -0x10(%ebp)
+  803690:	6a 00                	push   $0x0
+  803692:	e8 f3 db ff ff       	call   80128a <sys_page_alloc>
+  803697:	89 c3                	mov    %eax,%ebx
+  803699:	83 c4 10             	add    $0x10,%esp
+  80369c:	85 c0                	test   %eax,%eax
+  80369e:	0f 88 bc 00 00 00    	js     803760 <pipe+0x131>
+	va = fd2data(fd0);
+  8036a4:	83 ec 0c             	sub    $0xc,%esp
+  8036a7:	ff 75 f4             	push   -0xc(%ebp)
+  8036aa:	e8 b2 e0 ff ff       	call   801761 <fd2data>
+  8036af:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036b1:	83 c4 0c             	add    $0xc,%esp
+  8036b4:	68 07 04 00 00       	push   $0x407
+  8036b9:	50                   	push   %eax
+  8036ba:	6a 00                	push   $0x0
+  8036bc:	e8 c9 db ff ff       	call   80128a <sys_page_alloc>
+  8036c1:	89 c3                	mov    %eax,%ebx
+  8036c3:	83 c4 10             	add    $0x10,%esp
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	0f 88 82 00 00 00    	js     803750 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036ce:	83 ec 0c             	sub    $0xc,%esp
+  8036d1:	ff 75 f0             	push   -0x10(%ebp)
+  8036d4:	e8 88 e0 ff ff       	call   801761 <fd2data>
+  8036d9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8036e0:	50                   	push   %eax
+  8036e1:	6a 00                	push   $0x0
+  8036e3:	56                   	push   %esi
+  8036e4:	6a 00                	push   $0x0
+  8036e6:	e8 e2 db ff ff       	call   8012cd <sys_page_map>
+  8036eb:	89 c3                	mov    %eax,%ebx
+  8036ed:	83 c4 20             	add    $0x20,%esp
+  8036f0:	85 c0                	test   %eax,%eax
+  8036f2:	78 4e                	js     803742 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8036f4:	a1 60 50 80 00       	mov    0x805060,%eax
+  8036f9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8036fc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8036fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803701:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803708:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80370b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80370d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803710:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803717:	83 ec 0c             	sub    $0xc,%esp
+  80371a:	ff 75 f4             	push   -0xc(%ebp)
+  80371d:	e8 2f e0 ff ff       	call   801751 <fd2num>
+  803722:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803725:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803727:	83 c4 04             	add    $0x4,%esp
+  80372a:	ff 75 f0             	push   -0x10(%ebp)
+  80372d:	e8 1f e0 ff ff       	call   801751 <fd2num>
+  803732:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803735:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803738:	83 c4 10             	add    $0x10,%esp
+  80373b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803740:	eb 2e                	jmp    803770 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803742:	83 ec 08             	sub    $0x8,%esp
+  803745:	56                   	push   %esi
+  803746:	6a 00                	push   $0x0
+  803748:	e8 c2 db ff ff       	call   80130f <sys_page_unmap>
+  80374d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803750:	83 ec 08             	sub    $0x8,%esp
+  803753:	ff 75 f0             	push   -0x10(%ebp)
+  803756:	6a 00                	push   $0x0
+  803758:	e8 b2 db ff ff       	call   80130f <sys_page_unmap>
+  80375d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803760:	83 ec 08             	sub    $0x8,%esp
+  803763:	ff 75 f4             	push   -0xc(%ebp)
+  803766:	6a 00                	push   $0x0
+  803768:	e8 a2 db ff ff       	call   80130f <sys_page_unmap>
+  80376d:	83 c4 10             	add    $0x10,%esp
+}
+  803770:	89 d8                	mov    %ebx,%eax
+  803772:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803775:	5b                   	pop    %ebx
+  803776:	5e                   	pop    %esi
+  803777:	5d                   	pop    %ebp
+  803778:	c3                   	ret
+
+00803779 <pipeisclosed>:
+{
+  803779:	55                   	push   %ebp
+  80377a:	89 e5                	mov    %esp,%ebp
+  80377c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80377f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803782:	50                   	push   %eax
+  803783:	ff 75 08             	push   0x8(%ebp)
+  803786:	e8 3d e0 ff ff       	call   8017c8 <fd_lookup>
+  80378b:	83 c4 10             	add    $0x10,%esp
+  80378e:	85 c0                	test   %eax,%eax
+  803790:	78 18                	js     8037aa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803792:	83 ec 0c             	sub    $0xc,%esp
+  803795:	ff 75 f4             	push   -0xc(%ebp)
+  803798:	e8 c4 df ff ff       	call   801761 <fd2data>
+  80379d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80379f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037a2:	e8 e6 f9 ff ff       	call   80318d <_pipeisclosed>
+  8037a7:	83 c4 10             	add    $0x10,%esp
+}
+  8037aa:	c9                   	leave
+  8037ab:	c3                   	ret
+
+008037ac <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8037ac:	55                   	push   %ebp
+  8037ad:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8037af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037b2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8037b8:	5d                   	pop    %ebp
+  8037b9:	c3                   	ret
+
+008037ba <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8037ba:	55                   	push   %ebp
+  8037bb:	89 e5                	mov    %esp,%ebp
+  8037bd:	53                   	push   %ebx
+  8037be:	83 ec 04             	sub    $0x4,%esp
+  8037c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8037c4:	8b 03                	mov    (%ebx),%eax
+  8037c6:	85 c0                	test   %eax,%eax
+  8037c8:	75 05                	jne    8037cf <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8037ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037cd:	c9                   	leave
+  8037ce:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8037cf:	83 ec 08             	sub    $0x8,%esp
+  8037d2:	50                   	push   %eax
+  8037d3:	8d 43 04             	lea    0x4(%ebx),%eax
+  8037d6:	50                   	push   %eax
+  8037d7:	e8 83 dd ff ff       	call   80155f <sys_page_batch>
+	pb->pb_n = 0;
+  8037dc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8037e2:	83 c4 10             	add    $0x10,%esp
+  8037e5:	eb e3                	jmp    8037ca <pgbatch_flush+0x10>
+
+008037e7 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8037e7:	55                   	push   %ebp
+  8037e8:	89 e5                	mov    %esp,%ebp
+  8037ea:	56                   	push   %esi
+  8037eb:	53                   	push   %ebx
+  8037ec:	89 c3                	mov    %eax,%ebx
+  8037ee:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8037f0:	83 38 20             	cmpl   $0x20,(%eax)
+  8037f3:	74 2c                	je     803821 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8037f5:	8b 03                	mov    (%ebx),%eax
+  8037f7:	8d 50 01             	lea    0x1(%eax),%edx
+  8037fa:	89 13                	mov    %edx,(%ebx)
+  8037fc:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8037ff:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803803:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803805:	83 ec 04             	sub    $0x4,%esp
+  803808:	6a 18                	push   $0x18
+  80380a:	6a 00                	push   $0x0
+  80380c:	50                   	push   %eax
+  80380d:	e8 bf d7 ff ff       	call   800fd1 <memset>
+	return 0;
+  803812:	83 c4 10             	add    $0x10,%esp
+  803815:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80381a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80381d:	5b                   	pop    %ebx
+  80381e:	5e                   	pop    %esi
+  80381f:	5d                   	pop    %ebp
+  803820:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803821:	83 ec 0c             	sub    $0xc,%esp
+  803824:	50                   	push   %eax
+  803825:	e8 90 ff ff ff       	call   8037ba <pgbatch_flush>
+  80382a:	83 c4 10             	add    $0x10,%esp
+  80382d:	85 c0                	test   %eax,%eax
+  80382f:	79 c4                	jns    8037f5 <pgbatch_slot+0xe>
+  803831:	eb e7                	jmp    80381a <pgbatch_slot+0x33>
+
+00803833 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803833:	55                   	push   %ebp
+  803834:	89 e5                	mov    %esp,%ebp
+  803836:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803839:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80383c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80383f:	e8 a3 ff ff ff       	call   8037e7 <pgbatch_slot>
+  803844:	85 c0                	test   %eax,%eax
+  803846:	78 20                	js     803868 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803848:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80384b:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803851:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803854:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803857:	8b 55 10             	mov    0x10(%ebp),%edx
+  80385a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80385d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803860:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803863:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803868:	c9                   	leave
+  803869:	c3                   	ret
+
+0080386a <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80386a:	55                   	push   %ebp
+  80386b:	89 e5                	mov    %esp,%ebp
+  80386d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803870:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803873:	8b 45 08             	mov    0x8(%ebp),%eax
+  803876:	e8 6c ff ff ff       	call   8037e7 <pgbatch_slot>
+  80387b:	85 c0                	test   %eax,%eax
+  80387d:	78 2c                	js     8038ab <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80387f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803882:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803888:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80388b:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80388e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803891:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803894:	8b 55 14             	mov    0x14(%ebp),%edx
+  803897:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80389a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80389d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8038a0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8038a3:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8038a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ab:	c9                   	leave
+  8038ac:	c3                   	ret
+
+008038ad <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  8038ad:	55                   	push   %ebp
+  8038ae:	89 e5                	mov    %esp,%ebp
+  8038b0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8038b3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8038b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038b9:	e8 29 ff ff ff       	call   8037e7 <pgbatch_slot>
+  8038be:	85 c0                	test   %eax,%eax
+  8038c0:	78 1a                	js     8038dc <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8038c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038c5:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8038cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8038ce:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8038d1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8038d4:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8038d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038dc:	c9                   	leave
+  8038dd:	c3                   	ret
+
+008038de <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8038de:	55                   	push   %ebp
+  8038df:	89 e5                	mov    %esp,%ebp
+  8038e1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8038e4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8038e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038ea:	e8 f8 fe ff ff       	call   8037e7 <pgbatch_slot>
+  8038ef:	85 c0                	test   %eax,%eax
+  8038f1:	78 20                	js     803913 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8038f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038f6:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8038fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8038ff:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803902:	8b 55 10             	mov    0x10(%ebp),%edx
+  803905:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803908:	8b 55 14             	mov    0x14(%ebp),%edx
+  80390b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80390e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803913:	c9                   	leave
+  803914:	c3                   	ret
+
+00803915 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803915:	55                   	push   %ebp
+  803916:	89 e5                	mov    %esp,%ebp
+  803918:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80391b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80391e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803921:	e8 c1 fe ff ff       	call   8037e7 <pgbatch_slot>
+  803926:	85 c0                	test   %eax,%eax
+  803928:	78 26                	js     803950 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80392a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80392d:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803933:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803936:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803939:	8b 55 10             	mov    0x10(%ebp),%edx
+  80393c:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80393f:	8b 55 14             	mov    0x14(%ebp),%edx
+  803942:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803945:	8b 55 18             	mov    0x18(%ebp),%edx
+  803948:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80394b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803950:	c9                   	leave
+  803951:	c3                   	ret
+
+00803952 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803952:	b8 00 00 00 00       	mov    $0x0,%eax
+  803957:	c3                   	ret
+
+00803958 <devcons_poll>:
+{
+  803958:	55                   	push   %ebp
+  803959:	89 e5                	mov    %esp,%ebp
+  80395b:	53                   	push   %ebx
+  80395c:	83 ec 04             	sub    $0x4,%esp
+  80395f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803962:	89 da                	mov    %ebx,%edx
+  803964:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803967:	83 3d d4 63 80 00 00 	cmpl   $0x0,0x8063d4
+  80396e:	74 0c                	je     80397c <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803970:	89 d8                	mov    %ebx,%eax
+  803972:	83 e0 01             	and    $0x1,%eax
+  803975:	09 d0                	or     %edx,%eax
+}
+  803977:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397a:	c9                   	leave
+  80397b:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80397c:	e8 6b d8 ff ff       	call   8011ec <sys_cgetc>
+  803981:	a3 d4 63 80 00       	mov    %eax,0x8063d4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803986:	89 da                	mov    %ebx,%edx
+  803988:	83 e2 04             	and    $0x4,%edx
+  80398b:	85 c0                	test   %eax,%eax
+  80398d:	74 e6                	je     803975 <devcons_poll+0x1d>
+  80398f:	eb df                	jmp    803970 <devcons_poll+0x18>
+
+00803991 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803991:	55                   	push   %ebp
+  803992:	89 e5                	mov    %esp,%ebp
+  803994:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803997:	68 3e 46 80 00       	push   $0x80463e
+  80399c:	ff 75 0c             	push   0xc(%ebp)
+  80399f:	e8 b2 d4 ff ff       	call   800e56 <strcpy>
+	return 0;
+}
+  8039a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a9:	c9                   	leave
+  8039aa:	c3                   	ret
+
+008039ab <devcons_write>:
+{
+  8039ab:	55                   	push   %ebp
+  8039ac:	89 e5                	mov    %esp,%ebp
+  8039ae:	57                   	push   %edi
+  8039af:	56                   	push   %esi
+  8039b0:	53                   	push   %ebx
+  8039b1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8039b7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8039ba:	85 ff                	test   %edi,%edi
+  8039bc:	74 51                	je     803a0f <devcons_write+0x64>
+  8039be:	be 00 00 00 00       	mov    $0x0,%esi
+  8039c3:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8039c8:	89 fb                	mov    %edi,%ebx
+  8039ca:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8039cc:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8039d1:	39 d3                	cmp    %edx,%ebx
+  8039d3:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8039d6:	83 ec 04             	sub    $0x4,%esp
+  8039d9:	53                   	push   %ebx
+  8039da:	03 45 0c             	add    0xc(%ebp),%eax
+  8039dd:	50                   	push   %eax
+  8039de:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8039e4:	50                   	push   %eax
+  8039e5:	e8 1c d6 ff ff       	call   801006 <memmove>
+		sys_cputs(buf, m);
+  8039ea:	83 c4 08             	add    $0x8,%esp
+  8039ed:	53                   	push   %ebx
+  8039ee:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8039f4:	50                   	push   %eax
+  8039f5:	e8 d4 d7 ff ff       	call   8011ce <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8039fa:	01 de                	add    %ebx,%esi
+  8039fc:	89 f0                	mov    %esi,%eax
+  8039fe:	83 c4 10             	add    $0x10,%esp
+  803a01:	39 fe                	cmp    %edi,%esi
+  803a03:	72 c3                	jb     8039c8 <devcons_write+0x1d>
+}
+  803a05:	89 f0                	mov    %esi,%eax
+  803a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a0a:	5b                   	pop    %ebx
+  803a0b:	5e                   	pop    %esi
+  803a0c:	5f                   	pop    %edi
+  803a0d:	5d                   	pop    %ebp
+  803a0e:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803a0f:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803a14:	eb ef                	jmp    803a05 <devcons_write+0x5a>
+
+00803a16 <devcons_read>:
+{
+  803a16:	55                   	push   %ebp
+  803a17:	89 e5                	mov    %esp,%ebp
+  803a19:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803a21:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a25:	74 36                	je     803a5d <devcons_read+0x47>
+	c = cons_peek;
+  803a27:	a1 d4 63 80 00       	mov    0x8063d4,%eax
+	cons_peek = 0;
+  803a2c:	c7 05 d4 63 80 00 00 	movl   $0x0,0x8063d4
+  803a33:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803a36:	85 c0                	test   %eax,%eax
+  803a38:	75 10                	jne    803a4a <devcons_read+0x34>
+  803a3a:	e8 ad d7 ff ff       	call   8011ec <sys_cgetc>
+  803a3f:	85 c0                	test   %eax,%eax
+  803a41:	75 07                	jne    803a4a <devcons_read+0x34>
+		sys_yield();
+  803a43:	e8 23 d8 ff ff       	call   80126b <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803a48:	eb f0                	jmp    803a3a <devcons_read+0x24>
+	if (c < 0)
+  803a4a:	85 c0                	test   %eax,%eax
+  803a4c:	78 0f                	js     803a5d <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803a4e:	83 f8 04             	cmp    $0x4,%eax
+  803a51:	74 0c                	je     803a5f <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803a53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a56:	88 02                	mov    %al,(%edx)
+	return 1;
+  803a58:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803a5d:	c9                   	leave
+  803a5e:	c3                   	ret
+		return 0;
+  803a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a64:	eb f7                	jmp    803a5d <devcons_read+0x47>
+
+00803a66 <cputchar>:
+{
+  803a66:	55                   	push   %ebp
+  803a67:	89 e5                	mov    %esp,%ebp
+  803a69:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a6f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803a72:	6a 01                	push   $0x1
+  803a74:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a77:	50                   	push   %eax
+  803a78:	e8 51 d7 ff ff       	call   8011ce <sys_cputs>
+}
+  803a7d:	83 c4 10             	add    $0x10,%esp
+  803a80:	c9                   	leave
+  803a81:	c3                   	ret
+
+00803a82 <getchar>:
+{
+  803a82:	55                   	push   %ebp
+  803a83:	89 e5                	mov    %esp,%ebp
+  803a85:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803a88:	6a 01                	push   $0x1
+  803a8a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a8d:	50                   	push   %eax
+  803a8e:	6a 00                	push   $0x0
+  803a90:	e8 b7 df ff ff       	call   801a4c <read>
+	if (r < 0)
+  803a95:	83 c4 10             	add    $0x10,%esp
+  803a98:	85 c0                	test   %eax,%eax
+  803a9a:	78 06                	js     803aa2 <getchar+0x20>
+	if (r < 1)
+  803a9c:	74 06                	je     803aa4 <getchar+0x22>
+	return c;
+  803a9e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803aa2:	c9                   	leave
+  803aa3:	c3                   	ret
+		return -E_EOF;
+  803aa4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803aa9:	eb f7                	jmp    803aa2 <getchar+0x20>
+
+00803aab <iscons>:
+{
+  803aab:	55                   	push   %ebp
+  803aac:	89 e5                	mov    %esp,%ebp
+  803aae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ab1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ab4:	50                   	push   %eax
+  803ab5:	ff 75 08             	push   0x8(%ebp)
+  803ab8:	e8 0b dd ff ff       	call   8017c8 <fd_lookup>
+  803abd:	83 c4 10             	add    $0x10,%esp
+  803ac0:	85 c0                	test   %eax,%eax
+  803ac2:	78 11                	js     803ad5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803ac4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ac7:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803acd:	39 10                	cmp    %edx,(%eax)
+  803acf:	0f 94 c0             	sete   %al
+  803ad2:	0f b6 c0             	movzbl %al,%eax
+}
+  803ad5:	c9                   	leave
+  803ad6:	c3                   	ret
+
+00803ad7 <opencons>:
+{
+  803ad7:	55                   	push   %ebp
+  803ad8:	89 e5                	mov    %esp,%ebp
+  803ada:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803add:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ae0:	50                   	push   %eax
+  803ae1:	e8 92 dc ff ff       	call   801778 <fd_alloc>
+  803ae6:	83 c4 10             	add    $0x10,%esp
+  803ae9:	85 c0                	test   %eax,%eax
+  803aeb:	78 3a                	js     803b27 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803aed:	83 ec 04             	sub    $0x4,%esp
+  803af0:	68 07 04 00 00       	push   $0x407
+  803af5:	ff 75 f4             	push   -0xc(%ebp)
+  803af8:	6a 00                	push   $0x0
+  803afa:	e8 8b d7 ff ff       	call   80128a <sys_page_alloc>
+  803aff:	83 c4 10             	add    $0x10,%esp
+  803b02:	85 c0                	test   %eax,%eax
+  803b04:	78 21                	js     803b27 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803b06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b09:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803b0f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803b11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b14:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803b1b:	83 ec 0c             	sub    $0xc,%esp
+  803b1e:	50                   	push   %eax
+  803b1f:	e8 2d dc ff ff       	call   801751 <fd2num>
+  803b24:	83 c4 10             	add    $0x10,%esp
+}
+  803b27:	c9                   	leave
+  803b28:	c3                   	ret
+
+00803b29 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803b29:	55                   	push   %ebp
+  803b2a:	89 e5                	mov    %esp,%ebp
+  803b2c:	56                   	push   %esi
+  803b2d:	53                   	push   %ebx
+  803b2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803b31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803b37:	85 c0                	test   %eax,%eax
+  803b39:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803b3e:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803b41:	83 ec 0c             	sub    $0xc,%esp
+  803b44:	50                   	push   %eax
+  803b45:	e8 f0 d8 ff ff       	call   80143a <sys_ipc_recv>
+  803b4a:	83 c4 10             	add    $0x10,%esp
+  803b4d:	85 c0                	test   %eax,%eax
+  803b4f:	0f 88 8b 00 00 00    	js     803be0 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803b55:	85 f6                	test   %esi,%esi
+  803b57:	74 2a                	je     803b83 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803b59:	89 e2                	mov    %esp,%edx
+  803b5b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803b60:	29 d0                	sub    %edx,%eax
+  803b62:	89 c2                	mov    %eax,%edx
+  803b64:	c1 ea 0f             	shr    $0xf,%edx
+  803b67:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b71:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803b74:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803b7b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803b81:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803b83:	85 db                	test   %ebx,%ebx
+  803b85:	74 2a                	je     803bb1 <ipc_recv+0x88>
+  803b87:	89 e2                	mov    %esp,%edx
+  803b89:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803b8e:	29 d0                	sub    %edx,%eax
+  803b90:	89 c2                	mov    %eax,%edx
+  803b92:	c1 ea 0f             	shr    $0xf,%edx
+  803b95:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9f:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803ba2:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803ba9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803baf:	89 03                	mov    %eax,(%ebx)
+  803bb1:	89 e2                	mov    %esp,%edx
+  803bb3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803bb8:	29 d0                	sub    %edx,%eax
+  803bba:	89 c2                	mov    %eax,%edx
+  803bbc:	c1 ea 0f             	shr    $0xf,%edx
+  803bbf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc9:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803bcc:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803bd3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803bd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bdc:	5b                   	pop    %ebx
+  803bdd:	5e                   	pop    %esi
+  803bde:	5d                   	pop    %ebp
+  803bdf:	c3                   	ret
+		if(from_env_store != NULL)
+  803be0:	85 f6                	test   %esi,%esi
+  803be2:	74 06                	je     803bea <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803be4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803bea:	85 db                	test   %ebx,%ebx
+  803bec:	74 eb                	je     803bd9 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803bee:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803bf4:	eb e3                	jmp    803bd9 <ipc_recv+0xb0>
+
+00803bf6 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803bf6:	55                   	push   %ebp
+  803bf7:	89 e5                	mov    %esp,%ebp
+  803bf9:	57                   	push   %edi
+  803bfa:	56                   	push   %esi
+  803bfb:	53                   	push   %ebx
+  803bfc:	83 ec 14             	sub    $0x14,%esp
+  803bff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c05:	8b 75 14             	mov    0x14(%ebp),%esi
+  803c08:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803c0b:	85 c0                	test   %eax,%eax
+  803c0d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803c12:	0f 44 c2             	cmove  %edx,%eax
+  803c15:	ff 75 10             	push   0x10(%ebp)
+  803c18:	50                   	push   %eax
+  803c19:	e8 7e d8 ff ff       	call   80149c <sys_ipc_recv_pages>
+  803c1e:	83 c4 10             	add    $0x10,%esp
+  803c21:	85 c0                	test   %eax,%eax
+  803c23:	0f 88 ba 00 00 00    	js     803ce3 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803c29:	85 ff                	test   %edi,%edi
+  803c2b:	74 2a                	je     803c57 <ipc_recv_pages+0x61>
+  803c2d:	89 e2                	mov    %esp,%edx
+  803c2f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803c34:	29 d0                	sub    %edx,%eax
+  803c36:	89 c2                	mov    %eax,%edx
+  803c38:	c1 ea 0f             	shr    $0xf,%edx
+  803c3b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c45:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803c48:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803c4f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803c55:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803c57:	85 f6                	test   %esi,%esi
+  803c59:	74 2a                	je     803c85 <ipc_recv_pages+0x8f>
+  803c5b:	89 e2                	mov    %esp,%edx
+  803c5d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803c62:	29 d0                	sub    %edx,%eax
+  803c64:	89 c2                	mov    %eax,%edx
+  803c66:	c1 ea 0f             	shr    $0xf,%edx
+  803c69:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c73:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803c76:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803c7d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803c83:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803c85:	85 db                	test   %ebx,%ebx
+  803c87:	74 2a                	je     803cb3 <ipc_recv_pages+0xbd>
+  803c89:	89 e2                	mov    %esp,%edx
+  803c8b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803c90:	29 d0                	sub    %edx,%eax
+  803c92:	89 c2                	mov    %eax,%edx
+  803c94:	c1 ea 0f             	shr    $0xf,%edx
+  803c97:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca1:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803ca4:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803cab:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803cb1:	89 03                	mov    %eax,(%ebx)
+  803cb3:	89 e2                	mov    %esp,%edx
+  803cb5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803cba:	29 d0                	sub    %edx,%eax
+  803cbc:	89 c2                	mov    %eax,%edx
+  803cbe:	c1 ea 0f             	shr    $0xf,%edx
+  803cc1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccb:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803cce:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803cd5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cde:	5b                   	pop    %ebx
+  803cdf:	5e                   	pop    %esi
+  803ce0:	5f                   	pop    %edi
+  803ce1:	5d                   	pop    %ebp
+  803ce2:	c3                   	ret
+		if (from_env_store)
+  803ce3:	85 ff                	test   %edi,%edi
+  803ce5:	74 06                	je     803ced <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803ce7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803ced:	85 f6                	test   %esi,%esi
+  803cef:	74 06                	je     803cf7 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803cf1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803cf7:	85 db                	test   %ebx,%ebx
+  803cf9:	74 e0                	je     803cdb <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803cfb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803d01:	eb d8                	jmp    803cdb <ipc_recv_pages+0xe5>
+
+00803d03 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803d03:	55                   	push   %ebp
+  803d04:	89 e5                	mov    %esp,%ebp
+  803d06:	57                   	push   %edi
+  803d07:	56                   	push   %esi
+  803d08:	53                   	push   %ebx
+  803d09:	83 ec 1c             	sub    $0x1c,%esp
+  803d0c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803d0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d12:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803d18:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803d1c:	75 2b                	jne    803d49 <ipc_try_send_pages+0x46>
+  803d1e:	89 e2                	mov    %esp,%edx
+  803d20:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803d25:	29 d0                	sub    %edx,%eax
+  803d27:	89 c2                	mov    %eax,%edx
+  803d29:	c1 ea 0f             	shr    $0xf,%edx
+  803d2c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d36:	0f 42 c2             	cmovb  %edx,%eax
+  803d39:	8b 04 85 e0 63 80 00 	mov    0x8063e0(,%eax,4),%eax
+  803d40:	8b 70 48             	mov    0x48(%eax),%esi
+  803d43:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803d49:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803d4f:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803d54:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803d57:	85 ff                	test   %edi,%edi
+  803d59:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803d5e:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803d61:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803d67:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803d6d:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803d73:	83 ec 0c             	sub    $0xc,%esp
+  803d76:	ff 75 14             	push   0x14(%ebp)
+  803d79:	ff 75 18             	push   0x18(%ebp)
+  803d7c:	57                   	push   %edi
+  803d7d:	ff 75 0c             	push   0xc(%ebp)
+  803d80:	ff 75 08             	push   0x8(%ebp)
+  803d83:	e8 f3 d6 ff ff       	call   80147b <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803d88:	83 c4 20             	add    $0x20,%esp
+  803d8b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803d8e:	75 21                	jne    803db1 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803d90:	83 ec 04             	sub    $0x4,%esp
+  803d93:	6a ff                	push   $0xffffffff
+  803d95:	53                   	push   %ebx
+  803d96:	ff 75 e4             	push   -0x1c(%ebp)
+  803d99:	e8 ea d8 ff ff       	call   801688 <sys_futex_wait>
+  803d9e:	83 c4 10             	add    $0x10,%esp
+  803da1:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803da4:	74 c7                	je     803d6d <ipc_try_send_pages+0x6a>
+  803da6:	85 c0                	test   %eax,%eax
+  803da8:	79 c3                	jns    803d6d <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803daa:	e8 bc d4 ff ff       	call   80126b <sys_yield>
+  803daf:	eb bc                	jmp    803d6d <ipc_try_send_pages+0x6a>
+	}
+}
+  803db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803db4:	5b                   	pop    %ebx
+  803db5:	5e                   	pop    %esi
+  803db6:	5f                   	pop    %edi
+  803db7:	5d                   	pop    %ebp
+  803db8:	c3                   	ret
+
+00803db9 <ipc_send>:
+{
+  803db9:	55                   	push   %ebp
+  803dba:	89 e5                	mov    %esp,%ebp
+  803dbc:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803dbf:	ff 75 14             	push   0x14(%ebp)
+  803dc2:	6a 01                	push   $0x1
+  803dc4:	ff 75 10             	push   0x10(%ebp)
+  803dc7:	ff 75 0c             	push   0xc(%ebp)
+  803dca:	ff 75 08             	push   0x8(%ebp)
+  803dcd:	e8 31 ff ff ff       	call   803d03 <ipc_try_send_pages>
+  803dd2:	83 c4 20             	add    $0x20,%esp
+  803dd5:	85 c0                	test   %eax,%eax
+  803dd7:	78 02                	js     803ddb <ipc_send+0x22>
+}
+  803dd9:	c9                   	leave
+  803dda:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803ddb:	50                   	push   %eax
+  803ddc:	68 4a 46 80 00       	push   $0x80464a
+  803de1:	6a 3f                	push   $0x3f
+  803de3:	68 5f 46 80 00       	push   $0x80465f
+  803de8:	e8 97 c8 ff ff       	call   800684 <_panic>
+
+00803ded <ipc_send_pages>:
+{
+  803ded:	55                   	push   %ebp
+  803dee:	89 e5                	mov    %esp,%ebp
+  803df0:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803df3:	ff 75 18             	push   0x18(%ebp)
+  803df6:	ff 75 14             	push   0x14(%ebp)
+  803df9:	ff 75 10             	push   0x10(%ebp)
+  803dfc:	ff 75 0c             	push   0xc(%ebp)
+  803dff:	ff 75 08             	push   0x8(%ebp)
+  803e02:	e8 fc fe ff ff       	call   803d03 <ipc_try_send_pages>
+  803e07:	83 c4 20             	add    $0x20,%esp
+  803e0a:	85 c0                	test   %eax,%eax
+  803e0c:	78 02                	js     803e10 <ipc_send_pages+0x23>
+}
+  803e0e:	c9                   	leave
+  803e0f:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803e10:	50                   	push   %eax
+  803e11:	68 69 46 80 00       	push   $0x804669
+  803e16:	6a 64                	push   $0x64
+  803e18:	68 5f 46 80 00       	push   $0x80465f
+  803e1d:	e8 62 c8 ff ff       	call   800684 <_panic>
+
+00803e22 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803e22:	55                   	push   %ebp
+  803e23:	89 e5                	mov    %esp,%ebp
+  803e25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803e28:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803e2d:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803e33:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803e39:	8b 52 50             	mov    0x50(%edx),%edx
+  803e3c:	39 ca                	cmp    %ecx,%edx
+  803e3e:	74 11                	je     803e51 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803e40:	83 c0 01             	add    $0x1,%eax
+  803e43:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803e48:	75 e3                	jne    803e2d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4f:	eb 0e                	jmp    803e5f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803e51:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803e57:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e5c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803e5f:	5d                   	pop    %ebp
+  803e60:	c3                   	ret
+
+00803e61 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803e61:	55                   	push   %ebp
+  803e62:	89 e5                	mov    %esp,%ebp
+  803e64:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803e67:	89 c2                	mov    %eax,%edx
+  803e69:	c1 ea 16             	shr    $0x16,%edx
+  803e6c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803e73:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803e78:	f6 c1 01             	test   $0x1,%cl
+  803e7b:	74 1e                	je     803e9b <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803e7d:	c1 e8 0c             	shr    $0xc,%eax
+  803e80:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803e87:	a8 01                	test   $0x1,%al
+  803e89:	74 10                	je     803e9b <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803e8b:	c1 e8 0c             	shr    $0xc,%eax
+  803e8e:	c1 e0 04             	shl    $0x4,%eax
+  803e91:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803e98:	0f b7 d2             	movzwl %dx,%edx
+}
+  803e9b:	89 d0                	mov    %edx,%eax
+  803e9d:	5d                   	pop    %ebp
+  803e9e:	c3                   	ret
+
+00803e9f <__udivdi3>:
+  803e9f:	57                   	push   %edi
+  803ea0:	56                   	push   %esi
+  803ea1:	53                   	push   %ebx
+  803ea2:	83 ec 20             	sub    $0x20,%esp
+  803ea5:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803ea9:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803ead:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803eb1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803eb5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803eb9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803ebd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803ec1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803ec5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ed4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803edb:	00 
+  803edc:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ee3:	00 
+  803ee4:	eb 08                	jmp    803eee <__udivdi3+0x4f>
+  803ee6:	83 e9 01             	sub    $0x1,%ecx
+  803ee9:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803eec:	74 68                	je     803f56 <__udivdi3+0xb7>
+  803eee:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803ef2:	01 c0                	add    %eax,%eax
+  803ef4:	89 c6                	mov    %eax,%esi
+  803ef6:	89 d7                	mov    %edx,%edi
+  803ef8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803efc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f00:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f03:	d3 ea                	shr    %cl,%edx
+  803f05:	f6 c1 20             	test   $0x20,%cl
+  803f08:	74 04                	je     803f0e <__udivdi3+0x6f>
+  803f0a:	89 d0                	mov    %edx,%eax
+  803f0c:	31 d2                	xor    %edx,%edx
+  803f0e:	83 e0 01             	and    $0x1,%eax
+  803f11:	89 04 24             	mov    %eax,(%esp)
+  803f14:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f1b:	00 
+  803f1c:	8b 04 24             	mov    (%esp),%eax
+  803f1f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f23:	09 f0                	or     %esi,%eax
+  803f25:	09 fa                	or     %edi,%edx
+  803f27:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f2b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f2f:	39 f0                	cmp    %esi,%eax
+  803f31:	89 d3                	mov    %edx,%ebx
+  803f33:	19 fb                	sbb    %edi,%ebx
+  803f35:	72 af                	jb     803ee6 <__udivdi3+0x47>
+  803f37:	29 f0                	sub    %esi,%eax
+  803f39:	19 fa                	sbb    %edi,%edx
+  803f3b:	89 cf                	mov    %ecx,%edi
+  803f3d:	c1 ef 05             	shr    $0x5,%edi
+  803f40:	83 e7 01             	and    $0x1,%edi
+  803f43:	89 fe                	mov    %edi,%esi
+  803f45:	83 f6 01             	xor    $0x1,%esi
+  803f48:	d3 e6                	shl    %cl,%esi
+  803f4a:	d3 e7                	shl    %cl,%edi
+  803f4c:	09 74 24 18          	or     %esi,0x18(%esp)
+  803f50:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803f54:	eb 90                	jmp    803ee6 <__udivdi3+0x47>
+  803f56:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f5a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f5e:	83 c4 20             	add    $0x20,%esp
+  803f61:	5b                   	pop    %ebx
+  803f62:	5e                   	pop    %esi
+  803f63:	5f                   	pop    %edi
+  803f64:	c3                   	ret
+
+00803f65 <__umoddi3>:
+  803f65:	57                   	push   %edi
+  803f66:	56                   	push   %esi
+  803f67:	53                   	push   %ebx
+  803f68:	83 ec 08             	sub    $0x8,%esp
+  803f6b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f6f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f73:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803f77:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803f7b:	57                   	push   %edi
+  803f7c:	56                   	push   %esi
+  803f7d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f81:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f85:	52                   	push   %edx
+  803f86:	50                   	push   %eax
+  803f87:	e8 13 ff ff ff       	call   803e9f <__udivdi3>
+  803f8c:	89 c3                	mov    %eax,%ebx
+  803f8e:	0f af d6             	imul   %esi,%edx
+  803f91:	89 f9                	mov    %edi,%ecx
+  803f93:	0f af cb             	imul   %ebx,%ecx
+  803f96:	01 d1                	add    %edx,%ecx
+  803f98:	89 d8                	mov    %ebx,%eax
+  803f9a:	f7 e6                	mul    %esi
+  803f9c:	89 c6                	mov    %eax,%esi
+  803f9e:	89 d7                	mov    %edx,%edi
+  803fa0:	01 cf                	add    %ecx,%edi
+  803fa2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803fa6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803faa:	29 f0                	sub    %esi,%eax
+  803fac:	19 fa                	sbb    %edi,%edx
+  803fae:	83 c4 18             	add    $0x18,%esp
+  803fb1:	5b                   	pop    %ebx
+  803fb2:	5e                   	pop    %esi
+  803fb3:	5f                   	pop    %edi
+  803fb4:	c3                   	ret
+
+00803fb5 <__divdi3>:
+  803fb5:	53                   	push   %ebx
+  803fb6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803fba:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803fbe:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803fc2:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803fc6:	85 d2                	test   %edx,%edx
+  803fc8:	78 12                	js     803fdc <__divdi3+0x27>
+  803fca:	85 db                	test   %ebx,%ebx
+  803fcc:	78 2e                	js     803ffc <__divdi3+0x47>
+  803fce:	53                   	push   %ebx
+  803fcf:	51                   	push   %ecx
+  803fd0:	52                   	push   %edx
+  803fd1:	50                   	push   %eax
+  803fd2:	e8 c8 fe ff ff       	call   803e9f <__udivdi3>
+  803fd7:	83 c4 10             	add    $0x10,%esp
+  803fda:	eb 1e                	jmp    803ffa <__divdi3+0x45>
+  803fdc:	f7 d8                	neg    %eax
+  803fde:	83 d2 00             	adc    $0x0,%edx
+  803fe1:	f7 da                	neg    %edx
+  803fe3:	85 db                	test   %ebx,%ebx
+  803fe5:	78 2a                	js     804011 <__divdi3+0x5c>
+  803fe7:	53                   	push   %ebx
+  803fe8:	51                   	push   %ecx
+  803fe9:	52                   	push   %edx
+  803fea:	50                   	push   %eax
+  803feb:	e8 af fe ff ff       	call   803e9f <__udivdi3>
+  803ff0:	83 c4 10             	add    $0x10,%esp
+  803ff3:	f7 d8                	neg    %eax
+  803ff5:	83 d2 00             	adc    $0x0,%edx
+  803ff8:	f7 da                	neg    %edx
+  803ffa:	5b                   	pop    %ebx
+  803ffb:	c3                   	ret
+  803ffc:	f7 d9                	neg    %ecx
+  803ffe:	83 d3 00             	adc    $0x0,%ebx
+  804001:	f7 db                	neg    %ebx
+  804003:	53                   	push   %ebx
+  804004:	51                   	push   %ecx
+  804005:	52                   	push   %edx
+  804006:	50                   	push   %eax
+  804007:	e8 93 fe ff ff       	call   803e9f <__udivdi3>
+  80400c:	83 c4 10             	add    $0x10,%esp
+  80400f:	eb e2                	jmp    803ff3 <__divdi3+0x3e>
+  804011:	f7 d9                	neg    %ecx
+  804013:	83 d3 00             	adc    $0x0,%ebx
+  804016:	f7 db                	neg    %ebx
+  804018:	53                   	push   %ebx
+  804019:	51                   	push   %ecx
+  80401a:	52                   	push   %edx
+  80401b:	50                   	push   %eax
+  80401c:	e8 7e fe ff ff       	call   803e9f <__udivdi3>
+  804021:	83 c4 10             	add    $0x10,%esp
+  804024:	eb d4                	jmp    803ffa <__divdi3+0x45>
+
+00804026 <__moddi3>:
+  804026:	57                   	push   %edi
+  804027:	56                   	push   %esi
+  804028:	53                   	push   %ebx
+  804029:	83 ec 08             	sub    $0x8,%esp
+  80402c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804030:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804034:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804038:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80403c:	57                   	push   %edi
+  80403d:	56                   	push   %esi
+  80403e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804042:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804046:	52                   	push   %edx
+  804047:	50                   	push   %eax
+  804048:	e8 68 ff ff ff       	call   803fb5 <__divdi3>
+  80404d:	89 c3                	mov    %eax,%ebx
+  80404f:	0f af d6             	imul   %esi,%edx
+  804052:	89 f9                	mov    %edi,%ecx
+  804054:	0f af cb             	imul   %ebx,%ecx
+  804057:	01 d1                	add    %edx,%ecx
+  804059:	89 d8                	mov    %ebx,%eax
+  80405b:	f7 e6                	mul    %esi
+  80405d:	89 c6                	mov    %eax,%esi
+  80405f:	89 d7                	mov    %edx,%edi
+  804061:	01 cf                	add    %ecx,%edi
+  804063:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804067:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80406b:	29 f0                	sub    %esi,%eax
+  80406d:	19 fa                	sbb    %edi,%edx
+  80406f:	83 c4 18             	add    $0x18,%esp
+  804072:	5b                   	pop    %ebx
+  804073:	5e                   	pop    %esi
+  804074:	5f                   	pop    %edi
+  804075:	c3                   	ret
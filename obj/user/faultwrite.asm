@@ -0,0 +1,7854 @@
+
+obj/user/faultwrite.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0f 00 00 00       	call   800040 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0 = 0;
+  800035:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80003c:	00 00 00 
+}
+  80003f:	c3                   	ret
+
+00800040 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800040:	55                   	push   %ebp
+  800041:	89 e5                	mov    %esp,%ebp
+  800043:	56                   	push   %esi
+  800044:	53                   	push   %ebx
+  800045:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800048:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80004b:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80004d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800052:	29 d0                	sub    %edx,%eax
+  800054:	89 c2                	mov    %eax,%edx
+  800056:	c1 ea 0f             	shr    $0xf,%edx
+  800059:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800063:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800066:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  80006d:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800071:	e8 ef 00 00 00       	call   800165 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800076:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800081:	89 e1                	mov    %esp,%ecx
+  800083:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800088:	29 ca                	sub    %ecx,%edx
+  80008a:	89 d1                	mov    %edx,%ecx
+  80008c:	c1 e9 0f             	shr    $0xf,%ecx
+  80008f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800095:	ba 00 00 00 00       	mov    $0x0,%edx
+  80009a:	0f 42 d1             	cmovb  %ecx,%edx
+  80009d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a2:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a9:	85 db                	test   %ebx,%ebx
+  8000ab:	7e 07                	jle    8000b4 <libmain+0x74>
+		binaryname = argv[0];
+  8000ad:	8b 06                	mov    (%esi),%eax
+  8000af:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b4:	83 ec 08             	sub    $0x8,%esp
+  8000b7:	56                   	push   %esi
+  8000b8:	53                   	push   %ebx
+  8000b9:	e8 77 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000be:	e8 0a 00 00 00       	call   8000cd <exit>
+}
+  8000c3:	83 c4 10             	add    $0x10,%esp
+  8000c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5d                   	pop    %ebp
+  8000cc:	c3                   	ret
+
+008000cd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000cd:	55                   	push   %ebp
+  8000ce:	89 e5                	mov    %esp,%ebp
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000d3:	e8 17 07 00 00       	call   8007ef <close_all>
+	sys_env_destroy(0);
+  8000d8:	83 ec 0c             	sub    $0xc,%esp
+  8000db:	6a 00                	push   $0x0
+  8000dd:	e8 42 00 00 00       	call   800124 <sys_env_destroy>
+}
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	c9                   	leave
+  8000e6:	c3                   	ret
+
+008000e7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000e7:	55                   	push   %ebp
+  8000e8:	89 e5                	mov    %esp,%ebp
+  8000ea:	57                   	push   %edi
+  8000eb:	56                   	push   %esi
+  8000ec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000f8:	89 c3                	mov    %eax,%ebx
+  8000fa:	89 c7                	mov    %eax,%edi
+  8000fc:	89 c6                	mov    %eax,%esi
+  8000fe:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800100:	5b                   	pop    %ebx
+  800101:	5e                   	pop    %esi
+  800102:	5f                   	pop    %edi
+  800103:	5d                   	pop    %ebp
+  800104:	c3                   	ret
+
+00800105 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	57                   	push   %edi
+  800109:	56                   	push   %esi
+  80010a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80010b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800110:	b8 01 00 00 00       	mov    $0x1,%eax
+  800115:	89 d1                	mov    %edx,%ecx
+  800117:	89 d3                	mov    %edx,%ebx
+  800119:	89 d7                	mov    %edx,%edi
+  80011b:	89 d6                	mov    %edx,%esi
+  80011d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80011f:	5b                   	pop    %ebx
+  800120:	5e                   	pop    %esi
+  800121:	5f                   	pop    %edi
+  800122:	5d                   	pop    %ebp
+  800123:	c3                   	ret
+
+00800124 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800124:	55                   	push   %ebp
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	57                   	push   %edi
+  800128:	56                   	push   %esi
+  800129:	53                   	push   %ebx
+  80012a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80012d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800132:	8b 55 08             	mov    0x8(%ebp),%edx
+  800135:	b8 03 00 00 00       	mov    $0x3,%eax
+  80013a:	89 cb                	mov    %ecx,%ebx
+  80013c:	89 cf                	mov    %ecx,%edi
+  80013e:	89 ce                	mov    %ecx,%esi
+  800140:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800142:	85 c0                	test   %eax,%eax
+  800144:	7f 08                	jg     80014e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800146:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800149:	5b                   	pop    %ebx
+  80014a:	5e                   	pop    %esi
+  80014b:	5f                   	pop    %edi
+  80014c:	5d                   	pop    %ebp
+  80014d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80014e:	83 ec 0c             	sub    $0xc,%esp
+  800151:	50                   	push   %eax
+  800152:	6a 03                	push   $0x3
+  800154:	68 8a 3a 80 00       	push   $0x803a8a
+  800159:	6a 23                	push   $0x23
+  80015b:	68 a7 3a 80 00       	push   $0x803aa7
+  800160:	e8 79 28 00 00       	call   8029de <_panic>
+
+00800165 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800165:	55                   	push   %ebp
+  800166:	89 e5                	mov    %esp,%ebp
+  800168:	57                   	push   %edi
+  800169:	56                   	push   %esi
+  80016a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80016b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800170:	b8 02 00 00 00       	mov    $0x2,%eax
+  800175:	89 d1                	mov    %edx,%ecx
+  800177:	89 d3                	mov    %edx,%ebx
+  800179:	89 d7                	mov    %edx,%edi
+  80017b:	89 d6                	mov    %edx,%esi
+  80017d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80017f:	5b                   	pop    %ebx
+  800180:	5e                   	pop    %esi
+  800181:	5f                   	pop    %edi
+  800182:	5d                   	pop    %ebp
+  800183:	c3                   	ret
+
+00800184 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800184:	55                   	push   %ebp
+  800185:	89 e5                	mov    %esp,%ebp
+  800187:	57                   	push   %edi
+  800188:	56                   	push   %esi
+  800189:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80018a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800194:	89 d1                	mov    %edx,%ecx
+  800196:	89 d3                	mov    %edx,%ebx
+  800198:	89 d7                	mov    %edx,%edi
+  80019a:	89 d6                	mov    %edx,%esi
+  80019c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80019e:	5b                   	pop    %ebx
+  80019f:	5e                   	pop    %esi
+  8001a0:	5f                   	pop    %edi
+  8001a1:	5d                   	pop    %ebp
+  8001a2:	c3                   	ret
+
+008001a3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001a3:	55                   	push   %ebp
+  8001a4:	89 e5                	mov    %esp,%ebp
+  8001a6:	57                   	push   %edi
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001bf:	89 f7                	mov    %esi,%edi
+  8001c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001c3:	85 c0                	test   %eax,%eax
+  8001c5:	7f 08                	jg     8001cf <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ca:	5b                   	pop    %ebx
+  8001cb:	5e                   	pop    %esi
+  8001cc:	5f                   	pop    %edi
+  8001cd:	5d                   	pop    %ebp
+  8001ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001cf:	83 ec 0c             	sub    $0xc,%esp
+  8001d2:	50                   	push   %eax
+  8001d3:	6a 04                	push   $0x4
+  8001d5:	68 8a 3a 80 00       	push   $0x803a8a
+  8001da:	6a 23                	push   $0x23
+  8001dc:	68 a7 3a 80 00       	push   $0x803aa7
+  8001e1:	e8 f8 27 00 00       	call   8029de <_panic>
+
+008001e6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e6:	55                   	push   %ebp
+  8001e7:	89 e5                	mov    %esp,%ebp
+  8001e9:	57                   	push   %edi
+  8001ea:	56                   	push   %esi
+  8001eb:	53                   	push   %ebx
+  8001ec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800200:	8b 75 18             	mov    0x18(%ebp),%esi
+  800203:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800205:	85 c0                	test   %eax,%eax
+  800207:	7f 08                	jg     800211 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800209:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020c:	5b                   	pop    %ebx
+  80020d:	5e                   	pop    %esi
+  80020e:	5f                   	pop    %edi
+  80020f:	5d                   	pop    %ebp
+  800210:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800211:	83 ec 0c             	sub    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	6a 05                	push   $0x5
+  800217:	68 8a 3a 80 00       	push   $0x803a8a
+  80021c:	6a 23                	push   $0x23
+  80021e:	68 a7 3a 80 00       	push   $0x803aa7
+  800223:	e8 b6 27 00 00       	call   8029de <_panic>
+
+00800228 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	57                   	push   %edi
+  80022c:	56                   	push   %esi
+  80022d:	53                   	push   %ebx
+  80022e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800231:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800236:	8b 55 08             	mov    0x8(%ebp),%edx
+  800239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800241:	89 df                	mov    %ebx,%edi
+  800243:	89 de                	mov    %ebx,%esi
+  800245:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800247:	85 c0                	test   %eax,%eax
+  800249:	7f 08                	jg     800253 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80024b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024e:	5b                   	pop    %ebx
+  80024f:	5e                   	pop    %esi
+  800250:	5f                   	pop    %edi
+  800251:	5d                   	pop    %ebp
+  800252:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800253:	83 ec 0c             	sub    $0xc,%esp
+  800256:	50                   	push   %eax
+  800257:	6a 06                	push   $0x6
+  800259:	68 8a 3a 80 00       	push   $0x803a8a
+  80025e:	6a 23                	push   $0x23
+  800260:	68 a7 3a 80 00       	push   $0x803aa7
+  800265:	e8 74 27 00 00       	call   8029de <_panic>
+
+0080026a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	57                   	push   %edi
+  80026e:	56                   	push   %esi
+  80026f:	53                   	push   %ebx
+  800270:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800283:	89 df                	mov    %ebx,%edi
+  800285:	89 de                	mov    %ebx,%esi
+  800287:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800289:	85 c0                	test   %eax,%eax
+  80028b:	7f 08                	jg     800295 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80028d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800290:	5b                   	pop    %ebx
+  800291:	5e                   	pop    %esi
+  800292:	5f                   	pop    %edi
+  800293:	5d                   	pop    %ebp
+  800294:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800295:	83 ec 0c             	sub    $0xc,%esp
+  800298:	50                   	push   %eax
+  800299:	6a 08                	push   $0x8
+  80029b:	68 8a 3a 80 00       	push   $0x803a8a
+  8002a0:	6a 23                	push   $0x23
+  8002a2:	68 a7 3a 80 00       	push   $0x803aa7
+  8002a7:	e8 32 27 00 00       	call   8029de <_panic>
+
+008002ac <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002ac:	55                   	push   %ebp
+  8002ad:	89 e5                	mov    %esp,%ebp
+  8002af:	57                   	push   %edi
+  8002b0:	56                   	push   %esi
+  8002b1:	53                   	push   %ebx
+  8002b2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002c5:	89 df                	mov    %ebx,%edi
+  8002c7:	89 de                	mov    %ebx,%esi
+  8002c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002cb:	85 c0                	test   %eax,%eax
+  8002cd:	7f 08                	jg     8002d7 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d2:	5b                   	pop    %ebx
+  8002d3:	5e                   	pop    %esi
+  8002d4:	5f                   	pop    %edi
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002d7:	83 ec 0c             	sub    $0xc,%esp
+  8002da:	50                   	push   %eax
+  8002db:	6a 09                	push   $0x9
+  8002dd:	68 8a 3a 80 00       	push   $0x803a8a
+  8002e2:	6a 23                	push   $0x23
+  8002e4:	68 a7 3a 80 00       	push   $0x803aa7
+  8002e9:	e8 f0 26 00 00       	call   8029de <_panic>
+
+008002ee <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002ee:	55                   	push   %ebp
+  8002ef:	89 e5                	mov    %esp,%ebp
+  8002f1:	57                   	push   %edi
+  8002f2:	56                   	push   %esi
+  8002f3:	53                   	push   %ebx
+  8002f4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800302:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800307:	89 df                	mov    %ebx,%edi
+  800309:	89 de                	mov    %ebx,%esi
+  80030b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80030d:	85 c0                	test   %eax,%eax
+  80030f:	7f 08                	jg     800319 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800314:	5b                   	pop    %ebx
+  800315:	5e                   	pop    %esi
+  800316:	5f                   	pop    %edi
+  800317:	5d                   	pop    %ebp
+  800318:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800319:	83 ec 0c             	sub    $0xc,%esp
+  80031c:	50                   	push   %eax
+  80031d:	6a 0a                	push   $0xa
+  80031f:	68 8a 3a 80 00       	push   $0x803a8a
+  800324:	6a 23                	push   $0x23
+  800326:	68 a7 3a 80 00       	push   $0x803aa7
+  80032b:	e8 ae 26 00 00       	call   8029de <_panic>
+
+00800330 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800330:	55                   	push   %ebp
+  800331:	89 e5                	mov    %esp,%ebp
+  800333:	57                   	push   %edi
+  800334:	56                   	push   %esi
+  800335:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800336:	8b 55 08             	mov    0x8(%ebp),%edx
+  800339:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800341:	be 00 00 00 00       	mov    $0x0,%esi
+  800346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800349:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80034c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80034e:	5b                   	pop    %ebx
+  80034f:	5e                   	pop    %esi
+  800350:	5f                   	pop    %edi
+  800351:	5d                   	pop    %ebp
+  800352:	c3                   	ret
+
+00800353 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800353:	55                   	push   %ebp
+  800354:	89 e5                	mov    %esp,%ebp
+  800356:	57                   	push   %edi
+  800357:	56                   	push   %esi
+  800358:	53                   	push   %ebx
+  800359:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80035c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800361:	8b 55 08             	mov    0x8(%ebp),%edx
+  800364:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800369:	89 cb                	mov    %ecx,%ebx
+  80036b:	89 cf                	mov    %ecx,%edi
+  80036d:	89 ce                	mov    %ecx,%esi
+  80036f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800371:	85 c0                	test   %eax,%eax
+  800373:	7f 08                	jg     80037d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800378:	5b                   	pop    %ebx
+  800379:	5e                   	pop    %esi
+  80037a:	5f                   	pop    %edi
+  80037b:	5d                   	pop    %ebp
+  80037c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80037d:	83 ec 0c             	sub    $0xc,%esp
+  800380:	50                   	push   %eax
+  800381:	6a 0d                	push   $0xd
+  800383:	68 8a 3a 80 00       	push   $0x803a8a
+  800388:	6a 23                	push   $0x23
+  80038a:	68 a7 3a 80 00       	push   $0x803aa7
+  80038f:	e8 4a 26 00 00       	call   8029de <_panic>
+
+00800394 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800394:	55                   	push   %ebp
+  800395:	89 e5                	mov    %esp,%ebp
+  800397:	57                   	push   %edi
+  800398:	56                   	push   %esi
+  800399:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80039a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80039d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003ab:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003ae:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003b0:	5b                   	pop    %ebx
+  8003b1:	5e                   	pop    %esi
+  8003b2:	5f                   	pop    %edi
+  8003b3:	5d                   	pop    %ebp
+  8003b4:	c3                   	ret
+
+008003b5 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003b5:	55                   	push   %ebp
+  8003b6:	89 e5                	mov    %esp,%ebp
+  8003b8:	57                   	push   %edi
+  8003b9:	56                   	push   %esi
+  8003ba:	53                   	push   %ebx
+  8003bb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003ce:	89 df                	mov    %ebx,%edi
+  8003d0:	89 de                	mov    %ebx,%esi
+  8003d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003d4:	85 c0                	test   %eax,%eax
+  8003d6:	7f 08                	jg     8003e0 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003db:	5b                   	pop    %ebx
+  8003dc:	5e                   	pop    %esi
+  8003dd:	5f                   	pop    %edi
+  8003de:	5d                   	pop    %ebp
+  8003df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003e0:	83 ec 0c             	sub    $0xc,%esp
+  8003e3:	50                   	push   %eax
+  8003e4:	6a 0d                	push   $0xd
+  8003e6:	68 8a 3a 80 00       	push   $0x803a8a
+  8003eb:	6a 23                	push   $0x23
+  8003ed:	68 a7 3a 80 00       	push   $0x803aa7
+  8003f2:	e8 e7 25 00 00       	call   8029de <_panic>
+
+008003f7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8003f7:	55                   	push   %ebp
+  8003f8:	89 e5                	mov    %esp,%ebp
+  8003fa:	57                   	push   %edi
+  8003fb:	56                   	push   %esi
+  8003fc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800402:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800407:	89 d1                	mov    %edx,%ecx
+  800409:	89 d3                	mov    %edx,%ebx
+  80040b:	89 d7                	mov    %edx,%edi
+  80040d:	89 d6                	mov    %edx,%esi
+  80040f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800411:	5b                   	pop    %ebx
+  800412:	5e                   	pop    %esi
+  800413:	5f                   	pop    %edi
+  800414:	5d                   	pop    %ebp
+  800415:	c3                   	ret
+
+00800416 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800416:	55                   	push   %ebp
+  800417:	89 e5                	mov    %esp,%ebp
+  800419:	57                   	push   %edi
+  80041a:	56                   	push   %esi
+  80041b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80041c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800421:	8b 55 08             	mov    0x8(%ebp),%edx
+  800424:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800427:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80042c:	89 df                	mov    %ebx,%edi
+  80042e:	89 de                	mov    %ebx,%esi
+  800430:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800432:	5b                   	pop    %ebx
+  800433:	5e                   	pop    %esi
+  800434:	5f                   	pop    %edi
+  800435:	5d                   	pop    %ebp
+  800436:	c3                   	ret
+
+00800437 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	57                   	push   %edi
+  80043b:	56                   	push   %esi
+  80043c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80043d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800442:	8b 55 08             	mov    0x8(%ebp),%edx
+  800445:	b8 10 00 00 00       	mov    $0x10,%eax
+  80044a:	89 cb                	mov    %ecx,%ebx
+  80044c:	89 cf                	mov    %ecx,%edi
+  80044e:	89 ce                	mov    %ecx,%esi
+  800450:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800452:	5b                   	pop    %ebx
+  800453:	5e                   	pop    %esi
+  800454:	5f                   	pop    %edi
+  800455:	5d                   	pop    %ebp
+  800456:	c3                   	ret
+
+00800457 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800457:	55                   	push   %ebp
+  800458:	89 e5                	mov    %esp,%ebp
+  80045a:	57                   	push   %edi
+  80045b:	56                   	push   %esi
+  80045c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80045d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800462:	8b 55 08             	mov    0x8(%ebp),%edx
+  800465:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800468:	b8 11 00 00 00       	mov    $0x11,%eax
+  80046d:	89 df                	mov    %ebx,%edi
+  80046f:	89 de                	mov    %ebx,%esi
+  800471:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800473:	5b                   	pop    %ebx
+  800474:	5e                   	pop    %esi
+  800475:	5f                   	pop    %edi
+  800476:	5d                   	pop    %ebp
+  800477:	c3                   	ret
+
+00800478 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800478:	55                   	push   %ebp
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	57                   	push   %edi
+  80047c:	56                   	push   %esi
+  80047d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80047e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800483:	8b 55 08             	mov    0x8(%ebp),%edx
+  800486:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800489:	b8 12 00 00 00       	mov    $0x12,%eax
+  80048e:	89 df                	mov    %ebx,%edi
+  800490:	89 de                	mov    %ebx,%esi
+  800492:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  800494:	5b                   	pop    %ebx
+  800495:	5e                   	pop    %esi
+  800496:	5f                   	pop    %edi
+  800497:	5d                   	pop    %ebp
+  800498:	c3                   	ret
+
+00800499 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800499:	55                   	push   %ebp
+  80049a:	89 e5                	mov    %esp,%ebp
+  80049c:	57                   	push   %edi
+  80049d:	56                   	push   %esi
+  80049e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004ac:	89 cb                	mov    %ecx,%ebx
+  8004ae:	89 cf                	mov    %ecx,%edi
+  8004b0:	89 ce                	mov    %ecx,%esi
+  8004b2:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004b4:	5b                   	pop    %ebx
+  8004b5:	5e                   	pop    %esi
+  8004b6:	5f                   	pop    %edi
+  8004b7:	5d                   	pop    %ebp
+  8004b8:	c3                   	ret
+
+008004b9 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004b9:	55                   	push   %ebp
+  8004ba:	89 e5                	mov    %esp,%ebp
+  8004bc:	57                   	push   %edi
+  8004bd:	56                   	push   %esi
+  8004be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ca:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004cf:	89 df                	mov    %ebx,%edi
+  8004d1:	89 de                	mov    %ebx,%esi
+  8004d3:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004d5:	5b                   	pop    %ebx
+  8004d6:	5e                   	pop    %esi
+  8004d7:	5f                   	pop    %edi
+  8004d8:	5d                   	pop    %ebp
+  8004d9:	c3                   	ret
+
+008004da <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004da:	55                   	push   %ebp
+  8004db:	89 e5                	mov    %esp,%ebp
+  8004dd:	57                   	push   %edi
+  8004de:	56                   	push   %esi
+  8004df:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8004ed:	89 cb                	mov    %ecx,%ebx
+  8004ef:	89 cf                	mov    %ecx,%edi
+  8004f1:	89 ce                	mov    %ecx,%esi
+  8004f3:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8004f5:	5b                   	pop    %ebx
+  8004f6:	5e                   	pop    %esi
+  8004f7:	5f                   	pop    %edi
+  8004f8:	5d                   	pop    %ebp
+  8004f9:	c3                   	ret
+
+008004fa <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8004fa:	55                   	push   %ebp
+  8004fb:	89 e5                	mov    %esp,%ebp
+  8004fd:	57                   	push   %edi
+  8004fe:	56                   	push   %esi
+  8004ff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800500:	be 00 00 00 00       	mov    $0x0,%esi
+  800505:	8b 55 08             	mov    0x8(%ebp),%edx
+  800508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80050b:	b8 16 00 00 00       	mov    $0x16,%eax
+  800510:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800513:	89 f7                	mov    %esi,%edi
+  800515:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  800517:	5b                   	pop    %ebx
+  800518:	5e                   	pop    %esi
+  800519:	5f                   	pop    %edi
+  80051a:	5d                   	pop    %ebp
+  80051b:	c3                   	ret
+
+0080051c <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80051c:	55                   	push   %ebp
+  80051d:	89 e5                	mov    %esp,%ebp
+  80051f:	57                   	push   %edi
+  800520:	56                   	push   %esi
+  800521:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800522:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800532:	89 df                	mov    %ebx,%edi
+  800534:	89 de                	mov    %ebx,%esi
+  800536:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  800538:	5b                   	pop    %ebx
+  800539:	5e                   	pop    %esi
+  80053a:	5f                   	pop    %edi
+  80053b:	5d                   	pop    %ebp
+  80053c:	c3                   	ret
+
+0080053d <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80053d:	55                   	push   %ebp
+  80053e:	89 e5                	mov    %esp,%ebp
+  800540:	57                   	push   %edi
+  800541:	56                   	push   %esi
+  800542:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800543:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800548:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800550:	89 cb                	mov    %ecx,%ebx
+  800552:	89 cf                	mov    %ecx,%edi
+  800554:	89 ce                	mov    %ecx,%esi
+  800556:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  800558:	5b                   	pop    %ebx
+  800559:	5e                   	pop    %esi
+  80055a:	5f                   	pop    %edi
+  80055b:	5d                   	pop    %ebp
+  80055c:	c3                   	ret
+
+0080055d <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80055d:	55                   	push   %ebp
+  80055e:	89 e5                	mov    %esp,%ebp
+  800560:	57                   	push   %edi
+  800561:	56                   	push   %esi
+  800562:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  800563:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  800567:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80056f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800574:	89 df                	mov    %ebx,%edi
+  800576:	89 de                	mov    %ebx,%esi
+  800578:	cd 30                	int    $0x30
+}
+  80057a:	5b                   	pop    %ebx
+  80057b:	5e                   	pop    %esi
+  80057c:	5f                   	pop    %edi
+  80057d:	5d                   	pop    %ebp
+  80057e:	c3                   	ret
+
+0080057f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80057f:	55                   	push   %ebp
+  800580:	89 e5                	mov    %esp,%ebp
+  800582:	57                   	push   %edi
+  800583:	56                   	push   %esi
+  800584:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800585:	be 00 00 00 00       	mov    $0x0,%esi
+  80058a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80058d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800590:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800595:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800598:	89 f7                	mov    %esi,%edi
+  80059a:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80059c:	5b                   	pop    %ebx
+  80059d:	5e                   	pop    %esi
+  80059e:	5f                   	pop    %edi
+  80059f:	5d                   	pop    %ebp
+  8005a0:	c3                   	ret
+
+008005a1 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8005a1:	55                   	push   %ebp
+  8005a2:	89 e5                	mov    %esp,%ebp
+  8005a4:	57                   	push   %edi
+  8005a5:	56                   	push   %esi
+  8005a6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005b2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005ba:	89 f7                	mov    %esi,%edi
+  8005bc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005be:	5b                   	pop    %ebx
+  8005bf:	5e                   	pop    %esi
+  8005c0:	5f                   	pop    %edi
+  8005c1:	5d                   	pop    %ebp
+  8005c2:	c3                   	ret
+
+008005c3 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005c3:	55                   	push   %ebp
+  8005c4:	89 e5                	mov    %esp,%ebp
+  8005c6:	57                   	push   %edi
+  8005c7:	56                   	push   %esi
+  8005c8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005d9:	89 df                	mov    %ebx,%edi
+  8005db:	89 de                	mov    %ebx,%esi
+  8005dd:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005df:	5b                   	pop    %ebx
+  8005e0:	5e                   	pop    %esi
+  8005e1:	5f                   	pop    %edi
+  8005e2:	5d                   	pop    %ebp
+  8005e3:	c3                   	ret
+
+008005e4 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005e4:	55                   	push   %ebp
+  8005e5:	89 e5                	mov    %esp,%ebp
+  8005e7:	57                   	push   %edi
+  8005e8:	56                   	push   %esi
+  8005e9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8005fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005fd:	89 f7                	mov    %esi,%edi
+  8005ff:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  800601:	5b                   	pop    %ebx
+  800602:	5e                   	pop    %esi
+  800603:	5f                   	pop    %edi
+  800604:	5d                   	pop    %ebp
+  800605:	c3                   	ret
+
+00800606 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800606:	55                   	push   %ebp
+  800607:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800609:	8b 45 08             	mov    0x8(%ebp),%eax
+  80060c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800611:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800614:	5d                   	pop    %ebp
+  800615:	c3                   	ret
+
+00800616 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800616:	55                   	push   %ebp
+  800617:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800619:	8b 45 08             	mov    0x8(%ebp),%eax
+  80061c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800621:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800626:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80062b:	5d                   	pop    %ebp
+  80062c:	c3                   	ret
+
+0080062d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80062d:	55                   	push   %ebp
+  80062e:	89 e5                	mov    %esp,%ebp
+  800630:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  800635:	89 c2                	mov    %eax,%edx
+  800637:	c1 ea 16             	shr    $0x16,%edx
+  80063a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800641:	f6 c2 01             	test   $0x1,%dl
+  800644:	74 29                	je     80066f <fd_alloc+0x42>
+  800646:	89 c2                	mov    %eax,%edx
+  800648:	c1 ea 0c             	shr    $0xc,%edx
+  80064b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800652:	f6 c2 01             	test   $0x1,%dl
+  800655:	74 18                	je     80066f <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800657:	05 00 10 00 00       	add    $0x1000,%eax
+  80065c:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  800661:	75 d2                	jne    800635 <fd_alloc+0x8>
+  800663:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800668:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80066d:	eb 05                	jmp    800674 <fd_alloc+0x47>
+			return 0;
+  80066f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800674:	8b 55 08             	mov    0x8(%ebp),%edx
+  800677:	89 02                	mov    %eax,(%edx)
+}
+  800679:	89 c8                	mov    %ecx,%eax
+  80067b:	5d                   	pop    %ebp
+  80067c:	c3                   	ret
+
+0080067d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+  800680:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800683:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800688:	77 30                	ja     8006ba <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80068a:	c1 e0 0c             	shl    $0xc,%eax
+  80068d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  800692:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800698:	f6 c2 01             	test   $0x1,%dl
+  80069b:	74 24                	je     8006c1 <fd_lookup+0x44>
+  80069d:	89 c2                	mov    %eax,%edx
+  80069f:	c1 ea 0c             	shr    $0xc,%edx
+  8006a2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006a9:	f6 c2 01             	test   $0x1,%dl
+  8006ac:	74 1a                	je     8006c8 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006b1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006b8:	5d                   	pop    %ebp
+  8006b9:	c3                   	ret
+		return -E_INVAL;
+  8006ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006bf:	eb f7                	jmp    8006b8 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c6:	eb f0                	jmp    8006b8 <fd_lookup+0x3b>
+  8006c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006cd:	eb e9                	jmp    8006b8 <fd_lookup+0x3b>
+
+008006cf <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006cf:	55                   	push   %ebp
+  8006d0:	89 e5                	mov    %esp,%ebp
+  8006d2:	53                   	push   %ebx
+  8006d3:	83 ec 04             	sub    $0x4,%esp
+  8006d6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006de:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8006e3:	39 13                	cmp    %edx,(%ebx)
+  8006e5:	74 54                	je     80073b <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8006e7:	83 c0 01             	add    $0x1,%eax
+  8006ea:	8b 1c 85 34 3b 80 00 	mov    0x803b34(,%eax,4),%ebx
+  8006f1:	85 db                	test   %ebx,%ebx
+  8006f3:	75 ee                	jne    8006e3 <dev_lookup+0x14>
+  8006f5:	89 e1                	mov    %esp,%ecx
+  8006f7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8006fc:	29 c8                	sub    %ecx,%eax
+  8006fe:	89 c1                	mov    %eax,%ecx
+  800700:	c1 e9 0f             	shr    $0xf,%ecx
+  800703:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070d:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800710:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800717:	8b 40 48             	mov    0x48(%eax),%eax
+  80071a:	83 ec 04             	sub    $0x4,%esp
+  80071d:	52                   	push   %edx
+  80071e:	50                   	push   %eax
+  80071f:	68 b8 3a 80 00       	push   $0x803ab8
+  800724:	e8 90 23 00 00       	call   802ab9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800729:	83 c4 10             	add    $0x10,%esp
+  80072c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800731:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800734:	89 1a                	mov    %ebx,(%edx)
+}
+  800736:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800739:	c9                   	leave
+  80073a:	c3                   	ret
+			return 0;
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	eb ef                	jmp    800731 <dev_lookup+0x62>
+
+00800742 <fd_close>:
+{
+  800742:	55                   	push   %ebp
+  800743:	89 e5                	mov    %esp,%ebp
+  800745:	57                   	push   %edi
+  800746:	56                   	push   %esi
+  800747:	53                   	push   %ebx
+  800748:	83 ec 24             	sub    $0x24,%esp
+  80074b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80074e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800751:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800754:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800755:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80075b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80075e:	50                   	push   %eax
+  80075f:	e8 19 ff ff ff       	call   80067d <fd_lookup>
+  800764:	89 c3                	mov    %eax,%ebx
+  800766:	83 c4 10             	add    $0x10,%esp
+  800769:	85 c0                	test   %eax,%eax
+  80076b:	78 05                	js     800772 <fd_close+0x30>
+	    || fd != fd2)
+  80076d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800770:	74 0f                	je     800781 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  800772:	85 ff                	test   %edi,%edi
+  800774:	0f 44 df             	cmove  %edi,%ebx
+}
+  800777:	89 d8                	mov    %ebx,%eax
+  800779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80077c:	5b                   	pop    %ebx
+  80077d:	5e                   	pop    %esi
+  80077e:	5f                   	pop    %edi
+  80077f:	5d                   	pop    %ebp
+  800780:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800781:	83 ec 08             	sub    $0x8,%esp
+  800784:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800787:	50                   	push   %eax
+  800788:	ff 36                	push   (%esi)
+  80078a:	e8 40 ff ff ff       	call   8006cf <dev_lookup>
+  80078f:	89 c3                	mov    %eax,%ebx
+  800791:	83 c4 10             	add    $0x10,%esp
+  800794:	85 c0                	test   %eax,%eax
+  800796:	78 1a                	js     8007b2 <fd_close+0x70>
+		if (dev->dev_close)
+  800798:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80079b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80079e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007a3:	85 c0                	test   %eax,%eax
+  8007a5:	74 0b                	je     8007b2 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8007a7:	83 ec 0c             	sub    $0xc,%esp
+  8007aa:	56                   	push   %esi
+  8007ab:	ff d0                	call   *%eax
+  8007ad:	89 c3                	mov    %eax,%ebx
+  8007af:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007b2:	83 ec 08             	sub    $0x8,%esp
+  8007b5:	56                   	push   %esi
+  8007b6:	6a 00                	push   $0x0
+  8007b8:	e8 6b fa ff ff       	call   800228 <sys_page_unmap>
+	return r;
+  8007bd:	83 c4 10             	add    $0x10,%esp
+  8007c0:	eb b5                	jmp    800777 <fd_close+0x35>
+
+008007c2 <close>:
+
+int
+close(int fdnum)
+{
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007cb:	50                   	push   %eax
+  8007cc:	ff 75 08             	push   0x8(%ebp)
+  8007cf:	e8 a9 fe ff ff       	call   80067d <fd_lookup>
+  8007d4:	83 c4 10             	add    $0x10,%esp
+  8007d7:	85 c0                	test   %eax,%eax
+  8007d9:	79 02                	jns    8007dd <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+		return fd_close(fd, 1);
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	6a 01                	push   $0x1
+  8007e2:	ff 75 f4             	push   -0xc(%ebp)
+  8007e5:	e8 58 ff ff ff       	call   800742 <fd_close>
+  8007ea:	83 c4 10             	add    $0x10,%esp
+  8007ed:	eb ec                	jmp    8007db <close+0x19>
+
+008007ef <close_all>:
+
+void
+close_all(void)
+{
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	53                   	push   %ebx
+  8007f3:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007fb:	83 ec 0c             	sub    $0xc,%esp
+  8007fe:	53                   	push   %ebx
+  8007ff:	e8 be ff ff ff       	call   8007c2 <close>
+	for (i = 0; i < MAXFD; i++)
+  800804:	83 c3 01             	add    $0x1,%ebx
+  800807:	83 c4 10             	add    $0x10,%esp
+  80080a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800810:	75 e9                	jne    8007fb <close_all+0xc>
+}
+  800812:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800815:	c9                   	leave
+  800816:	c3                   	ret
+
+00800817 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	57                   	push   %edi
+  80081b:	56                   	push   %esi
+  80081c:	53                   	push   %ebx
+  80081d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800820:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800823:	50                   	push   %eax
+  800824:	ff 75 08             	push   0x8(%ebp)
+  800827:	e8 51 fe ff ff       	call   80067d <fd_lookup>
+  80082c:	89 c3                	mov    %eax,%ebx
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	85 c0                	test   %eax,%eax
+  800833:	78 7f                	js     8008b4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800835:	83 ec 0c             	sub    $0xc,%esp
+  800838:	ff 75 0c             	push   0xc(%ebp)
+  80083b:	e8 82 ff ff ff       	call   8007c2 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800840:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800843:	c1 e6 0c             	shl    $0xc,%esi
+  800846:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80084c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80084f:	89 3c 24             	mov    %edi,(%esp)
+  800852:	e8 bf fd ff ff       	call   800616 <fd2data>
+  800857:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800859:	89 34 24             	mov    %esi,(%esp)
+  80085c:	e8 b5 fd ff ff       	call   800616 <fd2data>
+  800861:	83 c4 10             	add    $0x10,%esp
+  800864:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  800867:	89 d8                	mov    %ebx,%eax
+  800869:	c1 e8 16             	shr    $0x16,%eax
+  80086c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800873:	a8 01                	test   $0x1,%al
+  800875:	74 11                	je     800888 <dup+0x71>
+  800877:	89 d8                	mov    %ebx,%eax
+  800879:	c1 e8 0c             	shr    $0xc,%eax
+  80087c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800883:	f6 c2 01             	test   $0x1,%dl
+  800886:	75 36                	jne    8008be <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800888:	89 f8                	mov    %edi,%eax
+  80088a:	c1 e8 0c             	shr    $0xc,%eax
+  80088d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800894:	83 ec 0c             	sub    $0xc,%esp
+  800897:	25 07 0e 00 00       	and    $0xe07,%eax
+  80089c:	50                   	push   %eax
+  80089d:	56                   	push   %esi
+  80089e:	6a 00                	push   $0x0
+  8008a0:	57                   	push   %edi
+  8008a1:	6a 00                	push   $0x0
+  8008a3:	e8 3e f9 ff ff       	call   8001e6 <sys_page_map>
+  8008a8:	89 c3                	mov    %eax,%ebx
+  8008aa:	83 c4 20             	add    $0x20,%esp
+  8008ad:	85 c0                	test   %eax,%eax
+  8008af:	78 33                	js     8008e4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008b4:	89 d8                	mov    %ebx,%eax
+  8008b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b9:	5b                   	pop    %ebx
+  8008ba:	5e                   	pop    %esi
+  8008bb:	5f                   	pop    %edi
+  8008bc:	5d                   	pop    %ebp
+  8008bd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008c5:	83 ec 0c             	sub    $0xc,%esp
+  8008c8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008cd:	50                   	push   %eax
+  8008ce:	ff 75 d4             	push   -0x2c(%ebp)
+  8008d1:	6a 00                	push   $0x0
+  8008d3:	53                   	push   %ebx
+  8008d4:	6a 00                	push   $0x0
+  8008d6:	e8 0b f9 ff ff       	call   8001e6 <sys_page_map>
+  8008db:	89 c3                	mov    %eax,%ebx
+  8008dd:	83 c4 20             	add    $0x20,%esp
+  8008e0:	85 c0                	test   %eax,%eax
+  8008e2:	79 a4                	jns    800888 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008e4:	83 ec 08             	sub    $0x8,%esp
+  8008e7:	56                   	push   %esi
+  8008e8:	6a 00                	push   $0x0
+  8008ea:	e8 39 f9 ff ff       	call   800228 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008ef:	83 c4 08             	add    $0x8,%esp
+  8008f2:	ff 75 d4             	push   -0x2c(%ebp)
+  8008f5:	6a 00                	push   $0x0
+  8008f7:	e8 2c f9 ff ff       	call   800228 <sys_page_unmap>
+	return r;
+  8008fc:	83 c4 10             	add    $0x10,%esp
+  8008ff:	eb b3                	jmp    8008b4 <dup+0x9d>
+
+00800901 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	56                   	push   %esi
+  800905:	53                   	push   %ebx
+  800906:	83 ec 18             	sub    $0x18,%esp
+  800909:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80090c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80090f:	50                   	push   %eax
+  800910:	53                   	push   %ebx
+  800911:	e8 67 fd ff ff       	call   80067d <fd_lookup>
+  800916:	83 c4 10             	add    $0x10,%esp
+  800919:	85 c0                	test   %eax,%eax
+  80091b:	78 3c                	js     800959 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80091d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800920:	83 ec 08             	sub    $0x8,%esp
+  800923:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800926:	50                   	push   %eax
+  800927:	ff 36                	push   (%esi)
+  800929:	e8 a1 fd ff ff       	call   8006cf <dev_lookup>
+  80092e:	83 c4 10             	add    $0x10,%esp
+  800931:	85 c0                	test   %eax,%eax
+  800933:	78 24                	js     800959 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800935:	8b 46 08             	mov    0x8(%esi),%eax
+  800938:	83 e0 03             	and    $0x3,%eax
+  80093b:	83 f8 01             	cmp    $0x1,%eax
+  80093e:	74 20                	je     800960 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800940:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800943:	8b 40 08             	mov    0x8(%eax),%eax
+  800946:	85 c0                	test   %eax,%eax
+  800948:	74 54                	je     80099e <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80094a:	83 ec 04             	sub    $0x4,%esp
+  80094d:	ff 75 10             	push   0x10(%ebp)
+  800950:	ff 75 0c             	push   0xc(%ebp)
+  800953:	56                   	push   %esi
+  800954:	ff d0                	call   *%eax
+  800956:	83 c4 10             	add    $0x10,%esp
+}
+  800959:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80095c:	5b                   	pop    %ebx
+  80095d:	5e                   	pop    %esi
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+  800960:	89 e2                	mov    %esp,%edx
+  800962:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800967:	29 d0                	sub    %edx,%eax
+  800969:	89 c2                	mov    %eax,%edx
+  80096b:	c1 ea 0f             	shr    $0xf,%edx
+  80096e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800973:	b8 00 00 00 00       	mov    $0x0,%eax
+  800978:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80097b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800982:	8b 40 48             	mov    0x48(%eax),%eax
+  800985:	83 ec 04             	sub    $0x4,%esp
+  800988:	53                   	push   %ebx
+  800989:	50                   	push   %eax
+  80098a:	68 f9 3a 80 00       	push   $0x803af9
+  80098f:	e8 25 21 00 00       	call   802ab9 <cprintf>
+		return -E_INVAL;
+  800994:	83 c4 10             	add    $0x10,%esp
+  800997:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099c:	eb bb                	jmp    800959 <read+0x58>
+		return -E_NOT_SUPP;
+  80099e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009a3:	eb b4                	jmp    800959 <read+0x58>
+
+008009a5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	57                   	push   %edi
+  8009a9:	56                   	push   %esi
+  8009aa:	53                   	push   %ebx
+  8009ab:	83 ec 0c             	sub    $0xc,%esp
+  8009ae:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009b4:	85 f6                	test   %esi,%esi
+  8009b6:	74 30                	je     8009e8 <readn+0x43>
+  8009b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009bd:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009c2:	83 ec 04             	sub    $0x4,%esp
+  8009c5:	89 f2                	mov    %esi,%edx
+  8009c7:	29 c2                	sub    %eax,%edx
+  8009c9:	52                   	push   %edx
+  8009ca:	01 f8                	add    %edi,%eax
+  8009cc:	50                   	push   %eax
+  8009cd:	ff 75 08             	push   0x8(%ebp)
+  8009d0:	e8 2c ff ff ff       	call   800901 <read>
+		if (m < 0)
+  8009d5:	83 c4 10             	add    $0x10,%esp
+  8009d8:	85 c0                	test   %eax,%eax
+  8009da:	78 15                	js     8009f1 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8009dc:	74 11                	je     8009ef <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8009de:	01 c3                	add    %eax,%ebx
+  8009e0:	89 d8                	mov    %ebx,%eax
+  8009e2:	39 f3                	cmp    %esi,%ebx
+  8009e4:	72 dc                	jb     8009c2 <readn+0x1d>
+  8009e6:	eb 09                	jmp    8009f1 <readn+0x4c>
+  8009e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ed:	eb 02                	jmp    8009f1 <readn+0x4c>
+  8009ef:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8009f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009f4:	5b                   	pop    %ebx
+  8009f5:	5e                   	pop    %esi
+  8009f6:	5f                   	pop    %edi
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	c3                   	ret
+
+008009f9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	56                   	push   %esi
+  8009fd:	53                   	push   %ebx
+  8009fe:	83 ec 18             	sub    $0x18,%esp
+  800a01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a04:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a07:	50                   	push   %eax
+  800a08:	53                   	push   %ebx
+  800a09:	e8 6f fc ff ff       	call   80067d <fd_lookup>
+  800a0e:	83 c4 10             	add    $0x10,%esp
+  800a11:	85 c0                	test   %eax,%eax
+  800a13:	78 37                	js     800a4c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a15:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a18:	83 ec 08             	sub    $0x8,%esp
+  800a1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a1e:	50                   	push   %eax
+  800a1f:	ff 36                	push   (%esi)
+  800a21:	e8 a9 fc ff ff       	call   8006cf <dev_lookup>
+  800a26:	83 c4 10             	add    $0x10,%esp
+  800a29:	85 c0                	test   %eax,%eax
+  800a2b:	78 1f                	js     800a4c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a2d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a31:	74 20                	je     800a53 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a36:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a39:	85 c0                	test   %eax,%eax
+  800a3b:	74 54                	je     800a91 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a3d:	83 ec 04             	sub    $0x4,%esp
+  800a40:	ff 75 10             	push   0x10(%ebp)
+  800a43:	ff 75 0c             	push   0xc(%ebp)
+  800a46:	56                   	push   %esi
+  800a47:	ff d0                	call   *%eax
+  800a49:	83 c4 10             	add    $0x10,%esp
+}
+  800a4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a4f:	5b                   	pop    %ebx
+  800a50:	5e                   	pop    %esi
+  800a51:	5d                   	pop    %ebp
+  800a52:	c3                   	ret
+  800a53:	89 e2                	mov    %esp,%edx
+  800a55:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a5a:	29 d0                	sub    %edx,%eax
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	c1 ea 0f             	shr    $0xf,%edx
+  800a61:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6b:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a6e:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a75:	8b 40 48             	mov    0x48(%eax),%eax
+  800a78:	83 ec 04             	sub    $0x4,%esp
+  800a7b:	53                   	push   %ebx
+  800a7c:	50                   	push   %eax
+  800a7d:	68 15 3b 80 00       	push   $0x803b15
+  800a82:	e8 32 20 00 00       	call   802ab9 <cprintf>
+		return -E_INVAL;
+  800a87:	83 c4 10             	add    $0x10,%esp
+  800a8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a8f:	eb bb                	jmp    800a4c <write+0x53>
+		return -E_NOT_SUPP;
+  800a91:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a96:	eb b4                	jmp    800a4c <write+0x53>
+
+00800a98 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aa1:	50                   	push   %eax
+  800aa2:	ff 75 08             	push   0x8(%ebp)
+  800aa5:	e8 d3 fb ff ff       	call   80067d <fd_lookup>
+  800aaa:	83 c4 10             	add    $0x10,%esp
+  800aad:	85 c0                	test   %eax,%eax
+  800aaf:	78 0e                	js     800abf <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800ab1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ab7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800aba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800abf:	c9                   	leave
+  800ac0:	c3                   	ret
+
+00800ac1 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	53                   	push   %ebx
+  800ac5:	83 ec 1c             	sub    $0x1c,%esp
+  800ac8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800acb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ace:	50                   	push   %eax
+  800acf:	ff 75 08             	push   0x8(%ebp)
+  800ad2:	e8 a6 fb ff ff       	call   80067d <fd_lookup>
+  800ad7:	83 c4 10             	add    $0x10,%esp
+  800ada:	85 c0                	test   %eax,%eax
+  800adc:	78 33                	js     800b11 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800ade:	83 fb 03             	cmp    $0x3,%ebx
+  800ae1:	74 28                	je     800b0b <fcntl+0x4a>
+  800ae3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae8:	83 fb 04             	cmp    $0x4,%ebx
+  800aeb:	75 24                	jne    800b11 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800aed:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800af0:	8b 41 08             	mov    0x8(%ecx),%eax
+  800af3:	80 e4 ef             	and    $0xef,%ah
+  800af6:	8b 55 10             	mov    0x10(%ebp),%edx
+  800af9:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800aff:	09 d0                	or     %edx,%eax
+  800b01:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800b04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b09:	eb 06                	jmp    800b11 <fcntl+0x50>
+		return fd->fd_omode;
+  800b0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0e:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b14:	c9                   	leave
+  800b15:	c3                   	ret
+
+00800b16 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	56                   	push   %esi
+  800b1a:	53                   	push   %ebx
+  800b1b:	83 ec 18             	sub    $0x18,%esp
+  800b1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b21:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b24:	50                   	push   %eax
+  800b25:	53                   	push   %ebx
+  800b26:	e8 52 fb ff ff       	call   80067d <fd_lookup>
+  800b2b:	83 c4 10             	add    $0x10,%esp
+  800b2e:	85 c0                	test   %eax,%eax
+  800b30:	78 34                	js     800b66 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b32:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b35:	83 ec 08             	sub    $0x8,%esp
+  800b38:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b3b:	50                   	push   %eax
+  800b3c:	ff 36                	push   (%esi)
+  800b3e:	e8 8c fb ff ff       	call   8006cf <dev_lookup>
+  800b43:	83 c4 10             	add    $0x10,%esp
+  800b46:	85 c0                	test   %eax,%eax
+  800b48:	78 1c                	js     800b66 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b4a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b4e:	74 1d                	je     800b6d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b53:	8b 40 18             	mov    0x18(%eax),%eax
+  800b56:	85 c0                	test   %eax,%eax
+  800b58:	74 51                	je     800bab <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b5a:	83 ec 08             	sub    $0x8,%esp
+  800b5d:	ff 75 0c             	push   0xc(%ebp)
+  800b60:	56                   	push   %esi
+  800b61:	ff d0                	call   *%eax
+  800b63:	83 c4 10             	add    $0x10,%esp
+}
+  800b66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b69:	5b                   	pop    %ebx
+  800b6a:	5e                   	pop    %esi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+  800b6d:	89 e2                	mov    %esp,%edx
+  800b6f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b74:	29 d0                	sub    %edx,%eax
+  800b76:	89 c2                	mov    %eax,%edx
+  800b78:	c1 ea 0f             	shr    $0xf,%edx
+  800b7b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b85:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800b88:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800b8f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b92:	83 ec 04             	sub    $0x4,%esp
+  800b95:	53                   	push   %ebx
+  800b96:	50                   	push   %eax
+  800b97:	68 d8 3a 80 00       	push   $0x803ad8
+  800b9c:	e8 18 1f 00 00       	call   802ab9 <cprintf>
+		return -E_INVAL;
+  800ba1:	83 c4 10             	add    $0x10,%esp
+  800ba4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba9:	eb bb                	jmp    800b66 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bb0:	eb b4                	jmp    800b66 <ftruncate+0x50>
+
+00800bb2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	56                   	push   %esi
+  800bb6:	53                   	push   %ebx
+  800bb7:	83 ec 18             	sub    $0x18,%esp
+  800bba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bbd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bc0:	50                   	push   %eax
+  800bc1:	ff 75 08             	push   0x8(%ebp)
+  800bc4:	e8 b4 fa ff ff       	call   80067d <fd_lookup>
+  800bc9:	83 c4 10             	add    $0x10,%esp
+  800bcc:	85 c0                	test   %eax,%eax
+  800bce:	78 53                	js     800c23 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bd0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bd3:	83 ec 08             	sub    $0x8,%esp
+  800bd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bd9:	50                   	push   %eax
+  800bda:	ff 36                	push   (%esi)
+  800bdc:	e8 ee fa ff ff       	call   8006cf <dev_lookup>
+  800be1:	83 c4 10             	add    $0x10,%esp
+  800be4:	85 c0                	test   %eax,%eax
+  800be6:	78 3b                	js     800c23 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800be8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800beb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bef:	74 39                	je     800c2a <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800bf1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800bf4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bfb:	00 00 00 
+	stat->st_isdir = 0;
+  800bfe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c05:	00 00 00 
+	stat->st_version = 0;
+  800c08:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c0f:	00 00 00 
+	stat->st_dev = dev;
+  800c12:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c18:	83 ec 08             	sub    $0x8,%esp
+  800c1b:	53                   	push   %ebx
+  800c1c:	56                   	push   %esi
+  800c1d:	ff 50 14             	call   *0x14(%eax)
+  800c20:	83 c4 10             	add    $0x10,%esp
+}
+  800c23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c26:	5b                   	pop    %ebx
+  800c27:	5e                   	pop    %esi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c2a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c2f:	eb f2                	jmp    800c23 <fstat+0x71>
+
+00800c31 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c36:	83 ec 08             	sub    $0x8,%esp
+  800c39:	6a 00                	push   $0x0
+  800c3b:	ff 75 08             	push   0x8(%ebp)
+  800c3e:	e8 b7 01 00 00       	call   800dfa <open>
+  800c43:	89 c3                	mov    %eax,%ebx
+  800c45:	83 c4 10             	add    $0x10,%esp
+  800c48:	85 c0                	test   %eax,%eax
+  800c4a:	78 1b                	js     800c67 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c4c:	83 ec 08             	sub    $0x8,%esp
+  800c4f:	ff 75 0c             	push   0xc(%ebp)
+  800c52:	50                   	push   %eax
+  800c53:	e8 5a ff ff ff       	call   800bb2 <fstat>
+  800c58:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c5a:	89 1c 24             	mov    %ebx,(%esp)
+  800c5d:	e8 60 fb ff ff       	call   8007c2 <close>
+	return r;
+  800c62:	83 c4 10             	add    $0x10,%esp
+  800c65:	89 f3                	mov    %esi,%ebx
+}
+  800c67:	89 d8                	mov    %ebx,%eax
+  800c69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c6c:	5b                   	pop    %ebx
+  800c6d:	5e                   	pop    %esi
+  800c6e:	5d                   	pop    %ebp
+  800c6f:	c3                   	ret
+
+00800c70 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	56                   	push   %esi
+  800c74:	53                   	push   %ebx
+  800c75:	89 c6                	mov    %eax,%esi
+  800c77:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800c79:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800c80:	74 27                	je     800ca9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800c82:	6a 07                	push   $0x7
+  800c84:	68 00 60 80 00       	push   $0x806000
+  800c89:	56                   	push   %esi
+  800c8a:	ff 35 00 50 80 00    	push   0x805000
+  800c90:	e8 23 2b 00 00       	call   8037b8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800c95:	83 c4 0c             	add    $0xc,%esp
+  800c98:	6a 00                	push   $0x0
+  800c9a:	53                   	push   %ebx
+  800c9b:	6a 00                	push   $0x0
+  800c9d:	e8 86 28 00 00       	call   803528 <ipc_recv>
+}
+  800ca2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca5:	5b                   	pop    %ebx
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ca9:	83 ec 0c             	sub    $0xc,%esp
+  800cac:	6a 02                	push   $0x2
+  800cae:	e8 6e 2b 00 00       	call   803821 <ipc_find_env>
+  800cb3:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cb8:	83 c4 10             	add    $0x10,%esp
+  800cbb:	eb c5                	jmp    800c82 <fsipc+0x12>
+
+00800cbd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cc9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cd1:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800cd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cdb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ce0:	e8 8b ff ff ff       	call   800c70 <fsipc>
+}
+  800ce5:	c9                   	leave
+  800ce6:	c3                   	ret
+
+00800ce7 <devfile_flush>:
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf0:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cf3:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800cf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cfd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d02:	e8 69 ff ff ff       	call   800c70 <fsipc>
+}
+  800d07:	c9                   	leave
+  800d08:	c3                   	ret
+
+00800d09 <devfile_stat>:
+{
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	53                   	push   %ebx
+  800d0d:	83 ec 04             	sub    $0x4,%esp
+  800d10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d16:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d19:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d23:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d28:	e8 43 ff ff ff       	call   800c70 <fsipc>
+  800d2d:	85 c0                	test   %eax,%eax
+  800d2f:	78 37                	js     800d68 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d31:	83 ec 08             	sub    $0x8,%esp
+  800d34:	68 00 60 80 00       	push   $0x806000
+  800d39:	53                   	push   %ebx
+  800d3a:	e8 71 24 00 00       	call   8031b0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d3f:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d44:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d4a:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d4f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d55:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d5a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d60:	83 c4 10             	add    $0x10,%esp
+  800d63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d6b:	c9                   	leave
+  800d6c:	c3                   	ret
+
+00800d6d <devfile_write>:
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	83 ec 0c             	sub    $0xc,%esp
+  800d73:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d76:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800d7b:	39 d0                	cmp    %edx,%eax
+  800d7d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d83:	8b 52 0c             	mov    0xc(%edx),%edx
+  800d86:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800d8c:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800d91:	50                   	push   %eax
+  800d92:	ff 75 0c             	push   0xc(%ebp)
+  800d95:	68 08 60 80 00       	push   $0x806008
+  800d9a:	e8 c1 25 00 00       	call   803360 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da9:	e8 c2 fe ff ff       	call   800c70 <fsipc>
+}
+  800dae:	c9                   	leave
+  800daf:	c3                   	ret
+
+00800db0 <devfile_read>:
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	53                   	push   %ebx
+  800db4:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dba:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dbd:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800dc2:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dc5:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800dca:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800dcf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd4:	e8 97 fe ff ff       	call   800c70 <fsipc>
+  800dd9:	89 c3                	mov    %eax,%ebx
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	78 14                	js     800df3 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800ddf:	83 ec 04             	sub    $0x4,%esp
+  800de2:	50                   	push   %eax
+  800de3:	68 00 60 80 00       	push   $0x806000
+  800de8:	ff 75 0c             	push   0xc(%ebp)
+  800deb:	e8 70 25 00 00       	call   803360 <memmove>
+	return r;
+  800df0:	83 c4 10             	add    $0x10,%esp
+}
+  800df3:	89 d8                	mov    %ebx,%eax
+  800df5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800df8:	c9                   	leave
+  800df9:	c3                   	ret
+
+00800dfa <open>:
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	53                   	push   %ebx
+  800dfe:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800e01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e04:	50                   	push   %eax
+  800e05:	e8 23 f8 ff ff       	call   80062d <fd_alloc>
+  800e0a:	89 c3                	mov    %eax,%ebx
+  800e0c:	83 c4 10             	add    $0x10,%esp
+  800e0f:	85 c0                	test   %eax,%eax
+  800e11:	78 2a                	js     800e3d <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e13:	83 ec 0c             	sub    $0xc,%esp
+  800e16:	ff 75 08             	push   0x8(%ebp)
+  800e19:	e8 46 23 00 00       	call   803164 <strlen>
+  800e1e:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e21:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e26:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e2b:	7e 17                	jle    800e44 <open+0x4a>
+	fd_close(fd, 1);
+  800e2d:	83 ec 08             	sub    $0x8,%esp
+  800e30:	6a 01                	push   $0x1
+  800e32:	ff 75 f4             	push   -0xc(%ebp)
+  800e35:	e8 08 f9 ff ff       	call   800742 <fd_close>
+	return r;
+  800e3a:	83 c4 10             	add    $0x10,%esp
+}
+  800e3d:	89 d8                	mov    %ebx,%eax
+  800e3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e42:	c9                   	leave
+  800e43:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e44:	83 ec 08             	sub    $0x8,%esp
+  800e47:	ff 75 08             	push   0x8(%ebp)
+  800e4a:	68 00 60 80 00       	push   $0x806000
+  800e4f:	e8 5c 23 00 00       	call   8031b0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e57:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e5c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e64:	e8 07 fe ff ff       	call   800c70 <fsipc>
+  800e69:	89 c3                	mov    %eax,%ebx
+  800e6b:	83 c4 10             	add    $0x10,%esp
+  800e6e:	85 c0                	test   %eax,%eax
+  800e70:	78 bb                	js     800e2d <open+0x33>
+	return fd2num(fd); 	
+  800e72:	83 ec 0c             	sub    $0xc,%esp
+  800e75:	ff 75 f4             	push   -0xc(%ebp)
+  800e78:	e8 89 f7 ff ff       	call   800606 <fd2num>
+  800e7d:	89 c3                	mov    %eax,%ebx
+  800e7f:	83 c4 10             	add    $0x10,%esp
+  800e82:	eb b9                	jmp    800e3d <open+0x43>
+
+00800e84 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800e84:	55                   	push   %ebp
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	53                   	push   %ebx
+  800e88:	83 ec 1c             	sub    $0x1c,%esp
+  800e8b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e91:	50                   	push   %eax
+  800e92:	ff 75 08             	push   0x8(%ebp)
+  800e95:	e8 e3 f7 ff ff       	call   80067d <fd_lookup>
+  800e9a:	83 c4 10             	add    $0x10,%esp
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	78 5a                	js     800efb <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800ea1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea4:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800eaa:	39 10                	cmp    %edx,(%eax)
+  800eac:	75 66                	jne    800f14 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800eae:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800eb5:	74 49                	je     800f00 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800eb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eba:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ebd:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800ec2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ec5:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800eca:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ed0:	6a 07                	push   $0x7
+  800ed2:	68 00 60 80 00       	push   $0x806000
+  800ed7:	6a 09                	push   $0x9
+  800ed9:	ff 35 00 50 80 00    	push   0x805000
+  800edf:	e8 d4 28 00 00       	call   8037b8 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800ee4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800eeb:	6a 00                	push   $0x0
+  800eed:	53                   	push   %ebx
+  800eee:	ff 75 10             	push   0x10(%ebp)
+  800ef1:	6a 00                	push   $0x0
+  800ef3:	e8 fd 26 00 00       	call   8035f5 <ipc_recv_pages>
+  800ef8:	83 c4 20             	add    $0x20,%esp
+}
+  800efb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800efe:	c9                   	leave
+  800eff:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	6a 02                	push   $0x2
+  800f05:	e8 17 29 00 00       	call   803821 <ipc_find_env>
+  800f0a:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f0f:	83 c4 10             	add    $0x10,%esp
+  800f12:	eb a3                	jmp    800eb7 <fmap+0x33>
+		return -E_INVAL;
+  800f14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f19:	eb e0                	jmp    800efb <fmap+0x77>
+
+00800f1b <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 10             	sub    $0x10,%esp
+  800f22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f25:	53                   	push   %ebx
+  800f26:	e8 39 22 00 00       	call   803164 <strlen>
+  800f2b:	83 c4 10             	add    $0x10,%esp
+  800f2e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f33:	7f 25                	jg     800f5a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f35:	83 ec 08             	sub    $0x8,%esp
+  800f38:	53                   	push   %ebx
+  800f39:	68 00 60 80 00       	push   $0x806000
+  800f3e:	e8 6d 22 00 00       	call   8031b0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f48:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f4d:	e8 1e fd ff ff       	call   800c70 <fsipc>
+  800f52:	83 c4 10             	add    $0x10,%esp
+}
+  800f55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f58:	c9                   	leave
+  800f59:	c3                   	ret
+		return -E_BAD_PATH;
+  800f5a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f5f:	eb f4                	jmp    800f55 <remove+0x3a>
+
+00800f61 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f71:	e8 fa fc ff ff       	call   800c70 <fsipc>
+}
+  800f76:	c9                   	leave
+  800f77:	c3                   	ret
+
+00800f78 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800f7e:	68 48 3b 80 00       	push   $0x803b48
+  800f83:	ff 75 0c             	push   0xc(%ebp)
+  800f86:	e8 25 22 00 00       	call   8031b0 <strcpy>
+	return 0;
+}
+  800f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f90:	c9                   	leave
+  800f91:	c3                   	ret
+
+00800f92 <devsock_close>:
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	53                   	push   %ebx
+  800f96:	83 ec 10             	sub    $0x10,%esp
+  800f99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800f9c:	53                   	push   %ebx
+  800f9d:	e8 be 28 00 00       	call   803860 <pageref>
+  800fa2:	89 c2                	mov    %eax,%edx
+  800fa4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fac:	83 fa 01             	cmp    $0x1,%edx
+  800faf:	74 05                	je     800fb6 <devsock_close+0x24>
+}
+  800fb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fb4:	c9                   	leave
+  800fb5:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+  800fb9:	ff 73 0c             	push   0xc(%ebx)
+  800fbc:	e8 b0 05 00 00       	call   801571 <nsipc_close>
+  800fc1:	83 c4 10             	add    $0x10,%esp
+  800fc4:	eb eb                	jmp    800fb1 <devsock_close+0x1f>
+
+00800fc6 <devsock_write>:
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	53                   	push   %ebx
+  800fca:	83 ec 14             	sub    $0x14,%esp
+  800fcd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fd0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fd3:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800fd6:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  800fd9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  800fdc:	8b 41 08             	mov    0x8(%ecx),%eax
+  800fdf:	c1 f8 09             	sar    $0x9,%eax
+  800fe2:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  800fe5:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  800feb:	77 13                	ja     801000 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  800fed:	50                   	push   %eax
+  800fee:	52                   	push   %edx
+  800fef:	53                   	push   %ebx
+  800ff0:	ff 71 0c             	push   0xc(%ecx)
+  800ff3:	e8 5c 06 00 00       	call   801654 <nsipc_send>
+  800ff8:	83 c4 10             	add    $0x10,%esp
+}
+  800ffb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ffe:	c9                   	leave
+  800fff:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801000:	50                   	push   %eax
+  801001:	6a 01                	push   $0x1
+  801003:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801006:	50                   	push   %eax
+  801007:	ff 71 0c             	push   0xc(%ecx)
+  80100a:	e8 a6 06 00 00       	call   8016b5 <nsipc_sendmsg>
+  80100f:	83 c4 10             	add    $0x10,%esp
+  801012:	eb e7                	jmp    800ffb <devsock_write+0x35>
+
+00801014 <devsock_read>:
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	53                   	push   %ebx
+  801018:	83 ec 14             	sub    $0x14,%esp
+  80101b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80101e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801021:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801024:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801027:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80102a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80102d:	c1 f8 09             	sar    $0x9,%eax
+  801030:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801033:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801039:	77 13                	ja     80104e <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80103b:	50                   	push   %eax
+  80103c:	52                   	push   %edx
+  80103d:	53                   	push   %ebx
+  80103e:	ff 71 0c             	push   0xc(%ecx)
+  801041:	e8 9c 05 00 00       	call   8015e2 <nsipc_recv>
+  801046:	83 c4 10             	add    $0x10,%esp
+}
+  801049:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80104c:	c9                   	leave
+  80104d:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80104e:	50                   	push   %eax
+  80104f:	6a 01                	push   $0x1
+  801051:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801054:	50                   	push   %eax
+  801055:	ff 71 0c             	push   0xc(%ecx)
+  801058:	e8 02 0a 00 00       	call   801a5f <nsipc_recvmsg>
+  80105d:	83 c4 10             	add    $0x10,%esp
+  801060:	eb e7                	jmp    801049 <devsock_read+0x35>
+
+00801062 <fd2sockid>:
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801068:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80106b:	52                   	push   %edx
+  80106c:	50                   	push   %eax
+  80106d:	e8 0b f6 ff ff       	call   80067d <fd_lookup>
+  801072:	83 c4 10             	add    $0x10,%esp
+  801075:	85 c0                	test   %eax,%eax
+  801077:	78 10                	js     801089 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801079:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80107c:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801082:	39 08                	cmp    %ecx,(%eax)
+  801084:	75 05                	jne    80108b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801086:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801089:	c9                   	leave
+  80108a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80108b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801090:	eb f7                	jmp    801089 <fd2sockid+0x27>
+
+00801092 <sock_flags>:
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801098:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80109b:	52                   	push   %edx
+  80109c:	50                   	push   %eax
+  80109d:	e8 db f5 ff ff       	call   80067d <fd_lookup>
+  8010a2:	83 c4 10             	add    $0x10,%esp
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	78 0e                	js     8010b7 <sock_flags+0x25>
+  8010a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010ac:	8b 40 08             	mov    0x8(%eax),%eax
+  8010af:	c1 e8 09             	shr    $0x9,%eax
+  8010b2:	83 e0 08             	and    $0x8,%eax
+}
+  8010b5:	c9                   	leave
+  8010b6:	c3                   	ret
+		return 0;
+  8010b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010bc:	eb f7                	jmp    8010b5 <sock_flags+0x23>
+
+008010be <alloc_sockfd>:
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	56                   	push   %esi
+  8010c2:	53                   	push   %ebx
+  8010c3:	83 ec 1c             	sub    $0x1c,%esp
+  8010c6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010cb:	50                   	push   %eax
+  8010cc:	e8 5c f5 ff ff       	call   80062d <fd_alloc>
+  8010d1:	89 c3                	mov    %eax,%ebx
+  8010d3:	83 c4 10             	add    $0x10,%esp
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	78 43                	js     80111d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010da:	83 ec 04             	sub    $0x4,%esp
+  8010dd:	68 07 04 00 00       	push   $0x407
+  8010e2:	ff 75 f4             	push   -0xc(%ebp)
+  8010e5:	6a 00                	push   $0x0
+  8010e7:	e8 b7 f0 ff ff       	call   8001a3 <sys_page_alloc>
+  8010ec:	89 c3                	mov    %eax,%ebx
+  8010ee:	83 c4 10             	add    $0x10,%esp
+  8010f1:	85 c0                	test   %eax,%eax
+  8010f3:	78 28                	js     80111d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8010f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010f8:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8010fe:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801100:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801103:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80110a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+  801110:	50                   	push   %eax
+  801111:	e8 f0 f4 ff ff       	call   800606 <fd2num>
+  801116:	89 c3                	mov    %eax,%ebx
+  801118:	83 c4 10             	add    $0x10,%esp
+  80111b:	eb 0c                	jmp    801129 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+  801120:	56                   	push   %esi
+  801121:	e8 4b 04 00 00       	call   801571 <nsipc_close>
+		return r;
+  801126:	83 c4 10             	add    $0x10,%esp
+}
+  801129:	89 d8                	mov    %ebx,%eax
+  80112b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80112e:	5b                   	pop    %ebx
+  80112f:	5e                   	pop    %esi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+
+00801132 <accept>:
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	56                   	push   %esi
+  801136:	53                   	push   %ebx
+  801137:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80113a:	89 f0                	mov    %esi,%eax
+  80113c:	e8 21 ff ff ff       	call   801062 <fd2sockid>
+  801141:	89 c3                	mov    %eax,%ebx
+  801143:	85 c0                	test   %eax,%eax
+  801145:	78 24                	js     80116b <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801147:	89 f0                	mov    %esi,%eax
+  801149:	e8 44 ff ff ff       	call   801092 <sock_flags>
+  80114e:	50                   	push   %eax
+  80114f:	ff 75 10             	push   0x10(%ebp)
+  801152:	ff 75 0c             	push   0xc(%ebp)
+  801155:	53                   	push   %ebx
+  801156:	e8 6b 03 00 00       	call   8014c6 <nsipc_accept>
+  80115b:	89 c3                	mov    %eax,%ebx
+  80115d:	83 c4 10             	add    $0x10,%esp
+  801160:	85 c0                	test   %eax,%eax
+  801162:	78 07                	js     80116b <accept+0x39>
+	return alloc_sockfd(r);
+  801164:	e8 55 ff ff ff       	call   8010be <alloc_sockfd>
+  801169:	89 c3                	mov    %eax,%ebx
+}
+  80116b:	89 d8                	mov    %ebx,%eax
+  80116d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801170:	5b                   	pop    %ebx
+  801171:	5e                   	pop    %esi
+  801172:	5d                   	pop    %ebp
+  801173:	c3                   	ret
+
+00801174 <bind>:
+{
+  801174:	55                   	push   %ebp
+  801175:	89 e5                	mov    %esp,%ebp
+  801177:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80117a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80117d:	e8 e0 fe ff ff       	call   801062 <fd2sockid>
+  801182:	85 c0                	test   %eax,%eax
+  801184:	78 12                	js     801198 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801186:	83 ec 04             	sub    $0x4,%esp
+  801189:	ff 75 10             	push   0x10(%ebp)
+  80118c:	ff 75 0c             	push   0xc(%ebp)
+  80118f:	50                   	push   %eax
+  801190:	e8 85 03 00 00       	call   80151a <nsipc_bind>
+  801195:	83 c4 10             	add    $0x10,%esp
+}
+  801198:	c9                   	leave
+  801199:	c3                   	ret
+
+0080119a <shutdown>:
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011a3:	e8 ba fe ff ff       	call   801062 <fd2sockid>
+  8011a8:	85 c0                	test   %eax,%eax
+  8011aa:	78 0f                	js     8011bb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011ac:	83 ec 08             	sub    $0x8,%esp
+  8011af:	ff 75 0c             	push   0xc(%ebp)
+  8011b2:	50                   	push   %eax
+  8011b3:	e8 97 03 00 00       	call   80154f <nsipc_shutdown>
+  8011b8:	83 c4 10             	add    $0x10,%esp
+}
+  8011bb:	c9                   	leave
+  8011bc:	c3                   	ret
+
+008011bd <connect>:
+{
+  8011bd:	55                   	push   %ebp
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c6:	e8 97 fe ff ff       	call   801062 <fd2sockid>
+  8011cb:	85 c0                	test   %eax,%eax
+  8011cd:	78 12                	js     8011e1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011cf:	83 ec 04             	sub    $0x4,%esp
+  8011d2:	ff 75 10             	push   0x10(%ebp)
+  8011d5:	ff 75 0c             	push   0xc(%ebp)
+  8011d8:	50                   	push   %eax
+  8011d9:	e8 ad 03 00 00       	call   80158b <nsipc_connect>
+  8011de:	83 c4 10             	add    $0x10,%esp
+}
+  8011e1:	c9                   	leave
+  8011e2:	c3                   	ret
+
+008011e3 <listen>:
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ec:	e8 71 fe ff ff       	call   801062 <fd2sockid>
+  8011f1:	85 c0                	test   %eax,%eax
+  8011f3:	78 0f                	js     801204 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8011f5:	83 ec 08             	sub    $0x8,%esp
+  8011f8:	ff 75 0c             	push   0xc(%ebp)
+  8011fb:	50                   	push   %eax
+  8011fc:	e8 bf 03 00 00       	call   8015c0 <nsipc_listen>
+  801201:	83 c4 10             	add    $0x10,%esp
+}
+  801204:	c9                   	leave
+  801205:	c3                   	ret
+
+00801206 <sendmsg>:
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+  80120c:	83 ec 0c             	sub    $0xc,%esp
+  80120f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801212:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801215:	89 f0                	mov    %esi,%eax
+  801217:	e8 46 fe ff ff       	call   801062 <fd2sockid>
+  80121c:	89 c3                	mov    %eax,%ebx
+  80121e:	85 c0                	test   %eax,%eax
+  801220:	78 1c                	js     80123e <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801222:	89 f0                	mov    %esi,%eax
+  801224:	e8 69 fe ff ff       	call   801092 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801229:	0b 45 10             	or     0x10(%ebp),%eax
+  80122c:	50                   	push   %eax
+  80122d:	ff 77 0c             	push   0xc(%edi)
+  801230:	ff 77 08             	push   0x8(%edi)
+  801233:	53                   	push   %ebx
+  801234:	e8 7c 04 00 00       	call   8016b5 <nsipc_sendmsg>
+  801239:	89 c3                	mov    %eax,%ebx
+  80123b:	83 c4 10             	add    $0x10,%esp
+}
+  80123e:	89 d8                	mov    %ebx,%eax
+  801240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+
+00801248 <recvmsg>:
+{
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	57                   	push   %edi
+  80124c:	56                   	push   %esi
+  80124d:	53                   	push   %ebx
+  80124e:	83 ec 0c             	sub    $0xc,%esp
+  801251:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801254:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801257:	89 f8                	mov    %edi,%eax
+  801259:	e8 04 fe ff ff       	call   801062 <fd2sockid>
+  80125e:	89 c3                	mov    %eax,%ebx
+  801260:	85 c0                	test   %eax,%eax
+  801262:	78 2a                	js     80128e <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801264:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80126b:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801272:	89 f8                	mov    %edi,%eax
+  801274:	e8 19 fe ff ff       	call   801092 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801279:	0b 45 10             	or     0x10(%ebp),%eax
+  80127c:	50                   	push   %eax
+  80127d:	ff 76 0c             	push   0xc(%esi)
+  801280:	ff 76 08             	push   0x8(%esi)
+  801283:	53                   	push   %ebx
+  801284:	e8 d6 07 00 00       	call   801a5f <nsipc_recvmsg>
+  801289:	89 c3                	mov    %eax,%ebx
+  80128b:	83 c4 10             	add    $0x10,%esp
+}
+  80128e:	89 d8                	mov    %ebx,%eax
+  801290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801293:	5b                   	pop    %ebx
+  801294:	5e                   	pop    %esi
+  801295:	5f                   	pop    %edi
+  801296:	5d                   	pop    %ebp
+  801297:	c3                   	ret
+
+00801298 <sendfile>:
+{
+  801298:	55                   	push   %ebp
+  801299:	89 e5                	mov    %esp,%ebp
+  80129b:	56                   	push   %esi
+  80129c:	53                   	push   %ebx
+  80129d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8012a0:	89 f0                	mov    %esi,%eax
+  8012a2:	e8 bb fd ff ff       	call   801062 <fd2sockid>
+  8012a7:	89 c3                	mov    %eax,%ebx
+  8012a9:	85 c0                	test   %eax,%eax
+  8012ab:	78 1f                	js     8012cc <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012ad:	89 f0                	mov    %esi,%eax
+  8012af:	e8 de fd ff ff       	call   801092 <sock_flags>
+  8012b4:	83 ec 0c             	sub    $0xc,%esp
+  8012b7:	50                   	push   %eax
+  8012b8:	ff 75 14             	push   0x14(%ebp)
+  8012bb:	ff 75 10             	push   0x10(%ebp)
+  8012be:	ff 75 0c             	push   0xc(%ebp)
+  8012c1:	53                   	push   %ebx
+  8012c2:	e8 64 06 00 00       	call   80192b <nsipc_sendfile>
+  8012c7:	89 c3                	mov    %eax,%ebx
+  8012c9:	83 c4 20             	add    $0x20,%esp
+}
+  8012cc:	89 d8                	mov    %ebx,%eax
+  8012ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5d                   	pop    %ebp
+  8012d4:	c3                   	ret
+
+008012d5 <evctl>:
+{
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	53                   	push   %ebx
+  8012d9:	83 ec 04             	sub    $0x4,%esp
+  8012dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8012df:	89 d8                	mov    %ebx,%eax
+  8012e1:	e8 7c fd ff ff       	call   801062 <fd2sockid>
+  8012e6:	85 c0                	test   %eax,%eax
+  8012e8:	78 10                	js     8012fa <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8012ea:	83 ec 04             	sub    $0x4,%esp
+  8012ed:	53                   	push   %ebx
+  8012ee:	ff 75 0c             	push   0xc(%ebp)
+  8012f1:	50                   	push   %eax
+  8012f2:	e8 d2 0b 00 00       	call   801ec9 <nsipc_evctl>
+  8012f7:	83 c4 10             	add    $0x10,%esp
+}
+  8012fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012fd:	c9                   	leave
+  8012fe:	c3                   	ret
+
+008012ff <evwait>:
+{
+  8012ff:	55                   	push   %ebp
+  801300:	89 e5                	mov    %esp,%ebp
+  801302:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801305:	ff 75 10             	push   0x10(%ebp)
+  801308:	ff 75 0c             	push   0xc(%ebp)
+  80130b:	ff 75 08             	push   0x8(%ebp)
+  80130e:	e8 e0 0b 00 00       	call   801ef3 <nsipc_evwait>
+}
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+
+00801315 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80131b:	ff 75 10             	push   0x10(%ebp)
+  80131e:	ff 75 0c             	push   0xc(%ebp)
+  801321:	ff 75 08             	push   0x8(%ebp)
+  801324:	e8 31 0c 00 00       	call   801f5a <nsipc_socket>
+  801329:	83 c4 10             	add    $0x10,%esp
+  80132c:	85 c0                	test   %eax,%eax
+  80132e:	78 05                	js     801335 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801330:	e8 89 fd ff ff       	call   8010be <alloc_sockfd>
+}
+  801335:	c9                   	leave
+  801336:	c3                   	ret
+
+00801337 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	53                   	push   %ebx
+  80133b:	83 ec 04             	sub    $0x4,%esp
+  80133e:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801340:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801347:	74 26                	je     80136f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801349:	6a 07                	push   $0x7
+  80134b:	68 00 70 80 00       	push   $0x807000
+  801350:	53                   	push   %ebx
+  801351:	ff 35 24 53 80 00    	push   0x805324
+  801357:	e8 5c 24 00 00       	call   8037b8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80135c:	83 c4 0c             	add    $0xc,%esp
+  80135f:	6a 00                	push   $0x0
+  801361:	6a 00                	push   $0x0
+  801363:	6a 00                	push   $0x0
+  801365:	e8 be 21 00 00       	call   803528 <ipc_recv>
+}
+  80136a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80136d:	c9                   	leave
+  80136e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80136f:	83 ec 0c             	sub    $0xc,%esp
+  801372:	6a 03                	push   $0x3
+  801374:	e8 a8 24 00 00       	call   803821 <ipc_find_env>
+  801379:	a3 24 53 80 00       	mov    %eax,0x805324
+  80137e:	83 c4 10             	add    $0x10,%esp
+  801381:	eb c6                	jmp    801349 <nsipc+0x12>
+
+00801383 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	56                   	push   %esi
+  801387:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801388:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  80138e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801393:	85 f6                	test   %esi,%esi
+  801395:	75 33                	jne    8013ca <nsbulk_map+0x47>
+  801397:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80139c:	83 ec 04             	sub    $0x4,%esp
+  80139f:	6a 07                	push   $0x7
+  8013a1:	53                   	push   %ebx
+  8013a2:	6a 00                	push   $0x0
+  8013a4:	e8 fa ed ff ff       	call   8001a3 <sys_page_alloc>
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 1a                	js     8013ca <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013b0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013b6:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013bc:	75 de                	jne    80139c <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013be:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013c5:	00 00 00 
+	return 0;
+  8013c8:	89 f0                	mov    %esi,%eax
+}
+  8013ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013cd:	5b                   	pop    %ebx
+  8013ce:	5e                   	pop    %esi
+  8013cf:	5d                   	pop    %ebp
+  8013d0:	c3                   	ret
+
+008013d1 <nsbulk_own>:
+{
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	57                   	push   %edi
+  8013d5:	56                   	push   %esi
+  8013d6:	53                   	push   %ebx
+  8013d7:	83 ec 0c             	sub    $0xc,%esp
+  8013da:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8013dc:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8013df:	85 d2                	test   %edx,%edx
+  8013e1:	7f 0e                	jg     8013f1 <nsbulk_own+0x20>
+	return 0;
+  8013e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e8:	eb 47                	jmp    801431 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8013ea:	83 c3 01             	add    $0x1,%ebx
+  8013ed:	39 fb                	cmp    %edi,%ebx
+  8013ef:	7d 3b                	jge    80142c <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8013f1:	be 01 00 00 00       	mov    $0x1,%esi
+  8013f6:	89 d9                	mov    %ebx,%ecx
+  8013f8:	d3 e6                	shl    %cl,%esi
+  8013fa:	89 f0                	mov    %esi,%eax
+  8013fc:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  801402:	74 e6                	je     8013ea <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801404:	83 ec 04             	sub    $0x4,%esp
+  801407:	6a 07                	push   $0x7
+  801409:	89 d8                	mov    %ebx,%eax
+  80140b:	c1 e0 0c             	shl    $0xc,%eax
+  80140e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801413:	50                   	push   %eax
+  801414:	6a 00                	push   $0x0
+  801416:	e8 88 ed ff ff       	call   8001a3 <sys_page_alloc>
+  80141b:	83 c4 10             	add    $0x10,%esp
+  80141e:	85 c0                	test   %eax,%eax
+  801420:	78 0f                	js     801431 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801422:	f7 d6                	not    %esi
+  801424:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  80142a:	eb be                	jmp    8013ea <nsbulk_own+0x19>
+	return 0;
+  80142c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5f                   	pop    %edi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+
+00801439 <nsipc_bulk>:
+{
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	57                   	push   %edi
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+  80143f:	83 ec 1c             	sub    $0x1c,%esp
+  801442:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801445:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801447:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80144d:	c1 fb 0c             	sar    $0xc,%ebx
+  801450:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  801453:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80145a:	74 56                	je     8014b2 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80145c:	85 ff                	test   %edi,%edi
+  80145e:	7e 24                	jle    801484 <nsipc_bulk+0x4b>
+  801460:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801466:	74 1c                	je     801484 <nsipc_bulk+0x4b>
+  801468:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80146e:	c1 e3 0c             	shl    $0xc,%ebx
+  801471:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801476:	0f b6 10             	movzbl (%eax),%edx
+  801479:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80147b:	05 00 10 00 00       	add    $0x1000,%eax
+  801480:	39 d8                	cmp    %ebx,%eax
+  801482:	75 f2                	jne    801476 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	56                   	push   %esi
+  801488:	57                   	push   %edi
+  801489:	68 00 00 00 e0       	push   $0xe0000000
+  80148e:	ff 75 e4             	push   -0x1c(%ebp)
+  801491:	ff 35 24 53 80 00    	push   0x805324
+  801497:	e8 50 23 00 00       	call   8037ec <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80149c:	83 c4 1c             	add    $0x1c,%esp
+  80149f:	6a 00                	push   $0x0
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	6a 00                	push   $0x0
+  8014a5:	e8 7e 20 00 00       	call   803528 <ipc_recv>
+}
+  8014aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5f                   	pop    %edi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	6a 03                	push   $0x3
+  8014b7:	e8 65 23 00 00       	call   803821 <ipc_find_env>
+  8014bc:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014c1:	83 c4 10             	add    $0x10,%esp
+  8014c4:	eb 96                	jmp    80145c <nsipc_bulk+0x23>
+
+008014c6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014c6:	55                   	push   %ebp
+  8014c7:	89 e5                	mov    %esp,%ebp
+  8014c9:	53                   	push   %ebx
+  8014ca:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014d8:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8014dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e2:	e8 50 fe ff ff       	call   801337 <nsipc>
+  8014e7:	89 c3                	mov    %eax,%ebx
+  8014e9:	85 c0                	test   %eax,%eax
+  8014eb:	79 07                	jns    8014f4 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8014ed:	89 d8                	mov    %ebx,%eax
+  8014ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f2:	c9                   	leave
+  8014f3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8014f4:	83 ec 04             	sub    $0x4,%esp
+  8014f7:	ff 35 10 70 80 00    	push   0x807010
+  8014fd:	68 00 70 80 00       	push   $0x807000
+  801502:	ff 75 0c             	push   0xc(%ebp)
+  801505:	e8 56 1e 00 00       	call   803360 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80150a:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801510:	8b 45 10             	mov    0x10(%ebp),%eax
+  801513:	89 10                	mov    %edx,(%eax)
+  801515:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801518:	eb d3                	jmp    8014ed <nsipc_accept+0x27>
+
+0080151a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80151a:	55                   	push   %ebp
+  80151b:	89 e5                	mov    %esp,%ebp
+  80151d:	53                   	push   %ebx
+  80151e:	83 ec 08             	sub    $0x8,%esp
+  801521:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801524:	8b 45 08             	mov    0x8(%ebp),%eax
+  801527:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80152c:	53                   	push   %ebx
+  80152d:	ff 75 0c             	push   0xc(%ebp)
+  801530:	68 04 70 80 00       	push   $0x807004
+  801535:	e8 26 1e 00 00       	call   803360 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80153a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801540:	b8 02 00 00 00       	mov    $0x2,%eax
+  801545:	e8 ed fd ff ff       	call   801337 <nsipc>
+}
+  80154a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80154d:	c9                   	leave
+  80154e:	c3                   	ret
+
+0080154f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80154f:	55                   	push   %ebp
+  801550:	89 e5                	mov    %esp,%ebp
+  801552:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801555:	8b 45 08             	mov    0x8(%ebp),%eax
+  801558:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80155d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801560:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801565:	b8 03 00 00 00       	mov    $0x3,%eax
+  80156a:	e8 c8 fd ff ff       	call   801337 <nsipc>
+}
+  80156f:	c9                   	leave
+  801570:	c3                   	ret
+
+00801571 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801577:	8b 45 08             	mov    0x8(%ebp),%eax
+  80157a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80157f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801584:	e8 ae fd ff ff       	call   801337 <nsipc>
+}
+  801589:	c9                   	leave
+  80158a:	c3                   	ret
+
+0080158b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	53                   	push   %ebx
+  80158f:	83 ec 08             	sub    $0x8,%esp
+  801592:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801595:	8b 45 08             	mov    0x8(%ebp),%eax
+  801598:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80159d:	53                   	push   %ebx
+  80159e:	ff 75 0c             	push   0xc(%ebp)
+  8015a1:	68 04 70 80 00       	push   $0x807004
+  8015a6:	e8 b5 1d 00 00       	call   803360 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015ab:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015b1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015b6:	e8 7c fd ff ff       	call   801337 <nsipc>
+}
+  8015bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015be:	c9                   	leave
+  8015bf:	c3                   	ret
+
+008015c0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015c0:	55                   	push   %ebp
+  8015c1:	89 e5                	mov    %esp,%ebp
+  8015c3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015d1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015d6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015db:	e8 57 fd ff ff       	call   801337 <nsipc>
+}
+  8015e0:	c9                   	leave
+  8015e1:	c3                   	ret
+
+008015e2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+  8015e7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8015ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ed:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8015f2:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8015f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8015fb:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801600:	b8 07 00 00 00       	mov    $0x7,%eax
+  801605:	e8 2d fd ff ff       	call   801337 <nsipc>
+  80160a:	89 c3                	mov    %eax,%ebx
+  80160c:	85 c0                	test   %eax,%eax
+  80160e:	78 22                	js     801632 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801610:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801615:	39 c6                	cmp    %eax,%esi
+  801617:	0f 4e c6             	cmovle %esi,%eax
+  80161a:	39 c3                	cmp    %eax,%ebx
+  80161c:	7f 1d                	jg     80163b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80161e:	83 ec 04             	sub    $0x4,%esp
+  801621:	53                   	push   %ebx
+  801622:	68 00 70 80 00       	push   $0x807000
+  801627:	ff 75 0c             	push   0xc(%ebp)
+  80162a:	e8 31 1d 00 00       	call   803360 <memmove>
+  80162f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801632:	89 d8                	mov    %ebx,%eax
+  801634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801637:	5b                   	pop    %ebx
+  801638:	5e                   	pop    %esi
+  801639:	5d                   	pop    %ebp
+  80163a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80163b:	68 54 3b 80 00       	push   $0x803b54
+  801640:	68 69 3b 80 00       	push   $0x803b69
+  801645:	68 b2 00 00 00       	push   $0xb2
+  80164a:	68 7e 3b 80 00       	push   $0x803b7e
+  80164f:	e8 8a 13 00 00       	call   8029de <_panic>
+
+00801654 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	53                   	push   %ebx
+  801658:	83 ec 04             	sub    $0x4,%esp
+  80165b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80165e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801661:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801666:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80166c:	7f 2e                	jg     80169c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80166e:	83 ec 04             	sub    $0x4,%esp
+  801671:	53                   	push   %ebx
+  801672:	ff 75 0c             	push   0xc(%ebp)
+  801675:	68 0c 70 80 00       	push   $0x80700c
+  80167a:	e8 e1 1c 00 00       	call   803360 <memmove>
+	nsipcbuf.send.req_size = size;
+  80167f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801685:	8b 45 14             	mov    0x14(%ebp),%eax
+  801688:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80168d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801692:	e8 a0 fc ff ff       	call   801337 <nsipc>
+}
+  801697:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80169a:	c9                   	leave
+  80169b:	c3                   	ret
+	assert(size < 1600);
+  80169c:	68 8a 3b 80 00       	push   $0x803b8a
+  8016a1:	68 69 3b 80 00       	push   $0x803b69
+  8016a6:	68 bd 00 00 00       	push   $0xbd
+  8016ab:	68 7e 3b 80 00       	push   $0x803b7e
+  8016b0:	e8 29 13 00 00       	call   8029de <_panic>
+
+008016b5 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	57                   	push   %edi
+  8016b9:	56                   	push   %esi
+  8016ba:	53                   	push   %ebx
+  8016bb:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016be:	e8 c0 fc ff ff       	call   801383 <nsbulk_map>
+  8016c3:	85 c0                	test   %eax,%eax
+  8016c5:	78 55                	js     80171c <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016c7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016ce:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016d5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8016dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8016df:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016e2:	0f 8d 24 02 00 00    	jge    80190c <nsipc_sendmsg+0x257>
+  8016e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016ee:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8016f1:	89 d8                	mov    %ebx,%eax
+  8016f3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8016f8:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8016fa:	83 ec 0c             	sub    $0xc,%esp
+  8016fd:	68 20 50 80 00       	push   $0x805020
+  801702:	e8 5a 0f 00 00       	call   802661 <pgbatch_init>
+  801707:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80170a:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80170c:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80170f:	e9 82 00 00 00       	jmp    801796 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  801714:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801717:	85 db                	test   %ebx,%ebx
+  801719:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  80171c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5f                   	pop    %edi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  801724:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801729:	29 c8                	sub    %ecx,%eax
+  80172b:	39 d0                	cmp    %edx,%eax
+  80172d:	0f 46 d0             	cmovbe %eax,%edx
+  801730:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  801732:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801738:	85 ff                	test   %edi,%edi
+  80173a:	0f 49 c7             	cmovns %edi,%eax
+  80173d:	c1 f8 0c             	sar    $0xc,%eax
+  801740:	ba 01 00 00 00       	mov    $0x1,%edx
+  801745:	e8 87 fc ff ff       	call   8013d1 <nsbulk_own>
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	0f 88 17 01 00 00    	js     801869 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  801752:	83 ec 04             	sub    $0x4,%esp
+  801755:	56                   	push   %esi
+  801756:	ff 75 e0             	push   -0x20(%ebp)
+  801759:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80175c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801761:	50                   	push   %eax
+  801762:	e8 f9 1b 00 00       	call   803360 <memmove>
+  801767:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80176a:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80176d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801770:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801773:	0f 84 fd 00 00 00    	je     801876 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801779:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80177c:	01 f7                	add    %esi,%edi
+  80177e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801781:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801784:	0f 8d 01 01 00 00    	jge    80188b <nsipc_sendmsg+0x1d6>
+  80178a:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  801790:	0f 8f f0 00 00 00    	jg     801886 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  801796:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801799:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80179c:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80179f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017a2:	89 c2                	mov    %eax,%edx
+  8017a4:	03 13                	add    (%ebx),%edx
+  8017a6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017a9:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017ac:	29 c6                	sub    %eax,%esi
+  8017ae:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017b3:	29 f9                	sub    %edi,%ecx
+  8017b5:	39 ce                	cmp    %ecx,%esi
+  8017b7:	89 ca                	mov    %ecx,%edx
+  8017b9:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017bc:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017bf:	89 f9                	mov    %edi,%ecx
+  8017c1:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017ca:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017cf:	09 c8                	or     %ecx,%eax
+  8017d1:	0f 85 4d ff ff ff    	jne    801724 <nsipc_sendmsg+0x6f>
+  8017d7:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017dd:	0f 86 41 ff ff ff    	jbe    801724 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017e3:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8017e9:	85 ff                	test   %edi,%edi
+  8017eb:	0f 49 c7             	cmovns %edi,%eax
+  8017ee:	c1 f8 0c             	sar    $0xc,%eax
+  8017f1:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8017f3:	89 d1                	mov    %edx,%ecx
+  8017f5:	c1 e9 0c             	shr    $0xc,%ecx
+  8017f8:	01 c8                	add    %ecx,%eax
+  8017fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017fd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801800:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  801802:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801805:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80180a:	29 c8                	sub    %ecx,%eax
+  80180c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80180f:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801812:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801814:	b8 01 00 00 00       	mov    $0x1,%eax
+  801819:	89 f9                	mov    %edi,%ecx
+  80181b:	d3 e0                	shl    %cl,%eax
+  80181d:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801823:	83 ec 08             	sub    $0x8,%esp
+  801826:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801828:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80182b:	50                   	push   %eax
+  80182c:	6a 00                	push   $0x0
+  80182e:	56                   	push   %esi
+  80182f:	6a 00                	push   $0x0
+  801831:	68 20 50 80 00       	push   $0x805020
+  801836:	e8 e4 0e 00 00       	call   80271f <pgbatch_map>
+  80183b:	83 c4 20             	add    $0x20,%esp
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	0f 88 ce fe ff ff    	js     801714 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  801846:	83 c7 01             	add    $0x1,%edi
+  801849:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80184f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801852:	39 c7                	cmp    %eax,%edi
+  801854:	75 be                	jne    801814 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  801856:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801859:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80185c:	89 d6                	mov    %edx,%esi
+  80185e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801864:	e9 01 ff ff ff       	jmp    80176a <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801869:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80186c:	85 db                	test   %ebx,%ebx
+  80186e:	0f 45 c3             	cmovne %ebx,%eax
+  801871:	e9 a6 fe ff ff       	jmp    80171c <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  801876:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80187a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801881:	e9 f3 fe ff ff       	jmp    801779 <nsipc_sendmsg+0xc4>
+  801886:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801889:	eb 03                	jmp    80188e <nsipc_sendmsg+0x1d9>
+  80188b:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80188e:	83 ec 0c             	sub    $0xc,%esp
+  801891:	68 20 50 80 00       	push   $0x805020
+  801896:	e8 d4 0d 00 00       	call   80266f <pgbatch_flush>
+  80189b:	83 c4 10             	add    $0x10,%esp
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	78 50                	js     8018f2 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8018a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a5:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018aa:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018b0:	89 fb                	mov    %edi,%ebx
+  8018b2:	29 f3                	sub    %esi,%ebx
+  8018b4:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018bd:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018c2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018c7:	89 fa                	mov    %edi,%edx
+  8018c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018ce:	e8 66 fb ff ff       	call   801439 <nsipc_bulk>
+  8018d3:	85 c0                	test   %eax,%eax
+  8018d5:	78 28                	js     8018ff <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018d7:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8018da:	39 c3                	cmp    %eax,%ebx
+  8018dc:	75 0c                	jne    8018ea <nsipc_sendmsg+0x235>
+  8018de:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018e1:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8018e4:	0f 8f f2 fd ff ff    	jg     8016dc <nsipc_sendmsg+0x27>
+		sent += r;
+  8018ea:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018ed:	e9 2a fe ff ff       	jmp    80171c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018f2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018f5:	85 db                	test   %ebx,%ebx
+  8018f7:	0f 45 c3             	cmovne %ebx,%eax
+  8018fa:	e9 1d fe ff ff       	jmp    80171c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018ff:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801902:	85 db                	test   %ebx,%ebx
+  801904:	0f 45 c3             	cmovne %ebx,%eax
+  801907:	e9 10 fe ff ff       	jmp    80171c <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  80190c:	83 ec 0c             	sub    $0xc,%esp
+  80190f:	68 20 50 80 00       	push   $0x805020
+  801914:	e8 48 0d 00 00       	call   802661 <pgbatch_init>
+  801919:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80191c:	be 00 00 00 00       	mov    $0x0,%esi
+  801921:	bf 00 00 00 00       	mov    $0x0,%edi
+  801926:	e9 63 ff ff ff       	jmp    80188e <nsipc_sendmsg+0x1d9>
+
+0080192b <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80192b:	55                   	push   %ebp
+  80192c:	89 e5                	mov    %esp,%ebp
+  80192e:	57                   	push   %edi
+  80192f:	56                   	push   %esi
+  801930:	53                   	push   %ebx
+  801931:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  801934:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  80193b:	0f 84 c8 00 00 00    	je     801a09 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  801941:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801948:	0f 84 e4 00 00 00    	je     801a32 <nsipc_sendfile+0x107>
+{
+  80194e:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  801953:	89 fb                	mov    %edi,%ebx
+  801955:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801958:	0f 83 f0 00 00 00    	jae    801a4e <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80195e:	89 fa                	mov    %edi,%edx
+  801960:	03 55 10             	add    0x10(%ebp),%edx
+  801963:	89 d0                	mov    %edx,%eax
+  801965:	c1 f8 1f             	sar    $0x1f,%eax
+  801968:	c1 e8 14             	shr    $0x14,%eax
+  80196b:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80196e:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801974:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801976:	6a 10                	push   $0x10
+  801978:	68 00 20 01 e0       	push   $0xe0012000
+  80197d:	52                   	push   %edx
+  80197e:	ff 75 0c             	push   0xc(%ebp)
+  801981:	e8 fe f4 ff ff       	call   800e84 <fmap>
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	0f 8e b8 00 00 00    	jle    801a49 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  801991:	39 c6                	cmp    %eax,%esi
+  801993:	0f 8d b5 00 00 00    	jge    801a4e <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  801999:	29 f0                	sub    %esi,%eax
+  80199b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80199e:	29 da                	sub    %ebx,%edx
+  8019a0:	39 d0                	cmp    %edx,%eax
+  8019a2:	89 d3                	mov    %edx,%ebx
+  8019a4:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8019a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019aa:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019af:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019b5:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019bb:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019be:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019c3:	83 ec 0c             	sub    $0xc,%esp
+  8019c6:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019c8:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019cf:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019d2:	83 c0 01             	add    $0x1,%eax
+  8019d5:	50                   	push   %eax
+  8019d6:	68 00 10 01 e0       	push   $0xe0011000
+  8019db:	6a 11                	push   $0x11
+  8019dd:	ff 35 24 53 80 00    	push   0x805324
+  8019e3:	e8 04 1e 00 00       	call   8037ec <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8019e8:	83 c4 1c             	add    $0x1c,%esp
+  8019eb:	6a 00                	push   $0x0
+  8019ed:	6a 00                	push   $0x0
+  8019ef:	6a 00                	push   $0x0
+  8019f1:	e8 32 1b 00 00       	call   803528 <ipc_recv>
+  8019f6:	83 c4 10             	add    $0x10,%esp
+  8019f9:	85 c0                	test   %eax,%eax
+  8019fb:	78 5b                	js     801a58 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8019fd:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8019ff:	39 c3                	cmp    %eax,%ebx
+  801a01:	0f 8e 4c ff ff ff    	jle    801953 <nsipc_sendfile+0x28>
+  801a07:	eb 45                	jmp    801a4e <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a09:	83 ec 04             	sub    $0x4,%esp
+  801a0c:	6a 07                	push   $0x7
+  801a0e:	68 00 10 01 e0       	push   $0xe0011000
+  801a13:	6a 00                	push   $0x0
+  801a15:	e8 89 e7 ff ff       	call   8001a3 <sys_page_alloc>
+  801a1a:	89 c7                	mov    %eax,%edi
+  801a1c:	83 c4 10             	add    $0x10,%esp
+  801a1f:	85 c0                	test   %eax,%eax
+  801a21:	78 2b                	js     801a4e <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a23:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a2a:	00 00 00 
+  801a2d:	e9 0f ff ff ff       	jmp    801941 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a32:	83 ec 0c             	sub    $0xc,%esp
+  801a35:	6a 03                	push   $0x3
+  801a37:	e8 e5 1d 00 00       	call   803821 <ipc_find_env>
+  801a3c:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a41:	83 c4 10             	add    $0x10,%esp
+  801a44:	e9 05 ff ff ff       	jmp    80194e <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a49:	85 ff                	test   %edi,%edi
+  801a4b:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a4e:	89 f8                	mov    %edi,%eax
+  801a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a53:	5b                   	pop    %ebx
+  801a54:	5e                   	pop    %esi
+  801a55:	5f                   	pop    %edi
+  801a56:	5d                   	pop    %ebp
+  801a57:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a58:	85 ff                	test   %edi,%edi
+  801a5a:	0f 44 f8             	cmove  %eax,%edi
+  801a5d:	eb ef                	jmp    801a4e <nsipc_sendfile+0x123>
+
+00801a5f <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a5f:	55                   	push   %ebp
+  801a60:	89 e5                	mov    %esp,%ebp
+  801a62:	57                   	push   %edi
+  801a63:	56                   	push   %esi
+  801a64:	53                   	push   %ebx
+  801a65:	83 ec 1c             	sub    $0x1c,%esp
+  801a68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a6b:	e8 13 f9 ff ff       	call   801383 <nsbulk_map>
+  801a70:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	0f 88 ba 00 00 00    	js     801b35 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a7b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a7f:	0f 8e bb 00 00 00    	jle    801b40 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801a85:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a8a:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801a8f:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801a94:	89 f8                	mov    %edi,%eax
+  801a96:	29 f0                	sub    %esi,%eax
+  801a98:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801a9c:	39 c8                	cmp    %ecx,%eax
+  801a9e:	0f 47 c1             	cmova  %ecx,%eax
+  801aa1:	01 f0                	add    %esi,%eax
+  801aa3:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801aa5:	83 c2 01             	add    $0x1,%edx
+  801aa8:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801aab:	7e 07                	jle    801ab4 <nsipc_recvmsg+0x55>
+  801aad:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801ab2:	7e e0                	jle    801a94 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801ab4:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801aba:	c1 fa 0c             	sar    $0xc,%edx
+  801abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac2:	e8 0a f9 ff ff       	call   8013d1 <nsbulk_own>
+  801ac7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801aca:	85 c0                	test   %eax,%eax
+  801acc:	78 67                	js     801b35 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801ace:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801ad6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801adc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801adf:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801ae4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801ae9:	89 f2                	mov    %esi,%edx
+  801aeb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801af0:	e8 44 f9 ff ff       	call   801439 <nsipc_bulk>
+  801af5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	78 39                	js     801b35 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801afc:	39 f0                	cmp    %esi,%eax
+  801afe:	7f 4a                	jg     801b4a <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801b00:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	7e 2c                	jle    801b35 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b09:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b0c:	29 fe                	sub    %edi,%esi
+  801b0e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b11:	39 c6                	cmp    %eax,%esi
+  801b13:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b16:	83 ec 04             	sub    $0x4,%esp
+  801b19:	56                   	push   %esi
+  801b1a:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b20:	50                   	push   %eax
+  801b21:	ff 33                	push   (%ebx)
+  801b23:	e8 38 18 00 00       	call   803360 <memmove>
+		n += m;
+  801b28:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b2a:	83 c3 08             	add    $0x8,%ebx
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b33:	7f d4                	jg     801b09 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3b:	5b                   	pop    %ebx
+  801b3c:	5e                   	pop    %esi
+  801b3d:	5f                   	pop    %edi
+  801b3e:	5d                   	pop    %ebp
+  801b3f:	c3                   	ret
+	int r, i, n, len = 0;
+  801b40:	be 00 00 00 00       	mov    $0x0,%esi
+  801b45:	e9 6a ff ff ff       	jmp    801ab4 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b4a:	68 60 3b 80 00       	push   $0x803b60
+  801b4f:	68 69 3b 80 00       	push   $0x803b69
+  801b54:	68 3b 01 00 00       	push   $0x13b
+  801b59:	68 7e 3b 80 00       	push   $0x803b7e
+  801b5e:	e8 7b 0e 00 00       	call   8029de <_panic>
+
+00801b63 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b63:	55                   	push   %ebp
+  801b64:	89 e5                	mov    %esp,%ebp
+  801b66:	57                   	push   %edi
+  801b67:	56                   	push   %esi
+  801b68:	53                   	push   %ebx
+  801b69:	83 ec 0c             	sub    $0xc,%esp
+  801b6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b6f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b72:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b78:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801b7d:	8b 07                	mov    (%edi),%eax
+  801b7f:	a3 04 70 80 00       	mov    %eax,0x807004
+  801b84:	8b 47 04             	mov    0x4(%edi),%eax
+  801b87:	a3 08 70 80 00       	mov    %eax,0x807008
+  801b8c:	8b 47 08             	mov    0x8(%edi),%eax
+  801b8f:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801b94:	8b 47 0c             	mov    0xc(%edi),%eax
+  801b97:	a3 10 70 80 00       	mov    %eax,0x807010
+  801b9c:	8b 47 10             	mov    0x10(%edi),%eax
+  801b9f:	a3 14 70 80 00       	mov    %eax,0x807014
+  801ba4:	8b 47 14             	mov    0x14(%edi),%eax
+  801ba7:	a3 18 70 80 00       	mov    %eax,0x807018
+  801bac:	8b 47 18             	mov    0x18(%edi),%eax
+  801baf:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bb4:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bb7:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bbc:	8b 47 20             	mov    0x20(%edi),%eax
+  801bbf:	a3 24 70 80 00       	mov    %eax,0x807024
+  801bc4:	8b 47 24             	mov    0x24(%edi),%eax
+  801bc7:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bcc:	8b 47 28             	mov    0x28(%edi),%eax
+  801bcf:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801bd4:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801bd7:	a3 30 70 80 00       	mov    %eax,0x807030
+  801bdc:	8b 47 30             	mov    0x30(%edi),%eax
+  801bdf:	a3 34 70 80 00       	mov    %eax,0x807034
+  801be4:	8b 47 34             	mov    0x34(%edi),%eax
+  801be7:	a3 38 70 80 00       	mov    %eax,0x807038
+  801bec:	8b 47 38             	mov    0x38(%edi),%eax
+  801bef:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801bf4:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801bf7:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801bfc:	8b 06                	mov    (%esi),%eax
+  801bfe:	a3 44 70 80 00       	mov    %eax,0x807044
+  801c03:	8b 46 04             	mov    0x4(%esi),%eax
+  801c06:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c0b:	8b 46 08             	mov    0x8(%esi),%eax
+  801c0e:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c13:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c16:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c1b:	8b 46 10             	mov    0x10(%esi),%eax
+  801c1e:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c23:	8b 46 14             	mov    0x14(%esi),%eax
+  801c26:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c2b:	8b 46 18             	mov    0x18(%esi),%eax
+  801c2e:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c33:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c36:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c3b:	8b 46 20             	mov    0x20(%esi),%eax
+  801c3e:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c43:	8b 46 24             	mov    0x24(%esi),%eax
+  801c46:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c4b:	8b 46 28             	mov    0x28(%esi),%eax
+  801c4e:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c53:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c56:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c5b:	8b 46 30             	mov    0x30(%esi),%eax
+  801c5e:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c63:	8b 46 34             	mov    0x34(%esi),%eax
+  801c66:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c6b:	8b 46 38             	mov    0x38(%esi),%eax
+  801c6e:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c73:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c76:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801c7b:	8b 03                	mov    (%ebx),%eax
+  801c7d:	a3 84 70 80 00       	mov    %eax,0x807084
+  801c82:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c85:	a3 88 70 80 00       	mov    %eax,0x807088
+  801c8a:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c8d:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801c92:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c95:	a3 90 70 80 00       	mov    %eax,0x807090
+  801c9a:	8b 43 10             	mov    0x10(%ebx),%eax
+  801c9d:	a3 94 70 80 00       	mov    %eax,0x807094
+  801ca2:	8b 43 14             	mov    0x14(%ebx),%eax
+  801ca5:	a3 98 70 80 00       	mov    %eax,0x807098
+  801caa:	8b 43 18             	mov    0x18(%ebx),%eax
+  801cad:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801cb2:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cb5:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cba:	8b 43 20             	mov    0x20(%ebx),%eax
+  801cbd:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801cc2:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cc5:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cca:	8b 43 28             	mov    0x28(%ebx),%eax
+  801ccd:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801cd2:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801cd5:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801cda:	8b 43 30             	mov    0x30(%ebx),%eax
+  801cdd:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801ce2:	8b 43 34             	mov    0x34(%ebx),%eax
+  801ce5:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801cea:	8b 43 38             	mov    0x38(%ebx),%eax
+  801ced:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801cf2:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801cf5:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801cfa:	8b 45 18             	mov    0x18(%ebp),%eax
+  801cfd:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801d02:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d07:	e8 2b f6 ff ff       	call   801337 <nsipc>
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	0f 88 ad 01 00 00    	js     801ec1 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d14:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d1a:	89 17                	mov    %edx,(%edi)
+  801d1c:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d22:	89 57 04             	mov    %edx,0x4(%edi)
+  801d25:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d2b:	89 57 08             	mov    %edx,0x8(%edi)
+  801d2e:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d34:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d37:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d3d:	89 57 10             	mov    %edx,0x10(%edi)
+  801d40:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d46:	89 57 14             	mov    %edx,0x14(%edi)
+  801d49:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d4f:	89 57 18             	mov    %edx,0x18(%edi)
+  801d52:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d58:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d5b:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d61:	89 57 20             	mov    %edx,0x20(%edi)
+  801d64:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d6a:	89 57 24             	mov    %edx,0x24(%edi)
+  801d6d:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d73:	89 57 28             	mov    %edx,0x28(%edi)
+  801d76:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801d7c:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801d7f:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801d85:	89 57 30             	mov    %edx,0x30(%edi)
+  801d88:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801d8e:	89 57 34             	mov    %edx,0x34(%edi)
+  801d91:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801d97:	89 57 38             	mov    %edx,0x38(%edi)
+  801d9a:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801da0:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801da3:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801da9:	89 16                	mov    %edx,(%esi)
+  801dab:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801db1:	89 56 04             	mov    %edx,0x4(%esi)
+  801db4:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801dba:	89 56 08             	mov    %edx,0x8(%esi)
+  801dbd:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dc3:	89 56 0c             	mov    %edx,0xc(%esi)
+  801dc6:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801dcc:	89 56 10             	mov    %edx,0x10(%esi)
+  801dcf:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801dd5:	89 56 14             	mov    %edx,0x14(%esi)
+  801dd8:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801dde:	89 56 18             	mov    %edx,0x18(%esi)
+  801de1:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801de7:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801dea:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801df0:	89 56 20             	mov    %edx,0x20(%esi)
+  801df3:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801df9:	89 56 24             	mov    %edx,0x24(%esi)
+  801dfc:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801e02:	89 56 28             	mov    %edx,0x28(%esi)
+  801e05:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e0b:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e0e:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e14:	89 56 30             	mov    %edx,0x30(%esi)
+  801e17:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e1d:	89 56 34             	mov    %edx,0x34(%esi)
+  801e20:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e26:	89 56 38             	mov    %edx,0x38(%esi)
+  801e29:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e2f:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e32:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e38:	89 13                	mov    %edx,(%ebx)
+  801e3a:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e40:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e43:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e49:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e4c:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e52:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e55:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e5b:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e5e:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e64:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e67:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e6d:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e70:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e76:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801e79:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801e7f:	89 53 20             	mov    %edx,0x20(%ebx)
+  801e82:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801e88:	89 53 24             	mov    %edx,0x24(%ebx)
+  801e8b:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801e91:	89 53 28             	mov    %edx,0x28(%ebx)
+  801e94:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801e9a:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801e9d:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801ea3:	89 53 30             	mov    %edx,0x30(%ebx)
+  801ea6:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801eac:	89 53 34             	mov    %edx,0x34(%ebx)
+  801eaf:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801eb5:	89 53 38             	mov    %edx,0x38(%ebx)
+  801eb8:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801ebe:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801ec1:	83 c4 0c             	add    $0xc,%esp
+  801ec4:	5b                   	pop    %ebx
+  801ec5:	5e                   	pop    %esi
+  801ec6:	5f                   	pop    %edi
+  801ec7:	5d                   	pop    %ebp
+  801ec8:	c3                   	ret
+
+00801ec9 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ec9:	55                   	push   %ebp
+  801eca:	89 e5                	mov    %esp,%ebp
+  801ecc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801ecf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801ed7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eda:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801edf:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ee2:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801ee7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801eec:	e8 46 f4 ff ff       	call   801337 <nsipc>
+}
+  801ef1:	c9                   	leave
+  801ef2:	c3                   	ret
+
+00801ef3 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	56                   	push   %esi
+  801ef7:	53                   	push   %ebx
+  801ef8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801efb:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801f01:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f04:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f09:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f0e:	e8 24 f4 ff ff       	call   801337 <nsipc>
+  801f13:	89 c3                	mov    %eax,%ebx
+  801f15:	85 c0                	test   %eax,%eax
+  801f17:	7e 1f                	jle    801f38 <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f19:	39 c6                	cmp    %eax,%esi
+  801f1b:	7c 24                	jl     801f41 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f1d:	83 ec 04             	sub    $0x4,%esp
+  801f20:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f27:	50                   	push   %eax
+  801f28:	68 00 70 80 00       	push   $0x807000
+  801f2d:	ff 75 08             	push   0x8(%ebp)
+  801f30:	e8 2b 14 00 00       	call   803360 <memmove>
+  801f35:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f38:	89 d8                	mov    %ebx,%eax
+  801f3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f3d:	5b                   	pop    %ebx
+  801f3e:	5e                   	pop    %esi
+  801f3f:	5d                   	pop    %ebp
+  801f40:	c3                   	ret
+		assert(r <= max);
+  801f41:	68 96 3b 80 00       	push   $0x803b96
+  801f46:	68 69 3b 80 00       	push   $0x803b69
+  801f4b:	68 6a 01 00 00       	push   $0x16a
+  801f50:	68 7e 3b 80 00       	push   $0x803b7e
+  801f55:	e8 84 0a 00 00       	call   8029de <_panic>
+
+00801f5a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f5a:	55                   	push   %ebp
+  801f5b:	89 e5                	mov    %esp,%ebp
+  801f5d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f63:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f70:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f73:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f78:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f7d:	e8 b5 f3 ff ff       	call   801337 <nsipc>
+}
+  801f82:	c9                   	leave
+  801f83:	c3                   	ret
+
+00801f84 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801f84:	55                   	push   %ebp
+  801f85:	89 e5                	mov    %esp,%ebp
+  801f87:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801f92:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f97:	e8 9b f3 ff ff       	call   801337 <nsipc>
+}
+  801f9c:	c9                   	leave
+  801f9d:	c3                   	ret
+
+00801f9e <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	53                   	push   %ebx
+  801fa2:	83 ec 04             	sub    $0x4,%esp
+  801fa5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fa8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fad:	e8 85 f3 ff ff       	call   801337 <nsipc>
+  801fb2:	85 c0                	test   %eax,%eax
+  801fb4:	78 50                	js     802006 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fb6:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fbc:	89 13                	mov    %edx,(%ebx)
+  801fbe:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801fc4:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fc7:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801fcd:	89 53 08             	mov    %edx,0x8(%ebx)
+  801fd0:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801fd6:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801fd9:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801fdf:	89 53 10             	mov    %edx,0x10(%ebx)
+  801fe2:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801fe8:	89 53 14             	mov    %edx,0x14(%ebx)
+  801feb:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801ff1:	89 53 18             	mov    %edx,0x18(%ebx)
+  801ff4:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801ffa:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801ffd:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802003:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802006:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802009:	c9                   	leave
+  80200a:	c3                   	ret
+
+0080200b <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80200b:	55                   	push   %ebp
+  80200c:	89 e5                	mov    %esp,%ebp
+  80200e:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802011:	6a 03                	push   $0x3
+  802013:	e8 09 18 00 00       	call   803821 <ipc_find_env>
+  802018:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  80201d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802020:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802025:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80202a:	e8 08 f3 ff ff       	call   801337 <nsipc>
+  80202f:	83 c4 10             	add    $0x10,%esp
+  802032:	85 c0                	test   %eax,%eax
+  802034:	78 0a                	js     802040 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802036:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  80203b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802040:	c9                   	leave
+  802041:	c3                   	ret
+
+00802042 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802042:	55                   	push   %ebp
+  802043:	89 e5                	mov    %esp,%ebp
+  802045:	57                   	push   %edi
+  802046:	56                   	push   %esi
+  802047:	53                   	push   %ebx
+  802048:	83 ec 1c             	sub    $0x1c,%esp
+  80204b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80204e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802051:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802056:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205b:	89 e0                	mov    %esp,%eax
+  80205d:	89 f2                	mov    %esi,%edx
+  80205f:	29 c2                	sub    %eax,%edx
+  802061:	89 d0                	mov    %edx,%eax
+  802063:	c1 e8 0f             	shr    $0xf,%eax
+  802066:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80206c:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80206f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802076:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802079:	83 ec 0c             	sub    $0xc,%esp
+  80207c:	ff 75 e0             	push   -0x20(%ebp)
+  80207f:	e8 dc 17 00 00       	call   803860 <pageref>
+  802084:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802087:	83 c4 04             	add    $0x4,%esp
+  80208a:	ff 75 dc             	push   -0x24(%ebp)
+  80208d:	e8 ce 17 00 00       	call   803860 <pageref>
+  802092:	89 e2                	mov    %esp,%edx
+  802094:	89 f1                	mov    %esi,%ecx
+  802096:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802098:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80209b:	89 ca                	mov    %ecx,%edx
+  80209d:	c1 ea 0f             	shr    $0xf,%edx
+  8020a0:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8020a6:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020a9:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020b0:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020b3:	39 d7                	cmp    %edx,%edi
+  8020b5:	74 40                	je     8020f7 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020b7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020ba:	75 9f                	jne    80205b <_pipeisclosed+0x19>
+  8020bc:	89 e2                	mov    %esp,%edx
+  8020be:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020c3:	29 d0                	sub    %edx,%eax
+  8020c5:	89 c2                	mov    %eax,%edx
+  8020c7:	c1 ea 0f             	shr    $0xf,%edx
+  8020ca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d4:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020d7:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020de:	8b 40 58             	mov    0x58(%eax),%eax
+  8020e1:	6a 01                	push   $0x1
+  8020e3:	50                   	push   %eax
+  8020e4:	57                   	push   %edi
+  8020e5:	68 9f 3b 80 00       	push   $0x803b9f
+  8020ea:	e8 ca 09 00 00       	call   802ab9 <cprintf>
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	e9 5f ff ff ff       	jmp    802056 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8020f7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020fa:	0f 94 c0             	sete   %al
+  8020fd:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802103:	5b                   	pop    %ebx
+  802104:	5e                   	pop    %esi
+  802105:	5f                   	pop    %edi
+  802106:	5d                   	pop    %ebp
+  802107:	c3                   	ret
+
+00802108 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802108:	55                   	push   %ebp
+  802109:	89 e5                	mov    %esp,%ebp
+  80210b:	53                   	push   %ebx
+  80210c:	83 ec 0c             	sub    $0xc,%esp
+  80210f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802112:	53                   	push   %ebx
+  802113:	6a 00                	push   $0x0
+  802115:	e8 0e e1 ff ff       	call   800228 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80211a:	89 1c 24             	mov    %ebx,(%esp)
+  80211d:	e8 f4 e4 ff ff       	call   800616 <fd2data>
+  802122:	83 c4 08             	add    $0x8,%esp
+  802125:	50                   	push   %eax
+  802126:	6a 00                	push   $0x0
+  802128:	e8 fb e0 ff ff       	call   800228 <sys_page_unmap>
+}
+  80212d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802130:	c9                   	leave
+  802131:	c3                   	ret
+
+00802132 <devpipe_read>:
+{
+  802132:	55                   	push   %ebp
+  802133:	89 e5                	mov    %esp,%ebp
+  802135:	57                   	push   %edi
+  802136:	56                   	push   %esi
+  802137:	53                   	push   %ebx
+  802138:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80213b:	ff 75 08             	push   0x8(%ebp)
+  80213e:	e8 d3 e4 ff ff       	call   800616 <fd2data>
+  802143:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802145:	8b 70 04             	mov    0x4(%eax),%esi
+  802148:	8b 00                	mov    (%eax),%eax
+  80214a:	83 c4 10             	add    $0x10,%esp
+  80214d:	39 f0                	cmp    %esi,%eax
+  80214f:	75 36                	jne    802187 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802151:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802154:	89 da                	mov    %ebx,%edx
+  802156:	8b 45 08             	mov    0x8(%ebp),%eax
+  802159:	e8 e4 fe ff ff       	call   802042 <_pipeisclosed>
+  80215e:	85 c0                	test   %eax,%eax
+  802160:	0f 85 d4 00 00 00    	jne    80223a <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802166:	b8 01 00 00 00       	mov    $0x1,%eax
+  80216b:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80216f:	83 ec 04             	sub    $0x4,%esp
+  802172:	6a ff                	push   $0xffffffff
+  802174:	56                   	push   %esi
+  802175:	57                   	push   %edi
+  802176:	e8 26 e4 ff ff       	call   8005a1 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80217b:	8b 73 04             	mov    0x4(%ebx),%esi
+  80217e:	8b 03                	mov    (%ebx),%eax
+  802180:	83 c4 10             	add    $0x10,%esp
+  802183:	39 c6                	cmp    %eax,%esi
+  802185:	74 cd                	je     802154 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802187:	8b 73 04             	mov    0x4(%ebx),%esi
+  80218a:	8b 03                	mov    (%ebx),%eax
+  80218c:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802192:	29 c6                	sub    %eax,%esi
+  802194:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802199:	f7 e6                	mul    %esi
+  80219b:	c1 ea 0c             	shr    $0xc,%edx
+  80219e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021a4:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8021a6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021a9:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021ad:	8b 0b                	mov    (%ebx),%ecx
+  8021af:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021b4:	f7 e1                	mul    %ecx
+  8021b6:	c1 ea 0b             	shr    $0xb,%edx
+  8021b9:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021bf:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021c1:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021c6:	29 cf                	sub    %ecx,%edi
+  8021c8:	39 f7                	cmp    %esi,%edi
+  8021ca:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021cd:	83 ec 04             	sub    $0x4,%esp
+  8021d0:	57                   	push   %edi
+  8021d1:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021d5:	50                   	push   %eax
+  8021d6:	ff 75 0c             	push   0xc(%ebp)
+  8021d9:	e8 82 11 00 00       	call   803360 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8021de:	83 c4 0c             	add    $0xc,%esp
+  8021e1:	89 f0                	mov    %esi,%eax
+  8021e3:	29 f8                	sub    %edi,%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021e9:	50                   	push   %eax
+  8021ea:	89 f8                	mov    %edi,%eax
+  8021ec:	03 45 0c             	add    0xc(%ebp),%eax
+  8021ef:	50                   	push   %eax
+  8021f0:	e8 6b 11 00 00       	call   803360 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8021f5:	8b 0b                	mov    (%ebx),%ecx
+  8021f7:	01 f1                	add    %esi,%ecx
+  8021f9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021fe:	f7 e1                	mul    %ecx
+  802200:	c1 ea 0c             	shr    $0xc,%edx
+  802203:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802209:	29 c1                	sub    %eax,%ecx
+  80220b:	89 0b                	mov    %ecx,(%ebx)
+  80220d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802212:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	85 c0                	test   %eax,%eax
+  80221b:	75 0a                	jne    802227 <devpipe_read+0xf5>
+	return n;
+  80221d:	89 f0                	mov    %esi,%eax
+}
+  80221f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802222:	5b                   	pop    %ebx
+  802223:	5e                   	pop    %esi
+  802224:	5f                   	pop    %edi
+  802225:	5d                   	pop    %ebp
+  802226:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802227:	83 ec 08             	sub    $0x8,%esp
+  80222a:	68 00 04 00 00       	push   $0x400
+  80222f:	53                   	push   %ebx
+  802230:	e8 8e e3 ff ff       	call   8005c3 <sys_futex_wake>
+  802235:	83 c4 10             	add    $0x10,%esp
+  802238:	eb e3                	jmp    80221d <devpipe_read+0xeb>
+			return 0;
+  80223a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223f:	eb de                	jmp    80221f <devpipe_read+0xed>
+
+00802241 <devpipe_write>:
+{
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	57                   	push   %edi
+  802245:	56                   	push   %esi
+  802246:	53                   	push   %ebx
+  802247:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80224a:	ff 75 08             	push   0x8(%ebp)
+  80224d:	e8 c4 e3 ff ff       	call   800616 <fd2data>
+  802252:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802254:	83 c4 10             	add    $0x10,%esp
+  802257:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80225e:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802263:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802267:	0f 84 43 01 00 00    	je     8023b0 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80226d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802270:	8b 06                	mov    (%esi),%eax
+  802272:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802278:	29 c1                	sub    %eax,%ecx
+  80227a:	89 c8                	mov    %ecx,%eax
+  80227c:	f7 e7                	mul    %edi
+  80227e:	c1 ea 0c             	shr    $0xc,%edx
+  802281:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802287:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802289:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80228f:	75 52                	jne    8022e3 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802291:	89 f2                	mov    %esi,%edx
+  802293:	8b 45 08             	mov    0x8(%ebp),%eax
+  802296:	e8 a7 fd ff ff       	call   802042 <_pipeisclosed>
+  80229b:	85 c0                	test   %eax,%eax
+  80229d:	0f 85 28 01 00 00    	jne    8023cb <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8022a3:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022a5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022a8:	8b 06                	mov    (%esi),%eax
+  8022aa:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022b0:	29 c1                	sub    %eax,%ecx
+  8022b2:	89 c8                	mov    %ecx,%eax
+  8022b4:	f7 e7                	mul    %edi
+  8022b6:	c1 ea 0c             	shr    $0xc,%edx
+  8022b9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022bf:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022c1:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022c7:	75 a4                	jne    80226d <devpipe_write+0x2c>
+  8022c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ce:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022d2:	83 ec 04             	sub    $0x4,%esp
+  8022d5:	6a ff                	push   $0xffffffff
+  8022d7:	53                   	push   %ebx
+  8022d8:	56                   	push   %esi
+  8022d9:	e8 c3 e2 ff ff       	call   8005a1 <sys_futex_wait>
+}
+  8022de:	83 c4 10             	add    $0x10,%esp
+  8022e1:	eb 8a                	jmp    80226d <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022e3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022e6:	8b 06                	mov    (%esi),%eax
+  8022e8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022ee:	29 c1                	sub    %eax,%ecx
+  8022f0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022f5:	f7 e1                	mul    %ecx
+  8022f7:	c1 ea 0c             	shr    $0xc,%edx
+  8022fa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802300:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802302:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802307:	89 d8                	mov    %ebx,%eax
+  802309:	29 c8                	sub    %ecx,%eax
+  80230b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80230e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802311:	29 ca                	sub    %ecx,%edx
+  802313:	39 d0                	cmp    %edx,%eax
+  802315:	0f 46 d0             	cmovbe %eax,%edx
+  802318:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80231b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80231e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802323:	f7 e1                	mul    %ecx
+  802325:	c1 ea 0b             	shr    $0xb,%edx
+  802328:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80232e:	89 ca                	mov    %ecx,%edx
+  802330:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802332:	29 d3                	sub    %edx,%ebx
+  802334:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802337:	39 c3                	cmp    %eax,%ebx
+  802339:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80233c:	83 ec 04             	sub    $0x4,%esp
+  80233f:	53                   	push   %ebx
+  802340:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802343:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802346:	51                   	push   %ecx
+  802347:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80234b:	50                   	push   %eax
+  80234c:	e8 0f 10 00 00       	call   803360 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802351:	83 c4 0c             	add    $0xc,%esp
+  802354:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802357:	29 d8                	sub    %ebx,%eax
+  802359:	50                   	push   %eax
+  80235a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80235d:	01 cb                	add    %ecx,%ebx
+  80235f:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802362:	53                   	push   %ebx
+  802363:	8d 46 10             	lea    0x10(%esi),%eax
+  802366:	50                   	push   %eax
+  802367:	e8 f4 0f 00 00       	call   803360 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80236c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80236f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802372:	01 c1                	add    %eax,%ecx
+  802374:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802379:	f7 e1                	mul    %ecx
+  80237b:	c1 ea 0c             	shr    $0xc,%edx
+  80237e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802384:	89 ca                	mov    %ecx,%edx
+  802386:	29 c2                	sub    %eax,%edx
+  802388:	89 56 04             	mov    %edx,0x4(%esi)
+  80238b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802390:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802394:	83 c4 10             	add    $0x10,%esp
+  802397:	85 c0                	test   %eax,%eax
+  802399:	75 1a                	jne    8023b5 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80239b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80239e:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8023a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023a4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023a7:	0f 82 c0 fe ff ff    	jb     80226d <devpipe_write+0x2c>
+  8023ad:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023b0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023b3:	eb 1b                	jmp    8023d0 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023b5:	83 ec 08             	sub    $0x8,%esp
+  8023b8:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023bd:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023c0:	50                   	push   %eax
+  8023c1:	e8 fd e1 ff ff       	call   8005c3 <sys_futex_wake>
+  8023c6:	83 c4 10             	add    $0x10,%esp
+  8023c9:	eb d0                	jmp    80239b <devpipe_write+0x15a>
+				return 0;
+  8023cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d3:	5b                   	pop    %ebx
+  8023d4:	5e                   	pop    %esi
+  8023d5:	5f                   	pop    %edi
+  8023d6:	5d                   	pop    %ebp
+  8023d7:	c3                   	ret
+
+008023d8 <devpipe_stat>:
+{
+  8023d8:	55                   	push   %ebp
+  8023d9:	89 e5                	mov    %esp,%ebp
+  8023db:	56                   	push   %esi
+  8023dc:	53                   	push   %ebx
+  8023dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023e0:	83 ec 0c             	sub    $0xc,%esp
+  8023e3:	ff 75 08             	push   0x8(%ebp)
+  8023e6:	e8 2b e2 ff ff       	call   800616 <fd2data>
+  8023eb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023ed:	83 c4 08             	add    $0x8,%esp
+  8023f0:	68 b2 3b 80 00       	push   $0x803bb2
+  8023f5:	53                   	push   %ebx
+  8023f6:	e8 b5 0d 00 00       	call   8031b0 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8023fb:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8023fe:	8b 06                	mov    (%esi),%eax
+  802400:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802406:	29 c1                	sub    %eax,%ecx
+  802408:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80240d:	89 c8                	mov    %ecx,%eax
+  80240f:	f7 e2                	mul    %edx
+  802411:	c1 ea 0c             	shr    $0xc,%edx
+  802414:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80241a:	29 d1                	sub    %edx,%ecx
+  80241c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802422:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802429:	00 00 00 
+	stat->st_dev = &devpipe;
+  80242c:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  802433:	40 80 00 
+}
+  802436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80243e:	5b                   	pop    %ebx
+  80243f:	5e                   	pop    %esi
+  802440:	5d                   	pop    %ebp
+  802441:	c3                   	ret
+
+00802442 <devpipe_poll>:
+{
+  802442:	55                   	push   %ebp
+  802443:	89 e5                	mov    %esp,%ebp
+  802445:	57                   	push   %edi
+  802446:	56                   	push   %esi
+  802447:	53                   	push   %ebx
+  802448:	83 ec 18             	sub    $0x18,%esp
+  80244b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80244e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802451:	57                   	push   %edi
+  802452:	e8 bf e1 ff ff       	call   800616 <fd2data>
+  802457:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802459:	83 c4 10             	add    $0x10,%esp
+  80245c:	89 f3                	mov    %esi,%ebx
+  80245e:	83 e3 01             	and    $0x1,%ebx
+  802461:	75 27                	jne    80248a <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  802463:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802469:	75 48                	jne    8024b3 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80246b:	89 ca                	mov    %ecx,%edx
+  80246d:	89 f8                	mov    %edi,%eax
+  80246f:	e8 ce fb ff ff       	call   802042 <_pipeisclosed>
+  802474:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  802476:	89 d8                	mov    %ebx,%eax
+  802478:	83 c8 10             	or     $0x10,%eax
+  80247b:	85 d2                	test   %edx,%edx
+  80247d:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802480:	89 d8                	mov    %ebx,%eax
+  802482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802485:	5b                   	pop    %ebx
+  802486:	5e                   	pop    %esi
+  802487:	5f                   	pop    %edi
+  802488:	5d                   	pop    %ebp
+  802489:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80248a:	8b 58 04             	mov    0x4(%eax),%ebx
+  80248d:	8b 00                	mov    (%eax),%eax
+  80248f:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  802495:	29 c3                	sub    %eax,%ebx
+  802497:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80249c:	89 d8                	mov    %ebx,%eax
+  80249e:	f7 e2                	mul    %edx
+  8024a0:	c1 ea 0c             	shr    $0xc,%edx
+  8024a3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024a9:	39 d3                	cmp    %edx,%ebx
+  8024ab:	0f 95 c3             	setne  %bl
+  8024ae:	0f b6 db             	movzbl %bl,%ebx
+  8024b1:	eb b0                	jmp    802463 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024b3:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024b6:	8b 01                	mov    (%ecx),%eax
+  8024b8:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024be:	29 c6                	sub    %eax,%esi
+  8024c0:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024c5:	89 f0                	mov    %esi,%eax
+  8024c7:	f7 e2                	mul    %edx
+  8024c9:	c1 ea 0c             	shr    $0xc,%edx
+  8024cc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024d2:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024d4:	89 d8                	mov    %ebx,%eax
+  8024d6:	83 c8 04             	or     $0x4,%eax
+  8024d9:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8024df:	0f 42 d8             	cmovb  %eax,%ebx
+  8024e2:	eb 87                	jmp    80246b <devpipe_poll+0x29>
+
+008024e4 <pipe>:
+{
+  8024e4:	55                   	push   %ebp
+  8024e5:	89 e5                	mov    %esp,%ebp
+  8024e7:	56                   	push   %esi
+  8024e8:	53                   	push   %ebx
+  8024e9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ef:	50                   	push   %eax
+  8024f0:	e8 38 e1 ff ff       	call   80062d <fd_alloc>
+  8024f5:	89 c3                	mov    %eax,%ebx
+  8024f7:	83 c4 10             	add    $0x10,%esp
+  8024fa:	85 c0                	test   %eax,%eax
+  8024fc:	0f 88 23 01 00 00    	js     802625 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802502:	83 ec 04             	sub    $0x4,%esp
+  802505:	68 07 04 00 00       	push   $0x407
+  80250a:	ff 75 f4             	push   -0xc(%ebp)
+  80250d:	6a 00                	push   $0x0
+  80250f:	e8 8f dc ff ff       	call   8001a3 <sys_page_alloc>
+  802514:	89 c3                	mov    %eax,%ebx
+  802516:	83 c4 10             	add    $0x10,%esp
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	0f 88 04 01 00 00    	js     802625 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802521:	83 ec 0c             	sub    $0xc,%esp
+  802524:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802527:	50                   	push   %eax
+  802528:	e8 00 e1 ff ff       	call   80062d <fd_alloc>
+  80252d:	89 c3                	mov    %eax,%ebx
+  80252f:	83 c4 10             	add    $0x10,%esp
+  802532:	85 c0                	test   %eax,%eax
+  802534:	0f 88 db 00 00 00    	js     802615 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80253a:	83 ec 04             	sub    $0x4,%esp
+  80253d:	68 07 04 00 00       	push   $0x407
+  802542:	ff 75 f0             	push   -0x10(%ebp)
+  802545:	6a 00                	push   $0x0
+  802547:	e8 57 dc ff ff       	call   8001a3 <sys_page_alloc>
+  80254c:	89 c3                	mov    %eax,%ebx
+  80254e:	83 c4 10             	add    $0x10,%esp
+  802551:	85 c0                	test   %eax,%eax
+  802553:	0f 88 bc 00 00 00    	js     802615 <pipe+0x131>
+	va = fd2data(fd0);
+  802559:	83 ec 0c             	sub    $0xc,%esp
+  80255c:	ff 75 f4             	push   -0xc(%ebp)
+  80255f:	e8 b2 e0 ff ff       	call   800616 <fd2data>
+  802564:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802566:	83 c4 0c             	add    $0xc,%esp
+  802569:	68 07 04 00 00       	push   $0x407
+  80256e:	50                   	push   %eax
+  80256f:	6a 00                	push   $0x0
+  802571:	e8 2d dc ff ff       	call   8001a3 <sys_page_alloc>
+  802576:	89 c3                	mov    %eax,%ebx
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	85 c0                	test   %eax,%eax
+  80257d:	0f 88 82 00 00 00    	js     802605 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802583:	83 ec 0c             	sub    $0xc,%esp
+  802586:	ff 75 f0             	push   -0x10(%ebp)
+  802589:	e8 88 e0 ff ff       	call   800616 <fd2data>
+  80258e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802595:	50                   	push   %eax
+  802596:	6a 00                	push   $0x0
+  802598:	56                   	push   %esi
+  802599:	6a 00                	push   $0x0
+  80259b:	e8 46 dc ff ff       	call   8001e6 <sys_page_map>
+  8025a0:	89 c3                	mov    %eax,%ebx
+  8025a2:	83 c4 20             	add    $0x20,%esp
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	78 4e                	js     8025f7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025a9:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025b1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025b3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025b6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025bd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025c0:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025c2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025c5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025cc:	83 ec 0c             	sub    $0xc,%esp
+  8025cf:	ff 75 f4             	push   -0xc(%ebp)
+  8025d2:	e8 2f e0 ff ff       	call   800606 <fd2num>
+  8025d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025da:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025dc:	83 c4 04             	add    $0x4,%esp
+  8025df:	ff 75 f0             	push   -0x10(%ebp)
+  8025e2:	e8 1f e0 ff ff       	call   800606 <fd2num>
+  8025e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025ea:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025ed:	83 c4 10             	add    $0x10,%esp
+  8025f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025f5:	eb 2e                	jmp    802625 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8025f7:	83 ec 08             	sub    $0x8,%esp
+  8025fa:	56                   	push   %esi
+  8025fb:	6a 00                	push   $0x0
+  8025fd:	e8 26 dc ff ff       	call   800228 <sys_page_unmap>
+  802602:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802605:	83 ec 08             	sub    $0x8,%esp
+  802608:	ff 75 f0             	push   -0x10(%ebp)
+  80260b:	6a 00                	push   $0x0
+  80260d:	e8 16 dc ff ff       	call   800228 <sys_page_unmap>
+  802612:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802615:	83 ec 08             	sub    $0x8,%esp
+  802618:	ff 75 f4             	push   -0xc(%ebp)
+  80261b:	6a 00                	push   $0x0
+  80261d:	e8 06 dc ff ff       	call   800228 <sys_page_unmap>
+  802622:	83 c4 10             	add    $0x10,%esp
+}
+  802625:	89 d8                	mov    %ebx,%eax
+  802627:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80262a:	5b                   	pop    %ebx
+  80262b:	5e                   	pop    %esi
+  80262c:	5d                   	pop    %ebp
+  80262d:	c3                   	ret
+
+0080262e <pipeisclosed>:
+{
+  80262e:	55                   	push   %ebp
+  80262f:	89 e5                	mov    %esp,%ebp
+  802631:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802634:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802637:	50                   	push   %eax
+  802638:	ff 75 08             	push   0x8(%ebp)
+  80263b:	e8 3d e0 ff ff       	call   80067d <fd_lookup>
+  802640:	83 c4 10             	add    $0x10,%esp
+  802643:	85 c0                	test   %eax,%eax
+  802645:	78 18                	js     80265f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802647:	83 ec 0c             	sub    $0xc,%esp
+  80264a:	ff 75 f4             	push   -0xc(%ebp)
+  80264d:	e8 c4 df ff ff       	call   800616 <fd2data>
+  802652:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802654:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802657:	e8 e6 f9 ff ff       	call   802042 <_pipeisclosed>
+  80265c:	83 c4 10             	add    $0x10,%esp
+}
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+
+00802661 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  802661:	55                   	push   %ebp
+  802662:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  802664:	8b 45 08             	mov    0x8(%ebp),%eax
+  802667:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+
+0080266f <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80266f:	55                   	push   %ebp
+  802670:	89 e5                	mov    %esp,%ebp
+  802672:	53                   	push   %ebx
+  802673:	83 ec 04             	sub    $0x4,%esp
+  802676:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802679:	8b 03                	mov    (%ebx),%eax
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	75 05                	jne    802684 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80267f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802682:	c9                   	leave
+  802683:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  802684:	83 ec 08             	sub    $0x8,%esp
+  802687:	50                   	push   %eax
+  802688:	8d 43 04             	lea    0x4(%ebx),%eax
+  80268b:	50                   	push   %eax
+  80268c:	e8 e7 dd ff ff       	call   800478 <sys_page_batch>
+	pb->pb_n = 0;
+  802691:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  802697:	83 c4 10             	add    $0x10,%esp
+  80269a:	eb e3                	jmp    80267f <pgbatch_flush+0x10>
+
+0080269c <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80269c:	55                   	push   %ebp
+  80269d:	89 e5                	mov    %esp,%ebp
+  80269f:	56                   	push   %esi
+  8026a0:	53                   	push   %ebx
+  8026a1:	89 c3                	mov    %eax,%ebx
+  8026a3:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026a5:	83 38 20             	cmpl   $0x20,(%eax)
+  8026a8:	74 2c                	je     8026d6 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026aa:	8b 03                	mov    (%ebx),%eax
+  8026ac:	8d 50 01             	lea    0x1(%eax),%edx
+  8026af:	89 13                	mov    %edx,(%ebx)
+  8026b1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026b4:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026b8:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026ba:	83 ec 04             	sub    $0x4,%esp
+  8026bd:	6a 18                	push   $0x18
+  8026bf:	6a 00                	push   $0x0
+  8026c1:	50                   	push   %eax
+  8026c2:	e8 64 0c 00 00       	call   80332b <memset>
+	return 0;
+  8026c7:	83 c4 10             	add    $0x10,%esp
+  8026ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026d2:	5b                   	pop    %ebx
+  8026d3:	5e                   	pop    %esi
+  8026d4:	5d                   	pop    %ebp
+  8026d5:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026d6:	83 ec 0c             	sub    $0xc,%esp
+  8026d9:	50                   	push   %eax
+  8026da:	e8 90 ff ff ff       	call   80266f <pgbatch_flush>
+  8026df:	83 c4 10             	add    $0x10,%esp
+  8026e2:	85 c0                	test   %eax,%eax
+  8026e4:	79 c4                	jns    8026aa <pgbatch_slot+0xe>
+  8026e6:	eb e7                	jmp    8026cf <pgbatch_slot+0x33>
+
+008026e8 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8026e8:	55                   	push   %ebp
+  8026e9:	89 e5                	mov    %esp,%ebp
+  8026eb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8026ee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f4:	e8 a3 ff ff ff       	call   80269c <pgbatch_slot>
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	78 20                	js     80271d <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8026fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802700:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  802706:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802709:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80270c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80270f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802712:	8b 55 14             	mov    0x14(%ebp),%edx
+  802715:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802718:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80271d:	c9                   	leave
+  80271e:	c3                   	ret
+
+0080271f <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80271f:	55                   	push   %ebp
+  802720:	89 e5                	mov    %esp,%ebp
+  802722:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802725:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802728:	8b 45 08             	mov    0x8(%ebp),%eax
+  80272b:	e8 6c ff ff ff       	call   80269c <pgbatch_slot>
+  802730:	85 c0                	test   %eax,%eax
+  802732:	78 2c                	js     802760 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  802734:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802737:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80273d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802740:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  802743:	8b 55 10             	mov    0x10(%ebp),%edx
+  802746:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802749:	8b 55 14             	mov    0x14(%ebp),%edx
+  80274c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80274f:	8b 55 18             	mov    0x18(%ebp),%edx
+  802752:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802755:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802758:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80275b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802760:	c9                   	leave
+  802761:	c3                   	ret
+
+00802762 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  802762:	55                   	push   %ebp
+  802763:	89 e5                	mov    %esp,%ebp
+  802765:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802768:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80276b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276e:	e8 29 ff ff ff       	call   80269c <pgbatch_slot>
+  802773:	85 c0                	test   %eax,%eax
+  802775:	78 1a                	js     802791 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  802777:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80277a:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  802780:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802783:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802786:	8b 55 10             	mov    0x10(%ebp),%edx
+  802789:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80278c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802791:	c9                   	leave
+  802792:	c3                   	ret
+
+00802793 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802799:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80279c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279f:	e8 f8 fe ff ff       	call   80269c <pgbatch_slot>
+  8027a4:	85 c0                	test   %eax,%eax
+  8027a6:	78 20                	js     8027c8 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027ab:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027b4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027b7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027ba:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027bd:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027c0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027c8:	c9                   	leave
+  8027c9:	c3                   	ret
+
+008027ca <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027d0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d6:	e8 c1 fe ff ff       	call   80269c <pgbatch_slot>
+  8027db:	85 c0                	test   %eax,%eax
+  8027dd:	78 26                	js     802805 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8027df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027e2:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8027e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027eb:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8027ee:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027f1:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8027f4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027f7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8027fa:	8b 55 18             	mov    0x18(%ebp),%edx
+  8027fd:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802800:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802805:	c9                   	leave
+  802806:	c3                   	ret
+
+00802807 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280c:	c3                   	ret
+
+0080280d <devcons_poll>:
+{
+  80280d:	55                   	push   %ebp
+  80280e:	89 e5                	mov    %esp,%ebp
+  802810:	53                   	push   %ebx
+  802811:	83 ec 04             	sub    $0x4,%esp
+  802814:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802817:	89 da                	mov    %ebx,%edx
+  802819:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80281c:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  802823:	74 0c                	je     802831 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802825:	89 d8                	mov    %ebx,%eax
+  802827:	83 e0 01             	and    $0x1,%eax
+  80282a:	09 d0                	or     %edx,%eax
+}
+  80282c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80282f:	c9                   	leave
+  802830:	c3                   	ret
+		cons_peek = sys_cgetc();
+  802831:	e8 cf d8 ff ff       	call   800105 <sys_cgetc>
+  802836:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80283b:	89 da                	mov    %ebx,%edx
+  80283d:	83 e2 04             	and    $0x4,%edx
+  802840:	85 c0                	test   %eax,%eax
+  802842:	74 e6                	je     80282a <devcons_poll+0x1d>
+  802844:	eb df                	jmp    802825 <devcons_poll+0x18>
+
+00802846 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802846:	55                   	push   %ebp
+  802847:	89 e5                	mov    %esp,%ebp
+  802849:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80284c:	68 be 3b 80 00       	push   $0x803bbe
+  802851:	ff 75 0c             	push   0xc(%ebp)
+  802854:	e8 57 09 00 00       	call   8031b0 <strcpy>
+	return 0;
+}
+  802859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285e:	c9                   	leave
+  80285f:	c3                   	ret
+
+00802860 <devcons_write>:
+{
+  802860:	55                   	push   %ebp
+  802861:	89 e5                	mov    %esp,%ebp
+  802863:	57                   	push   %edi
+  802864:	56                   	push   %esi
+  802865:	53                   	push   %ebx
+  802866:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80286c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80286f:	85 ff                	test   %edi,%edi
+  802871:	74 51                	je     8028c4 <devcons_write+0x64>
+  802873:	be 00 00 00 00       	mov    $0x0,%esi
+  802878:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80287d:	89 fb                	mov    %edi,%ebx
+  80287f:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  802881:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802886:	39 d3                	cmp    %edx,%ebx
+  802888:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80288b:	83 ec 04             	sub    $0x4,%esp
+  80288e:	53                   	push   %ebx
+  80288f:	03 45 0c             	add    0xc(%ebp),%eax
+  802892:	50                   	push   %eax
+  802893:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802899:	50                   	push   %eax
+  80289a:	e8 c1 0a 00 00       	call   803360 <memmove>
+		sys_cputs(buf, m);
+  80289f:	83 c4 08             	add    $0x8,%esp
+  8028a2:	53                   	push   %ebx
+  8028a3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028a9:	50                   	push   %eax
+  8028aa:	e8 38 d8 ff ff       	call   8000e7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028af:	01 de                	add    %ebx,%esi
+  8028b1:	89 f0                	mov    %esi,%eax
+  8028b3:	83 c4 10             	add    $0x10,%esp
+  8028b6:	39 fe                	cmp    %edi,%esi
+  8028b8:	72 c3                	jb     80287d <devcons_write+0x1d>
+}
+  8028ba:	89 f0                	mov    %esi,%eax
+  8028bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028bf:	5b                   	pop    %ebx
+  8028c0:	5e                   	pop    %esi
+  8028c1:	5f                   	pop    %edi
+  8028c2:	5d                   	pop    %ebp
+  8028c3:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028c4:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028c9:	eb ef                	jmp    8028ba <devcons_write+0x5a>
+
+008028cb <devcons_read>:
+{
+  8028cb:	55                   	push   %ebp
+  8028cc:	89 e5                	mov    %esp,%ebp
+  8028ce:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028d1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028d6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028da:	74 36                	je     802912 <devcons_read+0x47>
+	c = cons_peek;
+  8028dc:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8028e1:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8028e8:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028eb:	85 c0                	test   %eax,%eax
+  8028ed:	75 10                	jne    8028ff <devcons_read+0x34>
+  8028ef:	e8 11 d8 ff ff       	call   800105 <sys_cgetc>
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	75 07                	jne    8028ff <devcons_read+0x34>
+		sys_yield();
+  8028f8:	e8 87 d8 ff ff       	call   800184 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028fd:	eb f0                	jmp    8028ef <devcons_read+0x24>
+	if (c < 0)
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	78 0f                	js     802912 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  802903:	83 f8 04             	cmp    $0x4,%eax
+  802906:	74 0c                	je     802914 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802908:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80290b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80290d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802912:	c9                   	leave
+  802913:	c3                   	ret
+		return 0;
+  802914:	b8 00 00 00 00       	mov    $0x0,%eax
+  802919:	eb f7                	jmp    802912 <devcons_read+0x47>
+
+0080291b <cputchar>:
+{
+  80291b:	55                   	push   %ebp
+  80291c:	89 e5                	mov    %esp,%ebp
+  80291e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802921:	8b 45 08             	mov    0x8(%ebp),%eax
+  802924:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802927:	6a 01                	push   $0x1
+  802929:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80292c:	50                   	push   %eax
+  80292d:	e8 b5 d7 ff ff       	call   8000e7 <sys_cputs>
+}
+  802932:	83 c4 10             	add    $0x10,%esp
+  802935:	c9                   	leave
+  802936:	c3                   	ret
+
+00802937 <getchar>:
+{
+  802937:	55                   	push   %ebp
+  802938:	89 e5                	mov    %esp,%ebp
+  80293a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80293d:	6a 01                	push   $0x1
+  80293f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802942:	50                   	push   %eax
+  802943:	6a 00                	push   $0x0
+  802945:	e8 b7 df ff ff       	call   800901 <read>
+	if (r < 0)
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 06                	js     802957 <getchar+0x20>
+	if (r < 1)
+  802951:	74 06                	je     802959 <getchar+0x22>
+	return c;
+  802953:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802957:	c9                   	leave
+  802958:	c3                   	ret
+		return -E_EOF;
+  802959:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80295e:	eb f7                	jmp    802957 <getchar+0x20>
+
+00802960 <iscons>:
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802966:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802969:	50                   	push   %eax
+  80296a:	ff 75 08             	push   0x8(%ebp)
+  80296d:	e8 0b dd ff ff       	call   80067d <fd_lookup>
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	85 c0                	test   %eax,%eax
+  802977:	78 11                	js     80298a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80297c:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802982:	39 10                	cmp    %edx,(%eax)
+  802984:	0f 94 c0             	sete   %al
+  802987:	0f b6 c0             	movzbl %al,%eax
+}
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <opencons>:
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802992:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802995:	50                   	push   %eax
+  802996:	e8 92 dc ff ff       	call   80062d <fd_alloc>
+  80299b:	83 c4 10             	add    $0x10,%esp
+  80299e:	85 c0                	test   %eax,%eax
+  8029a0:	78 3a                	js     8029dc <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029a2:	83 ec 04             	sub    $0x4,%esp
+  8029a5:	68 07 04 00 00       	push   $0x407
+  8029aa:	ff 75 f4             	push   -0xc(%ebp)
+  8029ad:	6a 00                	push   $0x0
+  8029af:	e8 ef d7 ff ff       	call   8001a3 <sys_page_alloc>
+  8029b4:	83 c4 10             	add    $0x10,%esp
+  8029b7:	85 c0                	test   %eax,%eax
+  8029b9:	78 21                	js     8029dc <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029be:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029c4:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029d0:	83 ec 0c             	sub    $0xc,%esp
+  8029d3:	50                   	push   %eax
+  8029d4:	e8 2d dc ff ff       	call   800606 <fd2num>
+  8029d9:	83 c4 10             	add    $0x10,%esp
+}
+  8029dc:	c9                   	leave
+  8029dd:	c3                   	ret
+
+008029de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029de:	55                   	push   %ebp
+  8029df:	89 e5                	mov    %esp,%ebp
+  8029e1:	56                   	push   %esi
+  8029e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029e6:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8029ec:	e8 74 d7 ff ff       	call   800165 <sys_getenvid>
+  8029f1:	83 ec 0c             	sub    $0xc,%esp
+  8029f4:	ff 75 0c             	push   0xc(%ebp)
+  8029f7:	ff 75 08             	push   0x8(%ebp)
+  8029fa:	56                   	push   %esi
+  8029fb:	50                   	push   %eax
+  8029fc:	68 cc 3b 80 00       	push   $0x803bcc
+  802a01:	e8 b3 00 00 00       	call   802ab9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802a06:	83 c4 18             	add    $0x18,%esp
+  802a09:	53                   	push   %ebx
+  802a0a:	ff 75 10             	push   0x10(%ebp)
+  802a0d:	e8 56 00 00 00       	call   802a68 <vcprintf>
+	cprintf("\n");
+  802a12:	c7 04 24 b0 3b 80 00 	movl   $0x803bb0,(%esp)
+  802a19:	e8 9b 00 00 00       	call   802ab9 <cprintf>
+  802a1e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a21:	cc                   	int3
+	while (1)
+  802a22:	eb fd                	jmp    802a21 <_panic+0x43>
+
+00802a24 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a24:	55                   	push   %ebp
+  802a25:	89 e5                	mov    %esp,%ebp
+  802a27:	53                   	push   %ebx
+  802a28:	83 ec 04             	sub    $0x4,%esp
+  802a2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a2e:	8b 13                	mov    (%ebx),%edx
+  802a30:	8d 42 01             	lea    0x1(%edx),%eax
+  802a33:	89 03                	mov    %eax,(%ebx)
+  802a35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a38:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a3c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a41:	74 09                	je     802a4c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a43:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a4a:	c9                   	leave
+  802a4b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a4c:	83 ec 08             	sub    $0x8,%esp
+  802a4f:	68 ff 00 00 00       	push   $0xff
+  802a54:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a57:	50                   	push   %eax
+  802a58:	e8 8a d6 ff ff       	call   8000e7 <sys_cputs>
+		b->idx = 0;
+  802a5d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a63:	83 c4 10             	add    $0x10,%esp
+  802a66:	eb db                	jmp    802a43 <putch+0x1f>
+
+00802a68 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a71:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a78:	00 00 00 
+	b.cnt = 0;
+  802a7b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802a82:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802a85:	ff 75 0c             	push   0xc(%ebp)
+  802a88:	ff 75 08             	push   0x8(%ebp)
+  802a8b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802a91:	50                   	push   %eax
+  802a92:	68 24 2a 80 00       	push   $0x802a24
+  802a97:	e8 1c 01 00 00       	call   802bb8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802a9c:	83 c4 08             	add    $0x8,%esp
+  802a9f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802aa5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802aab:	50                   	push   %eax
+  802aac:	e8 36 d6 ff ff       	call   8000e7 <sys_cputs>
+
+	return b.cnt;
+}
+  802ab1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+
+00802ab9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802abf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802ac2:	50                   	push   %eax
+  802ac3:	ff 75 08             	push   0x8(%ebp)
+  802ac6:	e8 9d ff ff ff       	call   802a68 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802acb:	c9                   	leave
+  802acc:	c3                   	ret
+
+00802acd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802acd:	55                   	push   %ebp
+  802ace:	89 e5                	mov    %esp,%ebp
+  802ad0:	57                   	push   %edi
+  802ad1:	56                   	push   %esi
+  802ad2:	53                   	push   %ebx
+  802ad3:	83 ec 1c             	sub    $0x1c,%esp
+  802ad6:	89 c3                	mov    %eax,%ebx
+  802ad8:	89 d6                	mov    %edx,%esi
+  802ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  802add:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ae0:	89 d1                	mov    %edx,%ecx
+  802ae2:	89 c2                	mov    %eax,%edx
+  802ae4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ae7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802aea:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802aed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802af0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802af7:	39 c2                	cmp    %eax,%edx
+  802af9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802afc:	73 4b                	jae    802b49 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802afe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b01:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b04:	85 ff                	test   %edi,%edi
+  802b06:	7e 11                	jle    802b19 <printnum+0x4c>
+			putch(padc, putdat);
+  802b08:	83 ec 08             	sub    $0x8,%esp
+  802b0b:	56                   	push   %esi
+  802b0c:	ff 75 18             	push   0x18(%ebp)
+  802b0f:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b11:	83 c4 10             	add    $0x10,%esp
+  802b14:	83 ef 01             	sub    $0x1,%edi
+  802b17:	75 ef                	jne    802b08 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b19:	83 ec 08             	sub    $0x8,%esp
+  802b1c:	56                   	push   %esi
+  802b1d:	83 ec 04             	sub    $0x4,%esp
+  802b20:	ff 75 e4             	push   -0x1c(%ebp)
+  802b23:	ff 75 e0             	push   -0x20(%ebp)
+  802b26:	ff 75 dc             	push   -0x24(%ebp)
+  802b29:	ff 75 d8             	push   -0x28(%ebp)
+  802b2c:	e8 33 0e 00 00       	call   803964 <__umoddi3>
+  802b31:	83 c4 14             	add    $0x14,%esp
+  802b34:	0f be 80 ef 3b 80 00 	movsbl 0x803bef(%eax),%eax
+  802b3b:	50                   	push   %eax
+  802b3c:	ff d3                	call   *%ebx
+}
+  802b3e:	83 c4 10             	add    $0x10,%esp
+  802b41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b44:	5b                   	pop    %ebx
+  802b45:	5e                   	pop    %esi
+  802b46:	5f                   	pop    %edi
+  802b47:	5d                   	pop    %ebp
+  802b48:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b49:	83 ec 0c             	sub    $0xc,%esp
+  802b4c:	ff 75 18             	push   0x18(%ebp)
+  802b4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b52:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b55:	52                   	push   %edx
+  802b56:	50                   	push   %eax
+  802b57:	83 ec 08             	sub    $0x8,%esp
+  802b5a:	ff 75 e4             	push   -0x1c(%ebp)
+  802b5d:	ff 75 e0             	push   -0x20(%ebp)
+  802b60:	ff 75 dc             	push   -0x24(%ebp)
+  802b63:	ff 75 d8             	push   -0x28(%ebp)
+  802b66:	e8 33 0d 00 00       	call   80389e <__udivdi3>
+  802b6b:	83 c4 18             	add    $0x18,%esp
+  802b6e:	52                   	push   %edx
+  802b6f:	50                   	push   %eax
+  802b70:	89 f2                	mov    %esi,%edx
+  802b72:	89 d8                	mov    %ebx,%eax
+  802b74:	e8 54 ff ff ff       	call   802acd <printnum>
+  802b79:	83 c4 20             	add    $0x20,%esp
+  802b7c:	eb 9b                	jmp    802b19 <printnum+0x4c>
+
+00802b7e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802b7e:	55                   	push   %ebp
+  802b7f:	89 e5                	mov    %esp,%ebp
+  802b81:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802b84:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802b88:	8b 10                	mov    (%eax),%edx
+  802b8a:	3b 50 04             	cmp    0x4(%eax),%edx
+  802b8d:	73 0a                	jae    802b99 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802b8f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802b92:	89 08                	mov    %ecx,(%eax)
+  802b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b97:	88 02                	mov    %al,(%edx)
+}
+  802b99:	5d                   	pop    %ebp
+  802b9a:	c3                   	ret
+
+00802b9b <printfmt>:
+{
+  802b9b:	55                   	push   %ebp
+  802b9c:	89 e5                	mov    %esp,%ebp
+  802b9e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802ba1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802ba4:	50                   	push   %eax
+  802ba5:	ff 75 10             	push   0x10(%ebp)
+  802ba8:	ff 75 0c             	push   0xc(%ebp)
+  802bab:	ff 75 08             	push   0x8(%ebp)
+  802bae:	e8 05 00 00 00       	call   802bb8 <vprintfmt>
+}
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	c9                   	leave
+  802bb7:	c3                   	ret
+
+00802bb8 <vprintfmt>:
+{
+  802bb8:	55                   	push   %ebp
+  802bb9:	89 e5                	mov    %esp,%ebp
+  802bbb:	57                   	push   %edi
+  802bbc:	56                   	push   %esi
+  802bbd:	53                   	push   %ebx
+  802bbe:	83 ec 2c             	sub    $0x2c,%esp
+  802bc1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bc4:	89 df                	mov    %ebx,%edi
+  802bc6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bc9:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bcc:	8d 70 01             	lea    0x1(%eax),%esi
+  802bcf:	0f b6 00             	movzbl (%eax),%eax
+  802bd2:	83 f8 25             	cmp    $0x25,%eax
+  802bd5:	74 1e                	je     802bf5 <vprintfmt+0x3d>
+			if (ch == '\0')
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	0f 84 15 05 00 00    	je     8030f4 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802bdf:	83 ec 08             	sub    $0x8,%esp
+  802be2:	53                   	push   %ebx
+  802be3:	50                   	push   %eax
+  802be4:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802be6:	83 c6 01             	add    $0x1,%esi
+  802be9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802bed:	83 c4 10             	add    $0x10,%esp
+  802bf0:	83 f8 25             	cmp    $0x25,%eax
+  802bf3:	75 e2                	jne    802bd7 <vprintfmt+0x1f>
+		padc = ' ';
+  802bf5:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802bf9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802c00:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802c07:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c13:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c16:	8d 56 01             	lea    0x1(%esi),%edx
+  802c19:	0f b6 0e             	movzbl (%esi),%ecx
+  802c1c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c1f:	3c 55                	cmp    $0x55,%al
+  802c21:	0f 87 3b 04 00 00    	ja     803062 <vprintfmt+0x4aa>
+  802c27:	0f b6 c0             	movzbl %al,%eax
+  802c2a:	ff 24 85 60 3d 80 00 	jmp    *0x803d60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c31:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c34:	eb 93                	jmp    802bc9 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c36:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c38:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c3c:	eb d8                	jmp    802c16 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c3e:	89 d6                	mov    %edx,%esi
+  802c40:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c44:	eb d0                	jmp    802c16 <vprintfmt+0x5e>
+  802c46:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c49:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c4c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c4f:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c53:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c56:	83 f9 09             	cmp    $0x9,%ecx
+  802c59:	77 6f                	ja     802cca <vprintfmt+0x112>
+  802c5b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c5e:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c61:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c64:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c68:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c6b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c6e:	83 fe 09             	cmp    $0x9,%esi
+  802c71:	76 eb                	jbe    802c5e <vprintfmt+0xa6>
+  802c73:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c76:	89 d6                	mov    %edx,%esi
+  802c78:	eb 13                	jmp    802c8d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802c7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c7d:	8b 00                	mov    (%eax),%eax
+  802c7f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c82:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c85:	8d 40 04             	lea    0x4(%eax),%eax
+  802c88:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c8b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802c8d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802c91:	79 83                	jns    802c16 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802c93:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c99:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802ca0:	e9 71 ff ff ff       	jmp    802c16 <vprintfmt+0x5e>
+			if (width < 0)
+  802ca5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ca8:	85 c9                	test   %ecx,%ecx
+  802caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802caf:	0f 49 c1             	cmovns %ecx,%eax
+  802cb2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cb5:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cb7:	e9 5a ff ff ff       	jmp    802c16 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cbc:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cbe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cc5:	e9 4c ff ff ff       	jmp    802c16 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cca:	89 d6                	mov    %edx,%esi
+  802ccc:	eb bf                	jmp    802c8d <vprintfmt+0xd5>
+			lflag++;
+  802cce:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cd2:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cd4:	e9 3d ff ff ff       	jmp    802c16 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802cd9:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cdc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cdf:	8d 70 04             	lea    0x4(%eax),%esi
+  802ce2:	83 ec 08             	sub    $0x8,%esp
+  802ce5:	53                   	push   %ebx
+  802ce6:	ff 30                	push   (%eax)
+  802ce8:	ff d7                	call   *%edi
+			break;
+  802cea:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802ced:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802cf0:	e9 d4 fe ff ff       	jmp    802bc9 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802cf5:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cf8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cfb:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802cfe:	8b 10                	mov    (%eax),%edx
+  802d00:	89 d0                	mov    %edx,%eax
+  802d02:	f7 d8                	neg    %eax
+  802d04:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802d07:	83 f8 12             	cmp    $0x12,%eax
+  802d0a:	7f 23                	jg     802d2f <vprintfmt+0x177>
+  802d0c:	8b 14 85 c0 3e 80 00 	mov    0x803ec0(,%eax,4),%edx
+  802d13:	85 d2                	test   %edx,%edx
+  802d15:	74 18                	je     802d2f <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d17:	52                   	push   %edx
+  802d18:	68 7b 3b 80 00       	push   $0x803b7b
+  802d1d:	53                   	push   %ebx
+  802d1e:	57                   	push   %edi
+  802d1f:	e8 77 fe ff ff       	call   802b9b <printfmt>
+  802d24:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d27:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d2a:	e9 9a fe ff ff       	jmp    802bc9 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d2f:	50                   	push   %eax
+  802d30:	68 07 3c 80 00       	push   $0x803c07
+  802d35:	53                   	push   %ebx
+  802d36:	57                   	push   %edi
+  802d37:	e8 5f fe ff ff       	call   802b9b <printfmt>
+  802d3c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d3f:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d42:	e9 82 fe ff ff       	jmp    802bc9 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d47:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d4d:	83 c0 04             	add    $0x4,%eax
+  802d50:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d53:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d56:	8b 00                	mov    (%eax),%eax
+  802d58:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d5b:	85 c0                	test   %eax,%eax
+  802d5d:	0f 84 61 03 00 00    	je     8030c4 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d63:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d67:	7e 06                	jle    802d6f <vprintfmt+0x1b7>
+  802d69:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d6d:	75 29                	jne    802d98 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d6f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d72:	8d 70 01             	lea    0x1(%eax),%esi
+  802d75:	0f b6 00             	movzbl (%eax),%eax
+  802d78:	0f be d0             	movsbl %al,%edx
+  802d7b:	85 d2                	test   %edx,%edx
+  802d7d:	0f 84 bb 00 00 00    	je     802e3e <vprintfmt+0x286>
+  802d83:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802d86:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802d89:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802d8c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d8f:	eb 7a                	jmp    802e0b <vprintfmt+0x253>
+				p = "(null)";
+  802d91:	c7 45 d0 00 3c 80 00 	movl   $0x803c00,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802d98:	83 ec 08             	sub    $0x8,%esp
+  802d9b:	ff 75 d4             	push   -0x2c(%ebp)
+  802d9e:	ff 75 d0             	push   -0x30(%ebp)
+  802da1:	e8 e0 03 00 00       	call   803186 <strnlen>
+  802da6:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802da9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802dac:	83 c4 10             	add    $0x10,%esp
+  802daf:	85 d2                	test   %edx,%edx
+  802db1:	0f 8e d6 02 00 00    	jle    80308d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802db7:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802dbb:	83 ec 08             	sub    $0x8,%esp
+  802dbe:	53                   	push   %ebx
+  802dbf:	56                   	push   %esi
+  802dc0:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dc2:	83 c4 10             	add    $0x10,%esp
+  802dc5:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802dc9:	75 f0                	jne    802dbb <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dcb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dce:	8d 70 01             	lea    0x1(%eax),%esi
+  802dd1:	0f b6 00             	movzbl (%eax),%eax
+  802dd4:	0f be d0             	movsbl %al,%edx
+  802dd7:	85 d2                	test   %edx,%edx
+  802dd9:	0f 84 da 02 00 00    	je     8030b9 <vprintfmt+0x501>
+  802ddf:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802de2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802de5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802de8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802deb:	eb 1e                	jmp    802e0b <vprintfmt+0x253>
+					putch(ch, putdat);
+  802ded:	83 ec 08             	sub    $0x8,%esp
+  802df0:	ff 75 0c             	push   0xc(%ebp)
+  802df3:	52                   	push   %edx
+  802df4:	ff 55 08             	call   *0x8(%ebp)
+  802df7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dfa:	83 eb 01             	sub    $0x1,%ebx
+  802dfd:	83 c6 01             	add    $0x1,%esi
+  802e00:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e04:	0f be d0             	movsbl %al,%edx
+  802e07:	85 d2                	test   %edx,%edx
+  802e09:	74 2a                	je     802e35 <vprintfmt+0x27d>
+  802e0b:	85 ff                	test   %edi,%edi
+  802e0d:	78 05                	js     802e14 <vprintfmt+0x25c>
+  802e0f:	83 ef 01             	sub    $0x1,%edi
+  802e12:	78 59                	js     802e6d <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e14:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e18:	74 d3                	je     802ded <vprintfmt+0x235>
+  802e1a:	0f be c0             	movsbl %al,%eax
+  802e1d:	83 e8 20             	sub    $0x20,%eax
+  802e20:	83 f8 5e             	cmp    $0x5e,%eax
+  802e23:	76 c8                	jbe    802ded <vprintfmt+0x235>
+					putch('?', putdat);
+  802e25:	83 ec 08             	sub    $0x8,%esp
+  802e28:	ff 75 0c             	push   0xc(%ebp)
+  802e2b:	6a 3f                	push   $0x3f
+  802e2d:	ff 55 08             	call   *0x8(%ebp)
+  802e30:	83 c4 10             	add    $0x10,%esp
+  802e33:	eb c5                	jmp    802dfa <vprintfmt+0x242>
+  802e35:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e38:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e3b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e3e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e41:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e45:	7e 1b                	jle    802e62 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e47:	83 ec 08             	sub    $0x8,%esp
+  802e4a:	53                   	push   %ebx
+  802e4b:	6a 20                	push   $0x20
+  802e4d:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e4f:	83 c4 10             	add    $0x10,%esp
+  802e52:	83 ee 01             	sub    $0x1,%esi
+  802e55:	75 f0                	jne    802e47 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e57:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e5a:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e5d:	e9 67 fd ff ff       	jmp    802bc9 <vprintfmt+0x11>
+  802e62:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e65:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e68:	e9 5c fd ff ff       	jmp    802bc9 <vprintfmt+0x11>
+  802e6d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e70:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e76:	eb c6                	jmp    802e3e <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e78:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802e7b:	89 55 10             	mov    %edx,0x10(%ebp)
+  802e7e:	83 f9 01             	cmp    $0x1,%ecx
+  802e81:	7f 1f                	jg     802ea2 <vprintfmt+0x2ea>
+	else if (lflag)
+  802e83:	85 c9                	test   %ecx,%ecx
+  802e85:	74 67                	je     802eee <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802e87:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e8a:	8b 30                	mov    (%eax),%esi
+  802e8c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802e8f:	89 f0                	mov    %esi,%eax
+  802e91:	c1 f8 1f             	sar    $0x1f,%eax
+  802e94:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802e97:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9a:	8d 40 04             	lea    0x4(%eax),%eax
+  802e9d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ea0:	eb 17                	jmp    802eb9 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802ea2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea5:	8b 50 04             	mov    0x4(%eax),%edx
+  802ea8:	8b 00                	mov    (%eax),%eax
+  802eaa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ead:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802eb0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eb3:	8d 40 08             	lea    0x8(%eax),%eax
+  802eb6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802eb9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ebc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802ebf:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802ec4:	85 c9                	test   %ecx,%ecx
+  802ec6:	0f 89 12 01 00 00    	jns    802fde <vprintfmt+0x426>
+				putch('-', putdat);
+  802ecc:	83 ec 08             	sub    $0x8,%esp
+  802ecf:	53                   	push   %ebx
+  802ed0:	6a 2d                	push   $0x2d
+  802ed2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802ed4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ed7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802eda:	f7 da                	neg    %edx
+  802edc:	83 d1 00             	adc    $0x0,%ecx
+  802edf:	f7 d9                	neg    %ecx
+  802ee1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802ee4:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ee9:	e9 f0 00 00 00       	jmp    802fde <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802eee:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ef1:	8b 30                	mov    (%eax),%esi
+  802ef3:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802ef6:	89 f0                	mov    %esi,%eax
+  802ef8:	c1 f8 1f             	sar    $0x1f,%eax
+  802efb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802efe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f01:	8d 40 04             	lea    0x4(%eax),%eax
+  802f04:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f07:	eb b0                	jmp    802eb9 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f09:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f0c:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f0f:	83 f9 01             	cmp    $0x1,%ecx
+  802f12:	7f 1e                	jg     802f32 <vprintfmt+0x37a>
+	else if (lflag)
+  802f14:	85 c9                	test   %ecx,%ecx
+  802f16:	74 32                	je     802f4a <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f18:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f1b:	8b 10                	mov    (%eax),%edx
+  802f1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f22:	8d 40 04             	lea    0x4(%eax),%eax
+  802f25:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f28:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f2d:	e9 ac 00 00 00       	jmp    802fde <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f32:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f35:	8b 10                	mov    (%eax),%edx
+  802f37:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f3a:	8d 40 08             	lea    0x8(%eax),%eax
+  802f3d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f40:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f45:	e9 94 00 00 00       	jmp    802fde <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f4d:	8b 10                	mov    (%eax),%edx
+  802f4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f54:	8d 40 04             	lea    0x4(%eax),%eax
+  802f57:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f5a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f5f:	eb 7d                	jmp    802fde <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f61:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f64:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f67:	83 f9 01             	cmp    $0x1,%ecx
+  802f6a:	7f 1b                	jg     802f87 <vprintfmt+0x3cf>
+	else if (lflag)
+  802f6c:	85 c9                	test   %ecx,%ecx
+  802f6e:	74 2c                	je     802f9c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f70:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f73:	8b 10                	mov    (%eax),%edx
+  802f75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f7a:	8d 40 04             	lea    0x4(%eax),%eax
+  802f7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f80:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802f85:	eb 57                	jmp    802fde <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f87:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f8a:	8b 10                	mov    (%eax),%edx
+  802f8c:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f8f:	8d 40 08             	lea    0x8(%eax),%eax
+  802f92:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f95:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802f9a:	eb 42                	jmp    802fde <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f9f:	8b 10                	mov    (%eax),%edx
+  802fa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fa6:	8d 40 04             	lea    0x4(%eax),%eax
+  802fa9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fac:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fb1:	eb 2b                	jmp    802fde <vprintfmt+0x426>
+			putch('0', putdat);
+  802fb3:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fb6:	83 ec 08             	sub    $0x8,%esp
+  802fb9:	53                   	push   %ebx
+  802fba:	6a 30                	push   $0x30
+  802fbc:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fbe:	83 c4 08             	add    $0x8,%esp
+  802fc1:	53                   	push   %ebx
+  802fc2:	6a 78                	push   $0x78
+  802fc4:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc9:	8b 10                	mov    (%eax),%edx
+  802fcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802fd0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802fd3:	8d 40 04             	lea    0x4(%eax),%eax
+  802fd6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802fd9:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  802fde:	83 ec 0c             	sub    $0xc,%esp
+  802fe1:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802fe5:	50                   	push   %eax
+  802fe6:	ff 75 e4             	push   -0x1c(%ebp)
+  802fe9:	56                   	push   %esi
+  802fea:	51                   	push   %ecx
+  802feb:	52                   	push   %edx
+  802fec:	89 da                	mov    %ebx,%edx
+  802fee:	89 f8                	mov    %edi,%eax
+  802ff0:	e8 d8 fa ff ff       	call   802acd <printnum>
+			break;
+  802ff5:	83 c4 20             	add    $0x20,%esp
+  802ff8:	e9 cc fb ff ff       	jmp    802bc9 <vprintfmt+0x11>
+	if (lflag >= 2)
+  802ffd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803000:	89 55 10             	mov    %edx,0x10(%ebp)
+  803003:	83 f9 01             	cmp    $0x1,%ecx
+  803006:	7f 1b                	jg     803023 <vprintfmt+0x46b>
+	else if (lflag)
+  803008:	85 c9                	test   %ecx,%ecx
+  80300a:	74 2c                	je     803038 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80300c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80300f:	8b 10                	mov    (%eax),%edx
+  803011:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803016:	8d 40 04             	lea    0x4(%eax),%eax
+  803019:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80301c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  803021:	eb bb                	jmp    802fde <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  803023:	8b 45 14             	mov    0x14(%ebp),%eax
+  803026:	8b 10                	mov    (%eax),%edx
+  803028:	8b 48 04             	mov    0x4(%eax),%ecx
+  80302b:	8d 40 08             	lea    0x8(%eax),%eax
+  80302e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803031:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  803036:	eb a6                	jmp    802fde <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803038:	8b 45 14             	mov    0x14(%ebp),%eax
+  80303b:	8b 10                	mov    (%eax),%edx
+  80303d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803042:	8d 40 04             	lea    0x4(%eax),%eax
+  803045:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803048:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80304d:	eb 8f                	jmp    802fde <vprintfmt+0x426>
+			putch(ch, putdat);
+  80304f:	89 55 10             	mov    %edx,0x10(%ebp)
+  803052:	83 ec 08             	sub    $0x8,%esp
+  803055:	53                   	push   %ebx
+  803056:	6a 25                	push   $0x25
+  803058:	ff d7                	call   *%edi
+			break;
+  80305a:	83 c4 10             	add    $0x10,%esp
+  80305d:	e9 67 fb ff ff       	jmp    802bc9 <vprintfmt+0x11>
+			putch('%', putdat);
+  803062:	83 ec 08             	sub    $0x8,%esp
+  803065:	53                   	push   %ebx
+  803066:	6a 25                	push   $0x25
+  803068:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80306a:	83 c4 10             	add    $0x10,%esp
+  80306d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  803071:	0f 84 ba fb ff ff    	je     802c31 <vprintfmt+0x79>
+  803077:	89 75 10             	mov    %esi,0x10(%ebp)
+  80307a:	89 f0                	mov    %esi,%eax
+  80307c:	83 e8 01             	sub    $0x1,%eax
+  80307f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  803083:	75 f7                	jne    80307c <vprintfmt+0x4c4>
+  803085:	89 45 10             	mov    %eax,0x10(%ebp)
+  803088:	e9 3c fb ff ff       	jmp    802bc9 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80308d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803090:	8d 70 01             	lea    0x1(%eax),%esi
+  803093:	0f b6 00             	movzbl (%eax),%eax
+  803096:	0f be d0             	movsbl %al,%edx
+  803099:	85 d2                	test   %edx,%edx
+  80309b:	74 11                	je     8030ae <vprintfmt+0x4f6>
+  80309d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030a0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030a3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030a6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030a9:	e9 5d fd ff ff       	jmp    802e0b <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030ae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030b1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030b4:	e9 10 fb ff ff       	jmp    802bc9 <vprintfmt+0x11>
+  8030b9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030bf:	e9 05 fb ff ff       	jmp    802bc9 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030c4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030c8:	7e 0a                	jle    8030d4 <vprintfmt+0x51c>
+  8030ca:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030ce:	0f 85 bd fc ff ff    	jne    802d91 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030d4:	ba 28 00 00 00       	mov    $0x28,%edx
+  8030d9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8030de:	be 01 3c 80 00       	mov    $0x803c01,%esi
+  8030e3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030e6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030e9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030ec:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030ef:	e9 17 fd ff ff       	jmp    802e0b <vprintfmt+0x253>
+}
+  8030f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f7:	5b                   	pop    %ebx
+  8030f8:	5e                   	pop    %esi
+  8030f9:	5f                   	pop    %edi
+  8030fa:	5d                   	pop    %ebp
+  8030fb:	c3                   	ret
+
+008030fc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8030fc:	55                   	push   %ebp
+  8030fd:	89 e5                	mov    %esp,%ebp
+  8030ff:	83 ec 18             	sub    $0x18,%esp
+  803102:	8b 45 08             	mov    0x8(%ebp),%eax
+  803105:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803108:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80310b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80310f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803112:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	74 26                	je     803143 <vsnprintf+0x47>
+  80311d:	85 d2                	test   %edx,%edx
+  80311f:	7e 22                	jle    803143 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803121:	ff 75 14             	push   0x14(%ebp)
+  803124:	ff 75 10             	push   0x10(%ebp)
+  803127:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80312a:	50                   	push   %eax
+  80312b:	68 7e 2b 80 00       	push   $0x802b7e
+  803130:	e8 83 fa ff ff       	call   802bb8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803135:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803138:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80313b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80313e:	83 c4 10             	add    $0x10,%esp
+}
+  803141:	c9                   	leave
+  803142:	c3                   	ret
+		return -E_INVAL;
+  803143:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803148:	eb f7                	jmp    803141 <vsnprintf+0x45>
+
+0080314a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80314a:	55                   	push   %ebp
+  80314b:	89 e5                	mov    %esp,%ebp
+  80314d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803150:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803153:	50                   	push   %eax
+  803154:	ff 75 10             	push   0x10(%ebp)
+  803157:	ff 75 0c             	push   0xc(%ebp)
+  80315a:	ff 75 08             	push   0x8(%ebp)
+  80315d:	e8 9a ff ff ff       	call   8030fc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803162:	c9                   	leave
+  803163:	c3                   	ret
+
+00803164 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803164:	55                   	push   %ebp
+  803165:	89 e5                	mov    %esp,%ebp
+  803167:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80316a:	80 3a 00             	cmpb   $0x0,(%edx)
+  80316d:	74 10                	je     80317f <strlen+0x1b>
+  80316f:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  803174:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803177:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80317b:	75 f7                	jne    803174 <strlen+0x10>
+	return n;
+}
+  80317d:	5d                   	pop    %ebp
+  80317e:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80317f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  803184:	eb f7                	jmp    80317d <strlen+0x19>
+
+00803186 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803186:	55                   	push   %ebp
+  803187:	89 e5                	mov    %esp,%ebp
+  803189:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80318c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80318f:	85 d2                	test   %edx,%edx
+  803191:	74 16                	je     8031a9 <strnlen+0x23>
+  803193:	b8 00 00 00 00       	mov    $0x0,%eax
+  803198:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80319c:	74 09                	je     8031a7 <strnlen+0x21>
+		n++;
+  80319e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031a1:	39 d0                	cmp    %edx,%eax
+  8031a3:	75 f3                	jne    803198 <strnlen+0x12>
+		n++;
+  8031a5:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8031a7:	5d                   	pop    %ebp
+  8031a8:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ae:	eb f7                	jmp    8031a7 <strnlen+0x21>
+
+008031b0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031b0:	55                   	push   %ebp
+  8031b1:	89 e5                	mov    %esp,%ebp
+  8031b3:	53                   	push   %ebx
+  8031b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031c3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031c6:	83 c0 01             	add    $0x1,%eax
+  8031c9:	84 d2                	test   %dl,%dl
+  8031cb:	75 f2                	jne    8031bf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031cd:	89 c8                	mov    %ecx,%eax
+  8031cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031d2:	c9                   	leave
+  8031d3:	c3                   	ret
+
+008031d4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031d4:	55                   	push   %ebp
+  8031d5:	89 e5                	mov    %esp,%ebp
+  8031d7:	53                   	push   %ebx
+  8031d8:	83 ec 10             	sub    $0x10,%esp
+  8031db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8031de:	53                   	push   %ebx
+  8031df:	e8 80 ff ff ff       	call   803164 <strlen>
+  8031e4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8031e7:	ff 75 0c             	push   0xc(%ebp)
+  8031ea:	01 d8                	add    %ebx,%eax
+  8031ec:	50                   	push   %eax
+  8031ed:	e8 be ff ff ff       	call   8031b0 <strcpy>
+	return dst;
+}
+  8031f2:	89 d8                	mov    %ebx,%eax
+  8031f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031f7:	c9                   	leave
+  8031f8:	c3                   	ret
+
+008031f9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8031f9:	55                   	push   %ebp
+  8031fa:	89 e5                	mov    %esp,%ebp
+  8031fc:	56                   	push   %esi
+  8031fd:	53                   	push   %ebx
+  8031fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  803201:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803204:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  803207:	85 db                	test   %ebx,%ebx
+  803209:	74 17                	je     803222 <strncpy+0x29>
+  80320b:	01 f3                	add    %esi,%ebx
+  80320d:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80320f:	83 c0 01             	add    $0x1,%eax
+  803212:	0f b6 0a             	movzbl (%edx),%ecx
+  803215:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803218:	80 f9 01             	cmp    $0x1,%cl
+  80321b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80321e:	39 c3                	cmp    %eax,%ebx
+  803220:	75 ed                	jne    80320f <strncpy+0x16>
+	}
+	return ret;
+}
+  803222:	89 f0                	mov    %esi,%eax
+  803224:	5b                   	pop    %ebx
+  803225:	5e                   	pop    %esi
+  803226:	5d                   	pop    %ebp
+  803227:	c3                   	ret
+
+00803228 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803228:	55                   	push   %ebp
+  803229:	89 e5                	mov    %esp,%ebp
+  80322b:	56                   	push   %esi
+  80322c:	53                   	push   %ebx
+  80322d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803230:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803233:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803236:	89 f0                	mov    %esi,%eax
+  803238:	85 db                	test   %ebx,%ebx
+  80323a:	74 1e                	je     80325a <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  80323c:	83 eb 01             	sub    $0x1,%ebx
+  80323f:	74 16                	je     803257 <strlcpy+0x2f>
+  803241:	01 f3                	add    %esi,%ebx
+  803243:	0f b6 0a             	movzbl (%edx),%ecx
+  803246:	84 c9                	test   %cl,%cl
+  803248:	74 0d                	je     803257 <strlcpy+0x2f>
+			*dst++ = *src++;
+  80324a:	83 c2 01             	add    $0x1,%edx
+  80324d:	83 c0 01             	add    $0x1,%eax
+  803250:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  803253:	39 d8                	cmp    %ebx,%eax
+  803255:	75 ec                	jne    803243 <strlcpy+0x1b>
+		*dst = '\0';
+  803257:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80325a:	29 f0                	sub    %esi,%eax
+}
+  80325c:	5b                   	pop    %ebx
+  80325d:	5e                   	pop    %esi
+  80325e:	5d                   	pop    %ebp
+  80325f:	c3                   	ret
+
+00803260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803260:	55                   	push   %ebp
+  803261:	89 e5                	mov    %esp,%ebp
+  803263:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803266:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803269:	0f b6 01             	movzbl (%ecx),%eax
+  80326c:	84 c0                	test   %al,%al
+  80326e:	74 11                	je     803281 <strcmp+0x21>
+  803270:	38 02                	cmp    %al,(%edx)
+  803272:	75 0d                	jne    803281 <strcmp+0x21>
+		p++, q++;
+  803274:	83 c1 01             	add    $0x1,%ecx
+  803277:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80327a:	0f b6 01             	movzbl (%ecx),%eax
+  80327d:	84 c0                	test   %al,%al
+  80327f:	75 ef                	jne    803270 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803281:	0f b6 c0             	movzbl %al,%eax
+  803284:	0f b6 12             	movzbl (%edx),%edx
+  803287:	29 d0                	sub    %edx,%eax
+}
+  803289:	5d                   	pop    %ebp
+  80328a:	c3                   	ret
+
+0080328b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80328b:	55                   	push   %ebp
+  80328c:	89 e5                	mov    %esp,%ebp
+  80328e:	53                   	push   %ebx
+  80328f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803292:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803295:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  803298:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  80329d:	85 d2                	test   %edx,%edx
+  80329f:	74 2e                	je     8032cf <strncmp+0x44>
+  8032a1:	0f b6 01             	movzbl (%ecx),%eax
+  8032a4:	84 c0                	test   %al,%al
+  8032a6:	74 16                	je     8032be <strncmp+0x33>
+  8032a8:	3a 03                	cmp    (%ebx),%al
+  8032aa:	75 12                	jne    8032be <strncmp+0x33>
+		n--, p++, q++;
+  8032ac:	83 c1 01             	add    $0x1,%ecx
+  8032af:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032b2:	83 ea 01             	sub    $0x1,%edx
+  8032b5:	75 ea                	jne    8032a1 <strncmp+0x16>
+		return 0;
+  8032b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032bc:	eb 11                	jmp    8032cf <strncmp+0x44>
+  8032be:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032c3:	85 d2                	test   %edx,%edx
+  8032c5:	74 08                	je     8032cf <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032c7:	0f b6 01             	movzbl (%ecx),%eax
+  8032ca:	0f b6 13             	movzbl (%ebx),%edx
+  8032cd:	29 d0                	sub    %edx,%eax
+}
+  8032cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032d2:	c9                   	leave
+  8032d3:	c3                   	ret
+
+008032d4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032d4:	55                   	push   %ebp
+  8032d5:	89 e5                	mov    %esp,%ebp
+  8032d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032da:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8032de:	0f b6 10             	movzbl (%eax),%edx
+  8032e1:	84 d2                	test   %dl,%dl
+  8032e3:	74 15                	je     8032fa <strchr+0x26>
+		if (*s == c)
+  8032e5:	38 d1                	cmp    %dl,%cl
+  8032e7:	74 0f                	je     8032f8 <strchr+0x24>
+	for (; *s; s++)
+  8032e9:	83 c0 01             	add    $0x1,%eax
+  8032ec:	0f b6 10             	movzbl (%eax),%edx
+  8032ef:	84 d2                	test   %dl,%dl
+  8032f1:	75 f2                	jne    8032e5 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8032f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f8:	5d                   	pop    %ebp
+  8032f9:	c3                   	ret
+	return 0;
+  8032fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ff:	eb f7                	jmp    8032f8 <strchr+0x24>
+
+00803301 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  803301:	55                   	push   %ebp
+  803302:	89 e5                	mov    %esp,%ebp
+  803304:	53                   	push   %ebx
+  803305:	8b 45 08             	mov    0x8(%ebp),%eax
+  803308:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  80330b:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  80330e:	38 d3                	cmp    %dl,%bl
+  803310:	74 14                	je     803326 <strfind+0x25>
+  803312:	89 d1                	mov    %edx,%ecx
+  803314:	84 db                	test   %bl,%bl
+  803316:	74 0e                	je     803326 <strfind+0x25>
+	for (; *s; s++)
+  803318:	83 c0 01             	add    $0x1,%eax
+  80331b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80331e:	38 ca                	cmp    %cl,%dl
+  803320:	74 04                	je     803326 <strfind+0x25>
+  803322:	84 d2                	test   %dl,%dl
+  803324:	75 f2                	jne    803318 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  803326:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803329:	c9                   	leave
+  80332a:	c3                   	ret
+
+0080332b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80332b:	55                   	push   %ebp
+  80332c:	89 e5                	mov    %esp,%ebp
+  80332e:	57                   	push   %edi
+  80332f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803332:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  803335:	85 c9                	test   %ecx,%ecx
+  803337:	74 20                	je     803359 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803339:	89 f8                	mov    %edi,%eax
+  80333b:	09 c8                	or     %ecx,%eax
+  80333d:	a8 03                	test   $0x3,%al
+  80333f:	75 12                	jne    803353 <memset+0x28>
+		c &= 0xFF;
+  803341:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803345:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80334b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80334e:	fc                   	cld
+  80334f:	f3 ab                	rep stos %eax,%es:(%edi)
+  803351:	eb 06                	jmp    803359 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  803353:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803356:	fc                   	cld
+  803357:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803359:	89 f8                	mov    %edi,%eax
+  80335b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80335e:	c9                   	leave
+  80335f:	c3                   	ret
+
+00803360 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803360:	55                   	push   %ebp
+  803361:	89 e5                	mov    %esp,%ebp
+  803363:	57                   	push   %edi
+  803364:	56                   	push   %esi
+  803365:	8b 45 08             	mov    0x8(%ebp),%eax
+  803368:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80336b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80336e:	39 c6                	cmp    %eax,%esi
+  803370:	73 32                	jae    8033a4 <memmove+0x44>
+  803372:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803375:	39 d0                	cmp    %edx,%eax
+  803377:	73 2b                	jae    8033a4 <memmove+0x44>
+		s += n;
+		d += n;
+  803379:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80337c:	89 d6                	mov    %edx,%esi
+  80337e:	09 fe                	or     %edi,%esi
+  803380:	09 ce                	or     %ecx,%esi
+  803382:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803388:	75 0e                	jne    803398 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80338a:	83 ef 04             	sub    $0x4,%edi
+  80338d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803390:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803393:	fd                   	std
+  803394:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803396:	eb 09                	jmp    8033a1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803398:	83 ef 01             	sub    $0x1,%edi
+  80339b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80339e:	fd                   	std
+  80339f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8033a1:	fc                   	cld
+  8033a2:	eb 1a                	jmp    8033be <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033a4:	89 f2                	mov    %esi,%edx
+  8033a6:	09 c2                	or     %eax,%edx
+  8033a8:	09 ca                	or     %ecx,%edx
+  8033aa:	f6 c2 03             	test   $0x3,%dl
+  8033ad:	75 0a                	jne    8033b9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033af:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033b2:	89 c7                	mov    %eax,%edi
+  8033b4:	fc                   	cld
+  8033b5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033b7:	eb 05                	jmp    8033be <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033b9:	89 c7                	mov    %eax,%edi
+  8033bb:	fc                   	cld
+  8033bc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033be:	5e                   	pop    %esi
+  8033bf:	5f                   	pop    %edi
+  8033c0:	5d                   	pop    %ebp
+  8033c1:	c3                   	ret
+
+008033c2 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033c2:	55                   	push   %ebp
+  8033c3:	89 e5                	mov    %esp,%ebp
+  8033c5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033c8:	ff 75 10             	push   0x10(%ebp)
+  8033cb:	ff 75 0c             	push   0xc(%ebp)
+  8033ce:	ff 75 08             	push   0x8(%ebp)
+  8033d1:	e8 8a ff ff ff       	call   803360 <memmove>
+}
+  8033d6:	c9                   	leave
+  8033d7:	c3                   	ret
+
+008033d8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033d8:	55                   	push   %ebp
+  8033d9:	89 e5                	mov    %esp,%ebp
+  8033db:	56                   	push   %esi
+  8033dc:	53                   	push   %ebx
+  8033dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033e3:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8033e6:	85 f6                	test   %esi,%esi
+  8033e8:	74 29                	je     803413 <memcmp+0x3b>
+  8033ea:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8033ec:	0f b6 08             	movzbl (%eax),%ecx
+  8033ef:	0f b6 1a             	movzbl (%edx),%ebx
+  8033f2:	38 d9                	cmp    %bl,%cl
+  8033f4:	75 11                	jne    803407 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8033f6:	83 c0 01             	add    $0x1,%eax
+  8033f9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8033fc:	39 c6                	cmp    %eax,%esi
+  8033fe:	75 ec                	jne    8033ec <memcmp+0x14>
+	}
+
+	return 0;
+  803400:	b8 00 00 00 00       	mov    $0x0,%eax
+  803405:	eb 08                	jmp    80340f <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  803407:	0f b6 c1             	movzbl %cl,%eax
+  80340a:	0f b6 db             	movzbl %bl,%ebx
+  80340d:	29 d8                	sub    %ebx,%eax
+}
+  80340f:	5b                   	pop    %ebx
+  803410:	5e                   	pop    %esi
+  803411:	5d                   	pop    %ebp
+  803412:	c3                   	ret
+	return 0;
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+  803418:	eb f5                	jmp    80340f <memcmp+0x37>
+
+0080341a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803423:	89 c2                	mov    %eax,%edx
+  803425:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803428:	39 d0                	cmp    %edx,%eax
+  80342a:	73 0d                	jae    803439 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80342c:	38 08                	cmp    %cl,(%eax)
+  80342e:	74 0d                	je     80343d <memfind+0x23>
+	for (; s < ends; s++)
+  803430:	83 c0 01             	add    $0x1,%eax
+  803433:	39 c2                	cmp    %eax,%edx
+  803435:	75 f5                	jne    80342c <memfind+0x12>
+  803437:	eb 06                	jmp    80343f <memfind+0x25>
+  803439:	89 c2                	mov    %eax,%edx
+  80343b:	eb 02                	jmp    80343f <memfind+0x25>
+  80343d:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  80343f:	89 d0                	mov    %edx,%eax
+  803441:	5d                   	pop    %ebp
+  803442:	c3                   	ret
+
+00803443 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803443:	55                   	push   %ebp
+  803444:	89 e5                	mov    %esp,%ebp
+  803446:	57                   	push   %edi
+  803447:	56                   	push   %esi
+  803448:	53                   	push   %ebx
+  803449:	8b 55 08             	mov    0x8(%ebp),%edx
+  80344c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80344f:	0f b6 02             	movzbl (%edx),%eax
+  803452:	3c 20                	cmp    $0x20,%al
+  803454:	74 04                	je     80345a <strtol+0x17>
+  803456:	3c 09                	cmp    $0x9,%al
+  803458:	75 0e                	jne    803468 <strtol+0x25>
+		s++;
+  80345a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80345d:	0f b6 02             	movzbl (%edx),%eax
+  803460:	3c 20                	cmp    $0x20,%al
+  803462:	74 f6                	je     80345a <strtol+0x17>
+  803464:	3c 09                	cmp    $0x9,%al
+  803466:	74 f2                	je     80345a <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  803468:	3c 2b                	cmp    $0x2b,%al
+  80346a:	74 2a                	je     803496 <strtol+0x53>
+	int neg = 0;
+  80346c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803471:	3c 2d                	cmp    $0x2d,%al
+  803473:	74 2b                	je     8034a0 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803475:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80347b:	75 0f                	jne    80348c <strtol+0x49>
+  80347d:	80 3a 30             	cmpb   $0x30,(%edx)
+  803480:	74 28                	je     8034aa <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803482:	85 db                	test   %ebx,%ebx
+  803484:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803489:	0f 44 d8             	cmove  %eax,%ebx
+  80348c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803491:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803494:	eb 46                	jmp    8034dc <strtol+0x99>
+		s++;
+  803496:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803499:	bf 00 00 00 00       	mov    $0x0,%edi
+  80349e:	eb d5                	jmp    803475 <strtol+0x32>
+		s++, neg = 1;
+  8034a0:	83 c2 01             	add    $0x1,%edx
+  8034a3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034a8:	eb cb                	jmp    803475 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034aa:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034ae:	74 0e                	je     8034be <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034b0:	85 db                	test   %ebx,%ebx
+  8034b2:	75 d8                	jne    80348c <strtol+0x49>
+		s++, base = 8;
+  8034b4:	83 c2 01             	add    $0x1,%edx
+  8034b7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034bc:	eb ce                	jmp    80348c <strtol+0x49>
+		s += 2, base = 16;
+  8034be:	83 c2 02             	add    $0x2,%edx
+  8034c1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034c6:	eb c4                	jmp    80348c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034c8:	0f be c0             	movsbl %al,%eax
+  8034cb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034ce:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034d1:	7d 3a                	jge    80350d <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034d3:	83 c2 01             	add    $0x1,%edx
+  8034d6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8034da:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8034dc:	0f b6 02             	movzbl (%edx),%eax
+  8034df:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8034e2:	89 f3                	mov    %esi,%ebx
+  8034e4:	80 fb 09             	cmp    $0x9,%bl
+  8034e7:	76 df                	jbe    8034c8 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8034e9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8034ec:	89 f3                	mov    %esi,%ebx
+  8034ee:	80 fb 19             	cmp    $0x19,%bl
+  8034f1:	77 08                	ja     8034fb <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8034f3:	0f be c0             	movsbl %al,%eax
+  8034f6:	83 e8 57             	sub    $0x57,%eax
+  8034f9:	eb d3                	jmp    8034ce <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8034fb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8034fe:	89 f3                	mov    %esi,%ebx
+  803500:	80 fb 19             	cmp    $0x19,%bl
+  803503:	77 08                	ja     80350d <strtol+0xca>
+			dig = *s - 'A' + 10;
+  803505:	0f be c0             	movsbl %al,%eax
+  803508:	83 e8 37             	sub    $0x37,%eax
+  80350b:	eb c1                	jmp    8034ce <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80350d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803511:	74 05                	je     803518 <strtol+0xd5>
+		*endptr = (char *) s;
+  803513:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803516:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803518:	89 c8                	mov    %ecx,%eax
+  80351a:	f7 d8                	neg    %eax
+  80351c:	85 ff                	test   %edi,%edi
+  80351e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803521:	89 c8                	mov    %ecx,%eax
+  803523:	5b                   	pop    %ebx
+  803524:	5e                   	pop    %esi
+  803525:	5f                   	pop    %edi
+  803526:	5d                   	pop    %ebp
+  803527:	c3                   	ret
+
+00803528 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803528:	55                   	push   %ebp
+  803529:	89 e5                	mov    %esp,%ebp
+  80352b:	56                   	push   %esi
+  80352c:	53                   	push   %ebx
+  80352d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803530:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803533:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803536:	85 c0                	test   %eax,%eax
+  803538:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80353d:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803540:	83 ec 0c             	sub    $0xc,%esp
+  803543:	50                   	push   %eax
+  803544:	e8 0a ce ff ff       	call   800353 <sys_ipc_recv>
+  803549:	83 c4 10             	add    $0x10,%esp
+  80354c:	85 c0                	test   %eax,%eax
+  80354e:	0f 88 8b 00 00 00    	js     8035df <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803554:	85 f6                	test   %esi,%esi
+  803556:	74 2a                	je     803582 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803558:	89 e2                	mov    %esp,%edx
+  80355a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80355f:	29 d0                	sub    %edx,%eax
+  803561:	89 c2                	mov    %eax,%edx
+  803563:	c1 ea 0f             	shr    $0xf,%edx
+  803566:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80356b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803570:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803573:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80357a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803580:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803582:	85 db                	test   %ebx,%ebx
+  803584:	74 2a                	je     8035b0 <ipc_recv+0x88>
+  803586:	89 e2                	mov    %esp,%edx
+  803588:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80358d:	29 d0                	sub    %edx,%eax
+  80358f:	89 c2                	mov    %eax,%edx
+  803591:	c1 ea 0f             	shr    $0xf,%edx
+  803594:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035a1:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035a8:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035ae:	89 03                	mov    %eax,(%ebx)
+  8035b0:	89 e2                	mov    %esp,%edx
+  8035b2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035b7:	29 d0                	sub    %edx,%eax
+  8035b9:	89 c2                	mov    %eax,%edx
+  8035bb:	c1 ea 0f             	shr    $0xf,%edx
+  8035be:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c8:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035cb:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035d2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035db:	5b                   	pop    %ebx
+  8035dc:	5e                   	pop    %esi
+  8035dd:	5d                   	pop    %ebp
+  8035de:	c3                   	ret
+		if(from_env_store != NULL)
+  8035df:	85 f6                	test   %esi,%esi
+  8035e1:	74 06                	je     8035e9 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035e3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035e9:	85 db                	test   %ebx,%ebx
+  8035eb:	74 eb                	je     8035d8 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8035f3:	eb e3                	jmp    8035d8 <ipc_recv+0xb0>
+
+008035f5 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8035f5:	55                   	push   %ebp
+  8035f6:	89 e5                	mov    %esp,%ebp
+  8035f8:	57                   	push   %edi
+  8035f9:	56                   	push   %esi
+  8035fa:	53                   	push   %ebx
+  8035fb:	83 ec 14             	sub    $0x14,%esp
+  8035fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803601:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803604:	8b 75 14             	mov    0x14(%ebp),%esi
+  803607:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  80360a:	85 c0                	test   %eax,%eax
+  80360c:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803611:	0f 44 c2             	cmove  %edx,%eax
+  803614:	ff 75 10             	push   0x10(%ebp)
+  803617:	50                   	push   %eax
+  803618:	e8 98 cd ff ff       	call   8003b5 <sys_ipc_recv_pages>
+  80361d:	83 c4 10             	add    $0x10,%esp
+  803620:	85 c0                	test   %eax,%eax
+  803622:	0f 88 ba 00 00 00    	js     8036e2 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803628:	85 ff                	test   %edi,%edi
+  80362a:	74 2a                	je     803656 <ipc_recv_pages+0x61>
+  80362c:	89 e2                	mov    %esp,%edx
+  80362e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803633:	29 d0                	sub    %edx,%eax
+  803635:	89 c2                	mov    %eax,%edx
+  803637:	c1 ea 0f             	shr    $0xf,%edx
+  80363a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80363f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803644:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803647:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80364e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803654:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803656:	85 f6                	test   %esi,%esi
+  803658:	74 2a                	je     803684 <ipc_recv_pages+0x8f>
+  80365a:	89 e2                	mov    %esp,%edx
+  80365c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803661:	29 d0                	sub    %edx,%eax
+  803663:	89 c2                	mov    %eax,%edx
+  803665:	c1 ea 0f             	shr    $0xf,%edx
+  803668:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80366d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803672:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803675:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80367c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803682:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803684:	85 db                	test   %ebx,%ebx
+  803686:	74 2a                	je     8036b2 <ipc_recv_pages+0xbd>
+  803688:	89 e2                	mov    %esp,%edx
+  80368a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80368f:	29 d0                	sub    %edx,%eax
+  803691:	89 c2                	mov    %eax,%edx
+  803693:	c1 ea 0f             	shr    $0xf,%edx
+  803696:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80369b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a0:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036a3:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036aa:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036b0:	89 03                	mov    %eax,(%ebx)
+  8036b2:	89 e2                	mov    %esp,%edx
+  8036b4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036b9:	29 d0                	sub    %edx,%eax
+  8036bb:	89 c2                	mov    %eax,%edx
+  8036bd:	c1 ea 0f             	shr    $0xf,%edx
+  8036c0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ca:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036cd:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036d4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036dd:	5b                   	pop    %ebx
+  8036de:	5e                   	pop    %esi
+  8036df:	5f                   	pop    %edi
+  8036e0:	5d                   	pop    %ebp
+  8036e1:	c3                   	ret
+		if (from_env_store)
+  8036e2:	85 ff                	test   %edi,%edi
+  8036e4:	74 06                	je     8036ec <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036e6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036ec:	85 f6                	test   %esi,%esi
+  8036ee:	74 06                	je     8036f6 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8036f0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8036f6:	85 db                	test   %ebx,%ebx
+  8036f8:	74 e0                	je     8036da <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8036fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803700:	eb d8                	jmp    8036da <ipc_recv_pages+0xe5>
+
+00803702 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803702:	55                   	push   %ebp
+  803703:	89 e5                	mov    %esp,%ebp
+  803705:	57                   	push   %edi
+  803706:	56                   	push   %esi
+  803707:	53                   	push   %ebx
+  803708:	83 ec 1c             	sub    $0x1c,%esp
+  80370b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80370e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803711:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803717:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80371b:	75 2b                	jne    803748 <ipc_try_send_pages+0x46>
+  80371d:	89 e2                	mov    %esp,%edx
+  80371f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803724:	29 d0                	sub    %edx,%eax
+  803726:	89 c2                	mov    %eax,%edx
+  803728:	c1 ea 0f             	shr    $0xf,%edx
+  80372b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803730:	b8 00 00 00 00       	mov    $0x0,%eax
+  803735:	0f 42 c2             	cmovb  %edx,%eax
+  803738:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80373f:	8b 70 48             	mov    0x48(%eax),%esi
+  803742:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803748:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80374e:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803753:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803756:	85 ff                	test   %edi,%edi
+  803758:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80375d:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803760:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803766:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80376c:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803772:	83 ec 0c             	sub    $0xc,%esp
+  803775:	ff 75 14             	push   0x14(%ebp)
+  803778:	ff 75 18             	push   0x18(%ebp)
+  80377b:	57                   	push   %edi
+  80377c:	ff 75 0c             	push   0xc(%ebp)
+  80377f:	ff 75 08             	push   0x8(%ebp)
+  803782:	e8 0d cc ff ff       	call   800394 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803787:	83 c4 20             	add    $0x20,%esp
+  80378a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80378d:	75 21                	jne    8037b0 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80378f:	83 ec 04             	sub    $0x4,%esp
+  803792:	6a ff                	push   $0xffffffff
+  803794:	53                   	push   %ebx
+  803795:	ff 75 e4             	push   -0x1c(%ebp)
+  803798:	e8 04 ce ff ff       	call   8005a1 <sys_futex_wait>
+  80379d:	83 c4 10             	add    $0x10,%esp
+  8037a0:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037a3:	74 c7                	je     80376c <ipc_try_send_pages+0x6a>
+  8037a5:	85 c0                	test   %eax,%eax
+  8037a7:	79 c3                	jns    80376c <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037a9:	e8 d6 c9 ff ff       	call   800184 <sys_yield>
+  8037ae:	eb bc                	jmp    80376c <ipc_try_send_pages+0x6a>
+	}
+}
+  8037b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b3:	5b                   	pop    %ebx
+  8037b4:	5e                   	pop    %esi
+  8037b5:	5f                   	pop    %edi
+  8037b6:	5d                   	pop    %ebp
+  8037b7:	c3                   	ret
+
+008037b8 <ipc_send>:
+{
+  8037b8:	55                   	push   %ebp
+  8037b9:	89 e5                	mov    %esp,%ebp
+  8037bb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037be:	ff 75 14             	push   0x14(%ebp)
+  8037c1:	6a 01                	push   $0x1
+  8037c3:	ff 75 10             	push   0x10(%ebp)
+  8037c6:	ff 75 0c             	push   0xc(%ebp)
+  8037c9:	ff 75 08             	push   0x8(%ebp)
+  8037cc:	e8 31 ff ff ff       	call   803702 <ipc_try_send_pages>
+  8037d1:	83 c4 20             	add    $0x20,%esp
+  8037d4:	85 c0                	test   %eax,%eax
+  8037d6:	78 02                	js     8037da <ipc_send+0x22>
+}
+  8037d8:	c9                   	leave
+  8037d9:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037da:	50                   	push   %eax
+  8037db:	68 2b 3f 80 00       	push   $0x803f2b
+  8037e0:	6a 3f                	push   $0x3f
+  8037e2:	68 40 3f 80 00       	push   $0x803f40
+  8037e7:	e8 f2 f1 ff ff       	call   8029de <_panic>
+
+008037ec <ipc_send_pages>:
+{
+  8037ec:	55                   	push   %ebp
+  8037ed:	89 e5                	mov    %esp,%ebp
+  8037ef:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8037f2:	ff 75 18             	push   0x18(%ebp)
+  8037f5:	ff 75 14             	push   0x14(%ebp)
+  8037f8:	ff 75 10             	push   0x10(%ebp)
+  8037fb:	ff 75 0c             	push   0xc(%ebp)
+  8037fe:	ff 75 08             	push   0x8(%ebp)
+  803801:	e8 fc fe ff ff       	call   803702 <ipc_try_send_pages>
+  803806:	83 c4 20             	add    $0x20,%esp
+  803809:	85 c0                	test   %eax,%eax
+  80380b:	78 02                	js     80380f <ipc_send_pages+0x23>
+}
+  80380d:	c9                   	leave
+  80380e:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80380f:	50                   	push   %eax
+  803810:	68 4a 3f 80 00       	push   $0x803f4a
+  803815:	6a 64                	push   $0x64
+  803817:	68 40 3f 80 00       	push   $0x803f40
+  80381c:	e8 bd f1 ff ff       	call   8029de <_panic>
+
+00803821 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803821:	55                   	push   %ebp
+  803822:	89 e5                	mov    %esp,%ebp
+  803824:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803827:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80382c:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803832:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803838:	8b 52 50             	mov    0x50(%edx),%edx
+  80383b:	39 ca                	cmp    %ecx,%edx
+  80383d:	74 11                	je     803850 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80383f:	83 c0 01             	add    $0x1,%eax
+  803842:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803847:	75 e3                	jne    80382c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384e:	eb 0e                	jmp    80385e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803850:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803856:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80385b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80385e:	5d                   	pop    %ebp
+  80385f:	c3                   	ret
+
+00803860 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803860:	55                   	push   %ebp
+  803861:	89 e5                	mov    %esp,%ebp
+  803863:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803866:	89 c2                	mov    %eax,%edx
+  803868:	c1 ea 16             	shr    $0x16,%edx
+  80386b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803872:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803877:	f6 c1 01             	test   $0x1,%cl
+  80387a:	74 1e                	je     80389a <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80387c:	c1 e8 0c             	shr    $0xc,%eax
+  80387f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803886:	a8 01                	test   $0x1,%al
+  803888:	74 10                	je     80389a <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80388a:	c1 e8 0c             	shr    $0xc,%eax
+  80388d:	c1 e0 04             	shl    $0x4,%eax
+  803890:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803897:	0f b7 d2             	movzwl %dx,%edx
+}
+  80389a:	89 d0                	mov    %edx,%eax
+  80389c:	5d                   	pop    %ebp
+  80389d:	c3                   	ret
+
+0080389e <__udivdi3>:
+  80389e:	57                   	push   %edi
+  80389f:	56                   	push   %esi
+  8038a0:	53                   	push   %ebx
+  8038a1:	83 ec 20             	sub    $0x20,%esp
+  8038a4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038a8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038ac:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038b0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038b4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038b8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038bc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038c0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038c4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038d3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038da:	00 
+  8038db:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038e2:	00 
+  8038e3:	eb 08                	jmp    8038ed <__udivdi3+0x4f>
+  8038e5:	83 e9 01             	sub    $0x1,%ecx
+  8038e8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038eb:	74 68                	je     803955 <__udivdi3+0xb7>
+  8038ed:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038f1:	01 c0                	add    %eax,%eax
+  8038f3:	89 c6                	mov    %eax,%esi
+  8038f5:	89 d7                	mov    %edx,%edi
+  8038f7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038fb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038ff:	0f ad d0             	shrd   %cl,%edx,%eax
+  803902:	d3 ea                	shr    %cl,%edx
+  803904:	f6 c1 20             	test   $0x20,%cl
+  803907:	74 04                	je     80390d <__udivdi3+0x6f>
+  803909:	89 d0                	mov    %edx,%eax
+  80390b:	31 d2                	xor    %edx,%edx
+  80390d:	83 e0 01             	and    $0x1,%eax
+  803910:	89 04 24             	mov    %eax,(%esp)
+  803913:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80391a:	00 
+  80391b:	8b 04 24             	mov    (%esp),%eax
+  80391e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803922:	09 f0                	or     %esi,%eax
+  803924:	09 fa                	or     %edi,%edx
+  803926:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80392a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80392e:	39 f0                	cmp    %esi,%eax
+  803930:	89 d3                	mov    %edx,%ebx
+  803932:	19 fb                	sbb    %edi,%ebx
+  803934:	72 af                	jb     8038e5 <__udivdi3+0x47>
+  803936:	29 f0                	sub    %esi,%eax
+  803938:	19 fa                	sbb    %edi,%edx
+  80393a:	89 cf                	mov    %ecx,%edi
+  80393c:	c1 ef 05             	shr    $0x5,%edi
+  80393f:	83 e7 01             	and    $0x1,%edi
+  803942:	89 fe                	mov    %edi,%esi
+  803944:	83 f6 01             	xor    $0x1,%esi
+  803947:	d3 e6                	shl    %cl,%esi
+  803949:	d3 e7                	shl    %cl,%edi
+  80394b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80394f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803953:	eb 90                	jmp    8038e5 <__udivdi3+0x47>
+  803955:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803959:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80395d:	83 c4 20             	add    $0x20,%esp
+  803960:	5b                   	pop    %ebx
+  803961:	5e                   	pop    %esi
+  803962:	5f                   	pop    %edi
+  803963:	c3                   	ret
+
+00803964 <__umoddi3>:
+  803964:	57                   	push   %edi
+  803965:	56                   	push   %esi
+  803966:	53                   	push   %ebx
+  803967:	83 ec 08             	sub    $0x8,%esp
+  80396a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80396e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803972:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803976:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80397a:	57                   	push   %edi
+  80397b:	56                   	push   %esi
+  80397c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803980:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803984:	52                   	push   %edx
+  803985:	50                   	push   %eax
+  803986:	e8 13 ff ff ff       	call   80389e <__udivdi3>
+  80398b:	89 c3                	mov    %eax,%ebx
+  80398d:	0f af d6             	imul   %esi,%edx
+  803990:	89 f9                	mov    %edi,%ecx
+  803992:	0f af cb             	imul   %ebx,%ecx
+  803995:	01 d1                	add    %edx,%ecx
+  803997:	89 d8                	mov    %ebx,%eax
+  803999:	f7 e6                	mul    %esi
+  80399b:	89 c6                	mov    %eax,%esi
+  80399d:	89 d7                	mov    %edx,%edi
+  80399f:	01 cf                	add    %ecx,%edi
+  8039a1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039a5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039a9:	29 f0                	sub    %esi,%eax
+  8039ab:	19 fa                	sbb    %edi,%edx
+  8039ad:	83 c4 18             	add    $0x18,%esp
+  8039b0:	5b                   	pop    %ebx
+  8039b1:	5e                   	pop    %esi
+  8039b2:	5f                   	pop    %edi
+  8039b3:	c3                   	ret
+
+008039b4 <__divdi3>:
+  8039b4:	53                   	push   %ebx
+  8039b5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039b9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039bd:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039c1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039c5:	85 d2                	test   %edx,%edx
+  8039c7:	78 12                	js     8039db <__divdi3+0x27>
+  8039c9:	85 db                	test   %ebx,%ebx
+  8039cb:	78 2e                	js     8039fb <__divdi3+0x47>
+  8039cd:	53                   	push   %ebx
+  8039ce:	51                   	push   %ecx
+  8039cf:	52                   	push   %edx
+  8039d0:	50                   	push   %eax
+  8039d1:	e8 c8 fe ff ff       	call   80389e <__udivdi3>
+  8039d6:	83 c4 10             	add    $0x10,%esp
+  8039d9:	eb 1e                	jmp    8039f9 <__divdi3+0x45>
+  8039db:	f7 d8                	neg    %eax
+  8039dd:	83 d2 00             	adc    $0x0,%edx
+  8039e0:	f7 da                	neg    %edx
+  8039e2:	85 db                	test   %ebx,%ebx
+  8039e4:	78 2a                	js     803a10 <__divdi3+0x5c>
+  8039e6:	53                   	push   %ebx
+  8039e7:	51                   	push   %ecx
+  8039e8:	52                   	push   %edx
+  8039e9:	50                   	push   %eax
+  8039ea:	e8 af fe ff ff       	call   80389e <__udivdi3>
+  8039ef:	83 c4 10             	add    $0x10,%esp
+  8039f2:	f7 d8                	neg    %eax
+  8039f4:	83 d2 00             	adc    $0x0,%edx
+  8039f7:	f7 da                	neg    %edx
+  8039f9:	5b                   	pop    %ebx
+  8039fa:	c3                   	ret
+  8039fb:	f7 d9                	neg    %ecx
+  8039fd:	83 d3 00             	adc    $0x0,%ebx
+  803a00:	f7 db                	neg    %ebx
+  803a02:	53                   	push   %ebx
+  803a03:	51                   	push   %ecx
+  803a04:	52                   	push   %edx
+  803a05:	50                   	push   %eax
+  803a06:	e8 93 fe ff ff       	call   80389e <__udivdi3>
+  803a0b:	83 c4 10             	add    $0x10,%esp
+  803a0e:	eb e2                	jmp    8039f2 <__divdi3+0x3e>
+  803a10:	f7 d9                	neg    %ecx
+  803a12:	83 d3 00             	adc    $0x0,%ebx
+  803a15:	f7 db                	neg    %ebx
+  803a17:	53                   	push   %ebx
+  803a18:	51                   	push   %ecx
+  803a19:	52                   	push   %edx
+  803a1a:	50                   	push   %eax
+  803a1b:	e8 7e fe ff ff       	call   80389e <__udivdi3>
+  803a20:	83 c4 10             	add    $0x10,%esp
+  803a23:	eb d4                	jmp    8039f9 <__divdi3+0x45>
+
+00803a25 <__moddi3>:
+  803a25:	57                   	push   %edi
+  803a26:	56                   	push   %esi
+  803a27:	53                   	push   %ebx
+  803a28:	83 ec 08             	sub    $0x8,%esp
+  803a2b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a2f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a33:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a37:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a3b:	57                   	push   %edi
+  803a3c:	56                   	push   %esi
+  803a3d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a41:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a45:	52                   	push   %edx
+  803a46:	50                   	push   %eax
+  803a47:	e8 68 ff ff ff       	call   8039b4 <__divdi3>
+  803a4c:	89 c3                	mov    %eax,%ebx
+  803a4e:	0f af d6             	imul   %esi,%edx
+  803a51:	89 f9                	mov    %edi,%ecx
+  803a53:	0f af cb             	imul   %ebx,%ecx
+  803a56:	01 d1                	add    %edx,%ecx
+  803a58:	89 d8                	mov    %ebx,%eax
+  803a5a:	f7 e6                	mul    %esi
+  803a5c:	89 c6                	mov    %eax,%esi
+  803a5e:	89 d7                	mov    %edx,%edi
+  803a60:	01 cf                	add    %ecx,%edi
+  803a62:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a66:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a6a:	29 f0                	sub    %esi,%eax
+  803a6c:	19 fa                	sbb    %edi,%edx
+  803a6e:	83 c4 18             	add    $0x18,%esp
+  803a71:	5b                   	pop    %ebx
+  803a72:	5e                   	pop    %esi
+  803a73:	5f                   	pop    %edi
+  803a74:	c3                   	ret
@@ -0,0 +1,10373 @@
+
+obj/user/forkbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a6 05 00 00       	call   8005d7 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <report_page_tables>:
+// Report how many page tables this env has, and how many of those it
+// shares with other envs: that is most of the kernel memory an env costs
+// beyond the pages it actually uses.
+static void
+report_page_tables(const char *who)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	89 c6                	mov    %eax,%esi
+	int pd, npt = 0, nshared = 0;
+  80003c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800041:	b9 00 00 00 00       	mov    $0x0,%ecx
+
+	for (pd = 0; pd < PDX(UTOP); pd++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004b:	eb 0a                	jmp    800057 <report_page_tables+0x22>
+  80004d:	83 c0 01             	add    $0x1,%eax
+  800050:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  800055:	74 2f                	je     800086 <report_page_tables+0x51>
+		if (vpd[pd] & PTE_P) {
+  800057:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80005e:	f6 c2 01             	test   $0x1,%dl
+  800061:	74 ea                	je     80004d <report_page_tables+0x18>
+			npt++;
+  800063:	83 c1 01             	add    $0x1,%ecx
+			if (pages[PGNUM(vpd[pd])].pp_ref > 1)
+  800066:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80006d:	c1 ea 0c             	shr    $0xc,%edx
+  800070:	c1 e2 04             	shl    $0x4,%edx
+  800073:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  800079:	0f b7 52 04          	movzwl 0x4(%edx),%edx
+				nshared++;
+  80007d:	66 83 fa 02          	cmp    $0x2,%dx
+  800081:	83 db ff             	sbb    $0xffffffff,%ebx
+  800084:	eb c7                	jmp    80004d <report_page_tables+0x18>
+		}
+	cprintf("forkbench: %s has %d page tables, %d of them shared\n",
+  800086:	53                   	push   %ebx
+  800087:	51                   	push   %ecx
+  800088:	56                   	push   %esi
+  800089:	68 e0 52 80 00       	push   $0x8052e0
+  80008e:	e8 c6 06 00 00       	call   800759 <cprintf>
+		who, npt, nshared);
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	57                   	push   %edi
+  8000a1:	56                   	push   %esi
+  8000a2:	53                   	push   %ebx
+  8000a3:	83 ec 4c             	sub    $0x4c,%esp
+	uint64_t t0, fork_cycles, ufork_cycles, spawn_cycles;
+	uint32_t s0, fork_calls, ufork_calls, spawn_calls;
+	int i, r, mapped, cow;
+
+	if (argc > 1) {		// spawned child
+  8000a6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000aa:	7f 22                	jg     8000ce <umain+0x31>
+		if (strcmp(argv[1], "report") == 0)
+			report_page_tables("spawned child");
+		exit();
+	}
+
+	binaryname = "forkbench";
+  8000ac:	c7 05 00 60 84 00 e6 	movl   $0x8053e6,0x846000
+  8000b3:	53 80 00 
+	ballast[0]++;
+  8000b6:	83 05 00 60 80 00 01 	addl   $0x1,0x806000
+	*mapped = *cow = 0;
+  8000bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8000c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8000c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cc:	eb 48                	jmp    800116 <umain+0x79>
+		if (strcmp(argv[1], "report") == 0)
+  8000ce:	83 ec 08             	sub    $0x8,%esp
+  8000d1:	68 d1 53 80 00       	push   $0x8053d1
+  8000d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8000d9:	ff 70 04             	push   0x4(%eax)
+  8000dc:	e8 1f 0e 00 00       	call   800f00 <strcmp>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	74 07                	je     8000ef <umain+0x52>
+		exit();
+  8000e8:	e8 77 05 00 00       	call   800664 <exit>
+  8000ed:	eb bd                	jmp    8000ac <umain+0xf>
+			report_page_tables("spawned child");
+  8000ef:	b8 d8 53 80 00       	mov    $0x8053d8,%eax
+  8000f4:	e8 3c ff ff ff       	call   800035 <report_page_tables>
+  8000f9:	eb ed                	jmp    8000e8 <umain+0x4b>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8000fb:	05 00 00 40 00       	add    $0x400000,%eax
+  800100:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  800105:	2d 00 10 00 00       	sub    $0x1000,%eax
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80010a:	05 00 10 00 00       	add    $0x1000,%eax
+  80010f:	3d ff ef bf ee       	cmp    $0xeebfefff,%eax
+  800114:	77 46                	ja     80015c <umain+0xbf>
+		if (!(vpd[PDX(addr)] & PTE_P)) {
+  800116:	89 c2                	mov    %eax,%edx
+  800118:	c1 ea 16             	shr    $0x16,%edx
+  80011b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800122:	f6 c2 01             	test   $0x1,%dl
+  800125:	74 d4                	je     8000fb <umain+0x5e>
+		if (!(vpt[PGNUM(addr)] & PTE_P))
+  800127:	89 c2                	mov    %eax,%edx
+  800129:	c1 ea 0c             	shr    $0xc,%edx
+  80012c:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+  800133:	f6 c3 01             	test   $0x1,%bl
+  800136:	74 d2                	je     80010a <umain+0x6d>
+		(*mapped)++;
+  800138:	83 c1 01             	add    $0x1,%ecx
+		if (!(vpt[PGNUM(addr)] & PTE_SHARE)
+  80013b:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+  800142:	f6 c7 04             	test   $0x4,%bh
+  800145:	75 c3                	jne    80010a <umain+0x6d>
+		    && (vpt[PGNUM(addr)] & (PTE_W | PTE_COW)))
+  800147:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80014e:	81 e2 02 08 00 00    	and    $0x802,%edx
+			(*cow)++;
+  800154:	83 fa 01             	cmp    $0x1,%edx
+  800157:	83 de ff             	sbb    $0xffffffff,%esi
+  80015a:	eb ae                	jmp    80010a <umain+0x6d>
+	count_pages(&mapped, &cow);
+
+	fork_cycles = 0;
+	fork_calls = 0;
+	for (i = 0; i < NROUNDS; i++) {
+  80015c:	89 4d b8             	mov    %ecx,-0x48(%ebp)
+  80015f:	bf 00 00 00 00       	mov    $0x0,%edi
+	fork_calls = 0;
+  800164:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+	fork_cycles = 0;
+  80016b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  800172:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800179:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80017c:	eb 6e                	jmp    8001ec <umain+0x14f>
+		s0 = thisenv->env_syscalls;
+		t0 = read_tsc();
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  80017e:	50                   	push   %eax
+  80017f:	68 29 54 80 00       	push   $0x805429
+  800184:	6a 7c                	push   $0x7c
+  800186:	68 f0 53 80 00       	push   $0x8053f0
+  80018b:	e8 ee 04 00 00       	call   80067e <_panic>
+		if (r == 0) {
+			if (i == 0)
+				report_page_tables("forked child");
+  800190:	b8 01 54 80 00       	mov    $0x805401,%eax
+  800195:	e8 9b fe ff ff       	call   800035 <report_page_tables>
+			exit();
+  80019a:	e8 c5 04 00 00       	call   800664 <exit>
+
+static __inline uint64_t
+read_tsc(void)
+{
+        uint64_t tsc;
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  80019f:	0f 31                	rdtsc
+		}
+		fork_cycles += read_tsc() - t0;
+  8001a1:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  8001a4:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  8001a7:	01 45 d0             	add    %eax,-0x30(%ebp)
+  8001aa:	11 55 d4             	adc    %edx,-0x2c(%ebp)
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8001ad:	89 e0                	mov    %esp,%eax
+  8001af:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8001b4:	29 c2                	sub    %eax,%edx
+  8001b6:	89 d0                	mov    %edx,%eax
+  8001b8:	c1 e8 0f             	shr    $0xf,%eax
+  8001bb:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8001c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001c6:	0f 43 c1             	cmovae %ecx,%eax
+		fork_calls += thisenv->env_syscalls - s0;
+  8001c9:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8001d0:	8b 40 5c             	mov    0x5c(%eax),%eax
+  8001d3:	29 f0                	sub    %esi,%eax
+  8001d5:	01 45 cc             	add    %eax,-0x34(%ebp)
+		wait(r);
+  8001d8:	83 ec 0c             	sub    $0xc,%esp
+  8001db:	53                   	push   %ebx
+  8001dc:	e8 dd 45 00 00       	call   8047be <wait>
+	for (i = 0; i < NROUNDS; i++) {
+  8001e1:	83 c7 01             	add    $0x1,%edi
+  8001e4:	83 c4 10             	add    $0x10,%esp
+  8001e7:	83 ff 08             	cmp    $0x8,%edi
+  8001ea:	74 50                	je     80023c <umain+0x19f>
+  8001ec:	89 e0                	mov    %esp,%eax
+  8001ee:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8001f3:	29 c2                	sub    %eax,%edx
+  8001f5:	89 d0                	mov    %edx,%eax
+  8001f7:	c1 e8 0f             	shr    $0xf,%eax
+  8001fa:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800200:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800205:	0f 43 c1             	cmovae %ecx,%eax
+		s0 = thisenv->env_syscalls;
+  800208:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  80020f:	8b 70 5c             	mov    0x5c(%eax),%esi
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  800212:	0f 31                	rdtsc
+  800214:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800217:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		if ((r = fork()) < 0)
+  80021a:	e8 6d 16 00 00       	call   80188c <fork>
+  80021f:	89 c3                	mov    %eax,%ebx
+  800221:	85 c0                	test   %eax,%eax
+  800223:	0f 88 55 ff ff ff    	js     80017e <umain+0xe1>
+		if (r == 0) {
+  800229:	0f 85 70 ff ff ff    	jne    80019f <umain+0x102>
+			if (i == 0)
+  80022f:	85 ff                	test   %edi,%edi
+  800231:	0f 85 63 ff ff ff    	jne    80019a <umain+0xfd>
+  800237:	e9 54 ff ff ff       	jmp    800190 <umain+0xf3>
+  80023c:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80023f:	c7 45 bc 08 00 00 00 	movl   $0x8,-0x44(%ebp)
+	}
+
+	// After fork(), which sets up the page fault handler.
+	ufork_cycles = 0;
+	ufork_calls = 0;
+  800246:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+	ufork_cycles = 0;
+  80024d:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+  800254:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+  80025b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800260:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+  800263:	e9 73 01 00 00       	jmp    8003db <umain+0x33e>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  800268:	81 c6 00 00 40 00    	add    $0x400000,%esi
+  80026e:	81 e6 00 00 c0 ff    	and    $0xffc00000,%esi
+  800274:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+			continue;
+  80027a:	eb 2e                	jmp    8002aa <umain+0x20d>
+			r = sys_page_map(0, (void *) addr, envid, (void *) addr,
+  80027c:	83 ec 0c             	sub    $0xc,%esp
+  80027f:	25 07 0e 00 00       	and    $0xe07,%eax
+  800284:	50                   	push   %eax
+  800285:	56                   	push   %esi
+  800286:	57                   	push   %edi
+  800287:	56                   	push   %esi
+  800288:	6a 00                	push   $0x0
+  80028a:	e8 38 10 00 00       	call   8012c7 <sys_page_map>
+  80028f:	83 c4 20             	add    $0x20,%esp
+  800292:	eb 12                	jmp    8002a6 <umain+0x209>
+			r = sys_page_map(0, (void *) addr, envid, (void *) addr,
+  800294:	83 ec 0c             	sub    $0xc,%esp
+  800297:	6a 05                	push   $0x5
+  800299:	56                   	push   %esi
+  80029a:	57                   	push   %edi
+  80029b:	56                   	push   %esi
+  80029c:	6a 00                	push   $0x0
+  80029e:	e8 24 10 00 00       	call   8012c7 <sys_page_map>
+  8002a3:	83 c4 20             	add    $0x20,%esp
+		if (r < 0)
+  8002a6:	85 c0                	test   %eax,%eax
+  8002a8:	78 6b                	js     800315 <umain+0x278>
+	for (addr = 0; addr < UXSTACKTOP - PGSIZE; addr += PGSIZE) {
+  8002aa:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8002b0:	81 fe ff ef bf ee    	cmp    $0xeebfefff,%esi
+  8002b6:	77 6f                	ja     800327 <umain+0x28a>
+		if (!(vpd[PDX(addr)] & PTE_P)) {
+  8002b8:	89 f0                	mov    %esi,%eax
+  8002ba:	c1 e8 16             	shr    $0x16,%eax
+  8002bd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8002c4:	a8 01                	test   $0x1,%al
+  8002c6:	74 a0                	je     800268 <umain+0x1cb>
+		if (!((pte = vpt[PGNUM(addr)]) & PTE_P))
+  8002c8:	89 f0                	mov    %esi,%eax
+  8002ca:	c1 e8 0c             	shr    $0xc,%eax
+  8002cd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8002d4:	a8 01                	test   $0x1,%al
+  8002d6:	74 d2                	je     8002aa <umain+0x20d>
+		if (pte & PTE_SHARE)
+  8002d8:	f6 c4 04             	test   $0x4,%ah
+  8002db:	75 9f                	jne    80027c <umain+0x1df>
+		else if (pte & (PTE_W | PTE_COW)) {
+  8002dd:	a9 02 08 00 00       	test   $0x802,%eax
+  8002e2:	74 b0                	je     800294 <umain+0x1f7>
+			if ((r = sys_page_map(0, (void *) addr, envid,
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	68 05 08 00 00       	push   $0x805
+  8002ec:	56                   	push   %esi
+  8002ed:	57                   	push   %edi
+  8002ee:	56                   	push   %esi
+  8002ef:	6a 00                	push   $0x0
+  8002f1:	e8 d1 0f 00 00       	call   8012c7 <sys_page_map>
+  8002f6:	83 c4 20             	add    $0x20,%esp
+  8002f9:	85 c0                	test   %eax,%eax
+  8002fb:	78 18                	js     800315 <umain+0x278>
+				r = sys_page_map(0, (void *) addr, 0,
+  8002fd:	83 ec 0c             	sub    $0xc,%esp
+  800300:	68 05 08 00 00       	push   $0x805
+  800305:	56                   	push   %esi
+  800306:	6a 00                	push   $0x0
+  800308:	56                   	push   %esi
+  800309:	6a 00                	push   $0x0
+  80030b:	e8 b7 0f 00 00       	call   8012c7 <sys_page_map>
+  800310:	83 c4 20             	add    $0x20,%esp
+  800313:	eb 91                	jmp    8002a6 <umain+0x209>
+			panic("sys_page_map: %e", r);
+  800315:	50                   	push   %eax
+  800316:	68 0e 54 80 00       	push   $0x80540e
+  80031b:	6a 48                	push   $0x48
+  80031d:	68 f0 53 80 00       	push   $0x8053f0
+  800322:	e8 57 03 00 00       	call   80067e <_panic>
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  800327:	83 ec 04             	sub    $0x4,%esp
+  80032a:	6a 07                	push   $0x7
+  80032c:	68 00 f0 bf ee       	push   $0xeebff000
+  800331:	57                   	push   %edi
+  800332:	e8 4d 0f 00 00       	call   801284 <sys_page_alloc>
+  800337:	83 c4 10             	add    $0x10,%esp
+  80033a:	85 c0                	test   %eax,%eax
+  80033c:	0f 88 1e 01 00 00    	js     800460 <umain+0x3c3>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800342:	89 e0                	mov    %esp,%eax
+  800344:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800349:	29 c2                	sub    %eax,%edx
+  80034b:	89 d0                	mov    %edx,%eax
+  80034d:	c1 e8 0f             	shr    $0xf,%eax
+  800350:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800356:	0f 43 c3             	cmovae %ebx,%eax
+					       thisenv->env_pgfault_upcall)) < 0
+  800359:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  800360:	8b 40 78             	mov    0x78(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  800363:	83 ec 08             	sub    $0x8,%esp
+  800366:	50                   	push   %eax
+  800367:	57                   	push   %edi
+  800368:	e8 62 10 00 00       	call   8013cf <sys_env_set_pgfault_upcall>
+  80036d:	83 c4 10             	add    $0x10,%esp
+  800370:	85 c0                	test   %eax,%eax
+  800372:	0f 88 e8 00 00 00    	js     800460 <umain+0x3c3>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  800378:	83 ec 08             	sub    $0x8,%esp
+  80037b:	6a 02                	push   $0x2
+  80037d:	57                   	push   %edi
+  80037e:	e8 c8 0f 00 00       	call   80134b <sys_env_set_status>
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	85 c0                	test   %eax,%eax
+  800388:	0f 88 d2 00 00 00    	js     800460 <umain+0x3c3>
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  80038e:	0f 31                	rdtsc
+		t0 = read_tsc();
+		if ((r = unbatched_fork()) < 0)
+			panic("unbatched fork: %e", r);
+		if (r == 0)
+			exit();
+		ufork_cycles += read_tsc() - t0;
+  800390:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  800393:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+  800396:	01 45 c0             	add    %eax,-0x40(%ebp)
+  800399:	11 55 c4             	adc    %edx,-0x3c(%ebp)
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80039c:	89 e0                	mov    %esp,%eax
+  80039e:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8003a3:	29 c2                	sub    %eax,%edx
+  8003a5:	89 d0                	mov    %edx,%eax
+  8003a7:	c1 e8 0f             	shr    $0xf,%eax
+  8003aa:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8003b0:	0f 43 c3             	cmovae %ebx,%eax
+		ufork_calls += thisenv->env_syscalls - s0;
+  8003b3:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8003ba:	8b 40 5c             	mov    0x5c(%eax),%eax
+  8003bd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8003c0:	29 c8                	sub    %ecx,%eax
+  8003c2:	01 45 c8             	add    %eax,-0x38(%ebp)
+		wait(r);
+  8003c5:	83 ec 0c             	sub    $0xc,%esp
+  8003c8:	57                   	push   %edi
+  8003c9:	e8 f0 43 00 00       	call   8047be <wait>
+	for (i = 0; i < NROUNDS; i++) {
+  8003ce:	83 c4 10             	add    $0x10,%esp
+  8003d1:	83 6d bc 01          	subl   $0x1,-0x44(%ebp)
+  8003d5:	0f 84 97 00 00 00    	je     800472 <umain+0x3d5>
+  8003db:	89 e0                	mov    %esp,%eax
+  8003dd:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8003e2:	29 c2                	sub    %eax,%edx
+  8003e4:	89 d0                	mov    %edx,%eax
+  8003e6:	c1 e8 0f             	shr    $0xf,%eax
+  8003e9:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8003ef:	0f 43 c3             	cmovae %ebx,%eax
+		s0 = thisenv->env_syscalls;
+  8003f2:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8003f9:	8b 40 5c             	mov    0x5c(%eax),%eax
+  8003fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  8003ff:	0f 31                	rdtsc
+  800401:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800404:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	__asm __volatile("int %2"
+  800407:	b8 07 00 00 00       	mov    $0x7,%eax
+  80040c:	cd 30                	int    $0x30
+  80040e:	89 c7                	mov    %eax,%edi
+	if ((envid = sys_exofork()) < 0)
+  800410:	85 c0                	test   %eax,%eax
+  800412:	0f 88 aa 01 00 00    	js     8005c2 <umain+0x525>
+	for (addr = 0; addr < UXSTACKTOP - PGSIZE; addr += PGSIZE) {
+  800418:	be 00 00 00 00       	mov    $0x0,%esi
+	if (envid == 0) {
+  80041d:	0f 85 95 fe ff ff    	jne    8002b8 <umain+0x21b>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  800423:	e8 1e 0e 00 00       	call   801246 <sys_getenvid>
+  800428:	25 ff 03 00 00       	and    $0x3ff,%eax
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80042d:	89 e2                	mov    %esp,%edx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80042f:	b9 ff ff bf ee       	mov    $0xeebfffff,%ecx
+  800434:	29 d1                	sub    %edx,%ecx
+  800436:	89 ca                	mov    %ecx,%edx
+  800438:	c1 ea 0f             	shr    $0xf,%edx
+  80043b:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  800441:	0f 43 d3             	cmovae %ebx,%edx
+  800444:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80044a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80044f:	89 04 95 40 80 84 00 	mov    %eax,0x848040(,%edx,4)
+			exit();
+  800456:	e8 09 02 00 00       	call   800664 <exit>
+  80045b:	e9 2e ff ff ff       	jmp    80038e <umain+0x2f1>
+		panic("unbatched fork: %e", r);
+  800460:	50                   	push   %eax
+  800461:	68 1f 54 80 00       	push   $0x80541f
+  800466:	6a 4f                	push   $0x4f
+  800468:	68 f0 53 80 00       	push   $0x8053f0
+  80046d:	e8 0c 02 00 00       	call   80067e <_panic>
+	}
+
+	spawn_cycles = 0;
+	spawn_calls = 0;
+  800472:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+	for (i = 0; i < NROUNDS; i++) {
+  800475:	bf 00 00 00 00       	mov    $0x0,%edi
+	spawn_cycles = 0;
+  80047a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800481:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  800488:	89 e0                	mov    %esp,%eax
+  80048a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80048f:	29 c2                	sub    %eax,%edx
+  800491:	89 d0                	mov    %edx,%eax
+  800493:	c1 e8 0f             	shr    $0xf,%eax
+  800496:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80049c:	0f 43 c3             	cmovae %ebx,%eax
+		s0 = thisenv->env_syscalls;
+  80049f:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8004a6:	8b 70 5c             	mov    0x5c(%eax),%esi
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  8004a9:	0f 31                	rdtsc
+  8004ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ae:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		t0 = read_tsc();
+		if ((r = spawnl("forkbench", "forkbench",
+  8004b1:	85 ff                	test   %edi,%edi
+  8004b3:	b8 08 54 80 00       	mov    $0x805408,%eax
+  8004b8:	ba d1 53 80 00       	mov    $0x8053d1,%edx
+  8004bd:	0f 44 c2             	cmove  %edx,%eax
+  8004c0:	6a 00                	push   $0x0
+  8004c2:	50                   	push   %eax
+  8004c3:	68 e6 53 80 00       	push   $0x8053e6
+  8004c8:	68 e6 53 80 00       	push   $0x8053e6
+  8004cd:	e8 8b 2b 00 00       	call   80305d <spawnl>
+  8004d2:	89 c1                	mov    %eax,%ecx
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	85 c0                	test   %eax,%eax
+  8004d9:	0f 88 ce 00 00 00    	js     8005ad <umain+0x510>
+  8004df:	0f 31                	rdtsc
+				i == 0 ? "report" : "child", 0)) < 0)
+			panic("spawn: %e", r);
+		spawn_cycles += read_tsc() - t0;
+  8004e1:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  8004e4:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  8004e7:	01 45 d8             	add    %eax,-0x28(%ebp)
+  8004ea:	11 55 dc             	adc    %edx,-0x24(%ebp)
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8004ed:	89 e0                	mov    %esp,%eax
+  8004ef:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8004f4:	29 c2                	sub    %eax,%edx
+  8004f6:	89 d0                	mov    %edx,%eax
+  8004f8:	c1 e8 0f             	shr    $0xf,%eax
+  8004fb:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800501:	0f 43 c3             	cmovae %ebx,%eax
+		spawn_calls += thisenv->env_syscalls - s0;
+  800504:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  80050b:	8b 40 5c             	mov    0x5c(%eax),%eax
+  80050e:	29 f0                	sub    %esi,%eax
+  800510:	01 45 bc             	add    %eax,-0x44(%ebp)
+		wait(r);
+  800513:	83 ec 0c             	sub    $0xc,%esp
+  800516:	51                   	push   %ecx
+  800517:	e8 a2 42 00 00       	call   8047be <wait>
+	for (i = 0; i < NROUNDS; i++) {
+  80051c:	83 c7 01             	add    $0x1,%edi
+  80051f:	83 c4 10             	add    $0x10,%esp
+  800522:	83 ff 08             	cmp    $0x8,%edi
+  800525:	0f 85 5d ff ff ff    	jne    800488 <umain+0x3eb>
+	}
+
+	cprintf("forkbench: %d pages mapped, %d copy-on-write\n", mapped, cow);
+  80052b:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  80052e:	83 ec 04             	sub    $0x4,%esp
+  800531:	56                   	push   %esi
+  800532:	ff 75 b8             	push   -0x48(%ebp)
+  800535:	68 18 53 80 00       	push   $0x805318
+  80053a:	e8 1a 02 00 00       	call   800759 <cprintf>
+	cprintf("forkbench: fork  %u cycles, %u syscalls\n",
+  80053f:	83 c4 0c             	add    $0xc,%esp
+  800542:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800545:	c1 e8 03             	shr    $0x3,%eax
+  800548:	50                   	push   %eax
+		(uint32_t) (fork_cycles / NROUNDS), fork_calls / NROUNDS);
+  800549:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80054c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  80054f:	0f ac d0 03          	shrd   $0x3,%edx,%eax
+  800553:	c1 ea 03             	shr    $0x3,%edx
+	cprintf("forkbench: fork  %u cycles, %u syscalls\n",
+  800556:	50                   	push   %eax
+  800557:	68 48 53 80 00       	push   $0x805348
+  80055c:	e8 f8 01 00 00       	call   800759 <cprintf>
+	cprintf("forkbench: fork, unbatched  %u cycles, %u syscalls\n",
+  800561:	83 c4 0c             	add    $0xc,%esp
+  800564:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800567:	c1 e8 03             	shr    $0x3,%eax
+  80056a:	50                   	push   %eax
+		(uint32_t) (ufork_cycles / NROUNDS), ufork_calls / NROUNDS);
+  80056b:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  80056e:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  800571:	0f ac d0 03          	shrd   $0x3,%edx,%eax
+  800575:	c1 ea 03             	shr    $0x3,%edx
+	cprintf("forkbench: fork, unbatched  %u cycles, %u syscalls\n",
+  800578:	50                   	push   %eax
+  800579:	68 74 53 80 00       	push   $0x805374
+  80057e:	e8 d6 01 00 00       	call   800759 <cprintf>
+	cprintf("forkbench: spawn %u cycles, %u syscalls\n",
+  800583:	83 c4 0c             	add    $0xc,%esp
+  800586:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  800589:	c1 e8 03             	shr    $0x3,%eax
+  80058c:	50                   	push   %eax
+		(uint32_t) (spawn_cycles / NROUNDS), spawn_calls / NROUNDS);
+  80058d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800590:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  800593:	0f ac d0 03          	shrd   $0x3,%edx,%eax
+  800597:	c1 ea 03             	shr    $0x3,%edx
+	cprintf("forkbench: spawn %u cycles, %u syscalls\n",
+  80059a:	50                   	push   %eax
+  80059b:	68 a8 53 80 00       	push   $0x8053a8
+  8005a0:	e8 b4 01 00 00       	call   800759 <cprintf>
+}
+  8005a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a8:	5b                   	pop    %ebx
+  8005a9:	5e                   	pop    %esi
+  8005aa:	5f                   	pop    %edi
+  8005ab:	5d                   	pop    %ebp
+  8005ac:	c3                   	ret
+			panic("spawn: %e", r);
+  8005ad:	50                   	push   %eax
+  8005ae:	68 32 54 80 00       	push   $0x805432
+  8005b3:	68 9d 00 00 00       	push   $0x9d
+  8005b8:	68 f0 53 80 00       	push   $0x8053f0
+  8005bd:	e8 bc 00 00 00       	call   80067e <_panic>
+			panic("unbatched fork: %e", r);
+  8005c2:	50                   	push   %eax
+  8005c3:	68 1f 54 80 00       	push   $0x80541f
+  8005c8:	68 8e 00 00 00       	push   $0x8e
+  8005cd:	68 f0 53 80 00       	push   $0x8053f0
+  8005d2:	e8 a7 00 00 00       	call   80067e <_panic>
+
+008005d7 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	56                   	push   %esi
+  8005db:	53                   	push   %ebx
+  8005dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8005e2:	89 e2                	mov    %esp,%edx
+  8005e4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8005e9:	29 d0                	sub    %edx,%eax
+  8005eb:	89 c2                	mov    %eax,%edx
+  8005ed:	c1 ea 0f             	shr    $0xf,%edx
+  8005f0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8005f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fa:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8005fd:	c7 04 85 40 80 84 00 	movl   $0x0,0x848040(,%eax,4)
+  800604:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800608:	e8 39 0c 00 00       	call   801246 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80060d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800612:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800618:	89 e1                	mov    %esp,%ecx
+  80061a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80061f:	29 ca                	sub    %ecx,%edx
+  800621:	89 d1                	mov    %edx,%ecx
+  800623:	c1 e9 0f             	shr    $0xf,%ecx
+  800626:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80062c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800631:	0f 42 d1             	cmovb  %ecx,%edx
+  800634:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800639:	89 04 95 40 80 84 00 	mov    %eax,0x848040(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800640:	85 db                	test   %ebx,%ebx
+  800642:	7e 07                	jle    80064b <libmain+0x74>
+		binaryname = argv[0];
+  800644:	8b 06                	mov    (%esi),%eax
+  800646:	a3 00 60 84 00       	mov    %eax,0x846000
+
+	// call user main routine
+	umain(argc, argv);
+  80064b:	83 ec 08             	sub    $0x8,%esp
+  80064e:	56                   	push   %esi
+  80064f:	53                   	push   %ebx
+  800650:	e8 48 fa ff ff       	call   80009d <umain>
+
+	// exit gracefully
+	exit();
+  800655:	e8 0a 00 00 00       	call   800664 <exit>
+}
+  80065a:	83 c4 10             	add    $0x10,%esp
+  80065d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800660:	5b                   	pop    %ebx
+  800661:	5e                   	pop    %esi
+  800662:	5d                   	pop    %ebp
+  800663:	c3                   	ret
+
+00800664 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800664:	55                   	push   %ebp
+  800665:	89 e5                	mov    %esp,%ebp
+  800667:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80066a:	e8 dd 19 00 00       	call   80204c <close_all>
+	sys_env_destroy(0);
+  80066f:	83 ec 0c             	sub    $0xc,%esp
+  800672:	6a 00                	push   $0x0
+  800674:	e8 8c 0b 00 00       	call   801205 <sys_env_destroy>
+}
+  800679:	83 c4 10             	add    $0x10,%esp
+  80067c:	c9                   	leave
+  80067d:	c3                   	ret
+
+0080067e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80067e:	55                   	push   %ebp
+  80067f:	89 e5                	mov    %esp,%ebp
+  800681:	56                   	push   %esi
+  800682:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800683:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800686:	8b 35 00 60 84 00    	mov    0x846000,%esi
+  80068c:	e8 b5 0b 00 00       	call   801246 <sys_getenvid>
+  800691:	83 ec 0c             	sub    $0xc,%esp
+  800694:	ff 75 0c             	push   0xc(%ebp)
+  800697:	ff 75 08             	push   0x8(%ebp)
+  80069a:	56                   	push   %esi
+  80069b:	50                   	push   %eax
+  80069c:	68 48 54 80 00       	push   $0x805448
+  8006a1:	e8 b3 00 00 00       	call   800759 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006a6:	83 c4 18             	add    $0x18,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	ff 75 10             	push   0x10(%ebp)
+  8006ad:	e8 56 00 00 00       	call   800708 <vcprintf>
+	cprintf("\n");
+  8006b2:	c7 04 24 4e 5a 80 00 	movl   $0x805a4e,(%esp)
+  8006b9:	e8 9b 00 00 00       	call   800759 <cprintf>
+  8006be:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006c1:	cc                   	int3
+	while (1)
+  8006c2:	eb fd                	jmp    8006c1 <_panic+0x43>
+
+008006c4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006c4:	55                   	push   %ebp
+  8006c5:	89 e5                	mov    %esp,%ebp
+  8006c7:	53                   	push   %ebx
+  8006c8:	83 ec 04             	sub    $0x4,%esp
+  8006cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8006ce:	8b 13                	mov    (%ebx),%edx
+  8006d0:	8d 42 01             	lea    0x1(%edx),%eax
+  8006d3:	89 03                	mov    %eax,(%ebx)
+  8006d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006d8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006dc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006e1:	74 09                	je     8006ec <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006e3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006ea:	c9                   	leave
+  8006eb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006ec:	83 ec 08             	sub    $0x8,%esp
+  8006ef:	68 ff 00 00 00       	push   $0xff
+  8006f4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006f7:	50                   	push   %eax
+  8006f8:	e8 cb 0a 00 00       	call   8011c8 <sys_cputs>
+		b->idx = 0;
+  8006fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800703:	83 c4 10             	add    $0x10,%esp
+  800706:	eb db                	jmp    8006e3 <putch+0x1f>
+
+00800708 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800708:	55                   	push   %ebp
+  800709:	89 e5                	mov    %esp,%ebp
+  80070b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800711:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800718:	00 00 00 
+	b.cnt = 0;
+  80071b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800722:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800725:	ff 75 0c             	push   0xc(%ebp)
+  800728:	ff 75 08             	push   0x8(%ebp)
+  80072b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800731:	50                   	push   %eax
+  800732:	68 c4 06 80 00       	push   $0x8006c4
+  800737:	e8 1c 01 00 00       	call   800858 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80073c:	83 c4 08             	add    $0x8,%esp
+  80073f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800745:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80074b:	50                   	push   %eax
+  80074c:	e8 77 0a 00 00       	call   8011c8 <sys_cputs>
+
+	return b.cnt;
+}
+  800751:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800757:	c9                   	leave
+  800758:	c3                   	ret
+
+00800759 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800759:	55                   	push   %ebp
+  80075a:	89 e5                	mov    %esp,%ebp
+  80075c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80075f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800762:	50                   	push   %eax
+  800763:	ff 75 08             	push   0x8(%ebp)
+  800766:	e8 9d ff ff ff       	call   800708 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80076b:	c9                   	leave
+  80076c:	c3                   	ret
+
+0080076d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80076d:	55                   	push   %ebp
+  80076e:	89 e5                	mov    %esp,%ebp
+  800770:	57                   	push   %edi
+  800771:	56                   	push   %esi
+  800772:	53                   	push   %ebx
+  800773:	83 ec 1c             	sub    $0x1c,%esp
+  800776:	89 c3                	mov    %eax,%ebx
+  800778:	89 d6                	mov    %edx,%esi
+  80077a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80077d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800780:	89 d1                	mov    %edx,%ecx
+  800782:	89 c2                	mov    %eax,%edx
+  800784:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800787:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80078a:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80078d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800790:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800797:	39 c2                	cmp    %eax,%edx
+  800799:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80079c:	73 4b                	jae    8007e9 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8007a4:	85 ff                	test   %edi,%edi
+  8007a6:	7e 11                	jle    8007b9 <printnum+0x4c>
+			putch(padc, putdat);
+  8007a8:	83 ec 08             	sub    $0x8,%esp
+  8007ab:	56                   	push   %esi
+  8007ac:	ff 75 18             	push   0x18(%ebp)
+  8007af:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8007b1:	83 c4 10             	add    $0x10,%esp
+  8007b4:	83 ef 01             	sub    $0x1,%edi
+  8007b7:	75 ef                	jne    8007a8 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007b9:	83 ec 08             	sub    $0x8,%esp
+  8007bc:	56                   	push   %esi
+  8007bd:	83 ec 04             	sub    $0x4,%esp
+  8007c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8007c3:	ff 75 e0             	push   -0x20(%ebp)
+  8007c6:	ff 75 dc             	push   -0x24(%ebp)
+  8007c9:	ff 75 d8             	push   -0x28(%ebp)
+  8007cc:	e8 ef 49 00 00       	call   8051c0 <__umoddi3>
+  8007d1:	83 c4 14             	add    $0x14,%esp
+  8007d4:	0f be 80 6b 54 80 00 	movsbl 0x80546b(%eax),%eax
+  8007db:	50                   	push   %eax
+  8007dc:	ff d3                	call   *%ebx
+}
+  8007de:	83 c4 10             	add    $0x10,%esp
+  8007e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e4:	5b                   	pop    %ebx
+  8007e5:	5e                   	pop    %esi
+  8007e6:	5f                   	pop    %edi
+  8007e7:	5d                   	pop    %ebp
+  8007e8:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007e9:	83 ec 0c             	sub    $0xc,%esp
+  8007ec:	ff 75 18             	push   0x18(%ebp)
+  8007ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007f2:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8007f5:	52                   	push   %edx
+  8007f6:	50                   	push   %eax
+  8007f7:	83 ec 08             	sub    $0x8,%esp
+  8007fa:	ff 75 e4             	push   -0x1c(%ebp)
+  8007fd:	ff 75 e0             	push   -0x20(%ebp)
+  800800:	ff 75 dc             	push   -0x24(%ebp)
+  800803:	ff 75 d8             	push   -0x28(%ebp)
+  800806:	e8 ef 48 00 00       	call   8050fa <__udivdi3>
+  80080b:	83 c4 18             	add    $0x18,%esp
+  80080e:	52                   	push   %edx
+  80080f:	50                   	push   %eax
+  800810:	89 f2                	mov    %esi,%edx
+  800812:	89 d8                	mov    %ebx,%eax
+  800814:	e8 54 ff ff ff       	call   80076d <printnum>
+  800819:	83 c4 20             	add    $0x20,%esp
+  80081c:	eb 9b                	jmp    8007b9 <printnum+0x4c>
+
+0080081e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80081e:	55                   	push   %ebp
+  80081f:	89 e5                	mov    %esp,%ebp
+  800821:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800824:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800828:	8b 10                	mov    (%eax),%edx
+  80082a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80082d:	73 0a                	jae    800839 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80082f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800832:	89 08                	mov    %ecx,(%eax)
+  800834:	8b 45 08             	mov    0x8(%ebp),%eax
+  800837:	88 02                	mov    %al,(%edx)
+}
+  800839:	5d                   	pop    %ebp
+  80083a:	c3                   	ret
+
+0080083b <printfmt>:
+{
+  80083b:	55                   	push   %ebp
+  80083c:	89 e5                	mov    %esp,%ebp
+  80083e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800841:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800844:	50                   	push   %eax
+  800845:	ff 75 10             	push   0x10(%ebp)
+  800848:	ff 75 0c             	push   0xc(%ebp)
+  80084b:	ff 75 08             	push   0x8(%ebp)
+  80084e:	e8 05 00 00 00       	call   800858 <vprintfmt>
+}
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	c9                   	leave
+  800857:	c3                   	ret
+
+00800858 <vprintfmt>:
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	57                   	push   %edi
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	83 ec 2c             	sub    $0x2c,%esp
+  800861:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800864:	89 df                	mov    %ebx,%edi
+  800866:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800869:	8b 45 10             	mov    0x10(%ebp),%eax
+  80086c:	8d 70 01             	lea    0x1(%eax),%esi
+  80086f:	0f b6 00             	movzbl (%eax),%eax
+  800872:	83 f8 25             	cmp    $0x25,%eax
+  800875:	74 1e                	je     800895 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800877:	85 c0                	test   %eax,%eax
+  800879:	0f 84 15 05 00 00    	je     800d94 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80087f:	83 ec 08             	sub    $0x8,%esp
+  800882:	53                   	push   %ebx
+  800883:	50                   	push   %eax
+  800884:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800886:	83 c6 01             	add    $0x1,%esi
+  800889:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80088d:	83 c4 10             	add    $0x10,%esp
+  800890:	83 f8 25             	cmp    $0x25,%eax
+  800893:	75 e2                	jne    800877 <vprintfmt+0x1f>
+		padc = ' ';
+  800895:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800899:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8008a0:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8008a7:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8008ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b3:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008b6:	8d 56 01             	lea    0x1(%esi),%edx
+  8008b9:	0f b6 0e             	movzbl (%esi),%ecx
+  8008bc:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8008bf:	3c 55                	cmp    $0x55,%al
+  8008c1:	0f 87 3b 04 00 00    	ja     800d02 <vprintfmt+0x4aa>
+  8008c7:	0f b6 c0             	movzbl %al,%eax
+  8008ca:	ff 24 85 e0 55 80 00 	jmp    *0x8055e0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008d1:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008d4:	eb 93                	jmp    800869 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008d6:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8008d8:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8008dc:	eb d8                	jmp    8008b6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008de:	89 d6                	mov    %edx,%esi
+  8008e0:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8008e4:	eb d0                	jmp    8008b6 <vprintfmt+0x5e>
+  8008e6:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8008e9:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8008ec:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8008ef:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8008f3:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8008f6:	83 f9 09             	cmp    $0x9,%ecx
+  8008f9:	77 6f                	ja     80096a <vprintfmt+0x112>
+  8008fb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8008fe:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800901:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800904:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800908:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80090b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80090e:	83 fe 09             	cmp    $0x9,%esi
+  800911:	76 eb                	jbe    8008fe <vprintfmt+0xa6>
+  800913:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800916:	89 d6                	mov    %edx,%esi
+  800918:	eb 13                	jmp    80092d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80091a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091d:	8b 00                	mov    (%eax),%eax
+  80091f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800922:	8b 45 14             	mov    0x14(%ebp),%eax
+  800925:	8d 40 04             	lea    0x4(%eax),%eax
+  800928:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80092b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80092d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800931:	79 83                	jns    8008b6 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800933:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800936:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800939:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800940:	e9 71 ff ff ff       	jmp    8008b6 <vprintfmt+0x5e>
+			if (width < 0)
+  800945:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800948:	85 c9                	test   %ecx,%ecx
+  80094a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094f:	0f 49 c1             	cmovns %ecx,%eax
+  800952:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800955:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800957:	e9 5a ff ff ff       	jmp    8008b6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80095c:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80095e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800965:	e9 4c ff ff ff       	jmp    8008b6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80096a:	89 d6                	mov    %edx,%esi
+  80096c:	eb bf                	jmp    80092d <vprintfmt+0xd5>
+			lflag++;
+  80096e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800972:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800974:	e9 3d ff ff ff       	jmp    8008b6 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800979:	89 55 10             	mov    %edx,0x10(%ebp)
+  80097c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097f:	8d 70 04             	lea    0x4(%eax),%esi
+  800982:	83 ec 08             	sub    $0x8,%esp
+  800985:	53                   	push   %ebx
+  800986:	ff 30                	push   (%eax)
+  800988:	ff d7                	call   *%edi
+			break;
+  80098a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80098d:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800990:	e9 d4 fe ff ff       	jmp    800869 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800995:	89 55 10             	mov    %edx,0x10(%ebp)
+  800998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099b:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80099e:	8b 10                	mov    (%eax),%edx
+  8009a0:	89 d0                	mov    %edx,%eax
+  8009a2:	f7 d8                	neg    %eax
+  8009a4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009a7:	83 f8 12             	cmp    $0x12,%eax
+  8009aa:	7f 23                	jg     8009cf <vprintfmt+0x177>
+  8009ac:	8b 14 85 40 57 80 00 	mov    0x805740(,%eax,4),%edx
+  8009b3:	85 d2                	test   %edx,%edx
+  8009b5:	74 18                	je     8009cf <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8009b7:	52                   	push   %edx
+  8009b8:	68 78 59 80 00       	push   $0x805978
+  8009bd:	53                   	push   %ebx
+  8009be:	57                   	push   %edi
+  8009bf:	e8 77 fe ff ff       	call   80083b <printfmt>
+  8009c4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009c7:	89 75 14             	mov    %esi,0x14(%ebp)
+  8009ca:	e9 9a fe ff ff       	jmp    800869 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8009cf:	50                   	push   %eax
+  8009d0:	68 83 54 80 00       	push   $0x805483
+  8009d5:	53                   	push   %ebx
+  8009d6:	57                   	push   %edi
+  8009d7:	e8 5f fe ff ff       	call   80083b <printfmt>
+  8009dc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009df:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8009e2:	e9 82 fe ff ff       	jmp    800869 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009e7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ed:	83 c0 04             	add    $0x4,%eax
+  8009f0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8009f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f6:	8b 00                	mov    (%eax),%eax
+  8009f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009fb:	85 c0                	test   %eax,%eax
+  8009fd:	0f 84 61 03 00 00    	je     800d64 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800a03:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a07:	7e 06                	jle    800a0f <vprintfmt+0x1b7>
+  800a09:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a0d:	75 29                	jne    800a38 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a0f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a12:	8d 70 01             	lea    0x1(%eax),%esi
+  800a15:	0f b6 00             	movzbl (%eax),%eax
+  800a18:	0f be d0             	movsbl %al,%edx
+  800a1b:	85 d2                	test   %edx,%edx
+  800a1d:	0f 84 bb 00 00 00    	je     800ade <vprintfmt+0x286>
+  800a23:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a26:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a29:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a2c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a2f:	eb 7a                	jmp    800aab <vprintfmt+0x253>
+				p = "(null)";
+  800a31:	c7 45 d0 7c 54 80 00 	movl   $0x80547c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a38:	83 ec 08             	sub    $0x8,%esp
+  800a3b:	ff 75 d4             	push   -0x2c(%ebp)
+  800a3e:	ff 75 d0             	push   -0x30(%ebp)
+  800a41:	e8 e0 03 00 00       	call   800e26 <strnlen>
+  800a46:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800a49:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800a4c:	83 c4 10             	add    $0x10,%esp
+  800a4f:	85 d2                	test   %edx,%edx
+  800a51:	0f 8e d6 02 00 00    	jle    800d2d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800a57:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800a5b:	83 ec 08             	sub    $0x8,%esp
+  800a5e:	53                   	push   %ebx
+  800a5f:	56                   	push   %esi
+  800a60:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800a69:	75 f0                	jne    800a5b <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a6b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a6e:	8d 70 01             	lea    0x1(%eax),%esi
+  800a71:	0f b6 00             	movzbl (%eax),%eax
+  800a74:	0f be d0             	movsbl %al,%edx
+  800a77:	85 d2                	test   %edx,%edx
+  800a79:	0f 84 da 02 00 00    	je     800d59 <vprintfmt+0x501>
+  800a7f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a82:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a85:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a88:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a8b:	eb 1e                	jmp    800aab <vprintfmt+0x253>
+					putch(ch, putdat);
+  800a8d:	83 ec 08             	sub    $0x8,%esp
+  800a90:	ff 75 0c             	push   0xc(%ebp)
+  800a93:	52                   	push   %edx
+  800a94:	ff 55 08             	call   *0x8(%ebp)
+  800a97:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a9a:	83 eb 01             	sub    $0x1,%ebx
+  800a9d:	83 c6 01             	add    $0x1,%esi
+  800aa0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800aa4:	0f be d0             	movsbl %al,%edx
+  800aa7:	85 d2                	test   %edx,%edx
+  800aa9:	74 2a                	je     800ad5 <vprintfmt+0x27d>
+  800aab:	85 ff                	test   %edi,%edi
+  800aad:	78 05                	js     800ab4 <vprintfmt+0x25c>
+  800aaf:	83 ef 01             	sub    $0x1,%edi
+  800ab2:	78 59                	js     800b0d <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800ab4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800ab8:	74 d3                	je     800a8d <vprintfmt+0x235>
+  800aba:	0f be c0             	movsbl %al,%eax
+  800abd:	83 e8 20             	sub    $0x20,%eax
+  800ac0:	83 f8 5e             	cmp    $0x5e,%eax
+  800ac3:	76 c8                	jbe    800a8d <vprintfmt+0x235>
+					putch('?', putdat);
+  800ac5:	83 ec 08             	sub    $0x8,%esp
+  800ac8:	ff 75 0c             	push   0xc(%ebp)
+  800acb:	6a 3f                	push   $0x3f
+  800acd:	ff 55 08             	call   *0x8(%ebp)
+  800ad0:	83 c4 10             	add    $0x10,%esp
+  800ad3:	eb c5                	jmp    800a9a <vprintfmt+0x242>
+  800ad5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ad8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800adb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800ade:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800ae1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800ae5:	7e 1b                	jle    800b02 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800ae7:	83 ec 08             	sub    $0x8,%esp
+  800aea:	53                   	push   %ebx
+  800aeb:	6a 20                	push   $0x20
+  800aed:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800aef:	83 c4 10             	add    $0x10,%esp
+  800af2:	83 ee 01             	sub    $0x1,%esi
+  800af5:	75 f0                	jne    800ae7 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800af7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800afa:	89 45 14             	mov    %eax,0x14(%ebp)
+  800afd:	e9 67 fd ff ff       	jmp    800869 <vprintfmt+0x11>
+  800b02:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b05:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b08:	e9 5c fd ff ff       	jmp    800869 <vprintfmt+0x11>
+  800b0d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b10:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b16:	eb c6                	jmp    800ade <vprintfmt+0x286>
+	if (lflag >= 2)
+  800b18:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b1b:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b1e:	83 f9 01             	cmp    $0x1,%ecx
+  800b21:	7f 1f                	jg     800b42 <vprintfmt+0x2ea>
+	else if (lflag)
+  800b23:	85 c9                	test   %ecx,%ecx
+  800b25:	74 67                	je     800b8e <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800b27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2a:	8b 30                	mov    (%eax),%esi
+  800b2c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b2f:	89 f0                	mov    %esi,%eax
+  800b31:	c1 f8 1f             	sar    $0x1f,%eax
+  800b34:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b37:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3a:	8d 40 04             	lea    0x4(%eax),%eax
+  800b3d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b40:	eb 17                	jmp    800b59 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800b42:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b45:	8b 50 04             	mov    0x4(%eax),%edx
+  800b48:	8b 00                	mov    (%eax),%eax
+  800b4a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b4d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b50:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b53:	8d 40 08             	lea    0x8(%eax),%eax
+  800b56:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b59:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b5c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b5f:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800b64:	85 c9                	test   %ecx,%ecx
+  800b66:	0f 89 12 01 00 00    	jns    800c7e <vprintfmt+0x426>
+				putch('-', putdat);
+  800b6c:	83 ec 08             	sub    $0x8,%esp
+  800b6f:	53                   	push   %ebx
+  800b70:	6a 2d                	push   $0x2d
+  800b72:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800b74:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b77:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b7a:	f7 da                	neg    %edx
+  800b7c:	83 d1 00             	adc    $0x0,%ecx
+  800b7f:	f7 d9                	neg    %ecx
+  800b81:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b84:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b89:	e9 f0 00 00 00       	jmp    800c7e <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800b8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b91:	8b 30                	mov    (%eax),%esi
+  800b93:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b96:	89 f0                	mov    %esi,%eax
+  800b98:	c1 f8 1f             	sar    $0x1f,%eax
+  800b9b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba1:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ba7:	eb b0                	jmp    800b59 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800ba9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800bac:	89 55 10             	mov    %edx,0x10(%ebp)
+  800baf:	83 f9 01             	cmp    $0x1,%ecx
+  800bb2:	7f 1e                	jg     800bd2 <vprintfmt+0x37a>
+	else if (lflag)
+  800bb4:	85 c9                	test   %ecx,%ecx
+  800bb6:	74 32                	je     800bea <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800bb8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bbb:	8b 10                	mov    (%eax),%edx
+  800bbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc2:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bc8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800bcd:	e9 ac 00 00 00       	jmp    800c7e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800bd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd5:	8b 10                	mov    (%eax),%edx
+  800bd7:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bda:	8d 40 08             	lea    0x8(%eax),%eax
+  800bdd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800be0:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800be5:	e9 94 00 00 00       	jmp    800c7e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800bea:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bed:	8b 10                	mov    (%eax),%edx
+  800bef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf4:	8d 40 04             	lea    0x4(%eax),%eax
+  800bf7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bfa:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800bff:	eb 7d                	jmp    800c7e <vprintfmt+0x426>
+	if (lflag >= 2)
+  800c01:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c04:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c07:	83 f9 01             	cmp    $0x1,%ecx
+  800c0a:	7f 1b                	jg     800c27 <vprintfmt+0x3cf>
+	else if (lflag)
+  800c0c:	85 c9                	test   %ecx,%ecx
+  800c0e:	74 2c                	je     800c3c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800c10:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c13:	8b 10                	mov    (%eax),%edx
+  800c15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c1a:	8d 40 04             	lea    0x4(%eax),%eax
+  800c1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c20:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800c25:	eb 57                	jmp    800c7e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800c27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c2a:	8b 10                	mov    (%eax),%edx
+  800c2c:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c2f:	8d 40 08             	lea    0x8(%eax),%eax
+  800c32:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c35:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800c3a:	eb 42                	jmp    800c7e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800c3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3f:	8b 10                	mov    (%eax),%edx
+  800c41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c46:	8d 40 04             	lea    0x4(%eax),%eax
+  800c49:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c4c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800c51:	eb 2b                	jmp    800c7e <vprintfmt+0x426>
+			putch('0', putdat);
+  800c53:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c56:	83 ec 08             	sub    $0x8,%esp
+  800c59:	53                   	push   %ebx
+  800c5a:	6a 30                	push   $0x30
+  800c5c:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800c5e:	83 c4 08             	add    $0x8,%esp
+  800c61:	53                   	push   %ebx
+  800c62:	6a 78                	push   $0x78
+  800c64:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800c66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c69:	8b 10                	mov    (%eax),%edx
+  800c6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c70:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c73:	8d 40 04             	lea    0x4(%eax),%eax
+  800c76:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c79:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  800c81:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800c85:	50                   	push   %eax
+  800c86:	ff 75 e4             	push   -0x1c(%ebp)
+  800c89:	56                   	push   %esi
+  800c8a:	51                   	push   %ecx
+  800c8b:	52                   	push   %edx
+  800c8c:	89 da                	mov    %ebx,%edx
+  800c8e:	89 f8                	mov    %edi,%eax
+  800c90:	e8 d8 fa ff ff       	call   80076d <printnum>
+			break;
+  800c95:	83 c4 20             	add    $0x20,%esp
+  800c98:	e9 cc fb ff ff       	jmp    800869 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800c9d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ca0:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ca3:	83 f9 01             	cmp    $0x1,%ecx
+  800ca6:	7f 1b                	jg     800cc3 <vprintfmt+0x46b>
+	else if (lflag)
+  800ca8:	85 c9                	test   %ecx,%ecx
+  800caa:	74 2c                	je     800cd8 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800cac:	8b 45 14             	mov    0x14(%ebp),%eax
+  800caf:	8b 10                	mov    (%eax),%edx
+  800cb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb6:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cbc:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800cc1:	eb bb                	jmp    800c7e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800cc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc6:	8b 10                	mov    (%eax),%edx
+  800cc8:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ccb:	8d 40 08             	lea    0x8(%eax),%eax
+  800cce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cd1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800cd6:	eb a6                	jmp    800c7e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800cd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cdb:	8b 10                	mov    (%eax),%edx
+  800cdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ce5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ce8:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800ced:	eb 8f                	jmp    800c7e <vprintfmt+0x426>
+			putch(ch, putdat);
+  800cef:	89 55 10             	mov    %edx,0x10(%ebp)
+  800cf2:	83 ec 08             	sub    $0x8,%esp
+  800cf5:	53                   	push   %ebx
+  800cf6:	6a 25                	push   $0x25
+  800cf8:	ff d7                	call   *%edi
+			break;
+  800cfa:	83 c4 10             	add    $0x10,%esp
+  800cfd:	e9 67 fb ff ff       	jmp    800869 <vprintfmt+0x11>
+			putch('%', putdat);
+  800d02:	83 ec 08             	sub    $0x8,%esp
+  800d05:	53                   	push   %ebx
+  800d06:	6a 25                	push   $0x25
+  800d08:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d0a:	83 c4 10             	add    $0x10,%esp
+  800d0d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800d11:	0f 84 ba fb ff ff    	je     8008d1 <vprintfmt+0x79>
+  800d17:	89 75 10             	mov    %esi,0x10(%ebp)
+  800d1a:	89 f0                	mov    %esi,%eax
+  800d1c:	83 e8 01             	sub    $0x1,%eax
+  800d1f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d23:	75 f7                	jne    800d1c <vprintfmt+0x4c4>
+  800d25:	89 45 10             	mov    %eax,0x10(%ebp)
+  800d28:	e9 3c fb ff ff       	jmp    800869 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d2d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d30:	8d 70 01             	lea    0x1(%eax),%esi
+  800d33:	0f b6 00             	movzbl (%eax),%eax
+  800d36:	0f be d0             	movsbl %al,%edx
+  800d39:	85 d2                	test   %edx,%edx
+  800d3b:	74 11                	je     800d4e <vprintfmt+0x4f6>
+  800d3d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d40:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d43:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d46:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d49:	e9 5d fd ff ff       	jmp    800aab <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d4e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d51:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d54:	e9 10 fb ff ff       	jmp    800869 <vprintfmt+0x11>
+  800d59:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d5c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d5f:	e9 05 fb ff ff       	jmp    800869 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800d64:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800d68:	7e 0a                	jle    800d74 <vprintfmt+0x51c>
+  800d6a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800d6e:	0f 85 bd fc ff ff    	jne    800a31 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d74:	ba 28 00 00 00       	mov    $0x28,%edx
+  800d79:	b8 28 00 00 00       	mov    $0x28,%eax
+  800d7e:	be 7d 54 80 00       	mov    $0x80547d,%esi
+  800d83:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d86:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d89:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d8c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d8f:	e9 17 fd ff ff       	jmp    800aab <vprintfmt+0x253>
+}
+  800d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d97:	5b                   	pop    %ebx
+  800d98:	5e                   	pop    %esi
+  800d99:	5f                   	pop    %edi
+  800d9a:	5d                   	pop    %ebp
+  800d9b:	c3                   	ret
+
+00800d9c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	83 ec 18             	sub    $0x18,%esp
+  800da2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800da8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800dab:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800daf:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800db2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800db9:	85 c0                	test   %eax,%eax
+  800dbb:	74 26                	je     800de3 <vsnprintf+0x47>
+  800dbd:	85 d2                	test   %edx,%edx
+  800dbf:	7e 22                	jle    800de3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800dc1:	ff 75 14             	push   0x14(%ebp)
+  800dc4:	ff 75 10             	push   0x10(%ebp)
+  800dc7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800dca:	50                   	push   %eax
+  800dcb:	68 1e 08 80 00       	push   $0x80081e
+  800dd0:	e8 83 fa ff ff       	call   800858 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800dd5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800dd8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800dde:	83 c4 10             	add    $0x10,%esp
+}
+  800de1:	c9                   	leave
+  800de2:	c3                   	ret
+		return -E_INVAL;
+  800de3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800de8:	eb f7                	jmp    800de1 <vsnprintf+0x45>
+
+00800dea <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800df0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800df3:	50                   	push   %eax
+  800df4:	ff 75 10             	push   0x10(%ebp)
+  800df7:	ff 75 0c             	push   0xc(%ebp)
+  800dfa:	ff 75 08             	push   0x8(%ebp)
+  800dfd:	e8 9a ff ff ff       	call   800d9c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+
+00800e04 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800e0a:	80 3a 00             	cmpb   $0x0,(%edx)
+  800e0d:	74 10                	je     800e1f <strlen+0x1b>
+  800e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800e14:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800e17:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800e1b:	75 f7                	jne    800e14 <strlen+0x10>
+	return n;
+}
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800e24:	eb f7                	jmp    800e1d <strlen+0x19>
+
+00800e26 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e2f:	85 d2                	test   %edx,%edx
+  800e31:	74 16                	je     800e49 <strnlen+0x23>
+  800e33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e38:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800e3c:	74 09                	je     800e47 <strnlen+0x21>
+		n++;
+  800e3e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e41:	39 d0                	cmp    %edx,%eax
+  800e43:	75 f3                	jne    800e38 <strnlen+0x12>
+		n++;
+  800e45:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800e47:	5d                   	pop    %ebp
+  800e48:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4e:	eb f7                	jmp    800e47 <strnlen+0x21>
+
+00800e50 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	53                   	push   %ebx
+  800e54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e63:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e66:	83 c0 01             	add    $0x1,%eax
+  800e69:	84 d2                	test   %dl,%dl
+  800e6b:	75 f2                	jne    800e5f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800e6d:	89 c8                	mov    %ecx,%eax
+  800e6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e72:	c9                   	leave
+  800e73:	c3                   	ret
+
+00800e74 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	53                   	push   %ebx
+  800e78:	83 ec 10             	sub    $0x10,%esp
+  800e7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e7e:	53                   	push   %ebx
+  800e7f:	e8 80 ff ff ff       	call   800e04 <strlen>
+  800e84:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e87:	ff 75 0c             	push   0xc(%ebp)
+  800e8a:	01 d8                	add    %ebx,%eax
+  800e8c:	50                   	push   %eax
+  800e8d:	e8 be ff ff ff       	call   800e50 <strcpy>
+	return dst;
+}
+  800e92:	89 d8                	mov    %ebx,%eax
+  800e94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e97:	c9                   	leave
+  800e98:	c3                   	ret
+
+00800e99 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	56                   	push   %esi
+  800e9d:	53                   	push   %ebx
+  800e9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ea4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ea7:	85 db                	test   %ebx,%ebx
+  800ea9:	74 17                	je     800ec2 <strncpy+0x29>
+  800eab:	01 f3                	add    %esi,%ebx
+  800ead:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800eaf:	83 c0 01             	add    $0x1,%eax
+  800eb2:	0f b6 0a             	movzbl (%edx),%ecx
+  800eb5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800eb8:	80 f9 01             	cmp    $0x1,%cl
+  800ebb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ebe:	39 c3                	cmp    %eax,%ebx
+  800ec0:	75 ed                	jne    800eaf <strncpy+0x16>
+	}
+	return ret;
+}
+  800ec2:	89 f0                	mov    %esi,%eax
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+
+00800ec8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	56                   	push   %esi
+  800ecc:	53                   	push   %ebx
+  800ecd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ed0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ed3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ed6:	89 f0                	mov    %esi,%eax
+  800ed8:	85 db                	test   %ebx,%ebx
+  800eda:	74 1e                	je     800efa <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800edc:	83 eb 01             	sub    $0x1,%ebx
+  800edf:	74 16                	je     800ef7 <strlcpy+0x2f>
+  800ee1:	01 f3                	add    %esi,%ebx
+  800ee3:	0f b6 0a             	movzbl (%edx),%ecx
+  800ee6:	84 c9                	test   %cl,%cl
+  800ee8:	74 0d                	je     800ef7 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800eea:	83 c2 01             	add    $0x1,%edx
+  800eed:	83 c0 01             	add    $0x1,%eax
+  800ef0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ef3:	39 d8                	cmp    %ebx,%eax
+  800ef5:	75 ec                	jne    800ee3 <strlcpy+0x1b>
+		*dst = '\0';
+  800ef7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800efa:	29 f0                	sub    %esi,%eax
+}
+  800efc:	5b                   	pop    %ebx
+  800efd:	5e                   	pop    %esi
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+
+00800f00 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800f00:	55                   	push   %ebp
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800f09:	0f b6 01             	movzbl (%ecx),%eax
+  800f0c:	84 c0                	test   %al,%al
+  800f0e:	74 11                	je     800f21 <strcmp+0x21>
+  800f10:	38 02                	cmp    %al,(%edx)
+  800f12:	75 0d                	jne    800f21 <strcmp+0x21>
+		p++, q++;
+  800f14:	83 c1 01             	add    $0x1,%ecx
+  800f17:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800f1a:	0f b6 01             	movzbl (%ecx),%eax
+  800f1d:	84 c0                	test   %al,%al
+  800f1f:	75 ef                	jne    800f10 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f21:	0f b6 c0             	movzbl %al,%eax
+  800f24:	0f b6 12             	movzbl (%edx),%edx
+  800f27:	29 d0                	sub    %edx,%eax
+}
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	53                   	push   %ebx
+  800f2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f35:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800f38:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800f3d:	85 d2                	test   %edx,%edx
+  800f3f:	74 2e                	je     800f6f <strncmp+0x44>
+  800f41:	0f b6 01             	movzbl (%ecx),%eax
+  800f44:	84 c0                	test   %al,%al
+  800f46:	74 16                	je     800f5e <strncmp+0x33>
+  800f48:	3a 03                	cmp    (%ebx),%al
+  800f4a:	75 12                	jne    800f5e <strncmp+0x33>
+		n--, p++, q++;
+  800f4c:	83 c1 01             	add    $0x1,%ecx
+  800f4f:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800f52:	83 ea 01             	sub    $0x1,%edx
+  800f55:	75 ea                	jne    800f41 <strncmp+0x16>
+		return 0;
+  800f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5c:	eb 11                	jmp    800f6f <strncmp+0x44>
+  800f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800f63:	85 d2                	test   %edx,%edx
+  800f65:	74 08                	je     800f6f <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f67:	0f b6 01             	movzbl (%ecx),%eax
+  800f6a:	0f b6 13             	movzbl (%ebx),%edx
+  800f6d:	29 d0                	sub    %edx,%eax
+}
+  800f6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+
+00800f74 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f7e:	0f b6 10             	movzbl (%eax),%edx
+  800f81:	84 d2                	test   %dl,%dl
+  800f83:	74 15                	je     800f9a <strchr+0x26>
+		if (*s == c)
+  800f85:	38 d1                	cmp    %dl,%cl
+  800f87:	74 0f                	je     800f98 <strchr+0x24>
+	for (; *s; s++)
+  800f89:	83 c0 01             	add    $0x1,%eax
+  800f8c:	0f b6 10             	movzbl (%eax),%edx
+  800f8f:	84 d2                	test   %dl,%dl
+  800f91:	75 f2                	jne    800f85 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800f93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+	return 0;
+  800f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9f:	eb f7                	jmp    800f98 <strchr+0x24>
+
+00800fa1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	53                   	push   %ebx
+  800fa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800fab:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800fae:	38 d3                	cmp    %dl,%bl
+  800fb0:	74 14                	je     800fc6 <strfind+0x25>
+  800fb2:	89 d1                	mov    %edx,%ecx
+  800fb4:	84 db                	test   %bl,%bl
+  800fb6:	74 0e                	je     800fc6 <strfind+0x25>
+	for (; *s; s++)
+  800fb8:	83 c0 01             	add    $0x1,%eax
+  800fbb:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800fbe:	38 ca                	cmp    %cl,%dl
+  800fc0:	74 04                	je     800fc6 <strfind+0x25>
+  800fc2:	84 d2                	test   %dl,%dl
+  800fc4:	75 f2                	jne    800fb8 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800fc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fc9:	c9                   	leave
+  800fca:	c3                   	ret
+
+00800fcb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fd2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800fd5:	85 c9                	test   %ecx,%ecx
+  800fd7:	74 20                	je     800ff9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800fd9:	89 f8                	mov    %edi,%eax
+  800fdb:	09 c8                	or     %ecx,%eax
+  800fdd:	a8 03                	test   $0x3,%al
+  800fdf:	75 12                	jne    800ff3 <memset+0x28>
+		c &= 0xFF;
+  800fe1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800fe5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800feb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800fee:	fc                   	cld
+  800fef:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ff1:	eb 06                	jmp    800ff9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ff3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff6:	fc                   	cld
+  800ff7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ff9:	89 f8                	mov    %edi,%eax
+  800ffb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ffe:	c9                   	leave
+  800fff:	c3                   	ret
+
+00801000 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	8b 45 08             	mov    0x8(%ebp),%eax
+  801008:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80100b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80100e:	39 c6                	cmp    %eax,%esi
+  801010:	73 32                	jae    801044 <memmove+0x44>
+  801012:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801015:	39 d0                	cmp    %edx,%eax
+  801017:	73 2b                	jae    801044 <memmove+0x44>
+		s += n;
+		d += n;
+  801019:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80101c:	89 d6                	mov    %edx,%esi
+  80101e:	09 fe                	or     %edi,%esi
+  801020:	09 ce                	or     %ecx,%esi
+  801022:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801028:	75 0e                	jne    801038 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80102a:	83 ef 04             	sub    $0x4,%edi
+  80102d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801030:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801033:	fd                   	std
+  801034:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801036:	eb 09                	jmp    801041 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801038:	83 ef 01             	sub    $0x1,%edi
+  80103b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80103e:	fd                   	std
+  80103f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801041:	fc                   	cld
+  801042:	eb 1a                	jmp    80105e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801044:	89 f2                	mov    %esi,%edx
+  801046:	09 c2                	or     %eax,%edx
+  801048:	09 ca                	or     %ecx,%edx
+  80104a:	f6 c2 03             	test   $0x3,%dl
+  80104d:	75 0a                	jne    801059 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80104f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801052:	89 c7                	mov    %eax,%edi
+  801054:	fc                   	cld
+  801055:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801057:	eb 05                	jmp    80105e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801059:	89 c7                	mov    %eax,%edi
+  80105b:	fc                   	cld
+  80105c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+
+00801062 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801068:	ff 75 10             	push   0x10(%ebp)
+  80106b:	ff 75 0c             	push   0xc(%ebp)
+  80106e:	ff 75 08             	push   0x8(%ebp)
+  801071:	e8 8a ff ff ff       	call   801000 <memmove>
+}
+  801076:	c9                   	leave
+  801077:	c3                   	ret
+
+00801078 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  80107d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801080:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801083:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801086:	85 f6                	test   %esi,%esi
+  801088:	74 29                	je     8010b3 <memcmp+0x3b>
+  80108a:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  80108c:	0f b6 08             	movzbl (%eax),%ecx
+  80108f:	0f b6 1a             	movzbl (%edx),%ebx
+  801092:	38 d9                	cmp    %bl,%cl
+  801094:	75 11                	jne    8010a7 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801096:	83 c0 01             	add    $0x1,%eax
+  801099:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80109c:	39 c6                	cmp    %eax,%esi
+  80109e:	75 ec                	jne    80108c <memcmp+0x14>
+	}
+
+	return 0;
+  8010a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a5:	eb 08                	jmp    8010af <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  8010a7:	0f b6 c1             	movzbl %cl,%eax
+  8010aa:	0f b6 db             	movzbl %bl,%ebx
+  8010ad:	29 d8                	sub    %ebx,%eax
+}
+  8010af:	5b                   	pop    %ebx
+  8010b0:	5e                   	pop    %esi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+	return 0;
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b8:	eb f5                	jmp    8010af <memcmp+0x37>
+
+008010ba <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8010c3:	89 c2                	mov    %eax,%edx
+  8010c5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8010c8:	39 d0                	cmp    %edx,%eax
+  8010ca:	73 0d                	jae    8010d9 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8010cc:	38 08                	cmp    %cl,(%eax)
+  8010ce:	74 0d                	je     8010dd <memfind+0x23>
+	for (; s < ends; s++)
+  8010d0:	83 c0 01             	add    $0x1,%eax
+  8010d3:	39 c2                	cmp    %eax,%edx
+  8010d5:	75 f5                	jne    8010cc <memfind+0x12>
+  8010d7:	eb 06                	jmp    8010df <memfind+0x25>
+  8010d9:	89 c2                	mov    %eax,%edx
+  8010db:	eb 02                	jmp    8010df <memfind+0x25>
+  8010dd:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  8010df:	89 d0                	mov    %edx,%eax
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+
+008010e3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8010ef:	0f b6 02             	movzbl (%edx),%eax
+  8010f2:	3c 20                	cmp    $0x20,%al
+  8010f4:	74 04                	je     8010fa <strtol+0x17>
+  8010f6:	3c 09                	cmp    $0x9,%al
+  8010f8:	75 0e                	jne    801108 <strtol+0x25>
+		s++;
+  8010fa:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8010fd:	0f b6 02             	movzbl (%edx),%eax
+  801100:	3c 20                	cmp    $0x20,%al
+  801102:	74 f6                	je     8010fa <strtol+0x17>
+  801104:	3c 09                	cmp    $0x9,%al
+  801106:	74 f2                	je     8010fa <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  801108:	3c 2b                	cmp    $0x2b,%al
+  80110a:	74 2a                	je     801136 <strtol+0x53>
+	int neg = 0;
+  80110c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801111:	3c 2d                	cmp    $0x2d,%al
+  801113:	74 2b                	je     801140 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801115:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80111b:	75 0f                	jne    80112c <strtol+0x49>
+  80111d:	80 3a 30             	cmpb   $0x30,(%edx)
+  801120:	74 28                	je     80114a <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801122:	85 db                	test   %ebx,%ebx
+  801124:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801129:	0f 44 d8             	cmove  %eax,%ebx
+  80112c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801131:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801134:	eb 46                	jmp    80117c <strtol+0x99>
+		s++;
+  801136:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801139:	bf 00 00 00 00       	mov    $0x0,%edi
+  80113e:	eb d5                	jmp    801115 <strtol+0x32>
+		s++, neg = 1;
+  801140:	83 c2 01             	add    $0x1,%edx
+  801143:	bf 01 00 00 00       	mov    $0x1,%edi
+  801148:	eb cb                	jmp    801115 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80114a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80114e:	74 0e                	je     80115e <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  801150:	85 db                	test   %ebx,%ebx
+  801152:	75 d8                	jne    80112c <strtol+0x49>
+		s++, base = 8;
+  801154:	83 c2 01             	add    $0x1,%edx
+  801157:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80115c:	eb ce                	jmp    80112c <strtol+0x49>
+		s += 2, base = 16;
+  80115e:	83 c2 02             	add    $0x2,%edx
+  801161:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801166:	eb c4                	jmp    80112c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801168:	0f be c0             	movsbl %al,%eax
+  80116b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80116e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801171:	7d 3a                	jge    8011ad <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  801173:	83 c2 01             	add    $0x1,%edx
+  801176:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80117a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80117c:	0f b6 02             	movzbl (%edx),%eax
+  80117f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801182:	89 f3                	mov    %esi,%ebx
+  801184:	80 fb 09             	cmp    $0x9,%bl
+  801187:	76 df                	jbe    801168 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  801189:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80118c:	89 f3                	mov    %esi,%ebx
+  80118e:	80 fb 19             	cmp    $0x19,%bl
+  801191:	77 08                	ja     80119b <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  801193:	0f be c0             	movsbl %al,%eax
+  801196:	83 e8 57             	sub    $0x57,%eax
+  801199:	eb d3                	jmp    80116e <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80119b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80119e:	89 f3                	mov    %esi,%ebx
+  8011a0:	80 fb 19             	cmp    $0x19,%bl
+  8011a3:	77 08                	ja     8011ad <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8011a5:	0f be c0             	movsbl %al,%eax
+  8011a8:	83 e8 37             	sub    $0x37,%eax
+  8011ab:	eb c1                	jmp    80116e <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8011ad:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8011b1:	74 05                	je     8011b8 <strtol+0xd5>
+		*endptr = (char *) s;
+  8011b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011b6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8011b8:	89 c8                	mov    %ecx,%eax
+  8011ba:	f7 d8                	neg    %eax
+  8011bc:	85 ff                	test   %edi,%edi
+  8011be:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8011c1:	89 c8                	mov    %ecx,%eax
+  8011c3:	5b                   	pop    %ebx
+  8011c4:	5e                   	pop    %esi
+  8011c5:	5f                   	pop    %edi
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	c3                   	ret
+
+008011c8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d9:	89 c3                	mov    %eax,%ebx
+  8011db:	89 c7                	mov    %eax,%edi
+  8011dd:	89 c6                	mov    %eax,%esi
+  8011df:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f6:	89 d1                	mov    %edx,%ecx
+  8011f8:	89 d3                	mov    %edx,%ebx
+  8011fa:	89 d7                	mov    %edx,%edi
+  8011fc:	89 d6                	mov    %edx,%esi
+  8011fe:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801200:	5b                   	pop    %ebx
+  801201:	5e                   	pop    %esi
+  801202:	5f                   	pop    %edi
+  801203:	5d                   	pop    %ebp
+  801204:	c3                   	ret
+
+00801205 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80120e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801213:	8b 55 08             	mov    0x8(%ebp),%edx
+  801216:	b8 03 00 00 00       	mov    $0x3,%eax
+  80121b:	89 cb                	mov    %ecx,%ebx
+  80121d:	89 cf                	mov    %ecx,%edi
+  80121f:	89 ce                	mov    %ecx,%esi
+  801221:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801223:	85 c0                	test   %eax,%eax
+  801225:	7f 08                	jg     80122f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801227:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122a:	5b                   	pop    %ebx
+  80122b:	5e                   	pop    %esi
+  80122c:	5f                   	pop    %edi
+  80122d:	5d                   	pop    %ebp
+  80122e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80122f:	83 ec 0c             	sub    $0xc,%esp
+  801232:	50                   	push   %eax
+  801233:	6a 03                	push   $0x3
+  801235:	68 ab 57 80 00       	push   $0x8057ab
+  80123a:	6a 23                	push   $0x23
+  80123c:	68 c8 57 80 00       	push   $0x8057c8
+  801241:	e8 38 f4 ff ff       	call   80067e <_panic>
+
+00801246 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	57                   	push   %edi
+  80124a:	56                   	push   %esi
+  80124b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801251:	b8 02 00 00 00       	mov    $0x2,%eax
+  801256:	89 d1                	mov    %edx,%ecx
+  801258:	89 d3                	mov    %edx,%ebx
+  80125a:	89 d7                	mov    %edx,%edi
+  80125c:	89 d6                	mov    %edx,%esi
+  80125e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801260:	5b                   	pop    %ebx
+  801261:	5e                   	pop    %esi
+  801262:	5f                   	pop    %edi
+  801263:	5d                   	pop    %ebp
+  801264:	c3                   	ret
+
+00801265 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801265:	55                   	push   %ebp
+  801266:	89 e5                	mov    %esp,%ebp
+  801268:	57                   	push   %edi
+  801269:	56                   	push   %esi
+  80126a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80126b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801270:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801275:	89 d1                	mov    %edx,%ecx
+  801277:	89 d3                	mov    %edx,%ebx
+  801279:	89 d7                	mov    %edx,%edi
+  80127b:	89 d6                	mov    %edx,%esi
+  80127d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80128d:	be 00 00 00 00       	mov    $0x0,%esi
+  801292:	8b 55 08             	mov    0x8(%ebp),%edx
+  801295:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801298:	b8 04 00 00 00       	mov    $0x4,%eax
+  80129d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a0:	89 f7                	mov    %esi,%edi
+  8012a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012a4:	85 c0                	test   %eax,%eax
+  8012a6:	7f 08                	jg     8012b0 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8012a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ab:	5b                   	pop    %ebx
+  8012ac:	5e                   	pop    %esi
+  8012ad:	5f                   	pop    %edi
+  8012ae:	5d                   	pop    %ebp
+  8012af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b0:	83 ec 0c             	sub    $0xc,%esp
+  8012b3:	50                   	push   %eax
+  8012b4:	6a 04                	push   $0x4
+  8012b6:	68 ab 57 80 00       	push   $0x8057ab
+  8012bb:	6a 23                	push   $0x23
+  8012bd:	68 c8 57 80 00       	push   $0x8057c8
+  8012c2:	e8 b7 f3 ff ff       	call   80067e <_panic>
+
+008012c7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	57                   	push   %edi
+  8012cb:	56                   	push   %esi
+  8012cc:	53                   	push   %ebx
+  8012cd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012e1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e6:	85 c0                	test   %eax,%eax
+  8012e8:	7f 08                	jg     8012f2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8012ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ed:	5b                   	pop    %ebx
+  8012ee:	5e                   	pop    %esi
+  8012ef:	5f                   	pop    %edi
+  8012f0:	5d                   	pop    %ebp
+  8012f1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f2:	83 ec 0c             	sub    $0xc,%esp
+  8012f5:	50                   	push   %eax
+  8012f6:	6a 05                	push   $0x5
+  8012f8:	68 ab 57 80 00       	push   $0x8057ab
+  8012fd:	6a 23                	push   $0x23
+  8012ff:	68 c8 57 80 00       	push   $0x8057c8
+  801304:	e8 75 f3 ff ff       	call   80067e <_panic>
+
+00801309 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	57                   	push   %edi
+  80130d:	56                   	push   %esi
+  80130e:	53                   	push   %ebx
+  80130f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801312:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801317:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801322:	89 df                	mov    %ebx,%edi
+  801324:	89 de                	mov    %ebx,%esi
+  801326:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	7f 08                	jg     801334 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80132c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132f:	5b                   	pop    %ebx
+  801330:	5e                   	pop    %esi
+  801331:	5f                   	pop    %edi
+  801332:	5d                   	pop    %ebp
+  801333:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801334:	83 ec 0c             	sub    $0xc,%esp
+  801337:	50                   	push   %eax
+  801338:	6a 06                	push   $0x6
+  80133a:	68 ab 57 80 00       	push   $0x8057ab
+  80133f:	6a 23                	push   $0x23
+  801341:	68 c8 57 80 00       	push   $0x8057c8
+  801346:	e8 33 f3 ff ff       	call   80067e <_panic>
+
+0080134b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	57                   	push   %edi
+  80134f:	56                   	push   %esi
+  801350:	53                   	push   %ebx
+  801351:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801354:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801359:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801364:	89 df                	mov    %ebx,%edi
+  801366:	89 de                	mov    %ebx,%esi
+  801368:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80136a:	85 c0                	test   %eax,%eax
+  80136c:	7f 08                	jg     801376 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80136e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801371:	5b                   	pop    %ebx
+  801372:	5e                   	pop    %esi
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801376:	83 ec 0c             	sub    $0xc,%esp
+  801379:	50                   	push   %eax
+  80137a:	6a 08                	push   $0x8
+  80137c:	68 ab 57 80 00       	push   $0x8057ab
+  801381:	6a 23                	push   $0x23
+  801383:	68 c8 57 80 00       	push   $0x8057c8
+  801388:	e8 f1 f2 ff ff       	call   80067e <_panic>
+
+0080138d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	57                   	push   %edi
+  801391:	56                   	push   %esi
+  801392:	53                   	push   %ebx
+  801393:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8013a6:	89 df                	mov    %ebx,%edi
+  8013a8:	89 de                	mov    %ebx,%esi
+  8013aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	7f 08                	jg     8013b8 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8013b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b3:	5b                   	pop    %ebx
+  8013b4:	5e                   	pop    %esi
+  8013b5:	5f                   	pop    %edi
+  8013b6:	5d                   	pop    %ebp
+  8013b7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b8:	83 ec 0c             	sub    $0xc,%esp
+  8013bb:	50                   	push   %eax
+  8013bc:	6a 09                	push   $0x9
+  8013be:	68 ab 57 80 00       	push   $0x8057ab
+  8013c3:	6a 23                	push   $0x23
+  8013c5:	68 c8 57 80 00       	push   $0x8057c8
+  8013ca:	e8 af f2 ff ff       	call   80067e <_panic>
+
+008013cf <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	57                   	push   %edi
+  8013d3:	56                   	push   %esi
+  8013d4:	53                   	push   %ebx
+  8013d5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013e8:	89 df                	mov    %ebx,%edi
+  8013ea:	89 de                	mov    %ebx,%esi
+  8013ec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013ee:	85 c0                	test   %eax,%eax
+  8013f0:	7f 08                	jg     8013fa <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8013f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f5:	5b                   	pop    %ebx
+  8013f6:	5e                   	pop    %esi
+  8013f7:	5f                   	pop    %edi
+  8013f8:	5d                   	pop    %ebp
+  8013f9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013fa:	83 ec 0c             	sub    $0xc,%esp
+  8013fd:	50                   	push   %eax
+  8013fe:	6a 0a                	push   $0xa
+  801400:	68 ab 57 80 00       	push   $0x8057ab
+  801405:	6a 23                	push   $0x23
+  801407:	68 c8 57 80 00       	push   $0x8057c8
+  80140c:	e8 6d f2 ff ff       	call   80067e <_panic>
+
+00801411 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801411:	55                   	push   %ebp
+  801412:	89 e5                	mov    %esp,%ebp
+  801414:	57                   	push   %edi
+  801415:	56                   	push   %esi
+  801416:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801417:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801422:	be 00 00 00 00       	mov    $0x0,%esi
+  801427:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80142d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80142f:	5b                   	pop    %ebx
+  801430:	5e                   	pop    %esi
+  801431:	5f                   	pop    %edi
+  801432:	5d                   	pop    %ebp
+  801433:	c3                   	ret
+
+00801434 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801434:	55                   	push   %ebp
+  801435:	89 e5                	mov    %esp,%ebp
+  801437:	57                   	push   %edi
+  801438:	56                   	push   %esi
+  801439:	53                   	push   %ebx
+  80143a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80143d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801442:	8b 55 08             	mov    0x8(%ebp),%edx
+  801445:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80144a:	89 cb                	mov    %ecx,%ebx
+  80144c:	89 cf                	mov    %ecx,%edi
+  80144e:	89 ce                	mov    %ecx,%esi
+  801450:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801452:	85 c0                	test   %eax,%eax
+  801454:	7f 08                	jg     80145e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801456:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801459:	5b                   	pop    %ebx
+  80145a:	5e                   	pop    %esi
+  80145b:	5f                   	pop    %edi
+  80145c:	5d                   	pop    %ebp
+  80145d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80145e:	83 ec 0c             	sub    $0xc,%esp
+  801461:	50                   	push   %eax
+  801462:	6a 0d                	push   $0xd
+  801464:	68 ab 57 80 00       	push   $0x8057ab
+  801469:	6a 23                	push   $0x23
+  80146b:	68 c8 57 80 00       	push   $0x8057c8
+  801470:	e8 09 f2 ff ff       	call   80067e <_panic>
+
+00801475 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801475:	55                   	push   %ebp
+  801476:	89 e5                	mov    %esp,%ebp
+  801478:	57                   	push   %edi
+  801479:	56                   	push   %esi
+  80147a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80147b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801481:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801486:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801489:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80148c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80148f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801491:	5b                   	pop    %ebx
+  801492:	5e                   	pop    %esi
+  801493:	5f                   	pop    %edi
+  801494:	5d                   	pop    %ebp
+  801495:	c3                   	ret
+
+00801496 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801496:	55                   	push   %ebp
+  801497:	89 e5                	mov    %esp,%ebp
+  801499:	57                   	push   %edi
+  80149a:	56                   	push   %esi
+  80149b:	53                   	push   %ebx
+  80149c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80149f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014aa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014af:	89 df                	mov    %ebx,%edi
+  8014b1:	89 de                	mov    %ebx,%esi
+  8014b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014b5:	85 c0                	test   %eax,%eax
+  8014b7:	7f 08                	jg     8014c1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8014b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014bc:	5b                   	pop    %ebx
+  8014bd:	5e                   	pop    %esi
+  8014be:	5f                   	pop    %edi
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014c1:	83 ec 0c             	sub    $0xc,%esp
+  8014c4:	50                   	push   %eax
+  8014c5:	6a 0d                	push   $0xd
+  8014c7:	68 ab 57 80 00       	push   $0x8057ab
+  8014cc:	6a 23                	push   $0x23
+  8014ce:	68 c8 57 80 00       	push   $0x8057c8
+  8014d3:	e8 a6 f1 ff ff       	call   80067e <_panic>
+
+008014d8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	57                   	push   %edi
+  8014dc:	56                   	push   %esi
+  8014dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014e8:	89 d1                	mov    %edx,%ecx
+  8014ea:	89 d3                	mov    %edx,%ebx
+  8014ec:	89 d7                	mov    %edx,%edi
+  8014ee:	89 d6                	mov    %edx,%esi
+  8014f0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014f2:	5b                   	pop    %ebx
+  8014f3:	5e                   	pop    %esi
+  8014f4:	5f                   	pop    %edi
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+
+008014f7 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	57                   	push   %edi
+  8014fb:	56                   	push   %esi
+  8014fc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801502:	8b 55 08             	mov    0x8(%ebp),%edx
+  801505:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801508:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80150d:	89 df                	mov    %ebx,%edi
+  80150f:	89 de                	mov    %ebx,%esi
+  801511:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801513:	5b                   	pop    %ebx
+  801514:	5e                   	pop    %esi
+  801515:	5f                   	pop    %edi
+  801516:	5d                   	pop    %ebp
+  801517:	c3                   	ret
+
+00801518 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	57                   	push   %edi
+  80151c:	56                   	push   %esi
+  80151d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80151e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801523:	8b 55 08             	mov    0x8(%ebp),%edx
+  801526:	b8 10 00 00 00       	mov    $0x10,%eax
+  80152b:	89 cb                	mov    %ecx,%ebx
+  80152d:	89 cf                	mov    %ecx,%edi
+  80152f:	89 ce                	mov    %ecx,%esi
+  801531:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801533:	5b                   	pop    %ebx
+  801534:	5e                   	pop    %esi
+  801535:	5f                   	pop    %edi
+  801536:	5d                   	pop    %ebp
+  801537:	c3                   	ret
+
+00801538 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	57                   	push   %edi
+  80153c:	56                   	push   %esi
+  80153d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80153e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801543:	8b 55 08             	mov    0x8(%ebp),%edx
+  801546:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801549:	b8 11 00 00 00       	mov    $0x11,%eax
+  80154e:	89 df                	mov    %ebx,%edi
+  801550:	89 de                	mov    %ebx,%esi
+  801552:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801554:	5b                   	pop    %ebx
+  801555:	5e                   	pop    %esi
+  801556:	5f                   	pop    %edi
+  801557:	5d                   	pop    %ebp
+  801558:	c3                   	ret
+
+00801559 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801559:	55                   	push   %ebp
+  80155a:	89 e5                	mov    %esp,%ebp
+  80155c:	57                   	push   %edi
+  80155d:	56                   	push   %esi
+  80155e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80155f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801564:	8b 55 08             	mov    0x8(%ebp),%edx
+  801567:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80156f:	89 df                	mov    %ebx,%edi
+  801571:	89 de                	mov    %ebx,%esi
+  801573:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801575:	5b                   	pop    %ebx
+  801576:	5e                   	pop    %esi
+  801577:	5f                   	pop    %edi
+  801578:	5d                   	pop    %ebp
+  801579:	c3                   	ret
+
+0080157a <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80157a:	55                   	push   %ebp
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	57                   	push   %edi
+  80157e:	56                   	push   %esi
+  80157f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801585:	8b 55 08             	mov    0x8(%ebp),%edx
+  801588:	b8 13 00 00 00       	mov    $0x13,%eax
+  80158d:	89 cb                	mov    %ecx,%ebx
+  80158f:	89 cf                	mov    %ecx,%edi
+  801591:	89 ce                	mov    %ecx,%esi
+  801593:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801595:	5b                   	pop    %ebx
+  801596:	5e                   	pop    %esi
+  801597:	5f                   	pop    %edi
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+
+0080159a <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80159a:	55                   	push   %ebp
+  80159b:	89 e5                	mov    %esp,%ebp
+  80159d:	57                   	push   %edi
+  80159e:	56                   	push   %esi
+  80159f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ab:	b8 14 00 00 00       	mov    $0x14,%eax
+  8015b0:	89 df                	mov    %ebx,%edi
+  8015b2:	89 de                	mov    %ebx,%esi
+  8015b4:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8015b6:	5b                   	pop    %ebx
+  8015b7:	5e                   	pop    %esi
+  8015b8:	5f                   	pop    %edi
+  8015b9:	5d                   	pop    %ebp
+  8015ba:	c3                   	ret
+
+008015bb <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	57                   	push   %edi
+  8015bf:	56                   	push   %esi
+  8015c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8015ce:	89 cb                	mov    %ecx,%ebx
+  8015d0:	89 cf                	mov    %ecx,%edi
+  8015d2:	89 ce                	mov    %ecx,%esi
+  8015d4:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8015d6:	5b                   	pop    %ebx
+  8015d7:	5e                   	pop    %esi
+  8015d8:	5f                   	pop    %edi
+  8015d9:	5d                   	pop    %ebp
+  8015da:	c3                   	ret
+
+008015db <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  8015de:	57                   	push   %edi
+  8015df:	56                   	push   %esi
+  8015e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ec:	b8 16 00 00 00       	mov    $0x16,%eax
+  8015f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f4:	89 f7                	mov    %esi,%edi
+  8015f6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8015f8:	5b                   	pop    %ebx
+  8015f9:	5e                   	pop    %esi
+  8015fa:	5f                   	pop    %edi
+  8015fb:	5d                   	pop    %ebp
+  8015fc:	c3                   	ret
+
+008015fd <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	57                   	push   %edi
+  801601:	56                   	push   %esi
+  801602:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801603:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801608:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801613:	89 df                	mov    %ebx,%edi
+  801615:	89 de                	mov    %ebx,%esi
+  801617:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801619:	5b                   	pop    %ebx
+  80161a:	5e                   	pop    %esi
+  80161b:	5f                   	pop    %edi
+  80161c:	5d                   	pop    %ebp
+  80161d:	c3                   	ret
+
+0080161e <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80161e:	55                   	push   %ebp
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	57                   	push   %edi
+  801622:	56                   	push   %esi
+  801623:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801629:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801631:	89 cb                	mov    %ecx,%ebx
+  801633:	89 cf                	mov    %ecx,%edi
+  801635:	89 ce                	mov    %ecx,%esi
+  801637:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801639:	5b                   	pop    %ebx
+  80163a:	5e                   	pop    %esi
+  80163b:	5f                   	pop    %edi
+  80163c:	5d                   	pop    %ebp
+  80163d:	c3                   	ret
+
+0080163e <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  801641:	57                   	push   %edi
+  801642:	56                   	push   %esi
+  801643:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801644:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801648:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801650:	b8 19 00 00 00       	mov    $0x19,%eax
+  801655:	89 df                	mov    %ebx,%edi
+  801657:	89 de                	mov    %ebx,%esi
+  801659:	cd 30                	int    $0x30
+}
+  80165b:	5b                   	pop    %ebx
+  80165c:	5e                   	pop    %esi
+  80165d:	5f                   	pop    %edi
+  80165e:	5d                   	pop    %ebp
+  80165f:	c3                   	ret
+
+00801660 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	57                   	push   %edi
+  801664:	56                   	push   %esi
+  801665:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801666:	be 00 00 00 00       	mov    $0x0,%esi
+  80166b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801671:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801676:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801679:	89 f7                	mov    %esi,%edi
+  80167b:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5f                   	pop    %edi
+  801680:	5d                   	pop    %ebp
+  801681:	c3                   	ret
+
+00801682 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	57                   	push   %edi
+  801686:	56                   	push   %esi
+  801687:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801688:	be 00 00 00 00       	mov    $0x0,%esi
+  80168d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801690:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801693:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801698:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80169b:	89 f7                	mov    %esi,%edi
+  80169d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80169f:	5b                   	pop    %ebx
+  8016a0:	5e                   	pop    %esi
+  8016a1:	5f                   	pop    %edi
+  8016a2:	5d                   	pop    %ebp
+  8016a3:	c3                   	ret
+
+008016a4 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	57                   	push   %edi
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8016ba:	89 df                	mov    %ebx,%edi
+  8016bc:	89 de                	mov    %ebx,%esi
+  8016be:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8016c0:	5b                   	pop    %ebx
+  8016c1:	5e                   	pop    %esi
+  8016c2:	5f                   	pop    %edi
+  8016c3:	5d                   	pop    %ebp
+  8016c4:	c3                   	ret
+
+008016c5 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	57                   	push   %edi
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016de:	89 f7                	mov    %esi,%edi
+  8016e0:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8016e2:	5b                   	pop    %ebx
+  8016e3:	5e                   	pop    %esi
+  8016e4:	5f                   	pop    %edi
+  8016e5:	5d                   	pop    %ebp
+  8016e6:	c3                   	ret
+
+008016e7 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	74 20                	je     80170b <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8016eb:	89 c1                	mov    %eax,%ecx
+  8016ed:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8016f3:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8016f9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8016ff:	8b 52 48             	mov    0x48(%edx),%edx
+  801702:	39 c2                	cmp    %eax,%edx
+  801704:	74 06                	je     80170c <thread_alive+0x25>
+  801706:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80170b:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80170c:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801712:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801718:	85 c0                	test   %eax,%eax
+  80171a:	0f 95 c0             	setne  %al
+  80171d:	0f b6 c0             	movzbl %al,%eax
+  801720:	c3                   	ret
+
+00801721 <pgfault>:
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	57                   	push   %edi
+  801725:	56                   	push   %esi
+  801726:	53                   	push   %ebx
+  801727:	83 ec 0c             	sub    $0xc,%esp
+  80172a:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80172d:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  80172f:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801732:	89 f3                	mov    %esi,%ebx
+  801734:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801737:	83 3d c0 80 84 00 00 	cmpl   $0x0,0x8480c0
+  80173e:	74 52                	je     801792 <pgfault+0x71>
+  801740:	a8 02                	test   $0x2,%al
+  801742:	75 14                	jne    801758 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801744:	83 ec 04             	sub    $0x4,%esp
+  801747:	68 d6 57 80 00       	push   $0x8057d6
+  80174c:	6a 2e                	push   $0x2e
+  80174e:	68 f4 57 80 00       	push   $0x8057f4
+  801753:	e8 26 ef ff ff       	call   80067e <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801758:	89 d8                	mov    %ebx,%eax
+  80175a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80175f:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801766:	83 ec 0c             	sub    $0xc,%esp
+  801769:	57                   	push   %edi
+  80176a:	e8 65 32 00 00       	call   8049d4 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80176f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801776:	83 e0 03             	and    $0x3,%eax
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	83 f8 03             	cmp    $0x3,%eax
+  80177f:	75 1a                	jne    80179b <pgfault+0x7a>
+			mutex_unlock(m);
+  801781:	83 ec 0c             	sub    $0xc,%esp
+  801784:	57                   	push   %edi
+  801785:	e8 b8 32 00 00       	call   804a42 <mutex_unlock>
+			return;
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	e9 9f 00 00 00       	jmp    801831 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801792:	a8 02                	test   $0x2,%al
+  801794:	74 ae                	je     801744 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801796:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80179b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8017a2:	f6 c4 08             	test   $0x8,%ah
+  8017a5:	74 9d                	je     801744 <pgfault+0x23>
+  8017a7:	89 e0                	mov    %esp,%eax
+  8017a9:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8017ae:	29 c2                	sub    %eax,%edx
+  8017b0:	89 d0                	mov    %edx,%eax
+  8017b2:	c1 e8 0f             	shr    $0xf,%eax
+  8017b5:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8017bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c0:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8017c3:	c1 e0 0c             	shl    $0xc,%eax
+  8017c6:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8017cb:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8017cd:	83 ec 04             	sub    $0x4,%esp
+  8017d0:	6a 07                	push   $0x7
+  8017d2:	53                   	push   %ebx
+  8017d3:	6a 00                	push   $0x0
+  8017d5:	e8 aa fa ff ff       	call   801284 <sys_page_alloc>
+  8017da:	83 c4 10             	add    $0x10,%esp
+  8017dd:	85 c0                	test   %eax,%eax
+  8017df:	78 58                	js     801839 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8017e1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8017e7:	83 ec 04             	sub    $0x4,%esp
+  8017ea:	68 00 10 00 00       	push   $0x1000
+  8017ef:	56                   	push   %esi
+  8017f0:	53                   	push   %ebx
+  8017f1:	e8 0a f8 ff ff       	call   801000 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8017f6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8017fd:	56                   	push   %esi
+  8017fe:	6a 00                	push   $0x0
+  801800:	53                   	push   %ebx
+  801801:	6a 00                	push   $0x0
+  801803:	e8 bf fa ff ff       	call   8012c7 <sys_page_map>
+  801808:	83 c4 20             	add    $0x20,%esp
+  80180b:	85 c0                	test   %eax,%eax
+  80180d:	78 3c                	js     80184b <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  80180f:	83 ec 08             	sub    $0x8,%esp
+  801812:	53                   	push   %ebx
+  801813:	6a 00                	push   $0x0
+  801815:	e8 ef fa ff ff       	call   801309 <sys_page_unmap>
+  80181a:	83 c4 10             	add    $0x10,%esp
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	78 3c                	js     80185d <pgfault+0x13c>
+	if(m)
+  801821:	85 ff                	test   %edi,%edi
+  801823:	74 0c                	je     801831 <pgfault+0x110>
+		mutex_unlock(m);
+  801825:	83 ec 0c             	sub    $0xc,%esp
+  801828:	57                   	push   %edi
+  801829:	e8 14 32 00 00       	call   804a42 <mutex_unlock>
+  80182e:	83 c4 10             	add    $0x10,%esp
+}
+  801831:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801834:	5b                   	pop    %ebx
+  801835:	5e                   	pop    %esi
+  801836:	5f                   	pop    %edi
+  801837:	5d                   	pop    %ebp
+  801838:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801839:	50                   	push   %eax
+  80183a:	68 ff 57 80 00       	push   $0x8057ff
+  80183f:	6a 3d                	push   $0x3d
+  801841:	68 f4 57 80 00       	push   $0x8057f4
+  801846:	e8 33 ee ff ff       	call   80067e <_panic>
+		panic("sys_page_map: %e", ret);
+  80184b:	50                   	push   %eax
+  80184c:	68 0e 54 80 00       	push   $0x80540e
+  801851:	6a 40                	push   $0x40
+  801853:	68 f4 57 80 00       	push   $0x8057f4
+  801858:	e8 21 ee ff ff       	call   80067e <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80185d:	50                   	push   %eax
+  80185e:	68 12 58 80 00       	push   $0x805812
+  801863:	6a 42                	push   $0x42
+  801865:	68 f4 57 80 00       	push   $0x8057f4
+  80186a:	e8 0f ee ff ff       	call   80067e <_panic>
+
+0080186f <thread_main>:
+{
+  80186f:	55                   	push   %ebp
+  801870:	89 e5                	mov    %esp,%ebp
+  801872:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801875:	ff 75 0c             	push   0xc(%ebp)
+  801878:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80187b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801882:	e8 7e f9 ff ff       	call   801205 <sys_env_destroy>
+}
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	c9                   	leave
+  80188b:	c3                   	ret
+
+0080188c <fork>:
+{
+  80188c:	55                   	push   %ebp
+  80188d:	89 e5                	mov    %esp,%ebp
+  80188f:	57                   	push   %edi
+  801890:	56                   	push   %esi
+  801891:	53                   	push   %ebx
+  801892:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801895:	68 21 17 80 00       	push   $0x801721
+  80189a:	e8 81 34 00 00       	call   804d20 <set_pgfault_handler>
+	if(sforked)
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	83 3d c0 80 84 00 00 	cmpl   $0x0,0x8480c0
+  8018a9:	75 33                	jne    8018de <fork+0x52>
+	__asm __volatile("int %2"
+  8018ab:	b8 07 00 00 00       	mov    $0x7,%eax
+  8018b0:	cd 30                	int    $0x30
+  8018b2:	89 c7                	mov    %eax,%edi
+  8018b4:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8018b6:	85 c0                	test   %eax,%eax
+  8018b8:	0f 88 b4 00 00 00    	js     801972 <fork+0xe6>
+	if(envid == 0) {
+  8018be:	0f 84 c3 00 00 00    	je     801987 <fork+0xfb>
+	pgbatch_init(&pb);
+  8018c4:	83 ec 0c             	sub    $0xc,%esp
+  8018c7:	68 20 73 84 00       	push   $0x847320
+  8018cc:	e8 4f 2f 00 00       	call   804820 <pgbatch_init>
+  8018d1:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8018d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d9:	e9 9c 01 00 00       	jmp    801a7a <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8018de:	83 ec 0c             	sub    $0xc,%esp
+  8018e1:	68 c0 76 84 00       	push   $0x8476c0
+  8018e6:	e8 e9 30 00 00       	call   8049d4 <mutex_lock>
+  8018eb:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8018ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8018f3:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8018f8:	eb 08                	jmp    801902 <fork+0x76>
+  8018fa:	83 c3 01             	add    $0x1,%ebx
+  8018fd:	83 fb 20             	cmp    $0x20,%ebx
+  801900:	74 5b                	je     80195d <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801902:	8b 34 9d 40 76 84 00 	mov    0x847640(,%ebx,4),%esi
+  801909:	89 f0                	mov    %esi,%eax
+  80190b:	e8 d7 fd ff ff       	call   8016e7 <thread_alive>
+  801910:	85 c0                	test   %eax,%eax
+  801912:	74 e6                	je     8018fa <fork+0x6e>
+  801914:	89 e0                	mov    %esp,%eax
+  801916:	89 fa                	mov    %edi,%edx
+  801918:	29 c2                	sub    %eax,%edx
+  80191a:	89 d0                	mov    %edx,%eax
+  80191c:	c1 e8 0f             	shr    $0xf,%eax
+  80191f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801925:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80192a:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80192d:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  801934:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801937:	83 ec 08             	sub    $0x8,%esp
+  80193a:	50                   	push   %eax
+  80193b:	56                   	push   %esi
+  80193c:	e8 8e fa ff ff       	call   8013cf <sys_env_set_pgfault_upcall>
+  801941:	83 c4 10             	add    $0x10,%esp
+  801944:	85 c0                	test   %eax,%eax
+  801946:	79 b2                	jns    8018fa <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801948:	50                   	push   %eax
+  801949:	68 9c 58 80 00       	push   $0x80589c
+  80194e:	68 00 01 00 00       	push   $0x100
+  801953:	68 f4 57 80 00       	push   $0x8057f4
+  801958:	e8 21 ed ff ff       	call   80067e <_panic>
+	mutex_unlock(&sfork_lock);
+  80195d:	83 ec 0c             	sub    $0xc,%esp
+  801960:	68 c0 76 84 00       	push   $0x8476c0
+  801965:	e8 d8 30 00 00       	call   804a42 <mutex_unlock>
+}
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	e9 39 ff ff ff       	jmp    8018ab <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801972:	50                   	push   %eax
+  801973:	68 25 58 80 00       	push   $0x805825
+  801978:	68 91 00 00 00       	push   $0x91
+  80197d:	68 f4 57 80 00       	push   $0x8057f4
+  801982:	e8 f7 ec ff ff       	call   80067e <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801987:	e8 ba f8 ff ff       	call   801246 <sys_getenvid>
+  80198c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801991:	89 e1                	mov    %esp,%ecx
+  801993:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801998:	29 ca                	sub    %ecx,%edx
+  80199a:	89 d1                	mov    %edx,%ecx
+  80199c:	c1 e9 0f             	shr    $0xf,%ecx
+  80199f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8019a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019aa:	0f 42 d1             	cmovb  %ecx,%edx
+  8019ad:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8019b3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019b8:	89 04 95 40 80 84 00 	mov    %eax,0x848040(,%edx,4)
+		if(sforked)
+  8019bf:	a1 c0 80 84 00       	mov    0x8480c0,%eax
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	75 07                	jne    8019cf <fork+0x143>
+		return 0;
+  8019c8:	89 c6                	mov    %eax,%esi
+  8019ca:	e9 6f 02 00 00       	jmp    801c3e <fork+0x3b2>
+  8019cf:	89 e2                	mov    %esp,%edx
+  8019d1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8019d6:	29 d0                	sub    %edx,%eax
+  8019d8:	89 c3                	mov    %eax,%ebx
+  8019da:	c1 eb 0f             	shr    $0xf,%ebx
+  8019dd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e7:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8019ea:	83 ec 04             	sub    $0x4,%esp
+  8019ed:	68 80 00 00 00       	push   $0x80
+  8019f2:	6a 00                	push   $0x0
+  8019f4:	68 40 76 84 00       	push   $0x847640
+  8019f9:	e8 cd f5 ff ff       	call   800fcb <memset>
+	thread_ids[slot] = sys_getenvid();
+  8019fe:	e8 43 f8 ff ff       	call   801246 <sys_getenvid>
+  801a03:	89 04 9d 40 76 84 00 	mov    %eax,0x847640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  801a0a:	8b 04 9d 40 80 84 00 	mov    0x848040(,%ebx,4),%eax
+  801a11:	a3 40 80 84 00       	mov    %eax,0x848040
+	mutex_init(&sfork_lock);
+  801a16:	c7 04 24 c0 76 84 00 	movl   $0x8476c0,(%esp)
+  801a1d:	e8 a4 2f 00 00       	call   8049c6 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801a22:	83 c4 0c             	add    $0xc,%esp
+  801a25:	68 07 04 00 00       	push   $0x407
+  801a2a:	68 00 00 00 e1       	push   $0xe1000000
+  801a2f:	6a 00                	push   $0x0
+  801a31:	e8 4e f8 ff ff       	call   801284 <sys_page_alloc>
+  801a36:	83 c4 10             	add    $0x10,%esp
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	0f 89 fd 01 00 00    	jns    801c3e <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801a41:	50                   	push   %eax
+  801a42:	68 ff 57 80 00       	push   $0x8057ff
+  801a47:	68 12 01 00 00       	push   $0x112
+  801a4c:	68 f4 57 80 00       	push   $0x8057f4
+  801a51:	e8 28 ec ff ff       	call   80067e <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801a56:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801a5c:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801a62:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801a68:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a6e:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801a74:	0f 87 4f 01 00 00    	ja     801bc9 <fork+0x33d>
+		pd = PDX(addr);
+  801a7a:	89 d8                	mov    %ebx,%eax
+  801a7c:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801a7f:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801a86:	f6 c2 01             	test   $0x1,%dl
+  801a89:	74 cb                	je     801a56 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801a8b:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801a90:	0f 85 92 00 00 00    	jne    801b28 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801a96:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801a9c:	76 10                	jbe    801aae <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801a9e:	89 d8                	mov    %ebx,%eax
+  801aa0:	f7 d8                	neg    %eax
+  801aa2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801aa7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801aac:	74 ba                	je     801a68 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801aae:	89 d8                	mov    %ebx,%eax
+  801ab0:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801ab3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801aba:	f6 c2 01             	test   $0x1,%dl
+  801abd:	74 a9                	je     801a68 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801abf:	89 c1                	mov    %eax,%ecx
+  801ac1:	c1 e1 0c             	shl    $0xc,%ecx
+  801ac4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801ac7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ace:	f6 c6 04             	test   $0x4,%dh
+  801ad1:	0f 85 8e 00 00 00    	jne    801b65 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801ad7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ade:	f6 c6 08             	test   $0x8,%dh
+  801ae1:	75 0f                	jne    801af2 <fork+0x266>
+  801ae3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aea:	a8 02                	test   $0x2,%al
+  801aec:	0f 84 bb 00 00 00    	je     801bad <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801af2:	83 ec 08             	sub    $0x8,%esp
+  801af5:	68 05 08 00 00       	push   $0x805
+  801afa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801afd:	50                   	push   %eax
+  801afe:	56                   	push   %esi
+  801aff:	50                   	push   %eax
+  801b00:	6a 00                	push   $0x0
+  801b02:	68 20 73 84 00       	push   $0x847320
+  801b07:	e8 d2 2d 00 00       	call   8048de <pgbatch_map>
+  801b0c:	83 c4 20             	add    $0x20,%esp
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	79 76                	jns    801b89 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801b13:	50                   	push   %eax
+  801b14:	68 49 58 80 00       	push   $0x805849
+  801b19:	68 bc 00 00 00       	push   $0xbc
+  801b1e:	68 f4 57 80 00       	push   $0x8057f4
+  801b23:	e8 56 eb ff ff       	call   80067e <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801b28:	83 ec 0c             	sub    $0xc,%esp
+  801b2b:	68 00 08 00 00       	push   $0x800
+  801b30:	56                   	push   %esi
+  801b31:	53                   	push   %ebx
+  801b32:	6a 00                	push   $0x0
+  801b34:	68 20 73 84 00       	push   $0x847320
+  801b39:	e8 4b 2e 00 00       	call   804989 <pgbatch_sharept>
+  801b3e:	83 c4 20             	add    $0x20,%esp
+  801b41:	85 c0                	test   %eax,%eax
+  801b43:	78 0b                	js     801b50 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801b45:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801b4b:	e9 18 ff ff ff       	jmp    801a68 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801b50:	50                   	push   %eax
+  801b51:	68 35 58 80 00       	push   $0x805835
+  801b56:	68 b2 00 00 00       	push   $0xb2
+  801b5b:	68 f4 57 80 00       	push   $0x8057f4
+  801b60:	e8 19 eb ff ff       	call   80067e <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801b65:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b6c:	83 ec 08             	sub    $0x8,%esp
+  801b6f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b74:	50                   	push   %eax
+  801b75:	51                   	push   %ecx
+  801b76:	56                   	push   %esi
+  801b77:	51                   	push   %ecx
+  801b78:	6a 00                	push   $0x0
+  801b7a:	68 20 73 84 00       	push   $0x847320
+  801b7f:	e8 5a 2d 00 00       	call   8048de <pgbatch_map>
+  801b84:	83 c4 20             	add    $0x20,%esp
+  801b87:	eb 17                	jmp    801ba0 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801b89:	68 05 08 00 00       	push   $0x805
+  801b8e:	ff 75 e4             	push   -0x1c(%ebp)
+  801b91:	6a 00                	push   $0x0
+  801b93:	68 20 73 84 00       	push   $0x847320
+  801b98:	e8 b5 2d 00 00       	call   804952 <pgbatch_protect>
+  801b9d:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801ba0:	85 c0                	test   %eax,%eax
+  801ba2:	0f 89 c0 fe ff ff    	jns    801a68 <fork+0x1dc>
+  801ba8:	e9 66 ff ff ff       	jmp    801b13 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801bad:	83 ec 08             	sub    $0x8,%esp
+  801bb0:	6a 05                	push   $0x5
+  801bb2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bb5:	50                   	push   %eax
+  801bb6:	56                   	push   %esi
+  801bb7:	50                   	push   %eax
+  801bb8:	6a 00                	push   $0x0
+  801bba:	68 20 73 84 00       	push   $0x847320
+  801bbf:	e8 1a 2d 00 00       	call   8048de <pgbatch_map>
+  801bc4:	83 c4 20             	add    $0x20,%esp
+  801bc7:	eb d7                	jmp    801ba0 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801bc9:	6a 07                	push   $0x7
+  801bcb:	68 00 f0 bf ee       	push   $0xeebff000
+  801bd0:	57                   	push   %edi
+  801bd1:	68 20 73 84 00       	push   $0x847320
+  801bd6:	e8 cc 2c 00 00       	call   8048a7 <pgbatch_alloc>
+  801bdb:	83 c4 10             	add    $0x10,%esp
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	78 66                	js     801c48 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801be2:	83 ec 0c             	sub    $0xc,%esp
+  801be5:	68 20 73 84 00       	push   $0x847320
+  801bea:	e8 3f 2c 00 00       	call   80482e <pgbatch_flush>
+  801bef:	83 c4 10             	add    $0x10,%esp
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 52                	js     801c48 <fork+0x3bc>
+  801bf6:	89 e2                	mov    %esp,%edx
+  801bf8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bfd:	29 d0                	sub    %edx,%eax
+  801bff:	89 c2                	mov    %eax,%edx
+  801c01:	c1 ea 0f             	shr    $0xf,%edx
+  801c04:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0e:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801c11:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  801c18:	8b 40 78             	mov    0x78(%eax),%eax
+  801c1b:	83 ec 08             	sub    $0x8,%esp
+  801c1e:	50                   	push   %eax
+  801c1f:	57                   	push   %edi
+  801c20:	e8 aa f7 ff ff       	call   8013cf <sys_env_set_pgfault_upcall>
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	78 31                	js     801c5d <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801c2c:	83 ec 08             	sub    $0x8,%esp
+  801c2f:	6a 02                	push   $0x2
+  801c31:	57                   	push   %edi
+  801c32:	e8 14 f7 ff ff       	call   80134b <sys_env_set_status>
+  801c37:	83 c4 10             	add    $0x10,%esp
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	78 34                	js     801c72 <fork+0x3e6>
+}
+  801c3e:	89 f0                	mov    %esi,%eax
+  801c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c43:	5b                   	pop    %ebx
+  801c44:	5e                   	pop    %esi
+  801c45:	5f                   	pop    %edi
+  801c46:	5d                   	pop    %ebp
+  801c47:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801c48:	50                   	push   %eax
+  801c49:	68 55 58 80 00       	push   $0x805855
+  801c4e:	68 c0 00 00 00       	push   $0xc0
+  801c53:	68 f4 57 80 00       	push   $0x8057f4
+  801c58:	e8 21 ea ff ff       	call   80067e <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801c5d:	50                   	push   %eax
+  801c5e:	68 6a 58 80 00       	push   $0x80586a
+  801c63:	68 c2 00 00 00       	push   $0xc2
+  801c68:	68 f4 57 80 00       	push   $0x8057f4
+  801c6d:	e8 0c ea ff ff       	call   80067e <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801c72:	50                   	push   %eax
+  801c73:	68 85 58 80 00       	push   $0x805885
+  801c78:	68 c4 00 00 00       	push   $0xc4
+  801c7d:	68 f4 57 80 00       	push   $0x8057f4
+  801c82:	e8 f7 e9 ff ff       	call   80067e <_panic>
+
+00801c87 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	57                   	push   %edi
+  801c8b:	56                   	push   %esi
+  801c8c:	53                   	push   %ebx
+  801c8d:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801c90:	68 c0 76 84 00       	push   $0x8476c0
+  801c95:	e8 3a 2d 00 00       	call   8049d4 <mutex_lock>
+  801c9a:	89 e2                	mov    %esp,%edx
+  801c9c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ca1:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801ca3:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801ca6:	89 c3                	mov    %eax,%ebx
+  801ca8:	c1 eb 0f             	shr    $0xf,%ebx
+  801cab:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb5:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801cb8:	e8 89 f5 ff ff       	call   801246 <sys_getenvid>
+  801cbd:	89 04 9d 40 76 84 00 	mov    %eax,0x847640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801cc4:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801cc9:	8b 04 9d 40 76 84 00 	mov    0x847640(,%ebx,4),%eax
+  801cd0:	e8 12 fa ff ff       	call   8016e7 <thread_alive>
+  801cd5:	85 c0                	test   %eax,%eax
+  801cd7:	74 24                	je     801cfd <sfork+0x76>
+  801cd9:	83 c3 01             	add    $0x1,%ebx
+  801cdc:	83 fb 20             	cmp    $0x20,%ebx
+  801cdf:	75 e8                	jne    801cc9 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801ce1:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801ce6:	83 ec 0c             	sub    $0xc,%esp
+  801ce9:	68 c0 76 84 00       	push   $0x8476c0
+  801cee:	e8 4f 2d 00 00       	call   804a42 <mutex_unlock>
+	return r;
+}
+  801cf3:	89 f0                	mov    %esi,%eax
+  801cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf8:	5b                   	pop    %ebx
+  801cf9:	5e                   	pop    %esi
+  801cfa:	5f                   	pop    %edi
+  801cfb:	5d                   	pop    %ebp
+  801cfc:	c3                   	ret
+	if (i == NTHREADS) {
+  801cfd:	83 fb 20             	cmp    $0x20,%ebx
+  801d00:	0f 84 53 01 00 00    	je     801e59 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801d06:	89 d8                	mov    %ebx,%eax
+  801d08:	c1 e0 0f             	shl    $0xf,%eax
+  801d0b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801d0e:	83 ec 0c             	sub    $0xc,%esp
+  801d11:	68 00 70 84 00       	push   $0x847000
+  801d16:	e8 05 2b 00 00       	call   804820 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	83 3d c0 80 84 00 00 	cmpl   $0x0,0x8480c0
+  801d25:	75 1f                	jne    801d46 <sfork+0xbf>
+  801d27:	68 07 04 00 00       	push   $0x407
+  801d2c:	68 00 00 00 e1       	push   $0xe1000000
+  801d31:	6a 00                	push   $0x0
+  801d33:	68 00 70 84 00       	push   $0x847000
+  801d38:	e8 6a 2b 00 00       	call   8048a7 <pgbatch_alloc>
+  801d3d:	89 c6                	mov    %eax,%esi
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	85 c0                	test   %eax,%eax
+  801d44:	78 a0                	js     801ce6 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801d46:	6a 07                	push   $0x7
+  801d48:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801d4d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d50:	29 c8                	sub    %ecx,%eax
+  801d52:	50                   	push   %eax
+  801d53:	6a 00                	push   $0x0
+  801d55:	68 00 70 84 00       	push   $0x847000
+  801d5a:	e8 48 2b 00 00       	call   8048a7 <pgbatch_alloc>
+  801d5f:	89 c6                	mov    %eax,%esi
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	0f 88 7a ff ff ff    	js     801ce6 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801d6c:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801d71:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d74:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801d76:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801d7b:	29 c8                	sub    %ecx,%eax
+  801d7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d80:	39 c7                	cmp    %eax,%edi
+  801d82:	73 29                	jae    801dad <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801d84:	6a 07                	push   $0x7
+  801d86:	57                   	push   %edi
+  801d87:	6a 00                	push   $0x0
+  801d89:	68 00 70 84 00       	push   $0x847000
+  801d8e:	e8 14 2b 00 00       	call   8048a7 <pgbatch_alloc>
+  801d93:	89 c6                	mov    %eax,%esi
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	0f 88 46 ff ff ff    	js     801ce6 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801da0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801da6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801da9:	39 c7                	cmp    %eax,%edi
+  801dab:	72 d7                	jb     801d84 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801dad:	83 ec 0c             	sub    $0xc,%esp
+  801db0:	68 00 70 84 00       	push   $0x847000
+  801db5:	e8 74 2a 00 00       	call   80482e <pgbatch_flush>
+  801dba:	89 c6                	mov    %eax,%esi
+  801dbc:	83 c4 10             	add    $0x10,%esp
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	0f 88 1f ff ff ff    	js     801ce6 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801dc7:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801dcc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801dcf:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801dd1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801dd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dda:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801ddd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801de0:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801de3:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801de6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801deb:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801ded:	52                   	push   %edx
+  801dee:	50                   	push   %eax
+  801def:	68 6f 18 80 00       	push   $0x80186f
+  801df4:	e8 cc f8 ff ff       	call   8016c5 <sys_exofork_shared>
+  801df9:	89 c6                	mov    %eax,%esi
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	0f 88 e0 fe ff ff    	js     801ce6 <sfork+0x5f>
+	thread_ids[i] = id;
+  801e06:	89 04 9d 40 76 84 00 	mov    %eax,0x847640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801e0d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e12:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801e18:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e1d:	89 04 9d 40 80 84 00 	mov    %eax,0x848040(,%ebx,4)
+	sforked = 1;
+  801e24:	c7 05 c0 80 84 00 01 	movl   $0x1,0x8480c0
+  801e2b:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801e2e:	83 ec 08             	sub    $0x8,%esp
+  801e31:	6a 02                	push   $0x2
+  801e33:	56                   	push   %esi
+  801e34:	e8 12 f5 ff ff       	call   80134b <sys_env_set_status>
+  801e39:	89 c3                	mov    %eax,%ebx
+  801e3b:	83 c4 10             	add    $0x10,%esp
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	0f 89 a0 fe ff ff    	jns    801ce6 <sfork+0x5f>
+		sys_env_destroy(id);
+  801e46:	83 ec 0c             	sub    $0xc,%esp
+  801e49:	56                   	push   %esi
+  801e4a:	e8 b6 f3 ff ff       	call   801205 <sys_env_destroy>
+		goto out;
+  801e4f:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801e52:	89 de                	mov    %ebx,%esi
+		goto out;
+  801e54:	e9 8d fe ff ff       	jmp    801ce6 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801e59:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801e5e:	e9 83 fe ff ff       	jmp    801ce6 <sfork+0x5f>
+
+00801e63 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801e63:	55                   	push   %ebp
+  801e64:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e69:	05 00 00 00 30       	add    $0x30000000,%eax
+  801e6e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801e71:	5d                   	pop    %ebp
+  801e72:	c3                   	ret
+
+00801e73 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e79:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801e7e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801e83:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801e88:	5d                   	pop    %ebp
+  801e89:	c3                   	ret
+
+00801e8a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801e8a:	55                   	push   %ebp
+  801e8b:	89 e5                	mov    %esp,%ebp
+  801e8d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801e92:	89 c2                	mov    %eax,%edx
+  801e94:	c1 ea 16             	shr    $0x16,%edx
+  801e97:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e9e:	f6 c2 01             	test   $0x1,%dl
+  801ea1:	74 29                	je     801ecc <fd_alloc+0x42>
+  801ea3:	89 c2                	mov    %eax,%edx
+  801ea5:	c1 ea 0c             	shr    $0xc,%edx
+  801ea8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801eaf:	f6 c2 01             	test   $0x1,%dl
+  801eb2:	74 18                	je     801ecc <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801eb4:	05 00 10 00 00       	add    $0x1000,%eax
+  801eb9:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801ebe:	75 d2                	jne    801e92 <fd_alloc+0x8>
+  801ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801ec5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801eca:	eb 05                	jmp    801ed1 <fd_alloc+0x47>
+			return 0;
+  801ecc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801ed1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ed4:	89 02                	mov    %eax,(%edx)
+}
+  801ed6:	89 c8                	mov    %ecx,%eax
+  801ed8:	5d                   	pop    %ebp
+  801ed9:	c3                   	ret
+
+00801eda <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801eda:	55                   	push   %ebp
+  801edb:	89 e5                	mov    %esp,%ebp
+  801edd:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801ee0:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801ee5:	77 30                	ja     801f17 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801ee7:	c1 e0 0c             	shl    $0xc,%eax
+  801eea:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801eef:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801ef5:	f6 c2 01             	test   $0x1,%dl
+  801ef8:	74 24                	je     801f1e <fd_lookup+0x44>
+  801efa:	89 c2                	mov    %eax,%edx
+  801efc:	c1 ea 0c             	shr    $0xc,%edx
+  801eff:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f06:	f6 c2 01             	test   $0x1,%dl
+  801f09:	74 1a                	je     801f25 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801f0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f0e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801f10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f15:	5d                   	pop    %ebp
+  801f16:	c3                   	ret
+		return -E_INVAL;
+  801f17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f1c:	eb f7                	jmp    801f15 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801f1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f23:	eb f0                	jmp    801f15 <fd_lookup+0x3b>
+  801f25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f2a:	eb e9                	jmp    801f15 <fd_lookup+0x3b>
+
+00801f2c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	53                   	push   %ebx
+  801f30:	83 ec 04             	sub    $0x4,%esp
+  801f33:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3b:	bb 20 60 84 00       	mov    $0x846020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801f40:	39 13                	cmp    %edx,(%ebx)
+  801f42:	74 54                	je     801f98 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801f44:	83 c0 01             	add    $0x1,%eax
+  801f47:	8b 1c 85 38 59 80 00 	mov    0x805938(,%eax,4),%ebx
+  801f4e:	85 db                	test   %ebx,%ebx
+  801f50:	75 ee                	jne    801f40 <dev_lookup+0x14>
+  801f52:	89 e1                	mov    %esp,%ecx
+  801f54:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f59:	29 c8                	sub    %ecx,%eax
+  801f5b:	89 c1                	mov    %eax,%ecx
+  801f5d:	c1 e9 0f             	shr    $0xf,%ecx
+  801f60:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6a:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f6d:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  801f74:	8b 40 48             	mov    0x48(%eax),%eax
+  801f77:	83 ec 04             	sub    $0x4,%esp
+  801f7a:	52                   	push   %edx
+  801f7b:	50                   	push   %eax
+  801f7c:	68 bc 58 80 00       	push   $0x8058bc
+  801f81:	e8 d3 e7 ff ff       	call   800759 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801f86:	83 c4 10             	add    $0x10,%esp
+  801f89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801f8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f91:	89 1a                	mov    %ebx,(%edx)
+}
+  801f93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f96:	c9                   	leave
+  801f97:	c3                   	ret
+			return 0;
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	eb ef                	jmp    801f8e <dev_lookup+0x62>
+
+00801f9f <fd_close>:
+{
+  801f9f:	55                   	push   %ebp
+  801fa0:	89 e5                	mov    %esp,%ebp
+  801fa2:	57                   	push   %edi
+  801fa3:	56                   	push   %esi
+  801fa4:	53                   	push   %ebx
+  801fa5:	83 ec 24             	sub    $0x24,%esp
+  801fa8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801fae:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fb1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801fb2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801fb8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801fbb:	50                   	push   %eax
+  801fbc:	e8 19 ff ff ff       	call   801eda <fd_lookup>
+  801fc1:	89 c3                	mov    %eax,%ebx
+  801fc3:	83 c4 10             	add    $0x10,%esp
+  801fc6:	85 c0                	test   %eax,%eax
+  801fc8:	78 05                	js     801fcf <fd_close+0x30>
+	    || fd != fd2)
+  801fca:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801fcd:	74 0f                	je     801fde <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801fcf:	85 ff                	test   %edi,%edi
+  801fd1:	0f 44 df             	cmove  %edi,%ebx
+}
+  801fd4:	89 d8                	mov    %ebx,%eax
+  801fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd9:	5b                   	pop    %ebx
+  801fda:	5e                   	pop    %esi
+  801fdb:	5f                   	pop    %edi
+  801fdc:	5d                   	pop    %ebp
+  801fdd:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801fde:	83 ec 08             	sub    $0x8,%esp
+  801fe1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801fe4:	50                   	push   %eax
+  801fe5:	ff 36                	push   (%esi)
+  801fe7:	e8 40 ff ff ff       	call   801f2c <dev_lookup>
+  801fec:	89 c3                	mov    %eax,%ebx
+  801fee:	83 c4 10             	add    $0x10,%esp
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 1a                	js     80200f <fd_close+0x70>
+		if (dev->dev_close)
+  801ff5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ff8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ffb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802000:	85 c0                	test   %eax,%eax
+  802002:	74 0b                	je     80200f <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  802004:	83 ec 0c             	sub    $0xc,%esp
+  802007:	56                   	push   %esi
+  802008:	ff d0                	call   *%eax
+  80200a:	89 c3                	mov    %eax,%ebx
+  80200c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80200f:	83 ec 08             	sub    $0x8,%esp
+  802012:	56                   	push   %esi
+  802013:	6a 00                	push   $0x0
+  802015:	e8 ef f2 ff ff       	call   801309 <sys_page_unmap>
+	return r;
+  80201a:	83 c4 10             	add    $0x10,%esp
+  80201d:	eb b5                	jmp    801fd4 <fd_close+0x35>
+
+0080201f <close>:
+
+int
+close(int fdnum)
+{
+  80201f:	55                   	push   %ebp
+  802020:	89 e5                	mov    %esp,%ebp
+  802022:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802025:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802028:	50                   	push   %eax
+  802029:	ff 75 08             	push   0x8(%ebp)
+  80202c:	e8 a9 fe ff ff       	call   801eda <fd_lookup>
+  802031:	83 c4 10             	add    $0x10,%esp
+  802034:	85 c0                	test   %eax,%eax
+  802036:	79 02                	jns    80203a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802038:	c9                   	leave
+  802039:	c3                   	ret
+		return fd_close(fd, 1);
+  80203a:	83 ec 08             	sub    $0x8,%esp
+  80203d:	6a 01                	push   $0x1
+  80203f:	ff 75 f4             	push   -0xc(%ebp)
+  802042:	e8 58 ff ff ff       	call   801f9f <fd_close>
+  802047:	83 c4 10             	add    $0x10,%esp
+  80204a:	eb ec                	jmp    802038 <close+0x19>
+
+0080204c <close_all>:
+
+void
+close_all(void)
+{
+  80204c:	55                   	push   %ebp
+  80204d:	89 e5                	mov    %esp,%ebp
+  80204f:	53                   	push   %ebx
+  802050:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802053:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802058:	83 ec 0c             	sub    $0xc,%esp
+  80205b:	53                   	push   %ebx
+  80205c:	e8 be ff ff ff       	call   80201f <close>
+	for (i = 0; i < MAXFD; i++)
+  802061:	83 c3 01             	add    $0x1,%ebx
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80206d:	75 e9                	jne    802058 <close_all+0xc>
+}
+  80206f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802072:	c9                   	leave
+  802073:	c3                   	ret
+
+00802074 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802074:	55                   	push   %ebp
+  802075:	89 e5                	mov    %esp,%ebp
+  802077:	57                   	push   %edi
+  802078:	56                   	push   %esi
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80207d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802080:	50                   	push   %eax
+  802081:	ff 75 08             	push   0x8(%ebp)
+  802084:	e8 51 fe ff ff       	call   801eda <fd_lookup>
+  802089:	89 c3                	mov    %eax,%ebx
+  80208b:	83 c4 10             	add    $0x10,%esp
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	78 7f                	js     802111 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802092:	83 ec 0c             	sub    $0xc,%esp
+  802095:	ff 75 0c             	push   0xc(%ebp)
+  802098:	e8 82 ff ff ff       	call   80201f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80209d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020a0:	c1 e6 0c             	shl    $0xc,%esi
+  8020a3:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8020a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8020ac:	89 3c 24             	mov    %edi,(%esp)
+  8020af:	e8 bf fd ff ff       	call   801e73 <fd2data>
+  8020b4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8020b6:	89 34 24             	mov    %esi,(%esp)
+  8020b9:	e8 b5 fd ff ff       	call   801e73 <fd2data>
+  8020be:	83 c4 10             	add    $0x10,%esp
+  8020c1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8020c4:	89 d8                	mov    %ebx,%eax
+  8020c6:	c1 e8 16             	shr    $0x16,%eax
+  8020c9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8020d0:	a8 01                	test   $0x1,%al
+  8020d2:	74 11                	je     8020e5 <dup+0x71>
+  8020d4:	89 d8                	mov    %ebx,%eax
+  8020d6:	c1 e8 0c             	shr    $0xc,%eax
+  8020d9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8020e0:	f6 c2 01             	test   $0x1,%dl
+  8020e3:	75 36                	jne    80211b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8020e5:	89 f8                	mov    %edi,%eax
+  8020e7:	c1 e8 0c             	shr    $0xc,%eax
+  8020ea:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8020f1:	83 ec 0c             	sub    $0xc,%esp
+  8020f4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8020f9:	50                   	push   %eax
+  8020fa:	56                   	push   %esi
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	57                   	push   %edi
+  8020fe:	6a 00                	push   $0x0
+  802100:	e8 c2 f1 ff ff       	call   8012c7 <sys_page_map>
+  802105:	89 c3                	mov    %eax,%ebx
+  802107:	83 c4 20             	add    $0x20,%esp
+  80210a:	85 c0                	test   %eax,%eax
+  80210c:	78 33                	js     802141 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80210e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802111:	89 d8                	mov    %ebx,%eax
+  802113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802116:	5b                   	pop    %ebx
+  802117:	5e                   	pop    %esi
+  802118:	5f                   	pop    %edi
+  802119:	5d                   	pop    %ebp
+  80211a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80211b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802122:	83 ec 0c             	sub    $0xc,%esp
+  802125:	25 07 0e 00 00       	and    $0xe07,%eax
+  80212a:	50                   	push   %eax
+  80212b:	ff 75 d4             	push   -0x2c(%ebp)
+  80212e:	6a 00                	push   $0x0
+  802130:	53                   	push   %ebx
+  802131:	6a 00                	push   $0x0
+  802133:	e8 8f f1 ff ff       	call   8012c7 <sys_page_map>
+  802138:	89 c3                	mov    %eax,%ebx
+  80213a:	83 c4 20             	add    $0x20,%esp
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	79 a4                	jns    8020e5 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802141:	83 ec 08             	sub    $0x8,%esp
+  802144:	56                   	push   %esi
+  802145:	6a 00                	push   $0x0
+  802147:	e8 bd f1 ff ff       	call   801309 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80214c:	83 c4 08             	add    $0x8,%esp
+  80214f:	ff 75 d4             	push   -0x2c(%ebp)
+  802152:	6a 00                	push   $0x0
+  802154:	e8 b0 f1 ff ff       	call   801309 <sys_page_unmap>
+	return r;
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	eb b3                	jmp    802111 <dup+0x9d>
+
+0080215e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80215e:	55                   	push   %ebp
+  80215f:	89 e5                	mov    %esp,%ebp
+  802161:	56                   	push   %esi
+  802162:	53                   	push   %ebx
+  802163:	83 ec 18             	sub    $0x18,%esp
+  802166:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802169:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80216c:	50                   	push   %eax
+  80216d:	53                   	push   %ebx
+  80216e:	e8 67 fd ff ff       	call   801eda <fd_lookup>
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	85 c0                	test   %eax,%eax
+  802178:	78 3c                	js     8021b6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80217a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80217d:	83 ec 08             	sub    $0x8,%esp
+  802180:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802183:	50                   	push   %eax
+  802184:	ff 36                	push   (%esi)
+  802186:	e8 a1 fd ff ff       	call   801f2c <dev_lookup>
+  80218b:	83 c4 10             	add    $0x10,%esp
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 24                	js     8021b6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802192:	8b 46 08             	mov    0x8(%esi),%eax
+  802195:	83 e0 03             	and    $0x3,%eax
+  802198:	83 f8 01             	cmp    $0x1,%eax
+  80219b:	74 20                	je     8021bd <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80219d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a0:	8b 40 08             	mov    0x8(%eax),%eax
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	74 54                	je     8021fb <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8021a7:	83 ec 04             	sub    $0x4,%esp
+  8021aa:	ff 75 10             	push   0x10(%ebp)
+  8021ad:	ff 75 0c             	push   0xc(%ebp)
+  8021b0:	56                   	push   %esi
+  8021b1:	ff d0                	call   *%eax
+  8021b3:	83 c4 10             	add    $0x10,%esp
+}
+  8021b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b9:	5b                   	pop    %ebx
+  8021ba:	5e                   	pop    %esi
+  8021bb:	5d                   	pop    %ebp
+  8021bc:	c3                   	ret
+  8021bd:	89 e2                	mov    %esp,%edx
+  8021bf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8021c4:	29 d0                	sub    %edx,%eax
+  8021c6:	89 c2                	mov    %eax,%edx
+  8021c8:	c1 ea 0f             	shr    $0xf,%edx
+  8021cb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8021d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d5:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021d8:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8021df:	8b 40 48             	mov    0x48(%eax),%eax
+  8021e2:	83 ec 04             	sub    $0x4,%esp
+  8021e5:	53                   	push   %ebx
+  8021e6:	50                   	push   %eax
+  8021e7:	68 fd 58 80 00       	push   $0x8058fd
+  8021ec:	e8 68 e5 ff ff       	call   800759 <cprintf>
+		return -E_INVAL;
+  8021f1:	83 c4 10             	add    $0x10,%esp
+  8021f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f9:	eb bb                	jmp    8021b6 <read+0x58>
+		return -E_NOT_SUPP;
+  8021fb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802200:	eb b4                	jmp    8021b6 <read+0x58>
+
+00802202 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	57                   	push   %edi
+  802206:	56                   	push   %esi
+  802207:	53                   	push   %ebx
+  802208:	83 ec 0c             	sub    $0xc,%esp
+  80220b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80220e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802211:	85 f6                	test   %esi,%esi
+  802213:	74 30                	je     802245 <readn+0x43>
+  802215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80221a:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80221f:	83 ec 04             	sub    $0x4,%esp
+  802222:	89 f2                	mov    %esi,%edx
+  802224:	29 c2                	sub    %eax,%edx
+  802226:	52                   	push   %edx
+  802227:	01 f8                	add    %edi,%eax
+  802229:	50                   	push   %eax
+  80222a:	ff 75 08             	push   0x8(%ebp)
+  80222d:	e8 2c ff ff ff       	call   80215e <read>
+		if (m < 0)
+  802232:	83 c4 10             	add    $0x10,%esp
+  802235:	85 c0                	test   %eax,%eax
+  802237:	78 15                	js     80224e <readn+0x4c>
+			return m;
+		if (m == 0)
+  802239:	74 11                	je     80224c <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80223b:	01 c3                	add    %eax,%ebx
+  80223d:	89 d8                	mov    %ebx,%eax
+  80223f:	39 f3                	cmp    %esi,%ebx
+  802241:	72 dc                	jb     80221f <readn+0x1d>
+  802243:	eb 09                	jmp    80224e <readn+0x4c>
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224a:	eb 02                	jmp    80224e <readn+0x4c>
+  80224c:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80224e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802251:	5b                   	pop    %ebx
+  802252:	5e                   	pop    %esi
+  802253:	5f                   	pop    %edi
+  802254:	5d                   	pop    %ebp
+  802255:	c3                   	ret
+
+00802256 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802256:	55                   	push   %ebp
+  802257:	89 e5                	mov    %esp,%ebp
+  802259:	56                   	push   %esi
+  80225a:	53                   	push   %ebx
+  80225b:	83 ec 18             	sub    $0x18,%esp
+  80225e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802261:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802264:	50                   	push   %eax
+  802265:	53                   	push   %ebx
+  802266:	e8 6f fc ff ff       	call   801eda <fd_lookup>
+  80226b:	83 c4 10             	add    $0x10,%esp
+  80226e:	85 c0                	test   %eax,%eax
+  802270:	78 37                	js     8022a9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802272:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802275:	83 ec 08             	sub    $0x8,%esp
+  802278:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80227b:	50                   	push   %eax
+  80227c:	ff 36                	push   (%esi)
+  80227e:	e8 a9 fc ff ff       	call   801f2c <dev_lookup>
+  802283:	83 c4 10             	add    $0x10,%esp
+  802286:	85 c0                	test   %eax,%eax
+  802288:	78 1f                	js     8022a9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80228a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80228e:	74 20                	je     8022b0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802290:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802293:	8b 40 0c             	mov    0xc(%eax),%eax
+  802296:	85 c0                	test   %eax,%eax
+  802298:	74 54                	je     8022ee <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80229a:	83 ec 04             	sub    $0x4,%esp
+  80229d:	ff 75 10             	push   0x10(%ebp)
+  8022a0:	ff 75 0c             	push   0xc(%ebp)
+  8022a3:	56                   	push   %esi
+  8022a4:	ff d0                	call   *%eax
+  8022a6:	83 c4 10             	add    $0x10,%esp
+}
+  8022a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ac:	5b                   	pop    %ebx
+  8022ad:	5e                   	pop    %esi
+  8022ae:	5d                   	pop    %ebp
+  8022af:	c3                   	ret
+  8022b0:	89 e2                	mov    %esp,%edx
+  8022b2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8022b7:	29 d0                	sub    %edx,%eax
+  8022b9:	89 c2                	mov    %eax,%edx
+  8022bb:	c1 ea 0f             	shr    $0xf,%edx
+  8022be:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8022c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c8:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022cb:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8022d2:	8b 40 48             	mov    0x48(%eax),%eax
+  8022d5:	83 ec 04             	sub    $0x4,%esp
+  8022d8:	53                   	push   %ebx
+  8022d9:	50                   	push   %eax
+  8022da:	68 19 59 80 00       	push   $0x805919
+  8022df:	e8 75 e4 ff ff       	call   800759 <cprintf>
+		return -E_INVAL;
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ec:	eb bb                	jmp    8022a9 <write+0x53>
+		return -E_NOT_SUPP;
+  8022ee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022f3:	eb b4                	jmp    8022a9 <write+0x53>
+
+008022f5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8022f5:	55                   	push   %ebp
+  8022f6:	89 e5                	mov    %esp,%ebp
+  8022f8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022fe:	50                   	push   %eax
+  8022ff:	ff 75 08             	push   0x8(%ebp)
+  802302:	e8 d3 fb ff ff       	call   801eda <fd_lookup>
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	78 0e                	js     80231c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80230e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802311:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802314:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802317:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+
+0080231e <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80231e:	55                   	push   %ebp
+  80231f:	89 e5                	mov    %esp,%ebp
+  802321:	53                   	push   %ebx
+  802322:	83 ec 1c             	sub    $0x1c,%esp
+  802325:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802328:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80232b:	50                   	push   %eax
+  80232c:	ff 75 08             	push   0x8(%ebp)
+  80232f:	e8 a6 fb ff ff       	call   801eda <fd_lookup>
+  802334:	83 c4 10             	add    $0x10,%esp
+  802337:	85 c0                	test   %eax,%eax
+  802339:	78 33                	js     80236e <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80233b:	83 fb 03             	cmp    $0x3,%ebx
+  80233e:	74 28                	je     802368 <fcntl+0x4a>
+  802340:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802345:	83 fb 04             	cmp    $0x4,%ebx
+  802348:	75 24                	jne    80236e <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80234a:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80234d:	8b 41 08             	mov    0x8(%ecx),%eax
+  802350:	80 e4 ef             	and    $0xef,%ah
+  802353:	8b 55 10             	mov    0x10(%ebp),%edx
+  802356:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80235c:	09 d0                	or     %edx,%eax
+  80235e:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802361:	b8 00 00 00 00       	mov    $0x0,%eax
+  802366:	eb 06                	jmp    80236e <fcntl+0x50>
+		return fd->fd_omode;
+  802368:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236b:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80236e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802371:	c9                   	leave
+  802372:	c3                   	ret
+
+00802373 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802373:	55                   	push   %ebp
+  802374:	89 e5                	mov    %esp,%ebp
+  802376:	56                   	push   %esi
+  802377:	53                   	push   %ebx
+  802378:	83 ec 18             	sub    $0x18,%esp
+  80237b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80237e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802381:	50                   	push   %eax
+  802382:	53                   	push   %ebx
+  802383:	e8 52 fb ff ff       	call   801eda <fd_lookup>
+  802388:	83 c4 10             	add    $0x10,%esp
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	78 34                	js     8023c3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80238f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802392:	83 ec 08             	sub    $0x8,%esp
+  802395:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802398:	50                   	push   %eax
+  802399:	ff 36                	push   (%esi)
+  80239b:	e8 8c fb ff ff       	call   801f2c <dev_lookup>
+  8023a0:	83 c4 10             	add    $0x10,%esp
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	78 1c                	js     8023c3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023a7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8023ab:	74 1d                	je     8023ca <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8023ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b0:	8b 40 18             	mov    0x18(%eax),%eax
+  8023b3:	85 c0                	test   %eax,%eax
+  8023b5:	74 51                	je     802408 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8023b7:	83 ec 08             	sub    $0x8,%esp
+  8023ba:	ff 75 0c             	push   0xc(%ebp)
+  8023bd:	56                   	push   %esi
+  8023be:	ff d0                	call   *%eax
+  8023c0:	83 c4 10             	add    $0x10,%esp
+}
+  8023c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c6:	5b                   	pop    %ebx
+  8023c7:	5e                   	pop    %esi
+  8023c8:	5d                   	pop    %ebp
+  8023c9:	c3                   	ret
+  8023ca:	89 e2                	mov    %esp,%edx
+  8023cc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8023d1:	29 d0                	sub    %edx,%eax
+  8023d3:	89 c2                	mov    %eax,%edx
+  8023d5:	c1 ea 0f             	shr    $0xf,%edx
+  8023d8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8023dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e2:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8023e5:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8023ec:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8023ef:	83 ec 04             	sub    $0x4,%esp
+  8023f2:	53                   	push   %ebx
+  8023f3:	50                   	push   %eax
+  8023f4:	68 dc 58 80 00       	push   $0x8058dc
+  8023f9:	e8 5b e3 ff ff       	call   800759 <cprintf>
+		return -E_INVAL;
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802406:	eb bb                	jmp    8023c3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802408:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80240d:	eb b4                	jmp    8023c3 <ftruncate+0x50>
+
+0080240f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80240f:	55                   	push   %ebp
+  802410:	89 e5                	mov    %esp,%ebp
+  802412:	56                   	push   %esi
+  802413:	53                   	push   %ebx
+  802414:	83 ec 18             	sub    $0x18,%esp
+  802417:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80241a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80241d:	50                   	push   %eax
+  80241e:	ff 75 08             	push   0x8(%ebp)
+  802421:	e8 b4 fa ff ff       	call   801eda <fd_lookup>
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	85 c0                	test   %eax,%eax
+  80242b:	78 53                	js     802480 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80242d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802430:	83 ec 08             	sub    $0x8,%esp
+  802433:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802436:	50                   	push   %eax
+  802437:	ff 36                	push   (%esi)
+  802439:	e8 ee fa ff ff       	call   801f2c <dev_lookup>
+  80243e:	83 c4 10             	add    $0x10,%esp
+  802441:	85 c0                	test   %eax,%eax
+  802443:	78 3b                	js     802480 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802445:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802448:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80244c:	74 39                	je     802487 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80244e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802451:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802458:	00 00 00 
+	stat->st_isdir = 0;
+  80245b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802462:	00 00 00 
+	stat->st_version = 0;
+  802465:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80246c:	00 00 00 
+	stat->st_dev = dev;
+  80246f:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802475:	83 ec 08             	sub    $0x8,%esp
+  802478:	53                   	push   %ebx
+  802479:	56                   	push   %esi
+  80247a:	ff 50 14             	call   *0x14(%eax)
+  80247d:	83 c4 10             	add    $0x10,%esp
+}
+  802480:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802483:	5b                   	pop    %ebx
+  802484:	5e                   	pop    %esi
+  802485:	5d                   	pop    %ebp
+  802486:	c3                   	ret
+		return -E_NOT_SUPP;
+  802487:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80248c:	eb f2                	jmp    802480 <fstat+0x71>
+
+0080248e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	56                   	push   %esi
+  802492:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802493:	83 ec 08             	sub    $0x8,%esp
+  802496:	6a 00                	push   $0x0
+  802498:	ff 75 08             	push   0x8(%ebp)
+  80249b:	e8 b7 01 00 00       	call   802657 <open>
+  8024a0:	89 c3                	mov    %eax,%ebx
+  8024a2:	83 c4 10             	add    $0x10,%esp
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 1b                	js     8024c4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8024a9:	83 ec 08             	sub    $0x8,%esp
+  8024ac:	ff 75 0c             	push   0xc(%ebp)
+  8024af:	50                   	push   %eax
+  8024b0:	e8 5a ff ff ff       	call   80240f <fstat>
+  8024b5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8024b7:	89 1c 24             	mov    %ebx,(%esp)
+  8024ba:	e8 60 fb ff ff       	call   80201f <close>
+	return r;
+  8024bf:	83 c4 10             	add    $0x10,%esp
+  8024c2:	89 f3                	mov    %esi,%ebx
+}
+  8024c4:	89 d8                	mov    %ebx,%eax
+  8024c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c9:	5b                   	pop    %ebx
+  8024ca:	5e                   	pop    %esi
+  8024cb:	5d                   	pop    %ebp
+  8024cc:	c3                   	ret
+
+008024cd <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	56                   	push   %esi
+  8024d1:	53                   	push   %ebx
+  8024d2:	89 c6                	mov    %eax,%esi
+  8024d4:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8024d6:	83 3d c4 76 84 00 00 	cmpl   $0x0,0x8476c4
+  8024dd:	74 27                	je     802506 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8024df:	6a 07                	push   $0x7
+  8024e1:	68 00 90 84 00       	push   $0x849000
+  8024e6:	56                   	push   %esi
+  8024e7:	ff 35 c4 76 84 00    	push   0x8476c4
+  8024ed:	e8 22 2b 00 00       	call   805014 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8024f2:	83 c4 0c             	add    $0xc,%esp
+  8024f5:	6a 00                	push   $0x0
+  8024f7:	53                   	push   %ebx
+  8024f8:	6a 00                	push   $0x0
+  8024fa:	e8 85 28 00 00       	call   804d84 <ipc_recv>
+}
+  8024ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802502:	5b                   	pop    %ebx
+  802503:	5e                   	pop    %esi
+  802504:	5d                   	pop    %ebp
+  802505:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802506:	83 ec 0c             	sub    $0xc,%esp
+  802509:	6a 02                	push   $0x2
+  80250b:	e8 6d 2b 00 00       	call   80507d <ipc_find_env>
+  802510:	a3 c4 76 84 00       	mov    %eax,0x8476c4
+  802515:	83 c4 10             	add    $0x10,%esp
+  802518:	eb c5                	jmp    8024df <fsipc+0x12>
+
+0080251a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80251a:	55                   	push   %ebp
+  80251b:	89 e5                	mov    %esp,%ebp
+  80251d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802520:	8b 45 08             	mov    0x8(%ebp),%eax
+  802523:	8b 40 0c             	mov    0xc(%eax),%eax
+  802526:	a3 00 90 84 00       	mov    %eax,0x849000
+	fsipcbuf.set_size.req_size = newsize;
+  80252b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252e:	a3 04 90 84 00       	mov    %eax,0x849004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802533:	ba 00 00 00 00       	mov    $0x0,%edx
+  802538:	b8 02 00 00 00       	mov    $0x2,%eax
+  80253d:	e8 8b ff ff ff       	call   8024cd <fsipc>
+}
+  802542:	c9                   	leave
+  802543:	c3                   	ret
+
+00802544 <devfile_flush>:
+{
+  802544:	55                   	push   %ebp
+  802545:	89 e5                	mov    %esp,%ebp
+  802547:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80254a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802550:	a3 00 90 84 00       	mov    %eax,0x849000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802555:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80255f:	e8 69 ff ff ff       	call   8024cd <fsipc>
+}
+  802564:	c9                   	leave
+  802565:	c3                   	ret
+
+00802566 <devfile_stat>:
+{
+  802566:	55                   	push   %ebp
+  802567:	89 e5                	mov    %esp,%ebp
+  802569:	53                   	push   %ebx
+  80256a:	83 ec 04             	sub    $0x4,%esp
+  80256d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802570:	8b 45 08             	mov    0x8(%ebp),%eax
+  802573:	8b 40 0c             	mov    0xc(%eax),%eax
+  802576:	a3 00 90 84 00       	mov    %eax,0x849000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80257b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802580:	b8 05 00 00 00       	mov    $0x5,%eax
+  802585:	e8 43 ff ff ff       	call   8024cd <fsipc>
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	78 37                	js     8025c5 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80258e:	83 ec 08             	sub    $0x8,%esp
+  802591:	68 00 90 84 00       	push   $0x849000
+  802596:	53                   	push   %ebx
+  802597:	e8 b4 e8 ff ff       	call   800e50 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80259c:	a1 80 90 84 00       	mov    0x849080,%eax
+  8025a1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8025a7:	a1 84 90 84 00       	mov    0x849084,%eax
+  8025ac:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8025b2:	a1 88 90 84 00       	mov    0x849088,%eax
+  8025b7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025c8:	c9                   	leave
+  8025c9:	c3                   	ret
+
+008025ca <devfile_write>:
+{
+  8025ca:	55                   	push   %ebp
+  8025cb:	89 e5                	mov    %esp,%ebp
+  8025cd:	83 ec 0c             	sub    $0xc,%esp
+  8025d0:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8025d3:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8025d8:	39 d0                	cmp    %edx,%eax
+  8025da:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025e0:	8b 52 0c             	mov    0xc(%edx),%edx
+  8025e3:	89 15 00 90 84 00    	mov    %edx,0x849000
+	fsipcbuf.write.req_n = count;
+  8025e9:	a3 04 90 84 00       	mov    %eax,0x849004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8025ee:	50                   	push   %eax
+  8025ef:	ff 75 0c             	push   0xc(%ebp)
+  8025f2:	68 08 90 84 00       	push   $0x849008
+  8025f7:	e8 04 ea ff ff       	call   801000 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8025fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802601:	b8 04 00 00 00       	mov    $0x4,%eax
+  802606:	e8 c2 fe ff ff       	call   8024cd <fsipc>
+}
+  80260b:	c9                   	leave
+  80260c:	c3                   	ret
+
+0080260d <devfile_read>:
+{
+  80260d:	55                   	push   %ebp
+  80260e:	89 e5                	mov    %esp,%ebp
+  802610:	53                   	push   %ebx
+  802611:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802614:	8b 45 08             	mov    0x8(%ebp),%eax
+  802617:	8b 40 0c             	mov    0xc(%eax),%eax
+  80261a:	a3 00 90 84 00       	mov    %eax,0x849000
+	fsipcbuf.read.req_n = n;
+  80261f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802622:	a3 04 90 84 00       	mov    %eax,0x849004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802627:	ba 00 90 84 00       	mov    $0x849000,%edx
+  80262c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802631:	e8 97 fe ff ff       	call   8024cd <fsipc>
+  802636:	89 c3                	mov    %eax,%ebx
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	78 14                	js     802650 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  80263c:	83 ec 04             	sub    $0x4,%esp
+  80263f:	50                   	push   %eax
+  802640:	68 00 90 84 00       	push   $0x849000
+  802645:	ff 75 0c             	push   0xc(%ebp)
+  802648:	e8 b3 e9 ff ff       	call   801000 <memmove>
+	return r;
+  80264d:	83 c4 10             	add    $0x10,%esp
+}
+  802650:	89 d8                	mov    %ebx,%eax
+  802652:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802655:	c9                   	leave
+  802656:	c3                   	ret
+
+00802657 <open>:
+{
+  802657:	55                   	push   %ebp
+  802658:	89 e5                	mov    %esp,%ebp
+  80265a:	53                   	push   %ebx
+  80265b:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80265e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802661:	50                   	push   %eax
+  802662:	e8 23 f8 ff ff       	call   801e8a <fd_alloc>
+  802667:	89 c3                	mov    %eax,%ebx
+  802669:	83 c4 10             	add    $0x10,%esp
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	78 2a                	js     80269a <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802670:	83 ec 0c             	sub    $0xc,%esp
+  802673:	ff 75 08             	push   0x8(%ebp)
+  802676:	e8 89 e7 ff ff       	call   800e04 <strlen>
+  80267b:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80267e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802683:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802688:	7e 17                	jle    8026a1 <open+0x4a>
+	fd_close(fd, 1);
+  80268a:	83 ec 08             	sub    $0x8,%esp
+  80268d:	6a 01                	push   $0x1
+  80268f:	ff 75 f4             	push   -0xc(%ebp)
+  802692:	e8 08 f9 ff ff       	call   801f9f <fd_close>
+	return r;
+  802697:	83 c4 10             	add    $0x10,%esp
+}
+  80269a:	89 d8                	mov    %ebx,%eax
+  80269c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80269f:	c9                   	leave
+  8026a0:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8026a1:	83 ec 08             	sub    $0x8,%esp
+  8026a4:	ff 75 08             	push   0x8(%ebp)
+  8026a7:	68 00 90 84 00       	push   $0x849000
+  8026ac:	e8 9f e7 ff ff       	call   800e50 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8026b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026b4:	a3 00 94 84 00       	mov    %eax,0x849400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8026b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026c1:	e8 07 fe ff ff       	call   8024cd <fsipc>
+  8026c6:	89 c3                	mov    %eax,%ebx
+  8026c8:	83 c4 10             	add    $0x10,%esp
+  8026cb:	85 c0                	test   %eax,%eax
+  8026cd:	78 bb                	js     80268a <open+0x33>
+	return fd2num(fd); 	
+  8026cf:	83 ec 0c             	sub    $0xc,%esp
+  8026d2:	ff 75 f4             	push   -0xc(%ebp)
+  8026d5:	e8 89 f7 ff ff       	call   801e63 <fd2num>
+  8026da:	89 c3                	mov    %eax,%ebx
+  8026dc:	83 c4 10             	add    $0x10,%esp
+  8026df:	eb b9                	jmp    80269a <open+0x43>
+
+008026e1 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8026e1:	55                   	push   %ebp
+  8026e2:	89 e5                	mov    %esp,%ebp
+  8026e4:	53                   	push   %ebx
+  8026e5:	83 ec 1c             	sub    $0x1c,%esp
+  8026e8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ee:	50                   	push   %eax
+  8026ef:	ff 75 08             	push   0x8(%ebp)
+  8026f2:	e8 e3 f7 ff ff       	call   801eda <fd_lookup>
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	78 5a                	js     802758 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8026fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802701:	8b 15 20 60 84 00    	mov    0x846020,%edx
+  802707:	39 10                	cmp    %edx,(%eax)
+  802709:	75 66                	jne    802771 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  80270b:	83 3d c4 76 84 00 00 	cmpl   $0x0,0x8476c4
+  802712:	74 49                	je     80275d <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802714:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802717:	8b 40 0c             	mov    0xc(%eax),%eax
+  80271a:	a3 00 90 84 00       	mov    %eax,0x849000
+	fsipcbuf.map.req_offset = offset;
+  80271f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802722:	a3 04 90 84 00       	mov    %eax,0x849004
+	fsipcbuf.map.req_npages = maxpages;
+  802727:	89 1d 08 90 84 00    	mov    %ebx,0x849008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80272d:	6a 07                	push   $0x7
+  80272f:	68 00 90 84 00       	push   $0x849000
+  802734:	6a 09                	push   $0x9
+  802736:	ff 35 c4 76 84 00    	push   0x8476c4
+  80273c:	e8 d3 28 00 00       	call   805014 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802741:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802748:	6a 00                	push   $0x0
+  80274a:	53                   	push   %ebx
+  80274b:	ff 75 10             	push   0x10(%ebp)
+  80274e:	6a 00                	push   $0x0
+  802750:	e8 fc 26 00 00       	call   804e51 <ipc_recv_pages>
+  802755:	83 c4 20             	add    $0x20,%esp
+}
+  802758:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80275b:	c9                   	leave
+  80275c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80275d:	83 ec 0c             	sub    $0xc,%esp
+  802760:	6a 02                	push   $0x2
+  802762:	e8 16 29 00 00       	call   80507d <ipc_find_env>
+  802767:	a3 c4 76 84 00       	mov    %eax,0x8476c4
+  80276c:	83 c4 10             	add    $0x10,%esp
+  80276f:	eb a3                	jmp    802714 <fmap+0x33>
+		return -E_INVAL;
+  802771:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802776:	eb e0                	jmp    802758 <fmap+0x77>
+
+00802778 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802778:	55                   	push   %ebp
+  802779:	89 e5                	mov    %esp,%ebp
+  80277b:	53                   	push   %ebx
+  80277c:	83 ec 10             	sub    $0x10,%esp
+  80277f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802782:	53                   	push   %ebx
+  802783:	e8 7c e6 ff ff       	call   800e04 <strlen>
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802790:	7f 25                	jg     8027b7 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802792:	83 ec 08             	sub    $0x8,%esp
+  802795:	53                   	push   %ebx
+  802796:	68 00 90 84 00       	push   $0x849000
+  80279b:	e8 b0 e6 ff ff       	call   800e50 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8027a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027aa:	e8 1e fd ff ff       	call   8024cd <fsipc>
+  8027af:	83 c4 10             	add    $0x10,%esp
+}
+  8027b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b5:	c9                   	leave
+  8027b6:	c3                   	ret
+		return -E_BAD_PATH;
+  8027b7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8027bc:	eb f4                	jmp    8027b2 <remove+0x3a>
+
+008027be <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027be:	55                   	push   %ebp
+  8027bf:	89 e5                	mov    %esp,%ebp
+  8027c1:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8027c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027ce:	e8 fa fc ff ff       	call   8024cd <fsipc>
+}
+  8027d3:	c9                   	leave
+  8027d4:	c3                   	ret
+
+008027d5 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8027d5:	55                   	push   %ebp
+  8027d6:	89 e5                	mov    %esp,%ebp
+  8027d8:	57                   	push   %edi
+  8027d9:	56                   	push   %esi
+  8027da:	53                   	push   %ebx
+  8027db:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8027e1:	6a 00                	push   $0x0
+  8027e3:	ff 75 08             	push   0x8(%ebp)
+  8027e6:	e8 6c fe ff ff       	call   802657 <open>
+  8027eb:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  8027f1:	83 c4 10             	add    $0x10,%esp
+  8027f4:	85 c0                	test   %eax,%eax
+  8027f6:	0f 88 ab 04 00 00    	js     802ca7 <spawn+0x4d2>
+  8027fc:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  8027fe:	83 ec 04             	sub    $0x4,%esp
+  802801:	68 00 02 00 00       	push   $0x200
+  802806:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80280c:	50                   	push   %eax
+  80280d:	51                   	push   %ecx
+  80280e:	e8 ef f9 ff ff       	call   802202 <readn>
+  802813:	83 c4 10             	add    $0x10,%esp
+  802816:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80281b:	0f 85 e6 01 00 00    	jne    802a07 <spawn+0x232>
+	    || elf->e_magic != ELF_MAGIC) {
+  802821:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802828:	45 4c 46 
+  80282b:	0f 85 d6 01 00 00    	jne    802a07 <spawn+0x232>
+	__asm __volatile("int %2"
+  802831:	b8 07 00 00 00       	mov    $0x7,%eax
+  802836:	cd 30                	int    $0x30
+  802838:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  80283e:	85 c0                	test   %eax,%eax
+  802840:	0f 88 55 04 00 00    	js     802c9b <spawn+0x4c6>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802846:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80284b:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+  802851:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802857:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80285d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802862:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802864:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  80286a:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802870:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802873:	8b 00                	mov    (%eax),%eax
+  802875:	85 c0                	test   %eax,%eax
+  802877:	0f 84 a5 07 00 00    	je     803022 <spawn+0x84d>
+  80287d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802882:	bf 00 00 00 00       	mov    $0x0,%edi
+  802887:	8b 75 0c             	mov    0xc(%ebp),%esi
+		string_size += strlen(argv[argc]) + 1;
+  80288a:	83 ec 0c             	sub    $0xc,%esp
+  80288d:	50                   	push   %eax
+  80288e:	e8 71 e5 ff ff       	call   800e04 <strlen>
+  802893:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802897:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  80289d:	83 c3 01             	add    $0x1,%ebx
+  8028a0:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  8028a7:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	75 d9                	jne    80288a <spawn+0xb5>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  8028b1:	89 95 84 fd ff ff    	mov    %edx,-0x27c(%ebp)
+  8028b7:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  8028bd:	be 00 10 40 00       	mov    $0x401000,%esi
+  8028c2:	29 fe                	sub    %edi,%esi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8028c4:	89 f2                	mov    %esi,%edx
+  8028c6:	83 e2 fc             	and    $0xfffffffc,%edx
+  8028c9:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8028cf:	8d 04 85 08 00 00 00 	lea    0x8(,%eax,4),%eax
+  8028d6:	29 c2                	sub    %eax,%edx
+  8028d8:	89 d7                	mov    %edx,%edi
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  8028da:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8028dd:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8028e2:	0f 86 ee 06 00 00    	jbe    802fd6 <spawn+0x801>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8028e8:	83 ec 04             	sub    $0x4,%esp
+  8028eb:	6a 07                	push   $0x7
+  8028ed:	68 00 00 40 00       	push   $0x400000
+  8028f2:	6a 00                	push   $0x0
+  8028f4:	e8 8b e9 ff ff       	call   801284 <sys_page_alloc>
+  8028f9:	83 c4 10             	add    $0x10,%esp
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	0f 88 d7 06 00 00    	js     802fdb <spawn+0x806>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802904:	85 db                	test   %ebx,%ebx
+  802906:	7e 58                	jle    802960 <spawn+0x18b>
+  802908:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290d:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  802913:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802916:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  80291c:	8d 86 00 d0 7f ee    	lea    -0x11803000(%esi),%eax
+  802922:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802928:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+		strcpy(string_store, argv[i]);
+  80292b:	83 ec 08             	sub    $0x8,%esp
+  80292e:	ff 34 9f             	push   (%edi,%ebx,4)
+  802931:	56                   	push   %esi
+  802932:	e8 19 e5 ff ff       	call   800e50 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802937:	83 c4 04             	add    $0x4,%esp
+  80293a:	ff 34 9f             	push   (%edi,%ebx,4)
+  80293d:	e8 c2 e4 ff ff       	call   800e04 <strlen>
+  802942:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+  802946:	83 c3 01             	add    $0x1,%ebx
+  802949:	83 c4 10             	add    $0x10,%esp
+  80294c:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802952:	39 8d 94 fd ff ff    	cmp    %ecx,-0x26c(%ebp)
+  802958:	75 bc                	jne    802916 <spawn+0x141>
+  80295a:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+	}
+	argv_store[argc] = 0;
+  802960:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802966:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80296d:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  802973:	0f 85 c6 00 00 00    	jne    802a3f <spawn+0x26a>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802979:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80297f:	89 47 fc             	mov    %eax,-0x4(%edi)
+	argv_store[-2] = argc;
+  802982:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802988:	89 47 f8             	mov    %eax,-0x8(%edi)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  80298b:	8d 87 f8 cf 7f ee    	lea    -0x11803008(%edi),%eax
+  802991:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802997:	83 ec 0c             	sub    $0xc,%esp
+  80299a:	6a 07                	push   $0x7
+  80299c:	68 00 d0 bf ee       	push   $0xeebfd000
+  8029a1:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8029a7:	68 00 00 40 00       	push   $0x400000
+  8029ac:	6a 00                	push   $0x0
+  8029ae:	e8 14 e9 ff ff       	call   8012c7 <sys_page_map>
+  8029b3:	89 c3                	mov    %eax,%ebx
+  8029b5:	83 c4 20             	add    $0x20,%esp
+  8029b8:	85 c0                	test   %eax,%eax
+  8029ba:	0f 88 45 06 00 00    	js     803005 <spawn+0x830>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8029c0:	83 ec 08             	sub    $0x8,%esp
+  8029c3:	68 00 00 40 00       	push   $0x400000
+  8029c8:	6a 00                	push   $0x0
+  8029ca:	e8 3a e9 ff ff       	call   801309 <sys_page_unmap>
+  8029cf:	89 c3                	mov    %eax,%ebx
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	0f 88 29 06 00 00    	js     803005 <spawn+0x830>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8029dc:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8029e2:	8d 84 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%eax
+  8029e9:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8029ef:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  8029f6:	00 
+  8029f7:	0f 84 a4 00 00 00    	je     802aa1 <spawn+0x2cc>
+  8029fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a02:	e9 19 03 00 00       	jmp    802d20 <spawn+0x54b>
+		close(fd);
+  802a07:	83 ec 0c             	sub    $0xc,%esp
+  802a0a:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802a10:	e8 0a f6 ff ff       	call   80201f <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802a15:	83 c4 0c             	add    $0xc,%esp
+  802a18:	68 7f 45 4c 46       	push   $0x464c457f
+  802a1d:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802a23:	68 4c 59 80 00       	push   $0x80594c
+  802a28:	e8 2c dd ff ff       	call   800759 <cprintf>
+		return -E_NOT_EXEC;
+  802a2d:	83 c4 10             	add    $0x10,%esp
+  802a30:	c7 85 78 fd ff ff f2 	movl   $0xfffffff2,-0x288(%ebp)
+  802a37:	ff ff ff 
+  802a3a:	e9 68 02 00 00       	jmp    802ca7 <spawn+0x4d2>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802a3f:	68 b4 59 80 00       	push   $0x8059b4
+  802a44:	68 66 59 80 00       	push   $0x805966
+  802a49:	68 f1 00 00 00       	push   $0xf1
+  802a4e:	68 7b 59 80 00       	push   $0x80597b
+  802a53:	e8 26 dc ff ff       	call   80067e <_panic>
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
+  802a58:	50                   	push   %eax
+  802a59:	68 dc 59 80 00       	push   $0x8059dc
+  802a5e:	68 2d 01 00 00       	push   $0x12d
+  802a63:	68 7b 59 80 00       	push   $0x80597b
+  802a68:	e8 11 dc ff ff       	call   80067e <_panic>
+  802a6d:	89 c6                	mov    %eax,%esi
+  802a6f:	eb 02                	jmp    802a73 <spawn+0x29e>
+  802a71:	89 c6                	mov    %eax,%esi
+	sys_env_destroy(child);
+  802a73:	83 ec 0c             	sub    $0xc,%esp
+  802a76:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802a7c:	e8 84 e7 ff ff       	call   801205 <sys_env_destroy>
+	close(fd);
+  802a81:	83 c4 04             	add    $0x4,%esp
+  802a84:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802a8a:	e8 90 f5 ff ff       	call   80201f <close>
+	return r;
+  802a8f:	83 c4 10             	add    $0x10,%esp
+  802a92:	89 b5 78 fd ff ff    	mov    %esi,-0x288(%ebp)
+  802a98:	e9 0a 02 00 00       	jmp    802ca7 <spawn+0x4d2>
+  802a9d:	89 c6                	mov    %eax,%esi
+  802a9f:	eb d2                	jmp    802a73 <spawn+0x29e>
+	close(fd);
+  802aa1:	83 ec 0c             	sub    $0xc,%esp
+  802aa4:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802aaa:	e8 70 f5 ff ff       	call   80201f <close>
+	// LAB 7: Your code here.
+	static struct PageBatch pb;
+	uintptr_t addr;
+	uint32_t pn, pd;
+	int r;
+	pgbatch_init(&pb);
+  802aaf:	c7 04 24 e0 76 84 00 	movl   $0x8476e0,(%esp)
+  802ab6:	e8 65 1d 00 00       	call   804820 <pgbatch_init>
+  802abb:	83 c4 10             	add    $0x10,%esp
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802abe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac3:	8b b5 90 fd ff ff    	mov    -0x270(%ebp),%esi
+  802ac9:	eb 24                	jmp    802aef <spawn+0x31a>
+		pd = PDX(addr);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  802acb:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802ad1:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  802ad7:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802add:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ae3:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  802ae9:	0f 87 18 01 00 00    	ja     802c07 <spawn+0x432>
+		pd = PDX(addr);
+  802aef:	89 d8                	mov    %ebx,%eax
+  802af1:	c1 e8 16             	shr    $0x16,%eax
+		if (!(vpd[pd] & PTE_P)) {
+  802af4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802afb:	a8 01                	test   $0x1,%al
+  802afd:	74 cc                	je     802acb <spawn+0x2f6>
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  802aff:	89 d9                	mov    %ebx,%ecx
+  802b01:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+  802b07:	74 4c                	je     802b55 <spawn+0x380>
+				continue;
+			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+  802b09:	89 d8                	mov    %ebx,%eax
+  802b0b:	c1 e8 0c             	shr    $0xc,%eax
+		if(vpt[pn] & PTE_SHARE) {
+  802b0e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802b15:	f6 c6 04             	test   $0x4,%dh
+  802b18:	74 c3                	je     802add <spawn+0x308>
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+  802b1a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802b21:	83 ec 08             	sub    $0x8,%esp
+  802b24:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b29:	50                   	push   %eax
+  802b2a:	53                   	push   %ebx
+  802b2b:	56                   	push   %esi
+  802b2c:	53                   	push   %ebx
+  802b2d:	6a 00                	push   $0x0
+  802b2f:	68 e0 76 84 00       	push   $0x8476e0
+  802b34:	e8 a5 1d 00 00       	call   8048de <pgbatch_map>
+  802b39:	83 c4 20             	add    $0x20,%esp
+  802b3c:	85 c0                	test   %eax,%eax
+  802b3e:	79 9d                	jns    802add <spawn+0x308>
+				panic("sys_page_batch: %e", r);
+  802b40:	50                   	push   %eax
+  802b41:	68 87 59 80 00       	push   $0x805987
+  802b46:	68 6b 01 00 00       	push   $0x16b
+  802b4b:	68 7b 59 80 00       	push   $0x80597b
+  802b50:	e8 29 db ff ff       	call   80067e <_panic>
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802b55:	89 d8                	mov    %ebx,%eax
+  802b57:	c1 e8 0c             	shr    $0xc,%eax
+  802b5a:	8d b8 00 04 00 00    	lea    0x400(%eax),%edi
+  802b60:	eb 0a                	jmp    802b6c <spawn+0x397>
+			n++;
+  802b62:	83 c1 01             	add    $0x1,%ecx
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802b65:	83 c0 01             	add    $0x1,%eax
+  802b68:	39 f8                	cmp    %edi,%eax
+  802b6a:	73 1a                	jae    802b86 <spawn+0x3b1>
+		if (vpt[pn] & PTE_P) {
+  802b6c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802b73:	f6 c2 01             	test   $0x1,%dl
+  802b76:	74 ed                	je     802b65 <spawn+0x390>
+			if (!(vpt[pn] & PTE_SHARE))
+  802b78:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802b7f:	f6 c6 04             	test   $0x4,%dh
+  802b82:	75 de                	jne    802b62 <spawn+0x38d>
+  802b84:	eb 83                	jmp    802b09 <spawn+0x334>
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  802b86:	85 c9                	test   %ecx,%ecx
+  802b88:	0f 84 7b ff ff ff    	je     802b09 <spawn+0x334>
+			if ((r = pgbatch_flush(&pb)) < 0)
+  802b8e:	83 ec 0c             	sub    $0xc,%esp
+  802b91:	68 e0 76 84 00       	push   $0x8476e0
+  802b96:	e8 93 1c 00 00       	call   80482e <pgbatch_flush>
+  802b9b:	83 c4 10             	add    $0x10,%esp
+  802b9e:	85 c0                	test   %eax,%eax
+  802ba0:	78 45                	js     802be7 <spawn+0x412>
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+  802ba2:	83 ec 0c             	sub    $0xc,%esp
+  802ba5:	6a 00                	push   $0x0
+  802ba7:	56                   	push   %esi
+  802ba8:	53                   	push   %ebx
+  802ba9:	6a 00                	push   $0x0
+  802bab:	68 e0 76 84 00       	push   $0x8476e0
+  802bb0:	e8 d4 1d 00 00       	call   804989 <pgbatch_sharept>
+			if ((r = pgbatch_flush(&pb)) == 0) {
+  802bb5:	83 c4 14             	add    $0x14,%esp
+  802bb8:	68 e0 76 84 00       	push   $0x8476e0
+  802bbd:	e8 6c 1c 00 00       	call   80482e <pgbatch_flush>
+  802bc2:	83 c4 10             	add    $0x10,%esp
+  802bc5:	85 c0                	test   %eax,%eax
+  802bc7:	74 33                	je     802bfc <spawn+0x427>
+			if (r != -E_INVAL)
+  802bc9:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  802bcc:	0f 84 37 ff ff ff    	je     802b09 <spawn+0x334>
+				panic("sys_page_batch: %e", r);
+  802bd2:	50                   	push   %eax
+  802bd3:	68 87 59 80 00       	push   $0x805987
+  802bd8:	68 66 01 00 00       	push   $0x166
+  802bdd:	68 7b 59 80 00       	push   $0x80597b
+  802be2:	e8 97 da ff ff       	call   80067e <_panic>
+				panic("sys_page_batch: %e", r);
+  802be7:	50                   	push   %eax
+  802be8:	68 87 59 80 00       	push   $0x805987
+  802bed:	68 5f 01 00 00       	push   $0x15f
+  802bf2:	68 7b 59 80 00       	push   $0x80597b
+  802bf7:	e8 82 da ff ff       	call   80067e <_panic>
+				addr += PTSIZE - PGSIZE;
+  802bfc:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+				continue;
+  802c02:	e9 d6 fe ff ff       	jmp    802add <spawn+0x308>
+		}
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  802c07:	83 ec 0c             	sub    $0xc,%esp
+  802c0a:	68 e0 76 84 00       	push   $0x8476e0
+  802c0f:	e8 1a 1c 00 00       	call   80482e <pgbatch_flush>
+  802c14:	83 c4 10             	add    $0x10,%esp
+  802c17:	85 c0                	test   %eax,%eax
+  802c19:	78 41                	js     802c5c <spawn+0x487>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802c1b:	83 ec 08             	sub    $0x8,%esp
+  802c1e:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802c24:	50                   	push   %eax
+  802c25:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c2b:	e8 5d e7 ff ff       	call   80138d <sys_env_set_trapframe>
+  802c30:	83 c4 10             	add    $0x10,%esp
+  802c33:	85 c0                	test   %eax,%eax
+  802c35:	78 3a                	js     802c71 <spawn+0x49c>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802c37:	83 ec 08             	sub    $0x8,%esp
+  802c3a:	6a 02                	push   $0x2
+  802c3c:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c42:	e8 04 e7 ff ff       	call   80134b <sys_env_set_status>
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	78 38                	js     802c86 <spawn+0x4b1>
+	return child;
+  802c4e:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802c54:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802c5a:	eb 4b                	jmp    802ca7 <spawn+0x4d2>
+		panic("sys_page_batch: %e", r);
+  802c5c:	50                   	push   %eax
+  802c5d:	68 87 59 80 00       	push   $0x805987
+  802c62:	68 6f 01 00 00       	push   $0x16f
+  802c67:	68 7b 59 80 00       	push   $0x80597b
+  802c6c:	e8 0d da ff ff       	call   80067e <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  802c71:	50                   	push   %eax
+  802c72:	68 9a 59 80 00       	push   $0x80599a
+  802c77:	68 85 00 00 00       	push   $0x85
+  802c7c:	68 7b 59 80 00       	push   $0x80597b
+  802c81:	e8 f8 d9 ff ff       	call   80067e <_panic>
+		panic("sys_env_set_status: %e", r);
+  802c86:	50                   	push   %eax
+  802c87:	68 85 58 80 00       	push   $0x805885
+  802c8c:	68 88 00 00 00       	push   $0x88
+  802c91:	68 7b 59 80 00       	push   $0x80597b
+  802c96:	e8 e3 d9 ff ff       	call   80067e <_panic>
+		return r;
+  802c9b:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802ca1:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+}
+  802ca7:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802cad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb0:	5b                   	pop    %ebx
+  802cb1:	5e                   	pop    %esi
+  802cb2:	5f                   	pop    %edi
+  802cb3:	5d                   	pop    %ebp
+  802cb4:	c3                   	ret
+	for (j = 0; j < n; j++)
+  802cb5:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  802cbb:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802cc1:	85 db                	test   %ebx,%ebx
+  802cc3:	0f 8e 06 03 00 00    	jle    802fcf <spawn+0x7fa>
+  802cc9:	81 c6 00 04 00 00    	add    $0x400,%esi
+  802ccf:	c1 e6 0c             	shl    $0xc,%esi
+  802cd2:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  802cd7:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802cdd:	89 c7                	mov    %eax,%edi
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+  802cdf:	83 ec 08             	sub    $0x8,%esp
+  802ce2:	53                   	push   %ebx
+  802ce3:	6a 00                	push   $0x0
+  802ce5:	e8 1f e6 ff ff       	call   801309 <sys_page_unmap>
+	for (j = 0; j < n; j++)
+  802cea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802cf0:	83 c4 10             	add    $0x10,%esp
+  802cf3:	39 f3                	cmp    %esi,%ebx
+  802cf5:	75 e8                	jne    802cdf <spawn+0x50a>
+  802cf7:	89 f8                	mov    %edi,%eax
+  802cf9:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802cff:	85 c0                	test   %eax,%eax
+  802d01:	0f 88 66 fd ff ff    	js     802a6d <spawn+0x298>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802d07:	83 c7 01             	add    $0x1,%edi
+  802d0a:	83 85 7c fd ff ff 20 	addl   $0x20,-0x284(%ebp)
+  802d11:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802d18:	39 f8                	cmp    %edi,%eax
+  802d1a:	0f 8e 81 fd ff ff    	jle    802aa1 <spawn+0x2cc>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802d20:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802d26:	83 39 01             	cmpl   $0x1,(%ecx)
+  802d29:	75 dc                	jne    802d07 <spawn+0x532>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802d2b:	8b 41 18             	mov    0x18(%ecx),%eax
+  802d2e:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+  802d34:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802d37:	83 f8 01             	cmp    $0x1,%eax
+  802d3a:	19 c0                	sbb    %eax,%eax
+  802d3c:	83 e0 fe             	and    $0xfffffffe,%eax
+  802d3f:	83 c0 07             	add    $0x7,%eax
+  802d42:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802d48:	8b 51 04             	mov    0x4(%ecx),%edx
+  802d4b:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802d51:	8b 59 10             	mov    0x10(%ecx),%ebx
+  802d54:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802d5a:	8b 41 14             	mov    0x14(%ecx),%eax
+  802d5d:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+  802d63:	8b 71 08             	mov    0x8(%ecx),%esi
+  802d66:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+	if ((i = PGOFF(va))) {
+  802d6c:	89 f0                	mov    %esi,%eax
+  802d6e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d73:	74 1e                	je     802d93 <spawn+0x5be>
+		va -= i;
+  802d75:	29 c6                	sub    %eax,%esi
+  802d77:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		memsz += i;
+  802d7d:	01 85 68 fd ff ff    	add    %eax,-0x298(%ebp)
+		filesz += i;
+  802d83:	01 c3                	add    %eax,%ebx
+  802d85:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+		fileoffset -= i;
+  802d8b:	29 c2                	sub    %eax,%edx
+  802d8d:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+	pgbatch_init(&pb);
+  802d93:	83 ec 0c             	sub    $0xc,%esp
+  802d96:	68 00 7a 84 00       	push   $0x847a00
+  802d9b:	e8 80 1a 00 00       	call   804820 <pgbatch_init>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802da0:	83 c4 10             	add    $0x10,%esp
+  802da3:	83 bd 88 fd ff ff 00 	cmpl   $0x0,-0x278(%ebp)
+  802daa:	0f 84 a6 01 00 00    	je     802f56 <spawn+0x781>
+  802db0:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802db7:	00 00 00 
+  802dba:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802dc1:	00 00 00 
+  802dc4:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802dca:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  802dd0:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802dd6:	29 c7                	sub    %eax,%edi
+  802dd8:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  802dde:	c1 ee 0c             	shr    $0xc,%esi
+  802de1:	b8 10 00 00 00       	mov    $0x10,%eax
+  802de6:	39 c6                	cmp    %eax,%esi
+  802de8:	0f 47 f0             	cmova  %eax,%esi
+  802deb:	89 b5 94 fd ff ff    	mov    %esi,-0x26c(%ebp)
+		for (j = 0; j < n; j++)
+  802df1:	85 f6                	test   %esi,%esi
+  802df3:	0f 8e ed 01 00 00    	jle    802fe6 <spawn+0x811>
+  802df9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dfe:	89 bd 70 fd ff ff    	mov    %edi,-0x290(%ebp)
+  802e04:	89 f7                	mov    %esi,%edi
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  802e06:	6a 07                	push   $0x7
+  802e08:	89 d8                	mov    %ebx,%eax
+  802e0a:	c1 e0 0c             	shl    $0xc,%eax
+  802e0d:	05 00 00 40 00       	add    $0x400000,%eax
+  802e12:	50                   	push   %eax
+  802e13:	6a 00                	push   $0x0
+  802e15:	68 00 7a 84 00       	push   $0x847a00
+  802e1a:	e8 88 1a 00 00       	call   8048a7 <pgbatch_alloc>
+  802e1f:	83 c4 10             	add    $0x10,%esp
+  802e22:	85 c0                	test   %eax,%eax
+  802e24:	0f 88 47 fc ff ff    	js     802a71 <spawn+0x29c>
+		for (j = 0; j < n; j++)
+  802e2a:	83 c3 01             	add    $0x1,%ebx
+  802e2d:	39 df                	cmp    %ebx,%edi
+  802e2f:	75 d5                	jne    802e06 <spawn+0x631>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802e31:	8b bd 70 fd ff ff    	mov    -0x290(%ebp),%edi
+  802e37:	83 ec 0c             	sub    $0xc,%esp
+  802e3a:	68 00 7a 84 00       	push   $0x847a00
+  802e3f:	e8 ea 19 00 00       	call   80482e <pgbatch_flush>
+  802e44:	83 c4 10             	add    $0x10,%esp
+  802e47:	85 c0                	test   %eax,%eax
+  802e49:	0f 88 66 fe ff ff    	js     802cb5 <spawn+0x4e0>
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802e4f:	83 ec 08             	sub    $0x8,%esp
+  802e52:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802e58:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802e5e:	01 c8                	add    %ecx,%eax
+  802e60:	50                   	push   %eax
+  802e61:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802e67:	e8 89 f4 ff ff       	call   8022f5 <seek>
+  802e6c:	83 c4 10             	add    $0x10,%esp
+  802e6f:	85 c0                	test   %eax,%eax
+  802e71:	0f 88 3e fe ff ff    	js     802cb5 <spawn+0x4e0>
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802e77:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802e7d:	c1 e3 0c             	shl    $0xc,%ebx
+  802e80:	83 ec 04             	sub    $0x4,%esp
+  802e83:	39 fb                	cmp    %edi,%ebx
+  802e85:	0f 46 fb             	cmovbe %ebx,%edi
+  802e88:	57                   	push   %edi
+  802e89:	68 00 00 40 00       	push   $0x400000
+  802e8e:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802e94:	e8 69 f3 ff ff       	call   802202 <readn>
+  802e99:	83 c4 10             	add    $0x10,%esp
+  802e9c:	85 c0                	test   %eax,%eax
+  802e9e:	0f 88 11 fe ff ff    	js     802cb5 <spawn+0x4e0>
+		for (j = 0; j < n; j++) {
+  802ea4:	83 bd 94 fd ff ff 00 	cmpl   $0x0,-0x26c(%ebp)
+  802eab:	7e 6b                	jle    802f18 <spawn+0x743>
+  802ead:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802eb3:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802eb9:	01 c7                	add    %eax,%edi
+  802ebb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ec0:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+  802ec6:	89 f3                	mov    %esi,%ebx
+  802ec8:	c1 e3 0c             	shl    $0xc,%ebx
+  802ecb:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802ed1:	83 ec 08             	sub    $0x8,%esp
+  802ed4:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802eda:	57                   	push   %edi
+  802edb:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802ee1:	53                   	push   %ebx
+  802ee2:	6a 00                	push   $0x0
+  802ee4:	68 00 7a 84 00       	push   $0x847a00
+  802ee9:	e8 f0 19 00 00       	call   8048de <pgbatch_map>
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+  802eee:	83 c4 1c             	add    $0x1c,%esp
+  802ef1:	53                   	push   %ebx
+  802ef2:	6a 00                	push   $0x0
+  802ef4:	68 00 7a 84 00       	push   $0x847a00
+  802ef9:	e8 23 1a 00 00       	call   804921 <pgbatch_unmap>
+		for (j = 0; j < n; j++) {
+  802efe:	83 c6 01             	add    $0x1,%esi
+  802f01:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802f07:	83 c4 10             	add    $0x10,%esp
+  802f0a:	39 b5 94 fd ff ff    	cmp    %esi,-0x26c(%ebp)
+  802f10:	75 b4                	jne    802ec6 <spawn+0x6f1>
+  802f12:	8b 9d 80 fd ff ff    	mov    -0x280(%ebp),%ebx
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802f18:	83 ec 0c             	sub    $0xc,%esp
+  802f1b:	68 00 7a 84 00       	push   $0x847a00
+  802f20:	e8 09 19 00 00       	call   80482e <pgbatch_flush>
+  802f25:	83 c4 10             	add    $0x10,%esp
+  802f28:	85 c0                	test   %eax,%eax
+  802f2a:	0f 88 28 fb ff ff    	js     802a58 <spawn+0x283>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802f30:	01 9d 84 fd ff ff    	add    %ebx,-0x27c(%ebp)
+  802f36:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802f3c:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802f42:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  802f48:	39 f0                	cmp    %esi,%eax
+  802f4a:	0f 82 7a fe ff ff    	jb     802dca <spawn+0x5f5>
+  802f50:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802f56:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802f5c:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802f61:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802f66:	89 c3                	mov    %eax,%ebx
+  802f68:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802f6e:	39 f0                	cmp    %esi,%eax
+  802f70:	73 48                	jae    802fba <spawn+0x7e5>
+  802f72:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802f78:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802f7e:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+  802f84:	56                   	push   %esi
+  802f85:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802f8b:	01 d8                	add    %ebx,%eax
+  802f8d:	50                   	push   %eax
+  802f8e:	57                   	push   %edi
+  802f8f:	68 00 7a 84 00       	push   $0x847a00
+  802f94:	e8 0e 19 00 00       	call   8048a7 <pgbatch_alloc>
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	85 c0                	test   %eax,%eax
+  802f9e:	0f 88 f9 fa ff ff    	js     802a9d <spawn+0x2c8>
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802fa4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802faa:	8b 85 68 fd ff ff    	mov    -0x298(%ebp),%eax
+  802fb0:	39 c3                	cmp    %eax,%ebx
+  802fb2:	72 d0                	jb     802f84 <spawn+0x7af>
+  802fb4:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+	return pgbatch_flush(&pb);
+  802fba:	83 ec 0c             	sub    $0xc,%esp
+  802fbd:	68 00 7a 84 00       	push   $0x847a00
+  802fc2:	e8 67 18 00 00       	call   80482e <pgbatch_flush>
+  802fc7:	83 c4 10             	add    $0x10,%esp
+  802fca:	e9 30 fd ff ff       	jmp    802cff <spawn+0x52a>
+  802fcf:	89 c6                	mov    %eax,%esi
+  802fd1:	e9 9d fa ff ff       	jmp    802a73 <spawn+0x29e>
+		return -E_NO_MEM;
+  802fd6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802fdb:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802fe1:	e9 c1 fc ff ff       	jmp    802ca7 <spawn+0x4d2>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802fe6:	83 ec 0c             	sub    $0xc,%esp
+  802fe9:	68 00 7a 84 00       	push   $0x847a00
+  802fee:	e8 3b 18 00 00       	call   80482e <pgbatch_flush>
+  802ff3:	83 c4 10             	add    $0x10,%esp
+  802ff6:	85 c0                	test   %eax,%eax
+  802ff8:	0f 89 51 fe ff ff    	jns    802e4f <spawn+0x67a>
+  802ffe:	89 c6                	mov    %eax,%esi
+  803000:	e9 6e fa ff ff       	jmp    802a73 <spawn+0x29e>
+	sys_page_unmap(0, UTEMP);
+  803005:	83 ec 08             	sub    $0x8,%esp
+  803008:	68 00 00 40 00       	push   $0x400000
+  80300d:	6a 00                	push   $0x0
+  80300f:	e8 f5 e2 ff ff       	call   801309 <sys_page_unmap>
+  803014:	83 c4 10             	add    $0x10,%esp
+  803017:	89 9d 78 fd ff ff    	mov    %ebx,-0x288(%ebp)
+  80301d:	e9 85 fc ff ff       	jmp    802ca7 <spawn+0x4d2>
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803022:	83 ec 04             	sub    $0x4,%esp
+  803025:	6a 07                	push   $0x7
+  803027:	68 00 00 40 00       	push   $0x400000
+  80302c:	6a 00                	push   $0x0
+  80302e:	e8 51 e2 ff ff       	call   801284 <sys_page_alloc>
+  803033:	83 c4 10             	add    $0x10,%esp
+  803036:	85 c0                	test   %eax,%eax
+  803038:	78 a1                	js     802fdb <spawn+0x806>
+	for (argc = 0; argv[argc] != 0; argc++)
+  80303a:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  803041:	00 00 00 
+  803044:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  80304b:	00 00 00 
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80304e:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  803053:	be 00 10 40 00       	mov    $0x401000,%esi
+  803058:	e9 03 f9 ff ff       	jmp    802960 <spawn+0x18b>
+
+0080305d <spawnl>:
+{
+  80305d:	55                   	push   %ebp
+  80305e:	89 e5                	mov    %esp,%ebp
+  803060:	56                   	push   %esi
+  803061:	53                   	push   %ebx
+	va_start(vl, arg0);
+  803062:	8d 45 10             	lea    0x10(%ebp),%eax
+	int argc=0;
+  803065:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while(va_arg(vl, void *) != NULL)
+  80306a:	eb 05                	jmp    803071 <spawnl+0x14>
+		argc++;
+  80306c:	83 c1 01             	add    $0x1,%ecx
+	while(va_arg(vl, void *) != NULL)
+  80306f:	89 d0                	mov    %edx,%eax
+  803071:	8d 50 04             	lea    0x4(%eax),%edx
+  803074:	83 38 00             	cmpl   $0x0,(%eax)
+  803077:	75 f3                	jne    80306c <spawnl+0xf>
+	const char *argv[argc+2];
+  803079:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  803080:	83 e0 f0             	and    $0xfffffff0,%eax
+  803083:	29 c4                	sub    %eax,%esp
+  803085:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803089:	89 d8                	mov    %ebx,%eax
+  80308b:	c1 e8 02             	shr    $0x2,%eax
+  80308e:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  803091:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803094:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+	argv[argc+1] = NULL;
+  80309b:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  8030a2:	00 
+	va_start(vl, arg0);
+  8030a3:	8d 55 10             	lea    0x10(%ebp),%edx
+	for(i=0;i<argc;i++)
+  8030a6:	89 ce                	mov    %ecx,%esi
+  8030a8:	85 c9                	test   %ecx,%ecx
+  8030aa:	74 16                	je     8030c2 <spawnl+0x65>
+  8030ac:	b8 00 00 00 00       	mov    $0x0,%eax
+		argv[i+1] = va_arg(vl, const char *);
+  8030b1:	83 c0 01             	add    $0x1,%eax
+  8030b4:	89 d1                	mov    %edx,%ecx
+  8030b6:	83 c2 04             	add    $0x4,%edx
+  8030b9:	8b 09                	mov    (%ecx),%ecx
+  8030bb:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	for(i=0;i<argc;i++)
+  8030be:	39 f0                	cmp    %esi,%eax
+  8030c0:	75 ef                	jne    8030b1 <spawnl+0x54>
+	return spawn(prog, argv);
+  8030c2:	83 ec 08             	sub    $0x8,%esp
+  8030c5:	53                   	push   %ebx
+  8030c6:	ff 75 08             	push   0x8(%ebp)
+  8030c9:	e8 07 f7 ff ff       	call   8027d5 <spawn>
+}
+  8030ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030d1:	5b                   	pop    %ebx
+  8030d2:	5e                   	pop    %esi
+  8030d3:	5d                   	pop    %ebp
+  8030d4:	c3                   	ret
+
+008030d5 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8030d5:	55                   	push   %ebp
+  8030d6:	89 e5                	mov    %esp,%ebp
+  8030d8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8030db:	68 fb 59 80 00       	push   $0x8059fb
+  8030e0:	ff 75 0c             	push   0xc(%ebp)
+  8030e3:	e8 68 dd ff ff       	call   800e50 <strcpy>
+	return 0;
+}
+  8030e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ed:	c9                   	leave
+  8030ee:	c3                   	ret
+
+008030ef <devsock_close>:
+{
+  8030ef:	55                   	push   %ebp
+  8030f0:	89 e5                	mov    %esp,%ebp
+  8030f2:	53                   	push   %ebx
+  8030f3:	83 ec 10             	sub    $0x10,%esp
+  8030f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8030f9:	53                   	push   %ebx
+  8030fa:	e8 bd 1f 00 00       	call   8050bc <pageref>
+  8030ff:	89 c2                	mov    %eax,%edx
+  803101:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803104:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803109:	83 fa 01             	cmp    $0x1,%edx
+  80310c:	74 05                	je     803113 <devsock_close+0x24>
+}
+  80310e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803111:	c9                   	leave
+  803112:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803113:	83 ec 0c             	sub    $0xc,%esp
+  803116:	ff 73 0c             	push   0xc(%ebx)
+  803119:	e8 b0 05 00 00       	call   8036ce <nsipc_close>
+  80311e:	83 c4 10             	add    $0x10,%esp
+  803121:	eb eb                	jmp    80310e <devsock_close+0x1f>
+
+00803123 <devsock_write>:
+{
+  803123:	55                   	push   %ebp
+  803124:	89 e5                	mov    %esp,%ebp
+  803126:	53                   	push   %ebx
+  803127:	83 ec 14             	sub    $0x14,%esp
+  80312a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80312d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803130:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  803133:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  803136:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803139:	8b 41 08             	mov    0x8(%ecx),%eax
+  80313c:	c1 f8 09             	sar    $0x9,%eax
+  80313f:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  803142:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803148:	77 13                	ja     80315d <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  80314a:	50                   	push   %eax
+  80314b:	52                   	push   %edx
+  80314c:	53                   	push   %ebx
+  80314d:	ff 71 0c             	push   0xc(%ecx)
+  803150:	e8 5c 06 00 00       	call   8037b1 <nsipc_send>
+  803155:	83 c4 10             	add    $0x10,%esp
+}
+  803158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80315b:	c9                   	leave
+  80315c:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80315d:	50                   	push   %eax
+  80315e:	6a 01                	push   $0x1
+  803160:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803163:	50                   	push   %eax
+  803164:	ff 71 0c             	push   0xc(%ecx)
+  803167:	e8 a6 06 00 00       	call   803812 <nsipc_sendmsg>
+  80316c:	83 c4 10             	add    $0x10,%esp
+  80316f:	eb e7                	jmp    803158 <devsock_write+0x35>
+
+00803171 <devsock_read>:
+{
+  803171:	55                   	push   %ebp
+  803172:	89 e5                	mov    %esp,%ebp
+  803174:	53                   	push   %ebx
+  803175:	83 ec 14             	sub    $0x14,%esp
+  803178:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80317b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80317e:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  803181:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  803184:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803187:	8b 41 08             	mov    0x8(%ecx),%eax
+  80318a:	c1 f8 09             	sar    $0x9,%eax
+  80318d:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  803190:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803196:	77 13                	ja     8031ab <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  803198:	50                   	push   %eax
+  803199:	52                   	push   %edx
+  80319a:	53                   	push   %ebx
+  80319b:	ff 71 0c             	push   0xc(%ecx)
+  80319e:	e8 9c 05 00 00       	call   80373f <nsipc_recv>
+  8031a3:	83 c4 10             	add    $0x10,%esp
+}
+  8031a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031a9:	c9                   	leave
+  8031aa:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8031ab:	50                   	push   %eax
+  8031ac:	6a 01                	push   $0x1
+  8031ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031b1:	50                   	push   %eax
+  8031b2:	ff 71 0c             	push   0xc(%ecx)
+  8031b5:	e8 02 0a 00 00       	call   803bbc <nsipc_recvmsg>
+  8031ba:	83 c4 10             	add    $0x10,%esp
+  8031bd:	eb e7                	jmp    8031a6 <devsock_read+0x35>
+
+008031bf <fd2sockid>:
+{
+  8031bf:	55                   	push   %ebp
+  8031c0:	89 e5                	mov    %esp,%ebp
+  8031c2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8031c5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8031c8:	52                   	push   %edx
+  8031c9:	50                   	push   %eax
+  8031ca:	e8 0b ed ff ff       	call   801eda <fd_lookup>
+  8031cf:	83 c4 10             	add    $0x10,%esp
+  8031d2:	85 c0                	test   %eax,%eax
+  8031d4:	78 10                	js     8031e6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8031d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031d9:	8b 0d 40 60 84 00    	mov    0x846040,%ecx
+  8031df:	39 08                	cmp    %ecx,(%eax)
+  8031e1:	75 05                	jne    8031e8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8031e3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8031e6:	c9                   	leave
+  8031e7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8031e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8031ed:	eb f7                	jmp    8031e6 <fd2sockid+0x27>
+
+008031ef <sock_flags>:
+{
+  8031ef:	55                   	push   %ebp
+  8031f0:	89 e5                	mov    %esp,%ebp
+  8031f2:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8031f5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8031f8:	52                   	push   %edx
+  8031f9:	50                   	push   %eax
+  8031fa:	e8 db ec ff ff       	call   801eda <fd_lookup>
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	85 c0                	test   %eax,%eax
+  803204:	78 0e                	js     803214 <sock_flags+0x25>
+  803206:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803209:	8b 40 08             	mov    0x8(%eax),%eax
+  80320c:	c1 e8 09             	shr    $0x9,%eax
+  80320f:	83 e0 08             	and    $0x8,%eax
+}
+  803212:	c9                   	leave
+  803213:	c3                   	ret
+		return 0;
+  803214:	b8 00 00 00 00       	mov    $0x0,%eax
+  803219:	eb f7                	jmp    803212 <sock_flags+0x23>
+
+0080321b <alloc_sockfd>:
+{
+  80321b:	55                   	push   %ebp
+  80321c:	89 e5                	mov    %esp,%ebp
+  80321e:	56                   	push   %esi
+  80321f:	53                   	push   %ebx
+  803220:	83 ec 1c             	sub    $0x1c,%esp
+  803223:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803225:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803228:	50                   	push   %eax
+  803229:	e8 5c ec ff ff       	call   801e8a <fd_alloc>
+  80322e:	89 c3                	mov    %eax,%ebx
+  803230:	83 c4 10             	add    $0x10,%esp
+  803233:	85 c0                	test   %eax,%eax
+  803235:	78 43                	js     80327a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803237:	83 ec 04             	sub    $0x4,%esp
+  80323a:	68 07 04 00 00       	push   $0x407
+  80323f:	ff 75 f4             	push   -0xc(%ebp)
+  803242:	6a 00                	push   $0x0
+  803244:	e8 3b e0 ff ff       	call   801284 <sys_page_alloc>
+  803249:	89 c3                	mov    %eax,%ebx
+  80324b:	83 c4 10             	add    $0x10,%esp
+  80324e:	85 c0                	test   %eax,%eax
+  803250:	78 28                	js     80327a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803252:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803255:	8b 15 40 60 84 00    	mov    0x846040,%edx
+  80325b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80325d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803260:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803267:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80326a:	83 ec 0c             	sub    $0xc,%esp
+  80326d:	50                   	push   %eax
+  80326e:	e8 f0 eb ff ff       	call   801e63 <fd2num>
+  803273:	89 c3                	mov    %eax,%ebx
+  803275:	83 c4 10             	add    $0x10,%esp
+  803278:	eb 0c                	jmp    803286 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80327a:	83 ec 0c             	sub    $0xc,%esp
+  80327d:	56                   	push   %esi
+  80327e:	e8 4b 04 00 00       	call   8036ce <nsipc_close>
+		return r;
+  803283:	83 c4 10             	add    $0x10,%esp
+}
+  803286:	89 d8                	mov    %ebx,%eax
+  803288:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80328b:	5b                   	pop    %ebx
+  80328c:	5e                   	pop    %esi
+  80328d:	5d                   	pop    %ebp
+  80328e:	c3                   	ret
+
+0080328f <accept>:
+{
+  80328f:	55                   	push   %ebp
+  803290:	89 e5                	mov    %esp,%ebp
+  803292:	56                   	push   %esi
+  803293:	53                   	push   %ebx
+  803294:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803297:	89 f0                	mov    %esi,%eax
+  803299:	e8 21 ff ff ff       	call   8031bf <fd2sockid>
+  80329e:	89 c3                	mov    %eax,%ebx
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	78 24                	js     8032c8 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8032a4:	89 f0                	mov    %esi,%eax
+  8032a6:	e8 44 ff ff ff       	call   8031ef <sock_flags>
+  8032ab:	50                   	push   %eax
+  8032ac:	ff 75 10             	push   0x10(%ebp)
+  8032af:	ff 75 0c             	push   0xc(%ebp)
+  8032b2:	53                   	push   %ebx
+  8032b3:	e8 6b 03 00 00       	call   803623 <nsipc_accept>
+  8032b8:	89 c3                	mov    %eax,%ebx
+  8032ba:	83 c4 10             	add    $0x10,%esp
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	78 07                	js     8032c8 <accept+0x39>
+	return alloc_sockfd(r);
+  8032c1:	e8 55 ff ff ff       	call   80321b <alloc_sockfd>
+  8032c6:	89 c3                	mov    %eax,%ebx
+}
+  8032c8:	89 d8                	mov    %ebx,%eax
+  8032ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032cd:	5b                   	pop    %ebx
+  8032ce:	5e                   	pop    %esi
+  8032cf:	5d                   	pop    %ebp
+  8032d0:	c3                   	ret
+
+008032d1 <bind>:
+{
+  8032d1:	55                   	push   %ebp
+  8032d2:	89 e5                	mov    %esp,%ebp
+  8032d4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032da:	e8 e0 fe ff ff       	call   8031bf <fd2sockid>
+  8032df:	85 c0                	test   %eax,%eax
+  8032e1:	78 12                	js     8032f5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8032e3:	83 ec 04             	sub    $0x4,%esp
+  8032e6:	ff 75 10             	push   0x10(%ebp)
+  8032e9:	ff 75 0c             	push   0xc(%ebp)
+  8032ec:	50                   	push   %eax
+  8032ed:	e8 85 03 00 00       	call   803677 <nsipc_bind>
+  8032f2:	83 c4 10             	add    $0x10,%esp
+}
+  8032f5:	c9                   	leave
+  8032f6:	c3                   	ret
+
+008032f7 <shutdown>:
+{
+  8032f7:	55                   	push   %ebp
+  8032f8:	89 e5                	mov    %esp,%ebp
+  8032fa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803300:	e8 ba fe ff ff       	call   8031bf <fd2sockid>
+  803305:	85 c0                	test   %eax,%eax
+  803307:	78 0f                	js     803318 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803309:	83 ec 08             	sub    $0x8,%esp
+  80330c:	ff 75 0c             	push   0xc(%ebp)
+  80330f:	50                   	push   %eax
+  803310:	e8 97 03 00 00       	call   8036ac <nsipc_shutdown>
+  803315:	83 c4 10             	add    $0x10,%esp
+}
+  803318:	c9                   	leave
+  803319:	c3                   	ret
+
+0080331a <connect>:
+{
+  80331a:	55                   	push   %ebp
+  80331b:	89 e5                	mov    %esp,%ebp
+  80331d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803320:	8b 45 08             	mov    0x8(%ebp),%eax
+  803323:	e8 97 fe ff ff       	call   8031bf <fd2sockid>
+  803328:	85 c0                	test   %eax,%eax
+  80332a:	78 12                	js     80333e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80332c:	83 ec 04             	sub    $0x4,%esp
+  80332f:	ff 75 10             	push   0x10(%ebp)
+  803332:	ff 75 0c             	push   0xc(%ebp)
+  803335:	50                   	push   %eax
+  803336:	e8 ad 03 00 00       	call   8036e8 <nsipc_connect>
+  80333b:	83 c4 10             	add    $0x10,%esp
+}
+  80333e:	c9                   	leave
+  80333f:	c3                   	ret
+
+00803340 <listen>:
+{
+  803340:	55                   	push   %ebp
+  803341:	89 e5                	mov    %esp,%ebp
+  803343:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803346:	8b 45 08             	mov    0x8(%ebp),%eax
+  803349:	e8 71 fe ff ff       	call   8031bf <fd2sockid>
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	78 0f                	js     803361 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803352:	83 ec 08             	sub    $0x8,%esp
+  803355:	ff 75 0c             	push   0xc(%ebp)
+  803358:	50                   	push   %eax
+  803359:	e8 bf 03 00 00       	call   80371d <nsipc_listen>
+  80335e:	83 c4 10             	add    $0x10,%esp
+}
+  803361:	c9                   	leave
+  803362:	c3                   	ret
+
+00803363 <sendmsg>:
+{
+  803363:	55                   	push   %ebp
+  803364:	89 e5                	mov    %esp,%ebp
+  803366:	57                   	push   %edi
+  803367:	56                   	push   %esi
+  803368:	53                   	push   %ebx
+  803369:	83 ec 0c             	sub    $0xc,%esp
+  80336c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80336f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  803372:	89 f0                	mov    %esi,%eax
+  803374:	e8 46 fe ff ff       	call   8031bf <fd2sockid>
+  803379:	89 c3                	mov    %eax,%ebx
+  80337b:	85 c0                	test   %eax,%eax
+  80337d:	78 1c                	js     80339b <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80337f:	89 f0                	mov    %esi,%eax
+  803381:	e8 69 fe ff ff       	call   8031ef <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  803386:	0b 45 10             	or     0x10(%ebp),%eax
+  803389:	50                   	push   %eax
+  80338a:	ff 77 0c             	push   0xc(%edi)
+  80338d:	ff 77 08             	push   0x8(%edi)
+  803390:	53                   	push   %ebx
+  803391:	e8 7c 04 00 00       	call   803812 <nsipc_sendmsg>
+  803396:	89 c3                	mov    %eax,%ebx
+  803398:	83 c4 10             	add    $0x10,%esp
+}
+  80339b:	89 d8                	mov    %ebx,%eax
+  80339d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a0:	5b                   	pop    %ebx
+  8033a1:	5e                   	pop    %esi
+  8033a2:	5f                   	pop    %edi
+  8033a3:	5d                   	pop    %ebp
+  8033a4:	c3                   	ret
+
+008033a5 <recvmsg>:
+{
+  8033a5:	55                   	push   %ebp
+  8033a6:	89 e5                	mov    %esp,%ebp
+  8033a8:	57                   	push   %edi
+  8033a9:	56                   	push   %esi
+  8033aa:	53                   	push   %ebx
+  8033ab:	83 ec 0c             	sub    $0xc,%esp
+  8033ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8033b4:	89 f8                	mov    %edi,%eax
+  8033b6:	e8 04 fe ff ff       	call   8031bf <fd2sockid>
+  8033bb:	89 c3                	mov    %eax,%ebx
+  8033bd:	85 c0                	test   %eax,%eax
+  8033bf:	78 2a                	js     8033eb <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8033c1:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8033c8:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8033cf:	89 f8                	mov    %edi,%eax
+  8033d1:	e8 19 fe ff ff       	call   8031ef <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8033d6:	0b 45 10             	or     0x10(%ebp),%eax
+  8033d9:	50                   	push   %eax
+  8033da:	ff 76 0c             	push   0xc(%esi)
+  8033dd:	ff 76 08             	push   0x8(%esi)
+  8033e0:	53                   	push   %ebx
+  8033e1:	e8 d6 07 00 00       	call   803bbc <nsipc_recvmsg>
+  8033e6:	89 c3                	mov    %eax,%ebx
+  8033e8:	83 c4 10             	add    $0x10,%esp
+}
+  8033eb:	89 d8                	mov    %ebx,%eax
+  8033ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f0:	5b                   	pop    %ebx
+  8033f1:	5e                   	pop    %esi
+  8033f2:	5f                   	pop    %edi
+  8033f3:	5d                   	pop    %ebp
+  8033f4:	c3                   	ret
+
+008033f5 <sendfile>:
+{
+  8033f5:	55                   	push   %ebp
+  8033f6:	89 e5                	mov    %esp,%ebp
+  8033f8:	56                   	push   %esi
+  8033f9:	53                   	push   %ebx
+  8033fa:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8033fd:	89 f0                	mov    %esi,%eax
+  8033ff:	e8 bb fd ff ff       	call   8031bf <fd2sockid>
+  803404:	89 c3                	mov    %eax,%ebx
+  803406:	85 c0                	test   %eax,%eax
+  803408:	78 1f                	js     803429 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80340a:	89 f0                	mov    %esi,%eax
+  80340c:	e8 de fd ff ff       	call   8031ef <sock_flags>
+  803411:	83 ec 0c             	sub    $0xc,%esp
+  803414:	50                   	push   %eax
+  803415:	ff 75 14             	push   0x14(%ebp)
+  803418:	ff 75 10             	push   0x10(%ebp)
+  80341b:	ff 75 0c             	push   0xc(%ebp)
+  80341e:	53                   	push   %ebx
+  80341f:	e8 64 06 00 00       	call   803a88 <nsipc_sendfile>
+  803424:	89 c3                	mov    %eax,%ebx
+  803426:	83 c4 20             	add    $0x20,%esp
+}
+  803429:	89 d8                	mov    %ebx,%eax
+  80342b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80342e:	5b                   	pop    %ebx
+  80342f:	5e                   	pop    %esi
+  803430:	5d                   	pop    %ebp
+  803431:	c3                   	ret
+
+00803432 <evctl>:
+{
+  803432:	55                   	push   %ebp
+  803433:	89 e5                	mov    %esp,%ebp
+  803435:	53                   	push   %ebx
+  803436:	83 ec 04             	sub    $0x4,%esp
+  803439:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80343c:	89 d8                	mov    %ebx,%eax
+  80343e:	e8 7c fd ff ff       	call   8031bf <fd2sockid>
+  803443:	85 c0                	test   %eax,%eax
+  803445:	78 10                	js     803457 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  803447:	83 ec 04             	sub    $0x4,%esp
+  80344a:	53                   	push   %ebx
+  80344b:	ff 75 0c             	push   0xc(%ebp)
+  80344e:	50                   	push   %eax
+  80344f:	e8 d2 0b 00 00       	call   804026 <nsipc_evctl>
+  803454:	83 c4 10             	add    $0x10,%esp
+}
+  803457:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80345a:	c9                   	leave
+  80345b:	c3                   	ret
+
+0080345c <evwait>:
+{
+  80345c:	55                   	push   %ebp
+  80345d:	89 e5                	mov    %esp,%ebp
+  80345f:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  803462:	ff 75 10             	push   0x10(%ebp)
+  803465:	ff 75 0c             	push   0xc(%ebp)
+  803468:	ff 75 08             	push   0x8(%ebp)
+  80346b:	e8 e0 0b 00 00       	call   804050 <nsipc_evwait>
+}
+  803470:	c9                   	leave
+  803471:	c3                   	ret
+
+00803472 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803472:	55                   	push   %ebp
+  803473:	89 e5                	mov    %esp,%ebp
+  803475:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803478:	ff 75 10             	push   0x10(%ebp)
+  80347b:	ff 75 0c             	push   0xc(%ebp)
+  80347e:	ff 75 08             	push   0x8(%ebp)
+  803481:	e8 31 0c 00 00       	call   8040b7 <nsipc_socket>
+  803486:	83 c4 10             	add    $0x10,%esp
+  803489:	85 c0                	test   %eax,%eax
+  80348b:	78 05                	js     803492 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80348d:	e8 89 fd ff ff       	call   80321b <alloc_sockfd>
+}
+  803492:	c9                   	leave
+  803493:	c3                   	ret
+
+00803494 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803494:	55                   	push   %ebp
+  803495:	89 e5                	mov    %esp,%ebp
+  803497:	53                   	push   %ebx
+  803498:	83 ec 04             	sub    $0x4,%esp
+  80349b:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80349d:	83 3d 24 80 84 00 00 	cmpl   $0x0,0x848024
+  8034a4:	74 26                	je     8034cc <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8034a6:	6a 07                	push   $0x7
+  8034a8:	68 00 a0 84 00       	push   $0x84a000
+  8034ad:	53                   	push   %ebx
+  8034ae:	ff 35 24 80 84 00    	push   0x848024
+  8034b4:	e8 5b 1b 00 00       	call   805014 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8034b9:	83 c4 0c             	add    $0xc,%esp
+  8034bc:	6a 00                	push   $0x0
+  8034be:	6a 00                	push   $0x0
+  8034c0:	6a 00                	push   $0x0
+  8034c2:	e8 bd 18 00 00       	call   804d84 <ipc_recv>
+}
+  8034c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034ca:	c9                   	leave
+  8034cb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8034cc:	83 ec 0c             	sub    $0xc,%esp
+  8034cf:	6a 03                	push   $0x3
+  8034d1:	e8 a7 1b 00 00       	call   80507d <ipc_find_env>
+  8034d6:	a3 24 80 84 00       	mov    %eax,0x848024
+  8034db:	83 c4 10             	add    $0x10,%esp
+  8034de:	eb c6                	jmp    8034a6 <nsipc+0x12>
+
+008034e0 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8034e0:	55                   	push   %ebp
+  8034e1:	89 e5                	mov    %esp,%ebp
+  8034e3:	56                   	push   %esi
+  8034e4:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8034e5:	8b 35 30 80 84 00    	mov    0x848030,%esi
+		return 0;
+  8034eb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8034f0:	85 f6                	test   %esi,%esi
+  8034f2:	75 33                	jne    803527 <nsbulk_map+0x47>
+  8034f4:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8034f9:	83 ec 04             	sub    $0x4,%esp
+  8034fc:	6a 07                	push   $0x7
+  8034fe:	53                   	push   %ebx
+  8034ff:	6a 00                	push   $0x0
+  803501:	e8 7e dd ff ff       	call   801284 <sys_page_alloc>
+  803506:	83 c4 10             	add    $0x10,%esp
+  803509:	85 c0                	test   %eax,%eax
+  80350b:	78 1a                	js     803527 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80350d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803513:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  803519:	75 de                	jne    8034f9 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  80351b:	c7 05 30 80 84 00 01 	movl   $0x1,0x848030
+  803522:	00 00 00 
+	return 0;
+  803525:	89 f0                	mov    %esi,%eax
+}
+  803527:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80352a:	5b                   	pop    %ebx
+  80352b:	5e                   	pop    %esi
+  80352c:	5d                   	pop    %ebp
+  80352d:	c3                   	ret
+
+0080352e <nsbulk_own>:
+{
+  80352e:	55                   	push   %ebp
+  80352f:	89 e5                	mov    %esp,%ebp
+  803531:	57                   	push   %edi
+  803532:	56                   	push   %esi
+  803533:	53                   	push   %ebx
+  803534:	83 ec 0c             	sub    $0xc,%esp
+  803537:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  803539:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80353c:	85 d2                	test   %edx,%edx
+  80353e:	7f 0e                	jg     80354e <nsbulk_own+0x20>
+	return 0;
+  803540:	b8 00 00 00 00       	mov    $0x0,%eax
+  803545:	eb 47                	jmp    80358e <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  803547:	83 c3 01             	add    $0x1,%ebx
+  80354a:	39 fb                	cmp    %edi,%ebx
+  80354c:	7d 3b                	jge    803589 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80354e:	be 01 00 00 00       	mov    $0x1,%esi
+  803553:	89 d9                	mov    %ebx,%ecx
+  803555:	d3 e6                	shl    %cl,%esi
+  803557:	89 f0                	mov    %esi,%eax
+  803559:	23 05 2c 80 84 00    	and    0x84802c,%eax
+  80355f:	74 e6                	je     803547 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  803561:	83 ec 04             	sub    $0x4,%esp
+  803564:	6a 07                	push   $0x7
+  803566:	89 d8                	mov    %ebx,%eax
+  803568:	c1 e0 0c             	shl    $0xc,%eax
+  80356b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803570:	50                   	push   %eax
+  803571:	6a 00                	push   $0x0
+  803573:	e8 0c dd ff ff       	call   801284 <sys_page_alloc>
+  803578:	83 c4 10             	add    $0x10,%esp
+  80357b:	85 c0                	test   %eax,%eax
+  80357d:	78 0f                	js     80358e <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80357f:	f7 d6                	not    %esi
+  803581:	21 35 2c 80 84 00    	and    %esi,0x84802c
+  803587:	eb be                	jmp    803547 <nsbulk_own+0x19>
+	return 0;
+  803589:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80358e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803591:	5b                   	pop    %ebx
+  803592:	5e                   	pop    %esi
+  803593:	5f                   	pop    %edi
+  803594:	5d                   	pop    %ebp
+  803595:	c3                   	ret
+
+00803596 <nsipc_bulk>:
+{
+  803596:	55                   	push   %ebp
+  803597:	89 e5                	mov    %esp,%ebp
+  803599:	57                   	push   %edi
+  80359a:	56                   	push   %esi
+  80359b:	53                   	push   %ebx
+  80359c:	83 ec 1c             	sub    $0x1c,%esp
+  80359f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8035a2:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8035a4:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8035aa:	c1 fb 0c             	sar    $0xc,%ebx
+  8035ad:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8035b0:	83 3d 24 80 84 00 00 	cmpl   $0x0,0x848024
+  8035b7:	74 56                	je     80360f <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8035b9:	85 ff                	test   %edi,%edi
+  8035bb:	7e 24                	jle    8035e1 <nsipc_bulk+0x4b>
+  8035bd:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8035c3:	74 1c                	je     8035e1 <nsipc_bulk+0x4b>
+  8035c5:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8035cb:	c1 e3 0c             	shl    $0xc,%ebx
+  8035ce:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8035d3:	0f b6 10             	movzbl (%eax),%edx
+  8035d6:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8035d8:	05 00 10 00 00       	add    $0x1000,%eax
+  8035dd:	39 d8                	cmp    %ebx,%eax
+  8035df:	75 f2                	jne    8035d3 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8035e1:	83 ec 0c             	sub    $0xc,%esp
+  8035e4:	56                   	push   %esi
+  8035e5:	57                   	push   %edi
+  8035e6:	68 00 00 00 e0       	push   $0xe0000000
+  8035eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8035ee:	ff 35 24 80 84 00    	push   0x848024
+  8035f4:	e8 4f 1a 00 00       	call   805048 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8035f9:	83 c4 1c             	add    $0x1c,%esp
+  8035fc:	6a 00                	push   $0x0
+  8035fe:	6a 00                	push   $0x0
+  803600:	6a 00                	push   $0x0
+  803602:	e8 7d 17 00 00       	call   804d84 <ipc_recv>
+}
+  803607:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80360a:	5b                   	pop    %ebx
+  80360b:	5e                   	pop    %esi
+  80360c:	5f                   	pop    %edi
+  80360d:	5d                   	pop    %ebp
+  80360e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80360f:	83 ec 0c             	sub    $0xc,%esp
+  803612:	6a 03                	push   $0x3
+  803614:	e8 64 1a 00 00       	call   80507d <ipc_find_env>
+  803619:	a3 24 80 84 00       	mov    %eax,0x848024
+  80361e:	83 c4 10             	add    $0x10,%esp
+  803621:	eb 96                	jmp    8035b9 <nsipc_bulk+0x23>
+
+00803623 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  803623:	55                   	push   %ebp
+  803624:	89 e5                	mov    %esp,%ebp
+  803626:	53                   	push   %ebx
+  803627:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80362a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80362d:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.accept.req_flags = flags;
+  803632:	8b 45 14             	mov    0x14(%ebp),%eax
+  803635:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80363a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80363f:	e8 50 fe ff ff       	call   803494 <nsipc>
+  803644:	89 c3                	mov    %eax,%ebx
+  803646:	85 c0                	test   %eax,%eax
+  803648:	79 07                	jns    803651 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80364a:	89 d8                	mov    %ebx,%eax
+  80364c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80364f:	c9                   	leave
+  803650:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803651:	83 ec 04             	sub    $0x4,%esp
+  803654:	ff 35 10 a0 84 00    	push   0x84a010
+  80365a:	68 00 a0 84 00       	push   $0x84a000
+  80365f:	ff 75 0c             	push   0xc(%ebp)
+  803662:	e8 99 d9 ff ff       	call   801000 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803667:	8b 15 10 a0 84 00    	mov    0x84a010,%edx
+  80366d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803670:	89 10                	mov    %edx,(%eax)
+  803672:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803675:	eb d3                	jmp    80364a <nsipc_accept+0x27>
+
+00803677 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803677:	55                   	push   %ebp
+  803678:	89 e5                	mov    %esp,%ebp
+  80367a:	53                   	push   %ebx
+  80367b:	83 ec 08             	sub    $0x8,%esp
+  80367e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803681:	8b 45 08             	mov    0x8(%ebp),%eax
+  803684:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803689:	53                   	push   %ebx
+  80368a:	ff 75 0c             	push   0xc(%ebp)
+  80368d:	68 04 a0 84 00       	push   $0x84a004
+  803692:	e8 69 d9 ff ff       	call   801000 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803697:	89 1d 14 a0 84 00    	mov    %ebx,0x84a014
+	return nsipc(NSREQ_BIND);
+  80369d:	b8 02 00 00 00       	mov    $0x2,%eax
+  8036a2:	e8 ed fd ff ff       	call   803494 <nsipc>
+}
+  8036a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036aa:	c9                   	leave
+  8036ab:	c3                   	ret
+
+008036ac <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8036ac:	55                   	push   %ebp
+  8036ad:	89 e5                	mov    %esp,%ebp
+  8036af:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8036b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036b5:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.shutdown.req_how = how;
+  8036ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036bd:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	return nsipc(NSREQ_SHUTDOWN);
+  8036c2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8036c7:	e8 c8 fd ff ff       	call   803494 <nsipc>
+}
+  8036cc:	c9                   	leave
+  8036cd:	c3                   	ret
+
+008036ce <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8036ce:	55                   	push   %ebp
+  8036cf:	89 e5                	mov    %esp,%ebp
+  8036d1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8036d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036d7:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	return nsipc(NSREQ_CLOSE);
+  8036dc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8036e1:	e8 ae fd ff ff       	call   803494 <nsipc>
+}
+  8036e6:	c9                   	leave
+  8036e7:	c3                   	ret
+
+008036e8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8036e8:	55                   	push   %ebp
+  8036e9:	89 e5                	mov    %esp,%ebp
+  8036eb:	53                   	push   %ebx
+  8036ec:	83 ec 08             	sub    $0x8,%esp
+  8036ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8036f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036f5:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8036fa:	53                   	push   %ebx
+  8036fb:	ff 75 0c             	push   0xc(%ebp)
+  8036fe:	68 04 a0 84 00       	push   $0x84a004
+  803703:	e8 f8 d8 ff ff       	call   801000 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803708:	89 1d 14 a0 84 00    	mov    %ebx,0x84a014
+	return nsipc(NSREQ_CONNECT);
+  80370e:	b8 05 00 00 00       	mov    $0x5,%eax
+  803713:	e8 7c fd ff ff       	call   803494 <nsipc>
+}
+  803718:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80371b:	c9                   	leave
+  80371c:	c3                   	ret
+
+0080371d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80371d:	55                   	push   %ebp
+  80371e:	89 e5                	mov    %esp,%ebp
+  803720:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803723:	8b 45 08             	mov    0x8(%ebp),%eax
+  803726:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.listen.req_backlog = backlog;
+  80372b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80372e:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	return nsipc(NSREQ_LISTEN);
+  803733:	b8 06 00 00 00       	mov    $0x6,%eax
+  803738:	e8 57 fd ff ff       	call   803494 <nsipc>
+}
+  80373d:	c9                   	leave
+  80373e:	c3                   	ret
+
+0080373f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80373f:	55                   	push   %ebp
+  803740:	89 e5                	mov    %esp,%ebp
+  803742:	56                   	push   %esi
+  803743:	53                   	push   %ebx
+  803744:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803747:	8b 45 08             	mov    0x8(%ebp),%eax
+  80374a:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.recv.req_len = len;
+  80374f:	89 35 04 a0 84 00    	mov    %esi,0x84a004
+	nsipcbuf.recv.req_flags = flags;
+  803755:	8b 45 14             	mov    0x14(%ebp),%eax
+  803758:	a3 08 a0 84 00       	mov    %eax,0x84a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80375d:	b8 07 00 00 00       	mov    $0x7,%eax
+  803762:	e8 2d fd ff ff       	call   803494 <nsipc>
+  803767:	89 c3                	mov    %eax,%ebx
+  803769:	85 c0                	test   %eax,%eax
+  80376b:	78 22                	js     80378f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80376d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803772:	39 c6                	cmp    %eax,%esi
+  803774:	0f 4e c6             	cmovle %esi,%eax
+  803777:	39 c3                	cmp    %eax,%ebx
+  803779:	7f 1d                	jg     803798 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80377b:	83 ec 04             	sub    $0x4,%esp
+  80377e:	53                   	push   %ebx
+  80377f:	68 00 a0 84 00       	push   $0x84a000
+  803784:	ff 75 0c             	push   0xc(%ebp)
+  803787:	e8 74 d8 ff ff       	call   801000 <memmove>
+  80378c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80378f:	89 d8                	mov    %ebx,%eax
+  803791:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803794:	5b                   	pop    %ebx
+  803795:	5e                   	pop    %esi
+  803796:	5d                   	pop    %ebp
+  803797:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803798:	68 07 5a 80 00       	push   $0x805a07
+  80379d:	68 66 59 80 00       	push   $0x805966
+  8037a2:	68 b2 00 00 00       	push   $0xb2
+  8037a7:	68 1c 5a 80 00       	push   $0x805a1c
+  8037ac:	e8 cd ce ff ff       	call   80067e <_panic>
+
+008037b1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8037b1:	55                   	push   %ebp
+  8037b2:	89 e5                	mov    %esp,%ebp
+  8037b4:	53                   	push   %ebx
+  8037b5:	83 ec 04             	sub    $0x4,%esp
+  8037b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8037bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037be:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	assert(size < 1600);
+  8037c3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8037c9:	7f 2e                	jg     8037f9 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8037cb:	83 ec 04             	sub    $0x4,%esp
+  8037ce:	53                   	push   %ebx
+  8037cf:	ff 75 0c             	push   0xc(%ebp)
+  8037d2:	68 0c a0 84 00       	push   $0x84a00c
+  8037d7:	e8 24 d8 ff ff       	call   801000 <memmove>
+	nsipcbuf.send.req_size = size;
+  8037dc:	89 1d 04 a0 84 00    	mov    %ebx,0x84a004
+	nsipcbuf.send.req_flags = flags;
+  8037e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037e5:	a3 08 a0 84 00       	mov    %eax,0x84a008
+	return nsipc(NSREQ_SEND);
+  8037ea:	b8 08 00 00 00       	mov    $0x8,%eax
+  8037ef:	e8 a0 fc ff ff       	call   803494 <nsipc>
+}
+  8037f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037f7:	c9                   	leave
+  8037f8:	c3                   	ret
+	assert(size < 1600);
+  8037f9:	68 28 5a 80 00       	push   $0x805a28
+  8037fe:	68 66 59 80 00       	push   $0x805966
+  803803:	68 bd 00 00 00       	push   $0xbd
+  803808:	68 1c 5a 80 00       	push   $0x805a1c
+  80380d:	e8 6c ce ff ff       	call   80067e <_panic>
+
+00803812 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803812:	55                   	push   %ebp
+  803813:	89 e5                	mov    %esp,%ebp
+  803815:	57                   	push   %edi
+  803816:	56                   	push   %esi
+  803817:	53                   	push   %ebx
+  803818:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  80381b:	e8 c0 fc ff ff       	call   8034e0 <nsbulk_map>
+  803820:	85 c0                	test   %eax,%eax
+  803822:	78 55                	js     803879 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  803824:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  80382b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  803832:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803839:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80383c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80383f:	0f 8d 24 02 00 00    	jge    803a69 <nsipc_sendmsg+0x257>
+  803845:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803848:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80384b:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80384e:	89 d8                	mov    %ebx,%eax
+  803850:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803855:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  803857:	83 ec 0c             	sub    $0xc,%esp
+  80385a:	68 20 7d 84 00       	push   $0x847d20
+  80385f:	e8 bc 0f 00 00       	call   804820 <pgbatch_init>
+  803864:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803867:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  803869:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80386c:	e9 82 00 00 00       	jmp    8038f3 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  803871:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803874:	85 db                	test   %ebx,%ebx
+  803876:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  803879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80387c:	5b                   	pop    %ebx
+  80387d:	5e                   	pop    %esi
+  80387e:	5f                   	pop    %edi
+  80387f:	5d                   	pop    %ebp
+  803880:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  803881:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803886:	29 c8                	sub    %ecx,%eax
+  803888:	39 d0                	cmp    %edx,%eax
+  80388a:	0f 46 d0             	cmovbe %eax,%edx
+  80388d:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80388f:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803895:	85 ff                	test   %edi,%edi
+  803897:	0f 49 c7             	cmovns %edi,%eax
+  80389a:	c1 f8 0c             	sar    $0xc,%eax
+  80389d:	ba 01 00 00 00       	mov    $0x1,%edx
+  8038a2:	e8 87 fc ff ff       	call   80352e <nsbulk_own>
+  8038a7:	85 c0                	test   %eax,%eax
+  8038a9:	0f 88 17 01 00 00    	js     8039c6 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8038af:	83 ec 04             	sub    $0x4,%esp
+  8038b2:	56                   	push   %esi
+  8038b3:	ff 75 e0             	push   -0x20(%ebp)
+  8038b6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8038b9:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8038be:	50                   	push   %eax
+  8038bf:	e8 3c d7 ff ff       	call   801000 <memmove>
+  8038c4:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8038c7:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8038ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038cd:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8038d0:	0f 84 fd 00 00 00    	je     8039d3 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8038d6:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8038d9:	01 f7                	add    %esi,%edi
+  8038db:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8038de:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8038e1:	0f 8d 01 01 00 00    	jge    8039e8 <nsipc_sendmsg+0x1d6>
+  8038e7:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8038ed:	0f 8f f0 00 00 00    	jg     8039e3 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8038f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038f6:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8038f9:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8038fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038ff:	89 c2                	mov    %eax,%edx
+  803901:	03 13                	add    (%ebx),%edx
+  803903:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  803906:	8b 73 04             	mov    0x4(%ebx),%esi
+  803909:	29 c6                	sub    %eax,%esi
+  80390b:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  803910:	29 f9                	sub    %edi,%ecx
+  803912:	39 ce                	cmp    %ecx,%esi
+  803914:	89 ca                	mov    %ecx,%edx
+  803916:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  803919:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80391c:	89 f9                	mov    %edi,%ecx
+  80391e:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  803924:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803927:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80392c:	09 c8                	or     %ecx,%eax
+  80392e:	0f 85 4d ff ff ff    	jne    803881 <nsipc_sendmsg+0x6f>
+  803934:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80393a:	0f 86 41 ff ff ff    	jbe    803881 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803940:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803946:	85 ff                	test   %edi,%edi
+  803948:	0f 49 c7             	cmovns %edi,%eax
+  80394b:	c1 f8 0c             	sar    $0xc,%eax
+  80394e:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  803950:	89 d1                	mov    %edx,%ecx
+  803952:	c1 e9 0c             	shr    $0xc,%ecx
+  803955:	01 c8                	add    %ecx,%eax
+  803957:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80395a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80395d:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80395f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803962:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803967:	29 c8                	sub    %ecx,%eax
+  803969:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80396c:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80396f:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803971:	b8 01 00 00 00       	mov    $0x1,%eax
+  803976:	89 f9                	mov    %edi,%ecx
+  803978:	d3 e0                	shl    %cl,%eax
+  80397a:	09 05 2c 80 84 00    	or     %eax,0x84802c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803980:	83 ec 08             	sub    $0x8,%esp
+  803983:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  803985:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803988:	50                   	push   %eax
+  803989:	6a 00                	push   $0x0
+  80398b:	56                   	push   %esi
+  80398c:	6a 00                	push   $0x0
+  80398e:	68 20 7d 84 00       	push   $0x847d20
+  803993:	e8 46 0f 00 00       	call   8048de <pgbatch_map>
+  803998:	83 c4 20             	add    $0x20,%esp
+  80399b:	85 c0                	test   %eax,%eax
+  80399d:	0f 88 ce fe ff ff    	js     803871 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8039a3:	83 c7 01             	add    $0x1,%edi
+  8039a6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8039ac:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8039af:	39 c7                	cmp    %eax,%edi
+  8039b1:	75 be                	jne    803971 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8039b3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8039b6:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8039b9:	89 d6                	mov    %edx,%esi
+  8039bb:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8039c1:	e9 01 ff ff ff       	jmp    8038c7 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8039c6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8039c9:	85 db                	test   %ebx,%ebx
+  8039cb:	0f 45 c3             	cmovne %ebx,%eax
+  8039ce:	e9 a6 fe ff ff       	jmp    803879 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8039d3:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8039d7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8039de:	e9 f3 fe ff ff       	jmp    8038d6 <nsipc_sendmsg+0xc4>
+  8039e3:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8039e6:	eb 03                	jmp    8039eb <nsipc_sendmsg+0x1d9>
+  8039e8:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8039eb:	83 ec 0c             	sub    $0xc,%esp
+  8039ee:	68 20 7d 84 00       	push   $0x847d20
+  8039f3:	e8 36 0e 00 00       	call   80482e <pgbatch_flush>
+  8039f8:	83 c4 10             	add    $0x10,%esp
+  8039fb:	85 c0                	test   %eax,%eax
+  8039fd:	78 50                	js     803a4f <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8039ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a02:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  803a07:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  803a0d:	89 fb                	mov    %edi,%ebx
+  803a0f:	29 f3                	sub    %esi,%ebx
+  803a11:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  803a17:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a1a:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  803a1f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803a24:	89 fa                	mov    %edi,%edx
+  803a26:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803a2b:	e8 66 fb ff ff       	call   803596 <nsipc_bulk>
+  803a30:	85 c0                	test   %eax,%eax
+  803a32:	78 28                	js     803a5c <nsipc_sendmsg+0x24a>
+		sent += r;
+  803a34:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  803a37:	39 c3                	cmp    %eax,%ebx
+  803a39:	75 0c                	jne    803a47 <nsipc_sendmsg+0x235>
+  803a3b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803a3e:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803a41:	0f 8f f2 fd ff ff    	jg     803839 <nsipc_sendmsg+0x27>
+		sent += r;
+  803a47:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803a4a:	e9 2a fe ff ff       	jmp    803879 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803a4f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803a52:	85 db                	test   %ebx,%ebx
+  803a54:	0f 45 c3             	cmovne %ebx,%eax
+  803a57:	e9 1d fe ff ff       	jmp    803879 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803a5c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803a5f:	85 db                	test   %ebx,%ebx
+  803a61:	0f 45 c3             	cmovne %ebx,%eax
+  803a64:	e9 10 fe ff ff       	jmp    803879 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803a69:	83 ec 0c             	sub    $0xc,%esp
+  803a6c:	68 20 7d 84 00       	push   $0x847d20
+  803a71:	e8 aa 0d 00 00       	call   804820 <pgbatch_init>
+  803a76:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803a79:	be 00 00 00 00       	mov    $0x0,%esi
+  803a7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a83:	e9 63 ff ff ff       	jmp    8039eb <nsipc_sendmsg+0x1d9>
+
+00803a88 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803a88:	55                   	push   %ebp
+  803a89:	89 e5                	mov    %esp,%ebp
+  803a8b:	57                   	push   %edi
+  803a8c:	56                   	push   %esi
+  803a8d:	53                   	push   %ebx
+  803a8e:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  803a91:	83 3d 28 80 84 00 00 	cmpl   $0x0,0x848028
+  803a98:	0f 84 c8 00 00 00    	je     803b66 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803a9e:	83 3d 24 80 84 00 00 	cmpl   $0x0,0x848024
+  803aa5:	0f 84 e4 00 00 00    	je     803b8f <nsipc_sendfile+0x107>
+{
+  803aab:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  803ab0:	89 fb                	mov    %edi,%ebx
+  803ab2:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  803ab5:	0f 83 f0 00 00 00    	jae    803bab <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803abb:	89 fa                	mov    %edi,%edx
+  803abd:	03 55 10             	add    0x10(%ebp),%edx
+  803ac0:	89 d0                	mov    %edx,%eax
+  803ac2:	c1 f8 1f             	sar    $0x1f,%eax
+  803ac5:	c1 e8 14             	shr    $0x14,%eax
+  803ac8:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803acb:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803ad1:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803ad3:	6a 10                	push   $0x10
+  803ad5:	68 00 20 01 e0       	push   $0xe0012000
+  803ada:	52                   	push   %edx
+  803adb:	ff 75 0c             	push   0xc(%ebp)
+  803ade:	e8 fe eb ff ff       	call   8026e1 <fmap>
+  803ae3:	83 c4 10             	add    $0x10,%esp
+  803ae6:	85 c0                	test   %eax,%eax
+  803ae8:	0f 8e b8 00 00 00    	jle    803ba6 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  803aee:	39 c6                	cmp    %eax,%esi
+  803af0:	0f 8d b5 00 00 00    	jge    803bab <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  803af6:	29 f0                	sub    %esi,%eax
+  803af8:	8b 55 14             	mov    0x14(%ebp),%edx
+  803afb:	29 da                	sub    %ebx,%edx
+  803afd:	39 d0                	cmp    %edx,%eax
+  803aff:	89 d3                	mov    %edx,%ebx
+  803b01:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  803b04:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b07:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803b0c:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  803b12:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  803b18:	8b 45 18             	mov    0x18(%ebp),%eax
+  803b1b:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803b20:	83 ec 0c             	sub    $0xc,%esp
+  803b23:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  803b25:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803b2c:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803b2f:	83 c0 01             	add    $0x1,%eax
+  803b32:	50                   	push   %eax
+  803b33:	68 00 10 01 e0       	push   $0xe0011000
+  803b38:	6a 11                	push   $0x11
+  803b3a:	ff 35 24 80 84 00    	push   0x848024
+  803b40:	e8 03 15 00 00       	call   805048 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803b45:	83 c4 1c             	add    $0x1c,%esp
+  803b48:	6a 00                	push   $0x0
+  803b4a:	6a 00                	push   $0x0
+  803b4c:	6a 00                	push   $0x0
+  803b4e:	e8 31 12 00 00       	call   804d84 <ipc_recv>
+  803b53:	83 c4 10             	add    $0x10,%esp
+  803b56:	85 c0                	test   %eax,%eax
+  803b58:	78 5b                	js     803bb5 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803b5a:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803b5c:	39 c3                	cmp    %eax,%ebx
+  803b5e:	0f 8e 4c ff ff ff    	jle    803ab0 <nsipc_sendfile+0x28>
+  803b64:	eb 45                	jmp    803bab <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803b66:	83 ec 04             	sub    $0x4,%esp
+  803b69:	6a 07                	push   $0x7
+  803b6b:	68 00 10 01 e0       	push   $0xe0011000
+  803b70:	6a 00                	push   $0x0
+  803b72:	e8 0d d7 ff ff       	call   801284 <sys_page_alloc>
+  803b77:	89 c7                	mov    %eax,%edi
+  803b79:	83 c4 10             	add    $0x10,%esp
+  803b7c:	85 c0                	test   %eax,%eax
+  803b7e:	78 2b                	js     803bab <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803b80:	c7 05 28 80 84 00 01 	movl   $0x1,0x848028
+  803b87:	00 00 00 
+  803b8a:	e9 0f ff ff ff       	jmp    803a9e <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803b8f:	83 ec 0c             	sub    $0xc,%esp
+  803b92:	6a 03                	push   $0x3
+  803b94:	e8 e4 14 00 00       	call   80507d <ipc_find_env>
+  803b99:	a3 24 80 84 00       	mov    %eax,0x848024
+  803b9e:	83 c4 10             	add    $0x10,%esp
+  803ba1:	e9 05 ff ff ff       	jmp    803aab <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803ba6:	85 ff                	test   %edi,%edi
+  803ba8:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803bab:	89 f8                	mov    %edi,%eax
+  803bad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bb0:	5b                   	pop    %ebx
+  803bb1:	5e                   	pop    %esi
+  803bb2:	5f                   	pop    %edi
+  803bb3:	5d                   	pop    %ebp
+  803bb4:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803bb5:	85 ff                	test   %edi,%edi
+  803bb7:	0f 44 f8             	cmove  %eax,%edi
+  803bba:	eb ef                	jmp    803bab <nsipc_sendfile+0x123>
+
+00803bbc <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803bbc:	55                   	push   %ebp
+  803bbd:	89 e5                	mov    %esp,%ebp
+  803bbf:	57                   	push   %edi
+  803bc0:	56                   	push   %esi
+  803bc1:	53                   	push   %ebx
+  803bc2:	83 ec 1c             	sub    $0x1c,%esp
+  803bc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803bc8:	e8 13 f9 ff ff       	call   8034e0 <nsbulk_map>
+  803bcd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803bd0:	85 c0                	test   %eax,%eax
+  803bd2:	0f 88 ba 00 00 00    	js     803c92 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803bd8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803bdc:	0f 8e bb 00 00 00    	jle    803c9d <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803be2:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803be7:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  803bec:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803bf1:	89 f8                	mov    %edi,%eax
+  803bf3:	29 f0                	sub    %esi,%eax
+  803bf5:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  803bf9:	39 c8                	cmp    %ecx,%eax
+  803bfb:	0f 47 c1             	cmova  %ecx,%eax
+  803bfe:	01 f0                	add    %esi,%eax
+  803c00:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803c02:	83 c2 01             	add    $0x1,%edx
+  803c05:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803c08:	7e 07                	jle    803c11 <nsipc_recvmsg+0x55>
+  803c0a:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803c0f:	7e e0                	jle    803bf1 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803c11:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  803c17:	c1 fa 0c             	sar    $0xc,%edx
+  803c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1f:	e8 0a f9 ff ff       	call   80352e <nsbulk_own>
+  803c24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c27:	85 c0                	test   %eax,%eax
+  803c29:	78 67                	js     803c92 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c2e:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803c33:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803c39:	8b 45 14             	mov    0x14(%ebp),%eax
+  803c3c:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803c41:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803c46:	89 f2                	mov    %esi,%edx
+  803c48:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803c4d:	e8 44 f9 ff ff       	call   803596 <nsipc_bulk>
+  803c52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c55:	85 c0                	test   %eax,%eax
+  803c57:	78 39                	js     803c92 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803c59:	39 f0                	cmp    %esi,%eax
+  803c5b:	7f 4a                	jg     803ca7 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803c5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c62:	85 c0                	test   %eax,%eax
+  803c64:	7e 2c                	jle    803c92 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803c66:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803c69:	29 fe                	sub    %edi,%esi
+  803c6b:	8b 43 04             	mov    0x4(%ebx),%eax
+  803c6e:	39 c6                	cmp    %eax,%esi
+  803c70:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803c73:	83 ec 04             	sub    $0x4,%esp
+  803c76:	56                   	push   %esi
+  803c77:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803c7d:	50                   	push   %eax
+  803c7e:	ff 33                	push   (%ebx)
+  803c80:	e8 7b d3 ff ff       	call   801000 <memmove>
+		n += m;
+  803c85:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803c87:	83 c3 08             	add    $0x8,%ebx
+  803c8a:	83 c4 10             	add    $0x10,%esp
+  803c8d:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803c90:	7f d4                	jg     803c66 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803c92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c98:	5b                   	pop    %ebx
+  803c99:	5e                   	pop    %esi
+  803c9a:	5f                   	pop    %edi
+  803c9b:	5d                   	pop    %ebp
+  803c9c:	c3                   	ret
+	int r, i, n, len = 0;
+  803c9d:	be 00 00 00 00       	mov    $0x0,%esi
+  803ca2:	e9 6a ff ff ff       	jmp    803c11 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803ca7:	68 13 5a 80 00       	push   $0x805a13
+  803cac:	68 66 59 80 00       	push   $0x805966
+  803cb1:	68 3b 01 00 00       	push   $0x13b
+  803cb6:	68 1c 5a 80 00       	push   $0x805a1c
+  803cbb:	e8 be c9 ff ff       	call   80067e <_panic>
+
+00803cc0 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803cc0:	55                   	push   %ebp
+  803cc1:	89 e5                	mov    %esp,%ebp
+  803cc3:	57                   	push   %edi
+  803cc4:	56                   	push   %esi
+  803cc5:	53                   	push   %ebx
+  803cc6:	83 ec 0c             	sub    $0xc,%esp
+  803cc9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803ccc:	8b 75 10             	mov    0x10(%ebp),%esi
+  803ccf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cd5:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.select.req_readset = *readset;
+  803cda:	8b 07                	mov    (%edi),%eax
+  803cdc:	a3 04 a0 84 00       	mov    %eax,0x84a004
+  803ce1:	8b 47 04             	mov    0x4(%edi),%eax
+  803ce4:	a3 08 a0 84 00       	mov    %eax,0x84a008
+  803ce9:	8b 47 08             	mov    0x8(%edi),%eax
+  803cec:	a3 0c a0 84 00       	mov    %eax,0x84a00c
+  803cf1:	8b 47 0c             	mov    0xc(%edi),%eax
+  803cf4:	a3 10 a0 84 00       	mov    %eax,0x84a010
+  803cf9:	8b 47 10             	mov    0x10(%edi),%eax
+  803cfc:	a3 14 a0 84 00       	mov    %eax,0x84a014
+  803d01:	8b 47 14             	mov    0x14(%edi),%eax
+  803d04:	a3 18 a0 84 00       	mov    %eax,0x84a018
+  803d09:	8b 47 18             	mov    0x18(%edi),%eax
+  803d0c:	a3 1c a0 84 00       	mov    %eax,0x84a01c
+  803d11:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803d14:	a3 20 a0 84 00       	mov    %eax,0x84a020
+  803d19:	8b 47 20             	mov    0x20(%edi),%eax
+  803d1c:	a3 24 a0 84 00       	mov    %eax,0x84a024
+  803d21:	8b 47 24             	mov    0x24(%edi),%eax
+  803d24:	a3 28 a0 84 00       	mov    %eax,0x84a028
+  803d29:	8b 47 28             	mov    0x28(%edi),%eax
+  803d2c:	a3 2c a0 84 00       	mov    %eax,0x84a02c
+  803d31:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803d34:	a3 30 a0 84 00       	mov    %eax,0x84a030
+  803d39:	8b 47 30             	mov    0x30(%edi),%eax
+  803d3c:	a3 34 a0 84 00       	mov    %eax,0x84a034
+  803d41:	8b 47 34             	mov    0x34(%edi),%eax
+  803d44:	a3 38 a0 84 00       	mov    %eax,0x84a038
+  803d49:	8b 47 38             	mov    0x38(%edi),%eax
+  803d4c:	a3 3c a0 84 00       	mov    %eax,0x84a03c
+  803d51:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803d54:	a3 40 a0 84 00       	mov    %eax,0x84a040
+	nsipcbuf.select.req_writeset = *writeset;
+  803d59:	8b 06                	mov    (%esi),%eax
+  803d5b:	a3 44 a0 84 00       	mov    %eax,0x84a044
+  803d60:	8b 46 04             	mov    0x4(%esi),%eax
+  803d63:	a3 48 a0 84 00       	mov    %eax,0x84a048
+  803d68:	8b 46 08             	mov    0x8(%esi),%eax
+  803d6b:	a3 4c a0 84 00       	mov    %eax,0x84a04c
+  803d70:	8b 46 0c             	mov    0xc(%esi),%eax
+  803d73:	a3 50 a0 84 00       	mov    %eax,0x84a050
+  803d78:	8b 46 10             	mov    0x10(%esi),%eax
+  803d7b:	a3 54 a0 84 00       	mov    %eax,0x84a054
+  803d80:	8b 46 14             	mov    0x14(%esi),%eax
+  803d83:	a3 58 a0 84 00       	mov    %eax,0x84a058
+  803d88:	8b 46 18             	mov    0x18(%esi),%eax
+  803d8b:	a3 5c a0 84 00       	mov    %eax,0x84a05c
+  803d90:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803d93:	a3 60 a0 84 00       	mov    %eax,0x84a060
+  803d98:	8b 46 20             	mov    0x20(%esi),%eax
+  803d9b:	a3 64 a0 84 00       	mov    %eax,0x84a064
+  803da0:	8b 46 24             	mov    0x24(%esi),%eax
+  803da3:	a3 68 a0 84 00       	mov    %eax,0x84a068
+  803da8:	8b 46 28             	mov    0x28(%esi),%eax
+  803dab:	a3 6c a0 84 00       	mov    %eax,0x84a06c
+  803db0:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803db3:	a3 70 a0 84 00       	mov    %eax,0x84a070
+  803db8:	8b 46 30             	mov    0x30(%esi),%eax
+  803dbb:	a3 74 a0 84 00       	mov    %eax,0x84a074
+  803dc0:	8b 46 34             	mov    0x34(%esi),%eax
+  803dc3:	a3 78 a0 84 00       	mov    %eax,0x84a078
+  803dc8:	8b 46 38             	mov    0x38(%esi),%eax
+  803dcb:	a3 7c a0 84 00       	mov    %eax,0x84a07c
+  803dd0:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803dd3:	a3 80 a0 84 00       	mov    %eax,0x84a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803dd8:	8b 03                	mov    (%ebx),%eax
+  803dda:	a3 84 a0 84 00       	mov    %eax,0x84a084
+  803ddf:	8b 43 04             	mov    0x4(%ebx),%eax
+  803de2:	a3 88 a0 84 00       	mov    %eax,0x84a088
+  803de7:	8b 43 08             	mov    0x8(%ebx),%eax
+  803dea:	a3 8c a0 84 00       	mov    %eax,0x84a08c
+  803def:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803df2:	a3 90 a0 84 00       	mov    %eax,0x84a090
+  803df7:	8b 43 10             	mov    0x10(%ebx),%eax
+  803dfa:	a3 94 a0 84 00       	mov    %eax,0x84a094
+  803dff:	8b 43 14             	mov    0x14(%ebx),%eax
+  803e02:	a3 98 a0 84 00       	mov    %eax,0x84a098
+  803e07:	8b 43 18             	mov    0x18(%ebx),%eax
+  803e0a:	a3 9c a0 84 00       	mov    %eax,0x84a09c
+  803e0f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803e12:	a3 a0 a0 84 00       	mov    %eax,0x84a0a0
+  803e17:	8b 43 20             	mov    0x20(%ebx),%eax
+  803e1a:	a3 a4 a0 84 00       	mov    %eax,0x84a0a4
+  803e1f:	8b 43 24             	mov    0x24(%ebx),%eax
+  803e22:	a3 a8 a0 84 00       	mov    %eax,0x84a0a8
+  803e27:	8b 43 28             	mov    0x28(%ebx),%eax
+  803e2a:	a3 ac a0 84 00       	mov    %eax,0x84a0ac
+  803e2f:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803e32:	a3 b0 a0 84 00       	mov    %eax,0x84a0b0
+  803e37:	8b 43 30             	mov    0x30(%ebx),%eax
+  803e3a:	a3 b4 a0 84 00       	mov    %eax,0x84a0b4
+  803e3f:	8b 43 34             	mov    0x34(%ebx),%eax
+  803e42:	a3 b8 a0 84 00       	mov    %eax,0x84a0b8
+  803e47:	8b 43 38             	mov    0x38(%ebx),%eax
+  803e4a:	a3 bc a0 84 00       	mov    %eax,0x84a0bc
+  803e4f:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803e52:	a3 c0 a0 84 00       	mov    %eax,0x84a0c0
+	nsipcbuf.select.req_timeout = msec;
+  803e57:	8b 45 18             	mov    0x18(%ebp),%eax
+  803e5a:	a3 c4 a0 84 00       	mov    %eax,0x84a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803e5f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803e64:	e8 2b f6 ff ff       	call   803494 <nsipc>
+  803e69:	85 c0                	test   %eax,%eax
+  803e6b:	0f 88 ad 01 00 00    	js     80401e <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803e71:	8b 15 04 a0 84 00    	mov    0x84a004,%edx
+  803e77:	89 17                	mov    %edx,(%edi)
+  803e79:	8b 15 08 a0 84 00    	mov    0x84a008,%edx
+  803e7f:	89 57 04             	mov    %edx,0x4(%edi)
+  803e82:	8b 15 0c a0 84 00    	mov    0x84a00c,%edx
+  803e88:	89 57 08             	mov    %edx,0x8(%edi)
+  803e8b:	8b 15 10 a0 84 00    	mov    0x84a010,%edx
+  803e91:	89 57 0c             	mov    %edx,0xc(%edi)
+  803e94:	8b 15 14 a0 84 00    	mov    0x84a014,%edx
+  803e9a:	89 57 10             	mov    %edx,0x10(%edi)
+  803e9d:	8b 15 18 a0 84 00    	mov    0x84a018,%edx
+  803ea3:	89 57 14             	mov    %edx,0x14(%edi)
+  803ea6:	8b 15 1c a0 84 00    	mov    0x84a01c,%edx
+  803eac:	89 57 18             	mov    %edx,0x18(%edi)
+  803eaf:	8b 15 20 a0 84 00    	mov    0x84a020,%edx
+  803eb5:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803eb8:	8b 15 24 a0 84 00    	mov    0x84a024,%edx
+  803ebe:	89 57 20             	mov    %edx,0x20(%edi)
+  803ec1:	8b 15 28 a0 84 00    	mov    0x84a028,%edx
+  803ec7:	89 57 24             	mov    %edx,0x24(%edi)
+  803eca:	8b 15 2c a0 84 00    	mov    0x84a02c,%edx
+  803ed0:	89 57 28             	mov    %edx,0x28(%edi)
+  803ed3:	8b 15 30 a0 84 00    	mov    0x84a030,%edx
+  803ed9:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803edc:	8b 15 34 a0 84 00    	mov    0x84a034,%edx
+  803ee2:	89 57 30             	mov    %edx,0x30(%edi)
+  803ee5:	8b 15 38 a0 84 00    	mov    0x84a038,%edx
+  803eeb:	89 57 34             	mov    %edx,0x34(%edi)
+  803eee:	8b 15 3c a0 84 00    	mov    0x84a03c,%edx
+  803ef4:	89 57 38             	mov    %edx,0x38(%edi)
+  803ef7:	8b 15 40 a0 84 00    	mov    0x84a040,%edx
+  803efd:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803f00:	8b 15 44 a0 84 00    	mov    0x84a044,%edx
+  803f06:	89 16                	mov    %edx,(%esi)
+  803f08:	8b 15 48 a0 84 00    	mov    0x84a048,%edx
+  803f0e:	89 56 04             	mov    %edx,0x4(%esi)
+  803f11:	8b 15 4c a0 84 00    	mov    0x84a04c,%edx
+  803f17:	89 56 08             	mov    %edx,0x8(%esi)
+  803f1a:	8b 15 50 a0 84 00    	mov    0x84a050,%edx
+  803f20:	89 56 0c             	mov    %edx,0xc(%esi)
+  803f23:	8b 15 54 a0 84 00    	mov    0x84a054,%edx
+  803f29:	89 56 10             	mov    %edx,0x10(%esi)
+  803f2c:	8b 15 58 a0 84 00    	mov    0x84a058,%edx
+  803f32:	89 56 14             	mov    %edx,0x14(%esi)
+  803f35:	8b 15 5c a0 84 00    	mov    0x84a05c,%edx
+  803f3b:	89 56 18             	mov    %edx,0x18(%esi)
+  803f3e:	8b 15 60 a0 84 00    	mov    0x84a060,%edx
+  803f44:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803f47:	8b 15 64 a0 84 00    	mov    0x84a064,%edx
+  803f4d:	89 56 20             	mov    %edx,0x20(%esi)
+  803f50:	8b 15 68 a0 84 00    	mov    0x84a068,%edx
+  803f56:	89 56 24             	mov    %edx,0x24(%esi)
+  803f59:	8b 15 6c a0 84 00    	mov    0x84a06c,%edx
+  803f5f:	89 56 28             	mov    %edx,0x28(%esi)
+  803f62:	8b 15 70 a0 84 00    	mov    0x84a070,%edx
+  803f68:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803f6b:	8b 15 74 a0 84 00    	mov    0x84a074,%edx
+  803f71:	89 56 30             	mov    %edx,0x30(%esi)
+  803f74:	8b 15 78 a0 84 00    	mov    0x84a078,%edx
+  803f7a:	89 56 34             	mov    %edx,0x34(%esi)
+  803f7d:	8b 15 7c a0 84 00    	mov    0x84a07c,%edx
+  803f83:	89 56 38             	mov    %edx,0x38(%esi)
+  803f86:	8b 15 80 a0 84 00    	mov    0x84a080,%edx
+  803f8c:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803f8f:	8b 15 84 a0 84 00    	mov    0x84a084,%edx
+  803f95:	89 13                	mov    %edx,(%ebx)
+  803f97:	8b 15 88 a0 84 00    	mov    0x84a088,%edx
+  803f9d:	89 53 04             	mov    %edx,0x4(%ebx)
+  803fa0:	8b 15 8c a0 84 00    	mov    0x84a08c,%edx
+  803fa6:	89 53 08             	mov    %edx,0x8(%ebx)
+  803fa9:	8b 15 90 a0 84 00    	mov    0x84a090,%edx
+  803faf:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803fb2:	8b 15 94 a0 84 00    	mov    0x84a094,%edx
+  803fb8:	89 53 10             	mov    %edx,0x10(%ebx)
+  803fbb:	8b 15 98 a0 84 00    	mov    0x84a098,%edx
+  803fc1:	89 53 14             	mov    %edx,0x14(%ebx)
+  803fc4:	8b 15 9c a0 84 00    	mov    0x84a09c,%edx
+  803fca:	89 53 18             	mov    %edx,0x18(%ebx)
+  803fcd:	8b 15 a0 a0 84 00    	mov    0x84a0a0,%edx
+  803fd3:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803fd6:	8b 15 a4 a0 84 00    	mov    0x84a0a4,%edx
+  803fdc:	89 53 20             	mov    %edx,0x20(%ebx)
+  803fdf:	8b 15 a8 a0 84 00    	mov    0x84a0a8,%edx
+  803fe5:	89 53 24             	mov    %edx,0x24(%ebx)
+  803fe8:	8b 15 ac a0 84 00    	mov    0x84a0ac,%edx
+  803fee:	89 53 28             	mov    %edx,0x28(%ebx)
+  803ff1:	8b 15 b0 a0 84 00    	mov    0x84a0b0,%edx
+  803ff7:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803ffa:	8b 15 b4 a0 84 00    	mov    0x84a0b4,%edx
+  804000:	89 53 30             	mov    %edx,0x30(%ebx)
+  804003:	8b 15 b8 a0 84 00    	mov    0x84a0b8,%edx
+  804009:	89 53 34             	mov    %edx,0x34(%ebx)
+  80400c:	8b 15 bc a0 84 00    	mov    0x84a0bc,%edx
+  804012:	89 53 38             	mov    %edx,0x38(%ebx)
+  804015:	8b 15 c0 a0 84 00    	mov    0x84a0c0,%edx
+  80401b:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80401e:	83 c4 0c             	add    $0xc,%esp
+  804021:	5b                   	pop    %ebx
+  804022:	5e                   	pop    %esi
+  804023:	5f                   	pop    %edi
+  804024:	5d                   	pop    %ebp
+  804025:	c3                   	ret
+
+00804026 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  804026:	55                   	push   %ebp
+  804027:	89 e5                	mov    %esp,%ebp
+  804029:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80402c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80402f:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.evctl.req_events = events;
+  804034:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804037:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	nsipcbuf.evctl.req_data = data;
+  80403c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80403f:	a3 08 a0 84 00       	mov    %eax,0x84a008
+	return nsipc(NSREQ_EVCTL);
+  804044:	b8 0f 00 00 00       	mov    $0xf,%eax
+  804049:	e8 46 f4 ff ff       	call   803494 <nsipc>
+}
+  80404e:	c9                   	leave
+  80404f:	c3                   	ret
+
+00804050 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  804050:	55                   	push   %ebp
+  804051:	89 e5                	mov    %esp,%ebp
+  804053:	56                   	push   %esi
+  804054:	53                   	push   %ebx
+  804055:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  804058:	89 35 00 a0 84 00    	mov    %esi,0x84a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80405e:	8b 45 10             	mov    0x10(%ebp),%eax
+  804061:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  804066:	b8 10 00 00 00       	mov    $0x10,%eax
+  80406b:	e8 24 f4 ff ff       	call   803494 <nsipc>
+  804070:	89 c3                	mov    %eax,%ebx
+  804072:	85 c0                	test   %eax,%eax
+  804074:	7e 1f                	jle    804095 <nsipc_evwait+0x45>
+		assert(r <= max);
+  804076:	39 c6                	cmp    %eax,%esi
+  804078:	7c 24                	jl     80409e <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  80407a:	83 ec 04             	sub    $0x4,%esp
+  80407d:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  804084:	50                   	push   %eax
+  804085:	68 00 a0 84 00       	push   $0x84a000
+  80408a:	ff 75 08             	push   0x8(%ebp)
+  80408d:	e8 6e cf ff ff       	call   801000 <memmove>
+  804092:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  804095:	89 d8                	mov    %ebx,%eax
+  804097:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80409a:	5b                   	pop    %ebx
+  80409b:	5e                   	pop    %esi
+  80409c:	5d                   	pop    %ebp
+  80409d:	c3                   	ret
+		assert(r <= max);
+  80409e:	68 34 5a 80 00       	push   $0x805a34
+  8040a3:	68 66 59 80 00       	push   $0x805966
+  8040a8:	68 6a 01 00 00       	push   $0x16a
+  8040ad:	68 1c 5a 80 00       	push   $0x805a1c
+  8040b2:	e8 c7 c5 ff ff       	call   80067e <_panic>
+
+008040b7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8040b7:	55                   	push   %ebp
+  8040b8:	89 e5                	mov    %esp,%ebp
+  8040ba:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8040bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040c0:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.socket.req_type = type;
+  8040c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8040c8:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	nsipcbuf.socket.req_protocol = protocol;
+  8040cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8040d0:	a3 08 a0 84 00       	mov    %eax,0x84a008
+	return nsipc(NSREQ_SOCKET);
+  8040d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8040da:	e8 b5 f3 ff ff       	call   803494 <nsipc>
+}
+  8040df:	c9                   	leave
+  8040e0:	c3                   	ret
+
+008040e1 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8040e1:	55                   	push   %ebp
+  8040e2:	89 e5                	mov    %esp,%ebp
+  8040e4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8040e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040ea:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	return nsipc(NSREQ_OFFLOAD);
+  8040ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8040f4:	e8 9b f3 ff ff       	call   803494 <nsipc>
+}
+  8040f9:	c9                   	leave
+  8040fa:	c3                   	ret
+
+008040fb <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8040fb:	55                   	push   %ebp
+  8040fc:	89 e5                	mov    %esp,%ebp
+  8040fe:	53                   	push   %ebx
+  8040ff:	83 ec 04             	sub    $0x4,%esp
+  804102:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  804105:	b8 12 00 00 00       	mov    $0x12,%eax
+  80410a:	e8 85 f3 ff ff       	call   803494 <nsipc>
+  80410f:	85 c0                	test   %eax,%eax
+  804111:	78 50                	js     804163 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  804113:	8b 15 00 a0 84 00    	mov    0x84a000,%edx
+  804119:	89 13                	mov    %edx,(%ebx)
+  80411b:	8b 15 04 a0 84 00    	mov    0x84a004,%edx
+  804121:	89 53 04             	mov    %edx,0x4(%ebx)
+  804124:	8b 15 08 a0 84 00    	mov    0x84a008,%edx
+  80412a:	89 53 08             	mov    %edx,0x8(%ebx)
+  80412d:	8b 15 0c a0 84 00    	mov    0x84a00c,%edx
+  804133:	89 53 0c             	mov    %edx,0xc(%ebx)
+  804136:	8b 15 10 a0 84 00    	mov    0x84a010,%edx
+  80413c:	89 53 10             	mov    %edx,0x10(%ebx)
+  80413f:	8b 15 14 a0 84 00    	mov    0x84a014,%edx
+  804145:	89 53 14             	mov    %edx,0x14(%ebx)
+  804148:	8b 15 18 a0 84 00    	mov    0x84a018,%edx
+  80414e:	89 53 18             	mov    %edx,0x18(%ebx)
+  804151:	8b 15 1c a0 84 00    	mov    0x84a01c,%edx
+  804157:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80415a:	8b 15 20 a0 84 00    	mov    0x84a020,%edx
+  804160:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  804163:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804166:	c9                   	leave
+  804167:	c3                   	ret
+
+00804168 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  804168:	55                   	push   %ebp
+  804169:	89 e5                	mov    %esp,%ebp
+  80416b:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80416e:	6a 03                	push   $0x3
+  804170:	e8 08 0f 00 00       	call   80507d <ipc_find_env>
+  804175:	a3 24 80 84 00       	mov    %eax,0x848024
+	nsipcbuf.shard.req_shard = shard;
+  80417a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80417d:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  804182:	b8 0b 00 00 00       	mov    $0xb,%eax
+  804187:	e8 08 f3 ff ff       	call   803494 <nsipc>
+  80418c:	83 c4 10             	add    $0x10,%esp
+  80418f:	85 c0                	test   %eax,%eax
+  804191:	78 0a                	js     80419d <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  804193:	a3 24 80 84 00       	mov    %eax,0x848024
+	return 0;
+  804198:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80419d:	c9                   	leave
+  80419e:	c3                   	ret
+
+0080419f <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80419f:	55                   	push   %ebp
+  8041a0:	89 e5                	mov    %esp,%ebp
+  8041a2:	57                   	push   %edi
+  8041a3:	56                   	push   %esi
+  8041a4:	53                   	push   %ebx
+  8041a5:	83 ec 1c             	sub    $0x1c,%esp
+  8041a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8041ab:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8041ae:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8041b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041b8:	89 e0                	mov    %esp,%eax
+  8041ba:	89 f2                	mov    %esi,%edx
+  8041bc:	29 c2                	sub    %eax,%edx
+  8041be:	89 d0                	mov    %edx,%eax
+  8041c0:	c1 e8 0f             	shr    $0xf,%eax
+  8041c3:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8041c9:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8041cc:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  8041d3:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8041d6:	83 ec 0c             	sub    $0xc,%esp
+  8041d9:	ff 75 e0             	push   -0x20(%ebp)
+  8041dc:	e8 db 0e 00 00       	call   8050bc <pageref>
+  8041e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8041e4:	83 c4 04             	add    $0x4,%esp
+  8041e7:	ff 75 dc             	push   -0x24(%ebp)
+  8041ea:	e8 cd 0e 00 00       	call   8050bc <pageref>
+  8041ef:	89 e2                	mov    %esp,%edx
+  8041f1:	89 f1                	mov    %esi,%ecx
+  8041f3:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8041f5:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8041f8:	89 ca                	mov    %ecx,%edx
+  8041fa:	c1 ea 0f             	shr    $0xf,%edx
+  8041fd:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  804203:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  804206:	8b 14 95 40 80 84 00 	mov    0x848040(,%edx,4),%edx
+  80420d:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  804210:	39 d7                	cmp    %edx,%edi
+  804212:	74 40                	je     804254 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  804214:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804217:	75 9f                	jne    8041b8 <_pipeisclosed+0x19>
+  804219:	89 e2                	mov    %esp,%edx
+  80421b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804220:	29 d0                	sub    %edx,%eax
+  804222:	89 c2                	mov    %eax,%edx
+  804224:	c1 ea 0f             	shr    $0xf,%edx
+  804227:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80422c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804231:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804234:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  80423b:	8b 40 58             	mov    0x58(%eax),%eax
+  80423e:	6a 01                	push   $0x1
+  804240:	50                   	push   %eax
+  804241:	57                   	push   %edi
+  804242:	68 3d 5a 80 00       	push   $0x805a3d
+  804247:	e8 0d c5 ff ff       	call   800759 <cprintf>
+  80424c:	83 c4 10             	add    $0x10,%esp
+  80424f:	e9 5f ff ff ff       	jmp    8041b3 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  804254:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804257:	0f 94 c0             	sete   %al
+  80425a:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80425d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804260:	5b                   	pop    %ebx
+  804261:	5e                   	pop    %esi
+  804262:	5f                   	pop    %edi
+  804263:	5d                   	pop    %ebp
+  804264:	c3                   	ret
+
+00804265 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  804265:	55                   	push   %ebp
+  804266:	89 e5                	mov    %esp,%ebp
+  804268:	53                   	push   %ebx
+  804269:	83 ec 0c             	sub    $0xc,%esp
+  80426c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80426f:	53                   	push   %ebx
+  804270:	6a 00                	push   $0x0
+  804272:	e8 92 d0 ff ff       	call   801309 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  804277:	89 1c 24             	mov    %ebx,(%esp)
+  80427a:	e8 f4 db ff ff       	call   801e73 <fd2data>
+  80427f:	83 c4 08             	add    $0x8,%esp
+  804282:	50                   	push   %eax
+  804283:	6a 00                	push   $0x0
+  804285:	e8 7f d0 ff ff       	call   801309 <sys_page_unmap>
+}
+  80428a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80428d:	c9                   	leave
+  80428e:	c3                   	ret
+
+0080428f <devpipe_read>:
+{
+  80428f:	55                   	push   %ebp
+  804290:	89 e5                	mov    %esp,%ebp
+  804292:	57                   	push   %edi
+  804293:	56                   	push   %esi
+  804294:	53                   	push   %ebx
+  804295:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  804298:	ff 75 08             	push   0x8(%ebp)
+  80429b:	e8 d3 db ff ff       	call   801e73 <fd2data>
+  8042a0:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8042a2:	8b 70 04             	mov    0x4(%eax),%esi
+  8042a5:	8b 00                	mov    (%eax),%eax
+  8042a7:	83 c4 10             	add    $0x10,%esp
+  8042aa:	39 f0                	cmp    %esi,%eax
+  8042ac:	75 36                	jne    8042e4 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8042ae:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8042b1:	89 da                	mov    %ebx,%edx
+  8042b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042b6:	e8 e4 fe ff ff       	call   80419f <_pipeisclosed>
+  8042bb:	85 c0                	test   %eax,%eax
+  8042bd:	0f 85 d4 00 00 00    	jne    804397 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8042c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042c8:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8042cc:	83 ec 04             	sub    $0x4,%esp
+  8042cf:	6a ff                	push   $0xffffffff
+  8042d1:	56                   	push   %esi
+  8042d2:	57                   	push   %edi
+  8042d3:	e8 aa d3 ff ff       	call   801682 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8042d8:	8b 73 04             	mov    0x4(%ebx),%esi
+  8042db:	8b 03                	mov    (%ebx),%eax
+  8042dd:	83 c4 10             	add    $0x10,%esp
+  8042e0:	39 c6                	cmp    %eax,%esi
+  8042e2:	74 cd                	je     8042b1 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8042e4:	8b 73 04             	mov    0x4(%ebx),%esi
+  8042e7:	8b 03                	mov    (%ebx),%eax
+  8042e9:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8042ef:	29 c6                	sub    %eax,%esi
+  8042f1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8042f6:	f7 e6                	mul    %esi
+  8042f8:	c1 ea 0c             	shr    $0xc,%edx
+  8042fb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804301:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  804303:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804306:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80430a:	8b 0b                	mov    (%ebx),%ecx
+  80430c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804311:	f7 e1                	mul    %ecx
+  804313:	c1 ea 0b             	shr    $0xb,%edx
+  804316:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80431c:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80431e:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  804323:	29 cf                	sub    %ecx,%edi
+  804325:	39 f7                	cmp    %esi,%edi
+  804327:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80432a:	83 ec 04             	sub    $0x4,%esp
+  80432d:	57                   	push   %edi
+  80432e:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  804332:	50                   	push   %eax
+  804333:	ff 75 0c             	push   0xc(%ebp)
+  804336:	e8 c5 cc ff ff       	call   801000 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  80433b:	83 c4 0c             	add    $0xc,%esp
+  80433e:	89 f0                	mov    %esi,%eax
+  804340:	29 f8                	sub    %edi,%eax
+  804342:	50                   	push   %eax
+  804343:	8d 43 10             	lea    0x10(%ebx),%eax
+  804346:	50                   	push   %eax
+  804347:	89 f8                	mov    %edi,%eax
+  804349:	03 45 0c             	add    0xc(%ebp),%eax
+  80434c:	50                   	push   %eax
+  80434d:	e8 ae cc ff ff       	call   801000 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  804352:	8b 0b                	mov    (%ebx),%ecx
+  804354:	01 f1                	add    %esi,%ecx
+  804356:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80435b:	f7 e1                	mul    %ecx
+  80435d:	c1 ea 0c             	shr    $0xc,%edx
+  804360:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  804366:	29 c1                	sub    %eax,%ecx
+  804368:	89 0b                	mov    %ecx,(%ebx)
+  80436a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80436f:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  804373:	83 c4 10             	add    $0x10,%esp
+  804376:	85 c0                	test   %eax,%eax
+  804378:	75 0a                	jne    804384 <devpipe_read+0xf5>
+	return n;
+  80437a:	89 f0                	mov    %esi,%eax
+}
+  80437c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80437f:	5b                   	pop    %ebx
+  804380:	5e                   	pop    %esi
+  804381:	5f                   	pop    %edi
+  804382:	5d                   	pop    %ebp
+  804383:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  804384:	83 ec 08             	sub    $0x8,%esp
+  804387:	68 00 04 00 00       	push   $0x400
+  80438c:	53                   	push   %ebx
+  80438d:	e8 12 d3 ff ff       	call   8016a4 <sys_futex_wake>
+  804392:	83 c4 10             	add    $0x10,%esp
+  804395:	eb e3                	jmp    80437a <devpipe_read+0xeb>
+			return 0;
+  804397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439c:	eb de                	jmp    80437c <devpipe_read+0xed>
+
+0080439e <devpipe_write>:
+{
+  80439e:	55                   	push   %ebp
+  80439f:	89 e5                	mov    %esp,%ebp
+  8043a1:	57                   	push   %edi
+  8043a2:	56                   	push   %esi
+  8043a3:	53                   	push   %ebx
+  8043a4:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8043a7:	ff 75 08             	push   0x8(%ebp)
+  8043aa:	e8 c4 da ff ff       	call   801e73 <fd2data>
+  8043af:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8043b1:	83 c4 10             	add    $0x10,%esp
+  8043b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8043bb:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8043c0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8043c4:	0f 84 43 01 00 00    	je     80450d <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8043ca:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8043cd:	8b 06                	mov    (%esi),%eax
+  8043cf:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8043d5:	29 c1                	sub    %eax,%ecx
+  8043d7:	89 c8                	mov    %ecx,%eax
+  8043d9:	f7 e7                	mul    %edi
+  8043db:	c1 ea 0c             	shr    $0xc,%edx
+  8043de:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8043e4:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8043e6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8043ec:	75 52                	jne    804440 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8043ee:	89 f2                	mov    %esi,%edx
+  8043f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043f3:	e8 a7 fd ff ff       	call   80419f <_pipeisclosed>
+  8043f8:	85 c0                	test   %eax,%eax
+  8043fa:	0f 85 28 01 00 00    	jne    804528 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  804400:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804402:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804405:	8b 06                	mov    (%esi),%eax
+  804407:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80440d:	29 c1                	sub    %eax,%ecx
+  80440f:	89 c8                	mov    %ecx,%eax
+  804411:	f7 e7                	mul    %edi
+  804413:	c1 ea 0c             	shr    $0xc,%edx
+  804416:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80441c:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80441e:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804424:	75 a4                	jne    8043ca <devpipe_write+0x2c>
+  804426:	b8 01 00 00 00       	mov    $0x1,%eax
+  80442b:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80442f:	83 ec 04             	sub    $0x4,%esp
+  804432:	6a ff                	push   $0xffffffff
+  804434:	53                   	push   %ebx
+  804435:	56                   	push   %esi
+  804436:	e8 47 d2 ff ff       	call   801682 <sys_futex_wait>
+}
+  80443b:	83 c4 10             	add    $0x10,%esp
+  80443e:	eb 8a                	jmp    8043ca <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804440:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804443:	8b 06                	mov    (%esi),%eax
+  804445:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80444b:	29 c1                	sub    %eax,%ecx
+  80444d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804452:	f7 e1                	mul    %ecx
+  804454:	c1 ea 0c             	shr    $0xc,%edx
+  804457:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80445d:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80445f:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  804464:	89 d8                	mov    %ebx,%eax
+  804466:	29 c8                	sub    %ecx,%eax
+  804468:	8b 55 10             	mov    0x10(%ebp),%edx
+  80446b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80446e:	29 ca                	sub    %ecx,%edx
+  804470:	39 d0                	cmp    %edx,%eax
+  804472:	0f 46 d0             	cmovbe %eax,%edx
+  804475:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  804478:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80447b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804480:	f7 e1                	mul    %ecx
+  804482:	c1 ea 0b             	shr    $0xb,%edx
+  804485:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80448b:	89 ca                	mov    %ecx,%edx
+  80448d:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80448f:	29 d3                	sub    %edx,%ebx
+  804491:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804494:	39 c3                	cmp    %eax,%ebx
+  804496:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  804499:	83 ec 04             	sub    $0x4,%esp
+  80449c:	53                   	push   %ebx
+  80449d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8044a0:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8044a3:	51                   	push   %ecx
+  8044a4:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8044a8:	50                   	push   %eax
+  8044a9:	e8 52 cb ff ff       	call   801000 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8044ae:	83 c4 0c             	add    $0xc,%esp
+  8044b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044b4:	29 d8                	sub    %ebx,%eax
+  8044b6:	50                   	push   %eax
+  8044b7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8044ba:	01 cb                	add    %ecx,%ebx
+  8044bc:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8044bf:	53                   	push   %ebx
+  8044c0:	8d 46 10             	lea    0x10(%esi),%eax
+  8044c3:	50                   	push   %eax
+  8044c4:	e8 37 cb ff ff       	call   801000 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8044c9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8044cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044cf:	01 c1                	add    %eax,%ecx
+  8044d1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8044d6:	f7 e1                	mul    %ecx
+  8044d8:	c1 ea 0c             	shr    $0xc,%edx
+  8044db:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8044e1:	89 ca                	mov    %ecx,%edx
+  8044e3:	29 c2                	sub    %eax,%edx
+  8044e5:	89 56 04             	mov    %edx,0x4(%esi)
+  8044e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ed:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8044f1:	83 c4 10             	add    $0x10,%esp
+  8044f4:	85 c0                	test   %eax,%eax
+  8044f6:	75 1a                	jne    804512 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8044f8:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8044fb:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8044fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804501:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804504:	0f 82 c0 fe ff ff    	jb     8043ca <devpipe_write+0x2c>
+  80450a:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80450d:	8b 45 10             	mov    0x10(%ebp),%eax
+  804510:	eb 1b                	jmp    80452d <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  804512:	83 ec 08             	sub    $0x8,%esp
+  804515:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  80451a:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80451d:	50                   	push   %eax
+  80451e:	e8 81 d1 ff ff       	call   8016a4 <sys_futex_wake>
+  804523:	83 c4 10             	add    $0x10,%esp
+  804526:	eb d0                	jmp    8044f8 <devpipe_write+0x15a>
+				return 0;
+  804528:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80452d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804530:	5b                   	pop    %ebx
+  804531:	5e                   	pop    %esi
+  804532:	5f                   	pop    %edi
+  804533:	5d                   	pop    %ebp
+  804534:	c3                   	ret
+
+00804535 <devpipe_stat>:
+{
+  804535:	55                   	push   %ebp
+  804536:	89 e5                	mov    %esp,%ebp
+  804538:	56                   	push   %esi
+  804539:	53                   	push   %ebx
+  80453a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80453d:	83 ec 0c             	sub    $0xc,%esp
+  804540:	ff 75 08             	push   0x8(%ebp)
+  804543:	e8 2b d9 ff ff       	call   801e73 <fd2data>
+  804548:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80454a:	83 c4 08             	add    $0x8,%esp
+  80454d:	68 50 5a 80 00       	push   $0x805a50
+  804552:	53                   	push   %ebx
+  804553:	e8 f8 c8 ff ff       	call   800e50 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804558:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80455b:	8b 06                	mov    (%esi),%eax
+  80455d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804563:	29 c1                	sub    %eax,%ecx
+  804565:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80456a:	89 c8                	mov    %ecx,%eax
+  80456c:	f7 e2                	mul    %edx
+  80456e:	c1 ea 0c             	shr    $0xc,%edx
+  804571:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804577:	29 d1                	sub    %edx,%ecx
+  804579:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80457f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804586:	00 00 00 
+	stat->st_dev = &devpipe;
+  804589:	c7 83 8c 00 00 00 60 	movl   $0x846060,0x8c(%ebx)
+  804590:	60 84 00 
+}
+  804593:	b8 00 00 00 00       	mov    $0x0,%eax
+  804598:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80459b:	5b                   	pop    %ebx
+  80459c:	5e                   	pop    %esi
+  80459d:	5d                   	pop    %ebp
+  80459e:	c3                   	ret
+
+0080459f <devpipe_poll>:
+{
+  80459f:	55                   	push   %ebp
+  8045a0:	89 e5                	mov    %esp,%ebp
+  8045a2:	57                   	push   %edi
+  8045a3:	56                   	push   %esi
+  8045a4:	53                   	push   %ebx
+  8045a5:	83 ec 18             	sub    $0x18,%esp
+  8045a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8045ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8045ae:	57                   	push   %edi
+  8045af:	e8 bf d8 ff ff       	call   801e73 <fd2data>
+  8045b4:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8045b6:	83 c4 10             	add    $0x10,%esp
+  8045b9:	89 f3                	mov    %esi,%ebx
+  8045bb:	83 e3 01             	and    $0x1,%ebx
+  8045be:	75 27                	jne    8045e7 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8045c0:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8045c6:	75 48                	jne    804610 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8045c8:	89 ca                	mov    %ecx,%edx
+  8045ca:	89 f8                	mov    %edi,%eax
+  8045cc:	e8 ce fb ff ff       	call   80419f <_pipeisclosed>
+  8045d1:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8045d3:	89 d8                	mov    %ebx,%eax
+  8045d5:	83 c8 10             	or     $0x10,%eax
+  8045d8:	85 d2                	test   %edx,%edx
+  8045da:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8045dd:	89 d8                	mov    %ebx,%eax
+  8045df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045e2:	5b                   	pop    %ebx
+  8045e3:	5e                   	pop    %esi
+  8045e4:	5f                   	pop    %edi
+  8045e5:	5d                   	pop    %ebp
+  8045e6:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8045e7:	8b 58 04             	mov    0x4(%eax),%ebx
+  8045ea:	8b 00                	mov    (%eax),%eax
+  8045ec:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8045f2:	29 c3                	sub    %eax,%ebx
+  8045f4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8045f9:	89 d8                	mov    %ebx,%eax
+  8045fb:	f7 e2                	mul    %edx
+  8045fd:	c1 ea 0c             	shr    $0xc,%edx
+  804600:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  804606:	39 d3                	cmp    %edx,%ebx
+  804608:	0f 95 c3             	setne  %bl
+  80460b:	0f b6 db             	movzbl %bl,%ebx
+  80460e:	eb b0                	jmp    8045c0 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804610:	8b 71 04             	mov    0x4(%ecx),%esi
+  804613:	8b 01                	mov    (%ecx),%eax
+  804615:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80461b:	29 c6                	sub    %eax,%esi
+  80461d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804622:	89 f0                	mov    %esi,%eax
+  804624:	f7 e2                	mul    %edx
+  804626:	c1 ea 0c             	shr    $0xc,%edx
+  804629:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80462f:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  804631:	89 d8                	mov    %ebx,%eax
+  804633:	83 c8 04             	or     $0x4,%eax
+  804636:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80463c:	0f 42 d8             	cmovb  %eax,%ebx
+  80463f:	eb 87                	jmp    8045c8 <devpipe_poll+0x29>
+
+00804641 <pipe>:
+{
+  804641:	55                   	push   %ebp
+  804642:	89 e5                	mov    %esp,%ebp
+  804644:	56                   	push   %esi
+  804645:	53                   	push   %ebx
+  804646:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804649:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80464c:	50                   	push   %eax
+  80464d:	e8 38 d8 ff ff       	call   801e8a <fd_alloc>
+  804652:	89 c3                	mov    %eax,%ebx
+  804654:	83 c4 10             	add    $0x10,%esp
+  804657:	85 c0                	test   %eax,%eax
+  804659:	0f 88 23 01 00 00    	js     804782 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80465f:	83 ec 04             	sub    $0x4,%esp
+  804662:	68 07 04 00 00       	push   $0x407
+  804667:	ff 75 f4             	push   -0xc(%ebp)
+  80466a:	6a 00                	push   $0x0
+  80466c:	e8 13 cc ff ff       	call   801284 <sys_page_alloc>
+  804671:	89 c3                	mov    %eax,%ebx
+  804673:	83 c4 10             	add    $0x10,%esp
+  804676:	85 c0                	test   %eax,%eax
+  804678:	0f 88 04 01 00 00    	js     804782 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80467e:	83 ec 0c             	sub    $0xc,%esp
+  804681:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804684:	50                   	push   %eax
+  804685:	e8 00 d8 ff ff       	call   801e8a <fd_alloc>
+  80468a:	89 c3                	mov    %eax,%ebx
+  80468c:	83 c4 10             	add    $0x10,%esp
+  80468f:	85 c0                	test   %eax,%eax
+  804691:	0f 88 db 00 00 00    	js     804772 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804697:	83 ec 04             	sub    $0x4,%esp
+  80469a:	68 07 04 00 00       	push   $0x407
+  80469f:	ff 75 f0             	push   -0x10(%ebp)
+  8046a2:	6a 00                	push   $0x0
+  8046a4:	e8 db cb ff ff       	call   801284 <sys_page_alloc>
+  8046a9:	89 c3                	mov    %eax,%ebx
+  8046ab:	83 c4 10             	add    $0x10,%esp
+  8046ae:	85 c0                	test   %eax,%eax
+  8046b0:	0f 88 bc 00 00 00    	js     804772 <pipe+0x131>
+	va = fd2data(fd0);
+  8046b6:	83 ec 0c             	sub    $0xc,%esp
+  8046b9:	ff 75 f4             	push   -0xc(%ebp)
+  8046bc:	e8 b2 d7 ff ff       	call   801e73 <fd2data>
+  8046c1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8046c3:	83 c4 0c             	add    $0xc,%esp
+  8046c6:	68 07 04 00 00       	push   $0x407
+  8046cb:	50                   	push   %eax
+  8046cc:	6a 00                	push   $0x0
+  8046ce:	e8 b1 cb ff ff       	call   801284 <sys_page_alloc>
+  8046d3:	89 c3                	mov    %eax,%ebx
+  8046d5:	83 c4 10             	add    $0x10,%esp
+  8046d8:	85 c0                	test   %eax,%eax
+  8046da:	0f 88 82 00 00 00    	js     804762 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8046e0:	83 ec 0c             	sub    $0xc,%esp
+  8046e3:	ff 75 f0             	push   -0x10(%ebp)
+  8046e6:	e8 88 d7 ff ff       	call   801e73 <fd2data>
+  8046eb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8046f2:	50                   	push   %eax
+  8046f3:	6a 00                	push   $0x0
+  8046f5:	56                   	push   %esi
+  8046f6:	6a 00                	push   $0x0
+  8046f8:	e8 ca cb ff ff       	call   8012c7 <sys_page_map>
+  8046fd:	89 c3                	mov    %eax,%ebx
+  8046ff:	83 c4 20             	add    $0x20,%esp
+  804702:	85 c0                	test   %eax,%eax
+  804704:	78 4e                	js     804754 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  804706:	a1 60 60 84 00       	mov    0x846060,%eax
+  80470b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80470e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804710:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804713:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80471a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80471d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80471f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804722:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804729:	83 ec 0c             	sub    $0xc,%esp
+  80472c:	ff 75 f4             	push   -0xc(%ebp)
+  80472f:	e8 2f d7 ff ff       	call   801e63 <fd2num>
+  804734:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804737:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804739:	83 c4 04             	add    $0x4,%esp
+  80473c:	ff 75 f0             	push   -0x10(%ebp)
+  80473f:	e8 1f d7 ff ff       	call   801e63 <fd2num>
+  804744:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804747:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80474a:	83 c4 10             	add    $0x10,%esp
+  80474d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804752:	eb 2e                	jmp    804782 <pipe+0x141>
+	sys_page_unmap(0, va);
+  804754:	83 ec 08             	sub    $0x8,%esp
+  804757:	56                   	push   %esi
+  804758:	6a 00                	push   $0x0
+  80475a:	e8 aa cb ff ff       	call   801309 <sys_page_unmap>
+  80475f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  804762:	83 ec 08             	sub    $0x8,%esp
+  804765:	ff 75 f0             	push   -0x10(%ebp)
+  804768:	6a 00                	push   $0x0
+  80476a:	e8 9a cb ff ff       	call   801309 <sys_page_unmap>
+  80476f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  804772:	83 ec 08             	sub    $0x8,%esp
+  804775:	ff 75 f4             	push   -0xc(%ebp)
+  804778:	6a 00                	push   $0x0
+  80477a:	e8 8a cb ff ff       	call   801309 <sys_page_unmap>
+  80477f:	83 c4 10             	add    $0x10,%esp
+}
+  804782:	89 d8                	mov    %ebx,%eax
+  804784:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804787:	5b                   	pop    %ebx
+  804788:	5e                   	pop    %esi
+  804789:	5d                   	pop    %ebp
+  80478a:	c3                   	ret
+
+0080478b <pipeisclosed>:
+{
+  80478b:	55                   	push   %ebp
+  80478c:	89 e5                	mov    %esp,%ebp
+  80478e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804791:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804794:	50                   	push   %eax
+  804795:	ff 75 08             	push   0x8(%ebp)
+  804798:	e8 3d d7 ff ff       	call   801eda <fd_lookup>
+  80479d:	83 c4 10             	add    $0x10,%esp
+  8047a0:	85 c0                	test   %eax,%eax
+  8047a2:	78 18                	js     8047bc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8047a4:	83 ec 0c             	sub    $0xc,%esp
+  8047a7:	ff 75 f4             	push   -0xc(%ebp)
+  8047aa:	e8 c4 d6 ff ff       	call   801e73 <fd2data>
+  8047af:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8047b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047b4:	e8 e6 f9 ff ff       	call   80419f <_pipeisclosed>
+  8047b9:	83 c4 10             	add    $0x10,%esp
+}
+  8047bc:	c9                   	leave
+  8047bd:	c3                   	ret
+
+008047be <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8047be:	55                   	push   %ebp
+  8047bf:	89 e5                	mov    %esp,%ebp
+  8047c1:	56                   	push   %esi
+  8047c2:	53                   	push   %ebx
+  8047c3:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8047c6:	85 f6                	test   %esi,%esi
+  8047c8:	74 40                	je     80480a <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  8047ca:	89 f3                	mov    %esi,%ebx
+  8047cc:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8047d2:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  8047d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047dd:	8b 40 48             	mov    0x48(%eax),%eax
+  8047e0:	39 c6                	cmp    %eax,%esi
+  8047e2:	75 1f                	jne    804803 <wait+0x45>
+  8047e4:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  8047ea:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8047f0:	8b 43 54             	mov    0x54(%ebx),%eax
+  8047f3:	85 c0                	test   %eax,%eax
+  8047f5:	74 0c                	je     804803 <wait+0x45>
+		sys_yield();
+  8047f7:	e8 69 ca ff ff       	call   801265 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8047fc:	8b 43 48             	mov    0x48(%ebx),%eax
+  8047ff:	39 f0                	cmp    %esi,%eax
+  804801:	74 ed                	je     8047f0 <wait+0x32>
+}
+  804803:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804806:	5b                   	pop    %ebx
+  804807:	5e                   	pop    %esi
+  804808:	5d                   	pop    %ebp
+  804809:	c3                   	ret
+	assert(envid != 0);
+  80480a:	68 5c 5a 80 00       	push   $0x805a5c
+  80480f:	68 66 59 80 00       	push   $0x805966
+  804814:	6a 09                	push   $0x9
+  804816:	68 67 5a 80 00       	push   $0x805a67
+  80481b:	e8 5e be ff ff       	call   80067e <_panic>
+
+00804820 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  804820:	55                   	push   %ebp
+  804821:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  804823:	8b 45 08             	mov    0x8(%ebp),%eax
+  804826:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80482c:	5d                   	pop    %ebp
+  80482d:	c3                   	ret
+
+0080482e <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80482e:	55                   	push   %ebp
+  80482f:	89 e5                	mov    %esp,%ebp
+  804831:	53                   	push   %ebx
+  804832:	83 ec 04             	sub    $0x4,%esp
+  804835:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  804838:	8b 03                	mov    (%ebx),%eax
+  80483a:	85 c0                	test   %eax,%eax
+  80483c:	75 05                	jne    804843 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80483e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804841:	c9                   	leave
+  804842:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  804843:	83 ec 08             	sub    $0x8,%esp
+  804846:	50                   	push   %eax
+  804847:	8d 43 04             	lea    0x4(%ebx),%eax
+  80484a:	50                   	push   %eax
+  80484b:	e8 09 cd ff ff       	call   801559 <sys_page_batch>
+	pb->pb_n = 0;
+  804850:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  804856:	83 c4 10             	add    $0x10,%esp
+  804859:	eb e3                	jmp    80483e <pgbatch_flush+0x10>
+
+0080485b <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80485b:	55                   	push   %ebp
+  80485c:	89 e5                	mov    %esp,%ebp
+  80485e:	56                   	push   %esi
+  80485f:	53                   	push   %ebx
+  804860:	89 c3                	mov    %eax,%ebx
+  804862:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  804864:	83 38 20             	cmpl   $0x20,(%eax)
+  804867:	74 2c                	je     804895 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  804869:	8b 03                	mov    (%ebx),%eax
+  80486b:	8d 50 01             	lea    0x1(%eax),%edx
+  80486e:	89 13                	mov    %edx,(%ebx)
+  804870:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  804873:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  804877:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  804879:	83 ec 04             	sub    $0x4,%esp
+  80487c:	6a 18                	push   $0x18
+  80487e:	6a 00                	push   $0x0
+  804880:	50                   	push   %eax
+  804881:	e8 45 c7 ff ff       	call   800fcb <memset>
+	return 0;
+  804886:	83 c4 10             	add    $0x10,%esp
+  804889:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80488e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804891:	5b                   	pop    %ebx
+  804892:	5e                   	pop    %esi
+  804893:	5d                   	pop    %ebp
+  804894:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  804895:	83 ec 0c             	sub    $0xc,%esp
+  804898:	50                   	push   %eax
+  804899:	e8 90 ff ff ff       	call   80482e <pgbatch_flush>
+  80489e:	83 c4 10             	add    $0x10,%esp
+  8048a1:	85 c0                	test   %eax,%eax
+  8048a3:	79 c4                	jns    804869 <pgbatch_slot+0xe>
+  8048a5:	eb e7                	jmp    80488e <pgbatch_slot+0x33>
+
+008048a7 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8048a7:	55                   	push   %ebp
+  8048a8:	89 e5                	mov    %esp,%ebp
+  8048aa:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8048ad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8048b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048b3:	e8 a3 ff ff ff       	call   80485b <pgbatch_slot>
+  8048b8:	85 c0                	test   %eax,%eax
+  8048ba:	78 20                	js     8048dc <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8048bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8048bf:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8048c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8048c8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8048cb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8048ce:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8048d1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8048d4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8048d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048dc:	c9                   	leave
+  8048dd:	c3                   	ret
+
+008048de <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8048de:	55                   	push   %ebp
+  8048df:	89 e5                	mov    %esp,%ebp
+  8048e1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8048e4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8048e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048ea:	e8 6c ff ff ff       	call   80485b <pgbatch_slot>
+  8048ef:	85 c0                	test   %eax,%eax
+  8048f1:	78 2c                	js     80491f <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8048f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8048f6:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8048fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8048ff:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  804902:	8b 55 10             	mov    0x10(%ebp),%edx
+  804905:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  804908:	8b 55 14             	mov    0x14(%ebp),%edx
+  80490b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80490e:	8b 55 18             	mov    0x18(%ebp),%edx
+  804911:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804914:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  804917:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80491a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80491f:	c9                   	leave
+  804920:	c3                   	ret
+
+00804921 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  804921:	55                   	push   %ebp
+  804922:	89 e5                	mov    %esp,%ebp
+  804924:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804927:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80492a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80492d:	e8 29 ff ff ff       	call   80485b <pgbatch_slot>
+  804932:	85 c0                	test   %eax,%eax
+  804934:	78 1a                	js     804950 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  804936:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804939:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80493f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804942:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804945:	8b 55 10             	mov    0x10(%ebp),%edx
+  804948:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80494b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804950:	c9                   	leave
+  804951:	c3                   	ret
+
+00804952 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  804952:	55                   	push   %ebp
+  804953:	89 e5                	mov    %esp,%ebp
+  804955:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804958:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80495b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80495e:	e8 f8 fe ff ff       	call   80485b <pgbatch_slot>
+  804963:	85 c0                	test   %eax,%eax
+  804965:	78 20                	js     804987 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  804967:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80496a:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  804970:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804973:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804976:	8b 55 10             	mov    0x10(%ebp),%edx
+  804979:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80497c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80497f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804982:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804987:	c9                   	leave
+  804988:	c3                   	ret
+
+00804989 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  804989:	55                   	push   %ebp
+  80498a:	89 e5                	mov    %esp,%ebp
+  80498c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80498f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804992:	8b 45 08             	mov    0x8(%ebp),%eax
+  804995:	e8 c1 fe ff ff       	call   80485b <pgbatch_slot>
+  80499a:	85 c0                	test   %eax,%eax
+  80499c:	78 26                	js     8049c4 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80499e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8049a1:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8049a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8049aa:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8049ad:	8b 55 10             	mov    0x10(%ebp),%edx
+  8049b0:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8049b3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8049b6:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8049b9:	8b 55 18             	mov    0x18(%ebp),%edx
+  8049bc:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8049bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049c4:	c9                   	leave
+  8049c5:	c3                   	ret
+
+008049c6 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  8049c6:	55                   	push   %ebp
+  8049c7:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8049c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8049cc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8049d2:	5d                   	pop    %ebp
+  8049d3:	c3                   	ret
+
+008049d4 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  8049d4:	55                   	push   %ebp
+  8049d5:	89 e5                	mov    %esp,%ebp
+  8049d7:	56                   	push   %esi
+  8049d8:	53                   	push   %ebx
+  8049d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  8049dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8049e6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8049ea:	85 c0                	test   %eax,%eax
+  8049ec:	74 2f                	je     804a1d <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  8049ee:	83 f8 02             	cmp    $0x2,%eax
+  8049f1:	74 0c                	je     8049ff <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  8049f3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8049f8:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  8049fb:	85 c0                	test   %eax,%eax
+  8049fd:	74 1e                	je     804a1d <mutex_lock+0x49>
+  8049ff:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  804a04:	83 ec 04             	sub    $0x4,%esp
+  804a07:	6a ff                	push   $0xffffffff
+  804a09:	6a 02                	push   $0x2
+  804a0b:	53                   	push   %ebx
+  804a0c:	e8 71 cc ff ff       	call   801682 <sys_futex_wait>
+  804a11:	89 f0                	mov    %esi,%eax
+  804a13:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  804a16:	83 c4 10             	add    $0x10,%esp
+  804a19:	85 c0                	test   %eax,%eax
+  804a1b:	75 e7                	jne    804a04 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804a1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804a20:	5b                   	pop    %ebx
+  804a21:	5e                   	pop    %esi
+  804a22:	5d                   	pop    %ebp
+  804a23:	c3                   	ret
+
+00804a24 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  804a24:	55                   	push   %ebp
+  804a25:	89 e5                	mov    %esp,%ebp
+  804a27:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a2f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804a34:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  804a38:	85 c0                	test   %eax,%eax
+  804a3a:	0f 94 c0             	sete   %al
+  804a3d:	0f b6 c0             	movzbl %al,%eax
+}
+  804a40:	5d                   	pop    %ebp
+  804a41:	c3                   	ret
+
+00804a42 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804a42:	55                   	push   %ebp
+  804a43:	89 e5                	mov    %esp,%ebp
+  804a45:	83 ec 08             	sub    $0x8,%esp
+  804a48:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  804a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a50:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  804a53:	83 f8 02             	cmp    $0x2,%eax
+  804a56:	74 02                	je     804a5a <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804a58:	c9                   	leave
+  804a59:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804a5a:	83 ec 08             	sub    $0x8,%esp
+  804a5d:	6a 01                	push   $0x1
+  804a5f:	52                   	push   %edx
+  804a60:	e8 3f cc ff ff       	call   8016a4 <sys_futex_wake>
+  804a65:	83 c4 10             	add    $0x10,%esp
+}
+  804a68:	eb ee                	jmp    804a58 <mutex_unlock+0x16>
+
+00804a6a <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  804a6a:	55                   	push   %ebp
+  804a6b:	89 e5                	mov    %esp,%ebp
+  804a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  804a70:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  804a76:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804a7d:	5d                   	pop    %ebp
+  804a7e:	c3                   	ret
+
+00804a7f <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  804a7f:	55                   	push   %ebp
+  804a80:	89 e5                	mov    %esp,%ebp
+  804a82:	57                   	push   %edi
+  804a83:	56                   	push   %esi
+  804a84:	53                   	push   %ebx
+  804a85:	83 ec 18             	sub    $0x18,%esp
+  804a88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804a8b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  804a8e:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  804a90:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a95:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804a9a:	57                   	push   %edi
+  804a9b:	e8 a2 ff ff ff       	call   804a42 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804aa0:	83 c4 0c             	add    $0xc,%esp
+  804aa3:	ff 75 10             	push   0x10(%ebp)
+  804aa6:	56                   	push   %esi
+  804aa7:	53                   	push   %ebx
+  804aa8:	e8 d5 cb ff ff       	call   801682 <sys_futex_wait>
+  804aad:	89 c6                	mov    %eax,%esi
+  804aaf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804ab4:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804ab9:	89 3c 24             	mov    %edi,(%esp)
+  804abc:	e8 13 ff ff ff       	call   8049d4 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804ac1:	83 c4 10             	add    $0x10,%esp
+  804ac4:	83 fe ef             	cmp    $0xffffffef,%esi
+  804ac7:	74 05                	je     804ace <cond_timedwait+0x4f>
+  804ac9:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804ace:	89 f0                	mov    %esi,%eax
+  804ad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ad3:	5b                   	pop    %ebx
+  804ad4:	5e                   	pop    %esi
+  804ad5:	5f                   	pop    %edi
+  804ad6:	5d                   	pop    %ebp
+  804ad7:	c3                   	ret
+
+00804ad8 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804ad8:	55                   	push   %ebp
+  804ad9:	89 e5                	mov    %esp,%ebp
+  804adb:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804ade:	6a ff                	push   $0xffffffff
+  804ae0:	ff 75 0c             	push   0xc(%ebp)
+  804ae3:	ff 75 08             	push   0x8(%ebp)
+  804ae6:	e8 94 ff ff ff       	call   804a7f <cond_timedwait>
+}
+  804aeb:	83 c4 10             	add    $0x10,%esp
+  804aee:	c9                   	leave
+  804aef:	c3                   	ret
+
+00804af0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804af0:	55                   	push   %ebp
+  804af1:	89 e5                	mov    %esp,%ebp
+  804af3:	83 ec 08             	sub    $0x8,%esp
+  804af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  804af9:	ba 01 00 00 00       	mov    $0x1,%edx
+  804afe:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804b02:	8b 50 04             	mov    0x4(%eax),%edx
+  804b05:	85 d2                	test   %edx,%edx
+  804b07:	75 02                	jne    804b0b <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  804b09:	c9                   	leave
+  804b0a:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804b0b:	83 ec 08             	sub    $0x8,%esp
+  804b0e:	6a 01                	push   $0x1
+  804b10:	50                   	push   %eax
+  804b11:	e8 8e cb ff ff       	call   8016a4 <sys_futex_wake>
+  804b16:	83 c4 10             	add    $0x10,%esp
+}
+  804b19:	eb ee                	jmp    804b09 <cond_signal+0x19>
+
+00804b1b <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804b1b:	55                   	push   %ebp
+  804b1c:	89 e5                	mov    %esp,%ebp
+  804b1e:	83 ec 08             	sub    $0x8,%esp
+  804b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b24:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b29:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804b2d:	8b 50 04             	mov    0x4(%eax),%edx
+  804b30:	85 d2                	test   %edx,%edx
+  804b32:	75 02                	jne    804b36 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  804b34:	c9                   	leave
+  804b35:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  804b36:	83 ec 08             	sub    $0x8,%esp
+  804b39:	68 00 04 00 00       	push   $0x400
+  804b3e:	50                   	push   %eax
+  804b3f:	e8 60 cb ff ff       	call   8016a4 <sys_futex_wake>
+  804b44:	83 c4 10             	add    $0x10,%esp
+}
+  804b47:	eb eb                	jmp    804b34 <cond_broadcast+0x19>
+
+00804b49 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b4e:	c3                   	ret
+
+00804b4f <devcons_poll>:
+{
+  804b4f:	55                   	push   %ebp
+  804b50:	89 e5                	mov    %esp,%ebp
+  804b52:	53                   	push   %ebx
+  804b53:	83 ec 04             	sub    $0x4,%esp
+  804b56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804b59:	89 da                	mov    %ebx,%edx
+  804b5b:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804b5e:	83 3d 34 80 84 00 00 	cmpl   $0x0,0x848034
+  804b65:	74 0c                	je     804b73 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804b67:	89 d8                	mov    %ebx,%eax
+  804b69:	83 e0 01             	and    $0x1,%eax
+  804b6c:	09 d0                	or     %edx,%eax
+}
+  804b6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804b71:	c9                   	leave
+  804b72:	c3                   	ret
+		cons_peek = sys_cgetc();
+  804b73:	e8 6e c6 ff ff       	call   8011e6 <sys_cgetc>
+  804b78:	a3 34 80 84 00       	mov    %eax,0x848034
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804b7d:	89 da                	mov    %ebx,%edx
+  804b7f:	83 e2 04             	and    $0x4,%edx
+  804b82:	85 c0                	test   %eax,%eax
+  804b84:	74 e6                	je     804b6c <devcons_poll+0x1d>
+  804b86:	eb df                	jmp    804b67 <devcons_poll+0x18>
+
+00804b88 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804b88:	55                   	push   %ebp
+  804b89:	89 e5                	mov    %esp,%ebp
+  804b8b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804b8e:	68 72 5a 80 00       	push   $0x805a72
+  804b93:	ff 75 0c             	push   0xc(%ebp)
+  804b96:	e8 b5 c2 ff ff       	call   800e50 <strcpy>
+	return 0;
+}
+  804b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba0:	c9                   	leave
+  804ba1:	c3                   	ret
+
+00804ba2 <devcons_write>:
+{
+  804ba2:	55                   	push   %ebp
+  804ba3:	89 e5                	mov    %esp,%ebp
+  804ba5:	57                   	push   %edi
+  804ba6:	56                   	push   %esi
+  804ba7:	53                   	push   %ebx
+  804ba8:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804bae:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804bb1:	85 ff                	test   %edi,%edi
+  804bb3:	74 51                	je     804c06 <devcons_write+0x64>
+  804bb5:	be 00 00 00 00       	mov    $0x0,%esi
+  804bba:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804bbf:	89 fb                	mov    %edi,%ebx
+  804bc1:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  804bc3:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804bc8:	39 d3                	cmp    %edx,%ebx
+  804bca:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804bcd:	83 ec 04             	sub    $0x4,%esp
+  804bd0:	53                   	push   %ebx
+  804bd1:	03 45 0c             	add    0xc(%ebp),%eax
+  804bd4:	50                   	push   %eax
+  804bd5:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804bdb:	50                   	push   %eax
+  804bdc:	e8 1f c4 ff ff       	call   801000 <memmove>
+		sys_cputs(buf, m);
+  804be1:	83 c4 08             	add    $0x8,%esp
+  804be4:	53                   	push   %ebx
+  804be5:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804beb:	50                   	push   %eax
+  804bec:	e8 d7 c5 ff ff       	call   8011c8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804bf1:	01 de                	add    %ebx,%esi
+  804bf3:	89 f0                	mov    %esi,%eax
+  804bf5:	83 c4 10             	add    $0x10,%esp
+  804bf8:	39 fe                	cmp    %edi,%esi
+  804bfa:	72 c3                	jb     804bbf <devcons_write+0x1d>
+}
+  804bfc:	89 f0                	mov    %esi,%eax
+  804bfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c01:	5b                   	pop    %ebx
+  804c02:	5e                   	pop    %esi
+  804c03:	5f                   	pop    %edi
+  804c04:	5d                   	pop    %ebp
+  804c05:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  804c06:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804c0b:	eb ef                	jmp    804bfc <devcons_write+0x5a>
+
+00804c0d <devcons_read>:
+{
+  804c0d:	55                   	push   %ebp
+  804c0e:	89 e5                	mov    %esp,%ebp
+  804c10:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  804c13:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  804c18:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804c1c:	74 36                	je     804c54 <devcons_read+0x47>
+	c = cons_peek;
+  804c1e:	a1 34 80 84 00       	mov    0x848034,%eax
+	cons_peek = 0;
+  804c23:	c7 05 34 80 84 00 00 	movl   $0x0,0x848034
+  804c2a:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804c2d:	85 c0                	test   %eax,%eax
+  804c2f:	75 10                	jne    804c41 <devcons_read+0x34>
+  804c31:	e8 b0 c5 ff ff       	call   8011e6 <sys_cgetc>
+  804c36:	85 c0                	test   %eax,%eax
+  804c38:	75 07                	jne    804c41 <devcons_read+0x34>
+		sys_yield();
+  804c3a:	e8 26 c6 ff ff       	call   801265 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804c3f:	eb f0                	jmp    804c31 <devcons_read+0x24>
+	if (c < 0)
+  804c41:	85 c0                	test   %eax,%eax
+  804c43:	78 0f                	js     804c54 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  804c45:	83 f8 04             	cmp    $0x4,%eax
+  804c48:	74 0c                	je     804c56 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  804c4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804c4d:	88 02                	mov    %al,(%edx)
+	return 1;
+  804c4f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804c54:	c9                   	leave
+  804c55:	c3                   	ret
+		return 0;
+  804c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c5b:	eb f7                	jmp    804c54 <devcons_read+0x47>
+
+00804c5d <cputchar>:
+{
+  804c5d:	55                   	push   %ebp
+  804c5e:	89 e5                	mov    %esp,%ebp
+  804c60:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804c63:	8b 45 08             	mov    0x8(%ebp),%eax
+  804c66:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804c69:	6a 01                	push   $0x1
+  804c6b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804c6e:	50                   	push   %eax
+  804c6f:	e8 54 c5 ff ff       	call   8011c8 <sys_cputs>
+}
+  804c74:	83 c4 10             	add    $0x10,%esp
+  804c77:	c9                   	leave
+  804c78:	c3                   	ret
+
+00804c79 <getchar>:
+{
+  804c79:	55                   	push   %ebp
+  804c7a:	89 e5                	mov    %esp,%ebp
+  804c7c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804c7f:	6a 01                	push   $0x1
+  804c81:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804c84:	50                   	push   %eax
+  804c85:	6a 00                	push   $0x0
+  804c87:	e8 d2 d4 ff ff       	call   80215e <read>
+	if (r < 0)
+  804c8c:	83 c4 10             	add    $0x10,%esp
+  804c8f:	85 c0                	test   %eax,%eax
+  804c91:	78 06                	js     804c99 <getchar+0x20>
+	if (r < 1)
+  804c93:	74 06                	je     804c9b <getchar+0x22>
+	return c;
+  804c95:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804c99:	c9                   	leave
+  804c9a:	c3                   	ret
+		return -E_EOF;
+  804c9b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804ca0:	eb f7                	jmp    804c99 <getchar+0x20>
+
+00804ca2 <iscons>:
+{
+  804ca2:	55                   	push   %ebp
+  804ca3:	89 e5                	mov    %esp,%ebp
+  804ca5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ca8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804cab:	50                   	push   %eax
+  804cac:	ff 75 08             	push   0x8(%ebp)
+  804caf:	e8 26 d2 ff ff       	call   801eda <fd_lookup>
+  804cb4:	83 c4 10             	add    $0x10,%esp
+  804cb7:	85 c0                	test   %eax,%eax
+  804cb9:	78 11                	js     804ccc <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804cbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804cbe:	8b 15 80 60 84 00    	mov    0x846080,%edx
+  804cc4:	39 10                	cmp    %edx,(%eax)
+  804cc6:	0f 94 c0             	sete   %al
+  804cc9:	0f b6 c0             	movzbl %al,%eax
+}
+  804ccc:	c9                   	leave
+  804ccd:	c3                   	ret
+
+00804cce <opencons>:
+{
+  804cce:	55                   	push   %ebp
+  804ccf:	89 e5                	mov    %esp,%ebp
+  804cd1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804cd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804cd7:	50                   	push   %eax
+  804cd8:	e8 ad d1 ff ff       	call   801e8a <fd_alloc>
+  804cdd:	83 c4 10             	add    $0x10,%esp
+  804ce0:	85 c0                	test   %eax,%eax
+  804ce2:	78 3a                	js     804d1e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804ce4:	83 ec 04             	sub    $0x4,%esp
+  804ce7:	68 07 04 00 00       	push   $0x407
+  804cec:	ff 75 f4             	push   -0xc(%ebp)
+  804cef:	6a 00                	push   $0x0
+  804cf1:	e8 8e c5 ff ff       	call   801284 <sys_page_alloc>
+  804cf6:	83 c4 10             	add    $0x10,%esp
+  804cf9:	85 c0                	test   %eax,%eax
+  804cfb:	78 21                	js     804d1e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804cfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d00:	8b 15 80 60 84 00    	mov    0x846080,%edx
+  804d06:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804d08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d0b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804d12:	83 ec 0c             	sub    $0xc,%esp
+  804d15:	50                   	push   %eax
+  804d16:	e8 48 d1 ff ff       	call   801e63 <fd2num>
+  804d1b:	83 c4 10             	add    $0x10,%esp
+}
+  804d1e:	c9                   	leave
+  804d1f:	c3                   	ret
+
+00804d20 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804d20:	55                   	push   %ebp
+  804d21:	89 e5                	mov    %esp,%ebp
+  804d23:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804d26:	83 3d 00 b0 84 00 00 	cmpl   $0x0,0x84b000
+  804d2d:	74 0a                	je     804d39 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d32:	a3 00 b0 84 00       	mov    %eax,0x84b000
+}
+  804d37:	c9                   	leave
+  804d38:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804d39:	83 ec 04             	sub    $0x4,%esp
+  804d3c:	6a 07                	push   $0x7
+  804d3e:	68 00 f0 bf ee       	push   $0xeebff000
+  804d43:	6a 00                	push   $0x0
+  804d45:	e8 3a c5 ff ff       	call   801284 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804d4a:	83 c4 08             	add    $0x8,%esp
+  804d4d:	68 5e 4d 80 00       	push   $0x804d5e
+  804d52:	6a 00                	push   $0x0
+  804d54:	e8 76 c6 ff ff       	call   8013cf <sys_env_set_pgfault_upcall>
+  804d59:	83 c4 10             	add    $0x10,%esp
+  804d5c:	eb d1                	jmp    804d2f <set_pgfault_handler+0xf>
+
+00804d5e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804d5e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804d5f:	a1 00 b0 84 00       	mov    0x84b000,%eax
+	call *%eax
+  804d64:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804d66:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804d69:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804d6d:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804d70:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804d74:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804d76:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804d7a:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804d7d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804d7e:	83 c4 04             	add    $0x4,%esp
+	popf
+  804d81:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804d82:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804d83:	c3                   	ret
+
+00804d84 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804d84:	55                   	push   %ebp
+  804d85:	89 e5                	mov    %esp,%ebp
+  804d87:	56                   	push   %esi
+  804d88:	53                   	push   %ebx
+  804d89:	8b 75 08             	mov    0x8(%ebp),%esi
+  804d8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804d8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804d92:	85 c0                	test   %eax,%eax
+  804d94:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804d99:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804d9c:	83 ec 0c             	sub    $0xc,%esp
+  804d9f:	50                   	push   %eax
+  804da0:	e8 8f c6 ff ff       	call   801434 <sys_ipc_recv>
+  804da5:	83 c4 10             	add    $0x10,%esp
+  804da8:	85 c0                	test   %eax,%eax
+  804daa:	0f 88 8b 00 00 00    	js     804e3b <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804db0:	85 f6                	test   %esi,%esi
+  804db2:	74 2a                	je     804dde <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804db4:	89 e2                	mov    %esp,%edx
+  804db6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804dbb:	29 d0                	sub    %edx,%eax
+  804dbd:	89 c2                	mov    %eax,%edx
+  804dbf:	c1 ea 0f             	shr    $0xf,%edx
+  804dc2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcc:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804dcf:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804dd6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804ddc:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804dde:	85 db                	test   %ebx,%ebx
+  804de0:	74 2a                	je     804e0c <ipc_recv+0x88>
+  804de2:	89 e2                	mov    %esp,%edx
+  804de4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804de9:	29 d0                	sub    %edx,%eax
+  804deb:	89 c2                	mov    %eax,%edx
+  804ded:	c1 ea 0f             	shr    $0xf,%edx
+  804df0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfa:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804dfd:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804e04:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804e0a:	89 03                	mov    %eax,(%ebx)
+  804e0c:	89 e2                	mov    %esp,%edx
+  804e0e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804e13:	29 d0                	sub    %edx,%eax
+  804e15:	89 c2                	mov    %eax,%edx
+  804e17:	c1 ea 0f             	shr    $0xf,%edx
+  804e1a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e24:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804e27:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804e2e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804e34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e37:	5b                   	pop    %ebx
+  804e38:	5e                   	pop    %esi
+  804e39:	5d                   	pop    %ebp
+  804e3a:	c3                   	ret
+		if(from_env_store != NULL)
+  804e3b:	85 f6                	test   %esi,%esi
+  804e3d:	74 06                	je     804e45 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804e3f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804e45:	85 db                	test   %ebx,%ebx
+  804e47:	74 eb                	je     804e34 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804e49:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804e4f:	eb e3                	jmp    804e34 <ipc_recv+0xb0>
+
+00804e51 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804e51:	55                   	push   %ebp
+  804e52:	89 e5                	mov    %esp,%ebp
+  804e54:	57                   	push   %edi
+  804e55:	56                   	push   %esi
+  804e56:	53                   	push   %ebx
+  804e57:	83 ec 14             	sub    $0x14,%esp
+  804e5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804e5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804e60:	8b 75 14             	mov    0x14(%ebp),%esi
+  804e63:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804e66:	85 c0                	test   %eax,%eax
+  804e68:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804e6d:	0f 44 c2             	cmove  %edx,%eax
+  804e70:	ff 75 10             	push   0x10(%ebp)
+  804e73:	50                   	push   %eax
+  804e74:	e8 1d c6 ff ff       	call   801496 <sys_ipc_recv_pages>
+  804e79:	83 c4 10             	add    $0x10,%esp
+  804e7c:	85 c0                	test   %eax,%eax
+  804e7e:	0f 88 ba 00 00 00    	js     804f3e <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804e84:	85 ff                	test   %edi,%edi
+  804e86:	74 2a                	je     804eb2 <ipc_recv_pages+0x61>
+  804e88:	89 e2                	mov    %esp,%edx
+  804e8a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804e8f:	29 d0                	sub    %edx,%eax
+  804e91:	89 c2                	mov    %eax,%edx
+  804e93:	c1 ea 0f             	shr    $0xf,%edx
+  804e96:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ea0:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804ea3:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804eaa:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804eb0:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804eb2:	85 f6                	test   %esi,%esi
+  804eb4:	74 2a                	je     804ee0 <ipc_recv_pages+0x8f>
+  804eb6:	89 e2                	mov    %esp,%edx
+  804eb8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804ebd:	29 d0                	sub    %edx,%eax
+  804ebf:	89 c2                	mov    %eax,%edx
+  804ec1:	c1 ea 0f             	shr    $0xf,%edx
+  804ec4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ece:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804ed1:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804ed8:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804ede:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804ee0:	85 db                	test   %ebx,%ebx
+  804ee2:	74 2a                	je     804f0e <ipc_recv_pages+0xbd>
+  804ee4:	89 e2                	mov    %esp,%edx
+  804ee6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804eeb:	29 d0                	sub    %edx,%eax
+  804eed:	89 c2                	mov    %eax,%edx
+  804eef:	c1 ea 0f             	shr    $0xf,%edx
+  804ef2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804efc:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804eff:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804f06:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804f0c:	89 03                	mov    %eax,(%ebx)
+  804f0e:	89 e2                	mov    %esp,%edx
+  804f10:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804f15:	29 d0                	sub    %edx,%eax
+  804f17:	89 c2                	mov    %eax,%edx
+  804f19:	c1 ea 0f             	shr    $0xf,%edx
+  804f1c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f26:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804f29:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804f30:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f39:	5b                   	pop    %ebx
+  804f3a:	5e                   	pop    %esi
+  804f3b:	5f                   	pop    %edi
+  804f3c:	5d                   	pop    %ebp
+  804f3d:	c3                   	ret
+		if (from_env_store)
+  804f3e:	85 ff                	test   %edi,%edi
+  804f40:	74 06                	je     804f48 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804f42:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804f48:	85 f6                	test   %esi,%esi
+  804f4a:	74 06                	je     804f52 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804f4c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804f52:	85 db                	test   %ebx,%ebx
+  804f54:	74 e0                	je     804f36 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804f56:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804f5c:	eb d8                	jmp    804f36 <ipc_recv_pages+0xe5>
+
+00804f5e <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804f5e:	55                   	push   %ebp
+  804f5f:	89 e5                	mov    %esp,%ebp
+  804f61:	57                   	push   %edi
+  804f62:	56                   	push   %esi
+  804f63:	53                   	push   %ebx
+  804f64:	83 ec 1c             	sub    $0x1c,%esp
+  804f67:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804f6a:	8b 75 08             	mov    0x8(%ebp),%esi
+  804f6d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804f73:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804f77:	75 2b                	jne    804fa4 <ipc_try_send_pages+0x46>
+  804f79:	89 e2                	mov    %esp,%edx
+  804f7b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804f80:	29 d0                	sub    %edx,%eax
+  804f82:	89 c2                	mov    %eax,%edx
+  804f84:	c1 ea 0f             	shr    $0xf,%edx
+  804f87:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f91:	0f 42 c2             	cmovb  %edx,%eax
+  804f94:	8b 04 85 40 80 84 00 	mov    0x848040(,%eax,4),%eax
+  804f9b:	8b 70 48             	mov    0x48(%eax),%esi
+  804f9e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804fa4:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804faa:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804faf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804fb2:	85 ff                	test   %edi,%edi
+  804fb4:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804fb9:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804fbc:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804fc2:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804fc8:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804fce:	83 ec 0c             	sub    $0xc,%esp
+  804fd1:	ff 75 14             	push   0x14(%ebp)
+  804fd4:	ff 75 18             	push   0x18(%ebp)
+  804fd7:	57                   	push   %edi
+  804fd8:	ff 75 0c             	push   0xc(%ebp)
+  804fdb:	ff 75 08             	push   0x8(%ebp)
+  804fde:	e8 92 c4 ff ff       	call   801475 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804fe3:	83 c4 20             	add    $0x20,%esp
+  804fe6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804fe9:	75 21                	jne    80500c <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804feb:	83 ec 04             	sub    $0x4,%esp
+  804fee:	6a ff                	push   $0xffffffff
+  804ff0:	53                   	push   %ebx
+  804ff1:	ff 75 e4             	push   -0x1c(%ebp)
+  804ff4:	e8 89 c6 ff ff       	call   801682 <sys_futex_wait>
+  804ff9:	83 c4 10             	add    $0x10,%esp
+  804ffc:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804fff:	74 c7                	je     804fc8 <ipc_try_send_pages+0x6a>
+  805001:	85 c0                	test   %eax,%eax
+  805003:	79 c3                	jns    804fc8 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  805005:	e8 5b c2 ff ff       	call   801265 <sys_yield>
+  80500a:	eb bc                	jmp    804fc8 <ipc_try_send_pages+0x6a>
+	}
+}
+  80500c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80500f:	5b                   	pop    %ebx
+  805010:	5e                   	pop    %esi
+  805011:	5f                   	pop    %edi
+  805012:	5d                   	pop    %ebp
+  805013:	c3                   	ret
+
+00805014 <ipc_send>:
+{
+  805014:	55                   	push   %ebp
+  805015:	89 e5                	mov    %esp,%ebp
+  805017:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80501a:	ff 75 14             	push   0x14(%ebp)
+  80501d:	6a 01                	push   $0x1
+  80501f:	ff 75 10             	push   0x10(%ebp)
+  805022:	ff 75 0c             	push   0xc(%ebp)
+  805025:	ff 75 08             	push   0x8(%ebp)
+  805028:	e8 31 ff ff ff       	call   804f5e <ipc_try_send_pages>
+  80502d:	83 c4 20             	add    $0x20,%esp
+  805030:	85 c0                	test   %eax,%eax
+  805032:	78 02                	js     805036 <ipc_send+0x22>
+}
+  805034:	c9                   	leave
+  805035:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  805036:	50                   	push   %eax
+  805037:	68 7e 5a 80 00       	push   $0x805a7e
+  80503c:	6a 3f                	push   $0x3f
+  80503e:	68 93 5a 80 00       	push   $0x805a93
+  805043:	e8 36 b6 ff ff       	call   80067e <_panic>
+
+00805048 <ipc_send_pages>:
+{
+  805048:	55                   	push   %ebp
+  805049:	89 e5                	mov    %esp,%ebp
+  80504b:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80504e:	ff 75 18             	push   0x18(%ebp)
+  805051:	ff 75 14             	push   0x14(%ebp)
+  805054:	ff 75 10             	push   0x10(%ebp)
+  805057:	ff 75 0c             	push   0xc(%ebp)
+  80505a:	ff 75 08             	push   0x8(%ebp)
+  80505d:	e8 fc fe ff ff       	call   804f5e <ipc_try_send_pages>
+  805062:	83 c4 20             	add    $0x20,%esp
+  805065:	85 c0                	test   %eax,%eax
+  805067:	78 02                	js     80506b <ipc_send_pages+0x23>
+}
+  805069:	c9                   	leave
+  80506a:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80506b:	50                   	push   %eax
+  80506c:	68 9d 5a 80 00       	push   $0x805a9d
+  805071:	6a 64                	push   $0x64
+  805073:	68 93 5a 80 00       	push   $0x805a93
+  805078:	e8 01 b6 ff ff       	call   80067e <_panic>
+
+0080507d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80507d:	55                   	push   %ebp
+  80507e:	89 e5                	mov    %esp,%ebp
+  805080:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805083:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  805088:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80508e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  805094:	8b 52 50             	mov    0x50(%edx),%edx
+  805097:	39 ca                	cmp    %ecx,%edx
+  805099:	74 11                	je     8050ac <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80509b:	83 c0 01             	add    $0x1,%eax
+  80509e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8050a3:	75 e3                	jne    805088 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8050a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050aa:	eb 0e                	jmp    8050ba <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8050ac:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8050b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8050b7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8050ba:	5d                   	pop    %ebp
+  8050bb:	c3                   	ret
+
+008050bc <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8050bc:	55                   	push   %ebp
+  8050bd:	89 e5                	mov    %esp,%ebp
+  8050bf:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8050c2:	89 c2                	mov    %eax,%edx
+  8050c4:	c1 ea 16             	shr    $0x16,%edx
+  8050c7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8050ce:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8050d3:	f6 c1 01             	test   $0x1,%cl
+  8050d6:	74 1e                	je     8050f6 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8050d8:	c1 e8 0c             	shr    $0xc,%eax
+  8050db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8050e2:	a8 01                	test   $0x1,%al
+  8050e4:	74 10                	je     8050f6 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8050e6:	c1 e8 0c             	shr    $0xc,%eax
+  8050e9:	c1 e0 04             	shl    $0x4,%eax
+  8050ec:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8050f3:	0f b7 d2             	movzwl %dx,%edx
+}
+  8050f6:	89 d0                	mov    %edx,%eax
+  8050f8:	5d                   	pop    %ebp
+  8050f9:	c3                   	ret
+
+008050fa <__udivdi3>:
+  8050fa:	57                   	push   %edi
+  8050fb:	56                   	push   %esi
+  8050fc:	53                   	push   %ebx
+  8050fd:	83 ec 20             	sub    $0x20,%esp
+  805100:	8b 44 24 30          	mov    0x30(%esp),%eax
+  805104:	8b 54 24 34          	mov    0x34(%esp),%edx
+  805108:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80510c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805110:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805114:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805118:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80511c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805120:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80512a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80512f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805136:	00 
+  805137:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80513e:	00 
+  80513f:	eb 08                	jmp    805149 <__udivdi3+0x4f>
+  805141:	83 e9 01             	sub    $0x1,%ecx
+  805144:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805147:	74 68                	je     8051b1 <__udivdi3+0xb7>
+  805149:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80514d:	01 c0                	add    %eax,%eax
+  80514f:	89 c6                	mov    %eax,%esi
+  805151:	89 d7                	mov    %edx,%edi
+  805153:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805157:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80515b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80515e:	d3 ea                	shr    %cl,%edx
+  805160:	f6 c1 20             	test   $0x20,%cl
+  805163:	74 04                	je     805169 <__udivdi3+0x6f>
+  805165:	89 d0                	mov    %edx,%eax
+  805167:	31 d2                	xor    %edx,%edx
+  805169:	83 e0 01             	and    $0x1,%eax
+  80516c:	89 04 24             	mov    %eax,(%esp)
+  80516f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805176:	00 
+  805177:	8b 04 24             	mov    (%esp),%eax
+  80517a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80517e:	09 f0                	or     %esi,%eax
+  805180:	09 fa                	or     %edi,%edx
+  805182:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805186:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80518a:	39 f0                	cmp    %esi,%eax
+  80518c:	89 d3                	mov    %edx,%ebx
+  80518e:	19 fb                	sbb    %edi,%ebx
+  805190:	72 af                	jb     805141 <__udivdi3+0x47>
+  805192:	29 f0                	sub    %esi,%eax
+  805194:	19 fa                	sbb    %edi,%edx
+  805196:	89 cf                	mov    %ecx,%edi
+  805198:	c1 ef 05             	shr    $0x5,%edi
+  80519b:	83 e7 01             	and    $0x1,%edi
+  80519e:	89 fe                	mov    %edi,%esi
+  8051a0:	83 f6 01             	xor    $0x1,%esi
+  8051a3:	d3 e6                	shl    %cl,%esi
+  8051a5:	d3 e7                	shl    %cl,%edi
+  8051a7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8051ab:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8051af:	eb 90                	jmp    805141 <__udivdi3+0x47>
+  8051b1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051b5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051b9:	83 c4 20             	add    $0x20,%esp
+  8051bc:	5b                   	pop    %ebx
+  8051bd:	5e                   	pop    %esi
+  8051be:	5f                   	pop    %edi
+  8051bf:	c3                   	ret
+
+008051c0 <__umoddi3>:
+  8051c0:	57                   	push   %edi
+  8051c1:	56                   	push   %esi
+  8051c2:	53                   	push   %ebx
+  8051c3:	83 ec 08             	sub    $0x8,%esp
+  8051c6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051ca:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051ce:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8051d2:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8051d6:	57                   	push   %edi
+  8051d7:	56                   	push   %esi
+  8051d8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8051dc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8051e0:	52                   	push   %edx
+  8051e1:	50                   	push   %eax
+  8051e2:	e8 13 ff ff ff       	call   8050fa <__udivdi3>
+  8051e7:	89 c3                	mov    %eax,%ebx
+  8051e9:	0f af d6             	imul   %esi,%edx
+  8051ec:	89 f9                	mov    %edi,%ecx
+  8051ee:	0f af cb             	imul   %ebx,%ecx
+  8051f1:	01 d1                	add    %edx,%ecx
+  8051f3:	89 d8                	mov    %ebx,%eax
+  8051f5:	f7 e6                	mul    %esi
+  8051f7:	89 c6                	mov    %eax,%esi
+  8051f9:	89 d7                	mov    %edx,%edi
+  8051fb:	01 cf                	add    %ecx,%edi
+  8051fd:	8b 44 24 10          	mov    0x10(%esp),%eax
+  805201:	8b 54 24 14          	mov    0x14(%esp),%edx
+  805205:	29 f0                	sub    %esi,%eax
+  805207:	19 fa                	sbb    %edi,%edx
+  805209:	83 c4 18             	add    $0x18,%esp
+  80520c:	5b                   	pop    %ebx
+  80520d:	5e                   	pop    %esi
+  80520e:	5f                   	pop    %edi
+  80520f:	c3                   	ret
+
+00805210 <__divdi3>:
+  805210:	53                   	push   %ebx
+  805211:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805215:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805219:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80521d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  805221:	85 d2                	test   %edx,%edx
+  805223:	78 12                	js     805237 <__divdi3+0x27>
+  805225:	85 db                	test   %ebx,%ebx
+  805227:	78 2e                	js     805257 <__divdi3+0x47>
+  805229:	53                   	push   %ebx
+  80522a:	51                   	push   %ecx
+  80522b:	52                   	push   %edx
+  80522c:	50                   	push   %eax
+  80522d:	e8 c8 fe ff ff       	call   8050fa <__udivdi3>
+  805232:	83 c4 10             	add    $0x10,%esp
+  805235:	eb 1e                	jmp    805255 <__divdi3+0x45>
+  805237:	f7 d8                	neg    %eax
+  805239:	83 d2 00             	adc    $0x0,%edx
+  80523c:	f7 da                	neg    %edx
+  80523e:	85 db                	test   %ebx,%ebx
+  805240:	78 2a                	js     80526c <__divdi3+0x5c>
+  805242:	53                   	push   %ebx
+  805243:	51                   	push   %ecx
+  805244:	52                   	push   %edx
+  805245:	50                   	push   %eax
+  805246:	e8 af fe ff ff       	call   8050fa <__udivdi3>
+  80524b:	83 c4 10             	add    $0x10,%esp
+  80524e:	f7 d8                	neg    %eax
+  805250:	83 d2 00             	adc    $0x0,%edx
+  805253:	f7 da                	neg    %edx
+  805255:	5b                   	pop    %ebx
+  805256:	c3                   	ret
+  805257:	f7 d9                	neg    %ecx
+  805259:	83 d3 00             	adc    $0x0,%ebx
+  80525c:	f7 db                	neg    %ebx
+  80525e:	53                   	push   %ebx
+  80525f:	51                   	push   %ecx
+  805260:	52                   	push   %edx
+  805261:	50                   	push   %eax
+  805262:	e8 93 fe ff ff       	call   8050fa <__udivdi3>
+  805267:	83 c4 10             	add    $0x10,%esp
+  80526a:	eb e2                	jmp    80524e <__divdi3+0x3e>
+  80526c:	f7 d9                	neg    %ecx
+  80526e:	83 d3 00             	adc    $0x0,%ebx
+  805271:	f7 db                	neg    %ebx
+  805273:	53                   	push   %ebx
+  805274:	51                   	push   %ecx
+  805275:	52                   	push   %edx
+  805276:	50                   	push   %eax
+  805277:	e8 7e fe ff ff       	call   8050fa <__udivdi3>
+  80527c:	83 c4 10             	add    $0x10,%esp
+  80527f:	eb d4                	jmp    805255 <__divdi3+0x45>
+
+00805281 <__moddi3>:
+  805281:	57                   	push   %edi
+  805282:	56                   	push   %esi
+  805283:	53                   	push   %ebx
+  805284:	83 ec 08             	sub    $0x8,%esp
+  805287:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80528b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80528f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  805293:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  805297:	57                   	push   %edi
+  805298:	56                   	push   %esi
+  805299:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80529d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8052a1:	52                   	push   %edx
+  8052a2:	50                   	push   %eax
+  8052a3:	e8 68 ff ff ff       	call   805210 <__divdi3>
+  8052a8:	89 c3                	mov    %eax,%ebx
+  8052aa:	0f af d6             	imul   %esi,%edx
+  8052ad:	89 f9                	mov    %edi,%ecx
+  8052af:	0f af cb             	imul   %ebx,%ecx
+  8052b2:	01 d1                	add    %edx,%ecx
+  8052b4:	89 d8                	mov    %ebx,%eax
+  8052b6:	f7 e6                	mul    %esi
+  8052b8:	89 c6                	mov    %eax,%esi
+  8052ba:	89 d7                	mov    %edx,%edi
+  8052bc:	01 cf                	add    %ecx,%edi
+  8052be:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8052c2:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8052c6:	29 f0                	sub    %esi,%eax
+  8052c8:	19 fa                	sbb    %edi,%edx
+  8052ca:	83 c4 18             	add    $0x18,%esp
+  8052cd:	5b                   	pop    %ebx
+  8052ce:	5e                   	pop    %esi
+  8052cf:	5f                   	pop    %edi
+  8052d0:	c3                   	ret
@@ -0,0 +1,9046 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b4 00 00 00       	call   8000e5 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 04             	sub    $0x4,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003f:	e8 ca 0c 00 00       	call   800d0e <sys_getenvid>
+  800044:	83 ec 04             	sub    $0x4,%esp
+  800047:	53                   	push   %ebx
+  800048:	50                   	push   %eax
+  800049:	68 80 44 80 00       	push   $0x804480
+  80004e:	e8 ce 01 00 00       	call   800221 <cprintf>
+
+	forkchild(cur, '0');
+  800053:	83 c4 08             	add    $0x8,%esp
+  800056:	6a 30                	push   $0x30
+  800058:	53                   	push   %ebx
+  800059:	e8 13 00 00 00       	call   800071 <forkchild>
+	forkchild(cur, '1');
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 31                	push   $0x31
+  800063:	53                   	push   %ebx
+  800064:	e8 08 00 00 00       	call   800071 <forkchild>
+}
+  800069:	83 c4 10             	add    $0x10,%esp
+  80006c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006f:	c9                   	leave
+  800070:	c3                   	ret
+
+00800071 <forkchild>:
+{
+  800071:	55                   	push   %ebp
+  800072:	89 e5                	mov    %esp,%ebp
+  800074:	56                   	push   %esi
+  800075:	53                   	push   %ebx
+  800076:	83 ec 1c             	sub    $0x1c,%esp
+  800079:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007f:	53                   	push   %ebx
+  800080:	e8 47 08 00 00       	call   8008cc <strlen>
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	83 f8 02             	cmp    $0x2,%eax
+  80008b:	7e 07                	jle    800094 <forkchild+0x23>
+}
+  80008d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800090:	5b                   	pop    %ebx
+  800091:	5e                   	pop    %esi
+  800092:	5d                   	pop    %ebp
+  800093:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800094:	83 ec 0c             	sub    $0xc,%esp
+  800097:	89 f0                	mov    %esi,%eax
+  800099:	0f be f0             	movsbl %al,%esi
+  80009c:	56                   	push   %esi
+  80009d:	53                   	push   %ebx
+  80009e:	68 91 44 80 00       	push   $0x804491
+  8000a3:	6a 04                	push   $0x4
+  8000a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a8:	50                   	push   %eax
+  8000a9:	e8 04 08 00 00       	call   8008b2 <snprintf>
+	if (fork() == 0) {
+  8000ae:	83 c4 20             	add    $0x20,%esp
+  8000b1:	e8 9e 12 00 00       	call   801354 <fork>
+  8000b6:	85 c0                	test   %eax,%eax
+  8000b8:	75 d3                	jne    80008d <forkchild+0x1c>
+		forktree(nxt);
+  8000ba:	83 ec 0c             	sub    $0xc,%esp
+  8000bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000c0:	50                   	push   %eax
+  8000c1:	e8 6f ff ff ff       	call   800035 <forktree>
+		exit();
+  8000c6:	e8 a7 00 00 00       	call   800172 <exit>
+  8000cb:	83 c4 10             	add    $0x10,%esp
+  8000ce:	eb bd                	jmp    80008d <forkchild+0x1c>
+
+008000d0 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000d0:	55                   	push   %ebp
+  8000d1:	89 e5                	mov    %esp,%ebp
+  8000d3:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d6:	68 90 44 80 00       	push   $0x804490
+  8000db:	e8 55 ff ff ff       	call   800035 <forktree>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	c9                   	leave
+  8000e4:	c3                   	ret
+
+008000e5 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e5:	55                   	push   %ebp
+  8000e6:	89 e5                	mov    %esp,%ebp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000f0:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000f2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000f7:	29 d0                	sub    %edx,%eax
+  8000f9:	89 c2                	mov    %eax,%edx
+  8000fb:	c1 ea 0f             	shr    $0xf,%edx
+  8000fe:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800103:	b8 00 00 00 00       	mov    $0x0,%eax
+  800108:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80010b:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  800112:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800116:	e8 f3 0b 00 00       	call   800d0e <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80011b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800120:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800126:	89 e1                	mov    %esp,%ecx
+  800128:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80012d:	29 ca                	sub    %ecx,%edx
+  80012f:	89 d1                	mov    %edx,%ecx
+  800131:	c1 e9 0f             	shr    $0xf,%ecx
+  800134:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80013a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013f:	0f 42 d1             	cmovb  %ecx,%edx
+  800142:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800147:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80014e:	85 db                	test   %ebx,%ebx
+  800150:	7e 07                	jle    800159 <libmain+0x74>
+		binaryname = argv[0];
+  800152:	8b 06                	mov    (%esi),%eax
+  800154:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800159:	83 ec 08             	sub    $0x8,%esp
+  80015c:	56                   	push   %esi
+  80015d:	53                   	push   %ebx
+  80015e:	e8 6d ff ff ff       	call   8000d0 <umain>
+
+	// exit gracefully
+	exit();
+  800163:	e8 0a 00 00 00       	call   800172 <exit>
+}
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80016e:	5b                   	pop    %ebx
+  80016f:	5e                   	pop    %esi
+  800170:	5d                   	pop    %ebp
+  800171:	c3                   	ret
+
+00800172 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800172:	55                   	push   %ebp
+  800173:	89 e5                	mov    %esp,%ebp
+  800175:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800178:	e8 97 19 00 00       	call   801b14 <close_all>
+	sys_env_destroy(0);
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  800180:	6a 00                	push   $0x0
+  800182:	e8 46 0b 00 00       	call   800ccd <sys_env_destroy>
+}
+  800187:	83 c4 10             	add    $0x10,%esp
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+
+0080018c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	53                   	push   %ebx
+  800190:	83 ec 04             	sub    $0x4,%esp
+  800193:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800196:	8b 13                	mov    (%ebx),%edx
+  800198:	8d 42 01             	lea    0x1(%edx),%eax
+  80019b:	89 03                	mov    %eax,(%ebx)
+  80019d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001a4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a9:	74 09                	je     8001b4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001ab:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001b4:	83 ec 08             	sub    $0x8,%esp
+  8001b7:	68 ff 00 00 00       	push   $0xff
+  8001bc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	e8 cb 0a 00 00       	call   800c90 <sys_cputs>
+		b->idx = 0;
+  8001c5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001cb:	83 c4 10             	add    $0x10,%esp
+  8001ce:	eb db                	jmp    8001ab <putch+0x1f>
+
+008001d0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d0:	55                   	push   %ebp
+  8001d1:	89 e5                	mov    %esp,%ebp
+  8001d3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e0:	00 00 00 
+	b.cnt = 0;
+  8001e3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ea:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001ed:	ff 75 0c             	push   0xc(%ebp)
+  8001f0:	ff 75 08             	push   0x8(%ebp)
+  8001f3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f9:	50                   	push   %eax
+  8001fa:	68 8c 01 80 00       	push   $0x80018c
+  8001ff:	e8 1c 01 00 00       	call   800320 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800204:	83 c4 08             	add    $0x8,%esp
+  800207:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80020d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800213:	50                   	push   %eax
+  800214:	e8 77 0a 00 00       	call   800c90 <sys_cputs>
+
+	return b.cnt;
+}
+  800219:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80021f:	c9                   	leave
+  800220:	c3                   	ret
+
+00800221 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800227:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80022a:	50                   	push   %eax
+  80022b:	ff 75 08             	push   0x8(%ebp)
+  80022e:	e8 9d ff ff ff       	call   8001d0 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800233:	c9                   	leave
+  800234:	c3                   	ret
+
+00800235 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	57                   	push   %edi
+  800239:	56                   	push   %esi
+  80023a:	53                   	push   %ebx
+  80023b:	83 ec 1c             	sub    $0x1c,%esp
+  80023e:	89 c3                	mov    %eax,%ebx
+  800240:	89 d6                	mov    %edx,%esi
+  800242:	8b 45 08             	mov    0x8(%ebp),%eax
+  800245:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800248:	89 d1                	mov    %edx,%ecx
+  80024a:	89 c2                	mov    %eax,%edx
+  80024c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80024f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800252:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800255:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800258:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80025f:	39 c2                	cmp    %eax,%edx
+  800261:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800264:	73 4b                	jae    8002b1 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800266:	8b 45 14             	mov    0x14(%ebp),%eax
+  800269:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80026c:	85 ff                	test   %edi,%edi
+  80026e:	7e 11                	jle    800281 <printnum+0x4c>
+			putch(padc, putdat);
+  800270:	83 ec 08             	sub    $0x8,%esp
+  800273:	56                   	push   %esi
+  800274:	ff 75 18             	push   0x18(%ebp)
+  800277:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800279:	83 c4 10             	add    $0x10,%esp
+  80027c:	83 ef 01             	sub    $0x1,%edi
+  80027f:	75 ef                	jne    800270 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800281:	83 ec 08             	sub    $0x8,%esp
+  800284:	56                   	push   %esi
+  800285:	83 ec 04             	sub    $0x4,%esp
+  800288:	ff 75 e4             	push   -0x1c(%ebp)
+  80028b:	ff 75 e0             	push   -0x20(%ebp)
+  80028e:	ff 75 dc             	push   -0x24(%ebp)
+  800291:	ff 75 d8             	push   -0x28(%ebp)
+  800294:	e8 d3 40 00 00       	call   80436c <__umoddi3>
+  800299:	83 c4 14             	add    $0x14,%esp
+  80029c:	0f be 80 a0 44 80 00 	movsbl 0x8044a0(%eax),%eax
+  8002a3:	50                   	push   %eax
+  8002a4:	ff d3                	call   *%ebx
+}
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ac:	5b                   	pop    %ebx
+  8002ad:	5e                   	pop    %esi
+  8002ae:	5f                   	pop    %edi
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002b1:	83 ec 0c             	sub    $0xc,%esp
+  8002b4:	ff 75 18             	push   0x18(%ebp)
+  8002b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002ba:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002bd:	52                   	push   %edx
+  8002be:	50                   	push   %eax
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c5:	ff 75 e0             	push   -0x20(%ebp)
+  8002c8:	ff 75 dc             	push   -0x24(%ebp)
+  8002cb:	ff 75 d8             	push   -0x28(%ebp)
+  8002ce:	e8 d3 3f 00 00       	call   8042a6 <__udivdi3>
+  8002d3:	83 c4 18             	add    $0x18,%esp
+  8002d6:	52                   	push   %edx
+  8002d7:	50                   	push   %eax
+  8002d8:	89 f2                	mov    %esi,%edx
+  8002da:	89 d8                	mov    %ebx,%eax
+  8002dc:	e8 54 ff ff ff       	call   800235 <printnum>
+  8002e1:	83 c4 20             	add    $0x20,%esp
+  8002e4:	eb 9b                	jmp    800281 <printnum+0x4c>
+
+008002e6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002ec:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f0:	8b 10                	mov    (%eax),%edx
+  8002f2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f5:	73 0a                	jae    800301 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002fa:	89 08                	mov    %ecx,(%eax)
+  8002fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ff:	88 02                	mov    %al,(%edx)
+}
+  800301:	5d                   	pop    %ebp
+  800302:	c3                   	ret
+
+00800303 <printfmt>:
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800309:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80030c:	50                   	push   %eax
+  80030d:	ff 75 10             	push   0x10(%ebp)
+  800310:	ff 75 0c             	push   0xc(%ebp)
+  800313:	ff 75 08             	push   0x8(%ebp)
+  800316:	e8 05 00 00 00       	call   800320 <vprintfmt>
+}
+  80031b:	83 c4 10             	add    $0x10,%esp
+  80031e:	c9                   	leave
+  80031f:	c3                   	ret
+
+00800320 <vprintfmt>:
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	57                   	push   %edi
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	83 ec 2c             	sub    $0x2c,%esp
+  800329:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80032c:	89 df                	mov    %ebx,%edi
+  80032e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800331:	8b 45 10             	mov    0x10(%ebp),%eax
+  800334:	8d 70 01             	lea    0x1(%eax),%esi
+  800337:	0f b6 00             	movzbl (%eax),%eax
+  80033a:	83 f8 25             	cmp    $0x25,%eax
+  80033d:	74 1e                	je     80035d <vprintfmt+0x3d>
+			if (ch == '\0')
+  80033f:	85 c0                	test   %eax,%eax
+  800341:	0f 84 15 05 00 00    	je     80085c <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800347:	83 ec 08             	sub    $0x8,%esp
+  80034a:	53                   	push   %ebx
+  80034b:	50                   	push   %eax
+  80034c:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80034e:	83 c6 01             	add    $0x1,%esi
+  800351:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800355:	83 c4 10             	add    $0x10,%esp
+  800358:	83 f8 25             	cmp    $0x25,%eax
+  80035b:	75 e2                	jne    80033f <vprintfmt+0x1f>
+		padc = ' ';
+  80035d:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800361:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800368:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80036f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800376:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80037b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80037e:	8d 56 01             	lea    0x1(%esi),%edx
+  800381:	0f b6 0e             	movzbl (%esi),%ecx
+  800384:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800387:	3c 55                	cmp    $0x55,%al
+  800389:	0f 87 3b 04 00 00    	ja     8007ca <vprintfmt+0x4aa>
+  80038f:	0f b6 c0             	movzbl %al,%eax
+  800392:	ff 24 85 20 46 80 00 	jmp    *0x804620(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800399:	89 75 10             	mov    %esi,0x10(%ebp)
+  80039c:	eb 93                	jmp    800331 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039e:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8003a0:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003a4:	eb d8                	jmp    80037e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a6:	89 d6                	mov    %edx,%esi
+  8003a8:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003ac:	eb d0                	jmp    80037e <vprintfmt+0x5e>
+  8003ae:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8003b1:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003b4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8003b7:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8003bb:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003be:	83 f9 09             	cmp    $0x9,%ecx
+  8003c1:	77 6f                	ja     800432 <vprintfmt+0x112>
+  8003c3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8003c6:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8003c9:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003cc:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003d0:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8003d3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003d6:	83 fe 09             	cmp    $0x9,%esi
+  8003d9:	76 eb                	jbe    8003c6 <vprintfmt+0xa6>
+  8003db:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8003de:	89 d6                	mov    %edx,%esi
+  8003e0:	eb 13                	jmp    8003f5 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8003e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e5:	8b 00                	mov    (%eax),%eax
+  8003e7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8003f0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8003f5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003f9:	79 83                	jns    80037e <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8003fb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800401:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800408:	e9 71 ff ff ff       	jmp    80037e <vprintfmt+0x5e>
+			if (width < 0)
+  80040d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800410:	85 c9                	test   %ecx,%ecx
+  800412:	b8 00 00 00 00       	mov    $0x0,%eax
+  800417:	0f 49 c1             	cmovns %ecx,%eax
+  80041a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041d:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80041f:	e9 5a ff ff ff       	jmp    80037e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800426:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80042d:	e9 4c ff ff ff       	jmp    80037e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800432:	89 d6                	mov    %edx,%esi
+  800434:	eb bf                	jmp    8003f5 <vprintfmt+0xd5>
+			lflag++;
+  800436:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80043a:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80043c:	e9 3d ff ff ff       	jmp    80037e <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800441:	89 55 10             	mov    %edx,0x10(%ebp)
+  800444:	8b 45 14             	mov    0x14(%ebp),%eax
+  800447:	8d 70 04             	lea    0x4(%eax),%esi
+  80044a:	83 ec 08             	sub    $0x8,%esp
+  80044d:	53                   	push   %ebx
+  80044e:	ff 30                	push   (%eax)
+  800450:	ff d7                	call   *%edi
+			break;
+  800452:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800455:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800458:	e9 d4 fe ff ff       	jmp    800331 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80045d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800460:	8b 45 14             	mov    0x14(%ebp),%eax
+  800463:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800466:	8b 10                	mov    (%eax),%edx
+  800468:	89 d0                	mov    %edx,%eax
+  80046a:	f7 d8                	neg    %eax
+  80046c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80046f:	83 f8 12             	cmp    $0x12,%eax
+  800472:	7f 23                	jg     800497 <vprintfmt+0x177>
+  800474:	8b 14 85 80 47 80 00 	mov    0x804780(,%eax,4),%edx
+  80047b:	85 d2                	test   %edx,%edx
+  80047d:	74 18                	je     800497 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80047f:	52                   	push   %edx
+  800480:	68 d3 49 80 00       	push   $0x8049d3
+  800485:	53                   	push   %ebx
+  800486:	57                   	push   %edi
+  800487:	e8 77 fe ff ff       	call   800303 <printfmt>
+  80048c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80048f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800492:	e9 9a fe ff ff       	jmp    800331 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800497:	50                   	push   %eax
+  800498:	68 b8 44 80 00       	push   $0x8044b8
+  80049d:	53                   	push   %ebx
+  80049e:	57                   	push   %edi
+  80049f:	e8 5f fe ff ff       	call   800303 <printfmt>
+  8004a4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004a7:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004aa:	e9 82 fe ff ff       	jmp    800331 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004af:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b5:	83 c0 04             	add    $0x4,%eax
+  8004b8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004be:	8b 00                	mov    (%eax),%eax
+  8004c0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c3:	85 c0                	test   %eax,%eax
+  8004c5:	0f 84 61 03 00 00    	je     80082c <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8004cb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004cf:	7e 06                	jle    8004d7 <vprintfmt+0x1b7>
+  8004d1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004d5:	75 29                	jne    800500 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004d7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004da:	8d 70 01             	lea    0x1(%eax),%esi
+  8004dd:	0f b6 00             	movzbl (%eax),%eax
+  8004e0:	0f be d0             	movsbl %al,%edx
+  8004e3:	85 d2                	test   %edx,%edx
+  8004e5:	0f 84 bb 00 00 00    	je     8005a6 <vprintfmt+0x286>
+  8004eb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004ee:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004f1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004f4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004f7:	eb 7a                	jmp    800573 <vprintfmt+0x253>
+				p = "(null)";
+  8004f9:	c7 45 d0 b1 44 80 00 	movl   $0x8044b1,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800500:	83 ec 08             	sub    $0x8,%esp
+  800503:	ff 75 d4             	push   -0x2c(%ebp)
+  800506:	ff 75 d0             	push   -0x30(%ebp)
+  800509:	e8 e0 03 00 00       	call   8008ee <strnlen>
+  80050e:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800511:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800514:	83 c4 10             	add    $0x10,%esp
+  800517:	85 d2                	test   %edx,%edx
+  800519:	0f 8e d6 02 00 00    	jle    8007f5 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80051f:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800523:	83 ec 08             	sub    $0x8,%esp
+  800526:	53                   	push   %ebx
+  800527:	56                   	push   %esi
+  800528:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052a:	83 c4 10             	add    $0x10,%esp
+  80052d:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800531:	75 f0                	jne    800523 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800533:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800536:	8d 70 01             	lea    0x1(%eax),%esi
+  800539:	0f b6 00             	movzbl (%eax),%eax
+  80053c:	0f be d0             	movsbl %al,%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	0f 84 da 02 00 00    	je     800821 <vprintfmt+0x501>
+  800547:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80054a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80054d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800550:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800553:	eb 1e                	jmp    800573 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800555:	83 ec 08             	sub    $0x8,%esp
+  800558:	ff 75 0c             	push   0xc(%ebp)
+  80055b:	52                   	push   %edx
+  80055c:	ff 55 08             	call   *0x8(%ebp)
+  80055f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800562:	83 eb 01             	sub    $0x1,%ebx
+  800565:	83 c6 01             	add    $0x1,%esi
+  800568:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056c:	0f be d0             	movsbl %al,%edx
+  80056f:	85 d2                	test   %edx,%edx
+  800571:	74 2a                	je     80059d <vprintfmt+0x27d>
+  800573:	85 ff                	test   %edi,%edi
+  800575:	78 05                	js     80057c <vprintfmt+0x25c>
+  800577:	83 ef 01             	sub    $0x1,%edi
+  80057a:	78 59                	js     8005d5 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80057c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800580:	74 d3                	je     800555 <vprintfmt+0x235>
+  800582:	0f be c0             	movsbl %al,%eax
+  800585:	83 e8 20             	sub    $0x20,%eax
+  800588:	83 f8 5e             	cmp    $0x5e,%eax
+  80058b:	76 c8                	jbe    800555 <vprintfmt+0x235>
+					putch('?', putdat);
+  80058d:	83 ec 08             	sub    $0x8,%esp
+  800590:	ff 75 0c             	push   0xc(%ebp)
+  800593:	6a 3f                	push   $0x3f
+  800595:	ff 55 08             	call   *0x8(%ebp)
+  800598:	83 c4 10             	add    $0x10,%esp
+  80059b:	eb c5                	jmp    800562 <vprintfmt+0x242>
+  80059d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8005a6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005a9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005ad:	7e 1b                	jle    8005ca <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8005af:	83 ec 08             	sub    $0x8,%esp
+  8005b2:	53                   	push   %ebx
+  8005b3:	6a 20                	push   $0x20
+  8005b5:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005b7:	83 c4 10             	add    $0x10,%esp
+  8005ba:	83 ee 01             	sub    $0x1,%esi
+  8005bd:	75 f0                	jne    8005af <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005bf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005c2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c5:	e9 67 fd ff ff       	jmp    800331 <vprintfmt+0x11>
+  8005ca:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d0:	e9 5c fd ff ff       	jmp    800331 <vprintfmt+0x11>
+  8005d5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005de:	eb c6                	jmp    8005a6 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8005e0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005e3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e6:	83 f9 01             	cmp    $0x1,%ecx
+  8005e9:	7f 1f                	jg     80060a <vprintfmt+0x2ea>
+	else if (lflag)
+  8005eb:	85 c9                	test   %ecx,%ecx
+  8005ed:	74 67                	je     800656 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8005ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f2:	8b 30                	mov    (%eax),%esi
+  8005f4:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005f7:	89 f0                	mov    %esi,%eax
+  8005f9:	c1 f8 1f             	sar    $0x1f,%eax
+  8005fc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8d 40 04             	lea    0x4(%eax),%eax
+  800605:	89 45 14             	mov    %eax,0x14(%ebp)
+  800608:	eb 17                	jmp    800621 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8b 50 04             	mov    0x4(%eax),%edx
+  800610:	8b 00                	mov    (%eax),%eax
+  800612:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800615:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8d 40 08             	lea    0x8(%eax),%eax
+  80061e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800621:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800624:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800627:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80062c:	85 c9                	test   %ecx,%ecx
+  80062e:	0f 89 12 01 00 00    	jns    800746 <vprintfmt+0x426>
+				putch('-', putdat);
+  800634:	83 ec 08             	sub    $0x8,%esp
+  800637:	53                   	push   %ebx
+  800638:	6a 2d                	push   $0x2d
+  80063a:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80063c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800642:	f7 da                	neg    %edx
+  800644:	83 d1 00             	adc    $0x0,%ecx
+  800647:	f7 d9                	neg    %ecx
+  800649:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80064c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800651:	e9 f0 00 00 00       	jmp    800746 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 30                	mov    (%eax),%esi
+  80065b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80065e:	89 f0                	mov    %esi,%eax
+  800660:	c1 f8 1f             	sar    $0x1f,%eax
+  800663:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8d 40 04             	lea    0x4(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066f:	eb b0                	jmp    800621 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800671:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800674:	89 55 10             	mov    %edx,0x10(%ebp)
+  800677:	83 f9 01             	cmp    $0x1,%ecx
+  80067a:	7f 1e                	jg     80069a <vprintfmt+0x37a>
+	else if (lflag)
+  80067c:	85 c9                	test   %ecx,%ecx
+  80067e:	74 32                	je     8006b2 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8b 10                	mov    (%eax),%edx
+  800685:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068a:	8d 40 04             	lea    0x4(%eax),%eax
+  80068d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800690:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800695:	e9 ac 00 00 00       	jmp    800746 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8b 10                	mov    (%eax),%edx
+  80069f:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8006ad:	e9 94 00 00 00       	jmp    800746 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006c2:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8006c7:	eb 7d                	jmp    800746 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8006c9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006cc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006cf:	83 f9 01             	cmp    $0x1,%ecx
+  8006d2:	7f 1b                	jg     8006ef <vprintfmt+0x3cf>
+	else if (lflag)
+  8006d4:	85 c9                	test   %ecx,%ecx
+  8006d6:	74 2c                	je     800704 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 10                	mov    (%eax),%edx
+  8006dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006e8:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8006ed:	eb 57                	jmp    800746 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006fd:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800702:	eb 42                	jmp    800746 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 10                	mov    (%eax),%edx
+  800709:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070e:	8d 40 04             	lea    0x4(%eax),%eax
+  800711:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800714:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800719:	eb 2b                	jmp    800746 <vprintfmt+0x426>
+			putch('0', putdat);
+  80071b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	6a 30                	push   $0x30
+  800724:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800726:	83 c4 08             	add    $0x8,%esp
+  800729:	53                   	push   %ebx
+  80072a:	6a 78                	push   $0x78
+  80072c:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800738:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80073b:	8d 40 04             	lea    0x4(%eax),%eax
+  80073e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800741:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800746:	83 ec 0c             	sub    $0xc,%esp
+  800749:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80074d:	50                   	push   %eax
+  80074e:	ff 75 e4             	push   -0x1c(%ebp)
+  800751:	56                   	push   %esi
+  800752:	51                   	push   %ecx
+  800753:	52                   	push   %edx
+  800754:	89 da                	mov    %ebx,%edx
+  800756:	89 f8                	mov    %edi,%eax
+  800758:	e8 d8 fa ff ff       	call   800235 <printnum>
+			break;
+  80075d:	83 c4 20             	add    $0x20,%esp
+  800760:	e9 cc fb ff ff       	jmp    800331 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800765:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800768:	89 55 10             	mov    %edx,0x10(%ebp)
+  80076b:	83 f9 01             	cmp    $0x1,%ecx
+  80076e:	7f 1b                	jg     80078b <vprintfmt+0x46b>
+	else if (lflag)
+  800770:	85 c9                	test   %ecx,%ecx
+  800772:	74 2c                	je     8007a0 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8b 10                	mov    (%eax),%edx
+  800779:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077e:	8d 40 04             	lea    0x4(%eax),%eax
+  800781:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800784:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800789:	eb bb                	jmp    800746 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80078b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078e:	8b 10                	mov    (%eax),%edx
+  800790:	8b 48 04             	mov    0x4(%eax),%ecx
+  800793:	8d 40 08             	lea    0x8(%eax),%eax
+  800796:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800799:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80079e:	eb a6                	jmp    800746 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8b 10                	mov    (%eax),%edx
+  8007a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8007b5:	eb 8f                	jmp    800746 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8007b7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	6a 25                	push   $0x25
+  8007c0:	ff d7                	call   *%edi
+			break;
+  8007c2:	83 c4 10             	add    $0x10,%esp
+  8007c5:	e9 67 fb ff ff       	jmp    800331 <vprintfmt+0x11>
+			putch('%', putdat);
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	53                   	push   %ebx
+  8007ce:	6a 25                	push   $0x25
+  8007d0:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007d9:	0f 84 ba fb ff ff    	je     800399 <vprintfmt+0x79>
+  8007df:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007e2:	89 f0                	mov    %esi,%eax
+  8007e4:	83 e8 01             	sub    $0x1,%eax
+  8007e7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007eb:	75 f7                	jne    8007e4 <vprintfmt+0x4c4>
+  8007ed:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007f0:	e9 3c fb ff ff       	jmp    800331 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007f5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007f8:	8d 70 01             	lea    0x1(%eax),%esi
+  8007fb:	0f b6 00             	movzbl (%eax),%eax
+  8007fe:	0f be d0             	movsbl %al,%edx
+  800801:	85 d2                	test   %edx,%edx
+  800803:	74 11                	je     800816 <vprintfmt+0x4f6>
+  800805:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800808:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80080b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80080e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800811:	e9 5d fd ff ff       	jmp    800573 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800816:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081c:	e9 10 fb ff ff       	jmp    800331 <vprintfmt+0x11>
+  800821:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800824:	89 45 14             	mov    %eax,0x14(%ebp)
+  800827:	e9 05 fb ff ff       	jmp    800331 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  80082c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800830:	7e 0a                	jle    80083c <vprintfmt+0x51c>
+  800832:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800836:	0f 85 bd fc ff ff    	jne    8004f9 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80083c:	ba 28 00 00 00       	mov    $0x28,%edx
+  800841:	b8 28 00 00 00       	mov    $0x28,%eax
+  800846:	be b2 44 80 00       	mov    $0x8044b2,%esi
+  80084b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80084e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800851:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800854:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800857:	e9 17 fd ff ff       	jmp    800573 <vprintfmt+0x253>
+}
+  80085c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085f:	5b                   	pop    %ebx
+  800860:	5e                   	pop    %esi
+  800861:	5f                   	pop    %edi
+  800862:	5d                   	pop    %ebp
+  800863:	c3                   	ret
+
+00800864 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800864:	55                   	push   %ebp
+  800865:	89 e5                	mov    %esp,%ebp
+  800867:	83 ec 18             	sub    $0x18,%esp
+  80086a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800870:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800873:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800877:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80087a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800881:	85 c0                	test   %eax,%eax
+  800883:	74 26                	je     8008ab <vsnprintf+0x47>
+  800885:	85 d2                	test   %edx,%edx
+  800887:	7e 22                	jle    8008ab <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800889:	ff 75 14             	push   0x14(%ebp)
+  80088c:	ff 75 10             	push   0x10(%ebp)
+  80088f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800892:	50                   	push   %eax
+  800893:	68 e6 02 80 00       	push   $0x8002e6
+  800898:	e8 83 fa ff ff       	call   800320 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80089d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008a0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a6:	83 c4 10             	add    $0x10,%esp
+}
+  8008a9:	c9                   	leave
+  8008aa:	c3                   	ret
+		return -E_INVAL;
+  8008ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008b0:	eb f7                	jmp    8008a9 <vsnprintf+0x45>
+
+008008b2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008b8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008bb:	50                   	push   %eax
+  8008bc:	ff 75 10             	push   0x10(%ebp)
+  8008bf:	ff 75 0c             	push   0xc(%ebp)
+  8008c2:	ff 75 08             	push   0x8(%ebp)
+  8008c5:	e8 9a ff ff ff       	call   800864 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ca:	c9                   	leave
+  8008cb:	c3                   	ret
+
+008008cc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008d2:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008d5:	74 10                	je     8008e7 <strlen+0x1b>
+  8008d7:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8008dc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008df:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008e3:	75 f7                	jne    8008dc <strlen+0x10>
+	return n;
+}
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8008e7:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8008ec:	eb f7                	jmp    8008e5 <strlen+0x19>
+
+008008ee <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008ee:	55                   	push   %ebp
+  8008ef:	89 e5                	mov    %esp,%ebp
+  8008f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f7:	85 d2                	test   %edx,%edx
+  8008f9:	74 16                	je     800911 <strnlen+0x23>
+  8008fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800900:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800904:	74 09                	je     80090f <strnlen+0x21>
+		n++;
+  800906:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800909:	39 d0                	cmp    %edx,%eax
+  80090b:	75 f3                	jne    800900 <strnlen+0x12>
+		n++;
+  80090d:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80090f:	5d                   	pop    %ebp
+  800910:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800911:	b8 00 00 00 00       	mov    $0x0,%eax
+  800916:	eb f7                	jmp    80090f <strnlen+0x21>
+
+00800918 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800918:	55                   	push   %ebp
+  800919:	89 e5                	mov    %esp,%ebp
+  80091b:	53                   	push   %ebx
+  80091c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800922:	b8 00 00 00 00       	mov    $0x0,%eax
+  800927:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80092b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80092e:	83 c0 01             	add    $0x1,%eax
+  800931:	84 d2                	test   %dl,%dl
+  800933:	75 f2                	jne    800927 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800935:	89 c8                	mov    %ecx,%eax
+  800937:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093a:	c9                   	leave
+  80093b:	c3                   	ret
+
+0080093c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	53                   	push   %ebx
+  800940:	83 ec 10             	sub    $0x10,%esp
+  800943:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800946:	53                   	push   %ebx
+  800947:	e8 80 ff ff ff       	call   8008cc <strlen>
+  80094c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80094f:	ff 75 0c             	push   0xc(%ebp)
+  800952:	01 d8                	add    %ebx,%eax
+  800954:	50                   	push   %eax
+  800955:	e8 be ff ff ff       	call   800918 <strcpy>
+	return dst;
+}
+  80095a:	89 d8                	mov    %ebx,%eax
+  80095c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095f:	c9                   	leave
+  800960:	c3                   	ret
+
+00800961 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	56                   	push   %esi
+  800965:	53                   	push   %ebx
+  800966:	8b 75 08             	mov    0x8(%ebp),%esi
+  800969:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80096c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80096f:	85 db                	test   %ebx,%ebx
+  800971:	74 17                	je     80098a <strncpy+0x29>
+  800973:	01 f3                	add    %esi,%ebx
+  800975:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800977:	83 c0 01             	add    $0x1,%eax
+  80097a:	0f b6 0a             	movzbl (%edx),%ecx
+  80097d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800980:	80 f9 01             	cmp    $0x1,%cl
+  800983:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800986:	39 c3                	cmp    %eax,%ebx
+  800988:	75 ed                	jne    800977 <strncpy+0x16>
+	}
+	return ret;
+}
+  80098a:	89 f0                	mov    %esi,%eax
+  80098c:	5b                   	pop    %ebx
+  80098d:	5e                   	pop    %esi
+  80098e:	5d                   	pop    %ebp
+  80098f:	c3                   	ret
+
+00800990 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	56                   	push   %esi
+  800994:	53                   	push   %ebx
+  800995:	8b 75 08             	mov    0x8(%ebp),%esi
+  800998:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80099e:	89 f0                	mov    %esi,%eax
+  8009a0:	85 db                	test   %ebx,%ebx
+  8009a2:	74 1e                	je     8009c2 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  8009a4:	83 eb 01             	sub    $0x1,%ebx
+  8009a7:	74 16                	je     8009bf <strlcpy+0x2f>
+  8009a9:	01 f3                	add    %esi,%ebx
+  8009ab:	0f b6 0a             	movzbl (%edx),%ecx
+  8009ae:	84 c9                	test   %cl,%cl
+  8009b0:	74 0d                	je     8009bf <strlcpy+0x2f>
+			*dst++ = *src++;
+  8009b2:	83 c2 01             	add    $0x1,%edx
+  8009b5:	83 c0 01             	add    $0x1,%eax
+  8009b8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  8009bb:	39 d8                	cmp    %ebx,%eax
+  8009bd:	75 ec                	jne    8009ab <strlcpy+0x1b>
+		*dst = '\0';
+  8009bf:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009c2:	29 f0                	sub    %esi,%eax
+}
+  8009c4:	5b                   	pop    %ebx
+  8009c5:	5e                   	pop    %esi
+  8009c6:	5d                   	pop    %ebp
+  8009c7:	c3                   	ret
+
+008009c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009d1:	0f b6 01             	movzbl (%ecx),%eax
+  8009d4:	84 c0                	test   %al,%al
+  8009d6:	74 11                	je     8009e9 <strcmp+0x21>
+  8009d8:	38 02                	cmp    %al,(%edx)
+  8009da:	75 0d                	jne    8009e9 <strcmp+0x21>
+		p++, q++;
+  8009dc:	83 c1 01             	add    $0x1,%ecx
+  8009df:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009e2:	0f b6 01             	movzbl (%ecx),%eax
+  8009e5:	84 c0                	test   %al,%al
+  8009e7:	75 ef                	jne    8009d8 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e9:	0f b6 c0             	movzbl %al,%eax
+  8009ec:	0f b6 12             	movzbl (%edx),%edx
+  8009ef:	29 d0                	sub    %edx,%eax
+}
+  8009f1:	5d                   	pop    %ebp
+  8009f2:	c3                   	ret
+
+008009f3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	53                   	push   %ebx
+  8009f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009fd:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a00:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a05:	85 d2                	test   %edx,%edx
+  800a07:	74 2e                	je     800a37 <strncmp+0x44>
+  800a09:	0f b6 01             	movzbl (%ecx),%eax
+  800a0c:	84 c0                	test   %al,%al
+  800a0e:	74 16                	je     800a26 <strncmp+0x33>
+  800a10:	3a 03                	cmp    (%ebx),%al
+  800a12:	75 12                	jne    800a26 <strncmp+0x33>
+		n--, p++, q++;
+  800a14:	83 c1 01             	add    $0x1,%ecx
+  800a17:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a1a:	83 ea 01             	sub    $0x1,%edx
+  800a1d:	75 ea                	jne    800a09 <strncmp+0x16>
+		return 0;
+  800a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a24:	eb 11                	jmp    800a37 <strncmp+0x44>
+  800a26:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a2b:	85 d2                	test   %edx,%edx
+  800a2d:	74 08                	je     800a37 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a2f:	0f b6 01             	movzbl (%ecx),%eax
+  800a32:	0f b6 13             	movzbl (%ebx),%edx
+  800a35:	29 d0                	sub    %edx,%eax
+}
+  800a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3a:	c9                   	leave
+  800a3b:	c3                   	ret
+
+00800a3c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a42:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a46:	0f b6 10             	movzbl (%eax),%edx
+  800a49:	84 d2                	test   %dl,%dl
+  800a4b:	74 15                	je     800a62 <strchr+0x26>
+		if (*s == c)
+  800a4d:	38 d1                	cmp    %dl,%cl
+  800a4f:	74 0f                	je     800a60 <strchr+0x24>
+	for (; *s; s++)
+  800a51:	83 c0 01             	add    $0x1,%eax
+  800a54:	0f b6 10             	movzbl (%eax),%edx
+  800a57:	84 d2                	test   %dl,%dl
+  800a59:	75 f2                	jne    800a4d <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a60:	5d                   	pop    %ebp
+  800a61:	c3                   	ret
+	return 0;
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a67:	eb f7                	jmp    800a60 <strchr+0x24>
+
+00800a69 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	53                   	push   %ebx
+  800a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a70:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a73:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a76:	38 d3                	cmp    %dl,%bl
+  800a78:	74 14                	je     800a8e <strfind+0x25>
+  800a7a:	89 d1                	mov    %edx,%ecx
+  800a7c:	84 db                	test   %bl,%bl
+  800a7e:	74 0e                	je     800a8e <strfind+0x25>
+	for (; *s; s++)
+  800a80:	83 c0 01             	add    $0x1,%eax
+  800a83:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a86:	38 ca                	cmp    %cl,%dl
+  800a88:	74 04                	je     800a8e <strfind+0x25>
+  800a8a:	84 d2                	test   %dl,%dl
+  800a8c:	75 f2                	jne    800a80 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800a8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a91:	c9                   	leave
+  800a92:	c3                   	ret
+
+00800a93 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	57                   	push   %edi
+  800a97:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a9a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a9d:	85 c9                	test   %ecx,%ecx
+  800a9f:	74 20                	je     800ac1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800aa1:	89 f8                	mov    %edi,%eax
+  800aa3:	09 c8                	or     %ecx,%eax
+  800aa5:	a8 03                	test   $0x3,%al
+  800aa7:	75 12                	jne    800abb <memset+0x28>
+		c &= 0xFF;
+  800aa9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aad:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ab3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ab6:	fc                   	cld
+  800ab7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ab9:	eb 06                	jmp    800ac1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800abb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800abe:	fc                   	cld
+  800abf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ac1:	89 f8                	mov    %edi,%eax
+  800ac3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ac6:	c9                   	leave
+  800ac7:	c3                   	ret
+
+00800ac8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	57                   	push   %edi
+  800acc:	56                   	push   %esi
+  800acd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ad3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ad6:	39 c6                	cmp    %eax,%esi
+  800ad8:	73 32                	jae    800b0c <memmove+0x44>
+  800ada:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800add:	39 d0                	cmp    %edx,%eax
+  800adf:	73 2b                	jae    800b0c <memmove+0x44>
+		s += n;
+		d += n;
+  800ae1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ae4:	89 d6                	mov    %edx,%esi
+  800ae6:	09 fe                	or     %edi,%esi
+  800ae8:	09 ce                	or     %ecx,%esi
+  800aea:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800af0:	75 0e                	jne    800b00 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800af2:	83 ef 04             	sub    $0x4,%edi
+  800af5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800af8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800afb:	fd                   	std
+  800afc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800afe:	eb 09                	jmp    800b09 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b00:	83 ef 01             	sub    $0x1,%edi
+  800b03:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b06:	fd                   	std
+  800b07:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b09:	fc                   	cld
+  800b0a:	eb 1a                	jmp    800b26 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b0c:	89 f2                	mov    %esi,%edx
+  800b0e:	09 c2                	or     %eax,%edx
+  800b10:	09 ca                	or     %ecx,%edx
+  800b12:	f6 c2 03             	test   $0x3,%dl
+  800b15:	75 0a                	jne    800b21 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b17:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b1a:	89 c7                	mov    %eax,%edi
+  800b1c:	fc                   	cld
+  800b1d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b1f:	eb 05                	jmp    800b26 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b21:	89 c7                	mov    %eax,%edi
+  800b23:	fc                   	cld
+  800b24:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b26:	5e                   	pop    %esi
+  800b27:	5f                   	pop    %edi
+  800b28:	5d                   	pop    %ebp
+  800b29:	c3                   	ret
+
+00800b2a <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b30:	ff 75 10             	push   0x10(%ebp)
+  800b33:	ff 75 0c             	push   0xc(%ebp)
+  800b36:	ff 75 08             	push   0x8(%ebp)
+  800b39:	e8 8a ff ff ff       	call   800ac8 <memmove>
+}
+  800b3e:	c9                   	leave
+  800b3f:	c3                   	ret
+
+00800b40 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	56                   	push   %esi
+  800b44:	53                   	push   %ebx
+  800b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b4b:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b4e:	85 f6                	test   %esi,%esi
+  800b50:	74 29                	je     800b7b <memcmp+0x3b>
+  800b52:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b54:	0f b6 08             	movzbl (%eax),%ecx
+  800b57:	0f b6 1a             	movzbl (%edx),%ebx
+  800b5a:	38 d9                	cmp    %bl,%cl
+  800b5c:	75 11                	jne    800b6f <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b5e:	83 c0 01             	add    $0x1,%eax
+  800b61:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b64:	39 c6                	cmp    %eax,%esi
+  800b66:	75 ec                	jne    800b54 <memcmp+0x14>
+	}
+
+	return 0;
+  800b68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6d:	eb 08                	jmp    800b77 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b6f:	0f b6 c1             	movzbl %cl,%eax
+  800b72:	0f b6 db             	movzbl %bl,%ebx
+  800b75:	29 d8                	sub    %ebx,%eax
+}
+  800b77:	5b                   	pop    %ebx
+  800b78:	5e                   	pop    %esi
+  800b79:	5d                   	pop    %ebp
+  800b7a:	c3                   	ret
+	return 0;
+  800b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b80:	eb f5                	jmp    800b77 <memcmp+0x37>
+
+00800b82 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b8b:	89 c2                	mov    %eax,%edx
+  800b8d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b90:	39 d0                	cmp    %edx,%eax
+  800b92:	73 0d                	jae    800ba1 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b94:	38 08                	cmp    %cl,(%eax)
+  800b96:	74 0d                	je     800ba5 <memfind+0x23>
+	for (; s < ends; s++)
+  800b98:	83 c0 01             	add    $0x1,%eax
+  800b9b:	39 c2                	cmp    %eax,%edx
+  800b9d:	75 f5                	jne    800b94 <memfind+0x12>
+  800b9f:	eb 06                	jmp    800ba7 <memfind+0x25>
+  800ba1:	89 c2                	mov    %eax,%edx
+  800ba3:	eb 02                	jmp    800ba7 <memfind+0x25>
+  800ba5:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800ba7:	89 d0                	mov    %edx,%eax
+  800ba9:	5d                   	pop    %ebp
+  800baa:	c3                   	ret
+
+00800bab <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	57                   	push   %edi
+  800baf:	56                   	push   %esi
+  800bb0:	53                   	push   %ebx
+  800bb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bb7:	0f b6 02             	movzbl (%edx),%eax
+  800bba:	3c 20                	cmp    $0x20,%al
+  800bbc:	74 04                	je     800bc2 <strtol+0x17>
+  800bbe:	3c 09                	cmp    $0x9,%al
+  800bc0:	75 0e                	jne    800bd0 <strtol+0x25>
+		s++;
+  800bc2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bc5:	0f b6 02             	movzbl (%edx),%eax
+  800bc8:	3c 20                	cmp    $0x20,%al
+  800bca:	74 f6                	je     800bc2 <strtol+0x17>
+  800bcc:	3c 09                	cmp    $0x9,%al
+  800bce:	74 f2                	je     800bc2 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bd0:	3c 2b                	cmp    $0x2b,%al
+  800bd2:	74 2a                	je     800bfe <strtol+0x53>
+	int neg = 0;
+  800bd4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bd9:	3c 2d                	cmp    $0x2d,%al
+  800bdb:	74 2b                	je     800c08 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bdd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800be3:	75 0f                	jne    800bf4 <strtol+0x49>
+  800be5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be8:	74 28                	je     800c12 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bea:	85 db                	test   %ebx,%ebx
+  800bec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bf1:	0f 44 d8             	cmove  %eax,%ebx
+  800bf4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bfc:	eb 46                	jmp    800c44 <strtol+0x99>
+		s++;
+  800bfe:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c06:	eb d5                	jmp    800bdd <strtol+0x32>
+		s++, neg = 1;
+  800c08:	83 c2 01             	add    $0x1,%edx
+  800c0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c10:	eb cb                	jmp    800bdd <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c12:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c16:	74 0e                	je     800c26 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c18:	85 db                	test   %ebx,%ebx
+  800c1a:	75 d8                	jne    800bf4 <strtol+0x49>
+		s++, base = 8;
+  800c1c:	83 c2 01             	add    $0x1,%edx
+  800c1f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c24:	eb ce                	jmp    800bf4 <strtol+0x49>
+		s += 2, base = 16;
+  800c26:	83 c2 02             	add    $0x2,%edx
+  800c29:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c2e:	eb c4                	jmp    800bf4 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c30:	0f be c0             	movsbl %al,%eax
+  800c33:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c36:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c39:	7d 3a                	jge    800c75 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c3b:	83 c2 01             	add    $0x1,%edx
+  800c3e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c42:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c44:	0f b6 02             	movzbl (%edx),%eax
+  800c47:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c4a:	89 f3                	mov    %esi,%ebx
+  800c4c:	80 fb 09             	cmp    $0x9,%bl
+  800c4f:	76 df                	jbe    800c30 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c51:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c54:	89 f3                	mov    %esi,%ebx
+  800c56:	80 fb 19             	cmp    $0x19,%bl
+  800c59:	77 08                	ja     800c63 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c5b:	0f be c0             	movsbl %al,%eax
+  800c5e:	83 e8 57             	sub    $0x57,%eax
+  800c61:	eb d3                	jmp    800c36 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c63:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c66:	89 f3                	mov    %esi,%ebx
+  800c68:	80 fb 19             	cmp    $0x19,%bl
+  800c6b:	77 08                	ja     800c75 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c6d:	0f be c0             	movsbl %al,%eax
+  800c70:	83 e8 37             	sub    $0x37,%eax
+  800c73:	eb c1                	jmp    800c36 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c75:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c79:	74 05                	je     800c80 <strtol+0xd5>
+		*endptr = (char *) s;
+  800c7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c80:	89 c8                	mov    %ecx,%eax
+  800c82:	f7 d8                	neg    %eax
+  800c84:	85 ff                	test   %edi,%edi
+  800c86:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c89:	89 c8                	mov    %ecx,%eax
+  800c8b:	5b                   	pop    %ebx
+  800c8c:	5e                   	pop    %esi
+  800c8d:	5f                   	pop    %edi
+  800c8e:	5d                   	pop    %ebp
+  800c8f:	c3                   	ret
+
+00800c90 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	57                   	push   %edi
+  800c94:	56                   	push   %esi
+  800c95:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca1:	89 c3                	mov    %eax,%ebx
+  800ca3:	89 c7                	mov    %eax,%edi
+  800ca5:	89 c6                	mov    %eax,%esi
+  800ca7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ca9:	5b                   	pop    %ebx
+  800caa:	5e                   	pop    %esi
+  800cab:	5f                   	pop    %edi
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+
+00800cae <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	57                   	push   %edi
+  800cb2:	56                   	push   %esi
+  800cb3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbe:	89 d1                	mov    %edx,%ecx
+  800cc0:	89 d3                	mov    %edx,%ebx
+  800cc2:	89 d7                	mov    %edx,%edi
+  800cc4:	89 d6                	mov    %edx,%esi
+  800cc6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5e                   	pop    %esi
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cde:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce3:	89 cb                	mov    %ecx,%ebx
+  800ce5:	89 cf                	mov    %ecx,%edi
+  800ce7:	89 ce                	mov    %ecx,%esi
+  800ce9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ceb:	85 c0                	test   %eax,%eax
+  800ced:	7f 08                	jg     800cf7 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+  800cfa:	50                   	push   %eax
+  800cfb:	6a 03                	push   $0x3
+  800cfd:	68 eb 47 80 00       	push   $0x8047eb
+  800d02:	6a 23                	push   $0x23
+  800d04:	68 08 48 80 00       	push   $0x804808
+  800d09:	e8 78 31 00 00       	call   803e86 <_panic>
+
+00800d0e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d19:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d1e:	89 d1                	mov    %edx,%ecx
+  800d20:	89 d3                	mov    %edx,%ebx
+  800d22:	89 d7                	mov    %edx,%edi
+  800d24:	89 d6                	mov    %edx,%esi
+  800d26:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d28:	5b                   	pop    %ebx
+  800d29:	5e                   	pop    %esi
+  800d2a:	5f                   	pop    %edi
+  800d2b:	5d                   	pop    %ebp
+  800d2c:	c3                   	ret
+
+00800d2d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d38:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d3d:	89 d1                	mov    %edx,%ecx
+  800d3f:	89 d3                	mov    %edx,%ebx
+  800d41:	89 d7                	mov    %edx,%edi
+  800d43:	89 d6                	mov    %edx,%esi
+  800d45:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d55:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d68:	89 f7                	mov    %esi,%edi
+  800d6a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6c:	85 c0                	test   %eax,%eax
+  800d6e:	7f 08                	jg     800d78 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+  800d7b:	50                   	push   %eax
+  800d7c:	6a 04                	push   $0x4
+  800d7e:	68 eb 47 80 00       	push   $0x8047eb
+  800d83:	6a 23                	push   $0x23
+  800d85:	68 08 48 80 00       	push   $0x804808
+  800d8a:	e8 f7 30 00 00       	call   803e86 <_panic>
+
+00800d8f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800da3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dae:	85 c0                	test   %eax,%eax
+  800db0:	7f 08                	jg     800dba <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800db2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db5:	5b                   	pop    %ebx
+  800db6:	5e                   	pop    %esi
+  800db7:	5f                   	pop    %edi
+  800db8:	5d                   	pop    %ebp
+  800db9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+  800dbd:	50                   	push   %eax
+  800dbe:	6a 05                	push   $0x5
+  800dc0:	68 eb 47 80 00       	push   $0x8047eb
+  800dc5:	6a 23                	push   $0x23
+  800dc7:	68 08 48 80 00       	push   $0x804808
+  800dcc:	e8 b5 30 00 00       	call   803e86 <_panic>
+
+00800dd1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dea:	89 df                	mov    %ebx,%edi
+  800dec:	89 de                	mov    %ebx,%esi
+  800dee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	7f 08                	jg     800dfc <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df7:	5b                   	pop    %ebx
+  800df8:	5e                   	pop    %esi
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+  800dff:	50                   	push   %eax
+  800e00:	6a 06                	push   $0x6
+  800e02:	68 eb 47 80 00       	push   $0x8047eb
+  800e07:	6a 23                	push   $0x23
+  800e09:	68 08 48 80 00       	push   $0x804808
+  800e0e:	e8 73 30 00 00       	call   803e86 <_panic>
+
+00800e13 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e2c:	89 df                	mov    %ebx,%edi
+  800e2e:	89 de                	mov    %ebx,%esi
+  800e30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	7f 08                	jg     800e3e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+  800e41:	50                   	push   %eax
+  800e42:	6a 08                	push   $0x8
+  800e44:	68 eb 47 80 00       	push   $0x8047eb
+  800e49:	6a 23                	push   $0x23
+  800e4b:	68 08 48 80 00       	push   $0x804808
+  800e50:	e8 31 30 00 00       	call   803e86 <_panic>
+
+00800e55 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e69:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e6e:	89 df                	mov    %ebx,%edi
+  800e70:	89 de                	mov    %ebx,%esi
+  800e72:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 08                	jg     800e80 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 09                	push   $0x9
+  800e86:	68 eb 47 80 00       	push   $0x8047eb
+  800e8b:	6a 23                	push   $0x23
+  800e8d:	68 08 48 80 00       	push   $0x804808
+  800e92:	e8 ef 2f 00 00       	call   803e86 <_panic>
+
+00800e97 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	89 de                	mov    %ebx,%esi
+  800eb4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	7f 08                	jg     800ec2 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebd:	5b                   	pop    %ebx
+  800ebe:	5e                   	pop    %esi
+  800ebf:	5f                   	pop    %edi
+  800ec0:	5d                   	pop    %ebp
+  800ec1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec2:	83 ec 0c             	sub    $0xc,%esp
+  800ec5:	50                   	push   %eax
+  800ec6:	6a 0a                	push   $0xa
+  800ec8:	68 eb 47 80 00       	push   $0x8047eb
+  800ecd:	6a 23                	push   $0x23
+  800ecf:	68 08 48 80 00       	push   $0x804808
+  800ed4:	e8 ad 2f 00 00       	call   803e86 <_panic>
+
+00800ed9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ed9:	55                   	push   %ebp
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	57                   	push   %edi
+  800edd:	56                   	push   %esi
+  800ede:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eea:	be 00 00 00 00       	mov    $0x0,%esi
+  800eef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+
+00800efc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	57                   	push   %edi
+  800f00:	56                   	push   %esi
+  800f01:	53                   	push   %ebx
+  800f02:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f12:	89 cb                	mov    %ecx,%ebx
+  800f14:	89 cf                	mov    %ecx,%edi
+  800f16:	89 ce                	mov    %ecx,%esi
+  800f18:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1a:	85 c0                	test   %eax,%eax
+  800f1c:	7f 08                	jg     800f26 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f21:	5b                   	pop    %ebx
+  800f22:	5e                   	pop    %esi
+  800f23:	5f                   	pop    %edi
+  800f24:	5d                   	pop    %ebp
+  800f25:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f26:	83 ec 0c             	sub    $0xc,%esp
+  800f29:	50                   	push   %eax
+  800f2a:	6a 0d                	push   $0xd
+  800f2c:	68 eb 47 80 00       	push   $0x8047eb
+  800f31:	6a 23                	push   $0x23
+  800f33:	68 08 48 80 00       	push   $0x804808
+  800f38:	e8 49 2f 00 00       	call   803e86 <_panic>
+
+00800f3d <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f3d:	55                   	push   %ebp
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	57                   	push   %edi
+  800f41:	56                   	push   %esi
+  800f42:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f49:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f51:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f54:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f57:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f77:	89 df                	mov    %ebx,%edi
+  800f79:	89 de                	mov    %ebx,%esi
+  800f7b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7d:	85 c0                	test   %eax,%eax
+  800f7f:	7f 08                	jg     800f89 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 0d                	push   $0xd
+  800f8f:	68 eb 47 80 00       	push   $0x8047eb
+  800f94:	6a 23                	push   $0x23
+  800f96:	68 08 48 80 00       	push   $0x804808
+  800f9b:	e8 e6 2e 00 00       	call   803e86 <_panic>
+
+00800fa0 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fab:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fb0:	89 d1                	mov    %edx,%ecx
+  800fb2:	89 d3                	mov    %edx,%ebx
+  800fb4:	89 d7                	mov    %edx,%edi
+  800fb6:	89 d6                	mov    %edx,%esi
+  800fb8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+
+00800fbf <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fd5:	89 df                	mov    %ebx,%edi
+  800fd7:	89 de                	mov    %ebx,%esi
+  800fd9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800fdb:	5b                   	pop    %ebx
+  800fdc:	5e                   	pop    %esi
+  800fdd:	5f                   	pop    %edi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+
+00800fe0 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	57                   	push   %edi
+  800fe4:	56                   	push   %esi
+  800fe5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fee:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ff3:	89 cb                	mov    %ecx,%ebx
+  800ff5:	89 cf                	mov    %ecx,%edi
+  800ff7:	89 ce                	mov    %ecx,%esi
+  800ff9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+
+00801000 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	b8 11 00 00 00       	mov    $0x11,%eax
+  801016:	89 df                	mov    %ebx,%edi
+  801018:	89 de                	mov    %ebx,%esi
+  80101a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+
+00801021 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801021:	55                   	push   %ebp
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	57                   	push   %edi
+  801025:	56                   	push   %esi
+  801026:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801027:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801032:	b8 12 00 00 00       	mov    $0x12,%eax
+  801037:	89 df                	mov    %ebx,%edi
+  801039:	89 de                	mov    %ebx,%esi
+  80103b:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+
+00801042 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801048:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	b8 13 00 00 00       	mov    $0x13,%eax
+  801055:	89 cb                	mov    %ecx,%ebx
+  801057:	89 cf                	mov    %ecx,%edi
+  801059:	89 ce                	mov    %ecx,%esi
+  80105b:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80105d:	5b                   	pop    %ebx
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+
+00801062 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	b8 14 00 00 00       	mov    $0x14,%eax
+  801078:	89 df                	mov    %ebx,%edi
+  80107a:	89 de                	mov    %ebx,%esi
+  80107c:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80107e:	5b                   	pop    %ebx
+  80107f:	5e                   	pop    %esi
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+
+00801083 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	56                   	push   %esi
+  801088:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801089:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80108e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801091:	b8 15 00 00 00       	mov    $0x15,%eax
+  801096:	89 cb                	mov    %ecx,%ebx
+  801098:	89 cf                	mov    %ecx,%edi
+  80109a:	89 ce                	mov    %ecx,%esi
+  80109c:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+
+008010a3 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	56                   	push   %esi
+  8010a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bc:	89 f7                	mov    %esi,%edi
+  8010be:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8010c0:	5b                   	pop    %ebx
+  8010c1:	5e                   	pop    %esi
+  8010c2:	5f                   	pop    %edi
+  8010c3:	5d                   	pop    %ebp
+  8010c4:	c3                   	ret
+
+008010c5 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010db:	89 df                	mov    %ebx,%edi
+  8010dd:	89 de                	mov    %ebx,%esi
+  8010df:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8010e1:	5b                   	pop    %ebx
+  8010e2:	5e                   	pop    %esi
+  8010e3:	5f                   	pop    %edi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	c3                   	ret
+
+008010e6 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8010e6:	55                   	push   %ebp
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	57                   	push   %edi
+  8010ea:	56                   	push   %esi
+  8010eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010f9:	89 cb                	mov    %ecx,%ebx
+  8010fb:	89 cf                	mov    %ecx,%edi
+  8010fd:	89 ce                	mov    %ecx,%esi
+  8010ff:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801101:	5b                   	pop    %ebx
+  801102:	5e                   	pop    %esi
+  801103:	5f                   	pop    %edi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+
+00801106 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80110c:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801118:	b8 19 00 00 00       	mov    $0x19,%eax
+  80111d:	89 df                	mov    %ebx,%edi
+  80111f:	89 de                	mov    %ebx,%esi
+  801121:	cd 30                	int    $0x30
+}
+  801123:	5b                   	pop    %ebx
+  801124:	5e                   	pop    %esi
+  801125:	5f                   	pop    %edi
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+
+00801128 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	57                   	push   %edi
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112e:	be 00 00 00 00       	mov    $0x0,%esi
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801139:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80113e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801141:	89 f7                	mov    %esi,%edi
+  801143:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801145:	5b                   	pop    %ebx
+  801146:	5e                   	pop    %esi
+  801147:	5f                   	pop    %edi
+  801148:	5d                   	pop    %ebp
+  801149:	c3                   	ret
+
+0080114a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80114a:	55                   	push   %ebp
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	57                   	push   %edi
+  80114e:	56                   	push   %esi
+  80114f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801150:	be 00 00 00 00       	mov    $0x0,%esi
+  801155:	8b 55 08             	mov    0x8(%ebp),%edx
+  801158:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801160:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801163:	89 f7                	mov    %esi,%edi
+  801165:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801167:	5b                   	pop    %ebx
+  801168:	5e                   	pop    %esi
+  801169:	5f                   	pop    %edi
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	57                   	push   %edi
+  801170:	56                   	push   %esi
+  801171:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801172:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801177:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801182:	89 df                	mov    %ebx,%edi
+  801184:	89 de                	mov    %ebx,%esi
+  801186:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801188:	5b                   	pop    %ebx
+  801189:	5e                   	pop    %esi
+  80118a:	5f                   	pop    %edi
+  80118b:	5d                   	pop    %ebp
+  80118c:	c3                   	ret
+
+0080118d <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801193:	be 00 00 00 00       	mov    $0x0,%esi
+  801198:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8011a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a6:	89 f7                	mov    %esi,%edi
+  8011a8:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8011aa:	5b                   	pop    %ebx
+  8011ab:	5e                   	pop    %esi
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+
+008011af <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	74 20                	je     8011d3 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8011b3:	89 c1                	mov    %eax,%ecx
+  8011b5:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8011bb:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8011c1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8011c7:	8b 52 48             	mov    0x48(%edx),%edx
+  8011ca:	39 c2                	cmp    %eax,%edx
+  8011cc:	74 06                	je     8011d4 <thread_alive+0x25>
+  8011ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d3:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8011d4:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8011da:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8011e0:	85 c0                	test   %eax,%eax
+  8011e2:	0f 95 c0             	setne  %al
+  8011e5:	0f b6 c0             	movzbl %al,%eax
+  8011e8:	c3                   	ret
+
+008011e9 <pgfault>:
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8011f5:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8011f7:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8011fa:	89 f3                	mov    %esi,%ebx
+  8011fc:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8011ff:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801206:	74 52                	je     80125a <pgfault+0x71>
+  801208:	a8 02                	test   $0x2,%al
+  80120a:	75 14                	jne    801220 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  80120c:	83 ec 04             	sub    $0x4,%esp
+  80120f:	68 16 48 80 00       	push   $0x804816
+  801214:	6a 2e                	push   $0x2e
+  801216:	68 34 48 80 00       	push   $0x804834
+  80121b:	e8 66 2c 00 00       	call   803e86 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801220:	89 d8                	mov    %ebx,%eax
+  801222:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801227:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  80122e:	83 ec 0c             	sub    $0xc,%esp
+  801231:	57                   	push   %edi
+  801232:	e8 03 29 00 00       	call   803b3a <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801237:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80123e:	83 e0 03             	and    $0x3,%eax
+  801241:	83 c4 10             	add    $0x10,%esp
+  801244:	83 f8 03             	cmp    $0x3,%eax
+  801247:	75 1a                	jne    801263 <pgfault+0x7a>
+			mutex_unlock(m);
+  801249:	83 ec 0c             	sub    $0xc,%esp
+  80124c:	57                   	push   %edi
+  80124d:	e8 56 29 00 00       	call   803ba8 <mutex_unlock>
+			return;
+  801252:	83 c4 10             	add    $0x10,%esp
+  801255:	e9 9f 00 00 00       	jmp    8012f9 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80125a:	a8 02                	test   $0x2,%al
+  80125c:	74 ae                	je     80120c <pgfault+0x23>
+	struct mutex *m = NULL;
+  80125e:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801263:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80126a:	f6 c4 08             	test   $0x8,%ah
+  80126d:	74 9d                	je     80120c <pgfault+0x23>
+  80126f:	89 e0                	mov    %esp,%eax
+  801271:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801276:	29 c2                	sub    %eax,%edx
+  801278:	89 d0                	mov    %edx,%eax
+  80127a:	c1 e8 0f             	shr    $0xf,%eax
+  80127d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801283:	ba 00 00 00 00       	mov    $0x0,%edx
+  801288:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  80128b:	c1 e0 0c             	shl    $0xc,%eax
+  80128e:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801293:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801295:	83 ec 04             	sub    $0x4,%esp
+  801298:	6a 07                	push   $0x7
+  80129a:	53                   	push   %ebx
+  80129b:	6a 00                	push   $0x0
+  80129d:	e8 aa fa ff ff       	call   800d4c <sys_page_alloc>
+  8012a2:	83 c4 10             	add    $0x10,%esp
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 58                	js     801301 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8012a9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8012af:	83 ec 04             	sub    $0x4,%esp
+  8012b2:	68 00 10 00 00       	push   $0x1000
+  8012b7:	56                   	push   %esi
+  8012b8:	53                   	push   %ebx
+  8012b9:	e8 0a f8 ff ff       	call   800ac8 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8012be:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012c5:	56                   	push   %esi
+  8012c6:	6a 00                	push   $0x0
+  8012c8:	53                   	push   %ebx
+  8012c9:	6a 00                	push   $0x0
+  8012cb:	e8 bf fa ff ff       	call   800d8f <sys_page_map>
+  8012d0:	83 c4 20             	add    $0x20,%esp
+  8012d3:	85 c0                	test   %eax,%eax
+  8012d5:	78 3c                	js     801313 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8012d7:	83 ec 08             	sub    $0x8,%esp
+  8012da:	53                   	push   %ebx
+  8012db:	6a 00                	push   $0x0
+  8012dd:	e8 ef fa ff ff       	call   800dd1 <sys_page_unmap>
+  8012e2:	83 c4 10             	add    $0x10,%esp
+  8012e5:	85 c0                	test   %eax,%eax
+  8012e7:	78 3c                	js     801325 <pgfault+0x13c>
+	if(m)
+  8012e9:	85 ff                	test   %edi,%edi
+  8012eb:	74 0c                	je     8012f9 <pgfault+0x110>
+		mutex_unlock(m);
+  8012ed:	83 ec 0c             	sub    $0xc,%esp
+  8012f0:	57                   	push   %edi
+  8012f1:	e8 b2 28 00 00       	call   803ba8 <mutex_unlock>
+  8012f6:	83 c4 10             	add    $0x10,%esp
+}
+  8012f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fc:	5b                   	pop    %ebx
+  8012fd:	5e                   	pop    %esi
+  8012fe:	5f                   	pop    %edi
+  8012ff:	5d                   	pop    %ebp
+  801300:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801301:	50                   	push   %eax
+  801302:	68 3f 48 80 00       	push   $0x80483f
+  801307:	6a 3d                	push   $0x3d
+  801309:	68 34 48 80 00       	push   $0x804834
+  80130e:	e8 73 2b 00 00       	call   803e86 <_panic>
+		panic("sys_page_map: %e", ret);
+  801313:	50                   	push   %eax
+  801314:	68 52 48 80 00       	push   $0x804852
+  801319:	6a 40                	push   $0x40
+  80131b:	68 34 48 80 00       	push   $0x804834
+  801320:	e8 61 2b 00 00       	call   803e86 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801325:	50                   	push   %eax
+  801326:	68 63 48 80 00       	push   $0x804863
+  80132b:	6a 42                	push   $0x42
+  80132d:	68 34 48 80 00       	push   $0x804834
+  801332:	e8 4f 2b 00 00       	call   803e86 <_panic>
+
+00801337 <thread_main>:
+{
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  80133d:	ff 75 0c             	push   0xc(%ebp)
+  801340:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801343:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80134a:	e8 7e f9 ff ff       	call   800ccd <sys_env_destroy>
+}
+  80134f:	83 c4 10             	add    $0x10,%esp
+  801352:	c9                   	leave
+  801353:	c3                   	ret
+
+00801354 <fork>:
+{
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  801357:	57                   	push   %edi
+  801358:	56                   	push   %esi
+  801359:	53                   	push   %ebx
+  80135a:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  80135d:	68 e9 11 80 00       	push   $0x8011e9
+  801362:	e8 65 2b 00 00       	call   803ecc <set_pgfault_handler>
+	if(sforked)
+  801367:	83 c4 10             	add    $0x10,%esp
+  80136a:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801371:	75 33                	jne    8013a6 <fork+0x52>
+	__asm __volatile("int %2"
+  801373:	b8 07 00 00 00       	mov    $0x7,%eax
+  801378:	cd 30                	int    $0x30
+  80137a:	89 c7                	mov    %eax,%edi
+  80137c:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  80137e:	85 c0                	test   %eax,%eax
+  801380:	0f 88 b4 00 00 00    	js     80143a <fork+0xe6>
+	if(envid == 0) {
+  801386:	0f 84 c3 00 00 00    	je     80144f <fork+0xfb>
+	pgbatch_init(&pb);
+  80138c:	83 ec 0c             	sub    $0xc,%esp
+  80138f:	68 20 63 80 00       	push   $0x806320
+  801394:	e8 ed 25 00 00       	call   803986 <pgbatch_init>
+  801399:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80139c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a1:	e9 9c 01 00 00       	jmp    801542 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8013a6:	83 ec 0c             	sub    $0xc,%esp
+  8013a9:	68 c0 66 80 00       	push   $0x8066c0
+  8013ae:	e8 87 27 00 00       	call   803b3a <mutex_lock>
+  8013b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8013b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8013bb:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8013c0:	eb 08                	jmp    8013ca <fork+0x76>
+  8013c2:	83 c3 01             	add    $0x1,%ebx
+  8013c5:	83 fb 20             	cmp    $0x20,%ebx
+  8013c8:	74 5b                	je     801425 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8013ca:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  8013d1:	89 f0                	mov    %esi,%eax
+  8013d3:	e8 d7 fd ff ff       	call   8011af <thread_alive>
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	74 e6                	je     8013c2 <fork+0x6e>
+  8013dc:	89 e0                	mov    %esp,%eax
+  8013de:	89 fa                	mov    %edi,%edx
+  8013e0:	29 c2                	sub    %eax,%edx
+  8013e2:	89 d0                	mov    %edx,%eax
+  8013e4:	c1 e8 0f             	shr    $0xf,%eax
+  8013e7:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8013ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013f2:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8013f5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8013fc:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8013ff:	83 ec 08             	sub    $0x8,%esp
+  801402:	50                   	push   %eax
+  801403:	56                   	push   %esi
+  801404:	e8 8e fa ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  801409:	83 c4 10             	add    $0x10,%esp
+  80140c:	85 c0                	test   %eax,%eax
+  80140e:	79 b2                	jns    8013c2 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801410:	50                   	push   %eax
+  801411:	68 f0 48 80 00       	push   $0x8048f0
+  801416:	68 00 01 00 00       	push   $0x100
+  80141b:	68 34 48 80 00       	push   $0x804834
+  801420:	e8 61 2a 00 00       	call   803e86 <_panic>
+	mutex_unlock(&sfork_lock);
+  801425:	83 ec 0c             	sub    $0xc,%esp
+  801428:	68 c0 66 80 00       	push   $0x8066c0
+  80142d:	e8 76 27 00 00       	call   803ba8 <mutex_unlock>
+}
+  801432:	83 c4 10             	add    $0x10,%esp
+  801435:	e9 39 ff ff ff       	jmp    801373 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  80143a:	50                   	push   %eax
+  80143b:	68 76 48 80 00       	push   $0x804876
+  801440:	68 91 00 00 00       	push   $0x91
+  801445:	68 34 48 80 00       	push   $0x804834
+  80144a:	e8 37 2a 00 00       	call   803e86 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80144f:	e8 ba f8 ff ff       	call   800d0e <sys_getenvid>
+  801454:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801459:	89 e1                	mov    %esp,%ecx
+  80145b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801460:	29 ca                	sub    %ecx,%edx
+  801462:	89 d1                	mov    %edx,%ecx
+  801464:	c1 e9 0f             	shr    $0xf,%ecx
+  801467:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80146d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801472:	0f 42 d1             	cmovb  %ecx,%edx
+  801475:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80147b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801480:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  801487:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	75 07                	jne    801497 <fork+0x143>
+		return 0;
+  801490:	89 c6                	mov    %eax,%esi
+  801492:	e9 6f 02 00 00       	jmp    801706 <fork+0x3b2>
+  801497:	89 e2                	mov    %esp,%edx
+  801499:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80149e:	29 d0                	sub    %edx,%eax
+  8014a0:	89 c3                	mov    %eax,%ebx
+  8014a2:	c1 eb 0f             	shr    $0xf,%ebx
+  8014a5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014af:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8014b2:	83 ec 04             	sub    $0x4,%esp
+  8014b5:	68 80 00 00 00       	push   $0x80
+  8014ba:	6a 00                	push   $0x0
+  8014bc:	68 40 66 80 00       	push   $0x806640
+  8014c1:	e8 cd f5 ff ff       	call   800a93 <memset>
+	thread_ids[slot] = sys_getenvid();
+  8014c6:	e8 43 f8 ff ff       	call   800d0e <sys_getenvid>
+  8014cb:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8014d2:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  8014d9:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  8014de:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  8014e5:	e8 42 26 00 00       	call   803b2c <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8014ea:	83 c4 0c             	add    $0xc,%esp
+  8014ed:	68 07 04 00 00       	push   $0x407
+  8014f2:	68 00 00 00 e1       	push   $0xe1000000
+  8014f7:	6a 00                	push   $0x0
+  8014f9:	e8 4e f8 ff ff       	call   800d4c <sys_page_alloc>
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	85 c0                	test   %eax,%eax
+  801503:	0f 89 fd 01 00 00    	jns    801706 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801509:	50                   	push   %eax
+  80150a:	68 3f 48 80 00       	push   $0x80483f
+  80150f:	68 12 01 00 00       	push   $0x112
+  801514:	68 34 48 80 00       	push   $0x804834
+  801519:	e8 68 29 00 00       	call   803e86 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  80151e:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801524:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  80152a:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801530:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801536:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  80153c:	0f 87 4f 01 00 00    	ja     801691 <fork+0x33d>
+		pd = PDX(addr);
+  801542:	89 d8                	mov    %ebx,%eax
+  801544:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801547:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80154e:	f6 c2 01             	test   $0x1,%dl
+  801551:	74 cb                	je     80151e <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801553:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801558:	0f 85 92 00 00 00    	jne    8015f0 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  80155e:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801564:	76 10                	jbe    801576 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801566:	89 d8                	mov    %ebx,%eax
+  801568:	f7 d8                	neg    %eax
+  80156a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80156f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801574:	74 ba                	je     801530 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801576:	89 d8                	mov    %ebx,%eax
+  801578:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80157b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801582:	f6 c2 01             	test   $0x1,%dl
+  801585:	74 a9                	je     801530 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801587:	89 c1                	mov    %eax,%ecx
+  801589:	c1 e1 0c             	shl    $0xc,%ecx
+  80158c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  80158f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801596:	f6 c6 04             	test   $0x4,%dh
+  801599:	0f 85 8e 00 00 00    	jne    80162d <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  80159f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015a6:	f6 c6 08             	test   $0x8,%dh
+  8015a9:	75 0f                	jne    8015ba <fork+0x266>
+  8015ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015b2:	a8 02                	test   $0x2,%al
+  8015b4:	0f 84 bb 00 00 00    	je     801675 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8015ba:	83 ec 08             	sub    $0x8,%esp
+  8015bd:	68 05 08 00 00       	push   $0x805
+  8015c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8015c5:	50                   	push   %eax
+  8015c6:	56                   	push   %esi
+  8015c7:	50                   	push   %eax
+  8015c8:	6a 00                	push   $0x0
+  8015ca:	68 20 63 80 00       	push   $0x806320
+  8015cf:	e8 70 24 00 00       	call   803a44 <pgbatch_map>
+  8015d4:	83 c4 20             	add    $0x20,%esp
+  8015d7:	85 c0                	test   %eax,%eax
+  8015d9:	79 76                	jns    801651 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8015db:	50                   	push   %eax
+  8015dc:	68 9a 48 80 00       	push   $0x80489a
+  8015e1:	68 bc 00 00 00       	push   $0xbc
+  8015e6:	68 34 48 80 00       	push   $0x804834
+  8015eb:	e8 96 28 00 00       	call   803e86 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8015f0:	83 ec 0c             	sub    $0xc,%esp
+  8015f3:	68 00 08 00 00       	push   $0x800
+  8015f8:	56                   	push   %esi
+  8015f9:	53                   	push   %ebx
+  8015fa:	6a 00                	push   $0x0
+  8015fc:	68 20 63 80 00       	push   $0x806320
+  801601:	e8 e9 24 00 00       	call   803aef <pgbatch_sharept>
+  801606:	83 c4 20             	add    $0x20,%esp
+  801609:	85 c0                	test   %eax,%eax
+  80160b:	78 0b                	js     801618 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  80160d:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801613:	e9 18 ff ff ff       	jmp    801530 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801618:	50                   	push   %eax
+  801619:	68 86 48 80 00       	push   $0x804886
+  80161e:	68 b2 00 00 00       	push   $0xb2
+  801623:	68 34 48 80 00       	push   $0x804834
+  801628:	e8 59 28 00 00       	call   803e86 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  80162d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801634:	83 ec 08             	sub    $0x8,%esp
+  801637:	25 07 0e 00 00       	and    $0xe07,%eax
+  80163c:	50                   	push   %eax
+  80163d:	51                   	push   %ecx
+  80163e:	56                   	push   %esi
+  80163f:	51                   	push   %ecx
+  801640:	6a 00                	push   $0x0
+  801642:	68 20 63 80 00       	push   $0x806320
+  801647:	e8 f8 23 00 00       	call   803a44 <pgbatch_map>
+  80164c:	83 c4 20             	add    $0x20,%esp
+  80164f:	eb 17                	jmp    801668 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801651:	68 05 08 00 00       	push   $0x805
+  801656:	ff 75 e4             	push   -0x1c(%ebp)
+  801659:	6a 00                	push   $0x0
+  80165b:	68 20 63 80 00       	push   $0x806320
+  801660:	e8 53 24 00 00       	call   803ab8 <pgbatch_protect>
+  801665:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	0f 89 c0 fe ff ff    	jns    801530 <fork+0x1dc>
+  801670:	e9 66 ff ff ff       	jmp    8015db <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801675:	83 ec 08             	sub    $0x8,%esp
+  801678:	6a 05                	push   $0x5
+  80167a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80167d:	50                   	push   %eax
+  80167e:	56                   	push   %esi
+  80167f:	50                   	push   %eax
+  801680:	6a 00                	push   $0x0
+  801682:	68 20 63 80 00       	push   $0x806320
+  801687:	e8 b8 23 00 00       	call   803a44 <pgbatch_map>
+  80168c:	83 c4 20             	add    $0x20,%esp
+  80168f:	eb d7                	jmp    801668 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801691:	6a 07                	push   $0x7
+  801693:	68 00 f0 bf ee       	push   $0xeebff000
+  801698:	57                   	push   %edi
+  801699:	68 20 63 80 00       	push   $0x806320
+  80169e:	e8 6a 23 00 00       	call   803a0d <pgbatch_alloc>
+  8016a3:	83 c4 10             	add    $0x10,%esp
+  8016a6:	85 c0                	test   %eax,%eax
+  8016a8:	78 66                	js     801710 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8016aa:	83 ec 0c             	sub    $0xc,%esp
+  8016ad:	68 20 63 80 00       	push   $0x806320
+  8016b2:	e8 dd 22 00 00       	call   803994 <pgbatch_flush>
+  8016b7:	83 c4 10             	add    $0x10,%esp
+  8016ba:	85 c0                	test   %eax,%eax
+  8016bc:	78 52                	js     801710 <fork+0x3bc>
+  8016be:	89 e2                	mov    %esp,%edx
+  8016c0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016c5:	29 d0                	sub    %edx,%eax
+  8016c7:	89 c2                	mov    %eax,%edx
+  8016c9:	c1 ea 0f             	shr    $0xf,%edx
+  8016cc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d6:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8016d9:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8016e0:	8b 40 78             	mov    0x78(%eax),%eax
+  8016e3:	83 ec 08             	sub    $0x8,%esp
+  8016e6:	50                   	push   %eax
+  8016e7:	57                   	push   %edi
+  8016e8:	e8 aa f7 ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  8016ed:	83 c4 10             	add    $0x10,%esp
+  8016f0:	85 c0                	test   %eax,%eax
+  8016f2:	78 31                	js     801725 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  8016f4:	83 ec 08             	sub    $0x8,%esp
+  8016f7:	6a 02                	push   $0x2
+  8016f9:	57                   	push   %edi
+  8016fa:	e8 14 f7 ff ff       	call   800e13 <sys_env_set_status>
+  8016ff:	83 c4 10             	add    $0x10,%esp
+  801702:	85 c0                	test   %eax,%eax
+  801704:	78 34                	js     80173a <fork+0x3e6>
+}
+  801706:	89 f0                	mov    %esi,%eax
+  801708:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170b:	5b                   	pop    %ebx
+  80170c:	5e                   	pop    %esi
+  80170d:	5f                   	pop    %edi
+  80170e:	5d                   	pop    %ebp
+  80170f:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801710:	50                   	push   %eax
+  801711:	68 a6 48 80 00       	push   $0x8048a6
+  801716:	68 c0 00 00 00       	push   $0xc0
+  80171b:	68 34 48 80 00       	push   $0x804834
+  801720:	e8 61 27 00 00       	call   803e86 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801725:	50                   	push   %eax
+  801726:	68 bb 48 80 00       	push   $0x8048bb
+  80172b:	68 c2 00 00 00       	push   $0xc2
+  801730:	68 34 48 80 00       	push   $0x804834
+  801735:	e8 4c 27 00 00       	call   803e86 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  80173a:	50                   	push   %eax
+  80173b:	68 d6 48 80 00       	push   $0x8048d6
+  801740:	68 c4 00 00 00       	push   $0xc4
+  801745:	68 34 48 80 00       	push   $0x804834
+  80174a:	e8 37 27 00 00       	call   803e86 <_panic>
+
+0080174f <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  80174f:	55                   	push   %ebp
+  801750:	89 e5                	mov    %esp,%ebp
+  801752:	57                   	push   %edi
+  801753:	56                   	push   %esi
+  801754:	53                   	push   %ebx
+  801755:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801758:	68 c0 66 80 00       	push   $0x8066c0
+  80175d:	e8 d8 23 00 00       	call   803b3a <mutex_lock>
+  801762:	89 e2                	mov    %esp,%edx
+  801764:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801769:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  80176b:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80176e:	89 c3                	mov    %eax,%ebx
+  801770:	c1 eb 0f             	shr    $0xf,%ebx
+  801773:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177d:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801780:	e8 89 f5 ff ff       	call   800d0e <sys_getenvid>
+  801785:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  80178c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801791:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801798:	e8 12 fa ff ff       	call   8011af <thread_alive>
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	74 24                	je     8017c5 <sfork+0x76>
+  8017a1:	83 c3 01             	add    $0x1,%ebx
+  8017a4:	83 fb 20             	cmp    $0x20,%ebx
+  8017a7:	75 e8                	jne    801791 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  8017a9:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  8017ae:	83 ec 0c             	sub    $0xc,%esp
+  8017b1:	68 c0 66 80 00       	push   $0x8066c0
+  8017b6:	e8 ed 23 00 00       	call   803ba8 <mutex_unlock>
+	return r;
+}
+  8017bb:	89 f0                	mov    %esi,%eax
+  8017bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c0:	5b                   	pop    %ebx
+  8017c1:	5e                   	pop    %esi
+  8017c2:	5f                   	pop    %edi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+	if (i == NTHREADS) {
+  8017c5:	83 fb 20             	cmp    $0x20,%ebx
+  8017c8:	0f 84 53 01 00 00    	je     801921 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  8017ce:	89 d8                	mov    %ebx,%eax
+  8017d0:	c1 e0 0f             	shl    $0xf,%eax
+  8017d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  8017d6:	83 ec 0c             	sub    $0xc,%esp
+  8017d9:	68 00 60 80 00       	push   $0x806000
+  8017de:	e8 a3 21 00 00       	call   803986 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  8017e3:	83 c4 10             	add    $0x10,%esp
+  8017e6:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8017ed:	75 1f                	jne    80180e <sfork+0xbf>
+  8017ef:	68 07 04 00 00       	push   $0x407
+  8017f4:	68 00 00 00 e1       	push   $0xe1000000
+  8017f9:	6a 00                	push   $0x0
+  8017fb:	68 00 60 80 00       	push   $0x806000
+  801800:	e8 08 22 00 00       	call   803a0d <pgbatch_alloc>
+  801805:	89 c6                	mov    %eax,%esi
+  801807:	83 c4 10             	add    $0x10,%esp
+  80180a:	85 c0                	test   %eax,%eax
+  80180c:	78 a0                	js     8017ae <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  80180e:	6a 07                	push   $0x7
+  801810:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801815:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801818:	29 c8                	sub    %ecx,%eax
+  80181a:	50                   	push   %eax
+  80181b:	6a 00                	push   $0x0
+  80181d:	68 00 60 80 00       	push   $0x806000
+  801822:	e8 e6 21 00 00       	call   803a0d <pgbatch_alloc>
+  801827:	89 c6                	mov    %eax,%esi
+  801829:	83 c4 10             	add    $0x10,%esp
+  80182c:	85 c0                	test   %eax,%eax
+  80182e:	0f 88 7a ff ff ff    	js     8017ae <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801834:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801839:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80183c:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  80183e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801843:	29 c8                	sub    %ecx,%eax
+  801845:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801848:	39 c7                	cmp    %eax,%edi
+  80184a:	73 29                	jae    801875 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  80184c:	6a 07                	push   $0x7
+  80184e:	57                   	push   %edi
+  80184f:	6a 00                	push   $0x0
+  801851:	68 00 60 80 00       	push   $0x806000
+  801856:	e8 b2 21 00 00       	call   803a0d <pgbatch_alloc>
+  80185b:	89 c6                	mov    %eax,%esi
+  80185d:	83 c4 10             	add    $0x10,%esp
+  801860:	85 c0                	test   %eax,%eax
+  801862:	0f 88 46 ff ff ff    	js     8017ae <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801868:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80186e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801871:	39 c7                	cmp    %eax,%edi
+  801873:	72 d7                	jb     80184c <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801875:	83 ec 0c             	sub    $0xc,%esp
+  801878:	68 00 60 80 00       	push   $0x806000
+  80187d:	e8 12 21 00 00       	call   803994 <pgbatch_flush>
+  801882:	89 c6                	mov    %eax,%esi
+  801884:	83 c4 10             	add    $0x10,%esp
+  801887:	85 c0                	test   %eax,%eax
+  801889:	0f 88 1f ff ff ff    	js     8017ae <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  80188f:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801894:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801897:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801899:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  80189f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a2:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  8018a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a8:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8018ab:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  8018ae:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8018b3:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8018b5:	52                   	push   %edx
+  8018b6:	50                   	push   %eax
+  8018b7:	68 37 13 80 00       	push   $0x801337
+  8018bc:	e8 cc f8 ff ff       	call   80118d <sys_exofork_shared>
+  8018c1:	89 c6                	mov    %eax,%esi
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	0f 88 e0 fe ff ff    	js     8017ae <sfork+0x5f>
+	thread_ids[i] = id;
+  8018ce:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  8018d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018da:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8018e0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018e5:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  8018ec:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  8018f3:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8018f6:	83 ec 08             	sub    $0x8,%esp
+  8018f9:	6a 02                	push   $0x2
+  8018fb:	56                   	push   %esi
+  8018fc:	e8 12 f5 ff ff       	call   800e13 <sys_env_set_status>
+  801901:	89 c3                	mov    %eax,%ebx
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	0f 89 a0 fe ff ff    	jns    8017ae <sfork+0x5f>
+		sys_env_destroy(id);
+  80190e:	83 ec 0c             	sub    $0xc,%esp
+  801911:	56                   	push   %esi
+  801912:	e8 b6 f3 ff ff       	call   800ccd <sys_env_destroy>
+		goto out;
+  801917:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  80191a:	89 de                	mov    %ebx,%esi
+		goto out;
+  80191c:	e9 8d fe ff ff       	jmp    8017ae <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801921:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801926:	e9 83 fe ff ff       	jmp    8017ae <sfork+0x5f>
+
+0080192b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80192b:	55                   	push   %ebp
+  80192c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80192e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801931:	05 00 00 00 30       	add    $0x30000000,%eax
+  801936:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801939:	5d                   	pop    %ebp
+  80193a:	c3                   	ret
+
+0080193b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80193e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801941:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801946:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80194b:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801950:	5d                   	pop    %ebp
+  801951:	c3                   	ret
+
+00801952 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801952:	55                   	push   %ebp
+  801953:	89 e5                	mov    %esp,%ebp
+  801955:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80195a:	89 c2                	mov    %eax,%edx
+  80195c:	c1 ea 16             	shr    $0x16,%edx
+  80195f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801966:	f6 c2 01             	test   $0x1,%dl
+  801969:	74 29                	je     801994 <fd_alloc+0x42>
+  80196b:	89 c2                	mov    %eax,%edx
+  80196d:	c1 ea 0c             	shr    $0xc,%edx
+  801970:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801977:	f6 c2 01             	test   $0x1,%dl
+  80197a:	74 18                	je     801994 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80197c:	05 00 10 00 00       	add    $0x1000,%eax
+  801981:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801986:	75 d2                	jne    80195a <fd_alloc+0x8>
+  801988:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80198d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801992:	eb 05                	jmp    801999 <fd_alloc+0x47>
+			return 0;
+  801994:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801999:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199c:	89 02                	mov    %eax,(%edx)
+}
+  80199e:	89 c8                	mov    %ecx,%eax
+  8019a0:	5d                   	pop    %ebp
+  8019a1:	c3                   	ret
+
+008019a2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019a2:	55                   	push   %ebp
+  8019a3:	89 e5                	mov    %esp,%ebp
+  8019a5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019a8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8019ad:	77 30                	ja     8019df <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019af:	c1 e0 0c             	shl    $0xc,%eax
+  8019b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8019b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019bd:	f6 c2 01             	test   $0x1,%dl
+  8019c0:	74 24                	je     8019e6 <fd_lookup+0x44>
+  8019c2:	89 c2                	mov    %eax,%edx
+  8019c4:	c1 ea 0c             	shr    $0xc,%edx
+  8019c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019ce:	f6 c2 01             	test   $0x1,%dl
+  8019d1:	74 1a                	je     8019ed <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019d6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019dd:	5d                   	pop    %ebp
+  8019de:	c3                   	ret
+		return -E_INVAL;
+  8019df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e4:	eb f7                	jmp    8019dd <fd_lookup+0x3b>
+		return -E_INVAL;
+  8019e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019eb:	eb f0                	jmp    8019dd <fd_lookup+0x3b>
+  8019ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f2:	eb e9                	jmp    8019dd <fd_lookup+0x3b>
+
+008019f4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019f4:	55                   	push   %ebp
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	53                   	push   %ebx
+  8019f8:	83 ec 04             	sub    $0x4,%esp
+  8019fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a03:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801a08:	39 13                	cmp    %edx,(%ebx)
+  801a0a:	74 54                	je     801a60 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801a0c:	83 c0 01             	add    $0x1,%eax
+  801a0f:	8b 1c 85 8c 49 80 00 	mov    0x80498c(,%eax,4),%ebx
+  801a16:	85 db                	test   %ebx,%ebx
+  801a18:	75 ee                	jne    801a08 <dev_lookup+0x14>
+  801a1a:	89 e1                	mov    %esp,%ecx
+  801a1c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a21:	29 c8                	sub    %ecx,%eax
+  801a23:	89 c1                	mov    %eax,%ecx
+  801a25:	c1 e9 0f             	shr    $0xf,%ecx
+  801a28:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a32:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a35:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a3c:	8b 40 48             	mov    0x48(%eax),%eax
+  801a3f:	83 ec 04             	sub    $0x4,%esp
+  801a42:	52                   	push   %edx
+  801a43:	50                   	push   %eax
+  801a44:	68 10 49 80 00       	push   $0x804910
+  801a49:	e8 d3 e7 ff ff       	call   800221 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a59:	89 1a                	mov    %ebx,(%edx)
+}
+  801a5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a5e:	c9                   	leave
+  801a5f:	c3                   	ret
+			return 0;
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a65:	eb ef                	jmp    801a56 <dev_lookup+0x62>
+
+00801a67 <fd_close>:
+{
+  801a67:	55                   	push   %ebp
+  801a68:	89 e5                	mov    %esp,%ebp
+  801a6a:	57                   	push   %edi
+  801a6b:	56                   	push   %esi
+  801a6c:	53                   	push   %ebx
+  801a6d:	83 ec 24             	sub    $0x24,%esp
+  801a70:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a73:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a76:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a79:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a7a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a80:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a83:	50                   	push   %eax
+  801a84:	e8 19 ff ff ff       	call   8019a2 <fd_lookup>
+  801a89:	89 c3                	mov    %eax,%ebx
+  801a8b:	83 c4 10             	add    $0x10,%esp
+  801a8e:	85 c0                	test   %eax,%eax
+  801a90:	78 05                	js     801a97 <fd_close+0x30>
+	    || fd != fd2)
+  801a92:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a95:	74 0f                	je     801aa6 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801a97:	85 ff                	test   %edi,%edi
+  801a99:	0f 44 df             	cmove  %edi,%ebx
+}
+  801a9c:	89 d8                	mov    %ebx,%eax
+  801a9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa1:	5b                   	pop    %ebx
+  801aa2:	5e                   	pop    %esi
+  801aa3:	5f                   	pop    %edi
+  801aa4:	5d                   	pop    %ebp
+  801aa5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801aa6:	83 ec 08             	sub    $0x8,%esp
+  801aa9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801aac:	50                   	push   %eax
+  801aad:	ff 36                	push   (%esi)
+  801aaf:	e8 40 ff ff ff       	call   8019f4 <dev_lookup>
+  801ab4:	89 c3                	mov    %eax,%ebx
+  801ab6:	83 c4 10             	add    $0x10,%esp
+  801ab9:	85 c0                	test   %eax,%eax
+  801abb:	78 1a                	js     801ad7 <fd_close+0x70>
+		if (dev->dev_close)
+  801abd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ac0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ac3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	74 0b                	je     801ad7 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801acc:	83 ec 0c             	sub    $0xc,%esp
+  801acf:	56                   	push   %esi
+  801ad0:	ff d0                	call   *%eax
+  801ad2:	89 c3                	mov    %eax,%ebx
+  801ad4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ad7:	83 ec 08             	sub    $0x8,%esp
+  801ada:	56                   	push   %esi
+  801adb:	6a 00                	push   $0x0
+  801add:	e8 ef f2 ff ff       	call   800dd1 <sys_page_unmap>
+	return r;
+  801ae2:	83 c4 10             	add    $0x10,%esp
+  801ae5:	eb b5                	jmp    801a9c <fd_close+0x35>
+
+00801ae7 <close>:
+
+int
+close(int fdnum)
+{
+  801ae7:	55                   	push   %ebp
+  801ae8:	89 e5                	mov    %esp,%ebp
+  801aea:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801aed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af0:	50                   	push   %eax
+  801af1:	ff 75 08             	push   0x8(%ebp)
+  801af4:	e8 a9 fe ff ff       	call   8019a2 <fd_lookup>
+  801af9:	83 c4 10             	add    $0x10,%esp
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	79 02                	jns    801b02 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b00:	c9                   	leave
+  801b01:	c3                   	ret
+		return fd_close(fd, 1);
+  801b02:	83 ec 08             	sub    $0x8,%esp
+  801b05:	6a 01                	push   $0x1
+  801b07:	ff 75 f4             	push   -0xc(%ebp)
+  801b0a:	e8 58 ff ff ff       	call   801a67 <fd_close>
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	eb ec                	jmp    801b00 <close+0x19>
+
+00801b14 <close_all>:
+
+void
+close_all(void)
+{
+  801b14:	55                   	push   %ebp
+  801b15:	89 e5                	mov    %esp,%ebp
+  801b17:	53                   	push   %ebx
+  801b18:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b20:	83 ec 0c             	sub    $0xc,%esp
+  801b23:	53                   	push   %ebx
+  801b24:	e8 be ff ff ff       	call   801ae7 <close>
+	for (i = 0; i < MAXFD; i++)
+  801b29:	83 c3 01             	add    $0x1,%ebx
+  801b2c:	83 c4 10             	add    $0x10,%esp
+  801b2f:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801b35:	75 e9                	jne    801b20 <close_all+0xc>
+}
+  801b37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+
+00801b3c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b3c:	55                   	push   %ebp
+  801b3d:	89 e5                	mov    %esp,%ebp
+  801b3f:	57                   	push   %edi
+  801b40:	56                   	push   %esi
+  801b41:	53                   	push   %ebx
+  801b42:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b45:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b48:	50                   	push   %eax
+  801b49:	ff 75 08             	push   0x8(%ebp)
+  801b4c:	e8 51 fe ff ff       	call   8019a2 <fd_lookup>
+  801b51:	89 c3                	mov    %eax,%ebx
+  801b53:	83 c4 10             	add    $0x10,%esp
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 7f                	js     801bd9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b5a:	83 ec 0c             	sub    $0xc,%esp
+  801b5d:	ff 75 0c             	push   0xc(%ebp)
+  801b60:	e8 82 ff ff ff       	call   801ae7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b65:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b68:	c1 e6 0c             	shl    $0xc,%esi
+  801b6b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b71:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b74:	89 3c 24             	mov    %edi,(%esp)
+  801b77:	e8 bf fd ff ff       	call   80193b <fd2data>
+  801b7c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b7e:	89 34 24             	mov    %esi,(%esp)
+  801b81:	e8 b5 fd ff ff       	call   80193b <fd2data>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801b8c:	89 d8                	mov    %ebx,%eax
+  801b8e:	c1 e8 16             	shr    $0x16,%eax
+  801b91:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b98:	a8 01                	test   $0x1,%al
+  801b9a:	74 11                	je     801bad <dup+0x71>
+  801b9c:	89 d8                	mov    %ebx,%eax
+  801b9e:	c1 e8 0c             	shr    $0xc,%eax
+  801ba1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ba8:	f6 c2 01             	test   $0x1,%dl
+  801bab:	75 36                	jne    801be3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bad:	89 f8                	mov    %edi,%eax
+  801baf:	c1 e8 0c             	shr    $0xc,%eax
+  801bb2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bc1:	50                   	push   %eax
+  801bc2:	56                   	push   %esi
+  801bc3:	6a 00                	push   $0x0
+  801bc5:	57                   	push   %edi
+  801bc6:	6a 00                	push   $0x0
+  801bc8:	e8 c2 f1 ff ff       	call   800d8f <sys_page_map>
+  801bcd:	89 c3                	mov    %eax,%ebx
+  801bcf:	83 c4 20             	add    $0x20,%esp
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 33                	js     801c09 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bd6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bd9:	89 d8                	mov    %ebx,%eax
+  801bdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bde:	5b                   	pop    %ebx
+  801bdf:	5e                   	pop    %esi
+  801be0:	5f                   	pop    %edi
+  801be1:	5d                   	pop    %ebp
+  801be2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801be3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bea:	83 ec 0c             	sub    $0xc,%esp
+  801bed:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bf2:	50                   	push   %eax
+  801bf3:	ff 75 d4             	push   -0x2c(%ebp)
+  801bf6:	6a 00                	push   $0x0
+  801bf8:	53                   	push   %ebx
+  801bf9:	6a 00                	push   $0x0
+  801bfb:	e8 8f f1 ff ff       	call   800d8f <sys_page_map>
+  801c00:	89 c3                	mov    %eax,%ebx
+  801c02:	83 c4 20             	add    $0x20,%esp
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	79 a4                	jns    801bad <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c09:	83 ec 08             	sub    $0x8,%esp
+  801c0c:	56                   	push   %esi
+  801c0d:	6a 00                	push   $0x0
+  801c0f:	e8 bd f1 ff ff       	call   800dd1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c14:	83 c4 08             	add    $0x8,%esp
+  801c17:	ff 75 d4             	push   -0x2c(%ebp)
+  801c1a:	6a 00                	push   $0x0
+  801c1c:	e8 b0 f1 ff ff       	call   800dd1 <sys_page_unmap>
+	return r;
+  801c21:	83 c4 10             	add    $0x10,%esp
+  801c24:	eb b3                	jmp    801bd9 <dup+0x9d>
+
+00801c26 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	83 ec 18             	sub    $0x18,%esp
+  801c2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c31:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c34:	50                   	push   %eax
+  801c35:	53                   	push   %ebx
+  801c36:	e8 67 fd ff ff       	call   8019a2 <fd_lookup>
+  801c3b:	83 c4 10             	add    $0x10,%esp
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	78 3c                	js     801c7e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c42:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c45:	83 ec 08             	sub    $0x8,%esp
+  801c48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4b:	50                   	push   %eax
+  801c4c:	ff 36                	push   (%esi)
+  801c4e:	e8 a1 fd ff ff       	call   8019f4 <dev_lookup>
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	85 c0                	test   %eax,%eax
+  801c58:	78 24                	js     801c7e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c5a:	8b 46 08             	mov    0x8(%esi),%eax
+  801c5d:	83 e0 03             	and    $0x3,%eax
+  801c60:	83 f8 01             	cmp    $0x1,%eax
+  801c63:	74 20                	je     801c85 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c68:	8b 40 08             	mov    0x8(%eax),%eax
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	74 54                	je     801cc3 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c6f:	83 ec 04             	sub    $0x4,%esp
+  801c72:	ff 75 10             	push   0x10(%ebp)
+  801c75:	ff 75 0c             	push   0xc(%ebp)
+  801c78:	56                   	push   %esi
+  801c79:	ff d0                	call   *%eax
+  801c7b:	83 c4 10             	add    $0x10,%esp
+}
+  801c7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c81:	5b                   	pop    %ebx
+  801c82:	5e                   	pop    %esi
+  801c83:	5d                   	pop    %ebp
+  801c84:	c3                   	ret
+  801c85:	89 e2                	mov    %esp,%edx
+  801c87:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c8c:	29 d0                	sub    %edx,%eax
+  801c8e:	89 c2                	mov    %eax,%edx
+  801c90:	c1 ea 0f             	shr    $0xf,%edx
+  801c93:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9d:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ca0:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ca7:	8b 40 48             	mov    0x48(%eax),%eax
+  801caa:	83 ec 04             	sub    $0x4,%esp
+  801cad:	53                   	push   %ebx
+  801cae:	50                   	push   %eax
+  801caf:	68 51 49 80 00       	push   $0x804951
+  801cb4:	e8 68 e5 ff ff       	call   800221 <cprintf>
+		return -E_INVAL;
+  801cb9:	83 c4 10             	add    $0x10,%esp
+  801cbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cc1:	eb bb                	jmp    801c7e <read+0x58>
+		return -E_NOT_SUPP;
+  801cc3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cc8:	eb b4                	jmp    801c7e <read+0x58>
+
+00801cca <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801cca:	55                   	push   %ebp
+  801ccb:	89 e5                	mov    %esp,%ebp
+  801ccd:	57                   	push   %edi
+  801cce:	56                   	push   %esi
+  801ccf:	53                   	push   %ebx
+  801cd0:	83 ec 0c             	sub    $0xc,%esp
+  801cd3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801cd6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801cd9:	85 f6                	test   %esi,%esi
+  801cdb:	74 30                	je     801d0d <readn+0x43>
+  801cdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ce7:	83 ec 04             	sub    $0x4,%esp
+  801cea:	89 f2                	mov    %esi,%edx
+  801cec:	29 c2                	sub    %eax,%edx
+  801cee:	52                   	push   %edx
+  801cef:	01 f8                	add    %edi,%eax
+  801cf1:	50                   	push   %eax
+  801cf2:	ff 75 08             	push   0x8(%ebp)
+  801cf5:	e8 2c ff ff ff       	call   801c26 <read>
+		if (m < 0)
+  801cfa:	83 c4 10             	add    $0x10,%esp
+  801cfd:	85 c0                	test   %eax,%eax
+  801cff:	78 15                	js     801d16 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801d01:	74 11                	je     801d14 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801d03:	01 c3                	add    %eax,%ebx
+  801d05:	89 d8                	mov    %ebx,%eax
+  801d07:	39 f3                	cmp    %esi,%ebx
+  801d09:	72 dc                	jb     801ce7 <readn+0x1d>
+  801d0b:	eb 09                	jmp    801d16 <readn+0x4c>
+  801d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d12:	eb 02                	jmp    801d16 <readn+0x4c>
+  801d14:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801d16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d19:	5b                   	pop    %ebx
+  801d1a:	5e                   	pop    %esi
+  801d1b:	5f                   	pop    %edi
+  801d1c:	5d                   	pop    %ebp
+  801d1d:	c3                   	ret
+
+00801d1e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d1e:	55                   	push   %ebp
+  801d1f:	89 e5                	mov    %esp,%ebp
+  801d21:	56                   	push   %esi
+  801d22:	53                   	push   %ebx
+  801d23:	83 ec 18             	sub    $0x18,%esp
+  801d26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d29:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d2c:	50                   	push   %eax
+  801d2d:	53                   	push   %ebx
+  801d2e:	e8 6f fc ff ff       	call   8019a2 <fd_lookup>
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 37                	js     801d71 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d3a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d3d:	83 ec 08             	sub    $0x8,%esp
+  801d40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d43:	50                   	push   %eax
+  801d44:	ff 36                	push   (%esi)
+  801d46:	e8 a9 fc ff ff       	call   8019f4 <dev_lookup>
+  801d4b:	83 c4 10             	add    $0x10,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 1f                	js     801d71 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d52:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d56:	74 20                	je     801d78 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	74 54                	je     801db6 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d62:	83 ec 04             	sub    $0x4,%esp
+  801d65:	ff 75 10             	push   0x10(%ebp)
+  801d68:	ff 75 0c             	push   0xc(%ebp)
+  801d6b:	56                   	push   %esi
+  801d6c:	ff d0                	call   *%eax
+  801d6e:	83 c4 10             	add    $0x10,%esp
+}
+  801d71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d74:	5b                   	pop    %ebx
+  801d75:	5e                   	pop    %esi
+  801d76:	5d                   	pop    %ebp
+  801d77:	c3                   	ret
+  801d78:	89 e2                	mov    %esp,%edx
+  801d7a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d7f:	29 d0                	sub    %edx,%eax
+  801d81:	89 c2                	mov    %eax,%edx
+  801d83:	c1 ea 0f             	shr    $0xf,%edx
+  801d86:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d90:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d93:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801d9a:	8b 40 48             	mov    0x48(%eax),%eax
+  801d9d:	83 ec 04             	sub    $0x4,%esp
+  801da0:	53                   	push   %ebx
+  801da1:	50                   	push   %eax
+  801da2:	68 6d 49 80 00       	push   $0x80496d
+  801da7:	e8 75 e4 ff ff       	call   800221 <cprintf>
+		return -E_INVAL;
+  801dac:	83 c4 10             	add    $0x10,%esp
+  801daf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801db4:	eb bb                	jmp    801d71 <write+0x53>
+		return -E_NOT_SUPP;
+  801db6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dbb:	eb b4                	jmp    801d71 <write+0x53>
+
+00801dbd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc6:	50                   	push   %eax
+  801dc7:	ff 75 08             	push   0x8(%ebp)
+  801dca:	e8 d3 fb ff ff       	call   8019a2 <fd_lookup>
+  801dcf:	83 c4 10             	add    $0x10,%esp
+  801dd2:	85 c0                	test   %eax,%eax
+  801dd4:	78 0e                	js     801de4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801dd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ddc:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de4:	c9                   	leave
+  801de5:	c3                   	ret
+
+00801de6 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801de6:	55                   	push   %ebp
+  801de7:	89 e5                	mov    %esp,%ebp
+  801de9:	53                   	push   %ebx
+  801dea:	83 ec 1c             	sub    $0x1c,%esp
+  801ded:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801df0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df3:	50                   	push   %eax
+  801df4:	ff 75 08             	push   0x8(%ebp)
+  801df7:	e8 a6 fb ff ff       	call   8019a2 <fd_lookup>
+  801dfc:	83 c4 10             	add    $0x10,%esp
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	78 33                	js     801e36 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801e03:	83 fb 03             	cmp    $0x3,%ebx
+  801e06:	74 28                	je     801e30 <fcntl+0x4a>
+  801e08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e0d:	83 fb 04             	cmp    $0x4,%ebx
+  801e10:	75 24                	jne    801e36 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801e12:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801e15:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e18:	80 e4 ef             	and    $0xef,%ah
+  801e1b:	8b 55 10             	mov    0x10(%ebp),%edx
+  801e1e:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801e24:	09 d0                	or     %edx,%eax
+  801e26:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2e:	eb 06                	jmp    801e36 <fcntl+0x50>
+		return fd->fd_omode;
+  801e30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e33:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801e36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e39:	c9                   	leave
+  801e3a:	c3                   	ret
+
+00801e3b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e3b:	55                   	push   %ebp
+  801e3c:	89 e5                	mov    %esp,%ebp
+  801e3e:	56                   	push   %esi
+  801e3f:	53                   	push   %ebx
+  801e40:	83 ec 18             	sub    $0x18,%esp
+  801e43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e46:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e49:	50                   	push   %eax
+  801e4a:	53                   	push   %ebx
+  801e4b:	e8 52 fb ff ff       	call   8019a2 <fd_lookup>
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	78 34                	js     801e8b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e57:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e5a:	83 ec 08             	sub    $0x8,%esp
+  801e5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e60:	50                   	push   %eax
+  801e61:	ff 36                	push   (%esi)
+  801e63:	e8 8c fb ff ff       	call   8019f4 <dev_lookup>
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 1c                	js     801e8b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e6f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e73:	74 1d                	je     801e92 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e78:	8b 40 18             	mov    0x18(%eax),%eax
+  801e7b:	85 c0                	test   %eax,%eax
+  801e7d:	74 51                	je     801ed0 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e7f:	83 ec 08             	sub    $0x8,%esp
+  801e82:	ff 75 0c             	push   0xc(%ebp)
+  801e85:	56                   	push   %esi
+  801e86:	ff d0                	call   *%eax
+  801e88:	83 c4 10             	add    $0x10,%esp
+}
+  801e8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8e:	5b                   	pop    %ebx
+  801e8f:	5e                   	pop    %esi
+  801e90:	5d                   	pop    %ebp
+  801e91:	c3                   	ret
+  801e92:	89 e2                	mov    %esp,%edx
+  801e94:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e99:	29 d0                	sub    %edx,%eax
+  801e9b:	89 c2                	mov    %eax,%edx
+  801e9d:	c1 ea 0f             	shr    $0xf,%edx
+  801ea0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eaa:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801ead:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801eb4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eb7:	83 ec 04             	sub    $0x4,%esp
+  801eba:	53                   	push   %ebx
+  801ebb:	50                   	push   %eax
+  801ebc:	68 30 49 80 00       	push   $0x804930
+  801ec1:	e8 5b e3 ff ff       	call   800221 <cprintf>
+		return -E_INVAL;
+  801ec6:	83 c4 10             	add    $0x10,%esp
+  801ec9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ece:	eb bb                	jmp    801e8b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ed0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ed5:	eb b4                	jmp    801e8b <ftruncate+0x50>
+
+00801ed7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+  801eda:	56                   	push   %esi
+  801edb:	53                   	push   %ebx
+  801edc:	83 ec 18             	sub    $0x18,%esp
+  801edf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ee2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ee5:	50                   	push   %eax
+  801ee6:	ff 75 08             	push   0x8(%ebp)
+  801ee9:	e8 b4 fa ff ff       	call   8019a2 <fd_lookup>
+  801eee:	83 c4 10             	add    $0x10,%esp
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 53                	js     801f48 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ef5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ef8:	83 ec 08             	sub    $0x8,%esp
+  801efb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801efe:	50                   	push   %eax
+  801eff:	ff 36                	push   (%esi)
+  801f01:	e8 ee fa ff ff       	call   8019f4 <dev_lookup>
+  801f06:	83 c4 10             	add    $0x10,%esp
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	78 3b                	js     801f48 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801f0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f10:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f14:	74 39                	je     801f4f <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f16:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f19:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f20:	00 00 00 
+	stat->st_isdir = 0;
+  801f23:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f2a:	00 00 00 
+	stat->st_version = 0;
+  801f2d:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801f34:	00 00 00 
+	stat->st_dev = dev;
+  801f37:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f3d:	83 ec 08             	sub    $0x8,%esp
+  801f40:	53                   	push   %ebx
+  801f41:	56                   	push   %esi
+  801f42:	ff 50 14             	call   *0x14(%eax)
+  801f45:	83 c4 10             	add    $0x10,%esp
+}
+  801f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4b:	5b                   	pop    %ebx
+  801f4c:	5e                   	pop    %esi
+  801f4d:	5d                   	pop    %ebp
+  801f4e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f4f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f54:	eb f2                	jmp    801f48 <fstat+0x71>
+
+00801f56 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	56                   	push   %esi
+  801f5a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f5b:	83 ec 08             	sub    $0x8,%esp
+  801f5e:	6a 00                	push   $0x0
+  801f60:	ff 75 08             	push   0x8(%ebp)
+  801f63:	e8 b7 01 00 00       	call   80211f <open>
+  801f68:	89 c3                	mov    %eax,%ebx
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	78 1b                	js     801f8c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f71:	83 ec 08             	sub    $0x8,%esp
+  801f74:	ff 75 0c             	push   0xc(%ebp)
+  801f77:	50                   	push   %eax
+  801f78:	e8 5a ff ff ff       	call   801ed7 <fstat>
+  801f7d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f7f:	89 1c 24             	mov    %ebx,(%esp)
+  801f82:	e8 60 fb ff ff       	call   801ae7 <close>
+	return r;
+  801f87:	83 c4 10             	add    $0x10,%esp
+  801f8a:	89 f3                	mov    %esi,%ebx
+}
+  801f8c:	89 d8                	mov    %ebx,%eax
+  801f8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f91:	5b                   	pop    %ebx
+  801f92:	5e                   	pop    %esi
+  801f93:	5d                   	pop    %ebp
+  801f94:	c3                   	ret
+
+00801f95 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f95:	55                   	push   %ebp
+  801f96:	89 e5                	mov    %esp,%ebp
+  801f98:	56                   	push   %esi
+  801f99:	53                   	push   %ebx
+  801f9a:	89 c6                	mov    %eax,%esi
+  801f9c:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801f9e:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  801fa5:	74 27                	je     801fce <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fa7:	6a 07                	push   $0x7
+  801fa9:	68 00 70 80 00       	push   $0x807000
+  801fae:	56                   	push   %esi
+  801faf:	ff 35 c4 66 80 00    	push   0x8066c4
+  801fb5:	e8 06 22 00 00       	call   8041c0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801fba:	83 c4 0c             	add    $0xc,%esp
+  801fbd:	6a 00                	push   $0x0
+  801fbf:	53                   	push   %ebx
+  801fc0:	6a 00                	push   $0x0
+  801fc2:	e8 69 1f 00 00       	call   803f30 <ipc_recv>
+}
+  801fc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fca:	5b                   	pop    %ebx
+  801fcb:	5e                   	pop    %esi
+  801fcc:	5d                   	pop    %ebp
+  801fcd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fce:	83 ec 0c             	sub    $0xc,%esp
+  801fd1:	6a 02                	push   $0x2
+  801fd3:	e8 51 22 00 00       	call   804229 <ipc_find_env>
+  801fd8:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  801fdd:	83 c4 10             	add    $0x10,%esp
+  801fe0:	eb c5                	jmp    801fa7 <fsipc+0x12>
+
+00801fe2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801fe2:	55                   	push   %ebp
+  801fe3:	89 e5                	mov    %esp,%ebp
+  801fe5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fe8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801feb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fee:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801ff3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff6:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ffb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802000:	b8 02 00 00 00       	mov    $0x2,%eax
+  802005:	e8 8b ff ff ff       	call   801f95 <fsipc>
+}
+  80200a:	c9                   	leave
+  80200b:	c3                   	ret
+
+0080200c <devfile_flush>:
+{
+  80200c:	55                   	push   %ebp
+  80200d:	89 e5                	mov    %esp,%ebp
+  80200f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802012:	8b 45 08             	mov    0x8(%ebp),%eax
+  802015:	8b 40 0c             	mov    0xc(%eax),%eax
+  802018:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80201d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802022:	b8 06 00 00 00       	mov    $0x6,%eax
+  802027:	e8 69 ff ff ff       	call   801f95 <fsipc>
+}
+  80202c:	c9                   	leave
+  80202d:	c3                   	ret
+
+0080202e <devfile_stat>:
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	53                   	push   %ebx
+  802032:	83 ec 04             	sub    $0x4,%esp
+  802035:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802038:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80203e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802043:	ba 00 00 00 00       	mov    $0x0,%edx
+  802048:	b8 05 00 00 00       	mov    $0x5,%eax
+  80204d:	e8 43 ff ff ff       	call   801f95 <fsipc>
+  802052:	85 c0                	test   %eax,%eax
+  802054:	78 37                	js     80208d <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802056:	83 ec 08             	sub    $0x8,%esp
+  802059:	68 00 70 80 00       	push   $0x807000
+  80205e:	53                   	push   %ebx
+  80205f:	e8 b4 e8 ff ff       	call   800918 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802064:	a1 80 70 80 00       	mov    0x807080,%eax
+  802069:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80206f:	a1 84 70 80 00       	mov    0x807084,%eax
+  802074:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80207a:	a1 88 70 80 00       	mov    0x807088,%eax
+  80207f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802085:	83 c4 10             	add    $0x10,%esp
+  802088:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80208d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802090:	c9                   	leave
+  802091:	c3                   	ret
+
+00802092 <devfile_write>:
+{
+  802092:	55                   	push   %ebp
+  802093:	89 e5                	mov    %esp,%ebp
+  802095:	83 ec 0c             	sub    $0xc,%esp
+  802098:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80209b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8020a0:	39 d0                	cmp    %edx,%eax
+  8020a2:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a8:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020ab:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8020b1:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8020b6:	50                   	push   %eax
+  8020b7:	ff 75 0c             	push   0xc(%ebp)
+  8020ba:	68 08 70 80 00       	push   $0x807008
+  8020bf:	e8 04 ea ff ff       	call   800ac8 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8020c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020ce:	e8 c2 fe ff ff       	call   801f95 <fsipc>
+}
+  8020d3:	c9                   	leave
+  8020d4:	c3                   	ret
+
+008020d5 <devfile_read>:
+{
+  8020d5:	55                   	push   %ebp
+  8020d6:	89 e5                	mov    %esp,%ebp
+  8020d8:	53                   	push   %ebx
+  8020d9:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020e2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8020e7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020ea:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8020ef:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8020f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020f9:	e8 97 fe ff ff       	call   801f95 <fsipc>
+  8020fe:	89 c3                	mov    %eax,%ebx
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 14                	js     802118 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802104:	83 ec 04             	sub    $0x4,%esp
+  802107:	50                   	push   %eax
+  802108:	68 00 70 80 00       	push   $0x807000
+  80210d:	ff 75 0c             	push   0xc(%ebp)
+  802110:	e8 b3 e9 ff ff       	call   800ac8 <memmove>
+	return r;
+  802115:	83 c4 10             	add    $0x10,%esp
+}
+  802118:	89 d8                	mov    %ebx,%eax
+  80211a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80211d:	c9                   	leave
+  80211e:	c3                   	ret
+
+0080211f <open>:
+{
+  80211f:	55                   	push   %ebp
+  802120:	89 e5                	mov    %esp,%ebp
+  802122:	53                   	push   %ebx
+  802123:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802126:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802129:	50                   	push   %eax
+  80212a:	e8 23 f8 ff ff       	call   801952 <fd_alloc>
+  80212f:	89 c3                	mov    %eax,%ebx
+  802131:	83 c4 10             	add    $0x10,%esp
+  802134:	85 c0                	test   %eax,%eax
+  802136:	78 2a                	js     802162 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802138:	83 ec 0c             	sub    $0xc,%esp
+  80213b:	ff 75 08             	push   0x8(%ebp)
+  80213e:	e8 89 e7 ff ff       	call   8008cc <strlen>
+  802143:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802146:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80214b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802150:	7e 17                	jle    802169 <open+0x4a>
+	fd_close(fd, 1);
+  802152:	83 ec 08             	sub    $0x8,%esp
+  802155:	6a 01                	push   $0x1
+  802157:	ff 75 f4             	push   -0xc(%ebp)
+  80215a:	e8 08 f9 ff ff       	call   801a67 <fd_close>
+	return r;
+  80215f:	83 c4 10             	add    $0x10,%esp
+}
+  802162:	89 d8                	mov    %ebx,%eax
+  802164:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802169:	83 ec 08             	sub    $0x8,%esp
+  80216c:	ff 75 08             	push   0x8(%ebp)
+  80216f:	68 00 70 80 00       	push   $0x807000
+  802174:	e8 9f e7 ff ff       	call   800918 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802179:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80217c:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802181:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802184:	b8 01 00 00 00       	mov    $0x1,%eax
+  802189:	e8 07 fe ff ff       	call   801f95 <fsipc>
+  80218e:	89 c3                	mov    %eax,%ebx
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	85 c0                	test   %eax,%eax
+  802195:	78 bb                	js     802152 <open+0x33>
+	return fd2num(fd); 	
+  802197:	83 ec 0c             	sub    $0xc,%esp
+  80219a:	ff 75 f4             	push   -0xc(%ebp)
+  80219d:	e8 89 f7 ff ff       	call   80192b <fd2num>
+  8021a2:	89 c3                	mov    %eax,%ebx
+  8021a4:	83 c4 10             	add    $0x10,%esp
+  8021a7:	eb b9                	jmp    802162 <open+0x43>
+
+008021a9 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8021a9:	55                   	push   %ebp
+  8021aa:	89 e5                	mov    %esp,%ebp
+  8021ac:	53                   	push   %ebx
+  8021ad:	83 ec 1c             	sub    $0x1c,%esp
+  8021b0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b6:	50                   	push   %eax
+  8021b7:	ff 75 08             	push   0x8(%ebp)
+  8021ba:	e8 e3 f7 ff ff       	call   8019a2 <fd_lookup>
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 5a                	js     802220 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8021c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c9:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8021cf:	39 10                	cmp    %edx,(%eax)
+  8021d1:	75 66                	jne    802239 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8021d3:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8021da:	74 49                	je     802225 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021e2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  8021e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021ea:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  8021ef:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8021f5:	6a 07                	push   $0x7
+  8021f7:	68 00 70 80 00       	push   $0x807000
+  8021fc:	6a 09                	push   $0x9
+  8021fe:	ff 35 c4 66 80 00    	push   0x8066c4
+  802204:	e8 b7 1f 00 00       	call   8041c0 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802209:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802210:	6a 00                	push   $0x0
+  802212:	53                   	push   %ebx
+  802213:	ff 75 10             	push   0x10(%ebp)
+  802216:	6a 00                	push   $0x0
+  802218:	e8 e0 1d 00 00       	call   803ffd <ipc_recv_pages>
+  80221d:	83 c4 20             	add    $0x20,%esp
+}
+  802220:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802223:	c9                   	leave
+  802224:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802225:	83 ec 0c             	sub    $0xc,%esp
+  802228:	6a 02                	push   $0x2
+  80222a:	e8 fa 1f 00 00       	call   804229 <ipc_find_env>
+  80222f:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	eb a3                	jmp    8021dc <fmap+0x33>
+		return -E_INVAL;
+  802239:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80223e:	eb e0                	jmp    802220 <fmap+0x77>
+
+00802240 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	53                   	push   %ebx
+  802244:	83 ec 10             	sub    $0x10,%esp
+  802247:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80224a:	53                   	push   %ebx
+  80224b:	e8 7c e6 ff ff       	call   8008cc <strlen>
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802258:	7f 25                	jg     80227f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80225a:	83 ec 08             	sub    $0x8,%esp
+  80225d:	53                   	push   %ebx
+  80225e:	68 00 70 80 00       	push   $0x807000
+  802263:	e8 b0 e6 ff ff       	call   800918 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802268:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802272:	e8 1e fd ff ff       	call   801f95 <fsipc>
+  802277:	83 c4 10             	add    $0x10,%esp
+}
+  80227a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+		return -E_BAD_PATH;
+  80227f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802284:	eb f4                	jmp    80227a <remove+0x3a>
+
+00802286 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802286:	55                   	push   %ebp
+  802287:	89 e5                	mov    %esp,%ebp
+  802289:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80228c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802291:	b8 08 00 00 00       	mov    $0x8,%eax
+  802296:	e8 fa fc ff ff       	call   801f95 <fsipc>
+}
+  80229b:	c9                   	leave
+  80229c:	c3                   	ret
+
+0080229d <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80229d:	55                   	push   %ebp
+  80229e:	89 e5                	mov    %esp,%ebp
+  8022a0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8022a3:	68 a0 49 80 00       	push   $0x8049a0
+  8022a8:	ff 75 0c             	push   0xc(%ebp)
+  8022ab:	e8 68 e6 ff ff       	call   800918 <strcpy>
+	return 0;
+}
+  8022b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b5:	c9                   	leave
+  8022b6:	c3                   	ret
+
+008022b7 <devsock_close>:
+{
+  8022b7:	55                   	push   %ebp
+  8022b8:	89 e5                	mov    %esp,%ebp
+  8022ba:	53                   	push   %ebx
+  8022bb:	83 ec 10             	sub    $0x10,%esp
+  8022be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8022c1:	53                   	push   %ebx
+  8022c2:	e8 a1 1f 00 00       	call   804268 <pageref>
+  8022c7:	89 c2                	mov    %eax,%edx
+  8022c9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8022cc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8022d1:	83 fa 01             	cmp    $0x1,%edx
+  8022d4:	74 05                	je     8022db <devsock_close+0x24>
+}
+  8022d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d9:	c9                   	leave
+  8022da:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	ff 73 0c             	push   0xc(%ebx)
+  8022e1:	e8 b0 05 00 00       	call   802896 <nsipc_close>
+  8022e6:	83 c4 10             	add    $0x10,%esp
+  8022e9:	eb eb                	jmp    8022d6 <devsock_close+0x1f>
+
+008022eb <devsock_write>:
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	53                   	push   %ebx
+  8022ef:	83 ec 14             	sub    $0x14,%esp
+  8022f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022f8:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8022fb:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8022fe:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802301:	8b 41 08             	mov    0x8(%ecx),%eax
+  802304:	c1 f8 09             	sar    $0x9,%eax
+  802307:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80230a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802310:	77 13                	ja     802325 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802312:	50                   	push   %eax
+  802313:	52                   	push   %edx
+  802314:	53                   	push   %ebx
+  802315:	ff 71 0c             	push   0xc(%ecx)
+  802318:	e8 5c 06 00 00       	call   802979 <nsipc_send>
+  80231d:	83 c4 10             	add    $0x10,%esp
+}
+  802320:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802323:	c9                   	leave
+  802324:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802325:	50                   	push   %eax
+  802326:	6a 01                	push   $0x1
+  802328:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80232b:	50                   	push   %eax
+  80232c:	ff 71 0c             	push   0xc(%ecx)
+  80232f:	e8 a6 06 00 00       	call   8029da <nsipc_sendmsg>
+  802334:	83 c4 10             	add    $0x10,%esp
+  802337:	eb e7                	jmp    802320 <devsock_write+0x35>
+
+00802339 <devsock_read>:
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	53                   	push   %ebx
+  80233d:	83 ec 14             	sub    $0x14,%esp
+  802340:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802343:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802346:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802349:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80234c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80234f:	8b 41 08             	mov    0x8(%ecx),%eax
+  802352:	c1 f8 09             	sar    $0x9,%eax
+  802355:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802358:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80235e:	77 13                	ja     802373 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802360:	50                   	push   %eax
+  802361:	52                   	push   %edx
+  802362:	53                   	push   %ebx
+  802363:	ff 71 0c             	push   0xc(%ecx)
+  802366:	e8 9c 05 00 00       	call   802907 <nsipc_recv>
+  80236b:	83 c4 10             	add    $0x10,%esp
+}
+  80236e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802371:	c9                   	leave
+  802372:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802373:	50                   	push   %eax
+  802374:	6a 01                	push   $0x1
+  802376:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802379:	50                   	push   %eax
+  80237a:	ff 71 0c             	push   0xc(%ecx)
+  80237d:	e8 02 0a 00 00       	call   802d84 <nsipc_recvmsg>
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	eb e7                	jmp    80236e <devsock_read+0x35>
+
+00802387 <fd2sockid>:
+{
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80238d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802390:	52                   	push   %edx
+  802391:	50                   	push   %eax
+  802392:	e8 0b f6 ff ff       	call   8019a2 <fd_lookup>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 10                	js     8023ae <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80239e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a1:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8023a7:	39 08                	cmp    %ecx,(%eax)
+  8023a9:	75 05                	jne    8023b0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8023ab:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023b5:	eb f7                	jmp    8023ae <fd2sockid+0x27>
+
+008023b7 <sock_flags>:
+{
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8023bd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023c0:	52                   	push   %edx
+  8023c1:	50                   	push   %eax
+  8023c2:	e8 db f5 ff ff       	call   8019a2 <fd_lookup>
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	85 c0                	test   %eax,%eax
+  8023cc:	78 0e                	js     8023dc <sock_flags+0x25>
+  8023ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d1:	8b 40 08             	mov    0x8(%eax),%eax
+  8023d4:	c1 e8 09             	shr    $0x9,%eax
+  8023d7:	83 e0 08             	and    $0x8,%eax
+}
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+		return 0;
+  8023dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e1:	eb f7                	jmp    8023da <sock_flags+0x23>
+
+008023e3 <alloc_sockfd>:
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	56                   	push   %esi
+  8023e7:	53                   	push   %ebx
+  8023e8:	83 ec 1c             	sub    $0x1c,%esp
+  8023eb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8023ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023f0:	50                   	push   %eax
+  8023f1:	e8 5c f5 ff ff       	call   801952 <fd_alloc>
+  8023f6:	89 c3                	mov    %eax,%ebx
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	78 43                	js     802442 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8023ff:	83 ec 04             	sub    $0x4,%esp
+  802402:	68 07 04 00 00       	push   $0x407
+  802407:	ff 75 f4             	push   -0xc(%ebp)
+  80240a:	6a 00                	push   $0x0
+  80240c:	e8 3b e9 ff ff       	call   800d4c <sys_page_alloc>
+  802411:	89 c3                	mov    %eax,%ebx
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	85 c0                	test   %eax,%eax
+  802418:	78 28                	js     802442 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80241a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80241d:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802423:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802425:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802428:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80242f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802432:	83 ec 0c             	sub    $0xc,%esp
+  802435:	50                   	push   %eax
+  802436:	e8 f0 f4 ff ff       	call   80192b <fd2num>
+  80243b:	89 c3                	mov    %eax,%ebx
+  80243d:	83 c4 10             	add    $0x10,%esp
+  802440:	eb 0c                	jmp    80244e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802442:	83 ec 0c             	sub    $0xc,%esp
+  802445:	56                   	push   %esi
+  802446:	e8 4b 04 00 00       	call   802896 <nsipc_close>
+		return r;
+  80244b:	83 c4 10             	add    $0x10,%esp
+}
+  80244e:	89 d8                	mov    %ebx,%eax
+  802450:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802453:	5b                   	pop    %ebx
+  802454:	5e                   	pop    %esi
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+
+00802457 <accept>:
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	56                   	push   %esi
+  80245b:	53                   	push   %ebx
+  80245c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80245f:	89 f0                	mov    %esi,%eax
+  802461:	e8 21 ff ff ff       	call   802387 <fd2sockid>
+  802466:	89 c3                	mov    %eax,%ebx
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	78 24                	js     802490 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80246c:	89 f0                	mov    %esi,%eax
+  80246e:	e8 44 ff ff ff       	call   8023b7 <sock_flags>
+  802473:	50                   	push   %eax
+  802474:	ff 75 10             	push   0x10(%ebp)
+  802477:	ff 75 0c             	push   0xc(%ebp)
+  80247a:	53                   	push   %ebx
+  80247b:	e8 6b 03 00 00       	call   8027eb <nsipc_accept>
+  802480:	89 c3                	mov    %eax,%ebx
+  802482:	83 c4 10             	add    $0x10,%esp
+  802485:	85 c0                	test   %eax,%eax
+  802487:	78 07                	js     802490 <accept+0x39>
+	return alloc_sockfd(r);
+  802489:	e8 55 ff ff ff       	call   8023e3 <alloc_sockfd>
+  80248e:	89 c3                	mov    %eax,%ebx
+}
+  802490:	89 d8                	mov    %ebx,%eax
+  802492:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802495:	5b                   	pop    %ebx
+  802496:	5e                   	pop    %esi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+
+00802499 <bind>:
+{
+  802499:	55                   	push   %ebp
+  80249a:	89 e5                	mov    %esp,%ebp
+  80249c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80249f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a2:	e8 e0 fe ff ff       	call   802387 <fd2sockid>
+  8024a7:	85 c0                	test   %eax,%eax
+  8024a9:	78 12                	js     8024bd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8024ab:	83 ec 04             	sub    $0x4,%esp
+  8024ae:	ff 75 10             	push   0x10(%ebp)
+  8024b1:	ff 75 0c             	push   0xc(%ebp)
+  8024b4:	50                   	push   %eax
+  8024b5:	e8 85 03 00 00       	call   80283f <nsipc_bind>
+  8024ba:	83 c4 10             	add    $0x10,%esp
+}
+  8024bd:	c9                   	leave
+  8024be:	c3                   	ret
+
+008024bf <shutdown>:
+{
+  8024bf:	55                   	push   %ebp
+  8024c0:	89 e5                	mov    %esp,%ebp
+  8024c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c8:	e8 ba fe ff ff       	call   802387 <fd2sockid>
+  8024cd:	85 c0                	test   %eax,%eax
+  8024cf:	78 0f                	js     8024e0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8024d1:	83 ec 08             	sub    $0x8,%esp
+  8024d4:	ff 75 0c             	push   0xc(%ebp)
+  8024d7:	50                   	push   %eax
+  8024d8:	e8 97 03 00 00       	call   802874 <nsipc_shutdown>
+  8024dd:	83 c4 10             	add    $0x10,%esp
+}
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+
+008024e2 <connect>:
+{
+  8024e2:	55                   	push   %ebp
+  8024e3:	89 e5                	mov    %esp,%ebp
+  8024e5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024eb:	e8 97 fe ff ff       	call   802387 <fd2sockid>
+  8024f0:	85 c0                	test   %eax,%eax
+  8024f2:	78 12                	js     802506 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8024f4:	83 ec 04             	sub    $0x4,%esp
+  8024f7:	ff 75 10             	push   0x10(%ebp)
+  8024fa:	ff 75 0c             	push   0xc(%ebp)
+  8024fd:	50                   	push   %eax
+  8024fe:	e8 ad 03 00 00       	call   8028b0 <nsipc_connect>
+  802503:	83 c4 10             	add    $0x10,%esp
+}
+  802506:	c9                   	leave
+  802507:	c3                   	ret
+
+00802508 <listen>:
+{
+  802508:	55                   	push   %ebp
+  802509:	89 e5                	mov    %esp,%ebp
+  80250b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80250e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802511:	e8 71 fe ff ff       	call   802387 <fd2sockid>
+  802516:	85 c0                	test   %eax,%eax
+  802518:	78 0f                	js     802529 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80251a:	83 ec 08             	sub    $0x8,%esp
+  80251d:	ff 75 0c             	push   0xc(%ebp)
+  802520:	50                   	push   %eax
+  802521:	e8 bf 03 00 00       	call   8028e5 <nsipc_listen>
+  802526:	83 c4 10             	add    $0x10,%esp
+}
+  802529:	c9                   	leave
+  80252a:	c3                   	ret
+
+0080252b <sendmsg>:
+{
+  80252b:	55                   	push   %ebp
+  80252c:	89 e5                	mov    %esp,%ebp
+  80252e:	57                   	push   %edi
+  80252f:	56                   	push   %esi
+  802530:	53                   	push   %ebx
+  802531:	83 ec 0c             	sub    $0xc,%esp
+  802534:	8b 75 08             	mov    0x8(%ebp),%esi
+  802537:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80253a:	89 f0                	mov    %esi,%eax
+  80253c:	e8 46 fe ff ff       	call   802387 <fd2sockid>
+  802541:	89 c3                	mov    %eax,%ebx
+  802543:	85 c0                	test   %eax,%eax
+  802545:	78 1c                	js     802563 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802547:	89 f0                	mov    %esi,%eax
+  802549:	e8 69 fe ff ff       	call   8023b7 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80254e:	0b 45 10             	or     0x10(%ebp),%eax
+  802551:	50                   	push   %eax
+  802552:	ff 77 0c             	push   0xc(%edi)
+  802555:	ff 77 08             	push   0x8(%edi)
+  802558:	53                   	push   %ebx
+  802559:	e8 7c 04 00 00       	call   8029da <nsipc_sendmsg>
+  80255e:	89 c3                	mov    %eax,%ebx
+  802560:	83 c4 10             	add    $0x10,%esp
+}
+  802563:	89 d8                	mov    %ebx,%eax
+  802565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802568:	5b                   	pop    %ebx
+  802569:	5e                   	pop    %esi
+  80256a:	5f                   	pop    %edi
+  80256b:	5d                   	pop    %ebp
+  80256c:	c3                   	ret
+
+0080256d <recvmsg>:
+{
+  80256d:	55                   	push   %ebp
+  80256e:	89 e5                	mov    %esp,%ebp
+  802570:	57                   	push   %edi
+  802571:	56                   	push   %esi
+  802572:	53                   	push   %ebx
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802579:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80257c:	89 f8                	mov    %edi,%eax
+  80257e:	e8 04 fe ff ff       	call   802387 <fd2sockid>
+  802583:	89 c3                	mov    %eax,%ebx
+  802585:	85 c0                	test   %eax,%eax
+  802587:	78 2a                	js     8025b3 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802589:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802590:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802597:	89 f8                	mov    %edi,%eax
+  802599:	e8 19 fe ff ff       	call   8023b7 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80259e:	0b 45 10             	or     0x10(%ebp),%eax
+  8025a1:	50                   	push   %eax
+  8025a2:	ff 76 0c             	push   0xc(%esi)
+  8025a5:	ff 76 08             	push   0x8(%esi)
+  8025a8:	53                   	push   %ebx
+  8025a9:	e8 d6 07 00 00       	call   802d84 <nsipc_recvmsg>
+  8025ae:	89 c3                	mov    %eax,%ebx
+  8025b0:	83 c4 10             	add    $0x10,%esp
+}
+  8025b3:	89 d8                	mov    %ebx,%eax
+  8025b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b8:	5b                   	pop    %ebx
+  8025b9:	5e                   	pop    %esi
+  8025ba:	5f                   	pop    %edi
+  8025bb:	5d                   	pop    %ebp
+  8025bc:	c3                   	ret
+
+008025bd <sendfile>:
+{
+  8025bd:	55                   	push   %ebp
+  8025be:	89 e5                	mov    %esp,%ebp
+  8025c0:	56                   	push   %esi
+  8025c1:	53                   	push   %ebx
+  8025c2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8025c5:	89 f0                	mov    %esi,%eax
+  8025c7:	e8 bb fd ff ff       	call   802387 <fd2sockid>
+  8025cc:	89 c3                	mov    %eax,%ebx
+  8025ce:	85 c0                	test   %eax,%eax
+  8025d0:	78 1f                	js     8025f1 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8025d2:	89 f0                	mov    %esi,%eax
+  8025d4:	e8 de fd ff ff       	call   8023b7 <sock_flags>
+  8025d9:	83 ec 0c             	sub    $0xc,%esp
+  8025dc:	50                   	push   %eax
+  8025dd:	ff 75 14             	push   0x14(%ebp)
+  8025e0:	ff 75 10             	push   0x10(%ebp)
+  8025e3:	ff 75 0c             	push   0xc(%ebp)
+  8025e6:	53                   	push   %ebx
+  8025e7:	e8 64 06 00 00       	call   802c50 <nsipc_sendfile>
+  8025ec:	89 c3                	mov    %eax,%ebx
+  8025ee:	83 c4 20             	add    $0x20,%esp
+}
+  8025f1:	89 d8                	mov    %ebx,%eax
+  8025f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025f6:	5b                   	pop    %ebx
+  8025f7:	5e                   	pop    %esi
+  8025f8:	5d                   	pop    %ebp
+  8025f9:	c3                   	ret
+
+008025fa <evctl>:
+{
+  8025fa:	55                   	push   %ebp
+  8025fb:	89 e5                	mov    %esp,%ebp
+  8025fd:	53                   	push   %ebx
+  8025fe:	83 ec 04             	sub    $0x4,%esp
+  802601:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802604:	89 d8                	mov    %ebx,%eax
+  802606:	e8 7c fd ff ff       	call   802387 <fd2sockid>
+  80260b:	85 c0                	test   %eax,%eax
+  80260d:	78 10                	js     80261f <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80260f:	83 ec 04             	sub    $0x4,%esp
+  802612:	53                   	push   %ebx
+  802613:	ff 75 0c             	push   0xc(%ebp)
+  802616:	50                   	push   %eax
+  802617:	e8 d2 0b 00 00       	call   8031ee <nsipc_evctl>
+  80261c:	83 c4 10             	add    $0x10,%esp
+}
+  80261f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+
+00802624 <evwait>:
+{
+  802624:	55                   	push   %ebp
+  802625:	89 e5                	mov    %esp,%ebp
+  802627:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80262a:	ff 75 10             	push   0x10(%ebp)
+  80262d:	ff 75 0c             	push   0xc(%ebp)
+  802630:	ff 75 08             	push   0x8(%ebp)
+  802633:	e8 e0 0b 00 00       	call   803218 <nsipc_evwait>
+}
+  802638:	c9                   	leave
+  802639:	c3                   	ret
+
+0080263a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80263a:	55                   	push   %ebp
+  80263b:	89 e5                	mov    %esp,%ebp
+  80263d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802640:	ff 75 10             	push   0x10(%ebp)
+  802643:	ff 75 0c             	push   0xc(%ebp)
+  802646:	ff 75 08             	push   0x8(%ebp)
+  802649:	e8 31 0c 00 00       	call   80327f <nsipc_socket>
+  80264e:	83 c4 10             	add    $0x10,%esp
+  802651:	85 c0                	test   %eax,%eax
+  802653:	78 05                	js     80265a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802655:	e8 89 fd ff ff       	call   8023e3 <alloc_sockfd>
+}
+  80265a:	c9                   	leave
+  80265b:	c3                   	ret
+
+0080265c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80265c:	55                   	push   %ebp
+  80265d:	89 e5                	mov    %esp,%ebp
+  80265f:	53                   	push   %ebx
+  802660:	83 ec 04             	sub    $0x4,%esp
+  802663:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802665:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80266c:	74 26                	je     802694 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80266e:	6a 07                	push   $0x7
+  802670:	68 00 80 80 00       	push   $0x808000
+  802675:	53                   	push   %ebx
+  802676:	ff 35 e4 69 80 00    	push   0x8069e4
+  80267c:	e8 3f 1b 00 00       	call   8041c0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802681:	83 c4 0c             	add    $0xc,%esp
+  802684:	6a 00                	push   $0x0
+  802686:	6a 00                	push   $0x0
+  802688:	6a 00                	push   $0x0
+  80268a:	e8 a1 18 00 00       	call   803f30 <ipc_recv>
+}
+  80268f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802692:	c9                   	leave
+  802693:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802694:	83 ec 0c             	sub    $0xc,%esp
+  802697:	6a 03                	push   $0x3
+  802699:	e8 8b 1b 00 00       	call   804229 <ipc_find_env>
+  80269e:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	eb c6                	jmp    80266e <nsipc+0x12>
+
+008026a8 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8026a8:	55                   	push   %ebp
+  8026a9:	89 e5                	mov    %esp,%ebp
+  8026ab:	56                   	push   %esi
+  8026ac:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8026ad:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  8026b3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8026b8:	85 f6                	test   %esi,%esi
+  8026ba:	75 33                	jne    8026ef <nsbulk_map+0x47>
+  8026bc:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8026c1:	83 ec 04             	sub    $0x4,%esp
+  8026c4:	6a 07                	push   $0x7
+  8026c6:	53                   	push   %ebx
+  8026c7:	6a 00                	push   $0x0
+  8026c9:	e8 7e e6 ff ff       	call   800d4c <sys_page_alloc>
+  8026ce:	83 c4 10             	add    $0x10,%esp
+  8026d1:	85 c0                	test   %eax,%eax
+  8026d3:	78 1a                	js     8026ef <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8026d5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026db:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8026e1:	75 de                	jne    8026c1 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8026e3:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  8026ea:	00 00 00 
+	return 0;
+  8026ed:	89 f0                	mov    %esi,%eax
+}
+  8026ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026f2:	5b                   	pop    %ebx
+  8026f3:	5e                   	pop    %esi
+  8026f4:	5d                   	pop    %ebp
+  8026f5:	c3                   	ret
+
+008026f6 <nsbulk_own>:
+{
+  8026f6:	55                   	push   %ebp
+  8026f7:	89 e5                	mov    %esp,%ebp
+  8026f9:	57                   	push   %edi
+  8026fa:	56                   	push   %esi
+  8026fb:	53                   	push   %ebx
+  8026fc:	83 ec 0c             	sub    $0xc,%esp
+  8026ff:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802701:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802704:	85 d2                	test   %edx,%edx
+  802706:	7f 0e                	jg     802716 <nsbulk_own+0x20>
+	return 0;
+  802708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270d:	eb 47                	jmp    802756 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80270f:	83 c3 01             	add    $0x1,%ebx
+  802712:	39 fb                	cmp    %edi,%ebx
+  802714:	7d 3b                	jge    802751 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802716:	be 01 00 00 00       	mov    $0x1,%esi
+  80271b:	89 d9                	mov    %ebx,%ecx
+  80271d:	d3 e6                	shl    %cl,%esi
+  80271f:	89 f0                	mov    %esi,%eax
+  802721:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802727:	74 e6                	je     80270f <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802729:	83 ec 04             	sub    $0x4,%esp
+  80272c:	6a 07                	push   $0x7
+  80272e:	89 d8                	mov    %ebx,%eax
+  802730:	c1 e0 0c             	shl    $0xc,%eax
+  802733:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802738:	50                   	push   %eax
+  802739:	6a 00                	push   $0x0
+  80273b:	e8 0c e6 ff ff       	call   800d4c <sys_page_alloc>
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	85 c0                	test   %eax,%eax
+  802745:	78 0f                	js     802756 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802747:	f7 d6                	not    %esi
+  802749:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  80274f:	eb be                	jmp    80270f <nsbulk_own+0x19>
+	return 0;
+  802751:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802756:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802759:	5b                   	pop    %ebx
+  80275a:	5e                   	pop    %esi
+  80275b:	5f                   	pop    %edi
+  80275c:	5d                   	pop    %ebp
+  80275d:	c3                   	ret
+
+0080275e <nsipc_bulk>:
+{
+  80275e:	55                   	push   %ebp
+  80275f:	89 e5                	mov    %esp,%ebp
+  802761:	57                   	push   %edi
+  802762:	56                   	push   %esi
+  802763:	53                   	push   %ebx
+  802764:	83 ec 1c             	sub    $0x1c,%esp
+  802767:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80276a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80276c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802772:	c1 fb 0c             	sar    $0xc,%ebx
+  802775:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802778:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80277f:	74 56                	je     8027d7 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802781:	85 ff                	test   %edi,%edi
+  802783:	7e 24                	jle    8027a9 <nsipc_bulk+0x4b>
+  802785:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80278b:	74 1c                	je     8027a9 <nsipc_bulk+0x4b>
+  80278d:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802793:	c1 e3 0c             	shl    $0xc,%ebx
+  802796:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80279b:	0f b6 10             	movzbl (%eax),%edx
+  80279e:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8027a0:	05 00 10 00 00       	add    $0x1000,%eax
+  8027a5:	39 d8                	cmp    %ebx,%eax
+  8027a7:	75 f2                	jne    80279b <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8027a9:	83 ec 0c             	sub    $0xc,%esp
+  8027ac:	56                   	push   %esi
+  8027ad:	57                   	push   %edi
+  8027ae:	68 00 00 00 e0       	push   $0xe0000000
+  8027b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8027b6:	ff 35 e4 69 80 00    	push   0x8069e4
+  8027bc:	e8 33 1a 00 00       	call   8041f4 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8027c1:	83 c4 1c             	add    $0x1c,%esp
+  8027c4:	6a 00                	push   $0x0
+  8027c6:	6a 00                	push   $0x0
+  8027c8:	6a 00                	push   $0x0
+  8027ca:	e8 61 17 00 00       	call   803f30 <ipc_recv>
+}
+  8027cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d2:	5b                   	pop    %ebx
+  8027d3:	5e                   	pop    %esi
+  8027d4:	5f                   	pop    %edi
+  8027d5:	5d                   	pop    %ebp
+  8027d6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8027d7:	83 ec 0c             	sub    $0xc,%esp
+  8027da:	6a 03                	push   $0x3
+  8027dc:	e8 48 1a 00 00       	call   804229 <ipc_find_env>
+  8027e1:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	eb 96                	jmp    802781 <nsipc_bulk+0x23>
+
+008027eb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8027eb:	55                   	push   %ebp
+  8027ec:	89 e5                	mov    %esp,%ebp
+  8027ee:	53                   	push   %ebx
+  8027ef:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8027f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8027fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027fd:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802802:	b8 01 00 00 00       	mov    $0x1,%eax
+  802807:	e8 50 fe ff ff       	call   80265c <nsipc>
+  80280c:	89 c3                	mov    %eax,%ebx
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	79 07                	jns    802819 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802812:	89 d8                	mov    %ebx,%eax
+  802814:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802817:	c9                   	leave
+  802818:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802819:	83 ec 04             	sub    $0x4,%esp
+  80281c:	ff 35 10 80 80 00    	push   0x808010
+  802822:	68 00 80 80 00       	push   $0x808000
+  802827:	ff 75 0c             	push   0xc(%ebp)
+  80282a:	e8 99 e2 ff ff       	call   800ac8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80282f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802835:	8b 45 10             	mov    0x10(%ebp),%eax
+  802838:	89 10                	mov    %edx,(%eax)
+  80283a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80283d:	eb d3                	jmp    802812 <nsipc_accept+0x27>
+
+0080283f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80283f:	55                   	push   %ebp
+  802840:	89 e5                	mov    %esp,%ebp
+  802842:	53                   	push   %ebx
+  802843:	83 ec 08             	sub    $0x8,%esp
+  802846:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802849:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802851:	53                   	push   %ebx
+  802852:	ff 75 0c             	push   0xc(%ebp)
+  802855:	68 04 80 80 00       	push   $0x808004
+  80285a:	e8 69 e2 ff ff       	call   800ac8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80285f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802865:	b8 02 00 00 00       	mov    $0x2,%eax
+  80286a:	e8 ed fd ff ff       	call   80265c <nsipc>
+}
+  80286f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802872:	c9                   	leave
+  802873:	c3                   	ret
+
+00802874 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802874:	55                   	push   %ebp
+  802875:	89 e5                	mov    %esp,%ebp
+  802877:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80287a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802882:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802885:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80288a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80288f:	e8 c8 fd ff ff       	call   80265c <nsipc>
+}
+  802894:	c9                   	leave
+  802895:	c3                   	ret
+
+00802896 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802896:	55                   	push   %ebp
+  802897:	89 e5                	mov    %esp,%ebp
+  802899:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80289c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289f:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8028a4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028a9:	e8 ae fd ff ff       	call   80265c <nsipc>
+}
+  8028ae:	c9                   	leave
+  8028af:	c3                   	ret
+
+008028b0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8028b0:	55                   	push   %ebp
+  8028b1:	89 e5                	mov    %esp,%ebp
+  8028b3:	53                   	push   %ebx
+  8028b4:	83 ec 08             	sub    $0x8,%esp
+  8028b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8028ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bd:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8028c2:	53                   	push   %ebx
+  8028c3:	ff 75 0c             	push   0xc(%ebp)
+  8028c6:	68 04 80 80 00       	push   $0x808004
+  8028cb:	e8 f8 e1 ff ff       	call   800ac8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8028d0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8028d6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8028db:	e8 7c fd ff ff       	call   80265c <nsipc>
+}
+  8028e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e3:	c9                   	leave
+  8028e4:	c3                   	ret
+
+008028e5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8028e5:	55                   	push   %ebp
+  8028e6:	89 e5                	mov    %esp,%ebp
+  8028e8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8028eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ee:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8028f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028f6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8028fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  802900:	e8 57 fd ff ff       	call   80265c <nsipc>
+}
+  802905:	c9                   	leave
+  802906:	c3                   	ret
+
+00802907 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802907:	55                   	push   %ebp
+  802908:	89 e5                	mov    %esp,%ebp
+  80290a:	56                   	push   %esi
+  80290b:	53                   	push   %ebx
+  80290c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80290f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802912:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802917:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80291d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802920:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802925:	b8 07 00 00 00       	mov    $0x7,%eax
+  80292a:	e8 2d fd ff ff       	call   80265c <nsipc>
+  80292f:	89 c3                	mov    %eax,%ebx
+  802931:	85 c0                	test   %eax,%eax
+  802933:	78 22                	js     802957 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802935:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80293a:	39 c6                	cmp    %eax,%esi
+  80293c:	0f 4e c6             	cmovle %esi,%eax
+  80293f:	39 c3                	cmp    %eax,%ebx
+  802941:	7f 1d                	jg     802960 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802943:	83 ec 04             	sub    $0x4,%esp
+  802946:	53                   	push   %ebx
+  802947:	68 00 80 80 00       	push   $0x808000
+  80294c:	ff 75 0c             	push   0xc(%ebp)
+  80294f:	e8 74 e1 ff ff       	call   800ac8 <memmove>
+  802954:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802957:	89 d8                	mov    %ebx,%eax
+  802959:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80295c:	5b                   	pop    %ebx
+  80295d:	5e                   	pop    %esi
+  80295e:	5d                   	pop    %ebp
+  80295f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802960:	68 ac 49 80 00       	push   $0x8049ac
+  802965:	68 c1 49 80 00       	push   $0x8049c1
+  80296a:	68 b2 00 00 00       	push   $0xb2
+  80296f:	68 d6 49 80 00       	push   $0x8049d6
+  802974:	e8 0d 15 00 00       	call   803e86 <_panic>
+
+00802979 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802979:	55                   	push   %ebp
+  80297a:	89 e5                	mov    %esp,%ebp
+  80297c:	53                   	push   %ebx
+  80297d:	83 ec 04             	sub    $0x4,%esp
+  802980:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802983:	8b 45 08             	mov    0x8(%ebp),%eax
+  802986:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80298b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802991:	7f 2e                	jg     8029c1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802993:	83 ec 04             	sub    $0x4,%esp
+  802996:	53                   	push   %ebx
+  802997:	ff 75 0c             	push   0xc(%ebp)
+  80299a:	68 0c 80 80 00       	push   $0x80800c
+  80299f:	e8 24 e1 ff ff       	call   800ac8 <memmove>
+	nsipcbuf.send.req_size = size;
+  8029a4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8029aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ad:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8029b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029b7:	e8 a0 fc ff ff       	call   80265c <nsipc>
+}
+  8029bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029bf:	c9                   	leave
+  8029c0:	c3                   	ret
+	assert(size < 1600);
+  8029c1:	68 e2 49 80 00       	push   $0x8049e2
+  8029c6:	68 c1 49 80 00       	push   $0x8049c1
+  8029cb:	68 bd 00 00 00       	push   $0xbd
+  8029d0:	68 d6 49 80 00       	push   $0x8049d6
+  8029d5:	e8 ac 14 00 00       	call   803e86 <_panic>
+
+008029da <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8029da:	55                   	push   %ebp
+  8029db:	89 e5                	mov    %esp,%ebp
+  8029dd:	57                   	push   %edi
+  8029de:	56                   	push   %esi
+  8029df:	53                   	push   %ebx
+  8029e0:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8029e3:	e8 c0 fc ff ff       	call   8026a8 <nsbulk_map>
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	78 55                	js     802a41 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8029ec:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8029f3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8029fa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802a01:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a04:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a07:	0f 8d 24 02 00 00    	jge    802c31 <nsipc_sendmsg+0x257>
+  802a0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a10:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802a13:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802a16:	89 d8                	mov    %ebx,%eax
+  802a18:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a1d:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802a1f:	83 ec 0c             	sub    $0xc,%esp
+  802a22:	68 e0 66 80 00       	push   $0x8066e0
+  802a27:	e8 5a 0f 00 00       	call   803986 <pgbatch_init>
+  802a2c:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802a2f:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802a31:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802a34:	e9 82 00 00 00       	jmp    802abb <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802a39:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802a3c:	85 db                	test   %ebx,%ebx
+  802a3e:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802a41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a44:	5b                   	pop    %ebx
+  802a45:	5e                   	pop    %esi
+  802a46:	5f                   	pop    %edi
+  802a47:	5d                   	pop    %ebp
+  802a48:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802a49:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a4e:	29 c8                	sub    %ecx,%eax
+  802a50:	39 d0                	cmp    %edx,%eax
+  802a52:	0f 46 d0             	cmovbe %eax,%edx
+  802a55:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802a57:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802a5d:	85 ff                	test   %edi,%edi
+  802a5f:	0f 49 c7             	cmovns %edi,%eax
+  802a62:	c1 f8 0c             	sar    $0xc,%eax
+  802a65:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a6a:	e8 87 fc ff ff       	call   8026f6 <nsbulk_own>
+  802a6f:	85 c0                	test   %eax,%eax
+  802a71:	0f 88 17 01 00 00    	js     802b8e <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802a77:	83 ec 04             	sub    $0x4,%esp
+  802a7a:	56                   	push   %esi
+  802a7b:	ff 75 e0             	push   -0x20(%ebp)
+  802a7e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802a81:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802a86:	50                   	push   %eax
+  802a87:	e8 3c e0 ff ff       	call   800ac8 <memmove>
+  802a8c:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802a8f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802a92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a95:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a98:	0f 84 fd 00 00 00    	je     802b9b <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802a9e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802aa1:	01 f7                	add    %esi,%edi
+  802aa3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802aa6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802aa9:	0f 8d 01 01 00 00    	jge    802bb0 <nsipc_sendmsg+0x1d6>
+  802aaf:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802ab5:	0f 8f f0 00 00 00    	jg     802bab <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802abb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802abe:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802ac1:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802ac4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ac7:	89 c2                	mov    %eax,%edx
+  802ac9:	03 13                	add    (%ebx),%edx
+  802acb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802ace:	8b 73 04             	mov    0x4(%ebx),%esi
+  802ad1:	29 c6                	sub    %eax,%esi
+  802ad3:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802ad8:	29 f9                	sub    %edi,%ecx
+  802ada:	39 ce                	cmp    %ecx,%esi
+  802adc:	89 ca                	mov    %ecx,%edx
+  802ade:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802ae1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802ae4:	89 f9                	mov    %edi,%ecx
+  802ae6:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802aec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802aef:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802af4:	09 c8                	or     %ecx,%eax
+  802af6:	0f 85 4d ff ff ff    	jne    802a49 <nsipc_sendmsg+0x6f>
+  802afc:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802b02:	0f 86 41 ff ff ff    	jbe    802a49 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802b08:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802b0e:	85 ff                	test   %edi,%edi
+  802b10:	0f 49 c7             	cmovns %edi,%eax
+  802b13:	c1 f8 0c             	sar    $0xc,%eax
+  802b16:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802b18:	89 d1                	mov    %edx,%ecx
+  802b1a:	c1 e9 0c             	shr    $0xc,%ecx
+  802b1d:	01 c8                	add    %ecx,%eax
+  802b1f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802b22:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b25:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802b27:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802b2a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b2f:	29 c8                	sub    %ecx,%eax
+  802b31:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b34:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802b37:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802b39:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b3e:	89 f9                	mov    %edi,%ecx
+  802b40:	d3 e0                	shl    %cl,%eax
+  802b42:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802b48:	83 ec 08             	sub    $0x8,%esp
+  802b4b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802b4d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802b50:	50                   	push   %eax
+  802b51:	6a 00                	push   $0x0
+  802b53:	56                   	push   %esi
+  802b54:	6a 00                	push   $0x0
+  802b56:	68 e0 66 80 00       	push   $0x8066e0
+  802b5b:	e8 e4 0e 00 00       	call   803a44 <pgbatch_map>
+  802b60:	83 c4 20             	add    $0x20,%esp
+  802b63:	85 c0                	test   %eax,%eax
+  802b65:	0f 88 ce fe ff ff    	js     802a39 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802b6b:	83 c7 01             	add    $0x1,%edi
+  802b6e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b74:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b77:	39 c7                	cmp    %eax,%edi
+  802b79:	75 be                	jne    802b39 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802b7b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b7e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802b81:	89 d6                	mov    %edx,%esi
+  802b83:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802b89:	e9 01 ff ff ff       	jmp    802a8f <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802b8e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802b91:	85 db                	test   %ebx,%ebx
+  802b93:	0f 45 c3             	cmovne %ebx,%eax
+  802b96:	e9 a6 fe ff ff       	jmp    802a41 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802b9b:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802b9f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802ba6:	e9 f3 fe ff ff       	jmp    802a9e <nsipc_sendmsg+0xc4>
+  802bab:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802bae:	eb 03                	jmp    802bb3 <nsipc_sendmsg+0x1d9>
+  802bb0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802bb3:	83 ec 0c             	sub    $0xc,%esp
+  802bb6:	68 e0 66 80 00       	push   $0x8066e0
+  802bbb:	e8 d4 0d 00 00       	call   803994 <pgbatch_flush>
+  802bc0:	83 c4 10             	add    $0x10,%esp
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	78 50                	js     802c17 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bca:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802bcf:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802bd5:	89 fb                	mov    %edi,%ebx
+  802bd7:	29 f3                	sub    %esi,%ebx
+  802bd9:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802bdf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802be2:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802be7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802bec:	89 fa                	mov    %edi,%edx
+  802bee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802bf3:	e8 66 fb ff ff       	call   80275e <nsipc_bulk>
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	78 28                	js     802c24 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802bfc:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802bff:	39 c3                	cmp    %eax,%ebx
+  802c01:	75 0c                	jne    802c0f <nsipc_sendmsg+0x235>
+  802c03:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c06:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802c09:	0f 8f f2 fd ff ff    	jg     802a01 <nsipc_sendmsg+0x27>
+		sent += r;
+  802c0f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802c12:	e9 2a fe ff ff       	jmp    802a41 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802c17:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802c1a:	85 db                	test   %ebx,%ebx
+  802c1c:	0f 45 c3             	cmovne %ebx,%eax
+  802c1f:	e9 1d fe ff ff       	jmp    802a41 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802c24:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802c27:	85 db                	test   %ebx,%ebx
+  802c29:	0f 45 c3             	cmovne %ebx,%eax
+  802c2c:	e9 10 fe ff ff       	jmp    802a41 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802c31:	83 ec 0c             	sub    $0xc,%esp
+  802c34:	68 e0 66 80 00       	push   $0x8066e0
+  802c39:	e8 48 0d 00 00       	call   803986 <pgbatch_init>
+  802c3e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c41:	be 00 00 00 00       	mov    $0x0,%esi
+  802c46:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4b:	e9 63 ff ff ff       	jmp    802bb3 <nsipc_sendmsg+0x1d9>
+
+00802c50 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802c50:	55                   	push   %ebp
+  802c51:	89 e5                	mov    %esp,%ebp
+  802c53:	57                   	push   %edi
+  802c54:	56                   	push   %esi
+  802c55:	53                   	push   %ebx
+  802c56:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802c59:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802c60:	0f 84 c8 00 00 00    	je     802d2e <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802c66:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802c6d:	0f 84 e4 00 00 00    	je     802d57 <nsipc_sendfile+0x107>
+{
+  802c73:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802c78:	89 fb                	mov    %edi,%ebx
+  802c7a:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802c7d:	0f 83 f0 00 00 00    	jae    802d73 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802c83:	89 fa                	mov    %edi,%edx
+  802c85:	03 55 10             	add    0x10(%ebp),%edx
+  802c88:	89 d0                	mov    %edx,%eax
+  802c8a:	c1 f8 1f             	sar    $0x1f,%eax
+  802c8d:	c1 e8 14             	shr    $0x14,%eax
+  802c90:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802c93:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802c99:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802c9b:	6a 10                	push   $0x10
+  802c9d:	68 00 20 01 e0       	push   $0xe0012000
+  802ca2:	52                   	push   %edx
+  802ca3:	ff 75 0c             	push   0xc(%ebp)
+  802ca6:	e8 fe f4 ff ff       	call   8021a9 <fmap>
+  802cab:	83 c4 10             	add    $0x10,%esp
+  802cae:	85 c0                	test   %eax,%eax
+  802cb0:	0f 8e b8 00 00 00    	jle    802d6e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802cb6:	39 c6                	cmp    %eax,%esi
+  802cb8:	0f 8d b5 00 00 00    	jge    802d73 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802cbe:	29 f0                	sub    %esi,%eax
+  802cc0:	8b 55 14             	mov    0x14(%ebp),%edx
+  802cc3:	29 da                	sub    %ebx,%edx
+  802cc5:	39 d0                	cmp    %edx,%eax
+  802cc7:	89 d3                	mov    %edx,%ebx
+  802cc9:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ccf:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802cd4:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802cda:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802ce0:	8b 45 18             	mov    0x18(%ebp),%eax
+  802ce3:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802ce8:	83 ec 0c             	sub    $0xc,%esp
+  802ceb:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802ced:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802cf4:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802cf7:	83 c0 01             	add    $0x1,%eax
+  802cfa:	50                   	push   %eax
+  802cfb:	68 00 10 01 e0       	push   $0xe0011000
+  802d00:	6a 11                	push   $0x11
+  802d02:	ff 35 e4 69 80 00    	push   0x8069e4
+  802d08:	e8 e7 14 00 00       	call   8041f4 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802d0d:	83 c4 1c             	add    $0x1c,%esp
+  802d10:	6a 00                	push   $0x0
+  802d12:	6a 00                	push   $0x0
+  802d14:	6a 00                	push   $0x0
+  802d16:	e8 15 12 00 00       	call   803f30 <ipc_recv>
+  802d1b:	83 c4 10             	add    $0x10,%esp
+  802d1e:	85 c0                	test   %eax,%eax
+  802d20:	78 5b                	js     802d7d <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802d22:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802d24:	39 c3                	cmp    %eax,%ebx
+  802d26:	0f 8e 4c ff ff ff    	jle    802c78 <nsipc_sendfile+0x28>
+  802d2c:	eb 45                	jmp    802d73 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802d2e:	83 ec 04             	sub    $0x4,%esp
+  802d31:	6a 07                	push   $0x7
+  802d33:	68 00 10 01 e0       	push   $0xe0011000
+  802d38:	6a 00                	push   $0x0
+  802d3a:	e8 0d e0 ff ff       	call   800d4c <sys_page_alloc>
+  802d3f:	89 c7                	mov    %eax,%edi
+  802d41:	83 c4 10             	add    $0x10,%esp
+  802d44:	85 c0                	test   %eax,%eax
+  802d46:	78 2b                	js     802d73 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802d48:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  802d4f:	00 00 00 
+  802d52:	e9 0f ff ff ff       	jmp    802c66 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d57:	83 ec 0c             	sub    $0xc,%esp
+  802d5a:	6a 03                	push   $0x3
+  802d5c:	e8 c8 14 00 00       	call   804229 <ipc_find_env>
+  802d61:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802d66:	83 c4 10             	add    $0x10,%esp
+  802d69:	e9 05 ff ff ff       	jmp    802c73 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802d6e:	85 ff                	test   %edi,%edi
+  802d70:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802d73:	89 f8                	mov    %edi,%eax
+  802d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d78:	5b                   	pop    %ebx
+  802d79:	5e                   	pop    %esi
+  802d7a:	5f                   	pop    %edi
+  802d7b:	5d                   	pop    %ebp
+  802d7c:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802d7d:	85 ff                	test   %edi,%edi
+  802d7f:	0f 44 f8             	cmove  %eax,%edi
+  802d82:	eb ef                	jmp    802d73 <nsipc_sendfile+0x123>
+
+00802d84 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+  802d87:	57                   	push   %edi
+  802d88:	56                   	push   %esi
+  802d89:	53                   	push   %ebx
+  802d8a:	83 ec 1c             	sub    $0x1c,%esp
+  802d8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802d90:	e8 13 f9 ff ff       	call   8026a8 <nsbulk_map>
+  802d95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d98:	85 c0                	test   %eax,%eax
+  802d9a:	0f 88 ba 00 00 00    	js     802e5a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802da0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802da4:	0f 8e bb 00 00 00    	jle    802e65 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802daa:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802daf:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802db4:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802db9:	89 f8                	mov    %edi,%eax
+  802dbb:	29 f0                	sub    %esi,%eax
+  802dbd:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802dc1:	39 c8                	cmp    %ecx,%eax
+  802dc3:	0f 47 c1             	cmova  %ecx,%eax
+  802dc6:	01 f0                	add    %esi,%eax
+  802dc8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802dca:	83 c2 01             	add    $0x1,%edx
+  802dcd:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802dd0:	7e 07                	jle    802dd9 <nsipc_recvmsg+0x55>
+  802dd2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802dd7:	7e e0                	jle    802db9 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802dd9:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802ddf:	c1 fa 0c             	sar    $0xc,%edx
+  802de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de7:	e8 0a f9 ff ff       	call   8026f6 <nsbulk_own>
+  802dec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802def:	85 c0                	test   %eax,%eax
+  802df1:	78 67                	js     802e5a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802df3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802dfb:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802e01:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e04:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802e09:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802e0e:	89 f2                	mov    %esi,%edx
+  802e10:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802e15:	e8 44 f9 ff ff       	call   80275e <nsipc_bulk>
+  802e1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e1d:	85 c0                	test   %eax,%eax
+  802e1f:	78 39                	js     802e5a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802e21:	39 f0                	cmp    %esi,%eax
+  802e23:	7f 4a                	jg     802e6f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802e25:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e2a:	85 c0                	test   %eax,%eax
+  802e2c:	7e 2c                	jle    802e5a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802e2e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e31:	29 fe                	sub    %edi,%esi
+  802e33:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e36:	39 c6                	cmp    %eax,%esi
+  802e38:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802e3b:	83 ec 04             	sub    $0x4,%esp
+  802e3e:	56                   	push   %esi
+  802e3f:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802e45:	50                   	push   %eax
+  802e46:	ff 33                	push   (%ebx)
+  802e48:	e8 7b dc ff ff       	call   800ac8 <memmove>
+		n += m;
+  802e4d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802e4f:	83 c3 08             	add    $0x8,%ebx
+  802e52:	83 c4 10             	add    $0x10,%esp
+  802e55:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802e58:	7f d4                	jg     802e2e <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802e5a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e60:	5b                   	pop    %ebx
+  802e61:	5e                   	pop    %esi
+  802e62:	5f                   	pop    %edi
+  802e63:	5d                   	pop    %ebp
+  802e64:	c3                   	ret
+	int r, i, n, len = 0;
+  802e65:	be 00 00 00 00       	mov    $0x0,%esi
+  802e6a:	e9 6a ff ff ff       	jmp    802dd9 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802e6f:	68 b8 49 80 00       	push   $0x8049b8
+  802e74:	68 c1 49 80 00       	push   $0x8049c1
+  802e79:	68 3b 01 00 00       	push   $0x13b
+  802e7e:	68 d6 49 80 00       	push   $0x8049d6
+  802e83:	e8 fe 0f 00 00       	call   803e86 <_panic>
+
+00802e88 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802e88:	55                   	push   %ebp
+  802e89:	89 e5                	mov    %esp,%ebp
+  802e8b:	57                   	push   %edi
+  802e8c:	56                   	push   %esi
+  802e8d:	53                   	push   %ebx
+  802e8e:	83 ec 0c             	sub    $0xc,%esp
+  802e91:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802e94:	8b 75 10             	mov    0x10(%ebp),%esi
+  802e97:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802e9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802ea2:	8b 07                	mov    (%edi),%eax
+  802ea4:	a3 04 80 80 00       	mov    %eax,0x808004
+  802ea9:	8b 47 04             	mov    0x4(%edi),%eax
+  802eac:	a3 08 80 80 00       	mov    %eax,0x808008
+  802eb1:	8b 47 08             	mov    0x8(%edi),%eax
+  802eb4:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802eb9:	8b 47 0c             	mov    0xc(%edi),%eax
+  802ebc:	a3 10 80 80 00       	mov    %eax,0x808010
+  802ec1:	8b 47 10             	mov    0x10(%edi),%eax
+  802ec4:	a3 14 80 80 00       	mov    %eax,0x808014
+  802ec9:	8b 47 14             	mov    0x14(%edi),%eax
+  802ecc:	a3 18 80 80 00       	mov    %eax,0x808018
+  802ed1:	8b 47 18             	mov    0x18(%edi),%eax
+  802ed4:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802ed9:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802edc:	a3 20 80 80 00       	mov    %eax,0x808020
+  802ee1:	8b 47 20             	mov    0x20(%edi),%eax
+  802ee4:	a3 24 80 80 00       	mov    %eax,0x808024
+  802ee9:	8b 47 24             	mov    0x24(%edi),%eax
+  802eec:	a3 28 80 80 00       	mov    %eax,0x808028
+  802ef1:	8b 47 28             	mov    0x28(%edi),%eax
+  802ef4:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802ef9:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802efc:	a3 30 80 80 00       	mov    %eax,0x808030
+  802f01:	8b 47 30             	mov    0x30(%edi),%eax
+  802f04:	a3 34 80 80 00       	mov    %eax,0x808034
+  802f09:	8b 47 34             	mov    0x34(%edi),%eax
+  802f0c:	a3 38 80 80 00       	mov    %eax,0x808038
+  802f11:	8b 47 38             	mov    0x38(%edi),%eax
+  802f14:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802f19:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802f1c:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802f21:	8b 06                	mov    (%esi),%eax
+  802f23:	a3 44 80 80 00       	mov    %eax,0x808044
+  802f28:	8b 46 04             	mov    0x4(%esi),%eax
+  802f2b:	a3 48 80 80 00       	mov    %eax,0x808048
+  802f30:	8b 46 08             	mov    0x8(%esi),%eax
+  802f33:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802f38:	8b 46 0c             	mov    0xc(%esi),%eax
+  802f3b:	a3 50 80 80 00       	mov    %eax,0x808050
+  802f40:	8b 46 10             	mov    0x10(%esi),%eax
+  802f43:	a3 54 80 80 00       	mov    %eax,0x808054
+  802f48:	8b 46 14             	mov    0x14(%esi),%eax
+  802f4b:	a3 58 80 80 00       	mov    %eax,0x808058
+  802f50:	8b 46 18             	mov    0x18(%esi),%eax
+  802f53:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802f58:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802f5b:	a3 60 80 80 00       	mov    %eax,0x808060
+  802f60:	8b 46 20             	mov    0x20(%esi),%eax
+  802f63:	a3 64 80 80 00       	mov    %eax,0x808064
+  802f68:	8b 46 24             	mov    0x24(%esi),%eax
+  802f6b:	a3 68 80 80 00       	mov    %eax,0x808068
+  802f70:	8b 46 28             	mov    0x28(%esi),%eax
+  802f73:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802f78:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802f7b:	a3 70 80 80 00       	mov    %eax,0x808070
+  802f80:	8b 46 30             	mov    0x30(%esi),%eax
+  802f83:	a3 74 80 80 00       	mov    %eax,0x808074
+  802f88:	8b 46 34             	mov    0x34(%esi),%eax
+  802f8b:	a3 78 80 80 00       	mov    %eax,0x808078
+  802f90:	8b 46 38             	mov    0x38(%esi),%eax
+  802f93:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802f98:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802f9b:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802fa0:	8b 03                	mov    (%ebx),%eax
+  802fa2:	a3 84 80 80 00       	mov    %eax,0x808084
+  802fa7:	8b 43 04             	mov    0x4(%ebx),%eax
+  802faa:	a3 88 80 80 00       	mov    %eax,0x808088
+  802faf:	8b 43 08             	mov    0x8(%ebx),%eax
+  802fb2:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802fb7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802fba:	a3 90 80 80 00       	mov    %eax,0x808090
+  802fbf:	8b 43 10             	mov    0x10(%ebx),%eax
+  802fc2:	a3 94 80 80 00       	mov    %eax,0x808094
+  802fc7:	8b 43 14             	mov    0x14(%ebx),%eax
+  802fca:	a3 98 80 80 00       	mov    %eax,0x808098
+  802fcf:	8b 43 18             	mov    0x18(%ebx),%eax
+  802fd2:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802fd7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802fda:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802fdf:	8b 43 20             	mov    0x20(%ebx),%eax
+  802fe2:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802fe7:	8b 43 24             	mov    0x24(%ebx),%eax
+  802fea:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802fef:	8b 43 28             	mov    0x28(%ebx),%eax
+  802ff2:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802ff7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802ffa:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802fff:	8b 43 30             	mov    0x30(%ebx),%eax
+  803002:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803007:	8b 43 34             	mov    0x34(%ebx),%eax
+  80300a:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80300f:	8b 43 38             	mov    0x38(%ebx),%eax
+  803012:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803017:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80301a:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80301f:	8b 45 18             	mov    0x18(%ebp),%eax
+  803022:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803027:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80302c:	e8 2b f6 ff ff       	call   80265c <nsipc>
+  803031:	85 c0                	test   %eax,%eax
+  803033:	0f 88 ad 01 00 00    	js     8031e6 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803039:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80303f:	89 17                	mov    %edx,(%edi)
+  803041:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803047:	89 57 04             	mov    %edx,0x4(%edi)
+  80304a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803050:	89 57 08             	mov    %edx,0x8(%edi)
+  803053:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803059:	89 57 0c             	mov    %edx,0xc(%edi)
+  80305c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803062:	89 57 10             	mov    %edx,0x10(%edi)
+  803065:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80306b:	89 57 14             	mov    %edx,0x14(%edi)
+  80306e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803074:	89 57 18             	mov    %edx,0x18(%edi)
+  803077:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80307d:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803080:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  803086:	89 57 20             	mov    %edx,0x20(%edi)
+  803089:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  80308f:	89 57 24             	mov    %edx,0x24(%edi)
+  803092:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803098:	89 57 28             	mov    %edx,0x28(%edi)
+  80309b:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8030a1:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8030a4:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8030aa:	89 57 30             	mov    %edx,0x30(%edi)
+  8030ad:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8030b3:	89 57 34             	mov    %edx,0x34(%edi)
+  8030b6:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8030bc:	89 57 38             	mov    %edx,0x38(%edi)
+  8030bf:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8030c5:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8030c8:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8030ce:	89 16                	mov    %edx,(%esi)
+  8030d0:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8030d6:	89 56 04             	mov    %edx,0x4(%esi)
+  8030d9:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8030df:	89 56 08             	mov    %edx,0x8(%esi)
+  8030e2:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8030e8:	89 56 0c             	mov    %edx,0xc(%esi)
+  8030eb:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  8030f1:	89 56 10             	mov    %edx,0x10(%esi)
+  8030f4:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8030fa:	89 56 14             	mov    %edx,0x14(%esi)
+  8030fd:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803103:	89 56 18             	mov    %edx,0x18(%esi)
+  803106:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  80310c:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80310f:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803115:	89 56 20             	mov    %edx,0x20(%esi)
+  803118:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80311e:	89 56 24             	mov    %edx,0x24(%esi)
+  803121:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803127:	89 56 28             	mov    %edx,0x28(%esi)
+  80312a:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803130:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803133:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  803139:	89 56 30             	mov    %edx,0x30(%esi)
+  80313c:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803142:	89 56 34             	mov    %edx,0x34(%esi)
+  803145:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80314b:	89 56 38             	mov    %edx,0x38(%esi)
+  80314e:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803154:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803157:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80315d:	89 13                	mov    %edx,(%ebx)
+  80315f:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803165:	89 53 04             	mov    %edx,0x4(%ebx)
+  803168:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80316e:	89 53 08             	mov    %edx,0x8(%ebx)
+  803171:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803177:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80317a:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  803180:	89 53 10             	mov    %edx,0x10(%ebx)
+  803183:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803189:	89 53 14             	mov    %edx,0x14(%ebx)
+  80318c:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  803192:	89 53 18             	mov    %edx,0x18(%ebx)
+  803195:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  80319b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80319e:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8031a4:	89 53 20             	mov    %edx,0x20(%ebx)
+  8031a7:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8031ad:	89 53 24             	mov    %edx,0x24(%ebx)
+  8031b0:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8031b6:	89 53 28             	mov    %edx,0x28(%ebx)
+  8031b9:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8031bf:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8031c2:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8031c8:	89 53 30             	mov    %edx,0x30(%ebx)
+  8031cb:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  8031d1:	89 53 34             	mov    %edx,0x34(%ebx)
+  8031d4:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  8031da:	89 53 38             	mov    %edx,0x38(%ebx)
+  8031dd:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  8031e3:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8031e6:	83 c4 0c             	add    $0xc,%esp
+  8031e9:	5b                   	pop    %ebx
+  8031ea:	5e                   	pop    %esi
+  8031eb:	5f                   	pop    %edi
+  8031ec:	5d                   	pop    %ebp
+  8031ed:	c3                   	ret
+
+008031ee <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8031ee:	55                   	push   %ebp
+  8031ef:	89 e5                	mov    %esp,%ebp
+  8031f1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8031f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  8031fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031ff:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803204:	8b 45 10             	mov    0x10(%ebp),%eax
+  803207:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  80320c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803211:	e8 46 f4 ff ff       	call   80265c <nsipc>
+}
+  803216:	c9                   	leave
+  803217:	c3                   	ret
+
+00803218 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803218:	55                   	push   %ebp
+  803219:	89 e5                	mov    %esp,%ebp
+  80321b:	56                   	push   %esi
+  80321c:	53                   	push   %ebx
+  80321d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803220:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803226:	8b 45 10             	mov    0x10(%ebp),%eax
+  803229:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80322e:	b8 10 00 00 00       	mov    $0x10,%eax
+  803233:	e8 24 f4 ff ff       	call   80265c <nsipc>
+  803238:	89 c3                	mov    %eax,%ebx
+  80323a:	85 c0                	test   %eax,%eax
+  80323c:	7e 1f                	jle    80325d <nsipc_evwait+0x45>
+		assert(r <= max);
+  80323e:	39 c6                	cmp    %eax,%esi
+  803240:	7c 24                	jl     803266 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803242:	83 ec 04             	sub    $0x4,%esp
+  803245:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80324c:	50                   	push   %eax
+  80324d:	68 00 80 80 00       	push   $0x808000
+  803252:	ff 75 08             	push   0x8(%ebp)
+  803255:	e8 6e d8 ff ff       	call   800ac8 <memmove>
+  80325a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80325d:	89 d8                	mov    %ebx,%eax
+  80325f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803262:	5b                   	pop    %ebx
+  803263:	5e                   	pop    %esi
+  803264:	5d                   	pop    %ebp
+  803265:	c3                   	ret
+		assert(r <= max);
+  803266:	68 ee 49 80 00       	push   $0x8049ee
+  80326b:	68 c1 49 80 00       	push   $0x8049c1
+  803270:	68 6a 01 00 00       	push   $0x16a
+  803275:	68 d6 49 80 00       	push   $0x8049d6
+  80327a:	e8 07 0c 00 00       	call   803e86 <_panic>
+
+0080327f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80327f:	55                   	push   %ebp
+  803280:	89 e5                	mov    %esp,%ebp
+  803282:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803285:	8b 45 08             	mov    0x8(%ebp),%eax
+  803288:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80328d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803290:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803295:	8b 45 10             	mov    0x10(%ebp),%eax
+  803298:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80329d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8032a2:	e8 b5 f3 ff ff       	call   80265c <nsipc>
+}
+  8032a7:	c9                   	leave
+  8032a8:	c3                   	ret
+
+008032a9 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8032a9:	55                   	push   %ebp
+  8032aa:	89 e5                	mov    %esp,%ebp
+  8032ac:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8032af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b2:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8032b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8032bc:	e8 9b f3 ff ff       	call   80265c <nsipc>
+}
+  8032c1:	c9                   	leave
+  8032c2:	c3                   	ret
+
+008032c3 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8032c3:	55                   	push   %ebp
+  8032c4:	89 e5                	mov    %esp,%ebp
+  8032c6:	53                   	push   %ebx
+  8032c7:	83 ec 04             	sub    $0x4,%esp
+  8032ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8032cd:	b8 12 00 00 00       	mov    $0x12,%eax
+  8032d2:	e8 85 f3 ff ff       	call   80265c <nsipc>
+  8032d7:	85 c0                	test   %eax,%eax
+  8032d9:	78 50                	js     80332b <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8032db:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8032e1:	89 13                	mov    %edx,(%ebx)
+  8032e3:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8032e9:	89 53 04             	mov    %edx,0x4(%ebx)
+  8032ec:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8032f2:	89 53 08             	mov    %edx,0x8(%ebx)
+  8032f5:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8032fb:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8032fe:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803304:	89 53 10             	mov    %edx,0x10(%ebx)
+  803307:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80330d:	89 53 14             	mov    %edx,0x14(%ebx)
+  803310:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803316:	89 53 18             	mov    %edx,0x18(%ebx)
+  803319:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80331f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803322:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803328:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80332b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80332e:	c9                   	leave
+  80332f:	c3                   	ret
+
+00803330 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803336:	6a 03                	push   $0x3
+  803338:	e8 ec 0e 00 00       	call   804229 <ipc_find_env>
+  80333d:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803342:	8b 45 08             	mov    0x8(%ebp),%eax
+  803345:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80334a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80334f:	e8 08 f3 ff ff       	call   80265c <nsipc>
+  803354:	83 c4 10             	add    $0x10,%esp
+  803357:	85 c0                	test   %eax,%eax
+  803359:	78 0a                	js     803365 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80335b:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803360:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803365:	c9                   	leave
+  803366:	c3                   	ret
+
+00803367 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803367:	55                   	push   %ebp
+  803368:	89 e5                	mov    %esp,%ebp
+  80336a:	57                   	push   %edi
+  80336b:	56                   	push   %esi
+  80336c:	53                   	push   %ebx
+  80336d:	83 ec 1c             	sub    $0x1c,%esp
+  803370:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803373:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803376:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80337b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803380:	89 e0                	mov    %esp,%eax
+  803382:	89 f2                	mov    %esi,%edx
+  803384:	29 c2                	sub    %eax,%edx
+  803386:	89 d0                	mov    %edx,%eax
+  803388:	c1 e8 0f             	shr    $0xf,%eax
+  80338b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803391:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803394:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80339b:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  80339e:	83 ec 0c             	sub    $0xc,%esp
+  8033a1:	ff 75 e0             	push   -0x20(%ebp)
+  8033a4:	e8 bf 0e 00 00       	call   804268 <pageref>
+  8033a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033ac:	83 c4 04             	add    $0x4,%esp
+  8033af:	ff 75 dc             	push   -0x24(%ebp)
+  8033b2:	e8 b1 0e 00 00       	call   804268 <pageref>
+  8033b7:	89 e2                	mov    %esp,%edx
+  8033b9:	89 f1                	mov    %esi,%ecx
+  8033bb:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8033bd:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8033c0:	89 ca                	mov    %ecx,%edx
+  8033c2:	c1 ea 0f             	shr    $0xf,%edx
+  8033c5:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8033cb:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8033ce:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  8033d5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8033d8:	39 d7                	cmp    %edx,%edi
+  8033da:	74 40                	je     80341c <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8033dc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8033df:	75 9f                	jne    803380 <_pipeisclosed+0x19>
+  8033e1:	89 e2                	mov    %esp,%edx
+  8033e3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8033e8:	29 d0                	sub    %edx,%eax
+  8033ea:	89 c2                	mov    %eax,%edx
+  8033ec:	c1 ea 0f             	shr    $0xf,%edx
+  8033ef:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8033f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f9:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8033fc:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803403:	8b 40 58             	mov    0x58(%eax),%eax
+  803406:	6a 01                	push   $0x1
+  803408:	50                   	push   %eax
+  803409:	57                   	push   %edi
+  80340a:	68 f7 49 80 00       	push   $0x8049f7
+  80340f:	e8 0d ce ff ff       	call   800221 <cprintf>
+  803414:	83 c4 10             	add    $0x10,%esp
+  803417:	e9 5f ff ff ff       	jmp    80337b <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80341c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80341f:	0f 94 c0             	sete   %al
+  803422:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803425:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803428:	5b                   	pop    %ebx
+  803429:	5e                   	pop    %esi
+  80342a:	5f                   	pop    %edi
+  80342b:	5d                   	pop    %ebp
+  80342c:	c3                   	ret
+
+0080342d <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80342d:	55                   	push   %ebp
+  80342e:	89 e5                	mov    %esp,%ebp
+  803430:	53                   	push   %ebx
+  803431:	83 ec 0c             	sub    $0xc,%esp
+  803434:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803437:	53                   	push   %ebx
+  803438:	6a 00                	push   $0x0
+  80343a:	e8 92 d9 ff ff       	call   800dd1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80343f:	89 1c 24             	mov    %ebx,(%esp)
+  803442:	e8 f4 e4 ff ff       	call   80193b <fd2data>
+  803447:	83 c4 08             	add    $0x8,%esp
+  80344a:	50                   	push   %eax
+  80344b:	6a 00                	push   $0x0
+  80344d:	e8 7f d9 ff ff       	call   800dd1 <sys_page_unmap>
+}
+  803452:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803455:	c9                   	leave
+  803456:	c3                   	ret
+
+00803457 <devpipe_read>:
+{
+  803457:	55                   	push   %ebp
+  803458:	89 e5                	mov    %esp,%ebp
+  80345a:	57                   	push   %edi
+  80345b:	56                   	push   %esi
+  80345c:	53                   	push   %ebx
+  80345d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803460:	ff 75 08             	push   0x8(%ebp)
+  803463:	e8 d3 e4 ff ff       	call   80193b <fd2data>
+  803468:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80346a:	8b 70 04             	mov    0x4(%eax),%esi
+  80346d:	8b 00                	mov    (%eax),%eax
+  80346f:	83 c4 10             	add    $0x10,%esp
+  803472:	39 f0                	cmp    %esi,%eax
+  803474:	75 36                	jne    8034ac <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803476:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803479:	89 da                	mov    %ebx,%edx
+  80347b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80347e:	e8 e4 fe ff ff       	call   803367 <_pipeisclosed>
+  803483:	85 c0                	test   %eax,%eax
+  803485:	0f 85 d4 00 00 00    	jne    80355f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80348b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803490:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803494:	83 ec 04             	sub    $0x4,%esp
+  803497:	6a ff                	push   $0xffffffff
+  803499:	56                   	push   %esi
+  80349a:	57                   	push   %edi
+  80349b:	e8 aa dc ff ff       	call   80114a <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8034a0:	8b 73 04             	mov    0x4(%ebx),%esi
+  8034a3:	8b 03                	mov    (%ebx),%eax
+  8034a5:	83 c4 10             	add    $0x10,%esp
+  8034a8:	39 c6                	cmp    %eax,%esi
+  8034aa:	74 cd                	je     803479 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8034ac:	8b 73 04             	mov    0x4(%ebx),%esi
+  8034af:	8b 03                	mov    (%ebx),%eax
+  8034b1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8034b7:	29 c6                	sub    %eax,%esi
+  8034b9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034be:	f7 e6                	mul    %esi
+  8034c0:	c1 ea 0c             	shr    $0xc,%edx
+  8034c3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8034c9:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8034cb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8034ce:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8034d2:	8b 0b                	mov    (%ebx),%ecx
+  8034d4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034d9:	f7 e1                	mul    %ecx
+  8034db:	c1 ea 0b             	shr    $0xb,%edx
+  8034de:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8034e4:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8034e6:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8034eb:	29 cf                	sub    %ecx,%edi
+  8034ed:	39 f7                	cmp    %esi,%edi
+  8034ef:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8034f2:	83 ec 04             	sub    $0x4,%esp
+  8034f5:	57                   	push   %edi
+  8034f6:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8034fa:	50                   	push   %eax
+  8034fb:	ff 75 0c             	push   0xc(%ebp)
+  8034fe:	e8 c5 d5 ff ff       	call   800ac8 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803503:	83 c4 0c             	add    $0xc,%esp
+  803506:	89 f0                	mov    %esi,%eax
+  803508:	29 f8                	sub    %edi,%eax
+  80350a:	50                   	push   %eax
+  80350b:	8d 43 10             	lea    0x10(%ebx),%eax
+  80350e:	50                   	push   %eax
+  80350f:	89 f8                	mov    %edi,%eax
+  803511:	03 45 0c             	add    0xc(%ebp),%eax
+  803514:	50                   	push   %eax
+  803515:	e8 ae d5 ff ff       	call   800ac8 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80351a:	8b 0b                	mov    (%ebx),%ecx
+  80351c:	01 f1                	add    %esi,%ecx
+  80351e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803523:	f7 e1                	mul    %ecx
+  803525:	c1 ea 0c             	shr    $0xc,%edx
+  803528:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80352e:	29 c1                	sub    %eax,%ecx
+  803530:	89 0b                	mov    %ecx,(%ebx)
+  803532:	b8 00 00 00 00       	mov    $0x0,%eax
+  803537:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80353b:	83 c4 10             	add    $0x10,%esp
+  80353e:	85 c0                	test   %eax,%eax
+  803540:	75 0a                	jne    80354c <devpipe_read+0xf5>
+	return n;
+  803542:	89 f0                	mov    %esi,%eax
+}
+  803544:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803547:	5b                   	pop    %ebx
+  803548:	5e                   	pop    %esi
+  803549:	5f                   	pop    %edi
+  80354a:	5d                   	pop    %ebp
+  80354b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80354c:	83 ec 08             	sub    $0x8,%esp
+  80354f:	68 00 04 00 00       	push   $0x400
+  803554:	53                   	push   %ebx
+  803555:	e8 12 dc ff ff       	call   80116c <sys_futex_wake>
+  80355a:	83 c4 10             	add    $0x10,%esp
+  80355d:	eb e3                	jmp    803542 <devpipe_read+0xeb>
+			return 0;
+  80355f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803564:	eb de                	jmp    803544 <devpipe_read+0xed>
+
+00803566 <devpipe_write>:
+{
+  803566:	55                   	push   %ebp
+  803567:	89 e5                	mov    %esp,%ebp
+  803569:	57                   	push   %edi
+  80356a:	56                   	push   %esi
+  80356b:	53                   	push   %ebx
+  80356c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80356f:	ff 75 08             	push   0x8(%ebp)
+  803572:	e8 c4 e3 ff ff       	call   80193b <fd2data>
+  803577:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803579:	83 c4 10             	add    $0x10,%esp
+  80357c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803583:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803588:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80358c:	0f 84 43 01 00 00    	je     8036d5 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803592:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803595:	8b 06                	mov    (%esi),%eax
+  803597:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80359d:	29 c1                	sub    %eax,%ecx
+  80359f:	89 c8                	mov    %ecx,%eax
+  8035a1:	f7 e7                	mul    %edi
+  8035a3:	c1 ea 0c             	shr    $0xc,%edx
+  8035a6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8035ac:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8035ae:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8035b4:	75 52                	jne    803608 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8035b6:	89 f2                	mov    %esi,%edx
+  8035b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035bb:	e8 a7 fd ff ff       	call   803367 <_pipeisclosed>
+  8035c0:	85 c0                	test   %eax,%eax
+  8035c2:	0f 85 28 01 00 00    	jne    8036f0 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8035c8:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035ca:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8035cd:	8b 06                	mov    (%esi),%eax
+  8035cf:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8035d5:	29 c1                	sub    %eax,%ecx
+  8035d7:	89 c8                	mov    %ecx,%eax
+  8035d9:	f7 e7                	mul    %edi
+  8035db:	c1 ea 0c             	shr    $0xc,%edx
+  8035de:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8035e4:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8035e6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8035ec:	75 a4                	jne    803592 <devpipe_write+0x2c>
+  8035ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035f3:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8035f7:	83 ec 04             	sub    $0x4,%esp
+  8035fa:	6a ff                	push   $0xffffffff
+  8035fc:	53                   	push   %ebx
+  8035fd:	56                   	push   %esi
+  8035fe:	e8 47 db ff ff       	call   80114a <sys_futex_wait>
+}
+  803603:	83 c4 10             	add    $0x10,%esp
+  803606:	eb 8a                	jmp    803592 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803608:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80360b:	8b 06                	mov    (%esi),%eax
+  80360d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803613:	29 c1                	sub    %eax,%ecx
+  803615:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80361a:	f7 e1                	mul    %ecx
+  80361c:	c1 ea 0c             	shr    $0xc,%edx
+  80361f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803625:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803627:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80362c:	89 d8                	mov    %ebx,%eax
+  80362e:	29 c8                	sub    %ecx,%eax
+  803630:	8b 55 10             	mov    0x10(%ebp),%edx
+  803633:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803636:	29 ca                	sub    %ecx,%edx
+  803638:	39 d0                	cmp    %edx,%eax
+  80363a:	0f 46 d0             	cmovbe %eax,%edx
+  80363d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803640:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803643:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803648:	f7 e1                	mul    %ecx
+  80364a:	c1 ea 0b             	shr    $0xb,%edx
+  80364d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803653:	89 ca                	mov    %ecx,%edx
+  803655:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803657:	29 d3                	sub    %edx,%ebx
+  803659:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80365c:	39 c3                	cmp    %eax,%ebx
+  80365e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803661:	83 ec 04             	sub    $0x4,%esp
+  803664:	53                   	push   %ebx
+  803665:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803668:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80366b:	51                   	push   %ecx
+  80366c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803670:	50                   	push   %eax
+  803671:	e8 52 d4 ff ff       	call   800ac8 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803676:	83 c4 0c             	add    $0xc,%esp
+  803679:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80367c:	29 d8                	sub    %ebx,%eax
+  80367e:	50                   	push   %eax
+  80367f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803682:	01 cb                	add    %ecx,%ebx
+  803684:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803687:	53                   	push   %ebx
+  803688:	8d 46 10             	lea    0x10(%esi),%eax
+  80368b:	50                   	push   %eax
+  80368c:	e8 37 d4 ff ff       	call   800ac8 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803691:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803694:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803697:	01 c1                	add    %eax,%ecx
+  803699:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80369e:	f7 e1                	mul    %ecx
+  8036a0:	c1 ea 0c             	shr    $0xc,%edx
+  8036a3:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8036a9:	89 ca                	mov    %ecx,%edx
+  8036ab:	29 c2                	sub    %eax,%edx
+  8036ad:	89 56 04             	mov    %edx,0x4(%esi)
+  8036b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b5:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8036b9:	83 c4 10             	add    $0x10,%esp
+  8036bc:	85 c0                	test   %eax,%eax
+  8036be:	75 1a                	jne    8036da <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8036c0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8036c3:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8036c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036c9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8036cc:	0f 82 c0 fe ff ff    	jb     803592 <devpipe_write+0x2c>
+  8036d2:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8036d5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036d8:	eb 1b                	jmp    8036f5 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8036da:	83 ec 08             	sub    $0x8,%esp
+  8036dd:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8036e2:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8036e5:	50                   	push   %eax
+  8036e6:	e8 81 da ff ff       	call   80116c <sys_futex_wake>
+  8036eb:	83 c4 10             	add    $0x10,%esp
+  8036ee:	eb d0                	jmp    8036c0 <devpipe_write+0x15a>
+				return 0;
+  8036f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f8:	5b                   	pop    %ebx
+  8036f9:	5e                   	pop    %esi
+  8036fa:	5f                   	pop    %edi
+  8036fb:	5d                   	pop    %ebp
+  8036fc:	c3                   	ret
+
+008036fd <devpipe_stat>:
+{
+  8036fd:	55                   	push   %ebp
+  8036fe:	89 e5                	mov    %esp,%ebp
+  803700:	56                   	push   %esi
+  803701:	53                   	push   %ebx
+  803702:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803705:	83 ec 0c             	sub    $0xc,%esp
+  803708:	ff 75 08             	push   0x8(%ebp)
+  80370b:	e8 2b e2 ff ff       	call   80193b <fd2data>
+  803710:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803712:	83 c4 08             	add    $0x8,%esp
+  803715:	68 0a 4a 80 00       	push   $0x804a0a
+  80371a:	53                   	push   %ebx
+  80371b:	e8 f8 d1 ff ff       	call   800918 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803720:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803723:	8b 06                	mov    (%esi),%eax
+  803725:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80372b:	29 c1                	sub    %eax,%ecx
+  80372d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803732:	89 c8                	mov    %ecx,%eax
+  803734:	f7 e2                	mul    %edx
+  803736:	c1 ea 0c             	shr    $0xc,%edx
+  803739:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80373f:	29 d1                	sub    %edx,%ecx
+  803741:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803747:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80374e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803751:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803758:	50 80 00 
+}
+  80375b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803760:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803763:	5b                   	pop    %ebx
+  803764:	5e                   	pop    %esi
+  803765:	5d                   	pop    %ebp
+  803766:	c3                   	ret
+
+00803767 <devpipe_poll>:
+{
+  803767:	55                   	push   %ebp
+  803768:	89 e5                	mov    %esp,%ebp
+  80376a:	57                   	push   %edi
+  80376b:	56                   	push   %esi
+  80376c:	53                   	push   %ebx
+  80376d:	83 ec 18             	sub    $0x18,%esp
+  803770:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803773:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803776:	57                   	push   %edi
+  803777:	e8 bf e1 ff ff       	call   80193b <fd2data>
+  80377c:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80377e:	83 c4 10             	add    $0x10,%esp
+  803781:	89 f3                	mov    %esi,%ebx
+  803783:	83 e3 01             	and    $0x1,%ebx
+  803786:	75 27                	jne    8037af <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803788:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80378e:	75 48                	jne    8037d8 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803790:	89 ca                	mov    %ecx,%edx
+  803792:	89 f8                	mov    %edi,%eax
+  803794:	e8 ce fb ff ff       	call   803367 <_pipeisclosed>
+  803799:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80379b:	89 d8                	mov    %ebx,%eax
+  80379d:	83 c8 10             	or     $0x10,%eax
+  8037a0:	85 d2                	test   %edx,%edx
+  8037a2:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8037a5:	89 d8                	mov    %ebx,%eax
+  8037a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037aa:	5b                   	pop    %ebx
+  8037ab:	5e                   	pop    %esi
+  8037ac:	5f                   	pop    %edi
+  8037ad:	5d                   	pop    %ebp
+  8037ae:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037af:	8b 58 04             	mov    0x4(%eax),%ebx
+  8037b2:	8b 00                	mov    (%eax),%eax
+  8037b4:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8037ba:	29 c3                	sub    %eax,%ebx
+  8037bc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8037c1:	89 d8                	mov    %ebx,%eax
+  8037c3:	f7 e2                	mul    %edx
+  8037c5:	c1 ea 0c             	shr    $0xc,%edx
+  8037c8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8037ce:	39 d3                	cmp    %edx,%ebx
+  8037d0:	0f 95 c3             	setne  %bl
+  8037d3:	0f b6 db             	movzbl %bl,%ebx
+  8037d6:	eb b0                	jmp    803788 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037d8:	8b 71 04             	mov    0x4(%ecx),%esi
+  8037db:	8b 01                	mov    (%ecx),%eax
+  8037dd:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8037e3:	29 c6                	sub    %eax,%esi
+  8037e5:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8037ea:	89 f0                	mov    %esi,%eax
+  8037ec:	f7 e2                	mul    %edx
+  8037ee:	c1 ea 0c             	shr    $0xc,%edx
+  8037f1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037f7:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8037f9:	89 d8                	mov    %ebx,%eax
+  8037fb:	83 c8 04             	or     $0x4,%eax
+  8037fe:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803804:	0f 42 d8             	cmovb  %eax,%ebx
+  803807:	eb 87                	jmp    803790 <devpipe_poll+0x29>
+
+00803809 <pipe>:
+{
+  803809:	55                   	push   %ebp
+  80380a:	89 e5                	mov    %esp,%ebp
+  80380c:	56                   	push   %esi
+  80380d:	53                   	push   %ebx
+  80380e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803811:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803814:	50                   	push   %eax
+  803815:	e8 38 e1 ff ff       	call   801952 <fd_alloc>
+  80381a:	89 c3                	mov    %eax,%ebx
+  80381c:	83 c4 10             	add    $0x10,%esp
+  80381f:	85 c0                	test   %eax,%eax
+  803821:	0f 88 23 01 00 00    	js     80394a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803827:	83 ec 04             	sub    $0x4,%esp
+  80382a:	68 07 04 00 00       	push   $0x407
+  80382f:	ff 75 f4             	push   -0xc(%ebp)
+  803832:	6a 00                	push   $0x0
+  803834:	e8 13 d5 ff ff       	call   800d4c <sys_page_alloc>
+  803839:	89 c3                	mov    %eax,%ebx
+  80383b:	83 c4 10             	add    $0x10,%esp
+  80383e:	85 c0                	test   %eax,%eax
+  803840:	0f 88 04 01 00 00    	js     80394a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803846:	83 ec 0c             	sub    $0xc,%esp
+  803849:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80384c:	50                   	push   %eax
+  80384d:	e8 00 e1 ff ff       	call   801952 <fd_alloc>
+  803852:	89 c3                	mov    %eax,%ebx
+  803854:	83 c4 10             	add    $0x10,%esp
+  803857:	85 c0                	test   %eax,%eax
+  803859:	0f 88 db 00 00 00    	js     80393a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80385f:	83 ec 04             	sub    $0x4,%esp
+  803862:	68 07 04 00 00       	push   $0x407
+  803867:	ff 75 f0             	push   -0x10(%ebp)
+  80386a:	6a 00                	push   $0x0
+  80386c:	e8 db d4 ff ff       	call   800d4c <sys_page_alloc>
+  803871:	89 c3                	mov    %eax,%ebx
+  803873:	83 c4 10             	add    $0x10,%esp
+  803876:	85 c0                	test   %eax,%eax
+  803878:	0f 88 bc 00 00 00    	js     80393a <pipe+0x131>
+	va = fd2data(fd0);
+  80387e:	83 ec 0c             	sub    $0xc,%esp
+  803881:	ff 75 f4             	push   -0xc(%ebp)
+  803884:	e8 b2 e0 ff ff       	call   80193b <fd2data>
+  803889:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80388b:	83 c4 0c             	add    $0xc,%esp
+  80388e:	68 07 04 00 00       	push   $0x407
+  803893:	50                   	push   %eax
+  803894:	6a 00                	push   $0x0
+  803896:	e8 b1 d4 ff ff       	call   800d4c <sys_page_alloc>
+  80389b:	89 c3                	mov    %eax,%ebx
+  80389d:	83 c4 10             	add    $0x10,%esp
+  8038a0:	85 c0                	test   %eax,%eax
+  8038a2:	0f 88 82 00 00 00    	js     80392a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038a8:	83 ec 0c             	sub    $0xc,%esp
+  8038ab:	ff 75 f0             	push   -0x10(%ebp)
+  8038ae:	e8 88 e0 ff ff       	call   80193b <fd2data>
+  8038b3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8038ba:	50                   	push   %eax
+  8038bb:	6a 00                	push   $0x0
+  8038bd:	56                   	push   %esi
+  8038be:	6a 00                	push   $0x0
+  8038c0:	e8 ca d4 ff ff       	call   800d8f <sys_page_map>
+  8038c5:	89 c3                	mov    %eax,%ebx
+  8038c7:	83 c4 20             	add    $0x20,%esp
+  8038ca:	85 c0                	test   %eax,%eax
+  8038cc:	78 4e                	js     80391c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8038ce:	a1 60 50 80 00       	mov    0x805060,%eax
+  8038d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038d6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8038d8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038db:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8038e2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8038e5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8038e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8038ea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8038f1:	83 ec 0c             	sub    $0xc,%esp
+  8038f4:	ff 75 f4             	push   -0xc(%ebp)
+  8038f7:	e8 2f e0 ff ff       	call   80192b <fd2num>
+  8038fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038ff:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803901:	83 c4 04             	add    $0x4,%esp
+  803904:	ff 75 f0             	push   -0x10(%ebp)
+  803907:	e8 1f e0 ff ff       	call   80192b <fd2num>
+  80390c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80390f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803912:	83 c4 10             	add    $0x10,%esp
+  803915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80391a:	eb 2e                	jmp    80394a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80391c:	83 ec 08             	sub    $0x8,%esp
+  80391f:	56                   	push   %esi
+  803920:	6a 00                	push   $0x0
+  803922:	e8 aa d4 ff ff       	call   800dd1 <sys_page_unmap>
+  803927:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80392a:	83 ec 08             	sub    $0x8,%esp
+  80392d:	ff 75 f0             	push   -0x10(%ebp)
+  803930:	6a 00                	push   $0x0
+  803932:	e8 9a d4 ff ff       	call   800dd1 <sys_page_unmap>
+  803937:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80393a:	83 ec 08             	sub    $0x8,%esp
+  80393d:	ff 75 f4             	push   -0xc(%ebp)
+  803940:	6a 00                	push   $0x0
+  803942:	e8 8a d4 ff ff       	call   800dd1 <sys_page_unmap>
+  803947:	83 c4 10             	add    $0x10,%esp
+}
+  80394a:	89 d8                	mov    %ebx,%eax
+  80394c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80394f:	5b                   	pop    %ebx
+  803950:	5e                   	pop    %esi
+  803951:	5d                   	pop    %ebp
+  803952:	c3                   	ret
+
+00803953 <pipeisclosed>:
+{
+  803953:	55                   	push   %ebp
+  803954:	89 e5                	mov    %esp,%ebp
+  803956:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803959:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80395c:	50                   	push   %eax
+  80395d:	ff 75 08             	push   0x8(%ebp)
+  803960:	e8 3d e0 ff ff       	call   8019a2 <fd_lookup>
+  803965:	83 c4 10             	add    $0x10,%esp
+  803968:	85 c0                	test   %eax,%eax
+  80396a:	78 18                	js     803984 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80396c:	83 ec 0c             	sub    $0xc,%esp
+  80396f:	ff 75 f4             	push   -0xc(%ebp)
+  803972:	e8 c4 df ff ff       	call   80193b <fd2data>
+  803977:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80397c:	e8 e6 f9 ff ff       	call   803367 <_pipeisclosed>
+  803981:	83 c4 10             	add    $0x10,%esp
+}
+  803984:	c9                   	leave
+  803985:	c3                   	ret
+
+00803986 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803986:	55                   	push   %ebp
+  803987:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80398c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803992:	5d                   	pop    %ebp
+  803993:	c3                   	ret
+
+00803994 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803994:	55                   	push   %ebp
+  803995:	89 e5                	mov    %esp,%ebp
+  803997:	53                   	push   %ebx
+  803998:	83 ec 04             	sub    $0x4,%esp
+  80399b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80399e:	8b 03                	mov    (%ebx),%eax
+  8039a0:	85 c0                	test   %eax,%eax
+  8039a2:	75 05                	jne    8039a9 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8039a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039a7:	c9                   	leave
+  8039a8:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8039a9:	83 ec 08             	sub    $0x8,%esp
+  8039ac:	50                   	push   %eax
+  8039ad:	8d 43 04             	lea    0x4(%ebx),%eax
+  8039b0:	50                   	push   %eax
+  8039b1:	e8 6b d6 ff ff       	call   801021 <sys_page_batch>
+	pb->pb_n = 0;
+  8039b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8039bc:	83 c4 10             	add    $0x10,%esp
+  8039bf:	eb e3                	jmp    8039a4 <pgbatch_flush+0x10>
+
+008039c1 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8039c1:	55                   	push   %ebp
+  8039c2:	89 e5                	mov    %esp,%ebp
+  8039c4:	56                   	push   %esi
+  8039c5:	53                   	push   %ebx
+  8039c6:	89 c3                	mov    %eax,%ebx
+  8039c8:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8039ca:	83 38 20             	cmpl   $0x20,(%eax)
+  8039cd:	74 2c                	je     8039fb <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8039cf:	8b 03                	mov    (%ebx),%eax
+  8039d1:	8d 50 01             	lea    0x1(%eax),%edx
+  8039d4:	89 13                	mov    %edx,(%ebx)
+  8039d6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8039d9:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8039dd:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8039df:	83 ec 04             	sub    $0x4,%esp
+  8039e2:	6a 18                	push   $0x18
+  8039e4:	6a 00                	push   $0x0
+  8039e6:	50                   	push   %eax
+  8039e7:	e8 a7 d0 ff ff       	call   800a93 <memset>
+	return 0;
+  8039ec:	83 c4 10             	add    $0x10,%esp
+  8039ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039f7:	5b                   	pop    %ebx
+  8039f8:	5e                   	pop    %esi
+  8039f9:	5d                   	pop    %ebp
+  8039fa:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8039fb:	83 ec 0c             	sub    $0xc,%esp
+  8039fe:	50                   	push   %eax
+  8039ff:	e8 90 ff ff ff       	call   803994 <pgbatch_flush>
+  803a04:	83 c4 10             	add    $0x10,%esp
+  803a07:	85 c0                	test   %eax,%eax
+  803a09:	79 c4                	jns    8039cf <pgbatch_slot+0xe>
+  803a0b:	eb e7                	jmp    8039f4 <pgbatch_slot+0x33>
+
+00803a0d <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803a0d:	55                   	push   %ebp
+  803a0e:	89 e5                	mov    %esp,%ebp
+  803a10:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a13:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a16:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a19:	e8 a3 ff ff ff       	call   8039c1 <pgbatch_slot>
+  803a1e:	85 c0                	test   %eax,%eax
+  803a20:	78 20                	js     803a42 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803a22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a25:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803a2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a2e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803a31:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a34:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803a37:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a3a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a42:	c9                   	leave
+  803a43:	c3                   	ret
+
+00803a44 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803a44:	55                   	push   %ebp
+  803a45:	89 e5                	mov    %esp,%ebp
+  803a47:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a4a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a50:	e8 6c ff ff ff       	call   8039c1 <pgbatch_slot>
+  803a55:	85 c0                	test   %eax,%eax
+  803a57:	78 2c                	js     803a85 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803a59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a5c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803a62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a65:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803a68:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a6b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803a6e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a71:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803a74:	8b 55 18             	mov    0x18(%ebp),%edx
+  803a77:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803a7a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803a7d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803a80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a85:	c9                   	leave
+  803a86:	c3                   	ret
+
+00803a87 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803a87:	55                   	push   %ebp
+  803a88:	89 e5                	mov    %esp,%ebp
+  803a8a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a8d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a93:	e8 29 ff ff ff       	call   8039c1 <pgbatch_slot>
+  803a98:	85 c0                	test   %eax,%eax
+  803a9a:	78 1a                	js     803ab6 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803a9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a9f:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803aa5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803aa8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803aab:	8b 55 10             	mov    0x10(%ebp),%edx
+  803aae:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ab6:	c9                   	leave
+  803ab7:	c3                   	ret
+
+00803ab8 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803ab8:	55                   	push   %ebp
+  803ab9:	89 e5                	mov    %esp,%ebp
+  803abb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803abe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac4:	e8 f8 fe ff ff       	call   8039c1 <pgbatch_slot>
+  803ac9:	85 c0                	test   %eax,%eax
+  803acb:	78 20                	js     803aed <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803acd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ad0:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803ad6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ad9:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803adc:	8b 55 10             	mov    0x10(%ebp),%edx
+  803adf:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ae2:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ae5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aed:	c9                   	leave
+  803aee:	c3                   	ret
+
+00803aef <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803aef:	55                   	push   %ebp
+  803af0:	89 e5                	mov    %esp,%ebp
+  803af2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803af5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803afb:	e8 c1 fe ff ff       	call   8039c1 <pgbatch_slot>
+  803b00:	85 c0                	test   %eax,%eax
+  803b02:	78 26                	js     803b2a <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803b04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b07:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803b0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b10:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803b13:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b16:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803b19:	8b 55 14             	mov    0x14(%ebp),%edx
+  803b1c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803b1f:	8b 55 18             	mov    0x18(%ebp),%edx
+  803b22:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b2a:	c9                   	leave
+  803b2b:	c3                   	ret
+
+00803b2c <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803b2c:	55                   	push   %ebp
+  803b2d:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b32:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b38:	5d                   	pop    %ebp
+  803b39:	c3                   	ret
+
+00803b3a <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803b3a:	55                   	push   %ebp
+  803b3b:	89 e5                	mov    %esp,%ebp
+  803b3d:	56                   	push   %esi
+  803b3e:	53                   	push   %ebx
+  803b3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b47:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b4c:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803b50:	85 c0                	test   %eax,%eax
+  803b52:	74 2f                	je     803b83 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803b54:	83 f8 02             	cmp    $0x2,%eax
+  803b57:	74 0c                	je     803b65 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803b59:	b8 02 00 00 00       	mov    $0x2,%eax
+  803b5e:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803b61:	85 c0                	test   %eax,%eax
+  803b63:	74 1e                	je     803b83 <mutex_lock+0x49>
+  803b65:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803b6a:	83 ec 04             	sub    $0x4,%esp
+  803b6d:	6a ff                	push   $0xffffffff
+  803b6f:	6a 02                	push   $0x2
+  803b71:	53                   	push   %ebx
+  803b72:	e8 d3 d5 ff ff       	call   80114a <sys_futex_wait>
+  803b77:	89 f0                	mov    %esi,%eax
+  803b79:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803b7c:	83 c4 10             	add    $0x10,%esp
+  803b7f:	85 c0                	test   %eax,%eax
+  803b81:	75 e7                	jne    803b6a <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803b83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b86:	5b                   	pop    %ebx
+  803b87:	5e                   	pop    %esi
+  803b88:	5d                   	pop    %ebp
+  803b89:	c3                   	ret
+
+00803b8a <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803b8a:	55                   	push   %ebp
+  803b8b:	89 e5                	mov    %esp,%ebp
+  803b8d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b95:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b9a:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803b9e:	85 c0                	test   %eax,%eax
+  803ba0:	0f 94 c0             	sete   %al
+  803ba3:	0f b6 c0             	movzbl %al,%eax
+}
+  803ba6:	5d                   	pop    %ebp
+  803ba7:	c3                   	ret
+
+00803ba8 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803ba8:	55                   	push   %ebp
+  803ba9:	89 e5                	mov    %esp,%ebp
+  803bab:	83 ec 08             	sub    $0x8,%esp
+  803bae:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb6:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803bb9:	83 f8 02             	cmp    $0x2,%eax
+  803bbc:	74 02                	je     803bc0 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803bbe:	c9                   	leave
+  803bbf:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803bc0:	83 ec 08             	sub    $0x8,%esp
+  803bc3:	6a 01                	push   $0x1
+  803bc5:	52                   	push   %edx
+  803bc6:	e8 a1 d5 ff ff       	call   80116c <sys_futex_wake>
+  803bcb:	83 c4 10             	add    $0x10,%esp
+}
+  803bce:	eb ee                	jmp    803bbe <mutex_unlock+0x16>
+
+00803bd0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803bd0:	55                   	push   %ebp
+  803bd1:	89 e5                	mov    %esp,%ebp
+  803bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803bd6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803bdc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803be3:	5d                   	pop    %ebp
+  803be4:	c3                   	ret
+
+00803be5 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803be5:	55                   	push   %ebp
+  803be6:	89 e5                	mov    %esp,%ebp
+  803be8:	57                   	push   %edi
+  803be9:	56                   	push   %esi
+  803bea:	53                   	push   %ebx
+  803beb:	83 ec 18             	sub    $0x18,%esp
+  803bee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803bf1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803bf4:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803bf6:	b8 01 00 00 00       	mov    $0x1,%eax
+  803bfb:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803c00:	57                   	push   %edi
+  803c01:	e8 a2 ff ff ff       	call   803ba8 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803c06:	83 c4 0c             	add    $0xc,%esp
+  803c09:	ff 75 10             	push   0x10(%ebp)
+  803c0c:	56                   	push   %esi
+  803c0d:	53                   	push   %ebx
+  803c0e:	e8 37 d5 ff ff       	call   80114a <sys_futex_wait>
+  803c13:	89 c6                	mov    %eax,%esi
+  803c15:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803c1a:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803c1f:	89 3c 24             	mov    %edi,(%esp)
+  803c22:	e8 13 ff ff ff       	call   803b3a <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803c27:	83 c4 10             	add    $0x10,%esp
+  803c2a:	83 fe ef             	cmp    $0xffffffef,%esi
+  803c2d:	74 05                	je     803c34 <cond_timedwait+0x4f>
+  803c2f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803c34:	89 f0                	mov    %esi,%eax
+  803c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c39:	5b                   	pop    %ebx
+  803c3a:	5e                   	pop    %esi
+  803c3b:	5f                   	pop    %edi
+  803c3c:	5d                   	pop    %ebp
+  803c3d:	c3                   	ret
+
+00803c3e <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803c3e:	55                   	push   %ebp
+  803c3f:	89 e5                	mov    %esp,%ebp
+  803c41:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803c44:	6a ff                	push   $0xffffffff
+  803c46:	ff 75 0c             	push   0xc(%ebp)
+  803c49:	ff 75 08             	push   0x8(%ebp)
+  803c4c:	e8 94 ff ff ff       	call   803be5 <cond_timedwait>
+}
+  803c51:	83 c4 10             	add    $0x10,%esp
+  803c54:	c9                   	leave
+  803c55:	c3                   	ret
+
+00803c56 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803c56:	55                   	push   %ebp
+  803c57:	89 e5                	mov    %esp,%ebp
+  803c59:	83 ec 08             	sub    $0x8,%esp
+  803c5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c5f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c64:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803c68:	8b 50 04             	mov    0x4(%eax),%edx
+  803c6b:	85 d2                	test   %edx,%edx
+  803c6d:	75 02                	jne    803c71 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803c6f:	c9                   	leave
+  803c70:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803c71:	83 ec 08             	sub    $0x8,%esp
+  803c74:	6a 01                	push   $0x1
+  803c76:	50                   	push   %eax
+  803c77:	e8 f0 d4 ff ff       	call   80116c <sys_futex_wake>
+  803c7c:	83 c4 10             	add    $0x10,%esp
+}
+  803c7f:	eb ee                	jmp    803c6f <cond_signal+0x19>
+
+00803c81 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803c81:	55                   	push   %ebp
+  803c82:	89 e5                	mov    %esp,%ebp
+  803c84:	83 ec 08             	sub    $0x8,%esp
+  803c87:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c8a:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c8f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803c93:	8b 50 04             	mov    0x4(%eax),%edx
+  803c96:	85 d2                	test   %edx,%edx
+  803c98:	75 02                	jne    803c9c <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803c9a:	c9                   	leave
+  803c9b:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803c9c:	83 ec 08             	sub    $0x8,%esp
+  803c9f:	68 00 04 00 00       	push   $0x400
+  803ca4:	50                   	push   %eax
+  803ca5:	e8 c2 d4 ff ff       	call   80116c <sys_futex_wake>
+  803caa:	83 c4 10             	add    $0x10,%esp
+}
+  803cad:	eb eb                	jmp    803c9a <cond_broadcast+0x19>
+
+00803caf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb4:	c3                   	ret
+
+00803cb5 <devcons_poll>:
+{
+  803cb5:	55                   	push   %ebp
+  803cb6:	89 e5                	mov    %esp,%ebp
+  803cb8:	53                   	push   %ebx
+  803cb9:	83 ec 04             	sub    $0x4,%esp
+  803cbc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803cbf:	89 da                	mov    %ebx,%edx
+  803cc1:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803cc4:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  803ccb:	74 0c                	je     803cd9 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803ccd:	89 d8                	mov    %ebx,%eax
+  803ccf:	83 e0 01             	and    $0x1,%eax
+  803cd2:	09 d0                	or     %edx,%eax
+}
+  803cd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cd7:	c9                   	leave
+  803cd8:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803cd9:	e8 d0 cf ff ff       	call   800cae <sys_cgetc>
+  803cde:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803ce3:	89 da                	mov    %ebx,%edx
+  803ce5:	83 e2 04             	and    $0x4,%edx
+  803ce8:	85 c0                	test   %eax,%eax
+  803cea:	74 e6                	je     803cd2 <devcons_poll+0x1d>
+  803cec:	eb df                	jmp    803ccd <devcons_poll+0x18>
+
+00803cee <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803cee:	55                   	push   %ebp
+  803cef:	89 e5                	mov    %esp,%ebp
+  803cf1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803cf4:	68 16 4a 80 00       	push   $0x804a16
+  803cf9:	ff 75 0c             	push   0xc(%ebp)
+  803cfc:	e8 17 cc ff ff       	call   800918 <strcpy>
+	return 0;
+}
+  803d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d06:	c9                   	leave
+  803d07:	c3                   	ret
+
+00803d08 <devcons_write>:
+{
+  803d08:	55                   	push   %ebp
+  803d09:	89 e5                	mov    %esp,%ebp
+  803d0b:	57                   	push   %edi
+  803d0c:	56                   	push   %esi
+  803d0d:	53                   	push   %ebx
+  803d0e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803d14:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803d17:	85 ff                	test   %edi,%edi
+  803d19:	74 51                	je     803d6c <devcons_write+0x64>
+  803d1b:	be 00 00 00 00       	mov    $0x0,%esi
+  803d20:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803d25:	89 fb                	mov    %edi,%ebx
+  803d27:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803d29:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803d2e:	39 d3                	cmp    %edx,%ebx
+  803d30:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803d33:	83 ec 04             	sub    $0x4,%esp
+  803d36:	53                   	push   %ebx
+  803d37:	03 45 0c             	add    0xc(%ebp),%eax
+  803d3a:	50                   	push   %eax
+  803d3b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803d41:	50                   	push   %eax
+  803d42:	e8 81 cd ff ff       	call   800ac8 <memmove>
+		sys_cputs(buf, m);
+  803d47:	83 c4 08             	add    $0x8,%esp
+  803d4a:	53                   	push   %ebx
+  803d4b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803d51:	50                   	push   %eax
+  803d52:	e8 39 cf ff ff       	call   800c90 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803d57:	01 de                	add    %ebx,%esi
+  803d59:	89 f0                	mov    %esi,%eax
+  803d5b:	83 c4 10             	add    $0x10,%esp
+  803d5e:	39 fe                	cmp    %edi,%esi
+  803d60:	72 c3                	jb     803d25 <devcons_write+0x1d>
+}
+  803d62:	89 f0                	mov    %esi,%eax
+  803d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d67:	5b                   	pop    %ebx
+  803d68:	5e                   	pop    %esi
+  803d69:	5f                   	pop    %edi
+  803d6a:	5d                   	pop    %ebp
+  803d6b:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803d6c:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803d71:	eb ef                	jmp    803d62 <devcons_write+0x5a>
+
+00803d73 <devcons_read>:
+{
+  803d73:	55                   	push   %ebp
+  803d74:	89 e5                	mov    %esp,%ebp
+  803d76:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803d79:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803d7e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803d82:	74 36                	je     803dba <devcons_read+0x47>
+	c = cons_peek;
+  803d84:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  803d89:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  803d90:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803d93:	85 c0                	test   %eax,%eax
+  803d95:	75 10                	jne    803da7 <devcons_read+0x34>
+  803d97:	e8 12 cf ff ff       	call   800cae <sys_cgetc>
+  803d9c:	85 c0                	test   %eax,%eax
+  803d9e:	75 07                	jne    803da7 <devcons_read+0x34>
+		sys_yield();
+  803da0:	e8 88 cf ff ff       	call   800d2d <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803da5:	eb f0                	jmp    803d97 <devcons_read+0x24>
+	if (c < 0)
+  803da7:	85 c0                	test   %eax,%eax
+  803da9:	78 0f                	js     803dba <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803dab:	83 f8 04             	cmp    $0x4,%eax
+  803dae:	74 0c                	je     803dbc <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803db0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803db3:	88 02                	mov    %al,(%edx)
+	return 1;
+  803db5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803dba:	c9                   	leave
+  803dbb:	c3                   	ret
+		return 0;
+  803dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc1:	eb f7                	jmp    803dba <devcons_read+0x47>
+
+00803dc3 <cputchar>:
+{
+  803dc3:	55                   	push   %ebp
+  803dc4:	89 e5                	mov    %esp,%ebp
+  803dc6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dcc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803dcf:	6a 01                	push   $0x1
+  803dd1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803dd4:	50                   	push   %eax
+  803dd5:	e8 b6 ce ff ff       	call   800c90 <sys_cputs>
+}
+  803dda:	83 c4 10             	add    $0x10,%esp
+  803ddd:	c9                   	leave
+  803dde:	c3                   	ret
+
+00803ddf <getchar>:
+{
+  803ddf:	55                   	push   %ebp
+  803de0:	89 e5                	mov    %esp,%ebp
+  803de2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803de5:	6a 01                	push   $0x1
+  803de7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803dea:	50                   	push   %eax
+  803deb:	6a 00                	push   $0x0
+  803ded:	e8 34 de ff ff       	call   801c26 <read>
+	if (r < 0)
+  803df2:	83 c4 10             	add    $0x10,%esp
+  803df5:	85 c0                	test   %eax,%eax
+  803df7:	78 06                	js     803dff <getchar+0x20>
+	if (r < 1)
+  803df9:	74 06                	je     803e01 <getchar+0x22>
+	return c;
+  803dfb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803dff:	c9                   	leave
+  803e00:	c3                   	ret
+		return -E_EOF;
+  803e01:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803e06:	eb f7                	jmp    803dff <getchar+0x20>
+
+00803e08 <iscons>:
+{
+  803e08:	55                   	push   %ebp
+  803e09:	89 e5                	mov    %esp,%ebp
+  803e0b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e11:	50                   	push   %eax
+  803e12:	ff 75 08             	push   0x8(%ebp)
+  803e15:	e8 88 db ff ff       	call   8019a2 <fd_lookup>
+  803e1a:	83 c4 10             	add    $0x10,%esp
+  803e1d:	85 c0                	test   %eax,%eax
+  803e1f:	78 11                	js     803e32 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803e21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e24:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803e2a:	39 10                	cmp    %edx,(%eax)
+  803e2c:	0f 94 c0             	sete   %al
+  803e2f:	0f b6 c0             	movzbl %al,%eax
+}
+  803e32:	c9                   	leave
+  803e33:	c3                   	ret
+
+00803e34 <opencons>:
+{
+  803e34:	55                   	push   %ebp
+  803e35:	89 e5                	mov    %esp,%ebp
+  803e37:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803e3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e3d:	50                   	push   %eax
+  803e3e:	e8 0f db ff ff       	call   801952 <fd_alloc>
+  803e43:	83 c4 10             	add    $0x10,%esp
+  803e46:	85 c0                	test   %eax,%eax
+  803e48:	78 3a                	js     803e84 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803e4a:	83 ec 04             	sub    $0x4,%esp
+  803e4d:	68 07 04 00 00       	push   $0x407
+  803e52:	ff 75 f4             	push   -0xc(%ebp)
+  803e55:	6a 00                	push   $0x0
+  803e57:	e8 f0 ce ff ff       	call   800d4c <sys_page_alloc>
+  803e5c:	83 c4 10             	add    $0x10,%esp
+  803e5f:	85 c0                	test   %eax,%eax
+  803e61:	78 21                	js     803e84 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803e63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e66:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803e6c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803e6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e71:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803e78:	83 ec 0c             	sub    $0xc,%esp
+  803e7b:	50                   	push   %eax
+  803e7c:	e8 aa da ff ff       	call   80192b <fd2num>
+  803e81:	83 c4 10             	add    $0x10,%esp
+}
+  803e84:	c9                   	leave
+  803e85:	c3                   	ret
+
+00803e86 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803e86:	55                   	push   %ebp
+  803e87:	89 e5                	mov    %esp,%ebp
+  803e89:	56                   	push   %esi
+  803e8a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803e8b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803e8e:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803e94:	e8 75 ce ff ff       	call   800d0e <sys_getenvid>
+  803e99:	83 ec 0c             	sub    $0xc,%esp
+  803e9c:	ff 75 0c             	push   0xc(%ebp)
+  803e9f:	ff 75 08             	push   0x8(%ebp)
+  803ea2:	56                   	push   %esi
+  803ea3:	50                   	push   %eax
+  803ea4:	68 24 4a 80 00       	push   $0x804a24
+  803ea9:	e8 73 c3 ff ff       	call   800221 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803eae:	83 c4 18             	add    $0x18,%esp
+  803eb1:	53                   	push   %ebx
+  803eb2:	ff 75 10             	push   0x10(%ebp)
+  803eb5:	e8 16 c3 ff ff       	call   8001d0 <vcprintf>
+	cprintf("\n");
+  803eba:	c7 04 24 8f 44 80 00 	movl   $0x80448f,(%esp)
+  803ec1:	e8 5b c3 ff ff       	call   800221 <cprintf>
+  803ec6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803ec9:	cc                   	int3
+	while (1)
+  803eca:	eb fd                	jmp    803ec9 <_panic+0x43>
+
+00803ecc <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803ecc:	55                   	push   %ebp
+  803ecd:	89 e5                	mov    %esp,%ebp
+  803ecf:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  803ed2:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803ed9:	74 0a                	je     803ee5 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803edb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ede:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803ee3:	c9                   	leave
+  803ee4:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  803ee5:	83 ec 04             	sub    $0x4,%esp
+  803ee8:	6a 07                	push   $0x7
+  803eea:	68 00 f0 bf ee       	push   $0xeebff000
+  803eef:	6a 00                	push   $0x0
+  803ef1:	e8 56 ce ff ff       	call   800d4c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803ef6:	83 c4 08             	add    $0x8,%esp
+  803ef9:	68 0a 3f 80 00       	push   $0x803f0a
+  803efe:	6a 00                	push   $0x0
+  803f00:	e8 92 cf ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  803f05:	83 c4 10             	add    $0x10,%esp
+  803f08:	eb d1                	jmp    803edb <set_pgfault_handler+0xf>
+
+00803f0a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803f0a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803f0b:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  803f10:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803f12:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  803f15:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  803f19:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  803f1c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  803f20:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  803f22:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  803f26:	83 c4 08             	add    $0x8,%esp
+	popal;
+  803f29:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  803f2a:	83 c4 04             	add    $0x4,%esp
+	popf
+  803f2d:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  803f2e:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  803f2f:	c3                   	ret
+
+00803f30 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803f30:	55                   	push   %ebp
+  803f31:	89 e5                	mov    %esp,%ebp
+  803f33:	56                   	push   %esi
+  803f34:	53                   	push   %ebx
+  803f35:	8b 75 08             	mov    0x8(%ebp),%esi
+  803f38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803f3e:	85 c0                	test   %eax,%eax
+  803f40:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f45:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803f48:	83 ec 0c             	sub    $0xc,%esp
+  803f4b:	50                   	push   %eax
+  803f4c:	e8 ab cf ff ff       	call   800efc <sys_ipc_recv>
+  803f51:	83 c4 10             	add    $0x10,%esp
+  803f54:	85 c0                	test   %eax,%eax
+  803f56:	0f 88 8b 00 00 00    	js     803fe7 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803f5c:	85 f6                	test   %esi,%esi
+  803f5e:	74 2a                	je     803f8a <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803f60:	89 e2                	mov    %esp,%edx
+  803f62:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f67:	29 d0                	sub    %edx,%eax
+  803f69:	89 c2                	mov    %eax,%edx
+  803f6b:	c1 ea 0f             	shr    $0xf,%edx
+  803f6e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f78:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803f7b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803f82:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803f88:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803f8a:	85 db                	test   %ebx,%ebx
+  803f8c:	74 2a                	je     803fb8 <ipc_recv+0x88>
+  803f8e:	89 e2                	mov    %esp,%edx
+  803f90:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f95:	29 d0                	sub    %edx,%eax
+  803f97:	89 c2                	mov    %eax,%edx
+  803f99:	c1 ea 0f             	shr    $0xf,%edx
+  803f9c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa6:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803fa9:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803fb0:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803fb6:	89 03                	mov    %eax,(%ebx)
+  803fb8:	89 e2                	mov    %esp,%edx
+  803fba:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803fbf:	29 d0                	sub    %edx,%eax
+  803fc1:	89 c2                	mov    %eax,%edx
+  803fc3:	c1 ea 0f             	shr    $0xf,%edx
+  803fc6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd0:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803fd3:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803fda:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803fe0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803fe3:	5b                   	pop    %ebx
+  803fe4:	5e                   	pop    %esi
+  803fe5:	5d                   	pop    %ebp
+  803fe6:	c3                   	ret
+		if(from_env_store != NULL)
+  803fe7:	85 f6                	test   %esi,%esi
+  803fe9:	74 06                	je     803ff1 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803feb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803ff1:	85 db                	test   %ebx,%ebx
+  803ff3:	74 eb                	je     803fe0 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803ff5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803ffb:	eb e3                	jmp    803fe0 <ipc_recv+0xb0>
+
+00803ffd <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803ffd:	55                   	push   %ebp
+  803ffe:	89 e5                	mov    %esp,%ebp
+  804000:	57                   	push   %edi
+  804001:	56                   	push   %esi
+  804002:	53                   	push   %ebx
+  804003:	83 ec 14             	sub    $0x14,%esp
+  804006:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804009:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80400c:	8b 75 14             	mov    0x14(%ebp),%esi
+  80400f:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804012:	85 c0                	test   %eax,%eax
+  804014:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804019:	0f 44 c2             	cmove  %edx,%eax
+  80401c:	ff 75 10             	push   0x10(%ebp)
+  80401f:	50                   	push   %eax
+  804020:	e8 39 cf ff ff       	call   800f5e <sys_ipc_recv_pages>
+  804025:	83 c4 10             	add    $0x10,%esp
+  804028:	85 c0                	test   %eax,%eax
+  80402a:	0f 88 ba 00 00 00    	js     8040ea <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804030:	85 ff                	test   %edi,%edi
+  804032:	74 2a                	je     80405e <ipc_recv_pages+0x61>
+  804034:	89 e2                	mov    %esp,%edx
+  804036:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80403b:	29 d0                	sub    %edx,%eax
+  80403d:	89 c2                	mov    %eax,%edx
+  80403f:	c1 ea 0f             	shr    $0xf,%edx
+  804042:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80404f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804056:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80405c:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80405e:	85 f6                	test   %esi,%esi
+  804060:	74 2a                	je     80408c <ipc_recv_pages+0x8f>
+  804062:	89 e2                	mov    %esp,%edx
+  804064:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804069:	29 d0                	sub    %edx,%eax
+  80406b:	89 c2                	mov    %eax,%edx
+  80406d:	c1 ea 0f             	shr    $0xf,%edx
+  804070:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80407a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80407d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804084:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80408a:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80408c:	85 db                	test   %ebx,%ebx
+  80408e:	74 2a                	je     8040ba <ipc_recv_pages+0xbd>
+  804090:	89 e2                	mov    %esp,%edx
+  804092:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804097:	29 d0                	sub    %edx,%eax
+  804099:	89 c2                	mov    %eax,%edx
+  80409b:	c1 ea 0f             	shr    $0xf,%edx
+  80409e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a8:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8040ab:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8040b2:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8040b8:	89 03                	mov    %eax,(%ebx)
+  8040ba:	89 e2                	mov    %esp,%edx
+  8040bc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040c1:	29 d0                	sub    %edx,%eax
+  8040c3:	89 c2                	mov    %eax,%edx
+  8040c5:	c1 ea 0f             	shr    $0xf,%edx
+  8040c8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8040d5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8040dc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8040e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040e5:	5b                   	pop    %ebx
+  8040e6:	5e                   	pop    %esi
+  8040e7:	5f                   	pop    %edi
+  8040e8:	5d                   	pop    %ebp
+  8040e9:	c3                   	ret
+		if (from_env_store)
+  8040ea:	85 ff                	test   %edi,%edi
+  8040ec:	74 06                	je     8040f4 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8040ee:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8040f4:	85 f6                	test   %esi,%esi
+  8040f6:	74 06                	je     8040fe <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8040f8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8040fe:	85 db                	test   %ebx,%ebx
+  804100:	74 e0                	je     8040e2 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804102:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804108:	eb d8                	jmp    8040e2 <ipc_recv_pages+0xe5>
+
+0080410a <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80410a:	55                   	push   %ebp
+  80410b:	89 e5                	mov    %esp,%ebp
+  80410d:	57                   	push   %edi
+  80410e:	56                   	push   %esi
+  80410f:	53                   	push   %ebx
+  804110:	83 ec 1c             	sub    $0x1c,%esp
+  804113:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804116:	8b 75 08             	mov    0x8(%ebp),%esi
+  804119:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80411f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804123:	75 2b                	jne    804150 <ipc_try_send_pages+0x46>
+  804125:	89 e2                	mov    %esp,%edx
+  804127:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80412c:	29 d0                	sub    %edx,%eax
+  80412e:	89 c2                	mov    %eax,%edx
+  804130:	c1 ea 0f             	shr    $0xf,%edx
+  804133:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80413d:	0f 42 c2             	cmovb  %edx,%eax
+  804140:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804147:	8b 70 48             	mov    0x48(%eax),%esi
+  80414a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804150:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804156:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80415b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80415e:	85 ff                	test   %edi,%edi
+  804160:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804165:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804168:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80416e:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804174:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80417a:	83 ec 0c             	sub    $0xc,%esp
+  80417d:	ff 75 14             	push   0x14(%ebp)
+  804180:	ff 75 18             	push   0x18(%ebp)
+  804183:	57                   	push   %edi
+  804184:	ff 75 0c             	push   0xc(%ebp)
+  804187:	ff 75 08             	push   0x8(%ebp)
+  80418a:	e8 ae cd ff ff       	call   800f3d <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80418f:	83 c4 20             	add    $0x20,%esp
+  804192:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804195:	75 21                	jne    8041b8 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804197:	83 ec 04             	sub    $0x4,%esp
+  80419a:	6a ff                	push   $0xffffffff
+  80419c:	53                   	push   %ebx
+  80419d:	ff 75 e4             	push   -0x1c(%ebp)
+  8041a0:	e8 a5 cf ff ff       	call   80114a <sys_futex_wait>
+  8041a5:	83 c4 10             	add    $0x10,%esp
+  8041a8:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8041ab:	74 c7                	je     804174 <ipc_try_send_pages+0x6a>
+  8041ad:	85 c0                	test   %eax,%eax
+  8041af:	79 c3                	jns    804174 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8041b1:	e8 77 cb ff ff       	call   800d2d <sys_yield>
+  8041b6:	eb bc                	jmp    804174 <ipc_try_send_pages+0x6a>
+	}
+}
+  8041b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041bb:	5b                   	pop    %ebx
+  8041bc:	5e                   	pop    %esi
+  8041bd:	5f                   	pop    %edi
+  8041be:	5d                   	pop    %ebp
+  8041bf:	c3                   	ret
+
+008041c0 <ipc_send>:
+{
+  8041c0:	55                   	push   %ebp
+  8041c1:	89 e5                	mov    %esp,%ebp
+  8041c3:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8041c6:	ff 75 14             	push   0x14(%ebp)
+  8041c9:	6a 01                	push   $0x1
+  8041cb:	ff 75 10             	push   0x10(%ebp)
+  8041ce:	ff 75 0c             	push   0xc(%ebp)
+  8041d1:	ff 75 08             	push   0x8(%ebp)
+  8041d4:	e8 31 ff ff ff       	call   80410a <ipc_try_send_pages>
+  8041d9:	83 c4 20             	add    $0x20,%esp
+  8041dc:	85 c0                	test   %eax,%eax
+  8041de:	78 02                	js     8041e2 <ipc_send+0x22>
+}
+  8041e0:	c9                   	leave
+  8041e1:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8041e2:	50                   	push   %eax
+  8041e3:	68 47 4a 80 00       	push   $0x804a47
+  8041e8:	6a 3f                	push   $0x3f
+  8041ea:	68 5c 4a 80 00       	push   $0x804a5c
+  8041ef:	e8 92 fc ff ff       	call   803e86 <_panic>
+
+008041f4 <ipc_send_pages>:
+{
+  8041f4:	55                   	push   %ebp
+  8041f5:	89 e5                	mov    %esp,%ebp
+  8041f7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8041fa:	ff 75 18             	push   0x18(%ebp)
+  8041fd:	ff 75 14             	push   0x14(%ebp)
+  804200:	ff 75 10             	push   0x10(%ebp)
+  804203:	ff 75 0c             	push   0xc(%ebp)
+  804206:	ff 75 08             	push   0x8(%ebp)
+  804209:	e8 fc fe ff ff       	call   80410a <ipc_try_send_pages>
+  80420e:	83 c4 20             	add    $0x20,%esp
+  804211:	85 c0                	test   %eax,%eax
+  804213:	78 02                	js     804217 <ipc_send_pages+0x23>
+}
+  804215:	c9                   	leave
+  804216:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804217:	50                   	push   %eax
+  804218:	68 66 4a 80 00       	push   $0x804a66
+  80421d:	6a 64                	push   $0x64
+  80421f:	68 5c 4a 80 00       	push   $0x804a5c
+  804224:	e8 5d fc ff ff       	call   803e86 <_panic>
+
+00804229 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804229:	55                   	push   %ebp
+  80422a:	89 e5                	mov    %esp,%ebp
+  80422c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80422f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804234:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80423a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804240:	8b 52 50             	mov    0x50(%edx),%edx
+  804243:	39 ca                	cmp    %ecx,%edx
+  804245:	74 11                	je     804258 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804247:	83 c0 01             	add    $0x1,%eax
+  80424a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80424f:	75 e3                	jne    804234 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804251:	b8 00 00 00 00       	mov    $0x0,%eax
+  804256:	eb 0e                	jmp    804266 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804258:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80425e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804263:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804266:	5d                   	pop    %ebp
+  804267:	c3                   	ret
+
+00804268 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804268:	55                   	push   %ebp
+  804269:	89 e5                	mov    %esp,%ebp
+  80426b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80426e:	89 c2                	mov    %eax,%edx
+  804270:	c1 ea 16             	shr    $0x16,%edx
+  804273:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80427a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80427f:	f6 c1 01             	test   $0x1,%cl
+  804282:	74 1e                	je     8042a2 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804284:	c1 e8 0c             	shr    $0xc,%eax
+  804287:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80428e:	a8 01                	test   $0x1,%al
+  804290:	74 10                	je     8042a2 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804292:	c1 e8 0c             	shr    $0xc,%eax
+  804295:	c1 e0 04             	shl    $0x4,%eax
+  804298:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80429f:	0f b7 d2             	movzwl %dx,%edx
+}
+  8042a2:	89 d0                	mov    %edx,%eax
+  8042a4:	5d                   	pop    %ebp
+  8042a5:	c3                   	ret
+
+008042a6 <__udivdi3>:
+  8042a6:	57                   	push   %edi
+  8042a7:	56                   	push   %esi
+  8042a8:	53                   	push   %ebx
+  8042a9:	83 ec 20             	sub    $0x20,%esp
+  8042ac:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8042b0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8042b4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8042b8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8042bc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8042c0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8042c4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8042c8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8042cc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8042d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042db:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8042e2:	00 
+  8042e3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8042ea:	00 
+  8042eb:	eb 08                	jmp    8042f5 <__udivdi3+0x4f>
+  8042ed:	83 e9 01             	sub    $0x1,%ecx
+  8042f0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8042f3:	74 68                	je     80435d <__udivdi3+0xb7>
+  8042f5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8042f9:	01 c0                	add    %eax,%eax
+  8042fb:	89 c6                	mov    %eax,%esi
+  8042fd:	89 d7                	mov    %edx,%edi
+  8042ff:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804303:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804307:	0f ad d0             	shrd   %cl,%edx,%eax
+  80430a:	d3 ea                	shr    %cl,%edx
+  80430c:	f6 c1 20             	test   $0x20,%cl
+  80430f:	74 04                	je     804315 <__udivdi3+0x6f>
+  804311:	89 d0                	mov    %edx,%eax
+  804313:	31 d2                	xor    %edx,%edx
+  804315:	83 e0 01             	and    $0x1,%eax
+  804318:	89 04 24             	mov    %eax,(%esp)
+  80431b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804322:	00 
+  804323:	8b 04 24             	mov    (%esp),%eax
+  804326:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80432a:	09 f0                	or     %esi,%eax
+  80432c:	09 fa                	or     %edi,%edx
+  80432e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804332:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804336:	39 f0                	cmp    %esi,%eax
+  804338:	89 d3                	mov    %edx,%ebx
+  80433a:	19 fb                	sbb    %edi,%ebx
+  80433c:	72 af                	jb     8042ed <__udivdi3+0x47>
+  80433e:	29 f0                	sub    %esi,%eax
+  804340:	19 fa                	sbb    %edi,%edx
+  804342:	89 cf                	mov    %ecx,%edi
+  804344:	c1 ef 05             	shr    $0x5,%edi
+  804347:	83 e7 01             	and    $0x1,%edi
+  80434a:	89 fe                	mov    %edi,%esi
+  80434c:	83 f6 01             	xor    $0x1,%esi
+  80434f:	d3 e6                	shl    %cl,%esi
+  804351:	d3 e7                	shl    %cl,%edi
+  804353:	09 74 24 18          	or     %esi,0x18(%esp)
+  804357:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80435b:	eb 90                	jmp    8042ed <__udivdi3+0x47>
+  80435d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804361:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804365:	83 c4 20             	add    $0x20,%esp
+  804368:	5b                   	pop    %ebx
+  804369:	5e                   	pop    %esi
+  80436a:	5f                   	pop    %edi
+  80436b:	c3                   	ret
+
+0080436c <__umoddi3>:
+  80436c:	57                   	push   %edi
+  80436d:	56                   	push   %esi
+  80436e:	53                   	push   %ebx
+  80436f:	83 ec 08             	sub    $0x8,%esp
+  804372:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804376:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80437a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80437e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804382:	57                   	push   %edi
+  804383:	56                   	push   %esi
+  804384:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804388:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80438c:	52                   	push   %edx
+  80438d:	50                   	push   %eax
+  80438e:	e8 13 ff ff ff       	call   8042a6 <__udivdi3>
+  804393:	89 c3                	mov    %eax,%ebx
+  804395:	0f af d6             	imul   %esi,%edx
+  804398:	89 f9                	mov    %edi,%ecx
+  80439a:	0f af cb             	imul   %ebx,%ecx
+  80439d:	01 d1                	add    %edx,%ecx
+  80439f:	89 d8                	mov    %ebx,%eax
+  8043a1:	f7 e6                	mul    %esi
+  8043a3:	89 c6                	mov    %eax,%esi
+  8043a5:	89 d7                	mov    %edx,%edi
+  8043a7:	01 cf                	add    %ecx,%edi
+  8043a9:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8043ad:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8043b1:	29 f0                	sub    %esi,%eax
+  8043b3:	19 fa                	sbb    %edi,%edx
+  8043b5:	83 c4 18             	add    $0x18,%esp
+  8043b8:	5b                   	pop    %ebx
+  8043b9:	5e                   	pop    %esi
+  8043ba:	5f                   	pop    %edi
+  8043bb:	c3                   	ret
+
+008043bc <__divdi3>:
+  8043bc:	53                   	push   %ebx
+  8043bd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8043c1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8043c5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8043c9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8043cd:	85 d2                	test   %edx,%edx
+  8043cf:	78 12                	js     8043e3 <__divdi3+0x27>
+  8043d1:	85 db                	test   %ebx,%ebx
+  8043d3:	78 2e                	js     804403 <__divdi3+0x47>
+  8043d5:	53                   	push   %ebx
+  8043d6:	51                   	push   %ecx
+  8043d7:	52                   	push   %edx
+  8043d8:	50                   	push   %eax
+  8043d9:	e8 c8 fe ff ff       	call   8042a6 <__udivdi3>
+  8043de:	83 c4 10             	add    $0x10,%esp
+  8043e1:	eb 1e                	jmp    804401 <__divdi3+0x45>
+  8043e3:	f7 d8                	neg    %eax
+  8043e5:	83 d2 00             	adc    $0x0,%edx
+  8043e8:	f7 da                	neg    %edx
+  8043ea:	85 db                	test   %ebx,%ebx
+  8043ec:	78 2a                	js     804418 <__divdi3+0x5c>
+  8043ee:	53                   	push   %ebx
+  8043ef:	51                   	push   %ecx
+  8043f0:	52                   	push   %edx
+  8043f1:	50                   	push   %eax
+  8043f2:	e8 af fe ff ff       	call   8042a6 <__udivdi3>
+  8043f7:	83 c4 10             	add    $0x10,%esp
+  8043fa:	f7 d8                	neg    %eax
+  8043fc:	83 d2 00             	adc    $0x0,%edx
+  8043ff:	f7 da                	neg    %edx
+  804401:	5b                   	pop    %ebx
+  804402:	c3                   	ret
+  804403:	f7 d9                	neg    %ecx
+  804405:	83 d3 00             	adc    $0x0,%ebx
+  804408:	f7 db                	neg    %ebx
+  80440a:	53                   	push   %ebx
+  80440b:	51                   	push   %ecx
+  80440c:	52                   	push   %edx
+  80440d:	50                   	push   %eax
+  80440e:	e8 93 fe ff ff       	call   8042a6 <__udivdi3>
+  804413:	83 c4 10             	add    $0x10,%esp
+  804416:	eb e2                	jmp    8043fa <__divdi3+0x3e>
+  804418:	f7 d9                	neg    %ecx
+  80441a:	83 d3 00             	adc    $0x0,%ebx
+  80441d:	f7 db                	neg    %ebx
+  80441f:	53                   	push   %ebx
+  804420:	51                   	push   %ecx
+  804421:	52                   	push   %edx
+  804422:	50                   	push   %eax
+  804423:	e8 7e fe ff ff       	call   8042a6 <__udivdi3>
+  804428:	83 c4 10             	add    $0x10,%esp
+  80442b:	eb d4                	jmp    804401 <__divdi3+0x45>
+
+0080442d <__moddi3>:
+  80442d:	57                   	push   %edi
+  80442e:	56                   	push   %esi
+  80442f:	53                   	push   %ebx
+  804430:	83 ec 08             	sub    $0x8,%esp
+  804433:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804437:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80443b:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80443f:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804443:	57                   	push   %edi
+  804444:	56                   	push   %esi
+  804445:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804449:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80444d:	52                   	push   %edx
+  80444e:	50                   	push   %eax
+  80444f:	e8 68 ff ff ff       	call   8043bc <__divdi3>
+  804454:	89 c3                	mov    %eax,%ebx
+  804456:	0f af d6             	imul   %esi,%edx
+  804459:	89 f9                	mov    %edi,%ecx
+  80445b:	0f af cb             	imul   %ebx,%ecx
+  80445e:	01 d1                	add    %edx,%ecx
+  804460:	89 d8                	mov    %ebx,%eax
+  804462:	f7 e6                	mul    %esi
+  804464:	89 c6                	mov    %eax,%esi
+  804466:	89 d7                	mov    %edx,%edi
+  804468:	01 cf                	add    %ecx,%edi
+  80446a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80446e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804472:	29 f0                	sub    %esi,%eax
+  804474:	19 fa                	sbb    %edi,%edx
+  804476:	83 c4 18             	add    $0x18,%esp
+  804479:	5b                   	pop    %ebx
+  80447a:	5e                   	pop    %esi
+  80447b:	5f                   	pop    %edi
+  80447c:	c3                   	ret
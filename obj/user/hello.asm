@@ -0,0 +1,7877 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4c 00 00 00       	call   80007d <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  80003b:	68 c0 3a 80 00       	push   $0x803ac0
+  800040:	e8 74 01 00 00       	call   8001b9 <cprintf>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800045:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800047:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80004c:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  80004e:	83 c4 08             	add    $0x8,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800051:	89 c2                	mov    %eax,%edx
+  800053:	c1 ea 0f             	shr    $0xf,%edx
+  800056:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800060:	0f 42 c2             	cmovb  %edx,%eax
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800063:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80006a:	8b 40 48             	mov    0x48(%eax),%eax
+  80006d:	50                   	push   %eax
+  80006e:	68 ce 3a 80 00       	push   $0x803ace
+  800073:	e8 41 01 00 00       	call   8001b9 <cprintf>
+}
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	c9                   	leave
+  80007c:	c3                   	ret
+
+0080007d <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80007d:	55                   	push   %ebp
+  80007e:	89 e5                	mov    %esp,%ebp
+  800080:	56                   	push   %esi
+  800081:	53                   	push   %ebx
+  800082:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800085:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800088:	89 e2                	mov    %esp,%edx
+  80008a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80008f:	29 d0                	sub    %edx,%eax
+  800091:	89 c2                	mov    %eax,%edx
+  800093:	c1 ea 0f             	shr    $0xf,%edx
+  800096:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8000a3:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  8000aa:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8000ae:	e8 f3 0b 00 00       	call   800ca6 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8000b3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b8:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8000be:	89 e1                	mov    %esp,%ecx
+  8000c0:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8000c5:	29 ca                	sub    %ecx,%edx
+  8000c7:	89 d1                	mov    %edx,%ecx
+  8000c9:	c1 e9 0f             	shr    $0xf,%ecx
+  8000cc:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d7:	0f 42 d1             	cmovb  %ecx,%edx
+  8000da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000df:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000e6:	85 db                	test   %ebx,%ebx
+  8000e8:	7e 07                	jle    8000f1 <libmain+0x74>
+		binaryname = argv[0];
+  8000ea:	8b 06                	mov    (%esi),%eax
+  8000ec:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000f1:	83 ec 08             	sub    $0x8,%esp
+  8000f4:	56                   	push   %esi
+  8000f5:	53                   	push   %ebx
+  8000f6:	e8 3a ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000fb:	e8 0a 00 00 00       	call   80010a <exit>
+}
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800106:	5b                   	pop    %ebx
+  800107:	5e                   	pop    %esi
+  800108:	5d                   	pop    %ebp
+  800109:	c3                   	ret
+
+0080010a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80010a:	55                   	push   %ebp
+  80010b:	89 e5                	mov    %esp,%ebp
+  80010d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800110:	e8 1b 12 00 00       	call   801330 <close_all>
+	sys_env_destroy(0);
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	6a 00                	push   $0x0
+  80011a:	e8 46 0b 00 00       	call   800c65 <sys_env_destroy>
+}
+  80011f:	83 c4 10             	add    $0x10,%esp
+  800122:	c9                   	leave
+  800123:	c3                   	ret
+
+00800124 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800124:	55                   	push   %ebp
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	53                   	push   %ebx
+  800128:	83 ec 04             	sub    $0x4,%esp
+  80012b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012e:	8b 13                	mov    (%ebx),%edx
+  800130:	8d 42 01             	lea    0x1(%edx),%eax
+  800133:	89 03                	mov    %eax,(%ebx)
+  800135:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800138:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800141:	74 09                	je     80014c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800143:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014c:	83 ec 08             	sub    $0x8,%esp
+  80014f:	68 ff 00 00 00       	push   $0xff
+  800154:	8d 43 08             	lea    0x8(%ebx),%eax
+  800157:	50                   	push   %eax
+  800158:	e8 cb 0a 00 00       	call   800c28 <sys_cputs>
+		b->idx = 0;
+  80015d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800163:	83 c4 10             	add    $0x10,%esp
+  800166:	eb db                	jmp    800143 <putch+0x1f>
+
+00800168 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800168:	55                   	push   %ebp
+  800169:	89 e5                	mov    %esp,%ebp
+  80016b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800171:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800178:	00 00 00 
+	b.cnt = 0;
+  80017b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800182:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800185:	ff 75 0c             	push   0xc(%ebp)
+  800188:	ff 75 08             	push   0x8(%ebp)
+  80018b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800191:	50                   	push   %eax
+  800192:	68 24 01 80 00       	push   $0x800124
+  800197:	e8 1c 01 00 00       	call   8002b8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019c:	83 c4 08             	add    $0x8,%esp
+  80019f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ab:	50                   	push   %eax
+  8001ac:	e8 77 0a 00 00       	call   800c28 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+
+008001b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b9:	55                   	push   %ebp
+  8001ba:	89 e5                	mov    %esp,%ebp
+  8001bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c2:	50                   	push   %eax
+  8001c3:	ff 75 08             	push   0x8(%ebp)
+  8001c6:	e8 9d ff ff ff       	call   800168 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001cb:	c9                   	leave
+  8001cc:	c3                   	ret
+
+008001cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cd:	55                   	push   %ebp
+  8001ce:	89 e5                	mov    %esp,%ebp
+  8001d0:	57                   	push   %edi
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	83 ec 1c             	sub    $0x1c,%esp
+  8001d6:	89 c3                	mov    %eax,%ebx
+  8001d8:	89 d6                	mov    %edx,%esi
+  8001da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001e0:	89 d1                	mov    %edx,%ecx
+  8001e2:	89 c2                	mov    %eax,%edx
+  8001e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ea:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f7:	39 c2                	cmp    %eax,%edx
+  8001f9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fc:	73 4b                	jae    800249 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8001fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800201:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800204:	85 ff                	test   %edi,%edi
+  800206:	7e 11                	jle    800219 <printnum+0x4c>
+			putch(padc, putdat);
+  800208:	83 ec 08             	sub    $0x8,%esp
+  80020b:	56                   	push   %esi
+  80020c:	ff 75 18             	push   0x18(%ebp)
+  80020f:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800211:	83 c4 10             	add    $0x10,%esp
+  800214:	83 ef 01             	sub    $0x1,%edi
+  800217:	75 ef                	jne    800208 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800219:	83 ec 08             	sub    $0x8,%esp
+  80021c:	56                   	push   %esi
+  80021d:	83 ec 04             	sub    $0x4,%esp
+  800220:	ff 75 e4             	push   -0x1c(%ebp)
+  800223:	ff 75 e0             	push   -0x20(%ebp)
+  800226:	ff 75 dc             	push   -0x24(%ebp)
+  800229:	ff 75 d8             	push   -0x28(%ebp)
+  80022c:	e8 70 37 00 00       	call   8039a1 <__umoddi3>
+  800231:	83 c4 14             	add    $0x14,%esp
+  800234:	0f be 80 ef 3a 80 00 	movsbl 0x803aef(%eax),%eax
+  80023b:	50                   	push   %eax
+  80023c:	ff d3                	call   *%ebx
+}
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800244:	5b                   	pop    %ebx
+  800245:	5e                   	pop    %esi
+  800246:	5f                   	pop    %edi
+  800247:	5d                   	pop    %ebp
+  800248:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800249:	83 ec 0c             	sub    $0xc,%esp
+  80024c:	ff 75 18             	push   0x18(%ebp)
+  80024f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800252:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800255:	52                   	push   %edx
+  800256:	50                   	push   %eax
+  800257:	83 ec 08             	sub    $0x8,%esp
+  80025a:	ff 75 e4             	push   -0x1c(%ebp)
+  80025d:	ff 75 e0             	push   -0x20(%ebp)
+  800260:	ff 75 dc             	push   -0x24(%ebp)
+  800263:	ff 75 d8             	push   -0x28(%ebp)
+  800266:	e8 70 36 00 00       	call   8038db <__udivdi3>
+  80026b:	83 c4 18             	add    $0x18,%esp
+  80026e:	52                   	push   %edx
+  80026f:	50                   	push   %eax
+  800270:	89 f2                	mov    %esi,%edx
+  800272:	89 d8                	mov    %ebx,%eax
+  800274:	e8 54 ff ff ff       	call   8001cd <printnum>
+  800279:	83 c4 20             	add    $0x20,%esp
+  80027c:	eb 9b                	jmp    800219 <printnum+0x4c>
+
+0080027e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80027e:	55                   	push   %ebp
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800284:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800288:	8b 10                	mov    (%eax),%edx
+  80028a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80028d:	73 0a                	jae    800299 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80028f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800292:	89 08                	mov    %ecx,(%eax)
+  800294:	8b 45 08             	mov    0x8(%ebp),%eax
+  800297:	88 02                	mov    %al,(%edx)
+}
+  800299:	5d                   	pop    %ebp
+  80029a:	c3                   	ret
+
+0080029b <printfmt>:
+{
+  80029b:	55                   	push   %ebp
+  80029c:	89 e5                	mov    %esp,%ebp
+  80029e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002a1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002a4:	50                   	push   %eax
+  8002a5:	ff 75 10             	push   0x10(%ebp)
+  8002a8:	ff 75 0c             	push   0xc(%ebp)
+  8002ab:	ff 75 08             	push   0x8(%ebp)
+  8002ae:	e8 05 00 00 00       	call   8002b8 <vprintfmt>
+}
+  8002b3:	83 c4 10             	add    $0x10,%esp
+  8002b6:	c9                   	leave
+  8002b7:	c3                   	ret
+
+008002b8 <vprintfmt>:
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	57                   	push   %edi
+  8002bc:	56                   	push   %esi
+  8002bd:	53                   	push   %ebx
+  8002be:	83 ec 2c             	sub    $0x2c,%esp
+  8002c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002c4:	89 df                	mov    %ebx,%edi
+  8002c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002c9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002cc:	8d 70 01             	lea    0x1(%eax),%esi
+  8002cf:	0f b6 00             	movzbl (%eax),%eax
+  8002d2:	83 f8 25             	cmp    $0x25,%eax
+  8002d5:	74 1e                	je     8002f5 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8002d7:	85 c0                	test   %eax,%eax
+  8002d9:	0f 84 15 05 00 00    	je     8007f4 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8002df:	83 ec 08             	sub    $0x8,%esp
+  8002e2:	53                   	push   %ebx
+  8002e3:	50                   	push   %eax
+  8002e4:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002e6:	83 c6 01             	add    $0x1,%esi
+  8002e9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	83 f8 25             	cmp    $0x25,%eax
+  8002f3:	75 e2                	jne    8002d7 <vprintfmt+0x1f>
+		padc = ' ';
+  8002f5:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8002f9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800300:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800307:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80030e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800313:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800316:	8d 56 01             	lea    0x1(%esi),%edx
+  800319:	0f b6 0e             	movzbl (%esi),%ecx
+  80031c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80031f:	3c 55                	cmp    $0x55,%al
+  800321:	0f 87 3b 04 00 00    	ja     800762 <vprintfmt+0x4aa>
+  800327:	0f b6 c0             	movzbl %al,%eax
+  80032a:	ff 24 85 60 3c 80 00 	jmp    *0x803c60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800331:	89 75 10             	mov    %esi,0x10(%ebp)
+  800334:	eb 93                	jmp    8002c9 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800336:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800338:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80033c:	eb d8                	jmp    800316 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80033e:	89 d6                	mov    %edx,%esi
+  800340:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800344:	eb d0                	jmp    800316 <vprintfmt+0x5e>
+  800346:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800349:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80034c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80034f:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800353:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800356:	83 f9 09             	cmp    $0x9,%ecx
+  800359:	77 6f                	ja     8003ca <vprintfmt+0x112>
+  80035b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80035e:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800361:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800364:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800368:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80036b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80036e:	83 fe 09             	cmp    $0x9,%esi
+  800371:	76 eb                	jbe    80035e <vprintfmt+0xa6>
+  800373:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800376:	89 d6                	mov    %edx,%esi
+  800378:	eb 13                	jmp    80038d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80037a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037d:	8b 00                	mov    (%eax),%eax
+  80037f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800382:	8b 45 14             	mov    0x14(%ebp),%eax
+  800385:	8d 40 04             	lea    0x4(%eax),%eax
+  800388:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80038d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800391:	79 83                	jns    800316 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800393:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800396:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800399:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003a0:	e9 71 ff ff ff       	jmp    800316 <vprintfmt+0x5e>
+			if (width < 0)
+  8003a5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a8:	85 c9                	test   %ecx,%ecx
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	0f 49 c1             	cmovns %ecx,%eax
+  8003b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b5:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003b7:	e9 5a ff ff ff       	jmp    800316 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8003be:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c5:	e9 4c ff ff ff       	jmp    800316 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ca:	89 d6                	mov    %edx,%esi
+  8003cc:	eb bf                	jmp    80038d <vprintfmt+0xd5>
+			lflag++;
+  8003ce:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d2:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003d4:	e9 3d ff ff ff       	jmp    800316 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8003d9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003df:	8d 70 04             	lea    0x4(%eax),%esi
+  8003e2:	83 ec 08             	sub    $0x8,%esp
+  8003e5:	53                   	push   %ebx
+  8003e6:	ff 30                	push   (%eax)
+  8003e8:	ff d7                	call   *%edi
+			break;
+  8003ea:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ed:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8003f0:	e9 d4 fe ff ff       	jmp    8002c9 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8003f5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fb:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8003fe:	8b 10                	mov    (%eax),%edx
+  800400:	89 d0                	mov    %edx,%eax
+  800402:	f7 d8                	neg    %eax
+  800404:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800407:	83 f8 12             	cmp    $0x12,%eax
+  80040a:	7f 23                	jg     80042f <vprintfmt+0x177>
+  80040c:	8b 14 85 c0 3d 80 00 	mov    0x803dc0(,%eax,4),%edx
+  800413:	85 d2                	test   %edx,%edx
+  800415:	74 18                	je     80042f <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800417:	52                   	push   %edx
+  800418:	68 1b 3f 80 00       	push   $0x803f1b
+  80041d:	53                   	push   %ebx
+  80041e:	57                   	push   %edi
+  80041f:	e8 77 fe ff ff       	call   80029b <printfmt>
+  800424:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800427:	89 75 14             	mov    %esi,0x14(%ebp)
+  80042a:	e9 9a fe ff ff       	jmp    8002c9 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80042f:	50                   	push   %eax
+  800430:	68 07 3b 80 00       	push   $0x803b07
+  800435:	53                   	push   %ebx
+  800436:	57                   	push   %edi
+  800437:	e8 5f fe ff ff       	call   80029b <printfmt>
+  80043c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043f:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800442:	e9 82 fe ff ff       	jmp    8002c9 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800447:	89 55 10             	mov    %edx,0x10(%ebp)
+  80044a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044d:	83 c0 04             	add    $0x4,%eax
+  800450:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800453:	8b 45 14             	mov    0x14(%ebp),%eax
+  800456:	8b 00                	mov    (%eax),%eax
+  800458:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80045b:	85 c0                	test   %eax,%eax
+  80045d:	0f 84 61 03 00 00    	je     8007c4 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800463:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800467:	7e 06                	jle    80046f <vprintfmt+0x1b7>
+  800469:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80046d:	75 29                	jne    800498 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80046f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800472:	8d 70 01             	lea    0x1(%eax),%esi
+  800475:	0f b6 00             	movzbl (%eax),%eax
+  800478:	0f be d0             	movsbl %al,%edx
+  80047b:	85 d2                	test   %edx,%edx
+  80047d:	0f 84 bb 00 00 00    	je     80053e <vprintfmt+0x286>
+  800483:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800486:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800489:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80048c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80048f:	eb 7a                	jmp    80050b <vprintfmt+0x253>
+				p = "(null)";
+  800491:	c7 45 d0 00 3b 80 00 	movl   $0x803b00,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	ff 75 d4             	push   -0x2c(%ebp)
+  80049e:	ff 75 d0             	push   -0x30(%ebp)
+  8004a1:	e8 e0 03 00 00       	call   800886 <strnlen>
+  8004a6:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004ac:	83 c4 10             	add    $0x10,%esp
+  8004af:	85 d2                	test   %edx,%edx
+  8004b1:	0f 8e d6 02 00 00    	jle    80078d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8004b7:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004bb:	83 ec 08             	sub    $0x8,%esp
+  8004be:	53                   	push   %ebx
+  8004bf:	56                   	push   %esi
+  8004c0:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c2:	83 c4 10             	add    $0x10,%esp
+  8004c5:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004c9:	75 f0                	jne    8004bb <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004ce:	8d 70 01             	lea    0x1(%eax),%esi
+  8004d1:	0f b6 00             	movzbl (%eax),%eax
+  8004d4:	0f be d0             	movsbl %al,%edx
+  8004d7:	85 d2                	test   %edx,%edx
+  8004d9:	0f 84 da 02 00 00    	je     8007b9 <vprintfmt+0x501>
+  8004df:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004e2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004e5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004eb:	eb 1e                	jmp    80050b <vprintfmt+0x253>
+					putch(ch, putdat);
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+  8004f0:	ff 75 0c             	push   0xc(%ebp)
+  8004f3:	52                   	push   %edx
+  8004f4:	ff 55 08             	call   *0x8(%ebp)
+  8004f7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004fa:	83 eb 01             	sub    $0x1,%ebx
+  8004fd:	83 c6 01             	add    $0x1,%esi
+  800500:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800504:	0f be d0             	movsbl %al,%edx
+  800507:	85 d2                	test   %edx,%edx
+  800509:	74 2a                	je     800535 <vprintfmt+0x27d>
+  80050b:	85 ff                	test   %edi,%edi
+  80050d:	78 05                	js     800514 <vprintfmt+0x25c>
+  80050f:	83 ef 01             	sub    $0x1,%edi
+  800512:	78 59                	js     80056d <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800514:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800518:	74 d3                	je     8004ed <vprintfmt+0x235>
+  80051a:	0f be c0             	movsbl %al,%eax
+  80051d:	83 e8 20             	sub    $0x20,%eax
+  800520:	83 f8 5e             	cmp    $0x5e,%eax
+  800523:	76 c8                	jbe    8004ed <vprintfmt+0x235>
+					putch('?', putdat);
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	ff 75 0c             	push   0xc(%ebp)
+  80052b:	6a 3f                	push   $0x3f
+  80052d:	ff 55 08             	call   *0x8(%ebp)
+  800530:	83 c4 10             	add    $0x10,%esp
+  800533:	eb c5                	jmp    8004fa <vprintfmt+0x242>
+  800535:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800538:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80053b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80053e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800541:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800545:	7e 1b                	jle    800562 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800547:	83 ec 08             	sub    $0x8,%esp
+  80054a:	53                   	push   %ebx
+  80054b:	6a 20                	push   $0x20
+  80054d:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80054f:	83 c4 10             	add    $0x10,%esp
+  800552:	83 ee 01             	sub    $0x1,%esi
+  800555:	75 f0                	jne    800547 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800557:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055d:	e9 67 fd ff ff       	jmp    8002c9 <vprintfmt+0x11>
+  800562:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800565:	89 45 14             	mov    %eax,0x14(%ebp)
+  800568:	e9 5c fd ff ff       	jmp    8002c9 <vprintfmt+0x11>
+  80056d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800570:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800573:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800576:	eb c6                	jmp    80053e <vprintfmt+0x286>
+	if (lflag >= 2)
+  800578:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80057b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80057e:	83 f9 01             	cmp    $0x1,%ecx
+  800581:	7f 1f                	jg     8005a2 <vprintfmt+0x2ea>
+	else if (lflag)
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	74 67                	je     8005ee <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8b 30                	mov    (%eax),%esi
+  80058c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80058f:	89 f0                	mov    %esi,%eax
+  800591:	c1 f8 1f             	sar    $0x1f,%eax
+  800594:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8d 40 04             	lea    0x4(%eax),%eax
+  80059d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a0:	eb 17                	jmp    8005b9 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8005a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a5:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a8:	8b 00                	mov    (%eax),%eax
+  8005aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ad:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005b9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005bc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005bf:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8005c4:	85 c9                	test   %ecx,%ecx
+  8005c6:	0f 89 12 01 00 00    	jns    8006de <vprintfmt+0x426>
+				putch('-', putdat);
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	53                   	push   %ebx
+  8005d0:	6a 2d                	push   $0x2d
+  8005d2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8005d4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005da:	f7 da                	neg    %edx
+  8005dc:	83 d1 00             	adc    $0x0,%ecx
+  8005df:	f7 d9                	neg    %ecx
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005e4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005e9:	e9 f0 00 00 00       	jmp    8006de <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 30                	mov    (%eax),%esi
+  8005f3:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005f6:	89 f0                	mov    %esi,%eax
+  8005f8:	c1 f8 1f             	sar    $0x1f,%eax
+  8005fb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8d 40 04             	lea    0x4(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+  800607:	eb b0                	jmp    8005b9 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800609:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80060c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80060f:	83 f9 01             	cmp    $0x1,%ecx
+  800612:	7f 1e                	jg     800632 <vprintfmt+0x37a>
+	else if (lflag)
+  800614:	85 c9                	test   %ecx,%ecx
+  800616:	74 32                	je     80064a <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 10                	mov    (%eax),%edx
+  80061d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800622:	8d 40 04             	lea    0x4(%eax),%eax
+  800625:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800628:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80062d:	e9 ac 00 00 00       	jmp    8006de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8b 10                	mov    (%eax),%edx
+  800637:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063a:	8d 40 08             	lea    0x8(%eax),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800640:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800645:	e9 94 00 00 00       	jmp    8006de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8b 10                	mov    (%eax),%edx
+  80064f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800654:	8d 40 04             	lea    0x4(%eax),%eax
+  800657:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80065f:	eb 7d                	jmp    8006de <vprintfmt+0x426>
+	if (lflag >= 2)
+  800661:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800664:	89 55 10             	mov    %edx,0x10(%ebp)
+  800667:	83 f9 01             	cmp    $0x1,%ecx
+  80066a:	7f 1b                	jg     800687 <vprintfmt+0x3cf>
+	else if (lflag)
+  80066c:	85 c9                	test   %ecx,%ecx
+  80066e:	74 2c                	je     80069c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 10                	mov    (%eax),%edx
+  800675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067a:	8d 40 04             	lea    0x4(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800680:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800685:	eb 57                	jmp    8006de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068f:	8d 40 08             	lea    0x8(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800695:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80069a:	eb 42                	jmp    8006de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ac:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8006b1:	eb 2b                	jmp    8006de <vprintfmt+0x426>
+			putch('0', putdat);
+  8006b3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	53                   	push   %ebx
+  8006ba:	6a 30                	push   $0x30
+  8006bc:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8006be:	83 c4 08             	add    $0x8,%esp
+  8006c1:	53                   	push   %ebx
+  8006c2:	6a 78                	push   $0x78
+  8006c4:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 10                	mov    (%eax),%edx
+  8006cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006d0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d9:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8006de:	83 ec 0c             	sub    $0xc,%esp
+  8006e1:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006e5:	50                   	push   %eax
+  8006e6:	ff 75 e4             	push   -0x1c(%ebp)
+  8006e9:	56                   	push   %esi
+  8006ea:	51                   	push   %ecx
+  8006eb:	52                   	push   %edx
+  8006ec:	89 da                	mov    %ebx,%edx
+  8006ee:	89 f8                	mov    %edi,%eax
+  8006f0:	e8 d8 fa ff ff       	call   8001cd <printnum>
+			break;
+  8006f5:	83 c4 20             	add    $0x20,%esp
+  8006f8:	e9 cc fb ff ff       	jmp    8002c9 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8006fd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800700:	89 55 10             	mov    %edx,0x10(%ebp)
+  800703:	83 f9 01             	cmp    $0x1,%ecx
+  800706:	7f 1b                	jg     800723 <vprintfmt+0x46b>
+	else if (lflag)
+  800708:	85 c9                	test   %ecx,%ecx
+  80070a:	74 2c                	je     800738 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8b 10                	mov    (%eax),%edx
+  800711:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800716:	8d 40 04             	lea    0x4(%eax),%eax
+  800719:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800721:	eb bb                	jmp    8006de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800723:	8b 45 14             	mov    0x14(%ebp),%eax
+  800726:	8b 10                	mov    (%eax),%edx
+  800728:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072b:	8d 40 08             	lea    0x8(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800731:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800736:	eb a6                	jmp    8006de <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800738:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073b:	8b 10                	mov    (%eax),%edx
+  80073d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800742:	8d 40 04             	lea    0x4(%eax),%eax
+  800745:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800748:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80074d:	eb 8f                	jmp    8006de <vprintfmt+0x426>
+			putch(ch, putdat);
+  80074f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800752:	83 ec 08             	sub    $0x8,%esp
+  800755:	53                   	push   %ebx
+  800756:	6a 25                	push   $0x25
+  800758:	ff d7                	call   *%edi
+			break;
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	e9 67 fb ff ff       	jmp    8002c9 <vprintfmt+0x11>
+			putch('%', putdat);
+  800762:	83 ec 08             	sub    $0x8,%esp
+  800765:	53                   	push   %ebx
+  800766:	6a 25                	push   $0x25
+  800768:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80076a:	83 c4 10             	add    $0x10,%esp
+  80076d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800771:	0f 84 ba fb ff ff    	je     800331 <vprintfmt+0x79>
+  800777:	89 75 10             	mov    %esi,0x10(%ebp)
+  80077a:	89 f0                	mov    %esi,%eax
+  80077c:	83 e8 01             	sub    $0x1,%eax
+  80077f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800783:	75 f7                	jne    80077c <vprintfmt+0x4c4>
+  800785:	89 45 10             	mov    %eax,0x10(%ebp)
+  800788:	e9 3c fb ff ff       	jmp    8002c9 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80078d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800790:	8d 70 01             	lea    0x1(%eax),%esi
+  800793:	0f b6 00             	movzbl (%eax),%eax
+  800796:	0f be d0             	movsbl %al,%edx
+  800799:	85 d2                	test   %edx,%edx
+  80079b:	74 11                	je     8007ae <vprintfmt+0x4f6>
+  80079d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007a0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007a3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007a6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007a9:	e9 5d fd ff ff       	jmp    80050b <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007ae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b4:	e9 10 fb ff ff       	jmp    8002c9 <vprintfmt+0x11>
+  8007b9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bf:	e9 05 fb ff ff       	jmp    8002c9 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8007c4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007c8:	7e 0a                	jle    8007d4 <vprintfmt+0x51c>
+  8007ca:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007ce:	0f 85 bd fc ff ff    	jne    800491 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007d4:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007d9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007de:	be 01 3b 80 00       	mov    $0x803b01,%esi
+  8007e3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007e6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007e9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007ec:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007ef:	e9 17 fd ff ff       	jmp    80050b <vprintfmt+0x253>
+}
+  8007f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007f7:	5b                   	pop    %ebx
+  8007f8:	5e                   	pop    %esi
+  8007f9:	5f                   	pop    %edi
+  8007fa:	5d                   	pop    %ebp
+  8007fb:	c3                   	ret
+
+008007fc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007fc:	55                   	push   %ebp
+  8007fd:	89 e5                	mov    %esp,%ebp
+  8007ff:	83 ec 18             	sub    $0x18,%esp
+  800802:	8b 45 08             	mov    0x8(%ebp),%eax
+  800805:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800808:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80080b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80080f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800812:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800819:	85 c0                	test   %eax,%eax
+  80081b:	74 26                	je     800843 <vsnprintf+0x47>
+  80081d:	85 d2                	test   %edx,%edx
+  80081f:	7e 22                	jle    800843 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800821:	ff 75 14             	push   0x14(%ebp)
+  800824:	ff 75 10             	push   0x10(%ebp)
+  800827:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80082a:	50                   	push   %eax
+  80082b:	68 7e 02 80 00       	push   $0x80027e
+  800830:	e8 83 fa ff ff       	call   8002b8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800835:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800838:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80083b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80083e:	83 c4 10             	add    $0x10,%esp
+}
+  800841:	c9                   	leave
+  800842:	c3                   	ret
+		return -E_INVAL;
+  800843:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800848:	eb f7                	jmp    800841 <vsnprintf+0x45>
+
+0080084a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80084a:	55                   	push   %ebp
+  80084b:	89 e5                	mov    %esp,%ebp
+  80084d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800850:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800853:	50                   	push   %eax
+  800854:	ff 75 10             	push   0x10(%ebp)
+  800857:	ff 75 0c             	push   0xc(%ebp)
+  80085a:	ff 75 08             	push   0x8(%ebp)
+  80085d:	e8 9a ff ff ff       	call   8007fc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800862:	c9                   	leave
+  800863:	c3                   	ret
+
+00800864 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800864:	55                   	push   %ebp
+  800865:	89 e5                	mov    %esp,%ebp
+  800867:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80086a:	80 3a 00             	cmpb   $0x0,(%edx)
+  80086d:	74 10                	je     80087f <strlen+0x1b>
+  80086f:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800874:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800877:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80087b:	75 f7                	jne    800874 <strlen+0x10>
+	return n;
+}
+  80087d:	5d                   	pop    %ebp
+  80087e:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80087f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800884:	eb f7                	jmp    80087d <strlen+0x19>
+
+00800886 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80088f:	85 d2                	test   %edx,%edx
+  800891:	74 16                	je     8008a9 <strnlen+0x23>
+  800893:	b8 00 00 00 00       	mov    $0x0,%eax
+  800898:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80089c:	74 09                	je     8008a7 <strnlen+0x21>
+		n++;
+  80089e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a1:	39 d0                	cmp    %edx,%eax
+  8008a3:	75 f3                	jne    800898 <strnlen+0x12>
+		n++;
+  8008a5:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8008a7:	5d                   	pop    %ebp
+  8008a8:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	eb f7                	jmp    8008a7 <strnlen+0x21>
+
+008008b0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008b0:	55                   	push   %ebp
+  8008b1:	89 e5                	mov    %esp,%ebp
+  8008b3:	53                   	push   %ebx
+  8008b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008c3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008c6:	83 c0 01             	add    $0x1,%eax
+  8008c9:	84 d2                	test   %dl,%dl
+  8008cb:	75 f2                	jne    8008bf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008cd:	89 c8                	mov    %ecx,%eax
+  8008cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d2:	c9                   	leave
+  8008d3:	c3                   	ret
+
+008008d4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	53                   	push   %ebx
+  8008d8:	83 ec 10             	sub    $0x10,%esp
+  8008db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008de:	53                   	push   %ebx
+  8008df:	e8 80 ff ff ff       	call   800864 <strlen>
+  8008e4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008e7:	ff 75 0c             	push   0xc(%ebp)
+  8008ea:	01 d8                	add    %ebx,%eax
+  8008ec:	50                   	push   %eax
+  8008ed:	e8 be ff ff ff       	call   8008b0 <strcpy>
+	return dst;
+}
+  8008f2:	89 d8                	mov    %ebx,%eax
+  8008f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f7:	c9                   	leave
+  8008f8:	c3                   	ret
+
+008008f9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	56                   	push   %esi
+  8008fd:	53                   	push   %ebx
+  8008fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800901:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800904:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800907:	85 db                	test   %ebx,%ebx
+  800909:	74 17                	je     800922 <strncpy+0x29>
+  80090b:	01 f3                	add    %esi,%ebx
+  80090d:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80090f:	83 c0 01             	add    $0x1,%eax
+  800912:	0f b6 0a             	movzbl (%edx),%ecx
+  800915:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800918:	80 f9 01             	cmp    $0x1,%cl
+  80091b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80091e:	39 c3                	cmp    %eax,%ebx
+  800920:	75 ed                	jne    80090f <strncpy+0x16>
+	}
+	return ret;
+}
+  800922:	89 f0                	mov    %esi,%eax
+  800924:	5b                   	pop    %ebx
+  800925:	5e                   	pop    %esi
+  800926:	5d                   	pop    %ebp
+  800927:	c3                   	ret
+
+00800928 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	56                   	push   %esi
+  80092c:	53                   	push   %ebx
+  80092d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800930:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800933:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800936:	89 f0                	mov    %esi,%eax
+  800938:	85 db                	test   %ebx,%ebx
+  80093a:	74 1e                	je     80095a <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  80093c:	83 eb 01             	sub    $0x1,%ebx
+  80093f:	74 16                	je     800957 <strlcpy+0x2f>
+  800941:	01 f3                	add    %esi,%ebx
+  800943:	0f b6 0a             	movzbl (%edx),%ecx
+  800946:	84 c9                	test   %cl,%cl
+  800948:	74 0d                	je     800957 <strlcpy+0x2f>
+			*dst++ = *src++;
+  80094a:	83 c2 01             	add    $0x1,%edx
+  80094d:	83 c0 01             	add    $0x1,%eax
+  800950:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800953:	39 d8                	cmp    %ebx,%eax
+  800955:	75 ec                	jne    800943 <strlcpy+0x1b>
+		*dst = '\0';
+  800957:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80095a:	29 f0                	sub    %esi,%eax
+}
+  80095c:	5b                   	pop    %ebx
+  80095d:	5e                   	pop    %esi
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800966:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800969:	0f b6 01             	movzbl (%ecx),%eax
+  80096c:	84 c0                	test   %al,%al
+  80096e:	74 11                	je     800981 <strcmp+0x21>
+  800970:	38 02                	cmp    %al,(%edx)
+  800972:	75 0d                	jne    800981 <strcmp+0x21>
+		p++, q++;
+  800974:	83 c1 01             	add    $0x1,%ecx
+  800977:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80097a:	0f b6 01             	movzbl (%ecx),%eax
+  80097d:	84 c0                	test   %al,%al
+  80097f:	75 ef                	jne    800970 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800981:	0f b6 c0             	movzbl %al,%eax
+  800984:	0f b6 12             	movzbl (%edx),%edx
+  800987:	29 d0                	sub    %edx,%eax
+}
+  800989:	5d                   	pop    %ebp
+  80098a:	c3                   	ret
+
+0080098b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	53                   	push   %ebx
+  80098f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800992:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800995:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800998:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  80099d:	85 d2                	test   %edx,%edx
+  80099f:	74 2e                	je     8009cf <strncmp+0x44>
+  8009a1:	0f b6 01             	movzbl (%ecx),%eax
+  8009a4:	84 c0                	test   %al,%al
+  8009a6:	74 16                	je     8009be <strncmp+0x33>
+  8009a8:	3a 03                	cmp    (%ebx),%al
+  8009aa:	75 12                	jne    8009be <strncmp+0x33>
+		n--, p++, q++;
+  8009ac:	83 c1 01             	add    $0x1,%ecx
+  8009af:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8009b2:	83 ea 01             	sub    $0x1,%edx
+  8009b5:	75 ea                	jne    8009a1 <strncmp+0x16>
+		return 0;
+  8009b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009bc:	eb 11                	jmp    8009cf <strncmp+0x44>
+  8009be:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8009c3:	85 d2                	test   %edx,%edx
+  8009c5:	74 08                	je     8009cf <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c7:	0f b6 01             	movzbl (%ecx),%eax
+  8009ca:	0f b6 13             	movzbl (%ebx),%edx
+  8009cd:	29 d0                	sub    %edx,%eax
+}
+  8009cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d2:	c9                   	leave
+  8009d3:	c3                   	ret
+
+008009d4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009da:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009de:	0f b6 10             	movzbl (%eax),%edx
+  8009e1:	84 d2                	test   %dl,%dl
+  8009e3:	74 15                	je     8009fa <strchr+0x26>
+		if (*s == c)
+  8009e5:	38 d1                	cmp    %dl,%cl
+  8009e7:	74 0f                	je     8009f8 <strchr+0x24>
+	for (; *s; s++)
+  8009e9:	83 c0 01             	add    $0x1,%eax
+  8009ec:	0f b6 10             	movzbl (%eax),%edx
+  8009ef:	84 d2                	test   %dl,%dl
+  8009f1:	75 f2                	jne    8009e5 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+	return 0;
+  8009fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ff:	eb f7                	jmp    8009f8 <strchr+0x24>
+
+00800a01 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	53                   	push   %ebx
+  800a05:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a08:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a0b:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a0e:	38 d3                	cmp    %dl,%bl
+  800a10:	74 14                	je     800a26 <strfind+0x25>
+  800a12:	89 d1                	mov    %edx,%ecx
+  800a14:	84 db                	test   %bl,%bl
+  800a16:	74 0e                	je     800a26 <strfind+0x25>
+	for (; *s; s++)
+  800a18:	83 c0 01             	add    $0x1,%eax
+  800a1b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a1e:	38 ca                	cmp    %cl,%dl
+  800a20:	74 04                	je     800a26 <strfind+0x25>
+  800a22:	84 d2                	test   %dl,%dl
+  800a24:	75 f2                	jne    800a18 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+
+00800a2b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	57                   	push   %edi
+  800a2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a32:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a35:	85 c9                	test   %ecx,%ecx
+  800a37:	74 20                	je     800a59 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a39:	89 f8                	mov    %edi,%eax
+  800a3b:	09 c8                	or     %ecx,%eax
+  800a3d:	a8 03                	test   $0x3,%al
+  800a3f:	75 12                	jne    800a53 <memset+0x28>
+		c &= 0xFF;
+  800a41:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a45:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a4b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a4e:	fc                   	cld
+  800a4f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a51:	eb 06                	jmp    800a59 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a56:	fc                   	cld
+  800a57:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a59:	89 f8                	mov    %edi,%eax
+  800a5b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a5e:	c9                   	leave
+  800a5f:	c3                   	ret
+
+00800a60 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a60:	55                   	push   %ebp
+  800a61:	89 e5                	mov    %esp,%ebp
+  800a63:	57                   	push   %edi
+  800a64:	56                   	push   %esi
+  800a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a68:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a6b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a6e:	39 c6                	cmp    %eax,%esi
+  800a70:	73 32                	jae    800aa4 <memmove+0x44>
+  800a72:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a75:	39 d0                	cmp    %edx,%eax
+  800a77:	73 2b                	jae    800aa4 <memmove+0x44>
+		s += n;
+		d += n;
+  800a79:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a7c:	89 d6                	mov    %edx,%esi
+  800a7e:	09 fe                	or     %edi,%esi
+  800a80:	09 ce                	or     %ecx,%esi
+  800a82:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a88:	75 0e                	jne    800a98 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a8a:	83 ef 04             	sub    $0x4,%edi
+  800a8d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a90:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a93:	fd                   	std
+  800a94:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a96:	eb 09                	jmp    800aa1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a98:	83 ef 01             	sub    $0x1,%edi
+  800a9b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a9e:	fd                   	std
+  800a9f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aa1:	fc                   	cld
+  800aa2:	eb 1a                	jmp    800abe <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa4:	89 f2                	mov    %esi,%edx
+  800aa6:	09 c2                	or     %eax,%edx
+  800aa8:	09 ca                	or     %ecx,%edx
+  800aaa:	f6 c2 03             	test   $0x3,%dl
+  800aad:	75 0a                	jne    800ab9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800aaf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ab2:	89 c7                	mov    %eax,%edi
+  800ab4:	fc                   	cld
+  800ab5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab7:	eb 05                	jmp    800abe <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ab9:	89 c7                	mov    %eax,%edi
+  800abb:	fc                   	cld
+  800abc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800abe:	5e                   	pop    %esi
+  800abf:	5f                   	pop    %edi
+  800ac0:	5d                   	pop    %ebp
+  800ac1:	c3                   	ret
+
+00800ac2 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800ac2:	55                   	push   %ebp
+  800ac3:	89 e5                	mov    %esp,%ebp
+  800ac5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ac8:	ff 75 10             	push   0x10(%ebp)
+  800acb:	ff 75 0c             	push   0xc(%ebp)
+  800ace:	ff 75 08             	push   0x8(%ebp)
+  800ad1:	e8 8a ff ff ff       	call   800a60 <memmove>
+}
+  800ad6:	c9                   	leave
+  800ad7:	c3                   	ret
+
+00800ad8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ad8:	55                   	push   %ebp
+  800ad9:	89 e5                	mov    %esp,%ebp
+  800adb:	56                   	push   %esi
+  800adc:	53                   	push   %ebx
+  800add:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae3:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ae6:	85 f6                	test   %esi,%esi
+  800ae8:	74 29                	je     800b13 <memcmp+0x3b>
+  800aea:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800aec:	0f b6 08             	movzbl (%eax),%ecx
+  800aef:	0f b6 1a             	movzbl (%edx),%ebx
+  800af2:	38 d9                	cmp    %bl,%cl
+  800af4:	75 11                	jne    800b07 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800af6:	83 c0 01             	add    $0x1,%eax
+  800af9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800afc:	39 c6                	cmp    %eax,%esi
+  800afe:	75 ec                	jne    800aec <memcmp+0x14>
+	}
+
+	return 0;
+  800b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b05:	eb 08                	jmp    800b0f <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b07:	0f b6 c1             	movzbl %cl,%eax
+  800b0a:	0f b6 db             	movzbl %bl,%ebx
+  800b0d:	29 d8                	sub    %ebx,%eax
+}
+  800b0f:	5b                   	pop    %ebx
+  800b10:	5e                   	pop    %esi
+  800b11:	5d                   	pop    %ebp
+  800b12:	c3                   	ret
+	return 0;
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b18:	eb f5                	jmp    800b0f <memcmp+0x37>
+
+00800b1a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b23:	89 c2                	mov    %eax,%edx
+  800b25:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b28:	39 d0                	cmp    %edx,%eax
+  800b2a:	73 0d                	jae    800b39 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b2c:	38 08                	cmp    %cl,(%eax)
+  800b2e:	74 0d                	je     800b3d <memfind+0x23>
+	for (; s < ends; s++)
+  800b30:	83 c0 01             	add    $0x1,%eax
+  800b33:	39 c2                	cmp    %eax,%edx
+  800b35:	75 f5                	jne    800b2c <memfind+0x12>
+  800b37:	eb 06                	jmp    800b3f <memfind+0x25>
+  800b39:	89 c2                	mov    %eax,%edx
+  800b3b:	eb 02                	jmp    800b3f <memfind+0x25>
+  800b3d:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800b3f:	89 d0                	mov    %edx,%eax
+  800b41:	5d                   	pop    %ebp
+  800b42:	c3                   	ret
+
+00800b43 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b43:	55                   	push   %ebp
+  800b44:	89 e5                	mov    %esp,%ebp
+  800b46:	57                   	push   %edi
+  800b47:	56                   	push   %esi
+  800b48:	53                   	push   %ebx
+  800b49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b4f:	0f b6 02             	movzbl (%edx),%eax
+  800b52:	3c 20                	cmp    $0x20,%al
+  800b54:	74 04                	je     800b5a <strtol+0x17>
+  800b56:	3c 09                	cmp    $0x9,%al
+  800b58:	75 0e                	jne    800b68 <strtol+0x25>
+		s++;
+  800b5a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b5d:	0f b6 02             	movzbl (%edx),%eax
+  800b60:	3c 20                	cmp    $0x20,%al
+  800b62:	74 f6                	je     800b5a <strtol+0x17>
+  800b64:	3c 09                	cmp    $0x9,%al
+  800b66:	74 f2                	je     800b5a <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b68:	3c 2b                	cmp    $0x2b,%al
+  800b6a:	74 2a                	je     800b96 <strtol+0x53>
+	int neg = 0;
+  800b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b71:	3c 2d                	cmp    $0x2d,%al
+  800b73:	74 2b                	je     800ba0 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b75:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b7b:	75 0f                	jne    800b8c <strtol+0x49>
+  800b7d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b80:	74 28                	je     800baa <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b82:	85 db                	test   %ebx,%ebx
+  800b84:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b89:	0f 44 d8             	cmove  %eax,%ebx
+  800b8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b91:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b94:	eb 46                	jmp    800bdc <strtol+0x99>
+		s++;
+  800b96:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b99:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b9e:	eb d5                	jmp    800b75 <strtol+0x32>
+		s++, neg = 1;
+  800ba0:	83 c2 01             	add    $0x1,%edx
+  800ba3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba8:	eb cb                	jmp    800b75 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800baa:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bae:	74 0e                	je     800bbe <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800bb0:	85 db                	test   %ebx,%ebx
+  800bb2:	75 d8                	jne    800b8c <strtol+0x49>
+		s++, base = 8;
+  800bb4:	83 c2 01             	add    $0x1,%edx
+  800bb7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bbc:	eb ce                	jmp    800b8c <strtol+0x49>
+		s += 2, base = 16;
+  800bbe:	83 c2 02             	add    $0x2,%edx
+  800bc1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc6:	eb c4                	jmp    800b8c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc8:	0f be c0             	movsbl %al,%eax
+  800bcb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bce:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd1:	7d 3a                	jge    800c0d <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800bd3:	83 c2 01             	add    $0x1,%edx
+  800bd6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bda:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bdc:	0f b6 02             	movzbl (%edx),%eax
+  800bdf:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be2:	89 f3                	mov    %esi,%ebx
+  800be4:	80 fb 09             	cmp    $0x9,%bl
+  800be7:	76 df                	jbe    800bc8 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800be9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bec:	89 f3                	mov    %esi,%ebx
+  800bee:	80 fb 19             	cmp    $0x19,%bl
+  800bf1:	77 08                	ja     800bfb <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800bf3:	0f be c0             	movsbl %al,%eax
+  800bf6:	83 e8 57             	sub    $0x57,%eax
+  800bf9:	eb d3                	jmp    800bce <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bfb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bfe:	89 f3                	mov    %esi,%ebx
+  800c00:	80 fb 19             	cmp    $0x19,%bl
+  800c03:	77 08                	ja     800c0d <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c05:	0f be c0             	movsbl %al,%eax
+  800c08:	83 e8 37             	sub    $0x37,%eax
+  800c0b:	eb c1                	jmp    800bce <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c0d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c11:	74 05                	je     800c18 <strtol+0xd5>
+		*endptr = (char *) s;
+  800c13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c16:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c18:	89 c8                	mov    %ecx,%eax
+  800c1a:	f7 d8                	neg    %eax
+  800c1c:	85 ff                	test   %edi,%edi
+  800c1e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c21:	89 c8                	mov    %ecx,%eax
+  800c23:	5b                   	pop    %ebx
+  800c24:	5e                   	pop    %esi
+  800c25:	5f                   	pop    %edi
+  800c26:	5d                   	pop    %ebp
+  800c27:	c3                   	ret
+
+00800c28 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	57                   	push   %edi
+  800c2c:	56                   	push   %esi
+  800c2d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c39:	89 c3                	mov    %eax,%ebx
+  800c3b:	89 c7                	mov    %eax,%edi
+  800c3d:	89 c6                	mov    %eax,%esi
+  800c3f:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c41:	5b                   	pop    %ebx
+  800c42:	5e                   	pop    %esi
+  800c43:	5f                   	pop    %edi
+  800c44:	5d                   	pop    %ebp
+  800c45:	c3                   	ret
+
+00800c46 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c46:	55                   	push   %ebp
+  800c47:	89 e5                	mov    %esp,%ebp
+  800c49:	57                   	push   %edi
+  800c4a:	56                   	push   %esi
+  800c4b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c51:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c56:	89 d1                	mov    %edx,%ecx
+  800c58:	89 d3                	mov    %edx,%ebx
+  800c5a:	89 d7                	mov    %edx,%edi
+  800c5c:	89 d6                	mov    %edx,%esi
+  800c5e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c60:	5b                   	pop    %ebx
+  800c61:	5e                   	pop    %esi
+  800c62:	5f                   	pop    %edi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  800c6b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c76:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c7b:	89 cb                	mov    %ecx,%ebx
+  800c7d:	89 cf                	mov    %ecx,%edi
+  800c7f:	89 ce                	mov    %ecx,%esi
+  800c81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c83:	85 c0                	test   %eax,%eax
+  800c85:	7f 08                	jg     800c8f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8a:	5b                   	pop    %ebx
+  800c8b:	5e                   	pop    %esi
+  800c8c:	5f                   	pop    %edi
+  800c8d:	5d                   	pop    %ebp
+  800c8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+  800c92:	50                   	push   %eax
+  800c93:	6a 03                	push   $0x3
+  800c95:	68 2b 3e 80 00       	push   $0x803e2b
+  800c9a:	6a 23                	push   $0x23
+  800c9c:	68 48 3e 80 00       	push   $0x803e48
+  800ca1:	e8 79 28 00 00       	call   80351f <_panic>
+
+00800ca6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ca6:	55                   	push   %ebp
+  800ca7:	89 e5                	mov    %esp,%ebp
+  800ca9:	57                   	push   %edi
+  800caa:	56                   	push   %esi
+  800cab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cb6:	89 d1                	mov    %edx,%ecx
+  800cb8:	89 d3                	mov    %edx,%ebx
+  800cba:	89 d7                	mov    %edx,%edi
+  800cbc:	89 d6                	mov    %edx,%esi
+  800cbe:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cc0:	5b                   	pop    %ebx
+  800cc1:	5e                   	pop    %esi
+  800cc2:	5f                   	pop    %edi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+
+00800cc5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	56                   	push   %esi
+  800cca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ccb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cd5:	89 d1                	mov    %edx,%ecx
+  800cd7:	89 d3                	mov    %edx,%ebx
+  800cd9:	89 d7                	mov    %edx,%edi
+  800cdb:	89 d6                	mov    %edx,%esi
+  800cdd:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5e                   	pop    %esi
+  800ce1:	5f                   	pop    %edi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+
+00800ce4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	57                   	push   %edi
+  800ce8:	56                   	push   %esi
+  800ce9:	53                   	push   %ebx
+  800cea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ced:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cfd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d00:	89 f7                	mov    %esi,%edi
+  800d02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d04:	85 c0                	test   %eax,%eax
+  800d06:	7f 08                	jg     800d10 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0b:	5b                   	pop    %ebx
+  800d0c:	5e                   	pop    %esi
+  800d0d:	5f                   	pop    %edi
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d10:	83 ec 0c             	sub    $0xc,%esp
+  800d13:	50                   	push   %eax
+  800d14:	6a 04                	push   $0x4
+  800d16:	68 2b 3e 80 00       	push   $0x803e2b
+  800d1b:	6a 23                	push   $0x23
+  800d1d:	68 48 3e 80 00       	push   $0x803e48
+  800d22:	e8 f8 27 00 00       	call   80351f <_panic>
+
+00800d27 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	57                   	push   %edi
+  800d2b:	56                   	push   %esi
+  800d2c:	53                   	push   %ebx
+  800d2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d36:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d41:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d46:	85 c0                	test   %eax,%eax
+  800d48:	7f 08                	jg     800d52 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+  800d55:	50                   	push   %eax
+  800d56:	6a 05                	push   $0x5
+  800d58:	68 2b 3e 80 00       	push   $0x803e2b
+  800d5d:	6a 23                	push   $0x23
+  800d5f:	68 48 3e 80 00       	push   $0x803e48
+  800d64:	e8 b6 27 00 00       	call   80351f <_panic>
+
+00800d69 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d82:	89 df                	mov    %ebx,%edi
+  800d84:	89 de                	mov    %ebx,%esi
+  800d86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d88:	85 c0                	test   %eax,%eax
+  800d8a:	7f 08                	jg     800d94 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d94:	83 ec 0c             	sub    $0xc,%esp
+  800d97:	50                   	push   %eax
+  800d98:	6a 06                	push   $0x6
+  800d9a:	68 2b 3e 80 00       	push   $0x803e2b
+  800d9f:	6a 23                	push   $0x23
+  800da1:	68 48 3e 80 00       	push   $0x803e48
+  800da6:	e8 74 27 00 00       	call   80351f <_panic>
+
+00800dab <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dc4:	89 df                	mov    %ebx,%edi
+  800dc6:	89 de                	mov    %ebx,%esi
+  800dc8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	7f 08                	jg     800dd6 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+  800dd9:	50                   	push   %eax
+  800dda:	6a 08                	push   $0x8
+  800ddc:	68 2b 3e 80 00       	push   $0x803e2b
+  800de1:	6a 23                	push   $0x23
+  800de3:	68 48 3e 80 00       	push   $0x803e48
+  800de8:	e8 32 27 00 00       	call   80351f <_panic>
+
+00800ded <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	57                   	push   %edi
+  800df1:	56                   	push   %esi
+  800df2:	53                   	push   %ebx
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e01:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e06:	89 df                	mov    %ebx,%edi
+  800e08:	89 de                	mov    %ebx,%esi
+  800e0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0c:	85 c0                	test   %eax,%eax
+  800e0e:	7f 08                	jg     800e18 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e18:	83 ec 0c             	sub    $0xc,%esp
+  800e1b:	50                   	push   %eax
+  800e1c:	6a 09                	push   $0x9
+  800e1e:	68 2b 3e 80 00       	push   $0x803e2b
+  800e23:	6a 23                	push   $0x23
+  800e25:	68 48 3e 80 00       	push   $0x803e48
+  800e2a:	e8 f0 26 00 00       	call   80351f <_panic>
+
+00800e2f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+  800e35:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e48:	89 df                	mov    %ebx,%edi
+  800e4a:	89 de                	mov    %ebx,%esi
+  800e4c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4e:	85 c0                	test   %eax,%eax
+  800e50:	7f 08                	jg     800e5a <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5f                   	pop    %edi
+  800e58:	5d                   	pop    %ebp
+  800e59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	50                   	push   %eax
+  800e5e:	6a 0a                	push   $0xa
+  800e60:	68 2b 3e 80 00       	push   $0x803e2b
+  800e65:	6a 23                	push   $0x23
+  800e67:	68 48 3e 80 00       	push   $0x803e48
+  800e6c:	e8 ae 26 00 00       	call   80351f <_panic>
+
+00800e71 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e82:	be 00 00 00 00       	mov    $0x0,%esi
+  800e87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+
+00800e94 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	56                   	push   %esi
+  800e99:	53                   	push   %ebx
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eaa:	89 cb                	mov    %ecx,%ebx
+  800eac:	89 cf                	mov    %ecx,%edi
+  800eae:	89 ce                	mov    %ecx,%esi
+  800eb0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	7f 08                	jg     800ebe <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  800ec1:	50                   	push   %eax
+  800ec2:	6a 0d                	push   $0xd
+  800ec4:	68 2b 3e 80 00       	push   $0x803e2b
+  800ec9:	6a 23                	push   $0x23
+  800ecb:	68 48 3e 80 00       	push   $0x803e48
+  800ed0:	e8 4a 26 00 00       	call   80351f <_panic>
+
+00800ed5 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	56                   	push   %esi
+  800eda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800edb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ee6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eec:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eef:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800ef1:	5b                   	pop    %ebx
+  800ef2:	5e                   	pop    %esi
+  800ef3:	5f                   	pop    %edi
+  800ef4:	5d                   	pop    %ebp
+  800ef5:	c3                   	ret
+
+00800ef6 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	57                   	push   %edi
+  800efa:	56                   	push   %esi
+  800efb:	53                   	push   %ebx
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f0f:	89 df                	mov    %ebx,%edi
+  800f11:	89 de                	mov    %ebx,%esi
+  800f13:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	7f 08                	jg     800f21 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+  800f24:	50                   	push   %eax
+  800f25:	6a 0d                	push   $0xd
+  800f27:	68 2b 3e 80 00       	push   $0x803e2b
+  800f2c:	6a 23                	push   $0x23
+  800f2e:	68 48 3e 80 00       	push   $0x803e48
+  800f33:	e8 e7 25 00 00       	call   80351f <_panic>
+
+00800f38 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f43:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f48:	89 d1                	mov    %edx,%ecx
+  800f4a:	89 d3                	mov    %edx,%ebx
+  800f4c:	89 d7                	mov    %edx,%edi
+  800f4e:	89 d6                	mov    %edx,%esi
+  800f50:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f52:	5b                   	pop    %ebx
+  800f53:	5e                   	pop    %esi
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+
+00800f57 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	57                   	push   %edi
+  800f5b:	56                   	push   %esi
+  800f5c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f68:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f6d:	89 df                	mov    %ebx,%edi
+  800f6f:	89 de                	mov    %ebx,%esi
+  800f71:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800f73:	5b                   	pop    %ebx
+  800f74:	5e                   	pop    %esi
+  800f75:	5f                   	pop    %edi
+  800f76:	5d                   	pop    %ebp
+  800f77:	c3                   	ret
+
+00800f78 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	57                   	push   %edi
+  800f7c:	56                   	push   %esi
+  800f7d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f86:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f8b:	89 cb                	mov    %ecx,%ebx
+  800f8d:	89 cf                	mov    %ecx,%edi
+  800f8f:	89 ce                	mov    %ecx,%esi
+  800f91:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+
+00800f98 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fae:	89 df                	mov    %ebx,%edi
+  800fb0:	89 de                	mov    %ebx,%esi
+  800fb2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+
+00800fb9 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	57                   	push   %edi
+  800fbd:	56                   	push   %esi
+  800fbe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fca:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fcf:	89 df                	mov    %ebx,%edi
+  800fd1:	89 de                	mov    %ebx,%esi
+  800fd3:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  800fd5:	5b                   	pop    %ebx
+  800fd6:	5e                   	pop    %esi
+  800fd7:	5f                   	pop    %edi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+
+00800fda <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	57                   	push   %edi
+  800fde:	56                   	push   %esi
+  800fdf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe8:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fed:	89 cb                	mov    %ecx,%ebx
+  800fef:	89 cf                	mov    %ecx,%edi
+  800ff1:	89 ce                	mov    %ecx,%esi
+  800ff3:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5f                   	pop    %edi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+
+00800ffa <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801000:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+  801008:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801010:	89 df                	mov    %ebx,%edi
+  801012:	89 de                	mov    %ebx,%esi
+  801014:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801016:	5b                   	pop    %ebx
+  801017:	5e                   	pop    %esi
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+
+0080101b <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801021:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801026:	8b 55 08             	mov    0x8(%ebp),%edx
+  801029:	b8 15 00 00 00       	mov    $0x15,%eax
+  80102e:	89 cb                	mov    %ecx,%ebx
+  801030:	89 cf                	mov    %ecx,%edi
+  801032:	89 ce                	mov    %ecx,%esi
+  801034:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801036:	5b                   	pop    %ebx
+  801037:	5e                   	pop    %esi
+  801038:	5f                   	pop    %edi
+  801039:	5d                   	pop    %ebp
+  80103a:	c3                   	ret
+
+0080103b <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801041:	be 00 00 00 00       	mov    $0x0,%esi
+  801046:	8b 55 08             	mov    0x8(%ebp),%edx
+  801049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801051:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801054:	89 f7                	mov    %esi,%edi
+  801056:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801058:	5b                   	pop    %ebx
+  801059:	5e                   	pop    %esi
+  80105a:	5f                   	pop    %edi
+  80105b:	5d                   	pop    %ebp
+  80105c:	c3                   	ret
+
+0080105d <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801063:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801073:	89 df                	mov    %ebx,%edi
+  801075:	89 de                	mov    %ebx,%esi
+  801077:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+
+0080107e <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801084:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801089:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801091:	89 cb                	mov    %ecx,%ebx
+  801093:	89 cf                	mov    %ecx,%edi
+  801095:	89 ce                	mov    %ecx,%esi
+  801097:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801099:	5b                   	pop    %ebx
+  80109a:	5e                   	pop    %esi
+  80109b:	5f                   	pop    %edi
+  80109c:	5d                   	pop    %ebp
+  80109d:	c3                   	ret
+
+0080109e <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	57                   	push   %edi
+  8010a2:	56                   	push   %esi
+  8010a3:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8010a4:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8010a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b0:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010b5:	89 df                	mov    %ebx,%edi
+  8010b7:	89 de                	mov    %ebx,%esi
+  8010b9:	cd 30                	int    $0x30
+}
+  8010bb:	5b                   	pop    %ebx
+  8010bc:	5e                   	pop    %esi
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+
+008010c0 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d9:	89 f7                	mov    %esi,%edi
+  8010db:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+
+008010e2 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fb:	89 f7                	mov    %esi,%edi
+  8010fd:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+
+00801104 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	57                   	push   %edi
+  801108:	56                   	push   %esi
+  801109:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801112:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801115:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80111a:	89 df                	mov    %ebx,%edi
+  80111c:	89 de                	mov    %ebx,%esi
+  80111e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+
+00801125 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112b:	be 00 00 00 00       	mov    $0x0,%esi
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801136:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80113b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113e:	89 f7                	mov    %esi,%edi
+  801140:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801142:	5b                   	pop    %ebx
+  801143:	5e                   	pop    %esi
+  801144:	5f                   	pop    %edi
+  801145:	5d                   	pop    %ebp
+  801146:	c3                   	ret
+
+00801147 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80114a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801152:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+
+00801157 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80115a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80115d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801162:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801167:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+
+0080116e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801176:	89 c2                	mov    %eax,%edx
+  801178:	c1 ea 16             	shr    $0x16,%edx
+  80117b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801182:	f6 c2 01             	test   $0x1,%dl
+  801185:	74 29                	je     8011b0 <fd_alloc+0x42>
+  801187:	89 c2                	mov    %eax,%edx
+  801189:	c1 ea 0c             	shr    $0xc,%edx
+  80118c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801193:	f6 c2 01             	test   $0x1,%dl
+  801196:	74 18                	je     8011b0 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801198:	05 00 10 00 00       	add    $0x1000,%eax
+  80119d:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8011a2:	75 d2                	jne    801176 <fd_alloc+0x8>
+  8011a4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011a9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011ae:	eb 05                	jmp    8011b5 <fd_alloc+0x47>
+			return 0;
+  8011b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b8:	89 02                	mov    %eax,(%edx)
+}
+  8011ba:	89 c8                	mov    %ecx,%eax
+  8011bc:	5d                   	pop    %ebp
+  8011bd:	c3                   	ret
+
+008011be <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011c4:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8011c9:	77 30                	ja     8011fb <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011cb:	c1 e0 0c             	shl    $0xc,%eax
+  8011ce:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8011d3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011d9:	f6 c2 01             	test   $0x1,%dl
+  8011dc:	74 24                	je     801202 <fd_lookup+0x44>
+  8011de:	89 c2                	mov    %eax,%edx
+  8011e0:	c1 ea 0c             	shr    $0xc,%edx
+  8011e3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011ea:	f6 c2 01             	test   $0x1,%dl
+  8011ed:	74 1a                	je     801209 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011f2:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+		return -E_INVAL;
+  8011fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801200:	eb f7                	jmp    8011f9 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801202:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801207:	eb f0                	jmp    8011f9 <fd_lookup+0x3b>
+  801209:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80120e:	eb e9                	jmp    8011f9 <fd_lookup+0x3b>
+
+00801210 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801210:	55                   	push   %ebp
+  801211:	89 e5                	mov    %esp,%ebp
+  801213:	53                   	push   %ebx
+  801214:	83 ec 04             	sub    $0x4,%esp
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80121a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121f:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801224:	39 13                	cmp    %edx,(%ebx)
+  801226:	74 54                	je     80127c <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801228:	83 c0 01             	add    $0x1,%eax
+  80122b:	8b 1c 85 d4 3e 80 00 	mov    0x803ed4(,%eax,4),%ebx
+  801232:	85 db                	test   %ebx,%ebx
+  801234:	75 ee                	jne    801224 <dev_lookup+0x14>
+  801236:	89 e1                	mov    %esp,%ecx
+  801238:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80123d:	29 c8                	sub    %ecx,%eax
+  80123f:	89 c1                	mov    %eax,%ecx
+  801241:	c1 e9 0f             	shr    $0xf,%ecx
+  801244:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124e:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801251:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  801258:	8b 40 48             	mov    0x48(%eax),%eax
+  80125b:	83 ec 04             	sub    $0x4,%esp
+  80125e:	52                   	push   %edx
+  80125f:	50                   	push   %eax
+  801260:	68 58 3e 80 00       	push   $0x803e58
+  801265:	e8 4f ef ff ff       	call   8001b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80126a:	83 c4 10             	add    $0x10,%esp
+  80126d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801272:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801275:	89 1a                	mov    %ebx,(%edx)
+}
+  801277:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127a:	c9                   	leave
+  80127b:	c3                   	ret
+			return 0;
+  80127c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801281:	eb ef                	jmp    801272 <dev_lookup+0x62>
+
+00801283 <fd_close>:
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+  801289:	83 ec 24             	sub    $0x24,%esp
+  80128c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80128f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801292:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801295:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801296:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80129c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80129f:	50                   	push   %eax
+  8012a0:	e8 19 ff ff ff       	call   8011be <fd_lookup>
+  8012a5:	89 c3                	mov    %eax,%ebx
+  8012a7:	83 c4 10             	add    $0x10,%esp
+  8012aa:	85 c0                	test   %eax,%eax
+  8012ac:	78 05                	js     8012b3 <fd_close+0x30>
+	    || fd != fd2)
+  8012ae:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012b1:	74 0f                	je     8012c2 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8012b3:	85 ff                	test   %edi,%edi
+  8012b5:	0f 44 df             	cmove  %edi,%ebx
+}
+  8012b8:	89 d8                	mov    %ebx,%eax
+  8012ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bd:	5b                   	pop    %ebx
+  8012be:	5e                   	pop    %esi
+  8012bf:	5f                   	pop    %edi
+  8012c0:	5d                   	pop    %ebp
+  8012c1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012c2:	83 ec 08             	sub    $0x8,%esp
+  8012c5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012c8:	50                   	push   %eax
+  8012c9:	ff 36                	push   (%esi)
+  8012cb:	e8 40 ff ff ff       	call   801210 <dev_lookup>
+  8012d0:	89 c3                	mov    %eax,%ebx
+  8012d2:	83 c4 10             	add    $0x10,%esp
+  8012d5:	85 c0                	test   %eax,%eax
+  8012d7:	78 1a                	js     8012f3 <fd_close+0x70>
+		if (dev->dev_close)
+  8012d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012dc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012df:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012e4:	85 c0                	test   %eax,%eax
+  8012e6:	74 0b                	je     8012f3 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8012e8:	83 ec 0c             	sub    $0xc,%esp
+  8012eb:	56                   	push   %esi
+  8012ec:	ff d0                	call   *%eax
+  8012ee:	89 c3                	mov    %eax,%ebx
+  8012f0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012f3:	83 ec 08             	sub    $0x8,%esp
+  8012f6:	56                   	push   %esi
+  8012f7:	6a 00                	push   $0x0
+  8012f9:	e8 6b fa ff ff       	call   800d69 <sys_page_unmap>
+	return r;
+  8012fe:	83 c4 10             	add    $0x10,%esp
+  801301:	eb b5                	jmp    8012b8 <fd_close+0x35>
+
+00801303 <close>:
+
+int
+close(int fdnum)
+{
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801309:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80130c:	50                   	push   %eax
+  80130d:	ff 75 08             	push   0x8(%ebp)
+  801310:	e8 a9 fe ff ff       	call   8011be <fd_lookup>
+  801315:	83 c4 10             	add    $0x10,%esp
+  801318:	85 c0                	test   %eax,%eax
+  80131a:	79 02                	jns    80131e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+		return fd_close(fd, 1);
+  80131e:	83 ec 08             	sub    $0x8,%esp
+  801321:	6a 01                	push   $0x1
+  801323:	ff 75 f4             	push   -0xc(%ebp)
+  801326:	e8 58 ff ff ff       	call   801283 <fd_close>
+  80132b:	83 c4 10             	add    $0x10,%esp
+  80132e:	eb ec                	jmp    80131c <close+0x19>
+
+00801330 <close_all>:
+
+void
+close_all(void)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	53                   	push   %ebx
+  801334:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+  80133f:	53                   	push   %ebx
+  801340:	e8 be ff ff ff       	call   801303 <close>
+	for (i = 0; i < MAXFD; i++)
+  801345:	83 c3 01             	add    $0x1,%ebx
+  801348:	83 c4 10             	add    $0x10,%esp
+  80134b:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801351:	75 e9                	jne    80133c <close_all+0xc>
+}
+  801353:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801356:	c9                   	leave
+  801357:	c3                   	ret
+
+00801358 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	57                   	push   %edi
+  80135c:	56                   	push   %esi
+  80135d:	53                   	push   %ebx
+  80135e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801361:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801364:	50                   	push   %eax
+  801365:	ff 75 08             	push   0x8(%ebp)
+  801368:	e8 51 fe ff ff       	call   8011be <fd_lookup>
+  80136d:	89 c3                	mov    %eax,%ebx
+  80136f:	83 c4 10             	add    $0x10,%esp
+  801372:	85 c0                	test   %eax,%eax
+  801374:	78 7f                	js     8013f5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801376:	83 ec 0c             	sub    $0xc,%esp
+  801379:	ff 75 0c             	push   0xc(%ebp)
+  80137c:	e8 82 ff ff ff       	call   801303 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801381:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801384:	c1 e6 0c             	shl    $0xc,%esi
+  801387:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80138d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801390:	89 3c 24             	mov    %edi,(%esp)
+  801393:	e8 bf fd ff ff       	call   801157 <fd2data>
+  801398:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80139a:	89 34 24             	mov    %esi,(%esp)
+  80139d:	e8 b5 fd ff ff       	call   801157 <fd2data>
+  8013a2:	83 c4 10             	add    $0x10,%esp
+  8013a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8013a8:	89 d8                	mov    %ebx,%eax
+  8013aa:	c1 e8 16             	shr    $0x16,%eax
+  8013ad:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013b4:	a8 01                	test   $0x1,%al
+  8013b6:	74 11                	je     8013c9 <dup+0x71>
+  8013b8:	89 d8                	mov    %ebx,%eax
+  8013ba:	c1 e8 0c             	shr    $0xc,%eax
+  8013bd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013c4:	f6 c2 01             	test   $0x1,%dl
+  8013c7:	75 36                	jne    8013ff <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013c9:	89 f8                	mov    %edi,%eax
+  8013cb:	c1 e8 0c             	shr    $0xc,%eax
+  8013ce:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013d5:	83 ec 0c             	sub    $0xc,%esp
+  8013d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013dd:	50                   	push   %eax
+  8013de:	56                   	push   %esi
+  8013df:	6a 00                	push   $0x0
+  8013e1:	57                   	push   %edi
+  8013e2:	6a 00                	push   $0x0
+  8013e4:	e8 3e f9 ff ff       	call   800d27 <sys_page_map>
+  8013e9:	89 c3                	mov    %eax,%ebx
+  8013eb:	83 c4 20             	add    $0x20,%esp
+  8013ee:	85 c0                	test   %eax,%eax
+  8013f0:	78 33                	js     801425 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013f5:	89 d8                	mov    %ebx,%eax
+  8013f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fa:	5b                   	pop    %ebx
+  8013fb:	5e                   	pop    %esi
+  8013fc:	5f                   	pop    %edi
+  8013fd:	5d                   	pop    %ebp
+  8013fe:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801406:	83 ec 0c             	sub    $0xc,%esp
+  801409:	25 07 0e 00 00       	and    $0xe07,%eax
+  80140e:	50                   	push   %eax
+  80140f:	ff 75 d4             	push   -0x2c(%ebp)
+  801412:	6a 00                	push   $0x0
+  801414:	53                   	push   %ebx
+  801415:	6a 00                	push   $0x0
+  801417:	e8 0b f9 ff ff       	call   800d27 <sys_page_map>
+  80141c:	89 c3                	mov    %eax,%ebx
+  80141e:	83 c4 20             	add    $0x20,%esp
+  801421:	85 c0                	test   %eax,%eax
+  801423:	79 a4                	jns    8013c9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801425:	83 ec 08             	sub    $0x8,%esp
+  801428:	56                   	push   %esi
+  801429:	6a 00                	push   $0x0
+  80142b:	e8 39 f9 ff ff       	call   800d69 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801430:	83 c4 08             	add    $0x8,%esp
+  801433:	ff 75 d4             	push   -0x2c(%ebp)
+  801436:	6a 00                	push   $0x0
+  801438:	e8 2c f9 ff ff       	call   800d69 <sys_page_unmap>
+	return r;
+  80143d:	83 c4 10             	add    $0x10,%esp
+  801440:	eb b3                	jmp    8013f5 <dup+0x9d>
+
+00801442 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801442:	55                   	push   %ebp
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	56                   	push   %esi
+  801446:	53                   	push   %ebx
+  801447:	83 ec 18             	sub    $0x18,%esp
+  80144a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80144d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801450:	50                   	push   %eax
+  801451:	53                   	push   %ebx
+  801452:	e8 67 fd ff ff       	call   8011be <fd_lookup>
+  801457:	83 c4 10             	add    $0x10,%esp
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	78 3c                	js     80149a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80145e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801461:	83 ec 08             	sub    $0x8,%esp
+  801464:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801467:	50                   	push   %eax
+  801468:	ff 36                	push   (%esi)
+  80146a:	e8 a1 fd ff ff       	call   801210 <dev_lookup>
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	85 c0                	test   %eax,%eax
+  801474:	78 24                	js     80149a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801476:	8b 46 08             	mov    0x8(%esi),%eax
+  801479:	83 e0 03             	and    $0x3,%eax
+  80147c:	83 f8 01             	cmp    $0x1,%eax
+  80147f:	74 20                	je     8014a1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801481:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801484:	8b 40 08             	mov    0x8(%eax),%eax
+  801487:	85 c0                	test   %eax,%eax
+  801489:	74 54                	je     8014df <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80148b:	83 ec 04             	sub    $0x4,%esp
+  80148e:	ff 75 10             	push   0x10(%ebp)
+  801491:	ff 75 0c             	push   0xc(%ebp)
+  801494:	56                   	push   %esi
+  801495:	ff d0                	call   *%eax
+  801497:	83 c4 10             	add    $0x10,%esp
+}
+  80149a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80149d:	5b                   	pop    %ebx
+  80149e:	5e                   	pop    %esi
+  80149f:	5d                   	pop    %ebp
+  8014a0:	c3                   	ret
+  8014a1:	89 e2                	mov    %esp,%edx
+  8014a3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8014a8:	29 d0                	sub    %edx,%eax
+  8014aa:	89 c2                	mov    %eax,%edx
+  8014ac:	c1 ea 0f             	shr    $0xf,%edx
+  8014af:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b9:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014bc:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8014c3:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c6:	83 ec 04             	sub    $0x4,%esp
+  8014c9:	53                   	push   %ebx
+  8014ca:	50                   	push   %eax
+  8014cb:	68 99 3e 80 00       	push   $0x803e99
+  8014d0:	e8 e4 ec ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014dd:	eb bb                	jmp    80149a <read+0x58>
+		return -E_NOT_SUPP;
+  8014df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014e4:	eb b4                	jmp    80149a <read+0x58>
+
+008014e6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	57                   	push   %edi
+  8014ea:	56                   	push   %esi
+  8014eb:	53                   	push   %ebx
+  8014ec:	83 ec 0c             	sub    $0xc,%esp
+  8014ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014f5:	85 f6                	test   %esi,%esi
+  8014f7:	74 30                	je     801529 <readn+0x43>
+  8014f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fe:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801503:	83 ec 04             	sub    $0x4,%esp
+  801506:	89 f2                	mov    %esi,%edx
+  801508:	29 c2                	sub    %eax,%edx
+  80150a:	52                   	push   %edx
+  80150b:	01 f8                	add    %edi,%eax
+  80150d:	50                   	push   %eax
+  80150e:	ff 75 08             	push   0x8(%ebp)
+  801511:	e8 2c ff ff ff       	call   801442 <read>
+		if (m < 0)
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 15                	js     801532 <readn+0x4c>
+			return m;
+		if (m == 0)
+  80151d:	74 11                	je     801530 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80151f:	01 c3                	add    %eax,%ebx
+  801521:	89 d8                	mov    %ebx,%eax
+  801523:	39 f3                	cmp    %esi,%ebx
+  801525:	72 dc                	jb     801503 <readn+0x1d>
+  801527:	eb 09                	jmp    801532 <readn+0x4c>
+  801529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152e:	eb 02                	jmp    801532 <readn+0x4c>
+  801530:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801532:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5f                   	pop    %edi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+
+0080153a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	56                   	push   %esi
+  80153e:	53                   	push   %ebx
+  80153f:	83 ec 18             	sub    $0x18,%esp
+  801542:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801545:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801548:	50                   	push   %eax
+  801549:	53                   	push   %ebx
+  80154a:	e8 6f fc ff ff       	call   8011be <fd_lookup>
+  80154f:	83 c4 10             	add    $0x10,%esp
+  801552:	85 c0                	test   %eax,%eax
+  801554:	78 37                	js     80158d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801556:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801559:	83 ec 08             	sub    $0x8,%esp
+  80155c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80155f:	50                   	push   %eax
+  801560:	ff 36                	push   (%esi)
+  801562:	e8 a9 fc ff ff       	call   801210 <dev_lookup>
+  801567:	83 c4 10             	add    $0x10,%esp
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	78 1f                	js     80158d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80156e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801572:	74 20                	je     801594 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801574:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801577:	8b 40 0c             	mov    0xc(%eax),%eax
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	74 54                	je     8015d2 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80157e:	83 ec 04             	sub    $0x4,%esp
+  801581:	ff 75 10             	push   0x10(%ebp)
+  801584:	ff 75 0c             	push   0xc(%ebp)
+  801587:	56                   	push   %esi
+  801588:	ff d0                	call   *%eax
+  80158a:	83 c4 10             	add    $0x10,%esp
+}
+  80158d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801590:	5b                   	pop    %ebx
+  801591:	5e                   	pop    %esi
+  801592:	5d                   	pop    %ebp
+  801593:	c3                   	ret
+  801594:	89 e2                	mov    %esp,%edx
+  801596:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80159b:	29 d0                	sub    %edx,%eax
+  80159d:	89 c2                	mov    %eax,%edx
+  80159f:	c1 ea 0f             	shr    $0xf,%edx
+  8015a2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ac:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015af:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8015b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8015b9:	83 ec 04             	sub    $0x4,%esp
+  8015bc:	53                   	push   %ebx
+  8015bd:	50                   	push   %eax
+  8015be:	68 b5 3e 80 00       	push   $0x803eb5
+  8015c3:	e8 f1 eb ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  8015c8:	83 c4 10             	add    $0x10,%esp
+  8015cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d0:	eb bb                	jmp    80158d <write+0x53>
+		return -E_NOT_SUPP;
+  8015d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015d7:	eb b4                	jmp    80158d <write+0x53>
+
+008015d9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e2:	50                   	push   %eax
+  8015e3:	ff 75 08             	push   0x8(%ebp)
+  8015e6:	e8 d3 fb ff ff       	call   8011be <fd_lookup>
+  8015eb:	83 c4 10             	add    $0x10,%esp
+  8015ee:	85 c0                	test   %eax,%eax
+  8015f0:	78 0e                	js     801600 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015f8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801600:	c9                   	leave
+  801601:	c3                   	ret
+
+00801602 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801602:	55                   	push   %ebp
+  801603:	89 e5                	mov    %esp,%ebp
+  801605:	53                   	push   %ebx
+  801606:	83 ec 1c             	sub    $0x1c,%esp
+  801609:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80160c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160f:	50                   	push   %eax
+  801610:	ff 75 08             	push   0x8(%ebp)
+  801613:	e8 a6 fb ff ff       	call   8011be <fd_lookup>
+  801618:	83 c4 10             	add    $0x10,%esp
+  80161b:	85 c0                	test   %eax,%eax
+  80161d:	78 33                	js     801652 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80161f:	83 fb 03             	cmp    $0x3,%ebx
+  801622:	74 28                	je     80164c <fcntl+0x4a>
+  801624:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801629:	83 fb 04             	cmp    $0x4,%ebx
+  80162c:	75 24                	jne    801652 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80162e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801631:	8b 41 08             	mov    0x8(%ecx),%eax
+  801634:	80 e4 ef             	and    $0xef,%ah
+  801637:	8b 55 10             	mov    0x10(%ebp),%edx
+  80163a:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801640:	09 d0                	or     %edx,%eax
+  801642:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164a:	eb 06                	jmp    801652 <fcntl+0x50>
+		return fd->fd_omode;
+  80164c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164f:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801652:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801655:	c9                   	leave
+  801656:	c3                   	ret
+
+00801657 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	56                   	push   %esi
+  80165b:	53                   	push   %ebx
+  80165c:	83 ec 18             	sub    $0x18,%esp
+  80165f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801662:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801665:	50                   	push   %eax
+  801666:	53                   	push   %ebx
+  801667:	e8 52 fb ff ff       	call   8011be <fd_lookup>
+  80166c:	83 c4 10             	add    $0x10,%esp
+  80166f:	85 c0                	test   %eax,%eax
+  801671:	78 34                	js     8016a7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801673:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801676:	83 ec 08             	sub    $0x8,%esp
+  801679:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167c:	50                   	push   %eax
+  80167d:	ff 36                	push   (%esi)
+  80167f:	e8 8c fb ff ff       	call   801210 <dev_lookup>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 1c                	js     8016a7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80168b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80168f:	74 1d                	je     8016ae <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801691:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801694:	8b 40 18             	mov    0x18(%eax),%eax
+  801697:	85 c0                	test   %eax,%eax
+  801699:	74 51                	je     8016ec <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80169b:	83 ec 08             	sub    $0x8,%esp
+  80169e:	ff 75 0c             	push   0xc(%ebp)
+  8016a1:	56                   	push   %esi
+  8016a2:	ff d0                	call   *%eax
+  8016a4:	83 c4 10             	add    $0x10,%esp
+}
+  8016a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016aa:	5b                   	pop    %ebx
+  8016ab:	5e                   	pop    %esi
+  8016ac:	5d                   	pop    %ebp
+  8016ad:	c3                   	ret
+  8016ae:	89 e2                	mov    %esp,%edx
+  8016b0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016b5:	29 d0                	sub    %edx,%eax
+  8016b7:	89 c2                	mov    %eax,%edx
+  8016b9:	c1 ea 0f             	shr    $0xf,%edx
+  8016bc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c6:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8016c9:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8016d0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016d3:	83 ec 04             	sub    $0x4,%esp
+  8016d6:	53                   	push   %ebx
+  8016d7:	50                   	push   %eax
+  8016d8:	68 78 3e 80 00       	push   $0x803e78
+  8016dd:	e8 d7 ea ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  8016e2:	83 c4 10             	add    $0x10,%esp
+  8016e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ea:	eb bb                	jmp    8016a7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f1:	eb b4                	jmp    8016a7 <ftruncate+0x50>
+
+008016f3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016f3:	55                   	push   %ebp
+  8016f4:	89 e5                	mov    %esp,%ebp
+  8016f6:	56                   	push   %esi
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 18             	sub    $0x18,%esp
+  8016fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801701:	50                   	push   %eax
+  801702:	ff 75 08             	push   0x8(%ebp)
+  801705:	e8 b4 fa ff ff       	call   8011be <fd_lookup>
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	78 53                	js     801764 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801711:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801714:	83 ec 08             	sub    $0x8,%esp
+  801717:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80171a:	50                   	push   %eax
+  80171b:	ff 36                	push   (%esi)
+  80171d:	e8 ee fa ff ff       	call   801210 <dev_lookup>
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	85 c0                	test   %eax,%eax
+  801727:	78 3b                	js     801764 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801729:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801730:	74 39                	je     80176b <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801732:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801735:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80173c:	00 00 00 
+	stat->st_isdir = 0;
+  80173f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801746:	00 00 00 
+	stat->st_version = 0;
+  801749:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801750:	00 00 00 
+	stat->st_dev = dev;
+  801753:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801759:	83 ec 08             	sub    $0x8,%esp
+  80175c:	53                   	push   %ebx
+  80175d:	56                   	push   %esi
+  80175e:	ff 50 14             	call   *0x14(%eax)
+  801761:	83 c4 10             	add    $0x10,%esp
+}
+  801764:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801767:	5b                   	pop    %ebx
+  801768:	5e                   	pop    %esi
+  801769:	5d                   	pop    %ebp
+  80176a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80176b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801770:	eb f2                	jmp    801764 <fstat+0x71>
+
+00801772 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	56                   	push   %esi
+  801776:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801777:	83 ec 08             	sub    $0x8,%esp
+  80177a:	6a 00                	push   $0x0
+  80177c:	ff 75 08             	push   0x8(%ebp)
+  80177f:	e8 b7 01 00 00       	call   80193b <open>
+  801784:	89 c3                	mov    %eax,%ebx
+  801786:	83 c4 10             	add    $0x10,%esp
+  801789:	85 c0                	test   %eax,%eax
+  80178b:	78 1b                	js     8017a8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80178d:	83 ec 08             	sub    $0x8,%esp
+  801790:	ff 75 0c             	push   0xc(%ebp)
+  801793:	50                   	push   %eax
+  801794:	e8 5a ff ff ff       	call   8016f3 <fstat>
+  801799:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80179b:	89 1c 24             	mov    %ebx,(%esp)
+  80179e:	e8 60 fb ff ff       	call   801303 <close>
+	return r;
+  8017a3:	83 c4 10             	add    $0x10,%esp
+  8017a6:	89 f3                	mov    %esi,%ebx
+}
+  8017a8:	89 d8                	mov    %ebx,%eax
+  8017aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ad:	5b                   	pop    %ebx
+  8017ae:	5e                   	pop    %esi
+  8017af:	5d                   	pop    %ebp
+  8017b0:	c3                   	ret
+
+008017b1 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	56                   	push   %esi
+  8017b5:	53                   	push   %ebx
+  8017b6:	89 c6                	mov    %eax,%esi
+  8017b8:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8017ba:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8017c1:	74 27                	je     8017ea <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017c3:	6a 07                	push   $0x7
+  8017c5:	68 00 60 80 00       	push   $0x806000
+  8017ca:	56                   	push   %esi
+  8017cb:	ff 35 00 50 80 00    	push   0x805000
+  8017d1:	e8 1f 20 00 00       	call   8037f5 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017d6:	83 c4 0c             	add    $0xc,%esp
+  8017d9:	6a 00                	push   $0x0
+  8017db:	53                   	push   %ebx
+  8017dc:	6a 00                	push   $0x0
+  8017de:	e8 82 1d 00 00       	call   803565 <ipc_recv>
+}
+  8017e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e6:	5b                   	pop    %ebx
+  8017e7:	5e                   	pop    %esi
+  8017e8:	5d                   	pop    %ebp
+  8017e9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017ea:	83 ec 0c             	sub    $0xc,%esp
+  8017ed:	6a 02                	push   $0x2
+  8017ef:	e8 6a 20 00 00       	call   80385e <ipc_find_env>
+  8017f4:	a3 00 50 80 00       	mov    %eax,0x805000
+  8017f9:	83 c4 10             	add    $0x10,%esp
+  8017fc:	eb c5                	jmp    8017c3 <fsipc+0x12>
+
+008017fe <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017fe:	55                   	push   %ebp
+  8017ff:	89 e5                	mov    %esp,%ebp
+  801801:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801804:	8b 45 08             	mov    0x8(%ebp),%eax
+  801807:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80180f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801812:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801821:	e8 8b ff ff ff       	call   8017b1 <fsipc>
+}
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+
+00801828 <devfile_flush>:
+{
+  801828:	55                   	push   %ebp
+  801829:	89 e5                	mov    %esp,%ebp
+  80182b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80182e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801831:	8b 40 0c             	mov    0xc(%eax),%eax
+  801834:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801839:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801843:	e8 69 ff ff ff       	call   8017b1 <fsipc>
+}
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+
+0080184a <devfile_stat>:
+{
+  80184a:	55                   	push   %ebp
+  80184b:	89 e5                	mov    %esp,%ebp
+  80184d:	53                   	push   %ebx
+  80184e:	83 ec 04             	sub    $0x4,%esp
+  801851:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801854:	8b 45 08             	mov    0x8(%ebp),%eax
+  801857:	8b 40 0c             	mov    0xc(%eax),%eax
+  80185a:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80185f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801864:	b8 05 00 00 00       	mov    $0x5,%eax
+  801869:	e8 43 ff ff ff       	call   8017b1 <fsipc>
+  80186e:	85 c0                	test   %eax,%eax
+  801870:	78 37                	js     8018a9 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801872:	83 ec 08             	sub    $0x8,%esp
+  801875:	68 00 60 80 00       	push   $0x806000
+  80187a:	53                   	push   %ebx
+  80187b:	e8 30 f0 ff ff       	call   8008b0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801880:	a1 80 60 80 00       	mov    0x806080,%eax
+  801885:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80188b:	a1 84 60 80 00       	mov    0x806084,%eax
+  801890:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801896:	a1 88 60 80 00       	mov    0x806088,%eax
+  80189b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8018a1:	83 c4 10             	add    $0x10,%esp
+  8018a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ac:	c9                   	leave
+  8018ad:	c3                   	ret
+
+008018ae <devfile_write>:
+{
+  8018ae:	55                   	push   %ebp
+  8018af:	89 e5                	mov    %esp,%ebp
+  8018b1:	83 ec 0c             	sub    $0xc,%esp
+  8018b4:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8018b7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018bc:	39 d0                	cmp    %edx,%eax
+  8018be:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c4:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018c7:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  8018cd:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8018d2:	50                   	push   %eax
+  8018d3:	ff 75 0c             	push   0xc(%ebp)
+  8018d6:	68 08 60 80 00       	push   $0x806008
+  8018db:	e8 80 f1 ff ff       	call   800a60 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8018e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018ea:	e8 c2 fe ff ff       	call   8017b1 <fsipc>
+}
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+
+008018f1 <devfile_read>:
+{
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  8018f4:	53                   	push   %ebx
+  8018f5:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018fe:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801903:	8b 45 10             	mov    0x10(%ebp),%eax
+  801906:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80190b:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801910:	b8 03 00 00 00       	mov    $0x3,%eax
+  801915:	e8 97 fe ff ff       	call   8017b1 <fsipc>
+  80191a:	89 c3                	mov    %eax,%ebx
+  80191c:	85 c0                	test   %eax,%eax
+  80191e:	78 14                	js     801934 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801920:	83 ec 04             	sub    $0x4,%esp
+  801923:	50                   	push   %eax
+  801924:	68 00 60 80 00       	push   $0x806000
+  801929:	ff 75 0c             	push   0xc(%ebp)
+  80192c:	e8 2f f1 ff ff       	call   800a60 <memmove>
+	return r;
+  801931:	83 c4 10             	add    $0x10,%esp
+}
+  801934:	89 d8                	mov    %ebx,%eax
+  801936:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801939:	c9                   	leave
+  80193a:	c3                   	ret
+
+0080193b <open>:
+{
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+  80193e:	53                   	push   %ebx
+  80193f:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801942:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801945:	50                   	push   %eax
+  801946:	e8 23 f8 ff ff       	call   80116e <fd_alloc>
+  80194b:	89 c3                	mov    %eax,%ebx
+  80194d:	83 c4 10             	add    $0x10,%esp
+  801950:	85 c0                	test   %eax,%eax
+  801952:	78 2a                	js     80197e <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801954:	83 ec 0c             	sub    $0xc,%esp
+  801957:	ff 75 08             	push   0x8(%ebp)
+  80195a:	e8 05 ef ff ff       	call   800864 <strlen>
+  80195f:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801962:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801967:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80196c:	7e 17                	jle    801985 <open+0x4a>
+	fd_close(fd, 1);
+  80196e:	83 ec 08             	sub    $0x8,%esp
+  801971:	6a 01                	push   $0x1
+  801973:	ff 75 f4             	push   -0xc(%ebp)
+  801976:	e8 08 f9 ff ff       	call   801283 <fd_close>
+	return r;
+  80197b:	83 c4 10             	add    $0x10,%esp
+}
+  80197e:	89 d8                	mov    %ebx,%eax
+  801980:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801983:	c9                   	leave
+  801984:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801985:	83 ec 08             	sub    $0x8,%esp
+  801988:	ff 75 08             	push   0x8(%ebp)
+  80198b:	68 00 60 80 00       	push   $0x806000
+  801990:	e8 1b ef ff ff       	call   8008b0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801995:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801998:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  80199d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019a5:	e8 07 fe ff ff       	call   8017b1 <fsipc>
+  8019aa:	89 c3                	mov    %eax,%ebx
+  8019ac:	83 c4 10             	add    $0x10,%esp
+  8019af:	85 c0                	test   %eax,%eax
+  8019b1:	78 bb                	js     80196e <open+0x33>
+	return fd2num(fd); 	
+  8019b3:	83 ec 0c             	sub    $0xc,%esp
+  8019b6:	ff 75 f4             	push   -0xc(%ebp)
+  8019b9:	e8 89 f7 ff ff       	call   801147 <fd2num>
+  8019be:	89 c3                	mov    %eax,%ebx
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	eb b9                	jmp    80197e <open+0x43>
+
+008019c5 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+  8019c8:	53                   	push   %ebx
+  8019c9:	83 ec 1c             	sub    $0x1c,%esp
+  8019cc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d2:	50                   	push   %eax
+  8019d3:	ff 75 08             	push   0x8(%ebp)
+  8019d6:	e8 e3 f7 ff ff       	call   8011be <fd_lookup>
+  8019db:	83 c4 10             	add    $0x10,%esp
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	78 5a                	js     801a3c <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8019e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e5:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8019eb:	39 10                	cmp    %edx,(%eax)
+  8019ed:	75 66                	jne    801a55 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8019ef:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8019f6:	74 49                	je     801a41 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8019f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fe:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  801a03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a06:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  801a0b:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a11:	6a 07                	push   $0x7
+  801a13:	68 00 60 80 00       	push   $0x806000
+  801a18:	6a 09                	push   $0x9
+  801a1a:	ff 35 00 50 80 00    	push   0x805000
+  801a20:	e8 d0 1d 00 00       	call   8037f5 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801a25:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a2c:	6a 00                	push   $0x0
+  801a2e:	53                   	push   %ebx
+  801a2f:	ff 75 10             	push   0x10(%ebp)
+  801a32:	6a 00                	push   $0x0
+  801a34:	e8 f9 1b 00 00       	call   803632 <ipc_recv_pages>
+  801a39:	83 c4 20             	add    $0x20,%esp
+}
+  801a3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3f:	c9                   	leave
+  801a40:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a41:	83 ec 0c             	sub    $0xc,%esp
+  801a44:	6a 02                	push   $0x2
+  801a46:	e8 13 1e 00 00       	call   80385e <ipc_find_env>
+  801a4b:	a3 00 50 80 00       	mov    %eax,0x805000
+  801a50:	83 c4 10             	add    $0x10,%esp
+  801a53:	eb a3                	jmp    8019f8 <fmap+0x33>
+		return -E_INVAL;
+  801a55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a5a:	eb e0                	jmp    801a3c <fmap+0x77>
+
+00801a5c <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801a5c:	55                   	push   %ebp
+  801a5d:	89 e5                	mov    %esp,%ebp
+  801a5f:	53                   	push   %ebx
+  801a60:	83 ec 10             	sub    $0x10,%esp
+  801a63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801a66:	53                   	push   %ebx
+  801a67:	e8 f8 ed ff ff       	call   800864 <strlen>
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a74:	7f 25                	jg     801a9b <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801a76:	83 ec 08             	sub    $0x8,%esp
+  801a79:	53                   	push   %ebx
+  801a7a:	68 00 60 80 00       	push   $0x806000
+  801a7f:	e8 2c ee ff ff       	call   8008b0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801a84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a89:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a8e:	e8 1e fd ff ff       	call   8017b1 <fsipc>
+  801a93:	83 c4 10             	add    $0x10,%esp
+}
+  801a96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a99:	c9                   	leave
+  801a9a:	c3                   	ret
+		return -E_BAD_PATH;
+  801a9b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801aa0:	eb f4                	jmp    801a96 <remove+0x3a>
+
+00801aa2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801aa2:	55                   	push   %ebp
+  801aa3:	89 e5                	mov    %esp,%ebp
+  801aa5:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801aa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aad:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ab2:	e8 fa fc ff ff       	call   8017b1 <fsipc>
+}
+  801ab7:	c9                   	leave
+  801ab8:	c3                   	ret
+
+00801ab9 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801abf:	68 e8 3e 80 00       	push   $0x803ee8
+  801ac4:	ff 75 0c             	push   0xc(%ebp)
+  801ac7:	e8 e4 ed ff ff       	call   8008b0 <strcpy>
+	return 0;
+}
+  801acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad1:	c9                   	leave
+  801ad2:	c3                   	ret
+
+00801ad3 <devsock_close>:
+{
+  801ad3:	55                   	push   %ebp
+  801ad4:	89 e5                	mov    %esp,%ebp
+  801ad6:	53                   	push   %ebx
+  801ad7:	83 ec 10             	sub    $0x10,%esp
+  801ada:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801add:	53                   	push   %ebx
+  801ade:	e8 ba 1d 00 00       	call   80389d <pageref>
+  801ae3:	89 c2                	mov    %eax,%edx
+  801ae5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801aed:	83 fa 01             	cmp    $0x1,%edx
+  801af0:	74 05                	je     801af7 <devsock_close+0x24>
+}
+  801af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af5:	c9                   	leave
+  801af6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801af7:	83 ec 0c             	sub    $0xc,%esp
+  801afa:	ff 73 0c             	push   0xc(%ebx)
+  801afd:	e8 b0 05 00 00       	call   8020b2 <nsipc_close>
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	eb eb                	jmp    801af2 <devsock_close+0x1f>
+
+00801b07 <devsock_write>:
+{
+  801b07:	55                   	push   %ebp
+  801b08:	89 e5                	mov    %esp,%ebp
+  801b0a:	53                   	push   %ebx
+  801b0b:	83 ec 14             	sub    $0x14,%esp
+  801b0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b11:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b14:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801b17:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801b1a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801b1d:	8b 41 08             	mov    0x8(%ecx),%eax
+  801b20:	c1 f8 09             	sar    $0x9,%eax
+  801b23:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801b26:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801b2c:	77 13                	ja     801b41 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801b2e:	50                   	push   %eax
+  801b2f:	52                   	push   %edx
+  801b30:	53                   	push   %ebx
+  801b31:	ff 71 0c             	push   0xc(%ecx)
+  801b34:	e8 5c 06 00 00       	call   802195 <nsipc_send>
+  801b39:	83 c4 10             	add    $0x10,%esp
+}
+  801b3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b3f:	c9                   	leave
+  801b40:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801b41:	50                   	push   %eax
+  801b42:	6a 01                	push   $0x1
+  801b44:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b47:	50                   	push   %eax
+  801b48:	ff 71 0c             	push   0xc(%ecx)
+  801b4b:	e8 a6 06 00 00       	call   8021f6 <nsipc_sendmsg>
+  801b50:	83 c4 10             	add    $0x10,%esp
+  801b53:	eb e7                	jmp    801b3c <devsock_write+0x35>
+
+00801b55 <devsock_read>:
+{
+  801b55:	55                   	push   %ebp
+  801b56:	89 e5                	mov    %esp,%ebp
+  801b58:	53                   	push   %ebx
+  801b59:	83 ec 14             	sub    $0x14,%esp
+  801b5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b5f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b62:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801b65:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801b68:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801b6b:	8b 41 08             	mov    0x8(%ecx),%eax
+  801b6e:	c1 f8 09             	sar    $0x9,%eax
+  801b71:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801b74:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801b7a:	77 13                	ja     801b8f <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801b7c:	50                   	push   %eax
+  801b7d:	52                   	push   %edx
+  801b7e:	53                   	push   %ebx
+  801b7f:	ff 71 0c             	push   0xc(%ecx)
+  801b82:	e8 9c 05 00 00       	call   802123 <nsipc_recv>
+  801b87:	83 c4 10             	add    $0x10,%esp
+}
+  801b8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b8d:	c9                   	leave
+  801b8e:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801b8f:	50                   	push   %eax
+  801b90:	6a 01                	push   $0x1
+  801b92:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b95:	50                   	push   %eax
+  801b96:	ff 71 0c             	push   0xc(%ecx)
+  801b99:	e8 02 0a 00 00       	call   8025a0 <nsipc_recvmsg>
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	eb e7                	jmp    801b8a <devsock_read+0x35>
+
+00801ba3 <fd2sockid>:
+{
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ba9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801bac:	52                   	push   %edx
+  801bad:	50                   	push   %eax
+  801bae:	e8 0b f6 ff ff       	call   8011be <fd_lookup>
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	78 10                	js     801bca <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801bba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbd:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801bc3:	39 08                	cmp    %ecx,(%eax)
+  801bc5:	75 05                	jne    801bcc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801bc7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801bca:	c9                   	leave
+  801bcb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bcc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd1:	eb f7                	jmp    801bca <fd2sockid+0x27>
+
+00801bd3 <sock_flags>:
+{
+  801bd3:	55                   	push   %ebp
+  801bd4:	89 e5                	mov    %esp,%ebp
+  801bd6:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801bd9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801bdc:	52                   	push   %edx
+  801bdd:	50                   	push   %eax
+  801bde:	e8 db f5 ff ff       	call   8011be <fd_lookup>
+  801be3:	83 c4 10             	add    $0x10,%esp
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 0e                	js     801bf8 <sock_flags+0x25>
+  801bea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bed:	8b 40 08             	mov    0x8(%eax),%eax
+  801bf0:	c1 e8 09             	shr    $0x9,%eax
+  801bf3:	83 e0 08             	and    $0x8,%eax
+}
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+		return 0;
+  801bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfd:	eb f7                	jmp    801bf6 <sock_flags+0x23>
+
+00801bff <alloc_sockfd>:
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	56                   	push   %esi
+  801c03:	53                   	push   %ebx
+  801c04:	83 ec 1c             	sub    $0x1c,%esp
+  801c07:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801c09:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c0c:	50                   	push   %eax
+  801c0d:	e8 5c f5 ff ff       	call   80116e <fd_alloc>
+  801c12:	89 c3                	mov    %eax,%ebx
+  801c14:	83 c4 10             	add    $0x10,%esp
+  801c17:	85 c0                	test   %eax,%eax
+  801c19:	78 43                	js     801c5e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801c1b:	83 ec 04             	sub    $0x4,%esp
+  801c1e:	68 07 04 00 00       	push   $0x407
+  801c23:	ff 75 f4             	push   -0xc(%ebp)
+  801c26:	6a 00                	push   $0x0
+  801c28:	e8 b7 f0 ff ff       	call   800ce4 <sys_page_alloc>
+  801c2d:	89 c3                	mov    %eax,%ebx
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	78 28                	js     801c5e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c39:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801c3f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c44:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801c4b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801c4e:	83 ec 0c             	sub    $0xc,%esp
+  801c51:	50                   	push   %eax
+  801c52:	e8 f0 f4 ff ff       	call   801147 <fd2num>
+  801c57:	89 c3                	mov    %eax,%ebx
+  801c59:	83 c4 10             	add    $0x10,%esp
+  801c5c:	eb 0c                	jmp    801c6a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c5e:	83 ec 0c             	sub    $0xc,%esp
+  801c61:	56                   	push   %esi
+  801c62:	e8 4b 04 00 00       	call   8020b2 <nsipc_close>
+		return r;
+  801c67:	83 c4 10             	add    $0x10,%esp
+}
+  801c6a:	89 d8                	mov    %ebx,%eax
+  801c6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c6f:	5b                   	pop    %ebx
+  801c70:	5e                   	pop    %esi
+  801c71:	5d                   	pop    %ebp
+  801c72:	c3                   	ret
+
+00801c73 <accept>:
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	56                   	push   %esi
+  801c77:	53                   	push   %ebx
+  801c78:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801c7b:	89 f0                	mov    %esi,%eax
+  801c7d:	e8 21 ff ff ff       	call   801ba3 <fd2sockid>
+  801c82:	89 c3                	mov    %eax,%ebx
+  801c84:	85 c0                	test   %eax,%eax
+  801c86:	78 24                	js     801cac <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801c88:	89 f0                	mov    %esi,%eax
+  801c8a:	e8 44 ff ff ff       	call   801bd3 <sock_flags>
+  801c8f:	50                   	push   %eax
+  801c90:	ff 75 10             	push   0x10(%ebp)
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	53                   	push   %ebx
+  801c97:	e8 6b 03 00 00       	call   802007 <nsipc_accept>
+  801c9c:	89 c3                	mov    %eax,%ebx
+  801c9e:	83 c4 10             	add    $0x10,%esp
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	78 07                	js     801cac <accept+0x39>
+	return alloc_sockfd(r);
+  801ca5:	e8 55 ff ff ff       	call   801bff <alloc_sockfd>
+  801caa:	89 c3                	mov    %eax,%ebx
+}
+  801cac:	89 d8                	mov    %ebx,%eax
+  801cae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb1:	5b                   	pop    %ebx
+  801cb2:	5e                   	pop    %esi
+  801cb3:	5d                   	pop    %ebp
+  801cb4:	c3                   	ret
+
+00801cb5 <bind>:
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbe:	e8 e0 fe ff ff       	call   801ba3 <fd2sockid>
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 12                	js     801cd9 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801cc7:	83 ec 04             	sub    $0x4,%esp
+  801cca:	ff 75 10             	push   0x10(%ebp)
+  801ccd:	ff 75 0c             	push   0xc(%ebp)
+  801cd0:	50                   	push   %eax
+  801cd1:	e8 85 03 00 00       	call   80205b <nsipc_bind>
+  801cd6:	83 c4 10             	add    $0x10,%esp
+}
+  801cd9:	c9                   	leave
+  801cda:	c3                   	ret
+
+00801cdb <shutdown>:
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce4:	e8 ba fe ff ff       	call   801ba3 <fd2sockid>
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	78 0f                	js     801cfc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801ced:	83 ec 08             	sub    $0x8,%esp
+  801cf0:	ff 75 0c             	push   0xc(%ebp)
+  801cf3:	50                   	push   %eax
+  801cf4:	e8 97 03 00 00       	call   802090 <nsipc_shutdown>
+  801cf9:	83 c4 10             	add    $0x10,%esp
+}
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+
+00801cfe <connect>:
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d07:	e8 97 fe ff ff       	call   801ba3 <fd2sockid>
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 12                	js     801d22 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d10:	83 ec 04             	sub    $0x4,%esp
+  801d13:	ff 75 10             	push   0x10(%ebp)
+  801d16:	ff 75 0c             	push   0xc(%ebp)
+  801d19:	50                   	push   %eax
+  801d1a:	e8 ad 03 00 00       	call   8020cc <nsipc_connect>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+}
+  801d22:	c9                   	leave
+  801d23:	c3                   	ret
+
+00801d24 <listen>:
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2d:	e8 71 fe ff ff       	call   801ba3 <fd2sockid>
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 0f                	js     801d45 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d36:	83 ec 08             	sub    $0x8,%esp
+  801d39:	ff 75 0c             	push   0xc(%ebp)
+  801d3c:	50                   	push   %eax
+  801d3d:	e8 bf 03 00 00       	call   802101 <nsipc_listen>
+  801d42:	83 c4 10             	add    $0x10,%esp
+}
+  801d45:	c9                   	leave
+  801d46:	c3                   	ret
+
+00801d47 <sendmsg>:
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	57                   	push   %edi
+  801d4b:	56                   	push   %esi
+  801d4c:	53                   	push   %ebx
+  801d4d:	83 ec 0c             	sub    $0xc,%esp
+  801d50:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d53:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801d56:	89 f0                	mov    %esi,%eax
+  801d58:	e8 46 fe ff ff       	call   801ba3 <fd2sockid>
+  801d5d:	89 c3                	mov    %eax,%ebx
+  801d5f:	85 c0                	test   %eax,%eax
+  801d61:	78 1c                	js     801d7f <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801d63:	89 f0                	mov    %esi,%eax
+  801d65:	e8 69 fe ff ff       	call   801bd3 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801d6a:	0b 45 10             	or     0x10(%ebp),%eax
+  801d6d:	50                   	push   %eax
+  801d6e:	ff 77 0c             	push   0xc(%edi)
+  801d71:	ff 77 08             	push   0x8(%edi)
+  801d74:	53                   	push   %ebx
+  801d75:	e8 7c 04 00 00       	call   8021f6 <nsipc_sendmsg>
+  801d7a:	89 c3                	mov    %eax,%ebx
+  801d7c:	83 c4 10             	add    $0x10,%esp
+}
+  801d7f:	89 d8                	mov    %ebx,%eax
+  801d81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d84:	5b                   	pop    %ebx
+  801d85:	5e                   	pop    %esi
+  801d86:	5f                   	pop    %edi
+  801d87:	5d                   	pop    %ebp
+  801d88:	c3                   	ret
+
+00801d89 <recvmsg>:
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	57                   	push   %edi
+  801d8d:	56                   	push   %esi
+  801d8e:	53                   	push   %ebx
+  801d8f:	83 ec 0c             	sub    $0xc,%esp
+  801d92:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d95:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d98:	89 f8                	mov    %edi,%eax
+  801d9a:	e8 04 fe ff ff       	call   801ba3 <fd2sockid>
+  801d9f:	89 c3                	mov    %eax,%ebx
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	78 2a                	js     801dcf <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801da5:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801dac:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801db3:	89 f8                	mov    %edi,%eax
+  801db5:	e8 19 fe ff ff       	call   801bd3 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801dba:	0b 45 10             	or     0x10(%ebp),%eax
+  801dbd:	50                   	push   %eax
+  801dbe:	ff 76 0c             	push   0xc(%esi)
+  801dc1:	ff 76 08             	push   0x8(%esi)
+  801dc4:	53                   	push   %ebx
+  801dc5:	e8 d6 07 00 00       	call   8025a0 <nsipc_recvmsg>
+  801dca:	89 c3                	mov    %eax,%ebx
+  801dcc:	83 c4 10             	add    $0x10,%esp
+}
+  801dcf:	89 d8                	mov    %ebx,%eax
+  801dd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd4:	5b                   	pop    %ebx
+  801dd5:	5e                   	pop    %esi
+  801dd6:	5f                   	pop    %edi
+  801dd7:	5d                   	pop    %ebp
+  801dd8:	c3                   	ret
+
+00801dd9 <sendfile>:
+{
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	56                   	push   %esi
+  801ddd:	53                   	push   %ebx
+  801dde:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801de1:	89 f0                	mov    %esi,%eax
+  801de3:	e8 bb fd ff ff       	call   801ba3 <fd2sockid>
+  801de8:	89 c3                	mov    %eax,%ebx
+  801dea:	85 c0                	test   %eax,%eax
+  801dec:	78 1f                	js     801e0d <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801dee:	89 f0                	mov    %esi,%eax
+  801df0:	e8 de fd ff ff       	call   801bd3 <sock_flags>
+  801df5:	83 ec 0c             	sub    $0xc,%esp
+  801df8:	50                   	push   %eax
+  801df9:	ff 75 14             	push   0x14(%ebp)
+  801dfc:	ff 75 10             	push   0x10(%ebp)
+  801dff:	ff 75 0c             	push   0xc(%ebp)
+  801e02:	53                   	push   %ebx
+  801e03:	e8 64 06 00 00       	call   80246c <nsipc_sendfile>
+  801e08:	89 c3                	mov    %eax,%ebx
+  801e0a:	83 c4 20             	add    $0x20,%esp
+}
+  801e0d:	89 d8                	mov    %ebx,%eax
+  801e0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e12:	5b                   	pop    %ebx
+  801e13:	5e                   	pop    %esi
+  801e14:	5d                   	pop    %ebp
+  801e15:	c3                   	ret
+
+00801e16 <evctl>:
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	53                   	push   %ebx
+  801e1a:	83 ec 04             	sub    $0x4,%esp
+  801e1d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801e20:	89 d8                	mov    %ebx,%eax
+  801e22:	e8 7c fd ff ff       	call   801ba3 <fd2sockid>
+  801e27:	85 c0                	test   %eax,%eax
+  801e29:	78 10                	js     801e3b <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801e2b:	83 ec 04             	sub    $0x4,%esp
+  801e2e:	53                   	push   %ebx
+  801e2f:	ff 75 0c             	push   0xc(%ebp)
+  801e32:	50                   	push   %eax
+  801e33:	e8 d2 0b 00 00       	call   802a0a <nsipc_evctl>
+  801e38:	83 c4 10             	add    $0x10,%esp
+}
+  801e3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e3e:	c9                   	leave
+  801e3f:	c3                   	ret
+
+00801e40 <evwait>:
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801e46:	ff 75 10             	push   0x10(%ebp)
+  801e49:	ff 75 0c             	push   0xc(%ebp)
+  801e4c:	ff 75 08             	push   0x8(%ebp)
+  801e4f:	e8 e0 0b 00 00       	call   802a34 <nsipc_evwait>
+}
+  801e54:	c9                   	leave
+  801e55:	c3                   	ret
+
+00801e56 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e5c:	ff 75 10             	push   0x10(%ebp)
+  801e5f:	ff 75 0c             	push   0xc(%ebp)
+  801e62:	ff 75 08             	push   0x8(%ebp)
+  801e65:	e8 31 0c 00 00       	call   802a9b <nsipc_socket>
+  801e6a:	83 c4 10             	add    $0x10,%esp
+  801e6d:	85 c0                	test   %eax,%eax
+  801e6f:	78 05                	js     801e76 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e71:	e8 89 fd ff ff       	call   801bff <alloc_sockfd>
+}
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+
+00801e78 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	53                   	push   %ebx
+  801e7c:	83 ec 04             	sub    $0x4,%esp
+  801e7f:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801e81:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801e88:	74 26                	je     801eb0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e8a:	6a 07                	push   $0x7
+  801e8c:	68 00 70 80 00       	push   $0x807000
+  801e91:	53                   	push   %ebx
+  801e92:	ff 35 24 53 80 00    	push   0x805324
+  801e98:	e8 58 19 00 00       	call   8037f5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e9d:	83 c4 0c             	add    $0xc,%esp
+  801ea0:	6a 00                	push   $0x0
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	6a 00                	push   $0x0
+  801ea6:	e8 ba 16 00 00       	call   803565 <ipc_recv>
+}
+  801eab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eae:	c9                   	leave
+  801eaf:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801eb0:	83 ec 0c             	sub    $0xc,%esp
+  801eb3:	6a 03                	push   $0x3
+  801eb5:	e8 a4 19 00 00       	call   80385e <ipc_find_env>
+  801eba:	a3 24 53 80 00       	mov    %eax,0x805324
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	eb c6                	jmp    801e8a <nsipc+0x12>
+
+00801ec4 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801ec4:	55                   	push   %ebp
+  801ec5:	89 e5                	mov    %esp,%ebp
+  801ec7:	56                   	push   %esi
+  801ec8:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801ec9:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  801ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801ed4:	85 f6                	test   %esi,%esi
+  801ed6:	75 33                	jne    801f0b <nsbulk_map+0x47>
+  801ed8:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801edd:	83 ec 04             	sub    $0x4,%esp
+  801ee0:	6a 07                	push   $0x7
+  801ee2:	53                   	push   %ebx
+  801ee3:	6a 00                	push   $0x0
+  801ee5:	e8 fa ed ff ff       	call   800ce4 <sys_page_alloc>
+  801eea:	83 c4 10             	add    $0x10,%esp
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	78 1a                	js     801f0b <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801ef1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ef7:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801efd:	75 de                	jne    801edd <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801eff:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  801f06:	00 00 00 
+	return 0;
+  801f09:	89 f0                	mov    %esi,%eax
+}
+  801f0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f0e:	5b                   	pop    %ebx
+  801f0f:	5e                   	pop    %esi
+  801f10:	5d                   	pop    %ebp
+  801f11:	c3                   	ret
+
+00801f12 <nsbulk_own>:
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	57                   	push   %edi
+  801f16:	56                   	push   %esi
+  801f17:	53                   	push   %ebx
+  801f18:	83 ec 0c             	sub    $0xc,%esp
+  801f1b:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801f1d:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801f20:	85 d2                	test   %edx,%edx
+  801f22:	7f 0e                	jg     801f32 <nsbulk_own+0x20>
+	return 0;
+  801f24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f29:	eb 47                	jmp    801f72 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801f2b:	83 c3 01             	add    $0x1,%ebx
+  801f2e:	39 fb                	cmp    %edi,%ebx
+  801f30:	7d 3b                	jge    801f6d <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801f32:	be 01 00 00 00       	mov    $0x1,%esi
+  801f37:	89 d9                	mov    %ebx,%ecx
+  801f39:	d3 e6                	shl    %cl,%esi
+  801f3b:	89 f0                	mov    %esi,%eax
+  801f3d:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  801f43:	74 e6                	je     801f2b <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801f45:	83 ec 04             	sub    $0x4,%esp
+  801f48:	6a 07                	push   $0x7
+  801f4a:	89 d8                	mov    %ebx,%eax
+  801f4c:	c1 e0 0c             	shl    $0xc,%eax
+  801f4f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801f54:	50                   	push   %eax
+  801f55:	6a 00                	push   $0x0
+  801f57:	e8 88 ed ff ff       	call   800ce4 <sys_page_alloc>
+  801f5c:	83 c4 10             	add    $0x10,%esp
+  801f5f:	85 c0                	test   %eax,%eax
+  801f61:	78 0f                	js     801f72 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801f63:	f7 d6                	not    %esi
+  801f65:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801f6b:	eb be                	jmp    801f2b <nsbulk_own+0x19>
+	return 0;
+  801f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f75:	5b                   	pop    %ebx
+  801f76:	5e                   	pop    %esi
+  801f77:	5f                   	pop    %edi
+  801f78:	5d                   	pop    %ebp
+  801f79:	c3                   	ret
+
+00801f7a <nsipc_bulk>:
+{
+  801f7a:	55                   	push   %ebp
+  801f7b:	89 e5                	mov    %esp,%ebp
+  801f7d:	57                   	push   %edi
+  801f7e:	56                   	push   %esi
+  801f7f:	53                   	push   %ebx
+  801f80:	83 ec 1c             	sub    $0x1c,%esp
+  801f83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f86:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801f88:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801f8e:	c1 fb 0c             	sar    $0xc,%ebx
+  801f91:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  801f94:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801f9b:	74 56                	je     801ff3 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801f9d:	85 ff                	test   %edi,%edi
+  801f9f:	7e 24                	jle    801fc5 <nsipc_bulk+0x4b>
+  801fa1:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801fa7:	74 1c                	je     801fc5 <nsipc_bulk+0x4b>
+  801fa9:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801faf:	c1 e3 0c             	shl    $0xc,%ebx
+  801fb2:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801fb7:	0f b6 10             	movzbl (%eax),%edx
+  801fba:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801fbc:	05 00 10 00 00       	add    $0x1000,%eax
+  801fc1:	39 d8                	cmp    %ebx,%eax
+  801fc3:	75 f2                	jne    801fb7 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	56                   	push   %esi
+  801fc9:	57                   	push   %edi
+  801fca:	68 00 00 00 e0       	push   $0xe0000000
+  801fcf:	ff 75 e4             	push   -0x1c(%ebp)
+  801fd2:	ff 35 24 53 80 00    	push   0x805324
+  801fd8:	e8 4c 18 00 00       	call   803829 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801fdd:	83 c4 1c             	add    $0x1c,%esp
+  801fe0:	6a 00                	push   $0x0
+  801fe2:	6a 00                	push   $0x0
+  801fe4:	6a 00                	push   $0x0
+  801fe6:	e8 7a 15 00 00       	call   803565 <ipc_recv>
+}
+  801feb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fee:	5b                   	pop    %ebx
+  801fef:	5e                   	pop    %esi
+  801ff0:	5f                   	pop    %edi
+  801ff1:	5d                   	pop    %ebp
+  801ff2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ff3:	83 ec 0c             	sub    $0xc,%esp
+  801ff6:	6a 03                	push   $0x3
+  801ff8:	e8 61 18 00 00       	call   80385e <ipc_find_env>
+  801ffd:	a3 24 53 80 00       	mov    %eax,0x805324
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	eb 96                	jmp    801f9d <nsipc_bulk+0x23>
+
+00802007 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802007:	55                   	push   %ebp
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	53                   	push   %ebx
+  80200b:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80200e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802011:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  802016:	8b 45 14             	mov    0x14(%ebp),%eax
+  802019:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80201e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802023:	e8 50 fe ff ff       	call   801e78 <nsipc>
+  802028:	89 c3                	mov    %eax,%ebx
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	79 07                	jns    802035 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80202e:	89 d8                	mov    %ebx,%eax
+  802030:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802033:	c9                   	leave
+  802034:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802035:	83 ec 04             	sub    $0x4,%esp
+  802038:	ff 35 10 70 80 00    	push   0x807010
+  80203e:	68 00 70 80 00       	push   $0x807000
+  802043:	ff 75 0c             	push   0xc(%ebp)
+  802046:	e8 15 ea ff ff       	call   800a60 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80204b:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802051:	8b 45 10             	mov    0x10(%ebp),%eax
+  802054:	89 10                	mov    %edx,(%eax)
+  802056:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802059:	eb d3                	jmp    80202e <nsipc_accept+0x27>
+
+0080205b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80205b:	55                   	push   %ebp
+  80205c:	89 e5                	mov    %esp,%ebp
+  80205e:	53                   	push   %ebx
+  80205f:	83 ec 08             	sub    $0x8,%esp
+  802062:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802065:	8b 45 08             	mov    0x8(%ebp),%eax
+  802068:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80206d:	53                   	push   %ebx
+  80206e:	ff 75 0c             	push   0xc(%ebp)
+  802071:	68 04 70 80 00       	push   $0x807004
+  802076:	e8 e5 e9 ff ff       	call   800a60 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80207b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802081:	b8 02 00 00 00       	mov    $0x2,%eax
+  802086:	e8 ed fd ff ff       	call   801e78 <nsipc>
+}
+  80208b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208e:	c9                   	leave
+  80208f:	c3                   	ret
+
+00802090 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802090:	55                   	push   %ebp
+  802091:	89 e5                	mov    %esp,%ebp
+  802093:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802096:	8b 45 08             	mov    0x8(%ebp),%eax
+  802099:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80209e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8020a6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020ab:	e8 c8 fd ff ff       	call   801e78 <nsipc>
+}
+  8020b0:	c9                   	leave
+  8020b1:	c3                   	ret
+
+008020b2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8020b2:	55                   	push   %ebp
+  8020b3:	89 e5                	mov    %esp,%ebp
+  8020b5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8020b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bb:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8020c0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020c5:	e8 ae fd ff ff       	call   801e78 <nsipc>
+}
+  8020ca:	c9                   	leave
+  8020cb:	c3                   	ret
+
+008020cc <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8020cc:	55                   	push   %ebp
+  8020cd:	89 e5                	mov    %esp,%ebp
+  8020cf:	53                   	push   %ebx
+  8020d0:	83 ec 08             	sub    $0x8,%esp
+  8020d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8020d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d9:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8020de:	53                   	push   %ebx
+  8020df:	ff 75 0c             	push   0xc(%ebp)
+  8020e2:	68 04 70 80 00       	push   $0x807004
+  8020e7:	e8 74 e9 ff ff       	call   800a60 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8020ec:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8020f2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020f7:	e8 7c fd ff ff       	call   801e78 <nsipc>
+}
+  8020fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ff:	c9                   	leave
+  802100:	c3                   	ret
+
+00802101 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802101:	55                   	push   %ebp
+  802102:	89 e5                	mov    %esp,%ebp
+  802104:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802107:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80210f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802112:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802117:	b8 06 00 00 00       	mov    $0x6,%eax
+  80211c:	e8 57 fd ff ff       	call   801e78 <nsipc>
+}
+  802121:	c9                   	leave
+  802122:	c3                   	ret
+
+00802123 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802123:	55                   	push   %ebp
+  802124:	89 e5                	mov    %esp,%ebp
+  802126:	56                   	push   %esi
+  802127:	53                   	push   %ebx
+  802128:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80212b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802133:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802139:	8b 45 14             	mov    0x14(%ebp),%eax
+  80213c:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802141:	b8 07 00 00 00       	mov    $0x7,%eax
+  802146:	e8 2d fd ff ff       	call   801e78 <nsipc>
+  80214b:	89 c3                	mov    %eax,%ebx
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	78 22                	js     802173 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802151:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802156:	39 c6                	cmp    %eax,%esi
+  802158:	0f 4e c6             	cmovle %esi,%eax
+  80215b:	39 c3                	cmp    %eax,%ebx
+  80215d:	7f 1d                	jg     80217c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	53                   	push   %ebx
+  802163:	68 00 70 80 00       	push   $0x807000
+  802168:	ff 75 0c             	push   0xc(%ebp)
+  80216b:	e8 f0 e8 ff ff       	call   800a60 <memmove>
+  802170:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802173:	89 d8                	mov    %ebx,%eax
+  802175:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802178:	5b                   	pop    %ebx
+  802179:	5e                   	pop    %esi
+  80217a:	5d                   	pop    %ebp
+  80217b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80217c:	68 f4 3e 80 00       	push   $0x803ef4
+  802181:	68 09 3f 80 00       	push   $0x803f09
+  802186:	68 b2 00 00 00       	push   $0xb2
+  80218b:	68 1e 3f 80 00       	push   $0x803f1e
+  802190:	e8 8a 13 00 00       	call   80351f <_panic>
+
+00802195 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	53                   	push   %ebx
+  802199:	83 ec 04             	sub    $0x4,%esp
+  80219c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80219f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a2:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8021a7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8021ad:	7f 2e                	jg     8021dd <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8021af:	83 ec 04             	sub    $0x4,%esp
+  8021b2:	53                   	push   %ebx
+  8021b3:	ff 75 0c             	push   0xc(%ebp)
+  8021b6:	68 0c 70 80 00       	push   $0x80700c
+  8021bb:	e8 a0 e8 ff ff       	call   800a60 <memmove>
+	nsipcbuf.send.req_size = size;
+  8021c0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8021c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021c9:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8021ce:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021d3:	e8 a0 fc ff ff       	call   801e78 <nsipc>
+}
+  8021d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021db:	c9                   	leave
+  8021dc:	c3                   	ret
+	assert(size < 1600);
+  8021dd:	68 2a 3f 80 00       	push   $0x803f2a
+  8021e2:	68 09 3f 80 00       	push   $0x803f09
+  8021e7:	68 bd 00 00 00       	push   $0xbd
+  8021ec:	68 1e 3f 80 00       	push   $0x803f1e
+  8021f1:	e8 29 13 00 00       	call   80351f <_panic>
+
+008021f6 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	57                   	push   %edi
+  8021fa:	56                   	push   %esi
+  8021fb:	53                   	push   %ebx
+  8021fc:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8021ff:	e8 c0 fc ff ff       	call   801ec4 <nsbulk_map>
+  802204:	85 c0                	test   %eax,%eax
+  802206:	78 55                	js     80225d <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802208:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  80220f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802216:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80221d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802220:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802223:	0f 8d 24 02 00 00    	jge    80244d <nsipc_sendmsg+0x257>
+  802229:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80222f:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802232:	89 d8                	mov    %ebx,%eax
+  802234:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802239:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80223b:	83 ec 0c             	sub    $0xc,%esp
+  80223e:	68 20 50 80 00       	push   $0x805020
+  802243:	e8 5a 0f 00 00       	call   8031a2 <pgbatch_init>
+  802248:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80224b:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80224d:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802250:	e9 82 00 00 00       	jmp    8022d7 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802255:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802258:	85 db                	test   %ebx,%ebx
+  80225a:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  80225d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802260:	5b                   	pop    %ebx
+  802261:	5e                   	pop    %esi
+  802262:	5f                   	pop    %edi
+  802263:	5d                   	pop    %ebp
+  802264:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802265:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80226a:	29 c8                	sub    %ecx,%eax
+  80226c:	39 d0                	cmp    %edx,%eax
+  80226e:	0f 46 d0             	cmovbe %eax,%edx
+  802271:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802273:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802279:	85 ff                	test   %edi,%edi
+  80227b:	0f 49 c7             	cmovns %edi,%eax
+  80227e:	c1 f8 0c             	sar    $0xc,%eax
+  802281:	ba 01 00 00 00       	mov    $0x1,%edx
+  802286:	e8 87 fc ff ff       	call   801f12 <nsbulk_own>
+  80228b:	85 c0                	test   %eax,%eax
+  80228d:	0f 88 17 01 00 00    	js     8023aa <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802293:	83 ec 04             	sub    $0x4,%esp
+  802296:	56                   	push   %esi
+  802297:	ff 75 e0             	push   -0x20(%ebp)
+  80229a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80229d:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8022a2:	50                   	push   %eax
+  8022a3:	e8 b8 e7 ff ff       	call   800a60 <memmove>
+  8022a8:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8022ab:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8022ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022b1:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8022b4:	0f 84 fd 00 00 00    	je     8023b7 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8022ba:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8022bd:	01 f7                	add    %esi,%edi
+  8022bf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8022c2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8022c5:	0f 8d 01 01 00 00    	jge    8023cc <nsipc_sendmsg+0x1d6>
+  8022cb:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8022d1:	0f 8f f0 00 00 00    	jg     8023c7 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8022d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022da:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8022dd:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8022e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022e3:	89 c2                	mov    %eax,%edx
+  8022e5:	03 13                	add    (%ebx),%edx
+  8022e7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8022ea:	8b 73 04             	mov    0x4(%ebx),%esi
+  8022ed:	29 c6                	sub    %eax,%esi
+  8022ef:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8022f4:	29 f9                	sub    %edi,%ecx
+  8022f6:	39 ce                	cmp    %ecx,%esi
+  8022f8:	89 ca                	mov    %ecx,%edx
+  8022fa:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8022fd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802300:	89 f9                	mov    %edi,%ecx
+  802302:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802308:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80230b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802310:	09 c8                	or     %ecx,%eax
+  802312:	0f 85 4d ff ff ff    	jne    802265 <nsipc_sendmsg+0x6f>
+  802318:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80231e:	0f 86 41 ff ff ff    	jbe    802265 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802324:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80232a:	85 ff                	test   %edi,%edi
+  80232c:	0f 49 c7             	cmovns %edi,%eax
+  80232f:	c1 f8 0c             	sar    $0xc,%eax
+  802332:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802334:	89 d1                	mov    %edx,%ecx
+  802336:	c1 e9 0c             	shr    $0xc,%ecx
+  802339:	01 c8                	add    %ecx,%eax
+  80233b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80233e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802341:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802343:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802346:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80234b:	29 c8                	sub    %ecx,%eax
+  80234d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802350:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802353:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802355:	b8 01 00 00 00       	mov    $0x1,%eax
+  80235a:	89 f9                	mov    %edi,%ecx
+  80235c:	d3 e0                	shl    %cl,%eax
+  80235e:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802364:	83 ec 08             	sub    $0x8,%esp
+  802367:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802369:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80236c:	50                   	push   %eax
+  80236d:	6a 00                	push   $0x0
+  80236f:	56                   	push   %esi
+  802370:	6a 00                	push   $0x0
+  802372:	68 20 50 80 00       	push   $0x805020
+  802377:	e8 e4 0e 00 00       	call   803260 <pgbatch_map>
+  80237c:	83 c4 20             	add    $0x20,%esp
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	0f 88 ce fe ff ff    	js     802255 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802387:	83 c7 01             	add    $0x1,%edi
+  80238a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802390:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802393:	39 c7                	cmp    %eax,%edi
+  802395:	75 be                	jne    802355 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802397:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80239a:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80239d:	89 d6                	mov    %edx,%esi
+  80239f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8023a5:	e9 01 ff ff ff       	jmp    8022ab <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8023aa:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8023ad:	85 db                	test   %ebx,%ebx
+  8023af:	0f 45 c3             	cmovne %ebx,%eax
+  8023b2:	e9 a6 fe ff ff       	jmp    80225d <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8023b7:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8023bb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8023c2:	e9 f3 fe ff ff       	jmp    8022ba <nsipc_sendmsg+0xc4>
+  8023c7:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8023ca:	eb 03                	jmp    8023cf <nsipc_sendmsg+0x1d9>
+  8023cc:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8023cf:	83 ec 0c             	sub    $0xc,%esp
+  8023d2:	68 20 50 80 00       	push   $0x805020
+  8023d7:	e8 d4 0d 00 00       	call   8031b0 <pgbatch_flush>
+  8023dc:	83 c4 10             	add    $0x10,%esp
+  8023df:	85 c0                	test   %eax,%eax
+  8023e1:	78 50                	js     802433 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8023e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8023eb:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8023f1:	89 fb                	mov    %edi,%ebx
+  8023f3:	29 f3                	sub    %esi,%ebx
+  8023f5:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8023fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023fe:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802403:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802408:	89 fa                	mov    %edi,%edx
+  80240a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80240f:	e8 66 fb ff ff       	call   801f7a <nsipc_bulk>
+  802414:	85 c0                	test   %eax,%eax
+  802416:	78 28                	js     802440 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802418:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80241b:	39 c3                	cmp    %eax,%ebx
+  80241d:	75 0c                	jne    80242b <nsipc_sendmsg+0x235>
+  80241f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802422:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802425:	0f 8f f2 fd ff ff    	jg     80221d <nsipc_sendmsg+0x27>
+		sent += r;
+  80242b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80242e:	e9 2a fe ff ff       	jmp    80225d <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802433:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802436:	85 db                	test   %ebx,%ebx
+  802438:	0f 45 c3             	cmovne %ebx,%eax
+  80243b:	e9 1d fe ff ff       	jmp    80225d <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802440:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802443:	85 db                	test   %ebx,%ebx
+  802445:	0f 45 c3             	cmovne %ebx,%eax
+  802448:	e9 10 fe ff ff       	jmp    80225d <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+  802450:	68 20 50 80 00       	push   $0x805020
+  802455:	e8 48 0d 00 00       	call   8031a2 <pgbatch_init>
+  80245a:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80245d:	be 00 00 00 00       	mov    $0x0,%esi
+  802462:	bf 00 00 00 00       	mov    $0x0,%edi
+  802467:	e9 63 ff ff ff       	jmp    8023cf <nsipc_sendmsg+0x1d9>
+
+0080246c <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80246c:	55                   	push   %ebp
+  80246d:	89 e5                	mov    %esp,%ebp
+  80246f:	57                   	push   %edi
+  802470:	56                   	push   %esi
+  802471:	53                   	push   %ebx
+  802472:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802475:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  80247c:	0f 84 c8 00 00 00    	je     80254a <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802482:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  802489:	0f 84 e4 00 00 00    	je     802573 <nsipc_sendfile+0x107>
+{
+  80248f:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802494:	89 fb                	mov    %edi,%ebx
+  802496:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802499:	0f 83 f0 00 00 00    	jae    80258f <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80249f:	89 fa                	mov    %edi,%edx
+  8024a1:	03 55 10             	add    0x10(%ebp),%edx
+  8024a4:	89 d0                	mov    %edx,%eax
+  8024a6:	c1 f8 1f             	sar    $0x1f,%eax
+  8024a9:	c1 e8 14             	shr    $0x14,%eax
+  8024ac:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8024af:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8024b5:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8024b7:	6a 10                	push   $0x10
+  8024b9:	68 00 20 01 e0       	push   $0xe0012000
+  8024be:	52                   	push   %edx
+  8024bf:	ff 75 0c             	push   0xc(%ebp)
+  8024c2:	e8 fe f4 ff ff       	call   8019c5 <fmap>
+  8024c7:	83 c4 10             	add    $0x10,%esp
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	0f 8e b8 00 00 00    	jle    80258a <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8024d2:	39 c6                	cmp    %eax,%esi
+  8024d4:	0f 8d b5 00 00 00    	jge    80258f <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8024da:	29 f0                	sub    %esi,%eax
+  8024dc:	8b 55 14             	mov    0x14(%ebp),%edx
+  8024df:	29 da                	sub    %ebx,%edx
+  8024e1:	39 d0                	cmp    %edx,%eax
+  8024e3:	89 d3                	mov    %edx,%ebx
+  8024e5:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8024e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024eb:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8024f0:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8024f6:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8024fc:	8b 45 18             	mov    0x18(%ebp),%eax
+  8024ff:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802504:	83 ec 0c             	sub    $0xc,%esp
+  802507:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802509:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802510:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802513:	83 c0 01             	add    $0x1,%eax
+  802516:	50                   	push   %eax
+  802517:	68 00 10 01 e0       	push   $0xe0011000
+  80251c:	6a 11                	push   $0x11
+  80251e:	ff 35 24 53 80 00    	push   0x805324
+  802524:	e8 00 13 00 00       	call   803829 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802529:	83 c4 1c             	add    $0x1c,%esp
+  80252c:	6a 00                	push   $0x0
+  80252e:	6a 00                	push   $0x0
+  802530:	6a 00                	push   $0x0
+  802532:	e8 2e 10 00 00       	call   803565 <ipc_recv>
+  802537:	83 c4 10             	add    $0x10,%esp
+  80253a:	85 c0                	test   %eax,%eax
+  80253c:	78 5b                	js     802599 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  80253e:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802540:	39 c3                	cmp    %eax,%ebx
+  802542:	0f 8e 4c ff ff ff    	jle    802494 <nsipc_sendfile+0x28>
+  802548:	eb 45                	jmp    80258f <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80254a:	83 ec 04             	sub    $0x4,%esp
+  80254d:	6a 07                	push   $0x7
+  80254f:	68 00 10 01 e0       	push   $0xe0011000
+  802554:	6a 00                	push   $0x0
+  802556:	e8 89 e7 ff ff       	call   800ce4 <sys_page_alloc>
+  80255b:	89 c7                	mov    %eax,%edi
+  80255d:	83 c4 10             	add    $0x10,%esp
+  802560:	85 c0                	test   %eax,%eax
+  802562:	78 2b                	js     80258f <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802564:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  80256b:	00 00 00 
+  80256e:	e9 0f ff ff ff       	jmp    802482 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	6a 03                	push   $0x3
+  802578:	e8 e1 12 00 00       	call   80385e <ipc_find_env>
+  80257d:	a3 24 53 80 00       	mov    %eax,0x805324
+  802582:	83 c4 10             	add    $0x10,%esp
+  802585:	e9 05 ff ff ff       	jmp    80248f <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80258a:	85 ff                	test   %edi,%edi
+  80258c:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80258f:	89 f8                	mov    %edi,%eax
+  802591:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802594:	5b                   	pop    %ebx
+  802595:	5e                   	pop    %esi
+  802596:	5f                   	pop    %edi
+  802597:	5d                   	pop    %ebp
+  802598:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802599:	85 ff                	test   %edi,%edi
+  80259b:	0f 44 f8             	cmove  %eax,%edi
+  80259e:	eb ef                	jmp    80258f <nsipc_sendfile+0x123>
+
+008025a0 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8025a0:	55                   	push   %ebp
+  8025a1:	89 e5                	mov    %esp,%ebp
+  8025a3:	57                   	push   %edi
+  8025a4:	56                   	push   %esi
+  8025a5:	53                   	push   %ebx
+  8025a6:	83 ec 1c             	sub    $0x1c,%esp
+  8025a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8025ac:	e8 13 f9 ff ff       	call   801ec4 <nsbulk_map>
+  8025b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	0f 88 ba 00 00 00    	js     802676 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8025bc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8025c0:	0f 8e bb 00 00 00    	jle    802681 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8025c6:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8025cb:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8025d0:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8025d5:	89 f8                	mov    %edi,%eax
+  8025d7:	29 f0                	sub    %esi,%eax
+  8025d9:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8025dd:	39 c8                	cmp    %ecx,%eax
+  8025df:	0f 47 c1             	cmova  %ecx,%eax
+  8025e2:	01 f0                	add    %esi,%eax
+  8025e4:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8025e6:	83 c2 01             	add    $0x1,%edx
+  8025e9:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8025ec:	7e 07                	jle    8025f5 <nsipc_recvmsg+0x55>
+  8025ee:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8025f3:	7e e0                	jle    8025d5 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8025f5:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8025fb:	c1 fa 0c             	sar    $0xc,%edx
+  8025fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802603:	e8 0a f9 ff ff       	call   801f12 <nsbulk_own>
+  802608:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80260b:	85 c0                	test   %eax,%eax
+  80260d:	78 67                	js     802676 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80260f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802612:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802617:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80261d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802620:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802625:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80262a:	89 f2                	mov    %esi,%edx
+  80262c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802631:	e8 44 f9 ff ff       	call   801f7a <nsipc_bulk>
+  802636:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802639:	85 c0                	test   %eax,%eax
+  80263b:	78 39                	js     802676 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  80263d:	39 f0                	cmp    %esi,%eax
+  80263f:	7f 4a                	jg     80268b <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802641:	bf 00 00 00 00       	mov    $0x0,%edi
+  802646:	85 c0                	test   %eax,%eax
+  802648:	7e 2c                	jle    802676 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80264a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80264d:	29 fe                	sub    %edi,%esi
+  80264f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802652:	39 c6                	cmp    %eax,%esi
+  802654:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802657:	83 ec 04             	sub    $0x4,%esp
+  80265a:	56                   	push   %esi
+  80265b:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802661:	50                   	push   %eax
+  802662:	ff 33                	push   (%ebx)
+  802664:	e8 f7 e3 ff ff       	call   800a60 <memmove>
+		n += m;
+  802669:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80266b:	83 c3 08             	add    $0x8,%ebx
+  80266e:	83 c4 10             	add    $0x10,%esp
+  802671:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802674:	7f d4                	jg     80264a <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802676:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802679:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80267c:	5b                   	pop    %ebx
+  80267d:	5e                   	pop    %esi
+  80267e:	5f                   	pop    %edi
+  80267f:	5d                   	pop    %ebp
+  802680:	c3                   	ret
+	int r, i, n, len = 0;
+  802681:	be 00 00 00 00       	mov    $0x0,%esi
+  802686:	e9 6a ff ff ff       	jmp    8025f5 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80268b:	68 00 3f 80 00       	push   $0x803f00
+  802690:	68 09 3f 80 00       	push   $0x803f09
+  802695:	68 3b 01 00 00       	push   $0x13b
+  80269a:	68 1e 3f 80 00       	push   $0x803f1e
+  80269f:	e8 7b 0e 00 00       	call   80351f <_panic>
+
+008026a4 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8026a4:	55                   	push   %ebp
+  8026a5:	89 e5                	mov    %esp,%ebp
+  8026a7:	57                   	push   %edi
+  8026a8:	56                   	push   %esi
+  8026a9:	53                   	push   %ebx
+  8026aa:	83 ec 0c             	sub    $0xc,%esp
+  8026ad:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8026b0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8026b3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8026b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  8026be:	8b 07                	mov    (%edi),%eax
+  8026c0:	a3 04 70 80 00       	mov    %eax,0x807004
+  8026c5:	8b 47 04             	mov    0x4(%edi),%eax
+  8026c8:	a3 08 70 80 00       	mov    %eax,0x807008
+  8026cd:	8b 47 08             	mov    0x8(%edi),%eax
+  8026d0:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  8026d5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8026d8:	a3 10 70 80 00       	mov    %eax,0x807010
+  8026dd:	8b 47 10             	mov    0x10(%edi),%eax
+  8026e0:	a3 14 70 80 00       	mov    %eax,0x807014
+  8026e5:	8b 47 14             	mov    0x14(%edi),%eax
+  8026e8:	a3 18 70 80 00       	mov    %eax,0x807018
+  8026ed:	8b 47 18             	mov    0x18(%edi),%eax
+  8026f0:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  8026f5:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8026f8:	a3 20 70 80 00       	mov    %eax,0x807020
+  8026fd:	8b 47 20             	mov    0x20(%edi),%eax
+  802700:	a3 24 70 80 00       	mov    %eax,0x807024
+  802705:	8b 47 24             	mov    0x24(%edi),%eax
+  802708:	a3 28 70 80 00       	mov    %eax,0x807028
+  80270d:	8b 47 28             	mov    0x28(%edi),%eax
+  802710:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  802715:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802718:	a3 30 70 80 00       	mov    %eax,0x807030
+  80271d:	8b 47 30             	mov    0x30(%edi),%eax
+  802720:	a3 34 70 80 00       	mov    %eax,0x807034
+  802725:	8b 47 34             	mov    0x34(%edi),%eax
+  802728:	a3 38 70 80 00       	mov    %eax,0x807038
+  80272d:	8b 47 38             	mov    0x38(%edi),%eax
+  802730:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  802735:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802738:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  80273d:	8b 06                	mov    (%esi),%eax
+  80273f:	a3 44 70 80 00       	mov    %eax,0x807044
+  802744:	8b 46 04             	mov    0x4(%esi),%eax
+  802747:	a3 48 70 80 00       	mov    %eax,0x807048
+  80274c:	8b 46 08             	mov    0x8(%esi),%eax
+  80274f:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  802754:	8b 46 0c             	mov    0xc(%esi),%eax
+  802757:	a3 50 70 80 00       	mov    %eax,0x807050
+  80275c:	8b 46 10             	mov    0x10(%esi),%eax
+  80275f:	a3 54 70 80 00       	mov    %eax,0x807054
+  802764:	8b 46 14             	mov    0x14(%esi),%eax
+  802767:	a3 58 70 80 00       	mov    %eax,0x807058
+  80276c:	8b 46 18             	mov    0x18(%esi),%eax
+  80276f:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  802774:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802777:	a3 60 70 80 00       	mov    %eax,0x807060
+  80277c:	8b 46 20             	mov    0x20(%esi),%eax
+  80277f:	a3 64 70 80 00       	mov    %eax,0x807064
+  802784:	8b 46 24             	mov    0x24(%esi),%eax
+  802787:	a3 68 70 80 00       	mov    %eax,0x807068
+  80278c:	8b 46 28             	mov    0x28(%esi),%eax
+  80278f:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  802794:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802797:	a3 70 70 80 00       	mov    %eax,0x807070
+  80279c:	8b 46 30             	mov    0x30(%esi),%eax
+  80279f:	a3 74 70 80 00       	mov    %eax,0x807074
+  8027a4:	8b 46 34             	mov    0x34(%esi),%eax
+  8027a7:	a3 78 70 80 00       	mov    %eax,0x807078
+  8027ac:	8b 46 38             	mov    0x38(%esi),%eax
+  8027af:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  8027b4:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8027b7:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8027bc:	8b 03                	mov    (%ebx),%eax
+  8027be:	a3 84 70 80 00       	mov    %eax,0x807084
+  8027c3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027c6:	a3 88 70 80 00       	mov    %eax,0x807088
+  8027cb:	8b 43 08             	mov    0x8(%ebx),%eax
+  8027ce:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  8027d3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8027d6:	a3 90 70 80 00       	mov    %eax,0x807090
+  8027db:	8b 43 10             	mov    0x10(%ebx),%eax
+  8027de:	a3 94 70 80 00       	mov    %eax,0x807094
+  8027e3:	8b 43 14             	mov    0x14(%ebx),%eax
+  8027e6:	a3 98 70 80 00       	mov    %eax,0x807098
+  8027eb:	8b 43 18             	mov    0x18(%ebx),%eax
+  8027ee:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  8027f3:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8027f6:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  8027fb:	8b 43 20             	mov    0x20(%ebx),%eax
+  8027fe:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  802803:	8b 43 24             	mov    0x24(%ebx),%eax
+  802806:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  80280b:	8b 43 28             	mov    0x28(%ebx),%eax
+  80280e:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  802813:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802816:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  80281b:	8b 43 30             	mov    0x30(%ebx),%eax
+  80281e:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  802823:	8b 43 34             	mov    0x34(%ebx),%eax
+  802826:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  80282b:	8b 43 38             	mov    0x38(%ebx),%eax
+  80282e:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  802833:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802836:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  80283b:	8b 45 18             	mov    0x18(%ebp),%eax
+  80283e:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802843:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802848:	e8 2b f6 ff ff       	call   801e78 <nsipc>
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	0f 88 ad 01 00 00    	js     802a02 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802855:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  80285b:	89 17                	mov    %edx,(%edi)
+  80285d:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  802863:	89 57 04             	mov    %edx,0x4(%edi)
+  802866:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  80286c:	89 57 08             	mov    %edx,0x8(%edi)
+  80286f:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802875:	89 57 0c             	mov    %edx,0xc(%edi)
+  802878:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  80287e:	89 57 10             	mov    %edx,0x10(%edi)
+  802881:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  802887:	89 57 14             	mov    %edx,0x14(%edi)
+  80288a:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802890:	89 57 18             	mov    %edx,0x18(%edi)
+  802893:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802899:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80289c:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  8028a2:	89 57 20             	mov    %edx,0x20(%edi)
+  8028a5:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  8028ab:	89 57 24             	mov    %edx,0x24(%edi)
+  8028ae:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  8028b4:	89 57 28             	mov    %edx,0x28(%edi)
+  8028b7:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  8028bd:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8028c0:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  8028c6:	89 57 30             	mov    %edx,0x30(%edi)
+  8028c9:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  8028cf:	89 57 34             	mov    %edx,0x34(%edi)
+  8028d2:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  8028d8:	89 57 38             	mov    %edx,0x38(%edi)
+  8028db:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  8028e1:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8028e4:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  8028ea:	89 16                	mov    %edx,(%esi)
+  8028ec:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  8028f2:	89 56 04             	mov    %edx,0x4(%esi)
+  8028f5:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  8028fb:	89 56 08             	mov    %edx,0x8(%esi)
+  8028fe:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  802904:	89 56 0c             	mov    %edx,0xc(%esi)
+  802907:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  80290d:	89 56 10             	mov    %edx,0x10(%esi)
+  802910:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  802916:	89 56 14             	mov    %edx,0x14(%esi)
+  802919:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  80291f:	89 56 18             	mov    %edx,0x18(%esi)
+  802922:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  802928:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80292b:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  802931:	89 56 20             	mov    %edx,0x20(%esi)
+  802934:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  80293a:	89 56 24             	mov    %edx,0x24(%esi)
+  80293d:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  802943:	89 56 28             	mov    %edx,0x28(%esi)
+  802946:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  80294c:	89 56 2c             	mov    %edx,0x2c(%esi)
+  80294f:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  802955:	89 56 30             	mov    %edx,0x30(%esi)
+  802958:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  80295e:	89 56 34             	mov    %edx,0x34(%esi)
+  802961:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  802967:	89 56 38             	mov    %edx,0x38(%esi)
+  80296a:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  802970:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802973:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  802979:	89 13                	mov    %edx,(%ebx)
+  80297b:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  802981:	89 53 04             	mov    %edx,0x4(%ebx)
+  802984:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  80298a:	89 53 08             	mov    %edx,0x8(%ebx)
+  80298d:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  802993:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802996:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  80299c:	89 53 10             	mov    %edx,0x10(%ebx)
+  80299f:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  8029a5:	89 53 14             	mov    %edx,0x14(%ebx)
+  8029a8:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  8029ae:	89 53 18             	mov    %edx,0x18(%ebx)
+  8029b1:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  8029b7:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8029ba:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  8029c0:	89 53 20             	mov    %edx,0x20(%ebx)
+  8029c3:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  8029c9:	89 53 24             	mov    %edx,0x24(%ebx)
+  8029cc:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  8029d2:	89 53 28             	mov    %edx,0x28(%ebx)
+  8029d5:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  8029db:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8029de:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  8029e4:	89 53 30             	mov    %edx,0x30(%ebx)
+  8029e7:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  8029ed:	89 53 34             	mov    %edx,0x34(%ebx)
+  8029f0:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  8029f6:	89 53 38             	mov    %edx,0x38(%ebx)
+  8029f9:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  8029ff:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802a02:	83 c4 0c             	add    $0xc,%esp
+  802a05:	5b                   	pop    %ebx
+  802a06:	5e                   	pop    %esi
+  802a07:	5f                   	pop    %edi
+  802a08:	5d                   	pop    %ebp
+  802a09:	c3                   	ret
+
+00802a0a <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802a0a:	55                   	push   %ebp
+  802a0b:	89 e5                	mov    %esp,%ebp
+  802a0d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a13:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  802a18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a1b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  802a20:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a23:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  802a28:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a2d:	e8 46 f4 ff ff       	call   801e78 <nsipc>
+}
+  802a32:	c9                   	leave
+  802a33:	c3                   	ret
+
+00802a34 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802a34:	55                   	push   %ebp
+  802a35:	89 e5                	mov    %esp,%ebp
+  802a37:	56                   	push   %esi
+  802a38:	53                   	push   %ebx
+  802a39:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802a3c:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802a42:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a45:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802a4a:	b8 10 00 00 00       	mov    $0x10,%eax
+  802a4f:	e8 24 f4 ff ff       	call   801e78 <nsipc>
+  802a54:	89 c3                	mov    %eax,%ebx
+  802a56:	85 c0                	test   %eax,%eax
+  802a58:	7e 1f                	jle    802a79 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802a5a:	39 c6                	cmp    %eax,%esi
+  802a5c:	7c 24                	jl     802a82 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802a5e:	83 ec 04             	sub    $0x4,%esp
+  802a61:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802a68:	50                   	push   %eax
+  802a69:	68 00 70 80 00       	push   $0x807000
+  802a6e:	ff 75 08             	push   0x8(%ebp)
+  802a71:	e8 ea df ff ff       	call   800a60 <memmove>
+  802a76:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a79:	89 d8                	mov    %ebx,%eax
+  802a7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a7e:	5b                   	pop    %ebx
+  802a7f:	5e                   	pop    %esi
+  802a80:	5d                   	pop    %ebp
+  802a81:	c3                   	ret
+		assert(r <= max);
+  802a82:	68 36 3f 80 00       	push   $0x803f36
+  802a87:	68 09 3f 80 00       	push   $0x803f09
+  802a8c:	68 6a 01 00 00       	push   $0x16a
+  802a91:	68 1e 3f 80 00       	push   $0x803f1e
+  802a96:	e8 84 0a 00 00       	call   80351f <_panic>
+
+00802a9b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802aa9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aac:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802ab1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ab4:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802ab9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802abe:	e8 b5 f3 ff ff       	call   801e78 <nsipc>
+}
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802acb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ace:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  802ad3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ad8:	e8 9b f3 ff ff       	call   801e78 <nsipc>
+}
+  802add:	c9                   	leave
+  802ade:	c3                   	ret
+
+00802adf <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802adf:	55                   	push   %ebp
+  802ae0:	89 e5                	mov    %esp,%ebp
+  802ae2:	53                   	push   %ebx
+  802ae3:	83 ec 04             	sub    $0x4,%esp
+  802ae6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802ae9:	b8 12 00 00 00       	mov    $0x12,%eax
+  802aee:	e8 85 f3 ff ff       	call   801e78 <nsipc>
+  802af3:	85 c0                	test   %eax,%eax
+  802af5:	78 50                	js     802b47 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802af7:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  802afd:	89 13                	mov    %edx,(%ebx)
+  802aff:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  802b05:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b08:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  802b0e:	89 53 08             	mov    %edx,0x8(%ebx)
+  802b11:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  802b17:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802b1a:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802b20:	89 53 10             	mov    %edx,0x10(%ebx)
+  802b23:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  802b29:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b2c:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  802b32:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b35:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802b3b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b3e:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802b44:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802b47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b4a:	c9                   	leave
+  802b4b:	c3                   	ret
+
+00802b4c <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802b4c:	55                   	push   %ebp
+  802b4d:	89 e5                	mov    %esp,%ebp
+  802b4f:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b52:	6a 03                	push   $0x3
+  802b54:	e8 05 0d 00 00       	call   80385e <ipc_find_env>
+  802b59:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b61:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802b66:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802b6b:	e8 08 f3 ff ff       	call   801e78 <nsipc>
+  802b70:	83 c4 10             	add    $0x10,%esp
+  802b73:	85 c0                	test   %eax,%eax
+  802b75:	78 0a                	js     802b81 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802b77:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+00802b83 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	57                   	push   %edi
+  802b87:	56                   	push   %esi
+  802b88:	53                   	push   %ebx
+  802b89:	83 ec 1c             	sub    $0x1c,%esp
+  802b8c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b8f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802b92:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802b97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b9c:	89 e0                	mov    %esp,%eax
+  802b9e:	89 f2                	mov    %esi,%edx
+  802ba0:	29 c2                	sub    %eax,%edx
+  802ba2:	89 d0                	mov    %edx,%eax
+  802ba4:	c1 e8 0f             	shr    $0xf,%eax
+  802ba7:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802bad:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802bb0:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802bb7:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802bba:	83 ec 0c             	sub    $0xc,%esp
+  802bbd:	ff 75 e0             	push   -0x20(%ebp)
+  802bc0:	e8 d8 0c 00 00       	call   80389d <pageref>
+  802bc5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bc8:	83 c4 04             	add    $0x4,%esp
+  802bcb:	ff 75 dc             	push   -0x24(%ebp)
+  802bce:	e8 ca 0c 00 00       	call   80389d <pageref>
+  802bd3:	89 e2                	mov    %esp,%edx
+  802bd5:	89 f1                	mov    %esi,%ecx
+  802bd7:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  802bd9:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802bdc:	89 ca                	mov    %ecx,%edx
+  802bde:	c1 ea 0f             	shr    $0xf,%edx
+  802be1:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802be7:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802bea:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  802bf1:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802bf4:	39 d7                	cmp    %edx,%edi
+  802bf6:	74 40                	je     802c38 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802bf8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bfb:	75 9f                	jne    802b9c <_pipeisclosed+0x19>
+  802bfd:	89 e2                	mov    %esp,%edx
+  802bff:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802c04:	29 d0                	sub    %edx,%eax
+  802c06:	89 c2                	mov    %eax,%edx
+  802c08:	c1 ea 0f             	shr    $0xf,%edx
+  802c0b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c15:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802c18:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802c1f:	8b 40 58             	mov    0x58(%eax),%eax
+  802c22:	6a 01                	push   $0x1
+  802c24:	50                   	push   %eax
+  802c25:	57                   	push   %edi
+  802c26:	68 3f 3f 80 00       	push   $0x803f3f
+  802c2b:	e8 89 d5 ff ff       	call   8001b9 <cprintf>
+  802c30:	83 c4 10             	add    $0x10,%esp
+  802c33:	e9 5f ff ff ff       	jmp    802b97 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802c38:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c3b:	0f 94 c0             	sete   %al
+  802c3e:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802c41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c44:	5b                   	pop    %ebx
+  802c45:	5e                   	pop    %esi
+  802c46:	5f                   	pop    %edi
+  802c47:	5d                   	pop    %ebp
+  802c48:	c3                   	ret
+
+00802c49 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	53                   	push   %ebx
+  802c4d:	83 ec 0c             	sub    $0xc,%esp
+  802c50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c53:	53                   	push   %ebx
+  802c54:	6a 00                	push   $0x0
+  802c56:	e8 0e e1 ff ff       	call   800d69 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c5b:	89 1c 24             	mov    %ebx,(%esp)
+  802c5e:	e8 f4 e4 ff ff       	call   801157 <fd2data>
+  802c63:	83 c4 08             	add    $0x8,%esp
+  802c66:	50                   	push   %eax
+  802c67:	6a 00                	push   $0x0
+  802c69:	e8 fb e0 ff ff       	call   800d69 <sys_page_unmap>
+}
+  802c6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c71:	c9                   	leave
+  802c72:	c3                   	ret
+
+00802c73 <devpipe_read>:
+{
+  802c73:	55                   	push   %ebp
+  802c74:	89 e5                	mov    %esp,%ebp
+  802c76:	57                   	push   %edi
+  802c77:	56                   	push   %esi
+  802c78:	53                   	push   %ebx
+  802c79:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802c7c:	ff 75 08             	push   0x8(%ebp)
+  802c7f:	e8 d3 e4 ff ff       	call   801157 <fd2data>
+  802c84:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802c86:	8b 70 04             	mov    0x4(%eax),%esi
+  802c89:	8b 00                	mov    (%eax),%eax
+  802c8b:	83 c4 10             	add    $0x10,%esp
+  802c8e:	39 f0                	cmp    %esi,%eax
+  802c90:	75 36                	jne    802cc8 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802c92:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802c95:	89 da                	mov    %ebx,%edx
+  802c97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9a:	e8 e4 fe ff ff       	call   802b83 <_pipeisclosed>
+  802c9f:	85 c0                	test   %eax,%eax
+  802ca1:	0f 85 d4 00 00 00    	jne    802d7b <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802ca7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cac:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802cb0:	83 ec 04             	sub    $0x4,%esp
+  802cb3:	6a ff                	push   $0xffffffff
+  802cb5:	56                   	push   %esi
+  802cb6:	57                   	push   %edi
+  802cb7:	e8 26 e4 ff ff       	call   8010e2 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802cbc:	8b 73 04             	mov    0x4(%ebx),%esi
+  802cbf:	8b 03                	mov    (%ebx),%eax
+  802cc1:	83 c4 10             	add    $0x10,%esp
+  802cc4:	39 c6                	cmp    %eax,%esi
+  802cc6:	74 cd                	je     802c95 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802cc8:	8b 73 04             	mov    0x4(%ebx),%esi
+  802ccb:	8b 03                	mov    (%ebx),%eax
+  802ccd:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802cd3:	29 c6                	sub    %eax,%esi
+  802cd5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802cda:	f7 e6                	mul    %esi
+  802cdc:	c1 ea 0c             	shr    $0xc,%edx
+  802cdf:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ce5:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802ce7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802cea:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802cee:	8b 0b                	mov    (%ebx),%ecx
+  802cf0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802cf5:	f7 e1                	mul    %ecx
+  802cf7:	c1 ea 0b             	shr    $0xb,%edx
+  802cfa:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802d00:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802d02:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802d07:	29 cf                	sub    %ecx,%edi
+  802d09:	39 f7                	cmp    %esi,%edi
+  802d0b:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802d0e:	83 ec 04             	sub    $0x4,%esp
+  802d11:	57                   	push   %edi
+  802d12:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802d16:	50                   	push   %eax
+  802d17:	ff 75 0c             	push   0xc(%ebp)
+  802d1a:	e8 41 dd ff ff       	call   800a60 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802d1f:	83 c4 0c             	add    $0xc,%esp
+  802d22:	89 f0                	mov    %esi,%eax
+  802d24:	29 f8                	sub    %edi,%eax
+  802d26:	50                   	push   %eax
+  802d27:	8d 43 10             	lea    0x10(%ebx),%eax
+  802d2a:	50                   	push   %eax
+  802d2b:	89 f8                	mov    %edi,%eax
+  802d2d:	03 45 0c             	add    0xc(%ebp),%eax
+  802d30:	50                   	push   %eax
+  802d31:	e8 2a dd ff ff       	call   800a60 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802d36:	8b 0b                	mov    (%ebx),%ecx
+  802d38:	01 f1                	add    %esi,%ecx
+  802d3a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d3f:	f7 e1                	mul    %ecx
+  802d41:	c1 ea 0c             	shr    $0xc,%edx
+  802d44:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802d4a:	29 c1                	sub    %eax,%ecx
+  802d4c:	89 0b                	mov    %ecx,(%ebx)
+  802d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d53:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802d57:	83 c4 10             	add    $0x10,%esp
+  802d5a:	85 c0                	test   %eax,%eax
+  802d5c:	75 0a                	jne    802d68 <devpipe_read+0xf5>
+	return n;
+  802d5e:	89 f0                	mov    %esi,%eax
+}
+  802d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d63:	5b                   	pop    %ebx
+  802d64:	5e                   	pop    %esi
+  802d65:	5f                   	pop    %edi
+  802d66:	5d                   	pop    %ebp
+  802d67:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802d68:	83 ec 08             	sub    $0x8,%esp
+  802d6b:	68 00 04 00 00       	push   $0x400
+  802d70:	53                   	push   %ebx
+  802d71:	e8 8e e3 ff ff       	call   801104 <sys_futex_wake>
+  802d76:	83 c4 10             	add    $0x10,%esp
+  802d79:	eb e3                	jmp    802d5e <devpipe_read+0xeb>
+			return 0;
+  802d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d80:	eb de                	jmp    802d60 <devpipe_read+0xed>
+
+00802d82 <devpipe_write>:
+{
+  802d82:	55                   	push   %ebp
+  802d83:	89 e5                	mov    %esp,%ebp
+  802d85:	57                   	push   %edi
+  802d86:	56                   	push   %esi
+  802d87:	53                   	push   %ebx
+  802d88:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802d8b:	ff 75 08             	push   0x8(%ebp)
+  802d8e:	e8 c4 e3 ff ff       	call   801157 <fd2data>
+  802d93:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802d95:	83 c4 10             	add    $0x10,%esp
+  802d98:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d9f:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802da4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802da8:	0f 84 43 01 00 00    	je     802ef1 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802dae:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802db1:	8b 06                	mov    (%esi),%eax
+  802db3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802db9:	29 c1                	sub    %eax,%ecx
+  802dbb:	89 c8                	mov    %ecx,%eax
+  802dbd:	f7 e7                	mul    %edi
+  802dbf:	c1 ea 0c             	shr    $0xc,%edx
+  802dc2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802dc8:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802dca:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802dd0:	75 52                	jne    802e24 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802dd2:	89 f2                	mov    %esi,%edx
+  802dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd7:	e8 a7 fd ff ff       	call   802b83 <_pipeisclosed>
+  802ddc:	85 c0                	test   %eax,%eax
+  802dde:	0f 85 28 01 00 00    	jne    802f0c <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802de4:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802de6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802de9:	8b 06                	mov    (%esi),%eax
+  802deb:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802df1:	29 c1                	sub    %eax,%ecx
+  802df3:	89 c8                	mov    %ecx,%eax
+  802df5:	f7 e7                	mul    %edi
+  802df7:	c1 ea 0c             	shr    $0xc,%edx
+  802dfa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e00:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802e02:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802e08:	75 a4                	jne    802dae <devpipe_write+0x2c>
+  802e0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e0f:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802e13:	83 ec 04             	sub    $0x4,%esp
+  802e16:	6a ff                	push   $0xffffffff
+  802e18:	53                   	push   %ebx
+  802e19:	56                   	push   %esi
+  802e1a:	e8 c3 e2 ff ff       	call   8010e2 <sys_futex_wait>
+}
+  802e1f:	83 c4 10             	add    $0x10,%esp
+  802e22:	eb 8a                	jmp    802dae <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e24:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e27:	8b 06                	mov    (%esi),%eax
+  802e29:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e2f:	29 c1                	sub    %eax,%ecx
+  802e31:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e36:	f7 e1                	mul    %ecx
+  802e38:	c1 ea 0c             	shr    $0xc,%edx
+  802e3b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e41:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802e43:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802e48:	89 d8                	mov    %ebx,%eax
+  802e4a:	29 c8                	sub    %ecx,%eax
+  802e4c:	8b 55 10             	mov    0x10(%ebp),%edx
+  802e4f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e52:	29 ca                	sub    %ecx,%edx
+  802e54:	39 d0                	cmp    %edx,%eax
+  802e56:	0f 46 d0             	cmovbe %eax,%edx
+  802e59:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802e5c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e5f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e64:	f7 e1                	mul    %ecx
+  802e66:	c1 ea 0b             	shr    $0xb,%edx
+  802e69:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802e6f:	89 ca                	mov    %ecx,%edx
+  802e71:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802e73:	29 d3                	sub    %edx,%ebx
+  802e75:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e78:	39 c3                	cmp    %eax,%ebx
+  802e7a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802e7d:	83 ec 04             	sub    $0x4,%esp
+  802e80:	53                   	push   %ebx
+  802e81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e84:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802e87:	51                   	push   %ecx
+  802e88:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802e8c:	50                   	push   %eax
+  802e8d:	e8 ce db ff ff       	call   800a60 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802e92:	83 c4 0c             	add    $0xc,%esp
+  802e95:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e98:	29 d8                	sub    %ebx,%eax
+  802e9a:	50                   	push   %eax
+  802e9b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802e9e:	01 cb                	add    %ecx,%ebx
+  802ea0:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802ea3:	53                   	push   %ebx
+  802ea4:	8d 46 10             	lea    0x10(%esi),%eax
+  802ea7:	50                   	push   %eax
+  802ea8:	e8 b3 db ff ff       	call   800a60 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802ead:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802eb0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802eb3:	01 c1                	add    %eax,%ecx
+  802eb5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802eba:	f7 e1                	mul    %ecx
+  802ebc:	c1 ea 0c             	shr    $0xc,%edx
+  802ebf:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802ec5:	89 ca                	mov    %ecx,%edx
+  802ec7:	29 c2                	sub    %eax,%edx
+  802ec9:	89 56 04             	mov    %edx,0x4(%esi)
+  802ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed1:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802ed5:	83 c4 10             	add    $0x10,%esp
+  802ed8:	85 c0                	test   %eax,%eax
+  802eda:	75 1a                	jne    802ef6 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802edc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802edf:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802ee2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ee5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ee8:	0f 82 c0 fe ff ff    	jb     802dae <devpipe_write+0x2c>
+  802eee:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802ef1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ef4:	eb 1b                	jmp    802f11 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802ef6:	83 ec 08             	sub    $0x8,%esp
+  802ef9:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802efe:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802f01:	50                   	push   %eax
+  802f02:	e8 fd e1 ff ff       	call   801104 <sys_futex_wake>
+  802f07:	83 c4 10             	add    $0x10,%esp
+  802f0a:	eb d0                	jmp    802edc <devpipe_write+0x15a>
+				return 0;
+  802f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f14:	5b                   	pop    %ebx
+  802f15:	5e                   	pop    %esi
+  802f16:	5f                   	pop    %edi
+  802f17:	5d                   	pop    %ebp
+  802f18:	c3                   	ret
+
+00802f19 <devpipe_stat>:
+{
+  802f19:	55                   	push   %ebp
+  802f1a:	89 e5                	mov    %esp,%ebp
+  802f1c:	56                   	push   %esi
+  802f1d:	53                   	push   %ebx
+  802f1e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f21:	83 ec 0c             	sub    $0xc,%esp
+  802f24:	ff 75 08             	push   0x8(%ebp)
+  802f27:	e8 2b e2 ff ff       	call   801157 <fd2data>
+  802f2c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f2e:	83 c4 08             	add    $0x8,%esp
+  802f31:	68 52 3f 80 00       	push   $0x803f52
+  802f36:	53                   	push   %ebx
+  802f37:	e8 74 d9 ff ff       	call   8008b0 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f3c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f3f:	8b 06                	mov    (%esi),%eax
+  802f41:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f47:	29 c1                	sub    %eax,%ecx
+  802f49:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802f4e:	89 c8                	mov    %ecx,%eax
+  802f50:	f7 e2                	mul    %edx
+  802f52:	c1 ea 0c             	shr    $0xc,%edx
+  802f55:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f5b:	29 d1                	sub    %edx,%ecx
+  802f5d:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f6a:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f6d:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  802f74:	40 80 00 
+}
+  802f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f7f:	5b                   	pop    %ebx
+  802f80:	5e                   	pop    %esi
+  802f81:	5d                   	pop    %ebp
+  802f82:	c3                   	ret
+
+00802f83 <devpipe_poll>:
+{
+  802f83:	55                   	push   %ebp
+  802f84:	89 e5                	mov    %esp,%ebp
+  802f86:	57                   	push   %edi
+  802f87:	56                   	push   %esi
+  802f88:	53                   	push   %ebx
+  802f89:	83 ec 18             	sub    $0x18,%esp
+  802f8c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f8f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f92:	57                   	push   %edi
+  802f93:	e8 bf e1 ff ff       	call   801157 <fd2data>
+  802f98:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802f9a:	83 c4 10             	add    $0x10,%esp
+  802f9d:	89 f3                	mov    %esi,%ebx
+  802f9f:	83 e3 01             	and    $0x1,%ebx
+  802fa2:	75 27                	jne    802fcb <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  802fa4:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802faa:	75 48                	jne    802ff4 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802fac:	89 ca                	mov    %ecx,%edx
+  802fae:	89 f8                	mov    %edi,%eax
+  802fb0:	e8 ce fb ff ff       	call   802b83 <_pipeisclosed>
+  802fb5:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  802fb7:	89 d8                	mov    %ebx,%eax
+  802fb9:	83 c8 10             	or     $0x10,%eax
+  802fbc:	85 d2                	test   %edx,%edx
+  802fbe:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802fc1:	89 d8                	mov    %ebx,%eax
+  802fc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fc6:	5b                   	pop    %ebx
+  802fc7:	5e                   	pop    %esi
+  802fc8:	5f                   	pop    %edi
+  802fc9:	5d                   	pop    %ebp
+  802fca:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fcb:	8b 58 04             	mov    0x4(%eax),%ebx
+  802fce:	8b 00                	mov    (%eax),%eax
+  802fd0:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  802fd6:	29 c3                	sub    %eax,%ebx
+  802fd8:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802fdd:	89 d8                	mov    %ebx,%eax
+  802fdf:	f7 e2                	mul    %edx
+  802fe1:	c1 ea 0c             	shr    $0xc,%edx
+  802fe4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802fea:	39 d3                	cmp    %edx,%ebx
+  802fec:	0f 95 c3             	setne  %bl
+  802fef:	0f b6 db             	movzbl %bl,%ebx
+  802ff2:	eb b0                	jmp    802fa4 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ff4:	8b 71 04             	mov    0x4(%ecx),%esi
+  802ff7:	8b 01                	mov    (%ecx),%eax
+  802ff9:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802fff:	29 c6                	sub    %eax,%esi
+  803001:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803006:	89 f0                	mov    %esi,%eax
+  803008:	f7 e2                	mul    %edx
+  80300a:	c1 ea 0c             	shr    $0xc,%edx
+  80300d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803013:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803015:	89 d8                	mov    %ebx,%eax
+  803017:	83 c8 04             	or     $0x4,%eax
+  80301a:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803020:	0f 42 d8             	cmovb  %eax,%ebx
+  803023:	eb 87                	jmp    802fac <devpipe_poll+0x29>
+
+00803025 <pipe>:
+{
+  803025:	55                   	push   %ebp
+  803026:	89 e5                	mov    %esp,%ebp
+  803028:	56                   	push   %esi
+  803029:	53                   	push   %ebx
+  80302a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80302d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803030:	50                   	push   %eax
+  803031:	e8 38 e1 ff ff       	call   80116e <fd_alloc>
+  803036:	89 c3                	mov    %eax,%ebx
+  803038:	83 c4 10             	add    $0x10,%esp
+  80303b:	85 c0                	test   %eax,%eax
+  80303d:	0f 88 23 01 00 00    	js     803166 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803043:	83 ec 04             	sub    $0x4,%esp
+  803046:	68 07 04 00 00       	push   $0x407
+  80304b:	ff 75 f4             	push   -0xc(%ebp)
+  80304e:	6a 00                	push   $0x0
+  803050:	e8 8f dc ff ff       	call   800ce4 <sys_page_alloc>
+  803055:	89 c3                	mov    %eax,%ebx
+  803057:	83 c4 10             	add    $0x10,%esp
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	0f 88 04 01 00 00    	js     803166 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803062:	83 ec 0c             	sub    $0xc,%esp
+  803065:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803068:	50                   	push   %eax
+  803069:	e8 00 e1 ff ff       	call   80116e <fd_alloc>
+  80306e:	89 c3                	mov    %eax,%ebx
+  803070:	83 c4 10             	add    $0x10,%esp
+  803073:	85 c0                	test   %eax,%eax
+  803075:	0f 88 db 00 00 00    	js     803156 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80307b:	83 ec 04             	sub    $0x4,%esp
+  80307e:	68 07 04 00 00       	push   $0x407
+  803083:	ff 75 f0             	push   -0x10(%ebp)
+  803086:	6a 00                	push   $0x0
+  803088:	e8 57 dc ff ff       	call   800ce4 <sys_page_alloc>
+  80308d:	89 c3                	mov    %eax,%ebx
+  80308f:	83 c4 10             	add    $0x10,%esp
+  803092:	85 c0                	test   %eax,%eax
+  803094:	0f 88 bc 00 00 00    	js     803156 <pipe+0x131>
+	va = fd2data(fd0);
+  80309a:	83 ec 0c             	sub    $0xc,%esp
+  80309d:	ff 75 f4             	push   -0xc(%ebp)
+  8030a0:	e8 b2 e0 ff ff       	call   801157 <fd2data>
+  8030a5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030a7:	83 c4 0c             	add    $0xc,%esp
+  8030aa:	68 07 04 00 00       	push   $0x407
+  8030af:	50                   	push   %eax
+  8030b0:	6a 00                	push   $0x0
+  8030b2:	e8 2d dc ff ff       	call   800ce4 <sys_page_alloc>
+  8030b7:	89 c3                	mov    %eax,%ebx
+  8030b9:	83 c4 10             	add    $0x10,%esp
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	0f 88 82 00 00 00    	js     803146 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030c4:	83 ec 0c             	sub    $0xc,%esp
+  8030c7:	ff 75 f0             	push   -0x10(%ebp)
+  8030ca:	e8 88 e0 ff ff       	call   801157 <fd2data>
+  8030cf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030d6:	50                   	push   %eax
+  8030d7:	6a 00                	push   $0x0
+  8030d9:	56                   	push   %esi
+  8030da:	6a 00                	push   $0x0
+  8030dc:	e8 46 dc ff ff       	call   800d27 <sys_page_map>
+  8030e1:	89 c3                	mov    %eax,%ebx
+  8030e3:	83 c4 20             	add    $0x20,%esp
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	78 4e                	js     803138 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030ea:	a1 60 40 80 00       	mov    0x804060,%eax
+  8030ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030f2:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8030f4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030f7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8030fe:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803101:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803103:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803106:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80310d:	83 ec 0c             	sub    $0xc,%esp
+  803110:	ff 75 f4             	push   -0xc(%ebp)
+  803113:	e8 2f e0 ff ff       	call   801147 <fd2num>
+  803118:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80311b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80311d:	83 c4 04             	add    $0x4,%esp
+  803120:	ff 75 f0             	push   -0x10(%ebp)
+  803123:	e8 1f e0 ff ff       	call   801147 <fd2num>
+  803128:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80312b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80312e:	83 c4 10             	add    $0x10,%esp
+  803131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803136:	eb 2e                	jmp    803166 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803138:	83 ec 08             	sub    $0x8,%esp
+  80313b:	56                   	push   %esi
+  80313c:	6a 00                	push   $0x0
+  80313e:	e8 26 dc ff ff       	call   800d69 <sys_page_unmap>
+  803143:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803146:	83 ec 08             	sub    $0x8,%esp
+  803149:	ff 75 f0             	push   -0x10(%ebp)
+  80314c:	6a 00                	push   $0x0
+  80314e:	e8 16 dc ff ff       	call   800d69 <sys_page_unmap>
+  803153:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803156:	83 ec 08             	sub    $0x8,%esp
+  803159:	ff 75 f4             	push   -0xc(%ebp)
+  80315c:	6a 00                	push   $0x0
+  80315e:	e8 06 dc ff ff       	call   800d69 <sys_page_unmap>
+  803163:	83 c4 10             	add    $0x10,%esp
+}
+  803166:	89 d8                	mov    %ebx,%eax
+  803168:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80316b:	5b                   	pop    %ebx
+  80316c:	5e                   	pop    %esi
+  80316d:	5d                   	pop    %ebp
+  80316e:	c3                   	ret
+
+0080316f <pipeisclosed>:
+{
+  80316f:	55                   	push   %ebp
+  803170:	89 e5                	mov    %esp,%ebp
+  803172:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803175:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803178:	50                   	push   %eax
+  803179:	ff 75 08             	push   0x8(%ebp)
+  80317c:	e8 3d e0 ff ff       	call   8011be <fd_lookup>
+  803181:	83 c4 10             	add    $0x10,%esp
+  803184:	85 c0                	test   %eax,%eax
+  803186:	78 18                	js     8031a0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803188:	83 ec 0c             	sub    $0xc,%esp
+  80318b:	ff 75 f4             	push   -0xc(%ebp)
+  80318e:	e8 c4 df ff ff       	call   801157 <fd2data>
+  803193:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803195:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803198:	e8 e6 f9 ff ff       	call   802b83 <_pipeisclosed>
+  80319d:	83 c4 10             	add    $0x10,%esp
+}
+  8031a0:	c9                   	leave
+  8031a1:	c3                   	ret
+
+008031a2 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8031a2:	55                   	push   %ebp
+  8031a3:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8031a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8031ae:	5d                   	pop    %ebp
+  8031af:	c3                   	ret
+
+008031b0 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8031b0:	55                   	push   %ebp
+  8031b1:	89 e5                	mov    %esp,%ebp
+  8031b3:	53                   	push   %ebx
+  8031b4:	83 ec 04             	sub    $0x4,%esp
+  8031b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8031ba:	8b 03                	mov    (%ebx),%eax
+  8031bc:	85 c0                	test   %eax,%eax
+  8031be:	75 05                	jne    8031c5 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8031c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031c3:	c9                   	leave
+  8031c4:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8031c5:	83 ec 08             	sub    $0x8,%esp
+  8031c8:	50                   	push   %eax
+  8031c9:	8d 43 04             	lea    0x4(%ebx),%eax
+  8031cc:	50                   	push   %eax
+  8031cd:	e8 e7 dd ff ff       	call   800fb9 <sys_page_batch>
+	pb->pb_n = 0;
+  8031d2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8031d8:	83 c4 10             	add    $0x10,%esp
+  8031db:	eb e3                	jmp    8031c0 <pgbatch_flush+0x10>
+
+008031dd <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8031dd:	55                   	push   %ebp
+  8031de:	89 e5                	mov    %esp,%ebp
+  8031e0:	56                   	push   %esi
+  8031e1:	53                   	push   %ebx
+  8031e2:	89 c3                	mov    %eax,%ebx
+  8031e4:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8031e6:	83 38 20             	cmpl   $0x20,(%eax)
+  8031e9:	74 2c                	je     803217 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8031eb:	8b 03                	mov    (%ebx),%eax
+  8031ed:	8d 50 01             	lea    0x1(%eax),%edx
+  8031f0:	89 13                	mov    %edx,(%ebx)
+  8031f2:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8031f5:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8031f9:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8031fb:	83 ec 04             	sub    $0x4,%esp
+  8031fe:	6a 18                	push   $0x18
+  803200:	6a 00                	push   $0x0
+  803202:	50                   	push   %eax
+  803203:	e8 23 d8 ff ff       	call   800a2b <memset>
+	return 0;
+  803208:	83 c4 10             	add    $0x10,%esp
+  80320b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803210:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803213:	5b                   	pop    %ebx
+  803214:	5e                   	pop    %esi
+  803215:	5d                   	pop    %ebp
+  803216:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803217:	83 ec 0c             	sub    $0xc,%esp
+  80321a:	50                   	push   %eax
+  80321b:	e8 90 ff ff ff       	call   8031b0 <pgbatch_flush>
+  803220:	83 c4 10             	add    $0x10,%esp
+  803223:	85 c0                	test   %eax,%eax
+  803225:	79 c4                	jns    8031eb <pgbatch_slot+0xe>
+  803227:	eb e7                	jmp    803210 <pgbatch_slot+0x33>
+
+00803229 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803229:	55                   	push   %ebp
+  80322a:	89 e5                	mov    %esp,%ebp
+  80322c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80322f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803232:	8b 45 08             	mov    0x8(%ebp),%eax
+  803235:	e8 a3 ff ff ff       	call   8031dd <pgbatch_slot>
+  80323a:	85 c0                	test   %eax,%eax
+  80323c:	78 20                	js     80325e <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  80323e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803241:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803247:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80324a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80324d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803250:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803253:	8b 55 14             	mov    0x14(%ebp),%edx
+  803256:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803259:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80325e:	c9                   	leave
+  80325f:	c3                   	ret
+
+00803260 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803260:	55                   	push   %ebp
+  803261:	89 e5                	mov    %esp,%ebp
+  803263:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803266:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80326c:	e8 6c ff ff ff       	call   8031dd <pgbatch_slot>
+  803271:	85 c0                	test   %eax,%eax
+  803273:	78 2c                	js     8032a1 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803275:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803278:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80327e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803281:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803284:	8b 55 10             	mov    0x10(%ebp),%edx
+  803287:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80328a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80328d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803290:	8b 55 18             	mov    0x18(%ebp),%edx
+  803293:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803296:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803299:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80329c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a1:	c9                   	leave
+  8032a2:	c3                   	ret
+
+008032a3 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  8032a3:	55                   	push   %ebp
+  8032a4:	89 e5                	mov    %esp,%ebp
+  8032a6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032a9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032af:	e8 29 ff ff ff       	call   8031dd <pgbatch_slot>
+  8032b4:	85 c0                	test   %eax,%eax
+  8032b6:	78 1a                	js     8032d2 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8032b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032bb:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8032c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032c4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032c7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032ca:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8032cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032d2:	c9                   	leave
+  8032d3:	c3                   	ret
+
+008032d4 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8032d4:	55                   	push   %ebp
+  8032d5:	89 e5                	mov    %esp,%ebp
+  8032d7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032da:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e0:	e8 f8 fe ff ff       	call   8031dd <pgbatch_slot>
+  8032e5:	85 c0                	test   %eax,%eax
+  8032e7:	78 20                	js     803309 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8032e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032ec:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8032f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032f5:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032f8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032fb:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8032fe:	8b 55 14             	mov    0x14(%ebp),%edx
+  803301:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803304:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803309:	c9                   	leave
+  80330a:	c3                   	ret
+
+0080330b <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  80330b:	55                   	push   %ebp
+  80330c:	89 e5                	mov    %esp,%ebp
+  80330e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803311:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803314:	8b 45 08             	mov    0x8(%ebp),%eax
+  803317:	e8 c1 fe ff ff       	call   8031dd <pgbatch_slot>
+  80331c:	85 c0                	test   %eax,%eax
+  80331e:	78 26                	js     803346 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803320:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803323:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803329:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80332c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  80332f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803332:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803335:	8b 55 14             	mov    0x14(%ebp),%edx
+  803338:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80333b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80333e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803341:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803346:	c9                   	leave
+  803347:	c3                   	ret
+
+00803348 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334d:	c3                   	ret
+
+0080334e <devcons_poll>:
+{
+  80334e:	55                   	push   %ebp
+  80334f:	89 e5                	mov    %esp,%ebp
+  803351:	53                   	push   %ebx
+  803352:	83 ec 04             	sub    $0x4,%esp
+  803355:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803358:	89 da                	mov    %ebx,%edx
+  80335a:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80335d:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  803364:	74 0c                	je     803372 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803366:	89 d8                	mov    %ebx,%eax
+  803368:	83 e0 01             	and    $0x1,%eax
+  80336b:	09 d0                	or     %edx,%eax
+}
+  80336d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803370:	c9                   	leave
+  803371:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803372:	e8 cf d8 ff ff       	call   800c46 <sys_cgetc>
+  803377:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80337c:	89 da                	mov    %ebx,%edx
+  80337e:	83 e2 04             	and    $0x4,%edx
+  803381:	85 c0                	test   %eax,%eax
+  803383:	74 e6                	je     80336b <devcons_poll+0x1d>
+  803385:	eb df                	jmp    803366 <devcons_poll+0x18>
+
+00803387 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803387:	55                   	push   %ebp
+  803388:	89 e5                	mov    %esp,%ebp
+  80338a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80338d:	68 5e 3f 80 00       	push   $0x803f5e
+  803392:	ff 75 0c             	push   0xc(%ebp)
+  803395:	e8 16 d5 ff ff       	call   8008b0 <strcpy>
+	return 0;
+}
+  80339a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339f:	c9                   	leave
+  8033a0:	c3                   	ret
+
+008033a1 <devcons_write>:
+{
+  8033a1:	55                   	push   %ebp
+  8033a2:	89 e5                	mov    %esp,%ebp
+  8033a4:	57                   	push   %edi
+  8033a5:	56                   	push   %esi
+  8033a6:	53                   	push   %ebx
+  8033a7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8033ad:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8033b0:	85 ff                	test   %edi,%edi
+  8033b2:	74 51                	je     803405 <devcons_write+0x64>
+  8033b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b9:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8033be:	89 fb                	mov    %edi,%ebx
+  8033c0:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8033c2:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8033c7:	39 d3                	cmp    %edx,%ebx
+  8033c9:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8033cc:	83 ec 04             	sub    $0x4,%esp
+  8033cf:	53                   	push   %ebx
+  8033d0:	03 45 0c             	add    0xc(%ebp),%eax
+  8033d3:	50                   	push   %eax
+  8033d4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033da:	50                   	push   %eax
+  8033db:	e8 80 d6 ff ff       	call   800a60 <memmove>
+		sys_cputs(buf, m);
+  8033e0:	83 c4 08             	add    $0x8,%esp
+  8033e3:	53                   	push   %ebx
+  8033e4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033ea:	50                   	push   %eax
+  8033eb:	e8 38 d8 ff ff       	call   800c28 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8033f0:	01 de                	add    %ebx,%esi
+  8033f2:	89 f0                	mov    %esi,%eax
+  8033f4:	83 c4 10             	add    $0x10,%esp
+  8033f7:	39 fe                	cmp    %edi,%esi
+  8033f9:	72 c3                	jb     8033be <devcons_write+0x1d>
+}
+  8033fb:	89 f0                	mov    %esi,%eax
+  8033fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803400:	5b                   	pop    %ebx
+  803401:	5e                   	pop    %esi
+  803402:	5f                   	pop    %edi
+  803403:	5d                   	pop    %ebp
+  803404:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803405:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80340a:	eb ef                	jmp    8033fb <devcons_write+0x5a>
+
+0080340c <devcons_read>:
+{
+  80340c:	55                   	push   %ebp
+  80340d:	89 e5                	mov    %esp,%ebp
+  80340f:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803412:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803417:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80341b:	74 36                	je     803453 <devcons_read+0x47>
+	c = cons_peek;
+  80341d:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  803422:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  803429:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	75 10                	jne    803440 <devcons_read+0x34>
+  803430:	e8 11 d8 ff ff       	call   800c46 <sys_cgetc>
+  803435:	85 c0                	test   %eax,%eax
+  803437:	75 07                	jne    803440 <devcons_read+0x34>
+		sys_yield();
+  803439:	e8 87 d8 ff ff       	call   800cc5 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80343e:	eb f0                	jmp    803430 <devcons_read+0x24>
+	if (c < 0)
+  803440:	85 c0                	test   %eax,%eax
+  803442:	78 0f                	js     803453 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803444:	83 f8 04             	cmp    $0x4,%eax
+  803447:	74 0c                	je     803455 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803449:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80344c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80344e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803453:	c9                   	leave
+  803454:	c3                   	ret
+		return 0;
+  803455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345a:	eb f7                	jmp    803453 <devcons_read+0x47>
+
+0080345c <cputchar>:
+{
+  80345c:	55                   	push   %ebp
+  80345d:	89 e5                	mov    %esp,%ebp
+  80345f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803462:	8b 45 08             	mov    0x8(%ebp),%eax
+  803465:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803468:	6a 01                	push   $0x1
+  80346a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80346d:	50                   	push   %eax
+  80346e:	e8 b5 d7 ff ff       	call   800c28 <sys_cputs>
+}
+  803473:	83 c4 10             	add    $0x10,%esp
+  803476:	c9                   	leave
+  803477:	c3                   	ret
+
+00803478 <getchar>:
+{
+  803478:	55                   	push   %ebp
+  803479:	89 e5                	mov    %esp,%ebp
+  80347b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80347e:	6a 01                	push   $0x1
+  803480:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803483:	50                   	push   %eax
+  803484:	6a 00                	push   $0x0
+  803486:	e8 b7 df ff ff       	call   801442 <read>
+	if (r < 0)
+  80348b:	83 c4 10             	add    $0x10,%esp
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	78 06                	js     803498 <getchar+0x20>
+	if (r < 1)
+  803492:	74 06                	je     80349a <getchar+0x22>
+	return c;
+  803494:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803498:	c9                   	leave
+  803499:	c3                   	ret
+		return -E_EOF;
+  80349a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80349f:	eb f7                	jmp    803498 <getchar+0x20>
+
+008034a1 <iscons>:
+{
+  8034a1:	55                   	push   %ebp
+  8034a2:	89 e5                	mov    %esp,%ebp
+  8034a4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034aa:	50                   	push   %eax
+  8034ab:	ff 75 08             	push   0x8(%ebp)
+  8034ae:	e8 0b dd ff ff       	call   8011be <fd_lookup>
+  8034b3:	83 c4 10             	add    $0x10,%esp
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	78 11                	js     8034cb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8034ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034bd:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8034c3:	39 10                	cmp    %edx,(%eax)
+  8034c5:	0f 94 c0             	sete   %al
+  8034c8:	0f b6 c0             	movzbl %al,%eax
+}
+  8034cb:	c9                   	leave
+  8034cc:	c3                   	ret
+
+008034cd <opencons>:
+{
+  8034cd:	55                   	push   %ebp
+  8034ce:	89 e5                	mov    %esp,%ebp
+  8034d0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8034d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034d6:	50                   	push   %eax
+  8034d7:	e8 92 dc ff ff       	call   80116e <fd_alloc>
+  8034dc:	83 c4 10             	add    $0x10,%esp
+  8034df:	85 c0                	test   %eax,%eax
+  8034e1:	78 3a                	js     80351d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034e3:	83 ec 04             	sub    $0x4,%esp
+  8034e6:	68 07 04 00 00       	push   $0x407
+  8034eb:	ff 75 f4             	push   -0xc(%ebp)
+  8034ee:	6a 00                	push   $0x0
+  8034f0:	e8 ef d7 ff ff       	call   800ce4 <sys_page_alloc>
+  8034f5:	83 c4 10             	add    $0x10,%esp
+  8034f8:	85 c0                	test   %eax,%eax
+  8034fa:	78 21                	js     80351d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8034fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034ff:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803505:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803507:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80350a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803511:	83 ec 0c             	sub    $0xc,%esp
+  803514:	50                   	push   %eax
+  803515:	e8 2d dc ff ff       	call   801147 <fd2num>
+  80351a:	83 c4 10             	add    $0x10,%esp
+}
+  80351d:	c9                   	leave
+  80351e:	c3                   	ret
+
+0080351f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	56                   	push   %esi
+  803523:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803524:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803527:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80352d:	e8 74 d7 ff ff       	call   800ca6 <sys_getenvid>
+  803532:	83 ec 0c             	sub    $0xc,%esp
+  803535:	ff 75 0c             	push   0xc(%ebp)
+  803538:	ff 75 08             	push   0x8(%ebp)
+  80353b:	56                   	push   %esi
+  80353c:	50                   	push   %eax
+  80353d:	68 6c 3f 80 00       	push   $0x803f6c
+  803542:	e8 72 cc ff ff       	call   8001b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803547:	83 c4 18             	add    $0x18,%esp
+  80354a:	53                   	push   %ebx
+  80354b:	ff 75 10             	push   0x10(%ebp)
+  80354e:	e8 15 cc ff ff       	call   800168 <vcprintf>
+	cprintf("\n");
+  803553:	c7 04 24 50 3f 80 00 	movl   $0x803f50,(%esp)
+  80355a:	e8 5a cc ff ff       	call   8001b9 <cprintf>
+  80355f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803562:	cc                   	int3
+	while (1)
+  803563:	eb fd                	jmp    803562 <_panic+0x43>
+
+00803565 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803565:	55                   	push   %ebp
+  803566:	89 e5                	mov    %esp,%ebp
+  803568:	56                   	push   %esi
+  803569:	53                   	push   %ebx
+  80356a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80356d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803570:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803573:	85 c0                	test   %eax,%eax
+  803575:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80357a:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80357d:	83 ec 0c             	sub    $0xc,%esp
+  803580:	50                   	push   %eax
+  803581:	e8 0e d9 ff ff       	call   800e94 <sys_ipc_recv>
+  803586:	83 c4 10             	add    $0x10,%esp
+  803589:	85 c0                	test   %eax,%eax
+  80358b:	0f 88 8b 00 00 00    	js     80361c <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803591:	85 f6                	test   %esi,%esi
+  803593:	74 2a                	je     8035bf <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803595:	89 e2                	mov    %esp,%edx
+  803597:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80359c:	29 d0                	sub    %edx,%eax
+  80359e:	89 c2                	mov    %eax,%edx
+  8035a0:	c1 ea 0f             	shr    $0xf,%edx
+  8035a3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ad:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8035b0:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035b7:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8035bd:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8035bf:	85 db                	test   %ebx,%ebx
+  8035c1:	74 2a                	je     8035ed <ipc_recv+0x88>
+  8035c3:	89 e2                	mov    %esp,%edx
+  8035c5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035ca:	29 d0                	sub    %edx,%eax
+  8035cc:	89 c2                	mov    %eax,%edx
+  8035ce:	c1 ea 0f             	shr    $0xf,%edx
+  8035d1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035db:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035de:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035e5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035eb:	89 03                	mov    %eax,(%ebx)
+  8035ed:	89 e2                	mov    %esp,%edx
+  8035ef:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035f4:	29 d0                	sub    %edx,%eax
+  8035f6:	89 c2                	mov    %eax,%edx
+  8035f8:	c1 ea 0f             	shr    $0xf,%edx
+  8035fb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803600:	b8 00 00 00 00       	mov    $0x0,%eax
+  803605:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803608:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80360f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803615:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803618:	5b                   	pop    %ebx
+  803619:	5e                   	pop    %esi
+  80361a:	5d                   	pop    %ebp
+  80361b:	c3                   	ret
+		if(from_env_store != NULL)
+  80361c:	85 f6                	test   %esi,%esi
+  80361e:	74 06                	je     803626 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803620:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803626:	85 db                	test   %ebx,%ebx
+  803628:	74 eb                	je     803615 <ipc_recv+0xb0>
+			*perm_store = 0;
+  80362a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803630:	eb e3                	jmp    803615 <ipc_recv+0xb0>
+
+00803632 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803632:	55                   	push   %ebp
+  803633:	89 e5                	mov    %esp,%ebp
+  803635:	57                   	push   %edi
+  803636:	56                   	push   %esi
+  803637:	53                   	push   %ebx
+  803638:	83 ec 14             	sub    $0x14,%esp
+  80363b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80363e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803641:	8b 75 14             	mov    0x14(%ebp),%esi
+  803644:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803647:	85 c0                	test   %eax,%eax
+  803649:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80364e:	0f 44 c2             	cmove  %edx,%eax
+  803651:	ff 75 10             	push   0x10(%ebp)
+  803654:	50                   	push   %eax
+  803655:	e8 9c d8 ff ff       	call   800ef6 <sys_ipc_recv_pages>
+  80365a:	83 c4 10             	add    $0x10,%esp
+  80365d:	85 c0                	test   %eax,%eax
+  80365f:	0f 88 ba 00 00 00    	js     80371f <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803665:	85 ff                	test   %edi,%edi
+  803667:	74 2a                	je     803693 <ipc_recv_pages+0x61>
+  803669:	89 e2                	mov    %esp,%edx
+  80366b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803670:	29 d0                	sub    %edx,%eax
+  803672:	89 c2                	mov    %eax,%edx
+  803674:	c1 ea 0f             	shr    $0xf,%edx
+  803677:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80367c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803681:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803684:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80368b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803691:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803693:	85 f6                	test   %esi,%esi
+  803695:	74 2a                	je     8036c1 <ipc_recv_pages+0x8f>
+  803697:	89 e2                	mov    %esp,%edx
+  803699:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80369e:	29 d0                	sub    %edx,%eax
+  8036a0:	89 c2                	mov    %eax,%edx
+  8036a2:	c1 ea 0f             	shr    $0xf,%edx
+  8036a5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036af:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8036b2:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036b9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8036bf:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8036c1:	85 db                	test   %ebx,%ebx
+  8036c3:	74 2a                	je     8036ef <ipc_recv_pages+0xbd>
+  8036c5:	89 e2                	mov    %esp,%edx
+  8036c7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036cc:	29 d0                	sub    %edx,%eax
+  8036ce:	89 c2                	mov    %eax,%edx
+  8036d0:	c1 ea 0f             	shr    $0xf,%edx
+  8036d3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036dd:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036e0:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036e7:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036ed:	89 03                	mov    %eax,(%ebx)
+  8036ef:	89 e2                	mov    %esp,%edx
+  8036f1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036f6:	29 d0                	sub    %edx,%eax
+  8036f8:	89 c2                	mov    %eax,%edx
+  8036fa:	c1 ea 0f             	shr    $0xf,%edx
+  8036fd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803702:	b8 00 00 00 00       	mov    $0x0,%eax
+  803707:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80370a:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803711:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80371a:	5b                   	pop    %ebx
+  80371b:	5e                   	pop    %esi
+  80371c:	5f                   	pop    %edi
+  80371d:	5d                   	pop    %ebp
+  80371e:	c3                   	ret
+		if (from_env_store)
+  80371f:	85 ff                	test   %edi,%edi
+  803721:	74 06                	je     803729 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803723:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803729:	85 f6                	test   %esi,%esi
+  80372b:	74 06                	je     803733 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80372d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803733:	85 db                	test   %ebx,%ebx
+  803735:	74 e0                	je     803717 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803737:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80373d:	eb d8                	jmp    803717 <ipc_recv_pages+0xe5>
+
+0080373f <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80373f:	55                   	push   %ebp
+  803740:	89 e5                	mov    %esp,%ebp
+  803742:	57                   	push   %edi
+  803743:	56                   	push   %esi
+  803744:	53                   	push   %ebx
+  803745:	83 ec 1c             	sub    $0x1c,%esp
+  803748:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80374b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80374e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803754:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803758:	75 2b                	jne    803785 <ipc_try_send_pages+0x46>
+  80375a:	89 e2                	mov    %esp,%edx
+  80375c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803761:	29 d0                	sub    %edx,%eax
+  803763:	89 c2                	mov    %eax,%edx
+  803765:	c1 ea 0f             	shr    $0xf,%edx
+  803768:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80376d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803772:	0f 42 c2             	cmovb  %edx,%eax
+  803775:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80377c:	8b 70 48             	mov    0x48(%eax),%esi
+  80377f:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803785:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80378b:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803790:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803793:	85 ff                	test   %edi,%edi
+  803795:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80379a:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80379d:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8037a3:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8037a9:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8037af:	83 ec 0c             	sub    $0xc,%esp
+  8037b2:	ff 75 14             	push   0x14(%ebp)
+  8037b5:	ff 75 18             	push   0x18(%ebp)
+  8037b8:	57                   	push   %edi
+  8037b9:	ff 75 0c             	push   0xc(%ebp)
+  8037bc:	ff 75 08             	push   0x8(%ebp)
+  8037bf:	e8 11 d7 ff ff       	call   800ed5 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8037c4:	83 c4 20             	add    $0x20,%esp
+  8037c7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037ca:	75 21                	jne    8037ed <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8037cc:	83 ec 04             	sub    $0x4,%esp
+  8037cf:	6a ff                	push   $0xffffffff
+  8037d1:	53                   	push   %ebx
+  8037d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8037d5:	e8 08 d9 ff ff       	call   8010e2 <sys_futex_wait>
+  8037da:	83 c4 10             	add    $0x10,%esp
+  8037dd:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037e0:	74 c7                	je     8037a9 <ipc_try_send_pages+0x6a>
+  8037e2:	85 c0                	test   %eax,%eax
+  8037e4:	79 c3                	jns    8037a9 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037e6:	e8 da d4 ff ff       	call   800cc5 <sys_yield>
+  8037eb:	eb bc                	jmp    8037a9 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037f0:	5b                   	pop    %ebx
+  8037f1:	5e                   	pop    %esi
+  8037f2:	5f                   	pop    %edi
+  8037f3:	5d                   	pop    %ebp
+  8037f4:	c3                   	ret
+
+008037f5 <ipc_send>:
+{
+  8037f5:	55                   	push   %ebp
+  8037f6:	89 e5                	mov    %esp,%ebp
+  8037f8:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037fb:	ff 75 14             	push   0x14(%ebp)
+  8037fe:	6a 01                	push   $0x1
+  803800:	ff 75 10             	push   0x10(%ebp)
+  803803:	ff 75 0c             	push   0xc(%ebp)
+  803806:	ff 75 08             	push   0x8(%ebp)
+  803809:	e8 31 ff ff ff       	call   80373f <ipc_try_send_pages>
+  80380e:	83 c4 20             	add    $0x20,%esp
+  803811:	85 c0                	test   %eax,%eax
+  803813:	78 02                	js     803817 <ipc_send+0x22>
+}
+  803815:	c9                   	leave
+  803816:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803817:	50                   	push   %eax
+  803818:	68 8f 3f 80 00       	push   $0x803f8f
+  80381d:	6a 3f                	push   $0x3f
+  80381f:	68 a4 3f 80 00       	push   $0x803fa4
+  803824:	e8 f6 fc ff ff       	call   80351f <_panic>
+
+00803829 <ipc_send_pages>:
+{
+  803829:	55                   	push   %ebp
+  80382a:	89 e5                	mov    %esp,%ebp
+  80382c:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80382f:	ff 75 18             	push   0x18(%ebp)
+  803832:	ff 75 14             	push   0x14(%ebp)
+  803835:	ff 75 10             	push   0x10(%ebp)
+  803838:	ff 75 0c             	push   0xc(%ebp)
+  80383b:	ff 75 08             	push   0x8(%ebp)
+  80383e:	e8 fc fe ff ff       	call   80373f <ipc_try_send_pages>
+  803843:	83 c4 20             	add    $0x20,%esp
+  803846:	85 c0                	test   %eax,%eax
+  803848:	78 02                	js     80384c <ipc_send_pages+0x23>
+}
+  80384a:	c9                   	leave
+  80384b:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80384c:	50                   	push   %eax
+  80384d:	68 ae 3f 80 00       	push   $0x803fae
+  803852:	6a 64                	push   $0x64
+  803854:	68 a4 3f 80 00       	push   $0x803fa4
+  803859:	e8 c1 fc ff ff       	call   80351f <_panic>
+
+0080385e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80385e:	55                   	push   %ebp
+  80385f:	89 e5                	mov    %esp,%ebp
+  803861:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803864:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803869:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80386f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803875:	8b 52 50             	mov    0x50(%edx),%edx
+  803878:	39 ca                	cmp    %ecx,%edx
+  80387a:	74 11                	je     80388d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80387c:	83 c0 01             	add    $0x1,%eax
+  80387f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803884:	75 e3                	jne    803869 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388b:	eb 0e                	jmp    80389b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80388d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803893:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803898:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80389b:	5d                   	pop    %ebp
+  80389c:	c3                   	ret
+
+0080389d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80389d:	55                   	push   %ebp
+  80389e:	89 e5                	mov    %esp,%ebp
+  8038a0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8038a3:	89 c2                	mov    %eax,%edx
+  8038a5:	c1 ea 16             	shr    $0x16,%edx
+  8038a8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8038af:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8038b4:	f6 c1 01             	test   $0x1,%cl
+  8038b7:	74 1e                	je     8038d7 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8038b9:	c1 e8 0c             	shr    $0xc,%eax
+  8038bc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8038c3:	a8 01                	test   $0x1,%al
+  8038c5:	74 10                	je     8038d7 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8038c7:	c1 e8 0c             	shr    $0xc,%eax
+  8038ca:	c1 e0 04             	shl    $0x4,%eax
+  8038cd:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8038d4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038d7:	89 d0                	mov    %edx,%eax
+  8038d9:	5d                   	pop    %ebp
+  8038da:	c3                   	ret
+
+008038db <__udivdi3>:
+  8038db:	57                   	push   %edi
+  8038dc:	56                   	push   %esi
+  8038dd:	53                   	push   %ebx
+  8038de:	83 ec 20             	sub    $0x20,%esp
+  8038e1:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038e5:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038e9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038ed:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038f1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038f5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038f9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038fd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803901:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803910:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803917:	00 
+  803918:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80391f:	00 
+  803920:	eb 08                	jmp    80392a <__udivdi3+0x4f>
+  803922:	83 e9 01             	sub    $0x1,%ecx
+  803925:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803928:	74 68                	je     803992 <__udivdi3+0xb7>
+  80392a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80392e:	01 c0                	add    %eax,%eax
+  803930:	89 c6                	mov    %eax,%esi
+  803932:	89 d7                	mov    %edx,%edi
+  803934:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803938:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80393c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80393f:	d3 ea                	shr    %cl,%edx
+  803941:	f6 c1 20             	test   $0x20,%cl
+  803944:	74 04                	je     80394a <__udivdi3+0x6f>
+  803946:	89 d0                	mov    %edx,%eax
+  803948:	31 d2                	xor    %edx,%edx
+  80394a:	83 e0 01             	and    $0x1,%eax
+  80394d:	89 04 24             	mov    %eax,(%esp)
+  803950:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803957:	00 
+  803958:	8b 04 24             	mov    (%esp),%eax
+  80395b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80395f:	09 f0                	or     %esi,%eax
+  803961:	09 fa                	or     %edi,%edx
+  803963:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803967:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80396b:	39 f0                	cmp    %esi,%eax
+  80396d:	89 d3                	mov    %edx,%ebx
+  80396f:	19 fb                	sbb    %edi,%ebx
+  803971:	72 af                	jb     803922 <__udivdi3+0x47>
+  803973:	29 f0                	sub    %esi,%eax
+  803975:	19 fa                	sbb    %edi,%edx
+  803977:	89 cf                	mov    %ecx,%edi
+  803979:	c1 ef 05             	shr    $0x5,%edi
+  80397c:	83 e7 01             	and    $0x1,%edi
+  80397f:	89 fe                	mov    %edi,%esi
+  803981:	83 f6 01             	xor    $0x1,%esi
+  803984:	d3 e6                	shl    %cl,%esi
+  803986:	d3 e7                	shl    %cl,%edi
+  803988:	09 74 24 18          	or     %esi,0x18(%esp)
+  80398c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803990:	eb 90                	jmp    803922 <__udivdi3+0x47>
+  803992:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803996:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80399a:	83 c4 20             	add    $0x20,%esp
+  80399d:	5b                   	pop    %ebx
+  80399e:	5e                   	pop    %esi
+  80399f:	5f                   	pop    %edi
+  8039a0:	c3                   	ret
+
+008039a1 <__umoddi3>:
+  8039a1:	57                   	push   %edi
+  8039a2:	56                   	push   %esi
+  8039a3:	53                   	push   %ebx
+  8039a4:	83 ec 08             	sub    $0x8,%esp
+  8039a7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039ab:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039af:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8039b3:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8039b7:	57                   	push   %edi
+  8039b8:	56                   	push   %esi
+  8039b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039bd:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039c1:	52                   	push   %edx
+  8039c2:	50                   	push   %eax
+  8039c3:	e8 13 ff ff ff       	call   8038db <__udivdi3>
+  8039c8:	89 c3                	mov    %eax,%ebx
+  8039ca:	0f af d6             	imul   %esi,%edx
+  8039cd:	89 f9                	mov    %edi,%ecx
+  8039cf:	0f af cb             	imul   %ebx,%ecx
+  8039d2:	01 d1                	add    %edx,%ecx
+  8039d4:	89 d8                	mov    %ebx,%eax
+  8039d6:	f7 e6                	mul    %esi
+  8039d8:	89 c6                	mov    %eax,%esi
+  8039da:	89 d7                	mov    %edx,%edi
+  8039dc:	01 cf                	add    %ecx,%edi
+  8039de:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039e2:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039e6:	29 f0                	sub    %esi,%eax
+  8039e8:	19 fa                	sbb    %edi,%edx
+  8039ea:	83 c4 18             	add    $0x18,%esp
+  8039ed:	5b                   	pop    %ebx
+  8039ee:	5e                   	pop    %esi
+  8039ef:	5f                   	pop    %edi
+  8039f0:	c3                   	ret
+
+008039f1 <__divdi3>:
+  8039f1:	53                   	push   %ebx
+  8039f2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039f6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039fa:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039fe:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a02:	85 d2                	test   %edx,%edx
+  803a04:	78 12                	js     803a18 <__divdi3+0x27>
+  803a06:	85 db                	test   %ebx,%ebx
+  803a08:	78 2e                	js     803a38 <__divdi3+0x47>
+  803a0a:	53                   	push   %ebx
+  803a0b:	51                   	push   %ecx
+  803a0c:	52                   	push   %edx
+  803a0d:	50                   	push   %eax
+  803a0e:	e8 c8 fe ff ff       	call   8038db <__udivdi3>
+  803a13:	83 c4 10             	add    $0x10,%esp
+  803a16:	eb 1e                	jmp    803a36 <__divdi3+0x45>
+  803a18:	f7 d8                	neg    %eax
+  803a1a:	83 d2 00             	adc    $0x0,%edx
+  803a1d:	f7 da                	neg    %edx
+  803a1f:	85 db                	test   %ebx,%ebx
+  803a21:	78 2a                	js     803a4d <__divdi3+0x5c>
+  803a23:	53                   	push   %ebx
+  803a24:	51                   	push   %ecx
+  803a25:	52                   	push   %edx
+  803a26:	50                   	push   %eax
+  803a27:	e8 af fe ff ff       	call   8038db <__udivdi3>
+  803a2c:	83 c4 10             	add    $0x10,%esp
+  803a2f:	f7 d8                	neg    %eax
+  803a31:	83 d2 00             	adc    $0x0,%edx
+  803a34:	f7 da                	neg    %edx
+  803a36:	5b                   	pop    %ebx
+  803a37:	c3                   	ret
+  803a38:	f7 d9                	neg    %ecx
+  803a3a:	83 d3 00             	adc    $0x0,%ebx
+  803a3d:	f7 db                	neg    %ebx
+  803a3f:	53                   	push   %ebx
+  803a40:	51                   	push   %ecx
+  803a41:	52                   	push   %edx
+  803a42:	50                   	push   %eax
+  803a43:	e8 93 fe ff ff       	call   8038db <__udivdi3>
+  803a48:	83 c4 10             	add    $0x10,%esp
+  803a4b:	eb e2                	jmp    803a2f <__divdi3+0x3e>
+  803a4d:	f7 d9                	neg    %ecx
+  803a4f:	83 d3 00             	adc    $0x0,%ebx
+  803a52:	f7 db                	neg    %ebx
+  803a54:	53                   	push   %ebx
+  803a55:	51                   	push   %ecx
+  803a56:	52                   	push   %edx
+  803a57:	50                   	push   %eax
+  803a58:	e8 7e fe ff ff       	call   8038db <__udivdi3>
+  803a5d:	83 c4 10             	add    $0x10,%esp
+  803a60:	eb d4                	jmp    803a36 <__divdi3+0x45>
+
+00803a62 <__moddi3>:
+  803a62:	57                   	push   %edi
+  803a63:	56                   	push   %esi
+  803a64:	53                   	push   %ebx
+  803a65:	83 ec 08             	sub    $0x8,%esp
+  803a68:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a6c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a70:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a74:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a78:	57                   	push   %edi
+  803a79:	56                   	push   %esi
+  803a7a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a7e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a82:	52                   	push   %edx
+  803a83:	50                   	push   %eax
+  803a84:	e8 68 ff ff ff       	call   8039f1 <__divdi3>
+  803a89:	89 c3                	mov    %eax,%ebx
+  803a8b:	0f af d6             	imul   %esi,%edx
+  803a8e:	89 f9                	mov    %edi,%ecx
+  803a90:	0f af cb             	imul   %ebx,%ecx
+  803a93:	01 d1                	add    %edx,%ecx
+  803a95:	89 d8                	mov    %ebx,%eax
+  803a97:	f7 e6                	mul    %esi
+  803a99:	89 c6                	mov    %eax,%esi
+  803a9b:	89 d7                	mov    %edx,%edi
+  803a9d:	01 cf                	add    %ecx,%edi
+  803a9f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803aa3:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803aa7:	29 f0                	sub    %esi,%eax
+  803aa9:	19 fa                	sbb    %edi,%edx
+  803aab:	83 c4 18             	add    $0x18,%esp
+  803aae:	5b                   	pop    %ebx
+  803aaf:	5e                   	pop    %esi
+  803ab0:	5f                   	pop    %edi
+  803ab1:	c3                   	ret
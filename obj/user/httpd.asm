@@ -0,0 +1,12954 @@
+
+obj/user/httpd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 55 14 00 00       	call   801486 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <header_is>:
+}
+
+// Does header line 'line' name header 'name' (lower case, with colon)?
+static bool
+header_is(const char *line, const char *name)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	89 c3                	mov    %eax,%ebx
+  800040:	89 d6                	mov    %edx,%esi
+	for (; *name; line++, name++)
+  800042:	0f b6 12             	movzbl (%edx),%edx
+  800045:	84 d2                	test   %dl,%dl
+  800047:	74 37                	je     800080 <header_is+0x4b>
+		if ((*line >= 'A' && *line <= 'Z' ? *line + 'a' - 'A' : *line)
+  800049:	0f b6 03             	movzbl (%ebx),%eax
+  80004c:	8d 78 bf             	lea    -0x41(%eax),%edi
+  80004f:	0f be c8             	movsbl %al,%ecx
+  800052:	83 c1 20             	add    $0x20,%ecx
+  800055:	0f be c0             	movsbl %al,%eax
+  800058:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  80005b:	89 f8                	mov    %edi,%eax
+  80005d:	3c 19                	cmp    $0x19,%al
+  80005f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  800062:	0f 46 c1             	cmovbe %ecx,%eax
+		    != *name)
+  800065:	0f be d2             	movsbl %dl,%edx
+		if ((*line >= 'A' && *line <= 'Z' ? *line + 'a' - 'A' : *line)
+  800068:	39 c2                	cmp    %eax,%edx
+  80006a:	75 1b                	jne    800087 <header_is+0x52>
+	for (; *name; line++, name++)
+  80006c:	83 c3 01             	add    $0x1,%ebx
+  80006f:	83 c6 01             	add    $0x1,%esi
+  800072:	0f b6 16             	movzbl (%esi),%edx
+  800075:	84 d2                	test   %dl,%dl
+  800077:	75 d0                	jne    800049 <header_is+0x14>
+			return 0;
+	return 1;
+  800079:	b8 01 00 00 00       	mov    $0x1,%eax
+  80007e:	eb 0c                	jmp    80008c <header_is+0x57>
+  800080:	b8 01 00 00 00       	mov    $0x1,%eax
+  800085:	eb 05                	jmp    80008c <header_is+0x57>
+			return 0;
+  800087:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80008c:	83 c4 04             	add    $0x4,%esp
+  80008f:	5b                   	pop    %ebx
+  800090:	5e                   	pop    %esi
+  800091:	5f                   	pop    %edi
+  800092:	5d                   	pop    %ebp
+  800093:	c3                   	ret
+
+00800094 <header_has>:
+
+// Does 'value', up to the end of the line, contain the lower case
+// token 'token'?
+static bool
+header_has(const char *value, const char *token)
+{
+  800094:	55                   	push   %ebp
+  800095:	89 e5                	mov    %esp,%ebp
+  800097:	57                   	push   %edi
+  800098:	56                   	push   %esi
+  800099:	53                   	push   %ebx
+  80009a:	89 c3                	mov    %eax,%ebx
+  80009c:	89 d6                	mov    %edx,%esi
+	for (; *value && *value != '\r' && *value != '\n'; value++)
+  80009e:	0f b6 00             	movzbl (%eax),%eax
+  8000a1:	3c 0d                	cmp    $0xd,%al
+  8000a3:	77 0a                	ja     8000af <header_has+0x1b>
+  8000a5:	ba 01 24 00 00       	mov    $0x2401,%edx
+  8000aa:	0f a3 c2             	bt     %eax,%edx
+  8000ad:	72 27                	jb     8000d6 <header_has+0x42>
+  8000af:	bf 01 24 00 00       	mov    $0x2401,%edi
+		if (header_is(value, token))
+  8000b4:	89 f2                	mov    %esi,%edx
+  8000b6:	89 d8                	mov    %ebx,%eax
+  8000b8:	e8 78 ff ff ff       	call   800035 <header_is>
+  8000bd:	85 c0                	test   %eax,%eax
+  8000bf:	75 1c                	jne    8000dd <header_has+0x49>
+	for (; *value && *value != '\r' && *value != '\n'; value++)
+  8000c1:	83 c3 01             	add    $0x1,%ebx
+  8000c4:	0f b6 13             	movzbl (%ebx),%edx
+  8000c7:	80 fa 0d             	cmp    $0xd,%dl
+  8000ca:	77 e8                	ja     8000b4 <header_has+0x20>
+  8000cc:	0f a3 d7             	bt     %edx,%edi
+  8000cf:	73 e3                	jae    8000b4 <header_has+0x20>
+			return 1;
+	return 0;
+}
+  8000d1:	5b                   	pop    %ebx
+  8000d2:	5e                   	pop    %esi
+  8000d3:	5f                   	pop    %edi
+  8000d4:	5d                   	pop    %ebp
+  8000d5:	c3                   	ret
+	return 0;
+  8000d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000db:	eb f4                	jmp    8000d1 <header_has+0x3d>
+			return 1;
+  8000dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e2:	eb ed                	jmp    8000d1 <header_has+0x3d>
+
+008000e4 <rcache_unlock>:
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	f0 87 05 00 00 00 c0 	lock xchg %eax,0xc0000000
+
+static void
+rcache_unlock(void)
+{
+	xchg(&rcache->lock, 0);
+}
+  8000f0:	c3                   	ret
+
+008000f1 <rcache_free_run>:
+static bool
+rcache_free_run(int page, int npages)
+{
+	struct rcache_entry *e;
+
+	if (page + npages > RCACHE_PAGES)
+  8000f1:	01 c2                	add    %eax,%edx
+  8000f3:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8000f9:	7f 3a                	jg     800135 <rcache_free_run+0x44>
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	53                   	push   %ebx
+  8000ff:	89 c3                	mov    %eax,%ebx
+		return 0;
+	for (e = rcache->ents; e < rcache->ents + RCACHE_NENT; e++)
+  800101:	b8 10 00 00 c0       	mov    $0xc0000010,%eax
+  800106:	eb 0a                	jmp    800112 <rcache_free_run+0x21>
+  800108:	83 c0 60             	add    $0x60,%eax
+  80010b:	3d 10 18 00 c0       	cmp    $0xc0001810,%eax
+  800110:	74 1c                	je     80012e <rcache_free_run+0x3d>
+		if (e->page >= 0 && e->page < page + npages
+  800112:	8b 48 48             	mov    0x48(%eax),%ecx
+  800115:	39 ca                	cmp    %ecx,%edx
+  800117:	7e ef                	jle    800108 <rcache_free_run+0x17>
+  800119:	85 c9                	test   %ecx,%ecx
+  80011b:	78 eb                	js     800108 <rcache_free_run+0x17>
+		    && page < e->page + e->npages)
+  80011d:	03 48 4c             	add    0x4c(%eax),%ecx
+  800120:	39 d9                	cmp    %ebx,%ecx
+  800122:	7e e4                	jle    800108 <rcache_free_run+0x17>
+			return 0;
+  800124:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 1;
+}
+  800129:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80012c:	c9                   	leave
+  80012d:	c3                   	ret
+	return 1;
+  80012e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800133:	eb f4                	jmp    800129 <rcache_free_run+0x38>
+		return 0;
+  800135:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80013a:	c3                   	ret
+
+0080013b <die>:
+{
+  80013b:	55                   	push   %ebp
+  80013c:	89 e5                	mov    %esp,%ebp
+  80013e:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800141:	50                   	push   %eax
+  800142:	68 60 68 80 00       	push   $0x806860
+  800147:	e8 bc 14 00 00       	call   801608 <cprintf>
+	exit();
+  80014c:	e8 c2 13 00 00       	call   801513 <exit>
+}
+  800151:	83 c4 10             	add    $0x10,%esp
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+00800156 <out_send>:
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	57                   	push   %edi
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+  80015c:	83 ec 40             	sub    $0x40,%esp
+  80015f:	89 c3                	mov    %eax,%ebx
+	struct iovec *iov = c->out;
+  800161:	8d b0 08 08 00 00    	lea    0x808(%eax),%esi
+	memset(&msg, 0, sizeof(msg));
+  800167:	6a 14                	push   $0x14
+  800169:	6a 00                	push   $0x0
+  80016b:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  80016e:	50                   	push   %eax
+  80016f:	e8 06 1d 00 00       	call   801e7a <memset>
+	while (c->nout > 0) {
+  800174:	8b bb 20 08 00 00    	mov    0x820(%ebx),%edi
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	85 ff                	test   %edi,%edi
+  80017f:	7f 56                	jg     8001d7 <out_send+0x81>
+	return 0;
+  800181:	b8 00 00 00 00       	mov    $0x0,%eax
+  800186:	e9 ab 00 00 00       	jmp    800236 <out_send+0xe0>
+  80018b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800190:	e9 a1 00 00 00       	jmp    800236 <out_send+0xe0>
+		if (c->nout > 0) {
+  800195:	85 d2                	test   %edx,%edx
+  800197:	7e 05                	jle    80019e <out_send+0x48>
+			iov->iov_base = (char *) iov->iov_base + r;
+  800199:	01 01                	add    %eax,(%ecx)
+			iov->iov_len -= r;
+  80019b:	29 41 04             	sub    %eax,0x4(%ecx)
+		for (i = 0; i < c->nout; i++)
+  80019e:	8b bb 20 08 00 00    	mov    0x820(%ebx),%edi
+  8001a4:	85 ff                	test   %edi,%edi
+  8001a6:	0f 8e 85 00 00 00    	jle    800231 <out_send+0xdb>
+  8001ac:	89 c8                	mov    %ecx,%eax
+  8001ae:	8d 93 08 08 00 00    	lea    0x808(%ebx),%edx
+  8001b4:	8d 0c f9             	lea    (%ecx,%edi,8),%ecx
+  8001b7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  8001ba:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+			c->out[i] = iov[i];
+  8001bd:	8b 18                	mov    (%eax),%ebx
+  8001bf:	8b 70 04             	mov    0x4(%eax),%esi
+  8001c2:	89 1a                	mov    %ebx,(%edx)
+  8001c4:	89 72 04             	mov    %esi,0x4(%edx)
+		for (i = 0; i < c->nout; i++)
+  8001c7:	83 c0 08             	add    $0x8,%eax
+  8001ca:	83 c2 08             	add    $0x8,%edx
+  8001cd:	39 c8                	cmp    %ecx,%eax
+  8001cf:	75 ec                	jne    8001bd <out_send+0x67>
+  8001d1:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8001d4:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+		msg.msg_iov = iov;
+  8001d7:	89 75 dc             	mov    %esi,-0x24(%ebp)
+		msg.msg_iovlen = c->nout;
+  8001da:	89 7d e0             	mov    %edi,-0x20(%ebp)
+		if ((r = sendmsg(c->sock, &msg, 0)) == -E_AGAIN)
+  8001dd:	83 ec 04             	sub    $0x4,%esp
+  8001e0:	6a 00                	push   $0x0
+  8001e2:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	ff 33                	push   (%ebx)
+  8001e8:	e8 74 38 00 00       	call   803a61 <sendmsg>
+  8001ed:	83 c4 10             	add    $0x10,%esp
+  8001f0:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8001f3:	74 2e                	je     800223 <out_send+0xcd>
+		if (r <= 0)
+  8001f5:	85 c0                	test   %eax,%eax
+  8001f7:	7e 31                	jle    80022a <out_send+0xd4>
+		for (; c->nout > 0 && r >= iov->iov_len; c->nout--, iov++)
+  8001f9:	8b 93 20 08 00 00    	mov    0x820(%ebx),%edx
+  8001ff:	85 d2                	test   %edx,%edx
+  800201:	7e 88                	jle    80018b <out_send+0x35>
+  800203:	89 f1                	mov    %esi,%ecx
+  800205:	8b 79 04             	mov    0x4(%ecx),%edi
+  800208:	39 f8                	cmp    %edi,%eax
+  80020a:	72 89                	jb     800195 <out_send+0x3f>
+			r -= iov->iov_len;
+  80020c:	29 f8                	sub    %edi,%eax
+		for (; c->nout > 0 && r >= iov->iov_len; c->nout--, iov++)
+  80020e:	83 ea 01             	sub    $0x1,%edx
+  800211:	89 93 20 08 00 00    	mov    %edx,0x820(%ebx)
+  800217:	83 c1 08             	add    $0x8,%ecx
+  80021a:	85 d2                	test   %edx,%edx
+  80021c:	75 e7                	jne    800205 <out_send+0xaf>
+  80021e:	e9 7b ff ff ff       	jmp    80019e <out_send+0x48>
+			return 1;
+  800223:	b8 01 00 00 00       	mov    $0x1,%eax
+  800228:	eb 0c                	jmp    800236 <out_send+0xe0>
+			return -1;
+  80022a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80022f:	eb 05                	jmp    800236 <out_send+0xe0>
+	return 0;
+  800231:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800239:	5b                   	pop    %ebx
+  80023a:	5e                   	pop    %esi
+  80023b:	5f                   	pop    %edi
+  80023c:	5d                   	pop    %ebp
+  80023d:	c3                   	ret
+
+0080023e <rcache_lock>:
+  80023e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800243:	f0 87 05 00 00 00 c0 	lock xchg %eax,0xc0000000
+	while (xchg(&rcache->lock, 1) != 0)
+  80024a:	85 c0                	test   %eax,%eax
+  80024c:	74 23                	je     800271 <rcache_lock+0x33>
+{
+  80024e:	55                   	push   %ebp
+  80024f:	89 e5                	mov    %esp,%ebp
+  800251:	53                   	push   %ebx
+  800252:	83 ec 04             	sub    $0x4,%esp
+  800255:	bb 01 00 00 00       	mov    $0x1,%ebx
+		sys_yield();
+  80025a:	e8 b5 1e 00 00       	call   802114 <sys_yield>
+  80025f:	89 d8                	mov    %ebx,%eax
+  800261:	f0 87 05 00 00 00 c0 	lock xchg %eax,0xc0000000
+	while (xchg(&rcache->lock, 1) != 0)
+  800268:	85 c0                	test   %eax,%eax
+  80026a:	75 ee                	jne    80025a <rcache_lock+0x1c>
+}
+  80026c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80026f:	c9                   	leave
+  800270:	c3                   	ret
+  800271:	c3                   	ret
+
+00800272 <fcache_put>:
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	53                   	push   %ebx
+  800276:	83 ec 04             	sub    $0x4,%esp
+  800279:	89 c3                	mov    %eax,%ebx
+	if (--e->refs == 0 && e->spill) {
+  80027b:	8b 80 0c 04 00 00    	mov    0x40c(%eax),%eax
+  800281:	83 e8 01             	sub    $0x1,%eax
+  800284:	89 83 0c 04 00 00    	mov    %eax,0x40c(%ebx)
+  80028a:	75 09                	jne    800295 <fcache_put+0x23>
+  80028c:	83 bb 10 04 00 00 00 	cmpl   $0x0,0x410(%ebx)
+  800293:	75 05                	jne    80029a <fcache_put+0x28>
+}
+  800295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+		close(e->fd);
+  80029a:	83 ec 0c             	sub    $0xc,%esp
+  80029d:	ff b3 00 04 00 00    	push   0x400(%ebx)
+  8002a3:	e8 75 2d 00 00       	call   80301d <close>
+		free(e);
+  8002a8:	89 1c 24             	mov    %ebx,(%esp)
+  8002ab:	e8 56 4e 00 00       	call   805106 <free>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+}
+  8002b3:	eb e0                	jmp    800295 <fcache_put+0x23>
+
+008002b5 <out_release>:
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	56                   	push   %esi
+  8002b9:	53                   	push   %ebx
+  8002ba:	89 c3                	mov    %eax,%ebx
+	if (c->out_cached)
+  8002bc:	8b b0 28 08 00 00    	mov    0x828(%eax),%esi
+  8002c2:	85 f6                	test   %esi,%esi
+  8002c4:	74 30                	je     8002f6 <out_release+0x41>
+static void
+rcache_put(struct rcache_entry *e)
+{
+	uint32_t n;
+
+	rcache_lock();
+  8002c6:	e8 73 ff ff ff       	call   80023e <rcache_lock>
+	e->refs--;
+  8002cb:	83 6e 58 01          	subl   $0x1,0x58(%esi)
+	n = rcache->hits + rcache->misses;
+  8002cf:	8b 35 0c 00 00 c0    	mov    0xc000000c,%esi
+  8002d5:	03 35 08 00 00 c0    	add    0xc0000008,%esi
+	rcache_unlock();
+  8002db:	e8 04 fe ff ff       	call   8000e4 <rcache_unlock>
+	if (n % RCACHE_REPORT == 0)
+  8002e0:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+  8002e5:	89 f0                	mov    %esi,%eax
+  8002e7:	f7 e2                	mul    %edx
+  8002e9:	c1 ea 06             	shr    $0x6,%edx
+  8002ec:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+  8002f2:	39 d6                	cmp    %edx,%esi
+  8002f4:	74 3e                	je     800334 <out_release+0x7f>
+	if (c->out_file)
+  8002f6:	8b 83 2c 08 00 00    	mov    0x82c(%ebx),%eax
+  8002fc:	85 c0                	test   %eax,%eax
+  8002fe:	74 05                	je     800305 <out_release+0x50>
+		fcache_put(c->out_file);
+  800300:	e8 6d ff ff ff       	call   800272 <fcache_put>
+	c->out_cached = NULL;
+  800305:	c7 83 28 08 00 00 00 	movl   $0x0,0x828(%ebx)
+  80030c:	00 00 00 
+	c->out_file = NULL;
+  80030f:	c7 83 2c 08 00 00 00 	movl   $0x0,0x82c(%ebx)
+  800316:	00 00 00 
+	c->nout = c->obuflen = 0;
+  800319:	c7 83 24 08 00 00 00 	movl   $0x0,0x824(%ebx)
+  800320:	00 00 00 
+  800323:	c7 83 20 08 00 00 00 	movl   $0x0,0x820(%ebx)
+  80032a:	00 00 00 
+}
+  80032d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800330:	5b                   	pop    %ebx
+  800331:	5e                   	pop    %esi
+  800332:	5d                   	pop    %ebp
+  800333:	c3                   	ret
+		cprintf("httpd: cache %u hits, %u misses, %u%% hit rate\n",
+			rcache->hits, rcache->misses,
+			rcache->hits * 100 / n);
+  800334:	8b 0d 08 00 00 c0    	mov    0xc0000008,%ecx
+  80033a:	6b c1 64             	imul   $0x64,%ecx,%eax
+		cprintf("httpd: cache %u hits, %u misses, %u%% hit rate\n",
+  80033d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800342:	f7 f6                	div    %esi
+  800344:	50                   	push   %eax
+  800345:	ff 35 0c 00 00 c0    	push   0xc000000c
+  80034b:	51                   	push   %ecx
+  80034c:	68 7c 69 80 00       	push   $0x80697c
+  800351:	e8 b2 12 00 00       	call   801608 <cprintf>
+  800356:	83 c4 10             	add    $0x10,%esp
+  800359:	eb 9b                	jmp    8002f6 <out_release+0x41>
+
+0080035b <out_flush>:
+{
+  80035b:	55                   	push   %ebp
+  80035c:	89 e5                	mov    %esp,%ebp
+  80035e:	57                   	push   %edi
+  80035f:	56                   	push   %esi
+  800360:	53                   	push   %ebx
+  800361:	83 ec 1c             	sub    $0x1c,%esp
+  800364:	89 c3                	mov    %eax,%ebx
+	if ((r = out_send(c)) != 0)
+  800366:	e8 eb fd ff ff       	call   800156 <out_send>
+  80036b:	89 c6                	mov    %eax,%esi
+  80036d:	85 c0                	test   %eax,%eax
+  80036f:	0f 85 e8 00 00 00    	jne    80045d <out_flush+0x102>
+	while (c->out_file && c->out_off < c->out_end) {
+  800375:	8b 8b 2c 08 00 00    	mov    0x82c(%ebx),%ecx
+  80037b:	85 c9                	test   %ecx,%ecx
+  80037d:	0f 84 ef 00 00 00    	je     800472 <out_flush+0x117>
+			    || (r = readn(fd, c->obuf, n)) != n)
+  800383:	8d 83 40 08 00 00    	lea    0x840(%ebx),%eax
+  800389:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80038c:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80038f:	eb 46                	jmp    8003d7 <out_flush+0x7c>
+				return r < 0 ? r : -E_EOF;
+  800391:	85 c0                	test   %eax,%eax
+  800393:	0f 88 c4 00 00 00    	js     80045d <out_flush+0x102>
+  800399:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80039e:	e9 ba 00 00 00       	jmp    80045d <out_flush+0x102>
+				  c->out_end - c->out_off)) == -E_AGAIN)
+  8003a3:	29 c6                	sub    %eax,%esi
+		if ((r = sendfile(c->sock, fd, c->out_off,
+  8003a5:	56                   	push   %esi
+  8003a6:	50                   	push   %eax
+  8003a7:	57                   	push   %edi
+  8003a8:	ff 33                	push   (%ebx)
+  8003aa:	e8 44 37 00 00       	call   803af3 <sendfile>
+  8003af:	83 c4 10             	add    $0x10,%esp
+  8003b2:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8003b5:	0f 84 c7 00 00 00    	je     800482 <out_flush+0x127>
+		if (r <= 0)
+  8003bb:	85 c0                	test   %eax,%eax
+  8003bd:	0f 8e a2 00 00 00    	jle    800465 <out_flush+0x10a>
+		c->out_off += r;
+  8003c3:	01 83 30 08 00 00    	add    %eax,0x830(%ebx)
+	while (c->out_file && c->out_off < c->out_end) {
+  8003c9:	8b 8b 2c 08 00 00    	mov    0x82c(%ebx),%ecx
+  8003cf:	85 c9                	test   %ecx,%ecx
+  8003d1:	0f 84 a6 00 00 00    	je     80047d <out_flush+0x122>
+  8003d7:	8b 83 30 08 00 00    	mov    0x830(%ebx),%eax
+  8003dd:	8b b3 34 08 00 00    	mov    0x834(%ebx),%esi
+  8003e3:	39 f0                	cmp    %esi,%eax
+  8003e5:	0f 8d 84 00 00 00    	jge    80046f <out_flush+0x114>
+		fd = c->out_file->fd;
+  8003eb:	8b b9 00 04 00 00    	mov    0x400(%ecx),%edi
+		if (copy_data) {
+  8003f1:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8003f8:	74 a9                	je     8003a3 <out_flush+0x48>
+			n = MIN(c->out_end - c->out_off, OBUFSIZE);
+  8003fa:	29 c6                	sub    %eax,%esi
+  8003fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800401:	39 d6                	cmp    %edx,%esi
+  800403:	0f 4f f2             	cmovg  %edx,%esi
+			if ((r = seek(fd, c->out_off)) < 0
+  800406:	83 ec 08             	sub    $0x8,%esp
+  800409:	50                   	push   %eax
+  80040a:	57                   	push   %edi
+  80040b:	e8 e3 2e 00 00       	call   8032f3 <seek>
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	85 c0                	test   %eax,%eax
+  800415:	78 46                	js     80045d <out_flush+0x102>
+			    || (r = readn(fd, c->obuf, n)) != n)
+  800417:	83 ec 04             	sub    $0x4,%esp
+  80041a:	56                   	push   %esi
+  80041b:	ff 75 e4             	push   -0x1c(%ebp)
+  80041e:	57                   	push   %edi
+  80041f:	e8 dc 2d 00 00       	call   803200 <readn>
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	39 c6                	cmp    %eax,%esi
+  800429:	0f 85 62 ff ff ff    	jne    800391 <out_flush+0x36>
+			c->out[0].iov_base = c->obuf;
+  80042f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800432:	89 93 08 08 00 00    	mov    %edx,0x808(%ebx)
+			c->out[0].iov_len = n;
+  800438:	89 b3 0c 08 00 00    	mov    %esi,0x80c(%ebx)
+			c->nout = 1;
+  80043e:	c7 83 20 08 00 00 01 	movl   $0x1,0x820(%ebx)
+  800445:	00 00 00 
+			c->out_off += n;
+  800448:	01 83 30 08 00 00    	add    %eax,0x830(%ebx)
+			if ((r = out_send(c)) != 0)
+  80044e:	89 d8                	mov    %ebx,%eax
+  800450:	e8 01 fd ff ff       	call   800156 <out_send>
+  800455:	85 c0                	test   %eax,%eax
+  800457:	0f 84 6c ff ff ff    	je     8003c9 <out_flush+0x6e>
+}
+  80045d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800460:	5b                   	pop    %ebx
+  800461:	5e                   	pop    %esi
+  800462:	5f                   	pop    %edi
+  800463:	5d                   	pop    %ebp
+  800464:	c3                   	ret
+			return r < 0 ? r : -E_EOF;
+  800465:	ba f8 ff ff ff       	mov    $0xfffffff8,%edx
+  80046a:	0f 49 c2             	cmovns %edx,%eax
+  80046d:	eb ee                	jmp    80045d <out_flush+0x102>
+  80046f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	out_release(c);
+  800472:	89 d8                	mov    %ebx,%eax
+  800474:	e8 3c fe ff ff       	call   8002b5 <out_release>
+	return 0;
+  800479:	89 f0                	mov    %esi,%eax
+  80047b:	eb e0                	jmp    80045d <out_flush+0x102>
+  80047d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  800480:	eb f0                	jmp    800472 <out_flush+0x117>
+			return 1;
+  800482:	b8 01 00 00 00       	mov    $0x1,%eax
+  800487:	eb d4                	jmp    80045d <out_flush+0x102>
+
+00800489 <conn_close>:
+	return 0;
+}
+
+static void
+conn_close(struct conn *c)
+{
+  800489:	55                   	push   %ebp
+  80048a:	89 e5                	mov    %esp,%ebp
+  80048c:	53                   	push   %ebx
+  80048d:	83 ec 04             	sub    $0x4,%esp
+  800490:	89 c3                	mov    %eax,%ebx
+	out_release(c);
+  800492:	e8 1e fe ff ff       	call   8002b5 <out_release>
+	close(c->sock);
+  800497:	83 ec 0c             	sub    $0xc,%esp
+  80049a:	ff 33                	push   (%ebx)
+  80049c:	e8 7c 2b 00 00       	call   80301d <close>
+	conns[c->sock] = 0;
+  8004a1:	8b 03                	mov    (%ebx),%eax
+  8004a3:	c7 04 85 20 a0 80 00 	movl   $0x0,0x80a020(,%eax,4)
+  8004aa:	00 00 00 00 
+	free(c);
+  8004ae:	89 1c 24             	mov    %ebx,(%esp)
+  8004b1:	e8 50 4c 00 00       	call   805106 <free>
+}
+  8004b6:	83 c4 10             	add    $0x10,%esp
+  8004b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004bc:	c9                   	leave
+  8004bd:	c3                   	ret
+
+008004be <out_add>:
+{
+  8004be:	55                   	push   %ebp
+  8004bf:	89 e5                	mov    %esp,%ebp
+  8004c1:	57                   	push   %edi
+  8004c2:	56                   	push   %esi
+  8004c3:	53                   	push   %ebx
+  8004c4:	83 ec 0c             	sub    $0xc,%esp
+  8004c7:	89 c3                	mov    %eax,%ebx
+  8004c9:	89 ce                	mov    %ecx,%esi
+	if (c->obuflen + n > OBUFSIZE)
+  8004cb:	8b 80 24 08 00 00    	mov    0x824(%eax),%eax
+  8004d1:	8d 0c 08             	lea    (%eax,%ecx,1),%ecx
+  8004d4:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8004da:	7f 45                	jg     800521 <out_add+0x63>
+	memmove(c->obuf + c->obuflen, buf, n);
+  8004dc:	8d bb 40 08 00 00    	lea    0x840(%ebx),%edi
+  8004e2:	83 ec 04             	sub    $0x4,%esp
+  8004e5:	56                   	push   %esi
+  8004e6:	52                   	push   %edx
+  8004e7:	01 f8                	add    %edi,%eax
+  8004e9:	50                   	push   %eax
+  8004ea:	e8 c0 19 00 00       	call   801eaf <memmove>
+	c->obuflen += n;
+  8004ef:	03 b3 24 08 00 00    	add    0x824(%ebx),%esi
+  8004f5:	89 b3 24 08 00 00    	mov    %esi,0x824(%ebx)
+	c->out[0].iov_base = c->obuf;
+  8004fb:	89 bb 08 08 00 00    	mov    %edi,0x808(%ebx)
+	c->out[0].iov_len = c->obuflen;
+  800501:	89 b3 0c 08 00 00    	mov    %esi,0x80c(%ebx)
+	c->nout = 1;
+  800507:	c7 83 20 08 00 00 01 	movl   $0x1,0x820(%ebx)
+  80050e:	00 00 00 
+	return 0;
+  800511:	83 c4 10             	add    $0x10,%esp
+  800514:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80051c:	5b                   	pop    %ebx
+  80051d:	5e                   	pop    %esi
+  80051e:	5f                   	pop    %edi
+  80051f:	5d                   	pop    %ebp
+  800520:	c3                   	ret
+		return -1;
+  800521:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800526:	eb f1                	jmp    800519 <out_add+0x5b>
+
+00800528 <conn_open>:
+	conn_input(c);
+}
+
+static struct conn *
+conn_open(int sock)
+{
+  800528:	55                   	push   %ebp
+  800529:	89 e5                	mov    %esp,%ebp
+  80052b:	56                   	push   %esi
+  80052c:	53                   	push   %ebx
+  80052d:	89 c6                	mov    %eax,%esi
+	struct conn *c;
+
+	if (sock >= FD_SETSIZE || !(c = malloc(sizeof(struct conn)))) {
+  80052f:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800534:	7f 3b                	jg     800571 <conn_open+0x49>
+  800536:	83 ec 0c             	sub    $0xc,%esp
+  800539:	68 40 18 00 00       	push   $0x1840
+  80053e:	e8 a1 4b 00 00       	call   8050e4 <malloc>
+  800543:	89 c3                	mov    %eax,%ebx
+  800545:	83 c4 10             	add    $0x10,%esp
+  800548:	85 c0                	test   %eax,%eax
+  80054a:	74 25                	je     800571 <conn_open+0x49>
+		close(sock);
+		return NULL;
+	}
+	memset(c, 0, sizeof(*c));
+  80054c:	83 ec 04             	sub    $0x4,%esp
+  80054f:	68 40 18 00 00       	push   $0x1840
+  800554:	6a 00                	push   $0x0
+  800556:	50                   	push   %eax
+  800557:	e8 1e 19 00 00       	call   801e7a <memset>
+	c->sock = sock;
+  80055c:	89 33                	mov    %esi,(%ebx)
+	conns[sock] = c;
+  80055e:	89 1c b5 20 a0 80 00 	mov    %ebx,0x80a020(,%esi,4)
+	return c;
+  800565:	83 c4 10             	add    $0x10,%esp
+}
+  800568:	89 d8                	mov    %ebx,%eax
+  80056a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80056d:	5b                   	pop    %ebx
+  80056e:	5e                   	pop    %esi
+  80056f:	5d                   	pop    %ebp
+  800570:	c3                   	ret
+		close(sock);
+  800571:	83 ec 0c             	sub    $0xc,%esp
+  800574:	56                   	push   %esi
+  800575:	e8 a3 2a 00 00       	call   80301d <close>
+		return NULL;
+  80057a:	83 c4 10             	add    $0x10,%esp
+  80057d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800582:	eb e4                	jmp    800568 <conn_open+0x40>
+
+00800584 <send_error>:
+{
+  800584:	55                   	push   %ebp
+  800585:	89 e5                	mov    %esp,%ebp
+  800587:	56                   	push   %esi
+  800588:	53                   	push   %ebx
+  800589:	81 ec 80 02 00 00    	sub    $0x280,%esp
+  80058f:	89 c6                	mov    %eax,%esi
+	while (e->code != 0 && e->msg != 0) {
+  800591:	a1 00 80 80 00       	mov    0x808000,%eax
+	struct error_messages *e = errors;
+  800596:	bb 00 80 80 00       	mov    $0x808000,%ebx
+	while (e->code != 0 && e->msg != 0) {
+  80059b:	85 c0                	test   %eax,%eax
+  80059d:	74 1a                	je     8005b9 <send_error+0x35>
+		if (e->code == code)
+  80059f:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8005a3:	74 1b                	je     8005c0 <send_error+0x3c>
+  8005a5:	39 c2                	cmp    %eax,%edx
+  8005a7:	74 17                	je     8005c0 <send_error+0x3c>
+		e++;
+  8005a9:	83 c3 08             	add    $0x8,%ebx
+	while (e->code != 0 && e->msg != 0) {
+  8005ac:	8b 03                	mov    (%ebx),%eax
+  8005ae:	85 c0                	test   %eax,%eax
+  8005b0:	75 ed                	jne    80059f <send_error+0x1b>
+		return -1;
+  8005b2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8005b7:	eb 7b                	jmp    800634 <send_error+0xb0>
+  8005b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8005be:	eb 74                	jmp    800634 <send_error+0xb0>
+	if (e->code == 0)
+  8005c0:	85 c0                	test   %eax,%eax
+  8005c2:	74 77                	je     80063b <send_error+0xb7>
+	r = snprintf(body, 128, "<html><body><p>%d - %s</p></body></html>\r\n",
+  8005c4:	83 ec 0c             	sub    $0xc,%esp
+  8005c7:	ff 73 04             	push   0x4(%ebx)
+  8005ca:	50                   	push   %eax
+  8005cb:	68 ac 69 80 00       	push   $0x8069ac
+  8005d0:	68 80 00 00 00       	push   $0x80
+  8005d5:	8d 85 78 fd ff ff    	lea    -0x288(%ebp),%eax
+  8005db:	50                   	push   %eax
+  8005dc:	e8 b8 16 00 00       	call   801c99 <snprintf>
+  8005e1:	89 c2                	mov    %eax,%edx
+	r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
+  8005e3:	83 c4 20             	add    $0x20,%esp
+  8005e6:	83 7e 0c 00          	cmpl   $0x0,0xc(%esi)
+  8005ea:	b8 6f 68 80 00       	mov    $0x80686f,%eax
+  8005ef:	b9 64 68 80 00       	mov    $0x806864,%ecx
+  8005f4:	0f 45 c1             	cmovne %ecx,%eax
+  8005f7:	8d 8d 78 fd ff ff    	lea    -0x288(%ebp),%ecx
+  8005fd:	51                   	push   %ecx
+  8005fe:	50                   	push   %eax
+  8005ff:	52                   	push   %edx
+  800600:	ff 73 04             	push   0x4(%ebx)
+  800603:	ff 33                	push   (%ebx)
+  800605:	68 d8 69 80 00       	push   $0x8069d8
+  80060a:	68 00 02 00 00       	push   $0x200
+  80060f:	8d 9d f8 fd ff ff    	lea    -0x208(%ebp),%ebx
+  800615:	53                   	push   %ebx
+  800616:	e8 7e 16 00 00       	call   801c99 <snprintf>
+  80061b:	89 c1                	mov    %eax,%ecx
+	if (out_add(req->conn, buf, r) < 0)
+  80061d:	83 c4 20             	add    $0x20,%esp
+  800620:	8b 06                	mov    (%esi),%eax
+  800622:	89 da                	mov    %ebx,%edx
+  800624:	e8 95 fe ff ff       	call   8004be <out_add>
+  800629:	85 c0                	test   %eax,%eax
+  80062b:	78 15                	js     800642 <send_error+0xbe>
+	return out_flush(req->conn);
+  80062d:	8b 06                	mov    (%esi),%eax
+  80062f:	e8 27 fd ff ff       	call   80035b <out_flush>
+}
+  800634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800637:	5b                   	pop    %ebx
+  800638:	5e                   	pop    %esi
+  800639:	5d                   	pop    %ebp
+  80063a:	c3                   	ret
+		return -1;
+  80063b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800640:	eb f2                	jmp    800634 <send_error+0xb0>
+		return -1;
+  800642:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800647:	eb eb                	jmp    800634 <send_error+0xb0>
+
+00800649 <conn_input>:
+{
+  800649:	55                   	push   %ebp
+  80064a:	89 e5                	mov    %esp,%ebp
+  80064c:	57                   	push   %edi
+  80064d:	56                   	push   %esi
+  80064e:	53                   	push   %ebx
+  80064f:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  800655:	89 85 c0 fe ff ff    	mov    %eax,-0x140(%ebp)
+		for (end = c->buf; (end = strchr(end, '\r')); end++)
+  80065b:	83 c0 08             	add    $0x8,%eax
+  80065e:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+  800664:	e9 4a 01 00 00       	jmp    8007b3 <conn_input+0x16a>
+  800669:	83 c3 01             	add    $0x1,%ebx
+  80066c:	83 ec 08             	sub    $0x8,%esp
+  80066f:	6a 0d                	push   $0xd
+  800671:	53                   	push   %ebx
+  800672:	e8 ac 17 00 00       	call   801e23 <strchr>
+  800677:	89 c3                	mov    %eax,%ebx
+  800679:	83 c4 10             	add    $0x10,%esp
+  80067c:	85 c0                	test   %eax,%eax
+  80067e:	0f 84 d6 00 00 00    	je     80075a <conn_input+0x111>
+			if (strncmp(end, "\r\n\r\n", 4) == 0)
+  800684:	83 ec 04             	sub    $0x4,%esp
+  800687:	6a 04                	push   $0x4
+  800689:	68 a1 68 80 00       	push   $0x8068a1
+  80068e:	53                   	push   %ebx
+  80068f:	e8 46 17 00 00       	call   801dda <strncmp>
+  800694:	83 c4 10             	add    $0x10,%esp
+  800697:	85 c0                	test   %eax,%eax
+  800699:	75 ce                	jne    800669 <conn_input+0x20>
+		n = end + 4 - c->buf;
+  80069b:	8d 43 04             	lea    0x4(%ebx),%eax
+  80069e:	89 85 b4 fe ff ff    	mov    %eax,-0x14c(%ebp)
+  8006a4:	8b b5 bc fe ff ff    	mov    -0x144(%ebp),%esi
+  8006aa:	29 f0                	sub    %esi,%eax
+  8006ac:	89 85 b0 fe ff ff    	mov    %eax,-0x150(%ebp)
+		*end = '\0';
+  8006b2:	c6 03 00             	movb   $0x0,(%ebx)
+		memset(req, 0, sizeof(*req));
+  8006b5:	83 ec 04             	sub    $0x4,%esp
+  8006b8:	6a 10                	push   $0x10
+  8006ba:	6a 00                	push   $0x0
+  8006bc:	8d 85 c8 fe ff ff    	lea    -0x138(%ebp),%eax
+  8006c2:	50                   	push   %eax
+  8006c3:	e8 b2 17 00 00       	call   801e7a <memset>
+		req->conn = c;
+  8006c8:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+  8006ce:	89 bd c8 fe ff ff    	mov    %edi,-0x138(%ebp)
+	if (strncmp(request, "GET ", 4) != 0)
+  8006d4:	83 c4 0c             	add    $0xc,%esp
+  8006d7:	6a 04                	push   $0x4
+  8006d9:	68 a6 68 80 00       	push   $0x8068a6
+  8006de:	56                   	push   %esi
+  8006df:	e8 f6 16 00 00       	call   801dda <strncmp>
+  8006e4:	83 c4 10             	add    $0x10,%esp
+  8006e7:	85 c0                	test   %eax,%eax
+  8006e9:	0f 85 b9 09 00 00    	jne    8010a8 <conn_input+0xa5f>
+	request += 4;
+  8006ef:	89 f8                	mov    %edi,%eax
+  8006f1:	8d 7f 0c             	lea    0xc(%edi),%edi
+	while (*request && *request != ' ')
+  8006f4:	f6 40 0c df          	testb  $0xdf,0xc(%eax)
+  8006f8:	0f 84 dd 00 00 00    	je     8007db <conn_input+0x192>
+	request += 4;
+  8006fe:	89 fb                	mov    %edi,%ebx
+		request++;
+  800700:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != ' ')
+  800703:	f6 03 df             	testb  $0xdf,(%ebx)
+  800706:	75 f8                	jne    800700 <conn_input+0xb7>
+	url_len = request - url;
+  800708:	89 de                	mov    %ebx,%esi
+  80070a:	29 fe                	sub    %edi,%esi
+	req->url = malloc(url_len + 1);
+  80070c:	83 ec 0c             	sub    $0xc,%esp
+  80070f:	8d 46 01             	lea    0x1(%esi),%eax
+  800712:	50                   	push   %eax
+  800713:	e8 cc 49 00 00       	call   8050e4 <malloc>
+  800718:	89 85 cc fe ff ff    	mov    %eax,-0x134(%ebp)
+	memmove(req->url, url, url_len);
+  80071e:	83 c4 0c             	add    $0xc,%esp
+  800721:	56                   	push   %esi
+  800722:	57                   	push   %edi
+  800723:	50                   	push   %eax
+  800724:	e8 86 17 00 00       	call   801eaf <memmove>
+	req->url[url_len] = '\0';
+  800729:	8b 85 cc fe ff ff    	mov    -0x134(%ebp),%eax
+  80072f:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+	request++;
+  800733:	8d 73 01             	lea    0x1(%ebx),%esi
+	while (*request && *request != '\r' && *request != '\n')
+  800736:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+  80073a:	83 c4 10             	add    $0x10,%esp
+  80073d:	3c 0d                	cmp    $0xd,%al
+  80073f:	0f 87 9d 00 00 00    	ja     8007e2 <conn_input+0x199>
+  800745:	89 f3                	mov    %esi,%ebx
+  800747:	ba 01 24 00 00       	mov    $0x2401,%edx
+  80074c:	0f a3 c2             	bt     %eax,%edx
+  80074f:	0f 83 8f 00 00 00    	jae    8007e4 <conn_input+0x19b>
+  800755:	e9 9e 00 00 00       	jmp    8007f8 <conn_input+0x1af>
+		if (conn_serve(c) < 0)
+  80075a:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+  800760:	81 78 04 fe 07 00 00 	cmpl   $0x7fe,0x4(%eax)
+  800767:	0f 8f 15 09 00 00    	jg     801082 <conn_input+0xa39>
+		if (c->len >= BUFFSIZE - 1)
+  80076d:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+  800773:	8b 47 04             	mov    0x4(%edi),%eax
+  800776:	3d fe 07 00 00       	cmp    $0x7fe,%eax
+  80077b:	0f 8f 19 09 00 00    	jg     80109a <conn_input+0xa51>
+		n = read(c->sock, c->buf + c->len, BUFFSIZE - 1 - c->len);
+  800781:	83 ec 04             	sub    $0x4,%esp
+  800784:	ba ff 07 00 00       	mov    $0x7ff,%edx
+  800789:	29 c2                	sub    %eax,%edx
+  80078b:	52                   	push   %edx
+  80078c:	8b 95 bc fe ff ff    	mov    -0x144(%ebp),%edx
+  800792:	01 d0                	add    %edx,%eax
+  800794:	50                   	push   %eax
+  800795:	ff 37                	push   (%edi)
+  800797:	e8 c0 29 00 00       	call   80315c <read>
+		if (n == -E_AGAIN)
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8007a2:	0f 84 f9 08 00 00    	je     8010a1 <conn_input+0xa58>
+		if (n <= 0)
+  8007a8:	85 c0                	test   %eax,%eax
+  8007aa:	0f 8e d2 08 00 00    	jle    801082 <conn_input+0xa39>
+		c->len += n;
+  8007b0:	01 47 04             	add    %eax,0x4(%edi)
+	while (!c->blocked) {
+  8007b3:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+  8007b9:	83 b8 3c 08 00 00 00 	cmpl   $0x0,0x83c(%eax)
+  8007c0:	75 ab                	jne    80076d <conn_input+0x124>
+		c->buf[c->len] = '\0';
+  8007c2:	8b 8d c0 fe ff ff    	mov    -0x140(%ebp),%ecx
+  8007c8:	8b 41 04             	mov    0x4(%ecx),%eax
+  8007cb:	c6 44 01 08 00       	movb   $0x0,0x8(%ecx,%eax,1)
+		for (end = c->buf; (end = strchr(end, '\r')); end++)
+  8007d0:	8b 9d bc fe ff ff    	mov    -0x144(%ebp),%ebx
+  8007d6:	e9 91 fe ff ff       	jmp    80066c <conn_input+0x23>
+	request += 4;
+  8007db:	89 fb                	mov    %edi,%ebx
+  8007dd:	e9 26 ff ff ff       	jmp    800708 <conn_input+0xbf>
+	while (*request && *request != '\r' && *request != '\n')
+  8007e2:	89 f3                	mov    %esi,%ebx
+  8007e4:	ba 01 24 00 00       	mov    $0x2401,%edx
+		request++;
+  8007e9:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != '\r' && *request != '\n')
+  8007ec:	0f b6 03             	movzbl (%ebx),%eax
+  8007ef:	3c 0d                	cmp    $0xd,%al
+  8007f1:	77 f6                	ja     8007e9 <conn_input+0x1a0>
+  8007f3:	0f a3 c2             	bt     %eax,%edx
+  8007f6:	73 f1                	jae    8007e9 <conn_input+0x1a0>
+	version_len = request - version;
+  8007f8:	89 df                	mov    %ebx,%edi
+  8007fa:	29 f7                	sub    %esi,%edi
+	req->version = malloc(version_len + 1);
+  8007fc:	83 ec 0c             	sub    $0xc,%esp
+  8007ff:	8d 47 01             	lea    0x1(%edi),%eax
+  800802:	50                   	push   %eax
+  800803:	e8 dc 48 00 00       	call   8050e4 <malloc>
+  800808:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+	memmove(req->version, version, version_len);
+  80080e:	83 c4 0c             	add    $0xc,%esp
+  800811:	57                   	push   %edi
+  800812:	56                   	push   %esi
+  800813:	50                   	push   %eax
+  800814:	e8 96 16 00 00       	call   801eaf <memmove>
+	req->version[version_len] = '\0';
+  800819:	8b 85 d0 fe ff ff    	mov    -0x130(%ebp),%eax
+  80081f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	req->keepalive = strcmp(req->version, "HTTP/1.1") == 0;
+  800823:	83 c4 08             	add    $0x8,%esp
+  800826:	68 ab 68 80 00       	push   $0x8068ab
+  80082b:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+  800831:	e8 79 15 00 00       	call   801daf <strcmp>
+  800836:	83 c4 10             	add    $0x10,%esp
+  800839:	85 c0                	test   %eax,%eax
+  80083b:	0f 94 c0             	sete   %al
+  80083e:	0f b6 c0             	movzbl %al,%eax
+  800841:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	while ((request = strchr(request, '\n')) && *++request) {
+  800847:	eb 0a                	jmp    800853 <conn_input+0x20a>
+				req->keepalive = 0;
+  800849:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+  800850:	00 00 00 
+	while ((request = strchr(request, '\n')) && *++request) {
+  800853:	83 ec 08             	sub    $0x8,%esp
+  800856:	6a 0a                	push   $0xa
+  800858:	53                   	push   %ebx
+  800859:	e8 c5 15 00 00       	call   801e23 <strchr>
+  80085e:	89 c6                	mov    %eax,%esi
+  800860:	83 c4 10             	add    $0x10,%esp
+  800863:	85 c0                	test   %eax,%eax
+  800865:	74 48                	je     8008af <conn_input+0x266>
+  800867:	8d 58 01             	lea    0x1(%eax),%ebx
+  80086a:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80086e:	74 3f                	je     8008af <conn_input+0x266>
+		if (header_is(request, "connection:")) {
+  800870:	ba b4 68 80 00       	mov    $0x8068b4,%edx
+  800875:	89 d8                	mov    %ebx,%eax
+  800877:	e8 b9 f7 ff ff       	call   800035 <header_is>
+  80087c:	85 c0                	test   %eax,%eax
+  80087e:	74 d3                	je     800853 <conn_input+0x20a>
+			if (header_has(request + 11, "close"))
+  800880:	83 c6 0c             	add    $0xc,%esi
+  800883:	ba 6f 68 80 00       	mov    $0x80686f,%edx
+  800888:	89 f0                	mov    %esi,%eax
+  80088a:	e8 05 f8 ff ff       	call   800094 <header_has>
+  80088f:	85 c0                	test   %eax,%eax
+  800891:	75 b6                	jne    800849 <conn_input+0x200>
+			else if (header_has(request + 11, "keep-alive"))
+  800893:	ba 64 68 80 00       	mov    $0x806864,%edx
+  800898:	89 f0                	mov    %esi,%eax
+  80089a:	e8 f5 f7 ff ff       	call   800094 <header_has>
+  80089f:	85 c0                	test   %eax,%eax
+  8008a1:	74 b0                	je     800853 <conn_input+0x20a>
+				req->keepalive = 1;
+  8008a3:	c7 85 d4 fe ff ff 01 	movl   $0x1,-0x12c(%ebp)
+  8008aa:	00 00 00 
+  8008ad:	eb a4                	jmp    800853 <conn_input+0x20a>
+	if (!(e = fcache_get(req->url)))
+  8008af:	8b bd cc fe ff ff    	mov    -0x134(%ebp),%edi
+	struct fcache_entry *e, *victim = NULL;
+  8008b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	for (e = fcache; e < fcache + FCACHE_SIZE; e++) {
+  8008ba:	be 40 a8 80 00       	mov    $0x80a840,%esi
+  8008bf:	eb 42                	jmp    800903 <conn_input+0x2ba>
+		if (e->fd >= 0 && strcmp(e->url, url) == 0) {
+  8008c1:	83 ec 08             	sub    $0x8,%esp
+  8008c4:	57                   	push   %edi
+  8008c5:	56                   	push   %esi
+  8008c6:	e8 e4 14 00 00       	call   801daf <strcmp>
+  8008cb:	83 c4 10             	add    $0x10,%esp
+  8008ce:	85 c0                	test   %eax,%eax
+  8008d0:	75 3a                	jne    80090c <conn_input+0x2c3>
+			e->used = ++fcache_clock;
+  8008d2:	a1 24 a8 80 00       	mov    0x80a824,%eax
+  8008d7:	83 c0 01             	add    $0x1,%eax
+  8008da:	a3 24 a8 80 00       	mov    %eax,0x80a824
+  8008df:	89 86 08 04 00 00    	mov    %eax,0x408(%esi)
+			e->refs++;
+  8008e5:	83 86 0c 04 00 00 01 	addl   $0x1,0x40c(%esi)
+			return e;
+  8008ec:	89 f3                	mov    %esi,%ebx
+  8008ee:	e9 f0 00 00 00       	jmp    8009e3 <conn_input+0x39a>
+  8008f3:	89 f3                	mov    %esi,%ebx
+	for (e = fcache; e < fcache + FCACHE_SIZE; e++) {
+  8008f5:	81 c6 14 04 00 00    	add    $0x414,%esi
+  8008fb:	81 fe 80 e9 80 00    	cmp    $0x80e980,%esi
+  800901:	74 3d                	je     800940 <conn_input+0x2f7>
+		if (e->fd >= 0 && strcmp(e->url, url) == 0) {
+  800903:	83 be 00 04 00 00 00 	cmpl   $0x0,0x400(%esi)
+  80090a:	79 b5                	jns    8008c1 <conn_input+0x278>
+		if (e->refs == 0 && (!victim || e->fd < 0
+  80090c:	83 be 0c 04 00 00 00 	cmpl   $0x0,0x40c(%esi)
+  800913:	75 e0                	jne    8008f5 <conn_input+0x2ac>
+  800915:	85 db                	test   %ebx,%ebx
+  800917:	74 da                	je     8008f3 <conn_input+0x2aa>
+  800919:	83 be 00 04 00 00 00 	cmpl   $0x0,0x400(%esi)
+  800920:	78 1a                	js     80093c <conn_input+0x2f3>
+				     || (victim->fd >= 0 && e->used < victim->used)))
+  800922:	83 bb 00 04 00 00 00 	cmpl   $0x0,0x400(%ebx)
+  800929:	78 ca                	js     8008f5 <conn_input+0x2ac>
+  80092b:	8b 83 08 04 00 00    	mov    0x408(%ebx),%eax
+  800931:	39 86 08 04 00 00    	cmp    %eax,0x408(%esi)
+  800937:	0f 42 de             	cmovb  %esi,%ebx
+  80093a:	eb b9                	jmp    8008f5 <conn_input+0x2ac>
+  80093c:	89 f3                	mov    %esi,%ebx
+  80093e:	eb b5                	jmp    8008f5 <conn_input+0x2ac>
+	if (strlen(url) >= MAXPATHLEN || (fd = open(url, O_RDONLY)) < 0)
+  800940:	83 ec 0c             	sub    $0xc,%esp
+  800943:	57                   	push   %edi
+  800944:	e8 6a 13 00 00       	call   801cb3 <strlen>
+  800949:	83 c4 10             	add    $0x10,%esp
+  80094c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800951:	0f 8f 9f 01 00 00    	jg     800af6 <conn_input+0x4ad>
+  800957:	83 ec 08             	sub    $0x8,%esp
+  80095a:	6a 00                	push   $0x0
+  80095c:	57                   	push   %edi
+  80095d:	e8 f3 2c 00 00       	call   803655 <open>
+  800962:	89 c6                	mov    %eax,%esi
+  800964:	83 c4 10             	add    $0x10,%esp
+  800967:	85 c0                	test   %eax,%eax
+  800969:	0f 88 87 01 00 00    	js     800af6 <conn_input+0x4ad>
+	if (fstat(fd, &stat) < 0 || stat.st_isdir) {
+  80096f:	83 ec 08             	sub    $0x8,%esp
+  800972:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  800978:	50                   	push   %eax
+  800979:	56                   	push   %esi
+  80097a:	e8 8e 2a 00 00       	call   80340d <fstat>
+  80097f:	83 c4 10             	add    $0x10,%esp
+  800982:	85 c0                	test   %eax,%eax
+  800984:	0f 88 60 01 00 00    	js     800aea <conn_input+0x4a1>
+  80098a:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  80098e:	0f 85 56 01 00 00    	jne    800aea <conn_input+0x4a1>
+	if (!victim) {
+  800994:	85 db                	test   %ebx,%ebx
+  800996:	0f 84 71 01 00 00    	je     800b0d <conn_input+0x4c4>
+	} else if (victim->fd >= 0)
+  80099c:	8b 83 00 04 00 00    	mov    0x400(%ebx),%eax
+  8009a2:	85 c0                	test   %eax,%eax
+  8009a4:	0f 89 96 01 00 00    	jns    800b40 <conn_input+0x4f7>
+	strcpy(victim->url, url);
+  8009aa:	83 ec 08             	sub    $0x8,%esp
+  8009ad:	57                   	push   %edi
+  8009ae:	53                   	push   %ebx
+  8009af:	e8 4b 13 00 00       	call   801cff <strcpy>
+	victim->fd = fd;
+  8009b4:	89 b3 00 04 00 00    	mov    %esi,0x400(%ebx)
+	victim->size = stat.st_size;
+  8009ba:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8009bd:	89 83 04 04 00 00    	mov    %eax,0x404(%ebx)
+	victim->used = ++fcache_clock;
+  8009c3:	a1 24 a8 80 00       	mov    0x80a824,%eax
+  8009c8:	83 c0 01             	add    $0x1,%eax
+  8009cb:	a3 24 a8 80 00       	mov    %eax,0x80a824
+  8009d0:	89 83 08 04 00 00    	mov    %eax,0x408(%ebx)
+	victim->refs = 1;
+  8009d6:	c7 83 0c 04 00 00 01 	movl   $0x1,0x40c(%ebx)
+  8009dd:	00 00 00 
+	return victim;
+  8009e0:	83 c4 10             	add    $0x10,%esp
+	if ((r = fstat(e->fd, &st)) < 0) {
+  8009e3:	83 ec 08             	sub    $0x8,%esp
+  8009e6:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8009ec:	50                   	push   %eax
+  8009ed:	ff b3 00 04 00 00    	push   0x400(%ebx)
+  8009f3:	e8 15 2a 00 00       	call   80340d <fstat>
+  8009f8:	83 c4 10             	add    $0x10,%esp
+  8009fb:	85 c0                	test   %eax,%eax
+  8009fd:	0f 88 4e 01 00 00    	js     800b51 <conn_input+0x508>
+	if (rcache_on && st.st_size <= RCACHE_MAX - PGSIZE
+  800a03:	83 3d 20 a8 80 00 00 	cmpl   $0x0,0x80a820
+  800a0a:	74 0d                	je     800a19 <conn_input+0x3d0>
+  800a0c:	81 7d d8 00 f0 00 00 	cmpl   $0xf000,-0x28(%ebp)
+  800a13:	0f 8e 56 01 00 00    	jle    800b6f <conn_input+0x526>
+	while (h->code != 0 && h->header!= 0) {
+  800a19:	a1 10 80 80 00       	mov    0x808010,%eax
+	struct responce_header *h = headers;
+  800a1e:	be 10 80 80 00       	mov    $0x808010,%esi
+	while (h->code != 0 && h->header!= 0) {
+  800a23:	85 c0                	test   %eax,%eax
+  800a25:	0f 84 dd 04 00 00    	je     800f08 <conn_input+0x8bf>
+		if (h->code == code)
+  800a2b:	83 7e 04 00          	cmpl   $0x0,0x4(%esi)
+  800a2f:	0f 84 dd 04 00 00    	je     800f12 <conn_input+0x8c9>
+  800a35:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  800a3a:	0f 84 d2 04 00 00    	je     800f12 <conn_input+0x8c9>
+		h++;
+  800a40:	83 c6 08             	add    $0x8,%esi
+	while (h->code != 0 && h->header!= 0) {
+  800a43:	8b 06                	mov    (%esi),%eax
+  800a45:	85 c0                	test   %eax,%eax
+  800a47:	75 e2                	jne    800a2b <conn_input+0x3e2>
+		return -1;
+  800a49:	be ff ff ff ff       	mov    $0xffffffff,%esi
+		fcache_put(e);
+  800a4e:	89 d8                	mov    %ebx,%eax
+  800a50:	e8 1d f8 ff ff       	call   800272 <fcache_put>
+	free(req->url);
+  800a55:	83 ec 0c             	sub    $0xc,%esp
+  800a58:	ff b5 cc fe ff ff    	push   -0x134(%ebp)
+  800a5e:	e8 a3 46 00 00       	call   805106 <free>
+	free(req->version);
+  800a63:	83 c4 04             	add    $0x4,%esp
+  800a66:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+  800a6c:	e8 95 46 00 00       	call   805106 <free>
+		if (r < 0)
+  800a71:	83 c4 10             	add    $0x10,%esp
+  800a74:	85 f6                	test   %esi,%esi
+  800a76:	0f 88 06 06 00 00    	js     801082 <conn_input+0xa39>
+		c->len -= n;
+  800a7c:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+  800a82:	8b 47 04             	mov    0x4(%edi),%eax
+  800a85:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+  800a8b:	8b 95 b0 fe ff ff    	mov    -0x150(%ebp),%edx
+  800a91:	29 d0                	sub    %edx,%eax
+  800a93:	89 47 04             	mov    %eax,0x4(%edi)
+		memmove(c->buf, c->buf + n, c->len);
+  800a96:	83 ec 04             	sub    $0x4,%esp
+  800a99:	50                   	push   %eax
+  800a9a:	ff b5 b4 fe ff ff    	push   -0x14c(%ebp)
+  800aa0:	ff b5 bc fe ff ff    	push   -0x144(%ebp)
+  800aa6:	e8 04 14 00 00       	call   801eaf <memmove>
+		c->out_close = !req->keepalive;
+  800aab:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+  800ab1:	83 c4 10             	add    $0x10,%esp
+  800ab4:	85 c0                	test   %eax,%eax
+  800ab6:	0f 94 c2             	sete   %dl
+  800ab9:	0f b6 d2             	movzbl %dl,%edx
+  800abc:	89 97 38 08 00 00    	mov    %edx,0x838(%edi)
+		if (r > 0) {
+  800ac2:	85 f6                	test   %esi,%esi
+  800ac4:	0f 8f 97 05 00 00    	jg     801061 <conn_input+0xa18>
+		} else if (c->out_close)
+  800aca:	85 c0                	test   %eax,%eax
+  800acc:	0f 84 b0 05 00 00    	je     801082 <conn_input+0xa39>
+	while (!c->blocked) {
+  800ad2:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+  800ad8:	83 b8 3c 08 00 00 00 	cmpl   $0x0,0x83c(%eax)
+  800adf:	0f 84 dd fc ff ff    	je     8007c2 <conn_input+0x179>
+  800ae5:	e9 83 fc ff ff       	jmp    80076d <conn_input+0x124>
+		close(fd);
+  800aea:	83 ec 0c             	sub    $0xc,%esp
+  800aed:	56                   	push   %esi
+  800aee:	e8 2a 25 00 00       	call   80301d <close>
+		return NULL;
+  800af3:	83 c4 10             	add    $0x10,%esp
+		return send_error(req, 404);
+  800af6:	ba 94 01 00 00       	mov    $0x194,%edx
+  800afb:	8d 85 c8 fe ff ff    	lea    -0x138(%ebp),%eax
+  800b01:	e8 7e fa ff ff       	call   800584 <send_error>
+  800b06:	89 c6                	mov    %eax,%esi
+  800b08:	e9 48 ff ff ff       	jmp    800a55 <conn_input+0x40c>
+		if (!(victim = malloc(sizeof(*victim)))) {
+  800b0d:	83 ec 0c             	sub    $0xc,%esp
+  800b10:	68 14 04 00 00       	push   $0x414
+  800b15:	e8 ca 45 00 00       	call   8050e4 <malloc>
+  800b1a:	89 c3                	mov    %eax,%ebx
+  800b1c:	83 c4 10             	add    $0x10,%esp
+  800b1f:	85 c0                	test   %eax,%eax
+  800b21:	74 0f                	je     800b32 <conn_input+0x4e9>
+		victim->spill = 1;
+  800b23:	c7 80 10 04 00 00 01 	movl   $0x1,0x410(%eax)
+  800b2a:	00 00 00 
+  800b2d:	e9 78 fe ff ff       	jmp    8009aa <conn_input+0x361>
+			close(fd);
+  800b32:	83 ec 0c             	sub    $0xc,%esp
+  800b35:	56                   	push   %esi
+  800b36:	e8 e2 24 00 00       	call   80301d <close>
+			return NULL;
+  800b3b:	83 c4 10             	add    $0x10,%esp
+  800b3e:	eb b6                	jmp    800af6 <conn_input+0x4ad>
+		close(victim->fd);
+  800b40:	83 ec 0c             	sub    $0xc,%esp
+  800b43:	50                   	push   %eax
+  800b44:	e8 d4 24 00 00       	call   80301d <close>
+  800b49:	83 c4 10             	add    $0x10,%esp
+  800b4c:	e9 59 fe ff ff       	jmp    8009aa <conn_input+0x361>
+		fcache_put(e);
+  800b51:	89 d8                	mov    %ebx,%eax
+  800b53:	e8 1a f7 ff ff       	call   800272 <fcache_put>
+		return send_error(req, 404);
+  800b58:	ba 94 01 00 00       	mov    $0x194,%edx
+  800b5d:	8d 85 c8 fe ff ff    	lea    -0x138(%ebp),%eax
+  800b63:	e8 1c fa ff ff       	call   800584 <send_error>
+  800b68:	89 c6                	mov    %eax,%esi
+  800b6a:	e9 e6 fe ff ff       	jmp    800a55 <conn_input+0x40c>
+	    && (r = send_cached(req, e->fd, &st)) != -E_NO_MEM) {
+  800b6f:	8b 83 00 04 00 00    	mov    0x400(%ebx),%eax
+  800b75:	89 85 ac fe ff ff    	mov    %eax,-0x154(%ebp)
+	struct conn *c = req->conn;
+  800b7b:	8b bd c8 fe ff ff    	mov    -0x138(%ebp),%edi
+	if (strlen(req->url) >= RCACHE_URLLEN)
+  800b81:	83 ec 0c             	sub    $0xc,%esp
+  800b84:	ff b5 cc fe ff ff    	push   -0x134(%ebp)
+  800b8a:	e8 24 11 00 00       	call   801cb3 <strlen>
+  800b8f:	83 c4 10             	add    $0x10,%esp
+  800b92:	83 f8 3f             	cmp    $0x3f,%eax
+  800b95:	0f 8f 7e fe ff ff    	jg     800a19 <conn_input+0x3d0>
+	if (!(e = rcache_lookup(req->url, st))
+  800b9b:	8b b5 cc fe ff ff    	mov    -0x134(%ebp),%esi
+	rcache_lock();
+  800ba1:	e8 98 f6 ff ff       	call   80023e <rcache_lock>
+	for (e = rcache->ents; e < rcache->ents + RCACHE_NENT; e++) {
+  800ba6:	b8 10 00 00 c0       	mov    $0xc0000010,%eax
+  800bab:	89 9d c4 fe ff ff    	mov    %ebx,-0x13c(%ebp)
+  800bb1:	89 c3                	mov    %eax,%ebx
+  800bb3:	eb 0b                	jmp    800bc0 <conn_input+0x577>
+  800bb5:	83 c3 60             	add    $0x60,%ebx
+  800bb8:	81 fb 10 18 00 c0    	cmp    $0xc0001810,%ebx
+  800bbe:	74 6c                	je     800c2c <conn_input+0x5e3>
+		if (e->page < 0 || strcmp(e->url, url) != 0)
+  800bc0:	83 7b 48 00          	cmpl   $0x0,0x48(%ebx)
+  800bc4:	78 ef                	js     800bb5 <conn_input+0x56c>
+  800bc6:	83 ec 08             	sub    $0x8,%esp
+  800bc9:	56                   	push   %esi
+  800bca:	53                   	push   %ebx
+  800bcb:	e8 df 11 00 00       	call   801daf <strcmp>
+  800bd0:	83 c4 10             	add    $0x10,%esp
+  800bd3:	85 c0                	test   %eax,%eax
+  800bd5:	75 de                	jne    800bb5 <conn_input+0x56c>
+		if (e->version != st->st_version || e->size != st->st_size) {
+  800bd7:	89 d8                	mov    %ebx,%eax
+  800bd9:	89 9d b8 fe ff ff    	mov    %ebx,-0x148(%ebp)
+  800bdf:	8b 9d c4 fe ff ff    	mov    -0x13c(%ebp),%ebx
+  800be5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800be8:	39 50 40             	cmp    %edx,0x40(%eax)
+  800beb:	75 08                	jne    800bf5 <conn_input+0x5ac>
+  800bed:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800bf0:	39 50 44             	cmp    %edx,0x44(%eax)
+  800bf3:	74 3f                	je     800c34 <conn_input+0x5eb>
+			e->url[0] = '\0';
+  800bf5:	8b 85 b8 fe ff ff    	mov    -0x148(%ebp),%eax
+  800bfb:	c6 00 00             	movb   $0x0,(%eax)
+	rcache->misses++;
+  800bfe:	83 05 0c 00 00 c0 01 	addl   $0x1,0xc000000c
+	rcache_unlock();
+  800c05:	e8 da f4 ff ff       	call   8000e4 <rcache_unlock>
+	    && !(e = rcache_fill(req->url, fd, st)))
+  800c0a:	8b 85 cc fe ff ff    	mov    -0x134(%ebp),%eax
+  800c10:	89 85 a4 fe ff ff    	mov    %eax,-0x15c(%ebp)
+	rcache_lock();
+  800c16:	e8 23 f6 ff ff       	call   80023e <rcache_lock>
+  800c1b:	89 9d a8 fe ff ff    	mov    %ebx,-0x158(%ebp)
+  800c21:	89 bd a0 fe ff ff    	mov    %edi,-0x160(%ebp)
+  800c27:	e9 6c 01 00 00       	jmp    800d98 <conn_input+0x74f>
+  800c2c:	8b 9d c4 fe ff ff    	mov    -0x13c(%ebp),%ebx
+  800c32:	eb ca                	jmp    800bfe <conn_input+0x5b5>
+		e->refs++;
+  800c34:	8b 95 b8 fe ff ff    	mov    -0x148(%ebp),%edx
+  800c3a:	83 42 58 01          	addl   $0x1,0x58(%edx)
+		e->used = ++rcache->clock;
+  800c3e:	a1 04 00 00 c0       	mov    0xc0000004,%eax
+  800c43:	83 c0 01             	add    $0x1,%eax
+  800c46:	a3 04 00 00 c0       	mov    %eax,0xc0000004
+  800c4b:	89 42 5c             	mov    %eax,0x5c(%edx)
+		rcache->hits++;
+  800c4e:	83 05 08 00 00 c0 01 	addl   $0x1,0xc0000008
+		rcache_unlock();
+  800c55:	e8 8a f4 ff ff       	call   8000e4 <rcache_unlock>
+	p = rcache_pool + e->page * PGSIZE;
+  800c5a:	8b 8d b8 fe ff ff    	mov    -0x148(%ebp),%ecx
+  800c60:	8b 41 48             	mov    0x48(%ecx),%eax
+  800c63:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+  800c69:	c1 e0 0c             	shl    $0xc,%eax
+  800c6c:	8d b0 00 20 00 c0    	lea    -0x3fffe000(%eax),%esi
+	c->out[0].iov_base = p;
+  800c72:	89 b7 08 08 00 00    	mov    %esi,0x808(%edi)
+	c->out[0].iov_len = e->hdrlen;
+  800c78:	8b 41 50             	mov    0x50(%ecx),%eax
+  800c7b:	89 87 0c 08 00 00    	mov    %eax,0x80c(%edi)
+					    : "Connection: close\r\n\r\n";
+  800c81:	83 bd d4 fe ff ff 00 	cmpl   $0x0,-0x12c(%ebp)
+  800c88:	b8 90 68 80 00       	mov    $0x806890,%eax
+  800c8d:	ba 75 68 80 00       	mov    $0x806875,%edx
+  800c92:	0f 45 c2             	cmovne %edx,%eax
+	c->out[1].iov_base = req->keepalive ? "Connection: keep-alive\r\n\r\n"
+  800c95:	89 87 10 08 00 00    	mov    %eax,0x810(%edi)
+	c->out[1].iov_len = strlen(c->out[1].iov_base);
+  800c9b:	83 ec 0c             	sub    $0xc,%esp
+  800c9e:	50                   	push   %eax
+  800c9f:	e8 0f 10 00 00       	call   801cb3 <strlen>
+  800ca4:	89 87 14 08 00 00    	mov    %eax,0x814(%edi)
+	c->out[2].iov_base = p + e->hdrlen;
+  800caa:	8b 8d b8 fe ff ff    	mov    -0x148(%ebp),%ecx
+  800cb0:	03 71 50             	add    0x50(%ecx),%esi
+  800cb3:	89 b7 18 08 00 00    	mov    %esi,0x818(%edi)
+	c->out[2].iov_len = e->len - e->hdrlen;
+  800cb9:	8b 41 54             	mov    0x54(%ecx),%eax
+  800cbc:	2b 41 50             	sub    0x50(%ecx),%eax
+  800cbf:	89 87 1c 08 00 00    	mov    %eax,0x81c(%edi)
+	c->nout = 3;
+  800cc5:	c7 87 20 08 00 00 03 	movl   $0x3,0x820(%edi)
+  800ccc:	00 00 00 
+	c->out_cached = e;
+  800ccf:	89 8f 28 08 00 00    	mov    %ecx,0x828(%edi)
+	return out_flush(c);
+  800cd5:	89 f8                	mov    %edi,%eax
+  800cd7:	e8 7f f6 ff ff       	call   80035b <out_flush>
+  800cdc:	89 c6                	mov    %eax,%esi
+	    && (r = send_cached(req, e->fd, &st)) != -E_NO_MEM) {
+  800cde:	83 c4 10             	add    $0x10,%esp
+  800ce1:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800ce4:	0f 84 2f fd ff ff    	je     800a19 <conn_input+0x3d0>
+		fcache_put(e);
+  800cea:	89 d8                	mov    %ebx,%eax
+  800cec:	e8 81 f5 ff ff       	call   800272 <fcache_put>
+		return r;
+  800cf1:	e9 5f fd ff ff       	jmp    800a55 <conn_input+0x40c>
+			if (page < 0 && rcache_free_run(e->page + e->npages, npages))
+  800cf6:	03 7b 4c             	add    0x4c(%ebx),%edi
+  800cf9:	ba 10 00 00 00       	mov    $0x10,%edx
+  800cfe:	89 f8                	mov    %edi,%eax
+  800d00:	e8 ec f3 ff ff       	call   8000f1 <rcache_free_run>
+				page = e->page + e->npages;
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	0f 45 f7             	cmovne %edi,%esi
+  800d0a:	eb 29                	jmp    800d35 <conn_input+0x6ec>
+			    || (!e->url[0] == !victim->url[0]
+  800d0c:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+  800d12:	80 38 00             	cmpb   $0x0,(%eax)
+  800d15:	74 08                	je     800d1f <conn_input+0x6d6>
+  800d17:	eb 36                	jmp    800d4f <conn_input+0x706>
+  800d19:	89 9d b8 fe ff ff    	mov    %ebx,-0x148(%ebp)
+		for (e = rcache->ents; e < rcache->ents + RCACHE_NENT; e++) {
+  800d1f:	83 c3 60             	add    $0x60,%ebx
+  800d22:	81 fb 10 18 00 c0    	cmp    $0xc0001810,%ebx
+  800d28:	74 4c                	je     800d76 <conn_input+0x72d>
+			if (e->page < 0) {
+  800d2a:	8b 7b 48             	mov    0x48(%ebx),%edi
+  800d2d:	85 ff                	test   %edi,%edi
+  800d2f:	78 e8                	js     800d19 <conn_input+0x6d0>
+			if (page < 0 && rcache_free_run(e->page + e->npages, npages))
+  800d31:	85 f6                	test   %esi,%esi
+  800d33:	78 c1                	js     800cf6 <conn_input+0x6ad>
+			if (e->refs > 0)
+  800d35:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+  800d39:	7f e4                	jg     800d1f <conn_input+0x6d6>
+			if (!victim || (!e->url[0] && victim->url[0])
+  800d3b:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+  800d41:	85 c0                	test   %eax,%eax
+  800d43:	74 21                	je     800d66 <conn_input+0x71d>
+  800d45:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800d48:	75 c2                	jne    800d0c <conn_input+0x6c3>
+  800d4a:	80 38 00             	cmpb   $0x0,(%eax)
+  800d4d:	75 1f                	jne    800d6e <conn_input+0x725>
+  800d4f:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+  800d55:	8b 50 5c             	mov    0x5c(%eax),%edx
+  800d58:	39 53 5c             	cmp    %edx,0x5c(%ebx)
+  800d5b:	0f 42 c3             	cmovb  %ebx,%eax
+  800d5e:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+  800d64:	eb b9                	jmp    800d1f <conn_input+0x6d6>
+  800d66:	89 9d c4 fe ff ff    	mov    %ebx,-0x13c(%ebp)
+  800d6c:	eb b1                	jmp    800d1f <conn_input+0x6d6>
+  800d6e:	89 9d c4 fe ff ff    	mov    %ebx,-0x13c(%ebp)
+  800d74:	eb a9                	jmp    800d1f <conn_input+0x6d6>
+		if (slot && page >= 0) {
+  800d76:	83 bd b8 fe ff ff 00 	cmpl   $0x0,-0x148(%ebp)
+  800d7d:	74 04                	je     800d83 <conn_input+0x73a>
+  800d7f:	85 f6                	test   %esi,%esi
+  800d81:	79 47                	jns    800dca <conn_input+0x781>
+		if (!victim)
+  800d83:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	0f 84 44 01 00 00    	je     800ed5 <conn_input+0x88c>
+		victim->page = -1;
+  800d91:	c7 40 48 ff ff ff ff 	movl   $0xffffffff,0x48(%eax)
+		page = rcache_free_run(0, npages) ? 0 : -1;
+  800d98:	ba 10 00 00 00       	mov    $0x10,%edx
+  800d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da2:	e8 4a f3 ff ff       	call   8000f1 <rcache_free_run>
+  800da7:	83 f8 01             	cmp    $0x1,%eax
+  800daa:	19 f6                	sbb    %esi,%esi
+  800dac:	c7 85 b8 fe ff ff 00 	movl   $0x0,-0x148(%ebp)
+  800db3:	00 00 00 
+  800db6:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+  800dbd:	00 00 00 
+  800dc0:	bb 10 00 00 c0       	mov    $0xc0000010,%ebx
+  800dc5:	e9 60 ff ff ff       	jmp    800d2a <conn_input+0x6e1>
+			slot->page = page;
+  800dca:	8b 9d a8 fe ff ff    	mov    -0x158(%ebp),%ebx
+  800dd0:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+  800dd6:	8b 85 b8 fe ff ff    	mov    -0x148(%ebp),%eax
+  800ddc:	89 70 48             	mov    %esi,0x48(%eax)
+			slot->npages = npages;
+  800ddf:	c7 40 4c 10 00 00 00 	movl   $0x10,0x4c(%eax)
+		e->url[0] = '\0';
+  800de6:	89 c6                	mov    %eax,%esi
+  800de8:	c6 00 00             	movb   $0x0,(%eax)
+		e->refs = 1;
+  800deb:	c7 40 58 01 00 00 00 	movl   $0x1,0x58(%eax)
+	rcache_unlock();
+  800df2:	e8 ed f2 ff ff       	call   8000e4 <rcache_unlock>
+	p = rcache_pool + e->page * PGSIZE;
+  800df7:	8b 46 48             	mov    0x48(%esi),%eax
+  800dfa:	c1 e0 0c             	shl    $0xc,%eax
+  800dfd:	2d 00 e0 ff 3f       	sub    $0x3fffe000,%eax
+  800e02:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+	hdrlen = snprintf(p, RCACHE_MAX, "%sContent-Length: %ld\r\n"
+  800e08:	83 ec 08             	sub    $0x8,%esp
+  800e0b:	68 c0 68 80 00       	push   $0x8068c0
+  800e10:	ff 75 d8             	push   -0x28(%ebp)
+  800e13:	ff 35 14 80 80 00    	push   0x808014
+  800e19:	68 40 6a 80 00       	push   $0x806a40
+  800e1e:	68 00 00 01 00       	push   $0x10000
+  800e23:	50                   	push   %eax
+  800e24:	e8 70 0e 00 00       	call   801c99 <snprintf>
+  800e29:	89 c6                	mov    %eax,%esi
+	if (hdrlen + st->st_size > RCACHE_MAX
+  800e2b:	03 45 d8             	add    -0x28(%ebp),%eax
+  800e2e:	83 c4 20             	add    $0x20,%esp
+  800e31:	3d 00 00 01 00       	cmp    $0x10000,%eax
+  800e36:	0f 8f a9 00 00 00    	jg     800ee5 <conn_input+0x89c>
+	    || (r = seek(fd, 0)) < 0
+  800e3c:	83 ec 08             	sub    $0x8,%esp
+  800e3f:	6a 00                	push   $0x0
+  800e41:	ff b5 ac fe ff ff    	push   -0x154(%ebp)
+  800e47:	e8 a7 24 00 00       	call   8032f3 <seek>
+  800e4c:	83 c4 10             	add    $0x10,%esp
+  800e4f:	85 c0                	test   %eax,%eax
+  800e51:	0f 88 8e 00 00 00    	js     800ee5 <conn_input+0x89c>
+	    || (r = readn(fd, p + hdrlen, st->st_size)) != st->st_size) {
+  800e57:	83 ec 04             	sub    $0x4,%esp
+  800e5a:	ff 75 d8             	push   -0x28(%ebp)
+  800e5d:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+  800e63:	01 f0                	add    %esi,%eax
+  800e65:	50                   	push   %eax
+  800e66:	ff b5 ac fe ff ff    	push   -0x154(%ebp)
+  800e6c:	e8 8f 23 00 00       	call   803200 <readn>
+  800e71:	83 c4 10             	add    $0x10,%esp
+  800e74:	3b 45 d8             	cmp    -0x28(%ebp),%eax
+  800e77:	75 6c                	jne    800ee5 <conn_input+0x89c>
+	rcache_lock();
+  800e79:	e8 c0 f3 ff ff       	call   80023e <rcache_lock>
+	strcpy(e->url, url);
+  800e7e:	83 ec 08             	sub    $0x8,%esp
+  800e81:	ff b5 a4 fe ff ff    	push   -0x15c(%ebp)
+  800e87:	ff b5 b8 fe ff ff    	push   -0x148(%ebp)
+  800e8d:	e8 6d 0e 00 00       	call   801cff <strcpy>
+	e->version = st->st_version;
+  800e92:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e95:	8b 8d b8 fe ff ff    	mov    -0x148(%ebp),%ecx
+  800e9b:	89 41 40             	mov    %eax,0x40(%ecx)
+	e->size = st->st_size;
+  800e9e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800ea1:	89 41 44             	mov    %eax,0x44(%ecx)
+	e->npages = ROUNDUP(hdrlen + st->st_size, PGSIZE) / PGSIZE;
+  800ea4:	01 f0                	add    %esi,%eax
+  800ea6:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800eac:	c1 fa 0c             	sar    $0xc,%edx
+  800eaf:	89 51 4c             	mov    %edx,0x4c(%ecx)
+	e->hdrlen = hdrlen;
+  800eb2:	89 71 50             	mov    %esi,0x50(%ecx)
+	e->len = hdrlen + st->st_size;
+  800eb5:	89 41 54             	mov    %eax,0x54(%ecx)
+	e->used = ++rcache->clock;
+  800eb8:	a1 04 00 00 c0       	mov    0xc0000004,%eax
+  800ebd:	83 c0 01             	add    $0x1,%eax
+  800ec0:	a3 04 00 00 c0       	mov    %eax,0xc0000004
+  800ec5:	89 41 5c             	mov    %eax,0x5c(%ecx)
+	rcache_unlock();
+  800ec8:	e8 17 f2 ff ff       	call   8000e4 <rcache_unlock>
+  800ecd:	83 c4 10             	add    $0x10,%esp
+  800ed0:	e9 85 fd ff ff       	jmp    800c5a <conn_input+0x611>
+	rcache_unlock();
+  800ed5:	8b 9d a8 fe ff ff    	mov    -0x158(%ebp),%ebx
+  800edb:	e8 04 f2 ff ff       	call   8000e4 <rcache_unlock>
+		return NULL;
+  800ee0:	e9 34 fb ff ff       	jmp    800a19 <conn_input+0x3d0>
+		rcache_lock();
+  800ee5:	e8 54 f3 ff ff       	call   80023e <rcache_lock>
+		e->refs = 0;
+  800eea:	8b 85 b8 fe ff ff    	mov    -0x148(%ebp),%eax
+  800ef0:	c7 40 58 00 00 00 00 	movl   $0x0,0x58(%eax)
+		e->page = -1;
+  800ef7:	c7 40 48 ff ff ff ff 	movl   $0xffffffff,0x48(%eax)
+		rcache_unlock();
+  800efe:	e8 e1 f1 ff ff       	call   8000e4 <rcache_unlock>
+		return NULL;
+  800f03:	e9 11 fb ff ff       	jmp    800a19 <conn_input+0x3d0>
+		return -1;
+  800f08:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800f0d:	e9 3c fb ff ff       	jmp    800a4e <conn_input+0x405>
+	if (h->code == 0)
+  800f12:	85 c0                	test   %eax,%eax
+  800f14:	0f 84 3d 01 00 00    	je     801057 <conn_input+0xa0e>
+	return out_add(req->conn, h->header, strlen(h->header));
+  800f1a:	83 ec 0c             	sub    $0xc,%esp
+  800f1d:	ff 76 04             	push   0x4(%esi)
+  800f20:	e8 8e 0d 00 00       	call   801cb3 <strlen>
+  800f25:	89 c1                	mov    %eax,%ecx
+  800f27:	8b 56 04             	mov    0x4(%esi),%edx
+  800f2a:	8b 85 c8 fe ff ff    	mov    -0x138(%ebp),%eax
+  800f30:	e8 89 f5 ff ff       	call   8004be <out_add>
+  800f35:	89 c6                	mov    %eax,%esi
+	if ((r = send_header(req, 200)) < 0
+  800f37:	83 c4 10             	add    $0x10,%esp
+  800f3a:	85 c0                	test   %eax,%eax
+  800f3c:	0f 88 0c fb ff ff    	js     800a4e <conn_input+0x405>
+	r = snprintf(buf, 64, "Content-Length: %ld\r\n", (long)size);
+  800f42:	ff 75 d8             	push   -0x28(%ebp)
+  800f45:	68 ca 68 80 00       	push   $0x8068ca
+  800f4a:	6a 40                	push   $0x40
+  800f4c:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+  800f52:	50                   	push   %eax
+  800f53:	e8 41 0d 00 00       	call   801c99 <snprintf>
+  800f58:	89 c1                	mov    %eax,%ecx
+	if (r > 63)
+  800f5a:	83 c4 10             	add    $0x10,%esp
+  800f5d:	83 f8 3f             	cmp    $0x3f,%eax
+  800f60:	0f 8f c3 00 00 00    	jg     801029 <conn_input+0x9e0>
+	return out_add(req->conn, buf, r);
+  800f66:	8d 95 d8 fe ff ff    	lea    -0x128(%ebp),%edx
+  800f6c:	8b 85 c8 fe ff ff    	mov    -0x138(%ebp),%eax
+  800f72:	e8 47 f5 ff ff       	call   8004be <out_add>
+  800f77:	89 c6                	mov    %eax,%esi
+	    || (r = send_size(req, st.st_size)) < 0
+  800f79:	85 c0                	test   %eax,%eax
+  800f7b:	0f 88 cd fa ff ff    	js     800a4e <conn_input+0x405>
+	r = snprintf(buf, 128, "Content-Type: %s\r\n", type);
+  800f81:	68 c0 68 80 00       	push   $0x8068c0
+  800f86:	68 ff 68 80 00       	push   $0x8068ff
+  800f8b:	68 80 00 00 00       	push   $0x80
+  800f90:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+  800f96:	50                   	push   %eax
+  800f97:	e8 fd 0c 00 00       	call   801c99 <snprintf>
+  800f9c:	89 c1                	mov    %eax,%ecx
+	if (r > 127)
+  800f9e:	83 c4 10             	add    $0x10,%esp
+  800fa1:	83 f8 7f             	cmp    $0x7f,%eax
+  800fa4:	0f 8f 96 00 00 00    	jg     801040 <conn_input+0x9f7>
+	return out_add(req->conn, buf, r);
+  800faa:	8d 95 d8 fe ff ff    	lea    -0x128(%ebp),%edx
+  800fb0:	8b 85 c8 fe ff ff    	mov    -0x138(%ebp),%eax
+  800fb6:	e8 03 f5 ff ff       	call   8004be <out_add>
+  800fbb:	89 c6                	mov    %eax,%esi
+	    || (r = send_content_type(req)) < 0
+  800fbd:	85 c0                	test   %eax,%eax
+  800fbf:	0f 88 89 fa ff ff    	js     800a4e <conn_input+0x405>
+					 : "Connection: close\r\n\r\n";
+  800fc5:	83 bd d4 fe ff ff 00 	cmpl   $0x0,-0x12c(%ebp)
+  800fcc:	be 90 68 80 00       	mov    $0x806890,%esi
+  800fd1:	b8 75 68 80 00       	mov    $0x806875,%eax
+  800fd6:	0f 45 f0             	cmovne %eax,%esi
+	return out_add(req->conn, fin, strlen(fin));
+  800fd9:	83 ec 0c             	sub    $0xc,%esp
+  800fdc:	56                   	push   %esi
+  800fdd:	e8 d1 0c 00 00       	call   801cb3 <strlen>
+  800fe2:	89 c1                	mov    %eax,%ecx
+  800fe4:	89 f2                	mov    %esi,%edx
+  800fe6:	8b 85 c8 fe ff ff    	mov    -0x138(%ebp),%eax
+  800fec:	e8 cd f4 ff ff       	call   8004be <out_add>
+  800ff1:	89 c6                	mov    %eax,%esi
+	    || (r = send_header_fin(req)) < 0) {
+  800ff3:	83 c4 10             	add    $0x10,%esp
+  800ff6:	85 c0                	test   %eax,%eax
+  800ff8:	0f 88 50 fa ff ff    	js     800a4e <conn_input+0x405>
+	req->conn->out_file = e;
+  800ffe:	8b 85 c8 fe ff ff    	mov    -0x138(%ebp),%eax
+  801004:	89 98 2c 08 00 00    	mov    %ebx,0x82c(%eax)
+	req->conn->out_off = 0;
+  80100a:	c7 80 30 08 00 00 00 	movl   $0x0,0x830(%eax)
+  801011:	00 00 00 
+	req->conn->out_end = st.st_size;
+  801014:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801017:	89 90 34 08 00 00    	mov    %edx,0x834(%eax)
+	return out_flush(req->conn);
+  80101d:	e8 39 f3 ff ff       	call   80035b <out_flush>
+  801022:	89 c6                	mov    %eax,%esi
+  801024:	e9 2c fa ff ff       	jmp    800a55 <conn_input+0x40c>
+		panic("buffer too small!");
+  801029:	83 ec 04             	sub    $0x4,%esp
+  80102c:	68 e0 68 80 00       	push   $0x8068e0
+  801031:	68 17 01 00 00       	push   $0x117
+  801036:	68 f2 68 80 00       	push   $0x8068f2
+  80103b:	e8 ed 04 00 00       	call   80152d <_panic>
+		panic("buffer too small!");
+  801040:	83 ec 04             	sub    $0x4,%esp
+  801043:	68 e0 68 80 00       	push   $0x8068e0
+  801048:	68 30 01 00 00       	push   $0x130
+  80104d:	68 f2 68 80 00       	push   $0x8068f2
+  801052:	e8 d6 04 00 00       	call   80152d <_panic>
+		return -1;
+  801057:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80105c:	e9 ed f9 ff ff       	jmp    800a4e <conn_input+0x405>
+			c->blocked = 1;
+  801061:	c7 87 3c 08 00 00 01 	movl   $0x1,0x83c(%edi)
+  801068:	00 00 00 
+			if (evctl(c->sock, POLLIN | POLLOUT) < 0)
+  80106b:	83 ec 08             	sub    $0x8,%esp
+  80106e:	6a 05                	push   $0x5
+  801070:	ff 37                	push   (%edi)
+  801072:	e8 b9 2a 00 00       	call   803b30 <evctl>
+  801077:	83 c4 10             	add    $0x10,%esp
+  80107a:	85 c0                	test   %eax,%eax
+  80107c:	0f 89 50 fa ff ff    	jns    800ad2 <conn_input+0x489>
+	conn_close(c);
+  801082:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+  801088:	e8 fc f3 ff ff       	call   800489 <conn_close>
+	return -1;
+  80108d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  801092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801095:	5b                   	pop    %ebx
+  801096:	5e                   	pop    %esi
+  801097:	5f                   	pop    %edi
+  801098:	5d                   	pop    %ebp
+  801099:	c3                   	ret
+			return 0;
+  80109a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109f:	eb f1                	jmp    801092 <conn_input+0xa49>
+			return 0;
+  8010a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a6:	eb ea                	jmp    801092 <conn_input+0xa49>
+			r = send_error(req, 400);
+  8010a8:	ba 90 01 00 00       	mov    $0x190,%edx
+  8010ad:	8d 85 c8 fe ff ff    	lea    -0x138(%ebp),%eax
+  8010b3:	e8 cc f4 ff ff       	call   800584 <send_error>
+  8010b8:	89 c6                	mov    %eax,%esi
+  8010ba:	e9 96 f9 ff ff       	jmp    800a55 <conn_input+0x40c>
+
+008010bf <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	57                   	push   %edi
+  8010c3:	56                   	push   %esi
+  8010c4:	53                   	push   %ebx
+  8010c5:	83 ec 70             	sub    $0x70,%esp
+	struct sockaddr_in server, client;
+	struct Argstate args;
+	bool serial = 0;
+	int workers = 1;
+
+	binaryname = "jhttpd";
+  8010c8:	c7 05 20 80 80 00 12 	movl   $0x806912,0x808020
+  8010cf:	69 80 00 
+	argstart(&argc, argv, &args);
+  8010d2:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  8010d5:	50                   	push   %eax
+  8010d6:	ff 75 0c             	push   0xc(%ebp)
+  8010d9:	8d 45 08             	lea    0x8(%ebp),%eax
+  8010dc:	50                   	push   %eax
+  8010dd:	e8 30 1c 00 00       	call   802d12 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  8010e2:	83 c4 10             	add    $0x10,%esp
+	int workers = 1;
+  8010e5:	bb 01 00 00 00       	mov    $0x1,%ebx
+	bool serial = 0;
+  8010ea:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+	while ((i = argnext(&args)) >= 0)
+  8010f1:	8d 75 b8             	lea    -0x48(%ebp),%esi
+		switch (i) {
+  8010f4:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  8010f9:	eb 06                	jmp    801101 <umain+0x42>
+		case 's':
+			serial = 1;
+			break;
+		case 'c':
+			copy_data = 1;
+  8010fb:	89 3d 00 90 80 00    	mov    %edi,0x809000
+	while ((i = argnext(&args)) >= 0)
+  801101:	83 ec 0c             	sub    $0xc,%esp
+  801104:	56                   	push   %esi
+  801105:	e8 38 1c 00 00       	call   802d42 <argnext>
+  80110a:	83 c4 10             	add    $0x10,%esp
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	78 7f                	js     801190 <umain+0xd1>
+		switch (i) {
+  801111:	83 f8 73             	cmp    $0x73,%eax
+  801114:	74 72                	je     801188 <umain+0xc9>
+  801116:	83 f8 77             	cmp    $0x77,%eax
+  801119:	74 1c                	je     801137 <umain+0x78>
+  80111b:	83 f8 63             	cmp    $0x63,%eax
+  80111e:	74 db                	je     8010fb <umain+0x3c>
+	cprintf("usage: httpd [-cs] [-w workers]\n");
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  801123:	68 6c 6a 80 00       	push   $0x806a6c
+  801128:	e8 db 04 00 00       	call   801608 <cprintf>
+	exit();
+  80112d:	e8 e1 03 00 00       	call   801513 <exit>
+}
+  801132:	83 c4 10             	add    $0x10,%esp
+  801135:	eb ca                	jmp    801101 <umain+0x42>
+			break;
+		case 'w':
+			if (!argvalue(&args))
+  801137:	83 ec 0c             	sub    $0xc,%esp
+  80113a:	56                   	push   %esi
+  80113b:	e8 01 1d 00 00       	call   802e41 <argvalue>
+  801140:	83 c4 10             	add    $0x10,%esp
+  801143:	85 c0                	test   %eax,%eax
+  801145:	74 2a                	je     801171 <umain+0xb2>
+				usage();
+			serial = 1;
+			workers = MAX(strtol(argvalue(&args), 0, 0), 1);
+  801147:	83 ec 0c             	sub    $0xc,%esp
+  80114a:	56                   	push   %esi
+  80114b:	e8 f1 1c 00 00       	call   802e41 <argvalue>
+  801150:	83 c4 0c             	add    $0xc,%esp
+  801153:	6a 00                	push   $0x0
+  801155:	6a 00                	push   $0x0
+  801157:	50                   	push   %eax
+  801158:	e8 35 0e 00 00       	call   801f92 <strtol>
+  80115d:	85 c0                	test   %eax,%eax
+  80115f:	ba 01 00 00 00       	mov    $0x1,%edx
+  801164:	0f 4f d0             	cmovg  %eax,%edx
+  801167:	89 d3                	mov    %edx,%ebx
+			break;
+  801169:	83 c4 10             	add    $0x10,%esp
+			serial = 1;
+  80116c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+			break;
+  80116f:	eb 90                	jmp    801101 <umain+0x42>
+	cprintf("usage: httpd [-cs] [-w workers]\n");
+  801171:	83 ec 0c             	sub    $0xc,%esp
+  801174:	68 6c 6a 80 00       	push   $0x806a6c
+  801179:	e8 8a 04 00 00       	call   801608 <cprintf>
+	exit();
+  80117e:	e8 90 03 00 00       	call   801513 <exit>
+}
+  801183:	83 c4 10             	add    $0x10,%esp
+  801186:	eb bf                	jmp    801147 <umain+0x88>
+		switch (i) {
+  801188:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+  80118b:	e9 71 ff ff ff       	jmp    801101 <umain+0x42>
+  801190:	b8 40 ac 80 00       	mov    $0x80ac40,%eax
+  801195:	ba 80 ed 80 00       	mov    $0x80ed80,%edx
+		default:
+			usage();
+		}
+	for (i = 0; i < FCACHE_SIZE; i++)
+		fcache[i].fd = -1;
+  80119a:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%eax)
+	for (i = 0; i < FCACHE_SIZE; i++)
+  8011a0:	05 14 04 00 00       	add    $0x414,%eax
+  8011a5:	39 d0                	cmp    %edx,%eax
+  8011a7:	75 f1                	jne    80119a <umain+0xdb>
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8011a9:	83 ec 04             	sub    $0x4,%esp
+  8011ac:	6a 06                	push   $0x6
+  8011ae:	6a 01                	push   $0x1
+  8011b0:	6a 02                	push   $0x2
+  8011b2:	e8 b9 29 00 00       	call   803b70 <socket>
+  8011b7:	89 c7                	mov    %eax,%edi
+  8011b9:	83 c4 10             	add    $0x10,%esp
+  8011bc:	85 c0                	test   %eax,%eax
+  8011be:	0f 88 ab 00 00 00    	js     80126f <umain+0x1b0>
+		die("Failed to create socket");
+
+	// Construct the server sockaddr_in structure
+	memset(&server, 0, sizeof(server));		// Clear struct
+  8011c4:	83 ec 04             	sub    $0x4,%esp
+  8011c7:	6a 10                	push   $0x10
+  8011c9:	6a 00                	push   $0x0
+  8011cb:	8d 75 d8             	lea    -0x28(%ebp),%esi
+  8011ce:	56                   	push   %esi
+  8011cf:	e8 a6 0c 00 00       	call   801e7a <memset>
+	server.sin_family = AF_INET;			// Internet/IP
+  8011d4:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	server.sin_addr.s_addr = htonl(INADDR_ANY);	// IP address
+  8011d8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8011df:	e8 33 52 00 00       	call   806417 <htonl>
+  8011e4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	server.sin_port = htons(PORT);			// server port
+  8011e7:	c7 04 24 50 00 00 00 	movl   $0x50,(%esp)
+  8011ee:	e8 0a 52 00 00       	call   8063fd <htons>
+  8011f3:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &server,
+  8011f7:	83 c4 0c             	add    $0xc,%esp
+  8011fa:	6a 10                	push   $0x10
+  8011fc:	56                   	push   %esi
+  8011fd:	57                   	push   %edi
+  8011fe:	e8 cc 27 00 00       	call   8039cf <bind>
+  801203:	83 c4 10             	add    $0x10,%esp
+  801206:	85 c0                	test   %eax,%eax
+  801208:	78 74                	js     80127e <umain+0x1bf>
+	{
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  80120a:	83 ec 08             	sub    $0x8,%esp
+  80120d:	6a 40                	push   $0x40
+  80120f:	57                   	push   %edi
+  801210:	e8 29 28 00 00       	call   803a3e <listen>
+  801215:	83 c4 10             	add    $0x10,%esp
+  801218:	85 c0                	test   %eax,%eax
+  80121a:	78 6e                	js     80128a <umain+0x1cb>
+		switch (i) {
+  80121c:	be 00 00 00 c0       	mov    $0xc0000000,%esi
+		if ((r = sys_page_alloc(0, (char *) RCACHEVA + i * PGSIZE,
+  801221:	83 ec 04             	sub    $0x4,%esp
+  801224:	68 07 04 00 00       	push   $0x407
+  801229:	56                   	push   %esi
+  80122a:	6a 00                	push   $0x0
+  80122c:	e8 02 0f 00 00       	call   802133 <sys_page_alloc>
+  801231:	83 c4 10             	add    $0x10,%esp
+  801234:	85 c0                	test   %eax,%eax
+  801236:	78 5e                	js     801296 <umain+0x1d7>
+	for (i = 0; i < RCACHE_HDRSIZE / PGSIZE + RCACHE_PAGES; i++)
+  801238:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80123e:	81 fe 00 20 10 c0    	cmp    $0xc0102000,%esi
+  801244:	75 db                	jne    801221 <umain+0x162>
+	for (i = 0; i < RCACHE_NENT; i++)
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+		rcache->ents[i].page = -1;
+  80124b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80124e:	c1 e2 05             	shl    $0x5,%edx
+  801251:	c7 82 58 00 00 c0 ff 	movl   $0xffffffff,-0x3fffffa8(%edx)
+  801258:	ff ff ff 
+	for (i = 0; i < RCACHE_NENT; i++)
+  80125b:	83 c0 01             	add    $0x1,%eax
+  80125e:	83 f8 40             	cmp    $0x40,%eax
+  801261:	75 e8                	jne    80124b <umain+0x18c>
+	rcache_on = 1;
+  801263:	c7 05 20 a8 80 00 01 	movl   $0x1,0x80a820
+  80126a:	00 00 00 
+  80126d:	eb 38                	jmp    8012a7 <umain+0x1e8>
+		die("Failed to create socket");
+  80126f:	b8 19 69 80 00       	mov    $0x806919,%eax
+  801274:	e8 c2 ee ff ff       	call   80013b <die>
+  801279:	e9 46 ff ff ff       	jmp    8011c4 <umain+0x105>
+		die("Failed to bind the server socket");
+  80127e:	b8 90 6a 80 00       	mov    $0x806a90,%eax
+  801283:	e8 b3 ee ff ff       	call   80013b <die>
+  801288:	eb 80                	jmp    80120a <umain+0x14b>
+		die("Failed to listen on server socket");
+  80128a:	b8 b4 6a 80 00       	mov    $0x806ab4,%eax
+  80128f:	e8 a7 ee ff ff       	call   80013b <die>
+  801294:	eb 86                	jmp    80121c <umain+0x15d>
+			cprintf("httpd: no response cache: %e\n", r);
+  801296:	83 ec 08             	sub    $0x8,%esp
+  801299:	50                   	push   %eax
+  80129a:	68 31 69 80 00       	push   $0x806931
+  80129f:	e8 64 03 00 00       	call   801608 <cprintf>
+			return;
+  8012a4:	83 c4 10             	add    $0x10,%esp
+
+	rcache_init();
+	// Every worker accepts connections on the same socket.
+	while (--workers > 0 && fork() > 0)
+  8012a7:	83 eb 01             	sub    $0x1,%ebx
+  8012aa:	85 db                	test   %ebx,%ebx
+  8012ac:	7e 09                	jle    8012b7 <umain+0x1f8>
+  8012ae:	e8 88 14 00 00       	call   80273b <fork>
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	7f f0                	jg     8012a7 <umain+0x1e8>
+		;
+
+	cprintf("Waiting for http connections...\n");
+  8012b7:	83 ec 0c             	sub    $0xc,%esp
+  8012ba:	68 d8 6a 80 00       	push   $0x806ad8
+  8012bf:	e8 44 03 00 00       	call   801608 <cprintf>
+
+	if (!serial)
+  8012c4:	83 c4 10             	add    $0x10,%esp
+		serve_events(serversock);
+
+	while (1) {
+		unsigned int clientlen = sizeof(client);
+		// Wait for client connection
+		if ((clientsock = accept(serversock,
+  8012c7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+	if (!serial)
+  8012ca:	83 7d 94 00          	cmpl   $0x0,-0x6c(%ebp)
+  8012ce:	0f 85 7d 01 00 00    	jne    801451 <umain+0x392>
+	if ((r = fcntl(serversock, F_SETFL, O_NONBLOCK)) < 0
+  8012d4:	83 ec 04             	sub    $0x4,%esp
+  8012d7:	68 00 10 00 00       	push   $0x1000
+  8012dc:	6a 04                	push   $0x4
+  8012de:	57                   	push   %edi
+  8012df:	e8 38 20 00 00       	call   80331c <fcntl>
+  8012e4:	83 c4 10             	add    $0x10,%esp
+  8012e7:	85 c0                	test   %eax,%eax
+  8012e9:	78 3a                	js     801325 <umain+0x266>
+	    || (r = evctl(serversock, POLLIN)) < 0)
+  8012eb:	83 ec 08             	sub    $0x8,%esp
+  8012ee:	6a 01                	push   $0x1
+  8012f0:	57                   	push   %edi
+  8012f1:	e8 3a 28 00 00       	call   803b30 <evctl>
+  8012f6:	83 c4 10             	add    $0x10,%esp
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	78 28                	js     801325 <umain+0x266>
+  8012fd:	89 7d 90             	mov    %edi,-0x70(%ebp)
+		if ((n = evwait(evs, MAXEV, -1)) < 0)
+  801300:	83 ec 04             	sub    $0x4,%esp
+  801303:	6a ff                	push   $0xffffffff
+  801305:	68 00 02 00 00       	push   $0x200
+  80130a:	68 20 90 80 00       	push   $0x809020
+  80130f:	e8 46 28 00 00       	call   803b5a <evwait>
+  801314:	83 c4 10             	add    $0x10,%esp
+  801317:	85 c0                	test   %eax,%eax
+  801319:	78 1f                	js     80133a <umain+0x27b>
+		for (i = 0; i < n; i++) {
+  80131b:	8b 75 94             	mov    -0x6c(%ebp),%esi
+  80131e:	7e e0                	jle    801300 <umain+0x241>
+  801320:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  801323:	eb 63                	jmp    801388 <umain+0x2c9>
+		panic("httpd: %e", r);
+  801325:	50                   	push   %eax
+  801326:	68 4f 69 80 00       	push   $0x80694f
+  80132b:	68 5c 03 00 00       	push   $0x35c
+  801330:	68 f2 68 80 00       	push   $0x8068f2
+  801335:	e8 f3 01 00 00       	call   80152d <_panic>
+			panic("evwait: %e", n);
+  80133a:	50                   	push   %eax
+  80133b:	68 59 69 80 00       	push   $0x806959
+  801340:	68 60 03 00 00       	push   $0x360
+  801345:	68 f2 68 80 00       	push   $0x8068f2
+  80134a:	e8 de 01 00 00       	call   80152d <_panic>
+	if (r < 0 || c->out_close || evctl(c->sock, POLLIN) < 0) {
+  80134f:	83 ec 08             	sub    $0x8,%esp
+  801352:	6a 01                	push   $0x1
+  801354:	ff 33                	push   (%ebx)
+  801356:	e8 d5 27 00 00       	call   803b30 <evctl>
+  80135b:	83 c4 10             	add    $0x10,%esp
+  80135e:	85 c0                	test   %eax,%eax
+  801360:	78 66                	js     8013c8 <umain+0x309>
+	c->blocked = 0;
+  801362:	c7 83 3c 08 00 00 00 	movl   $0x0,0x83c(%ebx)
+  801369:	00 00 00 
+	conn_input(c);
+  80136c:	89 d8                	mov    %ebx,%eax
+  80136e:	e8 d6 f2 ff ff       	call   800649 <conn_input>
+  801373:	eb 07                	jmp    80137c <umain+0x2bd>
+					conn_input(c);
+  801375:	89 d8                	mov    %ebx,%eax
+  801377:	e8 cd f2 ff ff       	call   800649 <conn_input>
+		for (i = 0; i < n; i++) {
+  80137c:	83 c6 01             	add    $0x1,%esi
+  80137f:	39 75 8c             	cmp    %esi,-0x74(%ebp)
+  801382:	0f 84 78 ff ff ff    	je     801300 <umain+0x241>
+			if (evs[i].fd != serversock) {
+  801388:	8b 3c f5 20 90 80 00 	mov    0x809020(,%esi,8),%edi
+  80138f:	39 7d 90             	cmp    %edi,-0x70(%ebp)
+  801392:	74 6d                	je     801401 <umain+0x342>
+				if (!(c = conns[evs[i].fd]))
+  801394:	8b 1c bd 20 a0 80 00 	mov    0x80a020(,%edi,4),%ebx
+  80139b:	85 db                	test   %ebx,%ebx
+  80139d:	74 dd                	je     80137c <umain+0x2bd>
+				if (c->blocked && (evs[i].revents & POLLOUT))
+  80139f:	83 bb 3c 08 00 00 00 	cmpl   $0x0,0x83c(%ebx)
+  8013a6:	74 cd                	je     801375 <umain+0x2b6>
+  8013a8:	f6 04 f5 26 90 80 00 	testb  $0x4,0x809026(,%esi,8)
+  8013af:	04 
+  8013b0:	74 c3                	je     801375 <umain+0x2b6>
+	if ((r = out_flush(c)) > 0)
+  8013b2:	89 d8                	mov    %ebx,%eax
+  8013b4:	e8 a2 ef ff ff       	call   80035b <out_flush>
+  8013b9:	85 c0                	test   %eax,%eax
+  8013bb:	7f bf                	jg     80137c <umain+0x2bd>
+	if (r < 0 || c->out_close || evctl(c->sock, POLLIN) < 0) {
+  8013bd:	78 09                	js     8013c8 <umain+0x309>
+  8013bf:	83 bb 38 08 00 00 00 	cmpl   $0x0,0x838(%ebx)
+  8013c6:	74 87                	je     80134f <umain+0x290>
+		conn_close(c);
+  8013c8:	89 d8                	mov    %ebx,%eax
+  8013ca:	e8 ba f0 ff ff       	call   800489 <conn_close>
+		return;
+  8013cf:	eb ab                	jmp    80137c <umain+0x2bd>
+				if ((r = fcntl(sock, F_SETFL, O_NONBLOCK)) < 0
+  8013d1:	83 ec 04             	sub    $0x4,%esp
+  8013d4:	68 00 10 00 00       	push   $0x1000
+  8013d9:	6a 04                	push   $0x4
+  8013db:	53                   	push   %ebx
+  8013dc:	e8 3b 1f 00 00       	call   80331c <fcntl>
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	78 4f                	js     801437 <umain+0x378>
+				    || (r = evctl(sock, POLLIN)) < 0)
+  8013e8:	83 ec 08             	sub    $0x8,%esp
+  8013eb:	6a 01                	push   $0x1
+  8013ed:	53                   	push   %ebx
+  8013ee:	e8 3d 27 00 00       	call   803b30 <evctl>
+  8013f3:	83 c4 10             	add    $0x10,%esp
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	78 3d                	js     801437 <umain+0x378>
+				conn_open(sock);
+  8013fa:	89 d8                	mov    %ebx,%eax
+  8013fc:	e8 27 f1 ff ff       	call   800528 <conn_open>
+				clientlen = sizeof(client);
+  801401:	c7 45 a4 10 00 00 00 	movl   $0x10,-0x5c(%ebp)
+				sock = accept(serversock,
+  801408:	83 ec 04             	sub    $0x4,%esp
+  80140b:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80140e:	50                   	push   %eax
+  80140f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  801412:	50                   	push   %eax
+  801413:	57                   	push   %edi
+  801414:	e8 74 25 00 00       	call   80398d <accept>
+  801419:	89 c3                	mov    %eax,%ebx
+				if (sock == -E_AGAIN)
+  80141b:	83 c4 10             	add    $0x10,%esp
+  80141e:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801421:	0f 84 55 ff ff ff    	je     80137c <umain+0x2bd>
+				if (sock < 0)
+  801427:	85 c0                	test   %eax,%eax
+  801429:	79 a6                	jns    8013d1 <umain+0x312>
+					die("Failed to accept client connection");
+  80142b:	b8 fc 6a 80 00       	mov    $0x806afc,%eax
+  801430:	e8 06 ed ff ff       	call   80013b <die>
+  801435:	eb 9a                	jmp    8013d1 <umain+0x312>
+					panic("httpd: %e", r);
+  801437:	50                   	push   %eax
+  801438:	68 4f 69 80 00       	push   $0x80694f
+  80143d:	68 76 03 00 00       	push   $0x376
+  801442:	68 f2 68 80 00       	push   $0x8068f2
+  801447:	e8 e1 00 00 00       	call   80152d <_panic>
+		conn_input(c);
+  80144c:	e8 f8 f1 ff ff       	call   800649 <conn_input>
+		unsigned int clientlen = sizeof(client);
+  801451:	c7 45 a8 10 00 00 00 	movl   $0x10,-0x58(%ebp)
+		if ((clientsock = accept(serversock,
+  801458:	83 ec 04             	sub    $0x4,%esp
+  80145b:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  80145e:	50                   	push   %eax
+  80145f:	56                   	push   %esi
+  801460:	57                   	push   %edi
+  801461:	e8 27 25 00 00       	call   80398d <accept>
+  801466:	89 c3                	mov    %eax,%ebx
+  801468:	83 c4 10             	add    $0x10,%esp
+  80146b:	85 c0                	test   %eax,%eax
+  80146d:	79 0a                	jns    801479 <umain+0x3ba>
+					 (struct sockaddr *) &client,
+					 &clientlen)) < 0)
+		{
+			die("Failed to accept client connection");
+  80146f:	b8 fc 6a 80 00       	mov    $0x806afc,%eax
+  801474:	e8 c2 ec ff ff       	call   80013b <die>
+	if ((c = conn_open(sock)))
+  801479:	89 d8                	mov    %ebx,%eax
+  80147b:	e8 a8 f0 ff ff       	call   800528 <conn_open>
+  801480:	85 c0                	test   %eax,%eax
+  801482:	75 c8                	jne    80144c <umain+0x38d>
+  801484:	eb cb                	jmp    801451 <umain+0x392>
+
+00801486 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  801486:	55                   	push   %ebp
+  801487:	89 e5                	mov    %esp,%ebp
+  801489:	56                   	push   %esi
+  80148a:	53                   	push   %ebx
+  80148b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80148e:	8b 75 0c             	mov    0xc(%ebp),%esi
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801491:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801493:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801498:	29 d0                	sub    %edx,%eax
+  80149a:	89 c2                	mov    %eax,%edx
+  80149c:	c1 ea 0f             	shr    $0xf,%edx
+  80149f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a9:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8014ac:	c7 04 85 80 f8 80 00 	movl   $0x0,0x80f880(,%eax,4)
+  8014b3:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8014b7:	e8 39 0c 00 00       	call   8020f5 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8014bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014c1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8014c7:	89 e1                	mov    %esp,%ecx
+  8014c9:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8014ce:	29 ca                	sub    %ecx,%edx
+  8014d0:	89 d1                	mov    %edx,%ecx
+  8014d2:	c1 e9 0f             	shr    $0xf,%ecx
+  8014d5:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8014db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e0:	0f 42 d1             	cmovb  %ecx,%edx
+  8014e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014e8:	89 04 95 80 f8 80 00 	mov    %eax,0x80f880(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8014ef:	85 db                	test   %ebx,%ebx
+  8014f1:	7e 07                	jle    8014fa <libmain+0x74>
+		binaryname = argv[0];
+  8014f3:	8b 06                	mov    (%esi),%eax
+  8014f5:	a3 20 80 80 00       	mov    %eax,0x808020
+
+	// call user main routine
+	umain(argc, argv);
+  8014fa:	83 ec 08             	sub    $0x8,%esp
+  8014fd:	56                   	push   %esi
+  8014fe:	53                   	push   %ebx
+  8014ff:	e8 bb fb ff ff       	call   8010bf <umain>
+
+	// exit gracefully
+	exit();
+  801504:	e8 0a 00 00 00       	call   801513 <exit>
+}
+  801509:	83 c4 10             	add    $0x10,%esp
+  80150c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5d                   	pop    %ebp
+  801512:	c3                   	ret
+
+00801513 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  801519:	e8 2c 1b 00 00       	call   80304a <close_all>
+	sys_env_destroy(0);
+  80151e:	83 ec 0c             	sub    $0xc,%esp
+  801521:	6a 00                	push   $0x0
+  801523:	e8 8c 0b 00 00       	call   8020b4 <sys_env_destroy>
+}
+  801528:	83 c4 10             	add    $0x10,%esp
+  80152b:	c9                   	leave
+  80152c:	c3                   	ret
+
+0080152d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801532:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801535:	8b 35 20 80 80 00    	mov    0x808020,%esi
+  80153b:	e8 b5 0b 00 00       	call   8020f5 <sys_getenvid>
+  801540:	83 ec 0c             	sub    $0xc,%esp
+  801543:	ff 75 0c             	push   0xc(%ebp)
+  801546:	ff 75 08             	push   0x8(%ebp)
+  801549:	56                   	push   %esi
+  80154a:	50                   	push   %eax
+  80154b:	68 50 6b 80 00       	push   $0x806b50
+  801550:	e8 b3 00 00 00       	call   801608 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801555:	83 c4 18             	add    $0x18,%esp
+  801558:	53                   	push   %ebx
+  801559:	ff 75 10             	push   0x10(%ebp)
+  80155c:	e8 56 00 00 00       	call   8015b7 <vcprintf>
+	cprintf("\n");
+  801561:	c7 04 24 a4 68 80 00 	movl   $0x8068a4,(%esp)
+  801568:	e8 9b 00 00 00       	call   801608 <cprintf>
+  80156d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801570:	cc                   	int3
+	while (1)
+  801571:	eb fd                	jmp    801570 <_panic+0x43>
+
+00801573 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	53                   	push   %ebx
+  801577:	83 ec 04             	sub    $0x4,%esp
+  80157a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80157d:	8b 13                	mov    (%ebx),%edx
+  80157f:	8d 42 01             	lea    0x1(%edx),%eax
+  801582:	89 03                	mov    %eax,(%ebx)
+  801584:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801587:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80158b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801590:	74 09                	je     80159b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801592:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801596:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801599:	c9                   	leave
+  80159a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80159b:	83 ec 08             	sub    $0x8,%esp
+  80159e:	68 ff 00 00 00       	push   $0xff
+  8015a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015a6:	50                   	push   %eax
+  8015a7:	e8 cb 0a 00 00       	call   802077 <sys_cputs>
+		b->idx = 0;
+  8015ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015b2:	83 c4 10             	add    $0x10,%esp
+  8015b5:	eb db                	jmp    801592 <putch+0x1f>
+
+008015b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015c7:	00 00 00 
+	b.cnt = 0;
+  8015ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015d4:	ff 75 0c             	push   0xc(%ebp)
+  8015d7:	ff 75 08             	push   0x8(%ebp)
+  8015da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8015e0:	50                   	push   %eax
+  8015e1:	68 73 15 80 00       	push   $0x801573
+  8015e6:	e8 1c 01 00 00       	call   801707 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8015eb:	83 c4 08             	add    $0x8,%esp
+  8015ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8015f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8015fa:	50                   	push   %eax
+  8015fb:	e8 77 0a 00 00       	call   802077 <sys_cputs>
+
+	return b.cnt;
+}
+  801600:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+
+00801608 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80160e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801611:	50                   	push   %eax
+  801612:	ff 75 08             	push   0x8(%ebp)
+  801615:	e8 9d ff ff ff       	call   8015b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80161a:	c9                   	leave
+  80161b:	c3                   	ret
+
+0080161c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	57                   	push   %edi
+  801620:	56                   	push   %esi
+  801621:	53                   	push   %ebx
+  801622:	83 ec 1c             	sub    $0x1c,%esp
+  801625:	89 c3                	mov    %eax,%ebx
+  801627:	89 d6                	mov    %edx,%esi
+  801629:	8b 45 08             	mov    0x8(%ebp),%eax
+  80162c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80162f:	89 d1                	mov    %edx,%ecx
+  801631:	89 c2                	mov    %eax,%edx
+  801633:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801636:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801639:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80163c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80163f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801646:	39 c2                	cmp    %eax,%edx
+  801648:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80164b:	73 4b                	jae    801698 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80164d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801650:	8d 78 ff             	lea    -0x1(%eax),%edi
+  801653:	85 ff                	test   %edi,%edi
+  801655:	7e 11                	jle    801668 <printnum+0x4c>
+			putch(padc, putdat);
+  801657:	83 ec 08             	sub    $0x8,%esp
+  80165a:	56                   	push   %esi
+  80165b:	ff 75 18             	push   0x18(%ebp)
+  80165e:	ff d3                	call   *%ebx
+		while (--width > 0)
+  801660:	83 c4 10             	add    $0x10,%esp
+  801663:	83 ef 01             	sub    $0x1,%edi
+  801666:	75 ef                	jne    801657 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801668:	83 ec 08             	sub    $0x8,%esp
+  80166b:	56                   	push   %esi
+  80166c:	83 ec 04             	sub    $0x4,%esp
+  80166f:	ff 75 e4             	push   -0x1c(%ebp)
+  801672:	ff 75 e0             	push   -0x20(%ebp)
+  801675:	ff 75 dc             	push   -0x24(%ebp)
+  801678:	ff 75 d8             	push   -0x28(%ebp)
+  80167b:	e8 b4 50 00 00       	call   806734 <__umoddi3>
+  801680:	83 c4 14             	add    $0x14,%esp
+  801683:	0f be 80 73 6b 80 00 	movsbl 0x806b73(%eax),%eax
+  80168a:	50                   	push   %eax
+  80168b:	ff d3                	call   *%ebx
+}
+  80168d:	83 c4 10             	add    $0x10,%esp
+  801690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801693:	5b                   	pop    %ebx
+  801694:	5e                   	pop    %esi
+  801695:	5f                   	pop    %edi
+  801696:	5d                   	pop    %ebp
+  801697:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801698:	83 ec 0c             	sub    $0xc,%esp
+  80169b:	ff 75 18             	push   0x18(%ebp)
+  80169e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016a1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8016a4:	52                   	push   %edx
+  8016a5:	50                   	push   %eax
+  8016a6:	83 ec 08             	sub    $0x8,%esp
+  8016a9:	ff 75 e4             	push   -0x1c(%ebp)
+  8016ac:	ff 75 e0             	push   -0x20(%ebp)
+  8016af:	ff 75 dc             	push   -0x24(%ebp)
+  8016b2:	ff 75 d8             	push   -0x28(%ebp)
+  8016b5:	e8 b4 4f 00 00       	call   80666e <__udivdi3>
+  8016ba:	83 c4 18             	add    $0x18,%esp
+  8016bd:	52                   	push   %edx
+  8016be:	50                   	push   %eax
+  8016bf:	89 f2                	mov    %esi,%edx
+  8016c1:	89 d8                	mov    %ebx,%eax
+  8016c3:	e8 54 ff ff ff       	call   80161c <printnum>
+  8016c8:	83 c4 20             	add    $0x20,%esp
+  8016cb:	eb 9b                	jmp    801668 <printnum+0x4c>
+
+008016cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016d7:	8b 10                	mov    (%eax),%edx
+  8016d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016dc:	73 0a                	jae    8016e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016e1:	89 08                	mov    %ecx,(%eax)
+  8016e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e6:	88 02                	mov    %al,(%edx)
+}
+  8016e8:	5d                   	pop    %ebp
+  8016e9:	c3                   	ret
+
+008016ea <printfmt>:
+{
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8016f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8016f3:	50                   	push   %eax
+  8016f4:	ff 75 10             	push   0x10(%ebp)
+  8016f7:	ff 75 0c             	push   0xc(%ebp)
+  8016fa:	ff 75 08             	push   0x8(%ebp)
+  8016fd:	e8 05 00 00 00       	call   801707 <vprintfmt>
+}
+  801702:	83 c4 10             	add    $0x10,%esp
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+
+00801707 <vprintfmt>:
+{
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	57                   	push   %edi
+  80170b:	56                   	push   %esi
+  80170c:	53                   	push   %ebx
+  80170d:	83 ec 2c             	sub    $0x2c,%esp
+  801710:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801713:	89 df                	mov    %ebx,%edi
+  801715:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801718:	8b 45 10             	mov    0x10(%ebp),%eax
+  80171b:	8d 70 01             	lea    0x1(%eax),%esi
+  80171e:	0f b6 00             	movzbl (%eax),%eax
+  801721:	83 f8 25             	cmp    $0x25,%eax
+  801724:	74 1e                	je     801744 <vprintfmt+0x3d>
+			if (ch == '\0')
+  801726:	85 c0                	test   %eax,%eax
+  801728:	0f 84 15 05 00 00    	je     801c43 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80172e:	83 ec 08             	sub    $0x8,%esp
+  801731:	53                   	push   %ebx
+  801732:	50                   	push   %eax
+  801733:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801735:	83 c6 01             	add    $0x1,%esi
+  801738:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80173c:	83 c4 10             	add    $0x10,%esp
+  80173f:	83 f8 25             	cmp    $0x25,%eax
+  801742:	75 e2                	jne    801726 <vprintfmt+0x1f>
+		padc = ' ';
+  801744:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  801748:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80174f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  801756:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80175d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801762:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801765:	8d 56 01             	lea    0x1(%esi),%edx
+  801768:	0f b6 0e             	movzbl (%esi),%ecx
+  80176b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80176e:	3c 55                	cmp    $0x55,%al
+  801770:	0f 87 3b 04 00 00    	ja     801bb1 <vprintfmt+0x4aa>
+  801776:	0f b6 c0             	movzbl %al,%eax
+  801779:	ff 24 85 e0 6c 80 00 	jmp    *0x806ce0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801780:	89 75 10             	mov    %esi,0x10(%ebp)
+  801783:	eb 93                	jmp    801718 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  801785:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  801787:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80178b:	eb d8                	jmp    801765 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80178d:	89 d6                	mov    %edx,%esi
+  80178f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  801793:	eb d0                	jmp    801765 <vprintfmt+0x5e>
+  801795:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  801798:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80179b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80179e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8017a2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8017a5:	83 f9 09             	cmp    $0x9,%ecx
+  8017a8:	77 6f                	ja     801819 <vprintfmt+0x112>
+  8017aa:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8017ad:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8017b0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8017b3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8017b7:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8017ba:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8017bd:	83 fe 09             	cmp    $0x9,%esi
+  8017c0:	76 eb                	jbe    8017ad <vprintfmt+0xa6>
+  8017c2:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8017c5:	89 d6                	mov    %edx,%esi
+  8017c7:	eb 13                	jmp    8017dc <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8017c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017cc:	8b 00                	mov    (%eax),%eax
+  8017ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8017d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8017d7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017da:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8017dc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8017e0:	79 83                	jns    801765 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8017e2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8017e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017e8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8017ef:	e9 71 ff ff ff       	jmp    801765 <vprintfmt+0x5e>
+			if (width < 0)
+  8017f4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8017f7:	85 c9                	test   %ecx,%ecx
+  8017f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fe:	0f 49 c1             	cmovns %ecx,%eax
+  801801:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801804:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  801806:	e9 5a ff ff ff       	jmp    801765 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80180b:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80180d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801814:	e9 4c ff ff ff       	jmp    801765 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  801819:	89 d6                	mov    %edx,%esi
+  80181b:	eb bf                	jmp    8017dc <vprintfmt+0xd5>
+			lflag++;
+  80181d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801821:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  801823:	e9 3d ff ff ff       	jmp    801765 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  801828:	89 55 10             	mov    %edx,0x10(%ebp)
+  80182b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80182e:	8d 70 04             	lea    0x4(%eax),%esi
+  801831:	83 ec 08             	sub    $0x8,%esp
+  801834:	53                   	push   %ebx
+  801835:	ff 30                	push   (%eax)
+  801837:	ff d7                	call   *%edi
+			break;
+  801839:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80183c:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80183f:	e9 d4 fe ff ff       	jmp    801718 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  801844:	89 55 10             	mov    %edx,0x10(%ebp)
+  801847:	8b 45 14             	mov    0x14(%ebp),%eax
+  80184a:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80184d:	8b 10                	mov    (%eax),%edx
+  80184f:	89 d0                	mov    %edx,%eax
+  801851:	f7 d8                	neg    %eax
+  801853:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801856:	83 f8 12             	cmp    $0x12,%eax
+  801859:	7f 23                	jg     80187e <vprintfmt+0x177>
+  80185b:	8b 14 85 40 6e 80 00 	mov    0x806e40(,%eax,4),%edx
+  801862:	85 d2                	test   %edx,%edx
+  801864:	74 18                	je     80187e <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  801866:	52                   	push   %edx
+  801867:	68 93 70 80 00       	push   $0x807093
+  80186c:	53                   	push   %ebx
+  80186d:	57                   	push   %edi
+  80186e:	e8 77 fe ff ff       	call   8016ea <printfmt>
+  801873:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801876:	89 75 14             	mov    %esi,0x14(%ebp)
+  801879:	e9 9a fe ff ff       	jmp    801718 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80187e:	50                   	push   %eax
+  80187f:	68 8b 6b 80 00       	push   $0x806b8b
+  801884:	53                   	push   %ebx
+  801885:	57                   	push   %edi
+  801886:	e8 5f fe ff ff       	call   8016ea <printfmt>
+  80188b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80188e:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801891:	e9 82 fe ff ff       	jmp    801718 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801896:	89 55 10             	mov    %edx,0x10(%ebp)
+  801899:	8b 45 14             	mov    0x14(%ebp),%eax
+  80189c:	83 c0 04             	add    $0x4,%eax
+  80189f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8018a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018a5:	8b 00                	mov    (%eax),%eax
+  8018a7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8018aa:	85 c0                	test   %eax,%eax
+  8018ac:	0f 84 61 03 00 00    	je     801c13 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8018b2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8018b6:	7e 06                	jle    8018be <vprintfmt+0x1b7>
+  8018b8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8018bc:	75 29                	jne    8018e7 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8018be:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018c1:	8d 70 01             	lea    0x1(%eax),%esi
+  8018c4:	0f b6 00             	movzbl (%eax),%eax
+  8018c7:	0f be d0             	movsbl %al,%edx
+  8018ca:	85 d2                	test   %edx,%edx
+  8018cc:	0f 84 bb 00 00 00    	je     80198d <vprintfmt+0x286>
+  8018d2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8018d5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8018d8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8018db:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8018de:	eb 7a                	jmp    80195a <vprintfmt+0x253>
+				p = "(null)";
+  8018e0:	c7 45 d0 84 6b 80 00 	movl   $0x806b84,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018e7:	83 ec 08             	sub    $0x8,%esp
+  8018ea:	ff 75 d4             	push   -0x2c(%ebp)
+  8018ed:	ff 75 d0             	push   -0x30(%ebp)
+  8018f0:	e8 e0 03 00 00       	call   801cd5 <strnlen>
+  8018f5:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8018f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	85 d2                	test   %edx,%edx
+  801900:	0f 8e d6 02 00 00    	jle    801bdc <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  801906:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80190a:	83 ec 08             	sub    $0x8,%esp
+  80190d:	53                   	push   %ebx
+  80190e:	56                   	push   %esi
+  80190f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801911:	83 c4 10             	add    $0x10,%esp
+  801914:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  801918:	75 f0                	jne    80190a <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80191a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80191d:	8d 70 01             	lea    0x1(%eax),%esi
+  801920:	0f b6 00             	movzbl (%eax),%eax
+  801923:	0f be d0             	movsbl %al,%edx
+  801926:	85 d2                	test   %edx,%edx
+  801928:	0f 84 da 02 00 00    	je     801c08 <vprintfmt+0x501>
+  80192e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  801931:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801934:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  801937:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80193a:	eb 1e                	jmp    80195a <vprintfmt+0x253>
+					putch(ch, putdat);
+  80193c:	83 ec 08             	sub    $0x8,%esp
+  80193f:	ff 75 0c             	push   0xc(%ebp)
+  801942:	52                   	push   %edx
+  801943:	ff 55 08             	call   *0x8(%ebp)
+  801946:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801949:	83 eb 01             	sub    $0x1,%ebx
+  80194c:	83 c6 01             	add    $0x1,%esi
+  80194f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801953:	0f be d0             	movsbl %al,%edx
+  801956:	85 d2                	test   %edx,%edx
+  801958:	74 2a                	je     801984 <vprintfmt+0x27d>
+  80195a:	85 ff                	test   %edi,%edi
+  80195c:	78 05                	js     801963 <vprintfmt+0x25c>
+  80195e:	83 ef 01             	sub    $0x1,%edi
+  801961:	78 59                	js     8019bc <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801963:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801967:	74 d3                	je     80193c <vprintfmt+0x235>
+  801969:	0f be c0             	movsbl %al,%eax
+  80196c:	83 e8 20             	sub    $0x20,%eax
+  80196f:	83 f8 5e             	cmp    $0x5e,%eax
+  801972:	76 c8                	jbe    80193c <vprintfmt+0x235>
+					putch('?', putdat);
+  801974:	83 ec 08             	sub    $0x8,%esp
+  801977:	ff 75 0c             	push   0xc(%ebp)
+  80197a:	6a 3f                	push   $0x3f
+  80197c:	ff 55 08             	call   *0x8(%ebp)
+  80197f:	83 c4 10             	add    $0x10,%esp
+  801982:	eb c5                	jmp    801949 <vprintfmt+0x242>
+  801984:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  801987:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80198a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80198d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801990:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801994:	7e 1b                	jle    8019b1 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  801996:	83 ec 08             	sub    $0x8,%esp
+  801999:	53                   	push   %ebx
+  80199a:	6a 20                	push   $0x20
+  80199c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80199e:	83 c4 10             	add    $0x10,%esp
+  8019a1:	83 ee 01             	sub    $0x1,%esi
+  8019a4:	75 f0                	jne    801996 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8019a6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8019a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019ac:	e9 67 fd ff ff       	jmp    801718 <vprintfmt+0x11>
+  8019b1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8019b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019b7:	e9 5c fd ff ff       	jmp    801718 <vprintfmt+0x11>
+  8019bc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8019bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8019c5:	eb c6                	jmp    80198d <vprintfmt+0x286>
+	if (lflag >= 2)
+  8019c7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8019ca:	89 55 10             	mov    %edx,0x10(%ebp)
+  8019cd:	83 f9 01             	cmp    $0x1,%ecx
+  8019d0:	7f 1f                	jg     8019f1 <vprintfmt+0x2ea>
+	else if (lflag)
+  8019d2:	85 c9                	test   %ecx,%ecx
+  8019d4:	74 67                	je     801a3d <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8019d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019d9:	8b 30                	mov    (%eax),%esi
+  8019db:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8019de:	89 f0                	mov    %esi,%eax
+  8019e0:	c1 f8 1f             	sar    $0x1f,%eax
+  8019e3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8019e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8019ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019ef:	eb 17                	jmp    801a08 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8019f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f4:	8b 50 04             	mov    0x4(%eax),%edx
+  8019f7:	8b 00                	mov    (%eax),%eax
+  8019f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019fc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a02:	8d 40 08             	lea    0x8(%eax),%eax
+  801a05:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801a08:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801a0b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801a0e:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  801a13:	85 c9                	test   %ecx,%ecx
+  801a15:	0f 89 12 01 00 00    	jns    801b2d <vprintfmt+0x426>
+				putch('-', putdat);
+  801a1b:	83 ec 08             	sub    $0x8,%esp
+  801a1e:	53                   	push   %ebx
+  801a1f:	6a 2d                	push   $0x2d
+  801a21:	ff d7                	call   *%edi
+				num = -(long long) num;
+  801a23:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801a26:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801a29:	f7 da                	neg    %edx
+  801a2b:	83 d1 00             	adc    $0x0,%ecx
+  801a2e:	f7 d9                	neg    %ecx
+  801a30:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801a33:	be 0a 00 00 00       	mov    $0xa,%esi
+  801a38:	e9 f0 00 00 00       	jmp    801b2d <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  801a3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a40:	8b 30                	mov    (%eax),%esi
+  801a42:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801a45:	89 f0                	mov    %esi,%eax
+  801a47:	c1 f8 1f             	sar    $0x1f,%eax
+  801a4a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a50:	8d 40 04             	lea    0x4(%eax),%eax
+  801a53:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a56:	eb b0                	jmp    801a08 <vprintfmt+0x301>
+	if (lflag >= 2)
+  801a58:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801a5b:	89 55 10             	mov    %edx,0x10(%ebp)
+  801a5e:	83 f9 01             	cmp    $0x1,%ecx
+  801a61:	7f 1e                	jg     801a81 <vprintfmt+0x37a>
+	else if (lflag)
+  801a63:	85 c9                	test   %ecx,%ecx
+  801a65:	74 32                	je     801a99 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  801a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a6a:	8b 10                	mov    (%eax),%edx
+  801a6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a71:	8d 40 04             	lea    0x4(%eax),%eax
+  801a74:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a77:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  801a7c:	e9 ac 00 00 00       	jmp    801b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  801a81:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a84:	8b 10                	mov    (%eax),%edx
+  801a86:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a89:	8d 40 08             	lea    0x8(%eax),%eax
+  801a8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a8f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  801a94:	e9 94 00 00 00       	jmp    801b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  801a99:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a9c:	8b 10                	mov    (%eax),%edx
+  801a9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aa3:	8d 40 04             	lea    0x4(%eax),%eax
+  801aa6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801aa9:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  801aae:	eb 7d                	jmp    801b2d <vprintfmt+0x426>
+	if (lflag >= 2)
+  801ab0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801ab3:	89 55 10             	mov    %edx,0x10(%ebp)
+  801ab6:	83 f9 01             	cmp    $0x1,%ecx
+  801ab9:	7f 1b                	jg     801ad6 <vprintfmt+0x3cf>
+	else if (lflag)
+  801abb:	85 c9                	test   %ecx,%ecx
+  801abd:	74 2c                	je     801aeb <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  801abf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ac2:	8b 10                	mov    (%eax),%edx
+  801ac4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac9:	8d 40 04             	lea    0x4(%eax),%eax
+  801acc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801acf:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  801ad4:	eb 57                	jmp    801b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  801ad6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad9:	8b 10                	mov    (%eax),%edx
+  801adb:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ade:	8d 40 08             	lea    0x8(%eax),%eax
+  801ae1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801ae4:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  801ae9:	eb 42                	jmp    801b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  801aeb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aee:	8b 10                	mov    (%eax),%edx
+  801af0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af5:	8d 40 04             	lea    0x4(%eax),%eax
+  801af8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801afb:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  801b00:	eb 2b                	jmp    801b2d <vprintfmt+0x426>
+			putch('0', putdat);
+  801b02:	89 55 10             	mov    %edx,0x10(%ebp)
+  801b05:	83 ec 08             	sub    $0x8,%esp
+  801b08:	53                   	push   %ebx
+  801b09:	6a 30                	push   $0x30
+  801b0b:	ff d7                	call   *%edi
+			putch('x', putdat);
+  801b0d:	83 c4 08             	add    $0x8,%esp
+  801b10:	53                   	push   %ebx
+  801b11:	6a 78                	push   $0x78
+  801b13:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  801b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b18:	8b 10                	mov    (%eax),%edx
+  801b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801b1f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801b22:	8d 40 04             	lea    0x4(%eax),%eax
+  801b25:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b28:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  801b2d:	83 ec 0c             	sub    $0xc,%esp
+  801b30:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  801b34:	50                   	push   %eax
+  801b35:	ff 75 e4             	push   -0x1c(%ebp)
+  801b38:	56                   	push   %esi
+  801b39:	51                   	push   %ecx
+  801b3a:	52                   	push   %edx
+  801b3b:	89 da                	mov    %ebx,%edx
+  801b3d:	89 f8                	mov    %edi,%eax
+  801b3f:	e8 d8 fa ff ff       	call   80161c <printnum>
+			break;
+  801b44:	83 c4 20             	add    $0x20,%esp
+  801b47:	e9 cc fb ff ff       	jmp    801718 <vprintfmt+0x11>
+	if (lflag >= 2)
+  801b4c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801b4f:	89 55 10             	mov    %edx,0x10(%ebp)
+  801b52:	83 f9 01             	cmp    $0x1,%ecx
+  801b55:	7f 1b                	jg     801b72 <vprintfmt+0x46b>
+	else if (lflag)
+  801b57:	85 c9                	test   %ecx,%ecx
+  801b59:	74 2c                	je     801b87 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  801b5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b5e:	8b 10                	mov    (%eax),%edx
+  801b60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b65:	8d 40 04             	lea    0x4(%eax),%eax
+  801b68:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b6b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  801b70:	eb bb                	jmp    801b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  801b72:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b75:	8b 10                	mov    (%eax),%edx
+  801b77:	8b 48 04             	mov    0x4(%eax),%ecx
+  801b7a:	8d 40 08             	lea    0x8(%eax),%eax
+  801b7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b80:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  801b85:	eb a6                	jmp    801b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  801b87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b8a:	8b 10                	mov    (%eax),%edx
+  801b8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b91:	8d 40 04             	lea    0x4(%eax),%eax
+  801b94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b97:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  801b9c:	eb 8f                	jmp    801b2d <vprintfmt+0x426>
+			putch(ch, putdat);
+  801b9e:	89 55 10             	mov    %edx,0x10(%ebp)
+  801ba1:	83 ec 08             	sub    $0x8,%esp
+  801ba4:	53                   	push   %ebx
+  801ba5:	6a 25                	push   $0x25
+  801ba7:	ff d7                	call   *%edi
+			break;
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	e9 67 fb ff ff       	jmp    801718 <vprintfmt+0x11>
+			putch('%', putdat);
+  801bb1:	83 ec 08             	sub    $0x8,%esp
+  801bb4:	53                   	push   %ebx
+  801bb5:	6a 25                	push   $0x25
+  801bb7:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  801bc0:	0f 84 ba fb ff ff    	je     801780 <vprintfmt+0x79>
+  801bc6:	89 75 10             	mov    %esi,0x10(%ebp)
+  801bc9:	89 f0                	mov    %esi,%eax
+  801bcb:	83 e8 01             	sub    $0x1,%eax
+  801bce:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801bd2:	75 f7                	jne    801bcb <vprintfmt+0x4c4>
+  801bd4:	89 45 10             	mov    %eax,0x10(%ebp)
+  801bd7:	e9 3c fb ff ff       	jmp    801718 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801bdc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801bdf:	8d 70 01             	lea    0x1(%eax),%esi
+  801be2:	0f b6 00             	movzbl (%eax),%eax
+  801be5:	0f be d0             	movsbl %al,%edx
+  801be8:	85 d2                	test   %edx,%edx
+  801bea:	74 11                	je     801bfd <vprintfmt+0x4f6>
+  801bec:	89 7d 08             	mov    %edi,0x8(%ebp)
+  801bef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801bf2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  801bf5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801bf8:	e9 5d fd ff ff       	jmp    80195a <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801bfd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801c00:	89 45 14             	mov    %eax,0x14(%ebp)
+  801c03:	e9 10 fb ff ff       	jmp    801718 <vprintfmt+0x11>
+  801c08:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801c0b:	89 45 14             	mov    %eax,0x14(%ebp)
+  801c0e:	e9 05 fb ff ff       	jmp    801718 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  801c13:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801c17:	7e 0a                	jle    801c23 <vprintfmt+0x51c>
+  801c19:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  801c1d:	0f 85 bd fc ff ff    	jne    8018e0 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801c23:	ba 28 00 00 00       	mov    $0x28,%edx
+  801c28:	b8 28 00 00 00       	mov    $0x28,%eax
+  801c2d:	be 85 6b 80 00       	mov    $0x806b85,%esi
+  801c32:	89 7d 08             	mov    %edi,0x8(%ebp)
+  801c35:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801c38:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  801c3b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801c3e:	e9 17 fd ff ff       	jmp    80195a <vprintfmt+0x253>
+}
+  801c43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c46:	5b                   	pop    %ebx
+  801c47:	5e                   	pop    %esi
+  801c48:	5f                   	pop    %edi
+  801c49:	5d                   	pop    %ebp
+  801c4a:	c3                   	ret
+
+00801c4b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	83 ec 18             	sub    $0x18,%esp
+  801c51:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c54:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801c57:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801c5a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801c5e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801c61:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801c68:	85 c0                	test   %eax,%eax
+  801c6a:	74 26                	je     801c92 <vsnprintf+0x47>
+  801c6c:	85 d2                	test   %edx,%edx
+  801c6e:	7e 22                	jle    801c92 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801c70:	ff 75 14             	push   0x14(%ebp)
+  801c73:	ff 75 10             	push   0x10(%ebp)
+  801c76:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801c79:	50                   	push   %eax
+  801c7a:	68 cd 16 80 00       	push   $0x8016cd
+  801c7f:	e8 83 fa ff ff       	call   801707 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801c84:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801c87:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801c8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c8d:	83 c4 10             	add    $0x10,%esp
+}
+  801c90:	c9                   	leave
+  801c91:	c3                   	ret
+		return -E_INVAL;
+  801c92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c97:	eb f7                	jmp    801c90 <vsnprintf+0x45>
+
+00801c99 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801c99:	55                   	push   %ebp
+  801c9a:	89 e5                	mov    %esp,%ebp
+  801c9c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801c9f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801ca2:	50                   	push   %eax
+  801ca3:	ff 75 10             	push   0x10(%ebp)
+  801ca6:	ff 75 0c             	push   0xc(%ebp)
+  801ca9:	ff 75 08             	push   0x8(%ebp)
+  801cac:	e8 9a ff ff ff       	call   801c4b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801cb1:	c9                   	leave
+  801cb2:	c3                   	ret
+
+00801cb3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801cb3:	55                   	push   %ebp
+  801cb4:	89 e5                	mov    %esp,%ebp
+  801cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801cb9:	80 3a 00             	cmpb   $0x0,(%edx)
+  801cbc:	74 10                	je     801cce <strlen+0x1b>
+  801cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  801cc3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801cc6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801cca:	75 f7                	jne    801cc3 <strlen+0x10>
+	return n;
+}
+  801ccc:	5d                   	pop    %ebp
+  801ccd:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  801cce:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  801cd3:	eb f7                	jmp    801ccc <strlen+0x19>
+
+00801cd5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801cd5:	55                   	push   %ebp
+  801cd6:	89 e5                	mov    %esp,%ebp
+  801cd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cdb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801cde:	85 d2                	test   %edx,%edx
+  801ce0:	74 16                	je     801cf8 <strnlen+0x23>
+  801ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801ceb:	74 09                	je     801cf6 <strnlen+0x21>
+		n++;
+  801ced:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801cf0:	39 d0                	cmp    %edx,%eax
+  801cf2:	75 f3                	jne    801ce7 <strnlen+0x12>
+		n++;
+  801cf4:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  801cf6:	5d                   	pop    %ebp
+  801cf7:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfd:	eb f7                	jmp    801cf6 <strnlen+0x21>
+
+00801cff <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801cff:	55                   	push   %ebp
+  801d00:	89 e5                	mov    %esp,%ebp
+  801d02:	53                   	push   %ebx
+  801d03:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801d12:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801d15:	83 c0 01             	add    $0x1,%eax
+  801d18:	84 d2                	test   %dl,%dl
+  801d1a:	75 f2                	jne    801d0e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801d1c:	89 c8                	mov    %ecx,%eax
+  801d1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d21:	c9                   	leave
+  801d22:	c3                   	ret
+
+00801d23 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801d23:	55                   	push   %ebp
+  801d24:	89 e5                	mov    %esp,%ebp
+  801d26:	53                   	push   %ebx
+  801d27:	83 ec 10             	sub    $0x10,%esp
+  801d2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801d2d:	53                   	push   %ebx
+  801d2e:	e8 80 ff ff ff       	call   801cb3 <strlen>
+  801d33:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801d36:	ff 75 0c             	push   0xc(%ebp)
+  801d39:	01 d8                	add    %ebx,%eax
+  801d3b:	50                   	push   %eax
+  801d3c:	e8 be ff ff ff       	call   801cff <strcpy>
+	return dst;
+}
+  801d41:	89 d8                	mov    %ebx,%eax
+  801d43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d46:	c9                   	leave
+  801d47:	c3                   	ret
+
+00801d48 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801d48:	55                   	push   %ebp
+  801d49:	89 e5                	mov    %esp,%ebp
+  801d4b:	56                   	push   %esi
+  801d4c:	53                   	push   %ebx
+  801d4d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801d56:	85 db                	test   %ebx,%ebx
+  801d58:	74 17                	je     801d71 <strncpy+0x29>
+  801d5a:	01 f3                	add    %esi,%ebx
+  801d5c:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  801d5e:	83 c0 01             	add    $0x1,%eax
+  801d61:	0f b6 0a             	movzbl (%edx),%ecx
+  801d64:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801d67:	80 f9 01             	cmp    $0x1,%cl
+  801d6a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801d6d:	39 c3                	cmp    %eax,%ebx
+  801d6f:	75 ed                	jne    801d5e <strncpy+0x16>
+	}
+	return ret;
+}
+  801d71:	89 f0                	mov    %esi,%eax
+  801d73:	5b                   	pop    %ebx
+  801d74:	5e                   	pop    %esi
+  801d75:	5d                   	pop    %ebp
+  801d76:	c3                   	ret
+
+00801d77 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801d77:	55                   	push   %ebp
+  801d78:	89 e5                	mov    %esp,%ebp
+  801d7a:	56                   	push   %esi
+  801d7b:	53                   	push   %ebx
+  801d7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801d85:	89 f0                	mov    %esi,%eax
+  801d87:	85 db                	test   %ebx,%ebx
+  801d89:	74 1e                	je     801da9 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  801d8b:	83 eb 01             	sub    $0x1,%ebx
+  801d8e:	74 16                	je     801da6 <strlcpy+0x2f>
+  801d90:	01 f3                	add    %esi,%ebx
+  801d92:	0f b6 0a             	movzbl (%edx),%ecx
+  801d95:	84 c9                	test   %cl,%cl
+  801d97:	74 0d                	je     801da6 <strlcpy+0x2f>
+			*dst++ = *src++;
+  801d99:	83 c2 01             	add    $0x1,%edx
+  801d9c:	83 c0 01             	add    $0x1,%eax
+  801d9f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  801da2:	39 d8                	cmp    %ebx,%eax
+  801da4:	75 ec                	jne    801d92 <strlcpy+0x1b>
+		*dst = '\0';
+  801da6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801da9:	29 f0                	sub    %esi,%eax
+}
+  801dab:	5b                   	pop    %ebx
+  801dac:	5e                   	pop    %esi
+  801dad:	5d                   	pop    %ebp
+  801dae:	c3                   	ret
+
+00801daf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801db5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801db8:	0f b6 01             	movzbl (%ecx),%eax
+  801dbb:	84 c0                	test   %al,%al
+  801dbd:	74 11                	je     801dd0 <strcmp+0x21>
+  801dbf:	38 02                	cmp    %al,(%edx)
+  801dc1:	75 0d                	jne    801dd0 <strcmp+0x21>
+		p++, q++;
+  801dc3:	83 c1 01             	add    $0x1,%ecx
+  801dc6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801dc9:	0f b6 01             	movzbl (%ecx),%eax
+  801dcc:	84 c0                	test   %al,%al
+  801dce:	75 ef                	jne    801dbf <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801dd0:	0f b6 c0             	movzbl %al,%eax
+  801dd3:	0f b6 12             	movzbl (%edx),%edx
+  801dd6:	29 d0                	sub    %edx,%eax
+}
+  801dd8:	5d                   	pop    %ebp
+  801dd9:	c3                   	ret
+
+00801dda <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	53                   	push   %ebx
+  801dde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801de1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801de4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  801dec:	85 d2                	test   %edx,%edx
+  801dee:	74 2e                	je     801e1e <strncmp+0x44>
+  801df0:	0f b6 01             	movzbl (%ecx),%eax
+  801df3:	84 c0                	test   %al,%al
+  801df5:	74 16                	je     801e0d <strncmp+0x33>
+  801df7:	3a 03                	cmp    (%ebx),%al
+  801df9:	75 12                	jne    801e0d <strncmp+0x33>
+		n--, p++, q++;
+  801dfb:	83 c1 01             	add    $0x1,%ecx
+  801dfe:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  801e01:	83 ea 01             	sub    $0x1,%edx
+  801e04:	75 ea                	jne    801df0 <strncmp+0x16>
+		return 0;
+  801e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0b:	eb 11                	jmp    801e1e <strncmp+0x44>
+  801e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  801e12:	85 d2                	test   %edx,%edx
+  801e14:	74 08                	je     801e1e <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801e16:	0f b6 01             	movzbl (%ecx),%eax
+  801e19:	0f b6 13             	movzbl (%ebx),%edx
+  801e1c:	29 d0                	sub    %edx,%eax
+}
+  801e1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e29:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801e2d:	0f b6 10             	movzbl (%eax),%edx
+  801e30:	84 d2                	test   %dl,%dl
+  801e32:	74 15                	je     801e49 <strchr+0x26>
+		if (*s == c)
+  801e34:	38 d1                	cmp    %dl,%cl
+  801e36:	74 0f                	je     801e47 <strchr+0x24>
+	for (; *s; s++)
+  801e38:	83 c0 01             	add    $0x1,%eax
+  801e3b:	0f b6 10             	movzbl (%eax),%edx
+  801e3e:	84 d2                	test   %dl,%dl
+  801e40:	75 f2                	jne    801e34 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  801e42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e47:	5d                   	pop    %ebp
+  801e48:	c3                   	ret
+	return 0;
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	eb f7                	jmp    801e47 <strchr+0x24>
+
+00801e50 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	53                   	push   %ebx
+  801e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e57:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  801e5a:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  801e5d:	38 d3                	cmp    %dl,%bl
+  801e5f:	74 14                	je     801e75 <strfind+0x25>
+  801e61:	89 d1                	mov    %edx,%ecx
+  801e63:	84 db                	test   %bl,%bl
+  801e65:	74 0e                	je     801e75 <strfind+0x25>
+	for (; *s; s++)
+  801e67:	83 c0 01             	add    $0x1,%eax
+  801e6a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801e6d:	38 ca                	cmp    %cl,%dl
+  801e6f:	74 04                	je     801e75 <strfind+0x25>
+  801e71:	84 d2                	test   %dl,%dl
+  801e73:	75 f2                	jne    801e67 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  801e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e78:	c9                   	leave
+  801e79:	c3                   	ret
+
+00801e7a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	57                   	push   %edi
+  801e7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e81:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801e84:	85 c9                	test   %ecx,%ecx
+  801e86:	74 20                	je     801ea8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801e88:	89 f8                	mov    %edi,%eax
+  801e8a:	09 c8                	or     %ecx,%eax
+  801e8c:	a8 03                	test   $0x3,%al
+  801e8e:	75 12                	jne    801ea2 <memset+0x28>
+		c &= 0xFF;
+  801e90:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801e94:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801e9a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801e9d:	fc                   	cld
+  801e9e:	f3 ab                	rep stos %eax,%es:(%edi)
+  801ea0:	eb 06                	jmp    801ea8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801ea2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ea5:	fc                   	cld
+  801ea6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801ea8:	89 f8                	mov    %edi,%eax
+  801eaa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801ead:	c9                   	leave
+  801eae:	c3                   	ret
+
+00801eaf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801eaf:	55                   	push   %ebp
+  801eb0:	89 e5                	mov    %esp,%ebp
+  801eb2:	57                   	push   %edi
+  801eb3:	56                   	push   %esi
+  801eb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801eba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801ebd:	39 c6                	cmp    %eax,%esi
+  801ebf:	73 32                	jae    801ef3 <memmove+0x44>
+  801ec1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801ec4:	39 d0                	cmp    %edx,%eax
+  801ec6:	73 2b                	jae    801ef3 <memmove+0x44>
+		s += n;
+		d += n;
+  801ec8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801ecb:	89 d6                	mov    %edx,%esi
+  801ecd:	09 fe                	or     %edi,%esi
+  801ecf:	09 ce                	or     %ecx,%esi
+  801ed1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801ed7:	75 0e                	jne    801ee7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801ed9:	83 ef 04             	sub    $0x4,%edi
+  801edc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801edf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801ee2:	fd                   	std
+  801ee3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801ee5:	eb 09                	jmp    801ef0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801ee7:	83 ef 01             	sub    $0x1,%edi
+  801eea:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801eed:	fd                   	std
+  801eee:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801ef0:	fc                   	cld
+  801ef1:	eb 1a                	jmp    801f0d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801ef3:	89 f2                	mov    %esi,%edx
+  801ef5:	09 c2                	or     %eax,%edx
+  801ef7:	09 ca                	or     %ecx,%edx
+  801ef9:	f6 c2 03             	test   $0x3,%dl
+  801efc:	75 0a                	jne    801f08 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801efe:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801f01:	89 c7                	mov    %eax,%edi
+  801f03:	fc                   	cld
+  801f04:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f06:	eb 05                	jmp    801f0d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801f08:	89 c7                	mov    %eax,%edi
+  801f0a:	fc                   	cld
+  801f0b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801f0d:	5e                   	pop    %esi
+  801f0e:	5f                   	pop    %edi
+  801f0f:	5d                   	pop    %ebp
+  801f10:	c3                   	ret
+
+00801f11 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  801f11:	55                   	push   %ebp
+  801f12:	89 e5                	mov    %esp,%ebp
+  801f14:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801f17:	ff 75 10             	push   0x10(%ebp)
+  801f1a:	ff 75 0c             	push   0xc(%ebp)
+  801f1d:	ff 75 08             	push   0x8(%ebp)
+  801f20:	e8 8a ff ff ff       	call   801eaf <memmove>
+}
+  801f25:	c9                   	leave
+  801f26:	c3                   	ret
+
+00801f27 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801f27:	55                   	push   %ebp
+  801f28:	89 e5                	mov    %esp,%ebp
+  801f2a:	56                   	push   %esi
+  801f2b:	53                   	push   %ebx
+  801f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f32:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801f35:	85 f6                	test   %esi,%esi
+  801f37:	74 29                	je     801f62 <memcmp+0x3b>
+  801f39:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  801f3b:	0f b6 08             	movzbl (%eax),%ecx
+  801f3e:	0f b6 1a             	movzbl (%edx),%ebx
+  801f41:	38 d9                	cmp    %bl,%cl
+  801f43:	75 11                	jne    801f56 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801f45:	83 c0 01             	add    $0x1,%eax
+  801f48:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801f4b:	39 c6                	cmp    %eax,%esi
+  801f4d:	75 ec                	jne    801f3b <memcmp+0x14>
+	}
+
+	return 0;
+  801f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f54:	eb 08                	jmp    801f5e <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  801f56:	0f b6 c1             	movzbl %cl,%eax
+  801f59:	0f b6 db             	movzbl %bl,%ebx
+  801f5c:	29 d8                	sub    %ebx,%eax
+}
+  801f5e:	5b                   	pop    %ebx
+  801f5f:	5e                   	pop    %esi
+  801f60:	5d                   	pop    %ebp
+  801f61:	c3                   	ret
+	return 0;
+  801f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f67:	eb f5                	jmp    801f5e <memcmp+0x37>
+
+00801f69 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801f72:	89 c2                	mov    %eax,%edx
+  801f74:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801f77:	39 d0                	cmp    %edx,%eax
+  801f79:	73 0d                	jae    801f88 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801f7b:	38 08                	cmp    %cl,(%eax)
+  801f7d:	74 0d                	je     801f8c <memfind+0x23>
+	for (; s < ends; s++)
+  801f7f:	83 c0 01             	add    $0x1,%eax
+  801f82:	39 c2                	cmp    %eax,%edx
+  801f84:	75 f5                	jne    801f7b <memfind+0x12>
+  801f86:	eb 06                	jmp    801f8e <memfind+0x25>
+  801f88:	89 c2                	mov    %eax,%edx
+  801f8a:	eb 02                	jmp    801f8e <memfind+0x25>
+  801f8c:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  801f8e:	89 d0                	mov    %edx,%eax
+  801f90:	5d                   	pop    %ebp
+  801f91:	c3                   	ret
+
+00801f92 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801f92:	55                   	push   %ebp
+  801f93:	89 e5                	mov    %esp,%ebp
+  801f95:	57                   	push   %edi
+  801f96:	56                   	push   %esi
+  801f97:	53                   	push   %ebx
+  801f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801f9e:	0f b6 02             	movzbl (%edx),%eax
+  801fa1:	3c 20                	cmp    $0x20,%al
+  801fa3:	74 04                	je     801fa9 <strtol+0x17>
+  801fa5:	3c 09                	cmp    $0x9,%al
+  801fa7:	75 0e                	jne    801fb7 <strtol+0x25>
+		s++;
+  801fa9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801fac:	0f b6 02             	movzbl (%edx),%eax
+  801faf:	3c 20                	cmp    $0x20,%al
+  801fb1:	74 f6                	je     801fa9 <strtol+0x17>
+  801fb3:	3c 09                	cmp    $0x9,%al
+  801fb5:	74 f2                	je     801fa9 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  801fb7:	3c 2b                	cmp    $0x2b,%al
+  801fb9:	74 2a                	je     801fe5 <strtol+0x53>
+	int neg = 0;
+  801fbb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801fc0:	3c 2d                	cmp    $0x2d,%al
+  801fc2:	74 2b                	je     801fef <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801fc4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801fca:	75 0f                	jne    801fdb <strtol+0x49>
+  801fcc:	80 3a 30             	cmpb   $0x30,(%edx)
+  801fcf:	74 28                	je     801ff9 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801fd1:	85 db                	test   %ebx,%ebx
+  801fd3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fd8:	0f 44 d8             	cmove  %eax,%ebx
+  801fdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801fe3:	eb 46                	jmp    80202b <strtol+0x99>
+		s++;
+  801fe5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801fe8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fed:	eb d5                	jmp    801fc4 <strtol+0x32>
+		s++, neg = 1;
+  801fef:	83 c2 01             	add    $0x1,%edx
+  801ff2:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ff7:	eb cb                	jmp    801fc4 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ff9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801ffd:	74 0e                	je     80200d <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  801fff:	85 db                	test   %ebx,%ebx
+  802001:	75 d8                	jne    801fdb <strtol+0x49>
+		s++, base = 8;
+  802003:	83 c2 01             	add    $0x1,%edx
+  802006:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80200b:	eb ce                	jmp    801fdb <strtol+0x49>
+		s += 2, base = 16;
+  80200d:	83 c2 02             	add    $0x2,%edx
+  802010:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802015:	eb c4                	jmp    801fdb <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802017:	0f be c0             	movsbl %al,%eax
+  80201a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80201d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802020:	7d 3a                	jge    80205c <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  802022:	83 c2 01             	add    $0x1,%edx
+  802025:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802029:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80202b:	0f b6 02             	movzbl (%edx),%eax
+  80202e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802031:	89 f3                	mov    %esi,%ebx
+  802033:	80 fb 09             	cmp    $0x9,%bl
+  802036:	76 df                	jbe    802017 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  802038:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80203b:	89 f3                	mov    %esi,%ebx
+  80203d:	80 fb 19             	cmp    $0x19,%bl
+  802040:	77 08                	ja     80204a <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  802042:	0f be c0             	movsbl %al,%eax
+  802045:	83 e8 57             	sub    $0x57,%eax
+  802048:	eb d3                	jmp    80201d <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80204a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80204d:	89 f3                	mov    %esi,%ebx
+  80204f:	80 fb 19             	cmp    $0x19,%bl
+  802052:	77 08                	ja     80205c <strtol+0xca>
+			dig = *s - 'A' + 10;
+  802054:	0f be c0             	movsbl %al,%eax
+  802057:	83 e8 37             	sub    $0x37,%eax
+  80205a:	eb c1                	jmp    80201d <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80205c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802060:	74 05                	je     802067 <strtol+0xd5>
+		*endptr = (char *) s;
+  802062:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802065:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802067:	89 c8                	mov    %ecx,%eax
+  802069:	f7 d8                	neg    %eax
+  80206b:	85 ff                	test   %edi,%edi
+  80206d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802070:	89 c8                	mov    %ecx,%eax
+  802072:	5b                   	pop    %ebx
+  802073:	5e                   	pop    %esi
+  802074:	5f                   	pop    %edi
+  802075:	5d                   	pop    %ebp
+  802076:	c3                   	ret
+
+00802077 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	57                   	push   %edi
+  80207b:	56                   	push   %esi
+  80207c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80207d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802082:	8b 55 08             	mov    0x8(%ebp),%edx
+  802085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802088:	89 c3                	mov    %eax,%ebx
+  80208a:	89 c7                	mov    %eax,%edi
+  80208c:	89 c6                	mov    %eax,%esi
+  80208e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  802090:	5b                   	pop    %ebx
+  802091:	5e                   	pop    %esi
+  802092:	5f                   	pop    %edi
+  802093:	5d                   	pop    %ebp
+  802094:	c3                   	ret
+
+00802095 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802095:	55                   	push   %ebp
+  802096:	89 e5                	mov    %esp,%ebp
+  802098:	57                   	push   %edi
+  802099:	56                   	push   %esi
+  80209a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80209b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020a5:	89 d1                	mov    %edx,%ecx
+  8020a7:	89 d3                	mov    %edx,%ebx
+  8020a9:	89 d7                	mov    %edx,%edi
+  8020ab:	89 d6                	mov    %edx,%esi
+  8020ad:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8020af:	5b                   	pop    %ebx
+  8020b0:	5e                   	pop    %esi
+  8020b1:	5f                   	pop    %edi
+  8020b2:	5d                   	pop    %ebp
+  8020b3:	c3                   	ret
+
+008020b4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8020b4:	55                   	push   %ebp
+  8020b5:	89 e5                	mov    %esp,%ebp
+  8020b7:	57                   	push   %edi
+  8020b8:	56                   	push   %esi
+  8020b9:	53                   	push   %ebx
+  8020ba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8020bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020c5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020ca:	89 cb                	mov    %ecx,%ebx
+  8020cc:	89 cf                	mov    %ecx,%edi
+  8020ce:	89 ce                	mov    %ecx,%esi
+  8020d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8020d2:	85 c0                	test   %eax,%eax
+  8020d4:	7f 08                	jg     8020de <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8020d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d9:	5b                   	pop    %ebx
+  8020da:	5e                   	pop    %esi
+  8020db:	5f                   	pop    %edi
+  8020dc:	5d                   	pop    %ebp
+  8020dd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020de:	83 ec 0c             	sub    $0xc,%esp
+  8020e1:	50                   	push   %eax
+  8020e2:	6a 03                	push   $0x3
+  8020e4:	68 ab 6e 80 00       	push   $0x806eab
+  8020e9:	6a 23                	push   $0x23
+  8020eb:	68 c8 6e 80 00       	push   $0x806ec8
+  8020f0:	e8 38 f4 ff ff       	call   80152d <_panic>
+
+008020f5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8020f5:	55                   	push   %ebp
+  8020f6:	89 e5                	mov    %esp,%ebp
+  8020f8:	57                   	push   %edi
+  8020f9:	56                   	push   %esi
+  8020fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8020fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802100:	b8 02 00 00 00       	mov    $0x2,%eax
+  802105:	89 d1                	mov    %edx,%ecx
+  802107:	89 d3                	mov    %edx,%ebx
+  802109:	89 d7                	mov    %edx,%edi
+  80210b:	89 d6                	mov    %edx,%esi
+  80210d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80210f:	5b                   	pop    %ebx
+  802110:	5e                   	pop    %esi
+  802111:	5f                   	pop    %edi
+  802112:	5d                   	pop    %ebp
+  802113:	c3                   	ret
+
+00802114 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802114:	55                   	push   %ebp
+  802115:	89 e5                	mov    %esp,%ebp
+  802117:	57                   	push   %edi
+  802118:	56                   	push   %esi
+  802119:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80211a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802124:	89 d1                	mov    %edx,%ecx
+  802126:	89 d3                	mov    %edx,%ebx
+  802128:	89 d7                	mov    %edx,%edi
+  80212a:	89 d6                	mov    %edx,%esi
+  80212c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80212e:	5b                   	pop    %ebx
+  80212f:	5e                   	pop    %esi
+  802130:	5f                   	pop    %edi
+  802131:	5d                   	pop    %ebp
+  802132:	c3                   	ret
+
+00802133 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802133:	55                   	push   %ebp
+  802134:	89 e5                	mov    %esp,%ebp
+  802136:	57                   	push   %edi
+  802137:	56                   	push   %esi
+  802138:	53                   	push   %ebx
+  802139:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80213c:	be 00 00 00 00       	mov    $0x0,%esi
+  802141:	8b 55 08             	mov    0x8(%ebp),%edx
+  802144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802147:	b8 04 00 00 00       	mov    $0x4,%eax
+  80214c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80214f:	89 f7                	mov    %esi,%edi
+  802151:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802153:	85 c0                	test   %eax,%eax
+  802155:	7f 08                	jg     80215f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  802157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215a:	5b                   	pop    %ebx
+  80215b:	5e                   	pop    %esi
+  80215c:	5f                   	pop    %edi
+  80215d:	5d                   	pop    %ebp
+  80215e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80215f:	83 ec 0c             	sub    $0xc,%esp
+  802162:	50                   	push   %eax
+  802163:	6a 04                	push   $0x4
+  802165:	68 ab 6e 80 00       	push   $0x806eab
+  80216a:	6a 23                	push   $0x23
+  80216c:	68 c8 6e 80 00       	push   $0x806ec8
+  802171:	e8 b7 f3 ff ff       	call   80152d <_panic>
+
+00802176 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802176:	55                   	push   %ebp
+  802177:	89 e5                	mov    %esp,%ebp
+  802179:	57                   	push   %edi
+  80217a:	56                   	push   %esi
+  80217b:	53                   	push   %ebx
+  80217c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80217f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802182:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802185:	b8 05 00 00 00       	mov    $0x5,%eax
+  80218a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80218d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802190:	8b 75 18             	mov    0x18(%ebp),%esi
+  802193:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802195:	85 c0                	test   %eax,%eax
+  802197:	7f 08                	jg     8021a1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  802199:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80219c:	5b                   	pop    %ebx
+  80219d:	5e                   	pop    %esi
+  80219e:	5f                   	pop    %edi
+  80219f:	5d                   	pop    %ebp
+  8021a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021a1:	83 ec 0c             	sub    $0xc,%esp
+  8021a4:	50                   	push   %eax
+  8021a5:	6a 05                	push   $0x5
+  8021a7:	68 ab 6e 80 00       	push   $0x806eab
+  8021ac:	6a 23                	push   $0x23
+  8021ae:	68 c8 6e 80 00       	push   $0x806ec8
+  8021b3:	e8 75 f3 ff ff       	call   80152d <_panic>
+
+008021b8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	57                   	push   %edi
+  8021bc:	56                   	push   %esi
+  8021bd:	53                   	push   %ebx
+  8021be:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8021c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021cc:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021d1:	89 df                	mov    %ebx,%edi
+  8021d3:	89 de                	mov    %ebx,%esi
+  8021d5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	7f 08                	jg     8021e3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8021db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021de:	5b                   	pop    %ebx
+  8021df:	5e                   	pop    %esi
+  8021e0:	5f                   	pop    %edi
+  8021e1:	5d                   	pop    %ebp
+  8021e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021e3:	83 ec 0c             	sub    $0xc,%esp
+  8021e6:	50                   	push   %eax
+  8021e7:	6a 06                	push   $0x6
+  8021e9:	68 ab 6e 80 00       	push   $0x806eab
+  8021ee:	6a 23                	push   $0x23
+  8021f0:	68 c8 6e 80 00       	push   $0x806ec8
+  8021f5:	e8 33 f3 ff ff       	call   80152d <_panic>
+
+008021fa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	57                   	push   %edi
+  8021fe:	56                   	push   %esi
+  8021ff:	53                   	push   %ebx
+  802200:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802203:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80220b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80220e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802213:	89 df                	mov    %ebx,%edi
+  802215:	89 de                	mov    %ebx,%esi
+  802217:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802219:	85 c0                	test   %eax,%eax
+  80221b:	7f 08                	jg     802225 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80221d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802220:	5b                   	pop    %ebx
+  802221:	5e                   	pop    %esi
+  802222:	5f                   	pop    %edi
+  802223:	5d                   	pop    %ebp
+  802224:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802225:	83 ec 0c             	sub    $0xc,%esp
+  802228:	50                   	push   %eax
+  802229:	6a 08                	push   $0x8
+  80222b:	68 ab 6e 80 00       	push   $0x806eab
+  802230:	6a 23                	push   $0x23
+  802232:	68 c8 6e 80 00       	push   $0x806ec8
+  802237:	e8 f1 f2 ff ff       	call   80152d <_panic>
+
+0080223c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	57                   	push   %edi
+  802240:	56                   	push   %esi
+  802241:	53                   	push   %ebx
+  802242:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80224a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80224d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802250:	b8 09 00 00 00       	mov    $0x9,%eax
+  802255:	89 df                	mov    %ebx,%edi
+  802257:	89 de                	mov    %ebx,%esi
+  802259:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	7f 08                	jg     802267 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80225f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802262:	5b                   	pop    %ebx
+  802263:	5e                   	pop    %esi
+  802264:	5f                   	pop    %edi
+  802265:	5d                   	pop    %ebp
+  802266:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802267:	83 ec 0c             	sub    $0xc,%esp
+  80226a:	50                   	push   %eax
+  80226b:	6a 09                	push   $0x9
+  80226d:	68 ab 6e 80 00       	push   $0x806eab
+  802272:	6a 23                	push   $0x23
+  802274:	68 c8 6e 80 00       	push   $0x806ec8
+  802279:	e8 af f2 ff ff       	call   80152d <_panic>
+
+0080227e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80227e:	55                   	push   %ebp
+  80227f:	89 e5                	mov    %esp,%ebp
+  802281:	57                   	push   %edi
+  802282:	56                   	push   %esi
+  802283:	53                   	push   %ebx
+  802284:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802287:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80228c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80228f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802292:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802297:	89 df                	mov    %ebx,%edi
+  802299:	89 de                	mov    %ebx,%esi
+  80229b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	7f 08                	jg     8022a9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8022a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a4:	5b                   	pop    %ebx
+  8022a5:	5e                   	pop    %esi
+  8022a6:	5f                   	pop    %edi
+  8022a7:	5d                   	pop    %ebp
+  8022a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8022a9:	83 ec 0c             	sub    $0xc,%esp
+  8022ac:	50                   	push   %eax
+  8022ad:	6a 0a                	push   $0xa
+  8022af:	68 ab 6e 80 00       	push   $0x806eab
+  8022b4:	6a 23                	push   $0x23
+  8022b6:	68 c8 6e 80 00       	push   $0x806ec8
+  8022bb:	e8 6d f2 ff ff       	call   80152d <_panic>
+
+008022c0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	57                   	push   %edi
+  8022c4:	56                   	push   %esi
+  8022c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8022c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8022d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022dc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8022de:	5b                   	pop    %ebx
+  8022df:	5e                   	pop    %esi
+  8022e0:	5f                   	pop    %edi
+  8022e1:	5d                   	pop    %ebp
+  8022e2:	c3                   	ret
+
+008022e3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8022e3:	55                   	push   %ebp
+  8022e4:	89 e5                	mov    %esp,%ebp
+  8022e6:	57                   	push   %edi
+  8022e7:	56                   	push   %esi
+  8022e8:	53                   	push   %ebx
+  8022e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8022ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8022f9:	89 cb                	mov    %ecx,%ebx
+  8022fb:	89 cf                	mov    %ecx,%edi
+  8022fd:	89 ce                	mov    %ecx,%esi
+  8022ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802301:	85 c0                	test   %eax,%eax
+  802303:	7f 08                	jg     80230d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  802305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802308:	5b                   	pop    %ebx
+  802309:	5e                   	pop    %esi
+  80230a:	5f                   	pop    %edi
+  80230b:	5d                   	pop    %ebp
+  80230c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80230d:	83 ec 0c             	sub    $0xc,%esp
+  802310:	50                   	push   %eax
+  802311:	6a 0d                	push   $0xd
+  802313:	68 ab 6e 80 00       	push   $0x806eab
+  802318:	6a 23                	push   $0x23
+  80231a:	68 c8 6e 80 00       	push   $0x806ec8
+  80231f:	e8 09 f2 ff ff       	call   80152d <_panic>
+
+00802324 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	57                   	push   %edi
+  802328:	56                   	push   %esi
+  802329:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80232a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80232d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802330:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802335:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802338:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80233b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80233e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  802340:	5b                   	pop    %ebx
+  802341:	5e                   	pop    %esi
+  802342:	5f                   	pop    %edi
+  802343:	5d                   	pop    %ebp
+  802344:	c3                   	ret
+
+00802345 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  802345:	55                   	push   %ebp
+  802346:	89 e5                	mov    %esp,%ebp
+  802348:	57                   	push   %edi
+  802349:	56                   	push   %esi
+  80234a:	53                   	push   %ebx
+  80234b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80234e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802353:	8b 55 08             	mov    0x8(%ebp),%edx
+  802356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802359:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80235e:	89 df                	mov    %ebx,%edi
+  802360:	89 de                	mov    %ebx,%esi
+  802362:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802364:	85 c0                	test   %eax,%eax
+  802366:	7f 08                	jg     802370 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  802368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236b:	5b                   	pop    %ebx
+  80236c:	5e                   	pop    %esi
+  80236d:	5f                   	pop    %edi
+  80236e:	5d                   	pop    %ebp
+  80236f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802370:	83 ec 0c             	sub    $0xc,%esp
+  802373:	50                   	push   %eax
+  802374:	6a 0d                	push   $0xd
+  802376:	68 ab 6e 80 00       	push   $0x806eab
+  80237b:	6a 23                	push   $0x23
+  80237d:	68 c8 6e 80 00       	push   $0x806ec8
+  802382:	e8 a6 f1 ff ff       	call   80152d <_panic>
+
+00802387 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	57                   	push   %edi
+  80238b:	56                   	push   %esi
+  80238c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80238d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802392:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802397:	89 d1                	mov    %edx,%ecx
+  802399:	89 d3                	mov    %edx,%ebx
+  80239b:	89 d7                	mov    %edx,%edi
+  80239d:	89 d6                	mov    %edx,%esi
+  80239f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8023a1:	5b                   	pop    %ebx
+  8023a2:	5e                   	pop    %esi
+  8023a3:	5f                   	pop    %edi
+  8023a4:	5d                   	pop    %ebp
+  8023a5:	c3                   	ret
+
+008023a6 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8023a6:	55                   	push   %ebp
+  8023a7:	89 e5                	mov    %esp,%ebp
+  8023a9:	57                   	push   %edi
+  8023aa:	56                   	push   %esi
+  8023ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8023ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8023bc:	89 df                	mov    %ebx,%edi
+  8023be:	89 de                	mov    %ebx,%esi
+  8023c0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8023c2:	5b                   	pop    %ebx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5f                   	pop    %edi
+  8023c5:	5d                   	pop    %ebp
+  8023c6:	c3                   	ret
+
+008023c7 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8023c7:	55                   	push   %ebp
+  8023c8:	89 e5                	mov    %esp,%ebp
+  8023ca:	57                   	push   %edi
+  8023cb:	56                   	push   %esi
+  8023cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8023cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023d5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8023da:	89 cb                	mov    %ecx,%ebx
+  8023dc:	89 cf                	mov    %ecx,%edi
+  8023de:	89 ce                	mov    %ecx,%esi
+  8023e0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8023e2:	5b                   	pop    %ebx
+  8023e3:	5e                   	pop    %esi
+  8023e4:	5f                   	pop    %edi
+  8023e5:	5d                   	pop    %ebp
+  8023e6:	c3                   	ret
+
+008023e7 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	57                   	push   %edi
+  8023eb:	56                   	push   %esi
+  8023ec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8023ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023f8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8023fd:	89 df                	mov    %ebx,%edi
+  8023ff:	89 de                	mov    %ebx,%esi
+  802401:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  802403:	5b                   	pop    %ebx
+  802404:	5e                   	pop    %esi
+  802405:	5f                   	pop    %edi
+  802406:	5d                   	pop    %ebp
+  802407:	c3                   	ret
+
+00802408 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  802408:	55                   	push   %ebp
+  802409:	89 e5                	mov    %esp,%ebp
+  80240b:	57                   	push   %edi
+  80240c:	56                   	push   %esi
+  80240d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80240e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802413:	8b 55 08             	mov    0x8(%ebp),%edx
+  802416:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802419:	b8 12 00 00 00       	mov    $0x12,%eax
+  80241e:	89 df                	mov    %ebx,%edi
+  802420:	89 de                	mov    %ebx,%esi
+  802422:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  802424:	5b                   	pop    %ebx
+  802425:	5e                   	pop    %esi
+  802426:	5f                   	pop    %edi
+  802427:	5d                   	pop    %ebp
+  802428:	c3                   	ret
+
+00802429 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	57                   	push   %edi
+  80242d:	56                   	push   %esi
+  80242e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80242f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802434:	8b 55 08             	mov    0x8(%ebp),%edx
+  802437:	b8 13 00 00 00       	mov    $0x13,%eax
+  80243c:	89 cb                	mov    %ecx,%ebx
+  80243e:	89 cf                	mov    %ecx,%edi
+  802440:	89 ce                	mov    %ecx,%esi
+  802442:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  802444:	5b                   	pop    %ebx
+  802445:	5e                   	pop    %esi
+  802446:	5f                   	pop    %edi
+  802447:	5d                   	pop    %ebp
+  802448:	c3                   	ret
+
+00802449 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  802449:	55                   	push   %ebp
+  80244a:	89 e5                	mov    %esp,%ebp
+  80244c:	57                   	push   %edi
+  80244d:	56                   	push   %esi
+  80244e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80244f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802454:	8b 55 08             	mov    0x8(%ebp),%edx
+  802457:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80245a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80245f:	89 df                	mov    %ebx,%edi
+  802461:	89 de                	mov    %ebx,%esi
+  802463:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  802465:	5b                   	pop    %ebx
+  802466:	5e                   	pop    %esi
+  802467:	5f                   	pop    %edi
+  802468:	5d                   	pop    %ebp
+  802469:	c3                   	ret
+
+0080246a <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80246a:	55                   	push   %ebp
+  80246b:	89 e5                	mov    %esp,%ebp
+  80246d:	57                   	push   %edi
+  80246e:	56                   	push   %esi
+  80246f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802470:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802475:	8b 55 08             	mov    0x8(%ebp),%edx
+  802478:	b8 15 00 00 00       	mov    $0x15,%eax
+  80247d:	89 cb                	mov    %ecx,%ebx
+  80247f:	89 cf                	mov    %ecx,%edi
+  802481:	89 ce                	mov    %ecx,%esi
+  802483:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  802485:	5b                   	pop    %ebx
+  802486:	5e                   	pop    %esi
+  802487:	5f                   	pop    %edi
+  802488:	5d                   	pop    %ebp
+  802489:	c3                   	ret
+
+0080248a <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80248a:	55                   	push   %ebp
+  80248b:	89 e5                	mov    %esp,%ebp
+  80248d:	57                   	push   %edi
+  80248e:	56                   	push   %esi
+  80248f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802490:	be 00 00 00 00       	mov    $0x0,%esi
+  802495:	8b 55 08             	mov    0x8(%ebp),%edx
+  802498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80249b:	b8 16 00 00 00       	mov    $0x16,%eax
+  8024a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024a3:	89 f7                	mov    %esi,%edi
+  8024a5:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8024a7:	5b                   	pop    %ebx
+  8024a8:	5e                   	pop    %esi
+  8024a9:	5f                   	pop    %edi
+  8024aa:	5d                   	pop    %ebp
+  8024ab:	c3                   	ret
+
+008024ac <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	57                   	push   %edi
+  8024b0:	56                   	push   %esi
+  8024b1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8024b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024bd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8024c2:	89 df                	mov    %ebx,%edi
+  8024c4:	89 de                	mov    %ebx,%esi
+  8024c6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8024c8:	5b                   	pop    %ebx
+  8024c9:	5e                   	pop    %esi
+  8024ca:	5f                   	pop    %edi
+  8024cb:	5d                   	pop    %ebp
+  8024cc:	c3                   	ret
+
+008024cd <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	57                   	push   %edi
+  8024d1:	56                   	push   %esi
+  8024d2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8024d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024db:	b8 18 00 00 00       	mov    $0x18,%eax
+  8024e0:	89 cb                	mov    %ecx,%ebx
+  8024e2:	89 cf                	mov    %ecx,%edi
+  8024e4:	89 ce                	mov    %ecx,%esi
+  8024e6:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8024e8:	5b                   	pop    %ebx
+  8024e9:	5e                   	pop    %esi
+  8024ea:	5f                   	pop    %edi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+
+008024ed <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	57                   	push   %edi
+  8024f1:	56                   	push   %esi
+  8024f2:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8024f3:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8024f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024ff:	b8 19 00 00 00       	mov    $0x19,%eax
+  802504:	89 df                	mov    %ebx,%edi
+  802506:	89 de                	mov    %ebx,%esi
+  802508:	cd 30                	int    $0x30
+}
+  80250a:	5b                   	pop    %ebx
+  80250b:	5e                   	pop    %esi
+  80250c:	5f                   	pop    %edi
+  80250d:	5d                   	pop    %ebp
+  80250e:	c3                   	ret
+
+0080250f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80250f:	55                   	push   %ebp
+  802510:	89 e5                	mov    %esp,%ebp
+  802512:	57                   	push   %edi
+  802513:	56                   	push   %esi
+  802514:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802515:	be 00 00 00 00       	mov    $0x0,%esi
+  80251a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80251d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802520:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  802525:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802528:	89 f7                	mov    %esi,%edi
+  80252a:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80252c:	5b                   	pop    %ebx
+  80252d:	5e                   	pop    %esi
+  80252e:	5f                   	pop    %edi
+  80252f:	5d                   	pop    %ebp
+  802530:	c3                   	ret
+
+00802531 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  802531:	55                   	push   %ebp
+  802532:	89 e5                	mov    %esp,%ebp
+  802534:	57                   	push   %edi
+  802535:	56                   	push   %esi
+  802536:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802537:	be 00 00 00 00       	mov    $0x0,%esi
+  80253c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80253f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802542:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  802547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80254a:	89 f7                	mov    %esi,%edi
+  80254c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80254e:	5b                   	pop    %ebx
+  80254f:	5e                   	pop    %esi
+  802550:	5f                   	pop    %edi
+  802551:	5d                   	pop    %ebp
+  802552:	c3                   	ret
+
+00802553 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802553:	55                   	push   %ebp
+  802554:	89 e5                	mov    %esp,%ebp
+  802556:	57                   	push   %edi
+  802557:	56                   	push   %esi
+  802558:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80255e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802561:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802564:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  802569:	89 df                	mov    %ebx,%edi
+  80256b:	89 de                	mov    %ebx,%esi
+  80256d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80256f:	5b                   	pop    %ebx
+  802570:	5e                   	pop    %esi
+  802571:	5f                   	pop    %edi
+  802572:	5d                   	pop    %ebp
+  802573:	c3                   	ret
+
+00802574 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  802574:	55                   	push   %ebp
+  802575:	89 e5                	mov    %esp,%ebp
+  802577:	57                   	push   %edi
+  802578:	56                   	push   %esi
+  802579:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80257a:	be 00 00 00 00       	mov    $0x0,%esi
+  80257f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802582:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802585:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80258a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80258d:	89 f7                	mov    %esi,%edi
+  80258f:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  802591:	5b                   	pop    %ebx
+  802592:	5e                   	pop    %esi
+  802593:	5f                   	pop    %edi
+  802594:	5d                   	pop    %ebp
+  802595:	c3                   	ret
+
+00802596 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  802596:	85 c0                	test   %eax,%eax
+  802598:	74 20                	je     8025ba <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80259a:	89 c1                	mov    %eax,%ecx
+  80259c:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8025a2:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8025a8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8025ae:	8b 52 48             	mov    0x48(%edx),%edx
+  8025b1:	39 c2                	cmp    %eax,%edx
+  8025b3:	74 06                	je     8025bb <thread_alive+0x25>
+  8025b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025ba:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8025bb:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8025c1:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8025c7:	85 c0                	test   %eax,%eax
+  8025c9:	0f 95 c0             	setne  %al
+  8025cc:	0f b6 c0             	movzbl %al,%eax
+  8025cf:	c3                   	ret
+
+008025d0 <pgfault>:
+{
+  8025d0:	55                   	push   %ebp
+  8025d1:	89 e5                	mov    %esp,%ebp
+  8025d3:	57                   	push   %edi
+  8025d4:	56                   	push   %esi
+  8025d5:	53                   	push   %ebx
+  8025d6:	83 ec 0c             	sub    $0xc,%esp
+  8025d9:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8025dc:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8025de:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8025e1:	89 f3                	mov    %esi,%ebx
+  8025e3:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8025e6:	83 3d 00 f9 80 00 00 	cmpl   $0x0,0x80f900
+  8025ed:	74 52                	je     802641 <pgfault+0x71>
+  8025ef:	a8 02                	test   $0x2,%al
+  8025f1:	75 14                	jne    802607 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8025f3:	83 ec 04             	sub    $0x4,%esp
+  8025f6:	68 d6 6e 80 00       	push   $0x806ed6
+  8025fb:	6a 2e                	push   $0x2e
+  8025fd:	68 f4 6e 80 00       	push   $0x806ef4
+  802602:	e8 26 ef ff ff       	call   80152d <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  802607:	89 d8                	mov    %ebx,%eax
+  802609:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80260e:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  802615:	83 ec 0c             	sub    $0xc,%esp
+  802618:	57                   	push   %edi
+  802619:	e8 05 36 00 00       	call   805c23 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80261e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802625:	83 e0 03             	and    $0x3,%eax
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	83 f8 03             	cmp    $0x3,%eax
+  80262e:	75 1a                	jne    80264a <pgfault+0x7a>
+			mutex_unlock(m);
+  802630:	83 ec 0c             	sub    $0xc,%esp
+  802633:	57                   	push   %edi
+  802634:	e8 58 36 00 00       	call   805c91 <mutex_unlock>
+			return;
+  802639:	83 c4 10             	add    $0x10,%esp
+  80263c:	e9 9f 00 00 00       	jmp    8026e0 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  802641:	a8 02                	test   $0x2,%al
+  802643:	74 ae                	je     8025f3 <pgfault+0x23>
+	struct mutex *m = NULL;
+  802645:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80264a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802651:	f6 c4 08             	test   $0x8,%ah
+  802654:	74 9d                	je     8025f3 <pgfault+0x23>
+  802656:	89 e0                	mov    %esp,%eax
+  802658:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80265d:	29 c2                	sub    %eax,%edx
+  80265f:	89 d0                	mov    %edx,%eax
+  802661:	c1 e8 0f             	shr    $0xf,%eax
+  802664:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80266a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266f:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  802672:	c1 e0 0c             	shl    $0xc,%eax
+  802675:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80267a:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80267c:	83 ec 04             	sub    $0x4,%esp
+  80267f:	6a 07                	push   $0x7
+  802681:	53                   	push   %ebx
+  802682:	6a 00                	push   $0x0
+  802684:	e8 aa fa ff ff       	call   802133 <sys_page_alloc>
+  802689:	83 c4 10             	add    $0x10,%esp
+  80268c:	85 c0                	test   %eax,%eax
+  80268e:	78 58                	js     8026e8 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802690:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802696:	83 ec 04             	sub    $0x4,%esp
+  802699:	68 00 10 00 00       	push   $0x1000
+  80269e:	56                   	push   %esi
+  80269f:	53                   	push   %ebx
+  8026a0:	e8 0a f8 ff ff       	call   801eaf <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8026a5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8026ac:	56                   	push   %esi
+  8026ad:	6a 00                	push   $0x0
+  8026af:	53                   	push   %ebx
+  8026b0:	6a 00                	push   $0x0
+  8026b2:	e8 bf fa ff ff       	call   802176 <sys_page_map>
+  8026b7:	83 c4 20             	add    $0x20,%esp
+  8026ba:	85 c0                	test   %eax,%eax
+  8026bc:	78 3c                	js     8026fa <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8026be:	83 ec 08             	sub    $0x8,%esp
+  8026c1:	53                   	push   %ebx
+  8026c2:	6a 00                	push   $0x0
+  8026c4:	e8 ef fa ff ff       	call   8021b8 <sys_page_unmap>
+  8026c9:	83 c4 10             	add    $0x10,%esp
+  8026cc:	85 c0                	test   %eax,%eax
+  8026ce:	78 3c                	js     80270c <pgfault+0x13c>
+	if(m)
+  8026d0:	85 ff                	test   %edi,%edi
+  8026d2:	74 0c                	je     8026e0 <pgfault+0x110>
+		mutex_unlock(m);
+  8026d4:	83 ec 0c             	sub    $0xc,%esp
+  8026d7:	57                   	push   %edi
+  8026d8:	e8 b4 35 00 00       	call   805c91 <mutex_unlock>
+  8026dd:	83 c4 10             	add    $0x10,%esp
+}
+  8026e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e3:	5b                   	pop    %ebx
+  8026e4:	5e                   	pop    %esi
+  8026e5:	5f                   	pop    %edi
+  8026e6:	5d                   	pop    %ebp
+  8026e7:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8026e8:	50                   	push   %eax
+  8026e9:	68 ff 6e 80 00       	push   $0x806eff
+  8026ee:	6a 3d                	push   $0x3d
+  8026f0:	68 f4 6e 80 00       	push   $0x806ef4
+  8026f5:	e8 33 ee ff ff       	call   80152d <_panic>
+		panic("sys_page_map: %e", ret);
+  8026fa:	50                   	push   %eax
+  8026fb:	68 12 6f 80 00       	push   $0x806f12
+  802700:	6a 40                	push   $0x40
+  802702:	68 f4 6e 80 00       	push   $0x806ef4
+  802707:	e8 21 ee ff ff       	call   80152d <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80270c:	50                   	push   %eax
+  80270d:	68 23 6f 80 00       	push   $0x806f23
+  802712:	6a 42                	push   $0x42
+  802714:	68 f4 6e 80 00       	push   $0x806ef4
+  802719:	e8 0f ee ff ff       	call   80152d <_panic>
+
+0080271e <thread_main>:
+{
+  80271e:	55                   	push   %ebp
+  80271f:	89 e5                	mov    %esp,%ebp
+  802721:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  802724:	ff 75 0c             	push   0xc(%ebp)
+  802727:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80272a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802731:	e8 7e f9 ff ff       	call   8020b4 <sys_env_destroy>
+}
+  802736:	83 c4 10             	add    $0x10,%esp
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+0080273b <fork>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	57                   	push   %edi
+  80273f:	56                   	push   %esi
+  802740:	53                   	push   %ebx
+  802741:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  802744:	68 d0 25 80 00       	push   $0x8025d0
+  802749:	e8 21 38 00 00       	call   805f6f <set_pgfault_handler>
+	if(sforked)
+  80274e:	83 c4 10             	add    $0x10,%esp
+  802751:	83 3d 00 f9 80 00 00 	cmpl   $0x0,0x80f900
+  802758:	75 33                	jne    80278d <fork+0x52>
+	__asm __volatile("int %2"
+  80275a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80275f:	cd 30                	int    $0x30
+  802761:	89 c7                	mov    %eax,%edi
+  802763:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  802765:	85 c0                	test   %eax,%eax
+  802767:	0f 88 b4 00 00 00    	js     802821 <fork+0xe6>
+	if(envid == 0) {
+  80276d:	0f 84 c3 00 00 00    	je     802836 <fork+0xfb>
+	pgbatch_init(&pb);
+  802773:	83 ec 0c             	sub    $0xc,%esp
+  802776:	68 a0 ec 80 00       	push   $0x80eca0
+  80277b:	e8 ef 32 00 00       	call   805a6f <pgbatch_init>
+  802780:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802783:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802788:	e9 9c 01 00 00       	jmp    802929 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80278d:	83 ec 0c             	sub    $0xc,%esp
+  802790:	68 40 f0 80 00       	push   $0x80f040
+  802795:	e8 89 34 00 00       	call   805c23 <mutex_lock>
+  80279a:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80279d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8027a2:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8027a7:	eb 08                	jmp    8027b1 <fork+0x76>
+  8027a9:	83 c3 01             	add    $0x1,%ebx
+  8027ac:	83 fb 20             	cmp    $0x20,%ebx
+  8027af:	74 5b                	je     80280c <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8027b1:	8b 34 9d c0 ef 80 00 	mov    0x80efc0(,%ebx,4),%esi
+  8027b8:	89 f0                	mov    %esi,%eax
+  8027ba:	e8 d7 fd ff ff       	call   802596 <thread_alive>
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	74 e6                	je     8027a9 <fork+0x6e>
+  8027c3:	89 e0                	mov    %esp,%eax
+  8027c5:	89 fa                	mov    %edi,%edx
+  8027c7:	29 c2                	sub    %eax,%edx
+  8027c9:	89 d0                	mov    %edx,%eax
+  8027cb:	c1 e8 0f             	shr    $0xf,%eax
+  8027ce:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8027d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d9:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8027dc:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  8027e3:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8027e6:	83 ec 08             	sub    $0x8,%esp
+  8027e9:	50                   	push   %eax
+  8027ea:	56                   	push   %esi
+  8027eb:	e8 8e fa ff ff       	call   80227e <sys_env_set_pgfault_upcall>
+  8027f0:	83 c4 10             	add    $0x10,%esp
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	79 b2                	jns    8027a9 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8027f7:	50                   	push   %eax
+  8027f8:	68 b0 6f 80 00       	push   $0x806fb0
+  8027fd:	68 00 01 00 00       	push   $0x100
+  802802:	68 f4 6e 80 00       	push   $0x806ef4
+  802807:	e8 21 ed ff ff       	call   80152d <_panic>
+	mutex_unlock(&sfork_lock);
+  80280c:	83 ec 0c             	sub    $0xc,%esp
+  80280f:	68 40 f0 80 00       	push   $0x80f040
+  802814:	e8 78 34 00 00       	call   805c91 <mutex_unlock>
+}
+  802819:	83 c4 10             	add    $0x10,%esp
+  80281c:	e9 39 ff ff ff       	jmp    80275a <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  802821:	50                   	push   %eax
+  802822:	68 36 6f 80 00       	push   $0x806f36
+  802827:	68 91 00 00 00       	push   $0x91
+  80282c:	68 f4 6e 80 00       	push   $0x806ef4
+  802831:	e8 f7 ec ff ff       	call   80152d <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802836:	e8 ba f8 ff ff       	call   8020f5 <sys_getenvid>
+  80283b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802840:	89 e1                	mov    %esp,%ecx
+  802842:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  802847:	29 ca                	sub    %ecx,%edx
+  802849:	89 d1                	mov    %edx,%ecx
+  80284b:	c1 e9 0f             	shr    $0xf,%ecx
+  80284e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802854:	ba 00 00 00 00       	mov    $0x0,%edx
+  802859:	0f 42 d1             	cmovb  %ecx,%edx
+  80285c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  802862:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802867:	89 04 95 80 f8 80 00 	mov    %eax,0x80f880(,%edx,4)
+		if(sforked)
+  80286e:	a1 00 f9 80 00       	mov    0x80f900,%eax
+  802873:	85 c0                	test   %eax,%eax
+  802875:	75 07                	jne    80287e <fork+0x143>
+		return 0;
+  802877:	89 c6                	mov    %eax,%esi
+  802879:	e9 6f 02 00 00       	jmp    802aed <fork+0x3b2>
+  80287e:	89 e2                	mov    %esp,%edx
+  802880:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802885:	29 d0                	sub    %edx,%eax
+  802887:	89 c3                	mov    %eax,%ebx
+  802889:	c1 eb 0f             	shr    $0xf,%ebx
+  80288c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+  802896:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  802899:	83 ec 04             	sub    $0x4,%esp
+  80289c:	68 80 00 00 00       	push   $0x80
+  8028a1:	6a 00                	push   $0x0
+  8028a3:	68 c0 ef 80 00       	push   $0x80efc0
+  8028a8:	e8 cd f5 ff ff       	call   801e7a <memset>
+	thread_ids[slot] = sys_getenvid();
+  8028ad:	e8 43 f8 ff ff       	call   8020f5 <sys_getenvid>
+  8028b2:	89 04 9d c0 ef 80 00 	mov    %eax,0x80efc0(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8028b9:	8b 04 9d 80 f8 80 00 	mov    0x80f880(,%ebx,4),%eax
+  8028c0:	a3 80 f8 80 00       	mov    %eax,0x80f880
+	mutex_init(&sfork_lock);
+  8028c5:	c7 04 24 40 f0 80 00 	movl   $0x80f040,(%esp)
+  8028cc:	e8 44 33 00 00       	call   805c15 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8028d1:	83 c4 0c             	add    $0xc,%esp
+  8028d4:	68 07 04 00 00       	push   $0x407
+  8028d9:	68 00 00 00 e1       	push   $0xe1000000
+  8028de:	6a 00                	push   $0x0
+  8028e0:	e8 4e f8 ff ff       	call   802133 <sys_page_alloc>
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	85 c0                	test   %eax,%eax
+  8028ea:	0f 89 fd 01 00 00    	jns    802aed <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8028f0:	50                   	push   %eax
+  8028f1:	68 ff 6e 80 00       	push   $0x806eff
+  8028f6:	68 12 01 00 00       	push   $0x112
+  8028fb:	68 f4 6e 80 00       	push   $0x806ef4
+  802900:	e8 28 ec ff ff       	call   80152d <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  802905:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80290b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  802911:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802917:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80291d:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  802923:	0f 87 4f 01 00 00    	ja     802a78 <fork+0x33d>
+		pd = PDX(addr);
+  802929:	89 d8                	mov    %ebx,%eax
+  80292b:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80292e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802935:	f6 c2 01             	test   $0x1,%dl
+  802938:	74 cb                	je     802905 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80293a:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80293f:	0f 85 92 00 00 00    	jne    8029d7 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  802945:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80294b:	76 10                	jbe    80295d <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80294d:	89 d8                	mov    %ebx,%eax
+  80294f:	f7 d8                	neg    %eax
+  802951:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802956:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80295b:	74 ba                	je     802917 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80295d:	89 d8                	mov    %ebx,%eax
+  80295f:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  802962:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802969:	f6 c2 01             	test   $0x1,%dl
+  80296c:	74 a9                	je     802917 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  80296e:	89 c1                	mov    %eax,%ecx
+  802970:	c1 e1 0c             	shl    $0xc,%ecx
+  802973:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  802976:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80297d:	f6 c6 04             	test   $0x4,%dh
+  802980:	0f 85 8e 00 00 00    	jne    802a14 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  802986:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80298d:	f6 c6 08             	test   $0x8,%dh
+  802990:	75 0f                	jne    8029a1 <fork+0x266>
+  802992:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802999:	a8 02                	test   $0x2,%al
+  80299b:	0f 84 bb 00 00 00    	je     802a5c <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8029a1:	83 ec 08             	sub    $0x8,%esp
+  8029a4:	68 05 08 00 00       	push   $0x805
+  8029a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ac:	50                   	push   %eax
+  8029ad:	56                   	push   %esi
+  8029ae:	50                   	push   %eax
+  8029af:	6a 00                	push   $0x0
+  8029b1:	68 a0 ec 80 00       	push   $0x80eca0
+  8029b6:	e8 72 31 00 00       	call   805b2d <pgbatch_map>
+  8029bb:	83 c4 20             	add    $0x20,%esp
+  8029be:	85 c0                	test   %eax,%eax
+  8029c0:	79 76                	jns    802a38 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8029c2:	50                   	push   %eax
+  8029c3:	68 5a 6f 80 00       	push   $0x806f5a
+  8029c8:	68 bc 00 00 00       	push   $0xbc
+  8029cd:	68 f4 6e 80 00       	push   $0x806ef4
+  8029d2:	e8 56 eb ff ff       	call   80152d <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8029d7:	83 ec 0c             	sub    $0xc,%esp
+  8029da:	68 00 08 00 00       	push   $0x800
+  8029df:	56                   	push   %esi
+  8029e0:	53                   	push   %ebx
+  8029e1:	6a 00                	push   $0x0
+  8029e3:	68 a0 ec 80 00       	push   $0x80eca0
+  8029e8:	e8 eb 31 00 00       	call   805bd8 <pgbatch_sharept>
+  8029ed:	83 c4 20             	add    $0x20,%esp
+  8029f0:	85 c0                	test   %eax,%eax
+  8029f2:	78 0b                	js     8029ff <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8029f4:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8029fa:	e9 18 ff ff ff       	jmp    802917 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8029ff:	50                   	push   %eax
+  802a00:	68 46 6f 80 00       	push   $0x806f46
+  802a05:	68 b2 00 00 00       	push   $0xb2
+  802a0a:	68 f4 6e 80 00       	push   $0x806ef4
+  802a0f:	e8 19 eb ff ff       	call   80152d <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  802a14:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802a1b:	83 ec 08             	sub    $0x8,%esp
+  802a1e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802a23:	50                   	push   %eax
+  802a24:	51                   	push   %ecx
+  802a25:	56                   	push   %esi
+  802a26:	51                   	push   %ecx
+  802a27:	6a 00                	push   $0x0
+  802a29:	68 a0 ec 80 00       	push   $0x80eca0
+  802a2e:	e8 fa 30 00 00       	call   805b2d <pgbatch_map>
+  802a33:	83 c4 20             	add    $0x20,%esp
+  802a36:	eb 17                	jmp    802a4f <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  802a38:	68 05 08 00 00       	push   $0x805
+  802a3d:	ff 75 e4             	push   -0x1c(%ebp)
+  802a40:	6a 00                	push   $0x0
+  802a42:	68 a0 ec 80 00       	push   $0x80eca0
+  802a47:	e8 55 31 00 00       	call   805ba1 <pgbatch_protect>
+  802a4c:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  802a4f:	85 c0                	test   %eax,%eax
+  802a51:	0f 89 c0 fe ff ff    	jns    802917 <fork+0x1dc>
+  802a57:	e9 66 ff ff ff       	jmp    8029c2 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  802a5c:	83 ec 08             	sub    $0x8,%esp
+  802a5f:	6a 05                	push   $0x5
+  802a61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a64:	50                   	push   %eax
+  802a65:	56                   	push   %esi
+  802a66:	50                   	push   %eax
+  802a67:	6a 00                	push   $0x0
+  802a69:	68 a0 ec 80 00       	push   $0x80eca0
+  802a6e:	e8 ba 30 00 00       	call   805b2d <pgbatch_map>
+  802a73:	83 c4 20             	add    $0x20,%esp
+  802a76:	eb d7                	jmp    802a4f <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  802a78:	6a 07                	push   $0x7
+  802a7a:	68 00 f0 bf ee       	push   $0xeebff000
+  802a7f:	57                   	push   %edi
+  802a80:	68 a0 ec 80 00       	push   $0x80eca0
+  802a85:	e8 6c 30 00 00       	call   805af6 <pgbatch_alloc>
+  802a8a:	83 c4 10             	add    $0x10,%esp
+  802a8d:	85 c0                	test   %eax,%eax
+  802a8f:	78 66                	js     802af7 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  802a91:	83 ec 0c             	sub    $0xc,%esp
+  802a94:	68 a0 ec 80 00       	push   $0x80eca0
+  802a99:	e8 df 2f 00 00       	call   805a7d <pgbatch_flush>
+  802a9e:	83 c4 10             	add    $0x10,%esp
+  802aa1:	85 c0                	test   %eax,%eax
+  802aa3:	78 52                	js     802af7 <fork+0x3bc>
+  802aa5:	89 e2                	mov    %esp,%edx
+  802aa7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802aac:	29 d0                	sub    %edx,%eax
+  802aae:	89 c2                	mov    %eax,%edx
+  802ab0:	c1 ea 0f             	shr    $0xf,%edx
+  802ab3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802abd:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  802ac0:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  802ac7:	8b 40 78             	mov    0x78(%eax),%eax
+  802aca:	83 ec 08             	sub    $0x8,%esp
+  802acd:	50                   	push   %eax
+  802ace:	57                   	push   %edi
+  802acf:	e8 aa f7 ff ff       	call   80227e <sys_env_set_pgfault_upcall>
+  802ad4:	83 c4 10             	add    $0x10,%esp
+  802ad7:	85 c0                	test   %eax,%eax
+  802ad9:	78 31                	js     802b0c <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  802adb:	83 ec 08             	sub    $0x8,%esp
+  802ade:	6a 02                	push   $0x2
+  802ae0:	57                   	push   %edi
+  802ae1:	e8 14 f7 ff ff       	call   8021fa <sys_env_set_status>
+  802ae6:	83 c4 10             	add    $0x10,%esp
+  802ae9:	85 c0                	test   %eax,%eax
+  802aeb:	78 34                	js     802b21 <fork+0x3e6>
+}
+  802aed:	89 f0                	mov    %esi,%eax
+  802aef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af2:	5b                   	pop    %ebx
+  802af3:	5e                   	pop    %esi
+  802af4:	5f                   	pop    %edi
+  802af5:	5d                   	pop    %ebp
+  802af6:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  802af7:	50                   	push   %eax
+  802af8:	68 66 6f 80 00       	push   $0x806f66
+  802afd:	68 c0 00 00 00       	push   $0xc0
+  802b02:	68 f4 6e 80 00       	push   $0x806ef4
+  802b07:	e8 21 ea ff ff       	call   80152d <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  802b0c:	50                   	push   %eax
+  802b0d:	68 7b 6f 80 00       	push   $0x806f7b
+  802b12:	68 c2 00 00 00       	push   $0xc2
+  802b17:	68 f4 6e 80 00       	push   $0x806ef4
+  802b1c:	e8 0c ea ff ff       	call   80152d <_panic>
+		panic("sys_env_set_status: %e", ret);
+  802b21:	50                   	push   %eax
+  802b22:	68 96 6f 80 00       	push   $0x806f96
+  802b27:	68 c4 00 00 00       	push   $0xc4
+  802b2c:	68 f4 6e 80 00       	push   $0x806ef4
+  802b31:	e8 f7 e9 ff ff       	call   80152d <_panic>
+
+00802b36 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  802b36:	55                   	push   %ebp
+  802b37:	89 e5                	mov    %esp,%ebp
+  802b39:	57                   	push   %edi
+  802b3a:	56                   	push   %esi
+  802b3b:	53                   	push   %ebx
+  802b3c:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  802b3f:	68 40 f0 80 00       	push   $0x80f040
+  802b44:	e8 da 30 00 00       	call   805c23 <mutex_lock>
+  802b49:	89 e2                	mov    %esp,%edx
+  802b4b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802b50:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  802b52:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802b55:	89 c3                	mov    %eax,%ebx
+  802b57:	c1 eb 0f             	shr    $0xf,%ebx
+  802b5a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b64:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  802b67:	e8 89 f5 ff ff       	call   8020f5 <sys_getenvid>
+  802b6c:	89 04 9d c0 ef 80 00 	mov    %eax,0x80efc0(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  802b73:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802b78:	8b 04 9d c0 ef 80 00 	mov    0x80efc0(,%ebx,4),%eax
+  802b7f:	e8 12 fa ff ff       	call   802596 <thread_alive>
+  802b84:	85 c0                	test   %eax,%eax
+  802b86:	74 24                	je     802bac <sfork+0x76>
+  802b88:	83 c3 01             	add    $0x1,%ebx
+  802b8b:	83 fb 20             	cmp    $0x20,%ebx
+  802b8e:	75 e8                	jne    802b78 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  802b90:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  802b95:	83 ec 0c             	sub    $0xc,%esp
+  802b98:	68 40 f0 80 00       	push   $0x80f040
+  802b9d:	e8 ef 30 00 00       	call   805c91 <mutex_unlock>
+	return r;
+}
+  802ba2:	89 f0                	mov    %esi,%eax
+  802ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ba7:	5b                   	pop    %ebx
+  802ba8:	5e                   	pop    %esi
+  802ba9:	5f                   	pop    %edi
+  802baa:	5d                   	pop    %ebp
+  802bab:	c3                   	ret
+	if (i == NTHREADS) {
+  802bac:	83 fb 20             	cmp    $0x20,%ebx
+  802baf:	0f 84 53 01 00 00    	je     802d08 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  802bb5:	89 d8                	mov    %ebx,%eax
+  802bb7:	c1 e0 0f             	shl    $0xf,%eax
+  802bba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  802bbd:	83 ec 0c             	sub    $0xc,%esp
+  802bc0:	68 80 e9 80 00       	push   $0x80e980
+  802bc5:	e8 a5 2e 00 00       	call   805a6f <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  802bca:	83 c4 10             	add    $0x10,%esp
+  802bcd:	83 3d 00 f9 80 00 00 	cmpl   $0x0,0x80f900
+  802bd4:	75 1f                	jne    802bf5 <sfork+0xbf>
+  802bd6:	68 07 04 00 00       	push   $0x407
+  802bdb:	68 00 00 00 e1       	push   $0xe1000000
+  802be0:	6a 00                	push   $0x0
+  802be2:	68 80 e9 80 00       	push   $0x80e980
+  802be7:	e8 0a 2f 00 00       	call   805af6 <pgbatch_alloc>
+  802bec:	89 c6                	mov    %eax,%esi
+  802bee:	83 c4 10             	add    $0x10,%esp
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	78 a0                	js     802b95 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  802bf5:	6a 07                	push   $0x7
+  802bf7:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  802bfc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802bff:	29 c8                	sub    %ecx,%eax
+  802c01:	50                   	push   %eax
+  802c02:	6a 00                	push   $0x0
+  802c04:	68 80 e9 80 00       	push   $0x80e980
+  802c09:	e8 e8 2e 00 00       	call   805af6 <pgbatch_alloc>
+  802c0e:	89 c6                	mov    %eax,%esi
+  802c10:	83 c4 10             	add    $0x10,%esp
+  802c13:	85 c0                	test   %eax,%eax
+  802c15:	0f 88 7a ff ff ff    	js     802b95 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  802c1b:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  802c20:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802c23:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  802c25:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  802c2a:	29 c8                	sub    %ecx,%eax
+  802c2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c2f:	39 c7                	cmp    %eax,%edi
+  802c31:	73 29                	jae    802c5c <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  802c33:	6a 07                	push   $0x7
+  802c35:	57                   	push   %edi
+  802c36:	6a 00                	push   $0x0
+  802c38:	68 80 e9 80 00       	push   $0x80e980
+  802c3d:	e8 b4 2e 00 00       	call   805af6 <pgbatch_alloc>
+  802c42:	89 c6                	mov    %eax,%esi
+  802c44:	83 c4 10             	add    $0x10,%esp
+  802c47:	85 c0                	test   %eax,%eax
+  802c49:	0f 88 46 ff ff ff    	js     802b95 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  802c4f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802c55:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c58:	39 c7                	cmp    %eax,%edi
+  802c5a:	72 d7                	jb     802c33 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  802c5c:	83 ec 0c             	sub    $0xc,%esp
+  802c5f:	68 80 e9 80 00       	push   $0x80e980
+  802c64:	e8 14 2e 00 00       	call   805a7d <pgbatch_flush>
+  802c69:	89 c6                	mov    %eax,%esi
+  802c6b:	83 c4 10             	add    $0x10,%esp
+  802c6e:	85 c0                	test   %eax,%eax
+  802c70:	0f 88 1f ff ff ff    	js     802b95 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  802c76:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  802c7b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802c7e:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  802c80:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  802c86:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c89:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  802c8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c8f:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  802c92:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  802c95:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c9a:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  802c9c:	52                   	push   %edx
+  802c9d:	50                   	push   %eax
+  802c9e:	68 1e 27 80 00       	push   $0x80271e
+  802ca3:	e8 cc f8 ff ff       	call   802574 <sys_exofork_shared>
+  802ca8:	89 c6                	mov    %eax,%esi
+  802caa:	83 c4 10             	add    $0x10,%esp
+  802cad:	85 c0                	test   %eax,%eax
+  802caf:	0f 88 e0 fe ff ff    	js     802b95 <sfork+0x5f>
+	thread_ids[i] = id;
+  802cb5:	89 04 9d c0 ef 80 00 	mov    %eax,0x80efc0(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  802cbc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802cc1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  802cc7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ccc:	89 04 9d 80 f8 80 00 	mov    %eax,0x80f880(,%ebx,4)
+	sforked = 1;
+  802cd3:	c7 05 00 f9 80 00 01 	movl   $0x1,0x80f900
+  802cda:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  802cdd:	83 ec 08             	sub    $0x8,%esp
+  802ce0:	6a 02                	push   $0x2
+  802ce2:	56                   	push   %esi
+  802ce3:	e8 12 f5 ff ff       	call   8021fa <sys_env_set_status>
+  802ce8:	89 c3                	mov    %eax,%ebx
+  802cea:	83 c4 10             	add    $0x10,%esp
+  802ced:	85 c0                	test   %eax,%eax
+  802cef:	0f 89 a0 fe ff ff    	jns    802b95 <sfork+0x5f>
+		sys_env_destroy(id);
+  802cf5:	83 ec 0c             	sub    $0xc,%esp
+  802cf8:	56                   	push   %esi
+  802cf9:	e8 b6 f3 ff ff       	call   8020b4 <sys_env_destroy>
+		goto out;
+  802cfe:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  802d01:	89 de                	mov    %ebx,%esi
+		goto out;
+  802d03:	e9 8d fe ff ff       	jmp    802b95 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  802d08:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  802d0d:	e9 83 fe ff ff       	jmp    802b95 <sfork+0x5f>
+
+00802d12 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  802d12:	55                   	push   %ebp
+  802d13:	89 e5                	mov    %esp,%ebp
+  802d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d1b:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  802d1e:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  802d20:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  802d23:	83 3a 01             	cmpl   $0x1,(%edx)
+  802d26:	7e 09                	jle    802d31 <argstart+0x1f>
+  802d28:	ba a5 68 80 00       	mov    $0x8068a5,%edx
+  802d2d:	85 c9                	test   %ecx,%ecx
+  802d2f:	75 05                	jne    802d36 <argstart+0x24>
+  802d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d36:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  802d39:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  802d40:	5d                   	pop    %ebp
+  802d41:	c3                   	ret
+
+00802d42 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  802d42:	55                   	push   %ebp
+  802d43:	89 e5                	mov    %esp,%ebp
+  802d45:	53                   	push   %ebx
+  802d46:	83 ec 04             	sub    $0x4,%esp
+  802d49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  802d4c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  802d53:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d56:	85 c0                	test   %eax,%eax
+  802d58:	74 74                	je     802dce <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  802d5a:	80 38 00             	cmpb   $0x0,(%eax)
+  802d5d:	75 48                	jne    802da7 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  802d5f:	8b 0b                	mov    (%ebx),%ecx
+  802d61:	83 39 01             	cmpl   $0x1,(%ecx)
+  802d64:	74 5a                	je     802dc0 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  802d66:	8b 53 04             	mov    0x4(%ebx),%edx
+  802d69:	8b 42 04             	mov    0x4(%edx),%eax
+  802d6c:	80 38 2d             	cmpb   $0x2d,(%eax)
+  802d6f:	75 4f                	jne    802dc0 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  802d71:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  802d75:	74 49                	je     802dc0 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  802d77:	83 c0 01             	add    $0x1,%eax
+  802d7a:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802d7d:	83 ec 04             	sub    $0x4,%esp
+  802d80:	8b 01                	mov    (%ecx),%eax
+  802d82:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  802d89:	50                   	push   %eax
+  802d8a:	8d 42 08             	lea    0x8(%edx),%eax
+  802d8d:	50                   	push   %eax
+  802d8e:	83 c2 04             	add    $0x4,%edx
+  802d91:	52                   	push   %edx
+  802d92:	e8 18 f1 ff ff       	call   801eaf <memmove>
+		(*args->argc)--;
+  802d97:	8b 03                	mov    (%ebx),%eax
+  802d99:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802d9c:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d9f:	83 c4 10             	add    $0x10,%esp
+  802da2:	80 38 2d             	cmpb   $0x2d,(%eax)
+  802da5:	74 13                	je     802dba <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  802da7:	8b 43 08             	mov    0x8(%ebx),%eax
+  802daa:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  802dad:	83 c0 01             	add    $0x1,%eax
+  802db0:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  802db3:	89 d0                	mov    %edx,%eax
+  802db5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802db8:	c9                   	leave
+  802db9:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802dba:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  802dbe:	75 e7                	jne    802da7 <argnext+0x65>
+	args->curarg = 0;
+  802dc0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  802dc7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802dcc:	eb e5                	jmp    802db3 <argnext+0x71>
+		return -1;
+  802dce:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802dd3:	eb de                	jmp    802db3 <argnext+0x71>
+
+00802dd5 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  802dd5:	55                   	push   %ebp
+  802dd6:	89 e5                	mov    %esp,%ebp
+  802dd8:	53                   	push   %ebx
+  802dd9:	83 ec 04             	sub    $0x4,%esp
+  802ddc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  802ddf:	8b 43 08             	mov    0x8(%ebx),%eax
+  802de2:	85 c0                	test   %eax,%eax
+  802de4:	74 12                	je     802df8 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  802de6:	80 38 00             	cmpb   $0x0,(%eax)
+  802de9:	74 12                	je     802dfd <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  802deb:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  802dee:	c7 43 08 a5 68 80 00 	movl   $0x8068a5,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  802df5:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  802df8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dfb:	c9                   	leave
+  802dfc:	c3                   	ret
+	} else if (*args->argc > 1) {
+  802dfd:	8b 13                	mov    (%ebx),%edx
+  802dff:	83 3a 01             	cmpl   $0x1,(%edx)
+  802e02:	7f 10                	jg     802e14 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  802e04:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  802e0b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  802e12:	eb e1                	jmp    802df5 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  802e14:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e17:	8b 48 04             	mov    0x4(%eax),%ecx
+  802e1a:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802e1d:	83 ec 04             	sub    $0x4,%esp
+  802e20:	8b 12                	mov    (%edx),%edx
+  802e22:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  802e29:	52                   	push   %edx
+  802e2a:	8d 50 08             	lea    0x8(%eax),%edx
+  802e2d:	52                   	push   %edx
+  802e2e:	83 c0 04             	add    $0x4,%eax
+  802e31:	50                   	push   %eax
+  802e32:	e8 78 f0 ff ff       	call   801eaf <memmove>
+		(*args->argc)--;
+  802e37:	8b 03                	mov    (%ebx),%eax
+  802e39:	83 28 01             	subl   $0x1,(%eax)
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	eb b4                	jmp    802df5 <argnextvalue+0x20>
+
+00802e41 <argvalue>:
+{
+  802e41:	55                   	push   %ebp
+  802e42:	89 e5                	mov    %esp,%ebp
+  802e44:	83 ec 08             	sub    $0x8,%esp
+  802e47:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  802e4a:	8b 42 0c             	mov    0xc(%edx),%eax
+  802e4d:	85 c0                	test   %eax,%eax
+  802e4f:	74 02                	je     802e53 <argvalue+0x12>
+}
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  802e53:	83 ec 0c             	sub    $0xc,%esp
+  802e56:	52                   	push   %edx
+  802e57:	e8 79 ff ff ff       	call   802dd5 <argnextvalue>
+  802e5c:	83 c4 10             	add    $0x10,%esp
+  802e5f:	eb f0                	jmp    802e51 <argvalue+0x10>
+
+00802e61 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802e61:	55                   	push   %ebp
+  802e62:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e67:	05 00 00 00 30       	add    $0x30000000,%eax
+  802e6c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802e6f:	5d                   	pop    %ebp
+  802e70:	c3                   	ret
+
+00802e71 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802e71:	55                   	push   %ebp
+  802e72:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802e74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e77:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802e7c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802e81:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  802e86:	5d                   	pop    %ebp
+  802e87:	c3                   	ret
+
+00802e88 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802e88:	55                   	push   %ebp
+  802e89:	89 e5                	mov    %esp,%ebp
+  802e8b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  802e90:	89 c2                	mov    %eax,%edx
+  802e92:	c1 ea 16             	shr    $0x16,%edx
+  802e95:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802e9c:	f6 c2 01             	test   $0x1,%dl
+  802e9f:	74 29                	je     802eca <fd_alloc+0x42>
+  802ea1:	89 c2                	mov    %eax,%edx
+  802ea3:	c1 ea 0c             	shr    $0xc,%edx
+  802ea6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802ead:	f6 c2 01             	test   $0x1,%dl
+  802eb0:	74 18                	je     802eca <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  802eb2:	05 00 10 00 00       	add    $0x1000,%eax
+  802eb7:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  802ebc:	75 d2                	jne    802e90 <fd_alloc+0x8>
+  802ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802ec3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802ec8:	eb 05                	jmp    802ecf <fd_alloc+0x47>
+			return 0;
+  802eca:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ed2:	89 02                	mov    %eax,(%edx)
+}
+  802ed4:	89 c8                	mov    %ecx,%eax
+  802ed6:	5d                   	pop    %ebp
+  802ed7:	c3                   	ret
+
+00802ed8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802ed8:	55                   	push   %ebp
+  802ed9:	89 e5                	mov    %esp,%ebp
+  802edb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802ede:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  802ee3:	77 30                	ja     802f15 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802ee5:	c1 e0 0c             	shl    $0xc,%eax
+  802ee8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  802eed:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802ef3:	f6 c2 01             	test   $0x1,%dl
+  802ef6:	74 24                	je     802f1c <fd_lookup+0x44>
+  802ef8:	89 c2                	mov    %eax,%edx
+  802efa:	c1 ea 0c             	shr    $0xc,%edx
+  802efd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802f04:	f6 c2 01             	test   $0x1,%dl
+  802f07:	74 1a                	je     802f23 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802f09:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f0c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f13:	5d                   	pop    %ebp
+  802f14:	c3                   	ret
+		return -E_INVAL;
+  802f15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f1a:	eb f7                	jmp    802f13 <fd_lookup+0x3b>
+		return -E_INVAL;
+  802f1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f21:	eb f0                	jmp    802f13 <fd_lookup+0x3b>
+  802f23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f28:	eb e9                	jmp    802f13 <fd_lookup+0x3b>
+
+00802f2a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802f2a:	55                   	push   %ebp
+  802f2b:	89 e5                	mov    %esp,%ebp
+  802f2d:	53                   	push   %ebx
+  802f2e:	83 ec 04             	sub    $0x4,%esp
+  802f31:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802f34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f39:	bb 40 80 80 00       	mov    $0x808040,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  802f3e:	39 13                	cmp    %edx,(%ebx)
+  802f40:	74 54                	je     802f96 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  802f42:	83 c0 01             	add    $0x1,%eax
+  802f45:	8b 1c 85 4c 70 80 00 	mov    0x80704c(,%eax,4),%ebx
+  802f4c:	85 db                	test   %ebx,%ebx
+  802f4e:	75 ee                	jne    802f3e <dev_lookup+0x14>
+  802f50:	89 e1                	mov    %esp,%ecx
+  802f52:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802f57:	29 c8                	sub    %ecx,%eax
+  802f59:	89 c1                	mov    %eax,%ecx
+  802f5b:	c1 e9 0f             	shr    $0xf,%ecx
+  802f5e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f68:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802f6b:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  802f72:	8b 40 48             	mov    0x48(%eax),%eax
+  802f75:	83 ec 04             	sub    $0x4,%esp
+  802f78:	52                   	push   %edx
+  802f79:	50                   	push   %eax
+  802f7a:	68 d0 6f 80 00       	push   $0x806fd0
+  802f7f:	e8 84 e6 ff ff       	call   801608 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802f84:	83 c4 10             	add    $0x10,%esp
+  802f87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802f8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f8f:	89 1a                	mov    %ebx,(%edx)
+}
+  802f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f94:	c9                   	leave
+  802f95:	c3                   	ret
+			return 0;
+  802f96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9b:	eb ef                	jmp    802f8c <dev_lookup+0x62>
+
+00802f9d <fd_close>:
+{
+  802f9d:	55                   	push   %ebp
+  802f9e:	89 e5                	mov    %esp,%ebp
+  802fa0:	57                   	push   %edi
+  802fa1:	56                   	push   %esi
+  802fa2:	53                   	push   %ebx
+  802fa3:	83 ec 24             	sub    $0x24,%esp
+  802fa6:	8b 75 08             	mov    0x8(%ebp),%esi
+  802fa9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802fac:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802faf:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802fb0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802fb6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802fb9:	50                   	push   %eax
+  802fba:	e8 19 ff ff ff       	call   802ed8 <fd_lookup>
+  802fbf:	89 c3                	mov    %eax,%ebx
+  802fc1:	83 c4 10             	add    $0x10,%esp
+  802fc4:	85 c0                	test   %eax,%eax
+  802fc6:	78 05                	js     802fcd <fd_close+0x30>
+	    || fd != fd2)
+  802fc8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802fcb:	74 0f                	je     802fdc <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  802fcd:	85 ff                	test   %edi,%edi
+  802fcf:	0f 44 df             	cmove  %edi,%ebx
+}
+  802fd2:	89 d8                	mov    %ebx,%eax
+  802fd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd7:	5b                   	pop    %ebx
+  802fd8:	5e                   	pop    %esi
+  802fd9:	5f                   	pop    %edi
+  802fda:	5d                   	pop    %ebp
+  802fdb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802fdc:	83 ec 08             	sub    $0x8,%esp
+  802fdf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802fe2:	50                   	push   %eax
+  802fe3:	ff 36                	push   (%esi)
+  802fe5:	e8 40 ff ff ff       	call   802f2a <dev_lookup>
+  802fea:	89 c3                	mov    %eax,%ebx
+  802fec:	83 c4 10             	add    $0x10,%esp
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	78 1a                	js     80300d <fd_close+0x70>
+		if (dev->dev_close)
+  802ff3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ff6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	74 0b                	je     80300d <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  803002:	83 ec 0c             	sub    $0xc,%esp
+  803005:	56                   	push   %esi
+  803006:	ff d0                	call   *%eax
+  803008:	89 c3                	mov    %eax,%ebx
+  80300a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80300d:	83 ec 08             	sub    $0x8,%esp
+  803010:	56                   	push   %esi
+  803011:	6a 00                	push   $0x0
+  803013:	e8 a0 f1 ff ff       	call   8021b8 <sys_page_unmap>
+	return r;
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	eb b5                	jmp    802fd2 <fd_close+0x35>
+
+0080301d <close>:
+
+int
+close(int fdnum)
+{
+  80301d:	55                   	push   %ebp
+  80301e:	89 e5                	mov    %esp,%ebp
+  803020:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803023:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803026:	50                   	push   %eax
+  803027:	ff 75 08             	push   0x8(%ebp)
+  80302a:	e8 a9 fe ff ff       	call   802ed8 <fd_lookup>
+  80302f:	83 c4 10             	add    $0x10,%esp
+  803032:	85 c0                	test   %eax,%eax
+  803034:	79 02                	jns    803038 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  803036:	c9                   	leave
+  803037:	c3                   	ret
+		return fd_close(fd, 1);
+  803038:	83 ec 08             	sub    $0x8,%esp
+  80303b:	6a 01                	push   $0x1
+  80303d:	ff 75 f4             	push   -0xc(%ebp)
+  803040:	e8 58 ff ff ff       	call   802f9d <fd_close>
+  803045:	83 c4 10             	add    $0x10,%esp
+  803048:	eb ec                	jmp    803036 <close+0x19>
+
+0080304a <close_all>:
+
+void
+close_all(void)
+{
+  80304a:	55                   	push   %ebp
+  80304b:	89 e5                	mov    %esp,%ebp
+  80304d:	53                   	push   %ebx
+  80304e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803051:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  803056:	83 ec 0c             	sub    $0xc,%esp
+  803059:	53                   	push   %ebx
+  80305a:	e8 be ff ff ff       	call   80301d <close>
+	for (i = 0; i < MAXFD; i++)
+  80305f:	83 c3 01             	add    $0x1,%ebx
+  803062:	83 c4 10             	add    $0x10,%esp
+  803065:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80306b:	75 e9                	jne    803056 <close_all+0xc>
+}
+  80306d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803070:	c9                   	leave
+  803071:	c3                   	ret
+
+00803072 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803072:	55                   	push   %ebp
+  803073:	89 e5                	mov    %esp,%ebp
+  803075:	57                   	push   %edi
+  803076:	56                   	push   %esi
+  803077:	53                   	push   %ebx
+  803078:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80307b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80307e:	50                   	push   %eax
+  80307f:	ff 75 08             	push   0x8(%ebp)
+  803082:	e8 51 fe ff ff       	call   802ed8 <fd_lookup>
+  803087:	89 c3                	mov    %eax,%ebx
+  803089:	83 c4 10             	add    $0x10,%esp
+  80308c:	85 c0                	test   %eax,%eax
+  80308e:	78 7f                	js     80310f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  803090:	83 ec 0c             	sub    $0xc,%esp
+  803093:	ff 75 0c             	push   0xc(%ebp)
+  803096:	e8 82 ff ff ff       	call   80301d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80309b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80309e:	c1 e6 0c             	shl    $0xc,%esi
+  8030a1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8030a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8030aa:	89 3c 24             	mov    %edi,(%esp)
+  8030ad:	e8 bf fd ff ff       	call   802e71 <fd2data>
+  8030b2:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8030b4:	89 34 24             	mov    %esi,(%esp)
+  8030b7:	e8 b5 fd ff ff       	call   802e71 <fd2data>
+  8030bc:	83 c4 10             	add    $0x10,%esp
+  8030bf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8030c2:	89 d8                	mov    %ebx,%eax
+  8030c4:	c1 e8 16             	shr    $0x16,%eax
+  8030c7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8030ce:	a8 01                	test   $0x1,%al
+  8030d0:	74 11                	je     8030e3 <dup+0x71>
+  8030d2:	89 d8                	mov    %ebx,%eax
+  8030d4:	c1 e8 0c             	shr    $0xc,%eax
+  8030d7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8030de:	f6 c2 01             	test   $0x1,%dl
+  8030e1:	75 36                	jne    803119 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8030e3:	89 f8                	mov    %edi,%eax
+  8030e5:	c1 e8 0c             	shr    $0xc,%eax
+  8030e8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030ef:	83 ec 0c             	sub    $0xc,%esp
+  8030f2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030f7:	50                   	push   %eax
+  8030f8:	56                   	push   %esi
+  8030f9:	6a 00                	push   $0x0
+  8030fb:	57                   	push   %edi
+  8030fc:	6a 00                	push   $0x0
+  8030fe:	e8 73 f0 ff ff       	call   802176 <sys_page_map>
+  803103:	89 c3                	mov    %eax,%ebx
+  803105:	83 c4 20             	add    $0x20,%esp
+  803108:	85 c0                	test   %eax,%eax
+  80310a:	78 33                	js     80313f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80310c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80310f:	89 d8                	mov    %ebx,%eax
+  803111:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803114:	5b                   	pop    %ebx
+  803115:	5e                   	pop    %esi
+  803116:	5f                   	pop    %edi
+  803117:	5d                   	pop    %ebp
+  803118:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803119:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803120:	83 ec 0c             	sub    $0xc,%esp
+  803123:	25 07 0e 00 00       	and    $0xe07,%eax
+  803128:	50                   	push   %eax
+  803129:	ff 75 d4             	push   -0x2c(%ebp)
+  80312c:	6a 00                	push   $0x0
+  80312e:	53                   	push   %ebx
+  80312f:	6a 00                	push   $0x0
+  803131:	e8 40 f0 ff ff       	call   802176 <sys_page_map>
+  803136:	89 c3                	mov    %eax,%ebx
+  803138:	83 c4 20             	add    $0x20,%esp
+  80313b:	85 c0                	test   %eax,%eax
+  80313d:	79 a4                	jns    8030e3 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80313f:	83 ec 08             	sub    $0x8,%esp
+  803142:	56                   	push   %esi
+  803143:	6a 00                	push   $0x0
+  803145:	e8 6e f0 ff ff       	call   8021b8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80314a:	83 c4 08             	add    $0x8,%esp
+  80314d:	ff 75 d4             	push   -0x2c(%ebp)
+  803150:	6a 00                	push   $0x0
+  803152:	e8 61 f0 ff ff       	call   8021b8 <sys_page_unmap>
+	return r;
+  803157:	83 c4 10             	add    $0x10,%esp
+  80315a:	eb b3                	jmp    80310f <dup+0x9d>
+
+0080315c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80315c:	55                   	push   %ebp
+  80315d:	89 e5                	mov    %esp,%ebp
+  80315f:	56                   	push   %esi
+  803160:	53                   	push   %ebx
+  803161:	83 ec 18             	sub    $0x18,%esp
+  803164:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803167:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80316a:	50                   	push   %eax
+  80316b:	53                   	push   %ebx
+  80316c:	e8 67 fd ff ff       	call   802ed8 <fd_lookup>
+  803171:	83 c4 10             	add    $0x10,%esp
+  803174:	85 c0                	test   %eax,%eax
+  803176:	78 3c                	js     8031b4 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803178:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80317b:	83 ec 08             	sub    $0x8,%esp
+  80317e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803181:	50                   	push   %eax
+  803182:	ff 36                	push   (%esi)
+  803184:	e8 a1 fd ff ff       	call   802f2a <dev_lookup>
+  803189:	83 c4 10             	add    $0x10,%esp
+  80318c:	85 c0                	test   %eax,%eax
+  80318e:	78 24                	js     8031b4 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803190:	8b 46 08             	mov    0x8(%esi),%eax
+  803193:	83 e0 03             	and    $0x3,%eax
+  803196:	83 f8 01             	cmp    $0x1,%eax
+  803199:	74 20                	je     8031bb <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80319b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80319e:	8b 40 08             	mov    0x8(%eax),%eax
+  8031a1:	85 c0                	test   %eax,%eax
+  8031a3:	74 54                	je     8031f9 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8031a5:	83 ec 04             	sub    $0x4,%esp
+  8031a8:	ff 75 10             	push   0x10(%ebp)
+  8031ab:	ff 75 0c             	push   0xc(%ebp)
+  8031ae:	56                   	push   %esi
+  8031af:	ff d0                	call   *%eax
+  8031b1:	83 c4 10             	add    $0x10,%esp
+}
+  8031b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031b7:	5b                   	pop    %ebx
+  8031b8:	5e                   	pop    %esi
+  8031b9:	5d                   	pop    %ebp
+  8031ba:	c3                   	ret
+  8031bb:	89 e2                	mov    %esp,%edx
+  8031bd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8031c2:	29 d0                	sub    %edx,%eax
+  8031c4:	89 c2                	mov    %eax,%edx
+  8031c6:	c1 ea 0f             	shr    $0xf,%edx
+  8031c9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8031ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d3:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031d6:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  8031dd:	8b 40 48             	mov    0x48(%eax),%eax
+  8031e0:	83 ec 04             	sub    $0x4,%esp
+  8031e3:	53                   	push   %ebx
+  8031e4:	50                   	push   %eax
+  8031e5:	68 11 70 80 00       	push   $0x807011
+  8031ea:	e8 19 e4 ff ff       	call   801608 <cprintf>
+		return -E_INVAL;
+  8031ef:	83 c4 10             	add    $0x10,%esp
+  8031f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031f7:	eb bb                	jmp    8031b4 <read+0x58>
+		return -E_NOT_SUPP;
+  8031f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8031fe:	eb b4                	jmp    8031b4 <read+0x58>
+
+00803200 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803200:	55                   	push   %ebp
+  803201:	89 e5                	mov    %esp,%ebp
+  803203:	57                   	push   %edi
+  803204:	56                   	push   %esi
+  803205:	53                   	push   %ebx
+  803206:	83 ec 0c             	sub    $0xc,%esp
+  803209:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80320c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80320f:	85 f6                	test   %esi,%esi
+  803211:	74 30                	je     803243 <readn+0x43>
+  803213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803218:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80321d:	83 ec 04             	sub    $0x4,%esp
+  803220:	89 f2                	mov    %esi,%edx
+  803222:	29 c2                	sub    %eax,%edx
+  803224:	52                   	push   %edx
+  803225:	01 f8                	add    %edi,%eax
+  803227:	50                   	push   %eax
+  803228:	ff 75 08             	push   0x8(%ebp)
+  80322b:	e8 2c ff ff ff       	call   80315c <read>
+		if (m < 0)
+  803230:	83 c4 10             	add    $0x10,%esp
+  803233:	85 c0                	test   %eax,%eax
+  803235:	78 15                	js     80324c <readn+0x4c>
+			return m;
+		if (m == 0)
+  803237:	74 11                	je     80324a <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  803239:	01 c3                	add    %eax,%ebx
+  80323b:	89 d8                	mov    %ebx,%eax
+  80323d:	39 f3                	cmp    %esi,%ebx
+  80323f:	72 dc                	jb     80321d <readn+0x1d>
+  803241:	eb 09                	jmp    80324c <readn+0x4c>
+  803243:	b8 00 00 00 00       	mov    $0x0,%eax
+  803248:	eb 02                	jmp    80324c <readn+0x4c>
+  80324a:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80324c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80324f:	5b                   	pop    %ebx
+  803250:	5e                   	pop    %esi
+  803251:	5f                   	pop    %edi
+  803252:	5d                   	pop    %ebp
+  803253:	c3                   	ret
+
+00803254 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803254:	55                   	push   %ebp
+  803255:	89 e5                	mov    %esp,%ebp
+  803257:	56                   	push   %esi
+  803258:	53                   	push   %ebx
+  803259:	83 ec 18             	sub    $0x18,%esp
+  80325c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80325f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803262:	50                   	push   %eax
+  803263:	53                   	push   %ebx
+  803264:	e8 6f fc ff ff       	call   802ed8 <fd_lookup>
+  803269:	83 c4 10             	add    $0x10,%esp
+  80326c:	85 c0                	test   %eax,%eax
+  80326e:	78 37                	js     8032a7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803270:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803273:	83 ec 08             	sub    $0x8,%esp
+  803276:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803279:	50                   	push   %eax
+  80327a:	ff 36                	push   (%esi)
+  80327c:	e8 a9 fc ff ff       	call   802f2a <dev_lookup>
+  803281:	83 c4 10             	add    $0x10,%esp
+  803284:	85 c0                	test   %eax,%eax
+  803286:	78 1f                	js     8032a7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803288:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80328c:	74 20                	je     8032ae <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80328e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803291:	8b 40 0c             	mov    0xc(%eax),%eax
+  803294:	85 c0                	test   %eax,%eax
+  803296:	74 54                	je     8032ec <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  803298:	83 ec 04             	sub    $0x4,%esp
+  80329b:	ff 75 10             	push   0x10(%ebp)
+  80329e:	ff 75 0c             	push   0xc(%ebp)
+  8032a1:	56                   	push   %esi
+  8032a2:	ff d0                	call   *%eax
+  8032a4:	83 c4 10             	add    $0x10,%esp
+}
+  8032a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032aa:	5b                   	pop    %ebx
+  8032ab:	5e                   	pop    %esi
+  8032ac:	5d                   	pop    %ebp
+  8032ad:	c3                   	ret
+  8032ae:	89 e2                	mov    %esp,%edx
+  8032b0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8032b5:	29 d0                	sub    %edx,%eax
+  8032b7:	89 c2                	mov    %eax,%edx
+  8032b9:	c1 ea 0f             	shr    $0xf,%edx
+  8032bc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8032c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c6:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032c9:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  8032d0:	8b 40 48             	mov    0x48(%eax),%eax
+  8032d3:	83 ec 04             	sub    $0x4,%esp
+  8032d6:	53                   	push   %ebx
+  8032d7:	50                   	push   %eax
+  8032d8:	68 2d 70 80 00       	push   $0x80702d
+  8032dd:	e8 26 e3 ff ff       	call   801608 <cprintf>
+		return -E_INVAL;
+  8032e2:	83 c4 10             	add    $0x10,%esp
+  8032e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032ea:	eb bb                	jmp    8032a7 <write+0x53>
+		return -E_NOT_SUPP;
+  8032ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8032f1:	eb b4                	jmp    8032a7 <write+0x53>
+
+008032f3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8032f3:	55                   	push   %ebp
+  8032f4:	89 e5                	mov    %esp,%ebp
+  8032f6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032fc:	50                   	push   %eax
+  8032fd:	ff 75 08             	push   0x8(%ebp)
+  803300:	e8 d3 fb ff ff       	call   802ed8 <fd_lookup>
+  803305:	83 c4 10             	add    $0x10,%esp
+  803308:	85 c0                	test   %eax,%eax
+  80330a:	78 0e                	js     80331a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80330c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80330f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803312:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  803315:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331a:	c9                   	leave
+  80331b:	c3                   	ret
+
+0080331c <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80331c:	55                   	push   %ebp
+  80331d:	89 e5                	mov    %esp,%ebp
+  80331f:	53                   	push   %ebx
+  803320:	83 ec 1c             	sub    $0x1c,%esp
+  803323:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803326:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803329:	50                   	push   %eax
+  80332a:	ff 75 08             	push   0x8(%ebp)
+  80332d:	e8 a6 fb ff ff       	call   802ed8 <fd_lookup>
+  803332:	83 c4 10             	add    $0x10,%esp
+  803335:	85 c0                	test   %eax,%eax
+  803337:	78 33                	js     80336c <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  803339:	83 fb 03             	cmp    $0x3,%ebx
+  80333c:	74 28                	je     803366 <fcntl+0x4a>
+  80333e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803343:	83 fb 04             	cmp    $0x4,%ebx
+  803346:	75 24                	jne    80336c <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  803348:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80334b:	8b 41 08             	mov    0x8(%ecx),%eax
+  80334e:	80 e4 ef             	and    $0xef,%ah
+  803351:	8b 55 10             	mov    0x10(%ebp),%edx
+  803354:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80335a:	09 d0                	or     %edx,%eax
+  80335c:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80335f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803364:	eb 06                	jmp    80336c <fcntl+0x50>
+		return fd->fd_omode;
+  803366:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803369:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80336c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80336f:	c9                   	leave
+  803370:	c3                   	ret
+
+00803371 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803371:	55                   	push   %ebp
+  803372:	89 e5                	mov    %esp,%ebp
+  803374:	56                   	push   %esi
+  803375:	53                   	push   %ebx
+  803376:	83 ec 18             	sub    $0x18,%esp
+  803379:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80337c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80337f:	50                   	push   %eax
+  803380:	53                   	push   %ebx
+  803381:	e8 52 fb ff ff       	call   802ed8 <fd_lookup>
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	78 34                	js     8033c1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80338d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803390:	83 ec 08             	sub    $0x8,%esp
+  803393:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803396:	50                   	push   %eax
+  803397:	ff 36                	push   (%esi)
+  803399:	e8 8c fb ff ff       	call   802f2a <dev_lookup>
+  80339e:	83 c4 10             	add    $0x10,%esp
+  8033a1:	85 c0                	test   %eax,%eax
+  8033a3:	78 1c                	js     8033c1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033a5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8033a9:	74 1d                	je     8033c8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8033ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ae:	8b 40 18             	mov    0x18(%eax),%eax
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	74 51                	je     803406 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8033b5:	83 ec 08             	sub    $0x8,%esp
+  8033b8:	ff 75 0c             	push   0xc(%ebp)
+  8033bb:	56                   	push   %esi
+  8033bc:	ff d0                	call   *%eax
+  8033be:	83 c4 10             	add    $0x10,%esp
+}
+  8033c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033c4:	5b                   	pop    %ebx
+  8033c5:	5e                   	pop    %esi
+  8033c6:	5d                   	pop    %ebp
+  8033c7:	c3                   	ret
+  8033c8:	89 e2                	mov    %esp,%edx
+  8033ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8033cf:	29 d0                	sub    %edx,%eax
+  8033d1:	89 c2                	mov    %eax,%edx
+  8033d3:	c1 ea 0f             	shr    $0xf,%edx
+  8033d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8033db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e0:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8033e3:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  8033ea:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033ed:	83 ec 04             	sub    $0x4,%esp
+  8033f0:	53                   	push   %ebx
+  8033f1:	50                   	push   %eax
+  8033f2:	68 f0 6f 80 00       	push   $0x806ff0
+  8033f7:	e8 0c e2 ff ff       	call   801608 <cprintf>
+		return -E_INVAL;
+  8033fc:	83 c4 10             	add    $0x10,%esp
+  8033ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803404:	eb bb                	jmp    8033c1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  803406:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80340b:	eb b4                	jmp    8033c1 <ftruncate+0x50>
+
+0080340d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80340d:	55                   	push   %ebp
+  80340e:	89 e5                	mov    %esp,%ebp
+  803410:	56                   	push   %esi
+  803411:	53                   	push   %ebx
+  803412:	83 ec 18             	sub    $0x18,%esp
+  803415:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803418:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80341b:	50                   	push   %eax
+  80341c:	ff 75 08             	push   0x8(%ebp)
+  80341f:	e8 b4 fa ff ff       	call   802ed8 <fd_lookup>
+  803424:	83 c4 10             	add    $0x10,%esp
+  803427:	85 c0                	test   %eax,%eax
+  803429:	78 53                	js     80347e <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80342b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80342e:	83 ec 08             	sub    $0x8,%esp
+  803431:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803434:	50                   	push   %eax
+  803435:	ff 36                	push   (%esi)
+  803437:	e8 ee fa ff ff       	call   802f2a <dev_lookup>
+  80343c:	83 c4 10             	add    $0x10,%esp
+  80343f:	85 c0                	test   %eax,%eax
+  803441:	78 3b                	js     80347e <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  803443:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803446:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80344a:	74 39                	je     803485 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80344c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80344f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  803456:	00 00 00 
+	stat->st_isdir = 0;
+  803459:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803460:	00 00 00 
+	stat->st_version = 0;
+  803463:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80346a:	00 00 00 
+	stat->st_dev = dev;
+  80346d:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  803473:	83 ec 08             	sub    $0x8,%esp
+  803476:	53                   	push   %ebx
+  803477:	56                   	push   %esi
+  803478:	ff 50 14             	call   *0x14(%eax)
+  80347b:	83 c4 10             	add    $0x10,%esp
+}
+  80347e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803481:	5b                   	pop    %ebx
+  803482:	5e                   	pop    %esi
+  803483:	5d                   	pop    %ebp
+  803484:	c3                   	ret
+		return -E_NOT_SUPP;
+  803485:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80348a:	eb f2                	jmp    80347e <fstat+0x71>
+
+0080348c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	56                   	push   %esi
+  803490:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803491:	83 ec 08             	sub    $0x8,%esp
+  803494:	6a 00                	push   $0x0
+  803496:	ff 75 08             	push   0x8(%ebp)
+  803499:	e8 b7 01 00 00       	call   803655 <open>
+  80349e:	89 c3                	mov    %eax,%ebx
+  8034a0:	83 c4 10             	add    $0x10,%esp
+  8034a3:	85 c0                	test   %eax,%eax
+  8034a5:	78 1b                	js     8034c2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8034a7:	83 ec 08             	sub    $0x8,%esp
+  8034aa:	ff 75 0c             	push   0xc(%ebp)
+  8034ad:	50                   	push   %eax
+  8034ae:	e8 5a ff ff ff       	call   80340d <fstat>
+  8034b3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8034b5:	89 1c 24             	mov    %ebx,(%esp)
+  8034b8:	e8 60 fb ff ff       	call   80301d <close>
+	return r;
+  8034bd:	83 c4 10             	add    $0x10,%esp
+  8034c0:	89 f3                	mov    %esi,%ebx
+}
+  8034c2:	89 d8                	mov    %ebx,%eax
+  8034c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034c7:	5b                   	pop    %ebx
+  8034c8:	5e                   	pop    %esi
+  8034c9:	5d                   	pop    %ebp
+  8034ca:	c3                   	ret
+
+008034cb <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8034cb:	55                   	push   %ebp
+  8034cc:	89 e5                	mov    %esp,%ebp
+  8034ce:	56                   	push   %esi
+  8034cf:	53                   	push   %ebx
+  8034d0:	89 c6                	mov    %eax,%esi
+  8034d2:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8034d4:	83 3d 44 f0 80 00 00 	cmpl   $0x0,0x80f044
+  8034db:	74 27                	je     803504 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8034dd:	6a 07                	push   $0x7
+  8034df:	68 00 00 81 00       	push   $0x810000
+  8034e4:	56                   	push   %esi
+  8034e5:	ff 35 44 f0 80 00    	push   0x80f044
+  8034eb:	e8 73 2d 00 00       	call   806263 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8034f0:	83 c4 0c             	add    $0xc,%esp
+  8034f3:	6a 00                	push   $0x0
+  8034f5:	53                   	push   %ebx
+  8034f6:	6a 00                	push   $0x0
+  8034f8:	e8 d6 2a 00 00       	call   805fd3 <ipc_recv>
+}
+  8034fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803500:	5b                   	pop    %ebx
+  803501:	5e                   	pop    %esi
+  803502:	5d                   	pop    %ebp
+  803503:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803504:	83 ec 0c             	sub    $0xc,%esp
+  803507:	6a 02                	push   $0x2
+  803509:	e8 be 2d 00 00       	call   8062cc <ipc_find_env>
+  80350e:	a3 44 f0 80 00       	mov    %eax,0x80f044
+  803513:	83 c4 10             	add    $0x10,%esp
+  803516:	eb c5                	jmp    8034dd <fsipc+0x12>
+
+00803518 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80351e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803521:	8b 40 0c             	mov    0xc(%eax),%eax
+  803524:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  803529:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80352c:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  803531:	ba 00 00 00 00       	mov    $0x0,%edx
+  803536:	b8 02 00 00 00       	mov    $0x2,%eax
+  80353b:	e8 8b ff ff ff       	call   8034cb <fsipc>
+}
+  803540:	c9                   	leave
+  803541:	c3                   	ret
+
+00803542 <devfile_flush>:
+{
+  803542:	55                   	push   %ebp
+  803543:	89 e5                	mov    %esp,%ebp
+  803545:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803548:	8b 45 08             	mov    0x8(%ebp),%eax
+  80354b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80354e:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  803553:	ba 00 00 00 00       	mov    $0x0,%edx
+  803558:	b8 06 00 00 00       	mov    $0x6,%eax
+  80355d:	e8 69 ff ff ff       	call   8034cb <fsipc>
+}
+  803562:	c9                   	leave
+  803563:	c3                   	ret
+
+00803564 <devfile_stat>:
+{
+  803564:	55                   	push   %ebp
+  803565:	89 e5                	mov    %esp,%ebp
+  803567:	53                   	push   %ebx
+  803568:	83 ec 04             	sub    $0x4,%esp
+  80356b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80356e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803571:	8b 40 0c             	mov    0xc(%eax),%eax
+  803574:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357e:	b8 05 00 00 00       	mov    $0x5,%eax
+  803583:	e8 43 ff ff ff       	call   8034cb <fsipc>
+  803588:	85 c0                	test   %eax,%eax
+  80358a:	78 37                	js     8035c3 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80358c:	83 ec 08             	sub    $0x8,%esp
+  80358f:	68 00 00 81 00       	push   $0x810000
+  803594:	53                   	push   %ebx
+  803595:	e8 65 e7 ff ff       	call   801cff <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80359a:	a1 80 00 81 00       	mov    0x810080,%eax
+  80359f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8035a5:	a1 84 00 81 00       	mov    0x810084,%eax
+  8035aa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8035b0:	a1 88 00 81 00       	mov    0x810088,%eax
+  8035b5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8035bb:	83 c4 10             	add    $0x10,%esp
+  8035be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035c6:	c9                   	leave
+  8035c7:	c3                   	ret
+
+008035c8 <devfile_write>:
+{
+  8035c8:	55                   	push   %ebp
+  8035c9:	89 e5                	mov    %esp,%ebp
+  8035cb:	83 ec 0c             	sub    $0xc,%esp
+  8035ce:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8035d1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8035d6:	39 d0                	cmp    %edx,%eax
+  8035d8:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8035db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8035de:	8b 52 0c             	mov    0xc(%edx),%edx
+  8035e1:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = count;
+  8035e7:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8035ec:	50                   	push   %eax
+  8035ed:	ff 75 0c             	push   0xc(%ebp)
+  8035f0:	68 08 00 81 00       	push   $0x810008
+  8035f5:	e8 b5 e8 ff ff       	call   801eaf <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8035fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  803604:	e8 c2 fe ff ff       	call   8034cb <fsipc>
+}
+  803609:	c9                   	leave
+  80360a:	c3                   	ret
+
+0080360b <devfile_read>:
+{
+  80360b:	55                   	push   %ebp
+  80360c:	89 e5                	mov    %esp,%ebp
+  80360e:	53                   	push   %ebx
+  80360f:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803612:	8b 45 08             	mov    0x8(%ebp),%eax
+  803615:	8b 40 0c             	mov    0xc(%eax),%eax
+  803618:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  80361d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803620:	a3 04 00 81 00       	mov    %eax,0x810004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  803625:	ba 00 00 81 00       	mov    $0x810000,%edx
+  80362a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80362f:	e8 97 fe ff ff       	call   8034cb <fsipc>
+  803634:	89 c3                	mov    %eax,%ebx
+  803636:	85 c0                	test   %eax,%eax
+  803638:	78 14                	js     80364e <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  80363a:	83 ec 04             	sub    $0x4,%esp
+  80363d:	50                   	push   %eax
+  80363e:	68 00 00 81 00       	push   $0x810000
+  803643:	ff 75 0c             	push   0xc(%ebp)
+  803646:	e8 64 e8 ff ff       	call   801eaf <memmove>
+	return r;
+  80364b:	83 c4 10             	add    $0x10,%esp
+}
+  80364e:	89 d8                	mov    %ebx,%eax
+  803650:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803653:	c9                   	leave
+  803654:	c3                   	ret
+
+00803655 <open>:
+{
+  803655:	55                   	push   %ebp
+  803656:	89 e5                	mov    %esp,%ebp
+  803658:	53                   	push   %ebx
+  803659:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80365c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80365f:	50                   	push   %eax
+  803660:	e8 23 f8 ff ff       	call   802e88 <fd_alloc>
+  803665:	89 c3                	mov    %eax,%ebx
+  803667:	83 c4 10             	add    $0x10,%esp
+  80366a:	85 c0                	test   %eax,%eax
+  80366c:	78 2a                	js     803698 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80366e:	83 ec 0c             	sub    $0xc,%esp
+  803671:	ff 75 08             	push   0x8(%ebp)
+  803674:	e8 3a e6 ff ff       	call   801cb3 <strlen>
+  803679:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80367c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  803681:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803686:	7e 17                	jle    80369f <open+0x4a>
+	fd_close(fd, 1);
+  803688:	83 ec 08             	sub    $0x8,%esp
+  80368b:	6a 01                	push   $0x1
+  80368d:	ff 75 f4             	push   -0xc(%ebp)
+  803690:	e8 08 f9 ff ff       	call   802f9d <fd_close>
+	return r;
+  803695:	83 c4 10             	add    $0x10,%esp
+}
+  803698:	89 d8                	mov    %ebx,%eax
+  80369a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80369d:	c9                   	leave
+  80369e:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80369f:	83 ec 08             	sub    $0x8,%esp
+  8036a2:	ff 75 08             	push   0x8(%ebp)
+  8036a5:	68 00 00 81 00       	push   $0x810000
+  8036aa:	e8 50 e6 ff ff       	call   801cff <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8036af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036b2:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8036b7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8036ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036bf:	e8 07 fe ff ff       	call   8034cb <fsipc>
+  8036c4:	89 c3                	mov    %eax,%ebx
+  8036c6:	83 c4 10             	add    $0x10,%esp
+  8036c9:	85 c0                	test   %eax,%eax
+  8036cb:	78 bb                	js     803688 <open+0x33>
+	return fd2num(fd); 	
+  8036cd:	83 ec 0c             	sub    $0xc,%esp
+  8036d0:	ff 75 f4             	push   -0xc(%ebp)
+  8036d3:	e8 89 f7 ff ff       	call   802e61 <fd2num>
+  8036d8:	89 c3                	mov    %eax,%ebx
+  8036da:	83 c4 10             	add    $0x10,%esp
+  8036dd:	eb b9                	jmp    803698 <open+0x43>
+
+008036df <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8036df:	55                   	push   %ebp
+  8036e0:	89 e5                	mov    %esp,%ebp
+  8036e2:	53                   	push   %ebx
+  8036e3:	83 ec 1c             	sub    $0x1c,%esp
+  8036e6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036ec:	50                   	push   %eax
+  8036ed:	ff 75 08             	push   0x8(%ebp)
+  8036f0:	e8 e3 f7 ff ff       	call   802ed8 <fd_lookup>
+  8036f5:	83 c4 10             	add    $0x10,%esp
+  8036f8:	85 c0                	test   %eax,%eax
+  8036fa:	78 5a                	js     803756 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8036fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036ff:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  803705:	39 10                	cmp    %edx,(%eax)
+  803707:	75 66                	jne    80376f <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  803709:	83 3d 44 f0 80 00 00 	cmpl   $0x0,0x80f044
+  803710:	74 49                	je     80375b <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803712:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803715:	8b 40 0c             	mov    0xc(%eax),%eax
+  803718:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.map.req_offset = offset;
+  80371d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803720:	a3 04 00 81 00       	mov    %eax,0x810004
+	fsipcbuf.map.req_npages = maxpages;
+  803725:	89 1d 08 00 81 00    	mov    %ebx,0x810008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80372b:	6a 07                	push   $0x7
+  80372d:	68 00 00 81 00       	push   $0x810000
+  803732:	6a 09                	push   $0x9
+  803734:	ff 35 44 f0 80 00    	push   0x80f044
+  80373a:	e8 24 2b 00 00       	call   806263 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80373f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803746:	6a 00                	push   $0x0
+  803748:	53                   	push   %ebx
+  803749:	ff 75 10             	push   0x10(%ebp)
+  80374c:	6a 00                	push   $0x0
+  80374e:	e8 4d 29 00 00       	call   8060a0 <ipc_recv_pages>
+  803753:	83 c4 20             	add    $0x20,%esp
+}
+  803756:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803759:	c9                   	leave
+  80375a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80375b:	83 ec 0c             	sub    $0xc,%esp
+  80375e:	6a 02                	push   $0x2
+  803760:	e8 67 2b 00 00       	call   8062cc <ipc_find_env>
+  803765:	a3 44 f0 80 00       	mov    %eax,0x80f044
+  80376a:	83 c4 10             	add    $0x10,%esp
+  80376d:	eb a3                	jmp    803712 <fmap+0x33>
+		return -E_INVAL;
+  80376f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803774:	eb e0                	jmp    803756 <fmap+0x77>
+
+00803776 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803776:	55                   	push   %ebp
+  803777:	89 e5                	mov    %esp,%ebp
+  803779:	53                   	push   %ebx
+  80377a:	83 ec 10             	sub    $0x10,%esp
+  80377d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  803780:	53                   	push   %ebx
+  803781:	e8 2d e5 ff ff       	call   801cb3 <strlen>
+  803786:	83 c4 10             	add    $0x10,%esp
+  803789:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80378e:	7f 25                	jg     8037b5 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  803790:	83 ec 08             	sub    $0x8,%esp
+  803793:	53                   	push   %ebx
+  803794:	68 00 00 81 00       	push   $0x810000
+  803799:	e8 61 e5 ff ff       	call   801cff <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80379e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037a3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8037a8:	e8 1e fd ff ff       	call   8034cb <fsipc>
+  8037ad:	83 c4 10             	add    $0x10,%esp
+}
+  8037b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037b3:	c9                   	leave
+  8037b4:	c3                   	ret
+		return -E_BAD_PATH;
+  8037b5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8037ba:	eb f4                	jmp    8037b0 <remove+0x3a>
+
+008037bc <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8037bc:	55                   	push   %ebp
+  8037bd:	89 e5                	mov    %esp,%ebp
+  8037bf:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8037c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8037cc:	e8 fa fc ff ff       	call   8034cb <fsipc>
+}
+  8037d1:	c9                   	leave
+  8037d2:	c3                   	ret
+
+008037d3 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8037d3:	55                   	push   %ebp
+  8037d4:	89 e5                	mov    %esp,%ebp
+  8037d6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8037d9:	68 60 70 80 00       	push   $0x807060
+  8037de:	ff 75 0c             	push   0xc(%ebp)
+  8037e1:	e8 19 e5 ff ff       	call   801cff <strcpy>
+	return 0;
+}
+  8037e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037eb:	c9                   	leave
+  8037ec:	c3                   	ret
+
+008037ed <devsock_close>:
+{
+  8037ed:	55                   	push   %ebp
+  8037ee:	89 e5                	mov    %esp,%ebp
+  8037f0:	53                   	push   %ebx
+  8037f1:	83 ec 10             	sub    $0x10,%esp
+  8037f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8037f7:	53                   	push   %ebx
+  8037f8:	e8 0e 2b 00 00       	call   80630b <pageref>
+  8037fd:	89 c2                	mov    %eax,%edx
+  8037ff:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803802:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803807:	83 fa 01             	cmp    $0x1,%edx
+  80380a:	74 05                	je     803811 <devsock_close+0x24>
+}
+  80380c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80380f:	c9                   	leave
+  803810:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803811:	83 ec 0c             	sub    $0xc,%esp
+  803814:	ff 73 0c             	push   0xc(%ebx)
+  803817:	e8 b0 05 00 00       	call   803dcc <nsipc_close>
+  80381c:	83 c4 10             	add    $0x10,%esp
+  80381f:	eb eb                	jmp    80380c <devsock_close+0x1f>
+
+00803821 <devsock_write>:
+{
+  803821:	55                   	push   %ebp
+  803822:	89 e5                	mov    %esp,%ebp
+  803824:	53                   	push   %ebx
+  803825:	83 ec 14             	sub    $0x14,%esp
+  803828:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80382b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80382e:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  803831:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  803834:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803837:	8b 41 08             	mov    0x8(%ecx),%eax
+  80383a:	c1 f8 09             	sar    $0x9,%eax
+  80383d:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  803840:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803846:	77 13                	ja     80385b <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  803848:	50                   	push   %eax
+  803849:	52                   	push   %edx
+  80384a:	53                   	push   %ebx
+  80384b:	ff 71 0c             	push   0xc(%ecx)
+  80384e:	e8 5c 06 00 00       	call   803eaf <nsipc_send>
+  803853:	83 c4 10             	add    $0x10,%esp
+}
+  803856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803859:	c9                   	leave
+  80385a:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80385b:	50                   	push   %eax
+  80385c:	6a 01                	push   $0x1
+  80385e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803861:	50                   	push   %eax
+  803862:	ff 71 0c             	push   0xc(%ecx)
+  803865:	e8 a6 06 00 00       	call   803f10 <nsipc_sendmsg>
+  80386a:	83 c4 10             	add    $0x10,%esp
+  80386d:	eb e7                	jmp    803856 <devsock_write+0x35>
+
+0080386f <devsock_read>:
+{
+  80386f:	55                   	push   %ebp
+  803870:	89 e5                	mov    %esp,%ebp
+  803872:	53                   	push   %ebx
+  803873:	83 ec 14             	sub    $0x14,%esp
+  803876:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803879:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80387c:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80387f:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  803882:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803885:	8b 41 08             	mov    0x8(%ecx),%eax
+  803888:	c1 f8 09             	sar    $0x9,%eax
+  80388b:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80388e:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803894:	77 13                	ja     8038a9 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  803896:	50                   	push   %eax
+  803897:	52                   	push   %edx
+  803898:	53                   	push   %ebx
+  803899:	ff 71 0c             	push   0xc(%ecx)
+  80389c:	e8 9c 05 00 00       	call   803e3d <nsipc_recv>
+  8038a1:	83 c4 10             	add    $0x10,%esp
+}
+  8038a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a7:	c9                   	leave
+  8038a8:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8038a9:	50                   	push   %eax
+  8038aa:	6a 01                	push   $0x1
+  8038ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8038af:	50                   	push   %eax
+  8038b0:	ff 71 0c             	push   0xc(%ecx)
+  8038b3:	e8 02 0a 00 00       	call   8042ba <nsipc_recvmsg>
+  8038b8:	83 c4 10             	add    $0x10,%esp
+  8038bb:	eb e7                	jmp    8038a4 <devsock_read+0x35>
+
+008038bd <fd2sockid>:
+{
+  8038bd:	55                   	push   %ebp
+  8038be:	89 e5                	mov    %esp,%ebp
+  8038c0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8038c3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8038c6:	52                   	push   %edx
+  8038c7:	50                   	push   %eax
+  8038c8:	e8 0b f6 ff ff       	call   802ed8 <fd_lookup>
+  8038cd:	83 c4 10             	add    $0x10,%esp
+  8038d0:	85 c0                	test   %eax,%eax
+  8038d2:	78 10                	js     8038e4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8038d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038d7:	8b 0d 60 80 80 00    	mov    0x808060,%ecx
+  8038dd:	39 08                	cmp    %ecx,(%eax)
+  8038df:	75 05                	jne    8038e6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8038e1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8038e4:	c9                   	leave
+  8038e5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8038e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8038eb:	eb f7                	jmp    8038e4 <fd2sockid+0x27>
+
+008038ed <sock_flags>:
+{
+  8038ed:	55                   	push   %ebp
+  8038ee:	89 e5                	mov    %esp,%ebp
+  8038f0:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8038f3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8038f6:	52                   	push   %edx
+  8038f7:	50                   	push   %eax
+  8038f8:	e8 db f5 ff ff       	call   802ed8 <fd_lookup>
+  8038fd:	83 c4 10             	add    $0x10,%esp
+  803900:	85 c0                	test   %eax,%eax
+  803902:	78 0e                	js     803912 <sock_flags+0x25>
+  803904:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803907:	8b 40 08             	mov    0x8(%eax),%eax
+  80390a:	c1 e8 09             	shr    $0x9,%eax
+  80390d:	83 e0 08             	and    $0x8,%eax
+}
+  803910:	c9                   	leave
+  803911:	c3                   	ret
+		return 0;
+  803912:	b8 00 00 00 00       	mov    $0x0,%eax
+  803917:	eb f7                	jmp    803910 <sock_flags+0x23>
+
+00803919 <alloc_sockfd>:
+{
+  803919:	55                   	push   %ebp
+  80391a:	89 e5                	mov    %esp,%ebp
+  80391c:	56                   	push   %esi
+  80391d:	53                   	push   %ebx
+  80391e:	83 ec 1c             	sub    $0x1c,%esp
+  803921:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803923:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803926:	50                   	push   %eax
+  803927:	e8 5c f5 ff ff       	call   802e88 <fd_alloc>
+  80392c:	89 c3                	mov    %eax,%ebx
+  80392e:	83 c4 10             	add    $0x10,%esp
+  803931:	85 c0                	test   %eax,%eax
+  803933:	78 43                	js     803978 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803935:	83 ec 04             	sub    $0x4,%esp
+  803938:	68 07 04 00 00       	push   $0x407
+  80393d:	ff 75 f4             	push   -0xc(%ebp)
+  803940:	6a 00                	push   $0x0
+  803942:	e8 ec e7 ff ff       	call   802133 <sys_page_alloc>
+  803947:	89 c3                	mov    %eax,%ebx
+  803949:	83 c4 10             	add    $0x10,%esp
+  80394c:	85 c0                	test   %eax,%eax
+  80394e:	78 28                	js     803978 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803950:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803953:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  803959:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80395b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80395e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803965:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803968:	83 ec 0c             	sub    $0xc,%esp
+  80396b:	50                   	push   %eax
+  80396c:	e8 f0 f4 ff ff       	call   802e61 <fd2num>
+  803971:	89 c3                	mov    %eax,%ebx
+  803973:	83 c4 10             	add    $0x10,%esp
+  803976:	eb 0c                	jmp    803984 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803978:	83 ec 0c             	sub    $0xc,%esp
+  80397b:	56                   	push   %esi
+  80397c:	e8 4b 04 00 00       	call   803dcc <nsipc_close>
+		return r;
+  803981:	83 c4 10             	add    $0x10,%esp
+}
+  803984:	89 d8                	mov    %ebx,%eax
+  803986:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803989:	5b                   	pop    %ebx
+  80398a:	5e                   	pop    %esi
+  80398b:	5d                   	pop    %ebp
+  80398c:	c3                   	ret
+
+0080398d <accept>:
+{
+  80398d:	55                   	push   %ebp
+  80398e:	89 e5                	mov    %esp,%ebp
+  803990:	56                   	push   %esi
+  803991:	53                   	push   %ebx
+  803992:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803995:	89 f0                	mov    %esi,%eax
+  803997:	e8 21 ff ff ff       	call   8038bd <fd2sockid>
+  80399c:	89 c3                	mov    %eax,%ebx
+  80399e:	85 c0                	test   %eax,%eax
+  8039a0:	78 24                	js     8039c6 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8039a2:	89 f0                	mov    %esi,%eax
+  8039a4:	e8 44 ff ff ff       	call   8038ed <sock_flags>
+  8039a9:	50                   	push   %eax
+  8039aa:	ff 75 10             	push   0x10(%ebp)
+  8039ad:	ff 75 0c             	push   0xc(%ebp)
+  8039b0:	53                   	push   %ebx
+  8039b1:	e8 6b 03 00 00       	call   803d21 <nsipc_accept>
+  8039b6:	89 c3                	mov    %eax,%ebx
+  8039b8:	83 c4 10             	add    $0x10,%esp
+  8039bb:	85 c0                	test   %eax,%eax
+  8039bd:	78 07                	js     8039c6 <accept+0x39>
+	return alloc_sockfd(r);
+  8039bf:	e8 55 ff ff ff       	call   803919 <alloc_sockfd>
+  8039c4:	89 c3                	mov    %eax,%ebx
+}
+  8039c6:	89 d8                	mov    %ebx,%eax
+  8039c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039cb:	5b                   	pop    %ebx
+  8039cc:	5e                   	pop    %esi
+  8039cd:	5d                   	pop    %ebp
+  8039ce:	c3                   	ret
+
+008039cf <bind>:
+{
+  8039cf:	55                   	push   %ebp
+  8039d0:	89 e5                	mov    %esp,%ebp
+  8039d2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8039d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039d8:	e8 e0 fe ff ff       	call   8038bd <fd2sockid>
+  8039dd:	85 c0                	test   %eax,%eax
+  8039df:	78 12                	js     8039f3 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8039e1:	83 ec 04             	sub    $0x4,%esp
+  8039e4:	ff 75 10             	push   0x10(%ebp)
+  8039e7:	ff 75 0c             	push   0xc(%ebp)
+  8039ea:	50                   	push   %eax
+  8039eb:	e8 85 03 00 00       	call   803d75 <nsipc_bind>
+  8039f0:	83 c4 10             	add    $0x10,%esp
+}
+  8039f3:	c9                   	leave
+  8039f4:	c3                   	ret
+
+008039f5 <shutdown>:
+{
+  8039f5:	55                   	push   %ebp
+  8039f6:	89 e5                	mov    %esp,%ebp
+  8039f8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8039fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039fe:	e8 ba fe ff ff       	call   8038bd <fd2sockid>
+  803a03:	85 c0                	test   %eax,%eax
+  803a05:	78 0f                	js     803a16 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803a07:	83 ec 08             	sub    $0x8,%esp
+  803a0a:	ff 75 0c             	push   0xc(%ebp)
+  803a0d:	50                   	push   %eax
+  803a0e:	e8 97 03 00 00       	call   803daa <nsipc_shutdown>
+  803a13:	83 c4 10             	add    $0x10,%esp
+}
+  803a16:	c9                   	leave
+  803a17:	c3                   	ret
+
+00803a18 <connect>:
+{
+  803a18:	55                   	push   %ebp
+  803a19:	89 e5                	mov    %esp,%ebp
+  803a1b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a21:	e8 97 fe ff ff       	call   8038bd <fd2sockid>
+  803a26:	85 c0                	test   %eax,%eax
+  803a28:	78 12                	js     803a3c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803a2a:	83 ec 04             	sub    $0x4,%esp
+  803a2d:	ff 75 10             	push   0x10(%ebp)
+  803a30:	ff 75 0c             	push   0xc(%ebp)
+  803a33:	50                   	push   %eax
+  803a34:	e8 ad 03 00 00       	call   803de6 <nsipc_connect>
+  803a39:	83 c4 10             	add    $0x10,%esp
+}
+  803a3c:	c9                   	leave
+  803a3d:	c3                   	ret
+
+00803a3e <listen>:
+{
+  803a3e:	55                   	push   %ebp
+  803a3f:	89 e5                	mov    %esp,%ebp
+  803a41:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a47:	e8 71 fe ff ff       	call   8038bd <fd2sockid>
+  803a4c:	85 c0                	test   %eax,%eax
+  803a4e:	78 0f                	js     803a5f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803a50:	83 ec 08             	sub    $0x8,%esp
+  803a53:	ff 75 0c             	push   0xc(%ebp)
+  803a56:	50                   	push   %eax
+  803a57:	e8 bf 03 00 00       	call   803e1b <nsipc_listen>
+  803a5c:	83 c4 10             	add    $0x10,%esp
+}
+  803a5f:	c9                   	leave
+  803a60:	c3                   	ret
+
+00803a61 <sendmsg>:
+{
+  803a61:	55                   	push   %ebp
+  803a62:	89 e5                	mov    %esp,%ebp
+  803a64:	57                   	push   %edi
+  803a65:	56                   	push   %esi
+  803a66:	53                   	push   %ebx
+  803a67:	83 ec 0c             	sub    $0xc,%esp
+  803a6a:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a6d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  803a70:	89 f0                	mov    %esi,%eax
+  803a72:	e8 46 fe ff ff       	call   8038bd <fd2sockid>
+  803a77:	89 c3                	mov    %eax,%ebx
+  803a79:	85 c0                	test   %eax,%eax
+  803a7b:	78 1c                	js     803a99 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  803a7d:	89 f0                	mov    %esi,%eax
+  803a7f:	e8 69 fe ff ff       	call   8038ed <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  803a84:	0b 45 10             	or     0x10(%ebp),%eax
+  803a87:	50                   	push   %eax
+  803a88:	ff 77 0c             	push   0xc(%edi)
+  803a8b:	ff 77 08             	push   0x8(%edi)
+  803a8e:	53                   	push   %ebx
+  803a8f:	e8 7c 04 00 00       	call   803f10 <nsipc_sendmsg>
+  803a94:	89 c3                	mov    %eax,%ebx
+  803a96:	83 c4 10             	add    $0x10,%esp
+}
+  803a99:	89 d8                	mov    %ebx,%eax
+  803a9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a9e:	5b                   	pop    %ebx
+  803a9f:	5e                   	pop    %esi
+  803aa0:	5f                   	pop    %edi
+  803aa1:	5d                   	pop    %ebp
+  803aa2:	c3                   	ret
+
+00803aa3 <recvmsg>:
+{
+  803aa3:	55                   	push   %ebp
+  803aa4:	89 e5                	mov    %esp,%ebp
+  803aa6:	57                   	push   %edi
+  803aa7:	56                   	push   %esi
+  803aa8:	53                   	push   %ebx
+  803aa9:	83 ec 0c             	sub    $0xc,%esp
+  803aac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803aaf:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803ab2:	89 f8                	mov    %edi,%eax
+  803ab4:	e8 04 fe ff ff       	call   8038bd <fd2sockid>
+  803ab9:	89 c3                	mov    %eax,%ebx
+  803abb:	85 c0                	test   %eax,%eax
+  803abd:	78 2a                	js     803ae9 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  803abf:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  803ac6:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  803acd:	89 f8                	mov    %edi,%eax
+  803acf:	e8 19 fe ff ff       	call   8038ed <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  803ad4:	0b 45 10             	or     0x10(%ebp),%eax
+  803ad7:	50                   	push   %eax
+  803ad8:	ff 76 0c             	push   0xc(%esi)
+  803adb:	ff 76 08             	push   0x8(%esi)
+  803ade:	53                   	push   %ebx
+  803adf:	e8 d6 07 00 00       	call   8042ba <nsipc_recvmsg>
+  803ae4:	89 c3                	mov    %eax,%ebx
+  803ae6:	83 c4 10             	add    $0x10,%esp
+}
+  803ae9:	89 d8                	mov    %ebx,%eax
+  803aeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803aee:	5b                   	pop    %ebx
+  803aef:	5e                   	pop    %esi
+  803af0:	5f                   	pop    %edi
+  803af1:	5d                   	pop    %ebp
+  803af2:	c3                   	ret
+
+00803af3 <sendfile>:
+{
+  803af3:	55                   	push   %ebp
+  803af4:	89 e5                	mov    %esp,%ebp
+  803af6:	56                   	push   %esi
+  803af7:	53                   	push   %ebx
+  803af8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803afb:	89 f0                	mov    %esi,%eax
+  803afd:	e8 bb fd ff ff       	call   8038bd <fd2sockid>
+  803b02:	89 c3                	mov    %eax,%ebx
+  803b04:	85 c0                	test   %eax,%eax
+  803b06:	78 1f                	js     803b27 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  803b08:	89 f0                	mov    %esi,%eax
+  803b0a:	e8 de fd ff ff       	call   8038ed <sock_flags>
+  803b0f:	83 ec 0c             	sub    $0xc,%esp
+  803b12:	50                   	push   %eax
+  803b13:	ff 75 14             	push   0x14(%ebp)
+  803b16:	ff 75 10             	push   0x10(%ebp)
+  803b19:	ff 75 0c             	push   0xc(%ebp)
+  803b1c:	53                   	push   %ebx
+  803b1d:	e8 64 06 00 00       	call   804186 <nsipc_sendfile>
+  803b22:	89 c3                	mov    %eax,%ebx
+  803b24:	83 c4 20             	add    $0x20,%esp
+}
+  803b27:	89 d8                	mov    %ebx,%eax
+  803b29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b2c:	5b                   	pop    %ebx
+  803b2d:	5e                   	pop    %esi
+  803b2e:	5d                   	pop    %ebp
+  803b2f:	c3                   	ret
+
+00803b30 <evctl>:
+{
+  803b30:	55                   	push   %ebp
+  803b31:	89 e5                	mov    %esp,%ebp
+  803b33:	53                   	push   %ebx
+  803b34:	83 ec 04             	sub    $0x4,%esp
+  803b37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  803b3a:	89 d8                	mov    %ebx,%eax
+  803b3c:	e8 7c fd ff ff       	call   8038bd <fd2sockid>
+  803b41:	85 c0                	test   %eax,%eax
+  803b43:	78 10                	js     803b55 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  803b45:	83 ec 04             	sub    $0x4,%esp
+  803b48:	53                   	push   %ebx
+  803b49:	ff 75 0c             	push   0xc(%ebp)
+  803b4c:	50                   	push   %eax
+  803b4d:	e8 d2 0b 00 00       	call   804724 <nsipc_evctl>
+  803b52:	83 c4 10             	add    $0x10,%esp
+}
+  803b55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b58:	c9                   	leave
+  803b59:	c3                   	ret
+
+00803b5a <evwait>:
+{
+  803b5a:	55                   	push   %ebp
+  803b5b:	89 e5                	mov    %esp,%ebp
+  803b5d:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  803b60:	ff 75 10             	push   0x10(%ebp)
+  803b63:	ff 75 0c             	push   0xc(%ebp)
+  803b66:	ff 75 08             	push   0x8(%ebp)
+  803b69:	e8 e0 0b 00 00       	call   80474e <nsipc_evwait>
+}
+  803b6e:	c9                   	leave
+  803b6f:	c3                   	ret
+
+00803b70 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803b70:	55                   	push   %ebp
+  803b71:	89 e5                	mov    %esp,%ebp
+  803b73:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803b76:	ff 75 10             	push   0x10(%ebp)
+  803b79:	ff 75 0c             	push   0xc(%ebp)
+  803b7c:	ff 75 08             	push   0x8(%ebp)
+  803b7f:	e8 31 0c 00 00       	call   8047b5 <nsipc_socket>
+  803b84:	83 c4 10             	add    $0x10,%esp
+  803b87:	85 c0                	test   %eax,%eax
+  803b89:	78 05                	js     803b90 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803b8b:	e8 89 fd ff ff       	call   803919 <alloc_sockfd>
+}
+  803b90:	c9                   	leave
+  803b91:	c3                   	ret
+
+00803b92 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803b92:	55                   	push   %ebp
+  803b93:	89 e5                	mov    %esp,%ebp
+  803b95:	53                   	push   %ebx
+  803b96:	83 ec 04             	sub    $0x4,%esp
+  803b99:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  803b9b:	83 3d 64 f3 80 00 00 	cmpl   $0x0,0x80f364
+  803ba2:	74 26                	je     803bca <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803ba4:	6a 07                	push   $0x7
+  803ba6:	68 00 10 81 00       	push   $0x811000
+  803bab:	53                   	push   %ebx
+  803bac:	ff 35 64 f3 80 00    	push   0x80f364
+  803bb2:	e8 ac 26 00 00       	call   806263 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803bb7:	83 c4 0c             	add    $0xc,%esp
+  803bba:	6a 00                	push   $0x0
+  803bbc:	6a 00                	push   $0x0
+  803bbe:	6a 00                	push   $0x0
+  803bc0:	e8 0e 24 00 00       	call   805fd3 <ipc_recv>
+}
+  803bc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bc8:	c9                   	leave
+  803bc9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803bca:	83 ec 0c             	sub    $0xc,%esp
+  803bcd:	6a 03                	push   $0x3
+  803bcf:	e8 f8 26 00 00       	call   8062cc <ipc_find_env>
+  803bd4:	a3 64 f3 80 00       	mov    %eax,0x80f364
+  803bd9:	83 c4 10             	add    $0x10,%esp
+  803bdc:	eb c6                	jmp    803ba4 <nsipc+0x12>
+
+00803bde <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  803bde:	55                   	push   %ebp
+  803bdf:	89 e5                	mov    %esp,%ebp
+  803be1:	56                   	push   %esi
+  803be2:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  803be3:	8b 35 70 f3 80 00    	mov    0x80f370,%esi
+		return 0;
+  803be9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  803bee:	85 f6                	test   %esi,%esi
+  803bf0:	75 33                	jne    803c25 <nsbulk_map+0x47>
+  803bf2:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  803bf7:	83 ec 04             	sub    $0x4,%esp
+  803bfa:	6a 07                	push   $0x7
+  803bfc:	53                   	push   %ebx
+  803bfd:	6a 00                	push   $0x0
+  803bff:	e8 2f e5 ff ff       	call   802133 <sys_page_alloc>
+  803c04:	83 c4 10             	add    $0x10,%esp
+  803c07:	85 c0                	test   %eax,%eax
+  803c09:	78 1a                	js     803c25 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  803c0b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803c11:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  803c17:	75 de                	jne    803bf7 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  803c19:	c7 05 70 f3 80 00 01 	movl   $0x1,0x80f370
+  803c20:	00 00 00 
+	return 0;
+  803c23:	89 f0                	mov    %esi,%eax
+}
+  803c25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c28:	5b                   	pop    %ebx
+  803c29:	5e                   	pop    %esi
+  803c2a:	5d                   	pop    %ebp
+  803c2b:	c3                   	ret
+
+00803c2c <nsbulk_own>:
+{
+  803c2c:	55                   	push   %ebp
+  803c2d:	89 e5                	mov    %esp,%ebp
+  803c2f:	57                   	push   %edi
+  803c30:	56                   	push   %esi
+  803c31:	53                   	push   %ebx
+  803c32:	83 ec 0c             	sub    $0xc,%esp
+  803c35:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  803c37:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  803c3a:	85 d2                	test   %edx,%edx
+  803c3c:	7f 0e                	jg     803c4c <nsbulk_own+0x20>
+	return 0;
+  803c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c43:	eb 47                	jmp    803c8c <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  803c45:	83 c3 01             	add    $0x1,%ebx
+  803c48:	39 fb                	cmp    %edi,%ebx
+  803c4a:	7d 3b                	jge    803c87 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  803c4c:	be 01 00 00 00       	mov    $0x1,%esi
+  803c51:	89 d9                	mov    %ebx,%ecx
+  803c53:	d3 e6                	shl    %cl,%esi
+  803c55:	89 f0                	mov    %esi,%eax
+  803c57:	23 05 6c f3 80 00    	and    0x80f36c,%eax
+  803c5d:	74 e6                	je     803c45 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  803c5f:	83 ec 04             	sub    $0x4,%esp
+  803c62:	6a 07                	push   $0x7
+  803c64:	89 d8                	mov    %ebx,%eax
+  803c66:	c1 e0 0c             	shl    $0xc,%eax
+  803c69:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803c6e:	50                   	push   %eax
+  803c6f:	6a 00                	push   $0x0
+  803c71:	e8 bd e4 ff ff       	call   802133 <sys_page_alloc>
+  803c76:	83 c4 10             	add    $0x10,%esp
+  803c79:	85 c0                	test   %eax,%eax
+  803c7b:	78 0f                	js     803c8c <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  803c7d:	f7 d6                	not    %esi
+  803c7f:	21 35 6c f3 80 00    	and    %esi,0x80f36c
+  803c85:	eb be                	jmp    803c45 <nsbulk_own+0x19>
+	return 0;
+  803c87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c8f:	5b                   	pop    %ebx
+  803c90:	5e                   	pop    %esi
+  803c91:	5f                   	pop    %edi
+  803c92:	5d                   	pop    %ebp
+  803c93:	c3                   	ret
+
+00803c94 <nsipc_bulk>:
+{
+  803c94:	55                   	push   %ebp
+  803c95:	89 e5                	mov    %esp,%ebp
+  803c97:	57                   	push   %edi
+  803c98:	56                   	push   %esi
+  803c99:	53                   	push   %ebx
+  803c9a:	83 ec 1c             	sub    $0x1c,%esp
+  803c9d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803ca0:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  803ca2:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  803ca8:	c1 fb 0c             	sar    $0xc,%ebx
+  803cab:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  803cae:	83 3d 64 f3 80 00 00 	cmpl   $0x0,0x80f364
+  803cb5:	74 56                	je     803d0d <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803cb7:	85 ff                	test   %edi,%edi
+  803cb9:	7e 24                	jle    803cdf <nsipc_bulk+0x4b>
+  803cbb:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  803cc1:	74 1c                	je     803cdf <nsipc_bulk+0x4b>
+  803cc3:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  803cc9:	c1 e3 0c             	shl    $0xc,%ebx
+  803ccc:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  803cd1:	0f b6 10             	movzbl (%eax),%edx
+  803cd4:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803cd6:	05 00 10 00 00       	add    $0x1000,%eax
+  803cdb:	39 d8                	cmp    %ebx,%eax
+  803cdd:	75 f2                	jne    803cd1 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  803cdf:	83 ec 0c             	sub    $0xc,%esp
+  803ce2:	56                   	push   %esi
+  803ce3:	57                   	push   %edi
+  803ce4:	68 00 00 00 e0       	push   $0xe0000000
+  803ce9:	ff 75 e4             	push   -0x1c(%ebp)
+  803cec:	ff 35 64 f3 80 00    	push   0x80f364
+  803cf2:	e8 a0 25 00 00       	call   806297 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  803cf7:	83 c4 1c             	add    $0x1c,%esp
+  803cfa:	6a 00                	push   $0x0
+  803cfc:	6a 00                	push   $0x0
+  803cfe:	6a 00                	push   $0x0
+  803d00:	e8 ce 22 00 00       	call   805fd3 <ipc_recv>
+}
+  803d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d08:	5b                   	pop    %ebx
+  803d09:	5e                   	pop    %esi
+  803d0a:	5f                   	pop    %edi
+  803d0b:	5d                   	pop    %ebp
+  803d0c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803d0d:	83 ec 0c             	sub    $0xc,%esp
+  803d10:	6a 03                	push   $0x3
+  803d12:	e8 b5 25 00 00       	call   8062cc <ipc_find_env>
+  803d17:	a3 64 f3 80 00       	mov    %eax,0x80f364
+  803d1c:	83 c4 10             	add    $0x10,%esp
+  803d1f:	eb 96                	jmp    803cb7 <nsipc_bulk+0x23>
+
+00803d21 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  803d21:	55                   	push   %ebp
+  803d22:	89 e5                	mov    %esp,%ebp
+  803d24:	53                   	push   %ebx
+  803d25:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803d28:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d2b:	a3 00 10 81 00       	mov    %eax,0x811000
+	nsipcbuf.accept.req_flags = flags;
+  803d30:	8b 45 14             	mov    0x14(%ebp),%eax
+  803d33:	a3 04 10 81 00       	mov    %eax,0x811004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803d38:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d3d:	e8 50 fe ff ff       	call   803b92 <nsipc>
+  803d42:	89 c3                	mov    %eax,%ebx
+  803d44:	85 c0                	test   %eax,%eax
+  803d46:	79 07                	jns    803d4f <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803d48:	89 d8                	mov    %ebx,%eax
+  803d4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d4d:	c9                   	leave
+  803d4e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803d4f:	83 ec 04             	sub    $0x4,%esp
+  803d52:	ff 35 10 10 81 00    	push   0x811010
+  803d58:	68 00 10 81 00       	push   $0x811000
+  803d5d:	ff 75 0c             	push   0xc(%ebp)
+  803d60:	e8 4a e1 ff ff       	call   801eaf <memmove>
+		*addrlen = ret->ret_addrlen;
+  803d65:	8b 15 10 10 81 00    	mov    0x811010,%edx
+  803d6b:	8b 45 10             	mov    0x10(%ebp),%eax
+  803d6e:	89 10                	mov    %edx,(%eax)
+  803d70:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803d73:	eb d3                	jmp    803d48 <nsipc_accept+0x27>
+
+00803d75 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803d75:	55                   	push   %ebp
+  803d76:	89 e5                	mov    %esp,%ebp
+  803d78:	53                   	push   %ebx
+  803d79:	83 ec 08             	sub    $0x8,%esp
+  803d7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d82:	a3 00 10 81 00       	mov    %eax,0x811000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803d87:	53                   	push   %ebx
+  803d88:	ff 75 0c             	push   0xc(%ebp)
+  803d8b:	68 04 10 81 00       	push   $0x811004
+  803d90:	e8 1a e1 ff ff       	call   801eaf <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803d95:	89 1d 14 10 81 00    	mov    %ebx,0x811014
+	return nsipc(NSREQ_BIND);
+  803d9b:	b8 02 00 00 00       	mov    $0x2,%eax
+  803da0:	e8 ed fd ff ff       	call   803b92 <nsipc>
+}
+  803da5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803da8:	c9                   	leave
+  803da9:	c3                   	ret
+
+00803daa <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803daa:	55                   	push   %ebp
+  803dab:	89 e5                	mov    %esp,%ebp
+  803dad:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803db0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803db3:	a3 00 10 81 00       	mov    %eax,0x811000
+	nsipcbuf.shutdown.req_how = how;
+  803db8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803dbb:	a3 04 10 81 00       	mov    %eax,0x811004
+	return nsipc(NSREQ_SHUTDOWN);
+  803dc0:	b8 03 00 00 00       	mov    $0x3,%eax
+  803dc5:	e8 c8 fd ff ff       	call   803b92 <nsipc>
+}
+  803dca:	c9                   	leave
+  803dcb:	c3                   	ret
+
+00803dcc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803dcc:	55                   	push   %ebp
+  803dcd:	89 e5                	mov    %esp,%ebp
+  803dcf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dd5:	a3 00 10 81 00       	mov    %eax,0x811000
+	return nsipc(NSREQ_CLOSE);
+  803dda:	b8 04 00 00 00       	mov    $0x4,%eax
+  803ddf:	e8 ae fd ff ff       	call   803b92 <nsipc>
+}
+  803de4:	c9                   	leave
+  803de5:	c3                   	ret
+
+00803de6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803de6:	55                   	push   %ebp
+  803de7:	89 e5                	mov    %esp,%ebp
+  803de9:	53                   	push   %ebx
+  803dea:	83 ec 08             	sub    $0x8,%esp
+  803ded:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803df3:	a3 00 10 81 00       	mov    %eax,0x811000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803df8:	53                   	push   %ebx
+  803df9:	ff 75 0c             	push   0xc(%ebp)
+  803dfc:	68 04 10 81 00       	push   $0x811004
+  803e01:	e8 a9 e0 ff ff       	call   801eaf <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803e06:	89 1d 14 10 81 00    	mov    %ebx,0x811014
+	return nsipc(NSREQ_CONNECT);
+  803e0c:	b8 05 00 00 00       	mov    $0x5,%eax
+  803e11:	e8 7c fd ff ff       	call   803b92 <nsipc>
+}
+  803e16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e19:	c9                   	leave
+  803e1a:	c3                   	ret
+
+00803e1b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803e1b:	55                   	push   %ebp
+  803e1c:	89 e5                	mov    %esp,%ebp
+  803e1e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803e21:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e24:	a3 00 10 81 00       	mov    %eax,0x811000
+	nsipcbuf.listen.req_backlog = backlog;
+  803e29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803e2c:	a3 04 10 81 00       	mov    %eax,0x811004
+	return nsipc(NSREQ_LISTEN);
+  803e31:	b8 06 00 00 00       	mov    $0x6,%eax
+  803e36:	e8 57 fd ff ff       	call   803b92 <nsipc>
+}
+  803e3b:	c9                   	leave
+  803e3c:	c3                   	ret
+
+00803e3d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803e3d:	55                   	push   %ebp
+  803e3e:	89 e5                	mov    %esp,%ebp
+  803e40:	56                   	push   %esi
+  803e41:	53                   	push   %ebx
+  803e42:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e48:	a3 00 10 81 00       	mov    %eax,0x811000
+	nsipcbuf.recv.req_len = len;
+  803e4d:	89 35 04 10 81 00    	mov    %esi,0x811004
+	nsipcbuf.recv.req_flags = flags;
+  803e53:	8b 45 14             	mov    0x14(%ebp),%eax
+  803e56:	a3 08 10 81 00       	mov    %eax,0x811008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803e5b:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e60:	e8 2d fd ff ff       	call   803b92 <nsipc>
+  803e65:	89 c3                	mov    %eax,%ebx
+  803e67:	85 c0                	test   %eax,%eax
+  803e69:	78 22                	js     803e8d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803e6b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803e70:	39 c6                	cmp    %eax,%esi
+  803e72:	0f 4e c6             	cmovle %esi,%eax
+  803e75:	39 c3                	cmp    %eax,%ebx
+  803e77:	7f 1d                	jg     803e96 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803e79:	83 ec 04             	sub    $0x4,%esp
+  803e7c:	53                   	push   %ebx
+  803e7d:	68 00 10 81 00       	push   $0x811000
+  803e82:	ff 75 0c             	push   0xc(%ebp)
+  803e85:	e8 25 e0 ff ff       	call   801eaf <memmove>
+  803e8a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803e8d:	89 d8                	mov    %ebx,%eax
+  803e8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e92:	5b                   	pop    %ebx
+  803e93:	5e                   	pop    %esi
+  803e94:	5d                   	pop    %ebp
+  803e95:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803e96:	68 6c 70 80 00       	push   $0x80706c
+  803e9b:	68 81 70 80 00       	push   $0x807081
+  803ea0:	68 b2 00 00 00       	push   $0xb2
+  803ea5:	68 96 70 80 00       	push   $0x807096
+  803eaa:	e8 7e d6 ff ff       	call   80152d <_panic>
+
+00803eaf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803eaf:	55                   	push   %ebp
+  803eb0:	89 e5                	mov    %esp,%ebp
+  803eb2:	53                   	push   %ebx
+  803eb3:	83 ec 04             	sub    $0x4,%esp
+  803eb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ebc:	a3 00 10 81 00       	mov    %eax,0x811000
+	assert(size < 1600);
+  803ec1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803ec7:	7f 2e                	jg     803ef7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803ec9:	83 ec 04             	sub    $0x4,%esp
+  803ecc:	53                   	push   %ebx
+  803ecd:	ff 75 0c             	push   0xc(%ebp)
+  803ed0:	68 0c 10 81 00       	push   $0x81100c
+  803ed5:	e8 d5 df ff ff       	call   801eaf <memmove>
+	nsipcbuf.send.req_size = size;
+  803eda:	89 1d 04 10 81 00    	mov    %ebx,0x811004
+	nsipcbuf.send.req_flags = flags;
+  803ee0:	8b 45 14             	mov    0x14(%ebp),%eax
+  803ee3:	a3 08 10 81 00       	mov    %eax,0x811008
+	return nsipc(NSREQ_SEND);
+  803ee8:	b8 08 00 00 00       	mov    $0x8,%eax
+  803eed:	e8 a0 fc ff ff       	call   803b92 <nsipc>
+}
+  803ef2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ef5:	c9                   	leave
+  803ef6:	c3                   	ret
+	assert(size < 1600);
+  803ef7:	68 a2 70 80 00       	push   $0x8070a2
+  803efc:	68 81 70 80 00       	push   $0x807081
+  803f01:	68 bd 00 00 00       	push   $0xbd
+  803f06:	68 96 70 80 00       	push   $0x807096
+  803f0b:	e8 1d d6 ff ff       	call   80152d <_panic>
+
+00803f10 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803f10:	55                   	push   %ebp
+  803f11:	89 e5                	mov    %esp,%ebp
+  803f13:	57                   	push   %edi
+  803f14:	56                   	push   %esi
+  803f15:	53                   	push   %ebx
+  803f16:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  803f19:	e8 c0 fc ff ff       	call   803bde <nsbulk_map>
+  803f1e:	85 c0                	test   %eax,%eax
+  803f20:	78 55                	js     803f77 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  803f22:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  803f29:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  803f30:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803f37:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803f3a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803f3d:	0f 8d 24 02 00 00    	jge    804167 <nsipc_sendmsg+0x257>
+  803f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803f46:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803f49:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  803f4c:	89 d8                	mov    %ebx,%eax
+  803f4e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803f53:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  803f55:	83 ec 0c             	sub    $0xc,%esp
+  803f58:	68 60 f0 80 00       	push   $0x80f060
+  803f5d:	e8 0d 1b 00 00       	call   805a6f <pgbatch_init>
+  803f62:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803f65:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  803f67:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  803f6a:	e9 82 00 00 00       	jmp    803ff1 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  803f6f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803f72:	85 db                	test   %ebx,%ebx
+  803f74:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  803f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f7a:	5b                   	pop    %ebx
+  803f7b:	5e                   	pop    %esi
+  803f7c:	5f                   	pop    %edi
+  803f7d:	5d                   	pop    %ebp
+  803f7e:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  803f7f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803f84:	29 c8                	sub    %ecx,%eax
+  803f86:	39 d0                	cmp    %edx,%eax
+  803f88:	0f 46 d0             	cmovbe %eax,%edx
+  803f8b:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  803f8d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803f93:	85 ff                	test   %edi,%edi
+  803f95:	0f 49 c7             	cmovns %edi,%eax
+  803f98:	c1 f8 0c             	sar    $0xc,%eax
+  803f9b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fa0:	e8 87 fc ff ff       	call   803c2c <nsbulk_own>
+  803fa5:	85 c0                	test   %eax,%eax
+  803fa7:	0f 88 17 01 00 00    	js     8040c4 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  803fad:	83 ec 04             	sub    $0x4,%esp
+  803fb0:	56                   	push   %esi
+  803fb1:	ff 75 e0             	push   -0x20(%ebp)
+  803fb4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803fb7:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803fbc:	50                   	push   %eax
+  803fbd:	e8 ed de ff ff       	call   801eaf <memmove>
+  803fc2:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  803fc5:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  803fc8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fcb:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803fce:	0f 84 fd 00 00 00    	je     8040d1 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  803fd4:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803fd7:	01 f7                	add    %esi,%edi
+  803fd9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803fdc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803fdf:	0f 8d 01 01 00 00    	jge    8040e6 <nsipc_sendmsg+0x1d6>
+  803fe5:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  803feb:	0f 8f f0 00 00 00    	jg     8040e1 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  803ff1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ff4:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  803ff7:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  803ffa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ffd:	89 c2                	mov    %eax,%edx
+  803fff:	03 13                	add    (%ebx),%edx
+  804001:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  804004:	8b 73 04             	mov    0x4(%ebx),%esi
+  804007:	29 c6                	sub    %eax,%esi
+  804009:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  80400e:	29 f9                	sub    %edi,%ecx
+  804010:	39 ce                	cmp    %ecx,%esi
+  804012:	89 ca                	mov    %ecx,%edx
+  804014:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  804017:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80401a:	89 f9                	mov    %edi,%ecx
+  80401c:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  804022:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804025:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80402a:	09 c8                	or     %ecx,%eax
+  80402c:	0f 85 4d ff ff ff    	jne    803f7f <nsipc_sendmsg+0x6f>
+  804032:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  804038:	0f 86 41 ff ff ff    	jbe    803f7f <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80403e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  804044:	85 ff                	test   %edi,%edi
+  804046:	0f 49 c7             	cmovns %edi,%eax
+  804049:	c1 f8 0c             	sar    $0xc,%eax
+  80404c:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80404e:	89 d1                	mov    %edx,%ecx
+  804050:	c1 e9 0c             	shr    $0xc,%ecx
+  804053:	01 c8                	add    %ecx,%eax
+  804055:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  804058:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80405b:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80405d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804060:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  804065:	29 c8                	sub    %ecx,%eax
+  804067:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80406a:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80406d:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80406f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804074:	89 f9                	mov    %edi,%ecx
+  804076:	d3 e0                	shl    %cl,%eax
+  804078:	09 05 6c f3 80 00    	or     %eax,0x80f36c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80407e:	83 ec 08             	sub    $0x8,%esp
+  804081:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  804083:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  804086:	50                   	push   %eax
+  804087:	6a 00                	push   $0x0
+  804089:	56                   	push   %esi
+  80408a:	6a 00                	push   $0x0
+  80408c:	68 60 f0 80 00       	push   $0x80f060
+  804091:	e8 97 1a 00 00       	call   805b2d <pgbatch_map>
+  804096:	83 c4 20             	add    $0x20,%esp
+  804099:	85 c0                	test   %eax,%eax
+  80409b:	0f 88 ce fe ff ff    	js     803f6f <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8040a1:	83 c7 01             	add    $0x1,%edi
+  8040a4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8040aa:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8040ad:	39 c7                	cmp    %eax,%edi
+  8040af:	75 be                	jne    80406f <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8040b1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8040b4:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8040b7:	89 d6                	mov    %edx,%esi
+  8040b9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8040bf:	e9 01 ff ff ff       	jmp    803fc5 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8040c4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8040c7:	85 db                	test   %ebx,%ebx
+  8040c9:	0f 45 c3             	cmovne %ebx,%eax
+  8040cc:	e9 a6 fe ff ff       	jmp    803f77 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8040d1:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8040d5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8040dc:	e9 f3 fe ff ff       	jmp    803fd4 <nsipc_sendmsg+0xc4>
+  8040e1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8040e4:	eb 03                	jmp    8040e9 <nsipc_sendmsg+0x1d9>
+  8040e6:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8040e9:	83 ec 0c             	sub    $0xc,%esp
+  8040ec:	68 60 f0 80 00       	push   $0x80f060
+  8040f1:	e8 87 19 00 00       	call   805a7d <pgbatch_flush>
+  8040f6:	83 c4 10             	add    $0x10,%esp
+  8040f9:	85 c0                	test   %eax,%eax
+  8040fb:	78 50                	js     80414d <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8040fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  804100:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  804105:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  80410b:	89 fb                	mov    %edi,%ebx
+  80410d:	29 f3                	sub    %esi,%ebx
+  80410f:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  804115:	8b 45 14             	mov    0x14(%ebp),%eax
+  804118:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  80411d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804122:	89 fa                	mov    %edi,%edx
+  804124:	b8 0c 00 00 00       	mov    $0xc,%eax
+  804129:	e8 66 fb ff ff       	call   803c94 <nsipc_bulk>
+  80412e:	85 c0                	test   %eax,%eax
+  804130:	78 28                	js     80415a <nsipc_sendmsg+0x24a>
+		sent += r;
+  804132:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  804135:	39 c3                	cmp    %eax,%ebx
+  804137:	75 0c                	jne    804145 <nsipc_sendmsg+0x235>
+  804139:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80413c:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80413f:	0f 8f f2 fd ff ff    	jg     803f37 <nsipc_sendmsg+0x27>
+		sent += r;
+  804145:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804148:	e9 2a fe ff ff       	jmp    803f77 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80414d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  804150:	85 db                	test   %ebx,%ebx
+  804152:	0f 45 c3             	cmovne %ebx,%eax
+  804155:	e9 1d fe ff ff       	jmp    803f77 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80415a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80415d:	85 db                	test   %ebx,%ebx
+  80415f:	0f 45 c3             	cmovne %ebx,%eax
+  804162:	e9 10 fe ff ff       	jmp    803f77 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  804167:	83 ec 0c             	sub    $0xc,%esp
+  80416a:	68 60 f0 80 00       	push   $0x80f060
+  80416f:	e8 fb 18 00 00       	call   805a6f <pgbatch_init>
+  804174:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  804177:	be 00 00 00 00       	mov    $0x0,%esi
+  80417c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804181:	e9 63 ff ff ff       	jmp    8040e9 <nsipc_sendmsg+0x1d9>
+
+00804186 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  804186:	55                   	push   %ebp
+  804187:	89 e5                	mov    %esp,%ebp
+  804189:	57                   	push   %edi
+  80418a:	56                   	push   %esi
+  80418b:	53                   	push   %ebx
+  80418c:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80418f:	83 3d 68 f3 80 00 00 	cmpl   $0x0,0x80f368
+  804196:	0f 84 c8 00 00 00    	je     804264 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80419c:	83 3d 64 f3 80 00 00 	cmpl   $0x0,0x80f364
+  8041a3:	0f 84 e4 00 00 00    	je     80428d <nsipc_sendfile+0x107>
+{
+  8041a9:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8041ae:	89 fb                	mov    %edi,%ebx
+  8041b0:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8041b3:	0f 83 f0 00 00 00    	jae    8042a9 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8041b9:	89 fa                	mov    %edi,%edx
+  8041bb:	03 55 10             	add    0x10(%ebp),%edx
+  8041be:	89 d0                	mov    %edx,%eax
+  8041c0:	c1 f8 1f             	sar    $0x1f,%eax
+  8041c3:	c1 e8 14             	shr    $0x14,%eax
+  8041c6:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8041c9:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8041cf:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8041d1:	6a 10                	push   $0x10
+  8041d3:	68 00 20 01 e0       	push   $0xe0012000
+  8041d8:	52                   	push   %edx
+  8041d9:	ff 75 0c             	push   0xc(%ebp)
+  8041dc:	e8 fe f4 ff ff       	call   8036df <fmap>
+  8041e1:	83 c4 10             	add    $0x10,%esp
+  8041e4:	85 c0                	test   %eax,%eax
+  8041e6:	0f 8e b8 00 00 00    	jle    8042a4 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8041ec:	39 c6                	cmp    %eax,%esi
+  8041ee:	0f 8d b5 00 00 00    	jge    8042a9 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8041f4:	29 f0                	sub    %esi,%eax
+  8041f6:	8b 55 14             	mov    0x14(%ebp),%edx
+  8041f9:	29 da                	sub    %ebx,%edx
+  8041fb:	39 d0                	cmp    %edx,%eax
+  8041fd:	89 d3                	mov    %edx,%ebx
+  8041ff:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  804202:	8b 45 08             	mov    0x8(%ebp),%eax
+  804205:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  80420a:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  804210:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  804216:	8b 45 18             	mov    0x18(%ebp),%eax
+  804219:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80421e:	83 ec 0c             	sub    $0xc,%esp
+  804221:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  804223:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  80422a:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80422d:	83 c0 01             	add    $0x1,%eax
+  804230:	50                   	push   %eax
+  804231:	68 00 10 01 e0       	push   $0xe0011000
+  804236:	6a 11                	push   $0x11
+  804238:	ff 35 64 f3 80 00    	push   0x80f364
+  80423e:	e8 54 20 00 00       	call   806297 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  804243:	83 c4 1c             	add    $0x1c,%esp
+  804246:	6a 00                	push   $0x0
+  804248:	6a 00                	push   $0x0
+  80424a:	6a 00                	push   $0x0
+  80424c:	e8 82 1d 00 00       	call   805fd3 <ipc_recv>
+  804251:	83 c4 10             	add    $0x10,%esp
+  804254:	85 c0                	test   %eax,%eax
+  804256:	78 5b                	js     8042b3 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  804258:	01 c7                	add    %eax,%edi
+		if (r < n)
+  80425a:	39 c3                	cmp    %eax,%ebx
+  80425c:	0f 8e 4c ff ff ff    	jle    8041ae <nsipc_sendfile+0x28>
+  804262:	eb 45                	jmp    8042a9 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  804264:	83 ec 04             	sub    $0x4,%esp
+  804267:	6a 07                	push   $0x7
+  804269:	68 00 10 01 e0       	push   $0xe0011000
+  80426e:	6a 00                	push   $0x0
+  804270:	e8 be de ff ff       	call   802133 <sys_page_alloc>
+  804275:	89 c7                	mov    %eax,%edi
+  804277:	83 c4 10             	add    $0x10,%esp
+  80427a:	85 c0                	test   %eax,%eax
+  80427c:	78 2b                	js     8042a9 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80427e:	c7 05 68 f3 80 00 01 	movl   $0x1,0x80f368
+  804285:	00 00 00 
+  804288:	e9 0f ff ff ff       	jmp    80419c <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80428d:	83 ec 0c             	sub    $0xc,%esp
+  804290:	6a 03                	push   $0x3
+  804292:	e8 35 20 00 00       	call   8062cc <ipc_find_env>
+  804297:	a3 64 f3 80 00       	mov    %eax,0x80f364
+  80429c:	83 c4 10             	add    $0x10,%esp
+  80429f:	e9 05 ff ff ff       	jmp    8041a9 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8042a4:	85 ff                	test   %edi,%edi
+  8042a6:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8042a9:	89 f8                	mov    %edi,%eax
+  8042ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042ae:	5b                   	pop    %ebx
+  8042af:	5e                   	pop    %esi
+  8042b0:	5f                   	pop    %edi
+  8042b1:	5d                   	pop    %ebp
+  8042b2:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8042b3:	85 ff                	test   %edi,%edi
+  8042b5:	0f 44 f8             	cmove  %eax,%edi
+  8042b8:	eb ef                	jmp    8042a9 <nsipc_sendfile+0x123>
+
+008042ba <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8042ba:	55                   	push   %ebp
+  8042bb:	89 e5                	mov    %esp,%ebp
+  8042bd:	57                   	push   %edi
+  8042be:	56                   	push   %esi
+  8042bf:	53                   	push   %ebx
+  8042c0:	83 ec 1c             	sub    $0x1c,%esp
+  8042c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8042c6:	e8 13 f9 ff ff       	call   803bde <nsbulk_map>
+  8042cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042ce:	85 c0                	test   %eax,%eax
+  8042d0:	0f 88 ba 00 00 00    	js     804390 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8042d6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8042da:	0f 8e bb 00 00 00    	jle    80439b <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8042e0:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8042e5:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8042ea:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8042ef:	89 f8                	mov    %edi,%eax
+  8042f1:	29 f0                	sub    %esi,%eax
+  8042f3:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8042f7:	39 c8                	cmp    %ecx,%eax
+  8042f9:	0f 47 c1             	cmova  %ecx,%eax
+  8042fc:	01 f0                	add    %esi,%eax
+  8042fe:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  804300:	83 c2 01             	add    $0x1,%edx
+  804303:	39 55 10             	cmp    %edx,0x10(%ebp)
+  804306:	7e 07                	jle    80430f <nsipc_recvmsg+0x55>
+  804308:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80430d:	7e e0                	jle    8042ef <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80430f:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  804315:	c1 fa 0c             	sar    $0xc,%edx
+  804318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431d:	e8 0a f9 ff ff       	call   803c2c <nsbulk_own>
+  804322:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804325:	85 c0                	test   %eax,%eax
+  804327:	78 67                	js     804390 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  804329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80432c:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  804331:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  804337:	8b 45 14             	mov    0x14(%ebp),%eax
+  80433a:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80433f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804344:	89 f2                	mov    %esi,%edx
+  804346:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80434b:	e8 44 f9 ff ff       	call   803c94 <nsipc_bulk>
+  804350:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804353:	85 c0                	test   %eax,%eax
+  804355:	78 39                	js     804390 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  804357:	39 f0                	cmp    %esi,%eax
+  804359:	7f 4a                	jg     8043a5 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80435b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804360:	85 c0                	test   %eax,%eax
+  804362:	7e 2c                	jle    804390 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  804364:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804367:	29 fe                	sub    %edi,%esi
+  804369:	8b 43 04             	mov    0x4(%ebx),%eax
+  80436c:	39 c6                	cmp    %eax,%esi
+  80436e:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  804371:	83 ec 04             	sub    $0x4,%esp
+  804374:	56                   	push   %esi
+  804375:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80437b:	50                   	push   %eax
+  80437c:	ff 33                	push   (%ebx)
+  80437e:	e8 2c db ff ff       	call   801eaf <memmove>
+		n += m;
+  804383:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  804385:	83 c3 08             	add    $0x8,%ebx
+  804388:	83 c4 10             	add    $0x10,%esp
+  80438b:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80438e:	7f d4                	jg     804364 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  804390:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804396:	5b                   	pop    %ebx
+  804397:	5e                   	pop    %esi
+  804398:	5f                   	pop    %edi
+  804399:	5d                   	pop    %ebp
+  80439a:	c3                   	ret
+	int r, i, n, len = 0;
+  80439b:	be 00 00 00 00       	mov    $0x0,%esi
+  8043a0:	e9 6a ff ff ff       	jmp    80430f <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8043a5:	68 78 70 80 00       	push   $0x807078
+  8043aa:	68 81 70 80 00       	push   $0x807081
+  8043af:	68 3b 01 00 00       	push   $0x13b
+  8043b4:	68 96 70 80 00       	push   $0x807096
+  8043b9:	e8 6f d1 ff ff       	call   80152d <_panic>
+
+008043be <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8043be:	55                   	push   %ebp
+  8043bf:	89 e5                	mov    %esp,%ebp
+  8043c1:	57                   	push   %edi
+  8043c2:	56                   	push   %esi
+  8043c3:	53                   	push   %ebx
+  8043c4:	83 ec 0c             	sub    $0xc,%esp
+  8043c7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8043ca:	8b 75 10             	mov    0x10(%ebp),%esi
+  8043cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8043d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043d3:	a3 00 10 81 00       	mov    %eax,0x811000
+	nsipcbuf.select.req_readset = *readset;
+  8043d8:	8b 07                	mov    (%edi),%eax
+  8043da:	a3 04 10 81 00       	mov    %eax,0x811004
+  8043df:	8b 47 04             	mov    0x4(%edi),%eax
+  8043e2:	a3 08 10 81 00       	mov    %eax,0x811008
+  8043e7:	8b 47 08             	mov    0x8(%edi),%eax
+  8043ea:	a3 0c 10 81 00       	mov    %eax,0x81100c
+  8043ef:	8b 47 0c             	mov    0xc(%edi),%eax
+  8043f2:	a3 10 10 81 00       	mov    %eax,0x811010
+  8043f7:	8b 47 10             	mov    0x10(%edi),%eax
+  8043fa:	a3 14 10 81 00       	mov    %eax,0x811014
+  8043ff:	8b 47 14             	mov    0x14(%edi),%eax
+  804402:	a3 18 10 81 00       	mov    %eax,0x811018
+  804407:	8b 47 18             	mov    0x18(%edi),%eax
+  80440a:	a3 1c 10 81 00       	mov    %eax,0x81101c
+  80440f:	8b 47 1c             	mov    0x1c(%edi),%eax
+  804412:	a3 20 10 81 00       	mov    %eax,0x811020
+  804417:	8b 47 20             	mov    0x20(%edi),%eax
+  80441a:	a3 24 10 81 00       	mov    %eax,0x811024
+  80441f:	8b 47 24             	mov    0x24(%edi),%eax
+  804422:	a3 28 10 81 00       	mov    %eax,0x811028
+  804427:	8b 47 28             	mov    0x28(%edi),%eax
+  80442a:	a3 2c 10 81 00       	mov    %eax,0x81102c
+  80442f:	8b 47 2c             	mov    0x2c(%edi),%eax
+  804432:	a3 30 10 81 00       	mov    %eax,0x811030
+  804437:	8b 47 30             	mov    0x30(%edi),%eax
+  80443a:	a3 34 10 81 00       	mov    %eax,0x811034
+  80443f:	8b 47 34             	mov    0x34(%edi),%eax
+  804442:	a3 38 10 81 00       	mov    %eax,0x811038
+  804447:	8b 47 38             	mov    0x38(%edi),%eax
+  80444a:	a3 3c 10 81 00       	mov    %eax,0x81103c
+  80444f:	8b 47 3c             	mov    0x3c(%edi),%eax
+  804452:	a3 40 10 81 00       	mov    %eax,0x811040
+	nsipcbuf.select.req_writeset = *writeset;
+  804457:	8b 06                	mov    (%esi),%eax
+  804459:	a3 44 10 81 00       	mov    %eax,0x811044
+  80445e:	8b 46 04             	mov    0x4(%esi),%eax
+  804461:	a3 48 10 81 00       	mov    %eax,0x811048
+  804466:	8b 46 08             	mov    0x8(%esi),%eax
+  804469:	a3 4c 10 81 00       	mov    %eax,0x81104c
+  80446e:	8b 46 0c             	mov    0xc(%esi),%eax
+  804471:	a3 50 10 81 00       	mov    %eax,0x811050
+  804476:	8b 46 10             	mov    0x10(%esi),%eax
+  804479:	a3 54 10 81 00       	mov    %eax,0x811054
+  80447e:	8b 46 14             	mov    0x14(%esi),%eax
+  804481:	a3 58 10 81 00       	mov    %eax,0x811058
+  804486:	8b 46 18             	mov    0x18(%esi),%eax
+  804489:	a3 5c 10 81 00       	mov    %eax,0x81105c
+  80448e:	8b 46 1c             	mov    0x1c(%esi),%eax
+  804491:	a3 60 10 81 00       	mov    %eax,0x811060
+  804496:	8b 46 20             	mov    0x20(%esi),%eax
+  804499:	a3 64 10 81 00       	mov    %eax,0x811064
+  80449e:	8b 46 24             	mov    0x24(%esi),%eax
+  8044a1:	a3 68 10 81 00       	mov    %eax,0x811068
+  8044a6:	8b 46 28             	mov    0x28(%esi),%eax
+  8044a9:	a3 6c 10 81 00       	mov    %eax,0x81106c
+  8044ae:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8044b1:	a3 70 10 81 00       	mov    %eax,0x811070
+  8044b6:	8b 46 30             	mov    0x30(%esi),%eax
+  8044b9:	a3 74 10 81 00       	mov    %eax,0x811074
+  8044be:	8b 46 34             	mov    0x34(%esi),%eax
+  8044c1:	a3 78 10 81 00       	mov    %eax,0x811078
+  8044c6:	8b 46 38             	mov    0x38(%esi),%eax
+  8044c9:	a3 7c 10 81 00       	mov    %eax,0x81107c
+  8044ce:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8044d1:	a3 80 10 81 00       	mov    %eax,0x811080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8044d6:	8b 03                	mov    (%ebx),%eax
+  8044d8:	a3 84 10 81 00       	mov    %eax,0x811084
+  8044dd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8044e0:	a3 88 10 81 00       	mov    %eax,0x811088
+  8044e5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8044e8:	a3 8c 10 81 00       	mov    %eax,0x81108c
+  8044ed:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8044f0:	a3 90 10 81 00       	mov    %eax,0x811090
+  8044f5:	8b 43 10             	mov    0x10(%ebx),%eax
+  8044f8:	a3 94 10 81 00       	mov    %eax,0x811094
+  8044fd:	8b 43 14             	mov    0x14(%ebx),%eax
+  804500:	a3 98 10 81 00       	mov    %eax,0x811098
+  804505:	8b 43 18             	mov    0x18(%ebx),%eax
+  804508:	a3 9c 10 81 00       	mov    %eax,0x81109c
+  80450d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  804510:	a3 a0 10 81 00       	mov    %eax,0x8110a0
+  804515:	8b 43 20             	mov    0x20(%ebx),%eax
+  804518:	a3 a4 10 81 00       	mov    %eax,0x8110a4
+  80451d:	8b 43 24             	mov    0x24(%ebx),%eax
+  804520:	a3 a8 10 81 00       	mov    %eax,0x8110a8
+  804525:	8b 43 28             	mov    0x28(%ebx),%eax
+  804528:	a3 ac 10 81 00       	mov    %eax,0x8110ac
+  80452d:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  804530:	a3 b0 10 81 00       	mov    %eax,0x8110b0
+  804535:	8b 43 30             	mov    0x30(%ebx),%eax
+  804538:	a3 b4 10 81 00       	mov    %eax,0x8110b4
+  80453d:	8b 43 34             	mov    0x34(%ebx),%eax
+  804540:	a3 b8 10 81 00       	mov    %eax,0x8110b8
+  804545:	8b 43 38             	mov    0x38(%ebx),%eax
+  804548:	a3 bc 10 81 00       	mov    %eax,0x8110bc
+  80454d:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  804550:	a3 c0 10 81 00       	mov    %eax,0x8110c0
+	nsipcbuf.select.req_timeout = msec;
+  804555:	8b 45 18             	mov    0x18(%ebp),%eax
+  804558:	a3 c4 10 81 00       	mov    %eax,0x8110c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80455d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  804562:	e8 2b f6 ff ff       	call   803b92 <nsipc>
+  804567:	85 c0                	test   %eax,%eax
+  804569:	0f 88 ad 01 00 00    	js     80471c <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80456f:	8b 15 04 10 81 00    	mov    0x811004,%edx
+  804575:	89 17                	mov    %edx,(%edi)
+  804577:	8b 15 08 10 81 00    	mov    0x811008,%edx
+  80457d:	89 57 04             	mov    %edx,0x4(%edi)
+  804580:	8b 15 0c 10 81 00    	mov    0x81100c,%edx
+  804586:	89 57 08             	mov    %edx,0x8(%edi)
+  804589:	8b 15 10 10 81 00    	mov    0x811010,%edx
+  80458f:	89 57 0c             	mov    %edx,0xc(%edi)
+  804592:	8b 15 14 10 81 00    	mov    0x811014,%edx
+  804598:	89 57 10             	mov    %edx,0x10(%edi)
+  80459b:	8b 15 18 10 81 00    	mov    0x811018,%edx
+  8045a1:	89 57 14             	mov    %edx,0x14(%edi)
+  8045a4:	8b 15 1c 10 81 00    	mov    0x81101c,%edx
+  8045aa:	89 57 18             	mov    %edx,0x18(%edi)
+  8045ad:	8b 15 20 10 81 00    	mov    0x811020,%edx
+  8045b3:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8045b6:	8b 15 24 10 81 00    	mov    0x811024,%edx
+  8045bc:	89 57 20             	mov    %edx,0x20(%edi)
+  8045bf:	8b 15 28 10 81 00    	mov    0x811028,%edx
+  8045c5:	89 57 24             	mov    %edx,0x24(%edi)
+  8045c8:	8b 15 2c 10 81 00    	mov    0x81102c,%edx
+  8045ce:	89 57 28             	mov    %edx,0x28(%edi)
+  8045d1:	8b 15 30 10 81 00    	mov    0x811030,%edx
+  8045d7:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8045da:	8b 15 34 10 81 00    	mov    0x811034,%edx
+  8045e0:	89 57 30             	mov    %edx,0x30(%edi)
+  8045e3:	8b 15 38 10 81 00    	mov    0x811038,%edx
+  8045e9:	89 57 34             	mov    %edx,0x34(%edi)
+  8045ec:	8b 15 3c 10 81 00    	mov    0x81103c,%edx
+  8045f2:	89 57 38             	mov    %edx,0x38(%edi)
+  8045f5:	8b 15 40 10 81 00    	mov    0x811040,%edx
+  8045fb:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8045fe:	8b 15 44 10 81 00    	mov    0x811044,%edx
+  804604:	89 16                	mov    %edx,(%esi)
+  804606:	8b 15 48 10 81 00    	mov    0x811048,%edx
+  80460c:	89 56 04             	mov    %edx,0x4(%esi)
+  80460f:	8b 15 4c 10 81 00    	mov    0x81104c,%edx
+  804615:	89 56 08             	mov    %edx,0x8(%esi)
+  804618:	8b 15 50 10 81 00    	mov    0x811050,%edx
+  80461e:	89 56 0c             	mov    %edx,0xc(%esi)
+  804621:	8b 15 54 10 81 00    	mov    0x811054,%edx
+  804627:	89 56 10             	mov    %edx,0x10(%esi)
+  80462a:	8b 15 58 10 81 00    	mov    0x811058,%edx
+  804630:	89 56 14             	mov    %edx,0x14(%esi)
+  804633:	8b 15 5c 10 81 00    	mov    0x81105c,%edx
+  804639:	89 56 18             	mov    %edx,0x18(%esi)
+  80463c:	8b 15 60 10 81 00    	mov    0x811060,%edx
+  804642:	89 56 1c             	mov    %edx,0x1c(%esi)
+  804645:	8b 15 64 10 81 00    	mov    0x811064,%edx
+  80464b:	89 56 20             	mov    %edx,0x20(%esi)
+  80464e:	8b 15 68 10 81 00    	mov    0x811068,%edx
+  804654:	89 56 24             	mov    %edx,0x24(%esi)
+  804657:	8b 15 6c 10 81 00    	mov    0x81106c,%edx
+  80465d:	89 56 28             	mov    %edx,0x28(%esi)
+  804660:	8b 15 70 10 81 00    	mov    0x811070,%edx
+  804666:	89 56 2c             	mov    %edx,0x2c(%esi)
+  804669:	8b 15 74 10 81 00    	mov    0x811074,%edx
+  80466f:	89 56 30             	mov    %edx,0x30(%esi)
+  804672:	8b 15 78 10 81 00    	mov    0x811078,%edx
+  804678:	89 56 34             	mov    %edx,0x34(%esi)
+  80467b:	8b 15 7c 10 81 00    	mov    0x81107c,%edx
+  804681:	89 56 38             	mov    %edx,0x38(%esi)
+  804684:	8b 15 80 10 81 00    	mov    0x811080,%edx
+  80468a:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80468d:	8b 15 84 10 81 00    	mov    0x811084,%edx
+  804693:	89 13                	mov    %edx,(%ebx)
+  804695:	8b 15 88 10 81 00    	mov    0x811088,%edx
+  80469b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80469e:	8b 15 8c 10 81 00    	mov    0x81108c,%edx
+  8046a4:	89 53 08             	mov    %edx,0x8(%ebx)
+  8046a7:	8b 15 90 10 81 00    	mov    0x811090,%edx
+  8046ad:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8046b0:	8b 15 94 10 81 00    	mov    0x811094,%edx
+  8046b6:	89 53 10             	mov    %edx,0x10(%ebx)
+  8046b9:	8b 15 98 10 81 00    	mov    0x811098,%edx
+  8046bf:	89 53 14             	mov    %edx,0x14(%ebx)
+  8046c2:	8b 15 9c 10 81 00    	mov    0x81109c,%edx
+  8046c8:	89 53 18             	mov    %edx,0x18(%ebx)
+  8046cb:	8b 15 a0 10 81 00    	mov    0x8110a0,%edx
+  8046d1:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8046d4:	8b 15 a4 10 81 00    	mov    0x8110a4,%edx
+  8046da:	89 53 20             	mov    %edx,0x20(%ebx)
+  8046dd:	8b 15 a8 10 81 00    	mov    0x8110a8,%edx
+  8046e3:	89 53 24             	mov    %edx,0x24(%ebx)
+  8046e6:	8b 15 ac 10 81 00    	mov    0x8110ac,%edx
+  8046ec:	89 53 28             	mov    %edx,0x28(%ebx)
+  8046ef:	8b 15 b0 10 81 00    	mov    0x8110b0,%edx
+  8046f5:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8046f8:	8b 15 b4 10 81 00    	mov    0x8110b4,%edx
+  8046fe:	89 53 30             	mov    %edx,0x30(%ebx)
+  804701:	8b 15 b8 10 81 00    	mov    0x8110b8,%edx
+  804707:	89 53 34             	mov    %edx,0x34(%ebx)
+  80470a:	8b 15 bc 10 81 00    	mov    0x8110bc,%edx
+  804710:	89 53 38             	mov    %edx,0x38(%ebx)
+  804713:	8b 15 c0 10 81 00    	mov    0x8110c0,%edx
+  804719:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80471c:	83 c4 0c             	add    $0xc,%esp
+  80471f:	5b                   	pop    %ebx
+  804720:	5e                   	pop    %esi
+  804721:	5f                   	pop    %edi
+  804722:	5d                   	pop    %ebp
+  804723:	c3                   	ret
+
+00804724 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  804724:	55                   	push   %ebp
+  804725:	89 e5                	mov    %esp,%ebp
+  804727:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80472a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80472d:	a3 00 10 81 00       	mov    %eax,0x811000
+	nsipcbuf.evctl.req_events = events;
+  804732:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804735:	a3 04 10 81 00       	mov    %eax,0x811004
+	nsipcbuf.evctl.req_data = data;
+  80473a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80473d:	a3 08 10 81 00       	mov    %eax,0x811008
+	return nsipc(NSREQ_EVCTL);
+  804742:	b8 0f 00 00 00       	mov    $0xf,%eax
+  804747:	e8 46 f4 ff ff       	call   803b92 <nsipc>
+}
+  80474c:	c9                   	leave
+  80474d:	c3                   	ret
+
+0080474e <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80474e:	55                   	push   %ebp
+  80474f:	89 e5                	mov    %esp,%ebp
+  804751:	56                   	push   %esi
+  804752:	53                   	push   %ebx
+  804753:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  804756:	89 35 00 10 81 00    	mov    %esi,0x811000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80475c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80475f:	a3 04 10 81 00       	mov    %eax,0x811004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  804764:	b8 10 00 00 00       	mov    $0x10,%eax
+  804769:	e8 24 f4 ff ff       	call   803b92 <nsipc>
+  80476e:	89 c3                	mov    %eax,%ebx
+  804770:	85 c0                	test   %eax,%eax
+  804772:	7e 1f                	jle    804793 <nsipc_evwait+0x45>
+		assert(r <= max);
+  804774:	39 c6                	cmp    %eax,%esi
+  804776:	7c 24                	jl     80479c <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  804778:	83 ec 04             	sub    $0x4,%esp
+  80477b:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  804782:	50                   	push   %eax
+  804783:	68 00 10 81 00       	push   $0x811000
+  804788:	ff 75 08             	push   0x8(%ebp)
+  80478b:	e8 1f d7 ff ff       	call   801eaf <memmove>
+  804790:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  804793:	89 d8                	mov    %ebx,%eax
+  804795:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804798:	5b                   	pop    %ebx
+  804799:	5e                   	pop    %esi
+  80479a:	5d                   	pop    %ebp
+  80479b:	c3                   	ret
+		assert(r <= max);
+  80479c:	68 ae 70 80 00       	push   $0x8070ae
+  8047a1:	68 81 70 80 00       	push   $0x807081
+  8047a6:	68 6a 01 00 00       	push   $0x16a
+  8047ab:	68 96 70 80 00       	push   $0x807096
+  8047b0:	e8 78 cd ff ff       	call   80152d <_panic>
+
+008047b5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8047b5:	55                   	push   %ebp
+  8047b6:	89 e5                	mov    %esp,%ebp
+  8047b8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8047bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047be:	a3 00 10 81 00       	mov    %eax,0x811000
+	nsipcbuf.socket.req_type = type;
+  8047c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8047c6:	a3 04 10 81 00       	mov    %eax,0x811004
+	nsipcbuf.socket.req_protocol = protocol;
+  8047cb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8047ce:	a3 08 10 81 00       	mov    %eax,0x811008
+	return nsipc(NSREQ_SOCKET);
+  8047d3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8047d8:	e8 b5 f3 ff ff       	call   803b92 <nsipc>
+}
+  8047dd:	c9                   	leave
+  8047de:	c3                   	ret
+
+008047df <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8047df:	55                   	push   %ebp
+  8047e0:	89 e5                	mov    %esp,%ebp
+  8047e2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8047e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047e8:	a3 00 10 81 00       	mov    %eax,0x811000
+	return nsipc(NSREQ_OFFLOAD);
+  8047ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8047f2:	e8 9b f3 ff ff       	call   803b92 <nsipc>
+}
+  8047f7:	c9                   	leave
+  8047f8:	c3                   	ret
+
+008047f9 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8047f9:	55                   	push   %ebp
+  8047fa:	89 e5                	mov    %esp,%ebp
+  8047fc:	53                   	push   %ebx
+  8047fd:	83 ec 04             	sub    $0x4,%esp
+  804800:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  804803:	b8 12 00 00 00       	mov    $0x12,%eax
+  804808:	e8 85 f3 ff ff       	call   803b92 <nsipc>
+  80480d:	85 c0                	test   %eax,%eax
+  80480f:	78 50                	js     804861 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  804811:	8b 15 00 10 81 00    	mov    0x811000,%edx
+  804817:	89 13                	mov    %edx,(%ebx)
+  804819:	8b 15 04 10 81 00    	mov    0x811004,%edx
+  80481f:	89 53 04             	mov    %edx,0x4(%ebx)
+  804822:	8b 15 08 10 81 00    	mov    0x811008,%edx
+  804828:	89 53 08             	mov    %edx,0x8(%ebx)
+  80482b:	8b 15 0c 10 81 00    	mov    0x81100c,%edx
+  804831:	89 53 0c             	mov    %edx,0xc(%ebx)
+  804834:	8b 15 10 10 81 00    	mov    0x811010,%edx
+  80483a:	89 53 10             	mov    %edx,0x10(%ebx)
+  80483d:	8b 15 14 10 81 00    	mov    0x811014,%edx
+  804843:	89 53 14             	mov    %edx,0x14(%ebx)
+  804846:	8b 15 18 10 81 00    	mov    0x811018,%edx
+  80484c:	89 53 18             	mov    %edx,0x18(%ebx)
+  80484f:	8b 15 1c 10 81 00    	mov    0x81101c,%edx
+  804855:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  804858:	8b 15 20 10 81 00    	mov    0x811020,%edx
+  80485e:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  804861:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804864:	c9                   	leave
+  804865:	c3                   	ret
+
+00804866 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  804866:	55                   	push   %ebp
+  804867:	89 e5                	mov    %esp,%ebp
+  804869:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80486c:	6a 03                	push   $0x3
+  80486e:	e8 59 1a 00 00       	call   8062cc <ipc_find_env>
+  804873:	a3 64 f3 80 00       	mov    %eax,0x80f364
+	nsipcbuf.shard.req_shard = shard;
+  804878:	8b 45 08             	mov    0x8(%ebp),%eax
+  80487b:	a3 00 10 81 00       	mov    %eax,0x811000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  804880:	b8 0b 00 00 00       	mov    $0xb,%eax
+  804885:	e8 08 f3 ff ff       	call   803b92 <nsipc>
+  80488a:	83 c4 10             	add    $0x10,%esp
+  80488d:	85 c0                	test   %eax,%eax
+  80488f:	78 0a                	js     80489b <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  804891:	a3 64 f3 80 00       	mov    %eax,0x80f364
+	return 0;
+  804896:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80489b:	c9                   	leave
+  80489c:	c3                   	ret
+
+0080489d <list_remove>:
+}
+
+static void
+list_remove(struct mspan **head, struct mspan *mp)
+{
+	if (mp->mp_prev)
+  80489d:	8b 4a 14             	mov    0x14(%edx),%ecx
+  8048a0:	85 c9                	test   %ecx,%ecx
+  8048a2:	74 14                	je     8048b8 <list_remove+0x1b>
+		mp->mp_prev->mp_next = mp->mp_next;
+  8048a4:	8b 42 10             	mov    0x10(%edx),%eax
+  8048a7:	89 41 10             	mov    %eax,0x10(%ecx)
+	else
+		*head = mp->mp_next;
+	if (mp->mp_next)
+  8048aa:	8b 42 10             	mov    0x10(%edx),%eax
+  8048ad:	85 c0                	test   %eax,%eax
+  8048af:	74 06                	je     8048b7 <list_remove+0x1a>
+		mp->mp_next->mp_prev = mp->mp_prev;
+  8048b1:	8b 52 14             	mov    0x14(%edx),%edx
+  8048b4:	89 50 14             	mov    %edx,0x14(%eax)
+}
+  8048b7:	c3                   	ret
+		*head = mp->mp_next;
+  8048b8:	8b 4a 10             	mov    0x10(%edx),%ecx
+  8048bb:	89 08                	mov    %ecx,(%eax)
+  8048bd:	eb eb                	jmp    8048aa <list_remove+0xd>
+
+008048bf <span_set>:
+}
+
+// Make 'mp' a span of 'npages', and tell the span above.
+static void
+span_set(struct mspan *mp, int npages, int kind)
+{
+  8048bf:	55                   	push   %ebp
+  8048c0:	89 e5                	mov    %esp,%ebp
+  8048c2:	53                   	push   %ebx
+  8048c3:	89 d3                	mov    %edx,%ebx
+	struct mspan *next;
+
+	mp->mp_magic = MSPAN_MAGIC;
+  8048c5:	c7 00 4e 50 53 4d    	movl   $0x4d53504e,(%eax)
+	mp->mp_npages = npages;
+  8048cb:	66 89 50 04          	mov    %dx,0x4(%eax)
+	mp->mp_kind = kind;
+  8048cf:	88 48 08             	mov    %cl,0x8(%eax)
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  8048d2:	0f b7 d2             	movzwl %dx,%edx
+  8048d5:	c1 e2 0c             	shl    $0xc,%edx
+  8048d8:	01 c2                	add    %eax,%edx
+	return next < mtop ? (struct mspan *) next : NULL;
+  8048da:	3b 15 64 f8 80 00    	cmp    0x80f864,%edx
+  8048e0:	73 09                	jae    8048eb <span_set+0x2c>
+	if ((next = span_next(mp)))
+		next->mp_prevpages = npages;
+  8048e2:	66 89 5a 06          	mov    %bx,0x6(%edx)
+	else
+		mlast = mp;
+}
+  8048e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8048e9:	c9                   	leave
+  8048ea:	c3                   	ret
+		mlast = mp;
+  8048eb:	a3 60 f8 80 00       	mov    %eax,0x80f860
+  8048f0:	eb f4                	jmp    8048e6 <span_set+0x27>
+
+008048f2 <mlock_acquire>:
+}
+
+static void
+mlock_acquire(void)
+{
+	if (sforked)
+  8048f2:	83 3d 00 f9 80 00 00 	cmpl   $0x0,0x80f900
+  8048f9:	75 01                	jne    8048fc <mlock_acquire+0xa>
+  8048fb:	c3                   	ret
+{
+  8048fc:	55                   	push   %ebp
+  8048fd:	89 e5                	mov    %esp,%ebp
+  8048ff:	83 ec 14             	sub    $0x14,%esp
+		mutex_lock(&mlock);
+  804902:	68 80 f3 80 00       	push   $0x80f380
+  804907:	e8 17 13 00 00       	call   805c23 <mutex_lock>
+  80490c:	83 c4 10             	add    $0x10,%esp
+}
+  80490f:	c9                   	leave
+  804910:	c3                   	ret
+
+00804911 <mlock_release>:
+
+static void
+mlock_release(void)
+{
+	if (sforked)
+  804911:	83 3d 00 f9 80 00 00 	cmpl   $0x0,0x80f900
+  804918:	75 01                	jne    80491b <mlock_release+0xa>
+  80491a:	c3                   	ret
+{
+  80491b:	55                   	push   %ebp
+  80491c:	89 e5                	mov    %esp,%ebp
+  80491e:	83 ec 14             	sub    $0x14,%esp
+		mutex_unlock(&mlock);
+  804921:	68 80 f3 80 00       	push   $0x80f380
+  804926:	e8 66 13 00 00       	call   805c91 <mutex_unlock>
+  80492b:	83 c4 10             	add    $0x10,%esp
+}
+  80492e:	c9                   	leave
+  80492f:	c3                   	ret
+
+00804930 <span_of>:
+{
+  804930:	55                   	push   %ebp
+  804931:	89 e5                	mov    %esp,%ebp
+  804933:	83 ec 08             	sub    $0x8,%esp
+	struct mspan *mp = ROUNDDOWN(v, PGSIZE);
+  804936:	89 c2                	mov    %eax,%edx
+  804938:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mtop);
+  80493e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  804943:	76 1a                	jbe    80495f <span_of+0x2f>
+  804945:	3b 05 64 f8 80 00    	cmp    0x80f864,%eax
+  80494b:	73 12                	jae    80495f <span_of+0x2f>
+	assert(mp->mp_magic == MSPAN_MAGIC && mp->mp_kind != MS_FREE);
+  80494d:	81 3a 4e 50 53 4d    	cmpl   $0x4d53504e,(%edx)
+  804953:	75 23                	jne    804978 <span_of+0x48>
+  804955:	80 7a 08 00          	cmpb   $0x0,0x8(%edx)
+  804959:	74 1d                	je     804978 <span_of+0x48>
+}
+  80495b:	89 d0                	mov    %edx,%eax
+  80495d:	c9                   	leave
+  80495e:	c3                   	ret
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mtop);
+  80495f:	68 b8 70 80 00       	push   $0x8070b8
+  804964:	68 81 70 80 00       	push   $0x807081
+  804969:	68 4f 01 00 00       	push   $0x14f
+  80496e:	68 1e 71 80 00       	push   $0x80711e
+  804973:	e8 b5 cb ff ff       	call   80152d <_panic>
+	assert(mp->mp_magic == MSPAN_MAGIC && mp->mp_kind != MS_FREE);
+  804978:	68 e8 70 80 00       	push   $0x8070e8
+  80497d:	68 81 70 80 00       	push   $0x807081
+  804982:	68 50 01 00 00       	push   $0x150
+  804987:	68 1e 71 80 00       	push   $0x80711e
+  80498c:	e8 9c cb ff ff       	call   80152d <_panic>
+
+00804991 <span_merge>:
+{
+  804991:	55                   	push   %ebp
+  804992:	89 e5                	mov    %esp,%ebp
+  804994:	56                   	push   %esi
+  804995:	53                   	push   %ebx
+  804996:	89 c3                	mov    %eax,%ebx
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  804998:	0f b7 70 04          	movzwl 0x4(%eax),%esi
+  80499c:	c1 e6 0c             	shl    $0xc,%esi
+  80499f:	01 c6                	add    %eax,%esi
+	return next < mtop ? (struct mspan *) next : NULL;
+  8049a1:	3b 35 64 f8 80 00    	cmp    0x80f864,%esi
+  8049a7:	73 06                	jae    8049af <span_merge+0x1e>
+	if ((other = span_next(mp)) && other->mp_kind == MS_FREE) {
+  8049a9:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+  8049ad:	74 23                	je     8049d2 <span_merge+0x41>
+	if (mp->mp_prevpages == 0)
+  8049af:	0f b7 43 06          	movzwl 0x6(%ebx),%eax
+  8049b3:	66 85 c0             	test   %ax,%ax
+  8049b6:	74 10                	je     8049c8 <span_merge+0x37>
+	return (struct mspan *) ((uint8_t *) mp - mp->mp_prevpages * PGSIZE);
+  8049b8:	0f b7 c0             	movzwl %ax,%eax
+  8049bb:	c1 e0 0c             	shl    $0xc,%eax
+  8049be:	89 de                	mov    %ebx,%esi
+  8049c0:	29 c6                	sub    %eax,%esi
+	if ((other = span_prev(mp)) && other->mp_kind == MS_FREE) {
+  8049c2:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+  8049c6:	74 3e                	je     804a06 <span_merge+0x75>
+	mp->mp_kind = MS_FREE;
+  8049c8:	c6 43 08 00          	movb   $0x0,0x8(%ebx)
+}
+  8049cc:	89 d8                	mov    %ebx,%eax
+  8049ce:	5b                   	pop    %ebx
+  8049cf:	5e                   	pop    %esi
+  8049d0:	5d                   	pop    %ebp
+  8049d1:	c3                   	ret
+		list_remove(bin_of(other->mp_npages), other);
+  8049d2:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  8049d6:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  8049db:	39 d0                	cmp    %edx,%eax
+  8049dd:	0f 4f c2             	cmovg  %edx,%eax
+  8049e0:	8d 04 85 e0 f7 80 00 	lea    0x80f7e0(,%eax,4),%eax
+		list_remove(bin_of(other->mp_npages), other);
+  8049e7:	89 f2                	mov    %esi,%edx
+  8049e9:	e8 af fe ff ff       	call   80489d <list_remove>
+		span_set(mp, mp->mp_npages + other->mp_npages, MS_FREE);
+  8049ee:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  8049f2:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  8049f6:	01 c2                	add    %eax,%edx
+  8049f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8049fd:	89 d8                	mov    %ebx,%eax
+  8049ff:	e8 bb fe ff ff       	call   8048bf <span_set>
+  804a04:	eb a9                	jmp    8049af <span_merge+0x1e>
+		list_remove(bin_of(other->mp_npages), other);
+  804a06:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  804a0a:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  804a0f:	39 d0                	cmp    %edx,%eax
+  804a11:	0f 4f c2             	cmovg  %edx,%eax
+  804a14:	8d 04 85 e0 f7 80 00 	lea    0x80f7e0(,%eax,4),%eax
+		list_remove(bin_of(other->mp_npages), other);
+  804a1b:	89 f2                	mov    %esi,%edx
+  804a1d:	e8 7b fe ff ff       	call   80489d <list_remove>
+		span_set(other, other->mp_npages + mp->mp_npages, MS_FREE);
+  804a22:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  804a26:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  804a2a:	01 c2                	add    %eax,%edx
+  804a2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a31:	89 f0                	mov    %esi,%eax
+  804a33:	e8 87 fe ff ff       	call   8048bf <span_set>
+	return (struct mspan *) ((uint8_t *) mp - mp->mp_prevpages * PGSIZE);
+  804a38:	89 f3                	mov    %esi,%ebx
+  804a3a:	eb 8c                	jmp    8049c8 <span_merge+0x37>
+
+00804a3c <span_free>:
+{
+  804a3c:	55                   	push   %ebp
+  804a3d:	89 e5                	mov    %esp,%ebp
+  804a3f:	56                   	push   %esi
+  804a40:	53                   	push   %ebx
+	mp = span_merge(mp);
+  804a41:	e8 4b ff ff ff       	call   804991 <span_merge>
+  804a46:	89 c3                	mov    %eax,%ebx
+	if (mp == mlast && mp->mp_npages >= MTRIM) {
+  804a48:	39 05 60 f8 80 00    	cmp    %eax,0x80f860
+  804a4e:	74 34                	je     804a84 <span_free+0x48>
+	list_push(bin_of(mp->mp_npages), mp);
+  804a50:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  804a54:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  804a59:	39 d0                	cmp    %edx,%eax
+  804a5b:	0f 4f c2             	cmovg  %edx,%eax
+	mp->mp_prev = NULL;
+  804a5e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	mp->mp_next = *head;
+  804a65:	8b 14 85 e0 f7 80 00 	mov    0x80f7e0(,%eax,4),%edx
+  804a6c:	89 53 10             	mov    %edx,0x10(%ebx)
+	if (*head)
+  804a6f:	85 d2                	test   %edx,%edx
+  804a71:	74 03                	je     804a76 <span_free+0x3a>
+		(*head)->mp_prev = mp;
+  804a73:	89 5a 14             	mov    %ebx,0x14(%edx)
+	*head = mp;
+  804a76:	89 1c 85 e0 f7 80 00 	mov    %ebx,0x80f7e0(,%eax,4)
+}
+  804a7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804a80:	5b                   	pop    %ebx
+  804a81:	5e                   	pop    %esi
+  804a82:	5d                   	pop    %ebp
+  804a83:	c3                   	ret
+	if (mp == mlast && mp->mp_npages >= MTRIM) {
+  804a84:	66 83 78 04 1f       	cmpw   $0x1f,0x4(%eax)
+  804a89:	76 c5                	jbe    804a50 <span_free+0x14>
+		pgbatch_init(&mbatch);
+  804a8b:	83 ec 0c             	sub    $0xc,%esp
+  804a8e:	68 a0 f3 80 00       	push   $0x80f3a0
+  804a93:	e8 d7 0f 00 00       	call   805a6f <pgbatch_init>
+		for (i = MGROW; i < mp->mp_npages; i++)
+  804a98:	83 c4 10             	add    $0x10,%esp
+  804a9b:	66 83 7b 04 10       	cmpw   $0x10,0x4(%ebx)
+  804aa0:	76 2a                	jbe    804acc <span_free+0x90>
+  804aa2:	be 10 00 00 00       	mov    $0x10,%esi
+			pgbatch_unmap(&mbatch, 0, (uint8_t *) mp + i * PGSIZE);
+  804aa7:	83 ec 04             	sub    $0x4,%esp
+  804aaa:	89 f0                	mov    %esi,%eax
+  804aac:	c1 e0 0c             	shl    $0xc,%eax
+  804aaf:	01 d8                	add    %ebx,%eax
+  804ab1:	50                   	push   %eax
+  804ab2:	6a 00                	push   $0x0
+  804ab4:	68 a0 f3 80 00       	push   $0x80f3a0
+  804ab9:	e8 b2 10 00 00       	call   805b70 <pgbatch_unmap>
+		for (i = MGROW; i < mp->mp_npages; i++)
+  804abe:	83 c6 01             	add    $0x1,%esi
+  804ac1:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  804ac5:	83 c4 10             	add    $0x10,%esp
+  804ac8:	39 f0                	cmp    %esi,%eax
+  804aca:	7f db                	jg     804aa7 <span_free+0x6b>
+		pgbatch_flush(&mbatch);
+  804acc:	83 ec 0c             	sub    $0xc,%esp
+  804acf:	68 a0 f3 80 00       	push   $0x80f3a0
+  804ad4:	e8 a4 0f 00 00       	call   805a7d <pgbatch_flush>
+		mstat.ms_arena -= (mp->mp_npages - MGROW) * PGSIZE;
+  804ad9:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  804add:	83 e8 10             	sub    $0x10,%eax
+  804ae0:	c1 e0 0c             	shl    $0xc,%eax
+  804ae3:	29 05 c0 f6 80 00    	sub    %eax,0x80f6c0
+		mtop = (uint8_t *) mp + MGROW * PGSIZE;
+  804ae9:	8d 83 00 00 01 00    	lea    0x10000(%ebx),%eax
+  804aef:	a3 64 f8 80 00       	mov    %eax,0x80f864
+		mp->mp_npages = MGROW;
+  804af4:	66 c7 43 04 10 00    	movw   $0x10,0x4(%ebx)
+  804afa:	83 c4 10             	add    $0x10,%esp
+  804afd:	e9 4e ff ff ff       	jmp    804a50 <span_free+0x14>
+
+00804b02 <slab_free>:
+{
+  804b02:	55                   	push   %ebp
+  804b03:	89 e5                	mov    %esp,%ebp
+  804b05:	57                   	push   %edi
+  804b06:	56                   	push   %esi
+  804b07:	53                   	push   %ebx
+  804b08:	83 ec 0c             	sub    $0xc,%esp
+  804b0b:	89 c3                	mov    %eax,%ebx
+	int c = mp->mp_class;
+  804b0d:	0f b6 48 09          	movzbl 0x9(%eax),%ecx
+  804b11:	0f b6 f9             	movzbl %cl,%edi
+	*(void **) v = mp->mp_free;
+  804b14:	8b 40 0c             	mov    0xc(%eax),%eax
+  804b17:	89 02                	mov    %eax,(%edx)
+	mp->mp_free = v;
+  804b19:	89 53 0c             	mov    %edx,0xc(%ebx)
+	mstat.ms_inuse -= mclass_size[c];
+  804b1c:	0f b7 b4 3f 40 71 80 	movzwl 0x807140(%edi,%edi,1),%esi
+  804b23:	00 
+  804b24:	0f b7 c6             	movzwl %si,%eax
+  804b27:	29 05 c4 f6 80 00    	sub    %eax,0x80f6c4
+	if (mp->mp_nfree++ == 0)
+  804b2d:	0f b7 43 0a          	movzwl 0xa(%ebx),%eax
+  804b31:	8d 50 01             	lea    0x1(%eax),%edx
+  804b34:	66 89 53 0a          	mov    %dx,0xa(%ebx)
+  804b38:	66 85 c0             	test   %ax,%ax
+  804b3b:	74 1b                	je     804b58 <slab_free+0x56>
+	if (mp->mp_nfree == (PGSIZE - MHDR) / mclass_size[c]
+  804b3d:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+  804b42:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b47:	66 f7 f6             	div    %si
+  804b4a:	66 39 43 0a          	cmp    %ax,0xa(%ebx)
+  804b4e:	74 29                	je     804b79 <slab_free+0x77>
+}
+  804b50:	83 c4 0c             	add    $0xc,%esp
+  804b53:	5b                   	pop    %ebx
+  804b54:	5e                   	pop    %esi
+  804b55:	5f                   	pop    %edi
+  804b56:	5d                   	pop    %ebp
+  804b57:	c3                   	ret
+	mp->mp_prev = NULL;
+  804b58:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	mp->mp_next = *head;
+  804b5f:	8b 04 bd 80 f7 80 00 	mov    0x80f780(,%edi,4),%eax
+  804b66:	89 43 10             	mov    %eax,0x10(%ebx)
+	if (*head)
+  804b69:	85 c0                	test   %eax,%eax
+  804b6b:	74 03                	je     804b70 <slab_free+0x6e>
+		(*head)->mp_prev = mp;
+  804b6d:	89 58 14             	mov    %ebx,0x14(%eax)
+	*head = mp;
+  804b70:	89 1c bd 80 f7 80 00 	mov    %ebx,0x80f780(,%edi,4)
+}
+  804b77:	eb c4                	jmp    804b3d <slab_free+0x3b>
+	    && (mp->mp_prev || mp->mp_next)) {
+  804b79:	83 7b 14 00          	cmpl   $0x0,0x14(%ebx)
+  804b7d:	74 21                	je     804ba0 <slab_free+0x9e>
+		list_remove(&mslabs[c], mp);
+  804b7f:	0f b6 c9             	movzbl %cl,%ecx
+  804b82:	8d 04 8d 80 f7 80 00 	lea    0x80f780(,%ecx,4),%eax
+  804b89:	89 da                	mov    %ebx,%edx
+  804b8b:	e8 0d fd ff ff       	call   80489d <list_remove>
+		mstat.ms_slabs--;
+  804b90:	83 2d c8 f6 80 00 01 	subl   $0x1,0x80f6c8
+		span_free(mp);
+  804b97:	89 d8                	mov    %ebx,%eax
+  804b99:	e8 9e fe ff ff       	call   804a3c <span_free>
+}
+  804b9e:	eb b0                	jmp    804b50 <slab_free+0x4e>
+	    && (mp->mp_prev || mp->mp_next)) {
+  804ba0:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+  804ba4:	75 d9                	jne    804b7f <slab_free+0x7d>
+  804ba6:	eb a8                	jmp    804b50 <slab_free+0x4e>
+
+00804ba8 <free_locked>:
+	if (v == 0)
+  804ba8:	85 c0                	test   %eax,%eax
+  804baa:	74 71                	je     804c1d <free_locked+0x75>
+{
+  804bac:	55                   	push   %ebp
+  804bad:	89 e5                	mov    %esp,%ebp
+  804baf:	56                   	push   %esi
+  804bb0:	53                   	push   %ebx
+  804bb1:	89 c3                	mov    %eax,%ebx
+	struct mcache *mc = mcache_cur;
+  804bb3:	8b 35 00 20 81 00    	mov    0x812000,%esi
+	mp = span_of(v);
+  804bb9:	e8 72 fd ff ff       	call   804930 <span_of>
+	if (mp->mp_kind == MS_SLAB) {
+  804bbe:	80 78 08 02          	cmpb   $0x2,0x8(%eax)
+  804bc2:	75 41                	jne    804c05 <free_locked+0x5d>
+		c = mp->mp_class;
+  804bc4:	0f b6 50 09          	movzbl 0x9(%eax),%edx
+		if (mc && mc->mc_n[c] < mcache_max[c]) {
+  804bc8:	85 f6                	test   %esi,%esi
+  804bca:	74 30                	je     804bfc <free_locked+0x54>
+  804bcc:	0f b6 8a e0 f6 80 00 	movzbl 0x80f6e0(%edx),%ecx
+  804bd3:	38 4c 16 58          	cmp    %cl,0x58(%esi,%edx,1)
+  804bd7:	73 23                	jae    804bfc <free_locked+0x54>
+			*(void **) v = mc->mc_free[c];
+  804bd9:	8b 04 96             	mov    (%esi,%edx,4),%eax
+  804bdc:	89 03                	mov    %eax,(%ebx)
+			mc->mc_free[c] = v;
+  804bde:	89 1c 96             	mov    %ebx,(%esi,%edx,4)
+			mc->mc_n[c]++;
+  804be1:	80 44 16 58 01       	addb   $0x1,0x58(%esi,%edx,1)
+			mstat.ms_cached += mclass_size[c];
+  804be6:	0f b7 84 12 40 71 80 	movzwl 0x807140(%edx,%edx,1),%eax
+  804bed:	00 
+  804bee:	01 05 d4 f6 80 00    	add    %eax,0x80f6d4
+			mstat.ms_inuse -= mclass_size[c];
+  804bf4:	29 05 c4 f6 80 00    	sub    %eax,0x80f6c4
+			return;
+  804bfa:	eb 1d                	jmp    804c19 <free_locked+0x71>
+		slab_free(mp, v);
+  804bfc:	89 da                	mov    %ebx,%edx
+  804bfe:	e8 ff fe ff ff       	call   804b02 <slab_free>
+		return;
+  804c03:	eb 14                	jmp    804c19 <free_locked+0x71>
+	mstat.ms_inuse -= mp->mp_size;
+  804c05:	8b 15 c4 f6 80 00    	mov    0x80f6c4,%edx
+  804c0b:	2b 50 18             	sub    0x18(%eax),%edx
+  804c0e:	89 15 c4 f6 80 00    	mov    %edx,0x80f6c4
+	span_free(mp);
+  804c14:	e8 23 fe ff ff       	call   804a3c <span_free>
+}
+  804c19:	5b                   	pop    %ebx
+  804c1a:	5e                   	pop    %esi
+  804c1b:	5d                   	pop    %ebp
+  804c1c:	c3                   	ret
+  804c1d:	c3                   	ret
+
+00804c1e <span_alloc>:
+{
+  804c1e:	55                   	push   %ebp
+  804c1f:	89 e5                	mov    %esp,%ebp
+  804c21:	57                   	push   %edi
+  804c22:	56                   	push   %esi
+  804c23:	53                   	push   %ebx
+  804c24:	83 ec 1c             	sub    $0x1c,%esp
+  804c27:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	if (npages > 0xFFFF)
+  804c2a:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804c2f:	0f 8f 08 02 00 00    	jg     804e3d <span_alloc+0x21f>
+  804c35:	89 c6                	mov    %eax,%esi
+	npages = ROUNDUP(MAX(npages, MGROW), MGROW);
+  804c37:	b8 10 00 00 00       	mov    $0x10,%eax
+  804c3c:	39 c6                	cmp    %eax,%esi
+  804c3e:	0f 4d c6             	cmovge %esi,%eax
+  804c41:	89 c7                	mov    %eax,%edi
+  804c43:	83 c7 0f             	add    $0xf,%edi
+  804c46:	83 e7 f0             	and    $0xfffffff0,%edi
+	if (npages > 0xFFFF || !isfree(mtop, npages * PGSIZE))
+  804c49:	89 f8                	mov    %edi,%eax
+  804c4b:	c1 e0 0c             	shl    $0xc,%eax
+  804c4e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804c51:	e9 30 01 00 00       	jmp    804d86 <span_alloc+0x168>
+		for (b = MIN(npages, MBINS - 1); b < MBINS && !mp; b++)
+  804c56:	83 c2 01             	add    $0x1,%edx
+  804c59:	83 fa 20             	cmp    $0x20,%edx
+  804c5c:	0f 84 e2 01 00 00    	je     804e44 <span_alloc+0x226>
+			for (mp = mbins[b]; mp; mp = mp->mp_next)
+  804c62:	8b 1c 95 e0 f7 80 00 	mov    0x80f7e0(,%edx,4),%ebx
+  804c69:	85 db                	test   %ebx,%ebx
+  804c6b:	74 e9                	je     804c56 <span_alloc+0x38>
+				if (mp->mp_npages >= npages)
+  804c6d:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  804c71:	39 f0                	cmp    %esi,%eax
+  804c73:	0f 8d f5 01 00 00    	jge    804e6e <span_alloc+0x250>
+			for (mp = mbins[b]; mp; mp = mp->mp_next)
+  804c79:	8b 5b 10             	mov    0x10(%ebx),%ebx
+  804c7c:	85 db                	test   %ebx,%ebx
+  804c7e:	75 ed                	jne    804c6d <span_alloc+0x4f>
+  804c80:	eb d4                	jmp    804c56 <span_alloc+0x38>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  804c82:	05 00 10 00 00       	add    $0x1000,%eax
+  804c87:	39 c8                	cmp    %ecx,%eax
+  804c89:	73 32                	jae    804cbd <span_alloc+0x9f>
+		if (va >= (uintptr_t) mend
+  804c8b:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  804c90:	0f 87 51 01 00 00    	ja     804de7 <span_alloc+0x1c9>
+		    || ((vpd[PDX(va)] & PTE_P) && (vpt[PGNUM(va)] & PTE_P)))
+  804c96:	89 c2                	mov    %eax,%edx
+  804c98:	c1 ea 16             	shr    $0x16,%edx
+  804c9b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  804ca2:	f6 c2 01             	test   $0x1,%dl
+  804ca5:	74 db                	je     804c82 <span_alloc+0x64>
+  804ca7:	89 c2                	mov    %eax,%edx
+  804ca9:	c1 ea 0c             	shr    $0xc,%edx
+  804cac:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  804cb3:	f6 c2 01             	test   $0x1,%dl
+  804cb6:	74 ca                	je     804c82 <span_alloc+0x64>
+  804cb8:	e9 2a 01 00 00       	jmp    804de7 <span_alloc+0x1c9>
+	pgbatch_init(&mbatch);
+  804cbd:	83 ec 0c             	sub    $0xc,%esp
+  804cc0:	68 a0 f3 80 00       	push   $0x80f3a0
+  804cc5:	e8 a5 0d 00 00       	call   805a6f <pgbatch_init>
+  804cca:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < npages; i++)
+  804ccd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = pgbatch_alloc(&mbatch, 0, mtop + i * PGSIZE,
+  804cd2:	6a 07                	push   $0x7
+  804cd4:	89 d8                	mov    %ebx,%eax
+  804cd6:	c1 e0 0c             	shl    $0xc,%eax
+  804cd9:	03 05 64 f8 80 00    	add    0x80f864,%eax
+  804cdf:	50                   	push   %eax
+  804ce0:	6a 00                	push   $0x0
+  804ce2:	68 a0 f3 80 00       	push   $0x80f3a0
+  804ce7:	e8 0a 0e 00 00       	call   805af6 <pgbatch_alloc>
+  804cec:	83 c4 10             	add    $0x10,%esp
+  804cef:	85 c0                	test   %eax,%eax
+  804cf1:	0f 88 9e 00 00 00    	js     804d95 <span_alloc+0x177>
+	for (i = 0; i < npages; i++)
+  804cf7:	83 c3 01             	add    $0x1,%ebx
+  804cfa:	39 df                	cmp    %ebx,%edi
+  804cfc:	7f d4                	jg     804cd2 <span_alloc+0xb4>
+	if (i < npages || (r = pgbatch_flush(&mbatch)) < 0) {
+  804cfe:	83 ec 0c             	sub    $0xc,%esp
+  804d01:	68 a0 f3 80 00       	push   $0x80f3a0
+  804d06:	e8 72 0d 00 00       	call   805a7d <pgbatch_flush>
+  804d0b:	83 c4 10             	add    $0x10,%esp
+  804d0e:	85 c0                	test   %eax,%eax
+  804d10:	0f 88 87 00 00 00    	js     804d9d <span_alloc+0x17f>
+	mp = (struct mspan *) mtop;
+  804d16:	8b 1d 64 f8 80 00    	mov    0x80f864,%ebx
+	mp->mp_prevpages = mlast ? mlast->mp_npages : 0;
+  804d1c:	8b 15 60 f8 80 00    	mov    0x80f860,%edx
+  804d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d27:	85 d2                	test   %edx,%edx
+  804d29:	74 04                	je     804d2f <span_alloc+0x111>
+  804d2b:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+  804d2f:	66 89 43 06          	mov    %ax,0x6(%ebx)
+	mtop += npages * PGSIZE;
+  804d33:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804d36:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+  804d39:	a3 64 f8 80 00       	mov    %eax,0x80f864
+	mstat.ms_arena += npages * PGSIZE;
+  804d3e:	01 0d c0 f6 80 00    	add    %ecx,0x80f6c0
+	span_set(mp, npages, MS_FREE);
+  804d44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d49:	89 fa                	mov    %edi,%edx
+  804d4b:	89 d8                	mov    %ebx,%eax
+  804d4d:	e8 6d fb ff ff       	call   8048bf <span_set>
+	mp = span_merge(mp);
+  804d52:	89 d8                	mov    %ebx,%eax
+  804d54:	e8 38 fc ff ff       	call   804991 <span_merge>
+	list_push(bin_of(mp->mp_npages), mp);
+  804d59:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+	return &mbins[MIN(npages, MBINS - 1)];
+  804d5d:	b9 1f 00 00 00       	mov    $0x1f,%ecx
+  804d62:	39 ca                	cmp    %ecx,%edx
+  804d64:	0f 4f d1             	cmovg  %ecx,%edx
+	mp->mp_prev = NULL;
+  804d67:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+	mp->mp_next = *head;
+  804d6e:	8b 0c 95 e0 f7 80 00 	mov    0x80f7e0(,%edx,4),%ecx
+  804d75:	89 48 10             	mov    %ecx,0x10(%eax)
+	if (*head)
+  804d78:	85 c9                	test   %ecx,%ecx
+  804d7a:	74 03                	je     804d7f <span_alloc+0x161>
+		(*head)->mp_prev = mp;
+  804d7c:	89 41 14             	mov    %eax,0x14(%ecx)
+	*head = mp;
+  804d7f:	89 04 95 e0 f7 80 00 	mov    %eax,0x80f7e0(,%edx,4)
+		for (b = MIN(npages, MBINS - 1); b < MBINS && !mp; b++)
+  804d86:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  804d8b:	39 d6                	cmp    %edx,%esi
+  804d8d:	0f 4e d6             	cmovle %esi,%edx
+  804d90:	e9 cd fe ff ff       	jmp    804c62 <span_alloc+0x44>
+	if (i < npages || (r = pgbatch_flush(&mbatch)) < 0) {
+  804d95:	39 fb                	cmp    %edi,%ebx
+  804d97:	0f 8d 61 ff ff ff    	jge    804cfe <span_alloc+0xe0>
+		pgbatch_init(&mbatch);
+  804d9d:	83 ec 0c             	sub    $0xc,%esp
+  804da0:	68 a0 f3 80 00       	push   $0x80f3a0
+  804da5:	e8 c5 0c 00 00       	call   805a6f <pgbatch_init>
+  804daa:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < npages; i++)
+  804dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+			pgbatch_unmap(&mbatch, 0, mtop + i * PGSIZE);
+  804db2:	83 ec 04             	sub    $0x4,%esp
+  804db5:	89 d8                	mov    %ebx,%eax
+  804db7:	c1 e0 0c             	shl    $0xc,%eax
+  804dba:	03 05 64 f8 80 00    	add    0x80f864,%eax
+  804dc0:	50                   	push   %eax
+  804dc1:	6a 00                	push   $0x0
+  804dc3:	68 a0 f3 80 00       	push   $0x80f3a0
+  804dc8:	e8 a3 0d 00 00       	call   805b70 <pgbatch_unmap>
+		for (i = 0; i < npages; i++)
+  804dcd:	83 c3 01             	add    $0x1,%ebx
+  804dd0:	83 c4 10             	add    $0x10,%esp
+  804dd3:	39 df                	cmp    %ebx,%edi
+  804dd5:	7f db                	jg     804db2 <span_alloc+0x194>
+		pgbatch_flush(&mbatch);
+  804dd7:	83 ec 0c             	sub    $0xc,%esp
+  804dda:	68 a0 f3 80 00       	push   $0x80f3a0
+  804ddf:	e8 99 0c 00 00       	call   805a7d <pgbatch_flush>
+		return r < 0 ? r : -E_NO_MEM;
+  804de4:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  804de7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804dec:	e9 b1 00 00 00       	jmp    804ea2 <span_alloc+0x284>
+		rest = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+  804df1:	89 f7                	mov    %esi,%edi
+  804df3:	c1 e7 0c             	shl    $0xc,%edi
+  804df6:	01 df                	add    %ebx,%edi
+		rest->mp_prevpages = npages;
+  804df8:	66 89 77 06          	mov    %si,0x6(%edi)
+		span_set(rest, mp->mp_npages - npages, MS_FREE);
+  804dfc:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  804e00:	29 f2                	sub    %esi,%edx
+  804e02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e07:	89 f8                	mov    %edi,%eax
+  804e09:	e8 b1 fa ff ff       	call   8048bf <span_set>
+		list_push(bin_of(rest->mp_npages), rest);
+  804e0e:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  804e12:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  804e17:	39 d0                	cmp    %edx,%eax
+  804e19:	0f 4f c2             	cmovg  %edx,%eax
+	mp->mp_prev = NULL;
+  804e1c:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+	mp->mp_next = *head;
+  804e23:	8b 14 85 e0 f7 80 00 	mov    0x80f7e0(,%eax,4),%edx
+  804e2a:	89 57 10             	mov    %edx,0x10(%edi)
+	if (*head)
+  804e2d:	85 d2                	test   %edx,%edx
+  804e2f:	74 03                	je     804e34 <span_alloc+0x216>
+		(*head)->mp_prev = mp;
+  804e31:	89 7a 14             	mov    %edi,0x14(%edx)
+	*head = mp;
+  804e34:	89 3c 85 e0 f7 80 00 	mov    %edi,0x80f7e0(,%eax,4)
+}
+  804e3b:	eb 59                	jmp    804e96 <span_alloc+0x278>
+		return NULL;
+  804e3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804e42:	eb 5e                	jmp    804ea2 <span_alloc+0x284>
+	if (npages > 0xFFFF || !isfree(mtop, npages * PGSIZE))
+  804e44:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  804e4a:	7f 9b                	jg     804de7 <span_alloc+0x1c9>
+	uintptr_t va, end_va = (uintptr_t) v + n;
+  804e4c:	a1 64 f8 80 00       	mov    0x80f864,%eax
+  804e51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804e54:	01 c1                	add    %eax,%ecx
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  804e56:	39 c8                	cmp    %ecx,%eax
+  804e58:	0f 83 5f fe ff ff    	jae    804cbd <span_alloc+0x9f>
+		if (va >= (uintptr_t) mend
+  804e5e:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  804e63:	0f 86 2d fe ff ff    	jbe    804c96 <span_alloc+0x78>
+  804e69:	e9 79 ff ff ff       	jmp    804de7 <span_alloc+0x1c9>
+	bin = bin_of(mp->mp_npages);
+  804e6e:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  804e72:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  804e77:	39 d0                	cmp    %edx,%eax
+  804e79:	0f 4f c2             	cmovg  %edx,%eax
+  804e7c:	8d 04 85 e0 f7 80 00 	lea    0x80f7e0(,%eax,4),%eax
+	list_remove(bin, mp);
+  804e83:	89 da                	mov    %ebx,%edx
+  804e85:	e8 13 fa ff ff       	call   80489d <list_remove>
+	if (mp->mp_npages > npages) {
+  804e8a:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  804e8e:	39 f0                	cmp    %esi,%eax
+  804e90:	0f 8f 5b ff ff ff    	jg     804df1 <span_alloc+0x1d3>
+	span_set(mp, npages, kind);
+  804e96:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804e99:	89 f2                	mov    %esi,%edx
+  804e9b:	89 d8                	mov    %ebx,%eax
+  804e9d:	e8 1d fa ff ff       	call   8048bf <span_set>
+}
+  804ea2:	89 d8                	mov    %ebx,%eax
+  804ea4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ea7:	5b                   	pop    %ebx
+  804ea8:	5e                   	pop    %esi
+  804ea9:	5f                   	pop    %edi
+  804eaa:	5d                   	pop    %ebp
+  804eab:	c3                   	ret
+
+00804eac <malloc_locked>:
+{
+  804eac:	55                   	push   %ebp
+  804ead:	89 e5                	mov    %esp,%ebp
+  804eaf:	57                   	push   %edi
+  804eb0:	56                   	push   %esi
+  804eb1:	53                   	push   %ebx
+  804eb2:	83 ec 1c             	sub    $0x1c,%esp
+  804eb5:	89 c7                	mov    %eax,%edi
+	struct mcache *mc = mcache_cur;
+  804eb7:	8b 35 00 20 81 00    	mov    0x812000,%esi
+	if (mtop == 0)
+  804ebd:	83 3d 64 f8 80 00 00 	cmpl   $0x0,0x80f864
+  804ec4:	74 63                	je     804f29 <malloc_locked+0x7d>
+	mstat.ms_nmalloc++;
+  804ec6:	83 05 d8 f6 80 00 01 	addl   $0x1,0x80f6d8
+	if (n <= SMALL_MAX) {
+  804ecd:	81 ff f0 07 00 00    	cmp    $0x7f0,%edi
+  804ed3:	0f 87 cb 01 00 00    	ja     8050a4 <malloc_locked+0x1f8>
+		c = mclass_of[(n + 15) / 16];
+  804ed9:	8d 47 0f             	lea    0xf(%edi),%eax
+  804edc:	c1 e8 04             	shr    $0x4,%eax
+  804edf:	0f b6 80 00 f7 80 00 	movzbl 0x80f700(%eax),%eax
+  804ee6:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  804ee9:	0f b6 f8             	movzbl %al,%edi
+		if (mc && (v = mc->mc_free[c])) {
+  804eec:	85 f6                	test   %esi,%esi
+  804eee:	0f 84 c7 00 00 00    	je     804fbb <malloc_locked+0x10f>
+  804ef4:	8b 1c be             	mov    (%esi,%edi,4),%ebx
+  804ef7:	85 db                	test   %ebx,%ebx
+  804ef9:	0f 84 bc 00 00 00    	je     804fbb <malloc_locked+0x10f>
+			mc->mc_free[c] = *(void **) v;
+  804eff:	8b 03                	mov    (%ebx),%eax
+  804f01:	89 04 be             	mov    %eax,(%esi,%edi,4)
+			mc->mc_n[c]--;
+  804f04:	80 6c 3e 58 01       	subb   $0x1,0x58(%esi,%edi,1)
+			mstat.ms_cachehits++;
+  804f09:	83 05 dc f6 80 00 01 	addl   $0x1,0x80f6dc
+			mstat.ms_cached -= mclass_size[c];
+  804f10:	0f b7 84 3f 40 71 80 	movzwl 0x807140(%edi,%edi,1),%eax
+  804f17:	00 
+  804f18:	29 05 d4 f6 80 00    	sub    %eax,0x80f6d4
+			mstat.ms_inuse += mclass_size[c];
+  804f1e:	01 05 c4 f6 80 00    	add    %eax,0x80f6c4
+			return v;
+  804f24:	e9 ad 01 00 00       	jmp    8050d6 <malloc_locked+0x22a>
+	mtop = mbegin;
+  804f29:	c7 05 64 f8 80 00 00 	movl   $0x8000000,0x80f864
+  804f30:	00 00 08 
+  804f33:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (c = 0, i = 0; i <= SMALL_MAX / 16; i++) {
+  804f38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f42:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804f45:	eb 23                	jmp    804f6a <malloc_locked+0xbe>
+			c++;
+  804f47:	83 c0 01             	add    $0x1,%eax
+		while (mclass_size[c] < i * 16)
+  804f4a:	0f b7 9c 00 40 71 80 	movzwl 0x807140(%eax,%eax,1),%ebx
+  804f51:	00 
+  804f52:	39 f3                	cmp    %esi,%ebx
+  804f54:	7c f1                	jl     804f47 <malloc_locked+0x9b>
+		mclass_of[i] = c;
+  804f56:	88 82 00 f7 80 00    	mov    %al,0x80f700(%edx)
+	for (c = 0, i = 0; i <= SMALL_MAX / 16; i++) {
+  804f5c:	83 c2 01             	add    $0x1,%edx
+  804f5f:	83 c1 10             	add    $0x10,%ecx
+  804f62:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  804f68:	74 10                	je     804f7a <malloc_locked+0xce>
+		while (mclass_size[c] < i * 16)
+  804f6a:	89 ce                	mov    %ecx,%esi
+  804f6c:	0f b7 9c 00 40 71 80 	movzwl 0x807140(%eax,%eax,1),%ebx
+  804f73:	00 
+  804f74:	39 cb                	cmp    %ecx,%ebx
+  804f76:	7c cf                	jl     804f47 <malloc_locked+0x9b>
+  804f78:	eb dc                	jmp    804f56 <malloc_locked+0xaa>
+	for (c = 0; c < NCLASS; c++)
+  804f7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		mcache_max[c] = MIN(MCACHE_MAX,
+  804f7f:	bb 00 08 00 00       	mov    $0x800,%ebx
+  804f84:	0f b7 b4 09 40 71 80 	movzwl 0x807140(%ecx,%ecx,1),%esi
+  804f8b:	00 
+  804f8c:	89 d8                	mov    %ebx,%eax
+  804f8e:	99                   	cltd
+  804f8f:	f7 fe                	idiv   %esi
+  804f91:	85 c0                	test   %eax,%eax
+  804f93:	ba 01 00 00 00       	mov    $0x1,%edx
+  804f98:	0f 4e c2             	cmovle %edx,%eax
+  804f9b:	ba 10 00 00 00       	mov    $0x10,%edx
+  804fa0:	39 d0                	cmp    %edx,%eax
+  804fa2:	0f 4f c2             	cmovg  %edx,%eax
+  804fa5:	88 81 e0 f6 80 00    	mov    %al,0x80f6e0(%ecx)
+	for (c = 0; c < NCLASS; c++)
+  804fab:	83 c1 01             	add    $0x1,%ecx
+  804fae:	83 f9 16             	cmp    $0x16,%ecx
+  804fb1:	75 d1                	jne    804f84 <malloc_locked+0xd8>
+  804fb3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804fb6:	e9 0b ff ff ff       	jmp    804ec6 <malloc_locked+0x1a>
+	int i, size = mclass_size[c];
+  804fbb:	0f b7 b4 3f 40 71 80 	movzwl 0x807140(%edi,%edi,1),%esi
+  804fc2:	00 
+	if (!(mp = mslabs[c])) {
+  804fc3:	8b 0c bd 80 f7 80 00 	mov    0x80f780(,%edi,4),%ecx
+  804fca:	85 c9                	test   %ecx,%ecx
+  804fcc:	74 2a                	je     804ff8 <malloc_locked+0x14c>
+	obj = mp->mp_free;
+  804fce:	8b 59 0c             	mov    0xc(%ecx),%ebx
+	mp->mp_free = *(void **) obj;
+  804fd1:	8b 03                	mov    (%ebx),%eax
+  804fd3:	89 41 0c             	mov    %eax,0xc(%ecx)
+	if (--mp->mp_nfree == 0)
+  804fd6:	0f b7 41 0a          	movzwl 0xa(%ecx),%eax
+  804fda:	83 e8 01             	sub    $0x1,%eax
+  804fdd:	66 89 41 0a          	mov    %ax,0xa(%ecx)
+  804fe1:	66 85 c0             	test   %ax,%ax
+  804fe4:	0f 84 a3 00 00 00    	je     80508d <malloc_locked+0x1e1>
+	mstat.ms_inuse += size;
+  804fea:	0f b7 f6             	movzwl %si,%esi
+  804fed:	01 35 c4 f6 80 00    	add    %esi,0x80f6c4
+	return obj;
+  804ff3:	e9 de 00 00 00       	jmp    8050d6 <malloc_locked+0x22a>
+		if (!(mp = span_alloc(1, MS_SLAB)))
+  804ff8:	ba 02 00 00 00       	mov    $0x2,%edx
+  804ffd:	b8 01 00 00 00       	mov    $0x1,%eax
+  805002:	e8 17 fc ff ff       	call   804c1e <span_alloc>
+  805007:	89 c1                	mov    %eax,%ecx
+  805009:	85 c0                	test   %eax,%eax
+  80500b:	0f 84 cf 00 00 00    	je     8050e0 <malloc_locked+0x234>
+		mp->mp_class = c;
+  805011:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+  805015:	88 41 09             	mov    %al,0x9(%ecx)
+		mp->mp_free = NULL;
+  805018:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+		mp->mp_nfree = 0;
+  80501f:	66 c7 41 0a 00 00    	movw   $0x0,0xa(%ecx)
+		for (i = (PGSIZE - MHDR) / size - 1; i >= 0; i--) {
+  805025:	0f b7 de             	movzwl %si,%ebx
+  805028:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+  80502d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805032:	f7 f3                	div    %ebx
+  805034:	83 e8 01             	sub    $0x1,%eax
+  805037:	89 c3                	mov    %eax,%ebx
+  805039:	78 27                	js     805062 <malloc_locked+0x1b6>
+	int i, size = mclass_size[c];
+  80503b:	0f b7 c6             	movzwl %si,%eax
+  80503e:	0f af c3             	imul   %ebx,%eax
+  805041:	8d 44 01 20          	lea    0x20(%ecx,%eax,1),%eax
+  805045:	0f b7 d6             	movzwl %si,%edx
+  805048:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			*(void **) obj = mp->mp_free;
+  80504b:	8b 51 0c             	mov    0xc(%ecx),%edx
+  80504e:	89 10                	mov    %edx,(%eax)
+			mp->mp_free = obj;
+  805050:	89 41 0c             	mov    %eax,0xc(%ecx)
+			mp->mp_nfree++;
+  805053:	66 83 41 0a 01       	addw   $0x1,0xa(%ecx)
+		for (i = (PGSIZE - MHDR) / size - 1; i >= 0; i--) {
+  805058:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80505b:	29 d0                	sub    %edx,%eax
+  80505d:	83 eb 01             	sub    $0x1,%ebx
+  805060:	79 e9                	jns    80504b <malloc_locked+0x19f>
+	mp->mp_prev = NULL;
+  805062:	c7 41 14 00 00 00 00 	movl   $0x0,0x14(%ecx)
+	mp->mp_next = *head;
+  805069:	8b 04 bd 80 f7 80 00 	mov    0x80f780(,%edi,4),%eax
+  805070:	89 41 10             	mov    %eax,0x10(%ecx)
+	if (*head)
+  805073:	85 c0                	test   %eax,%eax
+  805075:	74 03                	je     80507a <malloc_locked+0x1ce>
+		(*head)->mp_prev = mp;
+  805077:	89 48 14             	mov    %ecx,0x14(%eax)
+	*head = mp;
+  80507a:	89 0c bd 80 f7 80 00 	mov    %ecx,0x80f780(,%edi,4)
+		mstat.ms_slabs++;
+  805081:	83 05 c8 f6 80 00 01 	addl   $0x1,0x80f6c8
+  805088:	e9 41 ff ff ff       	jmp    804fce <malloc_locked+0x122>
+		list_remove(&mslabs[c], mp);
+  80508d:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+  805091:	8d 04 85 80 f7 80 00 	lea    0x80f780(,%eax,4),%eax
+  805098:	89 ca                	mov    %ecx,%edx
+  80509a:	e8 fe f7 ff ff       	call   80489d <list_remove>
+  80509f:	e9 46 ff ff ff       	jmp    804fea <malloc_locked+0x13e>
+		return 0;
+  8050a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (n > (size_t) (mend - mbegin))
+  8050a9:	81 ff 00 00 00 08    	cmp    $0x8000000,%edi
+  8050af:	77 25                	ja     8050d6 <malloc_locked+0x22a>
+	if (!(mp = span_alloc(ROUNDUP(n + MHDR, PGSIZE) / PGSIZE, MS_LARGE)))
+  8050b1:	8d 87 1f 10 00 00    	lea    0x101f(%edi),%eax
+  8050b7:	c1 e8 0c             	shr    $0xc,%eax
+  8050ba:	ba 01 00 00 00       	mov    $0x1,%edx
+  8050bf:	e8 5a fb ff ff       	call   804c1e <span_alloc>
+  8050c4:	89 c3                	mov    %eax,%ebx
+  8050c6:	85 c0                	test   %eax,%eax
+  8050c8:	74 0c                	je     8050d6 <malloc_locked+0x22a>
+	mp->mp_size = n;
+  8050ca:	89 78 18             	mov    %edi,0x18(%eax)
+	mstat.ms_inuse += n;
+  8050cd:	01 3d c4 f6 80 00    	add    %edi,0x80f6c4
+	return (uint8_t *) mp + MHDR;
+  8050d3:	83 c3 20             	add    $0x20,%ebx
+}
+  8050d6:	89 d8                	mov    %ebx,%eax
+  8050d8:	83 c4 1c             	add    $0x1c,%esp
+  8050db:	5b                   	pop    %ebx
+  8050dc:	5e                   	pop    %esi
+  8050dd:	5f                   	pop    %edi
+  8050de:	5d                   	pop    %ebp
+  8050df:	c3                   	ret
+			return NULL;
+  8050e0:	89 c3                	mov    %eax,%ebx
+  8050e2:	eb f2                	jmp    8050d6 <malloc_locked+0x22a>
+
+008050e4 <malloc>:
+
+void *
+malloc(size_t n)
+{
+  8050e4:	55                   	push   %ebp
+  8050e5:	89 e5                	mov    %esp,%ebp
+  8050e7:	53                   	push   %ebx
+  8050e8:	83 ec 04             	sub    $0x4,%esp
+	void *v;
+
+	mlock_acquire();
+  8050eb:	e8 02 f8 ff ff       	call   8048f2 <mlock_acquire>
+	v = malloc_locked(n);
+  8050f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8050f3:	e8 b4 fd ff ff       	call   804eac <malloc_locked>
+  8050f8:	89 c3                	mov    %eax,%ebx
+	mlock_release();
+  8050fa:	e8 12 f8 ff ff       	call   804911 <mlock_release>
+	return v;
+}
+  8050ff:	89 d8                	mov    %ebx,%eax
+  805101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805104:	c9                   	leave
+  805105:	c3                   	ret
+
+00805106 <free>:
+
+void
+free(void *v)
+{
+  805106:	55                   	push   %ebp
+  805107:	89 e5                	mov    %esp,%ebp
+  805109:	83 ec 08             	sub    $0x8,%esp
+	mlock_acquire();
+  80510c:	e8 e1 f7 ff ff       	call   8048f2 <mlock_acquire>
+	free_locked(v);
+  805111:	8b 45 08             	mov    0x8(%ebp),%eax
+  805114:	e8 8f fa ff ff       	call   804ba8 <free_locked>
+	mlock_release();
+  805119:	e8 f3 f7 ff ff       	call   804911 <mlock_release>
+}
+  80511e:	c9                   	leave
+  80511f:	c3                   	ret
+
+00805120 <mcache_flush>:
+
+// Give the objects in 'mc' back to their slabs, as a thread that owns
+// it does before it goes away.
+void
+mcache_flush(struct mcache *mc)
+{
+  805120:	55                   	push   %ebp
+  805121:	89 e5                	mov    %esp,%ebp
+  805123:	57                   	push   %edi
+  805124:	56                   	push   %esi
+  805125:	53                   	push   %ebx
+  805126:	83 ec 1c             	sub    $0x1c,%esp
+  805129:	8b 75 08             	mov    0x8(%ebp),%esi
+	void *v;
+	int c;
+
+	mlock_acquire();
+  80512c:	e8 c1 f7 ff ff       	call   8048f2 <mlock_acquire>
+	for (c = 0; c < NCLASS; c++)
+  805131:	89 f1                	mov    %esi,%ecx
+  805133:	83 c6 58             	add    $0x58,%esi
+  805136:	ba 40 71 80 00       	mov    $0x807140,%edx
+  80513b:	eb 4a                	jmp    805187 <mcache_flush+0x67>
+  80513d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  805140:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		while ((v = mc->mc_free[c])) {
+			mc->mc_free[c] = *(void **) v;
+  805143:	8b 03                	mov    (%ebx),%eax
+  805145:	89 07                	mov    %eax,(%edi)
+			mc->mc_n[c]--;
+  805147:	80 2e 01             	subb   $0x1,(%esi)
+			mstat.ms_cached -= mclass_size[c];
+  80514a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80514d:	0f b7 00             	movzwl (%eax),%eax
+  805150:	29 05 d4 f6 80 00    	sub    %eax,0x80f6d4
+			mstat.ms_inuse += mclass_size[c];
+  805156:	01 05 c4 f6 80 00    	add    %eax,0x80f6c4
+			slab_free(span_of(v), v);
+  80515c:	89 d8                	mov    %ebx,%eax
+  80515e:	e8 cd f7 ff ff       	call   804930 <span_of>
+  805163:	89 da                	mov    %ebx,%edx
+  805165:	e8 98 f9 ff ff       	call   804b02 <slab_free>
+		while ((v = mc->mc_free[c])) {
+  80516a:	8b 1f                	mov    (%edi),%ebx
+  80516c:	85 db                	test   %ebx,%ebx
+  80516e:	75 d3                	jne    805143 <mcache_flush+0x23>
+  805170:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  805173:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+	for (c = 0; c < NCLASS; c++)
+  805176:	83 c1 04             	add    $0x4,%ecx
+  805179:	83 c6 01             	add    $0x1,%esi
+  80517c:	83 c2 02             	add    $0x2,%edx
+  80517f:	81 fa 6c 71 80 00    	cmp    $0x80716c,%edx
+  805185:	74 0a                	je     805191 <mcache_flush+0x71>
+		while ((v = mc->mc_free[c])) {
+  805187:	89 cf                	mov    %ecx,%edi
+  805189:	8b 19                	mov    (%ecx),%ebx
+  80518b:	85 db                	test   %ebx,%ebx
+  80518d:	75 ae                	jne    80513d <mcache_flush+0x1d>
+  80518f:	eb e5                	jmp    805176 <mcache_flush+0x56>
+		}
+	mlock_release();
+  805191:	e8 7b f7 ff ff       	call   804911 <mlock_release>
+}
+  805196:	83 c4 1c             	add    $0x1c,%esp
+  805199:	5b                   	pop    %ebx
+  80519a:	5e                   	pop    %esi
+  80519b:	5f                   	pop    %edi
+  80519c:	5d                   	pop    %ebp
+  80519d:	c3                   	ret
+
+0080519e <calloc>:
+
+void *
+calloc(size_t nmemb, size_t size)
+{
+  80519e:	55                   	push   %ebp
+  80519f:	89 e5                	mov    %esp,%ebp
+  8051a1:	56                   	push   %esi
+  8051a2:	53                   	push   %ebx
+  8051a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8051a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	void *v;
+
+	if (size && nmemb > (size_t) -1 / size)
+  8051a9:	85 c9                	test   %ecx,%ecx
+  8051ab:	74 06                	je     8051b3 <calloc+0x15>
+  8051ad:	89 c8                	mov    %ecx,%eax
+  8051af:	f7 e3                	mul    %ebx
+  8051b1:	70 2d                	jo     8051e0 <calloc+0x42>
+		return 0;
+	if ((v = malloc(nmemb * size)))
+  8051b3:	0f af d9             	imul   %ecx,%ebx
+  8051b6:	83 ec 0c             	sub    $0xc,%esp
+  8051b9:	53                   	push   %ebx
+  8051ba:	e8 25 ff ff ff       	call   8050e4 <malloc>
+  8051bf:	89 c6                	mov    %eax,%esi
+  8051c1:	83 c4 10             	add    $0x10,%esp
+  8051c4:	85 c0                	test   %eax,%eax
+  8051c6:	74 0f                	je     8051d7 <calloc+0x39>
+		memset(v, 0, nmemb * size);
+  8051c8:	83 ec 04             	sub    $0x4,%esp
+  8051cb:	53                   	push   %ebx
+  8051cc:	6a 00                	push   $0x0
+  8051ce:	50                   	push   %eax
+  8051cf:	e8 a6 cc ff ff       	call   801e7a <memset>
+  8051d4:	83 c4 10             	add    $0x10,%esp
+	return v;
+}
+  8051d7:	89 f0                	mov    %esi,%eax
+  8051d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8051dc:	5b                   	pop    %ebx
+  8051dd:	5e                   	pop    %esi
+  8051de:	5d                   	pop    %ebp
+  8051df:	c3                   	ret
+		return 0;
+  8051e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8051e5:	eb f0                	jmp    8051d7 <calloc+0x39>
+
+008051e7 <realloc>:
+	return nv;
+}
+
+void *
+realloc(void *v, size_t n)
+{
+  8051e7:	55                   	push   %ebp
+  8051e8:	89 e5                	mov    %esp,%ebp
+  8051ea:	57                   	push   %edi
+  8051eb:	56                   	push   %esi
+  8051ec:	53                   	push   %ebx
+  8051ed:	83 ec 1c             	sub    $0x1c,%esp
+  8051f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	mlock_acquire();
+  8051f3:	e8 fa f6 ff ff       	call   8048f2 <mlock_acquire>
+	if (v == 0)
+  8051f8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8051fc:	74 71                	je     80526f <realloc+0x88>
+	if (n == 0) {
+  8051fe:	85 db                	test   %ebx,%ebx
+  805200:	74 7b                	je     80527d <realloc+0x96>
+	mp = span_of(v);
+  805202:	8b 45 08             	mov    0x8(%ebp),%eax
+  805205:	e8 26 f7 ff ff       	call   804930 <span_of>
+  80520a:	89 c6                	mov    %eax,%esi
+	if (mp->mp_kind == MS_SLAB) {
+  80520c:	80 78 08 02          	cmpb   $0x2,0x8(%eax)
+  805210:	74 7d                	je     80528f <realloc+0xa8>
+		npages = ROUNDUP(n + MHDR, PGSIZE) / PGSIZE;
+  805212:	8d 83 1f 10 00 00    	lea    0x101f(%ebx),%eax
+  805218:	89 c1                	mov    %eax,%ecx
+  80521a:	c1 e9 0c             	shr    $0xc,%ecx
+  80521d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  805220:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  805224:	89 c7                	mov    %eax,%edi
+  805226:	c1 e7 0c             	shl    $0xc,%edi
+  805229:	01 f7                	add    %esi,%edi
+	return next < mtop ? (struct mspan *) next : NULL;
+  80522b:	3b 3d 64 f8 80 00    	cmp    0x80f864,%edi
+  805231:	0f 83 13 01 00 00    	jae    80534a <realloc+0x163>
+		if (n > SMALL_MAX && npages > mp->mp_npages && next
+  805237:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  80523d:	0f 86 1c 01 00 00    	jbe    80535f <realloc+0x178>
+  805243:	39 c1                	cmp    %eax,%ecx
+  805245:	7f 7d                	jg     8052c4 <realloc+0xdd>
+		if (n > SMALL_MAX && npages <= mp->mp_npages) {
+  805247:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+			if (npages < mp->mp_npages) {
+  80524b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80524e:	0f 8c b8 00 00 00    	jl     80530c <realloc+0x125>
+			mstat.ms_inuse += n - mp->mp_size;
+  805254:	89 d8                	mov    %ebx,%eax
+  805256:	03 05 c4 f6 80 00    	add    0x80f6c4,%eax
+  80525c:	2b 46 18             	sub    0x18(%esi),%eax
+  80525f:	a3 c4 f6 80 00       	mov    %eax,0x80f6c4
+			mp->mp_size = n;
+  805264:	89 5e 18             	mov    %ebx,0x18(%esi)
+			return v;
+  805267:	8b 75 08             	mov    0x8(%ebp),%esi
+  80526a:	e9 1d 01 00 00       	jmp    80538c <realloc+0x1a5>
+		return malloc_locked(n);
+  80526f:	89 d8                	mov    %ebx,%eax
+  805271:	e8 36 fc ff ff       	call   804eac <malloc_locked>
+  805276:	89 c6                	mov    %eax,%esi
+  805278:	e9 0f 01 00 00       	jmp    80538c <realloc+0x1a5>
+		free_locked(v);
+  80527d:	8b 45 08             	mov    0x8(%ebp),%eax
+  805280:	e8 23 f9 ff ff       	call   804ba8 <free_locked>
+		return 0;
+  805285:	be 00 00 00 00       	mov    $0x0,%esi
+  80528a:	e9 fd 00 00 00       	jmp    80538c <realloc+0x1a5>
+		have = mclass_size[mp->mp_class];
+  80528f:	0f b6 40 09          	movzbl 0x9(%eax),%eax
+  805293:	0f b6 d0             	movzbl %al,%edx
+  805296:	0f b7 bc 12 40 71 80 	movzwl 0x807140(%edx,%edx,1),%edi
+  80529d:	00 
+		if (n <= SMALL_MAX && mclass_of[(n + 15) / 16] == mp->mp_class)
+  80529e:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  8052a4:	0f 87 b8 00 00 00    	ja     805362 <realloc+0x17b>
+  8052aa:	8d 53 0f             	lea    0xf(%ebx),%edx
+  8052ad:	c1 ea 04             	shr    $0x4,%edx
+			return v;
+  8052b0:	8b 75 08             	mov    0x8(%ebp),%esi
+		if (n <= SMALL_MAX && mclass_of[(n + 15) / 16] == mp->mp_class)
+  8052b3:	3a 82 00 f7 80 00    	cmp    0x80f700(%edx),%al
+  8052b9:	0f 85 a3 00 00 00    	jne    805362 <realloc+0x17b>
+  8052bf:	e9 c8 00 00 00       	jmp    80538c <realloc+0x1a5>
+		    && next->mp_kind == MS_FREE
+  8052c4:	80 7f 08 00          	cmpb   $0x0,0x8(%edi)
+  8052c8:	0f 85 91 00 00 00    	jne    80535f <realloc+0x178>
+		    && mp->mp_npages + next->mp_npages >= npages) {
+  8052ce:	0f b7 57 04          	movzwl 0x4(%edi),%edx
+  8052d2:	01 d0                	add    %edx,%eax
+  8052d4:	39 c1                	cmp    %eax,%ecx
+  8052d6:	0f 8f 83 00 00 00    	jg     80535f <realloc+0x178>
+	return &mbins[MIN(npages, MBINS - 1)];
+  8052dc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8052e1:	39 c2                	cmp    %eax,%edx
+  8052e3:	0f 4f d0             	cmovg  %eax,%edx
+  8052e6:	8d 04 95 e0 f7 80 00 	lea    0x80f7e0(,%edx,4),%eax
+			list_remove(bin_of(next->mp_npages), next);
+  8052ed:	89 fa                	mov    %edi,%edx
+  8052ef:	e8 a9 f5 ff ff       	call   80489d <list_remove>
+			span_set(mp, mp->mp_npages + next->mp_npages, MS_LARGE);
+  8052f4:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  8052f8:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+  8052fc:	01 c2                	add    %eax,%edx
+  8052fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  805303:	89 f0                	mov    %esi,%eax
+  805305:	e8 b5 f5 ff ff       	call   8048bf <span_set>
+  80530a:	eb 46                	jmp    805352 <realloc+0x16b>
+				next = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+  80530c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80530f:	89 d0                	mov    %edx,%eax
+  805311:	c1 e0 0c             	shl    $0xc,%eax
+  805314:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+				next->mp_prevpages = npages;
+  805317:	89 d0                	mov    %edx,%eax
+  805319:	66 89 57 06          	mov    %dx,0x6(%edi)
+				span_set(next, mp->mp_npages - npages, MS_FREE);
+  80531d:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  805321:	29 c2                	sub    %eax,%edx
+  805323:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805328:	89 f8                	mov    %edi,%eax
+  80532a:	e8 90 f5 ff ff       	call   8048bf <span_set>
+				span_set(mp, npages, MS_LARGE);
+  80532f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  805334:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  805337:	89 f0                	mov    %esi,%eax
+  805339:	e8 81 f5 ff ff       	call   8048bf <span_set>
+				span_free(next);
+  80533e:	89 f8                	mov    %edi,%eax
+  805340:	e8 f7 f6 ff ff       	call   804a3c <span_free>
+  805345:	e9 0a ff ff ff       	jmp    805254 <realloc+0x6d>
+		if (n > SMALL_MAX && npages > mp->mp_npages && next
+  80534a:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  805350:	76 0d                	jbe    80535f <realloc+0x178>
+		if (n > SMALL_MAX && npages <= mp->mp_npages) {
+  805352:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  805356:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  805359:	0f 8e ec fe ff ff    	jle    80524b <realloc+0x64>
+		have = mp->mp_size;
+  80535f:	8b 7e 18             	mov    0x18(%esi),%edi
+	if (!(nv = malloc_locked(n)))
+  805362:	89 d8                	mov    %ebx,%eax
+  805364:	e8 43 fb ff ff       	call   804eac <malloc_locked>
+  805369:	89 c6                	mov    %eax,%esi
+  80536b:	85 c0                	test   %eax,%eax
+  80536d:	74 1d                	je     80538c <realloc+0x1a5>
+	memmove(nv, v, MIN(have, n));
+  80536f:	83 ec 04             	sub    $0x4,%esp
+  805372:	39 fb                	cmp    %edi,%ebx
+  805374:	0f 46 fb             	cmovbe %ebx,%edi
+  805377:	57                   	push   %edi
+  805378:	ff 75 08             	push   0x8(%ebp)
+  80537b:	50                   	push   %eax
+  80537c:	e8 2e cb ff ff       	call   801eaf <memmove>
+	free_locked(v);
+  805381:	8b 45 08             	mov    0x8(%ebp),%eax
+  805384:	e8 1f f8 ff ff       	call   804ba8 <free_locked>
+	return nv;
+  805389:	83 c4 10             	add    $0x10,%esp
+	v = realloc_locked(v, n);
+	mlock_release();
+  80538c:	e8 80 f5 ff ff       	call   804911 <mlock_release>
+	return v;
+}
+  805391:	89 f0                	mov    %esi,%eax
+  805393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805396:	5b                   	pop    %ebx
+  805397:	5e                   	pop    %esi
+  805398:	5f                   	pop    %edi
+  805399:	5d                   	pop    %ebp
+  80539a:	c3                   	ret
+
+0080539b <malloc_stats>:
+
+// Fill in 'st' with how the heap is used.
+void
+malloc_stats(struct mstats *st)
+{
+  80539b:	55                   	push   %ebp
+  80539c:	89 e5                	mov    %esp,%ebp
+  80539e:	56                   	push   %esi
+  80539f:	53                   	push   %ebx
+  8053a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct mspan *mp;
+	int c;
+
+	mlock_acquire();
+  8053a3:	e8 4a f5 ff ff       	call   8048f2 <mlock_acquire>
+	*st = mstat;
+  8053a8:	a1 c0 f6 80 00       	mov    0x80f6c0,%eax
+  8053ad:	89 03                	mov    %eax,(%ebx)
+  8053af:	a1 c4 f6 80 00       	mov    0x80f6c4,%eax
+  8053b4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8053b7:	a1 c8 f6 80 00       	mov    0x80f6c8,%eax
+  8053bc:	89 43 08             	mov    %eax,0x8(%ebx)
+  8053bf:	a1 d4 f6 80 00       	mov    0x80f6d4,%eax
+  8053c4:	89 43 14             	mov    %eax,0x14(%ebx)
+  8053c7:	a1 d8 f6 80 00       	mov    0x80f6d8,%eax
+  8053cc:	89 43 18             	mov    %eax,0x18(%ebx)
+  8053cf:	a1 dc f6 80 00       	mov    0x80f6dc,%eax
+  8053d4:	89 43 1c             	mov    %eax,0x1c(%ebx)
+	st->ms_slabfree = st->ms_spanfree = 0;
+  8053d7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  8053de:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+	for (c = 0; c < NCLASS; c++)
+  8053e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8053ea:	eb 08                	jmp    8053f4 <malloc_stats+0x59>
+  8053ec:	83 c6 01             	add    $0x1,%esi
+  8053ef:	83 fe 16             	cmp    $0x16,%esi
+  8053f2:	74 26                	je     80541a <malloc_stats+0x7f>
+		for (mp = mslabs[c]; mp; mp = mp->mp_next)
+  8053f4:	8b 04 b5 80 f7 80 00 	mov    0x80f780(,%esi,4),%eax
+  8053fb:	85 c0                	test   %eax,%eax
+  8053fd:	74 ed                	je     8053ec <malloc_stats+0x51>
+			st->ms_slabfree += mp->mp_nfree * mclass_size[c];
+  8053ff:	0f b7 8c 36 40 71 80 	movzwl 0x807140(%esi,%esi,1),%ecx
+  805406:	00 
+  805407:	0f b7 50 0a          	movzwl 0xa(%eax),%edx
+  80540b:	0f af d1             	imul   %ecx,%edx
+  80540e:	01 53 0c             	add    %edx,0xc(%ebx)
+		for (mp = mslabs[c]; mp; mp = mp->mp_next)
+  805411:	8b 40 10             	mov    0x10(%eax),%eax
+  805414:	85 c0                	test   %eax,%eax
+  805416:	75 ef                	jne    805407 <malloc_stats+0x6c>
+  805418:	eb d2                	jmp    8053ec <malloc_stats+0x51>
+	for (c = 0; c < MBINS; c++)
+  80541a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80541f:	eb 08                	jmp    805429 <malloc_stats+0x8e>
+  805421:	83 c1 01             	add    $0x1,%ecx
+  805424:	83 f9 20             	cmp    $0x20,%ecx
+  805427:	74 1e                	je     805447 <malloc_stats+0xac>
+		for (mp = mbins[c]; mp; mp = mp->mp_next)
+  805429:	8b 04 8d e0 f7 80 00 	mov    0x80f7e0(,%ecx,4),%eax
+  805430:	85 c0                	test   %eax,%eax
+  805432:	74 ed                	je     805421 <malloc_stats+0x86>
+			st->ms_spanfree += mp->mp_npages * PGSIZE;
+  805434:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  805438:	c1 e2 0c             	shl    $0xc,%edx
+  80543b:	01 53 10             	add    %edx,0x10(%ebx)
+		for (mp = mbins[c]; mp; mp = mp->mp_next)
+  80543e:	8b 40 10             	mov    0x10(%eax),%eax
+  805441:	85 c0                	test   %eax,%eax
+  805443:	75 ef                	jne    805434 <malloc_stats+0x99>
+  805445:	eb da                	jmp    805421 <malloc_stats+0x86>
+	mlock_release();
+  805447:	e8 c5 f4 ff ff       	call   804911 <mlock_release>
+}
+  80544c:	5b                   	pop    %ebx
+  80544d:	5e                   	pop    %esi
+  80544e:	5d                   	pop    %ebp
+  80544f:	c3                   	ret
+
+00805450 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805450:	55                   	push   %ebp
+  805451:	89 e5                	mov    %esp,%ebp
+  805453:	57                   	push   %edi
+  805454:	56                   	push   %esi
+  805455:	53                   	push   %ebx
+  805456:	83 ec 1c             	sub    $0x1c,%esp
+  805459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80545c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80545f:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  805464:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805469:	89 e0                	mov    %esp,%eax
+  80546b:	89 f2                	mov    %esi,%edx
+  80546d:	29 c2                	sub    %eax,%edx
+  80546f:	89 d0                	mov    %edx,%eax
+  805471:	c1 e8 0f             	shr    $0xf,%eax
+  805474:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80547a:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80547d:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  805484:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  805487:	83 ec 0c             	sub    $0xc,%esp
+  80548a:	ff 75 e0             	push   -0x20(%ebp)
+  80548d:	e8 79 0e 00 00       	call   80630b <pageref>
+  805492:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805495:	83 c4 04             	add    $0x4,%esp
+  805498:	ff 75 dc             	push   -0x24(%ebp)
+  80549b:	e8 6b 0e 00 00       	call   80630b <pageref>
+  8054a0:	89 e2                	mov    %esp,%edx
+  8054a2:	89 f1                	mov    %esi,%ecx
+  8054a4:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8054a6:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8054a9:	89 ca                	mov    %ecx,%edx
+  8054ab:	c1 ea 0f             	shr    $0xf,%edx
+  8054ae:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8054b4:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8054b7:	8b 14 95 80 f8 80 00 	mov    0x80f880(,%edx,4),%edx
+  8054be:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8054c1:	39 d7                	cmp    %edx,%edi
+  8054c3:	74 40                	je     805505 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8054c5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8054c8:	75 9f                	jne    805469 <_pipeisclosed+0x19>
+  8054ca:	89 e2                	mov    %esp,%edx
+  8054cc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8054d1:	29 d0                	sub    %edx,%eax
+  8054d3:	89 c2                	mov    %eax,%edx
+  8054d5:	c1 ea 0f             	shr    $0xf,%edx
+  8054d8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8054dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054e2:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8054e5:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  8054ec:	8b 40 58             	mov    0x58(%eax),%eax
+  8054ef:	6a 01                	push   $0x1
+  8054f1:	50                   	push   %eax
+  8054f2:	57                   	push   %edi
+  8054f3:	68 6c 71 80 00       	push   $0x80716c
+  8054f8:	e8 0b c1 ff ff       	call   801608 <cprintf>
+  8054fd:	83 c4 10             	add    $0x10,%esp
+  805500:	e9 5f ff ff ff       	jmp    805464 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  805505:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  805508:	0f 94 c0             	sete   %al
+  80550b:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80550e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805511:	5b                   	pop    %ebx
+  805512:	5e                   	pop    %esi
+  805513:	5f                   	pop    %edi
+  805514:	5d                   	pop    %ebp
+  805515:	c3                   	ret
+
+00805516 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805516:	55                   	push   %ebp
+  805517:	89 e5                	mov    %esp,%ebp
+  805519:	53                   	push   %ebx
+  80551a:	83 ec 0c             	sub    $0xc,%esp
+  80551d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  805520:	53                   	push   %ebx
+  805521:	6a 00                	push   $0x0
+  805523:	e8 90 cc ff ff       	call   8021b8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  805528:	89 1c 24             	mov    %ebx,(%esp)
+  80552b:	e8 41 d9 ff ff       	call   802e71 <fd2data>
+  805530:	83 c4 08             	add    $0x8,%esp
+  805533:	50                   	push   %eax
+  805534:	6a 00                	push   $0x0
+  805536:	e8 7d cc ff ff       	call   8021b8 <sys_page_unmap>
+}
+  80553b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80553e:	c9                   	leave
+  80553f:	c3                   	ret
+
+00805540 <devpipe_read>:
+{
+  805540:	55                   	push   %ebp
+  805541:	89 e5                	mov    %esp,%ebp
+  805543:	57                   	push   %edi
+  805544:	56                   	push   %esi
+  805545:	53                   	push   %ebx
+  805546:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  805549:	ff 75 08             	push   0x8(%ebp)
+  80554c:	e8 20 d9 ff ff       	call   802e71 <fd2data>
+  805551:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  805553:	8b 70 04             	mov    0x4(%eax),%esi
+  805556:	8b 00                	mov    (%eax),%eax
+  805558:	83 c4 10             	add    $0x10,%esp
+  80555b:	39 f0                	cmp    %esi,%eax
+  80555d:	75 36                	jne    805595 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80555f:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  805562:	89 da                	mov    %ebx,%edx
+  805564:	8b 45 08             	mov    0x8(%ebp),%eax
+  805567:	e8 e4 fe ff ff       	call   805450 <_pipeisclosed>
+  80556c:	85 c0                	test   %eax,%eax
+  80556e:	0f 85 d4 00 00 00    	jne    805648 <devpipe_read+0x108>
+	asm volatile("lock; xchgl %0, %1" :
+  805574:	b8 01 00 00 00       	mov    $0x1,%eax
+  805579:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80557d:	83 ec 04             	sub    $0x4,%esp
+  805580:	6a ff                	push   $0xffffffff
+  805582:	56                   	push   %esi
+  805583:	57                   	push   %edi
+  805584:	e8 a8 cf ff ff       	call   802531 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  805589:	8b 73 04             	mov    0x4(%ebx),%esi
+  80558c:	8b 03                	mov    (%ebx),%eax
+  80558e:	83 c4 10             	add    $0x10,%esp
+  805591:	39 c6                	cmp    %eax,%esi
+  805593:	74 cd                	je     805562 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  805595:	8b 73 04             	mov    0x4(%ebx),%esi
+  805598:	8b 03                	mov    (%ebx),%eax
+  80559a:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8055a0:	29 c6                	sub    %eax,%esi
+  8055a2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8055a7:	f7 e6                	mul    %esi
+  8055a9:	c1 ea 0c             	shr    $0xc,%edx
+  8055ac:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8055b2:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8055b4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8055b7:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8055bb:	8b 0b                	mov    (%ebx),%ecx
+  8055bd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8055c2:	f7 e1                	mul    %ecx
+  8055c4:	c1 ea 0b             	shr    $0xb,%edx
+  8055c7:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8055cd:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8055cf:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8055d4:	29 cf                	sub    %ecx,%edi
+  8055d6:	39 f7                	cmp    %esi,%edi
+  8055d8:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8055db:	83 ec 04             	sub    $0x4,%esp
+  8055de:	57                   	push   %edi
+  8055df:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8055e3:	50                   	push   %eax
+  8055e4:	ff 75 0c             	push   0xc(%ebp)
+  8055e7:	e8 c3 c8 ff ff       	call   801eaf <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8055ec:	83 c4 0c             	add    $0xc,%esp
+  8055ef:	89 f0                	mov    %esi,%eax
+  8055f1:	29 f8                	sub    %edi,%eax
+  8055f3:	50                   	push   %eax
+  8055f4:	8d 43 10             	lea    0x10(%ebx),%eax
+  8055f7:	50                   	push   %eax
+  8055f8:	89 f8                	mov    %edi,%eax
+  8055fa:	03 45 0c             	add    0xc(%ebp),%eax
+  8055fd:	50                   	push   %eax
+  8055fe:	e8 ac c8 ff ff       	call   801eaf <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  805603:	8b 0b                	mov    (%ebx),%ecx
+  805605:	01 f1                	add    %esi,%ecx
+  805607:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80560c:	f7 e1                	mul    %ecx
+  80560e:	c1 ea 0c             	shr    $0xc,%edx
+  805611:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  805617:	29 c1                	sub    %eax,%ecx
+  805619:	89 0b                	mov    %ecx,(%ebx)
+  80561b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805620:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  805624:	83 c4 10             	add    $0x10,%esp
+  805627:	85 c0                	test   %eax,%eax
+  805629:	75 0a                	jne    805635 <devpipe_read+0xf5>
+	return n;
+  80562b:	89 f0                	mov    %esi,%eax
+}
+  80562d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805630:	5b                   	pop    %ebx
+  805631:	5e                   	pop    %esi
+  805632:	5f                   	pop    %edi
+  805633:	5d                   	pop    %ebp
+  805634:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  805635:	83 ec 08             	sub    $0x8,%esp
+  805638:	68 00 04 00 00       	push   $0x400
+  80563d:	53                   	push   %ebx
+  80563e:	e8 10 cf ff ff       	call   802553 <sys_futex_wake>
+  805643:	83 c4 10             	add    $0x10,%esp
+  805646:	eb e3                	jmp    80562b <devpipe_read+0xeb>
+			return 0;
+  805648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80564d:	eb de                	jmp    80562d <devpipe_read+0xed>
+
+0080564f <devpipe_write>:
+{
+  80564f:	55                   	push   %ebp
+  805650:	89 e5                	mov    %esp,%ebp
+  805652:	57                   	push   %edi
+  805653:	56                   	push   %esi
+  805654:	53                   	push   %ebx
+  805655:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  805658:	ff 75 08             	push   0x8(%ebp)
+  80565b:	e8 11 d8 ff ff       	call   802e71 <fd2data>
+  805660:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  805662:	83 c4 10             	add    $0x10,%esp
+  805665:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80566c:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  805671:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  805675:	0f 84 43 01 00 00    	je     8057be <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80567b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80567e:	8b 06                	mov    (%esi),%eax
+  805680:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  805686:	29 c1                	sub    %eax,%ecx
+  805688:	89 c8                	mov    %ecx,%eax
+  80568a:	f7 e7                	mul    %edi
+  80568c:	c1 ea 0c             	shr    $0xc,%edx
+  80568f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  805695:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  805697:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80569d:	75 52                	jne    8056f1 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80569f:	89 f2                	mov    %esi,%edx
+  8056a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8056a4:	e8 a7 fd ff ff       	call   805450 <_pipeisclosed>
+  8056a9:	85 c0                	test   %eax,%eax
+  8056ab:	0f 85 28 01 00 00    	jne    8057d9 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8056b1:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8056b3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8056b6:	8b 06                	mov    (%esi),%eax
+  8056b8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8056be:	29 c1                	sub    %eax,%ecx
+  8056c0:	89 c8                	mov    %ecx,%eax
+  8056c2:	f7 e7                	mul    %edi
+  8056c4:	c1 ea 0c             	shr    $0xc,%edx
+  8056c7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8056cd:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8056cf:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8056d5:	75 a4                	jne    80567b <devpipe_write+0x2c>
+  8056d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8056dc:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8056e0:	83 ec 04             	sub    $0x4,%esp
+  8056e3:	6a ff                	push   $0xffffffff
+  8056e5:	53                   	push   %ebx
+  8056e6:	56                   	push   %esi
+  8056e7:	e8 45 ce ff ff       	call   802531 <sys_futex_wait>
+}
+  8056ec:	83 c4 10             	add    $0x10,%esp
+  8056ef:	eb 8a                	jmp    80567b <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8056f1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8056f4:	8b 06                	mov    (%esi),%eax
+  8056f6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8056fc:	29 c1                	sub    %eax,%ecx
+  8056fe:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  805703:	f7 e1                	mul    %ecx
+  805705:	c1 ea 0c             	shr    $0xc,%edx
+  805708:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80570e:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  805710:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  805715:	89 d8                	mov    %ebx,%eax
+  805717:	29 c8                	sub    %ecx,%eax
+  805719:	8b 55 10             	mov    0x10(%ebp),%edx
+  80571c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80571f:	29 ca                	sub    %ecx,%edx
+  805721:	39 d0                	cmp    %edx,%eax
+  805723:	0f 46 d0             	cmovbe %eax,%edx
+  805726:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  805729:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80572c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  805731:	f7 e1                	mul    %ecx
+  805733:	c1 ea 0b             	shr    $0xb,%edx
+  805736:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80573c:	89 ca                	mov    %ecx,%edx
+  80573e:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  805740:	29 d3                	sub    %edx,%ebx
+  805742:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805745:	39 c3                	cmp    %eax,%ebx
+  805747:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80574a:	83 ec 04             	sub    $0x4,%esp
+  80574d:	53                   	push   %ebx
+  80574e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  805751:	03 4d 0c             	add    0xc(%ebp),%ecx
+  805754:	51                   	push   %ecx
+  805755:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  805759:	50                   	push   %eax
+  80575a:	e8 50 c7 ff ff       	call   801eaf <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80575f:	83 c4 0c             	add    $0xc,%esp
+  805762:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805765:	29 d8                	sub    %ebx,%eax
+  805767:	50                   	push   %eax
+  805768:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80576b:	01 cb                	add    %ecx,%ebx
+  80576d:	03 5d 0c             	add    0xc(%ebp),%ebx
+  805770:	53                   	push   %ebx
+  805771:	8d 46 10             	lea    0x10(%esi),%eax
+  805774:	50                   	push   %eax
+  805775:	e8 35 c7 ff ff       	call   801eaf <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80577a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80577d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805780:	01 c1                	add    %eax,%ecx
+  805782:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  805787:	f7 e1                	mul    %ecx
+  805789:	c1 ea 0c             	shr    $0xc,%edx
+  80578c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  805792:	89 ca                	mov    %ecx,%edx
+  805794:	29 c2                	sub    %eax,%edx
+  805796:	89 56 04             	mov    %edx,0x4(%esi)
+  805799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80579e:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8057a2:	83 c4 10             	add    $0x10,%esp
+  8057a5:	85 c0                	test   %eax,%eax
+  8057a7:	75 1a                	jne    8057c3 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8057a9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8057ac:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8057af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8057b2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8057b5:	0f 82 c0 fe ff ff    	jb     80567b <devpipe_write+0x2c>
+  8057bb:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8057be:	8b 45 10             	mov    0x10(%ebp),%eax
+  8057c1:	eb 1b                	jmp    8057de <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8057c3:	83 ec 08             	sub    $0x8,%esp
+  8057c6:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8057cb:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8057ce:	50                   	push   %eax
+  8057cf:	e8 7f cd ff ff       	call   802553 <sys_futex_wake>
+  8057d4:	83 c4 10             	add    $0x10,%esp
+  8057d7:	eb d0                	jmp    8057a9 <devpipe_write+0x15a>
+				return 0;
+  8057d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8057e1:	5b                   	pop    %ebx
+  8057e2:	5e                   	pop    %esi
+  8057e3:	5f                   	pop    %edi
+  8057e4:	5d                   	pop    %ebp
+  8057e5:	c3                   	ret
+
+008057e6 <devpipe_stat>:
+{
+  8057e6:	55                   	push   %ebp
+  8057e7:	89 e5                	mov    %esp,%ebp
+  8057e9:	56                   	push   %esi
+  8057ea:	53                   	push   %ebx
+  8057eb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8057ee:	83 ec 0c             	sub    $0xc,%esp
+  8057f1:	ff 75 08             	push   0x8(%ebp)
+  8057f4:	e8 78 d6 ff ff       	call   802e71 <fd2data>
+  8057f9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8057fb:	83 c4 08             	add    $0x8,%esp
+  8057fe:	68 7f 71 80 00       	push   $0x80717f
+  805803:	53                   	push   %ebx
+  805804:	e8 f6 c4 ff ff       	call   801cff <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  805809:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80580c:	8b 06                	mov    (%esi),%eax
+  80580e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  805814:	29 c1                	sub    %eax,%ecx
+  805816:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80581b:	89 c8                	mov    %ecx,%eax
+  80581d:	f7 e2                	mul    %edx
+  80581f:	c1 ea 0c             	shr    $0xc,%edx
+  805822:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  805828:	29 d1                	sub    %edx,%ecx
+  80582a:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  805830:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  805837:	00 00 00 
+	stat->st_dev = &devpipe;
+  80583a:	c7 83 8c 00 00 00 80 	movl   $0x808080,0x8c(%ebx)
+  805841:	80 80 00 
+}
+  805844:	b8 00 00 00 00       	mov    $0x0,%eax
+  805849:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80584c:	5b                   	pop    %ebx
+  80584d:	5e                   	pop    %esi
+  80584e:	5d                   	pop    %ebp
+  80584f:	c3                   	ret
+
+00805850 <devpipe_poll>:
+{
+  805850:	55                   	push   %ebp
+  805851:	89 e5                	mov    %esp,%ebp
+  805853:	57                   	push   %edi
+  805854:	56                   	push   %esi
+  805855:	53                   	push   %ebx
+  805856:	83 ec 18             	sub    $0x18,%esp
+  805859:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80585c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80585f:	57                   	push   %edi
+  805860:	e8 0c d6 ff ff       	call   802e71 <fd2data>
+  805865:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  805867:	83 c4 10             	add    $0x10,%esp
+  80586a:	89 f3                	mov    %esi,%ebx
+  80586c:	83 e3 01             	and    $0x1,%ebx
+  80586f:	75 27                	jne    805898 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  805871:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  805877:	75 48                	jne    8058c1 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  805879:	89 ca                	mov    %ecx,%edx
+  80587b:	89 f8                	mov    %edi,%eax
+  80587d:	e8 ce fb ff ff       	call   805450 <_pipeisclosed>
+  805882:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  805884:	89 d8                	mov    %ebx,%eax
+  805886:	83 c8 10             	or     $0x10,%eax
+  805889:	85 d2                	test   %edx,%edx
+  80588b:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80588e:	89 d8                	mov    %ebx,%eax
+  805890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805893:	5b                   	pop    %ebx
+  805894:	5e                   	pop    %esi
+  805895:	5f                   	pop    %edi
+  805896:	5d                   	pop    %ebp
+  805897:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  805898:	8b 58 04             	mov    0x4(%eax),%ebx
+  80589b:	8b 00                	mov    (%eax),%eax
+  80589d:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8058a3:	29 c3                	sub    %eax,%ebx
+  8058a5:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8058aa:	89 d8                	mov    %ebx,%eax
+  8058ac:	f7 e2                	mul    %edx
+  8058ae:	c1 ea 0c             	shr    $0xc,%edx
+  8058b1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8058b7:	39 d3                	cmp    %edx,%ebx
+  8058b9:	0f 95 c3             	setne  %bl
+  8058bc:	0f b6 db             	movzbl %bl,%ebx
+  8058bf:	eb b0                	jmp    805871 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8058c1:	8b 71 04             	mov    0x4(%ecx),%esi
+  8058c4:	8b 01                	mov    (%ecx),%eax
+  8058c6:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8058cc:	29 c6                	sub    %eax,%esi
+  8058ce:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8058d3:	89 f0                	mov    %esi,%eax
+  8058d5:	f7 e2                	mul    %edx
+  8058d7:	c1 ea 0c             	shr    $0xc,%edx
+  8058da:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8058e0:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8058e2:	89 d8                	mov    %ebx,%eax
+  8058e4:	83 c8 04             	or     $0x4,%eax
+  8058e7:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8058ed:	0f 42 d8             	cmovb  %eax,%ebx
+  8058f0:	eb 87                	jmp    805879 <devpipe_poll+0x29>
+
+008058f2 <pipe>:
+{
+  8058f2:	55                   	push   %ebp
+  8058f3:	89 e5                	mov    %esp,%ebp
+  8058f5:	56                   	push   %esi
+  8058f6:	53                   	push   %ebx
+  8058f7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8058fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8058fd:	50                   	push   %eax
+  8058fe:	e8 85 d5 ff ff       	call   802e88 <fd_alloc>
+  805903:	89 c3                	mov    %eax,%ebx
+  805905:	83 c4 10             	add    $0x10,%esp
+  805908:	85 c0                	test   %eax,%eax
+  80590a:	0f 88 23 01 00 00    	js     805a33 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805910:	83 ec 04             	sub    $0x4,%esp
+  805913:	68 07 04 00 00       	push   $0x407
+  805918:	ff 75 f4             	push   -0xc(%ebp)
+  80591b:	6a 00                	push   $0x0
+  80591d:	e8 11 c8 ff ff       	call   802133 <sys_page_alloc>
+  805922:	89 c3                	mov    %eax,%ebx
+  805924:	83 c4 10             	add    $0x10,%esp
+  805927:	85 c0                	test   %eax,%eax
+  805929:	0f 88 04 01 00 00    	js     805a33 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80592f:	83 ec 0c             	sub    $0xc,%esp
+  805932:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  805935:	50                   	push   %eax
+  805936:	e8 4d d5 ff ff       	call   802e88 <fd_alloc>
+  80593b:	89 c3                	mov    %eax,%ebx
+  80593d:	83 c4 10             	add    $0x10,%esp
+  805940:	85 c0                	test   %eax,%eax
+  805942:	0f 88 db 00 00 00    	js     805a23 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805948:	83 ec 04             	sub    $0x4,%esp
+  80594b:	68 07 04 00 00       	push   $0x407
+  805950:	ff 75 f0             	push   -0x10(%ebp)
+  805953:	6a 00                	push   $0x0
+  805955:	e8 d9 c7 ff ff       	call   802133 <sys_page_alloc>
+  80595a:	89 c3                	mov    %eax,%ebx
+  80595c:	83 c4 10             	add    $0x10,%esp
+  80595f:	85 c0                	test   %eax,%eax
+  805961:	0f 88 bc 00 00 00    	js     805a23 <pipe+0x131>
+	va = fd2data(fd0);
+  805967:	83 ec 0c             	sub    $0xc,%esp
+  80596a:	ff 75 f4             	push   -0xc(%ebp)
+  80596d:	e8 ff d4 ff ff       	call   802e71 <fd2data>
+  805972:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805974:	83 c4 0c             	add    $0xc,%esp
+  805977:	68 07 04 00 00       	push   $0x407
+  80597c:	50                   	push   %eax
+  80597d:	6a 00                	push   $0x0
+  80597f:	e8 af c7 ff ff       	call   802133 <sys_page_alloc>
+  805984:	89 c3                	mov    %eax,%ebx
+  805986:	83 c4 10             	add    $0x10,%esp
+  805989:	85 c0                	test   %eax,%eax
+  80598b:	0f 88 82 00 00 00    	js     805a13 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805991:	83 ec 0c             	sub    $0xc,%esp
+  805994:	ff 75 f0             	push   -0x10(%ebp)
+  805997:	e8 d5 d4 ff ff       	call   802e71 <fd2data>
+  80599c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8059a3:	50                   	push   %eax
+  8059a4:	6a 00                	push   $0x0
+  8059a6:	56                   	push   %esi
+  8059a7:	6a 00                	push   $0x0
+  8059a9:	e8 c8 c7 ff ff       	call   802176 <sys_page_map>
+  8059ae:	89 c3                	mov    %eax,%ebx
+  8059b0:	83 c4 20             	add    $0x20,%esp
+  8059b3:	85 c0                	test   %eax,%eax
+  8059b5:	78 4e                	js     805a05 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8059b7:	a1 80 80 80 00       	mov    0x808080,%eax
+  8059bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8059bf:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8059c1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8059c4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8059cb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8059ce:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8059d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8059d3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8059da:	83 ec 0c             	sub    $0xc,%esp
+  8059dd:	ff 75 f4             	push   -0xc(%ebp)
+  8059e0:	e8 7c d4 ff ff       	call   802e61 <fd2num>
+  8059e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8059e8:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8059ea:	83 c4 04             	add    $0x4,%esp
+  8059ed:	ff 75 f0             	push   -0x10(%ebp)
+  8059f0:	e8 6c d4 ff ff       	call   802e61 <fd2num>
+  8059f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8059f8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8059fb:	83 c4 10             	add    $0x10,%esp
+  8059fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805a03:	eb 2e                	jmp    805a33 <pipe+0x141>
+	sys_page_unmap(0, va);
+  805a05:	83 ec 08             	sub    $0x8,%esp
+  805a08:	56                   	push   %esi
+  805a09:	6a 00                	push   $0x0
+  805a0b:	e8 a8 c7 ff ff       	call   8021b8 <sys_page_unmap>
+  805a10:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  805a13:	83 ec 08             	sub    $0x8,%esp
+  805a16:	ff 75 f0             	push   -0x10(%ebp)
+  805a19:	6a 00                	push   $0x0
+  805a1b:	e8 98 c7 ff ff       	call   8021b8 <sys_page_unmap>
+  805a20:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  805a23:	83 ec 08             	sub    $0x8,%esp
+  805a26:	ff 75 f4             	push   -0xc(%ebp)
+  805a29:	6a 00                	push   $0x0
+  805a2b:	e8 88 c7 ff ff       	call   8021b8 <sys_page_unmap>
+  805a30:	83 c4 10             	add    $0x10,%esp
+}
+  805a33:	89 d8                	mov    %ebx,%eax
+  805a35:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805a38:	5b                   	pop    %ebx
+  805a39:	5e                   	pop    %esi
+  805a3a:	5d                   	pop    %ebp
+  805a3b:	c3                   	ret
+
+00805a3c <pipeisclosed>:
+{
+  805a3c:	55                   	push   %ebp
+  805a3d:	89 e5                	mov    %esp,%ebp
+  805a3f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805a42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805a45:	50                   	push   %eax
+  805a46:	ff 75 08             	push   0x8(%ebp)
+  805a49:	e8 8a d4 ff ff       	call   802ed8 <fd_lookup>
+  805a4e:	83 c4 10             	add    $0x10,%esp
+  805a51:	85 c0                	test   %eax,%eax
+  805a53:	78 18                	js     805a6d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  805a55:	83 ec 0c             	sub    $0xc,%esp
+  805a58:	ff 75 f4             	push   -0xc(%ebp)
+  805a5b:	e8 11 d4 ff ff       	call   802e71 <fd2data>
+  805a60:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  805a62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805a65:	e8 e6 f9 ff ff       	call   805450 <_pipeisclosed>
+  805a6a:	83 c4 10             	add    $0x10,%esp
+}
+  805a6d:	c9                   	leave
+  805a6e:	c3                   	ret
+
+00805a6f <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  805a6f:	55                   	push   %ebp
+  805a70:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  805a72:	8b 45 08             	mov    0x8(%ebp),%eax
+  805a75:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  805a7b:	5d                   	pop    %ebp
+  805a7c:	c3                   	ret
+
+00805a7d <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  805a7d:	55                   	push   %ebp
+  805a7e:	89 e5                	mov    %esp,%ebp
+  805a80:	53                   	push   %ebx
+  805a81:	83 ec 04             	sub    $0x4,%esp
+  805a84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  805a87:	8b 03                	mov    (%ebx),%eax
+  805a89:	85 c0                	test   %eax,%eax
+  805a8b:	75 05                	jne    805a92 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  805a8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805a90:	c9                   	leave
+  805a91:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  805a92:	83 ec 08             	sub    $0x8,%esp
+  805a95:	50                   	push   %eax
+  805a96:	8d 43 04             	lea    0x4(%ebx),%eax
+  805a99:	50                   	push   %eax
+  805a9a:	e8 69 c9 ff ff       	call   802408 <sys_page_batch>
+	pb->pb_n = 0;
+  805a9f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  805aa5:	83 c4 10             	add    $0x10,%esp
+  805aa8:	eb e3                	jmp    805a8d <pgbatch_flush+0x10>
+
+00805aaa <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  805aaa:	55                   	push   %ebp
+  805aab:	89 e5                	mov    %esp,%ebp
+  805aad:	56                   	push   %esi
+  805aae:	53                   	push   %ebx
+  805aaf:	89 c3                	mov    %eax,%ebx
+  805ab1:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  805ab3:	83 38 20             	cmpl   $0x20,(%eax)
+  805ab6:	74 2c                	je     805ae4 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  805ab8:	8b 03                	mov    (%ebx),%eax
+  805aba:	8d 50 01             	lea    0x1(%eax),%edx
+  805abd:	89 13                	mov    %edx,(%ebx)
+  805abf:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  805ac2:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  805ac6:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  805ac8:	83 ec 04             	sub    $0x4,%esp
+  805acb:	6a 18                	push   $0x18
+  805acd:	6a 00                	push   $0x0
+  805acf:	50                   	push   %eax
+  805ad0:	e8 a5 c3 ff ff       	call   801e7a <memset>
+	return 0;
+  805ad5:	83 c4 10             	add    $0x10,%esp
+  805ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805add:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805ae0:	5b                   	pop    %ebx
+  805ae1:	5e                   	pop    %esi
+  805ae2:	5d                   	pop    %ebp
+  805ae3:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  805ae4:	83 ec 0c             	sub    $0xc,%esp
+  805ae7:	50                   	push   %eax
+  805ae8:	e8 90 ff ff ff       	call   805a7d <pgbatch_flush>
+  805aed:	83 c4 10             	add    $0x10,%esp
+  805af0:	85 c0                	test   %eax,%eax
+  805af2:	79 c4                	jns    805ab8 <pgbatch_slot+0xe>
+  805af4:	eb e7                	jmp    805add <pgbatch_slot+0x33>
+
+00805af6 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  805af6:	55                   	push   %ebp
+  805af7:	89 e5                	mov    %esp,%ebp
+  805af9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805afc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805aff:	8b 45 08             	mov    0x8(%ebp),%eax
+  805b02:	e8 a3 ff ff ff       	call   805aaa <pgbatch_slot>
+  805b07:	85 c0                	test   %eax,%eax
+  805b09:	78 20                	js     805b2b <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  805b0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805b0e:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  805b14:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805b17:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  805b1a:	8b 55 10             	mov    0x10(%ebp),%edx
+  805b1d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  805b20:	8b 55 14             	mov    0x14(%ebp),%edx
+  805b23:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805b26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b2b:	c9                   	leave
+  805b2c:	c3                   	ret
+
+00805b2d <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  805b2d:	55                   	push   %ebp
+  805b2e:	89 e5                	mov    %esp,%ebp
+  805b30:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805b33:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  805b39:	e8 6c ff ff ff       	call   805aaa <pgbatch_slot>
+  805b3e:	85 c0                	test   %eax,%eax
+  805b40:	78 2c                	js     805b6e <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  805b42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805b45:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  805b4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805b4e:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  805b51:	8b 55 10             	mov    0x10(%ebp),%edx
+  805b54:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  805b57:	8b 55 14             	mov    0x14(%ebp),%edx
+  805b5a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  805b5d:	8b 55 18             	mov    0x18(%ebp),%edx
+  805b60:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  805b63:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  805b66:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805b69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b6e:	c9                   	leave
+  805b6f:	c3                   	ret
+
+00805b70 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  805b70:	55                   	push   %ebp
+  805b71:	89 e5                	mov    %esp,%ebp
+  805b73:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805b76:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805b79:	8b 45 08             	mov    0x8(%ebp),%eax
+  805b7c:	e8 29 ff ff ff       	call   805aaa <pgbatch_slot>
+  805b81:	85 c0                	test   %eax,%eax
+  805b83:	78 1a                	js     805b9f <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  805b85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805b88:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  805b8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805b91:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  805b94:	8b 55 10             	mov    0x10(%ebp),%edx
+  805b97:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  805b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b9f:	c9                   	leave
+  805ba0:	c3                   	ret
+
+00805ba1 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  805ba1:	55                   	push   %ebp
+  805ba2:	89 e5                	mov    %esp,%ebp
+  805ba4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805ba7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805baa:	8b 45 08             	mov    0x8(%ebp),%eax
+  805bad:	e8 f8 fe ff ff       	call   805aaa <pgbatch_slot>
+  805bb2:	85 c0                	test   %eax,%eax
+  805bb4:	78 20                	js     805bd6 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  805bb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805bb9:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  805bbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805bc2:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  805bc5:	8b 55 10             	mov    0x10(%ebp),%edx
+  805bc8:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  805bcb:	8b 55 14             	mov    0x14(%ebp),%edx
+  805bce:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805bd6:	c9                   	leave
+  805bd7:	c3                   	ret
+
+00805bd8 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  805bd8:	55                   	push   %ebp
+  805bd9:	89 e5                	mov    %esp,%ebp
+  805bdb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805bde:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805be1:	8b 45 08             	mov    0x8(%ebp),%eax
+  805be4:	e8 c1 fe ff ff       	call   805aaa <pgbatch_slot>
+  805be9:	85 c0                	test   %eax,%eax
+  805beb:	78 26                	js     805c13 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  805bed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805bf0:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  805bf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805bf9:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  805bfc:	8b 55 10             	mov    0x10(%ebp),%edx
+  805bff:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  805c02:	8b 55 14             	mov    0x14(%ebp),%edx
+  805c05:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  805c08:	8b 55 18             	mov    0x18(%ebp),%edx
+  805c0b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c13:	c9                   	leave
+  805c14:	c3                   	ret
+
+00805c15 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  805c15:	55                   	push   %ebp
+  805c16:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  805c18:	8b 45 08             	mov    0x8(%ebp),%eax
+  805c1b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  805c21:	5d                   	pop    %ebp
+  805c22:	c3                   	ret
+
+00805c23 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  805c23:	55                   	push   %ebp
+  805c24:	89 e5                	mov    %esp,%ebp
+  805c26:	56                   	push   %esi
+  805c27:	53                   	push   %ebx
+  805c28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  805c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c30:	ba 01 00 00 00       	mov    $0x1,%edx
+  805c35:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805c39:	85 c0                	test   %eax,%eax
+  805c3b:	74 2f                	je     805c6c <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  805c3d:	83 f8 02             	cmp    $0x2,%eax
+  805c40:	74 0c                	je     805c4e <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  805c42:	b8 02 00 00 00       	mov    $0x2,%eax
+  805c47:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  805c4a:	85 c0                	test   %eax,%eax
+  805c4c:	74 1e                	je     805c6c <mutex_lock+0x49>
+  805c4e:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  805c53:	83 ec 04             	sub    $0x4,%esp
+  805c56:	6a ff                	push   $0xffffffff
+  805c58:	6a 02                	push   $0x2
+  805c5a:	53                   	push   %ebx
+  805c5b:	e8 d1 c8 ff ff       	call   802531 <sys_futex_wait>
+  805c60:	89 f0                	mov    %esi,%eax
+  805c62:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  805c65:	83 c4 10             	add    $0x10,%esp
+  805c68:	85 c0                	test   %eax,%eax
+  805c6a:	75 e7                	jne    805c53 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  805c6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805c6f:	5b                   	pop    %ebx
+  805c70:	5e                   	pop    %esi
+  805c71:	5d                   	pop    %ebp
+  805c72:	c3                   	ret
+
+00805c73 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  805c73:	55                   	push   %ebp
+  805c74:	89 e5                	mov    %esp,%ebp
+  805c76:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  805c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c7e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  805c83:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  805c87:	85 c0                	test   %eax,%eax
+  805c89:	0f 94 c0             	sete   %al
+  805c8c:	0f b6 c0             	movzbl %al,%eax
+}
+  805c8f:	5d                   	pop    %ebp
+  805c90:	c3                   	ret
+
+00805c91 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  805c91:	55                   	push   %ebp
+  805c92:	89 e5                	mov    %esp,%ebp
+  805c94:	83 ec 08             	sub    $0x8,%esp
+  805c97:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  805c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c9f:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  805ca2:	83 f8 02             	cmp    $0x2,%eax
+  805ca5:	74 02                	je     805ca9 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  805ca7:	c9                   	leave
+  805ca8:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  805ca9:	83 ec 08             	sub    $0x8,%esp
+  805cac:	6a 01                	push   $0x1
+  805cae:	52                   	push   %edx
+  805caf:	e8 9f c8 ff ff       	call   802553 <sys_futex_wake>
+  805cb4:	83 c4 10             	add    $0x10,%esp
+}
+  805cb7:	eb ee                	jmp    805ca7 <mutex_unlock+0x16>
+
+00805cb9 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  805cb9:	55                   	push   %ebp
+  805cba:	89 e5                	mov    %esp,%ebp
+  805cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  805cbf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  805cc5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  805ccc:	5d                   	pop    %ebp
+  805ccd:	c3                   	ret
+
+00805cce <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  805cce:	55                   	push   %ebp
+  805ccf:	89 e5                	mov    %esp,%ebp
+  805cd1:	57                   	push   %edi
+  805cd2:	56                   	push   %esi
+  805cd3:	53                   	push   %ebx
+  805cd4:	83 ec 18             	sub    $0x18,%esp
+  805cd7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  805cda:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  805cdd:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  805cdf:	b8 01 00 00 00       	mov    $0x1,%eax
+  805ce4:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  805ce9:	57                   	push   %edi
+  805cea:	e8 a2 ff ff ff       	call   805c91 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  805cef:	83 c4 0c             	add    $0xc,%esp
+  805cf2:	ff 75 10             	push   0x10(%ebp)
+  805cf5:	56                   	push   %esi
+  805cf6:	53                   	push   %ebx
+  805cf7:	e8 35 c8 ff ff       	call   802531 <sys_futex_wait>
+  805cfc:	89 c6                	mov    %eax,%esi
+  805cfe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  805d03:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  805d08:	89 3c 24             	mov    %edi,(%esp)
+  805d0b:	e8 13 ff ff ff       	call   805c23 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  805d10:	83 c4 10             	add    $0x10,%esp
+  805d13:	83 fe ef             	cmp    $0xffffffef,%esi
+  805d16:	74 05                	je     805d1d <cond_timedwait+0x4f>
+  805d18:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  805d1d:	89 f0                	mov    %esi,%eax
+  805d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805d22:	5b                   	pop    %ebx
+  805d23:	5e                   	pop    %esi
+  805d24:	5f                   	pop    %edi
+  805d25:	5d                   	pop    %ebp
+  805d26:	c3                   	ret
+
+00805d27 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  805d27:	55                   	push   %ebp
+  805d28:	89 e5                	mov    %esp,%ebp
+  805d2a:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  805d2d:	6a ff                	push   $0xffffffff
+  805d2f:	ff 75 0c             	push   0xc(%ebp)
+  805d32:	ff 75 08             	push   0x8(%ebp)
+  805d35:	e8 94 ff ff ff       	call   805cce <cond_timedwait>
+}
+  805d3a:	83 c4 10             	add    $0x10,%esp
+  805d3d:	c9                   	leave
+  805d3e:	c3                   	ret
+
+00805d3f <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  805d3f:	55                   	push   %ebp
+  805d40:	89 e5                	mov    %esp,%ebp
+  805d42:	83 ec 08             	sub    $0x8,%esp
+  805d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  805d48:	ba 01 00 00 00       	mov    $0x1,%edx
+  805d4d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  805d51:	8b 50 04             	mov    0x4(%eax),%edx
+  805d54:	85 d2                	test   %edx,%edx
+  805d56:	75 02                	jne    805d5a <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  805d58:	c9                   	leave
+  805d59:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  805d5a:	83 ec 08             	sub    $0x8,%esp
+  805d5d:	6a 01                	push   $0x1
+  805d5f:	50                   	push   %eax
+  805d60:	e8 ee c7 ff ff       	call   802553 <sys_futex_wake>
+  805d65:	83 c4 10             	add    $0x10,%esp
+}
+  805d68:	eb ee                	jmp    805d58 <cond_signal+0x19>
+
+00805d6a <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  805d6a:	55                   	push   %ebp
+  805d6b:	89 e5                	mov    %esp,%ebp
+  805d6d:	83 ec 08             	sub    $0x8,%esp
+  805d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  805d73:	ba 01 00 00 00       	mov    $0x1,%edx
+  805d78:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  805d7c:	8b 50 04             	mov    0x4(%eax),%edx
+  805d7f:	85 d2                	test   %edx,%edx
+  805d81:	75 02                	jne    805d85 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  805d83:	c9                   	leave
+  805d84:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  805d85:	83 ec 08             	sub    $0x8,%esp
+  805d88:	68 00 04 00 00       	push   $0x400
+  805d8d:	50                   	push   %eax
+  805d8e:	e8 c0 c7 ff ff       	call   802553 <sys_futex_wake>
+  805d93:	83 c4 10             	add    $0x10,%esp
+}
+  805d96:	eb eb                	jmp    805d83 <cond_broadcast+0x19>
+
+00805d98 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  805d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d9d:	c3                   	ret
+
+00805d9e <devcons_poll>:
+{
+  805d9e:	55                   	push   %ebp
+  805d9f:	89 e5                	mov    %esp,%ebp
+  805da1:	53                   	push   %ebx
+  805da2:	83 ec 04             	sub    $0x4,%esp
+  805da5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  805da8:	89 da                	mov    %ebx,%edx
+  805daa:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  805dad:	83 3d 68 f8 80 00 00 	cmpl   $0x0,0x80f868
+  805db4:	74 0c                	je     805dc2 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  805db6:	89 d8                	mov    %ebx,%eax
+  805db8:	83 e0 01             	and    $0x1,%eax
+  805dbb:	09 d0                	or     %edx,%eax
+}
+  805dbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805dc0:	c9                   	leave
+  805dc1:	c3                   	ret
+		cons_peek = sys_cgetc();
+  805dc2:	e8 ce c2 ff ff       	call   802095 <sys_cgetc>
+  805dc7:	a3 68 f8 80 00       	mov    %eax,0x80f868
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  805dcc:	89 da                	mov    %ebx,%edx
+  805dce:	83 e2 04             	and    $0x4,%edx
+  805dd1:	85 c0                	test   %eax,%eax
+  805dd3:	74 e6                	je     805dbb <devcons_poll+0x1d>
+  805dd5:	eb df                	jmp    805db6 <devcons_poll+0x18>
+
+00805dd7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805dd7:	55                   	push   %ebp
+  805dd8:	89 e5                	mov    %esp,%ebp
+  805dda:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  805ddd:	68 8b 71 80 00       	push   $0x80718b
+  805de2:	ff 75 0c             	push   0xc(%ebp)
+  805de5:	e8 15 bf ff ff       	call   801cff <strcpy>
+	return 0;
+}
+  805dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  805def:	c9                   	leave
+  805df0:	c3                   	ret
+
+00805df1 <devcons_write>:
+{
+  805df1:	55                   	push   %ebp
+  805df2:	89 e5                	mov    %esp,%ebp
+  805df4:	57                   	push   %edi
+  805df5:	56                   	push   %esi
+  805df6:	53                   	push   %ebx
+  805df7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  805dfd:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  805e00:	85 ff                	test   %edi,%edi
+  805e02:	74 51                	je     805e55 <devcons_write+0x64>
+  805e04:	be 00 00 00 00       	mov    $0x0,%esi
+  805e09:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  805e0e:	89 fb                	mov    %edi,%ebx
+  805e10:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  805e12:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  805e17:	39 d3                	cmp    %edx,%ebx
+  805e19:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  805e1c:	83 ec 04             	sub    $0x4,%esp
+  805e1f:	53                   	push   %ebx
+  805e20:	03 45 0c             	add    0xc(%ebp),%eax
+  805e23:	50                   	push   %eax
+  805e24:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  805e2a:	50                   	push   %eax
+  805e2b:	e8 7f c0 ff ff       	call   801eaf <memmove>
+		sys_cputs(buf, m);
+  805e30:	83 c4 08             	add    $0x8,%esp
+  805e33:	53                   	push   %ebx
+  805e34:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  805e3a:	50                   	push   %eax
+  805e3b:	e8 37 c2 ff ff       	call   802077 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  805e40:	01 de                	add    %ebx,%esi
+  805e42:	89 f0                	mov    %esi,%eax
+  805e44:	83 c4 10             	add    $0x10,%esp
+  805e47:	39 fe                	cmp    %edi,%esi
+  805e49:	72 c3                	jb     805e0e <devcons_write+0x1d>
+}
+  805e4b:	89 f0                	mov    %esi,%eax
+  805e4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805e50:	5b                   	pop    %ebx
+  805e51:	5e                   	pop    %esi
+  805e52:	5f                   	pop    %edi
+  805e53:	5d                   	pop    %ebp
+  805e54:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  805e55:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  805e5a:	eb ef                	jmp    805e4b <devcons_write+0x5a>
+
+00805e5c <devcons_read>:
+{
+  805e5c:	55                   	push   %ebp
+  805e5d:	89 e5                	mov    %esp,%ebp
+  805e5f:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  805e62:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  805e67:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  805e6b:	74 36                	je     805ea3 <devcons_read+0x47>
+	c = cons_peek;
+  805e6d:	a1 68 f8 80 00       	mov    0x80f868,%eax
+	cons_peek = 0;
+  805e72:	c7 05 68 f8 80 00 00 	movl   $0x0,0x80f868
+  805e79:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  805e7c:	85 c0                	test   %eax,%eax
+  805e7e:	75 10                	jne    805e90 <devcons_read+0x34>
+  805e80:	e8 10 c2 ff ff       	call   802095 <sys_cgetc>
+  805e85:	85 c0                	test   %eax,%eax
+  805e87:	75 07                	jne    805e90 <devcons_read+0x34>
+		sys_yield();
+  805e89:	e8 86 c2 ff ff       	call   802114 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  805e8e:	eb f0                	jmp    805e80 <devcons_read+0x24>
+	if (c < 0)
+  805e90:	85 c0                	test   %eax,%eax
+  805e92:	78 0f                	js     805ea3 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  805e94:	83 f8 04             	cmp    $0x4,%eax
+  805e97:	74 0c                	je     805ea5 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  805e99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805e9c:	88 02                	mov    %al,(%edx)
+	return 1;
+  805e9e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805ea3:	c9                   	leave
+  805ea4:	c3                   	ret
+		return 0;
+  805ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805eaa:	eb f7                	jmp    805ea3 <devcons_read+0x47>
+
+00805eac <cputchar>:
+{
+  805eac:	55                   	push   %ebp
+  805ead:	89 e5                	mov    %esp,%ebp
+  805eaf:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  805eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  805eb5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  805eb8:	6a 01                	push   $0x1
+  805eba:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805ebd:	50                   	push   %eax
+  805ebe:	e8 b4 c1 ff ff       	call   802077 <sys_cputs>
+}
+  805ec3:	83 c4 10             	add    $0x10,%esp
+  805ec6:	c9                   	leave
+  805ec7:	c3                   	ret
+
+00805ec8 <getchar>:
+{
+  805ec8:	55                   	push   %ebp
+  805ec9:	89 e5                	mov    %esp,%ebp
+  805ecb:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  805ece:	6a 01                	push   $0x1
+  805ed0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805ed3:	50                   	push   %eax
+  805ed4:	6a 00                	push   $0x0
+  805ed6:	e8 81 d2 ff ff       	call   80315c <read>
+	if (r < 0)
+  805edb:	83 c4 10             	add    $0x10,%esp
+  805ede:	85 c0                	test   %eax,%eax
+  805ee0:	78 06                	js     805ee8 <getchar+0x20>
+	if (r < 1)
+  805ee2:	74 06                	je     805eea <getchar+0x22>
+	return c;
+  805ee4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  805ee8:	c9                   	leave
+  805ee9:	c3                   	ret
+		return -E_EOF;
+  805eea:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  805eef:	eb f7                	jmp    805ee8 <getchar+0x20>
+
+00805ef1 <iscons>:
+{
+  805ef1:	55                   	push   %ebp
+  805ef2:	89 e5                	mov    %esp,%ebp
+  805ef4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805ef7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805efa:	50                   	push   %eax
+  805efb:	ff 75 08             	push   0x8(%ebp)
+  805efe:	e8 d5 cf ff ff       	call   802ed8 <fd_lookup>
+  805f03:	83 c4 10             	add    $0x10,%esp
+  805f06:	85 c0                	test   %eax,%eax
+  805f08:	78 11                	js     805f1b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  805f0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805f0d:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  805f13:	39 10                	cmp    %edx,(%eax)
+  805f15:	0f 94 c0             	sete   %al
+  805f18:	0f b6 c0             	movzbl %al,%eax
+}
+  805f1b:	c9                   	leave
+  805f1c:	c3                   	ret
+
+00805f1d <opencons>:
+{
+  805f1d:	55                   	push   %ebp
+  805f1e:	89 e5                	mov    %esp,%ebp
+  805f20:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  805f23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805f26:	50                   	push   %eax
+  805f27:	e8 5c cf ff ff       	call   802e88 <fd_alloc>
+  805f2c:	83 c4 10             	add    $0x10,%esp
+  805f2f:	85 c0                	test   %eax,%eax
+  805f31:	78 3a                	js     805f6d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805f33:	83 ec 04             	sub    $0x4,%esp
+  805f36:	68 07 04 00 00       	push   $0x407
+  805f3b:	ff 75 f4             	push   -0xc(%ebp)
+  805f3e:	6a 00                	push   $0x0
+  805f40:	e8 ee c1 ff ff       	call   802133 <sys_page_alloc>
+  805f45:	83 c4 10             	add    $0x10,%esp
+  805f48:	85 c0                	test   %eax,%eax
+  805f4a:	78 21                	js     805f6d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  805f4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805f4f:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  805f55:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  805f57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805f5a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  805f61:	83 ec 0c             	sub    $0xc,%esp
+  805f64:	50                   	push   %eax
+  805f65:	e8 f7 ce ff ff       	call   802e61 <fd2num>
+  805f6a:	83 c4 10             	add    $0x10,%esp
+}
+  805f6d:	c9                   	leave
+  805f6e:	c3                   	ret
+
+00805f6f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  805f6f:	55                   	push   %ebp
+  805f70:	89 e5                	mov    %esp,%ebp
+  805f72:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  805f75:	83 3d 04 20 81 00 00 	cmpl   $0x0,0x812004
+  805f7c:	74 0a                	je     805f88 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  805f7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  805f81:	a3 04 20 81 00       	mov    %eax,0x812004
+}
+  805f86:	c9                   	leave
+  805f87:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  805f88:	83 ec 04             	sub    $0x4,%esp
+  805f8b:	6a 07                	push   $0x7
+  805f8d:	68 00 f0 bf ee       	push   $0xeebff000
+  805f92:	6a 00                	push   $0x0
+  805f94:	e8 9a c1 ff ff       	call   802133 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805f99:	83 c4 08             	add    $0x8,%esp
+  805f9c:	68 ad 5f 80 00       	push   $0x805fad
+  805fa1:	6a 00                	push   $0x0
+  805fa3:	e8 d6 c2 ff ff       	call   80227e <sys_env_set_pgfault_upcall>
+  805fa8:	83 c4 10             	add    $0x10,%esp
+  805fab:	eb d1                	jmp    805f7e <set_pgfault_handler+0xf>
+
+00805fad <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805fad:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805fae:	a1 04 20 81 00       	mov    0x812004,%eax
+	call *%eax
+  805fb3:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805fb5:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  805fb8:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  805fbc:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  805fbf:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  805fc3:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  805fc5:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  805fc9:	83 c4 08             	add    $0x8,%esp
+	popal;
+  805fcc:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  805fcd:	83 c4 04             	add    $0x4,%esp
+	popf
+  805fd0:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  805fd1:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  805fd2:	c3                   	ret
+
+00805fd3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805fd3:	55                   	push   %ebp
+  805fd4:	89 e5                	mov    %esp,%ebp
+  805fd6:	56                   	push   %esi
+  805fd7:	53                   	push   %ebx
+  805fd8:	8b 75 08             	mov    0x8(%ebp),%esi
+  805fdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805fde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  805fe1:	85 c0                	test   %eax,%eax
+  805fe3:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  805fe8:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  805feb:	83 ec 0c             	sub    $0xc,%esp
+  805fee:	50                   	push   %eax
+  805fef:	e8 ef c2 ff ff       	call   8022e3 <sys_ipc_recv>
+  805ff4:	83 c4 10             	add    $0x10,%esp
+  805ff7:	85 c0                	test   %eax,%eax
+  805ff9:	0f 88 8b 00 00 00    	js     80608a <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  805fff:	85 f6                	test   %esi,%esi
+  806001:	74 2a                	je     80602d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  806003:	89 e2                	mov    %esp,%edx
+  806005:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80600a:	29 d0                	sub    %edx,%eax
+  80600c:	89 c2                	mov    %eax,%edx
+  80600e:	c1 ea 0f             	shr    $0xf,%edx
+  806011:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  806016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80601b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80601e:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  806025:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80602b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80602d:	85 db                	test   %ebx,%ebx
+  80602f:	74 2a                	je     80605b <ipc_recv+0x88>
+  806031:	89 e2                	mov    %esp,%edx
+  806033:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  806038:	29 d0                	sub    %edx,%eax
+  80603a:	89 c2                	mov    %eax,%edx
+  80603c:	c1 ea 0f             	shr    $0xf,%edx
+  80603f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  806044:	b8 00 00 00 00       	mov    $0x0,%eax
+  806049:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80604c:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  806053:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  806059:	89 03                	mov    %eax,(%ebx)
+  80605b:	89 e2                	mov    %esp,%edx
+  80605d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  806062:	29 d0                	sub    %edx,%eax
+  806064:	89 c2                	mov    %eax,%edx
+  806066:	c1 ea 0f             	shr    $0xf,%edx
+  806069:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80606e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806073:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  806076:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  80607d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  806083:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806086:	5b                   	pop    %ebx
+  806087:	5e                   	pop    %esi
+  806088:	5d                   	pop    %ebp
+  806089:	c3                   	ret
+		if(from_env_store != NULL)
+  80608a:	85 f6                	test   %esi,%esi
+  80608c:	74 06                	je     806094 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80608e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  806094:	85 db                	test   %ebx,%ebx
+  806096:	74 eb                	je     806083 <ipc_recv+0xb0>
+			*perm_store = 0;
+  806098:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80609e:	eb e3                	jmp    806083 <ipc_recv+0xb0>
+
+008060a0 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8060a0:	55                   	push   %ebp
+  8060a1:	89 e5                	mov    %esp,%ebp
+  8060a3:	57                   	push   %edi
+  8060a4:	56                   	push   %esi
+  8060a5:	53                   	push   %ebx
+  8060a6:	83 ec 14             	sub    $0x14,%esp
+  8060a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8060ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8060af:	8b 75 14             	mov    0x14(%ebp),%esi
+  8060b2:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8060b5:	85 c0                	test   %eax,%eax
+  8060b7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8060bc:	0f 44 c2             	cmove  %edx,%eax
+  8060bf:	ff 75 10             	push   0x10(%ebp)
+  8060c2:	50                   	push   %eax
+  8060c3:	e8 7d c2 ff ff       	call   802345 <sys_ipc_recv_pages>
+  8060c8:	83 c4 10             	add    $0x10,%esp
+  8060cb:	85 c0                	test   %eax,%eax
+  8060cd:	0f 88 ba 00 00 00    	js     80618d <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8060d3:	85 ff                	test   %edi,%edi
+  8060d5:	74 2a                	je     806101 <ipc_recv_pages+0x61>
+  8060d7:	89 e2                	mov    %esp,%edx
+  8060d9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8060de:	29 d0                	sub    %edx,%eax
+  8060e0:	89 c2                	mov    %eax,%edx
+  8060e2:	c1 ea 0f             	shr    $0xf,%edx
+  8060e5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8060ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060ef:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8060f2:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  8060f9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8060ff:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  806101:	85 f6                	test   %esi,%esi
+  806103:	74 2a                	je     80612f <ipc_recv_pages+0x8f>
+  806105:	89 e2                	mov    %esp,%edx
+  806107:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80610c:	29 d0                	sub    %edx,%eax
+  80610e:	89 c2                	mov    %eax,%edx
+  806110:	c1 ea 0f             	shr    $0xf,%edx
+  806113:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  806118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80611d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  806120:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  806127:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80612d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80612f:	85 db                	test   %ebx,%ebx
+  806131:	74 2a                	je     80615d <ipc_recv_pages+0xbd>
+  806133:	89 e2                	mov    %esp,%edx
+  806135:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80613a:	29 d0                	sub    %edx,%eax
+  80613c:	89 c2                	mov    %eax,%edx
+  80613e:	c1 ea 0f             	shr    $0xf,%edx
+  806141:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  806146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80614b:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80614e:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  806155:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80615b:	89 03                	mov    %eax,(%ebx)
+  80615d:	89 e2                	mov    %esp,%edx
+  80615f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  806164:	29 d0                	sub    %edx,%eax
+  806166:	89 c2                	mov    %eax,%edx
+  806168:	c1 ea 0f             	shr    $0xf,%edx
+  80616b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  806170:	b8 00 00 00 00       	mov    $0x0,%eax
+  806175:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  806178:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  80617f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  806185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806188:	5b                   	pop    %ebx
+  806189:	5e                   	pop    %esi
+  80618a:	5f                   	pop    %edi
+  80618b:	5d                   	pop    %ebp
+  80618c:	c3                   	ret
+		if (from_env_store)
+  80618d:	85 ff                	test   %edi,%edi
+  80618f:	74 06                	je     806197 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  806191:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  806197:	85 f6                	test   %esi,%esi
+  806199:	74 06                	je     8061a1 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80619b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8061a1:	85 db                	test   %ebx,%ebx
+  8061a3:	74 e0                	je     806185 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8061a5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8061ab:	eb d8                	jmp    806185 <ipc_recv_pages+0xe5>
+
+008061ad <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8061ad:	55                   	push   %ebp
+  8061ae:	89 e5                	mov    %esp,%ebp
+  8061b0:	57                   	push   %edi
+  8061b1:	56                   	push   %esi
+  8061b2:	53                   	push   %ebx
+  8061b3:	83 ec 1c             	sub    $0x1c,%esp
+  8061b6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8061b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8061bc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8061c2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8061c6:	75 2b                	jne    8061f3 <ipc_try_send_pages+0x46>
+  8061c8:	89 e2                	mov    %esp,%edx
+  8061ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8061cf:	29 d0                	sub    %edx,%eax
+  8061d1:	89 c2                	mov    %eax,%edx
+  8061d3:	c1 ea 0f             	shr    $0xf,%edx
+  8061d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8061db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061e0:	0f 42 c2             	cmovb  %edx,%eax
+  8061e3:	8b 04 85 80 f8 80 00 	mov    0x80f880(,%eax,4),%eax
+  8061ea:	8b 70 48             	mov    0x48(%eax),%esi
+  8061ed:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8061f3:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8061f9:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8061fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  806201:	85 ff                	test   %edi,%edi
+  806203:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  806208:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80620b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  806211:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  806217:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80621d:	83 ec 0c             	sub    $0xc,%esp
+  806220:	ff 75 14             	push   0x14(%ebp)
+  806223:	ff 75 18             	push   0x18(%ebp)
+  806226:	57                   	push   %edi
+  806227:	ff 75 0c             	push   0xc(%ebp)
+  80622a:	ff 75 08             	push   0x8(%ebp)
+  80622d:	e8 f2 c0 ff ff       	call   802324 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  806232:	83 c4 20             	add    $0x20,%esp
+  806235:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  806238:	75 21                	jne    80625b <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80623a:	83 ec 04             	sub    $0x4,%esp
+  80623d:	6a ff                	push   $0xffffffff
+  80623f:	53                   	push   %ebx
+  806240:	ff 75 e4             	push   -0x1c(%ebp)
+  806243:	e8 e9 c2 ff ff       	call   802531 <sys_futex_wait>
+  806248:	83 c4 10             	add    $0x10,%esp
+  80624b:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80624e:	74 c7                	je     806217 <ipc_try_send_pages+0x6a>
+  806250:	85 c0                	test   %eax,%eax
+  806252:	79 c3                	jns    806217 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  806254:	e8 bb be ff ff       	call   802114 <sys_yield>
+  806259:	eb bc                	jmp    806217 <ipc_try_send_pages+0x6a>
+	}
+}
+  80625b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80625e:	5b                   	pop    %ebx
+  80625f:	5e                   	pop    %esi
+  806260:	5f                   	pop    %edi
+  806261:	5d                   	pop    %ebp
+  806262:	c3                   	ret
+
+00806263 <ipc_send>:
+{
+  806263:	55                   	push   %ebp
+  806264:	89 e5                	mov    %esp,%ebp
+  806266:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  806269:	ff 75 14             	push   0x14(%ebp)
+  80626c:	6a 01                	push   $0x1
+  80626e:	ff 75 10             	push   0x10(%ebp)
+  806271:	ff 75 0c             	push   0xc(%ebp)
+  806274:	ff 75 08             	push   0x8(%ebp)
+  806277:	e8 31 ff ff ff       	call   8061ad <ipc_try_send_pages>
+  80627c:	83 c4 20             	add    $0x20,%esp
+  80627f:	85 c0                	test   %eax,%eax
+  806281:	78 02                	js     806285 <ipc_send+0x22>
+}
+  806283:	c9                   	leave
+  806284:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  806285:	50                   	push   %eax
+  806286:	68 97 71 80 00       	push   $0x807197
+  80628b:	6a 3f                	push   $0x3f
+  80628d:	68 ac 71 80 00       	push   $0x8071ac
+  806292:	e8 96 b2 ff ff       	call   80152d <_panic>
+
+00806297 <ipc_send_pages>:
+{
+  806297:	55                   	push   %ebp
+  806298:	89 e5                	mov    %esp,%ebp
+  80629a:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80629d:	ff 75 18             	push   0x18(%ebp)
+  8062a0:	ff 75 14             	push   0x14(%ebp)
+  8062a3:	ff 75 10             	push   0x10(%ebp)
+  8062a6:	ff 75 0c             	push   0xc(%ebp)
+  8062a9:	ff 75 08             	push   0x8(%ebp)
+  8062ac:	e8 fc fe ff ff       	call   8061ad <ipc_try_send_pages>
+  8062b1:	83 c4 20             	add    $0x20,%esp
+  8062b4:	85 c0                	test   %eax,%eax
+  8062b6:	78 02                	js     8062ba <ipc_send_pages+0x23>
+}
+  8062b8:	c9                   	leave
+  8062b9:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8062ba:	50                   	push   %eax
+  8062bb:	68 b6 71 80 00       	push   $0x8071b6
+  8062c0:	6a 64                	push   $0x64
+  8062c2:	68 ac 71 80 00       	push   $0x8071ac
+  8062c7:	e8 61 b2 ff ff       	call   80152d <_panic>
+
+008062cc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8062cc:	55                   	push   %ebp
+  8062cd:	89 e5                	mov    %esp,%ebp
+  8062cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8062d2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8062d7:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8062dd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8062e3:	8b 52 50             	mov    0x50(%edx),%edx
+  8062e6:	39 ca                	cmp    %ecx,%edx
+  8062e8:	74 11                	je     8062fb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8062ea:	83 c0 01             	add    $0x1,%eax
+  8062ed:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8062f2:	75 e3                	jne    8062d7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8062f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062f9:	eb 0e                	jmp    806309 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8062fb:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  806301:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  806306:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  806309:	5d                   	pop    %ebp
+  80630a:	c3                   	ret
+
+0080630b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80630b:	55                   	push   %ebp
+  80630c:	89 e5                	mov    %esp,%ebp
+  80630e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  806311:	89 c2                	mov    %eax,%edx
+  806313:	c1 ea 16             	shr    $0x16,%edx
+  806316:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80631d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  806322:	f6 c1 01             	test   $0x1,%cl
+  806325:	74 1e                	je     806345 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  806327:	c1 e8 0c             	shr    $0xc,%eax
+  80632a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  806331:	a8 01                	test   $0x1,%al
+  806333:	74 10                	je     806345 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  806335:	c1 e8 0c             	shr    $0xc,%eax
+  806338:	c1 e0 04             	shl    $0x4,%eax
+  80633b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  806342:	0f b7 d2             	movzwl %dx,%edx
+}
+  806345:	89 d0                	mov    %edx,%eax
+  806347:	5d                   	pop    %ebp
+  806348:	c3                   	ret
+
+00806349 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  806349:	55                   	push   %ebp
+  80634a:	89 e5                	mov    %esp,%ebp
+  80634c:	57                   	push   %edi
+  80634d:	56                   	push   %esi
+  80634e:	53                   	push   %ebx
+  80634f:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  806352:	8b 45 08             	mov    0x8(%ebp),%eax
+  806355:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  806358:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  80635b:	bf 6c f8 80 00       	mov    $0x80f86c,%edi
+  806360:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  806363:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806368:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80636b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  80636e:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  806373:	f6 e2                	mul    %dl
+  806375:	66 c1 e8 0b          	shr    $0xb,%ax
+  806379:	89 c7                	mov    %eax,%edi
+  80637b:	88 45 e0             	mov    %al,-0x20(%ebp)
+  80637e:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  806381:	01 db                	add    %ebx,%ebx
+  806383:	89 d0                	mov    %edx,%eax
+  806385:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  806387:	89 d6                	mov    %edx,%esi
+  806389:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  80638b:	89 cb                	mov    %ecx,%ebx
+  80638d:	83 c1 01             	add    $0x1,%ecx
+  806390:	0f b6 fb             	movzbl %bl,%edi
+  806393:	83 c0 30             	add    $0x30,%eax
+  806396:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  80639a:	89 f0                	mov    %esi,%eax
+  80639c:	3c 09                	cmp    $0x9,%al
+  80639e:	77 ce                	ja     80636e <inet_ntoa+0x25>
+  8063a0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8063a3:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8063a6:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  8063a8:	84 c9                	test   %cl,%cl
+  8063aa:	74 4d                	je     8063f9 <inet_ntoa+0xb0>
+  8063ac:	0f b6 db             	movzbl %bl,%ebx
+  8063af:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  8063b2:	01 d8                	add    %ebx,%eax
+  8063b4:	89 f9                	mov    %edi,%ecx
+  8063b6:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  8063b9:	83 c1 01             	add    $0x1,%ecx
+  8063bc:	0f b6 10             	movzbl (%eax),%edx
+  8063bf:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  8063c2:	89 c2                	mov    %eax,%edx
+  8063c4:	83 e8 01             	sub    $0x1,%eax
+  8063c7:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  8063ca:	39 da                	cmp    %ebx,%edx
+  8063cc:	75 eb                	jne    8063b9 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  8063ce:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8063d1:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  8063d5:	8d 78 01             	lea    0x1(%eax),%edi
+  8063d8:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  8063db:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  8063de:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8063e1:	39 ce                	cmp    %ecx,%esi
+  8063e3:	0f 85 77 ff ff ff    	jne    806360 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  8063e9:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  8063ec:	b8 6c f8 80 00       	mov    $0x80f86c,%eax
+  8063f1:	83 c4 1c             	add    $0x1c,%esp
+  8063f4:	5b                   	pop    %ebx
+  8063f5:	5e                   	pop    %esi
+  8063f6:	5f                   	pop    %edi
+  8063f7:	5d                   	pop    %ebp
+  8063f8:	c3                   	ret
+    while(i--)
+  8063f9:	89 f8                	mov    %edi,%eax
+  8063fb:	eb d8                	jmp    8063d5 <inet_ntoa+0x8c>
+
+008063fd <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8063fd:	55                   	push   %ebp
+  8063fe:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  806400:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  806404:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  806408:	5d                   	pop    %ebp
+  806409:	c3                   	ret
+
+0080640a <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80640a:	55                   	push   %ebp
+  80640b:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80640d:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  806411:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  806415:	5d                   	pop    %ebp
+  806416:	c3                   	ret
+
+00806417 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  806417:	55                   	push   %ebp
+  806418:	89 e5                	mov    %esp,%ebp
+  80641a:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80641d:	89 d0                	mov    %edx,%eax
+  80641f:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  806422:	89 d1                	mov    %edx,%ecx
+  806424:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  806427:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  806429:	89 d1                	mov    %edx,%ecx
+  80642b:	c1 e1 08             	shl    $0x8,%ecx
+  80642e:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  806434:	09 c8                	or     %ecx,%eax
+  806436:	c1 ea 08             	shr    $0x8,%edx
+  806439:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  80643f:	09 d0                	or     %edx,%eax
+}
+  806441:	5d                   	pop    %ebp
+  806442:	c3                   	ret
+
+00806443 <inet_aton>:
+{
+  806443:	55                   	push   %ebp
+  806444:	89 e5                	mov    %esp,%ebp
+  806446:	57                   	push   %edi
+  806447:	56                   	push   %esi
+  806448:	53                   	push   %ebx
+  806449:	83 ec 2c             	sub    $0x2c,%esp
+  80644c:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  80644f:	0f b6 0a             	movzbl (%edx),%ecx
+  806452:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  806455:	83 e9 30             	sub    $0x30,%ecx
+  806458:	80 f9 09             	cmp    $0x9,%cl
+  80645b:	0f 87 b6 01 00 00    	ja     806617 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  806461:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  806464:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  806467:	e9 aa 00 00 00       	jmp    806516 <inet_aton+0xd3>
+      c = *++cp;
+  80646c:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  806470:	89 c1                	mov    %eax,%ecx
+  806472:	83 e1 df             	and    $0xffffffdf,%ecx
+  806475:	80 f9 58             	cmp    $0x58,%cl
+  806478:	74 10                	je     80648a <inet_aton+0x47>
+      c = *++cp;
+  80647a:	83 c2 01             	add    $0x1,%edx
+  80647d:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  806480:	bf 08 00 00 00       	mov    $0x8,%edi
+  806485:	e9 9a 00 00 00       	jmp    806524 <inet_aton+0xe1>
+        c = *++cp;
+  80648a:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  80648e:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  806491:	bf 10 00 00 00       	mov    $0x10,%edi
+  806496:	e9 89 00 00 00       	jmp    806524 <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  80649b:	0f af d7             	imul   %edi,%edx
+  80649e:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  8064a2:	0f be 01             	movsbl (%ecx),%eax
+  8064a5:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  8064a8:	88 45 d7             	mov    %al,-0x29(%ebp)
+  8064ab:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  8064ae:	80 fb 09             	cmp    $0x9,%bl
+  8064b1:	76 e8                	jbe    80649b <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  8064b3:	83 ff 10             	cmp    $0x10,%edi
+  8064b6:	75 2e                	jne    8064e6 <inet_aton+0xa3>
+  8064b8:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  8064bc:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  8064bf:	83 e3 df             	and    $0xffffffdf,%ebx
+  8064c2:	83 eb 41             	sub    $0x41,%ebx
+  8064c5:	80 fb 05             	cmp    $0x5,%bl
+  8064c8:	77 1c                	ja     8064e6 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  8064ca:	c1 e2 04             	shl    $0x4,%edx
+  8064cd:	83 c0 0a             	add    $0xa,%eax
+  8064d0:	89 f3                	mov    %esi,%ebx
+  8064d2:	80 fb 1a             	cmp    $0x1a,%bl
+  8064d5:	19 db                	sbb    %ebx,%ebx
+  8064d7:	83 e3 20             	and    $0x20,%ebx
+  8064da:	83 c3 41             	add    $0x41,%ebx
+  8064dd:	29 d8                	sub    %ebx,%eax
+  8064df:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  8064e1:	0f be 01             	movsbl (%ecx),%eax
+  8064e4:	eb bf                	jmp    8064a5 <inet_aton+0x62>
+    if (c == '.') {
+  8064e6:	83 f8 2e             	cmp    $0x2e,%eax
+  8064e9:	75 46                	jne    806531 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  8064eb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8064ee:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8064f1:	39 f0                	cmp    %esi,%eax
+  8064f3:	0f 84 25 01 00 00    	je     80661e <inet_aton+0x1db>
+      *pp++ = val;
+  8064f9:	83 c0 04             	add    $0x4,%eax
+  8064fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8064ff:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  806502:	89 ca                	mov    %ecx,%edx
+  806504:	0f b6 09             	movzbl (%ecx),%ecx
+  806507:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  80650a:	83 e9 30             	sub    $0x30,%ecx
+  80650d:	80 f9 09             	cmp    $0x9,%cl
+  806510:	0f 87 17 01 00 00    	ja     80662d <inet_aton+0x1ea>
+    base = 10;
+  806516:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80651b:	83 f8 30             	cmp    $0x30,%eax
+  80651e:	0f 84 48 ff ff ff    	je     80646c <inet_aton+0x29>
+  806524:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  806527:	ba 00 00 00 00       	mov    $0x0,%edx
+  80652c:	e9 77 ff ff ff       	jmp    8064a8 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  806531:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  806535:	89 d6                	mov    %edx,%esi
+  806537:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80653a:	85 c0                	test   %eax,%eax
+  80653c:	74 2e                	je     80656c <inet_aton+0x129>
+    return (0);
+  80653e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  806543:	89 fa                	mov    %edi,%edx
+  806545:	80 fa 1f             	cmp    $0x1f,%dl
+  806548:	0f 86 d5 00 00 00    	jbe    806623 <inet_aton+0x1e0>
+  80654e:	84 c0                	test   %al,%al
+  806550:	0f 88 cd 00 00 00    	js     806623 <inet_aton+0x1e0>
+  806556:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  806559:	83 f9 04             	cmp    $0x4,%ecx
+  80655c:	76 0e                	jbe    80656c <inet_aton+0x129>
+    return (0);
+  80655e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  806563:	83 f8 20             	cmp    $0x20,%eax
+  806566:	0f 85 b7 00 00 00    	jne    806623 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  80656c:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  80656f:	89 d8                	mov    %ebx,%eax
+  806571:	29 c8                	sub    %ecx,%eax
+  806573:	c1 f8 02             	sar    $0x2,%eax
+  806576:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  806579:	83 f8 02             	cmp    $0x2,%eax
+  80657c:	74 7a                	je     8065f8 <inet_aton+0x1b5>
+  80657e:	83 f9 03             	cmp    $0x3,%ecx
+  806581:	7f 49                	jg     8065cc <inet_aton+0x189>
+  806583:	85 c9                	test   %ecx,%ecx
+  806585:	0f 84 98 00 00 00    	je     806623 <inet_aton+0x1e0>
+  80658b:	83 f9 02             	cmp    $0x2,%ecx
+  80658e:	75 19                	jne    8065a9 <inet_aton+0x166>
+      return (0);
+  806590:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  806595:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80659b:	0f 87 82 00 00 00    	ja     806623 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  8065a1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8065a4:	c1 e0 18             	shl    $0x18,%eax
+  8065a7:	09 c6                	or     %eax,%esi
+  return (1);
+  8065a9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  8065ae:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8065b2:	74 6f                	je     806623 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  8065b4:	83 ec 0c             	sub    $0xc,%esp
+  8065b7:	56                   	push   %esi
+  8065b8:	e8 5a fe ff ff       	call   806417 <htonl>
+  8065bd:	83 c4 10             	add    $0x10,%esp
+  8065c0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8065c3:	89 06                	mov    %eax,(%esi)
+  return (1);
+  8065c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8065ca:	eb 57                	jmp    806623 <inet_aton+0x1e0>
+  switch (n) {
+  8065cc:	83 f9 04             	cmp    $0x4,%ecx
+  8065cf:	75 d8                	jne    8065a9 <inet_aton+0x166>
+      return (0);
+  8065d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  8065d6:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  8065dc:	77 45                	ja     806623 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  8065de:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8065e1:	c1 e0 18             	shl    $0x18,%eax
+  8065e4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8065e7:	c1 e1 10             	shl    $0x10,%ecx
+  8065ea:	09 c8                	or     %ecx,%eax
+  8065ec:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8065ef:	c1 e1 08             	shl    $0x8,%ecx
+  8065f2:	09 c8                	or     %ecx,%eax
+  8065f4:	09 c6                	or     %eax,%esi
+    break;
+  8065f6:	eb b1                	jmp    8065a9 <inet_aton+0x166>
+      return (0);
+  8065f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  8065fd:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  806603:	77 1e                	ja     806623 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  806605:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  806608:	c1 e0 18             	shl    $0x18,%eax
+  80660b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80660e:	c1 e1 10             	shl    $0x10,%ecx
+  806611:	09 c8                	or     %ecx,%eax
+  806613:	09 c6                	or     %eax,%esi
+    break;
+  806615:	eb 92                	jmp    8065a9 <inet_aton+0x166>
+      return (0);
+  806617:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80661c:	eb 05                	jmp    806623 <inet_aton+0x1e0>
+        return (0);
+  80661e:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  806623:	89 c8                	mov    %ecx,%eax
+  806625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806628:	5b                   	pop    %ebx
+  806629:	5e                   	pop    %esi
+  80662a:	5f                   	pop    %edi
+  80662b:	5d                   	pop    %ebp
+  80662c:	c3                   	ret
+      return (0);
+  80662d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806632:	eb ef                	jmp    806623 <inet_aton+0x1e0>
+
+00806634 <inet_addr>:
+{
+  806634:	55                   	push   %ebp
+  806635:	89 e5                	mov    %esp,%ebp
+  806637:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  80663a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80663d:	50                   	push   %eax
+  80663e:	ff 75 08             	push   0x8(%ebp)
+  806641:	e8 fd fd ff ff       	call   806443 <inet_aton>
+  806646:	89 c2                	mov    %eax,%edx
+  806648:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  80664b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  806650:	85 d2                	test   %edx,%edx
+  806652:	75 02                	jne    806656 <inet_addr+0x22>
+}
+  806654:	c9                   	leave
+  806655:	c3                   	ret
+    return (val.s_addr);
+  806656:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  806659:	eb f9                	jmp    806654 <inet_addr+0x20>
+
+0080665b <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  80665b:	55                   	push   %ebp
+  80665c:	89 e5                	mov    %esp,%ebp
+  80665e:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  806661:	ff 75 08             	push   0x8(%ebp)
+  806664:	e8 ae fd ff ff       	call   806417 <htonl>
+  806669:	83 c4 10             	add    $0x10,%esp
+}
+  80666c:	c9                   	leave
+  80666d:	c3                   	ret
+
+0080666e <__udivdi3>:
+  80666e:	57                   	push   %edi
+  80666f:	56                   	push   %esi
+  806670:	53                   	push   %ebx
+  806671:	83 ec 20             	sub    $0x20,%esp
+  806674:	8b 44 24 30          	mov    0x30(%esp),%eax
+  806678:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80667c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  806680:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  806684:	8b 44 24 38          	mov    0x38(%esp),%eax
+  806688:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80668c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  806690:	89 54 24 14          	mov    %edx,0x14(%esp)
+  806694:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  806699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80669e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8066a3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8066aa:	00 
+  8066ab:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8066b2:	00 
+  8066b3:	eb 08                	jmp    8066bd <__udivdi3+0x4f>
+  8066b5:	83 e9 01             	sub    $0x1,%ecx
+  8066b8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8066bb:	74 68                	je     806725 <__udivdi3+0xb7>
+  8066bd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8066c1:	01 c0                	add    %eax,%eax
+  8066c3:	89 c6                	mov    %eax,%esi
+  8066c5:	89 d7                	mov    %edx,%edi
+  8066c7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8066cb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8066cf:	0f ad d0             	shrd   %cl,%edx,%eax
+  8066d2:	d3 ea                	shr    %cl,%edx
+  8066d4:	f6 c1 20             	test   $0x20,%cl
+  8066d7:	74 04                	je     8066dd <__udivdi3+0x6f>
+  8066d9:	89 d0                	mov    %edx,%eax
+  8066db:	31 d2                	xor    %edx,%edx
+  8066dd:	83 e0 01             	and    $0x1,%eax
+  8066e0:	89 04 24             	mov    %eax,(%esp)
+  8066e3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8066ea:	00 
+  8066eb:	8b 04 24             	mov    (%esp),%eax
+  8066ee:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8066f2:	09 f0                	or     %esi,%eax
+  8066f4:	09 fa                	or     %edi,%edx
+  8066f6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8066fa:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8066fe:	39 f0                	cmp    %esi,%eax
+  806700:	89 d3                	mov    %edx,%ebx
+  806702:	19 fb                	sbb    %edi,%ebx
+  806704:	72 af                	jb     8066b5 <__udivdi3+0x47>
+  806706:	29 f0                	sub    %esi,%eax
+  806708:	19 fa                	sbb    %edi,%edx
+  80670a:	89 cf                	mov    %ecx,%edi
+  80670c:	c1 ef 05             	shr    $0x5,%edi
+  80670f:	83 e7 01             	and    $0x1,%edi
+  806712:	89 fe                	mov    %edi,%esi
+  806714:	83 f6 01             	xor    $0x1,%esi
+  806717:	d3 e6                	shl    %cl,%esi
+  806719:	d3 e7                	shl    %cl,%edi
+  80671b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80671f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  806723:	eb 90                	jmp    8066b5 <__udivdi3+0x47>
+  806725:	8b 44 24 18          	mov    0x18(%esp),%eax
+  806729:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80672d:	83 c4 20             	add    $0x20,%esp
+  806730:	5b                   	pop    %ebx
+  806731:	5e                   	pop    %esi
+  806732:	5f                   	pop    %edi
+  806733:	c3                   	ret
+
+00806734 <__umoddi3>:
+  806734:	57                   	push   %edi
+  806735:	56                   	push   %esi
+  806736:	53                   	push   %ebx
+  806737:	83 ec 08             	sub    $0x8,%esp
+  80673a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80673e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  806742:	8b 74 24 20          	mov    0x20(%esp),%esi
+  806746:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80674a:	57                   	push   %edi
+  80674b:	56                   	push   %esi
+  80674c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  806750:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  806754:	52                   	push   %edx
+  806755:	50                   	push   %eax
+  806756:	e8 13 ff ff ff       	call   80666e <__udivdi3>
+  80675b:	89 c3                	mov    %eax,%ebx
+  80675d:	0f af d6             	imul   %esi,%edx
+  806760:	89 f9                	mov    %edi,%ecx
+  806762:	0f af cb             	imul   %ebx,%ecx
+  806765:	01 d1                	add    %edx,%ecx
+  806767:	89 d8                	mov    %ebx,%eax
+  806769:	f7 e6                	mul    %esi
+  80676b:	89 c6                	mov    %eax,%esi
+  80676d:	89 d7                	mov    %edx,%edi
+  80676f:	01 cf                	add    %ecx,%edi
+  806771:	8b 44 24 10          	mov    0x10(%esp),%eax
+  806775:	8b 54 24 14          	mov    0x14(%esp),%edx
+  806779:	29 f0                	sub    %esi,%eax
+  80677b:	19 fa                	sbb    %edi,%edx
+  80677d:	83 c4 18             	add    $0x18,%esp
+  806780:	5b                   	pop    %ebx
+  806781:	5e                   	pop    %esi
+  806782:	5f                   	pop    %edi
+  806783:	c3                   	ret
+
+00806784 <__divdi3>:
+  806784:	53                   	push   %ebx
+  806785:	8b 44 24 08          	mov    0x8(%esp),%eax
+  806789:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80678d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  806791:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  806795:	85 d2                	test   %edx,%edx
+  806797:	78 12                	js     8067ab <__divdi3+0x27>
+  806799:	85 db                	test   %ebx,%ebx
+  80679b:	78 2e                	js     8067cb <__divdi3+0x47>
+  80679d:	53                   	push   %ebx
+  80679e:	51                   	push   %ecx
+  80679f:	52                   	push   %edx
+  8067a0:	50                   	push   %eax
+  8067a1:	e8 c8 fe ff ff       	call   80666e <__udivdi3>
+  8067a6:	83 c4 10             	add    $0x10,%esp
+  8067a9:	eb 1e                	jmp    8067c9 <__divdi3+0x45>
+  8067ab:	f7 d8                	neg    %eax
+  8067ad:	83 d2 00             	adc    $0x0,%edx
+  8067b0:	f7 da                	neg    %edx
+  8067b2:	85 db                	test   %ebx,%ebx
+  8067b4:	78 2a                	js     8067e0 <__divdi3+0x5c>
+  8067b6:	53                   	push   %ebx
+  8067b7:	51                   	push   %ecx
+  8067b8:	52                   	push   %edx
+  8067b9:	50                   	push   %eax
+  8067ba:	e8 af fe ff ff       	call   80666e <__udivdi3>
+  8067bf:	83 c4 10             	add    $0x10,%esp
+  8067c2:	f7 d8                	neg    %eax
+  8067c4:	83 d2 00             	adc    $0x0,%edx
+  8067c7:	f7 da                	neg    %edx
+  8067c9:	5b                   	pop    %ebx
+  8067ca:	c3                   	ret
+  8067cb:	f7 d9                	neg    %ecx
+  8067cd:	83 d3 00             	adc    $0x0,%ebx
+  8067d0:	f7 db                	neg    %ebx
+  8067d2:	53                   	push   %ebx
+  8067d3:	51                   	push   %ecx
+  8067d4:	52                   	push   %edx
+  8067d5:	50                   	push   %eax
+  8067d6:	e8 93 fe ff ff       	call   80666e <__udivdi3>
+  8067db:	83 c4 10             	add    $0x10,%esp
+  8067de:	eb e2                	jmp    8067c2 <__divdi3+0x3e>
+  8067e0:	f7 d9                	neg    %ecx
+  8067e2:	83 d3 00             	adc    $0x0,%ebx
+  8067e5:	f7 db                	neg    %ebx
+  8067e7:	53                   	push   %ebx
+  8067e8:	51                   	push   %ecx
+  8067e9:	52                   	push   %edx
+  8067ea:	50                   	push   %eax
+  8067eb:	e8 7e fe ff ff       	call   80666e <__udivdi3>
+  8067f0:	83 c4 10             	add    $0x10,%esp
+  8067f3:	eb d4                	jmp    8067c9 <__divdi3+0x45>
+
+008067f5 <__moddi3>:
+  8067f5:	57                   	push   %edi
+  8067f6:	56                   	push   %esi
+  8067f7:	53                   	push   %ebx
+  8067f8:	83 ec 08             	sub    $0x8,%esp
+  8067fb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8067ff:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  806803:	8b 74 24 20          	mov    0x20(%esp),%esi
+  806807:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80680b:	57                   	push   %edi
+  80680c:	56                   	push   %esi
+  80680d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  806811:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  806815:	52                   	push   %edx
+  806816:	50                   	push   %eax
+  806817:	e8 68 ff ff ff       	call   806784 <__divdi3>
+  80681c:	89 c3                	mov    %eax,%ebx
+  80681e:	0f af d6             	imul   %esi,%edx
+  806821:	89 f9                	mov    %edi,%ecx
+  806823:	0f af cb             	imul   %ebx,%ecx
+  806826:	01 d1                	add    %edx,%ecx
+  806828:	89 d8                	mov    %ebx,%eax
+  80682a:	f7 e6                	mul    %esi
+  80682c:	89 c6                	mov    %eax,%esi
+  80682e:	89 d7                	mov    %edx,%edi
+  806830:	01 cf                	add    %ecx,%edi
+  806832:	8b 44 24 10          	mov    0x10(%esp),%eax
+  806836:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80683a:	29 f0                	sub    %esi,%eax
+  80683c:	19 fa                	sbb    %edi,%edx
+  80683e:	83 c4 18             	add    $0x18,%esp
+  806841:	5b                   	pop    %ebx
+  806842:	5e                   	pop    %esi
+  806843:	5f                   	pop    %edi
+  806844:	c3                   	ret
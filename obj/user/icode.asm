@@ -0,0 +1,8750 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 01 00 00       	call   800136 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  800040:	c7 05 00 50 80 00 80 	movl   $0x804480,0x805000
+  800047:	44 80 00 
+
+	cprintf("icode startup\n");
+  80004a:	68 86 44 80 00       	push   $0x804486
+  80004f:	e8 64 02 00 00       	call   8002b8 <cprintf>
+
+	cprintf("icode: open /motd\n");
+  800054:	c7 04 24 95 44 80 00 	movl   $0x804495,(%esp)
+  80005b:	e8 58 02 00 00       	call   8002b8 <cprintf>
+	if ((fd = open("/motd", O_RDONLY)) < 0)
+  800060:	83 c4 08             	add    $0x8,%esp
+  800063:	6a 00                	push   $0x0
+  800065:	68 a8 44 80 00       	push   $0x8044a8
+  80006a:	e8 cb 19 00 00       	call   801a3a <open>
+  80006f:	89 c6                	mov    %eax,%esi
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 18                	js     800090 <umain+0x5b>
+		panic("icode: open /motd: %e", fd);
+
+	cprintf("icode: read /motd\n");
+  800078:	83 ec 0c             	sub    $0xc,%esp
+  80007b:	68 d1 44 80 00       	push   $0x8044d1
+  800080:	e8 33 02 00 00       	call   8002b8 <cprintf>
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008e:	eb 1f                	jmp    8000af <umain+0x7a>
+		panic("icode: open /motd: %e", fd);
+  800090:	50                   	push   %eax
+  800091:	68 ae 44 80 00       	push   $0x8044ae
+  800096:	6a 0f                	push   $0xf
+  800098:	68 c4 44 80 00       	push   $0x8044c4
+  80009d:	e8 3b 01 00 00       	call   8001dd <_panic>
+		sys_cputs(buf, n);
+  8000a2:	83 ec 08             	sub    $0x8,%esp
+  8000a5:	50                   	push   %eax
+  8000a6:	53                   	push   %ebx
+  8000a7:	e8 7b 0c 00 00       	call   800d27 <sys_cputs>
+  8000ac:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000af:	83 ec 04             	sub    $0x4,%esp
+  8000b2:	68 00 02 00 00       	push   $0x200
+  8000b7:	53                   	push   %ebx
+  8000b8:	56                   	push   %esi
+  8000b9:	e8 83 14 00 00       	call   801541 <read>
+  8000be:	83 c4 10             	add    $0x10,%esp
+  8000c1:	85 c0                	test   %eax,%eax
+  8000c3:	7f dd                	jg     8000a2 <umain+0x6d>
+
+	cprintf("icode: close /motd\n");
+  8000c5:	83 ec 0c             	sub    $0xc,%esp
+  8000c8:	68 e4 44 80 00       	push   $0x8044e4
+  8000cd:	e8 e6 01 00 00       	call   8002b8 <cprintf>
+	close(fd);
+  8000d2:	89 34 24             	mov    %esi,(%esp)
+  8000d5:	e8 28 13 00 00       	call   801402 <close>
+
+	cprintf("icode: spawn /init\n");
+  8000da:	c7 04 24 f8 44 80 00 	movl   $0x8044f8,(%esp)
+  8000e1:	e8 d2 01 00 00       	call   8002b8 <cprintf>
+	if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000ed:	68 0c 45 80 00       	push   $0x80450c
+  8000f2:	68 15 45 80 00       	push   $0x804515
+  8000f7:	68 1f 45 80 00       	push   $0x80451f
+  8000fc:	68 1e 45 80 00       	push   $0x80451e
+  800101:	e8 3a 23 00 00       	call   802440 <spawnl>
+  800106:	83 c4 20             	add    $0x20,%esp
+  800109:	85 c0                	test   %eax,%eax
+  80010b:	78 17                	js     800124 <umain+0xef>
+		panic("icode: spawn /init: %e", r);
+
+	cprintf("icode: exiting\n");
+  80010d:	83 ec 0c             	sub    $0xc,%esp
+  800110:	68 3b 45 80 00       	push   $0x80453b
+  800115:	e8 9e 01 00 00       	call   8002b8 <cprintf>
+}
+  80011a:	83 c4 10             	add    $0x10,%esp
+  80011d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800120:	5b                   	pop    %ebx
+  800121:	5e                   	pop    %esi
+  800122:	5d                   	pop    %ebp
+  800123:	c3                   	ret
+		panic("icode: spawn /init: %e", r);
+  800124:	50                   	push   %eax
+  800125:	68 24 45 80 00       	push   $0x804524
+  80012a:	6a 1a                	push   $0x1a
+  80012c:	68 c4 44 80 00       	push   $0x8044c4
+  800131:	e8 a7 00 00 00       	call   8001dd <_panic>
+
+00800136 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800136:	55                   	push   %ebp
+  800137:	89 e5                	mov    %esp,%ebp
+  800139:	56                   	push   %esi
+  80013a:	53                   	push   %ebx
+  80013b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800141:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800143:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800148:	29 d0                	sub    %edx,%eax
+  80014a:	89 c2                	mov    %eax,%edx
+  80014c:	c1 ea 0f             	shr    $0xf,%edx
+  80014f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80015c:	c7 04 85 80 69 80 00 	movl   $0x0,0x806980(,%eax,4)
+  800163:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800167:	e8 39 0c 00 00       	call   800da5 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80016c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800171:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800177:	89 e1                	mov    %esp,%ecx
+  800179:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80017e:	29 ca                	sub    %ecx,%edx
+  800180:	89 d1                	mov    %edx,%ecx
+  800182:	c1 e9 0f             	shr    $0xf,%ecx
+  800185:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80018b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800190:	0f 42 d1             	cmovb  %ecx,%edx
+  800193:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800198:	89 04 95 80 69 80 00 	mov    %eax,0x806980(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80019f:	85 db                	test   %ebx,%ebx
+  8001a1:	7e 07                	jle    8001aa <libmain+0x74>
+		binaryname = argv[0];
+  8001a3:	8b 06                	mov    (%esi),%eax
+  8001a5:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8001aa:	83 ec 08             	sub    $0x8,%esp
+  8001ad:	56                   	push   %esi
+  8001ae:	53                   	push   %ebx
+  8001af:	e8 81 fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8001b4:	e8 0a 00 00 00       	call   8001c3 <exit>
+}
+  8001b9:	83 c4 10             	add    $0x10,%esp
+  8001bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001bf:	5b                   	pop    %ebx
+  8001c0:	5e                   	pop    %esi
+  8001c1:	5d                   	pop    %ebp
+  8001c2:	c3                   	ret
+
+008001c3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001c9:	e8 61 12 00 00       	call   80142f <close_all>
+	sys_env_destroy(0);
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	6a 00                	push   $0x0
+  8001d3:	e8 8c 0b 00 00       	call   800d64 <sys_env_destroy>
+}
+  8001d8:	83 c4 10             	add    $0x10,%esp
+  8001db:	c9                   	leave
+  8001dc:	c3                   	ret
+
+008001dd <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	56                   	push   %esi
+  8001e1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e5:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001eb:	e8 b5 0b 00 00       	call   800da5 <sys_getenvid>
+  8001f0:	83 ec 0c             	sub    $0xc,%esp
+  8001f3:	ff 75 0c             	push   0xc(%ebp)
+  8001f6:	ff 75 08             	push   0x8(%ebp)
+  8001f9:	56                   	push   %esi
+  8001fa:	50                   	push   %eax
+  8001fb:	68 58 45 80 00       	push   $0x804558
+  800200:	e8 b3 00 00 00       	call   8002b8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800205:	83 c4 18             	add    $0x18,%esp
+  800208:	53                   	push   %ebx
+  800209:	ff 75 10             	push   0x10(%ebp)
+  80020c:	e8 56 00 00 00       	call   800267 <vcprintf>
+	cprintf("\n");
+  800211:	c7 04 24 82 4a 80 00 	movl   $0x804a82,(%esp)
+  800218:	e8 9b 00 00 00       	call   8002b8 <cprintf>
+  80021d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800220:	cc                   	int3
+	while (1)
+  800221:	eb fd                	jmp    800220 <_panic+0x43>
+
+00800223 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800223:	55                   	push   %ebp
+  800224:	89 e5                	mov    %esp,%ebp
+  800226:	53                   	push   %ebx
+  800227:	83 ec 04             	sub    $0x4,%esp
+  80022a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022d:	8b 13                	mov    (%ebx),%edx
+  80022f:	8d 42 01             	lea    0x1(%edx),%eax
+  800232:	89 03                	mov    %eax,(%ebx)
+  800234:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800237:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80023b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800240:	74 09                	je     80024b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800242:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800246:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80024b:	83 ec 08             	sub    $0x8,%esp
+  80024e:	68 ff 00 00 00       	push   $0xff
+  800253:	8d 43 08             	lea    0x8(%ebx),%eax
+  800256:	50                   	push   %eax
+  800257:	e8 cb 0a 00 00       	call   800d27 <sys_cputs>
+		b->idx = 0;
+  80025c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	eb db                	jmp    800242 <putch+0x1f>
+
+00800267 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800267:	55                   	push   %ebp
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800270:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800277:	00 00 00 
+	b.cnt = 0;
+  80027a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800281:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800284:	ff 75 0c             	push   0xc(%ebp)
+  800287:	ff 75 08             	push   0x8(%ebp)
+  80028a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800290:	50                   	push   %eax
+  800291:	68 23 02 80 00       	push   $0x800223
+  800296:	e8 1c 01 00 00       	call   8003b7 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80029b:	83 c4 08             	add    $0x8,%esp
+  80029e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	e8 77 0a 00 00       	call   800d27 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b6:	c9                   	leave
+  8002b7:	c3                   	ret
+
+008002b8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002be:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c1:	50                   	push   %eax
+  8002c2:	ff 75 08             	push   0x8(%ebp)
+  8002c5:	e8 9d ff ff ff       	call   800267 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002ca:	c9                   	leave
+  8002cb:	c3                   	ret
+
+008002cc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	57                   	push   %edi
+  8002d0:	56                   	push   %esi
+  8002d1:	53                   	push   %ebx
+  8002d2:	83 ec 1c             	sub    $0x1c,%esp
+  8002d5:	89 c3                	mov    %eax,%ebx
+  8002d7:	89 d6                	mov    %edx,%esi
+  8002d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002df:	89 d1                	mov    %edx,%ecx
+  8002e1:	89 c2                	mov    %eax,%edx
+  8002e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002e9:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ef:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002f6:	39 c2                	cmp    %eax,%edx
+  8002f8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002fb:	73 4b                	jae    800348 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8002fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800300:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800303:	85 ff                	test   %edi,%edi
+  800305:	7e 11                	jle    800318 <printnum+0x4c>
+			putch(padc, putdat);
+  800307:	83 ec 08             	sub    $0x8,%esp
+  80030a:	56                   	push   %esi
+  80030b:	ff 75 18             	push   0x18(%ebp)
+  80030e:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800310:	83 c4 10             	add    $0x10,%esp
+  800313:	83 ef 01             	sub    $0x1,%edi
+  800316:	75 ef                	jne    800307 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800318:	83 ec 08             	sub    $0x8,%esp
+  80031b:	56                   	push   %esi
+  80031c:	83 ec 04             	sub    $0x4,%esp
+  80031f:	ff 75 e4             	push   -0x1c(%ebp)
+  800322:	ff 75 e0             	push   -0x20(%ebp)
+  800325:	ff 75 dc             	push   -0x24(%ebp)
+  800328:	ff 75 d8             	push   -0x28(%ebp)
+  80032b:	e8 2a 40 00 00       	call   80435a <__umoddi3>
+  800330:	83 c4 14             	add    $0x14,%esp
+  800333:	0f be 80 7b 45 80 00 	movsbl 0x80457b(%eax),%eax
+  80033a:	50                   	push   %eax
+  80033b:	ff d3                	call   *%ebx
+}
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800343:	5b                   	pop    %ebx
+  800344:	5e                   	pop    %esi
+  800345:	5f                   	pop    %edi
+  800346:	5d                   	pop    %ebp
+  800347:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800348:	83 ec 0c             	sub    $0xc,%esp
+  80034b:	ff 75 18             	push   0x18(%ebp)
+  80034e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800351:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800354:	52                   	push   %edx
+  800355:	50                   	push   %eax
+  800356:	83 ec 08             	sub    $0x8,%esp
+  800359:	ff 75 e4             	push   -0x1c(%ebp)
+  80035c:	ff 75 e0             	push   -0x20(%ebp)
+  80035f:	ff 75 dc             	push   -0x24(%ebp)
+  800362:	ff 75 d8             	push   -0x28(%ebp)
+  800365:	e8 2a 3f 00 00       	call   804294 <__udivdi3>
+  80036a:	83 c4 18             	add    $0x18,%esp
+  80036d:	52                   	push   %edx
+  80036e:	50                   	push   %eax
+  80036f:	89 f2                	mov    %esi,%edx
+  800371:	89 d8                	mov    %ebx,%eax
+  800373:	e8 54 ff ff ff       	call   8002cc <printnum>
+  800378:	83 c4 20             	add    $0x20,%esp
+  80037b:	eb 9b                	jmp    800318 <printnum+0x4c>
+
+0080037d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800383:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800387:	8b 10                	mov    (%eax),%edx
+  800389:	3b 50 04             	cmp    0x4(%eax),%edx
+  80038c:	73 0a                	jae    800398 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80038e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800391:	89 08                	mov    %ecx,(%eax)
+  800393:	8b 45 08             	mov    0x8(%ebp),%eax
+  800396:	88 02                	mov    %al,(%edx)
+}
+  800398:	5d                   	pop    %ebp
+  800399:	c3                   	ret
+
+0080039a <printfmt>:
+{
+  80039a:	55                   	push   %ebp
+  80039b:	89 e5                	mov    %esp,%ebp
+  80039d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003a0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003a3:	50                   	push   %eax
+  8003a4:	ff 75 10             	push   0x10(%ebp)
+  8003a7:	ff 75 0c             	push   0xc(%ebp)
+  8003aa:	ff 75 08             	push   0x8(%ebp)
+  8003ad:	e8 05 00 00 00       	call   8003b7 <vprintfmt>
+}
+  8003b2:	83 c4 10             	add    $0x10,%esp
+  8003b5:	c9                   	leave
+  8003b6:	c3                   	ret
+
+008003b7 <vprintfmt>:
+{
+  8003b7:	55                   	push   %ebp
+  8003b8:	89 e5                	mov    %esp,%ebp
+  8003ba:	57                   	push   %edi
+  8003bb:	56                   	push   %esi
+  8003bc:	53                   	push   %ebx
+  8003bd:	83 ec 2c             	sub    $0x2c,%esp
+  8003c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003c3:	89 df                	mov    %ebx,%edi
+  8003c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003c8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003cb:	8d 70 01             	lea    0x1(%eax),%esi
+  8003ce:	0f b6 00             	movzbl (%eax),%eax
+  8003d1:	83 f8 25             	cmp    $0x25,%eax
+  8003d4:	74 1e                	je     8003f4 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8003d6:	85 c0                	test   %eax,%eax
+  8003d8:	0f 84 15 05 00 00    	je     8008f3 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8003de:	83 ec 08             	sub    $0x8,%esp
+  8003e1:	53                   	push   %ebx
+  8003e2:	50                   	push   %eax
+  8003e3:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e5:	83 c6 01             	add    $0x1,%esi
+  8003e8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003ec:	83 c4 10             	add    $0x10,%esp
+  8003ef:	83 f8 25             	cmp    $0x25,%eax
+  8003f2:	75 e2                	jne    8003d6 <vprintfmt+0x1f>
+		padc = ' ';
+  8003f4:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8003f8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003ff:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800406:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80040d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800412:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800415:	8d 56 01             	lea    0x1(%esi),%edx
+  800418:	0f b6 0e             	movzbl (%esi),%ecx
+  80041b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80041e:	3c 55                	cmp    $0x55,%al
+  800420:	0f 87 3b 04 00 00    	ja     800861 <vprintfmt+0x4aa>
+  800426:	0f b6 c0             	movzbl %al,%eax
+  800429:	ff 24 85 e0 46 80 00 	jmp    *0x8046e0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800430:	89 75 10             	mov    %esi,0x10(%ebp)
+  800433:	eb 93                	jmp    8003c8 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800435:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800437:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80043b:	eb d8                	jmp    800415 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043d:	89 d6                	mov    %edx,%esi
+  80043f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800443:	eb d0                	jmp    800415 <vprintfmt+0x5e>
+  800445:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800448:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80044b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80044e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800452:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800455:	83 f9 09             	cmp    $0x9,%ecx
+  800458:	77 6f                	ja     8004c9 <vprintfmt+0x112>
+  80045a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80045d:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800460:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800463:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800467:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80046a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80046d:	83 fe 09             	cmp    $0x9,%esi
+  800470:	76 eb                	jbe    80045d <vprintfmt+0xa6>
+  800472:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800475:	89 d6                	mov    %edx,%esi
+  800477:	eb 13                	jmp    80048c <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047c:	8b 00                	mov    (%eax),%eax
+  80047e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800481:	8b 45 14             	mov    0x14(%ebp),%eax
+  800484:	8d 40 04             	lea    0x4(%eax),%eax
+  800487:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80048a:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80048c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800490:	79 83                	jns    800415 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800492:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800495:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800498:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80049f:	e9 71 ff ff ff       	jmp    800415 <vprintfmt+0x5e>
+			if (width < 0)
+  8004a4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004a7:	85 c9                	test   %ecx,%ecx
+  8004a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ae:	0f 49 c1             	cmovns %ecx,%eax
+  8004b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b4:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004b6:	e9 5a ff ff ff       	jmp    800415 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bb:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8004bd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004c4:	e9 4c ff ff ff       	jmp    800415 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c9:	89 d6                	mov    %edx,%esi
+  8004cb:	eb bf                	jmp    80048c <vprintfmt+0xd5>
+			lflag++;
+  8004cd:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d1:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004d3:	e9 3d ff ff ff       	jmp    800415 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8004d8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004de:	8d 70 04             	lea    0x4(%eax),%esi
+  8004e1:	83 ec 08             	sub    $0x8,%esp
+  8004e4:	53                   	push   %ebx
+  8004e5:	ff 30                	push   (%eax)
+  8004e7:	ff d7                	call   *%edi
+			break;
+  8004e9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ec:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8004ef:	e9 d4 fe ff ff       	jmp    8003c8 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8004f4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fa:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8004fd:	8b 10                	mov    (%eax),%edx
+  8004ff:	89 d0                	mov    %edx,%eax
+  800501:	f7 d8                	neg    %eax
+  800503:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800506:	83 f8 12             	cmp    $0x12,%eax
+  800509:	7f 23                	jg     80052e <vprintfmt+0x177>
+  80050b:	8b 14 85 40 48 80 00 	mov    0x804840(,%eax,4),%edx
+  800512:	85 d2                	test   %edx,%edx
+  800514:	74 18                	je     80052e <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800516:	52                   	push   %edx
+  800517:	68 94 49 80 00       	push   $0x804994
+  80051c:	53                   	push   %ebx
+  80051d:	57                   	push   %edi
+  80051e:	e8 77 fe ff ff       	call   80039a <printfmt>
+  800523:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800526:	89 75 14             	mov    %esi,0x14(%ebp)
+  800529:	e9 9a fe ff ff       	jmp    8003c8 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80052e:	50                   	push   %eax
+  80052f:	68 93 45 80 00       	push   $0x804593
+  800534:	53                   	push   %ebx
+  800535:	57                   	push   %edi
+  800536:	e8 5f fe ff ff       	call   80039a <printfmt>
+  80053b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80053e:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800541:	e9 82 fe ff ff       	jmp    8003c8 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800546:	89 55 10             	mov    %edx,0x10(%ebp)
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	83 c0 04             	add    $0x4,%eax
+  80054f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800552:	8b 45 14             	mov    0x14(%ebp),%eax
+  800555:	8b 00                	mov    (%eax),%eax
+  800557:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80055a:	85 c0                	test   %eax,%eax
+  80055c:	0f 84 61 03 00 00    	je     8008c3 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800562:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800566:	7e 06                	jle    80056e <vprintfmt+0x1b7>
+  800568:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80056c:	75 29                	jne    800597 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80056e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800571:	8d 70 01             	lea    0x1(%eax),%esi
+  800574:	0f b6 00             	movzbl (%eax),%eax
+  800577:	0f be d0             	movsbl %al,%edx
+  80057a:	85 d2                	test   %edx,%edx
+  80057c:	0f 84 bb 00 00 00    	je     80063d <vprintfmt+0x286>
+  800582:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800585:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800588:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80058b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80058e:	eb 7a                	jmp    80060a <vprintfmt+0x253>
+				p = "(null)";
+  800590:	c7 45 d0 8c 45 80 00 	movl   $0x80458c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800597:	83 ec 08             	sub    $0x8,%esp
+  80059a:	ff 75 d4             	push   -0x2c(%ebp)
+  80059d:	ff 75 d0             	push   -0x30(%ebp)
+  8005a0:	e8 e0 03 00 00       	call   800985 <strnlen>
+  8005a5:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005a8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005ab:	83 c4 10             	add    $0x10,%esp
+  8005ae:	85 d2                	test   %edx,%edx
+  8005b0:	0f 8e d6 02 00 00    	jle    80088c <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8005b6:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	53                   	push   %ebx
+  8005be:	56                   	push   %esi
+  8005bf:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c1:	83 c4 10             	add    $0x10,%esp
+  8005c4:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8005c8:	75 f0                	jne    8005ba <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005cd:	8d 70 01             	lea    0x1(%eax),%esi
+  8005d0:	0f b6 00             	movzbl (%eax),%eax
+  8005d3:	0f be d0             	movsbl %al,%edx
+  8005d6:	85 d2                	test   %edx,%edx
+  8005d8:	0f 84 da 02 00 00    	je     8008b8 <vprintfmt+0x501>
+  8005de:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005e1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005e4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005e7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005ea:	eb 1e                	jmp    80060a <vprintfmt+0x253>
+					putch(ch, putdat);
+  8005ec:	83 ec 08             	sub    $0x8,%esp
+  8005ef:	ff 75 0c             	push   0xc(%ebp)
+  8005f2:	52                   	push   %edx
+  8005f3:	ff 55 08             	call   *0x8(%ebp)
+  8005f6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005f9:	83 eb 01             	sub    $0x1,%ebx
+  8005fc:	83 c6 01             	add    $0x1,%esi
+  8005ff:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800603:	0f be d0             	movsbl %al,%edx
+  800606:	85 d2                	test   %edx,%edx
+  800608:	74 2a                	je     800634 <vprintfmt+0x27d>
+  80060a:	85 ff                	test   %edi,%edi
+  80060c:	78 05                	js     800613 <vprintfmt+0x25c>
+  80060e:	83 ef 01             	sub    $0x1,%edi
+  800611:	78 59                	js     80066c <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800613:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800617:	74 d3                	je     8005ec <vprintfmt+0x235>
+  800619:	0f be c0             	movsbl %al,%eax
+  80061c:	83 e8 20             	sub    $0x20,%eax
+  80061f:	83 f8 5e             	cmp    $0x5e,%eax
+  800622:	76 c8                	jbe    8005ec <vprintfmt+0x235>
+					putch('?', putdat);
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	ff 75 0c             	push   0xc(%ebp)
+  80062a:	6a 3f                	push   $0x3f
+  80062c:	ff 55 08             	call   *0x8(%ebp)
+  80062f:	83 c4 10             	add    $0x10,%esp
+  800632:	eb c5                	jmp    8005f9 <vprintfmt+0x242>
+  800634:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800637:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80063a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80063d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800640:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800644:	7e 1b                	jle    800661 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800646:	83 ec 08             	sub    $0x8,%esp
+  800649:	53                   	push   %ebx
+  80064a:	6a 20                	push   $0x20
+  80064c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80064e:	83 c4 10             	add    $0x10,%esp
+  800651:	83 ee 01             	sub    $0x1,%esi
+  800654:	75 f0                	jne    800646 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800656:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065c:	e9 67 fd ff ff       	jmp    8003c8 <vprintfmt+0x11>
+  800661:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+  800667:	e9 5c fd ff ff       	jmp    8003c8 <vprintfmt+0x11>
+  80066c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80066f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800672:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800675:	eb c6                	jmp    80063d <vprintfmt+0x286>
+	if (lflag >= 2)
+  800677:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80067a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80067d:	83 f9 01             	cmp    $0x1,%ecx
+  800680:	7f 1f                	jg     8006a1 <vprintfmt+0x2ea>
+	else if (lflag)
+  800682:	85 c9                	test   %ecx,%ecx
+  800684:	74 67                	je     8006ed <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 30                	mov    (%eax),%esi
+  80068b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80068e:	89 f0                	mov    %esi,%eax
+  800690:	c1 f8 1f             	sar    $0x1f,%eax
+  800693:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8d 40 04             	lea    0x4(%eax),%eax
+  80069c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069f:	eb 17                	jmp    8006b8 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a7:	8b 00                	mov    (%eax),%eax
+  8006a9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ac:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006b8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006bb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006be:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8006c3:	85 c9                	test   %ecx,%ecx
+  8006c5:	0f 89 12 01 00 00    	jns    8007dd <vprintfmt+0x426>
+				putch('-', putdat);
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+  8006ce:	53                   	push   %ebx
+  8006cf:	6a 2d                	push   $0x2d
+  8006d1:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006d3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006d9:	f7 da                	neg    %edx
+  8006db:	83 d1 00             	adc    $0x0,%ecx
+  8006de:	f7 d9                	neg    %ecx
+  8006e0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006e3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006e8:	e9 f0 00 00 00       	jmp    8007dd <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 30                	mov    (%eax),%esi
+  8006f2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006f5:	89 f0                	mov    %esi,%eax
+  8006f7:	c1 f8 1f             	sar    $0x1f,%eax
+  8006fa:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8d 40 04             	lea    0x4(%eax),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+  800706:	eb b0                	jmp    8006b8 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800708:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80070b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80070e:	83 f9 01             	cmp    $0x1,%ecx
+  800711:	7f 1e                	jg     800731 <vprintfmt+0x37a>
+	else if (lflag)
+  800713:	85 c9                	test   %ecx,%ecx
+  800715:	74 32                	je     800749 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 10                	mov    (%eax),%edx
+  80071c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800721:	8d 40 04             	lea    0x4(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800727:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80072c:	e9 ac 00 00 00       	jmp    8007dd <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 10                	mov    (%eax),%edx
+  800736:	8b 48 04             	mov    0x4(%eax),%ecx
+  800739:	8d 40 08             	lea    0x8(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800744:	e9 94 00 00 00       	jmp    8007dd <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800749:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074c:	8b 10                	mov    (%eax),%edx
+  80074e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800753:	8d 40 04             	lea    0x4(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800759:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80075e:	eb 7d                	jmp    8007dd <vprintfmt+0x426>
+	if (lflag >= 2)
+  800760:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800763:	89 55 10             	mov    %edx,0x10(%ebp)
+  800766:	83 f9 01             	cmp    $0x1,%ecx
+  800769:	7f 1b                	jg     800786 <vprintfmt+0x3cf>
+	else if (lflag)
+  80076b:	85 c9                	test   %ecx,%ecx
+  80076d:	74 2c                	je     80079b <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8b 10                	mov    (%eax),%edx
+  800774:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800779:	8d 40 04             	lea    0x4(%eax),%eax
+  80077c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077f:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800784:	eb 57                	jmp    8007dd <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	8b 10                	mov    (%eax),%edx
+  80078b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078e:	8d 40 08             	lea    0x8(%eax),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800794:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800799:	eb 42                	jmp    8007dd <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80079b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079e:	8b 10                	mov    (%eax),%edx
+  8007a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ab:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8007b0:	eb 2b                	jmp    8007dd <vprintfmt+0x426>
+			putch('0', putdat);
+  8007b2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007b5:	83 ec 08             	sub    $0x8,%esp
+  8007b8:	53                   	push   %ebx
+  8007b9:	6a 30                	push   $0x30
+  8007bb:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8007bd:	83 c4 08             	add    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	6a 78                	push   $0x78
+  8007c3:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8b 10                	mov    (%eax),%edx
+  8007ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007cf:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d8:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8007dd:	83 ec 0c             	sub    $0xc,%esp
+  8007e0:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007e4:	50                   	push   %eax
+  8007e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8007e8:	56                   	push   %esi
+  8007e9:	51                   	push   %ecx
+  8007ea:	52                   	push   %edx
+  8007eb:	89 da                	mov    %ebx,%edx
+  8007ed:	89 f8                	mov    %edi,%eax
+  8007ef:	e8 d8 fa ff ff       	call   8002cc <printnum>
+			break;
+  8007f4:	83 c4 20             	add    $0x20,%esp
+  8007f7:	e9 cc fb ff ff       	jmp    8003c8 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8007fc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007ff:	89 55 10             	mov    %edx,0x10(%ebp)
+  800802:	83 f9 01             	cmp    $0x1,%ecx
+  800805:	7f 1b                	jg     800822 <vprintfmt+0x46b>
+	else if (lflag)
+  800807:	85 c9                	test   %ecx,%ecx
+  800809:	74 2c                	je     800837 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80080b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080e:	8b 10                	mov    (%eax),%edx
+  800810:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800815:	8d 40 04             	lea    0x4(%eax),%eax
+  800818:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800820:	eb bb                	jmp    8007dd <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800822:	8b 45 14             	mov    0x14(%ebp),%eax
+  800825:	8b 10                	mov    (%eax),%edx
+  800827:	8b 48 04             	mov    0x4(%eax),%ecx
+  80082a:	8d 40 08             	lea    0x8(%eax),%eax
+  80082d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800830:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800835:	eb a6                	jmp    8007dd <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 10                	mov    (%eax),%edx
+  80083c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800841:	8d 40 04             	lea    0x4(%eax),%eax
+  800844:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800847:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80084c:	eb 8f                	jmp    8007dd <vprintfmt+0x426>
+			putch(ch, putdat);
+  80084e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800851:	83 ec 08             	sub    $0x8,%esp
+  800854:	53                   	push   %ebx
+  800855:	6a 25                	push   $0x25
+  800857:	ff d7                	call   *%edi
+			break;
+  800859:	83 c4 10             	add    $0x10,%esp
+  80085c:	e9 67 fb ff ff       	jmp    8003c8 <vprintfmt+0x11>
+			putch('%', putdat);
+  800861:	83 ec 08             	sub    $0x8,%esp
+  800864:	53                   	push   %ebx
+  800865:	6a 25                	push   $0x25
+  800867:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800869:	83 c4 10             	add    $0x10,%esp
+  80086c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800870:	0f 84 ba fb ff ff    	je     800430 <vprintfmt+0x79>
+  800876:	89 75 10             	mov    %esi,0x10(%ebp)
+  800879:	89 f0                	mov    %esi,%eax
+  80087b:	83 e8 01             	sub    $0x1,%eax
+  80087e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800882:	75 f7                	jne    80087b <vprintfmt+0x4c4>
+  800884:	89 45 10             	mov    %eax,0x10(%ebp)
+  800887:	e9 3c fb ff ff       	jmp    8003c8 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80088c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80088f:	8d 70 01             	lea    0x1(%eax),%esi
+  800892:	0f b6 00             	movzbl (%eax),%eax
+  800895:	0f be d0             	movsbl %al,%edx
+  800898:	85 d2                	test   %edx,%edx
+  80089a:	74 11                	je     8008ad <vprintfmt+0x4f6>
+  80089c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80089f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008a2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008a5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008a8:	e9 5d fd ff ff       	jmp    80060a <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008ad:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b3:	e9 10 fb ff ff       	jmp    8003c8 <vprintfmt+0x11>
+  8008b8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008be:	e9 05 fb ff ff       	jmp    8003c8 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8008c3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008c7:	7e 0a                	jle    8008d3 <vprintfmt+0x51c>
+  8008c9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008cd:	0f 85 bd fc ff ff    	jne    800590 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008d3:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008d8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008dd:	be 8d 45 80 00       	mov    $0x80458d,%esi
+  8008e2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008e5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008e8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008ee:	e9 17 fd ff ff       	jmp    80060a <vprintfmt+0x253>
+}
+  8008f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008f6:	5b                   	pop    %ebx
+  8008f7:	5e                   	pop    %esi
+  8008f8:	5f                   	pop    %edi
+  8008f9:	5d                   	pop    %ebp
+  8008fa:	c3                   	ret
+
+008008fb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	83 ec 18             	sub    $0x18,%esp
+  800901:	8b 45 08             	mov    0x8(%ebp),%eax
+  800904:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800907:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80090a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80090e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800911:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800918:	85 c0                	test   %eax,%eax
+  80091a:	74 26                	je     800942 <vsnprintf+0x47>
+  80091c:	85 d2                	test   %edx,%edx
+  80091e:	7e 22                	jle    800942 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800920:	ff 75 14             	push   0x14(%ebp)
+  800923:	ff 75 10             	push   0x10(%ebp)
+  800926:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800929:	50                   	push   %eax
+  80092a:	68 7d 03 80 00       	push   $0x80037d
+  80092f:	e8 83 fa ff ff       	call   8003b7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800934:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800937:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80093a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093d:	83 c4 10             	add    $0x10,%esp
+}
+  800940:	c9                   	leave
+  800941:	c3                   	ret
+		return -E_INVAL;
+  800942:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800947:	eb f7                	jmp    800940 <vsnprintf+0x45>
+
+00800949 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80094f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800952:	50                   	push   %eax
+  800953:	ff 75 10             	push   0x10(%ebp)
+  800956:	ff 75 0c             	push   0xc(%ebp)
+  800959:	ff 75 08             	push   0x8(%ebp)
+  80095c:	e8 9a ff ff ff       	call   8008fb <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800961:	c9                   	leave
+  800962:	c3                   	ret
+
+00800963 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800969:	80 3a 00             	cmpb   $0x0,(%edx)
+  80096c:	74 10                	je     80097e <strlen+0x1b>
+  80096e:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800973:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800976:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80097a:	75 f7                	jne    800973 <strlen+0x10>
+	return n;
+}
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80097e:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800983:	eb f7                	jmp    80097c <strlen+0x19>
+
+00800985 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80098b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80098e:	85 d2                	test   %edx,%edx
+  800990:	74 16                	je     8009a8 <strnlen+0x23>
+  800992:	b8 00 00 00 00       	mov    $0x0,%eax
+  800997:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80099b:	74 09                	je     8009a6 <strnlen+0x21>
+		n++;
+  80099d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a0:	39 d0                	cmp    %edx,%eax
+  8009a2:	75 f3                	jne    800997 <strnlen+0x12>
+		n++;
+  8009a4:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8009a6:	5d                   	pop    %ebp
+  8009a7:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ad:	eb f7                	jmp    8009a6 <strnlen+0x21>
+
+008009af <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	53                   	push   %ebx
+  8009b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009be:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009c2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009c5:	83 c0 01             	add    $0x1,%eax
+  8009c8:	84 d2                	test   %dl,%dl
+  8009ca:	75 f2                	jne    8009be <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009cc:	89 c8                	mov    %ecx,%eax
+  8009ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d1:	c9                   	leave
+  8009d2:	c3                   	ret
+
+008009d3 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	53                   	push   %ebx
+  8009d7:	83 ec 10             	sub    $0x10,%esp
+  8009da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009dd:	53                   	push   %ebx
+  8009de:	e8 80 ff ff ff       	call   800963 <strlen>
+  8009e3:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009e6:	ff 75 0c             	push   0xc(%ebp)
+  8009e9:	01 d8                	add    %ebx,%eax
+  8009eb:	50                   	push   %eax
+  8009ec:	e8 be ff ff ff       	call   8009af <strcpy>
+	return dst;
+}
+  8009f1:	89 d8                	mov    %ebx,%eax
+  8009f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f6:	c9                   	leave
+  8009f7:	c3                   	ret
+
+008009f8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	56                   	push   %esi
+  8009fc:	53                   	push   %ebx
+  8009fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a06:	85 db                	test   %ebx,%ebx
+  800a08:	74 17                	je     800a21 <strncpy+0x29>
+  800a0a:	01 f3                	add    %esi,%ebx
+  800a0c:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a0e:	83 c0 01             	add    $0x1,%eax
+  800a11:	0f b6 0a             	movzbl (%edx),%ecx
+  800a14:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a17:	80 f9 01             	cmp    $0x1,%cl
+  800a1a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a1d:	39 c3                	cmp    %eax,%ebx
+  800a1f:	75 ed                	jne    800a0e <strncpy+0x16>
+	}
+	return ret;
+}
+  800a21:	89 f0                	mov    %esi,%eax
+  800a23:	5b                   	pop    %ebx
+  800a24:	5e                   	pop    %esi
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	56                   	push   %esi
+  800a2b:	53                   	push   %ebx
+  800a2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a35:	89 f0                	mov    %esi,%eax
+  800a37:	85 db                	test   %ebx,%ebx
+  800a39:	74 1e                	je     800a59 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a3b:	83 eb 01             	sub    $0x1,%ebx
+  800a3e:	74 16                	je     800a56 <strlcpy+0x2f>
+  800a40:	01 f3                	add    %esi,%ebx
+  800a42:	0f b6 0a             	movzbl (%edx),%ecx
+  800a45:	84 c9                	test   %cl,%cl
+  800a47:	74 0d                	je     800a56 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800a49:	83 c2 01             	add    $0x1,%edx
+  800a4c:	83 c0 01             	add    $0x1,%eax
+  800a4f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800a52:	39 d8                	cmp    %ebx,%eax
+  800a54:	75 ec                	jne    800a42 <strlcpy+0x1b>
+		*dst = '\0';
+  800a56:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a59:	29 f0                	sub    %esi,%eax
+}
+  800a5b:	5b                   	pop    %ebx
+  800a5c:	5e                   	pop    %esi
+  800a5d:	5d                   	pop    %ebp
+  800a5e:	c3                   	ret
+
+00800a5f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a5f:	55                   	push   %ebp
+  800a60:	89 e5                	mov    %esp,%ebp
+  800a62:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a65:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a68:	0f b6 01             	movzbl (%ecx),%eax
+  800a6b:	84 c0                	test   %al,%al
+  800a6d:	74 11                	je     800a80 <strcmp+0x21>
+  800a6f:	38 02                	cmp    %al,(%edx)
+  800a71:	75 0d                	jne    800a80 <strcmp+0x21>
+		p++, q++;
+  800a73:	83 c1 01             	add    $0x1,%ecx
+  800a76:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a79:	0f b6 01             	movzbl (%ecx),%eax
+  800a7c:	84 c0                	test   %al,%al
+  800a7e:	75 ef                	jne    800a6f <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a80:	0f b6 c0             	movzbl %al,%eax
+  800a83:	0f b6 12             	movzbl (%edx),%edx
+  800a86:	29 d0                	sub    %edx,%eax
+}
+  800a88:	5d                   	pop    %ebp
+  800a89:	c3                   	ret
+
+00800a8a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a8a:	55                   	push   %ebp
+  800a8b:	89 e5                	mov    %esp,%ebp
+  800a8d:	53                   	push   %ebx
+  800a8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a91:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a94:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a97:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a9c:	85 d2                	test   %edx,%edx
+  800a9e:	74 2e                	je     800ace <strncmp+0x44>
+  800aa0:	0f b6 01             	movzbl (%ecx),%eax
+  800aa3:	84 c0                	test   %al,%al
+  800aa5:	74 16                	je     800abd <strncmp+0x33>
+  800aa7:	3a 03                	cmp    (%ebx),%al
+  800aa9:	75 12                	jne    800abd <strncmp+0x33>
+		n--, p++, q++;
+  800aab:	83 c1 01             	add    $0x1,%ecx
+  800aae:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800ab1:	83 ea 01             	sub    $0x1,%edx
+  800ab4:	75 ea                	jne    800aa0 <strncmp+0x16>
+		return 0;
+  800ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abb:	eb 11                	jmp    800ace <strncmp+0x44>
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800ac2:	85 d2                	test   %edx,%edx
+  800ac4:	74 08                	je     800ace <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac6:	0f b6 01             	movzbl (%ecx),%eax
+  800ac9:	0f b6 13             	movzbl (%ebx),%edx
+  800acc:	29 d0                	sub    %edx,%eax
+}
+  800ace:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad1:	c9                   	leave
+  800ad2:	c3                   	ret
+
+00800ad3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800add:	0f b6 10             	movzbl (%eax),%edx
+  800ae0:	84 d2                	test   %dl,%dl
+  800ae2:	74 15                	je     800af9 <strchr+0x26>
+		if (*s == c)
+  800ae4:	38 d1                	cmp    %dl,%cl
+  800ae6:	74 0f                	je     800af7 <strchr+0x24>
+	for (; *s; s++)
+  800ae8:	83 c0 01             	add    $0x1,%eax
+  800aeb:	0f b6 10             	movzbl (%eax),%edx
+  800aee:	84 d2                	test   %dl,%dl
+  800af0:	75 f2                	jne    800ae4 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800af2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af7:	5d                   	pop    %ebp
+  800af8:	c3                   	ret
+	return 0;
+  800af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afe:	eb f7                	jmp    800af7 <strchr+0x24>
+
+00800b00 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	53                   	push   %ebx
+  800b04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b07:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b0a:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b0d:	38 d3                	cmp    %dl,%bl
+  800b0f:	74 14                	je     800b25 <strfind+0x25>
+  800b11:	89 d1                	mov    %edx,%ecx
+  800b13:	84 db                	test   %bl,%bl
+  800b15:	74 0e                	je     800b25 <strfind+0x25>
+	for (; *s; s++)
+  800b17:	83 c0 01             	add    $0x1,%eax
+  800b1a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b1d:	38 ca                	cmp    %cl,%dl
+  800b1f:	74 04                	je     800b25 <strfind+0x25>
+  800b21:	84 d2                	test   %dl,%dl
+  800b23:	75 f2                	jne    800b17 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b28:	c9                   	leave
+  800b29:	c3                   	ret
+
+00800b2a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	57                   	push   %edi
+  800b2e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b31:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b34:	85 c9                	test   %ecx,%ecx
+  800b36:	74 20                	je     800b58 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b38:	89 f8                	mov    %edi,%eax
+  800b3a:	09 c8                	or     %ecx,%eax
+  800b3c:	a8 03                	test   $0x3,%al
+  800b3e:	75 12                	jne    800b52 <memset+0x28>
+		c &= 0xFF;
+  800b40:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b44:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b4a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b4d:	fc                   	cld
+  800b4e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b50:	eb 06                	jmp    800b58 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b55:	fc                   	cld
+  800b56:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b58:	89 f8                	mov    %edi,%eax
+  800b5a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b5d:	c9                   	leave
+  800b5e:	c3                   	ret
+
+00800b5f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b5f:	55                   	push   %ebp
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	57                   	push   %edi
+  800b63:	56                   	push   %esi
+  800b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b67:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b6a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b6d:	39 c6                	cmp    %eax,%esi
+  800b6f:	73 32                	jae    800ba3 <memmove+0x44>
+  800b71:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b74:	39 d0                	cmp    %edx,%eax
+  800b76:	73 2b                	jae    800ba3 <memmove+0x44>
+		s += n;
+		d += n;
+  800b78:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b7b:	89 d6                	mov    %edx,%esi
+  800b7d:	09 fe                	or     %edi,%esi
+  800b7f:	09 ce                	or     %ecx,%esi
+  800b81:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b87:	75 0e                	jne    800b97 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b89:	83 ef 04             	sub    $0x4,%edi
+  800b8c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b8f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b92:	fd                   	std
+  800b93:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b95:	eb 09                	jmp    800ba0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b97:	83 ef 01             	sub    $0x1,%edi
+  800b9a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b9d:	fd                   	std
+  800b9e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ba0:	fc                   	cld
+  800ba1:	eb 1a                	jmp    800bbd <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba3:	89 f2                	mov    %esi,%edx
+  800ba5:	09 c2                	or     %eax,%edx
+  800ba7:	09 ca                	or     %ecx,%edx
+  800ba9:	f6 c2 03             	test   $0x3,%dl
+  800bac:	75 0a                	jne    800bb8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bae:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bb1:	89 c7                	mov    %eax,%edi
+  800bb3:	fc                   	cld
+  800bb4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb6:	eb 05                	jmp    800bbd <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bb8:	89 c7                	mov    %eax,%edi
+  800bba:	fc                   	cld
+  800bbb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bbd:	5e                   	pop    %esi
+  800bbe:	5f                   	pop    %edi
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	c3                   	ret
+
+00800bc1 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bc7:	ff 75 10             	push   0x10(%ebp)
+  800bca:	ff 75 0c             	push   0xc(%ebp)
+  800bcd:	ff 75 08             	push   0x8(%ebp)
+  800bd0:	e8 8a ff ff ff       	call   800b5f <memmove>
+}
+  800bd5:	c9                   	leave
+  800bd6:	c3                   	ret
+
+00800bd7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	56                   	push   %esi
+  800bdb:	53                   	push   %ebx
+  800bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be2:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800be5:	85 f6                	test   %esi,%esi
+  800be7:	74 29                	je     800c12 <memcmp+0x3b>
+  800be9:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800beb:	0f b6 08             	movzbl (%eax),%ecx
+  800bee:	0f b6 1a             	movzbl (%edx),%ebx
+  800bf1:	38 d9                	cmp    %bl,%cl
+  800bf3:	75 11                	jne    800c06 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bf5:	83 c0 01             	add    $0x1,%eax
+  800bf8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bfb:	39 c6                	cmp    %eax,%esi
+  800bfd:	75 ec                	jne    800beb <memcmp+0x14>
+	}
+
+	return 0;
+  800bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c04:	eb 08                	jmp    800c0e <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c06:	0f b6 c1             	movzbl %cl,%eax
+  800c09:	0f b6 db             	movzbl %bl,%ebx
+  800c0c:	29 d8                	sub    %ebx,%eax
+}
+  800c0e:	5b                   	pop    %ebx
+  800c0f:	5e                   	pop    %esi
+  800c10:	5d                   	pop    %ebp
+  800c11:	c3                   	ret
+	return 0;
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c17:	eb f5                	jmp    800c0e <memcmp+0x37>
+
+00800c19 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c19:	55                   	push   %ebp
+  800c1a:	89 e5                	mov    %esp,%ebp
+  800c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c22:	89 c2                	mov    %eax,%edx
+  800c24:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c27:	39 d0                	cmp    %edx,%eax
+  800c29:	73 0d                	jae    800c38 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c2b:	38 08                	cmp    %cl,(%eax)
+  800c2d:	74 0d                	je     800c3c <memfind+0x23>
+	for (; s < ends; s++)
+  800c2f:	83 c0 01             	add    $0x1,%eax
+  800c32:	39 c2                	cmp    %eax,%edx
+  800c34:	75 f5                	jne    800c2b <memfind+0x12>
+  800c36:	eb 06                	jmp    800c3e <memfind+0x25>
+  800c38:	89 c2                	mov    %eax,%edx
+  800c3a:	eb 02                	jmp    800c3e <memfind+0x25>
+  800c3c:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c3e:	89 d0                	mov    %edx,%eax
+  800c40:	5d                   	pop    %ebp
+  800c41:	c3                   	ret
+
+00800c42 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+  800c48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c4e:	0f b6 02             	movzbl (%edx),%eax
+  800c51:	3c 20                	cmp    $0x20,%al
+  800c53:	74 04                	je     800c59 <strtol+0x17>
+  800c55:	3c 09                	cmp    $0x9,%al
+  800c57:	75 0e                	jne    800c67 <strtol+0x25>
+		s++;
+  800c59:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c5c:	0f b6 02             	movzbl (%edx),%eax
+  800c5f:	3c 20                	cmp    $0x20,%al
+  800c61:	74 f6                	je     800c59 <strtol+0x17>
+  800c63:	3c 09                	cmp    $0x9,%al
+  800c65:	74 f2                	je     800c59 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c67:	3c 2b                	cmp    $0x2b,%al
+  800c69:	74 2a                	je     800c95 <strtol+0x53>
+	int neg = 0;
+  800c6b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c70:	3c 2d                	cmp    $0x2d,%al
+  800c72:	74 2b                	je     800c9f <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c74:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c7a:	75 0f                	jne    800c8b <strtol+0x49>
+  800c7c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c7f:	74 28                	je     800ca9 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c81:	85 db                	test   %ebx,%ebx
+  800c83:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c88:	0f 44 d8             	cmove  %eax,%ebx
+  800c8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c90:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c93:	eb 46                	jmp    800cdb <strtol+0x99>
+		s++;
+  800c95:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c9d:	eb d5                	jmp    800c74 <strtol+0x32>
+		s++, neg = 1;
+  800c9f:	83 c2 01             	add    $0x1,%edx
+  800ca2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca7:	eb cb                	jmp    800c74 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cad:	74 0e                	je     800cbd <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800caf:	85 db                	test   %ebx,%ebx
+  800cb1:	75 d8                	jne    800c8b <strtol+0x49>
+		s++, base = 8;
+  800cb3:	83 c2 01             	add    $0x1,%edx
+  800cb6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cbb:	eb ce                	jmp    800c8b <strtol+0x49>
+		s += 2, base = 16;
+  800cbd:	83 c2 02             	add    $0x2,%edx
+  800cc0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cc5:	eb c4                	jmp    800c8b <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc7:	0f be c0             	movsbl %al,%eax
+  800cca:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ccd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd0:	7d 3a                	jge    800d0c <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800cd2:	83 c2 01             	add    $0x1,%edx
+  800cd5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cd9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cdb:	0f b6 02             	movzbl (%edx),%eax
+  800cde:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce1:	89 f3                	mov    %esi,%ebx
+  800ce3:	80 fb 09             	cmp    $0x9,%bl
+  800ce6:	76 df                	jbe    800cc7 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ceb:	89 f3                	mov    %esi,%ebx
+  800ced:	80 fb 19             	cmp    $0x19,%bl
+  800cf0:	77 08                	ja     800cfa <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800cf2:	0f be c0             	movsbl %al,%eax
+  800cf5:	83 e8 57             	sub    $0x57,%eax
+  800cf8:	eb d3                	jmp    800ccd <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cfa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cfd:	89 f3                	mov    %esi,%ebx
+  800cff:	80 fb 19             	cmp    $0x19,%bl
+  800d02:	77 08                	ja     800d0c <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d04:	0f be c0             	movsbl %al,%eax
+  800d07:	83 e8 37             	sub    $0x37,%eax
+  800d0a:	eb c1                	jmp    800ccd <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d10:	74 05                	je     800d17 <strtol+0xd5>
+		*endptr = (char *) s;
+  800d12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d15:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d17:	89 c8                	mov    %ecx,%eax
+  800d19:	f7 d8                	neg    %eax
+  800d1b:	85 ff                	test   %edi,%edi
+  800d1d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d20:	89 c8                	mov    %ecx,%eax
+  800d22:	5b                   	pop    %ebx
+  800d23:	5e                   	pop    %esi
+  800d24:	5f                   	pop    %edi
+  800d25:	5d                   	pop    %ebp
+  800d26:	c3                   	ret
+
+00800d27 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	57                   	push   %edi
+  800d2b:	56                   	push   %esi
+  800d2c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d38:	89 c3                	mov    %eax,%ebx
+  800d3a:	89 c7                	mov    %eax,%edi
+  800d3c:	89 c6                	mov    %eax,%esi
+  800d3e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+
+00800d45 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d50:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d55:	89 d1                	mov    %edx,%ecx
+  800d57:	89 d3                	mov    %edx,%ebx
+  800d59:	89 d7                	mov    %edx,%edi
+  800d5b:	89 d6                	mov    %edx,%esi
+  800d5d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d5f:	5b                   	pop    %ebx
+  800d60:	5e                   	pop    %esi
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+
+00800d64 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d75:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d7a:	89 cb                	mov    %ecx,%ebx
+  800d7c:	89 cf                	mov    %ecx,%edi
+  800d7e:	89 ce                	mov    %ecx,%esi
+  800d80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d82:	85 c0                	test   %eax,%eax
+  800d84:	7f 08                	jg     800d8e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d89:	5b                   	pop    %ebx
+  800d8a:	5e                   	pop    %esi
+  800d8b:	5f                   	pop    %edi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8e:	83 ec 0c             	sub    $0xc,%esp
+  800d91:	50                   	push   %eax
+  800d92:	6a 03                	push   $0x3
+  800d94:	68 ab 48 80 00       	push   $0x8048ab
+  800d99:	6a 23                	push   $0x23
+  800d9b:	68 c8 48 80 00       	push   $0x8048c8
+  800da0:	e8 38 f4 ff ff       	call   8001dd <_panic>
+
+00800da5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	57                   	push   %edi
+  800da9:	56                   	push   %esi
+  800daa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db5:	89 d1                	mov    %edx,%ecx
+  800db7:	89 d3                	mov    %edx,%ebx
+  800db9:	89 d7                	mov    %edx,%edi
+  800dbb:	89 d6                	mov    %edx,%esi
+  800dbd:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd4:	89 d1                	mov    %edx,%ecx
+  800dd6:	89 d3                	mov    %edx,%ebx
+  800dd8:	89 d7                	mov    %edx,%edi
+  800dda:	89 d6                	mov    %edx,%esi
+  800ddc:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+
+00800de3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dec:	be 00 00 00 00       	mov    $0x0,%esi
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dff:	89 f7                	mov    %esi,%edi
+  800e01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e03:	85 c0                	test   %eax,%eax
+  800e05:	7f 08                	jg     800e0f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0a:	5b                   	pop    %ebx
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5f                   	pop    %edi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0f:	83 ec 0c             	sub    $0xc,%esp
+  800e12:	50                   	push   %eax
+  800e13:	6a 04                	push   $0x4
+  800e15:	68 ab 48 80 00       	push   $0x8048ab
+  800e1a:	6a 23                	push   $0x23
+  800e1c:	68 c8 48 80 00       	push   $0x8048c8
+  800e21:	e8 b7 f3 ff ff       	call   8001dd <_panic>
+
+00800e26 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+  800e2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e35:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e40:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 08                	jg     800e51 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	50                   	push   %eax
+  800e55:	6a 05                	push   $0x5
+  800e57:	68 ab 48 80 00       	push   $0x8048ab
+  800e5c:	6a 23                	push   $0x23
+  800e5e:	68 c8 48 80 00       	push   $0x8048c8
+  800e63:	e8 75 f3 ff ff       	call   8001dd <_panic>
+
+00800e68 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e81:	89 df                	mov    %ebx,%edi
+  800e83:	89 de                	mov    %ebx,%esi
+  800e85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	7f 08                	jg     800e93 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e93:	83 ec 0c             	sub    $0xc,%esp
+  800e96:	50                   	push   %eax
+  800e97:	6a 06                	push   $0x6
+  800e99:	68 ab 48 80 00       	push   $0x8048ab
+  800e9e:	6a 23                	push   $0x23
+  800ea0:	68 c8 48 80 00       	push   $0x8048c8
+  800ea5:	e8 33 f3 ff ff       	call   8001dd <_panic>
+
+00800eaa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebe:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec3:	89 df                	mov    %ebx,%edi
+  800ec5:	89 de                	mov    %ebx,%esi
+  800ec7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	7f 08                	jg     800ed5 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed0:	5b                   	pop    %ebx
+  800ed1:	5e                   	pop    %esi
+  800ed2:	5f                   	pop    %edi
+  800ed3:	5d                   	pop    %ebp
+  800ed4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+  800ed8:	50                   	push   %eax
+  800ed9:	6a 08                	push   $0x8
+  800edb:	68 ab 48 80 00       	push   $0x8048ab
+  800ee0:	6a 23                	push   $0x23
+  800ee2:	68 c8 48 80 00       	push   $0x8048c8
+  800ee7:	e8 f1 f2 ff ff       	call   8001dd <_panic>
+
+00800eec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	56                   	push   %esi
+  800ef1:	53                   	push   %ebx
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f00:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f05:	89 df                	mov    %ebx,%edi
+  800f07:	89 de                	mov    %ebx,%esi
+  800f09:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	7f 08                	jg     800f17 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	50                   	push   %eax
+  800f1b:	6a 09                	push   $0x9
+  800f1d:	68 ab 48 80 00       	push   $0x8048ab
+  800f22:	6a 23                	push   $0x23
+  800f24:	68 c8 48 80 00       	push   $0x8048c8
+  800f29:	e8 af f2 ff ff       	call   8001dd <_panic>
+
+00800f2e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f47:	89 df                	mov    %ebx,%edi
+  800f49:	89 de                	mov    %ebx,%esi
+  800f4b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	7f 08                	jg     800f59 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f54:	5b                   	pop    %ebx
+  800f55:	5e                   	pop    %esi
+  800f56:	5f                   	pop    %edi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+  800f5c:	50                   	push   %eax
+  800f5d:	6a 0a                	push   $0xa
+  800f5f:	68 ab 48 80 00       	push   $0x8048ab
+  800f64:	6a 23                	push   $0x23
+  800f66:	68 c8 48 80 00       	push   $0x8048c8
+  800f6b:	e8 6d f2 ff ff       	call   8001dd <_panic>
+
+00800f70 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f81:	be 00 00 00 00       	mov    $0x0,%esi
+  800f86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5e                   	pop    %esi
+  800f90:	5f                   	pop    %edi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+
+00800f93 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fa9:	89 cb                	mov    %ecx,%ebx
+  800fab:	89 cf                	mov    %ecx,%edi
+  800fad:	89 ce                	mov    %ecx,%esi
+  800faf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb1:	85 c0                	test   %eax,%eax
+  800fb3:	7f 08                	jg     800fbd <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb8:	5b                   	pop    %ebx
+  800fb9:	5e                   	pop    %esi
+  800fba:	5f                   	pop    %edi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+  800fc0:	50                   	push   %eax
+  800fc1:	6a 0d                	push   $0xd
+  800fc3:	68 ab 48 80 00       	push   $0x8048ab
+  800fc8:	6a 23                	push   $0x23
+  800fca:	68 c8 48 80 00       	push   $0x8048c8
+  800fcf:	e8 09 f2 ff ff       	call   8001dd <_panic>
+
+00800fd4 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800fd4:	55                   	push   %ebp
+  800fd5:	89 e5                	mov    %esp,%ebp
+  800fd7:	57                   	push   %edi
+  800fd8:	56                   	push   %esi
+  800fd9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800feb:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fee:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80100e:	89 df                	mov    %ebx,%edi
+  801010:	89 de                	mov    %ebx,%esi
+  801012:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801014:	85 c0                	test   %eax,%eax
+  801016:	7f 08                	jg     801020 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801020:	83 ec 0c             	sub    $0xc,%esp
+  801023:	50                   	push   %eax
+  801024:	6a 0d                	push   $0xd
+  801026:	68 ab 48 80 00       	push   $0x8048ab
+  80102b:	6a 23                	push   $0x23
+  80102d:	68 c8 48 80 00       	push   $0x8048c8
+  801032:	e8 a6 f1 ff ff       	call   8001dd <_panic>
+
+00801037 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801042:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801047:	89 d1                	mov    %edx,%ecx
+  801049:	89 d3                	mov    %edx,%ebx
+  80104b:	89 d7                	mov    %edx,%edi
+  80104d:	89 d6                	mov    %edx,%esi
+  80104f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801051:	5b                   	pop    %ebx
+  801052:	5e                   	pop    %esi
+  801053:	5f                   	pop    %edi
+  801054:	5d                   	pop    %ebp
+  801055:	c3                   	ret
+
+00801056 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801056:	55                   	push   %ebp
+  801057:	89 e5                	mov    %esp,%ebp
+  801059:	57                   	push   %edi
+  80105a:	56                   	push   %esi
+  80105b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	89 de                	mov    %ebx,%esi
+  801070:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	b8 10 00 00 00       	mov    $0x10,%eax
+  80108a:	89 cb                	mov    %ecx,%ebx
+  80108c:	89 cf                	mov    %ecx,%edi
+  80108e:	89 ce                	mov    %ecx,%esi
+  801090:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	89 de                	mov    %ebx,%esi
+  8010b1:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8010b3:	5b                   	pop    %ebx
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5f                   	pop    %edi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	c3                   	ret
+
+008010b8 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	57                   	push   %edi
+  8010bc:	56                   	push   %esi
+  8010bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c9:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010ce:	89 df                	mov    %ebx,%edi
+  8010d0:	89 de                	mov    %ebx,%esi
+  8010d2:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8010d4:	5b                   	pop    %ebx
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5f                   	pop    %edi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	c3                   	ret
+
+008010d9 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	57                   	push   %edi
+  8010dd:	56                   	push   %esi
+  8010de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ec:	89 cb                	mov    %ecx,%ebx
+  8010ee:	89 cf                	mov    %ecx,%edi
+  8010f0:	89 ce                	mov    %ecx,%esi
+  8010f2:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5f                   	pop    %edi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+
+008010f9 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	56                   	push   %esi
+  8010fe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801104:	8b 55 08             	mov    0x8(%ebp),%edx
+  801107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80110f:	89 df                	mov    %ebx,%edi
+  801111:	89 de                	mov    %ebx,%esi
+  801113:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801115:	5b                   	pop    %ebx
+  801116:	5e                   	pop    %esi
+  801117:	5f                   	pop    %edi
+  801118:	5d                   	pop    %ebp
+  801119:	c3                   	ret
+
+0080111a <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+  80111d:	57                   	push   %edi
+  80111e:	56                   	push   %esi
+  80111f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801120:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	b8 15 00 00 00       	mov    $0x15,%eax
+  80112d:	89 cb                	mov    %ecx,%ebx
+  80112f:	89 cf                	mov    %ecx,%edi
+  801131:	89 ce                	mov    %ecx,%esi
+  801133:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801135:	5b                   	pop    %ebx
+  801136:	5e                   	pop    %esi
+  801137:	5f                   	pop    %edi
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+
+0080113a <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	57                   	push   %edi
+  80113e:	56                   	push   %esi
+  80113f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801140:	be 00 00 00 00       	mov    $0x0,%esi
+  801145:	8b 55 08             	mov    0x8(%ebp),%edx
+  801148:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801150:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801153:	89 f7                	mov    %esi,%edi
+  801155:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801157:	5b                   	pop    %ebx
+  801158:	5e                   	pop    %esi
+  801159:	5f                   	pop    %edi
+  80115a:	5d                   	pop    %ebp
+  80115b:	c3                   	ret
+
+0080115c <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	89 de                	mov    %ebx,%esi
+  801176:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+
+0080117d <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801183:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801190:	89 cb                	mov    %ecx,%ebx
+  801192:	89 cf                	mov    %ecx,%edi
+  801194:	89 ce                	mov    %ecx,%esi
+  801196:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+
+0080119d <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	57                   	push   %edi
+  8011a1:	56                   	push   %esi
+  8011a2:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8011a3:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8011a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011af:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011b4:	89 df                	mov    %ebx,%edi
+  8011b6:	89 de                	mov    %ebx,%esi
+  8011b8:	cd 30                	int    $0x30
+}
+  8011ba:	5b                   	pop    %ebx
+  8011bb:	5e                   	pop    %esi
+  8011bc:	5f                   	pop    %edi
+  8011bd:	5d                   	pop    %ebp
+  8011be:	c3                   	ret
+
+008011bf <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	57                   	push   %edi
+  8011c3:	56                   	push   %esi
+  8011c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d8:	89 f7                	mov    %esi,%edi
+  8011da:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8011dc:	5b                   	pop    %ebx
+  8011dd:	5e                   	pop    %esi
+  8011de:	5f                   	pop    %edi
+  8011df:	5d                   	pop    %ebp
+  8011e0:	c3                   	ret
+
+008011e1 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	57                   	push   %edi
+  8011e5:	56                   	push   %esi
+  8011e6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fa:	89 f7                	mov    %esi,%edi
+  8011fc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8011fe:	5b                   	pop    %ebx
+  8011ff:	5e                   	pop    %esi
+  801200:	5f                   	pop    %edi
+  801201:	5d                   	pop    %ebp
+  801202:	c3                   	ret
+
+00801203 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	57                   	push   %edi
+  801207:	56                   	push   %esi
+  801208:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801209:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801211:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801214:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801219:	89 df                	mov    %ebx,%edi
+  80121b:	89 de                	mov    %ebx,%esi
+  80121d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80121f:	5b                   	pop    %ebx
+  801220:	5e                   	pop    %esi
+  801221:	5f                   	pop    %edi
+  801222:	5d                   	pop    %ebp
+  801223:	c3                   	ret
+
+00801224 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801224:	55                   	push   %ebp
+  801225:	89 e5                	mov    %esp,%ebp
+  801227:	57                   	push   %edi
+  801228:	56                   	push   %esi
+  801229:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122a:	be 00 00 00 00       	mov    $0x0,%esi
+  80122f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801235:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80123a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123d:	89 f7                	mov    %esi,%edi
+  80123f:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5f                   	pop    %edi
+  801244:	5d                   	pop    %ebp
+  801245:	c3                   	ret
+
+00801246 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801249:	8b 45 08             	mov    0x8(%ebp),%eax
+  80124c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801251:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801254:	5d                   	pop    %ebp
+  801255:	c3                   	ret
+
+00801256 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801259:	8b 45 08             	mov    0x8(%ebp),%eax
+  80125c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801261:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801266:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+
+0080126d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801275:	89 c2                	mov    %eax,%edx
+  801277:	c1 ea 16             	shr    $0x16,%edx
+  80127a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801281:	f6 c2 01             	test   $0x1,%dl
+  801284:	74 29                	je     8012af <fd_alloc+0x42>
+  801286:	89 c2                	mov    %eax,%edx
+  801288:	c1 ea 0c             	shr    $0xc,%edx
+  80128b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801292:	f6 c2 01             	test   $0x1,%dl
+  801295:	74 18                	je     8012af <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801297:	05 00 10 00 00       	add    $0x1000,%eax
+  80129c:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8012a1:	75 d2                	jne    801275 <fd_alloc+0x8>
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012a8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012ad:	eb 05                	jmp    8012b4 <fd_alloc+0x47>
+			return 0;
+  8012af:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b7:	89 02                	mov    %eax,(%edx)
+}
+  8012b9:	89 c8                	mov    %ecx,%eax
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+
+008012bd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012bd:	55                   	push   %ebp
+  8012be:	89 e5                	mov    %esp,%ebp
+  8012c0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012c3:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8012c8:	77 30                	ja     8012fa <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012ca:	c1 e0 0c             	shl    $0xc,%eax
+  8012cd:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8012d2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012d8:	f6 c2 01             	test   $0x1,%dl
+  8012db:	74 24                	je     801301 <fd_lookup+0x44>
+  8012dd:	89 c2                	mov    %eax,%edx
+  8012df:	c1 ea 0c             	shr    $0xc,%edx
+  8012e2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012e9:	f6 c2 01             	test   $0x1,%dl
+  8012ec:	74 1a                	je     801308 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012f1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012f8:	5d                   	pop    %ebp
+  8012f9:	c3                   	ret
+		return -E_INVAL;
+  8012fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ff:	eb f7                	jmp    8012f8 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801301:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801306:	eb f0                	jmp    8012f8 <fd_lookup+0x3b>
+  801308:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80130d:	eb e9                	jmp    8012f8 <fd_lookup+0x3b>
+
+0080130f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	53                   	push   %ebx
+  801313:	83 ec 04             	sub    $0x4,%esp
+  801316:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131e:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801323:	39 13                	cmp    %edx,(%ebx)
+  801325:	74 54                	je     80137b <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801327:	83 c0 01             	add    $0x1,%eax
+  80132a:	8b 1c 85 54 49 80 00 	mov    0x804954(,%eax,4),%ebx
+  801331:	85 db                	test   %ebx,%ebx
+  801333:	75 ee                	jne    801323 <dev_lookup+0x14>
+  801335:	89 e1                	mov    %esp,%ecx
+  801337:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80133c:	29 c8                	sub    %ecx,%eax
+  80133e:	89 c1                	mov    %eax,%ecx
+  801340:	c1 e9 0f             	shr    $0xf,%ecx
+  801343:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134d:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801350:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  801357:	8b 40 48             	mov    0x48(%eax),%eax
+  80135a:	83 ec 04             	sub    $0x4,%esp
+  80135d:	52                   	push   %edx
+  80135e:	50                   	push   %eax
+  80135f:	68 d8 48 80 00       	push   $0x8048d8
+  801364:	e8 4f ef ff ff       	call   8002b8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801371:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801374:	89 1a                	mov    %ebx,(%edx)
+}
+  801376:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801379:	c9                   	leave
+  80137a:	c3                   	ret
+			return 0;
+  80137b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801380:	eb ef                	jmp    801371 <dev_lookup+0x62>
+
+00801382 <fd_close>:
+{
+  801382:	55                   	push   %ebp
+  801383:	89 e5                	mov    %esp,%ebp
+  801385:	57                   	push   %edi
+  801386:	56                   	push   %esi
+  801387:	53                   	push   %ebx
+  801388:	83 ec 24             	sub    $0x24,%esp
+  80138b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80138e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801391:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801394:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801395:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80139b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80139e:	50                   	push   %eax
+  80139f:	e8 19 ff ff ff       	call   8012bd <fd_lookup>
+  8013a4:	89 c3                	mov    %eax,%ebx
+  8013a6:	83 c4 10             	add    $0x10,%esp
+  8013a9:	85 c0                	test   %eax,%eax
+  8013ab:	78 05                	js     8013b2 <fd_close+0x30>
+	    || fd != fd2)
+  8013ad:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013b0:	74 0f                	je     8013c1 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8013b2:	85 ff                	test   %edi,%edi
+  8013b4:	0f 44 df             	cmove  %edi,%ebx
+}
+  8013b7:	89 d8                	mov    %ebx,%eax
+  8013b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5f                   	pop    %edi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013c1:	83 ec 08             	sub    $0x8,%esp
+  8013c4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013c7:	50                   	push   %eax
+  8013c8:	ff 36                	push   (%esi)
+  8013ca:	e8 40 ff ff ff       	call   80130f <dev_lookup>
+  8013cf:	89 c3                	mov    %eax,%ebx
+  8013d1:	83 c4 10             	add    $0x10,%esp
+  8013d4:	85 c0                	test   %eax,%eax
+  8013d6:	78 1a                	js     8013f2 <fd_close+0x70>
+		if (dev->dev_close)
+  8013d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013db:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013e3:	85 c0                	test   %eax,%eax
+  8013e5:	74 0b                	je     8013f2 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8013e7:	83 ec 0c             	sub    $0xc,%esp
+  8013ea:	56                   	push   %esi
+  8013eb:	ff d0                	call   *%eax
+  8013ed:	89 c3                	mov    %eax,%ebx
+  8013ef:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013f2:	83 ec 08             	sub    $0x8,%esp
+  8013f5:	56                   	push   %esi
+  8013f6:	6a 00                	push   $0x0
+  8013f8:	e8 6b fa ff ff       	call   800e68 <sys_page_unmap>
+	return r;
+  8013fd:	83 c4 10             	add    $0x10,%esp
+  801400:	eb b5                	jmp    8013b7 <fd_close+0x35>
+
+00801402 <close>:
+
+int
+close(int fdnum)
+{
+  801402:	55                   	push   %ebp
+  801403:	89 e5                	mov    %esp,%ebp
+  801405:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801408:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140b:	50                   	push   %eax
+  80140c:	ff 75 08             	push   0x8(%ebp)
+  80140f:	e8 a9 fe ff ff       	call   8012bd <fd_lookup>
+  801414:	83 c4 10             	add    $0x10,%esp
+  801417:	85 c0                	test   %eax,%eax
+  801419:	79 02                	jns    80141d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+		return fd_close(fd, 1);
+  80141d:	83 ec 08             	sub    $0x8,%esp
+  801420:	6a 01                	push   $0x1
+  801422:	ff 75 f4             	push   -0xc(%ebp)
+  801425:	e8 58 ff ff ff       	call   801382 <fd_close>
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	eb ec                	jmp    80141b <close+0x19>
+
+0080142f <close_all>:
+
+void
+close_all(void)
+{
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  801432:	53                   	push   %ebx
+  801433:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801436:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80143b:	83 ec 0c             	sub    $0xc,%esp
+  80143e:	53                   	push   %ebx
+  80143f:	e8 be ff ff ff       	call   801402 <close>
+	for (i = 0; i < MAXFD; i++)
+  801444:	83 c3 01             	add    $0x1,%ebx
+  801447:	83 c4 10             	add    $0x10,%esp
+  80144a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801450:	75 e9                	jne    80143b <close_all+0xc>
+}
+  801452:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801455:	c9                   	leave
+  801456:	c3                   	ret
+
+00801457 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801457:	55                   	push   %ebp
+  801458:	89 e5                	mov    %esp,%ebp
+  80145a:	57                   	push   %edi
+  80145b:	56                   	push   %esi
+  80145c:	53                   	push   %ebx
+  80145d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801460:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801463:	50                   	push   %eax
+  801464:	ff 75 08             	push   0x8(%ebp)
+  801467:	e8 51 fe ff ff       	call   8012bd <fd_lookup>
+  80146c:	89 c3                	mov    %eax,%ebx
+  80146e:	83 c4 10             	add    $0x10,%esp
+  801471:	85 c0                	test   %eax,%eax
+  801473:	78 7f                	js     8014f4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801475:	83 ec 0c             	sub    $0xc,%esp
+  801478:	ff 75 0c             	push   0xc(%ebp)
+  80147b:	e8 82 ff ff ff       	call   801402 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801480:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801483:	c1 e6 0c             	shl    $0xc,%esi
+  801486:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80148c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80148f:	89 3c 24             	mov    %edi,(%esp)
+  801492:	e8 bf fd ff ff       	call   801256 <fd2data>
+  801497:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801499:	89 34 24             	mov    %esi,(%esp)
+  80149c:	e8 b5 fd ff ff       	call   801256 <fd2data>
+  8014a1:	83 c4 10             	add    $0x10,%esp
+  8014a4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8014a7:	89 d8                	mov    %ebx,%eax
+  8014a9:	c1 e8 16             	shr    $0x16,%eax
+  8014ac:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014b3:	a8 01                	test   $0x1,%al
+  8014b5:	74 11                	je     8014c8 <dup+0x71>
+  8014b7:	89 d8                	mov    %ebx,%eax
+  8014b9:	c1 e8 0c             	shr    $0xc,%eax
+  8014bc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014c3:	f6 c2 01             	test   $0x1,%dl
+  8014c6:	75 36                	jne    8014fe <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014c8:	89 f8                	mov    %edi,%eax
+  8014ca:	c1 e8 0c             	shr    $0xc,%eax
+  8014cd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014d4:	83 ec 0c             	sub    $0xc,%esp
+  8014d7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014dc:	50                   	push   %eax
+  8014dd:	56                   	push   %esi
+  8014de:	6a 00                	push   $0x0
+  8014e0:	57                   	push   %edi
+  8014e1:	6a 00                	push   $0x0
+  8014e3:	e8 3e f9 ff ff       	call   800e26 <sys_page_map>
+  8014e8:	89 c3                	mov    %eax,%ebx
+  8014ea:	83 c4 20             	add    $0x20,%esp
+  8014ed:	85 c0                	test   %eax,%eax
+  8014ef:	78 33                	js     801524 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014f4:	89 d8                	mov    %ebx,%eax
+  8014f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f9:	5b                   	pop    %ebx
+  8014fa:	5e                   	pop    %esi
+  8014fb:	5f                   	pop    %edi
+  8014fc:	5d                   	pop    %ebp
+  8014fd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801505:	83 ec 0c             	sub    $0xc,%esp
+  801508:	25 07 0e 00 00       	and    $0xe07,%eax
+  80150d:	50                   	push   %eax
+  80150e:	ff 75 d4             	push   -0x2c(%ebp)
+  801511:	6a 00                	push   $0x0
+  801513:	53                   	push   %ebx
+  801514:	6a 00                	push   $0x0
+  801516:	e8 0b f9 ff ff       	call   800e26 <sys_page_map>
+  80151b:	89 c3                	mov    %eax,%ebx
+  80151d:	83 c4 20             	add    $0x20,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	79 a4                	jns    8014c8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801524:	83 ec 08             	sub    $0x8,%esp
+  801527:	56                   	push   %esi
+  801528:	6a 00                	push   $0x0
+  80152a:	e8 39 f9 ff ff       	call   800e68 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80152f:	83 c4 08             	add    $0x8,%esp
+  801532:	ff 75 d4             	push   -0x2c(%ebp)
+  801535:	6a 00                	push   $0x0
+  801537:	e8 2c f9 ff ff       	call   800e68 <sys_page_unmap>
+	return r;
+  80153c:	83 c4 10             	add    $0x10,%esp
+  80153f:	eb b3                	jmp    8014f4 <dup+0x9d>
+
+00801541 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+  801546:	83 ec 18             	sub    $0x18,%esp
+  801549:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80154c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80154f:	50                   	push   %eax
+  801550:	53                   	push   %ebx
+  801551:	e8 67 fd ff ff       	call   8012bd <fd_lookup>
+  801556:	83 c4 10             	add    $0x10,%esp
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	78 3c                	js     801599 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801560:	83 ec 08             	sub    $0x8,%esp
+  801563:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801566:	50                   	push   %eax
+  801567:	ff 36                	push   (%esi)
+  801569:	e8 a1 fd ff ff       	call   80130f <dev_lookup>
+  80156e:	83 c4 10             	add    $0x10,%esp
+  801571:	85 c0                	test   %eax,%eax
+  801573:	78 24                	js     801599 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801575:	8b 46 08             	mov    0x8(%esi),%eax
+  801578:	83 e0 03             	and    $0x3,%eax
+  80157b:	83 f8 01             	cmp    $0x1,%eax
+  80157e:	74 20                	je     8015a0 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801580:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801583:	8b 40 08             	mov    0x8(%eax),%eax
+  801586:	85 c0                	test   %eax,%eax
+  801588:	74 54                	je     8015de <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80158a:	83 ec 04             	sub    $0x4,%esp
+  80158d:	ff 75 10             	push   0x10(%ebp)
+  801590:	ff 75 0c             	push   0xc(%ebp)
+  801593:	56                   	push   %esi
+  801594:	ff d0                	call   *%eax
+  801596:	83 c4 10             	add    $0x10,%esp
+}
+  801599:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159c:	5b                   	pop    %ebx
+  80159d:	5e                   	pop    %esi
+  80159e:	5d                   	pop    %ebp
+  80159f:	c3                   	ret
+  8015a0:	89 e2                	mov    %esp,%edx
+  8015a2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015a7:	29 d0                	sub    %edx,%eax
+  8015a9:	89 c2                	mov    %eax,%edx
+  8015ab:	c1 ea 0f             	shr    $0xf,%edx
+  8015ae:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b8:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015bb:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  8015c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8015c5:	83 ec 04             	sub    $0x4,%esp
+  8015c8:	53                   	push   %ebx
+  8015c9:	50                   	push   %eax
+  8015ca:	68 19 49 80 00       	push   $0x804919
+  8015cf:	e8 e4 ec ff ff       	call   8002b8 <cprintf>
+		return -E_INVAL;
+  8015d4:	83 c4 10             	add    $0x10,%esp
+  8015d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015dc:	eb bb                	jmp    801599 <read+0x58>
+		return -E_NOT_SUPP;
+  8015de:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e3:	eb b4                	jmp    801599 <read+0x58>
+
+008015e5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+  8015e8:	57                   	push   %edi
+  8015e9:	56                   	push   %esi
+  8015ea:	53                   	push   %ebx
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8015f1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015f4:	85 f6                	test   %esi,%esi
+  8015f6:	74 30                	je     801628 <readn+0x43>
+  8015f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fd:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801602:	83 ec 04             	sub    $0x4,%esp
+  801605:	89 f2                	mov    %esi,%edx
+  801607:	29 c2                	sub    %eax,%edx
+  801609:	52                   	push   %edx
+  80160a:	01 f8                	add    %edi,%eax
+  80160c:	50                   	push   %eax
+  80160d:	ff 75 08             	push   0x8(%ebp)
+  801610:	e8 2c ff ff ff       	call   801541 <read>
+		if (m < 0)
+  801615:	83 c4 10             	add    $0x10,%esp
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	78 15                	js     801631 <readn+0x4c>
+			return m;
+		if (m == 0)
+  80161c:	74 11                	je     80162f <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80161e:	01 c3                	add    %eax,%ebx
+  801620:	89 d8                	mov    %ebx,%eax
+  801622:	39 f3                	cmp    %esi,%ebx
+  801624:	72 dc                	jb     801602 <readn+0x1d>
+  801626:	eb 09                	jmp    801631 <readn+0x4c>
+  801628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162d:	eb 02                	jmp    801631 <readn+0x4c>
+  80162f:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801634:	5b                   	pop    %ebx
+  801635:	5e                   	pop    %esi
+  801636:	5f                   	pop    %edi
+  801637:	5d                   	pop    %ebp
+  801638:	c3                   	ret
+
+00801639 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801639:	55                   	push   %ebp
+  80163a:	89 e5                	mov    %esp,%ebp
+  80163c:	56                   	push   %esi
+  80163d:	53                   	push   %ebx
+  80163e:	83 ec 18             	sub    $0x18,%esp
+  801641:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801644:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801647:	50                   	push   %eax
+  801648:	53                   	push   %ebx
+  801649:	e8 6f fc ff ff       	call   8012bd <fd_lookup>
+  80164e:	83 c4 10             	add    $0x10,%esp
+  801651:	85 c0                	test   %eax,%eax
+  801653:	78 37                	js     80168c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801655:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801658:	83 ec 08             	sub    $0x8,%esp
+  80165b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165e:	50                   	push   %eax
+  80165f:	ff 36                	push   (%esi)
+  801661:	e8 a9 fc ff ff       	call   80130f <dev_lookup>
+  801666:	83 c4 10             	add    $0x10,%esp
+  801669:	85 c0                	test   %eax,%eax
+  80166b:	78 1f                	js     80168c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80166d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801671:	74 20                	je     801693 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801673:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801676:	8b 40 0c             	mov    0xc(%eax),%eax
+  801679:	85 c0                	test   %eax,%eax
+  80167b:	74 54                	je     8016d1 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80167d:	83 ec 04             	sub    $0x4,%esp
+  801680:	ff 75 10             	push   0x10(%ebp)
+  801683:	ff 75 0c             	push   0xc(%ebp)
+  801686:	56                   	push   %esi
+  801687:	ff d0                	call   *%eax
+  801689:	83 c4 10             	add    $0x10,%esp
+}
+  80168c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80168f:	5b                   	pop    %ebx
+  801690:	5e                   	pop    %esi
+  801691:	5d                   	pop    %ebp
+  801692:	c3                   	ret
+  801693:	89 e2                	mov    %esp,%edx
+  801695:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80169a:	29 d0                	sub    %edx,%eax
+  80169c:	89 c2                	mov    %eax,%edx
+  80169e:	c1 ea 0f             	shr    $0xf,%edx
+  8016a1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ab:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016ae:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  8016b5:	8b 40 48             	mov    0x48(%eax),%eax
+  8016b8:	83 ec 04             	sub    $0x4,%esp
+  8016bb:	53                   	push   %ebx
+  8016bc:	50                   	push   %eax
+  8016bd:	68 35 49 80 00       	push   $0x804935
+  8016c2:	e8 f1 eb ff ff       	call   8002b8 <cprintf>
+		return -E_INVAL;
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016cf:	eb bb                	jmp    80168c <write+0x53>
+		return -E_NOT_SUPP;
+  8016d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d6:	eb b4                	jmp    80168c <write+0x53>
+
+008016d8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016d8:	55                   	push   %ebp
+  8016d9:	89 e5                	mov    %esp,%ebp
+  8016db:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e1:	50                   	push   %eax
+  8016e2:	ff 75 08             	push   0x8(%ebp)
+  8016e5:	e8 d3 fb ff ff       	call   8012bd <fd_lookup>
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	78 0e                	js     8016ff <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016ff:	c9                   	leave
+  801700:	c3                   	ret
+
+00801701 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801701:	55                   	push   %ebp
+  801702:	89 e5                	mov    %esp,%ebp
+  801704:	53                   	push   %ebx
+  801705:	83 ec 1c             	sub    $0x1c,%esp
+  801708:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80170b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170e:	50                   	push   %eax
+  80170f:	ff 75 08             	push   0x8(%ebp)
+  801712:	e8 a6 fb ff ff       	call   8012bd <fd_lookup>
+  801717:	83 c4 10             	add    $0x10,%esp
+  80171a:	85 c0                	test   %eax,%eax
+  80171c:	78 33                	js     801751 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80171e:	83 fb 03             	cmp    $0x3,%ebx
+  801721:	74 28                	je     80174b <fcntl+0x4a>
+  801723:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801728:	83 fb 04             	cmp    $0x4,%ebx
+  80172b:	75 24                	jne    801751 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80172d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801730:	8b 41 08             	mov    0x8(%ecx),%eax
+  801733:	80 e4 ef             	and    $0xef,%ah
+  801736:	8b 55 10             	mov    0x10(%ebp),%edx
+  801739:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80173f:	09 d0                	or     %edx,%eax
+  801741:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801744:	b8 00 00 00 00       	mov    $0x0,%eax
+  801749:	eb 06                	jmp    801751 <fcntl+0x50>
+		return fd->fd_omode;
+  80174b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80174e:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+
+00801756 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801756:	55                   	push   %ebp
+  801757:	89 e5                	mov    %esp,%ebp
+  801759:	56                   	push   %esi
+  80175a:	53                   	push   %ebx
+  80175b:	83 ec 18             	sub    $0x18,%esp
+  80175e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801761:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801764:	50                   	push   %eax
+  801765:	53                   	push   %ebx
+  801766:	e8 52 fb ff ff       	call   8012bd <fd_lookup>
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	78 34                	js     8017a6 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801772:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801775:	83 ec 08             	sub    $0x8,%esp
+  801778:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80177b:	50                   	push   %eax
+  80177c:	ff 36                	push   (%esi)
+  80177e:	e8 8c fb ff ff       	call   80130f <dev_lookup>
+  801783:	83 c4 10             	add    $0x10,%esp
+  801786:	85 c0                	test   %eax,%eax
+  801788:	78 1c                	js     8017a6 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80178a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80178e:	74 1d                	je     8017ad <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801790:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801793:	8b 40 18             	mov    0x18(%eax),%eax
+  801796:	85 c0                	test   %eax,%eax
+  801798:	74 51                	je     8017eb <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80179a:	83 ec 08             	sub    $0x8,%esp
+  80179d:	ff 75 0c             	push   0xc(%ebp)
+  8017a0:	56                   	push   %esi
+  8017a1:	ff d0                	call   *%eax
+  8017a3:	83 c4 10             	add    $0x10,%esp
+}
+  8017a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a9:	5b                   	pop    %ebx
+  8017aa:	5e                   	pop    %esi
+  8017ab:	5d                   	pop    %ebp
+  8017ac:	c3                   	ret
+  8017ad:	89 e2                	mov    %esp,%edx
+  8017af:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017b4:	29 d0                	sub    %edx,%eax
+  8017b6:	89 c2                	mov    %eax,%edx
+  8017b8:	c1 ea 0f             	shr    $0xf,%edx
+  8017bb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c5:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8017c8:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  8017cf:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017d2:	83 ec 04             	sub    $0x4,%esp
+  8017d5:	53                   	push   %ebx
+  8017d6:	50                   	push   %eax
+  8017d7:	68 f8 48 80 00       	push   $0x8048f8
+  8017dc:	e8 d7 ea ff ff       	call   8002b8 <cprintf>
+		return -E_INVAL;
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e9:	eb bb                	jmp    8017a6 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017f0:	eb b4                	jmp    8017a6 <ftruncate+0x50>
+
+008017f2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017f2:	55                   	push   %ebp
+  8017f3:	89 e5                	mov    %esp,%ebp
+  8017f5:	56                   	push   %esi
+  8017f6:	53                   	push   %ebx
+  8017f7:	83 ec 18             	sub    $0x18,%esp
+  8017fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801800:	50                   	push   %eax
+  801801:	ff 75 08             	push   0x8(%ebp)
+  801804:	e8 b4 fa ff ff       	call   8012bd <fd_lookup>
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	85 c0                	test   %eax,%eax
+  80180e:	78 53                	js     801863 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801810:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801813:	83 ec 08             	sub    $0x8,%esp
+  801816:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801819:	50                   	push   %eax
+  80181a:	ff 36                	push   (%esi)
+  80181c:	e8 ee fa ff ff       	call   80130f <dev_lookup>
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	85 c0                	test   %eax,%eax
+  801826:	78 3b                	js     801863 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801828:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80182f:	74 39                	je     80186a <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801831:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801834:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80183b:	00 00 00 
+	stat->st_isdir = 0;
+  80183e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801845:	00 00 00 
+	stat->st_version = 0;
+  801848:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80184f:	00 00 00 
+	stat->st_dev = dev;
+  801852:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801858:	83 ec 08             	sub    $0x8,%esp
+  80185b:	53                   	push   %ebx
+  80185c:	56                   	push   %esi
+  80185d:	ff 50 14             	call   *0x14(%eax)
+  801860:	83 c4 10             	add    $0x10,%esp
+}
+  801863:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801866:	5b                   	pop    %ebx
+  801867:	5e                   	pop    %esi
+  801868:	5d                   	pop    %ebp
+  801869:	c3                   	ret
+		return -E_NOT_SUPP;
+  80186a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80186f:	eb f2                	jmp    801863 <fstat+0x71>
+
+00801871 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  801874:	56                   	push   %esi
+  801875:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801876:	83 ec 08             	sub    $0x8,%esp
+  801879:	6a 00                	push   $0x0
+  80187b:	ff 75 08             	push   0x8(%ebp)
+  80187e:	e8 b7 01 00 00       	call   801a3a <open>
+  801883:	89 c3                	mov    %eax,%ebx
+  801885:	83 c4 10             	add    $0x10,%esp
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	78 1b                	js     8018a7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80188c:	83 ec 08             	sub    $0x8,%esp
+  80188f:	ff 75 0c             	push   0xc(%ebp)
+  801892:	50                   	push   %eax
+  801893:	e8 5a ff ff ff       	call   8017f2 <fstat>
+  801898:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80189a:	89 1c 24             	mov    %ebx,(%esp)
+  80189d:	e8 60 fb ff ff       	call   801402 <close>
+	return r;
+  8018a2:	83 c4 10             	add    $0x10,%esp
+  8018a5:	89 f3                	mov    %esi,%ebx
+}
+  8018a7:	89 d8                	mov    %ebx,%eax
+  8018a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ac:	5b                   	pop    %ebx
+  8018ad:	5e                   	pop    %esi
+  8018ae:	5d                   	pop    %ebp
+  8018af:	c3                   	ret
+
+008018b0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	56                   	push   %esi
+  8018b4:	53                   	push   %ebx
+  8018b5:	89 c6                	mov    %eax,%esi
+  8018b7:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8018b9:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8018c0:	74 27                	je     8018e9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018c2:	6a 07                	push   $0x7
+  8018c4:	68 00 70 80 00       	push   $0x807000
+  8018c9:	56                   	push   %esi
+  8018ca:	ff 35 00 60 80 00    	push   0x806000
+  8018d0:	e8 d9 28 00 00       	call   8041ae <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018d5:	83 c4 0c             	add    $0xc,%esp
+  8018d8:	6a 00                	push   $0x0
+  8018da:	53                   	push   %ebx
+  8018db:	6a 00                	push   $0x0
+  8018dd:	e8 3c 26 00 00       	call   803f1e <ipc_recv>
+}
+  8018e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e5:	5b                   	pop    %ebx
+  8018e6:	5e                   	pop    %esi
+  8018e7:	5d                   	pop    %ebp
+  8018e8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018e9:	83 ec 0c             	sub    $0xc,%esp
+  8018ec:	6a 02                	push   $0x2
+  8018ee:	e8 24 29 00 00       	call   804217 <ipc_find_env>
+  8018f3:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018f8:	83 c4 10             	add    $0x10,%esp
+  8018fb:	eb c5                	jmp    8018c2 <fsipc+0x12>
+
+008018fd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018fd:	55                   	push   %ebp
+  8018fe:	89 e5                	mov    %esp,%ebp
+  801900:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801903:	8b 45 08             	mov    0x8(%ebp),%eax
+  801906:	8b 40 0c             	mov    0xc(%eax),%eax
+  801909:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80190e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801911:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801916:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801920:	e8 8b ff ff ff       	call   8018b0 <fsipc>
+}
+  801925:	c9                   	leave
+  801926:	c3                   	ret
+
+00801927 <devfile_flush>:
+{
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80192d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801930:	8b 40 0c             	mov    0xc(%eax),%eax
+  801933:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801938:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801942:	e8 69 ff ff ff       	call   8018b0 <fsipc>
+}
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+00801949 <devfile_stat>:
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	53                   	push   %ebx
+  80194d:	83 ec 04             	sub    $0x4,%esp
+  801950:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801953:	8b 45 08             	mov    0x8(%ebp),%eax
+  801956:	8b 40 0c             	mov    0xc(%eax),%eax
+  801959:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80195e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801963:	b8 05 00 00 00       	mov    $0x5,%eax
+  801968:	e8 43 ff ff ff       	call   8018b0 <fsipc>
+  80196d:	85 c0                	test   %eax,%eax
+  80196f:	78 37                	js     8019a8 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801971:	83 ec 08             	sub    $0x8,%esp
+  801974:	68 00 70 80 00       	push   $0x807000
+  801979:	53                   	push   %ebx
+  80197a:	e8 30 f0 ff ff       	call   8009af <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80197f:	a1 80 70 80 00       	mov    0x807080,%eax
+  801984:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80198a:	a1 84 70 80 00       	mov    0x807084,%eax
+  80198f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801995:	a1 88 70 80 00       	mov    0x807088,%eax
+  80199a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8019a0:	83 c4 10             	add    $0x10,%esp
+  8019a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ab:	c9                   	leave
+  8019ac:	c3                   	ret
+
+008019ad <devfile_write>:
+{
+  8019ad:	55                   	push   %ebp
+  8019ae:	89 e5                	mov    %esp,%ebp
+  8019b0:	83 ec 0c             	sub    $0xc,%esp
+  8019b3:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8019b6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019bb:	39 d0                	cmp    %edx,%eax
+  8019bd:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c3:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019c6:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8019cc:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8019d1:	50                   	push   %eax
+  8019d2:	ff 75 0c             	push   0xc(%ebp)
+  8019d5:	68 08 70 80 00       	push   $0x807008
+  8019da:	e8 80 f1 ff ff       	call   800b5f <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8019df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019e9:	e8 c2 fe ff ff       	call   8018b0 <fsipc>
+}
+  8019ee:	c9                   	leave
+  8019ef:	c3                   	ret
+
+008019f0 <devfile_read>:
+{
+  8019f0:	55                   	push   %ebp
+  8019f1:	89 e5                	mov    %esp,%ebp
+  8019f3:	53                   	push   %ebx
+  8019f4:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019fa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801a02:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a05:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801a0a:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a0f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a14:	e8 97 fe ff ff       	call   8018b0 <fsipc>
+  801a19:	89 c3                	mov    %eax,%ebx
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	78 14                	js     801a33 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801a1f:	83 ec 04             	sub    $0x4,%esp
+  801a22:	50                   	push   %eax
+  801a23:	68 00 70 80 00       	push   $0x807000
+  801a28:	ff 75 0c             	push   0xc(%ebp)
+  801a2b:	e8 2f f1 ff ff       	call   800b5f <memmove>
+	return r;
+  801a30:	83 c4 10             	add    $0x10,%esp
+}
+  801a33:	89 d8                	mov    %ebx,%eax
+  801a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a38:	c9                   	leave
+  801a39:	c3                   	ret
+
+00801a3a <open>:
+{
+  801a3a:	55                   	push   %ebp
+  801a3b:	89 e5                	mov    %esp,%ebp
+  801a3d:	53                   	push   %ebx
+  801a3e:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801a41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a44:	50                   	push   %eax
+  801a45:	e8 23 f8 ff ff       	call   80126d <fd_alloc>
+  801a4a:	89 c3                	mov    %eax,%ebx
+  801a4c:	83 c4 10             	add    $0x10,%esp
+  801a4f:	85 c0                	test   %eax,%eax
+  801a51:	78 2a                	js     801a7d <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801a53:	83 ec 0c             	sub    $0xc,%esp
+  801a56:	ff 75 08             	push   0x8(%ebp)
+  801a59:	e8 05 ef ff ff       	call   800963 <strlen>
+  801a5e:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801a61:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801a66:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a6b:	7e 17                	jle    801a84 <open+0x4a>
+	fd_close(fd, 1);
+  801a6d:	83 ec 08             	sub    $0x8,%esp
+  801a70:	6a 01                	push   $0x1
+  801a72:	ff 75 f4             	push   -0xc(%ebp)
+  801a75:	e8 08 f9 ff ff       	call   801382 <fd_close>
+	return r;
+  801a7a:	83 c4 10             	add    $0x10,%esp
+}
+  801a7d:	89 d8                	mov    %ebx,%eax
+  801a7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a82:	c9                   	leave
+  801a83:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a84:	83 ec 08             	sub    $0x8,%esp
+  801a87:	ff 75 08             	push   0x8(%ebp)
+  801a8a:	68 00 70 80 00       	push   $0x807000
+  801a8f:	e8 1b ef ff ff       	call   8009af <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a97:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a9c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aa4:	e8 07 fe ff ff       	call   8018b0 <fsipc>
+  801aa9:	89 c3                	mov    %eax,%ebx
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	85 c0                	test   %eax,%eax
+  801ab0:	78 bb                	js     801a6d <open+0x33>
+	return fd2num(fd); 	
+  801ab2:	83 ec 0c             	sub    $0xc,%esp
+  801ab5:	ff 75 f4             	push   -0xc(%ebp)
+  801ab8:	e8 89 f7 ff ff       	call   801246 <fd2num>
+  801abd:	89 c3                	mov    %eax,%ebx
+  801abf:	83 c4 10             	add    $0x10,%esp
+  801ac2:	eb b9                	jmp    801a7d <open+0x43>
+
+00801ac4 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801ac4:	55                   	push   %ebp
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	53                   	push   %ebx
+  801ac8:	83 ec 1c             	sub    $0x1c,%esp
+  801acb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ace:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad1:	50                   	push   %eax
+  801ad2:	ff 75 08             	push   0x8(%ebp)
+  801ad5:	e8 e3 f7 ff ff       	call   8012bd <fd_lookup>
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 5a                	js     801b3b <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ae1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae4:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801aea:	39 10                	cmp    %edx,(%eax)
+  801aec:	75 66                	jne    801b54 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801aee:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801af5:	74 49                	je     801b40 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801af7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801afa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801afd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801b02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b05:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801b0a:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b10:	6a 07                	push   $0x7
+  801b12:	68 00 70 80 00       	push   $0x807000
+  801b17:	6a 09                	push   $0x9
+  801b19:	ff 35 00 60 80 00    	push   0x806000
+  801b1f:	e8 8a 26 00 00       	call   8041ae <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801b24:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b2b:	6a 00                	push   $0x0
+  801b2d:	53                   	push   %ebx
+  801b2e:	ff 75 10             	push   0x10(%ebp)
+  801b31:	6a 00                	push   $0x0
+  801b33:	e8 b3 24 00 00       	call   803feb <ipc_recv_pages>
+  801b38:	83 c4 20             	add    $0x20,%esp
+}
+  801b3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b3e:	c9                   	leave
+  801b3f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b40:	83 ec 0c             	sub    $0xc,%esp
+  801b43:	6a 02                	push   $0x2
+  801b45:	e8 cd 26 00 00       	call   804217 <ipc_find_env>
+  801b4a:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b4f:	83 c4 10             	add    $0x10,%esp
+  801b52:	eb a3                	jmp    801af7 <fmap+0x33>
+		return -E_INVAL;
+  801b54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b59:	eb e0                	jmp    801b3b <fmap+0x77>
+
+00801b5b <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b5b:	55                   	push   %ebp
+  801b5c:	89 e5                	mov    %esp,%ebp
+  801b5e:	53                   	push   %ebx
+  801b5f:	83 ec 10             	sub    $0x10,%esp
+  801b62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b65:	53                   	push   %ebx
+  801b66:	e8 f8 ed ff ff       	call   800963 <strlen>
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b73:	7f 25                	jg     801b9a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b75:	83 ec 08             	sub    $0x8,%esp
+  801b78:	53                   	push   %ebx
+  801b79:	68 00 70 80 00       	push   $0x807000
+  801b7e:	e8 2c ee ff ff       	call   8009af <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b88:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b8d:	e8 1e fd ff ff       	call   8018b0 <fsipc>
+  801b92:	83 c4 10             	add    $0x10,%esp
+}
+  801b95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+		return -E_BAD_PATH;
+  801b9a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b9f:	eb f4                	jmp    801b95 <remove+0x3a>
+
+00801ba1 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ba1:	55                   	push   %ebp
+  801ba2:	89 e5                	mov    %esp,%ebp
+  801ba4:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bac:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bb1:	e8 fa fc ff ff       	call   8018b0 <fsipc>
+}
+  801bb6:	c9                   	leave
+  801bb7:	c3                   	ret
+
+00801bb8 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801bb8:	55                   	push   %ebp
+  801bb9:	89 e5                	mov    %esp,%ebp
+  801bbb:	57                   	push   %edi
+  801bbc:	56                   	push   %esi
+  801bbd:	53                   	push   %ebx
+  801bbe:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801bc4:	6a 00                	push   $0x0
+  801bc6:	ff 75 08             	push   0x8(%ebp)
+  801bc9:	e8 6c fe ff ff       	call   801a3a <open>
+  801bce:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	0f 88 ab 04 00 00    	js     80208a <spawn+0x4d2>
+  801bdf:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801be1:	83 ec 04             	sub    $0x4,%esp
+  801be4:	68 00 02 00 00       	push   $0x200
+  801be9:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801bef:	50                   	push   %eax
+  801bf0:	51                   	push   %ecx
+  801bf1:	e8 ef f9 ff ff       	call   8015e5 <readn>
+  801bf6:	83 c4 10             	add    $0x10,%esp
+  801bf9:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801bfe:	0f 85 e6 01 00 00    	jne    801dea <spawn+0x232>
+	    || elf->e_magic != ELF_MAGIC) {
+  801c04:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801c0b:	45 4c 46 
+  801c0e:	0f 85 d6 01 00 00    	jne    801dea <spawn+0x232>
+	__asm __volatile("int %2"
+  801c14:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c19:	cd 30                	int    $0x30
+  801c1b:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	0f 88 55 04 00 00    	js     80207e <spawn+0x4c6>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801c29:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c2e:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+  801c34:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801c3a:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801c40:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801c45:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801c47:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801c4d:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  801c53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c56:	8b 00                	mov    (%eax),%eax
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	0f 84 a5 07 00 00    	je     802405 <spawn+0x84d>
+  801c60:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6a:	8b 75 0c             	mov    0xc(%ebp),%esi
+		string_size += strlen(argv[argc]) + 1;
+  801c6d:	83 ec 0c             	sub    $0xc,%esp
+  801c70:	50                   	push   %eax
+  801c71:	e8 ed ec ff ff       	call   800963 <strlen>
+  801c76:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801c7a:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  801c80:	83 c3 01             	add    $0x1,%ebx
+  801c83:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  801c8a:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	75 d9                	jne    801c6d <spawn+0xb5>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801c94:	89 95 84 fd ff ff    	mov    %edx,-0x27c(%ebp)
+  801c9a:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  801ca0:	be 00 10 40 00       	mov    $0x401000,%esi
+  801ca5:	29 fe                	sub    %edi,%esi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801ca7:	89 f2                	mov    %esi,%edx
+  801ca9:	83 e2 fc             	and    $0xfffffffc,%edx
+  801cac:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801cb2:	8d 04 85 08 00 00 00 	lea    0x8(,%eax,4),%eax
+  801cb9:	29 c2                	sub    %eax,%edx
+  801cbb:	89 d7                	mov    %edx,%edi
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801cbd:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801cc0:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801cc5:	0f 86 ee 06 00 00    	jbe    8023b9 <spawn+0x801>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801ccb:	83 ec 04             	sub    $0x4,%esp
+  801cce:	6a 07                	push   $0x7
+  801cd0:	68 00 00 40 00       	push   $0x400000
+  801cd5:	6a 00                	push   $0x0
+  801cd7:	e8 07 f1 ff ff       	call   800de3 <sys_page_alloc>
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	0f 88 d7 06 00 00    	js     8023be <spawn+0x806>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801ce7:	85 db                	test   %ebx,%ebx
+  801ce9:	7e 58                	jle    801d43 <spawn+0x18b>
+  801ceb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cf0:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  801cf6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		argv_store[i] = UTEMP2USTACK(string_store);
+  801cf9:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801cff:	8d 86 00 d0 7f ee    	lea    -0x11803000(%esi),%eax
+  801d05:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801d0b:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+		strcpy(string_store, argv[i]);
+  801d0e:	83 ec 08             	sub    $0x8,%esp
+  801d11:	ff 34 9f             	push   (%edi,%ebx,4)
+  801d14:	56                   	push   %esi
+  801d15:	e8 95 ec ff ff       	call   8009af <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  801d1a:	83 c4 04             	add    $0x4,%esp
+  801d1d:	ff 34 9f             	push   (%edi,%ebx,4)
+  801d20:	e8 3e ec ff ff       	call   800963 <strlen>
+  801d25:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+  801d29:	83 c3 01             	add    $0x1,%ebx
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  801d35:	39 8d 94 fd ff ff    	cmp    %ecx,-0x26c(%ebp)
+  801d3b:	75 bc                	jne    801cf9 <spawn+0x141>
+  801d3d:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+	}
+	argv_store[argc] = 0;
+  801d43:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  801d49:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801d50:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  801d56:	0f 85 c6 00 00 00    	jne    801e22 <spawn+0x26a>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  801d5c:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801d62:	89 47 fc             	mov    %eax,-0x4(%edi)
+	argv_store[-2] = argc;
+  801d65:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  801d6b:	89 47 f8             	mov    %eax,-0x8(%edi)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801d6e:	8d 87 f8 cf 7f ee    	lea    -0x11803008(%edi),%eax
+  801d74:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801d7a:	83 ec 0c             	sub    $0xc,%esp
+  801d7d:	6a 07                	push   $0x7
+  801d7f:	68 00 d0 bf ee       	push   $0xeebfd000
+  801d84:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801d8a:	68 00 00 40 00       	push   $0x400000
+  801d8f:	6a 00                	push   $0x0
+  801d91:	e8 90 f0 ff ff       	call   800e26 <sys_page_map>
+  801d96:	89 c3                	mov    %eax,%ebx
+  801d98:	83 c4 20             	add    $0x20,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	0f 88 45 06 00 00    	js     8023e8 <spawn+0x830>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801da3:	83 ec 08             	sub    $0x8,%esp
+  801da6:	68 00 00 40 00       	push   $0x400000
+  801dab:	6a 00                	push   $0x0
+  801dad:	e8 b6 f0 ff ff       	call   800e68 <sys_page_unmap>
+  801db2:	89 c3                	mov    %eax,%ebx
+  801db4:	83 c4 10             	add    $0x10,%esp
+  801db7:	85 c0                	test   %eax,%eax
+  801db9:	0f 88 29 06 00 00    	js     8023e8 <spawn+0x830>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  801dbf:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801dc5:	8d 84 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%eax
+  801dcc:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801dd2:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  801dd9:	00 
+  801dda:	0f 84 a4 00 00 00    	je     801e84 <spawn+0x2cc>
+  801de0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de5:	e9 19 03 00 00       	jmp    802103 <spawn+0x54b>
+		close(fd);
+  801dea:	83 ec 0c             	sub    $0xc,%esp
+  801ded:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  801df3:	e8 0a f6 ff ff       	call   801402 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801df8:	83 c4 0c             	add    $0xc,%esp
+  801dfb:	68 7f 45 4c 46       	push   $0x464c457f
+  801e00:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801e06:	68 68 49 80 00       	push   $0x804968
+  801e0b:	e8 a8 e4 ff ff       	call   8002b8 <cprintf>
+		return -E_NOT_EXEC;
+  801e10:	83 c4 10             	add    $0x10,%esp
+  801e13:	c7 85 78 fd ff ff f2 	movl   $0xfffffff2,-0x288(%ebp)
+  801e1a:	ff ff ff 
+  801e1d:	e9 68 02 00 00       	jmp    80208a <spawn+0x4d2>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801e22:	68 e8 49 80 00       	push   $0x8049e8
+  801e27:	68 82 49 80 00       	push   $0x804982
+  801e2c:	68 f1 00 00 00       	push   $0xf1
+  801e31:	68 97 49 80 00       	push   $0x804997
+  801e36:	e8 a2 e3 ff ff       	call   8001dd <_panic>
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
+  801e3b:	50                   	push   %eax
+  801e3c:	68 10 4a 80 00       	push   $0x804a10
+  801e41:	68 2d 01 00 00       	push   $0x12d
+  801e46:	68 97 49 80 00       	push   $0x804997
+  801e4b:	e8 8d e3 ff ff       	call   8001dd <_panic>
+  801e50:	89 c6                	mov    %eax,%esi
+  801e52:	eb 02                	jmp    801e56 <spawn+0x29e>
+  801e54:	89 c6                	mov    %eax,%esi
+	sys_env_destroy(child);
+  801e56:	83 ec 0c             	sub    $0xc,%esp
+  801e59:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801e5f:	e8 00 ef ff ff       	call   800d64 <sys_env_destroy>
+	close(fd);
+  801e64:	83 c4 04             	add    $0x4,%esp
+  801e67:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  801e6d:	e8 90 f5 ff ff       	call   801402 <close>
+	return r;
+  801e72:	83 c4 10             	add    $0x10,%esp
+  801e75:	89 b5 78 fd ff ff    	mov    %esi,-0x288(%ebp)
+  801e7b:	e9 0a 02 00 00       	jmp    80208a <spawn+0x4d2>
+  801e80:	89 c6                	mov    %eax,%esi
+  801e82:	eb d2                	jmp    801e56 <spawn+0x29e>
+	close(fd);
+  801e84:	83 ec 0c             	sub    $0xc,%esp
+  801e87:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  801e8d:	e8 70 f5 ff ff       	call   801402 <close>
+	// LAB 7: Your code here.
+	static struct PageBatch pb;
+	uintptr_t addr;
+	uint32_t pn, pd;
+	int r;
+	pgbatch_init(&pb);
+  801e92:	c7 04 24 20 60 80 00 	movl   $0x806020,(%esp)
+  801e99:	e8 03 1d 00 00       	call   803ba1 <pgbatch_init>
+  801e9e:	83 c4 10             	add    $0x10,%esp
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801ea1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea6:	8b b5 90 fd ff ff    	mov    -0x270(%ebp),%esi
+  801eac:	eb 24                	jmp    801ed2 <spawn+0x31a>
+		pd = PDX(addr);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801eae:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801eb4:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801eba:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801ec0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ec6:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801ecc:	0f 87 18 01 00 00    	ja     801fea <spawn+0x432>
+		pd = PDX(addr);
+  801ed2:	89 d8                	mov    %ebx,%eax
+  801ed4:	c1 e8 16             	shr    $0x16,%eax
+		if (!(vpd[pd] & PTE_P)) {
+  801ed7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ede:	a8 01                	test   $0x1,%al
+  801ee0:	74 cc                	je     801eae <spawn+0x2f6>
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  801ee2:	89 d9                	mov    %ebx,%ecx
+  801ee4:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+  801eea:	74 4c                	je     801f38 <spawn+0x380>
+				continue;
+			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+  801eec:	89 d8                	mov    %ebx,%eax
+  801eee:	c1 e8 0c             	shr    $0xc,%eax
+		if(vpt[pn] & PTE_SHARE) {
+  801ef1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ef8:	f6 c6 04             	test   $0x4,%dh
+  801efb:	74 c3                	je     801ec0 <spawn+0x308>
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+  801efd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f04:	83 ec 08             	sub    $0x8,%esp
+  801f07:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f0c:	50                   	push   %eax
+  801f0d:	53                   	push   %ebx
+  801f0e:	56                   	push   %esi
+  801f0f:	53                   	push   %ebx
+  801f10:	6a 00                	push   $0x0
+  801f12:	68 20 60 80 00       	push   $0x806020
+  801f17:	e8 43 1d 00 00       	call   803c5f <pgbatch_map>
+  801f1c:	83 c4 20             	add    $0x20,%esp
+  801f1f:	85 c0                	test   %eax,%eax
+  801f21:	79 9d                	jns    801ec0 <spawn+0x308>
+				panic("sys_page_batch: %e", r);
+  801f23:	50                   	push   %eax
+  801f24:	68 a3 49 80 00       	push   $0x8049a3
+  801f29:	68 6b 01 00 00       	push   $0x16b
+  801f2e:	68 97 49 80 00       	push   $0x804997
+  801f33:	e8 a5 e2 ff ff       	call   8001dd <_panic>
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  801f38:	89 d8                	mov    %ebx,%eax
+  801f3a:	c1 e8 0c             	shr    $0xc,%eax
+  801f3d:	8d b8 00 04 00 00    	lea    0x400(%eax),%edi
+  801f43:	eb 0a                	jmp    801f4f <spawn+0x397>
+			n++;
+  801f45:	83 c1 01             	add    $0x1,%ecx
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  801f48:	83 c0 01             	add    $0x1,%eax
+  801f4b:	39 f8                	cmp    %edi,%eax
+  801f4d:	73 1a                	jae    801f69 <spawn+0x3b1>
+		if (vpt[pn] & PTE_P) {
+  801f4f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f56:	f6 c2 01             	test   $0x1,%dl
+  801f59:	74 ed                	je     801f48 <spawn+0x390>
+			if (!(vpt[pn] & PTE_SHARE))
+  801f5b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f62:	f6 c6 04             	test   $0x4,%dh
+  801f65:	75 de                	jne    801f45 <spawn+0x38d>
+  801f67:	eb 83                	jmp    801eec <spawn+0x334>
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  801f69:	85 c9                	test   %ecx,%ecx
+  801f6b:	0f 84 7b ff ff ff    	je     801eec <spawn+0x334>
+			if ((r = pgbatch_flush(&pb)) < 0)
+  801f71:	83 ec 0c             	sub    $0xc,%esp
+  801f74:	68 20 60 80 00       	push   $0x806020
+  801f79:	e8 31 1c 00 00       	call   803baf <pgbatch_flush>
+  801f7e:	83 c4 10             	add    $0x10,%esp
+  801f81:	85 c0                	test   %eax,%eax
+  801f83:	78 45                	js     801fca <spawn+0x412>
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+  801f85:	83 ec 0c             	sub    $0xc,%esp
+  801f88:	6a 00                	push   $0x0
+  801f8a:	56                   	push   %esi
+  801f8b:	53                   	push   %ebx
+  801f8c:	6a 00                	push   $0x0
+  801f8e:	68 20 60 80 00       	push   $0x806020
+  801f93:	e8 72 1d 00 00       	call   803d0a <pgbatch_sharept>
+			if ((r = pgbatch_flush(&pb)) == 0) {
+  801f98:	83 c4 14             	add    $0x14,%esp
+  801f9b:	68 20 60 80 00       	push   $0x806020
+  801fa0:	e8 0a 1c 00 00       	call   803baf <pgbatch_flush>
+  801fa5:	83 c4 10             	add    $0x10,%esp
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	74 33                	je     801fdf <spawn+0x427>
+			if (r != -E_INVAL)
+  801fac:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  801faf:	0f 84 37 ff ff ff    	je     801eec <spawn+0x334>
+				panic("sys_page_batch: %e", r);
+  801fb5:	50                   	push   %eax
+  801fb6:	68 a3 49 80 00       	push   $0x8049a3
+  801fbb:	68 66 01 00 00       	push   $0x166
+  801fc0:	68 97 49 80 00       	push   $0x804997
+  801fc5:	e8 13 e2 ff ff       	call   8001dd <_panic>
+				panic("sys_page_batch: %e", r);
+  801fca:	50                   	push   %eax
+  801fcb:	68 a3 49 80 00       	push   $0x8049a3
+  801fd0:	68 5f 01 00 00       	push   $0x15f
+  801fd5:	68 97 49 80 00       	push   $0x804997
+  801fda:	e8 fe e1 ff ff       	call   8001dd <_panic>
+				addr += PTSIZE - PGSIZE;
+  801fdf:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+				continue;
+  801fe5:	e9 d6 fe ff ff       	jmp    801ec0 <spawn+0x308>
+		}
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801fea:	83 ec 0c             	sub    $0xc,%esp
+  801fed:	68 20 60 80 00       	push   $0x806020
+  801ff2:	e8 b8 1b 00 00       	call   803baf <pgbatch_flush>
+  801ff7:	83 c4 10             	add    $0x10,%esp
+  801ffa:	85 c0                	test   %eax,%eax
+  801ffc:	78 41                	js     80203f <spawn+0x487>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  801ffe:	83 ec 08             	sub    $0x8,%esp
+  802001:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802007:	50                   	push   %eax
+  802008:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80200e:	e8 d9 ee ff ff       	call   800eec <sys_env_set_trapframe>
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 3a                	js     802054 <spawn+0x49c>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80201a:	83 ec 08             	sub    $0x8,%esp
+  80201d:	6a 02                	push   $0x2
+  80201f:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802025:	e8 80 ee ff ff       	call   800eaa <sys_env_set_status>
+  80202a:	83 c4 10             	add    $0x10,%esp
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	78 38                	js     802069 <spawn+0x4b1>
+	return child;
+  802031:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802037:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  80203d:	eb 4b                	jmp    80208a <spawn+0x4d2>
+		panic("sys_page_batch: %e", r);
+  80203f:	50                   	push   %eax
+  802040:	68 a3 49 80 00       	push   $0x8049a3
+  802045:	68 6f 01 00 00       	push   $0x16f
+  80204a:	68 97 49 80 00       	push   $0x804997
+  80204f:	e8 89 e1 ff ff       	call   8001dd <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  802054:	50                   	push   %eax
+  802055:	68 b6 49 80 00       	push   $0x8049b6
+  80205a:	68 85 00 00 00       	push   $0x85
+  80205f:	68 97 49 80 00       	push   $0x804997
+  802064:	e8 74 e1 ff ff       	call   8001dd <_panic>
+		panic("sys_env_set_status: %e", r);
+  802069:	50                   	push   %eax
+  80206a:	68 d0 49 80 00       	push   $0x8049d0
+  80206f:	68 88 00 00 00       	push   $0x88
+  802074:	68 97 49 80 00       	push   $0x804997
+  802079:	e8 5f e1 ff ff       	call   8001dd <_panic>
+		return r;
+  80207e:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802084:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+}
+  80208a:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802090:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802093:	5b                   	pop    %ebx
+  802094:	5e                   	pop    %esi
+  802095:	5f                   	pop    %edi
+  802096:	5d                   	pop    %ebp
+  802097:	c3                   	ret
+	for (j = 0; j < n; j++)
+  802098:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  80209e:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  8020a4:	85 db                	test   %ebx,%ebx
+  8020a6:	0f 8e 06 03 00 00    	jle    8023b2 <spawn+0x7fa>
+  8020ac:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8020b2:	c1 e6 0c             	shl    $0xc,%esi
+  8020b5:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  8020ba:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  8020c0:	89 c7                	mov    %eax,%edi
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+  8020c2:	83 ec 08             	sub    $0x8,%esp
+  8020c5:	53                   	push   %ebx
+  8020c6:	6a 00                	push   $0x0
+  8020c8:	e8 9b ed ff ff       	call   800e68 <sys_page_unmap>
+	for (j = 0; j < n; j++)
+  8020cd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	39 f3                	cmp    %esi,%ebx
+  8020d8:	75 e8                	jne    8020c2 <spawn+0x50a>
+  8020da:	89 f8                	mov    %edi,%eax
+  8020dc:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8020e2:	85 c0                	test   %eax,%eax
+  8020e4:	0f 88 66 fd ff ff    	js     801e50 <spawn+0x298>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8020ea:	83 c7 01             	add    $0x1,%edi
+  8020ed:	83 85 7c fd ff ff 20 	addl   $0x20,-0x284(%ebp)
+  8020f4:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8020fb:	39 f8                	cmp    %edi,%eax
+  8020fd:	0f 8e 81 fd ff ff    	jle    801e84 <spawn+0x2cc>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802103:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802109:	83 39 01             	cmpl   $0x1,(%ecx)
+  80210c:	75 dc                	jne    8020ea <spawn+0x532>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80210e:	8b 41 18             	mov    0x18(%ecx),%eax
+  802111:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+  802117:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  80211a:	83 f8 01             	cmp    $0x1,%eax
+  80211d:	19 c0                	sbb    %eax,%eax
+  80211f:	83 e0 fe             	and    $0xfffffffe,%eax
+  802122:	83 c0 07             	add    $0x7,%eax
+  802125:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80212b:	8b 51 04             	mov    0x4(%ecx),%edx
+  80212e:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802134:	8b 59 10             	mov    0x10(%ecx),%ebx
+  802137:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  80213d:	8b 41 14             	mov    0x14(%ecx),%eax
+  802140:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+  802146:	8b 71 08             	mov    0x8(%ecx),%esi
+  802149:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+	if ((i = PGOFF(va))) {
+  80214f:	89 f0                	mov    %esi,%eax
+  802151:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802156:	74 1e                	je     802176 <spawn+0x5be>
+		va -= i;
+  802158:	29 c6                	sub    %eax,%esi
+  80215a:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		memsz += i;
+  802160:	01 85 68 fd ff ff    	add    %eax,-0x298(%ebp)
+		filesz += i;
+  802166:	01 c3                	add    %eax,%ebx
+  802168:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+		fileoffset -= i;
+  80216e:	29 c2                	sub    %eax,%edx
+  802170:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+	pgbatch_init(&pb);
+  802176:	83 ec 0c             	sub    $0xc,%esp
+  802179:	68 40 63 80 00       	push   $0x806340
+  80217e:	e8 1e 1a 00 00       	call   803ba1 <pgbatch_init>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802183:	83 c4 10             	add    $0x10,%esp
+  802186:	83 bd 88 fd ff ff 00 	cmpl   $0x0,-0x278(%ebp)
+  80218d:	0f 84 a6 01 00 00    	je     802339 <spawn+0x781>
+  802193:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  80219a:	00 00 00 
+  80219d:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  8021a4:	00 00 00 
+  8021a7:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  8021ad:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  8021b3:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  8021b9:	29 c7                	sub    %eax,%edi
+  8021bb:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  8021c1:	c1 ee 0c             	shr    $0xc,%esi
+  8021c4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8021c9:	39 c6                	cmp    %eax,%esi
+  8021cb:	0f 47 f0             	cmova  %eax,%esi
+  8021ce:	89 b5 94 fd ff ff    	mov    %esi,-0x26c(%ebp)
+		for (j = 0; j < n; j++)
+  8021d4:	85 f6                	test   %esi,%esi
+  8021d6:	0f 8e ed 01 00 00    	jle    8023c9 <spawn+0x811>
+  8021dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021e1:	89 bd 70 fd ff ff    	mov    %edi,-0x290(%ebp)
+  8021e7:	89 f7                	mov    %esi,%edi
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  8021e9:	6a 07                	push   $0x7
+  8021eb:	89 d8                	mov    %ebx,%eax
+  8021ed:	c1 e0 0c             	shl    $0xc,%eax
+  8021f0:	05 00 00 40 00       	add    $0x400000,%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	6a 00                	push   $0x0
+  8021f8:	68 40 63 80 00       	push   $0x806340
+  8021fd:	e8 26 1a 00 00       	call   803c28 <pgbatch_alloc>
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	85 c0                	test   %eax,%eax
+  802207:	0f 88 47 fc ff ff    	js     801e54 <spawn+0x29c>
+		for (j = 0; j < n; j++)
+  80220d:	83 c3 01             	add    $0x1,%ebx
+  802210:	39 df                	cmp    %ebx,%edi
+  802212:	75 d5                	jne    8021e9 <spawn+0x631>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802214:	8b bd 70 fd ff ff    	mov    -0x290(%ebp),%edi
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	68 40 63 80 00       	push   $0x806340
+  802222:	e8 88 19 00 00       	call   803baf <pgbatch_flush>
+  802227:	83 c4 10             	add    $0x10,%esp
+  80222a:	85 c0                	test   %eax,%eax
+  80222c:	0f 88 66 fe ff ff    	js     802098 <spawn+0x4e0>
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802232:	83 ec 08             	sub    $0x8,%esp
+  802235:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  80223b:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802241:	01 c8                	add    %ecx,%eax
+  802243:	50                   	push   %eax
+  802244:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  80224a:	e8 89 f4 ff ff       	call   8016d8 <seek>
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	85 c0                	test   %eax,%eax
+  802254:	0f 88 3e fe ff ff    	js     802098 <spawn+0x4e0>
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  80225a:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802260:	c1 e3 0c             	shl    $0xc,%ebx
+  802263:	83 ec 04             	sub    $0x4,%esp
+  802266:	39 fb                	cmp    %edi,%ebx
+  802268:	0f 46 fb             	cmovbe %ebx,%edi
+  80226b:	57                   	push   %edi
+  80226c:	68 00 00 40 00       	push   $0x400000
+  802271:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802277:	e8 69 f3 ff ff       	call   8015e5 <readn>
+  80227c:	83 c4 10             	add    $0x10,%esp
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	0f 88 11 fe ff ff    	js     802098 <spawn+0x4e0>
+		for (j = 0; j < n; j++) {
+  802287:	83 bd 94 fd ff ff 00 	cmpl   $0x0,-0x26c(%ebp)
+  80228e:	7e 6b                	jle    8022fb <spawn+0x743>
+  802290:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802296:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  80229c:	01 c7                	add    %eax,%edi
+  80229e:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a3:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+  8022a9:	89 f3                	mov    %esi,%ebx
+  8022ab:	c1 e3 0c             	shl    $0xc,%ebx
+  8022ae:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8022b4:	83 ec 08             	sub    $0x8,%esp
+  8022b7:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8022bd:	57                   	push   %edi
+  8022be:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8022c4:	53                   	push   %ebx
+  8022c5:	6a 00                	push   $0x0
+  8022c7:	68 40 63 80 00       	push   $0x806340
+  8022cc:	e8 8e 19 00 00       	call   803c5f <pgbatch_map>
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+  8022d1:	83 c4 1c             	add    $0x1c,%esp
+  8022d4:	53                   	push   %ebx
+  8022d5:	6a 00                	push   $0x0
+  8022d7:	68 40 63 80 00       	push   $0x806340
+  8022dc:	e8 c1 19 00 00       	call   803ca2 <pgbatch_unmap>
+		for (j = 0; j < n; j++) {
+  8022e1:	83 c6 01             	add    $0x1,%esi
+  8022e4:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8022ea:	83 c4 10             	add    $0x10,%esp
+  8022ed:	39 b5 94 fd ff ff    	cmp    %esi,-0x26c(%ebp)
+  8022f3:	75 b4                	jne    8022a9 <spawn+0x6f1>
+  8022f5:	8b 9d 80 fd ff ff    	mov    -0x280(%ebp),%ebx
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8022fb:	83 ec 0c             	sub    $0xc,%esp
+  8022fe:	68 40 63 80 00       	push   $0x806340
+  802303:	e8 a7 18 00 00       	call   803baf <pgbatch_flush>
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	0f 88 28 fb ff ff    	js     801e3b <spawn+0x283>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802313:	01 9d 84 fd ff ff    	add    %ebx,-0x27c(%ebp)
+  802319:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  80231f:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802325:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  80232b:	39 f0                	cmp    %esi,%eax
+  80232d:	0f 82 7a fe ff ff    	jb     8021ad <spawn+0x5f5>
+  802333:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802339:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80233f:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802344:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802349:	89 c3                	mov    %eax,%ebx
+  80234b:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802351:	39 f0                	cmp    %esi,%eax
+  802353:	73 48                	jae    80239d <spawn+0x7e5>
+  802355:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  80235b:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802361:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+  802367:	56                   	push   %esi
+  802368:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  80236e:	01 d8                	add    %ebx,%eax
+  802370:	50                   	push   %eax
+  802371:	57                   	push   %edi
+  802372:	68 40 63 80 00       	push   $0x806340
+  802377:	e8 ac 18 00 00       	call   803c28 <pgbatch_alloc>
+  80237c:	83 c4 10             	add    $0x10,%esp
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	0f 88 f9 fa ff ff    	js     801e80 <spawn+0x2c8>
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802387:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80238d:	8b 85 68 fd ff ff    	mov    -0x298(%ebp),%eax
+  802393:	39 c3                	cmp    %eax,%ebx
+  802395:	72 d0                	jb     802367 <spawn+0x7af>
+  802397:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+	return pgbatch_flush(&pb);
+  80239d:	83 ec 0c             	sub    $0xc,%esp
+  8023a0:	68 40 63 80 00       	push   $0x806340
+  8023a5:	e8 05 18 00 00       	call   803baf <pgbatch_flush>
+  8023aa:	83 c4 10             	add    $0x10,%esp
+  8023ad:	e9 30 fd ff ff       	jmp    8020e2 <spawn+0x52a>
+  8023b2:	89 c6                	mov    %eax,%esi
+  8023b4:	e9 9d fa ff ff       	jmp    801e56 <spawn+0x29e>
+		return -E_NO_MEM;
+  8023b9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8023be:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  8023c4:	e9 c1 fc ff ff       	jmp    80208a <spawn+0x4d2>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8023c9:	83 ec 0c             	sub    $0xc,%esp
+  8023cc:	68 40 63 80 00       	push   $0x806340
+  8023d1:	e8 d9 17 00 00       	call   803baf <pgbatch_flush>
+  8023d6:	83 c4 10             	add    $0x10,%esp
+  8023d9:	85 c0                	test   %eax,%eax
+  8023db:	0f 89 51 fe ff ff    	jns    802232 <spawn+0x67a>
+  8023e1:	89 c6                	mov    %eax,%esi
+  8023e3:	e9 6e fa ff ff       	jmp    801e56 <spawn+0x29e>
+	sys_page_unmap(0, UTEMP);
+  8023e8:	83 ec 08             	sub    $0x8,%esp
+  8023eb:	68 00 00 40 00       	push   $0x400000
+  8023f0:	6a 00                	push   $0x0
+  8023f2:	e8 71 ea ff ff       	call   800e68 <sys_page_unmap>
+  8023f7:	83 c4 10             	add    $0x10,%esp
+  8023fa:	89 9d 78 fd ff ff    	mov    %ebx,-0x288(%ebp)
+  802400:	e9 85 fc ff ff       	jmp    80208a <spawn+0x4d2>
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802405:	83 ec 04             	sub    $0x4,%esp
+  802408:	6a 07                	push   $0x7
+  80240a:	68 00 00 40 00       	push   $0x400000
+  80240f:	6a 00                	push   $0x0
+  802411:	e8 cd e9 ff ff       	call   800de3 <sys_page_alloc>
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	85 c0                	test   %eax,%eax
+  80241b:	78 a1                	js     8023be <spawn+0x806>
+	for (argc = 0; argv[argc] != 0; argc++)
+  80241d:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802424:	00 00 00 
+  802427:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  80242e:	00 00 00 
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802431:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802436:	be 00 10 40 00       	mov    $0x401000,%esi
+  80243b:	e9 03 f9 ff ff       	jmp    801d43 <spawn+0x18b>
+
+00802440 <spawnl>:
+{
+  802440:	55                   	push   %ebp
+  802441:	89 e5                	mov    %esp,%ebp
+  802443:	56                   	push   %esi
+  802444:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802445:	8d 45 10             	lea    0x10(%ebp),%eax
+	int argc=0;
+  802448:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while(va_arg(vl, void *) != NULL)
+  80244d:	eb 05                	jmp    802454 <spawnl+0x14>
+		argc++;
+  80244f:	83 c1 01             	add    $0x1,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802452:	89 d0                	mov    %edx,%eax
+  802454:	8d 50 04             	lea    0x4(%eax),%edx
+  802457:	83 38 00             	cmpl   $0x0,(%eax)
+  80245a:	75 f3                	jne    80244f <spawnl+0xf>
+	const char *argv[argc+2];
+  80245c:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802463:	83 e0 f0             	and    $0xfffffff0,%eax
+  802466:	29 c4                	sub    %eax,%esp
+  802468:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  80246c:	89 d8                	mov    %ebx,%eax
+  80246e:	c1 e8 02             	shr    $0x2,%eax
+  802471:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802474:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802477:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+	argv[argc+1] = NULL;
+  80247e:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802485:	00 
+	va_start(vl, arg0);
+  802486:	8d 55 10             	lea    0x10(%ebp),%edx
+	for(i=0;i<argc;i++)
+  802489:	89 ce                	mov    %ecx,%esi
+  80248b:	85 c9                	test   %ecx,%ecx
+  80248d:	74 16                	je     8024a5 <spawnl+0x65>
+  80248f:	b8 00 00 00 00       	mov    $0x0,%eax
+		argv[i+1] = va_arg(vl, const char *);
+  802494:	83 c0 01             	add    $0x1,%eax
+  802497:	89 d1                	mov    %edx,%ecx
+  802499:	83 c2 04             	add    $0x4,%edx
+  80249c:	8b 09                	mov    (%ecx),%ecx
+  80249e:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	for(i=0;i<argc;i++)
+  8024a1:	39 f0                	cmp    %esi,%eax
+  8024a3:	75 ef                	jne    802494 <spawnl+0x54>
+	return spawn(prog, argv);
+  8024a5:	83 ec 08             	sub    $0x8,%esp
+  8024a8:	53                   	push   %ebx
+  8024a9:	ff 75 08             	push   0x8(%ebp)
+  8024ac:	e8 07 f7 ff ff       	call   801bb8 <spawn>
+}
+  8024b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024b4:	5b                   	pop    %ebx
+  8024b5:	5e                   	pop    %esi
+  8024b6:	5d                   	pop    %ebp
+  8024b7:	c3                   	ret
+
+008024b8 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024b8:	55                   	push   %ebp
+  8024b9:	89 e5                	mov    %esp,%ebp
+  8024bb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8024be:	68 2f 4a 80 00       	push   $0x804a2f
+  8024c3:	ff 75 0c             	push   0xc(%ebp)
+  8024c6:	e8 e4 e4 ff ff       	call   8009af <strcpy>
+	return 0;
+}
+  8024cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d0:	c9                   	leave
+  8024d1:	c3                   	ret
+
+008024d2 <devsock_close>:
+{
+  8024d2:	55                   	push   %ebp
+  8024d3:	89 e5                	mov    %esp,%ebp
+  8024d5:	53                   	push   %ebx
+  8024d6:	83 ec 10             	sub    $0x10,%esp
+  8024d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8024dc:	53                   	push   %ebx
+  8024dd:	e8 74 1d 00 00       	call   804256 <pageref>
+  8024e2:	89 c2                	mov    %eax,%edx
+  8024e4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8024e7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8024ec:	83 fa 01             	cmp    $0x1,%edx
+  8024ef:	74 05                	je     8024f6 <devsock_close+0x24>
+}
+  8024f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f4:	c9                   	leave
+  8024f5:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8024f6:	83 ec 0c             	sub    $0xc,%esp
+  8024f9:	ff 73 0c             	push   0xc(%ebx)
+  8024fc:	e8 b0 05 00 00       	call   802ab1 <nsipc_close>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	eb eb                	jmp    8024f1 <devsock_close+0x1f>
+
+00802506 <devsock_write>:
+{
+  802506:	55                   	push   %ebp
+  802507:	89 e5                	mov    %esp,%ebp
+  802509:	53                   	push   %ebx
+  80250a:	83 ec 14             	sub    $0x14,%esp
+  80250d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802510:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802513:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802516:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802519:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80251c:	8b 41 08             	mov    0x8(%ecx),%eax
+  80251f:	c1 f8 09             	sar    $0x9,%eax
+  802522:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802525:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80252b:	77 13                	ja     802540 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  80252d:	50                   	push   %eax
+  80252e:	52                   	push   %edx
+  80252f:	53                   	push   %ebx
+  802530:	ff 71 0c             	push   0xc(%ecx)
+  802533:	e8 5c 06 00 00       	call   802b94 <nsipc_send>
+  802538:	83 c4 10             	add    $0x10,%esp
+}
+  80253b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80253e:	c9                   	leave
+  80253f:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802540:	50                   	push   %eax
+  802541:	6a 01                	push   $0x1
+  802543:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802546:	50                   	push   %eax
+  802547:	ff 71 0c             	push   0xc(%ecx)
+  80254a:	e8 a6 06 00 00       	call   802bf5 <nsipc_sendmsg>
+  80254f:	83 c4 10             	add    $0x10,%esp
+  802552:	eb e7                	jmp    80253b <devsock_write+0x35>
+
+00802554 <devsock_read>:
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	53                   	push   %ebx
+  802558:	83 ec 14             	sub    $0x14,%esp
+  80255b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80255e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802561:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802564:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802567:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80256a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80256d:	c1 f8 09             	sar    $0x9,%eax
+  802570:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802573:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802579:	77 13                	ja     80258e <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80257b:	50                   	push   %eax
+  80257c:	52                   	push   %edx
+  80257d:	53                   	push   %ebx
+  80257e:	ff 71 0c             	push   0xc(%ecx)
+  802581:	e8 9c 05 00 00       	call   802b22 <nsipc_recv>
+  802586:	83 c4 10             	add    $0x10,%esp
+}
+  802589:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80258c:	c9                   	leave
+  80258d:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80258e:	50                   	push   %eax
+  80258f:	6a 01                	push   $0x1
+  802591:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802594:	50                   	push   %eax
+  802595:	ff 71 0c             	push   0xc(%ecx)
+  802598:	e8 02 0a 00 00       	call   802f9f <nsipc_recvmsg>
+  80259d:	83 c4 10             	add    $0x10,%esp
+  8025a0:	eb e7                	jmp    802589 <devsock_read+0x35>
+
+008025a2 <fd2sockid>:
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8025a8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025ab:	52                   	push   %edx
+  8025ac:	50                   	push   %eax
+  8025ad:	e8 0b ed ff ff       	call   8012bd <fd_lookup>
+  8025b2:	83 c4 10             	add    $0x10,%esp
+  8025b5:	85 c0                	test   %eax,%eax
+  8025b7:	78 10                	js     8025c9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8025b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025bc:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8025c2:	39 08                	cmp    %ecx,(%eax)
+  8025c4:	75 05                	jne    8025cb <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8025c6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8025c9:	c9                   	leave
+  8025ca:	c3                   	ret
+		return -E_NOT_SUPP;
+  8025cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025d0:	eb f7                	jmp    8025c9 <fd2sockid+0x27>
+
+008025d2 <sock_flags>:
+{
+  8025d2:	55                   	push   %ebp
+  8025d3:	89 e5                	mov    %esp,%ebp
+  8025d5:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8025d8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025db:	52                   	push   %edx
+  8025dc:	50                   	push   %eax
+  8025dd:	e8 db ec ff ff       	call   8012bd <fd_lookup>
+  8025e2:	83 c4 10             	add    $0x10,%esp
+  8025e5:	85 c0                	test   %eax,%eax
+  8025e7:	78 0e                	js     8025f7 <sock_flags+0x25>
+  8025e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025ec:	8b 40 08             	mov    0x8(%eax),%eax
+  8025ef:	c1 e8 09             	shr    $0x9,%eax
+  8025f2:	83 e0 08             	and    $0x8,%eax
+}
+  8025f5:	c9                   	leave
+  8025f6:	c3                   	ret
+		return 0;
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fc:	eb f7                	jmp    8025f5 <sock_flags+0x23>
+
+008025fe <alloc_sockfd>:
+{
+  8025fe:	55                   	push   %ebp
+  8025ff:	89 e5                	mov    %esp,%ebp
+  802601:	56                   	push   %esi
+  802602:	53                   	push   %ebx
+  802603:	83 ec 1c             	sub    $0x1c,%esp
+  802606:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802608:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80260b:	50                   	push   %eax
+  80260c:	e8 5c ec ff ff       	call   80126d <fd_alloc>
+  802611:	89 c3                	mov    %eax,%ebx
+  802613:	83 c4 10             	add    $0x10,%esp
+  802616:	85 c0                	test   %eax,%eax
+  802618:	78 43                	js     80265d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80261a:	83 ec 04             	sub    $0x4,%esp
+  80261d:	68 07 04 00 00       	push   $0x407
+  802622:	ff 75 f4             	push   -0xc(%ebp)
+  802625:	6a 00                	push   $0x0
+  802627:	e8 b7 e7 ff ff       	call   800de3 <sys_page_alloc>
+  80262c:	89 c3                	mov    %eax,%ebx
+  80262e:	83 c4 10             	add    $0x10,%esp
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 28                	js     80265d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802635:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802638:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  80263e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802640:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802643:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80264a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80264d:	83 ec 0c             	sub    $0xc,%esp
+  802650:	50                   	push   %eax
+  802651:	e8 f0 eb ff ff       	call   801246 <fd2num>
+  802656:	89 c3                	mov    %eax,%ebx
+  802658:	83 c4 10             	add    $0x10,%esp
+  80265b:	eb 0c                	jmp    802669 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80265d:	83 ec 0c             	sub    $0xc,%esp
+  802660:	56                   	push   %esi
+  802661:	e8 4b 04 00 00       	call   802ab1 <nsipc_close>
+		return r;
+  802666:	83 c4 10             	add    $0x10,%esp
+}
+  802669:	89 d8                	mov    %ebx,%eax
+  80266b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80266e:	5b                   	pop    %ebx
+  80266f:	5e                   	pop    %esi
+  802670:	5d                   	pop    %ebp
+  802671:	c3                   	ret
+
+00802672 <accept>:
+{
+  802672:	55                   	push   %ebp
+  802673:	89 e5                	mov    %esp,%ebp
+  802675:	56                   	push   %esi
+  802676:	53                   	push   %ebx
+  802677:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80267a:	89 f0                	mov    %esi,%eax
+  80267c:	e8 21 ff ff ff       	call   8025a2 <fd2sockid>
+  802681:	89 c3                	mov    %eax,%ebx
+  802683:	85 c0                	test   %eax,%eax
+  802685:	78 24                	js     8026ab <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802687:	89 f0                	mov    %esi,%eax
+  802689:	e8 44 ff ff ff       	call   8025d2 <sock_flags>
+  80268e:	50                   	push   %eax
+  80268f:	ff 75 10             	push   0x10(%ebp)
+  802692:	ff 75 0c             	push   0xc(%ebp)
+  802695:	53                   	push   %ebx
+  802696:	e8 6b 03 00 00       	call   802a06 <nsipc_accept>
+  80269b:	89 c3                	mov    %eax,%ebx
+  80269d:	83 c4 10             	add    $0x10,%esp
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	78 07                	js     8026ab <accept+0x39>
+	return alloc_sockfd(r);
+  8026a4:	e8 55 ff ff ff       	call   8025fe <alloc_sockfd>
+  8026a9:	89 c3                	mov    %eax,%ebx
+}
+  8026ab:	89 d8                	mov    %ebx,%eax
+  8026ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b0:	5b                   	pop    %ebx
+  8026b1:	5e                   	pop    %esi
+  8026b2:	5d                   	pop    %ebp
+  8026b3:	c3                   	ret
+
+008026b4 <bind>:
+{
+  8026b4:	55                   	push   %ebp
+  8026b5:	89 e5                	mov    %esp,%ebp
+  8026b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8026ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026bd:	e8 e0 fe ff ff       	call   8025a2 <fd2sockid>
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	78 12                	js     8026d8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8026c6:	83 ec 04             	sub    $0x4,%esp
+  8026c9:	ff 75 10             	push   0x10(%ebp)
+  8026cc:	ff 75 0c             	push   0xc(%ebp)
+  8026cf:	50                   	push   %eax
+  8026d0:	e8 85 03 00 00       	call   802a5a <nsipc_bind>
+  8026d5:	83 c4 10             	add    $0x10,%esp
+}
+  8026d8:	c9                   	leave
+  8026d9:	c3                   	ret
+
+008026da <shutdown>:
+{
+  8026da:	55                   	push   %ebp
+  8026db:	89 e5                	mov    %esp,%ebp
+  8026dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8026e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e3:	e8 ba fe ff ff       	call   8025a2 <fd2sockid>
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	78 0f                	js     8026fb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8026ec:	83 ec 08             	sub    $0x8,%esp
+  8026ef:	ff 75 0c             	push   0xc(%ebp)
+  8026f2:	50                   	push   %eax
+  8026f3:	e8 97 03 00 00       	call   802a8f <nsipc_shutdown>
+  8026f8:	83 c4 10             	add    $0x10,%esp
+}
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+
+008026fd <connect>:
+{
+  8026fd:	55                   	push   %ebp
+  8026fe:	89 e5                	mov    %esp,%ebp
+  802700:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802703:	8b 45 08             	mov    0x8(%ebp),%eax
+  802706:	e8 97 fe ff ff       	call   8025a2 <fd2sockid>
+  80270b:	85 c0                	test   %eax,%eax
+  80270d:	78 12                	js     802721 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80270f:	83 ec 04             	sub    $0x4,%esp
+  802712:	ff 75 10             	push   0x10(%ebp)
+  802715:	ff 75 0c             	push   0xc(%ebp)
+  802718:	50                   	push   %eax
+  802719:	e8 ad 03 00 00       	call   802acb <nsipc_connect>
+  80271e:	83 c4 10             	add    $0x10,%esp
+}
+  802721:	c9                   	leave
+  802722:	c3                   	ret
+
+00802723 <listen>:
+{
+  802723:	55                   	push   %ebp
+  802724:	89 e5                	mov    %esp,%ebp
+  802726:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80272c:	e8 71 fe ff ff       	call   8025a2 <fd2sockid>
+  802731:	85 c0                	test   %eax,%eax
+  802733:	78 0f                	js     802744 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802735:	83 ec 08             	sub    $0x8,%esp
+  802738:	ff 75 0c             	push   0xc(%ebp)
+  80273b:	50                   	push   %eax
+  80273c:	e8 bf 03 00 00       	call   802b00 <nsipc_listen>
+  802741:	83 c4 10             	add    $0x10,%esp
+}
+  802744:	c9                   	leave
+  802745:	c3                   	ret
+
+00802746 <sendmsg>:
+{
+  802746:	55                   	push   %ebp
+  802747:	89 e5                	mov    %esp,%ebp
+  802749:	57                   	push   %edi
+  80274a:	56                   	push   %esi
+  80274b:	53                   	push   %ebx
+  80274c:	83 ec 0c             	sub    $0xc,%esp
+  80274f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802752:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802755:	89 f0                	mov    %esi,%eax
+  802757:	e8 46 fe ff ff       	call   8025a2 <fd2sockid>
+  80275c:	89 c3                	mov    %eax,%ebx
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	78 1c                	js     80277e <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802762:	89 f0                	mov    %esi,%eax
+  802764:	e8 69 fe ff ff       	call   8025d2 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802769:	0b 45 10             	or     0x10(%ebp),%eax
+  80276c:	50                   	push   %eax
+  80276d:	ff 77 0c             	push   0xc(%edi)
+  802770:	ff 77 08             	push   0x8(%edi)
+  802773:	53                   	push   %ebx
+  802774:	e8 7c 04 00 00       	call   802bf5 <nsipc_sendmsg>
+  802779:	89 c3                	mov    %eax,%ebx
+  80277b:	83 c4 10             	add    $0x10,%esp
+}
+  80277e:	89 d8                	mov    %ebx,%eax
+  802780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802783:	5b                   	pop    %ebx
+  802784:	5e                   	pop    %esi
+  802785:	5f                   	pop    %edi
+  802786:	5d                   	pop    %ebp
+  802787:	c3                   	ret
+
+00802788 <recvmsg>:
+{
+  802788:	55                   	push   %ebp
+  802789:	89 e5                	mov    %esp,%ebp
+  80278b:	57                   	push   %edi
+  80278c:	56                   	push   %esi
+  80278d:	53                   	push   %ebx
+  80278e:	83 ec 0c             	sub    $0xc,%esp
+  802791:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802794:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802797:	89 f8                	mov    %edi,%eax
+  802799:	e8 04 fe ff ff       	call   8025a2 <fd2sockid>
+  80279e:	89 c3                	mov    %eax,%ebx
+  8027a0:	85 c0                	test   %eax,%eax
+  8027a2:	78 2a                	js     8027ce <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8027a4:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8027ab:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8027b2:	89 f8                	mov    %edi,%eax
+  8027b4:	e8 19 fe ff ff       	call   8025d2 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8027b9:	0b 45 10             	or     0x10(%ebp),%eax
+  8027bc:	50                   	push   %eax
+  8027bd:	ff 76 0c             	push   0xc(%esi)
+  8027c0:	ff 76 08             	push   0x8(%esi)
+  8027c3:	53                   	push   %ebx
+  8027c4:	e8 d6 07 00 00       	call   802f9f <nsipc_recvmsg>
+  8027c9:	89 c3                	mov    %eax,%ebx
+  8027cb:	83 c4 10             	add    $0x10,%esp
+}
+  8027ce:	89 d8                	mov    %ebx,%eax
+  8027d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d3:	5b                   	pop    %ebx
+  8027d4:	5e                   	pop    %esi
+  8027d5:	5f                   	pop    %edi
+  8027d6:	5d                   	pop    %ebp
+  8027d7:	c3                   	ret
+
+008027d8 <sendfile>:
+{
+  8027d8:	55                   	push   %ebp
+  8027d9:	89 e5                	mov    %esp,%ebp
+  8027db:	56                   	push   %esi
+  8027dc:	53                   	push   %ebx
+  8027dd:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8027e0:	89 f0                	mov    %esi,%eax
+  8027e2:	e8 bb fd ff ff       	call   8025a2 <fd2sockid>
+  8027e7:	89 c3                	mov    %eax,%ebx
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	78 1f                	js     80280c <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8027ed:	89 f0                	mov    %esi,%eax
+  8027ef:	e8 de fd ff ff       	call   8025d2 <sock_flags>
+  8027f4:	83 ec 0c             	sub    $0xc,%esp
+  8027f7:	50                   	push   %eax
+  8027f8:	ff 75 14             	push   0x14(%ebp)
+  8027fb:	ff 75 10             	push   0x10(%ebp)
+  8027fe:	ff 75 0c             	push   0xc(%ebp)
+  802801:	53                   	push   %ebx
+  802802:	e8 64 06 00 00       	call   802e6b <nsipc_sendfile>
+  802807:	89 c3                	mov    %eax,%ebx
+  802809:	83 c4 20             	add    $0x20,%esp
+}
+  80280c:	89 d8                	mov    %ebx,%eax
+  80280e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802811:	5b                   	pop    %ebx
+  802812:	5e                   	pop    %esi
+  802813:	5d                   	pop    %ebp
+  802814:	c3                   	ret
+
+00802815 <evctl>:
+{
+  802815:	55                   	push   %ebp
+  802816:	89 e5                	mov    %esp,%ebp
+  802818:	53                   	push   %ebx
+  802819:	83 ec 04             	sub    $0x4,%esp
+  80281c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80281f:	89 d8                	mov    %ebx,%eax
+  802821:	e8 7c fd ff ff       	call   8025a2 <fd2sockid>
+  802826:	85 c0                	test   %eax,%eax
+  802828:	78 10                	js     80283a <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80282a:	83 ec 04             	sub    $0x4,%esp
+  80282d:	53                   	push   %ebx
+  80282e:	ff 75 0c             	push   0xc(%ebp)
+  802831:	50                   	push   %eax
+  802832:	e8 d2 0b 00 00       	call   803409 <nsipc_evctl>
+  802837:	83 c4 10             	add    $0x10,%esp
+}
+  80283a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80283d:	c9                   	leave
+  80283e:	c3                   	ret
+
+0080283f <evwait>:
+{
+  80283f:	55                   	push   %ebp
+  802840:	89 e5                	mov    %esp,%ebp
+  802842:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802845:	ff 75 10             	push   0x10(%ebp)
+  802848:	ff 75 0c             	push   0xc(%ebp)
+  80284b:	ff 75 08             	push   0x8(%ebp)
+  80284e:	e8 e0 0b 00 00       	call   803433 <nsipc_evwait>
+}
+  802853:	c9                   	leave
+  802854:	c3                   	ret
+
+00802855 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802855:	55                   	push   %ebp
+  802856:	89 e5                	mov    %esp,%ebp
+  802858:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80285b:	ff 75 10             	push   0x10(%ebp)
+  80285e:	ff 75 0c             	push   0xc(%ebp)
+  802861:	ff 75 08             	push   0x8(%ebp)
+  802864:	e8 31 0c 00 00       	call   80349a <nsipc_socket>
+  802869:	83 c4 10             	add    $0x10,%esp
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	78 05                	js     802875 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802870:	e8 89 fd ff ff       	call   8025fe <alloc_sockfd>
+}
+  802875:	c9                   	leave
+  802876:	c3                   	ret
+
+00802877 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802877:	55                   	push   %ebp
+  802878:	89 e5                	mov    %esp,%ebp
+  80287a:	53                   	push   %ebx
+  80287b:	83 ec 04             	sub    $0x4,%esp
+  80287e:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802880:	83 3d 64 69 80 00 00 	cmpl   $0x0,0x806964
+  802887:	74 26                	je     8028af <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802889:	6a 07                	push   $0x7
+  80288b:	68 00 80 80 00       	push   $0x808000
+  802890:	53                   	push   %ebx
+  802891:	ff 35 64 69 80 00    	push   0x806964
+  802897:	e8 12 19 00 00       	call   8041ae <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80289c:	83 c4 0c             	add    $0xc,%esp
+  80289f:	6a 00                	push   $0x0
+  8028a1:	6a 00                	push   $0x0
+  8028a3:	6a 00                	push   $0x0
+  8028a5:	e8 74 16 00 00       	call   803f1e <ipc_recv>
+}
+  8028aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ad:	c9                   	leave
+  8028ae:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028af:	83 ec 0c             	sub    $0xc,%esp
+  8028b2:	6a 03                	push   $0x3
+  8028b4:	e8 5e 19 00 00       	call   804217 <ipc_find_env>
+  8028b9:	a3 64 69 80 00       	mov    %eax,0x806964
+  8028be:	83 c4 10             	add    $0x10,%esp
+  8028c1:	eb c6                	jmp    802889 <nsipc+0x12>
+
+008028c3 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	56                   	push   %esi
+  8028c7:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8028c8:	8b 35 70 69 80 00    	mov    0x806970,%esi
+		return 0;
+  8028ce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8028d3:	85 f6                	test   %esi,%esi
+  8028d5:	75 33                	jne    80290a <nsbulk_map+0x47>
+  8028d7:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8028dc:	83 ec 04             	sub    $0x4,%esp
+  8028df:	6a 07                	push   $0x7
+  8028e1:	53                   	push   %ebx
+  8028e2:	6a 00                	push   $0x0
+  8028e4:	e8 fa e4 ff ff       	call   800de3 <sys_page_alloc>
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	78 1a                	js     80290a <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8028f0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8028f6:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8028fc:	75 de                	jne    8028dc <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8028fe:	c7 05 70 69 80 00 01 	movl   $0x1,0x806970
+  802905:	00 00 00 
+	return 0;
+  802908:	89 f0                	mov    %esi,%eax
+}
+  80290a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80290d:	5b                   	pop    %ebx
+  80290e:	5e                   	pop    %esi
+  80290f:	5d                   	pop    %ebp
+  802910:	c3                   	ret
+
+00802911 <nsbulk_own>:
+{
+  802911:	55                   	push   %ebp
+  802912:	89 e5                	mov    %esp,%ebp
+  802914:	57                   	push   %edi
+  802915:	56                   	push   %esi
+  802916:	53                   	push   %ebx
+  802917:	83 ec 0c             	sub    $0xc,%esp
+  80291a:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80291c:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80291f:	85 d2                	test   %edx,%edx
+  802921:	7f 0e                	jg     802931 <nsbulk_own+0x20>
+	return 0;
+  802923:	b8 00 00 00 00       	mov    $0x0,%eax
+  802928:	eb 47                	jmp    802971 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80292a:	83 c3 01             	add    $0x1,%ebx
+  80292d:	39 fb                	cmp    %edi,%ebx
+  80292f:	7d 3b                	jge    80296c <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802931:	be 01 00 00 00       	mov    $0x1,%esi
+  802936:	89 d9                	mov    %ebx,%ecx
+  802938:	d3 e6                	shl    %cl,%esi
+  80293a:	89 f0                	mov    %esi,%eax
+  80293c:	23 05 6c 69 80 00    	and    0x80696c,%eax
+  802942:	74 e6                	je     80292a <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802944:	83 ec 04             	sub    $0x4,%esp
+  802947:	6a 07                	push   $0x7
+  802949:	89 d8                	mov    %ebx,%eax
+  80294b:	c1 e0 0c             	shl    $0xc,%eax
+  80294e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802953:	50                   	push   %eax
+  802954:	6a 00                	push   $0x0
+  802956:	e8 88 e4 ff ff       	call   800de3 <sys_page_alloc>
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	78 0f                	js     802971 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802962:	f7 d6                	not    %esi
+  802964:	21 35 6c 69 80 00    	and    %esi,0x80696c
+  80296a:	eb be                	jmp    80292a <nsbulk_own+0x19>
+	return 0;
+  80296c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802974:	5b                   	pop    %ebx
+  802975:	5e                   	pop    %esi
+  802976:	5f                   	pop    %edi
+  802977:	5d                   	pop    %ebp
+  802978:	c3                   	ret
+
+00802979 <nsipc_bulk>:
+{
+  802979:	55                   	push   %ebp
+  80297a:	89 e5                	mov    %esp,%ebp
+  80297c:	57                   	push   %edi
+  80297d:	56                   	push   %esi
+  80297e:	53                   	push   %ebx
+  80297f:	83 ec 1c             	sub    $0x1c,%esp
+  802982:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802985:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802987:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80298d:	c1 fb 0c             	sar    $0xc,%ebx
+  802990:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802993:	83 3d 64 69 80 00 00 	cmpl   $0x0,0x806964
+  80299a:	74 56                	je     8029f2 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80299c:	85 ff                	test   %edi,%edi
+  80299e:	7e 24                	jle    8029c4 <nsipc_bulk+0x4b>
+  8029a0:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8029a6:	74 1c                	je     8029c4 <nsipc_bulk+0x4b>
+  8029a8:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8029ae:	c1 e3 0c             	shl    $0xc,%ebx
+  8029b1:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8029b6:	0f b6 10             	movzbl (%eax),%edx
+  8029b9:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8029bb:	05 00 10 00 00       	add    $0x1000,%eax
+  8029c0:	39 d8                	cmp    %ebx,%eax
+  8029c2:	75 f2                	jne    8029b6 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8029c4:	83 ec 0c             	sub    $0xc,%esp
+  8029c7:	56                   	push   %esi
+  8029c8:	57                   	push   %edi
+  8029c9:	68 00 00 00 e0       	push   $0xe0000000
+  8029ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8029d1:	ff 35 64 69 80 00    	push   0x806964
+  8029d7:	e8 06 18 00 00       	call   8041e2 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8029dc:	83 c4 1c             	add    $0x1c,%esp
+  8029df:	6a 00                	push   $0x0
+  8029e1:	6a 00                	push   $0x0
+  8029e3:	6a 00                	push   $0x0
+  8029e5:	e8 34 15 00 00       	call   803f1e <ipc_recv>
+}
+  8029ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029ed:	5b                   	pop    %ebx
+  8029ee:	5e                   	pop    %esi
+  8029ef:	5f                   	pop    %edi
+  8029f0:	5d                   	pop    %ebp
+  8029f1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029f2:	83 ec 0c             	sub    $0xc,%esp
+  8029f5:	6a 03                	push   $0x3
+  8029f7:	e8 1b 18 00 00       	call   804217 <ipc_find_env>
+  8029fc:	a3 64 69 80 00       	mov    %eax,0x806964
+  802a01:	83 c4 10             	add    $0x10,%esp
+  802a04:	eb 96                	jmp    80299c <nsipc_bulk+0x23>
+
+00802a06 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802a06:	55                   	push   %ebp
+  802a07:	89 e5                	mov    %esp,%ebp
+  802a09:	53                   	push   %ebx
+  802a0a:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a10:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802a15:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a18:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a22:	e8 50 fe ff ff       	call   802877 <nsipc>
+  802a27:	89 c3                	mov    %eax,%ebx
+  802a29:	85 c0                	test   %eax,%eax
+  802a2b:	79 07                	jns    802a34 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a2d:	89 d8                	mov    %ebx,%eax
+  802a2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a32:	c9                   	leave
+  802a33:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a34:	83 ec 04             	sub    $0x4,%esp
+  802a37:	ff 35 10 80 80 00    	push   0x808010
+  802a3d:	68 00 80 80 00       	push   $0x808000
+  802a42:	ff 75 0c             	push   0xc(%ebp)
+  802a45:	e8 15 e1 ff ff       	call   800b5f <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a4a:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a50:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a53:	89 10                	mov    %edx,(%eax)
+  802a55:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a58:	eb d3                	jmp    802a2d <nsipc_accept+0x27>
+
+00802a5a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a5a:	55                   	push   %ebp
+  802a5b:	89 e5                	mov    %esp,%ebp
+  802a5d:	53                   	push   %ebx
+  802a5e:	83 ec 08             	sub    $0x8,%esp
+  802a61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a67:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a6c:	53                   	push   %ebx
+  802a6d:	ff 75 0c             	push   0xc(%ebp)
+  802a70:	68 04 80 80 00       	push   $0x808004
+  802a75:	e8 e5 e0 ff ff       	call   800b5f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a7a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a80:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a85:	e8 ed fd ff ff       	call   802877 <nsipc>
+}
+  802a8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a8d:	c9                   	leave
+  802a8e:	c3                   	ret
+
+00802a8f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a98:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aa0:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802aa5:	b8 03 00 00 00       	mov    $0x3,%eax
+  802aaa:	e8 c8 fd ff ff       	call   802877 <nsipc>
+}
+  802aaf:	c9                   	leave
+  802ab0:	c3                   	ret
+
+00802ab1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ab1:	55                   	push   %ebp
+  802ab2:	89 e5                	mov    %esp,%ebp
+  802ab4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aba:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802abf:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ac4:	e8 ae fd ff ff       	call   802877 <nsipc>
+}
+  802ac9:	c9                   	leave
+  802aca:	c3                   	ret
+
+00802acb <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802acb:	55                   	push   %ebp
+  802acc:	89 e5                	mov    %esp,%ebp
+  802ace:	53                   	push   %ebx
+  802acf:	83 ec 08             	sub    $0x8,%esp
+  802ad2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad8:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802add:	53                   	push   %ebx
+  802ade:	ff 75 0c             	push   0xc(%ebp)
+  802ae1:	68 04 80 80 00       	push   $0x808004
+  802ae6:	e8 74 e0 ff ff       	call   800b5f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802aeb:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802af1:	b8 05 00 00 00       	mov    $0x5,%eax
+  802af6:	e8 7c fd ff ff       	call   802877 <nsipc>
+}
+  802afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+
+00802b00 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b00:	55                   	push   %ebp
+  802b01:	89 e5                	mov    %esp,%ebp
+  802b03:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b09:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b11:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802b16:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b1b:	e8 57 fd ff ff       	call   802877 <nsipc>
+}
+  802b20:	c9                   	leave
+  802b21:	c3                   	ret
+
+00802b22 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b22:	55                   	push   %ebp
+  802b23:	89 e5                	mov    %esp,%ebp
+  802b25:	56                   	push   %esi
+  802b26:	53                   	push   %ebx
+  802b27:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802b32:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802b38:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b3b:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b40:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b45:	e8 2d fd ff ff       	call   802877 <nsipc>
+  802b4a:	89 c3                	mov    %eax,%ebx
+  802b4c:	85 c0                	test   %eax,%eax
+  802b4e:	78 22                	js     802b72 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b50:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b55:	39 c6                	cmp    %eax,%esi
+  802b57:	0f 4e c6             	cmovle %esi,%eax
+  802b5a:	39 c3                	cmp    %eax,%ebx
+  802b5c:	7f 1d                	jg     802b7b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b5e:	83 ec 04             	sub    $0x4,%esp
+  802b61:	53                   	push   %ebx
+  802b62:	68 00 80 80 00       	push   $0x808000
+  802b67:	ff 75 0c             	push   0xc(%ebp)
+  802b6a:	e8 f0 df ff ff       	call   800b5f <memmove>
+  802b6f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b72:	89 d8                	mov    %ebx,%eax
+  802b74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b77:	5b                   	pop    %ebx
+  802b78:	5e                   	pop    %esi
+  802b79:	5d                   	pop    %ebp
+  802b7a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b7b:	68 3b 4a 80 00       	push   $0x804a3b
+  802b80:	68 82 49 80 00       	push   $0x804982
+  802b85:	68 b2 00 00 00       	push   $0xb2
+  802b8a:	68 50 4a 80 00       	push   $0x804a50
+  802b8f:	e8 49 d6 ff ff       	call   8001dd <_panic>
+
+00802b94 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b94:	55                   	push   %ebp
+  802b95:	89 e5                	mov    %esp,%ebp
+  802b97:	53                   	push   %ebx
+  802b98:	83 ec 04             	sub    $0x4,%esp
+  802b9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba1:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ba6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bac:	7f 2e                	jg     802bdc <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802bae:	83 ec 04             	sub    $0x4,%esp
+  802bb1:	53                   	push   %ebx
+  802bb2:	ff 75 0c             	push   0xc(%ebp)
+  802bb5:	68 0c 80 80 00       	push   $0x80800c
+  802bba:	e8 a0 df ff ff       	call   800b5f <memmove>
+	nsipcbuf.send.req_size = size;
+  802bbf:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802bc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bc8:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802bcd:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bd2:	e8 a0 fc ff ff       	call   802877 <nsipc>
+}
+  802bd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+	assert(size < 1600);
+  802bdc:	68 5c 4a 80 00       	push   $0x804a5c
+  802be1:	68 82 49 80 00       	push   $0x804982
+  802be6:	68 bd 00 00 00       	push   $0xbd
+  802beb:	68 50 4a 80 00       	push   $0x804a50
+  802bf0:	e8 e8 d5 ff ff       	call   8001dd <_panic>
+
+00802bf5 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802bf5:	55                   	push   %ebp
+  802bf6:	89 e5                	mov    %esp,%ebp
+  802bf8:	57                   	push   %edi
+  802bf9:	56                   	push   %esi
+  802bfa:	53                   	push   %ebx
+  802bfb:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802bfe:	e8 c0 fc ff ff       	call   8028c3 <nsbulk_map>
+  802c03:	85 c0                	test   %eax,%eax
+  802c05:	78 55                	js     802c5c <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802c07:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802c0e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802c15:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c1c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c1f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c22:	0f 8d 24 02 00 00    	jge    802e4c <nsipc_sendmsg+0x257>
+  802c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c2b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c2e:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802c31:	89 d8                	mov    %ebx,%eax
+  802c33:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c38:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802c3a:	83 ec 0c             	sub    $0xc,%esp
+  802c3d:	68 60 66 80 00       	push   $0x806660
+  802c42:	e8 5a 0f 00 00       	call   803ba1 <pgbatch_init>
+  802c47:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c4a:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802c4c:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802c4f:	e9 82 00 00 00       	jmp    802cd6 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802c54:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802c57:	85 db                	test   %ebx,%ebx
+  802c59:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802c5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c5f:	5b                   	pop    %ebx
+  802c60:	5e                   	pop    %esi
+  802c61:	5f                   	pop    %edi
+  802c62:	5d                   	pop    %ebp
+  802c63:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802c64:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802c69:	29 c8                	sub    %ecx,%eax
+  802c6b:	39 d0                	cmp    %edx,%eax
+  802c6d:	0f 46 d0             	cmovbe %eax,%edx
+  802c70:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802c72:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802c78:	85 ff                	test   %edi,%edi
+  802c7a:	0f 49 c7             	cmovns %edi,%eax
+  802c7d:	c1 f8 0c             	sar    $0xc,%eax
+  802c80:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c85:	e8 87 fc ff ff       	call   802911 <nsbulk_own>
+  802c8a:	85 c0                	test   %eax,%eax
+  802c8c:	0f 88 17 01 00 00    	js     802da9 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802c92:	83 ec 04             	sub    $0x4,%esp
+  802c95:	56                   	push   %esi
+  802c96:	ff 75 e0             	push   -0x20(%ebp)
+  802c99:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802c9c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802ca1:	50                   	push   %eax
+  802ca2:	e8 b8 de ff ff       	call   800b5f <memmove>
+  802ca7:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802caa:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802cad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cb0:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802cb3:	0f 84 fd 00 00 00    	je     802db6 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802cb9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802cbc:	01 f7                	add    %esi,%edi
+  802cbe:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802cc1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802cc4:	0f 8d 01 01 00 00    	jge    802dcb <nsipc_sendmsg+0x1d6>
+  802cca:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802cd0:	0f 8f f0 00 00 00    	jg     802dc6 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802cd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cd9:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802cdc:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802cdf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ce2:	89 c2                	mov    %eax,%edx
+  802ce4:	03 13                	add    (%ebx),%edx
+  802ce6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802ce9:	8b 73 04             	mov    0x4(%ebx),%esi
+  802cec:	29 c6                	sub    %eax,%esi
+  802cee:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802cf3:	29 f9                	sub    %edi,%ecx
+  802cf5:	39 ce                	cmp    %ecx,%esi
+  802cf7:	89 ca                	mov    %ecx,%edx
+  802cf9:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802cfc:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802cff:	89 f9                	mov    %edi,%ecx
+  802d01:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802d07:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d0a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d0f:	09 c8                	or     %ecx,%eax
+  802d11:	0f 85 4d ff ff ff    	jne    802c64 <nsipc_sendmsg+0x6f>
+  802d17:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802d1d:	0f 86 41 ff ff ff    	jbe    802c64 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d23:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d29:	85 ff                	test   %edi,%edi
+  802d2b:	0f 49 c7             	cmovns %edi,%eax
+  802d2e:	c1 f8 0c             	sar    $0xc,%eax
+  802d31:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802d33:	89 d1                	mov    %edx,%ecx
+  802d35:	c1 e9 0c             	shr    $0xc,%ecx
+  802d38:	01 c8                	add    %ecx,%eax
+  802d3a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d3d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802d40:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802d42:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d45:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802d4a:	29 c8                	sub    %ecx,%eax
+  802d4c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802d4f:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802d52:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d54:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d59:	89 f9                	mov    %edi,%ecx
+  802d5b:	d3 e0                	shl    %cl,%eax
+  802d5d:	09 05 6c 69 80 00    	or     %eax,0x80696c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802d63:	83 ec 08             	sub    $0x8,%esp
+  802d66:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802d68:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802d6b:	50                   	push   %eax
+  802d6c:	6a 00                	push   $0x0
+  802d6e:	56                   	push   %esi
+  802d6f:	6a 00                	push   $0x0
+  802d71:	68 60 66 80 00       	push   $0x806660
+  802d76:	e8 e4 0e 00 00       	call   803c5f <pgbatch_map>
+  802d7b:	83 c4 20             	add    $0x20,%esp
+  802d7e:	85 c0                	test   %eax,%eax
+  802d80:	0f 88 ce fe ff ff    	js     802c54 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802d86:	83 c7 01             	add    $0x1,%edi
+  802d89:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d8f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802d92:	39 c7                	cmp    %eax,%edi
+  802d94:	75 be                	jne    802d54 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802d96:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802d99:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802d9c:	89 d6                	mov    %edx,%esi
+  802d9e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802da4:	e9 01 ff ff ff       	jmp    802caa <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802da9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802dac:	85 db                	test   %ebx,%ebx
+  802dae:	0f 45 c3             	cmovne %ebx,%eax
+  802db1:	e9 a6 fe ff ff       	jmp    802c5c <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802db6:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802dba:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802dc1:	e9 f3 fe ff ff       	jmp    802cb9 <nsipc_sendmsg+0xc4>
+  802dc6:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802dc9:	eb 03                	jmp    802dce <nsipc_sendmsg+0x1d9>
+  802dcb:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802dce:	83 ec 0c             	sub    $0xc,%esp
+  802dd1:	68 60 66 80 00       	push   $0x806660
+  802dd6:	e8 d4 0d 00 00       	call   803baf <pgbatch_flush>
+  802ddb:	83 c4 10             	add    $0x10,%esp
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	78 50                	js     802e32 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802de2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de5:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802dea:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802df0:	89 fb                	mov    %edi,%ebx
+  802df2:	29 f3                	sub    %esi,%ebx
+  802df4:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802dfa:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dfd:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802e02:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802e07:	89 fa                	mov    %edi,%edx
+  802e09:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802e0e:	e8 66 fb ff ff       	call   802979 <nsipc_bulk>
+  802e13:	85 c0                	test   %eax,%eax
+  802e15:	78 28                	js     802e3f <nsipc_sendmsg+0x24a>
+		sent += r;
+  802e17:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802e1a:	39 c3                	cmp    %eax,%ebx
+  802e1c:	75 0c                	jne    802e2a <nsipc_sendmsg+0x235>
+  802e1e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e21:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802e24:	0f 8f f2 fd ff ff    	jg     802c1c <nsipc_sendmsg+0x27>
+		sent += r;
+  802e2a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802e2d:	e9 2a fe ff ff       	jmp    802c5c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802e32:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e35:	85 db                	test   %ebx,%ebx
+  802e37:	0f 45 c3             	cmovne %ebx,%eax
+  802e3a:	e9 1d fe ff ff       	jmp    802c5c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802e3f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e42:	85 db                	test   %ebx,%ebx
+  802e44:	0f 45 c3             	cmovne %ebx,%eax
+  802e47:	e9 10 fe ff ff       	jmp    802c5c <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802e4c:	83 ec 0c             	sub    $0xc,%esp
+  802e4f:	68 60 66 80 00       	push   $0x806660
+  802e54:	e8 48 0d 00 00       	call   803ba1 <pgbatch_init>
+  802e59:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802e61:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e66:	e9 63 ff ff ff       	jmp    802dce <nsipc_sendmsg+0x1d9>
+
+00802e6b <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802e6b:	55                   	push   %ebp
+  802e6c:	89 e5                	mov    %esp,%ebp
+  802e6e:	57                   	push   %edi
+  802e6f:	56                   	push   %esi
+  802e70:	53                   	push   %ebx
+  802e71:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802e74:	83 3d 68 69 80 00 00 	cmpl   $0x0,0x806968
+  802e7b:	0f 84 c8 00 00 00    	je     802f49 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802e81:	83 3d 64 69 80 00 00 	cmpl   $0x0,0x806964
+  802e88:	0f 84 e4 00 00 00    	je     802f72 <nsipc_sendfile+0x107>
+{
+  802e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802e93:	89 fb                	mov    %edi,%ebx
+  802e95:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802e98:	0f 83 f0 00 00 00    	jae    802f8e <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802e9e:	89 fa                	mov    %edi,%edx
+  802ea0:	03 55 10             	add    0x10(%ebp),%edx
+  802ea3:	89 d0                	mov    %edx,%eax
+  802ea5:	c1 f8 1f             	sar    $0x1f,%eax
+  802ea8:	c1 e8 14             	shr    $0x14,%eax
+  802eab:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802eae:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802eb4:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802eb6:	6a 10                	push   $0x10
+  802eb8:	68 00 20 01 e0       	push   $0xe0012000
+  802ebd:	52                   	push   %edx
+  802ebe:	ff 75 0c             	push   0xc(%ebp)
+  802ec1:	e8 fe eb ff ff       	call   801ac4 <fmap>
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	0f 8e b8 00 00 00    	jle    802f89 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802ed1:	39 c6                	cmp    %eax,%esi
+  802ed3:	0f 8d b5 00 00 00    	jge    802f8e <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802ed9:	29 f0                	sub    %esi,%eax
+  802edb:	8b 55 14             	mov    0x14(%ebp),%edx
+  802ede:	29 da                	sub    %ebx,%edx
+  802ee0:	39 d0                	cmp    %edx,%eax
+  802ee2:	89 d3                	mov    %edx,%ebx
+  802ee4:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eea:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802eef:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802ef5:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802efb:	8b 45 18             	mov    0x18(%ebp),%eax
+  802efe:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802f03:	83 ec 0c             	sub    $0xc,%esp
+  802f06:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802f08:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802f0f:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802f12:	83 c0 01             	add    $0x1,%eax
+  802f15:	50                   	push   %eax
+  802f16:	68 00 10 01 e0       	push   $0xe0011000
+  802f1b:	6a 11                	push   $0x11
+  802f1d:	ff 35 64 69 80 00    	push   0x806964
+  802f23:	e8 ba 12 00 00       	call   8041e2 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802f28:	83 c4 1c             	add    $0x1c,%esp
+  802f2b:	6a 00                	push   $0x0
+  802f2d:	6a 00                	push   $0x0
+  802f2f:	6a 00                	push   $0x0
+  802f31:	e8 e8 0f 00 00       	call   803f1e <ipc_recv>
+  802f36:	83 c4 10             	add    $0x10,%esp
+  802f39:	85 c0                	test   %eax,%eax
+  802f3b:	78 5b                	js     802f98 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802f3d:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802f3f:	39 c3                	cmp    %eax,%ebx
+  802f41:	0f 8e 4c ff ff ff    	jle    802e93 <nsipc_sendfile+0x28>
+  802f47:	eb 45                	jmp    802f8e <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802f49:	83 ec 04             	sub    $0x4,%esp
+  802f4c:	6a 07                	push   $0x7
+  802f4e:	68 00 10 01 e0       	push   $0xe0011000
+  802f53:	6a 00                	push   $0x0
+  802f55:	e8 89 de ff ff       	call   800de3 <sys_page_alloc>
+  802f5a:	89 c7                	mov    %eax,%edi
+  802f5c:	83 c4 10             	add    $0x10,%esp
+  802f5f:	85 c0                	test   %eax,%eax
+  802f61:	78 2b                	js     802f8e <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802f63:	c7 05 68 69 80 00 01 	movl   $0x1,0x806968
+  802f6a:	00 00 00 
+  802f6d:	e9 0f ff ff ff       	jmp    802e81 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f72:	83 ec 0c             	sub    $0xc,%esp
+  802f75:	6a 03                	push   $0x3
+  802f77:	e8 9b 12 00 00       	call   804217 <ipc_find_env>
+  802f7c:	a3 64 69 80 00       	mov    %eax,0x806964
+  802f81:	83 c4 10             	add    $0x10,%esp
+  802f84:	e9 05 ff ff ff       	jmp    802e8e <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802f89:	85 ff                	test   %edi,%edi
+  802f8b:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802f8e:	89 f8                	mov    %edi,%eax
+  802f90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f93:	5b                   	pop    %ebx
+  802f94:	5e                   	pop    %esi
+  802f95:	5f                   	pop    %edi
+  802f96:	5d                   	pop    %ebp
+  802f97:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802f98:	85 ff                	test   %edi,%edi
+  802f9a:	0f 44 f8             	cmove  %eax,%edi
+  802f9d:	eb ef                	jmp    802f8e <nsipc_sendfile+0x123>
+
+00802f9f <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802f9f:	55                   	push   %ebp
+  802fa0:	89 e5                	mov    %esp,%ebp
+  802fa2:	57                   	push   %edi
+  802fa3:	56                   	push   %esi
+  802fa4:	53                   	push   %ebx
+  802fa5:	83 ec 1c             	sub    $0x1c,%esp
+  802fa8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802fab:	e8 13 f9 ff ff       	call   8028c3 <nsbulk_map>
+  802fb0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fb3:	85 c0                	test   %eax,%eax
+  802fb5:	0f 88 ba 00 00 00    	js     803075 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802fbb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fbf:	0f 8e bb 00 00 00    	jle    803080 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802fc5:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802fca:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802fcf:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802fd4:	89 f8                	mov    %edi,%eax
+  802fd6:	29 f0                	sub    %esi,%eax
+  802fd8:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802fdc:	39 c8                	cmp    %ecx,%eax
+  802fde:	0f 47 c1             	cmova  %ecx,%eax
+  802fe1:	01 f0                	add    %esi,%eax
+  802fe3:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802fe5:	83 c2 01             	add    $0x1,%edx
+  802fe8:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802feb:	7e 07                	jle    802ff4 <nsipc_recvmsg+0x55>
+  802fed:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802ff2:	7e e0                	jle    802fd4 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802ff4:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802ffa:	c1 fa 0c             	sar    $0xc,%edx
+  802ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803002:	e8 0a f9 ff ff       	call   802911 <nsbulk_own>
+  803007:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80300a:	85 c0                	test   %eax,%eax
+  80300c:	78 67                	js     803075 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80300e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803011:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803016:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80301c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80301f:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803024:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803029:	89 f2                	mov    %esi,%edx
+  80302b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803030:	e8 44 f9 ff ff       	call   802979 <nsipc_bulk>
+  803035:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	78 39                	js     803075 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  80303c:	39 f0                	cmp    %esi,%eax
+  80303e:	7f 4a                	jg     80308a <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803040:	bf 00 00 00 00       	mov    $0x0,%edi
+  803045:	85 c0                	test   %eax,%eax
+  803047:	7e 2c                	jle    803075 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803049:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80304c:	29 fe                	sub    %edi,%esi
+  80304e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803051:	39 c6                	cmp    %eax,%esi
+  803053:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803056:	83 ec 04             	sub    $0x4,%esp
+  803059:	56                   	push   %esi
+  80305a:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803060:	50                   	push   %eax
+  803061:	ff 33                	push   (%ebx)
+  803063:	e8 f7 da ff ff       	call   800b5f <memmove>
+		n += m;
+  803068:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80306a:	83 c3 08             	add    $0x8,%ebx
+  80306d:	83 c4 10             	add    $0x10,%esp
+  803070:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803073:	7f d4                	jg     803049 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803075:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80307b:	5b                   	pop    %ebx
+  80307c:	5e                   	pop    %esi
+  80307d:	5f                   	pop    %edi
+  80307e:	5d                   	pop    %ebp
+  80307f:	c3                   	ret
+	int r, i, n, len = 0;
+  803080:	be 00 00 00 00       	mov    $0x0,%esi
+  803085:	e9 6a ff ff ff       	jmp    802ff4 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80308a:	68 47 4a 80 00       	push   $0x804a47
+  80308f:	68 82 49 80 00       	push   $0x804982
+  803094:	68 3b 01 00 00       	push   $0x13b
+  803099:	68 50 4a 80 00       	push   $0x804a50
+  80309e:	e8 3a d1 ff ff       	call   8001dd <_panic>
+
+008030a3 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8030a3:	55                   	push   %ebp
+  8030a4:	89 e5                	mov    %esp,%ebp
+  8030a6:	57                   	push   %edi
+  8030a7:	56                   	push   %esi
+  8030a8:	53                   	push   %ebx
+  8030a9:	83 ec 0c             	sub    $0xc,%esp
+  8030ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8030af:	8b 75 10             	mov    0x10(%ebp),%esi
+  8030b2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8030b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8030bd:	8b 07                	mov    (%edi),%eax
+  8030bf:	a3 04 80 80 00       	mov    %eax,0x808004
+  8030c4:	8b 47 04             	mov    0x4(%edi),%eax
+  8030c7:	a3 08 80 80 00       	mov    %eax,0x808008
+  8030cc:	8b 47 08             	mov    0x8(%edi),%eax
+  8030cf:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8030d4:	8b 47 0c             	mov    0xc(%edi),%eax
+  8030d7:	a3 10 80 80 00       	mov    %eax,0x808010
+  8030dc:	8b 47 10             	mov    0x10(%edi),%eax
+  8030df:	a3 14 80 80 00       	mov    %eax,0x808014
+  8030e4:	8b 47 14             	mov    0x14(%edi),%eax
+  8030e7:	a3 18 80 80 00       	mov    %eax,0x808018
+  8030ec:	8b 47 18             	mov    0x18(%edi),%eax
+  8030ef:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8030f4:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8030f7:	a3 20 80 80 00       	mov    %eax,0x808020
+  8030fc:	8b 47 20             	mov    0x20(%edi),%eax
+  8030ff:	a3 24 80 80 00       	mov    %eax,0x808024
+  803104:	8b 47 24             	mov    0x24(%edi),%eax
+  803107:	a3 28 80 80 00       	mov    %eax,0x808028
+  80310c:	8b 47 28             	mov    0x28(%edi),%eax
+  80310f:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  803114:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803117:	a3 30 80 80 00       	mov    %eax,0x808030
+  80311c:	8b 47 30             	mov    0x30(%edi),%eax
+  80311f:	a3 34 80 80 00       	mov    %eax,0x808034
+  803124:	8b 47 34             	mov    0x34(%edi),%eax
+  803127:	a3 38 80 80 00       	mov    %eax,0x808038
+  80312c:	8b 47 38             	mov    0x38(%edi),%eax
+  80312f:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  803134:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803137:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  80313c:	8b 06                	mov    (%esi),%eax
+  80313e:	a3 44 80 80 00       	mov    %eax,0x808044
+  803143:	8b 46 04             	mov    0x4(%esi),%eax
+  803146:	a3 48 80 80 00       	mov    %eax,0x808048
+  80314b:	8b 46 08             	mov    0x8(%esi),%eax
+  80314e:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  803153:	8b 46 0c             	mov    0xc(%esi),%eax
+  803156:	a3 50 80 80 00       	mov    %eax,0x808050
+  80315b:	8b 46 10             	mov    0x10(%esi),%eax
+  80315e:	a3 54 80 80 00       	mov    %eax,0x808054
+  803163:	8b 46 14             	mov    0x14(%esi),%eax
+  803166:	a3 58 80 80 00       	mov    %eax,0x808058
+  80316b:	8b 46 18             	mov    0x18(%esi),%eax
+  80316e:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803173:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803176:	a3 60 80 80 00       	mov    %eax,0x808060
+  80317b:	8b 46 20             	mov    0x20(%esi),%eax
+  80317e:	a3 64 80 80 00       	mov    %eax,0x808064
+  803183:	8b 46 24             	mov    0x24(%esi),%eax
+  803186:	a3 68 80 80 00       	mov    %eax,0x808068
+  80318b:	8b 46 28             	mov    0x28(%esi),%eax
+  80318e:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  803193:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803196:	a3 70 80 80 00       	mov    %eax,0x808070
+  80319b:	8b 46 30             	mov    0x30(%esi),%eax
+  80319e:	a3 74 80 80 00       	mov    %eax,0x808074
+  8031a3:	8b 46 34             	mov    0x34(%esi),%eax
+  8031a6:	a3 78 80 80 00       	mov    %eax,0x808078
+  8031ab:	8b 46 38             	mov    0x38(%esi),%eax
+  8031ae:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8031b3:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8031b6:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8031bb:	8b 03                	mov    (%ebx),%eax
+  8031bd:	a3 84 80 80 00       	mov    %eax,0x808084
+  8031c2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8031c5:	a3 88 80 80 00       	mov    %eax,0x808088
+  8031ca:	8b 43 08             	mov    0x8(%ebx),%eax
+  8031cd:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8031d2:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8031d5:	a3 90 80 80 00       	mov    %eax,0x808090
+  8031da:	8b 43 10             	mov    0x10(%ebx),%eax
+  8031dd:	a3 94 80 80 00       	mov    %eax,0x808094
+  8031e2:	8b 43 14             	mov    0x14(%ebx),%eax
+  8031e5:	a3 98 80 80 00       	mov    %eax,0x808098
+  8031ea:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031ed:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8031f2:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8031f5:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8031fa:	8b 43 20             	mov    0x20(%ebx),%eax
+  8031fd:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803202:	8b 43 24             	mov    0x24(%ebx),%eax
+  803205:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80320a:	8b 43 28             	mov    0x28(%ebx),%eax
+  80320d:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803212:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803215:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  80321a:	8b 43 30             	mov    0x30(%ebx),%eax
+  80321d:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803222:	8b 43 34             	mov    0x34(%ebx),%eax
+  803225:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80322a:	8b 43 38             	mov    0x38(%ebx),%eax
+  80322d:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803232:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803235:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80323a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80323d:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803242:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803247:	e8 2b f6 ff ff       	call   802877 <nsipc>
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	0f 88 ad 01 00 00    	js     803401 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803254:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80325a:	89 17                	mov    %edx,(%edi)
+  80325c:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803262:	89 57 04             	mov    %edx,0x4(%edi)
+  803265:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80326b:	89 57 08             	mov    %edx,0x8(%edi)
+  80326e:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803274:	89 57 0c             	mov    %edx,0xc(%edi)
+  803277:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80327d:	89 57 10             	mov    %edx,0x10(%edi)
+  803280:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803286:	89 57 14             	mov    %edx,0x14(%edi)
+  803289:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80328f:	89 57 18             	mov    %edx,0x18(%edi)
+  803292:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803298:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80329b:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8032a1:	89 57 20             	mov    %edx,0x20(%edi)
+  8032a4:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8032aa:	89 57 24             	mov    %edx,0x24(%edi)
+  8032ad:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8032b3:	89 57 28             	mov    %edx,0x28(%edi)
+  8032b6:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8032bc:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8032bf:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8032c5:	89 57 30             	mov    %edx,0x30(%edi)
+  8032c8:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8032ce:	89 57 34             	mov    %edx,0x34(%edi)
+  8032d1:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8032d7:	89 57 38             	mov    %edx,0x38(%edi)
+  8032da:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8032e0:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8032e3:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8032e9:	89 16                	mov    %edx,(%esi)
+  8032eb:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8032f1:	89 56 04             	mov    %edx,0x4(%esi)
+  8032f4:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8032fa:	89 56 08             	mov    %edx,0x8(%esi)
+  8032fd:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803303:	89 56 0c             	mov    %edx,0xc(%esi)
+  803306:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80330c:	89 56 10             	mov    %edx,0x10(%esi)
+  80330f:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803315:	89 56 14             	mov    %edx,0x14(%esi)
+  803318:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  80331e:	89 56 18             	mov    %edx,0x18(%esi)
+  803321:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  803327:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80332a:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803330:	89 56 20             	mov    %edx,0x20(%esi)
+  803333:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  803339:	89 56 24             	mov    %edx,0x24(%esi)
+  80333c:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803342:	89 56 28             	mov    %edx,0x28(%esi)
+  803345:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  80334b:	89 56 2c             	mov    %edx,0x2c(%esi)
+  80334e:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  803354:	89 56 30             	mov    %edx,0x30(%esi)
+  803357:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  80335d:	89 56 34             	mov    %edx,0x34(%esi)
+  803360:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  803366:	89 56 38             	mov    %edx,0x38(%esi)
+  803369:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  80336f:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803372:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  803378:	89 13                	mov    %edx,(%ebx)
+  80337a:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803380:	89 53 04             	mov    %edx,0x4(%ebx)
+  803383:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  803389:	89 53 08             	mov    %edx,0x8(%ebx)
+  80338c:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803392:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803395:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  80339b:	89 53 10             	mov    %edx,0x10(%ebx)
+  80339e:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8033a4:	89 53 14             	mov    %edx,0x14(%ebx)
+  8033a7:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8033ad:	89 53 18             	mov    %edx,0x18(%ebx)
+  8033b0:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8033b6:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8033b9:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8033bf:	89 53 20             	mov    %edx,0x20(%ebx)
+  8033c2:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8033c8:	89 53 24             	mov    %edx,0x24(%ebx)
+  8033cb:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8033d1:	89 53 28             	mov    %edx,0x28(%ebx)
+  8033d4:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8033da:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8033dd:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8033e3:	89 53 30             	mov    %edx,0x30(%ebx)
+  8033e6:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  8033ec:	89 53 34             	mov    %edx,0x34(%ebx)
+  8033ef:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  8033f5:	89 53 38             	mov    %edx,0x38(%ebx)
+  8033f8:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  8033fe:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803401:	83 c4 0c             	add    $0xc,%esp
+  803404:	5b                   	pop    %ebx
+  803405:	5e                   	pop    %esi
+  803406:	5f                   	pop    %edi
+  803407:	5d                   	pop    %ebp
+  803408:	c3                   	ret
+
+00803409 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803409:	55                   	push   %ebp
+  80340a:	89 e5                	mov    %esp,%ebp
+  80340c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80340f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803412:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803417:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80341a:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  80341f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803422:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  803427:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80342c:	e8 46 f4 ff ff       	call   802877 <nsipc>
+}
+  803431:	c9                   	leave
+  803432:	c3                   	ret
+
+00803433 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803433:	55                   	push   %ebp
+  803434:	89 e5                	mov    %esp,%ebp
+  803436:	56                   	push   %esi
+  803437:	53                   	push   %ebx
+  803438:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  80343b:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803441:	8b 45 10             	mov    0x10(%ebp),%eax
+  803444:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803449:	b8 10 00 00 00       	mov    $0x10,%eax
+  80344e:	e8 24 f4 ff ff       	call   802877 <nsipc>
+  803453:	89 c3                	mov    %eax,%ebx
+  803455:	85 c0                	test   %eax,%eax
+  803457:	7e 1f                	jle    803478 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803459:	39 c6                	cmp    %eax,%esi
+  80345b:	7c 24                	jl     803481 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  80345d:	83 ec 04             	sub    $0x4,%esp
+  803460:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803467:	50                   	push   %eax
+  803468:	68 00 80 80 00       	push   $0x808000
+  80346d:	ff 75 08             	push   0x8(%ebp)
+  803470:	e8 ea d6 ff ff       	call   800b5f <memmove>
+  803475:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803478:	89 d8                	mov    %ebx,%eax
+  80347a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80347d:	5b                   	pop    %ebx
+  80347e:	5e                   	pop    %esi
+  80347f:	5d                   	pop    %ebp
+  803480:	c3                   	ret
+		assert(r <= max);
+  803481:	68 68 4a 80 00       	push   $0x804a68
+  803486:	68 82 49 80 00       	push   $0x804982
+  80348b:	68 6a 01 00 00       	push   $0x16a
+  803490:	68 50 4a 80 00       	push   $0x804a50
+  803495:	e8 43 cd ff ff       	call   8001dd <_panic>
+
+0080349a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80349a:	55                   	push   %ebp
+  80349b:	89 e5                	mov    %esp,%ebp
+  80349d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8034a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8034a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034ab:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8034b0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034b3:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8034b8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8034bd:	e8 b5 f3 ff ff       	call   802877 <nsipc>
+}
+  8034c2:	c9                   	leave
+  8034c3:	c3                   	ret
+
+008034c4 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8034c4:	55                   	push   %ebp
+  8034c5:	89 e5                	mov    %esp,%ebp
+  8034c7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8034ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034cd:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8034d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8034d7:	e8 9b f3 ff ff       	call   802877 <nsipc>
+}
+  8034dc:	c9                   	leave
+  8034dd:	c3                   	ret
+
+008034de <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8034de:	55                   	push   %ebp
+  8034df:	89 e5                	mov    %esp,%ebp
+  8034e1:	53                   	push   %ebx
+  8034e2:	83 ec 04             	sub    $0x4,%esp
+  8034e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8034e8:	b8 12 00 00 00       	mov    $0x12,%eax
+  8034ed:	e8 85 f3 ff ff       	call   802877 <nsipc>
+  8034f2:	85 c0                	test   %eax,%eax
+  8034f4:	78 50                	js     803546 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8034f6:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8034fc:	89 13                	mov    %edx,(%ebx)
+  8034fe:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803504:	89 53 04             	mov    %edx,0x4(%ebx)
+  803507:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80350d:	89 53 08             	mov    %edx,0x8(%ebx)
+  803510:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803516:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803519:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80351f:	89 53 10             	mov    %edx,0x10(%ebx)
+  803522:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803528:	89 53 14             	mov    %edx,0x14(%ebx)
+  80352b:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803531:	89 53 18             	mov    %edx,0x18(%ebx)
+  803534:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80353a:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80353d:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803543:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803549:	c9                   	leave
+  80354a:	c3                   	ret
+
+0080354b <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80354b:	55                   	push   %ebp
+  80354c:	89 e5                	mov    %esp,%ebp
+  80354e:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803551:	6a 03                	push   $0x3
+  803553:	e8 bf 0c 00 00       	call   804217 <ipc_find_env>
+  803558:	a3 64 69 80 00       	mov    %eax,0x806964
+	nsipcbuf.shard.req_shard = shard;
+  80355d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803560:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803565:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80356a:	e8 08 f3 ff ff       	call   802877 <nsipc>
+  80356f:	83 c4 10             	add    $0x10,%esp
+  803572:	85 c0                	test   %eax,%eax
+  803574:	78 0a                	js     803580 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803576:	a3 64 69 80 00       	mov    %eax,0x806964
+	return 0;
+  80357b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803580:	c9                   	leave
+  803581:	c3                   	ret
+
+00803582 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803582:	55                   	push   %ebp
+  803583:	89 e5                	mov    %esp,%ebp
+  803585:	57                   	push   %edi
+  803586:	56                   	push   %esi
+  803587:	53                   	push   %ebx
+  803588:	83 ec 1c             	sub    $0x1c,%esp
+  80358b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80358e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803591:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803596:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80359b:	89 e0                	mov    %esp,%eax
+  80359d:	89 f2                	mov    %esi,%edx
+  80359f:	29 c2                	sub    %eax,%edx
+  8035a1:	89 d0                	mov    %edx,%eax
+  8035a3:	c1 e8 0f             	shr    $0xf,%eax
+  8035a6:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8035ac:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8035af:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  8035b6:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8035b9:	83 ec 0c             	sub    $0xc,%esp
+  8035bc:	ff 75 e0             	push   -0x20(%ebp)
+  8035bf:	e8 92 0c 00 00       	call   804256 <pageref>
+  8035c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8035c7:	83 c4 04             	add    $0x4,%esp
+  8035ca:	ff 75 dc             	push   -0x24(%ebp)
+  8035cd:	e8 84 0c 00 00       	call   804256 <pageref>
+  8035d2:	89 e2                	mov    %esp,%edx
+  8035d4:	89 f1                	mov    %esi,%ecx
+  8035d6:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8035d8:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8035db:	89 ca                	mov    %ecx,%edx
+  8035dd:	c1 ea 0f             	shr    $0xf,%edx
+  8035e0:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8035e6:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8035e9:	8b 14 95 80 69 80 00 	mov    0x806980(,%edx,4),%edx
+  8035f0:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8035f3:	39 d7                	cmp    %edx,%edi
+  8035f5:	74 40                	je     803637 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8035f7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035fa:	75 9f                	jne    80359b <_pipeisclosed+0x19>
+  8035fc:	89 e2                	mov    %esp,%edx
+  8035fe:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803603:	29 d0                	sub    %edx,%eax
+  803605:	89 c2                	mov    %eax,%edx
+  803607:	c1 ea 0f             	shr    $0xf,%edx
+  80360a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80360f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803614:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803617:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  80361e:	8b 40 58             	mov    0x58(%eax),%eax
+  803621:	6a 01                	push   $0x1
+  803623:	50                   	push   %eax
+  803624:	57                   	push   %edi
+  803625:	68 71 4a 80 00       	push   $0x804a71
+  80362a:	e8 89 cc ff ff       	call   8002b8 <cprintf>
+  80362f:	83 c4 10             	add    $0x10,%esp
+  803632:	e9 5f ff ff ff       	jmp    803596 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803637:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80363a:	0f 94 c0             	sete   %al
+  80363d:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803643:	5b                   	pop    %ebx
+  803644:	5e                   	pop    %esi
+  803645:	5f                   	pop    %edi
+  803646:	5d                   	pop    %ebp
+  803647:	c3                   	ret
+
+00803648 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803648:	55                   	push   %ebp
+  803649:	89 e5                	mov    %esp,%ebp
+  80364b:	53                   	push   %ebx
+  80364c:	83 ec 0c             	sub    $0xc,%esp
+  80364f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803652:	53                   	push   %ebx
+  803653:	6a 00                	push   $0x0
+  803655:	e8 0e d8 ff ff       	call   800e68 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80365a:	89 1c 24             	mov    %ebx,(%esp)
+  80365d:	e8 f4 db ff ff       	call   801256 <fd2data>
+  803662:	83 c4 08             	add    $0x8,%esp
+  803665:	50                   	push   %eax
+  803666:	6a 00                	push   $0x0
+  803668:	e8 fb d7 ff ff       	call   800e68 <sys_page_unmap>
+}
+  80366d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803670:	c9                   	leave
+  803671:	c3                   	ret
+
+00803672 <devpipe_read>:
+{
+  803672:	55                   	push   %ebp
+  803673:	89 e5                	mov    %esp,%ebp
+  803675:	57                   	push   %edi
+  803676:	56                   	push   %esi
+  803677:	53                   	push   %ebx
+  803678:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80367b:	ff 75 08             	push   0x8(%ebp)
+  80367e:	e8 d3 db ff ff       	call   801256 <fd2data>
+  803683:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803685:	8b 70 04             	mov    0x4(%eax),%esi
+  803688:	8b 00                	mov    (%eax),%eax
+  80368a:	83 c4 10             	add    $0x10,%esp
+  80368d:	39 f0                	cmp    %esi,%eax
+  80368f:	75 36                	jne    8036c7 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803691:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803694:	89 da                	mov    %ebx,%edx
+  803696:	8b 45 08             	mov    0x8(%ebp),%eax
+  803699:	e8 e4 fe ff ff       	call   803582 <_pipeisclosed>
+  80369e:	85 c0                	test   %eax,%eax
+  8036a0:	0f 85 d4 00 00 00    	jne    80377a <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8036a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036ab:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8036af:	83 ec 04             	sub    $0x4,%esp
+  8036b2:	6a ff                	push   $0xffffffff
+  8036b4:	56                   	push   %esi
+  8036b5:	57                   	push   %edi
+  8036b6:	e8 26 db ff ff       	call   8011e1 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8036bb:	8b 73 04             	mov    0x4(%ebx),%esi
+  8036be:	8b 03                	mov    (%ebx),%eax
+  8036c0:	83 c4 10             	add    $0x10,%esp
+  8036c3:	39 c6                	cmp    %eax,%esi
+  8036c5:	74 cd                	je     803694 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036c7:	8b 73 04             	mov    0x4(%ebx),%esi
+  8036ca:	8b 03                	mov    (%ebx),%eax
+  8036cc:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8036d2:	29 c6                	sub    %eax,%esi
+  8036d4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036d9:	f7 e6                	mul    %esi
+  8036db:	c1 ea 0c             	shr    $0xc,%edx
+  8036de:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8036e4:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8036e6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8036e9:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8036ed:	8b 0b                	mov    (%ebx),%ecx
+  8036ef:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036f4:	f7 e1                	mul    %ecx
+  8036f6:	c1 ea 0b             	shr    $0xb,%edx
+  8036f9:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8036ff:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803701:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803706:	29 cf                	sub    %ecx,%edi
+  803708:	39 f7                	cmp    %esi,%edi
+  80370a:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80370d:	83 ec 04             	sub    $0x4,%esp
+  803710:	57                   	push   %edi
+  803711:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803715:	50                   	push   %eax
+  803716:	ff 75 0c             	push   0xc(%ebp)
+  803719:	e8 41 d4 ff ff       	call   800b5f <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  80371e:	83 c4 0c             	add    $0xc,%esp
+  803721:	89 f0                	mov    %esi,%eax
+  803723:	29 f8                	sub    %edi,%eax
+  803725:	50                   	push   %eax
+  803726:	8d 43 10             	lea    0x10(%ebx),%eax
+  803729:	50                   	push   %eax
+  80372a:	89 f8                	mov    %edi,%eax
+  80372c:	03 45 0c             	add    0xc(%ebp),%eax
+  80372f:	50                   	push   %eax
+  803730:	e8 2a d4 ff ff       	call   800b5f <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803735:	8b 0b                	mov    (%ebx),%ecx
+  803737:	01 f1                	add    %esi,%ecx
+  803739:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80373e:	f7 e1                	mul    %ecx
+  803740:	c1 ea 0c             	shr    $0xc,%edx
+  803743:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803749:	29 c1                	sub    %eax,%ecx
+  80374b:	89 0b                	mov    %ecx,(%ebx)
+  80374d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803752:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803756:	83 c4 10             	add    $0x10,%esp
+  803759:	85 c0                	test   %eax,%eax
+  80375b:	75 0a                	jne    803767 <devpipe_read+0xf5>
+	return n;
+  80375d:	89 f0                	mov    %esi,%eax
+}
+  80375f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803762:	5b                   	pop    %ebx
+  803763:	5e                   	pop    %esi
+  803764:	5f                   	pop    %edi
+  803765:	5d                   	pop    %ebp
+  803766:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803767:	83 ec 08             	sub    $0x8,%esp
+  80376a:	68 00 04 00 00       	push   $0x400
+  80376f:	53                   	push   %ebx
+  803770:	e8 8e da ff ff       	call   801203 <sys_futex_wake>
+  803775:	83 c4 10             	add    $0x10,%esp
+  803778:	eb e3                	jmp    80375d <devpipe_read+0xeb>
+			return 0;
+  80377a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377f:	eb de                	jmp    80375f <devpipe_read+0xed>
+
+00803781 <devpipe_write>:
+{
+  803781:	55                   	push   %ebp
+  803782:	89 e5                	mov    %esp,%ebp
+  803784:	57                   	push   %edi
+  803785:	56                   	push   %esi
+  803786:	53                   	push   %ebx
+  803787:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80378a:	ff 75 08             	push   0x8(%ebp)
+  80378d:	e8 c4 da ff ff       	call   801256 <fd2data>
+  803792:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803794:	83 c4 10             	add    $0x10,%esp
+  803797:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80379e:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8037a3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8037a7:	0f 84 43 01 00 00    	je     8038f0 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037ad:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037b0:	8b 06                	mov    (%esi),%eax
+  8037b2:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8037b8:	29 c1                	sub    %eax,%ecx
+  8037ba:	89 c8                	mov    %ecx,%eax
+  8037bc:	f7 e7                	mul    %edi
+  8037be:	c1 ea 0c             	shr    $0xc,%edx
+  8037c1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037c7:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8037c9:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8037cf:	75 52                	jne    803823 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8037d1:	89 f2                	mov    %esi,%edx
+  8037d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d6:	e8 a7 fd ff ff       	call   803582 <_pipeisclosed>
+  8037db:	85 c0                	test   %eax,%eax
+  8037dd:	0f 85 28 01 00 00    	jne    80390b <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8037e3:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037e5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037e8:	8b 06                	mov    (%esi),%eax
+  8037ea:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8037f0:	29 c1                	sub    %eax,%ecx
+  8037f2:	89 c8                	mov    %ecx,%eax
+  8037f4:	f7 e7                	mul    %edi
+  8037f6:	c1 ea 0c             	shr    $0xc,%edx
+  8037f9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037ff:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803801:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803807:	75 a4                	jne    8037ad <devpipe_write+0x2c>
+  803809:	b8 01 00 00 00       	mov    $0x1,%eax
+  80380e:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803812:	83 ec 04             	sub    $0x4,%esp
+  803815:	6a ff                	push   $0xffffffff
+  803817:	53                   	push   %ebx
+  803818:	56                   	push   %esi
+  803819:	e8 c3 d9 ff ff       	call   8011e1 <sys_futex_wait>
+}
+  80381e:	83 c4 10             	add    $0x10,%esp
+  803821:	eb 8a                	jmp    8037ad <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803823:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803826:	8b 06                	mov    (%esi),%eax
+  803828:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80382e:	29 c1                	sub    %eax,%ecx
+  803830:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803835:	f7 e1                	mul    %ecx
+  803837:	c1 ea 0c             	shr    $0xc,%edx
+  80383a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803840:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803842:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803847:	89 d8                	mov    %ebx,%eax
+  803849:	29 c8                	sub    %ecx,%eax
+  80384b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80384e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803851:	29 ca                	sub    %ecx,%edx
+  803853:	39 d0                	cmp    %edx,%eax
+  803855:	0f 46 d0             	cmovbe %eax,%edx
+  803858:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80385b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80385e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803863:	f7 e1                	mul    %ecx
+  803865:	c1 ea 0b             	shr    $0xb,%edx
+  803868:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80386e:	89 ca                	mov    %ecx,%edx
+  803870:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803872:	29 d3                	sub    %edx,%ebx
+  803874:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803877:	39 c3                	cmp    %eax,%ebx
+  803879:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80387c:	83 ec 04             	sub    $0x4,%esp
+  80387f:	53                   	push   %ebx
+  803880:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803883:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803886:	51                   	push   %ecx
+  803887:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80388b:	50                   	push   %eax
+  80388c:	e8 ce d2 ff ff       	call   800b5f <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803891:	83 c4 0c             	add    $0xc,%esp
+  803894:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803897:	29 d8                	sub    %ebx,%eax
+  803899:	50                   	push   %eax
+  80389a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80389d:	01 cb                	add    %ecx,%ebx
+  80389f:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8038a2:	53                   	push   %ebx
+  8038a3:	8d 46 10             	lea    0x10(%esi),%eax
+  8038a6:	50                   	push   %eax
+  8038a7:	e8 b3 d2 ff ff       	call   800b5f <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8038ac:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8038b2:	01 c1                	add    %eax,%ecx
+  8038b4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038b9:	f7 e1                	mul    %ecx
+  8038bb:	c1 ea 0c             	shr    $0xc,%edx
+  8038be:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8038c4:	89 ca                	mov    %ecx,%edx
+  8038c6:	29 c2                	sub    %eax,%edx
+  8038c8:	89 56 04             	mov    %edx,0x4(%esi)
+  8038cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d0:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8038d4:	83 c4 10             	add    $0x10,%esp
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	75 1a                	jne    8038f5 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8038db:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8038de:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8038e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038e4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8038e7:	0f 82 c0 fe ff ff    	jb     8037ad <devpipe_write+0x2c>
+  8038ed:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8038f0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8038f3:	eb 1b                	jmp    803910 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8038f5:	83 ec 08             	sub    $0x8,%esp
+  8038f8:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8038fd:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803900:	50                   	push   %eax
+  803901:	e8 fd d8 ff ff       	call   801203 <sys_futex_wake>
+  803906:	83 c4 10             	add    $0x10,%esp
+  803909:	eb d0                	jmp    8038db <devpipe_write+0x15a>
+				return 0;
+  80390b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803913:	5b                   	pop    %ebx
+  803914:	5e                   	pop    %esi
+  803915:	5f                   	pop    %edi
+  803916:	5d                   	pop    %ebp
+  803917:	c3                   	ret
+
+00803918 <devpipe_stat>:
+{
+  803918:	55                   	push   %ebp
+  803919:	89 e5                	mov    %esp,%ebp
+  80391b:	56                   	push   %esi
+  80391c:	53                   	push   %ebx
+  80391d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803920:	83 ec 0c             	sub    $0xc,%esp
+  803923:	ff 75 08             	push   0x8(%ebp)
+  803926:	e8 2b d9 ff ff       	call   801256 <fd2data>
+  80392b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80392d:	83 c4 08             	add    $0x8,%esp
+  803930:	68 84 4a 80 00       	push   $0x804a84
+  803935:	53                   	push   %ebx
+  803936:	e8 74 d0 ff ff       	call   8009af <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80393b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80393e:	8b 06                	mov    (%esi),%eax
+  803940:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803946:	29 c1                	sub    %eax,%ecx
+  803948:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80394d:	89 c8                	mov    %ecx,%eax
+  80394f:	f7 e2                	mul    %edx
+  803951:	c1 ea 0c             	shr    $0xc,%edx
+  803954:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80395a:	29 d1                	sub    %edx,%ecx
+  80395c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803962:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803969:	00 00 00 
+	stat->st_dev = &devpipe;
+  80396c:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803973:	50 80 00 
+}
+  803976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80397e:	5b                   	pop    %ebx
+  80397f:	5e                   	pop    %esi
+  803980:	5d                   	pop    %ebp
+  803981:	c3                   	ret
+
+00803982 <devpipe_poll>:
+{
+  803982:	55                   	push   %ebp
+  803983:	89 e5                	mov    %esp,%ebp
+  803985:	57                   	push   %edi
+  803986:	56                   	push   %esi
+  803987:	53                   	push   %ebx
+  803988:	83 ec 18             	sub    $0x18,%esp
+  80398b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80398e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803991:	57                   	push   %edi
+  803992:	e8 bf d8 ff ff       	call   801256 <fd2data>
+  803997:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803999:	83 c4 10             	add    $0x10,%esp
+  80399c:	89 f3                	mov    %esi,%ebx
+  80399e:	83 e3 01             	and    $0x1,%ebx
+  8039a1:	75 27                	jne    8039ca <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8039a3:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8039a9:	75 48                	jne    8039f3 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8039ab:	89 ca                	mov    %ecx,%edx
+  8039ad:	89 f8                	mov    %edi,%eax
+  8039af:	e8 ce fb ff ff       	call   803582 <_pipeisclosed>
+  8039b4:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8039b6:	89 d8                	mov    %ebx,%eax
+  8039b8:	83 c8 10             	or     $0x10,%eax
+  8039bb:	85 d2                	test   %edx,%edx
+  8039bd:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8039c0:	89 d8                	mov    %ebx,%eax
+  8039c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c5:	5b                   	pop    %ebx
+  8039c6:	5e                   	pop    %esi
+  8039c7:	5f                   	pop    %edi
+  8039c8:	5d                   	pop    %ebp
+  8039c9:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039ca:	8b 58 04             	mov    0x4(%eax),%ebx
+  8039cd:	8b 00                	mov    (%eax),%eax
+  8039cf:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8039d5:	29 c3                	sub    %eax,%ebx
+  8039d7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8039dc:	89 d8                	mov    %ebx,%eax
+  8039de:	f7 e2                	mul    %edx
+  8039e0:	c1 ea 0c             	shr    $0xc,%edx
+  8039e3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8039e9:	39 d3                	cmp    %edx,%ebx
+  8039eb:	0f 95 c3             	setne  %bl
+  8039ee:	0f b6 db             	movzbl %bl,%ebx
+  8039f1:	eb b0                	jmp    8039a3 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039f3:	8b 71 04             	mov    0x4(%ecx),%esi
+  8039f6:	8b 01                	mov    (%ecx),%eax
+  8039f8:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8039fe:	29 c6                	sub    %eax,%esi
+  803a00:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a05:	89 f0                	mov    %esi,%eax
+  803a07:	f7 e2                	mul    %edx
+  803a09:	c1 ea 0c             	shr    $0xc,%edx
+  803a0c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a12:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803a14:	89 d8                	mov    %ebx,%eax
+  803a16:	83 c8 04             	or     $0x4,%eax
+  803a19:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803a1f:	0f 42 d8             	cmovb  %eax,%ebx
+  803a22:	eb 87                	jmp    8039ab <devpipe_poll+0x29>
+
+00803a24 <pipe>:
+{
+  803a24:	55                   	push   %ebp
+  803a25:	89 e5                	mov    %esp,%ebp
+  803a27:	56                   	push   %esi
+  803a28:	53                   	push   %ebx
+  803a29:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803a2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a2f:	50                   	push   %eax
+  803a30:	e8 38 d8 ff ff       	call   80126d <fd_alloc>
+  803a35:	89 c3                	mov    %eax,%ebx
+  803a37:	83 c4 10             	add    $0x10,%esp
+  803a3a:	85 c0                	test   %eax,%eax
+  803a3c:	0f 88 23 01 00 00    	js     803b65 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a42:	83 ec 04             	sub    $0x4,%esp
+  803a45:	68 07 04 00 00       	push   $0x407
+  803a4a:	ff 75 f4             	push   -0xc(%ebp)
+  803a4d:	6a 00                	push   $0x0
+  803a4f:	e8 8f d3 ff ff       	call   800de3 <sys_page_alloc>
+  803a54:	89 c3                	mov    %eax,%ebx
+  803a56:	83 c4 10             	add    $0x10,%esp
+  803a59:	85 c0                	test   %eax,%eax
+  803a5b:	0f 88 04 01 00 00    	js     803b65 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803a61:	83 ec 0c             	sub    $0xc,%esp
+  803a64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a67:	50                   	push   %eax
+  803a68:	e8 00 d8 ff ff       	call   80126d <fd_alloc>
+  803a6d:	89 c3                	mov    %eax,%ebx
+  803a6f:	83 c4 10             	add    $0x10,%esp
+  803a72:	85 c0                	test   %eax,%eax
+  803a74:	0f 88 db 00 00 00    	js     803b55 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a7a:	83 ec 04             	sub    $0x4,%esp
+  803a7d:	68 07 04 00 00       	push   $0x407
+  803a82:	ff 75 f0             	push   -0x10(%ebp)
+  803a85:	6a 00                	push   $0x0
+  803a87:	e8 57 d3 ff ff       	call   800de3 <sys_page_alloc>
+  803a8c:	89 c3                	mov    %eax,%ebx
+  803a8e:	83 c4 10             	add    $0x10,%esp
+  803a91:	85 c0                	test   %eax,%eax
+  803a93:	0f 88 bc 00 00 00    	js     803b55 <pipe+0x131>
+	va = fd2data(fd0);
+  803a99:	83 ec 0c             	sub    $0xc,%esp
+  803a9c:	ff 75 f4             	push   -0xc(%ebp)
+  803a9f:	e8 b2 d7 ff ff       	call   801256 <fd2data>
+  803aa4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803aa6:	83 c4 0c             	add    $0xc,%esp
+  803aa9:	68 07 04 00 00       	push   $0x407
+  803aae:	50                   	push   %eax
+  803aaf:	6a 00                	push   $0x0
+  803ab1:	e8 2d d3 ff ff       	call   800de3 <sys_page_alloc>
+  803ab6:	89 c3                	mov    %eax,%ebx
+  803ab8:	83 c4 10             	add    $0x10,%esp
+  803abb:	85 c0                	test   %eax,%eax
+  803abd:	0f 88 82 00 00 00    	js     803b45 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ac3:	83 ec 0c             	sub    $0xc,%esp
+  803ac6:	ff 75 f0             	push   -0x10(%ebp)
+  803ac9:	e8 88 d7 ff ff       	call   801256 <fd2data>
+  803ace:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803ad5:	50                   	push   %eax
+  803ad6:	6a 00                	push   $0x0
+  803ad8:	56                   	push   %esi
+  803ad9:	6a 00                	push   $0x0
+  803adb:	e8 46 d3 ff ff       	call   800e26 <sys_page_map>
+  803ae0:	89 c3                	mov    %eax,%ebx
+  803ae2:	83 c4 20             	add    $0x20,%esp
+  803ae5:	85 c0                	test   %eax,%eax
+  803ae7:	78 4e                	js     803b37 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803ae9:	a1 60 50 80 00       	mov    0x805060,%eax
+  803aee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803af1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803af3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803af6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803afd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b00:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b05:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b0c:	83 ec 0c             	sub    $0xc,%esp
+  803b0f:	ff 75 f4             	push   -0xc(%ebp)
+  803b12:	e8 2f d7 ff ff       	call   801246 <fd2num>
+  803b17:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b1a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803b1c:	83 c4 04             	add    $0x4,%esp
+  803b1f:	ff 75 f0             	push   -0x10(%ebp)
+  803b22:	e8 1f d7 ff ff       	call   801246 <fd2num>
+  803b27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b2a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803b2d:	83 c4 10             	add    $0x10,%esp
+  803b30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b35:	eb 2e                	jmp    803b65 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803b37:	83 ec 08             	sub    $0x8,%esp
+  803b3a:	56                   	push   %esi
+  803b3b:	6a 00                	push   $0x0
+  803b3d:	e8 26 d3 ff ff       	call   800e68 <sys_page_unmap>
+  803b42:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803b45:	83 ec 08             	sub    $0x8,%esp
+  803b48:	ff 75 f0             	push   -0x10(%ebp)
+  803b4b:	6a 00                	push   $0x0
+  803b4d:	e8 16 d3 ff ff       	call   800e68 <sys_page_unmap>
+  803b52:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803b55:	83 ec 08             	sub    $0x8,%esp
+  803b58:	ff 75 f4             	push   -0xc(%ebp)
+  803b5b:	6a 00                	push   $0x0
+  803b5d:	e8 06 d3 ff ff       	call   800e68 <sys_page_unmap>
+  803b62:	83 c4 10             	add    $0x10,%esp
+}
+  803b65:	89 d8                	mov    %ebx,%eax
+  803b67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b6a:	5b                   	pop    %ebx
+  803b6b:	5e                   	pop    %esi
+  803b6c:	5d                   	pop    %ebp
+  803b6d:	c3                   	ret
+
+00803b6e <pipeisclosed>:
+{
+  803b6e:	55                   	push   %ebp
+  803b6f:	89 e5                	mov    %esp,%ebp
+  803b71:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b77:	50                   	push   %eax
+  803b78:	ff 75 08             	push   0x8(%ebp)
+  803b7b:	e8 3d d7 ff ff       	call   8012bd <fd_lookup>
+  803b80:	83 c4 10             	add    $0x10,%esp
+  803b83:	85 c0                	test   %eax,%eax
+  803b85:	78 18                	js     803b9f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803b87:	83 ec 0c             	sub    $0xc,%esp
+  803b8a:	ff 75 f4             	push   -0xc(%ebp)
+  803b8d:	e8 c4 d6 ff ff       	call   801256 <fd2data>
+  803b92:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803b94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b97:	e8 e6 f9 ff ff       	call   803582 <_pipeisclosed>
+  803b9c:	83 c4 10             	add    $0x10,%esp
+}
+  803b9f:	c9                   	leave
+  803ba0:	c3                   	ret
+
+00803ba1 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803ba1:	55                   	push   %ebp
+  803ba2:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803ba4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ba7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803bad:	5d                   	pop    %ebp
+  803bae:	c3                   	ret
+
+00803baf <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803baf:	55                   	push   %ebp
+  803bb0:	89 e5                	mov    %esp,%ebp
+  803bb2:	53                   	push   %ebx
+  803bb3:	83 ec 04             	sub    $0x4,%esp
+  803bb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803bb9:	8b 03                	mov    (%ebx),%eax
+  803bbb:	85 c0                	test   %eax,%eax
+  803bbd:	75 05                	jne    803bc4 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803bbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bc2:	c9                   	leave
+  803bc3:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803bc4:	83 ec 08             	sub    $0x8,%esp
+  803bc7:	50                   	push   %eax
+  803bc8:	8d 43 04             	lea    0x4(%ebx),%eax
+  803bcb:	50                   	push   %eax
+  803bcc:	e8 e7 d4 ff ff       	call   8010b8 <sys_page_batch>
+	pb->pb_n = 0;
+  803bd1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803bd7:	83 c4 10             	add    $0x10,%esp
+  803bda:	eb e3                	jmp    803bbf <pgbatch_flush+0x10>
+
+00803bdc <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803bdc:	55                   	push   %ebp
+  803bdd:	89 e5                	mov    %esp,%ebp
+  803bdf:	56                   	push   %esi
+  803be0:	53                   	push   %ebx
+  803be1:	89 c3                	mov    %eax,%ebx
+  803be3:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803be5:	83 38 20             	cmpl   $0x20,(%eax)
+  803be8:	74 2c                	je     803c16 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803bea:	8b 03                	mov    (%ebx),%eax
+  803bec:	8d 50 01             	lea    0x1(%eax),%edx
+  803bef:	89 13                	mov    %edx,(%ebx)
+  803bf1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803bf4:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803bf8:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803bfa:	83 ec 04             	sub    $0x4,%esp
+  803bfd:	6a 18                	push   $0x18
+  803bff:	6a 00                	push   $0x0
+  803c01:	50                   	push   %eax
+  803c02:	e8 23 cf ff ff       	call   800b2a <memset>
+	return 0;
+  803c07:	83 c4 10             	add    $0x10,%esp
+  803c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c12:	5b                   	pop    %ebx
+  803c13:	5e                   	pop    %esi
+  803c14:	5d                   	pop    %ebp
+  803c15:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803c16:	83 ec 0c             	sub    $0xc,%esp
+  803c19:	50                   	push   %eax
+  803c1a:	e8 90 ff ff ff       	call   803baf <pgbatch_flush>
+  803c1f:	83 c4 10             	add    $0x10,%esp
+  803c22:	85 c0                	test   %eax,%eax
+  803c24:	79 c4                	jns    803bea <pgbatch_slot+0xe>
+  803c26:	eb e7                	jmp    803c0f <pgbatch_slot+0x33>
+
+00803c28 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803c28:	55                   	push   %ebp
+  803c29:	89 e5                	mov    %esp,%ebp
+  803c2b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c2e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c34:	e8 a3 ff ff ff       	call   803bdc <pgbatch_slot>
+  803c39:	85 c0                	test   %eax,%eax
+  803c3b:	78 20                	js     803c5d <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803c3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c40:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803c46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c49:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803c4c:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c4f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803c52:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c55:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803c58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c5d:	c9                   	leave
+  803c5e:	c3                   	ret
+
+00803c5f <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803c5f:	55                   	push   %ebp
+  803c60:	89 e5                	mov    %esp,%ebp
+  803c62:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c65:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c68:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c6b:	e8 6c ff ff ff       	call   803bdc <pgbatch_slot>
+  803c70:	85 c0                	test   %eax,%eax
+  803c72:	78 2c                	js     803ca0 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803c74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c77:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803c7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c80:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803c83:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c86:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803c89:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c8c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803c8f:	8b 55 18             	mov    0x18(%ebp),%edx
+  803c92:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803c95:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803c98:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ca0:	c9                   	leave
+  803ca1:	c3                   	ret
+
+00803ca2 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803ca2:	55                   	push   %ebp
+  803ca3:	89 e5                	mov    %esp,%ebp
+  803ca5:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ca8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803cab:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cae:	e8 29 ff ff ff       	call   803bdc <pgbatch_slot>
+  803cb3:	85 c0                	test   %eax,%eax
+  803cb5:	78 1a                	js     803cd1 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803cb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cba:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803cc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cc3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803cc6:	8b 55 10             	mov    0x10(%ebp),%edx
+  803cc9:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cd1:	c9                   	leave
+  803cd2:	c3                   	ret
+
+00803cd3 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803cd3:	55                   	push   %ebp
+  803cd4:	89 e5                	mov    %esp,%ebp
+  803cd6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803cd9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cdf:	e8 f8 fe ff ff       	call   803bdc <pgbatch_slot>
+  803ce4:	85 c0                	test   %eax,%eax
+  803ce6:	78 20                	js     803d08 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803ce8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ceb:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803cf1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cf4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803cf7:	8b 55 10             	mov    0x10(%ebp),%edx
+  803cfa:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803cfd:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d00:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d08:	c9                   	leave
+  803d09:	c3                   	ret
+
+00803d0a <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803d0a:	55                   	push   %ebp
+  803d0b:	89 e5                	mov    %esp,%ebp
+  803d0d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d10:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d16:	e8 c1 fe ff ff       	call   803bdc <pgbatch_slot>
+  803d1b:	85 c0                	test   %eax,%eax
+  803d1d:	78 26                	js     803d45 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803d1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d22:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803d28:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d2b:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803d2e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d31:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803d34:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d37:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803d3a:	8b 55 18             	mov    0x18(%ebp),%edx
+  803d3d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d45:	c9                   	leave
+  803d46:	c3                   	ret
+
+00803d47 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4c:	c3                   	ret
+
+00803d4d <devcons_poll>:
+{
+  803d4d:	55                   	push   %ebp
+  803d4e:	89 e5                	mov    %esp,%ebp
+  803d50:	53                   	push   %ebx
+  803d51:	83 ec 04             	sub    $0x4,%esp
+  803d54:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803d57:	89 da                	mov    %ebx,%edx
+  803d59:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803d5c:	83 3d 74 69 80 00 00 	cmpl   $0x0,0x806974
+  803d63:	74 0c                	je     803d71 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803d65:	89 d8                	mov    %ebx,%eax
+  803d67:	83 e0 01             	and    $0x1,%eax
+  803d6a:	09 d0                	or     %edx,%eax
+}
+  803d6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d6f:	c9                   	leave
+  803d70:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803d71:	e8 cf cf ff ff       	call   800d45 <sys_cgetc>
+  803d76:	a3 74 69 80 00       	mov    %eax,0x806974
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803d7b:	89 da                	mov    %ebx,%edx
+  803d7d:	83 e2 04             	and    $0x4,%edx
+  803d80:	85 c0                	test   %eax,%eax
+  803d82:	74 e6                	je     803d6a <devcons_poll+0x1d>
+  803d84:	eb df                	jmp    803d65 <devcons_poll+0x18>
+
+00803d86 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803d86:	55                   	push   %ebp
+  803d87:	89 e5                	mov    %esp,%ebp
+  803d89:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803d8c:	68 90 4a 80 00       	push   $0x804a90
+  803d91:	ff 75 0c             	push   0xc(%ebp)
+  803d94:	e8 16 cc ff ff       	call   8009af <strcpy>
+	return 0;
+}
+  803d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9e:	c9                   	leave
+  803d9f:	c3                   	ret
+
+00803da0 <devcons_write>:
+{
+  803da0:	55                   	push   %ebp
+  803da1:	89 e5                	mov    %esp,%ebp
+  803da3:	57                   	push   %edi
+  803da4:	56                   	push   %esi
+  803da5:	53                   	push   %ebx
+  803da6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803dac:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803daf:	85 ff                	test   %edi,%edi
+  803db1:	74 51                	je     803e04 <devcons_write+0x64>
+  803db3:	be 00 00 00 00       	mov    $0x0,%esi
+  803db8:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803dbd:	89 fb                	mov    %edi,%ebx
+  803dbf:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803dc1:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803dc6:	39 d3                	cmp    %edx,%ebx
+  803dc8:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803dcb:	83 ec 04             	sub    $0x4,%esp
+  803dce:	53                   	push   %ebx
+  803dcf:	03 45 0c             	add    0xc(%ebp),%eax
+  803dd2:	50                   	push   %eax
+  803dd3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803dd9:	50                   	push   %eax
+  803dda:	e8 80 cd ff ff       	call   800b5f <memmove>
+		sys_cputs(buf, m);
+  803ddf:	83 c4 08             	add    $0x8,%esp
+  803de2:	53                   	push   %ebx
+  803de3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803de9:	50                   	push   %eax
+  803dea:	e8 38 cf ff ff       	call   800d27 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803def:	01 de                	add    %ebx,%esi
+  803df1:	89 f0                	mov    %esi,%eax
+  803df3:	83 c4 10             	add    $0x10,%esp
+  803df6:	39 fe                	cmp    %edi,%esi
+  803df8:	72 c3                	jb     803dbd <devcons_write+0x1d>
+}
+  803dfa:	89 f0                	mov    %esi,%eax
+  803dfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dff:	5b                   	pop    %ebx
+  803e00:	5e                   	pop    %esi
+  803e01:	5f                   	pop    %edi
+  803e02:	5d                   	pop    %ebp
+  803e03:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803e04:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803e09:	eb ef                	jmp    803dfa <devcons_write+0x5a>
+
+00803e0b <devcons_read>:
+{
+  803e0b:	55                   	push   %ebp
+  803e0c:	89 e5                	mov    %esp,%ebp
+  803e0e:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803e11:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803e16:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803e1a:	74 36                	je     803e52 <devcons_read+0x47>
+	c = cons_peek;
+  803e1c:	a1 74 69 80 00       	mov    0x806974,%eax
+	cons_peek = 0;
+  803e21:	c7 05 74 69 80 00 00 	movl   $0x0,0x806974
+  803e28:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803e2b:	85 c0                	test   %eax,%eax
+  803e2d:	75 10                	jne    803e3f <devcons_read+0x34>
+  803e2f:	e8 11 cf ff ff       	call   800d45 <sys_cgetc>
+  803e34:	85 c0                	test   %eax,%eax
+  803e36:	75 07                	jne    803e3f <devcons_read+0x34>
+		sys_yield();
+  803e38:	e8 87 cf ff ff       	call   800dc4 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803e3d:	eb f0                	jmp    803e2f <devcons_read+0x24>
+	if (c < 0)
+  803e3f:	85 c0                	test   %eax,%eax
+  803e41:	78 0f                	js     803e52 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803e43:	83 f8 04             	cmp    $0x4,%eax
+  803e46:	74 0c                	je     803e54 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803e48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e4b:	88 02                	mov    %al,(%edx)
+	return 1;
+  803e4d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803e52:	c9                   	leave
+  803e53:	c3                   	ret
+		return 0;
+  803e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e59:	eb f7                	jmp    803e52 <devcons_read+0x47>
+
+00803e5b <cputchar>:
+{
+  803e5b:	55                   	push   %ebp
+  803e5c:	89 e5                	mov    %esp,%ebp
+  803e5e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803e61:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e64:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803e67:	6a 01                	push   $0x1
+  803e69:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803e6c:	50                   	push   %eax
+  803e6d:	e8 b5 ce ff ff       	call   800d27 <sys_cputs>
+}
+  803e72:	83 c4 10             	add    $0x10,%esp
+  803e75:	c9                   	leave
+  803e76:	c3                   	ret
+
+00803e77 <getchar>:
+{
+  803e77:	55                   	push   %ebp
+  803e78:	89 e5                	mov    %esp,%ebp
+  803e7a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803e7d:	6a 01                	push   $0x1
+  803e7f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803e82:	50                   	push   %eax
+  803e83:	6a 00                	push   $0x0
+  803e85:	e8 b7 d6 ff ff       	call   801541 <read>
+	if (r < 0)
+  803e8a:	83 c4 10             	add    $0x10,%esp
+  803e8d:	85 c0                	test   %eax,%eax
+  803e8f:	78 06                	js     803e97 <getchar+0x20>
+	if (r < 1)
+  803e91:	74 06                	je     803e99 <getchar+0x22>
+	return c;
+  803e93:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803e97:	c9                   	leave
+  803e98:	c3                   	ret
+		return -E_EOF;
+  803e99:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803e9e:	eb f7                	jmp    803e97 <getchar+0x20>
+
+00803ea0 <iscons>:
+{
+  803ea0:	55                   	push   %ebp
+  803ea1:	89 e5                	mov    %esp,%ebp
+  803ea3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ea6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ea9:	50                   	push   %eax
+  803eaa:	ff 75 08             	push   0x8(%ebp)
+  803ead:	e8 0b d4 ff ff       	call   8012bd <fd_lookup>
+  803eb2:	83 c4 10             	add    $0x10,%esp
+  803eb5:	85 c0                	test   %eax,%eax
+  803eb7:	78 11                	js     803eca <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803eb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ebc:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803ec2:	39 10                	cmp    %edx,(%eax)
+  803ec4:	0f 94 c0             	sete   %al
+  803ec7:	0f b6 c0             	movzbl %al,%eax
+}
+  803eca:	c9                   	leave
+  803ecb:	c3                   	ret
+
+00803ecc <opencons>:
+{
+  803ecc:	55                   	push   %ebp
+  803ecd:	89 e5                	mov    %esp,%ebp
+  803ecf:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803ed2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ed5:	50                   	push   %eax
+  803ed6:	e8 92 d3 ff ff       	call   80126d <fd_alloc>
+  803edb:	83 c4 10             	add    $0x10,%esp
+  803ede:	85 c0                	test   %eax,%eax
+  803ee0:	78 3a                	js     803f1c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803ee2:	83 ec 04             	sub    $0x4,%esp
+  803ee5:	68 07 04 00 00       	push   $0x407
+  803eea:	ff 75 f4             	push   -0xc(%ebp)
+  803eed:	6a 00                	push   $0x0
+  803eef:	e8 ef ce ff ff       	call   800de3 <sys_page_alloc>
+  803ef4:	83 c4 10             	add    $0x10,%esp
+  803ef7:	85 c0                	test   %eax,%eax
+  803ef9:	78 21                	js     803f1c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803efb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803efe:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803f04:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803f06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f09:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803f10:	83 ec 0c             	sub    $0xc,%esp
+  803f13:	50                   	push   %eax
+  803f14:	e8 2d d3 ff ff       	call   801246 <fd2num>
+  803f19:	83 c4 10             	add    $0x10,%esp
+}
+  803f1c:	c9                   	leave
+  803f1d:	c3                   	ret
+
+00803f1e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803f1e:	55                   	push   %ebp
+  803f1f:	89 e5                	mov    %esp,%ebp
+  803f21:	56                   	push   %esi
+  803f22:	53                   	push   %ebx
+  803f23:	8b 75 08             	mov    0x8(%ebp),%esi
+  803f26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803f2c:	85 c0                	test   %eax,%eax
+  803f2e:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f33:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803f36:	83 ec 0c             	sub    $0xc,%esp
+  803f39:	50                   	push   %eax
+  803f3a:	e8 54 d0 ff ff       	call   800f93 <sys_ipc_recv>
+  803f3f:	83 c4 10             	add    $0x10,%esp
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	0f 88 8b 00 00 00    	js     803fd5 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803f4a:	85 f6                	test   %esi,%esi
+  803f4c:	74 2a                	je     803f78 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803f4e:	89 e2                	mov    %esp,%edx
+  803f50:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f55:	29 d0                	sub    %edx,%eax
+  803f57:	89 c2                	mov    %eax,%edx
+  803f59:	c1 ea 0f             	shr    $0xf,%edx
+  803f5c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f66:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803f69:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  803f70:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803f76:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803f78:	85 db                	test   %ebx,%ebx
+  803f7a:	74 2a                	je     803fa6 <ipc_recv+0x88>
+  803f7c:	89 e2                	mov    %esp,%edx
+  803f7e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f83:	29 d0                	sub    %edx,%eax
+  803f85:	89 c2                	mov    %eax,%edx
+  803f87:	c1 ea 0f             	shr    $0xf,%edx
+  803f8a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f94:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803f97:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  803f9e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803fa4:	89 03                	mov    %eax,(%ebx)
+  803fa6:	89 e2                	mov    %esp,%edx
+  803fa8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803fad:	29 d0                	sub    %edx,%eax
+  803faf:	89 c2                	mov    %eax,%edx
+  803fb1:	c1 ea 0f             	shr    $0xf,%edx
+  803fb4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbe:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803fc1:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  803fc8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803fce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803fd1:	5b                   	pop    %ebx
+  803fd2:	5e                   	pop    %esi
+  803fd3:	5d                   	pop    %ebp
+  803fd4:	c3                   	ret
+		if(from_env_store != NULL)
+  803fd5:	85 f6                	test   %esi,%esi
+  803fd7:	74 06                	je     803fdf <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803fd9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803fdf:	85 db                	test   %ebx,%ebx
+  803fe1:	74 eb                	je     803fce <ipc_recv+0xb0>
+			*perm_store = 0;
+  803fe3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803fe9:	eb e3                	jmp    803fce <ipc_recv+0xb0>
+
+00803feb <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803feb:	55                   	push   %ebp
+  803fec:	89 e5                	mov    %esp,%ebp
+  803fee:	57                   	push   %edi
+  803fef:	56                   	push   %esi
+  803ff0:	53                   	push   %ebx
+  803ff1:	83 ec 14             	sub    $0x14,%esp
+  803ff4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803ff7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ffa:	8b 75 14             	mov    0x14(%ebp),%esi
+  803ffd:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804000:	85 c0                	test   %eax,%eax
+  804002:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804007:	0f 44 c2             	cmove  %edx,%eax
+  80400a:	ff 75 10             	push   0x10(%ebp)
+  80400d:	50                   	push   %eax
+  80400e:	e8 e2 cf ff ff       	call   800ff5 <sys_ipc_recv_pages>
+  804013:	83 c4 10             	add    $0x10,%esp
+  804016:	85 c0                	test   %eax,%eax
+  804018:	0f 88 ba 00 00 00    	js     8040d8 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80401e:	85 ff                	test   %edi,%edi
+  804020:	74 2a                	je     80404c <ipc_recv_pages+0x61>
+  804022:	89 e2                	mov    %esp,%edx
+  804024:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804029:	29 d0                	sub    %edx,%eax
+  80402b:	89 c2                	mov    %eax,%edx
+  80402d:	c1 ea 0f             	shr    $0xf,%edx
+  804030:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804035:	b8 00 00 00 00       	mov    $0x0,%eax
+  80403a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80403d:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  804044:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80404a:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80404c:	85 f6                	test   %esi,%esi
+  80404e:	74 2a                	je     80407a <ipc_recv_pages+0x8f>
+  804050:	89 e2                	mov    %esp,%edx
+  804052:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804057:	29 d0                	sub    %edx,%eax
+  804059:	89 c2                	mov    %eax,%edx
+  80405b:	c1 ea 0f             	shr    $0xf,%edx
+  80405e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804063:	b8 00 00 00 00       	mov    $0x0,%eax
+  804068:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80406b:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  804072:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804078:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80407a:	85 db                	test   %ebx,%ebx
+  80407c:	74 2a                	je     8040a8 <ipc_recv_pages+0xbd>
+  80407e:	89 e2                	mov    %esp,%edx
+  804080:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804085:	29 d0                	sub    %edx,%eax
+  804087:	89 c2                	mov    %eax,%edx
+  804089:	c1 ea 0f             	shr    $0xf,%edx
+  80408c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804091:	b8 00 00 00 00       	mov    $0x0,%eax
+  804096:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804099:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  8040a0:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8040a6:	89 03                	mov    %eax,(%ebx)
+  8040a8:	89 e2                	mov    %esp,%edx
+  8040aa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040af:	29 d0                	sub    %edx,%eax
+  8040b1:	89 c2                	mov    %eax,%edx
+  8040b3:	c1 ea 0f             	shr    $0xf,%edx
+  8040b6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c0:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8040c3:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  8040ca:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8040d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040d3:	5b                   	pop    %ebx
+  8040d4:	5e                   	pop    %esi
+  8040d5:	5f                   	pop    %edi
+  8040d6:	5d                   	pop    %ebp
+  8040d7:	c3                   	ret
+		if (from_env_store)
+  8040d8:	85 ff                	test   %edi,%edi
+  8040da:	74 06                	je     8040e2 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8040dc:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8040e2:	85 f6                	test   %esi,%esi
+  8040e4:	74 06                	je     8040ec <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8040e6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8040ec:	85 db                	test   %ebx,%ebx
+  8040ee:	74 e0                	je     8040d0 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8040f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8040f6:	eb d8                	jmp    8040d0 <ipc_recv_pages+0xe5>
+
+008040f8 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8040f8:	55                   	push   %ebp
+  8040f9:	89 e5                	mov    %esp,%ebp
+  8040fb:	57                   	push   %edi
+  8040fc:	56                   	push   %esi
+  8040fd:	53                   	push   %ebx
+  8040fe:	83 ec 1c             	sub    $0x1c,%esp
+  804101:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804104:	8b 75 08             	mov    0x8(%ebp),%esi
+  804107:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80410d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804111:	75 2b                	jne    80413e <ipc_try_send_pages+0x46>
+  804113:	89 e2                	mov    %esp,%edx
+  804115:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80411a:	29 d0                	sub    %edx,%eax
+  80411c:	89 c2                	mov    %eax,%edx
+  80411e:	c1 ea 0f             	shr    $0xf,%edx
+  804121:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80412b:	0f 42 c2             	cmovb  %edx,%eax
+  80412e:	8b 04 85 80 69 80 00 	mov    0x806980(,%eax,4),%eax
+  804135:	8b 70 48             	mov    0x48(%eax),%esi
+  804138:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80413e:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804144:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804149:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80414c:	85 ff                	test   %edi,%edi
+  80414e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804153:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804156:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80415c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804162:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804168:	83 ec 0c             	sub    $0xc,%esp
+  80416b:	ff 75 14             	push   0x14(%ebp)
+  80416e:	ff 75 18             	push   0x18(%ebp)
+  804171:	57                   	push   %edi
+  804172:	ff 75 0c             	push   0xc(%ebp)
+  804175:	ff 75 08             	push   0x8(%ebp)
+  804178:	e8 57 ce ff ff       	call   800fd4 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80417d:	83 c4 20             	add    $0x20,%esp
+  804180:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804183:	75 21                	jne    8041a6 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804185:	83 ec 04             	sub    $0x4,%esp
+  804188:	6a ff                	push   $0xffffffff
+  80418a:	53                   	push   %ebx
+  80418b:	ff 75 e4             	push   -0x1c(%ebp)
+  80418e:	e8 4e d0 ff ff       	call   8011e1 <sys_futex_wait>
+  804193:	83 c4 10             	add    $0x10,%esp
+  804196:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804199:	74 c7                	je     804162 <ipc_try_send_pages+0x6a>
+  80419b:	85 c0                	test   %eax,%eax
+  80419d:	79 c3                	jns    804162 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80419f:	e8 20 cc ff ff       	call   800dc4 <sys_yield>
+  8041a4:	eb bc                	jmp    804162 <ipc_try_send_pages+0x6a>
+	}
+}
+  8041a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041a9:	5b                   	pop    %ebx
+  8041aa:	5e                   	pop    %esi
+  8041ab:	5f                   	pop    %edi
+  8041ac:	5d                   	pop    %ebp
+  8041ad:	c3                   	ret
+
+008041ae <ipc_send>:
+{
+  8041ae:	55                   	push   %ebp
+  8041af:	89 e5                	mov    %esp,%ebp
+  8041b1:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8041b4:	ff 75 14             	push   0x14(%ebp)
+  8041b7:	6a 01                	push   $0x1
+  8041b9:	ff 75 10             	push   0x10(%ebp)
+  8041bc:	ff 75 0c             	push   0xc(%ebp)
+  8041bf:	ff 75 08             	push   0x8(%ebp)
+  8041c2:	e8 31 ff ff ff       	call   8040f8 <ipc_try_send_pages>
+  8041c7:	83 c4 20             	add    $0x20,%esp
+  8041ca:	85 c0                	test   %eax,%eax
+  8041cc:	78 02                	js     8041d0 <ipc_send+0x22>
+}
+  8041ce:	c9                   	leave
+  8041cf:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8041d0:	50                   	push   %eax
+  8041d1:	68 9c 4a 80 00       	push   $0x804a9c
+  8041d6:	6a 3f                	push   $0x3f
+  8041d8:	68 b1 4a 80 00       	push   $0x804ab1
+  8041dd:	e8 fb bf ff ff       	call   8001dd <_panic>
+
+008041e2 <ipc_send_pages>:
+{
+  8041e2:	55                   	push   %ebp
+  8041e3:	89 e5                	mov    %esp,%ebp
+  8041e5:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8041e8:	ff 75 18             	push   0x18(%ebp)
+  8041eb:	ff 75 14             	push   0x14(%ebp)
+  8041ee:	ff 75 10             	push   0x10(%ebp)
+  8041f1:	ff 75 0c             	push   0xc(%ebp)
+  8041f4:	ff 75 08             	push   0x8(%ebp)
+  8041f7:	e8 fc fe ff ff       	call   8040f8 <ipc_try_send_pages>
+  8041fc:	83 c4 20             	add    $0x20,%esp
+  8041ff:	85 c0                	test   %eax,%eax
+  804201:	78 02                	js     804205 <ipc_send_pages+0x23>
+}
+  804203:	c9                   	leave
+  804204:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804205:	50                   	push   %eax
+  804206:	68 bb 4a 80 00       	push   $0x804abb
+  80420b:	6a 64                	push   $0x64
+  80420d:	68 b1 4a 80 00       	push   $0x804ab1
+  804212:	e8 c6 bf ff ff       	call   8001dd <_panic>
+
+00804217 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804217:	55                   	push   %ebp
+  804218:	89 e5                	mov    %esp,%ebp
+  80421a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80421d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804222:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804228:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80422e:	8b 52 50             	mov    0x50(%edx),%edx
+  804231:	39 ca                	cmp    %ecx,%edx
+  804233:	74 11                	je     804246 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804235:	83 c0 01             	add    $0x1,%eax
+  804238:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80423d:	75 e3                	jne    804222 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80423f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804244:	eb 0e                	jmp    804254 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804246:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80424c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804251:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804254:	5d                   	pop    %ebp
+  804255:	c3                   	ret
+
+00804256 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804256:	55                   	push   %ebp
+  804257:	89 e5                	mov    %esp,%ebp
+  804259:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80425c:	89 c2                	mov    %eax,%edx
+  80425e:	c1 ea 16             	shr    $0x16,%edx
+  804261:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804268:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80426d:	f6 c1 01             	test   $0x1,%cl
+  804270:	74 1e                	je     804290 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804272:	c1 e8 0c             	shr    $0xc,%eax
+  804275:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80427c:	a8 01                	test   $0x1,%al
+  80427e:	74 10                	je     804290 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804280:	c1 e8 0c             	shr    $0xc,%eax
+  804283:	c1 e0 04             	shl    $0x4,%eax
+  804286:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80428d:	0f b7 d2             	movzwl %dx,%edx
+}
+  804290:	89 d0                	mov    %edx,%eax
+  804292:	5d                   	pop    %ebp
+  804293:	c3                   	ret
+
+00804294 <__udivdi3>:
+  804294:	57                   	push   %edi
+  804295:	56                   	push   %esi
+  804296:	53                   	push   %ebx
+  804297:	83 ec 20             	sub    $0x20,%esp
+  80429a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80429e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8042a2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8042a6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8042aa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8042ae:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8042b2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8042b6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8042ba:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8042bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042c9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8042d0:	00 
+  8042d1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8042d8:	00 
+  8042d9:	eb 08                	jmp    8042e3 <__udivdi3+0x4f>
+  8042db:	83 e9 01             	sub    $0x1,%ecx
+  8042de:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8042e1:	74 68                	je     80434b <__udivdi3+0xb7>
+  8042e3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8042e7:	01 c0                	add    %eax,%eax
+  8042e9:	89 c6                	mov    %eax,%esi
+  8042eb:	89 d7                	mov    %edx,%edi
+  8042ed:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8042f1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8042f5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8042f8:	d3 ea                	shr    %cl,%edx
+  8042fa:	f6 c1 20             	test   $0x20,%cl
+  8042fd:	74 04                	je     804303 <__udivdi3+0x6f>
+  8042ff:	89 d0                	mov    %edx,%eax
+  804301:	31 d2                	xor    %edx,%edx
+  804303:	83 e0 01             	and    $0x1,%eax
+  804306:	89 04 24             	mov    %eax,(%esp)
+  804309:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804310:	00 
+  804311:	8b 04 24             	mov    (%esp),%eax
+  804314:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804318:	09 f0                	or     %esi,%eax
+  80431a:	09 fa                	or     %edi,%edx
+  80431c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804320:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804324:	39 f0                	cmp    %esi,%eax
+  804326:	89 d3                	mov    %edx,%ebx
+  804328:	19 fb                	sbb    %edi,%ebx
+  80432a:	72 af                	jb     8042db <__udivdi3+0x47>
+  80432c:	29 f0                	sub    %esi,%eax
+  80432e:	19 fa                	sbb    %edi,%edx
+  804330:	89 cf                	mov    %ecx,%edi
+  804332:	c1 ef 05             	shr    $0x5,%edi
+  804335:	83 e7 01             	and    $0x1,%edi
+  804338:	89 fe                	mov    %edi,%esi
+  80433a:	83 f6 01             	xor    $0x1,%esi
+  80433d:	d3 e6                	shl    %cl,%esi
+  80433f:	d3 e7                	shl    %cl,%edi
+  804341:	09 74 24 18          	or     %esi,0x18(%esp)
+  804345:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804349:	eb 90                	jmp    8042db <__udivdi3+0x47>
+  80434b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80434f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804353:	83 c4 20             	add    $0x20,%esp
+  804356:	5b                   	pop    %ebx
+  804357:	5e                   	pop    %esi
+  804358:	5f                   	pop    %edi
+  804359:	c3                   	ret
+
+0080435a <__umoddi3>:
+  80435a:	57                   	push   %edi
+  80435b:	56                   	push   %esi
+  80435c:	53                   	push   %ebx
+  80435d:	83 ec 08             	sub    $0x8,%esp
+  804360:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804364:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804368:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80436c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804370:	57                   	push   %edi
+  804371:	56                   	push   %esi
+  804372:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804376:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80437a:	52                   	push   %edx
+  80437b:	50                   	push   %eax
+  80437c:	e8 13 ff ff ff       	call   804294 <__udivdi3>
+  804381:	89 c3                	mov    %eax,%ebx
+  804383:	0f af d6             	imul   %esi,%edx
+  804386:	89 f9                	mov    %edi,%ecx
+  804388:	0f af cb             	imul   %ebx,%ecx
+  80438b:	01 d1                	add    %edx,%ecx
+  80438d:	89 d8                	mov    %ebx,%eax
+  80438f:	f7 e6                	mul    %esi
+  804391:	89 c6                	mov    %eax,%esi
+  804393:	89 d7                	mov    %edx,%edi
+  804395:	01 cf                	add    %ecx,%edi
+  804397:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80439b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80439f:	29 f0                	sub    %esi,%eax
+  8043a1:	19 fa                	sbb    %edi,%edx
+  8043a3:	83 c4 18             	add    $0x18,%esp
+  8043a6:	5b                   	pop    %ebx
+  8043a7:	5e                   	pop    %esi
+  8043a8:	5f                   	pop    %edi
+  8043a9:	c3                   	ret
+
+008043aa <__divdi3>:
+  8043aa:	53                   	push   %ebx
+  8043ab:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8043af:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8043b3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8043b7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8043bb:	85 d2                	test   %edx,%edx
+  8043bd:	78 12                	js     8043d1 <__divdi3+0x27>
+  8043bf:	85 db                	test   %ebx,%ebx
+  8043c1:	78 2e                	js     8043f1 <__divdi3+0x47>
+  8043c3:	53                   	push   %ebx
+  8043c4:	51                   	push   %ecx
+  8043c5:	52                   	push   %edx
+  8043c6:	50                   	push   %eax
+  8043c7:	e8 c8 fe ff ff       	call   804294 <__udivdi3>
+  8043cc:	83 c4 10             	add    $0x10,%esp
+  8043cf:	eb 1e                	jmp    8043ef <__divdi3+0x45>
+  8043d1:	f7 d8                	neg    %eax
+  8043d3:	83 d2 00             	adc    $0x0,%edx
+  8043d6:	f7 da                	neg    %edx
+  8043d8:	85 db                	test   %ebx,%ebx
+  8043da:	78 2a                	js     804406 <__divdi3+0x5c>
+  8043dc:	53                   	push   %ebx
+  8043dd:	51                   	push   %ecx
+  8043de:	52                   	push   %edx
+  8043df:	50                   	push   %eax
+  8043e0:	e8 af fe ff ff       	call   804294 <__udivdi3>
+  8043e5:	83 c4 10             	add    $0x10,%esp
+  8043e8:	f7 d8                	neg    %eax
+  8043ea:	83 d2 00             	adc    $0x0,%edx
+  8043ed:	f7 da                	neg    %edx
+  8043ef:	5b                   	pop    %ebx
+  8043f0:	c3                   	ret
+  8043f1:	f7 d9                	neg    %ecx
+  8043f3:	83 d3 00             	adc    $0x0,%ebx
+  8043f6:	f7 db                	neg    %ebx
+  8043f8:	53                   	push   %ebx
+  8043f9:	51                   	push   %ecx
+  8043fa:	52                   	push   %edx
+  8043fb:	50                   	push   %eax
+  8043fc:	e8 93 fe ff ff       	call   804294 <__udivdi3>
+  804401:	83 c4 10             	add    $0x10,%esp
+  804404:	eb e2                	jmp    8043e8 <__divdi3+0x3e>
+  804406:	f7 d9                	neg    %ecx
+  804408:	83 d3 00             	adc    $0x0,%ebx
+  80440b:	f7 db                	neg    %ebx
+  80440d:	53                   	push   %ebx
+  80440e:	51                   	push   %ecx
+  80440f:	52                   	push   %edx
+  804410:	50                   	push   %eax
+  804411:	e8 7e fe ff ff       	call   804294 <__udivdi3>
+  804416:	83 c4 10             	add    $0x10,%esp
+  804419:	eb d4                	jmp    8043ef <__divdi3+0x45>
+
+0080441b <__moddi3>:
+  80441b:	57                   	push   %edi
+  80441c:	56                   	push   %esi
+  80441d:	53                   	push   %ebx
+  80441e:	83 ec 08             	sub    $0x8,%esp
+  804421:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804425:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804429:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80442d:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804431:	57                   	push   %edi
+  804432:	56                   	push   %esi
+  804433:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804437:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80443b:	52                   	push   %edx
+  80443c:	50                   	push   %eax
+  80443d:	e8 68 ff ff ff       	call   8043aa <__divdi3>
+  804442:	89 c3                	mov    %eax,%ebx
+  804444:	0f af d6             	imul   %esi,%edx
+  804447:	89 f9                	mov    %edi,%ecx
+  804449:	0f af cb             	imul   %ebx,%ecx
+  80444c:	01 d1                	add    %edx,%ecx
+  80444e:	89 d8                	mov    %ebx,%eax
+  804450:	f7 e6                	mul    %esi
+  804452:	89 c6                	mov    %eax,%esi
+  804454:	89 d7                	mov    %edx,%edi
+  804456:	01 cf                	add    %ecx,%edi
+  804458:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80445c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804460:	29 f0                	sub    %esi,%eax
+  804462:	19 fa                	sbb    %edi,%edx
+  804464:	83 c4 18             	add    $0x18,%esp
+  804467:	5b                   	pop    %ebx
+  804468:	5e                   	pop    %esi
+  804469:	5f                   	pop    %edi
+  80446a:	c3                   	ret
@@ -0,0 +1,7865 @@
+
+obj/user/idle.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1b 00 00 00       	call   80004c <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 08             	sub    $0x8,%esp
+	binaryname = "idle";
+  80003b:	c7 05 00 40 80 00 a0 	movl   $0x803aa0,0x804000
+  800042:	3a 80 00 
+	// Instead of busy-waiting like this,
+	// a better way would be to use the processor's HLT instruction
+	// to cause the processor to stop executing until the next interrupt -
+	// doing so allows the processor to conserve power more effectively.
+	while (1) {
+		sys_yield();
+  800045:	e8 46 01 00 00       	call   800190 <sys_yield>
+	while (1) {
+  80004a:	eb f9                	jmp    800045 <umain+0x10>
+
+0080004c <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004c:	55                   	push   %ebp
+  80004d:	89 e5                	mov    %esp,%ebp
+  80004f:	56                   	push   %esi
+  800050:	53                   	push   %ebx
+  800051:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800054:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800057:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800059:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80005e:	29 d0                	sub    %edx,%eax
+  800060:	89 c2                	mov    %eax,%edx
+  800062:	c1 ea 0f             	shr    $0xf,%edx
+  800065:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800072:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800079:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80007d:	e8 ef 00 00 00       	call   800171 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800082:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800087:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80008d:	89 e1                	mov    %esp,%ecx
+  80008f:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800094:	29 ca                	sub    %ecx,%edx
+  800096:	89 d1                	mov    %edx,%ecx
+  800098:	c1 e9 0f             	shr    $0xf,%ecx
+  80009b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8000a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a6:	0f 42 d1             	cmovb  %ecx,%edx
+  8000a9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ae:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000b5:	85 db                	test   %ebx,%ebx
+  8000b7:	7e 07                	jle    8000c0 <libmain+0x74>
+		binaryname = argv[0];
+  8000b9:	8b 06                	mov    (%esi),%eax
+  8000bb:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000c0:	83 ec 08             	sub    $0x8,%esp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	e8 6b ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000ca:	e8 0a 00 00 00       	call   8000d9 <exit>
+}
+  8000cf:	83 c4 10             	add    $0x10,%esp
+  8000d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d5:	5b                   	pop    %ebx
+  8000d6:	5e                   	pop    %esi
+  8000d7:	5d                   	pop    %ebp
+  8000d8:	c3                   	ret
+
+008000d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000d9:	55                   	push   %ebp
+  8000da:	89 e5                	mov    %esp,%ebp
+  8000dc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000df:	e8 17 07 00 00       	call   8007fb <close_all>
+	sys_env_destroy(0);
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	6a 00                	push   $0x0
+  8000e9:	e8 42 00 00 00       	call   800130 <sys_env_destroy>
+}
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	c9                   	leave
+  8000f2:	c3                   	ret
+
+008000f3 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000f3:	55                   	push   %ebp
+  8000f4:	89 e5                	mov    %esp,%ebp
+  8000f6:	57                   	push   %edi
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800104:	89 c3                	mov    %eax,%ebx
+  800106:	89 c7                	mov    %eax,%edi
+  800108:	89 c6                	mov    %eax,%esi
+  80010a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	57                   	push   %edi
+  800115:	56                   	push   %esi
+  800116:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800117:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800121:	89 d1                	mov    %edx,%ecx
+  800123:	89 d3                	mov    %edx,%ebx
+  800125:	89 d7                	mov    %edx,%edi
+  800127:	89 d6                	mov    %edx,%esi
+  800129:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80012b:	5b                   	pop    %ebx
+  80012c:	5e                   	pop    %esi
+  80012d:	5f                   	pop    %edi
+  80012e:	5d                   	pop    %ebp
+  80012f:	c3                   	ret
+
+00800130 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800130:	55                   	push   %ebp
+  800131:	89 e5                	mov    %esp,%ebp
+  800133:	57                   	push   %edi
+  800134:	56                   	push   %esi
+  800135:	53                   	push   %ebx
+  800136:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800139:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80013e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800141:	b8 03 00 00 00       	mov    $0x3,%eax
+  800146:	89 cb                	mov    %ecx,%ebx
+  800148:	89 cf                	mov    %ecx,%edi
+  80014a:	89 ce                	mov    %ecx,%esi
+  80014c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80014e:	85 c0                	test   %eax,%eax
+  800150:	7f 08                	jg     80015a <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800152:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800155:	5b                   	pop    %ebx
+  800156:	5e                   	pop    %esi
+  800157:	5f                   	pop    %edi
+  800158:	5d                   	pop    %ebp
+  800159:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80015a:	83 ec 0c             	sub    $0xc,%esp
+  80015d:	50                   	push   %eax
+  80015e:	6a 03                	push   $0x3
+  800160:	68 af 3a 80 00       	push   $0x803aaf
+  800165:	6a 23                	push   $0x23
+  800167:	68 cc 3a 80 00       	push   $0x803acc
+  80016c:	e8 79 28 00 00       	call   8029ea <_panic>
+
+00800171 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	57                   	push   %edi
+  800175:	56                   	push   %esi
+  800176:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800181:	89 d1                	mov    %edx,%ecx
+  800183:	89 d3                	mov    %edx,%ebx
+  800185:	89 d7                	mov    %edx,%edi
+  800187:	89 d6                	mov    %edx,%esi
+  800189:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80018b:	5b                   	pop    %ebx
+  80018c:	5e                   	pop    %esi
+  80018d:	5f                   	pop    %edi
+  80018e:	5d                   	pop    %ebp
+  80018f:	c3                   	ret
+
+00800190 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	57                   	push   %edi
+  800194:	56                   	push   %esi
+  800195:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800196:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001a0:	89 d1                	mov    %edx,%ecx
+  8001a2:	89 d3                	mov    %edx,%ebx
+  8001a4:	89 d7                	mov    %edx,%edi
+  8001a6:	89 d6                	mov    %edx,%esi
+  8001a8:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001aa:	5b                   	pop    %ebx
+  8001ab:	5e                   	pop    %esi
+  8001ac:	5f                   	pop    %edi
+  8001ad:	5d                   	pop    %ebp
+  8001ae:	c3                   	ret
+
+008001af <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	57                   	push   %edi
+  8001b3:	56                   	push   %esi
+  8001b4:	53                   	push   %ebx
+  8001b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001cb:	89 f7                	mov    %esi,%edi
+  8001cd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001cf:	85 c0                	test   %eax,%eax
+  8001d1:	7f 08                	jg     8001db <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d6:	5b                   	pop    %ebx
+  8001d7:	5e                   	pop    %esi
+  8001d8:	5f                   	pop    %edi
+  8001d9:	5d                   	pop    %ebp
+  8001da:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001db:	83 ec 0c             	sub    $0xc,%esp
+  8001de:	50                   	push   %eax
+  8001df:	6a 04                	push   $0x4
+  8001e1:	68 af 3a 80 00       	push   $0x803aaf
+  8001e6:	6a 23                	push   $0x23
+  8001e8:	68 cc 3a 80 00       	push   $0x803acc
+  8001ed:	e8 f8 27 00 00       	call   8029ea <_panic>
+
+008001f2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001f2:	55                   	push   %ebp
+  8001f3:	89 e5                	mov    %esp,%ebp
+  8001f5:	57                   	push   %edi
+  8001f6:	56                   	push   %esi
+  8001f7:	53                   	push   %ebx
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800201:	b8 05 00 00 00       	mov    $0x5,%eax
+  800206:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800209:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80020c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80020f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800211:	85 c0                	test   %eax,%eax
+  800213:	7f 08                	jg     80021d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800218:	5b                   	pop    %ebx
+  800219:	5e                   	pop    %esi
+  80021a:	5f                   	pop    %edi
+  80021b:	5d                   	pop    %ebp
+  80021c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80021d:	83 ec 0c             	sub    $0xc,%esp
+  800220:	50                   	push   %eax
+  800221:	6a 05                	push   $0x5
+  800223:	68 af 3a 80 00       	push   $0x803aaf
+  800228:	6a 23                	push   $0x23
+  80022a:	68 cc 3a 80 00       	push   $0x803acc
+  80022f:	e8 b6 27 00 00       	call   8029ea <_panic>
+
+00800234 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	57                   	push   %edi
+  800238:	56                   	push   %esi
+  800239:	53                   	push   %ebx
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80023d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800242:	8b 55 08             	mov    0x8(%ebp),%edx
+  800245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800248:	b8 06 00 00 00       	mov    $0x6,%eax
+  80024d:	89 df                	mov    %ebx,%edi
+  80024f:	89 de                	mov    %ebx,%esi
+  800251:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800253:	85 c0                	test   %eax,%eax
+  800255:	7f 08                	jg     80025f <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025a:	5b                   	pop    %ebx
+  80025b:	5e                   	pop    %esi
+  80025c:	5f                   	pop    %edi
+  80025d:	5d                   	pop    %ebp
+  80025e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80025f:	83 ec 0c             	sub    $0xc,%esp
+  800262:	50                   	push   %eax
+  800263:	6a 06                	push   $0x6
+  800265:	68 af 3a 80 00       	push   $0x803aaf
+  80026a:	6a 23                	push   $0x23
+  80026c:	68 cc 3a 80 00       	push   $0x803acc
+  800271:	e8 74 27 00 00       	call   8029ea <_panic>
+
+00800276 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	57                   	push   %edi
+  80027a:	56                   	push   %esi
+  80027b:	53                   	push   %ebx
+  80027c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80027f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800284:	8b 55 08             	mov    0x8(%ebp),%edx
+  800287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80028a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80028f:	89 df                	mov    %ebx,%edi
+  800291:	89 de                	mov    %ebx,%esi
+  800293:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800295:	85 c0                	test   %eax,%eax
+  800297:	7f 08                	jg     8002a1 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80029c:	5b                   	pop    %ebx
+  80029d:	5e                   	pop    %esi
+  80029e:	5f                   	pop    %edi
+  80029f:	5d                   	pop    %ebp
+  8002a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	50                   	push   %eax
+  8002a5:	6a 08                	push   $0x8
+  8002a7:	68 af 3a 80 00       	push   $0x803aaf
+  8002ac:	6a 23                	push   $0x23
+  8002ae:	68 cc 3a 80 00       	push   $0x803acc
+  8002b3:	e8 32 27 00 00       	call   8029ea <_panic>
+
+008002b8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	57                   	push   %edi
+  8002bc:	56                   	push   %esi
+  8002bd:	53                   	push   %ebx
+  8002be:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002cc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002d1:	89 df                	mov    %ebx,%edi
+  8002d3:	89 de                	mov    %ebx,%esi
+  8002d5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002d7:	85 c0                	test   %eax,%eax
+  8002d9:	7f 08                	jg     8002e3 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002de:	5b                   	pop    %ebx
+  8002df:	5e                   	pop    %esi
+  8002e0:	5f                   	pop    %edi
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002e3:	83 ec 0c             	sub    $0xc,%esp
+  8002e6:	50                   	push   %eax
+  8002e7:	6a 09                	push   $0x9
+  8002e9:	68 af 3a 80 00       	push   $0x803aaf
+  8002ee:	6a 23                	push   $0x23
+  8002f0:	68 cc 3a 80 00       	push   $0x803acc
+  8002f5:	e8 f0 26 00 00       	call   8029ea <_panic>
+
+008002fa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002fa:	55                   	push   %ebp
+  8002fb:	89 e5                	mov    %esp,%ebp
+  8002fd:	57                   	push   %edi
+  8002fe:	56                   	push   %esi
+  8002ff:	53                   	push   %ebx
+  800300:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800308:	8b 55 08             	mov    0x8(%ebp),%edx
+  80030b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800313:	89 df                	mov    %ebx,%edi
+  800315:	89 de                	mov    %ebx,%esi
+  800317:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800319:	85 c0                	test   %eax,%eax
+  80031b:	7f 08                	jg     800325 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80031d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800320:	5b                   	pop    %ebx
+  800321:	5e                   	pop    %esi
+  800322:	5f                   	pop    %edi
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800325:	83 ec 0c             	sub    $0xc,%esp
+  800328:	50                   	push   %eax
+  800329:	6a 0a                	push   $0xa
+  80032b:	68 af 3a 80 00       	push   $0x803aaf
+  800330:	6a 23                	push   $0x23
+  800332:	68 cc 3a 80 00       	push   $0x803acc
+  800337:	e8 ae 26 00 00       	call   8029ea <_panic>
+
+0080033c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80033c:	55                   	push   %ebp
+  80033d:	89 e5                	mov    %esp,%ebp
+  80033f:	57                   	push   %edi
+  800340:	56                   	push   %esi
+  800341:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800342:	8b 55 08             	mov    0x8(%ebp),%edx
+  800345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800348:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80034d:	be 00 00 00 00       	mov    $0x0,%esi
+  800352:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800355:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800358:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80035a:	5b                   	pop    %ebx
+  80035b:	5e                   	pop    %esi
+  80035c:	5f                   	pop    %edi
+  80035d:	5d                   	pop    %ebp
+  80035e:	c3                   	ret
+
+0080035f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80035f:	55                   	push   %ebp
+  800360:	89 e5                	mov    %esp,%ebp
+  800362:	57                   	push   %edi
+  800363:	56                   	push   %esi
+  800364:	53                   	push   %ebx
+  800365:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800368:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80036d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800370:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800375:	89 cb                	mov    %ecx,%ebx
+  800377:	89 cf                	mov    %ecx,%edi
+  800379:	89 ce                	mov    %ecx,%esi
+  80037b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80037d:	85 c0                	test   %eax,%eax
+  80037f:	7f 08                	jg     800389 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800384:	5b                   	pop    %ebx
+  800385:	5e                   	pop    %esi
+  800386:	5f                   	pop    %edi
+  800387:	5d                   	pop    %ebp
+  800388:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800389:	83 ec 0c             	sub    $0xc,%esp
+  80038c:	50                   	push   %eax
+  80038d:	6a 0d                	push   $0xd
+  80038f:	68 af 3a 80 00       	push   $0x803aaf
+  800394:	6a 23                	push   $0x23
+  800396:	68 cc 3a 80 00       	push   $0x803acc
+  80039b:	e8 4a 26 00 00       	call   8029ea <_panic>
+
+008003a0 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8003a0:	55                   	push   %ebp
+  8003a1:	89 e5                	mov    %esp,%ebp
+  8003a3:	57                   	push   %edi
+  8003a4:	56                   	push   %esi
+  8003a5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003ba:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003bc:	5b                   	pop    %ebx
+  8003bd:	5e                   	pop    %esi
+  8003be:	5f                   	pop    %edi
+  8003bf:	5d                   	pop    %ebp
+  8003c0:	c3                   	ret
+
+008003c1 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003c1:	55                   	push   %ebp
+  8003c2:	89 e5                	mov    %esp,%ebp
+  8003c4:	57                   	push   %edi
+  8003c5:	56                   	push   %esi
+  8003c6:	53                   	push   %ebx
+  8003c7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003da:	89 df                	mov    %ebx,%edi
+  8003dc:	89 de                	mov    %ebx,%esi
+  8003de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003e0:	85 c0                	test   %eax,%eax
+  8003e2:	7f 08                	jg     8003ec <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e7:	5b                   	pop    %ebx
+  8003e8:	5e                   	pop    %esi
+  8003e9:	5f                   	pop    %edi
+  8003ea:	5d                   	pop    %ebp
+  8003eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003ec:	83 ec 0c             	sub    $0xc,%esp
+  8003ef:	50                   	push   %eax
+  8003f0:	6a 0d                	push   $0xd
+  8003f2:	68 af 3a 80 00       	push   $0x803aaf
+  8003f7:	6a 23                	push   $0x23
+  8003f9:	68 cc 3a 80 00       	push   $0x803acc
+  8003fe:	e8 e7 25 00 00       	call   8029ea <_panic>
+
+00800403 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800403:	55                   	push   %ebp
+  800404:	89 e5                	mov    %esp,%ebp
+  800406:	57                   	push   %edi
+  800407:	56                   	push   %esi
+  800408:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800413:	89 d1                	mov    %edx,%ecx
+  800415:	89 d3                	mov    %edx,%ebx
+  800417:	89 d7                	mov    %edx,%edi
+  800419:	89 d6                	mov    %edx,%esi
+  80041b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80041d:	5b                   	pop    %ebx
+  80041e:	5e                   	pop    %esi
+  80041f:	5f                   	pop    %edi
+  800420:	5d                   	pop    %ebp
+  800421:	c3                   	ret
+
+00800422 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800422:	55                   	push   %ebp
+  800423:	89 e5                	mov    %esp,%ebp
+  800425:	57                   	push   %edi
+  800426:	56                   	push   %esi
+  800427:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80042d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800433:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800438:	89 df                	mov    %ebx,%edi
+  80043a:	89 de                	mov    %ebx,%esi
+  80043c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80043e:	5b                   	pop    %ebx
+  80043f:	5e                   	pop    %esi
+  800440:	5f                   	pop    %edi
+  800441:	5d                   	pop    %ebp
+  800442:	c3                   	ret
+
+00800443 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	57                   	push   %edi
+  800447:	56                   	push   %esi
+  800448:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800449:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80044e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800451:	b8 10 00 00 00       	mov    $0x10,%eax
+  800456:	89 cb                	mov    %ecx,%ebx
+  800458:	89 cf                	mov    %ecx,%edi
+  80045a:	89 ce                	mov    %ecx,%esi
+  80045c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80045e:	5b                   	pop    %ebx
+  80045f:	5e                   	pop    %esi
+  800460:	5f                   	pop    %edi
+  800461:	5d                   	pop    %ebp
+  800462:	c3                   	ret
+
+00800463 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800463:	55                   	push   %ebp
+  800464:	89 e5                	mov    %esp,%ebp
+  800466:	57                   	push   %edi
+  800467:	56                   	push   %esi
+  800468:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800469:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80046e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800471:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800474:	b8 11 00 00 00       	mov    $0x11,%eax
+  800479:	89 df                	mov    %ebx,%edi
+  80047b:	89 de                	mov    %ebx,%esi
+  80047d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80047f:	5b                   	pop    %ebx
+  800480:	5e                   	pop    %esi
+  800481:	5f                   	pop    %edi
+  800482:	5d                   	pop    %ebp
+  800483:	c3                   	ret
+
+00800484 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800484:	55                   	push   %ebp
+  800485:	89 e5                	mov    %esp,%ebp
+  800487:	57                   	push   %edi
+  800488:	56                   	push   %esi
+  800489:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80048a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80048f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800492:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800495:	b8 12 00 00 00       	mov    $0x12,%eax
+  80049a:	89 df                	mov    %ebx,%edi
+  80049c:	89 de                	mov    %ebx,%esi
+  80049e:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8004a0:	5b                   	pop    %ebx
+  8004a1:	5e                   	pop    %esi
+  8004a2:	5f                   	pop    %edi
+  8004a3:	5d                   	pop    %ebp
+  8004a4:	c3                   	ret
+
+008004a5 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8004a5:	55                   	push   %ebp
+  8004a6:	89 e5                	mov    %esp,%ebp
+  8004a8:	57                   	push   %edi
+  8004a9:	56                   	push   %esi
+  8004aa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004b8:	89 cb                	mov    %ecx,%ebx
+  8004ba:	89 cf                	mov    %ecx,%edi
+  8004bc:	89 ce                	mov    %ecx,%esi
+  8004be:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004c0:	5b                   	pop    %ebx
+  8004c1:	5e                   	pop    %esi
+  8004c2:	5f                   	pop    %edi
+  8004c3:	5d                   	pop    %ebp
+  8004c4:	c3                   	ret
+
+008004c5 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004c5:	55                   	push   %ebp
+  8004c6:	89 e5                	mov    %esp,%ebp
+  8004c8:	57                   	push   %edi
+  8004c9:	56                   	push   %esi
+  8004ca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004db:	89 df                	mov    %ebx,%edi
+  8004dd:	89 de                	mov    %ebx,%esi
+  8004df:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004e1:	5b                   	pop    %ebx
+  8004e2:	5e                   	pop    %esi
+  8004e3:	5f                   	pop    %edi
+  8004e4:	5d                   	pop    %ebp
+  8004e5:	c3                   	ret
+
+008004e6 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004e6:	55                   	push   %ebp
+  8004e7:	89 e5                	mov    %esp,%ebp
+  8004e9:	57                   	push   %edi
+  8004ea:	56                   	push   %esi
+  8004eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8004f9:	89 cb                	mov    %ecx,%ebx
+  8004fb:	89 cf                	mov    %ecx,%edi
+  8004fd:	89 ce                	mov    %ecx,%esi
+  8004ff:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  800501:	5b                   	pop    %ebx
+  800502:	5e                   	pop    %esi
+  800503:	5f                   	pop    %edi
+  800504:	5d                   	pop    %ebp
+  800505:	c3                   	ret
+
+00800506 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	57                   	push   %edi
+  80050a:	56                   	push   %esi
+  80050b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80050c:	be 00 00 00 00       	mov    $0x0,%esi
+  800511:	8b 55 08             	mov    0x8(%ebp),%edx
+  800514:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800517:	b8 16 00 00 00       	mov    $0x16,%eax
+  80051c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80051f:	89 f7                	mov    %esi,%edi
+  800521:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  800523:	5b                   	pop    %ebx
+  800524:	5e                   	pop    %esi
+  800525:	5f                   	pop    %edi
+  800526:	5d                   	pop    %ebp
+  800527:	c3                   	ret
+
+00800528 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800528:	55                   	push   %ebp
+  800529:	89 e5                	mov    %esp,%ebp
+  80052b:	57                   	push   %edi
+  80052c:	56                   	push   %esi
+  80052d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80052e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800533:	8b 55 08             	mov    0x8(%ebp),%edx
+  800536:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800539:	b8 17 00 00 00       	mov    $0x17,%eax
+  80053e:	89 df                	mov    %ebx,%edi
+  800540:	89 de                	mov    %ebx,%esi
+  800542:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  800544:	5b                   	pop    %ebx
+  800545:	5e                   	pop    %esi
+  800546:	5f                   	pop    %edi
+  800547:	5d                   	pop    %ebp
+  800548:	c3                   	ret
+
+00800549 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800549:	55                   	push   %ebp
+  80054a:	89 e5                	mov    %esp,%ebp
+  80054c:	57                   	push   %edi
+  80054d:	56                   	push   %esi
+  80054e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80054f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800554:	8b 55 08             	mov    0x8(%ebp),%edx
+  800557:	b8 18 00 00 00       	mov    $0x18,%eax
+  80055c:	89 cb                	mov    %ecx,%ebx
+  80055e:	89 cf                	mov    %ecx,%edi
+  800560:	89 ce                	mov    %ecx,%esi
+  800562:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  800564:	5b                   	pop    %ebx
+  800565:	5e                   	pop    %esi
+  800566:	5f                   	pop    %edi
+  800567:	5d                   	pop    %ebp
+  800568:	c3                   	ret
+
+00800569 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800569:	55                   	push   %ebp
+  80056a:	89 e5                	mov    %esp,%ebp
+  80056c:	57                   	push   %edi
+  80056d:	56                   	push   %esi
+  80056e:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80056f:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  800573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800578:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80057b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800580:	89 df                	mov    %ebx,%edi
+  800582:	89 de                	mov    %ebx,%esi
+  800584:	cd 30                	int    $0x30
+}
+  800586:	5b                   	pop    %ebx
+  800587:	5e                   	pop    %esi
+  800588:	5f                   	pop    %edi
+  800589:	5d                   	pop    %ebp
+  80058a:	c3                   	ret
+
+0080058b <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80058b:	55                   	push   %ebp
+  80058c:	89 e5                	mov    %esp,%ebp
+  80058e:	57                   	push   %edi
+  80058f:	56                   	push   %esi
+  800590:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800591:	be 00 00 00 00       	mov    $0x0,%esi
+  800596:	8b 55 08             	mov    0x8(%ebp),%edx
+  800599:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80059c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005a4:	89 f7                	mov    %esi,%edi
+  8005a6:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8005a8:	5b                   	pop    %ebx
+  8005a9:	5e                   	pop    %esi
+  8005aa:	5f                   	pop    %edi
+  8005ab:	5d                   	pop    %ebp
+  8005ac:	c3                   	ret
+
+008005ad <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8005ad:	55                   	push   %ebp
+  8005ae:	89 e5                	mov    %esp,%ebp
+  8005b0:	57                   	push   %edi
+  8005b1:	56                   	push   %esi
+  8005b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005c6:	89 f7                	mov    %esi,%edi
+  8005c8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005ca:	5b                   	pop    %ebx
+  8005cb:	5e                   	pop    %esi
+  8005cc:	5f                   	pop    %edi
+  8005cd:	5d                   	pop    %ebp
+  8005ce:	c3                   	ret
+
+008005cf <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005cf:	55                   	push   %ebp
+  8005d0:	89 e5                	mov    %esp,%ebp
+  8005d2:	57                   	push   %edi
+  8005d3:	56                   	push   %esi
+  8005d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005e5:	89 df                	mov    %ebx,%edi
+  8005e7:	89 de                	mov    %ebx,%esi
+  8005e9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005eb:	5b                   	pop    %ebx
+  8005ec:	5e                   	pop    %esi
+  8005ed:	5f                   	pop    %edi
+  8005ee:	5d                   	pop    %ebp
+  8005ef:	c3                   	ret
+
+008005f0 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005f0:	55                   	push   %ebp
+  8005f1:	89 e5                	mov    %esp,%ebp
+  8005f3:	57                   	push   %edi
+  8005f4:	56                   	push   %esi
+  8005f5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800601:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800606:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800609:	89 f7                	mov    %esi,%edi
+  80060b:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80060d:	5b                   	pop    %ebx
+  80060e:	5e                   	pop    %esi
+  80060f:	5f                   	pop    %edi
+  800610:	5d                   	pop    %ebp
+  800611:	c3                   	ret
+
+00800612 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800612:	55                   	push   %ebp
+  800613:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800615:	8b 45 08             	mov    0x8(%ebp),%eax
+  800618:	05 00 00 00 30       	add    $0x30000000,%eax
+  80061d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800620:	5d                   	pop    %ebp
+  800621:	c3                   	ret
+
+00800622 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800622:	55                   	push   %ebp
+  800623:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800625:	8b 45 08             	mov    0x8(%ebp),%eax
+  800628:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80062d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800632:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800637:	5d                   	pop    %ebp
+  800638:	c3                   	ret
+
+00800639 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800639:	55                   	push   %ebp
+  80063a:	89 e5                	mov    %esp,%ebp
+  80063c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  800641:	89 c2                	mov    %eax,%edx
+  800643:	c1 ea 16             	shr    $0x16,%edx
+  800646:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80064d:	f6 c2 01             	test   $0x1,%dl
+  800650:	74 29                	je     80067b <fd_alloc+0x42>
+  800652:	89 c2                	mov    %eax,%edx
+  800654:	c1 ea 0c             	shr    $0xc,%edx
+  800657:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80065e:	f6 c2 01             	test   $0x1,%dl
+  800661:	74 18                	je     80067b <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800663:	05 00 10 00 00       	add    $0x1000,%eax
+  800668:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80066d:	75 d2                	jne    800641 <fd_alloc+0x8>
+  80066f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800674:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800679:	eb 05                	jmp    800680 <fd_alloc+0x47>
+			return 0;
+  80067b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800680:	8b 55 08             	mov    0x8(%ebp),%edx
+  800683:	89 02                	mov    %eax,(%edx)
+}
+  800685:	89 c8                	mov    %ecx,%eax
+  800687:	5d                   	pop    %ebp
+  800688:	c3                   	ret
+
+00800689 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800689:	55                   	push   %ebp
+  80068a:	89 e5                	mov    %esp,%ebp
+  80068c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80068f:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800694:	77 30                	ja     8006c6 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800696:	c1 e0 0c             	shl    $0xc,%eax
+  800699:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80069e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006a4:	f6 c2 01             	test   $0x1,%dl
+  8006a7:	74 24                	je     8006cd <fd_lookup+0x44>
+  8006a9:	89 c2                	mov    %eax,%edx
+  8006ab:	c1 ea 0c             	shr    $0xc,%edx
+  8006ae:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006b5:	f6 c2 01             	test   $0x1,%dl
+  8006b8:	74 1a                	je     8006d4 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006bd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006c4:	5d                   	pop    %ebp
+  8006c5:	c3                   	ret
+		return -E_INVAL;
+  8006c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006cb:	eb f7                	jmp    8006c4 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d2:	eb f0                	jmp    8006c4 <fd_lookup+0x3b>
+  8006d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d9:	eb e9                	jmp    8006c4 <fd_lookup+0x3b>
+
+008006db <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006db:	55                   	push   %ebp
+  8006dc:	89 e5                	mov    %esp,%ebp
+  8006de:	53                   	push   %ebx
+  8006df:	83 ec 04             	sub    $0x4,%esp
+  8006e2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ea:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8006ef:	39 13                	cmp    %edx,(%ebx)
+  8006f1:	74 54                	je     800747 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8006f3:	83 c0 01             	add    $0x1,%eax
+  8006f6:	8b 1c 85 58 3b 80 00 	mov    0x803b58(,%eax,4),%ebx
+  8006fd:	85 db                	test   %ebx,%ebx
+  8006ff:	75 ee                	jne    8006ef <dev_lookup+0x14>
+  800701:	89 e1                	mov    %esp,%ecx
+  800703:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800708:	29 c8                	sub    %ecx,%eax
+  80070a:	89 c1                	mov    %eax,%ecx
+  80070c:	c1 e9 0f             	shr    $0xf,%ecx
+  80070f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800714:	b8 00 00 00 00       	mov    $0x0,%eax
+  800719:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80071c:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800723:	8b 40 48             	mov    0x48(%eax),%eax
+  800726:	83 ec 04             	sub    $0x4,%esp
+  800729:	52                   	push   %edx
+  80072a:	50                   	push   %eax
+  80072b:	68 dc 3a 80 00       	push   $0x803adc
+  800730:	e8 90 23 00 00       	call   802ac5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80073d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800740:	89 1a                	mov    %ebx,(%edx)
+}
+  800742:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800745:	c9                   	leave
+  800746:	c3                   	ret
+			return 0;
+  800747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074c:	eb ef                	jmp    80073d <dev_lookup+0x62>
+
+0080074e <fd_close>:
+{
+  80074e:	55                   	push   %ebp
+  80074f:	89 e5                	mov    %esp,%ebp
+  800751:	57                   	push   %edi
+  800752:	56                   	push   %esi
+  800753:	53                   	push   %ebx
+  800754:	83 ec 24             	sub    $0x24,%esp
+  800757:	8b 75 08             	mov    0x8(%ebp),%esi
+  80075a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80075d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800760:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800761:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800767:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80076a:	50                   	push   %eax
+  80076b:	e8 19 ff ff ff       	call   800689 <fd_lookup>
+  800770:	89 c3                	mov    %eax,%ebx
+  800772:	83 c4 10             	add    $0x10,%esp
+  800775:	85 c0                	test   %eax,%eax
+  800777:	78 05                	js     80077e <fd_close+0x30>
+	    || fd != fd2)
+  800779:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80077c:	74 0f                	je     80078d <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80077e:	85 ff                	test   %edi,%edi
+  800780:	0f 44 df             	cmove  %edi,%ebx
+}
+  800783:	89 d8                	mov    %ebx,%eax
+  800785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800788:	5b                   	pop    %ebx
+  800789:	5e                   	pop    %esi
+  80078a:	5f                   	pop    %edi
+  80078b:	5d                   	pop    %ebp
+  80078c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80078d:	83 ec 08             	sub    $0x8,%esp
+  800790:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800793:	50                   	push   %eax
+  800794:	ff 36                	push   (%esi)
+  800796:	e8 40 ff ff ff       	call   8006db <dev_lookup>
+  80079b:	89 c3                	mov    %eax,%ebx
+  80079d:	83 c4 10             	add    $0x10,%esp
+  8007a0:	85 c0                	test   %eax,%eax
+  8007a2:	78 1a                	js     8007be <fd_close+0x70>
+		if (dev->dev_close)
+  8007a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8007aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007af:	85 c0                	test   %eax,%eax
+  8007b1:	74 0b                	je     8007be <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8007b3:	83 ec 0c             	sub    $0xc,%esp
+  8007b6:	56                   	push   %esi
+  8007b7:	ff d0                	call   *%eax
+  8007b9:	89 c3                	mov    %eax,%ebx
+  8007bb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	56                   	push   %esi
+  8007c2:	6a 00                	push   $0x0
+  8007c4:	e8 6b fa ff ff       	call   800234 <sys_page_unmap>
+	return r;
+  8007c9:	83 c4 10             	add    $0x10,%esp
+  8007cc:	eb b5                	jmp    800783 <fd_close+0x35>
+
+008007ce <close>:
+
+int
+close(int fdnum)
+{
+  8007ce:	55                   	push   %ebp
+  8007cf:	89 e5                	mov    %esp,%ebp
+  8007d1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	ff 75 08             	push   0x8(%ebp)
+  8007db:	e8 a9 fe ff ff       	call   800689 <fd_lookup>
+  8007e0:	83 c4 10             	add    $0x10,%esp
+  8007e3:	85 c0                	test   %eax,%eax
+  8007e5:	79 02                	jns    8007e9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+		return fd_close(fd, 1);
+  8007e9:	83 ec 08             	sub    $0x8,%esp
+  8007ec:	6a 01                	push   $0x1
+  8007ee:	ff 75 f4             	push   -0xc(%ebp)
+  8007f1:	e8 58 ff ff ff       	call   80074e <fd_close>
+  8007f6:	83 c4 10             	add    $0x10,%esp
+  8007f9:	eb ec                	jmp    8007e7 <close+0x19>
+
+008007fb <close_all>:
+
+void
+close_all(void)
+{
+  8007fb:	55                   	push   %ebp
+  8007fc:	89 e5                	mov    %esp,%ebp
+  8007fe:	53                   	push   %ebx
+  8007ff:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800802:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800807:	83 ec 0c             	sub    $0xc,%esp
+  80080a:	53                   	push   %ebx
+  80080b:	e8 be ff ff ff       	call   8007ce <close>
+	for (i = 0; i < MAXFD; i++)
+  800810:	83 c3 01             	add    $0x1,%ebx
+  800813:	83 c4 10             	add    $0x10,%esp
+  800816:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80081c:	75 e9                	jne    800807 <close_all+0xc>
+}
+  80081e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800821:	c9                   	leave
+  800822:	c3                   	ret
+
+00800823 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800823:	55                   	push   %ebp
+  800824:	89 e5                	mov    %esp,%ebp
+  800826:	57                   	push   %edi
+  800827:	56                   	push   %esi
+  800828:	53                   	push   %ebx
+  800829:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80082c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80082f:	50                   	push   %eax
+  800830:	ff 75 08             	push   0x8(%ebp)
+  800833:	e8 51 fe ff ff       	call   800689 <fd_lookup>
+  800838:	89 c3                	mov    %eax,%ebx
+  80083a:	83 c4 10             	add    $0x10,%esp
+  80083d:	85 c0                	test   %eax,%eax
+  80083f:	78 7f                	js     8008c0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800841:	83 ec 0c             	sub    $0xc,%esp
+  800844:	ff 75 0c             	push   0xc(%ebp)
+  800847:	e8 82 ff ff ff       	call   8007ce <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80084c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80084f:	c1 e6 0c             	shl    $0xc,%esi
+  800852:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800858:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80085b:	89 3c 24             	mov    %edi,(%esp)
+  80085e:	e8 bf fd ff ff       	call   800622 <fd2data>
+  800863:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800865:	89 34 24             	mov    %esi,(%esp)
+  800868:	e8 b5 fd ff ff       	call   800622 <fd2data>
+  80086d:	83 c4 10             	add    $0x10,%esp
+  800870:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  800873:	89 d8                	mov    %ebx,%eax
+  800875:	c1 e8 16             	shr    $0x16,%eax
+  800878:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80087f:	a8 01                	test   $0x1,%al
+  800881:	74 11                	je     800894 <dup+0x71>
+  800883:	89 d8                	mov    %ebx,%eax
+  800885:	c1 e8 0c             	shr    $0xc,%eax
+  800888:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80088f:	f6 c2 01             	test   $0x1,%dl
+  800892:	75 36                	jne    8008ca <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800894:	89 f8                	mov    %edi,%eax
+  800896:	c1 e8 0c             	shr    $0xc,%eax
+  800899:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008a0:	83 ec 0c             	sub    $0xc,%esp
+  8008a3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008a8:	50                   	push   %eax
+  8008a9:	56                   	push   %esi
+  8008aa:	6a 00                	push   $0x0
+  8008ac:	57                   	push   %edi
+  8008ad:	6a 00                	push   $0x0
+  8008af:	e8 3e f9 ff ff       	call   8001f2 <sys_page_map>
+  8008b4:	89 c3                	mov    %eax,%ebx
+  8008b6:	83 c4 20             	add    $0x20,%esp
+  8008b9:	85 c0                	test   %eax,%eax
+  8008bb:	78 33                	js     8008f0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008c0:	89 d8                	mov    %ebx,%eax
+  8008c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c5:	5b                   	pop    %ebx
+  8008c6:	5e                   	pop    %esi
+  8008c7:	5f                   	pop    %edi
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008ca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008d1:	83 ec 0c             	sub    $0xc,%esp
+  8008d4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008d9:	50                   	push   %eax
+  8008da:	ff 75 d4             	push   -0x2c(%ebp)
+  8008dd:	6a 00                	push   $0x0
+  8008df:	53                   	push   %ebx
+  8008e0:	6a 00                	push   $0x0
+  8008e2:	e8 0b f9 ff ff       	call   8001f2 <sys_page_map>
+  8008e7:	89 c3                	mov    %eax,%ebx
+  8008e9:	83 c4 20             	add    $0x20,%esp
+  8008ec:	85 c0                	test   %eax,%eax
+  8008ee:	79 a4                	jns    800894 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	56                   	push   %esi
+  8008f4:	6a 00                	push   $0x0
+  8008f6:	e8 39 f9 ff ff       	call   800234 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008fb:	83 c4 08             	add    $0x8,%esp
+  8008fe:	ff 75 d4             	push   -0x2c(%ebp)
+  800901:	6a 00                	push   $0x0
+  800903:	e8 2c f9 ff ff       	call   800234 <sys_page_unmap>
+	return r;
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	eb b3                	jmp    8008c0 <dup+0x9d>
+
+0080090d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80090d:	55                   	push   %ebp
+  80090e:	89 e5                	mov    %esp,%ebp
+  800910:	56                   	push   %esi
+  800911:	53                   	push   %ebx
+  800912:	83 ec 18             	sub    $0x18,%esp
+  800915:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800918:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80091b:	50                   	push   %eax
+  80091c:	53                   	push   %ebx
+  80091d:	e8 67 fd ff ff       	call   800689 <fd_lookup>
+  800922:	83 c4 10             	add    $0x10,%esp
+  800925:	85 c0                	test   %eax,%eax
+  800927:	78 3c                	js     800965 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800929:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80092c:	83 ec 08             	sub    $0x8,%esp
+  80092f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800932:	50                   	push   %eax
+  800933:	ff 36                	push   (%esi)
+  800935:	e8 a1 fd ff ff       	call   8006db <dev_lookup>
+  80093a:	83 c4 10             	add    $0x10,%esp
+  80093d:	85 c0                	test   %eax,%eax
+  80093f:	78 24                	js     800965 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800941:	8b 46 08             	mov    0x8(%esi),%eax
+  800944:	83 e0 03             	and    $0x3,%eax
+  800947:	83 f8 01             	cmp    $0x1,%eax
+  80094a:	74 20                	je     80096c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80094c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80094f:	8b 40 08             	mov    0x8(%eax),%eax
+  800952:	85 c0                	test   %eax,%eax
+  800954:	74 54                	je     8009aa <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800956:	83 ec 04             	sub    $0x4,%esp
+  800959:	ff 75 10             	push   0x10(%ebp)
+  80095c:	ff 75 0c             	push   0xc(%ebp)
+  80095f:	56                   	push   %esi
+  800960:	ff d0                	call   *%eax
+  800962:	83 c4 10             	add    $0x10,%esp
+}
+  800965:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800968:	5b                   	pop    %ebx
+  800969:	5e                   	pop    %esi
+  80096a:	5d                   	pop    %ebp
+  80096b:	c3                   	ret
+  80096c:	89 e2                	mov    %esp,%edx
+  80096e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800973:	29 d0                	sub    %edx,%eax
+  800975:	89 c2                	mov    %eax,%edx
+  800977:	c1 ea 0f             	shr    $0xf,%edx
+  80097a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80097f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800984:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800987:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80098e:	8b 40 48             	mov    0x48(%eax),%eax
+  800991:	83 ec 04             	sub    $0x4,%esp
+  800994:	53                   	push   %ebx
+  800995:	50                   	push   %eax
+  800996:	68 1d 3b 80 00       	push   $0x803b1d
+  80099b:	e8 25 21 00 00       	call   802ac5 <cprintf>
+		return -E_INVAL;
+  8009a0:	83 c4 10             	add    $0x10,%esp
+  8009a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a8:	eb bb                	jmp    800965 <read+0x58>
+		return -E_NOT_SUPP;
+  8009aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009af:	eb b4                	jmp    800965 <read+0x58>
+
+008009b1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	57                   	push   %edi
+  8009b5:	56                   	push   %esi
+  8009b6:	53                   	push   %ebx
+  8009b7:	83 ec 0c             	sub    $0xc,%esp
+  8009ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009c0:	85 f6                	test   %esi,%esi
+  8009c2:	74 30                	je     8009f4 <readn+0x43>
+  8009c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009c9:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009ce:	83 ec 04             	sub    $0x4,%esp
+  8009d1:	89 f2                	mov    %esi,%edx
+  8009d3:	29 c2                	sub    %eax,%edx
+  8009d5:	52                   	push   %edx
+  8009d6:	01 f8                	add    %edi,%eax
+  8009d8:	50                   	push   %eax
+  8009d9:	ff 75 08             	push   0x8(%ebp)
+  8009dc:	e8 2c ff ff ff       	call   80090d <read>
+		if (m < 0)
+  8009e1:	83 c4 10             	add    $0x10,%esp
+  8009e4:	85 c0                	test   %eax,%eax
+  8009e6:	78 15                	js     8009fd <readn+0x4c>
+			return m;
+		if (m == 0)
+  8009e8:	74 11                	je     8009fb <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8009ea:	01 c3                	add    %eax,%ebx
+  8009ec:	89 d8                	mov    %ebx,%eax
+  8009ee:	39 f3                	cmp    %esi,%ebx
+  8009f0:	72 dc                	jb     8009ce <readn+0x1d>
+  8009f2:	eb 09                	jmp    8009fd <readn+0x4c>
+  8009f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f9:	eb 02                	jmp    8009fd <readn+0x4c>
+  8009fb:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8009fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a00:	5b                   	pop    %ebx
+  800a01:	5e                   	pop    %esi
+  800a02:	5f                   	pop    %edi
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	56                   	push   %esi
+  800a09:	53                   	push   %ebx
+  800a0a:	83 ec 18             	sub    $0x18,%esp
+  800a0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a10:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a13:	50                   	push   %eax
+  800a14:	53                   	push   %ebx
+  800a15:	e8 6f fc ff ff       	call   800689 <fd_lookup>
+  800a1a:	83 c4 10             	add    $0x10,%esp
+  800a1d:	85 c0                	test   %eax,%eax
+  800a1f:	78 37                	js     800a58 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a21:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a24:	83 ec 08             	sub    $0x8,%esp
+  800a27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a2a:	50                   	push   %eax
+  800a2b:	ff 36                	push   (%esi)
+  800a2d:	e8 a9 fc ff ff       	call   8006db <dev_lookup>
+  800a32:	83 c4 10             	add    $0x10,%esp
+  800a35:	85 c0                	test   %eax,%eax
+  800a37:	78 1f                	js     800a58 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a39:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a3d:	74 20                	je     800a5f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a42:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a45:	85 c0                	test   %eax,%eax
+  800a47:	74 54                	je     800a9d <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a49:	83 ec 04             	sub    $0x4,%esp
+  800a4c:	ff 75 10             	push   0x10(%ebp)
+  800a4f:	ff 75 0c             	push   0xc(%ebp)
+  800a52:	56                   	push   %esi
+  800a53:	ff d0                	call   *%eax
+  800a55:	83 c4 10             	add    $0x10,%esp
+}
+  800a58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a5b:	5b                   	pop    %ebx
+  800a5c:	5e                   	pop    %esi
+  800a5d:	5d                   	pop    %ebp
+  800a5e:	c3                   	ret
+  800a5f:	89 e2                	mov    %esp,%edx
+  800a61:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a66:	29 d0                	sub    %edx,%eax
+  800a68:	89 c2                	mov    %eax,%edx
+  800a6a:	c1 ea 0f             	shr    $0xf,%edx
+  800a6d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a77:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a7a:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a81:	8b 40 48             	mov    0x48(%eax),%eax
+  800a84:	83 ec 04             	sub    $0x4,%esp
+  800a87:	53                   	push   %ebx
+  800a88:	50                   	push   %eax
+  800a89:	68 39 3b 80 00       	push   $0x803b39
+  800a8e:	e8 32 20 00 00       	call   802ac5 <cprintf>
+		return -E_INVAL;
+  800a93:	83 c4 10             	add    $0x10,%esp
+  800a96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a9b:	eb bb                	jmp    800a58 <write+0x53>
+		return -E_NOT_SUPP;
+  800a9d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800aa2:	eb b4                	jmp    800a58 <write+0x53>
+
+00800aa4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800aa4:	55                   	push   %ebp
+  800aa5:	89 e5                	mov    %esp,%ebp
+  800aa7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800aaa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aad:	50                   	push   %eax
+  800aae:	ff 75 08             	push   0x8(%ebp)
+  800ab1:	e8 d3 fb ff ff       	call   800689 <fd_lookup>
+  800ab6:	83 c4 10             	add    $0x10,%esp
+  800ab9:	85 c0                	test   %eax,%eax
+  800abb:	78 0e                	js     800acb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800abd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800acb:	c9                   	leave
+  800acc:	c3                   	ret
+
+00800acd <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800acd:	55                   	push   %ebp
+  800ace:	89 e5                	mov    %esp,%ebp
+  800ad0:	53                   	push   %ebx
+  800ad1:	83 ec 1c             	sub    $0x1c,%esp
+  800ad4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ad7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ada:	50                   	push   %eax
+  800adb:	ff 75 08             	push   0x8(%ebp)
+  800ade:	e8 a6 fb ff ff       	call   800689 <fd_lookup>
+  800ae3:	83 c4 10             	add    $0x10,%esp
+  800ae6:	85 c0                	test   %eax,%eax
+  800ae8:	78 33                	js     800b1d <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800aea:	83 fb 03             	cmp    $0x3,%ebx
+  800aed:	74 28                	je     800b17 <fcntl+0x4a>
+  800aef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af4:	83 fb 04             	cmp    $0x4,%ebx
+  800af7:	75 24                	jne    800b1d <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800af9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800afc:	8b 41 08             	mov    0x8(%ecx),%eax
+  800aff:	80 e4 ef             	and    $0xef,%ah
+  800b02:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b05:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800b0b:	09 d0                	or     %edx,%eax
+  800b0d:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b15:	eb 06                	jmp    800b1d <fcntl+0x50>
+		return fd->fd_omode;
+  800b17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1a:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b20:	c9                   	leave
+  800b21:	c3                   	ret
+
+00800b22 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b22:	55                   	push   %ebp
+  800b23:	89 e5                	mov    %esp,%ebp
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  800b27:	83 ec 18             	sub    $0x18,%esp
+  800b2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b2d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b30:	50                   	push   %eax
+  800b31:	53                   	push   %ebx
+  800b32:	e8 52 fb ff ff       	call   800689 <fd_lookup>
+  800b37:	83 c4 10             	add    $0x10,%esp
+  800b3a:	85 c0                	test   %eax,%eax
+  800b3c:	78 34                	js     800b72 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b3e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b41:	83 ec 08             	sub    $0x8,%esp
+  800b44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b47:	50                   	push   %eax
+  800b48:	ff 36                	push   (%esi)
+  800b4a:	e8 8c fb ff ff       	call   8006db <dev_lookup>
+  800b4f:	83 c4 10             	add    $0x10,%esp
+  800b52:	85 c0                	test   %eax,%eax
+  800b54:	78 1c                	js     800b72 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b56:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b5a:	74 1d                	je     800b79 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b5f:	8b 40 18             	mov    0x18(%eax),%eax
+  800b62:	85 c0                	test   %eax,%eax
+  800b64:	74 51                	je     800bb7 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b66:	83 ec 08             	sub    $0x8,%esp
+  800b69:	ff 75 0c             	push   0xc(%ebp)
+  800b6c:	56                   	push   %esi
+  800b6d:	ff d0                	call   *%eax
+  800b6f:	83 c4 10             	add    $0x10,%esp
+}
+  800b72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b75:	5b                   	pop    %ebx
+  800b76:	5e                   	pop    %esi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+  800b79:	89 e2                	mov    %esp,%edx
+  800b7b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b80:	29 d0                	sub    %edx,%eax
+  800b82:	89 c2                	mov    %eax,%edx
+  800b84:	c1 ea 0f             	shr    $0xf,%edx
+  800b87:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800b94:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800b9b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b9e:	83 ec 04             	sub    $0x4,%esp
+  800ba1:	53                   	push   %ebx
+  800ba2:	50                   	push   %eax
+  800ba3:	68 fc 3a 80 00       	push   $0x803afc
+  800ba8:	e8 18 1f 00 00       	call   802ac5 <cprintf>
+		return -E_INVAL;
+  800bad:	83 c4 10             	add    $0x10,%esp
+  800bb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb5:	eb bb                	jmp    800b72 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bb7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bbc:	eb b4                	jmp    800b72 <ftruncate+0x50>
+
+00800bbe <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bbe:	55                   	push   %ebp
+  800bbf:	89 e5                	mov    %esp,%ebp
+  800bc1:	56                   	push   %esi
+  800bc2:	53                   	push   %ebx
+  800bc3:	83 ec 18             	sub    $0x18,%esp
+  800bc6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bc9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bcc:	50                   	push   %eax
+  800bcd:	ff 75 08             	push   0x8(%ebp)
+  800bd0:	e8 b4 fa ff ff       	call   800689 <fd_lookup>
+  800bd5:	83 c4 10             	add    $0x10,%esp
+  800bd8:	85 c0                	test   %eax,%eax
+  800bda:	78 53                	js     800c2f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bdc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bdf:	83 ec 08             	sub    $0x8,%esp
+  800be2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800be5:	50                   	push   %eax
+  800be6:	ff 36                	push   (%esi)
+  800be8:	e8 ee fa ff ff       	call   8006db <dev_lookup>
+  800bed:	83 c4 10             	add    $0x10,%esp
+  800bf0:	85 c0                	test   %eax,%eax
+  800bf2:	78 3b                	js     800c2f <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800bf4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bf7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bfb:	74 39                	je     800c36 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800bfd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c00:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c07:	00 00 00 
+	stat->st_isdir = 0;
+  800c0a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c11:	00 00 00 
+	stat->st_version = 0;
+  800c14:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c1b:	00 00 00 
+	stat->st_dev = dev;
+  800c1e:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c24:	83 ec 08             	sub    $0x8,%esp
+  800c27:	53                   	push   %ebx
+  800c28:	56                   	push   %esi
+  800c29:	ff 50 14             	call   *0x14(%eax)
+  800c2c:	83 c4 10             	add    $0x10,%esp
+}
+  800c2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c32:	5b                   	pop    %ebx
+  800c33:	5e                   	pop    %esi
+  800c34:	5d                   	pop    %ebp
+  800c35:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c36:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c3b:	eb f2                	jmp    800c2f <fstat+0x71>
+
+00800c3d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c3d:	55                   	push   %ebp
+  800c3e:	89 e5                	mov    %esp,%ebp
+  800c40:	56                   	push   %esi
+  800c41:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c42:	83 ec 08             	sub    $0x8,%esp
+  800c45:	6a 00                	push   $0x0
+  800c47:	ff 75 08             	push   0x8(%ebp)
+  800c4a:	e8 b7 01 00 00       	call   800e06 <open>
+  800c4f:	89 c3                	mov    %eax,%ebx
+  800c51:	83 c4 10             	add    $0x10,%esp
+  800c54:	85 c0                	test   %eax,%eax
+  800c56:	78 1b                	js     800c73 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c58:	83 ec 08             	sub    $0x8,%esp
+  800c5b:	ff 75 0c             	push   0xc(%ebp)
+  800c5e:	50                   	push   %eax
+  800c5f:	e8 5a ff ff ff       	call   800bbe <fstat>
+  800c64:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c66:	89 1c 24             	mov    %ebx,(%esp)
+  800c69:	e8 60 fb ff ff       	call   8007ce <close>
+	return r;
+  800c6e:	83 c4 10             	add    $0x10,%esp
+  800c71:	89 f3                	mov    %esi,%ebx
+}
+  800c73:	89 d8                	mov    %ebx,%eax
+  800c75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c78:	5b                   	pop    %ebx
+  800c79:	5e                   	pop    %esi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	56                   	push   %esi
+  800c80:	53                   	push   %ebx
+  800c81:	89 c6                	mov    %eax,%esi
+  800c83:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800c85:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800c8c:	74 27                	je     800cb5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800c8e:	6a 07                	push   $0x7
+  800c90:	68 00 60 80 00       	push   $0x806000
+  800c95:	56                   	push   %esi
+  800c96:	ff 35 00 50 80 00    	push   0x805000
+  800c9c:	e8 23 2b 00 00       	call   8037c4 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800ca1:	83 c4 0c             	add    $0xc,%esp
+  800ca4:	6a 00                	push   $0x0
+  800ca6:	53                   	push   %ebx
+  800ca7:	6a 00                	push   $0x0
+  800ca9:	e8 86 28 00 00       	call   803534 <ipc_recv>
+}
+  800cae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb1:	5b                   	pop    %ebx
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cb5:	83 ec 0c             	sub    $0xc,%esp
+  800cb8:	6a 02                	push   $0x2
+  800cba:	e8 6e 2b 00 00       	call   80382d <ipc_find_env>
+  800cbf:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cc4:	83 c4 10             	add    $0x10,%esp
+  800cc7:	eb c5                	jmp    800c8e <fsipc+0x12>
+
+00800cc9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd2:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cd5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cdd:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cec:	e8 8b ff ff ff       	call   800c7c <fsipc>
+}
+  800cf1:	c9                   	leave
+  800cf2:	c3                   	ret
+
+00800cf3 <devfile_flush>:
+{
+  800cf3:	55                   	push   %ebp
+  800cf4:	89 e5                	mov    %esp,%ebp
+  800cf6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cfc:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cff:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d09:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d0e:	e8 69 ff ff ff       	call   800c7c <fsipc>
+}
+  800d13:	c9                   	leave
+  800d14:	c3                   	ret
+
+00800d15 <devfile_stat>:
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	53                   	push   %ebx
+  800d19:	83 ec 04             	sub    $0x4,%esp
+  800d1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d22:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d25:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d34:	e8 43 ff ff ff       	call   800c7c <fsipc>
+  800d39:	85 c0                	test   %eax,%eax
+  800d3b:	78 37                	js     800d74 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d3d:	83 ec 08             	sub    $0x8,%esp
+  800d40:	68 00 60 80 00       	push   $0x806000
+  800d45:	53                   	push   %ebx
+  800d46:	e8 71 24 00 00       	call   8031bc <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d4b:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d50:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d56:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d5b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d61:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d66:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d6c:	83 c4 10             	add    $0x10,%esp
+  800d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d77:	c9                   	leave
+  800d78:	c3                   	ret
+
+00800d79 <devfile_write>:
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	83 ec 0c             	sub    $0xc,%esp
+  800d7f:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d82:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800d87:	39 d0                	cmp    %edx,%eax
+  800d89:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8f:	8b 52 0c             	mov    0xc(%edx),%edx
+  800d92:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800d98:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800d9d:	50                   	push   %eax
+  800d9e:	ff 75 0c             	push   0xc(%ebp)
+  800da1:	68 08 60 80 00       	push   $0x806008
+  800da6:	e8 c1 25 00 00       	call   80336c <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db5:	e8 c2 fe ff ff       	call   800c7c <fsipc>
+}
+  800dba:	c9                   	leave
+  800dbb:	c3                   	ret
+
+00800dbc <devfile_read>:
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	53                   	push   %ebx
+  800dc0:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dc9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800dce:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dd1:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800dd6:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800ddb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800de0:	e8 97 fe ff ff       	call   800c7c <fsipc>
+  800de5:	89 c3                	mov    %eax,%ebx
+  800de7:	85 c0                	test   %eax,%eax
+  800de9:	78 14                	js     800dff <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800deb:	83 ec 04             	sub    $0x4,%esp
+  800dee:	50                   	push   %eax
+  800def:	68 00 60 80 00       	push   $0x806000
+  800df4:	ff 75 0c             	push   0xc(%ebp)
+  800df7:	e8 70 25 00 00       	call   80336c <memmove>
+	return r;
+  800dfc:	83 c4 10             	add    $0x10,%esp
+}
+  800dff:	89 d8                	mov    %ebx,%eax
+  800e01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e04:	c9                   	leave
+  800e05:	c3                   	ret
+
+00800e06 <open>:
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	53                   	push   %ebx
+  800e0a:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800e0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e10:	50                   	push   %eax
+  800e11:	e8 23 f8 ff ff       	call   800639 <fd_alloc>
+  800e16:	89 c3                	mov    %eax,%ebx
+  800e18:	83 c4 10             	add    $0x10,%esp
+  800e1b:	85 c0                	test   %eax,%eax
+  800e1d:	78 2a                	js     800e49 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e1f:	83 ec 0c             	sub    $0xc,%esp
+  800e22:	ff 75 08             	push   0x8(%ebp)
+  800e25:	e8 46 23 00 00       	call   803170 <strlen>
+  800e2a:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e2d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e32:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e37:	7e 17                	jle    800e50 <open+0x4a>
+	fd_close(fd, 1);
+  800e39:	83 ec 08             	sub    $0x8,%esp
+  800e3c:	6a 01                	push   $0x1
+  800e3e:	ff 75 f4             	push   -0xc(%ebp)
+  800e41:	e8 08 f9 ff ff       	call   80074e <fd_close>
+	return r;
+  800e46:	83 c4 10             	add    $0x10,%esp
+}
+  800e49:	89 d8                	mov    %ebx,%eax
+  800e4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e4e:	c9                   	leave
+  800e4f:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e50:	83 ec 08             	sub    $0x8,%esp
+  800e53:	ff 75 08             	push   0x8(%ebp)
+  800e56:	68 00 60 80 00       	push   $0x806000
+  800e5b:	e8 5c 23 00 00       	call   8031bc <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e63:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e68:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e70:	e8 07 fe ff ff       	call   800c7c <fsipc>
+  800e75:	89 c3                	mov    %eax,%ebx
+  800e77:	83 c4 10             	add    $0x10,%esp
+  800e7a:	85 c0                	test   %eax,%eax
+  800e7c:	78 bb                	js     800e39 <open+0x33>
+	return fd2num(fd); 	
+  800e7e:	83 ec 0c             	sub    $0xc,%esp
+  800e81:	ff 75 f4             	push   -0xc(%ebp)
+  800e84:	e8 89 f7 ff ff       	call   800612 <fd2num>
+  800e89:	89 c3                	mov    %eax,%ebx
+  800e8b:	83 c4 10             	add    $0x10,%esp
+  800e8e:	eb b9                	jmp    800e49 <open+0x43>
+
+00800e90 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	53                   	push   %ebx
+  800e94:	83 ec 1c             	sub    $0x1c,%esp
+  800e97:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e9d:	50                   	push   %eax
+  800e9e:	ff 75 08             	push   0x8(%ebp)
+  800ea1:	e8 e3 f7 ff ff       	call   800689 <fd_lookup>
+  800ea6:	83 c4 10             	add    $0x10,%esp
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	78 5a                	js     800f07 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800ead:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb0:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800eb6:	39 10                	cmp    %edx,(%eax)
+  800eb8:	75 66                	jne    800f20 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800eba:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800ec1:	74 49                	je     800f0c <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800ec3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ec6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ec9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800ece:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ed1:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800ed6:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800edc:	6a 07                	push   $0x7
+  800ede:	68 00 60 80 00       	push   $0x806000
+  800ee3:	6a 09                	push   $0x9
+  800ee5:	ff 35 00 50 80 00    	push   0x805000
+  800eeb:	e8 d4 28 00 00       	call   8037c4 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800ef0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800ef7:	6a 00                	push   $0x0
+  800ef9:	53                   	push   %ebx
+  800efa:	ff 75 10             	push   0x10(%ebp)
+  800efd:	6a 00                	push   $0x0
+  800eff:	e8 fd 26 00 00       	call   803601 <ipc_recv_pages>
+  800f04:	83 c4 20             	add    $0x20,%esp
+}
+  800f07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f0a:	c9                   	leave
+  800f0b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f0c:	83 ec 0c             	sub    $0xc,%esp
+  800f0f:	6a 02                	push   $0x2
+  800f11:	e8 17 29 00 00       	call   80382d <ipc_find_env>
+  800f16:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f1b:	83 c4 10             	add    $0x10,%esp
+  800f1e:	eb a3                	jmp    800ec3 <fmap+0x33>
+		return -E_INVAL;
+  800f20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f25:	eb e0                	jmp    800f07 <fmap+0x77>
+
+00800f27 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	53                   	push   %ebx
+  800f2b:	83 ec 10             	sub    $0x10,%esp
+  800f2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f31:	53                   	push   %ebx
+  800f32:	e8 39 22 00 00       	call   803170 <strlen>
+  800f37:	83 c4 10             	add    $0x10,%esp
+  800f3a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f3f:	7f 25                	jg     800f66 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f41:	83 ec 08             	sub    $0x8,%esp
+  800f44:	53                   	push   %ebx
+  800f45:	68 00 60 80 00       	push   $0x806000
+  800f4a:	e8 6d 22 00 00       	call   8031bc <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f54:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f59:	e8 1e fd ff ff       	call   800c7c <fsipc>
+  800f5e:	83 c4 10             	add    $0x10,%esp
+}
+  800f61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f64:	c9                   	leave
+  800f65:	c3                   	ret
+		return -E_BAD_PATH;
+  800f66:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f6b:	eb f4                	jmp    800f61 <remove+0x3a>
+
+00800f6d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f78:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f7d:	e8 fa fc ff ff       	call   800c7c <fsipc>
+}
+  800f82:	c9                   	leave
+  800f83:	c3                   	ret
+
+00800f84 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800f8a:	68 6c 3b 80 00       	push   $0x803b6c
+  800f8f:	ff 75 0c             	push   0xc(%ebp)
+  800f92:	e8 25 22 00 00       	call   8031bc <strcpy>
+	return 0;
+}
+  800f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9c:	c9                   	leave
+  800f9d:	c3                   	ret
+
+00800f9e <devsock_close>:
+{
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	53                   	push   %ebx
+  800fa2:	83 ec 10             	sub    $0x10,%esp
+  800fa5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800fa8:	53                   	push   %ebx
+  800fa9:	e8 be 28 00 00       	call   80386c <pageref>
+  800fae:	89 c2                	mov    %eax,%edx
+  800fb0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fb8:	83 fa 01             	cmp    $0x1,%edx
+  800fbb:	74 05                	je     800fc2 <devsock_close+0x24>
+}
+  800fbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fc0:	c9                   	leave
+  800fc1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+  800fc5:	ff 73 0c             	push   0xc(%ebx)
+  800fc8:	e8 b0 05 00 00       	call   80157d <nsipc_close>
+  800fcd:	83 c4 10             	add    $0x10,%esp
+  800fd0:	eb eb                	jmp    800fbd <devsock_close+0x1f>
+
+00800fd2 <devsock_write>:
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 ec 14             	sub    $0x14,%esp
+  800fd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fdc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fdf:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800fe2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  800fe5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  800fe8:	8b 41 08             	mov    0x8(%ecx),%eax
+  800feb:	c1 f8 09             	sar    $0x9,%eax
+  800fee:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  800ff1:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  800ff7:	77 13                	ja     80100c <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  800ff9:	50                   	push   %eax
+  800ffa:	52                   	push   %edx
+  800ffb:	53                   	push   %ebx
+  800ffc:	ff 71 0c             	push   0xc(%ecx)
+  800fff:	e8 5c 06 00 00       	call   801660 <nsipc_send>
+  801004:	83 c4 10             	add    $0x10,%esp
+}
+  801007:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80100a:	c9                   	leave
+  80100b:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80100c:	50                   	push   %eax
+  80100d:	6a 01                	push   $0x1
+  80100f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801012:	50                   	push   %eax
+  801013:	ff 71 0c             	push   0xc(%ecx)
+  801016:	e8 a6 06 00 00       	call   8016c1 <nsipc_sendmsg>
+  80101b:	83 c4 10             	add    $0x10,%esp
+  80101e:	eb e7                	jmp    801007 <devsock_write+0x35>
+
+00801020 <devsock_read>:
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	53                   	push   %ebx
+  801024:	83 ec 14             	sub    $0x14,%esp
+  801027:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80102a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80102d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801030:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801033:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801036:	8b 41 08             	mov    0x8(%ecx),%eax
+  801039:	c1 f8 09             	sar    $0x9,%eax
+  80103c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80103f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801045:	77 13                	ja     80105a <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801047:	50                   	push   %eax
+  801048:	52                   	push   %edx
+  801049:	53                   	push   %ebx
+  80104a:	ff 71 0c             	push   0xc(%ecx)
+  80104d:	e8 9c 05 00 00       	call   8015ee <nsipc_recv>
+  801052:	83 c4 10             	add    $0x10,%esp
+}
+  801055:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801058:	c9                   	leave
+  801059:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80105a:	50                   	push   %eax
+  80105b:	6a 01                	push   $0x1
+  80105d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801060:	50                   	push   %eax
+  801061:	ff 71 0c             	push   0xc(%ecx)
+  801064:	e8 02 0a 00 00       	call   801a6b <nsipc_recvmsg>
+  801069:	83 c4 10             	add    $0x10,%esp
+  80106c:	eb e7                	jmp    801055 <devsock_read+0x35>
+
+0080106e <fd2sockid>:
+{
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801074:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801077:	52                   	push   %edx
+  801078:	50                   	push   %eax
+  801079:	e8 0b f6 ff ff       	call   800689 <fd_lookup>
+  80107e:	83 c4 10             	add    $0x10,%esp
+  801081:	85 c0                	test   %eax,%eax
+  801083:	78 10                	js     801095 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801085:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801088:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80108e:	39 08                	cmp    %ecx,(%eax)
+  801090:	75 05                	jne    801097 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801092:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801095:	c9                   	leave
+  801096:	c3                   	ret
+		return -E_NOT_SUPP;
+  801097:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80109c:	eb f7                	jmp    801095 <fd2sockid+0x27>
+
+0080109e <sock_flags>:
+{
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8010a4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8010a7:	52                   	push   %edx
+  8010a8:	50                   	push   %eax
+  8010a9:	e8 db f5 ff ff       	call   800689 <fd_lookup>
+  8010ae:	83 c4 10             	add    $0x10,%esp
+  8010b1:	85 c0                	test   %eax,%eax
+  8010b3:	78 0e                	js     8010c3 <sock_flags+0x25>
+  8010b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b8:	8b 40 08             	mov    0x8(%eax),%eax
+  8010bb:	c1 e8 09             	shr    $0x9,%eax
+  8010be:	83 e0 08             	and    $0x8,%eax
+}
+  8010c1:	c9                   	leave
+  8010c2:	c3                   	ret
+		return 0;
+  8010c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c8:	eb f7                	jmp    8010c1 <sock_flags+0x23>
+
+008010ca <alloc_sockfd>:
+{
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	56                   	push   %esi
+  8010ce:	53                   	push   %ebx
+  8010cf:	83 ec 1c             	sub    $0x1c,%esp
+  8010d2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010d7:	50                   	push   %eax
+  8010d8:	e8 5c f5 ff ff       	call   800639 <fd_alloc>
+  8010dd:	89 c3                	mov    %eax,%ebx
+  8010df:	83 c4 10             	add    $0x10,%esp
+  8010e2:	85 c0                	test   %eax,%eax
+  8010e4:	78 43                	js     801129 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010e6:	83 ec 04             	sub    $0x4,%esp
+  8010e9:	68 07 04 00 00       	push   $0x407
+  8010ee:	ff 75 f4             	push   -0xc(%ebp)
+  8010f1:	6a 00                	push   $0x0
+  8010f3:	e8 b7 f0 ff ff       	call   8001af <sys_page_alloc>
+  8010f8:	89 c3                	mov    %eax,%ebx
+  8010fa:	83 c4 10             	add    $0x10,%esp
+  8010fd:	85 c0                	test   %eax,%eax
+  8010ff:	78 28                	js     801129 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801101:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801104:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  80110a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80110c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80110f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801116:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	50                   	push   %eax
+  80111d:	e8 f0 f4 ff ff       	call   800612 <fd2num>
+  801122:	89 c3                	mov    %eax,%ebx
+  801124:	83 c4 10             	add    $0x10,%esp
+  801127:	eb 0c                	jmp    801135 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801129:	83 ec 0c             	sub    $0xc,%esp
+  80112c:	56                   	push   %esi
+  80112d:	e8 4b 04 00 00       	call   80157d <nsipc_close>
+		return r;
+  801132:	83 c4 10             	add    $0x10,%esp
+}
+  801135:	89 d8                	mov    %ebx,%eax
+  801137:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80113a:	5b                   	pop    %ebx
+  80113b:	5e                   	pop    %esi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+
+0080113e <accept>:
+{
+  80113e:	55                   	push   %ebp
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	56                   	push   %esi
+  801142:	53                   	push   %ebx
+  801143:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801146:	89 f0                	mov    %esi,%eax
+  801148:	e8 21 ff ff ff       	call   80106e <fd2sockid>
+  80114d:	89 c3                	mov    %eax,%ebx
+  80114f:	85 c0                	test   %eax,%eax
+  801151:	78 24                	js     801177 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801153:	89 f0                	mov    %esi,%eax
+  801155:	e8 44 ff ff ff       	call   80109e <sock_flags>
+  80115a:	50                   	push   %eax
+  80115b:	ff 75 10             	push   0x10(%ebp)
+  80115e:	ff 75 0c             	push   0xc(%ebp)
+  801161:	53                   	push   %ebx
+  801162:	e8 6b 03 00 00       	call   8014d2 <nsipc_accept>
+  801167:	89 c3                	mov    %eax,%ebx
+  801169:	83 c4 10             	add    $0x10,%esp
+  80116c:	85 c0                	test   %eax,%eax
+  80116e:	78 07                	js     801177 <accept+0x39>
+	return alloc_sockfd(r);
+  801170:	e8 55 ff ff ff       	call   8010ca <alloc_sockfd>
+  801175:	89 c3                	mov    %eax,%ebx
+}
+  801177:	89 d8                	mov    %ebx,%eax
+  801179:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80117c:	5b                   	pop    %ebx
+  80117d:	5e                   	pop    %esi
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+
+00801180 <bind>:
+{
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801186:	8b 45 08             	mov    0x8(%ebp),%eax
+  801189:	e8 e0 fe ff ff       	call   80106e <fd2sockid>
+  80118e:	85 c0                	test   %eax,%eax
+  801190:	78 12                	js     8011a4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801192:	83 ec 04             	sub    $0x4,%esp
+  801195:	ff 75 10             	push   0x10(%ebp)
+  801198:	ff 75 0c             	push   0xc(%ebp)
+  80119b:	50                   	push   %eax
+  80119c:	e8 85 03 00 00       	call   801526 <nsipc_bind>
+  8011a1:	83 c4 10             	add    $0x10,%esp
+}
+  8011a4:	c9                   	leave
+  8011a5:	c3                   	ret
+
+008011a6 <shutdown>:
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011af:	e8 ba fe ff ff       	call   80106e <fd2sockid>
+  8011b4:	85 c0                	test   %eax,%eax
+  8011b6:	78 0f                	js     8011c7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011b8:	83 ec 08             	sub    $0x8,%esp
+  8011bb:	ff 75 0c             	push   0xc(%ebp)
+  8011be:	50                   	push   %eax
+  8011bf:	e8 97 03 00 00       	call   80155b <nsipc_shutdown>
+  8011c4:	83 c4 10             	add    $0x10,%esp
+}
+  8011c7:	c9                   	leave
+  8011c8:	c3                   	ret
+
+008011c9 <connect>:
+{
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d2:	e8 97 fe ff ff       	call   80106e <fd2sockid>
+  8011d7:	85 c0                	test   %eax,%eax
+  8011d9:	78 12                	js     8011ed <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011db:	83 ec 04             	sub    $0x4,%esp
+  8011de:	ff 75 10             	push   0x10(%ebp)
+  8011e1:	ff 75 0c             	push   0xc(%ebp)
+  8011e4:	50                   	push   %eax
+  8011e5:	e8 ad 03 00 00       	call   801597 <nsipc_connect>
+  8011ea:	83 c4 10             	add    $0x10,%esp
+}
+  8011ed:	c9                   	leave
+  8011ee:	c3                   	ret
+
+008011ef <listen>:
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011f8:	e8 71 fe ff ff       	call   80106e <fd2sockid>
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	78 0f                	js     801210 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801201:	83 ec 08             	sub    $0x8,%esp
+  801204:	ff 75 0c             	push   0xc(%ebp)
+  801207:	50                   	push   %eax
+  801208:	e8 bf 03 00 00       	call   8015cc <nsipc_listen>
+  80120d:	83 c4 10             	add    $0x10,%esp
+}
+  801210:	c9                   	leave
+  801211:	c3                   	ret
+
+00801212 <sendmsg>:
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	57                   	push   %edi
+  801216:	56                   	push   %esi
+  801217:	53                   	push   %ebx
+  801218:	83 ec 0c             	sub    $0xc,%esp
+  80121b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80121e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801221:	89 f0                	mov    %esi,%eax
+  801223:	e8 46 fe ff ff       	call   80106e <fd2sockid>
+  801228:	89 c3                	mov    %eax,%ebx
+  80122a:	85 c0                	test   %eax,%eax
+  80122c:	78 1c                	js     80124a <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80122e:	89 f0                	mov    %esi,%eax
+  801230:	e8 69 fe ff ff       	call   80109e <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801235:	0b 45 10             	or     0x10(%ebp),%eax
+  801238:	50                   	push   %eax
+  801239:	ff 77 0c             	push   0xc(%edi)
+  80123c:	ff 77 08             	push   0x8(%edi)
+  80123f:	53                   	push   %ebx
+  801240:	e8 7c 04 00 00       	call   8016c1 <nsipc_sendmsg>
+  801245:	89 c3                	mov    %eax,%ebx
+  801247:	83 c4 10             	add    $0x10,%esp
+}
+  80124a:	89 d8                	mov    %ebx,%eax
+  80124c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124f:	5b                   	pop    %ebx
+  801250:	5e                   	pop    %esi
+  801251:	5f                   	pop    %edi
+  801252:	5d                   	pop    %ebp
+  801253:	c3                   	ret
+
+00801254 <recvmsg>:
+{
+  801254:	55                   	push   %ebp
+  801255:	89 e5                	mov    %esp,%ebp
+  801257:	57                   	push   %edi
+  801258:	56                   	push   %esi
+  801259:	53                   	push   %ebx
+  80125a:	83 ec 0c             	sub    $0xc,%esp
+  80125d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801260:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801263:	89 f8                	mov    %edi,%eax
+  801265:	e8 04 fe ff ff       	call   80106e <fd2sockid>
+  80126a:	89 c3                	mov    %eax,%ebx
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	78 2a                	js     80129a <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801270:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801277:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80127e:	89 f8                	mov    %edi,%eax
+  801280:	e8 19 fe ff ff       	call   80109e <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801285:	0b 45 10             	or     0x10(%ebp),%eax
+  801288:	50                   	push   %eax
+  801289:	ff 76 0c             	push   0xc(%esi)
+  80128c:	ff 76 08             	push   0x8(%esi)
+  80128f:	53                   	push   %ebx
+  801290:	e8 d6 07 00 00       	call   801a6b <nsipc_recvmsg>
+  801295:	89 c3                	mov    %eax,%ebx
+  801297:	83 c4 10             	add    $0x10,%esp
+}
+  80129a:	89 d8                	mov    %ebx,%eax
+  80129c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129f:	5b                   	pop    %ebx
+  8012a0:	5e                   	pop    %esi
+  8012a1:	5f                   	pop    %edi
+  8012a2:	5d                   	pop    %ebp
+  8012a3:	c3                   	ret
+
+008012a4 <sendfile>:
+{
+  8012a4:	55                   	push   %ebp
+  8012a5:	89 e5                	mov    %esp,%ebp
+  8012a7:	56                   	push   %esi
+  8012a8:	53                   	push   %ebx
+  8012a9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8012ac:	89 f0                	mov    %esi,%eax
+  8012ae:	e8 bb fd ff ff       	call   80106e <fd2sockid>
+  8012b3:	89 c3                	mov    %eax,%ebx
+  8012b5:	85 c0                	test   %eax,%eax
+  8012b7:	78 1f                	js     8012d8 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012b9:	89 f0                	mov    %esi,%eax
+  8012bb:	e8 de fd ff ff       	call   80109e <sock_flags>
+  8012c0:	83 ec 0c             	sub    $0xc,%esp
+  8012c3:	50                   	push   %eax
+  8012c4:	ff 75 14             	push   0x14(%ebp)
+  8012c7:	ff 75 10             	push   0x10(%ebp)
+  8012ca:	ff 75 0c             	push   0xc(%ebp)
+  8012cd:	53                   	push   %ebx
+  8012ce:	e8 64 06 00 00       	call   801937 <nsipc_sendfile>
+  8012d3:	89 c3                	mov    %eax,%ebx
+  8012d5:	83 c4 20             	add    $0x20,%esp
+}
+  8012d8:	89 d8                	mov    %ebx,%eax
+  8012da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012dd:	5b                   	pop    %ebx
+  8012de:	5e                   	pop    %esi
+  8012df:	5d                   	pop    %ebp
+  8012e0:	c3                   	ret
+
+008012e1 <evctl>:
+{
+  8012e1:	55                   	push   %ebp
+  8012e2:	89 e5                	mov    %esp,%ebp
+  8012e4:	53                   	push   %ebx
+  8012e5:	83 ec 04             	sub    $0x4,%esp
+  8012e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8012eb:	89 d8                	mov    %ebx,%eax
+  8012ed:	e8 7c fd ff ff       	call   80106e <fd2sockid>
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	78 10                	js     801306 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8012f6:	83 ec 04             	sub    $0x4,%esp
+  8012f9:	53                   	push   %ebx
+  8012fa:	ff 75 0c             	push   0xc(%ebp)
+  8012fd:	50                   	push   %eax
+  8012fe:	e8 d2 0b 00 00       	call   801ed5 <nsipc_evctl>
+  801303:	83 c4 10             	add    $0x10,%esp
+}
+  801306:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801309:	c9                   	leave
+  80130a:	c3                   	ret
+
+0080130b <evwait>:
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801311:	ff 75 10             	push   0x10(%ebp)
+  801314:	ff 75 0c             	push   0xc(%ebp)
+  801317:	ff 75 08             	push   0x8(%ebp)
+  80131a:	e8 e0 0b 00 00       	call   801eff <nsipc_evwait>
+}
+  80131f:	c9                   	leave
+  801320:	c3                   	ret
+
+00801321 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801327:	ff 75 10             	push   0x10(%ebp)
+  80132a:	ff 75 0c             	push   0xc(%ebp)
+  80132d:	ff 75 08             	push   0x8(%ebp)
+  801330:	e8 31 0c 00 00       	call   801f66 <nsipc_socket>
+  801335:	83 c4 10             	add    $0x10,%esp
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	78 05                	js     801341 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80133c:	e8 89 fd ff ff       	call   8010ca <alloc_sockfd>
+}
+  801341:	c9                   	leave
+  801342:	c3                   	ret
+
+00801343 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801343:	55                   	push   %ebp
+  801344:	89 e5                	mov    %esp,%ebp
+  801346:	53                   	push   %ebx
+  801347:	83 ec 04             	sub    $0x4,%esp
+  80134a:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80134c:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801353:	74 26                	je     80137b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801355:	6a 07                	push   $0x7
+  801357:	68 00 70 80 00       	push   $0x807000
+  80135c:	53                   	push   %ebx
+  80135d:	ff 35 24 53 80 00    	push   0x805324
+  801363:	e8 5c 24 00 00       	call   8037c4 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801368:	83 c4 0c             	add    $0xc,%esp
+  80136b:	6a 00                	push   $0x0
+  80136d:	6a 00                	push   $0x0
+  80136f:	6a 00                	push   $0x0
+  801371:	e8 be 21 00 00       	call   803534 <ipc_recv>
+}
+  801376:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801379:	c9                   	leave
+  80137a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80137b:	83 ec 0c             	sub    $0xc,%esp
+  80137e:	6a 03                	push   $0x3
+  801380:	e8 a8 24 00 00       	call   80382d <ipc_find_env>
+  801385:	a3 24 53 80 00       	mov    %eax,0x805324
+  80138a:	83 c4 10             	add    $0x10,%esp
+  80138d:	eb c6                	jmp    801355 <nsipc+0x12>
+
+0080138f <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80138f:	55                   	push   %ebp
+  801390:	89 e5                	mov    %esp,%ebp
+  801392:	56                   	push   %esi
+  801393:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801394:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  80139a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80139f:	85 f6                	test   %esi,%esi
+  8013a1:	75 33                	jne    8013d6 <nsbulk_map+0x47>
+  8013a3:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8013a8:	83 ec 04             	sub    $0x4,%esp
+  8013ab:	6a 07                	push   $0x7
+  8013ad:	53                   	push   %ebx
+  8013ae:	6a 00                	push   $0x0
+  8013b0:	e8 fa ed ff ff       	call   8001af <sys_page_alloc>
+  8013b5:	83 c4 10             	add    $0x10,%esp
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	78 1a                	js     8013d6 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013bc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013c2:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013c8:	75 de                	jne    8013a8 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013ca:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013d1:	00 00 00 
+	return 0;
+  8013d4:	89 f0                	mov    %esi,%eax
+}
+  8013d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d9:	5b                   	pop    %ebx
+  8013da:	5e                   	pop    %esi
+  8013db:	5d                   	pop    %ebp
+  8013dc:	c3                   	ret
+
+008013dd <nsbulk_own>:
+{
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	57                   	push   %edi
+  8013e1:	56                   	push   %esi
+  8013e2:	53                   	push   %ebx
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8013e8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8013eb:	85 d2                	test   %edx,%edx
+  8013ed:	7f 0e                	jg     8013fd <nsbulk_own+0x20>
+	return 0;
+  8013ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f4:	eb 47                	jmp    80143d <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8013f6:	83 c3 01             	add    $0x1,%ebx
+  8013f9:	39 fb                	cmp    %edi,%ebx
+  8013fb:	7d 3b                	jge    801438 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8013fd:	be 01 00 00 00       	mov    $0x1,%esi
+  801402:	89 d9                	mov    %ebx,%ecx
+  801404:	d3 e6                	shl    %cl,%esi
+  801406:	89 f0                	mov    %esi,%eax
+  801408:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  80140e:	74 e6                	je     8013f6 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801410:	83 ec 04             	sub    $0x4,%esp
+  801413:	6a 07                	push   $0x7
+  801415:	89 d8                	mov    %ebx,%eax
+  801417:	c1 e0 0c             	shl    $0xc,%eax
+  80141a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80141f:	50                   	push   %eax
+  801420:	6a 00                	push   $0x0
+  801422:	e8 88 ed ff ff       	call   8001af <sys_page_alloc>
+  801427:	83 c4 10             	add    $0x10,%esp
+  80142a:	85 c0                	test   %eax,%eax
+  80142c:	78 0f                	js     80143d <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80142e:	f7 d6                	not    %esi
+  801430:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801436:	eb be                	jmp    8013f6 <nsbulk_own+0x19>
+	return 0;
+  801438:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801440:	5b                   	pop    %ebx
+  801441:	5e                   	pop    %esi
+  801442:	5f                   	pop    %edi
+  801443:	5d                   	pop    %ebp
+  801444:	c3                   	ret
+
+00801445 <nsipc_bulk>:
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	57                   	push   %edi
+  801449:	56                   	push   %esi
+  80144a:	53                   	push   %ebx
+  80144b:	83 ec 1c             	sub    $0x1c,%esp
+  80144e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801451:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801453:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801459:	c1 fb 0c             	sar    $0xc,%ebx
+  80145c:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80145f:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801466:	74 56                	je     8014be <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801468:	85 ff                	test   %edi,%edi
+  80146a:	7e 24                	jle    801490 <nsipc_bulk+0x4b>
+  80146c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801472:	74 1c                	je     801490 <nsipc_bulk+0x4b>
+  801474:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80147a:	c1 e3 0c             	shl    $0xc,%ebx
+  80147d:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801482:	0f b6 10             	movzbl (%eax),%edx
+  801485:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801487:	05 00 10 00 00       	add    $0x1000,%eax
+  80148c:	39 d8                	cmp    %ebx,%eax
+  80148e:	75 f2                	jne    801482 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801490:	83 ec 0c             	sub    $0xc,%esp
+  801493:	56                   	push   %esi
+  801494:	57                   	push   %edi
+  801495:	68 00 00 00 e0       	push   $0xe0000000
+  80149a:	ff 75 e4             	push   -0x1c(%ebp)
+  80149d:	ff 35 24 53 80 00    	push   0x805324
+  8014a3:	e8 50 23 00 00       	call   8037f8 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8014a8:	83 c4 1c             	add    $0x1c,%esp
+  8014ab:	6a 00                	push   $0x0
+  8014ad:	6a 00                	push   $0x0
+  8014af:	6a 00                	push   $0x0
+  8014b1:	e8 7e 20 00 00       	call   803534 <ipc_recv>
+}
+  8014b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5e                   	pop    %esi
+  8014bb:	5f                   	pop    %edi
+  8014bc:	5d                   	pop    %ebp
+  8014bd:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014be:	83 ec 0c             	sub    $0xc,%esp
+  8014c1:	6a 03                	push   $0x3
+  8014c3:	e8 65 23 00 00       	call   80382d <ipc_find_env>
+  8014c8:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	eb 96                	jmp    801468 <nsipc_bulk+0x23>
+
+008014d2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014d2:	55                   	push   %ebp
+  8014d3:	89 e5                	mov    %esp,%ebp
+  8014d5:	53                   	push   %ebx
+  8014d6:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014dc:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014e4:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8014e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ee:	e8 50 fe ff ff       	call   801343 <nsipc>
+  8014f3:	89 c3                	mov    %eax,%ebx
+  8014f5:	85 c0                	test   %eax,%eax
+  8014f7:	79 07                	jns    801500 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8014f9:	89 d8                	mov    %ebx,%eax
+  8014fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801500:	83 ec 04             	sub    $0x4,%esp
+  801503:	ff 35 10 70 80 00    	push   0x807010
+  801509:	68 00 70 80 00       	push   $0x807000
+  80150e:	ff 75 0c             	push   0xc(%ebp)
+  801511:	e8 56 1e 00 00       	call   80336c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801516:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80151c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80151f:	89 10                	mov    %edx,(%eax)
+  801521:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801524:	eb d3                	jmp    8014f9 <nsipc_accept+0x27>
+
+00801526 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+  801529:	53                   	push   %ebx
+  80152a:	83 ec 08             	sub    $0x8,%esp
+  80152d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801530:	8b 45 08             	mov    0x8(%ebp),%eax
+  801533:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801538:	53                   	push   %ebx
+  801539:	ff 75 0c             	push   0xc(%ebp)
+  80153c:	68 04 70 80 00       	push   $0x807004
+  801541:	e8 26 1e 00 00       	call   80336c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801546:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80154c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801551:	e8 ed fd ff ff       	call   801343 <nsipc>
+}
+  801556:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801559:	c9                   	leave
+  80155a:	c3                   	ret
+
+0080155b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80155b:	55                   	push   %ebp
+  80155c:	89 e5                	mov    %esp,%ebp
+  80155e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801561:	8b 45 08             	mov    0x8(%ebp),%eax
+  801564:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801569:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80156c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801571:	b8 03 00 00 00       	mov    $0x3,%eax
+  801576:	e8 c8 fd ff ff       	call   801343 <nsipc>
+}
+  80157b:	c9                   	leave
+  80157c:	c3                   	ret
+
+0080157d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801583:	8b 45 08             	mov    0x8(%ebp),%eax
+  801586:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80158b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801590:	e8 ae fd ff ff       	call   801343 <nsipc>
+}
+  801595:	c9                   	leave
+  801596:	c3                   	ret
+
+00801597 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801597:	55                   	push   %ebp
+  801598:	89 e5                	mov    %esp,%ebp
+  80159a:	53                   	push   %ebx
+  80159b:	83 ec 08             	sub    $0x8,%esp
+  80159e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8015a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a4:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8015a9:	53                   	push   %ebx
+  8015aa:	ff 75 0c             	push   0xc(%ebp)
+  8015ad:	68 04 70 80 00       	push   $0x807004
+  8015b2:	e8 b5 1d 00 00       	call   80336c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015b7:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015bd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015c2:	e8 7c fd ff ff       	call   801343 <nsipc>
+}
+  8015c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ca:	c9                   	leave
+  8015cb:	c3                   	ret
+
+008015cc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015cc:	55                   	push   %ebp
+  8015cd:	89 e5                	mov    %esp,%ebp
+  8015cf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015dd:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015e2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015e7:	e8 57 fd ff ff       	call   801343 <nsipc>
+}
+  8015ec:	c9                   	leave
+  8015ed:	c3                   	ret
+
+008015ee <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	56                   	push   %esi
+  8015f2:	53                   	push   %ebx
+  8015f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8015f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8015fe:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801604:	8b 45 14             	mov    0x14(%ebp),%eax
+  801607:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80160c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801611:	e8 2d fd ff ff       	call   801343 <nsipc>
+  801616:	89 c3                	mov    %eax,%ebx
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	78 22                	js     80163e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80161c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801621:	39 c6                	cmp    %eax,%esi
+  801623:	0f 4e c6             	cmovle %esi,%eax
+  801626:	39 c3                	cmp    %eax,%ebx
+  801628:	7f 1d                	jg     801647 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80162a:	83 ec 04             	sub    $0x4,%esp
+  80162d:	53                   	push   %ebx
+  80162e:	68 00 70 80 00       	push   $0x807000
+  801633:	ff 75 0c             	push   0xc(%ebp)
+  801636:	e8 31 1d 00 00       	call   80336c <memmove>
+  80163b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80163e:	89 d8                	mov    %ebx,%eax
+  801640:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801643:	5b                   	pop    %ebx
+  801644:	5e                   	pop    %esi
+  801645:	5d                   	pop    %ebp
+  801646:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801647:	68 78 3b 80 00       	push   $0x803b78
+  80164c:	68 8d 3b 80 00       	push   $0x803b8d
+  801651:	68 b2 00 00 00       	push   $0xb2
+  801656:	68 a2 3b 80 00       	push   $0x803ba2
+  80165b:	e8 8a 13 00 00       	call   8029ea <_panic>
+
+00801660 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	53                   	push   %ebx
+  801664:	83 ec 04             	sub    $0x4,%esp
+  801667:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80166a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166d:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801672:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801678:	7f 2e                	jg     8016a8 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80167a:	83 ec 04             	sub    $0x4,%esp
+  80167d:	53                   	push   %ebx
+  80167e:	ff 75 0c             	push   0xc(%ebp)
+  801681:	68 0c 70 80 00       	push   $0x80700c
+  801686:	e8 e1 1c 00 00       	call   80336c <memmove>
+	nsipcbuf.send.req_size = size;
+  80168b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801691:	8b 45 14             	mov    0x14(%ebp),%eax
+  801694:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801699:	b8 08 00 00 00       	mov    $0x8,%eax
+  80169e:	e8 a0 fc ff ff       	call   801343 <nsipc>
+}
+  8016a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+	assert(size < 1600);
+  8016a8:	68 ae 3b 80 00       	push   $0x803bae
+  8016ad:	68 8d 3b 80 00       	push   $0x803b8d
+  8016b2:	68 bd 00 00 00       	push   $0xbd
+  8016b7:	68 a2 3b 80 00       	push   $0x803ba2
+  8016bc:	e8 29 13 00 00       	call   8029ea <_panic>
+
+008016c1 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	57                   	push   %edi
+  8016c5:	56                   	push   %esi
+  8016c6:	53                   	push   %ebx
+  8016c7:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016ca:	e8 c0 fc ff ff       	call   80138f <nsbulk_map>
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 55                	js     801728 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016da:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016e1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8016e8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8016eb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016ee:	0f 8d 24 02 00 00    	jge    801918 <nsipc_sendmsg+0x257>
+  8016f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016fa:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8016fd:	89 d8                	mov    %ebx,%eax
+  8016ff:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801704:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  801706:	83 ec 0c             	sub    $0xc,%esp
+  801709:	68 20 50 80 00       	push   $0x805020
+  80170e:	e8 5a 0f 00 00       	call   80266d <pgbatch_init>
+  801713:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801716:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801718:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80171b:	e9 82 00 00 00       	jmp    8017a2 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  801720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801723:	85 db                	test   %ebx,%ebx
+  801725:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801728:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80172b:	5b                   	pop    %ebx
+  80172c:	5e                   	pop    %esi
+  80172d:	5f                   	pop    %edi
+  80172e:	5d                   	pop    %ebp
+  80172f:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  801730:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801735:	29 c8                	sub    %ecx,%eax
+  801737:	39 d0                	cmp    %edx,%eax
+  801739:	0f 46 d0             	cmovbe %eax,%edx
+  80173c:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80173e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801744:	85 ff                	test   %edi,%edi
+  801746:	0f 49 c7             	cmovns %edi,%eax
+  801749:	c1 f8 0c             	sar    $0xc,%eax
+  80174c:	ba 01 00 00 00       	mov    $0x1,%edx
+  801751:	e8 87 fc ff ff       	call   8013dd <nsbulk_own>
+  801756:	85 c0                	test   %eax,%eax
+  801758:	0f 88 17 01 00 00    	js     801875 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80175e:	83 ec 04             	sub    $0x4,%esp
+  801761:	56                   	push   %esi
+  801762:	ff 75 e0             	push   -0x20(%ebp)
+  801765:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801768:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80176d:	50                   	push   %eax
+  80176e:	e8 f9 1b 00 00       	call   80336c <memmove>
+  801773:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801776:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801779:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80177c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80177f:	0f 84 fd 00 00 00    	je     801882 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801785:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801788:	01 f7                	add    %esi,%edi
+  80178a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80178d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801790:	0f 8d 01 01 00 00    	jge    801897 <nsipc_sendmsg+0x1d6>
+  801796:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80179c:	0f 8f f0 00 00 00    	jg     801892 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8017a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017a5:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8017a8:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8017ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017ae:	89 c2                	mov    %eax,%edx
+  8017b0:	03 13                	add    (%ebx),%edx
+  8017b2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017b5:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017b8:	29 c6                	sub    %eax,%esi
+  8017ba:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017bf:	29 f9                	sub    %edi,%ecx
+  8017c1:	39 ce                	cmp    %ecx,%esi
+  8017c3:	89 ca                	mov    %ecx,%edx
+  8017c5:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017c8:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017cb:	89 f9                	mov    %edi,%ecx
+  8017cd:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017d3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017d6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017db:	09 c8                	or     %ecx,%eax
+  8017dd:	0f 85 4d ff ff ff    	jne    801730 <nsipc_sendmsg+0x6f>
+  8017e3:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017e9:	0f 86 41 ff ff ff    	jbe    801730 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017ef:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8017f5:	85 ff                	test   %edi,%edi
+  8017f7:	0f 49 c7             	cmovns %edi,%eax
+  8017fa:	c1 f8 0c             	sar    $0xc,%eax
+  8017fd:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8017ff:	89 d1                	mov    %edx,%ecx
+  801801:	c1 e9 0c             	shr    $0xc,%ecx
+  801804:	01 c8                	add    %ecx,%eax
+  801806:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801809:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80180c:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80180e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801811:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801816:	29 c8                	sub    %ecx,%eax
+  801818:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80181b:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80181e:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801820:	b8 01 00 00 00       	mov    $0x1,%eax
+  801825:	89 f9                	mov    %edi,%ecx
+  801827:	d3 e0                	shl    %cl,%eax
+  801829:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80182f:	83 ec 08             	sub    $0x8,%esp
+  801832:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801834:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801837:	50                   	push   %eax
+  801838:	6a 00                	push   $0x0
+  80183a:	56                   	push   %esi
+  80183b:	6a 00                	push   $0x0
+  80183d:	68 20 50 80 00       	push   $0x805020
+  801842:	e8 e4 0e 00 00       	call   80272b <pgbatch_map>
+  801847:	83 c4 20             	add    $0x20,%esp
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	0f 88 ce fe ff ff    	js     801720 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  801852:	83 c7 01             	add    $0x1,%edi
+  801855:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80185b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80185e:	39 c7                	cmp    %eax,%edi
+  801860:	75 be                	jne    801820 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  801862:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801865:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801868:	89 d6                	mov    %edx,%esi
+  80186a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801870:	e9 01 ff ff ff       	jmp    801776 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801875:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801878:	85 db                	test   %ebx,%ebx
+  80187a:	0f 45 c3             	cmovne %ebx,%eax
+  80187d:	e9 a6 fe ff ff       	jmp    801728 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  801882:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  801886:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80188d:	e9 f3 fe ff ff       	jmp    801785 <nsipc_sendmsg+0xc4>
+  801892:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801895:	eb 03                	jmp    80189a <nsipc_sendmsg+0x1d9>
+  801897:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80189a:	83 ec 0c             	sub    $0xc,%esp
+  80189d:	68 20 50 80 00       	push   $0x805020
+  8018a2:	e8 d4 0d 00 00       	call   80267b <pgbatch_flush>
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	85 c0                	test   %eax,%eax
+  8018ac:	78 50                	js     8018fe <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8018ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018b6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018bc:	89 fb                	mov    %edi,%ebx
+  8018be:	29 f3                	sub    %esi,%ebx
+  8018c0:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018c9:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018ce:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018d3:	89 fa                	mov    %edi,%edx
+  8018d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018da:	e8 66 fb ff ff       	call   801445 <nsipc_bulk>
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	78 28                	js     80190b <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018e3:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8018e6:	39 c3                	cmp    %eax,%ebx
+  8018e8:	75 0c                	jne    8018f6 <nsipc_sendmsg+0x235>
+  8018ea:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018ed:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8018f0:	0f 8f f2 fd ff ff    	jg     8016e8 <nsipc_sendmsg+0x27>
+		sent += r;
+  8018f6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018f9:	e9 2a fe ff ff       	jmp    801728 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018fe:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801901:	85 db                	test   %ebx,%ebx
+  801903:	0f 45 c3             	cmovne %ebx,%eax
+  801906:	e9 1d fe ff ff       	jmp    801728 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80190b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80190e:	85 db                	test   %ebx,%ebx
+  801910:	0f 45 c3             	cmovne %ebx,%eax
+  801913:	e9 10 fe ff ff       	jmp    801728 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801918:	83 ec 0c             	sub    $0xc,%esp
+  80191b:	68 20 50 80 00       	push   $0x805020
+  801920:	e8 48 0d 00 00       	call   80266d <pgbatch_init>
+  801925:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801928:	be 00 00 00 00       	mov    $0x0,%esi
+  80192d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801932:	e9 63 ff ff ff       	jmp    80189a <nsipc_sendmsg+0x1d9>
+
+00801937 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801937:	55                   	push   %ebp
+  801938:	89 e5                	mov    %esp,%ebp
+  80193a:	57                   	push   %edi
+  80193b:	56                   	push   %esi
+  80193c:	53                   	push   %ebx
+  80193d:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  801940:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  801947:	0f 84 c8 00 00 00    	je     801a15 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80194d:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801954:	0f 84 e4 00 00 00    	je     801a3e <nsipc_sendfile+0x107>
+{
+  80195a:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80195f:	89 fb                	mov    %edi,%ebx
+  801961:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801964:	0f 83 f0 00 00 00    	jae    801a5a <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80196a:	89 fa                	mov    %edi,%edx
+  80196c:	03 55 10             	add    0x10(%ebp),%edx
+  80196f:	89 d0                	mov    %edx,%eax
+  801971:	c1 f8 1f             	sar    $0x1f,%eax
+  801974:	c1 e8 14             	shr    $0x14,%eax
+  801977:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80197a:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801980:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801982:	6a 10                	push   $0x10
+  801984:	68 00 20 01 e0       	push   $0xe0012000
+  801989:	52                   	push   %edx
+  80198a:	ff 75 0c             	push   0xc(%ebp)
+  80198d:	e8 fe f4 ff ff       	call   800e90 <fmap>
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	85 c0                	test   %eax,%eax
+  801997:	0f 8e b8 00 00 00    	jle    801a55 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80199d:	39 c6                	cmp    %eax,%esi
+  80199f:	0f 8d b5 00 00 00    	jge    801a5a <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8019a5:	29 f0                	sub    %esi,%eax
+  8019a7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8019aa:	29 da                	sub    %ebx,%edx
+  8019ac:	39 d0                	cmp    %edx,%eax
+  8019ae:	89 d3                	mov    %edx,%ebx
+  8019b0:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8019b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b6:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019bb:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019c1:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019c7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019ca:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019cf:	83 ec 0c             	sub    $0xc,%esp
+  8019d2:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019d4:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019db:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019de:	83 c0 01             	add    $0x1,%eax
+  8019e1:	50                   	push   %eax
+  8019e2:	68 00 10 01 e0       	push   $0xe0011000
+  8019e7:	6a 11                	push   $0x11
+  8019e9:	ff 35 24 53 80 00    	push   0x805324
+  8019ef:	e8 04 1e 00 00       	call   8037f8 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8019f4:	83 c4 1c             	add    $0x1c,%esp
+  8019f7:	6a 00                	push   $0x0
+  8019f9:	6a 00                	push   $0x0
+  8019fb:	6a 00                	push   $0x0
+  8019fd:	e8 32 1b 00 00       	call   803534 <ipc_recv>
+  801a02:	83 c4 10             	add    $0x10,%esp
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	78 5b                	js     801a64 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  801a09:	01 c7                	add    %eax,%edi
+		if (r < n)
+  801a0b:	39 c3                	cmp    %eax,%ebx
+  801a0d:	0f 8e 4c ff ff ff    	jle    80195f <nsipc_sendfile+0x28>
+  801a13:	eb 45                	jmp    801a5a <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a15:	83 ec 04             	sub    $0x4,%esp
+  801a18:	6a 07                	push   $0x7
+  801a1a:	68 00 10 01 e0       	push   $0xe0011000
+  801a1f:	6a 00                	push   $0x0
+  801a21:	e8 89 e7 ff ff       	call   8001af <sys_page_alloc>
+  801a26:	89 c7                	mov    %eax,%edi
+  801a28:	83 c4 10             	add    $0x10,%esp
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	78 2b                	js     801a5a <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a2f:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a36:	00 00 00 
+  801a39:	e9 0f ff ff ff       	jmp    80194d <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a3e:	83 ec 0c             	sub    $0xc,%esp
+  801a41:	6a 03                	push   $0x3
+  801a43:	e8 e5 1d 00 00       	call   80382d <ipc_find_env>
+  801a48:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a4d:	83 c4 10             	add    $0x10,%esp
+  801a50:	e9 05 ff ff ff       	jmp    80195a <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a55:	85 ff                	test   %edi,%edi
+  801a57:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a5a:	89 f8                	mov    %edi,%eax
+  801a5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5f:	5b                   	pop    %ebx
+  801a60:	5e                   	pop    %esi
+  801a61:	5f                   	pop    %edi
+  801a62:	5d                   	pop    %ebp
+  801a63:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a64:	85 ff                	test   %edi,%edi
+  801a66:	0f 44 f8             	cmove  %eax,%edi
+  801a69:	eb ef                	jmp    801a5a <nsipc_sendfile+0x123>
+
+00801a6b <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	57                   	push   %edi
+  801a6f:	56                   	push   %esi
+  801a70:	53                   	push   %ebx
+  801a71:	83 ec 1c             	sub    $0x1c,%esp
+  801a74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a77:	e8 13 f9 ff ff       	call   80138f <nsbulk_map>
+  801a7c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	0f 88 ba 00 00 00    	js     801b41 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a87:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a8b:	0f 8e bb 00 00 00    	jle    801b4c <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801a91:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a96:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801a9b:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801aa0:	89 f8                	mov    %edi,%eax
+  801aa2:	29 f0                	sub    %esi,%eax
+  801aa4:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801aa8:	39 c8                	cmp    %ecx,%eax
+  801aaa:	0f 47 c1             	cmova  %ecx,%eax
+  801aad:	01 f0                	add    %esi,%eax
+  801aaf:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801ab1:	83 c2 01             	add    $0x1,%edx
+  801ab4:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801ab7:	7e 07                	jle    801ac0 <nsipc_recvmsg+0x55>
+  801ab9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801abe:	7e e0                	jle    801aa0 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801ac0:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801ac6:	c1 fa 0c             	sar    $0xc,%edx
+  801ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ace:	e8 0a f9 ff ff       	call   8013dd <nsbulk_own>
+  801ad3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ad6:	85 c0                	test   %eax,%eax
+  801ad8:	78 67                	js     801b41 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  801add:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801ae2:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801ae8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aeb:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801af0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801af5:	89 f2                	mov    %esi,%edx
+  801af7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801afc:	e8 44 f9 ff ff       	call   801445 <nsipc_bulk>
+  801b01:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 39                	js     801b41 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801b08:	39 f0                	cmp    %esi,%eax
+  801b0a:	7f 4a                	jg     801b56 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	7e 2c                	jle    801b41 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b15:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b18:	29 fe                	sub    %edi,%esi
+  801b1a:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b1d:	39 c6                	cmp    %eax,%esi
+  801b1f:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b22:	83 ec 04             	sub    $0x4,%esp
+  801b25:	56                   	push   %esi
+  801b26:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b2c:	50                   	push   %eax
+  801b2d:	ff 33                	push   (%ebx)
+  801b2f:	e8 38 18 00 00       	call   80336c <memmove>
+		n += m;
+  801b34:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b36:	83 c3 08             	add    $0x8,%ebx
+  801b39:	83 c4 10             	add    $0x10,%esp
+  801b3c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b3f:	7f d4                	jg     801b15 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b41:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b47:	5b                   	pop    %ebx
+  801b48:	5e                   	pop    %esi
+  801b49:	5f                   	pop    %edi
+  801b4a:	5d                   	pop    %ebp
+  801b4b:	c3                   	ret
+	int r, i, n, len = 0;
+  801b4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b51:	e9 6a ff ff ff       	jmp    801ac0 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b56:	68 84 3b 80 00       	push   $0x803b84
+  801b5b:	68 8d 3b 80 00       	push   $0x803b8d
+  801b60:	68 3b 01 00 00       	push   $0x13b
+  801b65:	68 a2 3b 80 00       	push   $0x803ba2
+  801b6a:	e8 7b 0e 00 00       	call   8029ea <_panic>
+
+00801b6f <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	57                   	push   %edi
+  801b73:	56                   	push   %esi
+  801b74:	53                   	push   %ebx
+  801b75:	83 ec 0c             	sub    $0xc,%esp
+  801b78:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b7b:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b7e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b84:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801b89:	8b 07                	mov    (%edi),%eax
+  801b8b:	a3 04 70 80 00       	mov    %eax,0x807004
+  801b90:	8b 47 04             	mov    0x4(%edi),%eax
+  801b93:	a3 08 70 80 00       	mov    %eax,0x807008
+  801b98:	8b 47 08             	mov    0x8(%edi),%eax
+  801b9b:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801ba0:	8b 47 0c             	mov    0xc(%edi),%eax
+  801ba3:	a3 10 70 80 00       	mov    %eax,0x807010
+  801ba8:	8b 47 10             	mov    0x10(%edi),%eax
+  801bab:	a3 14 70 80 00       	mov    %eax,0x807014
+  801bb0:	8b 47 14             	mov    0x14(%edi),%eax
+  801bb3:	a3 18 70 80 00       	mov    %eax,0x807018
+  801bb8:	8b 47 18             	mov    0x18(%edi),%eax
+  801bbb:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bc0:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801bc3:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bc8:	8b 47 20             	mov    0x20(%edi),%eax
+  801bcb:	a3 24 70 80 00       	mov    %eax,0x807024
+  801bd0:	8b 47 24             	mov    0x24(%edi),%eax
+  801bd3:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bd8:	8b 47 28             	mov    0x28(%edi),%eax
+  801bdb:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801be0:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801be3:	a3 30 70 80 00       	mov    %eax,0x807030
+  801be8:	8b 47 30             	mov    0x30(%edi),%eax
+  801beb:	a3 34 70 80 00       	mov    %eax,0x807034
+  801bf0:	8b 47 34             	mov    0x34(%edi),%eax
+  801bf3:	a3 38 70 80 00       	mov    %eax,0x807038
+  801bf8:	8b 47 38             	mov    0x38(%edi),%eax
+  801bfb:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801c00:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801c03:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801c08:	8b 06                	mov    (%esi),%eax
+  801c0a:	a3 44 70 80 00       	mov    %eax,0x807044
+  801c0f:	8b 46 04             	mov    0x4(%esi),%eax
+  801c12:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c17:	8b 46 08             	mov    0x8(%esi),%eax
+  801c1a:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c1f:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c22:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c27:	8b 46 10             	mov    0x10(%esi),%eax
+  801c2a:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c2f:	8b 46 14             	mov    0x14(%esi),%eax
+  801c32:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c37:	8b 46 18             	mov    0x18(%esi),%eax
+  801c3a:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c3f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c42:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c47:	8b 46 20             	mov    0x20(%esi),%eax
+  801c4a:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c4f:	8b 46 24             	mov    0x24(%esi),%eax
+  801c52:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c57:	8b 46 28             	mov    0x28(%esi),%eax
+  801c5a:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c5f:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c62:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c67:	8b 46 30             	mov    0x30(%esi),%eax
+  801c6a:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c6f:	8b 46 34             	mov    0x34(%esi),%eax
+  801c72:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c77:	8b 46 38             	mov    0x38(%esi),%eax
+  801c7a:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c7f:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c82:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801c87:	8b 03                	mov    (%ebx),%eax
+  801c89:	a3 84 70 80 00       	mov    %eax,0x807084
+  801c8e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c91:	a3 88 70 80 00       	mov    %eax,0x807088
+  801c96:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c99:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801c9e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ca1:	a3 90 70 80 00       	mov    %eax,0x807090
+  801ca6:	8b 43 10             	mov    0x10(%ebx),%eax
+  801ca9:	a3 94 70 80 00       	mov    %eax,0x807094
+  801cae:	8b 43 14             	mov    0x14(%ebx),%eax
+  801cb1:	a3 98 70 80 00       	mov    %eax,0x807098
+  801cb6:	8b 43 18             	mov    0x18(%ebx),%eax
+  801cb9:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801cbe:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cc1:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cc6:	8b 43 20             	mov    0x20(%ebx),%eax
+  801cc9:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801cce:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cd1:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cd6:	8b 43 28             	mov    0x28(%ebx),%eax
+  801cd9:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801cde:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801ce1:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801ce6:	8b 43 30             	mov    0x30(%ebx),%eax
+  801ce9:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801cee:	8b 43 34             	mov    0x34(%ebx),%eax
+  801cf1:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801cf6:	8b 43 38             	mov    0x38(%ebx),%eax
+  801cf9:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801cfe:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801d01:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801d06:	8b 45 18             	mov    0x18(%ebp),%eax
+  801d09:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801d0e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d13:	e8 2b f6 ff ff       	call   801343 <nsipc>
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	0f 88 ad 01 00 00    	js     801ecd <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d20:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d26:	89 17                	mov    %edx,(%edi)
+  801d28:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d2e:	89 57 04             	mov    %edx,0x4(%edi)
+  801d31:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d37:	89 57 08             	mov    %edx,0x8(%edi)
+  801d3a:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d40:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d43:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d49:	89 57 10             	mov    %edx,0x10(%edi)
+  801d4c:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d52:	89 57 14             	mov    %edx,0x14(%edi)
+  801d55:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d5b:	89 57 18             	mov    %edx,0x18(%edi)
+  801d5e:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d64:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d67:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d6d:	89 57 20             	mov    %edx,0x20(%edi)
+  801d70:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d76:	89 57 24             	mov    %edx,0x24(%edi)
+  801d79:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d7f:	89 57 28             	mov    %edx,0x28(%edi)
+  801d82:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801d88:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801d8b:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801d91:	89 57 30             	mov    %edx,0x30(%edi)
+  801d94:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801d9a:	89 57 34             	mov    %edx,0x34(%edi)
+  801d9d:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801da3:	89 57 38             	mov    %edx,0x38(%edi)
+  801da6:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801dac:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801daf:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801db5:	89 16                	mov    %edx,(%esi)
+  801db7:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801dbd:	89 56 04             	mov    %edx,0x4(%esi)
+  801dc0:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801dc6:	89 56 08             	mov    %edx,0x8(%esi)
+  801dc9:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dcf:	89 56 0c             	mov    %edx,0xc(%esi)
+  801dd2:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801dd8:	89 56 10             	mov    %edx,0x10(%esi)
+  801ddb:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801de1:	89 56 14             	mov    %edx,0x14(%esi)
+  801de4:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801dea:	89 56 18             	mov    %edx,0x18(%esi)
+  801ded:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801df3:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801df6:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801dfc:	89 56 20             	mov    %edx,0x20(%esi)
+  801dff:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801e05:	89 56 24             	mov    %edx,0x24(%esi)
+  801e08:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801e0e:	89 56 28             	mov    %edx,0x28(%esi)
+  801e11:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e17:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e1a:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e20:	89 56 30             	mov    %edx,0x30(%esi)
+  801e23:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e29:	89 56 34             	mov    %edx,0x34(%esi)
+  801e2c:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e32:	89 56 38             	mov    %edx,0x38(%esi)
+  801e35:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e3b:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e3e:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e44:	89 13                	mov    %edx,(%ebx)
+  801e46:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e4c:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e4f:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e55:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e58:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e5e:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e61:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e67:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e6a:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e70:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e73:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e79:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e7c:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e82:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801e85:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801e8b:	89 53 20             	mov    %edx,0x20(%ebx)
+  801e8e:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801e94:	89 53 24             	mov    %edx,0x24(%ebx)
+  801e97:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801e9d:	89 53 28             	mov    %edx,0x28(%ebx)
+  801ea0:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801ea6:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801ea9:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801eaf:	89 53 30             	mov    %edx,0x30(%ebx)
+  801eb2:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801eb8:	89 53 34             	mov    %edx,0x34(%ebx)
+  801ebb:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801ec1:	89 53 38             	mov    %edx,0x38(%ebx)
+  801ec4:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801eca:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801ecd:	83 c4 0c             	add    $0xc,%esp
+  801ed0:	5b                   	pop    %ebx
+  801ed1:	5e                   	pop    %esi
+  801ed2:	5f                   	pop    %edi
+  801ed3:	5d                   	pop    %ebp
+  801ed4:	c3                   	ret
+
+00801ed5 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ed5:	55                   	push   %ebp
+  801ed6:	89 e5                	mov    %esp,%ebp
+  801ed8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801edb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ede:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801ee3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee6:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801eeb:	8b 45 10             	mov    0x10(%ebp),%eax
+  801eee:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801ef3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ef8:	e8 46 f4 ff ff       	call   801343 <nsipc>
+}
+  801efd:	c9                   	leave
+  801efe:	c3                   	ret
+
+00801eff <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801eff:	55                   	push   %ebp
+  801f00:	89 e5                	mov    %esp,%ebp
+  801f02:	56                   	push   %esi
+  801f03:	53                   	push   %ebx
+  801f04:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801f07:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801f0d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f10:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f15:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f1a:	e8 24 f4 ff ff       	call   801343 <nsipc>
+  801f1f:	89 c3                	mov    %eax,%ebx
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	7e 1f                	jle    801f44 <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f25:	39 c6                	cmp    %eax,%esi
+  801f27:	7c 24                	jl     801f4d <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f29:	83 ec 04             	sub    $0x4,%esp
+  801f2c:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f33:	50                   	push   %eax
+  801f34:	68 00 70 80 00       	push   $0x807000
+  801f39:	ff 75 08             	push   0x8(%ebp)
+  801f3c:	e8 2b 14 00 00       	call   80336c <memmove>
+  801f41:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f44:	89 d8                	mov    %ebx,%eax
+  801f46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f49:	5b                   	pop    %ebx
+  801f4a:	5e                   	pop    %esi
+  801f4b:	5d                   	pop    %ebp
+  801f4c:	c3                   	ret
+		assert(r <= max);
+  801f4d:	68 ba 3b 80 00       	push   $0x803bba
+  801f52:	68 8d 3b 80 00       	push   $0x803b8d
+  801f57:	68 6a 01 00 00       	push   $0x16a
+  801f5c:	68 a2 3b 80 00       	push   $0x803ba2
+  801f61:	e8 84 0a 00 00       	call   8029ea <_panic>
+
+00801f66 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f77:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f7c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f7f:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f84:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f89:	e8 b5 f3 ff ff       	call   801343 <nsipc>
+}
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+00801f90 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801f96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f99:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801f9e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fa3:	e8 9b f3 ff ff       	call   801343 <nsipc>
+}
+  801fa8:	c9                   	leave
+  801fa9:	c3                   	ret
+
+00801faa <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	53                   	push   %ebx
+  801fae:	83 ec 04             	sub    $0x4,%esp
+  801fb1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fb4:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fb9:	e8 85 f3 ff ff       	call   801343 <nsipc>
+  801fbe:	85 c0                	test   %eax,%eax
+  801fc0:	78 50                	js     802012 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fc2:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fc8:	89 13                	mov    %edx,(%ebx)
+  801fca:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801fd0:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fd3:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801fd9:	89 53 08             	mov    %edx,0x8(%ebx)
+  801fdc:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801fe2:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801fe5:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801feb:	89 53 10             	mov    %edx,0x10(%ebx)
+  801fee:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801ff4:	89 53 14             	mov    %edx,0x14(%ebx)
+  801ff7:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801ffd:	89 53 18             	mov    %edx,0x18(%ebx)
+  802000:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  802006:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802009:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  80200f:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802012:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802015:	c9                   	leave
+  802016:	c3                   	ret
+
+00802017 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80201d:	6a 03                	push   $0x3
+  80201f:	e8 09 18 00 00       	call   80382d <ipc_find_env>
+  802024:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802029:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802031:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802036:	e8 08 f3 ff ff       	call   801343 <nsipc>
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	78 0a                	js     80204c <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802042:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802047:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80204c:	c9                   	leave
+  80204d:	c3                   	ret
+
+0080204e <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80204e:	55                   	push   %ebp
+  80204f:	89 e5                	mov    %esp,%ebp
+  802051:	57                   	push   %edi
+  802052:	56                   	push   %esi
+  802053:	53                   	push   %ebx
+  802054:	83 ec 1c             	sub    $0x1c,%esp
+  802057:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80205a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80205d:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802062:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802067:	89 e0                	mov    %esp,%eax
+  802069:	89 f2                	mov    %esi,%edx
+  80206b:	29 c2                	sub    %eax,%edx
+  80206d:	89 d0                	mov    %edx,%eax
+  80206f:	c1 e8 0f             	shr    $0xf,%eax
+  802072:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802078:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80207b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  802082:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802085:	83 ec 0c             	sub    $0xc,%esp
+  802088:	ff 75 e0             	push   -0x20(%ebp)
+  80208b:	e8 dc 17 00 00       	call   80386c <pageref>
+  802090:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802093:	83 c4 04             	add    $0x4,%esp
+  802096:	ff 75 dc             	push   -0x24(%ebp)
+  802099:	e8 ce 17 00 00       	call   80386c <pageref>
+  80209e:	89 e2                	mov    %esp,%edx
+  8020a0:	89 f1                	mov    %esi,%ecx
+  8020a2:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8020a4:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8020a7:	89 ca                	mov    %ecx,%edx
+  8020a9:	c1 ea 0f             	shr    $0xf,%edx
+  8020ac:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8020b2:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020b5:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020bc:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020bf:	39 d7                	cmp    %edx,%edi
+  8020c1:	74 40                	je     802103 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020c3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020c6:	75 9f                	jne    802067 <_pipeisclosed+0x19>
+  8020c8:	89 e2                	mov    %esp,%edx
+  8020ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020cf:	29 d0                	sub    %edx,%eax
+  8020d1:	89 c2                	mov    %eax,%edx
+  8020d3:	c1 ea 0f             	shr    $0xf,%edx
+  8020d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e0:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020e3:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020ea:	8b 40 58             	mov    0x58(%eax),%eax
+  8020ed:	6a 01                	push   $0x1
+  8020ef:	50                   	push   %eax
+  8020f0:	57                   	push   %edi
+  8020f1:	68 c3 3b 80 00       	push   $0x803bc3
+  8020f6:	e8 ca 09 00 00       	call   802ac5 <cprintf>
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	e9 5f ff ff ff       	jmp    802062 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802103:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802106:	0f 94 c0             	sete   %al
+  802109:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80210c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80210f:	5b                   	pop    %ebx
+  802110:	5e                   	pop    %esi
+  802111:	5f                   	pop    %edi
+  802112:	5d                   	pop    %ebp
+  802113:	c3                   	ret
+
+00802114 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802114:	55                   	push   %ebp
+  802115:	89 e5                	mov    %esp,%ebp
+  802117:	53                   	push   %ebx
+  802118:	83 ec 0c             	sub    $0xc,%esp
+  80211b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80211e:	53                   	push   %ebx
+  80211f:	6a 00                	push   $0x0
+  802121:	e8 0e e1 ff ff       	call   800234 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802126:	89 1c 24             	mov    %ebx,(%esp)
+  802129:	e8 f4 e4 ff ff       	call   800622 <fd2data>
+  80212e:	83 c4 08             	add    $0x8,%esp
+  802131:	50                   	push   %eax
+  802132:	6a 00                	push   $0x0
+  802134:	e8 fb e0 ff ff       	call   800234 <sys_page_unmap>
+}
+  802139:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213c:	c9                   	leave
+  80213d:	c3                   	ret
+
+0080213e <devpipe_read>:
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	57                   	push   %edi
+  802142:	56                   	push   %esi
+  802143:	53                   	push   %ebx
+  802144:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802147:	ff 75 08             	push   0x8(%ebp)
+  80214a:	e8 d3 e4 ff ff       	call   800622 <fd2data>
+  80214f:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802151:	8b 70 04             	mov    0x4(%eax),%esi
+  802154:	8b 00                	mov    (%eax),%eax
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	39 f0                	cmp    %esi,%eax
+  80215b:	75 36                	jne    802193 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80215d:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802160:	89 da                	mov    %ebx,%edx
+  802162:	8b 45 08             	mov    0x8(%ebp),%eax
+  802165:	e8 e4 fe ff ff       	call   80204e <_pipeisclosed>
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	0f 85 d4 00 00 00    	jne    802246 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802172:	b8 01 00 00 00       	mov    $0x1,%eax
+  802177:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80217b:	83 ec 04             	sub    $0x4,%esp
+  80217e:	6a ff                	push   $0xffffffff
+  802180:	56                   	push   %esi
+  802181:	57                   	push   %edi
+  802182:	e8 26 e4 ff ff       	call   8005ad <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802187:	8b 73 04             	mov    0x4(%ebx),%esi
+  80218a:	8b 03                	mov    (%ebx),%eax
+  80218c:	83 c4 10             	add    $0x10,%esp
+  80218f:	39 c6                	cmp    %eax,%esi
+  802191:	74 cd                	je     802160 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802193:	8b 73 04             	mov    0x4(%ebx),%esi
+  802196:	8b 03                	mov    (%ebx),%eax
+  802198:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80219e:	29 c6                	sub    %eax,%esi
+  8021a0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021a5:	f7 e6                	mul    %esi
+  8021a7:	c1 ea 0c             	shr    $0xc,%edx
+  8021aa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021b0:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8021b2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021b5:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021b9:	8b 0b                	mov    (%ebx),%ecx
+  8021bb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021c0:	f7 e1                	mul    %ecx
+  8021c2:	c1 ea 0b             	shr    $0xb,%edx
+  8021c5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021cb:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021cd:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021d2:	29 cf                	sub    %ecx,%edi
+  8021d4:	39 f7                	cmp    %esi,%edi
+  8021d6:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021d9:	83 ec 04             	sub    $0x4,%esp
+  8021dc:	57                   	push   %edi
+  8021dd:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	ff 75 0c             	push   0xc(%ebp)
+  8021e5:	e8 82 11 00 00       	call   80336c <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8021ea:	83 c4 0c             	add    $0xc,%esp
+  8021ed:	89 f0                	mov    %esi,%eax
+  8021ef:	29 f8                	sub    %edi,%eax
+  8021f1:	50                   	push   %eax
+  8021f2:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	89 f8                	mov    %edi,%eax
+  8021f8:	03 45 0c             	add    0xc(%ebp),%eax
+  8021fb:	50                   	push   %eax
+  8021fc:	e8 6b 11 00 00       	call   80336c <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802201:	8b 0b                	mov    (%ebx),%ecx
+  802203:	01 f1                	add    %esi,%ecx
+  802205:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80220a:	f7 e1                	mul    %ecx
+  80220c:	c1 ea 0c             	shr    $0xc,%edx
+  80220f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802215:	29 c1                	sub    %eax,%ecx
+  802217:	89 0b                	mov    %ecx,(%ebx)
+  802219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221e:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802222:	83 c4 10             	add    $0x10,%esp
+  802225:	85 c0                	test   %eax,%eax
+  802227:	75 0a                	jne    802233 <devpipe_read+0xf5>
+	return n;
+  802229:	89 f0                	mov    %esi,%eax
+}
+  80222b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80222e:	5b                   	pop    %ebx
+  80222f:	5e                   	pop    %esi
+  802230:	5f                   	pop    %edi
+  802231:	5d                   	pop    %ebp
+  802232:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	68 00 04 00 00       	push   $0x400
+  80223b:	53                   	push   %ebx
+  80223c:	e8 8e e3 ff ff       	call   8005cf <sys_futex_wake>
+  802241:	83 c4 10             	add    $0x10,%esp
+  802244:	eb e3                	jmp    802229 <devpipe_read+0xeb>
+			return 0;
+  802246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224b:	eb de                	jmp    80222b <devpipe_read+0xed>
+
+0080224d <devpipe_write>:
+{
+  80224d:	55                   	push   %ebp
+  80224e:	89 e5                	mov    %esp,%ebp
+  802250:	57                   	push   %edi
+  802251:	56                   	push   %esi
+  802252:	53                   	push   %ebx
+  802253:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802256:	ff 75 08             	push   0x8(%ebp)
+  802259:	e8 c4 e3 ff ff       	call   800622 <fd2data>
+  80225e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80226a:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80226f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802273:	0f 84 43 01 00 00    	je     8023bc <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802279:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80227c:	8b 06                	mov    (%esi),%eax
+  80227e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802284:	29 c1                	sub    %eax,%ecx
+  802286:	89 c8                	mov    %ecx,%eax
+  802288:	f7 e7                	mul    %edi
+  80228a:	c1 ea 0c             	shr    $0xc,%edx
+  80228d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802293:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802295:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80229b:	75 52                	jne    8022ef <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80229d:	89 f2                	mov    %esi,%edx
+  80229f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a2:	e8 a7 fd ff ff       	call   80204e <_pipeisclosed>
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	0f 85 28 01 00 00    	jne    8023d7 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8022af:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022b1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022b4:	8b 06                	mov    (%esi),%eax
+  8022b6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022bc:	29 c1                	sub    %eax,%ecx
+  8022be:	89 c8                	mov    %ecx,%eax
+  8022c0:	f7 e7                	mul    %edi
+  8022c2:	c1 ea 0c             	shr    $0xc,%edx
+  8022c5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022cb:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022cd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022d3:	75 a4                	jne    802279 <devpipe_write+0x2c>
+  8022d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022da:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022de:	83 ec 04             	sub    $0x4,%esp
+  8022e1:	6a ff                	push   $0xffffffff
+  8022e3:	53                   	push   %ebx
+  8022e4:	56                   	push   %esi
+  8022e5:	e8 c3 e2 ff ff       	call   8005ad <sys_futex_wait>
+}
+  8022ea:	83 c4 10             	add    $0x10,%esp
+  8022ed:	eb 8a                	jmp    802279 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022ef:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022f2:	8b 06                	mov    (%esi),%eax
+  8022f4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022fa:	29 c1                	sub    %eax,%ecx
+  8022fc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802301:	f7 e1                	mul    %ecx
+  802303:	c1 ea 0c             	shr    $0xc,%edx
+  802306:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80230c:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80230e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802313:	89 d8                	mov    %ebx,%eax
+  802315:	29 c8                	sub    %ecx,%eax
+  802317:	8b 55 10             	mov    0x10(%ebp),%edx
+  80231a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80231d:	29 ca                	sub    %ecx,%edx
+  80231f:	39 d0                	cmp    %edx,%eax
+  802321:	0f 46 d0             	cmovbe %eax,%edx
+  802324:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802327:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80232a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80232f:	f7 e1                	mul    %ecx
+  802331:	c1 ea 0b             	shr    $0xb,%edx
+  802334:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80233a:	89 ca                	mov    %ecx,%edx
+  80233c:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80233e:	29 d3                	sub    %edx,%ebx
+  802340:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802343:	39 c3                	cmp    %eax,%ebx
+  802345:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802348:	83 ec 04             	sub    $0x4,%esp
+  80234b:	53                   	push   %ebx
+  80234c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80234f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802352:	51                   	push   %ecx
+  802353:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802357:	50                   	push   %eax
+  802358:	e8 0f 10 00 00       	call   80336c <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80235d:	83 c4 0c             	add    $0xc,%esp
+  802360:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802363:	29 d8                	sub    %ebx,%eax
+  802365:	50                   	push   %eax
+  802366:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802369:	01 cb                	add    %ecx,%ebx
+  80236b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80236e:	53                   	push   %ebx
+  80236f:	8d 46 10             	lea    0x10(%esi),%eax
+  802372:	50                   	push   %eax
+  802373:	e8 f4 0f 00 00       	call   80336c <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802378:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80237b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80237e:	01 c1                	add    %eax,%ecx
+  802380:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802385:	f7 e1                	mul    %ecx
+  802387:	c1 ea 0c             	shr    $0xc,%edx
+  80238a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802390:	89 ca                	mov    %ecx,%edx
+  802392:	29 c2                	sub    %eax,%edx
+  802394:	89 56 04             	mov    %edx,0x4(%esi)
+  802397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239c:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8023a0:	83 c4 10             	add    $0x10,%esp
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	75 1a                	jne    8023c1 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8023a7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8023aa:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8023ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023b0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023b3:	0f 82 c0 fe ff ff    	jb     802279 <devpipe_write+0x2c>
+  8023b9:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023bf:	eb 1b                	jmp    8023dc <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023c1:	83 ec 08             	sub    $0x8,%esp
+  8023c4:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023c9:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023cc:	50                   	push   %eax
+  8023cd:	e8 fd e1 ff ff       	call   8005cf <sys_futex_wake>
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	eb d0                	jmp    8023a7 <devpipe_write+0x15a>
+				return 0;
+  8023d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023df:	5b                   	pop    %ebx
+  8023e0:	5e                   	pop    %esi
+  8023e1:	5f                   	pop    %edi
+  8023e2:	5d                   	pop    %ebp
+  8023e3:	c3                   	ret
+
+008023e4 <devpipe_stat>:
+{
+  8023e4:	55                   	push   %ebp
+  8023e5:	89 e5                	mov    %esp,%ebp
+  8023e7:	56                   	push   %esi
+  8023e8:	53                   	push   %ebx
+  8023e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023ec:	83 ec 0c             	sub    $0xc,%esp
+  8023ef:	ff 75 08             	push   0x8(%ebp)
+  8023f2:	e8 2b e2 ff ff       	call   800622 <fd2data>
+  8023f7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023f9:	83 c4 08             	add    $0x8,%esp
+  8023fc:	68 d6 3b 80 00       	push   $0x803bd6
+  802401:	53                   	push   %ebx
+  802402:	e8 b5 0d 00 00       	call   8031bc <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802407:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80240a:	8b 06                	mov    (%esi),%eax
+  80240c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802412:	29 c1                	sub    %eax,%ecx
+  802414:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802419:	89 c8                	mov    %ecx,%eax
+  80241b:	f7 e2                	mul    %edx
+  80241d:	c1 ea 0c             	shr    $0xc,%edx
+  802420:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802426:	29 d1                	sub    %edx,%ecx
+  802428:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80242e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802435:	00 00 00 
+	stat->st_dev = &devpipe;
+  802438:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  80243f:	40 80 00 
+}
+  802442:	b8 00 00 00 00       	mov    $0x0,%eax
+  802447:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80244a:	5b                   	pop    %ebx
+  80244b:	5e                   	pop    %esi
+  80244c:	5d                   	pop    %ebp
+  80244d:	c3                   	ret
+
+0080244e <devpipe_poll>:
+{
+  80244e:	55                   	push   %ebp
+  80244f:	89 e5                	mov    %esp,%ebp
+  802451:	57                   	push   %edi
+  802452:	56                   	push   %esi
+  802453:	53                   	push   %ebx
+  802454:	83 ec 18             	sub    $0x18,%esp
+  802457:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80245a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80245d:	57                   	push   %edi
+  80245e:	e8 bf e1 ff ff       	call   800622 <fd2data>
+  802463:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	89 f3                	mov    %esi,%ebx
+  80246a:	83 e3 01             	and    $0x1,%ebx
+  80246d:	75 27                	jne    802496 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80246f:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802475:	75 48                	jne    8024bf <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802477:	89 ca                	mov    %ecx,%edx
+  802479:	89 f8                	mov    %edi,%eax
+  80247b:	e8 ce fb ff ff       	call   80204e <_pipeisclosed>
+  802480:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  802482:	89 d8                	mov    %ebx,%eax
+  802484:	83 c8 10             	or     $0x10,%eax
+  802487:	85 d2                	test   %edx,%edx
+  802489:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80248c:	89 d8                	mov    %ebx,%eax
+  80248e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802491:	5b                   	pop    %ebx
+  802492:	5e                   	pop    %esi
+  802493:	5f                   	pop    %edi
+  802494:	5d                   	pop    %ebp
+  802495:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802496:	8b 58 04             	mov    0x4(%eax),%ebx
+  802499:	8b 00                	mov    (%eax),%eax
+  80249b:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8024a1:	29 c3                	sub    %eax,%ebx
+  8024a3:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024a8:	89 d8                	mov    %ebx,%eax
+  8024aa:	f7 e2                	mul    %edx
+  8024ac:	c1 ea 0c             	shr    $0xc,%edx
+  8024af:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024b5:	39 d3                	cmp    %edx,%ebx
+  8024b7:	0f 95 c3             	setne  %bl
+  8024ba:	0f b6 db             	movzbl %bl,%ebx
+  8024bd:	eb b0                	jmp    80246f <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024bf:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024c2:	8b 01                	mov    (%ecx),%eax
+  8024c4:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024ca:	29 c6                	sub    %eax,%esi
+  8024cc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024d1:	89 f0                	mov    %esi,%eax
+  8024d3:	f7 e2                	mul    %edx
+  8024d5:	c1 ea 0c             	shr    $0xc,%edx
+  8024d8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024de:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024e0:	89 d8                	mov    %ebx,%eax
+  8024e2:	83 c8 04             	or     $0x4,%eax
+  8024e5:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8024eb:	0f 42 d8             	cmovb  %eax,%ebx
+  8024ee:	eb 87                	jmp    802477 <devpipe_poll+0x29>
+
+008024f0 <pipe>:
+{
+  8024f0:	55                   	push   %ebp
+  8024f1:	89 e5                	mov    %esp,%ebp
+  8024f3:	56                   	push   %esi
+  8024f4:	53                   	push   %ebx
+  8024f5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024fb:	50                   	push   %eax
+  8024fc:	e8 38 e1 ff ff       	call   800639 <fd_alloc>
+  802501:	89 c3                	mov    %eax,%ebx
+  802503:	83 c4 10             	add    $0x10,%esp
+  802506:	85 c0                	test   %eax,%eax
+  802508:	0f 88 23 01 00 00    	js     802631 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80250e:	83 ec 04             	sub    $0x4,%esp
+  802511:	68 07 04 00 00       	push   $0x407
+  802516:	ff 75 f4             	push   -0xc(%ebp)
+  802519:	6a 00                	push   $0x0
+  80251b:	e8 8f dc ff ff       	call   8001af <sys_page_alloc>
+  802520:	89 c3                	mov    %eax,%ebx
+  802522:	83 c4 10             	add    $0x10,%esp
+  802525:	85 c0                	test   %eax,%eax
+  802527:	0f 88 04 01 00 00    	js     802631 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80252d:	83 ec 0c             	sub    $0xc,%esp
+  802530:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802533:	50                   	push   %eax
+  802534:	e8 00 e1 ff ff       	call   800639 <fd_alloc>
+  802539:	89 c3                	mov    %eax,%ebx
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	0f 88 db 00 00 00    	js     802621 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802546:	83 ec 04             	sub    $0x4,%esp
+  802549:	68 07 04 00 00       	push   $0x407
+  80254e:	ff 75 f0             	push   -0x10(%ebp)
+  802551:	6a 00                	push   $0x0
+  802553:	e8 57 dc ff ff       	call   8001af <sys_page_alloc>
+  802558:	89 c3                	mov    %eax,%ebx
+  80255a:	83 c4 10             	add    $0x10,%esp
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	0f 88 bc 00 00 00    	js     802621 <pipe+0x131>
+	va = fd2data(fd0);
+  802565:	83 ec 0c             	sub    $0xc,%esp
+  802568:	ff 75 f4             	push   -0xc(%ebp)
+  80256b:	e8 b2 e0 ff ff       	call   800622 <fd2data>
+  802570:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802572:	83 c4 0c             	add    $0xc,%esp
+  802575:	68 07 04 00 00       	push   $0x407
+  80257a:	50                   	push   %eax
+  80257b:	6a 00                	push   $0x0
+  80257d:	e8 2d dc ff ff       	call   8001af <sys_page_alloc>
+  802582:	89 c3                	mov    %eax,%ebx
+  802584:	83 c4 10             	add    $0x10,%esp
+  802587:	85 c0                	test   %eax,%eax
+  802589:	0f 88 82 00 00 00    	js     802611 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80258f:	83 ec 0c             	sub    $0xc,%esp
+  802592:	ff 75 f0             	push   -0x10(%ebp)
+  802595:	e8 88 e0 ff ff       	call   800622 <fd2data>
+  80259a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025a1:	50                   	push   %eax
+  8025a2:	6a 00                	push   $0x0
+  8025a4:	56                   	push   %esi
+  8025a5:	6a 00                	push   $0x0
+  8025a7:	e8 46 dc ff ff       	call   8001f2 <sys_page_map>
+  8025ac:	89 c3                	mov    %eax,%ebx
+  8025ae:	83 c4 20             	add    $0x20,%esp
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	78 4e                	js     802603 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025b5:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025bd:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025bf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025c9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025cc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025d1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025d8:	83 ec 0c             	sub    $0xc,%esp
+  8025db:	ff 75 f4             	push   -0xc(%ebp)
+  8025de:	e8 2f e0 ff ff       	call   800612 <fd2num>
+  8025e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025e6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025e8:	83 c4 04             	add    $0x4,%esp
+  8025eb:	ff 75 f0             	push   -0x10(%ebp)
+  8025ee:	e8 1f e0 ff ff       	call   800612 <fd2num>
+  8025f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025f6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025f9:	83 c4 10             	add    $0x10,%esp
+  8025fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802601:	eb 2e                	jmp    802631 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802603:	83 ec 08             	sub    $0x8,%esp
+  802606:	56                   	push   %esi
+  802607:	6a 00                	push   $0x0
+  802609:	e8 26 dc ff ff       	call   800234 <sys_page_unmap>
+  80260e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802611:	83 ec 08             	sub    $0x8,%esp
+  802614:	ff 75 f0             	push   -0x10(%ebp)
+  802617:	6a 00                	push   $0x0
+  802619:	e8 16 dc ff ff       	call   800234 <sys_page_unmap>
+  80261e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802621:	83 ec 08             	sub    $0x8,%esp
+  802624:	ff 75 f4             	push   -0xc(%ebp)
+  802627:	6a 00                	push   $0x0
+  802629:	e8 06 dc ff ff       	call   800234 <sys_page_unmap>
+  80262e:	83 c4 10             	add    $0x10,%esp
+}
+  802631:	89 d8                	mov    %ebx,%eax
+  802633:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802636:	5b                   	pop    %ebx
+  802637:	5e                   	pop    %esi
+  802638:	5d                   	pop    %ebp
+  802639:	c3                   	ret
+
+0080263a <pipeisclosed>:
+{
+  80263a:	55                   	push   %ebp
+  80263b:	89 e5                	mov    %esp,%ebp
+  80263d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802640:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802643:	50                   	push   %eax
+  802644:	ff 75 08             	push   0x8(%ebp)
+  802647:	e8 3d e0 ff ff       	call   800689 <fd_lookup>
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	85 c0                	test   %eax,%eax
+  802651:	78 18                	js     80266b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802653:	83 ec 0c             	sub    $0xc,%esp
+  802656:	ff 75 f4             	push   -0xc(%ebp)
+  802659:	e8 c4 df ff ff       	call   800622 <fd2data>
+  80265e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802660:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802663:	e8 e6 f9 ff ff       	call   80204e <_pipeisclosed>
+  802668:	83 c4 10             	add    $0x10,%esp
+}
+  80266b:	c9                   	leave
+  80266c:	c3                   	ret
+
+0080266d <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80266d:	55                   	push   %ebp
+  80266e:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  802670:	8b 45 08             	mov    0x8(%ebp),%eax
+  802673:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802679:	5d                   	pop    %ebp
+  80267a:	c3                   	ret
+
+0080267b <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	53                   	push   %ebx
+  80267f:	83 ec 04             	sub    $0x4,%esp
+  802682:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802685:	8b 03                	mov    (%ebx),%eax
+  802687:	85 c0                	test   %eax,%eax
+  802689:	75 05                	jne    802690 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80268b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80268e:	c9                   	leave
+  80268f:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  802690:	83 ec 08             	sub    $0x8,%esp
+  802693:	50                   	push   %eax
+  802694:	8d 43 04             	lea    0x4(%ebx),%eax
+  802697:	50                   	push   %eax
+  802698:	e8 e7 dd ff ff       	call   800484 <sys_page_batch>
+	pb->pb_n = 0;
+  80269d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	eb e3                	jmp    80268b <pgbatch_flush+0x10>
+
+008026a8 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8026a8:	55                   	push   %ebp
+  8026a9:	89 e5                	mov    %esp,%ebp
+  8026ab:	56                   	push   %esi
+  8026ac:	53                   	push   %ebx
+  8026ad:	89 c3                	mov    %eax,%ebx
+  8026af:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026b1:	83 38 20             	cmpl   $0x20,(%eax)
+  8026b4:	74 2c                	je     8026e2 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026b6:	8b 03                	mov    (%ebx),%eax
+  8026b8:	8d 50 01             	lea    0x1(%eax),%edx
+  8026bb:	89 13                	mov    %edx,(%ebx)
+  8026bd:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026c0:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026c4:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026c6:	83 ec 04             	sub    $0x4,%esp
+  8026c9:	6a 18                	push   $0x18
+  8026cb:	6a 00                	push   $0x0
+  8026cd:	50                   	push   %eax
+  8026ce:	e8 64 0c 00 00       	call   803337 <memset>
+	return 0;
+  8026d3:	83 c4 10             	add    $0x10,%esp
+  8026d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026de:	5b                   	pop    %ebx
+  8026df:	5e                   	pop    %esi
+  8026e0:	5d                   	pop    %ebp
+  8026e1:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026e2:	83 ec 0c             	sub    $0xc,%esp
+  8026e5:	50                   	push   %eax
+  8026e6:	e8 90 ff ff ff       	call   80267b <pgbatch_flush>
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	85 c0                	test   %eax,%eax
+  8026f0:	79 c4                	jns    8026b6 <pgbatch_slot+0xe>
+  8026f2:	eb e7                	jmp    8026db <pgbatch_slot+0x33>
+
+008026f4 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8026f4:	55                   	push   %ebp
+  8026f5:	89 e5                	mov    %esp,%ebp
+  8026f7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8026fa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802700:	e8 a3 ff ff ff       	call   8026a8 <pgbatch_slot>
+  802705:	85 c0                	test   %eax,%eax
+  802707:	78 20                	js     802729 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  802709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80270c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  802712:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802715:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802718:	8b 55 10             	mov    0x10(%ebp),%edx
+  80271b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80271e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802721:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802724:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+
+0080272b <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80272b:	55                   	push   %ebp
+  80272c:	89 e5                	mov    %esp,%ebp
+  80272e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802731:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802734:	8b 45 08             	mov    0x8(%ebp),%eax
+  802737:	e8 6c ff ff ff       	call   8026a8 <pgbatch_slot>
+  80273c:	85 c0                	test   %eax,%eax
+  80273e:	78 2c                	js     80276c <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  802740:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802743:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802749:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80274c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80274f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802752:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802755:	8b 55 14             	mov    0x14(%ebp),%edx
+  802758:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80275b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80275e:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  802761:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802764:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802767:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+0080276e <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80276e:	55                   	push   %ebp
+  80276f:	89 e5                	mov    %esp,%ebp
+  802771:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802774:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802777:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277a:	e8 29 ff ff ff       	call   8026a8 <pgbatch_slot>
+  80277f:	85 c0                	test   %eax,%eax
+  802781:	78 1a                	js     80279d <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  802783:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802786:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80278c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80278f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802792:	8b 55 10             	mov    0x10(%ebp),%edx
+  802795:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  802798:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80279d:	c9                   	leave
+  80279e:	c3                   	ret
+
+0080279f <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027a5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ab:	e8 f8 fe ff ff       	call   8026a8 <pgbatch_slot>
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	78 20                	js     8027d4 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b7:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027c0:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027c3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027c6:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027c9:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027cc:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+
+008027d6 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027d6:	55                   	push   %ebp
+  8027d7:	89 e5                	mov    %esp,%ebp
+  8027d9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027dc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e2:	e8 c1 fe ff ff       	call   8026a8 <pgbatch_slot>
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	78 26                	js     802811 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8027eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027ee:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8027f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027f7:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8027fa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027fd:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802800:	8b 55 14             	mov    0x14(%ebp),%edx
+  802803:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  802806:	8b 55 18             	mov    0x18(%ebp),%edx
+  802809:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80280c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802811:	c9                   	leave
+  802812:	c3                   	ret
+
+00802813 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802813:	b8 00 00 00 00       	mov    $0x0,%eax
+  802818:	c3                   	ret
+
+00802819 <devcons_poll>:
+{
+  802819:	55                   	push   %ebp
+  80281a:	89 e5                	mov    %esp,%ebp
+  80281c:	53                   	push   %ebx
+  80281d:	83 ec 04             	sub    $0x4,%esp
+  802820:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802823:	89 da                	mov    %ebx,%edx
+  802825:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802828:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80282f:	74 0c                	je     80283d <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802831:	89 d8                	mov    %ebx,%eax
+  802833:	83 e0 01             	and    $0x1,%eax
+  802836:	09 d0                	or     %edx,%eax
+}
+  802838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80283b:	c9                   	leave
+  80283c:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80283d:	e8 cf d8 ff ff       	call   800111 <sys_cgetc>
+  802842:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802847:	89 da                	mov    %ebx,%edx
+  802849:	83 e2 04             	and    $0x4,%edx
+  80284c:	85 c0                	test   %eax,%eax
+  80284e:	74 e6                	je     802836 <devcons_poll+0x1d>
+  802850:	eb df                	jmp    802831 <devcons_poll+0x18>
+
+00802852 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802852:	55                   	push   %ebp
+  802853:	89 e5                	mov    %esp,%ebp
+  802855:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802858:	68 e2 3b 80 00       	push   $0x803be2
+  80285d:	ff 75 0c             	push   0xc(%ebp)
+  802860:	e8 57 09 00 00       	call   8031bc <strcpy>
+	return 0;
+}
+  802865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286a:	c9                   	leave
+  80286b:	c3                   	ret
+
+0080286c <devcons_write>:
+{
+  80286c:	55                   	push   %ebp
+  80286d:	89 e5                	mov    %esp,%ebp
+  80286f:	57                   	push   %edi
+  802870:	56                   	push   %esi
+  802871:	53                   	push   %ebx
+  802872:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802878:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80287b:	85 ff                	test   %edi,%edi
+  80287d:	74 51                	je     8028d0 <devcons_write+0x64>
+  80287f:	be 00 00 00 00       	mov    $0x0,%esi
+  802884:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  802889:	89 fb                	mov    %edi,%ebx
+  80288b:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80288d:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802892:	39 d3                	cmp    %edx,%ebx
+  802894:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802897:	83 ec 04             	sub    $0x4,%esp
+  80289a:	53                   	push   %ebx
+  80289b:	03 45 0c             	add    0xc(%ebp),%eax
+  80289e:	50                   	push   %eax
+  80289f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028a5:	50                   	push   %eax
+  8028a6:	e8 c1 0a 00 00       	call   80336c <memmove>
+		sys_cputs(buf, m);
+  8028ab:	83 c4 08             	add    $0x8,%esp
+  8028ae:	53                   	push   %ebx
+  8028af:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028b5:	50                   	push   %eax
+  8028b6:	e8 38 d8 ff ff       	call   8000f3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028bb:	01 de                	add    %ebx,%esi
+  8028bd:	89 f0                	mov    %esi,%eax
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  8028c2:	39 fe                	cmp    %edi,%esi
+  8028c4:	72 c3                	jb     802889 <devcons_write+0x1d>
+}
+  8028c6:	89 f0                	mov    %esi,%eax
+  8028c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028cb:	5b                   	pop    %ebx
+  8028cc:	5e                   	pop    %esi
+  8028cd:	5f                   	pop    %edi
+  8028ce:	5d                   	pop    %ebp
+  8028cf:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028d0:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028d5:	eb ef                	jmp    8028c6 <devcons_write+0x5a>
+
+008028d7 <devcons_read>:
+{
+  8028d7:	55                   	push   %ebp
+  8028d8:	89 e5                	mov    %esp,%ebp
+  8028da:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028e2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028e6:	74 36                	je     80291e <devcons_read+0x47>
+	c = cons_peek;
+  8028e8:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8028ed:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8028f4:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	75 10                	jne    80290b <devcons_read+0x34>
+  8028fb:	e8 11 d8 ff ff       	call   800111 <sys_cgetc>
+  802900:	85 c0                	test   %eax,%eax
+  802902:	75 07                	jne    80290b <devcons_read+0x34>
+		sys_yield();
+  802904:	e8 87 d8 ff ff       	call   800190 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  802909:	eb f0                	jmp    8028fb <devcons_read+0x24>
+	if (c < 0)
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	78 0f                	js     80291e <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80290f:	83 f8 04             	cmp    $0x4,%eax
+  802912:	74 0c                	je     802920 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802914:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802917:	88 02                	mov    %al,(%edx)
+	return 1;
+  802919:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80291e:	c9                   	leave
+  80291f:	c3                   	ret
+		return 0;
+  802920:	b8 00 00 00 00       	mov    $0x0,%eax
+  802925:	eb f7                	jmp    80291e <devcons_read+0x47>
+
+00802927 <cputchar>:
+{
+  802927:	55                   	push   %ebp
+  802928:	89 e5                	mov    %esp,%ebp
+  80292a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80292d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802930:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802933:	6a 01                	push   $0x1
+  802935:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802938:	50                   	push   %eax
+  802939:	e8 b5 d7 ff ff       	call   8000f3 <sys_cputs>
+}
+  80293e:	83 c4 10             	add    $0x10,%esp
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+00802943 <getchar>:
+{
+  802943:	55                   	push   %ebp
+  802944:	89 e5                	mov    %esp,%ebp
+  802946:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802949:	6a 01                	push   $0x1
+  80294b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80294e:	50                   	push   %eax
+  80294f:	6a 00                	push   $0x0
+  802951:	e8 b7 df ff ff       	call   80090d <read>
+	if (r < 0)
+  802956:	83 c4 10             	add    $0x10,%esp
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	78 06                	js     802963 <getchar+0x20>
+	if (r < 1)
+  80295d:	74 06                	je     802965 <getchar+0x22>
+	return c;
+  80295f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802963:	c9                   	leave
+  802964:	c3                   	ret
+		return -E_EOF;
+  802965:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80296a:	eb f7                	jmp    802963 <getchar+0x20>
+
+0080296c <iscons>:
+{
+  80296c:	55                   	push   %ebp
+  80296d:	89 e5                	mov    %esp,%ebp
+  80296f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802972:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802975:	50                   	push   %eax
+  802976:	ff 75 08             	push   0x8(%ebp)
+  802979:	e8 0b dd ff ff       	call   800689 <fd_lookup>
+  80297e:	83 c4 10             	add    $0x10,%esp
+  802981:	85 c0                	test   %eax,%eax
+  802983:	78 11                	js     802996 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802985:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802988:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80298e:	39 10                	cmp    %edx,(%eax)
+  802990:	0f 94 c0             	sete   %al
+  802993:	0f b6 c0             	movzbl %al,%eax
+}
+  802996:	c9                   	leave
+  802997:	c3                   	ret
+
+00802998 <opencons>:
+{
+  802998:	55                   	push   %ebp
+  802999:	89 e5                	mov    %esp,%ebp
+  80299b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80299e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029a1:	50                   	push   %eax
+  8029a2:	e8 92 dc ff ff       	call   800639 <fd_alloc>
+  8029a7:	83 c4 10             	add    $0x10,%esp
+  8029aa:	85 c0                	test   %eax,%eax
+  8029ac:	78 3a                	js     8029e8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029ae:	83 ec 04             	sub    $0x4,%esp
+  8029b1:	68 07 04 00 00       	push   $0x407
+  8029b6:	ff 75 f4             	push   -0xc(%ebp)
+  8029b9:	6a 00                	push   $0x0
+  8029bb:	e8 ef d7 ff ff       	call   8001af <sys_page_alloc>
+  8029c0:	83 c4 10             	add    $0x10,%esp
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 21                	js     8029e8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ca:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029d0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029dc:	83 ec 0c             	sub    $0xc,%esp
+  8029df:	50                   	push   %eax
+  8029e0:	e8 2d dc ff ff       	call   800612 <fd2num>
+  8029e5:	83 c4 10             	add    $0x10,%esp
+}
+  8029e8:	c9                   	leave
+  8029e9:	c3                   	ret
+
+008029ea <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029ea:	55                   	push   %ebp
+  8029eb:	89 e5                	mov    %esp,%ebp
+  8029ed:	56                   	push   %esi
+  8029ee:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029ef:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029f2:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8029f8:	e8 74 d7 ff ff       	call   800171 <sys_getenvid>
+  8029fd:	83 ec 0c             	sub    $0xc,%esp
+  802a00:	ff 75 0c             	push   0xc(%ebp)
+  802a03:	ff 75 08             	push   0x8(%ebp)
+  802a06:	56                   	push   %esi
+  802a07:	50                   	push   %eax
+  802a08:	68 f0 3b 80 00       	push   $0x803bf0
+  802a0d:	e8 b3 00 00 00       	call   802ac5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802a12:	83 c4 18             	add    $0x18,%esp
+  802a15:	53                   	push   %ebx
+  802a16:	ff 75 10             	push   0x10(%ebp)
+  802a19:	e8 56 00 00 00       	call   802a74 <vcprintf>
+	cprintf("\n");
+  802a1e:	c7 04 24 d4 3b 80 00 	movl   $0x803bd4,(%esp)
+  802a25:	e8 9b 00 00 00       	call   802ac5 <cprintf>
+  802a2a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a2d:	cc                   	int3
+	while (1)
+  802a2e:	eb fd                	jmp    802a2d <_panic+0x43>
+
+00802a30 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a30:	55                   	push   %ebp
+  802a31:	89 e5                	mov    %esp,%ebp
+  802a33:	53                   	push   %ebx
+  802a34:	83 ec 04             	sub    $0x4,%esp
+  802a37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a3a:	8b 13                	mov    (%ebx),%edx
+  802a3c:	8d 42 01             	lea    0x1(%edx),%eax
+  802a3f:	89 03                	mov    %eax,(%ebx)
+  802a41:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a44:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a48:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a4d:	74 09                	je     802a58 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a4f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a56:	c9                   	leave
+  802a57:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a58:	83 ec 08             	sub    $0x8,%esp
+  802a5b:	68 ff 00 00 00       	push   $0xff
+  802a60:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a63:	50                   	push   %eax
+  802a64:	e8 8a d6 ff ff       	call   8000f3 <sys_cputs>
+		b->idx = 0;
+  802a69:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a6f:	83 c4 10             	add    $0x10,%esp
+  802a72:	eb db                	jmp    802a4f <putch+0x1f>
+
+00802a74 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a74:	55                   	push   %ebp
+  802a75:	89 e5                	mov    %esp,%ebp
+  802a77:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a7d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a84:	00 00 00 
+	b.cnt = 0;
+  802a87:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802a8e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802a91:	ff 75 0c             	push   0xc(%ebp)
+  802a94:	ff 75 08             	push   0x8(%ebp)
+  802a97:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802a9d:	50                   	push   %eax
+  802a9e:	68 30 2a 80 00       	push   $0x802a30
+  802aa3:	e8 1c 01 00 00       	call   802bc4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802aa8:	83 c4 08             	add    $0x8,%esp
+  802aab:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802ab1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802ab7:	50                   	push   %eax
+  802ab8:	e8 36 d6 ff ff       	call   8000f3 <sys_cputs>
+
+	return b.cnt;
+}
+  802abd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802acb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802ace:	50                   	push   %eax
+  802acf:	ff 75 08             	push   0x8(%ebp)
+  802ad2:	e8 9d ff ff ff       	call   802a74 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802ad7:	c9                   	leave
+  802ad8:	c3                   	ret
+
+00802ad9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802ad9:	55                   	push   %ebp
+  802ada:	89 e5                	mov    %esp,%ebp
+  802adc:	57                   	push   %edi
+  802add:	56                   	push   %esi
+  802ade:	53                   	push   %ebx
+  802adf:	83 ec 1c             	sub    $0x1c,%esp
+  802ae2:	89 c3                	mov    %eax,%ebx
+  802ae4:	89 d6                	mov    %edx,%esi
+  802ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aec:	89 d1                	mov    %edx,%ecx
+  802aee:	89 c2                	mov    %eax,%edx
+  802af0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802af3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802af6:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802af9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802afc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b03:	39 c2                	cmp    %eax,%edx
+  802b05:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802b08:	73 4b                	jae    802b55 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802b0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b0d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b10:	85 ff                	test   %edi,%edi
+  802b12:	7e 11                	jle    802b25 <printnum+0x4c>
+			putch(padc, putdat);
+  802b14:	83 ec 08             	sub    $0x8,%esp
+  802b17:	56                   	push   %esi
+  802b18:	ff 75 18             	push   0x18(%ebp)
+  802b1b:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b1d:	83 c4 10             	add    $0x10,%esp
+  802b20:	83 ef 01             	sub    $0x1,%edi
+  802b23:	75 ef                	jne    802b14 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b25:	83 ec 08             	sub    $0x8,%esp
+  802b28:	56                   	push   %esi
+  802b29:	83 ec 04             	sub    $0x4,%esp
+  802b2c:	ff 75 e4             	push   -0x1c(%ebp)
+  802b2f:	ff 75 e0             	push   -0x20(%ebp)
+  802b32:	ff 75 dc             	push   -0x24(%ebp)
+  802b35:	ff 75 d8             	push   -0x28(%ebp)
+  802b38:	e8 33 0e 00 00       	call   803970 <__umoddi3>
+  802b3d:	83 c4 14             	add    $0x14,%esp
+  802b40:	0f be 80 13 3c 80 00 	movsbl 0x803c13(%eax),%eax
+  802b47:	50                   	push   %eax
+  802b48:	ff d3                	call   *%ebx
+}
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b50:	5b                   	pop    %ebx
+  802b51:	5e                   	pop    %esi
+  802b52:	5f                   	pop    %edi
+  802b53:	5d                   	pop    %ebp
+  802b54:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b55:	83 ec 0c             	sub    $0xc,%esp
+  802b58:	ff 75 18             	push   0x18(%ebp)
+  802b5b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b5e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b61:	52                   	push   %edx
+  802b62:	50                   	push   %eax
+  802b63:	83 ec 08             	sub    $0x8,%esp
+  802b66:	ff 75 e4             	push   -0x1c(%ebp)
+  802b69:	ff 75 e0             	push   -0x20(%ebp)
+  802b6c:	ff 75 dc             	push   -0x24(%ebp)
+  802b6f:	ff 75 d8             	push   -0x28(%ebp)
+  802b72:	e8 33 0d 00 00       	call   8038aa <__udivdi3>
+  802b77:	83 c4 18             	add    $0x18,%esp
+  802b7a:	52                   	push   %edx
+  802b7b:	50                   	push   %eax
+  802b7c:	89 f2                	mov    %esi,%edx
+  802b7e:	89 d8                	mov    %ebx,%eax
+  802b80:	e8 54 ff ff ff       	call   802ad9 <printnum>
+  802b85:	83 c4 20             	add    $0x20,%esp
+  802b88:	eb 9b                	jmp    802b25 <printnum+0x4c>
+
+00802b8a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802b90:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802b94:	8b 10                	mov    (%eax),%edx
+  802b96:	3b 50 04             	cmp    0x4(%eax),%edx
+  802b99:	73 0a                	jae    802ba5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802b9b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802b9e:	89 08                	mov    %ecx,(%eax)
+  802ba0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba3:	88 02                	mov    %al,(%edx)
+}
+  802ba5:	5d                   	pop    %ebp
+  802ba6:	c3                   	ret
+
+00802ba7 <printfmt>:
+{
+  802ba7:	55                   	push   %ebp
+  802ba8:	89 e5                	mov    %esp,%ebp
+  802baa:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802bad:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802bb0:	50                   	push   %eax
+  802bb1:	ff 75 10             	push   0x10(%ebp)
+  802bb4:	ff 75 0c             	push   0xc(%ebp)
+  802bb7:	ff 75 08             	push   0x8(%ebp)
+  802bba:	e8 05 00 00 00       	call   802bc4 <vprintfmt>
+}
+  802bbf:	83 c4 10             	add    $0x10,%esp
+  802bc2:	c9                   	leave
+  802bc3:	c3                   	ret
+
+00802bc4 <vprintfmt>:
+{
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	57                   	push   %edi
+  802bc8:	56                   	push   %esi
+  802bc9:	53                   	push   %ebx
+  802bca:	83 ec 2c             	sub    $0x2c,%esp
+  802bcd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bd0:	89 df                	mov    %ebx,%edi
+  802bd2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bd5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd8:	8d 70 01             	lea    0x1(%eax),%esi
+  802bdb:	0f b6 00             	movzbl (%eax),%eax
+  802bde:	83 f8 25             	cmp    $0x25,%eax
+  802be1:	74 1e                	je     802c01 <vprintfmt+0x3d>
+			if (ch == '\0')
+  802be3:	85 c0                	test   %eax,%eax
+  802be5:	0f 84 15 05 00 00    	je     803100 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802beb:	83 ec 08             	sub    $0x8,%esp
+  802bee:	53                   	push   %ebx
+  802bef:	50                   	push   %eax
+  802bf0:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bf2:	83 c6 01             	add    $0x1,%esi
+  802bf5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802bf9:	83 c4 10             	add    $0x10,%esp
+  802bfc:	83 f8 25             	cmp    $0x25,%eax
+  802bff:	75 e2                	jne    802be3 <vprintfmt+0x1f>
+		padc = ' ';
+  802c01:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802c05:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802c0c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802c13:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c1f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c22:	8d 56 01             	lea    0x1(%esi),%edx
+  802c25:	0f b6 0e             	movzbl (%esi),%ecx
+  802c28:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c2b:	3c 55                	cmp    $0x55,%al
+  802c2d:	0f 87 3b 04 00 00    	ja     80306e <vprintfmt+0x4aa>
+  802c33:	0f b6 c0             	movzbl %al,%eax
+  802c36:	ff 24 85 80 3d 80 00 	jmp    *0x803d80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c3d:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c40:	eb 93                	jmp    802bd5 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c42:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c44:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c48:	eb d8                	jmp    802c22 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c4a:	89 d6                	mov    %edx,%esi
+  802c4c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c50:	eb d0                	jmp    802c22 <vprintfmt+0x5e>
+  802c52:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c55:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c58:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c5b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c5f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c62:	83 f9 09             	cmp    $0x9,%ecx
+  802c65:	77 6f                	ja     802cd6 <vprintfmt+0x112>
+  802c67:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c6a:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c6d:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c70:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c74:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c77:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c7a:	83 fe 09             	cmp    $0x9,%esi
+  802c7d:	76 eb                	jbe    802c6a <vprintfmt+0xa6>
+  802c7f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c82:	89 d6                	mov    %edx,%esi
+  802c84:	eb 13                	jmp    802c99 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802c86:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c89:	8b 00                	mov    (%eax),%eax
+  802c8b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c91:	8d 40 04             	lea    0x4(%eax),%eax
+  802c94:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c97:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802c99:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802c9d:	79 83                	jns    802c22 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802c9f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ca2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ca5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802cac:	e9 71 ff ff ff       	jmp    802c22 <vprintfmt+0x5e>
+			if (width < 0)
+  802cb1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802cb4:	85 c9                	test   %ecx,%ecx
+  802cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbb:	0f 49 c1             	cmovns %ecx,%eax
+  802cbe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc1:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802cc3:	e9 5a ff ff ff       	jmp    802c22 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc8:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cca:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cd1:	e9 4c ff ff ff       	jmp    802c22 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cd6:	89 d6                	mov    %edx,%esi
+  802cd8:	eb bf                	jmp    802c99 <vprintfmt+0xd5>
+			lflag++;
+  802cda:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cde:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802ce0:	e9 3d ff ff ff       	jmp    802c22 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802ce5:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ce8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ceb:	8d 70 04             	lea    0x4(%eax),%esi
+  802cee:	83 ec 08             	sub    $0x8,%esp
+  802cf1:	53                   	push   %ebx
+  802cf2:	ff 30                	push   (%eax)
+  802cf4:	ff d7                	call   *%edi
+			break;
+  802cf6:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802cf9:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802cfc:	e9 d4 fe ff ff       	jmp    802bd5 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802d01:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d04:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d07:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802d0a:	8b 10                	mov    (%eax),%edx
+  802d0c:	89 d0                	mov    %edx,%eax
+  802d0e:	f7 d8                	neg    %eax
+  802d10:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802d13:	83 f8 12             	cmp    $0x12,%eax
+  802d16:	7f 23                	jg     802d3b <vprintfmt+0x177>
+  802d18:	8b 14 85 e0 3e 80 00 	mov    0x803ee0(,%eax,4),%edx
+  802d1f:	85 d2                	test   %edx,%edx
+  802d21:	74 18                	je     802d3b <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d23:	52                   	push   %edx
+  802d24:	68 9f 3b 80 00       	push   $0x803b9f
+  802d29:	53                   	push   %ebx
+  802d2a:	57                   	push   %edi
+  802d2b:	e8 77 fe ff ff       	call   802ba7 <printfmt>
+  802d30:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d33:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d36:	e9 9a fe ff ff       	jmp    802bd5 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d3b:	50                   	push   %eax
+  802d3c:	68 2b 3c 80 00       	push   $0x803c2b
+  802d41:	53                   	push   %ebx
+  802d42:	57                   	push   %edi
+  802d43:	e8 5f fe ff ff       	call   802ba7 <printfmt>
+  802d48:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d4b:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d4e:	e9 82 fe ff ff       	jmp    802bd5 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d53:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d56:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d59:	83 c0 04             	add    $0x4,%eax
+  802d5c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d62:	8b 00                	mov    (%eax),%eax
+  802d64:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d67:	85 c0                	test   %eax,%eax
+  802d69:	0f 84 61 03 00 00    	je     8030d0 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d6f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d73:	7e 06                	jle    802d7b <vprintfmt+0x1b7>
+  802d75:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d79:	75 29                	jne    802da4 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d7b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d7e:	8d 70 01             	lea    0x1(%eax),%esi
+  802d81:	0f b6 00             	movzbl (%eax),%eax
+  802d84:	0f be d0             	movsbl %al,%edx
+  802d87:	85 d2                	test   %edx,%edx
+  802d89:	0f 84 bb 00 00 00    	je     802e4a <vprintfmt+0x286>
+  802d8f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802d92:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802d95:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802d98:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d9b:	eb 7a                	jmp    802e17 <vprintfmt+0x253>
+				p = "(null)";
+  802d9d:	c7 45 d0 24 3c 80 00 	movl   $0x803c24,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802da4:	83 ec 08             	sub    $0x8,%esp
+  802da7:	ff 75 d4             	push   -0x2c(%ebp)
+  802daa:	ff 75 d0             	push   -0x30(%ebp)
+  802dad:	e8 e0 03 00 00       	call   803192 <strnlen>
+  802db2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802db5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802db8:	83 c4 10             	add    $0x10,%esp
+  802dbb:	85 d2                	test   %edx,%edx
+  802dbd:	0f 8e d6 02 00 00    	jle    803099 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802dc3:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802dc7:	83 ec 08             	sub    $0x8,%esp
+  802dca:	53                   	push   %ebx
+  802dcb:	56                   	push   %esi
+  802dcc:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dce:	83 c4 10             	add    $0x10,%esp
+  802dd1:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802dd5:	75 f0                	jne    802dc7 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dd7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dda:	8d 70 01             	lea    0x1(%eax),%esi
+  802ddd:	0f b6 00             	movzbl (%eax),%eax
+  802de0:	0f be d0             	movsbl %al,%edx
+  802de3:	85 d2                	test   %edx,%edx
+  802de5:	0f 84 da 02 00 00    	je     8030c5 <vprintfmt+0x501>
+  802deb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802dee:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802df1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802df4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802df7:	eb 1e                	jmp    802e17 <vprintfmt+0x253>
+					putch(ch, putdat);
+  802df9:	83 ec 08             	sub    $0x8,%esp
+  802dfc:	ff 75 0c             	push   0xc(%ebp)
+  802dff:	52                   	push   %edx
+  802e00:	ff 55 08             	call   *0x8(%ebp)
+  802e03:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802e06:	83 eb 01             	sub    $0x1,%ebx
+  802e09:	83 c6 01             	add    $0x1,%esi
+  802e0c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e10:	0f be d0             	movsbl %al,%edx
+  802e13:	85 d2                	test   %edx,%edx
+  802e15:	74 2a                	je     802e41 <vprintfmt+0x27d>
+  802e17:	85 ff                	test   %edi,%edi
+  802e19:	78 05                	js     802e20 <vprintfmt+0x25c>
+  802e1b:	83 ef 01             	sub    $0x1,%edi
+  802e1e:	78 59                	js     802e79 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e20:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e24:	74 d3                	je     802df9 <vprintfmt+0x235>
+  802e26:	0f be c0             	movsbl %al,%eax
+  802e29:	83 e8 20             	sub    $0x20,%eax
+  802e2c:	83 f8 5e             	cmp    $0x5e,%eax
+  802e2f:	76 c8                	jbe    802df9 <vprintfmt+0x235>
+					putch('?', putdat);
+  802e31:	83 ec 08             	sub    $0x8,%esp
+  802e34:	ff 75 0c             	push   0xc(%ebp)
+  802e37:	6a 3f                	push   $0x3f
+  802e39:	ff 55 08             	call   *0x8(%ebp)
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	eb c5                	jmp    802e06 <vprintfmt+0x242>
+  802e41:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e44:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e4a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e4d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e51:	7e 1b                	jle    802e6e <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e53:	83 ec 08             	sub    $0x8,%esp
+  802e56:	53                   	push   %ebx
+  802e57:	6a 20                	push   $0x20
+  802e59:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e5b:	83 c4 10             	add    $0x10,%esp
+  802e5e:	83 ee 01             	sub    $0x1,%esi
+  802e61:	75 f0                	jne    802e53 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e63:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e66:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e69:	e9 67 fd ff ff       	jmp    802bd5 <vprintfmt+0x11>
+  802e6e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e71:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e74:	e9 5c fd ff ff       	jmp    802bd5 <vprintfmt+0x11>
+  802e79:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e82:	eb c6                	jmp    802e4a <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e84:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802e87:	89 55 10             	mov    %edx,0x10(%ebp)
+  802e8a:	83 f9 01             	cmp    $0x1,%ecx
+  802e8d:	7f 1f                	jg     802eae <vprintfmt+0x2ea>
+	else if (lflag)
+  802e8f:	85 c9                	test   %ecx,%ecx
+  802e91:	74 67                	je     802efa <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802e93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e96:	8b 30                	mov    (%eax),%esi
+  802e98:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802e9b:	89 f0                	mov    %esi,%eax
+  802e9d:	c1 f8 1f             	sar    $0x1f,%eax
+  802ea0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802ea3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea6:	8d 40 04             	lea    0x4(%eax),%eax
+  802ea9:	89 45 14             	mov    %eax,0x14(%ebp)
+  802eac:	eb 17                	jmp    802ec5 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802eae:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eb1:	8b 50 04             	mov    0x4(%eax),%edx
+  802eb4:	8b 00                	mov    (%eax),%eax
+  802eb6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802eb9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802ebc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ebf:	8d 40 08             	lea    0x8(%eax),%eax
+  802ec2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802ec5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ec8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802ecb:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802ed0:	85 c9                	test   %ecx,%ecx
+  802ed2:	0f 89 12 01 00 00    	jns    802fea <vprintfmt+0x426>
+				putch('-', putdat);
+  802ed8:	83 ec 08             	sub    $0x8,%esp
+  802edb:	53                   	push   %ebx
+  802edc:	6a 2d                	push   $0x2d
+  802ede:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802ee0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ee3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ee6:	f7 da                	neg    %edx
+  802ee8:	83 d1 00             	adc    $0x0,%ecx
+  802eeb:	f7 d9                	neg    %ecx
+  802eed:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802ef0:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ef5:	e9 f0 00 00 00       	jmp    802fea <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802efa:	8b 45 14             	mov    0x14(%ebp),%eax
+  802efd:	8b 30                	mov    (%eax),%esi
+  802eff:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f02:	89 f0                	mov    %esi,%eax
+  802f04:	c1 f8 1f             	sar    $0x1f,%eax
+  802f07:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f0d:	8d 40 04             	lea    0x4(%eax),%eax
+  802f10:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f13:	eb b0                	jmp    802ec5 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f15:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f18:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f1b:	83 f9 01             	cmp    $0x1,%ecx
+  802f1e:	7f 1e                	jg     802f3e <vprintfmt+0x37a>
+	else if (lflag)
+  802f20:	85 c9                	test   %ecx,%ecx
+  802f22:	74 32                	je     802f56 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f24:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f27:	8b 10                	mov    (%eax),%edx
+  802f29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f2e:	8d 40 04             	lea    0x4(%eax),%eax
+  802f31:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f34:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f39:	e9 ac 00 00 00       	jmp    802fea <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f41:	8b 10                	mov    (%eax),%edx
+  802f43:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f46:	8d 40 08             	lea    0x8(%eax),%eax
+  802f49:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f4c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f51:	e9 94 00 00 00       	jmp    802fea <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f56:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f59:	8b 10                	mov    (%eax),%edx
+  802f5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f60:	8d 40 04             	lea    0x4(%eax),%eax
+  802f63:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f66:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f6b:	eb 7d                	jmp    802fea <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f6d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f70:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f73:	83 f9 01             	cmp    $0x1,%ecx
+  802f76:	7f 1b                	jg     802f93 <vprintfmt+0x3cf>
+	else if (lflag)
+  802f78:	85 c9                	test   %ecx,%ecx
+  802f7a:	74 2c                	je     802fa8 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f7f:	8b 10                	mov    (%eax),%edx
+  802f81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f86:	8d 40 04             	lea    0x4(%eax),%eax
+  802f89:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f8c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802f91:	eb 57                	jmp    802fea <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f96:	8b 10                	mov    (%eax),%edx
+  802f98:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f9b:	8d 40 08             	lea    0x8(%eax),%eax
+  802f9e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fa1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802fa6:	eb 42                	jmp    802fea <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802fa8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fab:	8b 10                	mov    (%eax),%edx
+  802fad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fb2:	8d 40 04             	lea    0x4(%eax),%eax
+  802fb5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fb8:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fbd:	eb 2b                	jmp    802fea <vprintfmt+0x426>
+			putch('0', putdat);
+  802fbf:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fc2:	83 ec 08             	sub    $0x8,%esp
+  802fc5:	53                   	push   %ebx
+  802fc6:	6a 30                	push   $0x30
+  802fc8:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fca:	83 c4 08             	add    $0x8,%esp
+  802fcd:	53                   	push   %ebx
+  802fce:	6a 78                	push   $0x78
+  802fd0:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fd5:	8b 10                	mov    (%eax),%edx
+  802fd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802fdc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802fdf:	8d 40 04             	lea    0x4(%eax),%eax
+  802fe2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802fe5:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  802fea:	83 ec 0c             	sub    $0xc,%esp
+  802fed:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802ff1:	50                   	push   %eax
+  802ff2:	ff 75 e4             	push   -0x1c(%ebp)
+  802ff5:	56                   	push   %esi
+  802ff6:	51                   	push   %ecx
+  802ff7:	52                   	push   %edx
+  802ff8:	89 da                	mov    %ebx,%edx
+  802ffa:	89 f8                	mov    %edi,%eax
+  802ffc:	e8 d8 fa ff ff       	call   802ad9 <printnum>
+			break;
+  803001:	83 c4 20             	add    $0x20,%esp
+  803004:	e9 cc fb ff ff       	jmp    802bd5 <vprintfmt+0x11>
+	if (lflag >= 2)
+  803009:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80300c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80300f:	83 f9 01             	cmp    $0x1,%ecx
+  803012:	7f 1b                	jg     80302f <vprintfmt+0x46b>
+	else if (lflag)
+  803014:	85 c9                	test   %ecx,%ecx
+  803016:	74 2c                	je     803044 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803018:	8b 45 14             	mov    0x14(%ebp),%eax
+  80301b:	8b 10                	mov    (%eax),%edx
+  80301d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803022:	8d 40 04             	lea    0x4(%eax),%eax
+  803025:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803028:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80302d:	eb bb                	jmp    802fea <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80302f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803032:	8b 10                	mov    (%eax),%edx
+  803034:	8b 48 04             	mov    0x4(%eax),%ecx
+  803037:	8d 40 08             	lea    0x8(%eax),%eax
+  80303a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80303d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  803042:	eb a6                	jmp    802fea <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803044:	8b 45 14             	mov    0x14(%ebp),%eax
+  803047:	8b 10                	mov    (%eax),%edx
+  803049:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80304e:	8d 40 04             	lea    0x4(%eax),%eax
+  803051:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803054:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  803059:	eb 8f                	jmp    802fea <vprintfmt+0x426>
+			putch(ch, putdat);
+  80305b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80305e:	83 ec 08             	sub    $0x8,%esp
+  803061:	53                   	push   %ebx
+  803062:	6a 25                	push   $0x25
+  803064:	ff d7                	call   *%edi
+			break;
+  803066:	83 c4 10             	add    $0x10,%esp
+  803069:	e9 67 fb ff ff       	jmp    802bd5 <vprintfmt+0x11>
+			putch('%', putdat);
+  80306e:	83 ec 08             	sub    $0x8,%esp
+  803071:	53                   	push   %ebx
+  803072:	6a 25                	push   $0x25
+  803074:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803076:	83 c4 10             	add    $0x10,%esp
+  803079:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80307d:	0f 84 ba fb ff ff    	je     802c3d <vprintfmt+0x79>
+  803083:	89 75 10             	mov    %esi,0x10(%ebp)
+  803086:	89 f0                	mov    %esi,%eax
+  803088:	83 e8 01             	sub    $0x1,%eax
+  80308b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80308f:	75 f7                	jne    803088 <vprintfmt+0x4c4>
+  803091:	89 45 10             	mov    %eax,0x10(%ebp)
+  803094:	e9 3c fb ff ff       	jmp    802bd5 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803099:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80309c:	8d 70 01             	lea    0x1(%eax),%esi
+  80309f:	0f b6 00             	movzbl (%eax),%eax
+  8030a2:	0f be d0             	movsbl %al,%edx
+  8030a5:	85 d2                	test   %edx,%edx
+  8030a7:	74 11                	je     8030ba <vprintfmt+0x4f6>
+  8030a9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030ac:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030af:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030b2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030b5:	e9 5d fd ff ff       	jmp    802e17 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030ba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030c0:	e9 10 fb ff ff       	jmp    802bd5 <vprintfmt+0x11>
+  8030c5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030cb:	e9 05 fb ff ff       	jmp    802bd5 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030d0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030d4:	7e 0a                	jle    8030e0 <vprintfmt+0x51c>
+  8030d6:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030da:	0f 85 bd fc ff ff    	jne    802d9d <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030e0:	ba 28 00 00 00       	mov    $0x28,%edx
+  8030e5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8030ea:	be 25 3c 80 00       	mov    $0x803c25,%esi
+  8030ef:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030f2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030f5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030f8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030fb:	e9 17 fd ff ff       	jmp    802e17 <vprintfmt+0x253>
+}
+  803100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803103:	5b                   	pop    %ebx
+  803104:	5e                   	pop    %esi
+  803105:	5f                   	pop    %edi
+  803106:	5d                   	pop    %ebp
+  803107:	c3                   	ret
+
+00803108 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803108:	55                   	push   %ebp
+  803109:	89 e5                	mov    %esp,%ebp
+  80310b:	83 ec 18             	sub    $0x18,%esp
+  80310e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803111:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803114:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803117:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80311b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80311e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803125:	85 c0                	test   %eax,%eax
+  803127:	74 26                	je     80314f <vsnprintf+0x47>
+  803129:	85 d2                	test   %edx,%edx
+  80312b:	7e 22                	jle    80314f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80312d:	ff 75 14             	push   0x14(%ebp)
+  803130:	ff 75 10             	push   0x10(%ebp)
+  803133:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803136:	50                   	push   %eax
+  803137:	68 8a 2b 80 00       	push   $0x802b8a
+  80313c:	e8 83 fa ff ff       	call   802bc4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803141:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803144:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803147:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80314a:	83 c4 10             	add    $0x10,%esp
+}
+  80314d:	c9                   	leave
+  80314e:	c3                   	ret
+		return -E_INVAL;
+  80314f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803154:	eb f7                	jmp    80314d <vsnprintf+0x45>
+
+00803156 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803156:	55                   	push   %ebp
+  803157:	89 e5                	mov    %esp,%ebp
+  803159:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80315c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80315f:	50                   	push   %eax
+  803160:	ff 75 10             	push   0x10(%ebp)
+  803163:	ff 75 0c             	push   0xc(%ebp)
+  803166:	ff 75 08             	push   0x8(%ebp)
+  803169:	e8 9a ff ff ff       	call   803108 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80316e:	c9                   	leave
+  80316f:	c3                   	ret
+
+00803170 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803170:	55                   	push   %ebp
+  803171:	89 e5                	mov    %esp,%ebp
+  803173:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803176:	80 3a 00             	cmpb   $0x0,(%edx)
+  803179:	74 10                	je     80318b <strlen+0x1b>
+  80317b:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  803180:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  803187:	75 f7                	jne    803180 <strlen+0x10>
+	return n;
+}
+  803189:	5d                   	pop    %ebp
+  80318a:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80318b:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  803190:	eb f7                	jmp    803189 <strlen+0x19>
+
+00803192 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803192:	55                   	push   %ebp
+  803193:	89 e5                	mov    %esp,%ebp
+  803195:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803198:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80319b:	85 d2                	test   %edx,%edx
+  80319d:	74 16                	je     8031b5 <strnlen+0x23>
+  80319f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8031a8:	74 09                	je     8031b3 <strnlen+0x21>
+		n++;
+  8031aa:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031ad:	39 d0                	cmp    %edx,%eax
+  8031af:	75 f3                	jne    8031a4 <strnlen+0x12>
+		n++;
+  8031b1:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8031b3:	5d                   	pop    %ebp
+  8031b4:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ba:	eb f7                	jmp    8031b3 <strnlen+0x21>
+
+008031bc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031bc:	55                   	push   %ebp
+  8031bd:	89 e5                	mov    %esp,%ebp
+  8031bf:	53                   	push   %ebx
+  8031c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031cb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031cf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031d2:	83 c0 01             	add    $0x1,%eax
+  8031d5:	84 d2                	test   %dl,%dl
+  8031d7:	75 f2                	jne    8031cb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031d9:	89 c8                	mov    %ecx,%eax
+  8031db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031de:	c9                   	leave
+  8031df:	c3                   	ret
+
+008031e0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031e0:	55                   	push   %ebp
+  8031e1:	89 e5                	mov    %esp,%ebp
+  8031e3:	53                   	push   %ebx
+  8031e4:	83 ec 10             	sub    $0x10,%esp
+  8031e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8031ea:	53                   	push   %ebx
+  8031eb:	e8 80 ff ff ff       	call   803170 <strlen>
+  8031f0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8031f3:	ff 75 0c             	push   0xc(%ebp)
+  8031f6:	01 d8                	add    %ebx,%eax
+  8031f8:	50                   	push   %eax
+  8031f9:	e8 be ff ff ff       	call   8031bc <strcpy>
+	return dst;
+}
+  8031fe:	89 d8                	mov    %ebx,%eax
+  803200:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803203:	c9                   	leave
+  803204:	c3                   	ret
+
+00803205 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803205:	55                   	push   %ebp
+  803206:	89 e5                	mov    %esp,%ebp
+  803208:	56                   	push   %esi
+  803209:	53                   	push   %ebx
+  80320a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80320d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803210:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  803213:	85 db                	test   %ebx,%ebx
+  803215:	74 17                	je     80322e <strncpy+0x29>
+  803217:	01 f3                	add    %esi,%ebx
+  803219:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80321b:	83 c0 01             	add    $0x1,%eax
+  80321e:	0f b6 0a             	movzbl (%edx),%ecx
+  803221:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803224:	80 f9 01             	cmp    $0x1,%cl
+  803227:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80322a:	39 c3                	cmp    %eax,%ebx
+  80322c:	75 ed                	jne    80321b <strncpy+0x16>
+	}
+	return ret;
+}
+  80322e:	89 f0                	mov    %esi,%eax
+  803230:	5b                   	pop    %ebx
+  803231:	5e                   	pop    %esi
+  803232:	5d                   	pop    %ebp
+  803233:	c3                   	ret
+
+00803234 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803234:	55                   	push   %ebp
+  803235:	89 e5                	mov    %esp,%ebp
+  803237:	56                   	push   %esi
+  803238:	53                   	push   %ebx
+  803239:	8b 75 08             	mov    0x8(%ebp),%esi
+  80323c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80323f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803242:	89 f0                	mov    %esi,%eax
+  803244:	85 db                	test   %ebx,%ebx
+  803246:	74 1e                	je     803266 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  803248:	83 eb 01             	sub    $0x1,%ebx
+  80324b:	74 16                	je     803263 <strlcpy+0x2f>
+  80324d:	01 f3                	add    %esi,%ebx
+  80324f:	0f b6 0a             	movzbl (%edx),%ecx
+  803252:	84 c9                	test   %cl,%cl
+  803254:	74 0d                	je     803263 <strlcpy+0x2f>
+			*dst++ = *src++;
+  803256:	83 c2 01             	add    $0x1,%edx
+  803259:	83 c0 01             	add    $0x1,%eax
+  80325c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80325f:	39 d8                	cmp    %ebx,%eax
+  803261:	75 ec                	jne    80324f <strlcpy+0x1b>
+		*dst = '\0';
+  803263:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803266:	29 f0                	sub    %esi,%eax
+}
+  803268:	5b                   	pop    %ebx
+  803269:	5e                   	pop    %esi
+  80326a:	5d                   	pop    %ebp
+  80326b:	c3                   	ret
+
+0080326c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80326c:	55                   	push   %ebp
+  80326d:	89 e5                	mov    %esp,%ebp
+  80326f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803272:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803275:	0f b6 01             	movzbl (%ecx),%eax
+  803278:	84 c0                	test   %al,%al
+  80327a:	74 11                	je     80328d <strcmp+0x21>
+  80327c:	38 02                	cmp    %al,(%edx)
+  80327e:	75 0d                	jne    80328d <strcmp+0x21>
+		p++, q++;
+  803280:	83 c1 01             	add    $0x1,%ecx
+  803283:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803286:	0f b6 01             	movzbl (%ecx),%eax
+  803289:	84 c0                	test   %al,%al
+  80328b:	75 ef                	jne    80327c <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80328d:	0f b6 c0             	movzbl %al,%eax
+  803290:	0f b6 12             	movzbl (%edx),%edx
+  803293:	29 d0                	sub    %edx,%eax
+}
+  803295:	5d                   	pop    %ebp
+  803296:	c3                   	ret
+
+00803297 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803297:	55                   	push   %ebp
+  803298:	89 e5                	mov    %esp,%ebp
+  80329a:	53                   	push   %ebx
+  80329b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80329e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8032a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8032a4:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8032a9:	85 d2                	test   %edx,%edx
+  8032ab:	74 2e                	je     8032db <strncmp+0x44>
+  8032ad:	0f b6 01             	movzbl (%ecx),%eax
+  8032b0:	84 c0                	test   %al,%al
+  8032b2:	74 16                	je     8032ca <strncmp+0x33>
+  8032b4:	3a 03                	cmp    (%ebx),%al
+  8032b6:	75 12                	jne    8032ca <strncmp+0x33>
+		n--, p++, q++;
+  8032b8:	83 c1 01             	add    $0x1,%ecx
+  8032bb:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032be:	83 ea 01             	sub    $0x1,%edx
+  8032c1:	75 ea                	jne    8032ad <strncmp+0x16>
+		return 0;
+  8032c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c8:	eb 11                	jmp    8032db <strncmp+0x44>
+  8032ca:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032cf:	85 d2                	test   %edx,%edx
+  8032d1:	74 08                	je     8032db <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032d3:	0f b6 01             	movzbl (%ecx),%eax
+  8032d6:	0f b6 13             	movzbl (%ebx),%edx
+  8032d9:	29 d0                	sub    %edx,%eax
+}
+  8032db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032de:	c9                   	leave
+  8032df:	c3                   	ret
+
+008032e0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032e0:	55                   	push   %ebp
+  8032e1:	89 e5                	mov    %esp,%ebp
+  8032e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8032ea:	0f b6 10             	movzbl (%eax),%edx
+  8032ed:	84 d2                	test   %dl,%dl
+  8032ef:	74 15                	je     803306 <strchr+0x26>
+		if (*s == c)
+  8032f1:	38 d1                	cmp    %dl,%cl
+  8032f3:	74 0f                	je     803304 <strchr+0x24>
+	for (; *s; s++)
+  8032f5:	83 c0 01             	add    $0x1,%eax
+  8032f8:	0f b6 10             	movzbl (%eax),%edx
+  8032fb:	84 d2                	test   %dl,%dl
+  8032fd:	75 f2                	jne    8032f1 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8032ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803304:	5d                   	pop    %ebp
+  803305:	c3                   	ret
+	return 0;
+  803306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330b:	eb f7                	jmp    803304 <strchr+0x24>
+
+0080330d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80330d:	55                   	push   %ebp
+  80330e:	89 e5                	mov    %esp,%ebp
+  803310:	53                   	push   %ebx
+  803311:	8b 45 08             	mov    0x8(%ebp),%eax
+  803314:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  803317:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  80331a:	38 d3                	cmp    %dl,%bl
+  80331c:	74 14                	je     803332 <strfind+0x25>
+  80331e:	89 d1                	mov    %edx,%ecx
+  803320:	84 db                	test   %bl,%bl
+  803322:	74 0e                	je     803332 <strfind+0x25>
+	for (; *s; s++)
+  803324:	83 c0 01             	add    $0x1,%eax
+  803327:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80332a:	38 ca                	cmp    %cl,%dl
+  80332c:	74 04                	je     803332 <strfind+0x25>
+  80332e:	84 d2                	test   %dl,%dl
+  803330:	75 f2                	jne    803324 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  803332:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803335:	c9                   	leave
+  803336:	c3                   	ret
+
+00803337 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803337:	55                   	push   %ebp
+  803338:	89 e5                	mov    %esp,%ebp
+  80333a:	57                   	push   %edi
+  80333b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80333e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  803341:	85 c9                	test   %ecx,%ecx
+  803343:	74 20                	je     803365 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803345:	89 f8                	mov    %edi,%eax
+  803347:	09 c8                	or     %ecx,%eax
+  803349:	a8 03                	test   $0x3,%al
+  80334b:	75 12                	jne    80335f <memset+0x28>
+		c &= 0xFF;
+  80334d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803351:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803357:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80335a:	fc                   	cld
+  80335b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80335d:	eb 06                	jmp    803365 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80335f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803362:	fc                   	cld
+  803363:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803365:	89 f8                	mov    %edi,%eax
+  803367:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80336a:	c9                   	leave
+  80336b:	c3                   	ret
+
+0080336c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80336c:	55                   	push   %ebp
+  80336d:	89 e5                	mov    %esp,%ebp
+  80336f:	57                   	push   %edi
+  803370:	56                   	push   %esi
+  803371:	8b 45 08             	mov    0x8(%ebp),%eax
+  803374:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80337a:	39 c6                	cmp    %eax,%esi
+  80337c:	73 32                	jae    8033b0 <memmove+0x44>
+  80337e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803381:	39 d0                	cmp    %edx,%eax
+  803383:	73 2b                	jae    8033b0 <memmove+0x44>
+		s += n;
+		d += n;
+  803385:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803388:	89 d6                	mov    %edx,%esi
+  80338a:	09 fe                	or     %edi,%esi
+  80338c:	09 ce                	or     %ecx,%esi
+  80338e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803394:	75 0e                	jne    8033a4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803396:	83 ef 04             	sub    $0x4,%edi
+  803399:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80339c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80339f:	fd                   	std
+  8033a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033a2:	eb 09                	jmp    8033ad <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8033a4:	83 ef 01             	sub    $0x1,%edi
+  8033a7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8033aa:	fd                   	std
+  8033ab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8033ad:	fc                   	cld
+  8033ae:	eb 1a                	jmp    8033ca <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8033b0:	89 f2                	mov    %esi,%edx
+  8033b2:	09 c2                	or     %eax,%edx
+  8033b4:	09 ca                	or     %ecx,%edx
+  8033b6:	f6 c2 03             	test   $0x3,%dl
+  8033b9:	75 0a                	jne    8033c5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033bb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033be:	89 c7                	mov    %eax,%edi
+  8033c0:	fc                   	cld
+  8033c1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033c3:	eb 05                	jmp    8033ca <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033c5:	89 c7                	mov    %eax,%edi
+  8033c7:	fc                   	cld
+  8033c8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033ca:	5e                   	pop    %esi
+  8033cb:	5f                   	pop    %edi
+  8033cc:	5d                   	pop    %ebp
+  8033cd:	c3                   	ret
+
+008033ce <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033ce:	55                   	push   %ebp
+  8033cf:	89 e5                	mov    %esp,%ebp
+  8033d1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033d4:	ff 75 10             	push   0x10(%ebp)
+  8033d7:	ff 75 0c             	push   0xc(%ebp)
+  8033da:	ff 75 08             	push   0x8(%ebp)
+  8033dd:	e8 8a ff ff ff       	call   80336c <memmove>
+}
+  8033e2:	c9                   	leave
+  8033e3:	c3                   	ret
+
+008033e4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033e4:	55                   	push   %ebp
+  8033e5:	89 e5                	mov    %esp,%ebp
+  8033e7:	56                   	push   %esi
+  8033e8:	53                   	push   %ebx
+  8033e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033ef:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8033f2:	85 f6                	test   %esi,%esi
+  8033f4:	74 29                	je     80341f <memcmp+0x3b>
+  8033f6:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8033f8:	0f b6 08             	movzbl (%eax),%ecx
+  8033fb:	0f b6 1a             	movzbl (%edx),%ebx
+  8033fe:	38 d9                	cmp    %bl,%cl
+  803400:	75 11                	jne    803413 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803402:	83 c0 01             	add    $0x1,%eax
+  803405:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803408:	39 c6                	cmp    %eax,%esi
+  80340a:	75 ec                	jne    8033f8 <memcmp+0x14>
+	}
+
+	return 0;
+  80340c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803411:	eb 08                	jmp    80341b <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  803413:	0f b6 c1             	movzbl %cl,%eax
+  803416:	0f b6 db             	movzbl %bl,%ebx
+  803419:	29 d8                	sub    %ebx,%eax
+}
+  80341b:	5b                   	pop    %ebx
+  80341c:	5e                   	pop    %esi
+  80341d:	5d                   	pop    %ebp
+  80341e:	c3                   	ret
+	return 0;
+  80341f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803424:	eb f5                	jmp    80341b <memcmp+0x37>
+
+00803426 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803426:	55                   	push   %ebp
+  803427:	89 e5                	mov    %esp,%ebp
+  803429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80342c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80342f:	89 c2                	mov    %eax,%edx
+  803431:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803434:	39 d0                	cmp    %edx,%eax
+  803436:	73 0d                	jae    803445 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803438:	38 08                	cmp    %cl,(%eax)
+  80343a:	74 0d                	je     803449 <memfind+0x23>
+	for (; s < ends; s++)
+  80343c:	83 c0 01             	add    $0x1,%eax
+  80343f:	39 c2                	cmp    %eax,%edx
+  803441:	75 f5                	jne    803438 <memfind+0x12>
+  803443:	eb 06                	jmp    80344b <memfind+0x25>
+  803445:	89 c2                	mov    %eax,%edx
+  803447:	eb 02                	jmp    80344b <memfind+0x25>
+  803449:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  80344b:	89 d0                	mov    %edx,%eax
+  80344d:	5d                   	pop    %ebp
+  80344e:	c3                   	ret
+
+0080344f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80344f:	55                   	push   %ebp
+  803450:	89 e5                	mov    %esp,%ebp
+  803452:	57                   	push   %edi
+  803453:	56                   	push   %esi
+  803454:	53                   	push   %ebx
+  803455:	8b 55 08             	mov    0x8(%ebp),%edx
+  803458:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80345b:	0f b6 02             	movzbl (%edx),%eax
+  80345e:	3c 20                	cmp    $0x20,%al
+  803460:	74 04                	je     803466 <strtol+0x17>
+  803462:	3c 09                	cmp    $0x9,%al
+  803464:	75 0e                	jne    803474 <strtol+0x25>
+		s++;
+  803466:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803469:	0f b6 02             	movzbl (%edx),%eax
+  80346c:	3c 20                	cmp    $0x20,%al
+  80346e:	74 f6                	je     803466 <strtol+0x17>
+  803470:	3c 09                	cmp    $0x9,%al
+  803472:	74 f2                	je     803466 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  803474:	3c 2b                	cmp    $0x2b,%al
+  803476:	74 2a                	je     8034a2 <strtol+0x53>
+	int neg = 0;
+  803478:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80347d:	3c 2d                	cmp    $0x2d,%al
+  80347f:	74 2b                	je     8034ac <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803481:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803487:	75 0f                	jne    803498 <strtol+0x49>
+  803489:	80 3a 30             	cmpb   $0x30,(%edx)
+  80348c:	74 28                	je     8034b6 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80348e:	85 db                	test   %ebx,%ebx
+  803490:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803495:	0f 44 d8             	cmove  %eax,%ebx
+  803498:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80349d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8034a0:	eb 46                	jmp    8034e8 <strtol+0x99>
+		s++;
+  8034a2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8034a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034aa:	eb d5                	jmp    803481 <strtol+0x32>
+		s++, neg = 1;
+  8034ac:	83 c2 01             	add    $0x1,%edx
+  8034af:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034b4:	eb cb                	jmp    803481 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034b6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034ba:	74 0e                	je     8034ca <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034bc:	85 db                	test   %ebx,%ebx
+  8034be:	75 d8                	jne    803498 <strtol+0x49>
+		s++, base = 8;
+  8034c0:	83 c2 01             	add    $0x1,%edx
+  8034c3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034c8:	eb ce                	jmp    803498 <strtol+0x49>
+		s += 2, base = 16;
+  8034ca:	83 c2 02             	add    $0x2,%edx
+  8034cd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034d2:	eb c4                	jmp    803498 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034d4:	0f be c0             	movsbl %al,%eax
+  8034d7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034da:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034dd:	7d 3a                	jge    803519 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034df:	83 c2 01             	add    $0x1,%edx
+  8034e2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8034e6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8034e8:	0f b6 02             	movzbl (%edx),%eax
+  8034eb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8034ee:	89 f3                	mov    %esi,%ebx
+  8034f0:	80 fb 09             	cmp    $0x9,%bl
+  8034f3:	76 df                	jbe    8034d4 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8034f5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8034f8:	89 f3                	mov    %esi,%ebx
+  8034fa:	80 fb 19             	cmp    $0x19,%bl
+  8034fd:	77 08                	ja     803507 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8034ff:	0f be c0             	movsbl %al,%eax
+  803502:	83 e8 57             	sub    $0x57,%eax
+  803505:	eb d3                	jmp    8034da <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  803507:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80350a:	89 f3                	mov    %esi,%ebx
+  80350c:	80 fb 19             	cmp    $0x19,%bl
+  80350f:	77 08                	ja     803519 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  803511:	0f be c0             	movsbl %al,%eax
+  803514:	83 e8 37             	sub    $0x37,%eax
+  803517:	eb c1                	jmp    8034da <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803519:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80351d:	74 05                	je     803524 <strtol+0xd5>
+		*endptr = (char *) s;
+  80351f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803522:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803524:	89 c8                	mov    %ecx,%eax
+  803526:	f7 d8                	neg    %eax
+  803528:	85 ff                	test   %edi,%edi
+  80352a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80352d:	89 c8                	mov    %ecx,%eax
+  80352f:	5b                   	pop    %ebx
+  803530:	5e                   	pop    %esi
+  803531:	5f                   	pop    %edi
+  803532:	5d                   	pop    %ebp
+  803533:	c3                   	ret
+
+00803534 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803534:	55                   	push   %ebp
+  803535:	89 e5                	mov    %esp,%ebp
+  803537:	56                   	push   %esi
+  803538:	53                   	push   %ebx
+  803539:	8b 75 08             	mov    0x8(%ebp),%esi
+  80353c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80353f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803542:	85 c0                	test   %eax,%eax
+  803544:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803549:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80354c:	83 ec 0c             	sub    $0xc,%esp
+  80354f:	50                   	push   %eax
+  803550:	e8 0a ce ff ff       	call   80035f <sys_ipc_recv>
+  803555:	83 c4 10             	add    $0x10,%esp
+  803558:	85 c0                	test   %eax,%eax
+  80355a:	0f 88 8b 00 00 00    	js     8035eb <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803560:	85 f6                	test   %esi,%esi
+  803562:	74 2a                	je     80358e <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803564:	89 e2                	mov    %esp,%edx
+  803566:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80356b:	29 d0                	sub    %edx,%eax
+  80356d:	89 c2                	mov    %eax,%edx
+  80356f:	c1 ea 0f             	shr    $0xf,%edx
+  803572:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80357f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803586:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80358c:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80358e:	85 db                	test   %ebx,%ebx
+  803590:	74 2a                	je     8035bc <ipc_recv+0x88>
+  803592:	89 e2                	mov    %esp,%edx
+  803594:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803599:	29 d0                	sub    %edx,%eax
+  80359b:	89 c2                	mov    %eax,%edx
+  80359d:	c1 ea 0f             	shr    $0xf,%edx
+  8035a0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035aa:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8035ad:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035b4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035ba:	89 03                	mov    %eax,(%ebx)
+  8035bc:	89 e2                	mov    %esp,%edx
+  8035be:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035c3:	29 d0                	sub    %edx,%eax
+  8035c5:	89 c2                	mov    %eax,%edx
+  8035c7:	c1 ea 0f             	shr    $0xf,%edx
+  8035ca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035d7:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035de:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035e7:	5b                   	pop    %ebx
+  8035e8:	5e                   	pop    %esi
+  8035e9:	5d                   	pop    %ebp
+  8035ea:	c3                   	ret
+		if(from_env_store != NULL)
+  8035eb:	85 f6                	test   %esi,%esi
+  8035ed:	74 06                	je     8035f5 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035ef:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035f5:	85 db                	test   %ebx,%ebx
+  8035f7:	74 eb                	je     8035e4 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035f9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8035ff:	eb e3                	jmp    8035e4 <ipc_recv+0xb0>
+
+00803601 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803601:	55                   	push   %ebp
+  803602:	89 e5                	mov    %esp,%ebp
+  803604:	57                   	push   %edi
+  803605:	56                   	push   %esi
+  803606:	53                   	push   %ebx
+  803607:	83 ec 14             	sub    $0x14,%esp
+  80360a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80360d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803610:	8b 75 14             	mov    0x14(%ebp),%esi
+  803613:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803616:	85 c0                	test   %eax,%eax
+  803618:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80361d:	0f 44 c2             	cmove  %edx,%eax
+  803620:	ff 75 10             	push   0x10(%ebp)
+  803623:	50                   	push   %eax
+  803624:	e8 98 cd ff ff       	call   8003c1 <sys_ipc_recv_pages>
+  803629:	83 c4 10             	add    $0x10,%esp
+  80362c:	85 c0                	test   %eax,%eax
+  80362e:	0f 88 ba 00 00 00    	js     8036ee <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803634:	85 ff                	test   %edi,%edi
+  803636:	74 2a                	je     803662 <ipc_recv_pages+0x61>
+  803638:	89 e2                	mov    %esp,%edx
+  80363a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80363f:	29 d0                	sub    %edx,%eax
+  803641:	89 c2                	mov    %eax,%edx
+  803643:	c1 ea 0f             	shr    $0xf,%edx
+  803646:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80364b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803650:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803653:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80365a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803660:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803662:	85 f6                	test   %esi,%esi
+  803664:	74 2a                	je     803690 <ipc_recv_pages+0x8f>
+  803666:	89 e2                	mov    %esp,%edx
+  803668:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80366d:	29 d0                	sub    %edx,%eax
+  80366f:	89 c2                	mov    %eax,%edx
+  803671:	c1 ea 0f             	shr    $0xf,%edx
+  803674:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803681:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803688:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80368e:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803690:	85 db                	test   %ebx,%ebx
+  803692:	74 2a                	je     8036be <ipc_recv_pages+0xbd>
+  803694:	89 e2                	mov    %esp,%edx
+  803696:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80369b:	29 d0                	sub    %edx,%eax
+  80369d:	89 c2                	mov    %eax,%edx
+  80369f:	c1 ea 0f             	shr    $0xf,%edx
+  8036a2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ac:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8036af:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036b6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036bc:	89 03                	mov    %eax,(%ebx)
+  8036be:	89 e2                	mov    %esp,%edx
+  8036c0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036c5:	29 d0                	sub    %edx,%eax
+  8036c7:	89 c2                	mov    %eax,%edx
+  8036c9:	c1 ea 0f             	shr    $0xf,%edx
+  8036cc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d6:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036d9:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036e0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036e9:	5b                   	pop    %ebx
+  8036ea:	5e                   	pop    %esi
+  8036eb:	5f                   	pop    %edi
+  8036ec:	5d                   	pop    %ebp
+  8036ed:	c3                   	ret
+		if (from_env_store)
+  8036ee:	85 ff                	test   %edi,%edi
+  8036f0:	74 06                	je     8036f8 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036f2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036f8:	85 f6                	test   %esi,%esi
+  8036fa:	74 06                	je     803702 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8036fc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803702:	85 db                	test   %ebx,%ebx
+  803704:	74 e0                	je     8036e6 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803706:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80370c:	eb d8                	jmp    8036e6 <ipc_recv_pages+0xe5>
+
+0080370e <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80370e:	55                   	push   %ebp
+  80370f:	89 e5                	mov    %esp,%ebp
+  803711:	57                   	push   %edi
+  803712:	56                   	push   %esi
+  803713:	53                   	push   %ebx
+  803714:	83 ec 1c             	sub    $0x1c,%esp
+  803717:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80371a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80371d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803723:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803727:	75 2b                	jne    803754 <ipc_try_send_pages+0x46>
+  803729:	89 e2                	mov    %esp,%edx
+  80372b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803730:	29 d0                	sub    %edx,%eax
+  803732:	89 c2                	mov    %eax,%edx
+  803734:	c1 ea 0f             	shr    $0xf,%edx
+  803737:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80373c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803741:	0f 42 c2             	cmovb  %edx,%eax
+  803744:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80374b:	8b 70 48             	mov    0x48(%eax),%esi
+  80374e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803754:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80375a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80375f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803762:	85 ff                	test   %edi,%edi
+  803764:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803769:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80376c:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803772:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803778:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80377e:	83 ec 0c             	sub    $0xc,%esp
+  803781:	ff 75 14             	push   0x14(%ebp)
+  803784:	ff 75 18             	push   0x18(%ebp)
+  803787:	57                   	push   %edi
+  803788:	ff 75 0c             	push   0xc(%ebp)
+  80378b:	ff 75 08             	push   0x8(%ebp)
+  80378e:	e8 0d cc ff ff       	call   8003a0 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803793:	83 c4 20             	add    $0x20,%esp
+  803796:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803799:	75 21                	jne    8037bc <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80379b:	83 ec 04             	sub    $0x4,%esp
+  80379e:	6a ff                	push   $0xffffffff
+  8037a0:	53                   	push   %ebx
+  8037a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8037a4:	e8 04 ce ff ff       	call   8005ad <sys_futex_wait>
+  8037a9:	83 c4 10             	add    $0x10,%esp
+  8037ac:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8037af:	74 c7                	je     803778 <ipc_try_send_pages+0x6a>
+  8037b1:	85 c0                	test   %eax,%eax
+  8037b3:	79 c3                	jns    803778 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037b5:	e8 d6 c9 ff ff       	call   800190 <sys_yield>
+  8037ba:	eb bc                	jmp    803778 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037bf:	5b                   	pop    %ebx
+  8037c0:	5e                   	pop    %esi
+  8037c1:	5f                   	pop    %edi
+  8037c2:	5d                   	pop    %ebp
+  8037c3:	c3                   	ret
+
+008037c4 <ipc_send>:
+{
+  8037c4:	55                   	push   %ebp
+  8037c5:	89 e5                	mov    %esp,%ebp
+  8037c7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037ca:	ff 75 14             	push   0x14(%ebp)
+  8037cd:	6a 01                	push   $0x1
+  8037cf:	ff 75 10             	push   0x10(%ebp)
+  8037d2:	ff 75 0c             	push   0xc(%ebp)
+  8037d5:	ff 75 08             	push   0x8(%ebp)
+  8037d8:	e8 31 ff ff ff       	call   80370e <ipc_try_send_pages>
+  8037dd:	83 c4 20             	add    $0x20,%esp
+  8037e0:	85 c0                	test   %eax,%eax
+  8037e2:	78 02                	js     8037e6 <ipc_send+0x22>
+}
+  8037e4:	c9                   	leave
+  8037e5:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037e6:	50                   	push   %eax
+  8037e7:	68 4b 3f 80 00       	push   $0x803f4b
+  8037ec:	6a 3f                	push   $0x3f
+  8037ee:	68 60 3f 80 00       	push   $0x803f60
+  8037f3:	e8 f2 f1 ff ff       	call   8029ea <_panic>
+
+008037f8 <ipc_send_pages>:
+{
+  8037f8:	55                   	push   %ebp
+  8037f9:	89 e5                	mov    %esp,%ebp
+  8037fb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8037fe:	ff 75 18             	push   0x18(%ebp)
+  803801:	ff 75 14             	push   0x14(%ebp)
+  803804:	ff 75 10             	push   0x10(%ebp)
+  803807:	ff 75 0c             	push   0xc(%ebp)
+  80380a:	ff 75 08             	push   0x8(%ebp)
+  80380d:	e8 fc fe ff ff       	call   80370e <ipc_try_send_pages>
+  803812:	83 c4 20             	add    $0x20,%esp
+  803815:	85 c0                	test   %eax,%eax
+  803817:	78 02                	js     80381b <ipc_send_pages+0x23>
+}
+  803819:	c9                   	leave
+  80381a:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80381b:	50                   	push   %eax
+  80381c:	68 6a 3f 80 00       	push   $0x803f6a
+  803821:	6a 64                	push   $0x64
+  803823:	68 60 3f 80 00       	push   $0x803f60
+  803828:	e8 bd f1 ff ff       	call   8029ea <_panic>
+
+0080382d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80382d:	55                   	push   %ebp
+  80382e:	89 e5                	mov    %esp,%ebp
+  803830:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803833:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803838:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80383e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803844:	8b 52 50             	mov    0x50(%edx),%edx
+  803847:	39 ca                	cmp    %ecx,%edx
+  803849:	74 11                	je     80385c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80384b:	83 c0 01             	add    $0x1,%eax
+  80384e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803853:	75 e3                	jne    803838 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385a:	eb 0e                	jmp    80386a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80385c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803862:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803867:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80386a:	5d                   	pop    %ebp
+  80386b:	c3                   	ret
+
+0080386c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80386c:	55                   	push   %ebp
+  80386d:	89 e5                	mov    %esp,%ebp
+  80386f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803872:	89 c2                	mov    %eax,%edx
+  803874:	c1 ea 16             	shr    $0x16,%edx
+  803877:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80387e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803883:	f6 c1 01             	test   $0x1,%cl
+  803886:	74 1e                	je     8038a6 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803888:	c1 e8 0c             	shr    $0xc,%eax
+  80388b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803892:	a8 01                	test   $0x1,%al
+  803894:	74 10                	je     8038a6 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803896:	c1 e8 0c             	shr    $0xc,%eax
+  803899:	c1 e0 04             	shl    $0x4,%eax
+  80389c:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8038a3:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038a6:	89 d0                	mov    %edx,%eax
+  8038a8:	5d                   	pop    %ebp
+  8038a9:	c3                   	ret
+
+008038aa <__udivdi3>:
+  8038aa:	57                   	push   %edi
+  8038ab:	56                   	push   %esi
+  8038ac:	53                   	push   %ebx
+  8038ad:	83 ec 20             	sub    $0x20,%esp
+  8038b0:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038b4:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038b8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038bc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038c0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038c4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038c8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038cc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038d0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038df:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038e6:	00 
+  8038e7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038ee:	00 
+  8038ef:	eb 08                	jmp    8038f9 <__udivdi3+0x4f>
+  8038f1:	83 e9 01             	sub    $0x1,%ecx
+  8038f4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038f7:	74 68                	je     803961 <__udivdi3+0xb7>
+  8038f9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038fd:	01 c0                	add    %eax,%eax
+  8038ff:	89 c6                	mov    %eax,%esi
+  803901:	89 d7                	mov    %edx,%edi
+  803903:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803907:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80390b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80390e:	d3 ea                	shr    %cl,%edx
+  803910:	f6 c1 20             	test   $0x20,%cl
+  803913:	74 04                	je     803919 <__udivdi3+0x6f>
+  803915:	89 d0                	mov    %edx,%eax
+  803917:	31 d2                	xor    %edx,%edx
+  803919:	83 e0 01             	and    $0x1,%eax
+  80391c:	89 04 24             	mov    %eax,(%esp)
+  80391f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803926:	00 
+  803927:	8b 04 24             	mov    (%esp),%eax
+  80392a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80392e:	09 f0                	or     %esi,%eax
+  803930:	09 fa                	or     %edi,%edx
+  803932:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803936:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80393a:	39 f0                	cmp    %esi,%eax
+  80393c:	89 d3                	mov    %edx,%ebx
+  80393e:	19 fb                	sbb    %edi,%ebx
+  803940:	72 af                	jb     8038f1 <__udivdi3+0x47>
+  803942:	29 f0                	sub    %esi,%eax
+  803944:	19 fa                	sbb    %edi,%edx
+  803946:	89 cf                	mov    %ecx,%edi
+  803948:	c1 ef 05             	shr    $0x5,%edi
+  80394b:	83 e7 01             	and    $0x1,%edi
+  80394e:	89 fe                	mov    %edi,%esi
+  803950:	83 f6 01             	xor    $0x1,%esi
+  803953:	d3 e6                	shl    %cl,%esi
+  803955:	d3 e7                	shl    %cl,%edi
+  803957:	09 74 24 18          	or     %esi,0x18(%esp)
+  80395b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80395f:	eb 90                	jmp    8038f1 <__udivdi3+0x47>
+  803961:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803965:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803969:	83 c4 20             	add    $0x20,%esp
+  80396c:	5b                   	pop    %ebx
+  80396d:	5e                   	pop    %esi
+  80396e:	5f                   	pop    %edi
+  80396f:	c3                   	ret
+
+00803970 <__umoddi3>:
+  803970:	57                   	push   %edi
+  803971:	56                   	push   %esi
+  803972:	53                   	push   %ebx
+  803973:	83 ec 08             	sub    $0x8,%esp
+  803976:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80397a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80397e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803982:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803986:	57                   	push   %edi
+  803987:	56                   	push   %esi
+  803988:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80398c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803990:	52                   	push   %edx
+  803991:	50                   	push   %eax
+  803992:	e8 13 ff ff ff       	call   8038aa <__udivdi3>
+  803997:	89 c3                	mov    %eax,%ebx
+  803999:	0f af d6             	imul   %esi,%edx
+  80399c:	89 f9                	mov    %edi,%ecx
+  80399e:	0f af cb             	imul   %ebx,%ecx
+  8039a1:	01 d1                	add    %edx,%ecx
+  8039a3:	89 d8                	mov    %ebx,%eax
+  8039a5:	f7 e6                	mul    %esi
+  8039a7:	89 c6                	mov    %eax,%esi
+  8039a9:	89 d7                	mov    %edx,%edi
+  8039ab:	01 cf                	add    %ecx,%edi
+  8039ad:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8039b1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039b5:	29 f0                	sub    %esi,%eax
+  8039b7:	19 fa                	sbb    %edi,%edx
+  8039b9:	83 c4 18             	add    $0x18,%esp
+  8039bc:	5b                   	pop    %ebx
+  8039bd:	5e                   	pop    %esi
+  8039be:	5f                   	pop    %edi
+  8039bf:	c3                   	ret
+
+008039c0 <__divdi3>:
+  8039c0:	53                   	push   %ebx
+  8039c1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039c5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039c9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039cd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039d1:	85 d2                	test   %edx,%edx
+  8039d3:	78 12                	js     8039e7 <__divdi3+0x27>
+  8039d5:	85 db                	test   %ebx,%ebx
+  8039d7:	78 2e                	js     803a07 <__divdi3+0x47>
+  8039d9:	53                   	push   %ebx
+  8039da:	51                   	push   %ecx
+  8039db:	52                   	push   %edx
+  8039dc:	50                   	push   %eax
+  8039dd:	e8 c8 fe ff ff       	call   8038aa <__udivdi3>
+  8039e2:	83 c4 10             	add    $0x10,%esp
+  8039e5:	eb 1e                	jmp    803a05 <__divdi3+0x45>
+  8039e7:	f7 d8                	neg    %eax
+  8039e9:	83 d2 00             	adc    $0x0,%edx
+  8039ec:	f7 da                	neg    %edx
+  8039ee:	85 db                	test   %ebx,%ebx
+  8039f0:	78 2a                	js     803a1c <__divdi3+0x5c>
+  8039f2:	53                   	push   %ebx
+  8039f3:	51                   	push   %ecx
+  8039f4:	52                   	push   %edx
+  8039f5:	50                   	push   %eax
+  8039f6:	e8 af fe ff ff       	call   8038aa <__udivdi3>
+  8039fb:	83 c4 10             	add    $0x10,%esp
+  8039fe:	f7 d8                	neg    %eax
+  803a00:	83 d2 00             	adc    $0x0,%edx
+  803a03:	f7 da                	neg    %edx
+  803a05:	5b                   	pop    %ebx
+  803a06:	c3                   	ret
+  803a07:	f7 d9                	neg    %ecx
+  803a09:	83 d3 00             	adc    $0x0,%ebx
+  803a0c:	f7 db                	neg    %ebx
+  803a0e:	53                   	push   %ebx
+  803a0f:	51                   	push   %ecx
+  803a10:	52                   	push   %edx
+  803a11:	50                   	push   %eax
+  803a12:	e8 93 fe ff ff       	call   8038aa <__udivdi3>
+  803a17:	83 c4 10             	add    $0x10,%esp
+  803a1a:	eb e2                	jmp    8039fe <__divdi3+0x3e>
+  803a1c:	f7 d9                	neg    %ecx
+  803a1e:	83 d3 00             	adc    $0x0,%ebx
+  803a21:	f7 db                	neg    %ebx
+  803a23:	53                   	push   %ebx
+  803a24:	51                   	push   %ecx
+  803a25:	52                   	push   %edx
+  803a26:	50                   	push   %eax
+  803a27:	e8 7e fe ff ff       	call   8038aa <__udivdi3>
+  803a2c:	83 c4 10             	add    $0x10,%esp
+  803a2f:	eb d4                	jmp    803a05 <__divdi3+0x45>
+
+00803a31 <__moddi3>:
+  803a31:	57                   	push   %edi
+  803a32:	56                   	push   %esi
+  803a33:	53                   	push   %ebx
+  803a34:	83 ec 08             	sub    $0x8,%esp
+  803a37:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a3b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a3f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a43:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a47:	57                   	push   %edi
+  803a48:	56                   	push   %esi
+  803a49:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a4d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a51:	52                   	push   %edx
+  803a52:	50                   	push   %eax
+  803a53:	e8 68 ff ff ff       	call   8039c0 <__divdi3>
+  803a58:	89 c3                	mov    %eax,%ebx
+  803a5a:	0f af d6             	imul   %esi,%edx
+  803a5d:	89 f9                	mov    %edi,%ecx
+  803a5f:	0f af cb             	imul   %ebx,%ecx
+  803a62:	01 d1                	add    %edx,%ecx
+  803a64:	89 d8                	mov    %ebx,%eax
+  803a66:	f7 e6                	mul    %esi
+  803a68:	89 c6                	mov    %eax,%esi
+  803a6a:	89 d7                	mov    %edx,%edi
+  803a6c:	01 cf                	add    %ecx,%edi
+  803a6e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a72:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a76:	29 f0                	sub    %esi,%eax
+  803a78:	19 fa                	sbb    %edi,%edx
+  803a7a:	83 c4 18             	add    $0x18,%esp
+  803a7d:	5b                   	pop    %ebx
+  803a7e:	5e                   	pop    %esi
+  803a7f:	5f                   	pop    %edi
+  803a80:	c3                   	ret
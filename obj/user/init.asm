@@ -0,0 +1,8917 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 dd 03 00 00       	call   80040e <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i, tot = 0;
+	for (i = 0; i < n; i++)
+  800040:	85 db                	test   %ebx,%ebx
+  800042:	7e 20                	jle    800064 <sum+0x2f>
+	int i, tot = 0;
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < n; i++)
+  800049:	b8 00 00 00 00       	mov    $0x0,%eax
+		tot ^= i * s[i];
+  80004e:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  800052:	0f af d0             	imul   %eax,%edx
+  800055:	31 d1                	xor    %edx,%ecx
+	for (i = 0; i < n; i++)
+  800057:	83 c0 01             	add    $0x1,%eax
+  80005a:	39 c3                	cmp    %eax,%ebx
+  80005c:	75 f0                	jne    80004e <sum+0x19>
+	return tot;
+}
+  80005e:	89 c8                	mov    %ecx,%eax
+  800060:	5b                   	pop    %ebx
+  800061:	5e                   	pop    %esi
+  800062:	5d                   	pop    %ebp
+  800063:	c3                   	ret
+	int i, tot = 0;
+  800064:	b9 00 00 00 00       	mov    $0x0,%ecx
+	return tot;
+  800069:	eb f3                	jmp    80005e <sum+0x29>
+
+0080006b <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80006b:	55                   	push   %ebp
+  80006c:	89 e5                	mov    %esp,%ebp
+  80006e:	57                   	push   %edi
+  80006f:	56                   	push   %esi
+  800070:	53                   	push   %ebx
+  800071:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800077:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  80007a:	68 e0 45 80 00       	push   $0x8045e0
+  80007f:	e8 0c 05 00 00       	call   800590 <cprintf>
+
+	want = 0xf989e;
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  800084:	83 c4 08             	add    $0x8,%esp
+  800087:	68 70 17 00 00       	push   $0x1770
+  80008c:	68 00 50 80 00       	push   $0x805000
+  800091:	e8 9f ff ff ff       	call   800035 <sum>
+  800096:	83 c4 10             	add    $0x10,%esp
+  800099:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  80009e:	0f 84 eb 00 00 00    	je     80018f <umain+0x124>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  8000a4:	83 ec 04             	sub    $0x4,%esp
+  8000a7:	68 9e 98 0f 00       	push   $0xf989e
+  8000ac:	50                   	push   %eax
+  8000ad:	68 a8 46 80 00       	push   $0x8046a8
+  8000b2:	e8 d9 04 00 00       	call   800590 <cprintf>
+  8000b7:	83 c4 10             	add    $0x10,%esp
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+	if ((x = sum(bss, sizeof bss)) != 0)
+  8000ba:	83 ec 08             	sub    $0x8,%esp
+  8000bd:	68 70 17 00 00       	push   $0x1770
+  8000c2:	68 80 79 80 00       	push   $0x807980
+  8000c7:	e8 69 ff ff ff       	call   800035 <sum>
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	0f 84 cd 00 00 00    	je     8001a4 <umain+0x139>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000d7:	83 ec 08             	sub    $0x8,%esp
+  8000da:	50                   	push   %eax
+  8000db:	68 e4 46 80 00       	push   $0x8046e4
+  8000e0:	e8 ab 04 00 00       	call   800590 <cprintf>
+  8000e5:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("init: bss seems okay\n");
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  8000e8:	83 ec 08             	sub    $0x8,%esp
+  8000eb:	68 1c 46 80 00       	push   $0x80461c
+  8000f0:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000f6:	50                   	push   %eax
+  8000f7:	e8 af 0b 00 00       	call   800cab <strcat>
+	for (i = 0; i < argc; i++) {
+  8000fc:	83 c4 10             	add    $0x10,%esp
+  8000ff:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800103:	7e 3e                	jle    800143 <umain+0xd8>
+  800105:	bb 00 00 00 00       	mov    $0x0,%ebx
+		strcat(args, " '");
+  80010a:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800110:	83 ec 08             	sub    $0x8,%esp
+  800113:	68 28 46 80 00       	push   $0x804628
+  800118:	56                   	push   %esi
+  800119:	e8 8d 0b 00 00       	call   800cab <strcat>
+		strcat(args, argv[i]);
+  80011e:	83 c4 08             	add    $0x8,%esp
+  800121:	ff 34 9f             	push   (%edi,%ebx,4)
+  800124:	56                   	push   %esi
+  800125:	e8 81 0b 00 00       	call   800cab <strcat>
+		strcat(args, "'");
+  80012a:	83 c4 08             	add    $0x8,%esp
+  80012d:	68 29 46 80 00       	push   $0x804629
+  800132:	56                   	push   %esi
+  800133:	e8 73 0b 00 00       	call   800cab <strcat>
+	for (i = 0; i < argc; i++) {
+  800138:	83 c3 01             	add    $0x1,%ebx
+  80013b:	83 c4 10             	add    $0x10,%esp
+  80013e:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  800141:	75 cd                	jne    800110 <umain+0xa5>
+	}
+	cprintf("%s\n", args);
+  800143:	83 ec 08             	sub    $0x8,%esp
+  800146:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80014c:	50                   	push   %eax
+  80014d:	68 2b 46 80 00       	push   $0x80462b
+  800152:	e8 39 04 00 00       	call   800590 <cprintf>
+
+	cprintf("init: running sh\n");
+  800157:	c7 04 24 2f 46 80 00 	movl   $0x80462f,(%esp)
+  80015e:	e8 2d 04 00 00       	call   800590 <cprintf>
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800163:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80016a:	e8 6b 15 00 00       	call   8016da <close>
+	if ((r = opencons()) < 0)
+  80016f:	e8 48 02 00 00       	call   8003bc <opencons>
+  800174:	83 c4 10             	add    $0x10,%esp
+  800177:	85 c0                	test   %eax,%eax
+  800179:	78 3e                	js     8001b9 <umain+0x14e>
+		panic("opencons: %e", r);
+	if (r != 0)
+  80017b:	74 4e                	je     8001cb <umain+0x160>
+		panic("first opencons used fd %d", r);
+  80017d:	50                   	push   %eax
+  80017e:	68 5a 46 80 00       	push   $0x80465a
+  800183:	6a 39                	push   $0x39
+  800185:	68 4e 46 80 00       	push   $0x80464e
+  80018a:	e8 26 03 00 00       	call   8004b5 <_panic>
+		cprintf("init: data seems okay\n");
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	68 ef 45 80 00       	push   $0x8045ef
+  800197:	e8 f4 03 00 00       	call   800590 <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	e9 16 ff ff ff       	jmp    8000ba <umain+0x4f>
+		cprintf("init: bss seems okay\n");
+  8001a4:	83 ec 0c             	sub    $0xc,%esp
+  8001a7:	68 06 46 80 00       	push   $0x804606
+  8001ac:	e8 df 03 00 00       	call   800590 <cprintf>
+  8001b1:	83 c4 10             	add    $0x10,%esp
+  8001b4:	e9 2f ff ff ff       	jmp    8000e8 <umain+0x7d>
+		panic("opencons: %e", r);
+  8001b9:	50                   	push   %eax
+  8001ba:	68 41 46 80 00       	push   $0x804641
+  8001bf:	6a 37                	push   $0x37
+  8001c1:	68 4e 46 80 00       	push   $0x80464e
+  8001c6:	e8 ea 02 00 00       	call   8004b5 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  8001cb:	83 ec 08             	sub    $0x8,%esp
+  8001ce:	6a 01                	push   $0x1
+  8001d0:	6a 00                	push   $0x0
+  8001d2:	e8 58 15 00 00       	call   80172f <dup>
+  8001d7:	83 c4 10             	add    $0x10,%esp
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	79 23                	jns    800201 <umain+0x196>
+		panic("dup: %e", r);
+  8001de:	50                   	push   %eax
+  8001df:	68 74 46 80 00       	push   $0x804674
+  8001e4:	6a 3b                	push   $0x3b
+  8001e6:	68 4e 46 80 00       	push   $0x80464e
+  8001eb:	e8 c5 02 00 00       	call   8004b5 <_panic>
+	while (1) {
+		cprintf("init: starting sh\n");
+		r = spawnl("/sh", "sh", (char*)0);
+		if (r < 0) {
+			cprintf("init: spawn sh: %e\n", r);
+  8001f0:	83 ec 08             	sub    $0x8,%esp
+  8001f3:	50                   	push   %eax
+  8001f4:	68 93 46 80 00       	push   $0x804693
+  8001f9:	e8 92 03 00 00       	call   800590 <cprintf>
+			continue;
+  8001fe:	83 c4 10             	add    $0x10,%esp
+		cprintf("init: starting sh\n");
+  800201:	83 ec 0c             	sub    $0xc,%esp
+  800204:	68 7c 46 80 00       	push   $0x80467c
+  800209:	e8 82 03 00 00       	call   800590 <cprintf>
+		r = spawnl("/sh", "sh", (char*)0);
+  80020e:	83 c4 0c             	add    $0xc,%esp
+  800211:	6a 00                	push   $0x0
+  800213:	68 90 46 80 00       	push   $0x804690
+  800218:	68 8f 46 80 00       	push   $0x80468f
+  80021d:	e8 f6 24 00 00       	call   802718 <spawnl>
+		if (r < 0) {
+  800222:	83 c4 10             	add    $0x10,%esp
+  800225:	85 c0                	test   %eax,%eax
+  800227:	78 c7                	js     8001f0 <umain+0x185>
+		}
+		wait(r);
+  800229:	83 ec 0c             	sub    $0xc,%esp
+  80022c:	50                   	push   %eax
+  80022d:	e8 47 3c 00 00       	call   803e79 <wait>
+  800232:	83 c4 10             	add    $0x10,%esp
+  800235:	eb ca                	jmp    800201 <umain+0x196>
+
+00800237 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023c:	c3                   	ret
+
+0080023d <devcons_poll>:
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	53                   	push   %ebx
+  800241:	83 ec 04             	sub    $0x4,%esp
+  800244:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  800247:	89 da                	mov    %ebx,%edx
+  800249:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80024c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800253:	74 0c                	je     800261 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  800255:	89 d8                	mov    %ebx,%eax
+  800257:	83 e0 01             	and    $0x1,%eax
+  80025a:	09 d0                	or     %edx,%eax
+}
+  80025c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80025f:	c9                   	leave
+  800260:	c3                   	ret
+		cons_peek = sys_cgetc();
+  800261:	e8 b7 0d 00 00       	call   80101d <sys_cgetc>
+  800266:	a3 00 70 80 00       	mov    %eax,0x807000
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80026b:	89 da                	mov    %ebx,%edx
+  80026d:	83 e2 04             	and    $0x4,%edx
+  800270:	85 c0                	test   %eax,%eax
+  800272:	74 e6                	je     80025a <devcons_poll+0x1d>
+  800274:	eb df                	jmp    800255 <devcons_poll+0x18>
+
+00800276 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80027c:	68 13 47 80 00       	push   $0x804713
+  800281:	ff 75 0c             	push   0xc(%ebp)
+  800284:	e8 fe 09 00 00       	call   800c87 <strcpy>
+	return 0;
+}
+  800289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+00800290 <devcons_write>:
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	57                   	push   %edi
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+  800296:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80029c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80029f:	85 ff                	test   %edi,%edi
+  8002a1:	74 51                	je     8002f4 <devcons_write+0x64>
+  8002a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a8:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8002ad:	89 fb                	mov    %edi,%ebx
+  8002af:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8002b1:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8002b6:	39 d3                	cmp    %edx,%ebx
+  8002b8:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8002bb:	83 ec 04             	sub    $0x4,%esp
+  8002be:	53                   	push   %ebx
+  8002bf:	03 45 0c             	add    0xc(%ebp),%eax
+  8002c2:	50                   	push   %eax
+  8002c3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	e8 68 0b 00 00       	call   800e37 <memmove>
+		sys_cputs(buf, m);
+  8002cf:	83 c4 08             	add    $0x8,%esp
+  8002d2:	53                   	push   %ebx
+  8002d3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8002d9:	50                   	push   %eax
+  8002da:	e8 20 0d 00 00       	call   800fff <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8002df:	01 de                	add    %ebx,%esi
+  8002e1:	89 f0                	mov    %esi,%eax
+  8002e3:	83 c4 10             	add    $0x10,%esp
+  8002e6:	39 fe                	cmp    %edi,%esi
+  8002e8:	72 c3                	jb     8002ad <devcons_write+0x1d>
+}
+  8002ea:	89 f0                	mov    %esi,%eax
+  8002ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ef:	5b                   	pop    %ebx
+  8002f0:	5e                   	pop    %esi
+  8002f1:	5f                   	pop    %edi
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8002f4:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8002f9:	eb ef                	jmp    8002ea <devcons_write+0x5a>
+
+008002fb <devcons_read>:
+{
+  8002fb:	55                   	push   %ebp
+  8002fc:	89 e5                	mov    %esp,%ebp
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  800301:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800306:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80030a:	74 36                	je     800342 <devcons_read+0x47>
+	c = cons_peek;
+  80030c:	a1 00 70 80 00       	mov    0x807000,%eax
+	cons_peek = 0;
+  800311:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  800318:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80031b:	85 c0                	test   %eax,%eax
+  80031d:	75 10                	jne    80032f <devcons_read+0x34>
+  80031f:	e8 f9 0c 00 00       	call   80101d <sys_cgetc>
+  800324:	85 c0                	test   %eax,%eax
+  800326:	75 07                	jne    80032f <devcons_read+0x34>
+		sys_yield();
+  800328:	e8 6f 0d 00 00       	call   80109c <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80032d:	eb f0                	jmp    80031f <devcons_read+0x24>
+	if (c < 0)
+  80032f:	85 c0                	test   %eax,%eax
+  800331:	78 0f                	js     800342 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  800333:	83 f8 04             	cmp    $0x4,%eax
+  800336:	74 0c                	je     800344 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  800338:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80033b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80033d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800342:	c9                   	leave
+  800343:	c3                   	ret
+		return 0;
+  800344:	b8 00 00 00 00       	mov    $0x0,%eax
+  800349:	eb f7                	jmp    800342 <devcons_read+0x47>
+
+0080034b <cputchar>:
+{
+  80034b:	55                   	push   %ebp
+  80034c:	89 e5                	mov    %esp,%ebp
+  80034e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800351:	8b 45 08             	mov    0x8(%ebp),%eax
+  800354:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  800357:	6a 01                	push   $0x1
+  800359:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80035c:	50                   	push   %eax
+  80035d:	e8 9d 0c 00 00       	call   800fff <sys_cputs>
+}
+  800362:	83 c4 10             	add    $0x10,%esp
+  800365:	c9                   	leave
+  800366:	c3                   	ret
+
+00800367 <getchar>:
+{
+  800367:	55                   	push   %ebp
+  800368:	89 e5                	mov    %esp,%ebp
+  80036a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80036d:	6a 01                	push   $0x1
+  80036f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800372:	50                   	push   %eax
+  800373:	6a 00                	push   $0x0
+  800375:	e8 9f 14 00 00       	call   801819 <read>
+	if (r < 0)
+  80037a:	83 c4 10             	add    $0x10,%esp
+  80037d:	85 c0                	test   %eax,%eax
+  80037f:	78 06                	js     800387 <getchar+0x20>
+	if (r < 1)
+  800381:	74 06                	je     800389 <getchar+0x22>
+	return c;
+  800383:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+		return -E_EOF;
+  800389:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80038e:	eb f7                	jmp    800387 <getchar+0x20>
+
+00800390 <iscons>:
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800396:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800399:	50                   	push   %eax
+  80039a:	ff 75 08             	push   0x8(%ebp)
+  80039d:	e8 f3 11 00 00       	call   801595 <fd_lookup>
+  8003a2:	83 c4 10             	add    $0x10,%esp
+  8003a5:	85 c0                	test   %eax,%eax
+  8003a7:	78 11                	js     8003ba <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8003a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8003ac:	8b 15 80 67 80 00    	mov    0x806780,%edx
+  8003b2:	39 10                	cmp    %edx,(%eax)
+  8003b4:	0f 94 c0             	sete   %al
+  8003b7:	0f b6 c0             	movzbl %al,%eax
+}
+  8003ba:	c9                   	leave
+  8003bb:	c3                   	ret
+
+008003bc <opencons>:
+{
+  8003bc:	55                   	push   %ebp
+  8003bd:	89 e5                	mov    %esp,%ebp
+  8003bf:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8003c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8003c5:	50                   	push   %eax
+  8003c6:	e8 7a 11 00 00       	call   801545 <fd_alloc>
+  8003cb:	83 c4 10             	add    $0x10,%esp
+  8003ce:	85 c0                	test   %eax,%eax
+  8003d0:	78 3a                	js     80040c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8003d2:	83 ec 04             	sub    $0x4,%esp
+  8003d5:	68 07 04 00 00       	push   $0x407
+  8003da:	ff 75 f4             	push   -0xc(%ebp)
+  8003dd:	6a 00                	push   $0x0
+  8003df:	e8 d7 0c 00 00       	call   8010bb <sys_page_alloc>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+  8003e7:	85 c0                	test   %eax,%eax
+  8003e9:	78 21                	js     80040c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8003eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8003ee:	8b 15 80 67 80 00    	mov    0x806780,%edx
+  8003f4:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8003f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8003f9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800400:	83 ec 0c             	sub    $0xc,%esp
+  800403:	50                   	push   %eax
+  800404:	e8 15 11 00 00       	call   80151e <fd2num>
+  800409:	83 c4 10             	add    $0x10,%esp
+}
+  80040c:	c9                   	leave
+  80040d:	c3                   	ret
+
+0080040e <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80040e:	55                   	push   %ebp
+  80040f:	89 e5                	mov    %esp,%ebp
+  800411:	56                   	push   %esi
+  800412:	53                   	push   %ebx
+  800413:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800416:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800419:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80041b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800420:	29 d0                	sub    %edx,%eax
+  800422:	89 c2                	mov    %eax,%edx
+  800424:	c1 ea 0f             	shr    $0xf,%edx
+  800427:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800434:	c7 04 85 00 91 80 00 	movl   $0x0,0x809100(,%eax,4)
+  80043b:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80043f:	e8 39 0c 00 00       	call   80107d <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800444:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800449:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80044f:	89 e1                	mov    %esp,%ecx
+  800451:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800456:	29 ca                	sub    %ecx,%edx
+  800458:	89 d1                	mov    %edx,%ecx
+  80045a:	c1 e9 0f             	shr    $0xf,%ecx
+  80045d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800463:	ba 00 00 00 00       	mov    $0x0,%edx
+  800468:	0f 42 d1             	cmovb  %ecx,%edx
+  80046b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800470:	89 04 95 00 91 80 00 	mov    %eax,0x809100(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800477:	85 db                	test   %ebx,%ebx
+  800479:	7e 07                	jle    800482 <libmain+0x74>
+		binaryname = argv[0];
+  80047b:	8b 06                	mov    (%esi),%eax
+  80047d:	a3 a0 67 80 00       	mov    %eax,0x8067a0
+
+	// call user main routine
+	umain(argc, argv);
+  800482:	83 ec 08             	sub    $0x8,%esp
+  800485:	56                   	push   %esi
+  800486:	53                   	push   %ebx
+  800487:	e8 df fb ff ff       	call   80006b <umain>
+
+	// exit gracefully
+	exit();
+  80048c:	e8 0a 00 00 00       	call   80049b <exit>
+}
+  800491:	83 c4 10             	add    $0x10,%esp
+  800494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800497:	5b                   	pop    %ebx
+  800498:	5e                   	pop    %esi
+  800499:	5d                   	pop    %ebp
+  80049a:	c3                   	ret
+
+0080049b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80049b:	55                   	push   %ebp
+  80049c:	89 e5                	mov    %esp,%ebp
+  80049e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004a1:	e8 61 12 00 00       	call   801707 <close_all>
+	sys_env_destroy(0);
+  8004a6:	83 ec 0c             	sub    $0xc,%esp
+  8004a9:	6a 00                	push   $0x0
+  8004ab:	e8 8c 0b 00 00       	call   80103c <sys_env_destroy>
+}
+  8004b0:	83 c4 10             	add    $0x10,%esp
+  8004b3:	c9                   	leave
+  8004b4:	c3                   	ret
+
+008004b5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	56                   	push   %esi
+  8004b9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004ba:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004bd:	8b 35 a0 67 80 00    	mov    0x8067a0,%esi
+  8004c3:	e8 b5 0b 00 00       	call   80107d <sys_getenvid>
+  8004c8:	83 ec 0c             	sub    $0xc,%esp
+  8004cb:	ff 75 0c             	push   0xc(%ebp)
+  8004ce:	ff 75 08             	push   0x8(%ebp)
+  8004d1:	56                   	push   %esi
+  8004d2:	50                   	push   %eax
+  8004d3:	68 2c 47 80 00       	push   $0x80472c
+  8004d8:	e8 b3 00 00 00       	call   800590 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8004dd:	83 c4 18             	add    $0x18,%esp
+  8004e0:	53                   	push   %ebx
+  8004e1:	ff 75 10             	push   0x10(%ebp)
+  8004e4:	e8 56 00 00 00       	call   80053f <vcprintf>
+	cprintf("\n");
+  8004e9:	c7 04 24 62 4c 80 00 	movl   $0x804c62,(%esp)
+  8004f0:	e8 9b 00 00 00       	call   800590 <cprintf>
+  8004f5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004f8:	cc                   	int3
+	while (1)
+  8004f9:	eb fd                	jmp    8004f8 <_panic+0x43>
+
+008004fb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8004fb:	55                   	push   %ebp
+  8004fc:	89 e5                	mov    %esp,%ebp
+  8004fe:	53                   	push   %ebx
+  8004ff:	83 ec 04             	sub    $0x4,%esp
+  800502:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800505:	8b 13                	mov    (%ebx),%edx
+  800507:	8d 42 01             	lea    0x1(%edx),%eax
+  80050a:	89 03                	mov    %eax,(%ebx)
+  80050c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80050f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800513:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800518:	74 09                	je     800523 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80051a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80051e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800521:	c9                   	leave
+  800522:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800523:	83 ec 08             	sub    $0x8,%esp
+  800526:	68 ff 00 00 00       	push   $0xff
+  80052b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80052e:	50                   	push   %eax
+  80052f:	e8 cb 0a 00 00       	call   800fff <sys_cputs>
+		b->idx = 0;
+  800534:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	eb db                	jmp    80051a <putch+0x1f>
+
+0080053f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80053f:	55                   	push   %ebp
+  800540:	89 e5                	mov    %esp,%ebp
+  800542:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800548:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80054f:	00 00 00 
+	b.cnt = 0;
+  800552:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800559:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80055c:	ff 75 0c             	push   0xc(%ebp)
+  80055f:	ff 75 08             	push   0x8(%ebp)
+  800562:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800568:	50                   	push   %eax
+  800569:	68 fb 04 80 00       	push   $0x8004fb
+  80056e:	e8 1c 01 00 00       	call   80068f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800573:	83 c4 08             	add    $0x8,%esp
+  800576:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80057c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800582:	50                   	push   %eax
+  800583:	e8 77 0a 00 00       	call   800fff <sys_cputs>
+
+	return b.cnt;
+}
+  800588:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80058e:	c9                   	leave
+  80058f:	c3                   	ret
+
+00800590 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800590:	55                   	push   %ebp
+  800591:	89 e5                	mov    %esp,%ebp
+  800593:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800596:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800599:	50                   	push   %eax
+  80059a:	ff 75 08             	push   0x8(%ebp)
+  80059d:	e8 9d ff ff ff       	call   80053f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005a2:	c9                   	leave
+  8005a3:	c3                   	ret
+
+008005a4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005a4:	55                   	push   %ebp
+  8005a5:	89 e5                	mov    %esp,%ebp
+  8005a7:	57                   	push   %edi
+  8005a8:	56                   	push   %esi
+  8005a9:	53                   	push   %ebx
+  8005aa:	83 ec 1c             	sub    $0x1c,%esp
+  8005ad:	89 c3                	mov    %eax,%ebx
+  8005af:	89 d6                	mov    %edx,%esi
+  8005b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005b7:	89 d1                	mov    %edx,%ecx
+  8005b9:	89 c2                	mov    %eax,%edx
+  8005bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005be:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c1:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8005ce:	39 c2                	cmp    %eax,%edx
+  8005d0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8005d3:	73 4b                	jae    800620 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8005db:	85 ff                	test   %edi,%edi
+  8005dd:	7e 11                	jle    8005f0 <printnum+0x4c>
+			putch(padc, putdat);
+  8005df:	83 ec 08             	sub    $0x8,%esp
+  8005e2:	56                   	push   %esi
+  8005e3:	ff 75 18             	push   0x18(%ebp)
+  8005e6:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8005e8:	83 c4 10             	add    $0x10,%esp
+  8005eb:	83 ef 01             	sub    $0x1,%edi
+  8005ee:	75 ef                	jne    8005df <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8005f0:	83 ec 08             	sub    $0x8,%esp
+  8005f3:	56                   	push   %esi
+  8005f4:	83 ec 04             	sub    $0x4,%esp
+  8005f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8005fa:	ff 75 e0             	push   -0x20(%ebp)
+  8005fd:	ff 75 dc             	push   -0x24(%ebp)
+  800600:	ff 75 d8             	push   -0x28(%ebp)
+  800603:	e8 b5 3e 00 00       	call   8044bd <__umoddi3>
+  800608:	83 c4 14             	add    $0x14,%esp
+  80060b:	0f be 80 4f 47 80 00 	movsbl 0x80474f(%eax),%eax
+  800612:	50                   	push   %eax
+  800613:	ff d3                	call   *%ebx
+}
+  800615:	83 c4 10             	add    $0x10,%esp
+  800618:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80061b:	5b                   	pop    %ebx
+  80061c:	5e                   	pop    %esi
+  80061d:	5f                   	pop    %edi
+  80061e:	5d                   	pop    %ebp
+  80061f:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800620:	83 ec 0c             	sub    $0xc,%esp
+  800623:	ff 75 18             	push   0x18(%ebp)
+  800626:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800629:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80062c:	52                   	push   %edx
+  80062d:	50                   	push   %eax
+  80062e:	83 ec 08             	sub    $0x8,%esp
+  800631:	ff 75 e4             	push   -0x1c(%ebp)
+  800634:	ff 75 e0             	push   -0x20(%ebp)
+  800637:	ff 75 dc             	push   -0x24(%ebp)
+  80063a:	ff 75 d8             	push   -0x28(%ebp)
+  80063d:	e8 b5 3d 00 00       	call   8043f7 <__udivdi3>
+  800642:	83 c4 18             	add    $0x18,%esp
+  800645:	52                   	push   %edx
+  800646:	50                   	push   %eax
+  800647:	89 f2                	mov    %esi,%edx
+  800649:	89 d8                	mov    %ebx,%eax
+  80064b:	e8 54 ff ff ff       	call   8005a4 <printnum>
+  800650:	83 c4 20             	add    $0x20,%esp
+  800653:	eb 9b                	jmp    8005f0 <printnum+0x4c>
+
+00800655 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800655:	55                   	push   %ebp
+  800656:	89 e5                	mov    %esp,%ebp
+  800658:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80065b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80065f:	8b 10                	mov    (%eax),%edx
+  800661:	3b 50 04             	cmp    0x4(%eax),%edx
+  800664:	73 0a                	jae    800670 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800666:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800669:	89 08                	mov    %ecx,(%eax)
+  80066b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80066e:	88 02                	mov    %al,(%edx)
+}
+  800670:	5d                   	pop    %ebp
+  800671:	c3                   	ret
+
+00800672 <printfmt>:
+{
+  800672:	55                   	push   %ebp
+  800673:	89 e5                	mov    %esp,%ebp
+  800675:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800678:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80067b:	50                   	push   %eax
+  80067c:	ff 75 10             	push   0x10(%ebp)
+  80067f:	ff 75 0c             	push   0xc(%ebp)
+  800682:	ff 75 08             	push   0x8(%ebp)
+  800685:	e8 05 00 00 00       	call   80068f <vprintfmt>
+}
+  80068a:	83 c4 10             	add    $0x10,%esp
+  80068d:	c9                   	leave
+  80068e:	c3                   	ret
+
+0080068f <vprintfmt>:
+{
+  80068f:	55                   	push   %ebp
+  800690:	89 e5                	mov    %esp,%ebp
+  800692:	57                   	push   %edi
+  800693:	56                   	push   %esi
+  800694:	53                   	push   %ebx
+  800695:	83 ec 2c             	sub    $0x2c,%esp
+  800698:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80069b:	89 df                	mov    %ebx,%edi
+  80069d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8006a3:	8d 70 01             	lea    0x1(%eax),%esi
+  8006a6:	0f b6 00             	movzbl (%eax),%eax
+  8006a9:	83 f8 25             	cmp    $0x25,%eax
+  8006ac:	74 1e                	je     8006cc <vprintfmt+0x3d>
+			if (ch == '\0')
+  8006ae:	85 c0                	test   %eax,%eax
+  8006b0:	0f 84 15 05 00 00    	je     800bcb <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	53                   	push   %ebx
+  8006ba:	50                   	push   %eax
+  8006bb:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006bd:	83 c6 01             	add    $0x1,%esi
+  8006c0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006c4:	83 c4 10             	add    $0x10,%esp
+  8006c7:	83 f8 25             	cmp    $0x25,%eax
+  8006ca:	75 e2                	jne    8006ae <vprintfmt+0x1f>
+		padc = ' ';
+  8006cc:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8006d0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006d7:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8006de:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8006e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ea:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ed:	8d 56 01             	lea    0x1(%esi),%edx
+  8006f0:	0f b6 0e             	movzbl (%esi),%ecx
+  8006f3:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8006f6:	3c 55                	cmp    $0x55,%al
+  8006f8:	0f 87 3b 04 00 00    	ja     800b39 <vprintfmt+0x4aa>
+  8006fe:	0f b6 c0             	movzbl %al,%eax
+  800701:	ff 24 85 c0 48 80 00 	jmp    *0x8048c0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800708:	89 75 10             	mov    %esi,0x10(%ebp)
+  80070b:	eb 93                	jmp    8006a0 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80070d:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80070f:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800713:	eb d8                	jmp    8006ed <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800715:	89 d6                	mov    %edx,%esi
+  800717:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80071b:	eb d0                	jmp    8006ed <vprintfmt+0x5e>
+  80071d:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800720:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800723:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800726:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80072a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80072d:	83 f9 09             	cmp    $0x9,%ecx
+  800730:	77 6f                	ja     8007a1 <vprintfmt+0x112>
+  800732:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800735:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800738:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80073b:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80073f:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800742:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800745:	83 fe 09             	cmp    $0x9,%esi
+  800748:	76 eb                	jbe    800735 <vprintfmt+0xa6>
+  80074a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80074d:	89 d6                	mov    %edx,%esi
+  80074f:	eb 13                	jmp    800764 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8b 00                	mov    (%eax),%eax
+  800756:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800759:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075c:	8d 40 04             	lea    0x4(%eax),%eax
+  80075f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800762:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800764:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800768:	79 83                	jns    8006ed <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80076a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80076d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800770:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800777:	e9 71 ff ff ff       	jmp    8006ed <vprintfmt+0x5e>
+			if (width < 0)
+  80077c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80077f:	85 c9                	test   %ecx,%ecx
+  800781:	b8 00 00 00 00       	mov    $0x0,%eax
+  800786:	0f 49 c1             	cmovns %ecx,%eax
+  800789:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80078c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80078e:	e9 5a ff ff ff       	jmp    8006ed <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800793:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800795:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80079c:	e9 4c ff ff ff       	jmp    8006ed <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a1:	89 d6                	mov    %edx,%esi
+  8007a3:	eb bf                	jmp    800764 <vprintfmt+0xd5>
+			lflag++;
+  8007a5:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a9:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8007ab:	e9 3d ff ff ff       	jmp    8006ed <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8007b0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8d 70 04             	lea    0x4(%eax),%esi
+  8007b9:	83 ec 08             	sub    $0x8,%esp
+  8007bc:	53                   	push   %ebx
+  8007bd:	ff 30                	push   (%eax)
+  8007bf:	ff d7                	call   *%edi
+			break;
+  8007c1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007c4:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8007c7:	e9 d4 fe ff ff       	jmp    8006a0 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8007cc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d2:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8007d5:	8b 10                	mov    (%eax),%edx
+  8007d7:	89 d0                	mov    %edx,%eax
+  8007d9:	f7 d8                	neg    %eax
+  8007db:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007de:	83 f8 12             	cmp    $0x12,%eax
+  8007e1:	7f 23                	jg     800806 <vprintfmt+0x177>
+  8007e3:	8b 14 85 20 4a 80 00 	mov    0x804a20(,%eax,4),%edx
+  8007ea:	85 d2                	test   %edx,%edx
+  8007ec:	74 18                	je     800806 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8007ee:	52                   	push   %edx
+  8007ef:	68 74 4b 80 00       	push   $0x804b74
+  8007f4:	53                   	push   %ebx
+  8007f5:	57                   	push   %edi
+  8007f6:	e8 77 fe ff ff       	call   800672 <printfmt>
+  8007fb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007fe:	89 75 14             	mov    %esi,0x14(%ebp)
+  800801:	e9 9a fe ff ff       	jmp    8006a0 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800806:	50                   	push   %eax
+  800807:	68 67 47 80 00       	push   $0x804767
+  80080c:	53                   	push   %ebx
+  80080d:	57                   	push   %edi
+  80080e:	e8 5f fe ff ff       	call   800672 <printfmt>
+  800813:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800816:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800819:	e9 82 fe ff ff       	jmp    8006a0 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80081e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800821:	8b 45 14             	mov    0x14(%ebp),%eax
+  800824:	83 c0 04             	add    $0x4,%eax
+  800827:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80082a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082d:	8b 00                	mov    (%eax),%eax
+  80082f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800832:	85 c0                	test   %eax,%eax
+  800834:	0f 84 61 03 00 00    	je     800b9b <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80083a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80083e:	7e 06                	jle    800846 <vprintfmt+0x1b7>
+  800840:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800844:	75 29                	jne    80086f <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800846:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800849:	8d 70 01             	lea    0x1(%eax),%esi
+  80084c:	0f b6 00             	movzbl (%eax),%eax
+  80084f:	0f be d0             	movsbl %al,%edx
+  800852:	85 d2                	test   %edx,%edx
+  800854:	0f 84 bb 00 00 00    	je     800915 <vprintfmt+0x286>
+  80085a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80085d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800860:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800863:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800866:	eb 7a                	jmp    8008e2 <vprintfmt+0x253>
+				p = "(null)";
+  800868:	c7 45 d0 60 47 80 00 	movl   $0x804760,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80086f:	83 ec 08             	sub    $0x8,%esp
+  800872:	ff 75 d4             	push   -0x2c(%ebp)
+  800875:	ff 75 d0             	push   -0x30(%ebp)
+  800878:	e8 e0 03 00 00       	call   800c5d <strnlen>
+  80087d:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800880:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800883:	83 c4 10             	add    $0x10,%esp
+  800886:	85 d2                	test   %edx,%edx
+  800888:	0f 8e d6 02 00 00    	jle    800b64 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80088e:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800892:	83 ec 08             	sub    $0x8,%esp
+  800895:	53                   	push   %ebx
+  800896:	56                   	push   %esi
+  800897:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800899:	83 c4 10             	add    $0x10,%esp
+  80089c:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8008a0:	75 f0                	jne    800892 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008a2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008a5:	8d 70 01             	lea    0x1(%eax),%esi
+  8008a8:	0f b6 00             	movzbl (%eax),%eax
+  8008ab:	0f be d0             	movsbl %al,%edx
+  8008ae:	85 d2                	test   %edx,%edx
+  8008b0:	0f 84 da 02 00 00    	je     800b90 <vprintfmt+0x501>
+  8008b6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008b9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008bc:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008bf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008c2:	eb 1e                	jmp    8008e2 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8008c4:	83 ec 08             	sub    $0x8,%esp
+  8008c7:	ff 75 0c             	push   0xc(%ebp)
+  8008ca:	52                   	push   %edx
+  8008cb:	ff 55 08             	call   *0x8(%ebp)
+  8008ce:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008d1:	83 eb 01             	sub    $0x1,%ebx
+  8008d4:	83 c6 01             	add    $0x1,%esi
+  8008d7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008db:	0f be d0             	movsbl %al,%edx
+  8008de:	85 d2                	test   %edx,%edx
+  8008e0:	74 2a                	je     80090c <vprintfmt+0x27d>
+  8008e2:	85 ff                	test   %edi,%edi
+  8008e4:	78 05                	js     8008eb <vprintfmt+0x25c>
+  8008e6:	83 ef 01             	sub    $0x1,%edi
+  8008e9:	78 59                	js     800944 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008eb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008ef:	74 d3                	je     8008c4 <vprintfmt+0x235>
+  8008f1:	0f be c0             	movsbl %al,%eax
+  8008f4:	83 e8 20             	sub    $0x20,%eax
+  8008f7:	83 f8 5e             	cmp    $0x5e,%eax
+  8008fa:	76 c8                	jbe    8008c4 <vprintfmt+0x235>
+					putch('?', putdat);
+  8008fc:	83 ec 08             	sub    $0x8,%esp
+  8008ff:	ff 75 0c             	push   0xc(%ebp)
+  800902:	6a 3f                	push   $0x3f
+  800904:	ff 55 08             	call   *0x8(%ebp)
+  800907:	83 c4 10             	add    $0x10,%esp
+  80090a:	eb c5                	jmp    8008d1 <vprintfmt+0x242>
+  80090c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80090f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800912:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800915:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800918:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80091c:	7e 1b                	jle    800939 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80091e:	83 ec 08             	sub    $0x8,%esp
+  800921:	53                   	push   %ebx
+  800922:	6a 20                	push   $0x20
+  800924:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800926:	83 c4 10             	add    $0x10,%esp
+  800929:	83 ee 01             	sub    $0x1,%esi
+  80092c:	75 f0                	jne    80091e <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80092e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800931:	89 45 14             	mov    %eax,0x14(%ebp)
+  800934:	e9 67 fd ff ff       	jmp    8006a0 <vprintfmt+0x11>
+  800939:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80093c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80093f:	e9 5c fd ff ff       	jmp    8006a0 <vprintfmt+0x11>
+  800944:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800947:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80094a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80094d:	eb c6                	jmp    800915 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80094f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800952:	89 55 10             	mov    %edx,0x10(%ebp)
+  800955:	83 f9 01             	cmp    $0x1,%ecx
+  800958:	7f 1f                	jg     800979 <vprintfmt+0x2ea>
+	else if (lflag)
+  80095a:	85 c9                	test   %ecx,%ecx
+  80095c:	74 67                	je     8009c5 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80095e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800961:	8b 30                	mov    (%eax),%esi
+  800963:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800966:	89 f0                	mov    %esi,%eax
+  800968:	c1 f8 1f             	sar    $0x1f,%eax
+  80096b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80096e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800971:	8d 40 04             	lea    0x4(%eax),%eax
+  800974:	89 45 14             	mov    %eax,0x14(%ebp)
+  800977:	eb 17                	jmp    800990 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800979:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097c:	8b 50 04             	mov    0x4(%eax),%edx
+  80097f:	8b 00                	mov    (%eax),%eax
+  800981:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800984:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800987:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098a:	8d 40 08             	lea    0x8(%eax),%eax
+  80098d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800990:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800993:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800996:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80099b:	85 c9                	test   %ecx,%ecx
+  80099d:	0f 89 12 01 00 00    	jns    800ab5 <vprintfmt+0x426>
+				putch('-', putdat);
+  8009a3:	83 ec 08             	sub    $0x8,%esp
+  8009a6:	53                   	push   %ebx
+  8009a7:	6a 2d                	push   $0x2d
+  8009a9:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8009ab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009b1:	f7 da                	neg    %edx
+  8009b3:	83 d1 00             	adc    $0x0,%ecx
+  8009b6:	f7 d9                	neg    %ecx
+  8009b8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009bb:	be 0a 00 00 00       	mov    $0xa,%esi
+  8009c0:	e9 f0 00 00 00       	jmp    800ab5 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8009c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c8:	8b 30                	mov    (%eax),%esi
+  8009ca:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8009cd:	89 f0                	mov    %esi,%eax
+  8009cf:	c1 f8 1f             	sar    $0x1f,%eax
+  8009d2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8009d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009de:	eb b0                	jmp    800990 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8009e0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009e3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009e6:	83 f9 01             	cmp    $0x1,%ecx
+  8009e9:	7f 1e                	jg     800a09 <vprintfmt+0x37a>
+	else if (lflag)
+  8009eb:	85 c9                	test   %ecx,%ecx
+  8009ed:	74 32                	je     800a21 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8009ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f2:	8b 10                	mov    (%eax),%edx
+  8009f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ff:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800a04:	e9 ac 00 00 00       	jmp    800ab5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0c:	8b 10                	mov    (%eax),%edx
+  800a0e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a11:	8d 40 08             	lea    0x8(%eax),%eax
+  800a14:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a17:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800a1c:	e9 94 00 00 00       	jmp    800ab5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a21:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a24:	8b 10                	mov    (%eax),%edx
+  800a26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a31:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800a36:	eb 7d                	jmp    800ab5 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800a38:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a3b:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a3e:	83 f9 01             	cmp    $0x1,%ecx
+  800a41:	7f 1b                	jg     800a5e <vprintfmt+0x3cf>
+	else if (lflag)
+  800a43:	85 c9                	test   %ecx,%ecx
+  800a45:	74 2c                	je     800a73 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800a47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4a:	8b 10                	mov    (%eax),%edx
+  800a4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a51:	8d 40 04             	lea    0x4(%eax),%eax
+  800a54:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a57:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800a5c:	eb 57                	jmp    800ab5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a61:	8b 10                	mov    (%eax),%edx
+  800a63:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a66:	8d 40 08             	lea    0x8(%eax),%eax
+  800a69:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a6c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800a71:	eb 42                	jmp    800ab5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a73:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a76:	8b 10                	mov    (%eax),%edx
+  800a78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a80:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a83:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800a88:	eb 2b                	jmp    800ab5 <vprintfmt+0x426>
+			putch('0', putdat);
+  800a8a:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a8d:	83 ec 08             	sub    $0x8,%esp
+  800a90:	53                   	push   %ebx
+  800a91:	6a 30                	push   $0x30
+  800a93:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800a95:	83 c4 08             	add    $0x8,%esp
+  800a98:	53                   	push   %ebx
+  800a99:	6a 78                	push   $0x78
+  800a9b:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa0:	8b 10                	mov    (%eax),%edx
+  800aa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800aa7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800aaa:	8d 40 04             	lea    0x4(%eax),%eax
+  800aad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ab0:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800ab5:	83 ec 0c             	sub    $0xc,%esp
+  800ab8:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800abc:	50                   	push   %eax
+  800abd:	ff 75 e4             	push   -0x1c(%ebp)
+  800ac0:	56                   	push   %esi
+  800ac1:	51                   	push   %ecx
+  800ac2:	52                   	push   %edx
+  800ac3:	89 da                	mov    %ebx,%edx
+  800ac5:	89 f8                	mov    %edi,%eax
+  800ac7:	e8 d8 fa ff ff       	call   8005a4 <printnum>
+			break;
+  800acc:	83 c4 20             	add    $0x20,%esp
+  800acf:	e9 cc fb ff ff       	jmp    8006a0 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800ad4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ad7:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ada:	83 f9 01             	cmp    $0x1,%ecx
+  800add:	7f 1b                	jg     800afa <vprintfmt+0x46b>
+	else if (lflag)
+  800adf:	85 c9                	test   %ecx,%ecx
+  800ae1:	74 2c                	je     800b0f <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800ae3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae6:	8b 10                	mov    (%eax),%edx
+  800ae8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aed:	8d 40 04             	lea    0x4(%eax),%eax
+  800af0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800af3:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800af8:	eb bb                	jmp    800ab5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800afa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afd:	8b 10                	mov    (%eax),%edx
+  800aff:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b02:	8d 40 08             	lea    0x8(%eax),%eax
+  800b05:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b08:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800b0d:	eb a6                	jmp    800ab5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b12:	8b 10                	mov    (%eax),%edx
+  800b14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b19:	8d 40 04             	lea    0x4(%eax),%eax
+  800b1c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b1f:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800b24:	eb 8f                	jmp    800ab5 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800b26:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b29:	83 ec 08             	sub    $0x8,%esp
+  800b2c:	53                   	push   %ebx
+  800b2d:	6a 25                	push   $0x25
+  800b2f:	ff d7                	call   *%edi
+			break;
+  800b31:	83 c4 10             	add    $0x10,%esp
+  800b34:	e9 67 fb ff ff       	jmp    8006a0 <vprintfmt+0x11>
+			putch('%', putdat);
+  800b39:	83 ec 08             	sub    $0x8,%esp
+  800b3c:	53                   	push   %ebx
+  800b3d:	6a 25                	push   $0x25
+  800b3f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b41:	83 c4 10             	add    $0x10,%esp
+  800b44:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800b48:	0f 84 ba fb ff ff    	je     800708 <vprintfmt+0x79>
+  800b4e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800b51:	89 f0                	mov    %esi,%eax
+  800b53:	83 e8 01             	sub    $0x1,%eax
+  800b56:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b5a:	75 f7                	jne    800b53 <vprintfmt+0x4c4>
+  800b5c:	89 45 10             	mov    %eax,0x10(%ebp)
+  800b5f:	e9 3c fb ff ff       	jmp    8006a0 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b64:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b67:	8d 70 01             	lea    0x1(%eax),%esi
+  800b6a:	0f b6 00             	movzbl (%eax),%eax
+  800b6d:	0f be d0             	movsbl %al,%edx
+  800b70:	85 d2                	test   %edx,%edx
+  800b72:	74 11                	je     800b85 <vprintfmt+0x4f6>
+  800b74:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b77:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b7a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b7d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b80:	e9 5d fd ff ff       	jmp    8008e2 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b85:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b88:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b8b:	e9 10 fb ff ff       	jmp    8006a0 <vprintfmt+0x11>
+  800b90:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b93:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b96:	e9 05 fb ff ff       	jmp    8006a0 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800b9b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b9f:	7e 0a                	jle    800bab <vprintfmt+0x51c>
+  800ba1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800ba5:	0f 85 bd fc ff ff    	jne    800868 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bab:	ba 28 00 00 00       	mov    $0x28,%edx
+  800bb0:	b8 28 00 00 00       	mov    $0x28,%eax
+  800bb5:	be 61 47 80 00       	mov    $0x804761,%esi
+  800bba:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800bbd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800bc0:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800bc3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bc6:	e9 17 fd ff ff       	jmp    8008e2 <vprintfmt+0x253>
+}
+  800bcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bce:	5b                   	pop    %ebx
+  800bcf:	5e                   	pop    %esi
+  800bd0:	5f                   	pop    %edi
+  800bd1:	5d                   	pop    %ebp
+  800bd2:	c3                   	ret
+
+00800bd3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	83 ec 18             	sub    $0x18,%esp
+  800bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800bdf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800be2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800be6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800be9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800bf0:	85 c0                	test   %eax,%eax
+  800bf2:	74 26                	je     800c1a <vsnprintf+0x47>
+  800bf4:	85 d2                	test   %edx,%edx
+  800bf6:	7e 22                	jle    800c1a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800bf8:	ff 75 14             	push   0x14(%ebp)
+  800bfb:	ff 75 10             	push   0x10(%ebp)
+  800bfe:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c01:	50                   	push   %eax
+  800c02:	68 55 06 80 00       	push   $0x800655
+  800c07:	e8 83 fa ff ff       	call   80068f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c0c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c0f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c15:	83 c4 10             	add    $0x10,%esp
+}
+  800c18:	c9                   	leave
+  800c19:	c3                   	ret
+		return -E_INVAL;
+  800c1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c1f:	eb f7                	jmp    800c18 <vsnprintf+0x45>
+
+00800c21 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c21:	55                   	push   %ebp
+  800c22:	89 e5                	mov    %esp,%ebp
+  800c24:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c27:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c2a:	50                   	push   %eax
+  800c2b:	ff 75 10             	push   0x10(%ebp)
+  800c2e:	ff 75 0c             	push   0xc(%ebp)
+  800c31:	ff 75 08             	push   0x8(%ebp)
+  800c34:	e8 9a ff ff ff       	call   800bd3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800c39:	c9                   	leave
+  800c3a:	c3                   	ret
+
+00800c3b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c41:	80 3a 00             	cmpb   $0x0,(%edx)
+  800c44:	74 10                	je     800c56 <strlen+0x1b>
+  800c46:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800c4b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800c4e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c52:	75 f7                	jne    800c4b <strlen+0x10>
+	return n;
+}
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800c5b:	eb f7                	jmp    800c54 <strlen+0x19>
+
+00800c5d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c63:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c66:	85 d2                	test   %edx,%edx
+  800c68:	74 16                	je     800c80 <strnlen+0x23>
+  800c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c73:	74 09                	je     800c7e <strnlen+0x21>
+		n++;
+  800c75:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c78:	39 d0                	cmp    %edx,%eax
+  800c7a:	75 f3                	jne    800c6f <strnlen+0x12>
+		n++;
+  800c7c:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c85:	eb f7                	jmp    800c7e <strnlen+0x21>
+
+00800c87 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	53                   	push   %ebx
+  800c8b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c96:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c9a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c9d:	83 c0 01             	add    $0x1,%eax
+  800ca0:	84 d2                	test   %dl,%dl
+  800ca2:	75 f2                	jne    800c96 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ca4:	89 c8                	mov    %ecx,%eax
+  800ca6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+
+00800cab <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	53                   	push   %ebx
+  800caf:	83 ec 10             	sub    $0x10,%esp
+  800cb2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800cb5:	53                   	push   %ebx
+  800cb6:	e8 80 ff ff ff       	call   800c3b <strlen>
+  800cbb:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800cbe:	ff 75 0c             	push   0xc(%ebp)
+  800cc1:	01 d8                	add    %ebx,%eax
+  800cc3:	50                   	push   %eax
+  800cc4:	e8 be ff ff ff       	call   800c87 <strcpy>
+	return dst;
+}
+  800cc9:	89 d8                	mov    %ebx,%eax
+  800ccb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cce:	c9                   	leave
+  800ccf:	c3                   	ret
+
+00800cd0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cd0:	55                   	push   %ebp
+  800cd1:	89 e5                	mov    %esp,%ebp
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+  800cd5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800cde:	85 db                	test   %ebx,%ebx
+  800ce0:	74 17                	je     800cf9 <strncpy+0x29>
+  800ce2:	01 f3                	add    %esi,%ebx
+  800ce4:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800ce6:	83 c0 01             	add    $0x1,%eax
+  800ce9:	0f b6 0a             	movzbl (%edx),%ecx
+  800cec:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800cef:	80 f9 01             	cmp    $0x1,%cl
+  800cf2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800cf5:	39 c3                	cmp    %eax,%ebx
+  800cf7:	75 ed                	jne    800ce6 <strncpy+0x16>
+	}
+	return ret;
+}
+  800cf9:	89 f0                	mov    %esi,%eax
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+
+00800cff <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	56                   	push   %esi
+  800d03:	53                   	push   %ebx
+  800d04:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d0d:	89 f0                	mov    %esi,%eax
+  800d0f:	85 db                	test   %ebx,%ebx
+  800d11:	74 1e                	je     800d31 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800d13:	83 eb 01             	sub    $0x1,%ebx
+  800d16:	74 16                	je     800d2e <strlcpy+0x2f>
+  800d18:	01 f3                	add    %esi,%ebx
+  800d1a:	0f b6 0a             	movzbl (%edx),%ecx
+  800d1d:	84 c9                	test   %cl,%cl
+  800d1f:	74 0d                	je     800d2e <strlcpy+0x2f>
+			*dst++ = *src++;
+  800d21:	83 c2 01             	add    $0x1,%edx
+  800d24:	83 c0 01             	add    $0x1,%eax
+  800d27:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800d2a:	39 d8                	cmp    %ebx,%eax
+  800d2c:	75 ec                	jne    800d1a <strlcpy+0x1b>
+		*dst = '\0';
+  800d2e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800d31:	29 f0                	sub    %esi,%eax
+}
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5d                   	pop    %ebp
+  800d36:	c3                   	ret
+
+00800d37 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d40:	0f b6 01             	movzbl (%ecx),%eax
+  800d43:	84 c0                	test   %al,%al
+  800d45:	74 11                	je     800d58 <strcmp+0x21>
+  800d47:	38 02                	cmp    %al,(%edx)
+  800d49:	75 0d                	jne    800d58 <strcmp+0x21>
+		p++, q++;
+  800d4b:	83 c1 01             	add    $0x1,%ecx
+  800d4e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d51:	0f b6 01             	movzbl (%ecx),%eax
+  800d54:	84 c0                	test   %al,%al
+  800d56:	75 ef                	jne    800d47 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d58:	0f b6 c0             	movzbl %al,%eax
+  800d5b:	0f b6 12             	movzbl (%edx),%edx
+  800d5e:	29 d0                	sub    %edx,%eax
+}
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	53                   	push   %ebx
+  800d66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d6c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800d74:	85 d2                	test   %edx,%edx
+  800d76:	74 2e                	je     800da6 <strncmp+0x44>
+  800d78:	0f b6 01             	movzbl (%ecx),%eax
+  800d7b:	84 c0                	test   %al,%al
+  800d7d:	74 16                	je     800d95 <strncmp+0x33>
+  800d7f:	3a 03                	cmp    (%ebx),%al
+  800d81:	75 12                	jne    800d95 <strncmp+0x33>
+		n--, p++, q++;
+  800d83:	83 c1 01             	add    $0x1,%ecx
+  800d86:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800d89:	83 ea 01             	sub    $0x1,%edx
+  800d8c:	75 ea                	jne    800d78 <strncmp+0x16>
+		return 0;
+  800d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d93:	eb 11                	jmp    800da6 <strncmp+0x44>
+  800d95:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800d9a:	85 d2                	test   %edx,%edx
+  800d9c:	74 08                	je     800da6 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d9e:	0f b6 01             	movzbl (%ecx),%eax
+  800da1:	0f b6 13             	movzbl (%ebx),%edx
+  800da4:	29 d0                	sub    %edx,%eax
+}
+  800da6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800da9:	c9                   	leave
+  800daa:	c3                   	ret
+
+00800dab <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800db5:	0f b6 10             	movzbl (%eax),%edx
+  800db8:	84 d2                	test   %dl,%dl
+  800dba:	74 15                	je     800dd1 <strchr+0x26>
+		if (*s == c)
+  800dbc:	38 d1                	cmp    %dl,%cl
+  800dbe:	74 0f                	je     800dcf <strchr+0x24>
+	for (; *s; s++)
+  800dc0:	83 c0 01             	add    $0x1,%eax
+  800dc3:	0f b6 10             	movzbl (%eax),%edx
+  800dc6:	84 d2                	test   %dl,%dl
+  800dc8:	75 f2                	jne    800dbc <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800dca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+	return 0;
+  800dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd6:	eb f7                	jmp    800dcf <strchr+0x24>
+
+00800dd8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800dd8:	55                   	push   %ebp
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	53                   	push   %ebx
+  800ddc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800de2:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800de5:	38 d3                	cmp    %dl,%bl
+  800de7:	74 14                	je     800dfd <strfind+0x25>
+  800de9:	89 d1                	mov    %edx,%ecx
+  800deb:	84 db                	test   %bl,%bl
+  800ded:	74 0e                	je     800dfd <strfind+0x25>
+	for (; *s; s++)
+  800def:	83 c0 01             	add    $0x1,%eax
+  800df2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800df5:	38 ca                	cmp    %cl,%dl
+  800df7:	74 04                	je     800dfd <strfind+0x25>
+  800df9:	84 d2                	test   %dl,%dl
+  800dfb:	75 f2                	jne    800def <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800dfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e00:	c9                   	leave
+  800e01:	c3                   	ret
+
+00800e02 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e02:	55                   	push   %ebp
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	57                   	push   %edi
+  800e06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e09:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e0c:	85 c9                	test   %ecx,%ecx
+  800e0e:	74 20                	je     800e30 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e10:	89 f8                	mov    %edi,%eax
+  800e12:	09 c8                	or     %ecx,%eax
+  800e14:	a8 03                	test   $0x3,%al
+  800e16:	75 12                	jne    800e2a <memset+0x28>
+		c &= 0xFF;
+  800e18:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e1c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e22:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e25:	fc                   	cld
+  800e26:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e28:	eb 06                	jmp    800e30 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e2d:	fc                   	cld
+  800e2e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e30:	89 f8                	mov    %edi,%eax
+  800e32:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e35:	c9                   	leave
+  800e36:	c3                   	ret
+
+00800e37 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	57                   	push   %edi
+  800e3b:	56                   	push   %esi
+  800e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e45:	39 c6                	cmp    %eax,%esi
+  800e47:	73 32                	jae    800e7b <memmove+0x44>
+  800e49:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e4c:	39 d0                	cmp    %edx,%eax
+  800e4e:	73 2b                	jae    800e7b <memmove+0x44>
+		s += n;
+		d += n;
+  800e50:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e53:	89 d6                	mov    %edx,%esi
+  800e55:	09 fe                	or     %edi,%esi
+  800e57:	09 ce                	or     %ecx,%esi
+  800e59:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e5f:	75 0e                	jne    800e6f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e61:	83 ef 04             	sub    $0x4,%edi
+  800e64:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e67:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e6a:	fd                   	std
+  800e6b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e6d:	eb 09                	jmp    800e78 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e6f:	83 ef 01             	sub    $0x1,%edi
+  800e72:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e75:	fd                   	std
+  800e76:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e78:	fc                   	cld
+  800e79:	eb 1a                	jmp    800e95 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e7b:	89 f2                	mov    %esi,%edx
+  800e7d:	09 c2                	or     %eax,%edx
+  800e7f:	09 ca                	or     %ecx,%edx
+  800e81:	f6 c2 03             	test   $0x3,%dl
+  800e84:	75 0a                	jne    800e90 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e86:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e89:	89 c7                	mov    %eax,%edi
+  800e8b:	fc                   	cld
+  800e8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e8e:	eb 05                	jmp    800e95 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e90:	89 c7                	mov    %eax,%edi
+  800e92:	fc                   	cld
+  800e93:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e95:	5e                   	pop    %esi
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+
+00800e99 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e9f:	ff 75 10             	push   0x10(%ebp)
+  800ea2:	ff 75 0c             	push   0xc(%ebp)
+  800ea5:	ff 75 08             	push   0x8(%ebp)
+  800ea8:	e8 8a ff ff ff       	call   800e37 <memmove>
+}
+  800ead:	c9                   	leave
+  800eae:	c3                   	ret
+
+00800eaf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+  800eb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800eba:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ebd:	85 f6                	test   %esi,%esi
+  800ebf:	74 29                	je     800eea <memcmp+0x3b>
+  800ec1:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800ec3:	0f b6 08             	movzbl (%eax),%ecx
+  800ec6:	0f b6 1a             	movzbl (%edx),%ebx
+  800ec9:	38 d9                	cmp    %bl,%cl
+  800ecb:	75 11                	jne    800ede <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ecd:	83 c0 01             	add    $0x1,%eax
+  800ed0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ed3:	39 c6                	cmp    %eax,%esi
+  800ed5:	75 ec                	jne    800ec3 <memcmp+0x14>
+	}
+
+	return 0;
+  800ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edc:	eb 08                	jmp    800ee6 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ede:	0f b6 c1             	movzbl %cl,%eax
+  800ee1:	0f b6 db             	movzbl %bl,%ebx
+  800ee4:	29 d8                	sub    %ebx,%eax
+}
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+	return 0;
+  800eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eef:	eb f5                	jmp    800ee6 <memcmp+0x37>
+
+00800ef1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800efa:	89 c2                	mov    %eax,%edx
+  800efc:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800eff:	39 d0                	cmp    %edx,%eax
+  800f01:	73 0d                	jae    800f10 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f03:	38 08                	cmp    %cl,(%eax)
+  800f05:	74 0d                	je     800f14 <memfind+0x23>
+	for (; s < ends; s++)
+  800f07:	83 c0 01             	add    $0x1,%eax
+  800f0a:	39 c2                	cmp    %eax,%edx
+  800f0c:	75 f5                	jne    800f03 <memfind+0x12>
+  800f0e:	eb 06                	jmp    800f16 <memfind+0x25>
+  800f10:	89 c2                	mov    %eax,%edx
+  800f12:	eb 02                	jmp    800f16 <memfind+0x25>
+  800f14:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800f16:	89 d0                	mov    %edx,%eax
+  800f18:	5d                   	pop    %ebp
+  800f19:	c3                   	ret
+
+00800f1a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	56                   	push   %esi
+  800f1f:	53                   	push   %ebx
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f26:	0f b6 02             	movzbl (%edx),%eax
+  800f29:	3c 20                	cmp    $0x20,%al
+  800f2b:	74 04                	je     800f31 <strtol+0x17>
+  800f2d:	3c 09                	cmp    $0x9,%al
+  800f2f:	75 0e                	jne    800f3f <strtol+0x25>
+		s++;
+  800f31:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800f34:	0f b6 02             	movzbl (%edx),%eax
+  800f37:	3c 20                	cmp    $0x20,%al
+  800f39:	74 f6                	je     800f31 <strtol+0x17>
+  800f3b:	3c 09                	cmp    $0x9,%al
+  800f3d:	74 f2                	je     800f31 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f3f:	3c 2b                	cmp    $0x2b,%al
+  800f41:	74 2a                	je     800f6d <strtol+0x53>
+	int neg = 0;
+  800f43:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f48:	3c 2d                	cmp    $0x2d,%al
+  800f4a:	74 2b                	je     800f77 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f4c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f52:	75 0f                	jne    800f63 <strtol+0x49>
+  800f54:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f57:	74 28                	je     800f81 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f59:	85 db                	test   %ebx,%ebx
+  800f5b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f60:	0f 44 d8             	cmove  %eax,%ebx
+  800f63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f68:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f6b:	eb 46                	jmp    800fb3 <strtol+0x99>
+		s++;
+  800f6d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800f70:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f75:	eb d5                	jmp    800f4c <strtol+0x32>
+		s++, neg = 1;
+  800f77:	83 c2 01             	add    $0x1,%edx
+  800f7a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f7f:	eb cb                	jmp    800f4c <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f81:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f85:	74 0e                	je     800f95 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800f87:	85 db                	test   %ebx,%ebx
+  800f89:	75 d8                	jne    800f63 <strtol+0x49>
+		s++, base = 8;
+  800f8b:	83 c2 01             	add    $0x1,%edx
+  800f8e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f93:	eb ce                	jmp    800f63 <strtol+0x49>
+		s += 2, base = 16;
+  800f95:	83 c2 02             	add    $0x2,%edx
+  800f98:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f9d:	eb c4                	jmp    800f63 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f9f:	0f be c0             	movsbl %al,%eax
+  800fa2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800fa5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fa8:	7d 3a                	jge    800fe4 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800faa:	83 c2 01             	add    $0x1,%edx
+  800fad:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fb1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800fb3:	0f b6 02             	movzbl (%edx),%eax
+  800fb6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800fb9:	89 f3                	mov    %esi,%ebx
+  800fbb:	80 fb 09             	cmp    $0x9,%bl
+  800fbe:	76 df                	jbe    800f9f <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800fc0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800fc3:	89 f3                	mov    %esi,%ebx
+  800fc5:	80 fb 19             	cmp    $0x19,%bl
+  800fc8:	77 08                	ja     800fd2 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800fca:	0f be c0             	movsbl %al,%eax
+  800fcd:	83 e8 57             	sub    $0x57,%eax
+  800fd0:	eb d3                	jmp    800fa5 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800fd2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800fd5:	89 f3                	mov    %esi,%ebx
+  800fd7:	80 fb 19             	cmp    $0x19,%bl
+  800fda:	77 08                	ja     800fe4 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800fdc:	0f be c0             	movsbl %al,%eax
+  800fdf:	83 e8 37             	sub    $0x37,%eax
+  800fe2:	eb c1                	jmp    800fa5 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800fe4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800fe8:	74 05                	je     800fef <strtol+0xd5>
+		*endptr = (char *) s;
+  800fea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fed:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800fef:	89 c8                	mov    %ecx,%eax
+  800ff1:	f7 d8                	neg    %eax
+  800ff3:	85 ff                	test   %edi,%edi
+  800ff5:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ff8:	89 c8                	mov    %ecx,%eax
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5e                   	pop    %esi
+  800ffc:	5f                   	pop    %edi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+
+00800fff <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801010:	89 c3                	mov    %eax,%ebx
+  801012:	89 c7                	mov    %eax,%edi
+  801014:	89 c6                	mov    %eax,%esi
+  801016:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+
+0080101d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801023:	ba 00 00 00 00       	mov    $0x0,%edx
+  801028:	b8 01 00 00 00       	mov    $0x1,%eax
+  80102d:	89 d1                	mov    %edx,%ecx
+  80102f:	89 d3                	mov    %edx,%ebx
+  801031:	89 d7                	mov    %edx,%edi
+  801033:	89 d6                	mov    %edx,%esi
+  801035:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	57                   	push   %edi
+  801040:	56                   	push   %esi
+  801041:	53                   	push   %ebx
+  801042:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801045:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801052:	89 cb                	mov    %ecx,%ebx
+  801054:	89 cf                	mov    %ecx,%edi
+  801056:	89 ce                	mov    %ecx,%esi
+  801058:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	7f 08                	jg     801066 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	50                   	push   %eax
+  80106a:	6a 03                	push   $0x3
+  80106c:	68 8b 4a 80 00       	push   $0x804a8b
+  801071:	6a 23                	push   $0x23
+  801073:	68 a8 4a 80 00       	push   $0x804aa8
+  801078:	e8 38 f4 ff ff       	call   8004b5 <_panic>
+
+0080107d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801083:	ba 00 00 00 00       	mov    $0x0,%edx
+  801088:	b8 02 00 00 00       	mov    $0x2,%eax
+  80108d:	89 d1                	mov    %edx,%ecx
+  80108f:	89 d3                	mov    %edx,%ebx
+  801091:	89 d7                	mov    %edx,%edi
+  801093:	89 d6                	mov    %edx,%esi
+  801095:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801097:	5b                   	pop    %ebx
+  801098:	5e                   	pop    %esi
+  801099:	5f                   	pop    %edi
+  80109a:	5d                   	pop    %ebp
+  80109b:	c3                   	ret
+
+0080109c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	57                   	push   %edi
+  8010a0:	56                   	push   %esi
+  8010a1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010ac:	89 d1                	mov    %edx,%ecx
+  8010ae:	89 d3                	mov    %edx,%ebx
+  8010b0:	89 d7                	mov    %edx,%edi
+  8010b2:	89 d6                	mov    %edx,%esi
+  8010b4:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010b6:	5b                   	pop    %ebx
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5f                   	pop    %edi
+  8010b9:	5d                   	pop    %ebp
+  8010ba:	c3                   	ret
+
+008010bb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cf:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d7:	89 f7                	mov    %esi,%edi
+  8010d9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010db:	85 c0                	test   %eax,%eax
+  8010dd:	7f 08                	jg     8010e7 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8010df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e2:	5b                   	pop    %ebx
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5f                   	pop    %edi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+  8010ea:	50                   	push   %eax
+  8010eb:	6a 04                	push   $0x4
+  8010ed:	68 8b 4a 80 00       	push   $0x804a8b
+  8010f2:	6a 23                	push   $0x23
+  8010f4:	68 a8 4a 80 00       	push   $0x804aa8
+  8010f9:	e8 b7 f3 ff ff       	call   8004b5 <_panic>
+
+008010fe <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  801104:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801112:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801115:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801118:	8b 75 18             	mov    0x18(%ebp),%esi
+  80111b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	7f 08                	jg     801129 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801124:	5b                   	pop    %ebx
+  801125:	5e                   	pop    %esi
+  801126:	5f                   	pop    %edi
+  801127:	5d                   	pop    %ebp
+  801128:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801129:	83 ec 0c             	sub    $0xc,%esp
+  80112c:	50                   	push   %eax
+  80112d:	6a 05                	push   $0x5
+  80112f:	68 8b 4a 80 00       	push   $0x804a8b
+  801134:	6a 23                	push   $0x23
+  801136:	68 a8 4a 80 00       	push   $0x804aa8
+  80113b:	e8 75 f3 ff ff       	call   8004b5 <_panic>
+
+00801140 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+  801146:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	b8 06 00 00 00       	mov    $0x6,%eax
+  801159:	89 df                	mov    %ebx,%edi
+  80115b:	89 de                	mov    %ebx,%esi
+  80115d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80115f:	85 c0                	test   %eax,%eax
+  801161:	7f 08                	jg     80116b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801166:	5b                   	pop    %ebx
+  801167:	5e                   	pop    %esi
+  801168:	5f                   	pop    %edi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80116b:	83 ec 0c             	sub    $0xc,%esp
+  80116e:	50                   	push   %eax
+  80116f:	6a 06                	push   $0x6
+  801171:	68 8b 4a 80 00       	push   $0x804a8b
+  801176:	6a 23                	push   $0x23
+  801178:	68 a8 4a 80 00       	push   $0x804aa8
+  80117d:	e8 33 f3 ff ff       	call   8004b5 <_panic>
+
+00801182 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	57                   	push   %edi
+  801186:	56                   	push   %esi
+  801187:	53                   	push   %ebx
+  801188:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80118b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801190:	8b 55 08             	mov    0x8(%ebp),%edx
+  801193:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801196:	b8 08 00 00 00       	mov    $0x8,%eax
+  80119b:	89 df                	mov    %ebx,%edi
+  80119d:	89 de                	mov    %ebx,%esi
+  80119f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a1:	85 c0                	test   %eax,%eax
+  8011a3:	7f 08                	jg     8011ad <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a8:	5b                   	pop    %ebx
+  8011a9:	5e                   	pop    %esi
+  8011aa:	5f                   	pop    %edi
+  8011ab:	5d                   	pop    %ebp
+  8011ac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ad:	83 ec 0c             	sub    $0xc,%esp
+  8011b0:	50                   	push   %eax
+  8011b1:	6a 08                	push   $0x8
+  8011b3:	68 8b 4a 80 00       	push   $0x804a8b
+  8011b8:	6a 23                	push   $0x23
+  8011ba:	68 a8 4a 80 00       	push   $0x804aa8
+  8011bf:	e8 f1 f2 ff ff       	call   8004b5 <_panic>
+
+008011c4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011c4:	55                   	push   %ebp
+  8011c5:	89 e5                	mov    %esp,%ebp
+  8011c7:	57                   	push   %edi
+  8011c8:	56                   	push   %esi
+  8011c9:	53                   	push   %ebx
+  8011ca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011dd:	89 df                	mov    %ebx,%edi
+  8011df:	89 de                	mov    %ebx,%esi
+  8011e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e3:	85 c0                	test   %eax,%eax
+  8011e5:	7f 08                	jg     8011ef <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8011e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ea:	5b                   	pop    %ebx
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5f                   	pop    %edi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	50                   	push   %eax
+  8011f3:	6a 09                	push   $0x9
+  8011f5:	68 8b 4a 80 00       	push   $0x804a8b
+  8011fa:	6a 23                	push   $0x23
+  8011fc:	68 a8 4a 80 00       	push   $0x804aa8
+  801201:	e8 af f2 ff ff       	call   8004b5 <_panic>
+
+00801206 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+  80120c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80120f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801214:	8b 55 08             	mov    0x8(%ebp),%edx
+  801217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80121f:	89 df                	mov    %ebx,%edi
+  801221:	89 de                	mov    %ebx,%esi
+  801223:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801225:	85 c0                	test   %eax,%eax
+  801227:	7f 08                	jg     801231 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801229:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122c:	5b                   	pop    %ebx
+  80122d:	5e                   	pop    %esi
+  80122e:	5f                   	pop    %edi
+  80122f:	5d                   	pop    %ebp
+  801230:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801231:	83 ec 0c             	sub    $0xc,%esp
+  801234:	50                   	push   %eax
+  801235:	6a 0a                	push   $0xa
+  801237:	68 8b 4a 80 00       	push   $0x804a8b
+  80123c:	6a 23                	push   $0x23
+  80123e:	68 a8 4a 80 00       	push   $0x804aa8
+  801243:	e8 6d f2 ff ff       	call   8004b5 <_panic>
+
+00801248 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	57                   	push   %edi
+  80124c:	56                   	push   %esi
+  80124d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801251:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801254:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801259:	be 00 00 00 00       	mov    $0x0,%esi
+  80125e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801261:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801264:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+
+0080126b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+  801271:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801274:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801281:	89 cb                	mov    %ecx,%ebx
+  801283:	89 cf                	mov    %ecx,%edi
+  801285:	89 ce                	mov    %ecx,%esi
+  801287:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	7f 08                	jg     801295 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80128d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801290:	5b                   	pop    %ebx
+  801291:	5e                   	pop    %esi
+  801292:	5f                   	pop    %edi
+  801293:	5d                   	pop    %ebp
+  801294:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801295:	83 ec 0c             	sub    $0xc,%esp
+  801298:	50                   	push   %eax
+  801299:	6a 0d                	push   $0xd
+  80129b:	68 8b 4a 80 00       	push   $0x804a8b
+  8012a0:	6a 23                	push   $0x23
+  8012a2:	68 a8 4a 80 00       	push   $0x804aa8
+  8012a7:	e8 09 f2 ff ff       	call   8004b5 <_panic>
+
+008012ac <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012c6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8012c8:	5b                   	pop    %ebx
+  8012c9:	5e                   	pop    %esi
+  8012ca:	5f                   	pop    %edi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	c3                   	ret
+
+008012cd <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	57                   	push   %edi
+  8012d1:	56                   	push   %esi
+  8012d2:	53                   	push   %ebx
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012e6:	89 df                	mov    %ebx,%edi
+  8012e8:	89 de                	mov    %ebx,%esi
+  8012ea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ec:	85 c0                	test   %eax,%eax
+  8012ee:	7f 08                	jg     8012f8 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8012f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f8:	83 ec 0c             	sub    $0xc,%esp
+  8012fb:	50                   	push   %eax
+  8012fc:	6a 0d                	push   $0xd
+  8012fe:	68 8b 4a 80 00       	push   $0x804a8b
+  801303:	6a 23                	push   $0x23
+  801305:	68 a8 4a 80 00       	push   $0x804aa8
+  80130a:	e8 a6 f1 ff ff       	call   8004b5 <_panic>
+
+0080130f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801315:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80131f:	89 d1                	mov    %edx,%ecx
+  801321:	89 d3                	mov    %edx,%ebx
+  801323:	89 d7                	mov    %edx,%edi
+  801325:	89 d6                	mov    %edx,%esi
+  801327:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+
+0080132e <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	57                   	push   %edi
+  801332:	56                   	push   %esi
+  801333:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801334:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801339:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801344:	89 df                	mov    %ebx,%edi
+  801346:	89 de                	mov    %ebx,%esi
+  801348:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80134a:	5b                   	pop    %ebx
+  80134b:	5e                   	pop    %esi
+  80134c:	5f                   	pop    %edi
+  80134d:	5d                   	pop    %ebp
+  80134e:	c3                   	ret
+
+0080134f <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80134f:	55                   	push   %ebp
+  801350:	89 e5                	mov    %esp,%ebp
+  801352:	57                   	push   %edi
+  801353:	56                   	push   %esi
+  801354:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801355:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801362:	89 cb                	mov    %ecx,%ebx
+  801364:	89 cf                	mov    %ecx,%edi
+  801366:	89 ce                	mov    %ecx,%esi
+  801368:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80136a:	5b                   	pop    %ebx
+  80136b:	5e                   	pop    %esi
+  80136c:	5f                   	pop    %edi
+  80136d:	5d                   	pop    %ebp
+  80136e:	c3                   	ret
+
+0080136f <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80136f:	55                   	push   %ebp
+  801370:	89 e5                	mov    %esp,%ebp
+  801372:	57                   	push   %edi
+  801373:	56                   	push   %esi
+  801374:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801380:	b8 11 00 00 00       	mov    $0x11,%eax
+  801385:	89 df                	mov    %ebx,%edi
+  801387:	89 de                	mov    %ebx,%esi
+  801389:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	56                   	push   %esi
+  801395:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013a6:	89 df                	mov    %ebx,%edi
+  8013a8:	89 de                	mov    %ebx,%esi
+  8013aa:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8013ac:	5b                   	pop    %ebx
+  8013ad:	5e                   	pop    %esi
+  8013ae:	5f                   	pop    %edi
+  8013af:	5d                   	pop    %ebp
+  8013b0:	c3                   	ret
+
+008013b1 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	57                   	push   %edi
+  8013b5:	56                   	push   %esi
+  8013b6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013c4:	89 cb                	mov    %ecx,%ebx
+  8013c6:	89 cf                	mov    %ecx,%edi
+  8013c8:	89 ce                	mov    %ecx,%esi
+  8013ca:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8013cc:	5b                   	pop    %ebx
+  8013cd:	5e                   	pop    %esi
+  8013ce:	5f                   	pop    %edi
+  8013cf:	5d                   	pop    %ebp
+  8013d0:	c3                   	ret
+
+008013d1 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	57                   	push   %edi
+  8013d5:	56                   	push   %esi
+  8013d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013e7:	89 df                	mov    %ebx,%edi
+  8013e9:	89 de                	mov    %ebx,%esi
+  8013eb:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8013ed:	5b                   	pop    %ebx
+  8013ee:	5e                   	pop    %esi
+  8013ef:	5f                   	pop    %edi
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+
+008013f2 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8013f2:	55                   	push   %ebp
+  8013f3:	89 e5                	mov    %esp,%ebp
+  8013f5:	57                   	push   %edi
+  8013f6:	56                   	push   %esi
+  8013f7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801400:	b8 15 00 00 00       	mov    $0x15,%eax
+  801405:	89 cb                	mov    %ecx,%ebx
+  801407:	89 cf                	mov    %ecx,%edi
+  801409:	89 ce                	mov    %ecx,%esi
+  80140b:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80140d:	5b                   	pop    %ebx
+  80140e:	5e                   	pop    %esi
+  80140f:	5f                   	pop    %edi
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+
+00801412 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	57                   	push   %edi
+  801416:	56                   	push   %esi
+  801417:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801418:	be 00 00 00 00       	mov    $0x0,%esi
+  80141d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801423:	b8 16 00 00 00       	mov    $0x16,%eax
+  801428:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142b:	89 f7                	mov    %esi,%edi
+  80142d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80142f:	5b                   	pop    %ebx
+  801430:	5e                   	pop    %esi
+  801431:	5f                   	pop    %edi
+  801432:	5d                   	pop    %ebp
+  801433:	c3                   	ret
+
+00801434 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801434:	55                   	push   %ebp
+  801435:	89 e5                	mov    %esp,%ebp
+  801437:	57                   	push   %edi
+  801438:	56                   	push   %esi
+  801439:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80143a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801442:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801445:	b8 17 00 00 00       	mov    $0x17,%eax
+  80144a:	89 df                	mov    %ebx,%edi
+  80144c:	89 de                	mov    %ebx,%esi
+  80144e:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+
+00801455 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	57                   	push   %edi
+  801459:	56                   	push   %esi
+  80145a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80145b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801460:	8b 55 08             	mov    0x8(%ebp),%edx
+  801463:	b8 18 00 00 00       	mov    $0x18,%eax
+  801468:	89 cb                	mov    %ecx,%ebx
+  80146a:	89 cf                	mov    %ecx,%edi
+  80146c:	89 ce                	mov    %ecx,%esi
+  80146e:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+
+00801475 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801475:	55                   	push   %ebp
+  801476:	89 e5                	mov    %esp,%ebp
+  801478:	57                   	push   %edi
+  801479:	56                   	push   %esi
+  80147a:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80147b:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80147f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801487:	b8 19 00 00 00       	mov    $0x19,%eax
+  80148c:	89 df                	mov    %ebx,%edi
+  80148e:	89 de                	mov    %ebx,%esi
+  801490:	cd 30                	int    $0x30
+}
+  801492:	5b                   	pop    %ebx
+  801493:	5e                   	pop    %esi
+  801494:	5f                   	pop    %edi
+  801495:	5d                   	pop    %ebp
+  801496:	c3                   	ret
+
+00801497 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	57                   	push   %edi
+  80149b:	56                   	push   %esi
+  80149c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80149d:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b0:	89 f7                	mov    %esi,%edi
+  8014b2:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8014b4:	5b                   	pop    %ebx
+  8014b5:	5e                   	pop    %esi
+  8014b6:	5f                   	pop    %edi
+  8014b7:	5d                   	pop    %ebp
+  8014b8:	c3                   	ret
+
+008014b9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	57                   	push   %edi
+  8014bd:	56                   	push   %esi
+  8014be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d2:	89 f7                	mov    %esi,%edi
+  8014d4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8014d6:	5b                   	pop    %ebx
+  8014d7:	5e                   	pop    %esi
+  8014d8:	5f                   	pop    %edi
+  8014d9:	5d                   	pop    %ebp
+  8014da:	c3                   	ret
+
+008014db <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8014db:	55                   	push   %ebp
+  8014dc:	89 e5                	mov    %esp,%ebp
+  8014de:	57                   	push   %edi
+  8014df:	56                   	push   %esi
+  8014e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ec:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014f1:	89 df                	mov    %ebx,%edi
+  8014f3:	89 de                	mov    %ebx,%esi
+  8014f5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8014f7:	5b                   	pop    %ebx
+  8014f8:	5e                   	pop    %esi
+  8014f9:	5f                   	pop    %edi
+  8014fa:	5d                   	pop    %ebp
+  8014fb:	c3                   	ret
+
+008014fc <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	57                   	push   %edi
+  801500:	56                   	push   %esi
+  801501:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801502:	be 00 00 00 00       	mov    $0x0,%esi
+  801507:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801515:	89 f7                	mov    %esi,%edi
+  801517:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801519:	5b                   	pop    %ebx
+  80151a:	5e                   	pop    %esi
+  80151b:	5f                   	pop    %edi
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+
+0080151e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801521:	8b 45 08             	mov    0x8(%ebp),%eax
+  801524:	05 00 00 00 30       	add    $0x30000000,%eax
+  801529:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80152c:	5d                   	pop    %ebp
+  80152d:	c3                   	ret
+
+0080152e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801531:	8b 45 08             	mov    0x8(%ebp),%eax
+  801534:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801539:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80153e:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801543:	5d                   	pop    %ebp
+  801544:	c3                   	ret
+
+00801545 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801545:	55                   	push   %ebp
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80154d:	89 c2                	mov    %eax,%edx
+  80154f:	c1 ea 16             	shr    $0x16,%edx
+  801552:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801559:	f6 c2 01             	test   $0x1,%dl
+  80155c:	74 29                	je     801587 <fd_alloc+0x42>
+  80155e:	89 c2                	mov    %eax,%edx
+  801560:	c1 ea 0c             	shr    $0xc,%edx
+  801563:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80156a:	f6 c2 01             	test   $0x1,%dl
+  80156d:	74 18                	je     801587 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80156f:	05 00 10 00 00       	add    $0x1000,%eax
+  801574:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801579:	75 d2                	jne    80154d <fd_alloc+0x8>
+  80157b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801580:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801585:	eb 05                	jmp    80158c <fd_alloc+0x47>
+			return 0;
+  801587:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80158c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158f:	89 02                	mov    %eax,(%edx)
+}
+  801591:	89 c8                	mov    %ecx,%eax
+  801593:	5d                   	pop    %ebp
+  801594:	c3                   	ret
+
+00801595 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801595:	55                   	push   %ebp
+  801596:	89 e5                	mov    %esp,%ebp
+  801598:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80159b:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8015a0:	77 30                	ja     8015d2 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015a2:	c1 e0 0c             	shl    $0xc,%eax
+  8015a5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8015aa:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015b0:	f6 c2 01             	test   $0x1,%dl
+  8015b3:	74 24                	je     8015d9 <fd_lookup+0x44>
+  8015b5:	89 c2                	mov    %eax,%edx
+  8015b7:	c1 ea 0c             	shr    $0xc,%edx
+  8015ba:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015c1:	f6 c2 01             	test   $0x1,%dl
+  8015c4:	74 1a                	je     8015e0 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015c9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d0:	5d                   	pop    %ebp
+  8015d1:	c3                   	ret
+		return -E_INVAL;
+  8015d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d7:	eb f7                	jmp    8015d0 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8015d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015de:	eb f0                	jmp    8015d0 <fd_lookup+0x3b>
+  8015e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e5:	eb e9                	jmp    8015d0 <fd_lookup+0x3b>
+
+008015e7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	53                   	push   %ebx
+  8015eb:	83 ec 04             	sub    $0x4,%esp
+  8015ee:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f6:	bb c0 67 80 00       	mov    $0x8067c0,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8015fb:	39 13                	cmp    %edx,(%ebx)
+  8015fd:	74 54                	je     801653 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8015ff:	83 c0 01             	add    $0x1,%eax
+  801602:	8b 1c 85 34 4b 80 00 	mov    0x804b34(,%eax,4),%ebx
+  801609:	85 db                	test   %ebx,%ebx
+  80160b:	75 ee                	jne    8015fb <dev_lookup+0x14>
+  80160d:	89 e1                	mov    %esp,%ecx
+  80160f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801614:	29 c8                	sub    %ecx,%eax
+  801616:	89 c1                	mov    %eax,%ecx
+  801618:	c1 e9 0f             	shr    $0xf,%ecx
+  80161b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801620:	b8 00 00 00 00       	mov    $0x0,%eax
+  801625:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801628:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  80162f:	8b 40 48             	mov    0x48(%eax),%eax
+  801632:	83 ec 04             	sub    $0x4,%esp
+  801635:	52                   	push   %edx
+  801636:	50                   	push   %eax
+  801637:	68 b8 4a 80 00       	push   $0x804ab8
+  80163c:	e8 4f ef ff ff       	call   800590 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801641:	83 c4 10             	add    $0x10,%esp
+  801644:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801649:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80164c:	89 1a                	mov    %ebx,(%edx)
+}
+  80164e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801651:	c9                   	leave
+  801652:	c3                   	ret
+			return 0;
+  801653:	b8 00 00 00 00       	mov    $0x0,%eax
+  801658:	eb ef                	jmp    801649 <dev_lookup+0x62>
+
+0080165a <fd_close>:
+{
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	57                   	push   %edi
+  80165e:	56                   	push   %esi
+  80165f:	53                   	push   %ebx
+  801660:	83 ec 24             	sub    $0x24,%esp
+  801663:	8b 75 08             	mov    0x8(%ebp),%esi
+  801666:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801669:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80166c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80166d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801673:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801676:	50                   	push   %eax
+  801677:	e8 19 ff ff ff       	call   801595 <fd_lookup>
+  80167c:	89 c3                	mov    %eax,%ebx
+  80167e:	83 c4 10             	add    $0x10,%esp
+  801681:	85 c0                	test   %eax,%eax
+  801683:	78 05                	js     80168a <fd_close+0x30>
+	    || fd != fd2)
+  801685:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801688:	74 0f                	je     801699 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80168a:	85 ff                	test   %edi,%edi
+  80168c:	0f 44 df             	cmove  %edi,%ebx
+}
+  80168f:	89 d8                	mov    %ebx,%eax
+  801691:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801694:	5b                   	pop    %ebx
+  801695:	5e                   	pop    %esi
+  801696:	5f                   	pop    %edi
+  801697:	5d                   	pop    %ebp
+  801698:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801699:	83 ec 08             	sub    $0x8,%esp
+  80169c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80169f:	50                   	push   %eax
+  8016a0:	ff 36                	push   (%esi)
+  8016a2:	e8 40 ff ff ff       	call   8015e7 <dev_lookup>
+  8016a7:	89 c3                	mov    %eax,%ebx
+  8016a9:	83 c4 10             	add    $0x10,%esp
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	78 1a                	js     8016ca <fd_close+0x70>
+		if (dev->dev_close)
+  8016b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016b3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016bb:	85 c0                	test   %eax,%eax
+  8016bd:	74 0b                	je     8016ca <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8016bf:	83 ec 0c             	sub    $0xc,%esp
+  8016c2:	56                   	push   %esi
+  8016c3:	ff d0                	call   *%eax
+  8016c5:	89 c3                	mov    %eax,%ebx
+  8016c7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016ca:	83 ec 08             	sub    $0x8,%esp
+  8016cd:	56                   	push   %esi
+  8016ce:	6a 00                	push   $0x0
+  8016d0:	e8 6b fa ff ff       	call   801140 <sys_page_unmap>
+	return r;
+  8016d5:	83 c4 10             	add    $0x10,%esp
+  8016d8:	eb b5                	jmp    80168f <fd_close+0x35>
+
+008016da <close>:
+
+int
+close(int fdnum)
+{
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e3:	50                   	push   %eax
+  8016e4:	ff 75 08             	push   0x8(%ebp)
+  8016e7:	e8 a9 fe ff ff       	call   801595 <fd_lookup>
+  8016ec:	83 c4 10             	add    $0x10,%esp
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	79 02                	jns    8016f5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016f3:	c9                   	leave
+  8016f4:	c3                   	ret
+		return fd_close(fd, 1);
+  8016f5:	83 ec 08             	sub    $0x8,%esp
+  8016f8:	6a 01                	push   $0x1
+  8016fa:	ff 75 f4             	push   -0xc(%ebp)
+  8016fd:	e8 58 ff ff ff       	call   80165a <fd_close>
+  801702:	83 c4 10             	add    $0x10,%esp
+  801705:	eb ec                	jmp    8016f3 <close+0x19>
+
+00801707 <close_all>:
+
+void
+close_all(void)
+{
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	53                   	push   %ebx
+  80170b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80170e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801713:	83 ec 0c             	sub    $0xc,%esp
+  801716:	53                   	push   %ebx
+  801717:	e8 be ff ff ff       	call   8016da <close>
+	for (i = 0; i < MAXFD; i++)
+  80171c:	83 c3 01             	add    $0x1,%ebx
+  80171f:	83 c4 10             	add    $0x10,%esp
+  801722:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801728:	75 e9                	jne    801713 <close_all+0xc>
+}
+  80172a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80172d:	c9                   	leave
+  80172e:	c3                   	ret
+
+0080172f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80172f:	55                   	push   %ebp
+  801730:	89 e5                	mov    %esp,%ebp
+  801732:	57                   	push   %edi
+  801733:	56                   	push   %esi
+  801734:	53                   	push   %ebx
+  801735:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801738:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80173b:	50                   	push   %eax
+  80173c:	ff 75 08             	push   0x8(%ebp)
+  80173f:	e8 51 fe ff ff       	call   801595 <fd_lookup>
+  801744:	89 c3                	mov    %eax,%ebx
+  801746:	83 c4 10             	add    $0x10,%esp
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	78 7f                	js     8017cc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80174d:	83 ec 0c             	sub    $0xc,%esp
+  801750:	ff 75 0c             	push   0xc(%ebp)
+  801753:	e8 82 ff ff ff       	call   8016da <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801758:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80175b:	c1 e6 0c             	shl    $0xc,%esi
+  80175e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801764:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801767:	89 3c 24             	mov    %edi,(%esp)
+  80176a:	e8 bf fd ff ff       	call   80152e <fd2data>
+  80176f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801771:	89 34 24             	mov    %esi,(%esp)
+  801774:	e8 b5 fd ff ff       	call   80152e <fd2data>
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80177f:	89 d8                	mov    %ebx,%eax
+  801781:	c1 e8 16             	shr    $0x16,%eax
+  801784:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80178b:	a8 01                	test   $0x1,%al
+  80178d:	74 11                	je     8017a0 <dup+0x71>
+  80178f:	89 d8                	mov    %ebx,%eax
+  801791:	c1 e8 0c             	shr    $0xc,%eax
+  801794:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80179b:	f6 c2 01             	test   $0x1,%dl
+  80179e:	75 36                	jne    8017d6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017a0:	89 f8                	mov    %edi,%eax
+  8017a2:	c1 e8 0c             	shr    $0xc,%eax
+  8017a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017ac:	83 ec 0c             	sub    $0xc,%esp
+  8017af:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017b4:	50                   	push   %eax
+  8017b5:	56                   	push   %esi
+  8017b6:	6a 00                	push   $0x0
+  8017b8:	57                   	push   %edi
+  8017b9:	6a 00                	push   $0x0
+  8017bb:	e8 3e f9 ff ff       	call   8010fe <sys_page_map>
+  8017c0:	89 c3                	mov    %eax,%ebx
+  8017c2:	83 c4 20             	add    $0x20,%esp
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	78 33                	js     8017fc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017cc:	89 d8                	mov    %ebx,%eax
+  8017ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d1:	5b                   	pop    %ebx
+  8017d2:	5e                   	pop    %esi
+  8017d3:	5f                   	pop    %edi
+  8017d4:	5d                   	pop    %ebp
+  8017d5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017dd:	83 ec 0c             	sub    $0xc,%esp
+  8017e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017e5:	50                   	push   %eax
+  8017e6:	ff 75 d4             	push   -0x2c(%ebp)
+  8017e9:	6a 00                	push   $0x0
+  8017eb:	53                   	push   %ebx
+  8017ec:	6a 00                	push   $0x0
+  8017ee:	e8 0b f9 ff ff       	call   8010fe <sys_page_map>
+  8017f3:	89 c3                	mov    %eax,%ebx
+  8017f5:	83 c4 20             	add    $0x20,%esp
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	79 a4                	jns    8017a0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017fc:	83 ec 08             	sub    $0x8,%esp
+  8017ff:	56                   	push   %esi
+  801800:	6a 00                	push   $0x0
+  801802:	e8 39 f9 ff ff       	call   801140 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801807:	83 c4 08             	add    $0x8,%esp
+  80180a:	ff 75 d4             	push   -0x2c(%ebp)
+  80180d:	6a 00                	push   $0x0
+  80180f:	e8 2c f9 ff ff       	call   801140 <sys_page_unmap>
+	return r;
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	eb b3                	jmp    8017cc <dup+0x9d>
+
+00801819 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	56                   	push   %esi
+  80181d:	53                   	push   %ebx
+  80181e:	83 ec 18             	sub    $0x18,%esp
+  801821:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801824:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801827:	50                   	push   %eax
+  801828:	53                   	push   %ebx
+  801829:	e8 67 fd ff ff       	call   801595 <fd_lookup>
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	85 c0                	test   %eax,%eax
+  801833:	78 3c                	js     801871 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801835:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801838:	83 ec 08             	sub    $0x8,%esp
+  80183b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80183e:	50                   	push   %eax
+  80183f:	ff 36                	push   (%esi)
+  801841:	e8 a1 fd ff ff       	call   8015e7 <dev_lookup>
+  801846:	83 c4 10             	add    $0x10,%esp
+  801849:	85 c0                	test   %eax,%eax
+  80184b:	78 24                	js     801871 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80184d:	8b 46 08             	mov    0x8(%esi),%eax
+  801850:	83 e0 03             	and    $0x3,%eax
+  801853:	83 f8 01             	cmp    $0x1,%eax
+  801856:	74 20                	je     801878 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801858:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185b:	8b 40 08             	mov    0x8(%eax),%eax
+  80185e:	85 c0                	test   %eax,%eax
+  801860:	74 54                	je     8018b6 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801862:	83 ec 04             	sub    $0x4,%esp
+  801865:	ff 75 10             	push   0x10(%ebp)
+  801868:	ff 75 0c             	push   0xc(%ebp)
+  80186b:	56                   	push   %esi
+  80186c:	ff d0                	call   *%eax
+  80186e:	83 c4 10             	add    $0x10,%esp
+}
+  801871:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801874:	5b                   	pop    %ebx
+  801875:	5e                   	pop    %esi
+  801876:	5d                   	pop    %ebp
+  801877:	c3                   	ret
+  801878:	89 e2                	mov    %esp,%edx
+  80187a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80187f:	29 d0                	sub    %edx,%eax
+  801881:	89 c2                	mov    %eax,%edx
+  801883:	c1 ea 0f             	shr    $0xf,%edx
+  801886:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80188b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801890:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801893:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  80189a:	8b 40 48             	mov    0x48(%eax),%eax
+  80189d:	83 ec 04             	sub    $0x4,%esp
+  8018a0:	53                   	push   %ebx
+  8018a1:	50                   	push   %eax
+  8018a2:	68 f9 4a 80 00       	push   $0x804af9
+  8018a7:	e8 e4 ec ff ff       	call   800590 <cprintf>
+		return -E_INVAL;
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b4:	eb bb                	jmp    801871 <read+0x58>
+		return -E_NOT_SUPP;
+  8018b6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018bb:	eb b4                	jmp    801871 <read+0x58>
+
+008018bd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018bd:	55                   	push   %ebp
+  8018be:	89 e5                	mov    %esp,%ebp
+  8018c0:	57                   	push   %edi
+  8018c1:	56                   	push   %esi
+  8018c2:	53                   	push   %ebx
+  8018c3:	83 ec 0c             	sub    $0xc,%esp
+  8018c6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8018c9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018cc:	85 f6                	test   %esi,%esi
+  8018ce:	74 30                	je     801900 <readn+0x43>
+  8018d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d5:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018da:	83 ec 04             	sub    $0x4,%esp
+  8018dd:	89 f2                	mov    %esi,%edx
+  8018df:	29 c2                	sub    %eax,%edx
+  8018e1:	52                   	push   %edx
+  8018e2:	01 f8                	add    %edi,%eax
+  8018e4:	50                   	push   %eax
+  8018e5:	ff 75 08             	push   0x8(%ebp)
+  8018e8:	e8 2c ff ff ff       	call   801819 <read>
+		if (m < 0)
+  8018ed:	83 c4 10             	add    $0x10,%esp
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	78 15                	js     801909 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8018f4:	74 11                	je     801907 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8018f6:	01 c3                	add    %eax,%ebx
+  8018f8:	89 d8                	mov    %ebx,%eax
+  8018fa:	39 f3                	cmp    %esi,%ebx
+  8018fc:	72 dc                	jb     8018da <readn+0x1d>
+  8018fe:	eb 09                	jmp    801909 <readn+0x4c>
+  801900:	b8 00 00 00 00       	mov    $0x0,%eax
+  801905:	eb 02                	jmp    801909 <readn+0x4c>
+  801907:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190c:	5b                   	pop    %ebx
+  80190d:	5e                   	pop    %esi
+  80190e:	5f                   	pop    %edi
+  80190f:	5d                   	pop    %ebp
+  801910:	c3                   	ret
+
+00801911 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	56                   	push   %esi
+  801915:	53                   	push   %ebx
+  801916:	83 ec 18             	sub    $0x18,%esp
+  801919:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80191c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80191f:	50                   	push   %eax
+  801920:	53                   	push   %ebx
+  801921:	e8 6f fc ff ff       	call   801595 <fd_lookup>
+  801926:	83 c4 10             	add    $0x10,%esp
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	78 37                	js     801964 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80192d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801930:	83 ec 08             	sub    $0x8,%esp
+  801933:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801936:	50                   	push   %eax
+  801937:	ff 36                	push   (%esi)
+  801939:	e8 a9 fc ff ff       	call   8015e7 <dev_lookup>
+  80193e:	83 c4 10             	add    $0x10,%esp
+  801941:	85 c0                	test   %eax,%eax
+  801943:	78 1f                	js     801964 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801945:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801949:	74 20                	je     80196b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80194b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801951:	85 c0                	test   %eax,%eax
+  801953:	74 54                	je     8019a9 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801955:	83 ec 04             	sub    $0x4,%esp
+  801958:	ff 75 10             	push   0x10(%ebp)
+  80195b:	ff 75 0c             	push   0xc(%ebp)
+  80195e:	56                   	push   %esi
+  80195f:	ff d0                	call   *%eax
+  801961:	83 c4 10             	add    $0x10,%esp
+}
+  801964:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801967:	5b                   	pop    %ebx
+  801968:	5e                   	pop    %esi
+  801969:	5d                   	pop    %ebp
+  80196a:	c3                   	ret
+  80196b:	89 e2                	mov    %esp,%edx
+  80196d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801972:	29 d0                	sub    %edx,%eax
+  801974:	89 c2                	mov    %eax,%edx
+  801976:	c1 ea 0f             	shr    $0xf,%edx
+  801979:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80197e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801983:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801986:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  80198d:	8b 40 48             	mov    0x48(%eax),%eax
+  801990:	83 ec 04             	sub    $0x4,%esp
+  801993:	53                   	push   %ebx
+  801994:	50                   	push   %eax
+  801995:	68 15 4b 80 00       	push   $0x804b15
+  80199a:	e8 f1 eb ff ff       	call   800590 <cprintf>
+		return -E_INVAL;
+  80199f:	83 c4 10             	add    $0x10,%esp
+  8019a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a7:	eb bb                	jmp    801964 <write+0x53>
+		return -E_NOT_SUPP;
+  8019a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019ae:	eb b4                	jmp    801964 <write+0x53>
+
+008019b0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8019b0:	55                   	push   %ebp
+  8019b1:	89 e5                	mov    %esp,%ebp
+  8019b3:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b9:	50                   	push   %eax
+  8019ba:	ff 75 08             	push   0x8(%ebp)
+  8019bd:	e8 d3 fb ff ff       	call   801595 <fd_lookup>
+  8019c2:	83 c4 10             	add    $0x10,%esp
+  8019c5:	85 c0                	test   %eax,%eax
+  8019c7:	78 0e                	js     8019d7 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8019c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019cf:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8019d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019d7:	c9                   	leave
+  8019d8:	c3                   	ret
+
+008019d9 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	53                   	push   %ebx
+  8019dd:	83 ec 1c             	sub    $0x1c,%esp
+  8019e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019e6:	50                   	push   %eax
+  8019e7:	ff 75 08             	push   0x8(%ebp)
+  8019ea:	e8 a6 fb ff ff       	call   801595 <fd_lookup>
+  8019ef:	83 c4 10             	add    $0x10,%esp
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	78 33                	js     801a29 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8019f6:	83 fb 03             	cmp    $0x3,%ebx
+  8019f9:	74 28                	je     801a23 <fcntl+0x4a>
+  8019fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a00:	83 fb 04             	cmp    $0x4,%ebx
+  801a03:	75 24                	jne    801a29 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801a05:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801a08:	8b 41 08             	mov    0x8(%ecx),%eax
+  801a0b:	80 e4 ef             	and    $0xef,%ah
+  801a0e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801a11:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801a17:	09 d0                	or     %edx,%eax
+  801a19:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a21:	eb 06                	jmp    801a29 <fcntl+0x50>
+		return fd->fd_omode;
+  801a23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a26:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801a29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a2c:	c9                   	leave
+  801a2d:	c3                   	ret
+
+00801a2e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a2e:	55                   	push   %ebp
+  801a2f:	89 e5                	mov    %esp,%ebp
+  801a31:	56                   	push   %esi
+  801a32:	53                   	push   %ebx
+  801a33:	83 ec 18             	sub    $0x18,%esp
+  801a36:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a39:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a3c:	50                   	push   %eax
+  801a3d:	53                   	push   %ebx
+  801a3e:	e8 52 fb ff ff       	call   801595 <fd_lookup>
+  801a43:	83 c4 10             	add    $0x10,%esp
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	78 34                	js     801a7e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a4a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a4d:	83 ec 08             	sub    $0x8,%esp
+  801a50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a53:	50                   	push   %eax
+  801a54:	ff 36                	push   (%esi)
+  801a56:	e8 8c fb ff ff       	call   8015e7 <dev_lookup>
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	85 c0                	test   %eax,%eax
+  801a60:	78 1c                	js     801a7e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a62:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a66:	74 1d                	je     801a85 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a6b:	8b 40 18             	mov    0x18(%eax),%eax
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	74 51                	je     801ac3 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a72:	83 ec 08             	sub    $0x8,%esp
+  801a75:	ff 75 0c             	push   0xc(%ebp)
+  801a78:	56                   	push   %esi
+  801a79:	ff d0                	call   *%eax
+  801a7b:	83 c4 10             	add    $0x10,%esp
+}
+  801a7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a81:	5b                   	pop    %ebx
+  801a82:	5e                   	pop    %esi
+  801a83:	5d                   	pop    %ebp
+  801a84:	c3                   	ret
+  801a85:	89 e2                	mov    %esp,%edx
+  801a87:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a8c:	29 d0                	sub    %edx,%eax
+  801a8e:	89 c2                	mov    %eax,%edx
+  801a90:	c1 ea 0f             	shr    $0xf,%edx
+  801a93:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9d:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801aa0:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  801aa7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801aaa:	83 ec 04             	sub    $0x4,%esp
+  801aad:	53                   	push   %ebx
+  801aae:	50                   	push   %eax
+  801aaf:	68 d8 4a 80 00       	push   $0x804ad8
+  801ab4:	e8 d7 ea ff ff       	call   800590 <cprintf>
+		return -E_INVAL;
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac1:	eb bb                	jmp    801a7e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ac3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac8:	eb b4                	jmp    801a7e <ftruncate+0x50>
+
+00801aca <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801aca:	55                   	push   %ebp
+  801acb:	89 e5                	mov    %esp,%ebp
+  801acd:	56                   	push   %esi
+  801ace:	53                   	push   %ebx
+  801acf:	83 ec 18             	sub    $0x18,%esp
+  801ad2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ad5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ad8:	50                   	push   %eax
+  801ad9:	ff 75 08             	push   0x8(%ebp)
+  801adc:	e8 b4 fa ff ff       	call   801595 <fd_lookup>
+  801ae1:	83 c4 10             	add    $0x10,%esp
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	78 53                	js     801b3b <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ae8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aeb:	83 ec 08             	sub    $0x8,%esp
+  801aee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af1:	50                   	push   %eax
+  801af2:	ff 36                	push   (%esi)
+  801af4:	e8 ee fa ff ff       	call   8015e7 <dev_lookup>
+  801af9:	83 c4 10             	add    $0x10,%esp
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 3b                	js     801b3b <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801b00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b03:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b07:	74 39                	je     801b42 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b09:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801b0c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b13:	00 00 00 
+	stat->st_isdir = 0;
+  801b16:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b1d:	00 00 00 
+	stat->st_version = 0;
+  801b20:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801b27:	00 00 00 
+	stat->st_dev = dev;
+  801b2a:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b30:	83 ec 08             	sub    $0x8,%esp
+  801b33:	53                   	push   %ebx
+  801b34:	56                   	push   %esi
+  801b35:	ff 50 14             	call   *0x14(%eax)
+  801b38:	83 c4 10             	add    $0x10,%esp
+}
+  801b3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3e:	5b                   	pop    %ebx
+  801b3f:	5e                   	pop    %esi
+  801b40:	5d                   	pop    %ebp
+  801b41:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b42:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b47:	eb f2                	jmp    801b3b <fstat+0x71>
+
+00801b49 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	56                   	push   %esi
+  801b4d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b4e:	83 ec 08             	sub    $0x8,%esp
+  801b51:	6a 00                	push   $0x0
+  801b53:	ff 75 08             	push   0x8(%ebp)
+  801b56:	e8 b7 01 00 00       	call   801d12 <open>
+  801b5b:	89 c3                	mov    %eax,%ebx
+  801b5d:	83 c4 10             	add    $0x10,%esp
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	78 1b                	js     801b7f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b64:	83 ec 08             	sub    $0x8,%esp
+  801b67:	ff 75 0c             	push   0xc(%ebp)
+  801b6a:	50                   	push   %eax
+  801b6b:	e8 5a ff ff ff       	call   801aca <fstat>
+  801b70:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b72:	89 1c 24             	mov    %ebx,(%esp)
+  801b75:	e8 60 fb ff ff       	call   8016da <close>
+	return r;
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	89 f3                	mov    %esi,%ebx
+}
+  801b7f:	89 d8                	mov    %ebx,%eax
+  801b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b84:	5b                   	pop    %ebx
+  801b85:	5e                   	pop    %esi
+  801b86:	5d                   	pop    %ebp
+  801b87:	c3                   	ret
+
+00801b88 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b88:	55                   	push   %ebp
+  801b89:	89 e5                	mov    %esp,%ebp
+  801b8b:	56                   	push   %esi
+  801b8c:	53                   	push   %ebx
+  801b8d:	89 c6                	mov    %eax,%esi
+  801b8f:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801b91:	83 3d 04 70 80 00 00 	cmpl   $0x0,0x807004
+  801b98:	74 27                	je     801bc1 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b9a:	6a 07                	push   $0x7
+  801b9c:	68 00 a0 80 00       	push   $0x80a000
+  801ba1:	56                   	push   %esi
+  801ba2:	ff 35 04 70 80 00    	push   0x807004
+  801ba8:	e8 64 27 00 00       	call   804311 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801bad:	83 c4 0c             	add    $0xc,%esp
+  801bb0:	6a 00                	push   $0x0
+  801bb2:	53                   	push   %ebx
+  801bb3:	6a 00                	push   $0x0
+  801bb5:	e8 c7 24 00 00       	call   804081 <ipc_recv>
+}
+  801bba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bbd:	5b                   	pop    %ebx
+  801bbe:	5e                   	pop    %esi
+  801bbf:	5d                   	pop    %ebp
+  801bc0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bc1:	83 ec 0c             	sub    $0xc,%esp
+  801bc4:	6a 02                	push   $0x2
+  801bc6:	e8 af 27 00 00       	call   80437a <ipc_find_env>
+  801bcb:	a3 04 70 80 00       	mov    %eax,0x807004
+  801bd0:	83 c4 10             	add    $0x10,%esp
+  801bd3:	eb c5                	jmp    801b9a <fsipc+0x12>
+
+00801bd5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bde:	8b 40 0c             	mov    0xc(%eax),%eax
+  801be1:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.set_size.req_size = newsize;
+  801be6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be9:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf3:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bf8:	e8 8b ff ff ff       	call   801b88 <fsipc>
+}
+  801bfd:	c9                   	leave
+  801bfe:	c3                   	ret
+
+00801bff <devfile_flush>:
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c08:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c0b:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801c10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c15:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c1a:	e8 69 ff ff ff       	call   801b88 <fsipc>
+}
+  801c1f:	c9                   	leave
+  801c20:	c3                   	ret
+
+00801c21 <devfile_stat>:
+{
+  801c21:	55                   	push   %ebp
+  801c22:	89 e5                	mov    %esp,%ebp
+  801c24:	53                   	push   %ebx
+  801c25:	83 ec 04             	sub    $0x4,%esp
+  801c28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c31:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c40:	e8 43 ff ff ff       	call   801b88 <fsipc>
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	78 37                	js     801c80 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c49:	83 ec 08             	sub    $0x8,%esp
+  801c4c:	68 00 a0 80 00       	push   $0x80a000
+  801c51:	53                   	push   %ebx
+  801c52:	e8 30 f0 ff ff       	call   800c87 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c57:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  801c5c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c62:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  801c67:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801c6d:	a1 88 a0 80 00       	mov    0x80a088,%eax
+  801c72:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801c78:	83 c4 10             	add    $0x10,%esp
+  801c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c83:	c9                   	leave
+  801c84:	c3                   	ret
+
+00801c85 <devfile_write>:
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	83 ec 0c             	sub    $0xc,%esp
+  801c8b:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801c8e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c93:	39 d0                	cmp    %edx,%eax
+  801c95:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9b:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c9e:	89 15 00 a0 80 00    	mov    %edx,0x80a000
+	fsipcbuf.write.req_n = count;
+  801ca4:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801ca9:	50                   	push   %eax
+  801caa:	ff 75 0c             	push   0xc(%ebp)
+  801cad:	68 08 a0 80 00       	push   $0x80a008
+  801cb2:	e8 80 f1 ff ff       	call   800e37 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801cb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cc1:	e8 c2 fe ff ff       	call   801b88 <fsipc>
+}
+  801cc6:	c9                   	leave
+  801cc7:	c3                   	ret
+
+00801cc8 <devfile_read>:
+{
+  801cc8:	55                   	push   %ebp
+  801cc9:	89 e5                	mov    %esp,%ebp
+  801ccb:	53                   	push   %ebx
+  801ccc:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cd5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.read.req_n = n;
+  801cda:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cdd:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801ce2:	ba 00 a0 80 00       	mov    $0x80a000,%edx
+  801ce7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cec:	e8 97 fe ff ff       	call   801b88 <fsipc>
+  801cf1:	89 c3                	mov    %eax,%ebx
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	78 14                	js     801d0b <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801cf7:	83 ec 04             	sub    $0x4,%esp
+  801cfa:	50                   	push   %eax
+  801cfb:	68 00 a0 80 00       	push   $0x80a000
+  801d00:	ff 75 0c             	push   0xc(%ebp)
+  801d03:	e8 2f f1 ff ff       	call   800e37 <memmove>
+	return r;
+  801d08:	83 c4 10             	add    $0x10,%esp
+}
+  801d0b:	89 d8                	mov    %ebx,%eax
+  801d0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d10:	c9                   	leave
+  801d11:	c3                   	ret
+
+00801d12 <open>:
+{
+  801d12:	55                   	push   %ebp
+  801d13:	89 e5                	mov    %esp,%ebp
+  801d15:	53                   	push   %ebx
+  801d16:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801d19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d1c:	50                   	push   %eax
+  801d1d:	e8 23 f8 ff ff       	call   801545 <fd_alloc>
+  801d22:	89 c3                	mov    %eax,%ebx
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	78 2a                	js     801d55 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801d2b:	83 ec 0c             	sub    $0xc,%esp
+  801d2e:	ff 75 08             	push   0x8(%ebp)
+  801d31:	e8 05 ef ff ff       	call   800c3b <strlen>
+  801d36:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801d39:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801d3e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801d43:	7e 17                	jle    801d5c <open+0x4a>
+	fd_close(fd, 1);
+  801d45:	83 ec 08             	sub    $0x8,%esp
+  801d48:	6a 01                	push   $0x1
+  801d4a:	ff 75 f4             	push   -0xc(%ebp)
+  801d4d:	e8 08 f9 ff ff       	call   80165a <fd_close>
+	return r;
+  801d52:	83 c4 10             	add    $0x10,%esp
+}
+  801d55:	89 d8                	mov    %ebx,%eax
+  801d57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801d5c:	83 ec 08             	sub    $0x8,%esp
+  801d5f:	ff 75 08             	push   0x8(%ebp)
+  801d62:	68 00 a0 80 00       	push   $0x80a000
+  801d67:	e8 1b ef ff ff       	call   800c87 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d6f:	a3 00 a4 80 00       	mov    %eax,0x80a400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801d74:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d77:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d7c:	e8 07 fe ff ff       	call   801b88 <fsipc>
+  801d81:	89 c3                	mov    %eax,%ebx
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 bb                	js     801d45 <open+0x33>
+	return fd2num(fd); 	
+  801d8a:	83 ec 0c             	sub    $0xc,%esp
+  801d8d:	ff 75 f4             	push   -0xc(%ebp)
+  801d90:	e8 89 f7 ff ff       	call   80151e <fd2num>
+  801d95:	89 c3                	mov    %eax,%ebx
+  801d97:	83 c4 10             	add    $0x10,%esp
+  801d9a:	eb b9                	jmp    801d55 <open+0x43>
+
+00801d9c <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801d9c:	55                   	push   %ebp
+  801d9d:	89 e5                	mov    %esp,%ebp
+  801d9f:	53                   	push   %ebx
+  801da0:	83 ec 1c             	sub    $0x1c,%esp
+  801da3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801da6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da9:	50                   	push   %eax
+  801daa:	ff 75 08             	push   0x8(%ebp)
+  801dad:	e8 e3 f7 ff ff       	call   801595 <fd_lookup>
+  801db2:	83 c4 10             	add    $0x10,%esp
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 5a                	js     801e13 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801db9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dbc:	8b 15 c0 67 80 00    	mov    0x8067c0,%edx
+  801dc2:	39 10                	cmp    %edx,(%eax)
+  801dc4:	75 66                	jne    801e2c <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801dc6:	83 3d 04 70 80 00 00 	cmpl   $0x0,0x807004
+  801dcd:	74 49                	je     801e18 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801dcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dd5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.map.req_offset = offset;
+  801dda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ddd:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	fsipcbuf.map.req_npages = maxpages;
+  801de2:	89 1d 08 a0 80 00    	mov    %ebx,0x80a008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801de8:	6a 07                	push   $0x7
+  801dea:	68 00 a0 80 00       	push   $0x80a000
+  801def:	6a 09                	push   $0x9
+  801df1:	ff 35 04 70 80 00    	push   0x807004
+  801df7:	e8 15 25 00 00       	call   804311 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801dfc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801e03:	6a 00                	push   $0x0
+  801e05:	53                   	push   %ebx
+  801e06:	ff 75 10             	push   0x10(%ebp)
+  801e09:	6a 00                	push   $0x0
+  801e0b:	e8 3e 23 00 00       	call   80414e <ipc_recv_pages>
+  801e10:	83 c4 20             	add    $0x20,%esp
+}
+  801e13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e16:	c9                   	leave
+  801e17:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e18:	83 ec 0c             	sub    $0xc,%esp
+  801e1b:	6a 02                	push   $0x2
+  801e1d:	e8 58 25 00 00       	call   80437a <ipc_find_env>
+  801e22:	a3 04 70 80 00       	mov    %eax,0x807004
+  801e27:	83 c4 10             	add    $0x10,%esp
+  801e2a:	eb a3                	jmp    801dcf <fmap+0x33>
+		return -E_INVAL;
+  801e2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e31:	eb e0                	jmp    801e13 <fmap+0x77>
+
+00801e33 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	53                   	push   %ebx
+  801e37:	83 ec 10             	sub    $0x10,%esp
+  801e3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801e3d:	53                   	push   %ebx
+  801e3e:	e8 f8 ed ff ff       	call   800c3b <strlen>
+  801e43:	83 c4 10             	add    $0x10,%esp
+  801e46:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e4b:	7f 25                	jg     801e72 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801e4d:	83 ec 08             	sub    $0x8,%esp
+  801e50:	53                   	push   %ebx
+  801e51:	68 00 a0 80 00       	push   $0x80a000
+  801e56:	e8 2c ee ff ff       	call   800c87 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801e5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e60:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e65:	e8 1e fd ff ff       	call   801b88 <fsipc>
+  801e6a:	83 c4 10             	add    $0x10,%esp
+}
+  801e6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+		return -E_BAD_PATH;
+  801e72:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e77:	eb f4                	jmp    801e6d <remove+0x3a>
+
+00801e79 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e84:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e89:	e8 fa fc ff ff       	call   801b88 <fsipc>
+}
+  801e8e:	c9                   	leave
+  801e8f:	c3                   	ret
+
+00801e90 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801e90:	55                   	push   %ebp
+  801e91:	89 e5                	mov    %esp,%ebp
+  801e93:	57                   	push   %edi
+  801e94:	56                   	push   %esi
+  801e95:	53                   	push   %ebx
+  801e96:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801e9c:	6a 00                	push   $0x0
+  801e9e:	ff 75 08             	push   0x8(%ebp)
+  801ea1:	e8 6c fe ff ff       	call   801d12 <open>
+  801ea6:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	0f 88 ab 04 00 00    	js     802362 <spawn+0x4d2>
+  801eb7:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801eb9:	83 ec 04             	sub    $0x4,%esp
+  801ebc:	68 00 02 00 00       	push   $0x200
+  801ec1:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801ec7:	50                   	push   %eax
+  801ec8:	51                   	push   %ecx
+  801ec9:	e8 ef f9 ff ff       	call   8018bd <readn>
+  801ece:	83 c4 10             	add    $0x10,%esp
+  801ed1:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801ed6:	0f 85 e6 01 00 00    	jne    8020c2 <spawn+0x232>
+	    || elf->e_magic != ELF_MAGIC) {
+  801edc:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801ee3:	45 4c 46 
+  801ee6:	0f 85 d6 01 00 00    	jne    8020c2 <spawn+0x232>
+	__asm __volatile("int %2"
+  801eec:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ef1:	cd 30                	int    $0x30
+  801ef3:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	0f 88 55 04 00 00    	js     802356 <spawn+0x4c6>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801f01:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f06:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+  801f0c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801f12:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801f18:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801f1d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801f1f:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801f25:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  801f2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f2e:	8b 00                	mov    (%eax),%eax
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	0f 84 a5 07 00 00    	je     8026dd <spawn+0x84d>
+  801f38:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801f3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f42:	8b 75 0c             	mov    0xc(%ebp),%esi
+		string_size += strlen(argv[argc]) + 1;
+  801f45:	83 ec 0c             	sub    $0xc,%esp
+  801f48:	50                   	push   %eax
+  801f49:	e8 ed ec ff ff       	call   800c3b <strlen>
+  801f4e:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801f52:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  801f58:	83 c3 01             	add    $0x1,%ebx
+  801f5b:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  801f62:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	75 d9                	jne    801f45 <spawn+0xb5>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801f6c:	89 95 84 fd ff ff    	mov    %edx,-0x27c(%ebp)
+  801f72:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  801f78:	be 00 10 40 00       	mov    $0x401000,%esi
+  801f7d:	29 fe                	sub    %edi,%esi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801f7f:	89 f2                	mov    %esi,%edx
+  801f81:	83 e2 fc             	and    $0xfffffffc,%edx
+  801f84:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801f8a:	8d 04 85 08 00 00 00 	lea    0x8(,%eax,4),%eax
+  801f91:	29 c2                	sub    %eax,%edx
+  801f93:	89 d7                	mov    %edx,%edi
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801f95:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801f98:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801f9d:	0f 86 ee 06 00 00    	jbe    802691 <spawn+0x801>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801fa3:	83 ec 04             	sub    $0x4,%esp
+  801fa6:	6a 07                	push   $0x7
+  801fa8:	68 00 00 40 00       	push   $0x400000
+  801fad:	6a 00                	push   $0x0
+  801faf:	e8 07 f1 ff ff       	call   8010bb <sys_page_alloc>
+  801fb4:	83 c4 10             	add    $0x10,%esp
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	0f 88 d7 06 00 00    	js     802696 <spawn+0x806>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801fbf:	85 db                	test   %ebx,%ebx
+  801fc1:	7e 58                	jle    80201b <spawn+0x18b>
+  801fc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc8:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  801fce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		argv_store[i] = UTEMP2USTACK(string_store);
+  801fd1:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801fd7:	8d 86 00 d0 7f ee    	lea    -0x11803000(%esi),%eax
+  801fdd:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801fe3:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+		strcpy(string_store, argv[i]);
+  801fe6:	83 ec 08             	sub    $0x8,%esp
+  801fe9:	ff 34 9f             	push   (%edi,%ebx,4)
+  801fec:	56                   	push   %esi
+  801fed:	e8 95 ec ff ff       	call   800c87 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  801ff2:	83 c4 04             	add    $0x4,%esp
+  801ff5:	ff 34 9f             	push   (%edi,%ebx,4)
+  801ff8:	e8 3e ec ff ff       	call   800c3b <strlen>
+  801ffd:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+  802001:	83 c3 01             	add    $0x1,%ebx
+  802004:	83 c4 10             	add    $0x10,%esp
+  802007:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  80200d:	39 8d 94 fd ff ff    	cmp    %ecx,-0x26c(%ebp)
+  802013:	75 bc                	jne    801fd1 <spawn+0x141>
+  802015:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+	}
+	argv_store[argc] = 0;
+  80201b:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802021:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802028:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  80202e:	0f 85 c6 00 00 00    	jne    8020fa <spawn+0x26a>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802034:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80203a:	89 47 fc             	mov    %eax,-0x4(%edi)
+	argv_store[-2] = argc;
+  80203d:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802043:	89 47 f8             	mov    %eax,-0x8(%edi)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802046:	8d 87 f8 cf 7f ee    	lea    -0x11803008(%edi),%eax
+  80204c:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802052:	83 ec 0c             	sub    $0xc,%esp
+  802055:	6a 07                	push   $0x7
+  802057:	68 00 d0 bf ee       	push   $0xeebfd000
+  80205c:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802062:	68 00 00 40 00       	push   $0x400000
+  802067:	6a 00                	push   $0x0
+  802069:	e8 90 f0 ff ff       	call   8010fe <sys_page_map>
+  80206e:	89 c3                	mov    %eax,%ebx
+  802070:	83 c4 20             	add    $0x20,%esp
+  802073:	85 c0                	test   %eax,%eax
+  802075:	0f 88 45 06 00 00    	js     8026c0 <spawn+0x830>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80207b:	83 ec 08             	sub    $0x8,%esp
+  80207e:	68 00 00 40 00       	push   $0x400000
+  802083:	6a 00                	push   $0x0
+  802085:	e8 b6 f0 ff ff       	call   801140 <sys_page_unmap>
+  80208a:	89 c3                	mov    %eax,%ebx
+  80208c:	83 c4 10             	add    $0x10,%esp
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	0f 88 29 06 00 00    	js     8026c0 <spawn+0x830>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802097:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80209d:	8d 84 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%eax
+  8020a4:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8020aa:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  8020b1:	00 
+  8020b2:	0f 84 a4 00 00 00    	je     80215c <spawn+0x2cc>
+  8020b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020bd:	e9 19 03 00 00       	jmp    8023db <spawn+0x54b>
+		close(fd);
+  8020c2:	83 ec 0c             	sub    $0xc,%esp
+  8020c5:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  8020cb:	e8 0a f6 ff ff       	call   8016da <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8020d0:	83 c4 0c             	add    $0xc,%esp
+  8020d3:	68 7f 45 4c 46       	push   $0x464c457f
+  8020d8:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8020de:	68 48 4b 80 00       	push   $0x804b48
+  8020e3:	e8 a8 e4 ff ff       	call   800590 <cprintf>
+		return -E_NOT_EXEC;
+  8020e8:	83 c4 10             	add    $0x10,%esp
+  8020eb:	c7 85 78 fd ff ff f2 	movl   $0xfffffff2,-0x288(%ebp)
+  8020f2:	ff ff ff 
+  8020f5:	e9 68 02 00 00       	jmp    802362 <spawn+0x4d2>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8020fa:	68 c8 4b 80 00       	push   $0x804bc8
+  8020ff:	68 62 4b 80 00       	push   $0x804b62
+  802104:	68 f1 00 00 00       	push   $0xf1
+  802109:	68 77 4b 80 00       	push   $0x804b77
+  80210e:	e8 a2 e3 ff ff       	call   8004b5 <_panic>
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
+  802113:	50                   	push   %eax
+  802114:	68 f0 4b 80 00       	push   $0x804bf0
+  802119:	68 2d 01 00 00       	push   $0x12d
+  80211e:	68 77 4b 80 00       	push   $0x804b77
+  802123:	e8 8d e3 ff ff       	call   8004b5 <_panic>
+  802128:	89 c6                	mov    %eax,%esi
+  80212a:	eb 02                	jmp    80212e <spawn+0x29e>
+  80212c:	89 c6                	mov    %eax,%esi
+	sys_env_destroy(child);
+  80212e:	83 ec 0c             	sub    $0xc,%esp
+  802131:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802137:	e8 00 ef ff ff       	call   80103c <sys_env_destroy>
+	close(fd);
+  80213c:	83 c4 04             	add    $0x4,%esp
+  80213f:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802145:	e8 90 f5 ff ff       	call   8016da <close>
+	return r;
+  80214a:	83 c4 10             	add    $0x10,%esp
+  80214d:	89 b5 78 fd ff ff    	mov    %esi,-0x288(%ebp)
+  802153:	e9 0a 02 00 00       	jmp    802362 <spawn+0x4d2>
+  802158:	89 c6                	mov    %eax,%esi
+  80215a:	eb d2                	jmp    80212e <spawn+0x29e>
+	close(fd);
+  80215c:	83 ec 0c             	sub    $0xc,%esp
+  80215f:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802165:	e8 70 f5 ff ff       	call   8016da <close>
+	// LAB 7: Your code here.
+	static struct PageBatch pb;
+	uintptr_t addr;
+	uint32_t pn, pd;
+	int r;
+	pgbatch_init(&pb);
+  80216a:	c7 04 24 20 70 80 00 	movl   $0x807020,(%esp)
+  802171:	e8 65 1d 00 00       	call   803edb <pgbatch_init>
+  802176:	83 c4 10             	add    $0x10,%esp
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802179:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80217e:	8b b5 90 fd ff ff    	mov    -0x270(%ebp),%esi
+  802184:	eb 24                	jmp    8021aa <spawn+0x31a>
+		pd = PDX(addr);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  802186:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80218c:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  802192:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802198:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80219e:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8021a4:	0f 87 18 01 00 00    	ja     8022c2 <spawn+0x432>
+		pd = PDX(addr);
+  8021aa:	89 d8                	mov    %ebx,%eax
+  8021ac:	c1 e8 16             	shr    $0x16,%eax
+		if (!(vpd[pd] & PTE_P)) {
+  8021af:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021b6:	a8 01                	test   $0x1,%al
+  8021b8:	74 cc                	je     802186 <spawn+0x2f6>
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  8021ba:	89 d9                	mov    %ebx,%ecx
+  8021bc:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+  8021c2:	74 4c                	je     802210 <spawn+0x380>
+				continue;
+			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+  8021c4:	89 d8                	mov    %ebx,%eax
+  8021c6:	c1 e8 0c             	shr    $0xc,%eax
+		if(vpt[pn] & PTE_SHARE) {
+  8021c9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8021d0:	f6 c6 04             	test   $0x4,%dh
+  8021d3:	74 c3                	je     802198 <spawn+0x308>
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+  8021d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021dc:	83 ec 08             	sub    $0x8,%esp
+  8021df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021e4:	50                   	push   %eax
+  8021e5:	53                   	push   %ebx
+  8021e6:	56                   	push   %esi
+  8021e7:	53                   	push   %ebx
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	68 20 70 80 00       	push   $0x807020
+  8021ef:	e8 a5 1d 00 00       	call   803f99 <pgbatch_map>
+  8021f4:	83 c4 20             	add    $0x20,%esp
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	79 9d                	jns    802198 <spawn+0x308>
+				panic("sys_page_batch: %e", r);
+  8021fb:	50                   	push   %eax
+  8021fc:	68 83 4b 80 00       	push   $0x804b83
+  802201:	68 6b 01 00 00       	push   $0x16b
+  802206:	68 77 4b 80 00       	push   $0x804b77
+  80220b:	e8 a5 e2 ff ff       	call   8004b5 <_panic>
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802210:	89 d8                	mov    %ebx,%eax
+  802212:	c1 e8 0c             	shr    $0xc,%eax
+  802215:	8d b8 00 04 00 00    	lea    0x400(%eax),%edi
+  80221b:	eb 0a                	jmp    802227 <spawn+0x397>
+			n++;
+  80221d:	83 c1 01             	add    $0x1,%ecx
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802220:	83 c0 01             	add    $0x1,%eax
+  802223:	39 f8                	cmp    %edi,%eax
+  802225:	73 1a                	jae    802241 <spawn+0x3b1>
+		if (vpt[pn] & PTE_P) {
+  802227:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80222e:	f6 c2 01             	test   $0x1,%dl
+  802231:	74 ed                	je     802220 <spawn+0x390>
+			if (!(vpt[pn] & PTE_SHARE))
+  802233:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80223a:	f6 c6 04             	test   $0x4,%dh
+  80223d:	75 de                	jne    80221d <spawn+0x38d>
+  80223f:	eb 83                	jmp    8021c4 <spawn+0x334>
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  802241:	85 c9                	test   %ecx,%ecx
+  802243:	0f 84 7b ff ff ff    	je     8021c4 <spawn+0x334>
+			if ((r = pgbatch_flush(&pb)) < 0)
+  802249:	83 ec 0c             	sub    $0xc,%esp
+  80224c:	68 20 70 80 00       	push   $0x807020
+  802251:	e8 93 1c 00 00       	call   803ee9 <pgbatch_flush>
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	85 c0                	test   %eax,%eax
+  80225b:	78 45                	js     8022a2 <spawn+0x412>
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+  80225d:	83 ec 0c             	sub    $0xc,%esp
+  802260:	6a 00                	push   $0x0
+  802262:	56                   	push   %esi
+  802263:	53                   	push   %ebx
+  802264:	6a 00                	push   $0x0
+  802266:	68 20 70 80 00       	push   $0x807020
+  80226b:	e8 d4 1d 00 00       	call   804044 <pgbatch_sharept>
+			if ((r = pgbatch_flush(&pb)) == 0) {
+  802270:	83 c4 14             	add    $0x14,%esp
+  802273:	68 20 70 80 00       	push   $0x807020
+  802278:	e8 6c 1c 00 00       	call   803ee9 <pgbatch_flush>
+  80227d:	83 c4 10             	add    $0x10,%esp
+  802280:	85 c0                	test   %eax,%eax
+  802282:	74 33                	je     8022b7 <spawn+0x427>
+			if (r != -E_INVAL)
+  802284:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  802287:	0f 84 37 ff ff ff    	je     8021c4 <spawn+0x334>
+				panic("sys_page_batch: %e", r);
+  80228d:	50                   	push   %eax
+  80228e:	68 83 4b 80 00       	push   $0x804b83
+  802293:	68 66 01 00 00       	push   $0x166
+  802298:	68 77 4b 80 00       	push   $0x804b77
+  80229d:	e8 13 e2 ff ff       	call   8004b5 <_panic>
+				panic("sys_page_batch: %e", r);
+  8022a2:	50                   	push   %eax
+  8022a3:	68 83 4b 80 00       	push   $0x804b83
+  8022a8:	68 5f 01 00 00       	push   $0x15f
+  8022ad:	68 77 4b 80 00       	push   $0x804b77
+  8022b2:	e8 fe e1 ff ff       	call   8004b5 <_panic>
+				addr += PTSIZE - PGSIZE;
+  8022b7:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+				continue;
+  8022bd:	e9 d6 fe ff ff       	jmp    802198 <spawn+0x308>
+		}
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  8022c2:	83 ec 0c             	sub    $0xc,%esp
+  8022c5:	68 20 70 80 00       	push   $0x807020
+  8022ca:	e8 1a 1c 00 00       	call   803ee9 <pgbatch_flush>
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	78 41                	js     802317 <spawn+0x487>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8022d6:	83 ec 08             	sub    $0x8,%esp
+  8022d9:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8022df:	50                   	push   %eax
+  8022e0:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8022e6:	e8 d9 ee ff ff       	call   8011c4 <sys_env_set_trapframe>
+  8022eb:	83 c4 10             	add    $0x10,%esp
+  8022ee:	85 c0                	test   %eax,%eax
+  8022f0:	78 3a                	js     80232c <spawn+0x49c>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8022f2:	83 ec 08             	sub    $0x8,%esp
+  8022f5:	6a 02                	push   $0x2
+  8022f7:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8022fd:	e8 80 ee ff ff       	call   801182 <sys_env_set_status>
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 38                	js     802341 <spawn+0x4b1>
+	return child;
+  802309:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80230f:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802315:	eb 4b                	jmp    802362 <spawn+0x4d2>
+		panic("sys_page_batch: %e", r);
+  802317:	50                   	push   %eax
+  802318:	68 83 4b 80 00       	push   $0x804b83
+  80231d:	68 6f 01 00 00       	push   $0x16f
+  802322:	68 77 4b 80 00       	push   $0x804b77
+  802327:	e8 89 e1 ff ff       	call   8004b5 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  80232c:	50                   	push   %eax
+  80232d:	68 96 4b 80 00       	push   $0x804b96
+  802332:	68 85 00 00 00       	push   $0x85
+  802337:	68 77 4b 80 00       	push   $0x804b77
+  80233c:	e8 74 e1 ff ff       	call   8004b5 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802341:	50                   	push   %eax
+  802342:	68 b0 4b 80 00       	push   $0x804bb0
+  802347:	68 88 00 00 00       	push   $0x88
+  80234c:	68 77 4b 80 00       	push   $0x804b77
+  802351:	e8 5f e1 ff ff       	call   8004b5 <_panic>
+		return r;
+  802356:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80235c:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+}
+  802362:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236b:	5b                   	pop    %ebx
+  80236c:	5e                   	pop    %esi
+  80236d:	5f                   	pop    %edi
+  80236e:	5d                   	pop    %ebp
+  80236f:	c3                   	ret
+	for (j = 0; j < n; j++)
+  802370:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  802376:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  80237c:	85 db                	test   %ebx,%ebx
+  80237e:	0f 8e 06 03 00 00    	jle    80268a <spawn+0x7fa>
+  802384:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80238a:	c1 e6 0c             	shl    $0xc,%esi
+  80238d:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  802392:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802398:	89 c7                	mov    %eax,%edi
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+  80239a:	83 ec 08             	sub    $0x8,%esp
+  80239d:	53                   	push   %ebx
+  80239e:	6a 00                	push   $0x0
+  8023a0:	e8 9b ed ff ff       	call   801140 <sys_page_unmap>
+	for (j = 0; j < n; j++)
+  8023a5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023ab:	83 c4 10             	add    $0x10,%esp
+  8023ae:	39 f3                	cmp    %esi,%ebx
+  8023b0:	75 e8                	jne    80239a <spawn+0x50a>
+  8023b2:	89 f8                	mov    %edi,%eax
+  8023b4:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	0f 88 66 fd ff ff    	js     802128 <spawn+0x298>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8023c2:	83 c7 01             	add    $0x1,%edi
+  8023c5:	83 85 7c fd ff ff 20 	addl   $0x20,-0x284(%ebp)
+  8023cc:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8023d3:	39 f8                	cmp    %edi,%eax
+  8023d5:	0f 8e 81 fd ff ff    	jle    80215c <spawn+0x2cc>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8023db:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8023e1:	83 39 01             	cmpl   $0x1,(%ecx)
+  8023e4:	75 dc                	jne    8023c2 <spawn+0x532>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8023e6:	8b 41 18             	mov    0x18(%ecx),%eax
+  8023e9:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+  8023ef:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8023f2:	83 f8 01             	cmp    $0x1,%eax
+  8023f5:	19 c0                	sbb    %eax,%eax
+  8023f7:	83 e0 fe             	and    $0xfffffffe,%eax
+  8023fa:	83 c0 07             	add    $0x7,%eax
+  8023fd:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802403:	8b 51 04             	mov    0x4(%ecx),%edx
+  802406:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  80240c:	8b 59 10             	mov    0x10(%ecx),%ebx
+  80240f:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802415:	8b 41 14             	mov    0x14(%ecx),%eax
+  802418:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+  80241e:	8b 71 08             	mov    0x8(%ecx),%esi
+  802421:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+	if ((i = PGOFF(va))) {
+  802427:	89 f0                	mov    %esi,%eax
+  802429:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80242e:	74 1e                	je     80244e <spawn+0x5be>
+		va -= i;
+  802430:	29 c6                	sub    %eax,%esi
+  802432:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		memsz += i;
+  802438:	01 85 68 fd ff ff    	add    %eax,-0x298(%ebp)
+		filesz += i;
+  80243e:	01 c3                	add    %eax,%ebx
+  802440:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+		fileoffset -= i;
+  802446:	29 c2                	sub    %eax,%edx
+  802448:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+	pgbatch_init(&pb);
+  80244e:	83 ec 0c             	sub    $0xc,%esp
+  802451:	68 40 73 80 00       	push   $0x807340
+  802456:	e8 80 1a 00 00       	call   803edb <pgbatch_init>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	83 bd 88 fd ff ff 00 	cmpl   $0x0,-0x278(%ebp)
+  802465:	0f 84 a6 01 00 00    	je     802611 <spawn+0x781>
+  80246b:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802472:	00 00 00 
+  802475:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  80247c:	00 00 00 
+  80247f:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802485:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  80248b:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802491:	29 c7                	sub    %eax,%edi
+  802493:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  802499:	c1 ee 0c             	shr    $0xc,%esi
+  80249c:	b8 10 00 00 00       	mov    $0x10,%eax
+  8024a1:	39 c6                	cmp    %eax,%esi
+  8024a3:	0f 47 f0             	cmova  %eax,%esi
+  8024a6:	89 b5 94 fd ff ff    	mov    %esi,-0x26c(%ebp)
+		for (j = 0; j < n; j++)
+  8024ac:	85 f6                	test   %esi,%esi
+  8024ae:	0f 8e ed 01 00 00    	jle    8026a1 <spawn+0x811>
+  8024b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b9:	89 bd 70 fd ff ff    	mov    %edi,-0x290(%ebp)
+  8024bf:	89 f7                	mov    %esi,%edi
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  8024c1:	6a 07                	push   $0x7
+  8024c3:	89 d8                	mov    %ebx,%eax
+  8024c5:	c1 e0 0c             	shl    $0xc,%eax
+  8024c8:	05 00 00 40 00       	add    $0x400000,%eax
+  8024cd:	50                   	push   %eax
+  8024ce:	6a 00                	push   $0x0
+  8024d0:	68 40 73 80 00       	push   $0x807340
+  8024d5:	e8 88 1a 00 00       	call   803f62 <pgbatch_alloc>
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	85 c0                	test   %eax,%eax
+  8024df:	0f 88 47 fc ff ff    	js     80212c <spawn+0x29c>
+		for (j = 0; j < n; j++)
+  8024e5:	83 c3 01             	add    $0x1,%ebx
+  8024e8:	39 df                	cmp    %ebx,%edi
+  8024ea:	75 d5                	jne    8024c1 <spawn+0x631>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8024ec:	8b bd 70 fd ff ff    	mov    -0x290(%ebp),%edi
+  8024f2:	83 ec 0c             	sub    $0xc,%esp
+  8024f5:	68 40 73 80 00       	push   $0x807340
+  8024fa:	e8 ea 19 00 00       	call   803ee9 <pgbatch_flush>
+  8024ff:	83 c4 10             	add    $0x10,%esp
+  802502:	85 c0                	test   %eax,%eax
+  802504:	0f 88 66 fe ff ff    	js     802370 <spawn+0x4e0>
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  80250a:	83 ec 08             	sub    $0x8,%esp
+  80250d:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802513:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802519:	01 c8                	add    %ecx,%eax
+  80251b:	50                   	push   %eax
+  80251c:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802522:	e8 89 f4 ff ff       	call   8019b0 <seek>
+  802527:	83 c4 10             	add    $0x10,%esp
+  80252a:	85 c0                	test   %eax,%eax
+  80252c:	0f 88 3e fe ff ff    	js     802370 <spawn+0x4e0>
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802532:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802538:	c1 e3 0c             	shl    $0xc,%ebx
+  80253b:	83 ec 04             	sub    $0x4,%esp
+  80253e:	39 fb                	cmp    %edi,%ebx
+  802540:	0f 46 fb             	cmovbe %ebx,%edi
+  802543:	57                   	push   %edi
+  802544:	68 00 00 40 00       	push   $0x400000
+  802549:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  80254f:	e8 69 f3 ff ff       	call   8018bd <readn>
+  802554:	83 c4 10             	add    $0x10,%esp
+  802557:	85 c0                	test   %eax,%eax
+  802559:	0f 88 11 fe ff ff    	js     802370 <spawn+0x4e0>
+		for (j = 0; j < n; j++) {
+  80255f:	83 bd 94 fd ff ff 00 	cmpl   $0x0,-0x26c(%ebp)
+  802566:	7e 6b                	jle    8025d3 <spawn+0x743>
+  802568:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  80256e:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802574:	01 c7                	add    %eax,%edi
+  802576:	be 00 00 00 00       	mov    $0x0,%esi
+  80257b:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+  802581:	89 f3                	mov    %esi,%ebx
+  802583:	c1 e3 0c             	shl    $0xc,%ebx
+  802586:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80258c:	83 ec 08             	sub    $0x8,%esp
+  80258f:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802595:	57                   	push   %edi
+  802596:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80259c:	53                   	push   %ebx
+  80259d:	6a 00                	push   $0x0
+  80259f:	68 40 73 80 00       	push   $0x807340
+  8025a4:	e8 f0 19 00 00       	call   803f99 <pgbatch_map>
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+  8025a9:	83 c4 1c             	add    $0x1c,%esp
+  8025ac:	53                   	push   %ebx
+  8025ad:	6a 00                	push   $0x0
+  8025af:	68 40 73 80 00       	push   $0x807340
+  8025b4:	e8 23 1a 00 00       	call   803fdc <pgbatch_unmap>
+		for (j = 0; j < n; j++) {
+  8025b9:	83 c6 01             	add    $0x1,%esi
+  8025bc:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8025c2:	83 c4 10             	add    $0x10,%esp
+  8025c5:	39 b5 94 fd ff ff    	cmp    %esi,-0x26c(%ebp)
+  8025cb:	75 b4                	jne    802581 <spawn+0x6f1>
+  8025cd:	8b 9d 80 fd ff ff    	mov    -0x280(%ebp),%ebx
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8025d3:	83 ec 0c             	sub    $0xc,%esp
+  8025d6:	68 40 73 80 00       	push   $0x807340
+  8025db:	e8 09 19 00 00       	call   803ee9 <pgbatch_flush>
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  8025e3:	85 c0                	test   %eax,%eax
+  8025e5:	0f 88 28 fb ff ff    	js     802113 <spawn+0x283>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  8025eb:	01 9d 84 fd ff ff    	add    %ebx,-0x27c(%ebp)
+  8025f1:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8025f7:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  8025fd:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  802603:	39 f0                	cmp    %esi,%eax
+  802605:	0f 82 7a fe ff ff    	jb     802485 <spawn+0x5f5>
+  80260b:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802611:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802617:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80261c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802621:	89 c3                	mov    %eax,%ebx
+  802623:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802629:	39 f0                	cmp    %esi,%eax
+  80262b:	73 48                	jae    802675 <spawn+0x7e5>
+  80262d:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802633:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802639:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+  80263f:	56                   	push   %esi
+  802640:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802646:	01 d8                	add    %ebx,%eax
+  802648:	50                   	push   %eax
+  802649:	57                   	push   %edi
+  80264a:	68 40 73 80 00       	push   $0x807340
+  80264f:	e8 0e 19 00 00       	call   803f62 <pgbatch_alloc>
+  802654:	83 c4 10             	add    $0x10,%esp
+  802657:	85 c0                	test   %eax,%eax
+  802659:	0f 88 f9 fa ff ff    	js     802158 <spawn+0x2c8>
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  80265f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802665:	8b 85 68 fd ff ff    	mov    -0x298(%ebp),%eax
+  80266b:	39 c3                	cmp    %eax,%ebx
+  80266d:	72 d0                	jb     80263f <spawn+0x7af>
+  80266f:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+	return pgbatch_flush(&pb);
+  802675:	83 ec 0c             	sub    $0xc,%esp
+  802678:	68 40 73 80 00       	push   $0x807340
+  80267d:	e8 67 18 00 00       	call   803ee9 <pgbatch_flush>
+  802682:	83 c4 10             	add    $0x10,%esp
+  802685:	e9 30 fd ff ff       	jmp    8023ba <spawn+0x52a>
+  80268a:	89 c6                	mov    %eax,%esi
+  80268c:	e9 9d fa ff ff       	jmp    80212e <spawn+0x29e>
+		return -E_NO_MEM;
+  802691:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802696:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  80269c:	e9 c1 fc ff ff       	jmp    802362 <spawn+0x4d2>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8026a1:	83 ec 0c             	sub    $0xc,%esp
+  8026a4:	68 40 73 80 00       	push   $0x807340
+  8026a9:	e8 3b 18 00 00       	call   803ee9 <pgbatch_flush>
+  8026ae:	83 c4 10             	add    $0x10,%esp
+  8026b1:	85 c0                	test   %eax,%eax
+  8026b3:	0f 89 51 fe ff ff    	jns    80250a <spawn+0x67a>
+  8026b9:	89 c6                	mov    %eax,%esi
+  8026bb:	e9 6e fa ff ff       	jmp    80212e <spawn+0x29e>
+	sys_page_unmap(0, UTEMP);
+  8026c0:	83 ec 08             	sub    $0x8,%esp
+  8026c3:	68 00 00 40 00       	push   $0x400000
+  8026c8:	6a 00                	push   $0x0
+  8026ca:	e8 71 ea ff ff       	call   801140 <sys_page_unmap>
+  8026cf:	83 c4 10             	add    $0x10,%esp
+  8026d2:	89 9d 78 fd ff ff    	mov    %ebx,-0x288(%ebp)
+  8026d8:	e9 85 fc ff ff       	jmp    802362 <spawn+0x4d2>
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8026dd:	83 ec 04             	sub    $0x4,%esp
+  8026e0:	6a 07                	push   $0x7
+  8026e2:	68 00 00 40 00       	push   $0x400000
+  8026e7:	6a 00                	push   $0x0
+  8026e9:	e8 cd e9 ff ff       	call   8010bb <sys_page_alloc>
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	85 c0                	test   %eax,%eax
+  8026f3:	78 a1                	js     802696 <spawn+0x806>
+	for (argc = 0; argv[argc] != 0; argc++)
+  8026f5:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  8026fc:	00 00 00 
+  8026ff:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802706:	00 00 00 
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802709:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80270e:	be 00 10 40 00       	mov    $0x401000,%esi
+  802713:	e9 03 f9 ff ff       	jmp    80201b <spawn+0x18b>
+
+00802718 <spawnl>:
+{
+  802718:	55                   	push   %ebp
+  802719:	89 e5                	mov    %esp,%ebp
+  80271b:	56                   	push   %esi
+  80271c:	53                   	push   %ebx
+	va_start(vl, arg0);
+  80271d:	8d 45 10             	lea    0x10(%ebp),%eax
+	int argc=0;
+  802720:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802725:	eb 05                	jmp    80272c <spawnl+0x14>
+		argc++;
+  802727:	83 c1 01             	add    $0x1,%ecx
+	while(va_arg(vl, void *) != NULL)
+  80272a:	89 d0                	mov    %edx,%eax
+  80272c:	8d 50 04             	lea    0x4(%eax),%edx
+  80272f:	83 38 00             	cmpl   $0x0,(%eax)
+  802732:	75 f3                	jne    802727 <spawnl+0xf>
+	const char *argv[argc+2];
+  802734:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  80273b:	83 e0 f0             	and    $0xfffffff0,%eax
+  80273e:	29 c4                	sub    %eax,%esp
+  802740:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802744:	89 d8                	mov    %ebx,%eax
+  802746:	c1 e8 02             	shr    $0x2,%eax
+  802749:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80274c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80274f:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+	argv[argc+1] = NULL;
+  802756:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  80275d:	00 
+	va_start(vl, arg0);
+  80275e:	8d 55 10             	lea    0x10(%ebp),%edx
+	for(i=0;i<argc;i++)
+  802761:	89 ce                	mov    %ecx,%esi
+  802763:	85 c9                	test   %ecx,%ecx
+  802765:	74 16                	je     80277d <spawnl+0x65>
+  802767:	b8 00 00 00 00       	mov    $0x0,%eax
+		argv[i+1] = va_arg(vl, const char *);
+  80276c:	83 c0 01             	add    $0x1,%eax
+  80276f:	89 d1                	mov    %edx,%ecx
+  802771:	83 c2 04             	add    $0x4,%edx
+  802774:	8b 09                	mov    (%ecx),%ecx
+  802776:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	for(i=0;i<argc;i++)
+  802779:	39 f0                	cmp    %esi,%eax
+  80277b:	75 ef                	jne    80276c <spawnl+0x54>
+	return spawn(prog, argv);
+  80277d:	83 ec 08             	sub    $0x8,%esp
+  802780:	53                   	push   %ebx
+  802781:	ff 75 08             	push   0x8(%ebp)
+  802784:	e8 07 f7 ff ff       	call   801e90 <spawn>
+}
+  802789:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80278c:	5b                   	pop    %ebx
+  80278d:	5e                   	pop    %esi
+  80278e:	5d                   	pop    %ebp
+  80278f:	c3                   	ret
+
+00802790 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802790:	55                   	push   %ebp
+  802791:	89 e5                	mov    %esp,%ebp
+  802793:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802796:	68 0f 4c 80 00       	push   $0x804c0f
+  80279b:	ff 75 0c             	push   0xc(%ebp)
+  80279e:	e8 e4 e4 ff ff       	call   800c87 <strcpy>
+	return 0;
+}
+  8027a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a8:	c9                   	leave
+  8027a9:	c3                   	ret
+
+008027aa <devsock_close>:
+{
+  8027aa:	55                   	push   %ebp
+  8027ab:	89 e5                	mov    %esp,%ebp
+  8027ad:	53                   	push   %ebx
+  8027ae:	83 ec 10             	sub    $0x10,%esp
+  8027b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027b4:	53                   	push   %ebx
+  8027b5:	e8 ff 1b 00 00       	call   8043b9 <pageref>
+  8027ba:	89 c2                	mov    %eax,%edx
+  8027bc:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027bf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027c4:	83 fa 01             	cmp    $0x1,%edx
+  8027c7:	74 05                	je     8027ce <devsock_close+0x24>
+}
+  8027c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027cc:	c9                   	leave
+  8027cd:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027ce:	83 ec 0c             	sub    $0xc,%esp
+  8027d1:	ff 73 0c             	push   0xc(%ebx)
+  8027d4:	e8 b0 05 00 00       	call   802d89 <nsipc_close>
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	eb eb                	jmp    8027c9 <devsock_close+0x1f>
+
+008027de <devsock_write>:
+{
+  8027de:	55                   	push   %ebp
+  8027df:	89 e5                	mov    %esp,%ebp
+  8027e1:	53                   	push   %ebx
+  8027e2:	83 ec 14             	sub    $0x14,%esp
+  8027e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027eb:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8027ee:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8027f1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8027f4:	8b 41 08             	mov    0x8(%ecx),%eax
+  8027f7:	c1 f8 09             	sar    $0x9,%eax
+  8027fa:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8027fd:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802803:	77 13                	ja     802818 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802805:	50                   	push   %eax
+  802806:	52                   	push   %edx
+  802807:	53                   	push   %ebx
+  802808:	ff 71 0c             	push   0xc(%ecx)
+  80280b:	e8 5c 06 00 00       	call   802e6c <nsipc_send>
+  802810:	83 c4 10             	add    $0x10,%esp
+}
+  802813:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802816:	c9                   	leave
+  802817:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802818:	50                   	push   %eax
+  802819:	6a 01                	push   $0x1
+  80281b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80281e:	50                   	push   %eax
+  80281f:	ff 71 0c             	push   0xc(%ecx)
+  802822:	e8 a6 06 00 00       	call   802ecd <nsipc_sendmsg>
+  802827:	83 c4 10             	add    $0x10,%esp
+  80282a:	eb e7                	jmp    802813 <devsock_write+0x35>
+
+0080282c <devsock_read>:
+{
+  80282c:	55                   	push   %ebp
+  80282d:	89 e5                	mov    %esp,%ebp
+  80282f:	53                   	push   %ebx
+  802830:	83 ec 14             	sub    $0x14,%esp
+  802833:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802836:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802839:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80283c:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80283f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802842:	8b 41 08             	mov    0x8(%ecx),%eax
+  802845:	c1 f8 09             	sar    $0x9,%eax
+  802848:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80284b:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802851:	77 13                	ja     802866 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802853:	50                   	push   %eax
+  802854:	52                   	push   %edx
+  802855:	53                   	push   %ebx
+  802856:	ff 71 0c             	push   0xc(%ecx)
+  802859:	e8 9c 05 00 00       	call   802dfa <nsipc_recv>
+  80285e:	83 c4 10             	add    $0x10,%esp
+}
+  802861:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802864:	c9                   	leave
+  802865:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802866:	50                   	push   %eax
+  802867:	6a 01                	push   $0x1
+  802869:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80286c:	50                   	push   %eax
+  80286d:	ff 71 0c             	push   0xc(%ecx)
+  802870:	e8 02 0a 00 00       	call   803277 <nsipc_recvmsg>
+  802875:	83 c4 10             	add    $0x10,%esp
+  802878:	eb e7                	jmp    802861 <devsock_read+0x35>
+
+0080287a <fd2sockid>:
+{
+  80287a:	55                   	push   %ebp
+  80287b:	89 e5                	mov    %esp,%ebp
+  80287d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802880:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802883:	52                   	push   %edx
+  802884:	50                   	push   %eax
+  802885:	e8 0b ed ff ff       	call   801595 <fd_lookup>
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	85 c0                	test   %eax,%eax
+  80288f:	78 10                	js     8028a1 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802891:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802894:	8b 0d e0 67 80 00    	mov    0x8067e0,%ecx
+  80289a:	39 08                	cmp    %ecx,(%eax)
+  80289c:	75 05                	jne    8028a3 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80289e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8028a1:	c9                   	leave
+  8028a2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028a8:	eb f7                	jmp    8028a1 <fd2sockid+0x27>
+
+008028aa <sock_flags>:
+{
+  8028aa:	55                   	push   %ebp
+  8028ab:	89 e5                	mov    %esp,%ebp
+  8028ad:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8028b0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028b3:	52                   	push   %edx
+  8028b4:	50                   	push   %eax
+  8028b5:	e8 db ec ff ff       	call   801595 <fd_lookup>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	78 0e                	js     8028cf <sock_flags+0x25>
+  8028c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c4:	8b 40 08             	mov    0x8(%eax),%eax
+  8028c7:	c1 e8 09             	shr    $0x9,%eax
+  8028ca:	83 e0 08             	and    $0x8,%eax
+}
+  8028cd:	c9                   	leave
+  8028ce:	c3                   	ret
+		return 0;
+  8028cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d4:	eb f7                	jmp    8028cd <sock_flags+0x23>
+
+008028d6 <alloc_sockfd>:
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	56                   	push   %esi
+  8028da:	53                   	push   %ebx
+  8028db:	83 ec 1c             	sub    $0x1c,%esp
+  8028de:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028e3:	50                   	push   %eax
+  8028e4:	e8 5c ec ff ff       	call   801545 <fd_alloc>
+  8028e9:	89 c3                	mov    %eax,%ebx
+  8028eb:	83 c4 10             	add    $0x10,%esp
+  8028ee:	85 c0                	test   %eax,%eax
+  8028f0:	78 43                	js     802935 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8028f2:	83 ec 04             	sub    $0x4,%esp
+  8028f5:	68 07 04 00 00       	push   $0x407
+  8028fa:	ff 75 f4             	push   -0xc(%ebp)
+  8028fd:	6a 00                	push   $0x0
+  8028ff:	e8 b7 e7 ff ff       	call   8010bb <sys_page_alloc>
+  802904:	89 c3                	mov    %eax,%ebx
+  802906:	83 c4 10             	add    $0x10,%esp
+  802909:	85 c0                	test   %eax,%eax
+  80290b:	78 28                	js     802935 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80290d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802910:	8b 15 e0 67 80 00    	mov    0x8067e0,%edx
+  802916:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802918:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80291b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802922:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802925:	83 ec 0c             	sub    $0xc,%esp
+  802928:	50                   	push   %eax
+  802929:	e8 f0 eb ff ff       	call   80151e <fd2num>
+  80292e:	89 c3                	mov    %eax,%ebx
+  802930:	83 c4 10             	add    $0x10,%esp
+  802933:	eb 0c                	jmp    802941 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802935:	83 ec 0c             	sub    $0xc,%esp
+  802938:	56                   	push   %esi
+  802939:	e8 4b 04 00 00       	call   802d89 <nsipc_close>
+		return r;
+  80293e:	83 c4 10             	add    $0x10,%esp
+}
+  802941:	89 d8                	mov    %ebx,%eax
+  802943:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802946:	5b                   	pop    %ebx
+  802947:	5e                   	pop    %esi
+  802948:	5d                   	pop    %ebp
+  802949:	c3                   	ret
+
+0080294a <accept>:
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	56                   	push   %esi
+  80294e:	53                   	push   %ebx
+  80294f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802952:	89 f0                	mov    %esi,%eax
+  802954:	e8 21 ff ff ff       	call   80287a <fd2sockid>
+  802959:	89 c3                	mov    %eax,%ebx
+  80295b:	85 c0                	test   %eax,%eax
+  80295d:	78 24                	js     802983 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80295f:	89 f0                	mov    %esi,%eax
+  802961:	e8 44 ff ff ff       	call   8028aa <sock_flags>
+  802966:	50                   	push   %eax
+  802967:	ff 75 10             	push   0x10(%ebp)
+  80296a:	ff 75 0c             	push   0xc(%ebp)
+  80296d:	53                   	push   %ebx
+  80296e:	e8 6b 03 00 00       	call   802cde <nsipc_accept>
+  802973:	89 c3                	mov    %eax,%ebx
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	78 07                	js     802983 <accept+0x39>
+	return alloc_sockfd(r);
+  80297c:	e8 55 ff ff ff       	call   8028d6 <alloc_sockfd>
+  802981:	89 c3                	mov    %eax,%ebx
+}
+  802983:	89 d8                	mov    %ebx,%eax
+  802985:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802988:	5b                   	pop    %ebx
+  802989:	5e                   	pop    %esi
+  80298a:	5d                   	pop    %ebp
+  80298b:	c3                   	ret
+
+0080298c <bind>:
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802992:	8b 45 08             	mov    0x8(%ebp),%eax
+  802995:	e8 e0 fe ff ff       	call   80287a <fd2sockid>
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 12                	js     8029b0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80299e:	83 ec 04             	sub    $0x4,%esp
+  8029a1:	ff 75 10             	push   0x10(%ebp)
+  8029a4:	ff 75 0c             	push   0xc(%ebp)
+  8029a7:	50                   	push   %eax
+  8029a8:	e8 85 03 00 00       	call   802d32 <nsipc_bind>
+  8029ad:	83 c4 10             	add    $0x10,%esp
+}
+  8029b0:	c9                   	leave
+  8029b1:	c3                   	ret
+
+008029b2 <shutdown>:
+{
+  8029b2:	55                   	push   %ebp
+  8029b3:	89 e5                	mov    %esp,%ebp
+  8029b5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029bb:	e8 ba fe ff ff       	call   80287a <fd2sockid>
+  8029c0:	85 c0                	test   %eax,%eax
+  8029c2:	78 0f                	js     8029d3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8029c4:	83 ec 08             	sub    $0x8,%esp
+  8029c7:	ff 75 0c             	push   0xc(%ebp)
+  8029ca:	50                   	push   %eax
+  8029cb:	e8 97 03 00 00       	call   802d67 <nsipc_shutdown>
+  8029d0:	83 c4 10             	add    $0x10,%esp
+}
+  8029d3:	c9                   	leave
+  8029d4:	c3                   	ret
+
+008029d5 <connect>:
+{
+  8029d5:	55                   	push   %ebp
+  8029d6:	89 e5                	mov    %esp,%ebp
+  8029d8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029de:	e8 97 fe ff ff       	call   80287a <fd2sockid>
+  8029e3:	85 c0                	test   %eax,%eax
+  8029e5:	78 12                	js     8029f9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029e7:	83 ec 04             	sub    $0x4,%esp
+  8029ea:	ff 75 10             	push   0x10(%ebp)
+  8029ed:	ff 75 0c             	push   0xc(%ebp)
+  8029f0:	50                   	push   %eax
+  8029f1:	e8 ad 03 00 00       	call   802da3 <nsipc_connect>
+  8029f6:	83 c4 10             	add    $0x10,%esp
+}
+  8029f9:	c9                   	leave
+  8029fa:	c3                   	ret
+
+008029fb <listen>:
+{
+  8029fb:	55                   	push   %ebp
+  8029fc:	89 e5                	mov    %esp,%ebp
+  8029fe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a04:	e8 71 fe ff ff       	call   80287a <fd2sockid>
+  802a09:	85 c0                	test   %eax,%eax
+  802a0b:	78 0f                	js     802a1c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a0d:	83 ec 08             	sub    $0x8,%esp
+  802a10:	ff 75 0c             	push   0xc(%ebp)
+  802a13:	50                   	push   %eax
+  802a14:	e8 bf 03 00 00       	call   802dd8 <nsipc_listen>
+  802a19:	83 c4 10             	add    $0x10,%esp
+}
+  802a1c:	c9                   	leave
+  802a1d:	c3                   	ret
+
+00802a1e <sendmsg>:
+{
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	57                   	push   %edi
+  802a22:	56                   	push   %esi
+  802a23:	53                   	push   %ebx
+  802a24:	83 ec 0c             	sub    $0xc,%esp
+  802a27:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a2a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802a2d:	89 f0                	mov    %esi,%eax
+  802a2f:	e8 46 fe ff ff       	call   80287a <fd2sockid>
+  802a34:	89 c3                	mov    %eax,%ebx
+  802a36:	85 c0                	test   %eax,%eax
+  802a38:	78 1c                	js     802a56 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802a3a:	89 f0                	mov    %esi,%eax
+  802a3c:	e8 69 fe ff ff       	call   8028aa <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802a41:	0b 45 10             	or     0x10(%ebp),%eax
+  802a44:	50                   	push   %eax
+  802a45:	ff 77 0c             	push   0xc(%edi)
+  802a48:	ff 77 08             	push   0x8(%edi)
+  802a4b:	53                   	push   %ebx
+  802a4c:	e8 7c 04 00 00       	call   802ecd <nsipc_sendmsg>
+  802a51:	89 c3                	mov    %eax,%ebx
+  802a53:	83 c4 10             	add    $0x10,%esp
+}
+  802a56:	89 d8                	mov    %ebx,%eax
+  802a58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a5b:	5b                   	pop    %ebx
+  802a5c:	5e                   	pop    %esi
+  802a5d:	5f                   	pop    %edi
+  802a5e:	5d                   	pop    %ebp
+  802a5f:	c3                   	ret
+
+00802a60 <recvmsg>:
+{
+  802a60:	55                   	push   %ebp
+  802a61:	89 e5                	mov    %esp,%ebp
+  802a63:	57                   	push   %edi
+  802a64:	56                   	push   %esi
+  802a65:	53                   	push   %ebx
+  802a66:	83 ec 0c             	sub    $0xc,%esp
+  802a69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a6c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802a6f:	89 f8                	mov    %edi,%eax
+  802a71:	e8 04 fe ff ff       	call   80287a <fd2sockid>
+  802a76:	89 c3                	mov    %eax,%ebx
+  802a78:	85 c0                	test   %eax,%eax
+  802a7a:	78 2a                	js     802aa6 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802a7c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802a83:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802a8a:	89 f8                	mov    %edi,%eax
+  802a8c:	e8 19 fe ff ff       	call   8028aa <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802a91:	0b 45 10             	or     0x10(%ebp),%eax
+  802a94:	50                   	push   %eax
+  802a95:	ff 76 0c             	push   0xc(%esi)
+  802a98:	ff 76 08             	push   0x8(%esi)
+  802a9b:	53                   	push   %ebx
+  802a9c:	e8 d6 07 00 00       	call   803277 <nsipc_recvmsg>
+  802aa1:	89 c3                	mov    %eax,%ebx
+  802aa3:	83 c4 10             	add    $0x10,%esp
+}
+  802aa6:	89 d8                	mov    %ebx,%eax
+  802aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aab:	5b                   	pop    %ebx
+  802aac:	5e                   	pop    %esi
+  802aad:	5f                   	pop    %edi
+  802aae:	5d                   	pop    %ebp
+  802aaf:	c3                   	ret
+
+00802ab0 <sendfile>:
+{
+  802ab0:	55                   	push   %ebp
+  802ab1:	89 e5                	mov    %esp,%ebp
+  802ab3:	56                   	push   %esi
+  802ab4:	53                   	push   %ebx
+  802ab5:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802ab8:	89 f0                	mov    %esi,%eax
+  802aba:	e8 bb fd ff ff       	call   80287a <fd2sockid>
+  802abf:	89 c3                	mov    %eax,%ebx
+  802ac1:	85 c0                	test   %eax,%eax
+  802ac3:	78 1f                	js     802ae4 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802ac5:	89 f0                	mov    %esi,%eax
+  802ac7:	e8 de fd ff ff       	call   8028aa <sock_flags>
+  802acc:	83 ec 0c             	sub    $0xc,%esp
+  802acf:	50                   	push   %eax
+  802ad0:	ff 75 14             	push   0x14(%ebp)
+  802ad3:	ff 75 10             	push   0x10(%ebp)
+  802ad6:	ff 75 0c             	push   0xc(%ebp)
+  802ad9:	53                   	push   %ebx
+  802ada:	e8 64 06 00 00       	call   803143 <nsipc_sendfile>
+  802adf:	89 c3                	mov    %eax,%ebx
+  802ae1:	83 c4 20             	add    $0x20,%esp
+}
+  802ae4:	89 d8                	mov    %ebx,%eax
+  802ae6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae9:	5b                   	pop    %ebx
+  802aea:	5e                   	pop    %esi
+  802aeb:	5d                   	pop    %ebp
+  802aec:	c3                   	ret
+
+00802aed <evctl>:
+{
+  802aed:	55                   	push   %ebp
+  802aee:	89 e5                	mov    %esp,%ebp
+  802af0:	53                   	push   %ebx
+  802af1:	83 ec 04             	sub    $0x4,%esp
+  802af4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802af7:	89 d8                	mov    %ebx,%eax
+  802af9:	e8 7c fd ff ff       	call   80287a <fd2sockid>
+  802afe:	85 c0                	test   %eax,%eax
+  802b00:	78 10                	js     802b12 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802b02:	83 ec 04             	sub    $0x4,%esp
+  802b05:	53                   	push   %ebx
+  802b06:	ff 75 0c             	push   0xc(%ebp)
+  802b09:	50                   	push   %eax
+  802b0a:	e8 d2 0b 00 00       	call   8036e1 <nsipc_evctl>
+  802b0f:	83 c4 10             	add    $0x10,%esp
+}
+  802b12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <evwait>:
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802b1d:	ff 75 10             	push   0x10(%ebp)
+  802b20:	ff 75 0c             	push   0xc(%ebp)
+  802b23:	ff 75 08             	push   0x8(%ebp)
+  802b26:	e8 e0 0b 00 00       	call   80370b <nsipc_evwait>
+}
+  802b2b:	c9                   	leave
+  802b2c:	c3                   	ret
+
+00802b2d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b33:	ff 75 10             	push   0x10(%ebp)
+  802b36:	ff 75 0c             	push   0xc(%ebp)
+  802b39:	ff 75 08             	push   0x8(%ebp)
+  802b3c:	e8 31 0c 00 00       	call   803772 <nsipc_socket>
+  802b41:	83 c4 10             	add    $0x10,%esp
+  802b44:	85 c0                	test   %eax,%eax
+  802b46:	78 05                	js     802b4d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b48:	e8 89 fd ff ff       	call   8028d6 <alloc_sockfd>
+}
+  802b4d:	c9                   	leave
+  802b4e:	c3                   	ret
+
+00802b4f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b4f:	55                   	push   %ebp
+  802b50:	89 e5                	mov    %esp,%ebp
+  802b52:	53                   	push   %ebx
+  802b53:	83 ec 04             	sub    $0x4,%esp
+  802b56:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802b58:	83 3d 64 79 80 00 00 	cmpl   $0x0,0x807964
+  802b5f:	74 26                	je     802b87 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b61:	6a 07                	push   $0x7
+  802b63:	68 00 b0 80 00       	push   $0x80b000
+  802b68:	53                   	push   %ebx
+  802b69:	ff 35 64 79 80 00    	push   0x807964
+  802b6f:	e8 9d 17 00 00       	call   804311 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b74:	83 c4 0c             	add    $0xc,%esp
+  802b77:	6a 00                	push   $0x0
+  802b79:	6a 00                	push   $0x0
+  802b7b:	6a 00                	push   $0x0
+  802b7d:	e8 ff 14 00 00       	call   804081 <ipc_recv>
+}
+  802b82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b85:	c9                   	leave
+  802b86:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b87:	83 ec 0c             	sub    $0xc,%esp
+  802b8a:	6a 03                	push   $0x3
+  802b8c:	e8 e9 17 00 00       	call   80437a <ipc_find_env>
+  802b91:	a3 64 79 80 00       	mov    %eax,0x807964
+  802b96:	83 c4 10             	add    $0x10,%esp
+  802b99:	eb c6                	jmp    802b61 <nsipc+0x12>
+
+00802b9b <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802b9b:	55                   	push   %ebp
+  802b9c:	89 e5                	mov    %esp,%ebp
+  802b9e:	56                   	push   %esi
+  802b9f:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802ba0:	8b 35 70 79 80 00    	mov    0x807970,%esi
+		return 0;
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802bab:	85 f6                	test   %esi,%esi
+  802bad:	75 33                	jne    802be2 <nsbulk_map+0x47>
+  802baf:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802bb4:	83 ec 04             	sub    $0x4,%esp
+  802bb7:	6a 07                	push   $0x7
+  802bb9:	53                   	push   %ebx
+  802bba:	6a 00                	push   $0x0
+  802bbc:	e8 fa e4 ff ff       	call   8010bb <sys_page_alloc>
+  802bc1:	83 c4 10             	add    $0x10,%esp
+  802bc4:	85 c0                	test   %eax,%eax
+  802bc6:	78 1a                	js     802be2 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802bc8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802bce:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802bd4:	75 de                	jne    802bb4 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802bd6:	c7 05 70 79 80 00 01 	movl   $0x1,0x807970
+  802bdd:	00 00 00 
+	return 0;
+  802be0:	89 f0                	mov    %esi,%eax
+}
+  802be2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be5:	5b                   	pop    %ebx
+  802be6:	5e                   	pop    %esi
+  802be7:	5d                   	pop    %ebp
+  802be8:	c3                   	ret
+
+00802be9 <nsbulk_own>:
+{
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	57                   	push   %edi
+  802bed:	56                   	push   %esi
+  802bee:	53                   	push   %ebx
+  802bef:	83 ec 0c             	sub    $0xc,%esp
+  802bf2:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802bf4:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802bf7:	85 d2                	test   %edx,%edx
+  802bf9:	7f 0e                	jg     802c09 <nsbulk_own+0x20>
+	return 0;
+  802bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c00:	eb 47                	jmp    802c49 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802c02:	83 c3 01             	add    $0x1,%ebx
+  802c05:	39 fb                	cmp    %edi,%ebx
+  802c07:	7d 3b                	jge    802c44 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802c09:	be 01 00 00 00       	mov    $0x1,%esi
+  802c0e:	89 d9                	mov    %ebx,%ecx
+  802c10:	d3 e6                	shl    %cl,%esi
+  802c12:	89 f0                	mov    %esi,%eax
+  802c14:	23 05 6c 79 80 00    	and    0x80796c,%eax
+  802c1a:	74 e6                	je     802c02 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802c1c:	83 ec 04             	sub    $0x4,%esp
+  802c1f:	6a 07                	push   $0x7
+  802c21:	89 d8                	mov    %ebx,%eax
+  802c23:	c1 e0 0c             	shl    $0xc,%eax
+  802c26:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802c2b:	50                   	push   %eax
+  802c2c:	6a 00                	push   $0x0
+  802c2e:	e8 88 e4 ff ff       	call   8010bb <sys_page_alloc>
+  802c33:	83 c4 10             	add    $0x10,%esp
+  802c36:	85 c0                	test   %eax,%eax
+  802c38:	78 0f                	js     802c49 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802c3a:	f7 d6                	not    %esi
+  802c3c:	21 35 6c 79 80 00    	and    %esi,0x80796c
+  802c42:	eb be                	jmp    802c02 <nsbulk_own+0x19>
+	return 0;
+  802c44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c4c:	5b                   	pop    %ebx
+  802c4d:	5e                   	pop    %esi
+  802c4e:	5f                   	pop    %edi
+  802c4f:	5d                   	pop    %ebp
+  802c50:	c3                   	ret
+
+00802c51 <nsipc_bulk>:
+{
+  802c51:	55                   	push   %ebp
+  802c52:	89 e5                	mov    %esp,%ebp
+  802c54:	57                   	push   %edi
+  802c55:	56                   	push   %esi
+  802c56:	53                   	push   %ebx
+  802c57:	83 ec 1c             	sub    $0x1c,%esp
+  802c5a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c5d:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802c5f:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802c65:	c1 fb 0c             	sar    $0xc,%ebx
+  802c68:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802c6b:	83 3d 64 79 80 00 00 	cmpl   $0x0,0x807964
+  802c72:	74 56                	je     802cca <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802c74:	85 ff                	test   %edi,%edi
+  802c76:	7e 24                	jle    802c9c <nsipc_bulk+0x4b>
+  802c78:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802c7e:	74 1c                	je     802c9c <nsipc_bulk+0x4b>
+  802c80:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802c86:	c1 e3 0c             	shl    $0xc,%ebx
+  802c89:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802c8e:	0f b6 10             	movzbl (%eax),%edx
+  802c91:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802c93:	05 00 10 00 00       	add    $0x1000,%eax
+  802c98:	39 d8                	cmp    %ebx,%eax
+  802c9a:	75 f2                	jne    802c8e <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802c9c:	83 ec 0c             	sub    $0xc,%esp
+  802c9f:	56                   	push   %esi
+  802ca0:	57                   	push   %edi
+  802ca1:	68 00 00 00 e0       	push   $0xe0000000
+  802ca6:	ff 75 e4             	push   -0x1c(%ebp)
+  802ca9:	ff 35 64 79 80 00    	push   0x807964
+  802caf:	e8 91 16 00 00       	call   804345 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802cb4:	83 c4 1c             	add    $0x1c,%esp
+  802cb7:	6a 00                	push   $0x0
+  802cb9:	6a 00                	push   $0x0
+  802cbb:	6a 00                	push   $0x0
+  802cbd:	e8 bf 13 00 00       	call   804081 <ipc_recv>
+}
+  802cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc5:	5b                   	pop    %ebx
+  802cc6:	5e                   	pop    %esi
+  802cc7:	5f                   	pop    %edi
+  802cc8:	5d                   	pop    %ebp
+  802cc9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cca:	83 ec 0c             	sub    $0xc,%esp
+  802ccd:	6a 03                	push   $0x3
+  802ccf:	e8 a6 16 00 00       	call   80437a <ipc_find_env>
+  802cd4:	a3 64 79 80 00       	mov    %eax,0x807964
+  802cd9:	83 c4 10             	add    $0x10,%esp
+  802cdc:	eb 96                	jmp    802c74 <nsipc_bulk+0x23>
+
+00802cde <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802cde:	55                   	push   %ebp
+  802cdf:	89 e5                	mov    %esp,%ebp
+  802ce1:	53                   	push   %ebx
+  802ce2:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce8:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_flags = flags;
+  802ced:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cf0:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802cf5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cfa:	e8 50 fe ff ff       	call   802b4f <nsipc>
+  802cff:	89 c3                	mov    %eax,%ebx
+  802d01:	85 c0                	test   %eax,%eax
+  802d03:	79 07                	jns    802d0c <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d05:	89 d8                	mov    %ebx,%eax
+  802d07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d0a:	c9                   	leave
+  802d0b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d0c:	83 ec 04             	sub    $0x4,%esp
+  802d0f:	ff 35 10 b0 80 00    	push   0x80b010
+  802d15:	68 00 b0 80 00       	push   $0x80b000
+  802d1a:	ff 75 0c             	push   0xc(%ebp)
+  802d1d:	e8 15 e1 ff ff       	call   800e37 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d22:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  802d28:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d2b:	89 10                	mov    %edx,(%eax)
+  802d2d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d30:	eb d3                	jmp    802d05 <nsipc_accept+0x27>
+
+00802d32 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d32:	55                   	push   %ebp
+  802d33:	89 e5                	mov    %esp,%ebp
+  802d35:	53                   	push   %ebx
+  802d36:	83 ec 08             	sub    $0x8,%esp
+  802d39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3f:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d44:	53                   	push   %ebx
+  802d45:	ff 75 0c             	push   0xc(%ebp)
+  802d48:	68 04 b0 80 00       	push   $0x80b004
+  802d4d:	e8 e5 e0 ff ff       	call   800e37 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d52:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  802d58:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d5d:	e8 ed fd ff ff       	call   802b4f <nsipc>
+}
+  802d62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d65:	c9                   	leave
+  802d66:	c3                   	ret
+
+00802d67 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d67:	55                   	push   %ebp
+  802d68:	89 e5                	mov    %esp,%ebp
+  802d6a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d70:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  802d75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d78:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d7d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d82:	e8 c8 fd ff ff       	call   802b4f <nsipc>
+}
+  802d87:	c9                   	leave
+  802d88:	c3                   	ret
+
+00802d89 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d89:	55                   	push   %ebp
+  802d8a:	89 e5                	mov    %esp,%ebp
+  802d8c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d92:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  802d97:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d9c:	e8 ae fd ff ff       	call   802b4f <nsipc>
+}
+  802da1:	c9                   	leave
+  802da2:	c3                   	ret
+
+00802da3 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802da3:	55                   	push   %ebp
+  802da4:	89 e5                	mov    %esp,%ebp
+  802da6:	53                   	push   %ebx
+  802da7:	83 ec 08             	sub    $0x8,%esp
+  802daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802dad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db0:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802db5:	53                   	push   %ebx
+  802db6:	ff 75 0c             	push   0xc(%ebp)
+  802db9:	68 04 b0 80 00       	push   $0x80b004
+  802dbe:	e8 74 e0 ff ff       	call   800e37 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802dc3:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  802dc9:	b8 05 00 00 00       	mov    $0x5,%eax
+  802dce:	e8 7c fd ff ff       	call   802b4f <nsipc>
+}
+  802dd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dd6:	c9                   	leave
+  802dd7:	c3                   	ret
+
+00802dd8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802dde:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de1:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  802de6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802de9:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  802dee:	b8 06 00 00 00       	mov    $0x6,%eax
+  802df3:	e8 57 fd ff ff       	call   802b4f <nsipc>
+}
+  802df8:	c9                   	leave
+  802df9:	c3                   	ret
+
+00802dfa <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802dfa:	55                   	push   %ebp
+  802dfb:	89 e5                	mov    %esp,%ebp
+  802dfd:	56                   	push   %esi
+  802dfe:	53                   	push   %ebx
+  802dff:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e05:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  802e0a:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  802e10:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e13:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e18:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e1d:	e8 2d fd ff ff       	call   802b4f <nsipc>
+  802e22:	89 c3                	mov    %eax,%ebx
+  802e24:	85 c0                	test   %eax,%eax
+  802e26:	78 22                	js     802e4a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e28:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e2d:	39 c6                	cmp    %eax,%esi
+  802e2f:	0f 4e c6             	cmovle %esi,%eax
+  802e32:	39 c3                	cmp    %eax,%ebx
+  802e34:	7f 1d                	jg     802e53 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e36:	83 ec 04             	sub    $0x4,%esp
+  802e39:	53                   	push   %ebx
+  802e3a:	68 00 b0 80 00       	push   $0x80b000
+  802e3f:	ff 75 0c             	push   0xc(%ebp)
+  802e42:	e8 f0 df ff ff       	call   800e37 <memmove>
+  802e47:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e4a:	89 d8                	mov    %ebx,%eax
+  802e4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e4f:	5b                   	pop    %ebx
+  802e50:	5e                   	pop    %esi
+  802e51:	5d                   	pop    %ebp
+  802e52:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e53:	68 1b 4c 80 00       	push   $0x804c1b
+  802e58:	68 62 4b 80 00       	push   $0x804b62
+  802e5d:	68 b2 00 00 00       	push   $0xb2
+  802e62:	68 30 4c 80 00       	push   $0x804c30
+  802e67:	e8 49 d6 ff ff       	call   8004b5 <_panic>
+
+00802e6c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e6c:	55                   	push   %ebp
+  802e6d:	89 e5                	mov    %esp,%ebp
+  802e6f:	53                   	push   %ebx
+  802e70:	83 ec 04             	sub    $0x4,%esp
+  802e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e79:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  802e7e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e84:	7f 2e                	jg     802eb4 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e86:	83 ec 04             	sub    $0x4,%esp
+  802e89:	53                   	push   %ebx
+  802e8a:	ff 75 0c             	push   0xc(%ebp)
+  802e8d:	68 0c b0 80 00       	push   $0x80b00c
+  802e92:	e8 a0 df ff ff       	call   800e37 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e97:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  802e9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea0:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  802ea5:	b8 08 00 00 00       	mov    $0x8,%eax
+  802eaa:	e8 a0 fc ff ff       	call   802b4f <nsipc>
+}
+  802eaf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb2:	c9                   	leave
+  802eb3:	c3                   	ret
+	assert(size < 1600);
+  802eb4:	68 3c 4c 80 00       	push   $0x804c3c
+  802eb9:	68 62 4b 80 00       	push   $0x804b62
+  802ebe:	68 bd 00 00 00       	push   $0xbd
+  802ec3:	68 30 4c 80 00       	push   $0x804c30
+  802ec8:	e8 e8 d5 ff ff       	call   8004b5 <_panic>
+
+00802ecd <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802ecd:	55                   	push   %ebp
+  802ece:	89 e5                	mov    %esp,%ebp
+  802ed0:	57                   	push   %edi
+  802ed1:	56                   	push   %esi
+  802ed2:	53                   	push   %ebx
+  802ed3:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802ed6:	e8 c0 fc ff ff       	call   802b9b <nsbulk_map>
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	78 55                	js     802f34 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802edf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802ee6:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802eed:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802ef4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ef7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802efa:	0f 8d 24 02 00 00    	jge    803124 <nsipc_sendmsg+0x257>
+  802f00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f03:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802f06:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802f09:	89 d8                	mov    %ebx,%eax
+  802f0b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f10:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802f12:	83 ec 0c             	sub    $0xc,%esp
+  802f15:	68 60 76 80 00       	push   $0x807660
+  802f1a:	e8 bc 0f 00 00       	call   803edb <pgbatch_init>
+  802f1f:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802f22:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802f24:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802f27:	e9 82 00 00 00       	jmp    802fae <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802f2c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f2f:	85 db                	test   %ebx,%ebx
+  802f31:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f37:	5b                   	pop    %ebx
+  802f38:	5e                   	pop    %esi
+  802f39:	5f                   	pop    %edi
+  802f3a:	5d                   	pop    %ebp
+  802f3b:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802f3c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802f41:	29 c8                	sub    %ecx,%eax
+  802f43:	39 d0                	cmp    %edx,%eax
+  802f45:	0f 46 d0             	cmovbe %eax,%edx
+  802f48:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802f4a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802f50:	85 ff                	test   %edi,%edi
+  802f52:	0f 49 c7             	cmovns %edi,%eax
+  802f55:	c1 f8 0c             	sar    $0xc,%eax
+  802f58:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f5d:	e8 87 fc ff ff       	call   802be9 <nsbulk_own>
+  802f62:	85 c0                	test   %eax,%eax
+  802f64:	0f 88 17 01 00 00    	js     803081 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802f6a:	83 ec 04             	sub    $0x4,%esp
+  802f6d:	56                   	push   %esi
+  802f6e:	ff 75 e0             	push   -0x20(%ebp)
+  802f71:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f74:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f79:	50                   	push   %eax
+  802f7a:	e8 b8 de ff ff       	call   800e37 <memmove>
+  802f7f:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802f82:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802f85:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f88:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802f8b:	0f 84 fd 00 00 00    	je     80308e <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802f91:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802f94:	01 f7                	add    %esi,%edi
+  802f96:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802f99:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f9c:	0f 8d 01 01 00 00    	jge    8030a3 <nsipc_sendmsg+0x1d6>
+  802fa2:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802fa8:	0f 8f f0 00 00 00    	jg     80309e <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802fae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fb1:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802fb4:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802fb7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fba:	89 c2                	mov    %eax,%edx
+  802fbc:	03 13                	add    (%ebx),%edx
+  802fbe:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802fc1:	8b 73 04             	mov    0x4(%ebx),%esi
+  802fc4:	29 c6                	sub    %eax,%esi
+  802fc6:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802fcb:	29 f9                	sub    %edi,%ecx
+  802fcd:	39 ce                	cmp    %ecx,%esi
+  802fcf:	89 ca                	mov    %ecx,%edx
+  802fd1:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802fd4:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802fd7:	89 f9                	mov    %edi,%ecx
+  802fd9:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802fdf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802fe2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802fe7:	09 c8                	or     %ecx,%eax
+  802fe9:	0f 85 4d ff ff ff    	jne    802f3c <nsipc_sendmsg+0x6f>
+  802fef:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802ff5:	0f 86 41 ff ff ff    	jbe    802f3c <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ffb:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803001:	85 ff                	test   %edi,%edi
+  803003:	0f 49 c7             	cmovns %edi,%eax
+  803006:	c1 f8 0c             	sar    $0xc,%eax
+  803009:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80300b:	89 d1                	mov    %edx,%ecx
+  80300d:	c1 e9 0c             	shr    $0xc,%ecx
+  803010:	01 c8                	add    %ecx,%eax
+  803012:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803015:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803018:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80301a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80301d:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803022:	29 c8                	sub    %ecx,%eax
+  803024:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803027:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80302a:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80302c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803031:	89 f9                	mov    %edi,%ecx
+  803033:	d3 e0                	shl    %cl,%eax
+  803035:	09 05 6c 79 80 00    	or     %eax,0x80796c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80303b:	83 ec 08             	sub    $0x8,%esp
+  80303e:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  803040:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803043:	50                   	push   %eax
+  803044:	6a 00                	push   $0x0
+  803046:	56                   	push   %esi
+  803047:	6a 00                	push   $0x0
+  803049:	68 60 76 80 00       	push   $0x807660
+  80304e:	e8 46 0f 00 00       	call   803f99 <pgbatch_map>
+  803053:	83 c4 20             	add    $0x20,%esp
+  803056:	85 c0                	test   %eax,%eax
+  803058:	0f 88 ce fe ff ff    	js     802f2c <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80305e:	83 c7 01             	add    $0x1,%edi
+  803061:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803067:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80306a:	39 c7                	cmp    %eax,%edi
+  80306c:	75 be                	jne    80302c <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80306e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803071:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803074:	89 d6                	mov    %edx,%esi
+  803076:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80307c:	e9 01 ff ff ff       	jmp    802f82 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  803081:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803084:	85 db                	test   %ebx,%ebx
+  803086:	0f 45 c3             	cmovne %ebx,%eax
+  803089:	e9 a6 fe ff ff       	jmp    802f34 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80308e:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  803092:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803099:	e9 f3 fe ff ff       	jmp    802f91 <nsipc_sendmsg+0xc4>
+  80309e:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8030a1:	eb 03                	jmp    8030a6 <nsipc_sendmsg+0x1d9>
+  8030a3:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8030a6:	83 ec 0c             	sub    $0xc,%esp
+  8030a9:	68 60 76 80 00       	push   $0x807660
+  8030ae:	e8 36 0e 00 00       	call   803ee9 <pgbatch_flush>
+  8030b3:	83 c4 10             	add    $0x10,%esp
+  8030b6:	85 c0                	test   %eax,%eax
+  8030b8:	78 50                	js     80310a <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8030ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030bd:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8030c2:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8030c8:	89 fb                	mov    %edi,%ebx
+  8030ca:	29 f3                	sub    %esi,%ebx
+  8030cc:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8030d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030d5:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8030da:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8030df:	89 fa                	mov    %edi,%edx
+  8030e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8030e6:	e8 66 fb ff ff       	call   802c51 <nsipc_bulk>
+  8030eb:	85 c0                	test   %eax,%eax
+  8030ed:	78 28                	js     803117 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8030ef:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8030f2:	39 c3                	cmp    %eax,%ebx
+  8030f4:	75 0c                	jne    803102 <nsipc_sendmsg+0x235>
+  8030f6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8030f9:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8030fc:	0f 8f f2 fd ff ff    	jg     802ef4 <nsipc_sendmsg+0x27>
+		sent += r;
+  803102:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803105:	e9 2a fe ff ff       	jmp    802f34 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80310a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80310d:	85 db                	test   %ebx,%ebx
+  80310f:	0f 45 c3             	cmovne %ebx,%eax
+  803112:	e9 1d fe ff ff       	jmp    802f34 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803117:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80311a:	85 db                	test   %ebx,%ebx
+  80311c:	0f 45 c3             	cmovne %ebx,%eax
+  80311f:	e9 10 fe ff ff       	jmp    802f34 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803124:	83 ec 0c             	sub    $0xc,%esp
+  803127:	68 60 76 80 00       	push   $0x807660
+  80312c:	e8 aa 0d 00 00       	call   803edb <pgbatch_init>
+  803131:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803134:	be 00 00 00 00       	mov    $0x0,%esi
+  803139:	bf 00 00 00 00       	mov    $0x0,%edi
+  80313e:	e9 63 ff ff ff       	jmp    8030a6 <nsipc_sendmsg+0x1d9>
+
+00803143 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803143:	55                   	push   %ebp
+  803144:	89 e5                	mov    %esp,%ebp
+  803146:	57                   	push   %edi
+  803147:	56                   	push   %esi
+  803148:	53                   	push   %ebx
+  803149:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80314c:	83 3d 68 79 80 00 00 	cmpl   $0x0,0x807968
+  803153:	0f 84 c8 00 00 00    	je     803221 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803159:	83 3d 64 79 80 00 00 	cmpl   $0x0,0x807964
+  803160:	0f 84 e4 00 00 00    	je     80324a <nsipc_sendfile+0x107>
+{
+  803166:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80316b:	89 fb                	mov    %edi,%ebx
+  80316d:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  803170:	0f 83 f0 00 00 00    	jae    803266 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803176:	89 fa                	mov    %edi,%edx
+  803178:	03 55 10             	add    0x10(%ebp),%edx
+  80317b:	89 d0                	mov    %edx,%eax
+  80317d:	c1 f8 1f             	sar    $0x1f,%eax
+  803180:	c1 e8 14             	shr    $0x14,%eax
+  803183:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803186:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80318c:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80318e:	6a 10                	push   $0x10
+  803190:	68 00 20 01 e0       	push   $0xe0012000
+  803195:	52                   	push   %edx
+  803196:	ff 75 0c             	push   0xc(%ebp)
+  803199:	e8 fe eb ff ff       	call   801d9c <fmap>
+  80319e:	83 c4 10             	add    $0x10,%esp
+  8031a1:	85 c0                	test   %eax,%eax
+  8031a3:	0f 8e b8 00 00 00    	jle    803261 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8031a9:	39 c6                	cmp    %eax,%esi
+  8031ab:	0f 8d b5 00 00 00    	jge    803266 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8031b1:	29 f0                	sub    %esi,%eax
+  8031b3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8031b6:	29 da                	sub    %ebx,%edx
+  8031b8:	39 d0                	cmp    %edx,%eax
+  8031ba:	89 d3                	mov    %edx,%ebx
+  8031bc:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8031bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031c2:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8031c7:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8031cd:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8031d3:	8b 45 18             	mov    0x18(%ebp),%eax
+  8031d6:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8031db:	83 ec 0c             	sub    $0xc,%esp
+  8031de:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8031e0:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8031e7:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8031ea:	83 c0 01             	add    $0x1,%eax
+  8031ed:	50                   	push   %eax
+  8031ee:	68 00 10 01 e0       	push   $0xe0011000
+  8031f3:	6a 11                	push   $0x11
+  8031f5:	ff 35 64 79 80 00    	push   0x807964
+  8031fb:	e8 45 11 00 00       	call   804345 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803200:	83 c4 1c             	add    $0x1c,%esp
+  803203:	6a 00                	push   $0x0
+  803205:	6a 00                	push   $0x0
+  803207:	6a 00                	push   $0x0
+  803209:	e8 73 0e 00 00       	call   804081 <ipc_recv>
+  80320e:	83 c4 10             	add    $0x10,%esp
+  803211:	85 c0                	test   %eax,%eax
+  803213:	78 5b                	js     803270 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803215:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803217:	39 c3                	cmp    %eax,%ebx
+  803219:	0f 8e 4c ff ff ff    	jle    80316b <nsipc_sendfile+0x28>
+  80321f:	eb 45                	jmp    803266 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803221:	83 ec 04             	sub    $0x4,%esp
+  803224:	6a 07                	push   $0x7
+  803226:	68 00 10 01 e0       	push   $0xe0011000
+  80322b:	6a 00                	push   $0x0
+  80322d:	e8 89 de ff ff       	call   8010bb <sys_page_alloc>
+  803232:	89 c7                	mov    %eax,%edi
+  803234:	83 c4 10             	add    $0x10,%esp
+  803237:	85 c0                	test   %eax,%eax
+  803239:	78 2b                	js     803266 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80323b:	c7 05 68 79 80 00 01 	movl   $0x1,0x807968
+  803242:	00 00 00 
+  803245:	e9 0f ff ff ff       	jmp    803159 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80324a:	83 ec 0c             	sub    $0xc,%esp
+  80324d:	6a 03                	push   $0x3
+  80324f:	e8 26 11 00 00       	call   80437a <ipc_find_env>
+  803254:	a3 64 79 80 00       	mov    %eax,0x807964
+  803259:	83 c4 10             	add    $0x10,%esp
+  80325c:	e9 05 ff ff ff       	jmp    803166 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803261:	85 ff                	test   %edi,%edi
+  803263:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803266:	89 f8                	mov    %edi,%eax
+  803268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80326b:	5b                   	pop    %ebx
+  80326c:	5e                   	pop    %esi
+  80326d:	5f                   	pop    %edi
+  80326e:	5d                   	pop    %ebp
+  80326f:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803270:	85 ff                	test   %edi,%edi
+  803272:	0f 44 f8             	cmove  %eax,%edi
+  803275:	eb ef                	jmp    803266 <nsipc_sendfile+0x123>
+
+00803277 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803277:	55                   	push   %ebp
+  803278:	89 e5                	mov    %esp,%ebp
+  80327a:	57                   	push   %edi
+  80327b:	56                   	push   %esi
+  80327c:	53                   	push   %ebx
+  80327d:	83 ec 1c             	sub    $0x1c,%esp
+  803280:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803283:	e8 13 f9 ff ff       	call   802b9b <nsbulk_map>
+  803288:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80328b:	85 c0                	test   %eax,%eax
+  80328d:	0f 88 ba 00 00 00    	js     80334d <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803293:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803297:	0f 8e bb 00 00 00    	jle    803358 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80329d:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8032a2:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8032a7:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8032ac:	89 f8                	mov    %edi,%eax
+  8032ae:	29 f0                	sub    %esi,%eax
+  8032b0:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8032b4:	39 c8                	cmp    %ecx,%eax
+  8032b6:	0f 47 c1             	cmova  %ecx,%eax
+  8032b9:	01 f0                	add    %esi,%eax
+  8032bb:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8032bd:	83 c2 01             	add    $0x1,%edx
+  8032c0:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8032c3:	7e 07                	jle    8032cc <nsipc_recvmsg+0x55>
+  8032c5:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8032ca:	7e e0                	jle    8032ac <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8032cc:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8032d2:	c1 fa 0c             	sar    $0xc,%edx
+  8032d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032da:	e8 0a f9 ff ff       	call   802be9 <nsbulk_own>
+  8032df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032e2:	85 c0                	test   %eax,%eax
+  8032e4:	78 67                	js     80334d <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8032e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e9:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8032ee:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8032f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032f7:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8032fc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803301:	89 f2                	mov    %esi,%edx
+  803303:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803308:	e8 44 f9 ff ff       	call   802c51 <nsipc_bulk>
+  80330d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803310:	85 c0                	test   %eax,%eax
+  803312:	78 39                	js     80334d <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803314:	39 f0                	cmp    %esi,%eax
+  803316:	7f 4a                	jg     803362 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	7e 2c                	jle    80334d <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803321:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803324:	29 fe                	sub    %edi,%esi
+  803326:	8b 43 04             	mov    0x4(%ebx),%eax
+  803329:	39 c6                	cmp    %eax,%esi
+  80332b:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80332e:	83 ec 04             	sub    $0x4,%esp
+  803331:	56                   	push   %esi
+  803332:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803338:	50                   	push   %eax
+  803339:	ff 33                	push   (%ebx)
+  80333b:	e8 f7 da ff ff       	call   800e37 <memmove>
+		n += m;
+  803340:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803342:	83 c3 08             	add    $0x8,%ebx
+  803345:	83 c4 10             	add    $0x10,%esp
+  803348:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80334b:	7f d4                	jg     803321 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80334d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803350:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803353:	5b                   	pop    %ebx
+  803354:	5e                   	pop    %esi
+  803355:	5f                   	pop    %edi
+  803356:	5d                   	pop    %ebp
+  803357:	c3                   	ret
+	int r, i, n, len = 0;
+  803358:	be 00 00 00 00       	mov    $0x0,%esi
+  80335d:	e9 6a ff ff ff       	jmp    8032cc <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803362:	68 27 4c 80 00       	push   $0x804c27
+  803367:	68 62 4b 80 00       	push   $0x804b62
+  80336c:	68 3b 01 00 00       	push   $0x13b
+  803371:	68 30 4c 80 00       	push   $0x804c30
+  803376:	e8 3a d1 ff ff       	call   8004b5 <_panic>
+
+0080337b <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80337b:	55                   	push   %ebp
+  80337c:	89 e5                	mov    %esp,%ebp
+  80337e:	57                   	push   %edi
+  80337f:	56                   	push   %esi
+  803380:	53                   	push   %ebx
+  803381:	83 ec 0c             	sub    $0xc,%esp
+  803384:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803387:	8b 75 10             	mov    0x10(%ebp),%esi
+  80338a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80338d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803390:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.select.req_readset = *readset;
+  803395:	8b 07                	mov    (%edi),%eax
+  803397:	a3 04 b0 80 00       	mov    %eax,0x80b004
+  80339c:	8b 47 04             	mov    0x4(%edi),%eax
+  80339f:	a3 08 b0 80 00       	mov    %eax,0x80b008
+  8033a4:	8b 47 08             	mov    0x8(%edi),%eax
+  8033a7:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+  8033ac:	8b 47 0c             	mov    0xc(%edi),%eax
+  8033af:	a3 10 b0 80 00       	mov    %eax,0x80b010
+  8033b4:	8b 47 10             	mov    0x10(%edi),%eax
+  8033b7:	a3 14 b0 80 00       	mov    %eax,0x80b014
+  8033bc:	8b 47 14             	mov    0x14(%edi),%eax
+  8033bf:	a3 18 b0 80 00       	mov    %eax,0x80b018
+  8033c4:	8b 47 18             	mov    0x18(%edi),%eax
+  8033c7:	a3 1c b0 80 00       	mov    %eax,0x80b01c
+  8033cc:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8033cf:	a3 20 b0 80 00       	mov    %eax,0x80b020
+  8033d4:	8b 47 20             	mov    0x20(%edi),%eax
+  8033d7:	a3 24 b0 80 00       	mov    %eax,0x80b024
+  8033dc:	8b 47 24             	mov    0x24(%edi),%eax
+  8033df:	a3 28 b0 80 00       	mov    %eax,0x80b028
+  8033e4:	8b 47 28             	mov    0x28(%edi),%eax
+  8033e7:	a3 2c b0 80 00       	mov    %eax,0x80b02c
+  8033ec:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8033ef:	a3 30 b0 80 00       	mov    %eax,0x80b030
+  8033f4:	8b 47 30             	mov    0x30(%edi),%eax
+  8033f7:	a3 34 b0 80 00       	mov    %eax,0x80b034
+  8033fc:	8b 47 34             	mov    0x34(%edi),%eax
+  8033ff:	a3 38 b0 80 00       	mov    %eax,0x80b038
+  803404:	8b 47 38             	mov    0x38(%edi),%eax
+  803407:	a3 3c b0 80 00       	mov    %eax,0x80b03c
+  80340c:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80340f:	a3 40 b0 80 00       	mov    %eax,0x80b040
+	nsipcbuf.select.req_writeset = *writeset;
+  803414:	8b 06                	mov    (%esi),%eax
+  803416:	a3 44 b0 80 00       	mov    %eax,0x80b044
+  80341b:	8b 46 04             	mov    0x4(%esi),%eax
+  80341e:	a3 48 b0 80 00       	mov    %eax,0x80b048
+  803423:	8b 46 08             	mov    0x8(%esi),%eax
+  803426:	a3 4c b0 80 00       	mov    %eax,0x80b04c
+  80342b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80342e:	a3 50 b0 80 00       	mov    %eax,0x80b050
+  803433:	8b 46 10             	mov    0x10(%esi),%eax
+  803436:	a3 54 b0 80 00       	mov    %eax,0x80b054
+  80343b:	8b 46 14             	mov    0x14(%esi),%eax
+  80343e:	a3 58 b0 80 00       	mov    %eax,0x80b058
+  803443:	8b 46 18             	mov    0x18(%esi),%eax
+  803446:	a3 5c b0 80 00       	mov    %eax,0x80b05c
+  80344b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80344e:	a3 60 b0 80 00       	mov    %eax,0x80b060
+  803453:	8b 46 20             	mov    0x20(%esi),%eax
+  803456:	a3 64 b0 80 00       	mov    %eax,0x80b064
+  80345b:	8b 46 24             	mov    0x24(%esi),%eax
+  80345e:	a3 68 b0 80 00       	mov    %eax,0x80b068
+  803463:	8b 46 28             	mov    0x28(%esi),%eax
+  803466:	a3 6c b0 80 00       	mov    %eax,0x80b06c
+  80346b:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80346e:	a3 70 b0 80 00       	mov    %eax,0x80b070
+  803473:	8b 46 30             	mov    0x30(%esi),%eax
+  803476:	a3 74 b0 80 00       	mov    %eax,0x80b074
+  80347b:	8b 46 34             	mov    0x34(%esi),%eax
+  80347e:	a3 78 b0 80 00       	mov    %eax,0x80b078
+  803483:	8b 46 38             	mov    0x38(%esi),%eax
+  803486:	a3 7c b0 80 00       	mov    %eax,0x80b07c
+  80348b:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80348e:	a3 80 b0 80 00       	mov    %eax,0x80b080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803493:	8b 03                	mov    (%ebx),%eax
+  803495:	a3 84 b0 80 00       	mov    %eax,0x80b084
+  80349a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80349d:	a3 88 b0 80 00       	mov    %eax,0x80b088
+  8034a2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8034a5:	a3 8c b0 80 00       	mov    %eax,0x80b08c
+  8034aa:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8034ad:	a3 90 b0 80 00       	mov    %eax,0x80b090
+  8034b2:	8b 43 10             	mov    0x10(%ebx),%eax
+  8034b5:	a3 94 b0 80 00       	mov    %eax,0x80b094
+  8034ba:	8b 43 14             	mov    0x14(%ebx),%eax
+  8034bd:	a3 98 b0 80 00       	mov    %eax,0x80b098
+  8034c2:	8b 43 18             	mov    0x18(%ebx),%eax
+  8034c5:	a3 9c b0 80 00       	mov    %eax,0x80b09c
+  8034ca:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8034cd:	a3 a0 b0 80 00       	mov    %eax,0x80b0a0
+  8034d2:	8b 43 20             	mov    0x20(%ebx),%eax
+  8034d5:	a3 a4 b0 80 00       	mov    %eax,0x80b0a4
+  8034da:	8b 43 24             	mov    0x24(%ebx),%eax
+  8034dd:	a3 a8 b0 80 00       	mov    %eax,0x80b0a8
+  8034e2:	8b 43 28             	mov    0x28(%ebx),%eax
+  8034e5:	a3 ac b0 80 00       	mov    %eax,0x80b0ac
+  8034ea:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8034ed:	a3 b0 b0 80 00       	mov    %eax,0x80b0b0
+  8034f2:	8b 43 30             	mov    0x30(%ebx),%eax
+  8034f5:	a3 b4 b0 80 00       	mov    %eax,0x80b0b4
+  8034fa:	8b 43 34             	mov    0x34(%ebx),%eax
+  8034fd:	a3 b8 b0 80 00       	mov    %eax,0x80b0b8
+  803502:	8b 43 38             	mov    0x38(%ebx),%eax
+  803505:	a3 bc b0 80 00       	mov    %eax,0x80b0bc
+  80350a:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80350d:	a3 c0 b0 80 00       	mov    %eax,0x80b0c0
+	nsipcbuf.select.req_timeout = msec;
+  803512:	8b 45 18             	mov    0x18(%ebp),%eax
+  803515:	a3 c4 b0 80 00       	mov    %eax,0x80b0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80351a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80351f:	e8 2b f6 ff ff       	call   802b4f <nsipc>
+  803524:	85 c0                	test   %eax,%eax
+  803526:	0f 88 ad 01 00 00    	js     8036d9 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80352c:	8b 15 04 b0 80 00    	mov    0x80b004,%edx
+  803532:	89 17                	mov    %edx,(%edi)
+  803534:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  80353a:	89 57 04             	mov    %edx,0x4(%edi)
+  80353d:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  803543:	89 57 08             	mov    %edx,0x8(%edi)
+  803546:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  80354c:	89 57 0c             	mov    %edx,0xc(%edi)
+  80354f:	8b 15 14 b0 80 00    	mov    0x80b014,%edx
+  803555:	89 57 10             	mov    %edx,0x10(%edi)
+  803558:	8b 15 18 b0 80 00    	mov    0x80b018,%edx
+  80355e:	89 57 14             	mov    %edx,0x14(%edi)
+  803561:	8b 15 1c b0 80 00    	mov    0x80b01c,%edx
+  803567:	89 57 18             	mov    %edx,0x18(%edi)
+  80356a:	8b 15 20 b0 80 00    	mov    0x80b020,%edx
+  803570:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803573:	8b 15 24 b0 80 00    	mov    0x80b024,%edx
+  803579:	89 57 20             	mov    %edx,0x20(%edi)
+  80357c:	8b 15 28 b0 80 00    	mov    0x80b028,%edx
+  803582:	89 57 24             	mov    %edx,0x24(%edi)
+  803585:	8b 15 2c b0 80 00    	mov    0x80b02c,%edx
+  80358b:	89 57 28             	mov    %edx,0x28(%edi)
+  80358e:	8b 15 30 b0 80 00    	mov    0x80b030,%edx
+  803594:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803597:	8b 15 34 b0 80 00    	mov    0x80b034,%edx
+  80359d:	89 57 30             	mov    %edx,0x30(%edi)
+  8035a0:	8b 15 38 b0 80 00    	mov    0x80b038,%edx
+  8035a6:	89 57 34             	mov    %edx,0x34(%edi)
+  8035a9:	8b 15 3c b0 80 00    	mov    0x80b03c,%edx
+  8035af:	89 57 38             	mov    %edx,0x38(%edi)
+  8035b2:	8b 15 40 b0 80 00    	mov    0x80b040,%edx
+  8035b8:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8035bb:	8b 15 44 b0 80 00    	mov    0x80b044,%edx
+  8035c1:	89 16                	mov    %edx,(%esi)
+  8035c3:	8b 15 48 b0 80 00    	mov    0x80b048,%edx
+  8035c9:	89 56 04             	mov    %edx,0x4(%esi)
+  8035cc:	8b 15 4c b0 80 00    	mov    0x80b04c,%edx
+  8035d2:	89 56 08             	mov    %edx,0x8(%esi)
+  8035d5:	8b 15 50 b0 80 00    	mov    0x80b050,%edx
+  8035db:	89 56 0c             	mov    %edx,0xc(%esi)
+  8035de:	8b 15 54 b0 80 00    	mov    0x80b054,%edx
+  8035e4:	89 56 10             	mov    %edx,0x10(%esi)
+  8035e7:	8b 15 58 b0 80 00    	mov    0x80b058,%edx
+  8035ed:	89 56 14             	mov    %edx,0x14(%esi)
+  8035f0:	8b 15 5c b0 80 00    	mov    0x80b05c,%edx
+  8035f6:	89 56 18             	mov    %edx,0x18(%esi)
+  8035f9:	8b 15 60 b0 80 00    	mov    0x80b060,%edx
+  8035ff:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803602:	8b 15 64 b0 80 00    	mov    0x80b064,%edx
+  803608:	89 56 20             	mov    %edx,0x20(%esi)
+  80360b:	8b 15 68 b0 80 00    	mov    0x80b068,%edx
+  803611:	89 56 24             	mov    %edx,0x24(%esi)
+  803614:	8b 15 6c b0 80 00    	mov    0x80b06c,%edx
+  80361a:	89 56 28             	mov    %edx,0x28(%esi)
+  80361d:	8b 15 70 b0 80 00    	mov    0x80b070,%edx
+  803623:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803626:	8b 15 74 b0 80 00    	mov    0x80b074,%edx
+  80362c:	89 56 30             	mov    %edx,0x30(%esi)
+  80362f:	8b 15 78 b0 80 00    	mov    0x80b078,%edx
+  803635:	89 56 34             	mov    %edx,0x34(%esi)
+  803638:	8b 15 7c b0 80 00    	mov    0x80b07c,%edx
+  80363e:	89 56 38             	mov    %edx,0x38(%esi)
+  803641:	8b 15 80 b0 80 00    	mov    0x80b080,%edx
+  803647:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80364a:	8b 15 84 b0 80 00    	mov    0x80b084,%edx
+  803650:	89 13                	mov    %edx,(%ebx)
+  803652:	8b 15 88 b0 80 00    	mov    0x80b088,%edx
+  803658:	89 53 04             	mov    %edx,0x4(%ebx)
+  80365b:	8b 15 8c b0 80 00    	mov    0x80b08c,%edx
+  803661:	89 53 08             	mov    %edx,0x8(%ebx)
+  803664:	8b 15 90 b0 80 00    	mov    0x80b090,%edx
+  80366a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80366d:	8b 15 94 b0 80 00    	mov    0x80b094,%edx
+  803673:	89 53 10             	mov    %edx,0x10(%ebx)
+  803676:	8b 15 98 b0 80 00    	mov    0x80b098,%edx
+  80367c:	89 53 14             	mov    %edx,0x14(%ebx)
+  80367f:	8b 15 9c b0 80 00    	mov    0x80b09c,%edx
+  803685:	89 53 18             	mov    %edx,0x18(%ebx)
+  803688:	8b 15 a0 b0 80 00    	mov    0x80b0a0,%edx
+  80368e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803691:	8b 15 a4 b0 80 00    	mov    0x80b0a4,%edx
+  803697:	89 53 20             	mov    %edx,0x20(%ebx)
+  80369a:	8b 15 a8 b0 80 00    	mov    0x80b0a8,%edx
+  8036a0:	89 53 24             	mov    %edx,0x24(%ebx)
+  8036a3:	8b 15 ac b0 80 00    	mov    0x80b0ac,%edx
+  8036a9:	89 53 28             	mov    %edx,0x28(%ebx)
+  8036ac:	8b 15 b0 b0 80 00    	mov    0x80b0b0,%edx
+  8036b2:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8036b5:	8b 15 b4 b0 80 00    	mov    0x80b0b4,%edx
+  8036bb:	89 53 30             	mov    %edx,0x30(%ebx)
+  8036be:	8b 15 b8 b0 80 00    	mov    0x80b0b8,%edx
+  8036c4:	89 53 34             	mov    %edx,0x34(%ebx)
+  8036c7:	8b 15 bc b0 80 00    	mov    0x80b0bc,%edx
+  8036cd:	89 53 38             	mov    %edx,0x38(%ebx)
+  8036d0:	8b 15 c0 b0 80 00    	mov    0x80b0c0,%edx
+  8036d6:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8036d9:	83 c4 0c             	add    $0xc,%esp
+  8036dc:	5b                   	pop    %ebx
+  8036dd:	5e                   	pop    %esi
+  8036de:	5f                   	pop    %edi
+  8036df:	5d                   	pop    %ebp
+  8036e0:	c3                   	ret
+
+008036e1 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8036e1:	55                   	push   %ebp
+  8036e2:	89 e5                	mov    %esp,%ebp
+  8036e4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8036e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ea:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.evctl.req_events = events;
+  8036ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036f2:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.evctl.req_data = data;
+  8036f7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036fa:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_EVCTL);
+  8036ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803704:	e8 46 f4 ff ff       	call   802b4f <nsipc>
+}
+  803709:	c9                   	leave
+  80370a:	c3                   	ret
+
+0080370b <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80370b:	55                   	push   %ebp
+  80370c:	89 e5                	mov    %esp,%ebp
+  80370e:	56                   	push   %esi
+  80370f:	53                   	push   %ebx
+  803710:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803713:	89 35 00 b0 80 00    	mov    %esi,0x80b000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803719:	8b 45 10             	mov    0x10(%ebp),%eax
+  80371c:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803721:	b8 10 00 00 00       	mov    $0x10,%eax
+  803726:	e8 24 f4 ff ff       	call   802b4f <nsipc>
+  80372b:	89 c3                	mov    %eax,%ebx
+  80372d:	85 c0                	test   %eax,%eax
+  80372f:	7e 1f                	jle    803750 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803731:	39 c6                	cmp    %eax,%esi
+  803733:	7c 24                	jl     803759 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803735:	83 ec 04             	sub    $0x4,%esp
+  803738:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80373f:	50                   	push   %eax
+  803740:	68 00 b0 80 00       	push   $0x80b000
+  803745:	ff 75 08             	push   0x8(%ebp)
+  803748:	e8 ea d6 ff ff       	call   800e37 <memmove>
+  80374d:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803750:	89 d8                	mov    %ebx,%eax
+  803752:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803755:	5b                   	pop    %ebx
+  803756:	5e                   	pop    %esi
+  803757:	5d                   	pop    %ebp
+  803758:	c3                   	ret
+		assert(r <= max);
+  803759:	68 48 4c 80 00       	push   $0x804c48
+  80375e:	68 62 4b 80 00       	push   $0x804b62
+  803763:	68 6a 01 00 00       	push   $0x16a
+  803768:	68 30 4c 80 00       	push   $0x804c30
+  80376d:	e8 43 cd ff ff       	call   8004b5 <_panic>
+
+00803772 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803772:	55                   	push   %ebp
+  803773:	89 e5                	mov    %esp,%ebp
+  803775:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803778:	8b 45 08             	mov    0x8(%ebp),%eax
+  80377b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  803780:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803783:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  803788:	8b 45 10             	mov    0x10(%ebp),%eax
+  80378b:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  803790:	b8 09 00 00 00       	mov    $0x9,%eax
+  803795:	e8 b5 f3 ff ff       	call   802b4f <nsipc>
+}
+  80379a:	c9                   	leave
+  80379b:	c3                   	ret
+
+0080379c <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  80379c:	55                   	push   %ebp
+  80379d:	89 e5                	mov    %esp,%ebp
+  80379f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8037a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a5:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_OFFLOAD);
+  8037aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8037af:	e8 9b f3 ff ff       	call   802b4f <nsipc>
+}
+  8037b4:	c9                   	leave
+  8037b5:	c3                   	ret
+
+008037b6 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8037b6:	55                   	push   %ebp
+  8037b7:	89 e5                	mov    %esp,%ebp
+  8037b9:	53                   	push   %ebx
+  8037ba:	83 ec 04             	sub    $0x4,%esp
+  8037bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8037c0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8037c5:	e8 85 f3 ff ff       	call   802b4f <nsipc>
+  8037ca:	85 c0                	test   %eax,%eax
+  8037cc:	78 50                	js     80381e <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8037ce:	8b 15 00 b0 80 00    	mov    0x80b000,%edx
+  8037d4:	89 13                	mov    %edx,(%ebx)
+  8037d6:	8b 15 04 b0 80 00    	mov    0x80b004,%edx
+  8037dc:	89 53 04             	mov    %edx,0x4(%ebx)
+  8037df:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  8037e5:	89 53 08             	mov    %edx,0x8(%ebx)
+  8037e8:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8037ee:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8037f1:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  8037f7:	89 53 10             	mov    %edx,0x10(%ebx)
+  8037fa:	8b 15 14 b0 80 00    	mov    0x80b014,%edx
+  803800:	89 53 14             	mov    %edx,0x14(%ebx)
+  803803:	8b 15 18 b0 80 00    	mov    0x80b018,%edx
+  803809:	89 53 18             	mov    %edx,0x18(%ebx)
+  80380c:	8b 15 1c b0 80 00    	mov    0x80b01c,%edx
+  803812:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803815:	8b 15 20 b0 80 00    	mov    0x80b020,%edx
+  80381b:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80381e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803821:	c9                   	leave
+  803822:	c3                   	ret
+
+00803823 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803823:	55                   	push   %ebp
+  803824:	89 e5                	mov    %esp,%ebp
+  803826:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803829:	6a 03                	push   $0x3
+  80382b:	e8 4a 0b 00 00       	call   80437a <ipc_find_env>
+  803830:	a3 64 79 80 00       	mov    %eax,0x807964
+	nsipcbuf.shard.req_shard = shard;
+  803835:	8b 45 08             	mov    0x8(%ebp),%eax
+  803838:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80383d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803842:	e8 08 f3 ff ff       	call   802b4f <nsipc>
+  803847:	83 c4 10             	add    $0x10,%esp
+  80384a:	85 c0                	test   %eax,%eax
+  80384c:	78 0a                	js     803858 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80384e:	a3 64 79 80 00       	mov    %eax,0x807964
+	return 0;
+  803853:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803858:	c9                   	leave
+  803859:	c3                   	ret
+
+0080385a <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80385a:	55                   	push   %ebp
+  80385b:	89 e5                	mov    %esp,%ebp
+  80385d:	57                   	push   %edi
+  80385e:	56                   	push   %esi
+  80385f:	53                   	push   %ebx
+  803860:	83 ec 1c             	sub    $0x1c,%esp
+  803863:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803866:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803869:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80386e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803873:	89 e0                	mov    %esp,%eax
+  803875:	89 f2                	mov    %esi,%edx
+  803877:	29 c2                	sub    %eax,%edx
+  803879:	89 d0                	mov    %edx,%eax
+  80387b:	c1 e8 0f             	shr    $0xf,%eax
+  80387e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803884:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803887:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  80388e:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803891:	83 ec 0c             	sub    $0xc,%esp
+  803894:	ff 75 e0             	push   -0x20(%ebp)
+  803897:	e8 1d 0b 00 00       	call   8043b9 <pageref>
+  80389c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80389f:	83 c4 04             	add    $0x4,%esp
+  8038a2:	ff 75 dc             	push   -0x24(%ebp)
+  8038a5:	e8 0f 0b 00 00       	call   8043b9 <pageref>
+  8038aa:	89 e2                	mov    %esp,%edx
+  8038ac:	89 f1                	mov    %esi,%ecx
+  8038ae:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8038b0:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8038b3:	89 ca                	mov    %ecx,%edx
+  8038b5:	c1 ea 0f             	shr    $0xf,%edx
+  8038b8:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8038be:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8038c1:	8b 14 95 00 91 80 00 	mov    0x809100(,%edx,4),%edx
+  8038c8:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8038cb:	39 d7                	cmp    %edx,%edi
+  8038cd:	74 40                	je     80390f <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8038cf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8038d2:	75 9f                	jne    803873 <_pipeisclosed+0x19>
+  8038d4:	89 e2                	mov    %esp,%edx
+  8038d6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038db:	29 d0                	sub    %edx,%eax
+  8038dd:	89 c2                	mov    %eax,%edx
+  8038df:	c1 ea 0f             	shr    $0xf,%edx
+  8038e2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ec:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8038ef:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  8038f6:	8b 40 58             	mov    0x58(%eax),%eax
+  8038f9:	6a 01                	push   $0x1
+  8038fb:	50                   	push   %eax
+  8038fc:	57                   	push   %edi
+  8038fd:	68 51 4c 80 00       	push   $0x804c51
+  803902:	e8 89 cc ff ff       	call   800590 <cprintf>
+  803907:	83 c4 10             	add    $0x10,%esp
+  80390a:	e9 5f ff ff ff       	jmp    80386e <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80390f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803912:	0f 94 c0             	sete   %al
+  803915:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803918:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80391b:	5b                   	pop    %ebx
+  80391c:	5e                   	pop    %esi
+  80391d:	5f                   	pop    %edi
+  80391e:	5d                   	pop    %ebp
+  80391f:	c3                   	ret
+
+00803920 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803920:	55                   	push   %ebp
+  803921:	89 e5                	mov    %esp,%ebp
+  803923:	53                   	push   %ebx
+  803924:	83 ec 0c             	sub    $0xc,%esp
+  803927:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80392a:	53                   	push   %ebx
+  80392b:	6a 00                	push   $0x0
+  80392d:	e8 0e d8 ff ff       	call   801140 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803932:	89 1c 24             	mov    %ebx,(%esp)
+  803935:	e8 f4 db ff ff       	call   80152e <fd2data>
+  80393a:	83 c4 08             	add    $0x8,%esp
+  80393d:	50                   	push   %eax
+  80393e:	6a 00                	push   $0x0
+  803940:	e8 fb d7 ff ff       	call   801140 <sys_page_unmap>
+}
+  803945:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803948:	c9                   	leave
+  803949:	c3                   	ret
+
+0080394a <devpipe_read>:
+{
+  80394a:	55                   	push   %ebp
+  80394b:	89 e5                	mov    %esp,%ebp
+  80394d:	57                   	push   %edi
+  80394e:	56                   	push   %esi
+  80394f:	53                   	push   %ebx
+  803950:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803953:	ff 75 08             	push   0x8(%ebp)
+  803956:	e8 d3 db ff ff       	call   80152e <fd2data>
+  80395b:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80395d:	8b 70 04             	mov    0x4(%eax),%esi
+  803960:	8b 00                	mov    (%eax),%eax
+  803962:	83 c4 10             	add    $0x10,%esp
+  803965:	39 f0                	cmp    %esi,%eax
+  803967:	75 36                	jne    80399f <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803969:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80396c:	89 da                	mov    %ebx,%edx
+  80396e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803971:	e8 e4 fe ff ff       	call   80385a <_pipeisclosed>
+  803976:	85 c0                	test   %eax,%eax
+  803978:	0f 85 d4 00 00 00    	jne    803a52 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80397e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803983:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803987:	83 ec 04             	sub    $0x4,%esp
+  80398a:	6a ff                	push   $0xffffffff
+  80398c:	56                   	push   %esi
+  80398d:	57                   	push   %edi
+  80398e:	e8 26 db ff ff       	call   8014b9 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803993:	8b 73 04             	mov    0x4(%ebx),%esi
+  803996:	8b 03                	mov    (%ebx),%eax
+  803998:	83 c4 10             	add    $0x10,%esp
+  80399b:	39 c6                	cmp    %eax,%esi
+  80399d:	74 cd                	je     80396c <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80399f:	8b 73 04             	mov    0x4(%ebx),%esi
+  8039a2:	8b 03                	mov    (%ebx),%eax
+  8039a4:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8039aa:	29 c6                	sub    %eax,%esi
+  8039ac:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039b1:	f7 e6                	mul    %esi
+  8039b3:	c1 ea 0c             	shr    $0xc,%edx
+  8039b6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039bc:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8039be:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8039c1:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8039c5:	8b 0b                	mov    (%ebx),%ecx
+  8039c7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039cc:	f7 e1                	mul    %ecx
+  8039ce:	c1 ea 0b             	shr    $0xb,%edx
+  8039d1:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8039d7:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8039d9:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8039de:	29 cf                	sub    %ecx,%edi
+  8039e0:	39 f7                	cmp    %esi,%edi
+  8039e2:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8039e5:	83 ec 04             	sub    $0x4,%esp
+  8039e8:	57                   	push   %edi
+  8039e9:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8039ed:	50                   	push   %eax
+  8039ee:	ff 75 0c             	push   0xc(%ebp)
+  8039f1:	e8 41 d4 ff ff       	call   800e37 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8039f6:	83 c4 0c             	add    $0xc,%esp
+  8039f9:	89 f0                	mov    %esi,%eax
+  8039fb:	29 f8                	sub    %edi,%eax
+  8039fd:	50                   	push   %eax
+  8039fe:	8d 43 10             	lea    0x10(%ebx),%eax
+  803a01:	50                   	push   %eax
+  803a02:	89 f8                	mov    %edi,%eax
+  803a04:	03 45 0c             	add    0xc(%ebp),%eax
+  803a07:	50                   	push   %eax
+  803a08:	e8 2a d4 ff ff       	call   800e37 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803a0d:	8b 0b                	mov    (%ebx),%ecx
+  803a0f:	01 f1                	add    %esi,%ecx
+  803a11:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a16:	f7 e1                	mul    %ecx
+  803a18:	c1 ea 0c             	shr    $0xc,%edx
+  803a1b:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803a21:	29 c1                	sub    %eax,%ecx
+  803a23:	89 0b                	mov    %ecx,(%ebx)
+  803a25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2a:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803a2e:	83 c4 10             	add    $0x10,%esp
+  803a31:	85 c0                	test   %eax,%eax
+  803a33:	75 0a                	jne    803a3f <devpipe_read+0xf5>
+	return n;
+  803a35:	89 f0                	mov    %esi,%eax
+}
+  803a37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a3a:	5b                   	pop    %ebx
+  803a3b:	5e                   	pop    %esi
+  803a3c:	5f                   	pop    %edi
+  803a3d:	5d                   	pop    %ebp
+  803a3e:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803a3f:	83 ec 08             	sub    $0x8,%esp
+  803a42:	68 00 04 00 00       	push   $0x400
+  803a47:	53                   	push   %ebx
+  803a48:	e8 8e da ff ff       	call   8014db <sys_futex_wake>
+  803a4d:	83 c4 10             	add    $0x10,%esp
+  803a50:	eb e3                	jmp    803a35 <devpipe_read+0xeb>
+			return 0;
+  803a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a57:	eb de                	jmp    803a37 <devpipe_read+0xed>
+
+00803a59 <devpipe_write>:
+{
+  803a59:	55                   	push   %ebp
+  803a5a:	89 e5                	mov    %esp,%ebp
+  803a5c:	57                   	push   %edi
+  803a5d:	56                   	push   %esi
+  803a5e:	53                   	push   %ebx
+  803a5f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803a62:	ff 75 08             	push   0x8(%ebp)
+  803a65:	e8 c4 da ff ff       	call   80152e <fd2data>
+  803a6a:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803a6c:	83 c4 10             	add    $0x10,%esp
+  803a6f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a76:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803a7b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a7f:	0f 84 43 01 00 00    	je     803bc8 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a85:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a88:	8b 06                	mov    (%esi),%eax
+  803a8a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a90:	29 c1                	sub    %eax,%ecx
+  803a92:	89 c8                	mov    %ecx,%eax
+  803a94:	f7 e7                	mul    %edi
+  803a96:	c1 ea 0c             	shr    $0xc,%edx
+  803a99:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a9f:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803aa1:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803aa7:	75 52                	jne    803afb <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803aa9:	89 f2                	mov    %esi,%edx
+  803aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aae:	e8 a7 fd ff ff       	call   80385a <_pipeisclosed>
+  803ab3:	85 c0                	test   %eax,%eax
+  803ab5:	0f 85 28 01 00 00    	jne    803be3 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803abb:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803abd:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803ac0:	8b 06                	mov    (%esi),%eax
+  803ac2:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803ac8:	29 c1                	sub    %eax,%ecx
+  803aca:	89 c8                	mov    %ecx,%eax
+  803acc:	f7 e7                	mul    %edi
+  803ace:	c1 ea 0c             	shr    $0xc,%edx
+  803ad1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803ad7:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803ad9:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803adf:	75 a4                	jne    803a85 <devpipe_write+0x2c>
+  803ae1:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ae6:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803aea:	83 ec 04             	sub    $0x4,%esp
+  803aed:	6a ff                	push   $0xffffffff
+  803aef:	53                   	push   %ebx
+  803af0:	56                   	push   %esi
+  803af1:	e8 c3 d9 ff ff       	call   8014b9 <sys_futex_wait>
+}
+  803af6:	83 c4 10             	add    $0x10,%esp
+  803af9:	eb 8a                	jmp    803a85 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803afb:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803afe:	8b 06                	mov    (%esi),%eax
+  803b00:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b06:	29 c1                	sub    %eax,%ecx
+  803b08:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803b0d:	f7 e1                	mul    %ecx
+  803b0f:	c1 ea 0c             	shr    $0xc,%edx
+  803b12:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b18:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803b1a:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803b1f:	89 d8                	mov    %ebx,%eax
+  803b21:	29 c8                	sub    %ecx,%eax
+  803b23:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b26:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b29:	29 ca                	sub    %ecx,%edx
+  803b2b:	39 d0                	cmp    %edx,%eax
+  803b2d:	0f 46 d0             	cmovbe %eax,%edx
+  803b30:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803b33:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b36:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803b3b:	f7 e1                	mul    %ecx
+  803b3d:	c1 ea 0b             	shr    $0xb,%edx
+  803b40:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803b46:	89 ca                	mov    %ecx,%edx
+  803b48:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803b4a:	29 d3                	sub    %edx,%ebx
+  803b4c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803b4f:	39 c3                	cmp    %eax,%ebx
+  803b51:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803b54:	83 ec 04             	sub    $0x4,%esp
+  803b57:	53                   	push   %ebx
+  803b58:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b5b:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803b5e:	51                   	push   %ecx
+  803b5f:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803b63:	50                   	push   %eax
+  803b64:	e8 ce d2 ff ff       	call   800e37 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803b69:	83 c4 0c             	add    $0xc,%esp
+  803b6c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803b6f:	29 d8                	sub    %ebx,%eax
+  803b71:	50                   	push   %eax
+  803b72:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b75:	01 cb                	add    %ecx,%ebx
+  803b77:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803b7a:	53                   	push   %ebx
+  803b7b:	8d 46 10             	lea    0x10(%esi),%eax
+  803b7e:	50                   	push   %eax
+  803b7f:	e8 b3 d2 ff ff       	call   800e37 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803b84:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b87:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803b8a:	01 c1                	add    %eax,%ecx
+  803b8c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803b91:	f7 e1                	mul    %ecx
+  803b93:	c1 ea 0c             	shr    $0xc,%edx
+  803b96:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803b9c:	89 ca                	mov    %ecx,%edx
+  803b9e:	29 c2                	sub    %eax,%edx
+  803ba0:	89 56 04             	mov    %edx,0x4(%esi)
+  803ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba8:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803bac:	83 c4 10             	add    $0x10,%esp
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	75 1a                	jne    803bcd <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803bb3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803bb6:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803bb9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803bbc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803bbf:	0f 82 c0 fe ff ff    	jb     803a85 <devpipe_write+0x2c>
+  803bc5:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803bc8:	8b 45 10             	mov    0x10(%ebp),%eax
+  803bcb:	eb 1b                	jmp    803be8 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803bcd:	83 ec 08             	sub    $0x8,%esp
+  803bd0:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803bd5:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803bd8:	50                   	push   %eax
+  803bd9:	e8 fd d8 ff ff       	call   8014db <sys_futex_wake>
+  803bde:	83 c4 10             	add    $0x10,%esp
+  803be1:	eb d0                	jmp    803bb3 <devpipe_write+0x15a>
+				return 0;
+  803be3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803beb:	5b                   	pop    %ebx
+  803bec:	5e                   	pop    %esi
+  803bed:	5f                   	pop    %edi
+  803bee:	5d                   	pop    %ebp
+  803bef:	c3                   	ret
+
+00803bf0 <devpipe_stat>:
+{
+  803bf0:	55                   	push   %ebp
+  803bf1:	89 e5                	mov    %esp,%ebp
+  803bf3:	56                   	push   %esi
+  803bf4:	53                   	push   %ebx
+  803bf5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803bf8:	83 ec 0c             	sub    $0xc,%esp
+  803bfb:	ff 75 08             	push   0x8(%ebp)
+  803bfe:	e8 2b d9 ff ff       	call   80152e <fd2data>
+  803c03:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803c05:	83 c4 08             	add    $0x8,%esp
+  803c08:	68 64 4c 80 00       	push   $0x804c64
+  803c0d:	53                   	push   %ebx
+  803c0e:	e8 74 d0 ff ff       	call   800c87 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803c13:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803c16:	8b 06                	mov    (%esi),%eax
+  803c18:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803c1e:	29 c1                	sub    %eax,%ecx
+  803c20:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803c25:	89 c8                	mov    %ecx,%eax
+  803c27:	f7 e2                	mul    %edx
+  803c29:	c1 ea 0c             	shr    $0xc,%edx
+  803c2c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803c32:	29 d1                	sub    %edx,%ecx
+  803c34:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803c3a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803c41:	00 00 00 
+	stat->st_dev = &devpipe;
+  803c44:	c7 83 8c 00 00 00 00 	movl   $0x806800,0x8c(%ebx)
+  803c4b:	68 80 00 
+}
+  803c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c56:	5b                   	pop    %ebx
+  803c57:	5e                   	pop    %esi
+  803c58:	5d                   	pop    %ebp
+  803c59:	c3                   	ret
+
+00803c5a <devpipe_poll>:
+{
+  803c5a:	55                   	push   %ebp
+  803c5b:	89 e5                	mov    %esp,%ebp
+  803c5d:	57                   	push   %edi
+  803c5e:	56                   	push   %esi
+  803c5f:	53                   	push   %ebx
+  803c60:	83 ec 18             	sub    $0x18,%esp
+  803c63:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c66:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803c69:	57                   	push   %edi
+  803c6a:	e8 bf d8 ff ff       	call   80152e <fd2data>
+  803c6f:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803c71:	83 c4 10             	add    $0x10,%esp
+  803c74:	89 f3                	mov    %esi,%ebx
+  803c76:	83 e3 01             	and    $0x1,%ebx
+  803c79:	75 27                	jne    803ca2 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803c7b:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803c81:	75 48                	jne    803ccb <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803c83:	89 ca                	mov    %ecx,%edx
+  803c85:	89 f8                	mov    %edi,%eax
+  803c87:	e8 ce fb ff ff       	call   80385a <_pipeisclosed>
+  803c8c:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803c8e:	89 d8                	mov    %ebx,%eax
+  803c90:	83 c8 10             	or     $0x10,%eax
+  803c93:	85 d2                	test   %edx,%edx
+  803c95:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803c98:	89 d8                	mov    %ebx,%eax
+  803c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c9d:	5b                   	pop    %ebx
+  803c9e:	5e                   	pop    %esi
+  803c9f:	5f                   	pop    %edi
+  803ca0:	5d                   	pop    %ebp
+  803ca1:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ca2:	8b 58 04             	mov    0x4(%eax),%ebx
+  803ca5:	8b 00                	mov    (%eax),%eax
+  803ca7:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803cad:	29 c3                	sub    %eax,%ebx
+  803caf:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803cb4:	89 d8                	mov    %ebx,%eax
+  803cb6:	f7 e2                	mul    %edx
+  803cb8:	c1 ea 0c             	shr    $0xc,%edx
+  803cbb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803cc1:	39 d3                	cmp    %edx,%ebx
+  803cc3:	0f 95 c3             	setne  %bl
+  803cc6:	0f b6 db             	movzbl %bl,%ebx
+  803cc9:	eb b0                	jmp    803c7b <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ccb:	8b 71 04             	mov    0x4(%ecx),%esi
+  803cce:	8b 01                	mov    (%ecx),%eax
+  803cd0:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803cd6:	29 c6                	sub    %eax,%esi
+  803cd8:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803cdd:	89 f0                	mov    %esi,%eax
+  803cdf:	f7 e2                	mul    %edx
+  803ce1:	c1 ea 0c             	shr    $0xc,%edx
+  803ce4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803cea:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803cec:	89 d8                	mov    %ebx,%eax
+  803cee:	83 c8 04             	or     $0x4,%eax
+  803cf1:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803cf7:	0f 42 d8             	cmovb  %eax,%ebx
+  803cfa:	eb 87                	jmp    803c83 <devpipe_poll+0x29>
+
+00803cfc <pipe>:
+{
+  803cfc:	55                   	push   %ebp
+  803cfd:	89 e5                	mov    %esp,%ebp
+  803cff:	56                   	push   %esi
+  803d00:	53                   	push   %ebx
+  803d01:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803d04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d07:	50                   	push   %eax
+  803d08:	e8 38 d8 ff ff       	call   801545 <fd_alloc>
+  803d0d:	89 c3                	mov    %eax,%ebx
+  803d0f:	83 c4 10             	add    $0x10,%esp
+  803d12:	85 c0                	test   %eax,%eax
+  803d14:	0f 88 23 01 00 00    	js     803e3d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d1a:	83 ec 04             	sub    $0x4,%esp
+  803d1d:	68 07 04 00 00       	push   $0x407
+  803d22:	ff 75 f4             	push   -0xc(%ebp)
+  803d25:	6a 00                	push   $0x0
+  803d27:	e8 8f d3 ff ff       	call   8010bb <sys_page_alloc>
+  803d2c:	89 c3                	mov    %eax,%ebx
+  803d2e:	83 c4 10             	add    $0x10,%esp
+  803d31:	85 c0                	test   %eax,%eax
+  803d33:	0f 88 04 01 00 00    	js     803e3d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803d39:	83 ec 0c             	sub    $0xc,%esp
+  803d3c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803d3f:	50                   	push   %eax
+  803d40:	e8 00 d8 ff ff       	call   801545 <fd_alloc>
+  803d45:	89 c3                	mov    %eax,%ebx
+  803d47:	83 c4 10             	add    $0x10,%esp
+  803d4a:	85 c0                	test   %eax,%eax
+  803d4c:	0f 88 db 00 00 00    	js     803e2d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d52:	83 ec 04             	sub    $0x4,%esp
+  803d55:	68 07 04 00 00       	push   $0x407
+  803d5a:	ff 75 f0             	push   -0x10(%ebp)
+  803d5d:	6a 00                	push   $0x0
+  803d5f:	e8 57 d3 ff ff       	call   8010bb <sys_page_alloc>
+  803d64:	89 c3                	mov    %eax,%ebx
+  803d66:	83 c4 10             	add    $0x10,%esp
+  803d69:	85 c0                	test   %eax,%eax
+  803d6b:	0f 88 bc 00 00 00    	js     803e2d <pipe+0x131>
+	va = fd2data(fd0);
+  803d71:	83 ec 0c             	sub    $0xc,%esp
+  803d74:	ff 75 f4             	push   -0xc(%ebp)
+  803d77:	e8 b2 d7 ff ff       	call   80152e <fd2data>
+  803d7c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d7e:	83 c4 0c             	add    $0xc,%esp
+  803d81:	68 07 04 00 00       	push   $0x407
+  803d86:	50                   	push   %eax
+  803d87:	6a 00                	push   $0x0
+  803d89:	e8 2d d3 ff ff       	call   8010bb <sys_page_alloc>
+  803d8e:	89 c3                	mov    %eax,%ebx
+  803d90:	83 c4 10             	add    $0x10,%esp
+  803d93:	85 c0                	test   %eax,%eax
+  803d95:	0f 88 82 00 00 00    	js     803e1d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d9b:	83 ec 0c             	sub    $0xc,%esp
+  803d9e:	ff 75 f0             	push   -0x10(%ebp)
+  803da1:	e8 88 d7 ff ff       	call   80152e <fd2data>
+  803da6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803dad:	50                   	push   %eax
+  803dae:	6a 00                	push   $0x0
+  803db0:	56                   	push   %esi
+  803db1:	6a 00                	push   $0x0
+  803db3:	e8 46 d3 ff ff       	call   8010fe <sys_page_map>
+  803db8:	89 c3                	mov    %eax,%ebx
+  803dba:	83 c4 20             	add    $0x20,%esp
+  803dbd:	85 c0                	test   %eax,%eax
+  803dbf:	78 4e                	js     803e0f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803dc1:	a1 00 68 80 00       	mov    0x806800,%eax
+  803dc6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803dc9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803dcb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803dce:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803dd5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803dd8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803dda:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803ddd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803de4:	83 ec 0c             	sub    $0xc,%esp
+  803de7:	ff 75 f4             	push   -0xc(%ebp)
+  803dea:	e8 2f d7 ff ff       	call   80151e <fd2num>
+  803def:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803df2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803df4:	83 c4 04             	add    $0x4,%esp
+  803df7:	ff 75 f0             	push   -0x10(%ebp)
+  803dfa:	e8 1f d7 ff ff       	call   80151e <fd2num>
+  803dff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803e02:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803e05:	83 c4 10             	add    $0x10,%esp
+  803e08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e0d:	eb 2e                	jmp    803e3d <pipe+0x141>
+	sys_page_unmap(0, va);
+  803e0f:	83 ec 08             	sub    $0x8,%esp
+  803e12:	56                   	push   %esi
+  803e13:	6a 00                	push   $0x0
+  803e15:	e8 26 d3 ff ff       	call   801140 <sys_page_unmap>
+  803e1a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803e1d:	83 ec 08             	sub    $0x8,%esp
+  803e20:	ff 75 f0             	push   -0x10(%ebp)
+  803e23:	6a 00                	push   $0x0
+  803e25:	e8 16 d3 ff ff       	call   801140 <sys_page_unmap>
+  803e2a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803e2d:	83 ec 08             	sub    $0x8,%esp
+  803e30:	ff 75 f4             	push   -0xc(%ebp)
+  803e33:	6a 00                	push   $0x0
+  803e35:	e8 06 d3 ff ff       	call   801140 <sys_page_unmap>
+  803e3a:	83 c4 10             	add    $0x10,%esp
+}
+  803e3d:	89 d8                	mov    %ebx,%eax
+  803e3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e42:	5b                   	pop    %ebx
+  803e43:	5e                   	pop    %esi
+  803e44:	5d                   	pop    %ebp
+  803e45:	c3                   	ret
+
+00803e46 <pipeisclosed>:
+{
+  803e46:	55                   	push   %ebp
+  803e47:	89 e5                	mov    %esp,%ebp
+  803e49:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e4f:	50                   	push   %eax
+  803e50:	ff 75 08             	push   0x8(%ebp)
+  803e53:	e8 3d d7 ff ff       	call   801595 <fd_lookup>
+  803e58:	83 c4 10             	add    $0x10,%esp
+  803e5b:	85 c0                	test   %eax,%eax
+  803e5d:	78 18                	js     803e77 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803e5f:	83 ec 0c             	sub    $0xc,%esp
+  803e62:	ff 75 f4             	push   -0xc(%ebp)
+  803e65:	e8 c4 d6 ff ff       	call   80152e <fd2data>
+  803e6a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803e6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e6f:	e8 e6 f9 ff ff       	call   80385a <_pipeisclosed>
+  803e74:	83 c4 10             	add    $0x10,%esp
+}
+  803e77:	c9                   	leave
+  803e78:	c3                   	ret
+
+00803e79 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803e79:	55                   	push   %ebp
+  803e7a:	89 e5                	mov    %esp,%ebp
+  803e7c:	56                   	push   %esi
+  803e7d:	53                   	push   %ebx
+  803e7e:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803e81:	85 f6                	test   %esi,%esi
+  803e83:	74 40                	je     803ec5 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803e85:	89 f3                	mov    %esi,%ebx
+  803e87:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803e8d:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803e93:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e98:	8b 40 48             	mov    0x48(%eax),%eax
+  803e9b:	39 c6                	cmp    %eax,%esi
+  803e9d:	75 1f                	jne    803ebe <wait+0x45>
+  803e9f:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803ea5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803eab:	8b 43 54             	mov    0x54(%ebx),%eax
+  803eae:	85 c0                	test   %eax,%eax
+  803eb0:	74 0c                	je     803ebe <wait+0x45>
+		sys_yield();
+  803eb2:	e8 e5 d1 ff ff       	call   80109c <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803eb7:	8b 43 48             	mov    0x48(%ebx),%eax
+  803eba:	39 f0                	cmp    %esi,%eax
+  803ebc:	74 ed                	je     803eab <wait+0x32>
+}
+  803ebe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ec1:	5b                   	pop    %ebx
+  803ec2:	5e                   	pop    %esi
+  803ec3:	5d                   	pop    %ebp
+  803ec4:	c3                   	ret
+	assert(envid != 0);
+  803ec5:	68 70 4c 80 00       	push   $0x804c70
+  803eca:	68 62 4b 80 00       	push   $0x804b62
+  803ecf:	6a 09                	push   $0x9
+  803ed1:	68 7b 4c 80 00       	push   $0x804c7b
+  803ed6:	e8 da c5 ff ff       	call   8004b5 <_panic>
+
+00803edb <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803edb:	55                   	push   %ebp
+  803edc:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ee1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ee7:	5d                   	pop    %ebp
+  803ee8:	c3                   	ret
+
+00803ee9 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803ee9:	55                   	push   %ebp
+  803eea:	89 e5                	mov    %esp,%ebp
+  803eec:	53                   	push   %ebx
+  803eed:	83 ec 04             	sub    $0x4,%esp
+  803ef0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803ef3:	8b 03                	mov    (%ebx),%eax
+  803ef5:	85 c0                	test   %eax,%eax
+  803ef7:	75 05                	jne    803efe <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803ef9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803efc:	c9                   	leave
+  803efd:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803efe:	83 ec 08             	sub    $0x8,%esp
+  803f01:	50                   	push   %eax
+  803f02:	8d 43 04             	lea    0x4(%ebx),%eax
+  803f05:	50                   	push   %eax
+  803f06:	e8 85 d4 ff ff       	call   801390 <sys_page_batch>
+	pb->pb_n = 0;
+  803f0b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803f11:	83 c4 10             	add    $0x10,%esp
+  803f14:	eb e3                	jmp    803ef9 <pgbatch_flush+0x10>
+
+00803f16 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803f16:	55                   	push   %ebp
+  803f17:	89 e5                	mov    %esp,%ebp
+  803f19:	56                   	push   %esi
+  803f1a:	53                   	push   %ebx
+  803f1b:	89 c3                	mov    %eax,%ebx
+  803f1d:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803f1f:	83 38 20             	cmpl   $0x20,(%eax)
+  803f22:	74 2c                	je     803f50 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803f24:	8b 03                	mov    (%ebx),%eax
+  803f26:	8d 50 01             	lea    0x1(%eax),%edx
+  803f29:	89 13                	mov    %edx,(%ebx)
+  803f2b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803f2e:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803f32:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803f34:	83 ec 04             	sub    $0x4,%esp
+  803f37:	6a 18                	push   $0x18
+  803f39:	6a 00                	push   $0x0
+  803f3b:	50                   	push   %eax
+  803f3c:	e8 c1 ce ff ff       	call   800e02 <memset>
+	return 0;
+  803f41:	83 c4 10             	add    $0x10,%esp
+  803f44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f4c:	5b                   	pop    %ebx
+  803f4d:	5e                   	pop    %esi
+  803f4e:	5d                   	pop    %ebp
+  803f4f:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803f50:	83 ec 0c             	sub    $0xc,%esp
+  803f53:	50                   	push   %eax
+  803f54:	e8 90 ff ff ff       	call   803ee9 <pgbatch_flush>
+  803f59:	83 c4 10             	add    $0x10,%esp
+  803f5c:	85 c0                	test   %eax,%eax
+  803f5e:	79 c4                	jns    803f24 <pgbatch_slot+0xe>
+  803f60:	eb e7                	jmp    803f49 <pgbatch_slot+0x33>
+
+00803f62 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803f62:	55                   	push   %ebp
+  803f63:	89 e5                	mov    %esp,%ebp
+  803f65:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f68:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f6e:	e8 a3 ff ff ff       	call   803f16 <pgbatch_slot>
+  803f73:	85 c0                	test   %eax,%eax
+  803f75:	78 20                	js     803f97 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803f77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f7a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803f80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f83:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f86:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f89:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803f8c:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f8f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f97:	c9                   	leave
+  803f98:	c3                   	ret
+
+00803f99 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803f99:	55                   	push   %ebp
+  803f9a:	89 e5                	mov    %esp,%ebp
+  803f9c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f9f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803fa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fa5:	e8 6c ff ff ff       	call   803f16 <pgbatch_slot>
+  803faa:	85 c0                	test   %eax,%eax
+  803fac:	78 2c                	js     803fda <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803fae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fb1:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803fb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fba:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803fbd:	8b 55 10             	mov    0x10(%ebp),%edx
+  803fc0:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803fc3:	8b 55 14             	mov    0x14(%ebp),%edx
+  803fc6:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803fc9:	8b 55 18             	mov    0x18(%ebp),%edx
+  803fcc:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803fcf:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803fd2:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fda:	c9                   	leave
+  803fdb:	c3                   	ret
+
+00803fdc <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803fdc:	55                   	push   %ebp
+  803fdd:	89 e5                	mov    %esp,%ebp
+  803fdf:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803fe2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803fe5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fe8:	e8 29 ff ff ff       	call   803f16 <pgbatch_slot>
+  803fed:	85 c0                	test   %eax,%eax
+  803fef:	78 1a                	js     80400b <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803ff1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ff4:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803ffa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ffd:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804000:	8b 55 10             	mov    0x10(%ebp),%edx
+  804003:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  804006:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80400b:	c9                   	leave
+  80400c:	c3                   	ret
+
+0080400d <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80400d:	55                   	push   %ebp
+  80400e:	89 e5                	mov    %esp,%ebp
+  804010:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804013:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804016:	8b 45 08             	mov    0x8(%ebp),%eax
+  804019:	e8 f8 fe ff ff       	call   803f16 <pgbatch_slot>
+  80401e:	85 c0                	test   %eax,%eax
+  804020:	78 20                	js     804042 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  804022:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804025:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80402b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80402e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804031:	8b 55 10             	mov    0x10(%ebp),%edx
+  804034:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804037:	8b 55 14             	mov    0x14(%ebp),%edx
+  80403a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80403d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804042:	c9                   	leave
+  804043:	c3                   	ret
+
+00804044 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  804044:	55                   	push   %ebp
+  804045:	89 e5                	mov    %esp,%ebp
+  804047:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80404a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80404d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804050:	e8 c1 fe ff ff       	call   803f16 <pgbatch_slot>
+  804055:	85 c0                	test   %eax,%eax
+  804057:	78 26                	js     80407f <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  804059:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80405c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  804062:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804065:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  804068:	8b 55 10             	mov    0x10(%ebp),%edx
+  80406b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80406e:	8b 55 14             	mov    0x14(%ebp),%edx
+  804071:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  804074:	8b 55 18             	mov    0x18(%ebp),%edx
+  804077:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80407a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80407f:	c9                   	leave
+  804080:	c3                   	ret
+
+00804081 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804081:	55                   	push   %ebp
+  804082:	89 e5                	mov    %esp,%ebp
+  804084:	56                   	push   %esi
+  804085:	53                   	push   %ebx
+  804086:	8b 75 08             	mov    0x8(%ebp),%esi
+  804089:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80408c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80408f:	85 c0                	test   %eax,%eax
+  804091:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804096:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804099:	83 ec 0c             	sub    $0xc,%esp
+  80409c:	50                   	push   %eax
+  80409d:	e8 c9 d1 ff ff       	call   80126b <sys_ipc_recv>
+  8040a2:	83 c4 10             	add    $0x10,%esp
+  8040a5:	85 c0                	test   %eax,%eax
+  8040a7:	0f 88 8b 00 00 00    	js     804138 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8040ad:	85 f6                	test   %esi,%esi
+  8040af:	74 2a                	je     8040db <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8040b1:	89 e2                	mov    %esp,%edx
+  8040b3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040b8:	29 d0                	sub    %edx,%eax
+  8040ba:	89 c2                	mov    %eax,%edx
+  8040bc:	c1 ea 0f             	shr    $0xf,%edx
+  8040bf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c9:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8040cc:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  8040d3:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8040d9:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8040db:	85 db                	test   %ebx,%ebx
+  8040dd:	74 2a                	je     804109 <ipc_recv+0x88>
+  8040df:	89 e2                	mov    %esp,%edx
+  8040e1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040e6:	29 d0                	sub    %edx,%eax
+  8040e8:	89 c2                	mov    %eax,%edx
+  8040ea:	c1 ea 0f             	shr    $0xf,%edx
+  8040ed:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f7:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8040fa:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  804101:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804107:	89 03                	mov    %eax,(%ebx)
+  804109:	89 e2                	mov    %esp,%edx
+  80410b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804110:	29 d0                	sub    %edx,%eax
+  804112:	89 c2                	mov    %eax,%edx
+  804114:	c1 ea 0f             	shr    $0xf,%edx
+  804117:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80411c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804121:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804124:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  80412b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804131:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804134:	5b                   	pop    %ebx
+  804135:	5e                   	pop    %esi
+  804136:	5d                   	pop    %ebp
+  804137:	c3                   	ret
+		if(from_env_store != NULL)
+  804138:	85 f6                	test   %esi,%esi
+  80413a:	74 06                	je     804142 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80413c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804142:	85 db                	test   %ebx,%ebx
+  804144:	74 eb                	je     804131 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804146:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80414c:	eb e3                	jmp    804131 <ipc_recv+0xb0>
+
+0080414e <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80414e:	55                   	push   %ebp
+  80414f:	89 e5                	mov    %esp,%ebp
+  804151:	57                   	push   %edi
+  804152:	56                   	push   %esi
+  804153:	53                   	push   %ebx
+  804154:	83 ec 14             	sub    $0x14,%esp
+  804157:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80415a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80415d:	8b 75 14             	mov    0x14(%ebp),%esi
+  804160:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804163:	85 c0                	test   %eax,%eax
+  804165:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80416a:	0f 44 c2             	cmove  %edx,%eax
+  80416d:	ff 75 10             	push   0x10(%ebp)
+  804170:	50                   	push   %eax
+  804171:	e8 57 d1 ff ff       	call   8012cd <sys_ipc_recv_pages>
+  804176:	83 c4 10             	add    $0x10,%esp
+  804179:	85 c0                	test   %eax,%eax
+  80417b:	0f 88 ba 00 00 00    	js     80423b <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804181:	85 ff                	test   %edi,%edi
+  804183:	74 2a                	je     8041af <ipc_recv_pages+0x61>
+  804185:	89 e2                	mov    %esp,%edx
+  804187:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80418c:	29 d0                	sub    %edx,%eax
+  80418e:	89 c2                	mov    %eax,%edx
+  804190:	c1 ea 0f             	shr    $0xf,%edx
+  804193:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419d:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8041a0:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  8041a7:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8041ad:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8041af:	85 f6                	test   %esi,%esi
+  8041b1:	74 2a                	je     8041dd <ipc_recv_pages+0x8f>
+  8041b3:	89 e2                	mov    %esp,%edx
+  8041b5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8041ba:	29 d0                	sub    %edx,%eax
+  8041bc:	89 c2                	mov    %eax,%edx
+  8041be:	c1 ea 0f             	shr    $0xf,%edx
+  8041c1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8041c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041cb:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8041ce:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  8041d5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8041db:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8041dd:	85 db                	test   %ebx,%ebx
+  8041df:	74 2a                	je     80420b <ipc_recv_pages+0xbd>
+  8041e1:	89 e2                	mov    %esp,%edx
+  8041e3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8041e8:	29 d0                	sub    %edx,%eax
+  8041ea:	89 c2                	mov    %eax,%edx
+  8041ec:	c1 ea 0f             	shr    $0xf,%edx
+  8041ef:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8041f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f9:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8041fc:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  804203:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804209:	89 03                	mov    %eax,(%ebx)
+  80420b:	89 e2                	mov    %esp,%edx
+  80420d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804212:	29 d0                	sub    %edx,%eax
+  804214:	89 c2                	mov    %eax,%edx
+  804216:	c1 ea 0f             	shr    $0xf,%edx
+  804219:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80421e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804223:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804226:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  80422d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804233:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804236:	5b                   	pop    %ebx
+  804237:	5e                   	pop    %esi
+  804238:	5f                   	pop    %edi
+  804239:	5d                   	pop    %ebp
+  80423a:	c3                   	ret
+		if (from_env_store)
+  80423b:	85 ff                	test   %edi,%edi
+  80423d:	74 06                	je     804245 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80423f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804245:	85 f6                	test   %esi,%esi
+  804247:	74 06                	je     80424f <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804249:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80424f:	85 db                	test   %ebx,%ebx
+  804251:	74 e0                	je     804233 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804253:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804259:	eb d8                	jmp    804233 <ipc_recv_pages+0xe5>
+
+0080425b <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80425b:	55                   	push   %ebp
+  80425c:	89 e5                	mov    %esp,%ebp
+  80425e:	57                   	push   %edi
+  80425f:	56                   	push   %esi
+  804260:	53                   	push   %ebx
+  804261:	83 ec 1c             	sub    $0x1c,%esp
+  804264:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804267:	8b 75 08             	mov    0x8(%ebp),%esi
+  80426a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804270:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804274:	75 2b                	jne    8042a1 <ipc_try_send_pages+0x46>
+  804276:	89 e2                	mov    %esp,%edx
+  804278:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80427d:	29 d0                	sub    %edx,%eax
+  80427f:	89 c2                	mov    %eax,%edx
+  804281:	c1 ea 0f             	shr    $0xf,%edx
+  804284:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428e:	0f 42 c2             	cmovb  %edx,%eax
+  804291:	8b 04 85 00 91 80 00 	mov    0x809100(,%eax,4),%eax
+  804298:	8b 70 48             	mov    0x48(%eax),%esi
+  80429b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8042a1:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8042a7:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8042ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042af:	85 ff                	test   %edi,%edi
+  8042b1:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8042b6:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8042b9:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8042bf:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8042c5:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8042cb:	83 ec 0c             	sub    $0xc,%esp
+  8042ce:	ff 75 14             	push   0x14(%ebp)
+  8042d1:	ff 75 18             	push   0x18(%ebp)
+  8042d4:	57                   	push   %edi
+  8042d5:	ff 75 0c             	push   0xc(%ebp)
+  8042d8:	ff 75 08             	push   0x8(%ebp)
+  8042db:	e8 cc cf ff ff       	call   8012ac <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8042e0:	83 c4 20             	add    $0x20,%esp
+  8042e3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8042e6:	75 21                	jne    804309 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8042e8:	83 ec 04             	sub    $0x4,%esp
+  8042eb:	6a ff                	push   $0xffffffff
+  8042ed:	53                   	push   %ebx
+  8042ee:	ff 75 e4             	push   -0x1c(%ebp)
+  8042f1:	e8 c3 d1 ff ff       	call   8014b9 <sys_futex_wait>
+  8042f6:	83 c4 10             	add    $0x10,%esp
+  8042f9:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8042fc:	74 c7                	je     8042c5 <ipc_try_send_pages+0x6a>
+  8042fe:	85 c0                	test   %eax,%eax
+  804300:	79 c3                	jns    8042c5 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804302:	e8 95 cd ff ff       	call   80109c <sys_yield>
+  804307:	eb bc                	jmp    8042c5 <ipc_try_send_pages+0x6a>
+	}
+}
+  804309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80430c:	5b                   	pop    %ebx
+  80430d:	5e                   	pop    %esi
+  80430e:	5f                   	pop    %edi
+  80430f:	5d                   	pop    %ebp
+  804310:	c3                   	ret
+
+00804311 <ipc_send>:
+{
+  804311:	55                   	push   %ebp
+  804312:	89 e5                	mov    %esp,%ebp
+  804314:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804317:	ff 75 14             	push   0x14(%ebp)
+  80431a:	6a 01                	push   $0x1
+  80431c:	ff 75 10             	push   0x10(%ebp)
+  80431f:	ff 75 0c             	push   0xc(%ebp)
+  804322:	ff 75 08             	push   0x8(%ebp)
+  804325:	e8 31 ff ff ff       	call   80425b <ipc_try_send_pages>
+  80432a:	83 c4 20             	add    $0x20,%esp
+  80432d:	85 c0                	test   %eax,%eax
+  80432f:	78 02                	js     804333 <ipc_send+0x22>
+}
+  804331:	c9                   	leave
+  804332:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804333:	50                   	push   %eax
+  804334:	68 86 4c 80 00       	push   $0x804c86
+  804339:	6a 3f                	push   $0x3f
+  80433b:	68 9b 4c 80 00       	push   $0x804c9b
+  804340:	e8 70 c1 ff ff       	call   8004b5 <_panic>
+
+00804345 <ipc_send_pages>:
+{
+  804345:	55                   	push   %ebp
+  804346:	89 e5                	mov    %esp,%ebp
+  804348:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80434b:	ff 75 18             	push   0x18(%ebp)
+  80434e:	ff 75 14             	push   0x14(%ebp)
+  804351:	ff 75 10             	push   0x10(%ebp)
+  804354:	ff 75 0c             	push   0xc(%ebp)
+  804357:	ff 75 08             	push   0x8(%ebp)
+  80435a:	e8 fc fe ff ff       	call   80425b <ipc_try_send_pages>
+  80435f:	83 c4 20             	add    $0x20,%esp
+  804362:	85 c0                	test   %eax,%eax
+  804364:	78 02                	js     804368 <ipc_send_pages+0x23>
+}
+  804366:	c9                   	leave
+  804367:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804368:	50                   	push   %eax
+  804369:	68 a5 4c 80 00       	push   $0x804ca5
+  80436e:	6a 64                	push   $0x64
+  804370:	68 9b 4c 80 00       	push   $0x804c9b
+  804375:	e8 3b c1 ff ff       	call   8004b5 <_panic>
+
+0080437a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80437a:	55                   	push   %ebp
+  80437b:	89 e5                	mov    %esp,%ebp
+  80437d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804380:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804385:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80438b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804391:	8b 52 50             	mov    0x50(%edx),%edx
+  804394:	39 ca                	cmp    %ecx,%edx
+  804396:	74 11                	je     8043a9 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804398:	83 c0 01             	add    $0x1,%eax
+  80439b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8043a0:	75 e3                	jne    804385 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a7:	eb 0e                	jmp    8043b7 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043a9:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8043af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043b4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043b7:	5d                   	pop    %ebp
+  8043b8:	c3                   	ret
+
+008043b9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043b9:	55                   	push   %ebp
+  8043ba:	89 e5                	mov    %esp,%ebp
+  8043bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8043bf:	89 c2                	mov    %eax,%edx
+  8043c1:	c1 ea 16             	shr    $0x16,%edx
+  8043c4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043cb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8043d0:	f6 c1 01             	test   $0x1,%cl
+  8043d3:	74 1e                	je     8043f3 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8043d5:	c1 e8 0c             	shr    $0xc,%eax
+  8043d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043df:	a8 01                	test   $0x1,%al
+  8043e1:	74 10                	je     8043f3 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043e3:	c1 e8 0c             	shr    $0xc,%eax
+  8043e6:	c1 e0 04             	shl    $0x4,%eax
+  8043e9:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8043f0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8043f3:	89 d0                	mov    %edx,%eax
+  8043f5:	5d                   	pop    %ebp
+  8043f6:	c3                   	ret
+
+008043f7 <__udivdi3>:
+  8043f7:	57                   	push   %edi
+  8043f8:	56                   	push   %esi
+  8043f9:	53                   	push   %ebx
+  8043fa:	83 ec 20             	sub    $0x20,%esp
+  8043fd:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804401:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804405:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804409:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80440d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804411:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804415:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804419:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80441d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804422:	b8 00 00 00 00       	mov    $0x0,%eax
+  804427:	ba 00 00 00 00       	mov    $0x0,%edx
+  80442c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804433:	00 
+  804434:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80443b:	00 
+  80443c:	eb 08                	jmp    804446 <__udivdi3+0x4f>
+  80443e:	83 e9 01             	sub    $0x1,%ecx
+  804441:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804444:	74 68                	je     8044ae <__udivdi3+0xb7>
+  804446:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80444a:	01 c0                	add    %eax,%eax
+  80444c:	89 c6                	mov    %eax,%esi
+  80444e:	89 d7                	mov    %edx,%edi
+  804450:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804454:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804458:	0f ad d0             	shrd   %cl,%edx,%eax
+  80445b:	d3 ea                	shr    %cl,%edx
+  80445d:	f6 c1 20             	test   $0x20,%cl
+  804460:	74 04                	je     804466 <__udivdi3+0x6f>
+  804462:	89 d0                	mov    %edx,%eax
+  804464:	31 d2                	xor    %edx,%edx
+  804466:	83 e0 01             	and    $0x1,%eax
+  804469:	89 04 24             	mov    %eax,(%esp)
+  80446c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804473:	00 
+  804474:	8b 04 24             	mov    (%esp),%eax
+  804477:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80447b:	09 f0                	or     %esi,%eax
+  80447d:	09 fa                	or     %edi,%edx
+  80447f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804483:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804487:	39 f0                	cmp    %esi,%eax
+  804489:	89 d3                	mov    %edx,%ebx
+  80448b:	19 fb                	sbb    %edi,%ebx
+  80448d:	72 af                	jb     80443e <__udivdi3+0x47>
+  80448f:	29 f0                	sub    %esi,%eax
+  804491:	19 fa                	sbb    %edi,%edx
+  804493:	89 cf                	mov    %ecx,%edi
+  804495:	c1 ef 05             	shr    $0x5,%edi
+  804498:	83 e7 01             	and    $0x1,%edi
+  80449b:	89 fe                	mov    %edi,%esi
+  80449d:	83 f6 01             	xor    $0x1,%esi
+  8044a0:	d3 e6                	shl    %cl,%esi
+  8044a2:	d3 e7                	shl    %cl,%edi
+  8044a4:	09 74 24 18          	or     %esi,0x18(%esp)
+  8044a8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8044ac:	eb 90                	jmp    80443e <__udivdi3+0x47>
+  8044ae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8044b2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8044b6:	83 c4 20             	add    $0x20,%esp
+  8044b9:	5b                   	pop    %ebx
+  8044ba:	5e                   	pop    %esi
+  8044bb:	5f                   	pop    %edi
+  8044bc:	c3                   	ret
+
+008044bd <__umoddi3>:
+  8044bd:	57                   	push   %edi
+  8044be:	56                   	push   %esi
+  8044bf:	53                   	push   %ebx
+  8044c0:	83 ec 08             	sub    $0x8,%esp
+  8044c3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8044c7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8044cb:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8044cf:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8044d3:	57                   	push   %edi
+  8044d4:	56                   	push   %esi
+  8044d5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044d9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044dd:	52                   	push   %edx
+  8044de:	50                   	push   %eax
+  8044df:	e8 13 ff ff ff       	call   8043f7 <__udivdi3>
+  8044e4:	89 c3                	mov    %eax,%ebx
+  8044e6:	0f af d6             	imul   %esi,%edx
+  8044e9:	89 f9                	mov    %edi,%ecx
+  8044eb:	0f af cb             	imul   %ebx,%ecx
+  8044ee:	01 d1                	add    %edx,%ecx
+  8044f0:	89 d8                	mov    %ebx,%eax
+  8044f2:	f7 e6                	mul    %esi
+  8044f4:	89 c6                	mov    %eax,%esi
+  8044f6:	89 d7                	mov    %edx,%edi
+  8044f8:	01 cf                	add    %ecx,%edi
+  8044fa:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044fe:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804502:	29 f0                	sub    %esi,%eax
+  804504:	19 fa                	sbb    %edi,%edx
+  804506:	83 c4 18             	add    $0x18,%esp
+  804509:	5b                   	pop    %ebx
+  80450a:	5e                   	pop    %esi
+  80450b:	5f                   	pop    %edi
+  80450c:	c3                   	ret
+
+0080450d <__divdi3>:
+  80450d:	53                   	push   %ebx
+  80450e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804512:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804516:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80451a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80451e:	85 d2                	test   %edx,%edx
+  804520:	78 12                	js     804534 <__divdi3+0x27>
+  804522:	85 db                	test   %ebx,%ebx
+  804524:	78 2e                	js     804554 <__divdi3+0x47>
+  804526:	53                   	push   %ebx
+  804527:	51                   	push   %ecx
+  804528:	52                   	push   %edx
+  804529:	50                   	push   %eax
+  80452a:	e8 c8 fe ff ff       	call   8043f7 <__udivdi3>
+  80452f:	83 c4 10             	add    $0x10,%esp
+  804532:	eb 1e                	jmp    804552 <__divdi3+0x45>
+  804534:	f7 d8                	neg    %eax
+  804536:	83 d2 00             	adc    $0x0,%edx
+  804539:	f7 da                	neg    %edx
+  80453b:	85 db                	test   %ebx,%ebx
+  80453d:	78 2a                	js     804569 <__divdi3+0x5c>
+  80453f:	53                   	push   %ebx
+  804540:	51                   	push   %ecx
+  804541:	52                   	push   %edx
+  804542:	50                   	push   %eax
+  804543:	e8 af fe ff ff       	call   8043f7 <__udivdi3>
+  804548:	83 c4 10             	add    $0x10,%esp
+  80454b:	f7 d8                	neg    %eax
+  80454d:	83 d2 00             	adc    $0x0,%edx
+  804550:	f7 da                	neg    %edx
+  804552:	5b                   	pop    %ebx
+  804553:	c3                   	ret
+  804554:	f7 d9                	neg    %ecx
+  804556:	83 d3 00             	adc    $0x0,%ebx
+  804559:	f7 db                	neg    %ebx
+  80455b:	53                   	push   %ebx
+  80455c:	51                   	push   %ecx
+  80455d:	52                   	push   %edx
+  80455e:	50                   	push   %eax
+  80455f:	e8 93 fe ff ff       	call   8043f7 <__udivdi3>
+  804564:	83 c4 10             	add    $0x10,%esp
+  804567:	eb e2                	jmp    80454b <__divdi3+0x3e>
+  804569:	f7 d9                	neg    %ecx
+  80456b:	83 d3 00             	adc    $0x0,%ebx
+  80456e:	f7 db                	neg    %ebx
+  804570:	53                   	push   %ebx
+  804571:	51                   	push   %ecx
+  804572:	52                   	push   %edx
+  804573:	50                   	push   %eax
+  804574:	e8 7e fe ff ff       	call   8043f7 <__udivdi3>
+  804579:	83 c4 10             	add    $0x10,%esp
+  80457c:	eb d4                	jmp    804552 <__divdi3+0x45>
+
+0080457e <__moddi3>:
+  80457e:	57                   	push   %edi
+  80457f:	56                   	push   %esi
+  804580:	53                   	push   %ebx
+  804581:	83 ec 08             	sub    $0x8,%esp
+  804584:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804588:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80458c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804590:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804594:	57                   	push   %edi
+  804595:	56                   	push   %esi
+  804596:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80459a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80459e:	52                   	push   %edx
+  80459f:	50                   	push   %eax
+  8045a0:	e8 68 ff ff ff       	call   80450d <__divdi3>
+  8045a5:	89 c3                	mov    %eax,%ebx
+  8045a7:	0f af d6             	imul   %esi,%edx
+  8045aa:	89 f9                	mov    %edi,%ecx
+  8045ac:	0f af cb             	imul   %ebx,%ecx
+  8045af:	01 d1                	add    %edx,%ecx
+  8045b1:	89 d8                	mov    %ebx,%eax
+  8045b3:	f7 e6                	mul    %esi
+  8045b5:	89 c6                	mov    %eax,%esi
+  8045b7:	89 d7                	mov    %edx,%edi
+  8045b9:	01 cf                	add    %ecx,%edi
+  8045bb:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8045bf:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8045c3:	29 f0                	sub    %esi,%eax
+  8045c5:	19 fa                	sbb    %edi,%edx
+  8045c7:	83 c4 18             	add    $0x18,%esp
+  8045ca:	5b                   	pop    %ebx
+  8045cb:	5e                   	pop    %esi
+  8045cc:	5f                   	pop    %edi
+  8045cd:	c3                   	ret
@@ -0,0 +1,9141 @@
+
+obj/user/ipcbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 95 01 00 00       	call   8001c6 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#define NROUNDS	10000
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 4c             	sub    $0x4c,%esp
+	struct TlbStats ts0, ts1;
+	envid_t who;
+	uint64_t t0, cycles;
+	uint32_t i, s0, calls;
+
+	binaryname = "ipcbench";
+  80003e:	c7 05 00 50 80 00 60 	movl   $0x804560,0x805000
+  800045:	45 80 00 
+	if ((who = fork()) < 0)
+  800048:	e8 2e 14 00 00       	call   80147b <fork>
+  80004d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  800050:	85 c0                	test   %eax,%eax
+  800052:	0f 88 2a 01 00 00    	js     800182 <umain+0x14d>
+		panic("fork: %e", who);
+	if (who == 0) {
+		while ((i = ipc_recv(&who, 0, 0)) < NROUNDS)
+  800058:	8d 5d bc             	lea    -0x44(%ebp),%ebx
+	if (who == 0) {
+  80005b:	0f 84 46 01 00 00    	je     8001a7 <umain+0x172>
+			ipc_send(who, i + 1, 0, 0);
+		return;
+	}
+
+	// Warm up both sides before timing.
+	ipc_send(who, 0, 0, 0);
+  800061:	6a 00                	push   $0x0
+  800063:	6a 00                	push   $0x0
+  800065:	6a 00                	push   $0x0
+  800067:	50                   	push   %eax
+  800068:	e8 75 1c 00 00       	call   801ce2 <ipc_send>
+	ipc_recv(0, 0, 0);
+  80006d:	83 c4 0c             	add    $0xc,%esp
+  800070:	6a 00                	push   $0x0
+  800072:	6a 00                	push   $0x0
+  800074:	6a 00                	push   $0x0
+  800076:	e8 d7 19 00 00       	call   801a52 <ipc_recv>
+
+	sys_tlb_stats(&ts0);
+  80007b:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  80007e:	89 04 24             	mov    %eax,(%esp)
+  800081:	e8 e3 10 00 00       	call   801169 <sys_tlb_stats>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800086:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800088:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80008d:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  80008f:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800092:	89 c2                	mov    %eax,%edx
+  800094:	c1 ea 0f             	shr    $0xf,%edx
+  800097:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80009c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a1:	0f 42 c2             	cmovb  %edx,%eax
+	s0 = thisenv->env_syscalls;
+  8000a4:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8000ab:	8b 40 5c             	mov    0x5c(%eax),%eax
+  8000ae:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+        uint64_t tsc;
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  8000b1:	0f 31                	rdtsc
+  8000b3:	89 c6                	mov    %eax,%esi
+  8000b5:	89 d7                	mov    %edx,%edi
+  8000b7:	bb 10 27 00 00       	mov    $0x2710,%ebx
+	t0 = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+		ipc_send(who, 0, 0, 0);
+  8000bc:	6a 00                	push   $0x0
+  8000be:	6a 00                	push   $0x0
+  8000c0:	6a 00                	push   $0x0
+  8000c2:	ff 75 bc             	push   -0x44(%ebp)
+  8000c5:	e8 18 1c 00 00       	call   801ce2 <ipc_send>
+		ipc_recv(0, 0, 0);
+  8000ca:	83 c4 0c             	add    $0xc,%esp
+  8000cd:	6a 00                	push   $0x0
+  8000cf:	6a 00                	push   $0x0
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	e8 7a 19 00 00       	call   801a52 <ipc_recv>
+	for (i = 0; i < NROUNDS; i++) {
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	83 eb 01             	sub    $0x1,%ebx
+  8000de:	75 dc                	jne    8000bc <umain+0x87>
+  8000e0:	0f 31                	rdtsc
+	}
+	cycles = read_tsc() - t0;
+  8000e2:	29 f0                	sub    %esi,%eax
+  8000e4:	19 fa                	sbb    %edi,%edx
+  8000e6:	89 c6                	mov    %eax,%esi
+  8000e8:	89 d7                	mov    %edx,%edi
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000ea:	89 e2                	mov    %esp,%edx
+  8000ec:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000f1:	29 d0                	sub    %edx,%eax
+  8000f3:	89 c2                	mov    %eax,%edx
+  8000f5:	c1 ea 0f             	shr    $0xf,%edx
+  8000f8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000fd:	0f 42 da             	cmovb  %edx,%ebx
+	calls = thisenv->env_syscalls - s0;
+  800100:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  800107:	8b 40 5c             	mov    0x5c(%eax),%eax
+  80010a:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  80010d:	29 c8                	sub    %ecx,%eax
+  80010f:	89 c3                	mov    %eax,%ebx
+	sys_tlb_stats(&ts1);
+  800111:	83 ec 0c             	sub    $0xc,%esp
+  800114:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  800117:	50                   	push   %eax
+  800118:	e8 4c 10 00 00       	call   801169 <sys_tlb_stats>
+	ipc_send(who, NROUNDS, 0, 0);
+  80011d:	6a 00                	push   $0x0
+  80011f:	6a 00                	push   $0x0
+  800121:	68 10 27 00 00       	push   $0x2710
+  800126:	ff 75 bc             	push   -0x44(%ebp)
+  800129:	e8 b4 1b 00 00       	call   801ce2 <ipc_send>
+
+	cprintf("ipcbench: %u cycles per round trip, %u syscalls\n",
+  80012e:	83 c4 1c             	add    $0x1c,%esp
+  800131:	ba 59 17 b7 d1       	mov    $0xd1b71759,%edx
+  800136:	89 d8                	mov    %ebx,%eax
+  800138:	f7 e2                	mul    %edx
+  80013a:	c1 ea 0d             	shr    $0xd,%edx
+  80013d:	52                   	push   %edx
+		(uint32_t) (cycles / NROUNDS), calls / NROUNDS);
+  80013e:	83 ec 08             	sub    $0x8,%esp
+  800141:	6a 00                	push   $0x0
+  800143:	68 10 27 00 00       	push   $0x2710
+  800148:	57                   	push   %edi
+  800149:	56                   	push   %esi
+  80014a:	e8 38 42 00 00       	call   804387 <__udivdi3>
+  80014f:	83 c4 18             	add    $0x18,%esp
+	cprintf("ipcbench: %u cycles per round trip, %u syscalls\n",
+  800152:	50                   	push   %eax
+  800153:	68 7c 45 80 00       	push   $0x80457c
+  800158:	e8 eb 01 00 00       	call   800348 <cprintf>
+	cprintf("ipcbench: %u CR3 loads per 100 round trips\n",
+  80015d:	83 c4 08             	add    $0x8,%esp
+		(ts1.ts_cr3loads - ts0.ts_cr3loads) / (NROUNDS / 100));
+  800160:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  800163:	2b 55 e4             	sub    -0x1c(%ebp),%edx
+	cprintf("ipcbench: %u CR3 loads per 100 round trips\n",
+  800166:	b9 1f 85 eb 51       	mov    $0x51eb851f,%ecx
+  80016b:	89 d0                	mov    %edx,%eax
+  80016d:	f7 e1                	mul    %ecx
+  80016f:	c1 ea 05             	shr    $0x5,%edx
+  800172:	52                   	push   %edx
+  800173:	68 b0 45 80 00       	push   $0x8045b0
+  800178:	e8 cb 01 00 00       	call   800348 <cprintf>
+  80017d:	83 c4 10             	add    $0x10,%esp
+  800180:	eb 3c                	jmp    8001be <umain+0x189>
+		panic("fork: %e", who);
+  800182:	50                   	push   %eax
+  800183:	68 dd 49 80 00       	push   $0x8049dd
+  800188:	6a 15                	push   $0x15
+  80018a:	68 69 45 80 00       	push   $0x804569
+  80018f:	e8 d9 00 00 00       	call   80026d <_panic>
+			ipc_send(who, i + 1, 0, 0);
+  800194:	6a 00                	push   $0x0
+  800196:	6a 00                	push   $0x0
+  800198:	83 c0 01             	add    $0x1,%eax
+  80019b:	50                   	push   %eax
+  80019c:	ff 75 bc             	push   -0x44(%ebp)
+  80019f:	e8 3e 1b 00 00       	call   801ce2 <ipc_send>
+  8001a4:	83 c4 10             	add    $0x10,%esp
+		while ((i = ipc_recv(&who, 0, 0)) < NROUNDS)
+  8001a7:	83 ec 04             	sub    $0x4,%esp
+  8001aa:	6a 00                	push   $0x0
+  8001ac:	6a 00                	push   $0x0
+  8001ae:	53                   	push   %ebx
+  8001af:	e8 9e 18 00 00       	call   801a52 <ipc_recv>
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+  8001bc:	76 d6                	jbe    800194 <umain+0x15f>
+}
+  8001be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c1:	5b                   	pop    %ebx
+  8001c2:	5e                   	pop    %esi
+  8001c3:	5f                   	pop    %edi
+  8001c4:	5d                   	pop    %ebp
+  8001c5:	c3                   	ret
+
+008001c6 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001c6:	55                   	push   %ebp
+  8001c7:	89 e5                	mov    %esp,%ebp
+  8001c9:	56                   	push   %esi
+  8001ca:	53                   	push   %ebx
+  8001cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001d1:	89 e2                	mov    %esp,%edx
+  8001d3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8001d8:	29 d0                	sub    %edx,%eax
+  8001da:	89 c2                	mov    %eax,%edx
+  8001dc:	c1 ea 0f             	shr    $0xf,%edx
+  8001df:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e9:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8001ec:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  8001f3:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8001f7:	e8 39 0c 00 00       	call   800e35 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8001fc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800201:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800207:	89 e1                	mov    %esp,%ecx
+  800209:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80020e:	29 ca                	sub    %ecx,%edx
+  800210:	89 d1                	mov    %edx,%ecx
+  800212:	c1 e9 0f             	shr    $0xf,%ecx
+  800215:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80021b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800220:	0f 42 d1             	cmovb  %ecx,%edx
+  800223:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800228:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80022f:	85 db                	test   %ebx,%ebx
+  800231:	7e 07                	jle    80023a <libmain+0x74>
+		binaryname = argv[0];
+  800233:	8b 06                	mov    (%esi),%eax
+  800235:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80023a:	83 ec 08             	sub    $0x8,%esp
+  80023d:	56                   	push   %esi
+  80023e:	53                   	push   %ebx
+  80023f:	e8 f1 fd ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800244:	e8 0a 00 00 00       	call   800253 <exit>
+}
+  800249:	83 c4 10             	add    $0x10,%esp
+  80024c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80024f:	5b                   	pop    %ebx
+  800250:	5e                   	pop    %esi
+  800251:	5d                   	pop    %ebp
+  800252:	c3                   	ret
+
+00800253 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800253:	55                   	push   %ebp
+  800254:	89 e5                	mov    %esp,%ebp
+  800256:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800259:	e8 15 1d 00 00       	call   801f73 <close_all>
+	sys_env_destroy(0);
+  80025e:	83 ec 0c             	sub    $0xc,%esp
+  800261:	6a 00                	push   $0x0
+  800263:	e8 8c 0b 00 00       	call   800df4 <sys_env_destroy>
+}
+  800268:	83 c4 10             	add    $0x10,%esp
+  80026b:	c9                   	leave
+  80026c:	c3                   	ret
+
+0080026d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	56                   	push   %esi
+  800271:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800272:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800275:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80027b:	e8 b5 0b 00 00       	call   800e35 <sys_getenvid>
+  800280:	83 ec 0c             	sub    $0xc,%esp
+  800283:	ff 75 0c             	push   0xc(%ebp)
+  800286:	ff 75 08             	push   0x8(%ebp)
+  800289:	56                   	push   %esi
+  80028a:	50                   	push   %eax
+  80028b:	68 e8 45 80 00       	push   $0x8045e8
+  800290:	e8 b3 00 00 00       	call   800348 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800295:	83 c4 18             	add    $0x18,%esp
+  800298:	53                   	push   %ebx
+  800299:	ff 75 10             	push   0x10(%ebp)
+  80029c:	e8 56 00 00 00       	call   8002f7 <vcprintf>
+	cprintf("\n");
+  8002a1:	c7 04 24 a4 4b 80 00 	movl   $0x804ba4,(%esp)
+  8002a8:	e8 9b 00 00 00       	call   800348 <cprintf>
+  8002ad:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002b0:	cc                   	int3
+	while (1)
+  8002b1:	eb fd                	jmp    8002b0 <_panic+0x43>
+
+008002b3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002b3:	55                   	push   %ebp
+  8002b4:	89 e5                	mov    %esp,%ebp
+  8002b6:	53                   	push   %ebx
+  8002b7:	83 ec 04             	sub    $0x4,%esp
+  8002ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002bd:	8b 13                	mov    (%ebx),%edx
+  8002bf:	8d 42 01             	lea    0x1(%edx),%eax
+  8002c2:	89 03                	mov    %eax,(%ebx)
+  8002c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002cb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002d0:	74 09                	je     8002db <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002d2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002d9:	c9                   	leave
+  8002da:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002db:	83 ec 08             	sub    $0x8,%esp
+  8002de:	68 ff 00 00 00       	push   $0xff
+  8002e3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002e6:	50                   	push   %eax
+  8002e7:	e8 cb 0a 00 00       	call   800db7 <sys_cputs>
+		b->idx = 0;
+  8002ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	eb db                	jmp    8002d2 <putch+0x1f>
+
+008002f7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002f7:	55                   	push   %ebp
+  8002f8:	89 e5                	mov    %esp,%ebp
+  8002fa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800300:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800307:	00 00 00 
+	b.cnt = 0;
+  80030a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800311:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800314:	ff 75 0c             	push   0xc(%ebp)
+  800317:	ff 75 08             	push   0x8(%ebp)
+  80031a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800320:	50                   	push   %eax
+  800321:	68 b3 02 80 00       	push   $0x8002b3
+  800326:	e8 1c 01 00 00       	call   800447 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80032b:	83 c4 08             	add    $0x8,%esp
+  80032e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800334:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80033a:	50                   	push   %eax
+  80033b:	e8 77 0a 00 00       	call   800db7 <sys_cputs>
+
+	return b.cnt;
+}
+  800340:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800346:	c9                   	leave
+  800347:	c3                   	ret
+
+00800348 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80034e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800351:	50                   	push   %eax
+  800352:	ff 75 08             	push   0x8(%ebp)
+  800355:	e8 9d ff ff ff       	call   8002f7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80035a:	c9                   	leave
+  80035b:	c3                   	ret
+
+0080035c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80035c:	55                   	push   %ebp
+  80035d:	89 e5                	mov    %esp,%ebp
+  80035f:	57                   	push   %edi
+  800360:	56                   	push   %esi
+  800361:	53                   	push   %ebx
+  800362:	83 ec 1c             	sub    $0x1c,%esp
+  800365:	89 c3                	mov    %eax,%ebx
+  800367:	89 d6                	mov    %edx,%esi
+  800369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80036c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80036f:	89 d1                	mov    %edx,%ecx
+  800371:	89 c2                	mov    %eax,%edx
+  800373:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800376:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800379:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80037c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80037f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800386:	39 c2                	cmp    %eax,%edx
+  800388:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80038b:	73 4b                	jae    8003d8 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80038d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800390:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800393:	85 ff                	test   %edi,%edi
+  800395:	7e 11                	jle    8003a8 <printnum+0x4c>
+			putch(padc, putdat);
+  800397:	83 ec 08             	sub    $0x8,%esp
+  80039a:	56                   	push   %esi
+  80039b:	ff 75 18             	push   0x18(%ebp)
+  80039e:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8003a0:	83 c4 10             	add    $0x10,%esp
+  8003a3:	83 ef 01             	sub    $0x1,%edi
+  8003a6:	75 ef                	jne    800397 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003a8:	83 ec 08             	sub    $0x8,%esp
+  8003ab:	56                   	push   %esi
+  8003ac:	83 ec 04             	sub    $0x4,%esp
+  8003af:	ff 75 e4             	push   -0x1c(%ebp)
+  8003b2:	ff 75 e0             	push   -0x20(%ebp)
+  8003b5:	ff 75 dc             	push   -0x24(%ebp)
+  8003b8:	ff 75 d8             	push   -0x28(%ebp)
+  8003bb:	e8 8d 40 00 00       	call   80444d <__umoddi3>
+  8003c0:	83 c4 14             	add    $0x14,%esp
+  8003c3:	0f be 80 0b 46 80 00 	movsbl 0x80460b(%eax),%eax
+  8003ca:	50                   	push   %eax
+  8003cb:	ff d3                	call   *%ebx
+}
+  8003cd:	83 c4 10             	add    $0x10,%esp
+  8003d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d3:	5b                   	pop    %ebx
+  8003d4:	5e                   	pop    %esi
+  8003d5:	5f                   	pop    %edi
+  8003d6:	5d                   	pop    %ebp
+  8003d7:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003d8:	83 ec 0c             	sub    $0xc,%esp
+  8003db:	ff 75 18             	push   0x18(%ebp)
+  8003de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003e1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003e4:	52                   	push   %edx
+  8003e5:	50                   	push   %eax
+  8003e6:	83 ec 08             	sub    $0x8,%esp
+  8003e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ec:	ff 75 e0             	push   -0x20(%ebp)
+  8003ef:	ff 75 dc             	push   -0x24(%ebp)
+  8003f2:	ff 75 d8             	push   -0x28(%ebp)
+  8003f5:	e8 8d 3f 00 00       	call   804387 <__udivdi3>
+  8003fa:	83 c4 18             	add    $0x18,%esp
+  8003fd:	52                   	push   %edx
+  8003fe:	50                   	push   %eax
+  8003ff:	89 f2                	mov    %esi,%edx
+  800401:	89 d8                	mov    %ebx,%eax
+  800403:	e8 54 ff ff ff       	call   80035c <printnum>
+  800408:	83 c4 20             	add    $0x20,%esp
+  80040b:	eb 9b                	jmp    8003a8 <printnum+0x4c>
+
+0080040d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800413:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800417:	8b 10                	mov    (%eax),%edx
+  800419:	3b 50 04             	cmp    0x4(%eax),%edx
+  80041c:	73 0a                	jae    800428 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80041e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800421:	89 08                	mov    %ecx,(%eax)
+  800423:	8b 45 08             	mov    0x8(%ebp),%eax
+  800426:	88 02                	mov    %al,(%edx)
+}
+  800428:	5d                   	pop    %ebp
+  800429:	c3                   	ret
+
+0080042a <printfmt>:
+{
+  80042a:	55                   	push   %ebp
+  80042b:	89 e5                	mov    %esp,%ebp
+  80042d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800430:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800433:	50                   	push   %eax
+  800434:	ff 75 10             	push   0x10(%ebp)
+  800437:	ff 75 0c             	push   0xc(%ebp)
+  80043a:	ff 75 08             	push   0x8(%ebp)
+  80043d:	e8 05 00 00 00       	call   800447 <vprintfmt>
+}
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+
+00800447 <vprintfmt>:
+{
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	57                   	push   %edi
+  80044b:	56                   	push   %esi
+  80044c:	53                   	push   %ebx
+  80044d:	83 ec 2c             	sub    $0x2c,%esp
+  800450:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800453:	89 df                	mov    %ebx,%edi
+  800455:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800458:	8b 45 10             	mov    0x10(%ebp),%eax
+  80045b:	8d 70 01             	lea    0x1(%eax),%esi
+  80045e:	0f b6 00             	movzbl (%eax),%eax
+  800461:	83 f8 25             	cmp    $0x25,%eax
+  800464:	74 1e                	je     800484 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800466:	85 c0                	test   %eax,%eax
+  800468:	0f 84 15 05 00 00    	je     800983 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80046e:	83 ec 08             	sub    $0x8,%esp
+  800471:	53                   	push   %ebx
+  800472:	50                   	push   %eax
+  800473:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800475:	83 c6 01             	add    $0x1,%esi
+  800478:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80047c:	83 c4 10             	add    $0x10,%esp
+  80047f:	83 f8 25             	cmp    $0x25,%eax
+  800482:	75 e2                	jne    800466 <vprintfmt+0x1f>
+		padc = ' ';
+  800484:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800488:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80048f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800496:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80049d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a5:	8d 56 01             	lea    0x1(%esi),%edx
+  8004a8:	0f b6 0e             	movzbl (%esi),%ecx
+  8004ab:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004ae:	3c 55                	cmp    $0x55,%al
+  8004b0:	0f 87 3b 04 00 00    	ja     8008f1 <vprintfmt+0x4aa>
+  8004b6:	0f b6 c0             	movzbl %al,%eax
+  8004b9:	ff 24 85 80 47 80 00 	jmp    *0x804780(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8004c0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004c3:	eb 93                	jmp    800458 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c5:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8004c7:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004cb:	eb d8                	jmp    8004a5 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cd:	89 d6                	mov    %edx,%esi
+  8004cf:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004d3:	eb d0                	jmp    8004a5 <vprintfmt+0x5e>
+  8004d5:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8004d8:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004db:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8004de:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8004e2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004e5:	83 f9 09             	cmp    $0x9,%ecx
+  8004e8:	77 6f                	ja     800559 <vprintfmt+0x112>
+  8004ea:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8004ed:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8004f0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004f3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8004f7:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8004fa:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004fd:	83 fe 09             	cmp    $0x9,%esi
+  800500:	76 eb                	jbe    8004ed <vprintfmt+0xa6>
+  800502:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800505:	89 d6                	mov    %edx,%esi
+  800507:	eb 13                	jmp    80051c <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800509:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050c:	8b 00                	mov    (%eax),%eax
+  80050e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800511:	8b 45 14             	mov    0x14(%ebp),%eax
+  800514:	8d 40 04             	lea    0x4(%eax),%eax
+  800517:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80051a:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80051c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800520:	79 83                	jns    8004a5 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800522:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800525:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800528:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80052f:	e9 71 ff ff ff       	jmp    8004a5 <vprintfmt+0x5e>
+			if (width < 0)
+  800534:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800537:	85 c9                	test   %ecx,%ecx
+  800539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053e:	0f 49 c1             	cmovns %ecx,%eax
+  800541:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800544:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800546:	e9 5a ff ff ff       	jmp    8004a5 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80054b:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80054d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800554:	e9 4c ff ff ff       	jmp    8004a5 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800559:	89 d6                	mov    %edx,%esi
+  80055b:	eb bf                	jmp    80051c <vprintfmt+0xd5>
+			lflag++;
+  80055d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800561:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800563:	e9 3d ff ff ff       	jmp    8004a5 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800568:	89 55 10             	mov    %edx,0x10(%ebp)
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8d 70 04             	lea    0x4(%eax),%esi
+  800571:	83 ec 08             	sub    $0x8,%esp
+  800574:	53                   	push   %ebx
+  800575:	ff 30                	push   (%eax)
+  800577:	ff d7                	call   *%edi
+			break;
+  800579:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80057c:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80057f:	e9 d4 fe ff ff       	jmp    800458 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800584:	89 55 10             	mov    %edx,0x10(%ebp)
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80058d:	8b 10                	mov    (%eax),%edx
+  80058f:	89 d0                	mov    %edx,%eax
+  800591:	f7 d8                	neg    %eax
+  800593:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800596:	83 f8 12             	cmp    $0x12,%eax
+  800599:	7f 23                	jg     8005be <vprintfmt+0x177>
+  80059b:	8b 14 85 e0 48 80 00 	mov    0x8048e0(,%eax,4),%edx
+  8005a2:	85 d2                	test   %edx,%edx
+  8005a4:	74 18                	je     8005be <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8005a6:	52                   	push   %edx
+  8005a7:	68 6f 4b 80 00       	push   $0x804b6f
+  8005ac:	53                   	push   %ebx
+  8005ad:	57                   	push   %edi
+  8005ae:	e8 77 fe ff ff       	call   80042a <printfmt>
+  8005b3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005b6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005b9:	e9 9a fe ff ff       	jmp    800458 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8005be:	50                   	push   %eax
+  8005bf:	68 23 46 80 00       	push   $0x804623
+  8005c4:	53                   	push   %ebx
+  8005c5:	57                   	push   %edi
+  8005c6:	e8 5f fe ff ff       	call   80042a <printfmt>
+  8005cb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005ce:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005d1:	e9 82 fe ff ff       	jmp    800458 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	83 c0 04             	add    $0x4,%eax
+  8005df:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e5:	8b 00                	mov    (%eax),%eax
+  8005e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ea:	85 c0                	test   %eax,%eax
+  8005ec:	0f 84 61 03 00 00    	je     800953 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8005f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005f6:	7e 06                	jle    8005fe <vprintfmt+0x1b7>
+  8005f8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005fc:	75 29                	jne    800627 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800601:	8d 70 01             	lea    0x1(%eax),%esi
+  800604:	0f b6 00             	movzbl (%eax),%eax
+  800607:	0f be d0             	movsbl %al,%edx
+  80060a:	85 d2                	test   %edx,%edx
+  80060c:	0f 84 bb 00 00 00    	je     8006cd <vprintfmt+0x286>
+  800612:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800615:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800618:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80061b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80061e:	eb 7a                	jmp    80069a <vprintfmt+0x253>
+				p = "(null)";
+  800620:	c7 45 d0 1c 46 80 00 	movl   $0x80461c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800627:	83 ec 08             	sub    $0x8,%esp
+  80062a:	ff 75 d4             	push   -0x2c(%ebp)
+  80062d:	ff 75 d0             	push   -0x30(%ebp)
+  800630:	e8 e0 03 00 00       	call   800a15 <strnlen>
+  800635:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800638:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80063b:	83 c4 10             	add    $0x10,%esp
+  80063e:	85 d2                	test   %edx,%edx
+  800640:	0f 8e d6 02 00 00    	jle    80091c <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800646:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80064a:	83 ec 08             	sub    $0x8,%esp
+  80064d:	53                   	push   %ebx
+  80064e:	56                   	push   %esi
+  80064f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800651:	83 c4 10             	add    $0x10,%esp
+  800654:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800658:	75 f0                	jne    80064a <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80065a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80065d:	8d 70 01             	lea    0x1(%eax),%esi
+  800660:	0f b6 00             	movzbl (%eax),%eax
+  800663:	0f be d0             	movsbl %al,%edx
+  800666:	85 d2                	test   %edx,%edx
+  800668:	0f 84 da 02 00 00    	je     800948 <vprintfmt+0x501>
+  80066e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800671:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800674:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800677:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80067a:	eb 1e                	jmp    80069a <vprintfmt+0x253>
+					putch(ch, putdat);
+  80067c:	83 ec 08             	sub    $0x8,%esp
+  80067f:	ff 75 0c             	push   0xc(%ebp)
+  800682:	52                   	push   %edx
+  800683:	ff 55 08             	call   *0x8(%ebp)
+  800686:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800689:	83 eb 01             	sub    $0x1,%ebx
+  80068c:	83 c6 01             	add    $0x1,%esi
+  80068f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800693:	0f be d0             	movsbl %al,%edx
+  800696:	85 d2                	test   %edx,%edx
+  800698:	74 2a                	je     8006c4 <vprintfmt+0x27d>
+  80069a:	85 ff                	test   %edi,%edi
+  80069c:	78 05                	js     8006a3 <vprintfmt+0x25c>
+  80069e:	83 ef 01             	sub    $0x1,%edi
+  8006a1:	78 59                	js     8006fc <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006a7:	74 d3                	je     80067c <vprintfmt+0x235>
+  8006a9:	0f be c0             	movsbl %al,%eax
+  8006ac:	83 e8 20             	sub    $0x20,%eax
+  8006af:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b2:	76 c8                	jbe    80067c <vprintfmt+0x235>
+					putch('?', putdat);
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	ff 75 0c             	push   0xc(%ebp)
+  8006ba:	6a 3f                	push   $0x3f
+  8006bc:	ff 55 08             	call   *0x8(%ebp)
+  8006bf:	83 c4 10             	add    $0x10,%esp
+  8006c2:	eb c5                	jmp    800689 <vprintfmt+0x242>
+  8006c4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8006cd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006d0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006d4:	7e 1b                	jle    8006f1 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8006d6:	83 ec 08             	sub    $0x8,%esp
+  8006d9:	53                   	push   %ebx
+  8006da:	6a 20                	push   $0x20
+  8006dc:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	83 ee 01             	sub    $0x1,%esi
+  8006e4:	75 f0                	jne    8006d6 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006e6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ec:	e9 67 fd ff ff       	jmp    800458 <vprintfmt+0x11>
+  8006f1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f7:	e9 5c fd ff ff       	jmp    800458 <vprintfmt+0x11>
+  8006fc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800702:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800705:	eb c6                	jmp    8006cd <vprintfmt+0x286>
+	if (lflag >= 2)
+  800707:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80070a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80070d:	83 f9 01             	cmp    $0x1,%ecx
+  800710:	7f 1f                	jg     800731 <vprintfmt+0x2ea>
+	else if (lflag)
+  800712:	85 c9                	test   %ecx,%ecx
+  800714:	74 67                	je     80077d <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 30                	mov    (%eax),%esi
+  80071b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80071e:	89 f0                	mov    %esi,%eax
+  800720:	c1 f8 1f             	sar    $0x1f,%eax
+  800723:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8d 40 04             	lea    0x4(%eax),%eax
+  80072c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072f:	eb 17                	jmp    800748 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 50 04             	mov    0x4(%eax),%edx
+  800737:	8b 00                	mov    (%eax),%eax
+  800739:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80073c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8d 40 08             	lea    0x8(%eax),%eax
+  800745:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800748:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80074b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80074e:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800753:	85 c9                	test   %ecx,%ecx
+  800755:	0f 89 12 01 00 00    	jns    80086d <vprintfmt+0x426>
+				putch('-', putdat);
+  80075b:	83 ec 08             	sub    $0x8,%esp
+  80075e:	53                   	push   %ebx
+  80075f:	6a 2d                	push   $0x2d
+  800761:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800763:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800766:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800769:	f7 da                	neg    %edx
+  80076b:	83 d1 00             	adc    $0x0,%ecx
+  80076e:	f7 d9                	neg    %ecx
+  800770:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800773:	be 0a 00 00 00       	mov    $0xa,%esi
+  800778:	e9 f0 00 00 00       	jmp    80086d <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8b 30                	mov    (%eax),%esi
+  800782:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800785:	89 f0                	mov    %esi,%eax
+  800787:	c1 f8 1f             	sar    $0x1f,%eax
+  80078a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80078d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800790:	8d 40 04             	lea    0x4(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+  800796:	eb b0                	jmp    800748 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800798:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80079b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80079e:	83 f9 01             	cmp    $0x1,%ecx
+  8007a1:	7f 1e                	jg     8007c1 <vprintfmt+0x37a>
+	else if (lflag)
+  8007a3:	85 c9                	test   %ecx,%ecx
+  8007a5:	74 32                	je     8007d9 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8007a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007aa:	8b 10                	mov    (%eax),%edx
+  8007ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b7:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8007bc:	e9 ac 00 00 00       	jmp    80086d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c4:	8b 10                	mov    (%eax),%edx
+  8007c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007cf:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8007d4:	e9 94 00 00 00       	jmp    80086d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dc:	8b 10                	mov    (%eax),%edx
+  8007de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007e9:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8007ee:	eb 7d                	jmp    80086d <vprintfmt+0x426>
+	if (lflag >= 2)
+  8007f0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007f3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007f6:	83 f9 01             	cmp    $0x1,%ecx
+  8007f9:	7f 1b                	jg     800816 <vprintfmt+0x3cf>
+	else if (lflag)
+  8007fb:	85 c9                	test   %ecx,%ecx
+  8007fd:	74 2c                	je     80082b <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800802:	8b 10                	mov    (%eax),%edx
+  800804:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800809:	8d 40 04             	lea    0x4(%eax),%eax
+  80080c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80080f:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800814:	eb 57                	jmp    80086d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800816:	8b 45 14             	mov    0x14(%ebp),%eax
+  800819:	8b 10                	mov    (%eax),%edx
+  80081b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081e:	8d 40 08             	lea    0x8(%eax),%eax
+  800821:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800824:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800829:	eb 42                	jmp    80086d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	8b 10                	mov    (%eax),%edx
+  800830:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800835:	8d 40 04             	lea    0x4(%eax),%eax
+  800838:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80083b:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800840:	eb 2b                	jmp    80086d <vprintfmt+0x426>
+			putch('0', putdat);
+  800842:	89 55 10             	mov    %edx,0x10(%ebp)
+  800845:	83 ec 08             	sub    $0x8,%esp
+  800848:	53                   	push   %ebx
+  800849:	6a 30                	push   $0x30
+  80084b:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80084d:	83 c4 08             	add    $0x8,%esp
+  800850:	53                   	push   %ebx
+  800851:	6a 78                	push   $0x78
+  800853:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800855:	8b 45 14             	mov    0x14(%ebp),%eax
+  800858:	8b 10                	mov    (%eax),%edx
+  80085a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80085f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800862:	8d 40 04             	lea    0x4(%eax),%eax
+  800865:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800868:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80086d:	83 ec 0c             	sub    $0xc,%esp
+  800870:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800874:	50                   	push   %eax
+  800875:	ff 75 e4             	push   -0x1c(%ebp)
+  800878:	56                   	push   %esi
+  800879:	51                   	push   %ecx
+  80087a:	52                   	push   %edx
+  80087b:	89 da                	mov    %ebx,%edx
+  80087d:	89 f8                	mov    %edi,%eax
+  80087f:	e8 d8 fa ff ff       	call   80035c <printnum>
+			break;
+  800884:	83 c4 20             	add    $0x20,%esp
+  800887:	e9 cc fb ff ff       	jmp    800458 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80088c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80088f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800892:	83 f9 01             	cmp    $0x1,%ecx
+  800895:	7f 1b                	jg     8008b2 <vprintfmt+0x46b>
+	else if (lflag)
+  800897:	85 c9                	test   %ecx,%ecx
+  800899:	74 2c                	je     8008c7 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80089b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089e:	8b 10                	mov    (%eax),%edx
+  8008a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ab:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8008b0:	eb bb                	jmp    80086d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b5:	8b 10                	mov    (%eax),%edx
+  8008b7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8008bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8008c5:	eb a6                	jmp    80086d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ca:	8b 10                	mov    (%eax),%edx
+  8008cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008d7:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8008dc:	eb 8f                	jmp    80086d <vprintfmt+0x426>
+			putch(ch, putdat);
+  8008de:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008e1:	83 ec 08             	sub    $0x8,%esp
+  8008e4:	53                   	push   %ebx
+  8008e5:	6a 25                	push   $0x25
+  8008e7:	ff d7                	call   *%edi
+			break;
+  8008e9:	83 c4 10             	add    $0x10,%esp
+  8008ec:	e9 67 fb ff ff       	jmp    800458 <vprintfmt+0x11>
+			putch('%', putdat);
+  8008f1:	83 ec 08             	sub    $0x8,%esp
+  8008f4:	53                   	push   %ebx
+  8008f5:	6a 25                	push   $0x25
+  8008f7:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008f9:	83 c4 10             	add    $0x10,%esp
+  8008fc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800900:	0f 84 ba fb ff ff    	je     8004c0 <vprintfmt+0x79>
+  800906:	89 75 10             	mov    %esi,0x10(%ebp)
+  800909:	89 f0                	mov    %esi,%eax
+  80090b:	83 e8 01             	sub    $0x1,%eax
+  80090e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800912:	75 f7                	jne    80090b <vprintfmt+0x4c4>
+  800914:	89 45 10             	mov    %eax,0x10(%ebp)
+  800917:	e9 3c fb ff ff       	jmp    800458 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80091c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80091f:	8d 70 01             	lea    0x1(%eax),%esi
+  800922:	0f b6 00             	movzbl (%eax),%eax
+  800925:	0f be d0             	movsbl %al,%edx
+  800928:	85 d2                	test   %edx,%edx
+  80092a:	74 11                	je     80093d <vprintfmt+0x4f6>
+  80092c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80092f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800932:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800935:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800938:	e9 5d fd ff ff       	jmp    80069a <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80093d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800940:	89 45 14             	mov    %eax,0x14(%ebp)
+  800943:	e9 10 fb ff ff       	jmp    800458 <vprintfmt+0x11>
+  800948:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80094b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80094e:	e9 05 fb ff ff       	jmp    800458 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800953:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800957:	7e 0a                	jle    800963 <vprintfmt+0x51c>
+  800959:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80095d:	0f 85 bd fc ff ff    	jne    800620 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800963:	ba 28 00 00 00       	mov    $0x28,%edx
+  800968:	b8 28 00 00 00       	mov    $0x28,%eax
+  80096d:	be 1d 46 80 00       	mov    $0x80461d,%esi
+  800972:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800975:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800978:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80097b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80097e:	e9 17 fd ff ff       	jmp    80069a <vprintfmt+0x253>
+}
+  800983:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800986:	5b                   	pop    %ebx
+  800987:	5e                   	pop    %esi
+  800988:	5f                   	pop    %edi
+  800989:	5d                   	pop    %ebp
+  80098a:	c3                   	ret
+
+0080098b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	83 ec 18             	sub    $0x18,%esp
+  800991:	8b 45 08             	mov    0x8(%ebp),%eax
+  800994:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800997:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80099a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80099e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009a8:	85 c0                	test   %eax,%eax
+  8009aa:	74 26                	je     8009d2 <vsnprintf+0x47>
+  8009ac:	85 d2                	test   %edx,%edx
+  8009ae:	7e 22                	jle    8009d2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009b0:	ff 75 14             	push   0x14(%ebp)
+  8009b3:	ff 75 10             	push   0x10(%ebp)
+  8009b6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009b9:	50                   	push   %eax
+  8009ba:	68 0d 04 80 00       	push   $0x80040d
+  8009bf:	e8 83 fa ff ff       	call   800447 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009c7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009cd:	83 c4 10             	add    $0x10,%esp
+}
+  8009d0:	c9                   	leave
+  8009d1:	c3                   	ret
+		return -E_INVAL;
+  8009d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009d7:	eb f7                	jmp    8009d0 <vsnprintf+0x45>
+
+008009d9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009df:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009e2:	50                   	push   %eax
+  8009e3:	ff 75 10             	push   0x10(%ebp)
+  8009e6:	ff 75 0c             	push   0xc(%ebp)
+  8009e9:	ff 75 08             	push   0x8(%ebp)
+  8009ec:	e8 9a ff ff ff       	call   80098b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009f1:	c9                   	leave
+  8009f2:	c3                   	ret
+
+008009f3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009f9:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009fc:	74 10                	je     800a0e <strlen+0x1b>
+  8009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800a03:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a06:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a0a:	75 f7                	jne    800a03 <strlen+0x10>
+	return n;
+}
+  800a0c:	5d                   	pop    %ebp
+  800a0d:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800a13:	eb f7                	jmp    800a0c <strlen+0x19>
+
+00800a15 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a1e:	85 d2                	test   %edx,%edx
+  800a20:	74 16                	je     800a38 <strnlen+0x23>
+  800a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a27:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a2b:	74 09                	je     800a36 <strnlen+0x21>
+		n++;
+  800a2d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a30:	39 d0                	cmp    %edx,%eax
+  800a32:	75 f3                	jne    800a27 <strnlen+0x12>
+		n++;
+  800a34:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a36:	5d                   	pop    %ebp
+  800a37:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3d:	eb f7                	jmp    800a36 <strnlen+0x21>
+
+00800a3f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	53                   	push   %ebx
+  800a43:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a46:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a52:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a55:	83 c0 01             	add    $0x1,%eax
+  800a58:	84 d2                	test   %dl,%dl
+  800a5a:	75 f2                	jne    800a4e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a5c:	89 c8                	mov    %ecx,%eax
+  800a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a61:	c9                   	leave
+  800a62:	c3                   	ret
+
+00800a63 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	53                   	push   %ebx
+  800a67:	83 ec 10             	sub    $0x10,%esp
+  800a6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a6d:	53                   	push   %ebx
+  800a6e:	e8 80 ff ff ff       	call   8009f3 <strlen>
+  800a73:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a76:	ff 75 0c             	push   0xc(%ebp)
+  800a79:	01 d8                	add    %ebx,%eax
+  800a7b:	50                   	push   %eax
+  800a7c:	e8 be ff ff ff       	call   800a3f <strcpy>
+	return dst;
+}
+  800a81:	89 d8                	mov    %ebx,%eax
+  800a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a86:	c9                   	leave
+  800a87:	c3                   	ret
+
+00800a88 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	56                   	push   %esi
+  800a8c:	53                   	push   %ebx
+  800a8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a93:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a96:	85 db                	test   %ebx,%ebx
+  800a98:	74 17                	je     800ab1 <strncpy+0x29>
+  800a9a:	01 f3                	add    %esi,%ebx
+  800a9c:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a9e:	83 c0 01             	add    $0x1,%eax
+  800aa1:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800aa7:	80 f9 01             	cmp    $0x1,%cl
+  800aaa:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800aad:	39 c3                	cmp    %eax,%ebx
+  800aaf:	75 ed                	jne    800a9e <strncpy+0x16>
+	}
+	return ret;
+}
+  800ab1:	89 f0                	mov    %esi,%eax
+  800ab3:	5b                   	pop    %ebx
+  800ab4:	5e                   	pop    %esi
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+
+00800ab7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	56                   	push   %esi
+  800abb:	53                   	push   %ebx
+  800abc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800abf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ac5:	89 f0                	mov    %esi,%eax
+  800ac7:	85 db                	test   %ebx,%ebx
+  800ac9:	74 1e                	je     800ae9 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800acb:	83 eb 01             	sub    $0x1,%ebx
+  800ace:	74 16                	je     800ae6 <strlcpy+0x2f>
+  800ad0:	01 f3                	add    %esi,%ebx
+  800ad2:	0f b6 0a             	movzbl (%edx),%ecx
+  800ad5:	84 c9                	test   %cl,%cl
+  800ad7:	74 0d                	je     800ae6 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800ad9:	83 c2 01             	add    $0x1,%edx
+  800adc:	83 c0 01             	add    $0x1,%eax
+  800adf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ae2:	39 d8                	cmp    %ebx,%eax
+  800ae4:	75 ec                	jne    800ad2 <strlcpy+0x1b>
+		*dst = '\0';
+  800ae6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ae9:	29 f0                	sub    %esi,%eax
+}
+  800aeb:	5b                   	pop    %ebx
+  800aec:	5e                   	pop    %esi
+  800aed:	5d                   	pop    %ebp
+  800aee:	c3                   	ret
+
+00800aef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aef:	55                   	push   %ebp
+  800af0:	89 e5                	mov    %esp,%ebp
+  800af2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800af8:	0f b6 01             	movzbl (%ecx),%eax
+  800afb:	84 c0                	test   %al,%al
+  800afd:	74 11                	je     800b10 <strcmp+0x21>
+  800aff:	38 02                	cmp    %al,(%edx)
+  800b01:	75 0d                	jne    800b10 <strcmp+0x21>
+		p++, q++;
+  800b03:	83 c1 01             	add    $0x1,%ecx
+  800b06:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b09:	0f b6 01             	movzbl (%ecx),%eax
+  800b0c:	84 c0                	test   %al,%al
+  800b0e:	75 ef                	jne    800aff <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b10:	0f b6 c0             	movzbl %al,%eax
+  800b13:	0f b6 12             	movzbl (%edx),%edx
+  800b16:	29 d0                	sub    %edx,%eax
+}
+  800b18:	5d                   	pop    %ebp
+  800b19:	c3                   	ret
+
+00800b1a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	53                   	push   %ebx
+  800b1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b24:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800b2c:	85 d2                	test   %edx,%edx
+  800b2e:	74 2e                	je     800b5e <strncmp+0x44>
+  800b30:	0f b6 01             	movzbl (%ecx),%eax
+  800b33:	84 c0                	test   %al,%al
+  800b35:	74 16                	je     800b4d <strncmp+0x33>
+  800b37:	3a 03                	cmp    (%ebx),%al
+  800b39:	75 12                	jne    800b4d <strncmp+0x33>
+		n--, p++, q++;
+  800b3b:	83 c1 01             	add    $0x1,%ecx
+  800b3e:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b41:	83 ea 01             	sub    $0x1,%edx
+  800b44:	75 ea                	jne    800b30 <strncmp+0x16>
+		return 0;
+  800b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4b:	eb 11                	jmp    800b5e <strncmp+0x44>
+  800b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b52:	85 d2                	test   %edx,%edx
+  800b54:	74 08                	je     800b5e <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b56:	0f b6 01             	movzbl (%ecx),%eax
+  800b59:	0f b6 13             	movzbl (%ebx),%edx
+  800b5c:	29 d0                	sub    %edx,%eax
+}
+  800b5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b61:	c9                   	leave
+  800b62:	c3                   	ret
+
+00800b63 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b6d:	0f b6 10             	movzbl (%eax),%edx
+  800b70:	84 d2                	test   %dl,%dl
+  800b72:	74 15                	je     800b89 <strchr+0x26>
+		if (*s == c)
+  800b74:	38 d1                	cmp    %dl,%cl
+  800b76:	74 0f                	je     800b87 <strchr+0x24>
+	for (; *s; s++)
+  800b78:	83 c0 01             	add    $0x1,%eax
+  800b7b:	0f b6 10             	movzbl (%eax),%edx
+  800b7e:	84 d2                	test   %dl,%dl
+  800b80:	75 f2                	jne    800b74 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800b82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b87:	5d                   	pop    %ebp
+  800b88:	c3                   	ret
+	return 0;
+  800b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8e:	eb f7                	jmp    800b87 <strchr+0x24>
+
+00800b90 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	53                   	push   %ebx
+  800b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b97:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b9a:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b9d:	38 d3                	cmp    %dl,%bl
+  800b9f:	74 14                	je     800bb5 <strfind+0x25>
+  800ba1:	89 d1                	mov    %edx,%ecx
+  800ba3:	84 db                	test   %bl,%bl
+  800ba5:	74 0e                	je     800bb5 <strfind+0x25>
+	for (; *s; s++)
+  800ba7:	83 c0 01             	add    $0x1,%eax
+  800baa:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bad:	38 ca                	cmp    %cl,%dl
+  800baf:	74 04                	je     800bb5 <strfind+0x25>
+  800bb1:	84 d2                	test   %dl,%dl
+  800bb3:	75 f2                	jne    800ba7 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800bb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bb8:	c9                   	leave
+  800bb9:	c3                   	ret
+
+00800bba <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	57                   	push   %edi
+  800bbe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bc1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bc4:	85 c9                	test   %ecx,%ecx
+  800bc6:	74 20                	je     800be8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bc8:	89 f8                	mov    %edi,%eax
+  800bca:	09 c8                	or     %ecx,%eax
+  800bcc:	a8 03                	test   $0x3,%al
+  800bce:	75 12                	jne    800be2 <memset+0x28>
+		c &= 0xFF;
+  800bd0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bd4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bda:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bdd:	fc                   	cld
+  800bde:	f3 ab                	rep stos %eax,%es:(%edi)
+  800be0:	eb 06                	jmp    800be8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800be2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be5:	fc                   	cld
+  800be6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800be8:	89 f8                	mov    %edi,%eax
+  800bea:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bed:	c9                   	leave
+  800bee:	c3                   	ret
+
+00800bef <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	57                   	push   %edi
+  800bf3:	56                   	push   %esi
+  800bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bfa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bfd:	39 c6                	cmp    %eax,%esi
+  800bff:	73 32                	jae    800c33 <memmove+0x44>
+  800c01:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c04:	39 d0                	cmp    %edx,%eax
+  800c06:	73 2b                	jae    800c33 <memmove+0x44>
+		s += n;
+		d += n;
+  800c08:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c0b:	89 d6                	mov    %edx,%esi
+  800c0d:	09 fe                	or     %edi,%esi
+  800c0f:	09 ce                	or     %ecx,%esi
+  800c11:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c17:	75 0e                	jne    800c27 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c19:	83 ef 04             	sub    $0x4,%edi
+  800c1c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c1f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c22:	fd                   	std
+  800c23:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c25:	eb 09                	jmp    800c30 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c27:	83 ef 01             	sub    $0x1,%edi
+  800c2a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c2d:	fd                   	std
+  800c2e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c30:	fc                   	cld
+  800c31:	eb 1a                	jmp    800c4d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c33:	89 f2                	mov    %esi,%edx
+  800c35:	09 c2                	or     %eax,%edx
+  800c37:	09 ca                	or     %ecx,%edx
+  800c39:	f6 c2 03             	test   $0x3,%dl
+  800c3c:	75 0a                	jne    800c48 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c3e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c41:	89 c7                	mov    %eax,%edi
+  800c43:	fc                   	cld
+  800c44:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c46:	eb 05                	jmp    800c4d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c48:	89 c7                	mov    %eax,%edi
+  800c4a:	fc                   	cld
+  800c4b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c4d:	5e                   	pop    %esi
+  800c4e:	5f                   	pop    %edi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	c3                   	ret
+
+00800c51 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c51:	55                   	push   %ebp
+  800c52:	89 e5                	mov    %esp,%ebp
+  800c54:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c57:	ff 75 10             	push   0x10(%ebp)
+  800c5a:	ff 75 0c             	push   0xc(%ebp)
+  800c5d:	ff 75 08             	push   0x8(%ebp)
+  800c60:	e8 8a ff ff ff       	call   800bef <memmove>
+}
+  800c65:	c9                   	leave
+  800c66:	c3                   	ret
+
+00800c67 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	56                   	push   %esi
+  800c6b:	53                   	push   %ebx
+  800c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c72:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c75:	85 f6                	test   %esi,%esi
+  800c77:	74 29                	je     800ca2 <memcmp+0x3b>
+  800c79:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800c7b:	0f b6 08             	movzbl (%eax),%ecx
+  800c7e:	0f b6 1a             	movzbl (%edx),%ebx
+  800c81:	38 d9                	cmp    %bl,%cl
+  800c83:	75 11                	jne    800c96 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c85:	83 c0 01             	add    $0x1,%eax
+  800c88:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c8b:	39 c6                	cmp    %eax,%esi
+  800c8d:	75 ec                	jne    800c7b <memcmp+0x14>
+	}
+
+	return 0;
+  800c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c94:	eb 08                	jmp    800c9e <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c96:	0f b6 c1             	movzbl %cl,%eax
+  800c99:	0f b6 db             	movzbl %bl,%ebx
+  800c9c:	29 d8                	sub    %ebx,%eax
+}
+  800c9e:	5b                   	pop    %ebx
+  800c9f:	5e                   	pop    %esi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+	return 0;
+  800ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca7:	eb f5                	jmp    800c9e <memcmp+0x37>
+
+00800ca9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ca9:	55                   	push   %ebp
+  800caa:	89 e5                	mov    %esp,%ebp
+  800cac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800caf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cb2:	89 c2                	mov    %eax,%edx
+  800cb4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cb7:	39 d0                	cmp    %edx,%eax
+  800cb9:	73 0d                	jae    800cc8 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cbb:	38 08                	cmp    %cl,(%eax)
+  800cbd:	74 0d                	je     800ccc <memfind+0x23>
+	for (; s < ends; s++)
+  800cbf:	83 c0 01             	add    $0x1,%eax
+  800cc2:	39 c2                	cmp    %eax,%edx
+  800cc4:	75 f5                	jne    800cbb <memfind+0x12>
+  800cc6:	eb 06                	jmp    800cce <memfind+0x25>
+  800cc8:	89 c2                	mov    %eax,%edx
+  800cca:	eb 02                	jmp    800cce <memfind+0x25>
+  800ccc:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800cce:	89 d0                	mov    %edx,%eax
+  800cd0:	5d                   	pop    %ebp
+  800cd1:	c3                   	ret
+
+00800cd2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cd2:	55                   	push   %ebp
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	57                   	push   %edi
+  800cd6:	56                   	push   %esi
+  800cd7:	53                   	push   %ebx
+  800cd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cde:	0f b6 02             	movzbl (%edx),%eax
+  800ce1:	3c 20                	cmp    $0x20,%al
+  800ce3:	74 04                	je     800ce9 <strtol+0x17>
+  800ce5:	3c 09                	cmp    $0x9,%al
+  800ce7:	75 0e                	jne    800cf7 <strtol+0x25>
+		s++;
+  800ce9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cec:	0f b6 02             	movzbl (%edx),%eax
+  800cef:	3c 20                	cmp    $0x20,%al
+  800cf1:	74 f6                	je     800ce9 <strtol+0x17>
+  800cf3:	3c 09                	cmp    $0x9,%al
+  800cf5:	74 f2                	je     800ce9 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cf7:	3c 2b                	cmp    $0x2b,%al
+  800cf9:	74 2a                	je     800d25 <strtol+0x53>
+	int neg = 0;
+  800cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d00:	3c 2d                	cmp    $0x2d,%al
+  800d02:	74 2b                	je     800d2f <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d04:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d0a:	75 0f                	jne    800d1b <strtol+0x49>
+  800d0c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d0f:	74 28                	je     800d39 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d11:	85 db                	test   %ebx,%ebx
+  800d13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d18:	0f 44 d8             	cmove  %eax,%ebx
+  800d1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d20:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d23:	eb 46                	jmp    800d6b <strtol+0x99>
+		s++;
+  800d25:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d2d:	eb d5                	jmp    800d04 <strtol+0x32>
+		s++, neg = 1;
+  800d2f:	83 c2 01             	add    $0x1,%edx
+  800d32:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d37:	eb cb                	jmp    800d04 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d39:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d3d:	74 0e                	je     800d4d <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d3f:	85 db                	test   %ebx,%ebx
+  800d41:	75 d8                	jne    800d1b <strtol+0x49>
+		s++, base = 8;
+  800d43:	83 c2 01             	add    $0x1,%edx
+  800d46:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d4b:	eb ce                	jmp    800d1b <strtol+0x49>
+		s += 2, base = 16;
+  800d4d:	83 c2 02             	add    $0x2,%edx
+  800d50:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d55:	eb c4                	jmp    800d1b <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d57:	0f be c0             	movsbl %al,%eax
+  800d5a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d5d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d60:	7d 3a                	jge    800d9c <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d62:	83 c2 01             	add    $0x1,%edx
+  800d65:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d69:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d6b:	0f b6 02             	movzbl (%edx),%eax
+  800d6e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d71:	89 f3                	mov    %esi,%ebx
+  800d73:	80 fb 09             	cmp    $0x9,%bl
+  800d76:	76 df                	jbe    800d57 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800d78:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d7b:	89 f3                	mov    %esi,%ebx
+  800d7d:	80 fb 19             	cmp    $0x19,%bl
+  800d80:	77 08                	ja     800d8a <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800d82:	0f be c0             	movsbl %al,%eax
+  800d85:	83 e8 57             	sub    $0x57,%eax
+  800d88:	eb d3                	jmp    800d5d <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d8a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d8d:	89 f3                	mov    %esi,%ebx
+  800d8f:	80 fb 19             	cmp    $0x19,%bl
+  800d92:	77 08                	ja     800d9c <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d94:	0f be c0             	movsbl %al,%eax
+  800d97:	83 e8 37             	sub    $0x37,%eax
+  800d9a:	eb c1                	jmp    800d5d <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800da0:	74 05                	je     800da7 <strtol+0xd5>
+		*endptr = (char *) s;
+  800da2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800da5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800da7:	89 c8                	mov    %ecx,%eax
+  800da9:	f7 d8                	neg    %eax
+  800dab:	85 ff                	test   %edi,%edi
+  800dad:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800db0:	89 c8                	mov    %ecx,%eax
+  800db2:	5b                   	pop    %ebx
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+
+00800db7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	89 c3                	mov    %eax,%ebx
+  800dca:	89 c7                	mov    %eax,%edi
+  800dcc:	89 c6                	mov    %eax,%esi
+  800dce:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+
+00800dd5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800de5:	89 d1                	mov    %edx,%ecx
+  800de7:	89 d3                	mov    %edx,%ebx
+  800de9:	89 d7                	mov    %edx,%edi
+  800deb:	89 d6                	mov    %edx,%esi
+  800ded:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e05:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e0a:	89 cb                	mov    %ecx,%ebx
+  800e0c:	89 cf                	mov    %ecx,%edi
+  800e0e:	89 ce                	mov    %ecx,%esi
+  800e10:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 08                	jg     800e1e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 03                	push   $0x3
+  800e24:	68 4b 49 80 00       	push   $0x80494b
+  800e29:	6a 23                	push   $0x23
+  800e2b:	68 68 49 80 00       	push   $0x804968
+  800e30:	e8 38 f4 ff ff       	call   80026d <_panic>
+
+00800e35 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e40:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e45:	89 d1                	mov    %edx,%ecx
+  800e47:	89 d3                	mov    %edx,%ebx
+  800e49:	89 d7                	mov    %edx,%edi
+  800e4b:	89 d6                	mov    %edx,%esi
+  800e4d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e4f:	5b                   	pop    %ebx
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+
+00800e54 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e64:	89 d1                	mov    %edx,%ecx
+  800e66:	89 d3                	mov    %edx,%ebx
+  800e68:	89 d7                	mov    %edx,%edi
+  800e6a:	89 d6                	mov    %edx,%esi
+  800e6c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e87:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8f:	89 f7                	mov    %esi,%edi
+  800e91:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 08                	jg     800e9f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	50                   	push   %eax
+  800ea3:	6a 04                	push   $0x4
+  800ea5:	68 4b 49 80 00       	push   $0x80494b
+  800eaa:	6a 23                	push   $0x23
+  800eac:	68 68 49 80 00       	push   $0x804968
+  800eb1:	e8 b7 f3 ff ff       	call   80026d <_panic>
+
+00800eb6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ed3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed5:	85 c0                	test   %eax,%eax
+  800ed7:	7f 08                	jg     800ee1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+  800ee4:	50                   	push   %eax
+  800ee5:	6a 05                	push   $0x5
+  800ee7:	68 4b 49 80 00       	push   $0x80494b
+  800eec:	6a 23                	push   $0x23
+  800eee:	68 68 49 80 00       	push   $0x804968
+  800ef3:	e8 75 f3 ff ff       	call   80026d <_panic>
+
+00800ef8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	57                   	push   %edi
+  800efc:	56                   	push   %esi
+  800efd:	53                   	push   %ebx
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f11:	89 df                	mov    %ebx,%edi
+  800f13:	89 de                	mov    %ebx,%esi
+  800f15:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f17:	85 c0                	test   %eax,%eax
+  800f19:	7f 08                	jg     800f23 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f23:	83 ec 0c             	sub    $0xc,%esp
+  800f26:	50                   	push   %eax
+  800f27:	6a 06                	push   $0x6
+  800f29:	68 4b 49 80 00       	push   $0x80494b
+  800f2e:	6a 23                	push   $0x23
+  800f30:	68 68 49 80 00       	push   $0x804968
+  800f35:	e8 33 f3 ff ff       	call   80026d <_panic>
+
+00800f3a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	57                   	push   %edi
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+  800f40:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f53:	89 df                	mov    %ebx,%edi
+  800f55:	89 de                	mov    %ebx,%esi
+  800f57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f59:	85 c0                	test   %eax,%eax
+  800f5b:	7f 08                	jg     800f65 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	50                   	push   %eax
+  800f69:	6a 08                	push   $0x8
+  800f6b:	68 4b 49 80 00       	push   $0x80494b
+  800f70:	6a 23                	push   $0x23
+  800f72:	68 68 49 80 00       	push   $0x804968
+  800f77:	e8 f1 f2 ff ff       	call   80026d <_panic>
+
+00800f7c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f95:	89 df                	mov    %ebx,%edi
+  800f97:	89 de                	mov    %ebx,%esi
+  800f99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	7f 08                	jg     800fa7 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+  800faa:	50                   	push   %eax
+  800fab:	6a 09                	push   $0x9
+  800fad:	68 4b 49 80 00       	push   $0x80494b
+  800fb2:	6a 23                	push   $0x23
+  800fb4:	68 68 49 80 00       	push   $0x804968
+  800fb9:	e8 af f2 ff ff       	call   80026d <_panic>
+
+00800fbe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd7:	89 df                	mov    %ebx,%edi
+  800fd9:	89 de                	mov    %ebx,%esi
+  800fdb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	7f 08                	jg     800fe9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	50                   	push   %eax
+  800fed:	6a 0a                	push   $0xa
+  800fef:	68 4b 49 80 00       	push   $0x80494b
+  800ff4:	6a 23                	push   $0x23
+  800ff6:	68 68 49 80 00       	push   $0x804968
+  800ffb:	e8 6d f2 ff ff       	call   80026d <_panic>
+
+00801000 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801011:	be 00 00 00 00       	mov    $0x0,%esi
+  801016:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801019:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+
+00801023 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801023:	55                   	push   %ebp
+  801024:	89 e5                	mov    %esp,%ebp
+  801026:	57                   	push   %edi
+  801027:	56                   	push   %esi
+  801028:	53                   	push   %ebx
+  801029:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80102c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+  801034:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801039:	89 cb                	mov    %ecx,%ebx
+  80103b:	89 cf                	mov    %ecx,%edi
+  80103d:	89 ce                	mov    %ecx,%esi
+  80103f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801041:	85 c0                	test   %eax,%eax
+  801043:	7f 08                	jg     80104d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801048:	5b                   	pop    %ebx
+  801049:	5e                   	pop    %esi
+  80104a:	5f                   	pop    %edi
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104d:	83 ec 0c             	sub    $0xc,%esp
+  801050:	50                   	push   %eax
+  801051:	6a 0d                	push   $0xd
+  801053:	68 4b 49 80 00       	push   $0x80494b
+  801058:	6a 23                	push   $0x23
+  80105a:	68 68 49 80 00       	push   $0x804968
+  80105f:	e8 09 f2 ff ff       	call   80026d <_panic>
+
+00801064 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	57                   	push   %edi
+  801068:	56                   	push   %esi
+  801069:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801070:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801075:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801078:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80107b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80107e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801080:	5b                   	pop    %ebx
+  801081:	5e                   	pop    %esi
+  801082:	5f                   	pop    %edi
+  801083:	5d                   	pop    %ebp
+  801084:	c3                   	ret
+
+00801085 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	57                   	push   %edi
+  801089:	56                   	push   %esi
+  80108a:	53                   	push   %ebx
+  80108b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80108e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80109e:	89 df                	mov    %ebx,%edi
+  8010a0:	89 de                	mov    %ebx,%esi
+  8010a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a4:	85 c0                	test   %eax,%eax
+  8010a6:	7f 08                	jg     8010b0 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8010a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5e                   	pop    %esi
+  8010ad:	5f                   	pop    %edi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b0:	83 ec 0c             	sub    $0xc,%esp
+  8010b3:	50                   	push   %eax
+  8010b4:	6a 0d                	push   $0xd
+  8010b6:	68 4b 49 80 00       	push   $0x80494b
+  8010bb:	6a 23                	push   $0x23
+  8010bd:	68 68 49 80 00       	push   $0x804968
+  8010c2:	e8 a6 f1 ff ff       	call   80026d <_panic>
+
+008010c7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010d7:	89 d1                	mov    %edx,%ecx
+  8010d9:	89 d3                	mov    %edx,%ebx
+  8010db:	89 d7                	mov    %edx,%edi
+  8010dd:	89 d6                	mov    %edx,%esi
+  8010df:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010e1:	5b                   	pop    %ebx
+  8010e2:	5e                   	pop    %esi
+  8010e3:	5f                   	pop    %edi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	c3                   	ret
+
+008010e6 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8010e6:	55                   	push   %ebp
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	57                   	push   %edi
+  8010ea:	56                   	push   %esi
+  8010eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010fc:	89 df                	mov    %ebx,%edi
+  8010fe:	89 de                	mov    %ebx,%esi
+  801100:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801102:	5b                   	pop    %ebx
+  801103:	5e                   	pop    %esi
+  801104:	5f                   	pop    %edi
+  801105:	5d                   	pop    %ebp
+  801106:	c3                   	ret
+
+00801107 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	57                   	push   %edi
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801112:	8b 55 08             	mov    0x8(%ebp),%edx
+  801115:	b8 10 00 00 00       	mov    $0x10,%eax
+  80111a:	89 cb                	mov    %ecx,%ebx
+  80111c:	89 cf                	mov    %ecx,%edi
+  80111e:	89 ce                	mov    %ecx,%esi
+  801120:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801122:	5b                   	pop    %ebx
+  801123:	5e                   	pop    %esi
+  801124:	5f                   	pop    %edi
+  801125:	5d                   	pop    %ebp
+  801126:	c3                   	ret
+
+00801127 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	57                   	push   %edi
+  80112b:	56                   	push   %esi
+  80112c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801132:	8b 55 08             	mov    0x8(%ebp),%edx
+  801135:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801138:	b8 11 00 00 00       	mov    $0x11,%eax
+  80113d:	89 df                	mov    %ebx,%edi
+  80113f:	89 de                	mov    %ebx,%esi
+  801141:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801153:	8b 55 08             	mov    0x8(%ebp),%edx
+  801156:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801159:	b8 12 00 00 00       	mov    $0x12,%eax
+  80115e:	89 df                	mov    %ebx,%edi
+  801160:	89 de                	mov    %ebx,%esi
+  801162:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801164:	5b                   	pop    %ebx
+  801165:	5e                   	pop    %esi
+  801166:	5f                   	pop    %edi
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+
+00801169 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	57                   	push   %edi
+  80116d:	56                   	push   %esi
+  80116e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801174:	8b 55 08             	mov    0x8(%ebp),%edx
+  801177:	b8 13 00 00 00       	mov    $0x13,%eax
+  80117c:	89 cb                	mov    %ecx,%ebx
+  80117e:	89 cf                	mov    %ecx,%edi
+  801180:	89 ce                	mov    %ecx,%esi
+  801182:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80119f:	89 df                	mov    %ebx,%edi
+  8011a1:	89 de                	mov    %ebx,%esi
+  8011a3:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+
+008011aa <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8011aa:	55                   	push   %ebp
+  8011ab:	89 e5                	mov    %esp,%ebp
+  8011ad:	57                   	push   %edi
+  8011ae:	56                   	push   %esi
+  8011af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011bd:	89 cb                	mov    %ecx,%ebx
+  8011bf:	89 cf                	mov    %ecx,%edi
+  8011c1:	89 ce                	mov    %ecx,%esi
+  8011c3:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8011c5:	5b                   	pop    %ebx
+  8011c6:	5e                   	pop    %esi
+  8011c7:	5f                   	pop    %edi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	c3                   	ret
+
+008011ca <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011db:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e3:	89 f7                	mov    %esi,%edi
+  8011e5:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+
+008011ec <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	57                   	push   %edi
+  8011f0:	56                   	push   %esi
+  8011f1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fd:	b8 17 00 00 00       	mov    $0x17,%eax
+  801202:	89 df                	mov    %ebx,%edi
+  801204:	89 de                	mov    %ebx,%esi
+  801206:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801208:	5b                   	pop    %ebx
+  801209:	5e                   	pop    %esi
+  80120a:	5f                   	pop    %edi
+  80120b:	5d                   	pop    %ebp
+  80120c:	c3                   	ret
+
+0080120d <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80120d:	55                   	push   %ebp
+  80120e:	89 e5                	mov    %esp,%ebp
+  801210:	57                   	push   %edi
+  801211:	56                   	push   %esi
+  801212:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801213:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801220:	89 cb                	mov    %ecx,%ebx
+  801222:	89 cf                	mov    %ecx,%edi
+  801224:	89 ce                	mov    %ecx,%esi
+  801226:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801228:	5b                   	pop    %ebx
+  801229:	5e                   	pop    %esi
+  80122a:	5f                   	pop    %edi
+  80122b:	5d                   	pop    %ebp
+  80122c:	c3                   	ret
+
+0080122d <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80122d:	55                   	push   %ebp
+  80122e:	89 e5                	mov    %esp,%ebp
+  801230:	57                   	push   %edi
+  801231:	56                   	push   %esi
+  801232:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801233:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801237:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801244:	89 df                	mov    %ebx,%edi
+  801246:	89 de                	mov    %ebx,%esi
+  801248:	cd 30                	int    $0x30
+}
+  80124a:	5b                   	pop    %ebx
+  80124b:	5e                   	pop    %esi
+  80124c:	5f                   	pop    %edi
+  80124d:	5d                   	pop    %ebp
+  80124e:	c3                   	ret
+
+0080124f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80124f:	55                   	push   %ebp
+  801250:	89 e5                	mov    %esp,%ebp
+  801252:	57                   	push   %edi
+  801253:	56                   	push   %esi
+  801254:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801255:	be 00 00 00 00       	mov    $0x0,%esi
+  80125a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801260:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801265:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801268:	89 f7                	mov    %esi,%edi
+  80126a:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80126c:	5b                   	pop    %ebx
+  80126d:	5e                   	pop    %esi
+  80126e:	5f                   	pop    %edi
+  80126f:	5d                   	pop    %ebp
+  801270:	c3                   	ret
+
+00801271 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801271:	55                   	push   %ebp
+  801272:	89 e5                	mov    %esp,%ebp
+  801274:	57                   	push   %edi
+  801275:	56                   	push   %esi
+  801276:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801277:	be 00 00 00 00       	mov    $0x0,%esi
+  80127c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801282:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801287:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80128a:	89 f7                	mov    %esi,%edi
+  80128c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80128e:	5b                   	pop    %ebx
+  80128f:	5e                   	pop    %esi
+  801290:	5f                   	pop    %edi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+
+00801293 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+  801296:	57                   	push   %edi
+  801297:	56                   	push   %esi
+  801298:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012a9:	89 df                	mov    %ebx,%edi
+  8012ab:	89 de                	mov    %ebx,%esi
+  8012ad:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012af:	5b                   	pop    %ebx
+  8012b0:	5e                   	pop    %esi
+  8012b1:	5f                   	pop    %edi
+  8012b2:	5d                   	pop    %ebp
+  8012b3:	c3                   	ret
+
+008012b4 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8012b4:	55                   	push   %ebp
+  8012b5:	89 e5                	mov    %esp,%ebp
+  8012b7:	57                   	push   %edi
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012cd:	89 f7                	mov    %esi,%edi
+  8012cf:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+
+008012d6 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012d6:	85 c0                	test   %eax,%eax
+  8012d8:	74 20                	je     8012fa <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8012da:	89 c1                	mov    %eax,%ecx
+  8012dc:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012e2:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8012e8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8012ee:	8b 52 48             	mov    0x48(%edx),%edx
+  8012f1:	39 c2                	cmp    %eax,%edx
+  8012f3:	74 06                	je     8012fb <thread_alive+0x25>
+  8012f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012fa:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012fb:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801301:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801307:	85 c0                	test   %eax,%eax
+  801309:	0f 95 c0             	setne  %al
+  80130c:	0f b6 c0             	movzbl %al,%eax
+  80130f:	c3                   	ret
+
+00801310 <pgfault>:
+{
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	57                   	push   %edi
+  801314:	56                   	push   %esi
+  801315:	53                   	push   %ebx
+  801316:	83 ec 0c             	sub    $0xc,%esp
+  801319:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80131c:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  80131e:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801321:	89 f3                	mov    %esi,%ebx
+  801323:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801326:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80132d:	74 52                	je     801381 <pgfault+0x71>
+  80132f:	a8 02                	test   $0x2,%al
+  801331:	75 14                	jne    801347 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801333:	83 ec 04             	sub    $0x4,%esp
+  801336:	68 76 49 80 00       	push   $0x804976
+  80133b:	6a 2e                	push   $0x2e
+  80133d:	68 94 49 80 00       	push   $0x804994
+  801342:	e8 26 ef ff ff       	call   80026d <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801347:	89 d8                	mov    %ebx,%eax
+  801349:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80134e:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801355:	83 ec 0c             	sub    $0xc,%esp
+  801358:	57                   	push   %edi
+  801359:	e8 3b 2c 00 00       	call   803f99 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80135e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801365:	83 e0 03             	and    $0x3,%eax
+  801368:	83 c4 10             	add    $0x10,%esp
+  80136b:	83 f8 03             	cmp    $0x3,%eax
+  80136e:	75 1a                	jne    80138a <pgfault+0x7a>
+			mutex_unlock(m);
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	57                   	push   %edi
+  801374:	e8 8e 2c 00 00       	call   804007 <mutex_unlock>
+			return;
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	e9 9f 00 00 00       	jmp    801420 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801381:	a8 02                	test   $0x2,%al
+  801383:	74 ae                	je     801333 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801385:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80138a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801391:	f6 c4 08             	test   $0x8,%ah
+  801394:	74 9d                	je     801333 <pgfault+0x23>
+  801396:	89 e0                	mov    %esp,%eax
+  801398:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80139d:	29 c2                	sub    %eax,%edx
+  80139f:	89 d0                	mov    %edx,%eax
+  8013a1:	c1 e8 0f             	shr    $0xf,%eax
+  8013a4:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8013aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013af:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8013b2:	c1 e0 0c             	shl    $0xc,%eax
+  8013b5:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8013ba:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8013bc:	83 ec 04             	sub    $0x4,%esp
+  8013bf:	6a 07                	push   $0x7
+  8013c1:	53                   	push   %ebx
+  8013c2:	6a 00                	push   $0x0
+  8013c4:	e8 aa fa ff ff       	call   800e73 <sys_page_alloc>
+  8013c9:	83 c4 10             	add    $0x10,%esp
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	78 58                	js     801428 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8013d0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8013d6:	83 ec 04             	sub    $0x4,%esp
+  8013d9:	68 00 10 00 00       	push   $0x1000
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+  8013e0:	e8 0a f8 ff ff       	call   800bef <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8013e5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8013ec:	56                   	push   %esi
+  8013ed:	6a 00                	push   $0x0
+  8013ef:	53                   	push   %ebx
+  8013f0:	6a 00                	push   $0x0
+  8013f2:	e8 bf fa ff ff       	call   800eb6 <sys_page_map>
+  8013f7:	83 c4 20             	add    $0x20,%esp
+  8013fa:	85 c0                	test   %eax,%eax
+  8013fc:	78 3c                	js     80143a <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8013fe:	83 ec 08             	sub    $0x8,%esp
+  801401:	53                   	push   %ebx
+  801402:	6a 00                	push   $0x0
+  801404:	e8 ef fa ff ff       	call   800ef8 <sys_page_unmap>
+  801409:	83 c4 10             	add    $0x10,%esp
+  80140c:	85 c0                	test   %eax,%eax
+  80140e:	78 3c                	js     80144c <pgfault+0x13c>
+	if(m)
+  801410:	85 ff                	test   %edi,%edi
+  801412:	74 0c                	je     801420 <pgfault+0x110>
+		mutex_unlock(m);
+  801414:	83 ec 0c             	sub    $0xc,%esp
+  801417:	57                   	push   %edi
+  801418:	e8 ea 2b 00 00       	call   804007 <mutex_unlock>
+  80141d:	83 c4 10             	add    $0x10,%esp
+}
+  801420:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801423:	5b                   	pop    %ebx
+  801424:	5e                   	pop    %esi
+  801425:	5f                   	pop    %edi
+  801426:	5d                   	pop    %ebp
+  801427:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801428:	50                   	push   %eax
+  801429:	68 9f 49 80 00       	push   $0x80499f
+  80142e:	6a 3d                	push   $0x3d
+  801430:	68 94 49 80 00       	push   $0x804994
+  801435:	e8 33 ee ff ff       	call   80026d <_panic>
+		panic("sys_page_map: %e", ret);
+  80143a:	50                   	push   %eax
+  80143b:	68 b2 49 80 00       	push   $0x8049b2
+  801440:	6a 40                	push   $0x40
+  801442:	68 94 49 80 00       	push   $0x804994
+  801447:	e8 21 ee ff ff       	call   80026d <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80144c:	50                   	push   %eax
+  80144d:	68 c3 49 80 00       	push   $0x8049c3
+  801452:	6a 42                	push   $0x42
+  801454:	68 94 49 80 00       	push   $0x804994
+  801459:	e8 0f ee ff ff       	call   80026d <_panic>
+
+0080145e <thread_main>:
+{
+  80145e:	55                   	push   %ebp
+  80145f:	89 e5                	mov    %esp,%ebp
+  801461:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801464:	ff 75 0c             	push   0xc(%ebp)
+  801467:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80146a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801471:	e8 7e f9 ff ff       	call   800df4 <sys_env_destroy>
+}
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	c9                   	leave
+  80147a:	c3                   	ret
+
+0080147b <fork>:
+{
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	57                   	push   %edi
+  80147f:	56                   	push   %esi
+  801480:	53                   	push   %ebx
+  801481:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801484:	68 10 13 80 00       	push   $0x801310
+  801489:	e8 57 2e 00 00       	call   8042e5 <set_pgfault_handler>
+	if(sforked)
+  80148e:	83 c4 10             	add    $0x10,%esp
+  801491:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801498:	75 33                	jne    8014cd <fork+0x52>
+	__asm __volatile("int %2"
+  80149a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80149f:	cd 30                	int    $0x30
+  8014a1:	89 c7                	mov    %eax,%edi
+  8014a3:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8014a5:	85 c0                	test   %eax,%eax
+  8014a7:	0f 88 b4 00 00 00    	js     801561 <fork+0xe6>
+	if(envid == 0) {
+  8014ad:	0f 84 c3 00 00 00    	je     801576 <fork+0xfb>
+	pgbatch_init(&pb);
+  8014b3:	83 ec 0c             	sub    $0xc,%esp
+  8014b6:	68 20 63 80 00       	push   $0x806320
+  8014bb:	e8 25 29 00 00       	call   803de5 <pgbatch_init>
+  8014c0:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8014c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c8:	e9 9c 01 00 00       	jmp    801669 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8014cd:	83 ec 0c             	sub    $0xc,%esp
+  8014d0:	68 c0 66 80 00       	push   $0x8066c0
+  8014d5:	e8 bf 2a 00 00       	call   803f99 <mutex_lock>
+  8014da:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8014dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8014e2:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8014e7:	eb 08                	jmp    8014f1 <fork+0x76>
+  8014e9:	83 c3 01             	add    $0x1,%ebx
+  8014ec:	83 fb 20             	cmp    $0x20,%ebx
+  8014ef:	74 5b                	je     80154c <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8014f1:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  8014f8:	89 f0                	mov    %esi,%eax
+  8014fa:	e8 d7 fd ff ff       	call   8012d6 <thread_alive>
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	74 e6                	je     8014e9 <fork+0x6e>
+  801503:	89 e0                	mov    %esp,%eax
+  801505:	89 fa                	mov    %edi,%edx
+  801507:	29 c2                	sub    %eax,%edx
+  801509:	89 d0                	mov    %edx,%eax
+  80150b:	c1 e8 0f             	shr    $0xf,%eax
+  80150e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801514:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801519:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80151c:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801523:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801526:	83 ec 08             	sub    $0x8,%esp
+  801529:	50                   	push   %eax
+  80152a:	56                   	push   %esi
+  80152b:	e8 8e fa ff ff       	call   800fbe <sys_env_set_pgfault_upcall>
+  801530:	83 c4 10             	add    $0x10,%esp
+  801533:	85 c0                	test   %eax,%eax
+  801535:	79 b2                	jns    8014e9 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801537:	50                   	push   %eax
+  801538:	68 50 4a 80 00       	push   $0x804a50
+  80153d:	68 00 01 00 00       	push   $0x100
+  801542:	68 94 49 80 00       	push   $0x804994
+  801547:	e8 21 ed ff ff       	call   80026d <_panic>
+	mutex_unlock(&sfork_lock);
+  80154c:	83 ec 0c             	sub    $0xc,%esp
+  80154f:	68 c0 66 80 00       	push   $0x8066c0
+  801554:	e8 ae 2a 00 00       	call   804007 <mutex_unlock>
+}
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	e9 39 ff ff ff       	jmp    80149a <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801561:	50                   	push   %eax
+  801562:	68 d6 49 80 00       	push   $0x8049d6
+  801567:	68 91 00 00 00       	push   $0x91
+  80156c:	68 94 49 80 00       	push   $0x804994
+  801571:	e8 f7 ec ff ff       	call   80026d <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801576:	e8 ba f8 ff ff       	call   800e35 <sys_getenvid>
+  80157b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801580:	89 e1                	mov    %esp,%ecx
+  801582:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801587:	29 ca                	sub    %ecx,%edx
+  801589:	89 d1                	mov    %edx,%ecx
+  80158b:	c1 e9 0f             	shr    $0xf,%ecx
+  80158e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801594:	ba 00 00 00 00       	mov    $0x0,%edx
+  801599:	0f 42 d1             	cmovb  %ecx,%edx
+  80159c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8015a2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015a7:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  8015ae:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	75 07                	jne    8015be <fork+0x143>
+		return 0;
+  8015b7:	89 c6                	mov    %eax,%esi
+  8015b9:	e9 6f 02 00 00       	jmp    80182d <fork+0x3b2>
+  8015be:	89 e2                	mov    %esp,%edx
+  8015c0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015c5:	29 d0                	sub    %edx,%eax
+  8015c7:	89 c3                	mov    %eax,%ebx
+  8015c9:	c1 eb 0f             	shr    $0xf,%ebx
+  8015cc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d6:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8015d9:	83 ec 04             	sub    $0x4,%esp
+  8015dc:	68 80 00 00 00       	push   $0x80
+  8015e1:	6a 00                	push   $0x0
+  8015e3:	68 40 66 80 00       	push   $0x806640
+  8015e8:	e8 cd f5 ff ff       	call   800bba <memset>
+	thread_ids[slot] = sys_getenvid();
+  8015ed:	e8 43 f8 ff ff       	call   800e35 <sys_getenvid>
+  8015f2:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8015f9:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  801600:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  801605:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  80160c:	e8 7a 29 00 00       	call   803f8b <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801611:	83 c4 0c             	add    $0xc,%esp
+  801614:	68 07 04 00 00       	push   $0x407
+  801619:	68 00 00 00 e1       	push   $0xe1000000
+  80161e:	6a 00                	push   $0x0
+  801620:	e8 4e f8 ff ff       	call   800e73 <sys_page_alloc>
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	0f 89 fd 01 00 00    	jns    80182d <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801630:	50                   	push   %eax
+  801631:	68 9f 49 80 00       	push   $0x80499f
+  801636:	68 12 01 00 00       	push   $0x112
+  80163b:	68 94 49 80 00       	push   $0x804994
+  801640:	e8 28 ec ff ff       	call   80026d <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801645:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80164b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801651:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801657:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80165d:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801663:	0f 87 4f 01 00 00    	ja     8017b8 <fork+0x33d>
+		pd = PDX(addr);
+  801669:	89 d8                	mov    %ebx,%eax
+  80166b:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80166e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801675:	f6 c2 01             	test   $0x1,%dl
+  801678:	74 cb                	je     801645 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80167a:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80167f:	0f 85 92 00 00 00    	jne    801717 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801685:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80168b:	76 10                	jbe    80169d <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80168d:	89 d8                	mov    %ebx,%eax
+  80168f:	f7 d8                	neg    %eax
+  801691:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801696:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80169b:	74 ba                	je     801657 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80169d:	89 d8                	mov    %ebx,%eax
+  80169f:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8016a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016a9:	f6 c2 01             	test   $0x1,%dl
+  8016ac:	74 a9                	je     801657 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8016ae:	89 c1                	mov    %eax,%ecx
+  8016b0:	c1 e1 0c             	shl    $0xc,%ecx
+  8016b3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8016b6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016bd:	f6 c6 04             	test   $0x4,%dh
+  8016c0:	0f 85 8e 00 00 00    	jne    801754 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8016c6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016cd:	f6 c6 08             	test   $0x8,%dh
+  8016d0:	75 0f                	jne    8016e1 <fork+0x266>
+  8016d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016d9:	a8 02                	test   $0x2,%al
+  8016db:	0f 84 bb 00 00 00    	je     80179c <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8016e1:	83 ec 08             	sub    $0x8,%esp
+  8016e4:	68 05 08 00 00       	push   $0x805
+  8016e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016ec:	50                   	push   %eax
+  8016ed:	56                   	push   %esi
+  8016ee:	50                   	push   %eax
+  8016ef:	6a 00                	push   $0x0
+  8016f1:	68 20 63 80 00       	push   $0x806320
+  8016f6:	e8 a8 27 00 00       	call   803ea3 <pgbatch_map>
+  8016fb:	83 c4 20             	add    $0x20,%esp
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	79 76                	jns    801778 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801702:	50                   	push   %eax
+  801703:	68 fa 49 80 00       	push   $0x8049fa
+  801708:	68 bc 00 00 00       	push   $0xbc
+  80170d:	68 94 49 80 00       	push   $0x804994
+  801712:	e8 56 eb ff ff       	call   80026d <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801717:	83 ec 0c             	sub    $0xc,%esp
+  80171a:	68 00 08 00 00       	push   $0x800
+  80171f:	56                   	push   %esi
+  801720:	53                   	push   %ebx
+  801721:	6a 00                	push   $0x0
+  801723:	68 20 63 80 00       	push   $0x806320
+  801728:	e8 21 28 00 00       	call   803f4e <pgbatch_sharept>
+  80172d:	83 c4 20             	add    $0x20,%esp
+  801730:	85 c0                	test   %eax,%eax
+  801732:	78 0b                	js     80173f <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801734:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  80173a:	e9 18 ff ff ff       	jmp    801657 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  80173f:	50                   	push   %eax
+  801740:	68 e6 49 80 00       	push   $0x8049e6
+  801745:	68 b2 00 00 00       	push   $0xb2
+  80174a:	68 94 49 80 00       	push   $0x804994
+  80174f:	e8 19 eb ff ff       	call   80026d <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801754:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80175b:	83 ec 08             	sub    $0x8,%esp
+  80175e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801763:	50                   	push   %eax
+  801764:	51                   	push   %ecx
+  801765:	56                   	push   %esi
+  801766:	51                   	push   %ecx
+  801767:	6a 00                	push   $0x0
+  801769:	68 20 63 80 00       	push   $0x806320
+  80176e:	e8 30 27 00 00       	call   803ea3 <pgbatch_map>
+  801773:	83 c4 20             	add    $0x20,%esp
+  801776:	eb 17                	jmp    80178f <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801778:	68 05 08 00 00       	push   $0x805
+  80177d:	ff 75 e4             	push   -0x1c(%ebp)
+  801780:	6a 00                	push   $0x0
+  801782:	68 20 63 80 00       	push   $0x806320
+  801787:	e8 8b 27 00 00       	call   803f17 <pgbatch_protect>
+  80178c:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80178f:	85 c0                	test   %eax,%eax
+  801791:	0f 89 c0 fe ff ff    	jns    801657 <fork+0x1dc>
+  801797:	e9 66 ff ff ff       	jmp    801702 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  80179c:	83 ec 08             	sub    $0x8,%esp
+  80179f:	6a 05                	push   $0x5
+  8017a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017a4:	50                   	push   %eax
+  8017a5:	56                   	push   %esi
+  8017a6:	50                   	push   %eax
+  8017a7:	6a 00                	push   $0x0
+  8017a9:	68 20 63 80 00       	push   $0x806320
+  8017ae:	e8 f0 26 00 00       	call   803ea3 <pgbatch_map>
+  8017b3:	83 c4 20             	add    $0x20,%esp
+  8017b6:	eb d7                	jmp    80178f <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  8017b8:	6a 07                	push   $0x7
+  8017ba:	68 00 f0 bf ee       	push   $0xeebff000
+  8017bf:	57                   	push   %edi
+  8017c0:	68 20 63 80 00       	push   $0x806320
+  8017c5:	e8 a2 26 00 00       	call   803e6c <pgbatch_alloc>
+  8017ca:	83 c4 10             	add    $0x10,%esp
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	78 66                	js     801837 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8017d1:	83 ec 0c             	sub    $0xc,%esp
+  8017d4:	68 20 63 80 00       	push   $0x806320
+  8017d9:	e8 15 26 00 00       	call   803df3 <pgbatch_flush>
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	78 52                	js     801837 <fork+0x3bc>
+  8017e5:	89 e2                	mov    %esp,%edx
+  8017e7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017ec:	29 d0                	sub    %edx,%eax
+  8017ee:	89 c2                	mov    %eax,%edx
+  8017f0:	c1 ea 0f             	shr    $0xf,%edx
+  8017f3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fd:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801800:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801807:	8b 40 78             	mov    0x78(%eax),%eax
+  80180a:	83 ec 08             	sub    $0x8,%esp
+  80180d:	50                   	push   %eax
+  80180e:	57                   	push   %edi
+  80180f:	e8 aa f7 ff ff       	call   800fbe <sys_env_set_pgfault_upcall>
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	85 c0                	test   %eax,%eax
+  801819:	78 31                	js     80184c <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  80181b:	83 ec 08             	sub    $0x8,%esp
+  80181e:	6a 02                	push   $0x2
+  801820:	57                   	push   %edi
+  801821:	e8 14 f7 ff ff       	call   800f3a <sys_env_set_status>
+  801826:	83 c4 10             	add    $0x10,%esp
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	78 34                	js     801861 <fork+0x3e6>
+}
+  80182d:	89 f0                	mov    %esi,%eax
+  80182f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801832:	5b                   	pop    %ebx
+  801833:	5e                   	pop    %esi
+  801834:	5f                   	pop    %edi
+  801835:	5d                   	pop    %ebp
+  801836:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801837:	50                   	push   %eax
+  801838:	68 06 4a 80 00       	push   $0x804a06
+  80183d:	68 c0 00 00 00       	push   $0xc0
+  801842:	68 94 49 80 00       	push   $0x804994
+  801847:	e8 21 ea ff ff       	call   80026d <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  80184c:	50                   	push   %eax
+  80184d:	68 1b 4a 80 00       	push   $0x804a1b
+  801852:	68 c2 00 00 00       	push   $0xc2
+  801857:	68 94 49 80 00       	push   $0x804994
+  80185c:	e8 0c ea ff ff       	call   80026d <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801861:	50                   	push   %eax
+  801862:	68 36 4a 80 00       	push   $0x804a36
+  801867:	68 c4 00 00 00       	push   $0xc4
+  80186c:	68 94 49 80 00       	push   $0x804994
+  801871:	e8 f7 e9 ff ff       	call   80026d <_panic>
+
+00801876 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801876:	55                   	push   %ebp
+  801877:	89 e5                	mov    %esp,%ebp
+  801879:	57                   	push   %edi
+  80187a:	56                   	push   %esi
+  80187b:	53                   	push   %ebx
+  80187c:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80187f:	68 c0 66 80 00       	push   $0x8066c0
+  801884:	e8 10 27 00 00       	call   803f99 <mutex_lock>
+  801889:	89 e2                	mov    %esp,%edx
+  80188b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801890:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  801892:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801895:	89 c3                	mov    %eax,%ebx
+  801897:	c1 eb 0f             	shr    $0xf,%ebx
+  80189a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80189f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a4:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  8018a7:	e8 89 f5 ff ff       	call   800e35 <sys_getenvid>
+  8018ac:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  8018b3:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8018b8:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  8018bf:	e8 12 fa ff ff       	call   8012d6 <thread_alive>
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	74 24                	je     8018ec <sfork+0x76>
+  8018c8:	83 c3 01             	add    $0x1,%ebx
+  8018cb:	83 fb 20             	cmp    $0x20,%ebx
+  8018ce:	75 e8                	jne    8018b8 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  8018d0:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  8018d5:	83 ec 0c             	sub    $0xc,%esp
+  8018d8:	68 c0 66 80 00       	push   $0x8066c0
+  8018dd:	e8 25 27 00 00       	call   804007 <mutex_unlock>
+	return r;
+}
+  8018e2:	89 f0                	mov    %esi,%eax
+  8018e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e7:	5b                   	pop    %ebx
+  8018e8:	5e                   	pop    %esi
+  8018e9:	5f                   	pop    %edi
+  8018ea:	5d                   	pop    %ebp
+  8018eb:	c3                   	ret
+	if (i == NTHREADS) {
+  8018ec:	83 fb 20             	cmp    $0x20,%ebx
+  8018ef:	0f 84 53 01 00 00    	je     801a48 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  8018f5:	89 d8                	mov    %ebx,%eax
+  8018f7:	c1 e0 0f             	shl    $0xf,%eax
+  8018fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  8018fd:	83 ec 0c             	sub    $0xc,%esp
+  801900:	68 00 60 80 00       	push   $0x806000
+  801905:	e8 db 24 00 00       	call   803de5 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  80190a:	83 c4 10             	add    $0x10,%esp
+  80190d:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801914:	75 1f                	jne    801935 <sfork+0xbf>
+  801916:	68 07 04 00 00       	push   $0x407
+  80191b:	68 00 00 00 e1       	push   $0xe1000000
+  801920:	6a 00                	push   $0x0
+  801922:	68 00 60 80 00       	push   $0x806000
+  801927:	e8 40 25 00 00       	call   803e6c <pgbatch_alloc>
+  80192c:	89 c6                	mov    %eax,%esi
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	85 c0                	test   %eax,%eax
+  801933:	78 a0                	js     8018d5 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801935:	6a 07                	push   $0x7
+  801937:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  80193c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80193f:	29 c8                	sub    %ecx,%eax
+  801941:	50                   	push   %eax
+  801942:	6a 00                	push   $0x0
+  801944:	68 00 60 80 00       	push   $0x806000
+  801949:	e8 1e 25 00 00       	call   803e6c <pgbatch_alloc>
+  80194e:	89 c6                	mov    %eax,%esi
+  801950:	83 c4 10             	add    $0x10,%esp
+  801953:	85 c0                	test   %eax,%eax
+  801955:	0f 88 7a ff ff ff    	js     8018d5 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  80195b:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801960:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801963:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801965:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80196a:	29 c8                	sub    %ecx,%eax
+  80196c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80196f:	39 c7                	cmp    %eax,%edi
+  801971:	73 29                	jae    80199c <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801973:	6a 07                	push   $0x7
+  801975:	57                   	push   %edi
+  801976:	6a 00                	push   $0x0
+  801978:	68 00 60 80 00       	push   $0x806000
+  80197d:	e8 ea 24 00 00       	call   803e6c <pgbatch_alloc>
+  801982:	89 c6                	mov    %eax,%esi
+  801984:	83 c4 10             	add    $0x10,%esp
+  801987:	85 c0                	test   %eax,%eax
+  801989:	0f 88 46 ff ff ff    	js     8018d5 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  80198f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801995:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801998:	39 c7                	cmp    %eax,%edi
+  80199a:	72 d7                	jb     801973 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  80199c:	83 ec 0c             	sub    $0xc,%esp
+  80199f:	68 00 60 80 00       	push   $0x806000
+  8019a4:	e8 4a 24 00 00       	call   803df3 <pgbatch_flush>
+  8019a9:	89 c6                	mov    %eax,%esi
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	0f 88 1f ff ff ff    	js     8018d5 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  8019b6:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  8019bb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019be:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  8019c0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  8019c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c9:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  8019cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019cf:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019d2:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  8019d5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019da:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019dc:	52                   	push   %edx
+  8019dd:	50                   	push   %eax
+  8019de:	68 5e 14 80 00       	push   $0x80145e
+  8019e3:	e8 cc f8 ff ff       	call   8012b4 <sys_exofork_shared>
+  8019e8:	89 c6                	mov    %eax,%esi
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	0f 88 e0 fe ff ff    	js     8018d5 <sfork+0x5f>
+	thread_ids[i] = id;
+  8019f5:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  8019fc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a01:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801a07:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a0c:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801a13:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801a1a:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a1d:	83 ec 08             	sub    $0x8,%esp
+  801a20:	6a 02                	push   $0x2
+  801a22:	56                   	push   %esi
+  801a23:	e8 12 f5 ff ff       	call   800f3a <sys_env_set_status>
+  801a28:	89 c3                	mov    %eax,%ebx
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	0f 89 a0 fe ff ff    	jns    8018d5 <sfork+0x5f>
+		sys_env_destroy(id);
+  801a35:	83 ec 0c             	sub    $0xc,%esp
+  801a38:	56                   	push   %esi
+  801a39:	e8 b6 f3 ff ff       	call   800df4 <sys_env_destroy>
+		goto out;
+  801a3e:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a41:	89 de                	mov    %ebx,%esi
+		goto out;
+  801a43:	e9 8d fe ff ff       	jmp    8018d5 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801a48:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801a4d:	e9 83 fe ff ff       	jmp    8018d5 <sfork+0x5f>
+
+00801a52 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801a52:	55                   	push   %ebp
+  801a53:	89 e5                	mov    %esp,%ebp
+  801a55:	56                   	push   %esi
+  801a56:	53                   	push   %ebx
+  801a57:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801a67:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801a6a:	83 ec 0c             	sub    $0xc,%esp
+  801a6d:	50                   	push   %eax
+  801a6e:	e8 b0 f5 ff ff       	call   801023 <sys_ipc_recv>
+  801a73:	83 c4 10             	add    $0x10,%esp
+  801a76:	85 c0                	test   %eax,%eax
+  801a78:	0f 88 8b 00 00 00    	js     801b09 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801a7e:	85 f6                	test   %esi,%esi
+  801a80:	74 2a                	je     801aac <ipc_recv+0x5a>
+  801a82:	89 e2                	mov    %esp,%edx
+  801a84:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a89:	29 d0                	sub    %edx,%eax
+  801a8b:	89 c2                	mov    %eax,%edx
+  801a8d:	c1 ea 0f             	shr    $0xf,%edx
+  801a90:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801a9d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801aa4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801aaa:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  801aac:	85 db                	test   %ebx,%ebx
+  801aae:	74 2a                	je     801ada <ipc_recv+0x88>
+  801ab0:	89 e2                	mov    %esp,%edx
+  801ab2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ab7:	29 d0                	sub    %edx,%eax
+  801ab9:	89 c2                	mov    %eax,%edx
+  801abb:	c1 ea 0f             	shr    $0xf,%edx
+  801abe:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac8:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801acb:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ad2:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801ad8:	89 03                	mov    %eax,(%ebx)
+  801ada:	89 e2                	mov    %esp,%edx
+  801adc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ae1:	29 d0                	sub    %edx,%eax
+  801ae3:	89 c2                	mov    %eax,%edx
+  801ae5:	c1 ea 0f             	shr    $0xf,%edx
+  801ae8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801af5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801afc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801b02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b05:	5b                   	pop    %ebx
+  801b06:	5e                   	pop    %esi
+  801b07:	5d                   	pop    %ebp
+  801b08:	c3                   	ret
+		if(from_env_store != NULL)
+  801b09:	85 f6                	test   %esi,%esi
+  801b0b:	74 06                	je     801b13 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801b0d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801b13:	85 db                	test   %ebx,%ebx
+  801b15:	74 eb                	je     801b02 <ipc_recv+0xb0>
+			*perm_store = 0;
+  801b17:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801b1d:	eb e3                	jmp    801b02 <ipc_recv+0xb0>
+
+00801b1f <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801b1f:	55                   	push   %ebp
+  801b20:	89 e5                	mov    %esp,%ebp
+  801b22:	57                   	push   %edi
+  801b23:	56                   	push   %esi
+  801b24:	53                   	push   %ebx
+  801b25:	83 ec 14             	sub    $0x14,%esp
+  801b28:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b2e:	8b 75 14             	mov    0x14(%ebp),%esi
+  801b31:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801b3b:	0f 44 c2             	cmove  %edx,%eax
+  801b3e:	ff 75 10             	push   0x10(%ebp)
+  801b41:	50                   	push   %eax
+  801b42:	e8 3e f5 ff ff       	call   801085 <sys_ipc_recv_pages>
+  801b47:	83 c4 10             	add    $0x10,%esp
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	0f 88 ba 00 00 00    	js     801c0c <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801b52:	85 ff                	test   %edi,%edi
+  801b54:	74 2a                	je     801b80 <ipc_recv_pages+0x61>
+  801b56:	89 e2                	mov    %esp,%edx
+  801b58:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b5d:	29 d0                	sub    %edx,%eax
+  801b5f:	89 c2                	mov    %eax,%edx
+  801b61:	c1 ea 0f             	shr    $0xf,%edx
+  801b64:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801b71:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b78:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801b7e:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801b80:	85 f6                	test   %esi,%esi
+  801b82:	74 2a                	je     801bae <ipc_recv_pages+0x8f>
+  801b84:	89 e2                	mov    %esp,%edx
+  801b86:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b8b:	29 d0                	sub    %edx,%eax
+  801b8d:	89 c2                	mov    %eax,%edx
+  801b8f:	c1 ea 0f             	shr    $0xf,%edx
+  801b92:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9c:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801b9f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ba6:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801bac:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801bae:	85 db                	test   %ebx,%ebx
+  801bb0:	74 2a                	je     801bdc <ipc_recv_pages+0xbd>
+  801bb2:	89 e2                	mov    %esp,%edx
+  801bb4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bb9:	29 d0                	sub    %edx,%eax
+  801bbb:	89 c2                	mov    %eax,%edx
+  801bbd:	c1 ea 0f             	shr    $0xf,%edx
+  801bc0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bca:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801bcd:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801bd4:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801bda:	89 03                	mov    %eax,(%ebx)
+  801bdc:	89 e2                	mov    %esp,%edx
+  801bde:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801be3:	29 d0                	sub    %edx,%eax
+  801be5:	89 c2                	mov    %eax,%edx
+  801be7:	c1 ea 0f             	shr    $0xf,%edx
+  801bea:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801bf7:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801bfe:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801c04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c07:	5b                   	pop    %ebx
+  801c08:	5e                   	pop    %esi
+  801c09:	5f                   	pop    %edi
+  801c0a:	5d                   	pop    %ebp
+  801c0b:	c3                   	ret
+		if (from_env_store)
+  801c0c:	85 ff                	test   %edi,%edi
+  801c0e:	74 06                	je     801c16 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801c10:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801c16:	85 f6                	test   %esi,%esi
+  801c18:	74 06                	je     801c20 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801c1a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801c20:	85 db                	test   %ebx,%ebx
+  801c22:	74 e0                	je     801c04 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801c24:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801c2a:	eb d8                	jmp    801c04 <ipc_recv_pages+0xe5>
+
+00801c2c <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801c2c:	55                   	push   %ebp
+  801c2d:	89 e5                	mov    %esp,%ebp
+  801c2f:	57                   	push   %edi
+  801c30:	56                   	push   %esi
+  801c31:	53                   	push   %ebx
+  801c32:	83 ec 1c             	sub    $0x1c,%esp
+  801c35:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801c38:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c3b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801c41:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801c45:	75 2b                	jne    801c72 <ipc_try_send_pages+0x46>
+  801c47:	89 e2                	mov    %esp,%edx
+  801c49:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c4e:	29 d0                	sub    %edx,%eax
+  801c50:	89 c2                	mov    %eax,%edx
+  801c52:	c1 ea 0f             	shr    $0xf,%edx
+  801c55:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5f:	0f 42 c2             	cmovb  %edx,%eax
+  801c62:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801c69:	8b 70 48             	mov    0x48(%eax),%esi
+  801c6c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801c72:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801c78:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801c7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c80:	85 ff                	test   %edi,%edi
+  801c82:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801c87:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  801c8a:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801c90:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801c96:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  801c9c:	83 ec 0c             	sub    $0xc,%esp
+  801c9f:	ff 75 14             	push   0x14(%ebp)
+  801ca2:	ff 75 18             	push   0x18(%ebp)
+  801ca5:	57                   	push   %edi
+  801ca6:	ff 75 0c             	push   0xc(%ebp)
+  801ca9:	ff 75 08             	push   0x8(%ebp)
+  801cac:	e8 b3 f3 ff ff       	call   801064 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801cb1:	83 c4 20             	add    $0x20,%esp
+  801cb4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cb7:	75 21                	jne    801cda <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801cb9:	83 ec 04             	sub    $0x4,%esp
+  801cbc:	6a ff                	push   $0xffffffff
+  801cbe:	53                   	push   %ebx
+  801cbf:	ff 75 e4             	push   -0x1c(%ebp)
+  801cc2:	e8 aa f5 ff ff       	call   801271 <sys_futex_wait>
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801ccd:	74 c7                	je     801c96 <ipc_try_send_pages+0x6a>
+  801ccf:	85 c0                	test   %eax,%eax
+  801cd1:	79 c3                	jns    801c96 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801cd3:	e8 7c f1 ff ff       	call   800e54 <sys_yield>
+  801cd8:	eb bc                	jmp    801c96 <ipc_try_send_pages+0x6a>
+	}
+}
+  801cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cdd:	5b                   	pop    %ebx
+  801cde:	5e                   	pop    %esi
+  801cdf:	5f                   	pop    %edi
+  801ce0:	5d                   	pop    %ebp
+  801ce1:	c3                   	ret
+
+00801ce2 <ipc_send>:
+{
+  801ce2:	55                   	push   %ebp
+  801ce3:	89 e5                	mov    %esp,%ebp
+  801ce5:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801ce8:	ff 75 14             	push   0x14(%ebp)
+  801ceb:	6a 01                	push   $0x1
+  801ced:	ff 75 10             	push   0x10(%ebp)
+  801cf0:	ff 75 0c             	push   0xc(%ebp)
+  801cf3:	ff 75 08             	push   0x8(%ebp)
+  801cf6:	e8 31 ff ff ff       	call   801c2c <ipc_try_send_pages>
+  801cfb:	83 c4 20             	add    $0x20,%esp
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	78 02                	js     801d04 <ipc_send+0x22>
+}
+  801d02:	c9                   	leave
+  801d03:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801d04:	50                   	push   %eax
+  801d05:	68 6f 4a 80 00       	push   $0x804a6f
+  801d0a:	6a 3f                	push   $0x3f
+  801d0c:	68 84 4a 80 00       	push   $0x804a84
+  801d11:	e8 57 e5 ff ff       	call   80026d <_panic>
+
+00801d16 <ipc_send_pages>:
+{
+  801d16:	55                   	push   %ebp
+  801d17:	89 e5                	mov    %esp,%ebp
+  801d19:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801d1c:	ff 75 18             	push   0x18(%ebp)
+  801d1f:	ff 75 14             	push   0x14(%ebp)
+  801d22:	ff 75 10             	push   0x10(%ebp)
+  801d25:	ff 75 0c             	push   0xc(%ebp)
+  801d28:	ff 75 08             	push   0x8(%ebp)
+  801d2b:	e8 fc fe ff ff       	call   801c2c <ipc_try_send_pages>
+  801d30:	83 c4 20             	add    $0x20,%esp
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	78 02                	js     801d39 <ipc_send_pages+0x23>
+}
+  801d37:	c9                   	leave
+  801d38:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801d39:	50                   	push   %eax
+  801d3a:	68 8e 4a 80 00       	push   $0x804a8e
+  801d3f:	6a 64                	push   $0x64
+  801d41:	68 84 4a 80 00       	push   $0x804a84
+  801d46:	e8 22 e5 ff ff       	call   80026d <_panic>
+
+00801d4b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801d4b:	55                   	push   %ebp
+  801d4c:	89 e5                	mov    %esp,%ebp
+  801d4e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801d51:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801d56:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801d5c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d62:	8b 52 50             	mov    0x50(%edx),%edx
+  801d65:	39 ca                	cmp    %ecx,%edx
+  801d67:	74 11                	je     801d7a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801d69:	83 c0 01             	add    $0x1,%eax
+  801d6c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801d71:	75 e3                	jne    801d56 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d78:	eb 0e                	jmp    801d88 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801d7a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801d80:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d85:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801d88:	5d                   	pop    %ebp
+  801d89:	c3                   	ret
+
+00801d8a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d90:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d95:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d98:	5d                   	pop    %ebp
+  801d99:	c3                   	ret
+
+00801d9a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d9a:	55                   	push   %ebp
+  801d9b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801da5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801daa:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+
+00801db1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801db1:	55                   	push   %ebp
+  801db2:	89 e5                	mov    %esp,%ebp
+  801db4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801db9:	89 c2                	mov    %eax,%edx
+  801dbb:	c1 ea 16             	shr    $0x16,%edx
+  801dbe:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801dc5:	f6 c2 01             	test   $0x1,%dl
+  801dc8:	74 29                	je     801df3 <fd_alloc+0x42>
+  801dca:	89 c2                	mov    %eax,%edx
+  801dcc:	c1 ea 0c             	shr    $0xc,%edx
+  801dcf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dd6:	f6 c2 01             	test   $0x1,%dl
+  801dd9:	74 18                	je     801df3 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801ddb:	05 00 10 00 00       	add    $0x1000,%eax
+  801de0:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801de5:	75 d2                	jne    801db9 <fd_alloc+0x8>
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801dec:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801df1:	eb 05                	jmp    801df8 <fd_alloc+0x47>
+			return 0;
+  801df3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801df8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dfb:	89 02                	mov    %eax,(%edx)
+}
+  801dfd:	89 c8                	mov    %ecx,%eax
+  801dff:	5d                   	pop    %ebp
+  801e00:	c3                   	ret
+
+00801e01 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801e07:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801e0c:	77 30                	ja     801e3e <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801e0e:	c1 e0 0c             	shl    $0xc,%eax
+  801e11:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801e16:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e1c:	f6 c2 01             	test   $0x1,%dl
+  801e1f:	74 24                	je     801e45 <fd_lookup+0x44>
+  801e21:	89 c2                	mov    %eax,%edx
+  801e23:	c1 ea 0c             	shr    $0xc,%edx
+  801e26:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e2d:	f6 c2 01             	test   $0x1,%dl
+  801e30:	74 1a                	je     801e4c <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e32:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e35:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e3c:	5d                   	pop    %ebp
+  801e3d:	c3                   	ret
+		return -E_INVAL;
+  801e3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e43:	eb f7                	jmp    801e3c <fd_lookup+0x3b>
+		return -E_INVAL;
+  801e45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e4a:	eb f0                	jmp    801e3c <fd_lookup+0x3b>
+  801e4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e51:	eb e9                	jmp    801e3c <fd_lookup+0x3b>
+
+00801e53 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	53                   	push   %ebx
+  801e57:	83 ec 04             	sub    $0x4,%esp
+  801e5a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e62:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801e67:	39 13                	cmp    %edx,(%ebx)
+  801e69:	74 54                	je     801ebf <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801e6b:	83 c0 01             	add    $0x1,%eax
+  801e6e:	8b 1c 85 28 4b 80 00 	mov    0x804b28(,%eax,4),%ebx
+  801e75:	85 db                	test   %ebx,%ebx
+  801e77:	75 ee                	jne    801e67 <dev_lookup+0x14>
+  801e79:	89 e1                	mov    %esp,%ecx
+  801e7b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e80:	29 c8                	sub    %ecx,%eax
+  801e82:	89 c1                	mov    %eax,%ecx
+  801e84:	c1 e9 0f             	shr    $0xf,%ecx
+  801e87:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e91:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e94:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801e9b:	8b 40 48             	mov    0x48(%eax),%eax
+  801e9e:	83 ec 04             	sub    $0x4,%esp
+  801ea1:	52                   	push   %edx
+  801ea2:	50                   	push   %eax
+  801ea3:	68 ac 4a 80 00       	push   $0x804aac
+  801ea8:	e8 9b e4 ff ff       	call   800348 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801ead:	83 c4 10             	add    $0x10,%esp
+  801eb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801eb5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eb8:	89 1a                	mov    %ebx,(%edx)
+}
+  801eba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebd:	c9                   	leave
+  801ebe:	c3                   	ret
+			return 0;
+  801ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec4:	eb ef                	jmp    801eb5 <dev_lookup+0x62>
+
+00801ec6 <fd_close>:
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	57                   	push   %edi
+  801eca:	56                   	push   %esi
+  801ecb:	53                   	push   %ebx
+  801ecc:	83 ec 24             	sub    $0x24,%esp
+  801ecf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ed2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ed5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ed8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ed9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801edf:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ee2:	50                   	push   %eax
+  801ee3:	e8 19 ff ff ff       	call   801e01 <fd_lookup>
+  801ee8:	89 c3                	mov    %eax,%ebx
+  801eea:	83 c4 10             	add    $0x10,%esp
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	78 05                	js     801ef6 <fd_close+0x30>
+	    || fd != fd2)
+  801ef1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ef4:	74 0f                	je     801f05 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801ef6:	85 ff                	test   %edi,%edi
+  801ef8:	0f 44 df             	cmove  %edi,%ebx
+}
+  801efb:	89 d8                	mov    %ebx,%eax
+  801efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f00:	5b                   	pop    %ebx
+  801f01:	5e                   	pop    %esi
+  801f02:	5f                   	pop    %edi
+  801f03:	5d                   	pop    %ebp
+  801f04:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f05:	83 ec 08             	sub    $0x8,%esp
+  801f08:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f0b:	50                   	push   %eax
+  801f0c:	ff 36                	push   (%esi)
+  801f0e:	e8 40 ff ff ff       	call   801e53 <dev_lookup>
+  801f13:	89 c3                	mov    %eax,%ebx
+  801f15:	83 c4 10             	add    $0x10,%esp
+  801f18:	85 c0                	test   %eax,%eax
+  801f1a:	78 1a                	js     801f36 <fd_close+0x70>
+		if (dev->dev_close)
+  801f1c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f1f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	74 0b                	je     801f36 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801f2b:	83 ec 0c             	sub    $0xc,%esp
+  801f2e:	56                   	push   %esi
+  801f2f:	ff d0                	call   *%eax
+  801f31:	89 c3                	mov    %eax,%ebx
+  801f33:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f36:	83 ec 08             	sub    $0x8,%esp
+  801f39:	56                   	push   %esi
+  801f3a:	6a 00                	push   $0x0
+  801f3c:	e8 b7 ef ff ff       	call   800ef8 <sys_page_unmap>
+	return r;
+  801f41:	83 c4 10             	add    $0x10,%esp
+  801f44:	eb b5                	jmp    801efb <fd_close+0x35>
+
+00801f46 <close>:
+
+int
+close(int fdnum)
+{
+  801f46:	55                   	push   %ebp
+  801f47:	89 e5                	mov    %esp,%ebp
+  801f49:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f4f:	50                   	push   %eax
+  801f50:	ff 75 08             	push   0x8(%ebp)
+  801f53:	e8 a9 fe ff ff       	call   801e01 <fd_lookup>
+  801f58:	83 c4 10             	add    $0x10,%esp
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	79 02                	jns    801f61 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f5f:	c9                   	leave
+  801f60:	c3                   	ret
+		return fd_close(fd, 1);
+  801f61:	83 ec 08             	sub    $0x8,%esp
+  801f64:	6a 01                	push   $0x1
+  801f66:	ff 75 f4             	push   -0xc(%ebp)
+  801f69:	e8 58 ff ff ff       	call   801ec6 <fd_close>
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	eb ec                	jmp    801f5f <close+0x19>
+
+00801f73 <close_all>:
+
+void
+close_all(void)
+{
+  801f73:	55                   	push   %ebp
+  801f74:	89 e5                	mov    %esp,%ebp
+  801f76:	53                   	push   %ebx
+  801f77:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f7f:	83 ec 0c             	sub    $0xc,%esp
+  801f82:	53                   	push   %ebx
+  801f83:	e8 be ff ff ff       	call   801f46 <close>
+	for (i = 0; i < MAXFD; i++)
+  801f88:	83 c3 01             	add    $0x1,%ebx
+  801f8b:	83 c4 10             	add    $0x10,%esp
+  801f8e:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801f94:	75 e9                	jne    801f7f <close_all+0xc>
+}
+  801f96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f99:	c9                   	leave
+  801f9a:	c3                   	ret
+
+00801f9b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f9b:	55                   	push   %ebp
+  801f9c:	89 e5                	mov    %esp,%ebp
+  801f9e:	57                   	push   %edi
+  801f9f:	56                   	push   %esi
+  801fa0:	53                   	push   %ebx
+  801fa1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801fa4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fa7:	50                   	push   %eax
+  801fa8:	ff 75 08             	push   0x8(%ebp)
+  801fab:	e8 51 fe ff ff       	call   801e01 <fd_lookup>
+  801fb0:	89 c3                	mov    %eax,%ebx
+  801fb2:	83 c4 10             	add    $0x10,%esp
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	78 7f                	js     802038 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801fb9:	83 ec 0c             	sub    $0xc,%esp
+  801fbc:	ff 75 0c             	push   0xc(%ebp)
+  801fbf:	e8 82 ff ff ff       	call   801f46 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801fc4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fc7:	c1 e6 0c             	shl    $0xc,%esi
+  801fca:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801fd0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801fd3:	89 3c 24             	mov    %edi,(%esp)
+  801fd6:	e8 bf fd ff ff       	call   801d9a <fd2data>
+  801fdb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801fdd:	89 34 24             	mov    %esi,(%esp)
+  801fe0:	e8 b5 fd ff ff       	call   801d9a <fd2data>
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801feb:	89 d8                	mov    %ebx,%eax
+  801fed:	c1 e8 16             	shr    $0x16,%eax
+  801ff0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ff7:	a8 01                	test   $0x1,%al
+  801ff9:	74 11                	je     80200c <dup+0x71>
+  801ffb:	89 d8                	mov    %ebx,%eax
+  801ffd:	c1 e8 0c             	shr    $0xc,%eax
+  802000:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802007:	f6 c2 01             	test   $0x1,%dl
+  80200a:	75 36                	jne    802042 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80200c:	89 f8                	mov    %edi,%eax
+  80200e:	c1 e8 0c             	shr    $0xc,%eax
+  802011:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802018:	83 ec 0c             	sub    $0xc,%esp
+  80201b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802020:	50                   	push   %eax
+  802021:	56                   	push   %esi
+  802022:	6a 00                	push   $0x0
+  802024:	57                   	push   %edi
+  802025:	6a 00                	push   $0x0
+  802027:	e8 8a ee ff ff       	call   800eb6 <sys_page_map>
+  80202c:	89 c3                	mov    %eax,%ebx
+  80202e:	83 c4 20             	add    $0x20,%esp
+  802031:	85 c0                	test   %eax,%eax
+  802033:	78 33                	js     802068 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802035:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802038:	89 d8                	mov    %ebx,%eax
+  80203a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80203d:	5b                   	pop    %ebx
+  80203e:	5e                   	pop    %esi
+  80203f:	5f                   	pop    %edi
+  802040:	5d                   	pop    %ebp
+  802041:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802042:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802049:	83 ec 0c             	sub    $0xc,%esp
+  80204c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802051:	50                   	push   %eax
+  802052:	ff 75 d4             	push   -0x2c(%ebp)
+  802055:	6a 00                	push   $0x0
+  802057:	53                   	push   %ebx
+  802058:	6a 00                	push   $0x0
+  80205a:	e8 57 ee ff ff       	call   800eb6 <sys_page_map>
+  80205f:	89 c3                	mov    %eax,%ebx
+  802061:	83 c4 20             	add    $0x20,%esp
+  802064:	85 c0                	test   %eax,%eax
+  802066:	79 a4                	jns    80200c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802068:	83 ec 08             	sub    $0x8,%esp
+  80206b:	56                   	push   %esi
+  80206c:	6a 00                	push   $0x0
+  80206e:	e8 85 ee ff ff       	call   800ef8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802073:	83 c4 08             	add    $0x8,%esp
+  802076:	ff 75 d4             	push   -0x2c(%ebp)
+  802079:	6a 00                	push   $0x0
+  80207b:	e8 78 ee ff ff       	call   800ef8 <sys_page_unmap>
+	return r;
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	eb b3                	jmp    802038 <dup+0x9d>
+
+00802085 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	56                   	push   %esi
+  802089:	53                   	push   %ebx
+  80208a:	83 ec 18             	sub    $0x18,%esp
+  80208d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802090:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802093:	50                   	push   %eax
+  802094:	53                   	push   %ebx
+  802095:	e8 67 fd ff ff       	call   801e01 <fd_lookup>
+  80209a:	83 c4 10             	add    $0x10,%esp
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 3c                	js     8020dd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020a1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020a4:	83 ec 08             	sub    $0x8,%esp
+  8020a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020aa:	50                   	push   %eax
+  8020ab:	ff 36                	push   (%esi)
+  8020ad:	e8 a1 fd ff ff       	call   801e53 <dev_lookup>
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	85 c0                	test   %eax,%eax
+  8020b7:	78 24                	js     8020dd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8020b9:	8b 46 08             	mov    0x8(%esi),%eax
+  8020bc:	83 e0 03             	and    $0x3,%eax
+  8020bf:	83 f8 01             	cmp    $0x1,%eax
+  8020c2:	74 20                	je     8020e4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8020c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c7:	8b 40 08             	mov    0x8(%eax),%eax
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	74 54                	je     802122 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8020ce:	83 ec 04             	sub    $0x4,%esp
+  8020d1:	ff 75 10             	push   0x10(%ebp)
+  8020d4:	ff 75 0c             	push   0xc(%ebp)
+  8020d7:	56                   	push   %esi
+  8020d8:	ff d0                	call   *%eax
+  8020da:	83 c4 10             	add    $0x10,%esp
+}
+  8020dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e0:	5b                   	pop    %ebx
+  8020e1:	5e                   	pop    %esi
+  8020e2:	5d                   	pop    %ebp
+  8020e3:	c3                   	ret
+  8020e4:	89 e2                	mov    %esp,%edx
+  8020e6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020eb:	29 d0                	sub    %edx,%eax
+  8020ed:	89 c2                	mov    %eax,%edx
+  8020ef:	c1 ea 0f             	shr    $0xf,%edx
+  8020f2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fc:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020ff:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802106:	8b 40 48             	mov    0x48(%eax),%eax
+  802109:	83 ec 04             	sub    $0x4,%esp
+  80210c:	53                   	push   %ebx
+  80210d:	50                   	push   %eax
+  80210e:	68 ed 4a 80 00       	push   $0x804aed
+  802113:	e8 30 e2 ff ff       	call   800348 <cprintf>
+		return -E_INVAL;
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802120:	eb bb                	jmp    8020dd <read+0x58>
+		return -E_NOT_SUPP;
+  802122:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802127:	eb b4                	jmp    8020dd <read+0x58>
+
+00802129 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	57                   	push   %edi
+  80212d:	56                   	push   %esi
+  80212e:	53                   	push   %ebx
+  80212f:	83 ec 0c             	sub    $0xc,%esp
+  802132:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802135:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802138:	85 f6                	test   %esi,%esi
+  80213a:	74 30                	je     80216c <readn+0x43>
+  80213c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802141:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802146:	83 ec 04             	sub    $0x4,%esp
+  802149:	89 f2                	mov    %esi,%edx
+  80214b:	29 c2                	sub    %eax,%edx
+  80214d:	52                   	push   %edx
+  80214e:	01 f8                	add    %edi,%eax
+  802150:	50                   	push   %eax
+  802151:	ff 75 08             	push   0x8(%ebp)
+  802154:	e8 2c ff ff ff       	call   802085 <read>
+		if (m < 0)
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	78 15                	js     802175 <readn+0x4c>
+			return m;
+		if (m == 0)
+  802160:	74 11                	je     802173 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802162:	01 c3                	add    %eax,%ebx
+  802164:	89 d8                	mov    %ebx,%eax
+  802166:	39 f3                	cmp    %esi,%ebx
+  802168:	72 dc                	jb     802146 <readn+0x1d>
+  80216a:	eb 09                	jmp    802175 <readn+0x4c>
+  80216c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802171:	eb 02                	jmp    802175 <readn+0x4c>
+  802173:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  802175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802178:	5b                   	pop    %ebx
+  802179:	5e                   	pop    %esi
+  80217a:	5f                   	pop    %edi
+  80217b:	5d                   	pop    %ebp
+  80217c:	c3                   	ret
+
+0080217d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80217d:	55                   	push   %ebp
+  80217e:	89 e5                	mov    %esp,%ebp
+  802180:	56                   	push   %esi
+  802181:	53                   	push   %ebx
+  802182:	83 ec 18             	sub    $0x18,%esp
+  802185:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802188:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80218b:	50                   	push   %eax
+  80218c:	53                   	push   %ebx
+  80218d:	e8 6f fc ff ff       	call   801e01 <fd_lookup>
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	85 c0                	test   %eax,%eax
+  802197:	78 37                	js     8021d0 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802199:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80219c:	83 ec 08             	sub    $0x8,%esp
+  80219f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a2:	50                   	push   %eax
+  8021a3:	ff 36                	push   (%esi)
+  8021a5:	e8 a9 fc ff ff       	call   801e53 <dev_lookup>
+  8021aa:	83 c4 10             	add    $0x10,%esp
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	78 1f                	js     8021d0 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021b1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021b5:	74 20                	je     8021d7 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8021b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ba:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021bd:	85 c0                	test   %eax,%eax
+  8021bf:	74 54                	je     802215 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8021c1:	83 ec 04             	sub    $0x4,%esp
+  8021c4:	ff 75 10             	push   0x10(%ebp)
+  8021c7:	ff 75 0c             	push   0xc(%ebp)
+  8021ca:	56                   	push   %esi
+  8021cb:	ff d0                	call   *%eax
+  8021cd:	83 c4 10             	add    $0x10,%esp
+}
+  8021d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d3:	5b                   	pop    %ebx
+  8021d4:	5e                   	pop    %esi
+  8021d5:	5d                   	pop    %ebp
+  8021d6:	c3                   	ret
+  8021d7:	89 e2                	mov    %esp,%edx
+  8021d9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8021de:	29 d0                	sub    %edx,%eax
+  8021e0:	89 c2                	mov    %eax,%edx
+  8021e2:	c1 ea 0f             	shr    $0xf,%edx
+  8021e5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ef:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021f2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8021f9:	8b 40 48             	mov    0x48(%eax),%eax
+  8021fc:	83 ec 04             	sub    $0x4,%esp
+  8021ff:	53                   	push   %ebx
+  802200:	50                   	push   %eax
+  802201:	68 09 4b 80 00       	push   $0x804b09
+  802206:	e8 3d e1 ff ff       	call   800348 <cprintf>
+		return -E_INVAL;
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802213:	eb bb                	jmp    8021d0 <write+0x53>
+		return -E_NOT_SUPP;
+  802215:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80221a:	eb b4                	jmp    8021d0 <write+0x53>
+
+0080221c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80221c:	55                   	push   %ebp
+  80221d:	89 e5                	mov    %esp,%ebp
+  80221f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802222:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802225:	50                   	push   %eax
+  802226:	ff 75 08             	push   0x8(%ebp)
+  802229:	e8 d3 fb ff ff       	call   801e01 <fd_lookup>
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	85 c0                	test   %eax,%eax
+  802233:	78 0e                	js     802243 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802235:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80223b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80223e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802243:	c9                   	leave
+  802244:	c3                   	ret
+
+00802245 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802245:	55                   	push   %ebp
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	53                   	push   %ebx
+  802249:	83 ec 1c             	sub    $0x1c,%esp
+  80224c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80224f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802252:	50                   	push   %eax
+  802253:	ff 75 08             	push   0x8(%ebp)
+  802256:	e8 a6 fb ff ff       	call   801e01 <fd_lookup>
+  80225b:	83 c4 10             	add    $0x10,%esp
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	78 33                	js     802295 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802262:	83 fb 03             	cmp    $0x3,%ebx
+  802265:	74 28                	je     80228f <fcntl+0x4a>
+  802267:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80226c:	83 fb 04             	cmp    $0x4,%ebx
+  80226f:	75 24                	jne    802295 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802271:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802274:	8b 41 08             	mov    0x8(%ecx),%eax
+  802277:	80 e4 ef             	and    $0xef,%ah
+  80227a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80227d:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802283:	09 d0                	or     %edx,%eax
+  802285:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802288:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228d:	eb 06                	jmp    802295 <fcntl+0x50>
+		return fd->fd_omode;
+  80228f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802292:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+
+0080229a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80229a:	55                   	push   %ebp
+  80229b:	89 e5                	mov    %esp,%ebp
+  80229d:	56                   	push   %esi
+  80229e:	53                   	push   %ebx
+  80229f:	83 ec 18             	sub    $0x18,%esp
+  8022a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022a8:	50                   	push   %eax
+  8022a9:	53                   	push   %ebx
+  8022aa:	e8 52 fb ff ff       	call   801e01 <fd_lookup>
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 34                	js     8022ea <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022b6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022b9:	83 ec 08             	sub    $0x8,%esp
+  8022bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022bf:	50                   	push   %eax
+  8022c0:	ff 36                	push   (%esi)
+  8022c2:	e8 8c fb ff ff       	call   801e53 <dev_lookup>
+  8022c7:	83 c4 10             	add    $0x10,%esp
+  8022ca:	85 c0                	test   %eax,%eax
+  8022cc:	78 1c                	js     8022ea <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022ce:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8022d2:	74 1d                	je     8022f1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8022d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d7:	8b 40 18             	mov    0x18(%eax),%eax
+  8022da:	85 c0                	test   %eax,%eax
+  8022dc:	74 51                	je     80232f <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8022de:	83 ec 08             	sub    $0x8,%esp
+  8022e1:	ff 75 0c             	push   0xc(%ebp)
+  8022e4:	56                   	push   %esi
+  8022e5:	ff d0                	call   *%eax
+  8022e7:	83 c4 10             	add    $0x10,%esp
+}
+  8022ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ed:	5b                   	pop    %ebx
+  8022ee:	5e                   	pop    %esi
+  8022ef:	5d                   	pop    %ebp
+  8022f0:	c3                   	ret
+  8022f1:	89 e2                	mov    %esp,%edx
+  8022f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8022f8:	29 d0                	sub    %edx,%eax
+  8022fa:	89 c2                	mov    %eax,%edx
+  8022fc:	c1 ea 0f             	shr    $0xf,%edx
+  8022ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802304:	b8 00 00 00 00       	mov    $0x0,%eax
+  802309:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80230c:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802313:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802316:	83 ec 04             	sub    $0x4,%esp
+  802319:	53                   	push   %ebx
+  80231a:	50                   	push   %eax
+  80231b:	68 cc 4a 80 00       	push   $0x804acc
+  802320:	e8 23 e0 ff ff       	call   800348 <cprintf>
+		return -E_INVAL;
+  802325:	83 c4 10             	add    $0x10,%esp
+  802328:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80232d:	eb bb                	jmp    8022ea <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80232f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802334:	eb b4                	jmp    8022ea <ftruncate+0x50>
+
+00802336 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	56                   	push   %esi
+  80233a:	53                   	push   %ebx
+  80233b:	83 ec 18             	sub    $0x18,%esp
+  80233e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802341:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802344:	50                   	push   %eax
+  802345:	ff 75 08             	push   0x8(%ebp)
+  802348:	e8 b4 fa ff ff       	call   801e01 <fd_lookup>
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	85 c0                	test   %eax,%eax
+  802352:	78 53                	js     8023a7 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802354:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802357:	83 ec 08             	sub    $0x8,%esp
+  80235a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80235d:	50                   	push   %eax
+  80235e:	ff 36                	push   (%esi)
+  802360:	e8 ee fa ff ff       	call   801e53 <dev_lookup>
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	85 c0                	test   %eax,%eax
+  80236a:	78 3b                	js     8023a7 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80236c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802373:	74 39                	je     8023ae <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802375:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802378:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80237f:	00 00 00 
+	stat->st_isdir = 0;
+  802382:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802389:	00 00 00 
+	stat->st_version = 0;
+  80238c:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802393:	00 00 00 
+	stat->st_dev = dev;
+  802396:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80239c:	83 ec 08             	sub    $0x8,%esp
+  80239f:	53                   	push   %ebx
+  8023a0:	56                   	push   %esi
+  8023a1:	ff 50 14             	call   *0x14(%eax)
+  8023a4:	83 c4 10             	add    $0x10,%esp
+}
+  8023a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023aa:	5b                   	pop    %ebx
+  8023ab:	5e                   	pop    %esi
+  8023ac:	5d                   	pop    %ebp
+  8023ad:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023b3:	eb f2                	jmp    8023a7 <fstat+0x71>
+
+008023b5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8023b5:	55                   	push   %ebp
+  8023b6:	89 e5                	mov    %esp,%ebp
+  8023b8:	56                   	push   %esi
+  8023b9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8023ba:	83 ec 08             	sub    $0x8,%esp
+  8023bd:	6a 00                	push   $0x0
+  8023bf:	ff 75 08             	push   0x8(%ebp)
+  8023c2:	e8 b7 01 00 00       	call   80257e <open>
+  8023c7:	89 c3                	mov    %eax,%ebx
+  8023c9:	83 c4 10             	add    $0x10,%esp
+  8023cc:	85 c0                	test   %eax,%eax
+  8023ce:	78 1b                	js     8023eb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8023d0:	83 ec 08             	sub    $0x8,%esp
+  8023d3:	ff 75 0c             	push   0xc(%ebp)
+  8023d6:	50                   	push   %eax
+  8023d7:	e8 5a ff ff ff       	call   802336 <fstat>
+  8023dc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8023de:	89 1c 24             	mov    %ebx,(%esp)
+  8023e1:	e8 60 fb ff ff       	call   801f46 <close>
+	return r;
+  8023e6:	83 c4 10             	add    $0x10,%esp
+  8023e9:	89 f3                	mov    %esi,%ebx
+}
+  8023eb:	89 d8                	mov    %ebx,%eax
+  8023ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023f0:	5b                   	pop    %ebx
+  8023f1:	5e                   	pop    %esi
+  8023f2:	5d                   	pop    %ebp
+  8023f3:	c3                   	ret
+
+008023f4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8023f4:	55                   	push   %ebp
+  8023f5:	89 e5                	mov    %esp,%ebp
+  8023f7:	56                   	push   %esi
+  8023f8:	53                   	push   %ebx
+  8023f9:	89 c6                	mov    %eax,%esi
+  8023fb:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8023fd:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802404:	74 27                	je     80242d <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802406:	6a 07                	push   $0x7
+  802408:	68 00 70 80 00       	push   $0x807000
+  80240d:	56                   	push   %esi
+  80240e:	ff 35 c4 66 80 00    	push   0x8066c4
+  802414:	e8 c9 f8 ff ff       	call   801ce2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802419:	83 c4 0c             	add    $0xc,%esp
+  80241c:	6a 00                	push   $0x0
+  80241e:	53                   	push   %ebx
+  80241f:	6a 00                	push   $0x0
+  802421:	e8 2c f6 ff ff       	call   801a52 <ipc_recv>
+}
+  802426:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802429:	5b                   	pop    %ebx
+  80242a:	5e                   	pop    %esi
+  80242b:	5d                   	pop    %ebp
+  80242c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80242d:	83 ec 0c             	sub    $0xc,%esp
+  802430:	6a 02                	push   $0x2
+  802432:	e8 14 f9 ff ff       	call   801d4b <ipc_find_env>
+  802437:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  80243c:	83 c4 10             	add    $0x10,%esp
+  80243f:	eb c5                	jmp    802406 <fsipc+0x12>
+
+00802441 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802441:	55                   	push   %ebp
+  802442:	89 e5                	mov    %esp,%ebp
+  802444:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802447:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80244d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802452:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802455:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80245a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802464:	e8 8b ff ff ff       	call   8023f4 <fsipc>
+}
+  802469:	c9                   	leave
+  80246a:	c3                   	ret
+
+0080246b <devfile_flush>:
+{
+  80246b:	55                   	push   %ebp
+  80246c:	89 e5                	mov    %esp,%ebp
+  80246e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802471:	8b 45 08             	mov    0x8(%ebp),%eax
+  802474:	8b 40 0c             	mov    0xc(%eax),%eax
+  802477:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80247c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802481:	b8 06 00 00 00       	mov    $0x6,%eax
+  802486:	e8 69 ff ff ff       	call   8023f4 <fsipc>
+}
+  80248b:	c9                   	leave
+  80248c:	c3                   	ret
+
+0080248d <devfile_stat>:
+{
+  80248d:	55                   	push   %ebp
+  80248e:	89 e5                	mov    %esp,%ebp
+  802490:	53                   	push   %ebx
+  802491:	83 ec 04             	sub    $0x4,%esp
+  802494:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802497:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80249d:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8024a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024ac:	e8 43 ff ff ff       	call   8023f4 <fsipc>
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	78 37                	js     8024ec <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8024b5:	83 ec 08             	sub    $0x8,%esp
+  8024b8:	68 00 70 80 00       	push   $0x807000
+  8024bd:	53                   	push   %ebx
+  8024be:	e8 7c e5 ff ff       	call   800a3f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8024c3:	a1 80 70 80 00       	mov    0x807080,%eax
+  8024c8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8024ce:	a1 84 70 80 00       	mov    0x807084,%eax
+  8024d3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8024d9:	a1 88 70 80 00       	mov    0x807088,%eax
+  8024de:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8024e4:	83 c4 10             	add    $0x10,%esp
+  8024e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+
+008024f1 <devfile_write>:
+{
+  8024f1:	55                   	push   %ebp
+  8024f2:	89 e5                	mov    %esp,%ebp
+  8024f4:	83 ec 0c             	sub    $0xc,%esp
+  8024f7:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8024fa:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8024ff:	39 d0                	cmp    %edx,%eax
+  802501:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802504:	8b 55 08             	mov    0x8(%ebp),%edx
+  802507:	8b 52 0c             	mov    0xc(%edx),%edx
+  80250a:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  802510:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802515:	50                   	push   %eax
+  802516:	ff 75 0c             	push   0xc(%ebp)
+  802519:	68 08 70 80 00       	push   $0x807008
+  80251e:	e8 cc e6 ff ff       	call   800bef <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802523:	ba 00 00 00 00       	mov    $0x0,%edx
+  802528:	b8 04 00 00 00       	mov    $0x4,%eax
+  80252d:	e8 c2 fe ff ff       	call   8023f4 <fsipc>
+}
+  802532:	c9                   	leave
+  802533:	c3                   	ret
+
+00802534 <devfile_read>:
+{
+  802534:	55                   	push   %ebp
+  802535:	89 e5                	mov    %esp,%ebp
+  802537:	53                   	push   %ebx
+  802538:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80253b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802541:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802546:	8b 45 10             	mov    0x10(%ebp),%eax
+  802549:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80254e:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802553:	b8 03 00 00 00       	mov    $0x3,%eax
+  802558:	e8 97 fe ff ff       	call   8023f4 <fsipc>
+  80255d:	89 c3                	mov    %eax,%ebx
+  80255f:	85 c0                	test   %eax,%eax
+  802561:	78 14                	js     802577 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802563:	83 ec 04             	sub    $0x4,%esp
+  802566:	50                   	push   %eax
+  802567:	68 00 70 80 00       	push   $0x807000
+  80256c:	ff 75 0c             	push   0xc(%ebp)
+  80256f:	e8 7b e6 ff ff       	call   800bef <memmove>
+	return r;
+  802574:	83 c4 10             	add    $0x10,%esp
+}
+  802577:	89 d8                	mov    %ebx,%eax
+  802579:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80257c:	c9                   	leave
+  80257d:	c3                   	ret
+
+0080257e <open>:
+{
+  80257e:	55                   	push   %ebp
+  80257f:	89 e5                	mov    %esp,%ebp
+  802581:	53                   	push   %ebx
+  802582:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802585:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802588:	50                   	push   %eax
+  802589:	e8 23 f8 ff ff       	call   801db1 <fd_alloc>
+  80258e:	89 c3                	mov    %eax,%ebx
+  802590:	83 c4 10             	add    $0x10,%esp
+  802593:	85 c0                	test   %eax,%eax
+  802595:	78 2a                	js     8025c1 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802597:	83 ec 0c             	sub    $0xc,%esp
+  80259a:	ff 75 08             	push   0x8(%ebp)
+  80259d:	e8 51 e4 ff ff       	call   8009f3 <strlen>
+  8025a2:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8025a5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8025aa:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8025af:	7e 17                	jle    8025c8 <open+0x4a>
+	fd_close(fd, 1);
+  8025b1:	83 ec 08             	sub    $0x8,%esp
+  8025b4:	6a 01                	push   $0x1
+  8025b6:	ff 75 f4             	push   -0xc(%ebp)
+  8025b9:	e8 08 f9 ff ff       	call   801ec6 <fd_close>
+	return r;
+  8025be:	83 c4 10             	add    $0x10,%esp
+}
+  8025c1:	89 d8                	mov    %ebx,%eax
+  8025c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025c6:	c9                   	leave
+  8025c7:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8025c8:	83 ec 08             	sub    $0x8,%esp
+  8025cb:	ff 75 08             	push   0x8(%ebp)
+  8025ce:	68 00 70 80 00       	push   $0x807000
+  8025d3:	e8 67 e4 ff ff       	call   800a3f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8025d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025db:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8025e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025e8:	e8 07 fe ff ff       	call   8023f4 <fsipc>
+  8025ed:	89 c3                	mov    %eax,%ebx
+  8025ef:	83 c4 10             	add    $0x10,%esp
+  8025f2:	85 c0                	test   %eax,%eax
+  8025f4:	78 bb                	js     8025b1 <open+0x33>
+	return fd2num(fd); 	
+  8025f6:	83 ec 0c             	sub    $0xc,%esp
+  8025f9:	ff 75 f4             	push   -0xc(%ebp)
+  8025fc:	e8 89 f7 ff ff       	call   801d8a <fd2num>
+  802601:	89 c3                	mov    %eax,%ebx
+  802603:	83 c4 10             	add    $0x10,%esp
+  802606:	eb b9                	jmp    8025c1 <open+0x43>
+
+00802608 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802608:	55                   	push   %ebp
+  802609:	89 e5                	mov    %esp,%ebp
+  80260b:	53                   	push   %ebx
+  80260c:	83 ec 1c             	sub    $0x1c,%esp
+  80260f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802612:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802615:	50                   	push   %eax
+  802616:	ff 75 08             	push   0x8(%ebp)
+  802619:	e8 e3 f7 ff ff       	call   801e01 <fd_lookup>
+  80261e:	83 c4 10             	add    $0x10,%esp
+  802621:	85 c0                	test   %eax,%eax
+  802623:	78 5a                	js     80267f <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802625:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802628:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80262e:	39 10                	cmp    %edx,(%eax)
+  802630:	75 66                	jne    802698 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802632:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802639:	74 49                	je     802684 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80263b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80263e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802641:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802646:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802649:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  80264e:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802654:	6a 07                	push   $0x7
+  802656:	68 00 70 80 00       	push   $0x807000
+  80265b:	6a 09                	push   $0x9
+  80265d:	ff 35 c4 66 80 00    	push   0x8066c4
+  802663:	e8 7a f6 ff ff       	call   801ce2 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802668:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80266f:	6a 00                	push   $0x0
+  802671:	53                   	push   %ebx
+  802672:	ff 75 10             	push   0x10(%ebp)
+  802675:	6a 00                	push   $0x0
+  802677:	e8 a3 f4 ff ff       	call   801b1f <ipc_recv_pages>
+  80267c:	83 c4 20             	add    $0x20,%esp
+}
+  80267f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802682:	c9                   	leave
+  802683:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802684:	83 ec 0c             	sub    $0xc,%esp
+  802687:	6a 02                	push   $0x2
+  802689:	e8 bd f6 ff ff       	call   801d4b <ipc_find_env>
+  80268e:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	eb a3                	jmp    80263b <fmap+0x33>
+		return -E_INVAL;
+  802698:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80269d:	eb e0                	jmp    80267f <fmap+0x77>
+
+0080269f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80269f:	55                   	push   %ebp
+  8026a0:	89 e5                	mov    %esp,%ebp
+  8026a2:	53                   	push   %ebx
+  8026a3:	83 ec 10             	sub    $0x10,%esp
+  8026a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8026a9:	53                   	push   %ebx
+  8026aa:	e8 44 e3 ff ff       	call   8009f3 <strlen>
+  8026af:	83 c4 10             	add    $0x10,%esp
+  8026b2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026b7:	7f 25                	jg     8026de <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8026b9:	83 ec 08             	sub    $0x8,%esp
+  8026bc:	53                   	push   %ebx
+  8026bd:	68 00 70 80 00       	push   $0x807000
+  8026c2:	e8 78 e3 ff ff       	call   800a3f <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8026c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026cc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026d1:	e8 1e fd ff ff       	call   8023f4 <fsipc>
+  8026d6:	83 c4 10             	add    $0x10,%esp
+}
+  8026d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026dc:	c9                   	leave
+  8026dd:	c3                   	ret
+		return -E_BAD_PATH;
+  8026de:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026e3:	eb f4                	jmp    8026d9 <remove+0x3a>
+
+008026e5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8026e5:	55                   	push   %ebp
+  8026e6:	89 e5                	mov    %esp,%ebp
+  8026e8:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8026eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026f5:	e8 fa fc ff ff       	call   8023f4 <fsipc>
+}
+  8026fa:	c9                   	leave
+  8026fb:	c3                   	ret
+
+008026fc <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026fc:	55                   	push   %ebp
+  8026fd:	89 e5                	mov    %esp,%ebp
+  8026ff:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802702:	68 3c 4b 80 00       	push   $0x804b3c
+  802707:	ff 75 0c             	push   0xc(%ebp)
+  80270a:	e8 30 e3 ff ff       	call   800a3f <strcpy>
+	return 0;
+}
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802714:	c9                   	leave
+  802715:	c3                   	ret
+
+00802716 <devsock_close>:
+{
+  802716:	55                   	push   %ebp
+  802717:	89 e5                	mov    %esp,%ebp
+  802719:	53                   	push   %ebx
+  80271a:	83 ec 10             	sub    $0x10,%esp
+  80271d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802720:	53                   	push   %ebx
+  802721:	e8 23 1c 00 00       	call   804349 <pageref>
+  802726:	89 c2                	mov    %eax,%edx
+  802728:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80272b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802730:	83 fa 01             	cmp    $0x1,%edx
+  802733:	74 05                	je     80273a <devsock_close+0x24>
+}
+  802735:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802738:	c9                   	leave
+  802739:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80273a:	83 ec 0c             	sub    $0xc,%esp
+  80273d:	ff 73 0c             	push   0xc(%ebx)
+  802740:	e8 b0 05 00 00       	call   802cf5 <nsipc_close>
+  802745:	83 c4 10             	add    $0x10,%esp
+  802748:	eb eb                	jmp    802735 <devsock_close+0x1f>
+
+0080274a <devsock_write>:
+{
+  80274a:	55                   	push   %ebp
+  80274b:	89 e5                	mov    %esp,%ebp
+  80274d:	53                   	push   %ebx
+  80274e:	83 ec 14             	sub    $0x14,%esp
+  802751:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802754:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802757:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80275a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80275d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802760:	8b 41 08             	mov    0x8(%ecx),%eax
+  802763:	c1 f8 09             	sar    $0x9,%eax
+  802766:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802769:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80276f:	77 13                	ja     802784 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802771:	50                   	push   %eax
+  802772:	52                   	push   %edx
+  802773:	53                   	push   %ebx
+  802774:	ff 71 0c             	push   0xc(%ecx)
+  802777:	e8 5c 06 00 00       	call   802dd8 <nsipc_send>
+  80277c:	83 c4 10             	add    $0x10,%esp
+}
+  80277f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802782:	c9                   	leave
+  802783:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802784:	50                   	push   %eax
+  802785:	6a 01                	push   $0x1
+  802787:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80278a:	50                   	push   %eax
+  80278b:	ff 71 0c             	push   0xc(%ecx)
+  80278e:	e8 a6 06 00 00       	call   802e39 <nsipc_sendmsg>
+  802793:	83 c4 10             	add    $0x10,%esp
+  802796:	eb e7                	jmp    80277f <devsock_write+0x35>
+
+00802798 <devsock_read>:
+{
+  802798:	55                   	push   %ebp
+  802799:	89 e5                	mov    %esp,%ebp
+  80279b:	53                   	push   %ebx
+  80279c:	83 ec 14             	sub    $0x14,%esp
+  80279f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027a5:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8027a8:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8027ab:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8027ae:	8b 41 08             	mov    0x8(%ecx),%eax
+  8027b1:	c1 f8 09             	sar    $0x9,%eax
+  8027b4:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8027b7:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8027bd:	77 13                	ja     8027d2 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8027bf:	50                   	push   %eax
+  8027c0:	52                   	push   %edx
+  8027c1:	53                   	push   %ebx
+  8027c2:	ff 71 0c             	push   0xc(%ecx)
+  8027c5:	e8 9c 05 00 00       	call   802d66 <nsipc_recv>
+  8027ca:	83 c4 10             	add    $0x10,%esp
+}
+  8027cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d0:	c9                   	leave
+  8027d1:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8027d2:	50                   	push   %eax
+  8027d3:	6a 01                	push   $0x1
+  8027d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027d8:	50                   	push   %eax
+  8027d9:	ff 71 0c             	push   0xc(%ecx)
+  8027dc:	e8 02 0a 00 00       	call   8031e3 <nsipc_recvmsg>
+  8027e1:	83 c4 10             	add    $0x10,%esp
+  8027e4:	eb e7                	jmp    8027cd <devsock_read+0x35>
+
+008027e6 <fd2sockid>:
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027ec:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027ef:	52                   	push   %edx
+  8027f0:	50                   	push   %eax
+  8027f1:	e8 0b f6 ff ff       	call   801e01 <fd_lookup>
+  8027f6:	83 c4 10             	add    $0x10,%esp
+  8027f9:	85 c0                	test   %eax,%eax
+  8027fb:	78 10                	js     80280d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802800:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802806:	39 08                	cmp    %ecx,(%eax)
+  802808:	75 05                	jne    80280f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80280a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80280f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802814:	eb f7                	jmp    80280d <fd2sockid+0x27>
+
+00802816 <sock_flags>:
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  80281c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80281f:	52                   	push   %edx
+  802820:	50                   	push   %eax
+  802821:	e8 db f5 ff ff       	call   801e01 <fd_lookup>
+  802826:	83 c4 10             	add    $0x10,%esp
+  802829:	85 c0                	test   %eax,%eax
+  80282b:	78 0e                	js     80283b <sock_flags+0x25>
+  80282d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802830:	8b 40 08             	mov    0x8(%eax),%eax
+  802833:	c1 e8 09             	shr    $0x9,%eax
+  802836:	83 e0 08             	and    $0x8,%eax
+}
+  802839:	c9                   	leave
+  80283a:	c3                   	ret
+		return 0;
+  80283b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802840:	eb f7                	jmp    802839 <sock_flags+0x23>
+
+00802842 <alloc_sockfd>:
+{
+  802842:	55                   	push   %ebp
+  802843:	89 e5                	mov    %esp,%ebp
+  802845:	56                   	push   %esi
+  802846:	53                   	push   %ebx
+  802847:	83 ec 1c             	sub    $0x1c,%esp
+  80284a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80284c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80284f:	50                   	push   %eax
+  802850:	e8 5c f5 ff ff       	call   801db1 <fd_alloc>
+  802855:	89 c3                	mov    %eax,%ebx
+  802857:	83 c4 10             	add    $0x10,%esp
+  80285a:	85 c0                	test   %eax,%eax
+  80285c:	78 43                	js     8028a1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80285e:	83 ec 04             	sub    $0x4,%esp
+  802861:	68 07 04 00 00       	push   $0x407
+  802866:	ff 75 f4             	push   -0xc(%ebp)
+  802869:	6a 00                	push   $0x0
+  80286b:	e8 03 e6 ff ff       	call   800e73 <sys_page_alloc>
+  802870:	89 c3                	mov    %eax,%ebx
+  802872:	83 c4 10             	add    $0x10,%esp
+  802875:	85 c0                	test   %eax,%eax
+  802877:	78 28                	js     8028a1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802879:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80287c:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802882:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802884:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802887:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80288e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802891:	83 ec 0c             	sub    $0xc,%esp
+  802894:	50                   	push   %eax
+  802895:	e8 f0 f4 ff ff       	call   801d8a <fd2num>
+  80289a:	89 c3                	mov    %eax,%ebx
+  80289c:	83 c4 10             	add    $0x10,%esp
+  80289f:	eb 0c                	jmp    8028ad <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8028a1:	83 ec 0c             	sub    $0xc,%esp
+  8028a4:	56                   	push   %esi
+  8028a5:	e8 4b 04 00 00       	call   802cf5 <nsipc_close>
+		return r;
+  8028aa:	83 c4 10             	add    $0x10,%esp
+}
+  8028ad:	89 d8                	mov    %ebx,%eax
+  8028af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028b2:	5b                   	pop    %ebx
+  8028b3:	5e                   	pop    %esi
+  8028b4:	5d                   	pop    %ebp
+  8028b5:	c3                   	ret
+
+008028b6 <accept>:
+{
+  8028b6:	55                   	push   %ebp
+  8028b7:	89 e5                	mov    %esp,%ebp
+  8028b9:	56                   	push   %esi
+  8028ba:	53                   	push   %ebx
+  8028bb:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8028be:	89 f0                	mov    %esi,%eax
+  8028c0:	e8 21 ff ff ff       	call   8027e6 <fd2sockid>
+  8028c5:	89 c3                	mov    %eax,%ebx
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	78 24                	js     8028ef <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8028cb:	89 f0                	mov    %esi,%eax
+  8028cd:	e8 44 ff ff ff       	call   802816 <sock_flags>
+  8028d2:	50                   	push   %eax
+  8028d3:	ff 75 10             	push   0x10(%ebp)
+  8028d6:	ff 75 0c             	push   0xc(%ebp)
+  8028d9:	53                   	push   %ebx
+  8028da:	e8 6b 03 00 00       	call   802c4a <nsipc_accept>
+  8028df:	89 c3                	mov    %eax,%ebx
+  8028e1:	83 c4 10             	add    $0x10,%esp
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	78 07                	js     8028ef <accept+0x39>
+	return alloc_sockfd(r);
+  8028e8:	e8 55 ff ff ff       	call   802842 <alloc_sockfd>
+  8028ed:	89 c3                	mov    %eax,%ebx
+}
+  8028ef:	89 d8                	mov    %ebx,%eax
+  8028f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028f4:	5b                   	pop    %ebx
+  8028f5:	5e                   	pop    %esi
+  8028f6:	5d                   	pop    %ebp
+  8028f7:	c3                   	ret
+
+008028f8 <bind>:
+{
+  8028f8:	55                   	push   %ebp
+  8028f9:	89 e5                	mov    %esp,%ebp
+  8028fb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802901:	e8 e0 fe ff ff       	call   8027e6 <fd2sockid>
+  802906:	85 c0                	test   %eax,%eax
+  802908:	78 12                	js     80291c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80290a:	83 ec 04             	sub    $0x4,%esp
+  80290d:	ff 75 10             	push   0x10(%ebp)
+  802910:	ff 75 0c             	push   0xc(%ebp)
+  802913:	50                   	push   %eax
+  802914:	e8 85 03 00 00       	call   802c9e <nsipc_bind>
+  802919:	83 c4 10             	add    $0x10,%esp
+}
+  80291c:	c9                   	leave
+  80291d:	c3                   	ret
+
+0080291e <shutdown>:
+{
+  80291e:	55                   	push   %ebp
+  80291f:	89 e5                	mov    %esp,%ebp
+  802921:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802924:	8b 45 08             	mov    0x8(%ebp),%eax
+  802927:	e8 ba fe ff ff       	call   8027e6 <fd2sockid>
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	78 0f                	js     80293f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802930:	83 ec 08             	sub    $0x8,%esp
+  802933:	ff 75 0c             	push   0xc(%ebp)
+  802936:	50                   	push   %eax
+  802937:	e8 97 03 00 00       	call   802cd3 <nsipc_shutdown>
+  80293c:	83 c4 10             	add    $0x10,%esp
+}
+  80293f:	c9                   	leave
+  802940:	c3                   	ret
+
+00802941 <connect>:
+{
+  802941:	55                   	push   %ebp
+  802942:	89 e5                	mov    %esp,%ebp
+  802944:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294a:	e8 97 fe ff ff       	call   8027e6 <fd2sockid>
+  80294f:	85 c0                	test   %eax,%eax
+  802951:	78 12                	js     802965 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802953:	83 ec 04             	sub    $0x4,%esp
+  802956:	ff 75 10             	push   0x10(%ebp)
+  802959:	ff 75 0c             	push   0xc(%ebp)
+  80295c:	50                   	push   %eax
+  80295d:	e8 ad 03 00 00       	call   802d0f <nsipc_connect>
+  802962:	83 c4 10             	add    $0x10,%esp
+}
+  802965:	c9                   	leave
+  802966:	c3                   	ret
+
+00802967 <listen>:
+{
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80296d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802970:	e8 71 fe ff ff       	call   8027e6 <fd2sockid>
+  802975:	85 c0                	test   %eax,%eax
+  802977:	78 0f                	js     802988 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802979:	83 ec 08             	sub    $0x8,%esp
+  80297c:	ff 75 0c             	push   0xc(%ebp)
+  80297f:	50                   	push   %eax
+  802980:	e8 bf 03 00 00       	call   802d44 <nsipc_listen>
+  802985:	83 c4 10             	add    $0x10,%esp
+}
+  802988:	c9                   	leave
+  802989:	c3                   	ret
+
+0080298a <sendmsg>:
+{
+  80298a:	55                   	push   %ebp
+  80298b:	89 e5                	mov    %esp,%ebp
+  80298d:	57                   	push   %edi
+  80298e:	56                   	push   %esi
+  80298f:	53                   	push   %ebx
+  802990:	83 ec 0c             	sub    $0xc,%esp
+  802993:	8b 75 08             	mov    0x8(%ebp),%esi
+  802996:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802999:	89 f0                	mov    %esi,%eax
+  80299b:	e8 46 fe ff ff       	call   8027e6 <fd2sockid>
+  8029a0:	89 c3                	mov    %eax,%ebx
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	78 1c                	js     8029c2 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8029a6:	89 f0                	mov    %esi,%eax
+  8029a8:	e8 69 fe ff ff       	call   802816 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8029ad:	0b 45 10             	or     0x10(%ebp),%eax
+  8029b0:	50                   	push   %eax
+  8029b1:	ff 77 0c             	push   0xc(%edi)
+  8029b4:	ff 77 08             	push   0x8(%edi)
+  8029b7:	53                   	push   %ebx
+  8029b8:	e8 7c 04 00 00       	call   802e39 <nsipc_sendmsg>
+  8029bd:	89 c3                	mov    %eax,%ebx
+  8029bf:	83 c4 10             	add    $0x10,%esp
+}
+  8029c2:	89 d8                	mov    %ebx,%eax
+  8029c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029c7:	5b                   	pop    %ebx
+  8029c8:	5e                   	pop    %esi
+  8029c9:	5f                   	pop    %edi
+  8029ca:	5d                   	pop    %ebp
+  8029cb:	c3                   	ret
+
+008029cc <recvmsg>:
+{
+  8029cc:	55                   	push   %ebp
+  8029cd:	89 e5                	mov    %esp,%ebp
+  8029cf:	57                   	push   %edi
+  8029d0:	56                   	push   %esi
+  8029d1:	53                   	push   %ebx
+  8029d2:	83 ec 0c             	sub    $0xc,%esp
+  8029d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8029db:	89 f8                	mov    %edi,%eax
+  8029dd:	e8 04 fe ff ff       	call   8027e6 <fd2sockid>
+  8029e2:	89 c3                	mov    %eax,%ebx
+  8029e4:	85 c0                	test   %eax,%eax
+  8029e6:	78 2a                	js     802a12 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8029e8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8029ef:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8029f6:	89 f8                	mov    %edi,%eax
+  8029f8:	e8 19 fe ff ff       	call   802816 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8029fd:	0b 45 10             	or     0x10(%ebp),%eax
+  802a00:	50                   	push   %eax
+  802a01:	ff 76 0c             	push   0xc(%esi)
+  802a04:	ff 76 08             	push   0x8(%esi)
+  802a07:	53                   	push   %ebx
+  802a08:	e8 d6 07 00 00       	call   8031e3 <nsipc_recvmsg>
+  802a0d:	89 c3                	mov    %eax,%ebx
+  802a0f:	83 c4 10             	add    $0x10,%esp
+}
+  802a12:	89 d8                	mov    %ebx,%eax
+  802a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a17:	5b                   	pop    %ebx
+  802a18:	5e                   	pop    %esi
+  802a19:	5f                   	pop    %edi
+  802a1a:	5d                   	pop    %ebp
+  802a1b:	c3                   	ret
+
+00802a1c <sendfile>:
+{
+  802a1c:	55                   	push   %ebp
+  802a1d:	89 e5                	mov    %esp,%ebp
+  802a1f:	56                   	push   %esi
+  802a20:	53                   	push   %ebx
+  802a21:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802a24:	89 f0                	mov    %esi,%eax
+  802a26:	e8 bb fd ff ff       	call   8027e6 <fd2sockid>
+  802a2b:	89 c3                	mov    %eax,%ebx
+  802a2d:	85 c0                	test   %eax,%eax
+  802a2f:	78 1f                	js     802a50 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802a31:	89 f0                	mov    %esi,%eax
+  802a33:	e8 de fd ff ff       	call   802816 <sock_flags>
+  802a38:	83 ec 0c             	sub    $0xc,%esp
+  802a3b:	50                   	push   %eax
+  802a3c:	ff 75 14             	push   0x14(%ebp)
+  802a3f:	ff 75 10             	push   0x10(%ebp)
+  802a42:	ff 75 0c             	push   0xc(%ebp)
+  802a45:	53                   	push   %ebx
+  802a46:	e8 64 06 00 00       	call   8030af <nsipc_sendfile>
+  802a4b:	89 c3                	mov    %eax,%ebx
+  802a4d:	83 c4 20             	add    $0x20,%esp
+}
+  802a50:	89 d8                	mov    %ebx,%eax
+  802a52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a55:	5b                   	pop    %ebx
+  802a56:	5e                   	pop    %esi
+  802a57:	5d                   	pop    %ebp
+  802a58:	c3                   	ret
+
+00802a59 <evctl>:
+{
+  802a59:	55                   	push   %ebp
+  802a5a:	89 e5                	mov    %esp,%ebp
+  802a5c:	53                   	push   %ebx
+  802a5d:	83 ec 04             	sub    $0x4,%esp
+  802a60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802a63:	89 d8                	mov    %ebx,%eax
+  802a65:	e8 7c fd ff ff       	call   8027e6 <fd2sockid>
+  802a6a:	85 c0                	test   %eax,%eax
+  802a6c:	78 10                	js     802a7e <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802a6e:	83 ec 04             	sub    $0x4,%esp
+  802a71:	53                   	push   %ebx
+  802a72:	ff 75 0c             	push   0xc(%ebp)
+  802a75:	50                   	push   %eax
+  802a76:	e8 d2 0b 00 00       	call   80364d <nsipc_evctl>
+  802a7b:	83 c4 10             	add    $0x10,%esp
+}
+  802a7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a81:	c9                   	leave
+  802a82:	c3                   	ret
+
+00802a83 <evwait>:
+{
+  802a83:	55                   	push   %ebp
+  802a84:	89 e5                	mov    %esp,%ebp
+  802a86:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802a89:	ff 75 10             	push   0x10(%ebp)
+  802a8c:	ff 75 0c             	push   0xc(%ebp)
+  802a8f:	ff 75 08             	push   0x8(%ebp)
+  802a92:	e8 e0 0b 00 00       	call   803677 <nsipc_evwait>
+}
+  802a97:	c9                   	leave
+  802a98:	c3                   	ret
+
+00802a99 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a99:	55                   	push   %ebp
+  802a9a:	89 e5                	mov    %esp,%ebp
+  802a9c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a9f:	ff 75 10             	push   0x10(%ebp)
+  802aa2:	ff 75 0c             	push   0xc(%ebp)
+  802aa5:	ff 75 08             	push   0x8(%ebp)
+  802aa8:	e8 31 0c 00 00       	call   8036de <nsipc_socket>
+  802aad:	83 c4 10             	add    $0x10,%esp
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	78 05                	js     802ab9 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802ab4:	e8 89 fd ff ff       	call   802842 <alloc_sockfd>
+}
+  802ab9:	c9                   	leave
+  802aba:	c3                   	ret
+
+00802abb <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802abb:	55                   	push   %ebp
+  802abc:	89 e5                	mov    %esp,%ebp
+  802abe:	53                   	push   %ebx
+  802abf:	83 ec 04             	sub    $0x4,%esp
+  802ac2:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802ac4:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802acb:	74 26                	je     802af3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802acd:	6a 07                	push   $0x7
+  802acf:	68 00 80 80 00       	push   $0x808000
+  802ad4:	53                   	push   %ebx
+  802ad5:	ff 35 e4 69 80 00    	push   0x8069e4
+  802adb:	e8 02 f2 ff ff       	call   801ce2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802ae0:	83 c4 0c             	add    $0xc,%esp
+  802ae3:	6a 00                	push   $0x0
+  802ae5:	6a 00                	push   $0x0
+  802ae7:	6a 00                	push   $0x0
+  802ae9:	e8 64 ef ff ff       	call   801a52 <ipc_recv>
+}
+  802aee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af1:	c9                   	leave
+  802af2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802af3:	83 ec 0c             	sub    $0xc,%esp
+  802af6:	6a 03                	push   $0x3
+  802af8:	e8 4e f2 ff ff       	call   801d4b <ipc_find_env>
+  802afd:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802b02:	83 c4 10             	add    $0x10,%esp
+  802b05:	eb c6                	jmp    802acd <nsipc+0x12>
+
+00802b07 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802b07:	55                   	push   %ebp
+  802b08:	89 e5                	mov    %esp,%ebp
+  802b0a:	56                   	push   %esi
+  802b0b:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802b0c:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  802b12:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802b17:	85 f6                	test   %esi,%esi
+  802b19:	75 33                	jne    802b4e <nsbulk_map+0x47>
+  802b1b:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802b20:	83 ec 04             	sub    $0x4,%esp
+  802b23:	6a 07                	push   $0x7
+  802b25:	53                   	push   %ebx
+  802b26:	6a 00                	push   $0x0
+  802b28:	e8 46 e3 ff ff       	call   800e73 <sys_page_alloc>
+  802b2d:	83 c4 10             	add    $0x10,%esp
+  802b30:	85 c0                	test   %eax,%eax
+  802b32:	78 1a                	js     802b4e <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802b34:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802b3a:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802b40:	75 de                	jne    802b20 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802b42:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802b49:	00 00 00 
+	return 0;
+  802b4c:	89 f0                	mov    %esi,%eax
+}
+  802b4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b51:	5b                   	pop    %ebx
+  802b52:	5e                   	pop    %esi
+  802b53:	5d                   	pop    %ebp
+  802b54:	c3                   	ret
+
+00802b55 <nsbulk_own>:
+{
+  802b55:	55                   	push   %ebp
+  802b56:	89 e5                	mov    %esp,%ebp
+  802b58:	57                   	push   %edi
+  802b59:	56                   	push   %esi
+  802b5a:	53                   	push   %ebx
+  802b5b:	83 ec 0c             	sub    $0xc,%esp
+  802b5e:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802b60:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802b63:	85 d2                	test   %edx,%edx
+  802b65:	7f 0e                	jg     802b75 <nsbulk_own+0x20>
+	return 0;
+  802b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6c:	eb 47                	jmp    802bb5 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802b6e:	83 c3 01             	add    $0x1,%ebx
+  802b71:	39 fb                	cmp    %edi,%ebx
+  802b73:	7d 3b                	jge    802bb0 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802b75:	be 01 00 00 00       	mov    $0x1,%esi
+  802b7a:	89 d9                	mov    %ebx,%ecx
+  802b7c:	d3 e6                	shl    %cl,%esi
+  802b7e:	89 f0                	mov    %esi,%eax
+  802b80:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802b86:	74 e6                	je     802b6e <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802b88:	83 ec 04             	sub    $0x4,%esp
+  802b8b:	6a 07                	push   $0x7
+  802b8d:	89 d8                	mov    %ebx,%eax
+  802b8f:	c1 e0 0c             	shl    $0xc,%eax
+  802b92:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b97:	50                   	push   %eax
+  802b98:	6a 00                	push   $0x0
+  802b9a:	e8 d4 e2 ff ff       	call   800e73 <sys_page_alloc>
+  802b9f:	83 c4 10             	add    $0x10,%esp
+  802ba2:	85 c0                	test   %eax,%eax
+  802ba4:	78 0f                	js     802bb5 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802ba6:	f7 d6                	not    %esi
+  802ba8:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802bae:	eb be                	jmp    802b6e <nsbulk_own+0x19>
+	return 0;
+  802bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb8:	5b                   	pop    %ebx
+  802bb9:	5e                   	pop    %esi
+  802bba:	5f                   	pop    %edi
+  802bbb:	5d                   	pop    %ebp
+  802bbc:	c3                   	ret
+
+00802bbd <nsipc_bulk>:
+{
+  802bbd:	55                   	push   %ebp
+  802bbe:	89 e5                	mov    %esp,%ebp
+  802bc0:	57                   	push   %edi
+  802bc1:	56                   	push   %esi
+  802bc2:	53                   	push   %ebx
+  802bc3:	83 ec 1c             	sub    $0x1c,%esp
+  802bc6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bc9:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802bcb:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802bd1:	c1 fb 0c             	sar    $0xc,%ebx
+  802bd4:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802bd7:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802bde:	74 56                	je     802c36 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802be0:	85 ff                	test   %edi,%edi
+  802be2:	7e 24                	jle    802c08 <nsipc_bulk+0x4b>
+  802be4:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802bea:	74 1c                	je     802c08 <nsipc_bulk+0x4b>
+  802bec:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802bf2:	c1 e3 0c             	shl    $0xc,%ebx
+  802bf5:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802bfa:	0f b6 10             	movzbl (%eax),%edx
+  802bfd:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802bff:	05 00 10 00 00       	add    $0x1000,%eax
+  802c04:	39 d8                	cmp    %ebx,%eax
+  802c06:	75 f2                	jne    802bfa <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802c08:	83 ec 0c             	sub    $0xc,%esp
+  802c0b:	56                   	push   %esi
+  802c0c:	57                   	push   %edi
+  802c0d:	68 00 00 00 e0       	push   $0xe0000000
+  802c12:	ff 75 e4             	push   -0x1c(%ebp)
+  802c15:	ff 35 e4 69 80 00    	push   0x8069e4
+  802c1b:	e8 f6 f0 ff ff       	call   801d16 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802c20:	83 c4 1c             	add    $0x1c,%esp
+  802c23:	6a 00                	push   $0x0
+  802c25:	6a 00                	push   $0x0
+  802c27:	6a 00                	push   $0x0
+  802c29:	e8 24 ee ff ff       	call   801a52 <ipc_recv>
+}
+  802c2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c31:	5b                   	pop    %ebx
+  802c32:	5e                   	pop    %esi
+  802c33:	5f                   	pop    %edi
+  802c34:	5d                   	pop    %ebp
+  802c35:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c36:	83 ec 0c             	sub    $0xc,%esp
+  802c39:	6a 03                	push   $0x3
+  802c3b:	e8 0b f1 ff ff       	call   801d4b <ipc_find_env>
+  802c40:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802c45:	83 c4 10             	add    $0x10,%esp
+  802c48:	eb 96                	jmp    802be0 <nsipc_bulk+0x23>
+
+00802c4a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802c4a:	55                   	push   %ebp
+  802c4b:	89 e5                	mov    %esp,%ebp
+  802c4d:	53                   	push   %ebx
+  802c4e:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c51:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c54:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802c59:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c5c:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c61:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c66:	e8 50 fe ff ff       	call   802abb <nsipc>
+  802c6b:	89 c3                	mov    %eax,%ebx
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	79 07                	jns    802c78 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c71:	89 d8                	mov    %ebx,%eax
+  802c73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c76:	c9                   	leave
+  802c77:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c78:	83 ec 04             	sub    $0x4,%esp
+  802c7b:	ff 35 10 80 80 00    	push   0x808010
+  802c81:	68 00 80 80 00       	push   $0x808000
+  802c86:	ff 75 0c             	push   0xc(%ebp)
+  802c89:	e8 61 df ff ff       	call   800bef <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c8e:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802c94:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c97:	89 10                	mov    %edx,(%eax)
+  802c99:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c9c:	eb d3                	jmp    802c71 <nsipc_accept+0x27>
+
+00802c9e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c9e:	55                   	push   %ebp
+  802c9f:	89 e5                	mov    %esp,%ebp
+  802ca1:	53                   	push   %ebx
+  802ca2:	83 ec 08             	sub    $0x8,%esp
+  802ca5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ca8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cab:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802cb0:	53                   	push   %ebx
+  802cb1:	ff 75 0c             	push   0xc(%ebp)
+  802cb4:	68 04 80 80 00       	push   $0x808004
+  802cb9:	e8 31 df ff ff       	call   800bef <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802cbe:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802cc4:	b8 02 00 00 00       	mov    $0x2,%eax
+  802cc9:	e8 ed fd ff ff       	call   802abb <nsipc>
+}
+  802cce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd1:	c9                   	leave
+  802cd2:	c3                   	ret
+
+00802cd3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802cd3:	55                   	push   %ebp
+  802cd4:	89 e5                	mov    %esp,%ebp
+  802cd6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cdc:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802ce1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ce4:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ce9:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cee:	e8 c8 fd ff ff       	call   802abb <nsipc>
+}
+  802cf3:	c9                   	leave
+  802cf4:	c3                   	ret
+
+00802cf5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802cf5:	55                   	push   %ebp
+  802cf6:	89 e5                	mov    %esp,%ebp
+  802cf8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802cfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfe:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802d03:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d08:	e8 ae fd ff ff       	call   802abb <nsipc>
+}
+  802d0d:	c9                   	leave
+  802d0e:	c3                   	ret
+
+00802d0f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d0f:	55                   	push   %ebp
+  802d10:	89 e5                	mov    %esp,%ebp
+  802d12:	53                   	push   %ebx
+  802d13:	83 ec 08             	sub    $0x8,%esp
+  802d16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d21:	53                   	push   %ebx
+  802d22:	ff 75 0c             	push   0xc(%ebp)
+  802d25:	68 04 80 80 00       	push   $0x808004
+  802d2a:	e8 c0 de ff ff       	call   800bef <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d2f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802d35:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d3a:	e8 7c fd ff ff       	call   802abb <nsipc>
+}
+  802d3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d42:	c9                   	leave
+  802d43:	c3                   	ret
+
+00802d44 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d44:	55                   	push   %ebp
+  802d45:	89 e5                	mov    %esp,%ebp
+  802d47:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d55:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802d5a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d5f:	e8 57 fd ff ff       	call   802abb <nsipc>
+}
+  802d64:	c9                   	leave
+  802d65:	c3                   	ret
+
+00802d66 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d66:	55                   	push   %ebp
+  802d67:	89 e5                	mov    %esp,%ebp
+  802d69:	56                   	push   %esi
+  802d6a:	53                   	push   %ebx
+  802d6b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d71:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802d76:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802d7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d7f:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d84:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d89:	e8 2d fd ff ff       	call   802abb <nsipc>
+  802d8e:	89 c3                	mov    %eax,%ebx
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	78 22                	js     802db6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d94:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d99:	39 c6                	cmp    %eax,%esi
+  802d9b:	0f 4e c6             	cmovle %esi,%eax
+  802d9e:	39 c3                	cmp    %eax,%ebx
+  802da0:	7f 1d                	jg     802dbf <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802da2:	83 ec 04             	sub    $0x4,%esp
+  802da5:	53                   	push   %ebx
+  802da6:	68 00 80 80 00       	push   $0x808000
+  802dab:	ff 75 0c             	push   0xc(%ebp)
+  802dae:	e8 3c de ff ff       	call   800bef <memmove>
+  802db3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802db6:	89 d8                	mov    %ebx,%eax
+  802db8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dbb:	5b                   	pop    %ebx
+  802dbc:	5e                   	pop    %esi
+  802dbd:	5d                   	pop    %ebp
+  802dbe:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802dbf:	68 48 4b 80 00       	push   $0x804b48
+  802dc4:	68 5d 4b 80 00       	push   $0x804b5d
+  802dc9:	68 b2 00 00 00       	push   $0xb2
+  802dce:	68 72 4b 80 00       	push   $0x804b72
+  802dd3:	e8 95 d4 ff ff       	call   80026d <_panic>
+
+00802dd8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	53                   	push   %ebx
+  802ddc:	83 ec 04             	sub    $0x4,%esp
+  802ddf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802de2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de5:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802dea:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802df0:	7f 2e                	jg     802e20 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802df2:	83 ec 04             	sub    $0x4,%esp
+  802df5:	53                   	push   %ebx
+  802df6:	ff 75 0c             	push   0xc(%ebp)
+  802df9:	68 0c 80 80 00       	push   $0x80800c
+  802dfe:	e8 ec dd ff ff       	call   800bef <memmove>
+	nsipcbuf.send.req_size = size;
+  802e03:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802e09:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e0c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802e11:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e16:	e8 a0 fc ff ff       	call   802abb <nsipc>
+}
+  802e1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e1e:	c9                   	leave
+  802e1f:	c3                   	ret
+	assert(size < 1600);
+  802e20:	68 7e 4b 80 00       	push   $0x804b7e
+  802e25:	68 5d 4b 80 00       	push   $0x804b5d
+  802e2a:	68 bd 00 00 00       	push   $0xbd
+  802e2f:	68 72 4b 80 00       	push   $0x804b72
+  802e34:	e8 34 d4 ff ff       	call   80026d <_panic>
+
+00802e39 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802e39:	55                   	push   %ebp
+  802e3a:	89 e5                	mov    %esp,%ebp
+  802e3c:	57                   	push   %edi
+  802e3d:	56                   	push   %esi
+  802e3e:	53                   	push   %ebx
+  802e3f:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802e42:	e8 c0 fc ff ff       	call   802b07 <nsbulk_map>
+  802e47:	85 c0                	test   %eax,%eax
+  802e49:	78 55                	js     802ea0 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802e4b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802e52:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802e59:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e60:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e63:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e66:	0f 8d 24 02 00 00    	jge    803090 <nsipc_sendmsg+0x257>
+  802e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e6f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e72:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802e75:	89 d8                	mov    %ebx,%eax
+  802e77:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e7c:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802e7e:	83 ec 0c             	sub    $0xc,%esp
+  802e81:	68 e0 66 80 00       	push   $0x8066e0
+  802e86:	e8 5a 0f 00 00       	call   803de5 <pgbatch_init>
+  802e8b:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e8e:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802e90:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802e93:	e9 82 00 00 00       	jmp    802f1a <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802e98:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e9b:	85 db                	test   %ebx,%ebx
+  802e9d:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea3:	5b                   	pop    %ebx
+  802ea4:	5e                   	pop    %esi
+  802ea5:	5f                   	pop    %edi
+  802ea6:	5d                   	pop    %ebp
+  802ea7:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802ea8:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802ead:	29 c8                	sub    %ecx,%eax
+  802eaf:	39 d0                	cmp    %edx,%eax
+  802eb1:	0f 46 d0             	cmovbe %eax,%edx
+  802eb4:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802eb6:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802ebc:	85 ff                	test   %edi,%edi
+  802ebe:	0f 49 c7             	cmovns %edi,%eax
+  802ec1:	c1 f8 0c             	sar    $0xc,%eax
+  802ec4:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ec9:	e8 87 fc ff ff       	call   802b55 <nsbulk_own>
+  802ece:	85 c0                	test   %eax,%eax
+  802ed0:	0f 88 17 01 00 00    	js     802fed <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802ed6:	83 ec 04             	sub    $0x4,%esp
+  802ed9:	56                   	push   %esi
+  802eda:	ff 75 e0             	push   -0x20(%ebp)
+  802edd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802ee0:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802ee5:	50                   	push   %eax
+  802ee6:	e8 04 dd ff ff       	call   800bef <memmove>
+  802eeb:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802eee:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802ef1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef4:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ef7:	0f 84 fd 00 00 00    	je     802ffa <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802efd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802f00:	01 f7                	add    %esi,%edi
+  802f02:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802f05:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f08:	0f 8d 01 01 00 00    	jge    80300f <nsipc_sendmsg+0x1d6>
+  802f0e:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802f14:	0f 8f f0 00 00 00    	jg     80300a <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802f1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f1d:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802f20:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802f23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f26:	89 c2                	mov    %eax,%edx
+  802f28:	03 13                	add    (%ebx),%edx
+  802f2a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802f2d:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f30:	29 c6                	sub    %eax,%esi
+  802f32:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802f37:	29 f9                	sub    %edi,%ecx
+  802f39:	39 ce                	cmp    %ecx,%esi
+  802f3b:	89 ca                	mov    %ecx,%edx
+  802f3d:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802f40:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802f43:	89 f9                	mov    %edi,%ecx
+  802f45:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802f4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f4e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f53:	09 c8                	or     %ecx,%eax
+  802f55:	0f 85 4d ff ff ff    	jne    802ea8 <nsipc_sendmsg+0x6f>
+  802f5b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802f61:	0f 86 41 ff ff ff    	jbe    802ea8 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f67:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802f6d:	85 ff                	test   %edi,%edi
+  802f6f:	0f 49 c7             	cmovns %edi,%eax
+  802f72:	c1 f8 0c             	sar    $0xc,%eax
+  802f75:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f77:	89 d1                	mov    %edx,%ecx
+  802f79:	c1 e9 0c             	shr    $0xc,%ecx
+  802f7c:	01 c8                	add    %ecx,%eax
+  802f7e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f81:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f84:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802f86:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f89:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f8e:	29 c8                	sub    %ecx,%eax
+  802f90:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f93:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802f96:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f98:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f9d:	89 f9                	mov    %edi,%ecx
+  802f9f:	d3 e0                	shl    %cl,%eax
+  802fa1:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802fa7:	83 ec 08             	sub    $0x8,%esp
+  802faa:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802fac:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802faf:	50                   	push   %eax
+  802fb0:	6a 00                	push   $0x0
+  802fb2:	56                   	push   %esi
+  802fb3:	6a 00                	push   $0x0
+  802fb5:	68 e0 66 80 00       	push   $0x8066e0
+  802fba:	e8 e4 0e 00 00       	call   803ea3 <pgbatch_map>
+  802fbf:	83 c4 20             	add    $0x20,%esp
+  802fc2:	85 c0                	test   %eax,%eax
+  802fc4:	0f 88 ce fe ff ff    	js     802e98 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802fca:	83 c7 01             	add    $0x1,%edi
+  802fcd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802fd3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802fd6:	39 c7                	cmp    %eax,%edi
+  802fd8:	75 be                	jne    802f98 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802fda:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802fdd:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802fe0:	89 d6                	mov    %edx,%esi
+  802fe2:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802fe8:	e9 01 ff ff ff       	jmp    802eee <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802fed:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ff0:	85 db                	test   %ebx,%ebx
+  802ff2:	0f 45 c3             	cmovne %ebx,%eax
+  802ff5:	e9 a6 fe ff ff       	jmp    802ea0 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802ffa:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802ffe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803005:	e9 f3 fe ff ff       	jmp    802efd <nsipc_sendmsg+0xc4>
+  80300a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80300d:	eb 03                	jmp    803012 <nsipc_sendmsg+0x1d9>
+  80300f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  803012:	83 ec 0c             	sub    $0xc,%esp
+  803015:	68 e0 66 80 00       	push   $0x8066e0
+  80301a:	e8 d4 0d 00 00       	call   803df3 <pgbatch_flush>
+  80301f:	83 c4 10             	add    $0x10,%esp
+  803022:	85 c0                	test   %eax,%eax
+  803024:	78 50                	js     803076 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  803026:	8b 45 08             	mov    0x8(%ebp),%eax
+  803029:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80302e:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  803034:	89 fb                	mov    %edi,%ebx
+  803036:	29 f3                	sub    %esi,%ebx
+  803038:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80303e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803041:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  803046:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80304b:	89 fa                	mov    %edi,%edx
+  80304d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803052:	e8 66 fb ff ff       	call   802bbd <nsipc_bulk>
+  803057:	85 c0                	test   %eax,%eax
+  803059:	78 28                	js     803083 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80305b:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80305e:	39 c3                	cmp    %eax,%ebx
+  803060:	75 0c                	jne    80306e <nsipc_sendmsg+0x235>
+  803062:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803065:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803068:	0f 8f f2 fd ff ff    	jg     802e60 <nsipc_sendmsg+0x27>
+		sent += r;
+  80306e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803071:	e9 2a fe ff ff       	jmp    802ea0 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803076:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803079:	85 db                	test   %ebx,%ebx
+  80307b:	0f 45 c3             	cmovne %ebx,%eax
+  80307e:	e9 1d fe ff ff       	jmp    802ea0 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803083:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803086:	85 db                	test   %ebx,%ebx
+  803088:	0f 45 c3             	cmovne %ebx,%eax
+  80308b:	e9 10 fe ff ff       	jmp    802ea0 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803090:	83 ec 0c             	sub    $0xc,%esp
+  803093:	68 e0 66 80 00       	push   $0x8066e0
+  803098:	e8 48 0d 00 00       	call   803de5 <pgbatch_init>
+  80309d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8030a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8030a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030aa:	e9 63 ff ff ff       	jmp    803012 <nsipc_sendmsg+0x1d9>
+
+008030af <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8030af:	55                   	push   %ebp
+  8030b0:	89 e5                	mov    %esp,%ebp
+  8030b2:	57                   	push   %edi
+  8030b3:	56                   	push   %esi
+  8030b4:	53                   	push   %ebx
+  8030b5:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8030b8:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  8030bf:	0f 84 c8 00 00 00    	je     80318d <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8030c5:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  8030cc:	0f 84 e4 00 00 00    	je     8031b6 <nsipc_sendfile+0x107>
+{
+  8030d2:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8030d7:	89 fb                	mov    %edi,%ebx
+  8030d9:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8030dc:	0f 83 f0 00 00 00    	jae    8031d2 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8030e2:	89 fa                	mov    %edi,%edx
+  8030e4:	03 55 10             	add    0x10(%ebp),%edx
+  8030e7:	89 d0                	mov    %edx,%eax
+  8030e9:	c1 f8 1f             	sar    $0x1f,%eax
+  8030ec:	c1 e8 14             	shr    $0x14,%eax
+  8030ef:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8030f2:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8030f8:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8030fa:	6a 10                	push   $0x10
+  8030fc:	68 00 20 01 e0       	push   $0xe0012000
+  803101:	52                   	push   %edx
+  803102:	ff 75 0c             	push   0xc(%ebp)
+  803105:	e8 fe f4 ff ff       	call   802608 <fmap>
+  80310a:	83 c4 10             	add    $0x10,%esp
+  80310d:	85 c0                	test   %eax,%eax
+  80310f:	0f 8e b8 00 00 00    	jle    8031cd <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  803115:	39 c6                	cmp    %eax,%esi
+  803117:	0f 8d b5 00 00 00    	jge    8031d2 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80311d:	29 f0                	sub    %esi,%eax
+  80311f:	8b 55 14             	mov    0x14(%ebp),%edx
+  803122:	29 da                	sub    %ebx,%edx
+  803124:	39 d0                	cmp    %edx,%eax
+  803126:	89 d3                	mov    %edx,%ebx
+  803128:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80312b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312e:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803133:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  803139:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  80313f:	8b 45 18             	mov    0x18(%ebp),%eax
+  803142:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803147:	83 ec 0c             	sub    $0xc,%esp
+  80314a:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80314c:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803153:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803156:	83 c0 01             	add    $0x1,%eax
+  803159:	50                   	push   %eax
+  80315a:	68 00 10 01 e0       	push   $0xe0011000
+  80315f:	6a 11                	push   $0x11
+  803161:	ff 35 e4 69 80 00    	push   0x8069e4
+  803167:	e8 aa eb ff ff       	call   801d16 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80316c:	83 c4 1c             	add    $0x1c,%esp
+  80316f:	6a 00                	push   $0x0
+  803171:	6a 00                	push   $0x0
+  803173:	6a 00                	push   $0x0
+  803175:	e8 d8 e8 ff ff       	call   801a52 <ipc_recv>
+  80317a:	83 c4 10             	add    $0x10,%esp
+  80317d:	85 c0                	test   %eax,%eax
+  80317f:	78 5b                	js     8031dc <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803181:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803183:	39 c3                	cmp    %eax,%ebx
+  803185:	0f 8e 4c ff ff ff    	jle    8030d7 <nsipc_sendfile+0x28>
+  80318b:	eb 45                	jmp    8031d2 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80318d:	83 ec 04             	sub    $0x4,%esp
+  803190:	6a 07                	push   $0x7
+  803192:	68 00 10 01 e0       	push   $0xe0011000
+  803197:	6a 00                	push   $0x0
+  803199:	e8 d5 dc ff ff       	call   800e73 <sys_page_alloc>
+  80319e:	89 c7                	mov    %eax,%edi
+  8031a0:	83 c4 10             	add    $0x10,%esp
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	78 2b                	js     8031d2 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8031a7:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  8031ae:	00 00 00 
+  8031b1:	e9 0f ff ff ff       	jmp    8030c5 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8031b6:	83 ec 0c             	sub    $0xc,%esp
+  8031b9:	6a 03                	push   $0x3
+  8031bb:	e8 8b eb ff ff       	call   801d4b <ipc_find_env>
+  8031c0:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  8031c5:	83 c4 10             	add    $0x10,%esp
+  8031c8:	e9 05 ff ff ff       	jmp    8030d2 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8031cd:	85 ff                	test   %edi,%edi
+  8031cf:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8031d2:	89 f8                	mov    %edi,%eax
+  8031d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031d7:	5b                   	pop    %ebx
+  8031d8:	5e                   	pop    %esi
+  8031d9:	5f                   	pop    %edi
+  8031da:	5d                   	pop    %ebp
+  8031db:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8031dc:	85 ff                	test   %edi,%edi
+  8031de:	0f 44 f8             	cmove  %eax,%edi
+  8031e1:	eb ef                	jmp    8031d2 <nsipc_sendfile+0x123>
+
+008031e3 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8031e3:	55                   	push   %ebp
+  8031e4:	89 e5                	mov    %esp,%ebp
+  8031e6:	57                   	push   %edi
+  8031e7:	56                   	push   %esi
+  8031e8:	53                   	push   %ebx
+  8031e9:	83 ec 1c             	sub    $0x1c,%esp
+  8031ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8031ef:	e8 13 f9 ff ff       	call   802b07 <nsbulk_map>
+  8031f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031f7:	85 c0                	test   %eax,%eax
+  8031f9:	0f 88 ba 00 00 00    	js     8032b9 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031ff:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803203:	0f 8e bb 00 00 00    	jle    8032c4 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803209:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80320e:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  803213:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803218:	89 f8                	mov    %edi,%eax
+  80321a:	29 f0                	sub    %esi,%eax
+  80321c:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  803220:	39 c8                	cmp    %ecx,%eax
+  803222:	0f 47 c1             	cmova  %ecx,%eax
+  803225:	01 f0                	add    %esi,%eax
+  803227:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803229:	83 c2 01             	add    $0x1,%edx
+  80322c:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80322f:	7e 07                	jle    803238 <nsipc_recvmsg+0x55>
+  803231:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803236:	7e e0                	jle    803218 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803238:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80323e:	c1 fa 0c             	sar    $0xc,%edx
+  803241:	b8 00 00 00 00       	mov    $0x0,%eax
+  803246:	e8 0a f9 ff ff       	call   802b55 <nsbulk_own>
+  80324b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80324e:	85 c0                	test   %eax,%eax
+  803250:	78 67                	js     8032b9 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803252:	8b 45 08             	mov    0x8(%ebp),%eax
+  803255:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80325a:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803260:	8b 45 14             	mov    0x14(%ebp),%eax
+  803263:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803268:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80326d:	89 f2                	mov    %esi,%edx
+  80326f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803274:	e8 44 f9 ff ff       	call   802bbd <nsipc_bulk>
+  803279:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80327c:	85 c0                	test   %eax,%eax
+  80327e:	78 39                	js     8032b9 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803280:	39 f0                	cmp    %esi,%eax
+  803282:	7f 4a                	jg     8032ce <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803284:	bf 00 00 00 00       	mov    $0x0,%edi
+  803289:	85 c0                	test   %eax,%eax
+  80328b:	7e 2c                	jle    8032b9 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80328d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803290:	29 fe                	sub    %edi,%esi
+  803292:	8b 43 04             	mov    0x4(%ebx),%eax
+  803295:	39 c6                	cmp    %eax,%esi
+  803297:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80329a:	83 ec 04             	sub    $0x4,%esp
+  80329d:	56                   	push   %esi
+  80329e:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8032a4:	50                   	push   %eax
+  8032a5:	ff 33                	push   (%ebx)
+  8032a7:	e8 43 d9 ff ff       	call   800bef <memmove>
+		n += m;
+  8032ac:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8032ae:	83 c3 08             	add    $0x8,%ebx
+  8032b1:	83 c4 10             	add    $0x10,%esp
+  8032b4:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8032b7:	7f d4                	jg     80328d <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8032b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032bf:	5b                   	pop    %ebx
+  8032c0:	5e                   	pop    %esi
+  8032c1:	5f                   	pop    %edi
+  8032c2:	5d                   	pop    %ebp
+  8032c3:	c3                   	ret
+	int r, i, n, len = 0;
+  8032c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8032c9:	e9 6a ff ff ff       	jmp    803238 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8032ce:	68 54 4b 80 00       	push   $0x804b54
+  8032d3:	68 5d 4b 80 00       	push   $0x804b5d
+  8032d8:	68 3b 01 00 00       	push   $0x13b
+  8032dd:	68 72 4b 80 00       	push   $0x804b72
+  8032e2:	e8 86 cf ff ff       	call   80026d <_panic>
+
+008032e7 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8032e7:	55                   	push   %ebp
+  8032e8:	89 e5                	mov    %esp,%ebp
+  8032ea:	57                   	push   %edi
+  8032eb:	56                   	push   %esi
+  8032ec:	53                   	push   %ebx
+  8032ed:	83 ec 0c             	sub    $0xc,%esp
+  8032f0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8032f3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8032f6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8032f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032fc:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  803301:	8b 07                	mov    (%edi),%eax
+  803303:	a3 04 80 80 00       	mov    %eax,0x808004
+  803308:	8b 47 04             	mov    0x4(%edi),%eax
+  80330b:	a3 08 80 80 00       	mov    %eax,0x808008
+  803310:	8b 47 08             	mov    0x8(%edi),%eax
+  803313:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  803318:	8b 47 0c             	mov    0xc(%edi),%eax
+  80331b:	a3 10 80 80 00       	mov    %eax,0x808010
+  803320:	8b 47 10             	mov    0x10(%edi),%eax
+  803323:	a3 14 80 80 00       	mov    %eax,0x808014
+  803328:	8b 47 14             	mov    0x14(%edi),%eax
+  80332b:	a3 18 80 80 00       	mov    %eax,0x808018
+  803330:	8b 47 18             	mov    0x18(%edi),%eax
+  803333:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803338:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80333b:	a3 20 80 80 00       	mov    %eax,0x808020
+  803340:	8b 47 20             	mov    0x20(%edi),%eax
+  803343:	a3 24 80 80 00       	mov    %eax,0x808024
+  803348:	8b 47 24             	mov    0x24(%edi),%eax
+  80334b:	a3 28 80 80 00       	mov    %eax,0x808028
+  803350:	8b 47 28             	mov    0x28(%edi),%eax
+  803353:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  803358:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80335b:	a3 30 80 80 00       	mov    %eax,0x808030
+  803360:	8b 47 30             	mov    0x30(%edi),%eax
+  803363:	a3 34 80 80 00       	mov    %eax,0x808034
+  803368:	8b 47 34             	mov    0x34(%edi),%eax
+  80336b:	a3 38 80 80 00       	mov    %eax,0x808038
+  803370:	8b 47 38             	mov    0x38(%edi),%eax
+  803373:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  803378:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80337b:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803380:	8b 06                	mov    (%esi),%eax
+  803382:	a3 44 80 80 00       	mov    %eax,0x808044
+  803387:	8b 46 04             	mov    0x4(%esi),%eax
+  80338a:	a3 48 80 80 00       	mov    %eax,0x808048
+  80338f:	8b 46 08             	mov    0x8(%esi),%eax
+  803392:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  803397:	8b 46 0c             	mov    0xc(%esi),%eax
+  80339a:	a3 50 80 80 00       	mov    %eax,0x808050
+  80339f:	8b 46 10             	mov    0x10(%esi),%eax
+  8033a2:	a3 54 80 80 00       	mov    %eax,0x808054
+  8033a7:	8b 46 14             	mov    0x14(%esi),%eax
+  8033aa:	a3 58 80 80 00       	mov    %eax,0x808058
+  8033af:	8b 46 18             	mov    0x18(%esi),%eax
+  8033b2:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8033b7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8033ba:	a3 60 80 80 00       	mov    %eax,0x808060
+  8033bf:	8b 46 20             	mov    0x20(%esi),%eax
+  8033c2:	a3 64 80 80 00       	mov    %eax,0x808064
+  8033c7:	8b 46 24             	mov    0x24(%esi),%eax
+  8033ca:	a3 68 80 80 00       	mov    %eax,0x808068
+  8033cf:	8b 46 28             	mov    0x28(%esi),%eax
+  8033d2:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8033d7:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8033da:	a3 70 80 80 00       	mov    %eax,0x808070
+  8033df:	8b 46 30             	mov    0x30(%esi),%eax
+  8033e2:	a3 74 80 80 00       	mov    %eax,0x808074
+  8033e7:	8b 46 34             	mov    0x34(%esi),%eax
+  8033ea:	a3 78 80 80 00       	mov    %eax,0x808078
+  8033ef:	8b 46 38             	mov    0x38(%esi),%eax
+  8033f2:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8033f7:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8033fa:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8033ff:	8b 03                	mov    (%ebx),%eax
+  803401:	a3 84 80 80 00       	mov    %eax,0x808084
+  803406:	8b 43 04             	mov    0x4(%ebx),%eax
+  803409:	a3 88 80 80 00       	mov    %eax,0x808088
+  80340e:	8b 43 08             	mov    0x8(%ebx),%eax
+  803411:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  803416:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803419:	a3 90 80 80 00       	mov    %eax,0x808090
+  80341e:	8b 43 10             	mov    0x10(%ebx),%eax
+  803421:	a3 94 80 80 00       	mov    %eax,0x808094
+  803426:	8b 43 14             	mov    0x14(%ebx),%eax
+  803429:	a3 98 80 80 00       	mov    %eax,0x808098
+  80342e:	8b 43 18             	mov    0x18(%ebx),%eax
+  803431:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803436:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803439:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  80343e:	8b 43 20             	mov    0x20(%ebx),%eax
+  803441:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803446:	8b 43 24             	mov    0x24(%ebx),%eax
+  803449:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80344e:	8b 43 28             	mov    0x28(%ebx),%eax
+  803451:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803456:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803459:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  80345e:	8b 43 30             	mov    0x30(%ebx),%eax
+  803461:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803466:	8b 43 34             	mov    0x34(%ebx),%eax
+  803469:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80346e:	8b 43 38             	mov    0x38(%ebx),%eax
+  803471:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803476:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803479:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80347e:	8b 45 18             	mov    0x18(%ebp),%eax
+  803481:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803486:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80348b:	e8 2b f6 ff ff       	call   802abb <nsipc>
+  803490:	85 c0                	test   %eax,%eax
+  803492:	0f 88 ad 01 00 00    	js     803645 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803498:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80349e:	89 17                	mov    %edx,(%edi)
+  8034a0:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8034a6:	89 57 04             	mov    %edx,0x4(%edi)
+  8034a9:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8034af:	89 57 08             	mov    %edx,0x8(%edi)
+  8034b2:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8034b8:	89 57 0c             	mov    %edx,0xc(%edi)
+  8034bb:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8034c1:	89 57 10             	mov    %edx,0x10(%edi)
+  8034c4:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8034ca:	89 57 14             	mov    %edx,0x14(%edi)
+  8034cd:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8034d3:	89 57 18             	mov    %edx,0x18(%edi)
+  8034d6:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8034dc:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8034df:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8034e5:	89 57 20             	mov    %edx,0x20(%edi)
+  8034e8:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8034ee:	89 57 24             	mov    %edx,0x24(%edi)
+  8034f1:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8034f7:	89 57 28             	mov    %edx,0x28(%edi)
+  8034fa:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  803500:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803503:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  803509:	89 57 30             	mov    %edx,0x30(%edi)
+  80350c:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  803512:	89 57 34             	mov    %edx,0x34(%edi)
+  803515:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  80351b:	89 57 38             	mov    %edx,0x38(%edi)
+  80351e:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  803524:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803527:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  80352d:	89 16                	mov    %edx,(%esi)
+  80352f:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803535:	89 56 04             	mov    %edx,0x4(%esi)
+  803538:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  80353e:	89 56 08             	mov    %edx,0x8(%esi)
+  803541:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803547:	89 56 0c             	mov    %edx,0xc(%esi)
+  80354a:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  803550:	89 56 10             	mov    %edx,0x10(%esi)
+  803553:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803559:	89 56 14             	mov    %edx,0x14(%esi)
+  80355c:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803562:	89 56 18             	mov    %edx,0x18(%esi)
+  803565:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  80356b:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80356e:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803574:	89 56 20             	mov    %edx,0x20(%esi)
+  803577:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80357d:	89 56 24             	mov    %edx,0x24(%esi)
+  803580:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803586:	89 56 28             	mov    %edx,0x28(%esi)
+  803589:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  80358f:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803592:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  803598:	89 56 30             	mov    %edx,0x30(%esi)
+  80359b:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8035a1:	89 56 34             	mov    %edx,0x34(%esi)
+  8035a4:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8035aa:	89 56 38             	mov    %edx,0x38(%esi)
+  8035ad:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8035b3:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  8035b6:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8035bc:	89 13                	mov    %edx,(%ebx)
+  8035be:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  8035c4:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035c7:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  8035cd:	89 53 08             	mov    %edx,0x8(%ebx)
+  8035d0:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8035d6:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8035d9:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8035df:	89 53 10             	mov    %edx,0x10(%ebx)
+  8035e2:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8035e8:	89 53 14             	mov    %edx,0x14(%ebx)
+  8035eb:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8035f1:	89 53 18             	mov    %edx,0x18(%ebx)
+  8035f4:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8035fa:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8035fd:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  803603:	89 53 20             	mov    %edx,0x20(%ebx)
+  803606:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  80360c:	89 53 24             	mov    %edx,0x24(%ebx)
+  80360f:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  803615:	89 53 28             	mov    %edx,0x28(%ebx)
+  803618:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  80361e:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803621:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803627:	89 53 30             	mov    %edx,0x30(%ebx)
+  80362a:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  803630:	89 53 34             	mov    %edx,0x34(%ebx)
+  803633:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803639:	89 53 38             	mov    %edx,0x38(%ebx)
+  80363c:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803642:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803645:	83 c4 0c             	add    $0xc,%esp
+  803648:	5b                   	pop    %ebx
+  803649:	5e                   	pop    %esi
+  80364a:	5f                   	pop    %edi
+  80364b:	5d                   	pop    %ebp
+  80364c:	c3                   	ret
+
+0080364d <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80364d:	55                   	push   %ebp
+  80364e:	89 e5                	mov    %esp,%ebp
+  803650:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803653:	8b 45 08             	mov    0x8(%ebp),%eax
+  803656:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  80365b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80365e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803663:	8b 45 10             	mov    0x10(%ebp),%eax
+  803666:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  80366b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803670:	e8 46 f4 ff ff       	call   802abb <nsipc>
+}
+  803675:	c9                   	leave
+  803676:	c3                   	ret
+
+00803677 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803677:	55                   	push   %ebp
+  803678:	89 e5                	mov    %esp,%ebp
+  80367a:	56                   	push   %esi
+  80367b:	53                   	push   %ebx
+  80367c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  80367f:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803685:	8b 45 10             	mov    0x10(%ebp),%eax
+  803688:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80368d:	b8 10 00 00 00       	mov    $0x10,%eax
+  803692:	e8 24 f4 ff ff       	call   802abb <nsipc>
+  803697:	89 c3                	mov    %eax,%ebx
+  803699:	85 c0                	test   %eax,%eax
+  80369b:	7e 1f                	jle    8036bc <nsipc_evwait+0x45>
+		assert(r <= max);
+  80369d:	39 c6                	cmp    %eax,%esi
+  80369f:	7c 24                	jl     8036c5 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8036a1:	83 ec 04             	sub    $0x4,%esp
+  8036a4:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8036ab:	50                   	push   %eax
+  8036ac:	68 00 80 80 00       	push   $0x808000
+  8036b1:	ff 75 08             	push   0x8(%ebp)
+  8036b4:	e8 36 d5 ff ff       	call   800bef <memmove>
+  8036b9:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8036bc:	89 d8                	mov    %ebx,%eax
+  8036be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036c1:	5b                   	pop    %ebx
+  8036c2:	5e                   	pop    %esi
+  8036c3:	5d                   	pop    %ebp
+  8036c4:	c3                   	ret
+		assert(r <= max);
+  8036c5:	68 8a 4b 80 00       	push   $0x804b8a
+  8036ca:	68 5d 4b 80 00       	push   $0x804b5d
+  8036cf:	68 6a 01 00 00       	push   $0x16a
+  8036d4:	68 72 4b 80 00       	push   $0x804b72
+  8036d9:	e8 8f cb ff ff       	call   80026d <_panic>
+
+008036de <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8036de:	55                   	push   %ebp
+  8036df:	89 e5                	mov    %esp,%ebp
+  8036e1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8036e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036e7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8036ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036ef:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8036f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036f7:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8036fc:	b8 09 00 00 00       	mov    $0x9,%eax
+  803701:	e8 b5 f3 ff ff       	call   802abb <nsipc>
+}
+  803706:	c9                   	leave
+  803707:	c3                   	ret
+
+00803708 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803708:	55                   	push   %ebp
+  803709:	89 e5                	mov    %esp,%ebp
+  80370b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  80370e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803711:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803716:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80371b:	e8 9b f3 ff ff       	call   802abb <nsipc>
+}
+  803720:	c9                   	leave
+  803721:	c3                   	ret
+
+00803722 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803722:	55                   	push   %ebp
+  803723:	89 e5                	mov    %esp,%ebp
+  803725:	53                   	push   %ebx
+  803726:	83 ec 04             	sub    $0x4,%esp
+  803729:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  80372c:	b8 12 00 00 00       	mov    $0x12,%eax
+  803731:	e8 85 f3 ff ff       	call   802abb <nsipc>
+  803736:	85 c0                	test   %eax,%eax
+  803738:	78 50                	js     80378a <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  80373a:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  803740:	89 13                	mov    %edx,(%ebx)
+  803742:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803748:	89 53 04             	mov    %edx,0x4(%ebx)
+  80374b:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803751:	89 53 08             	mov    %edx,0x8(%ebx)
+  803754:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80375a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80375d:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803763:	89 53 10             	mov    %edx,0x10(%ebx)
+  803766:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80376c:	89 53 14             	mov    %edx,0x14(%ebx)
+  80376f:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803775:	89 53 18             	mov    %edx,0x18(%ebx)
+  803778:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80377e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803781:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803787:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80378a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80378d:	c9                   	leave
+  80378e:	c3                   	ret
+
+0080378f <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80378f:	55                   	push   %ebp
+  803790:	89 e5                	mov    %esp,%ebp
+  803792:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803795:	6a 03                	push   $0x3
+  803797:	e8 af e5 ff ff       	call   801d4b <ipc_find_env>
+  80379c:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  8037a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a4:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8037a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8037ae:	e8 08 f3 ff ff       	call   802abb <nsipc>
+  8037b3:	83 c4 10             	add    $0x10,%esp
+  8037b6:	85 c0                	test   %eax,%eax
+  8037b8:	78 0a                	js     8037c4 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8037ba:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  8037bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037c4:	c9                   	leave
+  8037c5:	c3                   	ret
+
+008037c6 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8037c6:	55                   	push   %ebp
+  8037c7:	89 e5                	mov    %esp,%ebp
+  8037c9:	57                   	push   %edi
+  8037ca:	56                   	push   %esi
+  8037cb:	53                   	push   %ebx
+  8037cc:	83 ec 1c             	sub    $0x1c,%esp
+  8037cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8037d2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8037d5:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8037da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037df:	89 e0                	mov    %esp,%eax
+  8037e1:	89 f2                	mov    %esi,%edx
+  8037e3:	29 c2                	sub    %eax,%edx
+  8037e5:	89 d0                	mov    %edx,%eax
+  8037e7:	c1 e8 0f             	shr    $0xf,%eax
+  8037ea:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8037f0:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8037f3:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8037fa:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8037fd:	83 ec 0c             	sub    $0xc,%esp
+  803800:	ff 75 e0             	push   -0x20(%ebp)
+  803803:	e8 41 0b 00 00       	call   804349 <pageref>
+  803808:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80380b:	83 c4 04             	add    $0x4,%esp
+  80380e:	ff 75 dc             	push   -0x24(%ebp)
+  803811:	e8 33 0b 00 00       	call   804349 <pageref>
+  803816:	89 e2                	mov    %esp,%edx
+  803818:	89 f1                	mov    %esi,%ecx
+  80381a:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  80381c:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80381f:	89 ca                	mov    %ecx,%edx
+  803821:	c1 ea 0f             	shr    $0xf,%edx
+  803824:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  80382a:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  80382d:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  803834:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803837:	39 d7                	cmp    %edx,%edi
+  803839:	74 40                	je     80387b <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  80383b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80383e:	75 9f                	jne    8037df <_pipeisclosed+0x19>
+  803840:	89 e2                	mov    %esp,%edx
+  803842:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803847:	29 d0                	sub    %edx,%eax
+  803849:	89 c2                	mov    %eax,%edx
+  80384b:	c1 ea 0f             	shr    $0xf,%edx
+  80384e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803853:	b8 00 00 00 00       	mov    $0x0,%eax
+  803858:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80385b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803862:	8b 40 58             	mov    0x58(%eax),%eax
+  803865:	6a 01                	push   $0x1
+  803867:	50                   	push   %eax
+  803868:	57                   	push   %edi
+  803869:	68 93 4b 80 00       	push   $0x804b93
+  80386e:	e8 d5 ca ff ff       	call   800348 <cprintf>
+  803873:	83 c4 10             	add    $0x10,%esp
+  803876:	e9 5f ff ff ff       	jmp    8037da <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80387b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80387e:	0f 94 c0             	sete   %al
+  803881:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803887:	5b                   	pop    %ebx
+  803888:	5e                   	pop    %esi
+  803889:	5f                   	pop    %edi
+  80388a:	5d                   	pop    %ebp
+  80388b:	c3                   	ret
+
+0080388c <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80388c:	55                   	push   %ebp
+  80388d:	89 e5                	mov    %esp,%ebp
+  80388f:	53                   	push   %ebx
+  803890:	83 ec 0c             	sub    $0xc,%esp
+  803893:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803896:	53                   	push   %ebx
+  803897:	6a 00                	push   $0x0
+  803899:	e8 5a d6 ff ff       	call   800ef8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80389e:	89 1c 24             	mov    %ebx,(%esp)
+  8038a1:	e8 f4 e4 ff ff       	call   801d9a <fd2data>
+  8038a6:	83 c4 08             	add    $0x8,%esp
+  8038a9:	50                   	push   %eax
+  8038aa:	6a 00                	push   $0x0
+  8038ac:	e8 47 d6 ff ff       	call   800ef8 <sys_page_unmap>
+}
+  8038b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038b4:	c9                   	leave
+  8038b5:	c3                   	ret
+
+008038b6 <devpipe_read>:
+{
+  8038b6:	55                   	push   %ebp
+  8038b7:	89 e5                	mov    %esp,%ebp
+  8038b9:	57                   	push   %edi
+  8038ba:	56                   	push   %esi
+  8038bb:	53                   	push   %ebx
+  8038bc:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8038bf:	ff 75 08             	push   0x8(%ebp)
+  8038c2:	e8 d3 e4 ff ff       	call   801d9a <fd2data>
+  8038c7:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8038c9:	8b 70 04             	mov    0x4(%eax),%esi
+  8038cc:	8b 00                	mov    (%eax),%eax
+  8038ce:	83 c4 10             	add    $0x10,%esp
+  8038d1:	39 f0                	cmp    %esi,%eax
+  8038d3:	75 36                	jne    80390b <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8038d5:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8038d8:	89 da                	mov    %ebx,%edx
+  8038da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038dd:	e8 e4 fe ff ff       	call   8037c6 <_pipeisclosed>
+  8038e2:	85 c0                	test   %eax,%eax
+  8038e4:	0f 85 d4 00 00 00    	jne    8039be <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8038ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038ef:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8038f3:	83 ec 04             	sub    $0x4,%esp
+  8038f6:	6a ff                	push   $0xffffffff
+  8038f8:	56                   	push   %esi
+  8038f9:	57                   	push   %edi
+  8038fa:	e8 72 d9 ff ff       	call   801271 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8038ff:	8b 73 04             	mov    0x4(%ebx),%esi
+  803902:	8b 03                	mov    (%ebx),%eax
+  803904:	83 c4 10             	add    $0x10,%esp
+  803907:	39 c6                	cmp    %eax,%esi
+  803909:	74 cd                	je     8038d8 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80390b:	8b 73 04             	mov    0x4(%ebx),%esi
+  80390e:	8b 03                	mov    (%ebx),%eax
+  803910:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803916:	29 c6                	sub    %eax,%esi
+  803918:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80391d:	f7 e6                	mul    %esi
+  80391f:	c1 ea 0c             	shr    $0xc,%edx
+  803922:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803928:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  80392a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80392d:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803931:	8b 0b                	mov    (%ebx),%ecx
+  803933:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803938:	f7 e1                	mul    %ecx
+  80393a:	c1 ea 0b             	shr    $0xb,%edx
+  80393d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803943:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803945:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80394a:	29 cf                	sub    %ecx,%edi
+  80394c:	39 f7                	cmp    %esi,%edi
+  80394e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803951:	83 ec 04             	sub    $0x4,%esp
+  803954:	57                   	push   %edi
+  803955:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803959:	50                   	push   %eax
+  80395a:	ff 75 0c             	push   0xc(%ebp)
+  80395d:	e8 8d d2 ff ff       	call   800bef <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803962:	83 c4 0c             	add    $0xc,%esp
+  803965:	89 f0                	mov    %esi,%eax
+  803967:	29 f8                	sub    %edi,%eax
+  803969:	50                   	push   %eax
+  80396a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80396d:	50                   	push   %eax
+  80396e:	89 f8                	mov    %edi,%eax
+  803970:	03 45 0c             	add    0xc(%ebp),%eax
+  803973:	50                   	push   %eax
+  803974:	e8 76 d2 ff ff       	call   800bef <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803979:	8b 0b                	mov    (%ebx),%ecx
+  80397b:	01 f1                	add    %esi,%ecx
+  80397d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803982:	f7 e1                	mul    %ecx
+  803984:	c1 ea 0c             	shr    $0xc,%edx
+  803987:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80398d:	29 c1                	sub    %eax,%ecx
+  80398f:	89 0b                	mov    %ecx,(%ebx)
+  803991:	b8 00 00 00 00       	mov    $0x0,%eax
+  803996:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80399a:	83 c4 10             	add    $0x10,%esp
+  80399d:	85 c0                	test   %eax,%eax
+  80399f:	75 0a                	jne    8039ab <devpipe_read+0xf5>
+	return n;
+  8039a1:	89 f0                	mov    %esi,%eax
+}
+  8039a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039a6:	5b                   	pop    %ebx
+  8039a7:	5e                   	pop    %esi
+  8039a8:	5f                   	pop    %edi
+  8039a9:	5d                   	pop    %ebp
+  8039aa:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8039ab:	83 ec 08             	sub    $0x8,%esp
+  8039ae:	68 00 04 00 00       	push   $0x400
+  8039b3:	53                   	push   %ebx
+  8039b4:	e8 da d8 ff ff       	call   801293 <sys_futex_wake>
+  8039b9:	83 c4 10             	add    $0x10,%esp
+  8039bc:	eb e3                	jmp    8039a1 <devpipe_read+0xeb>
+			return 0;
+  8039be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c3:	eb de                	jmp    8039a3 <devpipe_read+0xed>
+
+008039c5 <devpipe_write>:
+{
+  8039c5:	55                   	push   %ebp
+  8039c6:	89 e5                	mov    %esp,%ebp
+  8039c8:	57                   	push   %edi
+  8039c9:	56                   	push   %esi
+  8039ca:	53                   	push   %ebx
+  8039cb:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8039ce:	ff 75 08             	push   0x8(%ebp)
+  8039d1:	e8 c4 e3 ff ff       	call   801d9a <fd2data>
+  8039d6:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8039d8:	83 c4 10             	add    $0x10,%esp
+  8039db:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039e2:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8039e7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039eb:	0f 84 43 01 00 00    	je     803b34 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039f1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039f4:	8b 06                	mov    (%esi),%eax
+  8039f6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039fc:	29 c1                	sub    %eax,%ecx
+  8039fe:	89 c8                	mov    %ecx,%eax
+  803a00:	f7 e7                	mul    %edi
+  803a02:	c1 ea 0c             	shr    $0xc,%edx
+  803a05:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a0b:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803a0d:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803a13:	75 52                	jne    803a67 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803a15:	89 f2                	mov    %esi,%edx
+  803a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a1a:	e8 a7 fd ff ff       	call   8037c6 <_pipeisclosed>
+  803a1f:	85 c0                	test   %eax,%eax
+  803a21:	0f 85 28 01 00 00    	jne    803b4f <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803a27:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a29:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a2c:	8b 06                	mov    (%esi),%eax
+  803a2e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a34:	29 c1                	sub    %eax,%ecx
+  803a36:	89 c8                	mov    %ecx,%eax
+  803a38:	f7 e7                	mul    %edi
+  803a3a:	c1 ea 0c             	shr    $0xc,%edx
+  803a3d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a43:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803a45:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803a4b:	75 a4                	jne    8039f1 <devpipe_write+0x2c>
+  803a4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a52:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803a56:	83 ec 04             	sub    $0x4,%esp
+  803a59:	6a ff                	push   $0xffffffff
+  803a5b:	53                   	push   %ebx
+  803a5c:	56                   	push   %esi
+  803a5d:	e8 0f d8 ff ff       	call   801271 <sys_futex_wait>
+}
+  803a62:	83 c4 10             	add    $0x10,%esp
+  803a65:	eb 8a                	jmp    8039f1 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a67:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a6a:	8b 06                	mov    (%esi),%eax
+  803a6c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a72:	29 c1                	sub    %eax,%ecx
+  803a74:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a79:	f7 e1                	mul    %ecx
+  803a7b:	c1 ea 0c             	shr    $0xc,%edx
+  803a7e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a84:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803a86:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803a8b:	89 d8                	mov    %ebx,%eax
+  803a8d:	29 c8                	sub    %ecx,%eax
+  803a8f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a92:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a95:	29 ca                	sub    %ecx,%edx
+  803a97:	39 d0                	cmp    %edx,%eax
+  803a99:	0f 46 d0             	cmovbe %eax,%edx
+  803a9c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803a9f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803aa2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803aa7:	f7 e1                	mul    %ecx
+  803aa9:	c1 ea 0b             	shr    $0xb,%edx
+  803aac:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803ab2:	89 ca                	mov    %ecx,%edx
+  803ab4:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803ab6:	29 d3                	sub    %edx,%ebx
+  803ab8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803abb:	39 c3                	cmp    %eax,%ebx
+  803abd:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803ac0:	83 ec 04             	sub    $0x4,%esp
+  803ac3:	53                   	push   %ebx
+  803ac4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803ac7:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803aca:	51                   	push   %ecx
+  803acb:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803acf:	50                   	push   %eax
+  803ad0:	e8 1a d1 ff ff       	call   800bef <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803ad5:	83 c4 0c             	add    $0xc,%esp
+  803ad8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803adb:	29 d8                	sub    %ebx,%eax
+  803add:	50                   	push   %eax
+  803ade:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803ae1:	01 cb                	add    %ecx,%ebx
+  803ae3:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803ae6:	53                   	push   %ebx
+  803ae7:	8d 46 10             	lea    0x10(%esi),%eax
+  803aea:	50                   	push   %eax
+  803aeb:	e8 ff d0 ff ff       	call   800bef <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803af0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803af3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803af6:	01 c1                	add    %eax,%ecx
+  803af8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803afd:	f7 e1                	mul    %ecx
+  803aff:	c1 ea 0c             	shr    $0xc,%edx
+  803b02:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803b08:	89 ca                	mov    %ecx,%edx
+  803b0a:	29 c2                	sub    %eax,%edx
+  803b0c:	89 56 04             	mov    %edx,0x4(%esi)
+  803b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b14:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803b18:	83 c4 10             	add    $0x10,%esp
+  803b1b:	85 c0                	test   %eax,%eax
+  803b1d:	75 1a                	jne    803b39 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803b1f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803b22:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803b25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803b28:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b2b:	0f 82 c0 fe ff ff    	jb     8039f1 <devpipe_write+0x2c>
+  803b31:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803b34:	8b 45 10             	mov    0x10(%ebp),%eax
+  803b37:	eb 1b                	jmp    803b54 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803b39:	83 ec 08             	sub    $0x8,%esp
+  803b3c:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803b41:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803b44:	50                   	push   %eax
+  803b45:	e8 49 d7 ff ff       	call   801293 <sys_futex_wake>
+  803b4a:	83 c4 10             	add    $0x10,%esp
+  803b4d:	eb d0                	jmp    803b1f <devpipe_write+0x15a>
+				return 0;
+  803b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b57:	5b                   	pop    %ebx
+  803b58:	5e                   	pop    %esi
+  803b59:	5f                   	pop    %edi
+  803b5a:	5d                   	pop    %ebp
+  803b5b:	c3                   	ret
+
+00803b5c <devpipe_stat>:
+{
+  803b5c:	55                   	push   %ebp
+  803b5d:	89 e5                	mov    %esp,%ebp
+  803b5f:	56                   	push   %esi
+  803b60:	53                   	push   %ebx
+  803b61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b64:	83 ec 0c             	sub    $0xc,%esp
+  803b67:	ff 75 08             	push   0x8(%ebp)
+  803b6a:	e8 2b e2 ff ff       	call   801d9a <fd2data>
+  803b6f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803b71:	83 c4 08             	add    $0x8,%esp
+  803b74:	68 a6 4b 80 00       	push   $0x804ba6
+  803b79:	53                   	push   %ebx
+  803b7a:	e8 c0 ce ff ff       	call   800a3f <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b7f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b82:	8b 06                	mov    (%esi),%eax
+  803b84:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b8a:	29 c1                	sub    %eax,%ecx
+  803b8c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b91:	89 c8                	mov    %ecx,%eax
+  803b93:	f7 e2                	mul    %edx
+  803b95:	c1 ea 0c             	shr    $0xc,%edx
+  803b98:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b9e:	29 d1                	sub    %edx,%ecx
+  803ba0:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803ba6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803bad:	00 00 00 
+	stat->st_dev = &devpipe;
+  803bb0:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803bb7:	50 80 00 
+}
+  803bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bc2:	5b                   	pop    %ebx
+  803bc3:	5e                   	pop    %esi
+  803bc4:	5d                   	pop    %ebp
+  803bc5:	c3                   	ret
+
+00803bc6 <devpipe_poll>:
+{
+  803bc6:	55                   	push   %ebp
+  803bc7:	89 e5                	mov    %esp,%ebp
+  803bc9:	57                   	push   %edi
+  803bca:	56                   	push   %esi
+  803bcb:	53                   	push   %ebx
+  803bcc:	83 ec 18             	sub    $0x18,%esp
+  803bcf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803bd2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803bd5:	57                   	push   %edi
+  803bd6:	e8 bf e1 ff ff       	call   801d9a <fd2data>
+  803bdb:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803bdd:	83 c4 10             	add    $0x10,%esp
+  803be0:	89 f3                	mov    %esi,%ebx
+  803be2:	83 e3 01             	and    $0x1,%ebx
+  803be5:	75 27                	jne    803c0e <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803be7:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803bed:	75 48                	jne    803c37 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803bef:	89 ca                	mov    %ecx,%edx
+  803bf1:	89 f8                	mov    %edi,%eax
+  803bf3:	e8 ce fb ff ff       	call   8037c6 <_pipeisclosed>
+  803bf8:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803bfa:	89 d8                	mov    %ebx,%eax
+  803bfc:	83 c8 10             	or     $0x10,%eax
+  803bff:	85 d2                	test   %edx,%edx
+  803c01:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803c04:	89 d8                	mov    %ebx,%eax
+  803c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c09:	5b                   	pop    %ebx
+  803c0a:	5e                   	pop    %esi
+  803c0b:	5f                   	pop    %edi
+  803c0c:	5d                   	pop    %ebp
+  803c0d:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803c0e:	8b 58 04             	mov    0x4(%eax),%ebx
+  803c11:	8b 00                	mov    (%eax),%eax
+  803c13:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803c19:	29 c3                	sub    %eax,%ebx
+  803c1b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803c20:	89 d8                	mov    %ebx,%eax
+  803c22:	f7 e2                	mul    %edx
+  803c24:	c1 ea 0c             	shr    $0xc,%edx
+  803c27:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803c2d:	39 d3                	cmp    %edx,%ebx
+  803c2f:	0f 95 c3             	setne  %bl
+  803c32:	0f b6 db             	movzbl %bl,%ebx
+  803c35:	eb b0                	jmp    803be7 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803c37:	8b 71 04             	mov    0x4(%ecx),%esi
+  803c3a:	8b 01                	mov    (%ecx),%eax
+  803c3c:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803c42:	29 c6                	sub    %eax,%esi
+  803c44:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803c49:	89 f0                	mov    %esi,%eax
+  803c4b:	f7 e2                	mul    %edx
+  803c4d:	c1 ea 0c             	shr    $0xc,%edx
+  803c50:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803c56:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803c58:	89 d8                	mov    %ebx,%eax
+  803c5a:	83 c8 04             	or     $0x4,%eax
+  803c5d:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803c63:	0f 42 d8             	cmovb  %eax,%ebx
+  803c66:	eb 87                	jmp    803bef <devpipe_poll+0x29>
+
+00803c68 <pipe>:
+{
+  803c68:	55                   	push   %ebp
+  803c69:	89 e5                	mov    %esp,%ebp
+  803c6b:	56                   	push   %esi
+  803c6c:	53                   	push   %ebx
+  803c6d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803c70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c73:	50                   	push   %eax
+  803c74:	e8 38 e1 ff ff       	call   801db1 <fd_alloc>
+  803c79:	89 c3                	mov    %eax,%ebx
+  803c7b:	83 c4 10             	add    $0x10,%esp
+  803c7e:	85 c0                	test   %eax,%eax
+  803c80:	0f 88 23 01 00 00    	js     803da9 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c86:	83 ec 04             	sub    $0x4,%esp
+  803c89:	68 07 04 00 00       	push   $0x407
+  803c8e:	ff 75 f4             	push   -0xc(%ebp)
+  803c91:	6a 00                	push   $0x0
+  803c93:	e8 db d1 ff ff       	call   800e73 <sys_page_alloc>
+  803c98:	89 c3                	mov    %eax,%ebx
+  803c9a:	83 c4 10             	add    $0x10,%esp
+  803c9d:	85 c0                	test   %eax,%eax
+  803c9f:	0f 88 04 01 00 00    	js     803da9 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803ca5:	83 ec 0c             	sub    $0xc,%esp
+  803ca8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803cab:	50                   	push   %eax
+  803cac:	e8 00 e1 ff ff       	call   801db1 <fd_alloc>
+  803cb1:	89 c3                	mov    %eax,%ebx
+  803cb3:	83 c4 10             	add    $0x10,%esp
+  803cb6:	85 c0                	test   %eax,%eax
+  803cb8:	0f 88 db 00 00 00    	js     803d99 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803cbe:	83 ec 04             	sub    $0x4,%esp
+  803cc1:	68 07 04 00 00       	push   $0x407
+  803cc6:	ff 75 f0             	push   -0x10(%ebp)
+  803cc9:	6a 00                	push   $0x0
+  803ccb:	e8 a3 d1 ff ff       	call   800e73 <sys_page_alloc>
+  803cd0:	89 c3                	mov    %eax,%ebx
+  803cd2:	83 c4 10             	add    $0x10,%esp
+  803cd5:	85 c0                	test   %eax,%eax
+  803cd7:	0f 88 bc 00 00 00    	js     803d99 <pipe+0x131>
+	va = fd2data(fd0);
+  803cdd:	83 ec 0c             	sub    $0xc,%esp
+  803ce0:	ff 75 f4             	push   -0xc(%ebp)
+  803ce3:	e8 b2 e0 ff ff       	call   801d9a <fd2data>
+  803ce8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803cea:	83 c4 0c             	add    $0xc,%esp
+  803ced:	68 07 04 00 00       	push   $0x407
+  803cf2:	50                   	push   %eax
+  803cf3:	6a 00                	push   $0x0
+  803cf5:	e8 79 d1 ff ff       	call   800e73 <sys_page_alloc>
+  803cfa:	89 c3                	mov    %eax,%ebx
+  803cfc:	83 c4 10             	add    $0x10,%esp
+  803cff:	85 c0                	test   %eax,%eax
+  803d01:	0f 88 82 00 00 00    	js     803d89 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d07:	83 ec 0c             	sub    $0xc,%esp
+  803d0a:	ff 75 f0             	push   -0x10(%ebp)
+  803d0d:	e8 88 e0 ff ff       	call   801d9a <fd2data>
+  803d12:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803d19:	50                   	push   %eax
+  803d1a:	6a 00                	push   $0x0
+  803d1c:	56                   	push   %esi
+  803d1d:	6a 00                	push   $0x0
+  803d1f:	e8 92 d1 ff ff       	call   800eb6 <sys_page_map>
+  803d24:	89 c3                	mov    %eax,%ebx
+  803d26:	83 c4 20             	add    $0x20,%esp
+  803d29:	85 c0                	test   %eax,%eax
+  803d2b:	78 4e                	js     803d7b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803d2d:	a1 60 50 80 00       	mov    0x805060,%eax
+  803d32:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803d35:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803d37:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803d3a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803d41:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803d44:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803d46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803d49:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803d50:	83 ec 0c             	sub    $0xc,%esp
+  803d53:	ff 75 f4             	push   -0xc(%ebp)
+  803d56:	e8 2f e0 ff ff       	call   801d8a <fd2num>
+  803d5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d5e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803d60:	83 c4 04             	add    $0x4,%esp
+  803d63:	ff 75 f0             	push   -0x10(%ebp)
+  803d66:	e8 1f e0 ff ff       	call   801d8a <fd2num>
+  803d6b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d6e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803d71:	83 c4 10             	add    $0x10,%esp
+  803d74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d79:	eb 2e                	jmp    803da9 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803d7b:	83 ec 08             	sub    $0x8,%esp
+  803d7e:	56                   	push   %esi
+  803d7f:	6a 00                	push   $0x0
+  803d81:	e8 72 d1 ff ff       	call   800ef8 <sys_page_unmap>
+  803d86:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803d89:	83 ec 08             	sub    $0x8,%esp
+  803d8c:	ff 75 f0             	push   -0x10(%ebp)
+  803d8f:	6a 00                	push   $0x0
+  803d91:	e8 62 d1 ff ff       	call   800ef8 <sys_page_unmap>
+  803d96:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803d99:	83 ec 08             	sub    $0x8,%esp
+  803d9c:	ff 75 f4             	push   -0xc(%ebp)
+  803d9f:	6a 00                	push   $0x0
+  803da1:	e8 52 d1 ff ff       	call   800ef8 <sys_page_unmap>
+  803da6:	83 c4 10             	add    $0x10,%esp
+}
+  803da9:	89 d8                	mov    %ebx,%eax
+  803dab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dae:	5b                   	pop    %ebx
+  803daf:	5e                   	pop    %esi
+  803db0:	5d                   	pop    %ebp
+  803db1:	c3                   	ret
+
+00803db2 <pipeisclosed>:
+{
+  803db2:	55                   	push   %ebp
+  803db3:	89 e5                	mov    %esp,%ebp
+  803db5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803db8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803dbb:	50                   	push   %eax
+  803dbc:	ff 75 08             	push   0x8(%ebp)
+  803dbf:	e8 3d e0 ff ff       	call   801e01 <fd_lookup>
+  803dc4:	83 c4 10             	add    $0x10,%esp
+  803dc7:	85 c0                	test   %eax,%eax
+  803dc9:	78 18                	js     803de3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803dcb:	83 ec 0c             	sub    $0xc,%esp
+  803dce:	ff 75 f4             	push   -0xc(%ebp)
+  803dd1:	e8 c4 df ff ff       	call   801d9a <fd2data>
+  803dd6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803dd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ddb:	e8 e6 f9 ff ff       	call   8037c6 <_pipeisclosed>
+  803de0:	83 c4 10             	add    $0x10,%esp
+}
+  803de3:	c9                   	leave
+  803de4:	c3                   	ret
+
+00803de5 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803de5:	55                   	push   %ebp
+  803de6:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803deb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803df1:	5d                   	pop    %ebp
+  803df2:	c3                   	ret
+
+00803df3 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803df3:	55                   	push   %ebp
+  803df4:	89 e5                	mov    %esp,%ebp
+  803df6:	53                   	push   %ebx
+  803df7:	83 ec 04             	sub    $0x4,%esp
+  803dfa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803dfd:	8b 03                	mov    (%ebx),%eax
+  803dff:	85 c0                	test   %eax,%eax
+  803e01:	75 05                	jne    803e08 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803e03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e06:	c9                   	leave
+  803e07:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803e08:	83 ec 08             	sub    $0x8,%esp
+  803e0b:	50                   	push   %eax
+  803e0c:	8d 43 04             	lea    0x4(%ebx),%eax
+  803e0f:	50                   	push   %eax
+  803e10:	e8 33 d3 ff ff       	call   801148 <sys_page_batch>
+	pb->pb_n = 0;
+  803e15:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803e1b:	83 c4 10             	add    $0x10,%esp
+  803e1e:	eb e3                	jmp    803e03 <pgbatch_flush+0x10>
+
+00803e20 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803e20:	55                   	push   %ebp
+  803e21:	89 e5                	mov    %esp,%ebp
+  803e23:	56                   	push   %esi
+  803e24:	53                   	push   %ebx
+  803e25:	89 c3                	mov    %eax,%ebx
+  803e27:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803e29:	83 38 20             	cmpl   $0x20,(%eax)
+  803e2c:	74 2c                	je     803e5a <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803e2e:	8b 03                	mov    (%ebx),%eax
+  803e30:	8d 50 01             	lea    0x1(%eax),%edx
+  803e33:	89 13                	mov    %edx,(%ebx)
+  803e35:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803e38:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803e3c:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803e3e:	83 ec 04             	sub    $0x4,%esp
+  803e41:	6a 18                	push   $0x18
+  803e43:	6a 00                	push   $0x0
+  803e45:	50                   	push   %eax
+  803e46:	e8 6f cd ff ff       	call   800bba <memset>
+	return 0;
+  803e4b:	83 c4 10             	add    $0x10,%esp
+  803e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e56:	5b                   	pop    %ebx
+  803e57:	5e                   	pop    %esi
+  803e58:	5d                   	pop    %ebp
+  803e59:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803e5a:	83 ec 0c             	sub    $0xc,%esp
+  803e5d:	50                   	push   %eax
+  803e5e:	e8 90 ff ff ff       	call   803df3 <pgbatch_flush>
+  803e63:	83 c4 10             	add    $0x10,%esp
+  803e66:	85 c0                	test   %eax,%eax
+  803e68:	79 c4                	jns    803e2e <pgbatch_slot+0xe>
+  803e6a:	eb e7                	jmp    803e53 <pgbatch_slot+0x33>
+
+00803e6c <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803e6c:	55                   	push   %ebp
+  803e6d:	89 e5                	mov    %esp,%ebp
+  803e6f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e72:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e75:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e78:	e8 a3 ff ff ff       	call   803e20 <pgbatch_slot>
+  803e7d:	85 c0                	test   %eax,%eax
+  803e7f:	78 20                	js     803ea1 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803e81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e84:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803e8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e8d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e90:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e93:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e96:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e99:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ea1:	c9                   	leave
+  803ea2:	c3                   	ret
+
+00803ea3 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803ea3:	55                   	push   %ebp
+  803ea4:	89 e5                	mov    %esp,%ebp
+  803ea6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ea9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803eac:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eaf:	e8 6c ff ff ff       	call   803e20 <pgbatch_slot>
+  803eb4:	85 c0                	test   %eax,%eax
+  803eb6:	78 2c                	js     803ee4 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803eb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ebb:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803ec1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ec4:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803ec7:	8b 55 10             	mov    0x10(%ebp),%edx
+  803eca:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803ecd:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ed0:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803ed3:	8b 55 18             	mov    0x18(%ebp),%edx
+  803ed6:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ed9:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803edc:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee4:	c9                   	leave
+  803ee5:	c3                   	ret
+
+00803ee6 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803ee6:	55                   	push   %ebp
+  803ee7:	89 e5                	mov    %esp,%ebp
+  803ee9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803eec:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ef2:	e8 29 ff ff ff       	call   803e20 <pgbatch_slot>
+  803ef7:	85 c0                	test   %eax,%eax
+  803ef9:	78 1a                	js     803f15 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803efb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803efe:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803f04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f07:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f0a:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f0d:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803f10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f15:	c9                   	leave
+  803f16:	c3                   	ret
+
+00803f17 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803f17:	55                   	push   %ebp
+  803f18:	89 e5                	mov    %esp,%ebp
+  803f1a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f1d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f20:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f23:	e8 f8 fe ff ff       	call   803e20 <pgbatch_slot>
+  803f28:	85 c0                	test   %eax,%eax
+  803f2a:	78 20                	js     803f4c <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803f2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f2f:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803f35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f38:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f3b:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f3e:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803f41:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f44:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f4c:	c9                   	leave
+  803f4d:	c3                   	ret
+
+00803f4e <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803f4e:	55                   	push   %ebp
+  803f4f:	89 e5                	mov    %esp,%ebp
+  803f51:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f54:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f57:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f5a:	e8 c1 fe ff ff       	call   803e20 <pgbatch_slot>
+  803f5f:	85 c0                	test   %eax,%eax
+  803f61:	78 26                	js     803f89 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803f63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f66:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803f6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f6f:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803f72:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f75:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803f78:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f7b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803f7e:	8b 55 18             	mov    0x18(%ebp),%edx
+  803f81:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f89:	c9                   	leave
+  803f8a:	c3                   	ret
+
+00803f8b <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803f8b:	55                   	push   %ebp
+  803f8c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803f8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f91:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803f97:	5d                   	pop    %ebp
+  803f98:	c3                   	ret
+
+00803f99 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803f99:	55                   	push   %ebp
+  803f9a:	89 e5                	mov    %esp,%ebp
+  803f9c:	56                   	push   %esi
+  803f9d:	53                   	push   %ebx
+  803f9e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa6:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fab:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803faf:	85 c0                	test   %eax,%eax
+  803fb1:	74 2f                	je     803fe2 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803fb3:	83 f8 02             	cmp    $0x2,%eax
+  803fb6:	74 0c                	je     803fc4 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803fb8:	b8 02 00 00 00       	mov    $0x2,%eax
+  803fbd:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803fc0:	85 c0                	test   %eax,%eax
+  803fc2:	74 1e                	je     803fe2 <mutex_lock+0x49>
+  803fc4:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803fc9:	83 ec 04             	sub    $0x4,%esp
+  803fcc:	6a ff                	push   $0xffffffff
+  803fce:	6a 02                	push   $0x2
+  803fd0:	53                   	push   %ebx
+  803fd1:	e8 9b d2 ff ff       	call   801271 <sys_futex_wait>
+  803fd6:	89 f0                	mov    %esi,%eax
+  803fd8:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803fdb:	83 c4 10             	add    $0x10,%esp
+  803fde:	85 c0                	test   %eax,%eax
+  803fe0:	75 e7                	jne    803fc9 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803fe2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803fe5:	5b                   	pop    %ebx
+  803fe6:	5e                   	pop    %esi
+  803fe7:	5d                   	pop    %ebp
+  803fe8:	c3                   	ret
+
+00803fe9 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803fe9:	55                   	push   %ebp
+  803fea:	89 e5                	mov    %esp,%ebp
+  803fec:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ff9:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803ffd:	85 c0                	test   %eax,%eax
+  803fff:	0f 94 c0             	sete   %al
+  804002:	0f b6 c0             	movzbl %al,%eax
+}
+  804005:	5d                   	pop    %ebp
+  804006:	c3                   	ret
+
+00804007 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804007:	55                   	push   %ebp
+  804008:	89 e5                	mov    %esp,%ebp
+  80400a:	83 ec 08             	sub    $0x8,%esp
+  80400d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  804010:	b8 00 00 00 00       	mov    $0x0,%eax
+  804015:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  804018:	83 f8 02             	cmp    $0x2,%eax
+  80401b:	74 02                	je     80401f <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80401d:	c9                   	leave
+  80401e:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80401f:	83 ec 08             	sub    $0x8,%esp
+  804022:	6a 01                	push   $0x1
+  804024:	52                   	push   %edx
+  804025:	e8 69 d2 ff ff       	call   801293 <sys_futex_wake>
+  80402a:	83 c4 10             	add    $0x10,%esp
+}
+  80402d:	eb ee                	jmp    80401d <mutex_unlock+0x16>
+
+0080402f <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  80402f:	55                   	push   %ebp
+  804030:	89 e5                	mov    %esp,%ebp
+  804032:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  804035:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  80403b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804042:	5d                   	pop    %ebp
+  804043:	c3                   	ret
+
+00804044 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  804044:	55                   	push   %ebp
+  804045:	89 e5                	mov    %esp,%ebp
+  804047:	57                   	push   %edi
+  804048:	56                   	push   %esi
+  804049:	53                   	push   %ebx
+  80404a:	83 ec 18             	sub    $0x18,%esp
+  80404d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804050:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  804053:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  804055:	b8 01 00 00 00       	mov    $0x1,%eax
+  80405a:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  80405f:	57                   	push   %edi
+  804060:	e8 a2 ff ff ff       	call   804007 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804065:	83 c4 0c             	add    $0xc,%esp
+  804068:	ff 75 10             	push   0x10(%ebp)
+  80406b:	56                   	push   %esi
+  80406c:	53                   	push   %ebx
+  80406d:	e8 ff d1 ff ff       	call   801271 <sys_futex_wait>
+  804072:	89 c6                	mov    %eax,%esi
+  804074:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804079:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  80407e:	89 3c 24             	mov    %edi,(%esp)
+  804081:	e8 13 ff ff ff       	call   803f99 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804086:	83 c4 10             	add    $0x10,%esp
+  804089:	83 fe ef             	cmp    $0xffffffef,%esi
+  80408c:	74 05                	je     804093 <cond_timedwait+0x4f>
+  80408e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804093:	89 f0                	mov    %esi,%eax
+  804095:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804098:	5b                   	pop    %ebx
+  804099:	5e                   	pop    %esi
+  80409a:	5f                   	pop    %edi
+  80409b:	5d                   	pop    %ebp
+  80409c:	c3                   	ret
+
+0080409d <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80409d:	55                   	push   %ebp
+  80409e:	89 e5                	mov    %esp,%ebp
+  8040a0:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  8040a3:	6a ff                	push   $0xffffffff
+  8040a5:	ff 75 0c             	push   0xc(%ebp)
+  8040a8:	ff 75 08             	push   0x8(%ebp)
+  8040ab:	e8 94 ff ff ff       	call   804044 <cond_timedwait>
+}
+  8040b0:	83 c4 10             	add    $0x10,%esp
+  8040b3:	c9                   	leave
+  8040b4:	c3                   	ret
+
+008040b5 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8040b5:	55                   	push   %ebp
+  8040b6:	89 e5                	mov    %esp,%ebp
+  8040b8:	83 ec 08             	sub    $0x8,%esp
+  8040bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040be:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040c3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8040c7:	8b 50 04             	mov    0x4(%eax),%edx
+  8040ca:	85 d2                	test   %edx,%edx
+  8040cc:	75 02                	jne    8040d0 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  8040ce:	c9                   	leave
+  8040cf:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  8040d0:	83 ec 08             	sub    $0x8,%esp
+  8040d3:	6a 01                	push   $0x1
+  8040d5:	50                   	push   %eax
+  8040d6:	e8 b8 d1 ff ff       	call   801293 <sys_futex_wake>
+  8040db:	83 c4 10             	add    $0x10,%esp
+}
+  8040de:	eb ee                	jmp    8040ce <cond_signal+0x19>
+
+008040e0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8040e0:	55                   	push   %ebp
+  8040e1:	89 e5                	mov    %esp,%ebp
+  8040e3:	83 ec 08             	sub    $0x8,%esp
+  8040e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040e9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040ee:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8040f2:	8b 50 04             	mov    0x4(%eax),%edx
+  8040f5:	85 d2                	test   %edx,%edx
+  8040f7:	75 02                	jne    8040fb <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  8040f9:	c9                   	leave
+  8040fa:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  8040fb:	83 ec 08             	sub    $0x8,%esp
+  8040fe:	68 00 04 00 00       	push   $0x400
+  804103:	50                   	push   %eax
+  804104:	e8 8a d1 ff ff       	call   801293 <sys_futex_wake>
+  804109:	83 c4 10             	add    $0x10,%esp
+}
+  80410c:	eb eb                	jmp    8040f9 <cond_broadcast+0x19>
+
+0080410e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80410e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804113:	c3                   	ret
+
+00804114 <devcons_poll>:
+{
+  804114:	55                   	push   %ebp
+  804115:	89 e5                	mov    %esp,%ebp
+  804117:	53                   	push   %ebx
+  804118:	83 ec 04             	sub    $0x4,%esp
+  80411b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80411e:	89 da                	mov    %ebx,%edx
+  804120:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804123:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  80412a:	74 0c                	je     804138 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80412c:	89 d8                	mov    %ebx,%eax
+  80412e:	83 e0 01             	and    $0x1,%eax
+  804131:	09 d0                	or     %edx,%eax
+}
+  804133:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804136:	c9                   	leave
+  804137:	c3                   	ret
+		cons_peek = sys_cgetc();
+  804138:	e8 98 cc ff ff       	call   800dd5 <sys_cgetc>
+  80413d:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804142:	89 da                	mov    %ebx,%edx
+  804144:	83 e2 04             	and    $0x4,%edx
+  804147:	85 c0                	test   %eax,%eax
+  804149:	74 e6                	je     804131 <devcons_poll+0x1d>
+  80414b:	eb df                	jmp    80412c <devcons_poll+0x18>
+
+0080414d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80414d:	55                   	push   %ebp
+  80414e:	89 e5                	mov    %esp,%ebp
+  804150:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804153:	68 b2 4b 80 00       	push   $0x804bb2
+  804158:	ff 75 0c             	push   0xc(%ebp)
+  80415b:	e8 df c8 ff ff       	call   800a3f <strcpy>
+	return 0;
+}
+  804160:	b8 00 00 00 00       	mov    $0x0,%eax
+  804165:	c9                   	leave
+  804166:	c3                   	ret
+
+00804167 <devcons_write>:
+{
+  804167:	55                   	push   %ebp
+  804168:	89 e5                	mov    %esp,%ebp
+  80416a:	57                   	push   %edi
+  80416b:	56                   	push   %esi
+  80416c:	53                   	push   %ebx
+  80416d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804173:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804176:	85 ff                	test   %edi,%edi
+  804178:	74 51                	je     8041cb <devcons_write+0x64>
+  80417a:	be 00 00 00 00       	mov    $0x0,%esi
+  80417f:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804184:	89 fb                	mov    %edi,%ebx
+  804186:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  804188:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80418d:	39 d3                	cmp    %edx,%ebx
+  80418f:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804192:	83 ec 04             	sub    $0x4,%esp
+  804195:	53                   	push   %ebx
+  804196:	03 45 0c             	add    0xc(%ebp),%eax
+  804199:	50                   	push   %eax
+  80419a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8041a0:	50                   	push   %eax
+  8041a1:	e8 49 ca ff ff       	call   800bef <memmove>
+		sys_cputs(buf, m);
+  8041a6:	83 c4 08             	add    $0x8,%esp
+  8041a9:	53                   	push   %ebx
+  8041aa:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8041b0:	50                   	push   %eax
+  8041b1:	e8 01 cc ff ff       	call   800db7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8041b6:	01 de                	add    %ebx,%esi
+  8041b8:	89 f0                	mov    %esi,%eax
+  8041ba:	83 c4 10             	add    $0x10,%esp
+  8041bd:	39 fe                	cmp    %edi,%esi
+  8041bf:	72 c3                	jb     804184 <devcons_write+0x1d>
+}
+  8041c1:	89 f0                	mov    %esi,%eax
+  8041c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041c6:	5b                   	pop    %ebx
+  8041c7:	5e                   	pop    %esi
+  8041c8:	5f                   	pop    %edi
+  8041c9:	5d                   	pop    %ebp
+  8041ca:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8041cb:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8041d0:	eb ef                	jmp    8041c1 <devcons_write+0x5a>
+
+008041d2 <devcons_read>:
+{
+  8041d2:	55                   	push   %ebp
+  8041d3:	89 e5                	mov    %esp,%ebp
+  8041d5:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8041d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8041dd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8041e1:	74 36                	je     804219 <devcons_read+0x47>
+	c = cons_peek;
+  8041e3:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  8041e8:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  8041ef:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8041f2:	85 c0                	test   %eax,%eax
+  8041f4:	75 10                	jne    804206 <devcons_read+0x34>
+  8041f6:	e8 da cb ff ff       	call   800dd5 <sys_cgetc>
+  8041fb:	85 c0                	test   %eax,%eax
+  8041fd:	75 07                	jne    804206 <devcons_read+0x34>
+		sys_yield();
+  8041ff:	e8 50 cc ff ff       	call   800e54 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804204:	eb f0                	jmp    8041f6 <devcons_read+0x24>
+	if (c < 0)
+  804206:	85 c0                	test   %eax,%eax
+  804208:	78 0f                	js     804219 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80420a:	83 f8 04             	cmp    $0x4,%eax
+  80420d:	74 0c                	je     80421b <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80420f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804212:	88 02                	mov    %al,(%edx)
+	return 1;
+  804214:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804219:	c9                   	leave
+  80421a:	c3                   	ret
+		return 0;
+  80421b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804220:	eb f7                	jmp    804219 <devcons_read+0x47>
+
+00804222 <cputchar>:
+{
+  804222:	55                   	push   %ebp
+  804223:	89 e5                	mov    %esp,%ebp
+  804225:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804228:	8b 45 08             	mov    0x8(%ebp),%eax
+  80422b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80422e:	6a 01                	push   $0x1
+  804230:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804233:	50                   	push   %eax
+  804234:	e8 7e cb ff ff       	call   800db7 <sys_cputs>
+}
+  804239:	83 c4 10             	add    $0x10,%esp
+  80423c:	c9                   	leave
+  80423d:	c3                   	ret
+
+0080423e <getchar>:
+{
+  80423e:	55                   	push   %ebp
+  80423f:	89 e5                	mov    %esp,%ebp
+  804241:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804244:	6a 01                	push   $0x1
+  804246:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804249:	50                   	push   %eax
+  80424a:	6a 00                	push   $0x0
+  80424c:	e8 34 de ff ff       	call   802085 <read>
+	if (r < 0)
+  804251:	83 c4 10             	add    $0x10,%esp
+  804254:	85 c0                	test   %eax,%eax
+  804256:	78 06                	js     80425e <getchar+0x20>
+	if (r < 1)
+  804258:	74 06                	je     804260 <getchar+0x22>
+	return c;
+  80425a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80425e:	c9                   	leave
+  80425f:	c3                   	ret
+		return -E_EOF;
+  804260:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804265:	eb f7                	jmp    80425e <getchar+0x20>
+
+00804267 <iscons>:
+{
+  804267:	55                   	push   %ebp
+  804268:	89 e5                	mov    %esp,%ebp
+  80426a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80426d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804270:	50                   	push   %eax
+  804271:	ff 75 08             	push   0x8(%ebp)
+  804274:	e8 88 db ff ff       	call   801e01 <fd_lookup>
+  804279:	83 c4 10             	add    $0x10,%esp
+  80427c:	85 c0                	test   %eax,%eax
+  80427e:	78 11                	js     804291 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804283:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  804289:	39 10                	cmp    %edx,(%eax)
+  80428b:	0f 94 c0             	sete   %al
+  80428e:	0f b6 c0             	movzbl %al,%eax
+}
+  804291:	c9                   	leave
+  804292:	c3                   	ret
+
+00804293 <opencons>:
+{
+  804293:	55                   	push   %ebp
+  804294:	89 e5                	mov    %esp,%ebp
+  804296:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804299:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80429c:	50                   	push   %eax
+  80429d:	e8 0f db ff ff       	call   801db1 <fd_alloc>
+  8042a2:	83 c4 10             	add    $0x10,%esp
+  8042a5:	85 c0                	test   %eax,%eax
+  8042a7:	78 3a                	js     8042e3 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8042a9:	83 ec 04             	sub    $0x4,%esp
+  8042ac:	68 07 04 00 00       	push   $0x407
+  8042b1:	ff 75 f4             	push   -0xc(%ebp)
+  8042b4:	6a 00                	push   $0x0
+  8042b6:	e8 b8 cb ff ff       	call   800e73 <sys_page_alloc>
+  8042bb:	83 c4 10             	add    $0x10,%esp
+  8042be:	85 c0                	test   %eax,%eax
+  8042c0:	78 21                	js     8042e3 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8042c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042c5:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8042cb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8042cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042d0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8042d7:	83 ec 0c             	sub    $0xc,%esp
+  8042da:	50                   	push   %eax
+  8042db:	e8 aa da ff ff       	call   801d8a <fd2num>
+  8042e0:	83 c4 10             	add    $0x10,%esp
+}
+  8042e3:	c9                   	leave
+  8042e4:	c3                   	ret
+
+008042e5 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8042e5:	55                   	push   %ebp
+  8042e6:	89 e5                	mov    %esp,%ebp
+  8042e8:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8042eb:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8042f2:	74 0a                	je     8042fe <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8042f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042f7:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8042fc:	c9                   	leave
+  8042fd:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8042fe:	83 ec 04             	sub    $0x4,%esp
+  804301:	6a 07                	push   $0x7
+  804303:	68 00 f0 bf ee       	push   $0xeebff000
+  804308:	6a 00                	push   $0x0
+  80430a:	e8 64 cb ff ff       	call   800e73 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80430f:	83 c4 08             	add    $0x8,%esp
+  804312:	68 23 43 80 00       	push   $0x804323
+  804317:	6a 00                	push   $0x0
+  804319:	e8 a0 cc ff ff       	call   800fbe <sys_env_set_pgfault_upcall>
+  80431e:	83 c4 10             	add    $0x10,%esp
+  804321:	eb d1                	jmp    8042f4 <set_pgfault_handler+0xf>
+
+00804323 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804323:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804324:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804329:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80432b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  80432e:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804332:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804335:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804339:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  80433b:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80433f:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804342:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804343:	83 c4 04             	add    $0x4,%esp
+	popf
+  804346:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804347:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804348:	c3                   	ret
+
+00804349 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804349:	55                   	push   %ebp
+  80434a:	89 e5                	mov    %esp,%ebp
+  80434c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80434f:	89 c2                	mov    %eax,%edx
+  804351:	c1 ea 16             	shr    $0x16,%edx
+  804354:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80435b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804360:	f6 c1 01             	test   $0x1,%cl
+  804363:	74 1e                	je     804383 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804365:	c1 e8 0c             	shr    $0xc,%eax
+  804368:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80436f:	a8 01                	test   $0x1,%al
+  804371:	74 10                	je     804383 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804373:	c1 e8 0c             	shr    $0xc,%eax
+  804376:	c1 e0 04             	shl    $0x4,%eax
+  804379:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804380:	0f b7 d2             	movzwl %dx,%edx
+}
+  804383:	89 d0                	mov    %edx,%eax
+  804385:	5d                   	pop    %ebp
+  804386:	c3                   	ret
+
+00804387 <__udivdi3>:
+  804387:	57                   	push   %edi
+  804388:	56                   	push   %esi
+  804389:	53                   	push   %ebx
+  80438a:	83 ec 20             	sub    $0x20,%esp
+  80438d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804391:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804395:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804399:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80439d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8043a1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8043a5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8043a9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8043ad:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8043b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043bc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8043c3:	00 
+  8043c4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8043cb:	00 
+  8043cc:	eb 08                	jmp    8043d6 <__udivdi3+0x4f>
+  8043ce:	83 e9 01             	sub    $0x1,%ecx
+  8043d1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8043d4:	74 68                	je     80443e <__udivdi3+0xb7>
+  8043d6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8043da:	01 c0                	add    %eax,%eax
+  8043dc:	89 c6                	mov    %eax,%esi
+  8043de:	89 d7                	mov    %edx,%edi
+  8043e0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8043e4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8043e8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8043eb:	d3 ea                	shr    %cl,%edx
+  8043ed:	f6 c1 20             	test   $0x20,%cl
+  8043f0:	74 04                	je     8043f6 <__udivdi3+0x6f>
+  8043f2:	89 d0                	mov    %edx,%eax
+  8043f4:	31 d2                	xor    %edx,%edx
+  8043f6:	83 e0 01             	and    $0x1,%eax
+  8043f9:	89 04 24             	mov    %eax,(%esp)
+  8043fc:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804403:	00 
+  804404:	8b 04 24             	mov    (%esp),%eax
+  804407:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80440b:	09 f0                	or     %esi,%eax
+  80440d:	09 fa                	or     %edi,%edx
+  80440f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804413:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804417:	39 f0                	cmp    %esi,%eax
+  804419:	89 d3                	mov    %edx,%ebx
+  80441b:	19 fb                	sbb    %edi,%ebx
+  80441d:	72 af                	jb     8043ce <__udivdi3+0x47>
+  80441f:	29 f0                	sub    %esi,%eax
+  804421:	19 fa                	sbb    %edi,%edx
+  804423:	89 cf                	mov    %ecx,%edi
+  804425:	c1 ef 05             	shr    $0x5,%edi
+  804428:	83 e7 01             	and    $0x1,%edi
+  80442b:	89 fe                	mov    %edi,%esi
+  80442d:	83 f6 01             	xor    $0x1,%esi
+  804430:	d3 e6                	shl    %cl,%esi
+  804432:	d3 e7                	shl    %cl,%edi
+  804434:	09 74 24 18          	or     %esi,0x18(%esp)
+  804438:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80443c:	eb 90                	jmp    8043ce <__udivdi3+0x47>
+  80443e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804442:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804446:	83 c4 20             	add    $0x20,%esp
+  804449:	5b                   	pop    %ebx
+  80444a:	5e                   	pop    %esi
+  80444b:	5f                   	pop    %edi
+  80444c:	c3                   	ret
+
+0080444d <__umoddi3>:
+  80444d:	57                   	push   %edi
+  80444e:	56                   	push   %esi
+  80444f:	53                   	push   %ebx
+  804450:	83 ec 08             	sub    $0x8,%esp
+  804453:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804457:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80445b:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80445f:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804463:	57                   	push   %edi
+  804464:	56                   	push   %esi
+  804465:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804469:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80446d:	52                   	push   %edx
+  80446e:	50                   	push   %eax
+  80446f:	e8 13 ff ff ff       	call   804387 <__udivdi3>
+  804474:	89 c3                	mov    %eax,%ebx
+  804476:	0f af d6             	imul   %esi,%edx
+  804479:	89 f9                	mov    %edi,%ecx
+  80447b:	0f af cb             	imul   %ebx,%ecx
+  80447e:	01 d1                	add    %edx,%ecx
+  804480:	89 d8                	mov    %ebx,%eax
+  804482:	f7 e6                	mul    %esi
+  804484:	89 c6                	mov    %eax,%esi
+  804486:	89 d7                	mov    %edx,%edi
+  804488:	01 cf                	add    %ecx,%edi
+  80448a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80448e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804492:	29 f0                	sub    %esi,%eax
+  804494:	19 fa                	sbb    %edi,%edx
+  804496:	83 c4 18             	add    $0x18,%esp
+  804499:	5b                   	pop    %ebx
+  80449a:	5e                   	pop    %esi
+  80449b:	5f                   	pop    %edi
+  80449c:	c3                   	ret
+
+0080449d <__divdi3>:
+  80449d:	53                   	push   %ebx
+  80449e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8044a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8044a6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8044aa:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8044ae:	85 d2                	test   %edx,%edx
+  8044b0:	78 12                	js     8044c4 <__divdi3+0x27>
+  8044b2:	85 db                	test   %ebx,%ebx
+  8044b4:	78 2e                	js     8044e4 <__divdi3+0x47>
+  8044b6:	53                   	push   %ebx
+  8044b7:	51                   	push   %ecx
+  8044b8:	52                   	push   %edx
+  8044b9:	50                   	push   %eax
+  8044ba:	e8 c8 fe ff ff       	call   804387 <__udivdi3>
+  8044bf:	83 c4 10             	add    $0x10,%esp
+  8044c2:	eb 1e                	jmp    8044e2 <__divdi3+0x45>
+  8044c4:	f7 d8                	neg    %eax
+  8044c6:	83 d2 00             	adc    $0x0,%edx
+  8044c9:	f7 da                	neg    %edx
+  8044cb:	85 db                	test   %ebx,%ebx
+  8044cd:	78 2a                	js     8044f9 <__divdi3+0x5c>
+  8044cf:	53                   	push   %ebx
+  8044d0:	51                   	push   %ecx
+  8044d1:	52                   	push   %edx
+  8044d2:	50                   	push   %eax
+  8044d3:	e8 af fe ff ff       	call   804387 <__udivdi3>
+  8044d8:	83 c4 10             	add    $0x10,%esp
+  8044db:	f7 d8                	neg    %eax
+  8044dd:	83 d2 00             	adc    $0x0,%edx
+  8044e0:	f7 da                	neg    %edx
+  8044e2:	5b                   	pop    %ebx
+  8044e3:	c3                   	ret
+  8044e4:	f7 d9                	neg    %ecx
+  8044e6:	83 d3 00             	adc    $0x0,%ebx
+  8044e9:	f7 db                	neg    %ebx
+  8044eb:	53                   	push   %ebx
+  8044ec:	51                   	push   %ecx
+  8044ed:	52                   	push   %edx
+  8044ee:	50                   	push   %eax
+  8044ef:	e8 93 fe ff ff       	call   804387 <__udivdi3>
+  8044f4:	83 c4 10             	add    $0x10,%esp
+  8044f7:	eb e2                	jmp    8044db <__divdi3+0x3e>
+  8044f9:	f7 d9                	neg    %ecx
+  8044fb:	83 d3 00             	adc    $0x0,%ebx
+  8044fe:	f7 db                	neg    %ebx
+  804500:	53                   	push   %ebx
+  804501:	51                   	push   %ecx
+  804502:	52                   	push   %edx
+  804503:	50                   	push   %eax
+  804504:	e8 7e fe ff ff       	call   804387 <__udivdi3>
+  804509:	83 c4 10             	add    $0x10,%esp
+  80450c:	eb d4                	jmp    8044e2 <__divdi3+0x45>
+
+0080450e <__moddi3>:
+  80450e:	57                   	push   %edi
+  80450f:	56                   	push   %esi
+  804510:	53                   	push   %ebx
+  804511:	83 ec 08             	sub    $0x8,%esp
+  804514:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804518:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80451c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804520:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804524:	57                   	push   %edi
+  804525:	56                   	push   %esi
+  804526:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80452a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80452e:	52                   	push   %edx
+  80452f:	50                   	push   %eax
+  804530:	e8 68 ff ff ff       	call   80449d <__divdi3>
+  804535:	89 c3                	mov    %eax,%ebx
+  804537:	0f af d6             	imul   %esi,%edx
+  80453a:	89 f9                	mov    %edi,%ecx
+  80453c:	0f af cb             	imul   %ebx,%ecx
+  80453f:	01 d1                	add    %edx,%ecx
+  804541:	89 d8                	mov    %ebx,%eax
+  804543:	f7 e6                	mul    %esi
+  804545:	89 c6                	mov    %eax,%esi
+  804547:	89 d7                	mov    %edx,%edi
+  804549:	01 cf                	add    %ecx,%edi
+  80454b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80454f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804553:	29 f0                	sub    %esi,%eax
+  804555:	19 fa                	sbb    %edi,%edx
+  804557:	83 c4 18             	add    $0x18,%esp
+  80455a:	5b                   	pop    %ebx
+  80455b:	5e                   	pop    %esi
+  80455c:	5f                   	pop    %edi
+  80455d:	c3                   	ret
@@ -0,0 +1,9372 @@
+
+obj/user/lockbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9f 03 00 00       	call   8003d0 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <bench_lock>:
+		xchg(&SHARED->spin, 0);
+}
+
+static void
+bench_lock(bool usemutex, int nenv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 2c             	sub    $0x2c,%esp
+  80003e:	89 c7                	mov    %eax,%edi
+  800040:	89 55 d0             	mov    %edx,-0x30(%ebp)
+	envid_t kids[4];
+	uint64_t t0;
+	uint32_t s0;
+	int i, j;
+
+	SHARED->counter = SHARED->syscalls = SHARED->go = 0;
+  800043:	c7 05 08 00 00 50 00 	movl   $0x0,0x50000008
+  80004a:	00 00 00 
+  80004d:	c7 05 10 00 00 50 00 	movl   $0x0,0x50000010
+  800054:	00 00 00 
+  800057:	c7 05 0c 00 00 50 00 	movl   $0x0,0x5000000c
+  80005e:	00 00 00 
+	for (i = 0; i < nenv; i++) {
+  800061:	85 d2                	test   %edx,%edx
+  800063:	0f 8e 41 01 00 00    	jle    8001aa <bench_lock+0x175>
+  800069:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  800070:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800075:	e9 c2 00 00 00       	jmp    80013c <bench_lock+0x107>
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+  80007a:	50                   	push   %eax
+  80007b:	68 aa 4c 80 00       	push   $0x804caa
+  800080:	6a 38                	push   $0x38
+  800082:	68 f2 47 80 00       	push   $0x8047f2
+  800087:	e8 eb 03 00 00       	call   800477 <_panic>
+		mutex_lock(&SHARED->mutex);
+  80008c:	83 ec 0c             	sub    $0xc,%esp
+  80008f:	68 00 00 00 50       	push   $0x50000000
+  800094:	e8 34 3e 00 00       	call   803ecd <mutex_lock>
+			while (!SHARED->go)
+				sys_futex_wait(&SHARED->go, 0, ~0);
+			s0 = thisenv->env_syscalls;
+			for (j = 0; j < NOPS; j++) {
+				lock(usemutex);
+				SHARED->counter++;
+  800099:	a1 0c 00 00 50       	mov    0x5000000c,%eax
+  80009e:	83 c0 01             	add    $0x1,%eax
+  8000a1:	a3 0c 00 00 50       	mov    %eax,0x5000000c
+		mutex_unlock(&SHARED->mutex);
+  8000a6:	c7 04 24 00 00 00 50 	movl   $0x50000000,(%esp)
+  8000ad:	e8 89 3e 00 00       	call   803f3b <mutex_unlock>
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	eb 19                	jmp    8000d0 <bench_lock+0x9b>
+				SHARED->counter++;
+  8000b7:	a1 0c 00 00 50       	mov    0x5000000c,%eax
+  8000bc:	83 c0 01             	add    $0x1,%eax
+  8000bf:	a3 0c 00 00 50       	mov    %eax,0x5000000c
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	f0 87 05 04 00 00 50 	lock xchg %eax,0x50000004
+			for (j = 0; j < NOPS; j++) {
+  8000d0:	83 ee 01             	sub    $0x1,%esi
+  8000d3:	74 29                	je     8000fe <bench_lock+0xc9>
+	if (usemutex)
+  8000d5:	85 ff                	test   %edi,%edi
+  8000d7:	75 b3                	jne    80008c <bench_lock+0x57>
+  8000d9:	89 d8                	mov    %ebx,%eax
+  8000db:	f0 87 05 04 00 00 50 	lock xchg %eax,0x50000004
+		while (xchg(&SHARED->spin, 1) != 0)
+  8000e2:	85 c0                	test   %eax,%eax
+  8000e4:	0f 84 92 01 00 00    	je     80027c <bench_lock+0x247>
+			sys_yield();
+  8000ea:	e8 6f 0f 00 00       	call   80105e <sys_yield>
+  8000ef:	89 d8                	mov    %ebx,%eax
+  8000f1:	f0 87 05 04 00 00 50 	lock xchg %eax,0x50000004
+		while (xchg(&SHARED->spin, 1) != 0)
+  8000f8:	85 c0                	test   %eax,%eax
+  8000fa:	75 ee                	jne    8000ea <bench_lock+0xb5>
+  8000fc:	eb b9                	jmp    8000b7 <bench_lock+0x82>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000fe:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  800101:	89 e1                	mov    %esp,%ecx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800103:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800108:	29 c8                	sub    %ecx,%eax
+  80010a:	89 c1                	mov    %eax,%ecx
+  80010c:	c1 e9 0f             	shr    $0xf,%ecx
+  80010f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800114:	0f 42 f1             	cmovb  %ecx,%esi
+				unlock(usemutex);
+			}
+			xadd(&SHARED->syscalls, thisenv->env_syscalls - s0);
+  800117:	8b 04 b5 00 6a 80 00 	mov    0x806a00(,%esi,4),%eax
+  80011e:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800121:	29 d0                	sub    %edx,%eax
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  800123:	f0 0f c1 05 10 00 00 	lock xadd %eax,0x50000010
+  80012a:	50 
+			exit();
+  80012b:	e8 2d 03 00 00       	call   80045d <exit>
+	for (i = 0; i < nenv; i++) {
+  800130:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+  800134:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800137:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+  80013a:	74 6e                	je     8001aa <bench_lock+0x175>
+		if ((kids[i] = fork()) < 0)
+  80013c:	e8 44 15 00 00       	call   801685 <fork>
+  800141:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800144:	89 44 8d d8          	mov    %eax,-0x28(%ebp,%ecx,4)
+  800148:	85 c0                	test   %eax,%eax
+  80014a:	0f 88 2a ff ff ff    	js     80007a <bench_lock+0x45>
+		if (kids[i] == 0) {
+  800150:	75 de                	jne    800130 <bench_lock+0xfb>
+			while (!SHARED->go)
+  800152:	a1 08 00 00 50       	mov    0x50000008,%eax
+  800157:	85 c0                	test   %eax,%eax
+  800159:	75 1d                	jne    800178 <bench_lock+0x143>
+				sys_futex_wait(&SHARED->go, 0, ~0);
+  80015b:	83 ec 04             	sub    $0x4,%esp
+  80015e:	6a ff                	push   $0xffffffff
+  800160:	6a 00                	push   $0x0
+  800162:	68 08 00 00 50       	push   $0x50000008
+  800167:	e8 0f 13 00 00       	call   80147b <sys_futex_wait>
+			while (!SHARED->go)
+  80016c:	a1 08 00 00 50       	mov    0x50000008,%eax
+  800171:	83 c4 10             	add    $0x10,%esp
+  800174:	85 c0                	test   %eax,%eax
+  800176:	74 e3                	je     80015b <bench_lock+0x126>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800178:	89 e2                	mov    %esp,%edx
+  80017a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80017f:	29 d0                	sub    %edx,%eax
+  800181:	89 c2                	mov    %eax,%edx
+  800183:	c1 ea 0f             	shr    $0xf,%edx
+  800186:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80018b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800190:	0f 42 c2             	cmovb  %edx,%eax
+			s0 = thisenv->env_syscalls;
+  800193:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80019a:	8b 50 5c             	mov    0x5c(%eax),%edx
+  80019d:	be 20 4e 00 00       	mov    $0x4e20,%esi
+	asm volatile("lock; xchgl %0, %1" :
+  8001a2:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8001a5:	e9 2b ff ff ff       	jmp    8000d5 <bench_lock+0xa0>
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  8001aa:	0f 31                	rdtsc
+  8001ac:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8001af:	89 55 cc             	mov    %edx,-0x34(%ebp)
+		}
+	}
+	t0 = read_tsc();
+	SHARED->go = 1;
+  8001b2:	c7 05 08 00 00 50 01 	movl   $0x1,0x50000008
+  8001b9:	00 00 00 
+	sys_futex_wake(&SHARED->go, nenv);
+  8001bc:	83 ec 08             	sub    $0x8,%esp
+  8001bf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8001c2:	56                   	push   %esi
+  8001c3:	68 08 00 00 50       	push   $0x50000008
+  8001c8:	e8 d0 12 00 00       	call   80149d <sys_futex_wake>
+	for (i = 0; i < nenv; i++)
+  8001cd:	83 c4 10             	add    $0x10,%esp
+  8001d0:	85 f6                	test   %esi,%esi
+  8001d2:	7e 1c                	jle    8001f0 <bench_lock+0x1bb>
+  8001d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		wait(kids[i]);
+  8001d9:	83 ec 0c             	sub    $0xc,%esp
+  8001dc:	ff 74 9d d8          	push   -0x28(%ebp,%ebx,4)
+  8001e0:	e8 d2 3a 00 00       	call   803cb7 <wait>
+	for (i = 0; i < nenv; i++)
+  8001e5:	83 c3 01             	add    $0x1,%ebx
+  8001e8:	83 c4 10             	add    $0x10,%esp
+  8001eb:	39 5d d0             	cmp    %ebx,-0x30(%ebp)
+  8001ee:	75 e9                	jne    8001d9 <bench_lock+0x1a4>
+	if (SHARED->counter != nenv * NOPS)
+  8001f0:	a1 0c 00 00 50       	mov    0x5000000c,%eax
+  8001f5:	69 55 d0 20 4e 00 00 	imul   $0x4e20,-0x30(%ebp),%edx
+  8001fc:	39 d0                	cmp    %edx,%eax
+  8001fe:	75 61                	jne    800261 <bench_lock+0x22c>
+		panic("counter is %d, not %d", SHARED->counter, nenv * NOPS);
+	cprintf("lockbench: %s, %d envs: %u cycles per lock, "
+		"%u syscalls per 1000 locks\n",
+		usemutex ? "mutex   " : "spinlock", nenv,
+		(uint32_t) ((read_tsc() - t0) / (nenv * NOPS)),
+		(uint32_t) ((uint64_t) SHARED->syscalls * 1000 / (nenv * NOPS)));
+  800200:	a1 10 00 00 50       	mov    0x50000010,%eax
+  800205:	89 d3                	mov    %edx,%ebx
+  800207:	89 d6                	mov    %edx,%esi
+  800209:	c1 fe 1f             	sar    $0x1f,%esi
+  80020c:	ba e8 03 00 00       	mov    $0x3e8,%edx
+  800211:	f7 e2                	mul    %edx
+  800213:	56                   	push   %esi
+  800214:	53                   	push   %ebx
+  800215:	52                   	push   %edx
+  800216:	50                   	push   %eax
+  800217:	e8 d7 43 00 00       	call   8045f3 <__udivdi3>
+  80021c:	83 c4 10             	add    $0x10,%esp
+  80021f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800222:	0f 31                	rdtsc
+		(uint32_t) ((read_tsc() - t0) / (nenv * NOPS)),
+  800224:	2b 45 c8             	sub    -0x38(%ebp),%eax
+  800227:	1b 55 cc             	sbb    -0x34(%ebp),%edx
+  80022a:	56                   	push   %esi
+  80022b:	53                   	push   %ebx
+  80022c:	52                   	push   %edx
+  80022d:	50                   	push   %eax
+  80022e:	e8 c0 43 00 00       	call   8045f3 <__udivdi3>
+  800233:	83 c4 04             	add    $0x4,%esp
+  800236:	89 c2                	mov    %eax,%edx
+	cprintf("lockbench: %s, %d envs: %u cycles per lock, "
+  800238:	85 ff                	test   %edi,%edi
+  80023a:	b8 e9 47 80 00       	mov    $0x8047e9,%eax
+  80023f:	b9 e0 47 80 00       	mov    $0x8047e0,%ecx
+  800244:	0f 45 c1             	cmovne %ecx,%eax
+  800247:	ff 75 d4             	push   -0x2c(%ebp)
+  80024a:	52                   	push   %edx
+  80024b:	ff 75 d0             	push   -0x30(%ebp)
+  80024e:	50                   	push   %eax
+  80024f:	68 38 48 80 00       	push   $0x804838
+  800254:	e8 f9 02 00 00       	call   800552 <cprintf>
+}
+  800259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025c:	5b                   	pop    %ebx
+  80025d:	5e                   	pop    %esi
+  80025e:	5f                   	pop    %edi
+  80025f:	5d                   	pop    %ebp
+  800260:	c3                   	ret
+		panic("counter is %d, not %d", SHARED->counter, nenv * NOPS);
+  800261:	a1 0c 00 00 50       	mov    0x5000000c,%eax
+  800266:	83 ec 0c             	sub    $0xc,%esp
+  800269:	52                   	push   %edx
+  80026a:	50                   	push   %eax
+  80026b:	68 03 48 80 00       	push   $0x804803
+  800270:	6a 4c                	push   $0x4c
+  800272:	68 f2 47 80 00       	push   $0x8047f2
+  800277:	e8 fb 01 00 00       	call   800477 <_panic>
+				SHARED->counter++;
+  80027c:	a1 0c 00 00 50       	mov    0x5000000c,%eax
+  800281:	83 c0 01             	add    $0x1,%eax
+  800284:	a3 0c 00 00 50       	mov    %eax,0x5000000c
+	if (usemutex)
+  800289:	e9 36 fe ff ff       	jmp    8000c4 <bench_lock+0x8f>
+
+0080028e <umain>:
+		(uint32_t) ((read_tsc() - t0) / NPING));
+}
+
+void
+umain(int argc, char **argv)
+{
+  80028e:	55                   	push   %ebp
+  80028f:	89 e5                	mov    %esp,%ebp
+  800291:	57                   	push   %edi
+  800292:	56                   	push   %esi
+  800293:	53                   	push   %ebx
+  800294:	83 ec 20             	sub    $0x20,%esp
+	int r, n;
+
+	binaryname = "lockbench";
+  800297:	c7 05 00 50 80 00 19 	movl   $0x804819,0x805000
+  80029e:	48 80 00 
+	if ((r = sys_page_alloc(0, SHARED, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8002a1:	68 07 04 00 00       	push   $0x407
+  8002a6:	68 00 00 00 50       	push   $0x50000000
+  8002ab:	6a 00                	push   $0x0
+  8002ad:	e8 cb 0d 00 00       	call   80107d <sys_page_alloc>
+  8002b2:	83 c4 10             	add    $0x10,%esp
+  8002b5:	85 c0                	test   %eax,%eax
+  8002b7:	78 49                	js     800302 <umain+0x74>
+  8002b9:	be 03 00 00 00       	mov    $0x3,%esi
+		panic("sys_page_alloc: %e", r);
+	for (n = 1; n <= 4; n *= 2) {
+  8002be:	bb 01 00 00 00       	mov    $0x1,%ebx
+		bench_lock(0, n);
+  8002c3:	89 da                	mov    %ebx,%edx
+  8002c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ca:	e8 66 fd ff ff       	call   800035 <bench_lock>
+		bench_lock(1, n);
+  8002cf:	89 da                	mov    %ebx,%edx
+  8002d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002d6:	e8 5a fd ff ff       	call   800035 <bench_lock>
+	for (n = 1; n <= 4; n *= 2) {
+  8002db:	01 db                	add    %ebx,%ebx
+  8002dd:	83 ee 01             	sub    $0x1,%esi
+  8002e0:	75 e1                	jne    8002c3 <umain+0x35>
+  8002e2:	0f 31                	rdtsc
+  8002e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002e7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	if ((kid = fork()) < 0)
+  8002ea:	e8 96 13 00 00       	call   801685 <fork>
+  8002ef:	89 c7                	mov    %eax,%edi
+  8002f1:	85 c0                	test   %eax,%eax
+  8002f3:	78 1f                	js     800314 <umain+0x86>
+	me = kid == 0;
+  8002f5:	0f 94 c3             	sete   %bl
+  8002f8:	0f b6 db             	movzbl %bl,%ebx
+  8002fb:	be 88 13 00 00       	mov    $0x1388,%esi
+  800300:	eb 70                	jmp    800372 <umain+0xe4>
+		panic("sys_page_alloc: %e", r);
+  800302:	50                   	push   %eax
+  800303:	68 23 48 80 00       	push   $0x804823
+  800308:	6a 77                	push   $0x77
+  80030a:	68 f2 47 80 00       	push   $0x8047f2
+  80030f:	e8 63 01 00 00       	call   800477 <_panic>
+		panic("fork: %e", kid);
+  800314:	50                   	push   %eax
+  800315:	68 aa 4c 80 00       	push   $0x804caa
+  80031a:	6a 5f                	push   $0x5f
+  80031c:	68 f2 47 80 00       	push   $0x8047f2
+  800321:	e8 51 01 00 00       	call   800477 <_panic>
+			cond_wait(&s->pcond, &s->plock);
+  800326:	83 ec 08             	sub    $0x8,%esp
+  800329:	68 14 00 00 50       	push   $0x50000014
+  80032e:	68 18 00 00 50       	push   $0x50000018
+  800333:	e8 99 3c 00 00       	call   803fd1 <cond_wait>
+		while (s->turn != me)
+  800338:	a1 20 00 00 50       	mov    0x50000020,%eax
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	39 c3                	cmp    %eax,%ebx
+  800342:	75 e2                	jne    800326 <umain+0x98>
+		s->turn = !me;
+  800344:	85 ff                	test   %edi,%edi
+  800346:	0f 95 c0             	setne  %al
+  800349:	0f b6 c0             	movzbl %al,%eax
+  80034c:	a3 20 00 00 50       	mov    %eax,0x50000020
+		cond_signal(&s->pcond);
+  800351:	83 ec 0c             	sub    $0xc,%esp
+  800354:	68 18 00 00 50       	push   $0x50000018
+  800359:	e8 8b 3c 00 00       	call   803fe9 <cond_signal>
+		mutex_unlock(&s->plock);
+  80035e:	c7 04 24 14 00 00 50 	movl   $0x50000014,(%esp)
+  800365:	e8 d1 3b 00 00       	call   803f3b <mutex_unlock>
+	for (i = 0; i < NPING; i++) {
+  80036a:	83 c4 10             	add    $0x10,%esp
+  80036d:	83 ee 01             	sub    $0x1,%esi
+  800370:	74 1b                	je     80038d <umain+0xff>
+		mutex_lock(&s->plock);
+  800372:	83 ec 0c             	sub    $0xc,%esp
+  800375:	68 14 00 00 50       	push   $0x50000014
+  80037a:	e8 4e 3b 00 00       	call   803ecd <mutex_lock>
+		while (s->turn != me)
+  80037f:	a1 20 00 00 50       	mov    0x50000020,%eax
+  800384:	83 c4 10             	add    $0x10,%esp
+  800387:	39 c3                	cmp    %eax,%ebx
+  800389:	75 9b                	jne    800326 <umain+0x98>
+  80038b:	eb b7                	jmp    800344 <umain+0xb6>
+	if (kid == 0)
+  80038d:	85 ff                	test   %edi,%edi
+  80038f:	74 38                	je     8003c9 <umain+0x13b>
+	wait(kid);
+  800391:	83 ec 0c             	sub    $0xc,%esp
+  800394:	57                   	push   %edi
+  800395:	e8 1d 39 00 00       	call   803cb7 <wait>
+  80039a:	0f 31                	rdtsc
+		(uint32_t) ((read_tsc() - t0) / NPING));
+  80039c:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  80039f:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  8003a2:	6a 00                	push   $0x0
+  8003a4:	68 88 13 00 00       	push   $0x1388
+  8003a9:	52                   	push   %edx
+  8003aa:	50                   	push   %eax
+  8003ab:	e8 43 42 00 00       	call   8045f3 <__udivdi3>
+  8003b0:	83 c4 18             	add    $0x18,%esp
+	cprintf("lockbench: condition variable: %u cycles per round trip\n",
+  8003b3:	50                   	push   %eax
+  8003b4:	68 80 48 80 00       	push   $0x804880
+  8003b9:	e8 94 01 00 00       	call   800552 <cprintf>
+	}
+	bench_pingpong();
+}
+  8003be:	83 c4 10             	add    $0x10,%esp
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+		exit();
+  8003c9:	e8 8f 00 00 00       	call   80045d <exit>
+  8003ce:	eb c1                	jmp    800391 <umain+0x103>
+
+008003d0 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003d0:	55                   	push   %ebp
+  8003d1:	89 e5                	mov    %esp,%ebp
+  8003d3:	56                   	push   %esi
+  8003d4:	53                   	push   %ebx
+  8003d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8003db:	89 e2                	mov    %esp,%edx
+  8003dd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8003e2:	29 d0                	sub    %edx,%eax
+  8003e4:	89 c2                	mov    %eax,%edx
+  8003e6:	c1 ea 0f             	shr    $0xf,%edx
+  8003e9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8003ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f3:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8003f6:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  8003fd:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800401:	e8 39 0c 00 00       	call   80103f <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800406:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80040b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800411:	89 e1                	mov    %esp,%ecx
+  800413:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800418:	29 ca                	sub    %ecx,%edx
+  80041a:	89 d1                	mov    %edx,%ecx
+  80041c:	c1 e9 0f             	shr    $0xf,%ecx
+  80041f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800425:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042a:	0f 42 d1             	cmovb  %ecx,%edx
+  80042d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800432:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800439:	85 db                	test   %ebx,%ebx
+  80043b:	7e 07                	jle    800444 <libmain+0x74>
+		binaryname = argv[0];
+  80043d:	8b 06                	mov    (%esi),%eax
+  80043f:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800444:	83 ec 08             	sub    $0x8,%esp
+  800447:	56                   	push   %esi
+  800448:	53                   	push   %ebx
+  800449:	e8 40 fe ff ff       	call   80028e <umain>
+
+	// exit gracefully
+	exit();
+  80044e:	e8 0a 00 00 00       	call   80045d <exit>
+}
+  800453:	83 c4 10             	add    $0x10,%esp
+  800456:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800459:	5b                   	pop    %ebx
+  80045a:	5e                   	pop    %esi
+  80045b:	5d                   	pop    %ebp
+  80045c:	c3                   	ret
+
+0080045d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80045d:	55                   	push   %ebp
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800463:	e8 dd 19 00 00       	call   801e45 <close_all>
+	sys_env_destroy(0);
+  800468:	83 ec 0c             	sub    $0xc,%esp
+  80046b:	6a 00                	push   $0x0
+  80046d:	e8 8c 0b 00 00       	call   800ffe <sys_env_destroy>
+}
+  800472:	83 c4 10             	add    $0x10,%esp
+  800475:	c9                   	leave
+  800476:	c3                   	ret
+
+00800477 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800477:	55                   	push   %ebp
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	56                   	push   %esi
+  80047b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80047c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80047f:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800485:	e8 b5 0b 00 00       	call   80103f <sys_getenvid>
+  80048a:	83 ec 0c             	sub    $0xc,%esp
+  80048d:	ff 75 0c             	push   0xc(%ebp)
+  800490:	ff 75 08             	push   0x8(%ebp)
+  800493:	56                   	push   %esi
+  800494:	50                   	push   %eax
+  800495:	68 c4 48 80 00       	push   $0x8048c4
+  80049a:	e8 b3 00 00 00       	call   800552 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80049f:	83 c4 18             	add    $0x18,%esp
+  8004a2:	53                   	push   %ebx
+  8004a3:	ff 75 10             	push   0x10(%ebp)
+  8004a6:	e8 56 00 00 00       	call   800501 <vcprintf>
+	cprintf("\n");
+  8004ab:	c7 04 24 34 4e 80 00 	movl   $0x804e34,(%esp)
+  8004b2:	e8 9b 00 00 00       	call   800552 <cprintf>
+  8004b7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004ba:	cc                   	int3
+	while (1)
+  8004bb:	eb fd                	jmp    8004ba <_panic+0x43>
+
+008004bd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8004bd:	55                   	push   %ebp
+  8004be:	89 e5                	mov    %esp,%ebp
+  8004c0:	53                   	push   %ebx
+  8004c1:	83 ec 04             	sub    $0x4,%esp
+  8004c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8004c7:	8b 13                	mov    (%ebx),%edx
+  8004c9:	8d 42 01             	lea    0x1(%edx),%eax
+  8004cc:	89 03                	mov    %eax,(%ebx)
+  8004ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004d1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8004d5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004da:	74 09                	je     8004e5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8004dc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8004e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004e5:	83 ec 08             	sub    $0x8,%esp
+  8004e8:	68 ff 00 00 00       	push   $0xff
+  8004ed:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004f0:	50                   	push   %eax
+  8004f1:	e8 cb 0a 00 00       	call   800fc1 <sys_cputs>
+		b->idx = 0;
+  8004f6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004fc:	83 c4 10             	add    $0x10,%esp
+  8004ff:	eb db                	jmp    8004dc <putch+0x1f>
+
+00800501 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800501:	55                   	push   %ebp
+  800502:	89 e5                	mov    %esp,%ebp
+  800504:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80050a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800511:	00 00 00 
+	b.cnt = 0;
+  800514:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80051b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80051e:	ff 75 0c             	push   0xc(%ebp)
+  800521:	ff 75 08             	push   0x8(%ebp)
+  800524:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80052a:	50                   	push   %eax
+  80052b:	68 bd 04 80 00       	push   $0x8004bd
+  800530:	e8 1c 01 00 00       	call   800651 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800535:	83 c4 08             	add    $0x8,%esp
+  800538:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80053e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800544:	50                   	push   %eax
+  800545:	e8 77 0a 00 00       	call   800fc1 <sys_cputs>
+
+	return b.cnt;
+}
+  80054a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800550:	c9                   	leave
+  800551:	c3                   	ret
+
+00800552 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800558:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80055b:	50                   	push   %eax
+  80055c:	ff 75 08             	push   0x8(%ebp)
+  80055f:	e8 9d ff ff ff       	call   800501 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800564:	c9                   	leave
+  800565:	c3                   	ret
+
+00800566 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800566:	55                   	push   %ebp
+  800567:	89 e5                	mov    %esp,%ebp
+  800569:	57                   	push   %edi
+  80056a:	56                   	push   %esi
+  80056b:	53                   	push   %ebx
+  80056c:	83 ec 1c             	sub    $0x1c,%esp
+  80056f:	89 c3                	mov    %eax,%ebx
+  800571:	89 d6                	mov    %edx,%esi
+  800573:	8b 45 08             	mov    0x8(%ebp),%eax
+  800576:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800579:	89 d1                	mov    %edx,%ecx
+  80057b:	89 c2                	mov    %eax,%edx
+  80057d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800580:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800583:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800586:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800589:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800590:	39 c2                	cmp    %eax,%edx
+  800592:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800595:	73 4b                	jae    8005e2 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80059d:	85 ff                	test   %edi,%edi
+  80059f:	7e 11                	jle    8005b2 <printnum+0x4c>
+			putch(padc, putdat);
+  8005a1:	83 ec 08             	sub    $0x8,%esp
+  8005a4:	56                   	push   %esi
+  8005a5:	ff 75 18             	push   0x18(%ebp)
+  8005a8:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8005aa:	83 c4 10             	add    $0x10,%esp
+  8005ad:	83 ef 01             	sub    $0x1,%edi
+  8005b0:	75 ef                	jne    8005a1 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8005b2:	83 ec 08             	sub    $0x8,%esp
+  8005b5:	56                   	push   %esi
+  8005b6:	83 ec 04             	sub    $0x4,%esp
+  8005b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8005bc:	ff 75 e0             	push   -0x20(%ebp)
+  8005bf:	ff 75 dc             	push   -0x24(%ebp)
+  8005c2:	ff 75 d8             	push   -0x28(%ebp)
+  8005c5:	e8 ef 40 00 00       	call   8046b9 <__umoddi3>
+  8005ca:	83 c4 14             	add    $0x14,%esp
+  8005cd:	0f be 80 e7 48 80 00 	movsbl 0x8048e7(%eax),%eax
+  8005d4:	50                   	push   %eax
+  8005d5:	ff d3                	call   *%ebx
+}
+  8005d7:	83 c4 10             	add    $0x10,%esp
+  8005da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005dd:	5b                   	pop    %ebx
+  8005de:	5e                   	pop    %esi
+  8005df:	5f                   	pop    %edi
+  8005e0:	5d                   	pop    %ebp
+  8005e1:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005e2:	83 ec 0c             	sub    $0xc,%esp
+  8005e5:	ff 75 18             	push   0x18(%ebp)
+  8005e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005eb:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8005ee:	52                   	push   %edx
+  8005ef:	50                   	push   %eax
+  8005f0:	83 ec 08             	sub    $0x8,%esp
+  8005f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8005f6:	ff 75 e0             	push   -0x20(%ebp)
+  8005f9:	ff 75 dc             	push   -0x24(%ebp)
+  8005fc:	ff 75 d8             	push   -0x28(%ebp)
+  8005ff:	e8 ef 3f 00 00       	call   8045f3 <__udivdi3>
+  800604:	83 c4 18             	add    $0x18,%esp
+  800607:	52                   	push   %edx
+  800608:	50                   	push   %eax
+  800609:	89 f2                	mov    %esi,%edx
+  80060b:	89 d8                	mov    %ebx,%eax
+  80060d:	e8 54 ff ff ff       	call   800566 <printnum>
+  800612:	83 c4 20             	add    $0x20,%esp
+  800615:	eb 9b                	jmp    8005b2 <printnum+0x4c>
+
+00800617 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800617:	55                   	push   %ebp
+  800618:	89 e5                	mov    %esp,%ebp
+  80061a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80061d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800621:	8b 10                	mov    (%eax),%edx
+  800623:	3b 50 04             	cmp    0x4(%eax),%edx
+  800626:	73 0a                	jae    800632 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800628:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80062b:	89 08                	mov    %ecx,(%eax)
+  80062d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800630:	88 02                	mov    %al,(%edx)
+}
+  800632:	5d                   	pop    %ebp
+  800633:	c3                   	ret
+
+00800634 <printfmt>:
+{
+  800634:	55                   	push   %ebp
+  800635:	89 e5                	mov    %esp,%ebp
+  800637:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80063a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80063d:	50                   	push   %eax
+  80063e:	ff 75 10             	push   0x10(%ebp)
+  800641:	ff 75 0c             	push   0xc(%ebp)
+  800644:	ff 75 08             	push   0x8(%ebp)
+  800647:	e8 05 00 00 00       	call   800651 <vprintfmt>
+}
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	c9                   	leave
+  800650:	c3                   	ret
+
+00800651 <vprintfmt>:
+{
+  800651:	55                   	push   %ebp
+  800652:	89 e5                	mov    %esp,%ebp
+  800654:	57                   	push   %edi
+  800655:	56                   	push   %esi
+  800656:	53                   	push   %ebx
+  800657:	83 ec 2c             	sub    $0x2c,%esp
+  80065a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80065d:	89 df                	mov    %ebx,%edi
+  80065f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800662:	8b 45 10             	mov    0x10(%ebp),%eax
+  800665:	8d 70 01             	lea    0x1(%eax),%esi
+  800668:	0f b6 00             	movzbl (%eax),%eax
+  80066b:	83 f8 25             	cmp    $0x25,%eax
+  80066e:	74 1e                	je     80068e <vprintfmt+0x3d>
+			if (ch == '\0')
+  800670:	85 c0                	test   %eax,%eax
+  800672:	0f 84 15 05 00 00    	je     800b8d <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800678:	83 ec 08             	sub    $0x8,%esp
+  80067b:	53                   	push   %ebx
+  80067c:	50                   	push   %eax
+  80067d:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80067f:	83 c6 01             	add    $0x1,%esi
+  800682:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800686:	83 c4 10             	add    $0x10,%esp
+  800689:	83 f8 25             	cmp    $0x25,%eax
+  80068c:	75 e2                	jne    800670 <vprintfmt+0x1f>
+		padc = ' ';
+  80068e:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800692:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800699:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8006a0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8006a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ac:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006af:	8d 56 01             	lea    0x1(%esi),%edx
+  8006b2:	0f b6 0e             	movzbl (%esi),%ecx
+  8006b5:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8006b8:	3c 55                	cmp    $0x55,%al
+  8006ba:	0f 87 3b 04 00 00    	ja     800afb <vprintfmt+0x4aa>
+  8006c0:	0f b6 c0             	movzbl %al,%eax
+  8006c3:	ff 24 85 60 4a 80 00 	jmp    *0x804a60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ca:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006cd:	eb 93                	jmp    800662 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006cf:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8006d1:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8006d5:	eb d8                	jmp    8006af <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d7:	89 d6                	mov    %edx,%esi
+  8006d9:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8006dd:	eb d0                	jmp    8006af <vprintfmt+0x5e>
+  8006df:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8006e2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8006e5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8006e8:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8006ec:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006ef:	83 f9 09             	cmp    $0x9,%ecx
+  8006f2:	77 6f                	ja     800763 <vprintfmt+0x112>
+  8006f4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8006f7:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8006fa:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8006fd:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800701:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800704:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800707:	83 fe 09             	cmp    $0x9,%esi
+  80070a:	76 eb                	jbe    8006f7 <vprintfmt+0xa6>
+  80070c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80070f:	89 d6                	mov    %edx,%esi
+  800711:	eb 13                	jmp    800726 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 00                	mov    (%eax),%eax
+  800718:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80071b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071e:	8d 40 04             	lea    0x4(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800724:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800726:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80072a:	79 83                	jns    8006af <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80072c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80072f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800732:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800739:	e9 71 ff ff ff       	jmp    8006af <vprintfmt+0x5e>
+			if (width < 0)
+  80073e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800741:	85 c9                	test   %ecx,%ecx
+  800743:	b8 00 00 00 00       	mov    $0x0,%eax
+  800748:	0f 49 c1             	cmovns %ecx,%eax
+  80074b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80074e:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800750:	e9 5a ff ff ff       	jmp    8006af <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800755:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800757:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80075e:	e9 4c ff ff ff       	jmp    8006af <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800763:	89 d6                	mov    %edx,%esi
+  800765:	eb bf                	jmp    800726 <vprintfmt+0xd5>
+			lflag++;
+  800767:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80076b:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80076d:	e9 3d ff ff ff       	jmp    8006af <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800772:	89 55 10             	mov    %edx,0x10(%ebp)
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8d 70 04             	lea    0x4(%eax),%esi
+  80077b:	83 ec 08             	sub    $0x8,%esp
+  80077e:	53                   	push   %ebx
+  80077f:	ff 30                	push   (%eax)
+  800781:	ff d7                	call   *%edi
+			break;
+  800783:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800786:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800789:	e9 d4 fe ff ff       	jmp    800662 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80078e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800797:	8b 10                	mov    (%eax),%edx
+  800799:	89 d0                	mov    %edx,%eax
+  80079b:	f7 d8                	neg    %eax
+  80079d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007a0:	83 f8 12             	cmp    $0x12,%eax
+  8007a3:	7f 23                	jg     8007c8 <vprintfmt+0x177>
+  8007a5:	8b 14 85 c0 4b 80 00 	mov    0x804bc0(,%eax,4),%edx
+  8007ac:	85 d2                	test   %edx,%edx
+  8007ae:	74 18                	je     8007c8 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8007b0:	52                   	push   %edx
+  8007b1:	68 ff 4d 80 00       	push   $0x804dff
+  8007b6:	53                   	push   %ebx
+  8007b7:	57                   	push   %edi
+  8007b8:	e8 77 fe ff ff       	call   800634 <printfmt>
+  8007bd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007c0:	89 75 14             	mov    %esi,0x14(%ebp)
+  8007c3:	e9 9a fe ff ff       	jmp    800662 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8007c8:	50                   	push   %eax
+  8007c9:	68 ff 48 80 00       	push   $0x8048ff
+  8007ce:	53                   	push   %ebx
+  8007cf:	57                   	push   %edi
+  8007d0:	e8 5f fe ff ff       	call   800634 <printfmt>
+  8007d5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007d8:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007db:	e9 82 fe ff ff       	jmp    800662 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007e0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e6:	83 c0 04             	add    $0x4,%eax
+  8007e9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8b 00                	mov    (%eax),%eax
+  8007f1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007f4:	85 c0                	test   %eax,%eax
+  8007f6:	0f 84 61 03 00 00    	je     800b5d <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8007fc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800800:	7e 06                	jle    800808 <vprintfmt+0x1b7>
+  800802:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800806:	75 29                	jne    800831 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800808:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80080b:	8d 70 01             	lea    0x1(%eax),%esi
+  80080e:	0f b6 00             	movzbl (%eax),%eax
+  800811:	0f be d0             	movsbl %al,%edx
+  800814:	85 d2                	test   %edx,%edx
+  800816:	0f 84 bb 00 00 00    	je     8008d7 <vprintfmt+0x286>
+  80081c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80081f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800822:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800825:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800828:	eb 7a                	jmp    8008a4 <vprintfmt+0x253>
+				p = "(null)";
+  80082a:	c7 45 d0 f8 48 80 00 	movl   $0x8048f8,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800831:	83 ec 08             	sub    $0x8,%esp
+  800834:	ff 75 d4             	push   -0x2c(%ebp)
+  800837:	ff 75 d0             	push   -0x30(%ebp)
+  80083a:	e8 e0 03 00 00       	call   800c1f <strnlen>
+  80083f:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800842:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800845:	83 c4 10             	add    $0x10,%esp
+  800848:	85 d2                	test   %edx,%edx
+  80084a:	0f 8e d6 02 00 00    	jle    800b26 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800850:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800854:	83 ec 08             	sub    $0x8,%esp
+  800857:	53                   	push   %ebx
+  800858:	56                   	push   %esi
+  800859:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800862:	75 f0                	jne    800854 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800864:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800867:	8d 70 01             	lea    0x1(%eax),%esi
+  80086a:	0f b6 00             	movzbl (%eax),%eax
+  80086d:	0f be d0             	movsbl %al,%edx
+  800870:	85 d2                	test   %edx,%edx
+  800872:	0f 84 da 02 00 00    	je     800b52 <vprintfmt+0x501>
+  800878:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80087b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80087e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800881:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800884:	eb 1e                	jmp    8008a4 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800886:	83 ec 08             	sub    $0x8,%esp
+  800889:	ff 75 0c             	push   0xc(%ebp)
+  80088c:	52                   	push   %edx
+  80088d:	ff 55 08             	call   *0x8(%ebp)
+  800890:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800893:	83 eb 01             	sub    $0x1,%ebx
+  800896:	83 c6 01             	add    $0x1,%esi
+  800899:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80089d:	0f be d0             	movsbl %al,%edx
+  8008a0:	85 d2                	test   %edx,%edx
+  8008a2:	74 2a                	je     8008ce <vprintfmt+0x27d>
+  8008a4:	85 ff                	test   %edi,%edi
+  8008a6:	78 05                	js     8008ad <vprintfmt+0x25c>
+  8008a8:	83 ef 01             	sub    $0x1,%edi
+  8008ab:	78 59                	js     800906 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008ad:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008b1:	74 d3                	je     800886 <vprintfmt+0x235>
+  8008b3:	0f be c0             	movsbl %al,%eax
+  8008b6:	83 e8 20             	sub    $0x20,%eax
+  8008b9:	83 f8 5e             	cmp    $0x5e,%eax
+  8008bc:	76 c8                	jbe    800886 <vprintfmt+0x235>
+					putch('?', putdat);
+  8008be:	83 ec 08             	sub    $0x8,%esp
+  8008c1:	ff 75 0c             	push   0xc(%ebp)
+  8008c4:	6a 3f                	push   $0x3f
+  8008c6:	ff 55 08             	call   *0x8(%ebp)
+  8008c9:	83 c4 10             	add    $0x10,%esp
+  8008cc:	eb c5                	jmp    800893 <vprintfmt+0x242>
+  8008ce:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8008d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8008d7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8008da:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008de:	7e 1b                	jle    8008fb <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8008e0:	83 ec 08             	sub    $0x8,%esp
+  8008e3:	53                   	push   %ebx
+  8008e4:	6a 20                	push   $0x20
+  8008e6:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8008e8:	83 c4 10             	add    $0x10,%esp
+  8008eb:	83 ee 01             	sub    $0x1,%esi
+  8008ee:	75 f0                	jne    8008e0 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008f0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f6:	e9 67 fd ff ff       	jmp    800662 <vprintfmt+0x11>
+  8008fb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800901:	e9 5c fd ff ff       	jmp    800662 <vprintfmt+0x11>
+  800906:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800909:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80090c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80090f:	eb c6                	jmp    8008d7 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800911:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800914:	89 55 10             	mov    %edx,0x10(%ebp)
+  800917:	83 f9 01             	cmp    $0x1,%ecx
+  80091a:	7f 1f                	jg     80093b <vprintfmt+0x2ea>
+	else if (lflag)
+  80091c:	85 c9                	test   %ecx,%ecx
+  80091e:	74 67                	je     800987 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800920:	8b 45 14             	mov    0x14(%ebp),%eax
+  800923:	8b 30                	mov    (%eax),%esi
+  800925:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800928:	89 f0                	mov    %esi,%eax
+  80092a:	c1 f8 1f             	sar    $0x1f,%eax
+  80092d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800930:	8b 45 14             	mov    0x14(%ebp),%eax
+  800933:	8d 40 04             	lea    0x4(%eax),%eax
+  800936:	89 45 14             	mov    %eax,0x14(%ebp)
+  800939:	eb 17                	jmp    800952 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80093b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093e:	8b 50 04             	mov    0x4(%eax),%edx
+  800941:	8b 00                	mov    (%eax),%eax
+  800943:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800946:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800949:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094c:	8d 40 08             	lea    0x8(%eax),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800952:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800955:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800958:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80095d:	85 c9                	test   %ecx,%ecx
+  80095f:	0f 89 12 01 00 00    	jns    800a77 <vprintfmt+0x426>
+				putch('-', putdat);
+  800965:	83 ec 08             	sub    $0x8,%esp
+  800968:	53                   	push   %ebx
+  800969:	6a 2d                	push   $0x2d
+  80096b:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80096d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800970:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800973:	f7 da                	neg    %edx
+  800975:	83 d1 00             	adc    $0x0,%ecx
+  800978:	f7 d9                	neg    %ecx
+  80097a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80097d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800982:	e9 f0 00 00 00       	jmp    800a77 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800987:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098a:	8b 30                	mov    (%eax),%esi
+  80098c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80098f:	89 f0                	mov    %esi,%eax
+  800991:	c1 f8 1f             	sar    $0x1f,%eax
+  800994:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800997:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099a:	8d 40 04             	lea    0x4(%eax),%eax
+  80099d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a0:	eb b0                	jmp    800952 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8009a2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009a5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009a8:	83 f9 01             	cmp    $0x1,%ecx
+  8009ab:	7f 1e                	jg     8009cb <vprintfmt+0x37a>
+	else if (lflag)
+  8009ad:	85 c9                	test   %ecx,%ecx
+  8009af:	74 32                	je     8009e3 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8009b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b4:	8b 10                	mov    (%eax),%edx
+  8009b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009c1:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8009c6:	e9 ac 00 00 00       	jmp    800a77 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ce:	8b 10                	mov    (%eax),%edx
+  8009d0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009d3:	8d 40 08             	lea    0x8(%eax),%eax
+  8009d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009d9:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8009de:	e9 94 00 00 00       	jmp    800a77 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e6:	8b 10                	mov    (%eax),%edx
+  8009e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009f3:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8009f8:	eb 7d                	jmp    800a77 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8009fa:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009fd:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a00:	83 f9 01             	cmp    $0x1,%ecx
+  800a03:	7f 1b                	jg     800a20 <vprintfmt+0x3cf>
+	else if (lflag)
+  800a05:	85 c9                	test   %ecx,%ecx
+  800a07:	74 2c                	je     800a35 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800a09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0c:	8b 10                	mov    (%eax),%edx
+  800a0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a13:	8d 40 04             	lea    0x4(%eax),%eax
+  800a16:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a19:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800a1e:	eb 57                	jmp    800a77 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a23:	8b 10                	mov    (%eax),%edx
+  800a25:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a28:	8d 40 08             	lea    0x8(%eax),%eax
+  800a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a2e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800a33:	eb 42                	jmp    800a77 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a35:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a38:	8b 10                	mov    (%eax),%edx
+  800a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a42:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a45:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800a4a:	eb 2b                	jmp    800a77 <vprintfmt+0x426>
+			putch('0', putdat);
+  800a4c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a4f:	83 ec 08             	sub    $0x8,%esp
+  800a52:	53                   	push   %ebx
+  800a53:	6a 30                	push   $0x30
+  800a55:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800a57:	83 c4 08             	add    $0x8,%esp
+  800a5a:	53                   	push   %ebx
+  800a5b:	6a 78                	push   $0x78
+  800a5d:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a62:	8b 10                	mov    (%eax),%edx
+  800a64:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a69:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a6c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a72:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800a77:	83 ec 0c             	sub    $0xc,%esp
+  800a7a:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800a7e:	50                   	push   %eax
+  800a7f:	ff 75 e4             	push   -0x1c(%ebp)
+  800a82:	56                   	push   %esi
+  800a83:	51                   	push   %ecx
+  800a84:	52                   	push   %edx
+  800a85:	89 da                	mov    %ebx,%edx
+  800a87:	89 f8                	mov    %edi,%eax
+  800a89:	e8 d8 fa ff ff       	call   800566 <printnum>
+			break;
+  800a8e:	83 c4 20             	add    $0x20,%esp
+  800a91:	e9 cc fb ff ff       	jmp    800662 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800a96:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a99:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a9c:	83 f9 01             	cmp    $0x1,%ecx
+  800a9f:	7f 1b                	jg     800abc <vprintfmt+0x46b>
+	else if (lflag)
+  800aa1:	85 c9                	test   %ecx,%ecx
+  800aa3:	74 2c                	je     800ad1 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800aa5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa8:	8b 10                	mov    (%eax),%edx
+  800aaa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aaf:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ab5:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800aba:	eb bb                	jmp    800a77 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800abc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abf:	8b 10                	mov    (%eax),%edx
+  800ac1:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ac4:	8d 40 08             	lea    0x8(%eax),%eax
+  800ac7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aca:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800acf:	eb a6                	jmp    800a77 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800ad1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad4:	8b 10                	mov    (%eax),%edx
+  800ad6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800adb:	8d 40 04             	lea    0x4(%eax),%eax
+  800ade:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ae1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800ae6:	eb 8f                	jmp    800a77 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800ae8:	89 55 10             	mov    %edx,0x10(%ebp)
+  800aeb:	83 ec 08             	sub    $0x8,%esp
+  800aee:	53                   	push   %ebx
+  800aef:	6a 25                	push   $0x25
+  800af1:	ff d7                	call   *%edi
+			break;
+  800af3:	83 c4 10             	add    $0x10,%esp
+  800af6:	e9 67 fb ff ff       	jmp    800662 <vprintfmt+0x11>
+			putch('%', putdat);
+  800afb:	83 ec 08             	sub    $0x8,%esp
+  800afe:	53                   	push   %ebx
+  800aff:	6a 25                	push   $0x25
+  800b01:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b03:	83 c4 10             	add    $0x10,%esp
+  800b06:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800b0a:	0f 84 ba fb ff ff    	je     8006ca <vprintfmt+0x79>
+  800b10:	89 75 10             	mov    %esi,0x10(%ebp)
+  800b13:	89 f0                	mov    %esi,%eax
+  800b15:	83 e8 01             	sub    $0x1,%eax
+  800b18:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b1c:	75 f7                	jne    800b15 <vprintfmt+0x4c4>
+  800b1e:	89 45 10             	mov    %eax,0x10(%ebp)
+  800b21:	e9 3c fb ff ff       	jmp    800662 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b26:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b29:	8d 70 01             	lea    0x1(%eax),%esi
+  800b2c:	0f b6 00             	movzbl (%eax),%eax
+  800b2f:	0f be d0             	movsbl %al,%edx
+  800b32:	85 d2                	test   %edx,%edx
+  800b34:	74 11                	je     800b47 <vprintfmt+0x4f6>
+  800b36:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b39:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b3c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b3f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b42:	e9 5d fd ff ff       	jmp    8008a4 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b47:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b4a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b4d:	e9 10 fb ff ff       	jmp    800662 <vprintfmt+0x11>
+  800b52:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b55:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b58:	e9 05 fb ff ff       	jmp    800662 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800b5d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b61:	7e 0a                	jle    800b6d <vprintfmt+0x51c>
+  800b63:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800b67:	0f 85 bd fc ff ff    	jne    80082a <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b6d:	ba 28 00 00 00       	mov    $0x28,%edx
+  800b72:	b8 28 00 00 00       	mov    $0x28,%eax
+  800b77:	be f9 48 80 00       	mov    $0x8048f9,%esi
+  800b7c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b7f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b82:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b85:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b88:	e9 17 fd ff ff       	jmp    8008a4 <vprintfmt+0x253>
+}
+  800b8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b90:	5b                   	pop    %ebx
+  800b91:	5e                   	pop    %esi
+  800b92:	5f                   	pop    %edi
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+
+00800b95 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	83 ec 18             	sub    $0x18,%esp
+  800b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ba1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ba4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ba8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800bab:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800bb2:	85 c0                	test   %eax,%eax
+  800bb4:	74 26                	je     800bdc <vsnprintf+0x47>
+  800bb6:	85 d2                	test   %edx,%edx
+  800bb8:	7e 22                	jle    800bdc <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800bba:	ff 75 14             	push   0x14(%ebp)
+  800bbd:	ff 75 10             	push   0x10(%ebp)
+  800bc0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800bc3:	50                   	push   %eax
+  800bc4:	68 17 06 80 00       	push   $0x800617
+  800bc9:	e8 83 fa ff ff       	call   800651 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800bce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800bd1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800bd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bd7:	83 c4 10             	add    $0x10,%esp
+}
+  800bda:	c9                   	leave
+  800bdb:	c3                   	ret
+		return -E_INVAL;
+  800bdc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800be1:	eb f7                	jmp    800bda <vsnprintf+0x45>
+
+00800be3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800be9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800bec:	50                   	push   %eax
+  800bed:	ff 75 10             	push   0x10(%ebp)
+  800bf0:	ff 75 0c             	push   0xc(%ebp)
+  800bf3:	ff 75 08             	push   0x8(%ebp)
+  800bf6:	e8 9a ff ff ff       	call   800b95 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800bfb:	c9                   	leave
+  800bfc:	c3                   	ret
+
+00800bfd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c03:	80 3a 00             	cmpb   $0x0,(%edx)
+  800c06:	74 10                	je     800c18 <strlen+0x1b>
+  800c08:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800c0d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800c10:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c14:	75 f7                	jne    800c0d <strlen+0x10>
+	return n;
+}
+  800c16:	5d                   	pop    %ebp
+  800c17:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800c18:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800c1d:	eb f7                	jmp    800c16 <strlen+0x19>
+
+00800c1f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c25:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c28:	85 d2                	test   %edx,%edx
+  800c2a:	74 16                	je     800c42 <strnlen+0x23>
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c31:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c35:	74 09                	je     800c40 <strnlen+0x21>
+		n++;
+  800c37:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c3a:	39 d0                	cmp    %edx,%eax
+  800c3c:	75 f3                	jne    800c31 <strnlen+0x12>
+		n++;
+  800c3e:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800c40:	5d                   	pop    %ebp
+  800c41:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c47:	eb f7                	jmp    800c40 <strnlen+0x21>
+
+00800c49 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	53                   	push   %ebx
+  800c4d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c58:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c5c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c5f:	83 c0 01             	add    $0x1,%eax
+  800c62:	84 d2                	test   %dl,%dl
+  800c64:	75 f2                	jne    800c58 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c66:	89 c8                	mov    %ecx,%eax
+  800c68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c6b:	c9                   	leave
+  800c6c:	c3                   	ret
+
+00800c6d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	53                   	push   %ebx
+  800c71:	83 ec 10             	sub    $0x10,%esp
+  800c74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c77:	53                   	push   %ebx
+  800c78:	e8 80 ff ff ff       	call   800bfd <strlen>
+  800c7d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c80:	ff 75 0c             	push   0xc(%ebp)
+  800c83:	01 d8                	add    %ebx,%eax
+  800c85:	50                   	push   %eax
+  800c86:	e8 be ff ff ff       	call   800c49 <strcpy>
+	return dst;
+}
+  800c8b:	89 d8                	mov    %ebx,%eax
+  800c8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c90:	c9                   	leave
+  800c91:	c3                   	ret
+
+00800c92 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	56                   	push   %esi
+  800c96:	53                   	push   %ebx
+  800c97:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ca0:	85 db                	test   %ebx,%ebx
+  800ca2:	74 17                	je     800cbb <strncpy+0x29>
+  800ca4:	01 f3                	add    %esi,%ebx
+  800ca6:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800ca8:	83 c0 01             	add    $0x1,%eax
+  800cab:	0f b6 0a             	movzbl (%edx),%ecx
+  800cae:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800cb1:	80 f9 01             	cmp    $0x1,%cl
+  800cb4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800cb7:	39 c3                	cmp    %eax,%ebx
+  800cb9:	75 ed                	jne    800ca8 <strncpy+0x16>
+	}
+	return ret;
+}
+  800cbb:	89 f0                	mov    %esi,%eax
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	c3                   	ret
+
+00800cc1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800cc1:	55                   	push   %ebp
+  800cc2:	89 e5                	mov    %esp,%ebp
+  800cc4:	56                   	push   %esi
+  800cc5:	53                   	push   %ebx
+  800cc6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ccc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ccf:	89 f0                	mov    %esi,%eax
+  800cd1:	85 db                	test   %ebx,%ebx
+  800cd3:	74 1e                	je     800cf3 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800cd5:	83 eb 01             	sub    $0x1,%ebx
+  800cd8:	74 16                	je     800cf0 <strlcpy+0x2f>
+  800cda:	01 f3                	add    %esi,%ebx
+  800cdc:	0f b6 0a             	movzbl (%edx),%ecx
+  800cdf:	84 c9                	test   %cl,%cl
+  800ce1:	74 0d                	je     800cf0 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800ce3:	83 c2 01             	add    $0x1,%edx
+  800ce6:	83 c0 01             	add    $0x1,%eax
+  800ce9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800cec:	39 d8                	cmp    %ebx,%eax
+  800cee:	75 ec                	jne    800cdc <strlcpy+0x1b>
+		*dst = '\0';
+  800cf0:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800cf3:	29 f0                	sub    %esi,%eax
+}
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5e                   	pop    %esi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+
+00800cf9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d02:	0f b6 01             	movzbl (%ecx),%eax
+  800d05:	84 c0                	test   %al,%al
+  800d07:	74 11                	je     800d1a <strcmp+0x21>
+  800d09:	38 02                	cmp    %al,(%edx)
+  800d0b:	75 0d                	jne    800d1a <strcmp+0x21>
+		p++, q++;
+  800d0d:	83 c1 01             	add    $0x1,%ecx
+  800d10:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d13:	0f b6 01             	movzbl (%ecx),%eax
+  800d16:	84 c0                	test   %al,%al
+  800d18:	75 ef                	jne    800d09 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d1a:	0f b6 c0             	movzbl %al,%eax
+  800d1d:	0f b6 12             	movzbl (%edx),%edx
+  800d20:	29 d0                	sub    %edx,%eax
+}
+  800d22:	5d                   	pop    %ebp
+  800d23:	c3                   	ret
+
+00800d24 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	53                   	push   %ebx
+  800d28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d2e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800d31:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800d36:	85 d2                	test   %edx,%edx
+  800d38:	74 2e                	je     800d68 <strncmp+0x44>
+  800d3a:	0f b6 01             	movzbl (%ecx),%eax
+  800d3d:	84 c0                	test   %al,%al
+  800d3f:	74 16                	je     800d57 <strncmp+0x33>
+  800d41:	3a 03                	cmp    (%ebx),%al
+  800d43:	75 12                	jne    800d57 <strncmp+0x33>
+		n--, p++, q++;
+  800d45:	83 c1 01             	add    $0x1,%ecx
+  800d48:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800d4b:	83 ea 01             	sub    $0x1,%edx
+  800d4e:	75 ea                	jne    800d3a <strncmp+0x16>
+		return 0;
+  800d50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d55:	eb 11                	jmp    800d68 <strncmp+0x44>
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800d5c:	85 d2                	test   %edx,%edx
+  800d5e:	74 08                	je     800d68 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d60:	0f b6 01             	movzbl (%ecx),%eax
+  800d63:	0f b6 13             	movzbl (%ebx),%edx
+  800d66:	29 d0                	sub    %edx,%eax
+}
+  800d68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d6b:	c9                   	leave
+  800d6c:	c3                   	ret
+
+00800d6d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d73:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d77:	0f b6 10             	movzbl (%eax),%edx
+  800d7a:	84 d2                	test   %dl,%dl
+  800d7c:	74 15                	je     800d93 <strchr+0x26>
+		if (*s == c)
+  800d7e:	38 d1                	cmp    %dl,%cl
+  800d80:	74 0f                	je     800d91 <strchr+0x24>
+	for (; *s; s++)
+  800d82:	83 c0 01             	add    $0x1,%eax
+  800d85:	0f b6 10             	movzbl (%eax),%edx
+  800d88:	84 d2                	test   %dl,%dl
+  800d8a:	75 f2                	jne    800d7e <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+	return 0;
+  800d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d98:	eb f7                	jmp    800d91 <strchr+0x24>
+
+00800d9a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d9a:	55                   	push   %ebp
+  800d9b:	89 e5                	mov    %esp,%ebp
+  800d9d:	53                   	push   %ebx
+  800d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800da4:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800da7:	38 d3                	cmp    %dl,%bl
+  800da9:	74 14                	je     800dbf <strfind+0x25>
+  800dab:	89 d1                	mov    %edx,%ecx
+  800dad:	84 db                	test   %bl,%bl
+  800daf:	74 0e                	je     800dbf <strfind+0x25>
+	for (; *s; s++)
+  800db1:	83 c0 01             	add    $0x1,%eax
+  800db4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800db7:	38 ca                	cmp    %cl,%dl
+  800db9:	74 04                	je     800dbf <strfind+0x25>
+  800dbb:	84 d2                	test   %dl,%dl
+  800dbd:	75 f2                	jne    800db1 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800dbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dc2:	c9                   	leave
+  800dc3:	c3                   	ret
+
+00800dc4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800dcb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800dce:	85 c9                	test   %ecx,%ecx
+  800dd0:	74 20                	je     800df2 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800dd2:	89 f8                	mov    %edi,%eax
+  800dd4:	09 c8                	or     %ecx,%eax
+  800dd6:	a8 03                	test   $0x3,%al
+  800dd8:	75 12                	jne    800dec <memset+0x28>
+		c &= 0xFF;
+  800dda:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800dde:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800de4:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800de7:	fc                   	cld
+  800de8:	f3 ab                	rep stos %eax,%es:(%edi)
+  800dea:	eb 06                	jmp    800df2 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800dec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800def:	fc                   	cld
+  800df0:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800df2:	89 f8                	mov    %edi,%eax
+  800df4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800df7:	c9                   	leave
+  800df8:	c3                   	ret
+
+00800df9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	57                   	push   %edi
+  800dfd:	56                   	push   %esi
+  800dfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e01:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e04:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e07:	39 c6                	cmp    %eax,%esi
+  800e09:	73 32                	jae    800e3d <memmove+0x44>
+  800e0b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e0e:	39 d0                	cmp    %edx,%eax
+  800e10:	73 2b                	jae    800e3d <memmove+0x44>
+		s += n;
+		d += n;
+  800e12:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e15:	89 d6                	mov    %edx,%esi
+  800e17:	09 fe                	or     %edi,%esi
+  800e19:	09 ce                	or     %ecx,%esi
+  800e1b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e21:	75 0e                	jne    800e31 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e23:	83 ef 04             	sub    $0x4,%edi
+  800e26:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e29:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e2c:	fd                   	std
+  800e2d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e2f:	eb 09                	jmp    800e3a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e31:	83 ef 01             	sub    $0x1,%edi
+  800e34:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e37:	fd                   	std
+  800e38:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e3a:	fc                   	cld
+  800e3b:	eb 1a                	jmp    800e57 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e3d:	89 f2                	mov    %esi,%edx
+  800e3f:	09 c2                	or     %eax,%edx
+  800e41:	09 ca                	or     %ecx,%edx
+  800e43:	f6 c2 03             	test   $0x3,%dl
+  800e46:	75 0a                	jne    800e52 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e48:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e4b:	89 c7                	mov    %eax,%edi
+  800e4d:	fc                   	cld
+  800e4e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e50:	eb 05                	jmp    800e57 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e52:	89 c7                	mov    %eax,%edi
+  800e54:	fc                   	cld
+  800e55:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e57:	5e                   	pop    %esi
+  800e58:	5f                   	pop    %edi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+
+00800e5b <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800e5b:	55                   	push   %ebp
+  800e5c:	89 e5                	mov    %esp,%ebp
+  800e5e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e61:	ff 75 10             	push   0x10(%ebp)
+  800e64:	ff 75 0c             	push   0xc(%ebp)
+  800e67:	ff 75 08             	push   0x8(%ebp)
+  800e6a:	e8 8a ff ff ff       	call   800df9 <memmove>
+}
+  800e6f:	c9                   	leave
+  800e70:	c3                   	ret
+
+00800e71 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+  800e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e7c:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e7f:	85 f6                	test   %esi,%esi
+  800e81:	74 29                	je     800eac <memcmp+0x3b>
+  800e83:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800e85:	0f b6 08             	movzbl (%eax),%ecx
+  800e88:	0f b6 1a             	movzbl (%edx),%ebx
+  800e8b:	38 d9                	cmp    %bl,%cl
+  800e8d:	75 11                	jne    800ea0 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e8f:	83 c0 01             	add    $0x1,%eax
+  800e92:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e95:	39 c6                	cmp    %eax,%esi
+  800e97:	75 ec                	jne    800e85 <memcmp+0x14>
+	}
+
+	return 0;
+  800e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9e:	eb 08                	jmp    800ea8 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ea0:	0f b6 c1             	movzbl %cl,%eax
+  800ea3:	0f b6 db             	movzbl %bl,%ebx
+  800ea6:	29 d8                	sub    %ebx,%eax
+}
+  800ea8:	5b                   	pop    %ebx
+  800ea9:	5e                   	pop    %esi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+	return 0;
+  800eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb1:	eb f5                	jmp    800ea8 <memcmp+0x37>
+
+00800eb3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ebc:	89 c2                	mov    %eax,%edx
+  800ebe:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ec1:	39 d0                	cmp    %edx,%eax
+  800ec3:	73 0d                	jae    800ed2 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ec5:	38 08                	cmp    %cl,(%eax)
+  800ec7:	74 0d                	je     800ed6 <memfind+0x23>
+	for (; s < ends; s++)
+  800ec9:	83 c0 01             	add    $0x1,%eax
+  800ecc:	39 c2                	cmp    %eax,%edx
+  800ece:	75 f5                	jne    800ec5 <memfind+0x12>
+  800ed0:	eb 06                	jmp    800ed8 <memfind+0x25>
+  800ed2:	89 c2                	mov    %eax,%edx
+  800ed4:	eb 02                	jmp    800ed8 <memfind+0x25>
+  800ed6:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800ed8:	89 d0                	mov    %edx,%eax
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+
+00800edc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	57                   	push   %edi
+  800ee0:	56                   	push   %esi
+  800ee1:	53                   	push   %ebx
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ee8:	0f b6 02             	movzbl (%edx),%eax
+  800eeb:	3c 20                	cmp    $0x20,%al
+  800eed:	74 04                	je     800ef3 <strtol+0x17>
+  800eef:	3c 09                	cmp    $0x9,%al
+  800ef1:	75 0e                	jne    800f01 <strtol+0x25>
+		s++;
+  800ef3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ef6:	0f b6 02             	movzbl (%edx),%eax
+  800ef9:	3c 20                	cmp    $0x20,%al
+  800efb:	74 f6                	je     800ef3 <strtol+0x17>
+  800efd:	3c 09                	cmp    $0x9,%al
+  800eff:	74 f2                	je     800ef3 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f01:	3c 2b                	cmp    $0x2b,%al
+  800f03:	74 2a                	je     800f2f <strtol+0x53>
+	int neg = 0;
+  800f05:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f0a:	3c 2d                	cmp    $0x2d,%al
+  800f0c:	74 2b                	je     800f39 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f0e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f14:	75 0f                	jne    800f25 <strtol+0x49>
+  800f16:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f19:	74 28                	je     800f43 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f1b:	85 db                	test   %ebx,%ebx
+  800f1d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f22:	0f 44 d8             	cmove  %eax,%ebx
+  800f25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f2d:	eb 46                	jmp    800f75 <strtol+0x99>
+		s++;
+  800f2f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f37:	eb d5                	jmp    800f0e <strtol+0x32>
+		s++, neg = 1;
+  800f39:	83 c2 01             	add    $0x1,%edx
+  800f3c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f41:	eb cb                	jmp    800f0e <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f43:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f47:	74 0e                	je     800f57 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800f49:	85 db                	test   %ebx,%ebx
+  800f4b:	75 d8                	jne    800f25 <strtol+0x49>
+		s++, base = 8;
+  800f4d:	83 c2 01             	add    $0x1,%edx
+  800f50:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f55:	eb ce                	jmp    800f25 <strtol+0x49>
+		s += 2, base = 16;
+  800f57:	83 c2 02             	add    $0x2,%edx
+  800f5a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f5f:	eb c4                	jmp    800f25 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f61:	0f be c0             	movsbl %al,%eax
+  800f64:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800f67:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f6a:	7d 3a                	jge    800fa6 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800f6c:	83 c2 01             	add    $0x1,%edx
+  800f6f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f73:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800f75:	0f b6 02             	movzbl (%edx),%eax
+  800f78:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f7b:	89 f3                	mov    %esi,%ebx
+  800f7d:	80 fb 09             	cmp    $0x9,%bl
+  800f80:	76 df                	jbe    800f61 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800f82:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f85:	89 f3                	mov    %esi,%ebx
+  800f87:	80 fb 19             	cmp    $0x19,%bl
+  800f8a:	77 08                	ja     800f94 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800f8c:	0f be c0             	movsbl %al,%eax
+  800f8f:	83 e8 57             	sub    $0x57,%eax
+  800f92:	eb d3                	jmp    800f67 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f94:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f97:	89 f3                	mov    %esi,%ebx
+  800f99:	80 fb 19             	cmp    $0x19,%bl
+  800f9c:	77 08                	ja     800fa6 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800f9e:	0f be c0             	movsbl %al,%eax
+  800fa1:	83 e8 37             	sub    $0x37,%eax
+  800fa4:	eb c1                	jmp    800f67 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800fa6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800faa:	74 05                	je     800fb1 <strtol+0xd5>
+		*endptr = (char *) s;
+  800fac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800faf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800fb1:	89 c8                	mov    %ecx,%eax
+  800fb3:	f7 d8                	neg    %eax
+  800fb5:	85 ff                	test   %edi,%edi
+  800fb7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800fba:	89 c8                	mov    %ecx,%eax
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+
+00800fc1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	57                   	push   %edi
+  800fc5:	56                   	push   %esi
+  800fc6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	89 c3                	mov    %eax,%ebx
+  800fd4:	89 c7                	mov    %eax,%edi
+  800fd6:	89 c6                	mov    %eax,%esi
+  800fd8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5e                   	pop    %esi
+  800fdc:	5f                   	pop    %edi
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+
+00800fdf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fea:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fef:	89 d1                	mov    %edx,%ecx
+  800ff1:	89 d3                	mov    %edx,%ebx
+  800ff3:	89 d7                	mov    %edx,%edi
+  800ff5:	89 d6                	mov    %edx,%esi
+  800ff7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+
+00800ffe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ffe:	55                   	push   %ebp
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	57                   	push   %edi
+  801002:	56                   	push   %esi
+  801003:	53                   	push   %ebx
+  801004:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801007:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80100c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801014:	89 cb                	mov    %ecx,%ebx
+  801016:	89 cf                	mov    %ecx,%edi
+  801018:	89 ce                	mov    %ecx,%esi
+  80101a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80101c:	85 c0                	test   %eax,%eax
+  80101e:	7f 08                	jg     801028 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801023:	5b                   	pop    %ebx
+  801024:	5e                   	pop    %esi
+  801025:	5f                   	pop    %edi
+  801026:	5d                   	pop    %ebp
+  801027:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801028:	83 ec 0c             	sub    $0xc,%esp
+  80102b:	50                   	push   %eax
+  80102c:	6a 03                	push   $0x3
+  80102e:	68 2b 4c 80 00       	push   $0x804c2b
+  801033:	6a 23                	push   $0x23
+  801035:	68 48 4c 80 00       	push   $0x804c48
+  80103a:	e8 38 f4 ff ff       	call   800477 <_panic>
+
+0080103f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	57                   	push   %edi
+  801043:	56                   	push   %esi
+  801044:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801045:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80104f:	89 d1                	mov    %edx,%ecx
+  801051:	89 d3                	mov    %edx,%ebx
+  801053:	89 d7                	mov    %edx,%edi
+  801055:	89 d6                	mov    %edx,%esi
+  801057:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801059:	5b                   	pop    %ebx
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+
+0080105e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801064:	ba 00 00 00 00       	mov    $0x0,%edx
+  801069:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80106e:	89 d1                	mov    %edx,%ecx
+  801070:	89 d3                	mov    %edx,%ebx
+  801072:	89 d7                	mov    %edx,%edi
+  801074:	89 d6                	mov    %edx,%esi
+  801076:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+
+0080107d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801086:	be 00 00 00 00       	mov    $0x0,%esi
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 04 00 00 00       	mov    $0x4,%eax
+  801096:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801099:	89 f7                	mov    %esi,%edi
+  80109b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	7f 08                	jg     8010a9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8010a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a4:	5b                   	pop    %ebx
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5f                   	pop    %edi
+  8010a7:	5d                   	pop    %ebp
+  8010a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 04                	push   $0x4
+  8010af:	68 2b 4c 80 00       	push   $0x804c2b
+  8010b4:	6a 23                	push   $0x23
+  8010b6:	68 48 4c 80 00       	push   $0x804c48
+  8010bb:	e8 b7 f3 ff ff       	call   800477 <_panic>
+
+008010c0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010da:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010df:	85 c0                	test   %eax,%eax
+  8010e1:	7f 08                	jg     8010eb <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5f                   	pop    %edi
+  8010e9:	5d                   	pop    %ebp
+  8010ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010eb:	83 ec 0c             	sub    $0xc,%esp
+  8010ee:	50                   	push   %eax
+  8010ef:	6a 05                	push   $0x5
+  8010f1:	68 2b 4c 80 00       	push   $0x804c2b
+  8010f6:	6a 23                	push   $0x23
+  8010f8:	68 48 4c 80 00       	push   $0x804c48
+  8010fd:	e8 75 f3 ff ff       	call   800477 <_panic>
+
+00801102 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+  801108:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80110b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 06 00 00 00       	mov    $0x6,%eax
+  80111b:	89 df                	mov    %ebx,%edi
+  80111d:	89 de                	mov    %ebx,%esi
+  80111f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801121:	85 c0                	test   %eax,%eax
+  801123:	7f 08                	jg     80112d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112d:	83 ec 0c             	sub    $0xc,%esp
+  801130:	50                   	push   %eax
+  801131:	6a 06                	push   $0x6
+  801133:	68 2b 4c 80 00       	push   $0x804c2b
+  801138:	6a 23                	push   $0x23
+  80113a:	68 48 4c 80 00       	push   $0x804c48
+  80113f:	e8 33 f3 ff ff       	call   800477 <_panic>
+
+00801144 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	57                   	push   %edi
+  801148:	56                   	push   %esi
+  801149:	53                   	push   %ebx
+  80114a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80114d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801152:	8b 55 08             	mov    0x8(%ebp),%edx
+  801155:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801158:	b8 08 00 00 00       	mov    $0x8,%eax
+  80115d:	89 df                	mov    %ebx,%edi
+  80115f:	89 de                	mov    %ebx,%esi
+  801161:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801163:	85 c0                	test   %eax,%eax
+  801165:	7f 08                	jg     80116f <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116a:	5b                   	pop    %ebx
+  80116b:	5e                   	pop    %esi
+  80116c:	5f                   	pop    %edi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80116f:	83 ec 0c             	sub    $0xc,%esp
+  801172:	50                   	push   %eax
+  801173:	6a 08                	push   $0x8
+  801175:	68 2b 4c 80 00       	push   $0x804c2b
+  80117a:	6a 23                	push   $0x23
+  80117c:	68 48 4c 80 00       	push   $0x804c48
+  801181:	e8 f1 f2 ff ff       	call   800477 <_panic>
+
+00801186 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+  80118c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80119f:	89 df                	mov    %ebx,%edi
+  8011a1:	89 de                	mov    %ebx,%esi
+  8011a3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	7f 08                	jg     8011b1 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8011a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5e                   	pop    %esi
+  8011ae:	5f                   	pop    %edi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b1:	83 ec 0c             	sub    $0xc,%esp
+  8011b4:	50                   	push   %eax
+  8011b5:	6a 09                	push   $0x9
+  8011b7:	68 2b 4c 80 00       	push   $0x804c2b
+  8011bc:	6a 23                	push   $0x23
+  8011be:	68 48 4c 80 00       	push   $0x804c48
+  8011c3:	e8 af f2 ff ff       	call   800477 <_panic>
+
+008011c8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+  8011ce:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e1:	89 df                	mov    %ebx,%edi
+  8011e3:	89 de                	mov    %ebx,%esi
+  8011e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e7:	85 c0                	test   %eax,%eax
+  8011e9:	7f 08                	jg     8011f3 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ee:	5b                   	pop    %ebx
+  8011ef:	5e                   	pop    %esi
+  8011f0:	5f                   	pop    %edi
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f3:	83 ec 0c             	sub    $0xc,%esp
+  8011f6:	50                   	push   %eax
+  8011f7:	6a 0a                	push   $0xa
+  8011f9:	68 2b 4c 80 00       	push   $0x804c2b
+  8011fe:	6a 23                	push   $0x23
+  801200:	68 48 4c 80 00       	push   $0x804c48
+  801205:	e8 6d f2 ff ff       	call   800477 <_panic>
+
+0080120a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80120a:	55                   	push   %ebp
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	57                   	push   %edi
+  80120e:	56                   	push   %esi
+  80120f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801210:	8b 55 08             	mov    0x8(%ebp),%edx
+  801213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801216:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80121b:	be 00 00 00 00       	mov    $0x0,%esi
+  801220:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801223:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801226:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801228:	5b                   	pop    %ebx
+  801229:	5e                   	pop    %esi
+  80122a:	5f                   	pop    %edi
+  80122b:	5d                   	pop    %ebp
+  80122c:	c3                   	ret
+
+0080122d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80122d:	55                   	push   %ebp
+  80122e:	89 e5                	mov    %esp,%ebp
+  801230:	57                   	push   %edi
+  801231:	56                   	push   %esi
+  801232:	53                   	push   %ebx
+  801233:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801236:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80123b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801243:	89 cb                	mov    %ecx,%ebx
+  801245:	89 cf                	mov    %ecx,%edi
+  801247:	89 ce                	mov    %ecx,%esi
+  801249:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80124b:	85 c0                	test   %eax,%eax
+  80124d:	7f 08                	jg     801257 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80124f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801252:	5b                   	pop    %ebx
+  801253:	5e                   	pop    %esi
+  801254:	5f                   	pop    %edi
+  801255:	5d                   	pop    %ebp
+  801256:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801257:	83 ec 0c             	sub    $0xc,%esp
+  80125a:	50                   	push   %eax
+  80125b:	6a 0d                	push   $0xd
+  80125d:	68 2b 4c 80 00       	push   $0x804c2b
+  801262:	6a 23                	push   $0x23
+  801264:	68 48 4c 80 00       	push   $0x804c48
+  801269:	e8 09 f2 ff ff       	call   800477 <_panic>
+
+0080126e <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801274:	8b 55 08             	mov    0x8(%ebp),%edx
+  801277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80127f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801282:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801285:	8b 75 18             	mov    0x18(%ebp),%esi
+  801288:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80128a:	5b                   	pop    %ebx
+  80128b:	5e                   	pop    %esi
+  80128c:	5f                   	pop    %edi
+  80128d:	5d                   	pop    %ebp
+  80128e:	c3                   	ret
+
+0080128f <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	57                   	push   %edi
+  801293:	56                   	push   %esi
+  801294:	53                   	push   %ebx
+  801295:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801298:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012a8:	89 df                	mov    %ebx,%edi
+  8012aa:	89 de                	mov    %ebx,%esi
+  8012ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	7f 08                	jg     8012ba <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8012b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b5:	5b                   	pop    %ebx
+  8012b6:	5e                   	pop    %esi
+  8012b7:	5f                   	pop    %edi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ba:	83 ec 0c             	sub    $0xc,%esp
+  8012bd:	50                   	push   %eax
+  8012be:	6a 0d                	push   $0xd
+  8012c0:	68 2b 4c 80 00       	push   $0x804c2b
+  8012c5:	6a 23                	push   $0x23
+  8012c7:	68 48 4c 80 00       	push   $0x804c48
+  8012cc:	e8 a6 f1 ff ff       	call   800477 <_panic>
+
+008012d1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	57                   	push   %edi
+  8012d5:	56                   	push   %esi
+  8012d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012dc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e1:	89 d1                	mov    %edx,%ecx
+  8012e3:	89 d3                	mov    %edx,%ebx
+  8012e5:	89 d7                	mov    %edx,%edi
+  8012e7:	89 d6                	mov    %edx,%esi
+  8012e9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012eb:	5b                   	pop    %ebx
+  8012ec:	5e                   	pop    %esi
+  8012ed:	5f                   	pop    %edi
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+
+008012f0 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+  8012f3:	57                   	push   %edi
+  8012f4:	56                   	push   %esi
+  8012f5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801301:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801306:	89 df                	mov    %ebx,%edi
+  801308:	89 de                	mov    %ebx,%esi
+  80130a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80130c:	5b                   	pop    %ebx
+  80130d:	5e                   	pop    %esi
+  80130e:	5f                   	pop    %edi
+  80130f:	5d                   	pop    %ebp
+  801310:	c3                   	ret
+
+00801311 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	57                   	push   %edi
+  801315:	56                   	push   %esi
+  801316:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801317:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80131c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801324:	89 cb                	mov    %ecx,%ebx
+  801326:	89 cf                	mov    %ecx,%edi
+  801328:	89 ce                	mov    %ecx,%esi
+  80132a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+
+00801331 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801342:	b8 11 00 00 00       	mov    $0x11,%eax
+  801347:	89 df                	mov    %ebx,%edi
+  801349:	89 de                	mov    %ebx,%esi
+  80134b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5f                   	pop    %edi
+  801350:	5d                   	pop    %ebp
+  801351:	c3                   	ret
+
+00801352 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	57                   	push   %edi
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801358:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801363:	b8 12 00 00 00       	mov    $0x12,%eax
+  801368:	89 df                	mov    %ebx,%edi
+  80136a:	89 de                	mov    %ebx,%esi
+  80136c:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5f                   	pop    %edi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+
+00801373 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	57                   	push   %edi
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801379:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801381:	b8 13 00 00 00       	mov    $0x13,%eax
+  801386:	89 cb                	mov    %ecx,%ebx
+  801388:	89 cf                	mov    %ecx,%edi
+  80138a:	89 ce                	mov    %ecx,%esi
+  80138c:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80138e:	5b                   	pop    %ebx
+  80138f:	5e                   	pop    %esi
+  801390:	5f                   	pop    %edi
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+
+00801393 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	57                   	push   %edi
+  801397:	56                   	push   %esi
+  801398:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801399:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013a9:	89 df                	mov    %ebx,%edi
+  8013ab:	89 de                	mov    %ebx,%esi
+  8013ad:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+
+008013b4 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8013b4:	55                   	push   %ebp
+  8013b5:	89 e5                	mov    %esp,%ebp
+  8013b7:	57                   	push   %edi
+  8013b8:	56                   	push   %esi
+  8013b9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013c7:	89 cb                	mov    %ecx,%ebx
+  8013c9:	89 cf                	mov    %ecx,%edi
+  8013cb:	89 ce                	mov    %ecx,%esi
+  8013cd:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8013cf:	5b                   	pop    %ebx
+  8013d0:	5e                   	pop    %esi
+  8013d1:	5f                   	pop    %edi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+
+008013d4 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	57                   	push   %edi
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013da:	be 00 00 00 00       	mov    $0x0,%esi
+  8013df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ed:	89 f7                	mov    %esi,%edi
+  8013ef:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8013f1:	5b                   	pop    %ebx
+  8013f2:	5e                   	pop    %esi
+  8013f3:	5f                   	pop    %edi
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+
+008013f6 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	57                   	push   %edi
+  8013fa:	56                   	push   %esi
+  8013fb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801401:	8b 55 08             	mov    0x8(%ebp),%edx
+  801404:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801407:	b8 17 00 00 00       	mov    $0x17,%eax
+  80140c:	89 df                	mov    %ebx,%edi
+  80140e:	89 de                	mov    %ebx,%esi
+  801410:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801412:	5b                   	pop    %ebx
+  801413:	5e                   	pop    %esi
+  801414:	5f                   	pop    %edi
+  801415:	5d                   	pop    %ebp
+  801416:	c3                   	ret
+
+00801417 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	57                   	push   %edi
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80141d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801422:	8b 55 08             	mov    0x8(%ebp),%edx
+  801425:	b8 18 00 00 00       	mov    $0x18,%eax
+  80142a:	89 cb                	mov    %ecx,%ebx
+  80142c:	89 cf                	mov    %ecx,%edi
+  80142e:	89 ce                	mov    %ecx,%esi
+  801430:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801432:	5b                   	pop    %ebx
+  801433:	5e                   	pop    %esi
+  801434:	5f                   	pop    %edi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+
+00801437 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80143d:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801441:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801446:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801449:	b8 19 00 00 00       	mov    $0x19,%eax
+  80144e:	89 df                	mov    %ebx,%edi
+  801450:	89 de                	mov    %ebx,%esi
+  801452:	cd 30                	int    $0x30
+}
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5f                   	pop    %edi
+  801457:	5d                   	pop    %ebp
+  801458:	c3                   	ret
+
+00801459 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80145f:	be 00 00 00 00       	mov    $0x0,%esi
+  801464:	8b 55 08             	mov    0x8(%ebp),%edx
+  801467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80146f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801472:	89 f7                	mov    %esi,%edi
+  801474:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801476:	5b                   	pop    %ebx
+  801477:	5e                   	pop    %esi
+  801478:	5f                   	pop    %edi
+  801479:	5d                   	pop    %ebp
+  80147a:	c3                   	ret
+
+0080147b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	57                   	push   %edi
+  80147f:	56                   	push   %esi
+  801480:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801481:	be 00 00 00 00       	mov    $0x0,%esi
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801491:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801494:	89 f7                	mov    %esi,%edi
+  801496:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801498:	5b                   	pop    %ebx
+  801499:	5e                   	pop    %esi
+  80149a:	5f                   	pop    %edi
+  80149b:	5d                   	pop    %ebp
+  80149c:	c3                   	ret
+
+0080149d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	57                   	push   %edi
+  8014a1:	56                   	push   %esi
+  8014a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ae:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014b3:	89 df                	mov    %ebx,%edi
+  8014b5:	89 de                	mov    %ebx,%esi
+  8014b7:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5e                   	pop    %esi
+  8014bb:	5f                   	pop    %edi
+  8014bc:	5d                   	pop    %ebp
+  8014bd:	c3                   	ret
+
+008014be <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8014be:	55                   	push   %ebp
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	57                   	push   %edi
+  8014c2:	56                   	push   %esi
+  8014c3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d7:	89 f7                	mov    %esi,%edi
+  8014d9:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8014db:	5b                   	pop    %ebx
+  8014dc:	5e                   	pop    %esi
+  8014dd:	5f                   	pop    %edi
+  8014de:	5d                   	pop    %ebp
+  8014df:	c3                   	ret
+
+008014e0 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	74 20                	je     801504 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8014e4:	89 c1                	mov    %eax,%ecx
+  8014e6:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8014ec:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8014f2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8014f8:	8b 52 48             	mov    0x48(%edx),%edx
+  8014fb:	39 c2                	cmp    %eax,%edx
+  8014fd:	74 06                	je     801505 <thread_alive+0x25>
+  8014ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801504:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801505:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  80150b:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801511:	85 c0                	test   %eax,%eax
+  801513:	0f 95 c0             	setne  %al
+  801516:	0f b6 c0             	movzbl %al,%eax
+  801519:	c3                   	ret
+
+0080151a <pgfault>:
+{
+  80151a:	55                   	push   %ebp
+  80151b:	89 e5                	mov    %esp,%ebp
+  80151d:	57                   	push   %edi
+  80151e:	56                   	push   %esi
+  80151f:	53                   	push   %ebx
+  801520:	83 ec 0c             	sub    $0xc,%esp
+  801523:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801526:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801528:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  80152b:	89 f3                	mov    %esi,%ebx
+  80152d:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801530:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801537:	74 52                	je     80158b <pgfault+0x71>
+  801539:	a8 02                	test   $0x2,%al
+  80153b:	75 14                	jne    801551 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  80153d:	83 ec 04             	sub    $0x4,%esp
+  801540:	68 56 4c 80 00       	push   $0x804c56
+  801545:	6a 2e                	push   $0x2e
+  801547:	68 74 4c 80 00       	push   $0x804c74
+  80154c:	e8 26 ef ff ff       	call   800477 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801551:	89 d8                	mov    %ebx,%eax
+  801553:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801558:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  80155f:	83 ec 0c             	sub    $0xc,%esp
+  801562:	57                   	push   %edi
+  801563:	e8 65 29 00 00       	call   803ecd <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801568:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80156f:	83 e0 03             	and    $0x3,%eax
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	83 f8 03             	cmp    $0x3,%eax
+  801578:	75 1a                	jne    801594 <pgfault+0x7a>
+			mutex_unlock(m);
+  80157a:	83 ec 0c             	sub    $0xc,%esp
+  80157d:	57                   	push   %edi
+  80157e:	e8 b8 29 00 00       	call   803f3b <mutex_unlock>
+			return;
+  801583:	83 c4 10             	add    $0x10,%esp
+  801586:	e9 9f 00 00 00       	jmp    80162a <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80158b:	a8 02                	test   $0x2,%al
+  80158d:	74 ae                	je     80153d <pgfault+0x23>
+	struct mutex *m = NULL;
+  80158f:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801594:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80159b:	f6 c4 08             	test   $0x8,%ah
+  80159e:	74 9d                	je     80153d <pgfault+0x23>
+  8015a0:	89 e0                	mov    %esp,%eax
+  8015a2:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8015a7:	29 c2                	sub    %eax,%edx
+  8015a9:	89 d0                	mov    %edx,%eax
+  8015ab:	c1 e8 0f             	shr    $0xf,%eax
+  8015ae:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8015b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b9:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8015bc:	c1 e0 0c             	shl    $0xc,%eax
+  8015bf:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8015c4:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8015c6:	83 ec 04             	sub    $0x4,%esp
+  8015c9:	6a 07                	push   $0x7
+  8015cb:	53                   	push   %ebx
+  8015cc:	6a 00                	push   $0x0
+  8015ce:	e8 aa fa ff ff       	call   80107d <sys_page_alloc>
+  8015d3:	83 c4 10             	add    $0x10,%esp
+  8015d6:	85 c0                	test   %eax,%eax
+  8015d8:	78 58                	js     801632 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8015da:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8015e0:	83 ec 04             	sub    $0x4,%esp
+  8015e3:	68 00 10 00 00       	push   $0x1000
+  8015e8:	56                   	push   %esi
+  8015e9:	53                   	push   %ebx
+  8015ea:	e8 0a f8 ff ff       	call   800df9 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8015ef:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8015f6:	56                   	push   %esi
+  8015f7:	6a 00                	push   $0x0
+  8015f9:	53                   	push   %ebx
+  8015fa:	6a 00                	push   $0x0
+  8015fc:	e8 bf fa ff ff       	call   8010c0 <sys_page_map>
+  801601:	83 c4 20             	add    $0x20,%esp
+  801604:	85 c0                	test   %eax,%eax
+  801606:	78 3c                	js     801644 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801608:	83 ec 08             	sub    $0x8,%esp
+  80160b:	53                   	push   %ebx
+  80160c:	6a 00                	push   $0x0
+  80160e:	e8 ef fa ff ff       	call   801102 <sys_page_unmap>
+  801613:	83 c4 10             	add    $0x10,%esp
+  801616:	85 c0                	test   %eax,%eax
+  801618:	78 3c                	js     801656 <pgfault+0x13c>
+	if(m)
+  80161a:	85 ff                	test   %edi,%edi
+  80161c:	74 0c                	je     80162a <pgfault+0x110>
+		mutex_unlock(m);
+  80161e:	83 ec 0c             	sub    $0xc,%esp
+  801621:	57                   	push   %edi
+  801622:	e8 14 29 00 00       	call   803f3b <mutex_unlock>
+  801627:	83 c4 10             	add    $0x10,%esp
+}
+  80162a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162d:	5b                   	pop    %ebx
+  80162e:	5e                   	pop    %esi
+  80162f:	5f                   	pop    %edi
+  801630:	5d                   	pop    %ebp
+  801631:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801632:	50                   	push   %eax
+  801633:	68 23 48 80 00       	push   $0x804823
+  801638:	6a 3d                	push   $0x3d
+  80163a:	68 74 4c 80 00       	push   $0x804c74
+  80163f:	e8 33 ee ff ff       	call   800477 <_panic>
+		panic("sys_page_map: %e", ret);
+  801644:	50                   	push   %eax
+  801645:	68 7f 4c 80 00       	push   $0x804c7f
+  80164a:	6a 40                	push   $0x40
+  80164c:	68 74 4c 80 00       	push   $0x804c74
+  801651:	e8 21 ee ff ff       	call   800477 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801656:	50                   	push   %eax
+  801657:	68 90 4c 80 00       	push   $0x804c90
+  80165c:	6a 42                	push   $0x42
+  80165e:	68 74 4c 80 00       	push   $0x804c74
+  801663:	e8 0f ee ff ff       	call   800477 <_panic>
+
+00801668 <thread_main>:
+{
+  801668:	55                   	push   %ebp
+  801669:	89 e5                	mov    %esp,%ebp
+  80166b:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  80166e:	ff 75 0c             	push   0xc(%ebp)
+  801671:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801674:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80167b:	e8 7e f9 ff ff       	call   800ffe <sys_env_destroy>
+}
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	c9                   	leave
+  801684:	c3                   	ret
+
+00801685 <fork>:
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	57                   	push   %edi
+  801689:	56                   	push   %esi
+  80168a:	53                   	push   %ebx
+  80168b:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  80168e:	68 1a 15 80 00       	push   $0x80151a
+  801693:	e8 81 2b 00 00       	call   804219 <set_pgfault_handler>
+	if(sforked)
+  801698:	83 c4 10             	add    $0x10,%esp
+  80169b:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8016a2:	75 33                	jne    8016d7 <fork+0x52>
+	__asm __volatile("int %2"
+  8016a4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016a9:	cd 30                	int    $0x30
+  8016ab:	89 c7                	mov    %eax,%edi
+  8016ad:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8016af:	85 c0                	test   %eax,%eax
+  8016b1:	0f 88 b4 00 00 00    	js     80176b <fork+0xe6>
+	if(envid == 0) {
+  8016b7:	0f 84 c3 00 00 00    	je     801780 <fork+0xfb>
+	pgbatch_init(&pb);
+  8016bd:	83 ec 0c             	sub    $0xc,%esp
+  8016c0:	68 20 63 80 00       	push   $0x806320
+  8016c5:	e8 4f 26 00 00       	call   803d19 <pgbatch_init>
+  8016ca:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8016cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d2:	e9 9c 01 00 00       	jmp    801873 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8016d7:	83 ec 0c             	sub    $0xc,%esp
+  8016da:	68 c0 66 80 00       	push   $0x8066c0
+  8016df:	e8 e9 27 00 00       	call   803ecd <mutex_lock>
+  8016e4:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8016e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8016ec:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8016f1:	eb 08                	jmp    8016fb <fork+0x76>
+  8016f3:	83 c3 01             	add    $0x1,%ebx
+  8016f6:	83 fb 20             	cmp    $0x20,%ebx
+  8016f9:	74 5b                	je     801756 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8016fb:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  801702:	89 f0                	mov    %esi,%eax
+  801704:	e8 d7 fd ff ff       	call   8014e0 <thread_alive>
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	74 e6                	je     8016f3 <fork+0x6e>
+  80170d:	89 e0                	mov    %esp,%eax
+  80170f:	89 fa                	mov    %edi,%edx
+  801711:	29 c2                	sub    %eax,%edx
+  801713:	89 d0                	mov    %edx,%eax
+  801715:	c1 e8 0f             	shr    $0xf,%eax
+  801718:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80171e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801723:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  801726:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80172d:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801730:	83 ec 08             	sub    $0x8,%esp
+  801733:	50                   	push   %eax
+  801734:	56                   	push   %esi
+  801735:	e8 8e fa ff ff       	call   8011c8 <sys_env_set_pgfault_upcall>
+  80173a:	83 c4 10             	add    $0x10,%esp
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	79 b2                	jns    8016f3 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801741:	50                   	push   %eax
+  801742:	68 1c 4d 80 00       	push   $0x804d1c
+  801747:	68 00 01 00 00       	push   $0x100
+  80174c:	68 74 4c 80 00       	push   $0x804c74
+  801751:	e8 21 ed ff ff       	call   800477 <_panic>
+	mutex_unlock(&sfork_lock);
+  801756:	83 ec 0c             	sub    $0xc,%esp
+  801759:	68 c0 66 80 00       	push   $0x8066c0
+  80175e:	e8 d8 27 00 00       	call   803f3b <mutex_unlock>
+}
+  801763:	83 c4 10             	add    $0x10,%esp
+  801766:	e9 39 ff ff ff       	jmp    8016a4 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  80176b:	50                   	push   %eax
+  80176c:	68 a3 4c 80 00       	push   $0x804ca3
+  801771:	68 91 00 00 00       	push   $0x91
+  801776:	68 74 4c 80 00       	push   $0x804c74
+  80177b:	e8 f7 ec ff ff       	call   800477 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801780:	e8 ba f8 ff ff       	call   80103f <sys_getenvid>
+  801785:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80178a:	89 e1                	mov    %esp,%ecx
+  80178c:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801791:	29 ca                	sub    %ecx,%edx
+  801793:	89 d1                	mov    %edx,%ecx
+  801795:	c1 e9 0f             	shr    $0xf,%ecx
+  801798:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80179e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a3:	0f 42 d1             	cmovb  %ecx,%edx
+  8017a6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8017ac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017b1:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  8017b8:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	75 07                	jne    8017c8 <fork+0x143>
+		return 0;
+  8017c1:	89 c6                	mov    %eax,%esi
+  8017c3:	e9 6f 02 00 00       	jmp    801a37 <fork+0x3b2>
+  8017c8:	89 e2                	mov    %esp,%edx
+  8017ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017cf:	29 d0                	sub    %edx,%eax
+  8017d1:	89 c3                	mov    %eax,%ebx
+  8017d3:	c1 eb 0f             	shr    $0xf,%ebx
+  8017d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e0:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8017e3:	83 ec 04             	sub    $0x4,%esp
+  8017e6:	68 80 00 00 00       	push   $0x80
+  8017eb:	6a 00                	push   $0x0
+  8017ed:	68 40 66 80 00       	push   $0x806640
+  8017f2:	e8 cd f5 ff ff       	call   800dc4 <memset>
+	thread_ids[slot] = sys_getenvid();
+  8017f7:	e8 43 f8 ff ff       	call   80103f <sys_getenvid>
+  8017fc:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  801803:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  80180a:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  80180f:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  801816:	e8 a4 26 00 00       	call   803ebf <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80181b:	83 c4 0c             	add    $0xc,%esp
+  80181e:	68 07 04 00 00       	push   $0x407
+  801823:	68 00 00 00 e1       	push   $0xe1000000
+  801828:	6a 00                	push   $0x0
+  80182a:	e8 4e f8 ff ff       	call   80107d <sys_page_alloc>
+  80182f:	83 c4 10             	add    $0x10,%esp
+  801832:	85 c0                	test   %eax,%eax
+  801834:	0f 89 fd 01 00 00    	jns    801a37 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  80183a:	50                   	push   %eax
+  80183b:	68 23 48 80 00       	push   $0x804823
+  801840:	68 12 01 00 00       	push   $0x112
+  801845:	68 74 4c 80 00       	push   $0x804c74
+  80184a:	e8 28 ec ff ff       	call   800477 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  80184f:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801855:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  80185b:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801861:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801867:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  80186d:	0f 87 4f 01 00 00    	ja     8019c2 <fork+0x33d>
+		pd = PDX(addr);
+  801873:	89 d8                	mov    %ebx,%eax
+  801875:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801878:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80187f:	f6 c2 01             	test   $0x1,%dl
+  801882:	74 cb                	je     80184f <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801884:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801889:	0f 85 92 00 00 00    	jne    801921 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  80188f:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801895:	76 10                	jbe    8018a7 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801897:	89 d8                	mov    %ebx,%eax
+  801899:	f7 d8                	neg    %eax
+  80189b:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8018a0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8018a5:	74 ba                	je     801861 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8018a7:	89 d8                	mov    %ebx,%eax
+  8018a9:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8018ac:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018b3:	f6 c2 01             	test   $0x1,%dl
+  8018b6:	74 a9                	je     801861 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8018b8:	89 c1                	mov    %eax,%ecx
+  8018ba:	c1 e1 0c             	shl    $0xc,%ecx
+  8018bd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8018c0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018c7:	f6 c6 04             	test   $0x4,%dh
+  8018ca:	0f 85 8e 00 00 00    	jne    80195e <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8018d0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018d7:	f6 c6 08             	test   $0x8,%dh
+  8018da:	75 0f                	jne    8018eb <fork+0x266>
+  8018dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018e3:	a8 02                	test   $0x2,%al
+  8018e5:	0f 84 bb 00 00 00    	je     8019a6 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8018eb:	83 ec 08             	sub    $0x8,%esp
+  8018ee:	68 05 08 00 00       	push   $0x805
+  8018f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018f6:	50                   	push   %eax
+  8018f7:	56                   	push   %esi
+  8018f8:	50                   	push   %eax
+  8018f9:	6a 00                	push   $0x0
+  8018fb:	68 20 63 80 00       	push   $0x806320
+  801900:	e8 d2 24 00 00       	call   803dd7 <pgbatch_map>
+  801905:	83 c4 20             	add    $0x20,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	79 76                	jns    801982 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  80190c:	50                   	push   %eax
+  80190d:	68 c7 4c 80 00       	push   $0x804cc7
+  801912:	68 bc 00 00 00       	push   $0xbc
+  801917:	68 74 4c 80 00       	push   $0x804c74
+  80191c:	e8 56 eb ff ff       	call   800477 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801921:	83 ec 0c             	sub    $0xc,%esp
+  801924:	68 00 08 00 00       	push   $0x800
+  801929:	56                   	push   %esi
+  80192a:	53                   	push   %ebx
+  80192b:	6a 00                	push   $0x0
+  80192d:	68 20 63 80 00       	push   $0x806320
+  801932:	e8 4b 25 00 00       	call   803e82 <pgbatch_sharept>
+  801937:	83 c4 20             	add    $0x20,%esp
+  80193a:	85 c0                	test   %eax,%eax
+  80193c:	78 0b                	js     801949 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  80193e:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801944:	e9 18 ff ff ff       	jmp    801861 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801949:	50                   	push   %eax
+  80194a:	68 b3 4c 80 00       	push   $0x804cb3
+  80194f:	68 b2 00 00 00       	push   $0xb2
+  801954:	68 74 4c 80 00       	push   $0x804c74
+  801959:	e8 19 eb ff ff       	call   800477 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  80195e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801965:	83 ec 08             	sub    $0x8,%esp
+  801968:	25 07 0e 00 00       	and    $0xe07,%eax
+  80196d:	50                   	push   %eax
+  80196e:	51                   	push   %ecx
+  80196f:	56                   	push   %esi
+  801970:	51                   	push   %ecx
+  801971:	6a 00                	push   $0x0
+  801973:	68 20 63 80 00       	push   $0x806320
+  801978:	e8 5a 24 00 00       	call   803dd7 <pgbatch_map>
+  80197d:	83 c4 20             	add    $0x20,%esp
+  801980:	eb 17                	jmp    801999 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801982:	68 05 08 00 00       	push   $0x805
+  801987:	ff 75 e4             	push   -0x1c(%ebp)
+  80198a:	6a 00                	push   $0x0
+  80198c:	68 20 63 80 00       	push   $0x806320
+  801991:	e8 b5 24 00 00       	call   803e4b <pgbatch_protect>
+  801996:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	0f 89 c0 fe ff ff    	jns    801861 <fork+0x1dc>
+  8019a1:	e9 66 ff ff ff       	jmp    80190c <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8019a6:	83 ec 08             	sub    $0x8,%esp
+  8019a9:	6a 05                	push   $0x5
+  8019ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019ae:	50                   	push   %eax
+  8019af:	56                   	push   %esi
+  8019b0:	50                   	push   %eax
+  8019b1:	6a 00                	push   $0x0
+  8019b3:	68 20 63 80 00       	push   $0x806320
+  8019b8:	e8 1a 24 00 00       	call   803dd7 <pgbatch_map>
+  8019bd:	83 c4 20             	add    $0x20,%esp
+  8019c0:	eb d7                	jmp    801999 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  8019c2:	6a 07                	push   $0x7
+  8019c4:	68 00 f0 bf ee       	push   $0xeebff000
+  8019c9:	57                   	push   %edi
+  8019ca:	68 20 63 80 00       	push   $0x806320
+  8019cf:	e8 cc 23 00 00       	call   803da0 <pgbatch_alloc>
+  8019d4:	83 c4 10             	add    $0x10,%esp
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	78 66                	js     801a41 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8019db:	83 ec 0c             	sub    $0xc,%esp
+  8019de:	68 20 63 80 00       	push   $0x806320
+  8019e3:	e8 3f 23 00 00       	call   803d27 <pgbatch_flush>
+  8019e8:	83 c4 10             	add    $0x10,%esp
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	78 52                	js     801a41 <fork+0x3bc>
+  8019ef:	89 e2                	mov    %esp,%edx
+  8019f1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8019f6:	29 d0                	sub    %edx,%eax
+  8019f8:	89 c2                	mov    %eax,%edx
+  8019fa:	c1 ea 0f             	shr    $0xf,%edx
+  8019fd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a07:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801a0a:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a11:	8b 40 78             	mov    0x78(%eax),%eax
+  801a14:	83 ec 08             	sub    $0x8,%esp
+  801a17:	50                   	push   %eax
+  801a18:	57                   	push   %edi
+  801a19:	e8 aa f7 ff ff       	call   8011c8 <sys_env_set_pgfault_upcall>
+  801a1e:	83 c4 10             	add    $0x10,%esp
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	78 31                	js     801a56 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801a25:	83 ec 08             	sub    $0x8,%esp
+  801a28:	6a 02                	push   $0x2
+  801a2a:	57                   	push   %edi
+  801a2b:	e8 14 f7 ff ff       	call   801144 <sys_env_set_status>
+  801a30:	83 c4 10             	add    $0x10,%esp
+  801a33:	85 c0                	test   %eax,%eax
+  801a35:	78 34                	js     801a6b <fork+0x3e6>
+}
+  801a37:	89 f0                	mov    %esi,%eax
+  801a39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a3c:	5b                   	pop    %ebx
+  801a3d:	5e                   	pop    %esi
+  801a3e:	5f                   	pop    %edi
+  801a3f:	5d                   	pop    %ebp
+  801a40:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801a41:	50                   	push   %eax
+  801a42:	68 d3 4c 80 00       	push   $0x804cd3
+  801a47:	68 c0 00 00 00       	push   $0xc0
+  801a4c:	68 74 4c 80 00       	push   $0x804c74
+  801a51:	e8 21 ea ff ff       	call   800477 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801a56:	50                   	push   %eax
+  801a57:	68 e8 4c 80 00       	push   $0x804ce8
+  801a5c:	68 c2 00 00 00       	push   $0xc2
+  801a61:	68 74 4c 80 00       	push   $0x804c74
+  801a66:	e8 0c ea ff ff       	call   800477 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801a6b:	50                   	push   %eax
+  801a6c:	68 03 4d 80 00       	push   $0x804d03
+  801a71:	68 c4 00 00 00       	push   $0xc4
+  801a76:	68 74 4c 80 00       	push   $0x804c74
+  801a7b:	e8 f7 e9 ff ff       	call   800477 <_panic>
+
+00801a80 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	57                   	push   %edi
+  801a84:	56                   	push   %esi
+  801a85:	53                   	push   %ebx
+  801a86:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801a89:	68 c0 66 80 00       	push   $0x8066c0
+  801a8e:	e8 3a 24 00 00       	call   803ecd <mutex_lock>
+  801a93:	89 e2                	mov    %esp,%edx
+  801a95:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a9a:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801a9c:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801a9f:	89 c3                	mov    %eax,%ebx
+  801aa1:	c1 eb 0f             	shr    $0xf,%ebx
+  801aa4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aae:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801ab1:	e8 89 f5 ff ff       	call   80103f <sys_getenvid>
+  801ab6:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801abd:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801ac2:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801ac9:	e8 12 fa ff ff       	call   8014e0 <thread_alive>
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	74 24                	je     801af6 <sfork+0x76>
+  801ad2:	83 c3 01             	add    $0x1,%ebx
+  801ad5:	83 fb 20             	cmp    $0x20,%ebx
+  801ad8:	75 e8                	jne    801ac2 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801ada:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801adf:	83 ec 0c             	sub    $0xc,%esp
+  801ae2:	68 c0 66 80 00       	push   $0x8066c0
+  801ae7:	e8 4f 24 00 00       	call   803f3b <mutex_unlock>
+	return r;
+}
+  801aec:	89 f0                	mov    %esi,%eax
+  801aee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af1:	5b                   	pop    %ebx
+  801af2:	5e                   	pop    %esi
+  801af3:	5f                   	pop    %edi
+  801af4:	5d                   	pop    %ebp
+  801af5:	c3                   	ret
+	if (i == NTHREADS) {
+  801af6:	83 fb 20             	cmp    $0x20,%ebx
+  801af9:	0f 84 53 01 00 00    	je     801c52 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801aff:	89 d8                	mov    %ebx,%eax
+  801b01:	c1 e0 0f             	shl    $0xf,%eax
+  801b04:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801b07:	83 ec 0c             	sub    $0xc,%esp
+  801b0a:	68 00 60 80 00       	push   $0x806000
+  801b0f:	e8 05 22 00 00       	call   803d19 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801b1e:	75 1f                	jne    801b3f <sfork+0xbf>
+  801b20:	68 07 04 00 00       	push   $0x407
+  801b25:	68 00 00 00 e1       	push   $0xe1000000
+  801b2a:	6a 00                	push   $0x0
+  801b2c:	68 00 60 80 00       	push   $0x806000
+  801b31:	e8 6a 22 00 00       	call   803da0 <pgbatch_alloc>
+  801b36:	89 c6                	mov    %eax,%esi
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	85 c0                	test   %eax,%eax
+  801b3d:	78 a0                	js     801adf <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801b3f:	6a 07                	push   $0x7
+  801b41:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801b46:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b49:	29 c8                	sub    %ecx,%eax
+  801b4b:	50                   	push   %eax
+  801b4c:	6a 00                	push   $0x0
+  801b4e:	68 00 60 80 00       	push   $0x806000
+  801b53:	e8 48 22 00 00       	call   803da0 <pgbatch_alloc>
+  801b58:	89 c6                	mov    %eax,%esi
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	0f 88 7a ff ff ff    	js     801adf <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801b65:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801b6a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b6d:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801b6f:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801b74:	29 c8                	sub    %ecx,%eax
+  801b76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b79:	39 c7                	cmp    %eax,%edi
+  801b7b:	73 29                	jae    801ba6 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801b7d:	6a 07                	push   $0x7
+  801b7f:	57                   	push   %edi
+  801b80:	6a 00                	push   $0x0
+  801b82:	68 00 60 80 00       	push   $0x806000
+  801b87:	e8 14 22 00 00       	call   803da0 <pgbatch_alloc>
+  801b8c:	89 c6                	mov    %eax,%esi
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	85 c0                	test   %eax,%eax
+  801b93:	0f 88 46 ff ff ff    	js     801adf <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801b99:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801b9f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ba2:	39 c7                	cmp    %eax,%edi
+  801ba4:	72 d7                	jb     801b7d <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801ba6:	83 ec 0c             	sub    $0xc,%esp
+  801ba9:	68 00 60 80 00       	push   $0x806000
+  801bae:	e8 74 21 00 00       	call   803d27 <pgbatch_flush>
+  801bb3:	89 c6                	mov    %eax,%esi
+  801bb5:	83 c4 10             	add    $0x10,%esp
+  801bb8:	85 c0                	test   %eax,%eax
+  801bba:	0f 88 1f ff ff ff    	js     801adf <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801bc0:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801bc5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801bc8:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801bca:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801bd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bd3:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801bd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bd9:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801bdc:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801bdf:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801be4:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801be6:	52                   	push   %edx
+  801be7:	50                   	push   %eax
+  801be8:	68 68 16 80 00       	push   $0x801668
+  801bed:	e8 cc f8 ff ff       	call   8014be <sys_exofork_shared>
+  801bf2:	89 c6                	mov    %eax,%esi
+  801bf4:	83 c4 10             	add    $0x10,%esp
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	0f 88 e0 fe ff ff    	js     801adf <sfork+0x5f>
+	thread_ids[i] = id;
+  801bff:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801c06:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c0b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801c11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c16:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801c1d:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801c24:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801c27:	83 ec 08             	sub    $0x8,%esp
+  801c2a:	6a 02                	push   $0x2
+  801c2c:	56                   	push   %esi
+  801c2d:	e8 12 f5 ff ff       	call   801144 <sys_env_set_status>
+  801c32:	89 c3                	mov    %eax,%ebx
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	0f 89 a0 fe ff ff    	jns    801adf <sfork+0x5f>
+		sys_env_destroy(id);
+  801c3f:	83 ec 0c             	sub    $0xc,%esp
+  801c42:	56                   	push   %esi
+  801c43:	e8 b6 f3 ff ff       	call   800ffe <sys_env_destroy>
+		goto out;
+  801c48:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801c4b:	89 de                	mov    %ebx,%esi
+		goto out;
+  801c4d:	e9 8d fe ff ff       	jmp    801adf <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801c52:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801c57:	e9 83 fe ff ff       	jmp    801adf <sfork+0x5f>
+
+00801c5c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801c5c:	55                   	push   %ebp
+  801c5d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c62:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c67:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+
+00801c6c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c72:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c77:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c7c:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801c81:	5d                   	pop    %ebp
+  801c82:	c3                   	ret
+
+00801c83 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c83:	55                   	push   %ebp
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c8b:	89 c2                	mov    %eax,%edx
+  801c8d:	c1 ea 16             	shr    $0x16,%edx
+  801c90:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c97:	f6 c2 01             	test   $0x1,%dl
+  801c9a:	74 29                	je     801cc5 <fd_alloc+0x42>
+  801c9c:	89 c2                	mov    %eax,%edx
+  801c9e:	c1 ea 0c             	shr    $0xc,%edx
+  801ca1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ca8:	f6 c2 01             	test   $0x1,%dl
+  801cab:	74 18                	je     801cc5 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801cad:	05 00 10 00 00       	add    $0x1000,%eax
+  801cb2:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801cb7:	75 d2                	jne    801c8b <fd_alloc+0x8>
+  801cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801cbe:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801cc3:	eb 05                	jmp    801cca <fd_alloc+0x47>
+			return 0;
+  801cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801cca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ccd:	89 02                	mov    %eax,(%edx)
+}
+  801ccf:	89 c8                	mov    %ecx,%eax
+  801cd1:	5d                   	pop    %ebp
+  801cd2:	c3                   	ret
+
+00801cd3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801cd3:	55                   	push   %ebp
+  801cd4:	89 e5                	mov    %esp,%ebp
+  801cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801cd9:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801cde:	77 30                	ja     801d10 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801ce0:	c1 e0 0c             	shl    $0xc,%eax
+  801ce3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801ce8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801cee:	f6 c2 01             	test   $0x1,%dl
+  801cf1:	74 24                	je     801d17 <fd_lookup+0x44>
+  801cf3:	89 c2                	mov    %eax,%edx
+  801cf5:	c1 ea 0c             	shr    $0xc,%edx
+  801cf8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801cff:	f6 c2 01             	test   $0x1,%dl
+  801d02:	74 1a                	je     801d1e <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801d04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d07:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801d09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d0e:	5d                   	pop    %ebp
+  801d0f:	c3                   	ret
+		return -E_INVAL;
+  801d10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d15:	eb f7                	jmp    801d0e <fd_lookup+0x3b>
+		return -E_INVAL;
+  801d17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1c:	eb f0                	jmp    801d0e <fd_lookup+0x3b>
+  801d1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d23:	eb e9                	jmp    801d0e <fd_lookup+0x3b>
+
+00801d25 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801d25:	55                   	push   %ebp
+  801d26:	89 e5                	mov    %esp,%ebp
+  801d28:	53                   	push   %ebx
+  801d29:	83 ec 04             	sub    $0x4,%esp
+  801d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d34:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801d39:	39 13                	cmp    %edx,(%ebx)
+  801d3b:	74 54                	je     801d91 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801d3d:	83 c0 01             	add    $0x1,%eax
+  801d40:	8b 1c 85 b8 4d 80 00 	mov    0x804db8(,%eax,4),%ebx
+  801d47:	85 db                	test   %ebx,%ebx
+  801d49:	75 ee                	jne    801d39 <dev_lookup+0x14>
+  801d4b:	89 e1                	mov    %esp,%ecx
+  801d4d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d52:	29 c8                	sub    %ecx,%eax
+  801d54:	89 c1                	mov    %eax,%ecx
+  801d56:	c1 e9 0f             	shr    $0xf,%ecx
+  801d59:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d63:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d66:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801d6d:	8b 40 48             	mov    0x48(%eax),%eax
+  801d70:	83 ec 04             	sub    $0x4,%esp
+  801d73:	52                   	push   %edx
+  801d74:	50                   	push   %eax
+  801d75:	68 3c 4d 80 00       	push   $0x804d3c
+  801d7a:	e8 d3 e7 ff ff       	call   800552 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801d7f:	83 c4 10             	add    $0x10,%esp
+  801d82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801d87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d8a:	89 1a                	mov    %ebx,(%edx)
+}
+  801d8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8f:	c9                   	leave
+  801d90:	c3                   	ret
+			return 0;
+  801d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d96:	eb ef                	jmp    801d87 <dev_lookup+0x62>
+
+00801d98 <fd_close>:
+{
+  801d98:	55                   	push   %ebp
+  801d99:	89 e5                	mov    %esp,%ebp
+  801d9b:	57                   	push   %edi
+  801d9c:	56                   	push   %esi
+  801d9d:	53                   	push   %ebx
+  801d9e:	83 ec 24             	sub    $0x24,%esp
+  801da1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801da4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801da7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801daa:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801dab:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801db1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801db4:	50                   	push   %eax
+  801db5:	e8 19 ff ff ff       	call   801cd3 <fd_lookup>
+  801dba:	89 c3                	mov    %eax,%ebx
+  801dbc:	83 c4 10             	add    $0x10,%esp
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 05                	js     801dc8 <fd_close+0x30>
+	    || fd != fd2)
+  801dc3:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801dc6:	74 0f                	je     801dd7 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801dc8:	85 ff                	test   %edi,%edi
+  801dca:	0f 44 df             	cmove  %edi,%ebx
+}
+  801dcd:	89 d8                	mov    %ebx,%eax
+  801dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd2:	5b                   	pop    %ebx
+  801dd3:	5e                   	pop    %esi
+  801dd4:	5f                   	pop    %edi
+  801dd5:	5d                   	pop    %ebp
+  801dd6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801dd7:	83 ec 08             	sub    $0x8,%esp
+  801dda:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ddd:	50                   	push   %eax
+  801dde:	ff 36                	push   (%esi)
+  801de0:	e8 40 ff ff ff       	call   801d25 <dev_lookup>
+  801de5:	89 c3                	mov    %eax,%ebx
+  801de7:	83 c4 10             	add    $0x10,%esp
+  801dea:	85 c0                	test   %eax,%eax
+  801dec:	78 1a                	js     801e08 <fd_close+0x70>
+		if (dev->dev_close)
+  801dee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801df1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801df4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	74 0b                	je     801e08 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801dfd:	83 ec 0c             	sub    $0xc,%esp
+  801e00:	56                   	push   %esi
+  801e01:	ff d0                	call   *%eax
+  801e03:	89 c3                	mov    %eax,%ebx
+  801e05:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801e08:	83 ec 08             	sub    $0x8,%esp
+  801e0b:	56                   	push   %esi
+  801e0c:	6a 00                	push   $0x0
+  801e0e:	e8 ef f2 ff ff       	call   801102 <sys_page_unmap>
+	return r;
+  801e13:	83 c4 10             	add    $0x10,%esp
+  801e16:	eb b5                	jmp    801dcd <fd_close+0x35>
+
+00801e18 <close>:
+
+int
+close(int fdnum)
+{
+  801e18:	55                   	push   %ebp
+  801e19:	89 e5                	mov    %esp,%ebp
+  801e1b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e21:	50                   	push   %eax
+  801e22:	ff 75 08             	push   0x8(%ebp)
+  801e25:	e8 a9 fe ff ff       	call   801cd3 <fd_lookup>
+  801e2a:	83 c4 10             	add    $0x10,%esp
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	79 02                	jns    801e33 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801e31:	c9                   	leave
+  801e32:	c3                   	ret
+		return fd_close(fd, 1);
+  801e33:	83 ec 08             	sub    $0x8,%esp
+  801e36:	6a 01                	push   $0x1
+  801e38:	ff 75 f4             	push   -0xc(%ebp)
+  801e3b:	e8 58 ff ff ff       	call   801d98 <fd_close>
+  801e40:	83 c4 10             	add    $0x10,%esp
+  801e43:	eb ec                	jmp    801e31 <close+0x19>
+
+00801e45 <close_all>:
+
+void
+close_all(void)
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	53                   	push   %ebx
+  801e49:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801e4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801e51:	83 ec 0c             	sub    $0xc,%esp
+  801e54:	53                   	push   %ebx
+  801e55:	e8 be ff ff ff       	call   801e18 <close>
+	for (i = 0; i < MAXFD; i++)
+  801e5a:	83 c3 01             	add    $0x1,%ebx
+  801e5d:	83 c4 10             	add    $0x10,%esp
+  801e60:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801e66:	75 e9                	jne    801e51 <close_all+0xc>
+}
+  801e68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e6b:	c9                   	leave
+  801e6c:	c3                   	ret
+
+00801e6d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801e6d:	55                   	push   %ebp
+  801e6e:	89 e5                	mov    %esp,%ebp
+  801e70:	57                   	push   %edi
+  801e71:	56                   	push   %esi
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801e76:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e79:	50                   	push   %eax
+  801e7a:	ff 75 08             	push   0x8(%ebp)
+  801e7d:	e8 51 fe ff ff       	call   801cd3 <fd_lookup>
+  801e82:	89 c3                	mov    %eax,%ebx
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	78 7f                	js     801f0a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e8b:	83 ec 0c             	sub    $0xc,%esp
+  801e8e:	ff 75 0c             	push   0xc(%ebp)
+  801e91:	e8 82 ff ff ff       	call   801e18 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e99:	c1 e6 0c             	shl    $0xc,%esi
+  801e9c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ea2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ea5:	89 3c 24             	mov    %edi,(%esp)
+  801ea8:	e8 bf fd ff ff       	call   801c6c <fd2data>
+  801ead:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801eaf:	89 34 24             	mov    %esi,(%esp)
+  801eb2:	e8 b5 fd ff ff       	call   801c6c <fd2data>
+  801eb7:	83 c4 10             	add    $0x10,%esp
+  801eba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801ebd:	89 d8                	mov    %ebx,%eax
+  801ebf:	c1 e8 16             	shr    $0x16,%eax
+  801ec2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ec9:	a8 01                	test   $0x1,%al
+  801ecb:	74 11                	je     801ede <dup+0x71>
+  801ecd:	89 d8                	mov    %ebx,%eax
+  801ecf:	c1 e8 0c             	shr    $0xc,%eax
+  801ed2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ed9:	f6 c2 01             	test   $0x1,%dl
+  801edc:	75 36                	jne    801f14 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ede:	89 f8                	mov    %edi,%eax
+  801ee0:	c1 e8 0c             	shr    $0xc,%eax
+  801ee3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801eea:	83 ec 0c             	sub    $0xc,%esp
+  801eed:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ef2:	50                   	push   %eax
+  801ef3:	56                   	push   %esi
+  801ef4:	6a 00                	push   $0x0
+  801ef6:	57                   	push   %edi
+  801ef7:	6a 00                	push   $0x0
+  801ef9:	e8 c2 f1 ff ff       	call   8010c0 <sys_page_map>
+  801efe:	89 c3                	mov    %eax,%ebx
+  801f00:	83 c4 20             	add    $0x20,%esp
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	78 33                	js     801f3a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801f07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801f0a:	89 d8                	mov    %ebx,%eax
+  801f0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f0f:	5b                   	pop    %ebx
+  801f10:	5e                   	pop    %esi
+  801f11:	5f                   	pop    %edi
+  801f12:	5d                   	pop    %ebp
+  801f13:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801f14:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+  801f1e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f23:	50                   	push   %eax
+  801f24:	ff 75 d4             	push   -0x2c(%ebp)
+  801f27:	6a 00                	push   $0x0
+  801f29:	53                   	push   %ebx
+  801f2a:	6a 00                	push   $0x0
+  801f2c:	e8 8f f1 ff ff       	call   8010c0 <sys_page_map>
+  801f31:	89 c3                	mov    %eax,%ebx
+  801f33:	83 c4 20             	add    $0x20,%esp
+  801f36:	85 c0                	test   %eax,%eax
+  801f38:	79 a4                	jns    801ede <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801f3a:	83 ec 08             	sub    $0x8,%esp
+  801f3d:	56                   	push   %esi
+  801f3e:	6a 00                	push   $0x0
+  801f40:	e8 bd f1 ff ff       	call   801102 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801f45:	83 c4 08             	add    $0x8,%esp
+  801f48:	ff 75 d4             	push   -0x2c(%ebp)
+  801f4b:	6a 00                	push   $0x0
+  801f4d:	e8 b0 f1 ff ff       	call   801102 <sys_page_unmap>
+	return r;
+  801f52:	83 c4 10             	add    $0x10,%esp
+  801f55:	eb b3                	jmp    801f0a <dup+0x9d>
+
+00801f57 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801f57:	55                   	push   %ebp
+  801f58:	89 e5                	mov    %esp,%ebp
+  801f5a:	56                   	push   %esi
+  801f5b:	53                   	push   %ebx
+  801f5c:	83 ec 18             	sub    $0x18,%esp
+  801f5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f65:	50                   	push   %eax
+  801f66:	53                   	push   %ebx
+  801f67:	e8 67 fd ff ff       	call   801cd3 <fd_lookup>
+  801f6c:	83 c4 10             	add    $0x10,%esp
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	78 3c                	js     801faf <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f73:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f76:	83 ec 08             	sub    $0x8,%esp
+  801f79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f7c:	50                   	push   %eax
+  801f7d:	ff 36                	push   (%esi)
+  801f7f:	e8 a1 fd ff ff       	call   801d25 <dev_lookup>
+  801f84:	83 c4 10             	add    $0x10,%esp
+  801f87:	85 c0                	test   %eax,%eax
+  801f89:	78 24                	js     801faf <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f8b:	8b 46 08             	mov    0x8(%esi),%eax
+  801f8e:	83 e0 03             	and    $0x3,%eax
+  801f91:	83 f8 01             	cmp    $0x1,%eax
+  801f94:	74 20                	je     801fb6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f99:	8b 40 08             	mov    0x8(%eax),%eax
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	74 54                	je     801ff4 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801fa0:	83 ec 04             	sub    $0x4,%esp
+  801fa3:	ff 75 10             	push   0x10(%ebp)
+  801fa6:	ff 75 0c             	push   0xc(%ebp)
+  801fa9:	56                   	push   %esi
+  801faa:	ff d0                	call   *%eax
+  801fac:	83 c4 10             	add    $0x10,%esp
+}
+  801faf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb2:	5b                   	pop    %ebx
+  801fb3:	5e                   	pop    %esi
+  801fb4:	5d                   	pop    %ebp
+  801fb5:	c3                   	ret
+  801fb6:	89 e2                	mov    %esp,%edx
+  801fb8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801fbd:	29 d0                	sub    %edx,%eax
+  801fbf:	89 c2                	mov    %eax,%edx
+  801fc1:	c1 ea 0f             	shr    $0xf,%edx
+  801fc4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fce:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fd1:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801fd8:	8b 40 48             	mov    0x48(%eax),%eax
+  801fdb:	83 ec 04             	sub    $0x4,%esp
+  801fde:	53                   	push   %ebx
+  801fdf:	50                   	push   %eax
+  801fe0:	68 7d 4d 80 00       	push   $0x804d7d
+  801fe5:	e8 68 e5 ff ff       	call   800552 <cprintf>
+		return -E_INVAL;
+  801fea:	83 c4 10             	add    $0x10,%esp
+  801fed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff2:	eb bb                	jmp    801faf <read+0x58>
+		return -E_NOT_SUPP;
+  801ff4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ff9:	eb b4                	jmp    801faf <read+0x58>
+
+00801ffb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ffb:	55                   	push   %ebp
+  801ffc:	89 e5                	mov    %esp,%ebp
+  801ffe:	57                   	push   %edi
+  801fff:	56                   	push   %esi
+  802000:	53                   	push   %ebx
+  802001:	83 ec 0c             	sub    $0xc,%esp
+  802004:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802007:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80200a:	85 f6                	test   %esi,%esi
+  80200c:	74 30                	je     80203e <readn+0x43>
+  80200e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802013:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802018:	83 ec 04             	sub    $0x4,%esp
+  80201b:	89 f2                	mov    %esi,%edx
+  80201d:	29 c2                	sub    %eax,%edx
+  80201f:	52                   	push   %edx
+  802020:	01 f8                	add    %edi,%eax
+  802022:	50                   	push   %eax
+  802023:	ff 75 08             	push   0x8(%ebp)
+  802026:	e8 2c ff ff ff       	call   801f57 <read>
+		if (m < 0)
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	85 c0                	test   %eax,%eax
+  802030:	78 15                	js     802047 <readn+0x4c>
+			return m;
+		if (m == 0)
+  802032:	74 11                	je     802045 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802034:	01 c3                	add    %eax,%ebx
+  802036:	89 d8                	mov    %ebx,%eax
+  802038:	39 f3                	cmp    %esi,%ebx
+  80203a:	72 dc                	jb     802018 <readn+0x1d>
+  80203c:	eb 09                	jmp    802047 <readn+0x4c>
+  80203e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802043:	eb 02                	jmp    802047 <readn+0x4c>
+  802045:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  802047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80204a:	5b                   	pop    %ebx
+  80204b:	5e                   	pop    %esi
+  80204c:	5f                   	pop    %edi
+  80204d:	5d                   	pop    %ebp
+  80204e:	c3                   	ret
+
+0080204f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	56                   	push   %esi
+  802053:	53                   	push   %ebx
+  802054:	83 ec 18             	sub    $0x18,%esp
+  802057:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80205a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80205d:	50                   	push   %eax
+  80205e:	53                   	push   %ebx
+  80205f:	e8 6f fc ff ff       	call   801cd3 <fd_lookup>
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	85 c0                	test   %eax,%eax
+  802069:	78 37                	js     8020a2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80206b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80206e:	83 ec 08             	sub    $0x8,%esp
+  802071:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802074:	50                   	push   %eax
+  802075:	ff 36                	push   (%esi)
+  802077:	e8 a9 fc ff ff       	call   801d25 <dev_lookup>
+  80207c:	83 c4 10             	add    $0x10,%esp
+  80207f:	85 c0                	test   %eax,%eax
+  802081:	78 1f                	js     8020a2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802083:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802087:	74 20                	je     8020a9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802089:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80208c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	74 54                	je     8020e7 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802093:	83 ec 04             	sub    $0x4,%esp
+  802096:	ff 75 10             	push   0x10(%ebp)
+  802099:	ff 75 0c             	push   0xc(%ebp)
+  80209c:	56                   	push   %esi
+  80209d:	ff d0                	call   *%eax
+  80209f:	83 c4 10             	add    $0x10,%esp
+}
+  8020a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a5:	5b                   	pop    %ebx
+  8020a6:	5e                   	pop    %esi
+  8020a7:	5d                   	pop    %ebp
+  8020a8:	c3                   	ret
+  8020a9:	89 e2                	mov    %esp,%edx
+  8020ab:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020b0:	29 d0                	sub    %edx,%eax
+  8020b2:	89 c2                	mov    %eax,%edx
+  8020b4:	c1 ea 0f             	shr    $0xf,%edx
+  8020b7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c1:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020c4:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8020cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8020ce:	83 ec 04             	sub    $0x4,%esp
+  8020d1:	53                   	push   %ebx
+  8020d2:	50                   	push   %eax
+  8020d3:	68 99 4d 80 00       	push   $0x804d99
+  8020d8:	e8 75 e4 ff ff       	call   800552 <cprintf>
+		return -E_INVAL;
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e5:	eb bb                	jmp    8020a2 <write+0x53>
+		return -E_NOT_SUPP;
+  8020e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ec:	eb b4                	jmp    8020a2 <write+0x53>
+
+008020ee <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8020ee:	55                   	push   %ebp
+  8020ef:	89 e5                	mov    %esp,%ebp
+  8020f1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f7:	50                   	push   %eax
+  8020f8:	ff 75 08             	push   0x8(%ebp)
+  8020fb:	e8 d3 fb ff ff       	call   801cd3 <fd_lookup>
+  802100:	83 c4 10             	add    $0x10,%esp
+  802103:	85 c0                	test   %eax,%eax
+  802105:	78 0e                	js     802115 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802107:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80210a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80210d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802110:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802115:	c9                   	leave
+  802116:	c3                   	ret
+
+00802117 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802117:	55                   	push   %ebp
+  802118:	89 e5                	mov    %esp,%ebp
+  80211a:	53                   	push   %ebx
+  80211b:	83 ec 1c             	sub    $0x1c,%esp
+  80211e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802121:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802124:	50                   	push   %eax
+  802125:	ff 75 08             	push   0x8(%ebp)
+  802128:	e8 a6 fb ff ff       	call   801cd3 <fd_lookup>
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	85 c0                	test   %eax,%eax
+  802132:	78 33                	js     802167 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802134:	83 fb 03             	cmp    $0x3,%ebx
+  802137:	74 28                	je     802161 <fcntl+0x4a>
+  802139:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80213e:	83 fb 04             	cmp    $0x4,%ebx
+  802141:	75 24                	jne    802167 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802143:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802146:	8b 41 08             	mov    0x8(%ecx),%eax
+  802149:	80 e4 ef             	and    $0xef,%ah
+  80214c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80214f:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802155:	09 d0                	or     %edx,%eax
+  802157:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80215a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215f:	eb 06                	jmp    802167 <fcntl+0x50>
+		return fd->fd_omode;
+  802161:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802164:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802167:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+
+0080216c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80216c:	55                   	push   %ebp
+  80216d:	89 e5                	mov    %esp,%ebp
+  80216f:	56                   	push   %esi
+  802170:	53                   	push   %ebx
+  802171:	83 ec 18             	sub    $0x18,%esp
+  802174:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802177:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80217a:	50                   	push   %eax
+  80217b:	53                   	push   %ebx
+  80217c:	e8 52 fb ff ff       	call   801cd3 <fd_lookup>
+  802181:	83 c4 10             	add    $0x10,%esp
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 34                	js     8021bc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802188:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80218b:	83 ec 08             	sub    $0x8,%esp
+  80218e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802191:	50                   	push   %eax
+  802192:	ff 36                	push   (%esi)
+  802194:	e8 8c fb ff ff       	call   801d25 <dev_lookup>
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	78 1c                	js     8021bc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021a0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021a4:	74 1d                	je     8021c3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8021a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a9:	8b 40 18             	mov    0x18(%eax),%eax
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	74 51                	je     802201 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8021b0:	83 ec 08             	sub    $0x8,%esp
+  8021b3:	ff 75 0c             	push   0xc(%ebp)
+  8021b6:	56                   	push   %esi
+  8021b7:	ff d0                	call   *%eax
+  8021b9:	83 c4 10             	add    $0x10,%esp
+}
+  8021bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021bf:	5b                   	pop    %ebx
+  8021c0:	5e                   	pop    %esi
+  8021c1:	5d                   	pop    %ebp
+  8021c2:	c3                   	ret
+  8021c3:	89 e2                	mov    %esp,%edx
+  8021c5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8021ca:	29 d0                	sub    %edx,%eax
+  8021cc:	89 c2                	mov    %eax,%edx
+  8021ce:	c1 ea 0f             	shr    $0xf,%edx
+  8021d1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8021d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021db:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8021de:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8021e5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021e8:	83 ec 04             	sub    $0x4,%esp
+  8021eb:	53                   	push   %ebx
+  8021ec:	50                   	push   %eax
+  8021ed:	68 5c 4d 80 00       	push   $0x804d5c
+  8021f2:	e8 5b e3 ff ff       	call   800552 <cprintf>
+		return -E_INVAL;
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ff:	eb bb                	jmp    8021bc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802201:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802206:	eb b4                	jmp    8021bc <ftruncate+0x50>
+
+00802208 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802208:	55                   	push   %ebp
+  802209:	89 e5                	mov    %esp,%ebp
+  80220b:	56                   	push   %esi
+  80220c:	53                   	push   %ebx
+  80220d:	83 ec 18             	sub    $0x18,%esp
+  802210:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802213:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802216:	50                   	push   %eax
+  802217:	ff 75 08             	push   0x8(%ebp)
+  80221a:	e8 b4 fa ff ff       	call   801cd3 <fd_lookup>
+  80221f:	83 c4 10             	add    $0x10,%esp
+  802222:	85 c0                	test   %eax,%eax
+  802224:	78 53                	js     802279 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802226:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802229:	83 ec 08             	sub    $0x8,%esp
+  80222c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222f:	50                   	push   %eax
+  802230:	ff 36                	push   (%esi)
+  802232:	e8 ee fa ff ff       	call   801d25 <dev_lookup>
+  802237:	83 c4 10             	add    $0x10,%esp
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	78 3b                	js     802279 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80223e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802241:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802245:	74 39                	je     802280 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802247:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80224a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802251:	00 00 00 
+	stat->st_isdir = 0;
+  802254:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80225b:	00 00 00 
+	stat->st_version = 0;
+  80225e:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802265:	00 00 00 
+	stat->st_dev = dev;
+  802268:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80226e:	83 ec 08             	sub    $0x8,%esp
+  802271:	53                   	push   %ebx
+  802272:	56                   	push   %esi
+  802273:	ff 50 14             	call   *0x14(%eax)
+  802276:	83 c4 10             	add    $0x10,%esp
+}
+  802279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227c:	5b                   	pop    %ebx
+  80227d:	5e                   	pop    %esi
+  80227e:	5d                   	pop    %ebp
+  80227f:	c3                   	ret
+		return -E_NOT_SUPP;
+  802280:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802285:	eb f2                	jmp    802279 <fstat+0x71>
+
+00802287 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	56                   	push   %esi
+  80228b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80228c:	83 ec 08             	sub    $0x8,%esp
+  80228f:	6a 00                	push   $0x0
+  802291:	ff 75 08             	push   0x8(%ebp)
+  802294:	e8 b7 01 00 00       	call   802450 <open>
+  802299:	89 c3                	mov    %eax,%ebx
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	78 1b                	js     8022bd <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8022a2:	83 ec 08             	sub    $0x8,%esp
+  8022a5:	ff 75 0c             	push   0xc(%ebp)
+  8022a8:	50                   	push   %eax
+  8022a9:	e8 5a ff ff ff       	call   802208 <fstat>
+  8022ae:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8022b0:	89 1c 24             	mov    %ebx,(%esp)
+  8022b3:	e8 60 fb ff ff       	call   801e18 <close>
+	return r;
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	89 f3                	mov    %esi,%ebx
+}
+  8022bd:	89 d8                	mov    %ebx,%eax
+  8022bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c2:	5b                   	pop    %ebx
+  8022c3:	5e                   	pop    %esi
+  8022c4:	5d                   	pop    %ebp
+  8022c5:	c3                   	ret
+
+008022c6 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	56                   	push   %esi
+  8022ca:	53                   	push   %ebx
+  8022cb:	89 c6                	mov    %eax,%esi
+  8022cd:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8022cf:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8022d6:	74 27                	je     8022ff <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8022d8:	6a 07                	push   $0x7
+  8022da:	68 00 70 80 00       	push   $0x807000
+  8022df:	56                   	push   %esi
+  8022e0:	ff 35 c4 66 80 00    	push   0x8066c4
+  8022e6:	e8 22 22 00 00       	call   80450d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8022eb:	83 c4 0c             	add    $0xc,%esp
+  8022ee:	6a 00                	push   $0x0
+  8022f0:	53                   	push   %ebx
+  8022f1:	6a 00                	push   $0x0
+  8022f3:	e8 85 1f 00 00       	call   80427d <ipc_recv>
+}
+  8022f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022fb:	5b                   	pop    %ebx
+  8022fc:	5e                   	pop    %esi
+  8022fd:	5d                   	pop    %ebp
+  8022fe:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022ff:	83 ec 0c             	sub    $0xc,%esp
+  802302:	6a 02                	push   $0x2
+  802304:	e8 6d 22 00 00       	call   804576 <ipc_find_env>
+  802309:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	eb c5                	jmp    8022d8 <fsipc+0x12>
+
+00802313 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80231f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802324:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802327:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80232c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802331:	b8 02 00 00 00       	mov    $0x2,%eax
+  802336:	e8 8b ff ff ff       	call   8022c6 <fsipc>
+}
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+0080233d <devfile_flush>:
+{
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802343:	8b 45 08             	mov    0x8(%ebp),%eax
+  802346:	8b 40 0c             	mov    0xc(%eax),%eax
+  802349:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80234e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802353:	b8 06 00 00 00       	mov    $0x6,%eax
+  802358:	e8 69 ff ff ff       	call   8022c6 <fsipc>
+}
+  80235d:	c9                   	leave
+  80235e:	c3                   	ret
+
+0080235f <devfile_stat>:
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	53                   	push   %ebx
+  802363:	83 ec 04             	sub    $0x4,%esp
+  802366:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80236f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802374:	ba 00 00 00 00       	mov    $0x0,%edx
+  802379:	b8 05 00 00 00       	mov    $0x5,%eax
+  80237e:	e8 43 ff ff ff       	call   8022c6 <fsipc>
+  802383:	85 c0                	test   %eax,%eax
+  802385:	78 37                	js     8023be <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802387:	83 ec 08             	sub    $0x8,%esp
+  80238a:	68 00 70 80 00       	push   $0x807000
+  80238f:	53                   	push   %ebx
+  802390:	e8 b4 e8 ff ff       	call   800c49 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802395:	a1 80 70 80 00       	mov    0x807080,%eax
+  80239a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023a0:	a1 84 70 80 00       	mov    0x807084,%eax
+  8023a5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8023ab:	a1 88 70 80 00       	mov    0x807088,%eax
+  8023b0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8023b6:	83 c4 10             	add    $0x10,%esp
+  8023b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023c1:	c9                   	leave
+  8023c2:	c3                   	ret
+
+008023c3 <devfile_write>:
+{
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	83 ec 0c             	sub    $0xc,%esp
+  8023c9:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8023cc:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8023d1:	39 d0                	cmp    %edx,%eax
+  8023d3:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023d9:	8b 52 0c             	mov    0xc(%edx),%edx
+  8023dc:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8023e2:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8023e7:	50                   	push   %eax
+  8023e8:	ff 75 0c             	push   0xc(%ebp)
+  8023eb:	68 08 70 80 00       	push   $0x807008
+  8023f0:	e8 04 ea ff ff       	call   800df9 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8023f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023ff:	e8 c2 fe ff ff       	call   8022c6 <fsipc>
+}
+  802404:	c9                   	leave
+  802405:	c3                   	ret
+
+00802406 <devfile_read>:
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	53                   	push   %ebx
+  80240a:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80240d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802410:	8b 40 0c             	mov    0xc(%eax),%eax
+  802413:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802418:	8b 45 10             	mov    0x10(%ebp),%eax
+  80241b:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802420:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802425:	b8 03 00 00 00       	mov    $0x3,%eax
+  80242a:	e8 97 fe ff ff       	call   8022c6 <fsipc>
+  80242f:	89 c3                	mov    %eax,%ebx
+  802431:	85 c0                	test   %eax,%eax
+  802433:	78 14                	js     802449 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802435:	83 ec 04             	sub    $0x4,%esp
+  802438:	50                   	push   %eax
+  802439:	68 00 70 80 00       	push   $0x807000
+  80243e:	ff 75 0c             	push   0xc(%ebp)
+  802441:	e8 b3 e9 ff ff       	call   800df9 <memmove>
+	return r;
+  802446:	83 c4 10             	add    $0x10,%esp
+}
+  802449:	89 d8                	mov    %ebx,%eax
+  80244b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80244e:	c9                   	leave
+  80244f:	c3                   	ret
+
+00802450 <open>:
+{
+  802450:	55                   	push   %ebp
+  802451:	89 e5                	mov    %esp,%ebp
+  802453:	53                   	push   %ebx
+  802454:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802457:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80245a:	50                   	push   %eax
+  80245b:	e8 23 f8 ff ff       	call   801c83 <fd_alloc>
+  802460:	89 c3                	mov    %eax,%ebx
+  802462:	83 c4 10             	add    $0x10,%esp
+  802465:	85 c0                	test   %eax,%eax
+  802467:	78 2a                	js     802493 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802469:	83 ec 0c             	sub    $0xc,%esp
+  80246c:	ff 75 08             	push   0x8(%ebp)
+  80246f:	e8 89 e7 ff ff       	call   800bfd <strlen>
+  802474:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802477:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80247c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802481:	7e 17                	jle    80249a <open+0x4a>
+	fd_close(fd, 1);
+  802483:	83 ec 08             	sub    $0x8,%esp
+  802486:	6a 01                	push   $0x1
+  802488:	ff 75 f4             	push   -0xc(%ebp)
+  80248b:	e8 08 f9 ff ff       	call   801d98 <fd_close>
+	return r;
+  802490:	83 c4 10             	add    $0x10,%esp
+}
+  802493:	89 d8                	mov    %ebx,%eax
+  802495:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80249a:	83 ec 08             	sub    $0x8,%esp
+  80249d:	ff 75 08             	push   0x8(%ebp)
+  8024a0:	68 00 70 80 00       	push   $0x807000
+  8024a5:	e8 9f e7 ff ff       	call   800c49 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8024aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ad:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8024b2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024ba:	e8 07 fe ff ff       	call   8022c6 <fsipc>
+  8024bf:	89 c3                	mov    %eax,%ebx
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	85 c0                	test   %eax,%eax
+  8024c6:	78 bb                	js     802483 <open+0x33>
+	return fd2num(fd); 	
+  8024c8:	83 ec 0c             	sub    $0xc,%esp
+  8024cb:	ff 75 f4             	push   -0xc(%ebp)
+  8024ce:	e8 89 f7 ff ff       	call   801c5c <fd2num>
+  8024d3:	89 c3                	mov    %eax,%ebx
+  8024d5:	83 c4 10             	add    $0x10,%esp
+  8024d8:	eb b9                	jmp    802493 <open+0x43>
+
+008024da <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	53                   	push   %ebx
+  8024de:	83 ec 1c             	sub    $0x1c,%esp
+  8024e1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e7:	50                   	push   %eax
+  8024e8:	ff 75 08             	push   0x8(%ebp)
+  8024eb:	e8 e3 f7 ff ff       	call   801cd3 <fd_lookup>
+  8024f0:	83 c4 10             	add    $0x10,%esp
+  8024f3:	85 c0                	test   %eax,%eax
+  8024f5:	78 5a                	js     802551 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8024f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024fa:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802500:	39 10                	cmp    %edx,(%eax)
+  802502:	75 66                	jne    80256a <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802504:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  80250b:	74 49                	je     802556 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80250d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802510:	8b 40 0c             	mov    0xc(%eax),%eax
+  802513:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802518:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80251b:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802520:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802526:	6a 07                	push   $0x7
+  802528:	68 00 70 80 00       	push   $0x807000
+  80252d:	6a 09                	push   $0x9
+  80252f:	ff 35 c4 66 80 00    	push   0x8066c4
+  802535:	e8 d3 1f 00 00       	call   80450d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80253a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802541:	6a 00                	push   $0x0
+  802543:	53                   	push   %ebx
+  802544:	ff 75 10             	push   0x10(%ebp)
+  802547:	6a 00                	push   $0x0
+  802549:	e8 fc 1d 00 00       	call   80434a <ipc_recv_pages>
+  80254e:	83 c4 20             	add    $0x20,%esp
+}
+  802551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802554:	c9                   	leave
+  802555:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802556:	83 ec 0c             	sub    $0xc,%esp
+  802559:	6a 02                	push   $0x2
+  80255b:	e8 16 20 00 00       	call   804576 <ipc_find_env>
+  802560:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802565:	83 c4 10             	add    $0x10,%esp
+  802568:	eb a3                	jmp    80250d <fmap+0x33>
+		return -E_INVAL;
+  80256a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80256f:	eb e0                	jmp    802551 <fmap+0x77>
+
+00802571 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802571:	55                   	push   %ebp
+  802572:	89 e5                	mov    %esp,%ebp
+  802574:	53                   	push   %ebx
+  802575:	83 ec 10             	sub    $0x10,%esp
+  802578:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80257b:	53                   	push   %ebx
+  80257c:	e8 7c e6 ff ff       	call   800bfd <strlen>
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802589:	7f 25                	jg     8025b0 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80258b:	83 ec 08             	sub    $0x8,%esp
+  80258e:	53                   	push   %ebx
+  80258f:	68 00 70 80 00       	push   $0x807000
+  802594:	e8 b0 e6 ff ff       	call   800c49 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802599:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259e:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025a3:	e8 1e fd ff ff       	call   8022c6 <fsipc>
+  8025a8:	83 c4 10             	add    $0x10,%esp
+}
+  8025ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ae:	c9                   	leave
+  8025af:	c3                   	ret
+		return -E_BAD_PATH;
+  8025b0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8025b5:	eb f4                	jmp    8025ab <remove+0x3a>
+
+008025b7 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8025b7:	55                   	push   %ebp
+  8025b8:	89 e5                	mov    %esp,%ebp
+  8025ba:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8025bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025c7:	e8 fa fc ff ff       	call   8022c6 <fsipc>
+}
+  8025cc:	c9                   	leave
+  8025cd:	c3                   	ret
+
+008025ce <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025ce:	55                   	push   %ebp
+  8025cf:	89 e5                	mov    %esp,%ebp
+  8025d1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8025d4:	68 cc 4d 80 00       	push   $0x804dcc
+  8025d9:	ff 75 0c             	push   0xc(%ebp)
+  8025dc:	e8 68 e6 ff ff       	call   800c49 <strcpy>
+	return 0;
+}
+  8025e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e6:	c9                   	leave
+  8025e7:	c3                   	ret
+
+008025e8 <devsock_close>:
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	53                   	push   %ebx
+  8025ec:	83 ec 10             	sub    $0x10,%esp
+  8025ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8025f2:	53                   	push   %ebx
+  8025f3:	e8 bd 1f 00 00       	call   8045b5 <pageref>
+  8025f8:	89 c2                	mov    %eax,%edx
+  8025fa:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802602:	83 fa 01             	cmp    $0x1,%edx
+  802605:	74 05                	je     80260c <devsock_close+0x24>
+}
+  802607:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80260a:	c9                   	leave
+  80260b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80260c:	83 ec 0c             	sub    $0xc,%esp
+  80260f:	ff 73 0c             	push   0xc(%ebx)
+  802612:	e8 b0 05 00 00       	call   802bc7 <nsipc_close>
+  802617:	83 c4 10             	add    $0x10,%esp
+  80261a:	eb eb                	jmp    802607 <devsock_close+0x1f>
+
+0080261c <devsock_write>:
+{
+  80261c:	55                   	push   %ebp
+  80261d:	89 e5                	mov    %esp,%ebp
+  80261f:	53                   	push   %ebx
+  802620:	83 ec 14             	sub    $0x14,%esp
+  802623:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802626:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802629:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80262c:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80262f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802632:	8b 41 08             	mov    0x8(%ecx),%eax
+  802635:	c1 f8 09             	sar    $0x9,%eax
+  802638:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80263b:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802641:	77 13                	ja     802656 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802643:	50                   	push   %eax
+  802644:	52                   	push   %edx
+  802645:	53                   	push   %ebx
+  802646:	ff 71 0c             	push   0xc(%ecx)
+  802649:	e8 5c 06 00 00       	call   802caa <nsipc_send>
+  80264e:	83 c4 10             	add    $0x10,%esp
+}
+  802651:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802654:	c9                   	leave
+  802655:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802656:	50                   	push   %eax
+  802657:	6a 01                	push   $0x1
+  802659:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80265c:	50                   	push   %eax
+  80265d:	ff 71 0c             	push   0xc(%ecx)
+  802660:	e8 a6 06 00 00       	call   802d0b <nsipc_sendmsg>
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	eb e7                	jmp    802651 <devsock_write+0x35>
+
+0080266a <devsock_read>:
+{
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+  80266d:	53                   	push   %ebx
+  80266e:	83 ec 14             	sub    $0x14,%esp
+  802671:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802674:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802677:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80267a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80267d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802680:	8b 41 08             	mov    0x8(%ecx),%eax
+  802683:	c1 f8 09             	sar    $0x9,%eax
+  802686:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802689:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80268f:	77 13                	ja     8026a4 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802691:	50                   	push   %eax
+  802692:	52                   	push   %edx
+  802693:	53                   	push   %ebx
+  802694:	ff 71 0c             	push   0xc(%ecx)
+  802697:	e8 9c 05 00 00       	call   802c38 <nsipc_recv>
+  80269c:	83 c4 10             	add    $0x10,%esp
+}
+  80269f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a2:	c9                   	leave
+  8026a3:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8026a4:	50                   	push   %eax
+  8026a5:	6a 01                	push   $0x1
+  8026a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026aa:	50                   	push   %eax
+  8026ab:	ff 71 0c             	push   0xc(%ecx)
+  8026ae:	e8 02 0a 00 00       	call   8030b5 <nsipc_recvmsg>
+  8026b3:	83 c4 10             	add    $0x10,%esp
+  8026b6:	eb e7                	jmp    80269f <devsock_read+0x35>
+
+008026b8 <fd2sockid>:
+{
+  8026b8:	55                   	push   %ebp
+  8026b9:	89 e5                	mov    %esp,%ebp
+  8026bb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026be:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026c1:	52                   	push   %edx
+  8026c2:	50                   	push   %eax
+  8026c3:	e8 0b f6 ff ff       	call   801cd3 <fd_lookup>
+  8026c8:	83 c4 10             	add    $0x10,%esp
+  8026cb:	85 c0                	test   %eax,%eax
+  8026cd:	78 10                	js     8026df <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d2:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8026d8:	39 08                	cmp    %ecx,(%eax)
+  8026da:	75 05                	jne    8026e1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8026dc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026df:	c9                   	leave
+  8026e0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026e1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026e6:	eb f7                	jmp    8026df <fd2sockid+0x27>
+
+008026e8 <sock_flags>:
+{
+  8026e8:	55                   	push   %ebp
+  8026e9:	89 e5                	mov    %esp,%ebp
+  8026eb:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8026ee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026f1:	52                   	push   %edx
+  8026f2:	50                   	push   %eax
+  8026f3:	e8 db f5 ff ff       	call   801cd3 <fd_lookup>
+  8026f8:	83 c4 10             	add    $0x10,%esp
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	78 0e                	js     80270d <sock_flags+0x25>
+  8026ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802702:	8b 40 08             	mov    0x8(%eax),%eax
+  802705:	c1 e8 09             	shr    $0x9,%eax
+  802708:	83 e0 08             	and    $0x8,%eax
+}
+  80270b:	c9                   	leave
+  80270c:	c3                   	ret
+		return 0;
+  80270d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802712:	eb f7                	jmp    80270b <sock_flags+0x23>
+
+00802714 <alloc_sockfd>:
+{
+  802714:	55                   	push   %ebp
+  802715:	89 e5                	mov    %esp,%ebp
+  802717:	56                   	push   %esi
+  802718:	53                   	push   %ebx
+  802719:	83 ec 1c             	sub    $0x1c,%esp
+  80271c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80271e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802721:	50                   	push   %eax
+  802722:	e8 5c f5 ff ff       	call   801c83 <fd_alloc>
+  802727:	89 c3                	mov    %eax,%ebx
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	85 c0                	test   %eax,%eax
+  80272e:	78 43                	js     802773 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802730:	83 ec 04             	sub    $0x4,%esp
+  802733:	68 07 04 00 00       	push   $0x407
+  802738:	ff 75 f4             	push   -0xc(%ebp)
+  80273b:	6a 00                	push   $0x0
+  80273d:	e8 3b e9 ff ff       	call   80107d <sys_page_alloc>
+  802742:	89 c3                	mov    %eax,%ebx
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	85 c0                	test   %eax,%eax
+  802749:	78 28                	js     802773 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80274b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80274e:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802754:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802756:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802759:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802760:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802763:	83 ec 0c             	sub    $0xc,%esp
+  802766:	50                   	push   %eax
+  802767:	e8 f0 f4 ff ff       	call   801c5c <fd2num>
+  80276c:	89 c3                	mov    %eax,%ebx
+  80276e:	83 c4 10             	add    $0x10,%esp
+  802771:	eb 0c                	jmp    80277f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802773:	83 ec 0c             	sub    $0xc,%esp
+  802776:	56                   	push   %esi
+  802777:	e8 4b 04 00 00       	call   802bc7 <nsipc_close>
+		return r;
+  80277c:	83 c4 10             	add    $0x10,%esp
+}
+  80277f:	89 d8                	mov    %ebx,%eax
+  802781:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802784:	5b                   	pop    %ebx
+  802785:	5e                   	pop    %esi
+  802786:	5d                   	pop    %ebp
+  802787:	c3                   	ret
+
+00802788 <accept>:
+{
+  802788:	55                   	push   %ebp
+  802789:	89 e5                	mov    %esp,%ebp
+  80278b:	56                   	push   %esi
+  80278c:	53                   	push   %ebx
+  80278d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802790:	89 f0                	mov    %esi,%eax
+  802792:	e8 21 ff ff ff       	call   8026b8 <fd2sockid>
+  802797:	89 c3                	mov    %eax,%ebx
+  802799:	85 c0                	test   %eax,%eax
+  80279b:	78 24                	js     8027c1 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80279d:	89 f0                	mov    %esi,%eax
+  80279f:	e8 44 ff ff ff       	call   8026e8 <sock_flags>
+  8027a4:	50                   	push   %eax
+  8027a5:	ff 75 10             	push   0x10(%ebp)
+  8027a8:	ff 75 0c             	push   0xc(%ebp)
+  8027ab:	53                   	push   %ebx
+  8027ac:	e8 6b 03 00 00       	call   802b1c <nsipc_accept>
+  8027b1:	89 c3                	mov    %eax,%ebx
+  8027b3:	83 c4 10             	add    $0x10,%esp
+  8027b6:	85 c0                	test   %eax,%eax
+  8027b8:	78 07                	js     8027c1 <accept+0x39>
+	return alloc_sockfd(r);
+  8027ba:	e8 55 ff ff ff       	call   802714 <alloc_sockfd>
+  8027bf:	89 c3                	mov    %eax,%ebx
+}
+  8027c1:	89 d8                	mov    %ebx,%eax
+  8027c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c6:	5b                   	pop    %ebx
+  8027c7:	5e                   	pop    %esi
+  8027c8:	5d                   	pop    %ebp
+  8027c9:	c3                   	ret
+
+008027ca <bind>:
+{
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d3:	e8 e0 fe ff ff       	call   8026b8 <fd2sockid>
+  8027d8:	85 c0                	test   %eax,%eax
+  8027da:	78 12                	js     8027ee <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8027dc:	83 ec 04             	sub    $0x4,%esp
+  8027df:	ff 75 10             	push   0x10(%ebp)
+  8027e2:	ff 75 0c             	push   0xc(%ebp)
+  8027e5:	50                   	push   %eax
+  8027e6:	e8 85 03 00 00       	call   802b70 <nsipc_bind>
+  8027eb:	83 c4 10             	add    $0x10,%esp
+}
+  8027ee:	c9                   	leave
+  8027ef:	c3                   	ret
+
+008027f0 <shutdown>:
+{
+  8027f0:	55                   	push   %ebp
+  8027f1:	89 e5                	mov    %esp,%ebp
+  8027f3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f9:	e8 ba fe ff ff       	call   8026b8 <fd2sockid>
+  8027fe:	85 c0                	test   %eax,%eax
+  802800:	78 0f                	js     802811 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802802:	83 ec 08             	sub    $0x8,%esp
+  802805:	ff 75 0c             	push   0xc(%ebp)
+  802808:	50                   	push   %eax
+  802809:	e8 97 03 00 00       	call   802ba5 <nsipc_shutdown>
+  80280e:	83 c4 10             	add    $0x10,%esp
+}
+  802811:	c9                   	leave
+  802812:	c3                   	ret
+
+00802813 <connect>:
+{
+  802813:	55                   	push   %ebp
+  802814:	89 e5                	mov    %esp,%ebp
+  802816:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802819:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281c:	e8 97 fe ff ff       	call   8026b8 <fd2sockid>
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 12                	js     802837 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802825:	83 ec 04             	sub    $0x4,%esp
+  802828:	ff 75 10             	push   0x10(%ebp)
+  80282b:	ff 75 0c             	push   0xc(%ebp)
+  80282e:	50                   	push   %eax
+  80282f:	e8 ad 03 00 00       	call   802be1 <nsipc_connect>
+  802834:	83 c4 10             	add    $0x10,%esp
+}
+  802837:	c9                   	leave
+  802838:	c3                   	ret
+
+00802839 <listen>:
+{
+  802839:	55                   	push   %ebp
+  80283a:	89 e5                	mov    %esp,%ebp
+  80283c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80283f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802842:	e8 71 fe ff ff       	call   8026b8 <fd2sockid>
+  802847:	85 c0                	test   %eax,%eax
+  802849:	78 0f                	js     80285a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80284b:	83 ec 08             	sub    $0x8,%esp
+  80284e:	ff 75 0c             	push   0xc(%ebp)
+  802851:	50                   	push   %eax
+  802852:	e8 bf 03 00 00       	call   802c16 <nsipc_listen>
+  802857:	83 c4 10             	add    $0x10,%esp
+}
+  80285a:	c9                   	leave
+  80285b:	c3                   	ret
+
+0080285c <sendmsg>:
+{
+  80285c:	55                   	push   %ebp
+  80285d:	89 e5                	mov    %esp,%ebp
+  80285f:	57                   	push   %edi
+  802860:	56                   	push   %esi
+  802861:	53                   	push   %ebx
+  802862:	83 ec 0c             	sub    $0xc,%esp
+  802865:	8b 75 08             	mov    0x8(%ebp),%esi
+  802868:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80286b:	89 f0                	mov    %esi,%eax
+  80286d:	e8 46 fe ff ff       	call   8026b8 <fd2sockid>
+  802872:	89 c3                	mov    %eax,%ebx
+  802874:	85 c0                	test   %eax,%eax
+  802876:	78 1c                	js     802894 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802878:	89 f0                	mov    %esi,%eax
+  80287a:	e8 69 fe ff ff       	call   8026e8 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80287f:	0b 45 10             	or     0x10(%ebp),%eax
+  802882:	50                   	push   %eax
+  802883:	ff 77 0c             	push   0xc(%edi)
+  802886:	ff 77 08             	push   0x8(%edi)
+  802889:	53                   	push   %ebx
+  80288a:	e8 7c 04 00 00       	call   802d0b <nsipc_sendmsg>
+  80288f:	89 c3                	mov    %eax,%ebx
+  802891:	83 c4 10             	add    $0x10,%esp
+}
+  802894:	89 d8                	mov    %ebx,%eax
+  802896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802899:	5b                   	pop    %ebx
+  80289a:	5e                   	pop    %esi
+  80289b:	5f                   	pop    %edi
+  80289c:	5d                   	pop    %ebp
+  80289d:	c3                   	ret
+
+0080289e <recvmsg>:
+{
+  80289e:	55                   	push   %ebp
+  80289f:	89 e5                	mov    %esp,%ebp
+  8028a1:	57                   	push   %edi
+  8028a2:	56                   	push   %esi
+  8028a3:	53                   	push   %ebx
+  8028a4:	83 ec 0c             	sub    $0xc,%esp
+  8028a7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028aa:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8028ad:	89 f8                	mov    %edi,%eax
+  8028af:	e8 04 fe ff ff       	call   8026b8 <fd2sockid>
+  8028b4:	89 c3                	mov    %eax,%ebx
+  8028b6:	85 c0                	test   %eax,%eax
+  8028b8:	78 2a                	js     8028e4 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8028ba:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8028c1:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8028c8:	89 f8                	mov    %edi,%eax
+  8028ca:	e8 19 fe ff ff       	call   8026e8 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8028cf:	0b 45 10             	or     0x10(%ebp),%eax
+  8028d2:	50                   	push   %eax
+  8028d3:	ff 76 0c             	push   0xc(%esi)
+  8028d6:	ff 76 08             	push   0x8(%esi)
+  8028d9:	53                   	push   %ebx
+  8028da:	e8 d6 07 00 00       	call   8030b5 <nsipc_recvmsg>
+  8028df:	89 c3                	mov    %eax,%ebx
+  8028e1:	83 c4 10             	add    $0x10,%esp
+}
+  8028e4:	89 d8                	mov    %ebx,%eax
+  8028e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028e9:	5b                   	pop    %ebx
+  8028ea:	5e                   	pop    %esi
+  8028eb:	5f                   	pop    %edi
+  8028ec:	5d                   	pop    %ebp
+  8028ed:	c3                   	ret
+
+008028ee <sendfile>:
+{
+  8028ee:	55                   	push   %ebp
+  8028ef:	89 e5                	mov    %esp,%ebp
+  8028f1:	56                   	push   %esi
+  8028f2:	53                   	push   %ebx
+  8028f3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8028f6:	89 f0                	mov    %esi,%eax
+  8028f8:	e8 bb fd ff ff       	call   8026b8 <fd2sockid>
+  8028fd:	89 c3                	mov    %eax,%ebx
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	78 1f                	js     802922 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802903:	89 f0                	mov    %esi,%eax
+  802905:	e8 de fd ff ff       	call   8026e8 <sock_flags>
+  80290a:	83 ec 0c             	sub    $0xc,%esp
+  80290d:	50                   	push   %eax
+  80290e:	ff 75 14             	push   0x14(%ebp)
+  802911:	ff 75 10             	push   0x10(%ebp)
+  802914:	ff 75 0c             	push   0xc(%ebp)
+  802917:	53                   	push   %ebx
+  802918:	e8 64 06 00 00       	call   802f81 <nsipc_sendfile>
+  80291d:	89 c3                	mov    %eax,%ebx
+  80291f:	83 c4 20             	add    $0x20,%esp
+}
+  802922:	89 d8                	mov    %ebx,%eax
+  802924:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802927:	5b                   	pop    %ebx
+  802928:	5e                   	pop    %esi
+  802929:	5d                   	pop    %ebp
+  80292a:	c3                   	ret
+
+0080292b <evctl>:
+{
+  80292b:	55                   	push   %ebp
+  80292c:	89 e5                	mov    %esp,%ebp
+  80292e:	53                   	push   %ebx
+  80292f:	83 ec 04             	sub    $0x4,%esp
+  802932:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802935:	89 d8                	mov    %ebx,%eax
+  802937:	e8 7c fd ff ff       	call   8026b8 <fd2sockid>
+  80293c:	85 c0                	test   %eax,%eax
+  80293e:	78 10                	js     802950 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802940:	83 ec 04             	sub    $0x4,%esp
+  802943:	53                   	push   %ebx
+  802944:	ff 75 0c             	push   0xc(%ebp)
+  802947:	50                   	push   %eax
+  802948:	e8 d2 0b 00 00       	call   80351f <nsipc_evctl>
+  80294d:	83 c4 10             	add    $0x10,%esp
+}
+  802950:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802953:	c9                   	leave
+  802954:	c3                   	ret
+
+00802955 <evwait>:
+{
+  802955:	55                   	push   %ebp
+  802956:	89 e5                	mov    %esp,%ebp
+  802958:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80295b:	ff 75 10             	push   0x10(%ebp)
+  80295e:	ff 75 0c             	push   0xc(%ebp)
+  802961:	ff 75 08             	push   0x8(%ebp)
+  802964:	e8 e0 0b 00 00       	call   803549 <nsipc_evwait>
+}
+  802969:	c9                   	leave
+  80296a:	c3                   	ret
+
+0080296b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80296b:	55                   	push   %ebp
+  80296c:	89 e5                	mov    %esp,%ebp
+  80296e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802971:	ff 75 10             	push   0x10(%ebp)
+  802974:	ff 75 0c             	push   0xc(%ebp)
+  802977:	ff 75 08             	push   0x8(%ebp)
+  80297a:	e8 31 0c 00 00       	call   8035b0 <nsipc_socket>
+  80297f:	83 c4 10             	add    $0x10,%esp
+  802982:	85 c0                	test   %eax,%eax
+  802984:	78 05                	js     80298b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802986:	e8 89 fd ff ff       	call   802714 <alloc_sockfd>
+}
+  80298b:	c9                   	leave
+  80298c:	c3                   	ret
+
+0080298d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80298d:	55                   	push   %ebp
+  80298e:	89 e5                	mov    %esp,%ebp
+  802990:	53                   	push   %ebx
+  802991:	83 ec 04             	sub    $0x4,%esp
+  802994:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802996:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80299d:	74 26                	je     8029c5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80299f:	6a 07                	push   $0x7
+  8029a1:	68 00 80 80 00       	push   $0x808000
+  8029a6:	53                   	push   %ebx
+  8029a7:	ff 35 e4 69 80 00    	push   0x8069e4
+  8029ad:	e8 5b 1b 00 00       	call   80450d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029b2:	83 c4 0c             	add    $0xc,%esp
+  8029b5:	6a 00                	push   $0x0
+  8029b7:	6a 00                	push   $0x0
+  8029b9:	6a 00                	push   $0x0
+  8029bb:	e8 bd 18 00 00       	call   80427d <ipc_recv>
+}
+  8029c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c3:	c9                   	leave
+  8029c4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029c5:	83 ec 0c             	sub    $0xc,%esp
+  8029c8:	6a 03                	push   $0x3
+  8029ca:	e8 a7 1b 00 00       	call   804576 <ipc_find_env>
+  8029cf:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  8029d4:	83 c4 10             	add    $0x10,%esp
+  8029d7:	eb c6                	jmp    80299f <nsipc+0x12>
+
+008029d9 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8029d9:	55                   	push   %ebp
+  8029da:	89 e5                	mov    %esp,%ebp
+  8029dc:	56                   	push   %esi
+  8029dd:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8029de:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  8029e4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8029e9:	85 f6                	test   %esi,%esi
+  8029eb:	75 33                	jne    802a20 <nsbulk_map+0x47>
+  8029ed:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8029f2:	83 ec 04             	sub    $0x4,%esp
+  8029f5:	6a 07                	push   $0x7
+  8029f7:	53                   	push   %ebx
+  8029f8:	6a 00                	push   $0x0
+  8029fa:	e8 7e e6 ff ff       	call   80107d <sys_page_alloc>
+  8029ff:	83 c4 10             	add    $0x10,%esp
+  802a02:	85 c0                	test   %eax,%eax
+  802a04:	78 1a                	js     802a20 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802a06:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a0c:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802a12:	75 de                	jne    8029f2 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802a14:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802a1b:	00 00 00 
+	return 0;
+  802a1e:	89 f0                	mov    %esi,%eax
+}
+  802a20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a23:	5b                   	pop    %ebx
+  802a24:	5e                   	pop    %esi
+  802a25:	5d                   	pop    %ebp
+  802a26:	c3                   	ret
+
+00802a27 <nsbulk_own>:
+{
+  802a27:	55                   	push   %ebp
+  802a28:	89 e5                	mov    %esp,%ebp
+  802a2a:	57                   	push   %edi
+  802a2b:	56                   	push   %esi
+  802a2c:	53                   	push   %ebx
+  802a2d:	83 ec 0c             	sub    $0xc,%esp
+  802a30:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802a32:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802a35:	85 d2                	test   %edx,%edx
+  802a37:	7f 0e                	jg     802a47 <nsbulk_own+0x20>
+	return 0;
+  802a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3e:	eb 47                	jmp    802a87 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802a40:	83 c3 01             	add    $0x1,%ebx
+  802a43:	39 fb                	cmp    %edi,%ebx
+  802a45:	7d 3b                	jge    802a82 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802a47:	be 01 00 00 00       	mov    $0x1,%esi
+  802a4c:	89 d9                	mov    %ebx,%ecx
+  802a4e:	d3 e6                	shl    %cl,%esi
+  802a50:	89 f0                	mov    %esi,%eax
+  802a52:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802a58:	74 e6                	je     802a40 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802a5a:	83 ec 04             	sub    $0x4,%esp
+  802a5d:	6a 07                	push   $0x7
+  802a5f:	89 d8                	mov    %ebx,%eax
+  802a61:	c1 e0 0c             	shl    $0xc,%eax
+  802a64:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802a69:	50                   	push   %eax
+  802a6a:	6a 00                	push   $0x0
+  802a6c:	e8 0c e6 ff ff       	call   80107d <sys_page_alloc>
+  802a71:	83 c4 10             	add    $0x10,%esp
+  802a74:	85 c0                	test   %eax,%eax
+  802a76:	78 0f                	js     802a87 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802a78:	f7 d6                	not    %esi
+  802a7a:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802a80:	eb be                	jmp    802a40 <nsbulk_own+0x19>
+	return 0;
+  802a82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8a:	5b                   	pop    %ebx
+  802a8b:	5e                   	pop    %esi
+  802a8c:	5f                   	pop    %edi
+  802a8d:	5d                   	pop    %ebp
+  802a8e:	c3                   	ret
+
+00802a8f <nsipc_bulk>:
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	57                   	push   %edi
+  802a93:	56                   	push   %esi
+  802a94:	53                   	push   %ebx
+  802a95:	83 ec 1c             	sub    $0x1c,%esp
+  802a98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a9b:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802a9d:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802aa3:	c1 fb 0c             	sar    $0xc,%ebx
+  802aa6:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802aa9:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802ab0:	74 56                	je     802b08 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802ab2:	85 ff                	test   %edi,%edi
+  802ab4:	7e 24                	jle    802ada <nsipc_bulk+0x4b>
+  802ab6:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802abc:	74 1c                	je     802ada <nsipc_bulk+0x4b>
+  802abe:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802ac4:	c1 e3 0c             	shl    $0xc,%ebx
+  802ac7:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802acc:	0f b6 10             	movzbl (%eax),%edx
+  802acf:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802ad1:	05 00 10 00 00       	add    $0x1000,%eax
+  802ad6:	39 d8                	cmp    %ebx,%eax
+  802ad8:	75 f2                	jne    802acc <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802ada:	83 ec 0c             	sub    $0xc,%esp
+  802add:	56                   	push   %esi
+  802ade:	57                   	push   %edi
+  802adf:	68 00 00 00 e0       	push   $0xe0000000
+  802ae4:	ff 75 e4             	push   -0x1c(%ebp)
+  802ae7:	ff 35 e4 69 80 00    	push   0x8069e4
+  802aed:	e8 4f 1a 00 00       	call   804541 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802af2:	83 c4 1c             	add    $0x1c,%esp
+  802af5:	6a 00                	push   $0x0
+  802af7:	6a 00                	push   $0x0
+  802af9:	6a 00                	push   $0x0
+  802afb:	e8 7d 17 00 00       	call   80427d <ipc_recv>
+}
+  802b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b03:	5b                   	pop    %ebx
+  802b04:	5e                   	pop    %esi
+  802b05:	5f                   	pop    %edi
+  802b06:	5d                   	pop    %ebp
+  802b07:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b08:	83 ec 0c             	sub    $0xc,%esp
+  802b0b:	6a 03                	push   $0x3
+  802b0d:	e8 64 1a 00 00       	call   804576 <ipc_find_env>
+  802b12:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802b17:	83 c4 10             	add    $0x10,%esp
+  802b1a:	eb 96                	jmp    802ab2 <nsipc_bulk+0x23>
+
+00802b1c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802b1c:	55                   	push   %ebp
+  802b1d:	89 e5                	mov    %esp,%ebp
+  802b1f:	53                   	push   %ebx
+  802b20:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b26:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802b2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b2e:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b33:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b38:	e8 50 fe ff ff       	call   80298d <nsipc>
+  802b3d:	89 c3                	mov    %eax,%ebx
+  802b3f:	85 c0                	test   %eax,%eax
+  802b41:	79 07                	jns    802b4a <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b43:	89 d8                	mov    %ebx,%eax
+  802b45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b48:	c9                   	leave
+  802b49:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b4a:	83 ec 04             	sub    $0x4,%esp
+  802b4d:	ff 35 10 80 80 00    	push   0x808010
+  802b53:	68 00 80 80 00       	push   $0x808000
+  802b58:	ff 75 0c             	push   0xc(%ebp)
+  802b5b:	e8 99 e2 ff ff       	call   800df9 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b60:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b66:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b69:	89 10                	mov    %edx,(%eax)
+  802b6b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b6e:	eb d3                	jmp    802b43 <nsipc_accept+0x27>
+
+00802b70 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b70:	55                   	push   %ebp
+  802b71:	89 e5                	mov    %esp,%ebp
+  802b73:	53                   	push   %ebx
+  802b74:	83 ec 08             	sub    $0x8,%esp
+  802b77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b82:	53                   	push   %ebx
+  802b83:	ff 75 0c             	push   0xc(%ebp)
+  802b86:	68 04 80 80 00       	push   $0x808004
+  802b8b:	e8 69 e2 ff ff       	call   800df9 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b90:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802b96:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b9b:	e8 ed fd ff ff       	call   80298d <nsipc>
+}
+  802ba0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+
+00802ba5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ba5:	55                   	push   %ebp
+  802ba6:	89 e5                	mov    %esp,%ebp
+  802ba8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802bab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bae:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802bb3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bb6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802bbb:	b8 03 00 00 00       	mov    $0x3,%eax
+  802bc0:	e8 c8 fd ff ff       	call   80298d <nsipc>
+}
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+
+00802bc7 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802bc7:	55                   	push   %ebp
+  802bc8:	89 e5                	mov    %esp,%ebp
+  802bca:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd0:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802bd5:	b8 04 00 00 00       	mov    $0x4,%eax
+  802bda:	e8 ae fd ff ff       	call   80298d <nsipc>
+}
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+
+00802be1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802be1:	55                   	push   %ebp
+  802be2:	89 e5                	mov    %esp,%ebp
+  802be4:	53                   	push   %ebx
+  802be5:	83 ec 08             	sub    $0x8,%esp
+  802be8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bee:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802bf3:	53                   	push   %ebx
+  802bf4:	ff 75 0c             	push   0xc(%ebp)
+  802bf7:	68 04 80 80 00       	push   $0x808004
+  802bfc:	e8 f8 e1 ff ff       	call   800df9 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c01:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802c07:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c0c:	e8 7c fd ff ff       	call   80298d <nsipc>
+}
+  802c11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c14:	c9                   	leave
+  802c15:	c3                   	ret
+
+00802c16 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802c16:	55                   	push   %ebp
+  802c17:	89 e5                	mov    %esp,%ebp
+  802c19:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802c24:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c27:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802c2c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c31:	e8 57 fd ff ff       	call   80298d <nsipc>
+}
+  802c36:	c9                   	leave
+  802c37:	c3                   	ret
+
+00802c38 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c38:	55                   	push   %ebp
+  802c39:	89 e5                	mov    %esp,%ebp
+  802c3b:	56                   	push   %esi
+  802c3c:	53                   	push   %ebx
+  802c3d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c40:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c43:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802c48:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802c4e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c51:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c56:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c5b:	e8 2d fd ff ff       	call   80298d <nsipc>
+  802c60:	89 c3                	mov    %eax,%ebx
+  802c62:	85 c0                	test   %eax,%eax
+  802c64:	78 22                	js     802c88 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c66:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c6b:	39 c6                	cmp    %eax,%esi
+  802c6d:	0f 4e c6             	cmovle %esi,%eax
+  802c70:	39 c3                	cmp    %eax,%ebx
+  802c72:	7f 1d                	jg     802c91 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c74:	83 ec 04             	sub    $0x4,%esp
+  802c77:	53                   	push   %ebx
+  802c78:	68 00 80 80 00       	push   $0x808000
+  802c7d:	ff 75 0c             	push   0xc(%ebp)
+  802c80:	e8 74 e1 ff ff       	call   800df9 <memmove>
+  802c85:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c88:	89 d8                	mov    %ebx,%eax
+  802c8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c8d:	5b                   	pop    %ebx
+  802c8e:	5e                   	pop    %esi
+  802c8f:	5d                   	pop    %ebp
+  802c90:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c91:	68 d8 4d 80 00       	push   $0x804dd8
+  802c96:	68 ed 4d 80 00       	push   $0x804ded
+  802c9b:	68 b2 00 00 00       	push   $0xb2
+  802ca0:	68 02 4e 80 00       	push   $0x804e02
+  802ca5:	e8 cd d7 ff ff       	call   800477 <_panic>
+
+00802caa <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802caa:	55                   	push   %ebp
+  802cab:	89 e5                	mov    %esp,%ebp
+  802cad:	53                   	push   %ebx
+  802cae:	83 ec 04             	sub    $0x4,%esp
+  802cb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802cb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb7:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802cbc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802cc2:	7f 2e                	jg     802cf2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802cc4:	83 ec 04             	sub    $0x4,%esp
+  802cc7:	53                   	push   %ebx
+  802cc8:	ff 75 0c             	push   0xc(%ebp)
+  802ccb:	68 0c 80 80 00       	push   $0x80800c
+  802cd0:	e8 24 e1 ff ff       	call   800df9 <memmove>
+	nsipcbuf.send.req_size = size;
+  802cd5:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802cdb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cde:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802ce3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ce8:	e8 a0 fc ff ff       	call   80298d <nsipc>
+}
+  802ced:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cf0:	c9                   	leave
+  802cf1:	c3                   	ret
+	assert(size < 1600);
+  802cf2:	68 0e 4e 80 00       	push   $0x804e0e
+  802cf7:	68 ed 4d 80 00       	push   $0x804ded
+  802cfc:	68 bd 00 00 00       	push   $0xbd
+  802d01:	68 02 4e 80 00       	push   $0x804e02
+  802d06:	e8 6c d7 ff ff       	call   800477 <_panic>
+
+00802d0b <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	57                   	push   %edi
+  802d0f:	56                   	push   %esi
+  802d10:	53                   	push   %ebx
+  802d11:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802d14:	e8 c0 fc ff ff       	call   8029d9 <nsbulk_map>
+  802d19:	85 c0                	test   %eax,%eax
+  802d1b:	78 55                	js     802d72 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802d1d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802d24:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802d2b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802d32:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d35:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802d38:	0f 8d 24 02 00 00    	jge    802f62 <nsipc_sendmsg+0x257>
+  802d3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d41:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d44:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802d47:	89 d8                	mov    %ebx,%eax
+  802d49:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d4e:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802d50:	83 ec 0c             	sub    $0xc,%esp
+  802d53:	68 e0 66 80 00       	push   $0x8066e0
+  802d58:	e8 bc 0f 00 00       	call   803d19 <pgbatch_init>
+  802d5d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802d60:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802d62:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802d65:	e9 82 00 00 00       	jmp    802dec <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802d6a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802d6d:	85 db                	test   %ebx,%ebx
+  802d6f:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d75:	5b                   	pop    %ebx
+  802d76:	5e                   	pop    %esi
+  802d77:	5f                   	pop    %edi
+  802d78:	5d                   	pop    %ebp
+  802d79:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802d7a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802d7f:	29 c8                	sub    %ecx,%eax
+  802d81:	39 d0                	cmp    %edx,%eax
+  802d83:	0f 46 d0             	cmovbe %eax,%edx
+  802d86:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802d88:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d8e:	85 ff                	test   %edi,%edi
+  802d90:	0f 49 c7             	cmovns %edi,%eax
+  802d93:	c1 f8 0c             	sar    $0xc,%eax
+  802d96:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d9b:	e8 87 fc ff ff       	call   802a27 <nsbulk_own>
+  802da0:	85 c0                	test   %eax,%eax
+  802da2:	0f 88 17 01 00 00    	js     802ebf <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802da8:	83 ec 04             	sub    $0x4,%esp
+  802dab:	56                   	push   %esi
+  802dac:	ff 75 e0             	push   -0x20(%ebp)
+  802daf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802db2:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802db7:	50                   	push   %eax
+  802db8:	e8 3c e0 ff ff       	call   800df9 <memmove>
+  802dbd:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802dc0:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802dc3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dc6:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802dc9:	0f 84 fd 00 00 00    	je     802ecc <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802dcf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802dd2:	01 f7                	add    %esi,%edi
+  802dd4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802dd7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802dda:	0f 8d 01 01 00 00    	jge    802ee1 <nsipc_sendmsg+0x1d6>
+  802de0:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802de6:	0f 8f f0 00 00 00    	jg     802edc <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802dec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802def:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802df2:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802df5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802df8:	89 c2                	mov    %eax,%edx
+  802dfa:	03 13                	add    (%ebx),%edx
+  802dfc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802dff:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e02:	29 c6                	sub    %eax,%esi
+  802e04:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802e09:	29 f9                	sub    %edi,%ecx
+  802e0b:	39 ce                	cmp    %ecx,%esi
+  802e0d:	89 ca                	mov    %ecx,%edx
+  802e0f:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802e12:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802e15:	89 f9                	mov    %edi,%ecx
+  802e17:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802e1d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e20:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e25:	09 c8                	or     %ecx,%eax
+  802e27:	0f 85 4d ff ff ff    	jne    802d7a <nsipc_sendmsg+0x6f>
+  802e2d:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802e33:	0f 86 41 ff ff ff    	jbe    802d7a <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e39:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e3f:	85 ff                	test   %edi,%edi
+  802e41:	0f 49 c7             	cmovns %edi,%eax
+  802e44:	c1 f8 0c             	sar    $0xc,%eax
+  802e47:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802e49:	89 d1                	mov    %edx,%ecx
+  802e4b:	c1 e9 0c             	shr    $0xc,%ecx
+  802e4e:	01 c8                	add    %ecx,%eax
+  802e50:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e53:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802e56:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802e58:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802e5b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e60:	29 c8                	sub    %ecx,%eax
+  802e62:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802e65:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802e68:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e6f:	89 f9                	mov    %edi,%ecx
+  802e71:	d3 e0                	shl    %cl,%eax
+  802e73:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e79:	83 ec 08             	sub    $0x8,%esp
+  802e7c:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802e7e:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e81:	50                   	push   %eax
+  802e82:	6a 00                	push   $0x0
+  802e84:	56                   	push   %esi
+  802e85:	6a 00                	push   $0x0
+  802e87:	68 e0 66 80 00       	push   $0x8066e0
+  802e8c:	e8 46 0f 00 00       	call   803dd7 <pgbatch_map>
+  802e91:	83 c4 20             	add    $0x20,%esp
+  802e94:	85 c0                	test   %eax,%eax
+  802e96:	0f 88 ce fe ff ff    	js     802d6a <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802e9c:	83 c7 01             	add    $0x1,%edi
+  802e9f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ea5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ea8:	39 c7                	cmp    %eax,%edi
+  802eaa:	75 be                	jne    802e6a <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802eac:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802eaf:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802eb2:	89 d6                	mov    %edx,%esi
+  802eb4:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802eba:	e9 01 ff ff ff       	jmp    802dc0 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802ebf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ec2:	85 db                	test   %ebx,%ebx
+  802ec4:	0f 45 c3             	cmovne %ebx,%eax
+  802ec7:	e9 a6 fe ff ff       	jmp    802d72 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802ecc:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802ed0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802ed7:	e9 f3 fe ff ff       	jmp    802dcf <nsipc_sendmsg+0xc4>
+  802edc:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802edf:	eb 03                	jmp    802ee4 <nsipc_sendmsg+0x1d9>
+  802ee1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802ee4:	83 ec 0c             	sub    $0xc,%esp
+  802ee7:	68 e0 66 80 00       	push   $0x8066e0
+  802eec:	e8 36 0e 00 00       	call   803d27 <pgbatch_flush>
+  802ef1:	83 c4 10             	add    $0x10,%esp
+  802ef4:	85 c0                	test   %eax,%eax
+  802ef6:	78 50                	js     802f48 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802ef8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efb:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802f00:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802f06:	89 fb                	mov    %edi,%ebx
+  802f08:	29 f3                	sub    %esi,%ebx
+  802f0a:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802f10:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f13:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802f18:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802f1d:	89 fa                	mov    %edi,%edx
+  802f1f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802f24:	e8 66 fb ff ff       	call   802a8f <nsipc_bulk>
+  802f29:	85 c0                	test   %eax,%eax
+  802f2b:	78 28                	js     802f55 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802f2d:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802f30:	39 c3                	cmp    %eax,%ebx
+  802f32:	75 0c                	jne    802f40 <nsipc_sendmsg+0x235>
+  802f34:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802f37:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802f3a:	0f 8f f2 fd ff ff    	jg     802d32 <nsipc_sendmsg+0x27>
+		sent += r;
+  802f40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802f43:	e9 2a fe ff ff       	jmp    802d72 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802f48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f4b:	85 db                	test   %ebx,%ebx
+  802f4d:	0f 45 c3             	cmovne %ebx,%eax
+  802f50:	e9 1d fe ff ff       	jmp    802d72 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802f55:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f58:	85 db                	test   %ebx,%ebx
+  802f5a:	0f 45 c3             	cmovne %ebx,%eax
+  802f5d:	e9 10 fe ff ff       	jmp    802d72 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802f62:	83 ec 0c             	sub    $0xc,%esp
+  802f65:	68 e0 66 80 00       	push   $0x8066e0
+  802f6a:	e8 aa 0d 00 00       	call   803d19 <pgbatch_init>
+  802f6f:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802f72:	be 00 00 00 00       	mov    $0x0,%esi
+  802f77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7c:	e9 63 ff ff ff       	jmp    802ee4 <nsipc_sendmsg+0x1d9>
+
+00802f81 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802f81:	55                   	push   %ebp
+  802f82:	89 e5                	mov    %esp,%ebp
+  802f84:	57                   	push   %edi
+  802f85:	56                   	push   %esi
+  802f86:	53                   	push   %ebx
+  802f87:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802f8a:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802f91:	0f 84 c8 00 00 00    	je     80305f <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802f97:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802f9e:	0f 84 e4 00 00 00    	je     803088 <nsipc_sendfile+0x107>
+{
+  802fa4:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802fa9:	89 fb                	mov    %edi,%ebx
+  802fab:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802fae:	0f 83 f0 00 00 00    	jae    8030a4 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802fb4:	89 fa                	mov    %edi,%edx
+  802fb6:	03 55 10             	add    0x10(%ebp),%edx
+  802fb9:	89 d0                	mov    %edx,%eax
+  802fbb:	c1 f8 1f             	sar    $0x1f,%eax
+  802fbe:	c1 e8 14             	shr    $0x14,%eax
+  802fc1:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802fc4:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802fca:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802fcc:	6a 10                	push   $0x10
+  802fce:	68 00 20 01 e0       	push   $0xe0012000
+  802fd3:	52                   	push   %edx
+  802fd4:	ff 75 0c             	push   0xc(%ebp)
+  802fd7:	e8 fe f4 ff ff       	call   8024da <fmap>
+  802fdc:	83 c4 10             	add    $0x10,%esp
+  802fdf:	85 c0                	test   %eax,%eax
+  802fe1:	0f 8e b8 00 00 00    	jle    80309f <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802fe7:	39 c6                	cmp    %eax,%esi
+  802fe9:	0f 8d b5 00 00 00    	jge    8030a4 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802fef:	29 f0                	sub    %esi,%eax
+  802ff1:	8b 55 14             	mov    0x14(%ebp),%edx
+  802ff4:	29 da                	sub    %ebx,%edx
+  802ff6:	39 d0                	cmp    %edx,%eax
+  802ff8:	89 d3                	mov    %edx,%ebx
+  802ffa:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803000:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803005:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80300b:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  803011:	8b 45 18             	mov    0x18(%ebp),%eax
+  803014:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803019:	83 ec 0c             	sub    $0xc,%esp
+  80301c:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80301e:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803025:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803028:	83 c0 01             	add    $0x1,%eax
+  80302b:	50                   	push   %eax
+  80302c:	68 00 10 01 e0       	push   $0xe0011000
+  803031:	6a 11                	push   $0x11
+  803033:	ff 35 e4 69 80 00    	push   0x8069e4
+  803039:	e8 03 15 00 00       	call   804541 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80303e:	83 c4 1c             	add    $0x1c,%esp
+  803041:	6a 00                	push   $0x0
+  803043:	6a 00                	push   $0x0
+  803045:	6a 00                	push   $0x0
+  803047:	e8 31 12 00 00       	call   80427d <ipc_recv>
+  80304c:	83 c4 10             	add    $0x10,%esp
+  80304f:	85 c0                	test   %eax,%eax
+  803051:	78 5b                	js     8030ae <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803053:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803055:	39 c3                	cmp    %eax,%ebx
+  803057:	0f 8e 4c ff ff ff    	jle    802fa9 <nsipc_sendfile+0x28>
+  80305d:	eb 45                	jmp    8030a4 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80305f:	83 ec 04             	sub    $0x4,%esp
+  803062:	6a 07                	push   $0x7
+  803064:	68 00 10 01 e0       	push   $0xe0011000
+  803069:	6a 00                	push   $0x0
+  80306b:	e8 0d e0 ff ff       	call   80107d <sys_page_alloc>
+  803070:	89 c7                	mov    %eax,%edi
+  803072:	83 c4 10             	add    $0x10,%esp
+  803075:	85 c0                	test   %eax,%eax
+  803077:	78 2b                	js     8030a4 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803079:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  803080:	00 00 00 
+  803083:	e9 0f ff ff ff       	jmp    802f97 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803088:	83 ec 0c             	sub    $0xc,%esp
+  80308b:	6a 03                	push   $0x3
+  80308d:	e8 e4 14 00 00       	call   804576 <ipc_find_env>
+  803092:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  803097:	83 c4 10             	add    $0x10,%esp
+  80309a:	e9 05 ff ff ff       	jmp    802fa4 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80309f:	85 ff                	test   %edi,%edi
+  8030a1:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8030a4:	89 f8                	mov    %edi,%eax
+  8030a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030a9:	5b                   	pop    %ebx
+  8030aa:	5e                   	pop    %esi
+  8030ab:	5f                   	pop    %edi
+  8030ac:	5d                   	pop    %ebp
+  8030ad:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8030ae:	85 ff                	test   %edi,%edi
+  8030b0:	0f 44 f8             	cmove  %eax,%edi
+  8030b3:	eb ef                	jmp    8030a4 <nsipc_sendfile+0x123>
+
+008030b5 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8030b5:	55                   	push   %ebp
+  8030b6:	89 e5                	mov    %esp,%ebp
+  8030b8:	57                   	push   %edi
+  8030b9:	56                   	push   %esi
+  8030ba:	53                   	push   %ebx
+  8030bb:	83 ec 1c             	sub    $0x1c,%esp
+  8030be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8030c1:	e8 13 f9 ff ff       	call   8029d9 <nsbulk_map>
+  8030c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030c9:	85 c0                	test   %eax,%eax
+  8030cb:	0f 88 ba 00 00 00    	js     80318b <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8030d1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030d5:	0f 8e bb 00 00 00    	jle    803196 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8030db:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8030e0:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8030e5:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8030ea:	89 f8                	mov    %edi,%eax
+  8030ec:	29 f0                	sub    %esi,%eax
+  8030ee:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8030f2:	39 c8                	cmp    %ecx,%eax
+  8030f4:	0f 47 c1             	cmova  %ecx,%eax
+  8030f7:	01 f0                	add    %esi,%eax
+  8030f9:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8030fb:	83 c2 01             	add    $0x1,%edx
+  8030fe:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803101:	7e 07                	jle    80310a <nsipc_recvmsg+0x55>
+  803103:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803108:	7e e0                	jle    8030ea <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80310a:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  803110:	c1 fa 0c             	sar    $0xc,%edx
+  803113:	b8 00 00 00 00       	mov    $0x0,%eax
+  803118:	e8 0a f9 ff ff       	call   802a27 <nsbulk_own>
+  80311d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803120:	85 c0                	test   %eax,%eax
+  803122:	78 67                	js     80318b <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803124:	8b 45 08             	mov    0x8(%ebp),%eax
+  803127:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80312c:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803132:	8b 45 14             	mov    0x14(%ebp),%eax
+  803135:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80313a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80313f:	89 f2                	mov    %esi,%edx
+  803141:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803146:	e8 44 f9 ff ff       	call   802a8f <nsipc_bulk>
+  80314b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80314e:	85 c0                	test   %eax,%eax
+  803150:	78 39                	js     80318b <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803152:	39 f0                	cmp    %esi,%eax
+  803154:	7f 4a                	jg     8031a0 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803156:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	7e 2c                	jle    80318b <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80315f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803162:	29 fe                	sub    %edi,%esi
+  803164:	8b 43 04             	mov    0x4(%ebx),%eax
+  803167:	39 c6                	cmp    %eax,%esi
+  803169:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80316c:	83 ec 04             	sub    $0x4,%esp
+  80316f:	56                   	push   %esi
+  803170:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803176:	50                   	push   %eax
+  803177:	ff 33                	push   (%ebx)
+  803179:	e8 7b dc ff ff       	call   800df9 <memmove>
+		n += m;
+  80317e:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803180:	83 c3 08             	add    $0x8,%ebx
+  803183:	83 c4 10             	add    $0x10,%esp
+  803186:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803189:	7f d4                	jg     80315f <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80318b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80318e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803191:	5b                   	pop    %ebx
+  803192:	5e                   	pop    %esi
+  803193:	5f                   	pop    %edi
+  803194:	5d                   	pop    %ebp
+  803195:	c3                   	ret
+	int r, i, n, len = 0;
+  803196:	be 00 00 00 00       	mov    $0x0,%esi
+  80319b:	e9 6a ff ff ff       	jmp    80310a <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8031a0:	68 e4 4d 80 00       	push   $0x804de4
+  8031a5:	68 ed 4d 80 00       	push   $0x804ded
+  8031aa:	68 3b 01 00 00       	push   $0x13b
+  8031af:	68 02 4e 80 00       	push   $0x804e02
+  8031b4:	e8 be d2 ff ff       	call   800477 <_panic>
+
+008031b9 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8031b9:	55                   	push   %ebp
+  8031ba:	89 e5                	mov    %esp,%ebp
+  8031bc:	57                   	push   %edi
+  8031bd:	56                   	push   %esi
+  8031be:	53                   	push   %ebx
+  8031bf:	83 ec 0c             	sub    $0xc,%esp
+  8031c2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8031c5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8031c8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8031cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ce:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8031d3:	8b 07                	mov    (%edi),%eax
+  8031d5:	a3 04 80 80 00       	mov    %eax,0x808004
+  8031da:	8b 47 04             	mov    0x4(%edi),%eax
+  8031dd:	a3 08 80 80 00       	mov    %eax,0x808008
+  8031e2:	8b 47 08             	mov    0x8(%edi),%eax
+  8031e5:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8031ea:	8b 47 0c             	mov    0xc(%edi),%eax
+  8031ed:	a3 10 80 80 00       	mov    %eax,0x808010
+  8031f2:	8b 47 10             	mov    0x10(%edi),%eax
+  8031f5:	a3 14 80 80 00       	mov    %eax,0x808014
+  8031fa:	8b 47 14             	mov    0x14(%edi),%eax
+  8031fd:	a3 18 80 80 00       	mov    %eax,0x808018
+  803202:	8b 47 18             	mov    0x18(%edi),%eax
+  803205:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  80320a:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80320d:	a3 20 80 80 00       	mov    %eax,0x808020
+  803212:	8b 47 20             	mov    0x20(%edi),%eax
+  803215:	a3 24 80 80 00       	mov    %eax,0x808024
+  80321a:	8b 47 24             	mov    0x24(%edi),%eax
+  80321d:	a3 28 80 80 00       	mov    %eax,0x808028
+  803222:	8b 47 28             	mov    0x28(%edi),%eax
+  803225:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80322a:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80322d:	a3 30 80 80 00       	mov    %eax,0x808030
+  803232:	8b 47 30             	mov    0x30(%edi),%eax
+  803235:	a3 34 80 80 00       	mov    %eax,0x808034
+  80323a:	8b 47 34             	mov    0x34(%edi),%eax
+  80323d:	a3 38 80 80 00       	mov    %eax,0x808038
+  803242:	8b 47 38             	mov    0x38(%edi),%eax
+  803245:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  80324a:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80324d:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803252:	8b 06                	mov    (%esi),%eax
+  803254:	a3 44 80 80 00       	mov    %eax,0x808044
+  803259:	8b 46 04             	mov    0x4(%esi),%eax
+  80325c:	a3 48 80 80 00       	mov    %eax,0x808048
+  803261:	8b 46 08             	mov    0x8(%esi),%eax
+  803264:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  803269:	8b 46 0c             	mov    0xc(%esi),%eax
+  80326c:	a3 50 80 80 00       	mov    %eax,0x808050
+  803271:	8b 46 10             	mov    0x10(%esi),%eax
+  803274:	a3 54 80 80 00       	mov    %eax,0x808054
+  803279:	8b 46 14             	mov    0x14(%esi),%eax
+  80327c:	a3 58 80 80 00       	mov    %eax,0x808058
+  803281:	8b 46 18             	mov    0x18(%esi),%eax
+  803284:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803289:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80328c:	a3 60 80 80 00       	mov    %eax,0x808060
+  803291:	8b 46 20             	mov    0x20(%esi),%eax
+  803294:	a3 64 80 80 00       	mov    %eax,0x808064
+  803299:	8b 46 24             	mov    0x24(%esi),%eax
+  80329c:	a3 68 80 80 00       	mov    %eax,0x808068
+  8032a1:	8b 46 28             	mov    0x28(%esi),%eax
+  8032a4:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8032a9:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8032ac:	a3 70 80 80 00       	mov    %eax,0x808070
+  8032b1:	8b 46 30             	mov    0x30(%esi),%eax
+  8032b4:	a3 74 80 80 00       	mov    %eax,0x808074
+  8032b9:	8b 46 34             	mov    0x34(%esi),%eax
+  8032bc:	a3 78 80 80 00       	mov    %eax,0x808078
+  8032c1:	8b 46 38             	mov    0x38(%esi),%eax
+  8032c4:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8032c9:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8032cc:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8032d1:	8b 03                	mov    (%ebx),%eax
+  8032d3:	a3 84 80 80 00       	mov    %eax,0x808084
+  8032d8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8032db:	a3 88 80 80 00       	mov    %eax,0x808088
+  8032e0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8032e3:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8032e8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8032eb:	a3 90 80 80 00       	mov    %eax,0x808090
+  8032f0:	8b 43 10             	mov    0x10(%ebx),%eax
+  8032f3:	a3 94 80 80 00       	mov    %eax,0x808094
+  8032f8:	8b 43 14             	mov    0x14(%ebx),%eax
+  8032fb:	a3 98 80 80 00       	mov    %eax,0x808098
+  803300:	8b 43 18             	mov    0x18(%ebx),%eax
+  803303:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803308:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80330b:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  803310:	8b 43 20             	mov    0x20(%ebx),%eax
+  803313:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803318:	8b 43 24             	mov    0x24(%ebx),%eax
+  80331b:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  803320:	8b 43 28             	mov    0x28(%ebx),%eax
+  803323:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803328:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  80332b:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  803330:	8b 43 30             	mov    0x30(%ebx),%eax
+  803333:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803338:	8b 43 34             	mov    0x34(%ebx),%eax
+  80333b:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  803340:	8b 43 38             	mov    0x38(%ebx),%eax
+  803343:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803348:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80334b:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  803350:	8b 45 18             	mov    0x18(%ebp),%eax
+  803353:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803358:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80335d:	e8 2b f6 ff ff       	call   80298d <nsipc>
+  803362:	85 c0                	test   %eax,%eax
+  803364:	0f 88 ad 01 00 00    	js     803517 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80336a:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803370:	89 17                	mov    %edx,(%edi)
+  803372:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803378:	89 57 04             	mov    %edx,0x4(%edi)
+  80337b:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803381:	89 57 08             	mov    %edx,0x8(%edi)
+  803384:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80338a:	89 57 0c             	mov    %edx,0xc(%edi)
+  80338d:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803393:	89 57 10             	mov    %edx,0x10(%edi)
+  803396:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80339c:	89 57 14             	mov    %edx,0x14(%edi)
+  80339f:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8033a5:	89 57 18             	mov    %edx,0x18(%edi)
+  8033a8:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8033ae:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8033b1:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8033b7:	89 57 20             	mov    %edx,0x20(%edi)
+  8033ba:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8033c0:	89 57 24             	mov    %edx,0x24(%edi)
+  8033c3:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8033c9:	89 57 28             	mov    %edx,0x28(%edi)
+  8033cc:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8033d2:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8033d5:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8033db:	89 57 30             	mov    %edx,0x30(%edi)
+  8033de:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8033e4:	89 57 34             	mov    %edx,0x34(%edi)
+  8033e7:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8033ed:	89 57 38             	mov    %edx,0x38(%edi)
+  8033f0:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8033f6:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8033f9:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8033ff:	89 16                	mov    %edx,(%esi)
+  803401:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803407:	89 56 04             	mov    %edx,0x4(%esi)
+  80340a:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  803410:	89 56 08             	mov    %edx,0x8(%esi)
+  803413:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803419:	89 56 0c             	mov    %edx,0xc(%esi)
+  80341c:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  803422:	89 56 10             	mov    %edx,0x10(%esi)
+  803425:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  80342b:	89 56 14             	mov    %edx,0x14(%esi)
+  80342e:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803434:	89 56 18             	mov    %edx,0x18(%esi)
+  803437:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  80343d:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803440:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803446:	89 56 20             	mov    %edx,0x20(%esi)
+  803449:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80344f:	89 56 24             	mov    %edx,0x24(%esi)
+  803452:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803458:	89 56 28             	mov    %edx,0x28(%esi)
+  80345b:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803461:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803464:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  80346a:	89 56 30             	mov    %edx,0x30(%esi)
+  80346d:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803473:	89 56 34             	mov    %edx,0x34(%esi)
+  803476:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80347c:	89 56 38             	mov    %edx,0x38(%esi)
+  80347f:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803485:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803488:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80348e:	89 13                	mov    %edx,(%ebx)
+  803490:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803496:	89 53 04             	mov    %edx,0x4(%ebx)
+  803499:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80349f:	89 53 08             	mov    %edx,0x8(%ebx)
+  8034a2:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8034a8:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8034ab:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8034b1:	89 53 10             	mov    %edx,0x10(%ebx)
+  8034b4:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8034ba:	89 53 14             	mov    %edx,0x14(%ebx)
+  8034bd:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8034c3:	89 53 18             	mov    %edx,0x18(%ebx)
+  8034c6:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8034cc:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8034cf:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8034d5:	89 53 20             	mov    %edx,0x20(%ebx)
+  8034d8:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8034de:	89 53 24             	mov    %edx,0x24(%ebx)
+  8034e1:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8034e7:	89 53 28             	mov    %edx,0x28(%ebx)
+  8034ea:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8034f0:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8034f3:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8034f9:	89 53 30             	mov    %edx,0x30(%ebx)
+  8034fc:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  803502:	89 53 34             	mov    %edx,0x34(%ebx)
+  803505:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  80350b:	89 53 38             	mov    %edx,0x38(%ebx)
+  80350e:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803514:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803517:	83 c4 0c             	add    $0xc,%esp
+  80351a:	5b                   	pop    %ebx
+  80351b:	5e                   	pop    %esi
+  80351c:	5f                   	pop    %edi
+  80351d:	5d                   	pop    %ebp
+  80351e:	c3                   	ret
+
+0080351f <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803525:	8b 45 08             	mov    0x8(%ebp),%eax
+  803528:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  80352d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803530:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803535:	8b 45 10             	mov    0x10(%ebp),%eax
+  803538:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  80353d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803542:	e8 46 f4 ff ff       	call   80298d <nsipc>
+}
+  803547:	c9                   	leave
+  803548:	c3                   	ret
+
+00803549 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803549:	55                   	push   %ebp
+  80354a:	89 e5                	mov    %esp,%ebp
+  80354c:	56                   	push   %esi
+  80354d:	53                   	push   %ebx
+  80354e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803551:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803557:	8b 45 10             	mov    0x10(%ebp),%eax
+  80355a:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80355f:	b8 10 00 00 00       	mov    $0x10,%eax
+  803564:	e8 24 f4 ff ff       	call   80298d <nsipc>
+  803569:	89 c3                	mov    %eax,%ebx
+  80356b:	85 c0                	test   %eax,%eax
+  80356d:	7e 1f                	jle    80358e <nsipc_evwait+0x45>
+		assert(r <= max);
+  80356f:	39 c6                	cmp    %eax,%esi
+  803571:	7c 24                	jl     803597 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803573:	83 ec 04             	sub    $0x4,%esp
+  803576:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80357d:	50                   	push   %eax
+  80357e:	68 00 80 80 00       	push   $0x808000
+  803583:	ff 75 08             	push   0x8(%ebp)
+  803586:	e8 6e d8 ff ff       	call   800df9 <memmove>
+  80358b:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80358e:	89 d8                	mov    %ebx,%eax
+  803590:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803593:	5b                   	pop    %ebx
+  803594:	5e                   	pop    %esi
+  803595:	5d                   	pop    %ebp
+  803596:	c3                   	ret
+		assert(r <= max);
+  803597:	68 1a 4e 80 00       	push   $0x804e1a
+  80359c:	68 ed 4d 80 00       	push   $0x804ded
+  8035a1:	68 6a 01 00 00       	push   $0x16a
+  8035a6:	68 02 4e 80 00       	push   $0x804e02
+  8035ab:	e8 c7 ce ff ff       	call   800477 <_panic>
+
+008035b0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8035b0:	55                   	push   %ebp
+  8035b1:	89 e5                	mov    %esp,%ebp
+  8035b3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8035b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8035be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035c1:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8035c6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035c9:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8035ce:	b8 09 00 00 00       	mov    $0x9,%eax
+  8035d3:	e8 b5 f3 ff ff       	call   80298d <nsipc>
+}
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+
+008035da <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8035da:	55                   	push   %ebp
+  8035db:	89 e5                	mov    %esp,%ebp
+  8035dd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8035e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e3:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8035e8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8035ed:	e8 9b f3 ff ff       	call   80298d <nsipc>
+}
+  8035f2:	c9                   	leave
+  8035f3:	c3                   	ret
+
+008035f4 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8035f4:	55                   	push   %ebp
+  8035f5:	89 e5                	mov    %esp,%ebp
+  8035f7:	53                   	push   %ebx
+  8035f8:	83 ec 04             	sub    $0x4,%esp
+  8035fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8035fe:	b8 12 00 00 00       	mov    $0x12,%eax
+  803603:	e8 85 f3 ff ff       	call   80298d <nsipc>
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	78 50                	js     80365c <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  80360c:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  803612:	89 13                	mov    %edx,(%ebx)
+  803614:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80361a:	89 53 04             	mov    %edx,0x4(%ebx)
+  80361d:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803623:	89 53 08             	mov    %edx,0x8(%ebx)
+  803626:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80362c:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80362f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803635:	89 53 10             	mov    %edx,0x10(%ebx)
+  803638:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80363e:	89 53 14             	mov    %edx,0x14(%ebx)
+  803641:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803647:	89 53 18             	mov    %edx,0x18(%ebx)
+  80364a:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803650:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803653:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803659:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80365c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80365f:	c9                   	leave
+  803660:	c3                   	ret
+
+00803661 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803661:	55                   	push   %ebp
+  803662:	89 e5                	mov    %esp,%ebp
+  803664:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803667:	6a 03                	push   $0x3
+  803669:	e8 08 0f 00 00       	call   804576 <ipc_find_env>
+  80366e:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803673:	8b 45 08             	mov    0x8(%ebp),%eax
+  803676:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80367b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803680:	e8 08 f3 ff ff       	call   80298d <nsipc>
+  803685:	83 c4 10             	add    $0x10,%esp
+  803688:	85 c0                	test   %eax,%eax
+  80368a:	78 0a                	js     803696 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80368c:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803691:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803696:	c9                   	leave
+  803697:	c3                   	ret
+
+00803698 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803698:	55                   	push   %ebp
+  803699:	89 e5                	mov    %esp,%ebp
+  80369b:	57                   	push   %edi
+  80369c:	56                   	push   %esi
+  80369d:	53                   	push   %ebx
+  80369e:	83 ec 1c             	sub    $0x1c,%esp
+  8036a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8036a4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8036a7:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8036ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036b1:	89 e0                	mov    %esp,%eax
+  8036b3:	89 f2                	mov    %esi,%edx
+  8036b5:	29 c2                	sub    %eax,%edx
+  8036b7:	89 d0                	mov    %edx,%eax
+  8036b9:	c1 e8 0f             	shr    $0xf,%eax
+  8036bc:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8036c2:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8036c5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8036cc:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8036cf:	83 ec 0c             	sub    $0xc,%esp
+  8036d2:	ff 75 e0             	push   -0x20(%ebp)
+  8036d5:	e8 db 0e 00 00       	call   8045b5 <pageref>
+  8036da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8036dd:	83 c4 04             	add    $0x4,%esp
+  8036e0:	ff 75 dc             	push   -0x24(%ebp)
+  8036e3:	e8 cd 0e 00 00       	call   8045b5 <pageref>
+  8036e8:	89 e2                	mov    %esp,%edx
+  8036ea:	89 f1                	mov    %esi,%ecx
+  8036ec:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8036ee:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8036f1:	89 ca                	mov    %ecx,%edx
+  8036f3:	c1 ea 0f             	shr    $0xf,%edx
+  8036f6:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8036fc:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8036ff:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  803706:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803709:	39 d7                	cmp    %edx,%edi
+  80370b:	74 40                	je     80374d <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  80370d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803710:	75 9f                	jne    8036b1 <_pipeisclosed+0x19>
+  803712:	89 e2                	mov    %esp,%edx
+  803714:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803719:	29 d0                	sub    %edx,%eax
+  80371b:	89 c2                	mov    %eax,%edx
+  80371d:	c1 ea 0f             	shr    $0xf,%edx
+  803720:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372a:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80372d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803734:	8b 40 58             	mov    0x58(%eax),%eax
+  803737:	6a 01                	push   $0x1
+  803739:	50                   	push   %eax
+  80373a:	57                   	push   %edi
+  80373b:	68 23 4e 80 00       	push   $0x804e23
+  803740:	e8 0d ce ff ff       	call   800552 <cprintf>
+  803745:	83 c4 10             	add    $0x10,%esp
+  803748:	e9 5f ff ff ff       	jmp    8036ac <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80374d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803750:	0f 94 c0             	sete   %al
+  803753:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803756:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803759:	5b                   	pop    %ebx
+  80375a:	5e                   	pop    %esi
+  80375b:	5f                   	pop    %edi
+  80375c:	5d                   	pop    %ebp
+  80375d:	c3                   	ret
+
+0080375e <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80375e:	55                   	push   %ebp
+  80375f:	89 e5                	mov    %esp,%ebp
+  803761:	53                   	push   %ebx
+  803762:	83 ec 0c             	sub    $0xc,%esp
+  803765:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803768:	53                   	push   %ebx
+  803769:	6a 00                	push   $0x0
+  80376b:	e8 92 d9 ff ff       	call   801102 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803770:	89 1c 24             	mov    %ebx,(%esp)
+  803773:	e8 f4 e4 ff ff       	call   801c6c <fd2data>
+  803778:	83 c4 08             	add    $0x8,%esp
+  80377b:	50                   	push   %eax
+  80377c:	6a 00                	push   $0x0
+  80377e:	e8 7f d9 ff ff       	call   801102 <sys_page_unmap>
+}
+  803783:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803786:	c9                   	leave
+  803787:	c3                   	ret
+
+00803788 <devpipe_read>:
+{
+  803788:	55                   	push   %ebp
+  803789:	89 e5                	mov    %esp,%ebp
+  80378b:	57                   	push   %edi
+  80378c:	56                   	push   %esi
+  80378d:	53                   	push   %ebx
+  80378e:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803791:	ff 75 08             	push   0x8(%ebp)
+  803794:	e8 d3 e4 ff ff       	call   801c6c <fd2data>
+  803799:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80379b:	8b 70 04             	mov    0x4(%eax),%esi
+  80379e:	8b 00                	mov    (%eax),%eax
+  8037a0:	83 c4 10             	add    $0x10,%esp
+  8037a3:	39 f0                	cmp    %esi,%eax
+  8037a5:	75 36                	jne    8037dd <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8037a7:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8037aa:	89 da                	mov    %ebx,%edx
+  8037ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037af:	e8 e4 fe ff ff       	call   803698 <_pipeisclosed>
+  8037b4:	85 c0                	test   %eax,%eax
+  8037b6:	0f 85 d4 00 00 00    	jne    803890 <devpipe_read+0x108>
+	asm volatile("lock; xchgl %0, %1" :
+  8037bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037c1:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8037c5:	83 ec 04             	sub    $0x4,%esp
+  8037c8:	6a ff                	push   $0xffffffff
+  8037ca:	56                   	push   %esi
+  8037cb:	57                   	push   %edi
+  8037cc:	e8 aa dc ff ff       	call   80147b <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8037d1:	8b 73 04             	mov    0x4(%ebx),%esi
+  8037d4:	8b 03                	mov    (%ebx),%eax
+  8037d6:	83 c4 10             	add    $0x10,%esp
+  8037d9:	39 c6                	cmp    %eax,%esi
+  8037db:	74 cd                	je     8037aa <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037dd:	8b 73 04             	mov    0x4(%ebx),%esi
+  8037e0:	8b 03                	mov    (%ebx),%eax
+  8037e2:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8037e8:	29 c6                	sub    %eax,%esi
+  8037ea:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037ef:	f7 e6                	mul    %esi
+  8037f1:	c1 ea 0c             	shr    $0xc,%edx
+  8037f4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037fa:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8037fc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037ff:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803803:	8b 0b                	mov    (%ebx),%ecx
+  803805:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80380a:	f7 e1                	mul    %ecx
+  80380c:	c1 ea 0b             	shr    $0xb,%edx
+  80380f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803815:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803817:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80381c:	29 cf                	sub    %ecx,%edi
+  80381e:	39 f7                	cmp    %esi,%edi
+  803820:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803823:	83 ec 04             	sub    $0x4,%esp
+  803826:	57                   	push   %edi
+  803827:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  80382b:	50                   	push   %eax
+  80382c:	ff 75 0c             	push   0xc(%ebp)
+  80382f:	e8 c5 d5 ff ff       	call   800df9 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803834:	83 c4 0c             	add    $0xc,%esp
+  803837:	89 f0                	mov    %esi,%eax
+  803839:	29 f8                	sub    %edi,%eax
+  80383b:	50                   	push   %eax
+  80383c:	8d 43 10             	lea    0x10(%ebx),%eax
+  80383f:	50                   	push   %eax
+  803840:	89 f8                	mov    %edi,%eax
+  803842:	03 45 0c             	add    0xc(%ebp),%eax
+  803845:	50                   	push   %eax
+  803846:	e8 ae d5 ff ff       	call   800df9 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80384b:	8b 0b                	mov    (%ebx),%ecx
+  80384d:	01 f1                	add    %esi,%ecx
+  80384f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803854:	f7 e1                	mul    %ecx
+  803856:	c1 ea 0c             	shr    $0xc,%edx
+  803859:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80385f:	29 c1                	sub    %eax,%ecx
+  803861:	89 0b                	mov    %ecx,(%ebx)
+  803863:	b8 00 00 00 00       	mov    $0x0,%eax
+  803868:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80386c:	83 c4 10             	add    $0x10,%esp
+  80386f:	85 c0                	test   %eax,%eax
+  803871:	75 0a                	jne    80387d <devpipe_read+0xf5>
+	return n;
+  803873:	89 f0                	mov    %esi,%eax
+}
+  803875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803878:	5b                   	pop    %ebx
+  803879:	5e                   	pop    %esi
+  80387a:	5f                   	pop    %edi
+  80387b:	5d                   	pop    %ebp
+  80387c:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80387d:	83 ec 08             	sub    $0x8,%esp
+  803880:	68 00 04 00 00       	push   $0x400
+  803885:	53                   	push   %ebx
+  803886:	e8 12 dc ff ff       	call   80149d <sys_futex_wake>
+  80388b:	83 c4 10             	add    $0x10,%esp
+  80388e:	eb e3                	jmp    803873 <devpipe_read+0xeb>
+			return 0;
+  803890:	b8 00 00 00 00       	mov    $0x0,%eax
+  803895:	eb de                	jmp    803875 <devpipe_read+0xed>
+
+00803897 <devpipe_write>:
+{
+  803897:	55                   	push   %ebp
+  803898:	89 e5                	mov    %esp,%ebp
+  80389a:	57                   	push   %edi
+  80389b:	56                   	push   %esi
+  80389c:	53                   	push   %ebx
+  80389d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8038a0:	ff 75 08             	push   0x8(%ebp)
+  8038a3:	e8 c4 e3 ff ff       	call   801c6c <fd2data>
+  8038a8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8038aa:	83 c4 10             	add    $0x10,%esp
+  8038ad:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038b4:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8038b9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8038bd:	0f 84 43 01 00 00    	je     803a06 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038c3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038c6:	8b 06                	mov    (%esi),%eax
+  8038c8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038ce:	29 c1                	sub    %eax,%ecx
+  8038d0:	89 c8                	mov    %ecx,%eax
+  8038d2:	f7 e7                	mul    %edi
+  8038d4:	c1 ea 0c             	shr    $0xc,%edx
+  8038d7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038dd:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8038df:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8038e5:	75 52                	jne    803939 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8038e7:	89 f2                	mov    %esi,%edx
+  8038e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038ec:	e8 a7 fd ff ff       	call   803698 <_pipeisclosed>
+  8038f1:	85 c0                	test   %eax,%eax
+  8038f3:	0f 85 28 01 00 00    	jne    803a21 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8038f9:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038fb:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038fe:	8b 06                	mov    (%esi),%eax
+  803900:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803906:	29 c1                	sub    %eax,%ecx
+  803908:	89 c8                	mov    %ecx,%eax
+  80390a:	f7 e7                	mul    %edi
+  80390c:	c1 ea 0c             	shr    $0xc,%edx
+  80390f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803915:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803917:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80391d:	75 a4                	jne    8038c3 <devpipe_write+0x2c>
+  80391f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803924:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803928:	83 ec 04             	sub    $0x4,%esp
+  80392b:	6a ff                	push   $0xffffffff
+  80392d:	53                   	push   %ebx
+  80392e:	56                   	push   %esi
+  80392f:	e8 47 db ff ff       	call   80147b <sys_futex_wait>
+}
+  803934:	83 c4 10             	add    $0x10,%esp
+  803937:	eb 8a                	jmp    8038c3 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803939:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80393c:	8b 06                	mov    (%esi),%eax
+  80393e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803944:	29 c1                	sub    %eax,%ecx
+  803946:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80394b:	f7 e1                	mul    %ecx
+  80394d:	c1 ea 0c             	shr    $0xc,%edx
+  803950:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803956:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803958:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80395d:	89 d8                	mov    %ebx,%eax
+  80395f:	29 c8                	sub    %ecx,%eax
+  803961:	8b 55 10             	mov    0x10(%ebp),%edx
+  803964:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803967:	29 ca                	sub    %ecx,%edx
+  803969:	39 d0                	cmp    %edx,%eax
+  80396b:	0f 46 d0             	cmovbe %eax,%edx
+  80396e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803971:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803974:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803979:	f7 e1                	mul    %ecx
+  80397b:	c1 ea 0b             	shr    $0xb,%edx
+  80397e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803984:	89 ca                	mov    %ecx,%edx
+  803986:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803988:	29 d3                	sub    %edx,%ebx
+  80398a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80398d:	39 c3                	cmp    %eax,%ebx
+  80398f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803992:	83 ec 04             	sub    $0x4,%esp
+  803995:	53                   	push   %ebx
+  803996:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803999:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80399c:	51                   	push   %ecx
+  80399d:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8039a1:	50                   	push   %eax
+  8039a2:	e8 52 d4 ff ff       	call   800df9 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8039a7:	83 c4 0c             	add    $0xc,%esp
+  8039aa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8039ad:	29 d8                	sub    %ebx,%eax
+  8039af:	50                   	push   %eax
+  8039b0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8039b3:	01 cb                	add    %ecx,%ebx
+  8039b5:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8039b8:	53                   	push   %ebx
+  8039b9:	8d 46 10             	lea    0x10(%esi),%eax
+  8039bc:	50                   	push   %eax
+  8039bd:	e8 37 d4 ff ff       	call   800df9 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8039c2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8039c8:	01 c1                	add    %eax,%ecx
+  8039ca:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039cf:	f7 e1                	mul    %ecx
+  8039d1:	c1 ea 0c             	shr    $0xc,%edx
+  8039d4:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8039da:	89 ca                	mov    %ecx,%edx
+  8039dc:	29 c2                	sub    %eax,%edx
+  8039de:	89 56 04             	mov    %edx,0x4(%esi)
+  8039e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e6:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8039ea:	83 c4 10             	add    $0x10,%esp
+  8039ed:	85 c0                	test   %eax,%eax
+  8039ef:	75 1a                	jne    803a0b <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8039f1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8039f4:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8039f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039fa:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8039fd:	0f 82 c0 fe ff ff    	jb     8038c3 <devpipe_write+0x2c>
+  803a03:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803a06:	8b 45 10             	mov    0x10(%ebp),%eax
+  803a09:	eb 1b                	jmp    803a26 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803a0b:	83 ec 08             	sub    $0x8,%esp
+  803a0e:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803a13:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803a16:	50                   	push   %eax
+  803a17:	e8 81 da ff ff       	call   80149d <sys_futex_wake>
+  803a1c:	83 c4 10             	add    $0x10,%esp
+  803a1f:	eb d0                	jmp    8039f1 <devpipe_write+0x15a>
+				return 0;
+  803a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a29:	5b                   	pop    %ebx
+  803a2a:	5e                   	pop    %esi
+  803a2b:	5f                   	pop    %edi
+  803a2c:	5d                   	pop    %ebp
+  803a2d:	c3                   	ret
+
+00803a2e <devpipe_stat>:
+{
+  803a2e:	55                   	push   %ebp
+  803a2f:	89 e5                	mov    %esp,%ebp
+  803a31:	56                   	push   %esi
+  803a32:	53                   	push   %ebx
+  803a33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803a36:	83 ec 0c             	sub    $0xc,%esp
+  803a39:	ff 75 08             	push   0x8(%ebp)
+  803a3c:	e8 2b e2 ff ff       	call   801c6c <fd2data>
+  803a41:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803a43:	83 c4 08             	add    $0x8,%esp
+  803a46:	68 36 4e 80 00       	push   $0x804e36
+  803a4b:	53                   	push   %ebx
+  803a4c:	e8 f8 d1 ff ff       	call   800c49 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a51:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a54:	8b 06                	mov    (%esi),%eax
+  803a56:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a5c:	29 c1                	sub    %eax,%ecx
+  803a5e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a63:	89 c8                	mov    %ecx,%eax
+  803a65:	f7 e2                	mul    %edx
+  803a67:	c1 ea 0c             	shr    $0xc,%edx
+  803a6a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a70:	29 d1                	sub    %edx,%ecx
+  803a72:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803a78:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803a7f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803a82:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803a89:	50 80 00 
+}
+  803a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a94:	5b                   	pop    %ebx
+  803a95:	5e                   	pop    %esi
+  803a96:	5d                   	pop    %ebp
+  803a97:	c3                   	ret
+
+00803a98 <devpipe_poll>:
+{
+  803a98:	55                   	push   %ebp
+  803a99:	89 e5                	mov    %esp,%ebp
+  803a9b:	57                   	push   %edi
+  803a9c:	56                   	push   %esi
+  803a9d:	53                   	push   %ebx
+  803a9e:	83 ec 18             	sub    $0x18,%esp
+  803aa1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803aa4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803aa7:	57                   	push   %edi
+  803aa8:	e8 bf e1 ff ff       	call   801c6c <fd2data>
+  803aad:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803aaf:	83 c4 10             	add    $0x10,%esp
+  803ab2:	89 f3                	mov    %esi,%ebx
+  803ab4:	83 e3 01             	and    $0x1,%ebx
+  803ab7:	75 27                	jne    803ae0 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803ab9:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803abf:	75 48                	jne    803b09 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803ac1:	89 ca                	mov    %ecx,%edx
+  803ac3:	89 f8                	mov    %edi,%eax
+  803ac5:	e8 ce fb ff ff       	call   803698 <_pipeisclosed>
+  803aca:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803acc:	89 d8                	mov    %ebx,%eax
+  803ace:	83 c8 10             	or     $0x10,%eax
+  803ad1:	85 d2                	test   %edx,%edx
+  803ad3:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803ad6:	89 d8                	mov    %ebx,%eax
+  803ad8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803adb:	5b                   	pop    %ebx
+  803adc:	5e                   	pop    %esi
+  803add:	5f                   	pop    %edi
+  803ade:	5d                   	pop    %ebp
+  803adf:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ae0:	8b 58 04             	mov    0x4(%eax),%ebx
+  803ae3:	8b 00                	mov    (%eax),%eax
+  803ae5:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803aeb:	29 c3                	sub    %eax,%ebx
+  803aed:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803af2:	89 d8                	mov    %ebx,%eax
+  803af4:	f7 e2                	mul    %edx
+  803af6:	c1 ea 0c             	shr    $0xc,%edx
+  803af9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803aff:	39 d3                	cmp    %edx,%ebx
+  803b01:	0f 95 c3             	setne  %bl
+  803b04:	0f b6 db             	movzbl %bl,%ebx
+  803b07:	eb b0                	jmp    803ab9 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b09:	8b 71 04             	mov    0x4(%ecx),%esi
+  803b0c:	8b 01                	mov    (%ecx),%eax
+  803b0e:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803b14:	29 c6                	sub    %eax,%esi
+  803b16:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b1b:	89 f0                	mov    %esi,%eax
+  803b1d:	f7 e2                	mul    %edx
+  803b1f:	c1 ea 0c             	shr    $0xc,%edx
+  803b22:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b28:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803b2a:	89 d8                	mov    %ebx,%eax
+  803b2c:	83 c8 04             	or     $0x4,%eax
+  803b2f:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803b35:	0f 42 d8             	cmovb  %eax,%ebx
+  803b38:	eb 87                	jmp    803ac1 <devpipe_poll+0x29>
+
+00803b3a <pipe>:
+{
+  803b3a:	55                   	push   %ebp
+  803b3b:	89 e5                	mov    %esp,%ebp
+  803b3d:	56                   	push   %esi
+  803b3e:	53                   	push   %ebx
+  803b3f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803b42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b45:	50                   	push   %eax
+  803b46:	e8 38 e1 ff ff       	call   801c83 <fd_alloc>
+  803b4b:	89 c3                	mov    %eax,%ebx
+  803b4d:	83 c4 10             	add    $0x10,%esp
+  803b50:	85 c0                	test   %eax,%eax
+  803b52:	0f 88 23 01 00 00    	js     803c7b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b58:	83 ec 04             	sub    $0x4,%esp
+  803b5b:	68 07 04 00 00       	push   $0x407
+  803b60:	ff 75 f4             	push   -0xc(%ebp)
+  803b63:	6a 00                	push   $0x0
+  803b65:	e8 13 d5 ff ff       	call   80107d <sys_page_alloc>
+  803b6a:	89 c3                	mov    %eax,%ebx
+  803b6c:	83 c4 10             	add    $0x10,%esp
+  803b6f:	85 c0                	test   %eax,%eax
+  803b71:	0f 88 04 01 00 00    	js     803c7b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803b77:	83 ec 0c             	sub    $0xc,%esp
+  803b7a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b7d:	50                   	push   %eax
+  803b7e:	e8 00 e1 ff ff       	call   801c83 <fd_alloc>
+  803b83:	89 c3                	mov    %eax,%ebx
+  803b85:	83 c4 10             	add    $0x10,%esp
+  803b88:	85 c0                	test   %eax,%eax
+  803b8a:	0f 88 db 00 00 00    	js     803c6b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b90:	83 ec 04             	sub    $0x4,%esp
+  803b93:	68 07 04 00 00       	push   $0x407
+  803b98:	ff 75 f0             	push   -0x10(%ebp)
+  803b9b:	6a 00                	push   $0x0
+  803b9d:	e8 db d4 ff ff       	call   80107d <sys_page_alloc>
+  803ba2:	89 c3                	mov    %eax,%ebx
+  803ba4:	83 c4 10             	add    $0x10,%esp
+  803ba7:	85 c0                	test   %eax,%eax
+  803ba9:	0f 88 bc 00 00 00    	js     803c6b <pipe+0x131>
+	va = fd2data(fd0);
+  803baf:	83 ec 0c             	sub    $0xc,%esp
+  803bb2:	ff 75 f4             	push   -0xc(%ebp)
+  803bb5:	e8 b2 e0 ff ff       	call   801c6c <fd2data>
+  803bba:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bbc:	83 c4 0c             	add    $0xc,%esp
+  803bbf:	68 07 04 00 00       	push   $0x407
+  803bc4:	50                   	push   %eax
+  803bc5:	6a 00                	push   $0x0
+  803bc7:	e8 b1 d4 ff ff       	call   80107d <sys_page_alloc>
+  803bcc:	89 c3                	mov    %eax,%ebx
+  803bce:	83 c4 10             	add    $0x10,%esp
+  803bd1:	85 c0                	test   %eax,%eax
+  803bd3:	0f 88 82 00 00 00    	js     803c5b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bd9:	83 ec 0c             	sub    $0xc,%esp
+  803bdc:	ff 75 f0             	push   -0x10(%ebp)
+  803bdf:	e8 88 e0 ff ff       	call   801c6c <fd2data>
+  803be4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803beb:	50                   	push   %eax
+  803bec:	6a 00                	push   $0x0
+  803bee:	56                   	push   %esi
+  803bef:	6a 00                	push   $0x0
+  803bf1:	e8 ca d4 ff ff       	call   8010c0 <sys_page_map>
+  803bf6:	89 c3                	mov    %eax,%ebx
+  803bf8:	83 c4 20             	add    $0x20,%esp
+  803bfb:	85 c0                	test   %eax,%eax
+  803bfd:	78 4e                	js     803c4d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803bff:	a1 60 50 80 00       	mov    0x805060,%eax
+  803c04:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c07:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803c09:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c0c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803c13:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803c16:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803c18:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803c1b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803c22:	83 ec 0c             	sub    $0xc,%esp
+  803c25:	ff 75 f4             	push   -0xc(%ebp)
+  803c28:	e8 2f e0 ff ff       	call   801c5c <fd2num>
+  803c2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c30:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803c32:	83 c4 04             	add    $0x4,%esp
+  803c35:	ff 75 f0             	push   -0x10(%ebp)
+  803c38:	e8 1f e0 ff ff       	call   801c5c <fd2num>
+  803c3d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c40:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803c43:	83 c4 10             	add    $0x10,%esp
+  803c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c4b:	eb 2e                	jmp    803c7b <pipe+0x141>
+	sys_page_unmap(0, va);
+  803c4d:	83 ec 08             	sub    $0x8,%esp
+  803c50:	56                   	push   %esi
+  803c51:	6a 00                	push   $0x0
+  803c53:	e8 aa d4 ff ff       	call   801102 <sys_page_unmap>
+  803c58:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803c5b:	83 ec 08             	sub    $0x8,%esp
+  803c5e:	ff 75 f0             	push   -0x10(%ebp)
+  803c61:	6a 00                	push   $0x0
+  803c63:	e8 9a d4 ff ff       	call   801102 <sys_page_unmap>
+  803c68:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803c6b:	83 ec 08             	sub    $0x8,%esp
+  803c6e:	ff 75 f4             	push   -0xc(%ebp)
+  803c71:	6a 00                	push   $0x0
+  803c73:	e8 8a d4 ff ff       	call   801102 <sys_page_unmap>
+  803c78:	83 c4 10             	add    $0x10,%esp
+}
+  803c7b:	89 d8                	mov    %ebx,%eax
+  803c7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c80:	5b                   	pop    %ebx
+  803c81:	5e                   	pop    %esi
+  803c82:	5d                   	pop    %ebp
+  803c83:	c3                   	ret
+
+00803c84 <pipeisclosed>:
+{
+  803c84:	55                   	push   %ebp
+  803c85:	89 e5                	mov    %esp,%ebp
+  803c87:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c8d:	50                   	push   %eax
+  803c8e:	ff 75 08             	push   0x8(%ebp)
+  803c91:	e8 3d e0 ff ff       	call   801cd3 <fd_lookup>
+  803c96:	83 c4 10             	add    $0x10,%esp
+  803c99:	85 c0                	test   %eax,%eax
+  803c9b:	78 18                	js     803cb5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c9d:	83 ec 0c             	sub    $0xc,%esp
+  803ca0:	ff 75 f4             	push   -0xc(%ebp)
+  803ca3:	e8 c4 df ff ff       	call   801c6c <fd2data>
+  803ca8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803caa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cad:	e8 e6 f9 ff ff       	call   803698 <_pipeisclosed>
+  803cb2:	83 c4 10             	add    $0x10,%esp
+}
+  803cb5:	c9                   	leave
+  803cb6:	c3                   	ret
+
+00803cb7 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803cb7:	55                   	push   %ebp
+  803cb8:	89 e5                	mov    %esp,%ebp
+  803cba:	56                   	push   %esi
+  803cbb:	53                   	push   %ebx
+  803cbc:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803cbf:	85 f6                	test   %esi,%esi
+  803cc1:	74 40                	je     803d03 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803cc3:	89 f3                	mov    %esi,%ebx
+  803cc5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803ccb:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803cd1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803cd6:	8b 40 48             	mov    0x48(%eax),%eax
+  803cd9:	39 c6                	cmp    %eax,%esi
+  803cdb:	75 1f                	jne    803cfc <wait+0x45>
+  803cdd:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803ce3:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803ce9:	8b 43 54             	mov    0x54(%ebx),%eax
+  803cec:	85 c0                	test   %eax,%eax
+  803cee:	74 0c                	je     803cfc <wait+0x45>
+		sys_yield();
+  803cf0:	e8 69 d3 ff ff       	call   80105e <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803cf5:	8b 43 48             	mov    0x48(%ebx),%eax
+  803cf8:	39 f0                	cmp    %esi,%eax
+  803cfa:	74 ed                	je     803ce9 <wait+0x32>
+}
+  803cfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cff:	5b                   	pop    %ebx
+  803d00:	5e                   	pop    %esi
+  803d01:	5d                   	pop    %ebp
+  803d02:	c3                   	ret
+	assert(envid != 0);
+  803d03:	68 42 4e 80 00       	push   $0x804e42
+  803d08:	68 ed 4d 80 00       	push   $0x804ded
+  803d0d:	6a 09                	push   $0x9
+  803d0f:	68 4d 4e 80 00       	push   $0x804e4d
+  803d14:	e8 5e c7 ff ff       	call   800477 <_panic>
+
+00803d19 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803d19:	55                   	push   %ebp
+  803d1a:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d1f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d25:	5d                   	pop    %ebp
+  803d26:	c3                   	ret
+
+00803d27 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803d27:	55                   	push   %ebp
+  803d28:	89 e5                	mov    %esp,%ebp
+  803d2a:	53                   	push   %ebx
+  803d2b:	83 ec 04             	sub    $0x4,%esp
+  803d2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803d31:	8b 03                	mov    (%ebx),%eax
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	75 05                	jne    803d3c <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803d37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d3a:	c9                   	leave
+  803d3b:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803d3c:	83 ec 08             	sub    $0x8,%esp
+  803d3f:	50                   	push   %eax
+  803d40:	8d 43 04             	lea    0x4(%ebx),%eax
+  803d43:	50                   	push   %eax
+  803d44:	e8 09 d6 ff ff       	call   801352 <sys_page_batch>
+	pb->pb_n = 0;
+  803d49:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803d4f:	83 c4 10             	add    $0x10,%esp
+  803d52:	eb e3                	jmp    803d37 <pgbatch_flush+0x10>
+
+00803d54 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803d54:	55                   	push   %ebp
+  803d55:	89 e5                	mov    %esp,%ebp
+  803d57:	56                   	push   %esi
+  803d58:	53                   	push   %ebx
+  803d59:	89 c3                	mov    %eax,%ebx
+  803d5b:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d5d:	83 38 20             	cmpl   $0x20,(%eax)
+  803d60:	74 2c                	je     803d8e <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803d62:	8b 03                	mov    (%ebx),%eax
+  803d64:	8d 50 01             	lea    0x1(%eax),%edx
+  803d67:	89 13                	mov    %edx,(%ebx)
+  803d69:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803d6c:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803d70:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803d72:	83 ec 04             	sub    $0x4,%esp
+  803d75:	6a 18                	push   $0x18
+  803d77:	6a 00                	push   $0x0
+  803d79:	50                   	push   %eax
+  803d7a:	e8 45 d0 ff ff       	call   800dc4 <memset>
+	return 0;
+  803d7f:	83 c4 10             	add    $0x10,%esp
+  803d82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d8a:	5b                   	pop    %ebx
+  803d8b:	5e                   	pop    %esi
+  803d8c:	5d                   	pop    %ebp
+  803d8d:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d8e:	83 ec 0c             	sub    $0xc,%esp
+  803d91:	50                   	push   %eax
+  803d92:	e8 90 ff ff ff       	call   803d27 <pgbatch_flush>
+  803d97:	83 c4 10             	add    $0x10,%esp
+  803d9a:	85 c0                	test   %eax,%eax
+  803d9c:	79 c4                	jns    803d62 <pgbatch_slot+0xe>
+  803d9e:	eb e7                	jmp    803d87 <pgbatch_slot+0x33>
+
+00803da0 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803da0:	55                   	push   %ebp
+  803da1:	89 e5                	mov    %esp,%ebp
+  803da3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803da6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dac:	e8 a3 ff ff ff       	call   803d54 <pgbatch_slot>
+  803db1:	85 c0                	test   %eax,%eax
+  803db3:	78 20                	js     803dd5 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803db5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803db8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803dbe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dc1:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803dc4:	8b 55 10             	mov    0x10(%ebp),%edx
+  803dc7:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803dca:	8b 55 14             	mov    0x14(%ebp),%edx
+  803dcd:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dd5:	c9                   	leave
+  803dd6:	c3                   	ret
+
+00803dd7 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803dd7:	55                   	push   %ebp
+  803dd8:	89 e5                	mov    %esp,%ebp
+  803dda:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ddd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803de0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803de3:	e8 6c ff ff ff       	call   803d54 <pgbatch_slot>
+  803de8:	85 c0                	test   %eax,%eax
+  803dea:	78 2c                	js     803e18 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803dec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803def:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803df5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803df8:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803dfb:	8b 55 10             	mov    0x10(%ebp),%edx
+  803dfe:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e01:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e04:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803e07:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e0a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e0d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803e10:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e18:	c9                   	leave
+  803e19:	c3                   	ret
+
+00803e1a <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803e1a:	55                   	push   %ebp
+  803e1b:	89 e5                	mov    %esp,%ebp
+  803e1d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e20:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e26:	e8 29 ff ff ff       	call   803d54 <pgbatch_slot>
+  803e2b:	85 c0                	test   %eax,%eax
+  803e2d:	78 1a                	js     803e49 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803e2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e32:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803e38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e3b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e3e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e41:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803e44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e49:	c9                   	leave
+  803e4a:	c3                   	ret
+
+00803e4b <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803e4b:	55                   	push   %ebp
+  803e4c:	89 e5                	mov    %esp,%ebp
+  803e4e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e51:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e57:	e8 f8 fe ff ff       	call   803d54 <pgbatch_slot>
+  803e5c:	85 c0                	test   %eax,%eax
+  803e5e:	78 20                	js     803e80 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803e60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e63:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803e69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e6c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e6f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e72:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e75:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e78:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e80:	c9                   	leave
+  803e81:	c3                   	ret
+
+00803e82 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803e82:	55                   	push   %ebp
+  803e83:	89 e5                	mov    %esp,%ebp
+  803e85:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e88:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e8e:	e8 c1 fe ff ff       	call   803d54 <pgbatch_slot>
+  803e93:	85 c0                	test   %eax,%eax
+  803e95:	78 26                	js     803ebd <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803e97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e9a:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803ea0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ea3:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803ea6:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ea9:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803eac:	8b 55 14             	mov    0x14(%ebp),%edx
+  803eaf:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803eb2:	8b 55 18             	mov    0x18(%ebp),%edx
+  803eb5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ebd:	c9                   	leave
+  803ebe:	c3                   	ret
+
+00803ebf <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803ebf:	55                   	push   %ebp
+  803ec0:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803ec2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ec5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ecb:	5d                   	pop    %ebp
+  803ecc:	c3                   	ret
+
+00803ecd <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803ecd:	55                   	push   %ebp
+  803ece:	89 e5                	mov    %esp,%ebp
+  803ed0:	56                   	push   %esi
+  803ed1:	53                   	push   %ebx
+  803ed2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eda:	ba 01 00 00 00       	mov    $0x1,%edx
+  803edf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803ee3:	85 c0                	test   %eax,%eax
+  803ee5:	74 2f                	je     803f16 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803ee7:	83 f8 02             	cmp    $0x2,%eax
+  803eea:	74 0c                	je     803ef8 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803eec:	b8 02 00 00 00       	mov    $0x2,%eax
+  803ef1:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803ef4:	85 c0                	test   %eax,%eax
+  803ef6:	74 1e                	je     803f16 <mutex_lock+0x49>
+  803ef8:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803efd:	83 ec 04             	sub    $0x4,%esp
+  803f00:	6a ff                	push   $0xffffffff
+  803f02:	6a 02                	push   $0x2
+  803f04:	53                   	push   %ebx
+  803f05:	e8 71 d5 ff ff       	call   80147b <sys_futex_wait>
+  803f0a:	89 f0                	mov    %esi,%eax
+  803f0c:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803f0f:	83 c4 10             	add    $0x10,%esp
+  803f12:	85 c0                	test   %eax,%eax
+  803f14:	75 e7                	jne    803efd <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803f16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f19:	5b                   	pop    %ebx
+  803f1a:	5e                   	pop    %esi
+  803f1b:	5d                   	pop    %ebp
+  803f1c:	c3                   	ret
+
+00803f1d <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803f1d:	55                   	push   %ebp
+  803f1e:	89 e5                	mov    %esp,%ebp
+  803f20:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f28:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803f2d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803f31:	85 c0                	test   %eax,%eax
+  803f33:	0f 94 c0             	sete   %al
+  803f36:	0f b6 c0             	movzbl %al,%eax
+}
+  803f39:	5d                   	pop    %ebp
+  803f3a:	c3                   	ret
+
+00803f3b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803f3b:	55                   	push   %ebp
+  803f3c:	89 e5                	mov    %esp,%ebp
+  803f3e:	83 ec 08             	sub    $0x8,%esp
+  803f41:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f49:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803f4c:	83 f8 02             	cmp    $0x2,%eax
+  803f4f:	74 02                	je     803f53 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803f51:	c9                   	leave
+  803f52:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803f53:	83 ec 08             	sub    $0x8,%esp
+  803f56:	6a 01                	push   $0x1
+  803f58:	52                   	push   %edx
+  803f59:	e8 3f d5 ff ff       	call   80149d <sys_futex_wake>
+  803f5e:	83 c4 10             	add    $0x10,%esp
+}
+  803f61:	eb ee                	jmp    803f51 <mutex_unlock+0x16>
+
+00803f63 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803f63:	55                   	push   %ebp
+  803f64:	89 e5                	mov    %esp,%ebp
+  803f66:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803f69:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803f6f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803f76:	5d                   	pop    %ebp
+  803f77:	c3                   	ret
+
+00803f78 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803f78:	55                   	push   %ebp
+  803f79:	89 e5                	mov    %esp,%ebp
+  803f7b:	57                   	push   %edi
+  803f7c:	56                   	push   %esi
+  803f7d:	53                   	push   %ebx
+  803f7e:	83 ec 18             	sub    $0x18,%esp
+  803f81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f84:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803f87:	8b 33                	mov    (%ebx),%esi
+	asm volatile("lock; xaddl %0, %1" :
+  803f89:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f8e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803f93:	57                   	push   %edi
+  803f94:	e8 a2 ff ff ff       	call   803f3b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803f99:	83 c4 0c             	add    $0xc,%esp
+  803f9c:	ff 75 10             	push   0x10(%ebp)
+  803f9f:	56                   	push   %esi
+  803fa0:	53                   	push   %ebx
+  803fa1:	e8 d5 d4 ff ff       	call   80147b <sys_futex_wait>
+  803fa6:	89 c6                	mov    %eax,%esi
+  803fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803fad:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803fb2:	89 3c 24             	mov    %edi,(%esp)
+  803fb5:	e8 13 ff ff ff       	call   803ecd <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803fba:	83 c4 10             	add    $0x10,%esp
+  803fbd:	83 fe ef             	cmp    $0xffffffef,%esi
+  803fc0:	74 05                	je     803fc7 <cond_timedwait+0x4f>
+  803fc2:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803fc7:	89 f0                	mov    %esi,%eax
+  803fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fcc:	5b                   	pop    %ebx
+  803fcd:	5e                   	pop    %esi
+  803fce:	5f                   	pop    %edi
+  803fcf:	5d                   	pop    %ebp
+  803fd0:	c3                   	ret
+
+00803fd1 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803fd1:	55                   	push   %ebp
+  803fd2:	89 e5                	mov    %esp,%ebp
+  803fd4:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803fd7:	6a ff                	push   $0xffffffff
+  803fd9:	ff 75 0c             	push   0xc(%ebp)
+  803fdc:	ff 75 08             	push   0x8(%ebp)
+  803fdf:	e8 94 ff ff ff       	call   803f78 <cond_timedwait>
+}
+  803fe4:	83 c4 10             	add    $0x10,%esp
+  803fe7:	c9                   	leave
+  803fe8:	c3                   	ret
+
+00803fe9 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803fe9:	55                   	push   %ebp
+  803fea:	89 e5                	mov    %esp,%ebp
+  803fec:	83 ec 08             	sub    $0x8,%esp
+  803fef:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ff2:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ff7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803ffb:	8b 50 04             	mov    0x4(%eax),%edx
+  803ffe:	85 d2                	test   %edx,%edx
+  804000:	75 02                	jne    804004 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  804002:	c9                   	leave
+  804003:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804004:	83 ec 08             	sub    $0x8,%esp
+  804007:	6a 01                	push   $0x1
+  804009:	50                   	push   %eax
+  80400a:	e8 8e d4 ff ff       	call   80149d <sys_futex_wake>
+  80400f:	83 c4 10             	add    $0x10,%esp
+}
+  804012:	eb ee                	jmp    804002 <cond_signal+0x19>
+
+00804014 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804014:	55                   	push   %ebp
+  804015:	89 e5                	mov    %esp,%ebp
+  804017:	83 ec 08             	sub    $0x8,%esp
+  80401a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80401d:	ba 01 00 00 00       	mov    $0x1,%edx
+  804022:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804026:	8b 50 04             	mov    0x4(%eax),%edx
+  804029:	85 d2                	test   %edx,%edx
+  80402b:	75 02                	jne    80402f <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  80402d:	c9                   	leave
+  80402e:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  80402f:	83 ec 08             	sub    $0x8,%esp
+  804032:	68 00 04 00 00       	push   $0x400
+  804037:	50                   	push   %eax
+  804038:	e8 60 d4 ff ff       	call   80149d <sys_futex_wake>
+  80403d:	83 c4 10             	add    $0x10,%esp
+}
+  804040:	eb eb                	jmp    80402d <cond_broadcast+0x19>
+
+00804042 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804042:	b8 00 00 00 00       	mov    $0x0,%eax
+  804047:	c3                   	ret
+
+00804048 <devcons_poll>:
+{
+  804048:	55                   	push   %ebp
+  804049:	89 e5                	mov    %esp,%ebp
+  80404b:	53                   	push   %ebx
+  80404c:	83 ec 04             	sub    $0x4,%esp
+  80404f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804052:	89 da                	mov    %ebx,%edx
+  804054:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804057:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  80405e:	74 0c                	je     80406c <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804060:	89 d8                	mov    %ebx,%eax
+  804062:	83 e0 01             	and    $0x1,%eax
+  804065:	09 d0                	or     %edx,%eax
+}
+  804067:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80406a:	c9                   	leave
+  80406b:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80406c:	e8 6e cf ff ff       	call   800fdf <sys_cgetc>
+  804071:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804076:	89 da                	mov    %ebx,%edx
+  804078:	83 e2 04             	and    $0x4,%edx
+  80407b:	85 c0                	test   %eax,%eax
+  80407d:	74 e6                	je     804065 <devcons_poll+0x1d>
+  80407f:	eb df                	jmp    804060 <devcons_poll+0x18>
+
+00804081 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804081:	55                   	push   %ebp
+  804082:	89 e5                	mov    %esp,%ebp
+  804084:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804087:	68 58 4e 80 00       	push   $0x804e58
+  80408c:	ff 75 0c             	push   0xc(%ebp)
+  80408f:	e8 b5 cb ff ff       	call   800c49 <strcpy>
+	return 0;
+}
+  804094:	b8 00 00 00 00       	mov    $0x0,%eax
+  804099:	c9                   	leave
+  80409a:	c3                   	ret
+
+0080409b <devcons_write>:
+{
+  80409b:	55                   	push   %ebp
+  80409c:	89 e5                	mov    %esp,%ebp
+  80409e:	57                   	push   %edi
+  80409f:	56                   	push   %esi
+  8040a0:	53                   	push   %ebx
+  8040a1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8040a7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8040aa:	85 ff                	test   %edi,%edi
+  8040ac:	74 51                	je     8040ff <devcons_write+0x64>
+  8040ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8040b3:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8040b8:	89 fb                	mov    %edi,%ebx
+  8040ba:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8040bc:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8040c1:	39 d3                	cmp    %edx,%ebx
+  8040c3:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8040c6:	83 ec 04             	sub    $0x4,%esp
+  8040c9:	53                   	push   %ebx
+  8040ca:	03 45 0c             	add    0xc(%ebp),%eax
+  8040cd:	50                   	push   %eax
+  8040ce:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8040d4:	50                   	push   %eax
+  8040d5:	e8 1f cd ff ff       	call   800df9 <memmove>
+		sys_cputs(buf, m);
+  8040da:	83 c4 08             	add    $0x8,%esp
+  8040dd:	53                   	push   %ebx
+  8040de:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8040e4:	50                   	push   %eax
+  8040e5:	e8 d7 ce ff ff       	call   800fc1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8040ea:	01 de                	add    %ebx,%esi
+  8040ec:	89 f0                	mov    %esi,%eax
+  8040ee:	83 c4 10             	add    $0x10,%esp
+  8040f1:	39 fe                	cmp    %edi,%esi
+  8040f3:	72 c3                	jb     8040b8 <devcons_write+0x1d>
+}
+  8040f5:	89 f0                	mov    %esi,%eax
+  8040f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040fa:	5b                   	pop    %ebx
+  8040fb:	5e                   	pop    %esi
+  8040fc:	5f                   	pop    %edi
+  8040fd:	5d                   	pop    %ebp
+  8040fe:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8040ff:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804104:	eb ef                	jmp    8040f5 <devcons_write+0x5a>
+
+00804106 <devcons_read>:
+{
+  804106:	55                   	push   %ebp
+  804107:	89 e5                	mov    %esp,%ebp
+  804109:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80410c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  804111:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804115:	74 36                	je     80414d <devcons_read+0x47>
+	c = cons_peek;
+  804117:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  80411c:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  804123:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804126:	85 c0                	test   %eax,%eax
+  804128:	75 10                	jne    80413a <devcons_read+0x34>
+  80412a:	e8 b0 ce ff ff       	call   800fdf <sys_cgetc>
+  80412f:	85 c0                	test   %eax,%eax
+  804131:	75 07                	jne    80413a <devcons_read+0x34>
+		sys_yield();
+  804133:	e8 26 cf ff ff       	call   80105e <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804138:	eb f0                	jmp    80412a <devcons_read+0x24>
+	if (c < 0)
+  80413a:	85 c0                	test   %eax,%eax
+  80413c:	78 0f                	js     80414d <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80413e:	83 f8 04             	cmp    $0x4,%eax
+  804141:	74 0c                	je     80414f <devcons_read+0x49>
+	*(char*)vbuf = c;
+  804143:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804146:	88 02                	mov    %al,(%edx)
+	return 1;
+  804148:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80414d:	c9                   	leave
+  80414e:	c3                   	ret
+		return 0;
+  80414f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804154:	eb f7                	jmp    80414d <devcons_read+0x47>
+
+00804156 <cputchar>:
+{
+  804156:	55                   	push   %ebp
+  804157:	89 e5                	mov    %esp,%ebp
+  804159:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80415c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80415f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804162:	6a 01                	push   $0x1
+  804164:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804167:	50                   	push   %eax
+  804168:	e8 54 ce ff ff       	call   800fc1 <sys_cputs>
+}
+  80416d:	83 c4 10             	add    $0x10,%esp
+  804170:	c9                   	leave
+  804171:	c3                   	ret
+
+00804172 <getchar>:
+{
+  804172:	55                   	push   %ebp
+  804173:	89 e5                	mov    %esp,%ebp
+  804175:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804178:	6a 01                	push   $0x1
+  80417a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80417d:	50                   	push   %eax
+  80417e:	6a 00                	push   $0x0
+  804180:	e8 d2 dd ff ff       	call   801f57 <read>
+	if (r < 0)
+  804185:	83 c4 10             	add    $0x10,%esp
+  804188:	85 c0                	test   %eax,%eax
+  80418a:	78 06                	js     804192 <getchar+0x20>
+	if (r < 1)
+  80418c:	74 06                	je     804194 <getchar+0x22>
+	return c;
+  80418e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804192:	c9                   	leave
+  804193:	c3                   	ret
+		return -E_EOF;
+  804194:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804199:	eb f7                	jmp    804192 <getchar+0x20>
+
+0080419b <iscons>:
+{
+  80419b:	55                   	push   %ebp
+  80419c:	89 e5                	mov    %esp,%ebp
+  80419e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8041a4:	50                   	push   %eax
+  8041a5:	ff 75 08             	push   0x8(%ebp)
+  8041a8:	e8 26 db ff ff       	call   801cd3 <fd_lookup>
+  8041ad:	83 c4 10             	add    $0x10,%esp
+  8041b0:	85 c0                	test   %eax,%eax
+  8041b2:	78 11                	js     8041c5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8041b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041b7:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8041bd:	39 10                	cmp    %edx,(%eax)
+  8041bf:	0f 94 c0             	sete   %al
+  8041c2:	0f b6 c0             	movzbl %al,%eax
+}
+  8041c5:	c9                   	leave
+  8041c6:	c3                   	ret
+
+008041c7 <opencons>:
+{
+  8041c7:	55                   	push   %ebp
+  8041c8:	89 e5                	mov    %esp,%ebp
+  8041ca:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8041cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8041d0:	50                   	push   %eax
+  8041d1:	e8 ad da ff ff       	call   801c83 <fd_alloc>
+  8041d6:	83 c4 10             	add    $0x10,%esp
+  8041d9:	85 c0                	test   %eax,%eax
+  8041db:	78 3a                	js     804217 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8041dd:	83 ec 04             	sub    $0x4,%esp
+  8041e0:	68 07 04 00 00       	push   $0x407
+  8041e5:	ff 75 f4             	push   -0xc(%ebp)
+  8041e8:	6a 00                	push   $0x0
+  8041ea:	e8 8e ce ff ff       	call   80107d <sys_page_alloc>
+  8041ef:	83 c4 10             	add    $0x10,%esp
+  8041f2:	85 c0                	test   %eax,%eax
+  8041f4:	78 21                	js     804217 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8041f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041f9:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8041ff:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804201:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804204:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80420b:	83 ec 0c             	sub    $0xc,%esp
+  80420e:	50                   	push   %eax
+  80420f:	e8 48 da ff ff       	call   801c5c <fd2num>
+  804214:	83 c4 10             	add    $0x10,%esp
+}
+  804217:	c9                   	leave
+  804218:	c3                   	ret
+
+00804219 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804219:	55                   	push   %ebp
+  80421a:	89 e5                	mov    %esp,%ebp
+  80421c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80421f:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804226:	74 0a                	je     804232 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804228:	8b 45 08             	mov    0x8(%ebp),%eax
+  80422b:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804230:	c9                   	leave
+  804231:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804232:	83 ec 04             	sub    $0x4,%esp
+  804235:	6a 07                	push   $0x7
+  804237:	68 00 f0 bf ee       	push   $0xeebff000
+  80423c:	6a 00                	push   $0x0
+  80423e:	e8 3a ce ff ff       	call   80107d <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804243:	83 c4 08             	add    $0x8,%esp
+  804246:	68 57 42 80 00       	push   $0x804257
+  80424b:	6a 00                	push   $0x0
+  80424d:	e8 76 cf ff ff       	call   8011c8 <sys_env_set_pgfault_upcall>
+  804252:	83 c4 10             	add    $0x10,%esp
+  804255:	eb d1                	jmp    804228 <set_pgfault_handler+0xf>
+
+00804257 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804257:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804258:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80425d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80425f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804262:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804266:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804269:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  80426d:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  80426f:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804273:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804276:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804277:	83 c4 04             	add    $0x4,%esp
+	popf
+  80427a:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80427b:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80427c:	c3                   	ret
+
+0080427d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80427d:	55                   	push   %ebp
+  80427e:	89 e5                	mov    %esp,%ebp
+  804280:	56                   	push   %esi
+  804281:	53                   	push   %ebx
+  804282:	8b 75 08             	mov    0x8(%ebp),%esi
+  804285:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804288:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80428b:	85 c0                	test   %eax,%eax
+  80428d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804292:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804295:	83 ec 0c             	sub    $0xc,%esp
+  804298:	50                   	push   %eax
+  804299:	e8 8f cf ff ff       	call   80122d <sys_ipc_recv>
+  80429e:	83 c4 10             	add    $0x10,%esp
+  8042a1:	85 c0                	test   %eax,%eax
+  8042a3:	0f 88 8b 00 00 00    	js     804334 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8042a9:	85 f6                	test   %esi,%esi
+  8042ab:	74 2a                	je     8042d7 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8042ad:	89 e2                	mov    %esp,%edx
+  8042af:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8042b4:	29 d0                	sub    %edx,%eax
+  8042b6:	89 c2                	mov    %eax,%edx
+  8042b8:	c1 ea 0f             	shr    $0xf,%edx
+  8042bb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8042c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c5:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8042c8:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8042cf:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8042d5:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8042d7:	85 db                	test   %ebx,%ebx
+  8042d9:	74 2a                	je     804305 <ipc_recv+0x88>
+  8042db:	89 e2                	mov    %esp,%edx
+  8042dd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8042e2:	29 d0                	sub    %edx,%eax
+  8042e4:	89 c2                	mov    %eax,%edx
+  8042e6:	c1 ea 0f             	shr    $0xf,%edx
+  8042e9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8042ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f3:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8042f6:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8042fd:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804303:	89 03                	mov    %eax,(%ebx)
+  804305:	89 e2                	mov    %esp,%edx
+  804307:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80430c:	29 d0                	sub    %edx,%eax
+  80430e:	89 c2                	mov    %eax,%edx
+  804310:	c1 ea 0f             	shr    $0xf,%edx
+  804313:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431d:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804320:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804327:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80432d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804330:	5b                   	pop    %ebx
+  804331:	5e                   	pop    %esi
+  804332:	5d                   	pop    %ebp
+  804333:	c3                   	ret
+		if(from_env_store != NULL)
+  804334:	85 f6                	test   %esi,%esi
+  804336:	74 06                	je     80433e <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804338:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80433e:	85 db                	test   %ebx,%ebx
+  804340:	74 eb                	je     80432d <ipc_recv+0xb0>
+			*perm_store = 0;
+  804342:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804348:	eb e3                	jmp    80432d <ipc_recv+0xb0>
+
+0080434a <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80434a:	55                   	push   %ebp
+  80434b:	89 e5                	mov    %esp,%ebp
+  80434d:	57                   	push   %edi
+  80434e:	56                   	push   %esi
+  80434f:	53                   	push   %ebx
+  804350:	83 ec 14             	sub    $0x14,%esp
+  804353:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804356:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804359:	8b 75 14             	mov    0x14(%ebp),%esi
+  80435c:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  80435f:	85 c0                	test   %eax,%eax
+  804361:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804366:	0f 44 c2             	cmove  %edx,%eax
+  804369:	ff 75 10             	push   0x10(%ebp)
+  80436c:	50                   	push   %eax
+  80436d:	e8 1d cf ff ff       	call   80128f <sys_ipc_recv_pages>
+  804372:	83 c4 10             	add    $0x10,%esp
+  804375:	85 c0                	test   %eax,%eax
+  804377:	0f 88 ba 00 00 00    	js     804437 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80437d:	85 ff                	test   %edi,%edi
+  80437f:	74 2a                	je     8043ab <ipc_recv_pages+0x61>
+  804381:	89 e2                	mov    %esp,%edx
+  804383:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804388:	29 d0                	sub    %edx,%eax
+  80438a:	89 c2                	mov    %eax,%edx
+  80438c:	c1 ea 0f             	shr    $0xf,%edx
+  80438f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804394:	b8 00 00 00 00       	mov    $0x0,%eax
+  804399:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80439c:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8043a3:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8043a9:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8043ab:	85 f6                	test   %esi,%esi
+  8043ad:	74 2a                	je     8043d9 <ipc_recv_pages+0x8f>
+  8043af:	89 e2                	mov    %esp,%edx
+  8043b1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043b6:	29 d0                	sub    %edx,%eax
+  8043b8:	89 c2                	mov    %eax,%edx
+  8043ba:	c1 ea 0f             	shr    $0xf,%edx
+  8043bd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c7:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8043ca:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8043d1:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8043d7:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8043d9:	85 db                	test   %ebx,%ebx
+  8043db:	74 2a                	je     804407 <ipc_recv_pages+0xbd>
+  8043dd:	89 e2                	mov    %esp,%edx
+  8043df:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043e4:	29 d0                	sub    %edx,%eax
+  8043e6:	89 c2                	mov    %eax,%edx
+  8043e8:	c1 ea 0f             	shr    $0xf,%edx
+  8043eb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f5:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8043f8:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8043ff:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804405:	89 03                	mov    %eax,(%ebx)
+  804407:	89 e2                	mov    %esp,%edx
+  804409:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80440e:	29 d0                	sub    %edx,%eax
+  804410:	89 c2                	mov    %eax,%edx
+  804412:	c1 ea 0f             	shr    $0xf,%edx
+  804415:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80441a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80441f:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804422:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804429:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80442f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804432:	5b                   	pop    %ebx
+  804433:	5e                   	pop    %esi
+  804434:	5f                   	pop    %edi
+  804435:	5d                   	pop    %ebp
+  804436:	c3                   	ret
+		if (from_env_store)
+  804437:	85 ff                	test   %edi,%edi
+  804439:	74 06                	je     804441 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80443b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804441:	85 f6                	test   %esi,%esi
+  804443:	74 06                	je     80444b <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804445:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80444b:	85 db                	test   %ebx,%ebx
+  80444d:	74 e0                	je     80442f <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  80444f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804455:	eb d8                	jmp    80442f <ipc_recv_pages+0xe5>
+
+00804457 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804457:	55                   	push   %ebp
+  804458:	89 e5                	mov    %esp,%ebp
+  80445a:	57                   	push   %edi
+  80445b:	56                   	push   %esi
+  80445c:	53                   	push   %ebx
+  80445d:	83 ec 1c             	sub    $0x1c,%esp
+  804460:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804463:	8b 75 08             	mov    0x8(%ebp),%esi
+  804466:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80446c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804470:	75 2b                	jne    80449d <ipc_try_send_pages+0x46>
+  804472:	89 e2                	mov    %esp,%edx
+  804474:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804479:	29 d0                	sub    %edx,%eax
+  80447b:	89 c2                	mov    %eax,%edx
+  80447d:	c1 ea 0f             	shr    $0xf,%edx
+  804480:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80448a:	0f 42 c2             	cmovb  %edx,%eax
+  80448d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804494:	8b 70 48             	mov    0x48(%eax),%esi
+  804497:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80449d:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8044a3:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8044a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8044ab:	85 ff                	test   %edi,%edi
+  8044ad:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8044b2:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8044b5:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8044bb:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8044c1:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8044c7:	83 ec 0c             	sub    $0xc,%esp
+  8044ca:	ff 75 14             	push   0x14(%ebp)
+  8044cd:	ff 75 18             	push   0x18(%ebp)
+  8044d0:	57                   	push   %edi
+  8044d1:	ff 75 0c             	push   0xc(%ebp)
+  8044d4:	ff 75 08             	push   0x8(%ebp)
+  8044d7:	e8 92 cd ff ff       	call   80126e <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8044dc:	83 c4 20             	add    $0x20,%esp
+  8044df:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8044e2:	75 21                	jne    804505 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8044e4:	83 ec 04             	sub    $0x4,%esp
+  8044e7:	6a ff                	push   $0xffffffff
+  8044e9:	53                   	push   %ebx
+  8044ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8044ed:	e8 89 cf ff ff       	call   80147b <sys_futex_wait>
+  8044f2:	83 c4 10             	add    $0x10,%esp
+  8044f5:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8044f8:	74 c7                	je     8044c1 <ipc_try_send_pages+0x6a>
+  8044fa:	85 c0                	test   %eax,%eax
+  8044fc:	79 c3                	jns    8044c1 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8044fe:	e8 5b cb ff ff       	call   80105e <sys_yield>
+  804503:	eb bc                	jmp    8044c1 <ipc_try_send_pages+0x6a>
+	}
+}
+  804505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804508:	5b                   	pop    %ebx
+  804509:	5e                   	pop    %esi
+  80450a:	5f                   	pop    %edi
+  80450b:	5d                   	pop    %ebp
+  80450c:	c3                   	ret
+
+0080450d <ipc_send>:
+{
+  80450d:	55                   	push   %ebp
+  80450e:	89 e5                	mov    %esp,%ebp
+  804510:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804513:	ff 75 14             	push   0x14(%ebp)
+  804516:	6a 01                	push   $0x1
+  804518:	ff 75 10             	push   0x10(%ebp)
+  80451b:	ff 75 0c             	push   0xc(%ebp)
+  80451e:	ff 75 08             	push   0x8(%ebp)
+  804521:	e8 31 ff ff ff       	call   804457 <ipc_try_send_pages>
+  804526:	83 c4 20             	add    $0x20,%esp
+  804529:	85 c0                	test   %eax,%eax
+  80452b:	78 02                	js     80452f <ipc_send+0x22>
+}
+  80452d:	c9                   	leave
+  80452e:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80452f:	50                   	push   %eax
+  804530:	68 64 4e 80 00       	push   $0x804e64
+  804535:	6a 3f                	push   $0x3f
+  804537:	68 79 4e 80 00       	push   $0x804e79
+  80453c:	e8 36 bf ff ff       	call   800477 <_panic>
+
+00804541 <ipc_send_pages>:
+{
+  804541:	55                   	push   %ebp
+  804542:	89 e5                	mov    %esp,%ebp
+  804544:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  804547:	ff 75 18             	push   0x18(%ebp)
+  80454a:	ff 75 14             	push   0x14(%ebp)
+  80454d:	ff 75 10             	push   0x10(%ebp)
+  804550:	ff 75 0c             	push   0xc(%ebp)
+  804553:	ff 75 08             	push   0x8(%ebp)
+  804556:	e8 fc fe ff ff       	call   804457 <ipc_try_send_pages>
+  80455b:	83 c4 20             	add    $0x20,%esp
+  80455e:	85 c0                	test   %eax,%eax
+  804560:	78 02                	js     804564 <ipc_send_pages+0x23>
+}
+  804562:	c9                   	leave
+  804563:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804564:	50                   	push   %eax
+  804565:	68 83 4e 80 00       	push   $0x804e83
+  80456a:	6a 64                	push   $0x64
+  80456c:	68 79 4e 80 00       	push   $0x804e79
+  804571:	e8 01 bf ff ff       	call   800477 <_panic>
+
+00804576 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804576:	55                   	push   %ebp
+  804577:	89 e5                	mov    %esp,%ebp
+  804579:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80457c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804581:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804587:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80458d:	8b 52 50             	mov    0x50(%edx),%edx
+  804590:	39 ca                	cmp    %ecx,%edx
+  804592:	74 11                	je     8045a5 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804594:	83 c0 01             	add    $0x1,%eax
+  804597:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80459c:	75 e3                	jne    804581 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80459e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a3:	eb 0e                	jmp    8045b3 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8045a5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8045ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8045b0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8045b3:	5d                   	pop    %ebp
+  8045b4:	c3                   	ret
+
+008045b5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8045b5:	55                   	push   %ebp
+  8045b6:	89 e5                	mov    %esp,%ebp
+  8045b8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8045bb:	89 c2                	mov    %eax,%edx
+  8045bd:	c1 ea 16             	shr    $0x16,%edx
+  8045c0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8045c7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8045cc:	f6 c1 01             	test   $0x1,%cl
+  8045cf:	74 1e                	je     8045ef <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8045d1:	c1 e8 0c             	shr    $0xc,%eax
+  8045d4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8045db:	a8 01                	test   $0x1,%al
+  8045dd:	74 10                	je     8045ef <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8045df:	c1 e8 0c             	shr    $0xc,%eax
+  8045e2:	c1 e0 04             	shl    $0x4,%eax
+  8045e5:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8045ec:	0f b7 d2             	movzwl %dx,%edx
+}
+  8045ef:	89 d0                	mov    %edx,%eax
+  8045f1:	5d                   	pop    %ebp
+  8045f2:	c3                   	ret
+
+008045f3 <__udivdi3>:
+  8045f3:	57                   	push   %edi
+  8045f4:	56                   	push   %esi
+  8045f5:	53                   	push   %ebx
+  8045f6:	83 ec 20             	sub    $0x20,%esp
+  8045f9:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8045fd:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804601:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804605:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804609:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80460d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804611:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804615:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804619:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80461e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804623:	ba 00 00 00 00       	mov    $0x0,%edx
+  804628:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80462f:	00 
+  804630:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804637:	00 
+  804638:	eb 08                	jmp    804642 <__udivdi3+0x4f>
+  80463a:	83 e9 01             	sub    $0x1,%ecx
+  80463d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804640:	74 68                	je     8046aa <__udivdi3+0xb7>
+  804642:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804646:	01 c0                	add    %eax,%eax
+  804648:	89 c6                	mov    %eax,%esi
+  80464a:	89 d7                	mov    %edx,%edi
+  80464c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804650:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804654:	0f ad d0             	shrd   %cl,%edx,%eax
+  804657:	d3 ea                	shr    %cl,%edx
+  804659:	f6 c1 20             	test   $0x20,%cl
+  80465c:	74 04                	je     804662 <__udivdi3+0x6f>
+  80465e:	89 d0                	mov    %edx,%eax
+  804660:	31 d2                	xor    %edx,%edx
+  804662:	83 e0 01             	and    $0x1,%eax
+  804665:	89 04 24             	mov    %eax,(%esp)
+  804668:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80466f:	00 
+  804670:	8b 04 24             	mov    (%esp),%eax
+  804673:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804677:	09 f0                	or     %esi,%eax
+  804679:	09 fa                	or     %edi,%edx
+  80467b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80467f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804683:	39 f0                	cmp    %esi,%eax
+  804685:	89 d3                	mov    %edx,%ebx
+  804687:	19 fb                	sbb    %edi,%ebx
+  804689:	72 af                	jb     80463a <__udivdi3+0x47>
+  80468b:	29 f0                	sub    %esi,%eax
+  80468d:	19 fa                	sbb    %edi,%edx
+  80468f:	89 cf                	mov    %ecx,%edi
+  804691:	c1 ef 05             	shr    $0x5,%edi
+  804694:	83 e7 01             	and    $0x1,%edi
+  804697:	89 fe                	mov    %edi,%esi
+  804699:	83 f6 01             	xor    $0x1,%esi
+  80469c:	d3 e6                	shl    %cl,%esi
+  80469e:	d3 e7                	shl    %cl,%edi
+  8046a0:	09 74 24 18          	or     %esi,0x18(%esp)
+  8046a4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8046a8:	eb 90                	jmp    80463a <__udivdi3+0x47>
+  8046aa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046ae:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046b2:	83 c4 20             	add    $0x20,%esp
+  8046b5:	5b                   	pop    %ebx
+  8046b6:	5e                   	pop    %esi
+  8046b7:	5f                   	pop    %edi
+  8046b8:	c3                   	ret
+
+008046b9 <__umoddi3>:
+  8046b9:	57                   	push   %edi
+  8046ba:	56                   	push   %esi
+  8046bb:	53                   	push   %ebx
+  8046bc:	83 ec 08             	sub    $0x8,%esp
+  8046bf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046c3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046c7:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8046cb:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8046cf:	57                   	push   %edi
+  8046d0:	56                   	push   %esi
+  8046d1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8046d5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8046d9:	52                   	push   %edx
+  8046da:	50                   	push   %eax
+  8046db:	e8 13 ff ff ff       	call   8045f3 <__udivdi3>
+  8046e0:	89 c3                	mov    %eax,%ebx
+  8046e2:	0f af d6             	imul   %esi,%edx
+  8046e5:	89 f9                	mov    %edi,%ecx
+  8046e7:	0f af cb             	imul   %ebx,%ecx
+  8046ea:	01 d1                	add    %edx,%ecx
+  8046ec:	89 d8                	mov    %ebx,%eax
+  8046ee:	f7 e6                	mul    %esi
+  8046f0:	89 c6                	mov    %eax,%esi
+  8046f2:	89 d7                	mov    %edx,%edi
+  8046f4:	01 cf                	add    %ecx,%edi
+  8046f6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8046fa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8046fe:	29 f0                	sub    %esi,%eax
+  804700:	19 fa                	sbb    %edi,%edx
+  804702:	83 c4 18             	add    $0x18,%esp
+  804705:	5b                   	pop    %ebx
+  804706:	5e                   	pop    %esi
+  804707:	5f                   	pop    %edi
+  804708:	c3                   	ret
+
+00804709 <__divdi3>:
+  804709:	53                   	push   %ebx
+  80470a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80470e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804712:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804716:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80471a:	85 d2                	test   %edx,%edx
+  80471c:	78 12                	js     804730 <__divdi3+0x27>
+  80471e:	85 db                	test   %ebx,%ebx
+  804720:	78 2e                	js     804750 <__divdi3+0x47>
+  804722:	53                   	push   %ebx
+  804723:	51                   	push   %ecx
+  804724:	52                   	push   %edx
+  804725:	50                   	push   %eax
+  804726:	e8 c8 fe ff ff       	call   8045f3 <__udivdi3>
+  80472b:	83 c4 10             	add    $0x10,%esp
+  80472e:	eb 1e                	jmp    80474e <__divdi3+0x45>
+  804730:	f7 d8                	neg    %eax
+  804732:	83 d2 00             	adc    $0x0,%edx
+  804735:	f7 da                	neg    %edx
+  804737:	85 db                	test   %ebx,%ebx
+  804739:	78 2a                	js     804765 <__divdi3+0x5c>
+  80473b:	53                   	push   %ebx
+  80473c:	51                   	push   %ecx
+  80473d:	52                   	push   %edx
+  80473e:	50                   	push   %eax
+  80473f:	e8 af fe ff ff       	call   8045f3 <__udivdi3>
+  804744:	83 c4 10             	add    $0x10,%esp
+  804747:	f7 d8                	neg    %eax
+  804749:	83 d2 00             	adc    $0x0,%edx
+  80474c:	f7 da                	neg    %edx
+  80474e:	5b                   	pop    %ebx
+  80474f:	c3                   	ret
+  804750:	f7 d9                	neg    %ecx
+  804752:	83 d3 00             	adc    $0x0,%ebx
+  804755:	f7 db                	neg    %ebx
+  804757:	53                   	push   %ebx
+  804758:	51                   	push   %ecx
+  804759:	52                   	push   %edx
+  80475a:	50                   	push   %eax
+  80475b:	e8 93 fe ff ff       	call   8045f3 <__udivdi3>
+  804760:	83 c4 10             	add    $0x10,%esp
+  804763:	eb e2                	jmp    804747 <__divdi3+0x3e>
+  804765:	f7 d9                	neg    %ecx
+  804767:	83 d3 00             	adc    $0x0,%ebx
+  80476a:	f7 db                	neg    %ebx
+  80476c:	53                   	push   %ebx
+  80476d:	51                   	push   %ecx
+  80476e:	52                   	push   %edx
+  80476f:	50                   	push   %eax
+  804770:	e8 7e fe ff ff       	call   8045f3 <__udivdi3>
+  804775:	83 c4 10             	add    $0x10,%esp
+  804778:	eb d4                	jmp    80474e <__divdi3+0x45>
+
+0080477a <__moddi3>:
+  80477a:	57                   	push   %edi
+  80477b:	56                   	push   %esi
+  80477c:	53                   	push   %ebx
+  80477d:	83 ec 08             	sub    $0x8,%esp
+  804780:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804784:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804788:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80478c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804790:	57                   	push   %edi
+  804791:	56                   	push   %esi
+  804792:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804796:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80479a:	52                   	push   %edx
+  80479b:	50                   	push   %eax
+  80479c:	e8 68 ff ff ff       	call   804709 <__divdi3>
+  8047a1:	89 c3                	mov    %eax,%ebx
+  8047a3:	0f af d6             	imul   %esi,%edx
+  8047a6:	89 f9                	mov    %edi,%ecx
+  8047a8:	0f af cb             	imul   %ebx,%ecx
+  8047ab:	01 d1                	add    %edx,%ecx
+  8047ad:	89 d8                	mov    %ebx,%eax
+  8047af:	f7 e6                	mul    %esi
+  8047b1:	89 c6                	mov    %eax,%esi
+  8047b3:	89 d7                	mov    %edx,%edi
+  8047b5:	01 cf                	add    %ecx,%edi
+  8047b7:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8047bb:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8047bf:	29 f0                	sub    %esi,%eax
+  8047c1:	19 fa                	sbb    %edi,%edx
+  8047c3:	83 c4 18             	add    $0x18,%esp
+  8047c6:	5b                   	pop    %ebx
+  8047c7:	5e                   	pop    %esi
+  8047c8:	5f                   	pop    %edi
+  8047c9:	c3                   	ret
@@ -0,0 +1,8542 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 96 02 00 00       	call   8002c7 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <ls1>:
+		panic("error reading directory %s: %e", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 04             	sub    $0x4,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	const char *sep;
+
+	if(flag['l'])
+  80003f:	83 3d f0 64 80 00 00 	cmpl   $0x0,0x8064f0
+  800046:	74 20                	je     800068 <ls1+0x33>
+		printf("%11d %c ", size, isdir ? 'd' : '-');
+  800048:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+  80004c:	19 c0                	sbb    %eax,%eax
+  80004e:	83 e0 c9             	and    $0xffffffc9,%eax
+  800051:	83 c0 64             	add    $0x64,%eax
+  800054:	83 ec 04             	sub    $0x4,%esp
+  800057:	50                   	push   %eax
+  800058:	ff 75 10             	push   0x10(%ebp)
+  80005b:	68 62 3f 80 00       	push   $0x803f62
+  800060:	e8 31 1f 00 00       	call   801f96 <printf>
+  800065:	83 c4 10             	add    $0x10,%esp
+	if(prefix) {
+  800068:	85 db                	test   %ebx,%ebx
+  80006a:	74 1c                	je     800088 <ls1+0x53>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+			sep = "/";
+		else
+			sep = "";
+  80006c:	b8 c8 3f 80 00       	mov    $0x803fc8,%eax
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800071:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800074:	75 49                	jne    8000bf <ls1+0x8a>
+		printf("%s%s", prefix, sep);
+  800076:	83 ec 04             	sub    $0x4,%esp
+  800079:	50                   	push   %eax
+  80007a:	53                   	push   %ebx
+  80007b:	68 6b 3f 80 00       	push   $0x803f6b
+  800080:	e8 11 1f 00 00       	call   801f96 <printf>
+  800085:	83 c4 10             	add    $0x10,%esp
+	}
+	printf("%s", name);
+  800088:	83 ec 08             	sub    $0x8,%esp
+  80008b:	ff 75 14             	push   0x14(%ebp)
+  80008e:	68 3b 44 80 00       	push   $0x80443b
+  800093:	e8 fe 1e 00 00       	call   801f96 <printf>
+	if(flag['F'] && isdir)
+  800098:	83 c4 10             	add    $0x10,%esp
+  80009b:	83 3d 58 64 80 00 00 	cmpl   $0x0,0x806458
+  8000a2:	74 06                	je     8000aa <ls1+0x75>
+  8000a4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8000a8:	75 35                	jne    8000df <ls1+0xaa>
+		printf("/");
+	printf("\n");
+  8000aa:	83 ec 0c             	sub    $0xc,%esp
+  8000ad:	68 c7 3f 80 00       	push   $0x803fc7
+  8000b2:	e8 df 1e 00 00       	call   801f96 <printf>
+}
+  8000b7:	83 c4 10             	add    $0x10,%esp
+  8000ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000bd:	c9                   	leave
+  8000be:	c3                   	ret
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	53                   	push   %ebx
+  8000c3:	e8 2c 0a 00 00       	call   800af4 <strlen>
+  8000c8:	83 c4 10             	add    $0x10,%esp
+			sep = "/";
+  8000cb:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d0:	b8 c8 3f 80 00       	mov    $0x803fc8,%eax
+  8000d5:	ba 60 3f 80 00       	mov    $0x803f60,%edx
+  8000da:	0f 45 c2             	cmovne %edx,%eax
+  8000dd:	eb 97                	jmp    800076 <ls1+0x41>
+		printf("/");
+  8000df:	83 ec 0c             	sub    $0xc,%esp
+  8000e2:	68 60 3f 80 00       	push   $0x803f60
+  8000e7:	e8 aa 1e 00 00       	call   801f96 <printf>
+  8000ec:	83 c4 10             	add    $0x10,%esp
+  8000ef:	eb b9                	jmp    8000aa <ls1+0x75>
+
+008000f1 <lsdir>:
+{
+  8000f1:	55                   	push   %ebp
+  8000f2:	89 e5                	mov    %esp,%ebp
+  8000f4:	57                   	push   %edi
+  8000f5:	56                   	push   %esi
+  8000f6:	53                   	push   %ebx
+  8000f7:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  8000fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800100:	6a 00                	push   $0x0
+  800102:	57                   	push   %edi
+  800103:	e8 12 1c 00 00       	call   801d1a <open>
+  800108:	89 c3                	mov    %eax,%ebx
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	78 50                	js     800161 <lsdir+0x70>
+	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800111:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800117:	83 ec 04             	sub    $0x4,%esp
+  80011a:	68 00 01 00 00       	push   $0x100
+  80011f:	56                   	push   %esi
+  800120:	53                   	push   %ebx
+  800121:	e8 9f 17 00 00       	call   8018c5 <readn>
+  800126:	83 c4 10             	add    $0x10,%esp
+  800129:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80012e:	75 47                	jne    800177 <lsdir+0x86>
+		if (f.f_name[0])
+  800130:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  800137:	74 de                	je     800117 <lsdir+0x26>
+			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
+  800139:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80013f:	50                   	push   %eax
+  800140:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  800146:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  80014d:	0f 94 c0             	sete   %al
+  800150:	0f b6 c0             	movzbl %al,%eax
+  800153:	50                   	push   %eax
+  800154:	ff 75 0c             	push   0xc(%ebp)
+  800157:	e8 d9 fe ff ff       	call   800035 <ls1>
+  80015c:	83 c4 10             	add    $0x10,%esp
+  80015f:	eb b6                	jmp    800117 <lsdir+0x26>
+		panic("open %s: %e", path, fd);
+  800161:	83 ec 0c             	sub    $0xc,%esp
+  800164:	50                   	push   %eax
+  800165:	57                   	push   %edi
+  800166:	68 70 3f 80 00       	push   $0x803f70
+  80016b:	6a 1d                	push   $0x1d
+  80016d:	68 7c 3f 80 00       	push   $0x803f7c
+  800172:	e8 f7 01 00 00       	call   80036e <_panic>
+	if (n > 0)
+  800177:	85 c0                	test   %eax,%eax
+  800179:	7f 0a                	jg     800185 <lsdir+0x94>
+	if (n < 0)
+  80017b:	78 1a                	js     800197 <lsdir+0xa6>
+}
+  80017d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800180:	5b                   	pop    %ebx
+  800181:	5e                   	pop    %esi
+  800182:	5f                   	pop    %edi
+  800183:	5d                   	pop    %ebp
+  800184:	c3                   	ret
+		panic("short read in directory %s", path);
+  800185:	57                   	push   %edi
+  800186:	68 86 3f 80 00       	push   $0x803f86
+  80018b:	6a 22                	push   $0x22
+  80018d:	68 7c 3f 80 00       	push   $0x803f7c
+  800192:	e8 d7 01 00 00       	call   80036e <_panic>
+		panic("error reading directory %s: %e", path, n);
+  800197:	83 ec 0c             	sub    $0xc,%esp
+  80019a:	50                   	push   %eax
+  80019b:	57                   	push   %edi
+  80019c:	68 cc 3f 80 00       	push   $0x803fcc
+  8001a1:	6a 24                	push   $0x24
+  8001a3:	68 7c 3f 80 00       	push   $0x803f7c
+  8001a8:	e8 c1 01 00 00       	call   80036e <_panic>
+
+008001ad <ls>:
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	53                   	push   %ebx
+  8001b1:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = stat(path, &st)) < 0)
+  8001ba:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8001c0:	50                   	push   %eax
+  8001c1:	53                   	push   %ebx
+  8001c2:	e8 8a 19 00 00       	call   801b51 <stat>
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 24                	js     8001f2 <ls+0x45>
+	if (st.st_isdir && !flag['d'])
+  8001ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8001d1:	85 c0                	test   %eax,%eax
+  8001d3:	74 09                	je     8001de <ls+0x31>
+  8001d5:	83 3d d0 64 80 00 00 	cmpl   $0x0,0x8064d0
+  8001dc:	74 2a                	je     800208 <ls+0x5b>
+		ls1(0, st.st_isdir, st.st_size, path);
+  8001de:	53                   	push   %ebx
+  8001df:	ff 75 e8             	push   -0x18(%ebp)
+  8001e2:	50                   	push   %eax
+  8001e3:	6a 00                	push   $0x0
+  8001e5:	e8 4b fe ff ff       	call   800035 <ls1>
+  8001ea:	83 c4 10             	add    $0x10,%esp
+}
+  8001ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+		panic("stat %s: %e", path, r);
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	50                   	push   %eax
+  8001f6:	53                   	push   %ebx
+  8001f7:	68 a1 3f 80 00       	push   $0x803fa1
+  8001fc:	6a 0f                	push   $0xf
+  8001fe:	68 7c 3f 80 00       	push   $0x803f7c
+  800203:	e8 66 01 00 00       	call   80036e <_panic>
+		lsdir(path, prefix);
+  800208:	83 ec 08             	sub    $0x8,%esp
+  80020b:	ff 75 0c             	push   0xc(%ebp)
+  80020e:	53                   	push   %ebx
+  80020f:	e8 dd fe ff ff       	call   8000f1 <lsdir>
+  800214:	83 c4 10             	add    $0x10,%esp
+  800217:	eb d4                	jmp    8001ed <ls+0x40>
+
+00800219 <usage>:
+
+void
+usage(void)
+{
+  800219:	55                   	push   %ebp
+  80021a:	89 e5                	mov    %esp,%ebp
+  80021c:	83 ec 14             	sub    $0x14,%esp
+	printf("usage: ls [-dFl] [file...]\n");
+  80021f:	68 ad 3f 80 00       	push   $0x803fad
+  800224:	e8 6d 1d 00 00       	call   801f96 <printf>
+	exit();
+  800229:	e8 26 01 00 00       	call   800354 <exit>
+}
+  80022e:	83 c4 10             	add    $0x10,%esp
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+00800233 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	56                   	push   %esi
+  800237:	53                   	push   %ebx
+  800238:	83 ec 14             	sub    $0x14,%esp
+  80023b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  80023e:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  800241:	50                   	push   %eax
+  800242:	56                   	push   %esi
+  800243:	8d 45 08             	lea    0x8(%ebp),%eax
+  800246:	50                   	push   %eax
+  800247:	e8 8b 11 00 00       	call   8013d7 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80024c:	83 c4 10             	add    $0x10,%esp
+  80024f:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  800252:	eb 08                	jmp    80025c <umain+0x29>
+		switch (i) {
+		case 'd':
+		case 'F':
+		case 'l':
+			flag[i]++;
+  800254:	83 04 85 40 63 80 00 	addl   $0x1,0x806340(,%eax,4)
+  80025b:	01 
+	while ((i = argnext(&args)) >= 0)
+  80025c:	83 ec 0c             	sub    $0xc,%esp
+  80025f:	53                   	push   %ebx
+  800260:	e8 a2 11 00 00       	call   801407 <argnext>
+  800265:	83 c4 10             	add    $0x10,%esp
+  800268:	85 c0                	test   %eax,%eax
+  80026a:	78 16                	js     800282 <umain+0x4f>
+		switch (i) {
+  80026c:	89 c2                	mov    %eax,%edx
+  80026e:	83 e2 f7             	and    $0xfffffff7,%edx
+  800271:	83 fa 64             	cmp    $0x64,%edx
+  800274:	74 de                	je     800254 <umain+0x21>
+  800276:	83 f8 46             	cmp    $0x46,%eax
+  800279:	74 d9                	je     800254 <umain+0x21>
+			break;
+		default:
+			usage();
+  80027b:	e8 99 ff ff ff       	call   800219 <usage>
+  800280:	eb da                	jmp    80025c <umain+0x29>
+		}
+
+	if (argc == 1)
+  800282:	8b 45 08             	mov    0x8(%ebp),%eax
+  800285:	83 f8 01             	cmp    $0x1,%eax
+  800288:	74 26                	je     8002b0 <umain+0x7d>
+		ls("/", "");
+	else {
+		for (i = 1; i < argc; i++)
+  80028a:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80028f:	7e 18                	jle    8002a9 <umain+0x76>
+			ls(argv[i], argv[i]);
+  800291:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  800294:	83 ec 08             	sub    $0x8,%esp
+  800297:	50                   	push   %eax
+  800298:	50                   	push   %eax
+  800299:	e8 0f ff ff ff       	call   8001ad <ls>
+		for (i = 1; i < argc; i++)
+  80029e:	83 c3 01             	add    $0x1,%ebx
+  8002a1:	83 c4 10             	add    $0x10,%esp
+  8002a4:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002a7:	7f e8                	jg     800291 <umain+0x5e>
+	}
+}
+  8002a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002ac:	5b                   	pop    %ebx
+  8002ad:	5e                   	pop    %esi
+  8002ae:	5d                   	pop    %ebp
+  8002af:	c3                   	ret
+		ls("/", "");
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	68 c8 3f 80 00       	push   $0x803fc8
+  8002b8:	68 60 3f 80 00       	push   $0x803f60
+  8002bd:	e8 eb fe ff ff       	call   8001ad <ls>
+  8002c2:	83 c4 10             	add    $0x10,%esp
+  8002c5:	eb e2                	jmp    8002a9 <umain+0x76>
+
+008002c7 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002c7:	55                   	push   %ebp
+  8002c8:	89 e5                	mov    %esp,%ebp
+  8002ca:	56                   	push   %esi
+  8002cb:	53                   	push   %ebx
+  8002cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002cf:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8002d2:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8002d4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8002d9:	29 d0                	sub    %edx,%eax
+  8002db:	89 c2                	mov    %eax,%edx
+  8002dd:	c1 ea 0f             	shr    $0xf,%edx
+  8002e0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8002e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ea:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8002ed:	c7 04 85 40 67 80 00 	movl   $0x0,0x806740(,%eax,4)
+  8002f4:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8002f8:	e8 39 0c 00 00       	call   800f36 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8002fd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800302:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800308:	89 e1                	mov    %esp,%ecx
+  80030a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80030f:	29 ca                	sub    %ecx,%edx
+  800311:	89 d1                	mov    %edx,%ecx
+  800313:	c1 e9 0f             	shr    $0xf,%ecx
+  800316:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80031c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800321:	0f 42 d1             	cmovb  %ecx,%edx
+  800324:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800329:	89 04 95 40 67 80 00 	mov    %eax,0x806740(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800330:	85 db                	test   %ebx,%ebx
+  800332:	7e 07                	jle    80033b <libmain+0x74>
+		binaryname = argv[0];
+  800334:	8b 06                	mov    (%esi),%eax
+  800336:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80033b:	83 ec 08             	sub    $0x8,%esp
+  80033e:	56                   	push   %esi
+  80033f:	53                   	push   %ebx
+  800340:	e8 ee fe ff ff       	call   800233 <umain>
+
+	// exit gracefully
+	exit();
+  800345:	e8 0a 00 00 00       	call   800354 <exit>
+}
+  80034a:	83 c4 10             	add    $0x10,%esp
+  80034d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800350:	5b                   	pop    %ebx
+  800351:	5e                   	pop    %esi
+  800352:	5d                   	pop    %ebp
+  800353:	c3                   	ret
+
+00800354 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800354:	55                   	push   %ebp
+  800355:	89 e5                	mov    %esp,%ebp
+  800357:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80035a:	e8 b0 13 00 00       	call   80170f <close_all>
+	sys_env_destroy(0);
+  80035f:	83 ec 0c             	sub    $0xc,%esp
+  800362:	6a 00                	push   $0x0
+  800364:	e8 8c 0b 00 00       	call   800ef5 <sys_env_destroy>
+}
+  800369:	83 c4 10             	add    $0x10,%esp
+  80036c:	c9                   	leave
+  80036d:	c3                   	ret
+
+0080036e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80036e:	55                   	push   %ebp
+  80036f:	89 e5                	mov    %esp,%ebp
+  800371:	56                   	push   %esi
+  800372:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800373:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800376:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80037c:	e8 b5 0b 00 00       	call   800f36 <sys_getenvid>
+  800381:	83 ec 0c             	sub    $0xc,%esp
+  800384:	ff 75 0c             	push   0xc(%ebp)
+  800387:	ff 75 08             	push   0x8(%ebp)
+  80038a:	56                   	push   %esi
+  80038b:	50                   	push   %eax
+  80038c:	68 f8 3f 80 00       	push   $0x803ff8
+  800391:	e8 b3 00 00 00       	call   800449 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800396:	83 c4 18             	add    $0x18,%esp
+  800399:	53                   	push   %ebx
+  80039a:	ff 75 10             	push   0x10(%ebp)
+  80039d:	e8 56 00 00 00       	call   8003f8 <vcprintf>
+	cprintf("\n");
+  8003a2:	c7 04 24 c7 3f 80 00 	movl   $0x803fc7,(%esp)
+  8003a9:	e8 9b 00 00 00       	call   800449 <cprintf>
+  8003ae:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003b1:	cc                   	int3
+	while (1)
+  8003b2:	eb fd                	jmp    8003b1 <_panic+0x43>
+
+008003b4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003b4:	55                   	push   %ebp
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	53                   	push   %ebx
+  8003b8:	83 ec 04             	sub    $0x4,%esp
+  8003bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003be:	8b 13                	mov    (%ebx),%edx
+  8003c0:	8d 42 01             	lea    0x1(%edx),%eax
+  8003c3:	89 03                	mov    %eax,(%ebx)
+  8003c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003c8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003cc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003d1:	74 09                	je     8003dc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003d3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003da:	c9                   	leave
+  8003db:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+  8003df:	68 ff 00 00 00       	push   $0xff
+  8003e4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003e7:	50                   	push   %eax
+  8003e8:	e8 cb 0a 00 00       	call   800eb8 <sys_cputs>
+		b->idx = 0;
+  8003ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003f3:	83 c4 10             	add    $0x10,%esp
+  8003f6:	eb db                	jmp    8003d3 <putch+0x1f>
+
+008003f8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003f8:	55                   	push   %ebp
+  8003f9:	89 e5                	mov    %esp,%ebp
+  8003fb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800401:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800408:	00 00 00 
+	b.cnt = 0;
+  80040b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800412:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800415:	ff 75 0c             	push   0xc(%ebp)
+  800418:	ff 75 08             	push   0x8(%ebp)
+  80041b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800421:	50                   	push   %eax
+  800422:	68 b4 03 80 00       	push   $0x8003b4
+  800427:	e8 1c 01 00 00       	call   800548 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80042c:	83 c4 08             	add    $0x8,%esp
+  80042f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800435:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80043b:	50                   	push   %eax
+  80043c:	e8 77 0a 00 00       	call   800eb8 <sys_cputs>
+
+	return b.cnt;
+}
+  800441:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800447:	c9                   	leave
+  800448:	c3                   	ret
+
+00800449 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800449:	55                   	push   %ebp
+  80044a:	89 e5                	mov    %esp,%ebp
+  80044c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80044f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800452:	50                   	push   %eax
+  800453:	ff 75 08             	push   0x8(%ebp)
+  800456:	e8 9d ff ff ff       	call   8003f8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+
+0080045d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80045d:	55                   	push   %ebp
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	57                   	push   %edi
+  800461:	56                   	push   %esi
+  800462:	53                   	push   %ebx
+  800463:	83 ec 1c             	sub    $0x1c,%esp
+  800466:	89 c3                	mov    %eax,%ebx
+  800468:	89 d6                	mov    %edx,%esi
+  80046a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800470:	89 d1                	mov    %edx,%ecx
+  800472:	89 c2                	mov    %eax,%edx
+  800474:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800477:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80047a:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80047d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800480:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800487:	39 c2                	cmp    %eax,%edx
+  800489:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80048c:	73 4b                	jae    8004d9 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800494:	85 ff                	test   %edi,%edi
+  800496:	7e 11                	jle    8004a9 <printnum+0x4c>
+			putch(padc, putdat);
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	56                   	push   %esi
+  80049c:	ff 75 18             	push   0x18(%ebp)
+  80049f:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8004a1:	83 c4 10             	add    $0x10,%esp
+  8004a4:	83 ef 01             	sub    $0x1,%edi
+  8004a7:	75 ef                	jne    800498 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004a9:	83 ec 08             	sub    $0x8,%esp
+  8004ac:	56                   	push   %esi
+  8004ad:	83 ec 04             	sub    $0x4,%esp
+  8004b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8004b3:	ff 75 e0             	push   -0x20(%ebp)
+  8004b6:	ff 75 dc             	push   -0x24(%ebp)
+  8004b9:	ff 75 d8             	push   -0x28(%ebp)
+  8004bc:	e8 8d 39 00 00       	call   803e4e <__umoddi3>
+  8004c1:	83 c4 14             	add    $0x14,%esp
+  8004c4:	0f be 80 1b 40 80 00 	movsbl 0x80401b(%eax),%eax
+  8004cb:	50                   	push   %eax
+  8004cc:	ff d3                	call   *%ebx
+}
+  8004ce:	83 c4 10             	add    $0x10,%esp
+  8004d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004d4:	5b                   	pop    %ebx
+  8004d5:	5e                   	pop    %esi
+  8004d6:	5f                   	pop    %edi
+  8004d7:	5d                   	pop    %ebp
+  8004d8:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004d9:	83 ec 0c             	sub    $0xc,%esp
+  8004dc:	ff 75 18             	push   0x18(%ebp)
+  8004df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004e2:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004e5:	52                   	push   %edx
+  8004e6:	50                   	push   %eax
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ed:	ff 75 e0             	push   -0x20(%ebp)
+  8004f0:	ff 75 dc             	push   -0x24(%ebp)
+  8004f3:	ff 75 d8             	push   -0x28(%ebp)
+  8004f6:	e8 8d 38 00 00       	call   803d88 <__udivdi3>
+  8004fb:	83 c4 18             	add    $0x18,%esp
+  8004fe:	52                   	push   %edx
+  8004ff:	50                   	push   %eax
+  800500:	89 f2                	mov    %esi,%edx
+  800502:	89 d8                	mov    %ebx,%eax
+  800504:	e8 54 ff ff ff       	call   80045d <printnum>
+  800509:	83 c4 20             	add    $0x20,%esp
+  80050c:	eb 9b                	jmp    8004a9 <printnum+0x4c>
+
+0080050e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80050e:	55                   	push   %ebp
+  80050f:	89 e5                	mov    %esp,%ebp
+  800511:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800514:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800518:	8b 10                	mov    (%eax),%edx
+  80051a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80051d:	73 0a                	jae    800529 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80051f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800522:	89 08                	mov    %ecx,(%eax)
+  800524:	8b 45 08             	mov    0x8(%ebp),%eax
+  800527:	88 02                	mov    %al,(%edx)
+}
+  800529:	5d                   	pop    %ebp
+  80052a:	c3                   	ret
+
+0080052b <printfmt>:
+{
+  80052b:	55                   	push   %ebp
+  80052c:	89 e5                	mov    %esp,%ebp
+  80052e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800531:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800534:	50                   	push   %eax
+  800535:	ff 75 10             	push   0x10(%ebp)
+  800538:	ff 75 0c             	push   0xc(%ebp)
+  80053b:	ff 75 08             	push   0x8(%ebp)
+  80053e:	e8 05 00 00 00       	call   800548 <vprintfmt>
+}
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	c9                   	leave
+  800547:	c3                   	ret
+
+00800548 <vprintfmt>:
+{
+  800548:	55                   	push   %ebp
+  800549:	89 e5                	mov    %esp,%ebp
+  80054b:	57                   	push   %edi
+  80054c:	56                   	push   %esi
+  80054d:	53                   	push   %ebx
+  80054e:	83 ec 2c             	sub    $0x2c,%esp
+  800551:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800554:	89 df                	mov    %ebx,%edi
+  800556:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800559:	8b 45 10             	mov    0x10(%ebp),%eax
+  80055c:	8d 70 01             	lea    0x1(%eax),%esi
+  80055f:	0f b6 00             	movzbl (%eax),%eax
+  800562:	83 f8 25             	cmp    $0x25,%eax
+  800565:	74 1e                	je     800585 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800567:	85 c0                	test   %eax,%eax
+  800569:	0f 84 15 05 00 00    	je     800a84 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80056f:	83 ec 08             	sub    $0x8,%esp
+  800572:	53                   	push   %ebx
+  800573:	50                   	push   %eax
+  800574:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800576:	83 c6 01             	add    $0x1,%esi
+  800579:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80057d:	83 c4 10             	add    $0x10,%esp
+  800580:	83 f8 25             	cmp    $0x25,%eax
+  800583:	75 e2                	jne    800567 <vprintfmt+0x1f>
+		padc = ' ';
+  800585:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800589:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800590:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800597:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80059e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a3:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005a6:	8d 56 01             	lea    0x1(%esi),%edx
+  8005a9:	0f b6 0e             	movzbl (%esi),%ecx
+  8005ac:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005af:	3c 55                	cmp    $0x55,%al
+  8005b1:	0f 87 3b 04 00 00    	ja     8009f2 <vprintfmt+0x4aa>
+  8005b7:	0f b6 c0             	movzbl %al,%eax
+  8005ba:	ff 24 85 80 41 80 00 	jmp    *0x804180(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8005c1:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005c4:	eb 93                	jmp    800559 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c6:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8005c8:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005cc:	eb d8                	jmp    8005a6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ce:	89 d6                	mov    %edx,%esi
+  8005d0:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005d4:	eb d0                	jmp    8005a6 <vprintfmt+0x5e>
+  8005d6:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8005d9:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005dc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8005df:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8005e3:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005e6:	83 f9 09             	cmp    $0x9,%ecx
+  8005e9:	77 6f                	ja     80065a <vprintfmt+0x112>
+  8005eb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8005ee:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8005f1:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8005f4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8005f8:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8005fb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005fe:	83 fe 09             	cmp    $0x9,%esi
+  800601:	76 eb                	jbe    8005ee <vprintfmt+0xa6>
+  800603:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800606:	89 d6                	mov    %edx,%esi
+  800608:	eb 13                	jmp    80061d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8b 00                	mov    (%eax),%eax
+  80060f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800612:	8b 45 14             	mov    0x14(%ebp),%eax
+  800615:	8d 40 04             	lea    0x4(%eax),%eax
+  800618:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80061b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80061d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800621:	79 83                	jns    8005a6 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800623:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800626:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800629:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800630:	e9 71 ff ff ff       	jmp    8005a6 <vprintfmt+0x5e>
+			if (width < 0)
+  800635:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800638:	85 c9                	test   %ecx,%ecx
+  80063a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063f:	0f 49 c1             	cmovns %ecx,%eax
+  800642:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800645:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800647:	e9 5a ff ff ff       	jmp    8005a6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80064c:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80064e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800655:	e9 4c ff ff ff       	jmp    8005a6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80065a:	89 d6                	mov    %edx,%esi
+  80065c:	eb bf                	jmp    80061d <vprintfmt+0xd5>
+			lflag++;
+  80065e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800662:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800664:	e9 3d ff ff ff       	jmp    8005a6 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800669:	89 55 10             	mov    %edx,0x10(%ebp)
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8d 70 04             	lea    0x4(%eax),%esi
+  800672:	83 ec 08             	sub    $0x8,%esp
+  800675:	53                   	push   %ebx
+  800676:	ff 30                	push   (%eax)
+  800678:	ff d7                	call   *%edi
+			break;
+  80067a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80067d:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800680:	e9 d4 fe ff ff       	jmp    800559 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800685:	89 55 10             	mov    %edx,0x10(%ebp)
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	89 d0                	mov    %edx,%eax
+  800692:	f7 d8                	neg    %eax
+  800694:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800697:	83 f8 12             	cmp    $0x12,%eax
+  80069a:	7f 23                	jg     8006bf <vprintfmt+0x177>
+  80069c:	8b 14 85 e0 42 80 00 	mov    0x8042e0(,%eax,4),%edx
+  8006a3:	85 d2                	test   %edx,%edx
+  8006a5:	74 18                	je     8006bf <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8006a7:	52                   	push   %edx
+  8006a8:	68 3b 44 80 00       	push   $0x80443b
+  8006ad:	53                   	push   %ebx
+  8006ae:	57                   	push   %edi
+  8006af:	e8 77 fe ff ff       	call   80052b <printfmt>
+  8006b4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006b7:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006ba:	e9 9a fe ff ff       	jmp    800559 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8006bf:	50                   	push   %eax
+  8006c0:	68 33 40 80 00       	push   $0x804033
+  8006c5:	53                   	push   %ebx
+  8006c6:	57                   	push   %edi
+  8006c7:	e8 5f fe ff ff       	call   80052b <printfmt>
+  8006cc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006cf:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006d2:	e9 82 fe ff ff       	jmp    800559 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006d7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	83 c0 04             	add    $0x4,%eax
+  8006e0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 00                	mov    (%eax),%eax
+  8006e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	0f 84 61 03 00 00    	je     800a54 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8006f3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006f7:	7e 06                	jle    8006ff <vprintfmt+0x1b7>
+  8006f9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8006fd:	75 29                	jne    800728 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006ff:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800702:	8d 70 01             	lea    0x1(%eax),%esi
+  800705:	0f b6 00             	movzbl (%eax),%eax
+  800708:	0f be d0             	movsbl %al,%edx
+  80070b:	85 d2                	test   %edx,%edx
+  80070d:	0f 84 bb 00 00 00    	je     8007ce <vprintfmt+0x286>
+  800713:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800716:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800719:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80071c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80071f:	eb 7a                	jmp    80079b <vprintfmt+0x253>
+				p = "(null)";
+  800721:	c7 45 d0 2c 40 80 00 	movl   $0x80402c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800728:	83 ec 08             	sub    $0x8,%esp
+  80072b:	ff 75 d4             	push   -0x2c(%ebp)
+  80072e:	ff 75 d0             	push   -0x30(%ebp)
+  800731:	e8 e0 03 00 00       	call   800b16 <strnlen>
+  800736:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800739:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	85 d2                	test   %edx,%edx
+  800741:	0f 8e d6 02 00 00    	jle    800a1d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800747:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80074b:	83 ec 08             	sub    $0x8,%esp
+  80074e:	53                   	push   %ebx
+  80074f:	56                   	push   %esi
+  800750:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800752:	83 c4 10             	add    $0x10,%esp
+  800755:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800759:	75 f0                	jne    80074b <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80075b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80075e:	8d 70 01             	lea    0x1(%eax),%esi
+  800761:	0f b6 00             	movzbl (%eax),%eax
+  800764:	0f be d0             	movsbl %al,%edx
+  800767:	85 d2                	test   %edx,%edx
+  800769:	0f 84 da 02 00 00    	je     800a49 <vprintfmt+0x501>
+  80076f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800772:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800775:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800778:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80077b:	eb 1e                	jmp    80079b <vprintfmt+0x253>
+					putch(ch, putdat);
+  80077d:	83 ec 08             	sub    $0x8,%esp
+  800780:	ff 75 0c             	push   0xc(%ebp)
+  800783:	52                   	push   %edx
+  800784:	ff 55 08             	call   *0x8(%ebp)
+  800787:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80078a:	83 eb 01             	sub    $0x1,%ebx
+  80078d:	83 c6 01             	add    $0x1,%esi
+  800790:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800794:	0f be d0             	movsbl %al,%edx
+  800797:	85 d2                	test   %edx,%edx
+  800799:	74 2a                	je     8007c5 <vprintfmt+0x27d>
+  80079b:	85 ff                	test   %edi,%edi
+  80079d:	78 05                	js     8007a4 <vprintfmt+0x25c>
+  80079f:	83 ef 01             	sub    $0x1,%edi
+  8007a2:	78 59                	js     8007fd <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007a4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007a8:	74 d3                	je     80077d <vprintfmt+0x235>
+  8007aa:	0f be c0             	movsbl %al,%eax
+  8007ad:	83 e8 20             	sub    $0x20,%eax
+  8007b0:	83 f8 5e             	cmp    $0x5e,%eax
+  8007b3:	76 c8                	jbe    80077d <vprintfmt+0x235>
+					putch('?', putdat);
+  8007b5:	83 ec 08             	sub    $0x8,%esp
+  8007b8:	ff 75 0c             	push   0xc(%ebp)
+  8007bb:	6a 3f                	push   $0x3f
+  8007bd:	ff 55 08             	call   *0x8(%ebp)
+  8007c0:	83 c4 10             	add    $0x10,%esp
+  8007c3:	eb c5                	jmp    80078a <vprintfmt+0x242>
+  8007c5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007c8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8007ce:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007d1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007d5:	7e 1b                	jle    8007f2 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8007d7:	83 ec 08             	sub    $0x8,%esp
+  8007da:	53                   	push   %ebx
+  8007db:	6a 20                	push   $0x20
+  8007dd:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007df:	83 c4 10             	add    $0x10,%esp
+  8007e2:	83 ee 01             	sub    $0x1,%esi
+  8007e5:	75 f0                	jne    8007d7 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007e7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ed:	e9 67 fd ff ff       	jmp    800559 <vprintfmt+0x11>
+  8007f2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f8:	e9 5c fd ff ff       	jmp    800559 <vprintfmt+0x11>
+  8007fd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800800:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800803:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800806:	eb c6                	jmp    8007ce <vprintfmt+0x286>
+	if (lflag >= 2)
+  800808:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80080b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80080e:	83 f9 01             	cmp    $0x1,%ecx
+  800811:	7f 1f                	jg     800832 <vprintfmt+0x2ea>
+	else if (lflag)
+  800813:	85 c9                	test   %ecx,%ecx
+  800815:	74 67                	je     80087e <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081a:	8b 30                	mov    (%eax),%esi
+  80081c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80081f:	89 f0                	mov    %esi,%eax
+  800821:	c1 f8 1f             	sar    $0x1f,%eax
+  800824:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8d 40 04             	lea    0x4(%eax),%eax
+  80082d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800830:	eb 17                	jmp    800849 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800832:	8b 45 14             	mov    0x14(%ebp),%eax
+  800835:	8b 50 04             	mov    0x4(%eax),%edx
+  800838:	8b 00                	mov    (%eax),%eax
+  80083a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80083d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8d 40 08             	lea    0x8(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800849:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80084c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80084f:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800854:	85 c9                	test   %ecx,%ecx
+  800856:	0f 89 12 01 00 00    	jns    80096e <vprintfmt+0x426>
+				putch('-', putdat);
+  80085c:	83 ec 08             	sub    $0x8,%esp
+  80085f:	53                   	push   %ebx
+  800860:	6a 2d                	push   $0x2d
+  800862:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800864:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800867:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80086a:	f7 da                	neg    %edx
+  80086c:	83 d1 00             	adc    $0x0,%ecx
+  80086f:	f7 d9                	neg    %ecx
+  800871:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800874:	be 0a 00 00 00       	mov    $0xa,%esi
+  800879:	e9 f0 00 00 00       	jmp    80096e <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80087e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800881:	8b 30                	mov    (%eax),%esi
+  800883:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800886:	89 f0                	mov    %esi,%eax
+  800888:	c1 f8 1f             	sar    $0x1f,%eax
+  80088b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80088e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800891:	8d 40 04             	lea    0x4(%eax),%eax
+  800894:	89 45 14             	mov    %eax,0x14(%ebp)
+  800897:	eb b0                	jmp    800849 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800899:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80089c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80089f:	83 f9 01             	cmp    $0x1,%ecx
+  8008a2:	7f 1e                	jg     8008c2 <vprintfmt+0x37a>
+	else if (lflag)
+  8008a4:	85 c9                	test   %ecx,%ecx
+  8008a6:	74 32                	je     8008da <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8008a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ab:	8b 10                	mov    (%eax),%edx
+  8008ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008b8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8008bd:	e9 ac 00 00 00       	jmp    80096e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c5:	8b 10                	mov    (%eax),%edx
+  8008c7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ca:	8d 40 08             	lea    0x8(%eax),%eax
+  8008cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008d0:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8008d5:	e9 94 00 00 00       	jmp    80096e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dd:	8b 10                	mov    (%eax),%edx
+  8008df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008ea:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8008ef:	eb 7d                	jmp    80096e <vprintfmt+0x426>
+	if (lflag >= 2)
+  8008f1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008f4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008f7:	83 f9 01             	cmp    $0x1,%ecx
+  8008fa:	7f 1b                	jg     800917 <vprintfmt+0x3cf>
+	else if (lflag)
+  8008fc:	85 c9                	test   %ecx,%ecx
+  8008fe:	74 2c                	je     80092c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800900:	8b 45 14             	mov    0x14(%ebp),%eax
+  800903:	8b 10                	mov    (%eax),%edx
+  800905:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80090a:	8d 40 04             	lea    0x4(%eax),%eax
+  80090d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800910:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800915:	eb 57                	jmp    80096e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800917:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091a:	8b 10                	mov    (%eax),%edx
+  80091c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80091f:	8d 40 08             	lea    0x8(%eax),%eax
+  800922:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800925:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80092a:	eb 42                	jmp    80096e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80092c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092f:	8b 10                	mov    (%eax),%edx
+  800931:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800936:	8d 40 04             	lea    0x4(%eax),%eax
+  800939:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80093c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800941:	eb 2b                	jmp    80096e <vprintfmt+0x426>
+			putch('0', putdat);
+  800943:	89 55 10             	mov    %edx,0x10(%ebp)
+  800946:	83 ec 08             	sub    $0x8,%esp
+  800949:	53                   	push   %ebx
+  80094a:	6a 30                	push   $0x30
+  80094c:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80094e:	83 c4 08             	add    $0x8,%esp
+  800951:	53                   	push   %ebx
+  800952:	6a 78                	push   $0x78
+  800954:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800956:	8b 45 14             	mov    0x14(%ebp),%eax
+  800959:	8b 10                	mov    (%eax),%edx
+  80095b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800960:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800963:	8d 40 04             	lea    0x4(%eax),%eax
+  800966:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800969:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80096e:	83 ec 0c             	sub    $0xc,%esp
+  800971:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800975:	50                   	push   %eax
+  800976:	ff 75 e4             	push   -0x1c(%ebp)
+  800979:	56                   	push   %esi
+  80097a:	51                   	push   %ecx
+  80097b:	52                   	push   %edx
+  80097c:	89 da                	mov    %ebx,%edx
+  80097e:	89 f8                	mov    %edi,%eax
+  800980:	e8 d8 fa ff ff       	call   80045d <printnum>
+			break;
+  800985:	83 c4 20             	add    $0x20,%esp
+  800988:	e9 cc fb ff ff       	jmp    800559 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80098d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800990:	89 55 10             	mov    %edx,0x10(%ebp)
+  800993:	83 f9 01             	cmp    $0x1,%ecx
+  800996:	7f 1b                	jg     8009b3 <vprintfmt+0x46b>
+	else if (lflag)
+  800998:	85 c9                	test   %ecx,%ecx
+  80099a:	74 2c                	je     8009c8 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80099c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099f:	8b 10                	mov    (%eax),%edx
+  8009a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ac:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009b1:	eb bb                	jmp    80096e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b6:	8b 10                	mov    (%eax),%edx
+  8009b8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8009be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009c1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8009c6:	eb a6                	jmp    80096e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cb:	8b 10                	mov    (%eax),%edx
+  8009cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009d8:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8009dd:	eb 8f                	jmp    80096e <vprintfmt+0x426>
+			putch(ch, putdat);
+  8009df:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009e2:	83 ec 08             	sub    $0x8,%esp
+  8009e5:	53                   	push   %ebx
+  8009e6:	6a 25                	push   $0x25
+  8009e8:	ff d7                	call   *%edi
+			break;
+  8009ea:	83 c4 10             	add    $0x10,%esp
+  8009ed:	e9 67 fb ff ff       	jmp    800559 <vprintfmt+0x11>
+			putch('%', putdat);
+  8009f2:	83 ec 08             	sub    $0x8,%esp
+  8009f5:	53                   	push   %ebx
+  8009f6:	6a 25                	push   $0x25
+  8009f8:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009fa:	83 c4 10             	add    $0x10,%esp
+  8009fd:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a01:	0f 84 ba fb ff ff    	je     8005c1 <vprintfmt+0x79>
+  800a07:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a0a:	89 f0                	mov    %esi,%eax
+  800a0c:	83 e8 01             	sub    $0x1,%eax
+  800a0f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a13:	75 f7                	jne    800a0c <vprintfmt+0x4c4>
+  800a15:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a18:	e9 3c fb ff ff       	jmp    800559 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a1d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a20:	8d 70 01             	lea    0x1(%eax),%esi
+  800a23:	0f b6 00             	movzbl (%eax),%eax
+  800a26:	0f be d0             	movsbl %al,%edx
+  800a29:	85 d2                	test   %edx,%edx
+  800a2b:	74 11                	je     800a3e <vprintfmt+0x4f6>
+  800a2d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a30:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a33:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a36:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a39:	e9 5d fd ff ff       	jmp    80079b <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a3e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a41:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a44:	e9 10 fb ff ff       	jmp    800559 <vprintfmt+0x11>
+  800a49:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a4c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a4f:	e9 05 fb ff ff       	jmp    800559 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a54:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a58:	7e 0a                	jle    800a64 <vprintfmt+0x51c>
+  800a5a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a5e:	0f 85 bd fc ff ff    	jne    800721 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a64:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a69:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a6e:	be 2d 40 80 00       	mov    $0x80402d,%esi
+  800a73:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a76:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a79:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a7c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a7f:	e9 17 fd ff ff       	jmp    80079b <vprintfmt+0x253>
+}
+  800a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a87:	5b                   	pop    %ebx
+  800a88:	5e                   	pop    %esi
+  800a89:	5f                   	pop    %edi
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	83 ec 18             	sub    $0x18,%esp
+  800a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a95:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a98:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a9b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a9f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800aa2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800aa9:	85 c0                	test   %eax,%eax
+  800aab:	74 26                	je     800ad3 <vsnprintf+0x47>
+  800aad:	85 d2                	test   %edx,%edx
+  800aaf:	7e 22                	jle    800ad3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ab1:	ff 75 14             	push   0x14(%ebp)
+  800ab4:	ff 75 10             	push   0x10(%ebp)
+  800ab7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800aba:	50                   	push   %eax
+  800abb:	68 0e 05 80 00       	push   $0x80050e
+  800ac0:	e8 83 fa ff ff       	call   800548 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ac5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ac8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800acb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ace:	83 c4 10             	add    $0x10,%esp
+}
+  800ad1:	c9                   	leave
+  800ad2:	c3                   	ret
+		return -E_INVAL;
+  800ad3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad8:	eb f7                	jmp    800ad1 <vsnprintf+0x45>
+
+00800ada <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ada:	55                   	push   %ebp
+  800adb:	89 e5                	mov    %esp,%ebp
+  800add:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ae0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ae3:	50                   	push   %eax
+  800ae4:	ff 75 10             	push   0x10(%ebp)
+  800ae7:	ff 75 0c             	push   0xc(%ebp)
+  800aea:	ff 75 08             	push   0x8(%ebp)
+  800aed:	e8 9a ff ff ff       	call   800a8c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+
+00800af4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800afa:	80 3a 00             	cmpb   $0x0,(%edx)
+  800afd:	74 10                	je     800b0f <strlen+0x1b>
+  800aff:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b04:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b07:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b0b:	75 f7                	jne    800b04 <strlen+0x10>
+	return n;
+}
+  800b0d:	5d                   	pop    %ebp
+  800b0e:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b14:	eb f7                	jmp    800b0d <strlen+0x19>
+
+00800b16 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b1f:	85 d2                	test   %edx,%edx
+  800b21:	74 16                	je     800b39 <strnlen+0x23>
+  800b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b28:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b2c:	74 09                	je     800b37 <strnlen+0x21>
+		n++;
+  800b2e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b31:	39 d0                	cmp    %edx,%eax
+  800b33:	75 f3                	jne    800b28 <strnlen+0x12>
+		n++;
+  800b35:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3e:	eb f7                	jmp    800b37 <strnlen+0x21>
+
+00800b40 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	53                   	push   %ebx
+  800b44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b53:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b56:	83 c0 01             	add    $0x1,%eax
+  800b59:	84 d2                	test   %dl,%dl
+  800b5b:	75 f2                	jne    800b4f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b5d:	89 c8                	mov    %ecx,%eax
+  800b5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b62:	c9                   	leave
+  800b63:	c3                   	ret
+
+00800b64 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b64:	55                   	push   %ebp
+  800b65:	89 e5                	mov    %esp,%ebp
+  800b67:	53                   	push   %ebx
+  800b68:	83 ec 10             	sub    $0x10,%esp
+  800b6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b6e:	53                   	push   %ebx
+  800b6f:	e8 80 ff ff ff       	call   800af4 <strlen>
+  800b74:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b77:	ff 75 0c             	push   0xc(%ebp)
+  800b7a:	01 d8                	add    %ebx,%eax
+  800b7c:	50                   	push   %eax
+  800b7d:	e8 be ff ff ff       	call   800b40 <strcpy>
+	return dst;
+}
+  800b82:	89 d8                	mov    %ebx,%eax
+  800b84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b87:	c9                   	leave
+  800b88:	c3                   	ret
+
+00800b89 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+  800b8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b91:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b97:	85 db                	test   %ebx,%ebx
+  800b99:	74 17                	je     800bb2 <strncpy+0x29>
+  800b9b:	01 f3                	add    %esi,%ebx
+  800b9d:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800b9f:	83 c0 01             	add    $0x1,%eax
+  800ba2:	0f b6 0a             	movzbl (%edx),%ecx
+  800ba5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ba8:	80 f9 01             	cmp    $0x1,%cl
+  800bab:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bae:	39 c3                	cmp    %eax,%ebx
+  800bb0:	75 ed                	jne    800b9f <strncpy+0x16>
+	}
+	return ret;
+}
+  800bb2:	89 f0                	mov    %esi,%eax
+  800bb4:	5b                   	pop    %ebx
+  800bb5:	5e                   	pop    %esi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+
+00800bb8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	56                   	push   %esi
+  800bbc:	53                   	push   %ebx
+  800bbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bc6:	89 f0                	mov    %esi,%eax
+  800bc8:	85 db                	test   %ebx,%ebx
+  800bca:	74 1e                	je     800bea <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800bcc:	83 eb 01             	sub    $0x1,%ebx
+  800bcf:	74 16                	je     800be7 <strlcpy+0x2f>
+  800bd1:	01 f3                	add    %esi,%ebx
+  800bd3:	0f b6 0a             	movzbl (%edx),%ecx
+  800bd6:	84 c9                	test   %cl,%cl
+  800bd8:	74 0d                	je     800be7 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800bda:	83 c2 01             	add    $0x1,%edx
+  800bdd:	83 c0 01             	add    $0x1,%eax
+  800be0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800be3:	39 d8                	cmp    %ebx,%eax
+  800be5:	75 ec                	jne    800bd3 <strlcpy+0x1b>
+		*dst = '\0';
+  800be7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bea:	29 f0                	sub    %esi,%eax
+}
+  800bec:	5b                   	pop    %ebx
+  800bed:	5e                   	pop    %esi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+
+00800bf0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800bf9:	0f b6 01             	movzbl (%ecx),%eax
+  800bfc:	84 c0                	test   %al,%al
+  800bfe:	74 11                	je     800c11 <strcmp+0x21>
+  800c00:	38 02                	cmp    %al,(%edx)
+  800c02:	75 0d                	jne    800c11 <strcmp+0x21>
+		p++, q++;
+  800c04:	83 c1 01             	add    $0x1,%ecx
+  800c07:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c0a:	0f b6 01             	movzbl (%ecx),%eax
+  800c0d:	84 c0                	test   %al,%al
+  800c0f:	75 ef                	jne    800c00 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c11:	0f b6 c0             	movzbl %al,%eax
+  800c14:	0f b6 12             	movzbl (%edx),%edx
+  800c17:	29 d0                	sub    %edx,%eax
+}
+  800c19:	5d                   	pop    %ebp
+  800c1a:	c3                   	ret
+
+00800c1b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	53                   	push   %ebx
+  800c1f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c22:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c25:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c28:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c2d:	85 d2                	test   %edx,%edx
+  800c2f:	74 2e                	je     800c5f <strncmp+0x44>
+  800c31:	0f b6 01             	movzbl (%ecx),%eax
+  800c34:	84 c0                	test   %al,%al
+  800c36:	74 16                	je     800c4e <strncmp+0x33>
+  800c38:	3a 03                	cmp    (%ebx),%al
+  800c3a:	75 12                	jne    800c4e <strncmp+0x33>
+		n--, p++, q++;
+  800c3c:	83 c1 01             	add    $0x1,%ecx
+  800c3f:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800c42:	83 ea 01             	sub    $0x1,%edx
+  800c45:	75 ea                	jne    800c31 <strncmp+0x16>
+		return 0;
+  800c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4c:	eb 11                	jmp    800c5f <strncmp+0x44>
+  800c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800c53:	85 d2                	test   %edx,%edx
+  800c55:	74 08                	je     800c5f <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c57:	0f b6 01             	movzbl (%ecx),%eax
+  800c5a:	0f b6 13             	movzbl (%ebx),%edx
+  800c5d:	29 d0                	sub    %edx,%eax
+}
+  800c5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c62:	c9                   	leave
+  800c63:	c3                   	ret
+
+00800c64 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c6e:	0f b6 10             	movzbl (%eax),%edx
+  800c71:	84 d2                	test   %dl,%dl
+  800c73:	74 15                	je     800c8a <strchr+0x26>
+		if (*s == c)
+  800c75:	38 d1                	cmp    %dl,%cl
+  800c77:	74 0f                	je     800c88 <strchr+0x24>
+	for (; *s; s++)
+  800c79:	83 c0 01             	add    $0x1,%eax
+  800c7c:	0f b6 10             	movzbl (%eax),%edx
+  800c7f:	84 d2                	test   %dl,%dl
+  800c81:	75 f2                	jne    800c75 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c88:	5d                   	pop    %ebp
+  800c89:	c3                   	ret
+	return 0;
+  800c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8f:	eb f7                	jmp    800c88 <strchr+0x24>
+
+00800c91 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	53                   	push   %ebx
+  800c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c98:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800c9b:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800c9e:	38 d3                	cmp    %dl,%bl
+  800ca0:	74 14                	je     800cb6 <strfind+0x25>
+  800ca2:	89 d1                	mov    %edx,%ecx
+  800ca4:	84 db                	test   %bl,%bl
+  800ca6:	74 0e                	je     800cb6 <strfind+0x25>
+	for (; *s; s++)
+  800ca8:	83 c0 01             	add    $0x1,%eax
+  800cab:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cae:	38 ca                	cmp    %cl,%dl
+  800cb0:	74 04                	je     800cb6 <strfind+0x25>
+  800cb2:	84 d2                	test   %dl,%dl
+  800cb4:	75 f2                	jne    800ca8 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800cb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cb9:	c9                   	leave
+  800cba:	c3                   	ret
+
+00800cbb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	57                   	push   %edi
+  800cbf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cc2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cc5:	85 c9                	test   %ecx,%ecx
+  800cc7:	74 20                	je     800ce9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cc9:	89 f8                	mov    %edi,%eax
+  800ccb:	09 c8                	or     %ecx,%eax
+  800ccd:	a8 03                	test   $0x3,%al
+  800ccf:	75 12                	jne    800ce3 <memset+0x28>
+		c &= 0xFF;
+  800cd1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cd5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cdb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cde:	fc                   	cld
+  800cdf:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ce1:	eb 06                	jmp    800ce9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ce3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce6:	fc                   	cld
+  800ce7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ce9:	89 f8                	mov    %edi,%eax
+  800ceb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cee:	c9                   	leave
+  800cef:	c3                   	ret
+
+00800cf0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	57                   	push   %edi
+  800cf4:	56                   	push   %esi
+  800cf5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cfb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cfe:	39 c6                	cmp    %eax,%esi
+  800d00:	73 32                	jae    800d34 <memmove+0x44>
+  800d02:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d05:	39 d0                	cmp    %edx,%eax
+  800d07:	73 2b                	jae    800d34 <memmove+0x44>
+		s += n;
+		d += n;
+  800d09:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d0c:	89 d6                	mov    %edx,%esi
+  800d0e:	09 fe                	or     %edi,%esi
+  800d10:	09 ce                	or     %ecx,%esi
+  800d12:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d18:	75 0e                	jne    800d28 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d1a:	83 ef 04             	sub    $0x4,%edi
+  800d1d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d20:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d23:	fd                   	std
+  800d24:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d26:	eb 09                	jmp    800d31 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d28:	83 ef 01             	sub    $0x1,%edi
+  800d2b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d2e:	fd                   	std
+  800d2f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d31:	fc                   	cld
+  800d32:	eb 1a                	jmp    800d4e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d34:	89 f2                	mov    %esi,%edx
+  800d36:	09 c2                	or     %eax,%edx
+  800d38:	09 ca                	or     %ecx,%edx
+  800d3a:	f6 c2 03             	test   $0x3,%dl
+  800d3d:	75 0a                	jne    800d49 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d3f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d42:	89 c7                	mov    %eax,%edi
+  800d44:	fc                   	cld
+  800d45:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d47:	eb 05                	jmp    800d4e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d49:	89 c7                	mov    %eax,%edi
+  800d4b:	fc                   	cld
+  800d4c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+
+00800d52 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d58:	ff 75 10             	push   0x10(%ebp)
+  800d5b:	ff 75 0c             	push   0xc(%ebp)
+  800d5e:	ff 75 08             	push   0x8(%ebp)
+  800d61:	e8 8a ff ff ff       	call   800cf0 <memmove>
+}
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+00800d68 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	56                   	push   %esi
+  800d6c:	53                   	push   %ebx
+  800d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d73:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d76:	85 f6                	test   %esi,%esi
+  800d78:	74 29                	je     800da3 <memcmp+0x3b>
+  800d7a:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800d7c:	0f b6 08             	movzbl (%eax),%ecx
+  800d7f:	0f b6 1a             	movzbl (%edx),%ebx
+  800d82:	38 d9                	cmp    %bl,%cl
+  800d84:	75 11                	jne    800d97 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d86:	83 c0 01             	add    $0x1,%eax
+  800d89:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d8c:	39 c6                	cmp    %eax,%esi
+  800d8e:	75 ec                	jne    800d7c <memcmp+0x14>
+	}
+
+	return 0;
+  800d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d95:	eb 08                	jmp    800d9f <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800d97:	0f b6 c1             	movzbl %cl,%eax
+  800d9a:	0f b6 db             	movzbl %bl,%ebx
+  800d9d:	29 d8                	sub    %ebx,%eax
+}
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+	return 0;
+  800da3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da8:	eb f5                	jmp    800d9f <memcmp+0x37>
+
+00800daa <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800db3:	89 c2                	mov    %eax,%edx
+  800db5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800db8:	39 d0                	cmp    %edx,%eax
+  800dba:	73 0d                	jae    800dc9 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dbc:	38 08                	cmp    %cl,(%eax)
+  800dbe:	74 0d                	je     800dcd <memfind+0x23>
+	for (; s < ends; s++)
+  800dc0:	83 c0 01             	add    $0x1,%eax
+  800dc3:	39 c2                	cmp    %eax,%edx
+  800dc5:	75 f5                	jne    800dbc <memfind+0x12>
+  800dc7:	eb 06                	jmp    800dcf <memfind+0x25>
+  800dc9:	89 c2                	mov    %eax,%edx
+  800dcb:	eb 02                	jmp    800dcf <memfind+0x25>
+  800dcd:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800dcf:	89 d0                	mov    %edx,%eax
+  800dd1:	5d                   	pop    %ebp
+  800dd2:	c3                   	ret
+
+00800dd3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	57                   	push   %edi
+  800dd7:	56                   	push   %esi
+  800dd8:	53                   	push   %ebx
+  800dd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ddf:	0f b6 02             	movzbl (%edx),%eax
+  800de2:	3c 20                	cmp    $0x20,%al
+  800de4:	74 04                	je     800dea <strtol+0x17>
+  800de6:	3c 09                	cmp    $0x9,%al
+  800de8:	75 0e                	jne    800df8 <strtol+0x25>
+		s++;
+  800dea:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ded:	0f b6 02             	movzbl (%edx),%eax
+  800df0:	3c 20                	cmp    $0x20,%al
+  800df2:	74 f6                	je     800dea <strtol+0x17>
+  800df4:	3c 09                	cmp    $0x9,%al
+  800df6:	74 f2                	je     800dea <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800df8:	3c 2b                	cmp    $0x2b,%al
+  800dfa:	74 2a                	je     800e26 <strtol+0x53>
+	int neg = 0;
+  800dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e01:	3c 2d                	cmp    $0x2d,%al
+  800e03:	74 2b                	je     800e30 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e05:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e0b:	75 0f                	jne    800e1c <strtol+0x49>
+  800e0d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e10:	74 28                	je     800e3a <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e12:	85 db                	test   %ebx,%ebx
+  800e14:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e19:	0f 44 d8             	cmove  %eax,%ebx
+  800e1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e21:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e24:	eb 46                	jmp    800e6c <strtol+0x99>
+		s++;
+  800e26:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e29:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e2e:	eb d5                	jmp    800e05 <strtol+0x32>
+		s++, neg = 1;
+  800e30:	83 c2 01             	add    $0x1,%edx
+  800e33:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e38:	eb cb                	jmp    800e05 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e3a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e3e:	74 0e                	je     800e4e <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800e40:	85 db                	test   %ebx,%ebx
+  800e42:	75 d8                	jne    800e1c <strtol+0x49>
+		s++, base = 8;
+  800e44:	83 c2 01             	add    $0x1,%edx
+  800e47:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e4c:	eb ce                	jmp    800e1c <strtol+0x49>
+		s += 2, base = 16;
+  800e4e:	83 c2 02             	add    $0x2,%edx
+  800e51:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e56:	eb c4                	jmp    800e1c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e58:	0f be c0             	movsbl %al,%eax
+  800e5b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e5e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e61:	7d 3a                	jge    800e9d <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800e63:	83 c2 01             	add    $0x1,%edx
+  800e66:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e6a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e6c:	0f b6 02             	movzbl (%edx),%eax
+  800e6f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e72:	89 f3                	mov    %esi,%ebx
+  800e74:	80 fb 09             	cmp    $0x9,%bl
+  800e77:	76 df                	jbe    800e58 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800e79:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e7c:	89 f3                	mov    %esi,%ebx
+  800e7e:	80 fb 19             	cmp    $0x19,%bl
+  800e81:	77 08                	ja     800e8b <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800e83:	0f be c0             	movsbl %al,%eax
+  800e86:	83 e8 57             	sub    $0x57,%eax
+  800e89:	eb d3                	jmp    800e5e <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e8b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e8e:	89 f3                	mov    %esi,%ebx
+  800e90:	80 fb 19             	cmp    $0x19,%bl
+  800e93:	77 08                	ja     800e9d <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800e95:	0f be c0             	movsbl %al,%eax
+  800e98:	83 e8 37             	sub    $0x37,%eax
+  800e9b:	eb c1                	jmp    800e5e <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e9d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ea1:	74 05                	je     800ea8 <strtol+0xd5>
+		*endptr = (char *) s;
+  800ea3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ea6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ea8:	89 c8                	mov    %ecx,%eax
+  800eaa:	f7 d8                	neg    %eax
+  800eac:	85 ff                	test   %edi,%edi
+  800eae:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800eb1:	89 c8                	mov    %ecx,%eax
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+
+00800eb8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	57                   	push   %edi
+  800ebc:	56                   	push   %esi
+  800ebd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec9:	89 c3                	mov    %eax,%ebx
+  800ecb:	89 c7                	mov    %eax,%edi
+  800ecd:	89 c6                	mov    %eax,%esi
+  800ecf:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+
+00800ed6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800edc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ee6:	89 d1                	mov    %edx,%ecx
+  800ee8:	89 d3                	mov    %edx,%ebx
+  800eea:	89 d7                	mov    %edx,%edi
+  800eec:	89 d6                	mov    %edx,%esi
+  800eee:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ef0:	5b                   	pop    %ebx
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5f                   	pop    %edi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+
+00800ef5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800efe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f0b:	89 cb                	mov    %ecx,%ebx
+  800f0d:	89 cf                	mov    %ecx,%edi
+  800f0f:	89 ce                	mov    %ecx,%esi
+  800f11:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f13:	85 c0                	test   %eax,%eax
+  800f15:	7f 08                	jg     800f1f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5f                   	pop    %edi
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+  800f22:	50                   	push   %eax
+  800f23:	6a 03                	push   $0x3
+  800f25:	68 4b 43 80 00       	push   $0x80434b
+  800f2a:	6a 23                	push   $0x23
+  800f2c:	68 68 43 80 00       	push   $0x804368
+  800f31:	e8 38 f4 ff ff       	call   80036e <_panic>
+
+00800f36 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	57                   	push   %edi
+  800f3a:	56                   	push   %esi
+  800f3b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f41:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f46:	89 d1                	mov    %edx,%ecx
+  800f48:	89 d3                	mov    %edx,%ebx
+  800f4a:	89 d7                	mov    %edx,%edi
+  800f4c:	89 d6                	mov    %edx,%esi
+  800f4e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f50:	5b                   	pop    %ebx
+  800f51:	5e                   	pop    %esi
+  800f52:	5f                   	pop    %edi
+  800f53:	5d                   	pop    %ebp
+  800f54:	c3                   	ret
+
+00800f55 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f60:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f65:	89 d1                	mov    %edx,%ecx
+  800f67:	89 d3                	mov    %edx,%ebx
+  800f69:	89 d7                	mov    %edx,%edi
+  800f6b:	89 d6                	mov    %edx,%esi
+  800f6d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5f                   	pop    %edi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+
+00800f74 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f90:	89 f7                	mov    %esi,%edi
+  800f92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 08                	jg     800fa0 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	6a 04                	push   $0x4
+  800fa6:	68 4b 43 80 00       	push   $0x80434b
+  800fab:	6a 23                	push   $0x23
+  800fad:	68 68 43 80 00       	push   $0x804368
+  800fb2:	e8 b7 f3 ff ff       	call   80036e <_panic>
+
+00800fb7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fd4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	7f 08                	jg     800fe2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5f                   	pop    %edi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe2:	83 ec 0c             	sub    $0xc,%esp
+  800fe5:	50                   	push   %eax
+  800fe6:	6a 05                	push   $0x5
+  800fe8:	68 4b 43 80 00       	push   $0x80434b
+  800fed:	6a 23                	push   $0x23
+  800fef:	68 68 43 80 00       	push   $0x804368
+  800ff4:	e8 75 f3 ff ff       	call   80036e <_panic>
+
+00800ff9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 06                	push   $0x6
+  80102a:	68 4b 43 80 00       	push   $0x80434b
+  80102f:	6a 23                	push   $0x23
+  801031:	68 68 43 80 00       	push   $0x804368
+  801036:	e8 33 f3 ff ff       	call   80036e <_panic>
+
+0080103b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801044:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801049:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801054:	89 df                	mov    %ebx,%edi
+  801056:	89 de                	mov    %ebx,%esi
+  801058:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	7f 08                	jg     801066 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	50                   	push   %eax
+  80106a:	6a 08                	push   $0x8
+  80106c:	68 4b 43 80 00       	push   $0x80434b
+  801071:	6a 23                	push   $0x23
+  801073:	68 68 43 80 00       	push   $0x804368
+  801078:	e8 f1 f2 ff ff       	call   80036e <_panic>
+
+0080107d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801086:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 09 00 00 00       	mov    $0x9,%eax
+  801096:	89 df                	mov    %ebx,%edi
+  801098:	89 de                	mov    %ebx,%esi
+  80109a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	7f 08                	jg     8010a8 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5e                   	pop    %esi
+  8010a5:	5f                   	pop    %edi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	50                   	push   %eax
+  8010ac:	6a 09                	push   $0x9
+  8010ae:	68 4b 43 80 00       	push   $0x80434b
+  8010b3:	6a 23                	push   $0x23
+  8010b5:	68 68 43 80 00       	push   $0x804368
+  8010ba:	e8 af f2 ff ff       	call   80036e <_panic>
+
+008010bf <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	57                   	push   %edi
+  8010c3:	56                   	push   %esi
+  8010c4:	53                   	push   %ebx
+  8010c5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010d8:	89 df                	mov    %ebx,%edi
+  8010da:	89 de                	mov    %ebx,%esi
+  8010dc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010de:	85 c0                	test   %eax,%eax
+  8010e0:	7f 08                	jg     8010ea <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e5:	5b                   	pop    %ebx
+  8010e6:	5e                   	pop    %esi
+  8010e7:	5f                   	pop    %edi
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+  8010ed:	50                   	push   %eax
+  8010ee:	6a 0a                	push   $0xa
+  8010f0:	68 4b 43 80 00       	push   $0x80434b
+  8010f5:	6a 23                	push   $0x23
+  8010f7:	68 68 43 80 00       	push   $0x804368
+  8010fc:	e8 6d f2 ff ff       	call   80036e <_panic>
+
+00801101 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80111d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80111f:	5b                   	pop    %ebx
+  801120:	5e                   	pop    %esi
+  801121:	5f                   	pop    %edi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+
+00801124 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+  80112a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801132:	8b 55 08             	mov    0x8(%ebp),%edx
+  801135:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80113a:	89 cb                	mov    %ecx,%ebx
+  80113c:	89 cf                	mov    %ecx,%edi
+  80113e:	89 ce                	mov    %ecx,%esi
+  801140:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801142:	85 c0                	test   %eax,%eax
+  801144:	7f 08                	jg     80114e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801146:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5f                   	pop    %edi
+  80114c:	5d                   	pop    %ebp
+  80114d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+  801151:	50                   	push   %eax
+  801152:	6a 0d                	push   $0xd
+  801154:	68 4b 43 80 00       	push   $0x80434b
+  801159:	6a 23                	push   $0x23
+  80115b:	68 68 43 80 00       	push   $0x804368
+  801160:	e8 09 f2 ff ff       	call   80036e <_panic>
+
+00801165 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	57                   	push   %edi
+  801169:	56                   	push   %esi
+  80116a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801171:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801176:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801179:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80117f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801181:	5b                   	pop    %ebx
+  801182:	5e                   	pop    %esi
+  801183:	5f                   	pop    %edi
+  801184:	5d                   	pop    %ebp
+  801185:	c3                   	ret
+
+00801186 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+  80118c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80119f:	89 df                	mov    %ebx,%edi
+  8011a1:	89 de                	mov    %ebx,%esi
+  8011a3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	7f 08                	jg     8011b1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8011a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5e                   	pop    %esi
+  8011ae:	5f                   	pop    %edi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b1:	83 ec 0c             	sub    $0xc,%esp
+  8011b4:	50                   	push   %eax
+  8011b5:	6a 0d                	push   $0xd
+  8011b7:	68 4b 43 80 00       	push   $0x80434b
+  8011bc:	6a 23                	push   $0x23
+  8011be:	68 68 43 80 00       	push   $0x804368
+  8011c3:	e8 a6 f1 ff ff       	call   80036e <_panic>
+
+008011c8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d8:	89 d1                	mov    %edx,%ecx
+  8011da:	89 d3                	mov    %edx,%ebx
+  8011dc:	89 d7                	mov    %edx,%edi
+  8011de:	89 d6                	mov    %edx,%esi
+  8011e0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5e                   	pop    %esi
+  8011e4:	5f                   	pop    %edi
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+
+008011e7 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8011e7:	55                   	push   %ebp
+  8011e8:	89 e5                	mov    %esp,%ebp
+  8011ea:	57                   	push   %edi
+  8011eb:	56                   	push   %esi
+  8011ec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011fd:	89 df                	mov    %ebx,%edi
+  8011ff:	89 de                	mov    %ebx,%esi
+  801201:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801203:	5b                   	pop    %ebx
+  801204:	5e                   	pop    %esi
+  801205:	5f                   	pop    %edi
+  801206:	5d                   	pop    %ebp
+  801207:	c3                   	ret
+
+00801208 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	57                   	push   %edi
+  80120c:	56                   	push   %esi
+  80120d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801213:	8b 55 08             	mov    0x8(%ebp),%edx
+  801216:	b8 10 00 00 00       	mov    $0x10,%eax
+  80121b:	89 cb                	mov    %ecx,%ebx
+  80121d:	89 cf                	mov    %ecx,%edi
+  80121f:	89 ce                	mov    %ecx,%esi
+  801221:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801223:	5b                   	pop    %ebx
+  801224:	5e                   	pop    %esi
+  801225:	5f                   	pop    %edi
+  801226:	5d                   	pop    %ebp
+  801227:	c3                   	ret
+
+00801228 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	57                   	push   %edi
+  80122c:	56                   	push   %esi
+  80122d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801233:	8b 55 08             	mov    0x8(%ebp),%edx
+  801236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801239:	b8 11 00 00 00       	mov    $0x11,%eax
+  80123e:	89 df                	mov    %ebx,%edi
+  801240:	89 de                	mov    %ebx,%esi
+  801242:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801244:	5b                   	pop    %ebx
+  801245:	5e                   	pop    %esi
+  801246:	5f                   	pop    %edi
+  801247:	5d                   	pop    %ebp
+  801248:	c3                   	ret
+
+00801249 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	57                   	push   %edi
+  80124d:	56                   	push   %esi
+  80124e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801254:	8b 55 08             	mov    0x8(%ebp),%edx
+  801257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80125f:	89 df                	mov    %ebx,%edi
+  801261:	89 de                	mov    %ebx,%esi
+  801263:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801265:	5b                   	pop    %ebx
+  801266:	5e                   	pop    %esi
+  801267:	5f                   	pop    %edi
+  801268:	5d                   	pop    %ebp
+  801269:	c3                   	ret
+
+0080126a <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80126a:	55                   	push   %ebp
+  80126b:	89 e5                	mov    %esp,%ebp
+  80126d:	57                   	push   %edi
+  80126e:	56                   	push   %esi
+  80126f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801270:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801275:	8b 55 08             	mov    0x8(%ebp),%edx
+  801278:	b8 13 00 00 00       	mov    $0x13,%eax
+  80127d:	89 cb                	mov    %ecx,%ebx
+  80127f:	89 cf                	mov    %ecx,%edi
+  801281:	89 ce                	mov    %ecx,%esi
+  801283:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+
+0080128a <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801290:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801295:	8b 55 08             	mov    0x8(%ebp),%edx
+  801298:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129b:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012a0:	89 df                	mov    %ebx,%edi
+  8012a2:	89 de                	mov    %ebx,%esi
+  8012a4:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+
+008012ab <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+  8012ae:	57                   	push   %edi
+  8012af:	56                   	push   %esi
+  8012b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012be:	89 cb                	mov    %ecx,%ebx
+  8012c0:	89 cf                	mov    %ecx,%edi
+  8012c2:	89 ce                	mov    %ecx,%esi
+  8012c4:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8012c6:	5b                   	pop    %ebx
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5f                   	pop    %edi
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+
+008012cb <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	57                   	push   %edi
+  8012cf:	56                   	push   %esi
+  8012d0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dc:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e4:	89 f7                	mov    %esi,%edi
+  8012e6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8012e8:	5b                   	pop    %ebx
+  8012e9:	5e                   	pop    %esi
+  8012ea:	5f                   	pop    %edi
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+
+008012ed <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8012ed:	55                   	push   %ebp
+  8012ee:	89 e5                	mov    %esp,%ebp
+  8012f0:	57                   	push   %edi
+  8012f1:	56                   	push   %esi
+  8012f2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fe:	b8 17 00 00 00       	mov    $0x17,%eax
+  801303:	89 df                	mov    %ebx,%edi
+  801305:	89 de                	mov    %ebx,%esi
+  801307:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5f                   	pop    %edi
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+
+0080130e <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	57                   	push   %edi
+  801312:	56                   	push   %esi
+  801313:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801314:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801319:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801321:	89 cb                	mov    %ecx,%ebx
+  801323:	89 cf                	mov    %ecx,%edi
+  801325:	89 ce                	mov    %ecx,%esi
+  801327:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+
+0080132e <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	57                   	push   %edi
+  801332:	56                   	push   %esi
+  801333:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801334:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801338:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	b8 19 00 00 00       	mov    $0x19,%eax
+  801345:	89 df                	mov    %ebx,%edi
+  801347:	89 de                	mov    %ebx,%esi
+  801349:	cd 30                	int    $0x30
+}
+  80134b:	5b                   	pop    %ebx
+  80134c:	5e                   	pop    %esi
+  80134d:	5f                   	pop    %edi
+  80134e:	5d                   	pop    %ebp
+  80134f:	c3                   	ret
+
+00801350 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	57                   	push   %edi
+  801354:	56                   	push   %esi
+  801355:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801356:	be 00 00 00 00       	mov    $0x0,%esi
+  80135b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801361:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801366:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801369:	89 f7                	mov    %esi,%edi
+  80136b:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80136d:	5b                   	pop    %ebx
+  80136e:	5e                   	pop    %esi
+  80136f:	5f                   	pop    %edi
+  801370:	5d                   	pop    %ebp
+  801371:	c3                   	ret
+
+00801372 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	57                   	push   %edi
+  801376:	56                   	push   %esi
+  801377:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801378:	be 00 00 00 00       	mov    $0x0,%esi
+  80137d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801380:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801383:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801388:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80138b:	89 f7                	mov    %esi,%edi
+  80138d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80138f:	5b                   	pop    %ebx
+  801390:	5e                   	pop    %esi
+  801391:	5f                   	pop    %edi
+  801392:	5d                   	pop    %ebp
+  801393:	c3                   	ret
+
+00801394 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	57                   	push   %edi
+  801398:	56                   	push   %esi
+  801399:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80139a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013aa:	89 df                	mov    %ebx,%edi
+  8013ac:	89 de                	mov    %ebx,%esi
+  8013ae:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8013b0:	5b                   	pop    %ebx
+  8013b1:	5e                   	pop    %esi
+  8013b2:	5f                   	pop    %edi
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+
+008013b5 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	57                   	push   %edi
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ce:	89 f7                	mov    %esi,%edi
+  8013d0:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+
+008013d7 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e0:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  8013e3:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  8013e5:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  8013e8:	83 3a 01             	cmpl   $0x1,(%edx)
+  8013eb:	7e 09                	jle    8013f6 <argstart+0x1f>
+  8013ed:	ba c8 3f 80 00       	mov    $0x803fc8,%edx
+  8013f2:	85 c9                	test   %ecx,%ecx
+  8013f4:	75 05                	jne    8013fb <argstart+0x24>
+  8013f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fb:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8013fe:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801405:	5d                   	pop    %ebp
+  801406:	c3                   	ret
+
+00801407 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801407:	55                   	push   %ebp
+  801408:	89 e5                	mov    %esp,%ebp
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 04             	sub    $0x4,%esp
+  80140e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801411:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  801418:	8b 43 08             	mov    0x8(%ebx),%eax
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	74 74                	je     801493 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  80141f:	80 38 00             	cmpb   $0x0,(%eax)
+  801422:	75 48                	jne    80146c <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801424:	8b 0b                	mov    (%ebx),%ecx
+  801426:	83 39 01             	cmpl   $0x1,(%ecx)
+  801429:	74 5a                	je     801485 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  80142b:	8b 53 04             	mov    0x4(%ebx),%edx
+  80142e:	8b 42 04             	mov    0x4(%edx),%eax
+  801431:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801434:	75 4f                	jne    801485 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801436:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80143a:	74 49                	je     801485 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  80143c:	83 c0 01             	add    $0x1,%eax
+  80143f:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801442:	83 ec 04             	sub    $0x4,%esp
+  801445:	8b 01                	mov    (%ecx),%eax
+  801447:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  80144e:	50                   	push   %eax
+  80144f:	8d 42 08             	lea    0x8(%edx),%eax
+  801452:	50                   	push   %eax
+  801453:	83 c2 04             	add    $0x4,%edx
+  801456:	52                   	push   %edx
+  801457:	e8 94 f8 ff ff       	call   800cf0 <memmove>
+		(*args->argc)--;
+  80145c:	8b 03                	mov    (%ebx),%eax
+  80145e:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801461:	8b 43 08             	mov    0x8(%ebx),%eax
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80146a:	74 13                	je     80147f <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  80146c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80146f:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801472:	83 c0 01             	add    $0x1,%eax
+  801475:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801478:	89 d0                	mov    %edx,%eax
+  80147a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80147f:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801483:	75 e7                	jne    80146c <argnext+0x65>
+	args->curarg = 0;
+  801485:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  80148c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801491:	eb e5                	jmp    801478 <argnext+0x71>
+		return -1;
+  801493:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801498:	eb de                	jmp    801478 <argnext+0x71>
+
+0080149a <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  80149a:	55                   	push   %ebp
+  80149b:	89 e5                	mov    %esp,%ebp
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 04             	sub    $0x4,%esp
+  8014a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  8014a4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014a7:	85 c0                	test   %eax,%eax
+  8014a9:	74 12                	je     8014bd <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  8014ab:	80 38 00             	cmpb   $0x0,(%eax)
+  8014ae:	74 12                	je     8014c2 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  8014b0:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  8014b3:	c7 43 08 c8 3f 80 00 	movl   $0x803fc8,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  8014ba:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8014bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014c0:	c9                   	leave
+  8014c1:	c3                   	ret
+	} else if (*args->argc > 1) {
+  8014c2:	8b 13                	mov    (%ebx),%edx
+  8014c4:	83 3a 01             	cmpl   $0x1,(%edx)
+  8014c7:	7f 10                	jg     8014d9 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  8014c9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  8014d0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8014d7:	eb e1                	jmp    8014ba <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  8014d9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8014dc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8014df:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8014e2:	83 ec 04             	sub    $0x4,%esp
+  8014e5:	8b 12                	mov    (%edx),%edx
+  8014e7:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8014ee:	52                   	push   %edx
+  8014ef:	8d 50 08             	lea    0x8(%eax),%edx
+  8014f2:	52                   	push   %edx
+  8014f3:	83 c0 04             	add    $0x4,%eax
+  8014f6:	50                   	push   %eax
+  8014f7:	e8 f4 f7 ff ff       	call   800cf0 <memmove>
+		(*args->argc)--;
+  8014fc:	8b 03                	mov    (%ebx),%eax
+  8014fe:	83 28 01             	subl   $0x1,(%eax)
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	eb b4                	jmp    8014ba <argnextvalue+0x20>
+
+00801506 <argvalue>:
+{
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	83 ec 08             	sub    $0x8,%esp
+  80150c:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80150f:	8b 42 0c             	mov    0xc(%edx),%eax
+  801512:	85 c0                	test   %eax,%eax
+  801514:	74 02                	je     801518 <argvalue+0x12>
+}
+  801516:	c9                   	leave
+  801517:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801518:	83 ec 0c             	sub    $0xc,%esp
+  80151b:	52                   	push   %edx
+  80151c:	e8 79 ff ff ff       	call   80149a <argnextvalue>
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	eb f0                	jmp    801516 <argvalue+0x10>
+
+00801526 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801529:	8b 45 08             	mov    0x8(%ebp),%eax
+  80152c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801531:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801534:	5d                   	pop    %ebp
+  801535:	c3                   	ret
+
+00801536 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801536:	55                   	push   %ebp
+  801537:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801539:	8b 45 08             	mov    0x8(%ebp),%eax
+  80153c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801541:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801546:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80154b:	5d                   	pop    %ebp
+  80154c:	c3                   	ret
+
+0080154d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80154d:	55                   	push   %ebp
+  80154e:	89 e5                	mov    %esp,%ebp
+  801550:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801555:	89 c2                	mov    %eax,%edx
+  801557:	c1 ea 16             	shr    $0x16,%edx
+  80155a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801561:	f6 c2 01             	test   $0x1,%dl
+  801564:	74 29                	je     80158f <fd_alloc+0x42>
+  801566:	89 c2                	mov    %eax,%edx
+  801568:	c1 ea 0c             	shr    $0xc,%edx
+  80156b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801572:	f6 c2 01             	test   $0x1,%dl
+  801575:	74 18                	je     80158f <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801577:	05 00 10 00 00       	add    $0x1000,%eax
+  80157c:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801581:	75 d2                	jne    801555 <fd_alloc+0x8>
+  801583:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801588:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80158d:	eb 05                	jmp    801594 <fd_alloc+0x47>
+			return 0;
+  80158f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801594:	8b 55 08             	mov    0x8(%ebp),%edx
+  801597:	89 02                	mov    %eax,(%edx)
+}
+  801599:	89 c8                	mov    %ecx,%eax
+  80159b:	5d                   	pop    %ebp
+  80159c:	c3                   	ret
+
+0080159d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015a3:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8015a8:	77 30                	ja     8015da <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015aa:	c1 e0 0c             	shl    $0xc,%eax
+  8015ad:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8015b2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015b8:	f6 c2 01             	test   $0x1,%dl
+  8015bb:	74 24                	je     8015e1 <fd_lookup+0x44>
+  8015bd:	89 c2                	mov    %eax,%edx
+  8015bf:	c1 ea 0c             	shr    $0xc,%edx
+  8015c2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015c9:	f6 c2 01             	test   $0x1,%dl
+  8015cc:	74 1a                	je     8015e8 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d8:	5d                   	pop    %ebp
+  8015d9:	c3                   	ret
+		return -E_INVAL;
+  8015da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015df:	eb f7                	jmp    8015d8 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8015e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e6:	eb f0                	jmp    8015d8 <fd_lookup+0x3b>
+  8015e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ed:	eb e9                	jmp    8015d8 <fd_lookup+0x3b>
+
+008015ef <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015ef:	55                   	push   %ebp
+  8015f0:	89 e5                	mov    %esp,%ebp
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 04             	sub    $0x4,%esp
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fe:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801603:	39 13                	cmp    %edx,(%ebx)
+  801605:	74 54                	je     80165b <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801607:	83 c0 01             	add    $0x1,%eax
+  80160a:	8b 1c 85 f4 43 80 00 	mov    0x8043f4(,%eax,4),%ebx
+  801611:	85 db                	test   %ebx,%ebx
+  801613:	75 ee                	jne    801603 <dev_lookup+0x14>
+  801615:	89 e1                	mov    %esp,%ecx
+  801617:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80161c:	29 c8                	sub    %ecx,%eax
+  80161e:	89 c1                	mov    %eax,%ecx
+  801620:	c1 e9 0f             	shr    $0xf,%ecx
+  801623:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162d:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801630:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  801637:	8b 40 48             	mov    0x48(%eax),%eax
+  80163a:	83 ec 04             	sub    $0x4,%esp
+  80163d:	52                   	push   %edx
+  80163e:	50                   	push   %eax
+  80163f:	68 78 43 80 00       	push   $0x804378
+  801644:	e8 00 ee ff ff       	call   800449 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801649:	83 c4 10             	add    $0x10,%esp
+  80164c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801651:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801654:	89 1a                	mov    %ebx,(%edx)
+}
+  801656:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801659:	c9                   	leave
+  80165a:	c3                   	ret
+			return 0;
+  80165b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801660:	eb ef                	jmp    801651 <dev_lookup+0x62>
+
+00801662 <fd_close>:
+{
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	57                   	push   %edi
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 24             	sub    $0x24,%esp
+  80166b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80166e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801671:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801674:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801675:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80167b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80167e:	50                   	push   %eax
+  80167f:	e8 19 ff ff ff       	call   80159d <fd_lookup>
+  801684:	89 c3                	mov    %eax,%ebx
+  801686:	83 c4 10             	add    $0x10,%esp
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	78 05                	js     801692 <fd_close+0x30>
+	    || fd != fd2)
+  80168d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801690:	74 0f                	je     8016a1 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801692:	85 ff                	test   %edi,%edi
+  801694:	0f 44 df             	cmove  %edi,%ebx
+}
+  801697:	89 d8                	mov    %ebx,%eax
+  801699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169c:	5b                   	pop    %ebx
+  80169d:	5e                   	pop    %esi
+  80169e:	5f                   	pop    %edi
+  80169f:	5d                   	pop    %ebp
+  8016a0:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016a1:	83 ec 08             	sub    $0x8,%esp
+  8016a4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016a7:	50                   	push   %eax
+  8016a8:	ff 36                	push   (%esi)
+  8016aa:	e8 40 ff ff ff       	call   8015ef <dev_lookup>
+  8016af:	89 c3                	mov    %eax,%ebx
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	78 1a                	js     8016d2 <fd_close+0x70>
+		if (dev->dev_close)
+  8016b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016bb:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016be:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016c3:	85 c0                	test   %eax,%eax
+  8016c5:	74 0b                	je     8016d2 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8016c7:	83 ec 0c             	sub    $0xc,%esp
+  8016ca:	56                   	push   %esi
+  8016cb:	ff d0                	call   *%eax
+  8016cd:	89 c3                	mov    %eax,%ebx
+  8016cf:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016d2:	83 ec 08             	sub    $0x8,%esp
+  8016d5:	56                   	push   %esi
+  8016d6:	6a 00                	push   $0x0
+  8016d8:	e8 1c f9 ff ff       	call   800ff9 <sys_page_unmap>
+	return r;
+  8016dd:	83 c4 10             	add    $0x10,%esp
+  8016e0:	eb b5                	jmp    801697 <fd_close+0x35>
+
+008016e2 <close>:
+
+int
+close(int fdnum)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016eb:	50                   	push   %eax
+  8016ec:	ff 75 08             	push   0x8(%ebp)
+  8016ef:	e8 a9 fe ff ff       	call   80159d <fd_lookup>
+  8016f4:	83 c4 10             	add    $0x10,%esp
+  8016f7:	85 c0                	test   %eax,%eax
+  8016f9:	79 02                	jns    8016fd <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016fb:	c9                   	leave
+  8016fc:	c3                   	ret
+		return fd_close(fd, 1);
+  8016fd:	83 ec 08             	sub    $0x8,%esp
+  801700:	6a 01                	push   $0x1
+  801702:	ff 75 f4             	push   -0xc(%ebp)
+  801705:	e8 58 ff ff ff       	call   801662 <fd_close>
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	eb ec                	jmp    8016fb <close+0x19>
+
+0080170f <close_all>:
+
+void
+close_all(void)
+{
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	53                   	push   %ebx
+  801713:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801716:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80171b:	83 ec 0c             	sub    $0xc,%esp
+  80171e:	53                   	push   %ebx
+  80171f:	e8 be ff ff ff       	call   8016e2 <close>
+	for (i = 0; i < MAXFD; i++)
+  801724:	83 c3 01             	add    $0x1,%ebx
+  801727:	83 c4 10             	add    $0x10,%esp
+  80172a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801730:	75 e9                	jne    80171b <close_all+0xc>
+}
+  801732:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801735:	c9                   	leave
+  801736:	c3                   	ret
+
+00801737 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	57                   	push   %edi
+  80173b:	56                   	push   %esi
+  80173c:	53                   	push   %ebx
+  80173d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801740:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801743:	50                   	push   %eax
+  801744:	ff 75 08             	push   0x8(%ebp)
+  801747:	e8 51 fe ff ff       	call   80159d <fd_lookup>
+  80174c:	89 c3                	mov    %eax,%ebx
+  80174e:	83 c4 10             	add    $0x10,%esp
+  801751:	85 c0                	test   %eax,%eax
+  801753:	78 7f                	js     8017d4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801755:	83 ec 0c             	sub    $0xc,%esp
+  801758:	ff 75 0c             	push   0xc(%ebp)
+  80175b:	e8 82 ff ff ff       	call   8016e2 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801760:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801763:	c1 e6 0c             	shl    $0xc,%esi
+  801766:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80176c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80176f:	89 3c 24             	mov    %edi,(%esp)
+  801772:	e8 bf fd ff ff       	call   801536 <fd2data>
+  801777:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801779:	89 34 24             	mov    %esi,(%esp)
+  80177c:	e8 b5 fd ff ff       	call   801536 <fd2data>
+  801781:	83 c4 10             	add    $0x10,%esp
+  801784:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801787:	89 d8                	mov    %ebx,%eax
+  801789:	c1 e8 16             	shr    $0x16,%eax
+  80178c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801793:	a8 01                	test   $0x1,%al
+  801795:	74 11                	je     8017a8 <dup+0x71>
+  801797:	89 d8                	mov    %ebx,%eax
+  801799:	c1 e8 0c             	shr    $0xc,%eax
+  80179c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017a3:	f6 c2 01             	test   $0x1,%dl
+  8017a6:	75 36                	jne    8017de <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017a8:	89 f8                	mov    %edi,%eax
+  8017aa:	c1 e8 0c             	shr    $0xc,%eax
+  8017ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017b4:	83 ec 0c             	sub    $0xc,%esp
+  8017b7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017bc:	50                   	push   %eax
+  8017bd:	56                   	push   %esi
+  8017be:	6a 00                	push   $0x0
+  8017c0:	57                   	push   %edi
+  8017c1:	6a 00                	push   $0x0
+  8017c3:	e8 ef f7 ff ff       	call   800fb7 <sys_page_map>
+  8017c8:	89 c3                	mov    %eax,%ebx
+  8017ca:	83 c4 20             	add    $0x20,%esp
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	78 33                	js     801804 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017d4:	89 d8                	mov    %ebx,%eax
+  8017d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d9:	5b                   	pop    %ebx
+  8017da:	5e                   	pop    %esi
+  8017db:	5f                   	pop    %edi
+  8017dc:	5d                   	pop    %ebp
+  8017dd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017de:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017e5:	83 ec 0c             	sub    $0xc,%esp
+  8017e8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017ed:	50                   	push   %eax
+  8017ee:	ff 75 d4             	push   -0x2c(%ebp)
+  8017f1:	6a 00                	push   $0x0
+  8017f3:	53                   	push   %ebx
+  8017f4:	6a 00                	push   $0x0
+  8017f6:	e8 bc f7 ff ff       	call   800fb7 <sys_page_map>
+  8017fb:	89 c3                	mov    %eax,%ebx
+  8017fd:	83 c4 20             	add    $0x20,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	79 a4                	jns    8017a8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801804:	83 ec 08             	sub    $0x8,%esp
+  801807:	56                   	push   %esi
+  801808:	6a 00                	push   $0x0
+  80180a:	e8 ea f7 ff ff       	call   800ff9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80180f:	83 c4 08             	add    $0x8,%esp
+  801812:	ff 75 d4             	push   -0x2c(%ebp)
+  801815:	6a 00                	push   $0x0
+  801817:	e8 dd f7 ff ff       	call   800ff9 <sys_page_unmap>
+	return r;
+  80181c:	83 c4 10             	add    $0x10,%esp
+  80181f:	eb b3                	jmp    8017d4 <dup+0x9d>
+
+00801821 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801821:	55                   	push   %ebp
+  801822:	89 e5                	mov    %esp,%ebp
+  801824:	56                   	push   %esi
+  801825:	53                   	push   %ebx
+  801826:	83 ec 18             	sub    $0x18,%esp
+  801829:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80182c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80182f:	50                   	push   %eax
+  801830:	53                   	push   %ebx
+  801831:	e8 67 fd ff ff       	call   80159d <fd_lookup>
+  801836:	83 c4 10             	add    $0x10,%esp
+  801839:	85 c0                	test   %eax,%eax
+  80183b:	78 3c                	js     801879 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80183d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801840:	83 ec 08             	sub    $0x8,%esp
+  801843:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801846:	50                   	push   %eax
+  801847:	ff 36                	push   (%esi)
+  801849:	e8 a1 fd ff ff       	call   8015ef <dev_lookup>
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	85 c0                	test   %eax,%eax
+  801853:	78 24                	js     801879 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801855:	8b 46 08             	mov    0x8(%esi),%eax
+  801858:	83 e0 03             	and    $0x3,%eax
+  80185b:	83 f8 01             	cmp    $0x1,%eax
+  80185e:	74 20                	je     801880 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801860:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801863:	8b 40 08             	mov    0x8(%eax),%eax
+  801866:	85 c0                	test   %eax,%eax
+  801868:	74 54                	je     8018be <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80186a:	83 ec 04             	sub    $0x4,%esp
+  80186d:	ff 75 10             	push   0x10(%ebp)
+  801870:	ff 75 0c             	push   0xc(%ebp)
+  801873:	56                   	push   %esi
+  801874:	ff d0                	call   *%eax
+  801876:	83 c4 10             	add    $0x10,%esp
+}
+  801879:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80187c:	5b                   	pop    %ebx
+  80187d:	5e                   	pop    %esi
+  80187e:	5d                   	pop    %ebp
+  80187f:	c3                   	ret
+  801880:	89 e2                	mov    %esp,%edx
+  801882:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801887:	29 d0                	sub    %edx,%eax
+  801889:	89 c2                	mov    %eax,%edx
+  80188b:	c1 ea 0f             	shr    $0xf,%edx
+  80188e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801893:	b8 00 00 00 00       	mov    $0x0,%eax
+  801898:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80189b:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  8018a2:	8b 40 48             	mov    0x48(%eax),%eax
+  8018a5:	83 ec 04             	sub    $0x4,%esp
+  8018a8:	53                   	push   %ebx
+  8018a9:	50                   	push   %eax
+  8018aa:	68 b9 43 80 00       	push   $0x8043b9
+  8018af:	e8 95 eb ff ff       	call   800449 <cprintf>
+		return -E_INVAL;
+  8018b4:	83 c4 10             	add    $0x10,%esp
+  8018b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018bc:	eb bb                	jmp    801879 <read+0x58>
+		return -E_NOT_SUPP;
+  8018be:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018c3:	eb b4                	jmp    801879 <read+0x58>
+
+008018c5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018c5:	55                   	push   %ebp
+  8018c6:	89 e5                	mov    %esp,%ebp
+  8018c8:	57                   	push   %edi
+  8018c9:	56                   	push   %esi
+  8018ca:	53                   	push   %ebx
+  8018cb:	83 ec 0c             	sub    $0xc,%esp
+  8018ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8018d1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018d4:	85 f6                	test   %esi,%esi
+  8018d6:	74 30                	je     801908 <readn+0x43>
+  8018d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018dd:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018e2:	83 ec 04             	sub    $0x4,%esp
+  8018e5:	89 f2                	mov    %esi,%edx
+  8018e7:	29 c2                	sub    %eax,%edx
+  8018e9:	52                   	push   %edx
+  8018ea:	01 f8                	add    %edi,%eax
+  8018ec:	50                   	push   %eax
+  8018ed:	ff 75 08             	push   0x8(%ebp)
+  8018f0:	e8 2c ff ff ff       	call   801821 <read>
+		if (m < 0)
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	78 15                	js     801911 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8018fc:	74 11                	je     80190f <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8018fe:	01 c3                	add    %eax,%ebx
+  801900:	89 d8                	mov    %ebx,%eax
+  801902:	39 f3                	cmp    %esi,%ebx
+  801904:	72 dc                	jb     8018e2 <readn+0x1d>
+  801906:	eb 09                	jmp    801911 <readn+0x4c>
+  801908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190d:	eb 02                	jmp    801911 <readn+0x4c>
+  80190f:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801914:	5b                   	pop    %ebx
+  801915:	5e                   	pop    %esi
+  801916:	5f                   	pop    %edi
+  801917:	5d                   	pop    %ebp
+  801918:	c3                   	ret
+
+00801919 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801919:	55                   	push   %ebp
+  80191a:	89 e5                	mov    %esp,%ebp
+  80191c:	56                   	push   %esi
+  80191d:	53                   	push   %ebx
+  80191e:	83 ec 18             	sub    $0x18,%esp
+  801921:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801924:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801927:	50                   	push   %eax
+  801928:	53                   	push   %ebx
+  801929:	e8 6f fc ff ff       	call   80159d <fd_lookup>
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	85 c0                	test   %eax,%eax
+  801933:	78 37                	js     80196c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801935:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801938:	83 ec 08             	sub    $0x8,%esp
+  80193b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80193e:	50                   	push   %eax
+  80193f:	ff 36                	push   (%esi)
+  801941:	e8 a9 fc ff ff       	call   8015ef <dev_lookup>
+  801946:	83 c4 10             	add    $0x10,%esp
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	78 1f                	js     80196c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80194d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801951:	74 20                	je     801973 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801956:	8b 40 0c             	mov    0xc(%eax),%eax
+  801959:	85 c0                	test   %eax,%eax
+  80195b:	74 54                	je     8019b1 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80195d:	83 ec 04             	sub    $0x4,%esp
+  801960:	ff 75 10             	push   0x10(%ebp)
+  801963:	ff 75 0c             	push   0xc(%ebp)
+  801966:	56                   	push   %esi
+  801967:	ff d0                	call   *%eax
+  801969:	83 c4 10             	add    $0x10,%esp
+}
+  80196c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80196f:	5b                   	pop    %ebx
+  801970:	5e                   	pop    %esi
+  801971:	5d                   	pop    %ebp
+  801972:	c3                   	ret
+  801973:	89 e2                	mov    %esp,%edx
+  801975:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80197a:	29 d0                	sub    %edx,%eax
+  80197c:	89 c2                	mov    %eax,%edx
+  80197e:	c1 ea 0f             	shr    $0xf,%edx
+  801981:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198b:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80198e:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  801995:	8b 40 48             	mov    0x48(%eax),%eax
+  801998:	83 ec 04             	sub    $0x4,%esp
+  80199b:	53                   	push   %ebx
+  80199c:	50                   	push   %eax
+  80199d:	68 d5 43 80 00       	push   $0x8043d5
+  8019a2:	e8 a2 ea ff ff       	call   800449 <cprintf>
+		return -E_INVAL;
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019af:	eb bb                	jmp    80196c <write+0x53>
+		return -E_NOT_SUPP;
+  8019b1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019b6:	eb b4                	jmp    80196c <write+0x53>
+
+008019b8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c1:	50                   	push   %eax
+  8019c2:	ff 75 08             	push   0x8(%ebp)
+  8019c5:	e8 d3 fb ff ff       	call   80159d <fd_lookup>
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 0e                	js     8019df <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8019d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8019da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019df:	c9                   	leave
+  8019e0:	c3                   	ret
+
+008019e1 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8019e1:	55                   	push   %ebp
+  8019e2:	89 e5                	mov    %esp,%ebp
+  8019e4:	53                   	push   %ebx
+  8019e5:	83 ec 1c             	sub    $0x1c,%esp
+  8019e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ee:	50                   	push   %eax
+  8019ef:	ff 75 08             	push   0x8(%ebp)
+  8019f2:	e8 a6 fb ff ff       	call   80159d <fd_lookup>
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	78 33                	js     801a31 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8019fe:	83 fb 03             	cmp    $0x3,%ebx
+  801a01:	74 28                	je     801a2b <fcntl+0x4a>
+  801a03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a08:	83 fb 04             	cmp    $0x4,%ebx
+  801a0b:	75 24                	jne    801a31 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801a0d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801a10:	8b 41 08             	mov    0x8(%ecx),%eax
+  801a13:	80 e4 ef             	and    $0xef,%ah
+  801a16:	8b 55 10             	mov    0x10(%ebp),%edx
+  801a19:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801a1f:	09 d0                	or     %edx,%eax
+  801a21:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a29:	eb 06                	jmp    801a31 <fcntl+0x50>
+		return fd->fd_omode;
+  801a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a2e:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801a31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a34:	c9                   	leave
+  801a35:	c3                   	ret
+
+00801a36 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a36:	55                   	push   %ebp
+  801a37:	89 e5                	mov    %esp,%ebp
+  801a39:	56                   	push   %esi
+  801a3a:	53                   	push   %ebx
+  801a3b:	83 ec 18             	sub    $0x18,%esp
+  801a3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a41:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a44:	50                   	push   %eax
+  801a45:	53                   	push   %ebx
+  801a46:	e8 52 fb ff ff       	call   80159d <fd_lookup>
+  801a4b:	83 c4 10             	add    $0x10,%esp
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	78 34                	js     801a86 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a52:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a55:	83 ec 08             	sub    $0x8,%esp
+  801a58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5b:	50                   	push   %eax
+  801a5c:	ff 36                	push   (%esi)
+  801a5e:	e8 8c fb ff ff       	call   8015ef <dev_lookup>
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 1c                	js     801a86 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a6a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a6e:	74 1d                	je     801a8d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a73:	8b 40 18             	mov    0x18(%eax),%eax
+  801a76:	85 c0                	test   %eax,%eax
+  801a78:	74 51                	je     801acb <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a7a:	83 ec 08             	sub    $0x8,%esp
+  801a7d:	ff 75 0c             	push   0xc(%ebp)
+  801a80:	56                   	push   %esi
+  801a81:	ff d0                	call   *%eax
+  801a83:	83 c4 10             	add    $0x10,%esp
+}
+  801a86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a89:	5b                   	pop    %ebx
+  801a8a:	5e                   	pop    %esi
+  801a8b:	5d                   	pop    %ebp
+  801a8c:	c3                   	ret
+  801a8d:	89 e2                	mov    %esp,%edx
+  801a8f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a94:	29 d0                	sub    %edx,%eax
+  801a96:	89 c2                	mov    %eax,%edx
+  801a98:	c1 ea 0f             	shr    $0xf,%edx
+  801a9b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa5:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801aa8:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  801aaf:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ab2:	83 ec 04             	sub    $0x4,%esp
+  801ab5:	53                   	push   %ebx
+  801ab6:	50                   	push   %eax
+  801ab7:	68 98 43 80 00       	push   $0x804398
+  801abc:	e8 88 e9 ff ff       	call   800449 <cprintf>
+		return -E_INVAL;
+  801ac1:	83 c4 10             	add    $0x10,%esp
+  801ac4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac9:	eb bb                	jmp    801a86 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801acb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ad0:	eb b4                	jmp    801a86 <ftruncate+0x50>
+
+00801ad2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	56                   	push   %esi
+  801ad6:	53                   	push   %ebx
+  801ad7:	83 ec 18             	sub    $0x18,%esp
+  801ada:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801add:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ae0:	50                   	push   %eax
+  801ae1:	ff 75 08             	push   0x8(%ebp)
+  801ae4:	e8 b4 fa ff ff       	call   80159d <fd_lookup>
+  801ae9:	83 c4 10             	add    $0x10,%esp
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	78 53                	js     801b43 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801af0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801af3:	83 ec 08             	sub    $0x8,%esp
+  801af6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af9:	50                   	push   %eax
+  801afa:	ff 36                	push   (%esi)
+  801afc:	e8 ee fa ff ff       	call   8015ef <dev_lookup>
+  801b01:	83 c4 10             	add    $0x10,%esp
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 3b                	js     801b43 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801b08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b0b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b0f:	74 39                	je     801b4a <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b11:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801b14:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b1b:	00 00 00 
+	stat->st_isdir = 0;
+  801b1e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b25:	00 00 00 
+	stat->st_version = 0;
+  801b28:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801b2f:	00 00 00 
+	stat->st_dev = dev;
+  801b32:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b38:	83 ec 08             	sub    $0x8,%esp
+  801b3b:	53                   	push   %ebx
+  801b3c:	56                   	push   %esi
+  801b3d:	ff 50 14             	call   *0x14(%eax)
+  801b40:	83 c4 10             	add    $0x10,%esp
+}
+  801b43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b46:	5b                   	pop    %ebx
+  801b47:	5e                   	pop    %esi
+  801b48:	5d                   	pop    %ebp
+  801b49:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b4a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b4f:	eb f2                	jmp    801b43 <fstat+0x71>
+
+00801b51 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b51:	55                   	push   %ebp
+  801b52:	89 e5                	mov    %esp,%ebp
+  801b54:	56                   	push   %esi
+  801b55:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b56:	83 ec 08             	sub    $0x8,%esp
+  801b59:	6a 00                	push   $0x0
+  801b5b:	ff 75 08             	push   0x8(%ebp)
+  801b5e:	e8 b7 01 00 00       	call   801d1a <open>
+  801b63:	89 c3                	mov    %eax,%ebx
+  801b65:	83 c4 10             	add    $0x10,%esp
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	78 1b                	js     801b87 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b6c:	83 ec 08             	sub    $0x8,%esp
+  801b6f:	ff 75 0c             	push   0xc(%ebp)
+  801b72:	50                   	push   %eax
+  801b73:	e8 5a ff ff ff       	call   801ad2 <fstat>
+  801b78:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b7a:	89 1c 24             	mov    %ebx,(%esp)
+  801b7d:	e8 60 fb ff ff       	call   8016e2 <close>
+	return r;
+  801b82:	83 c4 10             	add    $0x10,%esp
+  801b85:	89 f3                	mov    %esi,%ebx
+}
+  801b87:	89 d8                	mov    %ebx,%eax
+  801b89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b8c:	5b                   	pop    %ebx
+  801b8d:	5e                   	pop    %esi
+  801b8e:	5d                   	pop    %ebp
+  801b8f:	c3                   	ret
+
+00801b90 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	56                   	push   %esi
+  801b94:	53                   	push   %ebx
+  801b95:	89 c6                	mov    %eax,%esi
+  801b97:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801b99:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801ba0:	74 27                	je     801bc9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ba2:	6a 07                	push   $0x7
+  801ba4:	68 00 70 80 00       	push   $0x807000
+  801ba9:	56                   	push   %esi
+  801baa:	ff 35 00 60 80 00    	push   0x806000
+  801bb0:	e8 ed 20 00 00       	call   803ca2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801bb5:	83 c4 0c             	add    $0xc,%esp
+  801bb8:	6a 00                	push   $0x0
+  801bba:	53                   	push   %ebx
+  801bbb:	6a 00                	push   $0x0
+  801bbd:	e8 50 1e 00 00       	call   803a12 <ipc_recv>
+}
+  801bc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc5:	5b                   	pop    %ebx
+  801bc6:	5e                   	pop    %esi
+  801bc7:	5d                   	pop    %ebp
+  801bc8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bc9:	83 ec 0c             	sub    $0xc,%esp
+  801bcc:	6a 02                	push   $0x2
+  801bce:	e8 38 21 00 00       	call   803d0b <ipc_find_env>
+  801bd3:	a3 00 60 80 00       	mov    %eax,0x806000
+  801bd8:	83 c4 10             	add    $0x10,%esp
+  801bdb:	eb c5                	jmp    801ba2 <fsipc+0x12>
+
+00801bdd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801bdd:	55                   	push   %ebp
+  801bde:	89 e5                	mov    %esp,%ebp
+  801be0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801be9:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801bee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bf1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c00:	e8 8b ff ff ff       	call   801b90 <fsipc>
+}
+  801c05:	c9                   	leave
+  801c06:	c3                   	ret
+
+00801c07 <devfile_flush>:
+{
+  801c07:	55                   	push   %ebp
+  801c08:	89 e5                	mov    %esp,%ebp
+  801c0a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c10:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c13:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c1d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c22:	e8 69 ff ff ff       	call   801b90 <fsipc>
+}
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+
+00801c29 <devfile_stat>:
+{
+  801c29:	55                   	push   %ebp
+  801c2a:	89 e5                	mov    %esp,%ebp
+  801c2c:	53                   	push   %ebx
+  801c2d:	83 ec 04             	sub    $0x4,%esp
+  801c30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c36:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c39:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c43:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c48:	e8 43 ff ff ff       	call   801b90 <fsipc>
+  801c4d:	85 c0                	test   %eax,%eax
+  801c4f:	78 37                	js     801c88 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c51:	83 ec 08             	sub    $0x8,%esp
+  801c54:	68 00 70 80 00       	push   $0x807000
+  801c59:	53                   	push   %ebx
+  801c5a:	e8 e1 ee ff ff       	call   800b40 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c5f:	a1 80 70 80 00       	mov    0x807080,%eax
+  801c64:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c6a:	a1 84 70 80 00       	mov    0x807084,%eax
+  801c6f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801c75:	a1 88 70 80 00       	mov    0x807088,%eax
+  801c7a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801c80:	83 c4 10             	add    $0x10,%esp
+  801c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+
+00801c8d <devfile_write>:
+{
+  801c8d:	55                   	push   %ebp
+  801c8e:	89 e5                	mov    %esp,%ebp
+  801c90:	83 ec 0c             	sub    $0xc,%esp
+  801c93:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801c96:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c9b:	39 d0                	cmp    %edx,%eax
+  801c9d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ca3:	8b 52 0c             	mov    0xc(%edx),%edx
+  801ca6:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801cac:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801cb1:	50                   	push   %eax
+  801cb2:	ff 75 0c             	push   0xc(%ebp)
+  801cb5:	68 08 70 80 00       	push   $0x807008
+  801cba:	e8 31 f0 ff ff       	call   800cf0 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cc9:	e8 c2 fe ff ff       	call   801b90 <fsipc>
+}
+  801cce:	c9                   	leave
+  801ccf:	c3                   	ret
+
+00801cd0 <devfile_read>:
+{
+  801cd0:	55                   	push   %ebp
+  801cd1:	89 e5                	mov    %esp,%ebp
+  801cd3:	53                   	push   %ebx
+  801cd4:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801cd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cda:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cdd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801ce2:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ce5:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801cea:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801cef:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cf4:	e8 97 fe ff ff       	call   801b90 <fsipc>
+  801cf9:	89 c3                	mov    %eax,%ebx
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	78 14                	js     801d13 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801cff:	83 ec 04             	sub    $0x4,%esp
+  801d02:	50                   	push   %eax
+  801d03:	68 00 70 80 00       	push   $0x807000
+  801d08:	ff 75 0c             	push   0xc(%ebp)
+  801d0b:	e8 e0 ef ff ff       	call   800cf0 <memmove>
+	return r;
+  801d10:	83 c4 10             	add    $0x10,%esp
+}
+  801d13:	89 d8                	mov    %ebx,%eax
+  801d15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d18:	c9                   	leave
+  801d19:	c3                   	ret
+
+00801d1a <open>:
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	53                   	push   %ebx
+  801d1e:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801d21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d24:	50                   	push   %eax
+  801d25:	e8 23 f8 ff ff       	call   80154d <fd_alloc>
+  801d2a:	89 c3                	mov    %eax,%ebx
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 2a                	js     801d5d <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801d33:	83 ec 0c             	sub    $0xc,%esp
+  801d36:	ff 75 08             	push   0x8(%ebp)
+  801d39:	e8 b6 ed ff ff       	call   800af4 <strlen>
+  801d3e:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801d41:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801d46:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801d4b:	7e 17                	jle    801d64 <open+0x4a>
+	fd_close(fd, 1);
+  801d4d:	83 ec 08             	sub    $0x8,%esp
+  801d50:	6a 01                	push   $0x1
+  801d52:	ff 75 f4             	push   -0xc(%ebp)
+  801d55:	e8 08 f9 ff ff       	call   801662 <fd_close>
+	return r;
+  801d5a:	83 c4 10             	add    $0x10,%esp
+}
+  801d5d:	89 d8                	mov    %ebx,%eax
+  801d5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d62:	c9                   	leave
+  801d63:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801d64:	83 ec 08             	sub    $0x8,%esp
+  801d67:	ff 75 08             	push   0x8(%ebp)
+  801d6a:	68 00 70 80 00       	push   $0x807000
+  801d6f:	e8 cc ed ff ff       	call   800b40 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d77:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801d7c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d84:	e8 07 fe ff ff       	call   801b90 <fsipc>
+  801d89:	89 c3                	mov    %eax,%ebx
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	85 c0                	test   %eax,%eax
+  801d90:	78 bb                	js     801d4d <open+0x33>
+	return fd2num(fd); 	
+  801d92:	83 ec 0c             	sub    $0xc,%esp
+  801d95:	ff 75 f4             	push   -0xc(%ebp)
+  801d98:	e8 89 f7 ff ff       	call   801526 <fd2num>
+  801d9d:	89 c3                	mov    %eax,%ebx
+  801d9f:	83 c4 10             	add    $0x10,%esp
+  801da2:	eb b9                	jmp    801d5d <open+0x43>
+
+00801da4 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801da4:	55                   	push   %ebp
+  801da5:	89 e5                	mov    %esp,%ebp
+  801da7:	53                   	push   %ebx
+  801da8:	83 ec 1c             	sub    $0x1c,%esp
+  801dab:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db1:	50                   	push   %eax
+  801db2:	ff 75 08             	push   0x8(%ebp)
+  801db5:	e8 e3 f7 ff ff       	call   80159d <fd_lookup>
+  801dba:	83 c4 10             	add    $0x10,%esp
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 5a                	js     801e1b <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801dc1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc4:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801dca:	39 10                	cmp    %edx,(%eax)
+  801dcc:	75 66                	jne    801e34 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801dce:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801dd5:	74 49                	je     801e20 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801dd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dda:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ddd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801de2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801de5:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801dea:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801df0:	6a 07                	push   $0x7
+  801df2:	68 00 70 80 00       	push   $0x807000
+  801df7:	6a 09                	push   $0x9
+  801df9:	ff 35 00 60 80 00    	push   0x806000
+  801dff:	e8 9e 1e 00 00       	call   803ca2 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801e04:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801e0b:	6a 00                	push   $0x0
+  801e0d:	53                   	push   %ebx
+  801e0e:	ff 75 10             	push   0x10(%ebp)
+  801e11:	6a 00                	push   $0x0
+  801e13:	e8 c7 1c 00 00       	call   803adf <ipc_recv_pages>
+  801e18:	83 c4 20             	add    $0x20,%esp
+}
+  801e1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1e:	c9                   	leave
+  801e1f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e20:	83 ec 0c             	sub    $0xc,%esp
+  801e23:	6a 02                	push   $0x2
+  801e25:	e8 e1 1e 00 00       	call   803d0b <ipc_find_env>
+  801e2a:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e2f:	83 c4 10             	add    $0x10,%esp
+  801e32:	eb a3                	jmp    801dd7 <fmap+0x33>
+		return -E_INVAL;
+  801e34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e39:	eb e0                	jmp    801e1b <fmap+0x77>
+
+00801e3b <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801e3b:	55                   	push   %ebp
+  801e3c:	89 e5                	mov    %esp,%ebp
+  801e3e:	53                   	push   %ebx
+  801e3f:	83 ec 10             	sub    $0x10,%esp
+  801e42:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801e45:	53                   	push   %ebx
+  801e46:	e8 a9 ec ff ff       	call   800af4 <strlen>
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e53:	7f 25                	jg     801e7a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801e55:	83 ec 08             	sub    $0x8,%esp
+  801e58:	53                   	push   %ebx
+  801e59:	68 00 70 80 00       	push   $0x807000
+  801e5e:	e8 dd ec ff ff       	call   800b40 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801e63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e68:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e6d:	e8 1e fd ff ff       	call   801b90 <fsipc>
+  801e72:	83 c4 10             	add    $0x10,%esp
+}
+  801e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e78:	c9                   	leave
+  801e79:	c3                   	ret
+		return -E_BAD_PATH;
+  801e7a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e7f:	eb f4                	jmp    801e75 <remove+0x3a>
+
+00801e81 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e81:	55                   	push   %ebp
+  801e82:	89 e5                	mov    %esp,%ebp
+  801e84:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801e87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e91:	e8 fa fc ff ff       	call   801b90 <fsipc>
+}
+  801e96:	c9                   	leave
+  801e97:	c3                   	ret
+
+00801e98 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801e98:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801e9c:	7f 01                	jg     801e9f <writebuf+0x7>
+  801e9e:	c3                   	ret
+{
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	53                   	push   %ebx
+  801ea3:	83 ec 08             	sub    $0x8,%esp
+  801ea6:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801ea8:	ff 70 04             	push   0x4(%eax)
+  801eab:	8d 40 10             	lea    0x10(%eax),%eax
+  801eae:	50                   	push   %eax
+  801eaf:	ff 33                	push   (%ebx)
+  801eb1:	e8 63 fa ff ff       	call   801919 <write>
+		if (result > 0)
+  801eb6:	83 c4 10             	add    $0x10,%esp
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	7e 03                	jle    801ec0 <writebuf+0x28>
+			b->result += result;
+  801ebd:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801ec0:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801ec3:	74 0d                	je     801ed2 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801ec5:	85 c0                	test   %eax,%eax
+  801ec7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecc:	0f 4f c2             	cmovg  %edx,%eax
+  801ecf:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801ed2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed5:	c9                   	leave
+  801ed6:	c3                   	ret
+
+00801ed7 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+  801eda:	53                   	push   %ebx
+  801edb:	83 ec 04             	sub    $0x4,%esp
+  801ede:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801ee1:	8b 53 04             	mov    0x4(%ebx),%edx
+  801ee4:	8d 42 01             	lea    0x1(%edx),%eax
+  801ee7:	89 43 04             	mov    %eax,0x4(%ebx)
+  801eea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801eed:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801ef1:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801ef6:	74 05                	je     801efd <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801ef8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801efb:	c9                   	leave
+  801efc:	c3                   	ret
+		writebuf(b);
+  801efd:	89 d8                	mov    %ebx,%eax
+  801eff:	e8 94 ff ff ff       	call   801e98 <writebuf>
+		b->idx = 0;
+  801f04:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801f0b:	eb eb                	jmp    801ef8 <putch+0x21>
+
+00801f0d <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f19:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801f1f:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801f26:	00 00 00 
+	b.result = 0;
+  801f29:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801f30:	00 00 00 
+	b.error = 1;
+  801f33:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801f3a:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801f3d:	ff 75 10             	push   0x10(%ebp)
+  801f40:	ff 75 0c             	push   0xc(%ebp)
+  801f43:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801f49:	50                   	push   %eax
+  801f4a:	68 d7 1e 80 00       	push   $0x801ed7
+  801f4f:	e8 f4 e5 ff ff       	call   800548 <vprintfmt>
+	if (b.idx > 0)
+  801f54:	83 c4 10             	add    $0x10,%esp
+  801f57:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801f5e:	7f 12                	jg     801f72 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801f60:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	75 06                	jne    801f70 <vfprintf+0x63>
+  801f6a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801f70:	c9                   	leave
+  801f71:	c3                   	ret
+		writebuf(&b);
+  801f72:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801f78:	e8 1b ff ff ff       	call   801e98 <writebuf>
+  801f7d:	eb e1                	jmp    801f60 <vfprintf+0x53>
+
+00801f7f <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801f85:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801f88:	50                   	push   %eax
+  801f89:	ff 75 0c             	push   0xc(%ebp)
+  801f8c:	ff 75 08             	push   0x8(%ebp)
+  801f8f:	e8 79 ff ff ff       	call   801f0d <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801f94:	c9                   	leave
+  801f95:	c3                   	ret
+
+00801f96 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801f96:	55                   	push   %ebp
+  801f97:	89 e5                	mov    %esp,%ebp
+  801f99:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801f9c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801f9f:	50                   	push   %eax
+  801fa0:	ff 75 08             	push   0x8(%ebp)
+  801fa3:	6a 01                	push   $0x1
+  801fa5:	e8 63 ff ff ff       	call   801f0d <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801faa:	c9                   	leave
+  801fab:	c3                   	ret
+
+00801fac <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801fac:	55                   	push   %ebp
+  801fad:	89 e5                	mov    %esp,%ebp
+  801faf:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801fb2:	68 08 44 80 00       	push   $0x804408
+  801fb7:	ff 75 0c             	push   0xc(%ebp)
+  801fba:	e8 81 eb ff ff       	call   800b40 <strcpy>
+	return 0;
+}
+  801fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc4:	c9                   	leave
+  801fc5:	c3                   	ret
+
+00801fc6 <devsock_close>:
+{
+  801fc6:	55                   	push   %ebp
+  801fc7:	89 e5                	mov    %esp,%ebp
+  801fc9:	53                   	push   %ebx
+  801fca:	83 ec 10             	sub    $0x10,%esp
+  801fcd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801fd0:	53                   	push   %ebx
+  801fd1:	e8 74 1d 00 00       	call   803d4a <pageref>
+  801fd6:	89 c2                	mov    %eax,%edx
+  801fd8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801fe0:	83 fa 01             	cmp    $0x1,%edx
+  801fe3:	74 05                	je     801fea <devsock_close+0x24>
+}
+  801fe5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe8:	c9                   	leave
+  801fe9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801fea:	83 ec 0c             	sub    $0xc,%esp
+  801fed:	ff 73 0c             	push   0xc(%ebx)
+  801ff0:	e8 b0 05 00 00       	call   8025a5 <nsipc_close>
+  801ff5:	83 c4 10             	add    $0x10,%esp
+  801ff8:	eb eb                	jmp    801fe5 <devsock_close+0x1f>
+
+00801ffa <devsock_write>:
+{
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	53                   	push   %ebx
+  801ffe:	83 ec 14             	sub    $0x14,%esp
+  802001:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802004:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802007:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80200a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80200d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802010:	8b 41 08             	mov    0x8(%ecx),%eax
+  802013:	c1 f8 09             	sar    $0x9,%eax
+  802016:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802019:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80201f:	77 13                	ja     802034 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802021:	50                   	push   %eax
+  802022:	52                   	push   %edx
+  802023:	53                   	push   %ebx
+  802024:	ff 71 0c             	push   0xc(%ecx)
+  802027:	e8 5c 06 00 00       	call   802688 <nsipc_send>
+  80202c:	83 c4 10             	add    $0x10,%esp
+}
+  80202f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802032:	c9                   	leave
+  802033:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802034:	50                   	push   %eax
+  802035:	6a 01                	push   $0x1
+  802037:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80203a:	50                   	push   %eax
+  80203b:	ff 71 0c             	push   0xc(%ecx)
+  80203e:	e8 a6 06 00 00       	call   8026e9 <nsipc_sendmsg>
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	eb e7                	jmp    80202f <devsock_write+0x35>
+
+00802048 <devsock_read>:
+{
+  802048:	55                   	push   %ebp
+  802049:	89 e5                	mov    %esp,%ebp
+  80204b:	53                   	push   %ebx
+  80204c:	83 ec 14             	sub    $0x14,%esp
+  80204f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802052:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802055:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802058:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80205b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80205e:	8b 41 08             	mov    0x8(%ecx),%eax
+  802061:	c1 f8 09             	sar    $0x9,%eax
+  802064:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802067:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80206d:	77 13                	ja     802082 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80206f:	50                   	push   %eax
+  802070:	52                   	push   %edx
+  802071:	53                   	push   %ebx
+  802072:	ff 71 0c             	push   0xc(%ecx)
+  802075:	e8 9c 05 00 00       	call   802616 <nsipc_recv>
+  80207a:	83 c4 10             	add    $0x10,%esp
+}
+  80207d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802080:	c9                   	leave
+  802081:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802082:	50                   	push   %eax
+  802083:	6a 01                	push   $0x1
+  802085:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802088:	50                   	push   %eax
+  802089:	ff 71 0c             	push   0xc(%ecx)
+  80208c:	e8 02 0a 00 00       	call   802a93 <nsipc_recvmsg>
+  802091:	83 c4 10             	add    $0x10,%esp
+  802094:	eb e7                	jmp    80207d <devsock_read+0x35>
+
+00802096 <fd2sockid>:
+{
+  802096:	55                   	push   %ebp
+  802097:	89 e5                	mov    %esp,%ebp
+  802099:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80209c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80209f:	52                   	push   %edx
+  8020a0:	50                   	push   %eax
+  8020a1:	e8 f7 f4 ff ff       	call   80159d <fd_lookup>
+  8020a6:	83 c4 10             	add    $0x10,%esp
+  8020a9:	85 c0                	test   %eax,%eax
+  8020ab:	78 10                	js     8020bd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020b0:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8020b6:	39 08                	cmp    %ecx,(%eax)
+  8020b8:	75 05                	jne    8020bf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020ba:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020bd:	c9                   	leave
+  8020be:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020c4:	eb f7                	jmp    8020bd <fd2sockid+0x27>
+
+008020c6 <sock_flags>:
+{
+  8020c6:	55                   	push   %ebp
+  8020c7:	89 e5                	mov    %esp,%ebp
+  8020c9:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8020cc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020cf:	52                   	push   %edx
+  8020d0:	50                   	push   %eax
+  8020d1:	e8 c7 f4 ff ff       	call   80159d <fd_lookup>
+  8020d6:	83 c4 10             	add    $0x10,%esp
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	78 0e                	js     8020eb <sock_flags+0x25>
+  8020dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e0:	8b 40 08             	mov    0x8(%eax),%eax
+  8020e3:	c1 e8 09             	shr    $0x9,%eax
+  8020e6:	83 e0 08             	and    $0x8,%eax
+}
+  8020e9:	c9                   	leave
+  8020ea:	c3                   	ret
+		return 0;
+  8020eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f0:	eb f7                	jmp    8020e9 <sock_flags+0x23>
+
+008020f2 <alloc_sockfd>:
+{
+  8020f2:	55                   	push   %ebp
+  8020f3:	89 e5                	mov    %esp,%ebp
+  8020f5:	56                   	push   %esi
+  8020f6:	53                   	push   %ebx
+  8020f7:	83 ec 1c             	sub    $0x1c,%esp
+  8020fa:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ff:	50                   	push   %eax
+  802100:	e8 48 f4 ff ff       	call   80154d <fd_alloc>
+  802105:	89 c3                	mov    %eax,%ebx
+  802107:	83 c4 10             	add    $0x10,%esp
+  80210a:	85 c0                	test   %eax,%eax
+  80210c:	78 43                	js     802151 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80210e:	83 ec 04             	sub    $0x4,%esp
+  802111:	68 07 04 00 00       	push   $0x407
+  802116:	ff 75 f4             	push   -0xc(%ebp)
+  802119:	6a 00                	push   $0x0
+  80211b:	e8 54 ee ff ff       	call   800f74 <sys_page_alloc>
+  802120:	89 c3                	mov    %eax,%ebx
+  802122:	83 c4 10             	add    $0x10,%esp
+  802125:	85 c0                	test   %eax,%eax
+  802127:	78 28                	js     802151 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802129:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80212c:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802132:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802134:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802137:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80213e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802141:	83 ec 0c             	sub    $0xc,%esp
+  802144:	50                   	push   %eax
+  802145:	e8 dc f3 ff ff       	call   801526 <fd2num>
+  80214a:	89 c3                	mov    %eax,%ebx
+  80214c:	83 c4 10             	add    $0x10,%esp
+  80214f:	eb 0c                	jmp    80215d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802151:	83 ec 0c             	sub    $0xc,%esp
+  802154:	56                   	push   %esi
+  802155:	e8 4b 04 00 00       	call   8025a5 <nsipc_close>
+		return r;
+  80215a:	83 c4 10             	add    $0x10,%esp
+}
+  80215d:	89 d8                	mov    %ebx,%eax
+  80215f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802162:	5b                   	pop    %ebx
+  802163:	5e                   	pop    %esi
+  802164:	5d                   	pop    %ebp
+  802165:	c3                   	ret
+
+00802166 <accept>:
+{
+  802166:	55                   	push   %ebp
+  802167:	89 e5                	mov    %esp,%ebp
+  802169:	56                   	push   %esi
+  80216a:	53                   	push   %ebx
+  80216b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80216e:	89 f0                	mov    %esi,%eax
+  802170:	e8 21 ff ff ff       	call   802096 <fd2sockid>
+  802175:	89 c3                	mov    %eax,%ebx
+  802177:	85 c0                	test   %eax,%eax
+  802179:	78 24                	js     80219f <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80217b:	89 f0                	mov    %esi,%eax
+  80217d:	e8 44 ff ff ff       	call   8020c6 <sock_flags>
+  802182:	50                   	push   %eax
+  802183:	ff 75 10             	push   0x10(%ebp)
+  802186:	ff 75 0c             	push   0xc(%ebp)
+  802189:	53                   	push   %ebx
+  80218a:	e8 6b 03 00 00       	call   8024fa <nsipc_accept>
+  80218f:	89 c3                	mov    %eax,%ebx
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	85 c0                	test   %eax,%eax
+  802196:	78 07                	js     80219f <accept+0x39>
+	return alloc_sockfd(r);
+  802198:	e8 55 ff ff ff       	call   8020f2 <alloc_sockfd>
+  80219d:	89 c3                	mov    %eax,%ebx
+}
+  80219f:	89 d8                	mov    %ebx,%eax
+  8021a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a4:	5b                   	pop    %ebx
+  8021a5:	5e                   	pop    %esi
+  8021a6:	5d                   	pop    %ebp
+  8021a7:	c3                   	ret
+
+008021a8 <bind>:
+{
+  8021a8:	55                   	push   %ebp
+  8021a9:	89 e5                	mov    %esp,%ebp
+  8021ab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b1:	e8 e0 fe ff ff       	call   802096 <fd2sockid>
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	78 12                	js     8021cc <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8021ba:	83 ec 04             	sub    $0x4,%esp
+  8021bd:	ff 75 10             	push   0x10(%ebp)
+  8021c0:	ff 75 0c             	push   0xc(%ebp)
+  8021c3:	50                   	push   %eax
+  8021c4:	e8 85 03 00 00       	call   80254e <nsipc_bind>
+  8021c9:	83 c4 10             	add    $0x10,%esp
+}
+  8021cc:	c9                   	leave
+  8021cd:	c3                   	ret
+
+008021ce <shutdown>:
+{
+  8021ce:	55                   	push   %ebp
+  8021cf:	89 e5                	mov    %esp,%ebp
+  8021d1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d7:	e8 ba fe ff ff       	call   802096 <fd2sockid>
+  8021dc:	85 c0                	test   %eax,%eax
+  8021de:	78 0f                	js     8021ef <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8021e0:	83 ec 08             	sub    $0x8,%esp
+  8021e3:	ff 75 0c             	push   0xc(%ebp)
+  8021e6:	50                   	push   %eax
+  8021e7:	e8 97 03 00 00       	call   802583 <nsipc_shutdown>
+  8021ec:	83 c4 10             	add    $0x10,%esp
+}
+  8021ef:	c9                   	leave
+  8021f0:	c3                   	ret
+
+008021f1 <connect>:
+{
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fa:	e8 97 fe ff ff       	call   802096 <fd2sockid>
+  8021ff:	85 c0                	test   %eax,%eax
+  802201:	78 12                	js     802215 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802203:	83 ec 04             	sub    $0x4,%esp
+  802206:	ff 75 10             	push   0x10(%ebp)
+  802209:	ff 75 0c             	push   0xc(%ebp)
+  80220c:	50                   	push   %eax
+  80220d:	e8 ad 03 00 00       	call   8025bf <nsipc_connect>
+  802212:	83 c4 10             	add    $0x10,%esp
+}
+  802215:	c9                   	leave
+  802216:	c3                   	ret
+
+00802217 <listen>:
+{
+  802217:	55                   	push   %ebp
+  802218:	89 e5                	mov    %esp,%ebp
+  80221a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80221d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802220:	e8 71 fe ff ff       	call   802096 <fd2sockid>
+  802225:	85 c0                	test   %eax,%eax
+  802227:	78 0f                	js     802238 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802229:	83 ec 08             	sub    $0x8,%esp
+  80222c:	ff 75 0c             	push   0xc(%ebp)
+  80222f:	50                   	push   %eax
+  802230:	e8 bf 03 00 00       	call   8025f4 <nsipc_listen>
+  802235:	83 c4 10             	add    $0x10,%esp
+}
+  802238:	c9                   	leave
+  802239:	c3                   	ret
+
+0080223a <sendmsg>:
+{
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	57                   	push   %edi
+  80223e:	56                   	push   %esi
+  80223f:	53                   	push   %ebx
+  802240:	83 ec 0c             	sub    $0xc,%esp
+  802243:	8b 75 08             	mov    0x8(%ebp),%esi
+  802246:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802249:	89 f0                	mov    %esi,%eax
+  80224b:	e8 46 fe ff ff       	call   802096 <fd2sockid>
+  802250:	89 c3                	mov    %eax,%ebx
+  802252:	85 c0                	test   %eax,%eax
+  802254:	78 1c                	js     802272 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802256:	89 f0                	mov    %esi,%eax
+  802258:	e8 69 fe ff ff       	call   8020c6 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80225d:	0b 45 10             	or     0x10(%ebp),%eax
+  802260:	50                   	push   %eax
+  802261:	ff 77 0c             	push   0xc(%edi)
+  802264:	ff 77 08             	push   0x8(%edi)
+  802267:	53                   	push   %ebx
+  802268:	e8 7c 04 00 00       	call   8026e9 <nsipc_sendmsg>
+  80226d:	89 c3                	mov    %eax,%ebx
+  80226f:	83 c4 10             	add    $0x10,%esp
+}
+  802272:	89 d8                	mov    %ebx,%eax
+  802274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802277:	5b                   	pop    %ebx
+  802278:	5e                   	pop    %esi
+  802279:	5f                   	pop    %edi
+  80227a:	5d                   	pop    %ebp
+  80227b:	c3                   	ret
+
+0080227c <recvmsg>:
+{
+  80227c:	55                   	push   %ebp
+  80227d:	89 e5                	mov    %esp,%ebp
+  80227f:	57                   	push   %edi
+  802280:	56                   	push   %esi
+  802281:	53                   	push   %ebx
+  802282:	83 ec 0c             	sub    $0xc,%esp
+  802285:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802288:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80228b:	89 f8                	mov    %edi,%eax
+  80228d:	e8 04 fe ff ff       	call   802096 <fd2sockid>
+  802292:	89 c3                	mov    %eax,%ebx
+  802294:	85 c0                	test   %eax,%eax
+  802296:	78 2a                	js     8022c2 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802298:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80229f:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8022a6:	89 f8                	mov    %edi,%eax
+  8022a8:	e8 19 fe ff ff       	call   8020c6 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8022ad:	0b 45 10             	or     0x10(%ebp),%eax
+  8022b0:	50                   	push   %eax
+  8022b1:	ff 76 0c             	push   0xc(%esi)
+  8022b4:	ff 76 08             	push   0x8(%esi)
+  8022b7:	53                   	push   %ebx
+  8022b8:	e8 d6 07 00 00       	call   802a93 <nsipc_recvmsg>
+  8022bd:	89 c3                	mov    %eax,%ebx
+  8022bf:	83 c4 10             	add    $0x10,%esp
+}
+  8022c2:	89 d8                	mov    %ebx,%eax
+  8022c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c7:	5b                   	pop    %ebx
+  8022c8:	5e                   	pop    %esi
+  8022c9:	5f                   	pop    %edi
+  8022ca:	5d                   	pop    %ebp
+  8022cb:	c3                   	ret
+
+008022cc <sendfile>:
+{
+  8022cc:	55                   	push   %ebp
+  8022cd:	89 e5                	mov    %esp,%ebp
+  8022cf:	56                   	push   %esi
+  8022d0:	53                   	push   %ebx
+  8022d1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8022d4:	89 f0                	mov    %esi,%eax
+  8022d6:	e8 bb fd ff ff       	call   802096 <fd2sockid>
+  8022db:	89 c3                	mov    %eax,%ebx
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	78 1f                	js     802300 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8022e1:	89 f0                	mov    %esi,%eax
+  8022e3:	e8 de fd ff ff       	call   8020c6 <sock_flags>
+  8022e8:	83 ec 0c             	sub    $0xc,%esp
+  8022eb:	50                   	push   %eax
+  8022ec:	ff 75 14             	push   0x14(%ebp)
+  8022ef:	ff 75 10             	push   0x10(%ebp)
+  8022f2:	ff 75 0c             	push   0xc(%ebp)
+  8022f5:	53                   	push   %ebx
+  8022f6:	e8 64 06 00 00       	call   80295f <nsipc_sendfile>
+  8022fb:	89 c3                	mov    %eax,%ebx
+  8022fd:	83 c4 20             	add    $0x20,%esp
+}
+  802300:	89 d8                	mov    %ebx,%eax
+  802302:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802305:	5b                   	pop    %ebx
+  802306:	5e                   	pop    %esi
+  802307:	5d                   	pop    %ebp
+  802308:	c3                   	ret
+
+00802309 <evctl>:
+{
+  802309:	55                   	push   %ebp
+  80230a:	89 e5                	mov    %esp,%ebp
+  80230c:	53                   	push   %ebx
+  80230d:	83 ec 04             	sub    $0x4,%esp
+  802310:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802313:	89 d8                	mov    %ebx,%eax
+  802315:	e8 7c fd ff ff       	call   802096 <fd2sockid>
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	78 10                	js     80232e <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80231e:	83 ec 04             	sub    $0x4,%esp
+  802321:	53                   	push   %ebx
+  802322:	ff 75 0c             	push   0xc(%ebp)
+  802325:	50                   	push   %eax
+  802326:	e8 d2 0b 00 00       	call   802efd <nsipc_evctl>
+  80232b:	83 c4 10             	add    $0x10,%esp
+}
+  80232e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802331:	c9                   	leave
+  802332:	c3                   	ret
+
+00802333 <evwait>:
+{
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802339:	ff 75 10             	push   0x10(%ebp)
+  80233c:	ff 75 0c             	push   0xc(%ebp)
+  80233f:	ff 75 08             	push   0x8(%ebp)
+  802342:	e8 e0 0b 00 00       	call   802f27 <nsipc_evwait>
+}
+  802347:	c9                   	leave
+  802348:	c3                   	ret
+
+00802349 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80234f:	ff 75 10             	push   0x10(%ebp)
+  802352:	ff 75 0c             	push   0xc(%ebp)
+  802355:	ff 75 08             	push   0x8(%ebp)
+  802358:	e8 31 0c 00 00       	call   802f8e <nsipc_socket>
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	85 c0                	test   %eax,%eax
+  802362:	78 05                	js     802369 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802364:	e8 89 fd ff ff       	call   8020f2 <alloc_sockfd>
+}
+  802369:	c9                   	leave
+  80236a:	c3                   	ret
+
+0080236b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80236b:	55                   	push   %ebp
+  80236c:	89 e5                	mov    %esp,%ebp
+  80236e:	53                   	push   %ebx
+  80236f:	83 ec 04             	sub    $0x4,%esp
+  802372:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802374:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80237b:	74 26                	je     8023a3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80237d:	6a 07                	push   $0x7
+  80237f:	68 00 80 80 00       	push   $0x808000
+  802384:	53                   	push   %ebx
+  802385:	ff 35 24 63 80 00    	push   0x806324
+  80238b:	e8 12 19 00 00       	call   803ca2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802390:	83 c4 0c             	add    $0xc,%esp
+  802393:	6a 00                	push   $0x0
+  802395:	6a 00                	push   $0x0
+  802397:	6a 00                	push   $0x0
+  802399:	e8 74 16 00 00       	call   803a12 <ipc_recv>
+}
+  80239e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a1:	c9                   	leave
+  8023a2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8023a3:	83 ec 0c             	sub    $0xc,%esp
+  8023a6:	6a 03                	push   $0x3
+  8023a8:	e8 5e 19 00 00       	call   803d0b <ipc_find_env>
+  8023ad:	a3 24 63 80 00       	mov    %eax,0x806324
+  8023b2:	83 c4 10             	add    $0x10,%esp
+  8023b5:	eb c6                	jmp    80237d <nsipc+0x12>
+
+008023b7 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	56                   	push   %esi
+  8023bb:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8023bc:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  8023c2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8023c7:	85 f6                	test   %esi,%esi
+  8023c9:	75 33                	jne    8023fe <nsbulk_map+0x47>
+  8023cb:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8023d0:	83 ec 04             	sub    $0x4,%esp
+  8023d3:	6a 07                	push   $0x7
+  8023d5:	53                   	push   %ebx
+  8023d6:	6a 00                	push   $0x0
+  8023d8:	e8 97 eb ff ff       	call   800f74 <sys_page_alloc>
+  8023dd:	83 c4 10             	add    $0x10,%esp
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	78 1a                	js     8023fe <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8023e4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023ea:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8023f0:	75 de                	jne    8023d0 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8023f2:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  8023f9:	00 00 00 
+	return 0;
+  8023fc:	89 f0                	mov    %esi,%eax
+}
+  8023fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802401:	5b                   	pop    %ebx
+  802402:	5e                   	pop    %esi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+
+00802405 <nsbulk_own>:
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	57                   	push   %edi
+  802409:	56                   	push   %esi
+  80240a:	53                   	push   %ebx
+  80240b:	83 ec 0c             	sub    $0xc,%esp
+  80240e:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802410:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802413:	85 d2                	test   %edx,%edx
+  802415:	7f 0e                	jg     802425 <nsbulk_own+0x20>
+	return 0;
+  802417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241c:	eb 47                	jmp    802465 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80241e:	83 c3 01             	add    $0x1,%ebx
+  802421:	39 fb                	cmp    %edi,%ebx
+  802423:	7d 3b                	jge    802460 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802425:	be 01 00 00 00       	mov    $0x1,%esi
+  80242a:	89 d9                	mov    %ebx,%ecx
+  80242c:	d3 e6                	shl    %cl,%esi
+  80242e:	89 f0                	mov    %esi,%eax
+  802430:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  802436:	74 e6                	je     80241e <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802438:	83 ec 04             	sub    $0x4,%esp
+  80243b:	6a 07                	push   $0x7
+  80243d:	89 d8                	mov    %ebx,%eax
+  80243f:	c1 e0 0c             	shl    $0xc,%eax
+  802442:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802447:	50                   	push   %eax
+  802448:	6a 00                	push   $0x0
+  80244a:	e8 25 eb ff ff       	call   800f74 <sys_page_alloc>
+  80244f:	83 c4 10             	add    $0x10,%esp
+  802452:	85 c0                	test   %eax,%eax
+  802454:	78 0f                	js     802465 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802456:	f7 d6                	not    %esi
+  802458:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  80245e:	eb be                	jmp    80241e <nsbulk_own+0x19>
+	return 0;
+  802460:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802468:	5b                   	pop    %ebx
+  802469:	5e                   	pop    %esi
+  80246a:	5f                   	pop    %edi
+  80246b:	5d                   	pop    %ebp
+  80246c:	c3                   	ret
+
+0080246d <nsipc_bulk>:
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	57                   	push   %edi
+  802471:	56                   	push   %esi
+  802472:	53                   	push   %ebx
+  802473:	83 ec 1c             	sub    $0x1c,%esp
+  802476:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802479:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80247b:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802481:	c1 fb 0c             	sar    $0xc,%ebx
+  802484:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802487:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80248e:	74 56                	je     8024e6 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802490:	85 ff                	test   %edi,%edi
+  802492:	7e 24                	jle    8024b8 <nsipc_bulk+0x4b>
+  802494:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80249a:	74 1c                	je     8024b8 <nsipc_bulk+0x4b>
+  80249c:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8024a2:	c1 e3 0c             	shl    $0xc,%ebx
+  8024a5:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8024aa:	0f b6 10             	movzbl (%eax),%edx
+  8024ad:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8024af:	05 00 10 00 00       	add    $0x1000,%eax
+  8024b4:	39 d8                	cmp    %ebx,%eax
+  8024b6:	75 f2                	jne    8024aa <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8024b8:	83 ec 0c             	sub    $0xc,%esp
+  8024bb:	56                   	push   %esi
+  8024bc:	57                   	push   %edi
+  8024bd:	68 00 00 00 e0       	push   $0xe0000000
+  8024c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8024c5:	ff 35 24 63 80 00    	push   0x806324
+  8024cb:	e8 06 18 00 00       	call   803cd6 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8024d0:	83 c4 1c             	add    $0x1c,%esp
+  8024d3:	6a 00                	push   $0x0
+  8024d5:	6a 00                	push   $0x0
+  8024d7:	6a 00                	push   $0x0
+  8024d9:	e8 34 15 00 00       	call   803a12 <ipc_recv>
+}
+  8024de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e1:	5b                   	pop    %ebx
+  8024e2:	5e                   	pop    %esi
+  8024e3:	5f                   	pop    %edi
+  8024e4:	5d                   	pop    %ebp
+  8024e5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8024e6:	83 ec 0c             	sub    $0xc,%esp
+  8024e9:	6a 03                	push   $0x3
+  8024eb:	e8 1b 18 00 00       	call   803d0b <ipc_find_env>
+  8024f0:	a3 24 63 80 00       	mov    %eax,0x806324
+  8024f5:	83 c4 10             	add    $0x10,%esp
+  8024f8:	eb 96                	jmp    802490 <nsipc_bulk+0x23>
+
+008024fa <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8024fa:	55                   	push   %ebp
+  8024fb:	89 e5                	mov    %esp,%ebp
+  8024fd:	53                   	push   %ebx
+  8024fe:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802501:	8b 45 08             	mov    0x8(%ebp),%eax
+  802504:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802509:	8b 45 14             	mov    0x14(%ebp),%eax
+  80250c:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802511:	b8 01 00 00 00       	mov    $0x1,%eax
+  802516:	e8 50 fe ff ff       	call   80236b <nsipc>
+  80251b:	89 c3                	mov    %eax,%ebx
+  80251d:	85 c0                	test   %eax,%eax
+  80251f:	79 07                	jns    802528 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802521:	89 d8                	mov    %ebx,%eax
+  802523:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802526:	c9                   	leave
+  802527:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802528:	83 ec 04             	sub    $0x4,%esp
+  80252b:	ff 35 10 80 80 00    	push   0x808010
+  802531:	68 00 80 80 00       	push   $0x808000
+  802536:	ff 75 0c             	push   0xc(%ebp)
+  802539:	e8 b2 e7 ff ff       	call   800cf0 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80253e:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802544:	8b 45 10             	mov    0x10(%ebp),%eax
+  802547:	89 10                	mov    %edx,(%eax)
+  802549:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80254c:	eb d3                	jmp    802521 <nsipc_accept+0x27>
+
+0080254e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80254e:	55                   	push   %ebp
+  80254f:	89 e5                	mov    %esp,%ebp
+  802551:	53                   	push   %ebx
+  802552:	83 ec 08             	sub    $0x8,%esp
+  802555:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802558:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255b:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802560:	53                   	push   %ebx
+  802561:	ff 75 0c             	push   0xc(%ebp)
+  802564:	68 04 80 80 00       	push   $0x808004
+  802569:	e8 82 e7 ff ff       	call   800cf0 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80256e:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802574:	b8 02 00 00 00       	mov    $0x2,%eax
+  802579:	e8 ed fd ff ff       	call   80236b <nsipc>
+}
+  80257e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802581:	c9                   	leave
+  802582:	c3                   	ret
+
+00802583 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802583:	55                   	push   %ebp
+  802584:	89 e5                	mov    %esp,%ebp
+  802586:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802589:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802591:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802594:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802599:	b8 03 00 00 00       	mov    $0x3,%eax
+  80259e:	e8 c8 fd ff ff       	call   80236b <nsipc>
+}
+  8025a3:	c9                   	leave
+  8025a4:	c3                   	ret
+
+008025a5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8025a5:	55                   	push   %ebp
+  8025a6:	89 e5                	mov    %esp,%ebp
+  8025a8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8025ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ae:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8025b3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025b8:	e8 ae fd ff ff       	call   80236b <nsipc>
+}
+  8025bd:	c9                   	leave
+  8025be:	c3                   	ret
+
+008025bf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	53                   	push   %ebx
+  8025c3:	83 ec 08             	sub    $0x8,%esp
+  8025c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8025c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025cc:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8025d1:	53                   	push   %ebx
+  8025d2:	ff 75 0c             	push   0xc(%ebp)
+  8025d5:	68 04 80 80 00       	push   $0x808004
+  8025da:	e8 11 e7 ff ff       	call   800cf0 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8025df:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8025e5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025ea:	e8 7c fd ff ff       	call   80236b <nsipc>
+}
+  8025ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f2:	c9                   	leave
+  8025f3:	c3                   	ret
+
+008025f4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8025f4:	55                   	push   %ebp
+  8025f5:	89 e5                	mov    %esp,%ebp
+  8025f7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8025fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025fd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802602:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802605:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80260a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80260f:	e8 57 fd ff ff       	call   80236b <nsipc>
+}
+  802614:	c9                   	leave
+  802615:	c3                   	ret
+
+00802616 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802616:	55                   	push   %ebp
+  802617:	89 e5                	mov    %esp,%ebp
+  802619:	56                   	push   %esi
+  80261a:	53                   	push   %ebx
+  80261b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80261e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802621:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802626:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80262c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80262f:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802634:	b8 07 00 00 00       	mov    $0x7,%eax
+  802639:	e8 2d fd ff ff       	call   80236b <nsipc>
+  80263e:	89 c3                	mov    %eax,%ebx
+  802640:	85 c0                	test   %eax,%eax
+  802642:	78 22                	js     802666 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802644:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802649:	39 c6                	cmp    %eax,%esi
+  80264b:	0f 4e c6             	cmovle %esi,%eax
+  80264e:	39 c3                	cmp    %eax,%ebx
+  802650:	7f 1d                	jg     80266f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802652:	83 ec 04             	sub    $0x4,%esp
+  802655:	53                   	push   %ebx
+  802656:	68 00 80 80 00       	push   $0x808000
+  80265b:	ff 75 0c             	push   0xc(%ebp)
+  80265e:	e8 8d e6 ff ff       	call   800cf0 <memmove>
+  802663:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802666:	89 d8                	mov    %ebx,%eax
+  802668:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80266b:	5b                   	pop    %ebx
+  80266c:	5e                   	pop    %esi
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80266f:	68 14 44 80 00       	push   $0x804414
+  802674:	68 29 44 80 00       	push   $0x804429
+  802679:	68 b2 00 00 00       	push   $0xb2
+  80267e:	68 3e 44 80 00       	push   $0x80443e
+  802683:	e8 e6 dc ff ff       	call   80036e <_panic>
+
+00802688 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802688:	55                   	push   %ebp
+  802689:	89 e5                	mov    %esp,%ebp
+  80268b:	53                   	push   %ebx
+  80268c:	83 ec 04             	sub    $0x4,%esp
+  80268f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802692:	8b 45 08             	mov    0x8(%ebp),%eax
+  802695:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80269a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8026a0:	7f 2e                	jg     8026d0 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8026a2:	83 ec 04             	sub    $0x4,%esp
+  8026a5:	53                   	push   %ebx
+  8026a6:	ff 75 0c             	push   0xc(%ebp)
+  8026a9:	68 0c 80 80 00       	push   $0x80800c
+  8026ae:	e8 3d e6 ff ff       	call   800cf0 <memmove>
+	nsipcbuf.send.req_size = size;
+  8026b3:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8026b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026bc:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8026c1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026c6:	e8 a0 fc ff ff       	call   80236b <nsipc>
+}
+  8026cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ce:	c9                   	leave
+  8026cf:	c3                   	ret
+	assert(size < 1600);
+  8026d0:	68 4a 44 80 00       	push   $0x80444a
+  8026d5:	68 29 44 80 00       	push   $0x804429
+  8026da:	68 bd 00 00 00       	push   $0xbd
+  8026df:	68 3e 44 80 00       	push   $0x80443e
+  8026e4:	e8 85 dc ff ff       	call   80036e <_panic>
+
+008026e9 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8026e9:	55                   	push   %ebp
+  8026ea:	89 e5                	mov    %esp,%ebp
+  8026ec:	57                   	push   %edi
+  8026ed:	56                   	push   %esi
+  8026ee:	53                   	push   %ebx
+  8026ef:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8026f2:	e8 c0 fc ff ff       	call   8023b7 <nsbulk_map>
+  8026f7:	85 c0                	test   %eax,%eax
+  8026f9:	78 55                	js     802750 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8026fb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802702:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802709:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802710:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802713:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802716:	0f 8d 24 02 00 00    	jge    802940 <nsipc_sendmsg+0x257>
+  80271c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80271f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802722:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802725:	89 d8                	mov    %ebx,%eax
+  802727:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80272c:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80272e:	83 ec 0c             	sub    $0xc,%esp
+  802731:	68 20 60 80 00       	push   $0x806020
+  802736:	e8 5a 0f 00 00       	call   803695 <pgbatch_init>
+  80273b:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80273e:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802740:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802743:	e9 82 00 00 00       	jmp    8027ca <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802748:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80274b:	85 db                	test   %ebx,%ebx
+  80274d:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802753:	5b                   	pop    %ebx
+  802754:	5e                   	pop    %esi
+  802755:	5f                   	pop    %edi
+  802756:	5d                   	pop    %ebp
+  802757:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802758:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80275d:	29 c8                	sub    %ecx,%eax
+  80275f:	39 d0                	cmp    %edx,%eax
+  802761:	0f 46 d0             	cmovbe %eax,%edx
+  802764:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802766:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80276c:	85 ff                	test   %edi,%edi
+  80276e:	0f 49 c7             	cmovns %edi,%eax
+  802771:	c1 f8 0c             	sar    $0xc,%eax
+  802774:	ba 01 00 00 00       	mov    $0x1,%edx
+  802779:	e8 87 fc ff ff       	call   802405 <nsbulk_own>
+  80277e:	85 c0                	test   %eax,%eax
+  802780:	0f 88 17 01 00 00    	js     80289d <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802786:	83 ec 04             	sub    $0x4,%esp
+  802789:	56                   	push   %esi
+  80278a:	ff 75 e0             	push   -0x20(%ebp)
+  80278d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802790:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802795:	50                   	push   %eax
+  802796:	e8 55 e5 ff ff       	call   800cf0 <memmove>
+  80279b:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80279e:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8027a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027a4:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8027a7:	0f 84 fd 00 00 00    	je     8028aa <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8027ad:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8027b0:	01 f7                	add    %esi,%edi
+  8027b2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8027b5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8027b8:	0f 8d 01 01 00 00    	jge    8028bf <nsipc_sendmsg+0x1d6>
+  8027be:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8027c4:	0f 8f f0 00 00 00    	jg     8028ba <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8027ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027cd:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8027d0:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8027d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027d6:	89 c2                	mov    %eax,%edx
+  8027d8:	03 13                	add    (%ebx),%edx
+  8027da:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8027dd:	8b 73 04             	mov    0x4(%ebx),%esi
+  8027e0:	29 c6                	sub    %eax,%esi
+  8027e2:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8027e7:	29 f9                	sub    %edi,%ecx
+  8027e9:	39 ce                	cmp    %ecx,%esi
+  8027eb:	89 ca                	mov    %ecx,%edx
+  8027ed:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8027f0:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8027f3:	89 f9                	mov    %edi,%ecx
+  8027f5:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8027fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027fe:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802803:	09 c8                	or     %ecx,%eax
+  802805:	0f 85 4d ff ff ff    	jne    802758 <nsipc_sendmsg+0x6f>
+  80280b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802811:	0f 86 41 ff ff ff    	jbe    802758 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802817:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80281d:	85 ff                	test   %edi,%edi
+  80281f:	0f 49 c7             	cmovns %edi,%eax
+  802822:	c1 f8 0c             	sar    $0xc,%eax
+  802825:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802827:	89 d1                	mov    %edx,%ecx
+  802829:	c1 e9 0c             	shr    $0xc,%ecx
+  80282c:	01 c8                	add    %ecx,%eax
+  80282e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802831:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802834:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802836:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802839:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80283e:	29 c8                	sub    %ecx,%eax
+  802840:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802843:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802846:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802848:	b8 01 00 00 00       	mov    $0x1,%eax
+  80284d:	89 f9                	mov    %edi,%ecx
+  80284f:	d3 e0                	shl    %cl,%eax
+  802851:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802857:	83 ec 08             	sub    $0x8,%esp
+  80285a:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80285c:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80285f:	50                   	push   %eax
+  802860:	6a 00                	push   $0x0
+  802862:	56                   	push   %esi
+  802863:	6a 00                	push   $0x0
+  802865:	68 20 60 80 00       	push   $0x806020
+  80286a:	e8 e4 0e 00 00       	call   803753 <pgbatch_map>
+  80286f:	83 c4 20             	add    $0x20,%esp
+  802872:	85 c0                	test   %eax,%eax
+  802874:	0f 88 ce fe ff ff    	js     802748 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80287a:	83 c7 01             	add    $0x1,%edi
+  80287d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802883:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802886:	39 c7                	cmp    %eax,%edi
+  802888:	75 be                	jne    802848 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80288a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80288d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802890:	89 d6                	mov    %edx,%esi
+  802892:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802898:	e9 01 ff ff ff       	jmp    80279e <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80289d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8028a0:	85 db                	test   %ebx,%ebx
+  8028a2:	0f 45 c3             	cmovne %ebx,%eax
+  8028a5:	e9 a6 fe ff ff       	jmp    802750 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8028aa:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8028ae:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8028b5:	e9 f3 fe ff ff       	jmp    8027ad <nsipc_sendmsg+0xc4>
+  8028ba:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8028bd:	eb 03                	jmp    8028c2 <nsipc_sendmsg+0x1d9>
+  8028bf:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8028c2:	83 ec 0c             	sub    $0xc,%esp
+  8028c5:	68 20 60 80 00       	push   $0x806020
+  8028ca:	e8 d4 0d 00 00       	call   8036a3 <pgbatch_flush>
+  8028cf:	83 c4 10             	add    $0x10,%esp
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	78 50                	js     802926 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8028d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d9:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8028de:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8028e4:	89 fb                	mov    %edi,%ebx
+  8028e6:	29 f3                	sub    %esi,%ebx
+  8028e8:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8028ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028f1:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8028f6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8028fb:	89 fa                	mov    %edi,%edx
+  8028fd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802902:	e8 66 fb ff ff       	call   80246d <nsipc_bulk>
+  802907:	85 c0                	test   %eax,%eax
+  802909:	78 28                	js     802933 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80290b:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80290e:	39 c3                	cmp    %eax,%ebx
+  802910:	75 0c                	jne    80291e <nsipc_sendmsg+0x235>
+  802912:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802915:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802918:	0f 8f f2 fd ff ff    	jg     802710 <nsipc_sendmsg+0x27>
+		sent += r;
+  80291e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802921:	e9 2a fe ff ff       	jmp    802750 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802926:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802929:	85 db                	test   %ebx,%ebx
+  80292b:	0f 45 c3             	cmovne %ebx,%eax
+  80292e:	e9 1d fe ff ff       	jmp    802750 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802933:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802936:	85 db                	test   %ebx,%ebx
+  802938:	0f 45 c3             	cmovne %ebx,%eax
+  80293b:	e9 10 fe ff ff       	jmp    802750 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802940:	83 ec 0c             	sub    $0xc,%esp
+  802943:	68 20 60 80 00       	push   $0x806020
+  802948:	e8 48 0d 00 00       	call   803695 <pgbatch_init>
+  80294d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802950:	be 00 00 00 00       	mov    $0x0,%esi
+  802955:	bf 00 00 00 00       	mov    $0x0,%edi
+  80295a:	e9 63 ff ff ff       	jmp    8028c2 <nsipc_sendmsg+0x1d9>
+
+0080295f <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80295f:	55                   	push   %ebp
+  802960:	89 e5                	mov    %esp,%ebp
+  802962:	57                   	push   %edi
+  802963:	56                   	push   %esi
+  802964:	53                   	push   %ebx
+  802965:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802968:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  80296f:	0f 84 c8 00 00 00    	je     802a3d <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802975:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80297c:	0f 84 e4 00 00 00    	je     802a66 <nsipc_sendfile+0x107>
+{
+  802982:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802987:	89 fb                	mov    %edi,%ebx
+  802989:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80298c:	0f 83 f0 00 00 00    	jae    802a82 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802992:	89 fa                	mov    %edi,%edx
+  802994:	03 55 10             	add    0x10(%ebp),%edx
+  802997:	89 d0                	mov    %edx,%eax
+  802999:	c1 f8 1f             	sar    $0x1f,%eax
+  80299c:	c1 e8 14             	shr    $0x14,%eax
+  80299f:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8029a2:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8029a8:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8029aa:	6a 10                	push   $0x10
+  8029ac:	68 00 20 01 e0       	push   $0xe0012000
+  8029b1:	52                   	push   %edx
+  8029b2:	ff 75 0c             	push   0xc(%ebp)
+  8029b5:	e8 ea f3 ff ff       	call   801da4 <fmap>
+  8029ba:	83 c4 10             	add    $0x10,%esp
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	0f 8e b8 00 00 00    	jle    802a7d <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8029c5:	39 c6                	cmp    %eax,%esi
+  8029c7:	0f 8d b5 00 00 00    	jge    802a82 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8029cd:	29 f0                	sub    %esi,%eax
+  8029cf:	8b 55 14             	mov    0x14(%ebp),%edx
+  8029d2:	29 da                	sub    %ebx,%edx
+  8029d4:	39 d0                	cmp    %edx,%eax
+  8029d6:	89 d3                	mov    %edx,%ebx
+  8029d8:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8029db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029de:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8029e3:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8029e9:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8029ef:	8b 45 18             	mov    0x18(%ebp),%eax
+  8029f2:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8029f7:	83 ec 0c             	sub    $0xc,%esp
+  8029fa:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8029fc:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802a03:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802a06:	83 c0 01             	add    $0x1,%eax
+  802a09:	50                   	push   %eax
+  802a0a:	68 00 10 01 e0       	push   $0xe0011000
+  802a0f:	6a 11                	push   $0x11
+  802a11:	ff 35 24 63 80 00    	push   0x806324
+  802a17:	e8 ba 12 00 00       	call   803cd6 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802a1c:	83 c4 1c             	add    $0x1c,%esp
+  802a1f:	6a 00                	push   $0x0
+  802a21:	6a 00                	push   $0x0
+  802a23:	6a 00                	push   $0x0
+  802a25:	e8 e8 0f 00 00       	call   803a12 <ipc_recv>
+  802a2a:	83 c4 10             	add    $0x10,%esp
+  802a2d:	85 c0                	test   %eax,%eax
+  802a2f:	78 5b                	js     802a8c <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802a31:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802a33:	39 c3                	cmp    %eax,%ebx
+  802a35:	0f 8e 4c ff ff ff    	jle    802987 <nsipc_sendfile+0x28>
+  802a3b:	eb 45                	jmp    802a82 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802a3d:	83 ec 04             	sub    $0x4,%esp
+  802a40:	6a 07                	push   $0x7
+  802a42:	68 00 10 01 e0       	push   $0xe0011000
+  802a47:	6a 00                	push   $0x0
+  802a49:	e8 26 e5 ff ff       	call   800f74 <sys_page_alloc>
+  802a4e:	89 c7                	mov    %eax,%edi
+  802a50:	83 c4 10             	add    $0x10,%esp
+  802a53:	85 c0                	test   %eax,%eax
+  802a55:	78 2b                	js     802a82 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802a57:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802a5e:	00 00 00 
+  802a61:	e9 0f ff ff ff       	jmp    802975 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a66:	83 ec 0c             	sub    $0xc,%esp
+  802a69:	6a 03                	push   $0x3
+  802a6b:	e8 9b 12 00 00       	call   803d0b <ipc_find_env>
+  802a70:	a3 24 63 80 00       	mov    %eax,0x806324
+  802a75:	83 c4 10             	add    $0x10,%esp
+  802a78:	e9 05 ff ff ff       	jmp    802982 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802a7d:	85 ff                	test   %edi,%edi
+  802a7f:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802a82:	89 f8                	mov    %edi,%eax
+  802a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a87:	5b                   	pop    %ebx
+  802a88:	5e                   	pop    %esi
+  802a89:	5f                   	pop    %edi
+  802a8a:	5d                   	pop    %ebp
+  802a8b:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802a8c:	85 ff                	test   %edi,%edi
+  802a8e:	0f 44 f8             	cmove  %eax,%edi
+  802a91:	eb ef                	jmp    802a82 <nsipc_sendfile+0x123>
+
+00802a93 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802a93:	55                   	push   %ebp
+  802a94:	89 e5                	mov    %esp,%ebp
+  802a96:	57                   	push   %edi
+  802a97:	56                   	push   %esi
+  802a98:	53                   	push   %ebx
+  802a99:	83 ec 1c             	sub    $0x1c,%esp
+  802a9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802a9f:	e8 13 f9 ff ff       	call   8023b7 <nsbulk_map>
+  802aa4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802aa7:	85 c0                	test   %eax,%eax
+  802aa9:	0f 88 ba 00 00 00    	js     802b69 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802aaf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ab3:	0f 8e bb 00 00 00    	jle    802b74 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802ab9:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802abe:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802ac3:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802ac8:	89 f8                	mov    %edi,%eax
+  802aca:	29 f0                	sub    %esi,%eax
+  802acc:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802ad0:	39 c8                	cmp    %ecx,%eax
+  802ad2:	0f 47 c1             	cmova  %ecx,%eax
+  802ad5:	01 f0                	add    %esi,%eax
+  802ad7:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802ad9:	83 c2 01             	add    $0x1,%edx
+  802adc:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802adf:	7e 07                	jle    802ae8 <nsipc_recvmsg+0x55>
+  802ae1:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802ae6:	7e e0                	jle    802ac8 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802ae8:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802aee:	c1 fa 0c             	sar    $0xc,%edx
+  802af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af6:	e8 0a f9 ff ff       	call   802405 <nsbulk_own>
+  802afb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802afe:	85 c0                	test   %eax,%eax
+  802b00:	78 67                	js     802b69 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802b02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b05:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802b0a:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802b10:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b13:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802b18:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802b1d:	89 f2                	mov    %esi,%edx
+  802b1f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802b24:	e8 44 f9 ff ff       	call   80246d <nsipc_bulk>
+  802b29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b2c:	85 c0                	test   %eax,%eax
+  802b2e:	78 39                	js     802b69 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802b30:	39 f0                	cmp    %esi,%eax
+  802b32:	7f 4a                	jg     802b7e <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802b34:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b39:	85 c0                	test   %eax,%eax
+  802b3b:	7e 2c                	jle    802b69 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802b3d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802b40:	29 fe                	sub    %edi,%esi
+  802b42:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b45:	39 c6                	cmp    %eax,%esi
+  802b47:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802b4a:	83 ec 04             	sub    $0x4,%esp
+  802b4d:	56                   	push   %esi
+  802b4e:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802b54:	50                   	push   %eax
+  802b55:	ff 33                	push   (%ebx)
+  802b57:	e8 94 e1 ff ff       	call   800cf0 <memmove>
+		n += m;
+  802b5c:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802b5e:	83 c3 08             	add    $0x8,%ebx
+  802b61:	83 c4 10             	add    $0x10,%esp
+  802b64:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802b67:	7f d4                	jg     802b3d <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802b69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6f:	5b                   	pop    %ebx
+  802b70:	5e                   	pop    %esi
+  802b71:	5f                   	pop    %edi
+  802b72:	5d                   	pop    %ebp
+  802b73:	c3                   	ret
+	int r, i, n, len = 0;
+  802b74:	be 00 00 00 00       	mov    $0x0,%esi
+  802b79:	e9 6a ff ff ff       	jmp    802ae8 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802b7e:	68 20 44 80 00       	push   $0x804420
+  802b83:	68 29 44 80 00       	push   $0x804429
+  802b88:	68 3b 01 00 00       	push   $0x13b
+  802b8d:	68 3e 44 80 00       	push   $0x80443e
+  802b92:	e8 d7 d7 ff ff       	call   80036e <_panic>
+
+00802b97 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802b97:	55                   	push   %ebp
+  802b98:	89 e5                	mov    %esp,%ebp
+  802b9a:	57                   	push   %edi
+  802b9b:	56                   	push   %esi
+  802b9c:	53                   	push   %ebx
+  802b9d:	83 ec 0c             	sub    $0xc,%esp
+  802ba0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802ba3:	8b 75 10             	mov    0x10(%ebp),%esi
+  802ba6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bac:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802bb1:	8b 07                	mov    (%edi),%eax
+  802bb3:	a3 04 80 80 00       	mov    %eax,0x808004
+  802bb8:	8b 47 04             	mov    0x4(%edi),%eax
+  802bbb:	a3 08 80 80 00       	mov    %eax,0x808008
+  802bc0:	8b 47 08             	mov    0x8(%edi),%eax
+  802bc3:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802bc8:	8b 47 0c             	mov    0xc(%edi),%eax
+  802bcb:	a3 10 80 80 00       	mov    %eax,0x808010
+  802bd0:	8b 47 10             	mov    0x10(%edi),%eax
+  802bd3:	a3 14 80 80 00       	mov    %eax,0x808014
+  802bd8:	8b 47 14             	mov    0x14(%edi),%eax
+  802bdb:	a3 18 80 80 00       	mov    %eax,0x808018
+  802be0:	8b 47 18             	mov    0x18(%edi),%eax
+  802be3:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802be8:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802beb:	a3 20 80 80 00       	mov    %eax,0x808020
+  802bf0:	8b 47 20             	mov    0x20(%edi),%eax
+  802bf3:	a3 24 80 80 00       	mov    %eax,0x808024
+  802bf8:	8b 47 24             	mov    0x24(%edi),%eax
+  802bfb:	a3 28 80 80 00       	mov    %eax,0x808028
+  802c00:	8b 47 28             	mov    0x28(%edi),%eax
+  802c03:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802c08:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802c0b:	a3 30 80 80 00       	mov    %eax,0x808030
+  802c10:	8b 47 30             	mov    0x30(%edi),%eax
+  802c13:	a3 34 80 80 00       	mov    %eax,0x808034
+  802c18:	8b 47 34             	mov    0x34(%edi),%eax
+  802c1b:	a3 38 80 80 00       	mov    %eax,0x808038
+  802c20:	8b 47 38             	mov    0x38(%edi),%eax
+  802c23:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802c28:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802c2b:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802c30:	8b 06                	mov    (%esi),%eax
+  802c32:	a3 44 80 80 00       	mov    %eax,0x808044
+  802c37:	8b 46 04             	mov    0x4(%esi),%eax
+  802c3a:	a3 48 80 80 00       	mov    %eax,0x808048
+  802c3f:	8b 46 08             	mov    0x8(%esi),%eax
+  802c42:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802c47:	8b 46 0c             	mov    0xc(%esi),%eax
+  802c4a:	a3 50 80 80 00       	mov    %eax,0x808050
+  802c4f:	8b 46 10             	mov    0x10(%esi),%eax
+  802c52:	a3 54 80 80 00       	mov    %eax,0x808054
+  802c57:	8b 46 14             	mov    0x14(%esi),%eax
+  802c5a:	a3 58 80 80 00       	mov    %eax,0x808058
+  802c5f:	8b 46 18             	mov    0x18(%esi),%eax
+  802c62:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802c67:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802c6a:	a3 60 80 80 00       	mov    %eax,0x808060
+  802c6f:	8b 46 20             	mov    0x20(%esi),%eax
+  802c72:	a3 64 80 80 00       	mov    %eax,0x808064
+  802c77:	8b 46 24             	mov    0x24(%esi),%eax
+  802c7a:	a3 68 80 80 00       	mov    %eax,0x808068
+  802c7f:	8b 46 28             	mov    0x28(%esi),%eax
+  802c82:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802c87:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802c8a:	a3 70 80 80 00       	mov    %eax,0x808070
+  802c8f:	8b 46 30             	mov    0x30(%esi),%eax
+  802c92:	a3 74 80 80 00       	mov    %eax,0x808074
+  802c97:	8b 46 34             	mov    0x34(%esi),%eax
+  802c9a:	a3 78 80 80 00       	mov    %eax,0x808078
+  802c9f:	8b 46 38             	mov    0x38(%esi),%eax
+  802ca2:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802ca7:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802caa:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802caf:	8b 03                	mov    (%ebx),%eax
+  802cb1:	a3 84 80 80 00       	mov    %eax,0x808084
+  802cb6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802cb9:	a3 88 80 80 00       	mov    %eax,0x808088
+  802cbe:	8b 43 08             	mov    0x8(%ebx),%eax
+  802cc1:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802cc6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802cc9:	a3 90 80 80 00       	mov    %eax,0x808090
+  802cce:	8b 43 10             	mov    0x10(%ebx),%eax
+  802cd1:	a3 94 80 80 00       	mov    %eax,0x808094
+  802cd6:	8b 43 14             	mov    0x14(%ebx),%eax
+  802cd9:	a3 98 80 80 00       	mov    %eax,0x808098
+  802cde:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ce1:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802ce6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802ce9:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802cee:	8b 43 20             	mov    0x20(%ebx),%eax
+  802cf1:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802cf6:	8b 43 24             	mov    0x24(%ebx),%eax
+  802cf9:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802cfe:	8b 43 28             	mov    0x28(%ebx),%eax
+  802d01:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802d06:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802d09:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802d0e:	8b 43 30             	mov    0x30(%ebx),%eax
+  802d11:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802d16:	8b 43 34             	mov    0x34(%ebx),%eax
+  802d19:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802d1e:	8b 43 38             	mov    0x38(%ebx),%eax
+  802d21:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802d26:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802d29:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802d2e:	8b 45 18             	mov    0x18(%ebp),%eax
+  802d31:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802d36:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802d3b:	e8 2b f6 ff ff       	call   80236b <nsipc>
+  802d40:	85 c0                	test   %eax,%eax
+  802d42:	0f 88 ad 01 00 00    	js     802ef5 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802d48:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802d4e:	89 17                	mov    %edx,(%edi)
+  802d50:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802d56:	89 57 04             	mov    %edx,0x4(%edi)
+  802d59:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802d5f:	89 57 08             	mov    %edx,0x8(%edi)
+  802d62:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802d68:	89 57 0c             	mov    %edx,0xc(%edi)
+  802d6b:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802d71:	89 57 10             	mov    %edx,0x10(%edi)
+  802d74:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802d7a:	89 57 14             	mov    %edx,0x14(%edi)
+  802d7d:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802d83:	89 57 18             	mov    %edx,0x18(%edi)
+  802d86:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802d8c:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802d8f:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802d95:	89 57 20             	mov    %edx,0x20(%edi)
+  802d98:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802d9e:	89 57 24             	mov    %edx,0x24(%edi)
+  802da1:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802da7:	89 57 28             	mov    %edx,0x28(%edi)
+  802daa:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802db0:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802db3:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802db9:	89 57 30             	mov    %edx,0x30(%edi)
+  802dbc:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802dc2:	89 57 34             	mov    %edx,0x34(%edi)
+  802dc5:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802dcb:	89 57 38             	mov    %edx,0x38(%edi)
+  802dce:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802dd4:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802dd7:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802ddd:	89 16                	mov    %edx,(%esi)
+  802ddf:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802de5:	89 56 04             	mov    %edx,0x4(%esi)
+  802de8:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802dee:	89 56 08             	mov    %edx,0x8(%esi)
+  802df1:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802df7:	89 56 0c             	mov    %edx,0xc(%esi)
+  802dfa:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802e00:	89 56 10             	mov    %edx,0x10(%esi)
+  802e03:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802e09:	89 56 14             	mov    %edx,0x14(%esi)
+  802e0c:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802e12:	89 56 18             	mov    %edx,0x18(%esi)
+  802e15:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802e1b:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802e1e:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802e24:	89 56 20             	mov    %edx,0x20(%esi)
+  802e27:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802e2d:	89 56 24             	mov    %edx,0x24(%esi)
+  802e30:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802e36:	89 56 28             	mov    %edx,0x28(%esi)
+  802e39:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802e3f:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802e42:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802e48:	89 56 30             	mov    %edx,0x30(%esi)
+  802e4b:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802e51:	89 56 34             	mov    %edx,0x34(%esi)
+  802e54:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802e5a:	89 56 38             	mov    %edx,0x38(%esi)
+  802e5d:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802e63:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802e66:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802e6c:	89 13                	mov    %edx,(%ebx)
+  802e6e:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802e74:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e77:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802e7d:	89 53 08             	mov    %edx,0x8(%ebx)
+  802e80:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802e86:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802e89:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802e8f:	89 53 10             	mov    %edx,0x10(%ebx)
+  802e92:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802e98:	89 53 14             	mov    %edx,0x14(%ebx)
+  802e9b:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802ea1:	89 53 18             	mov    %edx,0x18(%ebx)
+  802ea4:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802eaa:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802ead:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802eb3:	89 53 20             	mov    %edx,0x20(%ebx)
+  802eb6:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802ebc:	89 53 24             	mov    %edx,0x24(%ebx)
+  802ebf:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802ec5:	89 53 28             	mov    %edx,0x28(%ebx)
+  802ec8:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802ece:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802ed1:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802ed7:	89 53 30             	mov    %edx,0x30(%ebx)
+  802eda:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802ee0:	89 53 34             	mov    %edx,0x34(%ebx)
+  802ee3:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802ee9:	89 53 38             	mov    %edx,0x38(%ebx)
+  802eec:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802ef2:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802ef5:	83 c4 0c             	add    $0xc,%esp
+  802ef8:	5b                   	pop    %ebx
+  802ef9:	5e                   	pop    %esi
+  802efa:	5f                   	pop    %edi
+  802efb:	5d                   	pop    %ebp
+  802efc:	c3                   	ret
+
+00802efd <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802efd:	55                   	push   %ebp
+  802efe:	89 e5                	mov    %esp,%ebp
+  802f00:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f06:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802f0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f0e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802f13:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f16:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802f1b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802f20:	e8 46 f4 ff ff       	call   80236b <nsipc>
+}
+  802f25:	c9                   	leave
+  802f26:	c3                   	ret
+
+00802f27 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802f27:	55                   	push   %ebp
+  802f28:	89 e5                	mov    %esp,%ebp
+  802f2a:	56                   	push   %esi
+  802f2b:	53                   	push   %ebx
+  802f2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802f2f:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802f35:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f38:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802f3d:	b8 10 00 00 00       	mov    $0x10,%eax
+  802f42:	e8 24 f4 ff ff       	call   80236b <nsipc>
+  802f47:	89 c3                	mov    %eax,%ebx
+  802f49:	85 c0                	test   %eax,%eax
+  802f4b:	7e 1f                	jle    802f6c <nsipc_evwait+0x45>
+		assert(r <= max);
+  802f4d:	39 c6                	cmp    %eax,%esi
+  802f4f:	7c 24                	jl     802f75 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802f51:	83 ec 04             	sub    $0x4,%esp
+  802f54:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802f5b:	50                   	push   %eax
+  802f5c:	68 00 80 80 00       	push   $0x808000
+  802f61:	ff 75 08             	push   0x8(%ebp)
+  802f64:	e8 87 dd ff ff       	call   800cf0 <memmove>
+  802f69:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802f6c:	89 d8                	mov    %ebx,%eax
+  802f6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f71:	5b                   	pop    %ebx
+  802f72:	5e                   	pop    %esi
+  802f73:	5d                   	pop    %ebp
+  802f74:	c3                   	ret
+		assert(r <= max);
+  802f75:	68 56 44 80 00       	push   $0x804456
+  802f7a:	68 29 44 80 00       	push   $0x804429
+  802f7f:	68 6a 01 00 00       	push   $0x16a
+  802f84:	68 3e 44 80 00       	push   $0x80443e
+  802f89:	e8 e0 d3 ff ff       	call   80036e <_panic>
+
+00802f8e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f8e:	55                   	push   %ebp
+  802f8f:	89 e5                	mov    %esp,%ebp
+  802f91:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f97:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802f9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f9f:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802fa4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fa7:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802fac:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fb1:	e8 b5 f3 ff ff       	call   80236b <nsipc>
+}
+  802fb6:	c9                   	leave
+  802fb7:	c3                   	ret
+
+00802fb8 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802fb8:	55                   	push   %ebp
+  802fb9:	89 e5                	mov    %esp,%ebp
+  802fbb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802fbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc1:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802fc6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802fcb:	e8 9b f3 ff ff       	call   80236b <nsipc>
+}
+  802fd0:	c9                   	leave
+  802fd1:	c3                   	ret
+
+00802fd2 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802fd2:	55                   	push   %ebp
+  802fd3:	89 e5                	mov    %esp,%ebp
+  802fd5:	53                   	push   %ebx
+  802fd6:	83 ec 04             	sub    $0x4,%esp
+  802fd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802fdc:	b8 12 00 00 00       	mov    $0x12,%eax
+  802fe1:	e8 85 f3 ff ff       	call   80236b <nsipc>
+  802fe6:	85 c0                	test   %eax,%eax
+  802fe8:	78 50                	js     80303a <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802fea:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802ff0:	89 13                	mov    %edx,(%ebx)
+  802ff2:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802ff8:	89 53 04             	mov    %edx,0x4(%ebx)
+  802ffb:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803001:	89 53 08             	mov    %edx,0x8(%ebx)
+  803004:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80300a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80300d:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803013:	89 53 10             	mov    %edx,0x10(%ebx)
+  803016:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80301c:	89 53 14             	mov    %edx,0x14(%ebx)
+  80301f:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803025:	89 53 18             	mov    %edx,0x18(%ebx)
+  803028:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80302e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803031:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803037:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80303a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80303d:	c9                   	leave
+  80303e:	c3                   	ret
+
+0080303f <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80303f:	55                   	push   %ebp
+  803040:	89 e5                	mov    %esp,%ebp
+  803042:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803045:	6a 03                	push   $0x3
+  803047:	e8 bf 0c 00 00       	call   803d0b <ipc_find_env>
+  80304c:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  803051:	8b 45 08             	mov    0x8(%ebp),%eax
+  803054:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803059:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80305e:	e8 08 f3 ff ff       	call   80236b <nsipc>
+  803063:	83 c4 10             	add    $0x10,%esp
+  803066:	85 c0                	test   %eax,%eax
+  803068:	78 0a                	js     803074 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80306a:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  80306f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803074:	c9                   	leave
+  803075:	c3                   	ret
+
+00803076 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803076:	55                   	push   %ebp
+  803077:	89 e5                	mov    %esp,%ebp
+  803079:	57                   	push   %edi
+  80307a:	56                   	push   %esi
+  80307b:	53                   	push   %ebx
+  80307c:	83 ec 1c             	sub    $0x1c,%esp
+  80307f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803082:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803085:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80308a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80308f:	89 e0                	mov    %esp,%eax
+  803091:	89 f2                	mov    %esi,%edx
+  803093:	29 c2                	sub    %eax,%edx
+  803095:	89 d0                	mov    %edx,%eax
+  803097:	c1 e8 0f             	shr    $0xf,%eax
+  80309a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8030a0:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8030a3:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  8030aa:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8030ad:	83 ec 0c             	sub    $0xc,%esp
+  8030b0:	ff 75 e0             	push   -0x20(%ebp)
+  8030b3:	e8 92 0c 00 00       	call   803d4a <pageref>
+  8030b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030bb:	83 c4 04             	add    $0x4,%esp
+  8030be:	ff 75 dc             	push   -0x24(%ebp)
+  8030c1:	e8 84 0c 00 00       	call   803d4a <pageref>
+  8030c6:	89 e2                	mov    %esp,%edx
+  8030c8:	89 f1                	mov    %esi,%ecx
+  8030ca:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8030cc:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8030cf:	89 ca                	mov    %ecx,%edx
+  8030d1:	c1 ea 0f             	shr    $0xf,%edx
+  8030d4:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8030da:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8030dd:	8b 14 95 40 67 80 00 	mov    0x806740(,%edx,4),%edx
+  8030e4:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8030e7:	39 d7                	cmp    %edx,%edi
+  8030e9:	74 40                	je     80312b <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8030eb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030ee:	75 9f                	jne    80308f <_pipeisclosed+0x19>
+  8030f0:	89 e2                	mov    %esp,%edx
+  8030f2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8030f7:	29 d0                	sub    %edx,%eax
+  8030f9:	89 c2                	mov    %eax,%edx
+  8030fb:	c1 ea 0f             	shr    $0xf,%edx
+  8030fe:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803103:	b8 00 00 00 00       	mov    $0x0,%eax
+  803108:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80310b:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803112:	8b 40 58             	mov    0x58(%eax),%eax
+  803115:	6a 01                	push   $0x1
+  803117:	50                   	push   %eax
+  803118:	57                   	push   %edi
+  803119:	68 5f 44 80 00       	push   $0x80445f
+  80311e:	e8 26 d3 ff ff       	call   800449 <cprintf>
+  803123:	83 c4 10             	add    $0x10,%esp
+  803126:	e9 5f ff ff ff       	jmp    80308a <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80312b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80312e:	0f 94 c0             	sete   %al
+  803131:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803137:	5b                   	pop    %ebx
+  803138:	5e                   	pop    %esi
+  803139:	5f                   	pop    %edi
+  80313a:	5d                   	pop    %ebp
+  80313b:	c3                   	ret
+
+0080313c <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80313c:	55                   	push   %ebp
+  80313d:	89 e5                	mov    %esp,%ebp
+  80313f:	53                   	push   %ebx
+  803140:	83 ec 0c             	sub    $0xc,%esp
+  803143:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803146:	53                   	push   %ebx
+  803147:	6a 00                	push   $0x0
+  803149:	e8 ab de ff ff       	call   800ff9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80314e:	89 1c 24             	mov    %ebx,(%esp)
+  803151:	e8 e0 e3 ff ff       	call   801536 <fd2data>
+  803156:	83 c4 08             	add    $0x8,%esp
+  803159:	50                   	push   %eax
+  80315a:	6a 00                	push   $0x0
+  80315c:	e8 98 de ff ff       	call   800ff9 <sys_page_unmap>
+}
+  803161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803164:	c9                   	leave
+  803165:	c3                   	ret
+
+00803166 <devpipe_read>:
+{
+  803166:	55                   	push   %ebp
+  803167:	89 e5                	mov    %esp,%ebp
+  803169:	57                   	push   %edi
+  80316a:	56                   	push   %esi
+  80316b:	53                   	push   %ebx
+  80316c:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80316f:	ff 75 08             	push   0x8(%ebp)
+  803172:	e8 bf e3 ff ff       	call   801536 <fd2data>
+  803177:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803179:	8b 70 04             	mov    0x4(%eax),%esi
+  80317c:	8b 00                	mov    (%eax),%eax
+  80317e:	83 c4 10             	add    $0x10,%esp
+  803181:	39 f0                	cmp    %esi,%eax
+  803183:	75 36                	jne    8031bb <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803185:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803188:	89 da                	mov    %ebx,%edx
+  80318a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318d:	e8 e4 fe ff ff       	call   803076 <_pipeisclosed>
+  803192:	85 c0                	test   %eax,%eax
+  803194:	0f 85 d4 00 00 00    	jne    80326e <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80319a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80319f:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8031a3:	83 ec 04             	sub    $0x4,%esp
+  8031a6:	6a ff                	push   $0xffffffff
+  8031a8:	56                   	push   %esi
+  8031a9:	57                   	push   %edi
+  8031aa:	e8 c3 e1 ff ff       	call   801372 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8031af:	8b 73 04             	mov    0x4(%ebx),%esi
+  8031b2:	8b 03                	mov    (%ebx),%eax
+  8031b4:	83 c4 10             	add    $0x10,%esp
+  8031b7:	39 c6                	cmp    %eax,%esi
+  8031b9:	74 cd                	je     803188 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031bb:	8b 73 04             	mov    0x4(%ebx),%esi
+  8031be:	8b 03                	mov    (%ebx),%eax
+  8031c0:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8031c6:	29 c6                	sub    %eax,%esi
+  8031c8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031cd:	f7 e6                	mul    %esi
+  8031cf:	c1 ea 0c             	shr    $0xc,%edx
+  8031d2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031d8:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8031da:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031dd:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8031e1:	8b 0b                	mov    (%ebx),%ecx
+  8031e3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031e8:	f7 e1                	mul    %ecx
+  8031ea:	c1 ea 0b             	shr    $0xb,%edx
+  8031ed:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8031f3:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8031f5:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8031fa:	29 cf                	sub    %ecx,%edi
+  8031fc:	39 f7                	cmp    %esi,%edi
+  8031fe:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803201:	83 ec 04             	sub    $0x4,%esp
+  803204:	57                   	push   %edi
+  803205:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803209:	50                   	push   %eax
+  80320a:	ff 75 0c             	push   0xc(%ebp)
+  80320d:	e8 de da ff ff       	call   800cf0 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803212:	83 c4 0c             	add    $0xc,%esp
+  803215:	89 f0                	mov    %esi,%eax
+  803217:	29 f8                	sub    %edi,%eax
+  803219:	50                   	push   %eax
+  80321a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80321d:	50                   	push   %eax
+  80321e:	89 f8                	mov    %edi,%eax
+  803220:	03 45 0c             	add    0xc(%ebp),%eax
+  803223:	50                   	push   %eax
+  803224:	e8 c7 da ff ff       	call   800cf0 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803229:	8b 0b                	mov    (%ebx),%ecx
+  80322b:	01 f1                	add    %esi,%ecx
+  80322d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803232:	f7 e1                	mul    %ecx
+  803234:	c1 ea 0c             	shr    $0xc,%edx
+  803237:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80323d:	29 c1                	sub    %eax,%ecx
+  80323f:	89 0b                	mov    %ecx,(%ebx)
+  803241:	b8 00 00 00 00       	mov    $0x0,%eax
+  803246:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80324a:	83 c4 10             	add    $0x10,%esp
+  80324d:	85 c0                	test   %eax,%eax
+  80324f:	75 0a                	jne    80325b <devpipe_read+0xf5>
+	return n;
+  803251:	89 f0                	mov    %esi,%eax
+}
+  803253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803256:	5b                   	pop    %ebx
+  803257:	5e                   	pop    %esi
+  803258:	5f                   	pop    %edi
+  803259:	5d                   	pop    %ebp
+  80325a:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80325b:	83 ec 08             	sub    $0x8,%esp
+  80325e:	68 00 04 00 00       	push   $0x400
+  803263:	53                   	push   %ebx
+  803264:	e8 2b e1 ff ff       	call   801394 <sys_futex_wake>
+  803269:	83 c4 10             	add    $0x10,%esp
+  80326c:	eb e3                	jmp    803251 <devpipe_read+0xeb>
+			return 0;
+  80326e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803273:	eb de                	jmp    803253 <devpipe_read+0xed>
+
+00803275 <devpipe_write>:
+{
+  803275:	55                   	push   %ebp
+  803276:	89 e5                	mov    %esp,%ebp
+  803278:	57                   	push   %edi
+  803279:	56                   	push   %esi
+  80327a:	53                   	push   %ebx
+  80327b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80327e:	ff 75 08             	push   0x8(%ebp)
+  803281:	e8 b0 e2 ff ff       	call   801536 <fd2data>
+  803286:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803288:	83 c4 10             	add    $0x10,%esp
+  80328b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803292:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803297:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80329b:	0f 84 43 01 00 00    	je     8033e4 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032a1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8032a4:	8b 06                	mov    (%esi),%eax
+  8032a6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8032ac:	29 c1                	sub    %eax,%ecx
+  8032ae:	89 c8                	mov    %ecx,%eax
+  8032b0:	f7 e7                	mul    %edi
+  8032b2:	c1 ea 0c             	shr    $0xc,%edx
+  8032b5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032bb:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8032bd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8032c3:	75 52                	jne    803317 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8032c5:	89 f2                	mov    %esi,%edx
+  8032c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ca:	e8 a7 fd ff ff       	call   803076 <_pipeisclosed>
+  8032cf:	85 c0                	test   %eax,%eax
+  8032d1:	0f 85 28 01 00 00    	jne    8033ff <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8032d7:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032d9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8032dc:	8b 06                	mov    (%esi),%eax
+  8032de:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8032e4:	29 c1                	sub    %eax,%ecx
+  8032e6:	89 c8                	mov    %ecx,%eax
+  8032e8:	f7 e7                	mul    %edi
+  8032ea:	c1 ea 0c             	shr    $0xc,%edx
+  8032ed:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032f3:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8032f5:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8032fb:	75 a4                	jne    8032a1 <devpipe_write+0x2c>
+  8032fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  803302:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803306:	83 ec 04             	sub    $0x4,%esp
+  803309:	6a ff                	push   $0xffffffff
+  80330b:	53                   	push   %ebx
+  80330c:	56                   	push   %esi
+  80330d:	e8 60 e0 ff ff       	call   801372 <sys_futex_wait>
+}
+  803312:	83 c4 10             	add    $0x10,%esp
+  803315:	eb 8a                	jmp    8032a1 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803317:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80331a:	8b 06                	mov    (%esi),%eax
+  80331c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803322:	29 c1                	sub    %eax,%ecx
+  803324:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803329:	f7 e1                	mul    %ecx
+  80332b:	c1 ea 0c             	shr    $0xc,%edx
+  80332e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803334:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803336:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80333b:	89 d8                	mov    %ebx,%eax
+  80333d:	29 c8                	sub    %ecx,%eax
+  80333f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803342:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803345:	29 ca                	sub    %ecx,%edx
+  803347:	39 d0                	cmp    %edx,%eax
+  803349:	0f 46 d0             	cmovbe %eax,%edx
+  80334c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80334f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803352:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803357:	f7 e1                	mul    %ecx
+  803359:	c1 ea 0b             	shr    $0xb,%edx
+  80335c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803362:	89 ca                	mov    %ecx,%edx
+  803364:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803366:	29 d3                	sub    %edx,%ebx
+  803368:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80336b:	39 c3                	cmp    %eax,%ebx
+  80336d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803370:	83 ec 04             	sub    $0x4,%esp
+  803373:	53                   	push   %ebx
+  803374:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803377:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80337a:	51                   	push   %ecx
+  80337b:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80337f:	50                   	push   %eax
+  803380:	e8 6b d9 ff ff       	call   800cf0 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803385:	83 c4 0c             	add    $0xc,%esp
+  803388:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80338b:	29 d8                	sub    %ebx,%eax
+  80338d:	50                   	push   %eax
+  80338e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803391:	01 cb                	add    %ecx,%ebx
+  803393:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803396:	53                   	push   %ebx
+  803397:	8d 46 10             	lea    0x10(%esi),%eax
+  80339a:	50                   	push   %eax
+  80339b:	e8 50 d9 ff ff       	call   800cf0 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8033a0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8033a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8033a6:	01 c1                	add    %eax,%ecx
+  8033a8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8033ad:	f7 e1                	mul    %ecx
+  8033af:	c1 ea 0c             	shr    $0xc,%edx
+  8033b2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8033b8:	89 ca                	mov    %ecx,%edx
+  8033ba:	29 c2                	sub    %eax,%edx
+  8033bc:	89 56 04             	mov    %edx,0x4(%esi)
+  8033bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c4:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8033c8:	83 c4 10             	add    $0x10,%esp
+  8033cb:	85 c0                	test   %eax,%eax
+  8033cd:	75 1a                	jne    8033e9 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8033cf:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8033d2:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8033d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033d8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8033db:	0f 82 c0 fe ff ff    	jb     8032a1 <devpipe_write+0x2c>
+  8033e1:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8033e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033e7:	eb 1b                	jmp    803404 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8033e9:	83 ec 08             	sub    $0x8,%esp
+  8033ec:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8033f1:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8033f4:	50                   	push   %eax
+  8033f5:	e8 9a df ff ff       	call   801394 <sys_futex_wake>
+  8033fa:	83 c4 10             	add    $0x10,%esp
+  8033fd:	eb d0                	jmp    8033cf <devpipe_write+0x15a>
+				return 0;
+  8033ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803404:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803407:	5b                   	pop    %ebx
+  803408:	5e                   	pop    %esi
+  803409:	5f                   	pop    %edi
+  80340a:	5d                   	pop    %ebp
+  80340b:	c3                   	ret
+
+0080340c <devpipe_stat>:
+{
+  80340c:	55                   	push   %ebp
+  80340d:	89 e5                	mov    %esp,%ebp
+  80340f:	56                   	push   %esi
+  803410:	53                   	push   %ebx
+  803411:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803414:	83 ec 0c             	sub    $0xc,%esp
+  803417:	ff 75 08             	push   0x8(%ebp)
+  80341a:	e8 17 e1 ff ff       	call   801536 <fd2data>
+  80341f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803421:	83 c4 08             	add    $0x8,%esp
+  803424:	68 72 44 80 00       	push   $0x804472
+  803429:	53                   	push   %ebx
+  80342a:	e8 11 d7 ff ff       	call   800b40 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80342f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803432:	8b 06                	mov    (%esi),%eax
+  803434:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80343a:	29 c1                	sub    %eax,%ecx
+  80343c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803441:	89 c8                	mov    %ecx,%eax
+  803443:	f7 e2                	mul    %edx
+  803445:	c1 ea 0c             	shr    $0xc,%edx
+  803448:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80344e:	29 d1                	sub    %edx,%ecx
+  803450:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803456:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80345d:	00 00 00 
+	stat->st_dev = &devpipe;
+  803460:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803467:	50 80 00 
+}
+  80346a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803472:	5b                   	pop    %ebx
+  803473:	5e                   	pop    %esi
+  803474:	5d                   	pop    %ebp
+  803475:	c3                   	ret
+
+00803476 <devpipe_poll>:
+{
+  803476:	55                   	push   %ebp
+  803477:	89 e5                	mov    %esp,%ebp
+  803479:	57                   	push   %edi
+  80347a:	56                   	push   %esi
+  80347b:	53                   	push   %ebx
+  80347c:	83 ec 18             	sub    $0x18,%esp
+  80347f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803482:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803485:	57                   	push   %edi
+  803486:	e8 ab e0 ff ff       	call   801536 <fd2data>
+  80348b:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80348d:	83 c4 10             	add    $0x10,%esp
+  803490:	89 f3                	mov    %esi,%ebx
+  803492:	83 e3 01             	and    $0x1,%ebx
+  803495:	75 27                	jne    8034be <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803497:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80349d:	75 48                	jne    8034e7 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80349f:	89 ca                	mov    %ecx,%edx
+  8034a1:	89 f8                	mov    %edi,%eax
+  8034a3:	e8 ce fb ff ff       	call   803076 <_pipeisclosed>
+  8034a8:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8034aa:	89 d8                	mov    %ebx,%eax
+  8034ac:	83 c8 10             	or     $0x10,%eax
+  8034af:	85 d2                	test   %edx,%edx
+  8034b1:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8034b4:	89 d8                	mov    %ebx,%eax
+  8034b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034b9:	5b                   	pop    %ebx
+  8034ba:	5e                   	pop    %esi
+  8034bb:	5f                   	pop    %edi
+  8034bc:	5d                   	pop    %ebp
+  8034bd:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8034be:	8b 58 04             	mov    0x4(%eax),%ebx
+  8034c1:	8b 00                	mov    (%eax),%eax
+  8034c3:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8034c9:	29 c3                	sub    %eax,%ebx
+  8034cb:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8034d0:	89 d8                	mov    %ebx,%eax
+  8034d2:	f7 e2                	mul    %edx
+  8034d4:	c1 ea 0c             	shr    $0xc,%edx
+  8034d7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8034dd:	39 d3                	cmp    %edx,%ebx
+  8034df:	0f 95 c3             	setne  %bl
+  8034e2:	0f b6 db             	movzbl %bl,%ebx
+  8034e5:	eb b0                	jmp    803497 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8034e7:	8b 71 04             	mov    0x4(%ecx),%esi
+  8034ea:	8b 01                	mov    (%ecx),%eax
+  8034ec:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8034f2:	29 c6                	sub    %eax,%esi
+  8034f4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8034f9:	89 f0                	mov    %esi,%eax
+  8034fb:	f7 e2                	mul    %edx
+  8034fd:	c1 ea 0c             	shr    $0xc,%edx
+  803500:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803506:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803508:	89 d8                	mov    %ebx,%eax
+  80350a:	83 c8 04             	or     $0x4,%eax
+  80350d:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803513:	0f 42 d8             	cmovb  %eax,%ebx
+  803516:	eb 87                	jmp    80349f <devpipe_poll+0x29>
+
+00803518 <pipe>:
+{
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	56                   	push   %esi
+  80351c:	53                   	push   %ebx
+  80351d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803520:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803523:	50                   	push   %eax
+  803524:	e8 24 e0 ff ff       	call   80154d <fd_alloc>
+  803529:	89 c3                	mov    %eax,%ebx
+  80352b:	83 c4 10             	add    $0x10,%esp
+  80352e:	85 c0                	test   %eax,%eax
+  803530:	0f 88 23 01 00 00    	js     803659 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803536:	83 ec 04             	sub    $0x4,%esp
+  803539:	68 07 04 00 00       	push   $0x407
+  80353e:	ff 75 f4             	push   -0xc(%ebp)
+  803541:	6a 00                	push   $0x0
+  803543:	e8 2c da ff ff       	call   800f74 <sys_page_alloc>
+  803548:	89 c3                	mov    %eax,%ebx
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	0f 88 04 01 00 00    	js     803659 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803555:	83 ec 0c             	sub    $0xc,%esp
+  803558:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80355b:	50                   	push   %eax
+  80355c:	e8 ec df ff ff       	call   80154d <fd_alloc>
+  803561:	89 c3                	mov    %eax,%ebx
+  803563:	83 c4 10             	add    $0x10,%esp
+  803566:	85 c0                	test   %eax,%eax
+  803568:	0f 88 db 00 00 00    	js     803649 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80356e:	83 ec 04             	sub    $0x4,%esp
+  803571:	68 07 04 00 00       	push   $0x407
+  803576:	ff 75 f0             	push   -0x10(%ebp)
+  803579:	6a 00                	push   $0x0
+  80357b:	e8 f4 d9 ff ff       	call   800f74 <sys_page_alloc>
+  803580:	89 c3                	mov    %eax,%ebx
+  803582:	83 c4 10             	add    $0x10,%esp
+  803585:	85 c0                	test   %eax,%eax
+  803587:	0f 88 bc 00 00 00    	js     803649 <pipe+0x131>
+	va = fd2data(fd0);
+  80358d:	83 ec 0c             	sub    $0xc,%esp
+  803590:	ff 75 f4             	push   -0xc(%ebp)
+  803593:	e8 9e df ff ff       	call   801536 <fd2data>
+  803598:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80359a:	83 c4 0c             	add    $0xc,%esp
+  80359d:	68 07 04 00 00       	push   $0x407
+  8035a2:	50                   	push   %eax
+  8035a3:	6a 00                	push   $0x0
+  8035a5:	e8 ca d9 ff ff       	call   800f74 <sys_page_alloc>
+  8035aa:	89 c3                	mov    %eax,%ebx
+  8035ac:	83 c4 10             	add    $0x10,%esp
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	0f 88 82 00 00 00    	js     803639 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035b7:	83 ec 0c             	sub    $0xc,%esp
+  8035ba:	ff 75 f0             	push   -0x10(%ebp)
+  8035bd:	e8 74 df ff ff       	call   801536 <fd2data>
+  8035c2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8035c9:	50                   	push   %eax
+  8035ca:	6a 00                	push   $0x0
+  8035cc:	56                   	push   %esi
+  8035cd:	6a 00                	push   $0x0
+  8035cf:	e8 e3 d9 ff ff       	call   800fb7 <sys_page_map>
+  8035d4:	89 c3                	mov    %eax,%ebx
+  8035d6:	83 c4 20             	add    $0x20,%esp
+  8035d9:	85 c0                	test   %eax,%eax
+  8035db:	78 4e                	js     80362b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8035dd:	a1 60 50 80 00       	mov    0x805060,%eax
+  8035e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035e5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8035e7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035ea:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8035f1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8035f4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8035f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8035f9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803600:	83 ec 0c             	sub    $0xc,%esp
+  803603:	ff 75 f4             	push   -0xc(%ebp)
+  803606:	e8 1b df ff ff       	call   801526 <fd2num>
+  80360b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80360e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803610:	83 c4 04             	add    $0x4,%esp
+  803613:	ff 75 f0             	push   -0x10(%ebp)
+  803616:	e8 0b df ff ff       	call   801526 <fd2num>
+  80361b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80361e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803621:	83 c4 10             	add    $0x10,%esp
+  803624:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803629:	eb 2e                	jmp    803659 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80362b:	83 ec 08             	sub    $0x8,%esp
+  80362e:	56                   	push   %esi
+  80362f:	6a 00                	push   $0x0
+  803631:	e8 c3 d9 ff ff       	call   800ff9 <sys_page_unmap>
+  803636:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803639:	83 ec 08             	sub    $0x8,%esp
+  80363c:	ff 75 f0             	push   -0x10(%ebp)
+  80363f:	6a 00                	push   $0x0
+  803641:	e8 b3 d9 ff ff       	call   800ff9 <sys_page_unmap>
+  803646:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803649:	83 ec 08             	sub    $0x8,%esp
+  80364c:	ff 75 f4             	push   -0xc(%ebp)
+  80364f:	6a 00                	push   $0x0
+  803651:	e8 a3 d9 ff ff       	call   800ff9 <sys_page_unmap>
+  803656:	83 c4 10             	add    $0x10,%esp
+}
+  803659:	89 d8                	mov    %ebx,%eax
+  80365b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80365e:	5b                   	pop    %ebx
+  80365f:	5e                   	pop    %esi
+  803660:	5d                   	pop    %ebp
+  803661:	c3                   	ret
+
+00803662 <pipeisclosed>:
+{
+  803662:	55                   	push   %ebp
+  803663:	89 e5                	mov    %esp,%ebp
+  803665:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803668:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80366b:	50                   	push   %eax
+  80366c:	ff 75 08             	push   0x8(%ebp)
+  80366f:	e8 29 df ff ff       	call   80159d <fd_lookup>
+  803674:	83 c4 10             	add    $0x10,%esp
+  803677:	85 c0                	test   %eax,%eax
+  803679:	78 18                	js     803693 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80367b:	83 ec 0c             	sub    $0xc,%esp
+  80367e:	ff 75 f4             	push   -0xc(%ebp)
+  803681:	e8 b0 de ff ff       	call   801536 <fd2data>
+  803686:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803688:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80368b:	e8 e6 f9 ff ff       	call   803076 <_pipeisclosed>
+  803690:	83 c4 10             	add    $0x10,%esp
+}
+  803693:	c9                   	leave
+  803694:	c3                   	ret
+
+00803695 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803695:	55                   	push   %ebp
+  803696:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803698:	8b 45 08             	mov    0x8(%ebp),%eax
+  80369b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8036a1:	5d                   	pop    %ebp
+  8036a2:	c3                   	ret
+
+008036a3 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8036a3:	55                   	push   %ebp
+  8036a4:	89 e5                	mov    %esp,%ebp
+  8036a6:	53                   	push   %ebx
+  8036a7:	83 ec 04             	sub    $0x4,%esp
+  8036aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8036ad:	8b 03                	mov    (%ebx),%eax
+  8036af:	85 c0                	test   %eax,%eax
+  8036b1:	75 05                	jne    8036b8 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8036b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036b6:	c9                   	leave
+  8036b7:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8036b8:	83 ec 08             	sub    $0x8,%esp
+  8036bb:	50                   	push   %eax
+  8036bc:	8d 43 04             	lea    0x4(%ebx),%eax
+  8036bf:	50                   	push   %eax
+  8036c0:	e8 84 db ff ff       	call   801249 <sys_page_batch>
+	pb->pb_n = 0;
+  8036c5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8036cb:	83 c4 10             	add    $0x10,%esp
+  8036ce:	eb e3                	jmp    8036b3 <pgbatch_flush+0x10>
+
+008036d0 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8036d0:	55                   	push   %ebp
+  8036d1:	89 e5                	mov    %esp,%ebp
+  8036d3:	56                   	push   %esi
+  8036d4:	53                   	push   %ebx
+  8036d5:	89 c3                	mov    %eax,%ebx
+  8036d7:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8036d9:	83 38 20             	cmpl   $0x20,(%eax)
+  8036dc:	74 2c                	je     80370a <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8036de:	8b 03                	mov    (%ebx),%eax
+  8036e0:	8d 50 01             	lea    0x1(%eax),%edx
+  8036e3:	89 13                	mov    %edx,(%ebx)
+  8036e5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8036e8:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8036ec:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8036ee:	83 ec 04             	sub    $0x4,%esp
+  8036f1:	6a 18                	push   $0x18
+  8036f3:	6a 00                	push   $0x0
+  8036f5:	50                   	push   %eax
+  8036f6:	e8 c0 d5 ff ff       	call   800cbb <memset>
+	return 0;
+  8036fb:	83 c4 10             	add    $0x10,%esp
+  8036fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803703:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803706:	5b                   	pop    %ebx
+  803707:	5e                   	pop    %esi
+  803708:	5d                   	pop    %ebp
+  803709:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80370a:	83 ec 0c             	sub    $0xc,%esp
+  80370d:	50                   	push   %eax
+  80370e:	e8 90 ff ff ff       	call   8036a3 <pgbatch_flush>
+  803713:	83 c4 10             	add    $0x10,%esp
+  803716:	85 c0                	test   %eax,%eax
+  803718:	79 c4                	jns    8036de <pgbatch_slot+0xe>
+  80371a:	eb e7                	jmp    803703 <pgbatch_slot+0x33>
+
+0080371c <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80371c:	55                   	push   %ebp
+  80371d:	89 e5                	mov    %esp,%ebp
+  80371f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803722:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803725:	8b 45 08             	mov    0x8(%ebp),%eax
+  803728:	e8 a3 ff ff ff       	call   8036d0 <pgbatch_slot>
+  80372d:	85 c0                	test   %eax,%eax
+  80372f:	78 20                	js     803751 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803731:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803734:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80373a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80373d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803740:	8b 55 10             	mov    0x10(%ebp),%edx
+  803743:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803746:	8b 55 14             	mov    0x14(%ebp),%edx
+  803749:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80374c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803751:	c9                   	leave
+  803752:	c3                   	ret
+
+00803753 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803753:	55                   	push   %ebp
+  803754:	89 e5                	mov    %esp,%ebp
+  803756:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803759:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80375c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80375f:	e8 6c ff ff ff       	call   8036d0 <pgbatch_slot>
+  803764:	85 c0                	test   %eax,%eax
+  803766:	78 2c                	js     803794 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803768:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80376b:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803771:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803774:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803777:	8b 55 10             	mov    0x10(%ebp),%edx
+  80377a:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80377d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803780:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803783:	8b 55 18             	mov    0x18(%ebp),%edx
+  803786:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803789:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80378c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80378f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803794:	c9                   	leave
+  803795:	c3                   	ret
+
+00803796 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803796:	55                   	push   %ebp
+  803797:	89 e5                	mov    %esp,%ebp
+  803799:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80379c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80379f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a2:	e8 29 ff ff ff       	call   8036d0 <pgbatch_slot>
+  8037a7:	85 c0                	test   %eax,%eax
+  8037a9:	78 1a                	js     8037c5 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8037ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037ae:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8037b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037b7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8037ba:	8b 55 10             	mov    0x10(%ebp),%edx
+  8037bd:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8037c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037c5:	c9                   	leave
+  8037c6:	c3                   	ret
+
+008037c7 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8037c7:	55                   	push   %ebp
+  8037c8:	89 e5                	mov    %esp,%ebp
+  8037ca:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8037cd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8037d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d3:	e8 f8 fe ff ff       	call   8036d0 <pgbatch_slot>
+  8037d8:	85 c0                	test   %eax,%eax
+  8037da:	78 20                	js     8037fc <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8037dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037df:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8037e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037e8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8037eb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8037ee:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8037f1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8037f4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8037f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037fc:	c9                   	leave
+  8037fd:	c3                   	ret
+
+008037fe <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8037fe:	55                   	push   %ebp
+  8037ff:	89 e5                	mov    %esp,%ebp
+  803801:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803804:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80380a:	e8 c1 fe ff ff       	call   8036d0 <pgbatch_slot>
+  80380f:	85 c0                	test   %eax,%eax
+  803811:	78 26                	js     803839 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803813:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803816:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80381c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80381f:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803822:	8b 55 10             	mov    0x10(%ebp),%edx
+  803825:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803828:	8b 55 14             	mov    0x14(%ebp),%edx
+  80382b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80382e:	8b 55 18             	mov    0x18(%ebp),%edx
+  803831:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803834:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803839:	c9                   	leave
+  80383a:	c3                   	ret
+
+0080383b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80383b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803840:	c3                   	ret
+
+00803841 <devcons_poll>:
+{
+  803841:	55                   	push   %ebp
+  803842:	89 e5                	mov    %esp,%ebp
+  803844:	53                   	push   %ebx
+  803845:	83 ec 04             	sub    $0x4,%esp
+  803848:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80384b:	89 da                	mov    %ebx,%edx
+  80384d:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803850:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803857:	74 0c                	je     803865 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803859:	89 d8                	mov    %ebx,%eax
+  80385b:	83 e0 01             	and    $0x1,%eax
+  80385e:	09 d0                	or     %edx,%eax
+}
+  803860:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803863:	c9                   	leave
+  803864:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803865:	e8 6c d6 ff ff       	call   800ed6 <sys_cgetc>
+  80386a:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80386f:	89 da                	mov    %ebx,%edx
+  803871:	83 e2 04             	and    $0x4,%edx
+  803874:	85 c0                	test   %eax,%eax
+  803876:	74 e6                	je     80385e <devcons_poll+0x1d>
+  803878:	eb df                	jmp    803859 <devcons_poll+0x18>
+
+0080387a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80387a:	55                   	push   %ebp
+  80387b:	89 e5                	mov    %esp,%ebp
+  80387d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803880:	68 7e 44 80 00       	push   $0x80447e
+  803885:	ff 75 0c             	push   0xc(%ebp)
+  803888:	e8 b3 d2 ff ff       	call   800b40 <strcpy>
+	return 0;
+}
+  80388d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803892:	c9                   	leave
+  803893:	c3                   	ret
+
+00803894 <devcons_write>:
+{
+  803894:	55                   	push   %ebp
+  803895:	89 e5                	mov    %esp,%ebp
+  803897:	57                   	push   %edi
+  803898:	56                   	push   %esi
+  803899:	53                   	push   %ebx
+  80389a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8038a0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8038a3:	85 ff                	test   %edi,%edi
+  8038a5:	74 51                	je     8038f8 <devcons_write+0x64>
+  8038a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ac:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8038b1:	89 fb                	mov    %edi,%ebx
+  8038b3:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8038b5:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8038ba:	39 d3                	cmp    %edx,%ebx
+  8038bc:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8038bf:	83 ec 04             	sub    $0x4,%esp
+  8038c2:	53                   	push   %ebx
+  8038c3:	03 45 0c             	add    0xc(%ebp),%eax
+  8038c6:	50                   	push   %eax
+  8038c7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8038cd:	50                   	push   %eax
+  8038ce:	e8 1d d4 ff ff       	call   800cf0 <memmove>
+		sys_cputs(buf, m);
+  8038d3:	83 c4 08             	add    $0x8,%esp
+  8038d6:	53                   	push   %ebx
+  8038d7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8038dd:	50                   	push   %eax
+  8038de:	e8 d5 d5 ff ff       	call   800eb8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8038e3:	01 de                	add    %ebx,%esi
+  8038e5:	89 f0                	mov    %esi,%eax
+  8038e7:	83 c4 10             	add    $0x10,%esp
+  8038ea:	39 fe                	cmp    %edi,%esi
+  8038ec:	72 c3                	jb     8038b1 <devcons_write+0x1d>
+}
+  8038ee:	89 f0                	mov    %esi,%eax
+  8038f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038f3:	5b                   	pop    %ebx
+  8038f4:	5e                   	pop    %esi
+  8038f5:	5f                   	pop    %edi
+  8038f6:	5d                   	pop    %ebp
+  8038f7:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8038f8:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8038fd:	eb ef                	jmp    8038ee <devcons_write+0x5a>
+
+008038ff <devcons_read>:
+{
+  8038ff:	55                   	push   %ebp
+  803900:	89 e5                	mov    %esp,%ebp
+  803902:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803905:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80390a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80390e:	74 36                	je     803946 <devcons_read+0x47>
+	c = cons_peek;
+  803910:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  803915:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  80391c:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80391f:	85 c0                	test   %eax,%eax
+  803921:	75 10                	jne    803933 <devcons_read+0x34>
+  803923:	e8 ae d5 ff ff       	call   800ed6 <sys_cgetc>
+  803928:	85 c0                	test   %eax,%eax
+  80392a:	75 07                	jne    803933 <devcons_read+0x34>
+		sys_yield();
+  80392c:	e8 24 d6 ff ff       	call   800f55 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803931:	eb f0                	jmp    803923 <devcons_read+0x24>
+	if (c < 0)
+  803933:	85 c0                	test   %eax,%eax
+  803935:	78 0f                	js     803946 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803937:	83 f8 04             	cmp    $0x4,%eax
+  80393a:	74 0c                	je     803948 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80393c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80393f:	88 02                	mov    %al,(%edx)
+	return 1;
+  803941:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803946:	c9                   	leave
+  803947:	c3                   	ret
+		return 0;
+  803948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394d:	eb f7                	jmp    803946 <devcons_read+0x47>
+
+0080394f <cputchar>:
+{
+  80394f:	55                   	push   %ebp
+  803950:	89 e5                	mov    %esp,%ebp
+  803952:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803955:	8b 45 08             	mov    0x8(%ebp),%eax
+  803958:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80395b:	6a 01                	push   $0x1
+  80395d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803960:	50                   	push   %eax
+  803961:	e8 52 d5 ff ff       	call   800eb8 <sys_cputs>
+}
+  803966:	83 c4 10             	add    $0x10,%esp
+  803969:	c9                   	leave
+  80396a:	c3                   	ret
+
+0080396b <getchar>:
+{
+  80396b:	55                   	push   %ebp
+  80396c:	89 e5                	mov    %esp,%ebp
+  80396e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803971:	6a 01                	push   $0x1
+  803973:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803976:	50                   	push   %eax
+  803977:	6a 00                	push   $0x0
+  803979:	e8 a3 de ff ff       	call   801821 <read>
+	if (r < 0)
+  80397e:	83 c4 10             	add    $0x10,%esp
+  803981:	85 c0                	test   %eax,%eax
+  803983:	78 06                	js     80398b <getchar+0x20>
+	if (r < 1)
+  803985:	74 06                	je     80398d <getchar+0x22>
+	return c;
+  803987:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80398b:	c9                   	leave
+  80398c:	c3                   	ret
+		return -E_EOF;
+  80398d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803992:	eb f7                	jmp    80398b <getchar+0x20>
+
+00803994 <iscons>:
+{
+  803994:	55                   	push   %ebp
+  803995:	89 e5                	mov    %esp,%ebp
+  803997:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80399a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80399d:	50                   	push   %eax
+  80399e:	ff 75 08             	push   0x8(%ebp)
+  8039a1:	e8 f7 db ff ff       	call   80159d <fd_lookup>
+  8039a6:	83 c4 10             	add    $0x10,%esp
+  8039a9:	85 c0                	test   %eax,%eax
+  8039ab:	78 11                	js     8039be <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8039ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039b0:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8039b6:	39 10                	cmp    %edx,(%eax)
+  8039b8:	0f 94 c0             	sete   %al
+  8039bb:	0f b6 c0             	movzbl %al,%eax
+}
+  8039be:	c9                   	leave
+  8039bf:	c3                   	ret
+
+008039c0 <opencons>:
+{
+  8039c0:	55                   	push   %ebp
+  8039c1:	89 e5                	mov    %esp,%ebp
+  8039c3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8039c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039c9:	50                   	push   %eax
+  8039ca:	e8 7e db ff ff       	call   80154d <fd_alloc>
+  8039cf:	83 c4 10             	add    $0x10,%esp
+  8039d2:	85 c0                	test   %eax,%eax
+  8039d4:	78 3a                	js     803a10 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8039d6:	83 ec 04             	sub    $0x4,%esp
+  8039d9:	68 07 04 00 00       	push   $0x407
+  8039de:	ff 75 f4             	push   -0xc(%ebp)
+  8039e1:	6a 00                	push   $0x0
+  8039e3:	e8 8c d5 ff ff       	call   800f74 <sys_page_alloc>
+  8039e8:	83 c4 10             	add    $0x10,%esp
+  8039eb:	85 c0                	test   %eax,%eax
+  8039ed:	78 21                	js     803a10 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8039ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039f2:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8039f8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8039fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039fd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803a04:	83 ec 0c             	sub    $0xc,%esp
+  803a07:	50                   	push   %eax
+  803a08:	e8 19 db ff ff       	call   801526 <fd2num>
+  803a0d:	83 c4 10             	add    $0x10,%esp
+}
+  803a10:	c9                   	leave
+  803a11:	c3                   	ret
+
+00803a12 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803a12:	55                   	push   %ebp
+  803a13:	89 e5                	mov    %esp,%ebp
+  803a15:	56                   	push   %esi
+  803a16:	53                   	push   %ebx
+  803a17:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803a20:	85 c0                	test   %eax,%eax
+  803a22:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803a27:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803a2a:	83 ec 0c             	sub    $0xc,%esp
+  803a2d:	50                   	push   %eax
+  803a2e:	e8 f1 d6 ff ff       	call   801124 <sys_ipc_recv>
+  803a33:	83 c4 10             	add    $0x10,%esp
+  803a36:	85 c0                	test   %eax,%eax
+  803a38:	0f 88 8b 00 00 00    	js     803ac9 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803a3e:	85 f6                	test   %esi,%esi
+  803a40:	74 2a                	je     803a6c <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803a42:	89 e2                	mov    %esp,%edx
+  803a44:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803a49:	29 d0                	sub    %edx,%eax
+  803a4b:	89 c2                	mov    %eax,%edx
+  803a4d:	c1 ea 0f             	shr    $0xf,%edx
+  803a50:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a5a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803a5d:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803a64:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803a6a:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803a6c:	85 db                	test   %ebx,%ebx
+  803a6e:	74 2a                	je     803a9a <ipc_recv+0x88>
+  803a70:	89 e2                	mov    %esp,%edx
+  803a72:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803a77:	29 d0                	sub    %edx,%eax
+  803a79:	89 c2                	mov    %eax,%edx
+  803a7b:	c1 ea 0f             	shr    $0xf,%edx
+  803a7e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a88:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803a8b:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803a92:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803a98:	89 03                	mov    %eax,(%ebx)
+  803a9a:	89 e2                	mov    %esp,%edx
+  803a9c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803aa1:	29 d0                	sub    %edx,%eax
+  803aa3:	89 c2                	mov    %eax,%edx
+  803aa5:	c1 ea 0f             	shr    $0xf,%edx
+  803aa8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803ab5:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803abc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803ac2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ac5:	5b                   	pop    %ebx
+  803ac6:	5e                   	pop    %esi
+  803ac7:	5d                   	pop    %ebp
+  803ac8:	c3                   	ret
+		if(from_env_store != NULL)
+  803ac9:	85 f6                	test   %esi,%esi
+  803acb:	74 06                	je     803ad3 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803acd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803ad3:	85 db                	test   %ebx,%ebx
+  803ad5:	74 eb                	je     803ac2 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803ad7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803add:	eb e3                	jmp    803ac2 <ipc_recv+0xb0>
+
+00803adf <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803adf:	55                   	push   %ebp
+  803ae0:	89 e5                	mov    %esp,%ebp
+  803ae2:	57                   	push   %edi
+  803ae3:	56                   	push   %esi
+  803ae4:	53                   	push   %ebx
+  803ae5:	83 ec 14             	sub    $0x14,%esp
+  803ae8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803aeb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803aee:	8b 75 14             	mov    0x14(%ebp),%esi
+  803af1:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803af4:	85 c0                	test   %eax,%eax
+  803af6:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803afb:	0f 44 c2             	cmove  %edx,%eax
+  803afe:	ff 75 10             	push   0x10(%ebp)
+  803b01:	50                   	push   %eax
+  803b02:	e8 7f d6 ff ff       	call   801186 <sys_ipc_recv_pages>
+  803b07:	83 c4 10             	add    $0x10,%esp
+  803b0a:	85 c0                	test   %eax,%eax
+  803b0c:	0f 88 ba 00 00 00    	js     803bcc <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803b12:	85 ff                	test   %edi,%edi
+  803b14:	74 2a                	je     803b40 <ipc_recv_pages+0x61>
+  803b16:	89 e2                	mov    %esp,%edx
+  803b18:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803b1d:	29 d0                	sub    %edx,%eax
+  803b1f:	89 c2                	mov    %eax,%edx
+  803b21:	c1 ea 0f             	shr    $0xf,%edx
+  803b24:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803b31:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803b38:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803b3e:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803b40:	85 f6                	test   %esi,%esi
+  803b42:	74 2a                	je     803b6e <ipc_recv_pages+0x8f>
+  803b44:	89 e2                	mov    %esp,%edx
+  803b46:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803b4b:	29 d0                	sub    %edx,%eax
+  803b4d:	89 c2                	mov    %eax,%edx
+  803b4f:	c1 ea 0f             	shr    $0xf,%edx
+  803b52:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b5c:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803b5f:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803b66:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803b6c:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803b6e:	85 db                	test   %ebx,%ebx
+  803b70:	74 2a                	je     803b9c <ipc_recv_pages+0xbd>
+  803b72:	89 e2                	mov    %esp,%edx
+  803b74:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803b79:	29 d0                	sub    %edx,%eax
+  803b7b:	89 c2                	mov    %eax,%edx
+  803b7d:	c1 ea 0f             	shr    $0xf,%edx
+  803b80:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803b85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8a:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803b8d:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803b94:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803b9a:	89 03                	mov    %eax,(%ebx)
+  803b9c:	89 e2                	mov    %esp,%edx
+  803b9e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803ba3:	29 d0                	sub    %edx,%eax
+  803ba5:	89 c2                	mov    %eax,%edx
+  803ba7:	c1 ea 0f             	shr    $0xf,%edx
+  803baa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803bb7:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803bbe:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bc7:	5b                   	pop    %ebx
+  803bc8:	5e                   	pop    %esi
+  803bc9:	5f                   	pop    %edi
+  803bca:	5d                   	pop    %ebp
+  803bcb:	c3                   	ret
+		if (from_env_store)
+  803bcc:	85 ff                	test   %edi,%edi
+  803bce:	74 06                	je     803bd6 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803bd0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803bd6:	85 f6                	test   %esi,%esi
+  803bd8:	74 06                	je     803be0 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803bda:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803be0:	85 db                	test   %ebx,%ebx
+  803be2:	74 e0                	je     803bc4 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803be4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803bea:	eb d8                	jmp    803bc4 <ipc_recv_pages+0xe5>
+
+00803bec <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803bec:	55                   	push   %ebp
+  803bed:	89 e5                	mov    %esp,%ebp
+  803bef:	57                   	push   %edi
+  803bf0:	56                   	push   %esi
+  803bf1:	53                   	push   %ebx
+  803bf2:	83 ec 1c             	sub    $0x1c,%esp
+  803bf5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803bf8:	8b 75 08             	mov    0x8(%ebp),%esi
+  803bfb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803c01:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803c05:	75 2b                	jne    803c32 <ipc_try_send_pages+0x46>
+  803c07:	89 e2                	mov    %esp,%edx
+  803c09:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803c0e:	29 d0                	sub    %edx,%eax
+  803c10:	89 c2                	mov    %eax,%edx
+  803c12:	c1 ea 0f             	shr    $0xf,%edx
+  803c15:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1f:	0f 42 c2             	cmovb  %edx,%eax
+  803c22:	8b 04 85 40 67 80 00 	mov    0x806740(,%eax,4),%eax
+  803c29:	8b 70 48             	mov    0x48(%eax),%esi
+  803c2c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803c32:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803c38:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803c3d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c40:	85 ff                	test   %edi,%edi
+  803c42:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803c47:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803c4a:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803c50:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803c56:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803c5c:	83 ec 0c             	sub    $0xc,%esp
+  803c5f:	ff 75 14             	push   0x14(%ebp)
+  803c62:	ff 75 18             	push   0x18(%ebp)
+  803c65:	57                   	push   %edi
+  803c66:	ff 75 0c             	push   0xc(%ebp)
+  803c69:	ff 75 08             	push   0x8(%ebp)
+  803c6c:	e8 f4 d4 ff ff       	call   801165 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803c71:	83 c4 20             	add    $0x20,%esp
+  803c74:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803c77:	75 21                	jne    803c9a <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803c79:	83 ec 04             	sub    $0x4,%esp
+  803c7c:	6a ff                	push   $0xffffffff
+  803c7e:	53                   	push   %ebx
+  803c7f:	ff 75 e4             	push   -0x1c(%ebp)
+  803c82:	e8 eb d6 ff ff       	call   801372 <sys_futex_wait>
+  803c87:	83 c4 10             	add    $0x10,%esp
+  803c8a:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803c8d:	74 c7                	je     803c56 <ipc_try_send_pages+0x6a>
+  803c8f:	85 c0                	test   %eax,%eax
+  803c91:	79 c3                	jns    803c56 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803c93:	e8 bd d2 ff ff       	call   800f55 <sys_yield>
+  803c98:	eb bc                	jmp    803c56 <ipc_try_send_pages+0x6a>
+	}
+}
+  803c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c9d:	5b                   	pop    %ebx
+  803c9e:	5e                   	pop    %esi
+  803c9f:	5f                   	pop    %edi
+  803ca0:	5d                   	pop    %ebp
+  803ca1:	c3                   	ret
+
+00803ca2 <ipc_send>:
+{
+  803ca2:	55                   	push   %ebp
+  803ca3:	89 e5                	mov    %esp,%ebp
+  803ca5:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803ca8:	ff 75 14             	push   0x14(%ebp)
+  803cab:	6a 01                	push   $0x1
+  803cad:	ff 75 10             	push   0x10(%ebp)
+  803cb0:	ff 75 0c             	push   0xc(%ebp)
+  803cb3:	ff 75 08             	push   0x8(%ebp)
+  803cb6:	e8 31 ff ff ff       	call   803bec <ipc_try_send_pages>
+  803cbb:	83 c4 20             	add    $0x20,%esp
+  803cbe:	85 c0                	test   %eax,%eax
+  803cc0:	78 02                	js     803cc4 <ipc_send+0x22>
+}
+  803cc2:	c9                   	leave
+  803cc3:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803cc4:	50                   	push   %eax
+  803cc5:	68 8a 44 80 00       	push   $0x80448a
+  803cca:	6a 3f                	push   $0x3f
+  803ccc:	68 9f 44 80 00       	push   $0x80449f
+  803cd1:	e8 98 c6 ff ff       	call   80036e <_panic>
+
+00803cd6 <ipc_send_pages>:
+{
+  803cd6:	55                   	push   %ebp
+  803cd7:	89 e5                	mov    %esp,%ebp
+  803cd9:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803cdc:	ff 75 18             	push   0x18(%ebp)
+  803cdf:	ff 75 14             	push   0x14(%ebp)
+  803ce2:	ff 75 10             	push   0x10(%ebp)
+  803ce5:	ff 75 0c             	push   0xc(%ebp)
+  803ce8:	ff 75 08             	push   0x8(%ebp)
+  803ceb:	e8 fc fe ff ff       	call   803bec <ipc_try_send_pages>
+  803cf0:	83 c4 20             	add    $0x20,%esp
+  803cf3:	85 c0                	test   %eax,%eax
+  803cf5:	78 02                	js     803cf9 <ipc_send_pages+0x23>
+}
+  803cf7:	c9                   	leave
+  803cf8:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803cf9:	50                   	push   %eax
+  803cfa:	68 a9 44 80 00       	push   $0x8044a9
+  803cff:	6a 64                	push   $0x64
+  803d01:	68 9f 44 80 00       	push   $0x80449f
+  803d06:	e8 63 c6 ff ff       	call   80036e <_panic>
+
+00803d0b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803d0b:	55                   	push   %ebp
+  803d0c:	89 e5                	mov    %esp,%ebp
+  803d0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803d11:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803d16:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803d1c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d22:	8b 52 50             	mov    0x50(%edx),%edx
+  803d25:	39 ca                	cmp    %ecx,%edx
+  803d27:	74 11                	je     803d3a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803d29:	83 c0 01             	add    $0x1,%eax
+  803d2c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803d31:	75 e3                	jne    803d16 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803d33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d38:	eb 0e                	jmp    803d48 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803d3a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803d40:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d45:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803d48:	5d                   	pop    %ebp
+  803d49:	c3                   	ret
+
+00803d4a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803d4a:	55                   	push   %ebp
+  803d4b:	89 e5                	mov    %esp,%ebp
+  803d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803d50:	89 c2                	mov    %eax,%edx
+  803d52:	c1 ea 16             	shr    $0x16,%edx
+  803d55:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803d61:	f6 c1 01             	test   $0x1,%cl
+  803d64:	74 1e                	je     803d84 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803d66:	c1 e8 0c             	shr    $0xc,%eax
+  803d69:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803d70:	a8 01                	test   $0x1,%al
+  803d72:	74 10                	je     803d84 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803d74:	c1 e8 0c             	shr    $0xc,%eax
+  803d77:	c1 e0 04             	shl    $0x4,%eax
+  803d7a:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803d81:	0f b7 d2             	movzwl %dx,%edx
+}
+  803d84:	89 d0                	mov    %edx,%eax
+  803d86:	5d                   	pop    %ebp
+  803d87:	c3                   	ret
+
+00803d88 <__udivdi3>:
+  803d88:	57                   	push   %edi
+  803d89:	56                   	push   %esi
+  803d8a:	53                   	push   %ebx
+  803d8b:	83 ec 20             	sub    $0x20,%esp
+  803d8e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803d92:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803d96:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803d9a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803d9e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803da2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803da6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803daa:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803dae:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803db8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dbd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803dc4:	00 
+  803dc5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803dcc:	00 
+  803dcd:	eb 08                	jmp    803dd7 <__udivdi3+0x4f>
+  803dcf:	83 e9 01             	sub    $0x1,%ecx
+  803dd2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803dd5:	74 68                	je     803e3f <__udivdi3+0xb7>
+  803dd7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803ddb:	01 c0                	add    %eax,%eax
+  803ddd:	89 c6                	mov    %eax,%esi
+  803ddf:	89 d7                	mov    %edx,%edi
+  803de1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803de5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803de9:	0f ad d0             	shrd   %cl,%edx,%eax
+  803dec:	d3 ea                	shr    %cl,%edx
+  803dee:	f6 c1 20             	test   $0x20,%cl
+  803df1:	74 04                	je     803df7 <__udivdi3+0x6f>
+  803df3:	89 d0                	mov    %edx,%eax
+  803df5:	31 d2                	xor    %edx,%edx
+  803df7:	83 e0 01             	and    $0x1,%eax
+  803dfa:	89 04 24             	mov    %eax,(%esp)
+  803dfd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803e04:	00 
+  803e05:	8b 04 24             	mov    (%esp),%eax
+  803e08:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803e0c:	09 f0                	or     %esi,%eax
+  803e0e:	09 fa                	or     %edi,%edx
+  803e10:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803e14:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803e18:	39 f0                	cmp    %esi,%eax
+  803e1a:	89 d3                	mov    %edx,%ebx
+  803e1c:	19 fb                	sbb    %edi,%ebx
+  803e1e:	72 af                	jb     803dcf <__udivdi3+0x47>
+  803e20:	29 f0                	sub    %esi,%eax
+  803e22:	19 fa                	sbb    %edi,%edx
+  803e24:	89 cf                	mov    %ecx,%edi
+  803e26:	c1 ef 05             	shr    $0x5,%edi
+  803e29:	83 e7 01             	and    $0x1,%edi
+  803e2c:	89 fe                	mov    %edi,%esi
+  803e2e:	83 f6 01             	xor    $0x1,%esi
+  803e31:	d3 e6                	shl    %cl,%esi
+  803e33:	d3 e7                	shl    %cl,%edi
+  803e35:	09 74 24 18          	or     %esi,0x18(%esp)
+  803e39:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803e3d:	eb 90                	jmp    803dcf <__udivdi3+0x47>
+  803e3f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e43:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e47:	83 c4 20             	add    $0x20,%esp
+  803e4a:	5b                   	pop    %ebx
+  803e4b:	5e                   	pop    %esi
+  803e4c:	5f                   	pop    %edi
+  803e4d:	c3                   	ret
+
+00803e4e <__umoddi3>:
+  803e4e:	57                   	push   %edi
+  803e4f:	56                   	push   %esi
+  803e50:	53                   	push   %ebx
+  803e51:	83 ec 08             	sub    $0x8,%esp
+  803e54:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e58:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e5c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803e60:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803e64:	57                   	push   %edi
+  803e65:	56                   	push   %esi
+  803e66:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803e6a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803e6e:	52                   	push   %edx
+  803e6f:	50                   	push   %eax
+  803e70:	e8 13 ff ff ff       	call   803d88 <__udivdi3>
+  803e75:	89 c3                	mov    %eax,%ebx
+  803e77:	0f af d6             	imul   %esi,%edx
+  803e7a:	89 f9                	mov    %edi,%ecx
+  803e7c:	0f af cb             	imul   %ebx,%ecx
+  803e7f:	01 d1                	add    %edx,%ecx
+  803e81:	89 d8                	mov    %ebx,%eax
+  803e83:	f7 e6                	mul    %esi
+  803e85:	89 c6                	mov    %eax,%esi
+  803e87:	89 d7                	mov    %edx,%edi
+  803e89:	01 cf                	add    %ecx,%edi
+  803e8b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803e8f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803e93:	29 f0                	sub    %esi,%eax
+  803e95:	19 fa                	sbb    %edi,%edx
+  803e97:	83 c4 18             	add    $0x18,%esp
+  803e9a:	5b                   	pop    %ebx
+  803e9b:	5e                   	pop    %esi
+  803e9c:	5f                   	pop    %edi
+  803e9d:	c3                   	ret
+
+00803e9e <__divdi3>:
+  803e9e:	53                   	push   %ebx
+  803e9f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ea3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ea7:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803eab:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803eaf:	85 d2                	test   %edx,%edx
+  803eb1:	78 12                	js     803ec5 <__divdi3+0x27>
+  803eb3:	85 db                	test   %ebx,%ebx
+  803eb5:	78 2e                	js     803ee5 <__divdi3+0x47>
+  803eb7:	53                   	push   %ebx
+  803eb8:	51                   	push   %ecx
+  803eb9:	52                   	push   %edx
+  803eba:	50                   	push   %eax
+  803ebb:	e8 c8 fe ff ff       	call   803d88 <__udivdi3>
+  803ec0:	83 c4 10             	add    $0x10,%esp
+  803ec3:	eb 1e                	jmp    803ee3 <__divdi3+0x45>
+  803ec5:	f7 d8                	neg    %eax
+  803ec7:	83 d2 00             	adc    $0x0,%edx
+  803eca:	f7 da                	neg    %edx
+  803ecc:	85 db                	test   %ebx,%ebx
+  803ece:	78 2a                	js     803efa <__divdi3+0x5c>
+  803ed0:	53                   	push   %ebx
+  803ed1:	51                   	push   %ecx
+  803ed2:	52                   	push   %edx
+  803ed3:	50                   	push   %eax
+  803ed4:	e8 af fe ff ff       	call   803d88 <__udivdi3>
+  803ed9:	83 c4 10             	add    $0x10,%esp
+  803edc:	f7 d8                	neg    %eax
+  803ede:	83 d2 00             	adc    $0x0,%edx
+  803ee1:	f7 da                	neg    %edx
+  803ee3:	5b                   	pop    %ebx
+  803ee4:	c3                   	ret
+  803ee5:	f7 d9                	neg    %ecx
+  803ee7:	83 d3 00             	adc    $0x0,%ebx
+  803eea:	f7 db                	neg    %ebx
+  803eec:	53                   	push   %ebx
+  803eed:	51                   	push   %ecx
+  803eee:	52                   	push   %edx
+  803eef:	50                   	push   %eax
+  803ef0:	e8 93 fe ff ff       	call   803d88 <__udivdi3>
+  803ef5:	83 c4 10             	add    $0x10,%esp
+  803ef8:	eb e2                	jmp    803edc <__divdi3+0x3e>
+  803efa:	f7 d9                	neg    %ecx
+  803efc:	83 d3 00             	adc    $0x0,%ebx
+  803eff:	f7 db                	neg    %ebx
+  803f01:	53                   	push   %ebx
+  803f02:	51                   	push   %ecx
+  803f03:	52                   	push   %edx
+  803f04:	50                   	push   %eax
+  803f05:	e8 7e fe ff ff       	call   803d88 <__udivdi3>
+  803f0a:	83 c4 10             	add    $0x10,%esp
+  803f0d:	eb d4                	jmp    803ee3 <__divdi3+0x45>
+
+00803f0f <__moddi3>:
+  803f0f:	57                   	push   %edi
+  803f10:	56                   	push   %esi
+  803f11:	53                   	push   %ebx
+  803f12:	83 ec 08             	sub    $0x8,%esp
+  803f15:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f19:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f1d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803f21:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803f25:	57                   	push   %edi
+  803f26:	56                   	push   %esi
+  803f27:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f2b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f2f:	52                   	push   %edx
+  803f30:	50                   	push   %eax
+  803f31:	e8 68 ff ff ff       	call   803e9e <__divdi3>
+  803f36:	89 c3                	mov    %eax,%ebx
+  803f38:	0f af d6             	imul   %esi,%edx
+  803f3b:	89 f9                	mov    %edi,%ecx
+  803f3d:	0f af cb             	imul   %ebx,%ecx
+  803f40:	01 d1                	add    %edx,%ecx
+  803f42:	89 d8                	mov    %ebx,%eax
+  803f44:	f7 e6                	mul    %esi
+  803f46:	89 c6                	mov    %eax,%esi
+  803f48:	89 d7                	mov    %edx,%edi
+  803f4a:	01 cf                	add    %ecx,%edi
+  803f4c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803f50:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803f54:	29 f0                	sub    %esi,%eax
+  803f56:	19 fa                	sbb    %edi,%edx
+  803f58:	83 c4 18             	add    $0x18,%esp
+  803f5b:	5b                   	pop    %ebx
+  803f5c:	5e                   	pop    %esi
+  803f5d:	5f                   	pop    %edi
+  803f5e:	c3                   	ret
@@ -0,0 +1,8353 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e2 00 00 00       	call   800113 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: lsfd [-1]\n");
+  80003b:	68 c0 3d 80 00       	push   $0x803dc0
+  800040:	e8 0a 02 00 00       	call   80024f <cprintf>
+	exit();
+  800045:	e8 56 01 00 00       	call   8001a0 <exit>
+}
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	c9                   	leave
+  80004e:	c3                   	ret
+
+0080004f <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004f:	55                   	push   %ebp
+  800050:	89 e5                	mov    %esp,%ebp
+  800052:	57                   	push   %edi
+  800053:	56                   	push   %esi
+  800054:	53                   	push   %ebx
+  800055:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+	int i, usefprint = 0;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  80005b:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+  800061:	50                   	push   %eax
+  800062:	ff 75 0c             	push   0xc(%ebp)
+  800065:	8d 45 08             	lea    0x8(%ebp),%eax
+  800068:	50                   	push   %eax
+  800069:	e8 6f 11 00 00       	call   8011dd <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80006e:	83 c4 10             	add    $0x10,%esp
+	int i, usefprint = 0;
+  800071:	be 00 00 00 00       	mov    $0x0,%esi
+	while ((i = argnext(&args)) >= 0)
+  800076:	8d 9d 48 ff ff ff    	lea    -0xb8(%ebp),%ebx
+		if (i == '1')
+			usefprint = 1;
+  80007c:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  800081:	83 ec 0c             	sub    $0xc,%esp
+  800084:	53                   	push   %ebx
+  800085:	e8 83 11 00 00       	call   80120d <argnext>
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 c0                	test   %eax,%eax
+  80008f:	78 10                	js     8000a1 <umain+0x52>
+		if (i == '1')
+  800091:	83 f8 31             	cmp    $0x31,%eax
+  800094:	75 04                	jne    80009a <umain+0x4b>
+			usefprint = 1;
+  800096:	89 fe                	mov    %edi,%esi
+  800098:	eb e7                	jmp    800081 <umain+0x32>
+		else
+			usage();
+  80009a:	e8 96 ff ff ff       	call   800035 <usage>
+  80009f:	eb e0                	jmp    800081 <umain+0x32>
+
+	for (i = 0; i < 32; i++)
+  8000a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fstat(i, &st) >= 0) {
+  8000a6:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+  8000ac:	eb 26                	jmp    8000d4 <umain+0x85>
+			if (usefprint)
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b4:	ff 70 04             	push   0x4(%eax)
+  8000b7:	ff 75 d8             	push   -0x28(%ebp)
+  8000ba:	ff 75 dc             	push   -0x24(%ebp)
+  8000bd:	57                   	push   %edi
+  8000be:	53                   	push   %ebx
+  8000bf:	68 d4 3d 80 00       	push   $0x803dd4
+  8000c4:	e8 86 01 00 00       	call   80024f <cprintf>
+  8000c9:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < 32; i++)
+  8000cc:	83 c3 01             	add    $0x1,%ebx
+  8000cf:	83 fb 20             	cmp    $0x20,%ebx
+  8000d2:	74 37                	je     80010b <umain+0xbc>
+		if (fstat(i, &st) >= 0) {
+  8000d4:	83 ec 08             	sub    $0x8,%esp
+  8000d7:	57                   	push   %edi
+  8000d8:	53                   	push   %ebx
+  8000d9:	e8 fa 17 00 00       	call   8018d8 <fstat>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 e7                	js     8000cc <umain+0x7d>
+			if (usefprint)
+  8000e5:	85 f6                	test   %esi,%esi
+  8000e7:	74 c5                	je     8000ae <umain+0x5f>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e9:	83 ec 04             	sub    $0x4,%esp
+  8000ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ef:	ff 70 04             	push   0x4(%eax)
+  8000f2:	ff 75 d8             	push   -0x28(%ebp)
+  8000f5:	ff 75 dc             	push   -0x24(%ebp)
+  8000f8:	57                   	push   %edi
+  8000f9:	53                   	push   %ebx
+  8000fa:	68 d4 3d 80 00       	push   $0x803dd4
+  8000ff:	6a 01                	push   $0x1
+  800101:	e8 7f 1c 00 00       	call   801d85 <fprintf>
+  800106:	83 c4 20             	add    $0x20,%esp
+  800109:	eb c1                	jmp    8000cc <umain+0x7d>
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+		}
+}
+  80010b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010e:	5b                   	pop    %ebx
+  80010f:	5e                   	pop    %esi
+  800110:	5f                   	pop    %edi
+  800111:	5d                   	pop    %ebp
+  800112:	c3                   	ret
+
+00800113 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	56                   	push   %esi
+  800117:	53                   	push   %ebx
+  800118:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80011b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80011e:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800120:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800125:	29 d0                	sub    %edx,%eax
+  800127:	89 c2                	mov    %eax,%edx
+  800129:	c1 ea 0f             	shr    $0xf,%edx
+  80012c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800131:	b8 00 00 00 00       	mov    $0x0,%eax
+  800136:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800139:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  800140:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800144:	e8 f3 0b 00 00       	call   800d3c <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800149:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80014e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800154:	89 e1                	mov    %esp,%ecx
+  800156:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80015b:	29 ca                	sub    %ecx,%edx
+  80015d:	89 d1                	mov    %edx,%ecx
+  80015f:	c1 e9 0f             	shr    $0xf,%ecx
+  800162:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016d:	0f 42 d1             	cmovb  %ecx,%edx
+  800170:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800175:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80017c:	85 db                	test   %ebx,%ebx
+  80017e:	7e 07                	jle    800187 <libmain+0x74>
+		binaryname = argv[0];
+  800180:	8b 06                	mov    (%esi),%eax
+  800182:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800187:	83 ec 08             	sub    $0x8,%esp
+  80018a:	56                   	push   %esi
+  80018b:	53                   	push   %ebx
+  80018c:	e8 be fe ff ff       	call   80004f <umain>
+
+	// exit gracefully
+	exit();
+  800191:	e8 0a 00 00 00       	call   8001a0 <exit>
+}
+  800196:	83 c4 10             	add    $0x10,%esp
+  800199:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80019c:	5b                   	pop    %ebx
+  80019d:	5e                   	pop    %esi
+  80019e:	5d                   	pop    %ebp
+  80019f:	c3                   	ret
+
+008001a0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001a6:	e8 6a 13 00 00       	call   801515 <close_all>
+	sys_env_destroy(0);
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+  8001ae:	6a 00                	push   $0x0
+  8001b0:	e8 46 0b 00 00       	call   800cfb <sys_env_destroy>
+}
+  8001b5:	83 c4 10             	add    $0x10,%esp
+  8001b8:	c9                   	leave
+  8001b9:	c3                   	ret
+
+008001ba <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ba:	55                   	push   %ebp
+  8001bb:	89 e5                	mov    %esp,%ebp
+  8001bd:	53                   	push   %ebx
+  8001be:	83 ec 04             	sub    $0x4,%esp
+  8001c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001c4:	8b 13                	mov    (%ebx),%edx
+  8001c6:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c9:	89 03                	mov    %eax,(%ebx)
+  8001cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ce:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001d2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001d7:	74 09                	je     8001e2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001d9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001e0:	c9                   	leave
+  8001e1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001e2:	83 ec 08             	sub    $0x8,%esp
+  8001e5:	68 ff 00 00 00       	push   $0xff
+  8001ea:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001ed:	50                   	push   %eax
+  8001ee:	e8 cb 0a 00 00       	call   800cbe <sys_cputs>
+		b->idx = 0;
+  8001f3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f9:	83 c4 10             	add    $0x10,%esp
+  8001fc:	eb db                	jmp    8001d9 <putch+0x1f>
+
+008001fe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001fe:	55                   	push   %ebp
+  8001ff:	89 e5                	mov    %esp,%ebp
+  800201:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800207:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80020e:	00 00 00 
+	b.cnt = 0;
+  800211:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800218:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80021b:	ff 75 0c             	push   0xc(%ebp)
+  80021e:	ff 75 08             	push   0x8(%ebp)
+  800221:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800227:	50                   	push   %eax
+  800228:	68 ba 01 80 00       	push   $0x8001ba
+  80022d:	e8 1c 01 00 00       	call   80034e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800232:	83 c4 08             	add    $0x8,%esp
+  800235:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80023b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800241:	50                   	push   %eax
+  800242:	e8 77 0a 00 00       	call   800cbe <sys_cputs>
+
+	return b.cnt;
+}
+  800247:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80024d:	c9                   	leave
+  80024e:	c3                   	ret
+
+0080024f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800255:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800258:	50                   	push   %eax
+  800259:	ff 75 08             	push   0x8(%ebp)
+  80025c:	e8 9d ff ff ff       	call   8001fe <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800261:	c9                   	leave
+  800262:	c3                   	ret
+
+00800263 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800263:	55                   	push   %ebp
+  800264:	89 e5                	mov    %esp,%ebp
+  800266:	57                   	push   %edi
+  800267:	56                   	push   %esi
+  800268:	53                   	push   %ebx
+  800269:	83 ec 1c             	sub    $0x1c,%esp
+  80026c:	89 c3                	mov    %eax,%ebx
+  80026e:	89 d6                	mov    %edx,%esi
+  800270:	8b 45 08             	mov    0x8(%ebp),%eax
+  800273:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800276:	89 d1                	mov    %edx,%ecx
+  800278:	89 c2                	mov    %eax,%edx
+  80027a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80027d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800280:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800283:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800286:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80028d:	39 c2                	cmp    %eax,%edx
+  80028f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800292:	73 4b                	jae    8002df <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800294:	8b 45 14             	mov    0x14(%ebp),%eax
+  800297:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80029a:	85 ff                	test   %edi,%edi
+  80029c:	7e 11                	jle    8002af <printnum+0x4c>
+			putch(padc, putdat);
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	56                   	push   %esi
+  8002a2:	ff 75 18             	push   0x18(%ebp)
+  8002a5:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8002a7:	83 c4 10             	add    $0x10,%esp
+  8002aa:	83 ef 01             	sub    $0x1,%edi
+  8002ad:	75 ef                	jne    80029e <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002af:	83 ec 08             	sub    $0x8,%esp
+  8002b2:	56                   	push   %esi
+  8002b3:	83 ec 04             	sub    $0x4,%esp
+  8002b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b9:	ff 75 e0             	push   -0x20(%ebp)
+  8002bc:	ff 75 dc             	push   -0x24(%ebp)
+  8002bf:	ff 75 d8             	push   -0x28(%ebp)
+  8002c2:	e8 d3 39 00 00       	call   803c9a <__umoddi3>
+  8002c7:	83 c4 14             	add    $0x14,%esp
+  8002ca:	0f be 80 06 3e 80 00 	movsbl 0x803e06(%eax),%eax
+  8002d1:	50                   	push   %eax
+  8002d2:	ff d3                	call   *%ebx
+}
+  8002d4:	83 c4 10             	add    $0x10,%esp
+  8002d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002da:	5b                   	pop    %ebx
+  8002db:	5e                   	pop    %esi
+  8002dc:	5f                   	pop    %edi
+  8002dd:	5d                   	pop    %ebp
+  8002de:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002df:	83 ec 0c             	sub    $0xc,%esp
+  8002e2:	ff 75 18             	push   0x18(%ebp)
+  8002e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e8:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002eb:	52                   	push   %edx
+  8002ec:	50                   	push   %eax
+  8002ed:	83 ec 08             	sub    $0x8,%esp
+  8002f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f3:	ff 75 e0             	push   -0x20(%ebp)
+  8002f6:	ff 75 dc             	push   -0x24(%ebp)
+  8002f9:	ff 75 d8             	push   -0x28(%ebp)
+  8002fc:	e8 d3 38 00 00       	call   803bd4 <__udivdi3>
+  800301:	83 c4 18             	add    $0x18,%esp
+  800304:	52                   	push   %edx
+  800305:	50                   	push   %eax
+  800306:	89 f2                	mov    %esi,%edx
+  800308:	89 d8                	mov    %ebx,%eax
+  80030a:	e8 54 ff ff ff       	call   800263 <printnum>
+  80030f:	83 c4 20             	add    $0x20,%esp
+  800312:	eb 9b                	jmp    8002af <printnum+0x4c>
+
+00800314 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800314:	55                   	push   %ebp
+  800315:	89 e5                	mov    %esp,%ebp
+  800317:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80031a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80031e:	8b 10                	mov    (%eax),%edx
+  800320:	3b 50 04             	cmp    0x4(%eax),%edx
+  800323:	73 0a                	jae    80032f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800325:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800328:	89 08                	mov    %ecx,(%eax)
+  80032a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032d:	88 02                	mov    %al,(%edx)
+}
+  80032f:	5d                   	pop    %ebp
+  800330:	c3                   	ret
+
+00800331 <printfmt>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800337:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80033a:	50                   	push   %eax
+  80033b:	ff 75 10             	push   0x10(%ebp)
+  80033e:	ff 75 0c             	push   0xc(%ebp)
+  800341:	ff 75 08             	push   0x8(%ebp)
+  800344:	e8 05 00 00 00       	call   80034e <vprintfmt>
+}
+  800349:	83 c4 10             	add    $0x10,%esp
+  80034c:	c9                   	leave
+  80034d:	c3                   	ret
+
+0080034e <vprintfmt>:
+{
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	57                   	push   %edi
+  800352:	56                   	push   %esi
+  800353:	53                   	push   %ebx
+  800354:	83 ec 2c             	sub    $0x2c,%esp
+  800357:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80035a:	89 df                	mov    %ebx,%edi
+  80035c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80035f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800362:	8d 70 01             	lea    0x1(%eax),%esi
+  800365:	0f b6 00             	movzbl (%eax),%eax
+  800368:	83 f8 25             	cmp    $0x25,%eax
+  80036b:	74 1e                	je     80038b <vprintfmt+0x3d>
+			if (ch == '\0')
+  80036d:	85 c0                	test   %eax,%eax
+  80036f:	0f 84 15 05 00 00    	je     80088a <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800375:	83 ec 08             	sub    $0x8,%esp
+  800378:	53                   	push   %ebx
+  800379:	50                   	push   %eax
+  80037a:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80037c:	83 c6 01             	add    $0x1,%esi
+  80037f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	83 f8 25             	cmp    $0x25,%eax
+  800389:	75 e2                	jne    80036d <vprintfmt+0x1f>
+		padc = ' ';
+  80038b:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80038f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800396:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80039d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8003a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a9:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ac:	8d 56 01             	lea    0x1(%esi),%edx
+  8003af:	0f b6 0e             	movzbl (%esi),%ecx
+  8003b2:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003b5:	3c 55                	cmp    $0x55,%al
+  8003b7:	0f 87 3b 04 00 00    	ja     8007f8 <vprintfmt+0x4aa>
+  8003bd:	0f b6 c0             	movzbl %al,%eax
+  8003c0:	ff 24 85 80 3f 80 00 	jmp    *0x803f80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8003c7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003ca:	eb 93                	jmp    80035f <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cc:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8003ce:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003d2:	eb d8                	jmp    8003ac <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	89 d6                	mov    %edx,%esi
+  8003d6:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003da:	eb d0                	jmp    8003ac <vprintfmt+0x5e>
+  8003dc:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8003df:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003e2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8003e5:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8003e9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003ec:	83 f9 09             	cmp    $0x9,%ecx
+  8003ef:	77 6f                	ja     800460 <vprintfmt+0x112>
+  8003f1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8003f4:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8003f7:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003fa:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003fe:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800401:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800404:	83 fe 09             	cmp    $0x9,%esi
+  800407:	76 eb                	jbe    8003f4 <vprintfmt+0xa6>
+  800409:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80040c:	89 d6                	mov    %edx,%esi
+  80040e:	eb 13                	jmp    800423 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800410:	8b 45 14             	mov    0x14(%ebp),%eax
+  800413:	8b 00                	mov    (%eax),%eax
+  800415:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041b:	8d 40 04             	lea    0x4(%eax),%eax
+  80041e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800421:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800423:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800427:	79 83                	jns    8003ac <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800429:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80042c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80042f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800436:	e9 71 ff ff ff       	jmp    8003ac <vprintfmt+0x5e>
+			if (width < 0)
+  80043b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80043e:	85 c9                	test   %ecx,%ecx
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	0f 49 c1             	cmovns %ecx,%eax
+  800448:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044b:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80044d:	e9 5a ff ff ff       	jmp    8003ac <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800452:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800454:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045b:	e9 4c ff ff ff       	jmp    8003ac <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800460:	89 d6                	mov    %edx,%esi
+  800462:	eb bf                	jmp    800423 <vprintfmt+0xd5>
+			lflag++;
+  800464:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800468:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80046a:	e9 3d ff ff ff       	jmp    8003ac <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80046f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800472:	8b 45 14             	mov    0x14(%ebp),%eax
+  800475:	8d 70 04             	lea    0x4(%eax),%esi
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	53                   	push   %ebx
+  80047c:	ff 30                	push   (%eax)
+  80047e:	ff d7                	call   *%edi
+			break;
+  800480:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800483:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800486:	e9 d4 fe ff ff       	jmp    80035f <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80048b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800494:	8b 10                	mov    (%eax),%edx
+  800496:	89 d0                	mov    %edx,%eax
+  800498:	f7 d8                	neg    %eax
+  80049a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80049d:	83 f8 12             	cmp    $0x12,%eax
+  8004a0:	7f 23                	jg     8004c5 <vprintfmt+0x177>
+  8004a2:	8b 14 85 e0 40 80 00 	mov    0x8040e0(,%eax,4),%edx
+  8004a9:	85 d2                	test   %edx,%edx
+  8004ab:	74 18                	je     8004c5 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8004ad:	52                   	push   %edx
+  8004ae:	68 3b 42 80 00       	push   $0x80423b
+  8004b3:	53                   	push   %ebx
+  8004b4:	57                   	push   %edi
+  8004b5:	e8 77 fe ff ff       	call   800331 <printfmt>
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bd:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004c0:	e9 9a fe ff ff       	jmp    80035f <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8004c5:	50                   	push   %eax
+  8004c6:	68 1e 3e 80 00       	push   $0x803e1e
+  8004cb:	53                   	push   %ebx
+  8004cc:	57                   	push   %edi
+  8004cd:	e8 5f fe ff ff       	call   800331 <printfmt>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d5:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d8:	e9 82 fe ff ff       	jmp    80035f <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004dd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e3:	83 c0 04             	add    $0x4,%eax
+  8004e6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ec:	8b 00                	mov    (%eax),%eax
+  8004ee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004f1:	85 c0                	test   %eax,%eax
+  8004f3:	0f 84 61 03 00 00    	je     80085a <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8004f9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004fd:	7e 06                	jle    800505 <vprintfmt+0x1b7>
+  8004ff:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800503:	75 29                	jne    80052e <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800505:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800508:	8d 70 01             	lea    0x1(%eax),%esi
+  80050b:	0f b6 00             	movzbl (%eax),%eax
+  80050e:	0f be d0             	movsbl %al,%edx
+  800511:	85 d2                	test   %edx,%edx
+  800513:	0f 84 bb 00 00 00    	je     8005d4 <vprintfmt+0x286>
+  800519:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80051c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80051f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800522:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800525:	eb 7a                	jmp    8005a1 <vprintfmt+0x253>
+				p = "(null)";
+  800527:	c7 45 d0 17 3e 80 00 	movl   $0x803e17,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	ff 75 d4             	push   -0x2c(%ebp)
+  800534:	ff 75 d0             	push   -0x30(%ebp)
+  800537:	e8 e0 03 00 00       	call   80091c <strnlen>
+  80053c:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80053f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800542:	83 c4 10             	add    $0x10,%esp
+  800545:	85 d2                	test   %edx,%edx
+  800547:	0f 8e d6 02 00 00    	jle    800823 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80054d:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800551:	83 ec 08             	sub    $0x8,%esp
+  800554:	53                   	push   %ebx
+  800555:	56                   	push   %esi
+  800556:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800558:	83 c4 10             	add    $0x10,%esp
+  80055b:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80055f:	75 f0                	jne    800551 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800561:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800564:	8d 70 01             	lea    0x1(%eax),%esi
+  800567:	0f b6 00             	movzbl (%eax),%eax
+  80056a:	0f be d0             	movsbl %al,%edx
+  80056d:	85 d2                	test   %edx,%edx
+  80056f:	0f 84 da 02 00 00    	je     80084f <vprintfmt+0x501>
+  800575:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800578:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80057b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80057e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800581:	eb 1e                	jmp    8005a1 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	ff 75 0c             	push   0xc(%ebp)
+  800589:	52                   	push   %edx
+  80058a:	ff 55 08             	call   *0x8(%ebp)
+  80058d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800590:	83 eb 01             	sub    $0x1,%ebx
+  800593:	83 c6 01             	add    $0x1,%esi
+  800596:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80059a:	0f be d0             	movsbl %al,%edx
+  80059d:	85 d2                	test   %edx,%edx
+  80059f:	74 2a                	je     8005cb <vprintfmt+0x27d>
+  8005a1:	85 ff                	test   %edi,%edi
+  8005a3:	78 05                	js     8005aa <vprintfmt+0x25c>
+  8005a5:	83 ef 01             	sub    $0x1,%edi
+  8005a8:	78 59                	js     800603 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005aa:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ae:	74 d3                	je     800583 <vprintfmt+0x235>
+  8005b0:	0f be c0             	movsbl %al,%eax
+  8005b3:	83 e8 20             	sub    $0x20,%eax
+  8005b6:	83 f8 5e             	cmp    $0x5e,%eax
+  8005b9:	76 c8                	jbe    800583 <vprintfmt+0x235>
+					putch('?', putdat);
+  8005bb:	83 ec 08             	sub    $0x8,%esp
+  8005be:	ff 75 0c             	push   0xc(%ebp)
+  8005c1:	6a 3f                	push   $0x3f
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	eb c5                	jmp    800590 <vprintfmt+0x242>
+  8005cb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8005d4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005d7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005db:	7e 1b                	jle    8005f8 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8005dd:	83 ec 08             	sub    $0x8,%esp
+  8005e0:	53                   	push   %ebx
+  8005e1:	6a 20                	push   $0x20
+  8005e3:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005e5:	83 c4 10             	add    $0x10,%esp
+  8005e8:	83 ee 01             	sub    $0x1,%esi
+  8005eb:	75 f0                	jne    8005dd <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005ed:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f3:	e9 67 fd ff ff       	jmp    80035f <vprintfmt+0x11>
+  8005f8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fe:	e9 5c fd ff ff       	jmp    80035f <vprintfmt+0x11>
+  800603:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800606:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800609:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80060c:	eb c6                	jmp    8005d4 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80060e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800611:	89 55 10             	mov    %edx,0x10(%ebp)
+  800614:	83 f9 01             	cmp    $0x1,%ecx
+  800617:	7f 1f                	jg     800638 <vprintfmt+0x2ea>
+	else if (lflag)
+  800619:	85 c9                	test   %ecx,%ecx
+  80061b:	74 67                	je     800684 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 30                	mov    (%eax),%esi
+  800622:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800625:	89 f0                	mov    %esi,%eax
+  800627:	c1 f8 1f             	sar    $0x1f,%eax
+  80062a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8d 40 04             	lea    0x4(%eax),%eax
+  800633:	89 45 14             	mov    %eax,0x14(%ebp)
+  800636:	eb 17                	jmp    80064f <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 50 04             	mov    0x4(%eax),%edx
+  80063e:	8b 00                	mov    (%eax),%eax
+  800640:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800643:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8d 40 08             	lea    0x8(%eax),%eax
+  80064c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80064f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800652:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800655:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80065a:	85 c9                	test   %ecx,%ecx
+  80065c:	0f 89 12 01 00 00    	jns    800774 <vprintfmt+0x426>
+				putch('-', putdat);
+  800662:	83 ec 08             	sub    $0x8,%esp
+  800665:	53                   	push   %ebx
+  800666:	6a 2d                	push   $0x2d
+  800668:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80066a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80066d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800670:	f7 da                	neg    %edx
+  800672:	83 d1 00             	adc    $0x0,%ecx
+  800675:	f7 d9                	neg    %ecx
+  800677:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80067a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80067f:	e9 f0 00 00 00       	jmp    800774 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 30                	mov    (%eax),%esi
+  800689:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80068c:	89 f0                	mov    %esi,%eax
+  80068e:	c1 f8 1f             	sar    $0x1f,%eax
+  800691:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8d 40 04             	lea    0x4(%eax),%eax
+  80069a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069d:	eb b0                	jmp    80064f <vprintfmt+0x301>
+	if (lflag >= 2)
+  80069f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006a2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a5:	83 f9 01             	cmp    $0x1,%ecx
+  8006a8:	7f 1e                	jg     8006c8 <vprintfmt+0x37a>
+	else if (lflag)
+  8006aa:	85 c9                	test   %ecx,%ecx
+  8006ac:	74 32                	je     8006e0 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8b 10                	mov    (%eax),%edx
+  8006b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006be:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8006c3:	e9 ac 00 00 00       	jmp    800774 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d6:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8006db:	e9 94 00 00 00       	jmp    800774 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e3:	8b 10                	mov    (%eax),%edx
+  8006e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f0:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8006f5:	eb 7d                	jmp    800774 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8006f7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006fa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006fd:	83 f9 01             	cmp    $0x1,%ecx
+  800700:	7f 1b                	jg     80071d <vprintfmt+0x3cf>
+	else if (lflag)
+  800702:	85 c9                	test   %ecx,%ecx
+  800704:	74 2c                	je     800732 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8b 10                	mov    (%eax),%edx
+  80070b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800710:	8d 40 04             	lea    0x4(%eax),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800716:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80071b:	eb 57                	jmp    800774 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 10                	mov    (%eax),%edx
+  800722:	8b 48 04             	mov    0x4(%eax),%ecx
+  800725:	8d 40 08             	lea    0x8(%eax),%eax
+  800728:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072b:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800730:	eb 42                	jmp    800774 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073c:	8d 40 04             	lea    0x4(%eax),%eax
+  80073f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800742:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800747:	eb 2b                	jmp    800774 <vprintfmt+0x426>
+			putch('0', putdat);
+  800749:	89 55 10             	mov    %edx,0x10(%ebp)
+  80074c:	83 ec 08             	sub    $0x8,%esp
+  80074f:	53                   	push   %ebx
+  800750:	6a 30                	push   $0x30
+  800752:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800754:	83 c4 08             	add    $0x8,%esp
+  800757:	53                   	push   %ebx
+  800758:	6a 78                	push   $0x78
+  80075a:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80075c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075f:	8b 10                	mov    (%eax),%edx
+  800761:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800766:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800769:	8d 40 04             	lea    0x4(%eax),%eax
+  80076c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076f:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800774:	83 ec 0c             	sub    $0xc,%esp
+  800777:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80077b:	50                   	push   %eax
+  80077c:	ff 75 e4             	push   -0x1c(%ebp)
+  80077f:	56                   	push   %esi
+  800780:	51                   	push   %ecx
+  800781:	52                   	push   %edx
+  800782:	89 da                	mov    %ebx,%edx
+  800784:	89 f8                	mov    %edi,%eax
+  800786:	e8 d8 fa ff ff       	call   800263 <printnum>
+			break;
+  80078b:	83 c4 20             	add    $0x20,%esp
+  80078e:	e9 cc fb ff ff       	jmp    80035f <vprintfmt+0x11>
+	if (lflag >= 2)
+  800793:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800796:	89 55 10             	mov    %edx,0x10(%ebp)
+  800799:	83 f9 01             	cmp    $0x1,%ecx
+  80079c:	7f 1b                	jg     8007b9 <vprintfmt+0x46b>
+	else if (lflag)
+  80079e:	85 c9                	test   %ecx,%ecx
+  8007a0:	74 2c                	je     8007ce <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8007a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a5:	8b 10                	mov    (%eax),%edx
+  8007a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8007af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b2:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8007b7:	eb bb                	jmp    800774 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bc:	8b 10                	mov    (%eax),%edx
+  8007be:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c7:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8007cc:	eb a6                	jmp    800774 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d1:	8b 10                	mov    (%eax),%edx
+  8007d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007de:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8007e3:	eb 8f                	jmp    800774 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8007e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e8:	83 ec 08             	sub    $0x8,%esp
+  8007eb:	53                   	push   %ebx
+  8007ec:	6a 25                	push   $0x25
+  8007ee:	ff d7                	call   *%edi
+			break;
+  8007f0:	83 c4 10             	add    $0x10,%esp
+  8007f3:	e9 67 fb ff ff       	jmp    80035f <vprintfmt+0x11>
+			putch('%', putdat);
+  8007f8:	83 ec 08             	sub    $0x8,%esp
+  8007fb:	53                   	push   %ebx
+  8007fc:	6a 25                	push   $0x25
+  8007fe:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800800:	83 c4 10             	add    $0x10,%esp
+  800803:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800807:	0f 84 ba fb ff ff    	je     8003c7 <vprintfmt+0x79>
+  80080d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800810:	89 f0                	mov    %esi,%eax
+  800812:	83 e8 01             	sub    $0x1,%eax
+  800815:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800819:	75 f7                	jne    800812 <vprintfmt+0x4c4>
+  80081b:	89 45 10             	mov    %eax,0x10(%ebp)
+  80081e:	e9 3c fb ff ff       	jmp    80035f <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800823:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800826:	8d 70 01             	lea    0x1(%eax),%esi
+  800829:	0f b6 00             	movzbl (%eax),%eax
+  80082c:	0f be d0             	movsbl %al,%edx
+  80082f:	85 d2                	test   %edx,%edx
+  800831:	74 11                	je     800844 <vprintfmt+0x4f6>
+  800833:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800836:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800839:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80083c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80083f:	e9 5d fd ff ff       	jmp    8005a1 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800844:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800847:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084a:	e9 10 fb ff ff       	jmp    80035f <vprintfmt+0x11>
+  80084f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800852:	89 45 14             	mov    %eax,0x14(%ebp)
+  800855:	e9 05 fb ff ff       	jmp    80035f <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  80085a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80085e:	7e 0a                	jle    80086a <vprintfmt+0x51c>
+  800860:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800864:	0f 85 bd fc ff ff    	jne    800527 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80086a:	ba 28 00 00 00       	mov    $0x28,%edx
+  80086f:	b8 28 00 00 00       	mov    $0x28,%eax
+  800874:	be 18 3e 80 00       	mov    $0x803e18,%esi
+  800879:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80087c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80087f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800882:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800885:	e9 17 fd ff ff       	jmp    8005a1 <vprintfmt+0x253>
+}
+  80088a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80088d:	5b                   	pop    %ebx
+  80088e:	5e                   	pop    %esi
+  80088f:	5f                   	pop    %edi
+  800890:	5d                   	pop    %ebp
+  800891:	c3                   	ret
+
+00800892 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	83 ec 18             	sub    $0x18,%esp
+  800898:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80089e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008a1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008a5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008af:	85 c0                	test   %eax,%eax
+  8008b1:	74 26                	je     8008d9 <vsnprintf+0x47>
+  8008b3:	85 d2                	test   %edx,%edx
+  8008b5:	7e 22                	jle    8008d9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008b7:	ff 75 14             	push   0x14(%ebp)
+  8008ba:	ff 75 10             	push   0x10(%ebp)
+  8008bd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008c0:	50                   	push   %eax
+  8008c1:	68 14 03 80 00       	push   $0x800314
+  8008c6:	e8 83 fa ff ff       	call   80034e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008cb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008ce:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d4:	83 c4 10             	add    $0x10,%esp
+}
+  8008d7:	c9                   	leave
+  8008d8:	c3                   	ret
+		return -E_INVAL;
+  8008d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008de:	eb f7                	jmp    8008d7 <vsnprintf+0x45>
+
+008008e0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008e0:	55                   	push   %ebp
+  8008e1:	89 e5                	mov    %esp,%ebp
+  8008e3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008e6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008e9:	50                   	push   %eax
+  8008ea:	ff 75 10             	push   0x10(%ebp)
+  8008ed:	ff 75 0c             	push   0xc(%ebp)
+  8008f0:	ff 75 08             	push   0x8(%ebp)
+  8008f3:	e8 9a ff ff ff       	call   800892 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008f8:	c9                   	leave
+  8008f9:	c3                   	ret
+
+008008fa <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008fa:	55                   	push   %ebp
+  8008fb:	89 e5                	mov    %esp,%ebp
+  8008fd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800900:	80 3a 00             	cmpb   $0x0,(%edx)
+  800903:	74 10                	je     800915 <strlen+0x1b>
+  800905:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80090a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80090d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800911:	75 f7                	jne    80090a <strlen+0x10>
+	return n;
+}
+  800913:	5d                   	pop    %ebp
+  800914:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800915:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80091a:	eb f7                	jmp    800913 <strlen+0x19>
+
+0080091c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80091c:	55                   	push   %ebp
+  80091d:	89 e5                	mov    %esp,%ebp
+  80091f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800922:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800925:	85 d2                	test   %edx,%edx
+  800927:	74 16                	je     80093f <strnlen+0x23>
+  800929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800932:	74 09                	je     80093d <strnlen+0x21>
+		n++;
+  800934:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800937:	39 d0                	cmp    %edx,%eax
+  800939:	75 f3                	jne    80092e <strnlen+0x12>
+		n++;
+  80093b:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80093f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800944:	eb f7                	jmp    80093d <strnlen+0x21>
+
+00800946 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800946:	55                   	push   %ebp
+  800947:	89 e5                	mov    %esp,%ebp
+  800949:	53                   	push   %ebx
+  80094a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80094d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800950:	b8 00 00 00 00       	mov    $0x0,%eax
+  800955:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800959:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80095c:	83 c0 01             	add    $0x1,%eax
+  80095f:	84 d2                	test   %dl,%dl
+  800961:	75 f2                	jne    800955 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800963:	89 c8                	mov    %ecx,%eax
+  800965:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800968:	c9                   	leave
+  800969:	c3                   	ret
+
+0080096a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	53                   	push   %ebx
+  80096e:	83 ec 10             	sub    $0x10,%esp
+  800971:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800974:	53                   	push   %ebx
+  800975:	e8 80 ff ff ff       	call   8008fa <strlen>
+  80097a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80097d:	ff 75 0c             	push   0xc(%ebp)
+  800980:	01 d8                	add    %ebx,%eax
+  800982:	50                   	push   %eax
+  800983:	e8 be ff ff ff       	call   800946 <strcpy>
+	return dst;
+}
+  800988:	89 d8                	mov    %ebx,%eax
+  80098a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098d:	c9                   	leave
+  80098e:	c3                   	ret
+
+0080098f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	56                   	push   %esi
+  800993:	53                   	push   %ebx
+  800994:	8b 75 08             	mov    0x8(%ebp),%esi
+  800997:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80099d:	85 db                	test   %ebx,%ebx
+  80099f:	74 17                	je     8009b8 <strncpy+0x29>
+  8009a1:	01 f3                	add    %esi,%ebx
+  8009a3:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8009a5:	83 c0 01             	add    $0x1,%eax
+  8009a8:	0f b6 0a             	movzbl (%edx),%ecx
+  8009ab:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009ae:	80 f9 01             	cmp    $0x1,%cl
+  8009b1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009b4:	39 c3                	cmp    %eax,%ebx
+  8009b6:	75 ed                	jne    8009a5 <strncpy+0x16>
+	}
+	return ret;
+}
+  8009b8:	89 f0                	mov    %esi,%eax
+  8009ba:	5b                   	pop    %ebx
+  8009bb:	5e                   	pop    %esi
+  8009bc:	5d                   	pop    %ebp
+  8009bd:	c3                   	ret
+
+008009be <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009be:	55                   	push   %ebp
+  8009bf:	89 e5                	mov    %esp,%ebp
+  8009c1:	56                   	push   %esi
+  8009c2:	53                   	push   %ebx
+  8009c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009cc:	89 f0                	mov    %esi,%eax
+  8009ce:	85 db                	test   %ebx,%ebx
+  8009d0:	74 1e                	je     8009f0 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  8009d2:	83 eb 01             	sub    $0x1,%ebx
+  8009d5:	74 16                	je     8009ed <strlcpy+0x2f>
+  8009d7:	01 f3                	add    %esi,%ebx
+  8009d9:	0f b6 0a             	movzbl (%edx),%ecx
+  8009dc:	84 c9                	test   %cl,%cl
+  8009de:	74 0d                	je     8009ed <strlcpy+0x2f>
+			*dst++ = *src++;
+  8009e0:	83 c2 01             	add    $0x1,%edx
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  8009e6:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  8009e9:	39 d8                	cmp    %ebx,%eax
+  8009eb:	75 ec                	jne    8009d9 <strlcpy+0x1b>
+		*dst = '\0';
+  8009ed:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009f0:	29 f0                	sub    %esi,%eax
+}
+  8009f2:	5b                   	pop    %ebx
+  8009f3:	5e                   	pop    %esi
+  8009f4:	5d                   	pop    %ebp
+  8009f5:	c3                   	ret
+
+008009f6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009f6:	55                   	push   %ebp
+  8009f7:	89 e5                	mov    %esp,%ebp
+  8009f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ff:	0f b6 01             	movzbl (%ecx),%eax
+  800a02:	84 c0                	test   %al,%al
+  800a04:	74 11                	je     800a17 <strcmp+0x21>
+  800a06:	38 02                	cmp    %al,(%edx)
+  800a08:	75 0d                	jne    800a17 <strcmp+0x21>
+		p++, q++;
+  800a0a:	83 c1 01             	add    $0x1,%ecx
+  800a0d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a10:	0f b6 01             	movzbl (%ecx),%eax
+  800a13:	84 c0                	test   %al,%al
+  800a15:	75 ef                	jne    800a06 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a17:	0f b6 c0             	movzbl %al,%eax
+  800a1a:	0f b6 12             	movzbl (%edx),%edx
+  800a1d:	29 d0                	sub    %edx,%eax
+}
+  800a1f:	5d                   	pop    %ebp
+  800a20:	c3                   	ret
+
+00800a21 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	53                   	push   %ebx
+  800a25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a2b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a33:	85 d2                	test   %edx,%edx
+  800a35:	74 2e                	je     800a65 <strncmp+0x44>
+  800a37:	0f b6 01             	movzbl (%ecx),%eax
+  800a3a:	84 c0                	test   %al,%al
+  800a3c:	74 16                	je     800a54 <strncmp+0x33>
+  800a3e:	3a 03                	cmp    (%ebx),%al
+  800a40:	75 12                	jne    800a54 <strncmp+0x33>
+		n--, p++, q++;
+  800a42:	83 c1 01             	add    $0x1,%ecx
+  800a45:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a48:	83 ea 01             	sub    $0x1,%edx
+  800a4b:	75 ea                	jne    800a37 <strncmp+0x16>
+		return 0;
+  800a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a52:	eb 11                	jmp    800a65 <strncmp+0x44>
+  800a54:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a59:	85 d2                	test   %edx,%edx
+  800a5b:	74 08                	je     800a65 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a5d:	0f b6 01             	movzbl (%ecx),%eax
+  800a60:	0f b6 13             	movzbl (%ebx),%edx
+  800a63:	29 d0                	sub    %edx,%eax
+}
+  800a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a68:	c9                   	leave
+  800a69:	c3                   	ret
+
+00800a6a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a6a:	55                   	push   %ebp
+  800a6b:	89 e5                	mov    %esp,%ebp
+  800a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a70:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a74:	0f b6 10             	movzbl (%eax),%edx
+  800a77:	84 d2                	test   %dl,%dl
+  800a79:	74 15                	je     800a90 <strchr+0x26>
+		if (*s == c)
+  800a7b:	38 d1                	cmp    %dl,%cl
+  800a7d:	74 0f                	je     800a8e <strchr+0x24>
+	for (; *s; s++)
+  800a7f:	83 c0 01             	add    $0x1,%eax
+  800a82:	0f b6 10             	movzbl (%eax),%edx
+  800a85:	84 d2                	test   %dl,%dl
+  800a87:	75 f2                	jne    800a7b <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8e:	5d                   	pop    %ebp
+  800a8f:	c3                   	ret
+	return 0;
+  800a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a95:	eb f7                	jmp    800a8e <strchr+0x24>
+
+00800a97 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	53                   	push   %ebx
+  800a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800aa1:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800aa4:	38 d3                	cmp    %dl,%bl
+  800aa6:	74 14                	je     800abc <strfind+0x25>
+  800aa8:	89 d1                	mov    %edx,%ecx
+  800aaa:	84 db                	test   %bl,%bl
+  800aac:	74 0e                	je     800abc <strfind+0x25>
+	for (; *s; s++)
+  800aae:	83 c0 01             	add    $0x1,%eax
+  800ab1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ab4:	38 ca                	cmp    %cl,%dl
+  800ab6:	74 04                	je     800abc <strfind+0x25>
+  800ab8:	84 d2                	test   %dl,%dl
+  800aba:	75 f2                	jne    800aae <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800abc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abf:	c9                   	leave
+  800ac0:	c3                   	ret
+
+00800ac1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	57                   	push   %edi
+  800ac5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800acb:	85 c9                	test   %ecx,%ecx
+  800acd:	74 20                	je     800aef <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800acf:	89 f8                	mov    %edi,%eax
+  800ad1:	09 c8                	or     %ecx,%eax
+  800ad3:	a8 03                	test   $0x3,%al
+  800ad5:	75 12                	jne    800ae9 <memset+0x28>
+		c &= 0xFF;
+  800ad7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800adb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ae1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ae4:	fc                   	cld
+  800ae5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ae7:	eb 06                	jmp    800aef <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ae9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aec:	fc                   	cld
+  800aed:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800aef:	89 f8                	mov    %edi,%eax
+  800af1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800af4:	c9                   	leave
+  800af5:	c3                   	ret
+
+00800af6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	57                   	push   %edi
+  800afa:	56                   	push   %esi
+  800afb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b01:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b04:	39 c6                	cmp    %eax,%esi
+  800b06:	73 32                	jae    800b3a <memmove+0x44>
+  800b08:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b0b:	39 d0                	cmp    %edx,%eax
+  800b0d:	73 2b                	jae    800b3a <memmove+0x44>
+		s += n;
+		d += n;
+  800b0f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b12:	89 d6                	mov    %edx,%esi
+  800b14:	09 fe                	or     %edi,%esi
+  800b16:	09 ce                	or     %ecx,%esi
+  800b18:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b1e:	75 0e                	jne    800b2e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b20:	83 ef 04             	sub    $0x4,%edi
+  800b23:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b26:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b29:	fd                   	std
+  800b2a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b2c:	eb 09                	jmp    800b37 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b2e:	83 ef 01             	sub    $0x1,%edi
+  800b31:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b34:	fd                   	std
+  800b35:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b37:	fc                   	cld
+  800b38:	eb 1a                	jmp    800b54 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b3a:	89 f2                	mov    %esi,%edx
+  800b3c:	09 c2                	or     %eax,%edx
+  800b3e:	09 ca                	or     %ecx,%edx
+  800b40:	f6 c2 03             	test   $0x3,%dl
+  800b43:	75 0a                	jne    800b4f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b45:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b48:	89 c7                	mov    %eax,%edi
+  800b4a:	fc                   	cld
+  800b4b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b4d:	eb 05                	jmp    800b54 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b4f:	89 c7                	mov    %eax,%edi
+  800b51:	fc                   	cld
+  800b52:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b54:	5e                   	pop    %esi
+  800b55:	5f                   	pop    %edi
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+
+00800b58 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b5e:	ff 75 10             	push   0x10(%ebp)
+  800b61:	ff 75 0c             	push   0xc(%ebp)
+  800b64:	ff 75 08             	push   0x8(%ebp)
+  800b67:	e8 8a ff ff ff       	call   800af6 <memmove>
+}
+  800b6c:	c9                   	leave
+  800b6d:	c3                   	ret
+
+00800b6e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b79:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b7c:	85 f6                	test   %esi,%esi
+  800b7e:	74 29                	je     800ba9 <memcmp+0x3b>
+  800b80:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b82:	0f b6 08             	movzbl (%eax),%ecx
+  800b85:	0f b6 1a             	movzbl (%edx),%ebx
+  800b88:	38 d9                	cmp    %bl,%cl
+  800b8a:	75 11                	jne    800b9d <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b8c:	83 c0 01             	add    $0x1,%eax
+  800b8f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b92:	39 c6                	cmp    %eax,%esi
+  800b94:	75 ec                	jne    800b82 <memcmp+0x14>
+	}
+
+	return 0;
+  800b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9b:	eb 08                	jmp    800ba5 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b9d:	0f b6 c1             	movzbl %cl,%eax
+  800ba0:	0f b6 db             	movzbl %bl,%ebx
+  800ba3:	29 d8                	sub    %ebx,%eax
+}
+  800ba5:	5b                   	pop    %ebx
+  800ba6:	5e                   	pop    %esi
+  800ba7:	5d                   	pop    %ebp
+  800ba8:	c3                   	ret
+	return 0;
+  800ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bae:	eb f5                	jmp    800ba5 <memcmp+0x37>
+
+00800bb0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bb9:	89 c2                	mov    %eax,%edx
+  800bbb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bbe:	39 d0                	cmp    %edx,%eax
+  800bc0:	73 0d                	jae    800bcf <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bc2:	38 08                	cmp    %cl,(%eax)
+  800bc4:	74 0d                	je     800bd3 <memfind+0x23>
+	for (; s < ends; s++)
+  800bc6:	83 c0 01             	add    $0x1,%eax
+  800bc9:	39 c2                	cmp    %eax,%edx
+  800bcb:	75 f5                	jne    800bc2 <memfind+0x12>
+  800bcd:	eb 06                	jmp    800bd5 <memfind+0x25>
+  800bcf:	89 c2                	mov    %eax,%edx
+  800bd1:	eb 02                	jmp    800bd5 <memfind+0x25>
+  800bd3:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800bd5:	89 d0                	mov    %edx,%eax
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+
+00800bd9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	56                   	push   %esi
+  800bde:	53                   	push   %ebx
+  800bdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800be5:	0f b6 02             	movzbl (%edx),%eax
+  800be8:	3c 20                	cmp    $0x20,%al
+  800bea:	74 04                	je     800bf0 <strtol+0x17>
+  800bec:	3c 09                	cmp    $0x9,%al
+  800bee:	75 0e                	jne    800bfe <strtol+0x25>
+		s++;
+  800bf0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bf3:	0f b6 02             	movzbl (%edx),%eax
+  800bf6:	3c 20                	cmp    $0x20,%al
+  800bf8:	74 f6                	je     800bf0 <strtol+0x17>
+  800bfa:	3c 09                	cmp    $0x9,%al
+  800bfc:	74 f2                	je     800bf0 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bfe:	3c 2b                	cmp    $0x2b,%al
+  800c00:	74 2a                	je     800c2c <strtol+0x53>
+	int neg = 0;
+  800c02:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c07:	3c 2d                	cmp    $0x2d,%al
+  800c09:	74 2b                	je     800c36 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c0b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c11:	75 0f                	jne    800c22 <strtol+0x49>
+  800c13:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c16:	74 28                	je     800c40 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c18:	85 db                	test   %ebx,%ebx
+  800c1a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c1f:	0f 44 d8             	cmove  %eax,%ebx
+  800c22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c27:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c2a:	eb 46                	jmp    800c72 <strtol+0x99>
+		s++;
+  800c2c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c34:	eb d5                	jmp    800c0b <strtol+0x32>
+		s++, neg = 1;
+  800c36:	83 c2 01             	add    $0x1,%edx
+  800c39:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c3e:	eb cb                	jmp    800c0b <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c40:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c44:	74 0e                	je     800c54 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c46:	85 db                	test   %ebx,%ebx
+  800c48:	75 d8                	jne    800c22 <strtol+0x49>
+		s++, base = 8;
+  800c4a:	83 c2 01             	add    $0x1,%edx
+  800c4d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c52:	eb ce                	jmp    800c22 <strtol+0x49>
+		s += 2, base = 16;
+  800c54:	83 c2 02             	add    $0x2,%edx
+  800c57:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c5c:	eb c4                	jmp    800c22 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c5e:	0f be c0             	movsbl %al,%eax
+  800c61:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c64:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c67:	7d 3a                	jge    800ca3 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c69:	83 c2 01             	add    $0x1,%edx
+  800c6c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c70:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c72:	0f b6 02             	movzbl (%edx),%eax
+  800c75:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c78:	89 f3                	mov    %esi,%ebx
+  800c7a:	80 fb 09             	cmp    $0x9,%bl
+  800c7d:	76 df                	jbe    800c5e <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c7f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c82:	89 f3                	mov    %esi,%ebx
+  800c84:	80 fb 19             	cmp    $0x19,%bl
+  800c87:	77 08                	ja     800c91 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c89:	0f be c0             	movsbl %al,%eax
+  800c8c:	83 e8 57             	sub    $0x57,%eax
+  800c8f:	eb d3                	jmp    800c64 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c91:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c94:	89 f3                	mov    %esi,%ebx
+  800c96:	80 fb 19             	cmp    $0x19,%bl
+  800c99:	77 08                	ja     800ca3 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c9b:	0f be c0             	movsbl %al,%eax
+  800c9e:	83 e8 37             	sub    $0x37,%eax
+  800ca1:	eb c1                	jmp    800c64 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ca3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ca7:	74 05                	je     800cae <strtol+0xd5>
+		*endptr = (char *) s;
+  800ca9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cac:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800cae:	89 c8                	mov    %ecx,%eax
+  800cb0:	f7 d8                	neg    %eax
+  800cb2:	85 ff                	test   %edi,%edi
+  800cb4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cb7:	89 c8                	mov    %ecx,%eax
+  800cb9:	5b                   	pop    %ebx
+  800cba:	5e                   	pop    %esi
+  800cbb:	5f                   	pop    %edi
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+
+00800cbe <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	57                   	push   %edi
+  800cc2:	56                   	push   %esi
+  800cc3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccf:	89 c3                	mov    %eax,%ebx
+  800cd1:	89 c7                	mov    %eax,%edi
+  800cd3:	89 c6                	mov    %eax,%esi
+  800cd5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cd7:	5b                   	pop    %ebx
+  800cd8:	5e                   	pop    %esi
+  800cd9:	5f                   	pop    %edi
+  800cda:	5d                   	pop    %ebp
+  800cdb:	c3                   	ret
+
+00800cdc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	57                   	push   %edi
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cec:	89 d1                	mov    %edx,%ecx
+  800cee:	89 d3                	mov    %edx,%ebx
+  800cf0:	89 d7                	mov    %edx,%edi
+  800cf2:	89 d6                	mov    %edx,%esi
+  800cf4:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cf6:	5b                   	pop    %ebx
+  800cf7:	5e                   	pop    %esi
+  800cf8:	5f                   	pop    %edi
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+
+00800cfb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	57                   	push   %edi
+  800cff:	56                   	push   %esi
+  800d00:	53                   	push   %ebx
+  800d01:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d11:	89 cb                	mov    %ecx,%ebx
+  800d13:	89 cf                	mov    %ecx,%edi
+  800d15:	89 ce                	mov    %ecx,%esi
+  800d17:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d19:	85 c0                	test   %eax,%eax
+  800d1b:	7f 08                	jg     800d25 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+  800d28:	50                   	push   %eax
+  800d29:	6a 03                	push   $0x3
+  800d2b:	68 4b 41 80 00       	push   $0x80414b
+  800d30:	6a 23                	push   $0x23
+  800d32:	68 68 41 80 00       	push   $0x804168
+  800d37:	e8 dc 2a 00 00       	call   803818 <_panic>
+
+00800d3c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d47:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d4c:	89 d1                	mov    %edx,%ecx
+  800d4e:	89 d3                	mov    %edx,%ebx
+  800d50:	89 d7                	mov    %edx,%edi
+  800d52:	89 d6                	mov    %edx,%esi
+  800d54:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+
+00800d5b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d66:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d6b:	89 d1                	mov    %edx,%ecx
+  800d6d:	89 d3                	mov    %edx,%ebx
+  800d6f:	89 d7                	mov    %edx,%edi
+  800d71:	89 d6                	mov    %edx,%esi
+  800d73:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d75:	5b                   	pop    %ebx
+  800d76:	5e                   	pop    %esi
+  800d77:	5f                   	pop    %edi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+
+00800d7a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	57                   	push   %edi
+  800d7e:	56                   	push   %esi
+  800d7f:	53                   	push   %ebx
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d83:	be 00 00 00 00       	mov    $0x0,%esi
+  800d88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d93:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d96:	89 f7                	mov    %esi,%edi
+  800d98:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d9a:	85 c0                	test   %eax,%eax
+  800d9c:	7f 08                	jg     800da6 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da1:	5b                   	pop    %ebx
+  800da2:	5e                   	pop    %esi
+  800da3:	5f                   	pop    %edi
+  800da4:	5d                   	pop    %ebp
+  800da5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da6:	83 ec 0c             	sub    $0xc,%esp
+  800da9:	50                   	push   %eax
+  800daa:	6a 04                	push   $0x4
+  800dac:	68 4b 41 80 00       	push   $0x80414b
+  800db1:	6a 23                	push   $0x23
+  800db3:	68 68 41 80 00       	push   $0x804168
+  800db8:	e8 5b 2a 00 00       	call   803818 <_panic>
+
+00800dbd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	57                   	push   %edi
+  800dc1:	56                   	push   %esi
+  800dc2:	53                   	push   %ebx
+  800dc3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcc:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dda:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddc:	85 c0                	test   %eax,%eax
+  800dde:	7f 08                	jg     800de8 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+  800deb:	50                   	push   %eax
+  800dec:	6a 05                	push   $0x5
+  800dee:	68 4b 41 80 00       	push   $0x80414b
+  800df3:	6a 23                	push   $0x23
+  800df5:	68 68 41 80 00       	push   $0x804168
+  800dfa:	e8 19 2a 00 00       	call   803818 <_panic>
+
+00800dff <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dff:	55                   	push   %ebp
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	57                   	push   %edi
+  800e03:	56                   	push   %esi
+  800e04:	53                   	push   %ebx
+  800e05:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e13:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e18:	89 df                	mov    %ebx,%edi
+  800e1a:	89 de                	mov    %ebx,%esi
+  800e1c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1e:	85 c0                	test   %eax,%eax
+  800e20:	7f 08                	jg     800e2a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e25:	5b                   	pop    %ebx
+  800e26:	5e                   	pop    %esi
+  800e27:	5f                   	pop    %edi
+  800e28:	5d                   	pop    %ebp
+  800e29:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2a:	83 ec 0c             	sub    $0xc,%esp
+  800e2d:	50                   	push   %eax
+  800e2e:	6a 06                	push   $0x6
+  800e30:	68 4b 41 80 00       	push   $0x80414b
+  800e35:	6a 23                	push   $0x23
+  800e37:	68 68 41 80 00       	push   $0x804168
+  800e3c:	e8 d7 29 00 00       	call   803818 <_panic>
+
+00800e41 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	57                   	push   %edi
+  800e45:	56                   	push   %esi
+  800e46:	53                   	push   %ebx
+  800e47:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e55:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e5a:	89 df                	mov    %ebx,%edi
+  800e5c:	89 de                	mov    %ebx,%esi
+  800e5e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e60:	85 c0                	test   %eax,%eax
+  800e62:	7f 08                	jg     800e6c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e67:	5b                   	pop    %ebx
+  800e68:	5e                   	pop    %esi
+  800e69:	5f                   	pop    %edi
+  800e6a:	5d                   	pop    %ebp
+  800e6b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6c:	83 ec 0c             	sub    $0xc,%esp
+  800e6f:	50                   	push   %eax
+  800e70:	6a 08                	push   $0x8
+  800e72:	68 4b 41 80 00       	push   $0x80414b
+  800e77:	6a 23                	push   $0x23
+  800e79:	68 68 41 80 00       	push   $0x804168
+  800e7e:	e8 95 29 00 00       	call   803818 <_panic>
+
+00800e83 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e9c:	89 df                	mov    %ebx,%edi
+  800e9e:	89 de                	mov    %ebx,%esi
+  800ea0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 08                	jg     800eae <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	6a 09                	push   $0x9
+  800eb4:	68 4b 41 80 00       	push   $0x80414b
+  800eb9:	6a 23                	push   $0x23
+  800ebb:	68 68 41 80 00       	push   $0x804168
+  800ec0:	e8 53 29 00 00       	call   803818 <_panic>
+
+00800ec5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	89 de                	mov    %ebx,%esi
+  800ee2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	7f 08                	jg     800ef0 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	50                   	push   %eax
+  800ef4:	6a 0a                	push   $0xa
+  800ef6:	68 4b 41 80 00       	push   $0x80414b
+  800efb:	6a 23                	push   $0x23
+  800efd:	68 68 41 80 00       	push   $0x804168
+  800f02:	e8 11 29 00 00       	call   803818 <_panic>
+
+00800f07 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f18:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f20:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f23:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f25:	5b                   	pop    %ebx
+  800f26:	5e                   	pop    %esi
+  800f27:	5f                   	pop    %edi
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+
+00800f2a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+  800f30:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f40:	89 cb                	mov    %ecx,%ebx
+  800f42:	89 cf                	mov    %ecx,%edi
+  800f44:	89 ce                	mov    %ecx,%esi
+  800f46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	7f 08                	jg     800f54 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+  800f57:	50                   	push   %eax
+  800f58:	6a 0d                	push   $0xd
+  800f5a:	68 4b 41 80 00       	push   $0x80414b
+  800f5f:	6a 23                	push   $0x23
+  800f61:	68 68 41 80 00       	push   $0x804168
+  800f66:	e8 ad 28 00 00       	call   803818 <_panic>
+
+00800f6b <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f77:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f82:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f85:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fa5:	89 df                	mov    %ebx,%edi
+  800fa7:	89 de                	mov    %ebx,%esi
+  800fa9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fab:	85 c0                	test   %eax,%eax
+  800fad:	7f 08                	jg     800fb7 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb2:	5b                   	pop    %ebx
+  800fb3:	5e                   	pop    %esi
+  800fb4:	5f                   	pop    %edi
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+  800fba:	50                   	push   %eax
+  800fbb:	6a 0d                	push   $0xd
+  800fbd:	68 4b 41 80 00       	push   $0x80414b
+  800fc2:	6a 23                	push   $0x23
+  800fc4:	68 68 41 80 00       	push   $0x804168
+  800fc9:	e8 4a 28 00 00       	call   803818 <_panic>
+
+00800fce <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fde:	89 d1                	mov    %edx,%ecx
+  800fe0:	89 d3                	mov    %edx,%ebx
+  800fe2:	89 d7                	mov    %edx,%edi
+  800fe4:	89 d6                	mov    %edx,%esi
+  800fe6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+
+00800fed <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	57                   	push   %edi
+  800ff1:	56                   	push   %esi
+  800ff2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffe:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801003:	89 df                	mov    %ebx,%edi
+  801005:	89 de                	mov    %ebx,%esi
+  801007:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+
+0080100e <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	57                   	push   %edi
+  801012:	56                   	push   %esi
+  801013:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801014:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801021:	89 cb                	mov    %ecx,%ebx
+  801023:	89 cf                	mov    %ecx,%edi
+  801025:	89 ce                	mov    %ecx,%esi
+  801027:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801029:	5b                   	pop    %ebx
+  80102a:	5e                   	pop    %esi
+  80102b:	5f                   	pop    %edi
+  80102c:	5d                   	pop    %ebp
+  80102d:	c3                   	ret
+
+0080102e <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80102e:	55                   	push   %ebp
+  80102f:	89 e5                	mov    %esp,%ebp
+  801031:	57                   	push   %edi
+  801032:	56                   	push   %esi
+  801033:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801034:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801044:	89 df                	mov    %ebx,%edi
+  801046:	89 de                	mov    %ebx,%esi
+  801048:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+
+0080104f <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801060:	b8 12 00 00 00       	mov    $0x12,%eax
+  801065:	89 df                	mov    %ebx,%edi
+  801067:	89 de                	mov    %ebx,%esi
+  801069:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+
+00801070 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801070:	55                   	push   %ebp
+  801071:	89 e5                	mov    %esp,%ebp
+  801073:	57                   	push   %edi
+  801074:	56                   	push   %esi
+  801075:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801076:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80107b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801083:	89 cb                	mov    %ecx,%ebx
+  801085:	89 cf                	mov    %ecx,%edi
+  801087:	89 ce                	mov    %ecx,%esi
+  801089:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80108b:	5b                   	pop    %ebx
+  80108c:	5e                   	pop    %esi
+  80108d:	5f                   	pop    %edi
+  80108e:	5d                   	pop    %ebp
+  80108f:	c3                   	ret
+
+00801090 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	57                   	push   %edi
+  801094:	56                   	push   %esi
+  801095:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801096:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010a6:	89 df                	mov    %ebx,%edi
+  8010a8:	89 de                	mov    %ebx,%esi
+  8010aa:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8010ac:	5b                   	pop    %ebx
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010c4:	89 cb                	mov    %ecx,%ebx
+  8010c6:	89 cf                	mov    %ecx,%edi
+  8010c8:	89 ce                	mov    %ecx,%esi
+  8010ca:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8010cc:	5b                   	pop    %ebx
+  8010cd:	5e                   	pop    %esi
+  8010ce:	5f                   	pop    %edi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+
+008010d1 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	57                   	push   %edi
+  8010d5:	56                   	push   %esi
+  8010d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ea:	89 f7                	mov    %esi,%edi
+  8010ec:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8010ee:	5b                   	pop    %ebx
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+
+008010f3 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	b8 17 00 00 00       	mov    $0x17,%eax
+  801109:	89 df                	mov    %ebx,%edi
+  80110b:	89 de                	mov    %ebx,%esi
+  80110d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+
+00801114 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	57                   	push   %edi
+  801118:	56                   	push   %esi
+  801119:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	b8 18 00 00 00       	mov    $0x18,%eax
+  801127:	89 cb                	mov    %ecx,%ebx
+  801129:	89 cf                	mov    %ecx,%edi
+  80112b:	89 ce                	mov    %ecx,%esi
+  80112d:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80112f:	5b                   	pop    %ebx
+  801130:	5e                   	pop    %esi
+  801131:	5f                   	pop    %edi
+  801132:	5d                   	pop    %ebp
+  801133:	c3                   	ret
+
+00801134 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801134:	55                   	push   %ebp
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	57                   	push   %edi
+  801138:	56                   	push   %esi
+  801139:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80113a:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80113e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801143:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801146:	b8 19 00 00 00       	mov    $0x19,%eax
+  80114b:	89 df                	mov    %ebx,%edi
+  80114d:	89 de                	mov    %ebx,%esi
+  80114f:	cd 30                	int    $0x30
+}
+  801151:	5b                   	pop    %ebx
+  801152:	5e                   	pop    %esi
+  801153:	5f                   	pop    %edi
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+
+00801156 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	57                   	push   %edi
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115c:	be 00 00 00 00       	mov    $0x0,%esi
+  801161:	8b 55 08             	mov    0x8(%ebp),%edx
+  801164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801167:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80116c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116f:	89 f7                	mov    %esi,%edi
+  801171:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801173:	5b                   	pop    %ebx
+  801174:	5e                   	pop    %esi
+  801175:	5f                   	pop    %edi
+  801176:	5d                   	pop    %ebp
+  801177:	c3                   	ret
+
+00801178 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80117e:	be 00 00 00 00       	mov    $0x0,%esi
+  801183:	8b 55 08             	mov    0x8(%ebp),%edx
+  801186:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801189:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80118e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801191:	89 f7                	mov    %esi,%edi
+  801193:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8011b0:	89 df                	mov    %ebx,%edi
+  8011b2:	89 de                	mov    %ebx,%esi
+  8011b4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011b6:	5b                   	pop    %ebx
+  8011b7:	5e                   	pop    %esi
+  8011b8:	5f                   	pop    %edi
+  8011b9:	5d                   	pop    %ebp
+  8011ba:	c3                   	ret
+
+008011bb <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8011d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d4:	89 f7                	mov    %esi,%edi
+  8011d6:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+
+008011dd <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e6:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  8011e9:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  8011eb:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  8011ee:	83 3a 01             	cmpl   $0x1,(%edx)
+  8011f1:	7e 09                	jle    8011fc <argstart+0x1f>
+  8011f3:	ba d1 3d 80 00       	mov    $0x803dd1,%edx
+  8011f8:	85 c9                	test   %ecx,%ecx
+  8011fa:	75 05                	jne    801201 <argstart+0x24>
+  8011fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801201:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801204:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  80120b:	5d                   	pop    %ebp
+  80120c:	c3                   	ret
+
+0080120d <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  80120d:	55                   	push   %ebp
+  80120e:	89 e5                	mov    %esp,%ebp
+  801210:	53                   	push   %ebx
+  801211:	83 ec 04             	sub    $0x4,%esp
+  801214:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801217:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  80121e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801221:	85 c0                	test   %eax,%eax
+  801223:	74 74                	je     801299 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801225:	80 38 00             	cmpb   $0x0,(%eax)
+  801228:	75 48                	jne    801272 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  80122a:	8b 0b                	mov    (%ebx),%ecx
+  80122c:	83 39 01             	cmpl   $0x1,(%ecx)
+  80122f:	74 5a                	je     80128b <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801231:	8b 53 04             	mov    0x4(%ebx),%edx
+  801234:	8b 42 04             	mov    0x4(%edx),%eax
+  801237:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80123a:	75 4f                	jne    80128b <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  80123c:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801240:	74 49                	je     80128b <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801242:	83 c0 01             	add    $0x1,%eax
+  801245:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801248:	83 ec 04             	sub    $0x4,%esp
+  80124b:	8b 01                	mov    (%ecx),%eax
+  80124d:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801254:	50                   	push   %eax
+  801255:	8d 42 08             	lea    0x8(%edx),%eax
+  801258:	50                   	push   %eax
+  801259:	83 c2 04             	add    $0x4,%edx
+  80125c:	52                   	push   %edx
+  80125d:	e8 94 f8 ff ff       	call   800af6 <memmove>
+		(*args->argc)--;
+  801262:	8b 03                	mov    (%ebx),%eax
+  801264:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801267:	8b 43 08             	mov    0x8(%ebx),%eax
+  80126a:	83 c4 10             	add    $0x10,%esp
+  80126d:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801270:	74 13                	je     801285 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801272:	8b 43 08             	mov    0x8(%ebx),%eax
+  801275:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801278:	83 c0 01             	add    $0x1,%eax
+  80127b:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  80127e:	89 d0                	mov    %edx,%eax
+  801280:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801285:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801289:	75 e7                	jne    801272 <argnext+0x65>
+	args->curarg = 0;
+  80128b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801292:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801297:	eb e5                	jmp    80127e <argnext+0x71>
+		return -1;
+  801299:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80129e:	eb de                	jmp    80127e <argnext+0x71>
+
+008012a0 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8012a0:	55                   	push   %ebp
+  8012a1:	89 e5                	mov    %esp,%ebp
+  8012a3:	53                   	push   %ebx
+  8012a4:	83 ec 04             	sub    $0x4,%esp
+  8012a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  8012aa:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012ad:	85 c0                	test   %eax,%eax
+  8012af:	74 12                	je     8012c3 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  8012b1:	80 38 00             	cmpb   $0x0,(%eax)
+  8012b4:	74 12                	je     8012c8 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  8012b6:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  8012b9:	c7 43 08 d1 3d 80 00 	movl   $0x803dd1,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  8012c0:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8012c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c6:	c9                   	leave
+  8012c7:	c3                   	ret
+	} else if (*args->argc > 1) {
+  8012c8:	8b 13                	mov    (%ebx),%edx
+  8012ca:	83 3a 01             	cmpl   $0x1,(%edx)
+  8012cd:	7f 10                	jg     8012df <argnextvalue+0x3f>
+		args->argvalue = 0;
+  8012cf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  8012d6:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8012dd:	eb e1                	jmp    8012c0 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  8012df:	8b 43 04             	mov    0x4(%ebx),%eax
+  8012e2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8012e5:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8012e8:	83 ec 04             	sub    $0x4,%esp
+  8012eb:	8b 12                	mov    (%edx),%edx
+  8012ed:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8012f4:	52                   	push   %edx
+  8012f5:	8d 50 08             	lea    0x8(%eax),%edx
+  8012f8:	52                   	push   %edx
+  8012f9:	83 c0 04             	add    $0x4,%eax
+  8012fc:	50                   	push   %eax
+  8012fd:	e8 f4 f7 ff ff       	call   800af6 <memmove>
+		(*args->argc)--;
+  801302:	8b 03                	mov    (%ebx),%eax
+  801304:	83 28 01             	subl   $0x1,(%eax)
+  801307:	83 c4 10             	add    $0x10,%esp
+  80130a:	eb b4                	jmp    8012c0 <argnextvalue+0x20>
+
+0080130c <argvalue>:
+{
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	83 ec 08             	sub    $0x8,%esp
+  801312:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801315:	8b 42 0c             	mov    0xc(%edx),%eax
+  801318:	85 c0                	test   %eax,%eax
+  80131a:	74 02                	je     80131e <argvalue+0x12>
+}
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80131e:	83 ec 0c             	sub    $0xc,%esp
+  801321:	52                   	push   %edx
+  801322:	e8 79 ff ff ff       	call   8012a0 <argnextvalue>
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	eb f0                	jmp    80131c <argvalue+0x10>
+
+0080132c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80132f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801332:	05 00 00 00 30       	add    $0x30000000,%eax
+  801337:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+
+0080133c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80133f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801342:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801347:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80134c:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801351:	5d                   	pop    %ebp
+  801352:	c3                   	ret
+
+00801353 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80135b:	89 c2                	mov    %eax,%edx
+  80135d:	c1 ea 16             	shr    $0x16,%edx
+  801360:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801367:	f6 c2 01             	test   $0x1,%dl
+  80136a:	74 29                	je     801395 <fd_alloc+0x42>
+  80136c:	89 c2                	mov    %eax,%edx
+  80136e:	c1 ea 0c             	shr    $0xc,%edx
+  801371:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801378:	f6 c2 01             	test   $0x1,%dl
+  80137b:	74 18                	je     801395 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80137d:	05 00 10 00 00       	add    $0x1000,%eax
+  801382:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801387:	75 d2                	jne    80135b <fd_alloc+0x8>
+  801389:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80138e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801393:	eb 05                	jmp    80139a <fd_alloc+0x47>
+			return 0;
+  801395:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80139a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139d:	89 02                	mov    %eax,(%edx)
+}
+  80139f:	89 c8                	mov    %ecx,%eax
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+
+008013a3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013a9:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8013ae:	77 30                	ja     8013e0 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013b0:	c1 e0 0c             	shl    $0xc,%eax
+  8013b3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8013b8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013be:	f6 c2 01             	test   $0x1,%dl
+  8013c1:	74 24                	je     8013e7 <fd_lookup+0x44>
+  8013c3:	89 c2                	mov    %eax,%edx
+  8013c5:	c1 ea 0c             	shr    $0xc,%edx
+  8013c8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013cf:	f6 c2 01             	test   $0x1,%dl
+  8013d2:	74 1a                	je     8013ee <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+		return -E_INVAL;
+  8013e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e5:	eb f7                	jmp    8013de <fd_lookup+0x3b>
+		return -E_INVAL;
+  8013e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ec:	eb f0                	jmp    8013de <fd_lookup+0x3b>
+  8013ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f3:	eb e9                	jmp    8013de <fd_lookup+0x3b>
+
+008013f5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	53                   	push   %ebx
+  8013f9:	83 ec 04             	sub    $0x4,%esp
+  8013fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801404:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801409:	39 13                	cmp    %edx,(%ebx)
+  80140b:	74 54                	je     801461 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80140d:	83 c0 01             	add    $0x1,%eax
+  801410:	8b 1c 85 f4 41 80 00 	mov    0x8041f4(,%eax,4),%ebx
+  801417:	85 db                	test   %ebx,%ebx
+  801419:	75 ee                	jne    801409 <dev_lookup+0x14>
+  80141b:	89 e1                	mov    %esp,%ecx
+  80141d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801422:	29 c8                	sub    %ecx,%eax
+  801424:	89 c1                	mov    %eax,%ecx
+  801426:	c1 e9 0f             	shr    $0xf,%ecx
+  801429:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80142e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801433:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801436:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80143d:	8b 40 48             	mov    0x48(%eax),%eax
+  801440:	83 ec 04             	sub    $0x4,%esp
+  801443:	52                   	push   %edx
+  801444:	50                   	push   %eax
+  801445:	68 78 41 80 00       	push   $0x804178
+  80144a:	e8 00 ee ff ff       	call   80024f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80144f:	83 c4 10             	add    $0x10,%esp
+  801452:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801457:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80145a:	89 1a                	mov    %ebx,(%edx)
+}
+  80145c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80145f:	c9                   	leave
+  801460:	c3                   	ret
+			return 0;
+  801461:	b8 00 00 00 00       	mov    $0x0,%eax
+  801466:	eb ef                	jmp    801457 <dev_lookup+0x62>
+
+00801468 <fd_close>:
+{
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	57                   	push   %edi
+  80146c:	56                   	push   %esi
+  80146d:	53                   	push   %ebx
+  80146e:	83 ec 24             	sub    $0x24,%esp
+  801471:	8b 75 08             	mov    0x8(%ebp),%esi
+  801474:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801477:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80147a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80147b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801481:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801484:	50                   	push   %eax
+  801485:	e8 19 ff ff ff       	call   8013a3 <fd_lookup>
+  80148a:	89 c3                	mov    %eax,%ebx
+  80148c:	83 c4 10             	add    $0x10,%esp
+  80148f:	85 c0                	test   %eax,%eax
+  801491:	78 05                	js     801498 <fd_close+0x30>
+	    || fd != fd2)
+  801493:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801496:	74 0f                	je     8014a7 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801498:	85 ff                	test   %edi,%edi
+  80149a:	0f 44 df             	cmove  %edi,%ebx
+}
+  80149d:	89 d8                	mov    %ebx,%eax
+  80149f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a2:	5b                   	pop    %ebx
+  8014a3:	5e                   	pop    %esi
+  8014a4:	5f                   	pop    %edi
+  8014a5:	5d                   	pop    %ebp
+  8014a6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014a7:	83 ec 08             	sub    $0x8,%esp
+  8014aa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014ad:	50                   	push   %eax
+  8014ae:	ff 36                	push   (%esi)
+  8014b0:	e8 40 ff ff ff       	call   8013f5 <dev_lookup>
+  8014b5:	89 c3                	mov    %eax,%ebx
+  8014b7:	83 c4 10             	add    $0x10,%esp
+  8014ba:	85 c0                	test   %eax,%eax
+  8014bc:	78 1a                	js     8014d8 <fd_close+0x70>
+		if (dev->dev_close)
+  8014be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014c1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014c9:	85 c0                	test   %eax,%eax
+  8014cb:	74 0b                	je     8014d8 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8014cd:	83 ec 0c             	sub    $0xc,%esp
+  8014d0:	56                   	push   %esi
+  8014d1:	ff d0                	call   *%eax
+  8014d3:	89 c3                	mov    %eax,%ebx
+  8014d5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014d8:	83 ec 08             	sub    $0x8,%esp
+  8014db:	56                   	push   %esi
+  8014dc:	6a 00                	push   $0x0
+  8014de:	e8 1c f9 ff ff       	call   800dff <sys_page_unmap>
+	return r;
+  8014e3:	83 c4 10             	add    $0x10,%esp
+  8014e6:	eb b5                	jmp    80149d <fd_close+0x35>
+
+008014e8 <close>:
+
+int
+close(int fdnum)
+{
+  8014e8:	55                   	push   %ebp
+  8014e9:	89 e5                	mov    %esp,%ebp
+  8014eb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f1:	50                   	push   %eax
+  8014f2:	ff 75 08             	push   0x8(%ebp)
+  8014f5:	e8 a9 fe ff ff       	call   8013a3 <fd_lookup>
+  8014fa:	83 c4 10             	add    $0x10,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	79 02                	jns    801503 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801501:	c9                   	leave
+  801502:	c3                   	ret
+		return fd_close(fd, 1);
+  801503:	83 ec 08             	sub    $0x8,%esp
+  801506:	6a 01                	push   $0x1
+  801508:	ff 75 f4             	push   -0xc(%ebp)
+  80150b:	e8 58 ff ff ff       	call   801468 <fd_close>
+  801510:	83 c4 10             	add    $0x10,%esp
+  801513:	eb ec                	jmp    801501 <close+0x19>
+
+00801515 <close_all>:
+
+void
+close_all(void)
+{
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	53                   	push   %ebx
+  801519:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80151c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801521:	83 ec 0c             	sub    $0xc,%esp
+  801524:	53                   	push   %ebx
+  801525:	e8 be ff ff ff       	call   8014e8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80152a:	83 c3 01             	add    $0x1,%ebx
+  80152d:	83 c4 10             	add    $0x10,%esp
+  801530:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801536:	75 e9                	jne    801521 <close_all+0xc>
+}
+  801538:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80153b:	c9                   	leave
+  80153c:	c3                   	ret
+
+0080153d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80153d:	55                   	push   %ebp
+  80153e:	89 e5                	mov    %esp,%ebp
+  801540:	57                   	push   %edi
+  801541:	56                   	push   %esi
+  801542:	53                   	push   %ebx
+  801543:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801546:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801549:	50                   	push   %eax
+  80154a:	ff 75 08             	push   0x8(%ebp)
+  80154d:	e8 51 fe ff ff       	call   8013a3 <fd_lookup>
+  801552:	89 c3                	mov    %eax,%ebx
+  801554:	83 c4 10             	add    $0x10,%esp
+  801557:	85 c0                	test   %eax,%eax
+  801559:	78 7f                	js     8015da <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80155b:	83 ec 0c             	sub    $0xc,%esp
+  80155e:	ff 75 0c             	push   0xc(%ebp)
+  801561:	e8 82 ff ff ff       	call   8014e8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801566:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801569:	c1 e6 0c             	shl    $0xc,%esi
+  80156c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801572:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801575:	89 3c 24             	mov    %edi,(%esp)
+  801578:	e8 bf fd ff ff       	call   80133c <fd2data>
+  80157d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80157f:	89 34 24             	mov    %esi,(%esp)
+  801582:	e8 b5 fd ff ff       	call   80133c <fd2data>
+  801587:	83 c4 10             	add    $0x10,%esp
+  80158a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80158d:	89 d8                	mov    %ebx,%eax
+  80158f:	c1 e8 16             	shr    $0x16,%eax
+  801592:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801599:	a8 01                	test   $0x1,%al
+  80159b:	74 11                	je     8015ae <dup+0x71>
+  80159d:	89 d8                	mov    %ebx,%eax
+  80159f:	c1 e8 0c             	shr    $0xc,%eax
+  8015a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015a9:	f6 c2 01             	test   $0x1,%dl
+  8015ac:	75 36                	jne    8015e4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015ae:	89 f8                	mov    %edi,%eax
+  8015b0:	c1 e8 0c             	shr    $0xc,%eax
+  8015b3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ba:	83 ec 0c             	sub    $0xc,%esp
+  8015bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015c2:	50                   	push   %eax
+  8015c3:	56                   	push   %esi
+  8015c4:	6a 00                	push   $0x0
+  8015c6:	57                   	push   %edi
+  8015c7:	6a 00                	push   $0x0
+  8015c9:	e8 ef f7 ff ff       	call   800dbd <sys_page_map>
+  8015ce:	89 c3                	mov    %eax,%ebx
+  8015d0:	83 c4 20             	add    $0x20,%esp
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	78 33                	js     80160a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015da:	89 d8                	mov    %ebx,%eax
+  8015dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015df:	5b                   	pop    %ebx
+  8015e0:	5e                   	pop    %esi
+  8015e1:	5f                   	pop    %edi
+  8015e2:	5d                   	pop    %ebp
+  8015e3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f3:	50                   	push   %eax
+  8015f4:	ff 75 d4             	push   -0x2c(%ebp)
+  8015f7:	6a 00                	push   $0x0
+  8015f9:	53                   	push   %ebx
+  8015fa:	6a 00                	push   $0x0
+  8015fc:	e8 bc f7 ff ff       	call   800dbd <sys_page_map>
+  801601:	89 c3                	mov    %eax,%ebx
+  801603:	83 c4 20             	add    $0x20,%esp
+  801606:	85 c0                	test   %eax,%eax
+  801608:	79 a4                	jns    8015ae <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80160a:	83 ec 08             	sub    $0x8,%esp
+  80160d:	56                   	push   %esi
+  80160e:	6a 00                	push   $0x0
+  801610:	e8 ea f7 ff ff       	call   800dff <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801615:	83 c4 08             	add    $0x8,%esp
+  801618:	ff 75 d4             	push   -0x2c(%ebp)
+  80161b:	6a 00                	push   $0x0
+  80161d:	e8 dd f7 ff ff       	call   800dff <sys_page_unmap>
+	return r;
+  801622:	83 c4 10             	add    $0x10,%esp
+  801625:	eb b3                	jmp    8015da <dup+0x9d>
+
+00801627 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+  80162a:	56                   	push   %esi
+  80162b:	53                   	push   %ebx
+  80162c:	83 ec 18             	sub    $0x18,%esp
+  80162f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801632:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801635:	50                   	push   %eax
+  801636:	53                   	push   %ebx
+  801637:	e8 67 fd ff ff       	call   8013a3 <fd_lookup>
+  80163c:	83 c4 10             	add    $0x10,%esp
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	78 3c                	js     80167f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801643:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801646:	83 ec 08             	sub    $0x8,%esp
+  801649:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80164c:	50                   	push   %eax
+  80164d:	ff 36                	push   (%esi)
+  80164f:	e8 a1 fd ff ff       	call   8013f5 <dev_lookup>
+  801654:	83 c4 10             	add    $0x10,%esp
+  801657:	85 c0                	test   %eax,%eax
+  801659:	78 24                	js     80167f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80165b:	8b 46 08             	mov    0x8(%esi),%eax
+  80165e:	83 e0 03             	and    $0x3,%eax
+  801661:	83 f8 01             	cmp    $0x1,%eax
+  801664:	74 20                	je     801686 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801666:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801669:	8b 40 08             	mov    0x8(%eax),%eax
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	74 54                	je     8016c4 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801670:	83 ec 04             	sub    $0x4,%esp
+  801673:	ff 75 10             	push   0x10(%ebp)
+  801676:	ff 75 0c             	push   0xc(%ebp)
+  801679:	56                   	push   %esi
+  80167a:	ff d0                	call   *%eax
+  80167c:	83 c4 10             	add    $0x10,%esp
+}
+  80167f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801682:	5b                   	pop    %ebx
+  801683:	5e                   	pop    %esi
+  801684:	5d                   	pop    %ebp
+  801685:	c3                   	ret
+  801686:	89 e2                	mov    %esp,%edx
+  801688:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80168d:	29 d0                	sub    %edx,%eax
+  80168f:	89 c2                	mov    %eax,%edx
+  801691:	c1 ea 0f             	shr    $0xf,%edx
+  801694:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169e:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016a1:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8016a8:	8b 40 48             	mov    0x48(%eax),%eax
+  8016ab:	83 ec 04             	sub    $0x4,%esp
+  8016ae:	53                   	push   %ebx
+  8016af:	50                   	push   %eax
+  8016b0:	68 b9 41 80 00       	push   $0x8041b9
+  8016b5:	e8 95 eb ff ff       	call   80024f <cprintf>
+		return -E_INVAL;
+  8016ba:	83 c4 10             	add    $0x10,%esp
+  8016bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c2:	eb bb                	jmp    80167f <read+0x58>
+		return -E_NOT_SUPP;
+  8016c4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c9:	eb b4                	jmp    80167f <read+0x58>
+
+008016cb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	57                   	push   %edi
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+  8016d1:	83 ec 0c             	sub    $0xc,%esp
+  8016d4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8016d7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016da:	85 f6                	test   %esi,%esi
+  8016dc:	74 30                	je     80170e <readn+0x43>
+  8016de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e3:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016e8:	83 ec 04             	sub    $0x4,%esp
+  8016eb:	89 f2                	mov    %esi,%edx
+  8016ed:	29 c2                	sub    %eax,%edx
+  8016ef:	52                   	push   %edx
+  8016f0:	01 f8                	add    %edi,%eax
+  8016f2:	50                   	push   %eax
+  8016f3:	ff 75 08             	push   0x8(%ebp)
+  8016f6:	e8 2c ff ff ff       	call   801627 <read>
+		if (m < 0)
+  8016fb:	83 c4 10             	add    $0x10,%esp
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	78 15                	js     801717 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801702:	74 11                	je     801715 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801704:	01 c3                	add    %eax,%ebx
+  801706:	89 d8                	mov    %ebx,%eax
+  801708:	39 f3                	cmp    %esi,%ebx
+  80170a:	72 dc                	jb     8016e8 <readn+0x1d>
+  80170c:	eb 09                	jmp    801717 <readn+0x4c>
+  80170e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801713:	eb 02                	jmp    801717 <readn+0x4c>
+  801715:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171a:	5b                   	pop    %ebx
+  80171b:	5e                   	pop    %esi
+  80171c:	5f                   	pop    %edi
+  80171d:	5d                   	pop    %ebp
+  80171e:	c3                   	ret
+
+0080171f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80171f:	55                   	push   %ebp
+  801720:	89 e5                	mov    %esp,%ebp
+  801722:	56                   	push   %esi
+  801723:	53                   	push   %ebx
+  801724:	83 ec 18             	sub    $0x18,%esp
+  801727:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80172a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80172d:	50                   	push   %eax
+  80172e:	53                   	push   %ebx
+  80172f:	e8 6f fc ff ff       	call   8013a3 <fd_lookup>
+  801734:	83 c4 10             	add    $0x10,%esp
+  801737:	85 c0                	test   %eax,%eax
+  801739:	78 37                	js     801772 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80173b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80173e:	83 ec 08             	sub    $0x8,%esp
+  801741:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801744:	50                   	push   %eax
+  801745:	ff 36                	push   (%esi)
+  801747:	e8 a9 fc ff ff       	call   8013f5 <dev_lookup>
+  80174c:	83 c4 10             	add    $0x10,%esp
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	78 1f                	js     801772 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801753:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801757:	74 20                	je     801779 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801759:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80175c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	74 54                	je     8017b7 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801763:	83 ec 04             	sub    $0x4,%esp
+  801766:	ff 75 10             	push   0x10(%ebp)
+  801769:	ff 75 0c             	push   0xc(%ebp)
+  80176c:	56                   	push   %esi
+  80176d:	ff d0                	call   *%eax
+  80176f:	83 c4 10             	add    $0x10,%esp
+}
+  801772:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801775:	5b                   	pop    %ebx
+  801776:	5e                   	pop    %esi
+  801777:	5d                   	pop    %ebp
+  801778:	c3                   	ret
+  801779:	89 e2                	mov    %esp,%edx
+  80177b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801780:	29 d0                	sub    %edx,%eax
+  801782:	89 c2                	mov    %eax,%edx
+  801784:	c1 ea 0f             	shr    $0xf,%edx
+  801787:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80178c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801791:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801794:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80179b:	8b 40 48             	mov    0x48(%eax),%eax
+  80179e:	83 ec 04             	sub    $0x4,%esp
+  8017a1:	53                   	push   %ebx
+  8017a2:	50                   	push   %eax
+  8017a3:	68 d5 41 80 00       	push   $0x8041d5
+  8017a8:	e8 a2 ea ff ff       	call   80024f <cprintf>
+		return -E_INVAL;
+  8017ad:	83 c4 10             	add    $0x10,%esp
+  8017b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b5:	eb bb                	jmp    801772 <write+0x53>
+		return -E_NOT_SUPP;
+  8017b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017bc:	eb b4                	jmp    801772 <write+0x53>
+
+008017be <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017be:	55                   	push   %ebp
+  8017bf:	89 e5                	mov    %esp,%ebp
+  8017c1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c7:	50                   	push   %eax
+  8017c8:	ff 75 08             	push   0x8(%ebp)
+  8017cb:	e8 d3 fb ff ff       	call   8013a3 <fd_lookup>
+  8017d0:	83 c4 10             	add    $0x10,%esp
+  8017d3:	85 c0                	test   %eax,%eax
+  8017d5:	78 0e                	js     8017e5 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017dd:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+
+008017e7 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	53                   	push   %ebx
+  8017eb:	83 ec 1c             	sub    $0x1c,%esp
+  8017ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f4:	50                   	push   %eax
+  8017f5:	ff 75 08             	push   0x8(%ebp)
+  8017f8:	e8 a6 fb ff ff       	call   8013a3 <fd_lookup>
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	78 33                	js     801837 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801804:	83 fb 03             	cmp    $0x3,%ebx
+  801807:	74 28                	je     801831 <fcntl+0x4a>
+  801809:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80180e:	83 fb 04             	cmp    $0x4,%ebx
+  801811:	75 24                	jne    801837 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801813:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801816:	8b 41 08             	mov    0x8(%ecx),%eax
+  801819:	80 e4 ef             	and    $0xef,%ah
+  80181c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80181f:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801825:	09 d0                	or     %edx,%eax
+  801827:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80182a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182f:	eb 06                	jmp    801837 <fcntl+0x50>
+		return fd->fd_omode;
+  801831:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801834:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+
+0080183c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80183c:	55                   	push   %ebp
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	56                   	push   %esi
+  801840:	53                   	push   %ebx
+  801841:	83 ec 18             	sub    $0x18,%esp
+  801844:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801847:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80184a:	50                   	push   %eax
+  80184b:	53                   	push   %ebx
+  80184c:	e8 52 fb ff ff       	call   8013a3 <fd_lookup>
+  801851:	83 c4 10             	add    $0x10,%esp
+  801854:	85 c0                	test   %eax,%eax
+  801856:	78 34                	js     80188c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801858:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80185b:	83 ec 08             	sub    $0x8,%esp
+  80185e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801861:	50                   	push   %eax
+  801862:	ff 36                	push   (%esi)
+  801864:	e8 8c fb ff ff       	call   8013f5 <dev_lookup>
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	85 c0                	test   %eax,%eax
+  80186e:	78 1c                	js     80188c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801870:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801874:	74 1d                	je     801893 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801879:	8b 40 18             	mov    0x18(%eax),%eax
+  80187c:	85 c0                	test   %eax,%eax
+  80187e:	74 51                	je     8018d1 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801880:	83 ec 08             	sub    $0x8,%esp
+  801883:	ff 75 0c             	push   0xc(%ebp)
+  801886:	56                   	push   %esi
+  801887:	ff d0                	call   *%eax
+  801889:	83 c4 10             	add    $0x10,%esp
+}
+  80188c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188f:	5b                   	pop    %ebx
+  801890:	5e                   	pop    %esi
+  801891:	5d                   	pop    %ebp
+  801892:	c3                   	ret
+  801893:	89 e2                	mov    %esp,%edx
+  801895:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80189a:	29 d0                	sub    %edx,%eax
+  80189c:	89 c2                	mov    %eax,%edx
+  80189e:	c1 ea 0f             	shr    $0xf,%edx
+  8018a1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ab:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8018ae:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8018b5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018b8:	83 ec 04             	sub    $0x4,%esp
+  8018bb:	53                   	push   %ebx
+  8018bc:	50                   	push   %eax
+  8018bd:	68 98 41 80 00       	push   $0x804198
+  8018c2:	e8 88 e9 ff ff       	call   80024f <cprintf>
+		return -E_INVAL;
+  8018c7:	83 c4 10             	add    $0x10,%esp
+  8018ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018cf:	eb bb                	jmp    80188c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018d6:	eb b4                	jmp    80188c <ftruncate+0x50>
+
+008018d8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	56                   	push   %esi
+  8018dc:	53                   	push   %ebx
+  8018dd:	83 ec 18             	sub    $0x18,%esp
+  8018e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e6:	50                   	push   %eax
+  8018e7:	ff 75 08             	push   0x8(%ebp)
+  8018ea:	e8 b4 fa ff ff       	call   8013a3 <fd_lookup>
+  8018ef:	83 c4 10             	add    $0x10,%esp
+  8018f2:	85 c0                	test   %eax,%eax
+  8018f4:	78 53                	js     801949 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018f6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018f9:	83 ec 08             	sub    $0x8,%esp
+  8018fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018ff:	50                   	push   %eax
+  801900:	ff 36                	push   (%esi)
+  801902:	e8 ee fa ff ff       	call   8013f5 <dev_lookup>
+  801907:	83 c4 10             	add    $0x10,%esp
+  80190a:	85 c0                	test   %eax,%eax
+  80190c:	78 3b                	js     801949 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80190e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801911:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801915:	74 39                	je     801950 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801917:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80191a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801921:	00 00 00 
+	stat->st_isdir = 0;
+  801924:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80192b:	00 00 00 
+	stat->st_version = 0;
+  80192e:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801935:	00 00 00 
+	stat->st_dev = dev;
+  801938:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80193e:	83 ec 08             	sub    $0x8,%esp
+  801941:	53                   	push   %ebx
+  801942:	56                   	push   %esi
+  801943:	ff 50 14             	call   *0x14(%eax)
+  801946:	83 c4 10             	add    $0x10,%esp
+}
+  801949:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80194c:	5b                   	pop    %ebx
+  80194d:	5e                   	pop    %esi
+  80194e:	5d                   	pop    %ebp
+  80194f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801950:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801955:	eb f2                	jmp    801949 <fstat+0x71>
+
+00801957 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	56                   	push   %esi
+  80195b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80195c:	83 ec 08             	sub    $0x8,%esp
+  80195f:	6a 00                	push   $0x0
+  801961:	ff 75 08             	push   0x8(%ebp)
+  801964:	e8 b7 01 00 00       	call   801b20 <open>
+  801969:	89 c3                	mov    %eax,%ebx
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 1b                	js     80198d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801972:	83 ec 08             	sub    $0x8,%esp
+  801975:	ff 75 0c             	push   0xc(%ebp)
+  801978:	50                   	push   %eax
+  801979:	e8 5a ff ff ff       	call   8018d8 <fstat>
+  80197e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801980:	89 1c 24             	mov    %ebx,(%esp)
+  801983:	e8 60 fb ff ff       	call   8014e8 <close>
+	return r;
+  801988:	83 c4 10             	add    $0x10,%esp
+  80198b:	89 f3                	mov    %esi,%ebx
+}
+  80198d:	89 d8                	mov    %ebx,%eax
+  80198f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801992:	5b                   	pop    %ebx
+  801993:	5e                   	pop    %esi
+  801994:	5d                   	pop    %ebp
+  801995:	c3                   	ret
+
+00801996 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	56                   	push   %esi
+  80199a:	53                   	push   %ebx
+  80199b:	89 c6                	mov    %eax,%esi
+  80199d:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80199f:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8019a6:	74 27                	je     8019cf <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019a8:	6a 07                	push   $0x7
+  8019aa:	68 00 70 80 00       	push   $0x807000
+  8019af:	56                   	push   %esi
+  8019b0:	ff 35 00 60 80 00    	push   0x806000
+  8019b6:	e8 33 21 00 00       	call   803aee <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8019bb:	83 c4 0c             	add    $0xc,%esp
+  8019be:	6a 00                	push   $0x0
+  8019c0:	53                   	push   %ebx
+  8019c1:	6a 00                	push   $0x0
+  8019c3:	e8 96 1e 00 00       	call   80385e <ipc_recv>
+}
+  8019c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019cb:	5b                   	pop    %ebx
+  8019cc:	5e                   	pop    %esi
+  8019cd:	5d                   	pop    %ebp
+  8019ce:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019cf:	83 ec 0c             	sub    $0xc,%esp
+  8019d2:	6a 02                	push   $0x2
+  8019d4:	e8 7e 21 00 00       	call   803b57 <ipc_find_env>
+  8019d9:	a3 00 60 80 00       	mov    %eax,0x806000
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	eb c5                	jmp    8019a8 <fsipc+0x12>
+
+008019e3 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ec:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ef:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8019f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f7:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a01:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a06:	e8 8b ff ff ff       	call   801996 <fsipc>
+}
+  801a0b:	c9                   	leave
+  801a0c:	c3                   	ret
+
+00801a0d <devfile_flush>:
+{
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a16:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a19:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801a1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a23:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a28:	e8 69 ff ff ff       	call   801996 <fsipc>
+}
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+
+00801a2f <devfile_stat>:
+{
+  801a2f:	55                   	push   %ebp
+  801a30:	89 e5                	mov    %esp,%ebp
+  801a32:	53                   	push   %ebx
+  801a33:	83 ec 04             	sub    $0x4,%esp
+  801a36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a3f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a44:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a49:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a4e:	e8 43 ff ff ff       	call   801996 <fsipc>
+  801a53:	85 c0                	test   %eax,%eax
+  801a55:	78 37                	js     801a8e <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a57:	83 ec 08             	sub    $0x8,%esp
+  801a5a:	68 00 70 80 00       	push   $0x807000
+  801a5f:	53                   	push   %ebx
+  801a60:	e8 e1 ee ff ff       	call   800946 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a65:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a6a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a70:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a75:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801a7b:	a1 88 70 80 00       	mov    0x807088,%eax
+  801a80:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801a86:	83 c4 10             	add    $0x10,%esp
+  801a89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a91:	c9                   	leave
+  801a92:	c3                   	ret
+
+00801a93 <devfile_write>:
+{
+  801a93:	55                   	push   %ebp
+  801a94:	89 e5                	mov    %esp,%ebp
+  801a96:	83 ec 0c             	sub    $0xc,%esp
+  801a99:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801a9c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801aa1:	39 d0                	cmp    %edx,%eax
+  801aa3:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801aa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa9:	8b 52 0c             	mov    0xc(%edx),%edx
+  801aac:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801ab2:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801ab7:	50                   	push   %eax
+  801ab8:	ff 75 0c             	push   0xc(%ebp)
+  801abb:	68 08 70 80 00       	push   $0x807008
+  801ac0:	e8 31 f0 ff ff       	call   800af6 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aca:	b8 04 00 00 00       	mov    $0x4,%eax
+  801acf:	e8 c2 fe ff ff       	call   801996 <fsipc>
+}
+  801ad4:	c9                   	leave
+  801ad5:	c3                   	ret
+
+00801ad6 <devfile_read>:
+{
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+  801ad9:	53                   	push   %ebx
+  801ada:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801add:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae3:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801ae8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801aeb:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801af0:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801af5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801afa:	e8 97 fe ff ff       	call   801996 <fsipc>
+  801aff:	89 c3                	mov    %eax,%ebx
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	78 14                	js     801b19 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801b05:	83 ec 04             	sub    $0x4,%esp
+  801b08:	50                   	push   %eax
+  801b09:	68 00 70 80 00       	push   $0x807000
+  801b0e:	ff 75 0c             	push   0xc(%ebp)
+  801b11:	e8 e0 ef ff ff       	call   800af6 <memmove>
+	return r;
+  801b16:	83 c4 10             	add    $0x10,%esp
+}
+  801b19:	89 d8                	mov    %ebx,%eax
+  801b1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1e:	c9                   	leave
+  801b1f:	c3                   	ret
+
+00801b20 <open>:
+{
+  801b20:	55                   	push   %ebp
+  801b21:	89 e5                	mov    %esp,%ebp
+  801b23:	53                   	push   %ebx
+  801b24:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801b27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b2a:	50                   	push   %eax
+  801b2b:	e8 23 f8 ff ff       	call   801353 <fd_alloc>
+  801b30:	89 c3                	mov    %eax,%ebx
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	78 2a                	js     801b63 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801b39:	83 ec 0c             	sub    $0xc,%esp
+  801b3c:	ff 75 08             	push   0x8(%ebp)
+  801b3f:	e8 b6 ed ff ff       	call   8008fa <strlen>
+  801b44:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801b47:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801b4c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b51:	7e 17                	jle    801b6a <open+0x4a>
+	fd_close(fd, 1);
+  801b53:	83 ec 08             	sub    $0x8,%esp
+  801b56:	6a 01                	push   $0x1
+  801b58:	ff 75 f4             	push   -0xc(%ebp)
+  801b5b:	e8 08 f9 ff ff       	call   801468 <fd_close>
+	return r;
+  801b60:	83 c4 10             	add    $0x10,%esp
+}
+  801b63:	89 d8                	mov    %ebx,%eax
+  801b65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b68:	c9                   	leave
+  801b69:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801b6a:	83 ec 08             	sub    $0x8,%esp
+  801b6d:	ff 75 08             	push   0x8(%ebp)
+  801b70:	68 00 70 80 00       	push   $0x807000
+  801b75:	e8 cc ed ff ff       	call   800946 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b7d:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801b82:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b85:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b8a:	e8 07 fe ff ff       	call   801996 <fsipc>
+  801b8f:	89 c3                	mov    %eax,%ebx
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	85 c0                	test   %eax,%eax
+  801b96:	78 bb                	js     801b53 <open+0x33>
+	return fd2num(fd); 	
+  801b98:	83 ec 0c             	sub    $0xc,%esp
+  801b9b:	ff 75 f4             	push   -0xc(%ebp)
+  801b9e:	e8 89 f7 ff ff       	call   80132c <fd2num>
+  801ba3:	89 c3                	mov    %eax,%ebx
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	eb b9                	jmp    801b63 <open+0x43>
+
+00801baa <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	53                   	push   %ebx
+  801bae:	83 ec 1c             	sub    $0x1c,%esp
+  801bb1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801bb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb7:	50                   	push   %eax
+  801bb8:	ff 75 08             	push   0x8(%ebp)
+  801bbb:	e8 e3 f7 ff ff       	call   8013a3 <fd_lookup>
+  801bc0:	83 c4 10             	add    $0x10,%esp
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 5a                	js     801c21 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801bc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bca:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801bd0:	39 10                	cmp    %edx,(%eax)
+  801bd2:	75 66                	jne    801c3a <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801bd4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801bdb:	74 49                	je     801c26 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801bdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801be3:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801be8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801beb:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801bf0:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bf6:	6a 07                	push   $0x7
+  801bf8:	68 00 70 80 00       	push   $0x807000
+  801bfd:	6a 09                	push   $0x9
+  801bff:	ff 35 00 60 80 00    	push   0x806000
+  801c05:	e8 e4 1e 00 00       	call   803aee <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801c0a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801c11:	6a 00                	push   $0x0
+  801c13:	53                   	push   %ebx
+  801c14:	ff 75 10             	push   0x10(%ebp)
+  801c17:	6a 00                	push   $0x0
+  801c19:	e8 0d 1d 00 00       	call   80392b <ipc_recv_pages>
+  801c1e:	83 c4 20             	add    $0x20,%esp
+}
+  801c21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c24:	c9                   	leave
+  801c25:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+  801c29:	6a 02                	push   $0x2
+  801c2b:	e8 27 1f 00 00       	call   803b57 <ipc_find_env>
+  801c30:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c35:	83 c4 10             	add    $0x10,%esp
+  801c38:	eb a3                	jmp    801bdd <fmap+0x33>
+		return -E_INVAL;
+  801c3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3f:	eb e0                	jmp    801c21 <fmap+0x77>
+
+00801c41 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c41:	55                   	push   %ebp
+  801c42:	89 e5                	mov    %esp,%ebp
+  801c44:	53                   	push   %ebx
+  801c45:	83 ec 10             	sub    $0x10,%esp
+  801c48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c4b:	53                   	push   %ebx
+  801c4c:	e8 a9 ec ff ff       	call   8008fa <strlen>
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c59:	7f 25                	jg     801c80 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+  801c5e:	53                   	push   %ebx
+  801c5f:	68 00 70 80 00       	push   $0x807000
+  801c64:	e8 dd ec ff ff       	call   800946 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c73:	e8 1e fd ff ff       	call   801996 <fsipc>
+  801c78:	83 c4 10             	add    $0x10,%esp
+}
+  801c7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c7e:	c9                   	leave
+  801c7f:	c3                   	ret
+		return -E_BAD_PATH;
+  801c80:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c85:	eb f4                	jmp    801c7b <remove+0x3a>
+
+00801c87 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c92:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c97:	e8 fa fc ff ff       	call   801996 <fsipc>
+}
+  801c9c:	c9                   	leave
+  801c9d:	c3                   	ret
+
+00801c9e <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801c9e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801ca2:	7f 01                	jg     801ca5 <writebuf+0x7>
+  801ca4:	c3                   	ret
+{
+  801ca5:	55                   	push   %ebp
+  801ca6:	89 e5                	mov    %esp,%ebp
+  801ca8:	53                   	push   %ebx
+  801ca9:	83 ec 08             	sub    $0x8,%esp
+  801cac:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801cae:	ff 70 04             	push   0x4(%eax)
+  801cb1:	8d 40 10             	lea    0x10(%eax),%eax
+  801cb4:	50                   	push   %eax
+  801cb5:	ff 33                	push   (%ebx)
+  801cb7:	e8 63 fa ff ff       	call   80171f <write>
+		if (result > 0)
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	7e 03                	jle    801cc6 <writebuf+0x28>
+			b->result += result;
+  801cc3:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801cc6:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801cc9:	74 0d                	je     801cd8 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd2:	0f 4f c2             	cmovg  %edx,%eax
+  801cd5:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801cd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cdb:	c9                   	leave
+  801cdc:	c3                   	ret
+
+00801cdd <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801cdd:	55                   	push   %ebp
+  801cde:	89 e5                	mov    %esp,%ebp
+  801ce0:	53                   	push   %ebx
+  801ce1:	83 ec 04             	sub    $0x4,%esp
+  801ce4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801ce7:	8b 53 04             	mov    0x4(%ebx),%edx
+  801cea:	8d 42 01             	lea    0x1(%edx),%eax
+  801ced:	89 43 04             	mov    %eax,0x4(%ebx)
+  801cf0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cf3:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801cf7:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801cfc:	74 05                	je     801d03 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801cfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d01:	c9                   	leave
+  801d02:	c3                   	ret
+		writebuf(b);
+  801d03:	89 d8                	mov    %ebx,%eax
+  801d05:	e8 94 ff ff ff       	call   801c9e <writebuf>
+		b->idx = 0;
+  801d0a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801d11:	eb eb                	jmp    801cfe <putch+0x21>
+
+00801d13 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801d13:	55                   	push   %ebp
+  801d14:	89 e5                	mov    %esp,%ebp
+  801d16:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1f:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801d25:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801d2c:	00 00 00 
+	b.result = 0;
+  801d2f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801d36:	00 00 00 
+	b.error = 1;
+  801d39:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801d40:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801d43:	ff 75 10             	push   0x10(%ebp)
+  801d46:	ff 75 0c             	push   0xc(%ebp)
+  801d49:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801d4f:	50                   	push   %eax
+  801d50:	68 dd 1c 80 00       	push   $0x801cdd
+  801d55:	e8 f4 e5 ff ff       	call   80034e <vprintfmt>
+	if (b.idx > 0)
+  801d5a:	83 c4 10             	add    $0x10,%esp
+  801d5d:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801d64:	7f 12                	jg     801d78 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801d66:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801d6c:	85 c0                	test   %eax,%eax
+  801d6e:	75 06                	jne    801d76 <vfprintf+0x63>
+  801d70:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801d76:	c9                   	leave
+  801d77:	c3                   	ret
+		writebuf(&b);
+  801d78:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801d7e:	e8 1b ff ff ff       	call   801c9e <writebuf>
+  801d83:	eb e1                	jmp    801d66 <vfprintf+0x53>
+
+00801d85 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801d8b:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801d8e:	50                   	push   %eax
+  801d8f:	ff 75 0c             	push   0xc(%ebp)
+  801d92:	ff 75 08             	push   0x8(%ebp)
+  801d95:	e8 79 ff ff ff       	call   801d13 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801d9a:	c9                   	leave
+  801d9b:	c3                   	ret
+
+00801d9c <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801d9c:	55                   	push   %ebp
+  801d9d:	89 e5                	mov    %esp,%ebp
+  801d9f:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801da2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801da5:	50                   	push   %eax
+  801da6:	ff 75 08             	push   0x8(%ebp)
+  801da9:	6a 01                	push   $0x1
+  801dab:	e8 63 ff ff ff       	call   801d13 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801db0:	c9                   	leave
+  801db1:	c3                   	ret
+
+00801db2 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801db2:	55                   	push   %ebp
+  801db3:	89 e5                	mov    %esp,%ebp
+  801db5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801db8:	68 08 42 80 00       	push   $0x804208
+  801dbd:	ff 75 0c             	push   0xc(%ebp)
+  801dc0:	e8 81 eb ff ff       	call   800946 <strcpy>
+	return 0;
+}
+  801dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dca:	c9                   	leave
+  801dcb:	c3                   	ret
+
+00801dcc <devsock_close>:
+{
+  801dcc:	55                   	push   %ebp
+  801dcd:	89 e5                	mov    %esp,%ebp
+  801dcf:	53                   	push   %ebx
+  801dd0:	83 ec 10             	sub    $0x10,%esp
+  801dd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801dd6:	53                   	push   %ebx
+  801dd7:	e8 ba 1d 00 00       	call   803b96 <pageref>
+  801ddc:	89 c2                	mov    %eax,%edx
+  801dde:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801de1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801de6:	83 fa 01             	cmp    $0x1,%edx
+  801de9:	74 05                	je     801df0 <devsock_close+0x24>
+}
+  801deb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801df0:	83 ec 0c             	sub    $0xc,%esp
+  801df3:	ff 73 0c             	push   0xc(%ebx)
+  801df6:	e8 b0 05 00 00       	call   8023ab <nsipc_close>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	eb eb                	jmp    801deb <devsock_close+0x1f>
+
+00801e00 <devsock_write>:
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	53                   	push   %ebx
+  801e04:	83 ec 14             	sub    $0x14,%esp
+  801e07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e0d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801e10:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801e13:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801e16:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e19:	c1 f8 09             	sar    $0x9,%eax
+  801e1c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801e1f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801e25:	77 13                	ja     801e3a <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801e27:	50                   	push   %eax
+  801e28:	52                   	push   %edx
+  801e29:	53                   	push   %ebx
+  801e2a:	ff 71 0c             	push   0xc(%ecx)
+  801e2d:	e8 5c 06 00 00       	call   80248e <nsipc_send>
+  801e32:	83 c4 10             	add    $0x10,%esp
+}
+  801e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e38:	c9                   	leave
+  801e39:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801e3a:	50                   	push   %eax
+  801e3b:	6a 01                	push   $0x1
+  801e3d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e40:	50                   	push   %eax
+  801e41:	ff 71 0c             	push   0xc(%ecx)
+  801e44:	e8 a6 06 00 00       	call   8024ef <nsipc_sendmsg>
+  801e49:	83 c4 10             	add    $0x10,%esp
+  801e4c:	eb e7                	jmp    801e35 <devsock_write+0x35>
+
+00801e4e <devsock_read>:
+{
+  801e4e:	55                   	push   %ebp
+  801e4f:	89 e5                	mov    %esp,%ebp
+  801e51:	53                   	push   %ebx
+  801e52:	83 ec 14             	sub    $0x14,%esp
+  801e55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e5b:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801e5e:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801e61:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801e64:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e67:	c1 f8 09             	sar    $0x9,%eax
+  801e6a:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801e6d:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801e73:	77 13                	ja     801e88 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801e75:	50                   	push   %eax
+  801e76:	52                   	push   %edx
+  801e77:	53                   	push   %ebx
+  801e78:	ff 71 0c             	push   0xc(%ecx)
+  801e7b:	e8 9c 05 00 00       	call   80241c <nsipc_recv>
+  801e80:	83 c4 10             	add    $0x10,%esp
+}
+  801e83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e86:	c9                   	leave
+  801e87:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801e88:	50                   	push   %eax
+  801e89:	6a 01                	push   $0x1
+  801e8b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e8e:	50                   	push   %eax
+  801e8f:	ff 71 0c             	push   0xc(%ecx)
+  801e92:	e8 02 0a 00 00       	call   802899 <nsipc_recvmsg>
+  801e97:	83 c4 10             	add    $0x10,%esp
+  801e9a:	eb e7                	jmp    801e83 <devsock_read+0x35>
+
+00801e9c <fd2sockid>:
+{
+  801e9c:	55                   	push   %ebp
+  801e9d:	89 e5                	mov    %esp,%ebp
+  801e9f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ea2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ea5:	52                   	push   %edx
+  801ea6:	50                   	push   %eax
+  801ea7:	e8 f7 f4 ff ff       	call   8013a3 <fd_lookup>
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	78 10                	js     801ec3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801eb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb6:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801ebc:	39 08                	cmp    %ecx,(%eax)
+  801ebe:	75 05                	jne    801ec5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ec0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ec3:	c9                   	leave
+  801ec4:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ec5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eca:	eb f7                	jmp    801ec3 <fd2sockid+0x27>
+
+00801ecc <sock_flags>:
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801ed2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ed5:	52                   	push   %edx
+  801ed6:	50                   	push   %eax
+  801ed7:	e8 c7 f4 ff ff       	call   8013a3 <fd_lookup>
+  801edc:	83 c4 10             	add    $0x10,%esp
+  801edf:	85 c0                	test   %eax,%eax
+  801ee1:	78 0e                	js     801ef1 <sock_flags+0x25>
+  801ee3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ee6:	8b 40 08             	mov    0x8(%eax),%eax
+  801ee9:	c1 e8 09             	shr    $0x9,%eax
+  801eec:	83 e0 08             	and    $0x8,%eax
+}
+  801eef:	c9                   	leave
+  801ef0:	c3                   	ret
+		return 0;
+  801ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef6:	eb f7                	jmp    801eef <sock_flags+0x23>
+
+00801ef8 <alloc_sockfd>:
+{
+  801ef8:	55                   	push   %ebp
+  801ef9:	89 e5                	mov    %esp,%ebp
+  801efb:	56                   	push   %esi
+  801efc:	53                   	push   %ebx
+  801efd:	83 ec 1c             	sub    $0x1c,%esp
+  801f00:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801f02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f05:	50                   	push   %eax
+  801f06:	e8 48 f4 ff ff       	call   801353 <fd_alloc>
+  801f0b:	89 c3                	mov    %eax,%ebx
+  801f0d:	83 c4 10             	add    $0x10,%esp
+  801f10:	85 c0                	test   %eax,%eax
+  801f12:	78 43                	js     801f57 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801f14:	83 ec 04             	sub    $0x4,%esp
+  801f17:	68 07 04 00 00       	push   $0x407
+  801f1c:	ff 75 f4             	push   -0xc(%ebp)
+  801f1f:	6a 00                	push   $0x0
+  801f21:	e8 54 ee ff ff       	call   800d7a <sys_page_alloc>
+  801f26:	89 c3                	mov    %eax,%ebx
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	78 28                	js     801f57 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801f2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f32:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801f38:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801f3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f3d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801f44:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801f47:	83 ec 0c             	sub    $0xc,%esp
+  801f4a:	50                   	push   %eax
+  801f4b:	e8 dc f3 ff ff       	call   80132c <fd2num>
+  801f50:	89 c3                	mov    %eax,%ebx
+  801f52:	83 c4 10             	add    $0x10,%esp
+  801f55:	eb 0c                	jmp    801f63 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801f57:	83 ec 0c             	sub    $0xc,%esp
+  801f5a:	56                   	push   %esi
+  801f5b:	e8 4b 04 00 00       	call   8023ab <nsipc_close>
+		return r;
+  801f60:	83 c4 10             	add    $0x10,%esp
+}
+  801f63:	89 d8                	mov    %ebx,%eax
+  801f65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f68:	5b                   	pop    %ebx
+  801f69:	5e                   	pop    %esi
+  801f6a:	5d                   	pop    %ebp
+  801f6b:	c3                   	ret
+
+00801f6c <accept>:
+{
+  801f6c:	55                   	push   %ebp
+  801f6d:	89 e5                	mov    %esp,%ebp
+  801f6f:	56                   	push   %esi
+  801f70:	53                   	push   %ebx
+  801f71:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f74:	89 f0                	mov    %esi,%eax
+  801f76:	e8 21 ff ff ff       	call   801e9c <fd2sockid>
+  801f7b:	89 c3                	mov    %eax,%ebx
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	78 24                	js     801fa5 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801f81:	89 f0                	mov    %esi,%eax
+  801f83:	e8 44 ff ff ff       	call   801ecc <sock_flags>
+  801f88:	50                   	push   %eax
+  801f89:	ff 75 10             	push   0x10(%ebp)
+  801f8c:	ff 75 0c             	push   0xc(%ebp)
+  801f8f:	53                   	push   %ebx
+  801f90:	e8 6b 03 00 00       	call   802300 <nsipc_accept>
+  801f95:	89 c3                	mov    %eax,%ebx
+  801f97:	83 c4 10             	add    $0x10,%esp
+  801f9a:	85 c0                	test   %eax,%eax
+  801f9c:	78 07                	js     801fa5 <accept+0x39>
+	return alloc_sockfd(r);
+  801f9e:	e8 55 ff ff ff       	call   801ef8 <alloc_sockfd>
+  801fa3:	89 c3                	mov    %eax,%ebx
+}
+  801fa5:	89 d8                	mov    %ebx,%eax
+  801fa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801faa:	5b                   	pop    %ebx
+  801fab:	5e                   	pop    %esi
+  801fac:	5d                   	pop    %ebp
+  801fad:	c3                   	ret
+
+00801fae <bind>:
+{
+  801fae:	55                   	push   %ebp
+  801faf:	89 e5                	mov    %esp,%ebp
+  801fb1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb7:	e8 e0 fe ff ff       	call   801e9c <fd2sockid>
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	78 12                	js     801fd2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801fc0:	83 ec 04             	sub    $0x4,%esp
+  801fc3:	ff 75 10             	push   0x10(%ebp)
+  801fc6:	ff 75 0c             	push   0xc(%ebp)
+  801fc9:	50                   	push   %eax
+  801fca:	e8 85 03 00 00       	call   802354 <nsipc_bind>
+  801fcf:	83 c4 10             	add    $0x10,%esp
+}
+  801fd2:	c9                   	leave
+  801fd3:	c3                   	ret
+
+00801fd4 <shutdown>:
+{
+  801fd4:	55                   	push   %ebp
+  801fd5:	89 e5                	mov    %esp,%ebp
+  801fd7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fdd:	e8 ba fe ff ff       	call   801e9c <fd2sockid>
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	78 0f                	js     801ff5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801fe6:	83 ec 08             	sub    $0x8,%esp
+  801fe9:	ff 75 0c             	push   0xc(%ebp)
+  801fec:	50                   	push   %eax
+  801fed:	e8 97 03 00 00       	call   802389 <nsipc_shutdown>
+  801ff2:	83 c4 10             	add    $0x10,%esp
+}
+  801ff5:	c9                   	leave
+  801ff6:	c3                   	ret
+
+00801ff7 <connect>:
+{
+  801ff7:	55                   	push   %ebp
+  801ff8:	89 e5                	mov    %esp,%ebp
+  801ffa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802000:	e8 97 fe ff ff       	call   801e9c <fd2sockid>
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 12                	js     80201b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802009:	83 ec 04             	sub    $0x4,%esp
+  80200c:	ff 75 10             	push   0x10(%ebp)
+  80200f:	ff 75 0c             	push   0xc(%ebp)
+  802012:	50                   	push   %eax
+  802013:	e8 ad 03 00 00       	call   8023c5 <nsipc_connect>
+  802018:	83 c4 10             	add    $0x10,%esp
+}
+  80201b:	c9                   	leave
+  80201c:	c3                   	ret
+
+0080201d <listen>:
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802023:	8b 45 08             	mov    0x8(%ebp),%eax
+  802026:	e8 71 fe ff ff       	call   801e9c <fd2sockid>
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	78 0f                	js     80203e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80202f:	83 ec 08             	sub    $0x8,%esp
+  802032:	ff 75 0c             	push   0xc(%ebp)
+  802035:	50                   	push   %eax
+  802036:	e8 bf 03 00 00       	call   8023fa <nsipc_listen>
+  80203b:	83 c4 10             	add    $0x10,%esp
+}
+  80203e:	c9                   	leave
+  80203f:	c3                   	ret
+
+00802040 <sendmsg>:
+{
+  802040:	55                   	push   %ebp
+  802041:	89 e5                	mov    %esp,%ebp
+  802043:	57                   	push   %edi
+  802044:	56                   	push   %esi
+  802045:	53                   	push   %ebx
+  802046:	83 ec 0c             	sub    $0xc,%esp
+  802049:	8b 75 08             	mov    0x8(%ebp),%esi
+  80204c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80204f:	89 f0                	mov    %esi,%eax
+  802051:	e8 46 fe ff ff       	call   801e9c <fd2sockid>
+  802056:	89 c3                	mov    %eax,%ebx
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 1c                	js     802078 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80205c:	89 f0                	mov    %esi,%eax
+  80205e:	e8 69 fe ff ff       	call   801ecc <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802063:	0b 45 10             	or     0x10(%ebp),%eax
+  802066:	50                   	push   %eax
+  802067:	ff 77 0c             	push   0xc(%edi)
+  80206a:	ff 77 08             	push   0x8(%edi)
+  80206d:	53                   	push   %ebx
+  80206e:	e8 7c 04 00 00       	call   8024ef <nsipc_sendmsg>
+  802073:	89 c3                	mov    %eax,%ebx
+  802075:	83 c4 10             	add    $0x10,%esp
+}
+  802078:	89 d8                	mov    %ebx,%eax
+  80207a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80207d:	5b                   	pop    %ebx
+  80207e:	5e                   	pop    %esi
+  80207f:	5f                   	pop    %edi
+  802080:	5d                   	pop    %ebp
+  802081:	c3                   	ret
+
+00802082 <recvmsg>:
+{
+  802082:	55                   	push   %ebp
+  802083:	89 e5                	mov    %esp,%ebp
+  802085:	57                   	push   %edi
+  802086:	56                   	push   %esi
+  802087:	53                   	push   %ebx
+  802088:	83 ec 0c             	sub    $0xc,%esp
+  80208b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80208e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802091:	89 f8                	mov    %edi,%eax
+  802093:	e8 04 fe ff ff       	call   801e9c <fd2sockid>
+  802098:	89 c3                	mov    %eax,%ebx
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 2a                	js     8020c8 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80209e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8020a5:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8020ac:	89 f8                	mov    %edi,%eax
+  8020ae:	e8 19 fe ff ff       	call   801ecc <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8020b3:	0b 45 10             	or     0x10(%ebp),%eax
+  8020b6:	50                   	push   %eax
+  8020b7:	ff 76 0c             	push   0xc(%esi)
+  8020ba:	ff 76 08             	push   0x8(%esi)
+  8020bd:	53                   	push   %ebx
+  8020be:	e8 d6 07 00 00       	call   802899 <nsipc_recvmsg>
+  8020c3:	89 c3                	mov    %eax,%ebx
+  8020c5:	83 c4 10             	add    $0x10,%esp
+}
+  8020c8:	89 d8                	mov    %ebx,%eax
+  8020ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020cd:	5b                   	pop    %ebx
+  8020ce:	5e                   	pop    %esi
+  8020cf:	5f                   	pop    %edi
+  8020d0:	5d                   	pop    %ebp
+  8020d1:	c3                   	ret
+
+008020d2 <sendfile>:
+{
+  8020d2:	55                   	push   %ebp
+  8020d3:	89 e5                	mov    %esp,%ebp
+  8020d5:	56                   	push   %esi
+  8020d6:	53                   	push   %ebx
+  8020d7:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8020da:	89 f0                	mov    %esi,%eax
+  8020dc:	e8 bb fd ff ff       	call   801e9c <fd2sockid>
+  8020e1:	89 c3                	mov    %eax,%ebx
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	78 1f                	js     802106 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8020e7:	89 f0                	mov    %esi,%eax
+  8020e9:	e8 de fd ff ff       	call   801ecc <sock_flags>
+  8020ee:	83 ec 0c             	sub    $0xc,%esp
+  8020f1:	50                   	push   %eax
+  8020f2:	ff 75 14             	push   0x14(%ebp)
+  8020f5:	ff 75 10             	push   0x10(%ebp)
+  8020f8:	ff 75 0c             	push   0xc(%ebp)
+  8020fb:	53                   	push   %ebx
+  8020fc:	e8 64 06 00 00       	call   802765 <nsipc_sendfile>
+  802101:	89 c3                	mov    %eax,%ebx
+  802103:	83 c4 20             	add    $0x20,%esp
+}
+  802106:	89 d8                	mov    %ebx,%eax
+  802108:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80210b:	5b                   	pop    %ebx
+  80210c:	5e                   	pop    %esi
+  80210d:	5d                   	pop    %ebp
+  80210e:	c3                   	ret
+
+0080210f <evctl>:
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	53                   	push   %ebx
+  802113:	83 ec 04             	sub    $0x4,%esp
+  802116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802119:	89 d8                	mov    %ebx,%eax
+  80211b:	e8 7c fd ff ff       	call   801e9c <fd2sockid>
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 10                	js     802134 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802124:	83 ec 04             	sub    $0x4,%esp
+  802127:	53                   	push   %ebx
+  802128:	ff 75 0c             	push   0xc(%ebp)
+  80212b:	50                   	push   %eax
+  80212c:	e8 d2 0b 00 00       	call   802d03 <nsipc_evctl>
+  802131:	83 c4 10             	add    $0x10,%esp
+}
+  802134:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802137:	c9                   	leave
+  802138:	c3                   	ret
+
+00802139 <evwait>:
+{
+  802139:	55                   	push   %ebp
+  80213a:	89 e5                	mov    %esp,%ebp
+  80213c:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80213f:	ff 75 10             	push   0x10(%ebp)
+  802142:	ff 75 0c             	push   0xc(%ebp)
+  802145:	ff 75 08             	push   0x8(%ebp)
+  802148:	e8 e0 0b 00 00       	call   802d2d <nsipc_evwait>
+}
+  80214d:	c9                   	leave
+  80214e:	c3                   	ret
+
+0080214f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802155:	ff 75 10             	push   0x10(%ebp)
+  802158:	ff 75 0c             	push   0xc(%ebp)
+  80215b:	ff 75 08             	push   0x8(%ebp)
+  80215e:	e8 31 0c 00 00       	call   802d94 <nsipc_socket>
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	85 c0                	test   %eax,%eax
+  802168:	78 05                	js     80216f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80216a:	e8 89 fd ff ff       	call   801ef8 <alloc_sockfd>
+}
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+
+00802171 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802171:	55                   	push   %ebp
+  802172:	89 e5                	mov    %esp,%ebp
+  802174:	53                   	push   %ebx
+  802175:	83 ec 04             	sub    $0x4,%esp
+  802178:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80217a:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802181:	74 26                	je     8021a9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802183:	6a 07                	push   $0x7
+  802185:	68 00 80 80 00       	push   $0x808000
+  80218a:	53                   	push   %ebx
+  80218b:	ff 35 24 63 80 00    	push   0x806324
+  802191:	e8 58 19 00 00       	call   803aee <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802196:	83 c4 0c             	add    $0xc,%esp
+  802199:	6a 00                	push   $0x0
+  80219b:	6a 00                	push   $0x0
+  80219d:	6a 00                	push   $0x0
+  80219f:	e8 ba 16 00 00       	call   80385e <ipc_recv>
+}
+  8021a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021a7:	c9                   	leave
+  8021a8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8021a9:	83 ec 0c             	sub    $0xc,%esp
+  8021ac:	6a 03                	push   $0x3
+  8021ae:	e8 a4 19 00 00       	call   803b57 <ipc_find_env>
+  8021b3:	a3 24 63 80 00       	mov    %eax,0x806324
+  8021b8:	83 c4 10             	add    $0x10,%esp
+  8021bb:	eb c6                	jmp    802183 <nsipc+0x12>
+
+008021bd <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8021bd:	55                   	push   %ebp
+  8021be:	89 e5                	mov    %esp,%ebp
+  8021c0:	56                   	push   %esi
+  8021c1:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8021c2:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  8021c8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8021cd:	85 f6                	test   %esi,%esi
+  8021cf:	75 33                	jne    802204 <nsbulk_map+0x47>
+  8021d1:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8021d6:	83 ec 04             	sub    $0x4,%esp
+  8021d9:	6a 07                	push   $0x7
+  8021db:	53                   	push   %ebx
+  8021dc:	6a 00                	push   $0x0
+  8021de:	e8 97 eb ff ff       	call   800d7a <sys_page_alloc>
+  8021e3:	83 c4 10             	add    $0x10,%esp
+  8021e6:	85 c0                	test   %eax,%eax
+  8021e8:	78 1a                	js     802204 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8021ea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021f0:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8021f6:	75 de                	jne    8021d6 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8021f8:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  8021ff:	00 00 00 
+	return 0;
+  802202:	89 f0                	mov    %esi,%eax
+}
+  802204:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802207:	5b                   	pop    %ebx
+  802208:	5e                   	pop    %esi
+  802209:	5d                   	pop    %ebp
+  80220a:	c3                   	ret
+
+0080220b <nsbulk_own>:
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	57                   	push   %edi
+  80220f:	56                   	push   %esi
+  802210:	53                   	push   %ebx
+  802211:	83 ec 0c             	sub    $0xc,%esp
+  802214:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802216:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802219:	85 d2                	test   %edx,%edx
+  80221b:	7f 0e                	jg     80222b <nsbulk_own+0x20>
+	return 0;
+  80221d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802222:	eb 47                	jmp    80226b <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802224:	83 c3 01             	add    $0x1,%ebx
+  802227:	39 fb                	cmp    %edi,%ebx
+  802229:	7d 3b                	jge    802266 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80222b:	be 01 00 00 00       	mov    $0x1,%esi
+  802230:	89 d9                	mov    %ebx,%ecx
+  802232:	d3 e6                	shl    %cl,%esi
+  802234:	89 f0                	mov    %esi,%eax
+  802236:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  80223c:	74 e6                	je     802224 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80223e:	83 ec 04             	sub    $0x4,%esp
+  802241:	6a 07                	push   $0x7
+  802243:	89 d8                	mov    %ebx,%eax
+  802245:	c1 e0 0c             	shl    $0xc,%eax
+  802248:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80224d:	50                   	push   %eax
+  80224e:	6a 00                	push   $0x0
+  802250:	e8 25 eb ff ff       	call   800d7a <sys_page_alloc>
+  802255:	83 c4 10             	add    $0x10,%esp
+  802258:	85 c0                	test   %eax,%eax
+  80225a:	78 0f                	js     80226b <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80225c:	f7 d6                	not    %esi
+  80225e:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  802264:	eb be                	jmp    802224 <nsbulk_own+0x19>
+	return 0;
+  802266:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80226b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226e:	5b                   	pop    %ebx
+  80226f:	5e                   	pop    %esi
+  802270:	5f                   	pop    %edi
+  802271:	5d                   	pop    %ebp
+  802272:	c3                   	ret
+
+00802273 <nsipc_bulk>:
+{
+  802273:	55                   	push   %ebp
+  802274:	89 e5                	mov    %esp,%ebp
+  802276:	57                   	push   %edi
+  802277:	56                   	push   %esi
+  802278:	53                   	push   %ebx
+  802279:	83 ec 1c             	sub    $0x1c,%esp
+  80227c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80227f:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802281:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802287:	c1 fb 0c             	sar    $0xc,%ebx
+  80228a:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80228d:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802294:	74 56                	je     8022ec <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802296:	85 ff                	test   %edi,%edi
+  802298:	7e 24                	jle    8022be <nsipc_bulk+0x4b>
+  80229a:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8022a0:	74 1c                	je     8022be <nsipc_bulk+0x4b>
+  8022a2:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8022a8:	c1 e3 0c             	shl    $0xc,%ebx
+  8022ab:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8022b0:	0f b6 10             	movzbl (%eax),%edx
+  8022b3:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8022b5:	05 00 10 00 00       	add    $0x1000,%eax
+  8022ba:	39 d8                	cmp    %ebx,%eax
+  8022bc:	75 f2                	jne    8022b0 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8022be:	83 ec 0c             	sub    $0xc,%esp
+  8022c1:	56                   	push   %esi
+  8022c2:	57                   	push   %edi
+  8022c3:	68 00 00 00 e0       	push   $0xe0000000
+  8022c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8022cb:	ff 35 24 63 80 00    	push   0x806324
+  8022d1:	e8 4c 18 00 00       	call   803b22 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8022d6:	83 c4 1c             	add    $0x1c,%esp
+  8022d9:	6a 00                	push   $0x0
+  8022db:	6a 00                	push   $0x0
+  8022dd:	6a 00                	push   $0x0
+  8022df:	e8 7a 15 00 00       	call   80385e <ipc_recv>
+}
+  8022e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e7:	5b                   	pop    %ebx
+  8022e8:	5e                   	pop    %esi
+  8022e9:	5f                   	pop    %edi
+  8022ea:	5d                   	pop    %ebp
+  8022eb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8022ec:	83 ec 0c             	sub    $0xc,%esp
+  8022ef:	6a 03                	push   $0x3
+  8022f1:	e8 61 18 00 00       	call   803b57 <ipc_find_env>
+  8022f6:	a3 24 63 80 00       	mov    %eax,0x806324
+  8022fb:	83 c4 10             	add    $0x10,%esp
+  8022fe:	eb 96                	jmp    802296 <nsipc_bulk+0x23>
+
+00802300 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802300:	55                   	push   %ebp
+  802301:	89 e5                	mov    %esp,%ebp
+  802303:	53                   	push   %ebx
+  802304:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802307:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  80230f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802312:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802317:	b8 01 00 00 00       	mov    $0x1,%eax
+  80231c:	e8 50 fe ff ff       	call   802171 <nsipc>
+  802321:	89 c3                	mov    %eax,%ebx
+  802323:	85 c0                	test   %eax,%eax
+  802325:	79 07                	jns    80232e <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802327:	89 d8                	mov    %ebx,%eax
+  802329:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80232e:	83 ec 04             	sub    $0x4,%esp
+  802331:	ff 35 10 80 80 00    	push   0x808010
+  802337:	68 00 80 80 00       	push   $0x808000
+  80233c:	ff 75 0c             	push   0xc(%ebp)
+  80233f:	e8 b2 e7 ff ff       	call   800af6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802344:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80234a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80234d:	89 10                	mov    %edx,(%eax)
+  80234f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802352:	eb d3                	jmp    802327 <nsipc_accept+0x27>
+
+00802354 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802354:	55                   	push   %ebp
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	53                   	push   %ebx
+  802358:	83 ec 08             	sub    $0x8,%esp
+  80235b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80235e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802361:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802366:	53                   	push   %ebx
+  802367:	ff 75 0c             	push   0xc(%ebp)
+  80236a:	68 04 80 80 00       	push   $0x808004
+  80236f:	e8 82 e7 ff ff       	call   800af6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802374:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80237a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80237f:	e8 ed fd ff ff       	call   802171 <nsipc>
+}
+  802384:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802387:	c9                   	leave
+  802388:	c3                   	ret
+
+00802389 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80238f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802392:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802397:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80239a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80239f:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023a4:	e8 c8 fd ff ff       	call   802171 <nsipc>
+}
+  8023a9:	c9                   	leave
+  8023aa:	c3                   	ret
+
+008023ab <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8023ab:	55                   	push   %ebp
+  8023ac:	89 e5                	mov    %esp,%ebp
+  8023ae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8023b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b4:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8023b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023be:	e8 ae fd ff ff       	call   802171 <nsipc>
+}
+  8023c3:	c9                   	leave
+  8023c4:	c3                   	ret
+
+008023c5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8023c5:	55                   	push   %ebp
+  8023c6:	89 e5                	mov    %esp,%ebp
+  8023c8:	53                   	push   %ebx
+  8023c9:	83 ec 08             	sub    $0x8,%esp
+  8023cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8023cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8023d7:	53                   	push   %ebx
+  8023d8:	ff 75 0c             	push   0xc(%ebp)
+  8023db:	68 04 80 80 00       	push   $0x808004
+  8023e0:	e8 11 e7 ff ff       	call   800af6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8023e5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8023eb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023f0:	e8 7c fd ff ff       	call   802171 <nsipc>
+}
+  8023f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f8:	c9                   	leave
+  8023f9:	c3                   	ret
+
+008023fa <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8023fa:	55                   	push   %ebp
+  8023fb:	89 e5                	mov    %esp,%ebp
+  8023fd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802400:	8b 45 08             	mov    0x8(%ebp),%eax
+  802403:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802408:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80240b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802410:	b8 06 00 00 00       	mov    $0x6,%eax
+  802415:	e8 57 fd ff ff       	call   802171 <nsipc>
+}
+  80241a:	c9                   	leave
+  80241b:	c3                   	ret
+
+0080241c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80241c:	55                   	push   %ebp
+  80241d:	89 e5                	mov    %esp,%ebp
+  80241f:	56                   	push   %esi
+  802420:	53                   	push   %ebx
+  802421:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802424:	8b 45 08             	mov    0x8(%ebp),%eax
+  802427:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80242c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802432:	8b 45 14             	mov    0x14(%ebp),%eax
+  802435:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80243a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80243f:	e8 2d fd ff ff       	call   802171 <nsipc>
+  802444:	89 c3                	mov    %eax,%ebx
+  802446:	85 c0                	test   %eax,%eax
+  802448:	78 22                	js     80246c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80244a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80244f:	39 c6                	cmp    %eax,%esi
+  802451:	0f 4e c6             	cmovle %esi,%eax
+  802454:	39 c3                	cmp    %eax,%ebx
+  802456:	7f 1d                	jg     802475 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802458:	83 ec 04             	sub    $0x4,%esp
+  80245b:	53                   	push   %ebx
+  80245c:	68 00 80 80 00       	push   $0x808000
+  802461:	ff 75 0c             	push   0xc(%ebp)
+  802464:	e8 8d e6 ff ff       	call   800af6 <memmove>
+  802469:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80246c:	89 d8                	mov    %ebx,%eax
+  80246e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802471:	5b                   	pop    %ebx
+  802472:	5e                   	pop    %esi
+  802473:	5d                   	pop    %ebp
+  802474:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802475:	68 14 42 80 00       	push   $0x804214
+  80247a:	68 29 42 80 00       	push   $0x804229
+  80247f:	68 b2 00 00 00       	push   $0xb2
+  802484:	68 3e 42 80 00       	push   $0x80423e
+  802489:	e8 8a 13 00 00       	call   803818 <_panic>
+
+0080248e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	53                   	push   %ebx
+  802492:	83 ec 04             	sub    $0x4,%esp
+  802495:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802498:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249b:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8024a0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8024a6:	7f 2e                	jg     8024d6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8024a8:	83 ec 04             	sub    $0x4,%esp
+  8024ab:	53                   	push   %ebx
+  8024ac:	ff 75 0c             	push   0xc(%ebp)
+  8024af:	68 0c 80 80 00       	push   $0x80800c
+  8024b4:	e8 3d e6 ff ff       	call   800af6 <memmove>
+	nsipcbuf.send.req_size = size;
+  8024b9:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8024bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024c2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8024c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024cc:	e8 a0 fc ff ff       	call   802171 <nsipc>
+}
+  8024d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024d4:	c9                   	leave
+  8024d5:	c3                   	ret
+	assert(size < 1600);
+  8024d6:	68 4a 42 80 00       	push   $0x80424a
+  8024db:	68 29 42 80 00       	push   $0x804229
+  8024e0:	68 bd 00 00 00       	push   $0xbd
+  8024e5:	68 3e 42 80 00       	push   $0x80423e
+  8024ea:	e8 29 13 00 00       	call   803818 <_panic>
+
+008024ef <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8024ef:	55                   	push   %ebp
+  8024f0:	89 e5                	mov    %esp,%ebp
+  8024f2:	57                   	push   %edi
+  8024f3:	56                   	push   %esi
+  8024f4:	53                   	push   %ebx
+  8024f5:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8024f8:	e8 c0 fc ff ff       	call   8021bd <nsbulk_map>
+  8024fd:	85 c0                	test   %eax,%eax
+  8024ff:	78 55                	js     802556 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802501:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802508:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  80250f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802516:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802519:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80251c:	0f 8d 24 02 00 00    	jge    802746 <nsipc_sendmsg+0x257>
+  802522:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802525:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802528:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80252b:	89 d8                	mov    %ebx,%eax
+  80252d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802532:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802534:	83 ec 0c             	sub    $0xc,%esp
+  802537:	68 20 60 80 00       	push   $0x806020
+  80253c:	e8 5a 0f 00 00       	call   80349b <pgbatch_init>
+  802541:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802544:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802546:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802549:	e9 82 00 00 00       	jmp    8025d0 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80254e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802551:	85 db                	test   %ebx,%ebx
+  802553:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802556:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802559:	5b                   	pop    %ebx
+  80255a:	5e                   	pop    %esi
+  80255b:	5f                   	pop    %edi
+  80255c:	5d                   	pop    %ebp
+  80255d:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80255e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802563:	29 c8                	sub    %ecx,%eax
+  802565:	39 d0                	cmp    %edx,%eax
+  802567:	0f 46 d0             	cmovbe %eax,%edx
+  80256a:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80256c:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802572:	85 ff                	test   %edi,%edi
+  802574:	0f 49 c7             	cmovns %edi,%eax
+  802577:	c1 f8 0c             	sar    $0xc,%eax
+  80257a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80257f:	e8 87 fc ff ff       	call   80220b <nsbulk_own>
+  802584:	85 c0                	test   %eax,%eax
+  802586:	0f 88 17 01 00 00    	js     8026a3 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80258c:	83 ec 04             	sub    $0x4,%esp
+  80258f:	56                   	push   %esi
+  802590:	ff 75 e0             	push   -0x20(%ebp)
+  802593:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802596:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80259b:	50                   	push   %eax
+  80259c:	e8 55 e5 ff ff       	call   800af6 <memmove>
+  8025a1:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8025a4:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8025a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025aa:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8025ad:	0f 84 fd 00 00 00    	je     8026b0 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8025b3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8025b6:	01 f7                	add    %esi,%edi
+  8025b8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025bb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8025be:	0f 8d 01 01 00 00    	jge    8026c5 <nsipc_sendmsg+0x1d6>
+  8025c4:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8025ca:	0f 8f f0 00 00 00    	jg     8026c0 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8025d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025d3:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8025d6:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8025d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025dc:	89 c2                	mov    %eax,%edx
+  8025de:	03 13                	add    (%ebx),%edx
+  8025e0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8025e3:	8b 73 04             	mov    0x4(%ebx),%esi
+  8025e6:	29 c6                	sub    %eax,%esi
+  8025e8:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8025ed:	29 f9                	sub    %edi,%ecx
+  8025ef:	39 ce                	cmp    %ecx,%esi
+  8025f1:	89 ca                	mov    %ecx,%edx
+  8025f3:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8025f6:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8025f9:	89 f9                	mov    %edi,%ecx
+  8025fb:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802601:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802604:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802609:	09 c8                	or     %ecx,%eax
+  80260b:	0f 85 4d ff ff ff    	jne    80255e <nsipc_sendmsg+0x6f>
+  802611:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802617:	0f 86 41 ff ff ff    	jbe    80255e <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80261d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802623:	85 ff                	test   %edi,%edi
+  802625:	0f 49 c7             	cmovns %edi,%eax
+  802628:	c1 f8 0c             	sar    $0xc,%eax
+  80262b:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80262d:	89 d1                	mov    %edx,%ecx
+  80262f:	c1 e9 0c             	shr    $0xc,%ecx
+  802632:	01 c8                	add    %ecx,%eax
+  802634:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802637:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80263a:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80263c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80263f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802644:	29 c8                	sub    %ecx,%eax
+  802646:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802649:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80264c:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80264e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802653:	89 f9                	mov    %edi,%ecx
+  802655:	d3 e0                	shl    %cl,%eax
+  802657:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80265d:	83 ec 08             	sub    $0x8,%esp
+  802660:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802662:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802665:	50                   	push   %eax
+  802666:	6a 00                	push   $0x0
+  802668:	56                   	push   %esi
+  802669:	6a 00                	push   $0x0
+  80266b:	68 20 60 80 00       	push   $0x806020
+  802670:	e8 e4 0e 00 00       	call   803559 <pgbatch_map>
+  802675:	83 c4 20             	add    $0x20,%esp
+  802678:	85 c0                	test   %eax,%eax
+  80267a:	0f 88 ce fe ff ff    	js     80254e <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802680:	83 c7 01             	add    $0x1,%edi
+  802683:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802689:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80268c:	39 c7                	cmp    %eax,%edi
+  80268e:	75 be                	jne    80264e <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802690:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802693:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802696:	89 d6                	mov    %edx,%esi
+  802698:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80269e:	e9 01 ff ff ff       	jmp    8025a4 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8026a3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026a6:	85 db                	test   %ebx,%ebx
+  8026a8:	0f 45 c3             	cmovne %ebx,%eax
+  8026ab:	e9 a6 fe ff ff       	jmp    802556 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8026b0:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8026b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8026bb:	e9 f3 fe ff ff       	jmp    8025b3 <nsipc_sendmsg+0xc4>
+  8026c0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8026c3:	eb 03                	jmp    8026c8 <nsipc_sendmsg+0x1d9>
+  8026c5:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8026c8:	83 ec 0c             	sub    $0xc,%esp
+  8026cb:	68 20 60 80 00       	push   $0x806020
+  8026d0:	e8 d4 0d 00 00       	call   8034a9 <pgbatch_flush>
+  8026d5:	83 c4 10             	add    $0x10,%esp
+  8026d8:	85 c0                	test   %eax,%eax
+  8026da:	78 50                	js     80272c <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8026dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026df:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8026e4:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8026ea:	89 fb                	mov    %edi,%ebx
+  8026ec:	29 f3                	sub    %esi,%ebx
+  8026ee:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8026f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026f7:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8026fc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802701:	89 fa                	mov    %edi,%edx
+  802703:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802708:	e8 66 fb ff ff       	call   802273 <nsipc_bulk>
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	78 28                	js     802739 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802711:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802714:	39 c3                	cmp    %eax,%ebx
+  802716:	75 0c                	jne    802724 <nsipc_sendmsg+0x235>
+  802718:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80271b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80271e:	0f 8f f2 fd ff ff    	jg     802516 <nsipc_sendmsg+0x27>
+		sent += r;
+  802724:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802727:	e9 2a fe ff ff       	jmp    802556 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80272c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80272f:	85 db                	test   %ebx,%ebx
+  802731:	0f 45 c3             	cmovne %ebx,%eax
+  802734:	e9 1d fe ff ff       	jmp    802556 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802739:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80273c:	85 db                	test   %ebx,%ebx
+  80273e:	0f 45 c3             	cmovne %ebx,%eax
+  802741:	e9 10 fe ff ff       	jmp    802556 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802746:	83 ec 0c             	sub    $0xc,%esp
+  802749:	68 20 60 80 00       	push   $0x806020
+  80274e:	e8 48 0d 00 00       	call   80349b <pgbatch_init>
+  802753:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802756:	be 00 00 00 00       	mov    $0x0,%esi
+  80275b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802760:	e9 63 ff ff ff       	jmp    8026c8 <nsipc_sendmsg+0x1d9>
+
+00802765 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802765:	55                   	push   %ebp
+  802766:	89 e5                	mov    %esp,%ebp
+  802768:	57                   	push   %edi
+  802769:	56                   	push   %esi
+  80276a:	53                   	push   %ebx
+  80276b:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80276e:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802775:	0f 84 c8 00 00 00    	je     802843 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80277b:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802782:	0f 84 e4 00 00 00    	je     80286c <nsipc_sendfile+0x107>
+{
+  802788:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80278d:	89 fb                	mov    %edi,%ebx
+  80278f:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802792:	0f 83 f0 00 00 00    	jae    802888 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802798:	89 fa                	mov    %edi,%edx
+  80279a:	03 55 10             	add    0x10(%ebp),%edx
+  80279d:	89 d0                	mov    %edx,%eax
+  80279f:	c1 f8 1f             	sar    $0x1f,%eax
+  8027a2:	c1 e8 14             	shr    $0x14,%eax
+  8027a5:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8027a8:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8027ae:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8027b0:	6a 10                	push   $0x10
+  8027b2:	68 00 20 01 e0       	push   $0xe0012000
+  8027b7:	52                   	push   %edx
+  8027b8:	ff 75 0c             	push   0xc(%ebp)
+  8027bb:	e8 ea f3 ff ff       	call   801baa <fmap>
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	0f 8e b8 00 00 00    	jle    802883 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8027cb:	39 c6                	cmp    %eax,%esi
+  8027cd:	0f 8d b5 00 00 00    	jge    802888 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8027d3:	29 f0                	sub    %esi,%eax
+  8027d5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027d8:	29 da                	sub    %ebx,%edx
+  8027da:	39 d0                	cmp    %edx,%eax
+  8027dc:	89 d3                	mov    %edx,%ebx
+  8027de:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8027e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e4:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8027e9:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8027ef:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8027f5:	8b 45 18             	mov    0x18(%ebp),%eax
+  8027f8:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8027fd:	83 ec 0c             	sub    $0xc,%esp
+  802800:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802802:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802809:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80280c:	83 c0 01             	add    $0x1,%eax
+  80280f:	50                   	push   %eax
+  802810:	68 00 10 01 e0       	push   $0xe0011000
+  802815:	6a 11                	push   $0x11
+  802817:	ff 35 24 63 80 00    	push   0x806324
+  80281d:	e8 00 13 00 00       	call   803b22 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802822:	83 c4 1c             	add    $0x1c,%esp
+  802825:	6a 00                	push   $0x0
+  802827:	6a 00                	push   $0x0
+  802829:	6a 00                	push   $0x0
+  80282b:	e8 2e 10 00 00       	call   80385e <ipc_recv>
+  802830:	83 c4 10             	add    $0x10,%esp
+  802833:	85 c0                	test   %eax,%eax
+  802835:	78 5b                	js     802892 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802837:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802839:	39 c3                	cmp    %eax,%ebx
+  80283b:	0f 8e 4c ff ff ff    	jle    80278d <nsipc_sendfile+0x28>
+  802841:	eb 45                	jmp    802888 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802843:	83 ec 04             	sub    $0x4,%esp
+  802846:	6a 07                	push   $0x7
+  802848:	68 00 10 01 e0       	push   $0xe0011000
+  80284d:	6a 00                	push   $0x0
+  80284f:	e8 26 e5 ff ff       	call   800d7a <sys_page_alloc>
+  802854:	89 c7                	mov    %eax,%edi
+  802856:	83 c4 10             	add    $0x10,%esp
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	78 2b                	js     802888 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80285d:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802864:	00 00 00 
+  802867:	e9 0f ff ff ff       	jmp    80277b <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80286c:	83 ec 0c             	sub    $0xc,%esp
+  80286f:	6a 03                	push   $0x3
+  802871:	e8 e1 12 00 00       	call   803b57 <ipc_find_env>
+  802876:	a3 24 63 80 00       	mov    %eax,0x806324
+  80287b:	83 c4 10             	add    $0x10,%esp
+  80287e:	e9 05 ff ff ff       	jmp    802788 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802883:	85 ff                	test   %edi,%edi
+  802885:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802888:	89 f8                	mov    %edi,%eax
+  80288a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288d:	5b                   	pop    %ebx
+  80288e:	5e                   	pop    %esi
+  80288f:	5f                   	pop    %edi
+  802890:	5d                   	pop    %ebp
+  802891:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802892:	85 ff                	test   %edi,%edi
+  802894:	0f 44 f8             	cmove  %eax,%edi
+  802897:	eb ef                	jmp    802888 <nsipc_sendfile+0x123>
+
+00802899 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802899:	55                   	push   %ebp
+  80289a:	89 e5                	mov    %esp,%ebp
+  80289c:	57                   	push   %edi
+  80289d:	56                   	push   %esi
+  80289e:	53                   	push   %ebx
+  80289f:	83 ec 1c             	sub    $0x1c,%esp
+  8028a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8028a5:	e8 13 f9 ff ff       	call   8021bd <nsbulk_map>
+  8028aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	0f 88 ba 00 00 00    	js     80296f <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8028b5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028b9:	0f 8e bb 00 00 00    	jle    80297a <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8028bf:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8028c4:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8028c9:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8028ce:	89 f8                	mov    %edi,%eax
+  8028d0:	29 f0                	sub    %esi,%eax
+  8028d2:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8028d6:	39 c8                	cmp    %ecx,%eax
+  8028d8:	0f 47 c1             	cmova  %ecx,%eax
+  8028db:	01 f0                	add    %esi,%eax
+  8028dd:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8028df:	83 c2 01             	add    $0x1,%edx
+  8028e2:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8028e5:	7e 07                	jle    8028ee <nsipc_recvmsg+0x55>
+  8028e7:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8028ec:	7e e0                	jle    8028ce <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8028ee:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8028f4:	c1 fa 0c             	sar    $0xc,%edx
+  8028f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fc:	e8 0a f9 ff ff       	call   80220b <nsbulk_own>
+  802901:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802904:	85 c0                	test   %eax,%eax
+  802906:	78 67                	js     80296f <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290b:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802910:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802916:	8b 45 14             	mov    0x14(%ebp),%eax
+  802919:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80291e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802923:	89 f2                	mov    %esi,%edx
+  802925:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80292a:	e8 44 f9 ff ff       	call   802273 <nsipc_bulk>
+  80292f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802932:	85 c0                	test   %eax,%eax
+  802934:	78 39                	js     80296f <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802936:	39 f0                	cmp    %esi,%eax
+  802938:	7f 4a                	jg     802984 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80293a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293f:	85 c0                	test   %eax,%eax
+  802941:	7e 2c                	jle    80296f <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802943:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802946:	29 fe                	sub    %edi,%esi
+  802948:	8b 43 04             	mov    0x4(%ebx),%eax
+  80294b:	39 c6                	cmp    %eax,%esi
+  80294d:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802950:	83 ec 04             	sub    $0x4,%esp
+  802953:	56                   	push   %esi
+  802954:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80295a:	50                   	push   %eax
+  80295b:	ff 33                	push   (%ebx)
+  80295d:	e8 94 e1 ff ff       	call   800af6 <memmove>
+		n += m;
+  802962:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802964:	83 c3 08             	add    $0x8,%ebx
+  802967:	83 c4 10             	add    $0x10,%esp
+  80296a:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80296d:	7f d4                	jg     802943 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80296f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802972:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802975:	5b                   	pop    %ebx
+  802976:	5e                   	pop    %esi
+  802977:	5f                   	pop    %edi
+  802978:	5d                   	pop    %ebp
+  802979:	c3                   	ret
+	int r, i, n, len = 0;
+  80297a:	be 00 00 00 00       	mov    $0x0,%esi
+  80297f:	e9 6a ff ff ff       	jmp    8028ee <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802984:	68 20 42 80 00       	push   $0x804220
+  802989:	68 29 42 80 00       	push   $0x804229
+  80298e:	68 3b 01 00 00       	push   $0x13b
+  802993:	68 3e 42 80 00       	push   $0x80423e
+  802998:	e8 7b 0e 00 00       	call   803818 <_panic>
+
+0080299d <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	57                   	push   %edi
+  8029a1:	56                   	push   %esi
+  8029a2:	53                   	push   %ebx
+  8029a3:	83 ec 0c             	sub    $0xc,%esp
+  8029a6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8029a9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8029ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8029af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8029b7:	8b 07                	mov    (%edi),%eax
+  8029b9:	a3 04 80 80 00       	mov    %eax,0x808004
+  8029be:	8b 47 04             	mov    0x4(%edi),%eax
+  8029c1:	a3 08 80 80 00       	mov    %eax,0x808008
+  8029c6:	8b 47 08             	mov    0x8(%edi),%eax
+  8029c9:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8029ce:	8b 47 0c             	mov    0xc(%edi),%eax
+  8029d1:	a3 10 80 80 00       	mov    %eax,0x808010
+  8029d6:	8b 47 10             	mov    0x10(%edi),%eax
+  8029d9:	a3 14 80 80 00       	mov    %eax,0x808014
+  8029de:	8b 47 14             	mov    0x14(%edi),%eax
+  8029e1:	a3 18 80 80 00       	mov    %eax,0x808018
+  8029e6:	8b 47 18             	mov    0x18(%edi),%eax
+  8029e9:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8029ee:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8029f1:	a3 20 80 80 00       	mov    %eax,0x808020
+  8029f6:	8b 47 20             	mov    0x20(%edi),%eax
+  8029f9:	a3 24 80 80 00       	mov    %eax,0x808024
+  8029fe:	8b 47 24             	mov    0x24(%edi),%eax
+  802a01:	a3 28 80 80 00       	mov    %eax,0x808028
+  802a06:	8b 47 28             	mov    0x28(%edi),%eax
+  802a09:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802a0e:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802a11:	a3 30 80 80 00       	mov    %eax,0x808030
+  802a16:	8b 47 30             	mov    0x30(%edi),%eax
+  802a19:	a3 34 80 80 00       	mov    %eax,0x808034
+  802a1e:	8b 47 34             	mov    0x34(%edi),%eax
+  802a21:	a3 38 80 80 00       	mov    %eax,0x808038
+  802a26:	8b 47 38             	mov    0x38(%edi),%eax
+  802a29:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802a2e:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802a31:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802a36:	8b 06                	mov    (%esi),%eax
+  802a38:	a3 44 80 80 00       	mov    %eax,0x808044
+  802a3d:	8b 46 04             	mov    0x4(%esi),%eax
+  802a40:	a3 48 80 80 00       	mov    %eax,0x808048
+  802a45:	8b 46 08             	mov    0x8(%esi),%eax
+  802a48:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802a4d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802a50:	a3 50 80 80 00       	mov    %eax,0x808050
+  802a55:	8b 46 10             	mov    0x10(%esi),%eax
+  802a58:	a3 54 80 80 00       	mov    %eax,0x808054
+  802a5d:	8b 46 14             	mov    0x14(%esi),%eax
+  802a60:	a3 58 80 80 00       	mov    %eax,0x808058
+  802a65:	8b 46 18             	mov    0x18(%esi),%eax
+  802a68:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802a6d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a70:	a3 60 80 80 00       	mov    %eax,0x808060
+  802a75:	8b 46 20             	mov    0x20(%esi),%eax
+  802a78:	a3 64 80 80 00       	mov    %eax,0x808064
+  802a7d:	8b 46 24             	mov    0x24(%esi),%eax
+  802a80:	a3 68 80 80 00       	mov    %eax,0x808068
+  802a85:	8b 46 28             	mov    0x28(%esi),%eax
+  802a88:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802a8d:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802a90:	a3 70 80 80 00       	mov    %eax,0x808070
+  802a95:	8b 46 30             	mov    0x30(%esi),%eax
+  802a98:	a3 74 80 80 00       	mov    %eax,0x808074
+  802a9d:	8b 46 34             	mov    0x34(%esi),%eax
+  802aa0:	a3 78 80 80 00       	mov    %eax,0x808078
+  802aa5:	8b 46 38             	mov    0x38(%esi),%eax
+  802aa8:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802aad:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802ab0:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802ab5:	8b 03                	mov    (%ebx),%eax
+  802ab7:	a3 84 80 80 00       	mov    %eax,0x808084
+  802abc:	8b 43 04             	mov    0x4(%ebx),%eax
+  802abf:	a3 88 80 80 00       	mov    %eax,0x808088
+  802ac4:	8b 43 08             	mov    0x8(%ebx),%eax
+  802ac7:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802acc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802acf:	a3 90 80 80 00       	mov    %eax,0x808090
+  802ad4:	8b 43 10             	mov    0x10(%ebx),%eax
+  802ad7:	a3 94 80 80 00       	mov    %eax,0x808094
+  802adc:	8b 43 14             	mov    0x14(%ebx),%eax
+  802adf:	a3 98 80 80 00       	mov    %eax,0x808098
+  802ae4:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ae7:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802aec:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802aef:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802af4:	8b 43 20             	mov    0x20(%ebx),%eax
+  802af7:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802afc:	8b 43 24             	mov    0x24(%ebx),%eax
+  802aff:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802b04:	8b 43 28             	mov    0x28(%ebx),%eax
+  802b07:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802b0c:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802b0f:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802b14:	8b 43 30             	mov    0x30(%ebx),%eax
+  802b17:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802b1c:	8b 43 34             	mov    0x34(%ebx),%eax
+  802b1f:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802b24:	8b 43 38             	mov    0x38(%ebx),%eax
+  802b27:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802b2c:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802b2f:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802b34:	8b 45 18             	mov    0x18(%ebp),%eax
+  802b37:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802b3c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802b41:	e8 2b f6 ff ff       	call   802171 <nsipc>
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	0f 88 ad 01 00 00    	js     802cfb <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802b4e:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802b54:	89 17                	mov    %edx,(%edi)
+  802b56:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802b5c:	89 57 04             	mov    %edx,0x4(%edi)
+  802b5f:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802b65:	89 57 08             	mov    %edx,0x8(%edi)
+  802b68:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b6e:	89 57 0c             	mov    %edx,0xc(%edi)
+  802b71:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802b77:	89 57 10             	mov    %edx,0x10(%edi)
+  802b7a:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802b80:	89 57 14             	mov    %edx,0x14(%edi)
+  802b83:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802b89:	89 57 18             	mov    %edx,0x18(%edi)
+  802b8c:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802b92:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802b95:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802b9b:	89 57 20             	mov    %edx,0x20(%edi)
+  802b9e:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802ba4:	89 57 24             	mov    %edx,0x24(%edi)
+  802ba7:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802bad:	89 57 28             	mov    %edx,0x28(%edi)
+  802bb0:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802bb6:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802bb9:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802bbf:	89 57 30             	mov    %edx,0x30(%edi)
+  802bc2:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802bc8:	89 57 34             	mov    %edx,0x34(%edi)
+  802bcb:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802bd1:	89 57 38             	mov    %edx,0x38(%edi)
+  802bd4:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802bda:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802bdd:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802be3:	89 16                	mov    %edx,(%esi)
+  802be5:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802beb:	89 56 04             	mov    %edx,0x4(%esi)
+  802bee:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802bf4:	89 56 08             	mov    %edx,0x8(%esi)
+  802bf7:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802bfd:	89 56 0c             	mov    %edx,0xc(%esi)
+  802c00:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802c06:	89 56 10             	mov    %edx,0x10(%esi)
+  802c09:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802c0f:	89 56 14             	mov    %edx,0x14(%esi)
+  802c12:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802c18:	89 56 18             	mov    %edx,0x18(%esi)
+  802c1b:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802c21:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802c24:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802c2a:	89 56 20             	mov    %edx,0x20(%esi)
+  802c2d:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802c33:	89 56 24             	mov    %edx,0x24(%esi)
+  802c36:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802c3c:	89 56 28             	mov    %edx,0x28(%esi)
+  802c3f:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802c45:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802c48:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802c4e:	89 56 30             	mov    %edx,0x30(%esi)
+  802c51:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802c57:	89 56 34             	mov    %edx,0x34(%esi)
+  802c5a:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802c60:	89 56 38             	mov    %edx,0x38(%esi)
+  802c63:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802c69:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802c6c:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802c72:	89 13                	mov    %edx,(%ebx)
+  802c74:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802c7a:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c7d:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802c83:	89 53 08             	mov    %edx,0x8(%ebx)
+  802c86:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802c8c:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802c8f:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802c95:	89 53 10             	mov    %edx,0x10(%ebx)
+  802c98:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802c9e:	89 53 14             	mov    %edx,0x14(%ebx)
+  802ca1:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802ca7:	89 53 18             	mov    %edx,0x18(%ebx)
+  802caa:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802cb0:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802cb3:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802cb9:	89 53 20             	mov    %edx,0x20(%ebx)
+  802cbc:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802cc2:	89 53 24             	mov    %edx,0x24(%ebx)
+  802cc5:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802ccb:	89 53 28             	mov    %edx,0x28(%ebx)
+  802cce:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802cd4:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802cd7:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802cdd:	89 53 30             	mov    %edx,0x30(%ebx)
+  802ce0:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802ce6:	89 53 34             	mov    %edx,0x34(%ebx)
+  802ce9:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802cef:	89 53 38             	mov    %edx,0x38(%ebx)
+  802cf2:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802cf8:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802cfb:	83 c4 0c             	add    $0xc,%esp
+  802cfe:	5b                   	pop    %ebx
+  802cff:	5e                   	pop    %esi
+  802d00:	5f                   	pop    %edi
+  802d01:	5d                   	pop    %ebp
+  802d02:	c3                   	ret
+
+00802d03 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802d03:	55                   	push   %ebp
+  802d04:	89 e5                	mov    %esp,%ebp
+  802d06:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d0c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802d11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d14:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802d19:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d1c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802d21:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802d26:	e8 46 f4 ff ff       	call   802171 <nsipc>
+}
+  802d2b:	c9                   	leave
+  802d2c:	c3                   	ret
+
+00802d2d <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802d2d:	55                   	push   %ebp
+  802d2e:	89 e5                	mov    %esp,%ebp
+  802d30:	56                   	push   %esi
+  802d31:	53                   	push   %ebx
+  802d32:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802d35:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802d3b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d3e:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802d43:	b8 10 00 00 00       	mov    $0x10,%eax
+  802d48:	e8 24 f4 ff ff       	call   802171 <nsipc>
+  802d4d:	89 c3                	mov    %eax,%ebx
+  802d4f:	85 c0                	test   %eax,%eax
+  802d51:	7e 1f                	jle    802d72 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802d53:	39 c6                	cmp    %eax,%esi
+  802d55:	7c 24                	jl     802d7b <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802d57:	83 ec 04             	sub    $0x4,%esp
+  802d5a:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802d61:	50                   	push   %eax
+  802d62:	68 00 80 80 00       	push   $0x808000
+  802d67:	ff 75 08             	push   0x8(%ebp)
+  802d6a:	e8 87 dd ff ff       	call   800af6 <memmove>
+  802d6f:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802d72:	89 d8                	mov    %ebx,%eax
+  802d74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d77:	5b                   	pop    %ebx
+  802d78:	5e                   	pop    %esi
+  802d79:	5d                   	pop    %ebp
+  802d7a:	c3                   	ret
+		assert(r <= max);
+  802d7b:	68 56 42 80 00       	push   $0x804256
+  802d80:	68 29 42 80 00       	push   $0x804229
+  802d85:	68 6a 01 00 00       	push   $0x16a
+  802d8a:	68 3e 42 80 00       	push   $0x80423e
+  802d8f:	e8 84 0a 00 00       	call   803818 <_panic>
+
+00802d94 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d94:	55                   	push   %ebp
+  802d95:	89 e5                	mov    %esp,%ebp
+  802d97:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802da2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802daa:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dad:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802db2:	b8 09 00 00 00       	mov    $0x9,%eax
+  802db7:	e8 b5 f3 ff ff       	call   802171 <nsipc>
+}
+  802dbc:	c9                   	leave
+  802dbd:	c3                   	ret
+
+00802dbe <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802dbe:	55                   	push   %ebp
+  802dbf:	89 e5                	mov    %esp,%ebp
+  802dc1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc7:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802dcc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802dd1:	e8 9b f3 ff ff       	call   802171 <nsipc>
+}
+  802dd6:	c9                   	leave
+  802dd7:	c3                   	ret
+
+00802dd8 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	53                   	push   %ebx
+  802ddc:	83 ec 04             	sub    $0x4,%esp
+  802ddf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802de2:	b8 12 00 00 00       	mov    $0x12,%eax
+  802de7:	e8 85 f3 ff ff       	call   802171 <nsipc>
+  802dec:	85 c0                	test   %eax,%eax
+  802dee:	78 50                	js     802e40 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802df0:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802df6:	89 13                	mov    %edx,(%ebx)
+  802df8:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802dfe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e01:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802e07:	89 53 08             	mov    %edx,0x8(%ebx)
+  802e0a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802e10:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802e13:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802e19:	89 53 10             	mov    %edx,0x10(%ebx)
+  802e1c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802e22:	89 53 14             	mov    %edx,0x14(%ebx)
+  802e25:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802e2b:	89 53 18             	mov    %edx,0x18(%ebx)
+  802e2e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802e34:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802e37:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802e3d:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802e40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e43:	c9                   	leave
+  802e44:	c3                   	ret
+
+00802e45 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802e45:	55                   	push   %ebp
+  802e46:	89 e5                	mov    %esp,%ebp
+  802e48:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e4b:	6a 03                	push   $0x3
+  802e4d:	e8 05 0d 00 00       	call   803b57 <ipc_find_env>
+  802e52:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802e57:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5a:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802e5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802e64:	e8 08 f3 ff ff       	call   802171 <nsipc>
+  802e69:	83 c4 10             	add    $0x10,%esp
+  802e6c:	85 c0                	test   %eax,%eax
+  802e6e:	78 0a                	js     802e7a <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802e70:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802e75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+
+00802e7c <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802e7c:	55                   	push   %ebp
+  802e7d:	89 e5                	mov    %esp,%ebp
+  802e7f:	57                   	push   %edi
+  802e80:	56                   	push   %esi
+  802e81:	53                   	push   %ebx
+  802e82:	83 ec 1c             	sub    $0x1c,%esp
+  802e85:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e88:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802e8b:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802e90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e95:	89 e0                	mov    %esp,%eax
+  802e97:	89 f2                	mov    %esi,%edx
+  802e99:	29 c2                	sub    %eax,%edx
+  802e9b:	89 d0                	mov    %edx,%eax
+  802e9d:	c1 e8 0f             	shr    $0xf,%eax
+  802ea0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802ea6:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802ea9:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802eb0:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802eb3:	83 ec 0c             	sub    $0xc,%esp
+  802eb6:	ff 75 e0             	push   -0x20(%ebp)
+  802eb9:	e8 d8 0c 00 00       	call   803b96 <pageref>
+  802ebe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ec1:	83 c4 04             	add    $0x4,%esp
+  802ec4:	ff 75 dc             	push   -0x24(%ebp)
+  802ec7:	e8 ca 0c 00 00       	call   803b96 <pageref>
+  802ecc:	89 e2                	mov    %esp,%edx
+  802ece:	89 f1                	mov    %esi,%ecx
+  802ed0:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802ed2:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802ed5:	89 ca                	mov    %ecx,%edx
+  802ed7:	c1 ea 0f             	shr    $0xf,%edx
+  802eda:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802ee0:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802ee3:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802eea:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802eed:	39 d7                	cmp    %edx,%edi
+  802eef:	74 40                	je     802f31 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802ef1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ef4:	75 9f                	jne    802e95 <_pipeisclosed+0x19>
+  802ef6:	89 e2                	mov    %esp,%edx
+  802ef8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802efd:	29 d0                	sub    %edx,%eax
+  802eff:	89 c2                	mov    %eax,%edx
+  802f01:	c1 ea 0f             	shr    $0xf,%edx
+  802f04:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0e:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f11:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802f18:	8b 40 58             	mov    0x58(%eax),%eax
+  802f1b:	6a 01                	push   $0x1
+  802f1d:	50                   	push   %eax
+  802f1e:	57                   	push   %edi
+  802f1f:	68 5f 42 80 00       	push   $0x80425f
+  802f24:	e8 26 d3 ff ff       	call   80024f <cprintf>
+  802f29:	83 c4 10             	add    $0x10,%esp
+  802f2c:	e9 5f ff ff ff       	jmp    802e90 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802f31:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f34:	0f 94 c0             	sete   %al
+  802f37:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f3d:	5b                   	pop    %ebx
+  802f3e:	5e                   	pop    %esi
+  802f3f:	5f                   	pop    %edi
+  802f40:	5d                   	pop    %ebp
+  802f41:	c3                   	ret
+
+00802f42 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f42:	55                   	push   %ebp
+  802f43:	89 e5                	mov    %esp,%ebp
+  802f45:	53                   	push   %ebx
+  802f46:	83 ec 0c             	sub    $0xc,%esp
+  802f49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f4c:	53                   	push   %ebx
+  802f4d:	6a 00                	push   $0x0
+  802f4f:	e8 ab de ff ff       	call   800dff <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f54:	89 1c 24             	mov    %ebx,(%esp)
+  802f57:	e8 e0 e3 ff ff       	call   80133c <fd2data>
+  802f5c:	83 c4 08             	add    $0x8,%esp
+  802f5f:	50                   	push   %eax
+  802f60:	6a 00                	push   $0x0
+  802f62:	e8 98 de ff ff       	call   800dff <sys_page_unmap>
+}
+  802f67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f6a:	c9                   	leave
+  802f6b:	c3                   	ret
+
+00802f6c <devpipe_read>:
+{
+  802f6c:	55                   	push   %ebp
+  802f6d:	89 e5                	mov    %esp,%ebp
+  802f6f:	57                   	push   %edi
+  802f70:	56                   	push   %esi
+  802f71:	53                   	push   %ebx
+  802f72:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802f75:	ff 75 08             	push   0x8(%ebp)
+  802f78:	e8 bf e3 ff ff       	call   80133c <fd2data>
+  802f7d:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f7f:	8b 70 04             	mov    0x4(%eax),%esi
+  802f82:	8b 00                	mov    (%eax),%eax
+  802f84:	83 c4 10             	add    $0x10,%esp
+  802f87:	39 f0                	cmp    %esi,%eax
+  802f89:	75 36                	jne    802fc1 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802f8b:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802f8e:	89 da                	mov    %ebx,%edx
+  802f90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f93:	e8 e4 fe ff ff       	call   802e7c <_pipeisclosed>
+  802f98:	85 c0                	test   %eax,%eax
+  802f9a:	0f 85 d4 00 00 00    	jne    803074 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802fa0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fa5:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802fa9:	83 ec 04             	sub    $0x4,%esp
+  802fac:	6a ff                	push   $0xffffffff
+  802fae:	56                   	push   %esi
+  802faf:	57                   	push   %edi
+  802fb0:	e8 c3 e1 ff ff       	call   801178 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802fb5:	8b 73 04             	mov    0x4(%ebx),%esi
+  802fb8:	8b 03                	mov    (%ebx),%eax
+  802fba:	83 c4 10             	add    $0x10,%esp
+  802fbd:	39 c6                	cmp    %eax,%esi
+  802fbf:	74 cd                	je     802f8e <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fc1:	8b 73 04             	mov    0x4(%ebx),%esi
+  802fc4:	8b 03                	mov    (%ebx),%eax
+  802fc6:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802fcc:	29 c6                	sub    %eax,%esi
+  802fce:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fd3:	f7 e6                	mul    %esi
+  802fd5:	c1 ea 0c             	shr    $0xc,%edx
+  802fd8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fde:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802fe0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802fe3:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802fe7:	8b 0b                	mov    (%ebx),%ecx
+  802fe9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fee:	f7 e1                	mul    %ecx
+  802ff0:	c1 ea 0b             	shr    $0xb,%edx
+  802ff3:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802ff9:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802ffb:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803000:	29 cf                	sub    %ecx,%edi
+  803002:	39 f7                	cmp    %esi,%edi
+  803004:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803007:	83 ec 04             	sub    $0x4,%esp
+  80300a:	57                   	push   %edi
+  80300b:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  80300f:	50                   	push   %eax
+  803010:	ff 75 0c             	push   0xc(%ebp)
+  803013:	e8 de da ff ff       	call   800af6 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803018:	83 c4 0c             	add    $0xc,%esp
+  80301b:	89 f0                	mov    %esi,%eax
+  80301d:	29 f8                	sub    %edi,%eax
+  80301f:	50                   	push   %eax
+  803020:	8d 43 10             	lea    0x10(%ebx),%eax
+  803023:	50                   	push   %eax
+  803024:	89 f8                	mov    %edi,%eax
+  803026:	03 45 0c             	add    0xc(%ebp),%eax
+  803029:	50                   	push   %eax
+  80302a:	e8 c7 da ff ff       	call   800af6 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80302f:	8b 0b                	mov    (%ebx),%ecx
+  803031:	01 f1                	add    %esi,%ecx
+  803033:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803038:	f7 e1                	mul    %ecx
+  80303a:	c1 ea 0c             	shr    $0xc,%edx
+  80303d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803043:	29 c1                	sub    %eax,%ecx
+  803045:	89 0b                	mov    %ecx,(%ebx)
+  803047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304c:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803050:	83 c4 10             	add    $0x10,%esp
+  803053:	85 c0                	test   %eax,%eax
+  803055:	75 0a                	jne    803061 <devpipe_read+0xf5>
+	return n;
+  803057:	89 f0                	mov    %esi,%eax
+}
+  803059:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80305c:	5b                   	pop    %ebx
+  80305d:	5e                   	pop    %esi
+  80305e:	5f                   	pop    %edi
+  80305f:	5d                   	pop    %ebp
+  803060:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803061:	83 ec 08             	sub    $0x8,%esp
+  803064:	68 00 04 00 00       	push   $0x400
+  803069:	53                   	push   %ebx
+  80306a:	e8 2b e1 ff ff       	call   80119a <sys_futex_wake>
+  80306f:	83 c4 10             	add    $0x10,%esp
+  803072:	eb e3                	jmp    803057 <devpipe_read+0xeb>
+			return 0;
+  803074:	b8 00 00 00 00       	mov    $0x0,%eax
+  803079:	eb de                	jmp    803059 <devpipe_read+0xed>
+
+0080307b <devpipe_write>:
+{
+  80307b:	55                   	push   %ebp
+  80307c:	89 e5                	mov    %esp,%ebp
+  80307e:	57                   	push   %edi
+  80307f:	56                   	push   %esi
+  803080:	53                   	push   %ebx
+  803081:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803084:	ff 75 08             	push   0x8(%ebp)
+  803087:	e8 b0 e2 ff ff       	call   80133c <fd2data>
+  80308c:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80308e:	83 c4 10             	add    $0x10,%esp
+  803091:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803098:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80309d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030a1:	0f 84 43 01 00 00    	je     8031ea <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030a7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030aa:	8b 06                	mov    (%esi),%eax
+  8030ac:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030b2:	29 c1                	sub    %eax,%ecx
+  8030b4:	89 c8                	mov    %ecx,%eax
+  8030b6:	f7 e7                	mul    %edi
+  8030b8:	c1 ea 0c             	shr    $0xc,%edx
+  8030bb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030c1:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8030c3:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8030c9:	75 52                	jne    80311d <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8030cb:	89 f2                	mov    %esi,%edx
+  8030cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d0:	e8 a7 fd ff ff       	call   802e7c <_pipeisclosed>
+  8030d5:	85 c0                	test   %eax,%eax
+  8030d7:	0f 85 28 01 00 00    	jne    803205 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8030dd:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030df:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030e2:	8b 06                	mov    (%esi),%eax
+  8030e4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030ea:	29 c1                	sub    %eax,%ecx
+  8030ec:	89 c8                	mov    %ecx,%eax
+  8030ee:	f7 e7                	mul    %edi
+  8030f0:	c1 ea 0c             	shr    $0xc,%edx
+  8030f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030f9:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8030fb:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803101:	75 a4                	jne    8030a7 <devpipe_write+0x2c>
+  803103:	b8 01 00 00 00       	mov    $0x1,%eax
+  803108:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80310c:	83 ec 04             	sub    $0x4,%esp
+  80310f:	6a ff                	push   $0xffffffff
+  803111:	53                   	push   %ebx
+  803112:	56                   	push   %esi
+  803113:	e8 60 e0 ff ff       	call   801178 <sys_futex_wait>
+}
+  803118:	83 c4 10             	add    $0x10,%esp
+  80311b:	eb 8a                	jmp    8030a7 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80311d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803120:	8b 06                	mov    (%esi),%eax
+  803122:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803128:	29 c1                	sub    %eax,%ecx
+  80312a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80312f:	f7 e1                	mul    %ecx
+  803131:	c1 ea 0c             	shr    $0xc,%edx
+  803134:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80313a:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80313c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803141:	89 d8                	mov    %ebx,%eax
+  803143:	29 c8                	sub    %ecx,%eax
+  803145:	8b 55 10             	mov    0x10(%ebp),%edx
+  803148:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80314b:	29 ca                	sub    %ecx,%edx
+  80314d:	39 d0                	cmp    %edx,%eax
+  80314f:	0f 46 d0             	cmovbe %eax,%edx
+  803152:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803155:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803158:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80315d:	f7 e1                	mul    %ecx
+  80315f:	c1 ea 0b             	shr    $0xb,%edx
+  803162:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803168:	89 ca                	mov    %ecx,%edx
+  80316a:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80316c:	29 d3                	sub    %edx,%ebx
+  80316e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803171:	39 c3                	cmp    %eax,%ebx
+  803173:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803176:	83 ec 04             	sub    $0x4,%esp
+  803179:	53                   	push   %ebx
+  80317a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80317d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803180:	51                   	push   %ecx
+  803181:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803185:	50                   	push   %eax
+  803186:	e8 6b d9 ff ff       	call   800af6 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80318b:	83 c4 0c             	add    $0xc,%esp
+  80318e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803191:	29 d8                	sub    %ebx,%eax
+  803193:	50                   	push   %eax
+  803194:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803197:	01 cb                	add    %ecx,%ebx
+  803199:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80319c:	53                   	push   %ebx
+  80319d:	8d 46 10             	lea    0x10(%esi),%eax
+  8031a0:	50                   	push   %eax
+  8031a1:	e8 50 d9 ff ff       	call   800af6 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8031a6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8031a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8031ac:	01 c1                	add    %eax,%ecx
+  8031ae:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031b3:	f7 e1                	mul    %ecx
+  8031b5:	c1 ea 0c             	shr    $0xc,%edx
+  8031b8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8031be:	89 ca                	mov    %ecx,%edx
+  8031c0:	29 c2                	sub    %eax,%edx
+  8031c2:	89 56 04             	mov    %edx,0x4(%esi)
+  8031c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ca:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8031ce:	83 c4 10             	add    $0x10,%esp
+  8031d1:	85 c0                	test   %eax,%eax
+  8031d3:	75 1a                	jne    8031ef <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8031d5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8031d8:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8031db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031de:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8031e1:	0f 82 c0 fe ff ff    	jb     8030a7 <devpipe_write+0x2c>
+  8031e7:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8031ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031ed:	eb 1b                	jmp    80320a <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8031ef:	83 ec 08             	sub    $0x8,%esp
+  8031f2:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8031f7:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8031fa:	50                   	push   %eax
+  8031fb:	e8 9a df ff ff       	call   80119a <sys_futex_wake>
+  803200:	83 c4 10             	add    $0x10,%esp
+  803203:	eb d0                	jmp    8031d5 <devpipe_write+0x15a>
+				return 0;
+  803205:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80320a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80320d:	5b                   	pop    %ebx
+  80320e:	5e                   	pop    %esi
+  80320f:	5f                   	pop    %edi
+  803210:	5d                   	pop    %ebp
+  803211:	c3                   	ret
+
+00803212 <devpipe_stat>:
+{
+  803212:	55                   	push   %ebp
+  803213:	89 e5                	mov    %esp,%ebp
+  803215:	56                   	push   %esi
+  803216:	53                   	push   %ebx
+  803217:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80321a:	83 ec 0c             	sub    $0xc,%esp
+  80321d:	ff 75 08             	push   0x8(%ebp)
+  803220:	e8 17 e1 ff ff       	call   80133c <fd2data>
+  803225:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803227:	83 c4 08             	add    $0x8,%esp
+  80322a:	68 72 42 80 00       	push   $0x804272
+  80322f:	53                   	push   %ebx
+  803230:	e8 11 d7 ff ff       	call   800946 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803235:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803238:	8b 06                	mov    (%esi),%eax
+  80323a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803240:	29 c1                	sub    %eax,%ecx
+  803242:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803247:	89 c8                	mov    %ecx,%eax
+  803249:	f7 e2                	mul    %edx
+  80324b:	c1 ea 0c             	shr    $0xc,%edx
+  80324e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803254:	29 d1                	sub    %edx,%ecx
+  803256:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80325c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803263:	00 00 00 
+	stat->st_dev = &devpipe;
+  803266:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80326d:	50 80 00 
+}
+  803270:	b8 00 00 00 00       	mov    $0x0,%eax
+  803275:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803278:	5b                   	pop    %ebx
+  803279:	5e                   	pop    %esi
+  80327a:	5d                   	pop    %ebp
+  80327b:	c3                   	ret
+
+0080327c <devpipe_poll>:
+{
+  80327c:	55                   	push   %ebp
+  80327d:	89 e5                	mov    %esp,%ebp
+  80327f:	57                   	push   %edi
+  803280:	56                   	push   %esi
+  803281:	53                   	push   %ebx
+  803282:	83 ec 18             	sub    $0x18,%esp
+  803285:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803288:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80328b:	57                   	push   %edi
+  80328c:	e8 ab e0 ff ff       	call   80133c <fd2data>
+  803291:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803293:	83 c4 10             	add    $0x10,%esp
+  803296:	89 f3                	mov    %esi,%ebx
+  803298:	83 e3 01             	and    $0x1,%ebx
+  80329b:	75 27                	jne    8032c4 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80329d:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8032a3:	75 48                	jne    8032ed <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8032a5:	89 ca                	mov    %ecx,%edx
+  8032a7:	89 f8                	mov    %edi,%eax
+  8032a9:	e8 ce fb ff ff       	call   802e7c <_pipeisclosed>
+  8032ae:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8032b0:	89 d8                	mov    %ebx,%eax
+  8032b2:	83 c8 10             	or     $0x10,%eax
+  8032b5:	85 d2                	test   %edx,%edx
+  8032b7:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8032ba:	89 d8                	mov    %ebx,%eax
+  8032bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032bf:	5b                   	pop    %ebx
+  8032c0:	5e                   	pop    %esi
+  8032c1:	5f                   	pop    %edi
+  8032c2:	5d                   	pop    %ebp
+  8032c3:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032c4:	8b 58 04             	mov    0x4(%eax),%ebx
+  8032c7:	8b 00                	mov    (%eax),%eax
+  8032c9:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8032cf:	29 c3                	sub    %eax,%ebx
+  8032d1:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8032d6:	89 d8                	mov    %ebx,%eax
+  8032d8:	f7 e2                	mul    %edx
+  8032da:	c1 ea 0c             	shr    $0xc,%edx
+  8032dd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8032e3:	39 d3                	cmp    %edx,%ebx
+  8032e5:	0f 95 c3             	setne  %bl
+  8032e8:	0f b6 db             	movzbl %bl,%ebx
+  8032eb:	eb b0                	jmp    80329d <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032ed:	8b 71 04             	mov    0x4(%ecx),%esi
+  8032f0:	8b 01                	mov    (%ecx),%eax
+  8032f2:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8032f8:	29 c6                	sub    %eax,%esi
+  8032fa:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8032ff:	89 f0                	mov    %esi,%eax
+  803301:	f7 e2                	mul    %edx
+  803303:	c1 ea 0c             	shr    $0xc,%edx
+  803306:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80330c:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80330e:	89 d8                	mov    %ebx,%eax
+  803310:	83 c8 04             	or     $0x4,%eax
+  803313:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803319:	0f 42 d8             	cmovb  %eax,%ebx
+  80331c:	eb 87                	jmp    8032a5 <devpipe_poll+0x29>
+
+0080331e <pipe>:
+{
+  80331e:	55                   	push   %ebp
+  80331f:	89 e5                	mov    %esp,%ebp
+  803321:	56                   	push   %esi
+  803322:	53                   	push   %ebx
+  803323:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803326:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803329:	50                   	push   %eax
+  80332a:	e8 24 e0 ff ff       	call   801353 <fd_alloc>
+  80332f:	89 c3                	mov    %eax,%ebx
+  803331:	83 c4 10             	add    $0x10,%esp
+  803334:	85 c0                	test   %eax,%eax
+  803336:	0f 88 23 01 00 00    	js     80345f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80333c:	83 ec 04             	sub    $0x4,%esp
+  80333f:	68 07 04 00 00       	push   $0x407
+  803344:	ff 75 f4             	push   -0xc(%ebp)
+  803347:	6a 00                	push   $0x0
+  803349:	e8 2c da ff ff       	call   800d7a <sys_page_alloc>
+  80334e:	89 c3                	mov    %eax,%ebx
+  803350:	83 c4 10             	add    $0x10,%esp
+  803353:	85 c0                	test   %eax,%eax
+  803355:	0f 88 04 01 00 00    	js     80345f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80335b:	83 ec 0c             	sub    $0xc,%esp
+  80335e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803361:	50                   	push   %eax
+  803362:	e8 ec df ff ff       	call   801353 <fd_alloc>
+  803367:	89 c3                	mov    %eax,%ebx
+  803369:	83 c4 10             	add    $0x10,%esp
+  80336c:	85 c0                	test   %eax,%eax
+  80336e:	0f 88 db 00 00 00    	js     80344f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803374:	83 ec 04             	sub    $0x4,%esp
+  803377:	68 07 04 00 00       	push   $0x407
+  80337c:	ff 75 f0             	push   -0x10(%ebp)
+  80337f:	6a 00                	push   $0x0
+  803381:	e8 f4 d9 ff ff       	call   800d7a <sys_page_alloc>
+  803386:	89 c3                	mov    %eax,%ebx
+  803388:	83 c4 10             	add    $0x10,%esp
+  80338b:	85 c0                	test   %eax,%eax
+  80338d:	0f 88 bc 00 00 00    	js     80344f <pipe+0x131>
+	va = fd2data(fd0);
+  803393:	83 ec 0c             	sub    $0xc,%esp
+  803396:	ff 75 f4             	push   -0xc(%ebp)
+  803399:	e8 9e df ff ff       	call   80133c <fd2data>
+  80339e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033a0:	83 c4 0c             	add    $0xc,%esp
+  8033a3:	68 07 04 00 00       	push   $0x407
+  8033a8:	50                   	push   %eax
+  8033a9:	6a 00                	push   $0x0
+  8033ab:	e8 ca d9 ff ff       	call   800d7a <sys_page_alloc>
+  8033b0:	89 c3                	mov    %eax,%ebx
+  8033b2:	83 c4 10             	add    $0x10,%esp
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	0f 88 82 00 00 00    	js     80343f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033bd:	83 ec 0c             	sub    $0xc,%esp
+  8033c0:	ff 75 f0             	push   -0x10(%ebp)
+  8033c3:	e8 74 df ff ff       	call   80133c <fd2data>
+  8033c8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8033cf:	50                   	push   %eax
+  8033d0:	6a 00                	push   $0x0
+  8033d2:	56                   	push   %esi
+  8033d3:	6a 00                	push   $0x0
+  8033d5:	e8 e3 d9 ff ff       	call   800dbd <sys_page_map>
+  8033da:	89 c3                	mov    %eax,%ebx
+  8033dc:	83 c4 20             	add    $0x20,%esp
+  8033df:	85 c0                	test   %eax,%eax
+  8033e1:	78 4e                	js     803431 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8033e3:	a1 60 50 80 00       	mov    0x805060,%eax
+  8033e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8033eb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8033ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8033f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8033f7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8033fa:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8033fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8033ff:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803406:	83 ec 0c             	sub    $0xc,%esp
+  803409:	ff 75 f4             	push   -0xc(%ebp)
+  80340c:	e8 1b df ff ff       	call   80132c <fd2num>
+  803411:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803414:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803416:	83 c4 04             	add    $0x4,%esp
+  803419:	ff 75 f0             	push   -0x10(%ebp)
+  80341c:	e8 0b df ff ff       	call   80132c <fd2num>
+  803421:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803424:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803427:	83 c4 10             	add    $0x10,%esp
+  80342a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80342f:	eb 2e                	jmp    80345f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803431:	83 ec 08             	sub    $0x8,%esp
+  803434:	56                   	push   %esi
+  803435:	6a 00                	push   $0x0
+  803437:	e8 c3 d9 ff ff       	call   800dff <sys_page_unmap>
+  80343c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80343f:	83 ec 08             	sub    $0x8,%esp
+  803442:	ff 75 f0             	push   -0x10(%ebp)
+  803445:	6a 00                	push   $0x0
+  803447:	e8 b3 d9 ff ff       	call   800dff <sys_page_unmap>
+  80344c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80344f:	83 ec 08             	sub    $0x8,%esp
+  803452:	ff 75 f4             	push   -0xc(%ebp)
+  803455:	6a 00                	push   $0x0
+  803457:	e8 a3 d9 ff ff       	call   800dff <sys_page_unmap>
+  80345c:	83 c4 10             	add    $0x10,%esp
+}
+  80345f:	89 d8                	mov    %ebx,%eax
+  803461:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803464:	5b                   	pop    %ebx
+  803465:	5e                   	pop    %esi
+  803466:	5d                   	pop    %ebp
+  803467:	c3                   	ret
+
+00803468 <pipeisclosed>:
+{
+  803468:	55                   	push   %ebp
+  803469:	89 e5                	mov    %esp,%ebp
+  80346b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80346e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803471:	50                   	push   %eax
+  803472:	ff 75 08             	push   0x8(%ebp)
+  803475:	e8 29 df ff ff       	call   8013a3 <fd_lookup>
+  80347a:	83 c4 10             	add    $0x10,%esp
+  80347d:	85 c0                	test   %eax,%eax
+  80347f:	78 18                	js     803499 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803481:	83 ec 0c             	sub    $0xc,%esp
+  803484:	ff 75 f4             	push   -0xc(%ebp)
+  803487:	e8 b0 de ff ff       	call   80133c <fd2data>
+  80348c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80348e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803491:	e8 e6 f9 ff ff       	call   802e7c <_pipeisclosed>
+  803496:	83 c4 10             	add    $0x10,%esp
+}
+  803499:	c9                   	leave
+  80349a:	c3                   	ret
+
+0080349b <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80349b:	55                   	push   %ebp
+  80349c:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80349e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8034a7:	5d                   	pop    %ebp
+  8034a8:	c3                   	ret
+
+008034a9 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8034a9:	55                   	push   %ebp
+  8034aa:	89 e5                	mov    %esp,%ebp
+  8034ac:	53                   	push   %ebx
+  8034ad:	83 ec 04             	sub    $0x4,%esp
+  8034b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8034b3:	8b 03                	mov    (%ebx),%eax
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	75 05                	jne    8034be <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8034b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034bc:	c9                   	leave
+  8034bd:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8034be:	83 ec 08             	sub    $0x8,%esp
+  8034c1:	50                   	push   %eax
+  8034c2:	8d 43 04             	lea    0x4(%ebx),%eax
+  8034c5:	50                   	push   %eax
+  8034c6:	e8 84 db ff ff       	call   80104f <sys_page_batch>
+	pb->pb_n = 0;
+  8034cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8034d1:	83 c4 10             	add    $0x10,%esp
+  8034d4:	eb e3                	jmp    8034b9 <pgbatch_flush+0x10>
+
+008034d6 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8034d6:	55                   	push   %ebp
+  8034d7:	89 e5                	mov    %esp,%ebp
+  8034d9:	56                   	push   %esi
+  8034da:	53                   	push   %ebx
+  8034db:	89 c3                	mov    %eax,%ebx
+  8034dd:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8034df:	83 38 20             	cmpl   $0x20,(%eax)
+  8034e2:	74 2c                	je     803510 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8034e4:	8b 03                	mov    (%ebx),%eax
+  8034e6:	8d 50 01             	lea    0x1(%eax),%edx
+  8034e9:	89 13                	mov    %edx,(%ebx)
+  8034eb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8034ee:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8034f2:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8034f4:	83 ec 04             	sub    $0x4,%esp
+  8034f7:	6a 18                	push   $0x18
+  8034f9:	6a 00                	push   $0x0
+  8034fb:	50                   	push   %eax
+  8034fc:	e8 c0 d5 ff ff       	call   800ac1 <memset>
+	return 0;
+  803501:	83 c4 10             	add    $0x10,%esp
+  803504:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803509:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80350c:	5b                   	pop    %ebx
+  80350d:	5e                   	pop    %esi
+  80350e:	5d                   	pop    %ebp
+  80350f:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803510:	83 ec 0c             	sub    $0xc,%esp
+  803513:	50                   	push   %eax
+  803514:	e8 90 ff ff ff       	call   8034a9 <pgbatch_flush>
+  803519:	83 c4 10             	add    $0x10,%esp
+  80351c:	85 c0                	test   %eax,%eax
+  80351e:	79 c4                	jns    8034e4 <pgbatch_slot+0xe>
+  803520:	eb e7                	jmp    803509 <pgbatch_slot+0x33>
+
+00803522 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803522:	55                   	push   %ebp
+  803523:	89 e5                	mov    %esp,%ebp
+  803525:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803528:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80352b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80352e:	e8 a3 ff ff ff       	call   8034d6 <pgbatch_slot>
+  803533:	85 c0                	test   %eax,%eax
+  803535:	78 20                	js     803557 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803537:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80353a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803540:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803543:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803546:	8b 55 10             	mov    0x10(%ebp),%edx
+  803549:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80354c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80354f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803552:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803557:	c9                   	leave
+  803558:	c3                   	ret
+
+00803559 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803559:	55                   	push   %ebp
+  80355a:	89 e5                	mov    %esp,%ebp
+  80355c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80355f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803562:	8b 45 08             	mov    0x8(%ebp),%eax
+  803565:	e8 6c ff ff ff       	call   8034d6 <pgbatch_slot>
+  80356a:	85 c0                	test   %eax,%eax
+  80356c:	78 2c                	js     80359a <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80356e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803571:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803577:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80357a:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80357d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803580:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803583:	8b 55 14             	mov    0x14(%ebp),%edx
+  803586:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803589:	8b 55 18             	mov    0x18(%ebp),%edx
+  80358c:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80358f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803592:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803595:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80359a:	c9                   	leave
+  80359b:	c3                   	ret
+
+0080359c <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80359c:	55                   	push   %ebp
+  80359d:	89 e5                	mov    %esp,%ebp
+  80359f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035a2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8035a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035a8:	e8 29 ff ff ff       	call   8034d6 <pgbatch_slot>
+  8035ad:	85 c0                	test   %eax,%eax
+  8035af:	78 1a                	js     8035cb <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8035b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035b4:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8035ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035bd:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8035c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035c3:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8035c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035cb:	c9                   	leave
+  8035cc:	c3                   	ret
+
+008035cd <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8035cd:	55                   	push   %ebp
+  8035ce:	89 e5                	mov    %esp,%ebp
+  8035d0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035d3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8035d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035d9:	e8 f8 fe ff ff       	call   8034d6 <pgbatch_slot>
+  8035de:	85 c0                	test   %eax,%eax
+  8035e0:	78 20                	js     803602 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8035e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035e5:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8035eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035ee:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8035f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035f4:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8035f7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035fa:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803602:	c9                   	leave
+  803603:	c3                   	ret
+
+00803604 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803604:	55                   	push   %ebp
+  803605:	89 e5                	mov    %esp,%ebp
+  803607:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80360a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80360d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803610:	e8 c1 fe ff ff       	call   8034d6 <pgbatch_slot>
+  803615:	85 c0                	test   %eax,%eax
+  803617:	78 26                	js     80363f <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803619:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80361c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803622:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803625:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803628:	8b 55 10             	mov    0x10(%ebp),%edx
+  80362b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80362e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803631:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803634:	8b 55 18             	mov    0x18(%ebp),%edx
+  803637:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80363a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80363f:	c9                   	leave
+  803640:	c3                   	ret
+
+00803641 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803641:	b8 00 00 00 00       	mov    $0x0,%eax
+  803646:	c3                   	ret
+
+00803647 <devcons_poll>:
+{
+  803647:	55                   	push   %ebp
+  803648:	89 e5                	mov    %esp,%ebp
+  80364a:	53                   	push   %ebx
+  80364b:	83 ec 04             	sub    $0x4,%esp
+  80364e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803651:	89 da                	mov    %ebx,%edx
+  803653:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803656:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  80365d:	74 0c                	je     80366b <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80365f:	89 d8                	mov    %ebx,%eax
+  803661:	83 e0 01             	and    $0x1,%eax
+  803664:	09 d0                	or     %edx,%eax
+}
+  803666:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803669:	c9                   	leave
+  80366a:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80366b:	e8 6c d6 ff ff       	call   800cdc <sys_cgetc>
+  803670:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803675:	89 da                	mov    %ebx,%edx
+  803677:	83 e2 04             	and    $0x4,%edx
+  80367a:	85 c0                	test   %eax,%eax
+  80367c:	74 e6                	je     803664 <devcons_poll+0x1d>
+  80367e:	eb df                	jmp    80365f <devcons_poll+0x18>
+
+00803680 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803680:	55                   	push   %ebp
+  803681:	89 e5                	mov    %esp,%ebp
+  803683:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803686:	68 7e 42 80 00       	push   $0x80427e
+  80368b:	ff 75 0c             	push   0xc(%ebp)
+  80368e:	e8 b3 d2 ff ff       	call   800946 <strcpy>
+	return 0;
+}
+  803693:	b8 00 00 00 00       	mov    $0x0,%eax
+  803698:	c9                   	leave
+  803699:	c3                   	ret
+
+0080369a <devcons_write>:
+{
+  80369a:	55                   	push   %ebp
+  80369b:	89 e5                	mov    %esp,%ebp
+  80369d:	57                   	push   %edi
+  80369e:	56                   	push   %esi
+  80369f:	53                   	push   %ebx
+  8036a0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8036a6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8036a9:	85 ff                	test   %edi,%edi
+  8036ab:	74 51                	je     8036fe <devcons_write+0x64>
+  8036ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8036b7:	89 fb                	mov    %edi,%ebx
+  8036b9:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8036bb:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8036c0:	39 d3                	cmp    %edx,%ebx
+  8036c2:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8036c5:	83 ec 04             	sub    $0x4,%esp
+  8036c8:	53                   	push   %ebx
+  8036c9:	03 45 0c             	add    0xc(%ebp),%eax
+  8036cc:	50                   	push   %eax
+  8036cd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8036d3:	50                   	push   %eax
+  8036d4:	e8 1d d4 ff ff       	call   800af6 <memmove>
+		sys_cputs(buf, m);
+  8036d9:	83 c4 08             	add    $0x8,%esp
+  8036dc:	53                   	push   %ebx
+  8036dd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8036e3:	50                   	push   %eax
+  8036e4:	e8 d5 d5 ff ff       	call   800cbe <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8036e9:	01 de                	add    %ebx,%esi
+  8036eb:	89 f0                	mov    %esi,%eax
+  8036ed:	83 c4 10             	add    $0x10,%esp
+  8036f0:	39 fe                	cmp    %edi,%esi
+  8036f2:	72 c3                	jb     8036b7 <devcons_write+0x1d>
+}
+  8036f4:	89 f0                	mov    %esi,%eax
+  8036f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f9:	5b                   	pop    %ebx
+  8036fa:	5e                   	pop    %esi
+  8036fb:	5f                   	pop    %edi
+  8036fc:	5d                   	pop    %ebp
+  8036fd:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8036fe:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803703:	eb ef                	jmp    8036f4 <devcons_write+0x5a>
+
+00803705 <devcons_read>:
+{
+  803705:	55                   	push   %ebp
+  803706:	89 e5                	mov    %esp,%ebp
+  803708:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80370b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803710:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803714:	74 36                	je     80374c <devcons_read+0x47>
+	c = cons_peek;
+  803716:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  80371b:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  803722:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803725:	85 c0                	test   %eax,%eax
+  803727:	75 10                	jne    803739 <devcons_read+0x34>
+  803729:	e8 ae d5 ff ff       	call   800cdc <sys_cgetc>
+  80372e:	85 c0                	test   %eax,%eax
+  803730:	75 07                	jne    803739 <devcons_read+0x34>
+		sys_yield();
+  803732:	e8 24 d6 ff ff       	call   800d5b <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803737:	eb f0                	jmp    803729 <devcons_read+0x24>
+	if (c < 0)
+  803739:	85 c0                	test   %eax,%eax
+  80373b:	78 0f                	js     80374c <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80373d:	83 f8 04             	cmp    $0x4,%eax
+  803740:	74 0c                	je     80374e <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803742:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803745:	88 02                	mov    %al,(%edx)
+	return 1;
+  803747:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80374c:	c9                   	leave
+  80374d:	c3                   	ret
+		return 0;
+  80374e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803753:	eb f7                	jmp    80374c <devcons_read+0x47>
+
+00803755 <cputchar>:
+{
+  803755:	55                   	push   %ebp
+  803756:	89 e5                	mov    %esp,%ebp
+  803758:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80375b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80375e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803761:	6a 01                	push   $0x1
+  803763:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803766:	50                   	push   %eax
+  803767:	e8 52 d5 ff ff       	call   800cbe <sys_cputs>
+}
+  80376c:	83 c4 10             	add    $0x10,%esp
+  80376f:	c9                   	leave
+  803770:	c3                   	ret
+
+00803771 <getchar>:
+{
+  803771:	55                   	push   %ebp
+  803772:	89 e5                	mov    %esp,%ebp
+  803774:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803777:	6a 01                	push   $0x1
+  803779:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80377c:	50                   	push   %eax
+  80377d:	6a 00                	push   $0x0
+  80377f:	e8 a3 de ff ff       	call   801627 <read>
+	if (r < 0)
+  803784:	83 c4 10             	add    $0x10,%esp
+  803787:	85 c0                	test   %eax,%eax
+  803789:	78 06                	js     803791 <getchar+0x20>
+	if (r < 1)
+  80378b:	74 06                	je     803793 <getchar+0x22>
+	return c;
+  80378d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803791:	c9                   	leave
+  803792:	c3                   	ret
+		return -E_EOF;
+  803793:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803798:	eb f7                	jmp    803791 <getchar+0x20>
+
+0080379a <iscons>:
+{
+  80379a:	55                   	push   %ebp
+  80379b:	89 e5                	mov    %esp,%ebp
+  80379d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8037a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037a3:	50                   	push   %eax
+  8037a4:	ff 75 08             	push   0x8(%ebp)
+  8037a7:	e8 f7 db ff ff       	call   8013a3 <fd_lookup>
+  8037ac:	83 c4 10             	add    $0x10,%esp
+  8037af:	85 c0                	test   %eax,%eax
+  8037b1:	78 11                	js     8037c4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8037b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037b6:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8037bc:	39 10                	cmp    %edx,(%eax)
+  8037be:	0f 94 c0             	sete   %al
+  8037c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8037c4:	c9                   	leave
+  8037c5:	c3                   	ret
+
+008037c6 <opencons>:
+{
+  8037c6:	55                   	push   %ebp
+  8037c7:	89 e5                	mov    %esp,%ebp
+  8037c9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8037cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037cf:	50                   	push   %eax
+  8037d0:	e8 7e db ff ff       	call   801353 <fd_alloc>
+  8037d5:	83 c4 10             	add    $0x10,%esp
+  8037d8:	85 c0                	test   %eax,%eax
+  8037da:	78 3a                	js     803816 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8037dc:	83 ec 04             	sub    $0x4,%esp
+  8037df:	68 07 04 00 00       	push   $0x407
+  8037e4:	ff 75 f4             	push   -0xc(%ebp)
+  8037e7:	6a 00                	push   $0x0
+  8037e9:	e8 8c d5 ff ff       	call   800d7a <sys_page_alloc>
+  8037ee:	83 c4 10             	add    $0x10,%esp
+  8037f1:	85 c0                	test   %eax,%eax
+  8037f3:	78 21                	js     803816 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8037f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037f8:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8037fe:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803800:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803803:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80380a:	83 ec 0c             	sub    $0xc,%esp
+  80380d:	50                   	push   %eax
+  80380e:	e8 19 db ff ff       	call   80132c <fd2num>
+  803813:	83 c4 10             	add    $0x10,%esp
+}
+  803816:	c9                   	leave
+  803817:	c3                   	ret
+
+00803818 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803818:	55                   	push   %ebp
+  803819:	89 e5                	mov    %esp,%ebp
+  80381b:	56                   	push   %esi
+  80381c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80381d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803820:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803826:	e8 11 d5 ff ff       	call   800d3c <sys_getenvid>
+  80382b:	83 ec 0c             	sub    $0xc,%esp
+  80382e:	ff 75 0c             	push   0xc(%ebp)
+  803831:	ff 75 08             	push   0x8(%ebp)
+  803834:	56                   	push   %esi
+  803835:	50                   	push   %eax
+  803836:	68 8c 42 80 00       	push   $0x80428c
+  80383b:	e8 0f ca ff ff       	call   80024f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803840:	83 c4 18             	add    $0x18,%esp
+  803843:	53                   	push   %ebx
+  803844:	ff 75 10             	push   0x10(%ebp)
+  803847:	e8 b2 c9 ff ff       	call   8001fe <vcprintf>
+	cprintf("\n");
+  80384c:	c7 04 24 d0 3d 80 00 	movl   $0x803dd0,(%esp)
+  803853:	e8 f7 c9 ff ff       	call   80024f <cprintf>
+  803858:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80385b:	cc                   	int3
+	while (1)
+  80385c:	eb fd                	jmp    80385b <_panic+0x43>
+
+0080385e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80385e:	55                   	push   %ebp
+  80385f:	89 e5                	mov    %esp,%ebp
+  803861:	56                   	push   %esi
+  803862:	53                   	push   %ebx
+  803863:	8b 75 08             	mov    0x8(%ebp),%esi
+  803866:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803869:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80386c:	85 c0                	test   %eax,%eax
+  80386e:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803873:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803876:	83 ec 0c             	sub    $0xc,%esp
+  803879:	50                   	push   %eax
+  80387a:	e8 ab d6 ff ff       	call   800f2a <sys_ipc_recv>
+  80387f:	83 c4 10             	add    $0x10,%esp
+  803882:	85 c0                	test   %eax,%eax
+  803884:	0f 88 8b 00 00 00    	js     803915 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80388a:	85 f6                	test   %esi,%esi
+  80388c:	74 2a                	je     8038b8 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80388e:	89 e2                	mov    %esp,%edx
+  803890:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803895:	29 d0                	sub    %edx,%eax
+  803897:	89 c2                	mov    %eax,%edx
+  803899:	c1 ea 0f             	shr    $0xf,%edx
+  80389c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a6:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8038a9:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8038b0:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8038b6:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8038b8:	85 db                	test   %ebx,%ebx
+  8038ba:	74 2a                	je     8038e6 <ipc_recv+0x88>
+  8038bc:	89 e2                	mov    %esp,%edx
+  8038be:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038c3:	29 d0                	sub    %edx,%eax
+  8038c5:	89 c2                	mov    %eax,%edx
+  8038c7:	c1 ea 0f             	shr    $0xf,%edx
+  8038ca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d4:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8038d7:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8038de:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8038e4:	89 03                	mov    %eax,(%ebx)
+  8038e6:	89 e2                	mov    %esp,%edx
+  8038e8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038ed:	29 d0                	sub    %edx,%eax
+  8038ef:	89 c2                	mov    %eax,%edx
+  8038f1:	c1 ea 0f             	shr    $0xf,%edx
+  8038f4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038fe:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803901:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803908:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80390e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803911:	5b                   	pop    %ebx
+  803912:	5e                   	pop    %esi
+  803913:	5d                   	pop    %ebp
+  803914:	c3                   	ret
+		if(from_env_store != NULL)
+  803915:	85 f6                	test   %esi,%esi
+  803917:	74 06                	je     80391f <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803919:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80391f:	85 db                	test   %ebx,%ebx
+  803921:	74 eb                	je     80390e <ipc_recv+0xb0>
+			*perm_store = 0;
+  803923:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803929:	eb e3                	jmp    80390e <ipc_recv+0xb0>
+
+0080392b <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80392b:	55                   	push   %ebp
+  80392c:	89 e5                	mov    %esp,%ebp
+  80392e:	57                   	push   %edi
+  80392f:	56                   	push   %esi
+  803930:	53                   	push   %ebx
+  803931:	83 ec 14             	sub    $0x14,%esp
+  803934:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803937:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80393a:	8b 75 14             	mov    0x14(%ebp),%esi
+  80393d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803940:	85 c0                	test   %eax,%eax
+  803942:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803947:	0f 44 c2             	cmove  %edx,%eax
+  80394a:	ff 75 10             	push   0x10(%ebp)
+  80394d:	50                   	push   %eax
+  80394e:	e8 39 d6 ff ff       	call   800f8c <sys_ipc_recv_pages>
+  803953:	83 c4 10             	add    $0x10,%esp
+  803956:	85 c0                	test   %eax,%eax
+  803958:	0f 88 ba 00 00 00    	js     803a18 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80395e:	85 ff                	test   %edi,%edi
+  803960:	74 2a                	je     80398c <ipc_recv_pages+0x61>
+  803962:	89 e2                	mov    %esp,%edx
+  803964:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803969:	29 d0                	sub    %edx,%eax
+  80396b:	89 c2                	mov    %eax,%edx
+  80396d:	c1 ea 0f             	shr    $0xf,%edx
+  803970:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80397d:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803984:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80398a:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80398c:	85 f6                	test   %esi,%esi
+  80398e:	74 2a                	je     8039ba <ipc_recv_pages+0x8f>
+  803990:	89 e2                	mov    %esp,%edx
+  803992:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803997:	29 d0                	sub    %edx,%eax
+  803999:	89 c2                	mov    %eax,%edx
+  80399b:	c1 ea 0f             	shr    $0xf,%edx
+  80399e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a8:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8039ab:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8039b2:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8039b8:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8039ba:	85 db                	test   %ebx,%ebx
+  8039bc:	74 2a                	je     8039e8 <ipc_recv_pages+0xbd>
+  8039be:	89 e2                	mov    %esp,%edx
+  8039c0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8039c5:	29 d0                	sub    %edx,%eax
+  8039c7:	89 c2                	mov    %eax,%edx
+  8039c9:	c1 ea 0f             	shr    $0xf,%edx
+  8039cc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039d6:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8039d9:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8039e0:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8039e6:	89 03                	mov    %eax,(%ebx)
+  8039e8:	89 e2                	mov    %esp,%edx
+  8039ea:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8039ef:	29 d0                	sub    %edx,%eax
+  8039f1:	89 c2                	mov    %eax,%edx
+  8039f3:	c1 ea 0f             	shr    $0xf,%edx
+  8039f6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a00:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803a03:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803a0a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a13:	5b                   	pop    %ebx
+  803a14:	5e                   	pop    %esi
+  803a15:	5f                   	pop    %edi
+  803a16:	5d                   	pop    %ebp
+  803a17:	c3                   	ret
+		if (from_env_store)
+  803a18:	85 ff                	test   %edi,%edi
+  803a1a:	74 06                	je     803a22 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803a1c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803a22:	85 f6                	test   %esi,%esi
+  803a24:	74 06                	je     803a2c <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803a26:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803a2c:	85 db                	test   %ebx,%ebx
+  803a2e:	74 e0                	je     803a10 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803a30:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803a36:	eb d8                	jmp    803a10 <ipc_recv_pages+0xe5>
+
+00803a38 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803a38:	55                   	push   %ebp
+  803a39:	89 e5                	mov    %esp,%ebp
+  803a3b:	57                   	push   %edi
+  803a3c:	56                   	push   %esi
+  803a3d:	53                   	push   %ebx
+  803a3e:	83 ec 1c             	sub    $0x1c,%esp
+  803a41:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803a44:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a47:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803a4d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a51:	75 2b                	jne    803a7e <ipc_try_send_pages+0x46>
+  803a53:	89 e2                	mov    %esp,%edx
+  803a55:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803a5a:	29 d0                	sub    %edx,%eax
+  803a5c:	89 c2                	mov    %eax,%edx
+  803a5e:	c1 ea 0f             	shr    $0xf,%edx
+  803a61:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6b:	0f 42 c2             	cmovb  %edx,%eax
+  803a6e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803a75:	8b 70 48             	mov    0x48(%eax),%esi
+  803a78:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803a7e:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803a84:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803a89:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803a8c:	85 ff                	test   %edi,%edi
+  803a8e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803a93:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803a96:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803a9c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803aa2:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803aa8:	83 ec 0c             	sub    $0xc,%esp
+  803aab:	ff 75 14             	push   0x14(%ebp)
+  803aae:	ff 75 18             	push   0x18(%ebp)
+  803ab1:	57                   	push   %edi
+  803ab2:	ff 75 0c             	push   0xc(%ebp)
+  803ab5:	ff 75 08             	push   0x8(%ebp)
+  803ab8:	e8 ae d4 ff ff       	call   800f6b <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803abd:	83 c4 20             	add    $0x20,%esp
+  803ac0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803ac3:	75 21                	jne    803ae6 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803ac5:	83 ec 04             	sub    $0x4,%esp
+  803ac8:	6a ff                	push   $0xffffffff
+  803aca:	53                   	push   %ebx
+  803acb:	ff 75 e4             	push   -0x1c(%ebp)
+  803ace:	e8 a5 d6 ff ff       	call   801178 <sys_futex_wait>
+  803ad3:	83 c4 10             	add    $0x10,%esp
+  803ad6:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803ad9:	74 c7                	je     803aa2 <ipc_try_send_pages+0x6a>
+  803adb:	85 c0                	test   %eax,%eax
+  803add:	79 c3                	jns    803aa2 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803adf:	e8 77 d2 ff ff       	call   800d5b <sys_yield>
+  803ae4:	eb bc                	jmp    803aa2 <ipc_try_send_pages+0x6a>
+	}
+}
+  803ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ae9:	5b                   	pop    %ebx
+  803aea:	5e                   	pop    %esi
+  803aeb:	5f                   	pop    %edi
+  803aec:	5d                   	pop    %ebp
+  803aed:	c3                   	ret
+
+00803aee <ipc_send>:
+{
+  803aee:	55                   	push   %ebp
+  803aef:	89 e5                	mov    %esp,%ebp
+  803af1:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803af4:	ff 75 14             	push   0x14(%ebp)
+  803af7:	6a 01                	push   $0x1
+  803af9:	ff 75 10             	push   0x10(%ebp)
+  803afc:	ff 75 0c             	push   0xc(%ebp)
+  803aff:	ff 75 08             	push   0x8(%ebp)
+  803b02:	e8 31 ff ff ff       	call   803a38 <ipc_try_send_pages>
+  803b07:	83 c4 20             	add    $0x20,%esp
+  803b0a:	85 c0                	test   %eax,%eax
+  803b0c:	78 02                	js     803b10 <ipc_send+0x22>
+}
+  803b0e:	c9                   	leave
+  803b0f:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803b10:	50                   	push   %eax
+  803b11:	68 af 42 80 00       	push   $0x8042af
+  803b16:	6a 3f                	push   $0x3f
+  803b18:	68 c4 42 80 00       	push   $0x8042c4
+  803b1d:	e8 f6 fc ff ff       	call   803818 <_panic>
+
+00803b22 <ipc_send_pages>:
+{
+  803b22:	55                   	push   %ebp
+  803b23:	89 e5                	mov    %esp,%ebp
+  803b25:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803b28:	ff 75 18             	push   0x18(%ebp)
+  803b2b:	ff 75 14             	push   0x14(%ebp)
+  803b2e:	ff 75 10             	push   0x10(%ebp)
+  803b31:	ff 75 0c             	push   0xc(%ebp)
+  803b34:	ff 75 08             	push   0x8(%ebp)
+  803b37:	e8 fc fe ff ff       	call   803a38 <ipc_try_send_pages>
+  803b3c:	83 c4 20             	add    $0x20,%esp
+  803b3f:	85 c0                	test   %eax,%eax
+  803b41:	78 02                	js     803b45 <ipc_send_pages+0x23>
+}
+  803b43:	c9                   	leave
+  803b44:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803b45:	50                   	push   %eax
+  803b46:	68 ce 42 80 00       	push   $0x8042ce
+  803b4b:	6a 64                	push   $0x64
+  803b4d:	68 c4 42 80 00       	push   $0x8042c4
+  803b52:	e8 c1 fc ff ff       	call   803818 <_panic>
+
+00803b57 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803b57:	55                   	push   %ebp
+  803b58:	89 e5                	mov    %esp,%ebp
+  803b5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803b62:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803b68:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b6e:	8b 52 50             	mov    0x50(%edx),%edx
+  803b71:	39 ca                	cmp    %ecx,%edx
+  803b73:	74 11                	je     803b86 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803b75:	83 c0 01             	add    $0x1,%eax
+  803b78:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803b7d:	75 e3                	jne    803b62 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b84:	eb 0e                	jmp    803b94 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803b86:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803b8c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b91:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803b94:	5d                   	pop    %ebp
+  803b95:	c3                   	ret
+
+00803b96 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b96:	55                   	push   %ebp
+  803b97:	89 e5                	mov    %esp,%ebp
+  803b99:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b9c:	89 c2                	mov    %eax,%edx
+  803b9e:	c1 ea 16             	shr    $0x16,%edx
+  803ba1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803bad:	f6 c1 01             	test   $0x1,%cl
+  803bb0:	74 1e                	je     803bd0 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803bb2:	c1 e8 0c             	shr    $0xc,%eax
+  803bb5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803bbc:	a8 01                	test   $0x1,%al
+  803bbe:	74 10                	je     803bd0 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803bc0:	c1 e8 0c             	shr    $0xc,%eax
+  803bc3:	c1 e0 04             	shl    $0x4,%eax
+  803bc6:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803bcd:	0f b7 d2             	movzwl %dx,%edx
+}
+  803bd0:	89 d0                	mov    %edx,%eax
+  803bd2:	5d                   	pop    %ebp
+  803bd3:	c3                   	ret
+
+00803bd4 <__udivdi3>:
+  803bd4:	57                   	push   %edi
+  803bd5:	56                   	push   %esi
+  803bd6:	53                   	push   %ebx
+  803bd7:	83 ec 20             	sub    $0x20,%esp
+  803bda:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803bde:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803be2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803be6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803bea:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803bee:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803bf2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803bf6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803bfa:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c09:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803c10:	00 
+  803c11:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803c18:	00 
+  803c19:	eb 08                	jmp    803c23 <__udivdi3+0x4f>
+  803c1b:	83 e9 01             	sub    $0x1,%ecx
+  803c1e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803c21:	74 68                	je     803c8b <__udivdi3+0xb7>
+  803c23:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803c27:	01 c0                	add    %eax,%eax
+  803c29:	89 c6                	mov    %eax,%esi
+  803c2b:	89 d7                	mov    %edx,%edi
+  803c2d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803c31:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803c35:	0f ad d0             	shrd   %cl,%edx,%eax
+  803c38:	d3 ea                	shr    %cl,%edx
+  803c3a:	f6 c1 20             	test   $0x20,%cl
+  803c3d:	74 04                	je     803c43 <__udivdi3+0x6f>
+  803c3f:	89 d0                	mov    %edx,%eax
+  803c41:	31 d2                	xor    %edx,%edx
+  803c43:	83 e0 01             	and    $0x1,%eax
+  803c46:	89 04 24             	mov    %eax,(%esp)
+  803c49:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803c50:	00 
+  803c51:	8b 04 24             	mov    (%esp),%eax
+  803c54:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803c58:	09 f0                	or     %esi,%eax
+  803c5a:	09 fa                	or     %edi,%edx
+  803c5c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803c60:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803c64:	39 f0                	cmp    %esi,%eax
+  803c66:	89 d3                	mov    %edx,%ebx
+  803c68:	19 fb                	sbb    %edi,%ebx
+  803c6a:	72 af                	jb     803c1b <__udivdi3+0x47>
+  803c6c:	29 f0                	sub    %esi,%eax
+  803c6e:	19 fa                	sbb    %edi,%edx
+  803c70:	89 cf                	mov    %ecx,%edi
+  803c72:	c1 ef 05             	shr    $0x5,%edi
+  803c75:	83 e7 01             	and    $0x1,%edi
+  803c78:	89 fe                	mov    %edi,%esi
+  803c7a:	83 f6 01             	xor    $0x1,%esi
+  803c7d:	d3 e6                	shl    %cl,%esi
+  803c7f:	d3 e7                	shl    %cl,%edi
+  803c81:	09 74 24 18          	or     %esi,0x18(%esp)
+  803c85:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803c89:	eb 90                	jmp    803c1b <__udivdi3+0x47>
+  803c8b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c8f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c93:	83 c4 20             	add    $0x20,%esp
+  803c96:	5b                   	pop    %ebx
+  803c97:	5e                   	pop    %esi
+  803c98:	5f                   	pop    %edi
+  803c99:	c3                   	ret
+
+00803c9a <__umoddi3>:
+  803c9a:	57                   	push   %edi
+  803c9b:	56                   	push   %esi
+  803c9c:	53                   	push   %ebx
+  803c9d:	83 ec 08             	sub    $0x8,%esp
+  803ca0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ca4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ca8:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803cac:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803cb0:	57                   	push   %edi
+  803cb1:	56                   	push   %esi
+  803cb2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803cb6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803cba:	52                   	push   %edx
+  803cbb:	50                   	push   %eax
+  803cbc:	e8 13 ff ff ff       	call   803bd4 <__udivdi3>
+  803cc1:	89 c3                	mov    %eax,%ebx
+  803cc3:	0f af d6             	imul   %esi,%edx
+  803cc6:	89 f9                	mov    %edi,%ecx
+  803cc8:	0f af cb             	imul   %ebx,%ecx
+  803ccb:	01 d1                	add    %edx,%ecx
+  803ccd:	89 d8                	mov    %ebx,%eax
+  803ccf:	f7 e6                	mul    %esi
+  803cd1:	89 c6                	mov    %eax,%esi
+  803cd3:	89 d7                	mov    %edx,%edi
+  803cd5:	01 cf                	add    %ecx,%edi
+  803cd7:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803cdb:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803cdf:	29 f0                	sub    %esi,%eax
+  803ce1:	19 fa                	sbb    %edi,%edx
+  803ce3:	83 c4 18             	add    $0x18,%esp
+  803ce6:	5b                   	pop    %ebx
+  803ce7:	5e                   	pop    %esi
+  803ce8:	5f                   	pop    %edi
+  803ce9:	c3                   	ret
+
+00803cea <__divdi3>:
+  803cea:	53                   	push   %ebx
+  803ceb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803cef:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803cf3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803cf7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803cfb:	85 d2                	test   %edx,%edx
+  803cfd:	78 12                	js     803d11 <__divdi3+0x27>
+  803cff:	85 db                	test   %ebx,%ebx
+  803d01:	78 2e                	js     803d31 <__divdi3+0x47>
+  803d03:	53                   	push   %ebx
+  803d04:	51                   	push   %ecx
+  803d05:	52                   	push   %edx
+  803d06:	50                   	push   %eax
+  803d07:	e8 c8 fe ff ff       	call   803bd4 <__udivdi3>
+  803d0c:	83 c4 10             	add    $0x10,%esp
+  803d0f:	eb 1e                	jmp    803d2f <__divdi3+0x45>
+  803d11:	f7 d8                	neg    %eax
+  803d13:	83 d2 00             	adc    $0x0,%edx
+  803d16:	f7 da                	neg    %edx
+  803d18:	85 db                	test   %ebx,%ebx
+  803d1a:	78 2a                	js     803d46 <__divdi3+0x5c>
+  803d1c:	53                   	push   %ebx
+  803d1d:	51                   	push   %ecx
+  803d1e:	52                   	push   %edx
+  803d1f:	50                   	push   %eax
+  803d20:	e8 af fe ff ff       	call   803bd4 <__udivdi3>
+  803d25:	83 c4 10             	add    $0x10,%esp
+  803d28:	f7 d8                	neg    %eax
+  803d2a:	83 d2 00             	adc    $0x0,%edx
+  803d2d:	f7 da                	neg    %edx
+  803d2f:	5b                   	pop    %ebx
+  803d30:	c3                   	ret
+  803d31:	f7 d9                	neg    %ecx
+  803d33:	83 d3 00             	adc    $0x0,%ebx
+  803d36:	f7 db                	neg    %ebx
+  803d38:	53                   	push   %ebx
+  803d39:	51                   	push   %ecx
+  803d3a:	52                   	push   %edx
+  803d3b:	50                   	push   %eax
+  803d3c:	e8 93 fe ff ff       	call   803bd4 <__udivdi3>
+  803d41:	83 c4 10             	add    $0x10,%esp
+  803d44:	eb e2                	jmp    803d28 <__divdi3+0x3e>
+  803d46:	f7 d9                	neg    %ecx
+  803d48:	83 d3 00             	adc    $0x0,%ebx
+  803d4b:	f7 db                	neg    %ebx
+  803d4d:	53                   	push   %ebx
+  803d4e:	51                   	push   %ecx
+  803d4f:	52                   	push   %edx
+  803d50:	50                   	push   %eax
+  803d51:	e8 7e fe ff ff       	call   803bd4 <__udivdi3>
+  803d56:	83 c4 10             	add    $0x10,%esp
+  803d59:	eb d4                	jmp    803d2f <__divdi3+0x45>
+
+00803d5b <__moddi3>:
+  803d5b:	57                   	push   %edi
+  803d5c:	56                   	push   %esi
+  803d5d:	53                   	push   %ebx
+  803d5e:	83 ec 08             	sub    $0x8,%esp
+  803d61:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803d65:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803d69:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803d6d:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803d71:	57                   	push   %edi
+  803d72:	56                   	push   %esi
+  803d73:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803d77:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803d7b:	52                   	push   %edx
+  803d7c:	50                   	push   %eax
+  803d7d:	e8 68 ff ff ff       	call   803cea <__divdi3>
+  803d82:	89 c3                	mov    %eax,%ebx
+  803d84:	0f af d6             	imul   %esi,%edx
+  803d87:	89 f9                	mov    %edi,%ecx
+  803d89:	0f af cb             	imul   %ebx,%ecx
+  803d8c:	01 d1                	add    %edx,%ecx
+  803d8e:	89 d8                	mov    %ebx,%eax
+  803d90:	f7 e6                	mul    %esi
+  803d92:	89 c6                	mov    %eax,%esi
+  803d94:	89 d7                	mov    %edx,%edi
+  803d96:	01 cf                	add    %ecx,%edi
+  803d98:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803d9c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803da0:	29 f0                	sub    %esi,%eax
+  803da2:	19 fa                	sbb    %edi,%edx
+  803da4:	83 c4 18             	add    $0x18,%esp
+  803da7:	5b                   	pop    %ebx
+  803da8:	5e                   	pop    %esi
+  803da9:	5f                   	pop    %edi
+  803daa:	c3                   	ret
@@ -0,0 +1,10835 @@
+
+obj/user/mallocbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 79 05 00 00       	call   8005aa <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <rnd>:
+static uint32_t seed = 1;
+
+static uint32_t
+rnd(void)
+{
+	seed = seed * 1103515245 + 12345;
+  800035:	69 05 00 60 80 00 6d 	imul   $0x41c64e6d,0x806000,%eax
+  80003c:	4e c6 41 
+  80003f:	05 39 30 00 00       	add    $0x3039,%eax
+  800044:	a3 00 60 80 00       	mov    %eax,0x806000
+	return seed >> 8;
+  800049:	c1 e8 08             	shr    $0x8,%eax
+}
+  80004c:	c3                   	ret
+
+0080004d <report>:
+
+static void
+report(const char *name, int ops, uint64_t cycles, uint32_t syscalls)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	83 ec 48             	sub    $0x48,%esp
+  800056:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800059:	89 d3                	mov    %edx,%ebx
+  80005b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80005e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	struct mstats st;
+
+	malloc_stats(&st);
+  800061:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  800064:	50                   	push   %eax
+  800065:	e8 8a 3b 00 00       	call   803bf4 <malloc_stats>
+	cprintf("mallocbench: %-6s %u cycles/op, %u syscalls\n",
+  80006a:	ff 75 10             	push   0x10(%ebp)
+		name, (uint32_t) (cycles / ops), syscalls);
+  80006d:	89 d8                	mov    %ebx,%eax
+  80006f:	99                   	cltd
+  800070:	83 ec 0c             	sub    $0xc,%esp
+  800073:	52                   	push   %edx
+  800074:	53                   	push   %ebx
+  800075:	57                   	push   %edi
+  800076:	56                   	push   %esi
+  800077:	e8 a2 52 00 00       	call   80531e <__udivdi3>
+  80007c:	83 c4 1c             	add    $0x1c,%esp
+	cprintf("mallocbench: %-6s %u cycles/op, %u syscalls\n",
+  80007f:	50                   	push   %eax
+  800080:	ff 75 c4             	push   -0x3c(%ebp)
+  800083:	68 00 55 80 00       	push   $0x805500
+  800088:	e8 9f 06 00 00       	call   80072c <cprintf>
+	cprintf("mallocbench: %-6s heap %u KB, %u KB live (%u%%), "
+  80008d:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800090:	c1 ef 0a             	shr    $0xa,%edi
+  800093:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800096:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800099:	c1 e8 0a             	shr    $0xa,%eax
+  80009c:	89 45 c0             	mov    %eax,-0x40(%ebp)
+		"%u KB free in %u slabs, %u KB in free spans\n",
+		name, st.ms_arena / 1024, st.ms_inuse / 1024,
+		st.ms_arena ? (uint32_t) ((uint64_t) st.ms_inuse * 100
+  80009f:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+	cprintf("mallocbench: %-6s heap %u KB, %u KB live (%u%%), "
+  8000a2:	83 c4 20             	add    $0x20,%esp
+  8000a5:	89 d8                	mov    %ebx,%eax
+  8000a7:	85 db                	test   %ebx,%ebx
+  8000a9:	74 22                	je     8000cd <report+0x80>
+		st.ms_arena ? (uint32_t) ((uint64_t) st.ms_inuse * 100
+  8000ab:	b8 64 00 00 00       	mov    $0x64,%eax
+  8000b0:	f7 65 cc             	mull   -0x34(%ebp)
+					  / st.ms_arena) : 0,
+  8000b3:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+  8000b6:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+  8000bd:	ff 75 bc             	push   -0x44(%ebp)
+  8000c0:	ff 75 b8             	push   -0x48(%ebp)
+  8000c3:	52                   	push   %edx
+  8000c4:	50                   	push   %eax
+  8000c5:	e8 54 52 00 00       	call   80531e <__udivdi3>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+	cprintf("mallocbench: %-6s heap %u KB, %u KB live (%u%%), "
+  8000cd:	57                   	push   %edi
+  8000ce:	56                   	push   %esi
+  8000cf:	ff 75 c0             	push   -0x40(%ebp)
+  8000d2:	50                   	push   %eax
+  8000d3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8000d6:	c1 e8 0a             	shr    $0xa,%eax
+  8000d9:	50                   	push   %eax
+  8000da:	c1 eb 0a             	shr    $0xa,%ebx
+  8000dd:	53                   	push   %ebx
+  8000de:	ff 75 c4             	push   -0x3c(%ebp)
+  8000e1:	68 30 55 80 00       	push   $0x805530
+  8000e6:	e8 41 06 00 00       	call   80072c <cprintf>
+		st.ms_slabfree / 1024, st.ms_slabs, st.ms_spanfree / 1024);
+}
+  8000eb:	83 c4 20             	add    $0x20,%esp
+  8000ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f1:	5b                   	pop    %ebx
+  8000f2:	5e                   	pop    %esi
+  8000f3:	5f                   	pop    %edi
+  8000f4:	5d                   	pop    %ebp
+  8000f5:	c3                   	ret
+
+008000f6 <bench_net>:
+
+// What the network stack does: each packet is a small descriptor and a
+// buffer of up to a full frame, freed roughly in the order they came.
+static void
+bench_net(const char *name)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	57                   	push   %edi
+  8000fa:	56                   	push   %esi
+  8000fb:	53                   	push   %ebx
+  8000fc:	83 ec 20             	sub    $0x20,%esp
+  8000ff:	89 c3                	mov    %eax,%ebx
+	uint64_t t0;
+	uint32_t s0;
+	int op, i, head = 0;
+
+	memset(slot, 0, sizeof(slot));
+  800101:	68 00 40 00 00       	push   $0x4000
+  800106:	6a 00                	push   $0x0
+  800108:	68 80 70 80 00       	push   $0x807080
+  80010d:	e8 8c 0e 00 00       	call   800f9e <memset>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800112:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800114:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800119:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  80011b:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80011e:	89 c2                	mov    %eax,%edx
+  800120:	c1 ea 0f             	shr    $0xf,%edx
+  800123:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012d:	0f 42 c2             	cmovb  %edx,%eax
+	s0 = thisenv->env_syscalls;
+  800130:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  800137:	8b 40 5c             	mov    0x5c(%eax),%eax
+  80013a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+        uint64_t tsc;
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  80013d:	0f 31                	rdtsc
+  80013f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800142:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800145:	bf 20 4e 00 00       	mov    $0x4e20,%edi
+	int op, i, head = 0;
+  80014a:	be 00 00 00 00       	mov    $0x0,%esi
+		if (slot[2 * i]) {
+			free(slot[2 * i]);
+			free(slot[2 * i + 1]);
+		}
+		slot[2 * i] = malloc(64);
+		slot[2 * i + 1] = malloc(rnd() % 4 ? 1514 : 64 + rnd() % 1450);
+  80014f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  800152:	eb 79                	jmp    8001cd <bench_net+0xd7>
+			free(slot[2 * i]);
+  800154:	83 ec 0c             	sub    $0xc,%esp
+  800157:	50                   	push   %eax
+  800158:	e8 02 38 00 00       	call   80395f <free>
+			free(slot[2 * i + 1]);
+  80015d:	83 c4 04             	add    $0x4,%esp
+  800160:	ff 34 9d 84 70 80 00 	push   0x807084(,%ebx,4)
+  800167:	e8 f3 37 00 00       	call   80395f <free>
+  80016c:	83 c4 10             	add    $0x10,%esp
+		slot[2 * i] = malloc(64);
+  80016f:	83 ec 0c             	sub    $0xc,%esp
+  800172:	6a 40                	push   $0x40
+  800174:	e8 c4 37 00 00       	call   80393d <malloc>
+  800179:	89 04 9d 80 70 80 00 	mov    %eax,0x807080(,%ebx,4)
+		slot[2 * i + 1] = malloc(rnd() % 4 ? 1514 : 64 + rnd() % 1450);
+  800180:	e8 b0 fe ff ff       	call   800035 <rnd>
+  800185:	89 c2                	mov    %eax,%edx
+  800187:	83 c4 10             	add    $0x10,%esp
+  80018a:	b8 ea 05 00 00       	mov    $0x5ea,%eax
+  80018f:	f6 c2 03             	test   $0x3,%dl
+  800192:	74 5b                	je     8001ef <bench_net+0xf9>
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	50                   	push   %eax
+  800198:	e8 a0 37 00 00       	call   80393d <malloc>
+  80019d:	89 04 9d 84 70 80 00 	mov    %eax,0x807084(,%ebx,4)
+		if (!slot[2 * i] || !slot[2 * i + 1])
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	83 3c 9d 80 70 80 00 	cmpl   $0x0,0x807080(,%ebx,4)
+  8001ae:	00 
+  8001af:	74 5c                	je     80020d <bench_net+0x117>
+  8001b1:	85 c0                	test   %eax,%eax
+  8001b3:	74 58                	je     80020d <bench_net+0x117>
+			panic("malloc failed");
+		head = (head + 1) % NPKT;
+  8001b5:	83 c6 01             	add    $0x1,%esi
+  8001b8:	89 f0                	mov    %esi,%eax
+  8001ba:	c1 f8 1f             	sar    $0x1f,%eax
+  8001bd:	c1 e8 18             	shr    $0x18,%eax
+  8001c0:	8d 14 06             	lea    (%esi,%eax,1),%edx
+  8001c3:	0f b6 f2             	movzbl %dl,%esi
+  8001c6:	29 c6                	sub    %eax,%esi
+	for (op = 0; op < NOPS; op++) {
+  8001c8:	83 ef 01             	sub    $0x1,%edi
+  8001cb:	74 54                	je     800221 <bench_net+0x12b>
+		i = (head + rnd() % 8) % NPKT;	// Mostly in order
+  8001cd:	e8 63 fe ff ff       	call   800035 <rnd>
+  8001d2:	83 e0 07             	and    $0x7,%eax
+  8001d5:	89 c3                	mov    %eax,%ebx
+  8001d7:	01 f3                	add    %esi,%ebx
+  8001d9:	0f b6 db             	movzbl %bl,%ebx
+		if (slot[2 * i]) {
+  8001dc:	01 db                	add    %ebx,%ebx
+  8001de:	8b 04 9d 80 70 80 00 	mov    0x807080(,%ebx,4),%eax
+  8001e5:	85 c0                	test   %eax,%eax
+  8001e7:	0f 85 67 ff ff ff    	jne    800154 <bench_net+0x5e>
+  8001ed:	eb 80                	jmp    80016f <bench_net+0x79>
+		slot[2 * i + 1] = malloc(rnd() % 4 ? 1514 : 64 + rnd() % 1450);
+  8001ef:	e8 41 fe ff ff       	call   800035 <rnd>
+  8001f4:	89 c1                	mov    %eax,%ecx
+  8001f6:	b8 a5 f9 c9 b4       	mov    $0xb4c9f9a5,%eax
+  8001fb:	f7 e1                	mul    %ecx
+  8001fd:	c1 ea 0a             	shr    $0xa,%edx
+  800200:	69 d2 aa 05 00 00    	imul   $0x5aa,%edx,%edx
+  800206:	29 d1                	sub    %edx,%ecx
+  800208:	8d 41 40             	lea    0x40(%ecx),%eax
+  80020b:	eb 87                	jmp    800194 <bench_net+0x9e>
+			panic("malloc failed");
+  80020d:	83 ec 04             	sub    $0x4,%esp
+  800210:	68 8e 55 80 00       	push   $0x80558e
+  800215:	6a 79                	push   $0x79
+  800217:	68 9c 55 80 00       	push   $0x80559c
+  80021c:	e8 30 04 00 00       	call   800651 <_panic>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800221:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800224:	89 e2                	mov    %esp,%edx
+  800226:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80022b:	29 d0                	sub    %edx,%eax
+  80022d:	89 c2                	mov    %eax,%edx
+  80022f:	c1 ea 0f             	shr    $0xf,%edx
+  800232:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800237:	0f 42 fa             	cmovb  %edx,%edi
+	}
+	report(name, 2 * NOPS, read_tsc() - t0, thisenv->env_syscalls - s0);
+  80023a:	8b 04 bd a0 bf 80 00 	mov    0x80bfa0(,%edi,4),%eax
+  800241:	8b 48 5c             	mov    0x5c(%eax),%ecx
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  800244:	0f 31                	rdtsc
+  800246:	83 ec 04             	sub    $0x4,%esp
+  800249:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80024c:	29 f9                	sub    %edi,%ecx
+  80024e:	51                   	push   %ecx
+  80024f:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  800252:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+  800255:	52                   	push   %edx
+  800256:	50                   	push   %eax
+  800257:	ba 40 9c 00 00       	mov    $0x9c40,%edx
+  80025c:	89 d8                	mov    %ebx,%eax
+  80025e:	e8 ea fd ff ff       	call   80004d <report>
+  800263:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 2 * NPKT; i++)
+  800266:	bb 00 00 00 00       	mov    $0x0,%ebx
+		free(slot[i]);
+  80026b:	83 ec 0c             	sub    $0xc,%esp
+  80026e:	ff 34 9d 80 70 80 00 	push   0x807080(,%ebx,4)
+  800275:	e8 e5 36 00 00       	call   80395f <free>
+	for (i = 0; i < 2 * NPKT; i++)
+  80027a:	83 c3 01             	add    $0x1,%ebx
+  80027d:	83 c4 10             	add    $0x10,%esp
+  800280:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800286:	75 e3                	jne    80026b <bench_net+0x175>
+}
+  800288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028b:	5b                   	pop    %ebx
+  80028c:	5e                   	pop    %esi
+  80028d:	5f                   	pop    %edi
+  80028e:	5d                   	pop    %ebp
+  80028f:	c3                   	ret
+
+00800290 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	57                   	push   %edi
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+  800296:	83 ec 1c             	sub    $0x1c,%esp
+	binaryname = "mallocbench";
+  800299:	c7 05 04 60 80 00 af 	movl   $0x8055af,0x806004
+  8002a0:	55 80 00 
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8002a3:	89 e2                	mov    %esp,%edx
+  8002a5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8002aa:	29 d0                	sub    %edx,%eax
+  8002ac:	89 c2                	mov    %eax,%edx
+  8002ae:	c1 ea 0f             	shr    $0xf,%edx
+  8002b1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8002b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bb:	0f 42 c2             	cmovb  %edx,%eax
+	s0 = thisenv->env_syscalls;
+  8002be:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  8002c5:	8b 78 5c             	mov    0x5c(%eax),%edi
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  8002c8:	0f 31                	rdtsc
+  8002ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002cd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	for (round = 0; round < 4; round++) {
+  8002d0:	be 00 00 00 00       	mov    $0x0,%esi
+		for (i = 0; i < NSMALL; i++)
+  8002d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+			if (!(slot[i] = malloc(32)))
+  8002da:	83 ec 0c             	sub    $0xc,%esp
+  8002dd:	6a 20                	push   $0x20
+  8002df:	e8 59 36 00 00       	call   80393d <malloc>
+  8002e4:	89 04 9d 80 70 80 00 	mov    %eax,0x807080(,%ebx,4)
+  8002eb:	83 c4 10             	add    $0x10,%esp
+  8002ee:	85 c0                	test   %eax,%eax
+  8002f0:	0f 84 84 00 00 00    	je     80037a <umain+0xea>
+		for (i = 0; i < NSMALL; i++)
+  8002f6:	83 c3 01             	add    $0x1,%ebx
+  8002f9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8002ff:	75 d9                	jne    8002da <umain+0x4a>
+		for (i = 0; i < NSMALL; i += 2)
+  800301:	bb 00 00 00 00       	mov    $0x0,%ebx
+			free(slot[i]);
+  800306:	83 ec 0c             	sub    $0xc,%esp
+  800309:	ff 34 9d 80 70 80 00 	push   0x807080(,%ebx,4)
+  800310:	e8 4a 36 00 00       	call   80395f <free>
+		for (i = 0; i < NSMALL; i += 2)
+  800315:	83 c3 02             	add    $0x2,%ebx
+  800318:	83 c4 10             	add    $0x10,%esp
+  80031b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800321:	75 e3                	jne    800306 <umain+0x76>
+		for (i = 0; i < NSMALL; i += 2)
+  800323:	bb 00 00 00 00       	mov    $0x0,%ebx
+			if (!(slot[i] = malloc(48)))
+  800328:	83 ec 0c             	sub    $0xc,%esp
+  80032b:	6a 30                	push   $0x30
+  80032d:	e8 0b 36 00 00       	call   80393d <malloc>
+  800332:	89 04 9d 80 70 80 00 	mov    %eax,0x807080(,%ebx,4)
+  800339:	83 c4 10             	add    $0x10,%esp
+  80033c:	85 c0                	test   %eax,%eax
+  80033e:	74 4e                	je     80038e <umain+0xfe>
+		for (i = 0; i < NSMALL; i += 2)
+  800340:	83 c3 02             	add    $0x2,%ebx
+  800343:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800349:	75 dd                	jne    800328 <umain+0x98>
+		if (round < 3)
+  80034b:	83 fe 02             	cmp    $0x2,%esi
+  80034e:	7f 52                	jg     8003a2 <umain+0x112>
+			for (i = 0; i < NSMALL; i++)
+  800350:	bb 00 00 00 00       	mov    $0x0,%ebx
+				free(slot[i]);
+  800355:	83 ec 0c             	sub    $0xc,%esp
+  800358:	ff 34 9d 80 70 80 00 	push   0x807080(,%ebx,4)
+  80035f:	e8 fb 35 00 00       	call   80395f <free>
+			for (i = 0; i < NSMALL; i++)
+  800364:	83 c3 01             	add    $0x1,%ebx
+  800367:	83 c4 10             	add    $0x10,%esp
+  80036a:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800370:	75 e3                	jne    800355 <umain+0xc5>
+	for (round = 0; round < 4; round++) {
+  800372:	83 c6 01             	add    $0x1,%esi
+  800375:	e9 5b ff ff ff       	jmp    8002d5 <umain+0x45>
+				panic("malloc failed");
+  80037a:	83 ec 04             	sub    $0x4,%esp
+  80037d:	68 8e 55 80 00       	push   $0x80558e
+  800382:	6a 35                	push   $0x35
+  800384:	68 9c 55 80 00       	push   $0x80559c
+  800389:	e8 c3 02 00 00       	call   800651 <_panic>
+				panic("malloc failed");
+  80038e:	83 ec 04             	sub    $0x4,%esp
+  800391:	68 8e 55 80 00       	push   $0x80558e
+  800396:	6a 3b                	push   $0x3b
+  800398:	68 9c 55 80 00       	push   $0x80559c
+  80039d:	e8 af 02 00 00       	call   800651 <_panic>
+	for (round = 0; round < 4; round++) {
+  8003a2:	83 c6 01             	add    $0x1,%esi
+  8003a5:	83 fe 04             	cmp    $0x4,%esi
+  8003a8:	0f 85 27 ff ff ff    	jne    8002d5 <umain+0x45>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8003ae:	89 e2                	mov    %esp,%edx
+  8003b0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8003b5:	29 d0                	sub    %edx,%eax
+  8003b7:	89 c2                	mov    %eax,%edx
+  8003b9:	c1 ea 0f             	shr    $0xf,%edx
+  8003bc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c6:	0f 42 c2             	cmovb  %edx,%eax
+	       thisenv->env_syscalls - s0);
+  8003c9:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  8003d0:	8b 48 5c             	mov    0x5c(%eax),%ecx
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  8003d3:	0f 31                	rdtsc
+	report("small", 4 * 2 * NSMALL, read_tsc() - t0,
+  8003d5:	83 ec 04             	sub    $0x4,%esp
+  8003d8:	29 f9                	sub    %edi,%ecx
+  8003da:	51                   	push   %ecx
+  8003db:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  8003de:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  8003e1:	52                   	push   %edx
+  8003e2:	50                   	push   %eax
+  8003e3:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8003e8:	b8 bb 55 80 00       	mov    $0x8055bb,%eax
+  8003ed:	e8 5b fc ff ff       	call   80004d <report>
+  8003f2:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NSMALL; i++)
+  8003f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		free(slot[i]);
+  8003fa:	83 ec 0c             	sub    $0xc,%esp
+  8003fd:	ff 34 9d 80 70 80 00 	push   0x807080(,%ebx,4)
+  800404:	e8 56 35 00 00       	call   80395f <free>
+	for (i = 0; i < NSMALL; i++)
+  800409:	83 c3 01             	add    $0x1,%ebx
+  80040c:	83 c4 10             	add    $0x10,%esp
+  80040f:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800415:	75 e3                	jne    8003fa <umain+0x16a>
+	memset(slot, 0, sizeof(slot));
+  800417:	83 ec 04             	sub    $0x4,%esp
+  80041a:	68 00 40 00 00       	push   $0x4000
+  80041f:	6a 00                	push   $0x0
+  800421:	68 80 70 80 00       	push   $0x807080
+  800426:	e8 73 0b 00 00       	call   800f9e <memset>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80042b:	89 e2                	mov    %esp,%edx
+  80042d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800432:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  800434:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800437:	89 c2                	mov    %eax,%edx
+  800439:	c1 ea 0f             	shr    $0xf,%edx
+  80043c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800441:	b8 00 00 00 00       	mov    $0x0,%eax
+  800446:	0f 42 c2             	cmovb  %edx,%eax
+	s0 = thisenv->env_syscalls;
+  800449:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  800450:	8b 78 5c             	mov    0x5c(%eax),%edi
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  800453:	0f 31                	rdtsc
+  800455:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800458:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80045b:	be 20 4e 00 00       	mov    $0x4e20,%esi
+			free(slot[i]);
+  800460:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  800463:	eb 40                	jmp    8004a5 <umain+0x215>
+		n = rnd() % 8 == 0 ? rnd() % 16384 : 16 + rnd() % 512;
+  800465:	e8 cb fb ff ff       	call   800035 <rnd>
+  80046a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80046f:	8d 78 10             	lea    0x10(%eax),%edi
+  800472:	eb 52                	jmp    8004c6 <umain+0x236>
+			slot[i] = malloc(n);
+  800474:	83 ec 0c             	sub    $0xc,%esp
+  800477:	57                   	push   %edi
+  800478:	e8 c0 34 00 00       	call   80393d <malloc>
+  80047d:	83 c4 10             	add    $0x10,%esp
+  800480:	eb 17                	jmp    800499 <umain+0x209>
+			free(slot[i]);
+  800482:	83 ec 0c             	sub    $0xc,%esp
+  800485:	ff 34 9d 80 70 80 00 	push   0x807080(,%ebx,4)
+  80048c:	e8 ce 34 00 00       	call   80395f <free>
+  800491:	83 c4 10             	add    $0x10,%esp
+  800494:	b8 00 00 00 00       	mov    $0x0,%eax
+			slot[i] = malloc(n);
+  800499:	89 04 9d 80 70 80 00 	mov    %eax,0x807080(,%ebx,4)
+	for (op = 0; op < NOPS; op++) {
+  8004a0:	83 ee 01             	sub    $0x1,%esi
+  8004a3:	74 49                	je     8004ee <umain+0x25e>
+		i = rnd() % NMIXED;
+  8004a5:	e8 8b fb ff ff       	call   800035 <rnd>
+  8004aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004af:	89 c3                	mov    %eax,%ebx
+		n = rnd() % 8 == 0 ? rnd() % 16384 : 16 + rnd() % 512;
+  8004b1:	e8 7f fb ff ff       	call   800035 <rnd>
+  8004b6:	a8 07                	test   $0x7,%al
+  8004b8:	75 ab                	jne    800465 <umain+0x1d5>
+  8004ba:	e8 76 fb ff ff       	call   800035 <rnd>
+  8004bf:	25 ff 3f 00 00       	and    $0x3fff,%eax
+  8004c4:	89 c7                	mov    %eax,%edi
+		if (!slot[i])
+  8004c6:	83 3c 9d 80 70 80 00 	cmpl   $0x0,0x807080(,%ebx,4)
+  8004cd:	00 
+  8004ce:	74 a4                	je     800474 <umain+0x1e4>
+		else if (rnd() % 4 == 0)
+  8004d0:	e8 60 fb ff ff       	call   800035 <rnd>
+  8004d5:	a8 03                	test   $0x3,%al
+  8004d7:	75 a9                	jne    800482 <umain+0x1f2>
+			slot[i] = realloc(slot[i], n);
+  8004d9:	83 ec 08             	sub    $0x8,%esp
+  8004dc:	57                   	push   %edi
+  8004dd:	ff 34 9d 80 70 80 00 	push   0x807080(,%ebx,4)
+  8004e4:	e8 57 35 00 00       	call   803a40 <realloc>
+  8004e9:	83 c4 10             	add    $0x10,%esp
+  8004ec:	eb ab                	jmp    800499 <umain+0x209>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8004ee:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8004f1:	89 e3                	mov    %esp,%ebx
+  8004f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8004f8:	29 d8                	sub    %ebx,%eax
+  8004fa:	89 c3                	mov    %eax,%ebx
+  8004fc:	c1 eb 0f             	shr    $0xf,%ebx
+  8004ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800504:	0f 42 f3             	cmovb  %ebx,%esi
+	report("mixed", NOPS, read_tsc() - t0, thisenv->env_syscalls - s0);
+  800507:	8b 04 b5 a0 bf 80 00 	mov    0x80bfa0(,%esi,4),%eax
+  80050e:	8b 58 5c             	mov    0x5c(%eax),%ebx
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  800511:	0f 31                	rdtsc
+  800513:	83 ec 04             	sub    $0x4,%esp
+  800516:	29 fb                	sub    %edi,%ebx
+  800518:	53                   	push   %ebx
+  800519:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  80051c:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  80051f:	52                   	push   %edx
+  800520:	50                   	push   %eax
+  800521:	ba 20 4e 00 00       	mov    $0x4e20,%edx
+  800526:	b8 c1 55 80 00       	mov    $0x8055c1,%eax
+  80052b:	e8 1d fb ff ff       	call   80004d <report>
+  800530:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NMIXED; i++)
+  800533:	bb 00 00 00 00       	mov    $0x0,%ebx
+		free(slot[i]);
+  800538:	83 ec 0c             	sub    $0xc,%esp
+  80053b:	ff 34 9d 80 70 80 00 	push   0x807080(,%ebx,4)
+  800542:	e8 18 34 00 00       	call   80395f <free>
+	for (i = 0; i < NMIXED; i++)
+  800547:	83 c3 01             	add    $0x1,%ebx
+  80054a:	83 c4 10             	add    $0x10,%esp
+  80054d:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  800553:	75 e3                	jne    800538 <umain+0x2a8>
+	bench_small();
+	bench_mixed();
+	bench_net("net");
+  800555:	b8 c7 55 80 00       	mov    $0x8055c7,%eax
+  80055a:	e8 97 fb ff ff       	call   8000f6 <bench_net>
+	// Again as one of the network server's threads, with a cache.
+	mcache_cur = &mc;
+  80055f:	c7 05 00 f0 80 00 00 	movl   $0x807000,0x80f000
+  800566:	70 80 00 
+	bench_net("net+tc");
+  800569:	b8 cb 55 80 00       	mov    $0x8055cb,%eax
+  80056e:	e8 83 fb ff ff       	call   8000f6 <bench_net>
+	mcache_cur = NULL;
+  800573:	c7 05 00 f0 80 00 00 	movl   $0x0,0x80f000
+  80057a:	00 00 00 
+	mcache_flush(&mc);
+  80057d:	83 ec 0c             	sub    $0xc,%esp
+  800580:	68 00 70 80 00       	push   $0x807000
+  800585:	e8 ef 33 00 00       	call   803979 <mcache_flush>
+	report("end", 1, 0, 0);
+  80058a:	83 c4 0c             	add    $0xc,%esp
+  80058d:	6a 00                	push   $0x0
+  80058f:	6a 00                	push   $0x0
+  800591:	6a 00                	push   $0x0
+  800593:	ba 01 00 00 00       	mov    $0x1,%edx
+  800598:	b8 d2 55 80 00       	mov    $0x8055d2,%eax
+  80059d:	e8 ab fa ff ff       	call   80004d <report>
+}
+  8005a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a5:	5b                   	pop    %ebx
+  8005a6:	5e                   	pop    %esi
+  8005a7:	5f                   	pop    %edi
+  8005a8:	5d                   	pop    %ebp
+  8005a9:	c3                   	ret
+
+008005aa <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005aa:	55                   	push   %ebp
+  8005ab:	89 e5                	mov    %esp,%ebp
+  8005ad:	56                   	push   %esi
+  8005ae:	53                   	push   %ebx
+  8005af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8005b5:	89 e2                	mov    %esp,%edx
+  8005b7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8005bc:	29 d0                	sub    %edx,%eax
+  8005be:	89 c2                	mov    %eax,%edx
+  8005c0:	c1 ea 0f             	shr    $0xf,%edx
+  8005c3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8005c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cd:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8005d0:	c7 04 85 a0 bf 80 00 	movl   $0x0,0x80bfa0(,%eax,4)
+  8005d7:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8005db:	e8 39 0c 00 00       	call   801219 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8005e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005e5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8005eb:	89 e1                	mov    %esp,%ecx
+  8005ed:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8005f2:	29 ca                	sub    %ecx,%edx
+  8005f4:	89 d1                	mov    %edx,%ecx
+  8005f6:	c1 e9 0f             	shr    $0xf,%ecx
+  8005f9:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8005ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800604:	0f 42 d1             	cmovb  %ecx,%edx
+  800607:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80060c:	89 04 95 a0 bf 80 00 	mov    %eax,0x80bfa0(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800613:	85 db                	test   %ebx,%ebx
+  800615:	7e 07                	jle    80061e <libmain+0x74>
+		binaryname = argv[0];
+  800617:	8b 06                	mov    (%esi),%eax
+  800619:	a3 04 60 80 00       	mov    %eax,0x806004
+
+	// call user main routine
+	umain(argc, argv);
+  80061e:	83 ec 08             	sub    $0x8,%esp
+  800621:	56                   	push   %esi
+  800622:	53                   	push   %ebx
+  800623:	e8 68 fc ff ff       	call   800290 <umain>
+
+	// exit gracefully
+	exit();
+  800628:	e8 0a 00 00 00       	call   800637 <exit>
+}
+  80062d:	83 c4 10             	add    $0x10,%esp
+  800630:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800633:	5b                   	pop    %ebx
+  800634:	5e                   	pop    %esi
+  800635:	5d                   	pop    %ebp
+  800636:	c3                   	ret
+
+00800637 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800637:	55                   	push   %ebp
+  800638:	89 e5                	mov    %esp,%ebp
+  80063a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80063d:	e8 61 12 00 00       	call   8018a3 <close_all>
+	sys_env_destroy(0);
+  800642:	83 ec 0c             	sub    $0xc,%esp
+  800645:	6a 00                	push   $0x0
+  800647:	e8 8c 0b 00 00       	call   8011d8 <sys_env_destroy>
+}
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	c9                   	leave
+  800650:	c3                   	ret
+
+00800651 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800651:	55                   	push   %ebp
+  800652:	89 e5                	mov    %esp,%ebp
+  800654:	56                   	push   %esi
+  800655:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800656:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800659:	8b 35 04 60 80 00    	mov    0x806004,%esi
+  80065f:	e8 b5 0b 00 00       	call   801219 <sys_getenvid>
+  800664:	83 ec 0c             	sub    $0xc,%esp
+  800667:	ff 75 0c             	push   0xc(%ebp)
+  80066a:	ff 75 08             	push   0x8(%ebp)
+  80066d:	56                   	push   %esi
+  80066e:	50                   	push   %eax
+  80066f:	68 e0 55 80 00       	push   $0x8055e0
+  800674:	e8 b3 00 00 00       	call   80072c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800679:	83 c4 18             	add    $0x18,%esp
+  80067c:	53                   	push   %ebx
+  80067d:	ff 75 10             	push   0x10(%ebp)
+  800680:	e8 56 00 00 00       	call   8006db <vcprintf>
+	cprintf("\n");
+  800685:	c7 04 24 1d 5b 80 00 	movl   $0x805b1d,(%esp)
+  80068c:	e8 9b 00 00 00       	call   80072c <cprintf>
+  800691:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800694:	cc                   	int3
+	while (1)
+  800695:	eb fd                	jmp    800694 <_panic+0x43>
+
+00800697 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800697:	55                   	push   %ebp
+  800698:	89 e5                	mov    %esp,%ebp
+  80069a:	53                   	push   %ebx
+  80069b:	83 ec 04             	sub    $0x4,%esp
+  80069e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8006a1:	8b 13                	mov    (%ebx),%edx
+  8006a3:	8d 42 01             	lea    0x1(%edx),%eax
+  8006a6:	89 03                	mov    %eax,(%ebx)
+  8006a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006ab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006af:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006b4:	74 09                	je     8006bf <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006b6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006bd:	c9                   	leave
+  8006be:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006bf:	83 ec 08             	sub    $0x8,%esp
+  8006c2:	68 ff 00 00 00       	push   $0xff
+  8006c7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006ca:	50                   	push   %eax
+  8006cb:	e8 cb 0a 00 00       	call   80119b <sys_cputs>
+		b->idx = 0;
+  8006d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006d6:	83 c4 10             	add    $0x10,%esp
+  8006d9:	eb db                	jmp    8006b6 <putch+0x1f>
+
+008006db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006db:	55                   	push   %ebp
+  8006dc:	89 e5                	mov    %esp,%ebp
+  8006de:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8006e4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006eb:	00 00 00 
+	b.cnt = 0;
+  8006ee:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006f5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006f8:	ff 75 0c             	push   0xc(%ebp)
+  8006fb:	ff 75 08             	push   0x8(%ebp)
+  8006fe:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800704:	50                   	push   %eax
+  800705:	68 97 06 80 00       	push   $0x800697
+  80070a:	e8 1c 01 00 00       	call   80082b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80070f:	83 c4 08             	add    $0x8,%esp
+  800712:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800718:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80071e:	50                   	push   %eax
+  80071f:	e8 77 0a 00 00       	call   80119b <sys_cputs>
+
+	return b.cnt;
+}
+  800724:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80072a:	c9                   	leave
+  80072b:	c3                   	ret
+
+0080072c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80072c:	55                   	push   %ebp
+  80072d:	89 e5                	mov    %esp,%ebp
+  80072f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800732:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800735:	50                   	push   %eax
+  800736:	ff 75 08             	push   0x8(%ebp)
+  800739:	e8 9d ff ff ff       	call   8006db <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80073e:	c9                   	leave
+  80073f:	c3                   	ret
+
+00800740 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800740:	55                   	push   %ebp
+  800741:	89 e5                	mov    %esp,%ebp
+  800743:	57                   	push   %edi
+  800744:	56                   	push   %esi
+  800745:	53                   	push   %ebx
+  800746:	83 ec 1c             	sub    $0x1c,%esp
+  800749:	89 c3                	mov    %eax,%ebx
+  80074b:	89 d6                	mov    %edx,%esi
+  80074d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800750:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800753:	89 d1                	mov    %edx,%ecx
+  800755:	89 c2                	mov    %eax,%edx
+  800757:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80075d:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800760:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800763:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80076a:	39 c2                	cmp    %eax,%edx
+  80076c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80076f:	73 4b                	jae    8007bc <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800777:	85 ff                	test   %edi,%edi
+  800779:	7e 11                	jle    80078c <printnum+0x4c>
+			putch(padc, putdat);
+  80077b:	83 ec 08             	sub    $0x8,%esp
+  80077e:	56                   	push   %esi
+  80077f:	ff 75 18             	push   0x18(%ebp)
+  800782:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800784:	83 c4 10             	add    $0x10,%esp
+  800787:	83 ef 01             	sub    $0x1,%edi
+  80078a:	75 ef                	jne    80077b <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80078c:	83 ec 08             	sub    $0x8,%esp
+  80078f:	56                   	push   %esi
+  800790:	83 ec 04             	sub    $0x4,%esp
+  800793:	ff 75 e4             	push   -0x1c(%ebp)
+  800796:	ff 75 e0             	push   -0x20(%ebp)
+  800799:	ff 75 dc             	push   -0x24(%ebp)
+  80079c:	ff 75 d8             	push   -0x28(%ebp)
+  80079f:	e8 40 4c 00 00       	call   8053e4 <__umoddi3>
+  8007a4:	83 c4 14             	add    $0x14,%esp
+  8007a7:	0f be 80 03 56 80 00 	movsbl 0x805603(%eax),%eax
+  8007ae:	50                   	push   %eax
+  8007af:	ff d3                	call   *%ebx
+}
+  8007b1:	83 c4 10             	add    $0x10,%esp
+  8007b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007b7:	5b                   	pop    %ebx
+  8007b8:	5e                   	pop    %esi
+  8007b9:	5f                   	pop    %edi
+  8007ba:	5d                   	pop    %ebp
+  8007bb:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007bc:	83 ec 0c             	sub    $0xc,%esp
+  8007bf:	ff 75 18             	push   0x18(%ebp)
+  8007c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007c5:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8007c8:	52                   	push   %edx
+  8007c9:	50                   	push   %eax
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	ff 75 e4             	push   -0x1c(%ebp)
+  8007d0:	ff 75 e0             	push   -0x20(%ebp)
+  8007d3:	ff 75 dc             	push   -0x24(%ebp)
+  8007d6:	ff 75 d8             	push   -0x28(%ebp)
+  8007d9:	e8 40 4b 00 00       	call   80531e <__udivdi3>
+  8007de:	83 c4 18             	add    $0x18,%esp
+  8007e1:	52                   	push   %edx
+  8007e2:	50                   	push   %eax
+  8007e3:	89 f2                	mov    %esi,%edx
+  8007e5:	89 d8                	mov    %ebx,%eax
+  8007e7:	e8 54 ff ff ff       	call   800740 <printnum>
+  8007ec:	83 c4 20             	add    $0x20,%esp
+  8007ef:	eb 9b                	jmp    80078c <printnum+0x4c>
+
+008007f1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8007f7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8007fb:	8b 10                	mov    (%eax),%edx
+  8007fd:	3b 50 04             	cmp    0x4(%eax),%edx
+  800800:	73 0a                	jae    80080c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800802:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800805:	89 08                	mov    %ecx,(%eax)
+  800807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080a:	88 02                	mov    %al,(%edx)
+}
+  80080c:	5d                   	pop    %ebp
+  80080d:	c3                   	ret
+
+0080080e <printfmt>:
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800814:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800817:	50                   	push   %eax
+  800818:	ff 75 10             	push   0x10(%ebp)
+  80081b:	ff 75 0c             	push   0xc(%ebp)
+  80081e:	ff 75 08             	push   0x8(%ebp)
+  800821:	e8 05 00 00 00       	call   80082b <vprintfmt>
+}
+  800826:	83 c4 10             	add    $0x10,%esp
+  800829:	c9                   	leave
+  80082a:	c3                   	ret
+
+0080082b <vprintfmt>:
+{
+  80082b:	55                   	push   %ebp
+  80082c:	89 e5                	mov    %esp,%ebp
+  80082e:	57                   	push   %edi
+  80082f:	56                   	push   %esi
+  800830:	53                   	push   %ebx
+  800831:	83 ec 2c             	sub    $0x2c,%esp
+  800834:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800837:	89 df                	mov    %ebx,%edi
+  800839:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80083c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80083f:	8d 70 01             	lea    0x1(%eax),%esi
+  800842:	0f b6 00             	movzbl (%eax),%eax
+  800845:	83 f8 25             	cmp    $0x25,%eax
+  800848:	74 1e                	je     800868 <vprintfmt+0x3d>
+			if (ch == '\0')
+  80084a:	85 c0                	test   %eax,%eax
+  80084c:	0f 84 15 05 00 00    	je     800d67 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800852:	83 ec 08             	sub    $0x8,%esp
+  800855:	53                   	push   %ebx
+  800856:	50                   	push   %eax
+  800857:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800859:	83 c6 01             	add    $0x1,%esi
+  80085c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800860:	83 c4 10             	add    $0x10,%esp
+  800863:	83 f8 25             	cmp    $0x25,%eax
+  800866:	75 e2                	jne    80084a <vprintfmt+0x1f>
+		padc = ' ';
+  800868:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80086c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800873:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80087a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800881:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800886:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800889:	8d 56 01             	lea    0x1(%esi),%edx
+  80088c:	0f b6 0e             	movzbl (%esi),%ecx
+  80088f:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800892:	3c 55                	cmp    $0x55,%al
+  800894:	0f 87 3b 04 00 00    	ja     800cd5 <vprintfmt+0x4aa>
+  80089a:	0f b6 c0             	movzbl %al,%eax
+  80089d:	ff 24 85 80 57 80 00 	jmp    *0x805780(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008a4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008a7:	eb 93                	jmp    80083c <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008a9:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8008ab:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8008af:	eb d8                	jmp    800889 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008b1:	89 d6                	mov    %edx,%esi
+  8008b3:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8008b7:	eb d0                	jmp    800889 <vprintfmt+0x5e>
+  8008b9:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8008bc:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8008bf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8008c2:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8008c6:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8008c9:	83 f9 09             	cmp    $0x9,%ecx
+  8008cc:	77 6f                	ja     80093d <vprintfmt+0x112>
+  8008ce:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8008d1:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8008d4:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8008d7:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8008db:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8008de:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8008e1:	83 fe 09             	cmp    $0x9,%esi
+  8008e4:	76 eb                	jbe    8008d1 <vprintfmt+0xa6>
+  8008e6:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8008e9:	89 d6                	mov    %edx,%esi
+  8008eb:	eb 13                	jmp    800900 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8008ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f0:	8b 00                	mov    (%eax),%eax
+  8008f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8008f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008fe:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800900:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800904:	79 83                	jns    800889 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800906:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800909:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80090c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800913:	e9 71 ff ff ff       	jmp    800889 <vprintfmt+0x5e>
+			if (width < 0)
+  800918:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80091b:	85 c9                	test   %ecx,%ecx
+  80091d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800922:	0f 49 c1             	cmovns %ecx,%eax
+  800925:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800928:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80092a:	e9 5a ff ff ff       	jmp    800889 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80092f:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800931:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800938:	e9 4c ff ff ff       	jmp    800889 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80093d:	89 d6                	mov    %edx,%esi
+  80093f:	eb bf                	jmp    800900 <vprintfmt+0xd5>
+			lflag++;
+  800941:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800945:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800947:	e9 3d ff ff ff       	jmp    800889 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80094c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80094f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800952:	8d 70 04             	lea    0x4(%eax),%esi
+  800955:	83 ec 08             	sub    $0x8,%esp
+  800958:	53                   	push   %ebx
+  800959:	ff 30                	push   (%eax)
+  80095b:	ff d7                	call   *%edi
+			break;
+  80095d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800960:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800963:	e9 d4 fe ff ff       	jmp    80083c <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800968:	89 55 10             	mov    %edx,0x10(%ebp)
+  80096b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096e:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800971:	8b 10                	mov    (%eax),%edx
+  800973:	89 d0                	mov    %edx,%eax
+  800975:	f7 d8                	neg    %eax
+  800977:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80097a:	83 f8 12             	cmp    $0x12,%eax
+  80097d:	7f 23                	jg     8009a2 <vprintfmt+0x177>
+  80097f:	8b 14 85 e0 58 80 00 	mov    0x8058e0(,%eax,4),%edx
+  800986:	85 d2                	test   %edx,%edx
+  800988:	74 18                	je     8009a2 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80098a:	52                   	push   %edx
+  80098b:	68 3b 5a 80 00       	push   $0x805a3b
+  800990:	53                   	push   %ebx
+  800991:	57                   	push   %edi
+  800992:	e8 77 fe ff ff       	call   80080e <printfmt>
+  800997:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80099a:	89 75 14             	mov    %esi,0x14(%ebp)
+  80099d:	e9 9a fe ff ff       	jmp    80083c <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8009a2:	50                   	push   %eax
+  8009a3:	68 1b 56 80 00       	push   $0x80561b
+  8009a8:	53                   	push   %ebx
+  8009a9:	57                   	push   %edi
+  8009aa:	e8 5f fe ff ff       	call   80080e <printfmt>
+  8009af:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009b2:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8009b5:	e9 82 fe ff ff       	jmp    80083c <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009ba:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c0:	83 c0 04             	add    $0x4,%eax
+  8009c3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8009c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c9:	8b 00                	mov    (%eax),%eax
+  8009cb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009ce:	85 c0                	test   %eax,%eax
+  8009d0:	0f 84 61 03 00 00    	je     800d37 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8009d6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009da:	7e 06                	jle    8009e2 <vprintfmt+0x1b7>
+  8009dc:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009e0:	75 29                	jne    800a0b <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009e5:	8d 70 01             	lea    0x1(%eax),%esi
+  8009e8:	0f b6 00             	movzbl (%eax),%eax
+  8009eb:	0f be d0             	movsbl %al,%edx
+  8009ee:	85 d2                	test   %edx,%edx
+  8009f0:	0f 84 bb 00 00 00    	je     800ab1 <vprintfmt+0x286>
+  8009f6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009f9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009fc:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009ff:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a02:	eb 7a                	jmp    800a7e <vprintfmt+0x253>
+				p = "(null)";
+  800a04:	c7 45 d0 14 56 80 00 	movl   $0x805614,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a0b:	83 ec 08             	sub    $0x8,%esp
+  800a0e:	ff 75 d4             	push   -0x2c(%ebp)
+  800a11:	ff 75 d0             	push   -0x30(%ebp)
+  800a14:	e8 e0 03 00 00       	call   800df9 <strnlen>
+  800a19:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800a1c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800a1f:	83 c4 10             	add    $0x10,%esp
+  800a22:	85 d2                	test   %edx,%edx
+  800a24:	0f 8e d6 02 00 00    	jle    800d00 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800a2a:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800a2e:	83 ec 08             	sub    $0x8,%esp
+  800a31:	53                   	push   %ebx
+  800a32:	56                   	push   %esi
+  800a33:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a35:	83 c4 10             	add    $0x10,%esp
+  800a38:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800a3c:	75 f0                	jne    800a2e <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a3e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a41:	8d 70 01             	lea    0x1(%eax),%esi
+  800a44:	0f b6 00             	movzbl (%eax),%eax
+  800a47:	0f be d0             	movsbl %al,%edx
+  800a4a:	85 d2                	test   %edx,%edx
+  800a4c:	0f 84 da 02 00 00    	je     800d2c <vprintfmt+0x501>
+  800a52:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a55:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a58:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a5b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a5e:	eb 1e                	jmp    800a7e <vprintfmt+0x253>
+					putch(ch, putdat);
+  800a60:	83 ec 08             	sub    $0x8,%esp
+  800a63:	ff 75 0c             	push   0xc(%ebp)
+  800a66:	52                   	push   %edx
+  800a67:	ff 55 08             	call   *0x8(%ebp)
+  800a6a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a6d:	83 eb 01             	sub    $0x1,%ebx
+  800a70:	83 c6 01             	add    $0x1,%esi
+  800a73:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a77:	0f be d0             	movsbl %al,%edx
+  800a7a:	85 d2                	test   %edx,%edx
+  800a7c:	74 2a                	je     800aa8 <vprintfmt+0x27d>
+  800a7e:	85 ff                	test   %edi,%edi
+  800a80:	78 05                	js     800a87 <vprintfmt+0x25c>
+  800a82:	83 ef 01             	sub    $0x1,%edi
+  800a85:	78 59                	js     800ae0 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a87:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a8b:	74 d3                	je     800a60 <vprintfmt+0x235>
+  800a8d:	0f be c0             	movsbl %al,%eax
+  800a90:	83 e8 20             	sub    $0x20,%eax
+  800a93:	83 f8 5e             	cmp    $0x5e,%eax
+  800a96:	76 c8                	jbe    800a60 <vprintfmt+0x235>
+					putch('?', putdat);
+  800a98:	83 ec 08             	sub    $0x8,%esp
+  800a9b:	ff 75 0c             	push   0xc(%ebp)
+  800a9e:	6a 3f                	push   $0x3f
+  800aa0:	ff 55 08             	call   *0x8(%ebp)
+  800aa3:	83 c4 10             	add    $0x10,%esp
+  800aa6:	eb c5                	jmp    800a6d <vprintfmt+0x242>
+  800aa8:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800aab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800ab1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800ab4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800ab8:	7e 1b                	jle    800ad5 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800aba:	83 ec 08             	sub    $0x8,%esp
+  800abd:	53                   	push   %ebx
+  800abe:	6a 20                	push   $0x20
+  800ac0:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800ac2:	83 c4 10             	add    $0x10,%esp
+  800ac5:	83 ee 01             	sub    $0x1,%esi
+  800ac8:	75 f0                	jne    800aba <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800aca:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800acd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad0:	e9 67 fd ff ff       	jmp    80083c <vprintfmt+0x11>
+  800ad5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ad8:	89 45 14             	mov    %eax,0x14(%ebp)
+  800adb:	e9 5c fd ff ff       	jmp    80083c <vprintfmt+0x11>
+  800ae0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ae3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ae6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ae9:	eb c6                	jmp    800ab1 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800aeb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800aee:	89 55 10             	mov    %edx,0x10(%ebp)
+  800af1:	83 f9 01             	cmp    $0x1,%ecx
+  800af4:	7f 1f                	jg     800b15 <vprintfmt+0x2ea>
+	else if (lflag)
+  800af6:	85 c9                	test   %ecx,%ecx
+  800af8:	74 67                	je     800b61 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800afa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afd:	8b 30                	mov    (%eax),%esi
+  800aff:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b02:	89 f0                	mov    %esi,%eax
+  800b04:	c1 f8 1f             	sar    $0x1f,%eax
+  800b07:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b10:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b13:	eb 17                	jmp    800b2c <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b18:	8b 50 04             	mov    0x4(%eax),%edx
+  800b1b:	8b 00                	mov    (%eax),%eax
+  800b1d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b20:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b26:	8d 40 08             	lea    0x8(%eax),%eax
+  800b29:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b2c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b2f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b32:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800b37:	85 c9                	test   %ecx,%ecx
+  800b39:	0f 89 12 01 00 00    	jns    800c51 <vprintfmt+0x426>
+				putch('-', putdat);
+  800b3f:	83 ec 08             	sub    $0x8,%esp
+  800b42:	53                   	push   %ebx
+  800b43:	6a 2d                	push   $0x2d
+  800b45:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800b47:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b4a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b4d:	f7 da                	neg    %edx
+  800b4f:	83 d1 00             	adc    $0x0,%ecx
+  800b52:	f7 d9                	neg    %ecx
+  800b54:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b57:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b5c:	e9 f0 00 00 00       	jmp    800c51 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800b61:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b64:	8b 30                	mov    (%eax),%esi
+  800b66:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b69:	89 f0                	mov    %esi,%eax
+  800b6b:	c1 f8 1f             	sar    $0x1f,%eax
+  800b6e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b74:	8d 40 04             	lea    0x4(%eax),%eax
+  800b77:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b7a:	eb b0                	jmp    800b2c <vprintfmt+0x301>
+	if (lflag >= 2)
+  800b7c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b7f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b82:	83 f9 01             	cmp    $0x1,%ecx
+  800b85:	7f 1e                	jg     800ba5 <vprintfmt+0x37a>
+	else if (lflag)
+  800b87:	85 c9                	test   %ecx,%ecx
+  800b89:	74 32                	je     800bbd <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800b8b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8e:	8b 10                	mov    (%eax),%edx
+  800b90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b95:	8d 40 04             	lea    0x4(%eax),%eax
+  800b98:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b9b:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800ba0:	e9 ac 00 00 00       	jmp    800c51 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800ba5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba8:	8b 10                	mov    (%eax),%edx
+  800baa:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bad:	8d 40 08             	lea    0x8(%eax),%eax
+  800bb0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bb3:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800bb8:	e9 94 00 00 00       	jmp    800c51 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800bbd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc0:	8b 10                	mov    (%eax),%edx
+  800bc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc7:	8d 40 04             	lea    0x4(%eax),%eax
+  800bca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bcd:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800bd2:	eb 7d                	jmp    800c51 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800bd4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800bd7:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bda:	83 f9 01             	cmp    $0x1,%ecx
+  800bdd:	7f 1b                	jg     800bfa <vprintfmt+0x3cf>
+	else if (lflag)
+  800bdf:	85 c9                	test   %ecx,%ecx
+  800be1:	74 2c                	je     800c0f <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800be3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be6:	8b 10                	mov    (%eax),%edx
+  800be8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bed:	8d 40 04             	lea    0x4(%eax),%eax
+  800bf0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bf3:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800bf8:	eb 57                	jmp    800c51 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800bfa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bfd:	8b 10                	mov    (%eax),%edx
+  800bff:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c02:	8d 40 08             	lea    0x8(%eax),%eax
+  800c05:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c08:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800c0d:	eb 42                	jmp    800c51 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800c0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c12:	8b 10                	mov    (%eax),%edx
+  800c14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c19:	8d 40 04             	lea    0x4(%eax),%eax
+  800c1c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c1f:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800c24:	eb 2b                	jmp    800c51 <vprintfmt+0x426>
+			putch('0', putdat);
+  800c26:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c29:	83 ec 08             	sub    $0x8,%esp
+  800c2c:	53                   	push   %ebx
+  800c2d:	6a 30                	push   $0x30
+  800c2f:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800c31:	83 c4 08             	add    $0x8,%esp
+  800c34:	53                   	push   %ebx
+  800c35:	6a 78                	push   $0x78
+  800c37:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800c39:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3c:	8b 10                	mov    (%eax),%edx
+  800c3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c43:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c46:	8d 40 04             	lea    0x4(%eax),%eax
+  800c49:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c4c:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800c51:	83 ec 0c             	sub    $0xc,%esp
+  800c54:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800c58:	50                   	push   %eax
+  800c59:	ff 75 e4             	push   -0x1c(%ebp)
+  800c5c:	56                   	push   %esi
+  800c5d:	51                   	push   %ecx
+  800c5e:	52                   	push   %edx
+  800c5f:	89 da                	mov    %ebx,%edx
+  800c61:	89 f8                	mov    %edi,%eax
+  800c63:	e8 d8 fa ff ff       	call   800740 <printnum>
+			break;
+  800c68:	83 c4 20             	add    $0x20,%esp
+  800c6b:	e9 cc fb ff ff       	jmp    80083c <vprintfmt+0x11>
+	if (lflag >= 2)
+  800c70:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c73:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c76:	83 f9 01             	cmp    $0x1,%ecx
+  800c79:	7f 1b                	jg     800c96 <vprintfmt+0x46b>
+	else if (lflag)
+  800c7b:	85 c9                	test   %ecx,%ecx
+  800c7d:	74 2c                	je     800cab <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800c7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c82:	8b 10                	mov    (%eax),%edx
+  800c84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c89:	8d 40 04             	lea    0x4(%eax),%eax
+  800c8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c8f:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800c94:	eb bb                	jmp    800c51 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800c96:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c99:	8b 10                	mov    (%eax),%edx
+  800c9b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c9e:	8d 40 08             	lea    0x8(%eax),%eax
+  800ca1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ca4:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800ca9:	eb a6                	jmp    800c51 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800cab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cae:	8b 10                	mov    (%eax),%edx
+  800cb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb5:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cbb:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800cc0:	eb 8f                	jmp    800c51 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800cc2:	89 55 10             	mov    %edx,0x10(%ebp)
+  800cc5:	83 ec 08             	sub    $0x8,%esp
+  800cc8:	53                   	push   %ebx
+  800cc9:	6a 25                	push   $0x25
+  800ccb:	ff d7                	call   *%edi
+			break;
+  800ccd:	83 c4 10             	add    $0x10,%esp
+  800cd0:	e9 67 fb ff ff       	jmp    80083c <vprintfmt+0x11>
+			putch('%', putdat);
+  800cd5:	83 ec 08             	sub    $0x8,%esp
+  800cd8:	53                   	push   %ebx
+  800cd9:	6a 25                	push   $0x25
+  800cdb:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800cdd:	83 c4 10             	add    $0x10,%esp
+  800ce0:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800ce4:	0f 84 ba fb ff ff    	je     8008a4 <vprintfmt+0x79>
+  800cea:	89 75 10             	mov    %esi,0x10(%ebp)
+  800ced:	89 f0                	mov    %esi,%eax
+  800cef:	83 e8 01             	sub    $0x1,%eax
+  800cf2:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800cf6:	75 f7                	jne    800cef <vprintfmt+0x4c4>
+  800cf8:	89 45 10             	mov    %eax,0x10(%ebp)
+  800cfb:	e9 3c fb ff ff       	jmp    80083c <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d03:	8d 70 01             	lea    0x1(%eax),%esi
+  800d06:	0f b6 00             	movzbl (%eax),%eax
+  800d09:	0f be d0             	movsbl %al,%edx
+  800d0c:	85 d2                	test   %edx,%edx
+  800d0e:	74 11                	je     800d21 <vprintfmt+0x4f6>
+  800d10:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d13:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d16:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d19:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d1c:	e9 5d fd ff ff       	jmp    800a7e <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d21:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d24:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d27:	e9 10 fb ff ff       	jmp    80083c <vprintfmt+0x11>
+  800d2c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d2f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d32:	e9 05 fb ff ff       	jmp    80083c <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800d37:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800d3b:	7e 0a                	jle    800d47 <vprintfmt+0x51c>
+  800d3d:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800d41:	0f 85 bd fc ff ff    	jne    800a04 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d47:	ba 28 00 00 00       	mov    $0x28,%edx
+  800d4c:	b8 28 00 00 00       	mov    $0x28,%eax
+  800d51:	be 15 56 80 00       	mov    $0x805615,%esi
+  800d56:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d59:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d5c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d5f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d62:	e9 17 fd ff ff       	jmp    800a7e <vprintfmt+0x253>
+}
+  800d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	83 ec 18             	sub    $0x18,%esp
+  800d75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d78:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800d7b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d7e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d82:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d85:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d8c:	85 c0                	test   %eax,%eax
+  800d8e:	74 26                	je     800db6 <vsnprintf+0x47>
+  800d90:	85 d2                	test   %edx,%edx
+  800d92:	7e 22                	jle    800db6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d94:	ff 75 14             	push   0x14(%ebp)
+  800d97:	ff 75 10             	push   0x10(%ebp)
+  800d9a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d9d:	50                   	push   %eax
+  800d9e:	68 f1 07 80 00       	push   $0x8007f1
+  800da3:	e8 83 fa ff ff       	call   80082b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800da8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800dab:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800dae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800db1:	83 c4 10             	add    $0x10,%esp
+}
+  800db4:	c9                   	leave
+  800db5:	c3                   	ret
+		return -E_INVAL;
+  800db6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dbb:	eb f7                	jmp    800db4 <vsnprintf+0x45>
+
+00800dbd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800dc3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800dc6:	50                   	push   %eax
+  800dc7:	ff 75 10             	push   0x10(%ebp)
+  800dca:	ff 75 0c             	push   0xc(%ebp)
+  800dcd:	ff 75 08             	push   0x8(%ebp)
+  800dd0:	e8 9a ff ff ff       	call   800d6f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800dd5:	c9                   	leave
+  800dd6:	c3                   	ret
+
+00800dd7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ddd:	80 3a 00             	cmpb   $0x0,(%edx)
+  800de0:	74 10                	je     800df2 <strlen+0x1b>
+  800de2:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800de7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800dea:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800dee:	75 f7                	jne    800de7 <strlen+0x10>
+	return n;
+}
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800df2:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800df7:	eb f7                	jmp    800df0 <strlen+0x19>
+
+00800df9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e02:	85 d2                	test   %edx,%edx
+  800e04:	74 16                	je     800e1c <strnlen+0x23>
+  800e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800e0f:	74 09                	je     800e1a <strnlen+0x21>
+		n++;
+  800e11:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e14:	39 d0                	cmp    %edx,%eax
+  800e16:	75 f3                	jne    800e0b <strnlen+0x12>
+		n++;
+  800e18:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e21:	eb f7                	jmp    800e1a <strnlen+0x21>
+
+00800e23 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	53                   	push   %ebx
+  800e27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e32:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e36:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e39:	83 c0 01             	add    $0x1,%eax
+  800e3c:	84 d2                	test   %dl,%dl
+  800e3e:	75 f2                	jne    800e32 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800e40:	89 c8                	mov    %ecx,%eax
+  800e42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e45:	c9                   	leave
+  800e46:	c3                   	ret
+
+00800e47 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	53                   	push   %ebx
+  800e4b:	83 ec 10             	sub    $0x10,%esp
+  800e4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e51:	53                   	push   %ebx
+  800e52:	e8 80 ff ff ff       	call   800dd7 <strlen>
+  800e57:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e5a:	ff 75 0c             	push   0xc(%ebp)
+  800e5d:	01 d8                	add    %ebx,%eax
+  800e5f:	50                   	push   %eax
+  800e60:	e8 be ff ff ff       	call   800e23 <strcpy>
+	return dst;
+}
+  800e65:	89 d8                	mov    %ebx,%eax
+  800e67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e6a:	c9                   	leave
+  800e6b:	c3                   	ret
+
+00800e6c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  800e71:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800e7a:	85 db                	test   %ebx,%ebx
+  800e7c:	74 17                	je     800e95 <strncpy+0x29>
+  800e7e:	01 f3                	add    %esi,%ebx
+  800e80:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800e82:	83 c0 01             	add    $0x1,%eax
+  800e85:	0f b6 0a             	movzbl (%edx),%ecx
+  800e88:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800e8b:	80 f9 01             	cmp    $0x1,%cl
+  800e8e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e91:	39 c3                	cmp    %eax,%ebx
+  800e93:	75 ed                	jne    800e82 <strncpy+0x16>
+	}
+	return ret;
+}
+  800e95:	89 f0                	mov    %esi,%eax
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+
+00800e9b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	56                   	push   %esi
+  800e9f:	53                   	push   %ebx
+  800ea0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ea6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ea9:	89 f0                	mov    %esi,%eax
+  800eab:	85 db                	test   %ebx,%ebx
+  800ead:	74 1e                	je     800ecd <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800eaf:	83 eb 01             	sub    $0x1,%ebx
+  800eb2:	74 16                	je     800eca <strlcpy+0x2f>
+  800eb4:	01 f3                	add    %esi,%ebx
+  800eb6:	0f b6 0a             	movzbl (%edx),%ecx
+  800eb9:	84 c9                	test   %cl,%cl
+  800ebb:	74 0d                	je     800eca <strlcpy+0x2f>
+			*dst++ = *src++;
+  800ebd:	83 c2 01             	add    $0x1,%edx
+  800ec0:	83 c0 01             	add    $0x1,%eax
+  800ec3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ec6:	39 d8                	cmp    %ebx,%eax
+  800ec8:	75 ec                	jne    800eb6 <strlcpy+0x1b>
+		*dst = '\0';
+  800eca:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ecd:	29 f0                	sub    %esi,%eax
+}
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	c3                   	ret
+
+00800ed3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ed9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800edc:	0f b6 01             	movzbl (%ecx),%eax
+  800edf:	84 c0                	test   %al,%al
+  800ee1:	74 11                	je     800ef4 <strcmp+0x21>
+  800ee3:	38 02                	cmp    %al,(%edx)
+  800ee5:	75 0d                	jne    800ef4 <strcmp+0x21>
+		p++, q++;
+  800ee7:	83 c1 01             	add    $0x1,%ecx
+  800eea:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800eed:	0f b6 01             	movzbl (%ecx),%eax
+  800ef0:	84 c0                	test   %al,%al
+  800ef2:	75 ef                	jne    800ee3 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ef4:	0f b6 c0             	movzbl %al,%eax
+  800ef7:	0f b6 12             	movzbl (%edx),%edx
+  800efa:	29 d0                	sub    %edx,%eax
+}
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+
+00800efe <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	53                   	push   %ebx
+  800f02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f08:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800f10:	85 d2                	test   %edx,%edx
+  800f12:	74 2e                	je     800f42 <strncmp+0x44>
+  800f14:	0f b6 01             	movzbl (%ecx),%eax
+  800f17:	84 c0                	test   %al,%al
+  800f19:	74 16                	je     800f31 <strncmp+0x33>
+  800f1b:	3a 03                	cmp    (%ebx),%al
+  800f1d:	75 12                	jne    800f31 <strncmp+0x33>
+		n--, p++, q++;
+  800f1f:	83 c1 01             	add    $0x1,%ecx
+  800f22:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800f25:	83 ea 01             	sub    $0x1,%edx
+  800f28:	75 ea                	jne    800f14 <strncmp+0x16>
+		return 0;
+  800f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2f:	eb 11                	jmp    800f42 <strncmp+0x44>
+  800f31:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800f36:	85 d2                	test   %edx,%edx
+  800f38:	74 08                	je     800f42 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f3a:	0f b6 01             	movzbl (%ecx),%eax
+  800f3d:	0f b6 13             	movzbl (%ebx),%edx
+  800f40:	29 d0                	sub    %edx,%eax
+}
+  800f42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f45:	c9                   	leave
+  800f46:	c3                   	ret
+
+00800f47 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800f47:	55                   	push   %ebp
+  800f48:	89 e5                	mov    %esp,%ebp
+  800f4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f51:	0f b6 10             	movzbl (%eax),%edx
+  800f54:	84 d2                	test   %dl,%dl
+  800f56:	74 15                	je     800f6d <strchr+0x26>
+		if (*s == c)
+  800f58:	38 d1                	cmp    %dl,%cl
+  800f5a:	74 0f                	je     800f6b <strchr+0x24>
+	for (; *s; s++)
+  800f5c:	83 c0 01             	add    $0x1,%eax
+  800f5f:	0f b6 10             	movzbl (%eax),%edx
+  800f62:	84 d2                	test   %dl,%dl
+  800f64:	75 f2                	jne    800f58 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+	return 0;
+  800f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f72:	eb f7                	jmp    800f6b <strchr+0x24>
+
+00800f74 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	53                   	push   %ebx
+  800f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800f7e:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800f81:	38 d3                	cmp    %dl,%bl
+  800f83:	74 14                	je     800f99 <strfind+0x25>
+  800f85:	89 d1                	mov    %edx,%ecx
+  800f87:	84 db                	test   %bl,%bl
+  800f89:	74 0e                	je     800f99 <strfind+0x25>
+	for (; *s; s++)
+  800f8b:	83 c0 01             	add    $0x1,%eax
+  800f8e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800f91:	38 ca                	cmp    %cl,%dl
+  800f93:	74 04                	je     800f99 <strfind+0x25>
+  800f95:	84 d2                	test   %dl,%dl
+  800f97:	75 f2                	jne    800f8b <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800f99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f9c:	c9                   	leave
+  800f9d:	c3                   	ret
+
+00800f9e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	57                   	push   %edi
+  800fa2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fa5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800fa8:	85 c9                	test   %ecx,%ecx
+  800faa:	74 20                	je     800fcc <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800fac:	89 f8                	mov    %edi,%eax
+  800fae:	09 c8                	or     %ecx,%eax
+  800fb0:	a8 03                	test   $0x3,%al
+  800fb2:	75 12                	jne    800fc6 <memset+0x28>
+		c &= 0xFF;
+  800fb4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800fb8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800fbe:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800fc1:	fc                   	cld
+  800fc2:	f3 ab                	rep stos %eax,%es:(%edi)
+  800fc4:	eb 06                	jmp    800fcc <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800fc6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fc9:	fc                   	cld
+  800fca:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800fcc:	89 f8                	mov    %edi,%eax
+  800fce:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800fd1:	c9                   	leave
+  800fd2:	c3                   	ret
+
+00800fd3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fdb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800fde:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800fe1:	39 c6                	cmp    %eax,%esi
+  800fe3:	73 32                	jae    801017 <memmove+0x44>
+  800fe5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800fe8:	39 d0                	cmp    %edx,%eax
+  800fea:	73 2b                	jae    801017 <memmove+0x44>
+		s += n;
+		d += n;
+  800fec:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800fef:	89 d6                	mov    %edx,%esi
+  800ff1:	09 fe                	or     %edi,%esi
+  800ff3:	09 ce                	or     %ecx,%esi
+  800ff5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ffb:	75 0e                	jne    80100b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ffd:	83 ef 04             	sub    $0x4,%edi
+  801000:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801003:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801006:	fd                   	std
+  801007:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801009:	eb 09                	jmp    801014 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80100b:	83 ef 01             	sub    $0x1,%edi
+  80100e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801011:	fd                   	std
+  801012:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801014:	fc                   	cld
+  801015:	eb 1a                	jmp    801031 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801017:	89 f2                	mov    %esi,%edx
+  801019:	09 c2                	or     %eax,%edx
+  80101b:	09 ca                	or     %ecx,%edx
+  80101d:	f6 c2 03             	test   $0x3,%dl
+  801020:	75 0a                	jne    80102c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801022:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801025:	89 c7                	mov    %eax,%edi
+  801027:	fc                   	cld
+  801028:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80102a:	eb 05                	jmp    801031 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80102c:	89 c7                	mov    %eax,%edi
+  80102e:	fc                   	cld
+  80102f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801031:	5e                   	pop    %esi
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80103b:	ff 75 10             	push   0x10(%ebp)
+  80103e:	ff 75 0c             	push   0xc(%ebp)
+  801041:	ff 75 08             	push   0x8(%ebp)
+  801044:	e8 8a ff ff ff       	call   800fd3 <memmove>
+}
+  801049:	c9                   	leave
+  80104a:	c3                   	ret
+
+0080104b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80104b:	55                   	push   %ebp
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	56                   	push   %esi
+  80104f:	53                   	push   %ebx
+  801050:	8b 45 08             	mov    0x8(%ebp),%eax
+  801053:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801056:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801059:	85 f6                	test   %esi,%esi
+  80105b:	74 29                	je     801086 <memcmp+0x3b>
+  80105d:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  80105f:	0f b6 08             	movzbl (%eax),%ecx
+  801062:	0f b6 1a             	movzbl (%edx),%ebx
+  801065:	38 d9                	cmp    %bl,%cl
+  801067:	75 11                	jne    80107a <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801069:	83 c0 01             	add    $0x1,%eax
+  80106c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80106f:	39 c6                	cmp    %eax,%esi
+  801071:	75 ec                	jne    80105f <memcmp+0x14>
+	}
+
+	return 0;
+  801073:	b8 00 00 00 00       	mov    $0x0,%eax
+  801078:	eb 08                	jmp    801082 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  80107a:	0f b6 c1             	movzbl %cl,%eax
+  80107d:	0f b6 db             	movzbl %bl,%ebx
+  801080:	29 d8                	sub    %ebx,%eax
+}
+  801082:	5b                   	pop    %ebx
+  801083:	5e                   	pop    %esi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+	return 0;
+  801086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108b:	eb f5                	jmp    801082 <memcmp+0x37>
+
+0080108d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	8b 45 08             	mov    0x8(%ebp),%eax
+  801093:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801096:	89 c2                	mov    %eax,%edx
+  801098:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80109b:	39 d0                	cmp    %edx,%eax
+  80109d:	73 0d                	jae    8010ac <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80109f:	38 08                	cmp    %cl,(%eax)
+  8010a1:	74 0d                	je     8010b0 <memfind+0x23>
+	for (; s < ends; s++)
+  8010a3:	83 c0 01             	add    $0x1,%eax
+  8010a6:	39 c2                	cmp    %eax,%edx
+  8010a8:	75 f5                	jne    80109f <memfind+0x12>
+  8010aa:	eb 06                	jmp    8010b2 <memfind+0x25>
+  8010ac:	89 c2                	mov    %eax,%edx
+  8010ae:	eb 02                	jmp    8010b2 <memfind+0x25>
+  8010b0:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  8010b2:	89 d0                	mov    %edx,%eax
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+
+008010b6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	56                   	push   %esi
+  8010bb:	53                   	push   %ebx
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8010c2:	0f b6 02             	movzbl (%edx),%eax
+  8010c5:	3c 20                	cmp    $0x20,%al
+  8010c7:	74 04                	je     8010cd <strtol+0x17>
+  8010c9:	3c 09                	cmp    $0x9,%al
+  8010cb:	75 0e                	jne    8010db <strtol+0x25>
+		s++;
+  8010cd:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8010d0:	0f b6 02             	movzbl (%edx),%eax
+  8010d3:	3c 20                	cmp    $0x20,%al
+  8010d5:	74 f6                	je     8010cd <strtol+0x17>
+  8010d7:	3c 09                	cmp    $0x9,%al
+  8010d9:	74 f2                	je     8010cd <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  8010db:	3c 2b                	cmp    $0x2b,%al
+  8010dd:	74 2a                	je     801109 <strtol+0x53>
+	int neg = 0;
+  8010df:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8010e4:	3c 2d                	cmp    $0x2d,%al
+  8010e6:	74 2b                	je     801113 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010e8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8010ee:	75 0f                	jne    8010ff <strtol+0x49>
+  8010f0:	80 3a 30             	cmpb   $0x30,(%edx)
+  8010f3:	74 28                	je     80111d <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8010f5:	85 db                	test   %ebx,%ebx
+  8010f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010fc:	0f 44 d8             	cmove  %eax,%ebx
+  8010ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801104:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801107:	eb 46                	jmp    80114f <strtol+0x99>
+		s++;
+  801109:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80110c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801111:	eb d5                	jmp    8010e8 <strtol+0x32>
+		s++, neg = 1;
+  801113:	83 c2 01             	add    $0x1,%edx
+  801116:	bf 01 00 00 00       	mov    $0x1,%edi
+  80111b:	eb cb                	jmp    8010e8 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80111d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801121:	74 0e                	je     801131 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  801123:	85 db                	test   %ebx,%ebx
+  801125:	75 d8                	jne    8010ff <strtol+0x49>
+		s++, base = 8;
+  801127:	83 c2 01             	add    $0x1,%edx
+  80112a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80112f:	eb ce                	jmp    8010ff <strtol+0x49>
+		s += 2, base = 16;
+  801131:	83 c2 02             	add    $0x2,%edx
+  801134:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801139:	eb c4                	jmp    8010ff <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80113b:	0f be c0             	movsbl %al,%eax
+  80113e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801141:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801144:	7d 3a                	jge    801180 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  801146:	83 c2 01             	add    $0x1,%edx
+  801149:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80114d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80114f:	0f b6 02             	movzbl (%edx),%eax
+  801152:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801155:	89 f3                	mov    %esi,%ebx
+  801157:	80 fb 09             	cmp    $0x9,%bl
+  80115a:	76 df                	jbe    80113b <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  80115c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80115f:	89 f3                	mov    %esi,%ebx
+  801161:	80 fb 19             	cmp    $0x19,%bl
+  801164:	77 08                	ja     80116e <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  801166:	0f be c0             	movsbl %al,%eax
+  801169:	83 e8 57             	sub    $0x57,%eax
+  80116c:	eb d3                	jmp    801141 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80116e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801171:	89 f3                	mov    %esi,%ebx
+  801173:	80 fb 19             	cmp    $0x19,%bl
+  801176:	77 08                	ja     801180 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  801178:	0f be c0             	movsbl %al,%eax
+  80117b:	83 e8 37             	sub    $0x37,%eax
+  80117e:	eb c1                	jmp    801141 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801180:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801184:	74 05                	je     80118b <strtol+0xd5>
+		*endptr = (char *) s;
+  801186:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801189:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80118b:	89 c8                	mov    %ecx,%eax
+  80118d:	f7 d8                	neg    %eax
+  80118f:	85 ff                	test   %edi,%edi
+  801191:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801194:	89 c8                	mov    %ecx,%eax
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+
+0080119b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ac:	89 c3                	mov    %eax,%ebx
+  8011ae:	89 c7                	mov    %eax,%edi
+  8011b0:	89 c6                	mov    %eax,%esi
+  8011b2:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+
+008011b9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011c9:	89 d1                	mov    %edx,%ecx
+  8011cb:	89 d3                	mov    %edx,%ebx
+  8011cd:	89 d7                	mov    %edx,%edi
+  8011cf:	89 d6                	mov    %edx,%esi
+  8011d1:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5e                   	pop    %esi
+  8011d5:	5f                   	pop    %edi
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	c3                   	ret
+
+008011d8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	57                   	push   %edi
+  8011dc:	56                   	push   %esi
+  8011dd:	53                   	push   %ebx
+  8011de:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011ee:	89 cb                	mov    %ecx,%ebx
+  8011f0:	89 cf                	mov    %ecx,%edi
+  8011f2:	89 ce                	mov    %ecx,%esi
+  8011f4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	7f 08                	jg     801202 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8011fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5f                   	pop    %edi
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801202:	83 ec 0c             	sub    $0xc,%esp
+  801205:	50                   	push   %eax
+  801206:	6a 03                	push   $0x3
+  801208:	68 4b 59 80 00       	push   $0x80594b
+  80120d:	6a 23                	push   $0x23
+  80120f:	68 68 59 80 00       	push   $0x805968
+  801214:	e8 38 f4 ff ff       	call   800651 <_panic>
+
+00801219 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	57                   	push   %edi
+  80121d:	56                   	push   %esi
+  80121e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80121f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801224:	b8 02 00 00 00       	mov    $0x2,%eax
+  801229:	89 d1                	mov    %edx,%ecx
+  80122b:	89 d3                	mov    %edx,%ebx
+  80122d:	89 d7                	mov    %edx,%edi
+  80122f:	89 d6                	mov    %edx,%esi
+  801231:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801233:	5b                   	pop    %ebx
+  801234:	5e                   	pop    %esi
+  801235:	5f                   	pop    %edi
+  801236:	5d                   	pop    %ebp
+  801237:	c3                   	ret
+
+00801238 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801238:	55                   	push   %ebp
+  801239:	89 e5                	mov    %esp,%ebp
+  80123b:	57                   	push   %edi
+  80123c:	56                   	push   %esi
+  80123d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80123e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801243:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801248:	89 d1                	mov    %edx,%ecx
+  80124a:	89 d3                	mov    %edx,%ebx
+  80124c:	89 d7                	mov    %edx,%edi
+  80124e:	89 d6                	mov    %edx,%esi
+  801250:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801252:	5b                   	pop    %ebx
+  801253:	5e                   	pop    %esi
+  801254:	5f                   	pop    %edi
+  801255:	5d                   	pop    %ebp
+  801256:	c3                   	ret
+
+00801257 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801260:	be 00 00 00 00       	mov    $0x0,%esi
+  801265:	8b 55 08             	mov    0x8(%ebp),%edx
+  801268:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801270:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801273:	89 f7                	mov    %esi,%edi
+  801275:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801277:	85 c0                	test   %eax,%eax
+  801279:	7f 08                	jg     801283 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80127b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801283:	83 ec 0c             	sub    $0xc,%esp
+  801286:	50                   	push   %eax
+  801287:	6a 04                	push   $0x4
+  801289:	68 4b 59 80 00       	push   $0x80594b
+  80128e:	6a 23                	push   $0x23
+  801290:	68 68 59 80 00       	push   $0x805968
+  801295:	e8 b7 f3 ff ff       	call   800651 <_panic>
+
+0080129a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	57                   	push   %edi
+  80129e:	56                   	push   %esi
+  80129f:	53                   	push   %ebx
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	7f 08                	jg     8012c5 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8012bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c0:	5b                   	pop    %ebx
+  8012c1:	5e                   	pop    %esi
+  8012c2:	5f                   	pop    %edi
+  8012c3:	5d                   	pop    %ebp
+  8012c4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c5:	83 ec 0c             	sub    $0xc,%esp
+  8012c8:	50                   	push   %eax
+  8012c9:	6a 05                	push   $0x5
+  8012cb:	68 4b 59 80 00       	push   $0x80594b
+  8012d0:	6a 23                	push   $0x23
+  8012d2:	68 68 59 80 00       	push   $0x805968
+  8012d7:	e8 75 f3 ff ff       	call   800651 <_panic>
+
+008012dc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	57                   	push   %edi
+  8012e0:	56                   	push   %esi
+  8012e1:	53                   	push   %ebx
+  8012e2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012f5:	89 df                	mov    %ebx,%edi
+  8012f7:	89 de                	mov    %ebx,%esi
+  8012f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012fb:	85 c0                	test   %eax,%eax
+  8012fd:	7f 08                	jg     801307 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8012ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801302:	5b                   	pop    %ebx
+  801303:	5e                   	pop    %esi
+  801304:	5f                   	pop    %edi
+  801305:	5d                   	pop    %ebp
+  801306:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801307:	83 ec 0c             	sub    $0xc,%esp
+  80130a:	50                   	push   %eax
+  80130b:	6a 06                	push   $0x6
+  80130d:	68 4b 59 80 00       	push   $0x80594b
+  801312:	6a 23                	push   $0x23
+  801314:	68 68 59 80 00       	push   $0x805968
+  801319:	e8 33 f3 ff ff       	call   800651 <_panic>
+
+0080131e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	57                   	push   %edi
+  801322:	56                   	push   %esi
+  801323:	53                   	push   %ebx
+  801324:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801327:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801332:	b8 08 00 00 00       	mov    $0x8,%eax
+  801337:	89 df                	mov    %ebx,%edi
+  801339:	89 de                	mov    %ebx,%esi
+  80133b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	7f 08                	jg     801349 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801344:	5b                   	pop    %ebx
+  801345:	5e                   	pop    %esi
+  801346:	5f                   	pop    %edi
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801349:	83 ec 0c             	sub    $0xc,%esp
+  80134c:	50                   	push   %eax
+  80134d:	6a 08                	push   $0x8
+  80134f:	68 4b 59 80 00       	push   $0x80594b
+  801354:	6a 23                	push   $0x23
+  801356:	68 68 59 80 00       	push   $0x805968
+  80135b:	e8 f1 f2 ff ff       	call   800651 <_panic>
+
+00801360 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	57                   	push   %edi
+  801364:	56                   	push   %esi
+  801365:	53                   	push   %ebx
+  801366:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801369:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	b8 09 00 00 00       	mov    $0x9,%eax
+  801379:	89 df                	mov    %ebx,%edi
+  80137b:	89 de                	mov    %ebx,%esi
+  80137d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80137f:	85 c0                	test   %eax,%eax
+  801381:	7f 08                	jg     80138b <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80138b:	83 ec 0c             	sub    $0xc,%esp
+  80138e:	50                   	push   %eax
+  80138f:	6a 09                	push   $0x9
+  801391:	68 4b 59 80 00       	push   $0x80594b
+  801396:	6a 23                	push   $0x23
+  801398:	68 68 59 80 00       	push   $0x805968
+  80139d:	e8 af f2 ff ff       	call   800651 <_panic>
+
+008013a2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	53                   	push   %ebx
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013bb:	89 df                	mov    %ebx,%edi
+  8013bd:	89 de                	mov    %ebx,%esi
+  8013bf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	7f 08                	jg     8013cd <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8013c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c8:	5b                   	pop    %ebx
+  8013c9:	5e                   	pop    %esi
+  8013ca:	5f                   	pop    %edi
+  8013cb:	5d                   	pop    %ebp
+  8013cc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013cd:	83 ec 0c             	sub    $0xc,%esp
+  8013d0:	50                   	push   %eax
+  8013d1:	6a 0a                	push   $0xa
+  8013d3:	68 4b 59 80 00       	push   $0x80594b
+  8013d8:	6a 23                	push   $0x23
+  8013da:	68 68 59 80 00       	push   $0x805968
+  8013df:	e8 6d f2 ff ff       	call   800651 <_panic>
+
+008013e4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013e4:	55                   	push   %ebp
+  8013e5:	89 e5                	mov    %esp,%ebp
+  8013e7:	57                   	push   %edi
+  8013e8:	56                   	push   %esi
+  8013e9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013fd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801400:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801402:	5b                   	pop    %ebx
+  801403:	5e                   	pop    %esi
+  801404:	5f                   	pop    %edi
+  801405:	5d                   	pop    %ebp
+  801406:	c3                   	ret
+
+00801407 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801407:	55                   	push   %ebp
+  801408:	89 e5                	mov    %esp,%ebp
+  80140a:	57                   	push   %edi
+  80140b:	56                   	push   %esi
+  80140c:	53                   	push   %ebx
+  80140d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801410:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801415:	8b 55 08             	mov    0x8(%ebp),%edx
+  801418:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80141d:	89 cb                	mov    %ecx,%ebx
+  80141f:	89 cf                	mov    %ecx,%edi
+  801421:	89 ce                	mov    %ecx,%esi
+  801423:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801425:	85 c0                	test   %eax,%eax
+  801427:	7f 08                	jg     801431 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142c:	5b                   	pop    %ebx
+  80142d:	5e                   	pop    %esi
+  80142e:	5f                   	pop    %edi
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801431:	83 ec 0c             	sub    $0xc,%esp
+  801434:	50                   	push   %eax
+  801435:	6a 0d                	push   $0xd
+  801437:	68 4b 59 80 00       	push   $0x80594b
+  80143c:	6a 23                	push   $0x23
+  80143e:	68 68 59 80 00       	push   $0x805968
+  801443:	e8 09 f2 ff ff       	call   800651 <_panic>
+
+00801448 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	57                   	push   %edi
+  80144c:	56                   	push   %esi
+  80144d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80144e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801451:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801454:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801459:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80145c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80145f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801462:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801464:	5b                   	pop    %ebx
+  801465:	5e                   	pop    %esi
+  801466:	5f                   	pop    %edi
+  801467:	5d                   	pop    %ebp
+  801468:	c3                   	ret
+
+00801469 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	57                   	push   %edi
+  80146d:	56                   	push   %esi
+  80146e:	53                   	push   %ebx
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801482:	89 df                	mov    %ebx,%edi
+  801484:	89 de                	mov    %ebx,%esi
+  801486:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801488:	85 c0                	test   %eax,%eax
+  80148a:	7f 08                	jg     801494 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80148c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80148f:	5b                   	pop    %ebx
+  801490:	5e                   	pop    %esi
+  801491:	5f                   	pop    %edi
+  801492:	5d                   	pop    %ebp
+  801493:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801494:	83 ec 0c             	sub    $0xc,%esp
+  801497:	50                   	push   %eax
+  801498:	6a 0d                	push   $0xd
+  80149a:	68 4b 59 80 00       	push   $0x80594b
+  80149f:	6a 23                	push   $0x23
+  8014a1:	68 68 59 80 00       	push   $0x805968
+  8014a6:	e8 a6 f1 ff ff       	call   800651 <_panic>
+
+008014ab <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	57                   	push   %edi
+  8014af:	56                   	push   %esi
+  8014b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014bb:	89 d1                	mov    %edx,%ecx
+  8014bd:	89 d3                	mov    %edx,%ebx
+  8014bf:	89 d7                	mov    %edx,%edi
+  8014c1:	89 d6                	mov    %edx,%esi
+  8014c3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+
+008014ca <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	57                   	push   %edi
+  8014ce:	56                   	push   %esi
+  8014cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014db:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8014e0:	89 df                	mov    %ebx,%edi
+  8014e2:	89 de                	mov    %ebx,%esi
+  8014e4:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8014e6:	5b                   	pop    %ebx
+  8014e7:	5e                   	pop    %esi
+  8014e8:	5f                   	pop    %edi
+  8014e9:	5d                   	pop    %ebp
+  8014ea:	c3                   	ret
+
+008014eb <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	57                   	push   %edi
+  8014ef:	56                   	push   %esi
+  8014f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014fe:	89 cb                	mov    %ecx,%ebx
+  801500:	89 cf                	mov    %ecx,%edi
+  801502:	89 ce                	mov    %ecx,%esi
+  801504:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801506:	5b                   	pop    %ebx
+  801507:	5e                   	pop    %esi
+  801508:	5f                   	pop    %edi
+  801509:	5d                   	pop    %ebp
+  80150a:	c3                   	ret
+
+0080150b <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	57                   	push   %edi
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801511:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801516:	8b 55 08             	mov    0x8(%ebp),%edx
+  801519:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801521:	89 df                	mov    %ebx,%edi
+  801523:	89 de                	mov    %ebx,%esi
+  801525:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801527:	5b                   	pop    %ebx
+  801528:	5e                   	pop    %esi
+  801529:	5f                   	pop    %edi
+  80152a:	5d                   	pop    %ebp
+  80152b:	c3                   	ret
+
+0080152c <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	57                   	push   %edi
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801542:	89 df                	mov    %ebx,%edi
+  801544:	89 de                	mov    %ebx,%esi
+  801546:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801548:	5b                   	pop    %ebx
+  801549:	5e                   	pop    %esi
+  80154a:	5f                   	pop    %edi
+  80154b:	5d                   	pop    %ebp
+  80154c:	c3                   	ret
+
+0080154d <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80154d:	55                   	push   %ebp
+  80154e:	89 e5                	mov    %esp,%ebp
+  801550:	57                   	push   %edi
+  801551:	56                   	push   %esi
+  801552:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801553:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801558:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801560:	89 cb                	mov    %ecx,%ebx
+  801562:	89 cf                	mov    %ecx,%edi
+  801564:	89 ce                	mov    %ecx,%esi
+  801566:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801568:	5b                   	pop    %ebx
+  801569:	5e                   	pop    %esi
+  80156a:	5f                   	pop    %edi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+
+0080156d <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	57                   	push   %edi
+  801571:	56                   	push   %esi
+  801572:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801578:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801583:	89 df                	mov    %ebx,%edi
+  801585:	89 de                	mov    %ebx,%esi
+  801587:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801589:	5b                   	pop    %ebx
+  80158a:	5e                   	pop    %esi
+  80158b:	5f                   	pop    %edi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+
+0080158e <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	56                   	push   %esi
+  801593:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801599:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159c:	b8 15 00 00 00       	mov    $0x15,%eax
+  8015a1:	89 cb                	mov    %ecx,%ebx
+  8015a3:	89 cf                	mov    %ecx,%edi
+  8015a5:	89 ce                	mov    %ecx,%esi
+  8015a7:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8015a9:	5b                   	pop    %ebx
+  8015aa:	5e                   	pop    %esi
+  8015ab:	5f                   	pop    %edi
+  8015ac:	5d                   	pop    %ebp
+  8015ad:	c3                   	ret
+
+008015ae <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	57                   	push   %edi
+  8015b2:	56                   	push   %esi
+  8015b3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bf:	b8 16 00 00 00       	mov    $0x16,%eax
+  8015c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c7:	89 f7                	mov    %esi,%edi
+  8015c9:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8015cb:	5b                   	pop    %ebx
+  8015cc:	5e                   	pop    %esi
+  8015cd:	5f                   	pop    %edi
+  8015ce:	5d                   	pop    %ebp
+  8015cf:	c3                   	ret
+
+008015d0 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8015d0:	55                   	push   %ebp
+  8015d1:	89 e5                	mov    %esp,%ebp
+  8015d3:	57                   	push   %edi
+  8015d4:	56                   	push   %esi
+  8015d5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	89 de                	mov    %ebx,%esi
+  8015ea:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8015ec:	5b                   	pop    %ebx
+  8015ed:	5e                   	pop    %esi
+  8015ee:	5f                   	pop    %edi
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	c3                   	ret
+
+008015f1 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8015f1:	55                   	push   %ebp
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	57                   	push   %edi
+  8015f5:	56                   	push   %esi
+  8015f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ff:	b8 18 00 00 00       	mov    $0x18,%eax
+  801604:	89 cb                	mov    %ecx,%ebx
+  801606:	89 cf                	mov    %ecx,%edi
+  801608:	89 ce                	mov    %ecx,%esi
+  80160a:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80160c:	5b                   	pop    %ebx
+  80160d:	5e                   	pop    %esi
+  80160e:	5f                   	pop    %edi
+  80160f:	5d                   	pop    %ebp
+  801610:	c3                   	ret
+
+00801611 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	57                   	push   %edi
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801617:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80161b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801620:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801623:	b8 19 00 00 00       	mov    $0x19,%eax
+  801628:	89 df                	mov    %ebx,%edi
+  80162a:	89 de                	mov    %ebx,%esi
+  80162c:	cd 30                	int    $0x30
+}
+  80162e:	5b                   	pop    %ebx
+  80162f:	5e                   	pop    %esi
+  801630:	5f                   	pop    %edi
+  801631:	5d                   	pop    %ebp
+  801632:	c3                   	ret
+
+00801633 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801633:	55                   	push   %ebp
+  801634:	89 e5                	mov    %esp,%ebp
+  801636:	57                   	push   %edi
+  801637:	56                   	push   %esi
+  801638:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801639:	be 00 00 00 00       	mov    $0x0,%esi
+  80163e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801641:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801644:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801649:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80164c:	89 f7                	mov    %esi,%edi
+  80164e:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5f                   	pop    %edi
+  801653:	5d                   	pop    %ebp
+  801654:	c3                   	ret
+
+00801655 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	57                   	push   %edi
+  801659:	56                   	push   %esi
+  80165a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80165b:	be 00 00 00 00       	mov    $0x0,%esi
+  801660:	8b 55 08             	mov    0x8(%ebp),%edx
+  801663:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801666:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80166b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80166e:	89 f7                	mov    %esi,%edi
+  801670:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801672:	5b                   	pop    %ebx
+  801673:	5e                   	pop    %esi
+  801674:	5f                   	pop    %edi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+
+00801677 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	57                   	push   %edi
+  80167b:	56                   	push   %esi
+  80167c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80167d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801682:	8b 55 08             	mov    0x8(%ebp),%edx
+  801685:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801688:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80168d:	89 df                	mov    %ebx,%edi
+  80168f:	89 de                	mov    %ebx,%esi
+  801691:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801693:	5b                   	pop    %ebx
+  801694:	5e                   	pop    %esi
+  801695:	5f                   	pop    %edi
+  801696:	5d                   	pop    %ebp
+  801697:	c3                   	ret
+
+00801698 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801698:	55                   	push   %ebp
+  801699:	89 e5                	mov    %esp,%ebp
+  80169b:	57                   	push   %edi
+  80169c:	56                   	push   %esi
+  80169d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80169e:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016b1:	89 f7                	mov    %esi,%edi
+  8016b3:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8016b5:	5b                   	pop    %ebx
+  8016b6:	5e                   	pop    %esi
+  8016b7:	5f                   	pop    %edi
+  8016b8:	5d                   	pop    %ebp
+  8016b9:	c3                   	ret
+
+008016ba <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8016ba:	55                   	push   %ebp
+  8016bb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016c5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8016c8:	5d                   	pop    %ebp
+  8016c9:	c3                   	ret
+
+008016ca <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8016d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016da:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8016df:	5d                   	pop    %ebp
+  8016e0:	c3                   	ret
+
+008016e1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016e1:	55                   	push   %ebp
+  8016e2:	89 e5                	mov    %esp,%ebp
+  8016e4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8016e9:	89 c2                	mov    %eax,%edx
+  8016eb:	c1 ea 16             	shr    $0x16,%edx
+  8016ee:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016f5:	f6 c2 01             	test   $0x1,%dl
+  8016f8:	74 29                	je     801723 <fd_alloc+0x42>
+  8016fa:	89 c2                	mov    %eax,%edx
+  8016fc:	c1 ea 0c             	shr    $0xc,%edx
+  8016ff:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801706:	f6 c2 01             	test   $0x1,%dl
+  801709:	74 18                	je     801723 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80170b:	05 00 10 00 00       	add    $0x1000,%eax
+  801710:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801715:	75 d2                	jne    8016e9 <fd_alloc+0x8>
+  801717:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80171c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801721:	eb 05                	jmp    801728 <fd_alloc+0x47>
+			return 0;
+  801723:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801728:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172b:	89 02                	mov    %eax,(%edx)
+}
+  80172d:	89 c8                	mov    %ecx,%eax
+  80172f:	5d                   	pop    %ebp
+  801730:	c3                   	ret
+
+00801731 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801731:	55                   	push   %ebp
+  801732:	89 e5                	mov    %esp,%ebp
+  801734:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801737:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80173c:	77 30                	ja     80176e <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80173e:	c1 e0 0c             	shl    $0xc,%eax
+  801741:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801746:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80174c:	f6 c2 01             	test   $0x1,%dl
+  80174f:	74 24                	je     801775 <fd_lookup+0x44>
+  801751:	89 c2                	mov    %eax,%edx
+  801753:	c1 ea 0c             	shr    $0xc,%edx
+  801756:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80175d:	f6 c2 01             	test   $0x1,%dl
+  801760:	74 1a                	je     80177c <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801762:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801765:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801767:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80176c:	5d                   	pop    %ebp
+  80176d:	c3                   	ret
+		return -E_INVAL;
+  80176e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801773:	eb f7                	jmp    80176c <fd_lookup+0x3b>
+		return -E_INVAL;
+  801775:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80177a:	eb f0                	jmp    80176c <fd_lookup+0x3b>
+  80177c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801781:	eb e9                	jmp    80176c <fd_lookup+0x3b>
+
+00801783 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801783:	55                   	push   %ebp
+  801784:	89 e5                	mov    %esp,%ebp
+  801786:	53                   	push   %ebx
+  801787:	83 ec 04             	sub    $0x4,%esp
+  80178a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80178d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801792:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801797:	39 13                	cmp    %edx,(%ebx)
+  801799:	74 54                	je     8017ef <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80179b:	83 c0 01             	add    $0x1,%eax
+  80179e:	8b 1c 85 f4 59 80 00 	mov    0x8059f4(,%eax,4),%ebx
+  8017a5:	85 db                	test   %ebx,%ebx
+  8017a7:	75 ee                	jne    801797 <dev_lookup+0x14>
+  8017a9:	89 e1                	mov    %esp,%ecx
+  8017ab:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017b0:	29 c8                	sub    %ecx,%eax
+  8017b2:	89 c1                	mov    %eax,%ecx
+  8017b4:	c1 e9 0f             	shr    $0xf,%ecx
+  8017b7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c1:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017c4:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  8017cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8017ce:	83 ec 04             	sub    $0x4,%esp
+  8017d1:	52                   	push   %edx
+  8017d2:	50                   	push   %eax
+  8017d3:	68 78 59 80 00       	push   $0x805978
+  8017d8:	e8 4f ef ff ff       	call   80072c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8017dd:	83 c4 10             	add    $0x10,%esp
+  8017e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8017e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017e8:	89 1a                	mov    %ebx,(%edx)
+}
+  8017ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ed:	c9                   	leave
+  8017ee:	c3                   	ret
+			return 0;
+  8017ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f4:	eb ef                	jmp    8017e5 <dev_lookup+0x62>
+
+008017f6 <fd_close>:
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	57                   	push   %edi
+  8017fa:	56                   	push   %esi
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 24             	sub    $0x24,%esp
+  8017ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  801802:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801805:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801808:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801809:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80180f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801812:	50                   	push   %eax
+  801813:	e8 19 ff ff ff       	call   801731 <fd_lookup>
+  801818:	89 c3                	mov    %eax,%ebx
+  80181a:	83 c4 10             	add    $0x10,%esp
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	78 05                	js     801826 <fd_close+0x30>
+	    || fd != fd2)
+  801821:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801824:	74 0f                	je     801835 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801826:	85 ff                	test   %edi,%edi
+  801828:	0f 44 df             	cmove  %edi,%ebx
+}
+  80182b:	89 d8                	mov    %ebx,%eax
+  80182d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801830:	5b                   	pop    %ebx
+  801831:	5e                   	pop    %esi
+  801832:	5f                   	pop    %edi
+  801833:	5d                   	pop    %ebp
+  801834:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801835:	83 ec 08             	sub    $0x8,%esp
+  801838:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80183b:	50                   	push   %eax
+  80183c:	ff 36                	push   (%esi)
+  80183e:	e8 40 ff ff ff       	call   801783 <dev_lookup>
+  801843:	89 c3                	mov    %eax,%ebx
+  801845:	83 c4 10             	add    $0x10,%esp
+  801848:	85 c0                	test   %eax,%eax
+  80184a:	78 1a                	js     801866 <fd_close+0x70>
+		if (dev->dev_close)
+  80184c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80184f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801852:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801857:	85 c0                	test   %eax,%eax
+  801859:	74 0b                	je     801866 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80185b:	83 ec 0c             	sub    $0xc,%esp
+  80185e:	56                   	push   %esi
+  80185f:	ff d0                	call   *%eax
+  801861:	89 c3                	mov    %eax,%ebx
+  801863:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801866:	83 ec 08             	sub    $0x8,%esp
+  801869:	56                   	push   %esi
+  80186a:	6a 00                	push   $0x0
+  80186c:	e8 6b fa ff ff       	call   8012dc <sys_page_unmap>
+	return r;
+  801871:	83 c4 10             	add    $0x10,%esp
+  801874:	eb b5                	jmp    80182b <fd_close+0x35>
+
+00801876 <close>:
+
+int
+close(int fdnum)
+{
+  801876:	55                   	push   %ebp
+  801877:	89 e5                	mov    %esp,%ebp
+  801879:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80187c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80187f:	50                   	push   %eax
+  801880:	ff 75 08             	push   0x8(%ebp)
+  801883:	e8 a9 fe ff ff       	call   801731 <fd_lookup>
+  801888:	83 c4 10             	add    $0x10,%esp
+  80188b:	85 c0                	test   %eax,%eax
+  80188d:	79 02                	jns    801891 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80188f:	c9                   	leave
+  801890:	c3                   	ret
+		return fd_close(fd, 1);
+  801891:	83 ec 08             	sub    $0x8,%esp
+  801894:	6a 01                	push   $0x1
+  801896:	ff 75 f4             	push   -0xc(%ebp)
+  801899:	e8 58 ff ff ff       	call   8017f6 <fd_close>
+  80189e:	83 c4 10             	add    $0x10,%esp
+  8018a1:	eb ec                	jmp    80188f <close+0x19>
+
+008018a3 <close_all>:
+
+void
+close_all(void)
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	53                   	push   %ebx
+  8018a7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8018aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8018af:	83 ec 0c             	sub    $0xc,%esp
+  8018b2:	53                   	push   %ebx
+  8018b3:	e8 be ff ff ff       	call   801876 <close>
+	for (i = 0; i < MAXFD; i++)
+  8018b8:	83 c3 01             	add    $0x1,%ebx
+  8018bb:	83 c4 10             	add    $0x10,%esp
+  8018be:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8018c4:	75 e9                	jne    8018af <close_all+0xc>
+}
+  8018c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+
+008018cb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	57                   	push   %edi
+  8018cf:	56                   	push   %esi
+  8018d0:	53                   	push   %ebx
+  8018d1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8018d4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018d7:	50                   	push   %eax
+  8018d8:	ff 75 08             	push   0x8(%ebp)
+  8018db:	e8 51 fe ff ff       	call   801731 <fd_lookup>
+  8018e0:	89 c3                	mov    %eax,%ebx
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	85 c0                	test   %eax,%eax
+  8018e7:	78 7f                	js     801968 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8018e9:	83 ec 0c             	sub    $0xc,%esp
+  8018ec:	ff 75 0c             	push   0xc(%ebp)
+  8018ef:	e8 82 ff ff ff       	call   801876 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8018f4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018f7:	c1 e6 0c             	shl    $0xc,%esi
+  8018fa:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801900:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801903:	89 3c 24             	mov    %edi,(%esp)
+  801906:	e8 bf fd ff ff       	call   8016ca <fd2data>
+  80190b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80190d:	89 34 24             	mov    %esi,(%esp)
+  801910:	e8 b5 fd ff ff       	call   8016ca <fd2data>
+  801915:	83 c4 10             	add    $0x10,%esp
+  801918:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80191b:	89 d8                	mov    %ebx,%eax
+  80191d:	c1 e8 16             	shr    $0x16,%eax
+  801920:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801927:	a8 01                	test   $0x1,%al
+  801929:	74 11                	je     80193c <dup+0x71>
+  80192b:	89 d8                	mov    %ebx,%eax
+  80192d:	c1 e8 0c             	shr    $0xc,%eax
+  801930:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801937:	f6 c2 01             	test   $0x1,%dl
+  80193a:	75 36                	jne    801972 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80193c:	89 f8                	mov    %edi,%eax
+  80193e:	c1 e8 0c             	shr    $0xc,%eax
+  801941:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801948:	83 ec 0c             	sub    $0xc,%esp
+  80194b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801950:	50                   	push   %eax
+  801951:	56                   	push   %esi
+  801952:	6a 00                	push   $0x0
+  801954:	57                   	push   %edi
+  801955:	6a 00                	push   $0x0
+  801957:	e8 3e f9 ff ff       	call   80129a <sys_page_map>
+  80195c:	89 c3                	mov    %eax,%ebx
+  80195e:	83 c4 20             	add    $0x20,%esp
+  801961:	85 c0                	test   %eax,%eax
+  801963:	78 33                	js     801998 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801965:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801968:	89 d8                	mov    %ebx,%eax
+  80196a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196d:	5b                   	pop    %ebx
+  80196e:	5e                   	pop    %esi
+  80196f:	5f                   	pop    %edi
+  801970:	5d                   	pop    %ebp
+  801971:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801972:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801979:	83 ec 0c             	sub    $0xc,%esp
+  80197c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801981:	50                   	push   %eax
+  801982:	ff 75 d4             	push   -0x2c(%ebp)
+  801985:	6a 00                	push   $0x0
+  801987:	53                   	push   %ebx
+  801988:	6a 00                	push   $0x0
+  80198a:	e8 0b f9 ff ff       	call   80129a <sys_page_map>
+  80198f:	89 c3                	mov    %eax,%ebx
+  801991:	83 c4 20             	add    $0x20,%esp
+  801994:	85 c0                	test   %eax,%eax
+  801996:	79 a4                	jns    80193c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801998:	83 ec 08             	sub    $0x8,%esp
+  80199b:	56                   	push   %esi
+  80199c:	6a 00                	push   $0x0
+  80199e:	e8 39 f9 ff ff       	call   8012dc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8019a3:	83 c4 08             	add    $0x8,%esp
+  8019a6:	ff 75 d4             	push   -0x2c(%ebp)
+  8019a9:	6a 00                	push   $0x0
+  8019ab:	e8 2c f9 ff ff       	call   8012dc <sys_page_unmap>
+	return r;
+  8019b0:	83 c4 10             	add    $0x10,%esp
+  8019b3:	eb b3                	jmp    801968 <dup+0x9d>
+
+008019b5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8019b5:	55                   	push   %ebp
+  8019b6:	89 e5                	mov    %esp,%ebp
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	83 ec 18             	sub    $0x18,%esp
+  8019bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019c0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019c3:	50                   	push   %eax
+  8019c4:	53                   	push   %ebx
+  8019c5:	e8 67 fd ff ff       	call   801731 <fd_lookup>
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 3c                	js     801a0d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019d1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019d4:	83 ec 08             	sub    $0x8,%esp
+  8019d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019da:	50                   	push   %eax
+  8019db:	ff 36                	push   (%esi)
+  8019dd:	e8 a1 fd ff ff       	call   801783 <dev_lookup>
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	78 24                	js     801a0d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019e9:	8b 46 08             	mov    0x8(%esi),%eax
+  8019ec:	83 e0 03             	and    $0x3,%eax
+  8019ef:	83 f8 01             	cmp    $0x1,%eax
+  8019f2:	74 20                	je     801a14 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8019f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019f7:	8b 40 08             	mov    0x8(%eax),%eax
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	74 54                	je     801a52 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8019fe:	83 ec 04             	sub    $0x4,%esp
+  801a01:	ff 75 10             	push   0x10(%ebp)
+  801a04:	ff 75 0c             	push   0xc(%ebp)
+  801a07:	56                   	push   %esi
+  801a08:	ff d0                	call   *%eax
+  801a0a:	83 c4 10             	add    $0x10,%esp
+}
+  801a0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a10:	5b                   	pop    %ebx
+  801a11:	5e                   	pop    %esi
+  801a12:	5d                   	pop    %ebp
+  801a13:	c3                   	ret
+  801a14:	89 e2                	mov    %esp,%edx
+  801a16:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a1b:	29 d0                	sub    %edx,%eax
+  801a1d:	89 c2                	mov    %eax,%edx
+  801a1f:	c1 ea 0f             	shr    $0xf,%edx
+  801a22:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2c:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a2f:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  801a36:	8b 40 48             	mov    0x48(%eax),%eax
+  801a39:	83 ec 04             	sub    $0x4,%esp
+  801a3c:	53                   	push   %ebx
+  801a3d:	50                   	push   %eax
+  801a3e:	68 b9 59 80 00       	push   $0x8059b9
+  801a43:	e8 e4 ec ff ff       	call   80072c <cprintf>
+		return -E_INVAL;
+  801a48:	83 c4 10             	add    $0x10,%esp
+  801a4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a50:	eb bb                	jmp    801a0d <read+0x58>
+		return -E_NOT_SUPP;
+  801a52:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a57:	eb b4                	jmp    801a0d <read+0x58>
+
+00801a59 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a59:	55                   	push   %ebp
+  801a5a:	89 e5                	mov    %esp,%ebp
+  801a5c:	57                   	push   %edi
+  801a5d:	56                   	push   %esi
+  801a5e:	53                   	push   %ebx
+  801a5f:	83 ec 0c             	sub    $0xc,%esp
+  801a62:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a65:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801a68:	85 f6                	test   %esi,%esi
+  801a6a:	74 30                	je     801a9c <readn+0x43>
+  801a6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a71:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a76:	83 ec 04             	sub    $0x4,%esp
+  801a79:	89 f2                	mov    %esi,%edx
+  801a7b:	29 c2                	sub    %eax,%edx
+  801a7d:	52                   	push   %edx
+  801a7e:	01 f8                	add    %edi,%eax
+  801a80:	50                   	push   %eax
+  801a81:	ff 75 08             	push   0x8(%ebp)
+  801a84:	e8 2c ff ff ff       	call   8019b5 <read>
+		if (m < 0)
+  801a89:	83 c4 10             	add    $0x10,%esp
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	78 15                	js     801aa5 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801a90:	74 11                	je     801aa3 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801a92:	01 c3                	add    %eax,%ebx
+  801a94:	89 d8                	mov    %ebx,%eax
+  801a96:	39 f3                	cmp    %esi,%ebx
+  801a98:	72 dc                	jb     801a76 <readn+0x1d>
+  801a9a:	eb 09                	jmp    801aa5 <readn+0x4c>
+  801a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa1:	eb 02                	jmp    801aa5 <readn+0x4c>
+  801aa3:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa8:	5b                   	pop    %ebx
+  801aa9:	5e                   	pop    %esi
+  801aaa:	5f                   	pop    %edi
+  801aab:	5d                   	pop    %ebp
+  801aac:	c3                   	ret
+
+00801aad <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801aad:	55                   	push   %ebp
+  801aae:	89 e5                	mov    %esp,%ebp
+  801ab0:	56                   	push   %esi
+  801ab1:	53                   	push   %ebx
+  801ab2:	83 ec 18             	sub    $0x18,%esp
+  801ab5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ab8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abb:	50                   	push   %eax
+  801abc:	53                   	push   %ebx
+  801abd:	e8 6f fc ff ff       	call   801731 <fd_lookup>
+  801ac2:	83 c4 10             	add    $0x10,%esp
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	78 37                	js     801b00 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ac9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801acc:	83 ec 08             	sub    $0x8,%esp
+  801acf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad2:	50                   	push   %eax
+  801ad3:	ff 36                	push   (%esi)
+  801ad5:	e8 a9 fc ff ff       	call   801783 <dev_lookup>
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 1f                	js     801b00 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ae1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ae5:	74 20                	je     801b07 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ae7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aea:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	74 54                	je     801b45 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801af1:	83 ec 04             	sub    $0x4,%esp
+  801af4:	ff 75 10             	push   0x10(%ebp)
+  801af7:	ff 75 0c             	push   0xc(%ebp)
+  801afa:	56                   	push   %esi
+  801afb:	ff d0                	call   *%eax
+  801afd:	83 c4 10             	add    $0x10,%esp
+}
+  801b00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b03:	5b                   	pop    %ebx
+  801b04:	5e                   	pop    %esi
+  801b05:	5d                   	pop    %ebp
+  801b06:	c3                   	ret
+  801b07:	89 e2                	mov    %esp,%edx
+  801b09:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b0e:	29 d0                	sub    %edx,%eax
+  801b10:	89 c2                	mov    %eax,%edx
+  801b12:	c1 ea 0f             	shr    $0xf,%edx
+  801b15:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b22:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  801b29:	8b 40 48             	mov    0x48(%eax),%eax
+  801b2c:	83 ec 04             	sub    $0x4,%esp
+  801b2f:	53                   	push   %ebx
+  801b30:	50                   	push   %eax
+  801b31:	68 d5 59 80 00       	push   $0x8059d5
+  801b36:	e8 f1 eb ff ff       	call   80072c <cprintf>
+		return -E_INVAL;
+  801b3b:	83 c4 10             	add    $0x10,%esp
+  801b3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b43:	eb bb                	jmp    801b00 <write+0x53>
+		return -E_NOT_SUPP;
+  801b45:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b4a:	eb b4                	jmp    801b00 <write+0x53>
+
+00801b4c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b4c:	55                   	push   %ebp
+  801b4d:	89 e5                	mov    %esp,%ebp
+  801b4f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b55:	50                   	push   %eax
+  801b56:	ff 75 08             	push   0x8(%ebp)
+  801b59:	e8 d3 fb ff ff       	call   801731 <fd_lookup>
+  801b5e:	83 c4 10             	add    $0x10,%esp
+  801b61:	85 c0                	test   %eax,%eax
+  801b63:	78 0e                	js     801b73 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801b65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b73:	c9                   	leave
+  801b74:	c3                   	ret
+
+00801b75 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	53                   	push   %ebx
+  801b79:	83 ec 1c             	sub    $0x1c,%esp
+  801b7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b82:	50                   	push   %eax
+  801b83:	ff 75 08             	push   0x8(%ebp)
+  801b86:	e8 a6 fb ff ff       	call   801731 <fd_lookup>
+  801b8b:	83 c4 10             	add    $0x10,%esp
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	78 33                	js     801bc5 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801b92:	83 fb 03             	cmp    $0x3,%ebx
+  801b95:	74 28                	je     801bbf <fcntl+0x4a>
+  801b97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b9c:	83 fb 04             	cmp    $0x4,%ebx
+  801b9f:	75 24                	jne    801bc5 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801ba1:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801ba4:	8b 41 08             	mov    0x8(%ecx),%eax
+  801ba7:	80 e4 ef             	and    $0xef,%ah
+  801baa:	8b 55 10             	mov    0x10(%ebp),%edx
+  801bad:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801bb3:	09 d0                	or     %edx,%eax
+  801bb5:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbd:	eb 06                	jmp    801bc5 <fcntl+0x50>
+		return fd->fd_omode;
+  801bbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc2:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801bc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+
+00801bca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801bca:	55                   	push   %ebp
+  801bcb:	89 e5                	mov    %esp,%ebp
+  801bcd:	56                   	push   %esi
+  801bce:	53                   	push   %ebx
+  801bcf:	83 ec 18             	sub    $0x18,%esp
+  801bd2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bd5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bd8:	50                   	push   %eax
+  801bd9:	53                   	push   %ebx
+  801bda:	e8 52 fb ff ff       	call   801731 <fd_lookup>
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	78 34                	js     801c1a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801be6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801be9:	83 ec 08             	sub    $0x8,%esp
+  801bec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bef:	50                   	push   %eax
+  801bf0:	ff 36                	push   (%esi)
+  801bf2:	e8 8c fb ff ff       	call   801783 <dev_lookup>
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	85 c0                	test   %eax,%eax
+  801bfc:	78 1c                	js     801c1a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bfe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c02:	74 1d                	je     801c21 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c07:	8b 40 18             	mov    0x18(%eax),%eax
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	74 51                	je     801c5f <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c0e:	83 ec 08             	sub    $0x8,%esp
+  801c11:	ff 75 0c             	push   0xc(%ebp)
+  801c14:	56                   	push   %esi
+  801c15:	ff d0                	call   *%eax
+  801c17:	83 c4 10             	add    $0x10,%esp
+}
+  801c1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1d:	5b                   	pop    %ebx
+  801c1e:	5e                   	pop    %esi
+  801c1f:	5d                   	pop    %ebp
+  801c20:	c3                   	ret
+  801c21:	89 e2                	mov    %esp,%edx
+  801c23:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c28:	29 d0                	sub    %edx,%eax
+  801c2a:	89 c2                	mov    %eax,%edx
+  801c2c:	c1 ea 0f             	shr    $0xf,%edx
+  801c2f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c39:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801c3c:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  801c43:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c46:	83 ec 04             	sub    $0x4,%esp
+  801c49:	53                   	push   %ebx
+  801c4a:	50                   	push   %eax
+  801c4b:	68 98 59 80 00       	push   $0x805998
+  801c50:	e8 d7 ea ff ff       	call   80072c <cprintf>
+		return -E_INVAL;
+  801c55:	83 c4 10             	add    $0x10,%esp
+  801c58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c5d:	eb bb                	jmp    801c1a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801c5f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c64:	eb b4                	jmp    801c1a <ftruncate+0x50>
+
+00801c66 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c66:	55                   	push   %ebp
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	56                   	push   %esi
+  801c6a:	53                   	push   %ebx
+  801c6b:	83 ec 18             	sub    $0x18,%esp
+  801c6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c71:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c74:	50                   	push   %eax
+  801c75:	ff 75 08             	push   0x8(%ebp)
+  801c78:	e8 b4 fa ff ff       	call   801731 <fd_lookup>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	78 53                	js     801cd7 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c84:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c87:	83 ec 08             	sub    $0x8,%esp
+  801c8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8d:	50                   	push   %eax
+  801c8e:	ff 36                	push   (%esi)
+  801c90:	e8 ee fa ff ff       	call   801783 <dev_lookup>
+  801c95:	83 c4 10             	add    $0x10,%esp
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	78 3b                	js     801cd7 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801c9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c9f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ca3:	74 39                	je     801cde <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ca5:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ca8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801caf:	00 00 00 
+	stat->st_isdir = 0;
+  801cb2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801cb9:	00 00 00 
+	stat->st_version = 0;
+  801cbc:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801cc3:	00 00 00 
+	stat->st_dev = dev;
+  801cc6:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ccc:	83 ec 08             	sub    $0x8,%esp
+  801ccf:	53                   	push   %ebx
+  801cd0:	56                   	push   %esi
+  801cd1:	ff 50 14             	call   *0x14(%eax)
+  801cd4:	83 c4 10             	add    $0x10,%esp
+}
+  801cd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cda:	5b                   	pop    %ebx
+  801cdb:	5e                   	pop    %esi
+  801cdc:	5d                   	pop    %ebp
+  801cdd:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cde:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce3:	eb f2                	jmp    801cd7 <fstat+0x71>
+
+00801ce5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ce5:	55                   	push   %ebp
+  801ce6:	89 e5                	mov    %esp,%ebp
+  801ce8:	56                   	push   %esi
+  801ce9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801cea:	83 ec 08             	sub    $0x8,%esp
+  801ced:	6a 00                	push   $0x0
+  801cef:	ff 75 08             	push   0x8(%ebp)
+  801cf2:	e8 b7 01 00 00       	call   801eae <open>
+  801cf7:	89 c3                	mov    %eax,%ebx
+  801cf9:	83 c4 10             	add    $0x10,%esp
+  801cfc:	85 c0                	test   %eax,%eax
+  801cfe:	78 1b                	js     801d1b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d00:	83 ec 08             	sub    $0x8,%esp
+  801d03:	ff 75 0c             	push   0xc(%ebp)
+  801d06:	50                   	push   %eax
+  801d07:	e8 5a ff ff ff       	call   801c66 <fstat>
+  801d0c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d0e:	89 1c 24             	mov    %ebx,(%esp)
+  801d11:	e8 60 fb ff ff       	call   801876 <close>
+	return r;
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	89 f3                	mov    %esi,%ebx
+}
+  801d1b:	89 d8                	mov    %ebx,%eax
+  801d1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d20:	5b                   	pop    %ebx
+  801d21:	5e                   	pop    %esi
+  801d22:	5d                   	pop    %ebp
+  801d23:	c3                   	ret
+
+00801d24 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	56                   	push   %esi
+  801d28:	53                   	push   %ebx
+  801d29:	89 c6                	mov    %eax,%esi
+  801d2b:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801d2d:	83 3d 80 b0 80 00 00 	cmpl   $0x0,0x80b080
+  801d34:	74 27                	je     801d5d <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d36:	6a 07                	push   $0x7
+  801d38:	68 00 d0 80 00       	push   $0x80d000
+  801d3d:	56                   	push   %esi
+  801d3e:	ff 35 80 b0 80 00    	push   0x80b080
+  801d44:	e8 8b 34 00 00       	call   8051d4 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801d49:	83 c4 0c             	add    $0xc,%esp
+  801d4c:	6a 00                	push   $0x0
+  801d4e:	53                   	push   %ebx
+  801d4f:	6a 00                	push   $0x0
+  801d51:	e8 ee 31 00 00       	call   804f44 <ipc_recv>
+}
+  801d56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d59:	5b                   	pop    %ebx
+  801d5a:	5e                   	pop    %esi
+  801d5b:	5d                   	pop    %ebp
+  801d5c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d5d:	83 ec 0c             	sub    $0xc,%esp
+  801d60:	6a 02                	push   $0x2
+  801d62:	e8 d6 34 00 00       	call   80523d <ipc_find_env>
+  801d67:	a3 80 b0 80 00       	mov    %eax,0x80b080
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	eb c5                	jmp    801d36 <fsipc+0x12>
+
+00801d71 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d7d:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.set_size.req_size = newsize;
+  801d82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d85:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d94:	e8 8b ff ff ff       	call   801d24 <fsipc>
+}
+  801d99:	c9                   	leave
+  801d9a:	c3                   	ret
+
+00801d9b <devfile_flush>:
+{
+  801d9b:	55                   	push   %ebp
+  801d9c:	89 e5                	mov    %esp,%ebp
+  801d9e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801da1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801da7:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db1:	b8 06 00 00 00       	mov    $0x6,%eax
+  801db6:	e8 69 ff ff ff       	call   801d24 <fsipc>
+}
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+
+00801dbd <devfile_stat>:
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	53                   	push   %ebx
+  801dc1:	83 ec 04             	sub    $0x4,%esp
+  801dc4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dca:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dcd:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd7:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ddc:	e8 43 ff ff ff       	call   801d24 <fsipc>
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 37                	js     801e1c <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801de5:	83 ec 08             	sub    $0x8,%esp
+  801de8:	68 00 d0 80 00       	push   $0x80d000
+  801ded:	53                   	push   %ebx
+  801dee:	e8 30 f0 ff ff       	call   800e23 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801df3:	a1 80 d0 80 00       	mov    0x80d080,%eax
+  801df8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dfe:	a1 84 d0 80 00       	mov    0x80d084,%eax
+  801e03:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801e09:	a1 88 d0 80 00       	mov    0x80d088,%eax
+  801e0e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801e14:	83 c4 10             	add    $0x10,%esp
+  801e17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1f:	c9                   	leave
+  801e20:	c3                   	ret
+
+00801e21 <devfile_write>:
+{
+  801e21:	55                   	push   %ebp
+  801e22:	89 e5                	mov    %esp,%ebp
+  801e24:	83 ec 0c             	sub    $0xc,%esp
+  801e27:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801e2a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801e2f:	39 d0                	cmp    %edx,%eax
+  801e31:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e37:	8b 52 0c             	mov    0xc(%edx),%edx
+  801e3a:	89 15 00 d0 80 00    	mov    %edx,0x80d000
+	fsipcbuf.write.req_n = count;
+  801e40:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801e45:	50                   	push   %eax
+  801e46:	ff 75 0c             	push   0xc(%ebp)
+  801e49:	68 08 d0 80 00       	push   $0x80d008
+  801e4e:	e8 80 f1 ff ff       	call   800fd3 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801e53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e58:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e5d:	e8 c2 fe ff ff       	call   801d24 <fsipc>
+}
+  801e62:	c9                   	leave
+  801e63:	c3                   	ret
+
+00801e64 <devfile_read>:
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	53                   	push   %ebx
+  801e68:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e71:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.read.req_n = n;
+  801e76:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e79:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801e7e:	ba 00 d0 80 00       	mov    $0x80d000,%edx
+  801e83:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e88:	e8 97 fe ff ff       	call   801d24 <fsipc>
+  801e8d:	89 c3                	mov    %eax,%ebx
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	78 14                	js     801ea7 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801e93:	83 ec 04             	sub    $0x4,%esp
+  801e96:	50                   	push   %eax
+  801e97:	68 00 d0 80 00       	push   $0x80d000
+  801e9c:	ff 75 0c             	push   0xc(%ebp)
+  801e9f:	e8 2f f1 ff ff       	call   800fd3 <memmove>
+	return r;
+  801ea4:	83 c4 10             	add    $0x10,%esp
+}
+  801ea7:	89 d8                	mov    %ebx,%eax
+  801ea9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eac:	c9                   	leave
+  801ead:	c3                   	ret
+
+00801eae <open>:
+{
+  801eae:	55                   	push   %ebp
+  801eaf:	89 e5                	mov    %esp,%ebp
+  801eb1:	53                   	push   %ebx
+  801eb2:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801eb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb8:	50                   	push   %eax
+  801eb9:	e8 23 f8 ff ff       	call   8016e1 <fd_alloc>
+  801ebe:	89 c3                	mov    %eax,%ebx
+  801ec0:	83 c4 10             	add    $0x10,%esp
+  801ec3:	85 c0                	test   %eax,%eax
+  801ec5:	78 2a                	js     801ef1 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801ec7:	83 ec 0c             	sub    $0xc,%esp
+  801eca:	ff 75 08             	push   0x8(%ebp)
+  801ecd:	e8 05 ef ff ff       	call   800dd7 <strlen>
+  801ed2:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801ed5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801eda:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801edf:	7e 17                	jle    801ef8 <open+0x4a>
+	fd_close(fd, 1);
+  801ee1:	83 ec 08             	sub    $0x8,%esp
+  801ee4:	6a 01                	push   $0x1
+  801ee6:	ff 75 f4             	push   -0xc(%ebp)
+  801ee9:	e8 08 f9 ff ff       	call   8017f6 <fd_close>
+	return r;
+  801eee:	83 c4 10             	add    $0x10,%esp
+}
+  801ef1:	89 d8                	mov    %ebx,%eax
+  801ef3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef6:	c9                   	leave
+  801ef7:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801ef8:	83 ec 08             	sub    $0x8,%esp
+  801efb:	ff 75 08             	push   0x8(%ebp)
+  801efe:	68 00 d0 80 00       	push   $0x80d000
+  801f03:	e8 1b ef ff ff       	call   800e23 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f0b:	a3 00 d4 80 00       	mov    %eax,0x80d400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801f10:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f13:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f18:	e8 07 fe ff ff       	call   801d24 <fsipc>
+  801f1d:	89 c3                	mov    %eax,%ebx
+  801f1f:	83 c4 10             	add    $0x10,%esp
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	78 bb                	js     801ee1 <open+0x33>
+	return fd2num(fd); 	
+  801f26:	83 ec 0c             	sub    $0xc,%esp
+  801f29:	ff 75 f4             	push   -0xc(%ebp)
+  801f2c:	e8 89 f7 ff ff       	call   8016ba <fd2num>
+  801f31:	89 c3                	mov    %eax,%ebx
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	eb b9                	jmp    801ef1 <open+0x43>
+
+00801f38 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	53                   	push   %ebx
+  801f3c:	83 ec 1c             	sub    $0x1c,%esp
+  801f3f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f45:	50                   	push   %eax
+  801f46:	ff 75 08             	push   0x8(%ebp)
+  801f49:	e8 e3 f7 ff ff       	call   801731 <fd_lookup>
+  801f4e:	83 c4 10             	add    $0x10,%esp
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	78 5a                	js     801faf <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f58:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  801f5e:	39 10                	cmp    %edx,(%eax)
+  801f60:	75 66                	jne    801fc8 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801f62:	83 3d 80 b0 80 00 00 	cmpl   $0x0,0x80b080
+  801f69:	74 49                	je     801fb4 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801f6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f71:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.map.req_offset = offset;
+  801f76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f79:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	fsipcbuf.map.req_npages = maxpages;
+  801f7e:	89 1d 08 d0 80 00    	mov    %ebx,0x80d008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f84:	6a 07                	push   $0x7
+  801f86:	68 00 d0 80 00       	push   $0x80d000
+  801f8b:	6a 09                	push   $0x9
+  801f8d:	ff 35 80 b0 80 00    	push   0x80b080
+  801f93:	e8 3c 32 00 00       	call   8051d4 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801f98:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801f9f:	6a 00                	push   $0x0
+  801fa1:	53                   	push   %ebx
+  801fa2:	ff 75 10             	push   0x10(%ebp)
+  801fa5:	6a 00                	push   $0x0
+  801fa7:	e8 65 30 00 00       	call   805011 <ipc_recv_pages>
+  801fac:	83 c4 20             	add    $0x20,%esp
+}
+  801faf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb2:	c9                   	leave
+  801fb3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fb4:	83 ec 0c             	sub    $0xc,%esp
+  801fb7:	6a 02                	push   $0x2
+  801fb9:	e8 7f 32 00 00       	call   80523d <ipc_find_env>
+  801fbe:	a3 80 b0 80 00       	mov    %eax,0x80b080
+  801fc3:	83 c4 10             	add    $0x10,%esp
+  801fc6:	eb a3                	jmp    801f6b <fmap+0x33>
+		return -E_INVAL;
+  801fc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fcd:	eb e0                	jmp    801faf <fmap+0x77>
+
+00801fcf <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	53                   	push   %ebx
+  801fd3:	83 ec 10             	sub    $0x10,%esp
+  801fd6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801fd9:	53                   	push   %ebx
+  801fda:	e8 f8 ed ff ff       	call   800dd7 <strlen>
+  801fdf:	83 c4 10             	add    $0x10,%esp
+  801fe2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fe7:	7f 25                	jg     80200e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801fe9:	83 ec 08             	sub    $0x8,%esp
+  801fec:	53                   	push   %ebx
+  801fed:	68 00 d0 80 00       	push   $0x80d000
+  801ff2:	e8 2c ee ff ff       	call   800e23 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801ff7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802001:	e8 1e fd ff ff       	call   801d24 <fsipc>
+  802006:	83 c4 10             	add    $0x10,%esp
+}
+  802009:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80200c:	c9                   	leave
+  80200d:	c3                   	ret
+		return -E_BAD_PATH;
+  80200e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802013:	eb f4                	jmp    802009 <remove+0x3a>
+
+00802015 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802015:	55                   	push   %ebp
+  802016:	89 e5                	mov    %esp,%ebp
+  802018:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80201b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802020:	b8 08 00 00 00       	mov    $0x8,%eax
+  802025:	e8 fa fc ff ff       	call   801d24 <fsipc>
+}
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+
+0080202c <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802032:	68 08 5a 80 00       	push   $0x805a08
+  802037:	ff 75 0c             	push   0xc(%ebp)
+  80203a:	e8 e4 ed ff ff       	call   800e23 <strcpy>
+	return 0;
+}
+  80203f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802044:	c9                   	leave
+  802045:	c3                   	ret
+
+00802046 <devsock_close>:
+{
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	53                   	push   %ebx
+  80204a:	83 ec 10             	sub    $0x10,%esp
+  80204d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802050:	53                   	push   %ebx
+  802051:	e8 26 32 00 00       	call   80527c <pageref>
+  802056:	89 c2                	mov    %eax,%edx
+  802058:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80205b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802060:	83 fa 01             	cmp    $0x1,%edx
+  802063:	74 05                	je     80206a <devsock_close+0x24>
+}
+  802065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80206a:	83 ec 0c             	sub    $0xc,%esp
+  80206d:	ff 73 0c             	push   0xc(%ebx)
+  802070:	e8 b0 05 00 00       	call   802625 <nsipc_close>
+  802075:	83 c4 10             	add    $0x10,%esp
+  802078:	eb eb                	jmp    802065 <devsock_close+0x1f>
+
+0080207a <devsock_write>:
+{
+  80207a:	55                   	push   %ebp
+  80207b:	89 e5                	mov    %esp,%ebp
+  80207d:	53                   	push   %ebx
+  80207e:	83 ec 14             	sub    $0x14,%esp
+  802081:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802084:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802087:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80208a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80208d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802090:	8b 41 08             	mov    0x8(%ecx),%eax
+  802093:	c1 f8 09             	sar    $0x9,%eax
+  802096:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802099:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80209f:	77 13                	ja     8020b4 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8020a1:	50                   	push   %eax
+  8020a2:	52                   	push   %edx
+  8020a3:	53                   	push   %ebx
+  8020a4:	ff 71 0c             	push   0xc(%ecx)
+  8020a7:	e8 5c 06 00 00       	call   802708 <nsipc_send>
+  8020ac:	83 c4 10             	add    $0x10,%esp
+}
+  8020af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b2:	c9                   	leave
+  8020b3:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8020b4:	50                   	push   %eax
+  8020b5:	6a 01                	push   $0x1
+  8020b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020ba:	50                   	push   %eax
+  8020bb:	ff 71 0c             	push   0xc(%ecx)
+  8020be:	e8 a6 06 00 00       	call   802769 <nsipc_sendmsg>
+  8020c3:	83 c4 10             	add    $0x10,%esp
+  8020c6:	eb e7                	jmp    8020af <devsock_write+0x35>
+
+008020c8 <devsock_read>:
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	53                   	push   %ebx
+  8020cc:	83 ec 14             	sub    $0x14,%esp
+  8020cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020d5:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8020d8:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8020db:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8020de:	8b 41 08             	mov    0x8(%ecx),%eax
+  8020e1:	c1 f8 09             	sar    $0x9,%eax
+  8020e4:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8020e7:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8020ed:	77 13                	ja     802102 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8020ef:	50                   	push   %eax
+  8020f0:	52                   	push   %edx
+  8020f1:	53                   	push   %ebx
+  8020f2:	ff 71 0c             	push   0xc(%ecx)
+  8020f5:	e8 9c 05 00 00       	call   802696 <nsipc_recv>
+  8020fa:	83 c4 10             	add    $0x10,%esp
+}
+  8020fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802100:	c9                   	leave
+  802101:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802102:	50                   	push   %eax
+  802103:	6a 01                	push   $0x1
+  802105:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802108:	50                   	push   %eax
+  802109:	ff 71 0c             	push   0xc(%ecx)
+  80210c:	e8 02 0a 00 00       	call   802b13 <nsipc_recvmsg>
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	eb e7                	jmp    8020fd <devsock_read+0x35>
+
+00802116 <fd2sockid>:
+{
+  802116:	55                   	push   %ebp
+  802117:	89 e5                	mov    %esp,%ebp
+  802119:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80211c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80211f:	52                   	push   %edx
+  802120:	50                   	push   %eax
+  802121:	e8 0b f6 ff ff       	call   801731 <fd_lookup>
+  802126:	83 c4 10             	add    $0x10,%esp
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	78 10                	js     80213d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80212d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802130:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  802136:	39 08                	cmp    %ecx,(%eax)
+  802138:	75 05                	jne    80213f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80213a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80213d:	c9                   	leave
+  80213e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80213f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802144:	eb f7                	jmp    80213d <fd2sockid+0x27>
+
+00802146 <sock_flags>:
+{
+  802146:	55                   	push   %ebp
+  802147:	89 e5                	mov    %esp,%ebp
+  802149:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  80214c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80214f:	52                   	push   %edx
+  802150:	50                   	push   %eax
+  802151:	e8 db f5 ff ff       	call   801731 <fd_lookup>
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	78 0e                	js     80216b <sock_flags+0x25>
+  80215d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802160:	8b 40 08             	mov    0x8(%eax),%eax
+  802163:	c1 e8 09             	shr    $0x9,%eax
+  802166:	83 e0 08             	and    $0x8,%eax
+}
+  802169:	c9                   	leave
+  80216a:	c3                   	ret
+		return 0;
+  80216b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802170:	eb f7                	jmp    802169 <sock_flags+0x23>
+
+00802172 <alloc_sockfd>:
+{
+  802172:	55                   	push   %ebp
+  802173:	89 e5                	mov    %esp,%ebp
+  802175:	56                   	push   %esi
+  802176:	53                   	push   %ebx
+  802177:	83 ec 1c             	sub    $0x1c,%esp
+  80217a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80217c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217f:	50                   	push   %eax
+  802180:	e8 5c f5 ff ff       	call   8016e1 <fd_alloc>
+  802185:	89 c3                	mov    %eax,%ebx
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 43                	js     8021d1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80218e:	83 ec 04             	sub    $0x4,%esp
+  802191:	68 07 04 00 00       	push   $0x407
+  802196:	ff 75 f4             	push   -0xc(%ebp)
+  802199:	6a 00                	push   $0x0
+  80219b:	e8 b7 f0 ff ff       	call   801257 <sys_page_alloc>
+  8021a0:	89 c3                	mov    %eax,%ebx
+  8021a2:	83 c4 10             	add    $0x10,%esp
+  8021a5:	85 c0                	test   %eax,%eax
+  8021a7:	78 28                	js     8021d1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8021a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ac:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  8021b2:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8021b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8021be:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8021c1:	83 ec 0c             	sub    $0xc,%esp
+  8021c4:	50                   	push   %eax
+  8021c5:	e8 f0 f4 ff ff       	call   8016ba <fd2num>
+  8021ca:	89 c3                	mov    %eax,%ebx
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	eb 0c                	jmp    8021dd <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8021d1:	83 ec 0c             	sub    $0xc,%esp
+  8021d4:	56                   	push   %esi
+  8021d5:	e8 4b 04 00 00       	call   802625 <nsipc_close>
+		return r;
+  8021da:	83 c4 10             	add    $0x10,%esp
+}
+  8021dd:	89 d8                	mov    %ebx,%eax
+  8021df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e2:	5b                   	pop    %ebx
+  8021e3:	5e                   	pop    %esi
+  8021e4:	5d                   	pop    %ebp
+  8021e5:	c3                   	ret
+
+008021e6 <accept>:
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	56                   	push   %esi
+  8021ea:	53                   	push   %ebx
+  8021eb:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8021ee:	89 f0                	mov    %esi,%eax
+  8021f0:	e8 21 ff ff ff       	call   802116 <fd2sockid>
+  8021f5:	89 c3                	mov    %eax,%ebx
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	78 24                	js     80221f <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8021fb:	89 f0                	mov    %esi,%eax
+  8021fd:	e8 44 ff ff ff       	call   802146 <sock_flags>
+  802202:	50                   	push   %eax
+  802203:	ff 75 10             	push   0x10(%ebp)
+  802206:	ff 75 0c             	push   0xc(%ebp)
+  802209:	53                   	push   %ebx
+  80220a:	e8 6b 03 00 00       	call   80257a <nsipc_accept>
+  80220f:	89 c3                	mov    %eax,%ebx
+  802211:	83 c4 10             	add    $0x10,%esp
+  802214:	85 c0                	test   %eax,%eax
+  802216:	78 07                	js     80221f <accept+0x39>
+	return alloc_sockfd(r);
+  802218:	e8 55 ff ff ff       	call   802172 <alloc_sockfd>
+  80221d:	89 c3                	mov    %eax,%ebx
+}
+  80221f:	89 d8                	mov    %ebx,%eax
+  802221:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802224:	5b                   	pop    %ebx
+  802225:	5e                   	pop    %esi
+  802226:	5d                   	pop    %ebp
+  802227:	c3                   	ret
+
+00802228 <bind>:
+{
+  802228:	55                   	push   %ebp
+  802229:	89 e5                	mov    %esp,%ebp
+  80222b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80222e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802231:	e8 e0 fe ff ff       	call   802116 <fd2sockid>
+  802236:	85 c0                	test   %eax,%eax
+  802238:	78 12                	js     80224c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80223a:	83 ec 04             	sub    $0x4,%esp
+  80223d:	ff 75 10             	push   0x10(%ebp)
+  802240:	ff 75 0c             	push   0xc(%ebp)
+  802243:	50                   	push   %eax
+  802244:	e8 85 03 00 00       	call   8025ce <nsipc_bind>
+  802249:	83 c4 10             	add    $0x10,%esp
+}
+  80224c:	c9                   	leave
+  80224d:	c3                   	ret
+
+0080224e <shutdown>:
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802254:	8b 45 08             	mov    0x8(%ebp),%eax
+  802257:	e8 ba fe ff ff       	call   802116 <fd2sockid>
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	78 0f                	js     80226f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802260:	83 ec 08             	sub    $0x8,%esp
+  802263:	ff 75 0c             	push   0xc(%ebp)
+  802266:	50                   	push   %eax
+  802267:	e8 97 03 00 00       	call   802603 <nsipc_shutdown>
+  80226c:	83 c4 10             	add    $0x10,%esp
+}
+  80226f:	c9                   	leave
+  802270:	c3                   	ret
+
+00802271 <connect>:
+{
+  802271:	55                   	push   %ebp
+  802272:	89 e5                	mov    %esp,%ebp
+  802274:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802277:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227a:	e8 97 fe ff ff       	call   802116 <fd2sockid>
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	78 12                	js     802295 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802283:	83 ec 04             	sub    $0x4,%esp
+  802286:	ff 75 10             	push   0x10(%ebp)
+  802289:	ff 75 0c             	push   0xc(%ebp)
+  80228c:	50                   	push   %eax
+  80228d:	e8 ad 03 00 00       	call   80263f <nsipc_connect>
+  802292:	83 c4 10             	add    $0x10,%esp
+}
+  802295:	c9                   	leave
+  802296:	c3                   	ret
+
+00802297 <listen>:
+{
+  802297:	55                   	push   %ebp
+  802298:	89 e5                	mov    %esp,%ebp
+  80229a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80229d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a0:	e8 71 fe ff ff       	call   802116 <fd2sockid>
+  8022a5:	85 c0                	test   %eax,%eax
+  8022a7:	78 0f                	js     8022b8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8022a9:	83 ec 08             	sub    $0x8,%esp
+  8022ac:	ff 75 0c             	push   0xc(%ebp)
+  8022af:	50                   	push   %eax
+  8022b0:	e8 bf 03 00 00       	call   802674 <nsipc_listen>
+  8022b5:	83 c4 10             	add    $0x10,%esp
+}
+  8022b8:	c9                   	leave
+  8022b9:	c3                   	ret
+
+008022ba <sendmsg>:
+{
+  8022ba:	55                   	push   %ebp
+  8022bb:	89 e5                	mov    %esp,%ebp
+  8022bd:	57                   	push   %edi
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	83 ec 0c             	sub    $0xc,%esp
+  8022c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022c6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8022c9:	89 f0                	mov    %esi,%eax
+  8022cb:	e8 46 fe ff ff       	call   802116 <fd2sockid>
+  8022d0:	89 c3                	mov    %eax,%ebx
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	78 1c                	js     8022f2 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8022d6:	89 f0                	mov    %esi,%eax
+  8022d8:	e8 69 fe ff ff       	call   802146 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8022dd:	0b 45 10             	or     0x10(%ebp),%eax
+  8022e0:	50                   	push   %eax
+  8022e1:	ff 77 0c             	push   0xc(%edi)
+  8022e4:	ff 77 08             	push   0x8(%edi)
+  8022e7:	53                   	push   %ebx
+  8022e8:	e8 7c 04 00 00       	call   802769 <nsipc_sendmsg>
+  8022ed:	89 c3                	mov    %eax,%ebx
+  8022ef:	83 c4 10             	add    $0x10,%esp
+}
+  8022f2:	89 d8                	mov    %ebx,%eax
+  8022f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f7:	5b                   	pop    %ebx
+  8022f8:	5e                   	pop    %esi
+  8022f9:	5f                   	pop    %edi
+  8022fa:	5d                   	pop    %ebp
+  8022fb:	c3                   	ret
+
+008022fc <recvmsg>:
+{
+  8022fc:	55                   	push   %ebp
+  8022fd:	89 e5                	mov    %esp,%ebp
+  8022ff:	57                   	push   %edi
+  802300:	56                   	push   %esi
+  802301:	53                   	push   %ebx
+  802302:	83 ec 0c             	sub    $0xc,%esp
+  802305:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802308:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80230b:	89 f8                	mov    %edi,%eax
+  80230d:	e8 04 fe ff ff       	call   802116 <fd2sockid>
+  802312:	89 c3                	mov    %eax,%ebx
+  802314:	85 c0                	test   %eax,%eax
+  802316:	78 2a                	js     802342 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802318:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80231f:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802326:	89 f8                	mov    %edi,%eax
+  802328:	e8 19 fe ff ff       	call   802146 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80232d:	0b 45 10             	or     0x10(%ebp),%eax
+  802330:	50                   	push   %eax
+  802331:	ff 76 0c             	push   0xc(%esi)
+  802334:	ff 76 08             	push   0x8(%esi)
+  802337:	53                   	push   %ebx
+  802338:	e8 d6 07 00 00       	call   802b13 <nsipc_recvmsg>
+  80233d:	89 c3                	mov    %eax,%ebx
+  80233f:	83 c4 10             	add    $0x10,%esp
+}
+  802342:	89 d8                	mov    %ebx,%eax
+  802344:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802347:	5b                   	pop    %ebx
+  802348:	5e                   	pop    %esi
+  802349:	5f                   	pop    %edi
+  80234a:	5d                   	pop    %ebp
+  80234b:	c3                   	ret
+
+0080234c <sendfile>:
+{
+  80234c:	55                   	push   %ebp
+  80234d:	89 e5                	mov    %esp,%ebp
+  80234f:	56                   	push   %esi
+  802350:	53                   	push   %ebx
+  802351:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802354:	89 f0                	mov    %esi,%eax
+  802356:	e8 bb fd ff ff       	call   802116 <fd2sockid>
+  80235b:	89 c3                	mov    %eax,%ebx
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	78 1f                	js     802380 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802361:	89 f0                	mov    %esi,%eax
+  802363:	e8 de fd ff ff       	call   802146 <sock_flags>
+  802368:	83 ec 0c             	sub    $0xc,%esp
+  80236b:	50                   	push   %eax
+  80236c:	ff 75 14             	push   0x14(%ebp)
+  80236f:	ff 75 10             	push   0x10(%ebp)
+  802372:	ff 75 0c             	push   0xc(%ebp)
+  802375:	53                   	push   %ebx
+  802376:	e8 64 06 00 00       	call   8029df <nsipc_sendfile>
+  80237b:	89 c3                	mov    %eax,%ebx
+  80237d:	83 c4 20             	add    $0x20,%esp
+}
+  802380:	89 d8                	mov    %ebx,%eax
+  802382:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802385:	5b                   	pop    %ebx
+  802386:	5e                   	pop    %esi
+  802387:	5d                   	pop    %ebp
+  802388:	c3                   	ret
+
+00802389 <evctl>:
+{
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	53                   	push   %ebx
+  80238d:	83 ec 04             	sub    $0x4,%esp
+  802390:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802393:	89 d8                	mov    %ebx,%eax
+  802395:	e8 7c fd ff ff       	call   802116 <fd2sockid>
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 10                	js     8023ae <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80239e:	83 ec 04             	sub    $0x4,%esp
+  8023a1:	53                   	push   %ebx
+  8023a2:	ff 75 0c             	push   0xc(%ebp)
+  8023a5:	50                   	push   %eax
+  8023a6:	e8 d2 0b 00 00       	call   802f7d <nsipc_evctl>
+  8023ab:	83 c4 10             	add    $0x10,%esp
+}
+  8023ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023b1:	c9                   	leave
+  8023b2:	c3                   	ret
+
+008023b3 <evwait>:
+{
+  8023b3:	55                   	push   %ebp
+  8023b4:	89 e5                	mov    %esp,%ebp
+  8023b6:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8023b9:	ff 75 10             	push   0x10(%ebp)
+  8023bc:	ff 75 0c             	push   0xc(%ebp)
+  8023bf:	ff 75 08             	push   0x8(%ebp)
+  8023c2:	e8 e0 0b 00 00       	call   802fa7 <nsipc_evwait>
+}
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+
+008023c9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8023cf:	ff 75 10             	push   0x10(%ebp)
+  8023d2:	ff 75 0c             	push   0xc(%ebp)
+  8023d5:	ff 75 08             	push   0x8(%ebp)
+  8023d8:	e8 31 0c 00 00       	call   80300e <nsipc_socket>
+  8023dd:	83 c4 10             	add    $0x10,%esp
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	78 05                	js     8023e9 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8023e4:	e8 89 fd ff ff       	call   802172 <alloc_sockfd>
+}
+  8023e9:	c9                   	leave
+  8023ea:	c3                   	ret
+
+008023eb <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8023eb:	55                   	push   %ebp
+  8023ec:	89 e5                	mov    %esp,%ebp
+  8023ee:	53                   	push   %ebx
+  8023ef:	83 ec 04             	sub    $0x4,%esp
+  8023f2:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8023f4:	83 3d a4 b3 80 00 00 	cmpl   $0x0,0x80b3a4
+  8023fb:	74 26                	je     802423 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8023fd:	6a 07                	push   $0x7
+  8023ff:	68 00 e0 80 00       	push   $0x80e000
+  802404:	53                   	push   %ebx
+  802405:	ff 35 a4 b3 80 00    	push   0x80b3a4
+  80240b:	e8 c4 2d 00 00       	call   8051d4 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802410:	83 c4 0c             	add    $0xc,%esp
+  802413:	6a 00                	push   $0x0
+  802415:	6a 00                	push   $0x0
+  802417:	6a 00                	push   $0x0
+  802419:	e8 26 2b 00 00       	call   804f44 <ipc_recv>
+}
+  80241e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802421:	c9                   	leave
+  802422:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802423:	83 ec 0c             	sub    $0xc,%esp
+  802426:	6a 03                	push   $0x3
+  802428:	e8 10 2e 00 00       	call   80523d <ipc_find_env>
+  80242d:	a3 a4 b3 80 00       	mov    %eax,0x80b3a4
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	eb c6                	jmp    8023fd <nsipc+0x12>
+
+00802437 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	56                   	push   %esi
+  80243b:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80243c:	8b 35 b0 b3 80 00    	mov    0x80b3b0,%esi
+		return 0;
+  802442:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802447:	85 f6                	test   %esi,%esi
+  802449:	75 33                	jne    80247e <nsbulk_map+0x47>
+  80244b:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802450:	83 ec 04             	sub    $0x4,%esp
+  802453:	6a 07                	push   $0x7
+  802455:	53                   	push   %ebx
+  802456:	6a 00                	push   $0x0
+  802458:	e8 fa ed ff ff       	call   801257 <sys_page_alloc>
+  80245d:	83 c4 10             	add    $0x10,%esp
+  802460:	85 c0                	test   %eax,%eax
+  802462:	78 1a                	js     80247e <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802464:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80246a:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802470:	75 de                	jne    802450 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802472:	c7 05 b0 b3 80 00 01 	movl   $0x1,0x80b3b0
+  802479:	00 00 00 
+	return 0;
+  80247c:	89 f0                	mov    %esi,%eax
+}
+  80247e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802481:	5b                   	pop    %ebx
+  802482:	5e                   	pop    %esi
+  802483:	5d                   	pop    %ebp
+  802484:	c3                   	ret
+
+00802485 <nsbulk_own>:
+{
+  802485:	55                   	push   %ebp
+  802486:	89 e5                	mov    %esp,%ebp
+  802488:	57                   	push   %edi
+  802489:	56                   	push   %esi
+  80248a:	53                   	push   %ebx
+  80248b:	83 ec 0c             	sub    $0xc,%esp
+  80248e:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802490:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802493:	85 d2                	test   %edx,%edx
+  802495:	7f 0e                	jg     8024a5 <nsbulk_own+0x20>
+	return 0;
+  802497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249c:	eb 47                	jmp    8024e5 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80249e:	83 c3 01             	add    $0x1,%ebx
+  8024a1:	39 fb                	cmp    %edi,%ebx
+  8024a3:	7d 3b                	jge    8024e0 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8024a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8024aa:	89 d9                	mov    %ebx,%ecx
+  8024ac:	d3 e6                	shl    %cl,%esi
+  8024ae:	89 f0                	mov    %esi,%eax
+  8024b0:	23 05 ac b3 80 00    	and    0x80b3ac,%eax
+  8024b6:	74 e6                	je     80249e <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	6a 07                	push   $0x7
+  8024bd:	89 d8                	mov    %ebx,%eax
+  8024bf:	c1 e0 0c             	shl    $0xc,%eax
+  8024c2:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8024c7:	50                   	push   %eax
+  8024c8:	6a 00                	push   $0x0
+  8024ca:	e8 88 ed ff ff       	call   801257 <sys_page_alloc>
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	85 c0                	test   %eax,%eax
+  8024d4:	78 0f                	js     8024e5 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8024d6:	f7 d6                	not    %esi
+  8024d8:	21 35 ac b3 80 00    	and    %esi,0x80b3ac
+  8024de:	eb be                	jmp    80249e <nsbulk_own+0x19>
+	return 0;
+  8024e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e8:	5b                   	pop    %ebx
+  8024e9:	5e                   	pop    %esi
+  8024ea:	5f                   	pop    %edi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+
+008024ed <nsipc_bulk>:
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	57                   	push   %edi
+  8024f1:	56                   	push   %esi
+  8024f2:	53                   	push   %ebx
+  8024f3:	83 ec 1c             	sub    $0x1c,%esp
+  8024f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024f9:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8024fb:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802501:	c1 fb 0c             	sar    $0xc,%ebx
+  802504:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802507:	83 3d a4 b3 80 00 00 	cmpl   $0x0,0x80b3a4
+  80250e:	74 56                	je     802566 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802510:	85 ff                	test   %edi,%edi
+  802512:	7e 24                	jle    802538 <nsipc_bulk+0x4b>
+  802514:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80251a:	74 1c                	je     802538 <nsipc_bulk+0x4b>
+  80251c:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802522:	c1 e3 0c             	shl    $0xc,%ebx
+  802525:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80252a:	0f b6 10             	movzbl (%eax),%edx
+  80252d:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80252f:	05 00 10 00 00       	add    $0x1000,%eax
+  802534:	39 d8                	cmp    %ebx,%eax
+  802536:	75 f2                	jne    80252a <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802538:	83 ec 0c             	sub    $0xc,%esp
+  80253b:	56                   	push   %esi
+  80253c:	57                   	push   %edi
+  80253d:	68 00 00 00 e0       	push   $0xe0000000
+  802542:	ff 75 e4             	push   -0x1c(%ebp)
+  802545:	ff 35 a4 b3 80 00    	push   0x80b3a4
+  80254b:	e8 b8 2c 00 00       	call   805208 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802550:	83 c4 1c             	add    $0x1c,%esp
+  802553:	6a 00                	push   $0x0
+  802555:	6a 00                	push   $0x0
+  802557:	6a 00                	push   $0x0
+  802559:	e8 e6 29 00 00       	call   804f44 <ipc_recv>
+}
+  80255e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802561:	5b                   	pop    %ebx
+  802562:	5e                   	pop    %esi
+  802563:	5f                   	pop    %edi
+  802564:	5d                   	pop    %ebp
+  802565:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802566:	83 ec 0c             	sub    $0xc,%esp
+  802569:	6a 03                	push   $0x3
+  80256b:	e8 cd 2c 00 00       	call   80523d <ipc_find_env>
+  802570:	a3 a4 b3 80 00       	mov    %eax,0x80b3a4
+  802575:	83 c4 10             	add    $0x10,%esp
+  802578:	eb 96                	jmp    802510 <nsipc_bulk+0x23>
+
+0080257a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  80257a:	55                   	push   %ebp
+  80257b:	89 e5                	mov    %esp,%ebp
+  80257d:	53                   	push   %ebx
+  80257e:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802581:	8b 45 08             	mov    0x8(%ebp),%eax
+  802584:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.accept.req_flags = flags;
+  802589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80258c:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802591:	b8 01 00 00 00       	mov    $0x1,%eax
+  802596:	e8 50 fe ff ff       	call   8023eb <nsipc>
+  80259b:	89 c3                	mov    %eax,%ebx
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	79 07                	jns    8025a8 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8025a1:	89 d8                	mov    %ebx,%eax
+  8025a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a6:	c9                   	leave
+  8025a7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8025a8:	83 ec 04             	sub    $0x4,%esp
+  8025ab:	ff 35 10 e0 80 00    	push   0x80e010
+  8025b1:	68 00 e0 80 00       	push   $0x80e000
+  8025b6:	ff 75 0c             	push   0xc(%ebp)
+  8025b9:	e8 15 ea ff ff       	call   800fd3 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8025be:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  8025c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025c7:	89 10                	mov    %edx,(%eax)
+  8025c9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8025cc:	eb d3                	jmp    8025a1 <nsipc_accept+0x27>
+
+008025ce <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8025ce:	55                   	push   %ebp
+  8025cf:	89 e5                	mov    %esp,%ebp
+  8025d1:	53                   	push   %ebx
+  8025d2:	83 ec 08             	sub    $0x8,%esp
+  8025d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8025d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025db:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8025e0:	53                   	push   %ebx
+  8025e1:	ff 75 0c             	push   0xc(%ebp)
+  8025e4:	68 04 e0 80 00       	push   $0x80e004
+  8025e9:	e8 e5 e9 ff ff       	call   800fd3 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8025ee:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_BIND);
+  8025f4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025f9:	e8 ed fd ff ff       	call   8023eb <nsipc>
+}
+  8025fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802601:	c9                   	leave
+  802602:	c3                   	ret
+
+00802603 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802603:	55                   	push   %ebp
+  802604:	89 e5                	mov    %esp,%ebp
+  802606:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802609:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260c:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.shutdown.req_how = how;
+  802611:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802614:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_SHUTDOWN);
+  802619:	b8 03 00 00 00       	mov    $0x3,%eax
+  80261e:	e8 c8 fd ff ff       	call   8023eb <nsipc>
+}
+  802623:	c9                   	leave
+  802624:	c3                   	ret
+
+00802625 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802625:	55                   	push   %ebp
+  802626:	89 e5                	mov    %esp,%ebp
+  802628:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80262b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262e:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_CLOSE);
+  802633:	b8 04 00 00 00       	mov    $0x4,%eax
+  802638:	e8 ae fd ff ff       	call   8023eb <nsipc>
+}
+  80263d:	c9                   	leave
+  80263e:	c3                   	ret
+
+0080263f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80263f:	55                   	push   %ebp
+  802640:	89 e5                	mov    %esp,%ebp
+  802642:	53                   	push   %ebx
+  802643:	83 ec 08             	sub    $0x8,%esp
+  802646:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802649:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264c:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802651:	53                   	push   %ebx
+  802652:	ff 75 0c             	push   0xc(%ebp)
+  802655:	68 04 e0 80 00       	push   $0x80e004
+  80265a:	e8 74 e9 ff ff       	call   800fd3 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80265f:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_CONNECT);
+  802665:	b8 05 00 00 00       	mov    $0x5,%eax
+  80266a:	e8 7c fd ff ff       	call   8023eb <nsipc>
+}
+  80266f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802672:	c9                   	leave
+  802673:	c3                   	ret
+
+00802674 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802674:	55                   	push   %ebp
+  802675:	89 e5                	mov    %esp,%ebp
+  802677:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80267a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80267d:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.listen.req_backlog = backlog;
+  802682:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802685:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_LISTEN);
+  80268a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80268f:	e8 57 fd ff ff       	call   8023eb <nsipc>
+}
+  802694:	c9                   	leave
+  802695:	c3                   	ret
+
+00802696 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802696:	55                   	push   %ebp
+  802697:	89 e5                	mov    %esp,%ebp
+  802699:	56                   	push   %esi
+  80269a:	53                   	push   %ebx
+  80269b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80269e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a1:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.recv.req_len = len;
+  8026a6:	89 35 04 e0 80 00    	mov    %esi,0x80e004
+	nsipcbuf.recv.req_flags = flags;
+  8026ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026af:	a3 08 e0 80 00       	mov    %eax,0x80e008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8026b4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026b9:	e8 2d fd ff ff       	call   8023eb <nsipc>
+  8026be:	89 c3                	mov    %eax,%ebx
+  8026c0:	85 c0                	test   %eax,%eax
+  8026c2:	78 22                	js     8026e6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8026c4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8026c9:	39 c6                	cmp    %eax,%esi
+  8026cb:	0f 4e c6             	cmovle %esi,%eax
+  8026ce:	39 c3                	cmp    %eax,%ebx
+  8026d0:	7f 1d                	jg     8026ef <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8026d2:	83 ec 04             	sub    $0x4,%esp
+  8026d5:	53                   	push   %ebx
+  8026d6:	68 00 e0 80 00       	push   $0x80e000
+  8026db:	ff 75 0c             	push   0xc(%ebp)
+  8026de:	e8 f0 e8 ff ff       	call   800fd3 <memmove>
+  8026e3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8026e6:	89 d8                	mov    %ebx,%eax
+  8026e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026eb:	5b                   	pop    %ebx
+  8026ec:	5e                   	pop    %esi
+  8026ed:	5d                   	pop    %ebp
+  8026ee:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8026ef:	68 14 5a 80 00       	push   $0x805a14
+  8026f4:	68 29 5a 80 00       	push   $0x805a29
+  8026f9:	68 b2 00 00 00       	push   $0xb2
+  8026fe:	68 3e 5a 80 00       	push   $0x805a3e
+  802703:	e8 49 df ff ff       	call   800651 <_panic>
+
+00802708 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802708:	55                   	push   %ebp
+  802709:	89 e5                	mov    %esp,%ebp
+  80270b:	53                   	push   %ebx
+  80270c:	83 ec 04             	sub    $0x4,%esp
+  80270f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802712:	8b 45 08             	mov    0x8(%ebp),%eax
+  802715:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	assert(size < 1600);
+  80271a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802720:	7f 2e                	jg     802750 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802722:	83 ec 04             	sub    $0x4,%esp
+  802725:	53                   	push   %ebx
+  802726:	ff 75 0c             	push   0xc(%ebp)
+  802729:	68 0c e0 80 00       	push   $0x80e00c
+  80272e:	e8 a0 e8 ff ff       	call   800fd3 <memmove>
+	nsipcbuf.send.req_size = size;
+  802733:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+	nsipcbuf.send.req_flags = flags;
+  802739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80273c:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SEND);
+  802741:	b8 08 00 00 00       	mov    $0x8,%eax
+  802746:	e8 a0 fc ff ff       	call   8023eb <nsipc>
+}
+  80274b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274e:	c9                   	leave
+  80274f:	c3                   	ret
+	assert(size < 1600);
+  802750:	68 4a 5a 80 00       	push   $0x805a4a
+  802755:	68 29 5a 80 00       	push   $0x805a29
+  80275a:	68 bd 00 00 00       	push   $0xbd
+  80275f:	68 3e 5a 80 00       	push   $0x805a3e
+  802764:	e8 e8 de ff ff       	call   800651 <_panic>
+
+00802769 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802769:	55                   	push   %ebp
+  80276a:	89 e5                	mov    %esp,%ebp
+  80276c:	57                   	push   %edi
+  80276d:	56                   	push   %esi
+  80276e:	53                   	push   %ebx
+  80276f:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802772:	e8 c0 fc ff ff       	call   802437 <nsbulk_map>
+  802777:	85 c0                	test   %eax,%eax
+  802779:	78 55                	js     8027d0 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  80277b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802782:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802789:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802790:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802793:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802796:	0f 8d 24 02 00 00    	jge    8029c0 <nsipc_sendmsg+0x257>
+  80279c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80279f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8027a2:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8027a5:	89 d8                	mov    %ebx,%eax
+  8027a7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8027ac:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8027ae:	83 ec 0c             	sub    $0xc,%esp
+  8027b1:	68 a0 b0 80 00       	push   $0x80b0a0
+  8027b6:	e8 0d 1b 00 00       	call   8042c8 <pgbatch_init>
+  8027bb:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8027be:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8027c0:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8027c3:	e9 82 00 00 00       	jmp    80284a <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8027c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8027cb:	85 db                	test   %ebx,%ebx
+  8027cd:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8027d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d3:	5b                   	pop    %ebx
+  8027d4:	5e                   	pop    %esi
+  8027d5:	5f                   	pop    %edi
+  8027d6:	5d                   	pop    %ebp
+  8027d7:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8027d8:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027dd:	29 c8                	sub    %ecx,%eax
+  8027df:	39 d0                	cmp    %edx,%eax
+  8027e1:	0f 46 d0             	cmovbe %eax,%edx
+  8027e4:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8027e6:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8027ec:	85 ff                	test   %edi,%edi
+  8027ee:	0f 49 c7             	cmovns %edi,%eax
+  8027f1:	c1 f8 0c             	sar    $0xc,%eax
+  8027f4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8027f9:	e8 87 fc ff ff       	call   802485 <nsbulk_own>
+  8027fe:	85 c0                	test   %eax,%eax
+  802800:	0f 88 17 01 00 00    	js     80291d <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802806:	83 ec 04             	sub    $0x4,%esp
+  802809:	56                   	push   %esi
+  80280a:	ff 75 e0             	push   -0x20(%ebp)
+  80280d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802810:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802815:	50                   	push   %eax
+  802816:	e8 b8 e7 ff ff       	call   800fd3 <memmove>
+  80281b:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80281e:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802821:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802824:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802827:	0f 84 fd 00 00 00    	je     80292a <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80282d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802830:	01 f7                	add    %esi,%edi
+  802832:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802835:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802838:	0f 8d 01 01 00 00    	jge    80293f <nsipc_sendmsg+0x1d6>
+  80283e:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802844:	0f 8f f0 00 00 00    	jg     80293a <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80284a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80284d:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802850:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802853:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802856:	89 c2                	mov    %eax,%edx
+  802858:	03 13                	add    (%ebx),%edx
+  80285a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80285d:	8b 73 04             	mov    0x4(%ebx),%esi
+  802860:	29 c6                	sub    %eax,%esi
+  802862:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802867:	29 f9                	sub    %edi,%ecx
+  802869:	39 ce                	cmp    %ecx,%esi
+  80286b:	89 ca                	mov    %ecx,%edx
+  80286d:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802870:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802873:	89 f9                	mov    %edi,%ecx
+  802875:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  80287b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80287e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802883:	09 c8                	or     %ecx,%eax
+  802885:	0f 85 4d ff ff ff    	jne    8027d8 <nsipc_sendmsg+0x6f>
+  80288b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802891:	0f 86 41 ff ff ff    	jbe    8027d8 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802897:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80289d:	85 ff                	test   %edi,%edi
+  80289f:	0f 49 c7             	cmovns %edi,%eax
+  8028a2:	c1 f8 0c             	sar    $0xc,%eax
+  8028a5:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8028a7:	89 d1                	mov    %edx,%ecx
+  8028a9:	c1 e9 0c             	shr    $0xc,%ecx
+  8028ac:	01 c8                	add    %ecx,%eax
+  8028ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8028b1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028b4:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8028b6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8028b9:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8028be:	29 c8                	sub    %ecx,%eax
+  8028c0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8028c3:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8028c6:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8028c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028cd:	89 f9                	mov    %edi,%ecx
+  8028cf:	d3 e0                	shl    %cl,%eax
+  8028d1:	09 05 ac b3 80 00    	or     %eax,0x80b3ac
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+  8028da:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8028dc:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8028df:	50                   	push   %eax
+  8028e0:	6a 00                	push   $0x0
+  8028e2:	56                   	push   %esi
+  8028e3:	6a 00                	push   $0x0
+  8028e5:	68 a0 b0 80 00       	push   $0x80b0a0
+  8028ea:	e8 97 1a 00 00       	call   804386 <pgbatch_map>
+  8028ef:	83 c4 20             	add    $0x20,%esp
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	0f 88 ce fe ff ff    	js     8027c8 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8028fa:	83 c7 01             	add    $0x1,%edi
+  8028fd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802903:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802906:	39 c7                	cmp    %eax,%edi
+  802908:	75 be                	jne    8028c8 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80290a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80290d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802910:	89 d6                	mov    %edx,%esi
+  802912:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802918:	e9 01 ff ff ff       	jmp    80281e <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80291d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802920:	85 db                	test   %ebx,%ebx
+  802922:	0f 45 c3             	cmovne %ebx,%eax
+  802925:	e9 a6 fe ff ff       	jmp    8027d0 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80292a:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80292e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802935:	e9 f3 fe ff ff       	jmp    80282d <nsipc_sendmsg+0xc4>
+  80293a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80293d:	eb 03                	jmp    802942 <nsipc_sendmsg+0x1d9>
+  80293f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802942:	83 ec 0c             	sub    $0xc,%esp
+  802945:	68 a0 b0 80 00       	push   $0x80b0a0
+  80294a:	e8 87 19 00 00       	call   8042d6 <pgbatch_flush>
+  80294f:	83 c4 10             	add    $0x10,%esp
+  802952:	85 c0                	test   %eax,%eax
+  802954:	78 50                	js     8029a6 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802956:	8b 45 08             	mov    0x8(%ebp),%eax
+  802959:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80295e:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802964:	89 fb                	mov    %edi,%ebx
+  802966:	29 f3                	sub    %esi,%ebx
+  802968:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80296e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802971:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802976:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80297b:	89 fa                	mov    %edi,%edx
+  80297d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802982:	e8 66 fb ff ff       	call   8024ed <nsipc_bulk>
+  802987:	85 c0                	test   %eax,%eax
+  802989:	78 28                	js     8029b3 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80298b:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80298e:	39 c3                	cmp    %eax,%ebx
+  802990:	75 0c                	jne    80299e <nsipc_sendmsg+0x235>
+  802992:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802995:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802998:	0f 8f f2 fd ff ff    	jg     802790 <nsipc_sendmsg+0x27>
+		sent += r;
+  80299e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8029a1:	e9 2a fe ff ff       	jmp    8027d0 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8029a6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8029a9:	85 db                	test   %ebx,%ebx
+  8029ab:	0f 45 c3             	cmovne %ebx,%eax
+  8029ae:	e9 1d fe ff ff       	jmp    8027d0 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8029b3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8029b6:	85 db                	test   %ebx,%ebx
+  8029b8:	0f 45 c3             	cmovne %ebx,%eax
+  8029bb:	e9 10 fe ff ff       	jmp    8027d0 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8029c0:	83 ec 0c             	sub    $0xc,%esp
+  8029c3:	68 a0 b0 80 00       	push   $0x80b0a0
+  8029c8:	e8 fb 18 00 00       	call   8042c8 <pgbatch_init>
+  8029cd:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8029d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029da:	e9 63 ff ff ff       	jmp    802942 <nsipc_sendmsg+0x1d9>
+
+008029df <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8029df:	55                   	push   %ebp
+  8029e0:	89 e5                	mov    %esp,%ebp
+  8029e2:	57                   	push   %edi
+  8029e3:	56                   	push   %esi
+  8029e4:	53                   	push   %ebx
+  8029e5:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8029e8:	83 3d a8 b3 80 00 00 	cmpl   $0x0,0x80b3a8
+  8029ef:	0f 84 c8 00 00 00    	je     802abd <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8029f5:	83 3d a4 b3 80 00 00 	cmpl   $0x0,0x80b3a4
+  8029fc:	0f 84 e4 00 00 00    	je     802ae6 <nsipc_sendfile+0x107>
+{
+  802a02:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802a07:	89 fb                	mov    %edi,%ebx
+  802a09:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802a0c:	0f 83 f0 00 00 00    	jae    802b02 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802a12:	89 fa                	mov    %edi,%edx
+  802a14:	03 55 10             	add    0x10(%ebp),%edx
+  802a17:	89 d0                	mov    %edx,%eax
+  802a19:	c1 f8 1f             	sar    $0x1f,%eax
+  802a1c:	c1 e8 14             	shr    $0x14,%eax
+  802a1f:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802a22:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802a28:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802a2a:	6a 10                	push   $0x10
+  802a2c:	68 00 20 01 e0       	push   $0xe0012000
+  802a31:	52                   	push   %edx
+  802a32:	ff 75 0c             	push   0xc(%ebp)
+  802a35:	e8 fe f4 ff ff       	call   801f38 <fmap>
+  802a3a:	83 c4 10             	add    $0x10,%esp
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	0f 8e b8 00 00 00    	jle    802afd <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802a45:	39 c6                	cmp    %eax,%esi
+  802a47:	0f 8d b5 00 00 00    	jge    802b02 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802a4d:	29 f0                	sub    %esi,%eax
+  802a4f:	8b 55 14             	mov    0x14(%ebp),%edx
+  802a52:	29 da                	sub    %ebx,%edx
+  802a54:	39 d0                	cmp    %edx,%eax
+  802a56:	89 d3                	mov    %edx,%ebx
+  802a58:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5e:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802a63:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802a69:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802a6f:	8b 45 18             	mov    0x18(%ebp),%eax
+  802a72:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802a77:	83 ec 0c             	sub    $0xc,%esp
+  802a7a:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802a7c:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802a83:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802a86:	83 c0 01             	add    $0x1,%eax
+  802a89:	50                   	push   %eax
+  802a8a:	68 00 10 01 e0       	push   $0xe0011000
+  802a8f:	6a 11                	push   $0x11
+  802a91:	ff 35 a4 b3 80 00    	push   0x80b3a4
+  802a97:	e8 6c 27 00 00       	call   805208 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802a9c:	83 c4 1c             	add    $0x1c,%esp
+  802a9f:	6a 00                	push   $0x0
+  802aa1:	6a 00                	push   $0x0
+  802aa3:	6a 00                	push   $0x0
+  802aa5:	e8 9a 24 00 00       	call   804f44 <ipc_recv>
+  802aaa:	83 c4 10             	add    $0x10,%esp
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 5b                	js     802b0c <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802ab1:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802ab3:	39 c3                	cmp    %eax,%ebx
+  802ab5:	0f 8e 4c ff ff ff    	jle    802a07 <nsipc_sendfile+0x28>
+  802abb:	eb 45                	jmp    802b02 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802abd:	83 ec 04             	sub    $0x4,%esp
+  802ac0:	6a 07                	push   $0x7
+  802ac2:	68 00 10 01 e0       	push   $0xe0011000
+  802ac7:	6a 00                	push   $0x0
+  802ac9:	e8 89 e7 ff ff       	call   801257 <sys_page_alloc>
+  802ace:	89 c7                	mov    %eax,%edi
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	78 2b                	js     802b02 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802ad7:	c7 05 a8 b3 80 00 01 	movl   $0x1,0x80b3a8
+  802ade:	00 00 00 
+  802ae1:	e9 0f ff ff ff       	jmp    8029f5 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ae6:	83 ec 0c             	sub    $0xc,%esp
+  802ae9:	6a 03                	push   $0x3
+  802aeb:	e8 4d 27 00 00       	call   80523d <ipc_find_env>
+  802af0:	a3 a4 b3 80 00       	mov    %eax,0x80b3a4
+  802af5:	83 c4 10             	add    $0x10,%esp
+  802af8:	e9 05 ff ff ff       	jmp    802a02 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802afd:	85 ff                	test   %edi,%edi
+  802aff:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802b02:	89 f8                	mov    %edi,%eax
+  802b04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b07:	5b                   	pop    %ebx
+  802b08:	5e                   	pop    %esi
+  802b09:	5f                   	pop    %edi
+  802b0a:	5d                   	pop    %ebp
+  802b0b:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802b0c:	85 ff                	test   %edi,%edi
+  802b0e:	0f 44 f8             	cmove  %eax,%edi
+  802b11:	eb ef                	jmp    802b02 <nsipc_sendfile+0x123>
+
+00802b13 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	57                   	push   %edi
+  802b17:	56                   	push   %esi
+  802b18:	53                   	push   %ebx
+  802b19:	83 ec 1c             	sub    $0x1c,%esp
+  802b1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802b1f:	e8 13 f9 ff ff       	call   802437 <nsbulk_map>
+  802b24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b27:	85 c0                	test   %eax,%eax
+  802b29:	0f 88 ba 00 00 00    	js     802be9 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802b2f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b33:	0f 8e bb 00 00 00    	jle    802bf4 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802b39:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802b3e:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802b43:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802b48:	89 f8                	mov    %edi,%eax
+  802b4a:	29 f0                	sub    %esi,%eax
+  802b4c:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802b50:	39 c8                	cmp    %ecx,%eax
+  802b52:	0f 47 c1             	cmova  %ecx,%eax
+  802b55:	01 f0                	add    %esi,%eax
+  802b57:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802b59:	83 c2 01             	add    $0x1,%edx
+  802b5c:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802b5f:	7e 07                	jle    802b68 <nsipc_recvmsg+0x55>
+  802b61:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802b66:	7e e0                	jle    802b48 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802b68:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802b6e:	c1 fa 0c             	sar    $0xc,%edx
+  802b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b76:	e8 0a f9 ff ff       	call   802485 <nsbulk_own>
+  802b7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b7e:	85 c0                	test   %eax,%eax
+  802b80:	78 67                	js     802be9 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b85:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802b8a:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802b90:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b93:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802b98:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802b9d:	89 f2                	mov    %esi,%edx
+  802b9f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802ba4:	e8 44 f9 ff ff       	call   8024ed <nsipc_bulk>
+  802ba9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bac:	85 c0                	test   %eax,%eax
+  802bae:	78 39                	js     802be9 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802bb0:	39 f0                	cmp    %esi,%eax
+  802bb2:	7f 4a                	jg     802bfe <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	7e 2c                	jle    802be9 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802bbd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802bc0:	29 fe                	sub    %edi,%esi
+  802bc2:	8b 43 04             	mov    0x4(%ebx),%eax
+  802bc5:	39 c6                	cmp    %eax,%esi
+  802bc7:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802bca:	83 ec 04             	sub    $0x4,%esp
+  802bcd:	56                   	push   %esi
+  802bce:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802bd4:	50                   	push   %eax
+  802bd5:	ff 33                	push   (%ebx)
+  802bd7:	e8 f7 e3 ff ff       	call   800fd3 <memmove>
+		n += m;
+  802bdc:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802bde:	83 c3 08             	add    $0x8,%ebx
+  802be1:	83 c4 10             	add    $0x10,%esp
+  802be4:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802be7:	7f d4                	jg     802bbd <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802be9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bef:	5b                   	pop    %ebx
+  802bf0:	5e                   	pop    %esi
+  802bf1:	5f                   	pop    %edi
+  802bf2:	5d                   	pop    %ebp
+  802bf3:	c3                   	ret
+	int r, i, n, len = 0;
+  802bf4:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf9:	e9 6a ff ff ff       	jmp    802b68 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802bfe:	68 20 5a 80 00       	push   $0x805a20
+  802c03:	68 29 5a 80 00       	push   $0x805a29
+  802c08:	68 3b 01 00 00       	push   $0x13b
+  802c0d:	68 3e 5a 80 00       	push   $0x805a3e
+  802c12:	e8 3a da ff ff       	call   800651 <_panic>
+
+00802c17 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802c17:	55                   	push   %ebp
+  802c18:	89 e5                	mov    %esp,%ebp
+  802c1a:	57                   	push   %edi
+  802c1b:	56                   	push   %esi
+  802c1c:	53                   	push   %ebx
+  802c1d:	83 ec 0c             	sub    $0xc,%esp
+  802c20:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802c23:	8b 75 10             	mov    0x10(%ebp),%esi
+  802c26:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2c:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.select.req_readset = *readset;
+  802c31:	8b 07                	mov    (%edi),%eax
+  802c33:	a3 04 e0 80 00       	mov    %eax,0x80e004
+  802c38:	8b 47 04             	mov    0x4(%edi),%eax
+  802c3b:	a3 08 e0 80 00       	mov    %eax,0x80e008
+  802c40:	8b 47 08             	mov    0x8(%edi),%eax
+  802c43:	a3 0c e0 80 00       	mov    %eax,0x80e00c
+  802c48:	8b 47 0c             	mov    0xc(%edi),%eax
+  802c4b:	a3 10 e0 80 00       	mov    %eax,0x80e010
+  802c50:	8b 47 10             	mov    0x10(%edi),%eax
+  802c53:	a3 14 e0 80 00       	mov    %eax,0x80e014
+  802c58:	8b 47 14             	mov    0x14(%edi),%eax
+  802c5b:	a3 18 e0 80 00       	mov    %eax,0x80e018
+  802c60:	8b 47 18             	mov    0x18(%edi),%eax
+  802c63:	a3 1c e0 80 00       	mov    %eax,0x80e01c
+  802c68:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802c6b:	a3 20 e0 80 00       	mov    %eax,0x80e020
+  802c70:	8b 47 20             	mov    0x20(%edi),%eax
+  802c73:	a3 24 e0 80 00       	mov    %eax,0x80e024
+  802c78:	8b 47 24             	mov    0x24(%edi),%eax
+  802c7b:	a3 28 e0 80 00       	mov    %eax,0x80e028
+  802c80:	8b 47 28             	mov    0x28(%edi),%eax
+  802c83:	a3 2c e0 80 00       	mov    %eax,0x80e02c
+  802c88:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802c8b:	a3 30 e0 80 00       	mov    %eax,0x80e030
+  802c90:	8b 47 30             	mov    0x30(%edi),%eax
+  802c93:	a3 34 e0 80 00       	mov    %eax,0x80e034
+  802c98:	8b 47 34             	mov    0x34(%edi),%eax
+  802c9b:	a3 38 e0 80 00       	mov    %eax,0x80e038
+  802ca0:	8b 47 38             	mov    0x38(%edi),%eax
+  802ca3:	a3 3c e0 80 00       	mov    %eax,0x80e03c
+  802ca8:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802cab:	a3 40 e0 80 00       	mov    %eax,0x80e040
+	nsipcbuf.select.req_writeset = *writeset;
+  802cb0:	8b 06                	mov    (%esi),%eax
+  802cb2:	a3 44 e0 80 00       	mov    %eax,0x80e044
+  802cb7:	8b 46 04             	mov    0x4(%esi),%eax
+  802cba:	a3 48 e0 80 00       	mov    %eax,0x80e048
+  802cbf:	8b 46 08             	mov    0x8(%esi),%eax
+  802cc2:	a3 4c e0 80 00       	mov    %eax,0x80e04c
+  802cc7:	8b 46 0c             	mov    0xc(%esi),%eax
+  802cca:	a3 50 e0 80 00       	mov    %eax,0x80e050
+  802ccf:	8b 46 10             	mov    0x10(%esi),%eax
+  802cd2:	a3 54 e0 80 00       	mov    %eax,0x80e054
+  802cd7:	8b 46 14             	mov    0x14(%esi),%eax
+  802cda:	a3 58 e0 80 00       	mov    %eax,0x80e058
+  802cdf:	8b 46 18             	mov    0x18(%esi),%eax
+  802ce2:	a3 5c e0 80 00       	mov    %eax,0x80e05c
+  802ce7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802cea:	a3 60 e0 80 00       	mov    %eax,0x80e060
+  802cef:	8b 46 20             	mov    0x20(%esi),%eax
+  802cf2:	a3 64 e0 80 00       	mov    %eax,0x80e064
+  802cf7:	8b 46 24             	mov    0x24(%esi),%eax
+  802cfa:	a3 68 e0 80 00       	mov    %eax,0x80e068
+  802cff:	8b 46 28             	mov    0x28(%esi),%eax
+  802d02:	a3 6c e0 80 00       	mov    %eax,0x80e06c
+  802d07:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802d0a:	a3 70 e0 80 00       	mov    %eax,0x80e070
+  802d0f:	8b 46 30             	mov    0x30(%esi),%eax
+  802d12:	a3 74 e0 80 00       	mov    %eax,0x80e074
+  802d17:	8b 46 34             	mov    0x34(%esi),%eax
+  802d1a:	a3 78 e0 80 00       	mov    %eax,0x80e078
+  802d1f:	8b 46 38             	mov    0x38(%esi),%eax
+  802d22:	a3 7c e0 80 00       	mov    %eax,0x80e07c
+  802d27:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802d2a:	a3 80 e0 80 00       	mov    %eax,0x80e080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802d2f:	8b 03                	mov    (%ebx),%eax
+  802d31:	a3 84 e0 80 00       	mov    %eax,0x80e084
+  802d36:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d39:	a3 88 e0 80 00       	mov    %eax,0x80e088
+  802d3e:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d41:	a3 8c e0 80 00       	mov    %eax,0x80e08c
+  802d46:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802d49:	a3 90 e0 80 00       	mov    %eax,0x80e090
+  802d4e:	8b 43 10             	mov    0x10(%ebx),%eax
+  802d51:	a3 94 e0 80 00       	mov    %eax,0x80e094
+  802d56:	8b 43 14             	mov    0x14(%ebx),%eax
+  802d59:	a3 98 e0 80 00       	mov    %eax,0x80e098
+  802d5e:	8b 43 18             	mov    0x18(%ebx),%eax
+  802d61:	a3 9c e0 80 00       	mov    %eax,0x80e09c
+  802d66:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802d69:	a3 a0 e0 80 00       	mov    %eax,0x80e0a0
+  802d6e:	8b 43 20             	mov    0x20(%ebx),%eax
+  802d71:	a3 a4 e0 80 00       	mov    %eax,0x80e0a4
+  802d76:	8b 43 24             	mov    0x24(%ebx),%eax
+  802d79:	a3 a8 e0 80 00       	mov    %eax,0x80e0a8
+  802d7e:	8b 43 28             	mov    0x28(%ebx),%eax
+  802d81:	a3 ac e0 80 00       	mov    %eax,0x80e0ac
+  802d86:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802d89:	a3 b0 e0 80 00       	mov    %eax,0x80e0b0
+  802d8e:	8b 43 30             	mov    0x30(%ebx),%eax
+  802d91:	a3 b4 e0 80 00       	mov    %eax,0x80e0b4
+  802d96:	8b 43 34             	mov    0x34(%ebx),%eax
+  802d99:	a3 b8 e0 80 00       	mov    %eax,0x80e0b8
+  802d9e:	8b 43 38             	mov    0x38(%ebx),%eax
+  802da1:	a3 bc e0 80 00       	mov    %eax,0x80e0bc
+  802da6:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802da9:	a3 c0 e0 80 00       	mov    %eax,0x80e0c0
+	nsipcbuf.select.req_timeout = msec;
+  802dae:	8b 45 18             	mov    0x18(%ebp),%eax
+  802db1:	a3 c4 e0 80 00       	mov    %eax,0x80e0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802db6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802dbb:	e8 2b f6 ff ff       	call   8023eb <nsipc>
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	0f 88 ad 01 00 00    	js     802f75 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802dc8:	8b 15 04 e0 80 00    	mov    0x80e004,%edx
+  802dce:	89 17                	mov    %edx,(%edi)
+  802dd0:	8b 15 08 e0 80 00    	mov    0x80e008,%edx
+  802dd6:	89 57 04             	mov    %edx,0x4(%edi)
+  802dd9:	8b 15 0c e0 80 00    	mov    0x80e00c,%edx
+  802ddf:	89 57 08             	mov    %edx,0x8(%edi)
+  802de2:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  802de8:	89 57 0c             	mov    %edx,0xc(%edi)
+  802deb:	8b 15 14 e0 80 00    	mov    0x80e014,%edx
+  802df1:	89 57 10             	mov    %edx,0x10(%edi)
+  802df4:	8b 15 18 e0 80 00    	mov    0x80e018,%edx
+  802dfa:	89 57 14             	mov    %edx,0x14(%edi)
+  802dfd:	8b 15 1c e0 80 00    	mov    0x80e01c,%edx
+  802e03:	89 57 18             	mov    %edx,0x18(%edi)
+  802e06:	8b 15 20 e0 80 00    	mov    0x80e020,%edx
+  802e0c:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802e0f:	8b 15 24 e0 80 00    	mov    0x80e024,%edx
+  802e15:	89 57 20             	mov    %edx,0x20(%edi)
+  802e18:	8b 15 28 e0 80 00    	mov    0x80e028,%edx
+  802e1e:	89 57 24             	mov    %edx,0x24(%edi)
+  802e21:	8b 15 2c e0 80 00    	mov    0x80e02c,%edx
+  802e27:	89 57 28             	mov    %edx,0x28(%edi)
+  802e2a:	8b 15 30 e0 80 00    	mov    0x80e030,%edx
+  802e30:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802e33:	8b 15 34 e0 80 00    	mov    0x80e034,%edx
+  802e39:	89 57 30             	mov    %edx,0x30(%edi)
+  802e3c:	8b 15 38 e0 80 00    	mov    0x80e038,%edx
+  802e42:	89 57 34             	mov    %edx,0x34(%edi)
+  802e45:	8b 15 3c e0 80 00    	mov    0x80e03c,%edx
+  802e4b:	89 57 38             	mov    %edx,0x38(%edi)
+  802e4e:	8b 15 40 e0 80 00    	mov    0x80e040,%edx
+  802e54:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802e57:	8b 15 44 e0 80 00    	mov    0x80e044,%edx
+  802e5d:	89 16                	mov    %edx,(%esi)
+  802e5f:	8b 15 48 e0 80 00    	mov    0x80e048,%edx
+  802e65:	89 56 04             	mov    %edx,0x4(%esi)
+  802e68:	8b 15 4c e0 80 00    	mov    0x80e04c,%edx
+  802e6e:	89 56 08             	mov    %edx,0x8(%esi)
+  802e71:	8b 15 50 e0 80 00    	mov    0x80e050,%edx
+  802e77:	89 56 0c             	mov    %edx,0xc(%esi)
+  802e7a:	8b 15 54 e0 80 00    	mov    0x80e054,%edx
+  802e80:	89 56 10             	mov    %edx,0x10(%esi)
+  802e83:	8b 15 58 e0 80 00    	mov    0x80e058,%edx
+  802e89:	89 56 14             	mov    %edx,0x14(%esi)
+  802e8c:	8b 15 5c e0 80 00    	mov    0x80e05c,%edx
+  802e92:	89 56 18             	mov    %edx,0x18(%esi)
+  802e95:	8b 15 60 e0 80 00    	mov    0x80e060,%edx
+  802e9b:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802e9e:	8b 15 64 e0 80 00    	mov    0x80e064,%edx
+  802ea4:	89 56 20             	mov    %edx,0x20(%esi)
+  802ea7:	8b 15 68 e0 80 00    	mov    0x80e068,%edx
+  802ead:	89 56 24             	mov    %edx,0x24(%esi)
+  802eb0:	8b 15 6c e0 80 00    	mov    0x80e06c,%edx
+  802eb6:	89 56 28             	mov    %edx,0x28(%esi)
+  802eb9:	8b 15 70 e0 80 00    	mov    0x80e070,%edx
+  802ebf:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802ec2:	8b 15 74 e0 80 00    	mov    0x80e074,%edx
+  802ec8:	89 56 30             	mov    %edx,0x30(%esi)
+  802ecb:	8b 15 78 e0 80 00    	mov    0x80e078,%edx
+  802ed1:	89 56 34             	mov    %edx,0x34(%esi)
+  802ed4:	8b 15 7c e0 80 00    	mov    0x80e07c,%edx
+  802eda:	89 56 38             	mov    %edx,0x38(%esi)
+  802edd:	8b 15 80 e0 80 00    	mov    0x80e080,%edx
+  802ee3:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802ee6:	8b 15 84 e0 80 00    	mov    0x80e084,%edx
+  802eec:	89 13                	mov    %edx,(%ebx)
+  802eee:	8b 15 88 e0 80 00    	mov    0x80e088,%edx
+  802ef4:	89 53 04             	mov    %edx,0x4(%ebx)
+  802ef7:	8b 15 8c e0 80 00    	mov    0x80e08c,%edx
+  802efd:	89 53 08             	mov    %edx,0x8(%ebx)
+  802f00:	8b 15 90 e0 80 00    	mov    0x80e090,%edx
+  802f06:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802f09:	8b 15 94 e0 80 00    	mov    0x80e094,%edx
+  802f0f:	89 53 10             	mov    %edx,0x10(%ebx)
+  802f12:	8b 15 98 e0 80 00    	mov    0x80e098,%edx
+  802f18:	89 53 14             	mov    %edx,0x14(%ebx)
+  802f1b:	8b 15 9c e0 80 00    	mov    0x80e09c,%edx
+  802f21:	89 53 18             	mov    %edx,0x18(%ebx)
+  802f24:	8b 15 a0 e0 80 00    	mov    0x80e0a0,%edx
+  802f2a:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802f2d:	8b 15 a4 e0 80 00    	mov    0x80e0a4,%edx
+  802f33:	89 53 20             	mov    %edx,0x20(%ebx)
+  802f36:	8b 15 a8 e0 80 00    	mov    0x80e0a8,%edx
+  802f3c:	89 53 24             	mov    %edx,0x24(%ebx)
+  802f3f:	8b 15 ac e0 80 00    	mov    0x80e0ac,%edx
+  802f45:	89 53 28             	mov    %edx,0x28(%ebx)
+  802f48:	8b 15 b0 e0 80 00    	mov    0x80e0b0,%edx
+  802f4e:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802f51:	8b 15 b4 e0 80 00    	mov    0x80e0b4,%edx
+  802f57:	89 53 30             	mov    %edx,0x30(%ebx)
+  802f5a:	8b 15 b8 e0 80 00    	mov    0x80e0b8,%edx
+  802f60:	89 53 34             	mov    %edx,0x34(%ebx)
+  802f63:	8b 15 bc e0 80 00    	mov    0x80e0bc,%edx
+  802f69:	89 53 38             	mov    %edx,0x38(%ebx)
+  802f6c:	8b 15 c0 e0 80 00    	mov    0x80e0c0,%edx
+  802f72:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802f75:	83 c4 0c             	add    $0xc,%esp
+  802f78:	5b                   	pop    %ebx
+  802f79:	5e                   	pop    %esi
+  802f7a:	5f                   	pop    %edi
+  802f7b:	5d                   	pop    %ebp
+  802f7c:	c3                   	ret
+
+00802f7d <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802f7d:	55                   	push   %ebp
+  802f7e:	89 e5                	mov    %esp,%ebp
+  802f80:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802f83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f86:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.evctl.req_events = events;
+  802f8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f8e:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.evctl.req_data = data;
+  802f93:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f96:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_EVCTL);
+  802f9b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802fa0:	e8 46 f4 ff ff       	call   8023eb <nsipc>
+}
+  802fa5:	c9                   	leave
+  802fa6:	c3                   	ret
+
+00802fa7 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802fa7:	55                   	push   %ebp
+  802fa8:	89 e5                	mov    %esp,%ebp
+  802faa:	56                   	push   %esi
+  802fab:	53                   	push   %ebx
+  802fac:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802faf:	89 35 00 e0 80 00    	mov    %esi,0x80e000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802fb5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fb8:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802fbd:	b8 10 00 00 00       	mov    $0x10,%eax
+  802fc2:	e8 24 f4 ff ff       	call   8023eb <nsipc>
+  802fc7:	89 c3                	mov    %eax,%ebx
+  802fc9:	85 c0                	test   %eax,%eax
+  802fcb:	7e 1f                	jle    802fec <nsipc_evwait+0x45>
+		assert(r <= max);
+  802fcd:	39 c6                	cmp    %eax,%esi
+  802fcf:	7c 24                	jl     802ff5 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802fd1:	83 ec 04             	sub    $0x4,%esp
+  802fd4:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802fdb:	50                   	push   %eax
+  802fdc:	68 00 e0 80 00       	push   $0x80e000
+  802fe1:	ff 75 08             	push   0x8(%ebp)
+  802fe4:	e8 ea df ff ff       	call   800fd3 <memmove>
+  802fe9:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802fec:	89 d8                	mov    %ebx,%eax
+  802fee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ff1:	5b                   	pop    %ebx
+  802ff2:	5e                   	pop    %esi
+  802ff3:	5d                   	pop    %ebp
+  802ff4:	c3                   	ret
+		assert(r <= max);
+  802ff5:	68 56 5a 80 00       	push   $0x805a56
+  802ffa:	68 29 5a 80 00       	push   $0x805a29
+  802fff:	68 6a 01 00 00       	push   $0x16a
+  803004:	68 3e 5a 80 00       	push   $0x805a3e
+  803009:	e8 43 d6 ff ff       	call   800651 <_panic>
+
+0080300e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80300e:	55                   	push   %ebp
+  80300f:	89 e5                	mov    %esp,%ebp
+  803011:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803014:	8b 45 08             	mov    0x8(%ebp),%eax
+  803017:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.socket.req_type = type;
+  80301c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80301f:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.socket.req_protocol = protocol;
+  803024:	8b 45 10             	mov    0x10(%ebp),%eax
+  803027:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SOCKET);
+  80302c:	b8 09 00 00 00       	mov    $0x9,%eax
+  803031:	e8 b5 f3 ff ff       	call   8023eb <nsipc>
+}
+  803036:	c9                   	leave
+  803037:	c3                   	ret
+
+00803038 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803038:	55                   	push   %ebp
+  803039:	89 e5                	mov    %esp,%ebp
+  80303b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  80303e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803041:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_OFFLOAD);
+  803046:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80304b:	e8 9b f3 ff ff       	call   8023eb <nsipc>
+}
+  803050:	c9                   	leave
+  803051:	c3                   	ret
+
+00803052 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803052:	55                   	push   %ebp
+  803053:	89 e5                	mov    %esp,%ebp
+  803055:	53                   	push   %ebx
+  803056:	83 ec 04             	sub    $0x4,%esp
+  803059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  80305c:	b8 12 00 00 00       	mov    $0x12,%eax
+  803061:	e8 85 f3 ff ff       	call   8023eb <nsipc>
+  803066:	85 c0                	test   %eax,%eax
+  803068:	78 50                	js     8030ba <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  80306a:	8b 15 00 e0 80 00    	mov    0x80e000,%edx
+  803070:	89 13                	mov    %edx,(%ebx)
+  803072:	8b 15 04 e0 80 00    	mov    0x80e004,%edx
+  803078:	89 53 04             	mov    %edx,0x4(%ebx)
+  80307b:	8b 15 08 e0 80 00    	mov    0x80e008,%edx
+  803081:	89 53 08             	mov    %edx,0x8(%ebx)
+  803084:	8b 15 0c e0 80 00    	mov    0x80e00c,%edx
+  80308a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80308d:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  803093:	89 53 10             	mov    %edx,0x10(%ebx)
+  803096:	8b 15 14 e0 80 00    	mov    0x80e014,%edx
+  80309c:	89 53 14             	mov    %edx,0x14(%ebx)
+  80309f:	8b 15 18 e0 80 00    	mov    0x80e018,%edx
+  8030a5:	89 53 18             	mov    %edx,0x18(%ebx)
+  8030a8:	8b 15 1c e0 80 00    	mov    0x80e01c,%edx
+  8030ae:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8030b1:	8b 15 20 e0 80 00    	mov    0x80e020,%edx
+  8030b7:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8030ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+
+008030bf <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8030bf:	55                   	push   %ebp
+  8030c0:	89 e5                	mov    %esp,%ebp
+  8030c2:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8030c5:	6a 03                	push   $0x3
+  8030c7:	e8 71 21 00 00       	call   80523d <ipc_find_env>
+  8030cc:	a3 a4 b3 80 00       	mov    %eax,0x80b3a4
+	nsipcbuf.shard.req_shard = shard;
+  8030d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d4:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8030d9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8030de:	e8 08 f3 ff ff       	call   8023eb <nsipc>
+  8030e3:	83 c4 10             	add    $0x10,%esp
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	78 0a                	js     8030f4 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8030ea:	a3 a4 b3 80 00       	mov    %eax,0x80b3a4
+	return 0;
+  8030ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030f4:	c9                   	leave
+  8030f5:	c3                   	ret
+
+008030f6 <list_remove>:
+}
+
+static void
+list_remove(struct mspan **head, struct mspan *mp)
+{
+	if (mp->mp_prev)
+  8030f6:	8b 4a 14             	mov    0x14(%edx),%ecx
+  8030f9:	85 c9                	test   %ecx,%ecx
+  8030fb:	74 14                	je     803111 <list_remove+0x1b>
+		mp->mp_prev->mp_next = mp->mp_next;
+  8030fd:	8b 42 10             	mov    0x10(%edx),%eax
+  803100:	89 41 10             	mov    %eax,0x10(%ecx)
+	else
+		*head = mp->mp_next;
+	if (mp->mp_next)
+  803103:	8b 42 10             	mov    0x10(%edx),%eax
+  803106:	85 c0                	test   %eax,%eax
+  803108:	74 06                	je     803110 <list_remove+0x1a>
+		mp->mp_next->mp_prev = mp->mp_prev;
+  80310a:	8b 52 14             	mov    0x14(%edx),%edx
+  80310d:	89 50 14             	mov    %edx,0x14(%eax)
+}
+  803110:	c3                   	ret
+		*head = mp->mp_next;
+  803111:	8b 4a 10             	mov    0x10(%edx),%ecx
+  803114:	89 08                	mov    %ecx,(%eax)
+  803116:	eb eb                	jmp    803103 <list_remove+0xd>
+
+00803118 <span_set>:
+}
+
+// Make 'mp' a span of 'npages', and tell the span above.
+static void
+span_set(struct mspan *mp, int npages, int kind)
+{
+  803118:	55                   	push   %ebp
+  803119:	89 e5                	mov    %esp,%ebp
+  80311b:	53                   	push   %ebx
+  80311c:	89 d3                	mov    %edx,%ebx
+	struct mspan *next;
+
+	mp->mp_magic = MSPAN_MAGIC;
+  80311e:	c7 00 4e 50 53 4d    	movl   $0x4d53504e,(%eax)
+	mp->mp_npages = npages;
+  803124:	66 89 50 04          	mov    %dx,0x4(%eax)
+	mp->mp_kind = kind;
+  803128:	88 48 08             	mov    %cl,0x8(%eax)
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  80312b:	0f b7 d2             	movzwl %dx,%edx
+  80312e:	c1 e2 0c             	shl    $0xc,%edx
+  803131:	01 c2                	add    %eax,%edx
+	return next < mtop ? (struct mspan *) next : NULL;
+  803133:	3b 15 a4 b8 80 00    	cmp    0x80b8a4,%edx
+  803139:	73 09                	jae    803144 <span_set+0x2c>
+	if ((next = span_next(mp)))
+		next->mp_prevpages = npages;
+  80313b:	66 89 5a 06          	mov    %bx,0x6(%edx)
+	else
+		mlast = mp;
+}
+  80313f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803142:	c9                   	leave
+  803143:	c3                   	ret
+		mlast = mp;
+  803144:	a3 a0 b8 80 00       	mov    %eax,0x80b8a0
+  803149:	eb f4                	jmp    80313f <span_set+0x27>
+
+0080314b <mlock_acquire>:
+}
+
+static void
+mlock_acquire(void)
+{
+	if (sforked)
+  80314b:	83 3d 04 f0 80 00 00 	cmpl   $0x0,0x80f004
+  803152:	75 01                	jne    803155 <mlock_acquire+0xa>
+  803154:	c3                   	ret
+{
+  803155:	55                   	push   %ebp
+  803156:	89 e5                	mov    %esp,%ebp
+  803158:	83 ec 14             	sub    $0x14,%esp
+		mutex_lock(&mlock);
+  80315b:	68 c0 b3 80 00       	push   $0x80b3c0
+  803160:	e8 17 13 00 00       	call   80447c <mutex_lock>
+  803165:	83 c4 10             	add    $0x10,%esp
+}
+  803168:	c9                   	leave
+  803169:	c3                   	ret
+
+0080316a <mlock_release>:
+
+static void
+mlock_release(void)
+{
+	if (sforked)
+  80316a:	83 3d 04 f0 80 00 00 	cmpl   $0x0,0x80f004
+  803171:	75 01                	jne    803174 <mlock_release+0xa>
+  803173:	c3                   	ret
+{
+  803174:	55                   	push   %ebp
+  803175:	89 e5                	mov    %esp,%ebp
+  803177:	83 ec 14             	sub    $0x14,%esp
+		mutex_unlock(&mlock);
+  80317a:	68 c0 b3 80 00       	push   $0x80b3c0
+  80317f:	e8 66 13 00 00       	call   8044ea <mutex_unlock>
+  803184:	83 c4 10             	add    $0x10,%esp
+}
+  803187:	c9                   	leave
+  803188:	c3                   	ret
+
+00803189 <span_of>:
+{
+  803189:	55                   	push   %ebp
+  80318a:	89 e5                	mov    %esp,%ebp
+  80318c:	83 ec 08             	sub    $0x8,%esp
+	struct mspan *mp = ROUNDDOWN(v, PGSIZE);
+  80318f:	89 c2                	mov    %eax,%edx
+  803191:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mtop);
+  803197:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80319c:	76 1a                	jbe    8031b8 <span_of+0x2f>
+  80319e:	3b 05 a4 b8 80 00    	cmp    0x80b8a4,%eax
+  8031a4:	73 12                	jae    8031b8 <span_of+0x2f>
+	assert(mp->mp_magic == MSPAN_MAGIC && mp->mp_kind != MS_FREE);
+  8031a6:	81 3a 4e 50 53 4d    	cmpl   $0x4d53504e,(%edx)
+  8031ac:	75 23                	jne    8031d1 <span_of+0x48>
+  8031ae:	80 7a 08 00          	cmpb   $0x0,0x8(%edx)
+  8031b2:	74 1d                	je     8031d1 <span_of+0x48>
+}
+  8031b4:	89 d0                	mov    %edx,%eax
+  8031b6:	c9                   	leave
+  8031b7:	c3                   	ret
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mtop);
+  8031b8:	68 60 5a 80 00       	push   $0x805a60
+  8031bd:	68 29 5a 80 00       	push   $0x805a29
+  8031c2:	68 4f 01 00 00       	push   $0x14f
+  8031c7:	68 c6 5a 80 00       	push   $0x805ac6
+  8031cc:	e8 80 d4 ff ff       	call   800651 <_panic>
+	assert(mp->mp_magic == MSPAN_MAGIC && mp->mp_kind != MS_FREE);
+  8031d1:	68 90 5a 80 00       	push   $0x805a90
+  8031d6:	68 29 5a 80 00       	push   $0x805a29
+  8031db:	68 50 01 00 00       	push   $0x150
+  8031e0:	68 c6 5a 80 00       	push   $0x805ac6
+  8031e5:	e8 67 d4 ff ff       	call   800651 <_panic>
+
+008031ea <span_merge>:
+{
+  8031ea:	55                   	push   %ebp
+  8031eb:	89 e5                	mov    %esp,%ebp
+  8031ed:	56                   	push   %esi
+  8031ee:	53                   	push   %ebx
+  8031ef:	89 c3                	mov    %eax,%ebx
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  8031f1:	0f b7 70 04          	movzwl 0x4(%eax),%esi
+  8031f5:	c1 e6 0c             	shl    $0xc,%esi
+  8031f8:	01 c6                	add    %eax,%esi
+	return next < mtop ? (struct mspan *) next : NULL;
+  8031fa:	3b 35 a4 b8 80 00    	cmp    0x80b8a4,%esi
+  803200:	73 06                	jae    803208 <span_merge+0x1e>
+	if ((other = span_next(mp)) && other->mp_kind == MS_FREE) {
+  803202:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+  803206:	74 23                	je     80322b <span_merge+0x41>
+	if (mp->mp_prevpages == 0)
+  803208:	0f b7 43 06          	movzwl 0x6(%ebx),%eax
+  80320c:	66 85 c0             	test   %ax,%ax
+  80320f:	74 10                	je     803221 <span_merge+0x37>
+	return (struct mspan *) ((uint8_t *) mp - mp->mp_prevpages * PGSIZE);
+  803211:	0f b7 c0             	movzwl %ax,%eax
+  803214:	c1 e0 0c             	shl    $0xc,%eax
+  803217:	89 de                	mov    %ebx,%esi
+  803219:	29 c6                	sub    %eax,%esi
+	if ((other = span_prev(mp)) && other->mp_kind == MS_FREE) {
+  80321b:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+  80321f:	74 3e                	je     80325f <span_merge+0x75>
+	mp->mp_kind = MS_FREE;
+  803221:	c6 43 08 00          	movb   $0x0,0x8(%ebx)
+}
+  803225:	89 d8                	mov    %ebx,%eax
+  803227:	5b                   	pop    %ebx
+  803228:	5e                   	pop    %esi
+  803229:	5d                   	pop    %ebp
+  80322a:	c3                   	ret
+		list_remove(bin_of(other->mp_npages), other);
+  80322b:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  80322f:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  803234:	39 d0                	cmp    %edx,%eax
+  803236:	0f 4f c2             	cmovg  %edx,%eax
+  803239:	8d 04 85 20 b8 80 00 	lea    0x80b820(,%eax,4),%eax
+		list_remove(bin_of(other->mp_npages), other);
+  803240:	89 f2                	mov    %esi,%edx
+  803242:	e8 af fe ff ff       	call   8030f6 <list_remove>
+		span_set(mp, mp->mp_npages + other->mp_npages, MS_FREE);
+  803247:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  80324b:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  80324f:	01 c2                	add    %eax,%edx
+  803251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803256:	89 d8                	mov    %ebx,%eax
+  803258:	e8 bb fe ff ff       	call   803118 <span_set>
+  80325d:	eb a9                	jmp    803208 <span_merge+0x1e>
+		list_remove(bin_of(other->mp_npages), other);
+  80325f:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  803263:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  803268:	39 d0                	cmp    %edx,%eax
+  80326a:	0f 4f c2             	cmovg  %edx,%eax
+  80326d:	8d 04 85 20 b8 80 00 	lea    0x80b820(,%eax,4),%eax
+		list_remove(bin_of(other->mp_npages), other);
+  803274:	89 f2                	mov    %esi,%edx
+  803276:	e8 7b fe ff ff       	call   8030f6 <list_remove>
+		span_set(other, other->mp_npages + mp->mp_npages, MS_FREE);
+  80327b:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  80327f:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  803283:	01 c2                	add    %eax,%edx
+  803285:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80328a:	89 f0                	mov    %esi,%eax
+  80328c:	e8 87 fe ff ff       	call   803118 <span_set>
+	return (struct mspan *) ((uint8_t *) mp - mp->mp_prevpages * PGSIZE);
+  803291:	89 f3                	mov    %esi,%ebx
+  803293:	eb 8c                	jmp    803221 <span_merge+0x37>
+
+00803295 <span_free>:
+{
+  803295:	55                   	push   %ebp
+  803296:	89 e5                	mov    %esp,%ebp
+  803298:	56                   	push   %esi
+  803299:	53                   	push   %ebx
+	mp = span_merge(mp);
+  80329a:	e8 4b ff ff ff       	call   8031ea <span_merge>
+  80329f:	89 c3                	mov    %eax,%ebx
+	if (mp == mlast && mp->mp_npages >= MTRIM) {
+  8032a1:	39 05 a0 b8 80 00    	cmp    %eax,0x80b8a0
+  8032a7:	74 34                	je     8032dd <span_free+0x48>
+	list_push(bin_of(mp->mp_npages), mp);
+  8032a9:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  8032ad:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  8032b2:	39 d0                	cmp    %edx,%eax
+  8032b4:	0f 4f c2             	cmovg  %edx,%eax
+	mp->mp_prev = NULL;
+  8032b7:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	mp->mp_next = *head;
+  8032be:	8b 14 85 20 b8 80 00 	mov    0x80b820(,%eax,4),%edx
+  8032c5:	89 53 10             	mov    %edx,0x10(%ebx)
+	if (*head)
+  8032c8:	85 d2                	test   %edx,%edx
+  8032ca:	74 03                	je     8032cf <span_free+0x3a>
+		(*head)->mp_prev = mp;
+  8032cc:	89 5a 14             	mov    %ebx,0x14(%edx)
+	*head = mp;
+  8032cf:	89 1c 85 20 b8 80 00 	mov    %ebx,0x80b820(,%eax,4)
+}
+  8032d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032d9:	5b                   	pop    %ebx
+  8032da:	5e                   	pop    %esi
+  8032db:	5d                   	pop    %ebp
+  8032dc:	c3                   	ret
+	if (mp == mlast && mp->mp_npages >= MTRIM) {
+  8032dd:	66 83 78 04 1f       	cmpw   $0x1f,0x4(%eax)
+  8032e2:	76 c5                	jbe    8032a9 <span_free+0x14>
+		pgbatch_init(&mbatch);
+  8032e4:	83 ec 0c             	sub    $0xc,%esp
+  8032e7:	68 e0 b3 80 00       	push   $0x80b3e0
+  8032ec:	e8 d7 0f 00 00       	call   8042c8 <pgbatch_init>
+		for (i = MGROW; i < mp->mp_npages; i++)
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	66 83 7b 04 10       	cmpw   $0x10,0x4(%ebx)
+  8032f9:	76 2a                	jbe    803325 <span_free+0x90>
+  8032fb:	be 10 00 00 00       	mov    $0x10,%esi
+			pgbatch_unmap(&mbatch, 0, (uint8_t *) mp + i * PGSIZE);
+  803300:	83 ec 04             	sub    $0x4,%esp
+  803303:	89 f0                	mov    %esi,%eax
+  803305:	c1 e0 0c             	shl    $0xc,%eax
+  803308:	01 d8                	add    %ebx,%eax
+  80330a:	50                   	push   %eax
+  80330b:	6a 00                	push   $0x0
+  80330d:	68 e0 b3 80 00       	push   $0x80b3e0
+  803312:	e8 b2 10 00 00       	call   8043c9 <pgbatch_unmap>
+		for (i = MGROW; i < mp->mp_npages; i++)
+  803317:	83 c6 01             	add    $0x1,%esi
+  80331a:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  80331e:	83 c4 10             	add    $0x10,%esp
+  803321:	39 f0                	cmp    %esi,%eax
+  803323:	7f db                	jg     803300 <span_free+0x6b>
+		pgbatch_flush(&mbatch);
+  803325:	83 ec 0c             	sub    $0xc,%esp
+  803328:	68 e0 b3 80 00       	push   $0x80b3e0
+  80332d:	e8 a4 0f 00 00       	call   8042d6 <pgbatch_flush>
+		mstat.ms_arena -= (mp->mp_npages - MGROW) * PGSIZE;
+  803332:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  803336:	83 e8 10             	sub    $0x10,%eax
+  803339:	c1 e0 0c             	shl    $0xc,%eax
+  80333c:	29 05 00 b7 80 00    	sub    %eax,0x80b700
+		mtop = (uint8_t *) mp + MGROW * PGSIZE;
+  803342:	8d 83 00 00 01 00    	lea    0x10000(%ebx),%eax
+  803348:	a3 a4 b8 80 00       	mov    %eax,0x80b8a4
+		mp->mp_npages = MGROW;
+  80334d:	66 c7 43 04 10 00    	movw   $0x10,0x4(%ebx)
+  803353:	83 c4 10             	add    $0x10,%esp
+  803356:	e9 4e ff ff ff       	jmp    8032a9 <span_free+0x14>
+
+0080335b <slab_free>:
+{
+  80335b:	55                   	push   %ebp
+  80335c:	89 e5                	mov    %esp,%ebp
+  80335e:	57                   	push   %edi
+  80335f:	56                   	push   %esi
+  803360:	53                   	push   %ebx
+  803361:	83 ec 0c             	sub    $0xc,%esp
+  803364:	89 c3                	mov    %eax,%ebx
+	int c = mp->mp_class;
+  803366:	0f b6 48 09          	movzbl 0x9(%eax),%ecx
+  80336a:	0f b6 f9             	movzbl %cl,%edi
+	*(void **) v = mp->mp_free;
+  80336d:	8b 40 0c             	mov    0xc(%eax),%eax
+  803370:	89 02                	mov    %eax,(%edx)
+	mp->mp_free = v;
+  803372:	89 53 0c             	mov    %edx,0xc(%ebx)
+	mstat.ms_inuse -= mclass_size[c];
+  803375:	0f b7 b4 3f e0 5a 80 	movzwl 0x805ae0(%edi,%edi,1),%esi
+  80337c:	00 
+  80337d:	0f b7 c6             	movzwl %si,%eax
+  803380:	29 05 04 b7 80 00    	sub    %eax,0x80b704
+	if (mp->mp_nfree++ == 0)
+  803386:	0f b7 43 0a          	movzwl 0xa(%ebx),%eax
+  80338a:	8d 50 01             	lea    0x1(%eax),%edx
+  80338d:	66 89 53 0a          	mov    %dx,0xa(%ebx)
+  803391:	66 85 c0             	test   %ax,%ax
+  803394:	74 1b                	je     8033b1 <slab_free+0x56>
+	if (mp->mp_nfree == (PGSIZE - MHDR) / mclass_size[c]
+  803396:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+  80339b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a0:	66 f7 f6             	div    %si
+  8033a3:	66 39 43 0a          	cmp    %ax,0xa(%ebx)
+  8033a7:	74 29                	je     8033d2 <slab_free+0x77>
+}
+  8033a9:	83 c4 0c             	add    $0xc,%esp
+  8033ac:	5b                   	pop    %ebx
+  8033ad:	5e                   	pop    %esi
+  8033ae:	5f                   	pop    %edi
+  8033af:	5d                   	pop    %ebp
+  8033b0:	c3                   	ret
+	mp->mp_prev = NULL;
+  8033b1:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	mp->mp_next = *head;
+  8033b8:	8b 04 bd c0 b7 80 00 	mov    0x80b7c0(,%edi,4),%eax
+  8033bf:	89 43 10             	mov    %eax,0x10(%ebx)
+	if (*head)
+  8033c2:	85 c0                	test   %eax,%eax
+  8033c4:	74 03                	je     8033c9 <slab_free+0x6e>
+		(*head)->mp_prev = mp;
+  8033c6:	89 58 14             	mov    %ebx,0x14(%eax)
+	*head = mp;
+  8033c9:	89 1c bd c0 b7 80 00 	mov    %ebx,0x80b7c0(,%edi,4)
+}
+  8033d0:	eb c4                	jmp    803396 <slab_free+0x3b>
+	    && (mp->mp_prev || mp->mp_next)) {
+  8033d2:	83 7b 14 00          	cmpl   $0x0,0x14(%ebx)
+  8033d6:	74 21                	je     8033f9 <slab_free+0x9e>
+		list_remove(&mslabs[c], mp);
+  8033d8:	0f b6 c9             	movzbl %cl,%ecx
+  8033db:	8d 04 8d c0 b7 80 00 	lea    0x80b7c0(,%ecx,4),%eax
+  8033e2:	89 da                	mov    %ebx,%edx
+  8033e4:	e8 0d fd ff ff       	call   8030f6 <list_remove>
+		mstat.ms_slabs--;
+  8033e9:	83 2d 08 b7 80 00 01 	subl   $0x1,0x80b708
+		span_free(mp);
+  8033f0:	89 d8                	mov    %ebx,%eax
+  8033f2:	e8 9e fe ff ff       	call   803295 <span_free>
+}
+  8033f7:	eb b0                	jmp    8033a9 <slab_free+0x4e>
+	    && (mp->mp_prev || mp->mp_next)) {
+  8033f9:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+  8033fd:	75 d9                	jne    8033d8 <slab_free+0x7d>
+  8033ff:	eb a8                	jmp    8033a9 <slab_free+0x4e>
+
+00803401 <free_locked>:
+	if (v == 0)
+  803401:	85 c0                	test   %eax,%eax
+  803403:	74 71                	je     803476 <free_locked+0x75>
+{
+  803405:	55                   	push   %ebp
+  803406:	89 e5                	mov    %esp,%ebp
+  803408:	56                   	push   %esi
+  803409:	53                   	push   %ebx
+  80340a:	89 c3                	mov    %eax,%ebx
+	struct mcache *mc = mcache_cur;
+  80340c:	8b 35 00 f0 80 00    	mov    0x80f000,%esi
+	mp = span_of(v);
+  803412:	e8 72 fd ff ff       	call   803189 <span_of>
+	if (mp->mp_kind == MS_SLAB) {
+  803417:	80 78 08 02          	cmpb   $0x2,0x8(%eax)
+  80341b:	75 41                	jne    80345e <free_locked+0x5d>
+		c = mp->mp_class;
+  80341d:	0f b6 50 09          	movzbl 0x9(%eax),%edx
+		if (mc && mc->mc_n[c] < mcache_max[c]) {
+  803421:	85 f6                	test   %esi,%esi
+  803423:	74 30                	je     803455 <free_locked+0x54>
+  803425:	0f b6 8a 20 b7 80 00 	movzbl 0x80b720(%edx),%ecx
+  80342c:	38 4c 16 58          	cmp    %cl,0x58(%esi,%edx,1)
+  803430:	73 23                	jae    803455 <free_locked+0x54>
+			*(void **) v = mc->mc_free[c];
+  803432:	8b 04 96             	mov    (%esi,%edx,4),%eax
+  803435:	89 03                	mov    %eax,(%ebx)
+			mc->mc_free[c] = v;
+  803437:	89 1c 96             	mov    %ebx,(%esi,%edx,4)
+			mc->mc_n[c]++;
+  80343a:	80 44 16 58 01       	addb   $0x1,0x58(%esi,%edx,1)
+			mstat.ms_cached += mclass_size[c];
+  80343f:	0f b7 84 12 e0 5a 80 	movzwl 0x805ae0(%edx,%edx,1),%eax
+  803446:	00 
+  803447:	01 05 14 b7 80 00    	add    %eax,0x80b714
+			mstat.ms_inuse -= mclass_size[c];
+  80344d:	29 05 04 b7 80 00    	sub    %eax,0x80b704
+			return;
+  803453:	eb 1d                	jmp    803472 <free_locked+0x71>
+		slab_free(mp, v);
+  803455:	89 da                	mov    %ebx,%edx
+  803457:	e8 ff fe ff ff       	call   80335b <slab_free>
+		return;
+  80345c:	eb 14                	jmp    803472 <free_locked+0x71>
+	mstat.ms_inuse -= mp->mp_size;
+  80345e:	8b 15 04 b7 80 00    	mov    0x80b704,%edx
+  803464:	2b 50 18             	sub    0x18(%eax),%edx
+  803467:	89 15 04 b7 80 00    	mov    %edx,0x80b704
+	span_free(mp);
+  80346d:	e8 23 fe ff ff       	call   803295 <span_free>
+}
+  803472:	5b                   	pop    %ebx
+  803473:	5e                   	pop    %esi
+  803474:	5d                   	pop    %ebp
+  803475:	c3                   	ret
+  803476:	c3                   	ret
+
+00803477 <span_alloc>:
+{
+  803477:	55                   	push   %ebp
+  803478:	89 e5                	mov    %esp,%ebp
+  80347a:	57                   	push   %edi
+  80347b:	56                   	push   %esi
+  80347c:	53                   	push   %ebx
+  80347d:	83 ec 1c             	sub    $0x1c,%esp
+  803480:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	if (npages > 0xFFFF)
+  803483:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803488:	0f 8f 08 02 00 00    	jg     803696 <span_alloc+0x21f>
+  80348e:	89 c6                	mov    %eax,%esi
+	npages = ROUNDUP(MAX(npages, MGROW), MGROW);
+  803490:	b8 10 00 00 00       	mov    $0x10,%eax
+  803495:	39 c6                	cmp    %eax,%esi
+  803497:	0f 4d c6             	cmovge %esi,%eax
+  80349a:	89 c7                	mov    %eax,%edi
+  80349c:	83 c7 0f             	add    $0xf,%edi
+  80349f:	83 e7 f0             	and    $0xfffffff0,%edi
+	if (npages > 0xFFFF || !isfree(mtop, npages * PGSIZE))
+  8034a2:	89 f8                	mov    %edi,%eax
+  8034a4:	c1 e0 0c             	shl    $0xc,%eax
+  8034a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8034aa:	e9 30 01 00 00       	jmp    8035df <span_alloc+0x168>
+		for (b = MIN(npages, MBINS - 1); b < MBINS && !mp; b++)
+  8034af:	83 c2 01             	add    $0x1,%edx
+  8034b2:	83 fa 20             	cmp    $0x20,%edx
+  8034b5:	0f 84 e2 01 00 00    	je     80369d <span_alloc+0x226>
+			for (mp = mbins[b]; mp; mp = mp->mp_next)
+  8034bb:	8b 1c 95 20 b8 80 00 	mov    0x80b820(,%edx,4),%ebx
+  8034c2:	85 db                	test   %ebx,%ebx
+  8034c4:	74 e9                	je     8034af <span_alloc+0x38>
+				if (mp->mp_npages >= npages)
+  8034c6:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  8034ca:	39 f0                	cmp    %esi,%eax
+  8034cc:	0f 8d f5 01 00 00    	jge    8036c7 <span_alloc+0x250>
+			for (mp = mbins[b]; mp; mp = mp->mp_next)
+  8034d2:	8b 5b 10             	mov    0x10(%ebx),%ebx
+  8034d5:	85 db                	test   %ebx,%ebx
+  8034d7:	75 ed                	jne    8034c6 <span_alloc+0x4f>
+  8034d9:	eb d4                	jmp    8034af <span_alloc+0x38>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8034db:	05 00 10 00 00       	add    $0x1000,%eax
+  8034e0:	39 c8                	cmp    %ecx,%eax
+  8034e2:	73 32                	jae    803516 <span_alloc+0x9f>
+		if (va >= (uintptr_t) mend
+  8034e4:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8034e9:	0f 87 51 01 00 00    	ja     803640 <span_alloc+0x1c9>
+		    || ((vpd[PDX(va)] & PTE_P) && (vpt[PGNUM(va)] & PTE_P)))
+  8034ef:	89 c2                	mov    %eax,%edx
+  8034f1:	c1 ea 16             	shr    $0x16,%edx
+  8034f4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8034fb:	f6 c2 01             	test   $0x1,%dl
+  8034fe:	74 db                	je     8034db <span_alloc+0x64>
+  803500:	89 c2                	mov    %eax,%edx
+  803502:	c1 ea 0c             	shr    $0xc,%edx
+  803505:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80350c:	f6 c2 01             	test   $0x1,%dl
+  80350f:	74 ca                	je     8034db <span_alloc+0x64>
+  803511:	e9 2a 01 00 00       	jmp    803640 <span_alloc+0x1c9>
+	pgbatch_init(&mbatch);
+  803516:	83 ec 0c             	sub    $0xc,%esp
+  803519:	68 e0 b3 80 00       	push   $0x80b3e0
+  80351e:	e8 a5 0d 00 00       	call   8042c8 <pgbatch_init>
+  803523:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < npages; i++)
+  803526:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = pgbatch_alloc(&mbatch, 0, mtop + i * PGSIZE,
+  80352b:	6a 07                	push   $0x7
+  80352d:	89 d8                	mov    %ebx,%eax
+  80352f:	c1 e0 0c             	shl    $0xc,%eax
+  803532:	03 05 a4 b8 80 00    	add    0x80b8a4,%eax
+  803538:	50                   	push   %eax
+  803539:	6a 00                	push   $0x0
+  80353b:	68 e0 b3 80 00       	push   $0x80b3e0
+  803540:	e8 0a 0e 00 00       	call   80434f <pgbatch_alloc>
+  803545:	83 c4 10             	add    $0x10,%esp
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	0f 88 9e 00 00 00    	js     8035ee <span_alloc+0x177>
+	for (i = 0; i < npages; i++)
+  803550:	83 c3 01             	add    $0x1,%ebx
+  803553:	39 df                	cmp    %ebx,%edi
+  803555:	7f d4                	jg     80352b <span_alloc+0xb4>
+	if (i < npages || (r = pgbatch_flush(&mbatch)) < 0) {
+  803557:	83 ec 0c             	sub    $0xc,%esp
+  80355a:	68 e0 b3 80 00       	push   $0x80b3e0
+  80355f:	e8 72 0d 00 00       	call   8042d6 <pgbatch_flush>
+  803564:	83 c4 10             	add    $0x10,%esp
+  803567:	85 c0                	test   %eax,%eax
+  803569:	0f 88 87 00 00 00    	js     8035f6 <span_alloc+0x17f>
+	mp = (struct mspan *) mtop;
+  80356f:	8b 1d a4 b8 80 00    	mov    0x80b8a4,%ebx
+	mp->mp_prevpages = mlast ? mlast->mp_npages : 0;
+  803575:	8b 15 a0 b8 80 00    	mov    0x80b8a0,%edx
+  80357b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803580:	85 d2                	test   %edx,%edx
+  803582:	74 04                	je     803588 <span_alloc+0x111>
+  803584:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+  803588:	66 89 43 06          	mov    %ax,0x6(%ebx)
+	mtop += npages * PGSIZE;
+  80358c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80358f:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+  803592:	a3 a4 b8 80 00       	mov    %eax,0x80b8a4
+	mstat.ms_arena += npages * PGSIZE;
+  803597:	01 0d 00 b7 80 00    	add    %ecx,0x80b700
+	span_set(mp, npages, MS_FREE);
+  80359d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035a2:	89 fa                	mov    %edi,%edx
+  8035a4:	89 d8                	mov    %ebx,%eax
+  8035a6:	e8 6d fb ff ff       	call   803118 <span_set>
+	mp = span_merge(mp);
+  8035ab:	89 d8                	mov    %ebx,%eax
+  8035ad:	e8 38 fc ff ff       	call   8031ea <span_merge>
+	list_push(bin_of(mp->mp_npages), mp);
+  8035b2:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+	return &mbins[MIN(npages, MBINS - 1)];
+  8035b6:	b9 1f 00 00 00       	mov    $0x1f,%ecx
+  8035bb:	39 ca                	cmp    %ecx,%edx
+  8035bd:	0f 4f d1             	cmovg  %ecx,%edx
+	mp->mp_prev = NULL;
+  8035c0:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+	mp->mp_next = *head;
+  8035c7:	8b 0c 95 20 b8 80 00 	mov    0x80b820(,%edx,4),%ecx
+  8035ce:	89 48 10             	mov    %ecx,0x10(%eax)
+	if (*head)
+  8035d1:	85 c9                	test   %ecx,%ecx
+  8035d3:	74 03                	je     8035d8 <span_alloc+0x161>
+		(*head)->mp_prev = mp;
+  8035d5:	89 41 14             	mov    %eax,0x14(%ecx)
+	*head = mp;
+  8035d8:	89 04 95 20 b8 80 00 	mov    %eax,0x80b820(,%edx,4)
+		for (b = MIN(npages, MBINS - 1); b < MBINS && !mp; b++)
+  8035df:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  8035e4:	39 d6                	cmp    %edx,%esi
+  8035e6:	0f 4e d6             	cmovle %esi,%edx
+  8035e9:	e9 cd fe ff ff       	jmp    8034bb <span_alloc+0x44>
+	if (i < npages || (r = pgbatch_flush(&mbatch)) < 0) {
+  8035ee:	39 fb                	cmp    %edi,%ebx
+  8035f0:	0f 8d 61 ff ff ff    	jge    803557 <span_alloc+0xe0>
+		pgbatch_init(&mbatch);
+  8035f6:	83 ec 0c             	sub    $0xc,%esp
+  8035f9:	68 e0 b3 80 00       	push   $0x80b3e0
+  8035fe:	e8 c5 0c 00 00       	call   8042c8 <pgbatch_init>
+  803603:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < npages; i++)
+  803606:	bb 00 00 00 00       	mov    $0x0,%ebx
+			pgbatch_unmap(&mbatch, 0, mtop + i * PGSIZE);
+  80360b:	83 ec 04             	sub    $0x4,%esp
+  80360e:	89 d8                	mov    %ebx,%eax
+  803610:	c1 e0 0c             	shl    $0xc,%eax
+  803613:	03 05 a4 b8 80 00    	add    0x80b8a4,%eax
+  803619:	50                   	push   %eax
+  80361a:	6a 00                	push   $0x0
+  80361c:	68 e0 b3 80 00       	push   $0x80b3e0
+  803621:	e8 a3 0d 00 00       	call   8043c9 <pgbatch_unmap>
+		for (i = 0; i < npages; i++)
+  803626:	83 c3 01             	add    $0x1,%ebx
+  803629:	83 c4 10             	add    $0x10,%esp
+  80362c:	39 df                	cmp    %ebx,%edi
+  80362e:	7f db                	jg     80360b <span_alloc+0x194>
+		pgbatch_flush(&mbatch);
+  803630:	83 ec 0c             	sub    $0xc,%esp
+  803633:	68 e0 b3 80 00       	push   $0x80b3e0
+  803638:	e8 99 0c 00 00       	call   8042d6 <pgbatch_flush>
+		return r < 0 ? r : -E_NO_MEM;
+  80363d:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  803640:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803645:	e9 b1 00 00 00       	jmp    8036fb <span_alloc+0x284>
+		rest = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+  80364a:	89 f7                	mov    %esi,%edi
+  80364c:	c1 e7 0c             	shl    $0xc,%edi
+  80364f:	01 df                	add    %ebx,%edi
+		rest->mp_prevpages = npages;
+  803651:	66 89 77 06          	mov    %si,0x6(%edi)
+		span_set(rest, mp->mp_npages - npages, MS_FREE);
+  803655:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  803659:	29 f2                	sub    %esi,%edx
+  80365b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803660:	89 f8                	mov    %edi,%eax
+  803662:	e8 b1 fa ff ff       	call   803118 <span_set>
+		list_push(bin_of(rest->mp_npages), rest);
+  803667:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  80366b:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  803670:	39 d0                	cmp    %edx,%eax
+  803672:	0f 4f c2             	cmovg  %edx,%eax
+	mp->mp_prev = NULL;
+  803675:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+	mp->mp_next = *head;
+  80367c:	8b 14 85 20 b8 80 00 	mov    0x80b820(,%eax,4),%edx
+  803683:	89 57 10             	mov    %edx,0x10(%edi)
+	if (*head)
+  803686:	85 d2                	test   %edx,%edx
+  803688:	74 03                	je     80368d <span_alloc+0x216>
+		(*head)->mp_prev = mp;
+  80368a:	89 7a 14             	mov    %edi,0x14(%edx)
+	*head = mp;
+  80368d:	89 3c 85 20 b8 80 00 	mov    %edi,0x80b820(,%eax,4)
+}
+  803694:	eb 59                	jmp    8036ef <span_alloc+0x278>
+		return NULL;
+  803696:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80369b:	eb 5e                	jmp    8036fb <span_alloc+0x284>
+	if (npages > 0xFFFF || !isfree(mtop, npages * PGSIZE))
+  80369d:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8036a3:	7f 9b                	jg     803640 <span_alloc+0x1c9>
+	uintptr_t va, end_va = (uintptr_t) v + n;
+  8036a5:	a1 a4 b8 80 00       	mov    0x80b8a4,%eax
+  8036aa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8036ad:	01 c1                	add    %eax,%ecx
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8036af:	39 c8                	cmp    %ecx,%eax
+  8036b1:	0f 83 5f fe ff ff    	jae    803516 <span_alloc+0x9f>
+		if (va >= (uintptr_t) mend
+  8036b7:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8036bc:	0f 86 2d fe ff ff    	jbe    8034ef <span_alloc+0x78>
+  8036c2:	e9 79 ff ff ff       	jmp    803640 <span_alloc+0x1c9>
+	bin = bin_of(mp->mp_npages);
+  8036c7:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  8036cb:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  8036d0:	39 d0                	cmp    %edx,%eax
+  8036d2:	0f 4f c2             	cmovg  %edx,%eax
+  8036d5:	8d 04 85 20 b8 80 00 	lea    0x80b820(,%eax,4),%eax
+	list_remove(bin, mp);
+  8036dc:	89 da                	mov    %ebx,%edx
+  8036de:	e8 13 fa ff ff       	call   8030f6 <list_remove>
+	if (mp->mp_npages > npages) {
+  8036e3:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  8036e7:	39 f0                	cmp    %esi,%eax
+  8036e9:	0f 8f 5b ff ff ff    	jg     80364a <span_alloc+0x1d3>
+	span_set(mp, npages, kind);
+  8036ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8036f2:	89 f2                	mov    %esi,%edx
+  8036f4:	89 d8                	mov    %ebx,%eax
+  8036f6:	e8 1d fa ff ff       	call   803118 <span_set>
+}
+  8036fb:	89 d8                	mov    %ebx,%eax
+  8036fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803700:	5b                   	pop    %ebx
+  803701:	5e                   	pop    %esi
+  803702:	5f                   	pop    %edi
+  803703:	5d                   	pop    %ebp
+  803704:	c3                   	ret
+
+00803705 <malloc_locked>:
+{
+  803705:	55                   	push   %ebp
+  803706:	89 e5                	mov    %esp,%ebp
+  803708:	57                   	push   %edi
+  803709:	56                   	push   %esi
+  80370a:	53                   	push   %ebx
+  80370b:	83 ec 1c             	sub    $0x1c,%esp
+  80370e:	89 c7                	mov    %eax,%edi
+	struct mcache *mc = mcache_cur;
+  803710:	8b 35 00 f0 80 00    	mov    0x80f000,%esi
+	if (mtop == 0)
+  803716:	83 3d a4 b8 80 00 00 	cmpl   $0x0,0x80b8a4
+  80371d:	74 63                	je     803782 <malloc_locked+0x7d>
+	mstat.ms_nmalloc++;
+  80371f:	83 05 18 b7 80 00 01 	addl   $0x1,0x80b718
+	if (n <= SMALL_MAX) {
+  803726:	81 ff f0 07 00 00    	cmp    $0x7f0,%edi
+  80372c:	0f 87 cb 01 00 00    	ja     8038fd <malloc_locked+0x1f8>
+		c = mclass_of[(n + 15) / 16];
+  803732:	8d 47 0f             	lea    0xf(%edi),%eax
+  803735:	c1 e8 04             	shr    $0x4,%eax
+  803738:	0f b6 80 40 b7 80 00 	movzbl 0x80b740(%eax),%eax
+  80373f:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  803742:	0f b6 f8             	movzbl %al,%edi
+		if (mc && (v = mc->mc_free[c])) {
+  803745:	85 f6                	test   %esi,%esi
+  803747:	0f 84 c7 00 00 00    	je     803814 <malloc_locked+0x10f>
+  80374d:	8b 1c be             	mov    (%esi,%edi,4),%ebx
+  803750:	85 db                	test   %ebx,%ebx
+  803752:	0f 84 bc 00 00 00    	je     803814 <malloc_locked+0x10f>
+			mc->mc_free[c] = *(void **) v;
+  803758:	8b 03                	mov    (%ebx),%eax
+  80375a:	89 04 be             	mov    %eax,(%esi,%edi,4)
+			mc->mc_n[c]--;
+  80375d:	80 6c 3e 58 01       	subb   $0x1,0x58(%esi,%edi,1)
+			mstat.ms_cachehits++;
+  803762:	83 05 1c b7 80 00 01 	addl   $0x1,0x80b71c
+			mstat.ms_cached -= mclass_size[c];
+  803769:	0f b7 84 3f e0 5a 80 	movzwl 0x805ae0(%edi,%edi,1),%eax
+  803770:	00 
+  803771:	29 05 14 b7 80 00    	sub    %eax,0x80b714
+			mstat.ms_inuse += mclass_size[c];
+  803777:	01 05 04 b7 80 00    	add    %eax,0x80b704
+			return v;
+  80377d:	e9 ad 01 00 00       	jmp    80392f <malloc_locked+0x22a>
+	mtop = mbegin;
+  803782:	c7 05 a4 b8 80 00 00 	movl   $0x8000000,0x80b8a4
+  803789:	00 00 08 
+  80378c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (c = 0, i = 0; i <= SMALL_MAX / 16; i++) {
+  803791:	b8 00 00 00 00       	mov    $0x0,%eax
+  803796:	ba 00 00 00 00       	mov    $0x0,%edx
+  80379b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80379e:	eb 23                	jmp    8037c3 <malloc_locked+0xbe>
+			c++;
+  8037a0:	83 c0 01             	add    $0x1,%eax
+		while (mclass_size[c] < i * 16)
+  8037a3:	0f b7 9c 00 e0 5a 80 	movzwl 0x805ae0(%eax,%eax,1),%ebx
+  8037aa:	00 
+  8037ab:	39 f3                	cmp    %esi,%ebx
+  8037ad:	7c f1                	jl     8037a0 <malloc_locked+0x9b>
+		mclass_of[i] = c;
+  8037af:	88 82 40 b7 80 00    	mov    %al,0x80b740(%edx)
+	for (c = 0, i = 0; i <= SMALL_MAX / 16; i++) {
+  8037b5:	83 c2 01             	add    $0x1,%edx
+  8037b8:	83 c1 10             	add    $0x10,%ecx
+  8037bb:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8037c1:	74 10                	je     8037d3 <malloc_locked+0xce>
+		while (mclass_size[c] < i * 16)
+  8037c3:	89 ce                	mov    %ecx,%esi
+  8037c5:	0f b7 9c 00 e0 5a 80 	movzwl 0x805ae0(%eax,%eax,1),%ebx
+  8037cc:	00 
+  8037cd:	39 cb                	cmp    %ecx,%ebx
+  8037cf:	7c cf                	jl     8037a0 <malloc_locked+0x9b>
+  8037d1:	eb dc                	jmp    8037af <malloc_locked+0xaa>
+	for (c = 0; c < NCLASS; c++)
+  8037d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		mcache_max[c] = MIN(MCACHE_MAX,
+  8037d8:	bb 00 08 00 00       	mov    $0x800,%ebx
+  8037dd:	0f b7 b4 09 e0 5a 80 	movzwl 0x805ae0(%ecx,%ecx,1),%esi
+  8037e4:	00 
+  8037e5:	89 d8                	mov    %ebx,%eax
+  8037e7:	99                   	cltd
+  8037e8:	f7 fe                	idiv   %esi
+  8037ea:	85 c0                	test   %eax,%eax
+  8037ec:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037f1:	0f 4e c2             	cmovle %edx,%eax
+  8037f4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8037f9:	39 d0                	cmp    %edx,%eax
+  8037fb:	0f 4f c2             	cmovg  %edx,%eax
+  8037fe:	88 81 20 b7 80 00    	mov    %al,0x80b720(%ecx)
+	for (c = 0; c < NCLASS; c++)
+  803804:	83 c1 01             	add    $0x1,%ecx
+  803807:	83 f9 16             	cmp    $0x16,%ecx
+  80380a:	75 d1                	jne    8037dd <malloc_locked+0xd8>
+  80380c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80380f:	e9 0b ff ff ff       	jmp    80371f <malloc_locked+0x1a>
+	int i, size = mclass_size[c];
+  803814:	0f b7 b4 3f e0 5a 80 	movzwl 0x805ae0(%edi,%edi,1),%esi
+  80381b:	00 
+	if (!(mp = mslabs[c])) {
+  80381c:	8b 0c bd c0 b7 80 00 	mov    0x80b7c0(,%edi,4),%ecx
+  803823:	85 c9                	test   %ecx,%ecx
+  803825:	74 2a                	je     803851 <malloc_locked+0x14c>
+	obj = mp->mp_free;
+  803827:	8b 59 0c             	mov    0xc(%ecx),%ebx
+	mp->mp_free = *(void **) obj;
+  80382a:	8b 03                	mov    (%ebx),%eax
+  80382c:	89 41 0c             	mov    %eax,0xc(%ecx)
+	if (--mp->mp_nfree == 0)
+  80382f:	0f b7 41 0a          	movzwl 0xa(%ecx),%eax
+  803833:	83 e8 01             	sub    $0x1,%eax
+  803836:	66 89 41 0a          	mov    %ax,0xa(%ecx)
+  80383a:	66 85 c0             	test   %ax,%ax
+  80383d:	0f 84 a3 00 00 00    	je     8038e6 <malloc_locked+0x1e1>
+	mstat.ms_inuse += size;
+  803843:	0f b7 f6             	movzwl %si,%esi
+  803846:	01 35 04 b7 80 00    	add    %esi,0x80b704
+	return obj;
+  80384c:	e9 de 00 00 00       	jmp    80392f <malloc_locked+0x22a>
+		if (!(mp = span_alloc(1, MS_SLAB)))
+  803851:	ba 02 00 00 00       	mov    $0x2,%edx
+  803856:	b8 01 00 00 00       	mov    $0x1,%eax
+  80385b:	e8 17 fc ff ff       	call   803477 <span_alloc>
+  803860:	89 c1                	mov    %eax,%ecx
+  803862:	85 c0                	test   %eax,%eax
+  803864:	0f 84 cf 00 00 00    	je     803939 <malloc_locked+0x234>
+		mp->mp_class = c;
+  80386a:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+  80386e:	88 41 09             	mov    %al,0x9(%ecx)
+		mp->mp_free = NULL;
+  803871:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+		mp->mp_nfree = 0;
+  803878:	66 c7 41 0a 00 00    	movw   $0x0,0xa(%ecx)
+		for (i = (PGSIZE - MHDR) / size - 1; i >= 0; i--) {
+  80387e:	0f b7 de             	movzwl %si,%ebx
+  803881:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+  803886:	ba 00 00 00 00       	mov    $0x0,%edx
+  80388b:	f7 f3                	div    %ebx
+  80388d:	83 e8 01             	sub    $0x1,%eax
+  803890:	89 c3                	mov    %eax,%ebx
+  803892:	78 27                	js     8038bb <malloc_locked+0x1b6>
+	int i, size = mclass_size[c];
+  803894:	0f b7 c6             	movzwl %si,%eax
+  803897:	0f af c3             	imul   %ebx,%eax
+  80389a:	8d 44 01 20          	lea    0x20(%ecx,%eax,1),%eax
+  80389e:	0f b7 d6             	movzwl %si,%edx
+  8038a1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			*(void **) obj = mp->mp_free;
+  8038a4:	8b 51 0c             	mov    0xc(%ecx),%edx
+  8038a7:	89 10                	mov    %edx,(%eax)
+			mp->mp_free = obj;
+  8038a9:	89 41 0c             	mov    %eax,0xc(%ecx)
+			mp->mp_nfree++;
+  8038ac:	66 83 41 0a 01       	addw   $0x1,0xa(%ecx)
+		for (i = (PGSIZE - MHDR) / size - 1; i >= 0; i--) {
+  8038b1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8038b4:	29 d0                	sub    %edx,%eax
+  8038b6:	83 eb 01             	sub    $0x1,%ebx
+  8038b9:	79 e9                	jns    8038a4 <malloc_locked+0x19f>
+	mp->mp_prev = NULL;
+  8038bb:	c7 41 14 00 00 00 00 	movl   $0x0,0x14(%ecx)
+	mp->mp_next = *head;
+  8038c2:	8b 04 bd c0 b7 80 00 	mov    0x80b7c0(,%edi,4),%eax
+  8038c9:	89 41 10             	mov    %eax,0x10(%ecx)
+	if (*head)
+  8038cc:	85 c0                	test   %eax,%eax
+  8038ce:	74 03                	je     8038d3 <malloc_locked+0x1ce>
+		(*head)->mp_prev = mp;
+  8038d0:	89 48 14             	mov    %ecx,0x14(%eax)
+	*head = mp;
+  8038d3:	89 0c bd c0 b7 80 00 	mov    %ecx,0x80b7c0(,%edi,4)
+		mstat.ms_slabs++;
+  8038da:	83 05 08 b7 80 00 01 	addl   $0x1,0x80b708
+  8038e1:	e9 41 ff ff ff       	jmp    803827 <malloc_locked+0x122>
+		list_remove(&mslabs[c], mp);
+  8038e6:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+  8038ea:	8d 04 85 c0 b7 80 00 	lea    0x80b7c0(,%eax,4),%eax
+  8038f1:	89 ca                	mov    %ecx,%edx
+  8038f3:	e8 fe f7 ff ff       	call   8030f6 <list_remove>
+  8038f8:	e9 46 ff ff ff       	jmp    803843 <malloc_locked+0x13e>
+		return 0;
+  8038fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (n > (size_t) (mend - mbegin))
+  803902:	81 ff 00 00 00 08    	cmp    $0x8000000,%edi
+  803908:	77 25                	ja     80392f <malloc_locked+0x22a>
+	if (!(mp = span_alloc(ROUNDUP(n + MHDR, PGSIZE) / PGSIZE, MS_LARGE)))
+  80390a:	8d 87 1f 10 00 00    	lea    0x101f(%edi),%eax
+  803910:	c1 e8 0c             	shr    $0xc,%eax
+  803913:	ba 01 00 00 00       	mov    $0x1,%edx
+  803918:	e8 5a fb ff ff       	call   803477 <span_alloc>
+  80391d:	89 c3                	mov    %eax,%ebx
+  80391f:	85 c0                	test   %eax,%eax
+  803921:	74 0c                	je     80392f <malloc_locked+0x22a>
+	mp->mp_size = n;
+  803923:	89 78 18             	mov    %edi,0x18(%eax)
+	mstat.ms_inuse += n;
+  803926:	01 3d 04 b7 80 00    	add    %edi,0x80b704
+	return (uint8_t *) mp + MHDR;
+  80392c:	83 c3 20             	add    $0x20,%ebx
+}
+  80392f:	89 d8                	mov    %ebx,%eax
+  803931:	83 c4 1c             	add    $0x1c,%esp
+  803934:	5b                   	pop    %ebx
+  803935:	5e                   	pop    %esi
+  803936:	5f                   	pop    %edi
+  803937:	5d                   	pop    %ebp
+  803938:	c3                   	ret
+			return NULL;
+  803939:	89 c3                	mov    %eax,%ebx
+  80393b:	eb f2                	jmp    80392f <malloc_locked+0x22a>
+
+0080393d <malloc>:
+
+void *
+malloc(size_t n)
+{
+  80393d:	55                   	push   %ebp
+  80393e:	89 e5                	mov    %esp,%ebp
+  803940:	53                   	push   %ebx
+  803941:	83 ec 04             	sub    $0x4,%esp
+	void *v;
+
+	mlock_acquire();
+  803944:	e8 02 f8 ff ff       	call   80314b <mlock_acquire>
+	v = malloc_locked(n);
+  803949:	8b 45 08             	mov    0x8(%ebp),%eax
+  80394c:	e8 b4 fd ff ff       	call   803705 <malloc_locked>
+  803951:	89 c3                	mov    %eax,%ebx
+	mlock_release();
+  803953:	e8 12 f8 ff ff       	call   80316a <mlock_release>
+	return v;
+}
+  803958:	89 d8                	mov    %ebx,%eax
+  80395a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80395d:	c9                   	leave
+  80395e:	c3                   	ret
+
+0080395f <free>:
+
+void
+free(void *v)
+{
+  80395f:	55                   	push   %ebp
+  803960:	89 e5                	mov    %esp,%ebp
+  803962:	83 ec 08             	sub    $0x8,%esp
+	mlock_acquire();
+  803965:	e8 e1 f7 ff ff       	call   80314b <mlock_acquire>
+	free_locked(v);
+  80396a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80396d:	e8 8f fa ff ff       	call   803401 <free_locked>
+	mlock_release();
+  803972:	e8 f3 f7 ff ff       	call   80316a <mlock_release>
+}
+  803977:	c9                   	leave
+  803978:	c3                   	ret
+
+00803979 <mcache_flush>:
+
+// Give the objects in 'mc' back to their slabs, as a thread that owns
+// it does before it goes away.
+void
+mcache_flush(struct mcache *mc)
+{
+  803979:	55                   	push   %ebp
+  80397a:	89 e5                	mov    %esp,%ebp
+  80397c:	57                   	push   %edi
+  80397d:	56                   	push   %esi
+  80397e:	53                   	push   %ebx
+  80397f:	83 ec 1c             	sub    $0x1c,%esp
+  803982:	8b 75 08             	mov    0x8(%ebp),%esi
+	void *v;
+	int c;
+
+	mlock_acquire();
+  803985:	e8 c1 f7 ff ff       	call   80314b <mlock_acquire>
+	for (c = 0; c < NCLASS; c++)
+  80398a:	89 f1                	mov    %esi,%ecx
+  80398c:	83 c6 58             	add    $0x58,%esi
+  80398f:	ba e0 5a 80 00       	mov    $0x805ae0,%edx
+  803994:	eb 4a                	jmp    8039e0 <mcache_flush+0x67>
+  803996:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803999:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		while ((v = mc->mc_free[c])) {
+			mc->mc_free[c] = *(void **) v;
+  80399c:	8b 03                	mov    (%ebx),%eax
+  80399e:	89 07                	mov    %eax,(%edi)
+			mc->mc_n[c]--;
+  8039a0:	80 2e 01             	subb   $0x1,(%esi)
+			mstat.ms_cached -= mclass_size[c];
+  8039a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039a6:	0f b7 00             	movzwl (%eax),%eax
+  8039a9:	29 05 14 b7 80 00    	sub    %eax,0x80b714
+			mstat.ms_inuse += mclass_size[c];
+  8039af:	01 05 04 b7 80 00    	add    %eax,0x80b704
+			slab_free(span_of(v), v);
+  8039b5:	89 d8                	mov    %ebx,%eax
+  8039b7:	e8 cd f7 ff ff       	call   803189 <span_of>
+  8039bc:	89 da                	mov    %ebx,%edx
+  8039be:	e8 98 f9 ff ff       	call   80335b <slab_free>
+		while ((v = mc->mc_free[c])) {
+  8039c3:	8b 1f                	mov    (%edi),%ebx
+  8039c5:	85 db                	test   %ebx,%ebx
+  8039c7:	75 d3                	jne    80399c <mcache_flush+0x23>
+  8039c9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8039cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+	for (c = 0; c < NCLASS; c++)
+  8039cf:	83 c1 04             	add    $0x4,%ecx
+  8039d2:	83 c6 01             	add    $0x1,%esi
+  8039d5:	83 c2 02             	add    $0x2,%edx
+  8039d8:	81 fa 0c 5b 80 00    	cmp    $0x805b0c,%edx
+  8039de:	74 0a                	je     8039ea <mcache_flush+0x71>
+		while ((v = mc->mc_free[c])) {
+  8039e0:	89 cf                	mov    %ecx,%edi
+  8039e2:	8b 19                	mov    (%ecx),%ebx
+  8039e4:	85 db                	test   %ebx,%ebx
+  8039e6:	75 ae                	jne    803996 <mcache_flush+0x1d>
+  8039e8:	eb e5                	jmp    8039cf <mcache_flush+0x56>
+		}
+	mlock_release();
+  8039ea:	e8 7b f7 ff ff       	call   80316a <mlock_release>
+}
+  8039ef:	83 c4 1c             	add    $0x1c,%esp
+  8039f2:	5b                   	pop    %ebx
+  8039f3:	5e                   	pop    %esi
+  8039f4:	5f                   	pop    %edi
+  8039f5:	5d                   	pop    %ebp
+  8039f6:	c3                   	ret
+
+008039f7 <calloc>:
+
+void *
+calloc(size_t nmemb, size_t size)
+{
+  8039f7:	55                   	push   %ebp
+  8039f8:	89 e5                	mov    %esp,%ebp
+  8039fa:	56                   	push   %esi
+  8039fb:	53                   	push   %ebx
+  8039fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8039ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	void *v;
+
+	if (size && nmemb > (size_t) -1 / size)
+  803a02:	85 c9                	test   %ecx,%ecx
+  803a04:	74 06                	je     803a0c <calloc+0x15>
+  803a06:	89 c8                	mov    %ecx,%eax
+  803a08:	f7 e3                	mul    %ebx
+  803a0a:	70 2d                	jo     803a39 <calloc+0x42>
+		return 0;
+	if ((v = malloc(nmemb * size)))
+  803a0c:	0f af d9             	imul   %ecx,%ebx
+  803a0f:	83 ec 0c             	sub    $0xc,%esp
+  803a12:	53                   	push   %ebx
+  803a13:	e8 25 ff ff ff       	call   80393d <malloc>
+  803a18:	89 c6                	mov    %eax,%esi
+  803a1a:	83 c4 10             	add    $0x10,%esp
+  803a1d:	85 c0                	test   %eax,%eax
+  803a1f:	74 0f                	je     803a30 <calloc+0x39>
+		memset(v, 0, nmemb * size);
+  803a21:	83 ec 04             	sub    $0x4,%esp
+  803a24:	53                   	push   %ebx
+  803a25:	6a 00                	push   $0x0
+  803a27:	50                   	push   %eax
+  803a28:	e8 71 d5 ff ff       	call   800f9e <memset>
+  803a2d:	83 c4 10             	add    $0x10,%esp
+	return v;
+}
+  803a30:	89 f0                	mov    %esi,%eax
+  803a32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a35:	5b                   	pop    %ebx
+  803a36:	5e                   	pop    %esi
+  803a37:	5d                   	pop    %ebp
+  803a38:	c3                   	ret
+		return 0;
+  803a39:	be 00 00 00 00       	mov    $0x0,%esi
+  803a3e:	eb f0                	jmp    803a30 <calloc+0x39>
+
+00803a40 <realloc>:
+	return nv;
+}
+
+void *
+realloc(void *v, size_t n)
+{
+  803a40:	55                   	push   %ebp
+  803a41:	89 e5                	mov    %esp,%ebp
+  803a43:	57                   	push   %edi
+  803a44:	56                   	push   %esi
+  803a45:	53                   	push   %ebx
+  803a46:	83 ec 1c             	sub    $0x1c,%esp
+  803a49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	mlock_acquire();
+  803a4c:	e8 fa f6 ff ff       	call   80314b <mlock_acquire>
+	if (v == 0)
+  803a51:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a55:	74 71                	je     803ac8 <realloc+0x88>
+	if (n == 0) {
+  803a57:	85 db                	test   %ebx,%ebx
+  803a59:	74 7b                	je     803ad6 <realloc+0x96>
+	mp = span_of(v);
+  803a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a5e:	e8 26 f7 ff ff       	call   803189 <span_of>
+  803a63:	89 c6                	mov    %eax,%esi
+	if (mp->mp_kind == MS_SLAB) {
+  803a65:	80 78 08 02          	cmpb   $0x2,0x8(%eax)
+  803a69:	74 7d                	je     803ae8 <realloc+0xa8>
+		npages = ROUNDUP(n + MHDR, PGSIZE) / PGSIZE;
+  803a6b:	8d 83 1f 10 00 00    	lea    0x101f(%ebx),%eax
+  803a71:	89 c1                	mov    %eax,%ecx
+  803a73:	c1 e9 0c             	shr    $0xc,%ecx
+  803a76:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  803a79:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  803a7d:	89 c7                	mov    %eax,%edi
+  803a7f:	c1 e7 0c             	shl    $0xc,%edi
+  803a82:	01 f7                	add    %esi,%edi
+	return next < mtop ? (struct mspan *) next : NULL;
+  803a84:	3b 3d a4 b8 80 00    	cmp    0x80b8a4,%edi
+  803a8a:	0f 83 13 01 00 00    	jae    803ba3 <realloc+0x163>
+		if (n > SMALL_MAX && npages > mp->mp_npages && next
+  803a90:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  803a96:	0f 86 1c 01 00 00    	jbe    803bb8 <realloc+0x178>
+  803a9c:	39 c1                	cmp    %eax,%ecx
+  803a9e:	7f 7d                	jg     803b1d <realloc+0xdd>
+		if (n > SMALL_MAX && npages <= mp->mp_npages) {
+  803aa0:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+			if (npages < mp->mp_npages) {
+  803aa4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803aa7:	0f 8c b8 00 00 00    	jl     803b65 <realloc+0x125>
+			mstat.ms_inuse += n - mp->mp_size;
+  803aad:	89 d8                	mov    %ebx,%eax
+  803aaf:	03 05 04 b7 80 00    	add    0x80b704,%eax
+  803ab5:	2b 46 18             	sub    0x18(%esi),%eax
+  803ab8:	a3 04 b7 80 00       	mov    %eax,0x80b704
+			mp->mp_size = n;
+  803abd:	89 5e 18             	mov    %ebx,0x18(%esi)
+			return v;
+  803ac0:	8b 75 08             	mov    0x8(%ebp),%esi
+  803ac3:	e9 1d 01 00 00       	jmp    803be5 <realloc+0x1a5>
+		return malloc_locked(n);
+  803ac8:	89 d8                	mov    %ebx,%eax
+  803aca:	e8 36 fc ff ff       	call   803705 <malloc_locked>
+  803acf:	89 c6                	mov    %eax,%esi
+  803ad1:	e9 0f 01 00 00       	jmp    803be5 <realloc+0x1a5>
+		free_locked(v);
+  803ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ad9:	e8 23 f9 ff ff       	call   803401 <free_locked>
+		return 0;
+  803ade:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae3:	e9 fd 00 00 00       	jmp    803be5 <realloc+0x1a5>
+		have = mclass_size[mp->mp_class];
+  803ae8:	0f b6 40 09          	movzbl 0x9(%eax),%eax
+  803aec:	0f b6 d0             	movzbl %al,%edx
+  803aef:	0f b7 bc 12 e0 5a 80 	movzwl 0x805ae0(%edx,%edx,1),%edi
+  803af6:	00 
+		if (n <= SMALL_MAX && mclass_of[(n + 15) / 16] == mp->mp_class)
+  803af7:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  803afd:	0f 87 b8 00 00 00    	ja     803bbb <realloc+0x17b>
+  803b03:	8d 53 0f             	lea    0xf(%ebx),%edx
+  803b06:	c1 ea 04             	shr    $0x4,%edx
+			return v;
+  803b09:	8b 75 08             	mov    0x8(%ebp),%esi
+		if (n <= SMALL_MAX && mclass_of[(n + 15) / 16] == mp->mp_class)
+  803b0c:	3a 82 40 b7 80 00    	cmp    0x80b740(%edx),%al
+  803b12:	0f 85 a3 00 00 00    	jne    803bbb <realloc+0x17b>
+  803b18:	e9 c8 00 00 00       	jmp    803be5 <realloc+0x1a5>
+		    && next->mp_kind == MS_FREE
+  803b1d:	80 7f 08 00          	cmpb   $0x0,0x8(%edi)
+  803b21:	0f 85 91 00 00 00    	jne    803bb8 <realloc+0x178>
+		    && mp->mp_npages + next->mp_npages >= npages) {
+  803b27:	0f b7 57 04          	movzwl 0x4(%edi),%edx
+  803b2b:	01 d0                	add    %edx,%eax
+  803b2d:	39 c1                	cmp    %eax,%ecx
+  803b2f:	0f 8f 83 00 00 00    	jg     803bb8 <realloc+0x178>
+	return &mbins[MIN(npages, MBINS - 1)];
+  803b35:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  803b3a:	39 c2                	cmp    %eax,%edx
+  803b3c:	0f 4f d0             	cmovg  %eax,%edx
+  803b3f:	8d 04 95 20 b8 80 00 	lea    0x80b820(,%edx,4),%eax
+			list_remove(bin_of(next->mp_npages), next);
+  803b46:	89 fa                	mov    %edi,%edx
+  803b48:	e8 a9 f5 ff ff       	call   8030f6 <list_remove>
+			span_set(mp, mp->mp_npages + next->mp_npages, MS_LARGE);
+  803b4d:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  803b51:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+  803b55:	01 c2                	add    %eax,%edx
+  803b57:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b5c:	89 f0                	mov    %esi,%eax
+  803b5e:	e8 b5 f5 ff ff       	call   803118 <span_set>
+  803b63:	eb 46                	jmp    803bab <realloc+0x16b>
+				next = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+  803b65:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803b68:	89 d0                	mov    %edx,%eax
+  803b6a:	c1 e0 0c             	shl    $0xc,%eax
+  803b6d:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+				next->mp_prevpages = npages;
+  803b70:	89 d0                	mov    %edx,%eax
+  803b72:	66 89 57 06          	mov    %dx,0x6(%edi)
+				span_set(next, mp->mp_npages - npages, MS_FREE);
+  803b76:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  803b7a:	29 c2                	sub    %eax,%edx
+  803b7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b81:	89 f8                	mov    %edi,%eax
+  803b83:	e8 90 f5 ff ff       	call   803118 <span_set>
+				span_set(mp, npages, MS_LARGE);
+  803b88:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b8d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803b90:	89 f0                	mov    %esi,%eax
+  803b92:	e8 81 f5 ff ff       	call   803118 <span_set>
+				span_free(next);
+  803b97:	89 f8                	mov    %edi,%eax
+  803b99:	e8 f7 f6 ff ff       	call   803295 <span_free>
+  803b9e:	e9 0a ff ff ff       	jmp    803aad <realloc+0x6d>
+		if (n > SMALL_MAX && npages > mp->mp_npages && next
+  803ba3:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  803ba9:	76 0d                	jbe    803bb8 <realloc+0x178>
+		if (n > SMALL_MAX && npages <= mp->mp_npages) {
+  803bab:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  803baf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803bb2:	0f 8e ec fe ff ff    	jle    803aa4 <realloc+0x64>
+		have = mp->mp_size;
+  803bb8:	8b 7e 18             	mov    0x18(%esi),%edi
+	if (!(nv = malloc_locked(n)))
+  803bbb:	89 d8                	mov    %ebx,%eax
+  803bbd:	e8 43 fb ff ff       	call   803705 <malloc_locked>
+  803bc2:	89 c6                	mov    %eax,%esi
+  803bc4:	85 c0                	test   %eax,%eax
+  803bc6:	74 1d                	je     803be5 <realloc+0x1a5>
+	memmove(nv, v, MIN(have, n));
+  803bc8:	83 ec 04             	sub    $0x4,%esp
+  803bcb:	39 fb                	cmp    %edi,%ebx
+  803bcd:	0f 46 fb             	cmovbe %ebx,%edi
+  803bd0:	57                   	push   %edi
+  803bd1:	ff 75 08             	push   0x8(%ebp)
+  803bd4:	50                   	push   %eax
+  803bd5:	e8 f9 d3 ff ff       	call   800fd3 <memmove>
+	free_locked(v);
+  803bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bdd:	e8 1f f8 ff ff       	call   803401 <free_locked>
+	return nv;
+  803be2:	83 c4 10             	add    $0x10,%esp
+	v = realloc_locked(v, n);
+	mlock_release();
+  803be5:	e8 80 f5 ff ff       	call   80316a <mlock_release>
+	return v;
+}
+  803bea:	89 f0                	mov    %esi,%eax
+  803bec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bef:	5b                   	pop    %ebx
+  803bf0:	5e                   	pop    %esi
+  803bf1:	5f                   	pop    %edi
+  803bf2:	5d                   	pop    %ebp
+  803bf3:	c3                   	ret
+
+00803bf4 <malloc_stats>:
+
+// Fill in 'st' with how the heap is used.
+void
+malloc_stats(struct mstats *st)
+{
+  803bf4:	55                   	push   %ebp
+  803bf5:	89 e5                	mov    %esp,%ebp
+  803bf7:	56                   	push   %esi
+  803bf8:	53                   	push   %ebx
+  803bf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct mspan *mp;
+	int c;
+
+	mlock_acquire();
+  803bfc:	e8 4a f5 ff ff       	call   80314b <mlock_acquire>
+	*st = mstat;
+  803c01:	a1 00 b7 80 00       	mov    0x80b700,%eax
+  803c06:	89 03                	mov    %eax,(%ebx)
+  803c08:	a1 04 b7 80 00       	mov    0x80b704,%eax
+  803c0d:	89 43 04             	mov    %eax,0x4(%ebx)
+  803c10:	a1 08 b7 80 00       	mov    0x80b708,%eax
+  803c15:	89 43 08             	mov    %eax,0x8(%ebx)
+  803c18:	a1 14 b7 80 00       	mov    0x80b714,%eax
+  803c1d:	89 43 14             	mov    %eax,0x14(%ebx)
+  803c20:	a1 18 b7 80 00       	mov    0x80b718,%eax
+  803c25:	89 43 18             	mov    %eax,0x18(%ebx)
+  803c28:	a1 1c b7 80 00       	mov    0x80b71c,%eax
+  803c2d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+	st->ms_slabfree = st->ms_spanfree = 0;
+  803c30:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  803c37:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+	for (c = 0; c < NCLASS; c++)
+  803c3e:	be 00 00 00 00       	mov    $0x0,%esi
+  803c43:	eb 08                	jmp    803c4d <malloc_stats+0x59>
+  803c45:	83 c6 01             	add    $0x1,%esi
+  803c48:	83 fe 16             	cmp    $0x16,%esi
+  803c4b:	74 26                	je     803c73 <malloc_stats+0x7f>
+		for (mp = mslabs[c]; mp; mp = mp->mp_next)
+  803c4d:	8b 04 b5 c0 b7 80 00 	mov    0x80b7c0(,%esi,4),%eax
+  803c54:	85 c0                	test   %eax,%eax
+  803c56:	74 ed                	je     803c45 <malloc_stats+0x51>
+			st->ms_slabfree += mp->mp_nfree * mclass_size[c];
+  803c58:	0f b7 8c 36 e0 5a 80 	movzwl 0x805ae0(%esi,%esi,1),%ecx
+  803c5f:	00 
+  803c60:	0f b7 50 0a          	movzwl 0xa(%eax),%edx
+  803c64:	0f af d1             	imul   %ecx,%edx
+  803c67:	01 53 0c             	add    %edx,0xc(%ebx)
+		for (mp = mslabs[c]; mp; mp = mp->mp_next)
+  803c6a:	8b 40 10             	mov    0x10(%eax),%eax
+  803c6d:	85 c0                	test   %eax,%eax
+  803c6f:	75 ef                	jne    803c60 <malloc_stats+0x6c>
+  803c71:	eb d2                	jmp    803c45 <malloc_stats+0x51>
+	for (c = 0; c < MBINS; c++)
+  803c73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c78:	eb 08                	jmp    803c82 <malloc_stats+0x8e>
+  803c7a:	83 c1 01             	add    $0x1,%ecx
+  803c7d:	83 f9 20             	cmp    $0x20,%ecx
+  803c80:	74 1e                	je     803ca0 <malloc_stats+0xac>
+		for (mp = mbins[c]; mp; mp = mp->mp_next)
+  803c82:	8b 04 8d 20 b8 80 00 	mov    0x80b820(,%ecx,4),%eax
+  803c89:	85 c0                	test   %eax,%eax
+  803c8b:	74 ed                	je     803c7a <malloc_stats+0x86>
+			st->ms_spanfree += mp->mp_npages * PGSIZE;
+  803c8d:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803c91:	c1 e2 0c             	shl    $0xc,%edx
+  803c94:	01 53 10             	add    %edx,0x10(%ebx)
+		for (mp = mbins[c]; mp; mp = mp->mp_next)
+  803c97:	8b 40 10             	mov    0x10(%eax),%eax
+  803c9a:	85 c0                	test   %eax,%eax
+  803c9c:	75 ef                	jne    803c8d <malloc_stats+0x99>
+  803c9e:	eb da                	jmp    803c7a <malloc_stats+0x86>
+	mlock_release();
+  803ca0:	e8 c5 f4 ff ff       	call   80316a <mlock_release>
+}
+  803ca5:	5b                   	pop    %ebx
+  803ca6:	5e                   	pop    %esi
+  803ca7:	5d                   	pop    %ebp
+  803ca8:	c3                   	ret
+
+00803ca9 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803ca9:	55                   	push   %ebp
+  803caa:	89 e5                	mov    %esp,%ebp
+  803cac:	57                   	push   %edi
+  803cad:	56                   	push   %esi
+  803cae:	53                   	push   %ebx
+  803caf:	83 ec 1c             	sub    $0x1c,%esp
+  803cb2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803cb5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803cb8:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803cbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cc2:	89 e0                	mov    %esp,%eax
+  803cc4:	89 f2                	mov    %esi,%edx
+  803cc6:	29 c2                	sub    %eax,%edx
+  803cc8:	89 d0                	mov    %edx,%eax
+  803cca:	c1 e8 0f             	shr    $0xf,%eax
+  803ccd:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803cd3:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803cd6:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  803cdd:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803ce0:	83 ec 0c             	sub    $0xc,%esp
+  803ce3:	ff 75 e0             	push   -0x20(%ebp)
+  803ce6:	e8 91 15 00 00       	call   80527c <pageref>
+  803ceb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803cee:	83 c4 04             	add    $0x4,%esp
+  803cf1:	ff 75 dc             	push   -0x24(%ebp)
+  803cf4:	e8 83 15 00 00       	call   80527c <pageref>
+  803cf9:	89 e2                	mov    %esp,%edx
+  803cfb:	89 f1                	mov    %esi,%ecx
+  803cfd:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803cff:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803d02:	89 ca                	mov    %ecx,%edx
+  803d04:	c1 ea 0f             	shr    $0xf,%edx
+  803d07:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803d0d:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803d10:	8b 14 95 a0 bf 80 00 	mov    0x80bfa0(,%edx,4),%edx
+  803d17:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803d1a:	39 d7                	cmp    %edx,%edi
+  803d1c:	74 40                	je     803d5e <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803d1e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803d21:	75 9f                	jne    803cc2 <_pipeisclosed+0x19>
+  803d23:	89 e2                	mov    %esp,%edx
+  803d25:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803d2a:	29 d0                	sub    %edx,%eax
+  803d2c:	89 c2                	mov    %eax,%edx
+  803d2e:	c1 ea 0f             	shr    $0xf,%edx
+  803d31:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3b:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803d3e:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  803d45:	8b 40 58             	mov    0x58(%eax),%eax
+  803d48:	6a 01                	push   $0x1
+  803d4a:	50                   	push   %eax
+  803d4b:	57                   	push   %edi
+  803d4c:	68 0c 5b 80 00       	push   $0x805b0c
+  803d51:	e8 d6 c9 ff ff       	call   80072c <cprintf>
+  803d56:	83 c4 10             	add    $0x10,%esp
+  803d59:	e9 5f ff ff ff       	jmp    803cbd <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803d5e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803d61:	0f 94 c0             	sete   %al
+  803d64:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d6a:	5b                   	pop    %ebx
+  803d6b:	5e                   	pop    %esi
+  803d6c:	5f                   	pop    %edi
+  803d6d:	5d                   	pop    %ebp
+  803d6e:	c3                   	ret
+
+00803d6f <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803d6f:	55                   	push   %ebp
+  803d70:	89 e5                	mov    %esp,%ebp
+  803d72:	53                   	push   %ebx
+  803d73:	83 ec 0c             	sub    $0xc,%esp
+  803d76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803d79:	53                   	push   %ebx
+  803d7a:	6a 00                	push   $0x0
+  803d7c:	e8 5b d5 ff ff       	call   8012dc <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803d81:	89 1c 24             	mov    %ebx,(%esp)
+  803d84:	e8 41 d9 ff ff       	call   8016ca <fd2data>
+  803d89:	83 c4 08             	add    $0x8,%esp
+  803d8c:	50                   	push   %eax
+  803d8d:	6a 00                	push   $0x0
+  803d8f:	e8 48 d5 ff ff       	call   8012dc <sys_page_unmap>
+}
+  803d94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d97:	c9                   	leave
+  803d98:	c3                   	ret
+
+00803d99 <devpipe_read>:
+{
+  803d99:	55                   	push   %ebp
+  803d9a:	89 e5                	mov    %esp,%ebp
+  803d9c:	57                   	push   %edi
+  803d9d:	56                   	push   %esi
+  803d9e:	53                   	push   %ebx
+  803d9f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803da2:	ff 75 08             	push   0x8(%ebp)
+  803da5:	e8 20 d9 ff ff       	call   8016ca <fd2data>
+  803daa:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803dac:	8b 70 04             	mov    0x4(%eax),%esi
+  803daf:	8b 00                	mov    (%eax),%eax
+  803db1:	83 c4 10             	add    $0x10,%esp
+  803db4:	39 f0                	cmp    %esi,%eax
+  803db6:	75 36                	jne    803dee <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803db8:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803dbb:	89 da                	mov    %ebx,%edx
+  803dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dc0:	e8 e4 fe ff ff       	call   803ca9 <_pipeisclosed>
+  803dc5:	85 c0                	test   %eax,%eax
+  803dc7:	0f 85 d4 00 00 00    	jne    803ea1 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803dcd:	b8 01 00 00 00       	mov    $0x1,%eax
+  803dd2:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803dd6:	83 ec 04             	sub    $0x4,%esp
+  803dd9:	6a ff                	push   $0xffffffff
+  803ddb:	56                   	push   %esi
+  803ddc:	57                   	push   %edi
+  803ddd:	e8 73 d8 ff ff       	call   801655 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803de2:	8b 73 04             	mov    0x4(%ebx),%esi
+  803de5:	8b 03                	mov    (%ebx),%eax
+  803de7:	83 c4 10             	add    $0x10,%esp
+  803dea:	39 c6                	cmp    %eax,%esi
+  803dec:	74 cd                	je     803dbb <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803dee:	8b 73 04             	mov    0x4(%ebx),%esi
+  803df1:	8b 03                	mov    (%ebx),%eax
+  803df3:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803df9:	29 c6                	sub    %eax,%esi
+  803dfb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803e00:	f7 e6                	mul    %esi
+  803e02:	c1 ea 0c             	shr    $0xc,%edx
+  803e05:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803e0b:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803e0d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803e10:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803e14:	8b 0b                	mov    (%ebx),%ecx
+  803e16:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803e1b:	f7 e1                	mul    %ecx
+  803e1d:	c1 ea 0b             	shr    $0xb,%edx
+  803e20:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803e26:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803e28:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803e2d:	29 cf                	sub    %ecx,%edi
+  803e2f:	39 f7                	cmp    %esi,%edi
+  803e31:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803e34:	83 ec 04             	sub    $0x4,%esp
+  803e37:	57                   	push   %edi
+  803e38:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803e3c:	50                   	push   %eax
+  803e3d:	ff 75 0c             	push   0xc(%ebp)
+  803e40:	e8 8e d1 ff ff       	call   800fd3 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803e45:	83 c4 0c             	add    $0xc,%esp
+  803e48:	89 f0                	mov    %esi,%eax
+  803e4a:	29 f8                	sub    %edi,%eax
+  803e4c:	50                   	push   %eax
+  803e4d:	8d 43 10             	lea    0x10(%ebx),%eax
+  803e50:	50                   	push   %eax
+  803e51:	89 f8                	mov    %edi,%eax
+  803e53:	03 45 0c             	add    0xc(%ebp),%eax
+  803e56:	50                   	push   %eax
+  803e57:	e8 77 d1 ff ff       	call   800fd3 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803e5c:	8b 0b                	mov    (%ebx),%ecx
+  803e5e:	01 f1                	add    %esi,%ecx
+  803e60:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803e65:	f7 e1                	mul    %ecx
+  803e67:	c1 ea 0c             	shr    $0xc,%edx
+  803e6a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803e70:	29 c1                	sub    %eax,%ecx
+  803e72:	89 0b                	mov    %ecx,(%ebx)
+  803e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e79:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803e7d:	83 c4 10             	add    $0x10,%esp
+  803e80:	85 c0                	test   %eax,%eax
+  803e82:	75 0a                	jne    803e8e <devpipe_read+0xf5>
+	return n;
+  803e84:	89 f0                	mov    %esi,%eax
+}
+  803e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e89:	5b                   	pop    %ebx
+  803e8a:	5e                   	pop    %esi
+  803e8b:	5f                   	pop    %edi
+  803e8c:	5d                   	pop    %ebp
+  803e8d:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803e8e:	83 ec 08             	sub    $0x8,%esp
+  803e91:	68 00 04 00 00       	push   $0x400
+  803e96:	53                   	push   %ebx
+  803e97:	e8 db d7 ff ff       	call   801677 <sys_futex_wake>
+  803e9c:	83 c4 10             	add    $0x10,%esp
+  803e9f:	eb e3                	jmp    803e84 <devpipe_read+0xeb>
+			return 0;
+  803ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea6:	eb de                	jmp    803e86 <devpipe_read+0xed>
+
+00803ea8 <devpipe_write>:
+{
+  803ea8:	55                   	push   %ebp
+  803ea9:	89 e5                	mov    %esp,%ebp
+  803eab:	57                   	push   %edi
+  803eac:	56                   	push   %esi
+  803ead:	53                   	push   %ebx
+  803eae:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803eb1:	ff 75 08             	push   0x8(%ebp)
+  803eb4:	e8 11 d8 ff ff       	call   8016ca <fd2data>
+  803eb9:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803ebb:	83 c4 10             	add    $0x10,%esp
+  803ebe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ec5:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803eca:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803ece:	0f 84 43 01 00 00    	je     804017 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ed4:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803ed7:	8b 06                	mov    (%esi),%eax
+  803ed9:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803edf:	29 c1                	sub    %eax,%ecx
+  803ee1:	89 c8                	mov    %ecx,%eax
+  803ee3:	f7 e7                	mul    %edi
+  803ee5:	c1 ea 0c             	shr    $0xc,%edx
+  803ee8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803eee:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803ef0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803ef6:	75 52                	jne    803f4a <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803ef8:	89 f2                	mov    %esi,%edx
+  803efa:	8b 45 08             	mov    0x8(%ebp),%eax
+  803efd:	e8 a7 fd ff ff       	call   803ca9 <_pipeisclosed>
+  803f02:	85 c0                	test   %eax,%eax
+  803f04:	0f 85 28 01 00 00    	jne    804032 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803f0a:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803f0c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803f0f:	8b 06                	mov    (%esi),%eax
+  803f11:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803f17:	29 c1                	sub    %eax,%ecx
+  803f19:	89 c8                	mov    %ecx,%eax
+  803f1b:	f7 e7                	mul    %edi
+  803f1d:	c1 ea 0c             	shr    $0xc,%edx
+  803f20:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803f26:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803f28:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803f2e:	75 a4                	jne    803ed4 <devpipe_write+0x2c>
+  803f30:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f35:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803f39:	83 ec 04             	sub    $0x4,%esp
+  803f3c:	6a ff                	push   $0xffffffff
+  803f3e:	53                   	push   %ebx
+  803f3f:	56                   	push   %esi
+  803f40:	e8 10 d7 ff ff       	call   801655 <sys_futex_wait>
+}
+  803f45:	83 c4 10             	add    $0x10,%esp
+  803f48:	eb 8a                	jmp    803ed4 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803f4a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803f4d:	8b 06                	mov    (%esi),%eax
+  803f4f:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803f55:	29 c1                	sub    %eax,%ecx
+  803f57:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803f5c:	f7 e1                	mul    %ecx
+  803f5e:	c1 ea 0c             	shr    $0xc,%edx
+  803f61:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803f67:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803f69:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803f6e:	89 d8                	mov    %ebx,%eax
+  803f70:	29 c8                	sub    %ecx,%eax
+  803f72:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f75:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803f78:	29 ca                	sub    %ecx,%edx
+  803f7a:	39 d0                	cmp    %edx,%eax
+  803f7c:	0f 46 d0             	cmovbe %eax,%edx
+  803f7f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803f82:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803f85:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803f8a:	f7 e1                	mul    %ecx
+  803f8c:	c1 ea 0b             	shr    $0xb,%edx
+  803f8f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803f95:	89 ca                	mov    %ecx,%edx
+  803f97:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803f99:	29 d3                	sub    %edx,%ebx
+  803f9b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803f9e:	39 c3                	cmp    %eax,%ebx
+  803fa0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803fa3:	83 ec 04             	sub    $0x4,%esp
+  803fa6:	53                   	push   %ebx
+  803fa7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803faa:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803fad:	51                   	push   %ecx
+  803fae:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803fb2:	50                   	push   %eax
+  803fb3:	e8 1b d0 ff ff       	call   800fd3 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803fb8:	83 c4 0c             	add    $0xc,%esp
+  803fbb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803fbe:	29 d8                	sub    %ebx,%eax
+  803fc0:	50                   	push   %eax
+  803fc1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803fc4:	01 cb                	add    %ecx,%ebx
+  803fc6:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803fc9:	53                   	push   %ebx
+  803fca:	8d 46 10             	lea    0x10(%esi),%eax
+  803fcd:	50                   	push   %eax
+  803fce:	e8 00 d0 ff ff       	call   800fd3 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803fd3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803fd6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803fd9:	01 c1                	add    %eax,%ecx
+  803fdb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803fe0:	f7 e1                	mul    %ecx
+  803fe2:	c1 ea 0c             	shr    $0xc,%edx
+  803fe5:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803feb:	89 ca                	mov    %ecx,%edx
+  803fed:	29 c2                	sub    %eax,%edx
+  803fef:	89 56 04             	mov    %edx,0x4(%esi)
+  803ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff7:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803ffb:	83 c4 10             	add    $0x10,%esp
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	75 1a                	jne    80401c <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  804002:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804005:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  804008:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80400b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80400e:	0f 82 c0 fe ff ff    	jb     803ed4 <devpipe_write+0x2c>
+  804014:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  804017:	8b 45 10             	mov    0x10(%ebp),%eax
+  80401a:	eb 1b                	jmp    804037 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  80401c:	83 ec 08             	sub    $0x8,%esp
+  80401f:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  804024:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  804027:	50                   	push   %eax
+  804028:	e8 4a d6 ff ff       	call   801677 <sys_futex_wake>
+  80402d:	83 c4 10             	add    $0x10,%esp
+  804030:	eb d0                	jmp    804002 <devpipe_write+0x15a>
+				return 0;
+  804032:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804037:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80403a:	5b                   	pop    %ebx
+  80403b:	5e                   	pop    %esi
+  80403c:	5f                   	pop    %edi
+  80403d:	5d                   	pop    %ebp
+  80403e:	c3                   	ret
+
+0080403f <devpipe_stat>:
+{
+  80403f:	55                   	push   %ebp
+  804040:	89 e5                	mov    %esp,%ebp
+  804042:	56                   	push   %esi
+  804043:	53                   	push   %ebx
+  804044:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804047:	83 ec 0c             	sub    $0xc,%esp
+  80404a:	ff 75 08             	push   0x8(%ebp)
+  80404d:	e8 78 d6 ff ff       	call   8016ca <fd2data>
+  804052:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  804054:	83 c4 08             	add    $0x8,%esp
+  804057:	68 1f 5b 80 00       	push   $0x805b1f
+  80405c:	53                   	push   %ebx
+  80405d:	e8 c1 cd ff ff       	call   800e23 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804062:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804065:	8b 06                	mov    (%esi),%eax
+  804067:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80406d:	29 c1                	sub    %eax,%ecx
+  80406f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804074:	89 c8                	mov    %ecx,%eax
+  804076:	f7 e2                	mul    %edx
+  804078:	c1 ea 0c             	shr    $0xc,%edx
+  80407b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804081:	29 d1                	sub    %edx,%ecx
+  804083:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  804089:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804090:	00 00 00 
+	stat->st_dev = &devpipe;
+  804093:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  80409a:	60 80 00 
+}
+  80409d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040a5:	5b                   	pop    %ebx
+  8040a6:	5e                   	pop    %esi
+  8040a7:	5d                   	pop    %ebp
+  8040a8:	c3                   	ret
+
+008040a9 <devpipe_poll>:
+{
+  8040a9:	55                   	push   %ebp
+  8040aa:	89 e5                	mov    %esp,%ebp
+  8040ac:	57                   	push   %edi
+  8040ad:	56                   	push   %esi
+  8040ae:	53                   	push   %ebx
+  8040af:	83 ec 18             	sub    $0x18,%esp
+  8040b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8040b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8040b8:	57                   	push   %edi
+  8040b9:	e8 0c d6 ff ff       	call   8016ca <fd2data>
+  8040be:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8040c0:	83 c4 10             	add    $0x10,%esp
+  8040c3:	89 f3                	mov    %esi,%ebx
+  8040c5:	83 e3 01             	and    $0x1,%ebx
+  8040c8:	75 27                	jne    8040f1 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8040ca:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8040d0:	75 48                	jne    80411a <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8040d2:	89 ca                	mov    %ecx,%edx
+  8040d4:	89 f8                	mov    %edi,%eax
+  8040d6:	e8 ce fb ff ff       	call   803ca9 <_pipeisclosed>
+  8040db:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8040dd:	89 d8                	mov    %ebx,%eax
+  8040df:	83 c8 10             	or     $0x10,%eax
+  8040e2:	85 d2                	test   %edx,%edx
+  8040e4:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8040e7:	89 d8                	mov    %ebx,%eax
+  8040e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040ec:	5b                   	pop    %ebx
+  8040ed:	5e                   	pop    %esi
+  8040ee:	5f                   	pop    %edi
+  8040ef:	5d                   	pop    %ebp
+  8040f0:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8040f1:	8b 58 04             	mov    0x4(%eax),%ebx
+  8040f4:	8b 00                	mov    (%eax),%eax
+  8040f6:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8040fc:	29 c3                	sub    %eax,%ebx
+  8040fe:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804103:	89 d8                	mov    %ebx,%eax
+  804105:	f7 e2                	mul    %edx
+  804107:	c1 ea 0c             	shr    $0xc,%edx
+  80410a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  804110:	39 d3                	cmp    %edx,%ebx
+  804112:	0f 95 c3             	setne  %bl
+  804115:	0f b6 db             	movzbl %bl,%ebx
+  804118:	eb b0                	jmp    8040ca <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80411a:	8b 71 04             	mov    0x4(%ecx),%esi
+  80411d:	8b 01                	mov    (%ecx),%eax
+  80411f:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804125:	29 c6                	sub    %eax,%esi
+  804127:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80412c:	89 f0                	mov    %esi,%eax
+  80412e:	f7 e2                	mul    %edx
+  804130:	c1 ea 0c             	shr    $0xc,%edx
+  804133:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804139:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80413b:	89 d8                	mov    %ebx,%eax
+  80413d:	83 c8 04             	or     $0x4,%eax
+  804140:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  804146:	0f 42 d8             	cmovb  %eax,%ebx
+  804149:	eb 87                	jmp    8040d2 <devpipe_poll+0x29>
+
+0080414b <pipe>:
+{
+  80414b:	55                   	push   %ebp
+  80414c:	89 e5                	mov    %esp,%ebp
+  80414e:	56                   	push   %esi
+  80414f:	53                   	push   %ebx
+  804150:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804153:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804156:	50                   	push   %eax
+  804157:	e8 85 d5 ff ff       	call   8016e1 <fd_alloc>
+  80415c:	89 c3                	mov    %eax,%ebx
+  80415e:	83 c4 10             	add    $0x10,%esp
+  804161:	85 c0                	test   %eax,%eax
+  804163:	0f 88 23 01 00 00    	js     80428c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804169:	83 ec 04             	sub    $0x4,%esp
+  80416c:	68 07 04 00 00       	push   $0x407
+  804171:	ff 75 f4             	push   -0xc(%ebp)
+  804174:	6a 00                	push   $0x0
+  804176:	e8 dc d0 ff ff       	call   801257 <sys_page_alloc>
+  80417b:	89 c3                	mov    %eax,%ebx
+  80417d:	83 c4 10             	add    $0x10,%esp
+  804180:	85 c0                	test   %eax,%eax
+  804182:	0f 88 04 01 00 00    	js     80428c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  804188:	83 ec 0c             	sub    $0xc,%esp
+  80418b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80418e:	50                   	push   %eax
+  80418f:	e8 4d d5 ff ff       	call   8016e1 <fd_alloc>
+  804194:	89 c3                	mov    %eax,%ebx
+  804196:	83 c4 10             	add    $0x10,%esp
+  804199:	85 c0                	test   %eax,%eax
+  80419b:	0f 88 db 00 00 00    	js     80427c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8041a1:	83 ec 04             	sub    $0x4,%esp
+  8041a4:	68 07 04 00 00       	push   $0x407
+  8041a9:	ff 75 f0             	push   -0x10(%ebp)
+  8041ac:	6a 00                	push   $0x0
+  8041ae:	e8 a4 d0 ff ff       	call   801257 <sys_page_alloc>
+  8041b3:	89 c3                	mov    %eax,%ebx
+  8041b5:	83 c4 10             	add    $0x10,%esp
+  8041b8:	85 c0                	test   %eax,%eax
+  8041ba:	0f 88 bc 00 00 00    	js     80427c <pipe+0x131>
+	va = fd2data(fd0);
+  8041c0:	83 ec 0c             	sub    $0xc,%esp
+  8041c3:	ff 75 f4             	push   -0xc(%ebp)
+  8041c6:	e8 ff d4 ff ff       	call   8016ca <fd2data>
+  8041cb:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8041cd:	83 c4 0c             	add    $0xc,%esp
+  8041d0:	68 07 04 00 00       	push   $0x407
+  8041d5:	50                   	push   %eax
+  8041d6:	6a 00                	push   $0x0
+  8041d8:	e8 7a d0 ff ff       	call   801257 <sys_page_alloc>
+  8041dd:	89 c3                	mov    %eax,%ebx
+  8041df:	83 c4 10             	add    $0x10,%esp
+  8041e2:	85 c0                	test   %eax,%eax
+  8041e4:	0f 88 82 00 00 00    	js     80426c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8041ea:	83 ec 0c             	sub    $0xc,%esp
+  8041ed:	ff 75 f0             	push   -0x10(%ebp)
+  8041f0:	e8 d5 d4 ff ff       	call   8016ca <fd2data>
+  8041f5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8041fc:	50                   	push   %eax
+  8041fd:	6a 00                	push   $0x0
+  8041ff:	56                   	push   %esi
+  804200:	6a 00                	push   $0x0
+  804202:	e8 93 d0 ff ff       	call   80129a <sys_page_map>
+  804207:	89 c3                	mov    %eax,%ebx
+  804209:	83 c4 20             	add    $0x20,%esp
+  80420c:	85 c0                	test   %eax,%eax
+  80420e:	78 4e                	js     80425e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  804210:	a1 60 60 80 00       	mov    0x806060,%eax
+  804215:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804218:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80421a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80421d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804224:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804227:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804229:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80422c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804233:	83 ec 0c             	sub    $0xc,%esp
+  804236:	ff 75 f4             	push   -0xc(%ebp)
+  804239:	e8 7c d4 ff ff       	call   8016ba <fd2num>
+  80423e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804241:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804243:	83 c4 04             	add    $0x4,%esp
+  804246:	ff 75 f0             	push   -0x10(%ebp)
+  804249:	e8 6c d4 ff ff       	call   8016ba <fd2num>
+  80424e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804251:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804254:	83 c4 10             	add    $0x10,%esp
+  804257:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80425c:	eb 2e                	jmp    80428c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80425e:	83 ec 08             	sub    $0x8,%esp
+  804261:	56                   	push   %esi
+  804262:	6a 00                	push   $0x0
+  804264:	e8 73 d0 ff ff       	call   8012dc <sys_page_unmap>
+  804269:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80426c:	83 ec 08             	sub    $0x8,%esp
+  80426f:	ff 75 f0             	push   -0x10(%ebp)
+  804272:	6a 00                	push   $0x0
+  804274:	e8 63 d0 ff ff       	call   8012dc <sys_page_unmap>
+  804279:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80427c:	83 ec 08             	sub    $0x8,%esp
+  80427f:	ff 75 f4             	push   -0xc(%ebp)
+  804282:	6a 00                	push   $0x0
+  804284:	e8 53 d0 ff ff       	call   8012dc <sys_page_unmap>
+  804289:	83 c4 10             	add    $0x10,%esp
+}
+  80428c:	89 d8                	mov    %ebx,%eax
+  80428e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804291:	5b                   	pop    %ebx
+  804292:	5e                   	pop    %esi
+  804293:	5d                   	pop    %ebp
+  804294:	c3                   	ret
+
+00804295 <pipeisclosed>:
+{
+  804295:	55                   	push   %ebp
+  804296:	89 e5                	mov    %esp,%ebp
+  804298:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80429b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80429e:	50                   	push   %eax
+  80429f:	ff 75 08             	push   0x8(%ebp)
+  8042a2:	e8 8a d4 ff ff       	call   801731 <fd_lookup>
+  8042a7:	83 c4 10             	add    $0x10,%esp
+  8042aa:	85 c0                	test   %eax,%eax
+  8042ac:	78 18                	js     8042c6 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8042ae:	83 ec 0c             	sub    $0xc,%esp
+  8042b1:	ff 75 f4             	push   -0xc(%ebp)
+  8042b4:	e8 11 d4 ff ff       	call   8016ca <fd2data>
+  8042b9:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8042bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042be:	e8 e6 f9 ff ff       	call   803ca9 <_pipeisclosed>
+  8042c3:	83 c4 10             	add    $0x10,%esp
+}
+  8042c6:	c9                   	leave
+  8042c7:	c3                   	ret
+
+008042c8 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8042c8:	55                   	push   %ebp
+  8042c9:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8042cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042ce:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8042d4:	5d                   	pop    %ebp
+  8042d5:	c3                   	ret
+
+008042d6 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8042d6:	55                   	push   %ebp
+  8042d7:	89 e5                	mov    %esp,%ebp
+  8042d9:	53                   	push   %ebx
+  8042da:	83 ec 04             	sub    $0x4,%esp
+  8042dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8042e0:	8b 03                	mov    (%ebx),%eax
+  8042e2:	85 c0                	test   %eax,%eax
+  8042e4:	75 05                	jne    8042eb <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8042e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8042e9:	c9                   	leave
+  8042ea:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8042eb:	83 ec 08             	sub    $0x8,%esp
+  8042ee:	50                   	push   %eax
+  8042ef:	8d 43 04             	lea    0x4(%ebx),%eax
+  8042f2:	50                   	push   %eax
+  8042f3:	e8 34 d2 ff ff       	call   80152c <sys_page_batch>
+	pb->pb_n = 0;
+  8042f8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8042fe:	83 c4 10             	add    $0x10,%esp
+  804301:	eb e3                	jmp    8042e6 <pgbatch_flush+0x10>
+
+00804303 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  804303:	55                   	push   %ebp
+  804304:	89 e5                	mov    %esp,%ebp
+  804306:	56                   	push   %esi
+  804307:	53                   	push   %ebx
+  804308:	89 c3                	mov    %eax,%ebx
+  80430a:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80430c:	83 38 20             	cmpl   $0x20,(%eax)
+  80430f:	74 2c                	je     80433d <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  804311:	8b 03                	mov    (%ebx),%eax
+  804313:	8d 50 01             	lea    0x1(%eax),%edx
+  804316:	89 13                	mov    %edx,(%ebx)
+  804318:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80431b:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  80431f:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  804321:	83 ec 04             	sub    $0x4,%esp
+  804324:	6a 18                	push   $0x18
+  804326:	6a 00                	push   $0x0
+  804328:	50                   	push   %eax
+  804329:	e8 70 cc ff ff       	call   800f9e <memset>
+	return 0;
+  80432e:	83 c4 10             	add    $0x10,%esp
+  804331:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804336:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804339:	5b                   	pop    %ebx
+  80433a:	5e                   	pop    %esi
+  80433b:	5d                   	pop    %ebp
+  80433c:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80433d:	83 ec 0c             	sub    $0xc,%esp
+  804340:	50                   	push   %eax
+  804341:	e8 90 ff ff ff       	call   8042d6 <pgbatch_flush>
+  804346:	83 c4 10             	add    $0x10,%esp
+  804349:	85 c0                	test   %eax,%eax
+  80434b:	79 c4                	jns    804311 <pgbatch_slot+0xe>
+  80434d:	eb e7                	jmp    804336 <pgbatch_slot+0x33>
+
+0080434f <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80434f:	55                   	push   %ebp
+  804350:	89 e5                	mov    %esp,%ebp
+  804352:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804355:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804358:	8b 45 08             	mov    0x8(%ebp),%eax
+  80435b:	e8 a3 ff ff ff       	call   804303 <pgbatch_slot>
+  804360:	85 c0                	test   %eax,%eax
+  804362:	78 20                	js     804384 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  804364:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804367:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80436d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804370:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804373:	8b 55 10             	mov    0x10(%ebp),%edx
+  804376:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804379:	8b 55 14             	mov    0x14(%ebp),%edx
+  80437c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80437f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804384:	c9                   	leave
+  804385:	c3                   	ret
+
+00804386 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  804386:	55                   	push   %ebp
+  804387:	89 e5                	mov    %esp,%ebp
+  804389:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80438c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80438f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804392:	e8 6c ff ff ff       	call   804303 <pgbatch_slot>
+  804397:	85 c0                	test   %eax,%eax
+  804399:	78 2c                	js     8043c7 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80439b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80439e:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8043a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8043a7:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8043aa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8043ad:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8043b0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8043b3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8043b6:	8b 55 18             	mov    0x18(%ebp),%edx
+  8043b9:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8043bc:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8043bf:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8043c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043c7:	c9                   	leave
+  8043c8:	c3                   	ret
+
+008043c9 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  8043c9:	55                   	push   %ebp
+  8043ca:	89 e5                	mov    %esp,%ebp
+  8043cc:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8043cf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8043d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043d5:	e8 29 ff ff ff       	call   804303 <pgbatch_slot>
+  8043da:	85 c0                	test   %eax,%eax
+  8043dc:	78 1a                	js     8043f8 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8043de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043e1:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8043e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8043ea:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8043ed:	8b 55 10             	mov    0x10(%ebp),%edx
+  8043f0:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8043f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043f8:	c9                   	leave
+  8043f9:	c3                   	ret
+
+008043fa <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8043fa:	55                   	push   %ebp
+  8043fb:	89 e5                	mov    %esp,%ebp
+  8043fd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804400:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804403:	8b 45 08             	mov    0x8(%ebp),%eax
+  804406:	e8 f8 fe ff ff       	call   804303 <pgbatch_slot>
+  80440b:	85 c0                	test   %eax,%eax
+  80440d:	78 20                	js     80442f <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  80440f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804412:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  804418:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80441b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80441e:	8b 55 10             	mov    0x10(%ebp),%edx
+  804421:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804424:	8b 55 14             	mov    0x14(%ebp),%edx
+  804427:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80442a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80442f:	c9                   	leave
+  804430:	c3                   	ret
+
+00804431 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  804431:	55                   	push   %ebp
+  804432:	89 e5                	mov    %esp,%ebp
+  804434:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804437:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80443a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80443d:	e8 c1 fe ff ff       	call   804303 <pgbatch_slot>
+  804442:	85 c0                	test   %eax,%eax
+  804444:	78 26                	js     80446c <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  804446:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804449:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  80444f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804452:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  804455:	8b 55 10             	mov    0x10(%ebp),%edx
+  804458:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80445b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80445e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  804461:	8b 55 18             	mov    0x18(%ebp),%edx
+  804464:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804467:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80446c:	c9                   	leave
+  80446d:	c3                   	ret
+
+0080446e <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  80446e:	55                   	push   %ebp
+  80446f:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  804471:	8b 45 08             	mov    0x8(%ebp),%eax
+  804474:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80447a:	5d                   	pop    %ebp
+  80447b:	c3                   	ret
+
+0080447c <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  80447c:	55                   	push   %ebp
+  80447d:	89 e5                	mov    %esp,%ebp
+  80447f:	56                   	push   %esi
+  804480:	53                   	push   %ebx
+  804481:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804484:	b8 00 00 00 00       	mov    $0x0,%eax
+  804489:	ba 01 00 00 00       	mov    $0x1,%edx
+  80448e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804492:	85 c0                	test   %eax,%eax
+  804494:	74 2f                	je     8044c5 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  804496:	83 f8 02             	cmp    $0x2,%eax
+  804499:	74 0c                	je     8044a7 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  80449b:	b8 02 00 00 00       	mov    $0x2,%eax
+  8044a0:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  8044a3:	85 c0                	test   %eax,%eax
+  8044a5:	74 1e                	je     8044c5 <mutex_lock+0x49>
+  8044a7:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  8044ac:	83 ec 04             	sub    $0x4,%esp
+  8044af:	6a ff                	push   $0xffffffff
+  8044b1:	6a 02                	push   $0x2
+  8044b3:	53                   	push   %ebx
+  8044b4:	e8 9c d1 ff ff       	call   801655 <sys_futex_wait>
+  8044b9:	89 f0                	mov    %esi,%eax
+  8044bb:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  8044be:	83 c4 10             	add    $0x10,%esp
+  8044c1:	85 c0                	test   %eax,%eax
+  8044c3:	75 e7                	jne    8044ac <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8044c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044c8:	5b                   	pop    %ebx
+  8044c9:	5e                   	pop    %esi
+  8044ca:	5d                   	pop    %ebp
+  8044cb:	c3                   	ret
+
+008044cc <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  8044cc:	55                   	push   %ebp
+  8044cd:	89 e5                	mov    %esp,%ebp
+  8044cf:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  8044d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8044dc:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  8044e0:	85 c0                	test   %eax,%eax
+  8044e2:	0f 94 c0             	sete   %al
+  8044e5:	0f b6 c0             	movzbl %al,%eax
+}
+  8044e8:	5d                   	pop    %ebp
+  8044e9:	c3                   	ret
+
+008044ea <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8044ea:	55                   	push   %ebp
+  8044eb:	89 e5                	mov    %esp,%ebp
+  8044ed:	83 ec 08             	sub    $0x8,%esp
+  8044f0:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  8044f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f8:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8044fb:	83 f8 02             	cmp    $0x2,%eax
+  8044fe:	74 02                	je     804502 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804500:	c9                   	leave
+  804501:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804502:	83 ec 08             	sub    $0x8,%esp
+  804505:	6a 01                	push   $0x1
+  804507:	52                   	push   %edx
+  804508:	e8 6a d1 ff ff       	call   801677 <sys_futex_wake>
+  80450d:	83 c4 10             	add    $0x10,%esp
+}
+  804510:	eb ee                	jmp    804500 <mutex_unlock+0x16>
+
+00804512 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  804512:	55                   	push   %ebp
+  804513:	89 e5                	mov    %esp,%ebp
+  804515:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  804518:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  80451e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804525:	5d                   	pop    %ebp
+  804526:	c3                   	ret
+
+00804527 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  804527:	55                   	push   %ebp
+  804528:	89 e5                	mov    %esp,%ebp
+  80452a:	57                   	push   %edi
+  80452b:	56                   	push   %esi
+  80452c:	53                   	push   %ebx
+  80452d:	83 ec 18             	sub    $0x18,%esp
+  804530:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804533:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  804536:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  804538:	b8 01 00 00 00       	mov    $0x1,%eax
+  80453d:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804542:	57                   	push   %edi
+  804543:	e8 a2 ff ff ff       	call   8044ea <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804548:	83 c4 0c             	add    $0xc,%esp
+  80454b:	ff 75 10             	push   0x10(%ebp)
+  80454e:	56                   	push   %esi
+  80454f:	53                   	push   %ebx
+  804550:	e8 00 d1 ff ff       	call   801655 <sys_futex_wait>
+  804555:	89 c6                	mov    %eax,%esi
+  804557:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80455c:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804561:	89 3c 24             	mov    %edi,(%esp)
+  804564:	e8 13 ff ff ff       	call   80447c <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804569:	83 c4 10             	add    $0x10,%esp
+  80456c:	83 fe ef             	cmp    $0xffffffef,%esi
+  80456f:	74 05                	je     804576 <cond_timedwait+0x4f>
+  804571:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804576:	89 f0                	mov    %esi,%eax
+  804578:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80457b:	5b                   	pop    %ebx
+  80457c:	5e                   	pop    %esi
+  80457d:	5f                   	pop    %edi
+  80457e:	5d                   	pop    %ebp
+  80457f:	c3                   	ret
+
+00804580 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804580:	55                   	push   %ebp
+  804581:	89 e5                	mov    %esp,%ebp
+  804583:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804586:	6a ff                	push   $0xffffffff
+  804588:	ff 75 0c             	push   0xc(%ebp)
+  80458b:	ff 75 08             	push   0x8(%ebp)
+  80458e:	e8 94 ff ff ff       	call   804527 <cond_timedwait>
+}
+  804593:	83 c4 10             	add    $0x10,%esp
+  804596:	c9                   	leave
+  804597:	c3                   	ret
+
+00804598 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804598:	55                   	push   %ebp
+  804599:	89 e5                	mov    %esp,%ebp
+  80459b:	83 ec 08             	sub    $0x8,%esp
+  80459e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045a1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045a6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8045aa:	8b 50 04             	mov    0x4(%eax),%edx
+  8045ad:	85 d2                	test   %edx,%edx
+  8045af:	75 02                	jne    8045b3 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  8045b1:	c9                   	leave
+  8045b2:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  8045b3:	83 ec 08             	sub    $0x8,%esp
+  8045b6:	6a 01                	push   $0x1
+  8045b8:	50                   	push   %eax
+  8045b9:	e8 b9 d0 ff ff       	call   801677 <sys_futex_wake>
+  8045be:	83 c4 10             	add    $0x10,%esp
+}
+  8045c1:	eb ee                	jmp    8045b1 <cond_signal+0x19>
+
+008045c3 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8045c3:	55                   	push   %ebp
+  8045c4:	89 e5                	mov    %esp,%ebp
+  8045c6:	83 ec 08             	sub    $0x8,%esp
+  8045c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045cc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045d1:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8045d5:	8b 50 04             	mov    0x4(%eax),%edx
+  8045d8:	85 d2                	test   %edx,%edx
+  8045da:	75 02                	jne    8045de <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  8045dc:	c9                   	leave
+  8045dd:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  8045de:	83 ec 08             	sub    $0x8,%esp
+  8045e1:	68 00 04 00 00       	push   $0x400
+  8045e6:	50                   	push   %eax
+  8045e7:	e8 8b d0 ff ff       	call   801677 <sys_futex_wake>
+  8045ec:	83 c4 10             	add    $0x10,%esp
+}
+  8045ef:	eb eb                	jmp    8045dc <cond_broadcast+0x19>
+
+008045f1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8045f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045f6:	c3                   	ret
+
+008045f7 <devcons_poll>:
+{
+  8045f7:	55                   	push   %ebp
+  8045f8:	89 e5                	mov    %esp,%ebp
+  8045fa:	53                   	push   %ebx
+  8045fb:	83 ec 04             	sub    $0x4,%esp
+  8045fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804601:	89 da                	mov    %ebx,%edx
+  804603:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804606:	83 3d a8 b8 80 00 00 	cmpl   $0x0,0x80b8a8
+  80460d:	74 0c                	je     80461b <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80460f:	89 d8                	mov    %ebx,%eax
+  804611:	83 e0 01             	and    $0x1,%eax
+  804614:	09 d0                	or     %edx,%eax
+}
+  804616:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804619:	c9                   	leave
+  80461a:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80461b:	e8 99 cb ff ff       	call   8011b9 <sys_cgetc>
+  804620:	a3 a8 b8 80 00       	mov    %eax,0x80b8a8
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804625:	89 da                	mov    %ebx,%edx
+  804627:	83 e2 04             	and    $0x4,%edx
+  80462a:	85 c0                	test   %eax,%eax
+  80462c:	74 e6                	je     804614 <devcons_poll+0x1d>
+  80462e:	eb df                	jmp    80460f <devcons_poll+0x18>
+
+00804630 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804630:	55                   	push   %ebp
+  804631:	89 e5                	mov    %esp,%ebp
+  804633:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804636:	68 2b 5b 80 00       	push   $0x805b2b
+  80463b:	ff 75 0c             	push   0xc(%ebp)
+  80463e:	e8 e0 c7 ff ff       	call   800e23 <strcpy>
+	return 0;
+}
+  804643:	b8 00 00 00 00       	mov    $0x0,%eax
+  804648:	c9                   	leave
+  804649:	c3                   	ret
+
+0080464a <devcons_write>:
+{
+  80464a:	55                   	push   %ebp
+  80464b:	89 e5                	mov    %esp,%ebp
+  80464d:	57                   	push   %edi
+  80464e:	56                   	push   %esi
+  80464f:	53                   	push   %ebx
+  804650:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804656:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804659:	85 ff                	test   %edi,%edi
+  80465b:	74 51                	je     8046ae <devcons_write+0x64>
+  80465d:	be 00 00 00 00       	mov    $0x0,%esi
+  804662:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804667:	89 fb                	mov    %edi,%ebx
+  804669:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80466b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804670:	39 d3                	cmp    %edx,%ebx
+  804672:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804675:	83 ec 04             	sub    $0x4,%esp
+  804678:	53                   	push   %ebx
+  804679:	03 45 0c             	add    0xc(%ebp),%eax
+  80467c:	50                   	push   %eax
+  80467d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804683:	50                   	push   %eax
+  804684:	e8 4a c9 ff ff       	call   800fd3 <memmove>
+		sys_cputs(buf, m);
+  804689:	83 c4 08             	add    $0x8,%esp
+  80468c:	53                   	push   %ebx
+  80468d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804693:	50                   	push   %eax
+  804694:	e8 02 cb ff ff       	call   80119b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804699:	01 de                	add    %ebx,%esi
+  80469b:	89 f0                	mov    %esi,%eax
+  80469d:	83 c4 10             	add    $0x10,%esp
+  8046a0:	39 fe                	cmp    %edi,%esi
+  8046a2:	72 c3                	jb     804667 <devcons_write+0x1d>
+}
+  8046a4:	89 f0                	mov    %esi,%eax
+  8046a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046a9:	5b                   	pop    %ebx
+  8046aa:	5e                   	pop    %esi
+  8046ab:	5f                   	pop    %edi
+  8046ac:	5d                   	pop    %ebp
+  8046ad:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8046ae:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8046b3:	eb ef                	jmp    8046a4 <devcons_write+0x5a>
+
+008046b5 <devcons_read>:
+{
+  8046b5:	55                   	push   %ebp
+  8046b6:	89 e5                	mov    %esp,%ebp
+  8046b8:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8046bb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8046c0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8046c4:	74 36                	je     8046fc <devcons_read+0x47>
+	c = cons_peek;
+  8046c6:	a1 a8 b8 80 00       	mov    0x80b8a8,%eax
+	cons_peek = 0;
+  8046cb:	c7 05 a8 b8 80 00 00 	movl   $0x0,0x80b8a8
+  8046d2:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8046d5:	85 c0                	test   %eax,%eax
+  8046d7:	75 10                	jne    8046e9 <devcons_read+0x34>
+  8046d9:	e8 db ca ff ff       	call   8011b9 <sys_cgetc>
+  8046de:	85 c0                	test   %eax,%eax
+  8046e0:	75 07                	jne    8046e9 <devcons_read+0x34>
+		sys_yield();
+  8046e2:	e8 51 cb ff ff       	call   801238 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8046e7:	eb f0                	jmp    8046d9 <devcons_read+0x24>
+	if (c < 0)
+  8046e9:	85 c0                	test   %eax,%eax
+  8046eb:	78 0f                	js     8046fc <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8046ed:	83 f8 04             	cmp    $0x4,%eax
+  8046f0:	74 0c                	je     8046fe <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8046f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8046f5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8046f7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8046fc:	c9                   	leave
+  8046fd:	c3                   	ret
+		return 0;
+  8046fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804703:	eb f7                	jmp    8046fc <devcons_read+0x47>
+
+00804705 <cputchar>:
+{
+  804705:	55                   	push   %ebp
+  804706:	89 e5                	mov    %esp,%ebp
+  804708:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80470b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80470e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804711:	6a 01                	push   $0x1
+  804713:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804716:	50                   	push   %eax
+  804717:	e8 7f ca ff ff       	call   80119b <sys_cputs>
+}
+  80471c:	83 c4 10             	add    $0x10,%esp
+  80471f:	c9                   	leave
+  804720:	c3                   	ret
+
+00804721 <getchar>:
+{
+  804721:	55                   	push   %ebp
+  804722:	89 e5                	mov    %esp,%ebp
+  804724:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804727:	6a 01                	push   $0x1
+  804729:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80472c:	50                   	push   %eax
+  80472d:	6a 00                	push   $0x0
+  80472f:	e8 81 d2 ff ff       	call   8019b5 <read>
+	if (r < 0)
+  804734:	83 c4 10             	add    $0x10,%esp
+  804737:	85 c0                	test   %eax,%eax
+  804739:	78 06                	js     804741 <getchar+0x20>
+	if (r < 1)
+  80473b:	74 06                	je     804743 <getchar+0x22>
+	return c;
+  80473d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804741:	c9                   	leave
+  804742:	c3                   	ret
+		return -E_EOF;
+  804743:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804748:	eb f7                	jmp    804741 <getchar+0x20>
+
+0080474a <iscons>:
+{
+  80474a:	55                   	push   %ebp
+  80474b:	89 e5                	mov    %esp,%ebp
+  80474d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804750:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804753:	50                   	push   %eax
+  804754:	ff 75 08             	push   0x8(%ebp)
+  804757:	e8 d5 cf ff ff       	call   801731 <fd_lookup>
+  80475c:	83 c4 10             	add    $0x10,%esp
+  80475f:	85 c0                	test   %eax,%eax
+  804761:	78 11                	js     804774 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804763:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804766:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  80476c:	39 10                	cmp    %edx,(%eax)
+  80476e:	0f 94 c0             	sete   %al
+  804771:	0f b6 c0             	movzbl %al,%eax
+}
+  804774:	c9                   	leave
+  804775:	c3                   	ret
+
+00804776 <opencons>:
+{
+  804776:	55                   	push   %ebp
+  804777:	89 e5                	mov    %esp,%ebp
+  804779:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80477c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80477f:	50                   	push   %eax
+  804780:	e8 5c cf ff ff       	call   8016e1 <fd_alloc>
+  804785:	83 c4 10             	add    $0x10,%esp
+  804788:	85 c0                	test   %eax,%eax
+  80478a:	78 3a                	js     8047c6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80478c:	83 ec 04             	sub    $0x4,%esp
+  80478f:	68 07 04 00 00       	push   $0x407
+  804794:	ff 75 f4             	push   -0xc(%ebp)
+  804797:	6a 00                	push   $0x0
+  804799:	e8 b9 ca ff ff       	call   801257 <sys_page_alloc>
+  80479e:	83 c4 10             	add    $0x10,%esp
+  8047a1:	85 c0                	test   %eax,%eax
+  8047a3:	78 21                	js     8047c6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047a8:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  8047ae:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8047b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047b3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8047ba:	83 ec 0c             	sub    $0xc,%esp
+  8047bd:	50                   	push   %eax
+  8047be:	e8 f7 ce ff ff       	call   8016ba <fd2num>
+  8047c3:	83 c4 10             	add    $0x10,%esp
+}
+  8047c6:	c9                   	leave
+  8047c7:	c3                   	ret
+
+008047c8 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8047c8:	85 c0                	test   %eax,%eax
+  8047ca:	74 20                	je     8047ec <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8047cc:	89 c1                	mov    %eax,%ecx
+  8047ce:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8047d4:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8047da:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8047e0:	8b 52 48             	mov    0x48(%edx),%edx
+  8047e3:	39 c2                	cmp    %eax,%edx
+  8047e5:	74 06                	je     8047ed <thread_alive+0x25>
+  8047e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047ec:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8047ed:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8047f3:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8047f9:	85 c0                	test   %eax,%eax
+  8047fb:	0f 95 c0             	setne  %al
+  8047fe:	0f b6 c0             	movzbl %al,%eax
+  804801:	c3                   	ret
+
+00804802 <pgfault>:
+{
+  804802:	55                   	push   %ebp
+  804803:	89 e5                	mov    %esp,%ebp
+  804805:	57                   	push   %edi
+  804806:	56                   	push   %esi
+  804807:	53                   	push   %ebx
+  804808:	83 ec 0c             	sub    $0xc,%esp
+  80480b:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80480e:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  804810:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  804813:	89 f3                	mov    %esi,%ebx
+  804815:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  804818:	83 3d 04 f0 80 00 00 	cmpl   $0x0,0x80f004
+  80481f:	74 52                	je     804873 <pgfault+0x71>
+  804821:	a8 02                	test   $0x2,%al
+  804823:	75 14                	jne    804839 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  804825:	83 ec 04             	sub    $0x4,%esp
+  804828:	68 37 5b 80 00       	push   $0x805b37
+  80482d:	6a 2e                	push   $0x2e
+  80482f:	68 55 5b 80 00       	push   $0x805b55
+  804834:	e8 18 be ff ff       	call   800651 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  804839:	89 d8                	mov    %ebx,%eax
+  80483b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804840:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  804847:	83 ec 0c             	sub    $0xc,%esp
+  80484a:	57                   	push   %edi
+  80484b:	e8 2c fc ff ff       	call   80447c <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  804850:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  804857:	83 e0 03             	and    $0x3,%eax
+  80485a:	83 c4 10             	add    $0x10,%esp
+  80485d:	83 f8 03             	cmp    $0x3,%eax
+  804860:	75 1a                	jne    80487c <pgfault+0x7a>
+			mutex_unlock(m);
+  804862:	83 ec 0c             	sub    $0xc,%esp
+  804865:	57                   	push   %edi
+  804866:	e8 7f fc ff ff       	call   8044ea <mutex_unlock>
+			return;
+  80486b:	83 c4 10             	add    $0x10,%esp
+  80486e:	e9 9f 00 00 00       	jmp    804912 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  804873:	a8 02                	test   $0x2,%al
+  804875:	74 ae                	je     804825 <pgfault+0x23>
+	struct mutex *m = NULL;
+  804877:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80487c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  804883:	f6 c4 08             	test   $0x8,%ah
+  804886:	74 9d                	je     804825 <pgfault+0x23>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804888:	89 e0                	mov    %esp,%eax
+  80488a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80488f:	29 c2                	sub    %eax,%edx
+  804891:	89 d0                	mov    %edx,%eax
+  804893:	c1 e8 0f             	shr    $0xf,%eax
+  804896:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80489c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048a1:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8048a4:	c1 e0 0c             	shl    $0xc,%eax
+  8048a7:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8048ac:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8048ae:	83 ec 04             	sub    $0x4,%esp
+  8048b1:	6a 07                	push   $0x7
+  8048b3:	53                   	push   %ebx
+  8048b4:	6a 00                	push   $0x0
+  8048b6:	e8 9c c9 ff ff       	call   801257 <sys_page_alloc>
+  8048bb:	83 c4 10             	add    $0x10,%esp
+  8048be:	85 c0                	test   %eax,%eax
+  8048c0:	78 58                	js     80491a <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8048c2:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8048c8:	83 ec 04             	sub    $0x4,%esp
+  8048cb:	68 00 10 00 00       	push   $0x1000
+  8048d0:	56                   	push   %esi
+  8048d1:	53                   	push   %ebx
+  8048d2:	e8 fc c6 ff ff       	call   800fd3 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8048d7:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8048de:	56                   	push   %esi
+  8048df:	6a 00                	push   $0x0
+  8048e1:	53                   	push   %ebx
+  8048e2:	6a 00                	push   $0x0
+  8048e4:	e8 b1 c9 ff ff       	call   80129a <sys_page_map>
+  8048e9:	83 c4 20             	add    $0x20,%esp
+  8048ec:	85 c0                	test   %eax,%eax
+  8048ee:	78 3c                	js     80492c <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8048f0:	83 ec 08             	sub    $0x8,%esp
+  8048f3:	53                   	push   %ebx
+  8048f4:	6a 00                	push   $0x0
+  8048f6:	e8 e1 c9 ff ff       	call   8012dc <sys_page_unmap>
+  8048fb:	83 c4 10             	add    $0x10,%esp
+  8048fe:	85 c0                	test   %eax,%eax
+  804900:	78 3c                	js     80493e <pgfault+0x13c>
+	if(m)
+  804902:	85 ff                	test   %edi,%edi
+  804904:	74 0c                	je     804912 <pgfault+0x110>
+		mutex_unlock(m);
+  804906:	83 ec 0c             	sub    $0xc,%esp
+  804909:	57                   	push   %edi
+  80490a:	e8 db fb ff ff       	call   8044ea <mutex_unlock>
+  80490f:	83 c4 10             	add    $0x10,%esp
+}
+  804912:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804915:	5b                   	pop    %ebx
+  804916:	5e                   	pop    %esi
+  804917:	5f                   	pop    %edi
+  804918:	5d                   	pop    %ebp
+  804919:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  80491a:	50                   	push   %eax
+  80491b:	68 60 5b 80 00       	push   $0x805b60
+  804920:	6a 3d                	push   $0x3d
+  804922:	68 55 5b 80 00       	push   $0x805b55
+  804927:	e8 25 bd ff ff       	call   800651 <_panic>
+		panic("sys_page_map: %e", ret);
+  80492c:	50                   	push   %eax
+  80492d:	68 73 5b 80 00       	push   $0x805b73
+  804932:	6a 40                	push   $0x40
+  804934:	68 55 5b 80 00       	push   $0x805b55
+  804939:	e8 13 bd ff ff       	call   800651 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80493e:	50                   	push   %eax
+  80493f:	68 84 5b 80 00       	push   $0x805b84
+  804944:	6a 42                	push   $0x42
+  804946:	68 55 5b 80 00       	push   $0x805b55
+  80494b:	e8 01 bd ff ff       	call   800651 <_panic>
+
+00804950 <thread_main>:
+{
+  804950:	55                   	push   %ebp
+  804951:	89 e5                	mov    %esp,%ebp
+  804953:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  804956:	ff 75 0c             	push   0xc(%ebp)
+  804959:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80495c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804963:	e8 70 c8 ff ff       	call   8011d8 <sys_env_destroy>
+}
+  804968:	83 c4 10             	add    $0x10,%esp
+  80496b:	c9                   	leave
+  80496c:	c3                   	ret
+
+0080496d <fork>:
+{
+  80496d:	55                   	push   %ebp
+  80496e:	89 e5                	mov    %esp,%ebp
+  804970:	57                   	push   %edi
+  804971:	56                   	push   %esi
+  804972:	53                   	push   %ebx
+  804973:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  804976:	68 02 48 80 00       	push   $0x804802
+  80497b:	e8 3a 09 00 00       	call   8052ba <set_pgfault_handler>
+	if(sforked)
+  804980:	83 c4 10             	add    $0x10,%esp
+  804983:	83 3d 04 f0 80 00 00 	cmpl   $0x0,0x80f004
+  80498a:	75 33                	jne    8049bf <fork+0x52>
+	__asm __volatile("int %2"
+  80498c:	b8 07 00 00 00       	mov    $0x7,%eax
+  804991:	cd 30                	int    $0x30
+  804993:	89 c7                	mov    %eax,%edi
+  804995:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  804997:	85 c0                	test   %eax,%eax
+  804999:	0f 88 b4 00 00 00    	js     804a53 <fork+0xe6>
+	if(envid == 0) {
+  80499f:	0f 84 c3 00 00 00    	je     804a68 <fork+0xfb>
+	pgbatch_init(&pb);
+  8049a5:	83 ec 0c             	sub    $0xc,%esp
+  8049a8:	68 e0 bb 80 00       	push   $0x80bbe0
+  8049ad:	e8 16 f9 ff ff       	call   8042c8 <pgbatch_init>
+  8049b2:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8049b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049ba:	e9 9c 01 00 00       	jmp    804b5b <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8049bf:	83 ec 0c             	sub    $0xc,%esp
+  8049c2:	68 80 bf 80 00       	push   $0x80bf80
+  8049c7:	e8 b0 fa ff ff       	call   80447c <mutex_lock>
+  8049cc:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8049cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8049d4:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8049d9:	eb 08                	jmp    8049e3 <fork+0x76>
+  8049db:	83 c3 01             	add    $0x1,%ebx
+  8049de:	83 fb 20             	cmp    $0x20,%ebx
+  8049e1:	74 5b                	je     804a3e <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8049e3:	8b 34 9d 00 bf 80 00 	mov    0x80bf00(,%ebx,4),%esi
+  8049ea:	89 f0                	mov    %esi,%eax
+  8049ec:	e8 d7 fd ff ff       	call   8047c8 <thread_alive>
+  8049f1:	85 c0                	test   %eax,%eax
+  8049f3:	74 e6                	je     8049db <fork+0x6e>
+  8049f5:	89 e0                	mov    %esp,%eax
+  8049f7:	89 fa                	mov    %edi,%edx
+  8049f9:	29 c2                	sub    %eax,%edx
+  8049fb:	89 d0                	mov    %edx,%eax
+  8049fd:	c1 e8 0f             	shr    $0xf,%eax
+  804a00:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  804a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a0b:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  804a0e:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  804a15:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  804a18:	83 ec 08             	sub    $0x8,%esp
+  804a1b:	50                   	push   %eax
+  804a1c:	56                   	push   %esi
+  804a1d:	e8 80 c9 ff ff       	call   8013a2 <sys_env_set_pgfault_upcall>
+  804a22:	83 c4 10             	add    $0x10,%esp
+  804a25:	85 c0                	test   %eax,%eax
+  804a27:	79 b2                	jns    8049db <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  804a29:	50                   	push   %eax
+  804a2a:	68 10 5c 80 00       	push   $0x805c10
+  804a2f:	68 00 01 00 00       	push   $0x100
+  804a34:	68 55 5b 80 00       	push   $0x805b55
+  804a39:	e8 13 bc ff ff       	call   800651 <_panic>
+	mutex_unlock(&sfork_lock);
+  804a3e:	83 ec 0c             	sub    $0xc,%esp
+  804a41:	68 80 bf 80 00       	push   $0x80bf80
+  804a46:	e8 9f fa ff ff       	call   8044ea <mutex_unlock>
+}
+  804a4b:	83 c4 10             	add    $0x10,%esp
+  804a4e:	e9 39 ff ff ff       	jmp    80498c <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  804a53:	50                   	push   %eax
+  804a54:	68 97 5b 80 00       	push   $0x805b97
+  804a59:	68 91 00 00 00       	push   $0x91
+  804a5e:	68 55 5b 80 00       	push   $0x805b55
+  804a63:	e8 e9 bb ff ff       	call   800651 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804a68:	e8 ac c7 ff ff       	call   801219 <sys_getenvid>
+  804a6d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804a72:	89 e1                	mov    %esp,%ecx
+  804a74:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  804a79:	29 ca                	sub    %ecx,%edx
+  804a7b:	89 d1                	mov    %edx,%ecx
+  804a7d:	c1 e9 0f             	shr    $0xf,%ecx
+  804a80:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  804a86:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a8b:	0f 42 d1             	cmovb  %ecx,%edx
+  804a8e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804a94:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a99:	89 04 95 a0 bf 80 00 	mov    %eax,0x80bfa0(,%edx,4)
+		if(sforked)
+  804aa0:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  804aa5:	85 c0                	test   %eax,%eax
+  804aa7:	75 07                	jne    804ab0 <fork+0x143>
+		return 0;
+  804aa9:	89 c6                	mov    %eax,%esi
+  804aab:	e9 6f 02 00 00       	jmp    804d1f <fork+0x3b2>
+  804ab0:	89 e2                	mov    %esp,%edx
+  804ab2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804ab7:	29 d0                	sub    %edx,%eax
+  804ab9:	89 c3                	mov    %eax,%ebx
+  804abb:	c1 eb 0f             	shr    $0xf,%ebx
+  804abe:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac8:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  804acb:	83 ec 04             	sub    $0x4,%esp
+  804ace:	68 80 00 00 00       	push   $0x80
+  804ad3:	6a 00                	push   $0x0
+  804ad5:	68 00 bf 80 00       	push   $0x80bf00
+  804ada:	e8 bf c4 ff ff       	call   800f9e <memset>
+	thread_ids[slot] = sys_getenvid();
+  804adf:	e8 35 c7 ff ff       	call   801219 <sys_getenvid>
+  804ae4:	89 04 9d 00 bf 80 00 	mov    %eax,0x80bf00(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  804aeb:	8b 04 9d a0 bf 80 00 	mov    0x80bfa0(,%ebx,4),%eax
+  804af2:	a3 a0 bf 80 00       	mov    %eax,0x80bfa0
+	mutex_init(&sfork_lock);
+  804af7:	c7 04 24 80 bf 80 00 	movl   $0x80bf80,(%esp)
+  804afe:	e8 6b f9 ff ff       	call   80446e <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804b03:	83 c4 0c             	add    $0xc,%esp
+  804b06:	68 07 04 00 00       	push   $0x407
+  804b0b:	68 00 00 00 e1       	push   $0xe1000000
+  804b10:	6a 00                	push   $0x0
+  804b12:	e8 40 c7 ff ff       	call   801257 <sys_page_alloc>
+  804b17:	83 c4 10             	add    $0x10,%esp
+  804b1a:	85 c0                	test   %eax,%eax
+  804b1c:	0f 89 fd 01 00 00    	jns    804d1f <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  804b22:	50                   	push   %eax
+  804b23:	68 60 5b 80 00       	push   $0x805b60
+  804b28:	68 12 01 00 00       	push   $0x112
+  804b2d:	68 55 5b 80 00       	push   $0x805b55
+  804b32:	e8 1a bb ff ff       	call   800651 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  804b37:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  804b3d:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  804b43:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  804b49:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804b4f:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  804b55:	0f 87 4f 01 00 00    	ja     804caa <fork+0x33d>
+		pd = PDX(addr);
+  804b5b:	89 d8                	mov    %ebx,%eax
+  804b5d:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  804b60:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804b67:	f6 c2 01             	test   $0x1,%dl
+  804b6a:	74 cb                	je     804b37 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  804b6c:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  804b71:	0f 85 92 00 00 00    	jne    804c09 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  804b77:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  804b7d:	76 10                	jbe    804b8f <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  804b7f:	89 d8                	mov    %ebx,%eax
+  804b81:	f7 d8                	neg    %eax
+  804b83:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  804b88:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  804b8d:	74 ba                	je     804b49 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  804b8f:	89 d8                	mov    %ebx,%eax
+  804b91:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  804b94:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  804b9b:	f6 c2 01             	test   $0x1,%dl
+  804b9e:	74 a9                	je     804b49 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  804ba0:	89 c1                	mov    %eax,%ecx
+  804ba2:	c1 e1 0c             	shl    $0xc,%ecx
+  804ba5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  804ba8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  804baf:	f6 c6 04             	test   $0x4,%dh
+  804bb2:	0f 85 8e 00 00 00    	jne    804c46 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  804bb8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  804bbf:	f6 c6 08             	test   $0x8,%dh
+  804bc2:	75 0f                	jne    804bd3 <fork+0x266>
+  804bc4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804bcb:	a8 02                	test   $0x2,%al
+  804bcd:	0f 84 bb 00 00 00    	je     804c8e <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  804bd3:	83 ec 08             	sub    $0x8,%esp
+  804bd6:	68 05 08 00 00       	push   $0x805
+  804bdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804bde:	50                   	push   %eax
+  804bdf:	56                   	push   %esi
+  804be0:	50                   	push   %eax
+  804be1:	6a 00                	push   $0x0
+  804be3:	68 e0 bb 80 00       	push   $0x80bbe0
+  804be8:	e8 99 f7 ff ff       	call   804386 <pgbatch_map>
+  804bed:	83 c4 20             	add    $0x20,%esp
+  804bf0:	85 c0                	test   %eax,%eax
+  804bf2:	79 76                	jns    804c6a <fork+0x2fd>
+			panic("duppage: %e", ret);
+  804bf4:	50                   	push   %eax
+  804bf5:	68 bb 5b 80 00       	push   $0x805bbb
+  804bfa:	68 bc 00 00 00       	push   $0xbc
+  804bff:	68 55 5b 80 00       	push   $0x805b55
+  804c04:	e8 48 ba ff ff       	call   800651 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  804c09:	83 ec 0c             	sub    $0xc,%esp
+  804c0c:	68 00 08 00 00       	push   $0x800
+  804c11:	56                   	push   %esi
+  804c12:	53                   	push   %ebx
+  804c13:	6a 00                	push   $0x0
+  804c15:	68 e0 bb 80 00       	push   $0x80bbe0
+  804c1a:	e8 12 f8 ff ff       	call   804431 <pgbatch_sharept>
+  804c1f:	83 c4 20             	add    $0x20,%esp
+  804c22:	85 c0                	test   %eax,%eax
+  804c24:	78 0b                	js     804c31 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  804c26:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  804c2c:	e9 18 ff ff ff       	jmp    804b49 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  804c31:	50                   	push   %eax
+  804c32:	68 a7 5b 80 00       	push   $0x805ba7
+  804c37:	68 b2 00 00 00       	push   $0xb2
+  804c3c:	68 55 5b 80 00       	push   $0x805b55
+  804c41:	e8 0b ba ff ff       	call   800651 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  804c46:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804c4d:	83 ec 08             	sub    $0x8,%esp
+  804c50:	25 07 0e 00 00       	and    $0xe07,%eax
+  804c55:	50                   	push   %eax
+  804c56:	51                   	push   %ecx
+  804c57:	56                   	push   %esi
+  804c58:	51                   	push   %ecx
+  804c59:	6a 00                	push   $0x0
+  804c5b:	68 e0 bb 80 00       	push   $0x80bbe0
+  804c60:	e8 21 f7 ff ff       	call   804386 <pgbatch_map>
+  804c65:	83 c4 20             	add    $0x20,%esp
+  804c68:	eb 17                	jmp    804c81 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  804c6a:	68 05 08 00 00       	push   $0x805
+  804c6f:	ff 75 e4             	push   -0x1c(%ebp)
+  804c72:	6a 00                	push   $0x0
+  804c74:	68 e0 bb 80 00       	push   $0x80bbe0
+  804c79:	e8 7c f7 ff ff       	call   8043fa <pgbatch_protect>
+  804c7e:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  804c81:	85 c0                	test   %eax,%eax
+  804c83:	0f 89 c0 fe ff ff    	jns    804b49 <fork+0x1dc>
+  804c89:	e9 66 ff ff ff       	jmp    804bf4 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  804c8e:	83 ec 08             	sub    $0x8,%esp
+  804c91:	6a 05                	push   $0x5
+  804c93:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804c96:	50                   	push   %eax
+  804c97:	56                   	push   %esi
+  804c98:	50                   	push   %eax
+  804c99:	6a 00                	push   $0x0
+  804c9b:	68 e0 bb 80 00       	push   $0x80bbe0
+  804ca0:	e8 e1 f6 ff ff       	call   804386 <pgbatch_map>
+  804ca5:	83 c4 20             	add    $0x20,%esp
+  804ca8:	eb d7                	jmp    804c81 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  804caa:	6a 07                	push   $0x7
+  804cac:	68 00 f0 bf ee       	push   $0xeebff000
+  804cb1:	57                   	push   %edi
+  804cb2:	68 e0 bb 80 00       	push   $0x80bbe0
+  804cb7:	e8 93 f6 ff ff       	call   80434f <pgbatch_alloc>
+  804cbc:	83 c4 10             	add    $0x10,%esp
+  804cbf:	85 c0                	test   %eax,%eax
+  804cc1:	78 66                	js     804d29 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  804cc3:	83 ec 0c             	sub    $0xc,%esp
+  804cc6:	68 e0 bb 80 00       	push   $0x80bbe0
+  804ccb:	e8 06 f6 ff ff       	call   8042d6 <pgbatch_flush>
+  804cd0:	83 c4 10             	add    $0x10,%esp
+  804cd3:	85 c0                	test   %eax,%eax
+  804cd5:	78 52                	js     804d29 <fork+0x3bc>
+  804cd7:	89 e2                	mov    %esp,%edx
+  804cd9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804cde:	29 d0                	sub    %edx,%eax
+  804ce0:	89 c2                	mov    %eax,%edx
+  804ce2:	c1 ea 0f             	shr    $0xf,%edx
+  804ce5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cef:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  804cf2:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  804cf9:	8b 40 78             	mov    0x78(%eax),%eax
+  804cfc:	83 ec 08             	sub    $0x8,%esp
+  804cff:	50                   	push   %eax
+  804d00:	57                   	push   %edi
+  804d01:	e8 9c c6 ff ff       	call   8013a2 <sys_env_set_pgfault_upcall>
+  804d06:	83 c4 10             	add    $0x10,%esp
+  804d09:	85 c0                	test   %eax,%eax
+  804d0b:	78 31                	js     804d3e <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  804d0d:	83 ec 08             	sub    $0x8,%esp
+  804d10:	6a 02                	push   $0x2
+  804d12:	57                   	push   %edi
+  804d13:	e8 06 c6 ff ff       	call   80131e <sys_env_set_status>
+  804d18:	83 c4 10             	add    $0x10,%esp
+  804d1b:	85 c0                	test   %eax,%eax
+  804d1d:	78 34                	js     804d53 <fork+0x3e6>
+}
+  804d1f:	89 f0                	mov    %esi,%eax
+  804d21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d24:	5b                   	pop    %ebx
+  804d25:	5e                   	pop    %esi
+  804d26:	5f                   	pop    %edi
+  804d27:	5d                   	pop    %ebp
+  804d28:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  804d29:	50                   	push   %eax
+  804d2a:	68 c7 5b 80 00       	push   $0x805bc7
+  804d2f:	68 c0 00 00 00       	push   $0xc0
+  804d34:	68 55 5b 80 00       	push   $0x805b55
+  804d39:	e8 13 b9 ff ff       	call   800651 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  804d3e:	50                   	push   %eax
+  804d3f:	68 dc 5b 80 00       	push   $0x805bdc
+  804d44:	68 c2 00 00 00       	push   $0xc2
+  804d49:	68 55 5b 80 00       	push   $0x805b55
+  804d4e:	e8 fe b8 ff ff       	call   800651 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  804d53:	50                   	push   %eax
+  804d54:	68 f7 5b 80 00       	push   $0x805bf7
+  804d59:	68 c4 00 00 00       	push   $0xc4
+  804d5e:	68 55 5b 80 00       	push   $0x805b55
+  804d63:	e8 e9 b8 ff ff       	call   800651 <_panic>
+
+00804d68 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  804d68:	55                   	push   %ebp
+  804d69:	89 e5                	mov    %esp,%ebp
+  804d6b:	57                   	push   %edi
+  804d6c:	56                   	push   %esi
+  804d6d:	53                   	push   %ebx
+  804d6e:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  804d71:	68 80 bf 80 00       	push   $0x80bf80
+  804d76:	e8 01 f7 ff ff       	call   80447c <mutex_lock>
+  804d7b:	89 e2                	mov    %esp,%edx
+  804d7d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804d82:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  804d84:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  804d87:	89 c3                	mov    %eax,%ebx
+  804d89:	c1 eb 0f             	shr    $0xf,%ebx
+  804d8c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d96:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  804d99:	e8 7b c4 ff ff       	call   801219 <sys_getenvid>
+  804d9e:	89 04 9d 00 bf 80 00 	mov    %eax,0x80bf00(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  804da5:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804daa:	8b 04 9d 00 bf 80 00 	mov    0x80bf00(,%ebx,4),%eax
+  804db1:	e8 12 fa ff ff       	call   8047c8 <thread_alive>
+  804db6:	85 c0                	test   %eax,%eax
+  804db8:	74 24                	je     804dde <sfork+0x76>
+  804dba:	83 c3 01             	add    $0x1,%ebx
+  804dbd:	83 fb 20             	cmp    $0x20,%ebx
+  804dc0:	75 e8                	jne    804daa <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  804dc2:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  804dc7:	83 ec 0c             	sub    $0xc,%esp
+  804dca:	68 80 bf 80 00       	push   $0x80bf80
+  804dcf:	e8 16 f7 ff ff       	call   8044ea <mutex_unlock>
+	return r;
+}
+  804dd4:	89 f0                	mov    %esi,%eax
+  804dd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804dd9:	5b                   	pop    %ebx
+  804dda:	5e                   	pop    %esi
+  804ddb:	5f                   	pop    %edi
+  804ddc:	5d                   	pop    %ebp
+  804ddd:	c3                   	ret
+	if (i == NTHREADS) {
+  804dde:	83 fb 20             	cmp    $0x20,%ebx
+  804de1:	0f 84 53 01 00 00    	je     804f3a <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  804de7:	89 d8                	mov    %ebx,%eax
+  804de9:	c1 e0 0f             	shl    $0xf,%eax
+  804dec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  804def:	83 ec 0c             	sub    $0xc,%esp
+  804df2:	68 c0 b8 80 00       	push   $0x80b8c0
+  804df7:	e8 cc f4 ff ff       	call   8042c8 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  804dfc:	83 c4 10             	add    $0x10,%esp
+  804dff:	83 3d 04 f0 80 00 00 	cmpl   $0x0,0x80f004
+  804e06:	75 1f                	jne    804e27 <sfork+0xbf>
+  804e08:	68 07 04 00 00       	push   $0x407
+  804e0d:	68 00 00 00 e1       	push   $0xe1000000
+  804e12:	6a 00                	push   $0x0
+  804e14:	68 c0 b8 80 00       	push   $0x80b8c0
+  804e19:	e8 31 f5 ff ff       	call   80434f <pgbatch_alloc>
+  804e1e:	89 c6                	mov    %eax,%esi
+  804e20:	83 c4 10             	add    $0x10,%esp
+  804e23:	85 c0                	test   %eax,%eax
+  804e25:	78 a0                	js     804dc7 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  804e27:	6a 07                	push   $0x7
+  804e29:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  804e2e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804e31:	29 c8                	sub    %ecx,%eax
+  804e33:	50                   	push   %eax
+  804e34:	6a 00                	push   $0x0
+  804e36:	68 c0 b8 80 00       	push   $0x80b8c0
+  804e3b:	e8 0f f5 ff ff       	call   80434f <pgbatch_alloc>
+  804e40:	89 c6                	mov    %eax,%esi
+  804e42:	83 c4 10             	add    $0x10,%esp
+  804e45:	85 c0                	test   %eax,%eax
+  804e47:	0f 88 7a ff ff ff    	js     804dc7 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  804e4d:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  804e52:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804e55:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  804e57:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804e5c:	29 c8                	sub    %ecx,%eax
+  804e5e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804e61:	39 c7                	cmp    %eax,%edi
+  804e63:	73 29                	jae    804e8e <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  804e65:	6a 07                	push   $0x7
+  804e67:	57                   	push   %edi
+  804e68:	6a 00                	push   $0x0
+  804e6a:	68 c0 b8 80 00       	push   $0x80b8c0
+  804e6f:	e8 db f4 ff ff       	call   80434f <pgbatch_alloc>
+  804e74:	89 c6                	mov    %eax,%esi
+  804e76:	83 c4 10             	add    $0x10,%esp
+  804e79:	85 c0                	test   %eax,%eax
+  804e7b:	0f 88 46 ff ff ff    	js     804dc7 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  804e81:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804e87:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804e8a:	39 c7                	cmp    %eax,%edi
+  804e8c:	72 d7                	jb     804e65 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  804e8e:	83 ec 0c             	sub    $0xc,%esp
+  804e91:	68 c0 b8 80 00       	push   $0x80b8c0
+  804e96:	e8 3b f4 ff ff       	call   8042d6 <pgbatch_flush>
+  804e9b:	89 c6                	mov    %eax,%esi
+  804e9d:	83 c4 10             	add    $0x10,%esp
+  804ea0:	85 c0                	test   %eax,%eax
+  804ea2:	0f 88 1f ff ff ff    	js     804dc7 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  804ea8:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  804ead:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804eb0:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  804eb2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  804eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  804ebb:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  804ebe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804ec1:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  804ec4:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  804ec7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804ecc:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  804ece:	52                   	push   %edx
+  804ecf:	50                   	push   %eax
+  804ed0:	68 50 49 80 00       	push   $0x804950
+  804ed5:	e8 be c7 ff ff       	call   801698 <sys_exofork_shared>
+  804eda:	89 c6                	mov    %eax,%esi
+  804edc:	83 c4 10             	add    $0x10,%esp
+  804edf:	85 c0                	test   %eax,%eax
+  804ee1:	0f 88 e0 fe ff ff    	js     804dc7 <sfork+0x5f>
+	thread_ids[i] = id;
+  804ee7:	89 04 9d 00 bf 80 00 	mov    %eax,0x80bf00(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  804eee:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ef3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804ef9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804efe:	89 04 9d a0 bf 80 00 	mov    %eax,0x80bfa0(,%ebx,4)
+	sforked = 1;
+  804f05:	c7 05 04 f0 80 00 01 	movl   $0x1,0x80f004
+  804f0c:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  804f0f:	83 ec 08             	sub    $0x8,%esp
+  804f12:	6a 02                	push   $0x2
+  804f14:	56                   	push   %esi
+  804f15:	e8 04 c4 ff ff       	call   80131e <sys_env_set_status>
+  804f1a:	89 c3                	mov    %eax,%ebx
+  804f1c:	83 c4 10             	add    $0x10,%esp
+  804f1f:	85 c0                	test   %eax,%eax
+  804f21:	0f 89 a0 fe ff ff    	jns    804dc7 <sfork+0x5f>
+		sys_env_destroy(id);
+  804f27:	83 ec 0c             	sub    $0xc,%esp
+  804f2a:	56                   	push   %esi
+  804f2b:	e8 a8 c2 ff ff       	call   8011d8 <sys_env_destroy>
+		goto out;
+  804f30:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  804f33:	89 de                	mov    %ebx,%esi
+		goto out;
+  804f35:	e9 8d fe ff ff       	jmp    804dc7 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  804f3a:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  804f3f:	e9 83 fe ff ff       	jmp    804dc7 <sfork+0x5f>
+
+00804f44 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804f44:	55                   	push   %ebp
+  804f45:	89 e5                	mov    %esp,%ebp
+  804f47:	56                   	push   %esi
+  804f48:	53                   	push   %ebx
+  804f49:	8b 75 08             	mov    0x8(%ebp),%esi
+  804f4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804f4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804f52:	85 c0                	test   %eax,%eax
+  804f54:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804f59:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804f5c:	83 ec 0c             	sub    $0xc,%esp
+  804f5f:	50                   	push   %eax
+  804f60:	e8 a2 c4 ff ff       	call   801407 <sys_ipc_recv>
+  804f65:	83 c4 10             	add    $0x10,%esp
+  804f68:	85 c0                	test   %eax,%eax
+  804f6a:	0f 88 8b 00 00 00    	js     804ffb <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804f70:	85 f6                	test   %esi,%esi
+  804f72:	74 2a                	je     804f9e <ipc_recv+0x5a>
+  804f74:	89 e2                	mov    %esp,%edx
+  804f76:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804f7b:	29 d0                	sub    %edx,%eax
+  804f7d:	89 c2                	mov    %eax,%edx
+  804f7f:	c1 ea 0f             	shr    $0xf,%edx
+  804f82:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f8c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804f8f:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  804f96:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804f9c:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804f9e:	85 db                	test   %ebx,%ebx
+  804fa0:	74 2a                	je     804fcc <ipc_recv+0x88>
+  804fa2:	89 e2                	mov    %esp,%edx
+  804fa4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804fa9:	29 d0                	sub    %edx,%eax
+  804fab:	89 c2                	mov    %eax,%edx
+  804fad:	c1 ea 0f             	shr    $0xf,%edx
+  804fb0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fba:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804fbd:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  804fc4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804fca:	89 03                	mov    %eax,(%ebx)
+  804fcc:	89 e2                	mov    %esp,%edx
+  804fce:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804fd3:	29 d0                	sub    %edx,%eax
+  804fd5:	89 c2                	mov    %eax,%edx
+  804fd7:	c1 ea 0f             	shr    $0xf,%edx
+  804fda:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804fe7:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  804fee:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804ff4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804ff7:	5b                   	pop    %ebx
+  804ff8:	5e                   	pop    %esi
+  804ff9:	5d                   	pop    %ebp
+  804ffa:	c3                   	ret
+		if(from_env_store != NULL)
+  804ffb:	85 f6                	test   %esi,%esi
+  804ffd:	74 06                	je     805005 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804fff:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  805005:	85 db                	test   %ebx,%ebx
+  805007:	74 eb                	je     804ff4 <ipc_recv+0xb0>
+			*perm_store = 0;
+  805009:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80500f:	eb e3                	jmp    804ff4 <ipc_recv+0xb0>
+
+00805011 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  805011:	55                   	push   %ebp
+  805012:	89 e5                	mov    %esp,%ebp
+  805014:	57                   	push   %edi
+  805015:	56                   	push   %esi
+  805016:	53                   	push   %ebx
+  805017:	83 ec 14             	sub    $0x14,%esp
+  80501a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80501d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805020:	8b 75 14             	mov    0x14(%ebp),%esi
+  805023:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  805026:	85 c0                	test   %eax,%eax
+  805028:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80502d:	0f 44 c2             	cmove  %edx,%eax
+  805030:	ff 75 10             	push   0x10(%ebp)
+  805033:	50                   	push   %eax
+  805034:	e8 30 c4 ff ff       	call   801469 <sys_ipc_recv_pages>
+  805039:	83 c4 10             	add    $0x10,%esp
+  80503c:	85 c0                	test   %eax,%eax
+  80503e:	0f 88 ba 00 00 00    	js     8050fe <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  805044:	85 ff                	test   %edi,%edi
+  805046:	74 2a                	je     805072 <ipc_recv_pages+0x61>
+  805048:	89 e2                	mov    %esp,%edx
+  80504a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80504f:	29 d0                	sub    %edx,%eax
+  805051:	89 c2                	mov    %eax,%edx
+  805053:	c1 ea 0f             	shr    $0xf,%edx
+  805056:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80505b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805060:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  805063:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  80506a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805070:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  805072:	85 f6                	test   %esi,%esi
+  805074:	74 2a                	je     8050a0 <ipc_recv_pages+0x8f>
+  805076:	89 e2                	mov    %esp,%edx
+  805078:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80507d:	29 d0                	sub    %edx,%eax
+  80507f:	89 c2                	mov    %eax,%edx
+  805081:	c1 ea 0f             	shr    $0xf,%edx
+  805084:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  805089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80508e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  805091:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  805098:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80509e:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8050a0:	85 db                	test   %ebx,%ebx
+  8050a2:	74 2a                	je     8050ce <ipc_recv_pages+0xbd>
+  8050a4:	89 e2                	mov    %esp,%edx
+  8050a6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8050ab:	29 d0                	sub    %edx,%eax
+  8050ad:	89 c2                	mov    %eax,%edx
+  8050af:	c1 ea 0f             	shr    $0xf,%edx
+  8050b2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8050b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050bc:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8050bf:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  8050c6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8050cc:	89 03                	mov    %eax,(%ebx)
+  8050ce:	89 e2                	mov    %esp,%edx
+  8050d0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8050d5:	29 d0                	sub    %edx,%eax
+  8050d7:	89 c2                	mov    %eax,%edx
+  8050d9:	c1 ea 0f             	shr    $0xf,%edx
+  8050dc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8050e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050e6:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8050e9:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  8050f0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8050f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8050f9:	5b                   	pop    %ebx
+  8050fa:	5e                   	pop    %esi
+  8050fb:	5f                   	pop    %edi
+  8050fc:	5d                   	pop    %ebp
+  8050fd:	c3                   	ret
+		if (from_env_store)
+  8050fe:	85 ff                	test   %edi,%edi
+  805100:	74 06                	je     805108 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  805102:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  805108:	85 f6                	test   %esi,%esi
+  80510a:	74 06                	je     805112 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80510c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  805112:	85 db                	test   %ebx,%ebx
+  805114:	74 e0                	je     8050f6 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  805116:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80511c:	eb d8                	jmp    8050f6 <ipc_recv_pages+0xe5>
+
+0080511e <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80511e:	55                   	push   %ebp
+  80511f:	89 e5                	mov    %esp,%ebp
+  805121:	57                   	push   %edi
+  805122:	56                   	push   %esi
+  805123:	53                   	push   %ebx
+  805124:	83 ec 1c             	sub    $0x1c,%esp
+  805127:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80512a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80512d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  805133:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  805137:	75 2b                	jne    805164 <ipc_try_send_pages+0x46>
+  805139:	89 e2                	mov    %esp,%edx
+  80513b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  805140:	29 d0                	sub    %edx,%eax
+  805142:	89 c2                	mov    %eax,%edx
+  805144:	c1 ea 0f             	shr    $0xf,%edx
+  805147:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80514c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805151:	0f 42 c2             	cmovb  %edx,%eax
+  805154:	8b 04 85 a0 bf 80 00 	mov    0x80bfa0(,%eax,4),%eax
+  80515b:	8b 70 48             	mov    0x48(%eax),%esi
+  80515e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  805164:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80516a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80516f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805172:	85 ff                	test   %edi,%edi
+  805174:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  805179:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80517c:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  805182:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  805188:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80518e:	83 ec 0c             	sub    $0xc,%esp
+  805191:	ff 75 14             	push   0x14(%ebp)
+  805194:	ff 75 18             	push   0x18(%ebp)
+  805197:	57                   	push   %edi
+  805198:	ff 75 0c             	push   0xc(%ebp)
+  80519b:	ff 75 08             	push   0x8(%ebp)
+  80519e:	e8 a5 c2 ff ff       	call   801448 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8051a3:	83 c4 20             	add    $0x20,%esp
+  8051a6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8051a9:	75 21                	jne    8051cc <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8051ab:	83 ec 04             	sub    $0x4,%esp
+  8051ae:	6a ff                	push   $0xffffffff
+  8051b0:	53                   	push   %ebx
+  8051b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8051b4:	e8 9c c4 ff ff       	call   801655 <sys_futex_wait>
+  8051b9:	83 c4 10             	add    $0x10,%esp
+  8051bc:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8051bf:	74 c7                	je     805188 <ipc_try_send_pages+0x6a>
+  8051c1:	85 c0                	test   %eax,%eax
+  8051c3:	79 c3                	jns    805188 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8051c5:	e8 6e c0 ff ff       	call   801238 <sys_yield>
+  8051ca:	eb bc                	jmp    805188 <ipc_try_send_pages+0x6a>
+	}
+}
+  8051cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051cf:	5b                   	pop    %ebx
+  8051d0:	5e                   	pop    %esi
+  8051d1:	5f                   	pop    %edi
+  8051d2:	5d                   	pop    %ebp
+  8051d3:	c3                   	ret
+
+008051d4 <ipc_send>:
+{
+  8051d4:	55                   	push   %ebp
+  8051d5:	89 e5                	mov    %esp,%ebp
+  8051d7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8051da:	ff 75 14             	push   0x14(%ebp)
+  8051dd:	6a 01                	push   $0x1
+  8051df:	ff 75 10             	push   0x10(%ebp)
+  8051e2:	ff 75 0c             	push   0xc(%ebp)
+  8051e5:	ff 75 08             	push   0x8(%ebp)
+  8051e8:	e8 31 ff ff ff       	call   80511e <ipc_try_send_pages>
+  8051ed:	83 c4 20             	add    $0x20,%esp
+  8051f0:	85 c0                	test   %eax,%eax
+  8051f2:	78 02                	js     8051f6 <ipc_send+0x22>
+}
+  8051f4:	c9                   	leave
+  8051f5:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8051f6:	50                   	push   %eax
+  8051f7:	68 2f 5c 80 00       	push   $0x805c2f
+  8051fc:	6a 3f                	push   $0x3f
+  8051fe:	68 44 5c 80 00       	push   $0x805c44
+  805203:	e8 49 b4 ff ff       	call   800651 <_panic>
+
+00805208 <ipc_send_pages>:
+{
+  805208:	55                   	push   %ebp
+  805209:	89 e5                	mov    %esp,%ebp
+  80520b:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80520e:	ff 75 18             	push   0x18(%ebp)
+  805211:	ff 75 14             	push   0x14(%ebp)
+  805214:	ff 75 10             	push   0x10(%ebp)
+  805217:	ff 75 0c             	push   0xc(%ebp)
+  80521a:	ff 75 08             	push   0x8(%ebp)
+  80521d:	e8 fc fe ff ff       	call   80511e <ipc_try_send_pages>
+  805222:	83 c4 20             	add    $0x20,%esp
+  805225:	85 c0                	test   %eax,%eax
+  805227:	78 02                	js     80522b <ipc_send_pages+0x23>
+}
+  805229:	c9                   	leave
+  80522a:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80522b:	50                   	push   %eax
+  80522c:	68 4e 5c 80 00       	push   $0x805c4e
+  805231:	6a 64                	push   $0x64
+  805233:	68 44 5c 80 00       	push   $0x805c44
+  805238:	e8 14 b4 ff ff       	call   800651 <_panic>
+
+0080523d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80523d:	55                   	push   %ebp
+  80523e:	89 e5                	mov    %esp,%ebp
+  805240:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805243:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  805248:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80524e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  805254:	8b 52 50             	mov    0x50(%edx),%edx
+  805257:	39 ca                	cmp    %ecx,%edx
+  805259:	74 11                	je     80526c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80525b:	83 c0 01             	add    $0x1,%eax
+  80525e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  805263:	75 e3                	jne    805248 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80526a:	eb 0e                	jmp    80527a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80526c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  805272:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805277:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80527a:	5d                   	pop    %ebp
+  80527b:	c3                   	ret
+
+0080527c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80527c:	55                   	push   %ebp
+  80527d:	89 e5                	mov    %esp,%ebp
+  80527f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  805282:	89 c2                	mov    %eax,%edx
+  805284:	c1 ea 16             	shr    $0x16,%edx
+  805287:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80528e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  805293:	f6 c1 01             	test   $0x1,%cl
+  805296:	74 1e                	je     8052b6 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  805298:	c1 e8 0c             	shr    $0xc,%eax
+  80529b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8052a2:	a8 01                	test   $0x1,%al
+  8052a4:	74 10                	je     8052b6 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8052a6:	c1 e8 0c             	shr    $0xc,%eax
+  8052a9:	c1 e0 04             	shl    $0x4,%eax
+  8052ac:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8052b3:	0f b7 d2             	movzwl %dx,%edx
+}
+  8052b6:	89 d0                	mov    %edx,%eax
+  8052b8:	5d                   	pop    %ebp
+  8052b9:	c3                   	ret
+
+008052ba <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8052ba:	55                   	push   %ebp
+  8052bb:	89 e5                	mov    %esp,%ebp
+  8052bd:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8052c0:	83 3d 08 f0 80 00 00 	cmpl   $0x0,0x80f008
+  8052c7:	74 0a                	je     8052d3 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8052c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8052cc:	a3 08 f0 80 00       	mov    %eax,0x80f008
+}
+  8052d1:	c9                   	leave
+  8052d2:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8052d3:	83 ec 04             	sub    $0x4,%esp
+  8052d6:	6a 07                	push   $0x7
+  8052d8:	68 00 f0 bf ee       	push   $0xeebff000
+  8052dd:	6a 00                	push   $0x0
+  8052df:	e8 73 bf ff ff       	call   801257 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8052e4:	83 c4 08             	add    $0x8,%esp
+  8052e7:	68 f8 52 80 00       	push   $0x8052f8
+  8052ec:	6a 00                	push   $0x0
+  8052ee:	e8 af c0 ff ff       	call   8013a2 <sys_env_set_pgfault_upcall>
+  8052f3:	83 c4 10             	add    $0x10,%esp
+  8052f6:	eb d1                	jmp    8052c9 <set_pgfault_handler+0xf>
+
+008052f8 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8052f8:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8052f9:	a1 08 f0 80 00       	mov    0x80f008,%eax
+	call *%eax
+  8052fe:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805300:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  805303:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  805307:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80530a:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  80530e:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  805310:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  805314:	83 c4 08             	add    $0x8,%esp
+	popal;
+  805317:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  805318:	83 c4 04             	add    $0x4,%esp
+	popf
+  80531b:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80531c:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80531d:	c3                   	ret
+
+0080531e <__udivdi3>:
+  80531e:	57                   	push   %edi
+  80531f:	56                   	push   %esi
+  805320:	53                   	push   %ebx
+  805321:	83 ec 20             	sub    $0x20,%esp
+  805324:	8b 44 24 30          	mov    0x30(%esp),%eax
+  805328:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80532c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805330:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805334:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805338:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80533c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805340:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805344:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80534e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805353:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80535a:	00 
+  80535b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805362:	00 
+  805363:	eb 08                	jmp    80536d <__udivdi3+0x4f>
+  805365:	83 e9 01             	sub    $0x1,%ecx
+  805368:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80536b:	74 68                	je     8053d5 <__udivdi3+0xb7>
+  80536d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805371:	01 c0                	add    %eax,%eax
+  805373:	89 c6                	mov    %eax,%esi
+  805375:	89 d7                	mov    %edx,%edi
+  805377:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80537b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80537f:	0f ad d0             	shrd   %cl,%edx,%eax
+  805382:	d3 ea                	shr    %cl,%edx
+  805384:	f6 c1 20             	test   $0x20,%cl
+  805387:	74 04                	je     80538d <__udivdi3+0x6f>
+  805389:	89 d0                	mov    %edx,%eax
+  80538b:	31 d2                	xor    %edx,%edx
+  80538d:	83 e0 01             	and    $0x1,%eax
+  805390:	89 04 24             	mov    %eax,(%esp)
+  805393:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80539a:	00 
+  80539b:	8b 04 24             	mov    (%esp),%eax
+  80539e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8053a2:	09 f0                	or     %esi,%eax
+  8053a4:	09 fa                	or     %edi,%edx
+  8053a6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8053aa:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8053ae:	39 f0                	cmp    %esi,%eax
+  8053b0:	89 d3                	mov    %edx,%ebx
+  8053b2:	19 fb                	sbb    %edi,%ebx
+  8053b4:	72 af                	jb     805365 <__udivdi3+0x47>
+  8053b6:	29 f0                	sub    %esi,%eax
+  8053b8:	19 fa                	sbb    %edi,%edx
+  8053ba:	89 cf                	mov    %ecx,%edi
+  8053bc:	c1 ef 05             	shr    $0x5,%edi
+  8053bf:	83 e7 01             	and    $0x1,%edi
+  8053c2:	89 fe                	mov    %edi,%esi
+  8053c4:	83 f6 01             	xor    $0x1,%esi
+  8053c7:	d3 e6                	shl    %cl,%esi
+  8053c9:	d3 e7                	shl    %cl,%edi
+  8053cb:	09 74 24 18          	or     %esi,0x18(%esp)
+  8053cf:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8053d3:	eb 90                	jmp    805365 <__udivdi3+0x47>
+  8053d5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8053d9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8053dd:	83 c4 20             	add    $0x20,%esp
+  8053e0:	5b                   	pop    %ebx
+  8053e1:	5e                   	pop    %esi
+  8053e2:	5f                   	pop    %edi
+  8053e3:	c3                   	ret
+
+008053e4 <__umoddi3>:
+  8053e4:	57                   	push   %edi
+  8053e5:	56                   	push   %esi
+  8053e6:	53                   	push   %ebx
+  8053e7:	83 ec 08             	sub    $0x8,%esp
+  8053ea:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8053ee:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8053f2:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8053f6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8053fa:	57                   	push   %edi
+  8053fb:	56                   	push   %esi
+  8053fc:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805400:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805404:	52                   	push   %edx
+  805405:	50                   	push   %eax
+  805406:	e8 13 ff ff ff       	call   80531e <__udivdi3>
+  80540b:	89 c3                	mov    %eax,%ebx
+  80540d:	0f af d6             	imul   %esi,%edx
+  805410:	89 f9                	mov    %edi,%ecx
+  805412:	0f af cb             	imul   %ebx,%ecx
+  805415:	01 d1                	add    %edx,%ecx
+  805417:	89 d8                	mov    %ebx,%eax
+  805419:	f7 e6                	mul    %esi
+  80541b:	89 c6                	mov    %eax,%esi
+  80541d:	89 d7                	mov    %edx,%edi
+  80541f:	01 cf                	add    %ecx,%edi
+  805421:	8b 44 24 10          	mov    0x10(%esp),%eax
+  805425:	8b 54 24 14          	mov    0x14(%esp),%edx
+  805429:	29 f0                	sub    %esi,%eax
+  80542b:	19 fa                	sbb    %edi,%edx
+  80542d:	83 c4 18             	add    $0x18,%esp
+  805430:	5b                   	pop    %ebx
+  805431:	5e                   	pop    %esi
+  805432:	5f                   	pop    %edi
+  805433:	c3                   	ret
+
+00805434 <__divdi3>:
+  805434:	53                   	push   %ebx
+  805435:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805439:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80543d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  805441:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  805445:	85 d2                	test   %edx,%edx
+  805447:	78 12                	js     80545b <__divdi3+0x27>
+  805449:	85 db                	test   %ebx,%ebx
+  80544b:	78 2e                	js     80547b <__divdi3+0x47>
+  80544d:	53                   	push   %ebx
+  80544e:	51                   	push   %ecx
+  80544f:	52                   	push   %edx
+  805450:	50                   	push   %eax
+  805451:	e8 c8 fe ff ff       	call   80531e <__udivdi3>
+  805456:	83 c4 10             	add    $0x10,%esp
+  805459:	eb 1e                	jmp    805479 <__divdi3+0x45>
+  80545b:	f7 d8                	neg    %eax
+  80545d:	83 d2 00             	adc    $0x0,%edx
+  805460:	f7 da                	neg    %edx
+  805462:	85 db                	test   %ebx,%ebx
+  805464:	78 2a                	js     805490 <__divdi3+0x5c>
+  805466:	53                   	push   %ebx
+  805467:	51                   	push   %ecx
+  805468:	52                   	push   %edx
+  805469:	50                   	push   %eax
+  80546a:	e8 af fe ff ff       	call   80531e <__udivdi3>
+  80546f:	83 c4 10             	add    $0x10,%esp
+  805472:	f7 d8                	neg    %eax
+  805474:	83 d2 00             	adc    $0x0,%edx
+  805477:	f7 da                	neg    %edx
+  805479:	5b                   	pop    %ebx
+  80547a:	c3                   	ret
+  80547b:	f7 d9                	neg    %ecx
+  80547d:	83 d3 00             	adc    $0x0,%ebx
+  805480:	f7 db                	neg    %ebx
+  805482:	53                   	push   %ebx
+  805483:	51                   	push   %ecx
+  805484:	52                   	push   %edx
+  805485:	50                   	push   %eax
+  805486:	e8 93 fe ff ff       	call   80531e <__udivdi3>
+  80548b:	83 c4 10             	add    $0x10,%esp
+  80548e:	eb e2                	jmp    805472 <__divdi3+0x3e>
+  805490:	f7 d9                	neg    %ecx
+  805492:	83 d3 00             	adc    $0x0,%ebx
+  805495:	f7 db                	neg    %ebx
+  805497:	53                   	push   %ebx
+  805498:	51                   	push   %ecx
+  805499:	52                   	push   %edx
+  80549a:	50                   	push   %eax
+  80549b:	e8 7e fe ff ff       	call   80531e <__udivdi3>
+  8054a0:	83 c4 10             	add    $0x10,%esp
+  8054a3:	eb d4                	jmp    805479 <__divdi3+0x45>
+
+008054a5 <__moddi3>:
+  8054a5:	57                   	push   %edi
+  8054a6:	56                   	push   %esi
+  8054a7:	53                   	push   %ebx
+  8054a8:	83 ec 08             	sub    $0x8,%esp
+  8054ab:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8054af:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8054b3:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8054b7:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8054bb:	57                   	push   %edi
+  8054bc:	56                   	push   %esi
+  8054bd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8054c1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8054c5:	52                   	push   %edx
+  8054c6:	50                   	push   %eax
+  8054c7:	e8 68 ff ff ff       	call   805434 <__divdi3>
+  8054cc:	89 c3                	mov    %eax,%ebx
+  8054ce:	0f af d6             	imul   %esi,%edx
+  8054d1:	89 f9                	mov    %edi,%ecx
+  8054d3:	0f af cb             	imul   %ebx,%ecx
+  8054d6:	01 d1                	add    %edx,%ecx
+  8054d8:	89 d8                	mov    %ebx,%eax
+  8054da:	f7 e6                	mul    %esi
+  8054dc:	89 c6                	mov    %eax,%esi
+  8054de:	89 d7                	mov    %edx,%edi
+  8054e0:	01 cf                	add    %ecx,%edi
+  8054e2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8054e6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8054ea:	29 f0                	sub    %esi,%eax
+  8054ec:	19 fa                	sbb    %edi,%edx
+  8054ee:	83 c4 18             	add    $0x18,%esp
+  8054f1:	5b                   	pop    %ebx
+  8054f2:	5e                   	pop    %esi
+  8054f3:	5f                   	pop    %edi
+  8054f4:	c3                   	ret
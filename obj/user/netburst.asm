@@ -0,0 +1,7975 @@
+
+obj/user/netburst.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1c 01 00 00       	call   80014d <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#define IDLE_MS	1000
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	81 ec e8 00 00 00    	sub    $0xe8,%esp
+	struct NetStats ns0, ns;
+	uint32_t last, got, missed;
+	unsigned quiet;
+
+	binaryname = "netburst";
+  800041:	c7 05 00 50 80 00 a0 	movl   $0x803ba0,0x805000
+  800048:	3b 80 00 
+
+	sys_net_stats(&ns0);
+  80004b:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  80004e:	50                   	push   %eax
+  80004f:	e8 97 10 00 00       	call   8010eb <sys_net_stats>
+	cprintf("netburst: %u tx and %u rx descriptors\n",
+  800054:	83 c4 0c             	add    $0xc,%esp
+  800057:	ff 75 b4             	push   -0x4c(%ebp)
+  80005a:	ff 75 a8             	push   -0x58(%ebp)
+  80005d:	68 bc 3b 80 00       	push   $0x803bbc
+  800062:	e8 22 02 00 00       	call   800289 <cprintf>
+		ns0.ns_tx_ring, ns0.ns_rx_ring);
+	cprintf("netburst: ready\n");
+  800067:	c7 04 24 a9 3b 80 00 	movl   $0x803ba9,(%esp)
+  80006e:	e8 16 02 00 00       	call   800289 <cprintf>
+
+	// Wait for the burst to start, then for it to end.
+	last = ns0.ns_rx_packets;
+  800073:	8b 75 8c             	mov    -0x74(%ebp),%esi
+	quiet = sys_time_msec();
+  800076:	e8 8d 0f 00 00       	call   801008 <sys_time_msec>
+  80007b:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+  800081:	83 c4 10             	add    $0x10,%esp
+	for (;;) {
+		sys_yield();
+		sys_net_stats(&ns);
+  800084:	8d bd 30 ff ff ff    	lea    -0xd0(%ebp),%edi
+  80008a:	eb 0d                	jmp    800099 <umain+0x64>
+		if (ns.ns_rx_packets != last) {
+			last = ns.ns_rx_packets;
+			quiet = sys_time_msec();
+  80008c:	e8 77 0f 00 00       	call   801008 <sys_time_msec>
+  800091:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+			last = ns.ns_rx_packets;
+  800097:	89 de                	mov    %ebx,%esi
+		sys_yield();
+  800099:	e8 f7 0c 00 00       	call   800d95 <sys_yield>
+		sys_net_stats(&ns);
+  80009e:	83 ec 0c             	sub    $0xc,%esp
+  8000a1:	57                   	push   %edi
+  8000a2:	e8 44 10 00 00       	call   8010eb <sys_net_stats>
+		if (ns.ns_rx_packets != last) {
+  8000a7:	8b 9d 30 ff ff ff    	mov    -0xd0(%ebp),%ebx
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	39 f3                	cmp    %esi,%ebx
+  8000b2:	75 d8                	jne    80008c <umain+0x57>
+		} else if (last != ns0.ns_rx_packets
+  8000b4:	39 75 8c             	cmp    %esi,-0x74(%ebp)
+  8000b7:	74 e0                	je     800099 <umain+0x64>
+			   && sys_time_msec() - quiet >= IDLE_MS)
+  8000b9:	e8 4a 0f 00 00       	call   801008 <sys_time_msec>
+  8000be:	8b 8d 24 ff ff ff    	mov    -0xdc(%ebp),%ecx
+  8000c4:	29 c8                	sub    %ecx,%eax
+  8000c6:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+  8000cb:	76 cc                	jbe    800099 <umain+0x64>
+			break;
+	}
+
+	got = ns.ns_rx_packets - ns0.ns_rx_packets;
+  8000cd:	8b b5 30 ff ff ff    	mov    -0xd0(%ebp),%esi
+  8000d3:	2b 75 8c             	sub    -0x74(%ebp),%esi
+	missed = ns.ns_rx_missed - ns0.ns_rx_missed;
+  8000d6:	8b 9d 48 ff ff ff    	mov    -0xb8(%ebp),%ebx
+  8000dc:	2b 5d a4             	sub    -0x5c(%ebp),%ebx
+	cprintf("netburst: %u packets received, %u dropped (%u.%u%%)\n",
+		got, missed, 100 * missed / (got + missed),
+		1000 * missed / (got + missed) % 10);
+  8000df:	8d 3c 1e             	lea    (%esi,%ebx,1),%edi
+	cprintf("netburst: %u packets received, %u dropped (%u.%u%%)\n",
+  8000e2:	83 ec 0c             	sub    $0xc,%esp
+		1000 * missed / (got + missed) % 10);
+  8000e5:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+  8000eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f0:	f7 f7                	div    %edi
+  8000f2:	89 c1                	mov    %eax,%ecx
+	cprintf("netburst: %u packets received, %u dropped (%u.%u%%)\n",
+  8000f4:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  8000f9:	f7 e2                	mul    %edx
+  8000fb:	c1 ea 03             	shr    $0x3,%edx
+  8000fe:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800101:	01 c0                	add    %eax,%eax
+  800103:	29 c1                	sub    %eax,%ecx
+  800105:	51                   	push   %ecx
+		got, missed, 100 * missed / (got + missed),
+  800106:	6b c3 64             	imul   $0x64,%ebx,%eax
+	cprintf("netburst: %u packets received, %u dropped (%u.%u%%)\n",
+  800109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010e:	f7 f7                	div    %edi
+  800110:	50                   	push   %eax
+  800111:	53                   	push   %ebx
+  800112:	56                   	push   %esi
+  800113:	68 e4 3b 80 00       	push   $0x803be4
+  800118:	e8 6c 01 00 00       	call   800289 <cprintf>
+	cprintf("netburst: rx ring held at most %u of %u, "
+  80011d:	83 c4 14             	add    $0x14,%esp
+  800120:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  800126:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80012c:	ff b5 58 ff ff ff    	push   -0xa8(%ebp)
+  800132:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  800138:	68 1c 3c 80 00       	push   $0x803c1c
+  80013d:	e8 47 01 00 00       	call   800289 <cprintf>
+		"tx ring at most %u of %u\n",
+		ns.ns_rx_ready_max, ns.ns_rx_ring,
+		ns.ns_tx_inuse_max, ns.ns_tx_ring);
+}
+  800142:	83 c4 20             	add    $0x20,%esp
+  800145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5f                   	pop    %edi
+  80014b:	5d                   	pop    %ebp
+  80014c:	c3                   	ret
+
+0080014d <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80014d:	55                   	push   %ebp
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	56                   	push   %esi
+  800151:	53                   	push   %ebx
+  800152:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800155:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800158:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80015a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80015f:	29 d0                	sub    %edx,%eax
+  800161:	89 c2                	mov    %eax,%edx
+  800163:	c1 ea 0f             	shr    $0xf,%edx
+  800166:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80016b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800170:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800173:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  80017a:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80017e:	e8 f3 0b 00 00       	call   800d76 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800183:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800188:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80018e:	89 e1                	mov    %esp,%ecx
+  800190:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800195:	29 ca                	sub    %ecx,%edx
+  800197:	89 d1                	mov    %edx,%ecx
+  800199:	c1 e9 0f             	shr    $0xf,%ecx
+  80019c:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8001a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a7:	0f 42 d1             	cmovb  %ecx,%edx
+  8001aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001af:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b6:	85 db                	test   %ebx,%ebx
+  8001b8:	7e 07                	jle    8001c1 <libmain+0x74>
+		binaryname = argv[0];
+  8001ba:	8b 06                	mov    (%esi),%eax
+  8001bc:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8001c1:	83 ec 08             	sub    $0x8,%esp
+  8001c4:	56                   	push   %esi
+  8001c5:	53                   	push   %ebx
+  8001c6:	e8 6a fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8001cb:	e8 0a 00 00 00       	call   8001da <exit>
+}
+  8001d0:	83 c4 10             	add    $0x10,%esp
+  8001d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001d6:	5b                   	pop    %ebx
+  8001d7:	5e                   	pop    %esi
+  8001d8:	5d                   	pop    %ebp
+  8001d9:	c3                   	ret
+
+008001da <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001da:	55                   	push   %ebp
+  8001db:	89 e5                	mov    %esp,%ebp
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001e0:	e8 1b 12 00 00       	call   801400 <close_all>
+	sys_env_destroy(0);
+  8001e5:	83 ec 0c             	sub    $0xc,%esp
+  8001e8:	6a 00                	push   $0x0
+  8001ea:	e8 46 0b 00 00       	call   800d35 <sys_env_destroy>
+}
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	c9                   	leave
+  8001f3:	c3                   	ret
+
+008001f4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	53                   	push   %ebx
+  8001f8:	83 ec 04             	sub    $0x4,%esp
+  8001fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001fe:	8b 13                	mov    (%ebx),%edx
+  800200:	8d 42 01             	lea    0x1(%edx),%eax
+  800203:	89 03                	mov    %eax,(%ebx)
+  800205:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800208:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80020c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800211:	74 09                	je     80021c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800213:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800217:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80021c:	83 ec 08             	sub    $0x8,%esp
+  80021f:	68 ff 00 00 00       	push   $0xff
+  800224:	8d 43 08             	lea    0x8(%ebx),%eax
+  800227:	50                   	push   %eax
+  800228:	e8 cb 0a 00 00       	call   800cf8 <sys_cputs>
+		b->idx = 0;
+  80022d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	eb db                	jmp    800213 <putch+0x1f>
+
+00800238 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800241:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800248:	00 00 00 
+	b.cnt = 0;
+  80024b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800252:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800255:	ff 75 0c             	push   0xc(%ebp)
+  800258:	ff 75 08             	push   0x8(%ebp)
+  80025b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800261:	50                   	push   %eax
+  800262:	68 f4 01 80 00       	push   $0x8001f4
+  800267:	e8 1c 01 00 00       	call   800388 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80026c:	83 c4 08             	add    $0x8,%esp
+  80026f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800275:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80027b:	50                   	push   %eax
+  80027c:	e8 77 0a 00 00       	call   800cf8 <sys_cputs>
+
+	return b.cnt;
+}
+  800281:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+00800289 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80028f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800292:	50                   	push   %eax
+  800293:	ff 75 08             	push   0x8(%ebp)
+  800296:	e8 9d ff ff ff       	call   800238 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80029b:	c9                   	leave
+  80029c:	c3                   	ret
+
+0080029d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	57                   	push   %edi
+  8002a1:	56                   	push   %esi
+  8002a2:	53                   	push   %ebx
+  8002a3:	83 ec 1c             	sub    $0x1c,%esp
+  8002a6:	89 c3                	mov    %eax,%ebx
+  8002a8:	89 d6                	mov    %edx,%esi
+  8002aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002b0:	89 d1                	mov    %edx,%ecx
+  8002b2:	89 c2                	mov    %eax,%edx
+  8002b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ba:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002c0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002c7:	39 c2                	cmp    %eax,%edx
+  8002c9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002cc:	73 4b                	jae    800319 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8002ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002d1:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8002d4:	85 ff                	test   %edi,%edi
+  8002d6:	7e 11                	jle    8002e9 <printnum+0x4c>
+			putch(padc, putdat);
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+  8002db:	56                   	push   %esi
+  8002dc:	ff 75 18             	push   0x18(%ebp)
+  8002df:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	83 ef 01             	sub    $0x1,%edi
+  8002e7:	75 ef                	jne    8002d8 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002e9:	83 ec 08             	sub    $0x8,%esp
+  8002ec:	56                   	push   %esi
+  8002ed:	83 ec 04             	sub    $0x4,%esp
+  8002f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f3:	ff 75 e0             	push   -0x20(%ebp)
+  8002f6:	ff 75 dc             	push   -0x24(%ebp)
+  8002f9:	ff 75 d8             	push   -0x28(%ebp)
+  8002fc:	e8 70 37 00 00       	call   803a71 <__umoddi3>
+  800301:	83 c4 14             	add    $0x14,%esp
+  800304:	0f be 80 69 3c 80 00 	movsbl 0x803c69(%eax),%eax
+  80030b:	50                   	push   %eax
+  80030c:	ff d3                	call   *%ebx
+}
+  80030e:	83 c4 10             	add    $0x10,%esp
+  800311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800314:	5b                   	pop    %ebx
+  800315:	5e                   	pop    %esi
+  800316:	5f                   	pop    %edi
+  800317:	5d                   	pop    %ebp
+  800318:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800319:	83 ec 0c             	sub    $0xc,%esp
+  80031c:	ff 75 18             	push   0x18(%ebp)
+  80031f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800322:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800325:	52                   	push   %edx
+  800326:	50                   	push   %eax
+  800327:	83 ec 08             	sub    $0x8,%esp
+  80032a:	ff 75 e4             	push   -0x1c(%ebp)
+  80032d:	ff 75 e0             	push   -0x20(%ebp)
+  800330:	ff 75 dc             	push   -0x24(%ebp)
+  800333:	ff 75 d8             	push   -0x28(%ebp)
+  800336:	e8 70 36 00 00       	call   8039ab <__udivdi3>
+  80033b:	83 c4 18             	add    $0x18,%esp
+  80033e:	52                   	push   %edx
+  80033f:	50                   	push   %eax
+  800340:	89 f2                	mov    %esi,%edx
+  800342:	89 d8                	mov    %ebx,%eax
+  800344:	e8 54 ff ff ff       	call   80029d <printnum>
+  800349:	83 c4 20             	add    $0x20,%esp
+  80034c:	eb 9b                	jmp    8002e9 <printnum+0x4c>
+
+0080034e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800354:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800358:	8b 10                	mov    (%eax),%edx
+  80035a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80035d:	73 0a                	jae    800369 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80035f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800362:	89 08                	mov    %ecx,(%eax)
+  800364:	8b 45 08             	mov    0x8(%ebp),%eax
+  800367:	88 02                	mov    %al,(%edx)
+}
+  800369:	5d                   	pop    %ebp
+  80036a:	c3                   	ret
+
+0080036b <printfmt>:
+{
+  80036b:	55                   	push   %ebp
+  80036c:	89 e5                	mov    %esp,%ebp
+  80036e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800371:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800374:	50                   	push   %eax
+  800375:	ff 75 10             	push   0x10(%ebp)
+  800378:	ff 75 0c             	push   0xc(%ebp)
+  80037b:	ff 75 08             	push   0x8(%ebp)
+  80037e:	e8 05 00 00 00       	call   800388 <vprintfmt>
+}
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	c9                   	leave
+  800387:	c3                   	ret
+
+00800388 <vprintfmt>:
+{
+  800388:	55                   	push   %ebp
+  800389:	89 e5                	mov    %esp,%ebp
+  80038b:	57                   	push   %edi
+  80038c:	56                   	push   %esi
+  80038d:	53                   	push   %ebx
+  80038e:	83 ec 2c             	sub    $0x2c,%esp
+  800391:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800394:	89 df                	mov    %ebx,%edi
+  800396:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800399:	8b 45 10             	mov    0x10(%ebp),%eax
+  80039c:	8d 70 01             	lea    0x1(%eax),%esi
+  80039f:	0f b6 00             	movzbl (%eax),%eax
+  8003a2:	83 f8 25             	cmp    $0x25,%eax
+  8003a5:	74 1e                	je     8003c5 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8003a7:	85 c0                	test   %eax,%eax
+  8003a9:	0f 84 15 05 00 00    	je     8008c4 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8003af:	83 ec 08             	sub    $0x8,%esp
+  8003b2:	53                   	push   %ebx
+  8003b3:	50                   	push   %eax
+  8003b4:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003b6:	83 c6 01             	add    $0x1,%esi
+  8003b9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003bd:	83 c4 10             	add    $0x10,%esp
+  8003c0:	83 f8 25             	cmp    $0x25,%eax
+  8003c3:	75 e2                	jne    8003a7 <vprintfmt+0x1f>
+		padc = ' ';
+  8003c5:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8003c9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003d0:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8003d7:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8003de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003e3:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e6:	8d 56 01             	lea    0x1(%esi),%edx
+  8003e9:	0f b6 0e             	movzbl (%esi),%ecx
+  8003ec:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003ef:	3c 55                	cmp    $0x55,%al
+  8003f1:	0f 87 3b 04 00 00    	ja     800832 <vprintfmt+0x4aa>
+  8003f7:	0f b6 c0             	movzbl %al,%eax
+  8003fa:	ff 24 85 e0 3d 80 00 	jmp    *0x803de0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800401:	89 75 10             	mov    %esi,0x10(%ebp)
+  800404:	eb 93                	jmp    800399 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800406:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800408:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80040c:	eb d8                	jmp    8003e6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040e:	89 d6                	mov    %edx,%esi
+  800410:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800414:	eb d0                	jmp    8003e6 <vprintfmt+0x5e>
+  800416:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800419:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80041c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80041f:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800423:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800426:	83 f9 09             	cmp    $0x9,%ecx
+  800429:	77 6f                	ja     80049a <vprintfmt+0x112>
+  80042b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80042e:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800431:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800434:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800438:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80043b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80043e:	83 fe 09             	cmp    $0x9,%esi
+  800441:	76 eb                	jbe    80042e <vprintfmt+0xa6>
+  800443:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800446:	89 d6                	mov    %edx,%esi
+  800448:	eb 13                	jmp    80045d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80044a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044d:	8b 00                	mov    (%eax),%eax
+  80044f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800452:	8b 45 14             	mov    0x14(%ebp),%eax
+  800455:	8d 40 04             	lea    0x4(%eax),%eax
+  800458:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80045b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80045d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800461:	79 83                	jns    8003e6 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800463:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800466:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800469:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800470:	e9 71 ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+			if (width < 0)
+  800475:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800478:	85 c9                	test   %ecx,%ecx
+  80047a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047f:	0f 49 c1             	cmovns %ecx,%eax
+  800482:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800485:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800487:	e9 5a ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80048c:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80048e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800495:	e9 4c ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049a:	89 d6                	mov    %edx,%esi
+  80049c:	eb bf                	jmp    80045d <vprintfmt+0xd5>
+			lflag++;
+  80049e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a2:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004a4:	e9 3d ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8004a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004af:	8d 70 04             	lea    0x4(%eax),%esi
+  8004b2:	83 ec 08             	sub    $0x8,%esp
+  8004b5:	53                   	push   %ebx
+  8004b6:	ff 30                	push   (%eax)
+  8004b8:	ff d7                	call   *%edi
+			break;
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004bd:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8004c0:	e9 d4 fe ff ff       	jmp    800399 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8004c5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cb:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8004ce:	8b 10                	mov    (%eax),%edx
+  8004d0:	89 d0                	mov    %edx,%eax
+  8004d2:	f7 d8                	neg    %eax
+  8004d4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004d7:	83 f8 12             	cmp    $0x12,%eax
+  8004da:	7f 23                	jg     8004ff <vprintfmt+0x177>
+  8004dc:	8b 14 85 40 3f 80 00 	mov    0x803f40(,%eax,4),%edx
+  8004e3:	85 d2                	test   %edx,%edx
+  8004e5:	74 18                	je     8004ff <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8004e7:	52                   	push   %edx
+  8004e8:	68 9b 40 80 00       	push   $0x80409b
+  8004ed:	53                   	push   %ebx
+  8004ee:	57                   	push   %edi
+  8004ef:	e8 77 fe ff ff       	call   80036b <printfmt>
+  8004f4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004f7:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004fa:	e9 9a fe ff ff       	jmp    800399 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8004ff:	50                   	push   %eax
+  800500:	68 81 3c 80 00       	push   $0x803c81
+  800505:	53                   	push   %ebx
+  800506:	57                   	push   %edi
+  800507:	e8 5f fe ff ff       	call   80036b <printfmt>
+  80050c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80050f:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800512:	e9 82 fe ff ff       	jmp    800399 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800517:	89 55 10             	mov    %edx,0x10(%ebp)
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	83 c0 04             	add    $0x4,%eax
+  800520:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8b 00                	mov    (%eax),%eax
+  800528:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80052b:	85 c0                	test   %eax,%eax
+  80052d:	0f 84 61 03 00 00    	je     800894 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800533:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800537:	7e 06                	jle    80053f <vprintfmt+0x1b7>
+  800539:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80053d:	75 29                	jne    800568 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80053f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800542:	8d 70 01             	lea    0x1(%eax),%esi
+  800545:	0f b6 00             	movzbl (%eax),%eax
+  800548:	0f be d0             	movsbl %al,%edx
+  80054b:	85 d2                	test   %edx,%edx
+  80054d:	0f 84 bb 00 00 00    	je     80060e <vprintfmt+0x286>
+  800553:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800556:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800559:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80055c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80055f:	eb 7a                	jmp    8005db <vprintfmt+0x253>
+				p = "(null)";
+  800561:	c7 45 d0 7a 3c 80 00 	movl   $0x803c7a,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	ff 75 d4             	push   -0x2c(%ebp)
+  80056e:	ff 75 d0             	push   -0x30(%ebp)
+  800571:	e8 e0 03 00 00       	call   800956 <strnlen>
+  800576:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800579:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80057c:	83 c4 10             	add    $0x10,%esp
+  80057f:	85 d2                	test   %edx,%edx
+  800581:	0f 8e d6 02 00 00    	jle    80085d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800587:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	53                   	push   %ebx
+  80058f:	56                   	push   %esi
+  800590:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800592:	83 c4 10             	add    $0x10,%esp
+  800595:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800599:	75 f0                	jne    80058b <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80059b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80059e:	8d 70 01             	lea    0x1(%eax),%esi
+  8005a1:	0f b6 00             	movzbl (%eax),%eax
+  8005a4:	0f be d0             	movsbl %al,%edx
+  8005a7:	85 d2                	test   %edx,%edx
+  8005a9:	0f 84 da 02 00 00    	je     800889 <vprintfmt+0x501>
+  8005af:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005b2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005b5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005b8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005bb:	eb 1e                	jmp    8005db <vprintfmt+0x253>
+					putch(ch, putdat);
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	ff 75 0c             	push   0xc(%ebp)
+  8005c3:	52                   	push   %edx
+  8005c4:	ff 55 08             	call   *0x8(%ebp)
+  8005c7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ca:	83 eb 01             	sub    $0x1,%ebx
+  8005cd:	83 c6 01             	add    $0x1,%esi
+  8005d0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d4:	0f be d0             	movsbl %al,%edx
+  8005d7:	85 d2                	test   %edx,%edx
+  8005d9:	74 2a                	je     800605 <vprintfmt+0x27d>
+  8005db:	85 ff                	test   %edi,%edi
+  8005dd:	78 05                	js     8005e4 <vprintfmt+0x25c>
+  8005df:	83 ef 01             	sub    $0x1,%edi
+  8005e2:	78 59                	js     80063d <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e8:	74 d3                	je     8005bd <vprintfmt+0x235>
+  8005ea:	0f be c0             	movsbl %al,%eax
+  8005ed:	83 e8 20             	sub    $0x20,%eax
+  8005f0:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f3:	76 c8                	jbe    8005bd <vprintfmt+0x235>
+					putch('?', putdat);
+  8005f5:	83 ec 08             	sub    $0x8,%esp
+  8005f8:	ff 75 0c             	push   0xc(%ebp)
+  8005fb:	6a 3f                	push   $0x3f
+  8005fd:	ff 55 08             	call   *0x8(%ebp)
+  800600:	83 c4 10             	add    $0x10,%esp
+  800603:	eb c5                	jmp    8005ca <vprintfmt+0x242>
+  800605:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800608:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80060b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80060e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800611:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800615:	7e 1b                	jle    800632 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800617:	83 ec 08             	sub    $0x8,%esp
+  80061a:	53                   	push   %ebx
+  80061b:	6a 20                	push   $0x20
+  80061d:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80061f:	83 c4 10             	add    $0x10,%esp
+  800622:	83 ee 01             	sub    $0x1,%esi
+  800625:	75 f0                	jne    800617 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800627:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80062a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062d:	e9 67 fd ff ff       	jmp    800399 <vprintfmt+0x11>
+  800632:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+  800638:	e9 5c fd ff ff       	jmp    800399 <vprintfmt+0x11>
+  80063d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800640:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800643:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800646:	eb c6                	jmp    80060e <vprintfmt+0x286>
+	if (lflag >= 2)
+  800648:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80064b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80064e:	83 f9 01             	cmp    $0x1,%ecx
+  800651:	7f 1f                	jg     800672 <vprintfmt+0x2ea>
+	else if (lflag)
+  800653:	85 c9                	test   %ecx,%ecx
+  800655:	74 67                	je     8006be <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 30                	mov    (%eax),%esi
+  80065c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80065f:	89 f0                	mov    %esi,%eax
+  800661:	c1 f8 1f             	sar    $0x1f,%eax
+  800664:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800670:	eb 17                	jmp    800689 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 50 04             	mov    0x4(%eax),%edx
+  800678:	8b 00                	mov    (%eax),%eax
+  80067a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 40 08             	lea    0x8(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800689:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80068c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80068f:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800694:	85 c9                	test   %ecx,%ecx
+  800696:	0f 89 12 01 00 00    	jns    8007ae <vprintfmt+0x426>
+				putch('-', putdat);
+  80069c:	83 ec 08             	sub    $0x8,%esp
+  80069f:	53                   	push   %ebx
+  8006a0:	6a 2d                	push   $0x2d
+  8006a2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006a4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006aa:	f7 da                	neg    %edx
+  8006ac:	83 d1 00             	adc    $0x0,%ecx
+  8006af:	f7 d9                	neg    %ecx
+  8006b1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006b4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006b9:	e9 f0 00 00 00       	jmp    8007ae <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8b 30                	mov    (%eax),%esi
+  8006c3:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006c6:	89 f0                	mov    %esi,%eax
+  8006c8:	c1 f8 1f             	sar    $0x1f,%eax
+  8006cb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d7:	eb b0                	jmp    800689 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8006d9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006dc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006df:	83 f9 01             	cmp    $0x1,%ecx
+  8006e2:	7f 1e                	jg     800702 <vprintfmt+0x37a>
+	else if (lflag)
+  8006e4:	85 c9                	test   %ecx,%ecx
+  8006e6:	74 32                	je     80071a <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 10                	mov    (%eax),%edx
+  8006ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8006fd:	e9 ac 00 00 00       	jmp    8007ae <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070a:	8d 40 08             	lea    0x8(%eax),%eax
+  80070d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800710:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800715:	e9 94 00 00 00       	jmp    8007ae <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80072a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80072f:	eb 7d                	jmp    8007ae <vprintfmt+0x426>
+	if (lflag >= 2)
+  800731:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800734:	89 55 10             	mov    %edx,0x10(%ebp)
+  800737:	83 f9 01             	cmp    $0x1,%ecx
+  80073a:	7f 1b                	jg     800757 <vprintfmt+0x3cf>
+	else if (lflag)
+  80073c:	85 c9                	test   %ecx,%ecx
+  80073e:	74 2c                	je     80076c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 10                	mov    (%eax),%edx
+  800745:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800750:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800755:	eb 57                	jmp    8007ae <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800757:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075a:	8b 10                	mov    (%eax),%edx
+  80075c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80075f:	8d 40 08             	lea    0x8(%eax),%eax
+  800762:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800765:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80076a:	eb 42                	jmp    8007ae <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8b 10                	mov    (%eax),%edx
+  800771:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800776:	8d 40 04             	lea    0x4(%eax),%eax
+  800779:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800781:	eb 2b                	jmp    8007ae <vprintfmt+0x426>
+			putch('0', putdat);
+  800783:	89 55 10             	mov    %edx,0x10(%ebp)
+  800786:	83 ec 08             	sub    $0x8,%esp
+  800789:	53                   	push   %ebx
+  80078a:	6a 30                	push   $0x30
+  80078c:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80078e:	83 c4 08             	add    $0x8,%esp
+  800791:	53                   	push   %ebx
+  800792:	6a 78                	push   $0x78
+  800794:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007a0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a9:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8007ae:	83 ec 0c             	sub    $0xc,%esp
+  8007b1:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b9:	56                   	push   %esi
+  8007ba:	51                   	push   %ecx
+  8007bb:	52                   	push   %edx
+  8007bc:	89 da                	mov    %ebx,%edx
+  8007be:	89 f8                	mov    %edi,%eax
+  8007c0:	e8 d8 fa ff ff       	call   80029d <printnum>
+			break;
+  8007c5:	83 c4 20             	add    $0x20,%esp
+  8007c8:	e9 cc fb ff ff       	jmp    800399 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8007cd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007d0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d3:	83 f9 01             	cmp    $0x1,%ecx
+  8007d6:	7f 1b                	jg     8007f3 <vprintfmt+0x46b>
+	else if (lflag)
+  8007d8:	85 c9                	test   %ecx,%ecx
+  8007da:	74 2c                	je     800808 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 10                	mov    (%eax),%edx
+  8007e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ec:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8007f1:	eb bb                	jmp    8007ae <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8b 10                	mov    (%eax),%edx
+  8007f8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fb:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800801:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800806:	eb a6                	jmp    8007ae <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800808:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080b:	8b 10                	mov    (%eax),%edx
+  80080d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800812:	8d 40 04             	lea    0x4(%eax),%eax
+  800815:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800818:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80081d:	eb 8f                	jmp    8007ae <vprintfmt+0x426>
+			putch(ch, putdat);
+  80081f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800822:	83 ec 08             	sub    $0x8,%esp
+  800825:	53                   	push   %ebx
+  800826:	6a 25                	push   $0x25
+  800828:	ff d7                	call   *%edi
+			break;
+  80082a:	83 c4 10             	add    $0x10,%esp
+  80082d:	e9 67 fb ff ff       	jmp    800399 <vprintfmt+0x11>
+			putch('%', putdat);
+  800832:	83 ec 08             	sub    $0x8,%esp
+  800835:	53                   	push   %ebx
+  800836:	6a 25                	push   $0x25
+  800838:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80083a:	83 c4 10             	add    $0x10,%esp
+  80083d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800841:	0f 84 ba fb ff ff    	je     800401 <vprintfmt+0x79>
+  800847:	89 75 10             	mov    %esi,0x10(%ebp)
+  80084a:	89 f0                	mov    %esi,%eax
+  80084c:	83 e8 01             	sub    $0x1,%eax
+  80084f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800853:	75 f7                	jne    80084c <vprintfmt+0x4c4>
+  800855:	89 45 10             	mov    %eax,0x10(%ebp)
+  800858:	e9 3c fb ff ff       	jmp    800399 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80085d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800860:	8d 70 01             	lea    0x1(%eax),%esi
+  800863:	0f b6 00             	movzbl (%eax),%eax
+  800866:	0f be d0             	movsbl %al,%edx
+  800869:	85 d2                	test   %edx,%edx
+  80086b:	74 11                	je     80087e <vprintfmt+0x4f6>
+  80086d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800870:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800873:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800876:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800879:	e9 5d fd ff ff       	jmp    8005db <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80087e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800881:	89 45 14             	mov    %eax,0x14(%ebp)
+  800884:	e9 10 fb ff ff       	jmp    800399 <vprintfmt+0x11>
+  800889:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088f:	e9 05 fb ff ff       	jmp    800399 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800894:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800898:	7e 0a                	jle    8008a4 <vprintfmt+0x51c>
+  80089a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80089e:	0f 85 bd fc ff ff    	jne    800561 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008a4:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008a9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008ae:	be 7b 3c 80 00       	mov    $0x803c7b,%esi
+  8008b3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008b6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008b9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008bc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008bf:	e9 17 fd ff ff       	jmp    8005db <vprintfmt+0x253>
+}
+  8008c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c7:	5b                   	pop    %ebx
+  8008c8:	5e                   	pop    %esi
+  8008c9:	5f                   	pop    %edi
+  8008ca:	5d                   	pop    %ebp
+  8008cb:	c3                   	ret
+
+008008cc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	83 ec 18             	sub    $0x18,%esp
+  8008d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008d8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008db:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008df:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008e2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008e9:	85 c0                	test   %eax,%eax
+  8008eb:	74 26                	je     800913 <vsnprintf+0x47>
+  8008ed:	85 d2                	test   %edx,%edx
+  8008ef:	7e 22                	jle    800913 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008f1:	ff 75 14             	push   0x14(%ebp)
+  8008f4:	ff 75 10             	push   0x10(%ebp)
+  8008f7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008fa:	50                   	push   %eax
+  8008fb:	68 4e 03 80 00       	push   $0x80034e
+  800900:	e8 83 fa ff ff       	call   800388 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800905:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800908:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80090b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80090e:	83 c4 10             	add    $0x10,%esp
+}
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+		return -E_INVAL;
+  800913:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800918:	eb f7                	jmp    800911 <vsnprintf+0x45>
+
+0080091a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800920:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800923:	50                   	push   %eax
+  800924:	ff 75 10             	push   0x10(%ebp)
+  800927:	ff 75 0c             	push   0xc(%ebp)
+  80092a:	ff 75 08             	push   0x8(%ebp)
+  80092d:	e8 9a ff ff ff       	call   8008cc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800932:	c9                   	leave
+  800933:	c3                   	ret
+
+00800934 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80093a:	80 3a 00             	cmpb   $0x0,(%edx)
+  80093d:	74 10                	je     80094f <strlen+0x1b>
+  80093f:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800944:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800947:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80094b:	75 f7                	jne    800944 <strlen+0x10>
+	return n;
+}
+  80094d:	5d                   	pop    %ebp
+  80094e:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80094f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800954:	eb f7                	jmp    80094d <strlen+0x19>
+
+00800956 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80095f:	85 d2                	test   %edx,%edx
+  800961:	74 16                	je     800979 <strnlen+0x23>
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+  800968:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80096c:	74 09                	je     800977 <strnlen+0x21>
+		n++;
+  80096e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800971:	39 d0                	cmp    %edx,%eax
+  800973:	75 f3                	jne    800968 <strnlen+0x12>
+		n++;
+  800975:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800977:	5d                   	pop    %ebp
+  800978:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097e:	eb f7                	jmp    800977 <strnlen+0x21>
+
+00800980 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	53                   	push   %ebx
+  800984:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800987:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80098a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800993:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800996:	83 c0 01             	add    $0x1,%eax
+  800999:	84 d2                	test   %dl,%dl
+  80099b:	75 f2                	jne    80098f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80099d:	89 c8                	mov    %ecx,%eax
+  80099f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a2:	c9                   	leave
+  8009a3:	c3                   	ret
+
+008009a4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	53                   	push   %ebx
+  8009a8:	83 ec 10             	sub    $0x10,%esp
+  8009ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009ae:	53                   	push   %ebx
+  8009af:	e8 80 ff ff ff       	call   800934 <strlen>
+  8009b4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009b7:	ff 75 0c             	push   0xc(%ebp)
+  8009ba:	01 d8                	add    %ebx,%eax
+  8009bc:	50                   	push   %eax
+  8009bd:	e8 be ff ff ff       	call   800980 <strcpy>
+	return dst;
+}
+  8009c2:	89 d8                	mov    %ebx,%eax
+  8009c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c7:	c9                   	leave
+  8009c8:	c3                   	ret
+
+008009c9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	56                   	push   %esi
+  8009cd:	53                   	push   %ebx
+  8009ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009d7:	85 db                	test   %ebx,%ebx
+  8009d9:	74 17                	je     8009f2 <strncpy+0x29>
+  8009db:	01 f3                	add    %esi,%ebx
+  8009dd:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	0f b6 0a             	movzbl (%edx),%ecx
+  8009e5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009e8:	80 f9 01             	cmp    $0x1,%cl
+  8009eb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009ee:	39 c3                	cmp    %eax,%ebx
+  8009f0:	75 ed                	jne    8009df <strncpy+0x16>
+	}
+	return ret;
+}
+  8009f2:	89 f0                	mov    %esi,%eax
+  8009f4:	5b                   	pop    %ebx
+  8009f5:	5e                   	pop    %esi
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	56                   	push   %esi
+  8009fc:	53                   	push   %ebx
+  8009fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a06:	89 f0                	mov    %esi,%eax
+  800a08:	85 db                	test   %ebx,%ebx
+  800a0a:	74 1e                	je     800a2a <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a0c:	83 eb 01             	sub    $0x1,%ebx
+  800a0f:	74 16                	je     800a27 <strlcpy+0x2f>
+  800a11:	01 f3                	add    %esi,%ebx
+  800a13:	0f b6 0a             	movzbl (%edx),%ecx
+  800a16:	84 c9                	test   %cl,%cl
+  800a18:	74 0d                	je     800a27 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800a1a:	83 c2 01             	add    $0x1,%edx
+  800a1d:	83 c0 01             	add    $0x1,%eax
+  800a20:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800a23:	39 d8                	cmp    %ebx,%eax
+  800a25:	75 ec                	jne    800a13 <strlcpy+0x1b>
+		*dst = '\0';
+  800a27:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a2a:	29 f0                	sub    %esi,%eax
+}
+  800a2c:	5b                   	pop    %ebx
+  800a2d:	5e                   	pop    %esi
+  800a2e:	5d                   	pop    %ebp
+  800a2f:	c3                   	ret
+
+00800a30 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a36:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a39:	0f b6 01             	movzbl (%ecx),%eax
+  800a3c:	84 c0                	test   %al,%al
+  800a3e:	74 11                	je     800a51 <strcmp+0x21>
+  800a40:	38 02                	cmp    %al,(%edx)
+  800a42:	75 0d                	jne    800a51 <strcmp+0x21>
+		p++, q++;
+  800a44:	83 c1 01             	add    $0x1,%ecx
+  800a47:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a4a:	0f b6 01             	movzbl (%ecx),%eax
+  800a4d:	84 c0                	test   %al,%al
+  800a4f:	75 ef                	jne    800a40 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a51:	0f b6 c0             	movzbl %al,%eax
+  800a54:	0f b6 12             	movzbl (%edx),%edx
+  800a57:	29 d0                	sub    %edx,%eax
+}
+  800a59:	5d                   	pop    %ebp
+  800a5a:	c3                   	ret
+
+00800a5b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	53                   	push   %ebx
+  800a5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a65:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a68:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a6d:	85 d2                	test   %edx,%edx
+  800a6f:	74 2e                	je     800a9f <strncmp+0x44>
+  800a71:	0f b6 01             	movzbl (%ecx),%eax
+  800a74:	84 c0                	test   %al,%al
+  800a76:	74 16                	je     800a8e <strncmp+0x33>
+  800a78:	3a 03                	cmp    (%ebx),%al
+  800a7a:	75 12                	jne    800a8e <strncmp+0x33>
+		n--, p++, q++;
+  800a7c:	83 c1 01             	add    $0x1,%ecx
+  800a7f:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a82:	83 ea 01             	sub    $0x1,%edx
+  800a85:	75 ea                	jne    800a71 <strncmp+0x16>
+		return 0;
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8c:	eb 11                	jmp    800a9f <strncmp+0x44>
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a93:	85 d2                	test   %edx,%edx
+  800a95:	74 08                	je     800a9f <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a97:	0f b6 01             	movzbl (%ecx),%eax
+  800a9a:	0f b6 13             	movzbl (%ebx),%edx
+  800a9d:	29 d0                	sub    %edx,%eax
+}
+  800a9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa2:	c9                   	leave
+  800aa3:	c3                   	ret
+
+00800aa4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800aa4:	55                   	push   %ebp
+  800aa5:	89 e5                	mov    %esp,%ebp
+  800aa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800aae:	0f b6 10             	movzbl (%eax),%edx
+  800ab1:	84 d2                	test   %dl,%dl
+  800ab3:	74 15                	je     800aca <strchr+0x26>
+		if (*s == c)
+  800ab5:	38 d1                	cmp    %dl,%cl
+  800ab7:	74 0f                	je     800ac8 <strchr+0x24>
+	for (; *s; s++)
+  800ab9:	83 c0 01             	add    $0x1,%eax
+  800abc:	0f b6 10             	movzbl (%eax),%edx
+  800abf:	84 d2                	test   %dl,%dl
+  800ac1:	75 f2                	jne    800ab5 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac8:	5d                   	pop    %ebp
+  800ac9:	c3                   	ret
+	return 0;
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acf:	eb f7                	jmp    800ac8 <strchr+0x24>
+
+00800ad1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	53                   	push   %ebx
+  800ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800adb:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800ade:	38 d3                	cmp    %dl,%bl
+  800ae0:	74 14                	je     800af6 <strfind+0x25>
+  800ae2:	89 d1                	mov    %edx,%ecx
+  800ae4:	84 db                	test   %bl,%bl
+  800ae6:	74 0e                	je     800af6 <strfind+0x25>
+	for (; *s; s++)
+  800ae8:	83 c0 01             	add    $0x1,%eax
+  800aeb:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800aee:	38 ca                	cmp    %cl,%dl
+  800af0:	74 04                	je     800af6 <strfind+0x25>
+  800af2:	84 d2                	test   %dl,%dl
+  800af4:	75 f2                	jne    800ae8 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800af6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af9:	c9                   	leave
+  800afa:	c3                   	ret
+
+00800afb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	57                   	push   %edi
+  800aff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b02:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b05:	85 c9                	test   %ecx,%ecx
+  800b07:	74 20                	je     800b29 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b09:	89 f8                	mov    %edi,%eax
+  800b0b:	09 c8                	or     %ecx,%eax
+  800b0d:	a8 03                	test   $0x3,%al
+  800b0f:	75 12                	jne    800b23 <memset+0x28>
+		c &= 0xFF;
+  800b11:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b15:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b1b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b1e:	fc                   	cld
+  800b1f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b21:	eb 06                	jmp    800b29 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b26:	fc                   	cld
+  800b27:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b29:	89 f8                	mov    %edi,%eax
+  800b2b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b2e:	c9                   	leave
+  800b2f:	c3                   	ret
+
+00800b30 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	57                   	push   %edi
+  800b34:	56                   	push   %esi
+  800b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b38:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b3b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b3e:	39 c6                	cmp    %eax,%esi
+  800b40:	73 32                	jae    800b74 <memmove+0x44>
+  800b42:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b45:	39 d0                	cmp    %edx,%eax
+  800b47:	73 2b                	jae    800b74 <memmove+0x44>
+		s += n;
+		d += n;
+  800b49:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b4c:	89 d6                	mov    %edx,%esi
+  800b4e:	09 fe                	or     %edi,%esi
+  800b50:	09 ce                	or     %ecx,%esi
+  800b52:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b58:	75 0e                	jne    800b68 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b5a:	83 ef 04             	sub    $0x4,%edi
+  800b5d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b60:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b63:	fd                   	std
+  800b64:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b66:	eb 09                	jmp    800b71 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b68:	83 ef 01             	sub    $0x1,%edi
+  800b6b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b6e:	fd                   	std
+  800b6f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b71:	fc                   	cld
+  800b72:	eb 1a                	jmp    800b8e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b74:	89 f2                	mov    %esi,%edx
+  800b76:	09 c2                	or     %eax,%edx
+  800b78:	09 ca                	or     %ecx,%edx
+  800b7a:	f6 c2 03             	test   $0x3,%dl
+  800b7d:	75 0a                	jne    800b89 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b7f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b82:	89 c7                	mov    %eax,%edi
+  800b84:	fc                   	cld
+  800b85:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b87:	eb 05                	jmp    800b8e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b89:	89 c7                	mov    %eax,%edi
+  800b8b:	fc                   	cld
+  800b8c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b8e:	5e                   	pop    %esi
+  800b8f:	5f                   	pop    %edi
+  800b90:	5d                   	pop    %ebp
+  800b91:	c3                   	ret
+
+00800b92 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b98:	ff 75 10             	push   0x10(%ebp)
+  800b9b:	ff 75 0c             	push   0xc(%ebp)
+  800b9e:	ff 75 08             	push   0x8(%ebp)
+  800ba1:	e8 8a ff ff ff       	call   800b30 <memmove>
+}
+  800ba6:	c9                   	leave
+  800ba7:	c3                   	ret
+
+00800ba8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+  800bad:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bb3:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bb6:	85 f6                	test   %esi,%esi
+  800bb8:	74 29                	je     800be3 <memcmp+0x3b>
+  800bba:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800bbc:	0f b6 08             	movzbl (%eax),%ecx
+  800bbf:	0f b6 1a             	movzbl (%edx),%ebx
+  800bc2:	38 d9                	cmp    %bl,%cl
+  800bc4:	75 11                	jne    800bd7 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bc6:	83 c0 01             	add    $0x1,%eax
+  800bc9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bcc:	39 c6                	cmp    %eax,%esi
+  800bce:	75 ec                	jne    800bbc <memcmp+0x14>
+	}
+
+	return 0;
+  800bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd5:	eb 08                	jmp    800bdf <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800bd7:	0f b6 c1             	movzbl %cl,%eax
+  800bda:	0f b6 db             	movzbl %bl,%ebx
+  800bdd:	29 d8                	sub    %ebx,%eax
+}
+  800bdf:	5b                   	pop    %ebx
+  800be0:	5e                   	pop    %esi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+	return 0;
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be8:	eb f5                	jmp    800bdf <memcmp+0x37>
+
+00800bea <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bf3:	89 c2                	mov    %eax,%edx
+  800bf5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bf8:	39 d0                	cmp    %edx,%eax
+  800bfa:	73 0d                	jae    800c09 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bfc:	38 08                	cmp    %cl,(%eax)
+  800bfe:	74 0d                	je     800c0d <memfind+0x23>
+	for (; s < ends; s++)
+  800c00:	83 c0 01             	add    $0x1,%eax
+  800c03:	39 c2                	cmp    %eax,%edx
+  800c05:	75 f5                	jne    800bfc <memfind+0x12>
+  800c07:	eb 06                	jmp    800c0f <memfind+0x25>
+  800c09:	89 c2                	mov    %eax,%edx
+  800c0b:	eb 02                	jmp    800c0f <memfind+0x25>
+  800c0d:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c0f:	89 d0                	mov    %edx,%eax
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+
+00800c13 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	57                   	push   %edi
+  800c17:	56                   	push   %esi
+  800c18:	53                   	push   %ebx
+  800c19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c1f:	0f b6 02             	movzbl (%edx),%eax
+  800c22:	3c 20                	cmp    $0x20,%al
+  800c24:	74 04                	je     800c2a <strtol+0x17>
+  800c26:	3c 09                	cmp    $0x9,%al
+  800c28:	75 0e                	jne    800c38 <strtol+0x25>
+		s++;
+  800c2a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c2d:	0f b6 02             	movzbl (%edx),%eax
+  800c30:	3c 20                	cmp    $0x20,%al
+  800c32:	74 f6                	je     800c2a <strtol+0x17>
+  800c34:	3c 09                	cmp    $0x9,%al
+  800c36:	74 f2                	je     800c2a <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c38:	3c 2b                	cmp    $0x2b,%al
+  800c3a:	74 2a                	je     800c66 <strtol+0x53>
+	int neg = 0;
+  800c3c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c41:	3c 2d                	cmp    $0x2d,%al
+  800c43:	74 2b                	je     800c70 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c45:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c4b:	75 0f                	jne    800c5c <strtol+0x49>
+  800c4d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c50:	74 28                	je     800c7a <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c52:	85 db                	test   %ebx,%ebx
+  800c54:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c59:	0f 44 d8             	cmove  %eax,%ebx
+  800c5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c61:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c64:	eb 46                	jmp    800cac <strtol+0x99>
+		s++;
+  800c66:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c69:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6e:	eb d5                	jmp    800c45 <strtol+0x32>
+		s++, neg = 1;
+  800c70:	83 c2 01             	add    $0x1,%edx
+  800c73:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c78:	eb cb                	jmp    800c45 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c7e:	74 0e                	je     800c8e <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c80:	85 db                	test   %ebx,%ebx
+  800c82:	75 d8                	jne    800c5c <strtol+0x49>
+		s++, base = 8;
+  800c84:	83 c2 01             	add    $0x1,%edx
+  800c87:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c8c:	eb ce                	jmp    800c5c <strtol+0x49>
+		s += 2, base = 16;
+  800c8e:	83 c2 02             	add    $0x2,%edx
+  800c91:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c96:	eb c4                	jmp    800c5c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c98:	0f be c0             	movsbl %al,%eax
+  800c9b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c9e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ca1:	7d 3a                	jge    800cdd <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800ca3:	83 c2 01             	add    $0x1,%edx
+  800ca6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800caa:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cac:	0f b6 02             	movzbl (%edx),%eax
+  800caf:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cb2:	89 f3                	mov    %esi,%ebx
+  800cb4:	80 fb 09             	cmp    $0x9,%bl
+  800cb7:	76 df                	jbe    800c98 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800cb9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cbc:	89 f3                	mov    %esi,%ebx
+  800cbe:	80 fb 19             	cmp    $0x19,%bl
+  800cc1:	77 08                	ja     800ccb <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800cc3:	0f be c0             	movsbl %al,%eax
+  800cc6:	83 e8 57             	sub    $0x57,%eax
+  800cc9:	eb d3                	jmp    800c9e <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ccb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cce:	89 f3                	mov    %esi,%ebx
+  800cd0:	80 fb 19             	cmp    $0x19,%bl
+  800cd3:	77 08                	ja     800cdd <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800cd5:	0f be c0             	movsbl %al,%eax
+  800cd8:	83 e8 37             	sub    $0x37,%eax
+  800cdb:	eb c1                	jmp    800c9e <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cdd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ce1:	74 05                	je     800ce8 <strtol+0xd5>
+		*endptr = (char *) s;
+  800ce3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ce8:	89 c8                	mov    %ecx,%eax
+  800cea:	f7 d8                	neg    %eax
+  800cec:	85 ff                	test   %edi,%edi
+  800cee:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cf1:	89 c8                	mov    %ecx,%eax
+  800cf3:	5b                   	pop    %ebx
+  800cf4:	5e                   	pop    %esi
+  800cf5:	5f                   	pop    %edi
+  800cf6:	5d                   	pop    %ebp
+  800cf7:	c3                   	ret
+
+00800cf8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d09:	89 c3                	mov    %eax,%ebx
+  800d0b:	89 c7                	mov    %eax,%edi
+  800d0d:	89 c6                	mov    %eax,%esi
+  800d0f:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d11:	5b                   	pop    %ebx
+  800d12:	5e                   	pop    %esi
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+
+00800d16 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d16:	55                   	push   %ebp
+  800d17:	89 e5                	mov    %esp,%ebp
+  800d19:	57                   	push   %edi
+  800d1a:	56                   	push   %esi
+  800d1b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d21:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d26:	89 d1                	mov    %edx,%ecx
+  800d28:	89 d3                	mov    %edx,%ebx
+  800d2a:	89 d7                	mov    %edx,%edi
+  800d2c:	89 d6                	mov    %edx,%esi
+  800d2e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d30:	5b                   	pop    %ebx
+  800d31:	5e                   	pop    %esi
+  800d32:	5f                   	pop    %edi
+  800d33:	5d                   	pop    %ebp
+  800d34:	c3                   	ret
+
+00800d35 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	57                   	push   %edi
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d46:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d4b:	89 cb                	mov    %ecx,%ebx
+  800d4d:	89 cf                	mov    %ecx,%edi
+  800d4f:	89 ce                	mov    %ecx,%esi
+  800d51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d53:	85 c0                	test   %eax,%eax
+  800d55:	7f 08                	jg     800d5f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d5f:	83 ec 0c             	sub    $0xc,%esp
+  800d62:	50                   	push   %eax
+  800d63:	6a 03                	push   $0x3
+  800d65:	68 ab 3f 80 00       	push   $0x803fab
+  800d6a:	6a 23                	push   $0x23
+  800d6c:	68 c8 3f 80 00       	push   $0x803fc8
+  800d71:	e8 79 28 00 00       	call   8035ef <_panic>
+
+00800d76 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	57                   	push   %edi
+  800d7a:	56                   	push   %esi
+  800d7b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d81:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d86:	89 d1                	mov    %edx,%ecx
+  800d88:	89 d3                	mov    %edx,%ebx
+  800d8a:	89 d7                	mov    %edx,%edi
+  800d8c:	89 d6                	mov    %edx,%esi
+  800d8e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+
+00800d95 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	57                   	push   %edi
+  800d99:	56                   	push   %esi
+  800d9a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800da5:	89 d1                	mov    %edx,%ecx
+  800da7:	89 d3                	mov    %edx,%ebx
+  800da9:	89 d7                	mov    %edx,%edi
+  800dab:	89 d6                	mov    %edx,%esi
+  800dad:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800daf:	5b                   	pop    %ebx
+  800db0:	5e                   	pop    %esi
+  800db1:	5f                   	pop    %edi
+  800db2:	5d                   	pop    %ebp
+  800db3:	c3                   	ret
+
+00800db4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dbd:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd0:	89 f7                	mov    %esi,%edi
+  800dd2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd4:	85 c0                	test   %eax,%eax
+  800dd6:	7f 08                	jg     800de0 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ddb:	5b                   	pop    %ebx
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5f                   	pop    %edi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de0:	83 ec 0c             	sub    $0xc,%esp
+  800de3:	50                   	push   %eax
+  800de4:	6a 04                	push   $0x4
+  800de6:	68 ab 3f 80 00       	push   $0x803fab
+  800deb:	6a 23                	push   $0x23
+  800ded:	68 c8 3f 80 00       	push   $0x803fc8
+  800df2:	e8 f8 27 00 00       	call   8035ef <_panic>
+
+00800df7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	57                   	push   %edi
+  800dfb:	56                   	push   %esi
+  800dfc:	53                   	push   %ebx
+  800dfd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e11:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e14:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e16:	85 c0                	test   %eax,%eax
+  800e18:	7f 08                	jg     800e22 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1d:	5b                   	pop    %ebx
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5f                   	pop    %edi
+  800e20:	5d                   	pop    %ebp
+  800e21:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e22:	83 ec 0c             	sub    $0xc,%esp
+  800e25:	50                   	push   %eax
+  800e26:	6a 05                	push   $0x5
+  800e28:	68 ab 3f 80 00       	push   $0x803fab
+  800e2d:	6a 23                	push   $0x23
+  800e2f:	68 c8 3f 80 00       	push   $0x803fc8
+  800e34:	e8 b6 27 00 00       	call   8035ef <_panic>
+
+00800e39 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	57                   	push   %edi
+  800e3d:	56                   	push   %esi
+  800e3e:	53                   	push   %ebx
+  800e3f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e52:	89 df                	mov    %ebx,%edi
+  800e54:	89 de                	mov    %ebx,%esi
+  800e56:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e58:	85 c0                	test   %eax,%eax
+  800e5a:	7f 08                	jg     800e64 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5f:	5b                   	pop    %ebx
+  800e60:	5e                   	pop    %esi
+  800e61:	5f                   	pop    %edi
+  800e62:	5d                   	pop    %ebp
+  800e63:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+  800e67:	50                   	push   %eax
+  800e68:	6a 06                	push   $0x6
+  800e6a:	68 ab 3f 80 00       	push   $0x803fab
+  800e6f:	6a 23                	push   $0x23
+  800e71:	68 c8 3f 80 00       	push   $0x803fc8
+  800e76:	e8 74 27 00 00       	call   8035ef <_panic>
+
+00800e7b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	57                   	push   %edi
+  800e7f:	56                   	push   %esi
+  800e80:	53                   	push   %ebx
+  800e81:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e94:	89 df                	mov    %ebx,%edi
+  800e96:	89 de                	mov    %ebx,%esi
+  800e98:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e9a:	85 c0                	test   %eax,%eax
+  800e9c:	7f 08                	jg     800ea6 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+  800ea9:	50                   	push   %eax
+  800eaa:	6a 08                	push   $0x8
+  800eac:	68 ab 3f 80 00       	push   $0x803fab
+  800eb1:	6a 23                	push   $0x23
+  800eb3:	68 c8 3f 80 00       	push   $0x803fc8
+  800eb8:	e8 32 27 00 00       	call   8035ef <_panic>
+
+00800ebd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ebd:	55                   	push   %ebp
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	57                   	push   %edi
+  800ec1:	56                   	push   %esi
+  800ec2:	53                   	push   %ebx
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ed6:	89 df                	mov    %ebx,%edi
+  800ed8:	89 de                	mov    %ebx,%esi
+  800eda:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800edc:	85 c0                	test   %eax,%eax
+  800ede:	7f 08                	jg     800ee8 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+  800eeb:	50                   	push   %eax
+  800eec:	6a 09                	push   $0x9
+  800eee:	68 ab 3f 80 00       	push   $0x803fab
+  800ef3:	6a 23                	push   $0x23
+  800ef5:	68 c8 3f 80 00       	push   $0x803fc8
+  800efa:	e8 f0 26 00 00       	call   8035ef <_panic>
+
+00800eff <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	57                   	push   %edi
+  800f03:	56                   	push   %esi
+  800f04:	53                   	push   %ebx
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f18:	89 df                	mov    %ebx,%edi
+  800f1a:	89 de                	mov    %ebx,%esi
+  800f1c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1e:	85 c0                	test   %eax,%eax
+  800f20:	7f 08                	jg     800f2a <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f25:	5b                   	pop    %ebx
+  800f26:	5e                   	pop    %esi
+  800f27:	5f                   	pop    %edi
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2a:	83 ec 0c             	sub    $0xc,%esp
+  800f2d:	50                   	push   %eax
+  800f2e:	6a 0a                	push   $0xa
+  800f30:	68 ab 3f 80 00       	push   $0x803fab
+  800f35:	6a 23                	push   $0x23
+  800f37:	68 c8 3f 80 00       	push   $0x803fc8
+  800f3c:	e8 ae 26 00 00       	call   8035ef <_panic>
+
+00800f41 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	57                   	push   %edi
+  800f45:	56                   	push   %esi
+  800f46:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f52:	be 00 00 00 00       	mov    $0x0,%esi
+  800f57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+
+00800f64 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+  800f6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f75:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f7a:	89 cb                	mov    %ecx,%ebx
+  800f7c:	89 cf                	mov    %ecx,%edi
+  800f7e:	89 ce                	mov    %ecx,%esi
+  800f80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	7f 08                	jg     800f8e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5e                   	pop    %esi
+  800f8b:	5f                   	pop    %edi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+  800f91:	50                   	push   %eax
+  800f92:	6a 0d                	push   $0xd
+  800f94:	68 ab 3f 80 00       	push   $0x803fab
+  800f99:	6a 23                	push   $0x23
+  800f9b:	68 c8 3f 80 00       	push   $0x803fc8
+  800fa0:	e8 4a 26 00 00       	call   8035ef <_panic>
+
+00800fa5 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800fa5:	55                   	push   %ebp
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	57                   	push   %edi
+  800fa9:	56                   	push   %esi
+  800faa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fbc:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fbf:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+
+00800fc6 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	57                   	push   %edi
+  800fca:	56                   	push   %esi
+  800fcb:	53                   	push   %ebx
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fdf:	89 df                	mov    %ebx,%edi
+  800fe1:	89 de                	mov    %ebx,%esi
+  800fe3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe5:	85 c0                	test   %eax,%eax
+  800fe7:	7f 08                	jg     800ff1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fec:	5b                   	pop    %ebx
+  800fed:	5e                   	pop    %esi
+  800fee:	5f                   	pop    %edi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff1:	83 ec 0c             	sub    $0xc,%esp
+  800ff4:	50                   	push   %eax
+  800ff5:	6a 0d                	push   $0xd
+  800ff7:	68 ab 3f 80 00       	push   $0x803fab
+  800ffc:	6a 23                	push   $0x23
+  800ffe:	68 c8 3f 80 00       	push   $0x803fc8
+  801003:	e8 e7 25 00 00       	call   8035ef <_panic>
+
+00801008 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	57                   	push   %edi
+  80100c:	56                   	push   %esi
+  80100d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80100e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801013:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801018:	89 d1                	mov    %edx,%ecx
+  80101a:	89 d3                	mov    %edx,%ebx
+  80101c:	89 d7                	mov    %edx,%edi
+  80101e:	89 d6                	mov    %edx,%esi
+  801020:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+
+00801027 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80102d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801032:	8b 55 08             	mov    0x8(%ebp),%edx
+  801035:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801038:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80103d:	89 df                	mov    %ebx,%edi
+  80103f:	89 de                	mov    %ebx,%esi
+  801041:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+
+00801048 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801048:	55                   	push   %ebp
+  801049:	89 e5                	mov    %esp,%ebp
+  80104b:	57                   	push   %edi
+  80104c:	56                   	push   %esi
+  80104d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80104e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801053:	8b 55 08             	mov    0x8(%ebp),%edx
+  801056:	b8 10 00 00 00       	mov    $0x10,%eax
+  80105b:	89 cb                	mov    %ecx,%ebx
+  80105d:	89 cf                	mov    %ecx,%edi
+  80105f:	89 ce                	mov    %ecx,%esi
+  801061:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+
+00801068 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801068:	55                   	push   %ebp
+  801069:	89 e5                	mov    %esp,%ebp
+  80106b:	57                   	push   %edi
+  80106c:	56                   	push   %esi
+  80106d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80106e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801073:	8b 55 08             	mov    0x8(%ebp),%edx
+  801076:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801079:	b8 11 00 00 00       	mov    $0x11,%eax
+  80107e:	89 df                	mov    %ebx,%edi
+  801080:	89 de                	mov    %ebx,%esi
+  801082:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801084:	5b                   	pop    %ebx
+  801085:	5e                   	pop    %esi
+  801086:	5f                   	pop    %edi
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+
+00801089 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	57                   	push   %edi
+  80108d:	56                   	push   %esi
+  80108e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80108f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80109f:	89 df                	mov    %ebx,%edi
+  8010a1:	89 de                	mov    %ebx,%esi
+  8010a3:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8010a5:	5b                   	pop    %ebx
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5f                   	pop    %edi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	c3                   	ret
+
+008010aa <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8010aa:	55                   	push   %ebp
+  8010ab:	89 e5                	mov    %esp,%ebp
+  8010ad:	57                   	push   %edi
+  8010ae:	56                   	push   %esi
+  8010af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010bd:	89 cb                	mov    %ecx,%ebx
+  8010bf:	89 cf                	mov    %ecx,%edi
+  8010c1:	89 ce                	mov    %ecx,%esi
+  8010c3:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5e                   	pop    %esi
+  8010c7:	5f                   	pop    %edi
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	c3                   	ret
+
+008010ca <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	57                   	push   %edi
+  8010ce:	56                   	push   %esi
+  8010cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010e0:	89 df                	mov    %ebx,%edi
+  8010e2:	89 de                	mov    %ebx,%esi
+  8010e4:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5f                   	pop    %edi
+  8010e9:	5d                   	pop    %ebp
+  8010ea:	c3                   	ret
+
+008010eb <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	57                   	push   %edi
+  8010ef:	56                   	push   %esi
+  8010f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010fe:	89 cb                	mov    %ecx,%ebx
+  801100:	89 cf                	mov    %ecx,%edi
+  801102:	89 ce                	mov    %ecx,%esi
+  801104:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801106:	5b                   	pop    %ebx
+  801107:	5e                   	pop    %esi
+  801108:	5f                   	pop    %edi
+  801109:	5d                   	pop    %ebp
+  80110a:	c3                   	ret
+
+0080110b <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80110b:	55                   	push   %ebp
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	57                   	push   %edi
+  80110f:	56                   	push   %esi
+  801110:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801111:	be 00 00 00 00       	mov    $0x0,%esi
+  801116:	8b 55 08             	mov    0x8(%ebp),%edx
+  801119:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801121:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801124:	89 f7                	mov    %esi,%edi
+  801126:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801133:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801138:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801143:	89 df                	mov    %ebx,%edi
+  801145:	89 de                	mov    %ebx,%esi
+  801147:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5f                   	pop    %edi
+  80114c:	5d                   	pop    %ebp
+  80114d:	c3                   	ret
+
+0080114e <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	57                   	push   %edi
+  801152:	56                   	push   %esi
+  801153:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801154:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801161:	89 cb                	mov    %ecx,%ebx
+  801163:	89 cf                	mov    %ecx,%edi
+  801165:	89 ce                	mov    %ecx,%esi
+  801167:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801169:	5b                   	pop    %ebx
+  80116a:	5e                   	pop    %esi
+  80116b:	5f                   	pop    %edi
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+
+0080116e <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	57                   	push   %edi
+  801172:	56                   	push   %esi
+  801173:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801174:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801180:	b8 19 00 00 00       	mov    $0x19,%eax
+  801185:	89 df                	mov    %ebx,%edi
+  801187:	89 de                	mov    %ebx,%esi
+  801189:	cd 30                	int    $0x30
+}
+  80118b:	5b                   	pop    %ebx
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+
+00801190 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801190:	55                   	push   %ebp
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	57                   	push   %edi
+  801194:	56                   	push   %esi
+  801195:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801196:	be 00 00 00 00       	mov    $0x0,%esi
+  80119b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a9:	89 f7                	mov    %esi,%edi
+  8011ab:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+
+008011b2 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cb:	89 f7                	mov    %esi,%edi
+  8011cd:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8011cf:	5b                   	pop    %ebx
+  8011d0:	5e                   	pop    %esi
+  8011d1:	5f                   	pop    %edi
+  8011d2:	5d                   	pop    %ebp
+  8011d3:	c3                   	ret
+
+008011d4 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8011ea:	89 df                	mov    %ebx,%edi
+  8011ec:	89 de                	mov    %ebx,%esi
+  8011ee:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011f0:	5b                   	pop    %ebx
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5f                   	pop    %edi
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	c3                   	ret
+
+008011f5 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8011f5:	55                   	push   %ebp
+  8011f6:	89 e5                	mov    %esp,%ebp
+  8011f8:	57                   	push   %edi
+  8011f9:	56                   	push   %esi
+  8011fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80120b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120e:	89 f7                	mov    %esi,%edi
+  801210:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+
+00801217 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801217:	55                   	push   %ebp
+  801218:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80121a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80121d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801222:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+
+00801227 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80122a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80122d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801232:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801237:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+
+0080123e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801246:	89 c2                	mov    %eax,%edx
+  801248:	c1 ea 16             	shr    $0x16,%edx
+  80124b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801252:	f6 c2 01             	test   $0x1,%dl
+  801255:	74 29                	je     801280 <fd_alloc+0x42>
+  801257:	89 c2                	mov    %eax,%edx
+  801259:	c1 ea 0c             	shr    $0xc,%edx
+  80125c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801263:	f6 c2 01             	test   $0x1,%dl
+  801266:	74 18                	je     801280 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801268:	05 00 10 00 00       	add    $0x1000,%eax
+  80126d:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801272:	75 d2                	jne    801246 <fd_alloc+0x8>
+  801274:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801279:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80127e:	eb 05                	jmp    801285 <fd_alloc+0x47>
+			return 0;
+  801280:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	89 02                	mov    %eax,(%edx)
+}
+  80128a:	89 c8                	mov    %ecx,%eax
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+
+0080128e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801294:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801299:	77 30                	ja     8012cb <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80129b:	c1 e0 0c             	shl    $0xc,%eax
+  80129e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8012a3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012a9:	f6 c2 01             	test   $0x1,%dl
+  8012ac:	74 24                	je     8012d2 <fd_lookup+0x44>
+  8012ae:	89 c2                	mov    %eax,%edx
+  8012b0:	c1 ea 0c             	shr    $0xc,%edx
+  8012b3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012ba:	f6 c2 01             	test   $0x1,%dl
+  8012bd:	74 1a                	je     8012d9 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012c2:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+		return -E_INVAL;
+  8012cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d0:	eb f7                	jmp    8012c9 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8012d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d7:	eb f0                	jmp    8012c9 <fd_lookup+0x3b>
+  8012d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012de:	eb e9                	jmp    8012c9 <fd_lookup+0x3b>
+
+008012e0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	53                   	push   %ebx
+  8012e4:	83 ec 04             	sub    $0x4,%esp
+  8012e7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ef:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8012f4:	39 13                	cmp    %edx,(%ebx)
+  8012f6:	74 54                	je     80134c <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8012f8:	83 c0 01             	add    $0x1,%eax
+  8012fb:	8b 1c 85 54 40 80 00 	mov    0x804054(,%eax,4),%ebx
+  801302:	85 db                	test   %ebx,%ebx
+  801304:	75 ee                	jne    8012f4 <dev_lookup+0x14>
+  801306:	89 e1                	mov    %esp,%ecx
+  801308:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80130d:	29 c8                	sub    %ecx,%eax
+  80130f:	89 c1                	mov    %eax,%ecx
+  801311:	c1 e9 0f             	shr    $0xf,%ecx
+  801314:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131e:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801321:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801328:	8b 40 48             	mov    0x48(%eax),%eax
+  80132b:	83 ec 04             	sub    $0x4,%esp
+  80132e:	52                   	push   %edx
+  80132f:	50                   	push   %eax
+  801330:	68 d8 3f 80 00       	push   $0x803fd8
+  801335:	e8 4f ef ff ff       	call   800289 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80133a:	83 c4 10             	add    $0x10,%esp
+  80133d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801342:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801345:	89 1a                	mov    %ebx,(%edx)
+}
+  801347:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80134a:	c9                   	leave
+  80134b:	c3                   	ret
+			return 0;
+  80134c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801351:	eb ef                	jmp    801342 <dev_lookup+0x62>
+
+00801353 <fd_close>:
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	57                   	push   %edi
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+  801359:	83 ec 24             	sub    $0x24,%esp
+  80135c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80135f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801362:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801365:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801366:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80136c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80136f:	50                   	push   %eax
+  801370:	e8 19 ff ff ff       	call   80128e <fd_lookup>
+  801375:	89 c3                	mov    %eax,%ebx
+  801377:	83 c4 10             	add    $0x10,%esp
+  80137a:	85 c0                	test   %eax,%eax
+  80137c:	78 05                	js     801383 <fd_close+0x30>
+	    || fd != fd2)
+  80137e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801381:	74 0f                	je     801392 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801383:	85 ff                	test   %edi,%edi
+  801385:	0f 44 df             	cmove  %edi,%ebx
+}
+  801388:	89 d8                	mov    %ebx,%eax
+  80138a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801392:	83 ec 08             	sub    $0x8,%esp
+  801395:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801398:	50                   	push   %eax
+  801399:	ff 36                	push   (%esi)
+  80139b:	e8 40 ff ff ff       	call   8012e0 <dev_lookup>
+  8013a0:	89 c3                	mov    %eax,%ebx
+  8013a2:	83 c4 10             	add    $0x10,%esp
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	78 1a                	js     8013c3 <fd_close+0x70>
+		if (dev->dev_close)
+  8013a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013ac:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013af:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	74 0b                	je     8013c3 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8013b8:	83 ec 0c             	sub    $0xc,%esp
+  8013bb:	56                   	push   %esi
+  8013bc:	ff d0                	call   *%eax
+  8013be:	89 c3                	mov    %eax,%ebx
+  8013c0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013c3:	83 ec 08             	sub    $0x8,%esp
+  8013c6:	56                   	push   %esi
+  8013c7:	6a 00                	push   $0x0
+  8013c9:	e8 6b fa ff ff       	call   800e39 <sys_page_unmap>
+	return r;
+  8013ce:	83 c4 10             	add    $0x10,%esp
+  8013d1:	eb b5                	jmp    801388 <fd_close+0x35>
+
+008013d3 <close>:
+
+int
+close(int fdnum)
+{
+  8013d3:	55                   	push   %ebp
+  8013d4:	89 e5                	mov    %esp,%ebp
+  8013d6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013dc:	50                   	push   %eax
+  8013dd:	ff 75 08             	push   0x8(%ebp)
+  8013e0:	e8 a9 fe ff ff       	call   80128e <fd_lookup>
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	85 c0                	test   %eax,%eax
+  8013ea:	79 02                	jns    8013ee <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013ec:	c9                   	leave
+  8013ed:	c3                   	ret
+		return fd_close(fd, 1);
+  8013ee:	83 ec 08             	sub    $0x8,%esp
+  8013f1:	6a 01                	push   $0x1
+  8013f3:	ff 75 f4             	push   -0xc(%ebp)
+  8013f6:	e8 58 ff ff ff       	call   801353 <fd_close>
+  8013fb:	83 c4 10             	add    $0x10,%esp
+  8013fe:	eb ec                	jmp    8013ec <close+0x19>
+
+00801400 <close_all>:
+
+void
+close_all(void)
+{
+  801400:	55                   	push   %ebp
+  801401:	89 e5                	mov    %esp,%ebp
+  801403:	53                   	push   %ebx
+  801404:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801407:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80140c:	83 ec 0c             	sub    $0xc,%esp
+  80140f:	53                   	push   %ebx
+  801410:	e8 be ff ff ff       	call   8013d3 <close>
+	for (i = 0; i < MAXFD; i++)
+  801415:	83 c3 01             	add    $0x1,%ebx
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801421:	75 e9                	jne    80140c <close_all+0xc>
+}
+  801423:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801426:	c9                   	leave
+  801427:	c3                   	ret
+
+00801428 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801428:	55                   	push   %ebp
+  801429:	89 e5                	mov    %esp,%ebp
+  80142b:	57                   	push   %edi
+  80142c:	56                   	push   %esi
+  80142d:	53                   	push   %ebx
+  80142e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801431:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801434:	50                   	push   %eax
+  801435:	ff 75 08             	push   0x8(%ebp)
+  801438:	e8 51 fe ff ff       	call   80128e <fd_lookup>
+  80143d:	89 c3                	mov    %eax,%ebx
+  80143f:	83 c4 10             	add    $0x10,%esp
+  801442:	85 c0                	test   %eax,%eax
+  801444:	78 7f                	js     8014c5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801446:	83 ec 0c             	sub    $0xc,%esp
+  801449:	ff 75 0c             	push   0xc(%ebp)
+  80144c:	e8 82 ff ff ff       	call   8013d3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801451:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801454:	c1 e6 0c             	shl    $0xc,%esi
+  801457:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80145d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801460:	89 3c 24             	mov    %edi,(%esp)
+  801463:	e8 bf fd ff ff       	call   801227 <fd2data>
+  801468:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80146a:	89 34 24             	mov    %esi,(%esp)
+  80146d:	e8 b5 fd ff ff       	call   801227 <fd2data>
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801478:	89 d8                	mov    %ebx,%eax
+  80147a:	c1 e8 16             	shr    $0x16,%eax
+  80147d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801484:	a8 01                	test   $0x1,%al
+  801486:	74 11                	je     801499 <dup+0x71>
+  801488:	89 d8                	mov    %ebx,%eax
+  80148a:	c1 e8 0c             	shr    $0xc,%eax
+  80148d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801494:	f6 c2 01             	test   $0x1,%dl
+  801497:	75 36                	jne    8014cf <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801499:	89 f8                	mov    %edi,%eax
+  80149b:	c1 e8 0c             	shr    $0xc,%eax
+  80149e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014ad:	50                   	push   %eax
+  8014ae:	56                   	push   %esi
+  8014af:	6a 00                	push   $0x0
+  8014b1:	57                   	push   %edi
+  8014b2:	6a 00                	push   $0x0
+  8014b4:	e8 3e f9 ff ff       	call   800df7 <sys_page_map>
+  8014b9:	89 c3                	mov    %eax,%ebx
+  8014bb:	83 c4 20             	add    $0x20,%esp
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	78 33                	js     8014f5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014c5:	89 d8                	mov    %ebx,%eax
+  8014c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ca:	5b                   	pop    %ebx
+  8014cb:	5e                   	pop    %esi
+  8014cc:	5f                   	pop    %edi
+  8014cd:	5d                   	pop    %ebp
+  8014ce:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014cf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014d6:	83 ec 0c             	sub    $0xc,%esp
+  8014d9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014de:	50                   	push   %eax
+  8014df:	ff 75 d4             	push   -0x2c(%ebp)
+  8014e2:	6a 00                	push   $0x0
+  8014e4:	53                   	push   %ebx
+  8014e5:	6a 00                	push   $0x0
+  8014e7:	e8 0b f9 ff ff       	call   800df7 <sys_page_map>
+  8014ec:	89 c3                	mov    %eax,%ebx
+  8014ee:	83 c4 20             	add    $0x20,%esp
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	79 a4                	jns    801499 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014f5:	83 ec 08             	sub    $0x8,%esp
+  8014f8:	56                   	push   %esi
+  8014f9:	6a 00                	push   $0x0
+  8014fb:	e8 39 f9 ff ff       	call   800e39 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801500:	83 c4 08             	add    $0x8,%esp
+  801503:	ff 75 d4             	push   -0x2c(%ebp)
+  801506:	6a 00                	push   $0x0
+  801508:	e8 2c f9 ff ff       	call   800e39 <sys_page_unmap>
+	return r;
+  80150d:	83 c4 10             	add    $0x10,%esp
+  801510:	eb b3                	jmp    8014c5 <dup+0x9d>
+
+00801512 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	56                   	push   %esi
+  801516:	53                   	push   %ebx
+  801517:	83 ec 18             	sub    $0x18,%esp
+  80151a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80151d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801520:	50                   	push   %eax
+  801521:	53                   	push   %ebx
+  801522:	e8 67 fd ff ff       	call   80128e <fd_lookup>
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	78 3c                	js     80156a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80152e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801531:	83 ec 08             	sub    $0x8,%esp
+  801534:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801537:	50                   	push   %eax
+  801538:	ff 36                	push   (%esi)
+  80153a:	e8 a1 fd ff ff       	call   8012e0 <dev_lookup>
+  80153f:	83 c4 10             	add    $0x10,%esp
+  801542:	85 c0                	test   %eax,%eax
+  801544:	78 24                	js     80156a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801546:	8b 46 08             	mov    0x8(%esi),%eax
+  801549:	83 e0 03             	and    $0x3,%eax
+  80154c:	83 f8 01             	cmp    $0x1,%eax
+  80154f:	74 20                	je     801571 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801551:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801554:	8b 40 08             	mov    0x8(%eax),%eax
+  801557:	85 c0                	test   %eax,%eax
+  801559:	74 54                	je     8015af <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80155b:	83 ec 04             	sub    $0x4,%esp
+  80155e:	ff 75 10             	push   0x10(%ebp)
+  801561:	ff 75 0c             	push   0xc(%ebp)
+  801564:	56                   	push   %esi
+  801565:	ff d0                	call   *%eax
+  801567:	83 c4 10             	add    $0x10,%esp
+}
+  80156a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80156d:	5b                   	pop    %ebx
+  80156e:	5e                   	pop    %esi
+  80156f:	5d                   	pop    %ebp
+  801570:	c3                   	ret
+  801571:	89 e2                	mov    %esp,%edx
+  801573:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801578:	29 d0                	sub    %edx,%eax
+  80157a:	89 c2                	mov    %eax,%edx
+  80157c:	c1 ea 0f             	shr    $0xf,%edx
+  80157f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801584:	b8 00 00 00 00       	mov    $0x0,%eax
+  801589:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80158c:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801593:	8b 40 48             	mov    0x48(%eax),%eax
+  801596:	83 ec 04             	sub    $0x4,%esp
+  801599:	53                   	push   %ebx
+  80159a:	50                   	push   %eax
+  80159b:	68 19 40 80 00       	push   $0x804019
+  8015a0:	e8 e4 ec ff ff       	call   800289 <cprintf>
+		return -E_INVAL;
+  8015a5:	83 c4 10             	add    $0x10,%esp
+  8015a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ad:	eb bb                	jmp    80156a <read+0x58>
+		return -E_NOT_SUPP;
+  8015af:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b4:	eb b4                	jmp    80156a <read+0x58>
+
+008015b6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015b6:	55                   	push   %ebp
+  8015b7:	89 e5                	mov    %esp,%ebp
+  8015b9:	57                   	push   %edi
+  8015ba:	56                   	push   %esi
+  8015bb:	53                   	push   %ebx
+  8015bc:	83 ec 0c             	sub    $0xc,%esp
+  8015bf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8015c2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015c5:	85 f6                	test   %esi,%esi
+  8015c7:	74 30                	je     8015f9 <readn+0x43>
+  8015c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015d3:	83 ec 04             	sub    $0x4,%esp
+  8015d6:	89 f2                	mov    %esi,%edx
+  8015d8:	29 c2                	sub    %eax,%edx
+  8015da:	52                   	push   %edx
+  8015db:	01 f8                	add    %edi,%eax
+  8015dd:	50                   	push   %eax
+  8015de:	ff 75 08             	push   0x8(%ebp)
+  8015e1:	e8 2c ff ff ff       	call   801512 <read>
+		if (m < 0)
+  8015e6:	83 c4 10             	add    $0x10,%esp
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	78 15                	js     801602 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8015ed:	74 11                	je     801600 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8015ef:	01 c3                	add    %eax,%ebx
+  8015f1:	89 d8                	mov    %ebx,%eax
+  8015f3:	39 f3                	cmp    %esi,%ebx
+  8015f5:	72 dc                	jb     8015d3 <readn+0x1d>
+  8015f7:	eb 09                	jmp    801602 <readn+0x4c>
+  8015f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fe:	eb 02                	jmp    801602 <readn+0x4c>
+  801600:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801605:	5b                   	pop    %ebx
+  801606:	5e                   	pop    %esi
+  801607:	5f                   	pop    %edi
+  801608:	5d                   	pop    %ebp
+  801609:	c3                   	ret
+
+0080160a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80160a:	55                   	push   %ebp
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	56                   	push   %esi
+  80160e:	53                   	push   %ebx
+  80160f:	83 ec 18             	sub    $0x18,%esp
+  801612:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801615:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801618:	50                   	push   %eax
+  801619:	53                   	push   %ebx
+  80161a:	e8 6f fc ff ff       	call   80128e <fd_lookup>
+  80161f:	83 c4 10             	add    $0x10,%esp
+  801622:	85 c0                	test   %eax,%eax
+  801624:	78 37                	js     80165d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801626:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801629:	83 ec 08             	sub    $0x8,%esp
+  80162c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80162f:	50                   	push   %eax
+  801630:	ff 36                	push   (%esi)
+  801632:	e8 a9 fc ff ff       	call   8012e0 <dev_lookup>
+  801637:	83 c4 10             	add    $0x10,%esp
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	78 1f                	js     80165d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80163e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801642:	74 20                	je     801664 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801644:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801647:	8b 40 0c             	mov    0xc(%eax),%eax
+  80164a:	85 c0                	test   %eax,%eax
+  80164c:	74 54                	je     8016a2 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80164e:	83 ec 04             	sub    $0x4,%esp
+  801651:	ff 75 10             	push   0x10(%ebp)
+  801654:	ff 75 0c             	push   0xc(%ebp)
+  801657:	56                   	push   %esi
+  801658:	ff d0                	call   *%eax
+  80165a:	83 c4 10             	add    $0x10,%esp
+}
+  80165d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801660:	5b                   	pop    %ebx
+  801661:	5e                   	pop    %esi
+  801662:	5d                   	pop    %ebp
+  801663:	c3                   	ret
+  801664:	89 e2                	mov    %esp,%edx
+  801666:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80166b:	29 d0                	sub    %edx,%eax
+  80166d:	89 c2                	mov    %eax,%edx
+  80166f:	c1 ea 0f             	shr    $0xf,%edx
+  801672:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167c:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80167f:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801686:	8b 40 48             	mov    0x48(%eax),%eax
+  801689:	83 ec 04             	sub    $0x4,%esp
+  80168c:	53                   	push   %ebx
+  80168d:	50                   	push   %eax
+  80168e:	68 35 40 80 00       	push   $0x804035
+  801693:	e8 f1 eb ff ff       	call   800289 <cprintf>
+		return -E_INVAL;
+  801698:	83 c4 10             	add    $0x10,%esp
+  80169b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a0:	eb bb                	jmp    80165d <write+0x53>
+		return -E_NOT_SUPP;
+  8016a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016a7:	eb b4                	jmp    80165d <write+0x53>
+
+008016a9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016b2:	50                   	push   %eax
+  8016b3:	ff 75 08             	push   0x8(%ebp)
+  8016b6:	e8 d3 fb ff ff       	call   80128e <fd_lookup>
+  8016bb:	83 c4 10             	add    $0x10,%esp
+  8016be:	85 c0                	test   %eax,%eax
+  8016c0:	78 0e                	js     8016d0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016d0:	c9                   	leave
+  8016d1:	c3                   	ret
+
+008016d2 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8016d2:	55                   	push   %ebp
+  8016d3:	89 e5                	mov    %esp,%ebp
+  8016d5:	53                   	push   %ebx
+  8016d6:	83 ec 1c             	sub    $0x1c,%esp
+  8016d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016df:	50                   	push   %eax
+  8016e0:	ff 75 08             	push   0x8(%ebp)
+  8016e3:	e8 a6 fb ff ff       	call   80128e <fd_lookup>
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	78 33                	js     801722 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8016ef:	83 fb 03             	cmp    $0x3,%ebx
+  8016f2:	74 28                	je     80171c <fcntl+0x4a>
+  8016f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f9:	83 fb 04             	cmp    $0x4,%ebx
+  8016fc:	75 24                	jne    801722 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8016fe:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801701:	8b 41 08             	mov    0x8(%ecx),%eax
+  801704:	80 e4 ef             	and    $0xef,%ah
+  801707:	8b 55 10             	mov    0x10(%ebp),%edx
+  80170a:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801710:	09 d0                	or     %edx,%eax
+  801712:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171a:	eb 06                	jmp    801722 <fcntl+0x50>
+		return fd->fd_omode;
+  80171c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80171f:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801722:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801725:	c9                   	leave
+  801726:	c3                   	ret
+
+00801727 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801727:	55                   	push   %ebp
+  801728:	89 e5                	mov    %esp,%ebp
+  80172a:	56                   	push   %esi
+  80172b:	53                   	push   %ebx
+  80172c:	83 ec 18             	sub    $0x18,%esp
+  80172f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801732:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801735:	50                   	push   %eax
+  801736:	53                   	push   %ebx
+  801737:	e8 52 fb ff ff       	call   80128e <fd_lookup>
+  80173c:	83 c4 10             	add    $0x10,%esp
+  80173f:	85 c0                	test   %eax,%eax
+  801741:	78 34                	js     801777 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801743:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801746:	83 ec 08             	sub    $0x8,%esp
+  801749:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174c:	50                   	push   %eax
+  80174d:	ff 36                	push   (%esi)
+  80174f:	e8 8c fb ff ff       	call   8012e0 <dev_lookup>
+  801754:	83 c4 10             	add    $0x10,%esp
+  801757:	85 c0                	test   %eax,%eax
+  801759:	78 1c                	js     801777 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80175b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80175f:	74 1d                	je     80177e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801764:	8b 40 18             	mov    0x18(%eax),%eax
+  801767:	85 c0                	test   %eax,%eax
+  801769:	74 51                	je     8017bc <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80176b:	83 ec 08             	sub    $0x8,%esp
+  80176e:	ff 75 0c             	push   0xc(%ebp)
+  801771:	56                   	push   %esi
+  801772:	ff d0                	call   *%eax
+  801774:	83 c4 10             	add    $0x10,%esp
+}
+  801777:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177a:	5b                   	pop    %ebx
+  80177b:	5e                   	pop    %esi
+  80177c:	5d                   	pop    %ebp
+  80177d:	c3                   	ret
+  80177e:	89 e2                	mov    %esp,%edx
+  801780:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801785:	29 d0                	sub    %edx,%eax
+  801787:	89 c2                	mov    %eax,%edx
+  801789:	c1 ea 0f             	shr    $0xf,%edx
+  80178c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801799:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8017a0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017a3:	83 ec 04             	sub    $0x4,%esp
+  8017a6:	53                   	push   %ebx
+  8017a7:	50                   	push   %eax
+  8017a8:	68 f8 3f 80 00       	push   $0x803ff8
+  8017ad:	e8 d7 ea ff ff       	call   800289 <cprintf>
+		return -E_INVAL;
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ba:	eb bb                	jmp    801777 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017bc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017c1:	eb b4                	jmp    801777 <ftruncate+0x50>
+
+008017c3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	56                   	push   %esi
+  8017c7:	53                   	push   %ebx
+  8017c8:	83 ec 18             	sub    $0x18,%esp
+  8017cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017d1:	50                   	push   %eax
+  8017d2:	ff 75 08             	push   0x8(%ebp)
+  8017d5:	e8 b4 fa ff ff       	call   80128e <fd_lookup>
+  8017da:	83 c4 10             	add    $0x10,%esp
+  8017dd:	85 c0                	test   %eax,%eax
+  8017df:	78 53                	js     801834 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017e1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017e4:	83 ec 08             	sub    $0x8,%esp
+  8017e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ea:	50                   	push   %eax
+  8017eb:	ff 36                	push   (%esi)
+  8017ed:	e8 ee fa ff ff       	call   8012e0 <dev_lookup>
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 3b                	js     801834 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8017f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801800:	74 39                	je     80183b <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801802:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801805:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80180c:	00 00 00 
+	stat->st_isdir = 0;
+  80180f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801816:	00 00 00 
+	stat->st_version = 0;
+  801819:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801820:	00 00 00 
+	stat->st_dev = dev;
+  801823:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801829:	83 ec 08             	sub    $0x8,%esp
+  80182c:	53                   	push   %ebx
+  80182d:	56                   	push   %esi
+  80182e:	ff 50 14             	call   *0x14(%eax)
+  801831:	83 c4 10             	add    $0x10,%esp
+}
+  801834:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801837:	5b                   	pop    %ebx
+  801838:	5e                   	pop    %esi
+  801839:	5d                   	pop    %ebp
+  80183a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80183b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801840:	eb f2                	jmp    801834 <fstat+0x71>
+
+00801842 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801842:	55                   	push   %ebp
+  801843:	89 e5                	mov    %esp,%ebp
+  801845:	56                   	push   %esi
+  801846:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801847:	83 ec 08             	sub    $0x8,%esp
+  80184a:	6a 00                	push   $0x0
+  80184c:	ff 75 08             	push   0x8(%ebp)
+  80184f:	e8 b7 01 00 00       	call   801a0b <open>
+  801854:	89 c3                	mov    %eax,%ebx
+  801856:	83 c4 10             	add    $0x10,%esp
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	78 1b                	js     801878 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80185d:	83 ec 08             	sub    $0x8,%esp
+  801860:	ff 75 0c             	push   0xc(%ebp)
+  801863:	50                   	push   %eax
+  801864:	e8 5a ff ff ff       	call   8017c3 <fstat>
+  801869:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80186b:	89 1c 24             	mov    %ebx,(%esp)
+  80186e:	e8 60 fb ff ff       	call   8013d3 <close>
+	return r;
+  801873:	83 c4 10             	add    $0x10,%esp
+  801876:	89 f3                	mov    %esi,%ebx
+}
+  801878:	89 d8                	mov    %ebx,%eax
+  80187a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80187d:	5b                   	pop    %ebx
+  80187e:	5e                   	pop    %esi
+  80187f:	5d                   	pop    %ebp
+  801880:	c3                   	ret
+
+00801881 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801881:	55                   	push   %ebp
+  801882:	89 e5                	mov    %esp,%ebp
+  801884:	56                   	push   %esi
+  801885:	53                   	push   %ebx
+  801886:	89 c6                	mov    %eax,%esi
+  801888:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80188a:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801891:	74 27                	je     8018ba <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801893:	6a 07                	push   $0x7
+  801895:	68 00 70 80 00       	push   $0x807000
+  80189a:	56                   	push   %esi
+  80189b:	ff 35 00 60 80 00    	push   0x806000
+  8018a1:	e8 1f 20 00 00       	call   8038c5 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018a6:	83 c4 0c             	add    $0xc,%esp
+  8018a9:	6a 00                	push   $0x0
+  8018ab:	53                   	push   %ebx
+  8018ac:	6a 00                	push   $0x0
+  8018ae:	e8 82 1d 00 00       	call   803635 <ipc_recv>
+}
+  8018b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b6:	5b                   	pop    %ebx
+  8018b7:	5e                   	pop    %esi
+  8018b8:	5d                   	pop    %ebp
+  8018b9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ba:	83 ec 0c             	sub    $0xc,%esp
+  8018bd:	6a 02                	push   $0x2
+  8018bf:	e8 6a 20 00 00       	call   80392e <ipc_find_env>
+  8018c4:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	eb c5                	jmp    801893 <fsipc+0x12>
+
+008018ce <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018ce:	55                   	push   %ebp
+  8018cf:	89 e5                	mov    %esp,%ebp
+  8018d1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018da:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8018df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018e2:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ec:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018f1:	e8 8b ff ff ff       	call   801881 <fsipc>
+}
+  8018f6:	c9                   	leave
+  8018f7:	c3                   	ret
+
+008018f8 <devfile_flush>:
+{
+  8018f8:	55                   	push   %ebp
+  8018f9:	89 e5                	mov    %esp,%ebp
+  8018fb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801901:	8b 40 0c             	mov    0xc(%eax),%eax
+  801904:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801909:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801913:	e8 69 ff ff ff       	call   801881 <fsipc>
+}
+  801918:	c9                   	leave
+  801919:	c3                   	ret
+
+0080191a <devfile_stat>:
+{
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	53                   	push   %ebx
+  80191e:	83 ec 04             	sub    $0x4,%esp
+  801921:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801924:	8b 45 08             	mov    0x8(%ebp),%eax
+  801927:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192a:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80192f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801934:	b8 05 00 00 00       	mov    $0x5,%eax
+  801939:	e8 43 ff ff ff       	call   801881 <fsipc>
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	78 37                	js     801979 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801942:	83 ec 08             	sub    $0x8,%esp
+  801945:	68 00 70 80 00       	push   $0x807000
+  80194a:	53                   	push   %ebx
+  80194b:	e8 30 f0 ff ff       	call   800980 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801950:	a1 80 70 80 00       	mov    0x807080,%eax
+  801955:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80195b:	a1 84 70 80 00       	mov    0x807084,%eax
+  801960:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801966:	a1 88 70 80 00       	mov    0x807088,%eax
+  80196b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801971:	83 c4 10             	add    $0x10,%esp
+  801974:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801979:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80197c:	c9                   	leave
+  80197d:	c3                   	ret
+
+0080197e <devfile_write>:
+{
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	83 ec 0c             	sub    $0xc,%esp
+  801984:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801987:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80198c:	39 d0                	cmp    %edx,%eax
+  80198e:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801991:	8b 55 08             	mov    0x8(%ebp),%edx
+  801994:	8b 52 0c             	mov    0xc(%edx),%edx
+  801997:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80199d:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8019a2:	50                   	push   %eax
+  8019a3:	ff 75 0c             	push   0xc(%ebp)
+  8019a6:	68 08 70 80 00       	push   $0x807008
+  8019ab:	e8 80 f1 ff ff       	call   800b30 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8019b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019ba:	e8 c2 fe ff ff       	call   801881 <fsipc>
+}
+  8019bf:	c9                   	leave
+  8019c0:	c3                   	ret
+
+008019c1 <devfile_read>:
+{
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	53                   	push   %ebx
+  8019c5:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019cb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ce:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8019d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8019d6:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8019db:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8019e0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019e5:	e8 97 fe ff ff       	call   801881 <fsipc>
+  8019ea:	89 c3                	mov    %eax,%ebx
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	78 14                	js     801a04 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8019f0:	83 ec 04             	sub    $0x4,%esp
+  8019f3:	50                   	push   %eax
+  8019f4:	68 00 70 80 00       	push   $0x807000
+  8019f9:	ff 75 0c             	push   0xc(%ebp)
+  8019fc:	e8 2f f1 ff ff       	call   800b30 <memmove>
+	return r;
+  801a01:	83 c4 10             	add    $0x10,%esp
+}
+  801a04:	89 d8                	mov    %ebx,%eax
+  801a06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a09:	c9                   	leave
+  801a0a:	c3                   	ret
+
+00801a0b <open>:
+{
+  801a0b:	55                   	push   %ebp
+  801a0c:	89 e5                	mov    %esp,%ebp
+  801a0e:	53                   	push   %ebx
+  801a0f:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801a12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a15:	50                   	push   %eax
+  801a16:	e8 23 f8 ff ff       	call   80123e <fd_alloc>
+  801a1b:	89 c3                	mov    %eax,%ebx
+  801a1d:	83 c4 10             	add    $0x10,%esp
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	78 2a                	js     801a4e <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801a24:	83 ec 0c             	sub    $0xc,%esp
+  801a27:	ff 75 08             	push   0x8(%ebp)
+  801a2a:	e8 05 ef ff ff       	call   800934 <strlen>
+  801a2f:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801a32:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801a37:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a3c:	7e 17                	jle    801a55 <open+0x4a>
+	fd_close(fd, 1);
+  801a3e:	83 ec 08             	sub    $0x8,%esp
+  801a41:	6a 01                	push   $0x1
+  801a43:	ff 75 f4             	push   -0xc(%ebp)
+  801a46:	e8 08 f9 ff ff       	call   801353 <fd_close>
+	return r;
+  801a4b:	83 c4 10             	add    $0x10,%esp
+}
+  801a4e:	89 d8                	mov    %ebx,%eax
+  801a50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a53:	c9                   	leave
+  801a54:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a55:	83 ec 08             	sub    $0x8,%esp
+  801a58:	ff 75 08             	push   0x8(%ebp)
+  801a5b:	68 00 70 80 00       	push   $0x807000
+  801a60:	e8 1b ef ff ff       	call   800980 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a68:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a6d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a70:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a75:	e8 07 fe ff ff       	call   801881 <fsipc>
+  801a7a:	89 c3                	mov    %eax,%ebx
+  801a7c:	83 c4 10             	add    $0x10,%esp
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	78 bb                	js     801a3e <open+0x33>
+	return fd2num(fd); 	
+  801a83:	83 ec 0c             	sub    $0xc,%esp
+  801a86:	ff 75 f4             	push   -0xc(%ebp)
+  801a89:	e8 89 f7 ff ff       	call   801217 <fd2num>
+  801a8e:	89 c3                	mov    %eax,%ebx
+  801a90:	83 c4 10             	add    $0x10,%esp
+  801a93:	eb b9                	jmp    801a4e <open+0x43>
+
+00801a95 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801a95:	55                   	push   %ebp
+  801a96:	89 e5                	mov    %esp,%ebp
+  801a98:	53                   	push   %ebx
+  801a99:	83 ec 1c             	sub    $0x1c,%esp
+  801a9c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa2:	50                   	push   %eax
+  801aa3:	ff 75 08             	push   0x8(%ebp)
+  801aa6:	e8 e3 f7 ff ff       	call   80128e <fd_lookup>
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	85 c0                	test   %eax,%eax
+  801ab0:	78 5a                	js     801b0c <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ab2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ab5:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801abb:	39 10                	cmp    %edx,(%eax)
+  801abd:	75 66                	jne    801b25 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801abf:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801ac6:	74 49                	je     801b11 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801ac8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801acb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ace:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801ad3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ad6:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801adb:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ae1:	6a 07                	push   $0x7
+  801ae3:	68 00 70 80 00       	push   $0x807000
+  801ae8:	6a 09                	push   $0x9
+  801aea:	ff 35 00 60 80 00    	push   0x806000
+  801af0:	e8 d0 1d 00 00       	call   8038c5 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801af5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801afc:	6a 00                	push   $0x0
+  801afe:	53                   	push   %ebx
+  801aff:	ff 75 10             	push   0x10(%ebp)
+  801b02:	6a 00                	push   $0x0
+  801b04:	e8 f9 1b 00 00       	call   803702 <ipc_recv_pages>
+  801b09:	83 c4 20             	add    $0x20,%esp
+}
+  801b0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0f:	c9                   	leave
+  801b10:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b11:	83 ec 0c             	sub    $0xc,%esp
+  801b14:	6a 02                	push   $0x2
+  801b16:	e8 13 1e 00 00       	call   80392e <ipc_find_env>
+  801b1b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b20:	83 c4 10             	add    $0x10,%esp
+  801b23:	eb a3                	jmp    801ac8 <fmap+0x33>
+		return -E_INVAL;
+  801b25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2a:	eb e0                	jmp    801b0c <fmap+0x77>
+
+00801b2c <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b2c:	55                   	push   %ebp
+  801b2d:	89 e5                	mov    %esp,%ebp
+  801b2f:	53                   	push   %ebx
+  801b30:	83 ec 10             	sub    $0x10,%esp
+  801b33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b36:	53                   	push   %ebx
+  801b37:	e8 f8 ed ff ff       	call   800934 <strlen>
+  801b3c:	83 c4 10             	add    $0x10,%esp
+  801b3f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b44:	7f 25                	jg     801b6b <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b46:	83 ec 08             	sub    $0x8,%esp
+  801b49:	53                   	push   %ebx
+  801b4a:	68 00 70 80 00       	push   $0x807000
+  801b4f:	e8 2c ee ff ff       	call   800980 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b59:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b5e:	e8 1e fd ff ff       	call   801881 <fsipc>
+  801b63:	83 c4 10             	add    $0x10,%esp
+}
+  801b66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b69:	c9                   	leave
+  801b6a:	c3                   	ret
+		return -E_BAD_PATH;
+  801b6b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b70:	eb f4                	jmp    801b66 <remove+0x3a>
+
+00801b72 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b72:	55                   	push   %ebp
+  801b73:	89 e5                	mov    %esp,%ebp
+  801b75:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b82:	e8 fa fc ff ff       	call   801881 <fsipc>
+}
+  801b87:	c9                   	leave
+  801b88:	c3                   	ret
+
+00801b89 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b89:	55                   	push   %ebp
+  801b8a:	89 e5                	mov    %esp,%ebp
+  801b8c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b8f:	68 68 40 80 00       	push   $0x804068
+  801b94:	ff 75 0c             	push   0xc(%ebp)
+  801b97:	e8 e4 ed ff ff       	call   800980 <strcpy>
+	return 0;
+}
+  801b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba1:	c9                   	leave
+  801ba2:	c3                   	ret
+
+00801ba3 <devsock_close>:
+{
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	53                   	push   %ebx
+  801ba7:	83 ec 10             	sub    $0x10,%esp
+  801baa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801bad:	53                   	push   %ebx
+  801bae:	e8 ba 1d 00 00       	call   80396d <pageref>
+  801bb3:	89 c2                	mov    %eax,%edx
+  801bb5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801bbd:	83 fa 01             	cmp    $0x1,%edx
+  801bc0:	74 05                	je     801bc7 <devsock_close+0x24>
+}
+  801bc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc5:	c9                   	leave
+  801bc6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801bc7:	83 ec 0c             	sub    $0xc,%esp
+  801bca:	ff 73 0c             	push   0xc(%ebx)
+  801bcd:	e8 b0 05 00 00       	call   802182 <nsipc_close>
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	eb eb                	jmp    801bc2 <devsock_close+0x1f>
+
+00801bd7 <devsock_write>:
+{
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	53                   	push   %ebx
+  801bdb:	83 ec 14             	sub    $0x14,%esp
+  801bde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801be1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801be4:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801be7:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801bea:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801bed:	8b 41 08             	mov    0x8(%ecx),%eax
+  801bf0:	c1 f8 09             	sar    $0x9,%eax
+  801bf3:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801bf6:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801bfc:	77 13                	ja     801c11 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801bfe:	50                   	push   %eax
+  801bff:	52                   	push   %edx
+  801c00:	53                   	push   %ebx
+  801c01:	ff 71 0c             	push   0xc(%ecx)
+  801c04:	e8 5c 06 00 00       	call   802265 <nsipc_send>
+  801c09:	83 c4 10             	add    $0x10,%esp
+}
+  801c0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c0f:	c9                   	leave
+  801c10:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c11:	50                   	push   %eax
+  801c12:	6a 01                	push   $0x1
+  801c14:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c17:	50                   	push   %eax
+  801c18:	ff 71 0c             	push   0xc(%ecx)
+  801c1b:	e8 a6 06 00 00       	call   8022c6 <nsipc_sendmsg>
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	eb e7                	jmp    801c0c <devsock_write+0x35>
+
+00801c25 <devsock_read>:
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	53                   	push   %ebx
+  801c29:	83 ec 14             	sub    $0x14,%esp
+  801c2c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c2f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c32:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801c35:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801c38:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c3b:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c3e:	c1 f8 09             	sar    $0x9,%eax
+  801c41:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c44:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c4a:	77 13                	ja     801c5f <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801c4c:	50                   	push   %eax
+  801c4d:	52                   	push   %edx
+  801c4e:	53                   	push   %ebx
+  801c4f:	ff 71 0c             	push   0xc(%ecx)
+  801c52:	e8 9c 05 00 00       	call   8021f3 <nsipc_recv>
+  801c57:	83 c4 10             	add    $0x10,%esp
+}
+  801c5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c5f:	50                   	push   %eax
+  801c60:	6a 01                	push   $0x1
+  801c62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c65:	50                   	push   %eax
+  801c66:	ff 71 0c             	push   0xc(%ecx)
+  801c69:	e8 02 0a 00 00       	call   802670 <nsipc_recvmsg>
+  801c6e:	83 c4 10             	add    $0x10,%esp
+  801c71:	eb e7                	jmp    801c5a <devsock_read+0x35>
+
+00801c73 <fd2sockid>:
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c79:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c7c:	52                   	push   %edx
+  801c7d:	50                   	push   %eax
+  801c7e:	e8 0b f6 ff ff       	call   80128e <fd_lookup>
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 10                	js     801c9a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c8d:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801c93:	39 08                	cmp    %ecx,(%eax)
+  801c95:	75 05                	jne    801c9c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c97:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c9c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ca1:	eb f7                	jmp    801c9a <fd2sockid+0x27>
+
+00801ca3 <sock_flags>:
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801ca9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cac:	52                   	push   %edx
+  801cad:	50                   	push   %eax
+  801cae:	e8 db f5 ff ff       	call   80128e <fd_lookup>
+  801cb3:	83 c4 10             	add    $0x10,%esp
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	78 0e                	js     801cc8 <sock_flags+0x25>
+  801cba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cbd:	8b 40 08             	mov    0x8(%eax),%eax
+  801cc0:	c1 e8 09             	shr    $0x9,%eax
+  801cc3:	83 e0 08             	and    $0x8,%eax
+}
+  801cc6:	c9                   	leave
+  801cc7:	c3                   	ret
+		return 0;
+  801cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccd:	eb f7                	jmp    801cc6 <sock_flags+0x23>
+
+00801ccf <alloc_sockfd>:
+{
+  801ccf:	55                   	push   %ebp
+  801cd0:	89 e5                	mov    %esp,%ebp
+  801cd2:	56                   	push   %esi
+  801cd3:	53                   	push   %ebx
+  801cd4:	83 ec 1c             	sub    $0x1c,%esp
+  801cd7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cdc:	50                   	push   %eax
+  801cdd:	e8 5c f5 ff ff       	call   80123e <fd_alloc>
+  801ce2:	89 c3                	mov    %eax,%ebx
+  801ce4:	83 c4 10             	add    $0x10,%esp
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	78 43                	js     801d2e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ceb:	83 ec 04             	sub    $0x4,%esp
+  801cee:	68 07 04 00 00       	push   $0x407
+  801cf3:	ff 75 f4             	push   -0xc(%ebp)
+  801cf6:	6a 00                	push   $0x0
+  801cf8:	e8 b7 f0 ff ff       	call   800db4 <sys_page_alloc>
+  801cfd:	89 c3                	mov    %eax,%ebx
+  801cff:	83 c4 10             	add    $0x10,%esp
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	78 28                	js     801d2e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d09:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801d0f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d14:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d1b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d1e:	83 ec 0c             	sub    $0xc,%esp
+  801d21:	50                   	push   %eax
+  801d22:	e8 f0 f4 ff ff       	call   801217 <fd2num>
+  801d27:	89 c3                	mov    %eax,%ebx
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	eb 0c                	jmp    801d3a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d2e:	83 ec 0c             	sub    $0xc,%esp
+  801d31:	56                   	push   %esi
+  801d32:	e8 4b 04 00 00       	call   802182 <nsipc_close>
+		return r;
+  801d37:	83 c4 10             	add    $0x10,%esp
+}
+  801d3a:	89 d8                	mov    %ebx,%eax
+  801d3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d3f:	5b                   	pop    %ebx
+  801d40:	5e                   	pop    %esi
+  801d41:	5d                   	pop    %ebp
+  801d42:	c3                   	ret
+
+00801d43 <accept>:
+{
+  801d43:	55                   	push   %ebp
+  801d44:	89 e5                	mov    %esp,%ebp
+  801d46:	56                   	push   %esi
+  801d47:	53                   	push   %ebx
+  801d48:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d4b:	89 f0                	mov    %esi,%eax
+  801d4d:	e8 21 ff ff ff       	call   801c73 <fd2sockid>
+  801d52:	89 c3                	mov    %eax,%ebx
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	78 24                	js     801d7c <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801d58:	89 f0                	mov    %esi,%eax
+  801d5a:	e8 44 ff ff ff       	call   801ca3 <sock_flags>
+  801d5f:	50                   	push   %eax
+  801d60:	ff 75 10             	push   0x10(%ebp)
+  801d63:	ff 75 0c             	push   0xc(%ebp)
+  801d66:	53                   	push   %ebx
+  801d67:	e8 6b 03 00 00       	call   8020d7 <nsipc_accept>
+  801d6c:	89 c3                	mov    %eax,%ebx
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 07                	js     801d7c <accept+0x39>
+	return alloc_sockfd(r);
+  801d75:	e8 55 ff ff ff       	call   801ccf <alloc_sockfd>
+  801d7a:	89 c3                	mov    %eax,%ebx
+}
+  801d7c:	89 d8                	mov    %ebx,%eax
+  801d7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d81:	5b                   	pop    %ebx
+  801d82:	5e                   	pop    %esi
+  801d83:	5d                   	pop    %ebp
+  801d84:	c3                   	ret
+
+00801d85 <bind>:
+{
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8e:	e8 e0 fe ff ff       	call   801c73 <fd2sockid>
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	78 12                	js     801da9 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d97:	83 ec 04             	sub    $0x4,%esp
+  801d9a:	ff 75 10             	push   0x10(%ebp)
+  801d9d:	ff 75 0c             	push   0xc(%ebp)
+  801da0:	50                   	push   %eax
+  801da1:	e8 85 03 00 00       	call   80212b <nsipc_bind>
+  801da6:	83 c4 10             	add    $0x10,%esp
+}
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+
+00801dab <shutdown>:
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db4:	e8 ba fe ff ff       	call   801c73 <fd2sockid>
+  801db9:	85 c0                	test   %eax,%eax
+  801dbb:	78 0f                	js     801dcc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dbd:	83 ec 08             	sub    $0x8,%esp
+  801dc0:	ff 75 0c             	push   0xc(%ebp)
+  801dc3:	50                   	push   %eax
+  801dc4:	e8 97 03 00 00       	call   802160 <nsipc_shutdown>
+  801dc9:	83 c4 10             	add    $0x10,%esp
+}
+  801dcc:	c9                   	leave
+  801dcd:	c3                   	ret
+
+00801dce <connect>:
+{
+  801dce:	55                   	push   %ebp
+  801dcf:	89 e5                	mov    %esp,%ebp
+  801dd1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd7:	e8 97 fe ff ff       	call   801c73 <fd2sockid>
+  801ddc:	85 c0                	test   %eax,%eax
+  801dde:	78 12                	js     801df2 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801de0:	83 ec 04             	sub    $0x4,%esp
+  801de3:	ff 75 10             	push   0x10(%ebp)
+  801de6:	ff 75 0c             	push   0xc(%ebp)
+  801de9:	50                   	push   %eax
+  801dea:	e8 ad 03 00 00       	call   80219c <nsipc_connect>
+  801def:	83 c4 10             	add    $0x10,%esp
+}
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+00801df4 <listen>:
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfd:	e8 71 fe ff ff       	call   801c73 <fd2sockid>
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	78 0f                	js     801e15 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e06:	83 ec 08             	sub    $0x8,%esp
+  801e09:	ff 75 0c             	push   0xc(%ebp)
+  801e0c:	50                   	push   %eax
+  801e0d:	e8 bf 03 00 00       	call   8021d1 <nsipc_listen>
+  801e12:	83 c4 10             	add    $0x10,%esp
+}
+  801e15:	c9                   	leave
+  801e16:	c3                   	ret
+
+00801e17 <sendmsg>:
+{
+  801e17:	55                   	push   %ebp
+  801e18:	89 e5                	mov    %esp,%ebp
+  801e1a:	57                   	push   %edi
+  801e1b:	56                   	push   %esi
+  801e1c:	53                   	push   %ebx
+  801e1d:	83 ec 0c             	sub    $0xc,%esp
+  801e20:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e23:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801e26:	89 f0                	mov    %esi,%eax
+  801e28:	e8 46 fe ff ff       	call   801c73 <fd2sockid>
+  801e2d:	89 c3                	mov    %eax,%ebx
+  801e2f:	85 c0                	test   %eax,%eax
+  801e31:	78 1c                	js     801e4f <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801e33:	89 f0                	mov    %esi,%eax
+  801e35:	e8 69 fe ff ff       	call   801ca3 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e3a:	0b 45 10             	or     0x10(%ebp),%eax
+  801e3d:	50                   	push   %eax
+  801e3e:	ff 77 0c             	push   0xc(%edi)
+  801e41:	ff 77 08             	push   0x8(%edi)
+  801e44:	53                   	push   %ebx
+  801e45:	e8 7c 04 00 00       	call   8022c6 <nsipc_sendmsg>
+  801e4a:	89 c3                	mov    %eax,%ebx
+  801e4c:	83 c4 10             	add    $0x10,%esp
+}
+  801e4f:	89 d8                	mov    %ebx,%eax
+  801e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e54:	5b                   	pop    %ebx
+  801e55:	5e                   	pop    %esi
+  801e56:	5f                   	pop    %edi
+  801e57:	5d                   	pop    %ebp
+  801e58:	c3                   	ret
+
+00801e59 <recvmsg>:
+{
+  801e59:	55                   	push   %ebp
+  801e5a:	89 e5                	mov    %esp,%ebp
+  801e5c:	57                   	push   %edi
+  801e5d:	56                   	push   %esi
+  801e5e:	53                   	push   %ebx
+  801e5f:	83 ec 0c             	sub    $0xc,%esp
+  801e62:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e65:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e68:	89 f8                	mov    %edi,%eax
+  801e6a:	e8 04 fe ff ff       	call   801c73 <fd2sockid>
+  801e6f:	89 c3                	mov    %eax,%ebx
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 2a                	js     801e9f <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801e75:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801e7c:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801e83:	89 f8                	mov    %edi,%eax
+  801e85:	e8 19 fe ff ff       	call   801ca3 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e8a:	0b 45 10             	or     0x10(%ebp),%eax
+  801e8d:	50                   	push   %eax
+  801e8e:	ff 76 0c             	push   0xc(%esi)
+  801e91:	ff 76 08             	push   0x8(%esi)
+  801e94:	53                   	push   %ebx
+  801e95:	e8 d6 07 00 00       	call   802670 <nsipc_recvmsg>
+  801e9a:	89 c3                	mov    %eax,%ebx
+  801e9c:	83 c4 10             	add    $0x10,%esp
+}
+  801e9f:	89 d8                	mov    %ebx,%eax
+  801ea1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea4:	5b                   	pop    %ebx
+  801ea5:	5e                   	pop    %esi
+  801ea6:	5f                   	pop    %edi
+  801ea7:	5d                   	pop    %ebp
+  801ea8:	c3                   	ret
+
+00801ea9 <sendfile>:
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	56                   	push   %esi
+  801ead:	53                   	push   %ebx
+  801eae:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801eb1:	89 f0                	mov    %esi,%eax
+  801eb3:	e8 bb fd ff ff       	call   801c73 <fd2sockid>
+  801eb8:	89 c3                	mov    %eax,%ebx
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 1f                	js     801edd <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801ebe:	89 f0                	mov    %esi,%eax
+  801ec0:	e8 de fd ff ff       	call   801ca3 <sock_flags>
+  801ec5:	83 ec 0c             	sub    $0xc,%esp
+  801ec8:	50                   	push   %eax
+  801ec9:	ff 75 14             	push   0x14(%ebp)
+  801ecc:	ff 75 10             	push   0x10(%ebp)
+  801ecf:	ff 75 0c             	push   0xc(%ebp)
+  801ed2:	53                   	push   %ebx
+  801ed3:	e8 64 06 00 00       	call   80253c <nsipc_sendfile>
+  801ed8:	89 c3                	mov    %eax,%ebx
+  801eda:	83 c4 20             	add    $0x20,%esp
+}
+  801edd:	89 d8                	mov    %ebx,%eax
+  801edf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee2:	5b                   	pop    %ebx
+  801ee3:	5e                   	pop    %esi
+  801ee4:	5d                   	pop    %ebp
+  801ee5:	c3                   	ret
+
+00801ee6 <evctl>:
+{
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	53                   	push   %ebx
+  801eea:	83 ec 04             	sub    $0x4,%esp
+  801eed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801ef0:	89 d8                	mov    %ebx,%eax
+  801ef2:	e8 7c fd ff ff       	call   801c73 <fd2sockid>
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	78 10                	js     801f0b <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801efb:	83 ec 04             	sub    $0x4,%esp
+  801efe:	53                   	push   %ebx
+  801eff:	ff 75 0c             	push   0xc(%ebp)
+  801f02:	50                   	push   %eax
+  801f03:	e8 d2 0b 00 00       	call   802ada <nsipc_evctl>
+  801f08:	83 c4 10             	add    $0x10,%esp
+}
+  801f0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f0e:	c9                   	leave
+  801f0f:	c3                   	ret
+
+00801f10 <evwait>:
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801f16:	ff 75 10             	push   0x10(%ebp)
+  801f19:	ff 75 0c             	push   0xc(%ebp)
+  801f1c:	ff 75 08             	push   0x8(%ebp)
+  801f1f:	e8 e0 0b 00 00       	call   802b04 <nsipc_evwait>
+}
+  801f24:	c9                   	leave
+  801f25:	c3                   	ret
+
+00801f26 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801f26:	55                   	push   %ebp
+  801f27:	89 e5                	mov    %esp,%ebp
+  801f29:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f2c:	ff 75 10             	push   0x10(%ebp)
+  801f2f:	ff 75 0c             	push   0xc(%ebp)
+  801f32:	ff 75 08             	push   0x8(%ebp)
+  801f35:	e8 31 0c 00 00       	call   802b6b <nsipc_socket>
+  801f3a:	83 c4 10             	add    $0x10,%esp
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	78 05                	js     801f46 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f41:	e8 89 fd ff ff       	call   801ccf <alloc_sockfd>
+}
+  801f46:	c9                   	leave
+  801f47:	c3                   	ret
+
+00801f48 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	53                   	push   %ebx
+  801f4c:	83 ec 04             	sub    $0x4,%esp
+  801f4f:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801f51:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801f58:	74 26                	je     801f80 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f5a:	6a 07                	push   $0x7
+  801f5c:	68 00 80 80 00       	push   $0x808000
+  801f61:	53                   	push   %ebx
+  801f62:	ff 35 24 63 80 00    	push   0x806324
+  801f68:	e8 58 19 00 00       	call   8038c5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f6d:	83 c4 0c             	add    $0xc,%esp
+  801f70:	6a 00                	push   $0x0
+  801f72:	6a 00                	push   $0x0
+  801f74:	6a 00                	push   $0x0
+  801f76:	e8 ba 16 00 00       	call   803635 <ipc_recv>
+}
+  801f7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f7e:	c9                   	leave
+  801f7f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f80:	83 ec 0c             	sub    $0xc,%esp
+  801f83:	6a 03                	push   $0x3
+  801f85:	e8 a4 19 00 00       	call   80392e <ipc_find_env>
+  801f8a:	a3 24 63 80 00       	mov    %eax,0x806324
+  801f8f:	83 c4 10             	add    $0x10,%esp
+  801f92:	eb c6                	jmp    801f5a <nsipc+0x12>
+
+00801f94 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	56                   	push   %esi
+  801f98:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801f99:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  801f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801fa4:	85 f6                	test   %esi,%esi
+  801fa6:	75 33                	jne    801fdb <nsbulk_map+0x47>
+  801fa8:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801fad:	83 ec 04             	sub    $0x4,%esp
+  801fb0:	6a 07                	push   $0x7
+  801fb2:	53                   	push   %ebx
+  801fb3:	6a 00                	push   $0x0
+  801fb5:	e8 fa ed ff ff       	call   800db4 <sys_page_alloc>
+  801fba:	83 c4 10             	add    $0x10,%esp
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	78 1a                	js     801fdb <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801fc1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fc7:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801fcd:	75 de                	jne    801fad <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801fcf:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  801fd6:	00 00 00 
+	return 0;
+  801fd9:	89 f0                	mov    %esi,%eax
+}
+  801fdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fde:	5b                   	pop    %ebx
+  801fdf:	5e                   	pop    %esi
+  801fe0:	5d                   	pop    %ebp
+  801fe1:	c3                   	ret
+
+00801fe2 <nsbulk_own>:
+{
+  801fe2:	55                   	push   %ebp
+  801fe3:	89 e5                	mov    %esp,%ebp
+  801fe5:	57                   	push   %edi
+  801fe6:	56                   	push   %esi
+  801fe7:	53                   	push   %ebx
+  801fe8:	83 ec 0c             	sub    $0xc,%esp
+  801feb:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801fed:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801ff0:	85 d2                	test   %edx,%edx
+  801ff2:	7f 0e                	jg     802002 <nsbulk_own+0x20>
+	return 0;
+  801ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff9:	eb 47                	jmp    802042 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801ffb:	83 c3 01             	add    $0x1,%ebx
+  801ffe:	39 fb                	cmp    %edi,%ebx
+  802000:	7d 3b                	jge    80203d <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802002:	be 01 00 00 00       	mov    $0x1,%esi
+  802007:	89 d9                	mov    %ebx,%ecx
+  802009:	d3 e6                	shl    %cl,%esi
+  80200b:	89 f0                	mov    %esi,%eax
+  80200d:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  802013:	74 e6                	je     801ffb <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802015:	83 ec 04             	sub    $0x4,%esp
+  802018:	6a 07                	push   $0x7
+  80201a:	89 d8                	mov    %ebx,%eax
+  80201c:	c1 e0 0c             	shl    $0xc,%eax
+  80201f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802024:	50                   	push   %eax
+  802025:	6a 00                	push   $0x0
+  802027:	e8 88 ed ff ff       	call   800db4 <sys_page_alloc>
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 0f                	js     802042 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802033:	f7 d6                	not    %esi
+  802035:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  80203b:	eb be                	jmp    801ffb <nsbulk_own+0x19>
+	return 0;
+  80203d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802042:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802045:	5b                   	pop    %ebx
+  802046:	5e                   	pop    %esi
+  802047:	5f                   	pop    %edi
+  802048:	5d                   	pop    %ebp
+  802049:	c3                   	ret
+
+0080204a <nsipc_bulk>:
+{
+  80204a:	55                   	push   %ebp
+  80204b:	89 e5                	mov    %esp,%ebp
+  80204d:	57                   	push   %edi
+  80204e:	56                   	push   %esi
+  80204f:	53                   	push   %ebx
+  802050:	83 ec 1c             	sub    $0x1c,%esp
+  802053:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802056:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802058:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80205e:	c1 fb 0c             	sar    $0xc,%ebx
+  802061:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802064:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80206b:	74 56                	je     8020c3 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80206d:	85 ff                	test   %edi,%edi
+  80206f:	7e 24                	jle    802095 <nsipc_bulk+0x4b>
+  802071:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802077:	74 1c                	je     802095 <nsipc_bulk+0x4b>
+  802079:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80207f:	c1 e3 0c             	shl    $0xc,%ebx
+  802082:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802087:	0f b6 10             	movzbl (%eax),%edx
+  80208a:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80208c:	05 00 10 00 00       	add    $0x1000,%eax
+  802091:	39 d8                	cmp    %ebx,%eax
+  802093:	75 f2                	jne    802087 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802095:	83 ec 0c             	sub    $0xc,%esp
+  802098:	56                   	push   %esi
+  802099:	57                   	push   %edi
+  80209a:	68 00 00 00 e0       	push   $0xe0000000
+  80209f:	ff 75 e4             	push   -0x1c(%ebp)
+  8020a2:	ff 35 24 63 80 00    	push   0x806324
+  8020a8:	e8 4c 18 00 00       	call   8038f9 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8020ad:	83 c4 1c             	add    $0x1c,%esp
+  8020b0:	6a 00                	push   $0x0
+  8020b2:	6a 00                	push   $0x0
+  8020b4:	6a 00                	push   $0x0
+  8020b6:	e8 7a 15 00 00       	call   803635 <ipc_recv>
+}
+  8020bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020be:	5b                   	pop    %ebx
+  8020bf:	5e                   	pop    %esi
+  8020c0:	5f                   	pop    %edi
+  8020c1:	5d                   	pop    %ebp
+  8020c2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8020c3:	83 ec 0c             	sub    $0xc,%esp
+  8020c6:	6a 03                	push   $0x3
+  8020c8:	e8 61 18 00 00       	call   80392e <ipc_find_env>
+  8020cd:	a3 24 63 80 00       	mov    %eax,0x806324
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	eb 96                	jmp    80206d <nsipc_bulk+0x23>
+
+008020d7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	53                   	push   %ebx
+  8020db:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8020de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8020e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e9:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8020ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020f3:	e8 50 fe ff ff       	call   801f48 <nsipc>
+  8020f8:	89 c3                	mov    %eax,%ebx
+  8020fa:	85 c0                	test   %eax,%eax
+  8020fc:	79 07                	jns    802105 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8020fe:	89 d8                	mov    %ebx,%eax
+  802100:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802103:	c9                   	leave
+  802104:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802105:	83 ec 04             	sub    $0x4,%esp
+  802108:	ff 35 10 80 80 00    	push   0x808010
+  80210e:	68 00 80 80 00       	push   $0x808000
+  802113:	ff 75 0c             	push   0xc(%ebp)
+  802116:	e8 15 ea ff ff       	call   800b30 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80211b:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802121:	8b 45 10             	mov    0x10(%ebp),%eax
+  802124:	89 10                	mov    %edx,(%eax)
+  802126:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802129:	eb d3                	jmp    8020fe <nsipc_accept+0x27>
+
+0080212b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80212b:	55                   	push   %ebp
+  80212c:	89 e5                	mov    %esp,%ebp
+  80212e:	53                   	push   %ebx
+  80212f:	83 ec 08             	sub    $0x8,%esp
+  802132:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802135:	8b 45 08             	mov    0x8(%ebp),%eax
+  802138:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80213d:	53                   	push   %ebx
+  80213e:	ff 75 0c             	push   0xc(%ebp)
+  802141:	68 04 80 80 00       	push   $0x808004
+  802146:	e8 e5 e9 ff ff       	call   800b30 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80214b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802151:	b8 02 00 00 00       	mov    $0x2,%eax
+  802156:	e8 ed fd ff ff       	call   801f48 <nsipc>
+}
+  80215b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80215e:	c9                   	leave
+  80215f:	c3                   	ret
+
+00802160 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802160:	55                   	push   %ebp
+  802161:	89 e5                	mov    %esp,%ebp
+  802163:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802166:	8b 45 08             	mov    0x8(%ebp),%eax
+  802169:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80216e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802171:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802176:	b8 03 00 00 00       	mov    $0x3,%eax
+  80217b:	e8 c8 fd ff ff       	call   801f48 <nsipc>
+}
+  802180:	c9                   	leave
+  802181:	c3                   	ret
+
+00802182 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802182:	55                   	push   %ebp
+  802183:	89 e5                	mov    %esp,%ebp
+  802185:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802188:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802190:	b8 04 00 00 00       	mov    $0x4,%eax
+  802195:	e8 ae fd ff ff       	call   801f48 <nsipc>
+}
+  80219a:	c9                   	leave
+  80219b:	c3                   	ret
+
+0080219c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80219c:	55                   	push   %ebp
+  80219d:	89 e5                	mov    %esp,%ebp
+  80219f:	53                   	push   %ebx
+  8021a0:	83 ec 08             	sub    $0x8,%esp
+  8021a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8021a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a9:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8021ae:	53                   	push   %ebx
+  8021af:	ff 75 0c             	push   0xc(%ebp)
+  8021b2:	68 04 80 80 00       	push   $0x808004
+  8021b7:	e8 74 e9 ff ff       	call   800b30 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8021bc:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8021c2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021c7:	e8 7c fd ff ff       	call   801f48 <nsipc>
+}
+  8021cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+
+008021d1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8021d1:	55                   	push   %ebp
+  8021d2:	89 e5                	mov    %esp,%ebp
+  8021d4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8021d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021da:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8021df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021e2:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8021e7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021ec:	e8 57 fd ff ff       	call   801f48 <nsipc>
+}
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+
+008021f3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	56                   	push   %esi
+  8021f7:	53                   	push   %ebx
+  8021f8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8021fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fe:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802203:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802209:	8b 45 14             	mov    0x14(%ebp),%eax
+  80220c:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802211:	b8 07 00 00 00       	mov    $0x7,%eax
+  802216:	e8 2d fd ff ff       	call   801f48 <nsipc>
+  80221b:	89 c3                	mov    %eax,%ebx
+  80221d:	85 c0                	test   %eax,%eax
+  80221f:	78 22                	js     802243 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802221:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802226:	39 c6                	cmp    %eax,%esi
+  802228:	0f 4e c6             	cmovle %esi,%eax
+  80222b:	39 c3                	cmp    %eax,%ebx
+  80222d:	7f 1d                	jg     80224c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80222f:	83 ec 04             	sub    $0x4,%esp
+  802232:	53                   	push   %ebx
+  802233:	68 00 80 80 00       	push   $0x808000
+  802238:	ff 75 0c             	push   0xc(%ebp)
+  80223b:	e8 f0 e8 ff ff       	call   800b30 <memmove>
+  802240:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802243:	89 d8                	mov    %ebx,%eax
+  802245:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802248:	5b                   	pop    %ebx
+  802249:	5e                   	pop    %esi
+  80224a:	5d                   	pop    %ebp
+  80224b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80224c:	68 74 40 80 00       	push   $0x804074
+  802251:	68 89 40 80 00       	push   $0x804089
+  802256:	68 b2 00 00 00       	push   $0xb2
+  80225b:	68 9e 40 80 00       	push   $0x80409e
+  802260:	e8 8a 13 00 00       	call   8035ef <_panic>
+
+00802265 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802265:	55                   	push   %ebp
+  802266:	89 e5                	mov    %esp,%ebp
+  802268:	53                   	push   %ebx
+  802269:	83 ec 04             	sub    $0x4,%esp
+  80226c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80226f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802272:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802277:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80227d:	7f 2e                	jg     8022ad <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80227f:	83 ec 04             	sub    $0x4,%esp
+  802282:	53                   	push   %ebx
+  802283:	ff 75 0c             	push   0xc(%ebp)
+  802286:	68 0c 80 80 00       	push   $0x80800c
+  80228b:	e8 a0 e8 ff ff       	call   800b30 <memmove>
+	nsipcbuf.send.req_size = size;
+  802290:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802296:	8b 45 14             	mov    0x14(%ebp),%eax
+  802299:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80229e:	b8 08 00 00 00       	mov    $0x8,%eax
+  8022a3:	e8 a0 fc ff ff       	call   801f48 <nsipc>
+}
+  8022a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ab:	c9                   	leave
+  8022ac:	c3                   	ret
+	assert(size < 1600);
+  8022ad:	68 aa 40 80 00       	push   $0x8040aa
+  8022b2:	68 89 40 80 00       	push   $0x804089
+  8022b7:	68 bd 00 00 00       	push   $0xbd
+  8022bc:	68 9e 40 80 00       	push   $0x80409e
+  8022c1:	e8 29 13 00 00       	call   8035ef <_panic>
+
+008022c6 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	57                   	push   %edi
+  8022ca:	56                   	push   %esi
+  8022cb:	53                   	push   %ebx
+  8022cc:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8022cf:	e8 c0 fc ff ff       	call   801f94 <nsbulk_map>
+  8022d4:	85 c0                	test   %eax,%eax
+  8022d6:	78 55                	js     80232d <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8022d8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8022df:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8022e6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8022ed:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8022f0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8022f3:	0f 8d 24 02 00 00    	jge    80251d <nsipc_sendmsg+0x257>
+  8022f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022fc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8022ff:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802302:	89 d8                	mov    %ebx,%eax
+  802304:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802309:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80230b:	83 ec 0c             	sub    $0xc,%esp
+  80230e:	68 20 60 80 00       	push   $0x806020
+  802313:	e8 5a 0f 00 00       	call   803272 <pgbatch_init>
+  802318:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80231b:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80231d:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802320:	e9 82 00 00 00       	jmp    8023a7 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802325:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802328:	85 db                	test   %ebx,%ebx
+  80232a:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  80232d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802330:	5b                   	pop    %ebx
+  802331:	5e                   	pop    %esi
+  802332:	5f                   	pop    %edi
+  802333:	5d                   	pop    %ebp
+  802334:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802335:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80233a:	29 c8                	sub    %ecx,%eax
+  80233c:	39 d0                	cmp    %edx,%eax
+  80233e:	0f 46 d0             	cmovbe %eax,%edx
+  802341:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802343:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802349:	85 ff                	test   %edi,%edi
+  80234b:	0f 49 c7             	cmovns %edi,%eax
+  80234e:	c1 f8 0c             	sar    $0xc,%eax
+  802351:	ba 01 00 00 00       	mov    $0x1,%edx
+  802356:	e8 87 fc ff ff       	call   801fe2 <nsbulk_own>
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	0f 88 17 01 00 00    	js     80247a <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802363:	83 ec 04             	sub    $0x4,%esp
+  802366:	56                   	push   %esi
+  802367:	ff 75 e0             	push   -0x20(%ebp)
+  80236a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80236d:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802372:	50                   	push   %eax
+  802373:	e8 b8 e7 ff ff       	call   800b30 <memmove>
+  802378:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80237b:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80237e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802381:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802384:	0f 84 fd 00 00 00    	je     802487 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80238a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80238d:	01 f7                	add    %esi,%edi
+  80238f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802392:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802395:	0f 8d 01 01 00 00    	jge    80249c <nsipc_sendmsg+0x1d6>
+  80239b:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8023a1:	0f 8f f0 00 00 00    	jg     802497 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8023a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023aa:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8023ad:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8023b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023b3:	89 c2                	mov    %eax,%edx
+  8023b5:	03 13                	add    (%ebx),%edx
+  8023b7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8023ba:	8b 73 04             	mov    0x4(%ebx),%esi
+  8023bd:	29 c6                	sub    %eax,%esi
+  8023bf:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8023c4:	29 f9                	sub    %edi,%ecx
+  8023c6:	39 ce                	cmp    %ecx,%esi
+  8023c8:	89 ca                	mov    %ecx,%edx
+  8023ca:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8023cd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8023d0:	89 f9                	mov    %edi,%ecx
+  8023d2:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8023d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023db:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023e0:	09 c8                	or     %ecx,%eax
+  8023e2:	0f 85 4d ff ff ff    	jne    802335 <nsipc_sendmsg+0x6f>
+  8023e8:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8023ee:	0f 86 41 ff ff ff    	jbe    802335 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023f4:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8023fa:	85 ff                	test   %edi,%edi
+  8023fc:	0f 49 c7             	cmovns %edi,%eax
+  8023ff:	c1 f8 0c             	sar    $0xc,%eax
+  802402:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802404:	89 d1                	mov    %edx,%ecx
+  802406:	c1 e9 0c             	shr    $0xc,%ecx
+  802409:	01 c8                	add    %ecx,%eax
+  80240b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80240e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802411:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802413:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802416:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80241b:	29 c8                	sub    %ecx,%eax
+  80241d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802420:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802423:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802425:	b8 01 00 00 00       	mov    $0x1,%eax
+  80242a:	89 f9                	mov    %edi,%ecx
+  80242c:	d3 e0                	shl    %cl,%eax
+  80242e:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802434:	83 ec 08             	sub    $0x8,%esp
+  802437:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802439:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80243c:	50                   	push   %eax
+  80243d:	6a 00                	push   $0x0
+  80243f:	56                   	push   %esi
+  802440:	6a 00                	push   $0x0
+  802442:	68 20 60 80 00       	push   $0x806020
+  802447:	e8 e4 0e 00 00       	call   803330 <pgbatch_map>
+  80244c:	83 c4 20             	add    $0x20,%esp
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	0f 88 ce fe ff ff    	js     802325 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802457:	83 c7 01             	add    $0x1,%edi
+  80245a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802460:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802463:	39 c7                	cmp    %eax,%edi
+  802465:	75 be                	jne    802425 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802467:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80246a:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80246d:	89 d6                	mov    %edx,%esi
+  80246f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802475:	e9 01 ff ff ff       	jmp    80237b <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80247a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80247d:	85 db                	test   %ebx,%ebx
+  80247f:	0f 45 c3             	cmovne %ebx,%eax
+  802482:	e9 a6 fe ff ff       	jmp    80232d <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802487:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80248b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802492:	e9 f3 fe ff ff       	jmp    80238a <nsipc_sendmsg+0xc4>
+  802497:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80249a:	eb 03                	jmp    80249f <nsipc_sendmsg+0x1d9>
+  80249c:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80249f:	83 ec 0c             	sub    $0xc,%esp
+  8024a2:	68 20 60 80 00       	push   $0x806020
+  8024a7:	e8 d4 0d 00 00       	call   803280 <pgbatch_flush>
+  8024ac:	83 c4 10             	add    $0x10,%esp
+  8024af:	85 c0                	test   %eax,%eax
+  8024b1:	78 50                	js     802503 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8024b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8024bb:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8024c1:	89 fb                	mov    %edi,%ebx
+  8024c3:	29 f3                	sub    %esi,%ebx
+  8024c5:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8024cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ce:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8024d3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8024d8:	89 fa                	mov    %edi,%edx
+  8024da:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8024df:	e8 66 fb ff ff       	call   80204a <nsipc_bulk>
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	78 28                	js     802510 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8024e8:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8024eb:	39 c3                	cmp    %eax,%ebx
+  8024ed:	75 0c                	jne    8024fb <nsipc_sendmsg+0x235>
+  8024ef:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024f2:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8024f5:	0f 8f f2 fd ff ff    	jg     8022ed <nsipc_sendmsg+0x27>
+		sent += r;
+  8024fb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8024fe:	e9 2a fe ff ff       	jmp    80232d <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802503:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802506:	85 db                	test   %ebx,%ebx
+  802508:	0f 45 c3             	cmovne %ebx,%eax
+  80250b:	e9 1d fe ff ff       	jmp    80232d <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802510:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802513:	85 db                	test   %ebx,%ebx
+  802515:	0f 45 c3             	cmovne %ebx,%eax
+  802518:	e9 10 fe ff ff       	jmp    80232d <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  80251d:	83 ec 0c             	sub    $0xc,%esp
+  802520:	68 20 60 80 00       	push   $0x806020
+  802525:	e8 48 0d 00 00       	call   803272 <pgbatch_init>
+  80252a:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80252d:	be 00 00 00 00       	mov    $0x0,%esi
+  802532:	bf 00 00 00 00       	mov    $0x0,%edi
+  802537:	e9 63 ff ff ff       	jmp    80249f <nsipc_sendmsg+0x1d9>
+
+0080253c <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80253c:	55                   	push   %ebp
+  80253d:	89 e5                	mov    %esp,%ebp
+  80253f:	57                   	push   %edi
+  802540:	56                   	push   %esi
+  802541:	53                   	push   %ebx
+  802542:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802545:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  80254c:	0f 84 c8 00 00 00    	je     80261a <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802552:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802559:	0f 84 e4 00 00 00    	je     802643 <nsipc_sendfile+0x107>
+{
+  80255f:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802564:	89 fb                	mov    %edi,%ebx
+  802566:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802569:	0f 83 f0 00 00 00    	jae    80265f <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80256f:	89 fa                	mov    %edi,%edx
+  802571:	03 55 10             	add    0x10(%ebp),%edx
+  802574:	89 d0                	mov    %edx,%eax
+  802576:	c1 f8 1f             	sar    $0x1f,%eax
+  802579:	c1 e8 14             	shr    $0x14,%eax
+  80257c:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80257f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802585:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802587:	6a 10                	push   $0x10
+  802589:	68 00 20 01 e0       	push   $0xe0012000
+  80258e:	52                   	push   %edx
+  80258f:	ff 75 0c             	push   0xc(%ebp)
+  802592:	e8 fe f4 ff ff       	call   801a95 <fmap>
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	85 c0                	test   %eax,%eax
+  80259c:	0f 8e b8 00 00 00    	jle    80265a <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8025a2:	39 c6                	cmp    %eax,%esi
+  8025a4:	0f 8d b5 00 00 00    	jge    80265f <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8025aa:	29 f0                	sub    %esi,%eax
+  8025ac:	8b 55 14             	mov    0x14(%ebp),%edx
+  8025af:	29 da                	sub    %ebx,%edx
+  8025b1:	39 d0                	cmp    %edx,%eax
+  8025b3:	89 d3                	mov    %edx,%ebx
+  8025b5:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8025b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025bb:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8025c0:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8025c6:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8025cc:	8b 45 18             	mov    0x18(%ebp),%eax
+  8025cf:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025d4:	83 ec 0c             	sub    $0xc,%esp
+  8025d7:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8025d9:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8025e0:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025e3:	83 c0 01             	add    $0x1,%eax
+  8025e6:	50                   	push   %eax
+  8025e7:	68 00 10 01 e0       	push   $0xe0011000
+  8025ec:	6a 11                	push   $0x11
+  8025ee:	ff 35 24 63 80 00    	push   0x806324
+  8025f4:	e8 00 13 00 00       	call   8038f9 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8025f9:	83 c4 1c             	add    $0x1c,%esp
+  8025fc:	6a 00                	push   $0x0
+  8025fe:	6a 00                	push   $0x0
+  802600:	6a 00                	push   $0x0
+  802602:	e8 2e 10 00 00       	call   803635 <ipc_recv>
+  802607:	83 c4 10             	add    $0x10,%esp
+  80260a:	85 c0                	test   %eax,%eax
+  80260c:	78 5b                	js     802669 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  80260e:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802610:	39 c3                	cmp    %eax,%ebx
+  802612:	0f 8e 4c ff ff ff    	jle    802564 <nsipc_sendfile+0x28>
+  802618:	eb 45                	jmp    80265f <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80261a:	83 ec 04             	sub    $0x4,%esp
+  80261d:	6a 07                	push   $0x7
+  80261f:	68 00 10 01 e0       	push   $0xe0011000
+  802624:	6a 00                	push   $0x0
+  802626:	e8 89 e7 ff ff       	call   800db4 <sys_page_alloc>
+  80262b:	89 c7                	mov    %eax,%edi
+  80262d:	83 c4 10             	add    $0x10,%esp
+  802630:	85 c0                	test   %eax,%eax
+  802632:	78 2b                	js     80265f <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802634:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  80263b:	00 00 00 
+  80263e:	e9 0f ff ff ff       	jmp    802552 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802643:	83 ec 0c             	sub    $0xc,%esp
+  802646:	6a 03                	push   $0x3
+  802648:	e8 e1 12 00 00       	call   80392e <ipc_find_env>
+  80264d:	a3 24 63 80 00       	mov    %eax,0x806324
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	e9 05 ff ff ff       	jmp    80255f <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80265a:	85 ff                	test   %edi,%edi
+  80265c:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80265f:	89 f8                	mov    %edi,%eax
+  802661:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802664:	5b                   	pop    %ebx
+  802665:	5e                   	pop    %esi
+  802666:	5f                   	pop    %edi
+  802667:	5d                   	pop    %ebp
+  802668:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802669:	85 ff                	test   %edi,%edi
+  80266b:	0f 44 f8             	cmove  %eax,%edi
+  80266e:	eb ef                	jmp    80265f <nsipc_sendfile+0x123>
+
+00802670 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802670:	55                   	push   %ebp
+  802671:	89 e5                	mov    %esp,%ebp
+  802673:	57                   	push   %edi
+  802674:	56                   	push   %esi
+  802675:	53                   	push   %ebx
+  802676:	83 ec 1c             	sub    $0x1c,%esp
+  802679:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80267c:	e8 13 f9 ff ff       	call   801f94 <nsbulk_map>
+  802681:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802684:	85 c0                	test   %eax,%eax
+  802686:	0f 88 ba 00 00 00    	js     802746 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80268c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802690:	0f 8e bb 00 00 00    	jle    802751 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802696:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80269b:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8026a0:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8026a5:	89 f8                	mov    %edi,%eax
+  8026a7:	29 f0                	sub    %esi,%eax
+  8026a9:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8026ad:	39 c8                	cmp    %ecx,%eax
+  8026af:	0f 47 c1             	cmova  %ecx,%eax
+  8026b2:	01 f0                	add    %esi,%eax
+  8026b4:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026b6:	83 c2 01             	add    $0x1,%edx
+  8026b9:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8026bc:	7e 07                	jle    8026c5 <nsipc_recvmsg+0x55>
+  8026be:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8026c3:	7e e0                	jle    8026a5 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8026c5:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8026cb:	c1 fa 0c             	sar    $0xc,%edx
+  8026ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d3:	e8 0a f9 ff ff       	call   801fe2 <nsbulk_own>
+  8026d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	78 67                	js     802746 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8026df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e2:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8026e7:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8026ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026f0:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8026f5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8026fa:	89 f2                	mov    %esi,%edx
+  8026fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802701:	e8 44 f9 ff ff       	call   80204a <nsipc_bulk>
+  802706:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802709:	85 c0                	test   %eax,%eax
+  80270b:	78 39                	js     802746 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  80270d:	39 f0                	cmp    %esi,%eax
+  80270f:	7f 4a                	jg     80275b <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802711:	bf 00 00 00 00       	mov    $0x0,%edi
+  802716:	85 c0                	test   %eax,%eax
+  802718:	7e 2c                	jle    802746 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80271a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80271d:	29 fe                	sub    %edi,%esi
+  80271f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802722:	39 c6                	cmp    %eax,%esi
+  802724:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802727:	83 ec 04             	sub    $0x4,%esp
+  80272a:	56                   	push   %esi
+  80272b:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802731:	50                   	push   %eax
+  802732:	ff 33                	push   (%ebx)
+  802734:	e8 f7 e3 ff ff       	call   800b30 <memmove>
+		n += m;
+  802739:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80273b:	83 c3 08             	add    $0x8,%ebx
+  80273e:	83 c4 10             	add    $0x10,%esp
+  802741:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802744:	7f d4                	jg     80271a <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802746:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274c:	5b                   	pop    %ebx
+  80274d:	5e                   	pop    %esi
+  80274e:	5f                   	pop    %edi
+  80274f:	5d                   	pop    %ebp
+  802750:	c3                   	ret
+	int r, i, n, len = 0;
+  802751:	be 00 00 00 00       	mov    $0x0,%esi
+  802756:	e9 6a ff ff ff       	jmp    8026c5 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80275b:	68 80 40 80 00       	push   $0x804080
+  802760:	68 89 40 80 00       	push   $0x804089
+  802765:	68 3b 01 00 00       	push   $0x13b
+  80276a:	68 9e 40 80 00       	push   $0x80409e
+  80276f:	e8 7b 0e 00 00       	call   8035ef <_panic>
+
+00802774 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802774:	55                   	push   %ebp
+  802775:	89 e5                	mov    %esp,%ebp
+  802777:	57                   	push   %edi
+  802778:	56                   	push   %esi
+  802779:	53                   	push   %ebx
+  80277a:	83 ec 0c             	sub    $0xc,%esp
+  80277d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802780:	8b 75 10             	mov    0x10(%ebp),%esi
+  802783:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802786:	8b 45 08             	mov    0x8(%ebp),%eax
+  802789:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80278e:	8b 07                	mov    (%edi),%eax
+  802790:	a3 04 80 80 00       	mov    %eax,0x808004
+  802795:	8b 47 04             	mov    0x4(%edi),%eax
+  802798:	a3 08 80 80 00       	mov    %eax,0x808008
+  80279d:	8b 47 08             	mov    0x8(%edi),%eax
+  8027a0:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8027a5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8027a8:	a3 10 80 80 00       	mov    %eax,0x808010
+  8027ad:	8b 47 10             	mov    0x10(%edi),%eax
+  8027b0:	a3 14 80 80 00       	mov    %eax,0x808014
+  8027b5:	8b 47 14             	mov    0x14(%edi),%eax
+  8027b8:	a3 18 80 80 00       	mov    %eax,0x808018
+  8027bd:	8b 47 18             	mov    0x18(%edi),%eax
+  8027c0:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8027c5:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8027c8:	a3 20 80 80 00       	mov    %eax,0x808020
+  8027cd:	8b 47 20             	mov    0x20(%edi),%eax
+  8027d0:	a3 24 80 80 00       	mov    %eax,0x808024
+  8027d5:	8b 47 24             	mov    0x24(%edi),%eax
+  8027d8:	a3 28 80 80 00       	mov    %eax,0x808028
+  8027dd:	8b 47 28             	mov    0x28(%edi),%eax
+  8027e0:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8027e5:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8027e8:	a3 30 80 80 00       	mov    %eax,0x808030
+  8027ed:	8b 47 30             	mov    0x30(%edi),%eax
+  8027f0:	a3 34 80 80 00       	mov    %eax,0x808034
+  8027f5:	8b 47 34             	mov    0x34(%edi),%eax
+  8027f8:	a3 38 80 80 00       	mov    %eax,0x808038
+  8027fd:	8b 47 38             	mov    0x38(%edi),%eax
+  802800:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802805:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802808:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  80280d:	8b 06                	mov    (%esi),%eax
+  80280f:	a3 44 80 80 00       	mov    %eax,0x808044
+  802814:	8b 46 04             	mov    0x4(%esi),%eax
+  802817:	a3 48 80 80 00       	mov    %eax,0x808048
+  80281c:	8b 46 08             	mov    0x8(%esi),%eax
+  80281f:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802824:	8b 46 0c             	mov    0xc(%esi),%eax
+  802827:	a3 50 80 80 00       	mov    %eax,0x808050
+  80282c:	8b 46 10             	mov    0x10(%esi),%eax
+  80282f:	a3 54 80 80 00       	mov    %eax,0x808054
+  802834:	8b 46 14             	mov    0x14(%esi),%eax
+  802837:	a3 58 80 80 00       	mov    %eax,0x808058
+  80283c:	8b 46 18             	mov    0x18(%esi),%eax
+  80283f:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802844:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802847:	a3 60 80 80 00       	mov    %eax,0x808060
+  80284c:	8b 46 20             	mov    0x20(%esi),%eax
+  80284f:	a3 64 80 80 00       	mov    %eax,0x808064
+  802854:	8b 46 24             	mov    0x24(%esi),%eax
+  802857:	a3 68 80 80 00       	mov    %eax,0x808068
+  80285c:	8b 46 28             	mov    0x28(%esi),%eax
+  80285f:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802864:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802867:	a3 70 80 80 00       	mov    %eax,0x808070
+  80286c:	8b 46 30             	mov    0x30(%esi),%eax
+  80286f:	a3 74 80 80 00       	mov    %eax,0x808074
+  802874:	8b 46 34             	mov    0x34(%esi),%eax
+  802877:	a3 78 80 80 00       	mov    %eax,0x808078
+  80287c:	8b 46 38             	mov    0x38(%esi),%eax
+  80287f:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802884:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802887:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80288c:	8b 03                	mov    (%ebx),%eax
+  80288e:	a3 84 80 80 00       	mov    %eax,0x808084
+  802893:	8b 43 04             	mov    0x4(%ebx),%eax
+  802896:	a3 88 80 80 00       	mov    %eax,0x808088
+  80289b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80289e:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8028a3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8028a6:	a3 90 80 80 00       	mov    %eax,0x808090
+  8028ab:	8b 43 10             	mov    0x10(%ebx),%eax
+  8028ae:	a3 94 80 80 00       	mov    %eax,0x808094
+  8028b3:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028b6:	a3 98 80 80 00       	mov    %eax,0x808098
+  8028bb:	8b 43 18             	mov    0x18(%ebx),%eax
+  8028be:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8028c3:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8028c6:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8028cb:	8b 43 20             	mov    0x20(%ebx),%eax
+  8028ce:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8028d3:	8b 43 24             	mov    0x24(%ebx),%eax
+  8028d6:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8028db:	8b 43 28             	mov    0x28(%ebx),%eax
+  8028de:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8028e3:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8028e6:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8028eb:	8b 43 30             	mov    0x30(%ebx),%eax
+  8028ee:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8028f3:	8b 43 34             	mov    0x34(%ebx),%eax
+  8028f6:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8028fb:	8b 43 38             	mov    0x38(%ebx),%eax
+  8028fe:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802903:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802906:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80290b:	8b 45 18             	mov    0x18(%ebp),%eax
+  80290e:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802913:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802918:	e8 2b f6 ff ff       	call   801f48 <nsipc>
+  80291d:	85 c0                	test   %eax,%eax
+  80291f:	0f 88 ad 01 00 00    	js     802ad2 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802925:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80292b:	89 17                	mov    %edx,(%edi)
+  80292d:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802933:	89 57 04             	mov    %edx,0x4(%edi)
+  802936:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80293c:	89 57 08             	mov    %edx,0x8(%edi)
+  80293f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802945:	89 57 0c             	mov    %edx,0xc(%edi)
+  802948:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80294e:	89 57 10             	mov    %edx,0x10(%edi)
+  802951:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802957:	89 57 14             	mov    %edx,0x14(%edi)
+  80295a:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802960:	89 57 18             	mov    %edx,0x18(%edi)
+  802963:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802969:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80296c:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802972:	89 57 20             	mov    %edx,0x20(%edi)
+  802975:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  80297b:	89 57 24             	mov    %edx,0x24(%edi)
+  80297e:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802984:	89 57 28             	mov    %edx,0x28(%edi)
+  802987:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80298d:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802990:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802996:	89 57 30             	mov    %edx,0x30(%edi)
+  802999:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  80299f:	89 57 34             	mov    %edx,0x34(%edi)
+  8029a2:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8029a8:	89 57 38             	mov    %edx,0x38(%edi)
+  8029ab:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8029b1:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8029b4:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8029ba:	89 16                	mov    %edx,(%esi)
+  8029bc:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8029c2:	89 56 04             	mov    %edx,0x4(%esi)
+  8029c5:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8029cb:	89 56 08             	mov    %edx,0x8(%esi)
+  8029ce:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8029d4:	89 56 0c             	mov    %edx,0xc(%esi)
+  8029d7:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  8029dd:	89 56 10             	mov    %edx,0x10(%esi)
+  8029e0:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8029e6:	89 56 14             	mov    %edx,0x14(%esi)
+  8029e9:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8029ef:	89 56 18             	mov    %edx,0x18(%esi)
+  8029f2:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8029f8:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8029fb:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802a01:	89 56 20             	mov    %edx,0x20(%esi)
+  802a04:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802a0a:	89 56 24             	mov    %edx,0x24(%esi)
+  802a0d:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802a13:	89 56 28             	mov    %edx,0x28(%esi)
+  802a16:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802a1c:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802a1f:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802a25:	89 56 30             	mov    %edx,0x30(%esi)
+  802a28:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802a2e:	89 56 34             	mov    %edx,0x34(%esi)
+  802a31:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802a37:	89 56 38             	mov    %edx,0x38(%esi)
+  802a3a:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802a40:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802a43:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802a49:	89 13                	mov    %edx,(%ebx)
+  802a4b:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802a51:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a54:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802a5a:	89 53 08             	mov    %edx,0x8(%ebx)
+  802a5d:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802a63:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802a66:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802a6c:	89 53 10             	mov    %edx,0x10(%ebx)
+  802a6f:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802a75:	89 53 14             	mov    %edx,0x14(%ebx)
+  802a78:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802a7e:	89 53 18             	mov    %edx,0x18(%ebx)
+  802a81:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802a87:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802a8a:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802a90:	89 53 20             	mov    %edx,0x20(%ebx)
+  802a93:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802a99:	89 53 24             	mov    %edx,0x24(%ebx)
+  802a9c:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802aa2:	89 53 28             	mov    %edx,0x28(%ebx)
+  802aa5:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802aab:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802aae:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802ab4:	89 53 30             	mov    %edx,0x30(%ebx)
+  802ab7:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802abd:	89 53 34             	mov    %edx,0x34(%ebx)
+  802ac0:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802ac6:	89 53 38             	mov    %edx,0x38(%ebx)
+  802ac9:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802acf:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802ad2:	83 c4 0c             	add    $0xc,%esp
+  802ad5:	5b                   	pop    %ebx
+  802ad6:	5e                   	pop    %esi
+  802ad7:	5f                   	pop    %edi
+  802ad8:	5d                   	pop    %ebp
+  802ad9:	c3                   	ret
+
+00802ada <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802ada:	55                   	push   %ebp
+  802adb:	89 e5                	mov    %esp,%ebp
+  802add:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802ae8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aeb:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802af0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802af3:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802af8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802afd:	e8 46 f4 ff ff       	call   801f48 <nsipc>
+}
+  802b02:	c9                   	leave
+  802b03:	c3                   	ret
+
+00802b04 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+  802b07:	56                   	push   %esi
+  802b08:	53                   	push   %ebx
+  802b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802b0c:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802b12:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b15:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802b1a:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b1f:	e8 24 f4 ff ff       	call   801f48 <nsipc>
+  802b24:	89 c3                	mov    %eax,%ebx
+  802b26:	85 c0                	test   %eax,%eax
+  802b28:	7e 1f                	jle    802b49 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802b2a:	39 c6                	cmp    %eax,%esi
+  802b2c:	7c 24                	jl     802b52 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802b2e:	83 ec 04             	sub    $0x4,%esp
+  802b31:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802b38:	50                   	push   %eax
+  802b39:	68 00 80 80 00       	push   $0x808000
+  802b3e:	ff 75 08             	push   0x8(%ebp)
+  802b41:	e8 ea df ff ff       	call   800b30 <memmove>
+  802b46:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802b49:	89 d8                	mov    %ebx,%eax
+  802b4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b4e:	5b                   	pop    %ebx
+  802b4f:	5e                   	pop    %esi
+  802b50:	5d                   	pop    %ebp
+  802b51:	c3                   	ret
+		assert(r <= max);
+  802b52:	68 b6 40 80 00       	push   $0x8040b6
+  802b57:	68 89 40 80 00       	push   $0x804089
+  802b5c:	68 6a 01 00 00       	push   $0x16a
+  802b61:	68 9e 40 80 00       	push   $0x80409e
+  802b66:	e8 84 0a 00 00       	call   8035ef <_panic>
+
+00802b6b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b74:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b7c:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b81:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b84:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b89:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b8e:	e8 b5 f3 ff ff       	call   801f48 <nsipc>
+}
+  802b93:	c9                   	leave
+  802b94:	c3                   	ret
+
+00802b95 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802b95:	55                   	push   %ebp
+  802b96:	89 e5                	mov    %esp,%ebp
+  802b98:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9e:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802ba3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ba8:	e8 9b f3 ff ff       	call   801f48 <nsipc>
+}
+  802bad:	c9                   	leave
+  802bae:	c3                   	ret
+
+00802baf <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802baf:	55                   	push   %ebp
+  802bb0:	89 e5                	mov    %esp,%ebp
+  802bb2:	53                   	push   %ebx
+  802bb3:	83 ec 04             	sub    $0x4,%esp
+  802bb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802bb9:	b8 12 00 00 00       	mov    $0x12,%eax
+  802bbe:	e8 85 f3 ff ff       	call   801f48 <nsipc>
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	78 50                	js     802c17 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802bc7:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802bcd:	89 13                	mov    %edx,(%ebx)
+  802bcf:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802bd5:	89 53 04             	mov    %edx,0x4(%ebx)
+  802bd8:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802bde:	89 53 08             	mov    %edx,0x8(%ebx)
+  802be1:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802be7:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802bea:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802bf0:	89 53 10             	mov    %edx,0x10(%ebx)
+  802bf3:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802bf9:	89 53 14             	mov    %edx,0x14(%ebx)
+  802bfc:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802c02:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c05:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802c0b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802c0e:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802c14:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802c17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c1a:	c9                   	leave
+  802c1b:	c3                   	ret
+
+00802c1c <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c22:	6a 03                	push   $0x3
+  802c24:	e8 05 0d 00 00       	call   80392e <ipc_find_env>
+  802c29:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802c2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c31:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802c36:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802c3b:	e8 08 f3 ff ff       	call   801f48 <nsipc>
+  802c40:	83 c4 10             	add    $0x10,%esp
+  802c43:	85 c0                	test   %eax,%eax
+  802c45:	78 0a                	js     802c51 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802c47:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c51:	c9                   	leave
+  802c52:	c3                   	ret
+
+00802c53 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802c53:	55                   	push   %ebp
+  802c54:	89 e5                	mov    %esp,%ebp
+  802c56:	57                   	push   %edi
+  802c57:	56                   	push   %esi
+  802c58:	53                   	push   %ebx
+  802c59:	83 ec 1c             	sub    $0x1c,%esp
+  802c5c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c5f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802c62:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c6c:	89 e0                	mov    %esp,%eax
+  802c6e:	89 f2                	mov    %esi,%edx
+  802c70:	29 c2                	sub    %eax,%edx
+  802c72:	89 d0                	mov    %edx,%eax
+  802c74:	c1 e8 0f             	shr    $0xf,%eax
+  802c77:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802c7d:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802c80:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802c87:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802c8a:	83 ec 0c             	sub    $0xc,%esp
+  802c8d:	ff 75 e0             	push   -0x20(%ebp)
+  802c90:	e8 d8 0c 00 00       	call   80396d <pageref>
+  802c95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c98:	83 c4 04             	add    $0x4,%esp
+  802c9b:	ff 75 dc             	push   -0x24(%ebp)
+  802c9e:	e8 ca 0c 00 00       	call   80396d <pageref>
+  802ca3:	89 e2                	mov    %esp,%edx
+  802ca5:	89 f1                	mov    %esi,%ecx
+  802ca7:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802ca9:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802cac:	89 ca                	mov    %ecx,%edx
+  802cae:	c1 ea 0f             	shr    $0xf,%edx
+  802cb1:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802cb7:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802cba:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802cc1:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802cc4:	39 d7                	cmp    %edx,%edi
+  802cc6:	74 40                	je     802d08 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802cc8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ccb:	75 9f                	jne    802c6c <_pipeisclosed+0x19>
+  802ccd:	89 e2                	mov    %esp,%edx
+  802ccf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802cd4:	29 d0                	sub    %edx,%eax
+  802cd6:	89 c2                	mov    %eax,%edx
+  802cd8:	c1 ea 0f             	shr    $0xf,%edx
+  802cdb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce5:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ce8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802cef:	8b 40 58             	mov    0x58(%eax),%eax
+  802cf2:	6a 01                	push   $0x1
+  802cf4:	50                   	push   %eax
+  802cf5:	57                   	push   %edi
+  802cf6:	68 bf 40 80 00       	push   $0x8040bf
+  802cfb:	e8 89 d5 ff ff       	call   800289 <cprintf>
+  802d00:	83 c4 10             	add    $0x10,%esp
+  802d03:	e9 5f ff ff ff       	jmp    802c67 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802d08:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d0b:	0f 94 c0             	sete   %al
+  802d0e:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802d11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d14:	5b                   	pop    %ebx
+  802d15:	5e                   	pop    %esi
+  802d16:	5f                   	pop    %edi
+  802d17:	5d                   	pop    %ebp
+  802d18:	c3                   	ret
+
+00802d19 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802d19:	55                   	push   %ebp
+  802d1a:	89 e5                	mov    %esp,%ebp
+  802d1c:	53                   	push   %ebx
+  802d1d:	83 ec 0c             	sub    $0xc,%esp
+  802d20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802d23:	53                   	push   %ebx
+  802d24:	6a 00                	push   $0x0
+  802d26:	e8 0e e1 ff ff       	call   800e39 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d2b:	89 1c 24             	mov    %ebx,(%esp)
+  802d2e:	e8 f4 e4 ff ff       	call   801227 <fd2data>
+  802d33:	83 c4 08             	add    $0x8,%esp
+  802d36:	50                   	push   %eax
+  802d37:	6a 00                	push   $0x0
+  802d39:	e8 fb e0 ff ff       	call   800e39 <sys_page_unmap>
+}
+  802d3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d41:	c9                   	leave
+  802d42:	c3                   	ret
+
+00802d43 <devpipe_read>:
+{
+  802d43:	55                   	push   %ebp
+  802d44:	89 e5                	mov    %esp,%ebp
+  802d46:	57                   	push   %edi
+  802d47:	56                   	push   %esi
+  802d48:	53                   	push   %ebx
+  802d49:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802d4c:	ff 75 08             	push   0x8(%ebp)
+  802d4f:	e8 d3 e4 ff ff       	call   801227 <fd2data>
+  802d54:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d56:	8b 70 04             	mov    0x4(%eax),%esi
+  802d59:	8b 00                	mov    (%eax),%eax
+  802d5b:	83 c4 10             	add    $0x10,%esp
+  802d5e:	39 f0                	cmp    %esi,%eax
+  802d60:	75 36                	jne    802d98 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802d62:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802d65:	89 da                	mov    %ebx,%edx
+  802d67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6a:	e8 e4 fe ff ff       	call   802c53 <_pipeisclosed>
+  802d6f:	85 c0                	test   %eax,%eax
+  802d71:	0f 85 d4 00 00 00    	jne    802e4b <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802d77:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d7c:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802d80:	83 ec 04             	sub    $0x4,%esp
+  802d83:	6a ff                	push   $0xffffffff
+  802d85:	56                   	push   %esi
+  802d86:	57                   	push   %edi
+  802d87:	e8 26 e4 ff ff       	call   8011b2 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d8c:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d8f:	8b 03                	mov    (%ebx),%eax
+  802d91:	83 c4 10             	add    $0x10,%esp
+  802d94:	39 c6                	cmp    %eax,%esi
+  802d96:	74 cd                	je     802d65 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d98:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d9b:	8b 03                	mov    (%ebx),%eax
+  802d9d:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802da3:	29 c6                	sub    %eax,%esi
+  802da5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802daa:	f7 e6                	mul    %esi
+  802dac:	c1 ea 0c             	shr    $0xc,%edx
+  802daf:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802db5:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802db7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802dba:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802dbe:	8b 0b                	mov    (%ebx),%ecx
+  802dc0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dc5:	f7 e1                	mul    %ecx
+  802dc7:	c1 ea 0b             	shr    $0xb,%edx
+  802dca:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802dd0:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802dd2:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802dd7:	29 cf                	sub    %ecx,%edi
+  802dd9:	39 f7                	cmp    %esi,%edi
+  802ddb:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802dde:	83 ec 04             	sub    $0x4,%esp
+  802de1:	57                   	push   %edi
+  802de2:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802de6:	50                   	push   %eax
+  802de7:	ff 75 0c             	push   0xc(%ebp)
+  802dea:	e8 41 dd ff ff       	call   800b30 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802def:	83 c4 0c             	add    $0xc,%esp
+  802df2:	89 f0                	mov    %esi,%eax
+  802df4:	29 f8                	sub    %edi,%eax
+  802df6:	50                   	push   %eax
+  802df7:	8d 43 10             	lea    0x10(%ebx),%eax
+  802dfa:	50                   	push   %eax
+  802dfb:	89 f8                	mov    %edi,%eax
+  802dfd:	03 45 0c             	add    0xc(%ebp),%eax
+  802e00:	50                   	push   %eax
+  802e01:	e8 2a dd ff ff       	call   800b30 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802e06:	8b 0b                	mov    (%ebx),%ecx
+  802e08:	01 f1                	add    %esi,%ecx
+  802e0a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e0f:	f7 e1                	mul    %ecx
+  802e11:	c1 ea 0c             	shr    $0xc,%edx
+  802e14:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802e1a:	29 c1                	sub    %eax,%ecx
+  802e1c:	89 0b                	mov    %ecx,(%ebx)
+  802e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e23:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802e27:	83 c4 10             	add    $0x10,%esp
+  802e2a:	85 c0                	test   %eax,%eax
+  802e2c:	75 0a                	jne    802e38 <devpipe_read+0xf5>
+	return n;
+  802e2e:	89 f0                	mov    %esi,%eax
+}
+  802e30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e33:	5b                   	pop    %ebx
+  802e34:	5e                   	pop    %esi
+  802e35:	5f                   	pop    %edi
+  802e36:	5d                   	pop    %ebp
+  802e37:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802e38:	83 ec 08             	sub    $0x8,%esp
+  802e3b:	68 00 04 00 00       	push   $0x400
+  802e40:	53                   	push   %ebx
+  802e41:	e8 8e e3 ff ff       	call   8011d4 <sys_futex_wake>
+  802e46:	83 c4 10             	add    $0x10,%esp
+  802e49:	eb e3                	jmp    802e2e <devpipe_read+0xeb>
+			return 0;
+  802e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e50:	eb de                	jmp    802e30 <devpipe_read+0xed>
+
+00802e52 <devpipe_write>:
+{
+  802e52:	55                   	push   %ebp
+  802e53:	89 e5                	mov    %esp,%ebp
+  802e55:	57                   	push   %edi
+  802e56:	56                   	push   %esi
+  802e57:	53                   	push   %ebx
+  802e58:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802e5b:	ff 75 08             	push   0x8(%ebp)
+  802e5e:	e8 c4 e3 ff ff       	call   801227 <fd2data>
+  802e63:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802e65:	83 c4 10             	add    $0x10,%esp
+  802e68:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e6f:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802e74:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e78:	0f 84 43 01 00 00    	je     802fc1 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e7e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e81:	8b 06                	mov    (%esi),%eax
+  802e83:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e89:	29 c1                	sub    %eax,%ecx
+  802e8b:	89 c8                	mov    %ecx,%eax
+  802e8d:	f7 e7                	mul    %edi
+  802e8f:	c1 ea 0c             	shr    $0xc,%edx
+  802e92:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e98:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802e9a:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802ea0:	75 52                	jne    802ef4 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802ea2:	89 f2                	mov    %esi,%edx
+  802ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea7:	e8 a7 fd ff ff       	call   802c53 <_pipeisclosed>
+  802eac:	85 c0                	test   %eax,%eax
+  802eae:	0f 85 28 01 00 00    	jne    802fdc <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802eb4:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802eb6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802eb9:	8b 06                	mov    (%esi),%eax
+  802ebb:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802ec1:	29 c1                	sub    %eax,%ecx
+  802ec3:	89 c8                	mov    %ecx,%eax
+  802ec5:	f7 e7                	mul    %edi
+  802ec7:	c1 ea 0c             	shr    $0xc,%edx
+  802eca:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ed0:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802ed2:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802ed8:	75 a4                	jne    802e7e <devpipe_write+0x2c>
+  802eda:	b8 01 00 00 00       	mov    $0x1,%eax
+  802edf:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802ee3:	83 ec 04             	sub    $0x4,%esp
+  802ee6:	6a ff                	push   $0xffffffff
+  802ee8:	53                   	push   %ebx
+  802ee9:	56                   	push   %esi
+  802eea:	e8 c3 e2 ff ff       	call   8011b2 <sys_futex_wait>
+}
+  802eef:	83 c4 10             	add    $0x10,%esp
+  802ef2:	eb 8a                	jmp    802e7e <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ef4:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ef7:	8b 06                	mov    (%esi),%eax
+  802ef9:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802eff:	29 c1                	sub    %eax,%ecx
+  802f01:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f06:	f7 e1                	mul    %ecx
+  802f08:	c1 ea 0c             	shr    $0xc,%edx
+  802f0b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f11:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802f13:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802f18:	89 d8                	mov    %ebx,%eax
+  802f1a:	29 c8                	sub    %ecx,%eax
+  802f1c:	8b 55 10             	mov    0x10(%ebp),%edx
+  802f1f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f22:	29 ca                	sub    %ecx,%edx
+  802f24:	39 d0                	cmp    %edx,%eax
+  802f26:	0f 46 d0             	cmovbe %eax,%edx
+  802f29:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802f2c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f2f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f34:	f7 e1                	mul    %ecx
+  802f36:	c1 ea 0b             	shr    $0xb,%edx
+  802f39:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f3f:	89 ca                	mov    %ecx,%edx
+  802f41:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802f43:	29 d3                	sub    %edx,%ebx
+  802f45:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f48:	39 c3                	cmp    %eax,%ebx
+  802f4a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802f4d:	83 ec 04             	sub    $0x4,%esp
+  802f50:	53                   	push   %ebx
+  802f51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f54:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802f57:	51                   	push   %ecx
+  802f58:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802f5c:	50                   	push   %eax
+  802f5d:	e8 ce db ff ff       	call   800b30 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802f62:	83 c4 0c             	add    $0xc,%esp
+  802f65:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f68:	29 d8                	sub    %ebx,%eax
+  802f6a:	50                   	push   %eax
+  802f6b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f6e:	01 cb                	add    %ecx,%ebx
+  802f70:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f73:	53                   	push   %ebx
+  802f74:	8d 46 10             	lea    0x10(%esi),%eax
+  802f77:	50                   	push   %eax
+  802f78:	e8 b3 db ff ff       	call   800b30 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802f7d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f80:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f83:	01 c1                	add    %eax,%ecx
+  802f85:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f8a:	f7 e1                	mul    %ecx
+  802f8c:	c1 ea 0c             	shr    $0xc,%edx
+  802f8f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f95:	89 ca                	mov    %ecx,%edx
+  802f97:	29 c2                	sub    %eax,%edx
+  802f99:	89 56 04             	mov    %edx,0x4(%esi)
+  802f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa1:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802fa5:	83 c4 10             	add    $0x10,%esp
+  802fa8:	85 c0                	test   %eax,%eax
+  802faa:	75 1a                	jne    802fc6 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802fac:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802faf:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802fb2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fb5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802fb8:	0f 82 c0 fe ff ff    	jb     802e7e <devpipe_write+0x2c>
+  802fbe:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802fc1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fc4:	eb 1b                	jmp    802fe1 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802fc6:	83 ec 08             	sub    $0x8,%esp
+  802fc9:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802fce:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802fd1:	50                   	push   %eax
+  802fd2:	e8 fd e1 ff ff       	call   8011d4 <sys_futex_wake>
+  802fd7:	83 c4 10             	add    $0x10,%esp
+  802fda:	eb d0                	jmp    802fac <devpipe_write+0x15a>
+				return 0;
+  802fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fe4:	5b                   	pop    %ebx
+  802fe5:	5e                   	pop    %esi
+  802fe6:	5f                   	pop    %edi
+  802fe7:	5d                   	pop    %ebp
+  802fe8:	c3                   	ret
+
+00802fe9 <devpipe_stat>:
+{
+  802fe9:	55                   	push   %ebp
+  802fea:	89 e5                	mov    %esp,%ebp
+  802fec:	56                   	push   %esi
+  802fed:	53                   	push   %ebx
+  802fee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ff1:	83 ec 0c             	sub    $0xc,%esp
+  802ff4:	ff 75 08             	push   0x8(%ebp)
+  802ff7:	e8 2b e2 ff ff       	call   801227 <fd2data>
+  802ffc:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802ffe:	83 c4 08             	add    $0x8,%esp
+  803001:	68 d2 40 80 00       	push   $0x8040d2
+  803006:	53                   	push   %ebx
+  803007:	e8 74 d9 ff ff       	call   800980 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80300c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80300f:	8b 06                	mov    (%esi),%eax
+  803011:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803017:	29 c1                	sub    %eax,%ecx
+  803019:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80301e:	89 c8                	mov    %ecx,%eax
+  803020:	f7 e2                	mul    %edx
+  803022:	c1 ea 0c             	shr    $0xc,%edx
+  803025:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80302b:	29 d1                	sub    %edx,%ecx
+  80302d:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803033:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80303a:	00 00 00 
+	stat->st_dev = &devpipe;
+  80303d:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803044:	50 80 00 
+}
+  803047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80304f:	5b                   	pop    %ebx
+  803050:	5e                   	pop    %esi
+  803051:	5d                   	pop    %ebp
+  803052:	c3                   	ret
+
+00803053 <devpipe_poll>:
+{
+  803053:	55                   	push   %ebp
+  803054:	89 e5                	mov    %esp,%ebp
+  803056:	57                   	push   %edi
+  803057:	56                   	push   %esi
+  803058:	53                   	push   %ebx
+  803059:	83 ec 18             	sub    $0x18,%esp
+  80305c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80305f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803062:	57                   	push   %edi
+  803063:	e8 bf e1 ff ff       	call   801227 <fd2data>
+  803068:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80306a:	83 c4 10             	add    $0x10,%esp
+  80306d:	89 f3                	mov    %esi,%ebx
+  80306f:	83 e3 01             	and    $0x1,%ebx
+  803072:	75 27                	jne    80309b <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803074:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80307a:	75 48                	jne    8030c4 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80307c:	89 ca                	mov    %ecx,%edx
+  80307e:	89 f8                	mov    %edi,%eax
+  803080:	e8 ce fb ff ff       	call   802c53 <_pipeisclosed>
+  803085:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803087:	89 d8                	mov    %ebx,%eax
+  803089:	83 c8 10             	or     $0x10,%eax
+  80308c:	85 d2                	test   %edx,%edx
+  80308e:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803091:	89 d8                	mov    %ebx,%eax
+  803093:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803096:	5b                   	pop    %ebx
+  803097:	5e                   	pop    %esi
+  803098:	5f                   	pop    %edi
+  803099:	5d                   	pop    %ebp
+  80309a:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80309b:	8b 58 04             	mov    0x4(%eax),%ebx
+  80309e:	8b 00                	mov    (%eax),%eax
+  8030a0:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8030a6:	29 c3                	sub    %eax,%ebx
+  8030a8:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030ad:	89 d8                	mov    %ebx,%eax
+  8030af:	f7 e2                	mul    %edx
+  8030b1:	c1 ea 0c             	shr    $0xc,%edx
+  8030b4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8030ba:	39 d3                	cmp    %edx,%ebx
+  8030bc:	0f 95 c3             	setne  %bl
+  8030bf:	0f b6 db             	movzbl %bl,%ebx
+  8030c2:	eb b0                	jmp    803074 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030c4:	8b 71 04             	mov    0x4(%ecx),%esi
+  8030c7:	8b 01                	mov    (%ecx),%eax
+  8030c9:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8030cf:	29 c6                	sub    %eax,%esi
+  8030d1:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030d6:	89 f0                	mov    %esi,%eax
+  8030d8:	f7 e2                	mul    %edx
+  8030da:	c1 ea 0c             	shr    $0xc,%edx
+  8030dd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030e3:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8030e5:	89 d8                	mov    %ebx,%eax
+  8030e7:	83 c8 04             	or     $0x4,%eax
+  8030ea:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8030f0:	0f 42 d8             	cmovb  %eax,%ebx
+  8030f3:	eb 87                	jmp    80307c <devpipe_poll+0x29>
+
+008030f5 <pipe>:
+{
+  8030f5:	55                   	push   %ebp
+  8030f6:	89 e5                	mov    %esp,%ebp
+  8030f8:	56                   	push   %esi
+  8030f9:	53                   	push   %ebx
+  8030fa:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803100:	50                   	push   %eax
+  803101:	e8 38 e1 ff ff       	call   80123e <fd_alloc>
+  803106:	89 c3                	mov    %eax,%ebx
+  803108:	83 c4 10             	add    $0x10,%esp
+  80310b:	85 c0                	test   %eax,%eax
+  80310d:	0f 88 23 01 00 00    	js     803236 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803113:	83 ec 04             	sub    $0x4,%esp
+  803116:	68 07 04 00 00       	push   $0x407
+  80311b:	ff 75 f4             	push   -0xc(%ebp)
+  80311e:	6a 00                	push   $0x0
+  803120:	e8 8f dc ff ff       	call   800db4 <sys_page_alloc>
+  803125:	89 c3                	mov    %eax,%ebx
+  803127:	83 c4 10             	add    $0x10,%esp
+  80312a:	85 c0                	test   %eax,%eax
+  80312c:	0f 88 04 01 00 00    	js     803236 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803132:	83 ec 0c             	sub    $0xc,%esp
+  803135:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803138:	50                   	push   %eax
+  803139:	e8 00 e1 ff ff       	call   80123e <fd_alloc>
+  80313e:	89 c3                	mov    %eax,%ebx
+  803140:	83 c4 10             	add    $0x10,%esp
+  803143:	85 c0                	test   %eax,%eax
+  803145:	0f 88 db 00 00 00    	js     803226 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80314b:	83 ec 04             	sub    $0x4,%esp
+  80314e:	68 07 04 00 00       	push   $0x407
+  803153:	ff 75 f0             	push   -0x10(%ebp)
+  803156:	6a 00                	push   $0x0
+  803158:	e8 57 dc ff ff       	call   800db4 <sys_page_alloc>
+  80315d:	89 c3                	mov    %eax,%ebx
+  80315f:	83 c4 10             	add    $0x10,%esp
+  803162:	85 c0                	test   %eax,%eax
+  803164:	0f 88 bc 00 00 00    	js     803226 <pipe+0x131>
+	va = fd2data(fd0);
+  80316a:	83 ec 0c             	sub    $0xc,%esp
+  80316d:	ff 75 f4             	push   -0xc(%ebp)
+  803170:	e8 b2 e0 ff ff       	call   801227 <fd2data>
+  803175:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803177:	83 c4 0c             	add    $0xc,%esp
+  80317a:	68 07 04 00 00       	push   $0x407
+  80317f:	50                   	push   %eax
+  803180:	6a 00                	push   $0x0
+  803182:	e8 2d dc ff ff       	call   800db4 <sys_page_alloc>
+  803187:	89 c3                	mov    %eax,%ebx
+  803189:	83 c4 10             	add    $0x10,%esp
+  80318c:	85 c0                	test   %eax,%eax
+  80318e:	0f 88 82 00 00 00    	js     803216 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803194:	83 ec 0c             	sub    $0xc,%esp
+  803197:	ff 75 f0             	push   -0x10(%ebp)
+  80319a:	e8 88 e0 ff ff       	call   801227 <fd2data>
+  80319f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8031a6:	50                   	push   %eax
+  8031a7:	6a 00                	push   $0x0
+  8031a9:	56                   	push   %esi
+  8031aa:	6a 00                	push   $0x0
+  8031ac:	e8 46 dc ff ff       	call   800df7 <sys_page_map>
+  8031b1:	89 c3                	mov    %eax,%ebx
+  8031b3:	83 c4 20             	add    $0x20,%esp
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	78 4e                	js     803208 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031ba:	a1 60 50 80 00       	mov    0x805060,%eax
+  8031bf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031c2:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031c4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031c7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031ce:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031d1:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031d6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031dd:	83 ec 0c             	sub    $0xc,%esp
+  8031e0:	ff 75 f4             	push   -0xc(%ebp)
+  8031e3:	e8 2f e0 ff ff       	call   801217 <fd2num>
+  8031e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031eb:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031ed:	83 c4 04             	add    $0x4,%esp
+  8031f0:	ff 75 f0             	push   -0x10(%ebp)
+  8031f3:	e8 1f e0 ff ff       	call   801217 <fd2num>
+  8031f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031fb:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031fe:	83 c4 10             	add    $0x10,%esp
+  803201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803206:	eb 2e                	jmp    803236 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803208:	83 ec 08             	sub    $0x8,%esp
+  80320b:	56                   	push   %esi
+  80320c:	6a 00                	push   $0x0
+  80320e:	e8 26 dc ff ff       	call   800e39 <sys_page_unmap>
+  803213:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803216:	83 ec 08             	sub    $0x8,%esp
+  803219:	ff 75 f0             	push   -0x10(%ebp)
+  80321c:	6a 00                	push   $0x0
+  80321e:	e8 16 dc ff ff       	call   800e39 <sys_page_unmap>
+  803223:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803226:	83 ec 08             	sub    $0x8,%esp
+  803229:	ff 75 f4             	push   -0xc(%ebp)
+  80322c:	6a 00                	push   $0x0
+  80322e:	e8 06 dc ff ff       	call   800e39 <sys_page_unmap>
+  803233:	83 c4 10             	add    $0x10,%esp
+}
+  803236:	89 d8                	mov    %ebx,%eax
+  803238:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80323b:	5b                   	pop    %ebx
+  80323c:	5e                   	pop    %esi
+  80323d:	5d                   	pop    %ebp
+  80323e:	c3                   	ret
+
+0080323f <pipeisclosed>:
+{
+  80323f:	55                   	push   %ebp
+  803240:	89 e5                	mov    %esp,%ebp
+  803242:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803245:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803248:	50                   	push   %eax
+  803249:	ff 75 08             	push   0x8(%ebp)
+  80324c:	e8 3d e0 ff ff       	call   80128e <fd_lookup>
+  803251:	83 c4 10             	add    $0x10,%esp
+  803254:	85 c0                	test   %eax,%eax
+  803256:	78 18                	js     803270 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803258:	83 ec 0c             	sub    $0xc,%esp
+  80325b:	ff 75 f4             	push   -0xc(%ebp)
+  80325e:	e8 c4 df ff ff       	call   801227 <fd2data>
+  803263:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803265:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803268:	e8 e6 f9 ff ff       	call   802c53 <_pipeisclosed>
+  80326d:	83 c4 10             	add    $0x10,%esp
+}
+  803270:	c9                   	leave
+  803271:	c3                   	ret
+
+00803272 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803272:	55                   	push   %ebp
+  803273:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803275:	8b 45 08             	mov    0x8(%ebp),%eax
+  803278:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80327e:	5d                   	pop    %ebp
+  80327f:	c3                   	ret
+
+00803280 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803280:	55                   	push   %ebp
+  803281:	89 e5                	mov    %esp,%ebp
+  803283:	53                   	push   %ebx
+  803284:	83 ec 04             	sub    $0x4,%esp
+  803287:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80328a:	8b 03                	mov    (%ebx),%eax
+  80328c:	85 c0                	test   %eax,%eax
+  80328e:	75 05                	jne    803295 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803290:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803293:	c9                   	leave
+  803294:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803295:	83 ec 08             	sub    $0x8,%esp
+  803298:	50                   	push   %eax
+  803299:	8d 43 04             	lea    0x4(%ebx),%eax
+  80329c:	50                   	push   %eax
+  80329d:	e8 e7 dd ff ff       	call   801089 <sys_page_batch>
+	pb->pb_n = 0;
+  8032a2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8032a8:	83 c4 10             	add    $0x10,%esp
+  8032ab:	eb e3                	jmp    803290 <pgbatch_flush+0x10>
+
+008032ad <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8032ad:	55                   	push   %ebp
+  8032ae:	89 e5                	mov    %esp,%ebp
+  8032b0:	56                   	push   %esi
+  8032b1:	53                   	push   %ebx
+  8032b2:	89 c3                	mov    %eax,%ebx
+  8032b4:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032b6:	83 38 20             	cmpl   $0x20,(%eax)
+  8032b9:	74 2c                	je     8032e7 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8032bb:	8b 03                	mov    (%ebx),%eax
+  8032bd:	8d 50 01             	lea    0x1(%eax),%edx
+  8032c0:	89 13                	mov    %edx,(%ebx)
+  8032c2:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8032c5:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8032c9:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8032cb:	83 ec 04             	sub    $0x4,%esp
+  8032ce:	6a 18                	push   $0x18
+  8032d0:	6a 00                	push   $0x0
+  8032d2:	50                   	push   %eax
+  8032d3:	e8 23 d8 ff ff       	call   800afb <memset>
+	return 0;
+  8032d8:	83 c4 10             	add    $0x10,%esp
+  8032db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032e3:	5b                   	pop    %ebx
+  8032e4:	5e                   	pop    %esi
+  8032e5:	5d                   	pop    %ebp
+  8032e6:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032e7:	83 ec 0c             	sub    $0xc,%esp
+  8032ea:	50                   	push   %eax
+  8032eb:	e8 90 ff ff ff       	call   803280 <pgbatch_flush>
+  8032f0:	83 c4 10             	add    $0x10,%esp
+  8032f3:	85 c0                	test   %eax,%eax
+  8032f5:	79 c4                	jns    8032bb <pgbatch_slot+0xe>
+  8032f7:	eb e7                	jmp    8032e0 <pgbatch_slot+0x33>
+
+008032f9 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8032f9:	55                   	push   %ebp
+  8032fa:	89 e5                	mov    %esp,%ebp
+  8032fc:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032ff:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803302:	8b 45 08             	mov    0x8(%ebp),%eax
+  803305:	e8 a3 ff ff ff       	call   8032ad <pgbatch_slot>
+  80330a:	85 c0                	test   %eax,%eax
+  80330c:	78 20                	js     80332e <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  80330e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803311:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803317:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80331a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80331d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803320:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803323:	8b 55 14             	mov    0x14(%ebp),%edx
+  803326:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803329:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80332e:	c9                   	leave
+  80332f:	c3                   	ret
+
+00803330 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803336:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80333c:	e8 6c ff ff ff       	call   8032ad <pgbatch_slot>
+  803341:	85 c0                	test   %eax,%eax
+  803343:	78 2c                	js     803371 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803345:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803348:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80334e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803351:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803354:	8b 55 10             	mov    0x10(%ebp),%edx
+  803357:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80335a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80335d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803360:	8b 55 18             	mov    0x18(%ebp),%edx
+  803363:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803366:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803369:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80336c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803371:	c9                   	leave
+  803372:	c3                   	ret
+
+00803373 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803373:	55                   	push   %ebp
+  803374:	89 e5                	mov    %esp,%ebp
+  803376:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803379:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80337c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337f:	e8 29 ff ff ff       	call   8032ad <pgbatch_slot>
+  803384:	85 c0                	test   %eax,%eax
+  803386:	78 1a                	js     8033a2 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803388:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80338b:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803391:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803394:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803397:	8b 55 10             	mov    0x10(%ebp),%edx
+  80339a:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80339d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033a2:	c9                   	leave
+  8033a3:	c3                   	ret
+
+008033a4 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8033a4:	55                   	push   %ebp
+  8033a5:	89 e5                	mov    %esp,%ebp
+  8033a7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033aa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b0:	e8 f8 fe ff ff       	call   8032ad <pgbatch_slot>
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	78 20                	js     8033d9 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8033b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033bc:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8033c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033c5:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033c8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033cb:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8033ce:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033d1:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+
+008033db <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8033db:	55                   	push   %ebp
+  8033dc:	89 e5                	mov    %esp,%ebp
+  8033de:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033e1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e7:	e8 c1 fe ff ff       	call   8032ad <pgbatch_slot>
+  8033ec:	85 c0                	test   %eax,%eax
+  8033ee:	78 26                	js     803416 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8033f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033f3:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8033f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033fc:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8033ff:	8b 55 10             	mov    0x10(%ebp),%edx
+  803402:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803405:	8b 55 14             	mov    0x14(%ebp),%edx
+  803408:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80340b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80340e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803411:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803416:	c9                   	leave
+  803417:	c3                   	ret
+
+00803418 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80341d:	c3                   	ret
+
+0080341e <devcons_poll>:
+{
+  80341e:	55                   	push   %ebp
+  80341f:	89 e5                	mov    %esp,%ebp
+  803421:	53                   	push   %ebx
+  803422:	83 ec 04             	sub    $0x4,%esp
+  803425:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803428:	89 da                	mov    %ebx,%edx
+  80342a:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80342d:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803434:	74 0c                	je     803442 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803436:	89 d8                	mov    %ebx,%eax
+  803438:	83 e0 01             	and    $0x1,%eax
+  80343b:	09 d0                	or     %edx,%eax
+}
+  80343d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803440:	c9                   	leave
+  803441:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803442:	e8 cf d8 ff ff       	call   800d16 <sys_cgetc>
+  803447:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80344c:	89 da                	mov    %ebx,%edx
+  80344e:	83 e2 04             	and    $0x4,%edx
+  803451:	85 c0                	test   %eax,%eax
+  803453:	74 e6                	je     80343b <devcons_poll+0x1d>
+  803455:	eb df                	jmp    803436 <devcons_poll+0x18>
+
+00803457 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803457:	55                   	push   %ebp
+  803458:	89 e5                	mov    %esp,%ebp
+  80345a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80345d:	68 de 40 80 00       	push   $0x8040de
+  803462:	ff 75 0c             	push   0xc(%ebp)
+  803465:	e8 16 d5 ff ff       	call   800980 <strcpy>
+	return 0;
+}
+  80346a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346f:	c9                   	leave
+  803470:	c3                   	ret
+
+00803471 <devcons_write>:
+{
+  803471:	55                   	push   %ebp
+  803472:	89 e5                	mov    %esp,%ebp
+  803474:	57                   	push   %edi
+  803475:	56                   	push   %esi
+  803476:	53                   	push   %ebx
+  803477:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80347d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803480:	85 ff                	test   %edi,%edi
+  803482:	74 51                	je     8034d5 <devcons_write+0x64>
+  803484:	be 00 00 00 00       	mov    $0x0,%esi
+  803489:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80348e:	89 fb                	mov    %edi,%ebx
+  803490:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803492:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803497:	39 d3                	cmp    %edx,%ebx
+  803499:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80349c:	83 ec 04             	sub    $0x4,%esp
+  80349f:	53                   	push   %ebx
+  8034a0:	03 45 0c             	add    0xc(%ebp),%eax
+  8034a3:	50                   	push   %eax
+  8034a4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034aa:	50                   	push   %eax
+  8034ab:	e8 80 d6 ff ff       	call   800b30 <memmove>
+		sys_cputs(buf, m);
+  8034b0:	83 c4 08             	add    $0x8,%esp
+  8034b3:	53                   	push   %ebx
+  8034b4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034ba:	50                   	push   %eax
+  8034bb:	e8 38 d8 ff ff       	call   800cf8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8034c0:	01 de                	add    %ebx,%esi
+  8034c2:	89 f0                	mov    %esi,%eax
+  8034c4:	83 c4 10             	add    $0x10,%esp
+  8034c7:	39 fe                	cmp    %edi,%esi
+  8034c9:	72 c3                	jb     80348e <devcons_write+0x1d>
+}
+  8034cb:	89 f0                	mov    %esi,%eax
+  8034cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d0:	5b                   	pop    %ebx
+  8034d1:	5e                   	pop    %esi
+  8034d2:	5f                   	pop    %edi
+  8034d3:	5d                   	pop    %ebp
+  8034d4:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8034d5:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8034da:	eb ef                	jmp    8034cb <devcons_write+0x5a>
+
+008034dc <devcons_read>:
+{
+  8034dc:	55                   	push   %ebp
+  8034dd:	89 e5                	mov    %esp,%ebp
+  8034df:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8034e2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8034e7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034eb:	74 36                	je     803523 <devcons_read+0x47>
+	c = cons_peek;
+  8034ed:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8034f2:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8034f9:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034fc:	85 c0                	test   %eax,%eax
+  8034fe:	75 10                	jne    803510 <devcons_read+0x34>
+  803500:	e8 11 d8 ff ff       	call   800d16 <sys_cgetc>
+  803505:	85 c0                	test   %eax,%eax
+  803507:	75 07                	jne    803510 <devcons_read+0x34>
+		sys_yield();
+  803509:	e8 87 d8 ff ff       	call   800d95 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80350e:	eb f0                	jmp    803500 <devcons_read+0x24>
+	if (c < 0)
+  803510:	85 c0                	test   %eax,%eax
+  803512:	78 0f                	js     803523 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803514:	83 f8 04             	cmp    $0x4,%eax
+  803517:	74 0c                	je     803525 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803519:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80351c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80351e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803523:	c9                   	leave
+  803524:	c3                   	ret
+		return 0;
+  803525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352a:	eb f7                	jmp    803523 <devcons_read+0x47>
+
+0080352c <cputchar>:
+{
+  80352c:	55                   	push   %ebp
+  80352d:	89 e5                	mov    %esp,%ebp
+  80352f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803532:	8b 45 08             	mov    0x8(%ebp),%eax
+  803535:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803538:	6a 01                	push   $0x1
+  80353a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80353d:	50                   	push   %eax
+  80353e:	e8 b5 d7 ff ff       	call   800cf8 <sys_cputs>
+}
+  803543:	83 c4 10             	add    $0x10,%esp
+  803546:	c9                   	leave
+  803547:	c3                   	ret
+
+00803548 <getchar>:
+{
+  803548:	55                   	push   %ebp
+  803549:	89 e5                	mov    %esp,%ebp
+  80354b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80354e:	6a 01                	push   $0x1
+  803550:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803553:	50                   	push   %eax
+  803554:	6a 00                	push   $0x0
+  803556:	e8 b7 df ff ff       	call   801512 <read>
+	if (r < 0)
+  80355b:	83 c4 10             	add    $0x10,%esp
+  80355e:	85 c0                	test   %eax,%eax
+  803560:	78 06                	js     803568 <getchar+0x20>
+	if (r < 1)
+  803562:	74 06                	je     80356a <getchar+0x22>
+	return c;
+  803564:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803568:	c9                   	leave
+  803569:	c3                   	ret
+		return -E_EOF;
+  80356a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80356f:	eb f7                	jmp    803568 <getchar+0x20>
+
+00803571 <iscons>:
+{
+  803571:	55                   	push   %ebp
+  803572:	89 e5                	mov    %esp,%ebp
+  803574:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803577:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80357a:	50                   	push   %eax
+  80357b:	ff 75 08             	push   0x8(%ebp)
+  80357e:	e8 0b dd ff ff       	call   80128e <fd_lookup>
+  803583:	83 c4 10             	add    $0x10,%esp
+  803586:	85 c0                	test   %eax,%eax
+  803588:	78 11                	js     80359b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80358a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80358d:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803593:	39 10                	cmp    %edx,(%eax)
+  803595:	0f 94 c0             	sete   %al
+  803598:	0f b6 c0             	movzbl %al,%eax
+}
+  80359b:	c9                   	leave
+  80359c:	c3                   	ret
+
+0080359d <opencons>:
+{
+  80359d:	55                   	push   %ebp
+  80359e:	89 e5                	mov    %esp,%ebp
+  8035a0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8035a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035a6:	50                   	push   %eax
+  8035a7:	e8 92 dc ff ff       	call   80123e <fd_alloc>
+  8035ac:	83 c4 10             	add    $0x10,%esp
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	78 3a                	js     8035ed <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8035b3:	83 ec 04             	sub    $0x4,%esp
+  8035b6:	68 07 04 00 00       	push   $0x407
+  8035bb:	ff 75 f4             	push   -0xc(%ebp)
+  8035be:	6a 00                	push   $0x0
+  8035c0:	e8 ef d7 ff ff       	call   800db4 <sys_page_alloc>
+  8035c5:	83 c4 10             	add    $0x10,%esp
+  8035c8:	85 c0                	test   %eax,%eax
+  8035ca:	78 21                	js     8035ed <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8035cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035cf:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035d5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8035d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035da:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8035e1:	83 ec 0c             	sub    $0xc,%esp
+  8035e4:	50                   	push   %eax
+  8035e5:	e8 2d dc ff ff       	call   801217 <fd2num>
+  8035ea:	83 c4 10             	add    $0x10,%esp
+}
+  8035ed:	c9                   	leave
+  8035ee:	c3                   	ret
+
+008035ef <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8035ef:	55                   	push   %ebp
+  8035f0:	89 e5                	mov    %esp,%ebp
+  8035f2:	56                   	push   %esi
+  8035f3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8035f4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8035f7:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8035fd:	e8 74 d7 ff ff       	call   800d76 <sys_getenvid>
+  803602:	83 ec 0c             	sub    $0xc,%esp
+  803605:	ff 75 0c             	push   0xc(%ebp)
+  803608:	ff 75 08             	push   0x8(%ebp)
+  80360b:	56                   	push   %esi
+  80360c:	50                   	push   %eax
+  80360d:	68 ec 40 80 00       	push   $0x8040ec
+  803612:	e8 72 cc ff ff       	call   800289 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803617:	83 c4 18             	add    $0x18,%esp
+  80361a:	53                   	push   %ebx
+  80361b:	ff 75 10             	push   0x10(%ebp)
+  80361e:	e8 15 cc ff ff       	call   800238 <vcprintf>
+	cprintf("\n");
+  803623:	c7 04 24 d0 40 80 00 	movl   $0x8040d0,(%esp)
+  80362a:	e8 5a cc ff ff       	call   800289 <cprintf>
+  80362f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803632:	cc                   	int3
+	while (1)
+  803633:	eb fd                	jmp    803632 <_panic+0x43>
+
+00803635 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803635:	55                   	push   %ebp
+  803636:	89 e5                	mov    %esp,%ebp
+  803638:	56                   	push   %esi
+  803639:	53                   	push   %ebx
+  80363a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80363d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803640:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803643:	85 c0                	test   %eax,%eax
+  803645:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80364a:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80364d:	83 ec 0c             	sub    $0xc,%esp
+  803650:	50                   	push   %eax
+  803651:	e8 0e d9 ff ff       	call   800f64 <sys_ipc_recv>
+  803656:	83 c4 10             	add    $0x10,%esp
+  803659:	85 c0                	test   %eax,%eax
+  80365b:	0f 88 8b 00 00 00    	js     8036ec <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803661:	85 f6                	test   %esi,%esi
+  803663:	74 2a                	je     80368f <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803665:	89 e2                	mov    %esp,%edx
+  803667:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80366c:	29 d0                	sub    %edx,%eax
+  80366e:	89 c2                	mov    %eax,%edx
+  803670:	c1 ea 0f             	shr    $0xf,%edx
+  803673:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367d:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803680:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803687:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80368d:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80368f:	85 db                	test   %ebx,%ebx
+  803691:	74 2a                	je     8036bd <ipc_recv+0x88>
+  803693:	89 e2                	mov    %esp,%edx
+  803695:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80369a:	29 d0                	sub    %edx,%eax
+  80369c:	89 c2                	mov    %eax,%edx
+  80369e:	c1 ea 0f             	shr    $0xf,%edx
+  8036a1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ab:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8036ae:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8036b5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8036bb:	89 03                	mov    %eax,(%ebx)
+  8036bd:	89 e2                	mov    %esp,%edx
+  8036bf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036c4:	29 d0                	sub    %edx,%eax
+  8036c6:	89 c2                	mov    %eax,%edx
+  8036c8:	c1 ea 0f             	shr    $0xf,%edx
+  8036cb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d5:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036d8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8036df:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8036e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036e8:	5b                   	pop    %ebx
+  8036e9:	5e                   	pop    %esi
+  8036ea:	5d                   	pop    %ebp
+  8036eb:	c3                   	ret
+		if(from_env_store != NULL)
+  8036ec:	85 f6                	test   %esi,%esi
+  8036ee:	74 06                	je     8036f6 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8036f0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8036f6:	85 db                	test   %ebx,%ebx
+  8036f8:	74 eb                	je     8036e5 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8036fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803700:	eb e3                	jmp    8036e5 <ipc_recv+0xb0>
+
+00803702 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803702:	55                   	push   %ebp
+  803703:	89 e5                	mov    %esp,%ebp
+  803705:	57                   	push   %edi
+  803706:	56                   	push   %esi
+  803707:	53                   	push   %ebx
+  803708:	83 ec 14             	sub    $0x14,%esp
+  80370b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80370e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803711:	8b 75 14             	mov    0x14(%ebp),%esi
+  803714:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803717:	85 c0                	test   %eax,%eax
+  803719:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80371e:	0f 44 c2             	cmove  %edx,%eax
+  803721:	ff 75 10             	push   0x10(%ebp)
+  803724:	50                   	push   %eax
+  803725:	e8 9c d8 ff ff       	call   800fc6 <sys_ipc_recv_pages>
+  80372a:	83 c4 10             	add    $0x10,%esp
+  80372d:	85 c0                	test   %eax,%eax
+  80372f:	0f 88 ba 00 00 00    	js     8037ef <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803735:	85 ff                	test   %edi,%edi
+  803737:	74 2a                	je     803763 <ipc_recv_pages+0x61>
+  803739:	89 e2                	mov    %esp,%edx
+  80373b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803740:	29 d0                	sub    %edx,%eax
+  803742:	89 c2                	mov    %eax,%edx
+  803744:	c1 ea 0f             	shr    $0xf,%edx
+  803747:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80374c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803751:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803754:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80375b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803761:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803763:	85 f6                	test   %esi,%esi
+  803765:	74 2a                	je     803791 <ipc_recv_pages+0x8f>
+  803767:	89 e2                	mov    %esp,%edx
+  803769:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80376e:	29 d0                	sub    %edx,%eax
+  803770:	89 c2                	mov    %eax,%edx
+  803772:	c1 ea 0f             	shr    $0xf,%edx
+  803775:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80377a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377f:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803782:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803789:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80378f:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803791:	85 db                	test   %ebx,%ebx
+  803793:	74 2a                	je     8037bf <ipc_recv_pages+0xbd>
+  803795:	89 e2                	mov    %esp,%edx
+  803797:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80379c:	29 d0                	sub    %edx,%eax
+  80379e:	89 c2                	mov    %eax,%edx
+  8037a0:	c1 ea 0f             	shr    $0xf,%edx
+  8037a3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ad:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8037b0:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037b7:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8037bd:	89 03                	mov    %eax,(%ebx)
+  8037bf:	89 e2                	mov    %esp,%edx
+  8037c1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037c6:	29 d0                	sub    %edx,%eax
+  8037c8:	89 c2                	mov    %eax,%edx
+  8037ca:	c1 ea 0f             	shr    $0xf,%edx
+  8037cd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d7:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8037da:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037e1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8037e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037ea:	5b                   	pop    %ebx
+  8037eb:	5e                   	pop    %esi
+  8037ec:	5f                   	pop    %edi
+  8037ed:	5d                   	pop    %ebp
+  8037ee:	c3                   	ret
+		if (from_env_store)
+  8037ef:	85 ff                	test   %edi,%edi
+  8037f1:	74 06                	je     8037f9 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8037f3:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8037f9:	85 f6                	test   %esi,%esi
+  8037fb:	74 06                	je     803803 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8037fd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803803:	85 db                	test   %ebx,%ebx
+  803805:	74 e0                	je     8037e7 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803807:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80380d:	eb d8                	jmp    8037e7 <ipc_recv_pages+0xe5>
+
+0080380f <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80380f:	55                   	push   %ebp
+  803810:	89 e5                	mov    %esp,%ebp
+  803812:	57                   	push   %edi
+  803813:	56                   	push   %esi
+  803814:	53                   	push   %ebx
+  803815:	83 ec 1c             	sub    $0x1c,%esp
+  803818:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80381b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80381e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803824:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803828:	75 2b                	jne    803855 <ipc_try_send_pages+0x46>
+  80382a:	89 e2                	mov    %esp,%edx
+  80382c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803831:	29 d0                	sub    %edx,%eax
+  803833:	89 c2                	mov    %eax,%edx
+  803835:	c1 ea 0f             	shr    $0xf,%edx
+  803838:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80383d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803842:	0f 42 c2             	cmovb  %edx,%eax
+  803845:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80384c:	8b 70 48             	mov    0x48(%eax),%esi
+  80384f:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803855:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80385b:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803860:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803863:	85 ff                	test   %edi,%edi
+  803865:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80386a:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80386d:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803873:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803879:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80387f:	83 ec 0c             	sub    $0xc,%esp
+  803882:	ff 75 14             	push   0x14(%ebp)
+  803885:	ff 75 18             	push   0x18(%ebp)
+  803888:	57                   	push   %edi
+  803889:	ff 75 0c             	push   0xc(%ebp)
+  80388c:	ff 75 08             	push   0x8(%ebp)
+  80388f:	e8 11 d7 ff ff       	call   800fa5 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803894:	83 c4 20             	add    $0x20,%esp
+  803897:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80389a:	75 21                	jne    8038bd <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80389c:	83 ec 04             	sub    $0x4,%esp
+  80389f:	6a ff                	push   $0xffffffff
+  8038a1:	53                   	push   %ebx
+  8038a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8038a5:	e8 08 d9 ff ff       	call   8011b2 <sys_futex_wait>
+  8038aa:	83 c4 10             	add    $0x10,%esp
+  8038ad:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8038b0:	74 c7                	je     803879 <ipc_try_send_pages+0x6a>
+  8038b2:	85 c0                	test   %eax,%eax
+  8038b4:	79 c3                	jns    803879 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8038b6:	e8 da d4 ff ff       	call   800d95 <sys_yield>
+  8038bb:	eb bc                	jmp    803879 <ipc_try_send_pages+0x6a>
+	}
+}
+  8038bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038c0:	5b                   	pop    %ebx
+  8038c1:	5e                   	pop    %esi
+  8038c2:	5f                   	pop    %edi
+  8038c3:	5d                   	pop    %ebp
+  8038c4:	c3                   	ret
+
+008038c5 <ipc_send>:
+{
+  8038c5:	55                   	push   %ebp
+  8038c6:	89 e5                	mov    %esp,%ebp
+  8038c8:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8038cb:	ff 75 14             	push   0x14(%ebp)
+  8038ce:	6a 01                	push   $0x1
+  8038d0:	ff 75 10             	push   0x10(%ebp)
+  8038d3:	ff 75 0c             	push   0xc(%ebp)
+  8038d6:	ff 75 08             	push   0x8(%ebp)
+  8038d9:	e8 31 ff ff ff       	call   80380f <ipc_try_send_pages>
+  8038de:	83 c4 20             	add    $0x20,%esp
+  8038e1:	85 c0                	test   %eax,%eax
+  8038e3:	78 02                	js     8038e7 <ipc_send+0x22>
+}
+  8038e5:	c9                   	leave
+  8038e6:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8038e7:	50                   	push   %eax
+  8038e8:	68 0f 41 80 00       	push   $0x80410f
+  8038ed:	6a 3f                	push   $0x3f
+  8038ef:	68 24 41 80 00       	push   $0x804124
+  8038f4:	e8 f6 fc ff ff       	call   8035ef <_panic>
+
+008038f9 <ipc_send_pages>:
+{
+  8038f9:	55                   	push   %ebp
+  8038fa:	89 e5                	mov    %esp,%ebp
+  8038fc:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8038ff:	ff 75 18             	push   0x18(%ebp)
+  803902:	ff 75 14             	push   0x14(%ebp)
+  803905:	ff 75 10             	push   0x10(%ebp)
+  803908:	ff 75 0c             	push   0xc(%ebp)
+  80390b:	ff 75 08             	push   0x8(%ebp)
+  80390e:	e8 fc fe ff ff       	call   80380f <ipc_try_send_pages>
+  803913:	83 c4 20             	add    $0x20,%esp
+  803916:	85 c0                	test   %eax,%eax
+  803918:	78 02                	js     80391c <ipc_send_pages+0x23>
+}
+  80391a:	c9                   	leave
+  80391b:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80391c:	50                   	push   %eax
+  80391d:	68 2e 41 80 00       	push   $0x80412e
+  803922:	6a 64                	push   $0x64
+  803924:	68 24 41 80 00       	push   $0x804124
+  803929:	e8 c1 fc ff ff       	call   8035ef <_panic>
+
+0080392e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80392e:	55                   	push   %ebp
+  80392f:	89 e5                	mov    %esp,%ebp
+  803931:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803934:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803939:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80393f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803945:	8b 52 50             	mov    0x50(%edx),%edx
+  803948:	39 ca                	cmp    %ecx,%edx
+  80394a:	74 11                	je     80395d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80394c:	83 c0 01             	add    $0x1,%eax
+  80394f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803954:	75 e3                	jne    803939 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395b:	eb 0e                	jmp    80396b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80395d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803963:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803968:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80396b:	5d                   	pop    %ebp
+  80396c:	c3                   	ret
+
+0080396d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80396d:	55                   	push   %ebp
+  80396e:	89 e5                	mov    %esp,%ebp
+  803970:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803973:	89 c2                	mov    %eax,%edx
+  803975:	c1 ea 16             	shr    $0x16,%edx
+  803978:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80397f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803984:	f6 c1 01             	test   $0x1,%cl
+  803987:	74 1e                	je     8039a7 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803989:	c1 e8 0c             	shr    $0xc,%eax
+  80398c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803993:	a8 01                	test   $0x1,%al
+  803995:	74 10                	je     8039a7 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803997:	c1 e8 0c             	shr    $0xc,%eax
+  80399a:	c1 e0 04             	shl    $0x4,%eax
+  80399d:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8039a4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8039a7:	89 d0                	mov    %edx,%eax
+  8039a9:	5d                   	pop    %ebp
+  8039aa:	c3                   	ret
+
+008039ab <__udivdi3>:
+  8039ab:	57                   	push   %edi
+  8039ac:	56                   	push   %esi
+  8039ad:	53                   	push   %ebx
+  8039ae:	83 ec 20             	sub    $0x20,%esp
+  8039b1:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8039b5:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8039b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039bd:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039c1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039c5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039c9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8039cd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8039d1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039e0:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8039e7:	00 
+  8039e8:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8039ef:	00 
+  8039f0:	eb 08                	jmp    8039fa <__udivdi3+0x4f>
+  8039f2:	83 e9 01             	sub    $0x1,%ecx
+  8039f5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039f8:	74 68                	je     803a62 <__udivdi3+0xb7>
+  8039fa:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8039fe:	01 c0                	add    %eax,%eax
+  803a00:	89 c6                	mov    %eax,%esi
+  803a02:	89 d7                	mov    %edx,%edi
+  803a04:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a08:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a0c:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a0f:	d3 ea                	shr    %cl,%edx
+  803a11:	f6 c1 20             	test   $0x20,%cl
+  803a14:	74 04                	je     803a1a <__udivdi3+0x6f>
+  803a16:	89 d0                	mov    %edx,%eax
+  803a18:	31 d2                	xor    %edx,%edx
+  803a1a:	83 e0 01             	and    $0x1,%eax
+  803a1d:	89 04 24             	mov    %eax,(%esp)
+  803a20:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803a27:	00 
+  803a28:	8b 04 24             	mov    (%esp),%eax
+  803a2b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803a2f:	09 f0                	or     %esi,%eax
+  803a31:	09 fa                	or     %edi,%edx
+  803a33:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803a37:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803a3b:	39 f0                	cmp    %esi,%eax
+  803a3d:	89 d3                	mov    %edx,%ebx
+  803a3f:	19 fb                	sbb    %edi,%ebx
+  803a41:	72 af                	jb     8039f2 <__udivdi3+0x47>
+  803a43:	29 f0                	sub    %esi,%eax
+  803a45:	19 fa                	sbb    %edi,%edx
+  803a47:	89 cf                	mov    %ecx,%edi
+  803a49:	c1 ef 05             	shr    $0x5,%edi
+  803a4c:	83 e7 01             	and    $0x1,%edi
+  803a4f:	89 fe                	mov    %edi,%esi
+  803a51:	83 f6 01             	xor    $0x1,%esi
+  803a54:	d3 e6                	shl    %cl,%esi
+  803a56:	d3 e7                	shl    %cl,%edi
+  803a58:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a5c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a60:	eb 90                	jmp    8039f2 <__udivdi3+0x47>
+  803a62:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a66:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a6a:	83 c4 20             	add    $0x20,%esp
+  803a6d:	5b                   	pop    %ebx
+  803a6e:	5e                   	pop    %esi
+  803a6f:	5f                   	pop    %edi
+  803a70:	c3                   	ret
+
+00803a71 <__umoddi3>:
+  803a71:	57                   	push   %edi
+  803a72:	56                   	push   %esi
+  803a73:	53                   	push   %ebx
+  803a74:	83 ec 08             	sub    $0x8,%esp
+  803a77:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a7b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a7f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a83:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a87:	57                   	push   %edi
+  803a88:	56                   	push   %esi
+  803a89:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a8d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a91:	52                   	push   %edx
+  803a92:	50                   	push   %eax
+  803a93:	e8 13 ff ff ff       	call   8039ab <__udivdi3>
+  803a98:	89 c3                	mov    %eax,%ebx
+  803a9a:	0f af d6             	imul   %esi,%edx
+  803a9d:	89 f9                	mov    %edi,%ecx
+  803a9f:	0f af cb             	imul   %ebx,%ecx
+  803aa2:	01 d1                	add    %edx,%ecx
+  803aa4:	89 d8                	mov    %ebx,%eax
+  803aa6:	f7 e6                	mul    %esi
+  803aa8:	89 c6                	mov    %eax,%esi
+  803aaa:	89 d7                	mov    %edx,%edi
+  803aac:	01 cf                	add    %ecx,%edi
+  803aae:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803ab2:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803ab6:	29 f0                	sub    %esi,%eax
+  803ab8:	19 fa                	sbb    %edi,%edx
+  803aba:	83 c4 18             	add    $0x18,%esp
+  803abd:	5b                   	pop    %ebx
+  803abe:	5e                   	pop    %esi
+  803abf:	5f                   	pop    %edi
+  803ac0:	c3                   	ret
+
+00803ac1 <__divdi3>:
+  803ac1:	53                   	push   %ebx
+  803ac2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ac6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803aca:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ace:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803ad2:	85 d2                	test   %edx,%edx
+  803ad4:	78 12                	js     803ae8 <__divdi3+0x27>
+  803ad6:	85 db                	test   %ebx,%ebx
+  803ad8:	78 2e                	js     803b08 <__divdi3+0x47>
+  803ada:	53                   	push   %ebx
+  803adb:	51                   	push   %ecx
+  803adc:	52                   	push   %edx
+  803add:	50                   	push   %eax
+  803ade:	e8 c8 fe ff ff       	call   8039ab <__udivdi3>
+  803ae3:	83 c4 10             	add    $0x10,%esp
+  803ae6:	eb 1e                	jmp    803b06 <__divdi3+0x45>
+  803ae8:	f7 d8                	neg    %eax
+  803aea:	83 d2 00             	adc    $0x0,%edx
+  803aed:	f7 da                	neg    %edx
+  803aef:	85 db                	test   %ebx,%ebx
+  803af1:	78 2a                	js     803b1d <__divdi3+0x5c>
+  803af3:	53                   	push   %ebx
+  803af4:	51                   	push   %ecx
+  803af5:	52                   	push   %edx
+  803af6:	50                   	push   %eax
+  803af7:	e8 af fe ff ff       	call   8039ab <__udivdi3>
+  803afc:	83 c4 10             	add    $0x10,%esp
+  803aff:	f7 d8                	neg    %eax
+  803b01:	83 d2 00             	adc    $0x0,%edx
+  803b04:	f7 da                	neg    %edx
+  803b06:	5b                   	pop    %ebx
+  803b07:	c3                   	ret
+  803b08:	f7 d9                	neg    %ecx
+  803b0a:	83 d3 00             	adc    $0x0,%ebx
+  803b0d:	f7 db                	neg    %ebx
+  803b0f:	53                   	push   %ebx
+  803b10:	51                   	push   %ecx
+  803b11:	52                   	push   %edx
+  803b12:	50                   	push   %eax
+  803b13:	e8 93 fe ff ff       	call   8039ab <__udivdi3>
+  803b18:	83 c4 10             	add    $0x10,%esp
+  803b1b:	eb e2                	jmp    803aff <__divdi3+0x3e>
+  803b1d:	f7 d9                	neg    %ecx
+  803b1f:	83 d3 00             	adc    $0x0,%ebx
+  803b22:	f7 db                	neg    %ebx
+  803b24:	53                   	push   %ebx
+  803b25:	51                   	push   %ecx
+  803b26:	52                   	push   %edx
+  803b27:	50                   	push   %eax
+  803b28:	e8 7e fe ff ff       	call   8039ab <__udivdi3>
+  803b2d:	83 c4 10             	add    $0x10,%esp
+  803b30:	eb d4                	jmp    803b06 <__divdi3+0x45>
+
+00803b32 <__moddi3>:
+  803b32:	57                   	push   %edi
+  803b33:	56                   	push   %esi
+  803b34:	53                   	push   %ebx
+  803b35:	83 ec 08             	sub    $0x8,%esp
+  803b38:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b3c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b40:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803b44:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803b48:	57                   	push   %edi
+  803b49:	56                   	push   %esi
+  803b4a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b4e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b52:	52                   	push   %edx
+  803b53:	50                   	push   %eax
+  803b54:	e8 68 ff ff ff       	call   803ac1 <__divdi3>
+  803b59:	89 c3                	mov    %eax,%ebx
+  803b5b:	0f af d6             	imul   %esi,%edx
+  803b5e:	89 f9                	mov    %edi,%ecx
+  803b60:	0f af cb             	imul   %ebx,%ecx
+  803b63:	01 d1                	add    %edx,%ecx
+  803b65:	89 d8                	mov    %ebx,%eax
+  803b67:	f7 e6                	mul    %esi
+  803b69:	89 c6                	mov    %eax,%esi
+  803b6b:	89 d7                	mov    %edx,%edi
+  803b6d:	01 cf                	add    %ecx,%edi
+  803b6f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b73:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b77:	29 f0                	sub    %esi,%eax
+  803b79:	19 fa                	sbb    %edi,%edx
+  803b7b:	83 c4 18             	add    $0x18,%esp
+  803b7e:	5b                   	pop    %ebx
+  803b7f:	5e                   	pop    %esi
+  803b80:	5f                   	pop    %edi
+  803b81:	c3                   	ret
@@ -0,0 +1,9786 @@
+
+obj/user/netmulti.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 70 04 00 00       	call   8004a1 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+
+static char buf[BUFSIZE];
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 60 4b 80 00       	push   $0x804b60
+  800041:	e8 dd 05 00 00       	call   800623 <cprintf>
+	exit();
+  800046:	e8 e3 04 00 00       	call   80052e <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <umain>:
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	57                   	push   %edi
+  800054:	56                   	push   %esi
+  800055:	53                   	push   %ebx
+  800056:	81 ec 00 01 00 00    	sub    $0x100,%esp
+	struct NetStats ns0, ns1;
+	uint32_t bytes, total, conns, nconn;
+	unsigned start, ms;
+	int q, i, r, nshard;
+
+	binaryname = "netmulti";
+  80005c:	c7 05 00 60 80 00 64 	movl   $0x804b64,0x806000
+  800063:	4b 80 00 
+	if ((r = sys_page_alloc(0, CTL, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  800066:	68 07 04 00 00       	push   $0x407
+  80006b:	68 00 f0 ff 0f       	push   $0xffff000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 d7 10 00 00       	call   80114e <sys_page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	78 2a                	js     8000a8 <umain+0x58>
+		panic("sys_page_alloc: %e", r);
+	sys_net_stats(&ns0);
+  80007e:	83 ec 0c             	sub    $0xc,%esp
+  800081:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800084:	50                   	push   %eax
+  800085:	e8 fb 13 00 00       	call   801485 <sys_net_stats>
+	nshard = ns0.ns_rx_queues;
+  80008a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80008d:	89 9d 04 ff ff ff    	mov    %ebx,-0xfc(%ebp)
+	for (q = 0; q < nshard; q++) {
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 db                	test   %ebx,%ebx
+  800098:	0f 8e 79 02 00 00    	jle    800317 <umain+0x2c7>
+  80009e:	be 00 00 00 00       	mov    $0x0,%esi
+  8000a3:	e9 5b 01 00 00       	jmp    800203 <umain+0x1b3>
+		panic("sys_page_alloc: %e", r);
+  8000a8:	50                   	push   %eax
+  8000a9:	68 6d 4b 80 00       	push   $0x804b6d
+  8000ae:	6a 59                	push   $0x59
+  8000b0:	68 80 4b 80 00       	push   $0x804b80
+  8000b5:	e8 8e 04 00 00       	call   800548 <_panic>
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  8000ba:	50                   	push   %eax
+  8000bb:	68 ca 50 80 00       	push   $0x8050ca
+  8000c0:	6a 5e                	push   $0x5e
+  8000c2:	68 80 4b 80 00       	push   $0x804b80
+  8000c7:	e8 7c 04 00 00       	call   800548 <_panic>
+		panic("nsipc_shard %d: %e", shard, r);
+  8000cc:	83 ec 0c             	sub    $0xc,%esp
+  8000cf:	50                   	push   %eax
+  8000d0:	56                   	push   %esi
+  8000d1:	68 90 4b 80 00       	push   $0x804b90
+  8000d6:	6a 35                	push   $0x35
+  8000d8:	68 80 4b 80 00       	push   $0x804b80
+  8000dd:	e8 66 04 00 00       	call   800548 <_panic>
+		die("Failed to create socket");
+  8000e2:	b8 a3 4b 80 00       	mov    $0x804ba3,%eax
+  8000e7:	e8 49 ff ff ff       	call   800035 <die>
+  8000ec:	e9 56 01 00 00       	jmp    800247 <umain+0x1f7>
+		die("Failed to bind the server socket");
+  8000f1:	b8 f8 4b 80 00       	mov    $0x804bf8,%eax
+  8000f6:	e8 3a ff ff ff       	call   800035 <die>
+  8000fb:	e9 a8 01 00 00       	jmp    8002a8 <umain+0x258>
+		die("Failed to listen on server socket");
+  800100:	b8 1c 4c 80 00       	mov    $0x804c1c,%eax
+  800105:	e8 2b ff ff ff       	call   800035 <die>
+  80010a:	e9 b4 01 00 00       	jmp    8002c3 <umain+0x273>
+			die("Failed to accept client connection");
+  80010f:	b8 40 4c 80 00       	mov    $0x804c40,%eax
+  800114:	e8 1c ff ff ff       	call   800035 <die>
+  800119:	eb 7f                	jmp    80019a <umain+0x14a>
+			panic("fork: %e", r);
+  80011b:	50                   	push   %eax
+  80011c:	68 ca 50 80 00       	push   $0x8050ca
+  800121:	6a 47                	push   $0x47
+  800123:	68 80 4b 80 00       	push   $0x804b80
+  800128:	e8 1b 04 00 00       	call   800548 <_panic>
+	close(sock);
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	53                   	push   %ebx
+  800131:	e8 b3 1d 00 00       	call   801ee9 <close>
+	CTL->done[shard][i] = 1;
+  800136:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+  80013c:	8d 44 07 24          	lea    0x24(%edi,%eax,1),%eax
+  800140:	c7 04 85 00 f0 ff 0f 	movl   $0x1,0xffff000(,%eax,4)
+  800147:	01 00 00 00 
+	exit();
+  80014b:	e8 de 03 00 00       	call   80052e <exit>
+}
+  800150:	83 c4 10             	add    $0x10,%esp
+		close(c);
+  800153:	83 ec 0c             	sub    $0xc,%esp
+  800156:	53                   	push   %ebx
+  800157:	e8 8d 1d 00 00       	call   801ee9 <close>
+	for (i = 0; i < NCONN; i++) {
+  80015c:	83 c7 01             	add    $0x1,%edi
+  80015f:	83 c4 10             	add    $0x10,%esp
+  800162:	83 ff 08             	cmp    $0x8,%edi
+  800165:	74 7e                	je     8001e5 <umain+0x195>
+		len = sizeof(addr);
+  800167:	c7 85 1c ff ff ff 10 	movl   $0x10,-0xe4(%ebp)
+  80016e:	00 00 00 
+		if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+  800171:	83 ec 04             	sub    $0x4,%esp
+  800174:	8d 85 1c ff ff ff    	lea    -0xe4(%ebp),%eax
+  80017a:	50                   	push   %eax
+  80017b:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+  800181:	50                   	push   %eax
+  800182:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+  800188:	e8 cc 26 00 00       	call   802859 <accept>
+  80018d:	89 c3                	mov    %eax,%ebx
+  80018f:	83 c4 10             	add    $0x10,%esp
+  800192:	85 c0                	test   %eax,%eax
+  800194:	0f 88 75 ff ff ff    	js     80010f <umain+0xbf>
+		if ((r = fork()) < 0)
+  80019a:	e8 b7 15 00 00       	call   801756 <fork>
+  80019f:	85 c0                	test   %eax,%eax
+  8001a1:	0f 88 74 ff ff ff    	js     80011b <umain+0xcb>
+		if (r == 0)
+  8001a7:	75 aa                	jne    800153 <umain+0x103>
+		CTL->bytes[shard][i] += n;
+  8001a9:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+  8001af:	8d 34 38             	lea    (%eax,%edi,1),%esi
+	while ((n = read(sock, buf, sizeof(buf))) > 0)
+  8001b2:	83 ec 04             	sub    $0x4,%esp
+  8001b5:	68 00 08 00 00       	push   $0x800
+  8001ba:	68 00 70 80 00       	push   $0x807000
+  8001bf:	53                   	push   %ebx
+  8001c0:	e8 63 1e 00 00       	call   802028 <read>
+  8001c5:	83 c4 10             	add    $0x10,%esp
+  8001c8:	85 c0                	test   %eax,%eax
+  8001ca:	0f 8e 5d ff ff ff    	jle    80012d <umain+0xdd>
+		CTL->bytes[shard][i] += n;
+  8001d0:	8d 56 04             	lea    0x4(%esi),%edx
+  8001d3:	8b 0c 95 00 f0 ff 0f 	mov    0xffff000(,%edx,4),%ecx
+  8001da:	01 c8                	add    %ecx,%eax
+  8001dc:	89 04 95 00 f0 ff 0f 	mov    %eax,0xffff000(,%edx,4)
+  8001e3:	eb cd                	jmp    8001b2 <umain+0x162>
+	exit();
+  8001e5:	8b 9d 0c ff ff ff    	mov    -0xf4(%ebp),%ebx
+  8001eb:	8b b5 08 ff ff ff    	mov    -0xf8(%ebp),%esi
+  8001f1:	e8 38 03 00 00       	call   80052e <exit>
+	for (q = 0; q < nshard; q++) {
+  8001f6:	8d 46 01             	lea    0x1(%esi),%eax
+  8001f9:	39 c3                	cmp    %eax,%ebx
+  8001fb:	0f 84 eb 00 00 00    	je     8002ec <umain+0x29c>
+  800201:	89 c6                	mov    %eax,%esi
+		if ((r = fork()) < 0)
+  800203:	e8 4e 15 00 00       	call   801756 <fork>
+  800208:	89 c7                	mov    %eax,%edi
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	0f 88 a8 fe ff ff    	js     8000ba <umain+0x6a>
+		if (r == 0)
+  800212:	75 e2                	jne    8001f6 <umain+0x1a6>
+	if ((r = nsipc_shard(shard)) < 0)
+  800214:	83 ec 0c             	sub    $0xc,%esp
+  800217:	56                   	push   %esi
+  800218:	e8 15 35 00 00       	call   803732 <nsipc_shard>
+  80021d:	83 c4 10             	add    $0x10,%esp
+  800220:	85 c0                	test   %eax,%eax
+  800222:	0f 88 a4 fe ff ff    	js     8000cc <umain+0x7c>
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800228:	83 ec 04             	sub    $0x4,%esp
+  80022b:	6a 06                	push   $0x6
+  80022d:	6a 01                	push   $0x1
+  80022f:	6a 02                	push   $0x2
+  800231:	e8 06 28 00 00       	call   802a3c <socket>
+  800236:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+  80023c:	83 c4 10             	add    $0x10,%esp
+  80023f:	85 c0                	test   %eax,%eax
+  800241:	0f 88 9b fe ff ff    	js     8000e2 <umain+0x92>
+	memset(&addr, 0, sizeof(addr));
+  800247:	83 ec 04             	sub    $0x4,%esp
+  80024a:	6a 10                	push   $0x10
+  80024c:	6a 00                	push   $0x0
+  80024e:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+  800254:	50                   	push   %eax
+  800255:	e8 3b 0c 00 00       	call   800e95 <memset>
+	addr.sin_family = AF_INET;
+  80025a:	c6 85 21 ff ff ff 02 	movb   $0x2,-0xdf(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  800261:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800268:	e8 c3 44 00 00       	call   804730 <htonl>
+  80026d:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+	addr.sin_port = htons(PORT);
+  800273:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80027a:	e8 97 44 00 00       	call   804716 <htons>
+  80027f:	66 89 85 22 ff ff ff 	mov    %ax,-0xde(%ebp)
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  800286:	83 c4 0c             	add    $0xc,%esp
+  800289:	6a 10                	push   $0x10
+  80028b:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+  800291:	50                   	push   %eax
+  800292:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+  800298:	e8 fe 25 00 00       	call   80289b <bind>
+  80029d:	83 c4 10             	add    $0x10,%esp
+  8002a0:	85 c0                	test   %eax,%eax
+  8002a2:	0f 88 49 fe ff ff    	js     8000f1 <umain+0xa1>
+	if (listen(s, NCONN) < 0)
+  8002a8:	83 ec 08             	sub    $0x8,%esp
+  8002ab:	6a 08                	push   $0x8
+  8002ad:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+  8002b3:	e8 52 26 00 00       	call   80290a <listen>
+  8002b8:	83 c4 10             	add    $0x10,%esp
+  8002bb:	85 c0                	test   %eax,%eax
+  8002bd:	0f 88 3d fe ff ff    	js     800100 <umain+0xb0>
+	CTL->listening[shard] = 1;
+  8002c3:	c7 04 b5 00 f0 ff 0f 	movl   $0x1,0xffff000(,%esi,4)
+  8002ca:	01 00 00 00 
+		CTL->bytes[shard][i] += n;
+  8002ce:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+  8002d5:	89 85 10 ff ff ff    	mov    %eax,-0xf0(%ebp)
+  8002db:	89 9d 0c ff ff ff    	mov    %ebx,-0xf4(%ebp)
+  8002e1:	89 b5 08 ff ff ff    	mov    %esi,-0xf8(%ebp)
+  8002e7:	e9 7b fe ff ff       	jmp    800167 <umain+0x117>
+			worker(q);
+	}
+	for (q = 0; q < nshard; q++)
+  8002ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		while (!CTL->listening[q])
+  8002f1:	8b 04 9d 00 f0 ff 0f 	mov    0xffff000(,%ebx,4),%eax
+  8002f8:	85 c0                	test   %eax,%eax
+  8002fa:	75 10                	jne    80030c <umain+0x2bc>
+			sys_yield();
+  8002fc:	e8 2e 0e 00 00       	call   80112f <sys_yield>
+		while (!CTL->listening[q])
+  800301:	8b 04 9d 00 f0 ff 0f 	mov    0xffff000(,%ebx,4),%eax
+  800308:	85 c0                	test   %eax,%eax
+  80030a:	74 f0                	je     8002fc <umain+0x2ac>
+	for (q = 0; q < nshard; q++)
+  80030c:	8d 43 01             	lea    0x1(%ebx),%eax
+  80030f:	39 de                	cmp    %ebx,%esi
+  800311:	74 04                	je     800317 <umain+0x2c7>
+  800313:	89 c3                	mov    %eax,%ebx
+  800315:	eb da                	jmp    8002f1 <umain+0x2a1>
+
+	cprintf("netmulti: ready, %d shards\n", nshard);
+  800317:	83 ec 08             	sub    $0x8,%esp
+  80031a:	8b b5 04 ff ff ff    	mov    -0xfc(%ebp),%esi
+  800320:	56                   	push   %esi
+  800321:	68 bb 4b 80 00       	push   $0x804bbb
+  800326:	e8 f8 02 00 00       	call   800623 <cprintf>
+	start = sys_time_msec();
+  80032b:	e8 72 10 00 00       	call   8013a2 <sys_time_msec>
+  800330:	83 c4 10             	add    $0x10,%esp
+  800333:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+  800339:	89 f7                	mov    %esi,%edi
+	do {
+		sys_yield();
+  80033b:	e8 ef 0d 00 00       	call   80112f <sys_yield>
+		nconn = 0;
+		for (q = 0; q < nshard; q++)
+  800340:	be 00 00 00 00       	mov    $0x0,%esi
+		nconn = 0;
+  800345:	bb 00 00 00 00       	mov    $0x0,%ebx
+		for (q = 0; q < nshard; q++)
+  80034a:	85 ff                	test   %edi,%edi
+  80034c:	7e ed                	jle    80033b <umain+0x2eb>
+			for (i = 0; i < NCONN; i++)
+  80034e:	b8 00 00 00 00       	mov    $0x0,%eax
+				nconn += CTL->done[q][i];
+  800353:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  80035a:	8d 54 08 24          	lea    0x24(%eax,%ecx,1),%edx
+  80035e:	8b 14 95 00 f0 ff 0f 	mov    0xffff000(,%edx,4),%edx
+  800365:	01 d3                	add    %edx,%ebx
+			for (i = 0; i < NCONN; i++)
+  800367:	83 c0 01             	add    $0x1,%eax
+  80036a:	83 f8 08             	cmp    $0x8,%eax
+  80036d:	75 eb                	jne    80035a <umain+0x30a>
+		for (q = 0; q < nshard; q++)
+  80036f:	83 c6 01             	add    $0x1,%esi
+  800372:	39 f7                	cmp    %esi,%edi
+  800374:	75 d8                	jne    80034e <umain+0x2fe>
+	} while (nconn < NCONN);
+  800376:	83 fb 07             	cmp    $0x7,%ebx
+  800379:	76 c0                	jbe    80033b <umain+0x2eb>
+	ms = sys_time_msec() - start;
+  80037b:	8b bd 14 ff ff ff    	mov    -0xec(%ebp),%edi
+  800381:	e8 1c 10 00 00       	call   8013a2 <sys_time_msec>
+  800386:	29 f8                	sub    %edi,%eax
+  800388:	89 85 0c ff ff ff    	mov    %eax,-0xf4(%ebp)
+	sys_net_stats(&ns1);
+  80038e:	83 ec 0c             	sub    $0xc,%esp
+  800391:	8d 85 30 ff ff ff    	lea    -0xd0(%ebp),%eax
+  800397:	50                   	push   %eax
+  800398:	e8 e8 10 00 00       	call   801485 <sys_net_stats>
+
+	total = 0;
+	for (q = 0; q < nshard; q++) {
+  80039d:	83 c4 10             	add    $0x10,%esp
+  8003a0:	be 00 00 00 00       	mov    $0x0,%esi
+	total = 0;
+  8003a5:	c7 85 10 ff ff ff 00 	movl   $0x0,-0xf0(%ebp)
+  8003ac:	00 00 00 
+	for (q = 0; q < nshard; q++) {
+  8003af:	83 bd 04 ff ff ff 00 	cmpl   $0x0,-0xfc(%ebp)
+  8003b6:	0f 8e 81 00 00 00    	jle    80043d <umain+0x3ed>
+  8003bc:	89 9d 08 ff ff ff    	mov    %ebx,-0xf8(%ebp)
+		bytes = conns = 0;
+		for (i = 0; i < NCONN; i++) {
+  8003c2:	ba 00 00 00 00       	mov    $0x0,%edx
+		bytes = conns = 0;
+  8003c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			bytes += CTL->bytes[q][i];
+  8003d1:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+  8003d8:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%ebp)
+  8003de:	8d 04 17             	lea    (%edi,%edx,1),%eax
+  8003e1:	8d 70 04             	lea    0x4(%eax),%esi
+  8003e4:	8b 34 b5 00 f0 ff 0f 	mov    0xffff000(,%esi,4),%esi
+  8003eb:	01 f1                	add    %esi,%ecx
+			conns += CTL->done[q][i];
+  8003ed:	83 c0 24             	add    $0x24,%eax
+  8003f0:	8b 04 85 00 f0 ff 0f 	mov    0xffff000(,%eax,4),%eax
+  8003f7:	01 c3                	add    %eax,%ebx
+		for (i = 0; i < NCONN; i++) {
+  8003f9:	83 c2 01             	add    $0x1,%edx
+  8003fc:	83 fa 08             	cmp    $0x8,%edx
+  8003ff:	75 dd                	jne    8003de <umain+0x38e>
+		}
+		total += bytes;
+  800401:	8b b5 14 ff ff ff    	mov    -0xec(%ebp),%esi
+  800407:	01 8d 10 ff ff ff    	add    %ecx,-0xf0(%ebp)
+		cprintf("netmulti: shard %d: %u connections, %u bytes, "
+  80040d:	83 ec 0c             	sub    $0xc,%esp
+  800410:	8b 84 b5 78 ff ff ff 	mov    -0x88(%ebp,%esi,4),%eax
+  800417:	2b 44 b5 d4          	sub    -0x2c(%ebp,%esi,4),%eax
+  80041b:	50                   	push   %eax
+  80041c:	51                   	push   %ecx
+  80041d:	53                   	push   %ebx
+  80041e:	56                   	push   %esi
+  80041f:	68 64 4c 80 00       	push   $0x804c64
+  800424:	e8 fa 01 00 00       	call   800623 <cprintf>
+	for (q = 0; q < nshard; q++) {
+  800429:	83 c6 01             	add    $0x1,%esi
+  80042c:	83 c4 20             	add    $0x20,%esp
+  80042f:	39 b5 04 ff ff ff    	cmp    %esi,-0xfc(%ebp)
+  800435:	75 8b                	jne    8003c2 <umain+0x372>
+  800437:	8b 9d 08 ff ff ff    	mov    -0xf8(%ebp),%ebx
+			"%u packets\n", q, conns, bytes,
+			ns1.ns_rxq_packets[q] - ns0.ns_rxq_packets[q]);
+	}
+	cprintf("netmulti: %u connections, %u bytes in %u ms, %u KB/s\n",
+  80043d:	83 ec 0c             	sub    $0xc,%esp
+		nconn, total, ms, total / (ms ? ms : 1) * 1000 / 1024);
+  800440:	8b bd 0c ff ff ff    	mov    -0xf4(%ebp),%edi
+  800446:	85 ff                	test   %edi,%edi
+  800448:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80044d:	0f 45 cf             	cmovne %edi,%ecx
+  800450:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+  800456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045b:	f7 f1                	div    %ecx
+  80045d:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+	cprintf("netmulti: %u connections, %u bytes in %u ms, %u KB/s\n",
+  800463:	c1 e8 0a             	shr    $0xa,%eax
+  800466:	50                   	push   %eax
+  800467:	57                   	push   %edi
+  800468:	ff b5 10 ff ff ff    	push   -0xf0(%ebp)
+  80046e:	53                   	push   %ebx
+  80046f:	68 a0 4c 80 00       	push   $0x804ca0
+  800474:	e8 aa 01 00 00       	call   800623 <cprintf>
+	cprintf("netmulti: %u packets dropped\n",
+  800479:	83 c4 18             	add    $0x18,%esp
+  80047c:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+  800482:	03 45 88             	add    -0x78(%ebp),%eax
+  800485:	2b 45 e4             	sub    -0x1c(%ebp),%eax
+  800488:	2b 45 a4             	sub    -0x5c(%ebp),%eax
+  80048b:	50                   	push   %eax
+  80048c:	68 d7 4b 80 00       	push   $0x804bd7
+  800491:	e8 8d 01 00 00       	call   800623 <cprintf>
+		(ns1.ns_rxq_drops - ns0.ns_rxq_drops)
+		+ (ns1.ns_rx_missed - ns0.ns_rx_missed));
+}
+  800496:	83 c4 10             	add    $0x10,%esp
+  800499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049c:	5b                   	pop    %ebx
+  80049d:	5e                   	pop    %esi
+  80049e:	5f                   	pop    %edi
+  80049f:	5d                   	pop    %ebp
+  8004a0:	c3                   	ret
+
+008004a1 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004a1:	55                   	push   %ebp
+  8004a2:	89 e5                	mov    %esp,%ebp
+  8004a4:	56                   	push   %esi
+  8004a5:	53                   	push   %ebx
+  8004a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8004ac:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8004ae:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8004b3:	29 d0                	sub    %edx,%eax
+  8004b5:	89 c2                	mov    %eax,%edx
+  8004b7:	c1 ea 0f             	shr    $0xf,%edx
+  8004ba:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8004bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c4:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8004c7:	c7 04 85 20 82 80 00 	movl   $0x0,0x808220(,%eax,4)
+  8004ce:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8004d2:	e8 39 0c 00 00       	call   801110 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8004d7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004dc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8004e2:	89 e1                	mov    %esp,%ecx
+  8004e4:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8004e9:	29 ca                	sub    %ecx,%edx
+  8004eb:	89 d1                	mov    %edx,%ecx
+  8004ed:	c1 e9 0f             	shr    $0xf,%ecx
+  8004f0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8004f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fb:	0f 42 d1             	cmovb  %ecx,%edx
+  8004fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800503:	89 04 95 20 82 80 00 	mov    %eax,0x808220(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80050a:	85 db                	test   %ebx,%ebx
+  80050c:	7e 07                	jle    800515 <libmain+0x74>
+		binaryname = argv[0];
+  80050e:	8b 06                	mov    (%esi),%eax
+  800510:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	56                   	push   %esi
+  800519:	53                   	push   %ebx
+  80051a:	e8 31 fb ff ff       	call   800050 <umain>
+
+	// exit gracefully
+	exit();
+  80051f:	e8 0a 00 00 00       	call   80052e <exit>
+}
+  800524:	83 c4 10             	add    $0x10,%esp
+  800527:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80052a:	5b                   	pop    %ebx
+  80052b:	5e                   	pop    %esi
+  80052c:	5d                   	pop    %ebp
+  80052d:	c3                   	ret
+
+0080052e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800534:	e8 dd 19 00 00       	call   801f16 <close_all>
+	sys_env_destroy(0);
+  800539:	83 ec 0c             	sub    $0xc,%esp
+  80053c:	6a 00                	push   $0x0
+  80053e:	e8 8c 0b 00 00       	call   8010cf <sys_env_destroy>
+}
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	c9                   	leave
+  800547:	c3                   	ret
+
+00800548 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800548:	55                   	push   %ebp
+  800549:	89 e5                	mov    %esp,%ebp
+  80054b:	56                   	push   %esi
+  80054c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80054d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800550:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800556:	e8 b5 0b 00 00       	call   801110 <sys_getenvid>
+  80055b:	83 ec 0c             	sub    $0xc,%esp
+  80055e:	ff 75 0c             	push   0xc(%ebp)
+  800561:	ff 75 08             	push   0x8(%ebp)
+  800564:	56                   	push   %esi
+  800565:	50                   	push   %eax
+  800566:	68 e0 4c 80 00       	push   $0x804ce0
+  80056b:	e8 b3 00 00 00       	call   800623 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800570:	83 c4 18             	add    $0x18,%esp
+  800573:	53                   	push   %ebx
+  800574:	ff 75 10             	push   0x10(%ebp)
+  800577:	e8 56 00 00 00       	call   8005d2 <vcprintf>
+	cprintf("\n");
+  80057c:	c7 04 24 54 52 80 00 	movl   $0x805254,(%esp)
+  800583:	e8 9b 00 00 00       	call   800623 <cprintf>
+  800588:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80058b:	cc                   	int3
+	while (1)
+  80058c:	eb fd                	jmp    80058b <_panic+0x43>
+
+0080058e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80058e:	55                   	push   %ebp
+  80058f:	89 e5                	mov    %esp,%ebp
+  800591:	53                   	push   %ebx
+  800592:	83 ec 04             	sub    $0x4,%esp
+  800595:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800598:	8b 13                	mov    (%ebx),%edx
+  80059a:	8d 42 01             	lea    0x1(%edx),%eax
+  80059d:	89 03                	mov    %eax,(%ebx)
+  80059f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005a2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8005a6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005ab:	74 09                	je     8005b6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8005ad:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8005b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005b4:	c9                   	leave
+  8005b5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8005b6:	83 ec 08             	sub    $0x8,%esp
+  8005b9:	68 ff 00 00 00       	push   $0xff
+  8005be:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005c1:	50                   	push   %eax
+  8005c2:	e8 cb 0a 00 00       	call   801092 <sys_cputs>
+		b->idx = 0;
+  8005c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005cd:	83 c4 10             	add    $0x10,%esp
+  8005d0:	eb db                	jmp    8005ad <putch+0x1f>
+
+008005d2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005d2:	55                   	push   %ebp
+  8005d3:	89 e5                	mov    %esp,%ebp
+  8005d5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005db:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005e2:	00 00 00 
+	b.cnt = 0;
+  8005e5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005ec:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005ef:	ff 75 0c             	push   0xc(%ebp)
+  8005f2:	ff 75 08             	push   0x8(%ebp)
+  8005f5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005fb:	50                   	push   %eax
+  8005fc:	68 8e 05 80 00       	push   $0x80058e
+  800601:	e8 1c 01 00 00       	call   800722 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800606:	83 c4 08             	add    $0x8,%esp
+  800609:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80060f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800615:	50                   	push   %eax
+  800616:	e8 77 0a 00 00       	call   801092 <sys_cputs>
+
+	return b.cnt;
+}
+  80061b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800621:	c9                   	leave
+  800622:	c3                   	ret
+
+00800623 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800623:	55                   	push   %ebp
+  800624:	89 e5                	mov    %esp,%ebp
+  800626:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800629:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80062c:	50                   	push   %eax
+  80062d:	ff 75 08             	push   0x8(%ebp)
+  800630:	e8 9d ff ff ff       	call   8005d2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800635:	c9                   	leave
+  800636:	c3                   	ret
+
+00800637 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800637:	55                   	push   %ebp
+  800638:	89 e5                	mov    %esp,%ebp
+  80063a:	57                   	push   %edi
+  80063b:	56                   	push   %esi
+  80063c:	53                   	push   %ebx
+  80063d:	83 ec 1c             	sub    $0x1c,%esp
+  800640:	89 c3                	mov    %eax,%ebx
+  800642:	89 d6                	mov    %edx,%esi
+  800644:	8b 45 08             	mov    0x8(%ebp),%eax
+  800647:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80064a:	89 d1                	mov    %edx,%ecx
+  80064c:	89 c2                	mov    %eax,%edx
+  80064e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800651:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800654:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800657:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80065a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800661:	39 c2                	cmp    %eax,%edx
+  800663:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800666:	73 4b                	jae    8006b3 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800668:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80066e:	85 ff                	test   %edi,%edi
+  800670:	7e 11                	jle    800683 <printnum+0x4c>
+			putch(padc, putdat);
+  800672:	83 ec 08             	sub    $0x8,%esp
+  800675:	56                   	push   %esi
+  800676:	ff 75 18             	push   0x18(%ebp)
+  800679:	ff d3                	call   *%ebx
+		while (--width > 0)
+  80067b:	83 c4 10             	add    $0x10,%esp
+  80067e:	83 ef 01             	sub    $0x1,%edi
+  800681:	75 ef                	jne    800672 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800683:	83 ec 08             	sub    $0x8,%esp
+  800686:	56                   	push   %esi
+  800687:	83 ec 04             	sub    $0x4,%esp
+  80068a:	ff 75 e4             	push   -0x1c(%ebp)
+  80068d:	ff 75 e0             	push   -0x20(%ebp)
+  800690:	ff 75 dc             	push   -0x24(%ebp)
+  800693:	ff 75 d8             	push   -0x28(%ebp)
+  800696:	e8 b2 43 00 00       	call   804a4d <__umoddi3>
+  80069b:	83 c4 14             	add    $0x14,%esp
+  80069e:	0f be 80 03 4d 80 00 	movsbl 0x804d03(%eax),%eax
+  8006a5:	50                   	push   %eax
+  8006a6:	ff d3                	call   *%ebx
+}
+  8006a8:	83 c4 10             	add    $0x10,%esp
+  8006ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ae:	5b                   	pop    %ebx
+  8006af:	5e                   	pop    %esi
+  8006b0:	5f                   	pop    %edi
+  8006b1:	5d                   	pop    %ebp
+  8006b2:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006b3:	83 ec 0c             	sub    $0xc,%esp
+  8006b6:	ff 75 18             	push   0x18(%ebp)
+  8006b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006bc:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8006bf:	52                   	push   %edx
+  8006c0:	50                   	push   %eax
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+  8006c4:	ff 75 e4             	push   -0x1c(%ebp)
+  8006c7:	ff 75 e0             	push   -0x20(%ebp)
+  8006ca:	ff 75 dc             	push   -0x24(%ebp)
+  8006cd:	ff 75 d8             	push   -0x28(%ebp)
+  8006d0:	e8 b2 42 00 00       	call   804987 <__udivdi3>
+  8006d5:	83 c4 18             	add    $0x18,%esp
+  8006d8:	52                   	push   %edx
+  8006d9:	50                   	push   %eax
+  8006da:	89 f2                	mov    %esi,%edx
+  8006dc:	89 d8                	mov    %ebx,%eax
+  8006de:	e8 54 ff ff ff       	call   800637 <printnum>
+  8006e3:	83 c4 20             	add    $0x20,%esp
+  8006e6:	eb 9b                	jmp    800683 <printnum+0x4c>
+
+008006e8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006e8:	55                   	push   %ebp
+  8006e9:	89 e5                	mov    %esp,%ebp
+  8006eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006ee:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006f7:	73 0a                	jae    800703 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006f9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006fc:	89 08                	mov    %ecx,(%eax)
+  8006fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800701:	88 02                	mov    %al,(%edx)
+}
+  800703:	5d                   	pop    %ebp
+  800704:	c3                   	ret
+
+00800705 <printfmt>:
+{
+  800705:	55                   	push   %ebp
+  800706:	89 e5                	mov    %esp,%ebp
+  800708:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80070b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80070e:	50                   	push   %eax
+  80070f:	ff 75 10             	push   0x10(%ebp)
+  800712:	ff 75 0c             	push   0xc(%ebp)
+  800715:	ff 75 08             	push   0x8(%ebp)
+  800718:	e8 05 00 00 00       	call   800722 <vprintfmt>
+}
+  80071d:	83 c4 10             	add    $0x10,%esp
+  800720:	c9                   	leave
+  800721:	c3                   	ret
+
+00800722 <vprintfmt>:
+{
+  800722:	55                   	push   %ebp
+  800723:	89 e5                	mov    %esp,%ebp
+  800725:	57                   	push   %edi
+  800726:	56                   	push   %esi
+  800727:	53                   	push   %ebx
+  800728:	83 ec 2c             	sub    $0x2c,%esp
+  80072b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80072e:	89 df                	mov    %ebx,%edi
+  800730:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800733:	8b 45 10             	mov    0x10(%ebp),%eax
+  800736:	8d 70 01             	lea    0x1(%eax),%esi
+  800739:	0f b6 00             	movzbl (%eax),%eax
+  80073c:	83 f8 25             	cmp    $0x25,%eax
+  80073f:	74 1e                	je     80075f <vprintfmt+0x3d>
+			if (ch == '\0')
+  800741:	85 c0                	test   %eax,%eax
+  800743:	0f 84 15 05 00 00    	je     800c5e <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	50                   	push   %eax
+  80074e:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800750:	83 c6 01             	add    $0x1,%esi
+  800753:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800757:	83 c4 10             	add    $0x10,%esp
+  80075a:	83 f8 25             	cmp    $0x25,%eax
+  80075d:	75 e2                	jne    800741 <vprintfmt+0x1f>
+		padc = ' ';
+  80075f:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800763:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80076a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800771:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800778:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800780:	8d 56 01             	lea    0x1(%esi),%edx
+  800783:	0f b6 0e             	movzbl (%esi),%ecx
+  800786:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800789:	3c 55                	cmp    $0x55,%al
+  80078b:	0f 87 3b 04 00 00    	ja     800bcc <vprintfmt+0x4aa>
+  800791:	0f b6 c0             	movzbl %al,%eax
+  800794:	ff 24 85 80 4e 80 00 	jmp    *0x804e80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80079b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80079e:	eb 93                	jmp    800733 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a0:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8007a2:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8007a6:	eb d8                	jmp    800780 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a8:	89 d6                	mov    %edx,%esi
+  8007aa:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8007ae:	eb d0                	jmp    800780 <vprintfmt+0x5e>
+  8007b0:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8007b3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8007b6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8007b9:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8007bd:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8007c0:	83 f9 09             	cmp    $0x9,%ecx
+  8007c3:	77 6f                	ja     800834 <vprintfmt+0x112>
+  8007c5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8007c8:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8007cb:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8007ce:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8007d2:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8007d5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8007d8:	83 fe 09             	cmp    $0x9,%esi
+  8007db:	76 eb                	jbe    8007c8 <vprintfmt+0xa6>
+  8007dd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8007e0:	89 d6                	mov    %edx,%esi
+  8007e2:	eb 13                	jmp    8007f7 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8b 00                	mov    (%eax),%eax
+  8007e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007f5:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8007f7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007fb:	79 83                	jns    800780 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8007fd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800800:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800803:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80080a:	e9 71 ff ff ff       	jmp    800780 <vprintfmt+0x5e>
+			if (width < 0)
+  80080f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800812:	85 c9                	test   %ecx,%ecx
+  800814:	b8 00 00 00 00       	mov    $0x0,%eax
+  800819:	0f 49 c1             	cmovns %ecx,%eax
+  80081c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80081f:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800821:	e9 5a ff ff ff       	jmp    800780 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800826:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800828:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80082f:	e9 4c ff ff ff       	jmp    800780 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800834:	89 d6                	mov    %edx,%esi
+  800836:	eb bf                	jmp    8007f7 <vprintfmt+0xd5>
+			lflag++;
+  800838:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80083c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80083e:	e9 3d ff ff ff       	jmp    800780 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800843:	89 55 10             	mov    %edx,0x10(%ebp)
+  800846:	8b 45 14             	mov    0x14(%ebp),%eax
+  800849:	8d 70 04             	lea    0x4(%eax),%esi
+  80084c:	83 ec 08             	sub    $0x8,%esp
+  80084f:	53                   	push   %ebx
+  800850:	ff 30                	push   (%eax)
+  800852:	ff d7                	call   *%edi
+			break;
+  800854:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800857:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80085a:	e9 d4 fe ff ff       	jmp    800733 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80085f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800862:	8b 45 14             	mov    0x14(%ebp),%eax
+  800865:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800868:	8b 10                	mov    (%eax),%edx
+  80086a:	89 d0                	mov    %edx,%eax
+  80086c:	f7 d8                	neg    %eax
+  80086e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800871:	83 f8 12             	cmp    $0x12,%eax
+  800874:	7f 23                	jg     800899 <vprintfmt+0x177>
+  800876:	8b 14 85 e0 4f 80 00 	mov    0x804fe0(,%eax,4),%edx
+  80087d:	85 d2                	test   %edx,%edx
+  80087f:	74 18                	je     800899 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800881:	52                   	push   %edx
+  800882:	68 1f 52 80 00       	push   $0x80521f
+  800887:	53                   	push   %ebx
+  800888:	57                   	push   %edi
+  800889:	e8 77 fe ff ff       	call   800705 <printfmt>
+  80088e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800891:	89 75 14             	mov    %esi,0x14(%ebp)
+  800894:	e9 9a fe ff ff       	jmp    800733 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800899:	50                   	push   %eax
+  80089a:	68 1b 4d 80 00       	push   $0x804d1b
+  80089f:	53                   	push   %ebx
+  8008a0:	57                   	push   %edi
+  8008a1:	e8 5f fe ff ff       	call   800705 <printfmt>
+  8008a6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008a9:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8008ac:	e9 82 fe ff ff       	jmp    800733 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008b1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b7:	83 c0 04             	add    $0x4,%eax
+  8008ba:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c0:	8b 00                	mov    (%eax),%eax
+  8008c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008c5:	85 c0                	test   %eax,%eax
+  8008c7:	0f 84 61 03 00 00    	je     800c2e <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8008cd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008d1:	7e 06                	jle    8008d9 <vprintfmt+0x1b7>
+  8008d3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008d7:	75 29                	jne    800902 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008dc:	8d 70 01             	lea    0x1(%eax),%esi
+  8008df:	0f b6 00             	movzbl (%eax),%eax
+  8008e2:	0f be d0             	movsbl %al,%edx
+  8008e5:	85 d2                	test   %edx,%edx
+  8008e7:	0f 84 bb 00 00 00    	je     8009a8 <vprintfmt+0x286>
+  8008ed:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008f0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008f3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008f6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008f9:	eb 7a                	jmp    800975 <vprintfmt+0x253>
+				p = "(null)";
+  8008fb:	c7 45 d0 14 4d 80 00 	movl   $0x804d14,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800902:	83 ec 08             	sub    $0x8,%esp
+  800905:	ff 75 d4             	push   -0x2c(%ebp)
+  800908:	ff 75 d0             	push   -0x30(%ebp)
+  80090b:	e8 e0 03 00 00       	call   800cf0 <strnlen>
+  800910:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800913:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800916:	83 c4 10             	add    $0x10,%esp
+  800919:	85 d2                	test   %edx,%edx
+  80091b:	0f 8e d6 02 00 00    	jle    800bf7 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800921:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800925:	83 ec 08             	sub    $0x8,%esp
+  800928:	53                   	push   %ebx
+  800929:	56                   	push   %esi
+  80092a:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80092c:	83 c4 10             	add    $0x10,%esp
+  80092f:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800933:	75 f0                	jne    800925 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800935:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800938:	8d 70 01             	lea    0x1(%eax),%esi
+  80093b:	0f b6 00             	movzbl (%eax),%eax
+  80093e:	0f be d0             	movsbl %al,%edx
+  800941:	85 d2                	test   %edx,%edx
+  800943:	0f 84 da 02 00 00    	je     800c23 <vprintfmt+0x501>
+  800949:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80094c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80094f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800952:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800955:	eb 1e                	jmp    800975 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800957:	83 ec 08             	sub    $0x8,%esp
+  80095a:	ff 75 0c             	push   0xc(%ebp)
+  80095d:	52                   	push   %edx
+  80095e:	ff 55 08             	call   *0x8(%ebp)
+  800961:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800964:	83 eb 01             	sub    $0x1,%ebx
+  800967:	83 c6 01             	add    $0x1,%esi
+  80096a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80096e:	0f be d0             	movsbl %al,%edx
+  800971:	85 d2                	test   %edx,%edx
+  800973:	74 2a                	je     80099f <vprintfmt+0x27d>
+  800975:	85 ff                	test   %edi,%edi
+  800977:	78 05                	js     80097e <vprintfmt+0x25c>
+  800979:	83 ef 01             	sub    $0x1,%edi
+  80097c:	78 59                	js     8009d7 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80097e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800982:	74 d3                	je     800957 <vprintfmt+0x235>
+  800984:	0f be c0             	movsbl %al,%eax
+  800987:	83 e8 20             	sub    $0x20,%eax
+  80098a:	83 f8 5e             	cmp    $0x5e,%eax
+  80098d:	76 c8                	jbe    800957 <vprintfmt+0x235>
+					putch('?', putdat);
+  80098f:	83 ec 08             	sub    $0x8,%esp
+  800992:	ff 75 0c             	push   0xc(%ebp)
+  800995:	6a 3f                	push   $0x3f
+  800997:	ff 55 08             	call   *0x8(%ebp)
+  80099a:	83 c4 10             	add    $0x10,%esp
+  80099d:	eb c5                	jmp    800964 <vprintfmt+0x242>
+  80099f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8009a8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8009ab:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009af:	7e 1b                	jle    8009cc <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8009b1:	83 ec 08             	sub    $0x8,%esp
+  8009b4:	53                   	push   %ebx
+  8009b5:	6a 20                	push   $0x20
+  8009b7:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8009b9:	83 c4 10             	add    $0x10,%esp
+  8009bc:	83 ee 01             	sub    $0x1,%esi
+  8009bf:	75 f0                	jne    8009b1 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009c7:	e9 67 fd ff ff       	jmp    800733 <vprintfmt+0x11>
+  8009cc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d2:	e9 5c fd ff ff       	jmp    800733 <vprintfmt+0x11>
+  8009d7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009e0:	eb c6                	jmp    8009a8 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8009e2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009e8:	83 f9 01             	cmp    $0x1,%ecx
+  8009eb:	7f 1f                	jg     800a0c <vprintfmt+0x2ea>
+	else if (lflag)
+  8009ed:	85 c9                	test   %ecx,%ecx
+  8009ef:	74 67                	je     800a58 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8009f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f4:	8b 30                	mov    (%eax),%esi
+  8009f6:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8009f9:	89 f0                	mov    %esi,%eax
+  8009fb:	c1 f8 1f             	sar    $0x1f,%eax
+  8009fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a04:	8d 40 04             	lea    0x4(%eax),%eax
+  800a07:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a0a:	eb 17                	jmp    800a23 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800a0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0f:	8b 50 04             	mov    0x4(%eax),%edx
+  800a12:	8b 00                	mov    (%eax),%eax
+  800a14:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a17:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1d:	8d 40 08             	lea    0x8(%eax),%eax
+  800a20:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a23:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a26:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800a29:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800a2e:	85 c9                	test   %ecx,%ecx
+  800a30:	0f 89 12 01 00 00    	jns    800b48 <vprintfmt+0x426>
+				putch('-', putdat);
+  800a36:	83 ec 08             	sub    $0x8,%esp
+  800a39:	53                   	push   %ebx
+  800a3a:	6a 2d                	push   $0x2d
+  800a3c:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a3e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a41:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a44:	f7 da                	neg    %edx
+  800a46:	83 d1 00             	adc    $0x0,%ecx
+  800a49:	f7 d9                	neg    %ecx
+  800a4b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a4e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a53:	e9 f0 00 00 00       	jmp    800b48 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800a58:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5b:	8b 30                	mov    (%eax),%esi
+  800a5d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a60:	89 f0                	mov    %esi,%eax
+  800a62:	c1 f8 1f             	sar    $0x1f,%eax
+  800a65:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a68:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a71:	eb b0                	jmp    800a23 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800a73:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a76:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a79:	83 f9 01             	cmp    $0x1,%ecx
+  800a7c:	7f 1e                	jg     800a9c <vprintfmt+0x37a>
+	else if (lflag)
+  800a7e:	85 c9                	test   %ecx,%ecx
+  800a80:	74 32                	je     800ab4 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800a82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a85:	8b 10                	mov    (%eax),%edx
+  800a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a92:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800a97:	e9 ac 00 00 00       	jmp    800b48 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9f:	8b 10                	mov    (%eax),%edx
+  800aa1:	8b 48 04             	mov    0x4(%eax),%ecx
+  800aa4:	8d 40 08             	lea    0x8(%eax),%eax
+  800aa7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800aaa:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800aaf:	e9 94 00 00 00       	jmp    800b48 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800ab4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab7:	8b 10                	mov    (%eax),%edx
+  800ab9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abe:	8d 40 04             	lea    0x4(%eax),%eax
+  800ac1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ac4:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800ac9:	eb 7d                	jmp    800b48 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800acb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ace:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ad1:	83 f9 01             	cmp    $0x1,%ecx
+  800ad4:	7f 1b                	jg     800af1 <vprintfmt+0x3cf>
+	else if (lflag)
+  800ad6:	85 c9                	test   %ecx,%ecx
+  800ad8:	74 2c                	je     800b06 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800ada:	8b 45 14             	mov    0x14(%ebp),%eax
+  800add:	8b 10                	mov    (%eax),%edx
+  800adf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae4:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800aea:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800aef:	eb 57                	jmp    800b48 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 10                	mov    (%eax),%edx
+  800af6:	8b 48 04             	mov    0x4(%eax),%ecx
+  800af9:	8d 40 08             	lea    0x8(%eax),%eax
+  800afc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800aff:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800b04:	eb 42                	jmp    800b48 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b09:	8b 10                	mov    (%eax),%edx
+  800b0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b10:	8d 40 04             	lea    0x4(%eax),%eax
+  800b13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b16:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800b1b:	eb 2b                	jmp    800b48 <vprintfmt+0x426>
+			putch('0', putdat);
+  800b1d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b20:	83 ec 08             	sub    $0x8,%esp
+  800b23:	53                   	push   %ebx
+  800b24:	6a 30                	push   $0x30
+  800b26:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800b28:	83 c4 08             	add    $0x8,%esp
+  800b2b:	53                   	push   %ebx
+  800b2c:	6a 78                	push   $0x78
+  800b2e:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b33:	8b 10                	mov    (%eax),%edx
+  800b35:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b3a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b43:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800b48:	83 ec 0c             	sub    $0xc,%esp
+  800b4b:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800b4f:	50                   	push   %eax
+  800b50:	ff 75 e4             	push   -0x1c(%ebp)
+  800b53:	56                   	push   %esi
+  800b54:	51                   	push   %ecx
+  800b55:	52                   	push   %edx
+  800b56:	89 da                	mov    %ebx,%edx
+  800b58:	89 f8                	mov    %edi,%eax
+  800b5a:	e8 d8 fa ff ff       	call   800637 <printnum>
+			break;
+  800b5f:	83 c4 20             	add    $0x20,%esp
+  800b62:	e9 cc fb ff ff       	jmp    800733 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800b67:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b6a:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b6d:	83 f9 01             	cmp    $0x1,%ecx
+  800b70:	7f 1b                	jg     800b8d <vprintfmt+0x46b>
+	else if (lflag)
+  800b72:	85 c9                	test   %ecx,%ecx
+  800b74:	74 2c                	je     800ba2 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800b76:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b79:	8b 10                	mov    (%eax),%edx
+  800b7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b80:	8d 40 04             	lea    0x4(%eax),%eax
+  800b83:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b86:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800b8b:	eb bb                	jmp    800b48 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b90:	8b 10                	mov    (%eax),%edx
+  800b92:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b95:	8d 40 08             	lea    0x8(%eax),%eax
+  800b98:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b9b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800ba0:	eb a6                	jmp    800b48 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800ba2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba5:	8b 10                	mov    (%eax),%edx
+  800ba7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bac:	8d 40 04             	lea    0x4(%eax),%eax
+  800baf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bb2:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800bb7:	eb 8f                	jmp    800b48 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800bb9:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bbc:	83 ec 08             	sub    $0x8,%esp
+  800bbf:	53                   	push   %ebx
+  800bc0:	6a 25                	push   $0x25
+  800bc2:	ff d7                	call   *%edi
+			break;
+  800bc4:	83 c4 10             	add    $0x10,%esp
+  800bc7:	e9 67 fb ff ff       	jmp    800733 <vprintfmt+0x11>
+			putch('%', putdat);
+  800bcc:	83 ec 08             	sub    $0x8,%esp
+  800bcf:	53                   	push   %ebx
+  800bd0:	6a 25                	push   $0x25
+  800bd2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bd4:	83 c4 10             	add    $0x10,%esp
+  800bd7:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800bdb:	0f 84 ba fb ff ff    	je     80079b <vprintfmt+0x79>
+  800be1:	89 75 10             	mov    %esi,0x10(%ebp)
+  800be4:	89 f0                	mov    %esi,%eax
+  800be6:	83 e8 01             	sub    $0x1,%eax
+  800be9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800bed:	75 f7                	jne    800be6 <vprintfmt+0x4c4>
+  800bef:	89 45 10             	mov    %eax,0x10(%ebp)
+  800bf2:	e9 3c fb ff ff       	jmp    800733 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bf7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800bfa:	8d 70 01             	lea    0x1(%eax),%esi
+  800bfd:	0f b6 00             	movzbl (%eax),%eax
+  800c00:	0f be d0             	movsbl %al,%edx
+  800c03:	85 d2                	test   %edx,%edx
+  800c05:	74 11                	je     800c18 <vprintfmt+0x4f6>
+  800c07:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c0a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c0d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c10:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c13:	e9 5d fd ff ff       	jmp    800975 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c18:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c1b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c1e:	e9 10 fb ff ff       	jmp    800733 <vprintfmt+0x11>
+  800c23:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c26:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c29:	e9 05 fb ff ff       	jmp    800733 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800c2e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c32:	7e 0a                	jle    800c3e <vprintfmt+0x51c>
+  800c34:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800c38:	0f 85 bd fc ff ff    	jne    8008fb <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c3e:	ba 28 00 00 00       	mov    $0x28,%edx
+  800c43:	b8 28 00 00 00       	mov    $0x28,%eax
+  800c48:	be 15 4d 80 00       	mov    $0x804d15,%esi
+  800c4d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c50:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c53:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c56:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c59:	e9 17 fd ff ff       	jmp    800975 <vprintfmt+0x253>
+}
+  800c5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c61:	5b                   	pop    %ebx
+  800c62:	5e                   	pop    %esi
+  800c63:	5f                   	pop    %edi
+  800c64:	5d                   	pop    %ebp
+  800c65:	c3                   	ret
+
+00800c66 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	83 ec 18             	sub    $0x18,%esp
+  800c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c72:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c75:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c79:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c7c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c83:	85 c0                	test   %eax,%eax
+  800c85:	74 26                	je     800cad <vsnprintf+0x47>
+  800c87:	85 d2                	test   %edx,%edx
+  800c89:	7e 22                	jle    800cad <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c8b:	ff 75 14             	push   0x14(%ebp)
+  800c8e:	ff 75 10             	push   0x10(%ebp)
+  800c91:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c94:	50                   	push   %eax
+  800c95:	68 e8 06 80 00       	push   $0x8006e8
+  800c9a:	e8 83 fa ff ff       	call   800722 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c9f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ca2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ca5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ca8:	83 c4 10             	add    $0x10,%esp
+}
+  800cab:	c9                   	leave
+  800cac:	c3                   	ret
+		return -E_INVAL;
+  800cad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb2:	eb f7                	jmp    800cab <vsnprintf+0x45>
+
+00800cb4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cba:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cbd:	50                   	push   %eax
+  800cbe:	ff 75 10             	push   0x10(%ebp)
+  800cc1:	ff 75 0c             	push   0xc(%ebp)
+  800cc4:	ff 75 08             	push   0x8(%ebp)
+  800cc7:	e8 9a ff ff ff       	call   800c66 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ccc:	c9                   	leave
+  800ccd:	c3                   	ret
+
+00800cce <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800cce:	55                   	push   %ebp
+  800ccf:	89 e5                	mov    %esp,%ebp
+  800cd1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800cd4:	80 3a 00             	cmpb   $0x0,(%edx)
+  800cd7:	74 10                	je     800ce9 <strlen+0x1b>
+  800cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800cde:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ce1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ce5:	75 f7                	jne    800cde <strlen+0x10>
+	return n;
+}
+  800ce7:	5d                   	pop    %ebp
+  800ce8:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800cee:	eb f7                	jmp    800ce7 <strlen+0x19>
+
+00800cf0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf9:	85 d2                	test   %edx,%edx
+  800cfb:	74 16                	je     800d13 <strnlen+0x23>
+  800cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d02:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d06:	74 09                	je     800d11 <strnlen+0x21>
+		n++;
+  800d08:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d0b:	39 d0                	cmp    %edx,%eax
+  800d0d:	75 f3                	jne    800d02 <strnlen+0x12>
+		n++;
+  800d0f:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800d11:	5d                   	pop    %ebp
+  800d12:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	eb f7                	jmp    800d11 <strnlen+0x21>
+
+00800d1a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	53                   	push   %ebx
+  800d1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d29:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d2d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d30:	83 c0 01             	add    $0x1,%eax
+  800d33:	84 d2                	test   %dl,%dl
+  800d35:	75 f2                	jne    800d29 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d37:	89 c8                	mov    %ecx,%eax
+  800d39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3c:	c9                   	leave
+  800d3d:	c3                   	ret
+
+00800d3e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	53                   	push   %ebx
+  800d42:	83 ec 10             	sub    $0x10,%esp
+  800d45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d48:	53                   	push   %ebx
+  800d49:	e8 80 ff ff ff       	call   800cce <strlen>
+  800d4e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d51:	ff 75 0c             	push   0xc(%ebp)
+  800d54:	01 d8                	add    %ebx,%eax
+  800d56:	50                   	push   %eax
+  800d57:	e8 be ff ff ff       	call   800d1a <strcpy>
+	return dst;
+}
+  800d5c:	89 d8                	mov    %ebx,%eax
+  800d5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d61:	c9                   	leave
+  800d62:	c3                   	ret
+
+00800d63 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	56                   	push   %esi
+  800d67:	53                   	push   %ebx
+  800d68:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d71:	85 db                	test   %ebx,%ebx
+  800d73:	74 17                	je     800d8c <strncpy+0x29>
+  800d75:	01 f3                	add    %esi,%ebx
+  800d77:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800d79:	83 c0 01             	add    $0x1,%eax
+  800d7c:	0f b6 0a             	movzbl (%edx),%ecx
+  800d7f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d82:	80 f9 01             	cmp    $0x1,%cl
+  800d85:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d88:	39 c3                	cmp    %eax,%ebx
+  800d8a:	75 ed                	jne    800d79 <strncpy+0x16>
+	}
+	return ret;
+}
+  800d8c:	89 f0                	mov    %esi,%eax
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+
+00800d92 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	56                   	push   %esi
+  800d96:	53                   	push   %ebx
+  800d97:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800da0:	89 f0                	mov    %esi,%eax
+  800da2:	85 db                	test   %ebx,%ebx
+  800da4:	74 1e                	je     800dc4 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800da6:	83 eb 01             	sub    $0x1,%ebx
+  800da9:	74 16                	je     800dc1 <strlcpy+0x2f>
+  800dab:	01 f3                	add    %esi,%ebx
+  800dad:	0f b6 0a             	movzbl (%edx),%ecx
+  800db0:	84 c9                	test   %cl,%cl
+  800db2:	74 0d                	je     800dc1 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800db4:	83 c2 01             	add    $0x1,%edx
+  800db7:	83 c0 01             	add    $0x1,%eax
+  800dba:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800dbd:	39 d8                	cmp    %ebx,%eax
+  800dbf:	75 ec                	jne    800dad <strlcpy+0x1b>
+		*dst = '\0';
+  800dc1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800dc4:	29 f0                	sub    %esi,%eax
+}
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+
+00800dca <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dd0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800dd3:	0f b6 01             	movzbl (%ecx),%eax
+  800dd6:	84 c0                	test   %al,%al
+  800dd8:	74 11                	je     800deb <strcmp+0x21>
+  800dda:	38 02                	cmp    %al,(%edx)
+  800ddc:	75 0d                	jne    800deb <strcmp+0x21>
+		p++, q++;
+  800dde:	83 c1 01             	add    $0x1,%ecx
+  800de1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800de4:	0f b6 01             	movzbl (%ecx),%eax
+  800de7:	84 c0                	test   %al,%al
+  800de9:	75 ef                	jne    800dda <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800deb:	0f b6 c0             	movzbl %al,%eax
+  800dee:	0f b6 12             	movzbl (%edx),%edx
+  800df1:	29 d0                	sub    %edx,%eax
+}
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+
+00800df5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800df5:	55                   	push   %ebp
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	53                   	push   %ebx
+  800df9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dfc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800dff:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800e02:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800e07:	85 d2                	test   %edx,%edx
+  800e09:	74 2e                	je     800e39 <strncmp+0x44>
+  800e0b:	0f b6 01             	movzbl (%ecx),%eax
+  800e0e:	84 c0                	test   %al,%al
+  800e10:	74 16                	je     800e28 <strncmp+0x33>
+  800e12:	3a 03                	cmp    (%ebx),%al
+  800e14:	75 12                	jne    800e28 <strncmp+0x33>
+		n--, p++, q++;
+  800e16:	83 c1 01             	add    $0x1,%ecx
+  800e19:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800e1c:	83 ea 01             	sub    $0x1,%edx
+  800e1f:	75 ea                	jne    800e0b <strncmp+0x16>
+		return 0;
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e26:	eb 11                	jmp    800e39 <strncmp+0x44>
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800e2d:	85 d2                	test   %edx,%edx
+  800e2f:	74 08                	je     800e39 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e31:	0f b6 01             	movzbl (%ecx),%eax
+  800e34:	0f b6 13             	movzbl (%ebx),%edx
+  800e37:	29 d0                	sub    %edx,%eax
+}
+  800e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e3c:	c9                   	leave
+  800e3d:	c3                   	ret
+
+00800e3e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e44:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e48:	0f b6 10             	movzbl (%eax),%edx
+  800e4b:	84 d2                	test   %dl,%dl
+  800e4d:	74 15                	je     800e64 <strchr+0x26>
+		if (*s == c)
+  800e4f:	38 d1                	cmp    %dl,%cl
+  800e51:	74 0f                	je     800e62 <strchr+0x24>
+	for (; *s; s++)
+  800e53:	83 c0 01             	add    $0x1,%eax
+  800e56:	0f b6 10             	movzbl (%eax),%edx
+  800e59:	84 d2                	test   %dl,%dl
+  800e5b:	75 f2                	jne    800e4f <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e62:	5d                   	pop    %ebp
+  800e63:	c3                   	ret
+	return 0;
+  800e64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e69:	eb f7                	jmp    800e62 <strchr+0x24>
+
+00800e6b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	53                   	push   %ebx
+  800e6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e72:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800e75:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800e78:	38 d3                	cmp    %dl,%bl
+  800e7a:	74 14                	je     800e90 <strfind+0x25>
+  800e7c:	89 d1                	mov    %edx,%ecx
+  800e7e:	84 db                	test   %bl,%bl
+  800e80:	74 0e                	je     800e90 <strfind+0x25>
+	for (; *s; s++)
+  800e82:	83 c0 01             	add    $0x1,%eax
+  800e85:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e88:	38 ca                	cmp    %cl,%dl
+  800e8a:	74 04                	je     800e90 <strfind+0x25>
+  800e8c:	84 d2                	test   %dl,%dl
+  800e8e:	75 f2                	jne    800e82 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800e90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e93:	c9                   	leave
+  800e94:	c3                   	ret
+
+00800e95 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	57                   	push   %edi
+  800e99:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e9c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e9f:	85 c9                	test   %ecx,%ecx
+  800ea1:	74 20                	je     800ec3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ea3:	89 f8                	mov    %edi,%eax
+  800ea5:	09 c8                	or     %ecx,%eax
+  800ea7:	a8 03                	test   $0x3,%al
+  800ea9:	75 12                	jne    800ebd <memset+0x28>
+		c &= 0xFF;
+  800eab:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800eaf:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800eb5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800eb8:	fc                   	cld
+  800eb9:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ebb:	eb 06                	jmp    800ec3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ebd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ec0:	fc                   	cld
+  800ec1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ec3:	89 f8                	mov    %edi,%eax
+  800ec5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ec8:	c9                   	leave
+  800ec9:	c3                   	ret
+
+00800eca <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ed5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ed8:	39 c6                	cmp    %eax,%esi
+  800eda:	73 32                	jae    800f0e <memmove+0x44>
+  800edc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800edf:	39 d0                	cmp    %edx,%eax
+  800ee1:	73 2b                	jae    800f0e <memmove+0x44>
+		s += n;
+		d += n;
+  800ee3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ee6:	89 d6                	mov    %edx,%esi
+  800ee8:	09 fe                	or     %edi,%esi
+  800eea:	09 ce                	or     %ecx,%esi
+  800eec:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ef2:	75 0e                	jne    800f02 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ef4:	83 ef 04             	sub    $0x4,%edi
+  800ef7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800efa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800efd:	fd                   	std
+  800efe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f00:	eb 09                	jmp    800f0b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f02:	83 ef 01             	sub    $0x1,%edi
+  800f05:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f08:	fd                   	std
+  800f09:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f0b:	fc                   	cld
+  800f0c:	eb 1a                	jmp    800f28 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f0e:	89 f2                	mov    %esi,%edx
+  800f10:	09 c2                	or     %eax,%edx
+  800f12:	09 ca                	or     %ecx,%edx
+  800f14:	f6 c2 03             	test   $0x3,%dl
+  800f17:	75 0a                	jne    800f23 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f19:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f1c:	89 c7                	mov    %eax,%edi
+  800f1e:	fc                   	cld
+  800f1f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f21:	eb 05                	jmp    800f28 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f23:	89 c7                	mov    %eax,%edi
+  800f25:	fc                   	cld
+  800f26:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f28:	5e                   	pop    %esi
+  800f29:	5f                   	pop    %edi
+  800f2a:	5d                   	pop    %ebp
+  800f2b:	c3                   	ret
+
+00800f2c <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f32:	ff 75 10             	push   0x10(%ebp)
+  800f35:	ff 75 0c             	push   0xc(%ebp)
+  800f38:	ff 75 08             	push   0x8(%ebp)
+  800f3b:	e8 8a ff ff ff       	call   800eca <memmove>
+}
+  800f40:	c9                   	leave
+  800f41:	c3                   	ret
+
+00800f42 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	56                   	push   %esi
+  800f46:	53                   	push   %ebx
+  800f47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f4d:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f50:	85 f6                	test   %esi,%esi
+  800f52:	74 29                	je     800f7d <memcmp+0x3b>
+  800f54:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800f56:	0f b6 08             	movzbl (%eax),%ecx
+  800f59:	0f b6 1a             	movzbl (%edx),%ebx
+  800f5c:	38 d9                	cmp    %bl,%cl
+  800f5e:	75 11                	jne    800f71 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f60:	83 c0 01             	add    $0x1,%eax
+  800f63:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f66:	39 c6                	cmp    %eax,%esi
+  800f68:	75 ec                	jne    800f56 <memcmp+0x14>
+	}
+
+	return 0;
+  800f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6f:	eb 08                	jmp    800f79 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800f71:	0f b6 c1             	movzbl %cl,%eax
+  800f74:	0f b6 db             	movzbl %bl,%ebx
+  800f77:	29 d8                	sub    %ebx,%eax
+}
+  800f79:	5b                   	pop    %ebx
+  800f7a:	5e                   	pop    %esi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+	return 0;
+  800f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f82:	eb f5                	jmp    800f79 <memcmp+0x37>
+
+00800f84 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f8d:	89 c2                	mov    %eax,%edx
+  800f8f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f92:	39 d0                	cmp    %edx,%eax
+  800f94:	73 0d                	jae    800fa3 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f96:	38 08                	cmp    %cl,(%eax)
+  800f98:	74 0d                	je     800fa7 <memfind+0x23>
+	for (; s < ends; s++)
+  800f9a:	83 c0 01             	add    $0x1,%eax
+  800f9d:	39 c2                	cmp    %eax,%edx
+  800f9f:	75 f5                	jne    800f96 <memfind+0x12>
+  800fa1:	eb 06                	jmp    800fa9 <memfind+0x25>
+  800fa3:	89 c2                	mov    %eax,%edx
+  800fa5:	eb 02                	jmp    800fa9 <memfind+0x25>
+  800fa7:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800fa9:	89 d0                	mov    %edx,%eax
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800fb9:	0f b6 02             	movzbl (%edx),%eax
+  800fbc:	3c 20                	cmp    $0x20,%al
+  800fbe:	74 04                	je     800fc4 <strtol+0x17>
+  800fc0:	3c 09                	cmp    $0x9,%al
+  800fc2:	75 0e                	jne    800fd2 <strtol+0x25>
+		s++;
+  800fc4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fc7:	0f b6 02             	movzbl (%edx),%eax
+  800fca:	3c 20                	cmp    $0x20,%al
+  800fcc:	74 f6                	je     800fc4 <strtol+0x17>
+  800fce:	3c 09                	cmp    $0x9,%al
+  800fd0:	74 f2                	je     800fc4 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fd2:	3c 2b                	cmp    $0x2b,%al
+  800fd4:	74 2a                	je     801000 <strtol+0x53>
+	int neg = 0;
+  800fd6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800fdb:	3c 2d                	cmp    $0x2d,%al
+  800fdd:	74 2b                	je     80100a <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fdf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800fe5:	75 0f                	jne    800ff6 <strtol+0x49>
+  800fe7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800fea:	74 28                	je     801014 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800fec:	85 db                	test   %ebx,%ebx
+  800fee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff3:	0f 44 d8             	cmove  %eax,%ebx
+  800ff6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ffb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ffe:	eb 46                	jmp    801046 <strtol+0x99>
+		s++;
+  801000:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801003:	bf 00 00 00 00       	mov    $0x0,%edi
+  801008:	eb d5                	jmp    800fdf <strtol+0x32>
+		s++, neg = 1;
+  80100a:	83 c2 01             	add    $0x1,%edx
+  80100d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801012:	eb cb                	jmp    800fdf <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801014:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801018:	74 0e                	je     801028 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  80101a:	85 db                	test   %ebx,%ebx
+  80101c:	75 d8                	jne    800ff6 <strtol+0x49>
+		s++, base = 8;
+  80101e:	83 c2 01             	add    $0x1,%edx
+  801021:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801026:	eb ce                	jmp    800ff6 <strtol+0x49>
+		s += 2, base = 16;
+  801028:	83 c2 02             	add    $0x2,%edx
+  80102b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801030:	eb c4                	jmp    800ff6 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801032:	0f be c0             	movsbl %al,%eax
+  801035:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801038:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80103b:	7d 3a                	jge    801077 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  80103d:	83 c2 01             	add    $0x1,%edx
+  801040:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801044:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801046:	0f b6 02             	movzbl (%edx),%eax
+  801049:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80104c:	89 f3                	mov    %esi,%ebx
+  80104e:	80 fb 09             	cmp    $0x9,%bl
+  801051:	76 df                	jbe    801032 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  801053:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801056:	89 f3                	mov    %esi,%ebx
+  801058:	80 fb 19             	cmp    $0x19,%bl
+  80105b:	77 08                	ja     801065 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  80105d:	0f be c0             	movsbl %al,%eax
+  801060:	83 e8 57             	sub    $0x57,%eax
+  801063:	eb d3                	jmp    801038 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  801065:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801068:	89 f3                	mov    %esi,%ebx
+  80106a:	80 fb 19             	cmp    $0x19,%bl
+  80106d:	77 08                	ja     801077 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  80106f:	0f be c0             	movsbl %al,%eax
+  801072:	83 e8 37             	sub    $0x37,%eax
+  801075:	eb c1                	jmp    801038 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801077:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80107b:	74 05                	je     801082 <strtol+0xd5>
+		*endptr = (char *) s;
+  80107d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801080:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801082:	89 c8                	mov    %ecx,%eax
+  801084:	f7 d8                	neg    %eax
+  801086:	85 ff                	test   %edi,%edi
+  801088:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80108b:	89 c8                	mov    %ecx,%eax
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+
+00801092 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	57                   	push   %edi
+  801096:	56                   	push   %esi
+  801097:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a3:	89 c3                	mov    %eax,%ebx
+  8010a5:	89 c7                	mov    %eax,%edi
+  8010a7:	89 c6                	mov    %eax,%esi
+  8010a9:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5e                   	pop    %esi
+  8010ad:	5f                   	pop    %edi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+
+008010b0 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	57                   	push   %edi
+  8010b4:	56                   	push   %esi
+  8010b5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c0:	89 d1                	mov    %edx,%ecx
+  8010c2:	89 d3                	mov    %edx,%ebx
+  8010c4:	89 d7                	mov    %edx,%edi
+  8010c6:	89 d6                	mov    %edx,%esi
+  8010c8:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5e                   	pop    %esi
+  8010cc:	5f                   	pop    %edi
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	c3                   	ret
+
+008010cf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8010cf:	55                   	push   %ebp
+  8010d0:	89 e5                	mov    %esp,%ebp
+  8010d2:	57                   	push   %edi
+  8010d3:	56                   	push   %esi
+  8010d4:	53                   	push   %ebx
+  8010d5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010e5:	89 cb                	mov    %ecx,%ebx
+  8010e7:	89 cf                	mov    %ecx,%edi
+  8010e9:	89 ce                	mov    %ecx,%esi
+  8010eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ed:	85 c0                	test   %eax,%eax
+  8010ef:	7f 08                	jg     8010f9 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8010f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5f                   	pop    %edi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f9:	83 ec 0c             	sub    $0xc,%esp
+  8010fc:	50                   	push   %eax
+  8010fd:	6a 03                	push   $0x3
+  8010ff:	68 4b 50 80 00       	push   $0x80504b
+  801104:	6a 23                	push   $0x23
+  801106:	68 68 50 80 00       	push   $0x805068
+  80110b:	e8 38 f4 ff ff       	call   800548 <_panic>
+
+00801110 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	57                   	push   %edi
+  801114:	56                   	push   %esi
+  801115:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801120:	89 d1                	mov    %edx,%ecx
+  801122:	89 d3                	mov    %edx,%ebx
+  801124:	89 d7                	mov    %edx,%edi
+  801126:	89 d6                	mov    %edx,%esi
+  801128:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80112a:	5b                   	pop    %ebx
+  80112b:	5e                   	pop    %esi
+  80112c:	5f                   	pop    %edi
+  80112d:	5d                   	pop    %ebp
+  80112e:	c3                   	ret
+
+0080112f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80112f:	55                   	push   %ebp
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	57                   	push   %edi
+  801133:	56                   	push   %esi
+  801134:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80113f:	89 d1                	mov    %edx,%ecx
+  801141:	89 d3                	mov    %edx,%ebx
+  801143:	89 d7                	mov    %edx,%edi
+  801145:	89 d6                	mov    %edx,%esi
+  801147:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5f                   	pop    %edi
+  80114c:	5d                   	pop    %ebp
+  80114d:	c3                   	ret
+
+0080114e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	57                   	push   %edi
+  801152:	56                   	push   %esi
+  801153:	53                   	push   %ebx
+  801154:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801157:	be 00 00 00 00       	mov    $0x0,%esi
+  80115c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801162:	b8 04 00 00 00       	mov    $0x4,%eax
+  801167:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116a:	89 f7                	mov    %esi,%edi
+  80116c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 08                	jg     80117a <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	50                   	push   %eax
+  80117e:	6a 04                	push   $0x4
+  801180:	68 4b 50 80 00       	push   $0x80504b
+  801185:	6a 23                	push   $0x23
+  801187:	68 68 50 80 00       	push   $0x805068
+  80118c:	e8 b7 f3 ff ff       	call   800548 <_panic>
+
+00801191 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+  801197:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80119a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ab:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b0:	85 c0                	test   %eax,%eax
+  8011b2:	7f 08                	jg     8011bc <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8011b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+  8011bf:	50                   	push   %eax
+  8011c0:	6a 05                	push   $0x5
+  8011c2:	68 4b 50 80 00       	push   $0x80504b
+  8011c7:	6a 23                	push   $0x23
+  8011c9:	68 68 50 80 00       	push   $0x805068
+  8011ce:	e8 75 f3 ff ff       	call   800548 <_panic>
+
+008011d3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011d3:	55                   	push   %ebp
+  8011d4:	89 e5                	mov    %esp,%ebp
+  8011d6:	57                   	push   %edi
+  8011d7:	56                   	push   %esi
+  8011d8:	53                   	push   %ebx
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011ec:	89 df                	mov    %ebx,%edi
+  8011ee:	89 de                	mov    %ebx,%esi
+  8011f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	7f 08                	jg     8011fe <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8011f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011fe:	83 ec 0c             	sub    $0xc,%esp
+  801201:	50                   	push   %eax
+  801202:	6a 06                	push   $0x6
+  801204:	68 4b 50 80 00       	push   $0x80504b
+  801209:	6a 23                	push   $0x23
+  80120b:	68 68 50 80 00       	push   $0x805068
+  801210:	e8 33 f3 ff ff       	call   800548 <_panic>
+
+00801215 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	57                   	push   %edi
+  801219:	56                   	push   %esi
+  80121a:	53                   	push   %ebx
+  80121b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80121e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801223:	8b 55 08             	mov    0x8(%ebp),%edx
+  801226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801229:	b8 08 00 00 00       	mov    $0x8,%eax
+  80122e:	89 df                	mov    %ebx,%edi
+  801230:	89 de                	mov    %ebx,%esi
+  801232:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801234:	85 c0                	test   %eax,%eax
+  801236:	7f 08                	jg     801240 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801238:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123b:	5b                   	pop    %ebx
+  80123c:	5e                   	pop    %esi
+  80123d:	5f                   	pop    %edi
+  80123e:	5d                   	pop    %ebp
+  80123f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801240:	83 ec 0c             	sub    $0xc,%esp
+  801243:	50                   	push   %eax
+  801244:	6a 08                	push   $0x8
+  801246:	68 4b 50 80 00       	push   $0x80504b
+  80124b:	6a 23                	push   $0x23
+  80124d:	68 68 50 80 00       	push   $0x805068
+  801252:	e8 f1 f2 ff ff       	call   800548 <_panic>
+
+00801257 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801260:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801265:	8b 55 08             	mov    0x8(%ebp),%edx
+  801268:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801270:	89 df                	mov    %ebx,%edi
+  801272:	89 de                	mov    %ebx,%esi
+  801274:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801276:	85 c0                	test   %eax,%eax
+  801278:	7f 08                	jg     801282 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80127a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127d:	5b                   	pop    %ebx
+  80127e:	5e                   	pop    %esi
+  80127f:	5f                   	pop    %edi
+  801280:	5d                   	pop    %ebp
+  801281:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801282:	83 ec 0c             	sub    $0xc,%esp
+  801285:	50                   	push   %eax
+  801286:	6a 09                	push   $0x9
+  801288:	68 4b 50 80 00       	push   $0x80504b
+  80128d:	6a 23                	push   $0x23
+  80128f:	68 68 50 80 00       	push   $0x805068
+  801294:	e8 af f2 ff ff       	call   800548 <_panic>
+
+00801299 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	57                   	push   %edi
+  80129d:	56                   	push   %esi
+  80129e:	53                   	push   %ebx
+  80129f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012b2:	89 df                	mov    %ebx,%edi
+  8012b4:	89 de                	mov    %ebx,%esi
+  8012b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b8:	85 c0                	test   %eax,%eax
+  8012ba:	7f 08                	jg     8012c4 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bf:	5b                   	pop    %ebx
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5f                   	pop    %edi
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c4:	83 ec 0c             	sub    $0xc,%esp
+  8012c7:	50                   	push   %eax
+  8012c8:	6a 0a                	push   $0xa
+  8012ca:	68 4b 50 80 00       	push   $0x80504b
+  8012cf:	6a 23                	push   $0x23
+  8012d1:	68 68 50 80 00       	push   $0x805068
+  8012d6:	e8 6d f2 ff ff       	call   800548 <_panic>
+
+008012db <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	57                   	push   %edi
+  8012df:	56                   	push   %esi
+  8012e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012f9:	5b                   	pop    %ebx
+  8012fa:	5e                   	pop    %esi
+  8012fb:	5f                   	pop    %edi
+  8012fc:	5d                   	pop    %ebp
+  8012fd:	c3                   	ret
+
+008012fe <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8012fe:	55                   	push   %ebp
+  8012ff:	89 e5                	mov    %esp,%ebp
+  801301:	57                   	push   %edi
+  801302:	56                   	push   %esi
+  801303:	53                   	push   %ebx
+  801304:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801307:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801314:	89 cb                	mov    %ecx,%ebx
+  801316:	89 cf                	mov    %ecx,%edi
+  801318:	89 ce                	mov    %ecx,%esi
+  80131a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80131c:	85 c0                	test   %eax,%eax
+  80131e:	7f 08                	jg     801328 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801323:	5b                   	pop    %ebx
+  801324:	5e                   	pop    %esi
+  801325:	5f                   	pop    %edi
+  801326:	5d                   	pop    %ebp
+  801327:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801328:	83 ec 0c             	sub    $0xc,%esp
+  80132b:	50                   	push   %eax
+  80132c:	6a 0d                	push   $0xd
+  80132e:	68 4b 50 80 00       	push   $0x80504b
+  801333:	6a 23                	push   $0x23
+  801335:	68 68 50 80 00       	push   $0x805068
+  80133a:	e8 09 f2 ff ff       	call   800548 <_panic>
+
+0080133f <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80133f:	55                   	push   %ebp
+  801340:	89 e5                	mov    %esp,%ebp
+  801342:	57                   	push   %edi
+  801343:	56                   	push   %esi
+  801344:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801345:	8b 55 08             	mov    0x8(%ebp),%edx
+  801348:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801350:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801353:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801356:	8b 75 18             	mov    0x18(%ebp),%esi
+  801359:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80135b:	5b                   	pop    %ebx
+  80135c:	5e                   	pop    %esi
+  80135d:	5f                   	pop    %edi
+  80135e:	5d                   	pop    %ebp
+  80135f:	c3                   	ret
+
+00801360 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	57                   	push   %edi
+  801364:	56                   	push   %esi
+  801365:	53                   	push   %ebx
+  801366:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801369:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801379:	89 df                	mov    %ebx,%edi
+  80137b:	89 de                	mov    %ebx,%esi
+  80137d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80137f:	85 c0                	test   %eax,%eax
+  801381:	7f 08                	jg     80138b <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80138b:	83 ec 0c             	sub    $0xc,%esp
+  80138e:	50                   	push   %eax
+  80138f:	6a 0d                	push   $0xd
+  801391:	68 4b 50 80 00       	push   $0x80504b
+  801396:	6a 23                	push   $0x23
+  801398:	68 68 50 80 00       	push   $0x805068
+  80139d:	e8 a6 f1 ff ff       	call   800548 <_panic>
+
+008013a2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ad:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013b2:	89 d1                	mov    %edx,%ecx
+  8013b4:	89 d3                	mov    %edx,%ebx
+  8013b6:	89 d7                	mov    %edx,%edi
+  8013b8:	89 d6                	mov    %edx,%esi
+  8013ba:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5f                   	pop    %edi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+
+008013c1 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	57                   	push   %edi
+  8013c5:	56                   	push   %esi
+  8013c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013d7:	89 df                	mov    %ebx,%edi
+  8013d9:	89 de                	mov    %ebx,%esi
+  8013db:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8013dd:	5b                   	pop    %ebx
+  8013de:	5e                   	pop    %esi
+  8013df:	5f                   	pop    %edi
+  8013e0:	5d                   	pop    %ebp
+  8013e1:	c3                   	ret
+
+008013e2 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+  8013e5:	57                   	push   %edi
+  8013e6:	56                   	push   %esi
+  8013e7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013f5:	89 cb                	mov    %ecx,%ebx
+  8013f7:	89 cf                	mov    %ecx,%edi
+  8013f9:	89 ce                	mov    %ecx,%esi
+  8013fb:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8013fd:	5b                   	pop    %ebx
+  8013fe:	5e                   	pop    %esi
+  8013ff:	5f                   	pop    %edi
+  801400:	5d                   	pop    %ebp
+  801401:	c3                   	ret
+
+00801402 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801402:	55                   	push   %ebp
+  801403:	89 e5                	mov    %esp,%ebp
+  801405:	57                   	push   %edi
+  801406:	56                   	push   %esi
+  801407:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801408:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801410:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801413:	b8 11 00 00 00       	mov    $0x11,%eax
+  801418:	89 df                	mov    %ebx,%edi
+  80141a:	89 de                	mov    %ebx,%esi
+  80141c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80141e:	5b                   	pop    %ebx
+  80141f:	5e                   	pop    %esi
+  801420:	5f                   	pop    %edi
+  801421:	5d                   	pop    %ebp
+  801422:	c3                   	ret
+
+00801423 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801423:	55                   	push   %ebp
+  801424:	89 e5                	mov    %esp,%ebp
+  801426:	57                   	push   %edi
+  801427:	56                   	push   %esi
+  801428:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801434:	b8 12 00 00 00       	mov    $0x12,%eax
+  801439:	89 df                	mov    %ebx,%edi
+  80143b:	89 de                	mov    %ebx,%esi
+  80143d:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80143f:	5b                   	pop    %ebx
+  801440:	5e                   	pop    %esi
+  801441:	5f                   	pop    %edi
+  801442:	5d                   	pop    %ebp
+  801443:	c3                   	ret
+
+00801444 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801444:	55                   	push   %ebp
+  801445:	89 e5                	mov    %esp,%ebp
+  801447:	57                   	push   %edi
+  801448:	56                   	push   %esi
+  801449:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80144a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80144f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801452:	b8 13 00 00 00       	mov    $0x13,%eax
+  801457:	89 cb                	mov    %ecx,%ebx
+  801459:	89 cf                	mov    %ecx,%edi
+  80145b:	89 ce                	mov    %ecx,%esi
+  80145d:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80145f:	5b                   	pop    %ebx
+  801460:	5e                   	pop    %esi
+  801461:	5f                   	pop    %edi
+  801462:	5d                   	pop    %ebp
+  801463:	c3                   	ret
+
+00801464 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801464:	55                   	push   %ebp
+  801465:	89 e5                	mov    %esp,%ebp
+  801467:	57                   	push   %edi
+  801468:	56                   	push   %esi
+  801469:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80146a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801472:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801475:	b8 14 00 00 00       	mov    $0x14,%eax
+  80147a:	89 df                	mov    %ebx,%edi
+  80147c:	89 de                	mov    %ebx,%esi
+  80147e:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801480:	5b                   	pop    %ebx
+  801481:	5e                   	pop    %esi
+  801482:	5f                   	pop    %edi
+  801483:	5d                   	pop    %ebp
+  801484:	c3                   	ret
+
+00801485 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	57                   	push   %edi
+  801489:	56                   	push   %esi
+  80148a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80148b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801490:	8b 55 08             	mov    0x8(%ebp),%edx
+  801493:	b8 15 00 00 00       	mov    $0x15,%eax
+  801498:	89 cb                	mov    %ecx,%ebx
+  80149a:	89 cf                	mov    %ecx,%edi
+  80149c:	89 ce                	mov    %ecx,%esi
+  80149e:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8014a0:	5b                   	pop    %ebx
+  8014a1:	5e                   	pop    %esi
+  8014a2:	5f                   	pop    %edi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+
+008014a5 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014be:	89 f7                	mov    %esi,%edi
+  8014c0:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8014c2:	5b                   	pop    %ebx
+  8014c3:	5e                   	pop    %esi
+  8014c4:	5f                   	pop    %edi
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+
+008014c7 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  8014ca:	57                   	push   %edi
+  8014cb:	56                   	push   %esi
+  8014cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014dd:	89 df                	mov    %ebx,%edi
+  8014df:	89 de                	mov    %ebx,%esi
+  8014e1:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8014e3:	5b                   	pop    %ebx
+  8014e4:	5e                   	pop    %esi
+  8014e5:	5f                   	pop    %edi
+  8014e6:	5d                   	pop    %ebp
+  8014e7:	c3                   	ret
+
+008014e8 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8014e8:	55                   	push   %ebp
+  8014e9:	89 e5                	mov    %esp,%ebp
+  8014eb:	57                   	push   %edi
+  8014ec:	56                   	push   %esi
+  8014ed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014fb:	89 cb                	mov    %ecx,%ebx
+  8014fd:	89 cf                	mov    %ecx,%edi
+  8014ff:	89 ce                	mov    %ecx,%esi
+  801501:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801503:	5b                   	pop    %ebx
+  801504:	5e                   	pop    %esi
+  801505:	5f                   	pop    %edi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+
+00801508 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801508:	55                   	push   %ebp
+  801509:	89 e5                	mov    %esp,%ebp
+  80150b:	57                   	push   %edi
+  80150c:	56                   	push   %esi
+  80150d:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80150e:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801512:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801517:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80151f:	89 df                	mov    %ebx,%edi
+  801521:	89 de                	mov    %ebx,%esi
+  801523:	cd 30                	int    $0x30
+}
+  801525:	5b                   	pop    %ebx
+  801526:	5e                   	pop    %esi
+  801527:	5f                   	pop    %edi
+  801528:	5d                   	pop    %ebp
+  801529:	c3                   	ret
+
+0080152a <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80152a:	55                   	push   %ebp
+  80152b:	89 e5                	mov    %esp,%ebp
+  80152d:	57                   	push   %edi
+  80152e:	56                   	push   %esi
+  80152f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	8b 55 08             	mov    0x8(%ebp),%edx
+  801538:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801540:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801543:	89 f7                	mov    %esi,%edi
+  801545:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801547:	5b                   	pop    %ebx
+  801548:	5e                   	pop    %esi
+  801549:	5f                   	pop    %edi
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+
+0080154c <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+  80154f:	57                   	push   %edi
+  801550:	56                   	push   %esi
+  801551:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801552:	be 00 00 00 00       	mov    $0x0,%esi
+  801557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801562:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801565:	89 f7                	mov    %esi,%edi
+  801567:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801569:	5b                   	pop    %ebx
+  80156a:	5e                   	pop    %esi
+  80156b:	5f                   	pop    %edi
+  80156c:	5d                   	pop    %ebp
+  80156d:	c3                   	ret
+
+0080156e <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80156e:	55                   	push   %ebp
+  80156f:	89 e5                	mov    %esp,%ebp
+  801571:	57                   	push   %edi
+  801572:	56                   	push   %esi
+  801573:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801574:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801579:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801584:	89 df                	mov    %ebx,%edi
+  801586:	89 de                	mov    %ebx,%esi
+  801588:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80158a:	5b                   	pop    %ebx
+  80158b:	5e                   	pop    %esi
+  80158c:	5f                   	pop    %edi
+  80158d:	5d                   	pop    %ebp
+  80158e:	c3                   	ret
+
+0080158f <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80158f:	55                   	push   %ebp
+  801590:	89 e5                	mov    %esp,%ebp
+  801592:	57                   	push   %edi
+  801593:	56                   	push   %esi
+  801594:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801595:	be 00 00 00 00       	mov    $0x0,%esi
+  80159a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a8:	89 f7                	mov    %esi,%edi
+  8015aa:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8015ac:	5b                   	pop    %ebx
+  8015ad:	5e                   	pop    %esi
+  8015ae:	5f                   	pop    %edi
+  8015af:	5d                   	pop    %ebp
+  8015b0:	c3                   	ret
+
+008015b1 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	74 20                	je     8015d5 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8015b5:	89 c1                	mov    %eax,%ecx
+  8015b7:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015bd:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8015c3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8015c9:	8b 52 48             	mov    0x48(%edx),%edx
+  8015cc:	39 c2                	cmp    %eax,%edx
+  8015ce:	74 06                	je     8015d6 <thread_alive+0x25>
+  8015d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d5:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015d6:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8015dc:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	0f 95 c0             	setne  %al
+  8015e7:	0f b6 c0             	movzbl %al,%eax
+  8015ea:	c3                   	ret
+
+008015eb <pgfault>:
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+  8015f1:	83 ec 0c             	sub    $0xc,%esp
+  8015f4:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8015f7:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8015f9:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8015fc:	89 f3                	mov    %esi,%ebx
+  8015fe:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801601:	83 3d a0 82 80 00 00 	cmpl   $0x0,0x8082a0
+  801608:	74 52                	je     80165c <pgfault+0x71>
+  80160a:	a8 02                	test   $0x2,%al
+  80160c:	75 14                	jne    801622 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  80160e:	83 ec 04             	sub    $0x4,%esp
+  801611:	68 76 50 80 00       	push   $0x805076
+  801616:	6a 2e                	push   $0x2e
+  801618:	68 94 50 80 00       	push   $0x805094
+  80161d:	e8 26 ef ff ff       	call   800548 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801622:	89 d8                	mov    %ebx,%eax
+  801624:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801629:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801630:	83 ec 0c             	sub    $0xc,%esp
+  801633:	57                   	push   %edi
+  801634:	e8 03 29 00 00       	call   803f3c <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801639:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801640:	83 e0 03             	and    $0x3,%eax
+  801643:	83 c4 10             	add    $0x10,%esp
+  801646:	83 f8 03             	cmp    $0x3,%eax
+  801649:	75 1a                	jne    801665 <pgfault+0x7a>
+			mutex_unlock(m);
+  80164b:	83 ec 0c             	sub    $0xc,%esp
+  80164e:	57                   	push   %edi
+  80164f:	e8 56 29 00 00       	call   803faa <mutex_unlock>
+			return;
+  801654:	83 c4 10             	add    $0x10,%esp
+  801657:	e9 9f 00 00 00       	jmp    8016fb <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80165c:	a8 02                	test   $0x2,%al
+  80165e:	74 ae                	je     80160e <pgfault+0x23>
+	struct mutex *m = NULL;
+  801660:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801665:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80166c:	f6 c4 08             	test   $0x8,%ah
+  80166f:	74 9d                	je     80160e <pgfault+0x23>
+  801671:	89 e0                	mov    %esp,%eax
+  801673:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801678:	29 c2                	sub    %eax,%edx
+  80167a:	89 d0                	mov    %edx,%eax
+  80167c:	c1 e8 0f             	shr    $0xf,%eax
+  80167f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801685:	ba 00 00 00 00       	mov    $0x0,%edx
+  80168a:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  80168d:	c1 e0 0c             	shl    $0xc,%eax
+  801690:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801695:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801697:	83 ec 04             	sub    $0x4,%esp
+  80169a:	6a 07                	push   $0x7
+  80169c:	53                   	push   %ebx
+  80169d:	6a 00                	push   $0x0
+  80169f:	e8 aa fa ff ff       	call   80114e <sys_page_alloc>
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 58                	js     801703 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8016ab:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8016b1:	83 ec 04             	sub    $0x4,%esp
+  8016b4:	68 00 10 00 00       	push   $0x1000
+  8016b9:	56                   	push   %esi
+  8016ba:	53                   	push   %ebx
+  8016bb:	e8 0a f8 ff ff       	call   800eca <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8016c0:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016c7:	56                   	push   %esi
+  8016c8:	6a 00                	push   $0x0
+  8016ca:	53                   	push   %ebx
+  8016cb:	6a 00                	push   $0x0
+  8016cd:	e8 bf fa ff ff       	call   801191 <sys_page_map>
+  8016d2:	83 c4 20             	add    $0x20,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 3c                	js     801715 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8016d9:	83 ec 08             	sub    $0x8,%esp
+  8016dc:	53                   	push   %ebx
+  8016dd:	6a 00                	push   $0x0
+  8016df:	e8 ef fa ff ff       	call   8011d3 <sys_page_unmap>
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	78 3c                	js     801727 <pgfault+0x13c>
+	if(m)
+  8016eb:	85 ff                	test   %edi,%edi
+  8016ed:	74 0c                	je     8016fb <pgfault+0x110>
+		mutex_unlock(m);
+  8016ef:	83 ec 0c             	sub    $0xc,%esp
+  8016f2:	57                   	push   %edi
+  8016f3:	e8 b2 28 00 00       	call   803faa <mutex_unlock>
+  8016f8:	83 c4 10             	add    $0x10,%esp
+}
+  8016fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016fe:	5b                   	pop    %ebx
+  8016ff:	5e                   	pop    %esi
+  801700:	5f                   	pop    %edi
+  801701:	5d                   	pop    %ebp
+  801702:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801703:	50                   	push   %eax
+  801704:	68 6d 4b 80 00       	push   $0x804b6d
+  801709:	6a 3d                	push   $0x3d
+  80170b:	68 94 50 80 00       	push   $0x805094
+  801710:	e8 33 ee ff ff       	call   800548 <_panic>
+		panic("sys_page_map: %e", ret);
+  801715:	50                   	push   %eax
+  801716:	68 9f 50 80 00       	push   $0x80509f
+  80171b:	6a 40                	push   $0x40
+  80171d:	68 94 50 80 00       	push   $0x805094
+  801722:	e8 21 ee ff ff       	call   800548 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801727:	50                   	push   %eax
+  801728:	68 b0 50 80 00       	push   $0x8050b0
+  80172d:	6a 42                	push   $0x42
+  80172f:	68 94 50 80 00       	push   $0x805094
+  801734:	e8 0f ee ff ff       	call   800548 <_panic>
+
+00801739 <thread_main>:
+{
+  801739:	55                   	push   %ebp
+  80173a:	89 e5                	mov    %esp,%ebp
+  80173c:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  80173f:	ff 75 0c             	push   0xc(%ebp)
+  801742:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801745:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80174c:	e8 7e f9 ff ff       	call   8010cf <sys_env_destroy>
+}
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+
+00801756 <fork>:
+{
+  801756:	55                   	push   %ebp
+  801757:	89 e5                	mov    %esp,%ebp
+  801759:	57                   	push   %edi
+  80175a:	56                   	push   %esi
+  80175b:	53                   	push   %ebx
+  80175c:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  80175f:	68 eb 15 80 00       	push   $0x8015eb
+  801764:	e8 1f 2b 00 00       	call   804288 <set_pgfault_handler>
+	if(sforked)
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	83 3d a0 82 80 00 00 	cmpl   $0x0,0x8082a0
+  801773:	75 33                	jne    8017a8 <fork+0x52>
+	__asm __volatile("int %2"
+  801775:	b8 07 00 00 00       	mov    $0x7,%eax
+  80177a:	cd 30                	int    $0x30
+  80177c:	89 c7                	mov    %eax,%edi
+  80177e:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801780:	85 c0                	test   %eax,%eax
+  801782:	0f 88 b4 00 00 00    	js     80183c <fork+0xe6>
+	if(envid == 0) {
+  801788:	0f 84 c3 00 00 00    	je     801851 <fork+0xfb>
+	pgbatch_init(&pb);
+  80178e:	83 ec 0c             	sub    $0xc,%esp
+  801791:	68 20 7b 80 00       	push   $0x807b20
+  801796:	e8 ed 25 00 00       	call   803d88 <pgbatch_init>
+  80179b:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80179e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a3:	e9 9c 01 00 00       	jmp    801944 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+  8017ab:	68 c0 7e 80 00       	push   $0x807ec0
+  8017b0:	e8 87 27 00 00       	call   803f3c <mutex_lock>
+  8017b5:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8017b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8017bd:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8017c2:	eb 08                	jmp    8017cc <fork+0x76>
+  8017c4:	83 c3 01             	add    $0x1,%ebx
+  8017c7:	83 fb 20             	cmp    $0x20,%ebx
+  8017ca:	74 5b                	je     801827 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8017cc:	8b 34 9d 40 7e 80 00 	mov    0x807e40(,%ebx,4),%esi
+  8017d3:	89 f0                	mov    %esi,%eax
+  8017d5:	e8 d7 fd ff ff       	call   8015b1 <thread_alive>
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	74 e6                	je     8017c4 <fork+0x6e>
+  8017de:	89 e0                	mov    %esp,%eax
+  8017e0:	89 fa                	mov    %edi,%edx
+  8017e2:	29 c2                	sub    %eax,%edx
+  8017e4:	89 d0                	mov    %edx,%eax
+  8017e6:	c1 e8 0f             	shr    $0xf,%eax
+  8017e9:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8017ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017f4:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8017f7:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  8017fe:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801801:	83 ec 08             	sub    $0x8,%esp
+  801804:	50                   	push   %eax
+  801805:	56                   	push   %esi
+  801806:	e8 8e fa ff ff       	call   801299 <sys_env_set_pgfault_upcall>
+  80180b:	83 c4 10             	add    $0x10,%esp
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	79 b2                	jns    8017c4 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801812:	50                   	push   %eax
+  801813:	68 3c 51 80 00       	push   $0x80513c
+  801818:	68 00 01 00 00       	push   $0x100
+  80181d:	68 94 50 80 00       	push   $0x805094
+  801822:	e8 21 ed ff ff       	call   800548 <_panic>
+	mutex_unlock(&sfork_lock);
+  801827:	83 ec 0c             	sub    $0xc,%esp
+  80182a:	68 c0 7e 80 00       	push   $0x807ec0
+  80182f:	e8 76 27 00 00       	call   803faa <mutex_unlock>
+}
+  801834:	83 c4 10             	add    $0x10,%esp
+  801837:	e9 39 ff ff ff       	jmp    801775 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  80183c:	50                   	push   %eax
+  80183d:	68 c3 50 80 00       	push   $0x8050c3
+  801842:	68 91 00 00 00       	push   $0x91
+  801847:	68 94 50 80 00       	push   $0x805094
+  80184c:	e8 f7 ec ff ff       	call   800548 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801851:	e8 ba f8 ff ff       	call   801110 <sys_getenvid>
+  801856:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80185b:	89 e1                	mov    %esp,%ecx
+  80185d:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801862:	29 ca                	sub    %ecx,%edx
+  801864:	89 d1                	mov    %edx,%ecx
+  801866:	c1 e9 0f             	shr    $0xf,%ecx
+  801869:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80186f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801874:	0f 42 d1             	cmovb  %ecx,%edx
+  801877:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80187d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801882:	89 04 95 20 82 80 00 	mov    %eax,0x808220(,%edx,4)
+		if(sforked)
+  801889:	a1 a0 82 80 00       	mov    0x8082a0,%eax
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	75 07                	jne    801899 <fork+0x143>
+		return 0;
+  801892:	89 c6                	mov    %eax,%esi
+  801894:	e9 6f 02 00 00       	jmp    801b08 <fork+0x3b2>
+  801899:	89 e2                	mov    %esp,%edx
+  80189b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8018a0:	29 d0                	sub    %edx,%eax
+  8018a2:	89 c3                	mov    %eax,%ebx
+  8018a4:	c1 eb 0f             	shr    $0xf,%ebx
+  8018a7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b1:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8018b4:	83 ec 04             	sub    $0x4,%esp
+  8018b7:	68 80 00 00 00       	push   $0x80
+  8018bc:	6a 00                	push   $0x0
+  8018be:	68 40 7e 80 00       	push   $0x807e40
+  8018c3:	e8 cd f5 ff ff       	call   800e95 <memset>
+	thread_ids[slot] = sys_getenvid();
+  8018c8:	e8 43 f8 ff ff       	call   801110 <sys_getenvid>
+  8018cd:	89 04 9d 40 7e 80 00 	mov    %eax,0x807e40(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8018d4:	8b 04 9d 20 82 80 00 	mov    0x808220(,%ebx,4),%eax
+  8018db:	a3 20 82 80 00       	mov    %eax,0x808220
+	mutex_init(&sfork_lock);
+  8018e0:	c7 04 24 c0 7e 80 00 	movl   $0x807ec0,(%esp)
+  8018e7:	e8 42 26 00 00       	call   803f2e <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8018ec:	83 c4 0c             	add    $0xc,%esp
+  8018ef:	68 07 04 00 00       	push   $0x407
+  8018f4:	68 00 00 00 e1       	push   $0xe1000000
+  8018f9:	6a 00                	push   $0x0
+  8018fb:	e8 4e f8 ff ff       	call   80114e <sys_page_alloc>
+  801900:	83 c4 10             	add    $0x10,%esp
+  801903:	85 c0                	test   %eax,%eax
+  801905:	0f 89 fd 01 00 00    	jns    801b08 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  80190b:	50                   	push   %eax
+  80190c:	68 6d 4b 80 00       	push   $0x804b6d
+  801911:	68 12 01 00 00       	push   $0x112
+  801916:	68 94 50 80 00       	push   $0x805094
+  80191b:	e8 28 ec ff ff       	call   800548 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801920:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801926:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  80192c:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801932:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801938:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  80193e:	0f 87 4f 01 00 00    	ja     801a93 <fork+0x33d>
+		pd = PDX(addr);
+  801944:	89 d8                	mov    %ebx,%eax
+  801946:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801949:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801950:	f6 c2 01             	test   $0x1,%dl
+  801953:	74 cb                	je     801920 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801955:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80195a:	0f 85 92 00 00 00    	jne    8019f2 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801960:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801966:	76 10                	jbe    801978 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801968:	89 d8                	mov    %ebx,%eax
+  80196a:	f7 d8                	neg    %eax
+  80196c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801971:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801976:	74 ba                	je     801932 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801978:	89 d8                	mov    %ebx,%eax
+  80197a:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80197d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801984:	f6 c2 01             	test   $0x1,%dl
+  801987:	74 a9                	je     801932 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801989:	89 c1                	mov    %eax,%ecx
+  80198b:	c1 e1 0c             	shl    $0xc,%ecx
+  80198e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801991:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801998:	f6 c6 04             	test   $0x4,%dh
+  80199b:	0f 85 8e 00 00 00    	jne    801a2f <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8019a1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019a8:	f6 c6 08             	test   $0x8,%dh
+  8019ab:	75 0f                	jne    8019bc <fork+0x266>
+  8019ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019b4:	a8 02                	test   $0x2,%al
+  8019b6:	0f 84 bb 00 00 00    	je     801a77 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8019bc:	83 ec 08             	sub    $0x8,%esp
+  8019bf:	68 05 08 00 00       	push   $0x805
+  8019c4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019c7:	50                   	push   %eax
+  8019c8:	56                   	push   %esi
+  8019c9:	50                   	push   %eax
+  8019ca:	6a 00                	push   $0x0
+  8019cc:	68 20 7b 80 00       	push   $0x807b20
+  8019d1:	e8 70 24 00 00       	call   803e46 <pgbatch_map>
+  8019d6:	83 c4 20             	add    $0x20,%esp
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	79 76                	jns    801a53 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8019dd:	50                   	push   %eax
+  8019de:	68 e7 50 80 00       	push   $0x8050e7
+  8019e3:	68 bc 00 00 00       	push   $0xbc
+  8019e8:	68 94 50 80 00       	push   $0x805094
+  8019ed:	e8 56 eb ff ff       	call   800548 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8019f2:	83 ec 0c             	sub    $0xc,%esp
+  8019f5:	68 00 08 00 00       	push   $0x800
+  8019fa:	56                   	push   %esi
+  8019fb:	53                   	push   %ebx
+  8019fc:	6a 00                	push   $0x0
+  8019fe:	68 20 7b 80 00       	push   $0x807b20
+  801a03:	e8 e9 24 00 00       	call   803ef1 <pgbatch_sharept>
+  801a08:	83 c4 20             	add    $0x20,%esp
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	78 0b                	js     801a1a <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801a0f:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801a15:	e9 18 ff ff ff       	jmp    801932 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801a1a:	50                   	push   %eax
+  801a1b:	68 d3 50 80 00       	push   $0x8050d3
+  801a20:	68 b2 00 00 00       	push   $0xb2
+  801a25:	68 94 50 80 00       	push   $0x805094
+  801a2a:	e8 19 eb ff ff       	call   800548 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801a2f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a36:	83 ec 08             	sub    $0x8,%esp
+  801a39:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a3e:	50                   	push   %eax
+  801a3f:	51                   	push   %ecx
+  801a40:	56                   	push   %esi
+  801a41:	51                   	push   %ecx
+  801a42:	6a 00                	push   $0x0
+  801a44:	68 20 7b 80 00       	push   $0x807b20
+  801a49:	e8 f8 23 00 00       	call   803e46 <pgbatch_map>
+  801a4e:	83 c4 20             	add    $0x20,%esp
+  801a51:	eb 17                	jmp    801a6a <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801a53:	68 05 08 00 00       	push   $0x805
+  801a58:	ff 75 e4             	push   -0x1c(%ebp)
+  801a5b:	6a 00                	push   $0x0
+  801a5d:	68 20 7b 80 00       	push   $0x807b20
+  801a62:	e8 53 24 00 00       	call   803eba <pgbatch_protect>
+  801a67:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	0f 89 c0 fe ff ff    	jns    801932 <fork+0x1dc>
+  801a72:	e9 66 ff ff ff       	jmp    8019dd <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801a77:	83 ec 08             	sub    $0x8,%esp
+  801a7a:	6a 05                	push   $0x5
+  801a7c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a7f:	50                   	push   %eax
+  801a80:	56                   	push   %esi
+  801a81:	50                   	push   %eax
+  801a82:	6a 00                	push   $0x0
+  801a84:	68 20 7b 80 00       	push   $0x807b20
+  801a89:	e8 b8 23 00 00       	call   803e46 <pgbatch_map>
+  801a8e:	83 c4 20             	add    $0x20,%esp
+  801a91:	eb d7                	jmp    801a6a <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801a93:	6a 07                	push   $0x7
+  801a95:	68 00 f0 bf ee       	push   $0xeebff000
+  801a9a:	57                   	push   %edi
+  801a9b:	68 20 7b 80 00       	push   $0x807b20
+  801aa0:	e8 6a 23 00 00       	call   803e0f <pgbatch_alloc>
+  801aa5:	83 c4 10             	add    $0x10,%esp
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	78 66                	js     801b12 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801aac:	83 ec 0c             	sub    $0xc,%esp
+  801aaf:	68 20 7b 80 00       	push   $0x807b20
+  801ab4:	e8 dd 22 00 00       	call   803d96 <pgbatch_flush>
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 52                	js     801b12 <fork+0x3bc>
+  801ac0:	89 e2                	mov    %esp,%edx
+  801ac2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ac7:	29 d0                	sub    %edx,%eax
+  801ac9:	89 c2                	mov    %eax,%edx
+  801acb:	c1 ea 0f             	shr    $0xf,%edx
+  801ace:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad8:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801adb:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  801ae2:	8b 40 78             	mov    0x78(%eax),%eax
+  801ae5:	83 ec 08             	sub    $0x8,%esp
+  801ae8:	50                   	push   %eax
+  801ae9:	57                   	push   %edi
+  801aea:	e8 aa f7 ff ff       	call   801299 <sys_env_set_pgfault_upcall>
+  801aef:	83 c4 10             	add    $0x10,%esp
+  801af2:	85 c0                	test   %eax,%eax
+  801af4:	78 31                	js     801b27 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801af6:	83 ec 08             	sub    $0x8,%esp
+  801af9:	6a 02                	push   $0x2
+  801afb:	57                   	push   %edi
+  801afc:	e8 14 f7 ff ff       	call   801215 <sys_env_set_status>
+  801b01:	83 c4 10             	add    $0x10,%esp
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 34                	js     801b3c <fork+0x3e6>
+}
+  801b08:	89 f0                	mov    %esi,%eax
+  801b0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0d:	5b                   	pop    %ebx
+  801b0e:	5e                   	pop    %esi
+  801b0f:	5f                   	pop    %edi
+  801b10:	5d                   	pop    %ebp
+  801b11:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801b12:	50                   	push   %eax
+  801b13:	68 f3 50 80 00       	push   $0x8050f3
+  801b18:	68 c0 00 00 00       	push   $0xc0
+  801b1d:	68 94 50 80 00       	push   $0x805094
+  801b22:	e8 21 ea ff ff       	call   800548 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801b27:	50                   	push   %eax
+  801b28:	68 08 51 80 00       	push   $0x805108
+  801b2d:	68 c2 00 00 00       	push   $0xc2
+  801b32:	68 94 50 80 00       	push   $0x805094
+  801b37:	e8 0c ea ff ff       	call   800548 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801b3c:	50                   	push   %eax
+  801b3d:	68 23 51 80 00       	push   $0x805123
+  801b42:	68 c4 00 00 00       	push   $0xc4
+  801b47:	68 94 50 80 00       	push   $0x805094
+  801b4c:	e8 f7 e9 ff ff       	call   800548 <_panic>
+
+00801b51 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801b51:	55                   	push   %ebp
+  801b52:	89 e5                	mov    %esp,%ebp
+  801b54:	57                   	push   %edi
+  801b55:	56                   	push   %esi
+  801b56:	53                   	push   %ebx
+  801b57:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801b5a:	68 c0 7e 80 00       	push   $0x807ec0
+  801b5f:	e8 d8 23 00 00       	call   803f3c <mutex_lock>
+  801b64:	89 e2                	mov    %esp,%edx
+  801b66:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b6b:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801b6d:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801b70:	89 c3                	mov    %eax,%ebx
+  801b72:	c1 eb 0f             	shr    $0xf,%ebx
+  801b75:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7f:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801b82:	e8 89 f5 ff ff       	call   801110 <sys_getenvid>
+  801b87:	89 04 9d 40 7e 80 00 	mov    %eax,0x807e40(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801b8e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801b93:	8b 04 9d 40 7e 80 00 	mov    0x807e40(,%ebx,4),%eax
+  801b9a:	e8 12 fa ff ff       	call   8015b1 <thread_alive>
+  801b9f:	85 c0                	test   %eax,%eax
+  801ba1:	74 24                	je     801bc7 <sfork+0x76>
+  801ba3:	83 c3 01             	add    $0x1,%ebx
+  801ba6:	83 fb 20             	cmp    $0x20,%ebx
+  801ba9:	75 e8                	jne    801b93 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801bab:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801bb0:	83 ec 0c             	sub    $0xc,%esp
+  801bb3:	68 c0 7e 80 00       	push   $0x807ec0
+  801bb8:	e8 ed 23 00 00       	call   803faa <mutex_unlock>
+	return r;
+}
+  801bbd:	89 f0                	mov    %esi,%eax
+  801bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bc2:	5b                   	pop    %ebx
+  801bc3:	5e                   	pop    %esi
+  801bc4:	5f                   	pop    %edi
+  801bc5:	5d                   	pop    %ebp
+  801bc6:	c3                   	ret
+	if (i == NTHREADS) {
+  801bc7:	83 fb 20             	cmp    $0x20,%ebx
+  801bca:	0f 84 53 01 00 00    	je     801d23 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801bd0:	89 d8                	mov    %ebx,%eax
+  801bd2:	c1 e0 0f             	shl    $0xf,%eax
+  801bd5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801bd8:	83 ec 0c             	sub    $0xc,%esp
+  801bdb:	68 00 78 80 00       	push   $0x807800
+  801be0:	e8 a3 21 00 00       	call   803d88 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	83 3d a0 82 80 00 00 	cmpl   $0x0,0x8082a0
+  801bef:	75 1f                	jne    801c10 <sfork+0xbf>
+  801bf1:	68 07 04 00 00       	push   $0x407
+  801bf6:	68 00 00 00 e1       	push   $0xe1000000
+  801bfb:	6a 00                	push   $0x0
+  801bfd:	68 00 78 80 00       	push   $0x807800
+  801c02:	e8 08 22 00 00       	call   803e0f <pgbatch_alloc>
+  801c07:	89 c6                	mov    %eax,%esi
+  801c09:	83 c4 10             	add    $0x10,%esp
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	78 a0                	js     801bb0 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801c10:	6a 07                	push   $0x7
+  801c12:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801c17:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c1a:	29 c8                	sub    %ecx,%eax
+  801c1c:	50                   	push   %eax
+  801c1d:	6a 00                	push   $0x0
+  801c1f:	68 00 78 80 00       	push   $0x807800
+  801c24:	e8 e6 21 00 00       	call   803e0f <pgbatch_alloc>
+  801c29:	89 c6                	mov    %eax,%esi
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	0f 88 7a ff ff ff    	js     801bb0 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801c36:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801c3b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c3e:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c40:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801c45:	29 c8                	sub    %ecx,%eax
+  801c47:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c4a:	39 c7                	cmp    %eax,%edi
+  801c4c:	73 29                	jae    801c77 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801c4e:	6a 07                	push   $0x7
+  801c50:	57                   	push   %edi
+  801c51:	6a 00                	push   $0x0
+  801c53:	68 00 78 80 00       	push   $0x807800
+  801c58:	e8 b2 21 00 00       	call   803e0f <pgbatch_alloc>
+  801c5d:	89 c6                	mov    %eax,%esi
+  801c5f:	83 c4 10             	add    $0x10,%esp
+  801c62:	85 c0                	test   %eax,%eax
+  801c64:	0f 88 46 ff ff ff    	js     801bb0 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c6a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801c70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c73:	39 c7                	cmp    %eax,%edi
+  801c75:	72 d7                	jb     801c4e <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801c77:	83 ec 0c             	sub    $0xc,%esp
+  801c7a:	68 00 78 80 00       	push   $0x807800
+  801c7f:	e8 12 21 00 00       	call   803d96 <pgbatch_flush>
+  801c84:	89 c6                	mov    %eax,%esi
+  801c86:	83 c4 10             	add    $0x10,%esp
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	0f 88 1f ff ff ff    	js     801bb0 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801c91:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801c96:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c99:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801c9b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801ca1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ca4:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801ca7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801caa:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801cad:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801cb0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801cb5:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801cb7:	52                   	push   %edx
+  801cb8:	50                   	push   %eax
+  801cb9:	68 39 17 80 00       	push   $0x801739
+  801cbe:	e8 cc f8 ff ff       	call   80158f <sys_exofork_shared>
+  801cc3:	89 c6                	mov    %eax,%esi
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	0f 88 e0 fe ff ff    	js     801bb0 <sfork+0x5f>
+	thread_ids[i] = id;
+  801cd0:	89 04 9d 40 7e 80 00 	mov    %eax,0x807e40(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801cd7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cdc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801ce2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ce7:	89 04 9d 20 82 80 00 	mov    %eax,0x808220(,%ebx,4)
+	sforked = 1;
+  801cee:	c7 05 a0 82 80 00 01 	movl   $0x1,0x8082a0
+  801cf5:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801cf8:	83 ec 08             	sub    $0x8,%esp
+  801cfb:	6a 02                	push   $0x2
+  801cfd:	56                   	push   %esi
+  801cfe:	e8 12 f5 ff ff       	call   801215 <sys_env_set_status>
+  801d03:	89 c3                	mov    %eax,%ebx
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	0f 89 a0 fe ff ff    	jns    801bb0 <sfork+0x5f>
+		sys_env_destroy(id);
+  801d10:	83 ec 0c             	sub    $0xc,%esp
+  801d13:	56                   	push   %esi
+  801d14:	e8 b6 f3 ff ff       	call   8010cf <sys_env_destroy>
+		goto out;
+  801d19:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801d1c:	89 de                	mov    %ebx,%esi
+		goto out;
+  801d1e:	e9 8d fe ff ff       	jmp    801bb0 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801d23:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801d28:	e9 83 fe ff ff       	jmp    801bb0 <sfork+0x5f>
+
+00801d2d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d2d:	55                   	push   %ebp
+  801d2e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d33:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d38:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d3b:	5d                   	pop    %ebp
+  801d3c:	c3                   	ret
+
+00801d3d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d43:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801d48:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d4d:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801d52:	5d                   	pop    %ebp
+  801d53:	c3                   	ret
+
+00801d54 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801d54:	55                   	push   %ebp
+  801d55:	89 e5                	mov    %esp,%ebp
+  801d57:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801d5c:	89 c2                	mov    %eax,%edx
+  801d5e:	c1 ea 16             	shr    $0x16,%edx
+  801d61:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d68:	f6 c2 01             	test   $0x1,%dl
+  801d6b:	74 29                	je     801d96 <fd_alloc+0x42>
+  801d6d:	89 c2                	mov    %eax,%edx
+  801d6f:	c1 ea 0c             	shr    $0xc,%edx
+  801d72:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d79:	f6 c2 01             	test   $0x1,%dl
+  801d7c:	74 18                	je     801d96 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801d7e:	05 00 10 00 00       	add    $0x1000,%eax
+  801d83:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801d88:	75 d2                	jne    801d5c <fd_alloc+0x8>
+  801d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801d8f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d94:	eb 05                	jmp    801d9b <fd_alloc+0x47>
+			return 0;
+  801d96:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d9e:	89 02                	mov    %eax,(%edx)
+}
+  801da0:	89 c8                	mov    %ecx,%eax
+  801da2:	5d                   	pop    %ebp
+  801da3:	c3                   	ret
+
+00801da4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801da4:	55                   	push   %ebp
+  801da5:	89 e5                	mov    %esp,%ebp
+  801da7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801daa:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801daf:	77 30                	ja     801de1 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801db1:	c1 e0 0c             	shl    $0xc,%eax
+  801db4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801db9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801dbf:	f6 c2 01             	test   $0x1,%dl
+  801dc2:	74 24                	je     801de8 <fd_lookup+0x44>
+  801dc4:	89 c2                	mov    %eax,%edx
+  801dc6:	c1 ea 0c             	shr    $0xc,%edx
+  801dc9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dd0:	f6 c2 01             	test   $0x1,%dl
+  801dd3:	74 1a                	je     801def <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801dd5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dd8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801dda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+		return -E_INVAL;
+  801de1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de6:	eb f7                	jmp    801ddf <fd_lookup+0x3b>
+		return -E_INVAL;
+  801de8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ded:	eb f0                	jmp    801ddf <fd_lookup+0x3b>
+  801def:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df4:	eb e9                	jmp    801ddf <fd_lookup+0x3b>
+
+00801df6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801df6:	55                   	push   %ebp
+  801df7:	89 e5                	mov    %esp,%ebp
+  801df9:	53                   	push   %ebx
+  801dfa:	83 ec 04             	sub    $0x4,%esp
+  801dfd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e05:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801e0a:	39 13                	cmp    %edx,(%ebx)
+  801e0c:	74 54                	je     801e62 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801e0e:	83 c0 01             	add    $0x1,%eax
+  801e11:	8b 1c 85 d8 51 80 00 	mov    0x8051d8(,%eax,4),%ebx
+  801e18:	85 db                	test   %ebx,%ebx
+  801e1a:	75 ee                	jne    801e0a <dev_lookup+0x14>
+  801e1c:	89 e1                	mov    %esp,%ecx
+  801e1e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e23:	29 c8                	sub    %ecx,%eax
+  801e25:	89 c1                	mov    %eax,%ecx
+  801e27:	c1 e9 0f             	shr    $0xf,%ecx
+  801e2a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e34:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e37:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  801e3e:	8b 40 48             	mov    0x48(%eax),%eax
+  801e41:	83 ec 04             	sub    $0x4,%esp
+  801e44:	52                   	push   %edx
+  801e45:	50                   	push   %eax
+  801e46:	68 5c 51 80 00       	push   $0x80515c
+  801e4b:	e8 d3 e7 ff ff       	call   800623 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e5b:	89 1a                	mov    %ebx,(%edx)
+}
+  801e5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e60:	c9                   	leave
+  801e61:	c3                   	ret
+			return 0;
+  801e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e67:	eb ef                	jmp    801e58 <dev_lookup+0x62>
+
+00801e69 <fd_close>:
+{
+  801e69:	55                   	push   %ebp
+  801e6a:	89 e5                	mov    %esp,%ebp
+  801e6c:	57                   	push   %edi
+  801e6d:	56                   	push   %esi
+  801e6e:	53                   	push   %ebx
+  801e6f:	83 ec 24             	sub    $0x24,%esp
+  801e72:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e75:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e78:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e7b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e7c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e82:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e85:	50                   	push   %eax
+  801e86:	e8 19 ff ff ff       	call   801da4 <fd_lookup>
+  801e8b:	89 c3                	mov    %eax,%ebx
+  801e8d:	83 c4 10             	add    $0x10,%esp
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 05                	js     801e99 <fd_close+0x30>
+	    || fd != fd2)
+  801e94:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e97:	74 0f                	je     801ea8 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801e99:	85 ff                	test   %edi,%edi
+  801e9b:	0f 44 df             	cmove  %edi,%ebx
+}
+  801e9e:	89 d8                	mov    %ebx,%eax
+  801ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea3:	5b                   	pop    %ebx
+  801ea4:	5e                   	pop    %esi
+  801ea5:	5f                   	pop    %edi
+  801ea6:	5d                   	pop    %ebp
+  801ea7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ea8:	83 ec 08             	sub    $0x8,%esp
+  801eab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801eae:	50                   	push   %eax
+  801eaf:	ff 36                	push   (%esi)
+  801eb1:	e8 40 ff ff ff       	call   801df6 <dev_lookup>
+  801eb6:	89 c3                	mov    %eax,%ebx
+  801eb8:	83 c4 10             	add    $0x10,%esp
+  801ebb:	85 c0                	test   %eax,%eax
+  801ebd:	78 1a                	js     801ed9 <fd_close+0x70>
+		if (dev->dev_close)
+  801ebf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ec2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ec5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	74 0b                	je     801ed9 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801ece:	83 ec 0c             	sub    $0xc,%esp
+  801ed1:	56                   	push   %esi
+  801ed2:	ff d0                	call   *%eax
+  801ed4:	89 c3                	mov    %eax,%ebx
+  801ed6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ed9:	83 ec 08             	sub    $0x8,%esp
+  801edc:	56                   	push   %esi
+  801edd:	6a 00                	push   $0x0
+  801edf:	e8 ef f2 ff ff       	call   8011d3 <sys_page_unmap>
+	return r;
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	eb b5                	jmp    801e9e <fd_close+0x35>
+
+00801ee9 <close>:
+
+int
+close(int fdnum)
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef2:	50                   	push   %eax
+  801ef3:	ff 75 08             	push   0x8(%ebp)
+  801ef6:	e8 a9 fe ff ff       	call   801da4 <fd_lookup>
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	79 02                	jns    801f04 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f02:	c9                   	leave
+  801f03:	c3                   	ret
+		return fd_close(fd, 1);
+  801f04:	83 ec 08             	sub    $0x8,%esp
+  801f07:	6a 01                	push   $0x1
+  801f09:	ff 75 f4             	push   -0xc(%ebp)
+  801f0c:	e8 58 ff ff ff       	call   801e69 <fd_close>
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	eb ec                	jmp    801f02 <close+0x19>
+
+00801f16 <close_all>:
+
+void
+close_all(void)
+{
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+  801f19:	53                   	push   %ebx
+  801f1a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f22:	83 ec 0c             	sub    $0xc,%esp
+  801f25:	53                   	push   %ebx
+  801f26:	e8 be ff ff ff       	call   801ee9 <close>
+	for (i = 0; i < MAXFD; i++)
+  801f2b:	83 c3 01             	add    $0x1,%ebx
+  801f2e:	83 c4 10             	add    $0x10,%esp
+  801f31:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801f37:	75 e9                	jne    801f22 <close_all+0xc>
+}
+  801f39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f3c:	c9                   	leave
+  801f3d:	c3                   	ret
+
+00801f3e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	57                   	push   %edi
+  801f42:	56                   	push   %esi
+  801f43:	53                   	push   %ebx
+  801f44:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801f47:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f4a:	50                   	push   %eax
+  801f4b:	ff 75 08             	push   0x8(%ebp)
+  801f4e:	e8 51 fe ff ff       	call   801da4 <fd_lookup>
+  801f53:	89 c3                	mov    %eax,%ebx
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	78 7f                	js     801fdb <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f5c:	83 ec 0c             	sub    $0xc,%esp
+  801f5f:	ff 75 0c             	push   0xc(%ebp)
+  801f62:	e8 82 ff ff ff       	call   801ee9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801f67:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f6a:	c1 e6 0c             	shl    $0xc,%esi
+  801f6d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801f73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f76:	89 3c 24             	mov    %edi,(%esp)
+  801f79:	e8 bf fd ff ff       	call   801d3d <fd2data>
+  801f7e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801f80:	89 34 24             	mov    %esi,(%esp)
+  801f83:	e8 b5 fd ff ff       	call   801d3d <fd2data>
+  801f88:	83 c4 10             	add    $0x10,%esp
+  801f8b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801f8e:	89 d8                	mov    %ebx,%eax
+  801f90:	c1 e8 16             	shr    $0x16,%eax
+  801f93:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f9a:	a8 01                	test   $0x1,%al
+  801f9c:	74 11                	je     801faf <dup+0x71>
+  801f9e:	89 d8                	mov    %ebx,%eax
+  801fa0:	c1 e8 0c             	shr    $0xc,%eax
+  801fa3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801faa:	f6 c2 01             	test   $0x1,%dl
+  801fad:	75 36                	jne    801fe5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801faf:	89 f8                	mov    %edi,%eax
+  801fb1:	c1 e8 0c             	shr    $0xc,%eax
+  801fb4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fbb:	83 ec 0c             	sub    $0xc,%esp
+  801fbe:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fc3:	50                   	push   %eax
+  801fc4:	56                   	push   %esi
+  801fc5:	6a 00                	push   $0x0
+  801fc7:	57                   	push   %edi
+  801fc8:	6a 00                	push   $0x0
+  801fca:	e8 c2 f1 ff ff       	call   801191 <sys_page_map>
+  801fcf:	89 c3                	mov    %eax,%ebx
+  801fd1:	83 c4 20             	add    $0x20,%esp
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	78 33                	js     80200b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801fd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801fdb:	89 d8                	mov    %ebx,%eax
+  801fdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe0:	5b                   	pop    %ebx
+  801fe1:	5e                   	pop    %esi
+  801fe2:	5f                   	pop    %edi
+  801fe3:	5d                   	pop    %ebp
+  801fe4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801fe5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fec:	83 ec 0c             	sub    $0xc,%esp
+  801fef:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ff4:	50                   	push   %eax
+  801ff5:	ff 75 d4             	push   -0x2c(%ebp)
+  801ff8:	6a 00                	push   $0x0
+  801ffa:	53                   	push   %ebx
+  801ffb:	6a 00                	push   $0x0
+  801ffd:	e8 8f f1 ff ff       	call   801191 <sys_page_map>
+  802002:	89 c3                	mov    %eax,%ebx
+  802004:	83 c4 20             	add    $0x20,%esp
+  802007:	85 c0                	test   %eax,%eax
+  802009:	79 a4                	jns    801faf <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80200b:	83 ec 08             	sub    $0x8,%esp
+  80200e:	56                   	push   %esi
+  80200f:	6a 00                	push   $0x0
+  802011:	e8 bd f1 ff ff       	call   8011d3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802016:	83 c4 08             	add    $0x8,%esp
+  802019:	ff 75 d4             	push   -0x2c(%ebp)
+  80201c:	6a 00                	push   $0x0
+  80201e:	e8 b0 f1 ff ff       	call   8011d3 <sys_page_unmap>
+	return r;
+  802023:	83 c4 10             	add    $0x10,%esp
+  802026:	eb b3                	jmp    801fdb <dup+0x9d>
+
+00802028 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802028:	55                   	push   %ebp
+  802029:	89 e5                	mov    %esp,%ebp
+  80202b:	56                   	push   %esi
+  80202c:	53                   	push   %ebx
+  80202d:	83 ec 18             	sub    $0x18,%esp
+  802030:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802033:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802036:	50                   	push   %eax
+  802037:	53                   	push   %ebx
+  802038:	e8 67 fd ff ff       	call   801da4 <fd_lookup>
+  80203d:	83 c4 10             	add    $0x10,%esp
+  802040:	85 c0                	test   %eax,%eax
+  802042:	78 3c                	js     802080 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802044:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802047:	83 ec 08             	sub    $0x8,%esp
+  80204a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80204d:	50                   	push   %eax
+  80204e:	ff 36                	push   (%esi)
+  802050:	e8 a1 fd ff ff       	call   801df6 <dev_lookup>
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 24                	js     802080 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80205c:	8b 46 08             	mov    0x8(%esi),%eax
+  80205f:	83 e0 03             	and    $0x3,%eax
+  802062:	83 f8 01             	cmp    $0x1,%eax
+  802065:	74 20                	je     802087 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802067:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80206a:	8b 40 08             	mov    0x8(%eax),%eax
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	74 54                	je     8020c5 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802071:	83 ec 04             	sub    $0x4,%esp
+  802074:	ff 75 10             	push   0x10(%ebp)
+  802077:	ff 75 0c             	push   0xc(%ebp)
+  80207a:	56                   	push   %esi
+  80207b:	ff d0                	call   *%eax
+  80207d:	83 c4 10             	add    $0x10,%esp
+}
+  802080:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802083:	5b                   	pop    %ebx
+  802084:	5e                   	pop    %esi
+  802085:	5d                   	pop    %ebp
+  802086:	c3                   	ret
+  802087:	89 e2                	mov    %esp,%edx
+  802089:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80208e:	29 d0                	sub    %edx,%eax
+  802090:	89 c2                	mov    %eax,%edx
+  802092:	c1 ea 0f             	shr    $0xf,%edx
+  802095:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80209a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a2:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  8020a9:	8b 40 48             	mov    0x48(%eax),%eax
+  8020ac:	83 ec 04             	sub    $0x4,%esp
+  8020af:	53                   	push   %ebx
+  8020b0:	50                   	push   %eax
+  8020b1:	68 9d 51 80 00       	push   $0x80519d
+  8020b6:	e8 68 e5 ff ff       	call   800623 <cprintf>
+		return -E_INVAL;
+  8020bb:	83 c4 10             	add    $0x10,%esp
+  8020be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020c3:	eb bb                	jmp    802080 <read+0x58>
+		return -E_NOT_SUPP;
+  8020c5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ca:	eb b4                	jmp    802080 <read+0x58>
+
+008020cc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8020cc:	55                   	push   %ebp
+  8020cd:	89 e5                	mov    %esp,%ebp
+  8020cf:	57                   	push   %edi
+  8020d0:	56                   	push   %esi
+  8020d1:	53                   	push   %ebx
+  8020d2:	83 ec 0c             	sub    $0xc,%esp
+  8020d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8020db:	85 f6                	test   %esi,%esi
+  8020dd:	74 30                	je     80210f <readn+0x43>
+  8020df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020e4:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8020e9:	83 ec 04             	sub    $0x4,%esp
+  8020ec:	89 f2                	mov    %esi,%edx
+  8020ee:	29 c2                	sub    %eax,%edx
+  8020f0:	52                   	push   %edx
+  8020f1:	01 f8                	add    %edi,%eax
+  8020f3:	50                   	push   %eax
+  8020f4:	ff 75 08             	push   0x8(%ebp)
+  8020f7:	e8 2c ff ff ff       	call   802028 <read>
+		if (m < 0)
+  8020fc:	83 c4 10             	add    $0x10,%esp
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	78 15                	js     802118 <readn+0x4c>
+			return m;
+		if (m == 0)
+  802103:	74 11                	je     802116 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802105:	01 c3                	add    %eax,%ebx
+  802107:	89 d8                	mov    %ebx,%eax
+  802109:	39 f3                	cmp    %esi,%ebx
+  80210b:	72 dc                	jb     8020e9 <readn+0x1d>
+  80210d:	eb 09                	jmp    802118 <readn+0x4c>
+  80210f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802114:	eb 02                	jmp    802118 <readn+0x4c>
+  802116:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  802118:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80211b:	5b                   	pop    %ebx
+  80211c:	5e                   	pop    %esi
+  80211d:	5f                   	pop    %edi
+  80211e:	5d                   	pop    %ebp
+  80211f:	c3                   	ret
+
+00802120 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802120:	55                   	push   %ebp
+  802121:	89 e5                	mov    %esp,%ebp
+  802123:	56                   	push   %esi
+  802124:	53                   	push   %ebx
+  802125:	83 ec 18             	sub    $0x18,%esp
+  802128:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80212b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80212e:	50                   	push   %eax
+  80212f:	53                   	push   %ebx
+  802130:	e8 6f fc ff ff       	call   801da4 <fd_lookup>
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	78 37                	js     802173 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80213c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80213f:	83 ec 08             	sub    $0x8,%esp
+  802142:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802145:	50                   	push   %eax
+  802146:	ff 36                	push   (%esi)
+  802148:	e8 a9 fc ff ff       	call   801df6 <dev_lookup>
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	85 c0                	test   %eax,%eax
+  802152:	78 1f                	js     802173 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802154:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802158:	74 20                	je     80217a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80215a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80215d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802160:	85 c0                	test   %eax,%eax
+  802162:	74 54                	je     8021b8 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802164:	83 ec 04             	sub    $0x4,%esp
+  802167:	ff 75 10             	push   0x10(%ebp)
+  80216a:	ff 75 0c             	push   0xc(%ebp)
+  80216d:	56                   	push   %esi
+  80216e:	ff d0                	call   *%eax
+  802170:	83 c4 10             	add    $0x10,%esp
+}
+  802173:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802176:	5b                   	pop    %ebx
+  802177:	5e                   	pop    %esi
+  802178:	5d                   	pop    %ebp
+  802179:	c3                   	ret
+  80217a:	89 e2                	mov    %esp,%edx
+  80217c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802181:	29 d0                	sub    %edx,%eax
+  802183:	89 c2                	mov    %eax,%edx
+  802185:	c1 ea 0f             	shr    $0xf,%edx
+  802188:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80218d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802192:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802195:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  80219c:	8b 40 48             	mov    0x48(%eax),%eax
+  80219f:	83 ec 04             	sub    $0x4,%esp
+  8021a2:	53                   	push   %ebx
+  8021a3:	50                   	push   %eax
+  8021a4:	68 b9 51 80 00       	push   $0x8051b9
+  8021a9:	e8 75 e4 ff ff       	call   800623 <cprintf>
+		return -E_INVAL;
+  8021ae:	83 c4 10             	add    $0x10,%esp
+  8021b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b6:	eb bb                	jmp    802173 <write+0x53>
+		return -E_NOT_SUPP;
+  8021b8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021bd:	eb b4                	jmp    802173 <write+0x53>
+
+008021bf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c8:	50                   	push   %eax
+  8021c9:	ff 75 08             	push   0x8(%ebp)
+  8021cc:	e8 d3 fb ff ff       	call   801da4 <fd_lookup>
+  8021d1:	83 c4 10             	add    $0x10,%esp
+  8021d4:	85 c0                	test   %eax,%eax
+  8021d6:	78 0e                	js     8021e6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8021d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021de:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8021e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+
+008021e8 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+  8021eb:	53                   	push   %ebx
+  8021ec:	83 ec 1c             	sub    $0x1c,%esp
+  8021ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	ff 75 08             	push   0x8(%ebp)
+  8021f9:	e8 a6 fb ff ff       	call   801da4 <fd_lookup>
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 33                	js     802238 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802205:	83 fb 03             	cmp    $0x3,%ebx
+  802208:	74 28                	je     802232 <fcntl+0x4a>
+  80220a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80220f:	83 fb 04             	cmp    $0x4,%ebx
+  802212:	75 24                	jne    802238 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802214:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802217:	8b 41 08             	mov    0x8(%ecx),%eax
+  80221a:	80 e4 ef             	and    $0xef,%ah
+  80221d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802220:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802226:	09 d0                	or     %edx,%eax
+  802228:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80222b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802230:	eb 06                	jmp    802238 <fcntl+0x50>
+		return fd->fd_omode;
+  802232:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802235:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223b:	c9                   	leave
+  80223c:	c3                   	ret
+
+0080223d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80223d:	55                   	push   %ebp
+  80223e:	89 e5                	mov    %esp,%ebp
+  802240:	56                   	push   %esi
+  802241:	53                   	push   %ebx
+  802242:	83 ec 18             	sub    $0x18,%esp
+  802245:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802248:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80224b:	50                   	push   %eax
+  80224c:	53                   	push   %ebx
+  80224d:	e8 52 fb ff ff       	call   801da4 <fd_lookup>
+  802252:	83 c4 10             	add    $0x10,%esp
+  802255:	85 c0                	test   %eax,%eax
+  802257:	78 34                	js     80228d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802259:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80225c:	83 ec 08             	sub    $0x8,%esp
+  80225f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802262:	50                   	push   %eax
+  802263:	ff 36                	push   (%esi)
+  802265:	e8 8c fb ff ff       	call   801df6 <dev_lookup>
+  80226a:	83 c4 10             	add    $0x10,%esp
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	78 1c                	js     80228d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802271:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802275:	74 1d                	je     802294 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802277:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80227a:	8b 40 18             	mov    0x18(%eax),%eax
+  80227d:	85 c0                	test   %eax,%eax
+  80227f:	74 51                	je     8022d2 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802281:	83 ec 08             	sub    $0x8,%esp
+  802284:	ff 75 0c             	push   0xc(%ebp)
+  802287:	56                   	push   %esi
+  802288:	ff d0                	call   *%eax
+  80228a:	83 c4 10             	add    $0x10,%esp
+}
+  80228d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802290:	5b                   	pop    %ebx
+  802291:	5e                   	pop    %esi
+  802292:	5d                   	pop    %ebp
+  802293:	c3                   	ret
+  802294:	89 e2                	mov    %esp,%edx
+  802296:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80229b:	29 d0                	sub    %edx,%eax
+  80229d:	89 c2                	mov    %eax,%edx
+  80229f:	c1 ea 0f             	shr    $0xf,%edx
+  8022a2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8022a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ac:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8022af:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  8022b6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022b9:	83 ec 04             	sub    $0x4,%esp
+  8022bc:	53                   	push   %ebx
+  8022bd:	50                   	push   %eax
+  8022be:	68 7c 51 80 00       	push   $0x80517c
+  8022c3:	e8 5b e3 ff ff       	call   800623 <cprintf>
+		return -E_INVAL;
+  8022c8:	83 c4 10             	add    $0x10,%esp
+  8022cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022d0:	eb bb                	jmp    80228d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8022d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022d7:	eb b4                	jmp    80228d <ftruncate+0x50>
+
+008022d9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8022d9:	55                   	push   %ebp
+  8022da:	89 e5                	mov    %esp,%ebp
+  8022dc:	56                   	push   %esi
+  8022dd:	53                   	push   %ebx
+  8022de:	83 ec 18             	sub    $0x18,%esp
+  8022e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022e7:	50                   	push   %eax
+  8022e8:	ff 75 08             	push   0x8(%ebp)
+  8022eb:	e8 b4 fa ff ff       	call   801da4 <fd_lookup>
+  8022f0:	83 c4 10             	add    $0x10,%esp
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	78 53                	js     80234a <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022f7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022fa:	83 ec 08             	sub    $0x8,%esp
+  8022fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802300:	50                   	push   %eax
+  802301:	ff 36                	push   (%esi)
+  802303:	e8 ee fa ff ff       	call   801df6 <dev_lookup>
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	78 3b                	js     80234a <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80230f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802312:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802316:	74 39                	je     802351 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802318:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80231b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802322:	00 00 00 
+	stat->st_isdir = 0;
+  802325:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80232c:	00 00 00 
+	stat->st_version = 0;
+  80232f:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802336:	00 00 00 
+	stat->st_dev = dev;
+  802339:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80233f:	83 ec 08             	sub    $0x8,%esp
+  802342:	53                   	push   %ebx
+  802343:	56                   	push   %esi
+  802344:	ff 50 14             	call   *0x14(%eax)
+  802347:	83 c4 10             	add    $0x10,%esp
+}
+  80234a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80234d:	5b                   	pop    %ebx
+  80234e:	5e                   	pop    %esi
+  80234f:	5d                   	pop    %ebp
+  802350:	c3                   	ret
+		return -E_NOT_SUPP;
+  802351:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802356:	eb f2                	jmp    80234a <fstat+0x71>
+
+00802358 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	56                   	push   %esi
+  80235c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80235d:	83 ec 08             	sub    $0x8,%esp
+  802360:	6a 00                	push   $0x0
+  802362:	ff 75 08             	push   0x8(%ebp)
+  802365:	e8 b7 01 00 00       	call   802521 <open>
+  80236a:	89 c3                	mov    %eax,%ebx
+  80236c:	83 c4 10             	add    $0x10,%esp
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	78 1b                	js     80238e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802373:	83 ec 08             	sub    $0x8,%esp
+  802376:	ff 75 0c             	push   0xc(%ebp)
+  802379:	50                   	push   %eax
+  80237a:	e8 5a ff ff ff       	call   8022d9 <fstat>
+  80237f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802381:	89 1c 24             	mov    %ebx,(%esp)
+  802384:	e8 60 fb ff ff       	call   801ee9 <close>
+	return r;
+  802389:	83 c4 10             	add    $0x10,%esp
+  80238c:	89 f3                	mov    %esi,%ebx
+}
+  80238e:	89 d8                	mov    %ebx,%eax
+  802390:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802393:	5b                   	pop    %ebx
+  802394:	5e                   	pop    %esi
+  802395:	5d                   	pop    %ebp
+  802396:	c3                   	ret
+
+00802397 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802397:	55                   	push   %ebp
+  802398:	89 e5                	mov    %esp,%ebp
+  80239a:	56                   	push   %esi
+  80239b:	53                   	push   %ebx
+  80239c:	89 c6                	mov    %eax,%esi
+  80239e:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8023a0:	83 3d c4 7e 80 00 00 	cmpl   $0x0,0x807ec4
+  8023a7:	74 27                	je     8023d0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8023a9:	6a 07                	push   $0x7
+  8023ab:	68 00 90 80 00       	push   $0x809000
+  8023b0:	56                   	push   %esi
+  8023b1:	ff 35 c4 7e 80 00    	push   0x807ec4
+  8023b7:	e8 c0 21 00 00       	call   80457c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8023bc:	83 c4 0c             	add    $0xc,%esp
+  8023bf:	6a 00                	push   $0x0
+  8023c1:	53                   	push   %ebx
+  8023c2:	6a 00                	push   $0x0
+  8023c4:	e8 23 1f 00 00       	call   8042ec <ipc_recv>
+}
+  8023c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023cc:	5b                   	pop    %ebx
+  8023cd:	5e                   	pop    %esi
+  8023ce:	5d                   	pop    %ebp
+  8023cf:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023d0:	83 ec 0c             	sub    $0xc,%esp
+  8023d3:	6a 02                	push   $0x2
+  8023d5:	e8 0b 22 00 00       	call   8045e5 <ipc_find_env>
+  8023da:	a3 c4 7e 80 00       	mov    %eax,0x807ec4
+  8023df:	83 c4 10             	add    $0x10,%esp
+  8023e2:	eb c5                	jmp    8023a9 <fsipc+0x12>
+
+008023e4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8023e4:	55                   	push   %ebp
+  8023e5:	89 e5                	mov    %esp,%ebp
+  8023e7:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023f0:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  8023f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f8:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8023fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802402:	b8 02 00 00 00       	mov    $0x2,%eax
+  802407:	e8 8b ff ff ff       	call   802397 <fsipc>
+}
+  80240c:	c9                   	leave
+  80240d:	c3                   	ret
+
+0080240e <devfile_flush>:
+{
+  80240e:	55                   	push   %ebp
+  80240f:	89 e5                	mov    %esp,%ebp
+  802411:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802414:	8b 45 08             	mov    0x8(%ebp),%eax
+  802417:	8b 40 0c             	mov    0xc(%eax),%eax
+  80241a:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80241f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802424:	b8 06 00 00 00       	mov    $0x6,%eax
+  802429:	e8 69 ff ff ff       	call   802397 <fsipc>
+}
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+
+00802430 <devfile_stat>:
+{
+  802430:	55                   	push   %ebp
+  802431:	89 e5                	mov    %esp,%ebp
+  802433:	53                   	push   %ebx
+  802434:	83 ec 04             	sub    $0x4,%esp
+  802437:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80243a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802440:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802445:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80244f:	e8 43 ff ff ff       	call   802397 <fsipc>
+  802454:	85 c0                	test   %eax,%eax
+  802456:	78 37                	js     80248f <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802458:	83 ec 08             	sub    $0x8,%esp
+  80245b:	68 00 90 80 00       	push   $0x809000
+  802460:	53                   	push   %ebx
+  802461:	e8 b4 e8 ff ff       	call   800d1a <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802466:	a1 80 90 80 00       	mov    0x809080,%eax
+  80246b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802471:	a1 84 90 80 00       	mov    0x809084,%eax
+  802476:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80247c:	a1 88 90 80 00       	mov    0x809088,%eax
+  802481:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802487:	83 c4 10             	add    $0x10,%esp
+  80248a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80248f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802492:	c9                   	leave
+  802493:	c3                   	ret
+
+00802494 <devfile_write>:
+{
+  802494:	55                   	push   %ebp
+  802495:	89 e5                	mov    %esp,%ebp
+  802497:	83 ec 0c             	sub    $0xc,%esp
+  80249a:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80249d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8024a2:	39 d0                	cmp    %edx,%eax
+  8024a4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024aa:	8b 52 0c             	mov    0xc(%edx),%edx
+  8024ad:	89 15 00 90 80 00    	mov    %edx,0x809000
+	fsipcbuf.write.req_n = count;
+  8024b3:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8024b8:	50                   	push   %eax
+  8024b9:	ff 75 0c             	push   0xc(%ebp)
+  8024bc:	68 08 90 80 00       	push   $0x809008
+  8024c1:	e8 04 ea ff ff       	call   800eca <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8024c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024cb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024d0:	e8 c2 fe ff ff       	call   802397 <fsipc>
+}
+  8024d5:	c9                   	leave
+  8024d6:	c3                   	ret
+
+008024d7 <devfile_read>:
+{
+  8024d7:	55                   	push   %ebp
+  8024d8:	89 e5                	mov    %esp,%ebp
+  8024da:	53                   	push   %ebx
+  8024db:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024e4:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  8024e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024ec:	a3 04 90 80 00       	mov    %eax,0x809004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8024f1:	ba 00 90 80 00       	mov    $0x809000,%edx
+  8024f6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024fb:	e8 97 fe ff ff       	call   802397 <fsipc>
+  802500:	89 c3                	mov    %eax,%ebx
+  802502:	85 c0                	test   %eax,%eax
+  802504:	78 14                	js     80251a <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802506:	83 ec 04             	sub    $0x4,%esp
+  802509:	50                   	push   %eax
+  80250a:	68 00 90 80 00       	push   $0x809000
+  80250f:	ff 75 0c             	push   0xc(%ebp)
+  802512:	e8 b3 e9 ff ff       	call   800eca <memmove>
+	return r;
+  802517:	83 c4 10             	add    $0x10,%esp
+}
+  80251a:	89 d8                	mov    %ebx,%eax
+  80251c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80251f:	c9                   	leave
+  802520:	c3                   	ret
+
+00802521 <open>:
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	53                   	push   %ebx
+  802525:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802528:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80252b:	50                   	push   %eax
+  80252c:	e8 23 f8 ff ff       	call   801d54 <fd_alloc>
+  802531:	89 c3                	mov    %eax,%ebx
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	85 c0                	test   %eax,%eax
+  802538:	78 2a                	js     802564 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80253a:	83 ec 0c             	sub    $0xc,%esp
+  80253d:	ff 75 08             	push   0x8(%ebp)
+  802540:	e8 89 e7 ff ff       	call   800cce <strlen>
+  802545:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802548:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80254d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802552:	7e 17                	jle    80256b <open+0x4a>
+	fd_close(fd, 1);
+  802554:	83 ec 08             	sub    $0x8,%esp
+  802557:	6a 01                	push   $0x1
+  802559:	ff 75 f4             	push   -0xc(%ebp)
+  80255c:	e8 08 f9 ff ff       	call   801e69 <fd_close>
+	return r;
+  802561:	83 c4 10             	add    $0x10,%esp
+}
+  802564:	89 d8                	mov    %ebx,%eax
+  802566:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802569:	c9                   	leave
+  80256a:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80256b:	83 ec 08             	sub    $0x8,%esp
+  80256e:	ff 75 08             	push   0x8(%ebp)
+  802571:	68 00 90 80 00       	push   $0x809000
+  802576:	e8 9f e7 ff ff       	call   800d1a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80257b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80257e:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802583:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802586:	b8 01 00 00 00       	mov    $0x1,%eax
+  80258b:	e8 07 fe ff ff       	call   802397 <fsipc>
+  802590:	89 c3                	mov    %eax,%ebx
+  802592:	83 c4 10             	add    $0x10,%esp
+  802595:	85 c0                	test   %eax,%eax
+  802597:	78 bb                	js     802554 <open+0x33>
+	return fd2num(fd); 	
+  802599:	83 ec 0c             	sub    $0xc,%esp
+  80259c:	ff 75 f4             	push   -0xc(%ebp)
+  80259f:	e8 89 f7 ff ff       	call   801d2d <fd2num>
+  8025a4:	89 c3                	mov    %eax,%ebx
+  8025a6:	83 c4 10             	add    $0x10,%esp
+  8025a9:	eb b9                	jmp    802564 <open+0x43>
+
+008025ab <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	53                   	push   %ebx
+  8025af:	83 ec 1c             	sub    $0x1c,%esp
+  8025b2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b8:	50                   	push   %eax
+  8025b9:	ff 75 08             	push   0x8(%ebp)
+  8025bc:	e8 e3 f7 ff ff       	call   801da4 <fd_lookup>
+  8025c1:	83 c4 10             	add    $0x10,%esp
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	78 5a                	js     802622 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8025c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025cb:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  8025d1:	39 10                	cmp    %edx,(%eax)
+  8025d3:	75 66                	jne    80263b <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8025d5:	83 3d c4 7e 80 00 00 	cmpl   $0x0,0x807ec4
+  8025dc:	74 49                	je     802627 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8025de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025e4:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.map.req_offset = offset;
+  8025e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ec:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.map.req_npages = maxpages;
+  8025f1:	89 1d 08 90 80 00    	mov    %ebx,0x809008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8025f7:	6a 07                	push   $0x7
+  8025f9:	68 00 90 80 00       	push   $0x809000
+  8025fe:	6a 09                	push   $0x9
+  802600:	ff 35 c4 7e 80 00    	push   0x807ec4
+  802606:	e8 71 1f 00 00       	call   80457c <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80260b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802612:	6a 00                	push   $0x0
+  802614:	53                   	push   %ebx
+  802615:	ff 75 10             	push   0x10(%ebp)
+  802618:	6a 00                	push   $0x0
+  80261a:	e8 9a 1d 00 00       	call   8043b9 <ipc_recv_pages>
+  80261f:	83 c4 20             	add    $0x20,%esp
+}
+  802622:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802625:	c9                   	leave
+  802626:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802627:	83 ec 0c             	sub    $0xc,%esp
+  80262a:	6a 02                	push   $0x2
+  80262c:	e8 b4 1f 00 00       	call   8045e5 <ipc_find_env>
+  802631:	a3 c4 7e 80 00       	mov    %eax,0x807ec4
+  802636:	83 c4 10             	add    $0x10,%esp
+  802639:	eb a3                	jmp    8025de <fmap+0x33>
+		return -E_INVAL;
+  80263b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802640:	eb e0                	jmp    802622 <fmap+0x77>
+
+00802642 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802642:	55                   	push   %ebp
+  802643:	89 e5                	mov    %esp,%ebp
+  802645:	53                   	push   %ebx
+  802646:	83 ec 10             	sub    $0x10,%esp
+  802649:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80264c:	53                   	push   %ebx
+  80264d:	e8 7c e6 ff ff       	call   800cce <strlen>
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80265a:	7f 25                	jg     802681 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80265c:	83 ec 08             	sub    $0x8,%esp
+  80265f:	53                   	push   %ebx
+  802660:	68 00 90 80 00       	push   $0x809000
+  802665:	e8 b0 e6 ff ff       	call   800d1a <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80266a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802674:	e8 1e fd ff ff       	call   802397 <fsipc>
+  802679:	83 c4 10             	add    $0x10,%esp
+}
+  80267c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80267f:	c9                   	leave
+  802680:	c3                   	ret
+		return -E_BAD_PATH;
+  802681:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802686:	eb f4                	jmp    80267c <remove+0x3a>
+
+00802688 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802688:	55                   	push   %ebp
+  802689:	89 e5                	mov    %esp,%ebp
+  80268b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80268e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802693:	b8 08 00 00 00       	mov    $0x8,%eax
+  802698:	e8 fa fc ff ff       	call   802397 <fsipc>
+}
+  80269d:	c9                   	leave
+  80269e:	c3                   	ret
+
+0080269f <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80269f:	55                   	push   %ebp
+  8026a0:	89 e5                	mov    %esp,%ebp
+  8026a2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026a5:	68 ec 51 80 00       	push   $0x8051ec
+  8026aa:	ff 75 0c             	push   0xc(%ebp)
+  8026ad:	e8 68 e6 ff ff       	call   800d1a <strcpy>
+	return 0;
+}
+  8026b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b7:	c9                   	leave
+  8026b8:	c3                   	ret
+
+008026b9 <devsock_close>:
+{
+  8026b9:	55                   	push   %ebp
+  8026ba:	89 e5                	mov    %esp,%ebp
+  8026bc:	53                   	push   %ebx
+  8026bd:	83 ec 10             	sub    $0x10,%esp
+  8026c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026c3:	53                   	push   %ebx
+  8026c4:	e8 5b 1f 00 00       	call   804624 <pageref>
+  8026c9:	89 c2                	mov    %eax,%edx
+  8026cb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026ce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8026d3:	83 fa 01             	cmp    $0x1,%edx
+  8026d6:	74 05                	je     8026dd <devsock_close+0x24>
+}
+  8026d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026db:	c9                   	leave
+  8026dc:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8026dd:	83 ec 0c             	sub    $0xc,%esp
+  8026e0:	ff 73 0c             	push   0xc(%ebx)
+  8026e3:	e8 b0 05 00 00       	call   802c98 <nsipc_close>
+  8026e8:	83 c4 10             	add    $0x10,%esp
+  8026eb:	eb eb                	jmp    8026d8 <devsock_close+0x1f>
+
+008026ed <devsock_write>:
+{
+  8026ed:	55                   	push   %ebp
+  8026ee:	89 e5                	mov    %esp,%ebp
+  8026f0:	53                   	push   %ebx
+  8026f1:	83 ec 14             	sub    $0x14,%esp
+  8026f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026fa:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8026fd:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802700:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802703:	8b 41 08             	mov    0x8(%ecx),%eax
+  802706:	c1 f8 09             	sar    $0x9,%eax
+  802709:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80270c:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802712:	77 13                	ja     802727 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802714:	50                   	push   %eax
+  802715:	52                   	push   %edx
+  802716:	53                   	push   %ebx
+  802717:	ff 71 0c             	push   0xc(%ecx)
+  80271a:	e8 5c 06 00 00       	call   802d7b <nsipc_send>
+  80271f:	83 c4 10             	add    $0x10,%esp
+}
+  802722:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802725:	c9                   	leave
+  802726:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802727:	50                   	push   %eax
+  802728:	6a 01                	push   $0x1
+  80272a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80272d:	50                   	push   %eax
+  80272e:	ff 71 0c             	push   0xc(%ecx)
+  802731:	e8 a6 06 00 00       	call   802ddc <nsipc_sendmsg>
+  802736:	83 c4 10             	add    $0x10,%esp
+  802739:	eb e7                	jmp    802722 <devsock_write+0x35>
+
+0080273b <devsock_read>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	53                   	push   %ebx
+  80273f:	83 ec 14             	sub    $0x14,%esp
+  802742:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802745:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802748:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80274b:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80274e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802751:	8b 41 08             	mov    0x8(%ecx),%eax
+  802754:	c1 f8 09             	sar    $0x9,%eax
+  802757:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80275a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802760:	77 13                	ja     802775 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802762:	50                   	push   %eax
+  802763:	52                   	push   %edx
+  802764:	53                   	push   %ebx
+  802765:	ff 71 0c             	push   0xc(%ecx)
+  802768:	e8 9c 05 00 00       	call   802d09 <nsipc_recv>
+  80276d:	83 c4 10             	add    $0x10,%esp
+}
+  802770:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802773:	c9                   	leave
+  802774:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802775:	50                   	push   %eax
+  802776:	6a 01                	push   $0x1
+  802778:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80277b:	50                   	push   %eax
+  80277c:	ff 71 0c             	push   0xc(%ecx)
+  80277f:	e8 02 0a 00 00       	call   803186 <nsipc_recvmsg>
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	eb e7                	jmp    802770 <devsock_read+0x35>
+
+00802789 <fd2sockid>:
+{
+  802789:	55                   	push   %ebp
+  80278a:	89 e5                	mov    %esp,%ebp
+  80278c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80278f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802792:	52                   	push   %edx
+  802793:	50                   	push   %eax
+  802794:	e8 0b f6 ff ff       	call   801da4 <fd_lookup>
+  802799:	83 c4 10             	add    $0x10,%esp
+  80279c:	85 c0                	test   %eax,%eax
+  80279e:	78 10                	js     8027b0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a3:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  8027a9:	39 08                	cmp    %ecx,(%eax)
+  8027ab:	75 05                	jne    8027b2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027ad:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027b0:	c9                   	leave
+  8027b1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027b7:	eb f7                	jmp    8027b0 <fd2sockid+0x27>
+
+008027b9 <sock_flags>:
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8027bf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027c2:	52                   	push   %edx
+  8027c3:	50                   	push   %eax
+  8027c4:	e8 db f5 ff ff       	call   801da4 <fd_lookup>
+  8027c9:	83 c4 10             	add    $0x10,%esp
+  8027cc:	85 c0                	test   %eax,%eax
+  8027ce:	78 0e                	js     8027de <sock_flags+0x25>
+  8027d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d3:	8b 40 08             	mov    0x8(%eax),%eax
+  8027d6:	c1 e8 09             	shr    $0x9,%eax
+  8027d9:	83 e0 08             	and    $0x8,%eax
+}
+  8027dc:	c9                   	leave
+  8027dd:	c3                   	ret
+		return 0;
+  8027de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e3:	eb f7                	jmp    8027dc <sock_flags+0x23>
+
+008027e5 <alloc_sockfd>:
+{
+  8027e5:	55                   	push   %ebp
+  8027e6:	89 e5                	mov    %esp,%ebp
+  8027e8:	56                   	push   %esi
+  8027e9:	53                   	push   %ebx
+  8027ea:	83 ec 1c             	sub    $0x1c,%esp
+  8027ed:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8027ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027f2:	50                   	push   %eax
+  8027f3:	e8 5c f5 ff ff       	call   801d54 <fd_alloc>
+  8027f8:	89 c3                	mov    %eax,%ebx
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	78 43                	js     802844 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802801:	83 ec 04             	sub    $0x4,%esp
+  802804:	68 07 04 00 00       	push   $0x407
+  802809:	ff 75 f4             	push   -0xc(%ebp)
+  80280c:	6a 00                	push   $0x0
+  80280e:	e8 3b e9 ff ff       	call   80114e <sys_page_alloc>
+  802813:	89 c3                	mov    %eax,%ebx
+  802815:	83 c4 10             	add    $0x10,%esp
+  802818:	85 c0                	test   %eax,%eax
+  80281a:	78 28                	js     802844 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80281c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281f:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  802825:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802827:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80282a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802831:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802834:	83 ec 0c             	sub    $0xc,%esp
+  802837:	50                   	push   %eax
+  802838:	e8 f0 f4 ff ff       	call   801d2d <fd2num>
+  80283d:	89 c3                	mov    %eax,%ebx
+  80283f:	83 c4 10             	add    $0x10,%esp
+  802842:	eb 0c                	jmp    802850 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802844:	83 ec 0c             	sub    $0xc,%esp
+  802847:	56                   	push   %esi
+  802848:	e8 4b 04 00 00       	call   802c98 <nsipc_close>
+		return r;
+  80284d:	83 c4 10             	add    $0x10,%esp
+}
+  802850:	89 d8                	mov    %ebx,%eax
+  802852:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802855:	5b                   	pop    %ebx
+  802856:	5e                   	pop    %esi
+  802857:	5d                   	pop    %ebp
+  802858:	c3                   	ret
+
+00802859 <accept>:
+{
+  802859:	55                   	push   %ebp
+  80285a:	89 e5                	mov    %esp,%ebp
+  80285c:	56                   	push   %esi
+  80285d:	53                   	push   %ebx
+  80285e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802861:	89 f0                	mov    %esi,%eax
+  802863:	e8 21 ff ff ff       	call   802789 <fd2sockid>
+  802868:	89 c3                	mov    %eax,%ebx
+  80286a:	85 c0                	test   %eax,%eax
+  80286c:	78 24                	js     802892 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80286e:	89 f0                	mov    %esi,%eax
+  802870:	e8 44 ff ff ff       	call   8027b9 <sock_flags>
+  802875:	50                   	push   %eax
+  802876:	ff 75 10             	push   0x10(%ebp)
+  802879:	ff 75 0c             	push   0xc(%ebp)
+  80287c:	53                   	push   %ebx
+  80287d:	e8 6b 03 00 00       	call   802bed <nsipc_accept>
+  802882:	89 c3                	mov    %eax,%ebx
+  802884:	83 c4 10             	add    $0x10,%esp
+  802887:	85 c0                	test   %eax,%eax
+  802889:	78 07                	js     802892 <accept+0x39>
+	return alloc_sockfd(r);
+  80288b:	e8 55 ff ff ff       	call   8027e5 <alloc_sockfd>
+  802890:	89 c3                	mov    %eax,%ebx
+}
+  802892:	89 d8                	mov    %ebx,%eax
+  802894:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802897:	5b                   	pop    %ebx
+  802898:	5e                   	pop    %esi
+  802899:	5d                   	pop    %ebp
+  80289a:	c3                   	ret
+
+0080289b <bind>:
+{
+  80289b:	55                   	push   %ebp
+  80289c:	89 e5                	mov    %esp,%ebp
+  80289e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a4:	e8 e0 fe ff ff       	call   802789 <fd2sockid>
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	78 12                	js     8028bf <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028ad:	83 ec 04             	sub    $0x4,%esp
+  8028b0:	ff 75 10             	push   0x10(%ebp)
+  8028b3:	ff 75 0c             	push   0xc(%ebp)
+  8028b6:	50                   	push   %eax
+  8028b7:	e8 85 03 00 00       	call   802c41 <nsipc_bind>
+  8028bc:	83 c4 10             	add    $0x10,%esp
+}
+  8028bf:	c9                   	leave
+  8028c0:	c3                   	ret
+
+008028c1 <shutdown>:
+{
+  8028c1:	55                   	push   %ebp
+  8028c2:	89 e5                	mov    %esp,%ebp
+  8028c4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ca:	e8 ba fe ff ff       	call   802789 <fd2sockid>
+  8028cf:	85 c0                	test   %eax,%eax
+  8028d1:	78 0f                	js     8028e2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028d3:	83 ec 08             	sub    $0x8,%esp
+  8028d6:	ff 75 0c             	push   0xc(%ebp)
+  8028d9:	50                   	push   %eax
+  8028da:	e8 97 03 00 00       	call   802c76 <nsipc_shutdown>
+  8028df:	83 c4 10             	add    $0x10,%esp
+}
+  8028e2:	c9                   	leave
+  8028e3:	c3                   	ret
+
+008028e4 <connect>:
+{
+  8028e4:	55                   	push   %ebp
+  8028e5:	89 e5                	mov    %esp,%ebp
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ed:	e8 97 fe ff ff       	call   802789 <fd2sockid>
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	78 12                	js     802908 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028f6:	83 ec 04             	sub    $0x4,%esp
+  8028f9:	ff 75 10             	push   0x10(%ebp)
+  8028fc:	ff 75 0c             	push   0xc(%ebp)
+  8028ff:	50                   	push   %eax
+  802900:	e8 ad 03 00 00       	call   802cb2 <nsipc_connect>
+  802905:	83 c4 10             	add    $0x10,%esp
+}
+  802908:	c9                   	leave
+  802909:	c3                   	ret
+
+0080290a <listen>:
+{
+  80290a:	55                   	push   %ebp
+  80290b:	89 e5                	mov    %esp,%ebp
+  80290d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802910:	8b 45 08             	mov    0x8(%ebp),%eax
+  802913:	e8 71 fe ff ff       	call   802789 <fd2sockid>
+  802918:	85 c0                	test   %eax,%eax
+  80291a:	78 0f                	js     80292b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80291c:	83 ec 08             	sub    $0x8,%esp
+  80291f:	ff 75 0c             	push   0xc(%ebp)
+  802922:	50                   	push   %eax
+  802923:	e8 bf 03 00 00       	call   802ce7 <nsipc_listen>
+  802928:	83 c4 10             	add    $0x10,%esp
+}
+  80292b:	c9                   	leave
+  80292c:	c3                   	ret
+
+0080292d <sendmsg>:
+{
+  80292d:	55                   	push   %ebp
+  80292e:	89 e5                	mov    %esp,%ebp
+  802930:	57                   	push   %edi
+  802931:	56                   	push   %esi
+  802932:	53                   	push   %ebx
+  802933:	83 ec 0c             	sub    $0xc,%esp
+  802936:	8b 75 08             	mov    0x8(%ebp),%esi
+  802939:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80293c:	89 f0                	mov    %esi,%eax
+  80293e:	e8 46 fe ff ff       	call   802789 <fd2sockid>
+  802943:	89 c3                	mov    %eax,%ebx
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 1c                	js     802965 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802949:	89 f0                	mov    %esi,%eax
+  80294b:	e8 69 fe ff ff       	call   8027b9 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802950:	0b 45 10             	or     0x10(%ebp),%eax
+  802953:	50                   	push   %eax
+  802954:	ff 77 0c             	push   0xc(%edi)
+  802957:	ff 77 08             	push   0x8(%edi)
+  80295a:	53                   	push   %ebx
+  80295b:	e8 7c 04 00 00       	call   802ddc <nsipc_sendmsg>
+  802960:	89 c3                	mov    %eax,%ebx
+  802962:	83 c4 10             	add    $0x10,%esp
+}
+  802965:	89 d8                	mov    %ebx,%eax
+  802967:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80296a:	5b                   	pop    %ebx
+  80296b:	5e                   	pop    %esi
+  80296c:	5f                   	pop    %edi
+  80296d:	5d                   	pop    %ebp
+  80296e:	c3                   	ret
+
+0080296f <recvmsg>:
+{
+  80296f:	55                   	push   %ebp
+  802970:	89 e5                	mov    %esp,%ebp
+  802972:	57                   	push   %edi
+  802973:	56                   	push   %esi
+  802974:	53                   	push   %ebx
+  802975:	83 ec 0c             	sub    $0xc,%esp
+  802978:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80297b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80297e:	89 f8                	mov    %edi,%eax
+  802980:	e8 04 fe ff ff       	call   802789 <fd2sockid>
+  802985:	89 c3                	mov    %eax,%ebx
+  802987:	85 c0                	test   %eax,%eax
+  802989:	78 2a                	js     8029b5 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80298b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802992:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802999:	89 f8                	mov    %edi,%eax
+  80299b:	e8 19 fe ff ff       	call   8027b9 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8029a0:	0b 45 10             	or     0x10(%ebp),%eax
+  8029a3:	50                   	push   %eax
+  8029a4:	ff 76 0c             	push   0xc(%esi)
+  8029a7:	ff 76 08             	push   0x8(%esi)
+  8029aa:	53                   	push   %ebx
+  8029ab:	e8 d6 07 00 00       	call   803186 <nsipc_recvmsg>
+  8029b0:	89 c3                	mov    %eax,%ebx
+  8029b2:	83 c4 10             	add    $0x10,%esp
+}
+  8029b5:	89 d8                	mov    %ebx,%eax
+  8029b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029ba:	5b                   	pop    %ebx
+  8029bb:	5e                   	pop    %esi
+  8029bc:	5f                   	pop    %edi
+  8029bd:	5d                   	pop    %ebp
+  8029be:	c3                   	ret
+
+008029bf <sendfile>:
+{
+  8029bf:	55                   	push   %ebp
+  8029c0:	89 e5                	mov    %esp,%ebp
+  8029c2:	56                   	push   %esi
+  8029c3:	53                   	push   %ebx
+  8029c4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8029c7:	89 f0                	mov    %esi,%eax
+  8029c9:	e8 bb fd ff ff       	call   802789 <fd2sockid>
+  8029ce:	89 c3                	mov    %eax,%ebx
+  8029d0:	85 c0                	test   %eax,%eax
+  8029d2:	78 1f                	js     8029f3 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8029d4:	89 f0                	mov    %esi,%eax
+  8029d6:	e8 de fd ff ff       	call   8027b9 <sock_flags>
+  8029db:	83 ec 0c             	sub    $0xc,%esp
+  8029de:	50                   	push   %eax
+  8029df:	ff 75 14             	push   0x14(%ebp)
+  8029e2:	ff 75 10             	push   0x10(%ebp)
+  8029e5:	ff 75 0c             	push   0xc(%ebp)
+  8029e8:	53                   	push   %ebx
+  8029e9:	e8 64 06 00 00       	call   803052 <nsipc_sendfile>
+  8029ee:	89 c3                	mov    %eax,%ebx
+  8029f0:	83 c4 20             	add    $0x20,%esp
+}
+  8029f3:	89 d8                	mov    %ebx,%eax
+  8029f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029f8:	5b                   	pop    %ebx
+  8029f9:	5e                   	pop    %esi
+  8029fa:	5d                   	pop    %ebp
+  8029fb:	c3                   	ret
+
+008029fc <evctl>:
+{
+  8029fc:	55                   	push   %ebp
+  8029fd:	89 e5                	mov    %esp,%ebp
+  8029ff:	53                   	push   %ebx
+  802a00:	83 ec 04             	sub    $0x4,%esp
+  802a03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802a06:	89 d8                	mov    %ebx,%eax
+  802a08:	e8 7c fd ff ff       	call   802789 <fd2sockid>
+  802a0d:	85 c0                	test   %eax,%eax
+  802a0f:	78 10                	js     802a21 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802a11:	83 ec 04             	sub    $0x4,%esp
+  802a14:	53                   	push   %ebx
+  802a15:	ff 75 0c             	push   0xc(%ebp)
+  802a18:	50                   	push   %eax
+  802a19:	e8 d2 0b 00 00       	call   8035f0 <nsipc_evctl>
+  802a1e:	83 c4 10             	add    $0x10,%esp
+}
+  802a21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+00802a26 <evwait>:
+{
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802a2c:	ff 75 10             	push   0x10(%ebp)
+  802a2f:	ff 75 0c             	push   0xc(%ebp)
+  802a32:	ff 75 08             	push   0x8(%ebp)
+  802a35:	e8 e0 0b 00 00       	call   80361a <nsipc_evwait>
+}
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+00802a3c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a42:	ff 75 10             	push   0x10(%ebp)
+  802a45:	ff 75 0c             	push   0xc(%ebp)
+  802a48:	ff 75 08             	push   0x8(%ebp)
+  802a4b:	e8 31 0c 00 00       	call   803681 <nsipc_socket>
+  802a50:	83 c4 10             	add    $0x10,%esp
+  802a53:	85 c0                	test   %eax,%eax
+  802a55:	78 05                	js     802a5c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a57:	e8 89 fd ff ff       	call   8027e5 <alloc_sockfd>
+}
+  802a5c:	c9                   	leave
+  802a5d:	c3                   	ret
+
+00802a5e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	53                   	push   %ebx
+  802a62:	83 ec 04             	sub    $0x4,%esp
+  802a65:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802a67:	83 3d e4 81 80 00 00 	cmpl   $0x0,0x8081e4
+  802a6e:	74 26                	je     802a96 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a70:	6a 07                	push   $0x7
+  802a72:	68 00 a0 80 00       	push   $0x80a000
+  802a77:	53                   	push   %ebx
+  802a78:	ff 35 e4 81 80 00    	push   0x8081e4
+  802a7e:	e8 f9 1a 00 00       	call   80457c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a83:	83 c4 0c             	add    $0xc,%esp
+  802a86:	6a 00                	push   $0x0
+  802a88:	6a 00                	push   $0x0
+  802a8a:	6a 00                	push   $0x0
+  802a8c:	e8 5b 18 00 00       	call   8042ec <ipc_recv>
+}
+  802a91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a94:	c9                   	leave
+  802a95:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a96:	83 ec 0c             	sub    $0xc,%esp
+  802a99:	6a 03                	push   $0x3
+  802a9b:	e8 45 1b 00 00       	call   8045e5 <ipc_find_env>
+  802aa0:	a3 e4 81 80 00       	mov    %eax,0x8081e4
+  802aa5:	83 c4 10             	add    $0x10,%esp
+  802aa8:	eb c6                	jmp    802a70 <nsipc+0x12>
+
+00802aaa <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802aaa:	55                   	push   %ebp
+  802aab:	89 e5                	mov    %esp,%ebp
+  802aad:	56                   	push   %esi
+  802aae:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802aaf:	8b 35 f0 81 80 00    	mov    0x8081f0,%esi
+		return 0;
+  802ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802aba:	85 f6                	test   %esi,%esi
+  802abc:	75 33                	jne    802af1 <nsbulk_map+0x47>
+  802abe:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802ac3:	83 ec 04             	sub    $0x4,%esp
+  802ac6:	6a 07                	push   $0x7
+  802ac8:	53                   	push   %ebx
+  802ac9:	6a 00                	push   $0x0
+  802acb:	e8 7e e6 ff ff       	call   80114e <sys_page_alloc>
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	78 1a                	js     802af1 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802ad7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802add:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802ae3:	75 de                	jne    802ac3 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802ae5:	c7 05 f0 81 80 00 01 	movl   $0x1,0x8081f0
+  802aec:	00 00 00 
+	return 0;
+  802aef:	89 f0                	mov    %esi,%eax
+}
+  802af1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802af4:	5b                   	pop    %ebx
+  802af5:	5e                   	pop    %esi
+  802af6:	5d                   	pop    %ebp
+  802af7:	c3                   	ret
+
+00802af8 <nsbulk_own>:
+{
+  802af8:	55                   	push   %ebp
+  802af9:	89 e5                	mov    %esp,%ebp
+  802afb:	57                   	push   %edi
+  802afc:	56                   	push   %esi
+  802afd:	53                   	push   %ebx
+  802afe:	83 ec 0c             	sub    $0xc,%esp
+  802b01:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802b03:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802b06:	85 d2                	test   %edx,%edx
+  802b08:	7f 0e                	jg     802b18 <nsbulk_own+0x20>
+	return 0;
+  802b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0f:	eb 47                	jmp    802b58 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802b11:	83 c3 01             	add    $0x1,%ebx
+  802b14:	39 fb                	cmp    %edi,%ebx
+  802b16:	7d 3b                	jge    802b53 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802b18:	be 01 00 00 00       	mov    $0x1,%esi
+  802b1d:	89 d9                	mov    %ebx,%ecx
+  802b1f:	d3 e6                	shl    %cl,%esi
+  802b21:	89 f0                	mov    %esi,%eax
+  802b23:	23 05 ec 81 80 00    	and    0x8081ec,%eax
+  802b29:	74 e6                	je     802b11 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802b2b:	83 ec 04             	sub    $0x4,%esp
+  802b2e:	6a 07                	push   $0x7
+  802b30:	89 d8                	mov    %ebx,%eax
+  802b32:	c1 e0 0c             	shl    $0xc,%eax
+  802b35:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b3a:	50                   	push   %eax
+  802b3b:	6a 00                	push   $0x0
+  802b3d:	e8 0c e6 ff ff       	call   80114e <sys_page_alloc>
+  802b42:	83 c4 10             	add    $0x10,%esp
+  802b45:	85 c0                	test   %eax,%eax
+  802b47:	78 0f                	js     802b58 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802b49:	f7 d6                	not    %esi
+  802b4b:	21 35 ec 81 80 00    	and    %esi,0x8081ec
+  802b51:	eb be                	jmp    802b11 <nsbulk_own+0x19>
+	return 0;
+  802b53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5b:	5b                   	pop    %ebx
+  802b5c:	5e                   	pop    %esi
+  802b5d:	5f                   	pop    %edi
+  802b5e:	5d                   	pop    %ebp
+  802b5f:	c3                   	ret
+
+00802b60 <nsipc_bulk>:
+{
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	57                   	push   %edi
+  802b64:	56                   	push   %esi
+  802b65:	53                   	push   %ebx
+  802b66:	83 ec 1c             	sub    $0x1c,%esp
+  802b69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b6c:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802b6e:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802b74:	c1 fb 0c             	sar    $0xc,%ebx
+  802b77:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802b7a:	83 3d e4 81 80 00 00 	cmpl   $0x0,0x8081e4
+  802b81:	74 56                	je     802bd9 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802b83:	85 ff                	test   %edi,%edi
+  802b85:	7e 24                	jle    802bab <nsipc_bulk+0x4b>
+  802b87:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802b8d:	74 1c                	je     802bab <nsipc_bulk+0x4b>
+  802b8f:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802b95:	c1 e3 0c             	shl    $0xc,%ebx
+  802b98:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802b9d:	0f b6 10             	movzbl (%eax),%edx
+  802ba0:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802ba2:	05 00 10 00 00       	add    $0x1000,%eax
+  802ba7:	39 d8                	cmp    %ebx,%eax
+  802ba9:	75 f2                	jne    802b9d <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802bab:	83 ec 0c             	sub    $0xc,%esp
+  802bae:	56                   	push   %esi
+  802baf:	57                   	push   %edi
+  802bb0:	68 00 00 00 e0       	push   $0xe0000000
+  802bb5:	ff 75 e4             	push   -0x1c(%ebp)
+  802bb8:	ff 35 e4 81 80 00    	push   0x8081e4
+  802bbe:	e8 ed 19 00 00       	call   8045b0 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802bc3:	83 c4 1c             	add    $0x1c,%esp
+  802bc6:	6a 00                	push   $0x0
+  802bc8:	6a 00                	push   $0x0
+  802bca:	6a 00                	push   $0x0
+  802bcc:	e8 1b 17 00 00       	call   8042ec <ipc_recv>
+}
+  802bd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd4:	5b                   	pop    %ebx
+  802bd5:	5e                   	pop    %esi
+  802bd6:	5f                   	pop    %edi
+  802bd7:	5d                   	pop    %ebp
+  802bd8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bd9:	83 ec 0c             	sub    $0xc,%esp
+  802bdc:	6a 03                	push   $0x3
+  802bde:	e8 02 1a 00 00       	call   8045e5 <ipc_find_env>
+  802be3:	a3 e4 81 80 00       	mov    %eax,0x8081e4
+  802be8:	83 c4 10             	add    $0x10,%esp
+  802beb:	eb 96                	jmp    802b83 <nsipc_bulk+0x23>
+
+00802bed <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802bed:	55                   	push   %ebp
+  802bee:	89 e5                	mov    %esp,%ebp
+  802bf0:	53                   	push   %ebx
+  802bf1:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf7:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_flags = flags;
+  802bfc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bff:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c04:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c09:	e8 50 fe ff ff       	call   802a5e <nsipc>
+  802c0e:	89 c3                	mov    %eax,%ebx
+  802c10:	85 c0                	test   %eax,%eax
+  802c12:	79 07                	jns    802c1b <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c14:	89 d8                	mov    %ebx,%eax
+  802c16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c19:	c9                   	leave
+  802c1a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c1b:	83 ec 04             	sub    $0x4,%esp
+  802c1e:	ff 35 10 a0 80 00    	push   0x80a010
+  802c24:	68 00 a0 80 00       	push   $0x80a000
+  802c29:	ff 75 0c             	push   0xc(%ebp)
+  802c2c:	e8 99 e2 ff ff       	call   800eca <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c31:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  802c37:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c3a:	89 10                	mov    %edx,(%eax)
+  802c3c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c3f:	eb d3                	jmp    802c14 <nsipc_accept+0x27>
+
+00802c41 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c41:	55                   	push   %ebp
+  802c42:	89 e5                	mov    %esp,%ebp
+  802c44:	53                   	push   %ebx
+  802c45:	83 ec 08             	sub    $0x8,%esp
+  802c48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c53:	53                   	push   %ebx
+  802c54:	ff 75 0c             	push   0xc(%ebp)
+  802c57:	68 04 a0 80 00       	push   $0x80a004
+  802c5c:	e8 69 e2 ff ff       	call   800eca <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c61:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  802c67:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c6c:	e8 ed fd ff ff       	call   802a5e <nsipc>
+}
+  802c71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c74:	c9                   	leave
+  802c75:	c3                   	ret
+
+00802c76 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c76:	55                   	push   %ebp
+  802c77:	89 e5                	mov    %esp,%ebp
+  802c79:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  802c84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c87:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c8c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c91:	e8 c8 fd ff ff       	call   802a5e <nsipc>
+}
+  802c96:	c9                   	leave
+  802c97:	c3                   	ret
+
+00802c98 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c98:	55                   	push   %ebp
+  802c99:	89 e5                	mov    %esp,%ebp
+  802c9b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca1:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  802ca6:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cab:	e8 ae fd ff ff       	call   802a5e <nsipc>
+}
+  802cb0:	c9                   	leave
+  802cb1:	c3                   	ret
+
+00802cb2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802cb2:	55                   	push   %ebp
+  802cb3:	89 e5                	mov    %esp,%ebp
+  802cb5:	53                   	push   %ebx
+  802cb6:	83 ec 08             	sub    $0x8,%esp
+  802cb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cbf:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802cc4:	53                   	push   %ebx
+  802cc5:	ff 75 0c             	push   0xc(%ebp)
+  802cc8:	68 04 a0 80 00       	push   $0x80a004
+  802ccd:	e8 f8 e1 ff ff       	call   800eca <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802cd2:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  802cd8:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cdd:	e8 7c fd ff ff       	call   802a5e <nsipc>
+}
+  802ce2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ce5:	c9                   	leave
+  802ce6:	c3                   	ret
+
+00802ce7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ce7:	55                   	push   %ebp
+  802ce8:	89 e5                	mov    %esp,%ebp
+  802cea:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf0:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802cf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cf8:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  802cfd:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d02:	e8 57 fd ff ff       	call   802a5e <nsipc>
+}
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+
+00802d09 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d09:	55                   	push   %ebp
+  802d0a:	89 e5                	mov    %esp,%ebp
+  802d0c:	56                   	push   %esi
+  802d0d:	53                   	push   %ebx
+  802d0e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d14:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  802d19:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  802d1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d22:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d27:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d2c:	e8 2d fd ff ff       	call   802a5e <nsipc>
+  802d31:	89 c3                	mov    %eax,%ebx
+  802d33:	85 c0                	test   %eax,%eax
+  802d35:	78 22                	js     802d59 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d37:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d3c:	39 c6                	cmp    %eax,%esi
+  802d3e:	0f 4e c6             	cmovle %esi,%eax
+  802d41:	39 c3                	cmp    %eax,%ebx
+  802d43:	7f 1d                	jg     802d62 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d45:	83 ec 04             	sub    $0x4,%esp
+  802d48:	53                   	push   %ebx
+  802d49:	68 00 a0 80 00       	push   $0x80a000
+  802d4e:	ff 75 0c             	push   0xc(%ebp)
+  802d51:	e8 74 e1 ff ff       	call   800eca <memmove>
+  802d56:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d59:	89 d8                	mov    %ebx,%eax
+  802d5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d5e:	5b                   	pop    %ebx
+  802d5f:	5e                   	pop    %esi
+  802d60:	5d                   	pop    %ebp
+  802d61:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d62:	68 f8 51 80 00       	push   $0x8051f8
+  802d67:	68 0d 52 80 00       	push   $0x80520d
+  802d6c:	68 b2 00 00 00       	push   $0xb2
+  802d71:	68 22 52 80 00       	push   $0x805222
+  802d76:	e8 cd d7 ff ff       	call   800548 <_panic>
+
+00802d7b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d7b:	55                   	push   %ebp
+  802d7c:	89 e5                	mov    %esp,%ebp
+  802d7e:	53                   	push   %ebx
+  802d7f:	83 ec 04             	sub    $0x4,%esp
+  802d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d88:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  802d8d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d93:	7f 2e                	jg     802dc3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d95:	83 ec 04             	sub    $0x4,%esp
+  802d98:	53                   	push   %ebx
+  802d99:	ff 75 0c             	push   0xc(%ebp)
+  802d9c:	68 0c a0 80 00       	push   $0x80a00c
+  802da1:	e8 24 e1 ff ff       	call   800eca <memmove>
+	nsipcbuf.send.req_size = size;
+  802da6:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  802dac:	8b 45 14             	mov    0x14(%ebp),%eax
+  802daf:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  802db4:	b8 08 00 00 00       	mov    $0x8,%eax
+  802db9:	e8 a0 fc ff ff       	call   802a5e <nsipc>
+}
+  802dbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc1:	c9                   	leave
+  802dc2:	c3                   	ret
+	assert(size < 1600);
+  802dc3:	68 2e 52 80 00       	push   $0x80522e
+  802dc8:	68 0d 52 80 00       	push   $0x80520d
+  802dcd:	68 bd 00 00 00       	push   $0xbd
+  802dd2:	68 22 52 80 00       	push   $0x805222
+  802dd7:	e8 6c d7 ff ff       	call   800548 <_panic>
+
+00802ddc <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802ddc:	55                   	push   %ebp
+  802ddd:	89 e5                	mov    %esp,%ebp
+  802ddf:	57                   	push   %edi
+  802de0:	56                   	push   %esi
+  802de1:	53                   	push   %ebx
+  802de2:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802de5:	e8 c0 fc ff ff       	call   802aaa <nsbulk_map>
+  802dea:	85 c0                	test   %eax,%eax
+  802dec:	78 55                	js     802e43 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802dee:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802df5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802dfc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e03:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e06:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e09:	0f 8d 24 02 00 00    	jge    803033 <nsipc_sendmsg+0x257>
+  802e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e12:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e15:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802e18:	89 d8                	mov    %ebx,%eax
+  802e1a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e1f:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802e21:	83 ec 0c             	sub    $0xc,%esp
+  802e24:	68 e0 7e 80 00       	push   $0x807ee0
+  802e29:	e8 5a 0f 00 00       	call   803d88 <pgbatch_init>
+  802e2e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e31:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802e33:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802e36:	e9 82 00 00 00       	jmp    802ebd <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802e3b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e3e:	85 db                	test   %ebx,%ebx
+  802e40:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e46:	5b                   	pop    %ebx
+  802e47:	5e                   	pop    %esi
+  802e48:	5f                   	pop    %edi
+  802e49:	5d                   	pop    %ebp
+  802e4a:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802e4b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802e50:	29 c8                	sub    %ecx,%eax
+  802e52:	39 d0                	cmp    %edx,%eax
+  802e54:	0f 46 d0             	cmovbe %eax,%edx
+  802e57:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802e59:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e5f:	85 ff                	test   %edi,%edi
+  802e61:	0f 49 c7             	cmovns %edi,%eax
+  802e64:	c1 f8 0c             	sar    $0xc,%eax
+  802e67:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e6c:	e8 87 fc ff ff       	call   802af8 <nsbulk_own>
+  802e71:	85 c0                	test   %eax,%eax
+  802e73:	0f 88 17 01 00 00    	js     802f90 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802e79:	83 ec 04             	sub    $0x4,%esp
+  802e7c:	56                   	push   %esi
+  802e7d:	ff 75 e0             	push   -0x20(%ebp)
+  802e80:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802e83:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e88:	50                   	push   %eax
+  802e89:	e8 3c e0 ff ff       	call   800eca <memmove>
+  802e8e:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802e91:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802e94:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e97:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802e9a:	0f 84 fd 00 00 00    	je     802f9d <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802ea0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802ea3:	01 f7                	add    %esi,%edi
+  802ea5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ea8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802eab:	0f 8d 01 01 00 00    	jge    802fb2 <nsipc_sendmsg+0x1d6>
+  802eb1:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802eb7:	0f 8f f0 00 00 00    	jg     802fad <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802ebd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ec0:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802ec3:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802ec6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ec9:	89 c2                	mov    %eax,%edx
+  802ecb:	03 13                	add    (%ebx),%edx
+  802ecd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802ed0:	8b 73 04             	mov    0x4(%ebx),%esi
+  802ed3:	29 c6                	sub    %eax,%esi
+  802ed5:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802eda:	29 f9                	sub    %edi,%ecx
+  802edc:	39 ce                	cmp    %ecx,%esi
+  802ede:	89 ca                	mov    %ecx,%edx
+  802ee0:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802ee3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802ee6:	89 f9                	mov    %edi,%ecx
+  802ee8:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802eee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ef1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ef6:	09 c8                	or     %ecx,%eax
+  802ef8:	0f 85 4d ff ff ff    	jne    802e4b <nsipc_sendmsg+0x6f>
+  802efe:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802f04:	0f 86 41 ff ff ff    	jbe    802e4b <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f0a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802f10:	85 ff                	test   %edi,%edi
+  802f12:	0f 49 c7             	cmovns %edi,%eax
+  802f15:	c1 f8 0c             	sar    $0xc,%eax
+  802f18:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f1a:	89 d1                	mov    %edx,%ecx
+  802f1c:	c1 e9 0c             	shr    $0xc,%ecx
+  802f1f:	01 c8                	add    %ecx,%eax
+  802f21:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f24:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f27:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802f29:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f2c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f31:	29 c8                	sub    %ecx,%eax
+  802f33:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f36:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802f39:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f40:	89 f9                	mov    %edi,%ecx
+  802f42:	d3 e0                	shl    %cl,%eax
+  802f44:	09 05 ec 81 80 00    	or     %eax,0x8081ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f4a:	83 ec 08             	sub    $0x8,%esp
+  802f4d:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802f4f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f52:	50                   	push   %eax
+  802f53:	6a 00                	push   $0x0
+  802f55:	56                   	push   %esi
+  802f56:	6a 00                	push   $0x0
+  802f58:	68 e0 7e 80 00       	push   $0x807ee0
+  802f5d:	e8 e4 0e 00 00       	call   803e46 <pgbatch_map>
+  802f62:	83 c4 20             	add    $0x20,%esp
+  802f65:	85 c0                	test   %eax,%eax
+  802f67:	0f 88 ce fe ff ff    	js     802e3b <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f6d:	83 c7 01             	add    $0x1,%edi
+  802f70:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f76:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802f79:	39 c7                	cmp    %eax,%edi
+  802f7b:	75 be                	jne    802f3b <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802f7d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f80:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802f83:	89 d6                	mov    %edx,%esi
+  802f85:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802f8b:	e9 01 ff ff ff       	jmp    802e91 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802f90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f93:	85 db                	test   %ebx,%ebx
+  802f95:	0f 45 c3             	cmovne %ebx,%eax
+  802f98:	e9 a6 fe ff ff       	jmp    802e43 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802f9d:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802fa1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802fa8:	e9 f3 fe ff ff       	jmp    802ea0 <nsipc_sendmsg+0xc4>
+  802fad:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802fb0:	eb 03                	jmp    802fb5 <nsipc_sendmsg+0x1d9>
+  802fb2:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802fb5:	83 ec 0c             	sub    $0xc,%esp
+  802fb8:	68 e0 7e 80 00       	push   $0x807ee0
+  802fbd:	e8 d4 0d 00 00       	call   803d96 <pgbatch_flush>
+  802fc2:	83 c4 10             	add    $0x10,%esp
+  802fc5:	85 c0                	test   %eax,%eax
+  802fc7:	78 50                	js     803019 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802fc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fcc:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802fd1:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802fd7:	89 fb                	mov    %edi,%ebx
+  802fd9:	29 f3                	sub    %esi,%ebx
+  802fdb:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802fe1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fe4:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802fe9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802fee:	89 fa                	mov    %edi,%edx
+  802ff0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802ff5:	e8 66 fb ff ff       	call   802b60 <nsipc_bulk>
+  802ffa:	85 c0                	test   %eax,%eax
+  802ffc:	78 28                	js     803026 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802ffe:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  803001:	39 c3                	cmp    %eax,%ebx
+  803003:	75 0c                	jne    803011 <nsipc_sendmsg+0x235>
+  803005:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803008:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80300b:	0f 8f f2 fd ff ff    	jg     802e03 <nsipc_sendmsg+0x27>
+		sent += r;
+  803011:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803014:	e9 2a fe ff ff       	jmp    802e43 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803019:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80301c:	85 db                	test   %ebx,%ebx
+  80301e:	0f 45 c3             	cmovne %ebx,%eax
+  803021:	e9 1d fe ff ff       	jmp    802e43 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803026:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803029:	85 db                	test   %ebx,%ebx
+  80302b:	0f 45 c3             	cmovne %ebx,%eax
+  80302e:	e9 10 fe ff ff       	jmp    802e43 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803033:	83 ec 0c             	sub    $0xc,%esp
+  803036:	68 e0 7e 80 00       	push   $0x807ee0
+  80303b:	e8 48 0d 00 00       	call   803d88 <pgbatch_init>
+  803040:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803043:	be 00 00 00 00       	mov    $0x0,%esi
+  803048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304d:	e9 63 ff ff ff       	jmp    802fb5 <nsipc_sendmsg+0x1d9>
+
+00803052 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803052:	55                   	push   %ebp
+  803053:	89 e5                	mov    %esp,%ebp
+  803055:	57                   	push   %edi
+  803056:	56                   	push   %esi
+  803057:	53                   	push   %ebx
+  803058:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80305b:	83 3d e8 81 80 00 00 	cmpl   $0x0,0x8081e8
+  803062:	0f 84 c8 00 00 00    	je     803130 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803068:	83 3d e4 81 80 00 00 	cmpl   $0x0,0x8081e4
+  80306f:	0f 84 e4 00 00 00    	je     803159 <nsipc_sendfile+0x107>
+{
+  803075:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80307a:	89 fb                	mov    %edi,%ebx
+  80307c:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80307f:	0f 83 f0 00 00 00    	jae    803175 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803085:	89 fa                	mov    %edi,%edx
+  803087:	03 55 10             	add    0x10(%ebp),%edx
+  80308a:	89 d0                	mov    %edx,%eax
+  80308c:	c1 f8 1f             	sar    $0x1f,%eax
+  80308f:	c1 e8 14             	shr    $0x14,%eax
+  803092:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803095:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80309b:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80309d:	6a 10                	push   $0x10
+  80309f:	68 00 20 01 e0       	push   $0xe0012000
+  8030a4:	52                   	push   %edx
+  8030a5:	ff 75 0c             	push   0xc(%ebp)
+  8030a8:	e8 fe f4 ff ff       	call   8025ab <fmap>
+  8030ad:	83 c4 10             	add    $0x10,%esp
+  8030b0:	85 c0                	test   %eax,%eax
+  8030b2:	0f 8e b8 00 00 00    	jle    803170 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8030b8:	39 c6                	cmp    %eax,%esi
+  8030ba:	0f 8d b5 00 00 00    	jge    803175 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8030c0:	29 f0                	sub    %esi,%eax
+  8030c2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8030c5:	29 da                	sub    %ebx,%edx
+  8030c7:	39 d0                	cmp    %edx,%eax
+  8030c9:	89 d3                	mov    %edx,%ebx
+  8030cb:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8030ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d1:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8030d6:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8030dc:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8030e2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8030e5:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8030ea:	83 ec 0c             	sub    $0xc,%esp
+  8030ed:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8030ef:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8030f6:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8030f9:	83 c0 01             	add    $0x1,%eax
+  8030fc:	50                   	push   %eax
+  8030fd:	68 00 10 01 e0       	push   $0xe0011000
+  803102:	6a 11                	push   $0x11
+  803104:	ff 35 e4 81 80 00    	push   0x8081e4
+  80310a:	e8 a1 14 00 00       	call   8045b0 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80310f:	83 c4 1c             	add    $0x1c,%esp
+  803112:	6a 00                	push   $0x0
+  803114:	6a 00                	push   $0x0
+  803116:	6a 00                	push   $0x0
+  803118:	e8 cf 11 00 00       	call   8042ec <ipc_recv>
+  80311d:	83 c4 10             	add    $0x10,%esp
+  803120:	85 c0                	test   %eax,%eax
+  803122:	78 5b                	js     80317f <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803124:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803126:	39 c3                	cmp    %eax,%ebx
+  803128:	0f 8e 4c ff ff ff    	jle    80307a <nsipc_sendfile+0x28>
+  80312e:	eb 45                	jmp    803175 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803130:	83 ec 04             	sub    $0x4,%esp
+  803133:	6a 07                	push   $0x7
+  803135:	68 00 10 01 e0       	push   $0xe0011000
+  80313a:	6a 00                	push   $0x0
+  80313c:	e8 0d e0 ff ff       	call   80114e <sys_page_alloc>
+  803141:	89 c7                	mov    %eax,%edi
+  803143:	83 c4 10             	add    $0x10,%esp
+  803146:	85 c0                	test   %eax,%eax
+  803148:	78 2b                	js     803175 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80314a:	c7 05 e8 81 80 00 01 	movl   $0x1,0x8081e8
+  803151:	00 00 00 
+  803154:	e9 0f ff ff ff       	jmp    803068 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803159:	83 ec 0c             	sub    $0xc,%esp
+  80315c:	6a 03                	push   $0x3
+  80315e:	e8 82 14 00 00       	call   8045e5 <ipc_find_env>
+  803163:	a3 e4 81 80 00       	mov    %eax,0x8081e4
+  803168:	83 c4 10             	add    $0x10,%esp
+  80316b:	e9 05 ff ff ff       	jmp    803075 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803170:	85 ff                	test   %edi,%edi
+  803172:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803175:	89 f8                	mov    %edi,%eax
+  803177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80317a:	5b                   	pop    %ebx
+  80317b:	5e                   	pop    %esi
+  80317c:	5f                   	pop    %edi
+  80317d:	5d                   	pop    %ebp
+  80317e:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80317f:	85 ff                	test   %edi,%edi
+  803181:	0f 44 f8             	cmove  %eax,%edi
+  803184:	eb ef                	jmp    803175 <nsipc_sendfile+0x123>
+
+00803186 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803186:	55                   	push   %ebp
+  803187:	89 e5                	mov    %esp,%ebp
+  803189:	57                   	push   %edi
+  80318a:	56                   	push   %esi
+  80318b:	53                   	push   %ebx
+  80318c:	83 ec 1c             	sub    $0x1c,%esp
+  80318f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803192:	e8 13 f9 ff ff       	call   802aaa <nsbulk_map>
+  803197:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80319a:	85 c0                	test   %eax,%eax
+  80319c:	0f 88 ba 00 00 00    	js     80325c <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031a2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8031a6:	0f 8e bb 00 00 00    	jle    803267 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8031ac:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031b1:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8031b6:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8031bb:	89 f8                	mov    %edi,%eax
+  8031bd:	29 f0                	sub    %esi,%eax
+  8031bf:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8031c3:	39 c8                	cmp    %ecx,%eax
+  8031c5:	0f 47 c1             	cmova  %ecx,%eax
+  8031c8:	01 f0                	add    %esi,%eax
+  8031ca:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031cc:	83 c2 01             	add    $0x1,%edx
+  8031cf:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8031d2:	7e 07                	jle    8031db <nsipc_recvmsg+0x55>
+  8031d4:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8031d9:	7e e0                	jle    8031bb <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8031db:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8031e1:	c1 fa 0c             	sar    $0xc,%edx
+  8031e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e9:	e8 0a f9 ff ff       	call   802af8 <nsbulk_own>
+  8031ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031f1:	85 c0                	test   %eax,%eax
+  8031f3:	78 67                	js     80325c <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8031f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f8:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8031fd:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803203:	8b 45 14             	mov    0x14(%ebp),%eax
+  803206:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80320b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803210:	89 f2                	mov    %esi,%edx
+  803212:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803217:	e8 44 f9 ff ff       	call   802b60 <nsipc_bulk>
+  80321c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80321f:	85 c0                	test   %eax,%eax
+  803221:	78 39                	js     80325c <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803223:	39 f0                	cmp    %esi,%eax
+  803225:	7f 4a                	jg     803271 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803227:	bf 00 00 00 00       	mov    $0x0,%edi
+  80322c:	85 c0                	test   %eax,%eax
+  80322e:	7e 2c                	jle    80325c <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803230:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803233:	29 fe                	sub    %edi,%esi
+  803235:	8b 43 04             	mov    0x4(%ebx),%eax
+  803238:	39 c6                	cmp    %eax,%esi
+  80323a:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80323d:	83 ec 04             	sub    $0x4,%esp
+  803240:	56                   	push   %esi
+  803241:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803247:	50                   	push   %eax
+  803248:	ff 33                	push   (%ebx)
+  80324a:	e8 7b dc ff ff       	call   800eca <memmove>
+		n += m;
+  80324f:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803251:	83 c3 08             	add    $0x8,%ebx
+  803254:	83 c4 10             	add    $0x10,%esp
+  803257:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80325a:	7f d4                	jg     803230 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80325c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80325f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803262:	5b                   	pop    %ebx
+  803263:	5e                   	pop    %esi
+  803264:	5f                   	pop    %edi
+  803265:	5d                   	pop    %ebp
+  803266:	c3                   	ret
+	int r, i, n, len = 0;
+  803267:	be 00 00 00 00       	mov    $0x0,%esi
+  80326c:	e9 6a ff ff ff       	jmp    8031db <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803271:	68 04 52 80 00       	push   $0x805204
+  803276:	68 0d 52 80 00       	push   $0x80520d
+  80327b:	68 3b 01 00 00       	push   $0x13b
+  803280:	68 22 52 80 00       	push   $0x805222
+  803285:	e8 be d2 ff ff       	call   800548 <_panic>
+
+0080328a <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80328a:	55                   	push   %ebp
+  80328b:	89 e5                	mov    %esp,%ebp
+  80328d:	57                   	push   %edi
+  80328e:	56                   	push   %esi
+  80328f:	53                   	push   %ebx
+  803290:	83 ec 0c             	sub    $0xc,%esp
+  803293:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803296:	8b 75 10             	mov    0x10(%ebp),%esi
+  803299:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80329c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.select.req_readset = *readset;
+  8032a4:	8b 07                	mov    (%edi),%eax
+  8032a6:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  8032ab:	8b 47 04             	mov    0x4(%edi),%eax
+  8032ae:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  8032b3:	8b 47 08             	mov    0x8(%edi),%eax
+  8032b6:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+  8032bb:	8b 47 0c             	mov    0xc(%edi),%eax
+  8032be:	a3 10 a0 80 00       	mov    %eax,0x80a010
+  8032c3:	8b 47 10             	mov    0x10(%edi),%eax
+  8032c6:	a3 14 a0 80 00       	mov    %eax,0x80a014
+  8032cb:	8b 47 14             	mov    0x14(%edi),%eax
+  8032ce:	a3 18 a0 80 00       	mov    %eax,0x80a018
+  8032d3:	8b 47 18             	mov    0x18(%edi),%eax
+  8032d6:	a3 1c a0 80 00       	mov    %eax,0x80a01c
+  8032db:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8032de:	a3 20 a0 80 00       	mov    %eax,0x80a020
+  8032e3:	8b 47 20             	mov    0x20(%edi),%eax
+  8032e6:	a3 24 a0 80 00       	mov    %eax,0x80a024
+  8032eb:	8b 47 24             	mov    0x24(%edi),%eax
+  8032ee:	a3 28 a0 80 00       	mov    %eax,0x80a028
+  8032f3:	8b 47 28             	mov    0x28(%edi),%eax
+  8032f6:	a3 2c a0 80 00       	mov    %eax,0x80a02c
+  8032fb:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8032fe:	a3 30 a0 80 00       	mov    %eax,0x80a030
+  803303:	8b 47 30             	mov    0x30(%edi),%eax
+  803306:	a3 34 a0 80 00       	mov    %eax,0x80a034
+  80330b:	8b 47 34             	mov    0x34(%edi),%eax
+  80330e:	a3 38 a0 80 00       	mov    %eax,0x80a038
+  803313:	8b 47 38             	mov    0x38(%edi),%eax
+  803316:	a3 3c a0 80 00       	mov    %eax,0x80a03c
+  80331b:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80331e:	a3 40 a0 80 00       	mov    %eax,0x80a040
+	nsipcbuf.select.req_writeset = *writeset;
+  803323:	8b 06                	mov    (%esi),%eax
+  803325:	a3 44 a0 80 00       	mov    %eax,0x80a044
+  80332a:	8b 46 04             	mov    0x4(%esi),%eax
+  80332d:	a3 48 a0 80 00       	mov    %eax,0x80a048
+  803332:	8b 46 08             	mov    0x8(%esi),%eax
+  803335:	a3 4c a0 80 00       	mov    %eax,0x80a04c
+  80333a:	8b 46 0c             	mov    0xc(%esi),%eax
+  80333d:	a3 50 a0 80 00       	mov    %eax,0x80a050
+  803342:	8b 46 10             	mov    0x10(%esi),%eax
+  803345:	a3 54 a0 80 00       	mov    %eax,0x80a054
+  80334a:	8b 46 14             	mov    0x14(%esi),%eax
+  80334d:	a3 58 a0 80 00       	mov    %eax,0x80a058
+  803352:	8b 46 18             	mov    0x18(%esi),%eax
+  803355:	a3 5c a0 80 00       	mov    %eax,0x80a05c
+  80335a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80335d:	a3 60 a0 80 00       	mov    %eax,0x80a060
+  803362:	8b 46 20             	mov    0x20(%esi),%eax
+  803365:	a3 64 a0 80 00       	mov    %eax,0x80a064
+  80336a:	8b 46 24             	mov    0x24(%esi),%eax
+  80336d:	a3 68 a0 80 00       	mov    %eax,0x80a068
+  803372:	8b 46 28             	mov    0x28(%esi),%eax
+  803375:	a3 6c a0 80 00       	mov    %eax,0x80a06c
+  80337a:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80337d:	a3 70 a0 80 00       	mov    %eax,0x80a070
+  803382:	8b 46 30             	mov    0x30(%esi),%eax
+  803385:	a3 74 a0 80 00       	mov    %eax,0x80a074
+  80338a:	8b 46 34             	mov    0x34(%esi),%eax
+  80338d:	a3 78 a0 80 00       	mov    %eax,0x80a078
+  803392:	8b 46 38             	mov    0x38(%esi),%eax
+  803395:	a3 7c a0 80 00       	mov    %eax,0x80a07c
+  80339a:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80339d:	a3 80 a0 80 00       	mov    %eax,0x80a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8033a2:	8b 03                	mov    (%ebx),%eax
+  8033a4:	a3 84 a0 80 00       	mov    %eax,0x80a084
+  8033a9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033ac:	a3 88 a0 80 00       	mov    %eax,0x80a088
+  8033b1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8033b4:	a3 8c a0 80 00       	mov    %eax,0x80a08c
+  8033b9:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8033bc:	a3 90 a0 80 00       	mov    %eax,0x80a090
+  8033c1:	8b 43 10             	mov    0x10(%ebx),%eax
+  8033c4:	a3 94 a0 80 00       	mov    %eax,0x80a094
+  8033c9:	8b 43 14             	mov    0x14(%ebx),%eax
+  8033cc:	a3 98 a0 80 00       	mov    %eax,0x80a098
+  8033d1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033d4:	a3 9c a0 80 00       	mov    %eax,0x80a09c
+  8033d9:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8033dc:	a3 a0 a0 80 00       	mov    %eax,0x80a0a0
+  8033e1:	8b 43 20             	mov    0x20(%ebx),%eax
+  8033e4:	a3 a4 a0 80 00       	mov    %eax,0x80a0a4
+  8033e9:	8b 43 24             	mov    0x24(%ebx),%eax
+  8033ec:	a3 a8 a0 80 00       	mov    %eax,0x80a0a8
+  8033f1:	8b 43 28             	mov    0x28(%ebx),%eax
+  8033f4:	a3 ac a0 80 00       	mov    %eax,0x80a0ac
+  8033f9:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8033fc:	a3 b0 a0 80 00       	mov    %eax,0x80a0b0
+  803401:	8b 43 30             	mov    0x30(%ebx),%eax
+  803404:	a3 b4 a0 80 00       	mov    %eax,0x80a0b4
+  803409:	8b 43 34             	mov    0x34(%ebx),%eax
+  80340c:	a3 b8 a0 80 00       	mov    %eax,0x80a0b8
+  803411:	8b 43 38             	mov    0x38(%ebx),%eax
+  803414:	a3 bc a0 80 00       	mov    %eax,0x80a0bc
+  803419:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80341c:	a3 c0 a0 80 00       	mov    %eax,0x80a0c0
+	nsipcbuf.select.req_timeout = msec;
+  803421:	8b 45 18             	mov    0x18(%ebp),%eax
+  803424:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803429:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80342e:	e8 2b f6 ff ff       	call   802a5e <nsipc>
+  803433:	85 c0                	test   %eax,%eax
+  803435:	0f 88 ad 01 00 00    	js     8035e8 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80343b:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  803441:	89 17                	mov    %edx,(%edi)
+  803443:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  803449:	89 57 04             	mov    %edx,0x4(%edi)
+  80344c:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  803452:	89 57 08             	mov    %edx,0x8(%edi)
+  803455:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  80345b:	89 57 0c             	mov    %edx,0xc(%edi)
+  80345e:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  803464:	89 57 10             	mov    %edx,0x10(%edi)
+  803467:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  80346d:	89 57 14             	mov    %edx,0x14(%edi)
+  803470:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  803476:	89 57 18             	mov    %edx,0x18(%edi)
+  803479:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  80347f:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803482:	8b 15 24 a0 80 00    	mov    0x80a024,%edx
+  803488:	89 57 20             	mov    %edx,0x20(%edi)
+  80348b:	8b 15 28 a0 80 00    	mov    0x80a028,%edx
+  803491:	89 57 24             	mov    %edx,0x24(%edi)
+  803494:	8b 15 2c a0 80 00    	mov    0x80a02c,%edx
+  80349a:	89 57 28             	mov    %edx,0x28(%edi)
+  80349d:	8b 15 30 a0 80 00    	mov    0x80a030,%edx
+  8034a3:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8034a6:	8b 15 34 a0 80 00    	mov    0x80a034,%edx
+  8034ac:	89 57 30             	mov    %edx,0x30(%edi)
+  8034af:	8b 15 38 a0 80 00    	mov    0x80a038,%edx
+  8034b5:	89 57 34             	mov    %edx,0x34(%edi)
+  8034b8:	8b 15 3c a0 80 00    	mov    0x80a03c,%edx
+  8034be:	89 57 38             	mov    %edx,0x38(%edi)
+  8034c1:	8b 15 40 a0 80 00    	mov    0x80a040,%edx
+  8034c7:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8034ca:	8b 15 44 a0 80 00    	mov    0x80a044,%edx
+  8034d0:	89 16                	mov    %edx,(%esi)
+  8034d2:	8b 15 48 a0 80 00    	mov    0x80a048,%edx
+  8034d8:	89 56 04             	mov    %edx,0x4(%esi)
+  8034db:	8b 15 4c a0 80 00    	mov    0x80a04c,%edx
+  8034e1:	89 56 08             	mov    %edx,0x8(%esi)
+  8034e4:	8b 15 50 a0 80 00    	mov    0x80a050,%edx
+  8034ea:	89 56 0c             	mov    %edx,0xc(%esi)
+  8034ed:	8b 15 54 a0 80 00    	mov    0x80a054,%edx
+  8034f3:	89 56 10             	mov    %edx,0x10(%esi)
+  8034f6:	8b 15 58 a0 80 00    	mov    0x80a058,%edx
+  8034fc:	89 56 14             	mov    %edx,0x14(%esi)
+  8034ff:	8b 15 5c a0 80 00    	mov    0x80a05c,%edx
+  803505:	89 56 18             	mov    %edx,0x18(%esi)
+  803508:	8b 15 60 a0 80 00    	mov    0x80a060,%edx
+  80350e:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803511:	8b 15 64 a0 80 00    	mov    0x80a064,%edx
+  803517:	89 56 20             	mov    %edx,0x20(%esi)
+  80351a:	8b 15 68 a0 80 00    	mov    0x80a068,%edx
+  803520:	89 56 24             	mov    %edx,0x24(%esi)
+  803523:	8b 15 6c a0 80 00    	mov    0x80a06c,%edx
+  803529:	89 56 28             	mov    %edx,0x28(%esi)
+  80352c:	8b 15 70 a0 80 00    	mov    0x80a070,%edx
+  803532:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803535:	8b 15 74 a0 80 00    	mov    0x80a074,%edx
+  80353b:	89 56 30             	mov    %edx,0x30(%esi)
+  80353e:	8b 15 78 a0 80 00    	mov    0x80a078,%edx
+  803544:	89 56 34             	mov    %edx,0x34(%esi)
+  803547:	8b 15 7c a0 80 00    	mov    0x80a07c,%edx
+  80354d:	89 56 38             	mov    %edx,0x38(%esi)
+  803550:	8b 15 80 a0 80 00    	mov    0x80a080,%edx
+  803556:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803559:	8b 15 84 a0 80 00    	mov    0x80a084,%edx
+  80355f:	89 13                	mov    %edx,(%ebx)
+  803561:	8b 15 88 a0 80 00    	mov    0x80a088,%edx
+  803567:	89 53 04             	mov    %edx,0x4(%ebx)
+  80356a:	8b 15 8c a0 80 00    	mov    0x80a08c,%edx
+  803570:	89 53 08             	mov    %edx,0x8(%ebx)
+  803573:	8b 15 90 a0 80 00    	mov    0x80a090,%edx
+  803579:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80357c:	8b 15 94 a0 80 00    	mov    0x80a094,%edx
+  803582:	89 53 10             	mov    %edx,0x10(%ebx)
+  803585:	8b 15 98 a0 80 00    	mov    0x80a098,%edx
+  80358b:	89 53 14             	mov    %edx,0x14(%ebx)
+  80358e:	8b 15 9c a0 80 00    	mov    0x80a09c,%edx
+  803594:	89 53 18             	mov    %edx,0x18(%ebx)
+  803597:	8b 15 a0 a0 80 00    	mov    0x80a0a0,%edx
+  80359d:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8035a0:	8b 15 a4 a0 80 00    	mov    0x80a0a4,%edx
+  8035a6:	89 53 20             	mov    %edx,0x20(%ebx)
+  8035a9:	8b 15 a8 a0 80 00    	mov    0x80a0a8,%edx
+  8035af:	89 53 24             	mov    %edx,0x24(%ebx)
+  8035b2:	8b 15 ac a0 80 00    	mov    0x80a0ac,%edx
+  8035b8:	89 53 28             	mov    %edx,0x28(%ebx)
+  8035bb:	8b 15 b0 a0 80 00    	mov    0x80a0b0,%edx
+  8035c1:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8035c4:	8b 15 b4 a0 80 00    	mov    0x80a0b4,%edx
+  8035ca:	89 53 30             	mov    %edx,0x30(%ebx)
+  8035cd:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  8035d3:	89 53 34             	mov    %edx,0x34(%ebx)
+  8035d6:	8b 15 bc a0 80 00    	mov    0x80a0bc,%edx
+  8035dc:	89 53 38             	mov    %edx,0x38(%ebx)
+  8035df:	8b 15 c0 a0 80 00    	mov    0x80a0c0,%edx
+  8035e5:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8035e8:	83 c4 0c             	add    $0xc,%esp
+  8035eb:	5b                   	pop    %ebx
+  8035ec:	5e                   	pop    %esi
+  8035ed:	5f                   	pop    %edi
+  8035ee:	5d                   	pop    %ebp
+  8035ef:	c3                   	ret
+
+008035f0 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8035f0:	55                   	push   %ebp
+  8035f1:	89 e5                	mov    %esp,%ebp
+  8035f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8035f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035f9:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.evctl.req_events = events;
+  8035fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803601:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.evctl.req_data = data;
+  803606:	8b 45 10             	mov    0x10(%ebp),%eax
+  803609:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_EVCTL);
+  80360e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803613:	e8 46 f4 ff ff       	call   802a5e <nsipc>
+}
+  803618:	c9                   	leave
+  803619:	c3                   	ret
+
+0080361a <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80361a:	55                   	push   %ebp
+  80361b:	89 e5                	mov    %esp,%ebp
+  80361d:	56                   	push   %esi
+  80361e:	53                   	push   %ebx
+  80361f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803622:	89 35 00 a0 80 00    	mov    %esi,0x80a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803628:	8b 45 10             	mov    0x10(%ebp),%eax
+  80362b:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803630:	b8 10 00 00 00       	mov    $0x10,%eax
+  803635:	e8 24 f4 ff ff       	call   802a5e <nsipc>
+  80363a:	89 c3                	mov    %eax,%ebx
+  80363c:	85 c0                	test   %eax,%eax
+  80363e:	7e 1f                	jle    80365f <nsipc_evwait+0x45>
+		assert(r <= max);
+  803640:	39 c6                	cmp    %eax,%esi
+  803642:	7c 24                	jl     803668 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803644:	83 ec 04             	sub    $0x4,%esp
+  803647:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80364e:	50                   	push   %eax
+  80364f:	68 00 a0 80 00       	push   $0x80a000
+  803654:	ff 75 08             	push   0x8(%ebp)
+  803657:	e8 6e d8 ff ff       	call   800eca <memmove>
+  80365c:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80365f:	89 d8                	mov    %ebx,%eax
+  803661:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803664:	5b                   	pop    %ebx
+  803665:	5e                   	pop    %esi
+  803666:	5d                   	pop    %ebp
+  803667:	c3                   	ret
+		assert(r <= max);
+  803668:	68 3a 52 80 00       	push   $0x80523a
+  80366d:	68 0d 52 80 00       	push   $0x80520d
+  803672:	68 6a 01 00 00       	push   $0x16a
+  803677:	68 22 52 80 00       	push   $0x805222
+  80367c:	e8 c7 ce ff ff       	call   800548 <_panic>
+
+00803681 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803681:	55                   	push   %ebp
+  803682:	89 e5                	mov    %esp,%ebp
+  803684:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803687:	8b 45 08             	mov    0x8(%ebp),%eax
+  80368a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  80368f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803692:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  803697:	8b 45 10             	mov    0x10(%ebp),%eax
+  80369a:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  80369f:	b8 09 00 00 00       	mov    $0x9,%eax
+  8036a4:	e8 b5 f3 ff ff       	call   802a5e <nsipc>
+}
+  8036a9:	c9                   	leave
+  8036aa:	c3                   	ret
+
+008036ab <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8036ab:	55                   	push   %ebp
+  8036ac:	89 e5                	mov    %esp,%ebp
+  8036ae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8036b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036b4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_OFFLOAD);
+  8036b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8036be:	e8 9b f3 ff ff       	call   802a5e <nsipc>
+}
+  8036c3:	c9                   	leave
+  8036c4:	c3                   	ret
+
+008036c5 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8036c5:	55                   	push   %ebp
+  8036c6:	89 e5                	mov    %esp,%ebp
+  8036c8:	53                   	push   %ebx
+  8036c9:	83 ec 04             	sub    $0x4,%esp
+  8036cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8036cf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8036d4:	e8 85 f3 ff ff       	call   802a5e <nsipc>
+  8036d9:	85 c0                	test   %eax,%eax
+  8036db:	78 50                	js     80372d <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8036dd:	8b 15 00 a0 80 00    	mov    0x80a000,%edx
+  8036e3:	89 13                	mov    %edx,(%ebx)
+  8036e5:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  8036eb:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036ee:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  8036f4:	89 53 08             	mov    %edx,0x8(%ebx)
+  8036f7:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  8036fd:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803700:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  803706:	89 53 10             	mov    %edx,0x10(%ebx)
+  803709:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  80370f:	89 53 14             	mov    %edx,0x14(%ebx)
+  803712:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  803718:	89 53 18             	mov    %edx,0x18(%ebx)
+  80371b:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  803721:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803724:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  80372a:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80372d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803730:	c9                   	leave
+  803731:	c3                   	ret
+
+00803732 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803732:	55                   	push   %ebp
+  803733:	89 e5                	mov    %esp,%ebp
+  803735:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803738:	6a 03                	push   $0x3
+  80373a:	e8 a6 0e 00 00       	call   8045e5 <ipc_find_env>
+  80373f:	a3 e4 81 80 00       	mov    %eax,0x8081e4
+	nsipcbuf.shard.req_shard = shard;
+  803744:	8b 45 08             	mov    0x8(%ebp),%eax
+  803747:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80374c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803751:	e8 08 f3 ff ff       	call   802a5e <nsipc>
+  803756:	83 c4 10             	add    $0x10,%esp
+  803759:	85 c0                	test   %eax,%eax
+  80375b:	78 0a                	js     803767 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80375d:	a3 e4 81 80 00       	mov    %eax,0x8081e4
+	return 0;
+  803762:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803767:	c9                   	leave
+  803768:	c3                   	ret
+
+00803769 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803769:	55                   	push   %ebp
+  80376a:	89 e5                	mov    %esp,%ebp
+  80376c:	57                   	push   %edi
+  80376d:	56                   	push   %esi
+  80376e:	53                   	push   %ebx
+  80376f:	83 ec 1c             	sub    $0x1c,%esp
+  803772:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803775:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803778:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80377d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803782:	89 e0                	mov    %esp,%eax
+  803784:	89 f2                	mov    %esi,%edx
+  803786:	29 c2                	sub    %eax,%edx
+  803788:	89 d0                	mov    %edx,%eax
+  80378a:	c1 e8 0f             	shr    $0xf,%eax
+  80378d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803793:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803796:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  80379d:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8037a0:	83 ec 0c             	sub    $0xc,%esp
+  8037a3:	ff 75 e0             	push   -0x20(%ebp)
+  8037a6:	e8 79 0e 00 00       	call   804624 <pageref>
+  8037ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037ae:	83 c4 04             	add    $0x4,%esp
+  8037b1:	ff 75 dc             	push   -0x24(%ebp)
+  8037b4:	e8 6b 0e 00 00       	call   804624 <pageref>
+  8037b9:	89 e2                	mov    %esp,%edx
+  8037bb:	89 f1                	mov    %esi,%ecx
+  8037bd:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8037bf:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8037c2:	89 ca                	mov    %ecx,%edx
+  8037c4:	c1 ea 0f             	shr    $0xf,%edx
+  8037c7:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8037cd:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8037d0:	8b 14 95 20 82 80 00 	mov    0x808220(,%edx,4),%edx
+  8037d7:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8037da:	39 d7                	cmp    %edx,%edi
+  8037dc:	74 40                	je     80381e <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8037de:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8037e1:	75 9f                	jne    803782 <_pipeisclosed+0x19>
+  8037e3:	89 e2                	mov    %esp,%edx
+  8037e5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037ea:	29 d0                	sub    %edx,%eax
+  8037ec:	89 c2                	mov    %eax,%edx
+  8037ee:	c1 ea 0f             	shr    $0xf,%edx
+  8037f1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fb:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8037fe:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  803805:	8b 40 58             	mov    0x58(%eax),%eax
+  803808:	6a 01                	push   $0x1
+  80380a:	50                   	push   %eax
+  80380b:	57                   	push   %edi
+  80380c:	68 43 52 80 00       	push   $0x805243
+  803811:	e8 0d ce ff ff       	call   800623 <cprintf>
+  803816:	83 c4 10             	add    $0x10,%esp
+  803819:	e9 5f ff ff ff       	jmp    80377d <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80381e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803821:	0f 94 c0             	sete   %al
+  803824:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382a:	5b                   	pop    %ebx
+  80382b:	5e                   	pop    %esi
+  80382c:	5f                   	pop    %edi
+  80382d:	5d                   	pop    %ebp
+  80382e:	c3                   	ret
+
+0080382f <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80382f:	55                   	push   %ebp
+  803830:	89 e5                	mov    %esp,%ebp
+  803832:	53                   	push   %ebx
+  803833:	83 ec 0c             	sub    $0xc,%esp
+  803836:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803839:	53                   	push   %ebx
+  80383a:	6a 00                	push   $0x0
+  80383c:	e8 92 d9 ff ff       	call   8011d3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803841:	89 1c 24             	mov    %ebx,(%esp)
+  803844:	e8 f4 e4 ff ff       	call   801d3d <fd2data>
+  803849:	83 c4 08             	add    $0x8,%esp
+  80384c:	50                   	push   %eax
+  80384d:	6a 00                	push   $0x0
+  80384f:	e8 7f d9 ff ff       	call   8011d3 <sys_page_unmap>
+}
+  803854:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803857:	c9                   	leave
+  803858:	c3                   	ret
+
+00803859 <devpipe_read>:
+{
+  803859:	55                   	push   %ebp
+  80385a:	89 e5                	mov    %esp,%ebp
+  80385c:	57                   	push   %edi
+  80385d:	56                   	push   %esi
+  80385e:	53                   	push   %ebx
+  80385f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803862:	ff 75 08             	push   0x8(%ebp)
+  803865:	e8 d3 e4 ff ff       	call   801d3d <fd2data>
+  80386a:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80386c:	8b 70 04             	mov    0x4(%eax),%esi
+  80386f:	8b 00                	mov    (%eax),%eax
+  803871:	83 c4 10             	add    $0x10,%esp
+  803874:	39 f0                	cmp    %esi,%eax
+  803876:	75 36                	jne    8038ae <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803878:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80387b:	89 da                	mov    %ebx,%edx
+  80387d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803880:	e8 e4 fe ff ff       	call   803769 <_pipeisclosed>
+  803885:	85 c0                	test   %eax,%eax
+  803887:	0f 85 d4 00 00 00    	jne    803961 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80388d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803892:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803896:	83 ec 04             	sub    $0x4,%esp
+  803899:	6a ff                	push   $0xffffffff
+  80389b:	56                   	push   %esi
+  80389c:	57                   	push   %edi
+  80389d:	e8 aa dc ff ff       	call   80154c <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8038a2:	8b 73 04             	mov    0x4(%ebx),%esi
+  8038a5:	8b 03                	mov    (%ebx),%eax
+  8038a7:	83 c4 10             	add    $0x10,%esp
+  8038aa:	39 c6                	cmp    %eax,%esi
+  8038ac:	74 cd                	je     80387b <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038ae:	8b 73 04             	mov    0x4(%ebx),%esi
+  8038b1:	8b 03                	mov    (%ebx),%eax
+  8038b3:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8038b9:	29 c6                	sub    %eax,%esi
+  8038bb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038c0:	f7 e6                	mul    %esi
+  8038c2:	c1 ea 0c             	shr    $0xc,%edx
+  8038c5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038cb:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8038cd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8038d0:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8038d4:	8b 0b                	mov    (%ebx),%ecx
+  8038d6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038db:	f7 e1                	mul    %ecx
+  8038dd:	c1 ea 0b             	shr    $0xb,%edx
+  8038e0:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8038e6:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8038e8:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8038ed:	29 cf                	sub    %ecx,%edi
+  8038ef:	39 f7                	cmp    %esi,%edi
+  8038f1:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8038f4:	83 ec 04             	sub    $0x4,%esp
+  8038f7:	57                   	push   %edi
+  8038f8:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8038fc:	50                   	push   %eax
+  8038fd:	ff 75 0c             	push   0xc(%ebp)
+  803900:	e8 c5 d5 ff ff       	call   800eca <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803905:	83 c4 0c             	add    $0xc,%esp
+  803908:	89 f0                	mov    %esi,%eax
+  80390a:	29 f8                	sub    %edi,%eax
+  80390c:	50                   	push   %eax
+  80390d:	8d 43 10             	lea    0x10(%ebx),%eax
+  803910:	50                   	push   %eax
+  803911:	89 f8                	mov    %edi,%eax
+  803913:	03 45 0c             	add    0xc(%ebp),%eax
+  803916:	50                   	push   %eax
+  803917:	e8 ae d5 ff ff       	call   800eca <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80391c:	8b 0b                	mov    (%ebx),%ecx
+  80391e:	01 f1                	add    %esi,%ecx
+  803920:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803925:	f7 e1                	mul    %ecx
+  803927:	c1 ea 0c             	shr    $0xc,%edx
+  80392a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803930:	29 c1                	sub    %eax,%ecx
+  803932:	89 0b                	mov    %ecx,(%ebx)
+  803934:	b8 00 00 00 00       	mov    $0x0,%eax
+  803939:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80393d:	83 c4 10             	add    $0x10,%esp
+  803940:	85 c0                	test   %eax,%eax
+  803942:	75 0a                	jne    80394e <devpipe_read+0xf5>
+	return n;
+  803944:	89 f0                	mov    %esi,%eax
+}
+  803946:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803949:	5b                   	pop    %ebx
+  80394a:	5e                   	pop    %esi
+  80394b:	5f                   	pop    %edi
+  80394c:	5d                   	pop    %ebp
+  80394d:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80394e:	83 ec 08             	sub    $0x8,%esp
+  803951:	68 00 04 00 00       	push   $0x400
+  803956:	53                   	push   %ebx
+  803957:	e8 12 dc ff ff       	call   80156e <sys_futex_wake>
+  80395c:	83 c4 10             	add    $0x10,%esp
+  80395f:	eb e3                	jmp    803944 <devpipe_read+0xeb>
+			return 0;
+  803961:	b8 00 00 00 00       	mov    $0x0,%eax
+  803966:	eb de                	jmp    803946 <devpipe_read+0xed>
+
+00803968 <devpipe_write>:
+{
+  803968:	55                   	push   %ebp
+  803969:	89 e5                	mov    %esp,%ebp
+  80396b:	57                   	push   %edi
+  80396c:	56                   	push   %esi
+  80396d:	53                   	push   %ebx
+  80396e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803971:	ff 75 08             	push   0x8(%ebp)
+  803974:	e8 c4 e3 ff ff       	call   801d3d <fd2data>
+  803979:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80397b:	83 c4 10             	add    $0x10,%esp
+  80397e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803985:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80398a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80398e:	0f 84 43 01 00 00    	je     803ad7 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803994:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803997:	8b 06                	mov    (%esi),%eax
+  803999:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80399f:	29 c1                	sub    %eax,%ecx
+  8039a1:	89 c8                	mov    %ecx,%eax
+  8039a3:	f7 e7                	mul    %edi
+  8039a5:	c1 ea 0c             	shr    $0xc,%edx
+  8039a8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039ae:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8039b0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8039b6:	75 52                	jne    803a0a <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8039b8:	89 f2                	mov    %esi,%edx
+  8039ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039bd:	e8 a7 fd ff ff       	call   803769 <_pipeisclosed>
+  8039c2:	85 c0                	test   %eax,%eax
+  8039c4:	0f 85 28 01 00 00    	jne    803af2 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8039ca:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039cc:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039cf:	8b 06                	mov    (%esi),%eax
+  8039d1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039d7:	29 c1                	sub    %eax,%ecx
+  8039d9:	89 c8                	mov    %ecx,%eax
+  8039db:	f7 e7                	mul    %edi
+  8039dd:	c1 ea 0c             	shr    $0xc,%edx
+  8039e0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039e6:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8039e8:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8039ee:	75 a4                	jne    803994 <devpipe_write+0x2c>
+  8039f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039f5:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8039f9:	83 ec 04             	sub    $0x4,%esp
+  8039fc:	6a ff                	push   $0xffffffff
+  8039fe:	53                   	push   %ebx
+  8039ff:	56                   	push   %esi
+  803a00:	e8 47 db ff ff       	call   80154c <sys_futex_wait>
+}
+  803a05:	83 c4 10             	add    $0x10,%esp
+  803a08:	eb 8a                	jmp    803994 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a0a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a0d:	8b 06                	mov    (%esi),%eax
+  803a0f:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a15:	29 c1                	sub    %eax,%ecx
+  803a17:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a1c:	f7 e1                	mul    %ecx
+  803a1e:	c1 ea 0c             	shr    $0xc,%edx
+  803a21:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a27:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803a29:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803a2e:	89 d8                	mov    %ebx,%eax
+  803a30:	29 c8                	sub    %ecx,%eax
+  803a32:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a35:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a38:	29 ca                	sub    %ecx,%edx
+  803a3a:	39 d0                	cmp    %edx,%eax
+  803a3c:	0f 46 d0             	cmovbe %eax,%edx
+  803a3f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803a42:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a45:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a4a:	f7 e1                	mul    %ecx
+  803a4c:	c1 ea 0b             	shr    $0xb,%edx
+  803a4f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803a55:	89 ca                	mov    %ecx,%edx
+  803a57:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803a59:	29 d3                	sub    %edx,%ebx
+  803a5b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a5e:	39 c3                	cmp    %eax,%ebx
+  803a60:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803a63:	83 ec 04             	sub    $0x4,%esp
+  803a66:	53                   	push   %ebx
+  803a67:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a6a:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803a6d:	51                   	push   %ecx
+  803a6e:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803a72:	50                   	push   %eax
+  803a73:	e8 52 d4 ff ff       	call   800eca <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803a78:	83 c4 0c             	add    $0xc,%esp
+  803a7b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a7e:	29 d8                	sub    %ebx,%eax
+  803a80:	50                   	push   %eax
+  803a81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a84:	01 cb                	add    %ecx,%ebx
+  803a86:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803a89:	53                   	push   %ebx
+  803a8a:	8d 46 10             	lea    0x10(%esi),%eax
+  803a8d:	50                   	push   %eax
+  803a8e:	e8 37 d4 ff ff       	call   800eca <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803a93:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a96:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a99:	01 c1                	add    %eax,%ecx
+  803a9b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803aa0:	f7 e1                	mul    %ecx
+  803aa2:	c1 ea 0c             	shr    $0xc,%edx
+  803aa5:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803aab:	89 ca                	mov    %ecx,%edx
+  803aad:	29 c2                	sub    %eax,%edx
+  803aaf:	89 56 04             	mov    %edx,0x4(%esi)
+  803ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab7:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803abb:	83 c4 10             	add    $0x10,%esp
+  803abe:	85 c0                	test   %eax,%eax
+  803ac0:	75 1a                	jne    803adc <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803ac2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803ac5:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803ac8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803acb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803ace:	0f 82 c0 fe ff ff    	jb     803994 <devpipe_write+0x2c>
+  803ad4:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803ad7:	8b 45 10             	mov    0x10(%ebp),%eax
+  803ada:	eb 1b                	jmp    803af7 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803adc:	83 ec 08             	sub    $0x8,%esp
+  803adf:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803ae4:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803ae7:	50                   	push   %eax
+  803ae8:	e8 81 da ff ff       	call   80156e <sys_futex_wake>
+  803aed:	83 c4 10             	add    $0x10,%esp
+  803af0:	eb d0                	jmp    803ac2 <devpipe_write+0x15a>
+				return 0;
+  803af2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803af7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803afa:	5b                   	pop    %ebx
+  803afb:	5e                   	pop    %esi
+  803afc:	5f                   	pop    %edi
+  803afd:	5d                   	pop    %ebp
+  803afe:	c3                   	ret
+
+00803aff <devpipe_stat>:
+{
+  803aff:	55                   	push   %ebp
+  803b00:	89 e5                	mov    %esp,%ebp
+  803b02:	56                   	push   %esi
+  803b03:	53                   	push   %ebx
+  803b04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b07:	83 ec 0c             	sub    $0xc,%esp
+  803b0a:	ff 75 08             	push   0x8(%ebp)
+  803b0d:	e8 2b e2 ff ff       	call   801d3d <fd2data>
+  803b12:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803b14:	83 c4 08             	add    $0x8,%esp
+  803b17:	68 56 52 80 00       	push   $0x805256
+  803b1c:	53                   	push   %ebx
+  803b1d:	e8 f8 d1 ff ff       	call   800d1a <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b22:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b25:	8b 06                	mov    (%esi),%eax
+  803b27:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b2d:	29 c1                	sub    %eax,%ecx
+  803b2f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b34:	89 c8                	mov    %ecx,%eax
+  803b36:	f7 e2                	mul    %edx
+  803b38:	c1 ea 0c             	shr    $0xc,%edx
+  803b3b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b41:	29 d1                	sub    %edx,%ecx
+  803b43:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803b49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803b50:	00 00 00 
+	stat->st_dev = &devpipe;
+  803b53:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  803b5a:	60 80 00 
+}
+  803b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b65:	5b                   	pop    %ebx
+  803b66:	5e                   	pop    %esi
+  803b67:	5d                   	pop    %ebp
+  803b68:	c3                   	ret
+
+00803b69 <devpipe_poll>:
+{
+  803b69:	55                   	push   %ebp
+  803b6a:	89 e5                	mov    %esp,%ebp
+  803b6c:	57                   	push   %edi
+  803b6d:	56                   	push   %esi
+  803b6e:	53                   	push   %ebx
+  803b6f:	83 ec 18             	sub    $0x18,%esp
+  803b72:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b75:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b78:	57                   	push   %edi
+  803b79:	e8 bf e1 ff ff       	call   801d3d <fd2data>
+  803b7e:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803b80:	83 c4 10             	add    $0x10,%esp
+  803b83:	89 f3                	mov    %esi,%ebx
+  803b85:	83 e3 01             	and    $0x1,%ebx
+  803b88:	75 27                	jne    803bb1 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803b8a:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803b90:	75 48                	jne    803bda <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803b92:	89 ca                	mov    %ecx,%edx
+  803b94:	89 f8                	mov    %edi,%eax
+  803b96:	e8 ce fb ff ff       	call   803769 <_pipeisclosed>
+  803b9b:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803b9d:	89 d8                	mov    %ebx,%eax
+  803b9f:	83 c8 10             	or     $0x10,%eax
+  803ba2:	85 d2                	test   %edx,%edx
+  803ba4:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803ba7:	89 d8                	mov    %ebx,%eax
+  803ba9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bac:	5b                   	pop    %ebx
+  803bad:	5e                   	pop    %esi
+  803bae:	5f                   	pop    %edi
+  803baf:	5d                   	pop    %ebp
+  803bb0:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803bb1:	8b 58 04             	mov    0x4(%eax),%ebx
+  803bb4:	8b 00                	mov    (%eax),%eax
+  803bb6:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803bbc:	29 c3                	sub    %eax,%ebx
+  803bbe:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803bc3:	89 d8                	mov    %ebx,%eax
+  803bc5:	f7 e2                	mul    %edx
+  803bc7:	c1 ea 0c             	shr    $0xc,%edx
+  803bca:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803bd0:	39 d3                	cmp    %edx,%ebx
+  803bd2:	0f 95 c3             	setne  %bl
+  803bd5:	0f b6 db             	movzbl %bl,%ebx
+  803bd8:	eb b0                	jmp    803b8a <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803bda:	8b 71 04             	mov    0x4(%ecx),%esi
+  803bdd:	8b 01                	mov    (%ecx),%eax
+  803bdf:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803be5:	29 c6                	sub    %eax,%esi
+  803be7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803bec:	89 f0                	mov    %esi,%eax
+  803bee:	f7 e2                	mul    %edx
+  803bf0:	c1 ea 0c             	shr    $0xc,%edx
+  803bf3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803bf9:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803bfb:	89 d8                	mov    %ebx,%eax
+  803bfd:	83 c8 04             	or     $0x4,%eax
+  803c00:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803c06:	0f 42 d8             	cmovb  %eax,%ebx
+  803c09:	eb 87                	jmp    803b92 <devpipe_poll+0x29>
+
+00803c0b <pipe>:
+{
+  803c0b:	55                   	push   %ebp
+  803c0c:	89 e5                	mov    %esp,%ebp
+  803c0e:	56                   	push   %esi
+  803c0f:	53                   	push   %ebx
+  803c10:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803c13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c16:	50                   	push   %eax
+  803c17:	e8 38 e1 ff ff       	call   801d54 <fd_alloc>
+  803c1c:	89 c3                	mov    %eax,%ebx
+  803c1e:	83 c4 10             	add    $0x10,%esp
+  803c21:	85 c0                	test   %eax,%eax
+  803c23:	0f 88 23 01 00 00    	js     803d4c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c29:	83 ec 04             	sub    $0x4,%esp
+  803c2c:	68 07 04 00 00       	push   $0x407
+  803c31:	ff 75 f4             	push   -0xc(%ebp)
+  803c34:	6a 00                	push   $0x0
+  803c36:	e8 13 d5 ff ff       	call   80114e <sys_page_alloc>
+  803c3b:	89 c3                	mov    %eax,%ebx
+  803c3d:	83 c4 10             	add    $0x10,%esp
+  803c40:	85 c0                	test   %eax,%eax
+  803c42:	0f 88 04 01 00 00    	js     803d4c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803c48:	83 ec 0c             	sub    $0xc,%esp
+  803c4b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803c4e:	50                   	push   %eax
+  803c4f:	e8 00 e1 ff ff       	call   801d54 <fd_alloc>
+  803c54:	89 c3                	mov    %eax,%ebx
+  803c56:	83 c4 10             	add    $0x10,%esp
+  803c59:	85 c0                	test   %eax,%eax
+  803c5b:	0f 88 db 00 00 00    	js     803d3c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c61:	83 ec 04             	sub    $0x4,%esp
+  803c64:	68 07 04 00 00       	push   $0x407
+  803c69:	ff 75 f0             	push   -0x10(%ebp)
+  803c6c:	6a 00                	push   $0x0
+  803c6e:	e8 db d4 ff ff       	call   80114e <sys_page_alloc>
+  803c73:	89 c3                	mov    %eax,%ebx
+  803c75:	83 c4 10             	add    $0x10,%esp
+  803c78:	85 c0                	test   %eax,%eax
+  803c7a:	0f 88 bc 00 00 00    	js     803d3c <pipe+0x131>
+	va = fd2data(fd0);
+  803c80:	83 ec 0c             	sub    $0xc,%esp
+  803c83:	ff 75 f4             	push   -0xc(%ebp)
+  803c86:	e8 b2 e0 ff ff       	call   801d3d <fd2data>
+  803c8b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c8d:	83 c4 0c             	add    $0xc,%esp
+  803c90:	68 07 04 00 00       	push   $0x407
+  803c95:	50                   	push   %eax
+  803c96:	6a 00                	push   $0x0
+  803c98:	e8 b1 d4 ff ff       	call   80114e <sys_page_alloc>
+  803c9d:	89 c3                	mov    %eax,%ebx
+  803c9f:	83 c4 10             	add    $0x10,%esp
+  803ca2:	85 c0                	test   %eax,%eax
+  803ca4:	0f 88 82 00 00 00    	js     803d2c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803caa:	83 ec 0c             	sub    $0xc,%esp
+  803cad:	ff 75 f0             	push   -0x10(%ebp)
+  803cb0:	e8 88 e0 ff ff       	call   801d3d <fd2data>
+  803cb5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803cbc:	50                   	push   %eax
+  803cbd:	6a 00                	push   $0x0
+  803cbf:	56                   	push   %esi
+  803cc0:	6a 00                	push   $0x0
+  803cc2:	e8 ca d4 ff ff       	call   801191 <sys_page_map>
+  803cc7:	89 c3                	mov    %eax,%ebx
+  803cc9:	83 c4 20             	add    $0x20,%esp
+  803ccc:	85 c0                	test   %eax,%eax
+  803cce:	78 4e                	js     803d1e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803cd0:	a1 60 60 80 00       	mov    0x806060,%eax
+  803cd5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803cd8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803cda:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803cdd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803ce4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803ce7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803ce9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803cec:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803cf3:	83 ec 0c             	sub    $0xc,%esp
+  803cf6:	ff 75 f4             	push   -0xc(%ebp)
+  803cf9:	e8 2f e0 ff ff       	call   801d2d <fd2num>
+  803cfe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d01:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803d03:	83 c4 04             	add    $0x4,%esp
+  803d06:	ff 75 f0             	push   -0x10(%ebp)
+  803d09:	e8 1f e0 ff ff       	call   801d2d <fd2num>
+  803d0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d11:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803d14:	83 c4 10             	add    $0x10,%esp
+  803d17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d1c:	eb 2e                	jmp    803d4c <pipe+0x141>
+	sys_page_unmap(0, va);
+  803d1e:	83 ec 08             	sub    $0x8,%esp
+  803d21:	56                   	push   %esi
+  803d22:	6a 00                	push   $0x0
+  803d24:	e8 aa d4 ff ff       	call   8011d3 <sys_page_unmap>
+  803d29:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803d2c:	83 ec 08             	sub    $0x8,%esp
+  803d2f:	ff 75 f0             	push   -0x10(%ebp)
+  803d32:	6a 00                	push   $0x0
+  803d34:	e8 9a d4 ff ff       	call   8011d3 <sys_page_unmap>
+  803d39:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803d3c:	83 ec 08             	sub    $0x8,%esp
+  803d3f:	ff 75 f4             	push   -0xc(%ebp)
+  803d42:	6a 00                	push   $0x0
+  803d44:	e8 8a d4 ff ff       	call   8011d3 <sys_page_unmap>
+  803d49:	83 c4 10             	add    $0x10,%esp
+}
+  803d4c:	89 d8                	mov    %ebx,%eax
+  803d4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d51:	5b                   	pop    %ebx
+  803d52:	5e                   	pop    %esi
+  803d53:	5d                   	pop    %ebp
+  803d54:	c3                   	ret
+
+00803d55 <pipeisclosed>:
+{
+  803d55:	55                   	push   %ebp
+  803d56:	89 e5                	mov    %esp,%ebp
+  803d58:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d5e:	50                   	push   %eax
+  803d5f:	ff 75 08             	push   0x8(%ebp)
+  803d62:	e8 3d e0 ff ff       	call   801da4 <fd_lookup>
+  803d67:	83 c4 10             	add    $0x10,%esp
+  803d6a:	85 c0                	test   %eax,%eax
+  803d6c:	78 18                	js     803d86 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803d6e:	83 ec 0c             	sub    $0xc,%esp
+  803d71:	ff 75 f4             	push   -0xc(%ebp)
+  803d74:	e8 c4 df ff ff       	call   801d3d <fd2data>
+  803d79:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803d7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d7e:	e8 e6 f9 ff ff       	call   803769 <_pipeisclosed>
+  803d83:	83 c4 10             	add    $0x10,%esp
+}
+  803d86:	c9                   	leave
+  803d87:	c3                   	ret
+
+00803d88 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803d88:	55                   	push   %ebp
+  803d89:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d8e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d94:	5d                   	pop    %ebp
+  803d95:	c3                   	ret
+
+00803d96 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803d96:	55                   	push   %ebp
+  803d97:	89 e5                	mov    %esp,%ebp
+  803d99:	53                   	push   %ebx
+  803d9a:	83 ec 04             	sub    $0x4,%esp
+  803d9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803da0:	8b 03                	mov    (%ebx),%eax
+  803da2:	85 c0                	test   %eax,%eax
+  803da4:	75 05                	jne    803dab <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803da6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803da9:	c9                   	leave
+  803daa:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803dab:	83 ec 08             	sub    $0x8,%esp
+  803dae:	50                   	push   %eax
+  803daf:	8d 43 04             	lea    0x4(%ebx),%eax
+  803db2:	50                   	push   %eax
+  803db3:	e8 6b d6 ff ff       	call   801423 <sys_page_batch>
+	pb->pb_n = 0;
+  803db8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803dbe:	83 c4 10             	add    $0x10,%esp
+  803dc1:	eb e3                	jmp    803da6 <pgbatch_flush+0x10>
+
+00803dc3 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803dc3:	55                   	push   %ebp
+  803dc4:	89 e5                	mov    %esp,%ebp
+  803dc6:	56                   	push   %esi
+  803dc7:	53                   	push   %ebx
+  803dc8:	89 c3                	mov    %eax,%ebx
+  803dca:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803dcc:	83 38 20             	cmpl   $0x20,(%eax)
+  803dcf:	74 2c                	je     803dfd <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803dd1:	8b 03                	mov    (%ebx),%eax
+  803dd3:	8d 50 01             	lea    0x1(%eax),%edx
+  803dd6:	89 13                	mov    %edx,(%ebx)
+  803dd8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803ddb:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803ddf:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803de1:	83 ec 04             	sub    $0x4,%esp
+  803de4:	6a 18                	push   $0x18
+  803de6:	6a 00                	push   $0x0
+  803de8:	50                   	push   %eax
+  803de9:	e8 a7 d0 ff ff       	call   800e95 <memset>
+	return 0;
+  803dee:	83 c4 10             	add    $0x10,%esp
+  803df1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803df6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803df9:	5b                   	pop    %ebx
+  803dfa:	5e                   	pop    %esi
+  803dfb:	5d                   	pop    %ebp
+  803dfc:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803dfd:	83 ec 0c             	sub    $0xc,%esp
+  803e00:	50                   	push   %eax
+  803e01:	e8 90 ff ff ff       	call   803d96 <pgbatch_flush>
+  803e06:	83 c4 10             	add    $0x10,%esp
+  803e09:	85 c0                	test   %eax,%eax
+  803e0b:	79 c4                	jns    803dd1 <pgbatch_slot+0xe>
+  803e0d:	eb e7                	jmp    803df6 <pgbatch_slot+0x33>
+
+00803e0f <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803e0f:	55                   	push   %ebp
+  803e10:	89 e5                	mov    %esp,%ebp
+  803e12:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e15:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e18:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e1b:	e8 a3 ff ff ff       	call   803dc3 <pgbatch_slot>
+  803e20:	85 c0                	test   %eax,%eax
+  803e22:	78 20                	js     803e44 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803e24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e27:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803e2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e30:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e33:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e36:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e39:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e3c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e44:	c9                   	leave
+  803e45:	c3                   	ret
+
+00803e46 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803e46:	55                   	push   %ebp
+  803e47:	89 e5                	mov    %esp,%ebp
+  803e49:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e4c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e52:	e8 6c ff ff ff       	call   803dc3 <pgbatch_slot>
+  803e57:	85 c0                	test   %eax,%eax
+  803e59:	78 2c                	js     803e87 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803e5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e5e:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803e64:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e67:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803e6a:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e6d:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e70:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e73:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803e76:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e79:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e7c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803e7f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e87:	c9                   	leave
+  803e88:	c3                   	ret
+
+00803e89 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803e89:	55                   	push   %ebp
+  803e8a:	89 e5                	mov    %esp,%ebp
+  803e8c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e8f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e92:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e95:	e8 29 ff ff ff       	call   803dc3 <pgbatch_slot>
+  803e9a:	85 c0                	test   %eax,%eax
+  803e9c:	78 1a                	js     803eb8 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803e9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ea1:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803ea7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803eaa:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803ead:	8b 55 10             	mov    0x10(%ebp),%edx
+  803eb0:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eb8:	c9                   	leave
+  803eb9:	c3                   	ret
+
+00803eba <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803eba:	55                   	push   %ebp
+  803ebb:	89 e5                	mov    %esp,%ebp
+  803ebd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ec0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ec3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ec6:	e8 f8 fe ff ff       	call   803dc3 <pgbatch_slot>
+  803ecb:	85 c0                	test   %eax,%eax
+  803ecd:	78 20                	js     803eef <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803ecf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ed2:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803ed8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803edb:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803ede:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ee1:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ee4:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ee7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803eea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eef:	c9                   	leave
+  803ef0:	c3                   	ret
+
+00803ef1 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803ef1:	55                   	push   %ebp
+  803ef2:	89 e5                	mov    %esp,%ebp
+  803ef4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ef7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803efa:	8b 45 08             	mov    0x8(%ebp),%eax
+  803efd:	e8 c1 fe ff ff       	call   803dc3 <pgbatch_slot>
+  803f02:	85 c0                	test   %eax,%eax
+  803f04:	78 26                	js     803f2c <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803f06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f09:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803f0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f12:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803f15:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f18:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803f1b:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f1e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803f21:	8b 55 18             	mov    0x18(%ebp),%edx
+  803f24:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f2c:	c9                   	leave
+  803f2d:	c3                   	ret
+
+00803f2e <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803f2e:	55                   	push   %ebp
+  803f2f:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803f31:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f34:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803f3a:	5d                   	pop    %ebp
+  803f3b:	c3                   	ret
+
+00803f3c <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803f3c:	55                   	push   %ebp
+  803f3d:	89 e5                	mov    %esp,%ebp
+  803f3f:	56                   	push   %esi
+  803f40:	53                   	push   %ebx
+  803f41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f49:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f4e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803f52:	85 c0                	test   %eax,%eax
+  803f54:	74 2f                	je     803f85 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803f56:	83 f8 02             	cmp    $0x2,%eax
+  803f59:	74 0c                	je     803f67 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803f5b:	b8 02 00 00 00       	mov    $0x2,%eax
+  803f60:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803f63:	85 c0                	test   %eax,%eax
+  803f65:	74 1e                	je     803f85 <mutex_lock+0x49>
+  803f67:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803f6c:	83 ec 04             	sub    $0x4,%esp
+  803f6f:	6a ff                	push   $0xffffffff
+  803f71:	6a 02                	push   $0x2
+  803f73:	53                   	push   %ebx
+  803f74:	e8 d3 d5 ff ff       	call   80154c <sys_futex_wait>
+  803f79:	89 f0                	mov    %esi,%eax
+  803f7b:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803f7e:	83 c4 10             	add    $0x10,%esp
+  803f81:	85 c0                	test   %eax,%eax
+  803f83:	75 e7                	jne    803f6c <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803f85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f88:	5b                   	pop    %ebx
+  803f89:	5e                   	pop    %esi
+  803f8a:	5d                   	pop    %ebp
+  803f8b:	c3                   	ret
+
+00803f8c <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803f8c:	55                   	push   %ebp
+  803f8d:	89 e5                	mov    %esp,%ebp
+  803f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f97:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803f9c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803fa0:	85 c0                	test   %eax,%eax
+  803fa2:	0f 94 c0             	sete   %al
+  803fa5:	0f b6 c0             	movzbl %al,%eax
+}
+  803fa8:	5d                   	pop    %ebp
+  803fa9:	c3                   	ret
+
+00803faa <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803faa:	55                   	push   %ebp
+  803fab:	89 e5                	mov    %esp,%ebp
+  803fad:	83 ec 08             	sub    $0x8,%esp
+  803fb0:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb8:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803fbb:	83 f8 02             	cmp    $0x2,%eax
+  803fbe:	74 02                	je     803fc2 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803fc0:	c9                   	leave
+  803fc1:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803fc2:	83 ec 08             	sub    $0x8,%esp
+  803fc5:	6a 01                	push   $0x1
+  803fc7:	52                   	push   %edx
+  803fc8:	e8 a1 d5 ff ff       	call   80156e <sys_futex_wake>
+  803fcd:	83 c4 10             	add    $0x10,%esp
+}
+  803fd0:	eb ee                	jmp    803fc0 <mutex_unlock+0x16>
+
+00803fd2 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803fd2:	55                   	push   %ebp
+  803fd3:	89 e5                	mov    %esp,%ebp
+  803fd5:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803fd8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803fde:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803fe5:	5d                   	pop    %ebp
+  803fe6:	c3                   	ret
+
+00803fe7 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803fe7:	55                   	push   %ebp
+  803fe8:	89 e5                	mov    %esp,%ebp
+  803fea:	57                   	push   %edi
+  803feb:	56                   	push   %esi
+  803fec:	53                   	push   %ebx
+  803fed:	83 ec 18             	sub    $0x18,%esp
+  803ff0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ff3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803ff6:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803ff8:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ffd:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804002:	57                   	push   %edi
+  804003:	e8 a2 ff ff ff       	call   803faa <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804008:	83 c4 0c             	add    $0xc,%esp
+  80400b:	ff 75 10             	push   0x10(%ebp)
+  80400e:	56                   	push   %esi
+  80400f:	53                   	push   %ebx
+  804010:	e8 37 d5 ff ff       	call   80154c <sys_futex_wait>
+  804015:	89 c6                	mov    %eax,%esi
+  804017:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80401c:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804021:	89 3c 24             	mov    %edi,(%esp)
+  804024:	e8 13 ff ff ff       	call   803f3c <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804029:	83 c4 10             	add    $0x10,%esp
+  80402c:	83 fe ef             	cmp    $0xffffffef,%esi
+  80402f:	74 05                	je     804036 <cond_timedwait+0x4f>
+  804031:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804036:	89 f0                	mov    %esi,%eax
+  804038:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80403b:	5b                   	pop    %ebx
+  80403c:	5e                   	pop    %esi
+  80403d:	5f                   	pop    %edi
+  80403e:	5d                   	pop    %ebp
+  80403f:	c3                   	ret
+
+00804040 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804040:	55                   	push   %ebp
+  804041:	89 e5                	mov    %esp,%ebp
+  804043:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804046:	6a ff                	push   $0xffffffff
+  804048:	ff 75 0c             	push   0xc(%ebp)
+  80404b:	ff 75 08             	push   0x8(%ebp)
+  80404e:	e8 94 ff ff ff       	call   803fe7 <cond_timedwait>
+}
+  804053:	83 c4 10             	add    $0x10,%esp
+  804056:	c9                   	leave
+  804057:	c3                   	ret
+
+00804058 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804058:	55                   	push   %ebp
+  804059:	89 e5                	mov    %esp,%ebp
+  80405b:	83 ec 08             	sub    $0x8,%esp
+  80405e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804061:	ba 01 00 00 00       	mov    $0x1,%edx
+  804066:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  80406a:	8b 50 04             	mov    0x4(%eax),%edx
+  80406d:	85 d2                	test   %edx,%edx
+  80406f:	75 02                	jne    804073 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  804071:	c9                   	leave
+  804072:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804073:	83 ec 08             	sub    $0x8,%esp
+  804076:	6a 01                	push   $0x1
+  804078:	50                   	push   %eax
+  804079:	e8 f0 d4 ff ff       	call   80156e <sys_futex_wake>
+  80407e:	83 c4 10             	add    $0x10,%esp
+}
+  804081:	eb ee                	jmp    804071 <cond_signal+0x19>
+
+00804083 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804083:	55                   	push   %ebp
+  804084:	89 e5                	mov    %esp,%ebp
+  804086:	83 ec 08             	sub    $0x8,%esp
+  804089:	8b 45 08             	mov    0x8(%ebp),%eax
+  80408c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804091:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804095:	8b 50 04             	mov    0x4(%eax),%edx
+  804098:	85 d2                	test   %edx,%edx
+  80409a:	75 02                	jne    80409e <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  80409c:	c9                   	leave
+  80409d:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  80409e:	83 ec 08             	sub    $0x8,%esp
+  8040a1:	68 00 04 00 00       	push   $0x400
+  8040a6:	50                   	push   %eax
+  8040a7:	e8 c2 d4 ff ff       	call   80156e <sys_futex_wake>
+  8040ac:	83 c4 10             	add    $0x10,%esp
+}
+  8040af:	eb eb                	jmp    80409c <cond_broadcast+0x19>
+
+008040b1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8040b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b6:	c3                   	ret
+
+008040b7 <devcons_poll>:
+{
+  8040b7:	55                   	push   %ebp
+  8040b8:	89 e5                	mov    %esp,%ebp
+  8040ba:	53                   	push   %ebx
+  8040bb:	83 ec 04             	sub    $0x4,%esp
+  8040be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8040c1:	89 da                	mov    %ebx,%edx
+  8040c3:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8040c6:	83 3d f4 81 80 00 00 	cmpl   $0x0,0x8081f4
+  8040cd:	74 0c                	je     8040db <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8040cf:	89 d8                	mov    %ebx,%eax
+  8040d1:	83 e0 01             	and    $0x1,%eax
+  8040d4:	09 d0                	or     %edx,%eax
+}
+  8040d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040d9:	c9                   	leave
+  8040da:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8040db:	e8 d0 cf ff ff       	call   8010b0 <sys_cgetc>
+  8040e0:	a3 f4 81 80 00       	mov    %eax,0x8081f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8040e5:	89 da                	mov    %ebx,%edx
+  8040e7:	83 e2 04             	and    $0x4,%edx
+  8040ea:	85 c0                	test   %eax,%eax
+  8040ec:	74 e6                	je     8040d4 <devcons_poll+0x1d>
+  8040ee:	eb df                	jmp    8040cf <devcons_poll+0x18>
+
+008040f0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8040f0:	55                   	push   %ebp
+  8040f1:	89 e5                	mov    %esp,%ebp
+  8040f3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8040f6:	68 62 52 80 00       	push   $0x805262
+  8040fb:	ff 75 0c             	push   0xc(%ebp)
+  8040fe:	e8 17 cc ff ff       	call   800d1a <strcpy>
+	return 0;
+}
+  804103:	b8 00 00 00 00       	mov    $0x0,%eax
+  804108:	c9                   	leave
+  804109:	c3                   	ret
+
+0080410a <devcons_write>:
+{
+  80410a:	55                   	push   %ebp
+  80410b:	89 e5                	mov    %esp,%ebp
+  80410d:	57                   	push   %edi
+  80410e:	56                   	push   %esi
+  80410f:	53                   	push   %ebx
+  804110:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804116:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804119:	85 ff                	test   %edi,%edi
+  80411b:	74 51                	je     80416e <devcons_write+0x64>
+  80411d:	be 00 00 00 00       	mov    $0x0,%esi
+  804122:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804127:	89 fb                	mov    %edi,%ebx
+  804129:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80412b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804130:	39 d3                	cmp    %edx,%ebx
+  804132:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804135:	83 ec 04             	sub    $0x4,%esp
+  804138:	53                   	push   %ebx
+  804139:	03 45 0c             	add    0xc(%ebp),%eax
+  80413c:	50                   	push   %eax
+  80413d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804143:	50                   	push   %eax
+  804144:	e8 81 cd ff ff       	call   800eca <memmove>
+		sys_cputs(buf, m);
+  804149:	83 c4 08             	add    $0x8,%esp
+  80414c:	53                   	push   %ebx
+  80414d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804153:	50                   	push   %eax
+  804154:	e8 39 cf ff ff       	call   801092 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804159:	01 de                	add    %ebx,%esi
+  80415b:	89 f0                	mov    %esi,%eax
+  80415d:	83 c4 10             	add    $0x10,%esp
+  804160:	39 fe                	cmp    %edi,%esi
+  804162:	72 c3                	jb     804127 <devcons_write+0x1d>
+}
+  804164:	89 f0                	mov    %esi,%eax
+  804166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804169:	5b                   	pop    %ebx
+  80416a:	5e                   	pop    %esi
+  80416b:	5f                   	pop    %edi
+  80416c:	5d                   	pop    %ebp
+  80416d:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80416e:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804173:	eb ef                	jmp    804164 <devcons_write+0x5a>
+
+00804175 <devcons_read>:
+{
+  804175:	55                   	push   %ebp
+  804176:	89 e5                	mov    %esp,%ebp
+  804178:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80417b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  804180:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804184:	74 36                	je     8041bc <devcons_read+0x47>
+	c = cons_peek;
+  804186:	a1 f4 81 80 00       	mov    0x8081f4,%eax
+	cons_peek = 0;
+  80418b:	c7 05 f4 81 80 00 00 	movl   $0x0,0x8081f4
+  804192:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804195:	85 c0                	test   %eax,%eax
+  804197:	75 10                	jne    8041a9 <devcons_read+0x34>
+  804199:	e8 12 cf ff ff       	call   8010b0 <sys_cgetc>
+  80419e:	85 c0                	test   %eax,%eax
+  8041a0:	75 07                	jne    8041a9 <devcons_read+0x34>
+		sys_yield();
+  8041a2:	e8 88 cf ff ff       	call   80112f <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8041a7:	eb f0                	jmp    804199 <devcons_read+0x24>
+	if (c < 0)
+  8041a9:	85 c0                	test   %eax,%eax
+  8041ab:	78 0f                	js     8041bc <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8041ad:	83 f8 04             	cmp    $0x4,%eax
+  8041b0:	74 0c                	je     8041be <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8041b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8041b5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8041b7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8041bc:	c9                   	leave
+  8041bd:	c3                   	ret
+		return 0;
+  8041be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c3:	eb f7                	jmp    8041bc <devcons_read+0x47>
+
+008041c5 <cputchar>:
+{
+  8041c5:	55                   	push   %ebp
+  8041c6:	89 e5                	mov    %esp,%ebp
+  8041c8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8041cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041ce:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8041d1:	6a 01                	push   $0x1
+  8041d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8041d6:	50                   	push   %eax
+  8041d7:	e8 b6 ce ff ff       	call   801092 <sys_cputs>
+}
+  8041dc:	83 c4 10             	add    $0x10,%esp
+  8041df:	c9                   	leave
+  8041e0:	c3                   	ret
+
+008041e1 <getchar>:
+{
+  8041e1:	55                   	push   %ebp
+  8041e2:	89 e5                	mov    %esp,%ebp
+  8041e4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8041e7:	6a 01                	push   $0x1
+  8041e9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8041ec:	50                   	push   %eax
+  8041ed:	6a 00                	push   $0x0
+  8041ef:	e8 34 de ff ff       	call   802028 <read>
+	if (r < 0)
+  8041f4:	83 c4 10             	add    $0x10,%esp
+  8041f7:	85 c0                	test   %eax,%eax
+  8041f9:	78 06                	js     804201 <getchar+0x20>
+	if (r < 1)
+  8041fb:	74 06                	je     804203 <getchar+0x22>
+	return c;
+  8041fd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804201:	c9                   	leave
+  804202:	c3                   	ret
+		return -E_EOF;
+  804203:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804208:	eb f7                	jmp    804201 <getchar+0x20>
+
+0080420a <iscons>:
+{
+  80420a:	55                   	push   %ebp
+  80420b:	89 e5                	mov    %esp,%ebp
+  80420d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804210:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804213:	50                   	push   %eax
+  804214:	ff 75 08             	push   0x8(%ebp)
+  804217:	e8 88 db ff ff       	call   801da4 <fd_lookup>
+  80421c:	83 c4 10             	add    $0x10,%esp
+  80421f:	85 c0                	test   %eax,%eax
+  804221:	78 11                	js     804234 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804223:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804226:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  80422c:	39 10                	cmp    %edx,(%eax)
+  80422e:	0f 94 c0             	sete   %al
+  804231:	0f b6 c0             	movzbl %al,%eax
+}
+  804234:	c9                   	leave
+  804235:	c3                   	ret
+
+00804236 <opencons>:
+{
+  804236:	55                   	push   %ebp
+  804237:	89 e5                	mov    %esp,%ebp
+  804239:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80423c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80423f:	50                   	push   %eax
+  804240:	e8 0f db ff ff       	call   801d54 <fd_alloc>
+  804245:	83 c4 10             	add    $0x10,%esp
+  804248:	85 c0                	test   %eax,%eax
+  80424a:	78 3a                	js     804286 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80424c:	83 ec 04             	sub    $0x4,%esp
+  80424f:	68 07 04 00 00       	push   $0x407
+  804254:	ff 75 f4             	push   -0xc(%ebp)
+  804257:	6a 00                	push   $0x0
+  804259:	e8 f0 ce ff ff       	call   80114e <sys_page_alloc>
+  80425e:	83 c4 10             	add    $0x10,%esp
+  804261:	85 c0                	test   %eax,%eax
+  804263:	78 21                	js     804286 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804265:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804268:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  80426e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804270:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804273:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80427a:	83 ec 0c             	sub    $0xc,%esp
+  80427d:	50                   	push   %eax
+  80427e:	e8 aa da ff ff       	call   801d2d <fd2num>
+  804283:	83 c4 10             	add    $0x10,%esp
+}
+  804286:	c9                   	leave
+  804287:	c3                   	ret
+
+00804288 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804288:	55                   	push   %ebp
+  804289:	89 e5                	mov    %esp,%ebp
+  80428b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80428e:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  804295:	74 0a                	je     8042a1 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80429a:	a3 00 b0 80 00       	mov    %eax,0x80b000
+}
+  80429f:	c9                   	leave
+  8042a0:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8042a1:	83 ec 04             	sub    $0x4,%esp
+  8042a4:	6a 07                	push   $0x7
+  8042a6:	68 00 f0 bf ee       	push   $0xeebff000
+  8042ab:	6a 00                	push   $0x0
+  8042ad:	e8 9c ce ff ff       	call   80114e <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8042b2:	83 c4 08             	add    $0x8,%esp
+  8042b5:	68 c6 42 80 00       	push   $0x8042c6
+  8042ba:	6a 00                	push   $0x0
+  8042bc:	e8 d8 cf ff ff       	call   801299 <sys_env_set_pgfault_upcall>
+  8042c1:	83 c4 10             	add    $0x10,%esp
+  8042c4:	eb d1                	jmp    804297 <set_pgfault_handler+0xf>
+
+008042c6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8042c6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8042c7:	a1 00 b0 80 00       	mov    0x80b000,%eax
+	call *%eax
+  8042cc:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8042ce:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  8042d1:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  8042d5:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  8042d8:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  8042dc:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  8042de:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8042e2:	83 c4 08             	add    $0x8,%esp
+	popal;
+  8042e5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8042e6:	83 c4 04             	add    $0x4,%esp
+	popf
+  8042e9:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  8042ea:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  8042eb:	c3                   	ret
+
+008042ec <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8042ec:	55                   	push   %ebp
+  8042ed:	89 e5                	mov    %esp,%ebp
+  8042ef:	56                   	push   %esi
+  8042f0:	53                   	push   %ebx
+  8042f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8042f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8042fa:	85 c0                	test   %eax,%eax
+  8042fc:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804301:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804304:	83 ec 0c             	sub    $0xc,%esp
+  804307:	50                   	push   %eax
+  804308:	e8 f1 cf ff ff       	call   8012fe <sys_ipc_recv>
+  80430d:	83 c4 10             	add    $0x10,%esp
+  804310:	85 c0                	test   %eax,%eax
+  804312:	0f 88 8b 00 00 00    	js     8043a3 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804318:	85 f6                	test   %esi,%esi
+  80431a:	74 2a                	je     804346 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80431c:	89 e2                	mov    %esp,%edx
+  80431e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804323:	29 d0                	sub    %edx,%eax
+  804325:	89 c2                	mov    %eax,%edx
+  804327:	c1 ea 0f             	shr    $0xf,%edx
+  80432a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80432f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804334:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804337:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  80433e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804344:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804346:	85 db                	test   %ebx,%ebx
+  804348:	74 2a                	je     804374 <ipc_recv+0x88>
+  80434a:	89 e2                	mov    %esp,%edx
+  80434c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804351:	29 d0                	sub    %edx,%eax
+  804353:	89 c2                	mov    %eax,%edx
+  804355:	c1 ea 0f             	shr    $0xf,%edx
+  804358:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80435d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804362:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804365:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  80436c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804372:	89 03                	mov    %eax,(%ebx)
+  804374:	89 e2                	mov    %esp,%edx
+  804376:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80437b:	29 d0                	sub    %edx,%eax
+  80437d:	89 c2                	mov    %eax,%edx
+  80437f:	c1 ea 0f             	shr    $0xf,%edx
+  804382:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80438c:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80438f:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  804396:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80439c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80439f:	5b                   	pop    %ebx
+  8043a0:	5e                   	pop    %esi
+  8043a1:	5d                   	pop    %ebp
+  8043a2:	c3                   	ret
+		if(from_env_store != NULL)
+  8043a3:	85 f6                	test   %esi,%esi
+  8043a5:	74 06                	je     8043ad <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8043a7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8043ad:	85 db                	test   %ebx,%ebx
+  8043af:	74 eb                	je     80439c <ipc_recv+0xb0>
+			*perm_store = 0;
+  8043b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8043b7:	eb e3                	jmp    80439c <ipc_recv+0xb0>
+
+008043b9 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8043b9:	55                   	push   %ebp
+  8043ba:	89 e5                	mov    %esp,%ebp
+  8043bc:	57                   	push   %edi
+  8043bd:	56                   	push   %esi
+  8043be:	53                   	push   %ebx
+  8043bf:	83 ec 14             	sub    $0x14,%esp
+  8043c2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8043c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043c8:	8b 75 14             	mov    0x14(%ebp),%esi
+  8043cb:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8043ce:	85 c0                	test   %eax,%eax
+  8043d0:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8043d5:	0f 44 c2             	cmove  %edx,%eax
+  8043d8:	ff 75 10             	push   0x10(%ebp)
+  8043db:	50                   	push   %eax
+  8043dc:	e8 7f cf ff ff       	call   801360 <sys_ipc_recv_pages>
+  8043e1:	83 c4 10             	add    $0x10,%esp
+  8043e4:	85 c0                	test   %eax,%eax
+  8043e6:	0f 88 ba 00 00 00    	js     8044a6 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8043ec:	85 ff                	test   %edi,%edi
+  8043ee:	74 2a                	je     80441a <ipc_recv_pages+0x61>
+  8043f0:	89 e2                	mov    %esp,%edx
+  8043f2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043f7:	29 d0                	sub    %edx,%eax
+  8043f9:	89 c2                	mov    %eax,%edx
+  8043fb:	c1 ea 0f             	shr    $0xf,%edx
+  8043fe:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804403:	b8 00 00 00 00       	mov    $0x0,%eax
+  804408:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80440b:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  804412:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804418:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80441a:	85 f6                	test   %esi,%esi
+  80441c:	74 2a                	je     804448 <ipc_recv_pages+0x8f>
+  80441e:	89 e2                	mov    %esp,%edx
+  804420:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804425:	29 d0                	sub    %edx,%eax
+  804427:	89 c2                	mov    %eax,%edx
+  804429:	c1 ea 0f             	shr    $0xf,%edx
+  80442c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804431:	b8 00 00 00 00       	mov    $0x0,%eax
+  804436:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804439:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  804440:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804446:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804448:	85 db                	test   %ebx,%ebx
+  80444a:	74 2a                	je     804476 <ipc_recv_pages+0xbd>
+  80444c:	89 e2                	mov    %esp,%edx
+  80444e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804453:	29 d0                	sub    %edx,%eax
+  804455:	89 c2                	mov    %eax,%edx
+  804457:	c1 ea 0f             	shr    $0xf,%edx
+  80445a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80445f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804464:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804467:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  80446e:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804474:	89 03                	mov    %eax,(%ebx)
+  804476:	89 e2                	mov    %esp,%edx
+  804478:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80447d:	29 d0                	sub    %edx,%eax
+  80447f:	89 c2                	mov    %eax,%edx
+  804481:	c1 ea 0f             	shr    $0xf,%edx
+  804484:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80448e:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804491:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  804498:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80449e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044a1:	5b                   	pop    %ebx
+  8044a2:	5e                   	pop    %esi
+  8044a3:	5f                   	pop    %edi
+  8044a4:	5d                   	pop    %ebp
+  8044a5:	c3                   	ret
+		if (from_env_store)
+  8044a6:	85 ff                	test   %edi,%edi
+  8044a8:	74 06                	je     8044b0 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8044aa:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8044b0:	85 f6                	test   %esi,%esi
+  8044b2:	74 06                	je     8044ba <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8044b4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8044ba:	85 db                	test   %ebx,%ebx
+  8044bc:	74 e0                	je     80449e <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8044be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8044c4:	eb d8                	jmp    80449e <ipc_recv_pages+0xe5>
+
+008044c6 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8044c6:	55                   	push   %ebp
+  8044c7:	89 e5                	mov    %esp,%ebp
+  8044c9:	57                   	push   %edi
+  8044ca:	56                   	push   %esi
+  8044cb:	53                   	push   %ebx
+  8044cc:	83 ec 1c             	sub    $0x1c,%esp
+  8044cf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8044d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8044d5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8044db:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8044df:	75 2b                	jne    80450c <ipc_try_send_pages+0x46>
+  8044e1:	89 e2                	mov    %esp,%edx
+  8044e3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8044e8:	29 d0                	sub    %edx,%eax
+  8044ea:	89 c2                	mov    %eax,%edx
+  8044ec:	c1 ea 0f             	shr    $0xf,%edx
+  8044ef:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8044f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f9:	0f 42 c2             	cmovb  %edx,%eax
+  8044fc:	8b 04 85 20 82 80 00 	mov    0x808220(,%eax,4),%eax
+  804503:	8b 70 48             	mov    0x48(%eax),%esi
+  804506:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80450c:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804512:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804517:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80451a:	85 ff                	test   %edi,%edi
+  80451c:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804521:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804524:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80452a:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804530:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804536:	83 ec 0c             	sub    $0xc,%esp
+  804539:	ff 75 14             	push   0x14(%ebp)
+  80453c:	ff 75 18             	push   0x18(%ebp)
+  80453f:	57                   	push   %edi
+  804540:	ff 75 0c             	push   0xc(%ebp)
+  804543:	ff 75 08             	push   0x8(%ebp)
+  804546:	e8 f4 cd ff ff       	call   80133f <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80454b:	83 c4 20             	add    $0x20,%esp
+  80454e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804551:	75 21                	jne    804574 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804553:	83 ec 04             	sub    $0x4,%esp
+  804556:	6a ff                	push   $0xffffffff
+  804558:	53                   	push   %ebx
+  804559:	ff 75 e4             	push   -0x1c(%ebp)
+  80455c:	e8 eb cf ff ff       	call   80154c <sys_futex_wait>
+  804561:	83 c4 10             	add    $0x10,%esp
+  804564:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804567:	74 c7                	je     804530 <ipc_try_send_pages+0x6a>
+  804569:	85 c0                	test   %eax,%eax
+  80456b:	79 c3                	jns    804530 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80456d:	e8 bd cb ff ff       	call   80112f <sys_yield>
+  804572:	eb bc                	jmp    804530 <ipc_try_send_pages+0x6a>
+	}
+}
+  804574:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804577:	5b                   	pop    %ebx
+  804578:	5e                   	pop    %esi
+  804579:	5f                   	pop    %edi
+  80457a:	5d                   	pop    %ebp
+  80457b:	c3                   	ret
+
+0080457c <ipc_send>:
+{
+  80457c:	55                   	push   %ebp
+  80457d:	89 e5                	mov    %esp,%ebp
+  80457f:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804582:	ff 75 14             	push   0x14(%ebp)
+  804585:	6a 01                	push   $0x1
+  804587:	ff 75 10             	push   0x10(%ebp)
+  80458a:	ff 75 0c             	push   0xc(%ebp)
+  80458d:	ff 75 08             	push   0x8(%ebp)
+  804590:	e8 31 ff ff ff       	call   8044c6 <ipc_try_send_pages>
+  804595:	83 c4 20             	add    $0x20,%esp
+  804598:	85 c0                	test   %eax,%eax
+  80459a:	78 02                	js     80459e <ipc_send+0x22>
+}
+  80459c:	c9                   	leave
+  80459d:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80459e:	50                   	push   %eax
+  80459f:	68 6e 52 80 00       	push   $0x80526e
+  8045a4:	6a 3f                	push   $0x3f
+  8045a6:	68 83 52 80 00       	push   $0x805283
+  8045ab:	e8 98 bf ff ff       	call   800548 <_panic>
+
+008045b0 <ipc_send_pages>:
+{
+  8045b0:	55                   	push   %ebp
+  8045b1:	89 e5                	mov    %esp,%ebp
+  8045b3:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8045b6:	ff 75 18             	push   0x18(%ebp)
+  8045b9:	ff 75 14             	push   0x14(%ebp)
+  8045bc:	ff 75 10             	push   0x10(%ebp)
+  8045bf:	ff 75 0c             	push   0xc(%ebp)
+  8045c2:	ff 75 08             	push   0x8(%ebp)
+  8045c5:	e8 fc fe ff ff       	call   8044c6 <ipc_try_send_pages>
+  8045ca:	83 c4 20             	add    $0x20,%esp
+  8045cd:	85 c0                	test   %eax,%eax
+  8045cf:	78 02                	js     8045d3 <ipc_send_pages+0x23>
+}
+  8045d1:	c9                   	leave
+  8045d2:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8045d3:	50                   	push   %eax
+  8045d4:	68 8d 52 80 00       	push   $0x80528d
+  8045d9:	6a 64                	push   $0x64
+  8045db:	68 83 52 80 00       	push   $0x805283
+  8045e0:	e8 63 bf ff ff       	call   800548 <_panic>
+
+008045e5 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8045e5:	55                   	push   %ebp
+  8045e6:	89 e5                	mov    %esp,%ebp
+  8045e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8045eb:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8045f0:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8045f6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8045fc:	8b 52 50             	mov    0x50(%edx),%edx
+  8045ff:	39 ca                	cmp    %ecx,%edx
+  804601:	74 11                	je     804614 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804603:	83 c0 01             	add    $0x1,%eax
+  804606:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80460b:	75 e3                	jne    8045f0 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80460d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804612:	eb 0e                	jmp    804622 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804614:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80461a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80461f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804622:	5d                   	pop    %ebp
+  804623:	c3                   	ret
+
+00804624 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804624:	55                   	push   %ebp
+  804625:	89 e5                	mov    %esp,%ebp
+  804627:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80462a:	89 c2                	mov    %eax,%edx
+  80462c:	c1 ea 16             	shr    $0x16,%edx
+  80462f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804636:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80463b:	f6 c1 01             	test   $0x1,%cl
+  80463e:	74 1e                	je     80465e <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804640:	c1 e8 0c             	shr    $0xc,%eax
+  804643:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80464a:	a8 01                	test   $0x1,%al
+  80464c:	74 10                	je     80465e <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80464e:	c1 e8 0c             	shr    $0xc,%eax
+  804651:	c1 e0 04             	shl    $0x4,%eax
+  804654:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80465b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80465e:	89 d0                	mov    %edx,%eax
+  804660:	5d                   	pop    %ebp
+  804661:	c3                   	ret
+
+00804662 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  804662:	55                   	push   %ebp
+  804663:	89 e5                	mov    %esp,%ebp
+  804665:	57                   	push   %edi
+  804666:	56                   	push   %esi
+  804667:	53                   	push   %ebx
+  804668:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  80466b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80466e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  804671:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  804674:	bf f8 81 80 00       	mov    $0x8081f8,%edi
+  804679:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  80467c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804681:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  804684:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  804687:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  80468c:	f6 e2                	mul    %dl
+  80468e:	66 c1 e8 0b          	shr    $0xb,%ax
+  804692:	89 c7                	mov    %eax,%edi
+  804694:	88 45 e0             	mov    %al,-0x20(%ebp)
+  804697:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  80469a:	01 db                	add    %ebx,%ebx
+  80469c:	89 d0                	mov    %edx,%eax
+  80469e:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  8046a0:	89 d6                	mov    %edx,%esi
+  8046a2:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  8046a4:	89 cb                	mov    %ecx,%ebx
+  8046a6:	83 c1 01             	add    $0x1,%ecx
+  8046a9:	0f b6 fb             	movzbl %bl,%edi
+  8046ac:	83 c0 30             	add    $0x30,%eax
+  8046af:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  8046b3:	89 f0                	mov    %esi,%eax
+  8046b5:	3c 09                	cmp    $0x9,%al
+  8046b7:	77 ce                	ja     804687 <inet_ntoa+0x25>
+  8046b9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8046bc:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8046bf:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  8046c1:	84 c9                	test   %cl,%cl
+  8046c3:	74 4d                	je     804712 <inet_ntoa+0xb0>
+  8046c5:	0f b6 db             	movzbl %bl,%ebx
+  8046c8:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  8046cb:	01 d8                	add    %ebx,%eax
+  8046cd:	89 f9                	mov    %edi,%ecx
+  8046cf:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  8046d2:	83 c1 01             	add    $0x1,%ecx
+  8046d5:	0f b6 10             	movzbl (%eax),%edx
+  8046d8:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  8046db:	89 c2                	mov    %eax,%edx
+  8046dd:	83 e8 01             	sub    $0x1,%eax
+  8046e0:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  8046e3:	39 da                	cmp    %ebx,%edx
+  8046e5:	75 eb                	jne    8046d2 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  8046e7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8046ea:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  8046ee:	8d 78 01             	lea    0x1(%eax),%edi
+  8046f1:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  8046f4:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  8046f7:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8046fa:	39 ce                	cmp    %ecx,%esi
+  8046fc:	0f 85 77 ff ff ff    	jne    804679 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  804702:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  804705:	b8 f8 81 80 00       	mov    $0x8081f8,%eax
+  80470a:	83 c4 1c             	add    $0x1c,%esp
+  80470d:	5b                   	pop    %ebx
+  80470e:	5e                   	pop    %esi
+  80470f:	5f                   	pop    %edi
+  804710:	5d                   	pop    %ebp
+  804711:	c3                   	ret
+    while(i--)
+  804712:	89 f8                	mov    %edi,%eax
+  804714:	eb d8                	jmp    8046ee <inet_ntoa+0x8c>
+
+00804716 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  804716:	55                   	push   %ebp
+  804717:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  804719:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80471d:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  804721:	5d                   	pop    %ebp
+  804722:	c3                   	ret
+
+00804723 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  804723:	55                   	push   %ebp
+  804724:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  804726:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80472a:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  80472e:	5d                   	pop    %ebp
+  80472f:	c3                   	ret
+
+00804730 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  804730:	55                   	push   %ebp
+  804731:	89 e5                	mov    %esp,%ebp
+  804733:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  804736:	89 d0                	mov    %edx,%eax
+  804738:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  80473b:	89 d1                	mov    %edx,%ecx
+  80473d:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  804740:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  804742:	89 d1                	mov    %edx,%ecx
+  804744:	c1 e1 08             	shl    $0x8,%ecx
+  804747:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  80474d:	09 c8                	or     %ecx,%eax
+  80474f:	c1 ea 08             	shr    $0x8,%edx
+  804752:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  804758:	09 d0                	or     %edx,%eax
+}
+  80475a:	5d                   	pop    %ebp
+  80475b:	c3                   	ret
+
+0080475c <inet_aton>:
+{
+  80475c:	55                   	push   %ebp
+  80475d:	89 e5                	mov    %esp,%ebp
+  80475f:	57                   	push   %edi
+  804760:	56                   	push   %esi
+  804761:	53                   	push   %ebx
+  804762:	83 ec 2c             	sub    $0x2c,%esp
+  804765:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  804768:	0f b6 0a             	movzbl (%edx),%ecx
+  80476b:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  80476e:	83 e9 30             	sub    $0x30,%ecx
+  804771:	80 f9 09             	cmp    $0x9,%cl
+  804774:	0f 87 b6 01 00 00    	ja     804930 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  80477a:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  80477d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  804780:	e9 aa 00 00 00       	jmp    80482f <inet_aton+0xd3>
+      c = *++cp;
+  804785:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  804789:	89 c1                	mov    %eax,%ecx
+  80478b:	83 e1 df             	and    $0xffffffdf,%ecx
+  80478e:	80 f9 58             	cmp    $0x58,%cl
+  804791:	74 10                	je     8047a3 <inet_aton+0x47>
+      c = *++cp;
+  804793:	83 c2 01             	add    $0x1,%edx
+  804796:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  804799:	bf 08 00 00 00       	mov    $0x8,%edi
+  80479e:	e9 9a 00 00 00       	jmp    80483d <inet_aton+0xe1>
+        c = *++cp;
+  8047a3:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8047a7:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  8047aa:	bf 10 00 00 00       	mov    $0x10,%edi
+  8047af:	e9 89 00 00 00       	jmp    80483d <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  8047b4:	0f af d7             	imul   %edi,%edx
+  8047b7:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  8047bb:	0f be 01             	movsbl (%ecx),%eax
+  8047be:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  8047c1:	88 45 d7             	mov    %al,-0x29(%ebp)
+  8047c4:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  8047c7:	80 fb 09             	cmp    $0x9,%bl
+  8047ca:	76 e8                	jbe    8047b4 <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  8047cc:	83 ff 10             	cmp    $0x10,%edi
+  8047cf:	75 2e                	jne    8047ff <inet_aton+0xa3>
+  8047d1:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  8047d5:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  8047d8:	83 e3 df             	and    $0xffffffdf,%ebx
+  8047db:	83 eb 41             	sub    $0x41,%ebx
+  8047de:	80 fb 05             	cmp    $0x5,%bl
+  8047e1:	77 1c                	ja     8047ff <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  8047e3:	c1 e2 04             	shl    $0x4,%edx
+  8047e6:	83 c0 0a             	add    $0xa,%eax
+  8047e9:	89 f3                	mov    %esi,%ebx
+  8047eb:	80 fb 1a             	cmp    $0x1a,%bl
+  8047ee:	19 db                	sbb    %ebx,%ebx
+  8047f0:	83 e3 20             	and    $0x20,%ebx
+  8047f3:	83 c3 41             	add    $0x41,%ebx
+  8047f6:	29 d8                	sub    %ebx,%eax
+  8047f8:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  8047fa:	0f be 01             	movsbl (%ecx),%eax
+  8047fd:	eb bf                	jmp    8047be <inet_aton+0x62>
+    if (c == '.') {
+  8047ff:	83 f8 2e             	cmp    $0x2e,%eax
+  804802:	75 46                	jne    80484a <inet_aton+0xee>
+      if (pp >= parts + 3)
+  804804:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804807:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80480a:	39 f0                	cmp    %esi,%eax
+  80480c:	0f 84 25 01 00 00    	je     804937 <inet_aton+0x1db>
+      *pp++ = val;
+  804812:	83 c0 04             	add    $0x4,%eax
+  804815:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  804818:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80481b:	89 ca                	mov    %ecx,%edx
+  80481d:	0f b6 09             	movzbl (%ecx),%ecx
+  804820:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  804823:	83 e9 30             	sub    $0x30,%ecx
+  804826:	80 f9 09             	cmp    $0x9,%cl
+  804829:	0f 87 17 01 00 00    	ja     804946 <inet_aton+0x1ea>
+    base = 10;
+  80482f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  804834:	83 f8 30             	cmp    $0x30,%eax
+  804837:	0f 84 48 ff ff ff    	je     804785 <inet_aton+0x29>
+  80483d:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  804840:	ba 00 00 00 00       	mov    $0x0,%edx
+  804845:	e9 77 ff ff ff       	jmp    8047c1 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80484a:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  80484e:	89 d6                	mov    %edx,%esi
+  804850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  804853:	85 c0                	test   %eax,%eax
+  804855:	74 2e                	je     804885 <inet_aton+0x129>
+    return (0);
+  804857:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80485c:	89 fa                	mov    %edi,%edx
+  80485e:	80 fa 1f             	cmp    $0x1f,%dl
+  804861:	0f 86 d5 00 00 00    	jbe    80493c <inet_aton+0x1e0>
+  804867:	84 c0                	test   %al,%al
+  804869:	0f 88 cd 00 00 00    	js     80493c <inet_aton+0x1e0>
+  80486f:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  804872:	83 f9 04             	cmp    $0x4,%ecx
+  804875:	76 0e                	jbe    804885 <inet_aton+0x129>
+    return (0);
+  804877:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80487c:	83 f8 20             	cmp    $0x20,%eax
+  80487f:	0f 85 b7 00 00 00    	jne    80493c <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  804885:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  804888:	89 d8                	mov    %ebx,%eax
+  80488a:	29 c8                	sub    %ecx,%eax
+  80488c:	c1 f8 02             	sar    $0x2,%eax
+  80488f:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  804892:	83 f8 02             	cmp    $0x2,%eax
+  804895:	74 7a                	je     804911 <inet_aton+0x1b5>
+  804897:	83 f9 03             	cmp    $0x3,%ecx
+  80489a:	7f 49                	jg     8048e5 <inet_aton+0x189>
+  80489c:	85 c9                	test   %ecx,%ecx
+  80489e:	0f 84 98 00 00 00    	je     80493c <inet_aton+0x1e0>
+  8048a4:	83 f9 02             	cmp    $0x2,%ecx
+  8048a7:	75 19                	jne    8048c2 <inet_aton+0x166>
+      return (0);
+  8048a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  8048ae:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  8048b4:	0f 87 82 00 00 00    	ja     80493c <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  8048ba:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8048bd:	c1 e0 18             	shl    $0x18,%eax
+  8048c0:	09 c6                	or     %eax,%esi
+  return (1);
+  8048c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  8048c7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8048cb:	74 6f                	je     80493c <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  8048cd:	83 ec 0c             	sub    $0xc,%esp
+  8048d0:	56                   	push   %esi
+  8048d1:	e8 5a fe ff ff       	call   804730 <htonl>
+  8048d6:	83 c4 10             	add    $0x10,%esp
+  8048d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8048dc:	89 06                	mov    %eax,(%esi)
+  return (1);
+  8048de:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8048e3:	eb 57                	jmp    80493c <inet_aton+0x1e0>
+  switch (n) {
+  8048e5:	83 f9 04             	cmp    $0x4,%ecx
+  8048e8:	75 d8                	jne    8048c2 <inet_aton+0x166>
+      return (0);
+  8048ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  8048ef:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  8048f5:	77 45                	ja     80493c <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  8048f7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8048fa:	c1 e0 18             	shl    $0x18,%eax
+  8048fd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  804900:	c1 e1 10             	shl    $0x10,%ecx
+  804903:	09 c8                	or     %ecx,%eax
+  804905:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804908:	c1 e1 08             	shl    $0x8,%ecx
+  80490b:	09 c8                	or     %ecx,%eax
+  80490d:	09 c6                	or     %eax,%esi
+    break;
+  80490f:	eb b1                	jmp    8048c2 <inet_aton+0x166>
+      return (0);
+  804911:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  804916:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80491c:	77 1e                	ja     80493c <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80491e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  804921:	c1 e0 18             	shl    $0x18,%eax
+  804924:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  804927:	c1 e1 10             	shl    $0x10,%ecx
+  80492a:	09 c8                	or     %ecx,%eax
+  80492c:	09 c6                	or     %eax,%esi
+    break;
+  80492e:	eb 92                	jmp    8048c2 <inet_aton+0x166>
+      return (0);
+  804930:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804935:	eb 05                	jmp    80493c <inet_aton+0x1e0>
+        return (0);
+  804937:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  80493c:	89 c8                	mov    %ecx,%eax
+  80493e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804941:	5b                   	pop    %ebx
+  804942:	5e                   	pop    %esi
+  804943:	5f                   	pop    %edi
+  804944:	5d                   	pop    %ebp
+  804945:	c3                   	ret
+      return (0);
+  804946:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80494b:	eb ef                	jmp    80493c <inet_aton+0x1e0>
+
+0080494d <inet_addr>:
+{
+  80494d:	55                   	push   %ebp
+  80494e:	89 e5                	mov    %esp,%ebp
+  804950:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  804953:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804956:	50                   	push   %eax
+  804957:	ff 75 08             	push   0x8(%ebp)
+  80495a:	e8 fd fd ff ff       	call   80475c <inet_aton>
+  80495f:	89 c2                	mov    %eax,%edx
+  804961:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  804964:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  804969:	85 d2                	test   %edx,%edx
+  80496b:	75 02                	jne    80496f <inet_addr+0x22>
+}
+  80496d:	c9                   	leave
+  80496e:	c3                   	ret
+    return (val.s_addr);
+  80496f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804972:	eb f9                	jmp    80496d <inet_addr+0x20>
+
+00804974 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  804974:	55                   	push   %ebp
+  804975:	89 e5                	mov    %esp,%ebp
+  804977:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  80497a:	ff 75 08             	push   0x8(%ebp)
+  80497d:	e8 ae fd ff ff       	call   804730 <htonl>
+  804982:	83 c4 10             	add    $0x10,%esp
+}
+  804985:	c9                   	leave
+  804986:	c3                   	ret
+
+00804987 <__udivdi3>:
+  804987:	57                   	push   %edi
+  804988:	56                   	push   %esi
+  804989:	53                   	push   %ebx
+  80498a:	83 ec 20             	sub    $0x20,%esp
+  80498d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804991:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804995:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804999:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80499d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8049a1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8049a5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8049a9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8049ad:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8049b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049bc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8049c3:	00 
+  8049c4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8049cb:	00 
+  8049cc:	eb 08                	jmp    8049d6 <__udivdi3+0x4f>
+  8049ce:	83 e9 01             	sub    $0x1,%ecx
+  8049d1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8049d4:	74 68                	je     804a3e <__udivdi3+0xb7>
+  8049d6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8049da:	01 c0                	add    %eax,%eax
+  8049dc:	89 c6                	mov    %eax,%esi
+  8049de:	89 d7                	mov    %edx,%edi
+  8049e0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8049e4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8049e8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8049eb:	d3 ea                	shr    %cl,%edx
+  8049ed:	f6 c1 20             	test   $0x20,%cl
+  8049f0:	74 04                	je     8049f6 <__udivdi3+0x6f>
+  8049f2:	89 d0                	mov    %edx,%eax
+  8049f4:	31 d2                	xor    %edx,%edx
+  8049f6:	83 e0 01             	and    $0x1,%eax
+  8049f9:	89 04 24             	mov    %eax,(%esp)
+  8049fc:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804a03:	00 
+  804a04:	8b 04 24             	mov    (%esp),%eax
+  804a07:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804a0b:	09 f0                	or     %esi,%eax
+  804a0d:	09 fa                	or     %edi,%edx
+  804a0f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804a13:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804a17:	39 f0                	cmp    %esi,%eax
+  804a19:	89 d3                	mov    %edx,%ebx
+  804a1b:	19 fb                	sbb    %edi,%ebx
+  804a1d:	72 af                	jb     8049ce <__udivdi3+0x47>
+  804a1f:	29 f0                	sub    %esi,%eax
+  804a21:	19 fa                	sbb    %edi,%edx
+  804a23:	89 cf                	mov    %ecx,%edi
+  804a25:	c1 ef 05             	shr    $0x5,%edi
+  804a28:	83 e7 01             	and    $0x1,%edi
+  804a2b:	89 fe                	mov    %edi,%esi
+  804a2d:	83 f6 01             	xor    $0x1,%esi
+  804a30:	d3 e6                	shl    %cl,%esi
+  804a32:	d3 e7                	shl    %cl,%edi
+  804a34:	09 74 24 18          	or     %esi,0x18(%esp)
+  804a38:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804a3c:	eb 90                	jmp    8049ce <__udivdi3+0x47>
+  804a3e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804a42:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804a46:	83 c4 20             	add    $0x20,%esp
+  804a49:	5b                   	pop    %ebx
+  804a4a:	5e                   	pop    %esi
+  804a4b:	5f                   	pop    %edi
+  804a4c:	c3                   	ret
+
+00804a4d <__umoddi3>:
+  804a4d:	57                   	push   %edi
+  804a4e:	56                   	push   %esi
+  804a4f:	53                   	push   %ebx
+  804a50:	83 ec 08             	sub    $0x8,%esp
+  804a53:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804a57:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804a5b:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804a5f:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804a63:	57                   	push   %edi
+  804a64:	56                   	push   %esi
+  804a65:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804a69:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804a6d:	52                   	push   %edx
+  804a6e:	50                   	push   %eax
+  804a6f:	e8 13 ff ff ff       	call   804987 <__udivdi3>
+  804a74:	89 c3                	mov    %eax,%ebx
+  804a76:	0f af d6             	imul   %esi,%edx
+  804a79:	89 f9                	mov    %edi,%ecx
+  804a7b:	0f af cb             	imul   %ebx,%ecx
+  804a7e:	01 d1                	add    %edx,%ecx
+  804a80:	89 d8                	mov    %ebx,%eax
+  804a82:	f7 e6                	mul    %esi
+  804a84:	89 c6                	mov    %eax,%esi
+  804a86:	89 d7                	mov    %edx,%edi
+  804a88:	01 cf                	add    %ecx,%edi
+  804a8a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804a8e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804a92:	29 f0                	sub    %esi,%eax
+  804a94:	19 fa                	sbb    %edi,%edx
+  804a96:	83 c4 18             	add    $0x18,%esp
+  804a99:	5b                   	pop    %ebx
+  804a9a:	5e                   	pop    %esi
+  804a9b:	5f                   	pop    %edi
+  804a9c:	c3                   	ret
+
+00804a9d <__divdi3>:
+  804a9d:	53                   	push   %ebx
+  804a9e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804aa2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804aa6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804aaa:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804aae:	85 d2                	test   %edx,%edx
+  804ab0:	78 12                	js     804ac4 <__divdi3+0x27>
+  804ab2:	85 db                	test   %ebx,%ebx
+  804ab4:	78 2e                	js     804ae4 <__divdi3+0x47>
+  804ab6:	53                   	push   %ebx
+  804ab7:	51                   	push   %ecx
+  804ab8:	52                   	push   %edx
+  804ab9:	50                   	push   %eax
+  804aba:	e8 c8 fe ff ff       	call   804987 <__udivdi3>
+  804abf:	83 c4 10             	add    $0x10,%esp
+  804ac2:	eb 1e                	jmp    804ae2 <__divdi3+0x45>
+  804ac4:	f7 d8                	neg    %eax
+  804ac6:	83 d2 00             	adc    $0x0,%edx
+  804ac9:	f7 da                	neg    %edx
+  804acb:	85 db                	test   %ebx,%ebx
+  804acd:	78 2a                	js     804af9 <__divdi3+0x5c>
+  804acf:	53                   	push   %ebx
+  804ad0:	51                   	push   %ecx
+  804ad1:	52                   	push   %edx
+  804ad2:	50                   	push   %eax
+  804ad3:	e8 af fe ff ff       	call   804987 <__udivdi3>
+  804ad8:	83 c4 10             	add    $0x10,%esp
+  804adb:	f7 d8                	neg    %eax
+  804add:	83 d2 00             	adc    $0x0,%edx
+  804ae0:	f7 da                	neg    %edx
+  804ae2:	5b                   	pop    %ebx
+  804ae3:	c3                   	ret
+  804ae4:	f7 d9                	neg    %ecx
+  804ae6:	83 d3 00             	adc    $0x0,%ebx
+  804ae9:	f7 db                	neg    %ebx
+  804aeb:	53                   	push   %ebx
+  804aec:	51                   	push   %ecx
+  804aed:	52                   	push   %edx
+  804aee:	50                   	push   %eax
+  804aef:	e8 93 fe ff ff       	call   804987 <__udivdi3>
+  804af4:	83 c4 10             	add    $0x10,%esp
+  804af7:	eb e2                	jmp    804adb <__divdi3+0x3e>
+  804af9:	f7 d9                	neg    %ecx
+  804afb:	83 d3 00             	adc    $0x0,%ebx
+  804afe:	f7 db                	neg    %ebx
+  804b00:	53                   	push   %ebx
+  804b01:	51                   	push   %ecx
+  804b02:	52                   	push   %edx
+  804b03:	50                   	push   %eax
+  804b04:	e8 7e fe ff ff       	call   804987 <__udivdi3>
+  804b09:	83 c4 10             	add    $0x10,%esp
+  804b0c:	eb d4                	jmp    804ae2 <__divdi3+0x45>
+
+00804b0e <__moddi3>:
+  804b0e:	57                   	push   %edi
+  804b0f:	56                   	push   %esi
+  804b10:	53                   	push   %ebx
+  804b11:	83 ec 08             	sub    $0x8,%esp
+  804b14:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b18:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b1c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804b20:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804b24:	57                   	push   %edi
+  804b25:	56                   	push   %esi
+  804b26:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804b2a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804b2e:	52                   	push   %edx
+  804b2f:	50                   	push   %eax
+  804b30:	e8 68 ff ff ff       	call   804a9d <__divdi3>
+  804b35:	89 c3                	mov    %eax,%ebx
+  804b37:	0f af d6             	imul   %esi,%edx
+  804b3a:	89 f9                	mov    %edi,%ecx
+  804b3c:	0f af cb             	imul   %ebx,%ecx
+  804b3f:	01 d1                	add    %edx,%ecx
+  804b41:	89 d8                	mov    %ebx,%eax
+  804b43:	f7 e6                	mul    %esi
+  804b45:	89 c6                	mov    %eax,%esi
+  804b47:	89 d7                	mov    %edx,%edi
+  804b49:	01 cf                	add    %ecx,%edi
+  804b4b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804b4f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804b53:	29 f0                	sub    %esi,%eax
+  804b55:	19 fa                	sbb    %edi,%edx
+  804b57:	83 c4 18             	add    $0x18,%esp
+  804b5a:	5b                   	pop    %ebx
+  804b5b:	5e                   	pop    %esi
+  804b5c:	5f                   	pop    %edi
+  804b5d:	c3                   	ret
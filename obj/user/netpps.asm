@@ -0,0 +1,8030 @@
+
+obj/user/netpps.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 01 00 00       	call   8001f4 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+		NFRAMES, ms, NFRAMES / (ms ? ms : 1) * 1000);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	81 ec 34 01 00 00    	sub    $0x134,%esp
+	struct NetFrag frames[BATCH];
+	uint32_t low, high;
+	unsigned start;
+	int i, n, r;
+
+	binaryname = "netpps";
+  800041:	c7 05 00 50 80 00 40 	movl   $0x803c40,0x805000
+  800048:	3c 80 00 
+
+	// Broadcast, from our MAC, with the local experimental EtherType.
+	sys_get_mac(&low, &high);
+  80004b:	8d 9d e0 fe ff ff    	lea    -0x120(%ebp),%ebx
+  800051:	53                   	push   %ebx
+  800052:	8d b5 e4 fe ff ff    	lea    -0x11c(%ebp),%esi
+  800058:	56                   	push   %esi
+  800059:	e8 f7 10 00 00       	call   801155 <sys_get_mac>
+	memset(frame, 0xff, 6);
+  80005e:	83 c4 0c             	add    $0xc,%esp
+  800061:	6a 06                	push   $0x6
+  800063:	68 ff 00 00 00       	push   $0xff
+  800068:	68 00 60 80 00       	push   $0x806000
+  80006d:	e8 76 0b 00 00       	call   800be8 <memset>
+	memmove(frame + 6, &low, 4);
+  800072:	83 c4 0c             	add    $0xc,%esp
+  800075:	6a 04                	push   $0x4
+  800077:	56                   	push   %esi
+  800078:	68 06 60 80 00       	push   $0x806006
+  80007d:	e8 9b 0b 00 00       	call   800c1d <memmove>
+	memmove(frame + 10, &high, 2);
+  800082:	83 c4 0c             	add    $0xc,%esp
+  800085:	6a 02                	push   $0x2
+  800087:	53                   	push   %ebx
+  800088:	68 0a 60 80 00       	push   $0x80600a
+  80008d:	e8 8b 0b 00 00       	call   800c1d <memmove>
+	frame[12] = 0x88;
+  800092:	c6 05 0c 60 80 00 88 	movb   $0x88,0x80600c
+	frame[13] = 0xb5;
+  800099:	c6 05 0d 60 80 00 b5 	movb   $0xb5,0x80600d
+
+	start = sys_time_msec();
+  8000a0:	e8 50 10 00 00       	call   8010f5 <sys_time_msec>
+  8000a5:	89 c6                	mov    %eax,%esi
+  8000a7:	83 c4 10             	add    $0x10,%esp
+  8000aa:	bb 50 c3 00 00       	mov    $0xc350,%ebx
+	for (i = 0; i < NFRAMES; i++) {
+		while ((r = sys_net_transmit(frame, FRAMELEN)) == -E_DESC_FULL)
+  8000af:	83 ec 08             	sub    $0x8,%esp
+  8000b2:	6a 3c                	push   $0x3c
+  8000b4:	68 00 60 80 00       	push   $0x806000
+  8000b9:	e8 56 10 00 00       	call   801114 <sys_net_transmit>
+  8000be:	83 c4 10             	add    $0x10,%esp
+  8000c1:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8000c4:	74 e9                	je     8000af <umain+0x7a>
+			;
+		if (r < 0)
+  8000c6:	85 c0                	test   %eax,%eax
+  8000c8:	0f 88 80 00 00 00    	js     80014e <umain+0x119>
+	for (i = 0; i < NFRAMES; i++) {
+  8000ce:	83 eb 01             	sub    $0x1,%ebx
+  8000d1:	75 dc                	jne    8000af <umain+0x7a>
+			panic("sys_net_transmit: %e", r);
+	}
+	report("single", sys_time_msec() - start);
+  8000d3:	e8 1d 10 00 00       	call   8010f5 <sys_time_msec>
+  8000d8:	29 f0                	sub    %esi,%eax
+  8000da:	89 c1                	mov    %eax,%ecx
+	cprintf("netpps: %s: %d frames in %u ms, %u frames/s\n", how,
+  8000dc:	83 ec 0c             	sub    $0xc,%esp
+		NFRAMES, ms, NFRAMES / (ms ? ms : 1) * 1000);
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8000e6:	0f 45 d8             	cmovne %eax,%ebx
+  8000e9:	b8 50 c3 00 00       	mov    $0xc350,%eax
+  8000ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f3:	f7 f3                	div    %ebx
+	cprintf("netpps: %s: %d frames in %u ms, %u frames/s\n", how,
+  8000f5:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	51                   	push   %ecx
+  8000fd:	68 50 c3 00 00       	push   $0xc350
+  800102:	68 6a 3c 80 00       	push   $0x803c6a
+  800107:	68 94 3c 80 00       	push   $0x803c94
+  80010c:	e8 65 02 00 00       	call   800376 <cprintf>
+
+	for (i = 0; i < BATCH; i++) {
+  800111:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  800117:	8d 55 e8             	lea    -0x18(%ebp),%edx
+  80011a:	83 c4 20             	add    $0x20,%esp
+		frames[i].nf_va = frame;
+  80011d:	c7 00 00 60 80 00    	movl   $0x806000,(%eax)
+		frames[i].nf_len = FRAMELEN;
+  800123:	c7 40 04 3c 00 00 00 	movl   $0x3c,0x4(%eax)
+	for (i = 0; i < BATCH; i++) {
+  80012a:	83 c0 08             	add    $0x8,%eax
+  80012d:	39 d0                	cmp    %edx,%eax
+  80012f:	75 ec                	jne    80011d <umain+0xe8>
+	}
+	start = sys_time_msec();
+  800131:	e8 bf 0f 00 00       	call   8010f5 <sys_time_msec>
+  800136:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	for (i = 0; i < NFRAMES; i += r) {
+  80013c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		n = MIN(BATCH, NFRAMES - i);
+  800141:	bf 50 c3 00 00       	mov    $0xc350,%edi
+		if ((r = sys_net_transmit_batch(frames, n)) == -E_DESC_FULL)
+  800146:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80014c:	eb 21                	jmp    80016f <umain+0x13a>
+			panic("sys_net_transmit: %e", r);
+  80014e:	50                   	push   %eax
+  80014f:	68 47 3c 80 00       	push   $0x803c47
+  800154:	6a 2c                	push   $0x2c
+  800156:	68 5c 3c 80 00       	push   $0x803c5c
+  80015b:	e8 3b 01 00 00       	call   80029b <_panic>
+			r = 0;
+  800160:	b8 00 00 00 00       	mov    $0x0,%eax
+	for (i = 0; i < NFRAMES; i += r) {
+  800165:	01 c3                	add    %eax,%ebx
+  800167:	81 fb 4f c3 00 00    	cmp    $0xc34f,%ebx
+  80016d:	7f 36                	jg     8001a5 <umain+0x170>
+		if ((r = sys_net_transmit_batch(frames, n)) == -E_DESC_FULL)
+  80016f:	83 ec 08             	sub    $0x8,%esp
+		n = MIN(BATCH, NFRAMES - i);
+  800172:	89 f8                	mov    %edi,%eax
+  800174:	29 d8                	sub    %ebx,%eax
+  800176:	ba 20 00 00 00       	mov    $0x20,%edx
+  80017b:	39 d0                	cmp    %edx,%eax
+  80017d:	0f 4f c2             	cmovg  %edx,%eax
+		if ((r = sys_net_transmit_batch(frames, n)) == -E_DESC_FULL)
+  800180:	50                   	push   %eax
+  800181:	56                   	push   %esi
+  800182:	e8 93 10 00 00       	call   80121a <sys_net_transmit_batch>
+  800187:	83 c4 10             	add    $0x10,%esp
+  80018a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80018d:	74 d1                	je     800160 <umain+0x12b>
+		else if (r < 0)
+  80018f:	85 c0                	test   %eax,%eax
+  800191:	79 d2                	jns    800165 <umain+0x130>
+			panic("sys_net_transmit_batch: %e", r);
+  800193:	50                   	push   %eax
+  800194:	68 71 3c 80 00       	push   $0x803c71
+  800199:	6a 3a                	push   $0x3a
+  80019b:	68 5c 3c 80 00       	push   $0x803c5c
+  8001a0:	e8 f6 00 00 00       	call   80029b <_panic>
+	}
+	report("batched", sys_time_msec() - start);
+  8001a5:	e8 4b 0f 00 00       	call   8010f5 <sys_time_msec>
+  8001aa:	8b 8d d4 fe ff ff    	mov    -0x12c(%ebp),%ecx
+  8001b0:	29 c8                	sub    %ecx,%eax
+  8001b2:	89 c1                	mov    %eax,%ecx
+	cprintf("netpps: %s: %d frames in %u ms, %u frames/s\n", how,
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+		NFRAMES, ms, NFRAMES / (ms ? ms : 1) * 1000);
+  8001b7:	85 c0                	test   %eax,%eax
+  8001b9:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8001be:	0f 45 d8             	cmovne %eax,%ebx
+  8001c1:	b8 50 c3 00 00       	mov    $0xc350,%eax
+  8001c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001cb:	f7 f3                	div    %ebx
+	cprintf("netpps: %s: %d frames in %u ms, %u frames/s\n", how,
+  8001cd:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  8001d3:	50                   	push   %eax
+  8001d4:	51                   	push   %ecx
+  8001d5:	68 50 c3 00 00       	push   $0xc350
+  8001da:	68 8c 3c 80 00       	push   $0x803c8c
+  8001df:	68 94 3c 80 00       	push   $0x803c94
+  8001e4:	e8 8d 01 00 00       	call   800376 <cprintf>
+}
+  8001e9:	83 c4 20             	add    $0x20,%esp
+  8001ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ef:	5b                   	pop    %ebx
+  8001f0:	5e                   	pop    %esi
+  8001f1:	5f                   	pop    %edi
+  8001f2:	5d                   	pop    %ebp
+  8001f3:	c3                   	ret
+
+008001f4 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	56                   	push   %esi
+  8001f8:	53                   	push   %ebx
+  8001f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8001ff:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800201:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800206:	29 d0                	sub    %edx,%eax
+  800208:	89 c2                	mov    %eax,%edx
+  80020a:	c1 ea 0f             	shr    $0xf,%edx
+  80020d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800212:	b8 00 00 00 00       	mov    $0x0,%eax
+  800217:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80021a:	c7 04 85 60 63 80 00 	movl   $0x0,0x806360(,%eax,4)
+  800221:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800225:	e8 39 0c 00 00       	call   800e63 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80022a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80022f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800235:	89 e1                	mov    %esp,%ecx
+  800237:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80023c:	29 ca                	sub    %ecx,%edx
+  80023e:	89 d1                	mov    %edx,%ecx
+  800240:	c1 e9 0f             	shr    $0xf,%ecx
+  800243:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80024e:	0f 42 d1             	cmovb  %ecx,%edx
+  800251:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800256:	89 04 95 60 63 80 00 	mov    %eax,0x806360(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80025d:	85 db                	test   %ebx,%ebx
+  80025f:	7e 07                	jle    800268 <libmain+0x74>
+		binaryname = argv[0];
+  800261:	8b 06                	mov    (%esi),%eax
+  800263:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	56                   	push   %esi
+  80026c:	53                   	push   %ebx
+  80026d:	e8 c3 fd ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800272:	e8 0a 00 00 00       	call   800281 <exit>
+}
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80027d:	5b                   	pop    %ebx
+  80027e:	5e                   	pop    %esi
+  80027f:	5d                   	pop    %ebp
+  800280:	c3                   	ret
+
+00800281 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800287:	e8 61 12 00 00       	call   8014ed <close_all>
+	sys_env_destroy(0);
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	6a 00                	push   $0x0
+  800291:	e8 8c 0b 00 00       	call   800e22 <sys_env_destroy>
+}
+  800296:	83 c4 10             	add    $0x10,%esp
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+0080029b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80029b:	55                   	push   %ebp
+  80029c:	89 e5                	mov    %esp,%ebp
+  80029e:	56                   	push   %esi
+  80029f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002a0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002a3:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002a9:	e8 b5 0b 00 00       	call   800e63 <sys_getenvid>
+  8002ae:	83 ec 0c             	sub    $0xc,%esp
+  8002b1:	ff 75 0c             	push   0xc(%ebp)
+  8002b4:	ff 75 08             	push   0x8(%ebp)
+  8002b7:	56                   	push   %esi
+  8002b8:	50                   	push   %eax
+  8002b9:	68 cc 3c 80 00       	push   $0x803ccc
+  8002be:	e8 b3 00 00 00       	call   800376 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002c3:	83 c4 18             	add    $0x18,%esp
+  8002c6:	53                   	push   %ebx
+  8002c7:	ff 75 10             	push   0x10(%ebp)
+  8002ca:	e8 56 00 00 00       	call   800325 <vcprintf>
+	cprintf("\n");
+  8002cf:	c7 04 24 50 41 80 00 	movl   $0x804150,(%esp)
+  8002d6:	e8 9b 00 00 00       	call   800376 <cprintf>
+  8002db:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002de:	cc                   	int3
+	while (1)
+  8002df:	eb fd                	jmp    8002de <_panic+0x43>
+
+008002e1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	53                   	push   %ebx
+  8002e5:	83 ec 04             	sub    $0x4,%esp
+  8002e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002eb:	8b 13                	mov    (%ebx),%edx
+  8002ed:	8d 42 01             	lea    0x1(%edx),%eax
+  8002f0:	89 03                	mov    %eax,(%ebx)
+  8002f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fe:	74 09                	je     800309 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800300:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800304:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800307:	c9                   	leave
+  800308:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800309:	83 ec 08             	sub    $0x8,%esp
+  80030c:	68 ff 00 00 00       	push   $0xff
+  800311:	8d 43 08             	lea    0x8(%ebx),%eax
+  800314:	50                   	push   %eax
+  800315:	e8 cb 0a 00 00       	call   800de5 <sys_cputs>
+		b->idx = 0;
+  80031a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800320:	83 c4 10             	add    $0x10,%esp
+  800323:	eb db                	jmp    800300 <putch+0x1f>
+
+00800325 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80032e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800335:	00 00 00 
+	b.cnt = 0;
+  800338:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80033f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800342:	ff 75 0c             	push   0xc(%ebp)
+  800345:	ff 75 08             	push   0x8(%ebp)
+  800348:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80034e:	50                   	push   %eax
+  80034f:	68 e1 02 80 00       	push   $0x8002e1
+  800354:	e8 1c 01 00 00       	call   800475 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800359:	83 c4 08             	add    $0x8,%esp
+  80035c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800362:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800368:	50                   	push   %eax
+  800369:	e8 77 0a 00 00       	call   800de5 <sys_cputs>
+
+	return b.cnt;
+}
+  80036e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800374:	c9                   	leave
+  800375:	c3                   	ret
+
+00800376 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80037c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80037f:	50                   	push   %eax
+  800380:	ff 75 08             	push   0x8(%ebp)
+  800383:	e8 9d ff ff ff       	call   800325 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800388:	c9                   	leave
+  800389:	c3                   	ret
+
+0080038a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80038a:	55                   	push   %ebp
+  80038b:	89 e5                	mov    %esp,%ebp
+  80038d:	57                   	push   %edi
+  80038e:	56                   	push   %esi
+  80038f:	53                   	push   %ebx
+  800390:	83 ec 1c             	sub    $0x1c,%esp
+  800393:	89 c3                	mov    %eax,%ebx
+  800395:	89 d6                	mov    %edx,%esi
+  800397:	8b 45 08             	mov    0x8(%ebp),%eax
+  80039a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80039d:	89 d1                	mov    %edx,%ecx
+  80039f:	89 c2                	mov    %eax,%edx
+  8003a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003a4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003a7:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ad:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003b4:	39 c2                	cmp    %eax,%edx
+  8003b6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003b9:	73 4b                	jae    800406 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8003bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003be:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003c1:	85 ff                	test   %edi,%edi
+  8003c3:	7e 11                	jle    8003d6 <printnum+0x4c>
+			putch(padc, putdat);
+  8003c5:	83 ec 08             	sub    $0x8,%esp
+  8003c8:	56                   	push   %esi
+  8003c9:	ff 75 18             	push   0x18(%ebp)
+  8003cc:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8003ce:	83 c4 10             	add    $0x10,%esp
+  8003d1:	83 ef 01             	sub    $0x1,%edi
+  8003d4:	75 ef                	jne    8003c5 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003d6:	83 ec 08             	sub    $0x8,%esp
+  8003d9:	56                   	push   %esi
+  8003da:	83 ec 04             	sub    $0x4,%esp
+  8003dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8003e0:	ff 75 e0             	push   -0x20(%ebp)
+  8003e3:	ff 75 dc             	push   -0x24(%ebp)
+  8003e6:	ff 75 d8             	push   -0x28(%ebp)
+  8003e9:	e8 2a 37 00 00       	call   803b18 <__umoddi3>
+  8003ee:	83 c4 14             	add    $0x14,%esp
+  8003f1:	0f be 80 ef 3c 80 00 	movsbl 0x803cef(%eax),%eax
+  8003f8:	50                   	push   %eax
+  8003f9:	ff d3                	call   *%ebx
+}
+  8003fb:	83 c4 10             	add    $0x10,%esp
+  8003fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800401:	5b                   	pop    %ebx
+  800402:	5e                   	pop    %esi
+  800403:	5f                   	pop    %edi
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800406:	83 ec 0c             	sub    $0xc,%esp
+  800409:	ff 75 18             	push   0x18(%ebp)
+  80040c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80040f:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800412:	52                   	push   %edx
+  800413:	50                   	push   %eax
+  800414:	83 ec 08             	sub    $0x8,%esp
+  800417:	ff 75 e4             	push   -0x1c(%ebp)
+  80041a:	ff 75 e0             	push   -0x20(%ebp)
+  80041d:	ff 75 dc             	push   -0x24(%ebp)
+  800420:	ff 75 d8             	push   -0x28(%ebp)
+  800423:	e8 2a 36 00 00       	call   803a52 <__udivdi3>
+  800428:	83 c4 18             	add    $0x18,%esp
+  80042b:	52                   	push   %edx
+  80042c:	50                   	push   %eax
+  80042d:	89 f2                	mov    %esi,%edx
+  80042f:	89 d8                	mov    %ebx,%eax
+  800431:	e8 54 ff ff ff       	call   80038a <printnum>
+  800436:	83 c4 20             	add    $0x20,%esp
+  800439:	eb 9b                	jmp    8003d6 <printnum+0x4c>
+
+0080043b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80043b:	55                   	push   %ebp
+  80043c:	89 e5                	mov    %esp,%ebp
+  80043e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800441:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800445:	8b 10                	mov    (%eax),%edx
+  800447:	3b 50 04             	cmp    0x4(%eax),%edx
+  80044a:	73 0a                	jae    800456 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80044c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80044f:	89 08                	mov    %ecx,(%eax)
+  800451:	8b 45 08             	mov    0x8(%ebp),%eax
+  800454:	88 02                	mov    %al,(%edx)
+}
+  800456:	5d                   	pop    %ebp
+  800457:	c3                   	ret
+
+00800458 <printfmt>:
+{
+  800458:	55                   	push   %ebp
+  800459:	89 e5                	mov    %esp,%ebp
+  80045b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80045e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800461:	50                   	push   %eax
+  800462:	ff 75 10             	push   0x10(%ebp)
+  800465:	ff 75 0c             	push   0xc(%ebp)
+  800468:	ff 75 08             	push   0x8(%ebp)
+  80046b:	e8 05 00 00 00       	call   800475 <vprintfmt>
+}
+  800470:	83 c4 10             	add    $0x10,%esp
+  800473:	c9                   	leave
+  800474:	c3                   	ret
+
+00800475 <vprintfmt>:
+{
+  800475:	55                   	push   %ebp
+  800476:	89 e5                	mov    %esp,%ebp
+  800478:	57                   	push   %edi
+  800479:	56                   	push   %esi
+  80047a:	53                   	push   %ebx
+  80047b:	83 ec 2c             	sub    $0x2c,%esp
+  80047e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800481:	89 df                	mov    %ebx,%edi
+  800483:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800486:	8b 45 10             	mov    0x10(%ebp),%eax
+  800489:	8d 70 01             	lea    0x1(%eax),%esi
+  80048c:	0f b6 00             	movzbl (%eax),%eax
+  80048f:	83 f8 25             	cmp    $0x25,%eax
+  800492:	74 1e                	je     8004b2 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800494:	85 c0                	test   %eax,%eax
+  800496:	0f 84 15 05 00 00    	je     8009b1 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80049c:	83 ec 08             	sub    $0x8,%esp
+  80049f:	53                   	push   %ebx
+  8004a0:	50                   	push   %eax
+  8004a1:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004a3:	83 c6 01             	add    $0x1,%esi
+  8004a6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004aa:	83 c4 10             	add    $0x10,%esp
+  8004ad:	83 f8 25             	cmp    $0x25,%eax
+  8004b0:	75 e2                	jne    800494 <vprintfmt+0x1f>
+		padc = ' ';
+  8004b2:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8004b6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004bd:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8004c4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8004cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004d0:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d3:	8d 56 01             	lea    0x1(%esi),%edx
+  8004d6:	0f b6 0e             	movzbl (%esi),%ecx
+  8004d9:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004dc:	3c 55                	cmp    $0x55,%al
+  8004de:	0f 87 3b 04 00 00    	ja     80091f <vprintfmt+0x4aa>
+  8004e4:	0f b6 c0             	movzbl %al,%eax
+  8004e7:	ff 24 85 60 3e 80 00 	jmp    *0x803e60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8004ee:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004f1:	eb 93                	jmp    800486 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f3:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8004f5:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004f9:	eb d8                	jmp    8004d3 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fb:	89 d6                	mov    %edx,%esi
+  8004fd:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800501:	eb d0                	jmp    8004d3 <vprintfmt+0x5e>
+  800503:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800506:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800509:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80050c:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800510:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800513:	83 f9 09             	cmp    $0x9,%ecx
+  800516:	77 6f                	ja     800587 <vprintfmt+0x112>
+  800518:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80051b:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80051e:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800521:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800525:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800528:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80052b:	83 fe 09             	cmp    $0x9,%esi
+  80052e:	76 eb                	jbe    80051b <vprintfmt+0xa6>
+  800530:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800533:	89 d6                	mov    %edx,%esi
+  800535:	eb 13                	jmp    80054a <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800537:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053a:	8b 00                	mov    (%eax),%eax
+  80053c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80053f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800542:	8d 40 04             	lea    0x4(%eax),%eax
+  800545:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800548:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80054a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80054e:	79 83                	jns    8004d3 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800550:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800553:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800556:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80055d:	e9 71 ff ff ff       	jmp    8004d3 <vprintfmt+0x5e>
+			if (width < 0)
+  800562:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800565:	85 c9                	test   %ecx,%ecx
+  800567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056c:	0f 49 c1             	cmovns %ecx,%eax
+  80056f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800572:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800574:	e9 5a ff ff ff       	jmp    8004d3 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800579:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80057b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800582:	e9 4c ff ff ff       	jmp    8004d3 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800587:	89 d6                	mov    %edx,%esi
+  800589:	eb bf                	jmp    80054a <vprintfmt+0xd5>
+			lflag++;
+  80058b:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80058f:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800591:	e9 3d ff ff ff       	jmp    8004d3 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800596:	89 55 10             	mov    %edx,0x10(%ebp)
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 70 04             	lea    0x4(%eax),%esi
+  80059f:	83 ec 08             	sub    $0x8,%esp
+  8005a2:	53                   	push   %ebx
+  8005a3:	ff 30                	push   (%eax)
+  8005a5:	ff d7                	call   *%edi
+			break;
+  8005a7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005aa:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8005ad:	e9 d4 fe ff ff       	jmp    800486 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8005b2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	89 d0                	mov    %edx,%eax
+  8005bf:	f7 d8                	neg    %eax
+  8005c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c4:	83 f8 12             	cmp    $0x12,%eax
+  8005c7:	7f 23                	jg     8005ec <vprintfmt+0x177>
+  8005c9:	8b 14 85 c0 3f 80 00 	mov    0x803fc0(,%eax,4),%edx
+  8005d0:	85 d2                	test   %edx,%edx
+  8005d2:	74 18                	je     8005ec <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8005d4:	52                   	push   %edx
+  8005d5:	68 1b 41 80 00       	push   $0x80411b
+  8005da:	53                   	push   %ebx
+  8005db:	57                   	push   %edi
+  8005dc:	e8 77 fe ff ff       	call   800458 <printfmt>
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e4:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005e7:	e9 9a fe ff ff       	jmp    800486 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8005ec:	50                   	push   %eax
+  8005ed:	68 07 3d 80 00       	push   $0x803d07
+  8005f2:	53                   	push   %ebx
+  8005f3:	57                   	push   %edi
+  8005f4:	e8 5f fe ff ff       	call   800458 <printfmt>
+  8005f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005fc:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005ff:	e9 82 fe ff ff       	jmp    800486 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800604:	89 55 10             	mov    %edx,0x10(%ebp)
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	83 c0 04             	add    $0x4,%eax
+  80060d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 00                	mov    (%eax),%eax
+  800615:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800618:	85 c0                	test   %eax,%eax
+  80061a:	0f 84 61 03 00 00    	je     800981 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800620:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800624:	7e 06                	jle    80062c <vprintfmt+0x1b7>
+  800626:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80062a:	75 29                	jne    800655 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80062c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80062f:	8d 70 01             	lea    0x1(%eax),%esi
+  800632:	0f b6 00             	movzbl (%eax),%eax
+  800635:	0f be d0             	movsbl %al,%edx
+  800638:	85 d2                	test   %edx,%edx
+  80063a:	0f 84 bb 00 00 00    	je     8006fb <vprintfmt+0x286>
+  800640:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800643:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800646:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800649:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80064c:	eb 7a                	jmp    8006c8 <vprintfmt+0x253>
+				p = "(null)";
+  80064e:	c7 45 d0 00 3d 80 00 	movl   $0x803d00,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800655:	83 ec 08             	sub    $0x8,%esp
+  800658:	ff 75 d4             	push   -0x2c(%ebp)
+  80065b:	ff 75 d0             	push   -0x30(%ebp)
+  80065e:	e8 e0 03 00 00       	call   800a43 <strnlen>
+  800663:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800666:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800669:	83 c4 10             	add    $0x10,%esp
+  80066c:	85 d2                	test   %edx,%edx
+  80066e:	0f 8e d6 02 00 00    	jle    80094a <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800674:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800678:	83 ec 08             	sub    $0x8,%esp
+  80067b:	53                   	push   %ebx
+  80067c:	56                   	push   %esi
+  80067d:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800686:	75 f0                	jne    800678 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800688:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80068b:	8d 70 01             	lea    0x1(%eax),%esi
+  80068e:	0f b6 00             	movzbl (%eax),%eax
+  800691:	0f be d0             	movsbl %al,%edx
+  800694:	85 d2                	test   %edx,%edx
+  800696:	0f 84 da 02 00 00    	je     800976 <vprintfmt+0x501>
+  80069c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80069f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006a2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006a5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006a8:	eb 1e                	jmp    8006c8 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8006aa:	83 ec 08             	sub    $0x8,%esp
+  8006ad:	ff 75 0c             	push   0xc(%ebp)
+  8006b0:	52                   	push   %edx
+  8006b1:	ff 55 08             	call   *0x8(%ebp)
+  8006b4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006b7:	83 eb 01             	sub    $0x1,%ebx
+  8006ba:	83 c6 01             	add    $0x1,%esi
+  8006bd:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006c1:	0f be d0             	movsbl %al,%edx
+  8006c4:	85 d2                	test   %edx,%edx
+  8006c6:	74 2a                	je     8006f2 <vprintfmt+0x27d>
+  8006c8:	85 ff                	test   %edi,%edi
+  8006ca:	78 05                	js     8006d1 <vprintfmt+0x25c>
+  8006cc:	83 ef 01             	sub    $0x1,%edi
+  8006cf:	78 59                	js     80072a <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006d1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006d5:	74 d3                	je     8006aa <vprintfmt+0x235>
+  8006d7:	0f be c0             	movsbl %al,%eax
+  8006da:	83 e8 20             	sub    $0x20,%eax
+  8006dd:	83 f8 5e             	cmp    $0x5e,%eax
+  8006e0:	76 c8                	jbe    8006aa <vprintfmt+0x235>
+					putch('?', putdat);
+  8006e2:	83 ec 08             	sub    $0x8,%esp
+  8006e5:	ff 75 0c             	push   0xc(%ebp)
+  8006e8:	6a 3f                	push   $0x3f
+  8006ea:	ff 55 08             	call   *0x8(%ebp)
+  8006ed:	83 c4 10             	add    $0x10,%esp
+  8006f0:	eb c5                	jmp    8006b7 <vprintfmt+0x242>
+  8006f2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8006fb:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006fe:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800702:	7e 1b                	jle    80071f <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800704:	83 ec 08             	sub    $0x8,%esp
+  800707:	53                   	push   %ebx
+  800708:	6a 20                	push   $0x20
+  80070a:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80070c:	83 c4 10             	add    $0x10,%esp
+  80070f:	83 ee 01             	sub    $0x1,%esi
+  800712:	75 f0                	jne    800704 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800714:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071a:	e9 67 fd ff ff       	jmp    800486 <vprintfmt+0x11>
+  80071f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800722:	89 45 14             	mov    %eax,0x14(%ebp)
+  800725:	e9 5c fd ff ff       	jmp    800486 <vprintfmt+0x11>
+  80072a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80072d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800730:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800733:	eb c6                	jmp    8006fb <vprintfmt+0x286>
+	if (lflag >= 2)
+  800735:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800738:	89 55 10             	mov    %edx,0x10(%ebp)
+  80073b:	83 f9 01             	cmp    $0x1,%ecx
+  80073e:	7f 1f                	jg     80075f <vprintfmt+0x2ea>
+	else if (lflag)
+  800740:	85 c9                	test   %ecx,%ecx
+  800742:	74 67                	je     8007ab <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8b 30                	mov    (%eax),%esi
+  800749:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80074c:	89 f0                	mov    %esi,%eax
+  80074e:	c1 f8 1f             	sar    $0x1f,%eax
+  800751:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8d 40 04             	lea    0x4(%eax),%eax
+  80075a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075d:	eb 17                	jmp    800776 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8b 50 04             	mov    0x4(%eax),%edx
+  800765:	8b 00                	mov    (%eax),%eax
+  800767:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80076a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8d 40 08             	lea    0x8(%eax),%eax
+  800773:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800776:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800779:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80077c:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800781:	85 c9                	test   %ecx,%ecx
+  800783:	0f 89 12 01 00 00    	jns    80089b <vprintfmt+0x426>
+				putch('-', putdat);
+  800789:	83 ec 08             	sub    $0x8,%esp
+  80078c:	53                   	push   %ebx
+  80078d:	6a 2d                	push   $0x2d
+  80078f:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800791:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800794:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800797:	f7 da                	neg    %edx
+  800799:	83 d1 00             	adc    $0x0,%ecx
+  80079c:	f7 d9                	neg    %ecx
+  80079e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007a1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007a6:	e9 f0 00 00 00       	jmp    80089b <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8007ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ae:	8b 30                	mov    (%eax),%esi
+  8007b0:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007b3:	89 f0                	mov    %esi,%eax
+  8007b5:	c1 f8 1f             	sar    $0x1f,%eax
+  8007b8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c4:	eb b0                	jmp    800776 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8007c6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007c9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007cc:	83 f9 01             	cmp    $0x1,%ecx
+  8007cf:	7f 1e                	jg     8007ef <vprintfmt+0x37a>
+	else if (lflag)
+  8007d1:	85 c9                	test   %ecx,%ecx
+  8007d3:	74 32                	je     800807 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8007d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d8:	8b 10                	mov    (%eax),%edx
+  8007da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007df:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007e5:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8007ea:	e9 ac 00 00 00       	jmp    80089b <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f2:	8b 10                	mov    (%eax),%edx
+  8007f4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f7:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007fd:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800802:	e9 94 00 00 00       	jmp    80089b <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 10                	mov    (%eax),%edx
+  80080c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800811:	8d 40 04             	lea    0x4(%eax),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800817:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80081c:	eb 7d                	jmp    80089b <vprintfmt+0x426>
+	if (lflag >= 2)
+  80081e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800821:	89 55 10             	mov    %edx,0x10(%ebp)
+  800824:	83 f9 01             	cmp    $0x1,%ecx
+  800827:	7f 1b                	jg     800844 <vprintfmt+0x3cf>
+	else if (lflag)
+  800829:	85 c9                	test   %ecx,%ecx
+  80082b:	74 2c                	je     800859 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80082d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800830:	8b 10                	mov    (%eax),%edx
+  800832:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800837:	8d 40 04             	lea    0x4(%eax),%eax
+  80083a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80083d:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800842:	eb 57                	jmp    80089b <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800844:	8b 45 14             	mov    0x14(%ebp),%eax
+  800847:	8b 10                	mov    (%eax),%edx
+  800849:	8b 48 04             	mov    0x4(%eax),%ecx
+  80084c:	8d 40 08             	lea    0x8(%eax),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800852:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800857:	eb 42                	jmp    80089b <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8b 10                	mov    (%eax),%edx
+  80085e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800863:	8d 40 04             	lea    0x4(%eax),%eax
+  800866:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800869:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80086e:	eb 2b                	jmp    80089b <vprintfmt+0x426>
+			putch('0', putdat);
+  800870:	89 55 10             	mov    %edx,0x10(%ebp)
+  800873:	83 ec 08             	sub    $0x8,%esp
+  800876:	53                   	push   %ebx
+  800877:	6a 30                	push   $0x30
+  800879:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80087b:	83 c4 08             	add    $0x8,%esp
+  80087e:	53                   	push   %ebx
+  80087f:	6a 78                	push   $0x78
+  800881:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800883:	8b 45 14             	mov    0x14(%ebp),%eax
+  800886:	8b 10                	mov    (%eax),%edx
+  800888:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80088d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800890:	8d 40 04             	lea    0x4(%eax),%eax
+  800893:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800896:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80089b:	83 ec 0c             	sub    $0xc,%esp
+  80089e:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008a2:	50                   	push   %eax
+  8008a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8008a6:	56                   	push   %esi
+  8008a7:	51                   	push   %ecx
+  8008a8:	52                   	push   %edx
+  8008a9:	89 da                	mov    %ebx,%edx
+  8008ab:	89 f8                	mov    %edi,%eax
+  8008ad:	e8 d8 fa ff ff       	call   80038a <printnum>
+			break;
+  8008b2:	83 c4 20             	add    $0x20,%esp
+  8008b5:	e9 cc fb ff ff       	jmp    800486 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8008ba:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008bd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c0:	83 f9 01             	cmp    $0x1,%ecx
+  8008c3:	7f 1b                	jg     8008e0 <vprintfmt+0x46b>
+	else if (lflag)
+  8008c5:	85 c9                	test   %ecx,%ecx
+  8008c7:	74 2c                	je     8008f5 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8008c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cc:	8b 10                	mov    (%eax),%edx
+  8008ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008d9:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8008de:	eb bb                	jmp    80089b <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e3:	8b 10                	mov    (%eax),%edx
+  8008e5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8008eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ee:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8008f3:	eb a6                	jmp    80089b <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f8:	8b 10                	mov    (%eax),%edx
+  8008fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800902:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800905:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80090a:	eb 8f                	jmp    80089b <vprintfmt+0x426>
+			putch(ch, putdat);
+  80090c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80090f:	83 ec 08             	sub    $0x8,%esp
+  800912:	53                   	push   %ebx
+  800913:	6a 25                	push   $0x25
+  800915:	ff d7                	call   *%edi
+			break;
+  800917:	83 c4 10             	add    $0x10,%esp
+  80091a:	e9 67 fb ff ff       	jmp    800486 <vprintfmt+0x11>
+			putch('%', putdat);
+  80091f:	83 ec 08             	sub    $0x8,%esp
+  800922:	53                   	push   %ebx
+  800923:	6a 25                	push   $0x25
+  800925:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800927:	83 c4 10             	add    $0x10,%esp
+  80092a:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80092e:	0f 84 ba fb ff ff    	je     8004ee <vprintfmt+0x79>
+  800934:	89 75 10             	mov    %esi,0x10(%ebp)
+  800937:	89 f0                	mov    %esi,%eax
+  800939:	83 e8 01             	sub    $0x1,%eax
+  80093c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800940:	75 f7                	jne    800939 <vprintfmt+0x4c4>
+  800942:	89 45 10             	mov    %eax,0x10(%ebp)
+  800945:	e9 3c fb ff ff       	jmp    800486 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80094a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80094d:	8d 70 01             	lea    0x1(%eax),%esi
+  800950:	0f b6 00             	movzbl (%eax),%eax
+  800953:	0f be d0             	movsbl %al,%edx
+  800956:	85 d2                	test   %edx,%edx
+  800958:	74 11                	je     80096b <vprintfmt+0x4f6>
+  80095a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80095d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800960:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800963:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800966:	e9 5d fd ff ff       	jmp    8006c8 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80096b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80096e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800971:	e9 10 fb ff ff       	jmp    800486 <vprintfmt+0x11>
+  800976:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097c:	e9 05 fb ff ff       	jmp    800486 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800981:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800985:	7e 0a                	jle    800991 <vprintfmt+0x51c>
+  800987:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80098b:	0f 85 bd fc ff ff    	jne    80064e <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800991:	ba 28 00 00 00       	mov    $0x28,%edx
+  800996:	b8 28 00 00 00       	mov    $0x28,%eax
+  80099b:	be 01 3d 80 00       	mov    $0x803d01,%esi
+  8009a0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009a3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009a6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009a9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009ac:	e9 17 fd ff ff       	jmp    8006c8 <vprintfmt+0x253>
+}
+  8009b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009b4:	5b                   	pop    %ebx
+  8009b5:	5e                   	pop    %esi
+  8009b6:	5f                   	pop    %edi
+  8009b7:	5d                   	pop    %ebp
+  8009b8:	c3                   	ret
+
+008009b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009b9:	55                   	push   %ebp
+  8009ba:	89 e5                	mov    %esp,%ebp
+  8009bc:	83 ec 18             	sub    $0x18,%esp
+  8009bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009c8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009cc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009cf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009d6:	85 c0                	test   %eax,%eax
+  8009d8:	74 26                	je     800a00 <vsnprintf+0x47>
+  8009da:	85 d2                	test   %edx,%edx
+  8009dc:	7e 22                	jle    800a00 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009de:	ff 75 14             	push   0x14(%ebp)
+  8009e1:	ff 75 10             	push   0x10(%ebp)
+  8009e4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009e7:	50                   	push   %eax
+  8009e8:	68 3b 04 80 00       	push   $0x80043b
+  8009ed:	e8 83 fa ff ff       	call   800475 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009f2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009f5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009fb:	83 c4 10             	add    $0x10,%esp
+}
+  8009fe:	c9                   	leave
+  8009ff:	c3                   	ret
+		return -E_INVAL;
+  800a00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a05:	eb f7                	jmp    8009fe <vsnprintf+0x45>
+
+00800a07 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a07:	55                   	push   %ebp
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a0d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a10:	50                   	push   %eax
+  800a11:	ff 75 10             	push   0x10(%ebp)
+  800a14:	ff 75 0c             	push   0xc(%ebp)
+  800a17:	ff 75 08             	push   0x8(%ebp)
+  800a1a:	e8 9a ff ff ff       	call   8009b9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a1f:	c9                   	leave
+  800a20:	c3                   	ret
+
+00800a21 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a27:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a2a:	74 10                	je     800a3c <strlen+0x1b>
+  800a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800a31:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a34:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a38:	75 f7                	jne    800a31 <strlen+0x10>
+	return n;
+}
+  800a3a:	5d                   	pop    %ebp
+  800a3b:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800a41:	eb f7                	jmp    800a3a <strlen+0x19>
+
+00800a43 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a49:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a4c:	85 d2                	test   %edx,%edx
+  800a4e:	74 16                	je     800a66 <strnlen+0x23>
+  800a50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a55:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a59:	74 09                	je     800a64 <strnlen+0x21>
+		n++;
+  800a5b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a5e:	39 d0                	cmp    %edx,%eax
+  800a60:	75 f3                	jne    800a55 <strnlen+0x12>
+		n++;
+  800a62:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a64:	5d                   	pop    %ebp
+  800a65:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6b:	eb f7                	jmp    800a64 <strnlen+0x21>
+
+00800a6d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	53                   	push   %ebx
+  800a71:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a80:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a83:	83 c0 01             	add    $0x1,%eax
+  800a86:	84 d2                	test   %dl,%dl
+  800a88:	75 f2                	jne    800a7c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a8a:	89 c8                	mov    %ecx,%eax
+  800a8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8f:	c9                   	leave
+  800a90:	c3                   	ret
+
+00800a91 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	53                   	push   %ebx
+  800a95:	83 ec 10             	sub    $0x10,%esp
+  800a98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a9b:	53                   	push   %ebx
+  800a9c:	e8 80 ff ff ff       	call   800a21 <strlen>
+  800aa1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800aa4:	ff 75 0c             	push   0xc(%ebp)
+  800aa7:	01 d8                	add    %ebx,%eax
+  800aa9:	50                   	push   %eax
+  800aaa:	e8 be ff ff ff       	call   800a6d <strcpy>
+	return dst;
+}
+  800aaf:	89 d8                	mov    %ebx,%eax
+  800ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab4:	c9                   	leave
+  800ab5:	c3                   	ret
+
+00800ab6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ab6:	55                   	push   %ebp
+  800ab7:	89 e5                	mov    %esp,%ebp
+  800ab9:	56                   	push   %esi
+  800aba:	53                   	push   %ebx
+  800abb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800abe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ac4:	85 db                	test   %ebx,%ebx
+  800ac6:	74 17                	je     800adf <strncpy+0x29>
+  800ac8:	01 f3                	add    %esi,%ebx
+  800aca:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800acc:	83 c0 01             	add    $0x1,%eax
+  800acf:	0f b6 0a             	movzbl (%edx),%ecx
+  800ad2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ad5:	80 f9 01             	cmp    $0x1,%cl
+  800ad8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800adb:	39 c3                	cmp    %eax,%ebx
+  800add:	75 ed                	jne    800acc <strncpy+0x16>
+	}
+	return ret;
+}
+  800adf:	89 f0                	mov    %esi,%eax
+  800ae1:	5b                   	pop    %ebx
+  800ae2:	5e                   	pop    %esi
+  800ae3:	5d                   	pop    %ebp
+  800ae4:	c3                   	ret
+
+00800ae5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ae5:	55                   	push   %ebp
+  800ae6:	89 e5                	mov    %esp,%ebp
+  800ae8:	56                   	push   %esi
+  800ae9:	53                   	push   %ebx
+  800aea:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800af3:	89 f0                	mov    %esi,%eax
+  800af5:	85 db                	test   %ebx,%ebx
+  800af7:	74 1e                	je     800b17 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800af9:	83 eb 01             	sub    $0x1,%ebx
+  800afc:	74 16                	je     800b14 <strlcpy+0x2f>
+  800afe:	01 f3                	add    %esi,%ebx
+  800b00:	0f b6 0a             	movzbl (%edx),%ecx
+  800b03:	84 c9                	test   %cl,%cl
+  800b05:	74 0d                	je     800b14 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800b07:	83 c2 01             	add    $0x1,%edx
+  800b0a:	83 c0 01             	add    $0x1,%eax
+  800b0d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800b10:	39 d8                	cmp    %ebx,%eax
+  800b12:	75 ec                	jne    800b00 <strlcpy+0x1b>
+		*dst = '\0';
+  800b14:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b17:	29 f0                	sub    %esi,%eax
+}
+  800b19:	5b                   	pop    %ebx
+  800b1a:	5e                   	pop    %esi
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+
+00800b1d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b26:	0f b6 01             	movzbl (%ecx),%eax
+  800b29:	84 c0                	test   %al,%al
+  800b2b:	74 11                	je     800b3e <strcmp+0x21>
+  800b2d:	38 02                	cmp    %al,(%edx)
+  800b2f:	75 0d                	jne    800b3e <strcmp+0x21>
+		p++, q++;
+  800b31:	83 c1 01             	add    $0x1,%ecx
+  800b34:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b37:	0f b6 01             	movzbl (%ecx),%eax
+  800b3a:	84 c0                	test   %al,%al
+  800b3c:	75 ef                	jne    800b2d <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b3e:	0f b6 c0             	movzbl %al,%eax
+  800b41:	0f b6 12             	movzbl (%edx),%edx
+  800b44:	29 d0                	sub    %edx,%eax
+}
+  800b46:	5d                   	pop    %ebp
+  800b47:	c3                   	ret
+
+00800b48 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b48:	55                   	push   %ebp
+  800b49:	89 e5                	mov    %esp,%ebp
+  800b4b:	53                   	push   %ebx
+  800b4c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b4f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b52:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800b5a:	85 d2                	test   %edx,%edx
+  800b5c:	74 2e                	je     800b8c <strncmp+0x44>
+  800b5e:	0f b6 01             	movzbl (%ecx),%eax
+  800b61:	84 c0                	test   %al,%al
+  800b63:	74 16                	je     800b7b <strncmp+0x33>
+  800b65:	3a 03                	cmp    (%ebx),%al
+  800b67:	75 12                	jne    800b7b <strncmp+0x33>
+		n--, p++, q++;
+  800b69:	83 c1 01             	add    $0x1,%ecx
+  800b6c:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b6f:	83 ea 01             	sub    $0x1,%edx
+  800b72:	75 ea                	jne    800b5e <strncmp+0x16>
+		return 0;
+  800b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b79:	eb 11                	jmp    800b8c <strncmp+0x44>
+  800b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b80:	85 d2                	test   %edx,%edx
+  800b82:	74 08                	je     800b8c <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b84:	0f b6 01             	movzbl (%ecx),%eax
+  800b87:	0f b6 13             	movzbl (%ebx),%edx
+  800b8a:	29 d0                	sub    %edx,%eax
+}
+  800b8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b8f:	c9                   	leave
+  800b90:	c3                   	ret
+
+00800b91 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b97:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b9b:	0f b6 10             	movzbl (%eax),%edx
+  800b9e:	84 d2                	test   %dl,%dl
+  800ba0:	74 15                	je     800bb7 <strchr+0x26>
+		if (*s == c)
+  800ba2:	38 d1                	cmp    %dl,%cl
+  800ba4:	74 0f                	je     800bb5 <strchr+0x24>
+	for (; *s; s++)
+  800ba6:	83 c0 01             	add    $0x1,%eax
+  800ba9:	0f b6 10             	movzbl (%eax),%edx
+  800bac:	84 d2                	test   %dl,%dl
+  800bae:	75 f2                	jne    800ba2 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bb5:	5d                   	pop    %ebp
+  800bb6:	c3                   	ret
+	return 0;
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbc:	eb f7                	jmp    800bb5 <strchr+0x24>
+
+00800bbe <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bbe:	55                   	push   %ebp
+  800bbf:	89 e5                	mov    %esp,%ebp
+  800bc1:	53                   	push   %ebx
+  800bc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800bc8:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800bcb:	38 d3                	cmp    %dl,%bl
+  800bcd:	74 14                	je     800be3 <strfind+0x25>
+  800bcf:	89 d1                	mov    %edx,%ecx
+  800bd1:	84 db                	test   %bl,%bl
+  800bd3:	74 0e                	je     800be3 <strfind+0x25>
+	for (; *s; s++)
+  800bd5:	83 c0 01             	add    $0x1,%eax
+  800bd8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bdb:	38 ca                	cmp    %cl,%dl
+  800bdd:	74 04                	je     800be3 <strfind+0x25>
+  800bdf:	84 d2                	test   %dl,%dl
+  800be1:	75 f2                	jne    800bd5 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800be3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800be6:	c9                   	leave
+  800be7:	c3                   	ret
+
+00800be8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	57                   	push   %edi
+  800bec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bef:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bf2:	85 c9                	test   %ecx,%ecx
+  800bf4:	74 20                	je     800c16 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bf6:	89 f8                	mov    %edi,%eax
+  800bf8:	09 c8                	or     %ecx,%eax
+  800bfa:	a8 03                	test   $0x3,%al
+  800bfc:	75 12                	jne    800c10 <memset+0x28>
+		c &= 0xFF;
+  800bfe:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c02:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c08:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c0b:	fc                   	cld
+  800c0c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c0e:	eb 06                	jmp    800c16 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c13:	fc                   	cld
+  800c14:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c16:	89 f8                	mov    %edi,%eax
+  800c18:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c1b:	c9                   	leave
+  800c1c:	c3                   	ret
+
+00800c1d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	57                   	push   %edi
+  800c21:	56                   	push   %esi
+  800c22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c25:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c28:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c2b:	39 c6                	cmp    %eax,%esi
+  800c2d:	73 32                	jae    800c61 <memmove+0x44>
+  800c2f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c32:	39 d0                	cmp    %edx,%eax
+  800c34:	73 2b                	jae    800c61 <memmove+0x44>
+		s += n;
+		d += n;
+  800c36:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c39:	89 d6                	mov    %edx,%esi
+  800c3b:	09 fe                	or     %edi,%esi
+  800c3d:	09 ce                	or     %ecx,%esi
+  800c3f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c45:	75 0e                	jne    800c55 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c47:	83 ef 04             	sub    $0x4,%edi
+  800c4a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c4d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c50:	fd                   	std
+  800c51:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c53:	eb 09                	jmp    800c5e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c55:	83 ef 01             	sub    $0x1,%edi
+  800c58:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c5b:	fd                   	std
+  800c5c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c5e:	fc                   	cld
+  800c5f:	eb 1a                	jmp    800c7b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c61:	89 f2                	mov    %esi,%edx
+  800c63:	09 c2                	or     %eax,%edx
+  800c65:	09 ca                	or     %ecx,%edx
+  800c67:	f6 c2 03             	test   $0x3,%dl
+  800c6a:	75 0a                	jne    800c76 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c6c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c6f:	89 c7                	mov    %eax,%edi
+  800c71:	fc                   	cld
+  800c72:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c74:	eb 05                	jmp    800c7b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c76:	89 c7                	mov    %eax,%edi
+  800c78:	fc                   	cld
+  800c79:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c7b:	5e                   	pop    %esi
+  800c7c:	5f                   	pop    %edi
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+
+00800c7f <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c85:	ff 75 10             	push   0x10(%ebp)
+  800c88:	ff 75 0c             	push   0xc(%ebp)
+  800c8b:	ff 75 08             	push   0x8(%ebp)
+  800c8e:	e8 8a ff ff ff       	call   800c1d <memmove>
+}
+  800c93:	c9                   	leave
+  800c94:	c3                   	ret
+
+00800c95 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	56                   	push   %esi
+  800c99:	53                   	push   %ebx
+  800c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca0:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ca3:	85 f6                	test   %esi,%esi
+  800ca5:	74 29                	je     800cd0 <memcmp+0x3b>
+  800ca7:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800ca9:	0f b6 08             	movzbl (%eax),%ecx
+  800cac:	0f b6 1a             	movzbl (%edx),%ebx
+  800caf:	38 d9                	cmp    %bl,%cl
+  800cb1:	75 11                	jne    800cc4 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cb3:	83 c0 01             	add    $0x1,%eax
+  800cb6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cb9:	39 c6                	cmp    %eax,%esi
+  800cbb:	75 ec                	jne    800ca9 <memcmp+0x14>
+	}
+
+	return 0;
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	eb 08                	jmp    800ccc <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800cc4:	0f b6 c1             	movzbl %cl,%eax
+  800cc7:	0f b6 db             	movzbl %bl,%ebx
+  800cca:	29 d8                	sub    %ebx,%eax
+}
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5d                   	pop    %ebp
+  800ccf:	c3                   	ret
+	return 0;
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd5:	eb f5                	jmp    800ccc <memcmp+0x37>
+
+00800cd7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ce0:	89 c2                	mov    %eax,%edx
+  800ce2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ce5:	39 d0                	cmp    %edx,%eax
+  800ce7:	73 0d                	jae    800cf6 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ce9:	38 08                	cmp    %cl,(%eax)
+  800ceb:	74 0d                	je     800cfa <memfind+0x23>
+	for (; s < ends; s++)
+  800ced:	83 c0 01             	add    $0x1,%eax
+  800cf0:	39 c2                	cmp    %eax,%edx
+  800cf2:	75 f5                	jne    800ce9 <memfind+0x12>
+  800cf4:	eb 06                	jmp    800cfc <memfind+0x25>
+  800cf6:	89 c2                	mov    %eax,%edx
+  800cf8:	eb 02                	jmp    800cfc <memfind+0x25>
+  800cfa:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800cfc:	89 d0                	mov    %edx,%eax
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+
+00800d00 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	57                   	push   %edi
+  800d04:	56                   	push   %esi
+  800d05:	53                   	push   %ebx
+  800d06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d0c:	0f b6 02             	movzbl (%edx),%eax
+  800d0f:	3c 20                	cmp    $0x20,%al
+  800d11:	74 04                	je     800d17 <strtol+0x17>
+  800d13:	3c 09                	cmp    $0x9,%al
+  800d15:	75 0e                	jne    800d25 <strtol+0x25>
+		s++;
+  800d17:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d1a:	0f b6 02             	movzbl (%edx),%eax
+  800d1d:	3c 20                	cmp    $0x20,%al
+  800d1f:	74 f6                	je     800d17 <strtol+0x17>
+  800d21:	3c 09                	cmp    $0x9,%al
+  800d23:	74 f2                	je     800d17 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d25:	3c 2b                	cmp    $0x2b,%al
+  800d27:	74 2a                	je     800d53 <strtol+0x53>
+	int neg = 0;
+  800d29:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d2e:	3c 2d                	cmp    $0x2d,%al
+  800d30:	74 2b                	je     800d5d <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d32:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d38:	75 0f                	jne    800d49 <strtol+0x49>
+  800d3a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d3d:	74 28                	je     800d67 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d3f:	85 db                	test   %ebx,%ebx
+  800d41:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d46:	0f 44 d8             	cmove  %eax,%ebx
+  800d49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d4e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d51:	eb 46                	jmp    800d99 <strtol+0x99>
+		s++;
+  800d53:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d56:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5b:	eb d5                	jmp    800d32 <strtol+0x32>
+		s++, neg = 1;
+  800d5d:	83 c2 01             	add    $0x1,%edx
+  800d60:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d65:	eb cb                	jmp    800d32 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d67:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d6b:	74 0e                	je     800d7b <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d6d:	85 db                	test   %ebx,%ebx
+  800d6f:	75 d8                	jne    800d49 <strtol+0x49>
+		s++, base = 8;
+  800d71:	83 c2 01             	add    $0x1,%edx
+  800d74:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d79:	eb ce                	jmp    800d49 <strtol+0x49>
+		s += 2, base = 16;
+  800d7b:	83 c2 02             	add    $0x2,%edx
+  800d7e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d83:	eb c4                	jmp    800d49 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d85:	0f be c0             	movsbl %al,%eax
+  800d88:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d8b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d8e:	7d 3a                	jge    800dca <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d90:	83 c2 01             	add    $0x1,%edx
+  800d93:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d97:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d99:	0f b6 02             	movzbl (%edx),%eax
+  800d9c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d9f:	89 f3                	mov    %esi,%ebx
+  800da1:	80 fb 09             	cmp    $0x9,%bl
+  800da4:	76 df                	jbe    800d85 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800da6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800da9:	89 f3                	mov    %esi,%ebx
+  800dab:	80 fb 19             	cmp    $0x19,%bl
+  800dae:	77 08                	ja     800db8 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800db0:	0f be c0             	movsbl %al,%eax
+  800db3:	83 e8 57             	sub    $0x57,%eax
+  800db6:	eb d3                	jmp    800d8b <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800db8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dbb:	89 f3                	mov    %esi,%ebx
+  800dbd:	80 fb 19             	cmp    $0x19,%bl
+  800dc0:	77 08                	ja     800dca <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800dc2:	0f be c0             	movsbl %al,%eax
+  800dc5:	83 e8 37             	sub    $0x37,%eax
+  800dc8:	eb c1                	jmp    800d8b <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dce:	74 05                	je     800dd5 <strtol+0xd5>
+		*endptr = (char *) s;
+  800dd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dd3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dd5:	89 c8                	mov    %ecx,%eax
+  800dd7:	f7 d8                	neg    %eax
+  800dd9:	85 ff                	test   %edi,%edi
+  800ddb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dde:	89 c8                	mov    %ecx,%eax
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	89 c3                	mov    %eax,%ebx
+  800df8:	89 c7                	mov    %eax,%edi
+  800dfa:	89 c6                	mov    %eax,%esi
+  800dfc:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+
+00800e03 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	57                   	push   %edi
+  800e07:	56                   	push   %esi
+  800e08:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e13:	89 d1                	mov    %edx,%ecx
+  800e15:	89 d3                	mov    %edx,%ebx
+  800e17:	89 d7                	mov    %edx,%edi
+  800e19:	89 d6                	mov    %edx,%esi
+  800e1b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e1d:	5b                   	pop    %ebx
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5f                   	pop    %edi
+  800e20:	5d                   	pop    %ebp
+  800e21:	c3                   	ret
+
+00800e22 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	57                   	push   %edi
+  800e26:	56                   	push   %esi
+  800e27:	53                   	push   %ebx
+  800e28:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e33:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e38:	89 cb                	mov    %ecx,%ebx
+  800e3a:	89 cf                	mov    %ecx,%edi
+  800e3c:	89 ce                	mov    %ecx,%esi
+  800e3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e40:	85 c0                	test   %eax,%eax
+  800e42:	7f 08                	jg     800e4c <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+  800e4f:	50                   	push   %eax
+  800e50:	6a 03                	push   $0x3
+  800e52:	68 2b 40 80 00       	push   $0x80402b
+  800e57:	6a 23                	push   $0x23
+  800e59:	68 48 40 80 00       	push   $0x804048
+  800e5e:	e8 38 f4 ff ff       	call   80029b <_panic>
+
+00800e63 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e69:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e73:	89 d1                	mov    %edx,%ecx
+  800e75:	89 d3                	mov    %edx,%ebx
+  800e77:	89 d7                	mov    %edx,%edi
+  800e79:	89 d6                	mov    %edx,%esi
+  800e7b:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+
+00800e82 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e92:	89 d1                	mov    %edx,%ecx
+  800e94:	89 d3                	mov    %edx,%ebx
+  800e96:	89 d7                	mov    %edx,%edi
+  800e98:	89 d6                	mov    %edx,%esi
+  800e9a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e9c:	5b                   	pop    %ebx
+  800e9d:	5e                   	pop    %esi
+  800e9e:	5f                   	pop    %edi
+  800e9f:	5d                   	pop    %ebp
+  800ea0:	c3                   	ret
+
+00800ea1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	57                   	push   %edi
+  800ea5:	56                   	push   %esi
+  800ea6:	53                   	push   %ebx
+  800ea7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eaa:	be 00 00 00 00       	mov    $0x0,%esi
+  800eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800eba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebd:	89 f7                	mov    %esi,%edi
+  800ebf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec1:	85 c0                	test   %eax,%eax
+  800ec3:	7f 08                	jg     800ecd <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ec5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec8:	5b                   	pop    %ebx
+  800ec9:	5e                   	pop    %esi
+  800eca:	5f                   	pop    %edi
+  800ecb:	5d                   	pop    %ebp
+  800ecc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecd:	83 ec 0c             	sub    $0xc,%esp
+  800ed0:	50                   	push   %eax
+  800ed1:	6a 04                	push   $0x4
+  800ed3:	68 2b 40 80 00       	push   $0x80402b
+  800ed8:	6a 23                	push   $0x23
+  800eda:	68 48 40 80 00       	push   $0x804048
+  800edf:	e8 b7 f3 ff ff       	call   80029b <_panic>
+
+00800ee4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ef8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f03:	85 c0                	test   %eax,%eax
+  800f05:	7f 08                	jg     800f0f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+  800f12:	50                   	push   %eax
+  800f13:	6a 05                	push   $0x5
+  800f15:	68 2b 40 80 00       	push   $0x80402b
+  800f1a:	6a 23                	push   $0x23
+  800f1c:	68 48 40 80 00       	push   $0x804048
+  800f21:	e8 75 f3 ff ff       	call   80029b <_panic>
+
+00800f26 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f26:	55                   	push   %ebp
+  800f27:	89 e5                	mov    %esp,%ebp
+  800f29:	57                   	push   %edi
+  800f2a:	56                   	push   %esi
+  800f2b:	53                   	push   %ebx
+  800f2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f3f:	89 df                	mov    %ebx,%edi
+  800f41:	89 de                	mov    %ebx,%esi
+  800f43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f45:	85 c0                	test   %eax,%eax
+  800f47:	7f 08                	jg     800f51 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4c:	5b                   	pop    %ebx
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5f                   	pop    %edi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f51:	83 ec 0c             	sub    $0xc,%esp
+  800f54:	50                   	push   %eax
+  800f55:	6a 06                	push   $0x6
+  800f57:	68 2b 40 80 00       	push   $0x80402b
+  800f5c:	6a 23                	push   $0x23
+  800f5e:	68 48 40 80 00       	push   $0x804048
+  800f63:	e8 33 f3 ff ff       	call   80029b <_panic>
+
+00800f68 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	57                   	push   %edi
+  800f6c:	56                   	push   %esi
+  800f6d:	53                   	push   %ebx
+  800f6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f81:	89 df                	mov    %ebx,%edi
+  800f83:	89 de                	mov    %ebx,%esi
+  800f85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f87:	85 c0                	test   %eax,%eax
+  800f89:	7f 08                	jg     800f93 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5e                   	pop    %esi
+  800f90:	5f                   	pop    %edi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+  800f96:	50                   	push   %eax
+  800f97:	6a 08                	push   $0x8
+  800f99:	68 2b 40 80 00       	push   $0x80402b
+  800f9e:	6a 23                	push   $0x23
+  800fa0:	68 48 40 80 00       	push   $0x804048
+  800fa5:	e8 f1 f2 ff ff       	call   80029b <_panic>
+
+00800faa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	56                   	push   %esi
+  800faf:	53                   	push   %ebx
+  800fb0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fc3:	89 df                	mov    %ebx,%edi
+  800fc5:	89 de                	mov    %ebx,%esi
+  800fc7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc9:	85 c0                	test   %eax,%eax
+  800fcb:	7f 08                	jg     800fd5 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd0:	5b                   	pop    %ebx
+  800fd1:	5e                   	pop    %esi
+  800fd2:	5f                   	pop    %edi
+  800fd3:	5d                   	pop    %ebp
+  800fd4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd5:	83 ec 0c             	sub    $0xc,%esp
+  800fd8:	50                   	push   %eax
+  800fd9:	6a 09                	push   $0x9
+  800fdb:	68 2b 40 80 00       	push   $0x80402b
+  800fe0:	6a 23                	push   $0x23
+  800fe2:	68 48 40 80 00       	push   $0x804048
+  800fe7:	e8 af f2 ff ff       	call   80029b <_panic>
+
+00800fec <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fec:	55                   	push   %ebp
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	57                   	push   %edi
+  800ff0:	56                   	push   %esi
+  800ff1:	53                   	push   %ebx
+  800ff2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801000:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801005:	89 df                	mov    %ebx,%edi
+  801007:	89 de                	mov    %ebx,%esi
+  801009:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100b:	85 c0                	test   %eax,%eax
+  80100d:	7f 08                	jg     801017 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80100f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801012:	5b                   	pop    %ebx
+  801013:	5e                   	pop    %esi
+  801014:	5f                   	pop    %edi
+  801015:	5d                   	pop    %ebp
+  801016:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801017:	83 ec 0c             	sub    $0xc,%esp
+  80101a:	50                   	push   %eax
+  80101b:	6a 0a                	push   $0xa
+  80101d:	68 2b 40 80 00       	push   $0x80402b
+  801022:	6a 23                	push   $0x23
+  801024:	68 48 40 80 00       	push   $0x804048
+  801029:	e8 6d f2 ff ff       	call   80029b <_panic>
+
+0080102e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80102e:	55                   	push   %ebp
+  80102f:	89 e5                	mov    %esp,%ebp
+  801031:	57                   	push   %edi
+  801032:	56                   	push   %esi
+  801033:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801034:	8b 55 08             	mov    0x8(%ebp),%edx
+  801037:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80103f:	be 00 00 00 00       	mov    $0x0,%esi
+  801044:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801047:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80104c:	5b                   	pop    %ebx
+  80104d:	5e                   	pop    %esi
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+
+00801051 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	56                   	push   %esi
+  801056:	53                   	push   %ebx
+  801057:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80105a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801067:	89 cb                	mov    %ecx,%ebx
+  801069:	89 cf                	mov    %ecx,%edi
+  80106b:	89 ce                	mov    %ecx,%esi
+  80106d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106f:	85 c0                	test   %eax,%eax
+  801071:	7f 08                	jg     80107b <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801076:	5b                   	pop    %ebx
+  801077:	5e                   	pop    %esi
+  801078:	5f                   	pop    %edi
+  801079:	5d                   	pop    %ebp
+  80107a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107b:	83 ec 0c             	sub    $0xc,%esp
+  80107e:	50                   	push   %eax
+  80107f:	6a 0d                	push   $0xd
+  801081:	68 2b 40 80 00       	push   $0x80402b
+  801086:	6a 23                	push   $0x23
+  801088:	68 48 40 80 00       	push   $0x804048
+  80108d:	e8 09 f2 ff ff       	call   80029b <_panic>
+
+00801092 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	57                   	push   %edi
+  801096:	56                   	push   %esi
+  801097:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010ac:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8010ae:	5b                   	pop    %ebx
+  8010af:	5e                   	pop    %esi
+  8010b0:	5f                   	pop    %edi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+
+008010b3 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	57                   	push   %edi
+  8010b7:	56                   	push   %esi
+  8010b8:	53                   	push   %ebx
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010cc:	89 df                	mov    %ebx,%edi
+  8010ce:	89 de                	mov    %ebx,%esi
+  8010d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d2:	85 c0                	test   %eax,%eax
+  8010d4:	7f 08                	jg     8010de <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8010d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	50                   	push   %eax
+  8010e2:	6a 0d                	push   $0xd
+  8010e4:	68 2b 40 80 00       	push   $0x80402b
+  8010e9:	6a 23                	push   $0x23
+  8010eb:	68 48 40 80 00       	push   $0x804048
+  8010f0:	e8 a6 f1 ff ff       	call   80029b <_panic>
+
+008010f5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010f5:	55                   	push   %ebp
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	57                   	push   %edi
+  8010f9:	56                   	push   %esi
+  8010fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801100:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801105:	89 d1                	mov    %edx,%ecx
+  801107:	89 d3                	mov    %edx,%ebx
+  801109:	89 d7                	mov    %edx,%edi
+  80110b:	89 d6                	mov    %edx,%esi
+  80110d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+
+00801114 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	57                   	push   %edi
+  801118:	56                   	push   %esi
+  801119:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801125:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80112a:	89 df                	mov    %ebx,%edi
+  80112c:	89 de                	mov    %ebx,%esi
+  80112e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801130:	5b                   	pop    %ebx
+  801131:	5e                   	pop    %esi
+  801132:	5f                   	pop    %edi
+  801133:	5d                   	pop    %ebp
+  801134:	c3                   	ret
+
+00801135 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	57                   	push   %edi
+  801139:	56                   	push   %esi
+  80113a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80113b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801140:	8b 55 08             	mov    0x8(%ebp),%edx
+  801143:	b8 10 00 00 00       	mov    $0x10,%eax
+  801148:	89 cb                	mov    %ecx,%ebx
+  80114a:	89 cf                	mov    %ecx,%edi
+  80114c:	89 ce                	mov    %ecx,%esi
+  80114e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801150:	5b                   	pop    %ebx
+  801151:	5e                   	pop    %esi
+  801152:	5f                   	pop    %edi
+  801153:	5d                   	pop    %ebp
+  801154:	c3                   	ret
+
+00801155 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  801163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801166:	b8 11 00 00 00       	mov    $0x11,%eax
+  80116b:	89 df                	mov    %ebx,%edi
+  80116d:	89 de                	mov    %ebx,%esi
+  80116f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801171:	5b                   	pop    %ebx
+  801172:	5e                   	pop    %esi
+  801173:	5f                   	pop    %edi
+  801174:	5d                   	pop    %ebp
+  801175:	c3                   	ret
+
+00801176 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	57                   	push   %edi
+  80117a:	56                   	push   %esi
+  80117b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80117c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801181:	8b 55 08             	mov    0x8(%ebp),%edx
+  801184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801187:	b8 12 00 00 00       	mov    $0x12,%eax
+  80118c:	89 df                	mov    %ebx,%edi
+  80118e:	89 de                	mov    %ebx,%esi
+  801190:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801192:	5b                   	pop    %ebx
+  801193:	5e                   	pop    %esi
+  801194:	5f                   	pop    %edi
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+
+00801197 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	57                   	push   %edi
+  80119b:	56                   	push   %esi
+  80119c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80119d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011aa:	89 cb                	mov    %ecx,%ebx
+  8011ac:	89 cf                	mov    %ecx,%edi
+  8011ae:	89 ce                	mov    %ecx,%esi
+  8011b0:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8011b2:	5b                   	pop    %ebx
+  8011b3:	5e                   	pop    %esi
+  8011b4:	5f                   	pop    %edi
+  8011b5:	5d                   	pop    %ebp
+  8011b6:	c3                   	ret
+
+008011b7 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	57                   	push   %edi
+  8011bb:	56                   	push   %esi
+  8011bc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011cd:	89 df                	mov    %ebx,%edi
+  8011cf:	89 de                	mov    %ebx,%esi
+  8011d1:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5e                   	pop    %esi
+  8011d5:	5f                   	pop    %edi
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	c3                   	ret
+
+008011d8 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	57                   	push   %edi
+  8011dc:	56                   	push   %esi
+  8011dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011eb:	89 cb                	mov    %ecx,%ebx
+  8011ed:	89 cf                	mov    %ecx,%edi
+  8011ef:	89 ce                	mov    %ecx,%esi
+  8011f1:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8011f3:	5b                   	pop    %ebx
+  8011f4:	5e                   	pop    %esi
+  8011f5:	5f                   	pop    %edi
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+
+008011f8 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	57                   	push   %edi
+  8011fc:	56                   	push   %esi
+  8011fd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801203:	8b 55 08             	mov    0x8(%ebp),%edx
+  801206:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801209:	b8 16 00 00 00       	mov    $0x16,%eax
+  80120e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801211:	89 f7                	mov    %esi,%edi
+  801213:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801215:	5b                   	pop    %ebx
+  801216:	5e                   	pop    %esi
+  801217:	5f                   	pop    %edi
+  801218:	5d                   	pop    %ebp
+  801219:	c3                   	ret
+
+0080121a <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	57                   	push   %edi
+  80121e:	56                   	push   %esi
+  80121f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801220:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801225:	8b 55 08             	mov    0x8(%ebp),%edx
+  801228:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801230:	89 df                	mov    %ebx,%edi
+  801232:	89 de                	mov    %ebx,%esi
+  801234:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5f                   	pop    %edi
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+
+0080123b <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	57                   	push   %edi
+  80123f:	56                   	push   %esi
+  801240:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801241:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801246:	8b 55 08             	mov    0x8(%ebp),%edx
+  801249:	b8 18 00 00 00       	mov    $0x18,%eax
+  80124e:	89 cb                	mov    %ecx,%ebx
+  801250:	89 cf                	mov    %ecx,%edi
+  801252:	89 ce                	mov    %ecx,%esi
+  801254:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801256:	5b                   	pop    %ebx
+  801257:	5e                   	pop    %esi
+  801258:	5f                   	pop    %edi
+  801259:	5d                   	pop    %ebp
+  80125a:	c3                   	ret
+
+0080125b <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80125b:	55                   	push   %ebp
+  80125c:	89 e5                	mov    %esp,%ebp
+  80125e:	57                   	push   %edi
+  80125f:	56                   	push   %esi
+  801260:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801261:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801265:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801272:	89 df                	mov    %ebx,%edi
+  801274:	89 de                	mov    %ebx,%esi
+  801276:	cd 30                	int    $0x30
+}
+  801278:	5b                   	pop    %ebx
+  801279:	5e                   	pop    %esi
+  80127a:	5f                   	pop    %edi
+  80127b:	5d                   	pop    %ebp
+  80127c:	c3                   	ret
+
+0080127d <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	57                   	push   %edi
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801283:	be 00 00 00 00       	mov    $0x0,%esi
+  801288:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801293:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801296:	89 f7                	mov    %esi,%edi
+  801298:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+
+0080129f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	57                   	push   %edi
+  8012a3:	56                   	push   %esi
+  8012a4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8012b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b8:	89 f7                	mov    %esi,%edi
+  8012ba:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8012bc:	5b                   	pop    %ebx
+  8012bd:	5e                   	pop    %esi
+  8012be:	5f                   	pop    %edi
+  8012bf:	5d                   	pop    %ebp
+  8012c0:	c3                   	ret
+
+008012c1 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	57                   	push   %edi
+  8012c5:	56                   	push   %esi
+  8012c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012d7:	89 df                	mov    %ebx,%edi
+  8012d9:	89 de                	mov    %ebx,%esi
+  8012db:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012dd:	5b                   	pop    %ebx
+  8012de:	5e                   	pop    %esi
+  8012df:	5f                   	pop    %edi
+  8012e0:	5d                   	pop    %ebp
+  8012e1:	c3                   	ret
+
+008012e2 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	57                   	push   %edi
+  8012e6:	56                   	push   %esi
+  8012e7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fb:	89 f7                	mov    %esi,%edi
+  8012fd:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8012ff:	5b                   	pop    %ebx
+  801300:	5e                   	pop    %esi
+  801301:	5f                   	pop    %edi
+  801302:	5d                   	pop    %ebp
+  801303:	c3                   	ret
+
+00801304 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801307:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80130f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+
+00801314 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801317:	8b 45 08             	mov    0x8(%ebp),%eax
+  80131a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80131f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801324:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+
+0080132b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80132b:	55                   	push   %ebp
+  80132c:	89 e5                	mov    %esp,%ebp
+  80132e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801333:	89 c2                	mov    %eax,%edx
+  801335:	c1 ea 16             	shr    $0x16,%edx
+  801338:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80133f:	f6 c2 01             	test   $0x1,%dl
+  801342:	74 29                	je     80136d <fd_alloc+0x42>
+  801344:	89 c2                	mov    %eax,%edx
+  801346:	c1 ea 0c             	shr    $0xc,%edx
+  801349:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801350:	f6 c2 01             	test   $0x1,%dl
+  801353:	74 18                	je     80136d <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801355:	05 00 10 00 00       	add    $0x1000,%eax
+  80135a:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  80135f:	75 d2                	jne    801333 <fd_alloc+0x8>
+  801361:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801366:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80136b:	eb 05                	jmp    801372 <fd_alloc+0x47>
+			return 0;
+  80136d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801372:	8b 55 08             	mov    0x8(%ebp),%edx
+  801375:	89 02                	mov    %eax,(%edx)
+}
+  801377:	89 c8                	mov    %ecx,%eax
+  801379:	5d                   	pop    %ebp
+  80137a:	c3                   	ret
+
+0080137b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801381:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801386:	77 30                	ja     8013b8 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801388:	c1 e0 0c             	shl    $0xc,%eax
+  80138b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801390:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801396:	f6 c2 01             	test   $0x1,%dl
+  801399:	74 24                	je     8013bf <fd_lookup+0x44>
+  80139b:	89 c2                	mov    %eax,%edx
+  80139d:	c1 ea 0c             	shr    $0xc,%edx
+  8013a0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013a7:	f6 c2 01             	test   $0x1,%dl
+  8013aa:	74 1a                	je     8013c6 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013af:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013b6:	5d                   	pop    %ebp
+  8013b7:	c3                   	ret
+		return -E_INVAL;
+  8013b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013bd:	eb f7                	jmp    8013b6 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8013bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c4:	eb f0                	jmp    8013b6 <fd_lookup+0x3b>
+  8013c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013cb:	eb e9                	jmp    8013b6 <fd_lookup+0x3b>
+
+008013cd <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013cd:	55                   	push   %ebp
+  8013ce:	89 e5                	mov    %esp,%ebp
+  8013d0:	53                   	push   %ebx
+  8013d1:	83 ec 04             	sub    $0x4,%esp
+  8013d4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013dc:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8013e1:	39 13                	cmp    %edx,(%ebx)
+  8013e3:	74 54                	je     801439 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8013e5:	83 c0 01             	add    $0x1,%eax
+  8013e8:	8b 1c 85 d4 40 80 00 	mov    0x8040d4(,%eax,4),%ebx
+  8013ef:	85 db                	test   %ebx,%ebx
+  8013f1:	75 ee                	jne    8013e1 <dev_lookup+0x14>
+  8013f3:	89 e1                	mov    %esp,%ecx
+  8013f5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8013fa:	29 c8                	sub    %ecx,%eax
+  8013fc:	89 c1                	mov    %eax,%ecx
+  8013fe:	c1 e9 0f             	shr    $0xf,%ecx
+  801401:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140b:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80140e:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801415:	8b 40 48             	mov    0x48(%eax),%eax
+  801418:	83 ec 04             	sub    $0x4,%esp
+  80141b:	52                   	push   %edx
+  80141c:	50                   	push   %eax
+  80141d:	68 58 40 80 00       	push   $0x804058
+  801422:	e8 4f ef ff ff       	call   800376 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801427:	83 c4 10             	add    $0x10,%esp
+  80142a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80142f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801432:	89 1a                	mov    %ebx,(%edx)
+}
+  801434:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801437:	c9                   	leave
+  801438:	c3                   	ret
+			return 0;
+  801439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143e:	eb ef                	jmp    80142f <dev_lookup+0x62>
+
+00801440 <fd_close>:
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	57                   	push   %edi
+  801444:	56                   	push   %esi
+  801445:	53                   	push   %ebx
+  801446:	83 ec 24             	sub    $0x24,%esp
+  801449:	8b 75 08             	mov    0x8(%ebp),%esi
+  80144c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80144f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801452:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801453:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801459:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80145c:	50                   	push   %eax
+  80145d:	e8 19 ff ff ff       	call   80137b <fd_lookup>
+  801462:	89 c3                	mov    %eax,%ebx
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	85 c0                	test   %eax,%eax
+  801469:	78 05                	js     801470 <fd_close+0x30>
+	    || fd != fd2)
+  80146b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80146e:	74 0f                	je     80147f <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801470:	85 ff                	test   %edi,%edi
+  801472:	0f 44 df             	cmove  %edi,%ebx
+}
+  801475:	89 d8                	mov    %ebx,%eax
+  801477:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147a:	5b                   	pop    %ebx
+  80147b:	5e                   	pop    %esi
+  80147c:	5f                   	pop    %edi
+  80147d:	5d                   	pop    %ebp
+  80147e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80147f:	83 ec 08             	sub    $0x8,%esp
+  801482:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801485:	50                   	push   %eax
+  801486:	ff 36                	push   (%esi)
+  801488:	e8 40 ff ff ff       	call   8013cd <dev_lookup>
+  80148d:	89 c3                	mov    %eax,%ebx
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	85 c0                	test   %eax,%eax
+  801494:	78 1a                	js     8014b0 <fd_close+0x70>
+		if (dev->dev_close)
+  801496:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801499:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80149c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014a1:	85 c0                	test   %eax,%eax
+  8014a3:	74 0b                	je     8014b0 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	56                   	push   %esi
+  8014a9:	ff d0                	call   *%eax
+  8014ab:	89 c3                	mov    %eax,%ebx
+  8014ad:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014b0:	83 ec 08             	sub    $0x8,%esp
+  8014b3:	56                   	push   %esi
+  8014b4:	6a 00                	push   $0x0
+  8014b6:	e8 6b fa ff ff       	call   800f26 <sys_page_unmap>
+	return r;
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	eb b5                	jmp    801475 <fd_close+0x35>
+
+008014c0 <close>:
+
+int
+close(int fdnum)
+{
+  8014c0:	55                   	push   %ebp
+  8014c1:	89 e5                	mov    %esp,%ebp
+  8014c3:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c9:	50                   	push   %eax
+  8014ca:	ff 75 08             	push   0x8(%ebp)
+  8014cd:	e8 a9 fe ff ff       	call   80137b <fd_lookup>
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	79 02                	jns    8014db <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014d9:	c9                   	leave
+  8014da:	c3                   	ret
+		return fd_close(fd, 1);
+  8014db:	83 ec 08             	sub    $0x8,%esp
+  8014de:	6a 01                	push   $0x1
+  8014e0:	ff 75 f4             	push   -0xc(%ebp)
+  8014e3:	e8 58 ff ff ff       	call   801440 <fd_close>
+  8014e8:	83 c4 10             	add    $0x10,%esp
+  8014eb:	eb ec                	jmp    8014d9 <close+0x19>
+
+008014ed <close_all>:
+
+void
+close_all(void)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	53                   	push   %ebx
+  8014f1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014f9:	83 ec 0c             	sub    $0xc,%esp
+  8014fc:	53                   	push   %ebx
+  8014fd:	e8 be ff ff ff       	call   8014c0 <close>
+	for (i = 0; i < MAXFD; i++)
+  801502:	83 c3 01             	add    $0x1,%ebx
+  801505:	83 c4 10             	add    $0x10,%esp
+  801508:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80150e:	75 e9                	jne    8014f9 <close_all+0xc>
+}
+  801510:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801513:	c9                   	leave
+  801514:	c3                   	ret
+
+00801515 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	57                   	push   %edi
+  801519:	56                   	push   %esi
+  80151a:	53                   	push   %ebx
+  80151b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80151e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801521:	50                   	push   %eax
+  801522:	ff 75 08             	push   0x8(%ebp)
+  801525:	e8 51 fe ff ff       	call   80137b <fd_lookup>
+  80152a:	89 c3                	mov    %eax,%ebx
+  80152c:	83 c4 10             	add    $0x10,%esp
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	78 7f                	js     8015b2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801533:	83 ec 0c             	sub    $0xc,%esp
+  801536:	ff 75 0c             	push   0xc(%ebp)
+  801539:	e8 82 ff ff ff       	call   8014c0 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80153e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801541:	c1 e6 0c             	shl    $0xc,%esi
+  801544:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80154a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80154d:	89 3c 24             	mov    %edi,(%esp)
+  801550:	e8 bf fd ff ff       	call   801314 <fd2data>
+  801555:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801557:	89 34 24             	mov    %esi,(%esp)
+  80155a:	e8 b5 fd ff ff       	call   801314 <fd2data>
+  80155f:	83 c4 10             	add    $0x10,%esp
+  801562:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801565:	89 d8                	mov    %ebx,%eax
+  801567:	c1 e8 16             	shr    $0x16,%eax
+  80156a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801571:	a8 01                	test   $0x1,%al
+  801573:	74 11                	je     801586 <dup+0x71>
+  801575:	89 d8                	mov    %ebx,%eax
+  801577:	c1 e8 0c             	shr    $0xc,%eax
+  80157a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801581:	f6 c2 01             	test   $0x1,%dl
+  801584:	75 36                	jne    8015bc <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801586:	89 f8                	mov    %edi,%eax
+  801588:	c1 e8 0c             	shr    $0xc,%eax
+  80158b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	25 07 0e 00 00       	and    $0xe07,%eax
+  80159a:	50                   	push   %eax
+  80159b:	56                   	push   %esi
+  80159c:	6a 00                	push   $0x0
+  80159e:	57                   	push   %edi
+  80159f:	6a 00                	push   $0x0
+  8015a1:	e8 3e f9 ff ff       	call   800ee4 <sys_page_map>
+  8015a6:	89 c3                	mov    %eax,%ebx
+  8015a8:	83 c4 20             	add    $0x20,%esp
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	78 33                	js     8015e2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015b2:	89 d8                	mov    %ebx,%eax
+  8015b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b7:	5b                   	pop    %ebx
+  8015b8:	5e                   	pop    %esi
+  8015b9:	5f                   	pop    %edi
+  8015ba:	5d                   	pop    %ebp
+  8015bb:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015bc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015c3:	83 ec 0c             	sub    $0xc,%esp
+  8015c6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015cb:	50                   	push   %eax
+  8015cc:	ff 75 d4             	push   -0x2c(%ebp)
+  8015cf:	6a 00                	push   $0x0
+  8015d1:	53                   	push   %ebx
+  8015d2:	6a 00                	push   $0x0
+  8015d4:	e8 0b f9 ff ff       	call   800ee4 <sys_page_map>
+  8015d9:	89 c3                	mov    %eax,%ebx
+  8015db:	83 c4 20             	add    $0x20,%esp
+  8015de:	85 c0                	test   %eax,%eax
+  8015e0:	79 a4                	jns    801586 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015e2:	83 ec 08             	sub    $0x8,%esp
+  8015e5:	56                   	push   %esi
+  8015e6:	6a 00                	push   $0x0
+  8015e8:	e8 39 f9 ff ff       	call   800f26 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015ed:	83 c4 08             	add    $0x8,%esp
+  8015f0:	ff 75 d4             	push   -0x2c(%ebp)
+  8015f3:	6a 00                	push   $0x0
+  8015f5:	e8 2c f9 ff ff       	call   800f26 <sys_page_unmap>
+	return r;
+  8015fa:	83 c4 10             	add    $0x10,%esp
+  8015fd:	eb b3                	jmp    8015b2 <dup+0x9d>
+
+008015ff <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	56                   	push   %esi
+  801603:	53                   	push   %ebx
+  801604:	83 ec 18             	sub    $0x18,%esp
+  801607:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80160a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80160d:	50                   	push   %eax
+  80160e:	53                   	push   %ebx
+  80160f:	e8 67 fd ff ff       	call   80137b <fd_lookup>
+  801614:	83 c4 10             	add    $0x10,%esp
+  801617:	85 c0                	test   %eax,%eax
+  801619:	78 3c                	js     801657 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80161b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80161e:	83 ec 08             	sub    $0x8,%esp
+  801621:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801624:	50                   	push   %eax
+  801625:	ff 36                	push   (%esi)
+  801627:	e8 a1 fd ff ff       	call   8013cd <dev_lookup>
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	78 24                	js     801657 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801633:	8b 46 08             	mov    0x8(%esi),%eax
+  801636:	83 e0 03             	and    $0x3,%eax
+  801639:	83 f8 01             	cmp    $0x1,%eax
+  80163c:	74 20                	je     80165e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80163e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801641:	8b 40 08             	mov    0x8(%eax),%eax
+  801644:	85 c0                	test   %eax,%eax
+  801646:	74 54                	je     80169c <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801648:	83 ec 04             	sub    $0x4,%esp
+  80164b:	ff 75 10             	push   0x10(%ebp)
+  80164e:	ff 75 0c             	push   0xc(%ebp)
+  801651:	56                   	push   %esi
+  801652:	ff d0                	call   *%eax
+  801654:	83 c4 10             	add    $0x10,%esp
+}
+  801657:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80165a:	5b                   	pop    %ebx
+  80165b:	5e                   	pop    %esi
+  80165c:	5d                   	pop    %ebp
+  80165d:	c3                   	ret
+  80165e:	89 e2                	mov    %esp,%edx
+  801660:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801665:	29 d0                	sub    %edx,%eax
+  801667:	89 c2                	mov    %eax,%edx
+  801669:	c1 ea 0f             	shr    $0xf,%edx
+  80166c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801671:	b8 00 00 00 00       	mov    $0x0,%eax
+  801676:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801679:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801680:	8b 40 48             	mov    0x48(%eax),%eax
+  801683:	83 ec 04             	sub    $0x4,%esp
+  801686:	53                   	push   %ebx
+  801687:	50                   	push   %eax
+  801688:	68 99 40 80 00       	push   $0x804099
+  80168d:	e8 e4 ec ff ff       	call   800376 <cprintf>
+		return -E_INVAL;
+  801692:	83 c4 10             	add    $0x10,%esp
+  801695:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80169a:	eb bb                	jmp    801657 <read+0x58>
+		return -E_NOT_SUPP;
+  80169c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016a1:	eb b4                	jmp    801657 <read+0x58>
+
+008016a3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	57                   	push   %edi
+  8016a7:	56                   	push   %esi
+  8016a8:	53                   	push   %ebx
+  8016a9:	83 ec 0c             	sub    $0xc,%esp
+  8016ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8016af:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016b2:	85 f6                	test   %esi,%esi
+  8016b4:	74 30                	je     8016e6 <readn+0x43>
+  8016b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bb:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016c0:	83 ec 04             	sub    $0x4,%esp
+  8016c3:	89 f2                	mov    %esi,%edx
+  8016c5:	29 c2                	sub    %eax,%edx
+  8016c7:	52                   	push   %edx
+  8016c8:	01 f8                	add    %edi,%eax
+  8016ca:	50                   	push   %eax
+  8016cb:	ff 75 08             	push   0x8(%ebp)
+  8016ce:	e8 2c ff ff ff       	call   8015ff <read>
+		if (m < 0)
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	78 15                	js     8016ef <readn+0x4c>
+			return m;
+		if (m == 0)
+  8016da:	74 11                	je     8016ed <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8016dc:	01 c3                	add    %eax,%ebx
+  8016de:	89 d8                	mov    %ebx,%eax
+  8016e0:	39 f3                	cmp    %esi,%ebx
+  8016e2:	72 dc                	jb     8016c0 <readn+0x1d>
+  8016e4:	eb 09                	jmp    8016ef <readn+0x4c>
+  8016e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016eb:	eb 02                	jmp    8016ef <readn+0x4c>
+  8016ed:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8016ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5f                   	pop    %edi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+
+008016f7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016f7:	55                   	push   %ebp
+  8016f8:	89 e5                	mov    %esp,%ebp
+  8016fa:	56                   	push   %esi
+  8016fb:	53                   	push   %ebx
+  8016fc:	83 ec 18             	sub    $0x18,%esp
+  8016ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801702:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801705:	50                   	push   %eax
+  801706:	53                   	push   %ebx
+  801707:	e8 6f fc ff ff       	call   80137b <fd_lookup>
+  80170c:	83 c4 10             	add    $0x10,%esp
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	78 37                	js     80174a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801713:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801716:	83 ec 08             	sub    $0x8,%esp
+  801719:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80171c:	50                   	push   %eax
+  80171d:	ff 36                	push   (%esi)
+  80171f:	e8 a9 fc ff ff       	call   8013cd <dev_lookup>
+  801724:	83 c4 10             	add    $0x10,%esp
+  801727:	85 c0                	test   %eax,%eax
+  801729:	78 1f                	js     80174a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80172b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80172f:	74 20                	je     801751 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801731:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801734:	8b 40 0c             	mov    0xc(%eax),%eax
+  801737:	85 c0                	test   %eax,%eax
+  801739:	74 54                	je     80178f <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80173b:	83 ec 04             	sub    $0x4,%esp
+  80173e:	ff 75 10             	push   0x10(%ebp)
+  801741:	ff 75 0c             	push   0xc(%ebp)
+  801744:	56                   	push   %esi
+  801745:	ff d0                	call   *%eax
+  801747:	83 c4 10             	add    $0x10,%esp
+}
+  80174a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174d:	5b                   	pop    %ebx
+  80174e:	5e                   	pop    %esi
+  80174f:	5d                   	pop    %ebp
+  801750:	c3                   	ret
+  801751:	89 e2                	mov    %esp,%edx
+  801753:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801758:	29 d0                	sub    %edx,%eax
+  80175a:	89 c2                	mov    %eax,%edx
+  80175c:	c1 ea 0f             	shr    $0xf,%edx
+  80175f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801764:	b8 00 00 00 00       	mov    $0x0,%eax
+  801769:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80176c:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801773:	8b 40 48             	mov    0x48(%eax),%eax
+  801776:	83 ec 04             	sub    $0x4,%esp
+  801779:	53                   	push   %ebx
+  80177a:	50                   	push   %eax
+  80177b:	68 b5 40 80 00       	push   $0x8040b5
+  801780:	e8 f1 eb ff ff       	call   800376 <cprintf>
+		return -E_INVAL;
+  801785:	83 c4 10             	add    $0x10,%esp
+  801788:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178d:	eb bb                	jmp    80174a <write+0x53>
+		return -E_NOT_SUPP;
+  80178f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801794:	eb b4                	jmp    80174a <write+0x53>
+
+00801796 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801796:	55                   	push   %ebp
+  801797:	89 e5                	mov    %esp,%ebp
+  801799:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80179c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179f:	50                   	push   %eax
+  8017a0:	ff 75 08             	push   0x8(%ebp)
+  8017a3:	e8 d3 fb ff ff       	call   80137b <fd_lookup>
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	78 0e                	js     8017bd <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b5:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017bd:	c9                   	leave
+  8017be:	c3                   	ret
+
+008017bf <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	53                   	push   %ebx
+  8017c3:	83 ec 1c             	sub    $0x1c,%esp
+  8017c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017cc:	50                   	push   %eax
+  8017cd:	ff 75 08             	push   0x8(%ebp)
+  8017d0:	e8 a6 fb ff ff       	call   80137b <fd_lookup>
+  8017d5:	83 c4 10             	add    $0x10,%esp
+  8017d8:	85 c0                	test   %eax,%eax
+  8017da:	78 33                	js     80180f <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8017dc:	83 fb 03             	cmp    $0x3,%ebx
+  8017df:	74 28                	je     801809 <fcntl+0x4a>
+  8017e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e6:	83 fb 04             	cmp    $0x4,%ebx
+  8017e9:	75 24                	jne    80180f <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8017eb:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8017ee:	8b 41 08             	mov    0x8(%ecx),%eax
+  8017f1:	80 e4 ef             	and    $0xef,%ah
+  8017f4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8017f7:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8017fd:	09 d0                	or     %edx,%eax
+  8017ff:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+  801807:	eb 06                	jmp    80180f <fcntl+0x50>
+		return fd->fd_omode;
+  801809:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180c:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80180f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801812:	c9                   	leave
+  801813:	c3                   	ret
+
+00801814 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	56                   	push   %esi
+  801818:	53                   	push   %ebx
+  801819:	83 ec 18             	sub    $0x18,%esp
+  80181c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80181f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801822:	50                   	push   %eax
+  801823:	53                   	push   %ebx
+  801824:	e8 52 fb ff ff       	call   80137b <fd_lookup>
+  801829:	83 c4 10             	add    $0x10,%esp
+  80182c:	85 c0                	test   %eax,%eax
+  80182e:	78 34                	js     801864 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801830:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801833:	83 ec 08             	sub    $0x8,%esp
+  801836:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801839:	50                   	push   %eax
+  80183a:	ff 36                	push   (%esi)
+  80183c:	e8 8c fb ff ff       	call   8013cd <dev_lookup>
+  801841:	83 c4 10             	add    $0x10,%esp
+  801844:	85 c0                	test   %eax,%eax
+  801846:	78 1c                	js     801864 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801848:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80184c:	74 1d                	je     80186b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80184e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801851:	8b 40 18             	mov    0x18(%eax),%eax
+  801854:	85 c0                	test   %eax,%eax
+  801856:	74 51                	je     8018a9 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801858:	83 ec 08             	sub    $0x8,%esp
+  80185b:	ff 75 0c             	push   0xc(%ebp)
+  80185e:	56                   	push   %esi
+  80185f:	ff d0                	call   *%eax
+  801861:	83 c4 10             	add    $0x10,%esp
+}
+  801864:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801867:	5b                   	pop    %ebx
+  801868:	5e                   	pop    %esi
+  801869:	5d                   	pop    %ebp
+  80186a:	c3                   	ret
+  80186b:	89 e2                	mov    %esp,%edx
+  80186d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801872:	29 d0                	sub    %edx,%eax
+  801874:	89 c2                	mov    %eax,%edx
+  801876:	c1 ea 0f             	shr    $0xf,%edx
+  801879:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80187e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801883:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801886:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80188d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801890:	83 ec 04             	sub    $0x4,%esp
+  801893:	53                   	push   %ebx
+  801894:	50                   	push   %eax
+  801895:	68 78 40 80 00       	push   $0x804078
+  80189a:	e8 d7 ea ff ff       	call   800376 <cprintf>
+		return -E_INVAL;
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a7:	eb bb                	jmp    801864 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018ae:	eb b4                	jmp    801864 <ftruncate+0x50>
+
+008018b0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	56                   	push   %esi
+  8018b4:	53                   	push   %ebx
+  8018b5:	83 ec 18             	sub    $0x18,%esp
+  8018b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018bb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018be:	50                   	push   %eax
+  8018bf:	ff 75 08             	push   0x8(%ebp)
+  8018c2:	e8 b4 fa ff ff       	call   80137b <fd_lookup>
+  8018c7:	83 c4 10             	add    $0x10,%esp
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	78 53                	js     801921 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ce:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d1:	83 ec 08             	sub    $0x8,%esp
+  8018d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d7:	50                   	push   %eax
+  8018d8:	ff 36                	push   (%esi)
+  8018da:	e8 ee fa ff ff       	call   8013cd <dev_lookup>
+  8018df:	83 c4 10             	add    $0x10,%esp
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	78 3b                	js     801921 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8018e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018ed:	74 39                	je     801928 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018ef:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018f2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018f9:	00 00 00 
+	stat->st_isdir = 0;
+  8018fc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801903:	00 00 00 
+	stat->st_version = 0;
+  801906:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80190d:	00 00 00 
+	stat->st_dev = dev;
+  801910:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801916:	83 ec 08             	sub    $0x8,%esp
+  801919:	53                   	push   %ebx
+  80191a:	56                   	push   %esi
+  80191b:	ff 50 14             	call   *0x14(%eax)
+  80191e:	83 c4 10             	add    $0x10,%esp
+}
+  801921:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801924:	5b                   	pop    %ebx
+  801925:	5e                   	pop    %esi
+  801926:	5d                   	pop    %ebp
+  801927:	c3                   	ret
+		return -E_NOT_SUPP;
+  801928:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80192d:	eb f2                	jmp    801921 <fstat+0x71>
+
+0080192f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80192f:	55                   	push   %ebp
+  801930:	89 e5                	mov    %esp,%ebp
+  801932:	56                   	push   %esi
+  801933:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801934:	83 ec 08             	sub    $0x8,%esp
+  801937:	6a 00                	push   $0x0
+  801939:	ff 75 08             	push   0x8(%ebp)
+  80193c:	e8 b7 01 00 00       	call   801af8 <open>
+  801941:	89 c3                	mov    %eax,%ebx
+  801943:	83 c4 10             	add    $0x10,%esp
+  801946:	85 c0                	test   %eax,%eax
+  801948:	78 1b                	js     801965 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80194a:	83 ec 08             	sub    $0x8,%esp
+  80194d:	ff 75 0c             	push   0xc(%ebp)
+  801950:	50                   	push   %eax
+  801951:	e8 5a ff ff ff       	call   8018b0 <fstat>
+  801956:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801958:	89 1c 24             	mov    %ebx,(%esp)
+  80195b:	e8 60 fb ff ff       	call   8014c0 <close>
+	return r;
+  801960:	83 c4 10             	add    $0x10,%esp
+  801963:	89 f3                	mov    %esi,%ebx
+}
+  801965:	89 d8                	mov    %ebx,%eax
+  801967:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80196a:	5b                   	pop    %ebx
+  80196b:	5e                   	pop    %esi
+  80196c:	5d                   	pop    %ebp
+  80196d:	c3                   	ret
+
+0080196e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80196e:	55                   	push   %ebp
+  80196f:	89 e5                	mov    %esp,%ebp
+  801971:	56                   	push   %esi
+  801972:	53                   	push   %ebx
+  801973:	89 c6                	mov    %eax,%esi
+  801975:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801977:	83 3d 3c 60 80 00 00 	cmpl   $0x0,0x80603c
+  80197e:	74 27                	je     8019a7 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801980:	6a 07                	push   $0x7
+  801982:	68 00 70 80 00       	push   $0x807000
+  801987:	56                   	push   %esi
+  801988:	ff 35 3c 60 80 00    	push   0x80603c
+  80198e:	e8 d9 1f 00 00       	call   80396c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801993:	83 c4 0c             	add    $0xc,%esp
+  801996:	6a 00                	push   $0x0
+  801998:	53                   	push   %ebx
+  801999:	6a 00                	push   $0x0
+  80199b:	e8 3c 1d 00 00       	call   8036dc <ipc_recv>
+}
+  8019a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a3:	5b                   	pop    %ebx
+  8019a4:	5e                   	pop    %esi
+  8019a5:	5d                   	pop    %ebp
+  8019a6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019a7:	83 ec 0c             	sub    $0xc,%esp
+  8019aa:	6a 02                	push   $0x2
+  8019ac:	e8 24 20 00 00       	call   8039d5 <ipc_find_env>
+  8019b1:	a3 3c 60 80 00       	mov    %eax,0x80603c
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	eb c5                	jmp    801980 <fsipc+0x12>
+
+008019bb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019bb:	55                   	push   %ebp
+  8019bc:	89 e5                	mov    %esp,%ebp
+  8019be:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019c7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8019cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019cf:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019de:	e8 8b ff ff ff       	call   80196e <fsipc>
+}
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+008019e5 <devfile_flush>:
+{
+  8019e5:	55                   	push   %ebp
+  8019e6:	89 e5                	mov    %esp,%ebp
+  8019e8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a00:	e8 69 ff ff ff       	call   80196e <fsipc>
+}
+  801a05:	c9                   	leave
+  801a06:	c3                   	ret
+
+00801a07 <devfile_stat>:
+{
+  801a07:	55                   	push   %ebp
+  801a08:	89 e5                	mov    %esp,%ebp
+  801a0a:	53                   	push   %ebx
+  801a0b:	83 ec 04             	sub    $0x4,%esp
+  801a0e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a14:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a17:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a21:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a26:	e8 43 ff ff ff       	call   80196e <fsipc>
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	78 37                	js     801a66 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a2f:	83 ec 08             	sub    $0x8,%esp
+  801a32:	68 00 70 80 00       	push   $0x807000
+  801a37:	53                   	push   %ebx
+  801a38:	e8 30 f0 ff ff       	call   800a6d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a3d:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a42:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a48:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a4d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801a53:	a1 88 70 80 00       	mov    0x807088,%eax
+  801a58:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801a5e:	83 c4 10             	add    $0x10,%esp
+  801a61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+00801a6b <devfile_write>:
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	83 ec 0c             	sub    $0xc,%esp
+  801a71:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801a74:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a79:	39 d0                	cmp    %edx,%eax
+  801a7b:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a81:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a84:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801a8a:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801a8f:	50                   	push   %eax
+  801a90:	ff 75 0c             	push   0xc(%ebp)
+  801a93:	68 08 70 80 00       	push   $0x807008
+  801a98:	e8 80 f1 ff ff       	call   800c1d <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801a9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801aa7:	e8 c2 fe ff ff       	call   80196e <fsipc>
+}
+  801aac:	c9                   	leave
+  801aad:	c3                   	ret
+
+00801aae <devfile_read>:
+{
+  801aae:	55                   	push   %ebp
+  801aaf:	89 e5                	mov    %esp,%ebp
+  801ab1:	53                   	push   %ebx
+  801ab2:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ab5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801abb:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801ac0:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ac3:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801ac8:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801acd:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ad2:	e8 97 fe ff ff       	call   80196e <fsipc>
+  801ad7:	89 c3                	mov    %eax,%ebx
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	78 14                	js     801af1 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801add:	83 ec 04             	sub    $0x4,%esp
+  801ae0:	50                   	push   %eax
+  801ae1:	68 00 70 80 00       	push   $0x807000
+  801ae6:	ff 75 0c             	push   0xc(%ebp)
+  801ae9:	e8 2f f1 ff ff       	call   800c1d <memmove>
+	return r;
+  801aee:	83 c4 10             	add    $0x10,%esp
+}
+  801af1:	89 d8                	mov    %ebx,%eax
+  801af3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af6:	c9                   	leave
+  801af7:	c3                   	ret
+
+00801af8 <open>:
+{
+  801af8:	55                   	push   %ebp
+  801af9:	89 e5                	mov    %esp,%ebp
+  801afb:	53                   	push   %ebx
+  801afc:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801aff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b02:	50                   	push   %eax
+  801b03:	e8 23 f8 ff ff       	call   80132b <fd_alloc>
+  801b08:	89 c3                	mov    %eax,%ebx
+  801b0a:	83 c4 10             	add    $0x10,%esp
+  801b0d:	85 c0                	test   %eax,%eax
+  801b0f:	78 2a                	js     801b3b <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801b11:	83 ec 0c             	sub    $0xc,%esp
+  801b14:	ff 75 08             	push   0x8(%ebp)
+  801b17:	e8 05 ef ff ff       	call   800a21 <strlen>
+  801b1c:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801b1f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801b24:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b29:	7e 17                	jle    801b42 <open+0x4a>
+	fd_close(fd, 1);
+  801b2b:	83 ec 08             	sub    $0x8,%esp
+  801b2e:	6a 01                	push   $0x1
+  801b30:	ff 75 f4             	push   -0xc(%ebp)
+  801b33:	e8 08 f9 ff ff       	call   801440 <fd_close>
+	return r;
+  801b38:	83 c4 10             	add    $0x10,%esp
+}
+  801b3b:	89 d8                	mov    %ebx,%eax
+  801b3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b40:	c9                   	leave
+  801b41:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801b42:	83 ec 08             	sub    $0x8,%esp
+  801b45:	ff 75 08             	push   0x8(%ebp)
+  801b48:	68 00 70 80 00       	push   $0x807000
+  801b4d:	e8 1b ef ff ff       	call   800a6d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b55:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801b5a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b62:	e8 07 fe ff ff       	call   80196e <fsipc>
+  801b67:	89 c3                	mov    %eax,%ebx
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	78 bb                	js     801b2b <open+0x33>
+	return fd2num(fd); 	
+  801b70:	83 ec 0c             	sub    $0xc,%esp
+  801b73:	ff 75 f4             	push   -0xc(%ebp)
+  801b76:	e8 89 f7 ff ff       	call   801304 <fd2num>
+  801b7b:	89 c3                	mov    %eax,%ebx
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	eb b9                	jmp    801b3b <open+0x43>
+
+00801b82 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801b82:	55                   	push   %ebp
+  801b83:	89 e5                	mov    %esp,%ebp
+  801b85:	53                   	push   %ebx
+  801b86:	83 ec 1c             	sub    $0x1c,%esp
+  801b89:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8f:	50                   	push   %eax
+  801b90:	ff 75 08             	push   0x8(%ebp)
+  801b93:	e8 e3 f7 ff ff       	call   80137b <fd_lookup>
+  801b98:	83 c4 10             	add    $0x10,%esp
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	78 5a                	js     801bf9 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ba2:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801ba8:	39 10                	cmp    %edx,(%eax)
+  801baa:	75 66                	jne    801c12 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801bac:	83 3d 3c 60 80 00 00 	cmpl   $0x0,0x80603c
+  801bb3:	74 49                	je     801bfe <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801bb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bb8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bbb:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801bc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bc3:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801bc8:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bce:	6a 07                	push   $0x7
+  801bd0:	68 00 70 80 00       	push   $0x807000
+  801bd5:	6a 09                	push   $0x9
+  801bd7:	ff 35 3c 60 80 00    	push   0x80603c
+  801bdd:	e8 8a 1d 00 00       	call   80396c <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801be2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801be9:	6a 00                	push   $0x0
+  801beb:	53                   	push   %ebx
+  801bec:	ff 75 10             	push   0x10(%ebp)
+  801bef:	6a 00                	push   $0x0
+  801bf1:	e8 b3 1b 00 00       	call   8037a9 <ipc_recv_pages>
+  801bf6:	83 c4 20             	add    $0x20,%esp
+}
+  801bf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfc:	c9                   	leave
+  801bfd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bfe:	83 ec 0c             	sub    $0xc,%esp
+  801c01:	6a 02                	push   $0x2
+  801c03:	e8 cd 1d 00 00       	call   8039d5 <ipc_find_env>
+  801c08:	a3 3c 60 80 00       	mov    %eax,0x80603c
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	eb a3                	jmp    801bb5 <fmap+0x33>
+		return -E_INVAL;
+  801c12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c17:	eb e0                	jmp    801bf9 <fmap+0x77>
+
+00801c19 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c19:	55                   	push   %ebp
+  801c1a:	89 e5                	mov    %esp,%ebp
+  801c1c:	53                   	push   %ebx
+  801c1d:	83 ec 10             	sub    $0x10,%esp
+  801c20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c23:	53                   	push   %ebx
+  801c24:	e8 f8 ed ff ff       	call   800a21 <strlen>
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c31:	7f 25                	jg     801c58 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c33:	83 ec 08             	sub    $0x8,%esp
+  801c36:	53                   	push   %ebx
+  801c37:	68 00 70 80 00       	push   $0x807000
+  801c3c:	e8 2c ee ff ff       	call   800a6d <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c46:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c4b:	e8 1e fd ff ff       	call   80196e <fsipc>
+  801c50:	83 c4 10             	add    $0x10,%esp
+}
+  801c53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+		return -E_BAD_PATH;
+  801c58:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c5d:	eb f4                	jmp    801c53 <remove+0x3a>
+
+00801c5f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c5f:	55                   	push   %ebp
+  801c60:	89 e5                	mov    %esp,%ebp
+  801c62:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c6f:	e8 fa fc ff ff       	call   80196e <fsipc>
+}
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+
+00801c76 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c76:	55                   	push   %ebp
+  801c77:	89 e5                	mov    %esp,%ebp
+  801c79:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c7c:	68 e8 40 80 00       	push   $0x8040e8
+  801c81:	ff 75 0c             	push   0xc(%ebp)
+  801c84:	e8 e4 ed ff ff       	call   800a6d <strcpy>
+	return 0;
+}
+  801c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8e:	c9                   	leave
+  801c8f:	c3                   	ret
+
+00801c90 <devsock_close>:
+{
+  801c90:	55                   	push   %ebp
+  801c91:	89 e5                	mov    %esp,%ebp
+  801c93:	53                   	push   %ebx
+  801c94:	83 ec 10             	sub    $0x10,%esp
+  801c97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c9a:	53                   	push   %ebx
+  801c9b:	e8 74 1d 00 00       	call   803a14 <pageref>
+  801ca0:	89 c2                	mov    %eax,%edx
+  801ca2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801caa:	83 fa 01             	cmp    $0x1,%edx
+  801cad:	74 05                	je     801cb4 <devsock_close+0x24>
+}
+  801caf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb2:	c9                   	leave
+  801cb3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cb4:	83 ec 0c             	sub    $0xc,%esp
+  801cb7:	ff 73 0c             	push   0xc(%ebx)
+  801cba:	e8 b0 05 00 00       	call   80226f <nsipc_close>
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  801cc2:	eb eb                	jmp    801caf <devsock_close+0x1f>
+
+00801cc4 <devsock_write>:
+{
+  801cc4:	55                   	push   %ebp
+  801cc5:	89 e5                	mov    %esp,%ebp
+  801cc7:	53                   	push   %ebx
+  801cc8:	83 ec 14             	sub    $0x14,%esp
+  801ccb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cd1:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801cd4:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801cd7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801cda:	8b 41 08             	mov    0x8(%ecx),%eax
+  801cdd:	c1 f8 09             	sar    $0x9,%eax
+  801ce0:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801ce3:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801ce9:	77 13                	ja     801cfe <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801ceb:	50                   	push   %eax
+  801cec:	52                   	push   %edx
+  801ced:	53                   	push   %ebx
+  801cee:	ff 71 0c             	push   0xc(%ecx)
+  801cf1:	e8 5c 06 00 00       	call   802352 <nsipc_send>
+  801cf6:	83 c4 10             	add    $0x10,%esp
+}
+  801cf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801cfe:	50                   	push   %eax
+  801cff:	6a 01                	push   $0x1
+  801d01:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d04:	50                   	push   %eax
+  801d05:	ff 71 0c             	push   0xc(%ecx)
+  801d08:	e8 a6 06 00 00       	call   8023b3 <nsipc_sendmsg>
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	eb e7                	jmp    801cf9 <devsock_write+0x35>
+
+00801d12 <devsock_read>:
+{
+  801d12:	55                   	push   %ebp
+  801d13:	89 e5                	mov    %esp,%ebp
+  801d15:	53                   	push   %ebx
+  801d16:	83 ec 14             	sub    $0x14,%esp
+  801d19:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d1f:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801d22:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801d25:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801d28:	8b 41 08             	mov    0x8(%ecx),%eax
+  801d2b:	c1 f8 09             	sar    $0x9,%eax
+  801d2e:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801d31:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801d37:	77 13                	ja     801d4c <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801d39:	50                   	push   %eax
+  801d3a:	52                   	push   %edx
+  801d3b:	53                   	push   %ebx
+  801d3c:	ff 71 0c             	push   0xc(%ecx)
+  801d3f:	e8 9c 05 00 00       	call   8022e0 <nsipc_recv>
+  801d44:	83 c4 10             	add    $0x10,%esp
+}
+  801d47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801d4c:	50                   	push   %eax
+  801d4d:	6a 01                	push   $0x1
+  801d4f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d52:	50                   	push   %eax
+  801d53:	ff 71 0c             	push   0xc(%ecx)
+  801d56:	e8 02 0a 00 00       	call   80275d <nsipc_recvmsg>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	eb e7                	jmp    801d47 <devsock_read+0x35>
+
+00801d60 <fd2sockid>:
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d66:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d69:	52                   	push   %edx
+  801d6a:	50                   	push   %eax
+  801d6b:	e8 0b f6 ff ff       	call   80137b <fd_lookup>
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	78 10                	js     801d87 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7a:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801d80:	39 08                	cmp    %ecx,(%eax)
+  801d82:	75 05                	jne    801d89 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d84:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d89:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8e:	eb f7                	jmp    801d87 <fd2sockid+0x27>
+
+00801d90 <sock_flags>:
+{
+  801d90:	55                   	push   %ebp
+  801d91:	89 e5                	mov    %esp,%ebp
+  801d93:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801d96:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d99:	52                   	push   %edx
+  801d9a:	50                   	push   %eax
+  801d9b:	e8 db f5 ff ff       	call   80137b <fd_lookup>
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 0e                	js     801db5 <sock_flags+0x25>
+  801da7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801daa:	8b 40 08             	mov    0x8(%eax),%eax
+  801dad:	c1 e8 09             	shr    $0x9,%eax
+  801db0:	83 e0 08             	and    $0x8,%eax
+}
+  801db3:	c9                   	leave
+  801db4:	c3                   	ret
+		return 0;
+  801db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dba:	eb f7                	jmp    801db3 <sock_flags+0x23>
+
+00801dbc <alloc_sockfd>:
+{
+  801dbc:	55                   	push   %ebp
+  801dbd:	89 e5                	mov    %esp,%ebp
+  801dbf:	56                   	push   %esi
+  801dc0:	53                   	push   %ebx
+  801dc1:	83 ec 1c             	sub    $0x1c,%esp
+  801dc4:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801dc6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc9:	50                   	push   %eax
+  801dca:	e8 5c f5 ff ff       	call   80132b <fd_alloc>
+  801dcf:	89 c3                	mov    %eax,%ebx
+  801dd1:	83 c4 10             	add    $0x10,%esp
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 43                	js     801e1b <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801dd8:	83 ec 04             	sub    $0x4,%esp
+  801ddb:	68 07 04 00 00       	push   $0x407
+  801de0:	ff 75 f4             	push   -0xc(%ebp)
+  801de3:	6a 00                	push   $0x0
+  801de5:	e8 b7 f0 ff ff       	call   800ea1 <sys_page_alloc>
+  801dea:	89 c3                	mov    %eax,%ebx
+  801dec:	83 c4 10             	add    $0x10,%esp
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	78 28                	js     801e1b <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df6:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801dfc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801dfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e01:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801e08:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801e0b:	83 ec 0c             	sub    $0xc,%esp
+  801e0e:	50                   	push   %eax
+  801e0f:	e8 f0 f4 ff ff       	call   801304 <fd2num>
+  801e14:	89 c3                	mov    %eax,%ebx
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	eb 0c                	jmp    801e27 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e1b:	83 ec 0c             	sub    $0xc,%esp
+  801e1e:	56                   	push   %esi
+  801e1f:	e8 4b 04 00 00       	call   80226f <nsipc_close>
+		return r;
+  801e24:	83 c4 10             	add    $0x10,%esp
+}
+  801e27:	89 d8                	mov    %ebx,%eax
+  801e29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5d                   	pop    %ebp
+  801e2f:	c3                   	ret
+
+00801e30 <accept>:
+{
+  801e30:	55                   	push   %ebp
+  801e31:	89 e5                	mov    %esp,%ebp
+  801e33:	56                   	push   %esi
+  801e34:	53                   	push   %ebx
+  801e35:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e38:	89 f0                	mov    %esi,%eax
+  801e3a:	e8 21 ff ff ff       	call   801d60 <fd2sockid>
+  801e3f:	89 c3                	mov    %eax,%ebx
+  801e41:	85 c0                	test   %eax,%eax
+  801e43:	78 24                	js     801e69 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801e45:	89 f0                	mov    %esi,%eax
+  801e47:	e8 44 ff ff ff       	call   801d90 <sock_flags>
+  801e4c:	50                   	push   %eax
+  801e4d:	ff 75 10             	push   0x10(%ebp)
+  801e50:	ff 75 0c             	push   0xc(%ebp)
+  801e53:	53                   	push   %ebx
+  801e54:	e8 6b 03 00 00       	call   8021c4 <nsipc_accept>
+  801e59:	89 c3                	mov    %eax,%ebx
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	78 07                	js     801e69 <accept+0x39>
+	return alloc_sockfd(r);
+  801e62:	e8 55 ff ff ff       	call   801dbc <alloc_sockfd>
+  801e67:	89 c3                	mov    %eax,%ebx
+}
+  801e69:	89 d8                	mov    %ebx,%eax
+  801e6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6e:	5b                   	pop    %ebx
+  801e6f:	5e                   	pop    %esi
+  801e70:	5d                   	pop    %ebp
+  801e71:	c3                   	ret
+
+00801e72 <bind>:
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7b:	e8 e0 fe ff ff       	call   801d60 <fd2sockid>
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	78 12                	js     801e96 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e84:	83 ec 04             	sub    $0x4,%esp
+  801e87:	ff 75 10             	push   0x10(%ebp)
+  801e8a:	ff 75 0c             	push   0xc(%ebp)
+  801e8d:	50                   	push   %eax
+  801e8e:	e8 85 03 00 00       	call   802218 <nsipc_bind>
+  801e93:	83 c4 10             	add    $0x10,%esp
+}
+  801e96:	c9                   	leave
+  801e97:	c3                   	ret
+
+00801e98 <shutdown>:
+{
+  801e98:	55                   	push   %ebp
+  801e99:	89 e5                	mov    %esp,%ebp
+  801e9b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea1:	e8 ba fe ff ff       	call   801d60 <fd2sockid>
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 0f                	js     801eb9 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801eaa:	83 ec 08             	sub    $0x8,%esp
+  801ead:	ff 75 0c             	push   0xc(%ebp)
+  801eb0:	50                   	push   %eax
+  801eb1:	e8 97 03 00 00       	call   80224d <nsipc_shutdown>
+  801eb6:	83 c4 10             	add    $0x10,%esp
+}
+  801eb9:	c9                   	leave
+  801eba:	c3                   	ret
+
+00801ebb <connect>:
+{
+  801ebb:	55                   	push   %ebp
+  801ebc:	89 e5                	mov    %esp,%ebp
+  801ebe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec4:	e8 97 fe ff ff       	call   801d60 <fd2sockid>
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 12                	js     801edf <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ecd:	83 ec 04             	sub    $0x4,%esp
+  801ed0:	ff 75 10             	push   0x10(%ebp)
+  801ed3:	ff 75 0c             	push   0xc(%ebp)
+  801ed6:	50                   	push   %eax
+  801ed7:	e8 ad 03 00 00       	call   802289 <nsipc_connect>
+  801edc:	83 c4 10             	add    $0x10,%esp
+}
+  801edf:	c9                   	leave
+  801ee0:	c3                   	ret
+
+00801ee1 <listen>:
+{
+  801ee1:	55                   	push   %ebp
+  801ee2:	89 e5                	mov    %esp,%ebp
+  801ee4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eea:	e8 71 fe ff ff       	call   801d60 <fd2sockid>
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	78 0f                	js     801f02 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ef3:	83 ec 08             	sub    $0x8,%esp
+  801ef6:	ff 75 0c             	push   0xc(%ebp)
+  801ef9:	50                   	push   %eax
+  801efa:	e8 bf 03 00 00       	call   8022be <nsipc_listen>
+  801eff:	83 c4 10             	add    $0x10,%esp
+}
+  801f02:	c9                   	leave
+  801f03:	c3                   	ret
+
+00801f04 <sendmsg>:
+{
+  801f04:	55                   	push   %ebp
+  801f05:	89 e5                	mov    %esp,%ebp
+  801f07:	57                   	push   %edi
+  801f08:	56                   	push   %esi
+  801f09:	53                   	push   %ebx
+  801f0a:	83 ec 0c             	sub    $0xc,%esp
+  801f0d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f10:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801f13:	89 f0                	mov    %esi,%eax
+  801f15:	e8 46 fe ff ff       	call   801d60 <fd2sockid>
+  801f1a:	89 c3                	mov    %eax,%ebx
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 1c                	js     801f3c <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801f20:	89 f0                	mov    %esi,%eax
+  801f22:	e8 69 fe ff ff       	call   801d90 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f27:	0b 45 10             	or     0x10(%ebp),%eax
+  801f2a:	50                   	push   %eax
+  801f2b:	ff 77 0c             	push   0xc(%edi)
+  801f2e:	ff 77 08             	push   0x8(%edi)
+  801f31:	53                   	push   %ebx
+  801f32:	e8 7c 04 00 00       	call   8023b3 <nsipc_sendmsg>
+  801f37:	89 c3                	mov    %eax,%ebx
+  801f39:	83 c4 10             	add    $0x10,%esp
+}
+  801f3c:	89 d8                	mov    %ebx,%eax
+  801f3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f41:	5b                   	pop    %ebx
+  801f42:	5e                   	pop    %esi
+  801f43:	5f                   	pop    %edi
+  801f44:	5d                   	pop    %ebp
+  801f45:	c3                   	ret
+
+00801f46 <recvmsg>:
+{
+  801f46:	55                   	push   %ebp
+  801f47:	89 e5                	mov    %esp,%ebp
+  801f49:	57                   	push   %edi
+  801f4a:	56                   	push   %esi
+  801f4b:	53                   	push   %ebx
+  801f4c:	83 ec 0c             	sub    $0xc,%esp
+  801f4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f52:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f55:	89 f8                	mov    %edi,%eax
+  801f57:	e8 04 fe ff ff       	call   801d60 <fd2sockid>
+  801f5c:	89 c3                	mov    %eax,%ebx
+  801f5e:	85 c0                	test   %eax,%eax
+  801f60:	78 2a                	js     801f8c <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801f62:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801f69:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801f70:	89 f8                	mov    %edi,%eax
+  801f72:	e8 19 fe ff ff       	call   801d90 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f77:	0b 45 10             	or     0x10(%ebp),%eax
+  801f7a:	50                   	push   %eax
+  801f7b:	ff 76 0c             	push   0xc(%esi)
+  801f7e:	ff 76 08             	push   0x8(%esi)
+  801f81:	53                   	push   %ebx
+  801f82:	e8 d6 07 00 00       	call   80275d <nsipc_recvmsg>
+  801f87:	89 c3                	mov    %eax,%ebx
+  801f89:	83 c4 10             	add    $0x10,%esp
+}
+  801f8c:	89 d8                	mov    %ebx,%eax
+  801f8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f91:	5b                   	pop    %ebx
+  801f92:	5e                   	pop    %esi
+  801f93:	5f                   	pop    %edi
+  801f94:	5d                   	pop    %ebp
+  801f95:	c3                   	ret
+
+00801f96 <sendfile>:
+{
+  801f96:	55                   	push   %ebp
+  801f97:	89 e5                	mov    %esp,%ebp
+  801f99:	56                   	push   %esi
+  801f9a:	53                   	push   %ebx
+  801f9b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f9e:	89 f0                	mov    %esi,%eax
+  801fa0:	e8 bb fd ff ff       	call   801d60 <fd2sockid>
+  801fa5:	89 c3                	mov    %eax,%ebx
+  801fa7:	85 c0                	test   %eax,%eax
+  801fa9:	78 1f                	js     801fca <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801fab:	89 f0                	mov    %esi,%eax
+  801fad:	e8 de fd ff ff       	call   801d90 <sock_flags>
+  801fb2:	83 ec 0c             	sub    $0xc,%esp
+  801fb5:	50                   	push   %eax
+  801fb6:	ff 75 14             	push   0x14(%ebp)
+  801fb9:	ff 75 10             	push   0x10(%ebp)
+  801fbc:	ff 75 0c             	push   0xc(%ebp)
+  801fbf:	53                   	push   %ebx
+  801fc0:	e8 64 06 00 00       	call   802629 <nsipc_sendfile>
+  801fc5:	89 c3                	mov    %eax,%ebx
+  801fc7:	83 c4 20             	add    $0x20,%esp
+}
+  801fca:	89 d8                	mov    %ebx,%eax
+  801fcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fcf:	5b                   	pop    %ebx
+  801fd0:	5e                   	pop    %esi
+  801fd1:	5d                   	pop    %ebp
+  801fd2:	c3                   	ret
+
+00801fd3 <evctl>:
+{
+  801fd3:	55                   	push   %ebp
+  801fd4:	89 e5                	mov    %esp,%ebp
+  801fd6:	53                   	push   %ebx
+  801fd7:	83 ec 04             	sub    $0x4,%esp
+  801fda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801fdd:	89 d8                	mov    %ebx,%eax
+  801fdf:	e8 7c fd ff ff       	call   801d60 <fd2sockid>
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	78 10                	js     801ff8 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801fe8:	83 ec 04             	sub    $0x4,%esp
+  801feb:	53                   	push   %ebx
+  801fec:	ff 75 0c             	push   0xc(%ebp)
+  801fef:	50                   	push   %eax
+  801ff0:	e8 d2 0b 00 00       	call   802bc7 <nsipc_evctl>
+  801ff5:	83 c4 10             	add    $0x10,%esp
+}
+  801ff8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ffb:	c9                   	leave
+  801ffc:	c3                   	ret
+
+00801ffd <evwait>:
+{
+  801ffd:	55                   	push   %ebp
+  801ffe:	89 e5                	mov    %esp,%ebp
+  802000:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802003:	ff 75 10             	push   0x10(%ebp)
+  802006:	ff 75 0c             	push   0xc(%ebp)
+  802009:	ff 75 08             	push   0x8(%ebp)
+  80200c:	e8 e0 0b 00 00       	call   802bf1 <nsipc_evwait>
+}
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+
+00802013 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802013:	55                   	push   %ebp
+  802014:	89 e5                	mov    %esp,%ebp
+  802016:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802019:	ff 75 10             	push   0x10(%ebp)
+  80201c:	ff 75 0c             	push   0xc(%ebp)
+  80201f:	ff 75 08             	push   0x8(%ebp)
+  802022:	e8 31 0c 00 00       	call   802c58 <nsipc_socket>
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	78 05                	js     802033 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80202e:	e8 89 fd ff ff       	call   801dbc <alloc_sockfd>
+}
+  802033:	c9                   	leave
+  802034:	c3                   	ret
+
+00802035 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	53                   	push   %ebx
+  802039:	83 ec 04             	sub    $0x4,%esp
+  80203c:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80203e:	83 3d 44 63 80 00 00 	cmpl   $0x0,0x806344
+  802045:	74 26                	je     80206d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802047:	6a 07                	push   $0x7
+  802049:	68 00 80 80 00       	push   $0x808000
+  80204e:	53                   	push   %ebx
+  80204f:	ff 35 44 63 80 00    	push   0x806344
+  802055:	e8 12 19 00 00       	call   80396c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80205a:	83 c4 0c             	add    $0xc,%esp
+  80205d:	6a 00                	push   $0x0
+  80205f:	6a 00                	push   $0x0
+  802061:	6a 00                	push   $0x0
+  802063:	e8 74 16 00 00       	call   8036dc <ipc_recv>
+}
+  802068:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80206b:	c9                   	leave
+  80206c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+  802070:	6a 03                	push   $0x3
+  802072:	e8 5e 19 00 00       	call   8039d5 <ipc_find_env>
+  802077:	a3 44 63 80 00       	mov    %eax,0x806344
+  80207c:	83 c4 10             	add    $0x10,%esp
+  80207f:	eb c6                	jmp    802047 <nsipc+0x12>
+
+00802081 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802081:	55                   	push   %ebp
+  802082:	89 e5                	mov    %esp,%ebp
+  802084:	56                   	push   %esi
+  802085:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802086:	8b 35 50 63 80 00    	mov    0x806350,%esi
+		return 0;
+  80208c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802091:	85 f6                	test   %esi,%esi
+  802093:	75 33                	jne    8020c8 <nsbulk_map+0x47>
+  802095:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80209a:	83 ec 04             	sub    $0x4,%esp
+  80209d:	6a 07                	push   $0x7
+  80209f:	53                   	push   %ebx
+  8020a0:	6a 00                	push   $0x0
+  8020a2:	e8 fa ed ff ff       	call   800ea1 <sys_page_alloc>
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	78 1a                	js     8020c8 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8020ae:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020b4:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8020ba:	75 de                	jne    80209a <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8020bc:	c7 05 50 63 80 00 01 	movl   $0x1,0x806350
+  8020c3:	00 00 00 
+	return 0;
+  8020c6:	89 f0                	mov    %esi,%eax
+}
+  8020c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020cb:	5b                   	pop    %ebx
+  8020cc:	5e                   	pop    %esi
+  8020cd:	5d                   	pop    %ebp
+  8020ce:	c3                   	ret
+
+008020cf <nsbulk_own>:
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	57                   	push   %edi
+  8020d3:	56                   	push   %esi
+  8020d4:	53                   	push   %ebx
+  8020d5:	83 ec 0c             	sub    $0xc,%esp
+  8020d8:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8020da:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8020dd:	85 d2                	test   %edx,%edx
+  8020df:	7f 0e                	jg     8020ef <nsbulk_own+0x20>
+	return 0;
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e6:	eb 47                	jmp    80212f <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8020e8:	83 c3 01             	add    $0x1,%ebx
+  8020eb:	39 fb                	cmp    %edi,%ebx
+  8020ed:	7d 3b                	jge    80212a <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8020ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8020f4:	89 d9                	mov    %ebx,%ecx
+  8020f6:	d3 e6                	shl    %cl,%esi
+  8020f8:	89 f0                	mov    %esi,%eax
+  8020fa:	23 05 4c 63 80 00    	and    0x80634c,%eax
+  802100:	74 e6                	je     8020e8 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802102:	83 ec 04             	sub    $0x4,%esp
+  802105:	6a 07                	push   $0x7
+  802107:	89 d8                	mov    %ebx,%eax
+  802109:	c1 e0 0c             	shl    $0xc,%eax
+  80210c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802111:	50                   	push   %eax
+  802112:	6a 00                	push   $0x0
+  802114:	e8 88 ed ff ff       	call   800ea1 <sys_page_alloc>
+  802119:	83 c4 10             	add    $0x10,%esp
+  80211c:	85 c0                	test   %eax,%eax
+  80211e:	78 0f                	js     80212f <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802120:	f7 d6                	not    %esi
+  802122:	21 35 4c 63 80 00    	and    %esi,0x80634c
+  802128:	eb be                	jmp    8020e8 <nsbulk_own+0x19>
+	return 0;
+  80212a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80212f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802132:	5b                   	pop    %ebx
+  802133:	5e                   	pop    %esi
+  802134:	5f                   	pop    %edi
+  802135:	5d                   	pop    %ebp
+  802136:	c3                   	ret
+
+00802137 <nsipc_bulk>:
+{
+  802137:	55                   	push   %ebp
+  802138:	89 e5                	mov    %esp,%ebp
+  80213a:	57                   	push   %edi
+  80213b:	56                   	push   %esi
+  80213c:	53                   	push   %ebx
+  80213d:	83 ec 1c             	sub    $0x1c,%esp
+  802140:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802143:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802145:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80214b:	c1 fb 0c             	sar    $0xc,%ebx
+  80214e:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802151:	83 3d 44 63 80 00 00 	cmpl   $0x0,0x806344
+  802158:	74 56                	je     8021b0 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80215a:	85 ff                	test   %edi,%edi
+  80215c:	7e 24                	jle    802182 <nsipc_bulk+0x4b>
+  80215e:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802164:	74 1c                	je     802182 <nsipc_bulk+0x4b>
+  802166:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80216c:	c1 e3 0c             	shl    $0xc,%ebx
+  80216f:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802174:	0f b6 10             	movzbl (%eax),%edx
+  802177:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802179:	05 00 10 00 00       	add    $0x1000,%eax
+  80217e:	39 d8                	cmp    %ebx,%eax
+  802180:	75 f2                	jne    802174 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	56                   	push   %esi
+  802186:	57                   	push   %edi
+  802187:	68 00 00 00 e0       	push   $0xe0000000
+  80218c:	ff 75 e4             	push   -0x1c(%ebp)
+  80218f:	ff 35 44 63 80 00    	push   0x806344
+  802195:	e8 06 18 00 00       	call   8039a0 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80219a:	83 c4 1c             	add    $0x1c,%esp
+  80219d:	6a 00                	push   $0x0
+  80219f:	6a 00                	push   $0x0
+  8021a1:	6a 00                	push   $0x0
+  8021a3:	e8 34 15 00 00       	call   8036dc <ipc_recv>
+}
+  8021a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ab:	5b                   	pop    %ebx
+  8021ac:	5e                   	pop    %esi
+  8021ad:	5f                   	pop    %edi
+  8021ae:	5d                   	pop    %ebp
+  8021af:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8021b0:	83 ec 0c             	sub    $0xc,%esp
+  8021b3:	6a 03                	push   $0x3
+  8021b5:	e8 1b 18 00 00       	call   8039d5 <ipc_find_env>
+  8021ba:	a3 44 63 80 00       	mov    %eax,0x806344
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	eb 96                	jmp    80215a <nsipc_bulk+0x23>
+
+008021c4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	53                   	push   %ebx
+  8021c8:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8021cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ce:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8021d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021d6:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8021db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021e0:	e8 50 fe ff ff       	call   802035 <nsipc>
+  8021e5:	89 c3                	mov    %eax,%ebx
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	79 07                	jns    8021f2 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8021eb:	89 d8                	mov    %ebx,%eax
+  8021ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8021f2:	83 ec 04             	sub    $0x4,%esp
+  8021f5:	ff 35 10 80 80 00    	push   0x808010
+  8021fb:	68 00 80 80 00       	push   $0x808000
+  802200:	ff 75 0c             	push   0xc(%ebp)
+  802203:	e8 15 ea ff ff       	call   800c1d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802208:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80220e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802211:	89 10                	mov    %edx,(%eax)
+  802213:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802216:	eb d3                	jmp    8021eb <nsipc_accept+0x27>
+
+00802218 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802218:	55                   	push   %ebp
+  802219:	89 e5                	mov    %esp,%ebp
+  80221b:	53                   	push   %ebx
+  80221c:	83 ec 08             	sub    $0x8,%esp
+  80221f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802222:	8b 45 08             	mov    0x8(%ebp),%eax
+  802225:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80222a:	53                   	push   %ebx
+  80222b:	ff 75 0c             	push   0xc(%ebp)
+  80222e:	68 04 80 80 00       	push   $0x808004
+  802233:	e8 e5 e9 ff ff       	call   800c1d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802238:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80223e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802243:	e8 ed fd ff ff       	call   802035 <nsipc>
+}
+  802248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80224b:	c9                   	leave
+  80224c:	c3                   	ret
+
+0080224d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80224d:	55                   	push   %ebp
+  80224e:	89 e5                	mov    %esp,%ebp
+  802250:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802253:	8b 45 08             	mov    0x8(%ebp),%eax
+  802256:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80225b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80225e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802263:	b8 03 00 00 00       	mov    $0x3,%eax
+  802268:	e8 c8 fd ff ff       	call   802035 <nsipc>
+}
+  80226d:	c9                   	leave
+  80226e:	c3                   	ret
+
+0080226f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802275:	8b 45 08             	mov    0x8(%ebp),%eax
+  802278:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80227d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802282:	e8 ae fd ff ff       	call   802035 <nsipc>
+}
+  802287:	c9                   	leave
+  802288:	c3                   	ret
+
+00802289 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802289:	55                   	push   %ebp
+  80228a:	89 e5                	mov    %esp,%ebp
+  80228c:	53                   	push   %ebx
+  80228d:	83 ec 08             	sub    $0x8,%esp
+  802290:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802293:	8b 45 08             	mov    0x8(%ebp),%eax
+  802296:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80229b:	53                   	push   %ebx
+  80229c:	ff 75 0c             	push   0xc(%ebp)
+  80229f:	68 04 80 80 00       	push   $0x808004
+  8022a4:	e8 74 e9 ff ff       	call   800c1d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8022a9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8022af:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022b4:	e8 7c fd ff ff       	call   802035 <nsipc>
+}
+  8022b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bc:	c9                   	leave
+  8022bd:	c3                   	ret
+
+008022be <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8022be:	55                   	push   %ebp
+  8022bf:	89 e5                	mov    %esp,%ebp
+  8022c1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8022c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8022cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022cf:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8022d4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022d9:	e8 57 fd ff ff       	call   802035 <nsipc>
+}
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+
+008022e0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8022e0:	55                   	push   %ebp
+  8022e1:	89 e5                	mov    %esp,%ebp
+  8022e3:	56                   	push   %esi
+  8022e4:	53                   	push   %ebx
+  8022e5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8022e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022eb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8022f0:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8022f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022f9:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8022fe:	b8 07 00 00 00       	mov    $0x7,%eax
+  802303:	e8 2d fd ff ff       	call   802035 <nsipc>
+  802308:	89 c3                	mov    %eax,%ebx
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	78 22                	js     802330 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80230e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802313:	39 c6                	cmp    %eax,%esi
+  802315:	0f 4e c6             	cmovle %esi,%eax
+  802318:	39 c3                	cmp    %eax,%ebx
+  80231a:	7f 1d                	jg     802339 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80231c:	83 ec 04             	sub    $0x4,%esp
+  80231f:	53                   	push   %ebx
+  802320:	68 00 80 80 00       	push   $0x808000
+  802325:	ff 75 0c             	push   0xc(%ebp)
+  802328:	e8 f0 e8 ff ff       	call   800c1d <memmove>
+  80232d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802330:	89 d8                	mov    %ebx,%eax
+  802332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802335:	5b                   	pop    %ebx
+  802336:	5e                   	pop    %esi
+  802337:	5d                   	pop    %ebp
+  802338:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802339:	68 f4 40 80 00       	push   $0x8040f4
+  80233e:	68 09 41 80 00       	push   $0x804109
+  802343:	68 b2 00 00 00       	push   $0xb2
+  802348:	68 1e 41 80 00       	push   $0x80411e
+  80234d:	e8 49 df ff ff       	call   80029b <_panic>
+
+00802352 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	53                   	push   %ebx
+  802356:	83 ec 04             	sub    $0x4,%esp
+  802359:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80235c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235f:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802364:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80236a:	7f 2e                	jg     80239a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80236c:	83 ec 04             	sub    $0x4,%esp
+  80236f:	53                   	push   %ebx
+  802370:	ff 75 0c             	push   0xc(%ebp)
+  802373:	68 0c 80 80 00       	push   $0x80800c
+  802378:	e8 a0 e8 ff ff       	call   800c1d <memmove>
+	nsipcbuf.send.req_size = size;
+  80237d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802383:	8b 45 14             	mov    0x14(%ebp),%eax
+  802386:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80238b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802390:	e8 a0 fc ff ff       	call   802035 <nsipc>
+}
+  802395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802398:	c9                   	leave
+  802399:	c3                   	ret
+	assert(size < 1600);
+  80239a:	68 2a 41 80 00       	push   $0x80412a
+  80239f:	68 09 41 80 00       	push   $0x804109
+  8023a4:	68 bd 00 00 00       	push   $0xbd
+  8023a9:	68 1e 41 80 00       	push   $0x80411e
+  8023ae:	e8 e8 de ff ff       	call   80029b <_panic>
+
+008023b3 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8023b3:	55                   	push   %ebp
+  8023b4:	89 e5                	mov    %esp,%ebp
+  8023b6:	57                   	push   %edi
+  8023b7:	56                   	push   %esi
+  8023b8:	53                   	push   %ebx
+  8023b9:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8023bc:	e8 c0 fc ff ff       	call   802081 <nsbulk_map>
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	78 55                	js     80241a <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8023c5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8023cc:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8023d3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8023da:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023dd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023e0:	0f 8d 24 02 00 00    	jge    80260a <nsipc_sendmsg+0x257>
+  8023e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023e9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023ec:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8023ef:	89 d8                	mov    %ebx,%eax
+  8023f1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023f6:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8023f8:	83 ec 0c             	sub    $0xc,%esp
+  8023fb:	68 40 60 80 00       	push   $0x806040
+  802400:	e8 5a 0f 00 00       	call   80335f <pgbatch_init>
+  802405:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802408:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80240a:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80240d:	e9 82 00 00 00       	jmp    802494 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802412:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802415:	85 db                	test   %ebx,%ebx
+  802417:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  80241a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80241d:	5b                   	pop    %ebx
+  80241e:	5e                   	pop    %esi
+  80241f:	5f                   	pop    %edi
+  802420:	5d                   	pop    %ebp
+  802421:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802422:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802427:	29 c8                	sub    %ecx,%eax
+  802429:	39 d0                	cmp    %edx,%eax
+  80242b:	0f 46 d0             	cmovbe %eax,%edx
+  80242e:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802430:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802436:	85 ff                	test   %edi,%edi
+  802438:	0f 49 c7             	cmovns %edi,%eax
+  80243b:	c1 f8 0c             	sar    $0xc,%eax
+  80243e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802443:	e8 87 fc ff ff       	call   8020cf <nsbulk_own>
+  802448:	85 c0                	test   %eax,%eax
+  80244a:	0f 88 17 01 00 00    	js     802567 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802450:	83 ec 04             	sub    $0x4,%esp
+  802453:	56                   	push   %esi
+  802454:	ff 75 e0             	push   -0x20(%ebp)
+  802457:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80245a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80245f:	50                   	push   %eax
+  802460:	e8 b8 e7 ff ff       	call   800c1d <memmove>
+  802465:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802468:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80246b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80246e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802471:	0f 84 fd 00 00 00    	je     802574 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802477:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80247a:	01 f7                	add    %esi,%edi
+  80247c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80247f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802482:	0f 8d 01 01 00 00    	jge    802589 <nsipc_sendmsg+0x1d6>
+  802488:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80248e:	0f 8f f0 00 00 00    	jg     802584 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802494:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802497:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80249a:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80249d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024a0:	89 c2                	mov    %eax,%edx
+  8024a2:	03 13                	add    (%ebx),%edx
+  8024a4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8024a7:	8b 73 04             	mov    0x4(%ebx),%esi
+  8024aa:	29 c6                	sub    %eax,%esi
+  8024ac:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8024b1:	29 f9                	sub    %edi,%ecx
+  8024b3:	39 ce                	cmp    %ecx,%esi
+  8024b5:	89 ca                	mov    %ecx,%edx
+  8024b7:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8024ba:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8024bd:	89 f9                	mov    %edi,%ecx
+  8024bf:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8024c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024c8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024cd:	09 c8                	or     %ecx,%eax
+  8024cf:	0f 85 4d ff ff ff    	jne    802422 <nsipc_sendmsg+0x6f>
+  8024d5:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8024db:	0f 86 41 ff ff ff    	jbe    802422 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024e1:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8024e7:	85 ff                	test   %edi,%edi
+  8024e9:	0f 49 c7             	cmovns %edi,%eax
+  8024ec:	c1 f8 0c             	sar    $0xc,%eax
+  8024ef:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8024f1:	89 d1                	mov    %edx,%ecx
+  8024f3:	c1 e9 0c             	shr    $0xc,%ecx
+  8024f6:	01 c8                	add    %ecx,%eax
+  8024f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024fb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024fe:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802500:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802503:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802508:	29 c8                	sub    %ecx,%eax
+  80250a:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80250d:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802510:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802512:	b8 01 00 00 00       	mov    $0x1,%eax
+  802517:	89 f9                	mov    %edi,%ecx
+  802519:	d3 e0                	shl    %cl,%eax
+  80251b:	09 05 4c 63 80 00    	or     %eax,0x80634c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802521:	83 ec 08             	sub    $0x8,%esp
+  802524:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802526:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802529:	50                   	push   %eax
+  80252a:	6a 00                	push   $0x0
+  80252c:	56                   	push   %esi
+  80252d:	6a 00                	push   $0x0
+  80252f:	68 40 60 80 00       	push   $0x806040
+  802534:	e8 e4 0e 00 00       	call   80341d <pgbatch_map>
+  802539:	83 c4 20             	add    $0x20,%esp
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	0f 88 ce fe ff ff    	js     802412 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802544:	83 c7 01             	add    $0x1,%edi
+  802547:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80254d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802550:	39 c7                	cmp    %eax,%edi
+  802552:	75 be                	jne    802512 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802554:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802557:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80255a:	89 d6                	mov    %edx,%esi
+  80255c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802562:	e9 01 ff ff ff       	jmp    802468 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802567:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80256a:	85 db                	test   %ebx,%ebx
+  80256c:	0f 45 c3             	cmovne %ebx,%eax
+  80256f:	e9 a6 fe ff ff       	jmp    80241a <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802574:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802578:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80257f:	e9 f3 fe ff ff       	jmp    802477 <nsipc_sendmsg+0xc4>
+  802584:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802587:	eb 03                	jmp    80258c <nsipc_sendmsg+0x1d9>
+  802589:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80258c:	83 ec 0c             	sub    $0xc,%esp
+  80258f:	68 40 60 80 00       	push   $0x806040
+  802594:	e8 d4 0d 00 00       	call   80336d <pgbatch_flush>
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 50                	js     8025f0 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8025a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a3:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8025a8:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8025ae:	89 fb                	mov    %edi,%ebx
+  8025b0:	29 f3                	sub    %esi,%ebx
+  8025b2:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8025b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025bb:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8025c0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8025c5:	89 fa                	mov    %edi,%edx
+  8025c7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8025cc:	e8 66 fb ff ff       	call   802137 <nsipc_bulk>
+  8025d1:	85 c0                	test   %eax,%eax
+  8025d3:	78 28                	js     8025fd <nsipc_sendmsg+0x24a>
+		sent += r;
+  8025d5:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8025d8:	39 c3                	cmp    %eax,%ebx
+  8025da:	75 0c                	jne    8025e8 <nsipc_sendmsg+0x235>
+  8025dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025df:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8025e2:	0f 8f f2 fd ff ff    	jg     8023da <nsipc_sendmsg+0x27>
+		sent += r;
+  8025e8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8025eb:	e9 2a fe ff ff       	jmp    80241a <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8025f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025f3:	85 db                	test   %ebx,%ebx
+  8025f5:	0f 45 c3             	cmovne %ebx,%eax
+  8025f8:	e9 1d fe ff ff       	jmp    80241a <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8025fd:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802600:	85 db                	test   %ebx,%ebx
+  802602:	0f 45 c3             	cmovne %ebx,%eax
+  802605:	e9 10 fe ff ff       	jmp    80241a <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  80260a:	83 ec 0c             	sub    $0xc,%esp
+  80260d:	68 40 60 80 00       	push   $0x806040
+  802612:	e8 48 0d 00 00       	call   80335f <pgbatch_init>
+  802617:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80261a:	be 00 00 00 00       	mov    $0x0,%esi
+  80261f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802624:	e9 63 ff ff ff       	jmp    80258c <nsipc_sendmsg+0x1d9>
+
+00802629 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802629:	55                   	push   %ebp
+  80262a:	89 e5                	mov    %esp,%ebp
+  80262c:	57                   	push   %edi
+  80262d:	56                   	push   %esi
+  80262e:	53                   	push   %ebx
+  80262f:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802632:	83 3d 48 63 80 00 00 	cmpl   $0x0,0x806348
+  802639:	0f 84 c8 00 00 00    	je     802707 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80263f:	83 3d 44 63 80 00 00 	cmpl   $0x0,0x806344
+  802646:	0f 84 e4 00 00 00    	je     802730 <nsipc_sendfile+0x107>
+{
+  80264c:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802651:	89 fb                	mov    %edi,%ebx
+  802653:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802656:	0f 83 f0 00 00 00    	jae    80274c <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80265c:	89 fa                	mov    %edi,%edx
+  80265e:	03 55 10             	add    0x10(%ebp),%edx
+  802661:	89 d0                	mov    %edx,%eax
+  802663:	c1 f8 1f             	sar    $0x1f,%eax
+  802666:	c1 e8 14             	shr    $0x14,%eax
+  802669:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80266c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802672:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802674:	6a 10                	push   $0x10
+  802676:	68 00 20 01 e0       	push   $0xe0012000
+  80267b:	52                   	push   %edx
+  80267c:	ff 75 0c             	push   0xc(%ebp)
+  80267f:	e8 fe f4 ff ff       	call   801b82 <fmap>
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	85 c0                	test   %eax,%eax
+  802689:	0f 8e b8 00 00 00    	jle    802747 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80268f:	39 c6                	cmp    %eax,%esi
+  802691:	0f 8d b5 00 00 00    	jge    80274c <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802697:	29 f0                	sub    %esi,%eax
+  802699:	8b 55 14             	mov    0x14(%ebp),%edx
+  80269c:	29 da                	sub    %ebx,%edx
+  80269e:	39 d0                	cmp    %edx,%eax
+  8026a0:	89 d3                	mov    %edx,%ebx
+  8026a2:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8026a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a8:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8026ad:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8026b3:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8026b9:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026bc:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026c1:	83 ec 0c             	sub    $0xc,%esp
+  8026c4:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8026c6:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8026cd:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026d0:	83 c0 01             	add    $0x1,%eax
+  8026d3:	50                   	push   %eax
+  8026d4:	68 00 10 01 e0       	push   $0xe0011000
+  8026d9:	6a 11                	push   $0x11
+  8026db:	ff 35 44 63 80 00    	push   0x806344
+  8026e1:	e8 ba 12 00 00       	call   8039a0 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8026e6:	83 c4 1c             	add    $0x1c,%esp
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	6a 00                	push   $0x0
+  8026ed:	6a 00                	push   $0x0
+  8026ef:	e8 e8 0f 00 00       	call   8036dc <ipc_recv>
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	85 c0                	test   %eax,%eax
+  8026f9:	78 5b                	js     802756 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8026fb:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8026fd:	39 c3                	cmp    %eax,%ebx
+  8026ff:	0f 8e 4c ff ff ff    	jle    802651 <nsipc_sendfile+0x28>
+  802705:	eb 45                	jmp    80274c <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802707:	83 ec 04             	sub    $0x4,%esp
+  80270a:	6a 07                	push   $0x7
+  80270c:	68 00 10 01 e0       	push   $0xe0011000
+  802711:	6a 00                	push   $0x0
+  802713:	e8 89 e7 ff ff       	call   800ea1 <sys_page_alloc>
+  802718:	89 c7                	mov    %eax,%edi
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	85 c0                	test   %eax,%eax
+  80271f:	78 2b                	js     80274c <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802721:	c7 05 48 63 80 00 01 	movl   $0x1,0x806348
+  802728:	00 00 00 
+  80272b:	e9 0f ff ff ff       	jmp    80263f <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802730:	83 ec 0c             	sub    $0xc,%esp
+  802733:	6a 03                	push   $0x3
+  802735:	e8 9b 12 00 00       	call   8039d5 <ipc_find_env>
+  80273a:	a3 44 63 80 00       	mov    %eax,0x806344
+  80273f:	83 c4 10             	add    $0x10,%esp
+  802742:	e9 05 ff ff ff       	jmp    80264c <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802747:	85 ff                	test   %edi,%edi
+  802749:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80274c:	89 f8                	mov    %edi,%eax
+  80274e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802751:	5b                   	pop    %ebx
+  802752:	5e                   	pop    %esi
+  802753:	5f                   	pop    %edi
+  802754:	5d                   	pop    %ebp
+  802755:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802756:	85 ff                	test   %edi,%edi
+  802758:	0f 44 f8             	cmove  %eax,%edi
+  80275b:	eb ef                	jmp    80274c <nsipc_sendfile+0x123>
+
+0080275d <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80275d:	55                   	push   %ebp
+  80275e:	89 e5                	mov    %esp,%ebp
+  802760:	57                   	push   %edi
+  802761:	56                   	push   %esi
+  802762:	53                   	push   %ebx
+  802763:	83 ec 1c             	sub    $0x1c,%esp
+  802766:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802769:	e8 13 f9 ff ff       	call   802081 <nsbulk_map>
+  80276e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802771:	85 c0                	test   %eax,%eax
+  802773:	0f 88 ba 00 00 00    	js     802833 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802779:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80277d:	0f 8e bb 00 00 00    	jle    80283e <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802783:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802788:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80278d:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802792:	89 f8                	mov    %edi,%eax
+  802794:	29 f0                	sub    %esi,%eax
+  802796:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80279a:	39 c8                	cmp    %ecx,%eax
+  80279c:	0f 47 c1             	cmova  %ecx,%eax
+  80279f:	01 f0                	add    %esi,%eax
+  8027a1:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8027a3:	83 c2 01             	add    $0x1,%edx
+  8027a6:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8027a9:	7e 07                	jle    8027b2 <nsipc_recvmsg+0x55>
+  8027ab:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8027b0:	7e e0                	jle    802792 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8027b2:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8027b8:	c1 fa 0c             	sar    $0xc,%edx
+  8027bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c0:	e8 0a f9 ff ff       	call   8020cf <nsbulk_own>
+  8027c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	78 67                	js     802833 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8027cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027cf:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8027d4:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8027da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027dd:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8027e2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8027e7:	89 f2                	mov    %esi,%edx
+  8027e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8027ee:	e8 44 f9 ff ff       	call   802137 <nsipc_bulk>
+  8027f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 39                	js     802833 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8027fa:	39 f0                	cmp    %esi,%eax
+  8027fc:	7f 4a                	jg     802848 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8027fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802803:	85 c0                	test   %eax,%eax
+  802805:	7e 2c                	jle    802833 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802807:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80280a:	29 fe                	sub    %edi,%esi
+  80280c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80280f:	39 c6                	cmp    %eax,%esi
+  802811:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802814:	83 ec 04             	sub    $0x4,%esp
+  802817:	56                   	push   %esi
+  802818:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80281e:	50                   	push   %eax
+  80281f:	ff 33                	push   (%ebx)
+  802821:	e8 f7 e3 ff ff       	call   800c1d <memmove>
+		n += m;
+  802826:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802828:	83 c3 08             	add    $0x8,%ebx
+  80282b:	83 c4 10             	add    $0x10,%esp
+  80282e:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802831:	7f d4                	jg     802807 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802833:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802836:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802839:	5b                   	pop    %ebx
+  80283a:	5e                   	pop    %esi
+  80283b:	5f                   	pop    %edi
+  80283c:	5d                   	pop    %ebp
+  80283d:	c3                   	ret
+	int r, i, n, len = 0;
+  80283e:	be 00 00 00 00       	mov    $0x0,%esi
+  802843:	e9 6a ff ff ff       	jmp    8027b2 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802848:	68 00 41 80 00       	push   $0x804100
+  80284d:	68 09 41 80 00       	push   $0x804109
+  802852:	68 3b 01 00 00       	push   $0x13b
+  802857:	68 1e 41 80 00       	push   $0x80411e
+  80285c:	e8 3a da ff ff       	call   80029b <_panic>
+
+00802861 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802861:	55                   	push   %ebp
+  802862:	89 e5                	mov    %esp,%ebp
+  802864:	57                   	push   %edi
+  802865:	56                   	push   %esi
+  802866:	53                   	push   %ebx
+  802867:	83 ec 0c             	sub    $0xc,%esp
+  80286a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80286d:	8b 75 10             	mov    0x10(%ebp),%esi
+  802870:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802873:	8b 45 08             	mov    0x8(%ebp),%eax
+  802876:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80287b:	8b 07                	mov    (%edi),%eax
+  80287d:	a3 04 80 80 00       	mov    %eax,0x808004
+  802882:	8b 47 04             	mov    0x4(%edi),%eax
+  802885:	a3 08 80 80 00       	mov    %eax,0x808008
+  80288a:	8b 47 08             	mov    0x8(%edi),%eax
+  80288d:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802892:	8b 47 0c             	mov    0xc(%edi),%eax
+  802895:	a3 10 80 80 00       	mov    %eax,0x808010
+  80289a:	8b 47 10             	mov    0x10(%edi),%eax
+  80289d:	a3 14 80 80 00       	mov    %eax,0x808014
+  8028a2:	8b 47 14             	mov    0x14(%edi),%eax
+  8028a5:	a3 18 80 80 00       	mov    %eax,0x808018
+  8028aa:	8b 47 18             	mov    0x18(%edi),%eax
+  8028ad:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8028b2:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8028b5:	a3 20 80 80 00       	mov    %eax,0x808020
+  8028ba:	8b 47 20             	mov    0x20(%edi),%eax
+  8028bd:	a3 24 80 80 00       	mov    %eax,0x808024
+  8028c2:	8b 47 24             	mov    0x24(%edi),%eax
+  8028c5:	a3 28 80 80 00       	mov    %eax,0x808028
+  8028ca:	8b 47 28             	mov    0x28(%edi),%eax
+  8028cd:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8028d2:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8028d5:	a3 30 80 80 00       	mov    %eax,0x808030
+  8028da:	8b 47 30             	mov    0x30(%edi),%eax
+  8028dd:	a3 34 80 80 00       	mov    %eax,0x808034
+  8028e2:	8b 47 34             	mov    0x34(%edi),%eax
+  8028e5:	a3 38 80 80 00       	mov    %eax,0x808038
+  8028ea:	8b 47 38             	mov    0x38(%edi),%eax
+  8028ed:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8028f2:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8028f5:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8028fa:	8b 06                	mov    (%esi),%eax
+  8028fc:	a3 44 80 80 00       	mov    %eax,0x808044
+  802901:	8b 46 04             	mov    0x4(%esi),%eax
+  802904:	a3 48 80 80 00       	mov    %eax,0x808048
+  802909:	8b 46 08             	mov    0x8(%esi),%eax
+  80290c:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802911:	8b 46 0c             	mov    0xc(%esi),%eax
+  802914:	a3 50 80 80 00       	mov    %eax,0x808050
+  802919:	8b 46 10             	mov    0x10(%esi),%eax
+  80291c:	a3 54 80 80 00       	mov    %eax,0x808054
+  802921:	8b 46 14             	mov    0x14(%esi),%eax
+  802924:	a3 58 80 80 00       	mov    %eax,0x808058
+  802929:	8b 46 18             	mov    0x18(%esi),%eax
+  80292c:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802931:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802934:	a3 60 80 80 00       	mov    %eax,0x808060
+  802939:	8b 46 20             	mov    0x20(%esi),%eax
+  80293c:	a3 64 80 80 00       	mov    %eax,0x808064
+  802941:	8b 46 24             	mov    0x24(%esi),%eax
+  802944:	a3 68 80 80 00       	mov    %eax,0x808068
+  802949:	8b 46 28             	mov    0x28(%esi),%eax
+  80294c:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802951:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802954:	a3 70 80 80 00       	mov    %eax,0x808070
+  802959:	8b 46 30             	mov    0x30(%esi),%eax
+  80295c:	a3 74 80 80 00       	mov    %eax,0x808074
+  802961:	8b 46 34             	mov    0x34(%esi),%eax
+  802964:	a3 78 80 80 00       	mov    %eax,0x808078
+  802969:	8b 46 38             	mov    0x38(%esi),%eax
+  80296c:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802971:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802974:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802979:	8b 03                	mov    (%ebx),%eax
+  80297b:	a3 84 80 80 00       	mov    %eax,0x808084
+  802980:	8b 43 04             	mov    0x4(%ebx),%eax
+  802983:	a3 88 80 80 00       	mov    %eax,0x808088
+  802988:	8b 43 08             	mov    0x8(%ebx),%eax
+  80298b:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802990:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802993:	a3 90 80 80 00       	mov    %eax,0x808090
+  802998:	8b 43 10             	mov    0x10(%ebx),%eax
+  80299b:	a3 94 80 80 00       	mov    %eax,0x808094
+  8029a0:	8b 43 14             	mov    0x14(%ebx),%eax
+  8029a3:	a3 98 80 80 00       	mov    %eax,0x808098
+  8029a8:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029ab:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8029b0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8029b3:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8029b8:	8b 43 20             	mov    0x20(%ebx),%eax
+  8029bb:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8029c0:	8b 43 24             	mov    0x24(%ebx),%eax
+  8029c3:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8029c8:	8b 43 28             	mov    0x28(%ebx),%eax
+  8029cb:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8029d0:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8029d3:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8029d8:	8b 43 30             	mov    0x30(%ebx),%eax
+  8029db:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8029e0:	8b 43 34             	mov    0x34(%ebx),%eax
+  8029e3:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8029e8:	8b 43 38             	mov    0x38(%ebx),%eax
+  8029eb:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8029f0:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8029f3:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8029f8:	8b 45 18             	mov    0x18(%ebp),%eax
+  8029fb:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802a00:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802a05:	e8 2b f6 ff ff       	call   802035 <nsipc>
+  802a0a:	85 c0                	test   %eax,%eax
+  802a0c:	0f 88 ad 01 00 00    	js     802bbf <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802a12:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802a18:	89 17                	mov    %edx,(%edi)
+  802a1a:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802a20:	89 57 04             	mov    %edx,0x4(%edi)
+  802a23:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802a29:	89 57 08             	mov    %edx,0x8(%edi)
+  802a2c:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a32:	89 57 0c             	mov    %edx,0xc(%edi)
+  802a35:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802a3b:	89 57 10             	mov    %edx,0x10(%edi)
+  802a3e:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802a44:	89 57 14             	mov    %edx,0x14(%edi)
+  802a47:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802a4d:	89 57 18             	mov    %edx,0x18(%edi)
+  802a50:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802a56:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802a59:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802a5f:	89 57 20             	mov    %edx,0x20(%edi)
+  802a62:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802a68:	89 57 24             	mov    %edx,0x24(%edi)
+  802a6b:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802a71:	89 57 28             	mov    %edx,0x28(%edi)
+  802a74:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802a7a:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802a7d:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802a83:	89 57 30             	mov    %edx,0x30(%edi)
+  802a86:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802a8c:	89 57 34             	mov    %edx,0x34(%edi)
+  802a8f:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802a95:	89 57 38             	mov    %edx,0x38(%edi)
+  802a98:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802a9e:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802aa1:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802aa7:	89 16                	mov    %edx,(%esi)
+  802aa9:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802aaf:	89 56 04             	mov    %edx,0x4(%esi)
+  802ab2:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802ab8:	89 56 08             	mov    %edx,0x8(%esi)
+  802abb:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802ac1:	89 56 0c             	mov    %edx,0xc(%esi)
+  802ac4:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802aca:	89 56 10             	mov    %edx,0x10(%esi)
+  802acd:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802ad3:	89 56 14             	mov    %edx,0x14(%esi)
+  802ad6:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802adc:	89 56 18             	mov    %edx,0x18(%esi)
+  802adf:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802ae5:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802ae8:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802aee:	89 56 20             	mov    %edx,0x20(%esi)
+  802af1:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802af7:	89 56 24             	mov    %edx,0x24(%esi)
+  802afa:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802b00:	89 56 28             	mov    %edx,0x28(%esi)
+  802b03:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802b09:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802b0c:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802b12:	89 56 30             	mov    %edx,0x30(%esi)
+  802b15:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802b1b:	89 56 34             	mov    %edx,0x34(%esi)
+  802b1e:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802b24:	89 56 38             	mov    %edx,0x38(%esi)
+  802b27:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802b2d:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802b30:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802b36:	89 13                	mov    %edx,(%ebx)
+  802b38:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802b3e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b41:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802b47:	89 53 08             	mov    %edx,0x8(%ebx)
+  802b4a:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802b50:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802b53:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802b59:	89 53 10             	mov    %edx,0x10(%ebx)
+  802b5c:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802b62:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b65:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802b6b:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b6e:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802b74:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b77:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802b7d:	89 53 20             	mov    %edx,0x20(%ebx)
+  802b80:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802b86:	89 53 24             	mov    %edx,0x24(%ebx)
+  802b89:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802b8f:	89 53 28             	mov    %edx,0x28(%ebx)
+  802b92:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802b98:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802b9b:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802ba1:	89 53 30             	mov    %edx,0x30(%ebx)
+  802ba4:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802baa:	89 53 34             	mov    %edx,0x34(%ebx)
+  802bad:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802bb3:	89 53 38             	mov    %edx,0x38(%ebx)
+  802bb6:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802bbc:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802bbf:	83 c4 0c             	add    $0xc,%esp
+  802bc2:	5b                   	pop    %ebx
+  802bc3:	5e                   	pop    %esi
+  802bc4:	5f                   	pop    %edi
+  802bc5:	5d                   	pop    %ebp
+  802bc6:	c3                   	ret
+
+00802bc7 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802bc7:	55                   	push   %ebp
+  802bc8:	89 e5                	mov    %esp,%ebp
+  802bca:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802bd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bd8:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802bdd:	8b 45 10             	mov    0x10(%ebp),%eax
+  802be0:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802be5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802bea:	e8 46 f4 ff ff       	call   802035 <nsipc>
+}
+  802bef:	c9                   	leave
+  802bf0:	c3                   	ret
+
+00802bf1 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	56                   	push   %esi
+  802bf5:	53                   	push   %ebx
+  802bf6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802bf9:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802bff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c02:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802c07:	b8 10 00 00 00       	mov    $0x10,%eax
+  802c0c:	e8 24 f4 ff ff       	call   802035 <nsipc>
+  802c11:	89 c3                	mov    %eax,%ebx
+  802c13:	85 c0                	test   %eax,%eax
+  802c15:	7e 1f                	jle    802c36 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802c17:	39 c6                	cmp    %eax,%esi
+  802c19:	7c 24                	jl     802c3f <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802c1b:	83 ec 04             	sub    $0x4,%esp
+  802c1e:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802c25:	50                   	push   %eax
+  802c26:	68 00 80 80 00       	push   $0x808000
+  802c2b:	ff 75 08             	push   0x8(%ebp)
+  802c2e:	e8 ea df ff ff       	call   800c1d <memmove>
+  802c33:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802c36:	89 d8                	mov    %ebx,%eax
+  802c38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c3b:	5b                   	pop    %ebx
+  802c3c:	5e                   	pop    %esi
+  802c3d:	5d                   	pop    %ebp
+  802c3e:	c3                   	ret
+		assert(r <= max);
+  802c3f:	68 36 41 80 00       	push   $0x804136
+  802c44:	68 09 41 80 00       	push   $0x804109
+  802c49:	68 6a 01 00 00       	push   $0x16a
+  802c4e:	68 1e 41 80 00       	push   $0x80411e
+  802c53:	e8 43 d6 ff ff       	call   80029b <_panic>
+
+00802c58 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c58:	55                   	push   %ebp
+  802c59:	89 e5                	mov    %esp,%ebp
+  802c5b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c61:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802c66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c69:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c6e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c71:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802c76:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c7b:	e8 b5 f3 ff ff       	call   802035 <nsipc>
+}
+  802c80:	c9                   	leave
+  802c81:	c3                   	ret
+
+00802c82 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802c82:	55                   	push   %ebp
+  802c83:	89 e5                	mov    %esp,%ebp
+  802c85:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802c88:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c8b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802c90:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c95:	e8 9b f3 ff ff       	call   802035 <nsipc>
+}
+  802c9a:	c9                   	leave
+  802c9b:	c3                   	ret
+
+00802c9c <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802c9c:	55                   	push   %ebp
+  802c9d:	89 e5                	mov    %esp,%ebp
+  802c9f:	53                   	push   %ebx
+  802ca0:	83 ec 04             	sub    $0x4,%esp
+  802ca3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802ca6:	b8 12 00 00 00       	mov    $0x12,%eax
+  802cab:	e8 85 f3 ff ff       	call   802035 <nsipc>
+  802cb0:	85 c0                	test   %eax,%eax
+  802cb2:	78 50                	js     802d04 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802cb4:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802cba:	89 13                	mov    %edx,(%ebx)
+  802cbc:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802cc2:	89 53 04             	mov    %edx,0x4(%ebx)
+  802cc5:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802ccb:	89 53 08             	mov    %edx,0x8(%ebx)
+  802cce:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802cd4:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802cd7:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802cdd:	89 53 10             	mov    %edx,0x10(%ebx)
+  802ce0:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802ce6:	89 53 14             	mov    %edx,0x14(%ebx)
+  802ce9:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802cef:	89 53 18             	mov    %edx,0x18(%ebx)
+  802cf2:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802cf8:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802cfb:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802d01:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+
+00802d09 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802d09:	55                   	push   %ebp
+  802d0a:	89 e5                	mov    %esp,%ebp
+  802d0c:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d0f:	6a 03                	push   $0x3
+  802d11:	e8 bf 0c 00 00       	call   8039d5 <ipc_find_env>
+  802d16:	a3 44 63 80 00       	mov    %eax,0x806344
+	nsipcbuf.shard.req_shard = shard;
+  802d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1e:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802d23:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802d28:	e8 08 f3 ff ff       	call   802035 <nsipc>
+  802d2d:	83 c4 10             	add    $0x10,%esp
+  802d30:	85 c0                	test   %eax,%eax
+  802d32:	78 0a                	js     802d3e <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802d34:	a3 44 63 80 00       	mov    %eax,0x806344
+	return 0;
+  802d39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d3e:	c9                   	leave
+  802d3f:	c3                   	ret
+
+00802d40 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802d40:	55                   	push   %ebp
+  802d41:	89 e5                	mov    %esp,%ebp
+  802d43:	57                   	push   %edi
+  802d44:	56                   	push   %esi
+  802d45:	53                   	push   %ebx
+  802d46:	83 ec 1c             	sub    $0x1c,%esp
+  802d49:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802d4c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802d4f:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802d54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d59:	89 e0                	mov    %esp,%eax
+  802d5b:	89 f2                	mov    %esi,%edx
+  802d5d:	29 c2                	sub    %eax,%edx
+  802d5f:	89 d0                	mov    %edx,%eax
+  802d61:	c1 e8 0f             	shr    $0xf,%eax
+  802d64:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802d6a:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802d6d:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  802d74:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802d77:	83 ec 0c             	sub    $0xc,%esp
+  802d7a:	ff 75 e0             	push   -0x20(%ebp)
+  802d7d:	e8 92 0c 00 00       	call   803a14 <pageref>
+  802d82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d85:	83 c4 04             	add    $0x4,%esp
+  802d88:	ff 75 dc             	push   -0x24(%ebp)
+  802d8b:	e8 84 0c 00 00       	call   803a14 <pageref>
+  802d90:	89 e2                	mov    %esp,%edx
+  802d92:	89 f1                	mov    %esi,%ecx
+  802d94:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802d96:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802d99:	89 ca                	mov    %ecx,%edx
+  802d9b:	c1 ea 0f             	shr    $0xf,%edx
+  802d9e:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802da4:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802da7:	8b 14 95 60 63 80 00 	mov    0x806360(,%edx,4),%edx
+  802dae:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802db1:	39 d7                	cmp    %edx,%edi
+  802db3:	74 40                	je     802df5 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802db5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802db8:	75 9f                	jne    802d59 <_pipeisclosed+0x19>
+  802dba:	89 e2                	mov    %esp,%edx
+  802dbc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802dc1:	29 d0                	sub    %edx,%eax
+  802dc3:	89 c2                	mov    %eax,%edx
+  802dc5:	c1 ea 0f             	shr    $0xf,%edx
+  802dc8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd2:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802dd5:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  802ddc:	8b 40 58             	mov    0x58(%eax),%eax
+  802ddf:	6a 01                	push   $0x1
+  802de1:	50                   	push   %eax
+  802de2:	57                   	push   %edi
+  802de3:	68 3f 41 80 00       	push   $0x80413f
+  802de8:	e8 89 d5 ff ff       	call   800376 <cprintf>
+  802ded:	83 c4 10             	add    $0x10,%esp
+  802df0:	e9 5f ff ff ff       	jmp    802d54 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802df5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802df8:	0f 94 c0             	sete   %al
+  802dfb:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802dfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e01:	5b                   	pop    %ebx
+  802e02:	5e                   	pop    %esi
+  802e03:	5f                   	pop    %edi
+  802e04:	5d                   	pop    %ebp
+  802e05:	c3                   	ret
+
+00802e06 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e06:	55                   	push   %ebp
+  802e07:	89 e5                	mov    %esp,%ebp
+  802e09:	53                   	push   %ebx
+  802e0a:	83 ec 0c             	sub    $0xc,%esp
+  802e0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e10:	53                   	push   %ebx
+  802e11:	6a 00                	push   $0x0
+  802e13:	e8 0e e1 ff ff       	call   800f26 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e18:	89 1c 24             	mov    %ebx,(%esp)
+  802e1b:	e8 f4 e4 ff ff       	call   801314 <fd2data>
+  802e20:	83 c4 08             	add    $0x8,%esp
+  802e23:	50                   	push   %eax
+  802e24:	6a 00                	push   $0x0
+  802e26:	e8 fb e0 ff ff       	call   800f26 <sys_page_unmap>
+}
+  802e2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e2e:	c9                   	leave
+  802e2f:	c3                   	ret
+
+00802e30 <devpipe_read>:
+{
+  802e30:	55                   	push   %ebp
+  802e31:	89 e5                	mov    %esp,%ebp
+  802e33:	57                   	push   %edi
+  802e34:	56                   	push   %esi
+  802e35:	53                   	push   %ebx
+  802e36:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802e39:	ff 75 08             	push   0x8(%ebp)
+  802e3c:	e8 d3 e4 ff ff       	call   801314 <fd2data>
+  802e41:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e43:	8b 70 04             	mov    0x4(%eax),%esi
+  802e46:	8b 00                	mov    (%eax),%eax
+  802e48:	83 c4 10             	add    $0x10,%esp
+  802e4b:	39 f0                	cmp    %esi,%eax
+  802e4d:	75 36                	jne    802e85 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802e4f:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802e52:	89 da                	mov    %ebx,%edx
+  802e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e57:	e8 e4 fe ff ff       	call   802d40 <_pipeisclosed>
+  802e5c:	85 c0                	test   %eax,%eax
+  802e5e:	0f 85 d4 00 00 00    	jne    802f38 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802e64:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e69:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802e6d:	83 ec 04             	sub    $0x4,%esp
+  802e70:	6a ff                	push   $0xffffffff
+  802e72:	56                   	push   %esi
+  802e73:	57                   	push   %edi
+  802e74:	e8 26 e4 ff ff       	call   80129f <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e79:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e7c:	8b 03                	mov    (%ebx),%eax
+  802e7e:	83 c4 10             	add    $0x10,%esp
+  802e81:	39 c6                	cmp    %eax,%esi
+  802e83:	74 cd                	je     802e52 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e85:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e88:	8b 03                	mov    (%ebx),%eax
+  802e8a:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802e90:	29 c6                	sub    %eax,%esi
+  802e92:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e97:	f7 e6                	mul    %esi
+  802e99:	c1 ea 0c             	shr    $0xc,%edx
+  802e9c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ea2:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802ea4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ea7:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802eab:	8b 0b                	mov    (%ebx),%ecx
+  802ead:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802eb2:	f7 e1                	mul    %ecx
+  802eb4:	c1 ea 0b             	shr    $0xb,%edx
+  802eb7:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802ebd:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802ebf:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802ec4:	29 cf                	sub    %ecx,%edi
+  802ec6:	39 f7                	cmp    %esi,%edi
+  802ec8:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802ecb:	83 ec 04             	sub    $0x4,%esp
+  802ece:	57                   	push   %edi
+  802ecf:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802ed3:	50                   	push   %eax
+  802ed4:	ff 75 0c             	push   0xc(%ebp)
+  802ed7:	e8 41 dd ff ff       	call   800c1d <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802edc:	83 c4 0c             	add    $0xc,%esp
+  802edf:	89 f0                	mov    %esi,%eax
+  802ee1:	29 f8                	sub    %edi,%eax
+  802ee3:	50                   	push   %eax
+  802ee4:	8d 43 10             	lea    0x10(%ebx),%eax
+  802ee7:	50                   	push   %eax
+  802ee8:	89 f8                	mov    %edi,%eax
+  802eea:	03 45 0c             	add    0xc(%ebp),%eax
+  802eed:	50                   	push   %eax
+  802eee:	e8 2a dd ff ff       	call   800c1d <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802ef3:	8b 0b                	mov    (%ebx),%ecx
+  802ef5:	01 f1                	add    %esi,%ecx
+  802ef7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802efc:	f7 e1                	mul    %ecx
+  802efe:	c1 ea 0c             	shr    $0xc,%edx
+  802f01:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f07:	29 c1                	sub    %eax,%ecx
+  802f09:	89 0b                	mov    %ecx,(%ebx)
+  802f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f10:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802f14:	83 c4 10             	add    $0x10,%esp
+  802f17:	85 c0                	test   %eax,%eax
+  802f19:	75 0a                	jne    802f25 <devpipe_read+0xf5>
+	return n;
+  802f1b:	89 f0                	mov    %esi,%eax
+}
+  802f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f20:	5b                   	pop    %ebx
+  802f21:	5e                   	pop    %esi
+  802f22:	5f                   	pop    %edi
+  802f23:	5d                   	pop    %ebp
+  802f24:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802f25:	83 ec 08             	sub    $0x8,%esp
+  802f28:	68 00 04 00 00       	push   $0x400
+  802f2d:	53                   	push   %ebx
+  802f2e:	e8 8e e3 ff ff       	call   8012c1 <sys_futex_wake>
+  802f33:	83 c4 10             	add    $0x10,%esp
+  802f36:	eb e3                	jmp    802f1b <devpipe_read+0xeb>
+			return 0;
+  802f38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3d:	eb de                	jmp    802f1d <devpipe_read+0xed>
+
+00802f3f <devpipe_write>:
+{
+  802f3f:	55                   	push   %ebp
+  802f40:	89 e5                	mov    %esp,%ebp
+  802f42:	57                   	push   %edi
+  802f43:	56                   	push   %esi
+  802f44:	53                   	push   %ebx
+  802f45:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f48:	ff 75 08             	push   0x8(%ebp)
+  802f4b:	e8 c4 e3 ff ff       	call   801314 <fd2data>
+  802f50:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802f52:	83 c4 10             	add    $0x10,%esp
+  802f55:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f5c:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802f61:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f65:	0f 84 43 01 00 00    	je     8030ae <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f6b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f6e:	8b 06                	mov    (%esi),%eax
+  802f70:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f76:	29 c1                	sub    %eax,%ecx
+  802f78:	89 c8                	mov    %ecx,%eax
+  802f7a:	f7 e7                	mul    %edi
+  802f7c:	c1 ea 0c             	shr    $0xc,%edx
+  802f7f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f85:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802f87:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802f8d:	75 52                	jne    802fe1 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802f8f:	89 f2                	mov    %esi,%edx
+  802f91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f94:	e8 a7 fd ff ff       	call   802d40 <_pipeisclosed>
+  802f99:	85 c0                	test   %eax,%eax
+  802f9b:	0f 85 28 01 00 00    	jne    8030c9 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802fa1:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fa3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fa6:	8b 06                	mov    (%esi),%eax
+  802fa8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fae:	29 c1                	sub    %eax,%ecx
+  802fb0:	89 c8                	mov    %ecx,%eax
+  802fb2:	f7 e7                	mul    %edi
+  802fb4:	c1 ea 0c             	shr    $0xc,%edx
+  802fb7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fbd:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802fbf:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802fc5:	75 a4                	jne    802f6b <devpipe_write+0x2c>
+  802fc7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fcc:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802fd0:	83 ec 04             	sub    $0x4,%esp
+  802fd3:	6a ff                	push   $0xffffffff
+  802fd5:	53                   	push   %ebx
+  802fd6:	56                   	push   %esi
+  802fd7:	e8 c3 e2 ff ff       	call   80129f <sys_futex_wait>
+}
+  802fdc:	83 c4 10             	add    $0x10,%esp
+  802fdf:	eb 8a                	jmp    802f6b <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fe1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fe4:	8b 06                	mov    (%esi),%eax
+  802fe6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fec:	29 c1                	sub    %eax,%ecx
+  802fee:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ff3:	f7 e1                	mul    %ecx
+  802ff5:	c1 ea 0c             	shr    $0xc,%edx
+  802ff8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ffe:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803000:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803005:	89 d8                	mov    %ebx,%eax
+  803007:	29 c8                	sub    %ecx,%eax
+  803009:	8b 55 10             	mov    0x10(%ebp),%edx
+  80300c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80300f:	29 ca                	sub    %ecx,%edx
+  803011:	39 d0                	cmp    %edx,%eax
+  803013:	0f 46 d0             	cmovbe %eax,%edx
+  803016:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803019:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80301c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803021:	f7 e1                	mul    %ecx
+  803023:	c1 ea 0b             	shr    $0xb,%edx
+  803026:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80302c:	89 ca                	mov    %ecx,%edx
+  80302e:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803030:	29 d3                	sub    %edx,%ebx
+  803032:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803035:	39 c3                	cmp    %eax,%ebx
+  803037:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80303a:	83 ec 04             	sub    $0x4,%esp
+  80303d:	53                   	push   %ebx
+  80303e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803041:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803044:	51                   	push   %ecx
+  803045:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803049:	50                   	push   %eax
+  80304a:	e8 ce db ff ff       	call   800c1d <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80304f:	83 c4 0c             	add    $0xc,%esp
+  803052:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803055:	29 d8                	sub    %ebx,%eax
+  803057:	50                   	push   %eax
+  803058:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80305b:	01 cb                	add    %ecx,%ebx
+  80305d:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803060:	53                   	push   %ebx
+  803061:	8d 46 10             	lea    0x10(%esi),%eax
+  803064:	50                   	push   %eax
+  803065:	e8 b3 db ff ff       	call   800c1d <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80306a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80306d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803070:	01 c1                	add    %eax,%ecx
+  803072:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803077:	f7 e1                	mul    %ecx
+  803079:	c1 ea 0c             	shr    $0xc,%edx
+  80307c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803082:	89 ca                	mov    %ecx,%edx
+  803084:	29 c2                	sub    %eax,%edx
+  803086:	89 56 04             	mov    %edx,0x4(%esi)
+  803089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308e:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803092:	83 c4 10             	add    $0x10,%esp
+  803095:	85 c0                	test   %eax,%eax
+  803097:	75 1a                	jne    8030b3 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803099:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80309c:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80309f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030a2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8030a5:	0f 82 c0 fe ff ff    	jb     802f6b <devpipe_write+0x2c>
+  8030ab:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8030ae:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030b1:	eb 1b                	jmp    8030ce <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8030b3:	83 ec 08             	sub    $0x8,%esp
+  8030b6:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8030bb:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8030be:	50                   	push   %eax
+  8030bf:	e8 fd e1 ff ff       	call   8012c1 <sys_futex_wake>
+  8030c4:	83 c4 10             	add    $0x10,%esp
+  8030c7:	eb d0                	jmp    803099 <devpipe_write+0x15a>
+				return 0;
+  8030c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030d1:	5b                   	pop    %ebx
+  8030d2:	5e                   	pop    %esi
+  8030d3:	5f                   	pop    %edi
+  8030d4:	5d                   	pop    %ebp
+  8030d5:	c3                   	ret
+
+008030d6 <devpipe_stat>:
+{
+  8030d6:	55                   	push   %ebp
+  8030d7:	89 e5                	mov    %esp,%ebp
+  8030d9:	56                   	push   %esi
+  8030da:	53                   	push   %ebx
+  8030db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8030de:	83 ec 0c             	sub    $0xc,%esp
+  8030e1:	ff 75 08             	push   0x8(%ebp)
+  8030e4:	e8 2b e2 ff ff       	call   801314 <fd2data>
+  8030e9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8030eb:	83 c4 08             	add    $0x8,%esp
+  8030ee:	68 52 41 80 00       	push   $0x804152
+  8030f3:	53                   	push   %ebx
+  8030f4:	e8 74 d9 ff ff       	call   800a6d <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030f9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030fc:	8b 06                	mov    (%esi),%eax
+  8030fe:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803104:	29 c1                	sub    %eax,%ecx
+  803106:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80310b:	89 c8                	mov    %ecx,%eax
+  80310d:	f7 e2                	mul    %edx
+  80310f:	c1 ea 0c             	shr    $0xc,%edx
+  803112:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803118:	29 d1                	sub    %edx,%ecx
+  80311a:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803120:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803127:	00 00 00 
+	stat->st_dev = &devpipe;
+  80312a:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803131:	50 80 00 
+}
+  803134:	b8 00 00 00 00       	mov    $0x0,%eax
+  803139:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80313c:	5b                   	pop    %ebx
+  80313d:	5e                   	pop    %esi
+  80313e:	5d                   	pop    %ebp
+  80313f:	c3                   	ret
+
+00803140 <devpipe_poll>:
+{
+  803140:	55                   	push   %ebp
+  803141:	89 e5                	mov    %esp,%ebp
+  803143:	57                   	push   %edi
+  803144:	56                   	push   %esi
+  803145:	53                   	push   %ebx
+  803146:	83 ec 18             	sub    $0x18,%esp
+  803149:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80314c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80314f:	57                   	push   %edi
+  803150:	e8 bf e1 ff ff       	call   801314 <fd2data>
+  803155:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803157:	83 c4 10             	add    $0x10,%esp
+  80315a:	89 f3                	mov    %esi,%ebx
+  80315c:	83 e3 01             	and    $0x1,%ebx
+  80315f:	75 27                	jne    803188 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803161:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803167:	75 48                	jne    8031b1 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803169:	89 ca                	mov    %ecx,%edx
+  80316b:	89 f8                	mov    %edi,%eax
+  80316d:	e8 ce fb ff ff       	call   802d40 <_pipeisclosed>
+  803172:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803174:	89 d8                	mov    %ebx,%eax
+  803176:	83 c8 10             	or     $0x10,%eax
+  803179:	85 d2                	test   %edx,%edx
+  80317b:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80317e:	89 d8                	mov    %ebx,%eax
+  803180:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803183:	5b                   	pop    %ebx
+  803184:	5e                   	pop    %esi
+  803185:	5f                   	pop    %edi
+  803186:	5d                   	pop    %ebp
+  803187:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803188:	8b 58 04             	mov    0x4(%eax),%ebx
+  80318b:	8b 00                	mov    (%eax),%eax
+  80318d:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803193:	29 c3                	sub    %eax,%ebx
+  803195:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80319a:	89 d8                	mov    %ebx,%eax
+  80319c:	f7 e2                	mul    %edx
+  80319e:	c1 ea 0c             	shr    $0xc,%edx
+  8031a1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8031a7:	39 d3                	cmp    %edx,%ebx
+  8031a9:	0f 95 c3             	setne  %bl
+  8031ac:	0f b6 db             	movzbl %bl,%ebx
+  8031af:	eb b0                	jmp    803161 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031b1:	8b 71 04             	mov    0x4(%ecx),%esi
+  8031b4:	8b 01                	mov    (%ecx),%eax
+  8031b6:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8031bc:	29 c6                	sub    %eax,%esi
+  8031be:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031c3:	89 f0                	mov    %esi,%eax
+  8031c5:	f7 e2                	mul    %edx
+  8031c7:	c1 ea 0c             	shr    $0xc,%edx
+  8031ca:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031d0:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8031d2:	89 d8                	mov    %ebx,%eax
+  8031d4:	83 c8 04             	or     $0x4,%eax
+  8031d7:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8031dd:	0f 42 d8             	cmovb  %eax,%ebx
+  8031e0:	eb 87                	jmp    803169 <devpipe_poll+0x29>
+
+008031e2 <pipe>:
+{
+  8031e2:	55                   	push   %ebp
+  8031e3:	89 e5                	mov    %esp,%ebp
+  8031e5:	56                   	push   %esi
+  8031e6:	53                   	push   %ebx
+  8031e7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031ed:	50                   	push   %eax
+  8031ee:	e8 38 e1 ff ff       	call   80132b <fd_alloc>
+  8031f3:	89 c3                	mov    %eax,%ebx
+  8031f5:	83 c4 10             	add    $0x10,%esp
+  8031f8:	85 c0                	test   %eax,%eax
+  8031fa:	0f 88 23 01 00 00    	js     803323 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803200:	83 ec 04             	sub    $0x4,%esp
+  803203:	68 07 04 00 00       	push   $0x407
+  803208:	ff 75 f4             	push   -0xc(%ebp)
+  80320b:	6a 00                	push   $0x0
+  80320d:	e8 8f dc ff ff       	call   800ea1 <sys_page_alloc>
+  803212:	89 c3                	mov    %eax,%ebx
+  803214:	83 c4 10             	add    $0x10,%esp
+  803217:	85 c0                	test   %eax,%eax
+  803219:	0f 88 04 01 00 00    	js     803323 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80321f:	83 ec 0c             	sub    $0xc,%esp
+  803222:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803225:	50                   	push   %eax
+  803226:	e8 00 e1 ff ff       	call   80132b <fd_alloc>
+  80322b:	89 c3                	mov    %eax,%ebx
+  80322d:	83 c4 10             	add    $0x10,%esp
+  803230:	85 c0                	test   %eax,%eax
+  803232:	0f 88 db 00 00 00    	js     803313 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803238:	83 ec 04             	sub    $0x4,%esp
+  80323b:	68 07 04 00 00       	push   $0x407
+  803240:	ff 75 f0             	push   -0x10(%ebp)
+  803243:	6a 00                	push   $0x0
+  803245:	e8 57 dc ff ff       	call   800ea1 <sys_page_alloc>
+  80324a:	89 c3                	mov    %eax,%ebx
+  80324c:	83 c4 10             	add    $0x10,%esp
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	0f 88 bc 00 00 00    	js     803313 <pipe+0x131>
+	va = fd2data(fd0);
+  803257:	83 ec 0c             	sub    $0xc,%esp
+  80325a:	ff 75 f4             	push   -0xc(%ebp)
+  80325d:	e8 b2 e0 ff ff       	call   801314 <fd2data>
+  803262:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803264:	83 c4 0c             	add    $0xc,%esp
+  803267:	68 07 04 00 00       	push   $0x407
+  80326c:	50                   	push   %eax
+  80326d:	6a 00                	push   $0x0
+  80326f:	e8 2d dc ff ff       	call   800ea1 <sys_page_alloc>
+  803274:	89 c3                	mov    %eax,%ebx
+  803276:	83 c4 10             	add    $0x10,%esp
+  803279:	85 c0                	test   %eax,%eax
+  80327b:	0f 88 82 00 00 00    	js     803303 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803281:	83 ec 0c             	sub    $0xc,%esp
+  803284:	ff 75 f0             	push   -0x10(%ebp)
+  803287:	e8 88 e0 ff ff       	call   801314 <fd2data>
+  80328c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803293:	50                   	push   %eax
+  803294:	6a 00                	push   $0x0
+  803296:	56                   	push   %esi
+  803297:	6a 00                	push   $0x0
+  803299:	e8 46 dc ff ff       	call   800ee4 <sys_page_map>
+  80329e:	89 c3                	mov    %eax,%ebx
+  8032a0:	83 c4 20             	add    $0x20,%esp
+  8032a3:	85 c0                	test   %eax,%eax
+  8032a5:	78 4e                	js     8032f5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032a7:	a1 60 50 80 00       	mov    0x805060,%eax
+  8032ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032af:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032b1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032b4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032bb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032be:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8032c0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032c3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032ca:	83 ec 0c             	sub    $0xc,%esp
+  8032cd:	ff 75 f4             	push   -0xc(%ebp)
+  8032d0:	e8 2f e0 ff ff       	call   801304 <fd2num>
+  8032d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032d8:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032da:	83 c4 04             	add    $0x4,%esp
+  8032dd:	ff 75 f0             	push   -0x10(%ebp)
+  8032e0:	e8 1f e0 ff ff       	call   801304 <fd2num>
+  8032e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032e8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032eb:	83 c4 10             	add    $0x10,%esp
+  8032ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032f3:	eb 2e                	jmp    803323 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032f5:	83 ec 08             	sub    $0x8,%esp
+  8032f8:	56                   	push   %esi
+  8032f9:	6a 00                	push   $0x0
+  8032fb:	e8 26 dc ff ff       	call   800f26 <sys_page_unmap>
+  803300:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803303:	83 ec 08             	sub    $0x8,%esp
+  803306:	ff 75 f0             	push   -0x10(%ebp)
+  803309:	6a 00                	push   $0x0
+  80330b:	e8 16 dc ff ff       	call   800f26 <sys_page_unmap>
+  803310:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803313:	83 ec 08             	sub    $0x8,%esp
+  803316:	ff 75 f4             	push   -0xc(%ebp)
+  803319:	6a 00                	push   $0x0
+  80331b:	e8 06 dc ff ff       	call   800f26 <sys_page_unmap>
+  803320:	83 c4 10             	add    $0x10,%esp
+}
+  803323:	89 d8                	mov    %ebx,%eax
+  803325:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803328:	5b                   	pop    %ebx
+  803329:	5e                   	pop    %esi
+  80332a:	5d                   	pop    %ebp
+  80332b:	c3                   	ret
+
+0080332c <pipeisclosed>:
+{
+  80332c:	55                   	push   %ebp
+  80332d:	89 e5                	mov    %esp,%ebp
+  80332f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803332:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803335:	50                   	push   %eax
+  803336:	ff 75 08             	push   0x8(%ebp)
+  803339:	e8 3d e0 ff ff       	call   80137b <fd_lookup>
+  80333e:	83 c4 10             	add    $0x10,%esp
+  803341:	85 c0                	test   %eax,%eax
+  803343:	78 18                	js     80335d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803345:	83 ec 0c             	sub    $0xc,%esp
+  803348:	ff 75 f4             	push   -0xc(%ebp)
+  80334b:	e8 c4 df ff ff       	call   801314 <fd2data>
+  803350:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803352:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803355:	e8 e6 f9 ff ff       	call   802d40 <_pipeisclosed>
+  80335a:	83 c4 10             	add    $0x10,%esp
+}
+  80335d:	c9                   	leave
+  80335e:	c3                   	ret
+
+0080335f <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80335f:	55                   	push   %ebp
+  803360:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803362:	8b 45 08             	mov    0x8(%ebp),%eax
+  803365:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80336b:	5d                   	pop    %ebp
+  80336c:	c3                   	ret
+
+0080336d <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80336d:	55                   	push   %ebp
+  80336e:	89 e5                	mov    %esp,%ebp
+  803370:	53                   	push   %ebx
+  803371:	83 ec 04             	sub    $0x4,%esp
+  803374:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803377:	8b 03                	mov    (%ebx),%eax
+  803379:	85 c0                	test   %eax,%eax
+  80337b:	75 05                	jne    803382 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80337d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803380:	c9                   	leave
+  803381:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803382:	83 ec 08             	sub    $0x8,%esp
+  803385:	50                   	push   %eax
+  803386:	8d 43 04             	lea    0x4(%ebx),%eax
+  803389:	50                   	push   %eax
+  80338a:	e8 e7 dd ff ff       	call   801176 <sys_page_batch>
+	pb->pb_n = 0;
+  80338f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803395:	83 c4 10             	add    $0x10,%esp
+  803398:	eb e3                	jmp    80337d <pgbatch_flush+0x10>
+
+0080339a <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80339a:	55                   	push   %ebp
+  80339b:	89 e5                	mov    %esp,%ebp
+  80339d:	56                   	push   %esi
+  80339e:	53                   	push   %ebx
+  80339f:	89 c3                	mov    %eax,%ebx
+  8033a1:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033a3:	83 38 20             	cmpl   $0x20,(%eax)
+  8033a6:	74 2c                	je     8033d4 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8033a8:	8b 03                	mov    (%ebx),%eax
+  8033aa:	8d 50 01             	lea    0x1(%eax),%edx
+  8033ad:	89 13                	mov    %edx,(%ebx)
+  8033af:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8033b2:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8033b6:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8033b8:	83 ec 04             	sub    $0x4,%esp
+  8033bb:	6a 18                	push   $0x18
+  8033bd:	6a 00                	push   $0x0
+  8033bf:	50                   	push   %eax
+  8033c0:	e8 23 d8 ff ff       	call   800be8 <memset>
+	return 0;
+  8033c5:	83 c4 10             	add    $0x10,%esp
+  8033c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d0:	5b                   	pop    %ebx
+  8033d1:	5e                   	pop    %esi
+  8033d2:	5d                   	pop    %ebp
+  8033d3:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033d4:	83 ec 0c             	sub    $0xc,%esp
+  8033d7:	50                   	push   %eax
+  8033d8:	e8 90 ff ff ff       	call   80336d <pgbatch_flush>
+  8033dd:	83 c4 10             	add    $0x10,%esp
+  8033e0:	85 c0                	test   %eax,%eax
+  8033e2:	79 c4                	jns    8033a8 <pgbatch_slot+0xe>
+  8033e4:	eb e7                	jmp    8033cd <pgbatch_slot+0x33>
+
+008033e6 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8033e6:	55                   	push   %ebp
+  8033e7:	89 e5                	mov    %esp,%ebp
+  8033e9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033ec:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f2:	e8 a3 ff ff ff       	call   80339a <pgbatch_slot>
+  8033f7:	85 c0                	test   %eax,%eax
+  8033f9:	78 20                	js     80341b <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8033fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033fe:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803404:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803407:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80340a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80340d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803410:	8b 55 14             	mov    0x14(%ebp),%edx
+  803413:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803416:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80341b:	c9                   	leave
+  80341c:	c3                   	ret
+
+0080341d <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80341d:	55                   	push   %ebp
+  80341e:	89 e5                	mov    %esp,%ebp
+  803420:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803423:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803426:	8b 45 08             	mov    0x8(%ebp),%eax
+  803429:	e8 6c ff ff ff       	call   80339a <pgbatch_slot>
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	78 2c                	js     80345e <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803432:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803435:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80343b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80343e:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803441:	8b 55 10             	mov    0x10(%ebp),%edx
+  803444:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803447:	8b 55 14             	mov    0x14(%ebp),%edx
+  80344a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80344d:	8b 55 18             	mov    0x18(%ebp),%edx
+  803450:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803453:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803456:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80345e:	c9                   	leave
+  80345f:	c3                   	ret
+
+00803460 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803460:	55                   	push   %ebp
+  803461:	89 e5                	mov    %esp,%ebp
+  803463:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803466:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803469:	8b 45 08             	mov    0x8(%ebp),%eax
+  80346c:	e8 29 ff ff ff       	call   80339a <pgbatch_slot>
+  803471:	85 c0                	test   %eax,%eax
+  803473:	78 1a                	js     80348f <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803475:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803478:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80347e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803481:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803484:	8b 55 10             	mov    0x10(%ebp),%edx
+  803487:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80348a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80348f:	c9                   	leave
+  803490:	c3                   	ret
+
+00803491 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803491:	55                   	push   %ebp
+  803492:	89 e5                	mov    %esp,%ebp
+  803494:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803497:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80349a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80349d:	e8 f8 fe ff ff       	call   80339a <pgbatch_slot>
+  8034a2:	85 c0                	test   %eax,%eax
+  8034a4:	78 20                	js     8034c6 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8034a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034a9:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8034af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034b2:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034b5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034b8:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034bb:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034be:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034c6:	c9                   	leave
+  8034c7:	c3                   	ret
+
+008034c8 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8034c8:	55                   	push   %ebp
+  8034c9:	89 e5                	mov    %esp,%ebp
+  8034cb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034ce:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034d4:	e8 c1 fe ff ff       	call   80339a <pgbatch_slot>
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	78 26                	js     803503 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8034dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034e0:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8034e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034e9:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8034ec:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034ef:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8034f2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034f5:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8034f8:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034fb:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803503:	c9                   	leave
+  803504:	c3                   	ret
+
+00803505 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80350a:	c3                   	ret
+
+0080350b <devcons_poll>:
+{
+  80350b:	55                   	push   %ebp
+  80350c:	89 e5                	mov    %esp,%ebp
+  80350e:	53                   	push   %ebx
+  80350f:	83 ec 04             	sub    $0x4,%esp
+  803512:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803515:	89 da                	mov    %ebx,%edx
+  803517:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80351a:	83 3d 54 63 80 00 00 	cmpl   $0x0,0x806354
+  803521:	74 0c                	je     80352f <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803523:	89 d8                	mov    %ebx,%eax
+  803525:	83 e0 01             	and    $0x1,%eax
+  803528:	09 d0                	or     %edx,%eax
+}
+  80352a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80352d:	c9                   	leave
+  80352e:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80352f:	e8 cf d8 ff ff       	call   800e03 <sys_cgetc>
+  803534:	a3 54 63 80 00       	mov    %eax,0x806354
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803539:	89 da                	mov    %ebx,%edx
+  80353b:	83 e2 04             	and    $0x4,%edx
+  80353e:	85 c0                	test   %eax,%eax
+  803540:	74 e6                	je     803528 <devcons_poll+0x1d>
+  803542:	eb df                	jmp    803523 <devcons_poll+0x18>
+
+00803544 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803544:	55                   	push   %ebp
+  803545:	89 e5                	mov    %esp,%ebp
+  803547:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80354a:	68 5e 41 80 00       	push   $0x80415e
+  80354f:	ff 75 0c             	push   0xc(%ebp)
+  803552:	e8 16 d5 ff ff       	call   800a6d <strcpy>
+	return 0;
+}
+  803557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355c:	c9                   	leave
+  80355d:	c3                   	ret
+
+0080355e <devcons_write>:
+{
+  80355e:	55                   	push   %ebp
+  80355f:	89 e5                	mov    %esp,%ebp
+  803561:	57                   	push   %edi
+  803562:	56                   	push   %esi
+  803563:	53                   	push   %ebx
+  803564:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80356a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80356d:	85 ff                	test   %edi,%edi
+  80356f:	74 51                	je     8035c2 <devcons_write+0x64>
+  803571:	be 00 00 00 00       	mov    $0x0,%esi
+  803576:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80357b:	89 fb                	mov    %edi,%ebx
+  80357d:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80357f:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803584:	39 d3                	cmp    %edx,%ebx
+  803586:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803589:	83 ec 04             	sub    $0x4,%esp
+  80358c:	53                   	push   %ebx
+  80358d:	03 45 0c             	add    0xc(%ebp),%eax
+  803590:	50                   	push   %eax
+  803591:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803597:	50                   	push   %eax
+  803598:	e8 80 d6 ff ff       	call   800c1d <memmove>
+		sys_cputs(buf, m);
+  80359d:	83 c4 08             	add    $0x8,%esp
+  8035a0:	53                   	push   %ebx
+  8035a1:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035a7:	50                   	push   %eax
+  8035a8:	e8 38 d8 ff ff       	call   800de5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8035ad:	01 de                	add    %ebx,%esi
+  8035af:	89 f0                	mov    %esi,%eax
+  8035b1:	83 c4 10             	add    $0x10,%esp
+  8035b4:	39 fe                	cmp    %edi,%esi
+  8035b6:	72 c3                	jb     80357b <devcons_write+0x1d>
+}
+  8035b8:	89 f0                	mov    %esi,%eax
+  8035ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035bd:	5b                   	pop    %ebx
+  8035be:	5e                   	pop    %esi
+  8035bf:	5f                   	pop    %edi
+  8035c0:	5d                   	pop    %ebp
+  8035c1:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8035c2:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8035c7:	eb ef                	jmp    8035b8 <devcons_write+0x5a>
+
+008035c9 <devcons_read>:
+{
+  8035c9:	55                   	push   %ebp
+  8035ca:	89 e5                	mov    %esp,%ebp
+  8035cc:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8035cf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8035d4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035d8:	74 36                	je     803610 <devcons_read+0x47>
+	c = cons_peek;
+  8035da:	a1 54 63 80 00       	mov    0x806354,%eax
+	cons_peek = 0;
+  8035df:	c7 05 54 63 80 00 00 	movl   $0x0,0x806354
+  8035e6:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8035e9:	85 c0                	test   %eax,%eax
+  8035eb:	75 10                	jne    8035fd <devcons_read+0x34>
+  8035ed:	e8 11 d8 ff ff       	call   800e03 <sys_cgetc>
+  8035f2:	85 c0                	test   %eax,%eax
+  8035f4:	75 07                	jne    8035fd <devcons_read+0x34>
+		sys_yield();
+  8035f6:	e8 87 d8 ff ff       	call   800e82 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8035fb:	eb f0                	jmp    8035ed <devcons_read+0x24>
+	if (c < 0)
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	78 0f                	js     803610 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803601:	83 f8 04             	cmp    $0x4,%eax
+  803604:	74 0c                	je     803612 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803606:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803609:	88 02                	mov    %al,(%edx)
+	return 1;
+  80360b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803610:	c9                   	leave
+  803611:	c3                   	ret
+		return 0;
+  803612:	b8 00 00 00 00       	mov    $0x0,%eax
+  803617:	eb f7                	jmp    803610 <devcons_read+0x47>
+
+00803619 <cputchar>:
+{
+  803619:	55                   	push   %ebp
+  80361a:	89 e5                	mov    %esp,%ebp
+  80361c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80361f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803622:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803625:	6a 01                	push   $0x1
+  803627:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80362a:	50                   	push   %eax
+  80362b:	e8 b5 d7 ff ff       	call   800de5 <sys_cputs>
+}
+  803630:	83 c4 10             	add    $0x10,%esp
+  803633:	c9                   	leave
+  803634:	c3                   	ret
+
+00803635 <getchar>:
+{
+  803635:	55                   	push   %ebp
+  803636:	89 e5                	mov    %esp,%ebp
+  803638:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80363b:	6a 01                	push   $0x1
+  80363d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803640:	50                   	push   %eax
+  803641:	6a 00                	push   $0x0
+  803643:	e8 b7 df ff ff       	call   8015ff <read>
+	if (r < 0)
+  803648:	83 c4 10             	add    $0x10,%esp
+  80364b:	85 c0                	test   %eax,%eax
+  80364d:	78 06                	js     803655 <getchar+0x20>
+	if (r < 1)
+  80364f:	74 06                	je     803657 <getchar+0x22>
+	return c;
+  803651:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803655:	c9                   	leave
+  803656:	c3                   	ret
+		return -E_EOF;
+  803657:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80365c:	eb f7                	jmp    803655 <getchar+0x20>
+
+0080365e <iscons>:
+{
+  80365e:	55                   	push   %ebp
+  80365f:	89 e5                	mov    %esp,%ebp
+  803661:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803664:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803667:	50                   	push   %eax
+  803668:	ff 75 08             	push   0x8(%ebp)
+  80366b:	e8 0b dd ff ff       	call   80137b <fd_lookup>
+  803670:	83 c4 10             	add    $0x10,%esp
+  803673:	85 c0                	test   %eax,%eax
+  803675:	78 11                	js     803688 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803677:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80367a:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803680:	39 10                	cmp    %edx,(%eax)
+  803682:	0f 94 c0             	sete   %al
+  803685:	0f b6 c0             	movzbl %al,%eax
+}
+  803688:	c9                   	leave
+  803689:	c3                   	ret
+
+0080368a <opencons>:
+{
+  80368a:	55                   	push   %ebp
+  80368b:	89 e5                	mov    %esp,%ebp
+  80368d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803690:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803693:	50                   	push   %eax
+  803694:	e8 92 dc ff ff       	call   80132b <fd_alloc>
+  803699:	83 c4 10             	add    $0x10,%esp
+  80369c:	85 c0                	test   %eax,%eax
+  80369e:	78 3a                	js     8036da <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8036a0:	83 ec 04             	sub    $0x4,%esp
+  8036a3:	68 07 04 00 00       	push   $0x407
+  8036a8:	ff 75 f4             	push   -0xc(%ebp)
+  8036ab:	6a 00                	push   $0x0
+  8036ad:	e8 ef d7 ff ff       	call   800ea1 <sys_page_alloc>
+  8036b2:	83 c4 10             	add    $0x10,%esp
+  8036b5:	85 c0                	test   %eax,%eax
+  8036b7:	78 21                	js     8036da <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8036b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036bc:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8036c2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8036c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036c7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8036ce:	83 ec 0c             	sub    $0xc,%esp
+  8036d1:	50                   	push   %eax
+  8036d2:	e8 2d dc ff ff       	call   801304 <fd2num>
+  8036d7:	83 c4 10             	add    $0x10,%esp
+}
+  8036da:	c9                   	leave
+  8036db:	c3                   	ret
+
+008036dc <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036dc:	55                   	push   %ebp
+  8036dd:	89 e5                	mov    %esp,%ebp
+  8036df:	56                   	push   %esi
+  8036e0:	53                   	push   %ebx
+  8036e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8036ea:	85 c0                	test   %eax,%eax
+  8036ec:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036f1:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8036f4:	83 ec 0c             	sub    $0xc,%esp
+  8036f7:	50                   	push   %eax
+  8036f8:	e8 54 d9 ff ff       	call   801051 <sys_ipc_recv>
+  8036fd:	83 c4 10             	add    $0x10,%esp
+  803700:	85 c0                	test   %eax,%eax
+  803702:	0f 88 8b 00 00 00    	js     803793 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803708:	85 f6                	test   %esi,%esi
+  80370a:	74 2a                	je     803736 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80370c:	89 e2                	mov    %esp,%edx
+  80370e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803713:	29 d0                	sub    %edx,%eax
+  803715:	89 c2                	mov    %eax,%edx
+  803717:	c1 ea 0f             	shr    $0xf,%edx
+  80371a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80371f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803724:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803727:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80372e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803734:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803736:	85 db                	test   %ebx,%ebx
+  803738:	74 2a                	je     803764 <ipc_recv+0x88>
+  80373a:	89 e2                	mov    %esp,%edx
+  80373c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803741:	29 d0                	sub    %edx,%eax
+  803743:	89 c2                	mov    %eax,%edx
+  803745:	c1 ea 0f             	shr    $0xf,%edx
+  803748:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80374d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803752:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803755:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80375c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803762:	89 03                	mov    %eax,(%ebx)
+  803764:	89 e2                	mov    %esp,%edx
+  803766:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80376b:	29 d0                	sub    %edx,%eax
+  80376d:	89 c2                	mov    %eax,%edx
+  80376f:	c1 ea 0f             	shr    $0xf,%edx
+  803772:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377c:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80377f:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803786:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80378c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80378f:	5b                   	pop    %ebx
+  803790:	5e                   	pop    %esi
+  803791:	5d                   	pop    %ebp
+  803792:	c3                   	ret
+		if(from_env_store != NULL)
+  803793:	85 f6                	test   %esi,%esi
+  803795:	74 06                	je     80379d <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803797:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80379d:	85 db                	test   %ebx,%ebx
+  80379f:	74 eb                	je     80378c <ipc_recv+0xb0>
+			*perm_store = 0;
+  8037a1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037a7:	eb e3                	jmp    80378c <ipc_recv+0xb0>
+
+008037a9 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8037a9:	55                   	push   %ebp
+  8037aa:	89 e5                	mov    %esp,%ebp
+  8037ac:	57                   	push   %edi
+  8037ad:	56                   	push   %esi
+  8037ae:	53                   	push   %ebx
+  8037af:	83 ec 14             	sub    $0x14,%esp
+  8037b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037b8:	8b 75 14             	mov    0x14(%ebp),%esi
+  8037bb:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8037be:	85 c0                	test   %eax,%eax
+  8037c0:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8037c5:	0f 44 c2             	cmove  %edx,%eax
+  8037c8:	ff 75 10             	push   0x10(%ebp)
+  8037cb:	50                   	push   %eax
+  8037cc:	e8 e2 d8 ff ff       	call   8010b3 <sys_ipc_recv_pages>
+  8037d1:	83 c4 10             	add    $0x10,%esp
+  8037d4:	85 c0                	test   %eax,%eax
+  8037d6:	0f 88 ba 00 00 00    	js     803896 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8037dc:	85 ff                	test   %edi,%edi
+  8037de:	74 2a                	je     80380a <ipc_recv_pages+0x61>
+  8037e0:	89 e2                	mov    %esp,%edx
+  8037e2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037e7:	29 d0                	sub    %edx,%eax
+  8037e9:	89 c2                	mov    %eax,%edx
+  8037eb:	c1 ea 0f             	shr    $0xf,%edx
+  8037ee:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f8:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8037fb:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803802:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803808:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80380a:	85 f6                	test   %esi,%esi
+  80380c:	74 2a                	je     803838 <ipc_recv_pages+0x8f>
+  80380e:	89 e2                	mov    %esp,%edx
+  803810:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803815:	29 d0                	sub    %edx,%eax
+  803817:	89 c2                	mov    %eax,%edx
+  803819:	c1 ea 0f             	shr    $0xf,%edx
+  80381c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803821:	b8 00 00 00 00       	mov    $0x0,%eax
+  803826:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803829:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803830:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803836:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803838:	85 db                	test   %ebx,%ebx
+  80383a:	74 2a                	je     803866 <ipc_recv_pages+0xbd>
+  80383c:	89 e2                	mov    %esp,%edx
+  80383e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803843:	29 d0                	sub    %edx,%eax
+  803845:	89 c2                	mov    %eax,%edx
+  803847:	c1 ea 0f             	shr    $0xf,%edx
+  80384a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80384f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803854:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803857:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80385e:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803864:	89 03                	mov    %eax,(%ebx)
+  803866:	89 e2                	mov    %esp,%edx
+  803868:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80386d:	29 d0                	sub    %edx,%eax
+  80386f:	89 c2                	mov    %eax,%edx
+  803871:	c1 ea 0f             	shr    $0xf,%edx
+  803874:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387e:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803881:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803888:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80388e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803891:	5b                   	pop    %ebx
+  803892:	5e                   	pop    %esi
+  803893:	5f                   	pop    %edi
+  803894:	5d                   	pop    %ebp
+  803895:	c3                   	ret
+		if (from_env_store)
+  803896:	85 ff                	test   %edi,%edi
+  803898:	74 06                	je     8038a0 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80389a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8038a0:	85 f6                	test   %esi,%esi
+  8038a2:	74 06                	je     8038aa <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8038a4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8038aa:	85 db                	test   %ebx,%ebx
+  8038ac:	74 e0                	je     80388e <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8038ae:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8038b4:	eb d8                	jmp    80388e <ipc_recv_pages+0xe5>
+
+008038b6 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8038b6:	55                   	push   %ebp
+  8038b7:	89 e5                	mov    %esp,%ebp
+  8038b9:	57                   	push   %edi
+  8038ba:	56                   	push   %esi
+  8038bb:	53                   	push   %ebx
+  8038bc:	83 ec 1c             	sub    $0x1c,%esp
+  8038bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8038c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038c5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038cb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038cf:	75 2b                	jne    8038fc <ipc_try_send_pages+0x46>
+  8038d1:	89 e2                	mov    %esp,%edx
+  8038d3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038d8:	29 d0                	sub    %edx,%eax
+  8038da:	89 c2                	mov    %eax,%edx
+  8038dc:	c1 ea 0f             	shr    $0xf,%edx
+  8038df:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e9:	0f 42 c2             	cmovb  %edx,%eax
+  8038ec:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8038f3:	8b 70 48             	mov    0x48(%eax),%esi
+  8038f6:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038fc:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803902:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803907:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80390a:	85 ff                	test   %edi,%edi
+  80390c:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803911:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803914:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80391a:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803920:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803926:	83 ec 0c             	sub    $0xc,%esp
+  803929:	ff 75 14             	push   0x14(%ebp)
+  80392c:	ff 75 18             	push   0x18(%ebp)
+  80392f:	57                   	push   %edi
+  803930:	ff 75 0c             	push   0xc(%ebp)
+  803933:	ff 75 08             	push   0x8(%ebp)
+  803936:	e8 57 d7 ff ff       	call   801092 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80393b:	83 c4 20             	add    $0x20,%esp
+  80393e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803941:	75 21                	jne    803964 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803943:	83 ec 04             	sub    $0x4,%esp
+  803946:	6a ff                	push   $0xffffffff
+  803948:	53                   	push   %ebx
+  803949:	ff 75 e4             	push   -0x1c(%ebp)
+  80394c:	e8 4e d9 ff ff       	call   80129f <sys_futex_wait>
+  803951:	83 c4 10             	add    $0x10,%esp
+  803954:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803957:	74 c7                	je     803920 <ipc_try_send_pages+0x6a>
+  803959:	85 c0                	test   %eax,%eax
+  80395b:	79 c3                	jns    803920 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80395d:	e8 20 d5 ff ff       	call   800e82 <sys_yield>
+  803962:	eb bc                	jmp    803920 <ipc_try_send_pages+0x6a>
+	}
+}
+  803964:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803967:	5b                   	pop    %ebx
+  803968:	5e                   	pop    %esi
+  803969:	5f                   	pop    %edi
+  80396a:	5d                   	pop    %ebp
+  80396b:	c3                   	ret
+
+0080396c <ipc_send>:
+{
+  80396c:	55                   	push   %ebp
+  80396d:	89 e5                	mov    %esp,%ebp
+  80396f:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803972:	ff 75 14             	push   0x14(%ebp)
+  803975:	6a 01                	push   $0x1
+  803977:	ff 75 10             	push   0x10(%ebp)
+  80397a:	ff 75 0c             	push   0xc(%ebp)
+  80397d:	ff 75 08             	push   0x8(%ebp)
+  803980:	e8 31 ff ff ff       	call   8038b6 <ipc_try_send_pages>
+  803985:	83 c4 20             	add    $0x20,%esp
+  803988:	85 c0                	test   %eax,%eax
+  80398a:	78 02                	js     80398e <ipc_send+0x22>
+}
+  80398c:	c9                   	leave
+  80398d:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80398e:	50                   	push   %eax
+  80398f:	68 6a 41 80 00       	push   $0x80416a
+  803994:	6a 3f                	push   $0x3f
+  803996:	68 7f 41 80 00       	push   $0x80417f
+  80399b:	e8 fb c8 ff ff       	call   80029b <_panic>
+
+008039a0 <ipc_send_pages>:
+{
+  8039a0:	55                   	push   %ebp
+  8039a1:	89 e5                	mov    %esp,%ebp
+  8039a3:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8039a6:	ff 75 18             	push   0x18(%ebp)
+  8039a9:	ff 75 14             	push   0x14(%ebp)
+  8039ac:	ff 75 10             	push   0x10(%ebp)
+  8039af:	ff 75 0c             	push   0xc(%ebp)
+  8039b2:	ff 75 08             	push   0x8(%ebp)
+  8039b5:	e8 fc fe ff ff       	call   8038b6 <ipc_try_send_pages>
+  8039ba:	83 c4 20             	add    $0x20,%esp
+  8039bd:	85 c0                	test   %eax,%eax
+  8039bf:	78 02                	js     8039c3 <ipc_send_pages+0x23>
+}
+  8039c1:	c9                   	leave
+  8039c2:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8039c3:	50                   	push   %eax
+  8039c4:	68 89 41 80 00       	push   $0x804189
+  8039c9:	6a 64                	push   $0x64
+  8039cb:	68 7f 41 80 00       	push   $0x80417f
+  8039d0:	e8 c6 c8 ff ff       	call   80029b <_panic>
+
+008039d5 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8039d5:	55                   	push   %ebp
+  8039d6:	89 e5                	mov    %esp,%ebp
+  8039d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8039db:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8039e0:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8039e6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039ec:	8b 52 50             	mov    0x50(%edx),%edx
+  8039ef:	39 ca                	cmp    %ecx,%edx
+  8039f1:	74 11                	je     803a04 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8039f3:	83 c0 01             	add    $0x1,%eax
+  8039f6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8039fb:	75 e3                	jne    8039e0 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8039fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a02:	eb 0e                	jmp    803a12 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803a04:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803a0a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a0f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803a12:	5d                   	pop    %ebp
+  803a13:	c3                   	ret
+
+00803a14 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a14:	55                   	push   %ebp
+  803a15:	89 e5                	mov    %esp,%ebp
+  803a17:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a1a:	89 c2                	mov    %eax,%edx
+  803a1c:	c1 ea 16             	shr    $0x16,%edx
+  803a1f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a26:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a2b:	f6 c1 01             	test   $0x1,%cl
+  803a2e:	74 1e                	je     803a4e <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803a30:	c1 e8 0c             	shr    $0xc,%eax
+  803a33:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a3a:	a8 01                	test   $0x1,%al
+  803a3c:	74 10                	je     803a4e <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a3e:	c1 e8 0c             	shr    $0xc,%eax
+  803a41:	c1 e0 04             	shl    $0x4,%eax
+  803a44:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803a4b:	0f b7 d2             	movzwl %dx,%edx
+}
+  803a4e:	89 d0                	mov    %edx,%eax
+  803a50:	5d                   	pop    %ebp
+  803a51:	c3                   	ret
+
+00803a52 <__udivdi3>:
+  803a52:	57                   	push   %edi
+  803a53:	56                   	push   %esi
+  803a54:	53                   	push   %ebx
+  803a55:	83 ec 20             	sub    $0x20,%esp
+  803a58:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803a5c:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803a60:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a64:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a68:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a6c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a70:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803a74:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803a78:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803a7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a82:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a87:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803a8e:	00 
+  803a8f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803a96:	00 
+  803a97:	eb 08                	jmp    803aa1 <__udivdi3+0x4f>
+  803a99:	83 e9 01             	sub    $0x1,%ecx
+  803a9c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803a9f:	74 68                	je     803b09 <__udivdi3+0xb7>
+  803aa1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803aa5:	01 c0                	add    %eax,%eax
+  803aa7:	89 c6                	mov    %eax,%esi
+  803aa9:	89 d7                	mov    %edx,%edi
+  803aab:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803aaf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ab3:	0f ad d0             	shrd   %cl,%edx,%eax
+  803ab6:	d3 ea                	shr    %cl,%edx
+  803ab8:	f6 c1 20             	test   $0x20,%cl
+  803abb:	74 04                	je     803ac1 <__udivdi3+0x6f>
+  803abd:	89 d0                	mov    %edx,%eax
+  803abf:	31 d2                	xor    %edx,%edx
+  803ac1:	83 e0 01             	and    $0x1,%eax
+  803ac4:	89 04 24             	mov    %eax,(%esp)
+  803ac7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803ace:	00 
+  803acf:	8b 04 24             	mov    (%esp),%eax
+  803ad2:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803ad6:	09 f0                	or     %esi,%eax
+  803ad8:	09 fa                	or     %edi,%edx
+  803ada:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803ade:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803ae2:	39 f0                	cmp    %esi,%eax
+  803ae4:	89 d3                	mov    %edx,%ebx
+  803ae6:	19 fb                	sbb    %edi,%ebx
+  803ae8:	72 af                	jb     803a99 <__udivdi3+0x47>
+  803aea:	29 f0                	sub    %esi,%eax
+  803aec:	19 fa                	sbb    %edi,%edx
+  803aee:	89 cf                	mov    %ecx,%edi
+  803af0:	c1 ef 05             	shr    $0x5,%edi
+  803af3:	83 e7 01             	and    $0x1,%edi
+  803af6:	89 fe                	mov    %edi,%esi
+  803af8:	83 f6 01             	xor    $0x1,%esi
+  803afb:	d3 e6                	shl    %cl,%esi
+  803afd:	d3 e7                	shl    %cl,%edi
+  803aff:	09 74 24 18          	or     %esi,0x18(%esp)
+  803b03:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803b07:	eb 90                	jmp    803a99 <__udivdi3+0x47>
+  803b09:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b0d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b11:	83 c4 20             	add    $0x20,%esp
+  803b14:	5b                   	pop    %ebx
+  803b15:	5e                   	pop    %esi
+  803b16:	5f                   	pop    %edi
+  803b17:	c3                   	ret
+
+00803b18 <__umoddi3>:
+  803b18:	57                   	push   %edi
+  803b19:	56                   	push   %esi
+  803b1a:	53                   	push   %ebx
+  803b1b:	83 ec 08             	sub    $0x8,%esp
+  803b1e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b22:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b26:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803b2a:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803b2e:	57                   	push   %edi
+  803b2f:	56                   	push   %esi
+  803b30:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b34:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b38:	52                   	push   %edx
+  803b39:	50                   	push   %eax
+  803b3a:	e8 13 ff ff ff       	call   803a52 <__udivdi3>
+  803b3f:	89 c3                	mov    %eax,%ebx
+  803b41:	0f af d6             	imul   %esi,%edx
+  803b44:	89 f9                	mov    %edi,%ecx
+  803b46:	0f af cb             	imul   %ebx,%ecx
+  803b49:	01 d1                	add    %edx,%ecx
+  803b4b:	89 d8                	mov    %ebx,%eax
+  803b4d:	f7 e6                	mul    %esi
+  803b4f:	89 c6                	mov    %eax,%esi
+  803b51:	89 d7                	mov    %edx,%edi
+  803b53:	01 cf                	add    %ecx,%edi
+  803b55:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b59:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b5d:	29 f0                	sub    %esi,%eax
+  803b5f:	19 fa                	sbb    %edi,%edx
+  803b61:	83 c4 18             	add    $0x18,%esp
+  803b64:	5b                   	pop    %ebx
+  803b65:	5e                   	pop    %esi
+  803b66:	5f                   	pop    %edi
+  803b67:	c3                   	ret
+
+00803b68 <__divdi3>:
+  803b68:	53                   	push   %ebx
+  803b69:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b6d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b71:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803b75:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803b79:	85 d2                	test   %edx,%edx
+  803b7b:	78 12                	js     803b8f <__divdi3+0x27>
+  803b7d:	85 db                	test   %ebx,%ebx
+  803b7f:	78 2e                	js     803baf <__divdi3+0x47>
+  803b81:	53                   	push   %ebx
+  803b82:	51                   	push   %ecx
+  803b83:	52                   	push   %edx
+  803b84:	50                   	push   %eax
+  803b85:	e8 c8 fe ff ff       	call   803a52 <__udivdi3>
+  803b8a:	83 c4 10             	add    $0x10,%esp
+  803b8d:	eb 1e                	jmp    803bad <__divdi3+0x45>
+  803b8f:	f7 d8                	neg    %eax
+  803b91:	83 d2 00             	adc    $0x0,%edx
+  803b94:	f7 da                	neg    %edx
+  803b96:	85 db                	test   %ebx,%ebx
+  803b98:	78 2a                	js     803bc4 <__divdi3+0x5c>
+  803b9a:	53                   	push   %ebx
+  803b9b:	51                   	push   %ecx
+  803b9c:	52                   	push   %edx
+  803b9d:	50                   	push   %eax
+  803b9e:	e8 af fe ff ff       	call   803a52 <__udivdi3>
+  803ba3:	83 c4 10             	add    $0x10,%esp
+  803ba6:	f7 d8                	neg    %eax
+  803ba8:	83 d2 00             	adc    $0x0,%edx
+  803bab:	f7 da                	neg    %edx
+  803bad:	5b                   	pop    %ebx
+  803bae:	c3                   	ret
+  803baf:	f7 d9                	neg    %ecx
+  803bb1:	83 d3 00             	adc    $0x0,%ebx
+  803bb4:	f7 db                	neg    %ebx
+  803bb6:	53                   	push   %ebx
+  803bb7:	51                   	push   %ecx
+  803bb8:	52                   	push   %edx
+  803bb9:	50                   	push   %eax
+  803bba:	e8 93 fe ff ff       	call   803a52 <__udivdi3>
+  803bbf:	83 c4 10             	add    $0x10,%esp
+  803bc2:	eb e2                	jmp    803ba6 <__divdi3+0x3e>
+  803bc4:	f7 d9                	neg    %ecx
+  803bc6:	83 d3 00             	adc    $0x0,%ebx
+  803bc9:	f7 db                	neg    %ebx
+  803bcb:	53                   	push   %ebx
+  803bcc:	51                   	push   %ecx
+  803bcd:	52                   	push   %edx
+  803bce:	50                   	push   %eax
+  803bcf:	e8 7e fe ff ff       	call   803a52 <__udivdi3>
+  803bd4:	83 c4 10             	add    $0x10,%esp
+  803bd7:	eb d4                	jmp    803bad <__divdi3+0x45>
+
+00803bd9 <__moddi3>:
+  803bd9:	57                   	push   %edi
+  803bda:	56                   	push   %esi
+  803bdb:	53                   	push   %ebx
+  803bdc:	83 ec 08             	sub    $0x8,%esp
+  803bdf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803be3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803be7:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803beb:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803bef:	57                   	push   %edi
+  803bf0:	56                   	push   %esi
+  803bf1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803bf5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803bf9:	52                   	push   %edx
+  803bfa:	50                   	push   %eax
+  803bfb:	e8 68 ff ff ff       	call   803b68 <__divdi3>
+  803c00:	89 c3                	mov    %eax,%ebx
+  803c02:	0f af d6             	imul   %esi,%edx
+  803c05:	89 f9                	mov    %edi,%ecx
+  803c07:	0f af cb             	imul   %ebx,%ecx
+  803c0a:	01 d1                	add    %edx,%ecx
+  803c0c:	89 d8                	mov    %ebx,%eax
+  803c0e:	f7 e6                	mul    %esi
+  803c10:	89 c6                	mov    %eax,%esi
+  803c12:	89 d7                	mov    %edx,%edi
+  803c14:	01 cf                	add    %ecx,%edi
+  803c16:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803c1a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803c1e:	29 f0                	sub    %esi,%eax
+  803c20:	19 fa                	sbb    %edi,%edx
+  803c22:	83 c4 18             	add    $0x18,%esp
+  803c25:	5b                   	pop    %ebx
+  803c26:	5e                   	pop    %esi
+  803c27:	5f                   	pop    %edi
+  803c28:	c3                   	ret
@@ -0,0 +1,9779 @@
+
+obj/user/nsmem.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 38 03 00 00       	call   800369 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+
+static struct Nsret_memstats st0;
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 a0 4a 80 00       	push   $0x804aa0
+  800041:	e8 a5 04 00 00       	call   8004eb <cprintf>
+	exit();
+  800046:	e8 ab 03 00 00       	call   8003f6 <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <report>:
+
+static void
+report(const char *when)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	53                   	push   %ebx
+  800054:	83 ec 40             	sub    $0x40,%esp
+  800057:	89 c3                	mov    %eax,%ebx
+	struct Nsret_memstats st;
+	uint32_t n;
+	int r;
+
+	if ((r = nsipc_memstats(&st)) < 0)
+  800059:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  80005c:	50                   	push   %eax
+  80005d:	e8 2b 35 00 00       	call   80358d <nsipc_memstats>
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	85 c0                	test   %eax,%eax
+  800067:	78 70                	js     8000d9 <report+0x89>
+		panic("nsipc_memstats: %e", r);
+	cprintf("nsmem: %s: %d pages (%d KB), heap %u KB, %u KB live, "
+		"%u KB in thread caches\n",
+		when, st.ret_pages, st.ret_pages * PGSIZE / 1024,
+  800069:	8b 55 f4             	mov    -0xc(%ebp),%edx
+	cprintf("nsmem: %s: %d pages (%d KB), heap %u KB, %u KB live, "
+  80006c:	83 ec 04             	sub    $0x4,%esp
+  80006f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800072:	c1 e8 0a             	shr    $0xa,%eax
+  800075:	50                   	push   %eax
+  800076:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800079:	c1 e8 0a             	shr    $0xa,%eax
+  80007c:	50                   	push   %eax
+  80007d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800080:	c1 e8 0a             	shr    $0xa,%eax
+  800083:	50                   	push   %eax
+  800084:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  80008b:	50                   	push   %eax
+  80008c:	52                   	push   %edx
+  80008d:	53                   	push   %ebx
+  80008e:	68 10 4b 80 00       	push   $0x804b10
+  800093:	e8 53 04 00 00       	call   8004eb <cprintf>
+		st.ret_malloc.ms_arena / 1024, st.ret_malloc.ms_inuse / 1024,
+		st.ret_malloc.ms_cached / 1024);
+	if (st0.ret_pages) {
+  800098:	83 c4 20             	add    $0x20,%esp
+  80009b:	83 3d 20 70 80 00 00 	cmpl   $0x0,0x807020
+  8000a2:	74 47                	je     8000eb <report+0x9b>
+		n = st.ret_malloc.ms_nmalloc - st0.ret_malloc.ms_nmalloc;
+  8000a4:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+  8000a7:	2b 0d 18 70 80 00    	sub    0x807018,%ecx
+		cprintf("nsmem: %s: %u mallocs since idle, %u%% from "
+  8000ad:	89 c8                	mov    %ecx,%eax
+  8000af:	74 13                	je     8000c4 <report+0x74>
+			"thread caches\n", when, n,
+			n ? (st.ret_malloc.ms_cachehits
+			     - st0.ret_malloc.ms_cachehits) * 100 / n : 0);
+  8000b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8000b4:	2b 05 1c 70 80 00    	sub    0x80701c,%eax
+  8000ba:	6b c0 64             	imul   $0x64,%eax,%eax
+		cprintf("nsmem: %s: %u mallocs since idle, %u%% from "
+  8000bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c2:	f7 f1                	div    %ecx
+  8000c4:	50                   	push   %eax
+  8000c5:	51                   	push   %ecx
+  8000c6:	53                   	push   %ebx
+  8000c7:	68 60 4b 80 00       	push   $0x804b60
+  8000cc:	e8 1a 04 00 00       	call   8004eb <cprintf>
+  8000d1:	83 c4 10             	add    $0x10,%esp
+	} else
+		st0 = st;
+}
+  8000d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000d7:	c9                   	leave
+  8000d8:	c3                   	ret
+		panic("nsipc_memstats: %e", r);
+  8000d9:	50                   	push   %eax
+  8000da:	68 a4 4a 80 00       	push   $0x804aa4
+  8000df:	6a 1e                	push   $0x1e
+  8000e1:	68 b7 4a 80 00       	push   $0x804ab7
+  8000e6:	e8 25 03 00 00       	call   800410 <_panic>
+		st0 = st;
+  8000eb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8000ee:	a3 00 70 80 00       	mov    %eax,0x807000
+  8000f3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8000f6:	a3 04 70 80 00       	mov    %eax,0x807004
+  8000fb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8000fe:	a3 08 70 80 00       	mov    %eax,0x807008
+  800103:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800106:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  80010b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80010e:	a3 10 70 80 00       	mov    %eax,0x807010
+  800113:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800116:	a3 14 70 80 00       	mov    %eax,0x807014
+  80011b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80011e:	a3 18 70 80 00       	mov    %eax,0x807018
+  800123:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  800126:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  80012b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80012e:	a3 20 70 80 00       	mov    %eax,0x807020
+}
+  800133:	eb 9f                	jmp    8000d4 <report+0x84>
+
+00800135 <umain>:
+	close(c);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	57                   	push   %edi
+  800139:	56                   	push   %esi
+  80013a:	53                   	push   %ebx
+  80013b:	81 ec e0 02 00 00    	sub    $0x2e0,%esp
+	unsigned int len;
+	envid_t kids[NCONN];
+	char when[32];
+	int s, c, i;
+
+	binaryname = "nsmem";
+  800141:	c7 05 00 60 80 00 c4 	movl   $0x804ac4,0x806000
+  800148:	4a 80 00 
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  80014b:	6a 06                	push   $0x6
+  80014d:	6a 01                	push   $0x1
+  80014f:	6a 02                	push   $0x2
+  800151:	e8 ae 27 00 00       	call   802904 <socket>
+  800156:	89 85 20 fd ff ff    	mov    %eax,-0x2e0(%ebp)
+  80015c:	83 c4 10             	add    $0x10,%esp
+  80015f:	85 c0                	test   %eax,%eax
+  800161:	0f 88 96 00 00 00    	js     8001fd <umain+0xc8>
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+  800167:	83 ec 04             	sub    $0x4,%esp
+  80016a:	6a 10                	push   $0x10
+  80016c:	6a 00                	push   $0x0
+  80016e:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800171:	53                   	push   %ebx
+  800172:	e8 e6 0b 00 00       	call   800d5d <memset>
+	addr.sin_family = AF_INET;
+  800177:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  80017b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800182:	e8 d3 44 00 00       	call   80465a <htonl>
+  800187:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	addr.sin_port = htons(PORT);
+  80018a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800191:	e8 aa 44 00 00       	call   804640 <htons>
+  800196:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  80019a:	83 c4 0c             	add    $0xc,%esp
+  80019d:	6a 10                	push   $0x10
+  80019f:	53                   	push   %ebx
+  8001a0:	ff b5 20 fd ff ff    	push   -0x2e0(%ebp)
+  8001a6:	e8 b8 25 00 00       	call   802763 <bind>
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	78 5a                	js     80020c <umain+0xd7>
+		die("Failed to bind the server socket");
+	if (listen(s, NCONN) < 0)
+  8001b2:	83 ec 08             	sub    $0x8,%esp
+  8001b5:	6a 20                	push   $0x20
+  8001b7:	ff b5 20 fd ff ff    	push   -0x2e0(%ebp)
+  8001bd:	e8 10 26 00 00       	call   8027d2 <listen>
+  8001c2:	83 c4 10             	add    $0x10,%esp
+  8001c5:	85 c0                	test   %eax,%eax
+  8001c7:	78 4f                	js     800218 <umain+0xe3>
+		die("Failed to listen on server socket");
+	report("idle");
+  8001c9:	b8 e2 4a 80 00       	mov    $0x804ae2,%eax
+  8001ce:	e8 7d fe ff ff       	call   800050 <report>
+	cprintf("nsmem: listening\n");
+  8001d3:	83 ec 0c             	sub    $0xc,%esp
+  8001d6:	68 e7 4a 80 00       	push   $0x804ae7
+  8001db:	e8 0b 03 00 00       	call   8004eb <cprintf>
+
+	for (i = 0; i < NCONN; i++) {
+  8001e0:	8d b5 54 ff ff ff    	lea    -0xac(%ebp),%esi
+  8001e6:	83 c4 10             	add    $0x10,%esp
+	cprintf("nsmem: listening\n");
+  8001e9:	89 b5 24 fd ff ff    	mov    %esi,-0x2dc(%ebp)
+	while ((r = read(c, buf, sizeof(buf))) > 0)
+  8001ef:	8d bd 34 fd ff ff    	lea    -0x2cc(%ebp),%edi
+  8001f5:	89 b5 1c fd ff ff    	mov    %esi,-0x2e4(%ebp)
+  8001fb:	eb 7a                	jmp    800277 <umain+0x142>
+		die("Failed to create socket");
+  8001fd:	b8 ca 4a 80 00       	mov    $0x804aca,%eax
+  800202:	e8 2e fe ff ff       	call   800035 <die>
+  800207:	e9 5b ff ff ff       	jmp    800167 <umain+0x32>
+		die("Failed to bind the server socket");
+  80020c:	b8 9c 4b 80 00       	mov    $0x804b9c,%eax
+  800211:	e8 1f fe ff ff       	call   800035 <die>
+  800216:	eb 9a                	jmp    8001b2 <umain+0x7d>
+		die("Failed to listen on server socket");
+  800218:	b8 c0 4b 80 00       	mov    $0x804bc0,%eax
+  80021d:	e8 13 fe ff ff       	call   800035 <die>
+  800222:	eb a5                	jmp    8001c9 <umain+0x94>
+		len = sizeof(addr);
+		if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+			die("Failed to accept client connection");
+  800224:	b8 e4 4b 80 00       	mov    $0x804be4,%eax
+  800229:	e8 07 fe ff ff       	call   800035 <die>
+  80022e:	eb 6d                	jmp    80029d <umain+0x168>
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+  800230:	50                   	push   %eax
+  800231:	68 1d 50 80 00       	push   $0x80501d
+  800236:	6a 57                	push   $0x57
+  800238:	68 b7 4a 80 00       	push   $0x804ab7
+  80023d:	e8 ce 01 00 00       	call   800410 <_panic>
+	close(c);
+  800242:	83 ec 0c             	sub    $0xc,%esp
+  800245:	56                   	push   %esi
+  800246:	e8 66 1b 00 00       	call   801db1 <close>
+		if (kids[i] == 0) {
+			close(s);
+			echo(c);
+			exit();
+  80024b:	e8 a6 01 00 00       	call   8003f6 <exit>
+  800250:	83 c4 10             	add    $0x10,%esp
+		}
+		close(c);
+  800253:	83 ec 0c             	sub    $0xc,%esp
+  800256:	56                   	push   %esi
+  800257:	e8 55 1b 00 00       	call   801db1 <close>
+	for (i = 0; i < NCONN; i++) {
+  80025c:	83 85 24 fd ff ff 04 	addl   $0x4,-0x2dc(%ebp)
+  800263:	8b 85 24 fd ff ff    	mov    -0x2dc(%ebp),%eax
+  800269:	83 c4 10             	add    $0x10,%esp
+  80026c:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+  80026f:	39 c8                	cmp    %ecx,%eax
+  800271:	0f 84 84 00 00 00    	je     8002fb <umain+0x1c6>
+		len = sizeof(addr);
+  800277:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+		if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+  80027e:	83 ec 04             	sub    $0x4,%esp
+  800281:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  800284:	50                   	push   %eax
+  800285:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800288:	50                   	push   %eax
+  800289:	ff b5 20 fd ff ff    	push   -0x2e0(%ebp)
+  80028f:	e8 8d 24 00 00       	call   802721 <accept>
+  800294:	89 c6                	mov    %eax,%esi
+  800296:	83 c4 10             	add    $0x10,%esp
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	78 87                	js     800224 <umain+0xef>
+		if ((kids[i] = fork()) < 0)
+  80029d:	e8 7c 13 00 00       	call   80161e <fork>
+  8002a2:	8b 95 24 fd ff ff    	mov    -0x2dc(%ebp),%edx
+  8002a8:	89 02                	mov    %eax,(%edx)
+  8002aa:	85 c0                	test   %eax,%eax
+  8002ac:	78 82                	js     800230 <umain+0xfb>
+		if (kids[i] == 0) {
+  8002ae:	75 a3                	jne    800253 <umain+0x11e>
+			close(s);
+  8002b0:	83 ec 0c             	sub    $0xc,%esp
+  8002b3:	ff b5 20 fd ff ff    	push   -0x2e0(%ebp)
+  8002b9:	e8 f3 1a 00 00       	call   801db1 <close>
+	while ((r = read(c, buf, sizeof(buf))) > 0)
+  8002be:	83 c4 10             	add    $0x10,%esp
+  8002c1:	83 ec 04             	sub    $0x4,%esp
+  8002c4:	68 00 02 00 00       	push   $0x200
+  8002c9:	57                   	push   %edi
+  8002ca:	56                   	push   %esi
+  8002cb:	e8 20 1c 00 00       	call   801ef0 <read>
+  8002d0:	89 c3                	mov    %eax,%ebx
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 c0                	test   %eax,%eax
+  8002d7:	0f 8e 65 ff ff ff    	jle    800242 <umain+0x10d>
+		if (write(c, buf, r) != r)
+  8002dd:	83 ec 04             	sub    $0x4,%esp
+  8002e0:	53                   	push   %ebx
+  8002e1:	57                   	push   %edi
+  8002e2:	56                   	push   %esi
+  8002e3:	e8 00 1d 00 00       	call   801fe8 <write>
+  8002e8:	83 c4 10             	add    $0x10,%esp
+  8002eb:	39 c3                	cmp    %eax,%ebx
+  8002ed:	74 d2                	je     8002c1 <umain+0x18c>
+			die("Failed to send bytes to client");
+  8002ef:	b8 08 4c 80 00       	mov    $0x804c08,%eax
+  8002f4:	e8 3c fd ff ff       	call   800035 <die>
+  8002f9:	eb c6                	jmp    8002c1 <umain+0x18c>
+  8002fb:	8b b5 1c fd ff ff    	mov    -0x2e4(%ebp),%esi
+  800301:	bb 80 00 00 00       	mov    $0x80,%ebx
+	}
+	// Give every child time to block in the network server.
+	for (i = 0; i < 4 * NCONN; i++)
+		sys_yield();
+  800306:	e8 ec 0c 00 00       	call   800ff7 <sys_yield>
+	for (i = 0; i < 4 * NCONN; i++)
+  80030b:	83 eb 01             	sub    $0x1,%ebx
+  80030e:	75 f6                	jne    800306 <umain+0x1d1>
+	snprintf(when, sizeof(when), "%d connections", NCONN);
+  800310:	6a 20                	push   $0x20
+  800312:	68 f9 4a 80 00       	push   $0x804af9
+  800317:	6a 20                	push   $0x20
+  800319:	8d 9d 34 ff ff ff    	lea    -0xcc(%ebp),%ebx
+  80031f:	53                   	push   %ebx
+  800320:	e8 57 08 00 00       	call   800b7c <snprintf>
+	report(when);
+  800325:	89 d8                	mov    %ebx,%eax
+  800327:	e8 24 fd ff ff       	call   800050 <report>
+  80032c:	83 c4 10             	add    $0x10,%esp
+
+	for (i = 0; i < NCONN; i++)
+		wait(kids[i]);
+  80032f:	83 ec 0c             	sub    $0xc,%esp
+  800332:	ff 36                	push   (%esi)
+  800334:	e8 17 39 00 00       	call   803c50 <wait>
+	for (i = 0; i < NCONN; i++)
+  800339:	83 c6 04             	add    $0x4,%esi
+  80033c:	83 c4 10             	add    $0x10,%esp
+  80033f:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  800342:	39 c6                	cmp    %eax,%esi
+  800344:	75 e9                	jne    80032f <umain+0x1fa>
+	close(s);
+  800346:	83 ec 0c             	sub    $0xc,%esp
+  800349:	ff b5 20 fd ff ff    	push   -0x2e0(%ebp)
+  80034f:	e8 5d 1a 00 00       	call   801db1 <close>
+	report("closed");
+  800354:	b8 08 4b 80 00       	mov    $0x804b08,%eax
+  800359:	e8 f2 fc ff ff       	call   800050 <report>
+}
+  80035e:	83 c4 10             	add    $0x10,%esp
+  800361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800364:	5b                   	pop    %ebx
+  800365:	5e                   	pop    %esi
+  800366:	5f                   	pop    %edi
+  800367:	5d                   	pop    %ebp
+  800368:	c3                   	ret
+
+00800369 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800369:	55                   	push   %ebp
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	56                   	push   %esi
+  80036d:	53                   	push   %ebx
+  80036e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800371:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800374:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800376:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80037b:	29 d0                	sub    %edx,%eax
+  80037d:	89 c2                	mov    %eax,%edx
+  80037f:	c1 ea 0f             	shr    $0xf,%edx
+  800382:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80038f:	c7 04 85 60 7a 80 00 	movl   $0x0,0x807a60(,%eax,4)
+  800396:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80039a:	e8 39 0c 00 00       	call   800fd8 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80039f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003a4:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8003aa:	89 e1                	mov    %esp,%ecx
+  8003ac:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8003b1:	29 ca                	sub    %ecx,%edx
+  8003b3:	89 d1                	mov    %edx,%ecx
+  8003b5:	c1 e9 0f             	shr    $0xf,%ecx
+  8003b8:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8003be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c3:	0f 42 d1             	cmovb  %ecx,%edx
+  8003c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003cb:	89 04 95 60 7a 80 00 	mov    %eax,0x807a60(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003d2:	85 db                	test   %ebx,%ebx
+  8003d4:	7e 07                	jle    8003dd <libmain+0x74>
+		binaryname = argv[0];
+  8003d6:	8b 06                	mov    (%esi),%eax
+  8003d8:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8003dd:	83 ec 08             	sub    $0x8,%esp
+  8003e0:	56                   	push   %esi
+  8003e1:	53                   	push   %ebx
+  8003e2:	e8 4e fd ff ff       	call   800135 <umain>
+
+	// exit gracefully
+	exit();
+  8003e7:	e8 0a 00 00 00       	call   8003f6 <exit>
+}
+  8003ec:	83 c4 10             	add    $0x10,%esp
+  8003ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003f2:	5b                   	pop    %ebx
+  8003f3:	5e                   	pop    %esi
+  8003f4:	5d                   	pop    %ebp
+  8003f5:	c3                   	ret
+
+008003f6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003f6:	55                   	push   %ebp
+  8003f7:	89 e5                	mov    %esp,%ebp
+  8003f9:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003fc:	e8 dd 19 00 00       	call   801dde <close_all>
+	sys_env_destroy(0);
+  800401:	83 ec 0c             	sub    $0xc,%esp
+  800404:	6a 00                	push   $0x0
+  800406:	e8 8c 0b 00 00       	call   800f97 <sys_env_destroy>
+}
+  80040b:	83 c4 10             	add    $0x10,%esp
+  80040e:	c9                   	leave
+  80040f:	c3                   	ret
+
+00800410 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	56                   	push   %esi
+  800414:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800415:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800418:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80041e:	e8 b5 0b 00 00       	call   800fd8 <sys_getenvid>
+  800423:	83 ec 0c             	sub    $0xc,%esp
+  800426:	ff 75 0c             	push   0xc(%ebp)
+  800429:	ff 75 08             	push   0x8(%ebp)
+  80042c:	56                   	push   %esi
+  80042d:	50                   	push   %eax
+  80042e:	68 34 4c 80 00       	push   $0x804c34
+  800433:	e8 b3 00 00 00       	call   8004eb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800438:	83 c4 18             	add    $0x18,%esp
+  80043b:	53                   	push   %ebx
+  80043c:	ff 75 10             	push   0x10(%ebp)
+  80043f:	e8 56 00 00 00       	call   80049a <vcprintf>
+	cprintf("\n");
+  800444:	c7 04 24 a8 51 80 00 	movl   $0x8051a8,(%esp)
+  80044b:	e8 9b 00 00 00       	call   8004eb <cprintf>
+  800450:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800453:	cc                   	int3
+	while (1)
+  800454:	eb fd                	jmp    800453 <_panic+0x43>
+
+00800456 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800456:	55                   	push   %ebp
+  800457:	89 e5                	mov    %esp,%ebp
+  800459:	53                   	push   %ebx
+  80045a:	83 ec 04             	sub    $0x4,%esp
+  80045d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800460:	8b 13                	mov    (%ebx),%edx
+  800462:	8d 42 01             	lea    0x1(%edx),%eax
+  800465:	89 03                	mov    %eax,(%ebx)
+  800467:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80046a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80046e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800473:	74 09                	je     80047e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800475:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800479:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80047c:	c9                   	leave
+  80047d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80047e:	83 ec 08             	sub    $0x8,%esp
+  800481:	68 ff 00 00 00       	push   $0xff
+  800486:	8d 43 08             	lea    0x8(%ebx),%eax
+  800489:	50                   	push   %eax
+  80048a:	e8 cb 0a 00 00       	call   800f5a <sys_cputs>
+		b->idx = 0;
+  80048f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	eb db                	jmp    800475 <putch+0x1f>
+
+0080049a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80049a:	55                   	push   %ebp
+  80049b:	89 e5                	mov    %esp,%ebp
+  80049d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004a3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004aa:	00 00 00 
+	b.cnt = 0;
+  8004ad:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004b4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004b7:	ff 75 0c             	push   0xc(%ebp)
+  8004ba:	ff 75 08             	push   0x8(%ebp)
+  8004bd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004c3:	50                   	push   %eax
+  8004c4:	68 56 04 80 00       	push   $0x800456
+  8004c9:	e8 1c 01 00 00       	call   8005ea <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004ce:	83 c4 08             	add    $0x8,%esp
+  8004d1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004d7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004dd:	50                   	push   %eax
+  8004de:	e8 77 0a 00 00       	call   800f5a <sys_cputs>
+
+	return b.cnt;
+}
+  8004e3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004e9:	c9                   	leave
+  8004ea:	c3                   	ret
+
+008004eb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004eb:	55                   	push   %ebp
+  8004ec:	89 e5                	mov    %esp,%ebp
+  8004ee:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004f1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004f4:	50                   	push   %eax
+  8004f5:	ff 75 08             	push   0x8(%ebp)
+  8004f8:	e8 9d ff ff ff       	call   80049a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004fd:	c9                   	leave
+  8004fe:	c3                   	ret
+
+008004ff <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004ff:	55                   	push   %ebp
+  800500:	89 e5                	mov    %esp,%ebp
+  800502:	57                   	push   %edi
+  800503:	56                   	push   %esi
+  800504:	53                   	push   %ebx
+  800505:	83 ec 1c             	sub    $0x1c,%esp
+  800508:	89 c3                	mov    %eax,%ebx
+  80050a:	89 d6                	mov    %edx,%esi
+  80050c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80050f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800512:	89 d1                	mov    %edx,%ecx
+  800514:	89 c2                	mov    %eax,%edx
+  800516:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800519:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80051c:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80051f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800522:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800529:	39 c2                	cmp    %eax,%edx
+  80052b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80052e:	73 4b                	jae    80057b <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800536:	85 ff                	test   %edi,%edi
+  800538:	7e 11                	jle    80054b <printnum+0x4c>
+			putch(padc, putdat);
+  80053a:	83 ec 08             	sub    $0x8,%esp
+  80053d:	56                   	push   %esi
+  80053e:	ff 75 18             	push   0x18(%ebp)
+  800541:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	83 ef 01             	sub    $0x1,%edi
+  800549:	75 ef                	jne    80053a <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80054b:	83 ec 08             	sub    $0x8,%esp
+  80054e:	56                   	push   %esi
+  80054f:	83 ec 04             	sub    $0x4,%esp
+  800552:	ff 75 e4             	push   -0x1c(%ebp)
+  800555:	ff 75 e0             	push   -0x20(%ebp)
+  800558:	ff 75 dc             	push   -0x24(%ebp)
+  80055b:	ff 75 d8             	push   -0x28(%ebp)
+  80055e:	e8 14 44 00 00       	call   804977 <__umoddi3>
+  800563:	83 c4 14             	add    $0x14,%esp
+  800566:	0f be 80 57 4c 80 00 	movsbl 0x804c57(%eax),%eax
+  80056d:	50                   	push   %eax
+  80056e:	ff d3                	call   *%ebx
+}
+  800570:	83 c4 10             	add    $0x10,%esp
+  800573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800576:	5b                   	pop    %ebx
+  800577:	5e                   	pop    %esi
+  800578:	5f                   	pop    %edi
+  800579:	5d                   	pop    %ebp
+  80057a:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80057b:	83 ec 0c             	sub    $0xc,%esp
+  80057e:	ff 75 18             	push   0x18(%ebp)
+  800581:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800584:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800587:	52                   	push   %edx
+  800588:	50                   	push   %eax
+  800589:	83 ec 08             	sub    $0x8,%esp
+  80058c:	ff 75 e4             	push   -0x1c(%ebp)
+  80058f:	ff 75 e0             	push   -0x20(%ebp)
+  800592:	ff 75 dc             	push   -0x24(%ebp)
+  800595:	ff 75 d8             	push   -0x28(%ebp)
+  800598:	e8 14 43 00 00       	call   8048b1 <__udivdi3>
+  80059d:	83 c4 18             	add    $0x18,%esp
+  8005a0:	52                   	push   %edx
+  8005a1:	50                   	push   %eax
+  8005a2:	89 f2                	mov    %esi,%edx
+  8005a4:	89 d8                	mov    %ebx,%eax
+  8005a6:	e8 54 ff ff ff       	call   8004ff <printnum>
+  8005ab:	83 c4 20             	add    $0x20,%esp
+  8005ae:	eb 9b                	jmp    80054b <printnum+0x4c>
+
+008005b0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005b0:	55                   	push   %ebp
+  8005b1:	89 e5                	mov    %esp,%ebp
+  8005b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005ba:	8b 10                	mov    (%eax),%edx
+  8005bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005bf:	73 0a                	jae    8005cb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005c4:	89 08                	mov    %ecx,(%eax)
+  8005c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005c9:	88 02                	mov    %al,(%edx)
+}
+  8005cb:	5d                   	pop    %ebp
+  8005cc:	c3                   	ret
+
+008005cd <printfmt>:
+{
+  8005cd:	55                   	push   %ebp
+  8005ce:	89 e5                	mov    %esp,%ebp
+  8005d0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005d6:	50                   	push   %eax
+  8005d7:	ff 75 10             	push   0x10(%ebp)
+  8005da:	ff 75 0c             	push   0xc(%ebp)
+  8005dd:	ff 75 08             	push   0x8(%ebp)
+  8005e0:	e8 05 00 00 00       	call   8005ea <vprintfmt>
+}
+  8005e5:	83 c4 10             	add    $0x10,%esp
+  8005e8:	c9                   	leave
+  8005e9:	c3                   	ret
+
+008005ea <vprintfmt>:
+{
+  8005ea:	55                   	push   %ebp
+  8005eb:	89 e5                	mov    %esp,%ebp
+  8005ed:	57                   	push   %edi
+  8005ee:	56                   	push   %esi
+  8005ef:	53                   	push   %ebx
+  8005f0:	83 ec 2c             	sub    $0x2c,%esp
+  8005f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005f6:	89 df                	mov    %ebx,%edi
+  8005f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005fe:	8d 70 01             	lea    0x1(%eax),%esi
+  800601:	0f b6 00             	movzbl (%eax),%eax
+  800604:	83 f8 25             	cmp    $0x25,%eax
+  800607:	74 1e                	je     800627 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800609:	85 c0                	test   %eax,%eax
+  80060b:	0f 84 15 05 00 00    	je     800b26 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	53                   	push   %ebx
+  800615:	50                   	push   %eax
+  800616:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800618:	83 c6 01             	add    $0x1,%esi
+  80061b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80061f:	83 c4 10             	add    $0x10,%esp
+  800622:	83 f8 25             	cmp    $0x25,%eax
+  800625:	75 e2                	jne    800609 <vprintfmt+0x1f>
+		padc = ' ';
+  800627:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80062b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800632:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800639:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800645:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800648:	8d 56 01             	lea    0x1(%esi),%edx
+  80064b:	0f b6 0e             	movzbl (%esi),%ecx
+  80064e:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800651:	3c 55                	cmp    $0x55,%al
+  800653:	0f 87 3b 04 00 00    	ja     800a94 <vprintfmt+0x4aa>
+  800659:	0f b6 c0             	movzbl %al,%eax
+  80065c:	ff 24 85 c0 4d 80 00 	jmp    *0x804dc0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800663:	89 75 10             	mov    %esi,0x10(%ebp)
+  800666:	eb 93                	jmp    8005fb <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800668:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80066a:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80066e:	eb d8                	jmp    800648 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800670:	89 d6                	mov    %edx,%esi
+  800672:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800676:	eb d0                	jmp    800648 <vprintfmt+0x5e>
+  800678:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80067b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80067e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800681:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800685:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800688:	83 f9 09             	cmp    $0x9,%ecx
+  80068b:	77 6f                	ja     8006fc <vprintfmt+0x112>
+  80068d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800690:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800693:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800696:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80069a:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80069d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8006a0:	83 fe 09             	cmp    $0x9,%esi
+  8006a3:	76 eb                	jbe    800690 <vprintfmt+0xa6>
+  8006a5:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8006a8:	89 d6                	mov    %edx,%esi
+  8006aa:	eb 13                	jmp    8006bf <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 00                	mov    (%eax),%eax
+  8006b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8006b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006bd:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8006bf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006c3:	79 83                	jns    800648 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8006c5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006cb:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8006d2:	e9 71 ff ff ff       	jmp    800648 <vprintfmt+0x5e>
+			if (width < 0)
+  8006d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006da:	85 c9                	test   %ecx,%ecx
+  8006dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e1:	0f 49 c1             	cmovns %ecx,%eax
+  8006e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006e7:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006e9:	e9 5a ff ff ff       	jmp    800648 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ee:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8006f0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006f7:	e9 4c ff ff ff       	jmp    800648 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006fc:	89 d6                	mov    %edx,%esi
+  8006fe:	eb bf                	jmp    8006bf <vprintfmt+0xd5>
+			lflag++;
+  800700:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800704:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800706:	e9 3d ff ff ff       	jmp    800648 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80070b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80070e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800711:	8d 70 04             	lea    0x4(%eax),%esi
+  800714:	83 ec 08             	sub    $0x8,%esp
+  800717:	53                   	push   %ebx
+  800718:	ff 30                	push   (%eax)
+  80071a:	ff d7                	call   *%edi
+			break;
+  80071c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80071f:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800722:	e9 d4 fe ff ff       	jmp    8005fb <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800727:	89 55 10             	mov    %edx,0x10(%ebp)
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800730:	8b 10                	mov    (%eax),%edx
+  800732:	89 d0                	mov    %edx,%eax
+  800734:	f7 d8                	neg    %eax
+  800736:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800739:	83 f8 12             	cmp    $0x12,%eax
+  80073c:	7f 23                	jg     800761 <vprintfmt+0x177>
+  80073e:	8b 14 85 20 4f 80 00 	mov    0x804f20(,%eax,4),%edx
+  800745:	85 d2                	test   %edx,%edx
+  800747:	74 18                	je     800761 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800749:	52                   	push   %edx
+  80074a:	68 73 51 80 00       	push   $0x805173
+  80074f:	53                   	push   %ebx
+  800750:	57                   	push   %edi
+  800751:	e8 77 fe ff ff       	call   8005cd <printfmt>
+  800756:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800759:	89 75 14             	mov    %esi,0x14(%ebp)
+  80075c:	e9 9a fe ff ff       	jmp    8005fb <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800761:	50                   	push   %eax
+  800762:	68 6f 4c 80 00       	push   $0x804c6f
+  800767:	53                   	push   %ebx
+  800768:	57                   	push   %edi
+  800769:	e8 5f fe ff ff       	call   8005cd <printfmt>
+  80076e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800771:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800774:	e9 82 fe ff ff       	jmp    8005fb <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800779:	89 55 10             	mov    %edx,0x10(%ebp)
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	83 c0 04             	add    $0x4,%eax
+  800782:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 00                	mov    (%eax),%eax
+  80078a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80078d:	85 c0                	test   %eax,%eax
+  80078f:	0f 84 61 03 00 00    	je     800af6 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800795:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800799:	7e 06                	jle    8007a1 <vprintfmt+0x1b7>
+  80079b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80079f:	75 29                	jne    8007ca <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007a1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a4:	8d 70 01             	lea    0x1(%eax),%esi
+  8007a7:	0f b6 00             	movzbl (%eax),%eax
+  8007aa:	0f be d0             	movsbl %al,%edx
+  8007ad:	85 d2                	test   %edx,%edx
+  8007af:	0f 84 bb 00 00 00    	je     800870 <vprintfmt+0x286>
+  8007b5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007b8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007bb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007be:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c1:	eb 7a                	jmp    80083d <vprintfmt+0x253>
+				p = "(null)";
+  8007c3:	c7 45 d0 68 4c 80 00 	movl   $0x804c68,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	ff 75 d4             	push   -0x2c(%ebp)
+  8007d0:	ff 75 d0             	push   -0x30(%ebp)
+  8007d3:	e8 e0 03 00 00       	call   800bb8 <strnlen>
+  8007d8:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8007db:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8007de:	83 c4 10             	add    $0x10,%esp
+  8007e1:	85 d2                	test   %edx,%edx
+  8007e3:	0f 8e d6 02 00 00    	jle    800abf <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8007e9:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8007ed:	83 ec 08             	sub    $0x8,%esp
+  8007f0:	53                   	push   %ebx
+  8007f1:	56                   	push   %esi
+  8007f2:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007f4:	83 c4 10             	add    $0x10,%esp
+  8007f7:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8007fb:	75 f0                	jne    8007ed <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800800:	8d 70 01             	lea    0x1(%eax),%esi
+  800803:	0f b6 00             	movzbl (%eax),%eax
+  800806:	0f be d0             	movsbl %al,%edx
+  800809:	85 d2                	test   %edx,%edx
+  80080b:	0f 84 da 02 00 00    	je     800aeb <vprintfmt+0x501>
+  800811:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800814:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800817:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80081a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80081d:	eb 1e                	jmp    80083d <vprintfmt+0x253>
+					putch(ch, putdat);
+  80081f:	83 ec 08             	sub    $0x8,%esp
+  800822:	ff 75 0c             	push   0xc(%ebp)
+  800825:	52                   	push   %edx
+  800826:	ff 55 08             	call   *0x8(%ebp)
+  800829:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80082c:	83 eb 01             	sub    $0x1,%ebx
+  80082f:	83 c6 01             	add    $0x1,%esi
+  800832:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800836:	0f be d0             	movsbl %al,%edx
+  800839:	85 d2                	test   %edx,%edx
+  80083b:	74 2a                	je     800867 <vprintfmt+0x27d>
+  80083d:	85 ff                	test   %edi,%edi
+  80083f:	78 05                	js     800846 <vprintfmt+0x25c>
+  800841:	83 ef 01             	sub    $0x1,%edi
+  800844:	78 59                	js     80089f <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800846:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80084a:	74 d3                	je     80081f <vprintfmt+0x235>
+  80084c:	0f be c0             	movsbl %al,%eax
+  80084f:	83 e8 20             	sub    $0x20,%eax
+  800852:	83 f8 5e             	cmp    $0x5e,%eax
+  800855:	76 c8                	jbe    80081f <vprintfmt+0x235>
+					putch('?', putdat);
+  800857:	83 ec 08             	sub    $0x8,%esp
+  80085a:	ff 75 0c             	push   0xc(%ebp)
+  80085d:	6a 3f                	push   $0x3f
+  80085f:	ff 55 08             	call   *0x8(%ebp)
+  800862:	83 c4 10             	add    $0x10,%esp
+  800865:	eb c5                	jmp    80082c <vprintfmt+0x242>
+  800867:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80086a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80086d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800870:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800873:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800877:	7e 1b                	jle    800894 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800879:	83 ec 08             	sub    $0x8,%esp
+  80087c:	53                   	push   %ebx
+  80087d:	6a 20                	push   $0x20
+  80087f:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800881:	83 c4 10             	add    $0x10,%esp
+  800884:	83 ee 01             	sub    $0x1,%esi
+  800887:	75 f0                	jne    800879 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800889:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088f:	e9 67 fd ff ff       	jmp    8005fb <vprintfmt+0x11>
+  800894:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800897:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089a:	e9 5c fd ff ff       	jmp    8005fb <vprintfmt+0x11>
+  80089f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8008a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008a8:	eb c6                	jmp    800870 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8008aa:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008ad:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b0:	83 f9 01             	cmp    $0x1,%ecx
+  8008b3:	7f 1f                	jg     8008d4 <vprintfmt+0x2ea>
+	else if (lflag)
+  8008b5:	85 c9                	test   %ecx,%ecx
+  8008b7:	74 67                	je     800920 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8008b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bc:	8b 30                	mov    (%eax),%esi
+  8008be:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008c1:	89 f0                	mov    %esi,%eax
+  8008c3:	c1 f8 1f             	sar    $0x1f,%eax
+  8008c6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008d2:	eb 17                	jmp    8008eb <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8008d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d7:	8b 50 04             	mov    0x4(%eax),%edx
+  8008da:	8b 00                	mov    (%eax),%eax
+  8008dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008eb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008ee:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008f1:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8008f6:	85 c9                	test   %ecx,%ecx
+  8008f8:	0f 89 12 01 00 00    	jns    800a10 <vprintfmt+0x426>
+				putch('-', putdat);
+  8008fe:	83 ec 08             	sub    $0x8,%esp
+  800901:	53                   	push   %ebx
+  800902:	6a 2d                	push   $0x2d
+  800904:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800906:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800909:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80090c:	f7 da                	neg    %edx
+  80090e:	83 d1 00             	adc    $0x0,%ecx
+  800911:	f7 d9                	neg    %ecx
+  800913:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800916:	be 0a 00 00 00       	mov    $0xa,%esi
+  80091b:	e9 f0 00 00 00       	jmp    800a10 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800920:	8b 45 14             	mov    0x14(%ebp),%eax
+  800923:	8b 30                	mov    (%eax),%esi
+  800925:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800928:	89 f0                	mov    %esi,%eax
+  80092a:	c1 f8 1f             	sar    $0x1f,%eax
+  80092d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800930:	8b 45 14             	mov    0x14(%ebp),%eax
+  800933:	8d 40 04             	lea    0x4(%eax),%eax
+  800936:	89 45 14             	mov    %eax,0x14(%ebp)
+  800939:	eb b0                	jmp    8008eb <vprintfmt+0x301>
+	if (lflag >= 2)
+  80093b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80093e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800941:	83 f9 01             	cmp    $0x1,%ecx
+  800944:	7f 1e                	jg     800964 <vprintfmt+0x37a>
+	else if (lflag)
+  800946:	85 c9                	test   %ecx,%ecx
+  800948:	74 32                	je     80097c <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80094a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094d:	8b 10                	mov    (%eax),%edx
+  80094f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800954:	8d 40 04             	lea    0x4(%eax),%eax
+  800957:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80095a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80095f:	e9 ac 00 00 00       	jmp    800a10 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800964:	8b 45 14             	mov    0x14(%ebp),%eax
+  800967:	8b 10                	mov    (%eax),%edx
+  800969:	8b 48 04             	mov    0x4(%eax),%ecx
+  80096c:	8d 40 08             	lea    0x8(%eax),%eax
+  80096f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800972:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800977:	e9 94 00 00 00       	jmp    800a10 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80097c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097f:	8b 10                	mov    (%eax),%edx
+  800981:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800986:	8d 40 04             	lea    0x4(%eax),%eax
+  800989:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80098c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800991:	eb 7d                	jmp    800a10 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800993:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800996:	89 55 10             	mov    %edx,0x10(%ebp)
+  800999:	83 f9 01             	cmp    $0x1,%ecx
+  80099c:	7f 1b                	jg     8009b9 <vprintfmt+0x3cf>
+	else if (lflag)
+  80099e:	85 c9                	test   %ecx,%ecx
+  8009a0:	74 2c                	je     8009ce <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8009a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a5:	8b 10                	mov    (%eax),%edx
+  8009a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8009af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009b2:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8009b7:	eb 57                	jmp    800a10 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bc:	8b 10                	mov    (%eax),%edx
+  8009be:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009c1:	8d 40 08             	lea    0x8(%eax),%eax
+  8009c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009c7:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8009cc:	eb 42                	jmp    800a10 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d1:	8b 10                	mov    (%eax),%edx
+  8009d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009de:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8009e3:	eb 2b                	jmp    800a10 <vprintfmt+0x426>
+			putch('0', putdat);
+  8009e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009e8:	83 ec 08             	sub    $0x8,%esp
+  8009eb:	53                   	push   %ebx
+  8009ec:	6a 30                	push   $0x30
+  8009ee:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8009f0:	83 c4 08             	add    $0x8,%esp
+  8009f3:	53                   	push   %ebx
+  8009f4:	6a 78                	push   $0x78
+  8009f6:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8009f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fb:	8b 10                	mov    (%eax),%edx
+  8009fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a02:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a05:	8d 40 04             	lea    0x4(%eax),%eax
+  800a08:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a0b:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800a10:	83 ec 0c             	sub    $0xc,%esp
+  800a13:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800a17:	50                   	push   %eax
+  800a18:	ff 75 e4             	push   -0x1c(%ebp)
+  800a1b:	56                   	push   %esi
+  800a1c:	51                   	push   %ecx
+  800a1d:	52                   	push   %edx
+  800a1e:	89 da                	mov    %ebx,%edx
+  800a20:	89 f8                	mov    %edi,%eax
+  800a22:	e8 d8 fa ff ff       	call   8004ff <printnum>
+			break;
+  800a27:	83 c4 20             	add    $0x20,%esp
+  800a2a:	e9 cc fb ff ff       	jmp    8005fb <vprintfmt+0x11>
+	if (lflag >= 2)
+  800a2f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a32:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a35:	83 f9 01             	cmp    $0x1,%ecx
+  800a38:	7f 1b                	jg     800a55 <vprintfmt+0x46b>
+	else if (lflag)
+  800a3a:	85 c9                	test   %ecx,%ecx
+  800a3c:	74 2c                	je     800a6a <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800a3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a41:	8b 10                	mov    (%eax),%edx
+  800a43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a48:	8d 40 04             	lea    0x4(%eax),%eax
+  800a4b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a4e:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800a53:	eb bb                	jmp    800a10 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a55:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a58:	8b 10                	mov    (%eax),%edx
+  800a5a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a5d:	8d 40 08             	lea    0x8(%eax),%eax
+  800a60:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a63:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800a68:	eb a6                	jmp    800a10 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6d:	8b 10                	mov    (%eax),%edx
+  800a6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a74:	8d 40 04             	lea    0x4(%eax),%eax
+  800a77:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a7a:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800a7f:	eb 8f                	jmp    800a10 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800a81:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a84:	83 ec 08             	sub    $0x8,%esp
+  800a87:	53                   	push   %ebx
+  800a88:	6a 25                	push   $0x25
+  800a8a:	ff d7                	call   *%edi
+			break;
+  800a8c:	83 c4 10             	add    $0x10,%esp
+  800a8f:	e9 67 fb ff ff       	jmp    8005fb <vprintfmt+0x11>
+			putch('%', putdat);
+  800a94:	83 ec 08             	sub    $0x8,%esp
+  800a97:	53                   	push   %ebx
+  800a98:	6a 25                	push   $0x25
+  800a9a:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a9c:	83 c4 10             	add    $0x10,%esp
+  800a9f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800aa3:	0f 84 ba fb ff ff    	je     800663 <vprintfmt+0x79>
+  800aa9:	89 75 10             	mov    %esi,0x10(%ebp)
+  800aac:	89 f0                	mov    %esi,%eax
+  800aae:	83 e8 01             	sub    $0x1,%eax
+  800ab1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800ab5:	75 f7                	jne    800aae <vprintfmt+0x4c4>
+  800ab7:	89 45 10             	mov    %eax,0x10(%ebp)
+  800aba:	e9 3c fb ff ff       	jmp    8005fb <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800abf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ac2:	8d 70 01             	lea    0x1(%eax),%esi
+  800ac5:	0f b6 00             	movzbl (%eax),%eax
+  800ac8:	0f be d0             	movsbl %al,%edx
+  800acb:	85 d2                	test   %edx,%edx
+  800acd:	74 11                	je     800ae0 <vprintfmt+0x4f6>
+  800acf:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ad2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ad5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ad8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800adb:	e9 5d fd ff ff       	jmp    80083d <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ae0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ae3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ae6:	e9 10 fb ff ff       	jmp    8005fb <vprintfmt+0x11>
+  800aeb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800aee:	89 45 14             	mov    %eax,0x14(%ebp)
+  800af1:	e9 05 fb ff ff       	jmp    8005fb <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800af6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800afa:	7e 0a                	jle    800b06 <vprintfmt+0x51c>
+  800afc:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800b00:	0f 85 bd fc ff ff    	jne    8007c3 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b06:	ba 28 00 00 00       	mov    $0x28,%edx
+  800b0b:	b8 28 00 00 00       	mov    $0x28,%eax
+  800b10:	be 69 4c 80 00       	mov    $0x804c69,%esi
+  800b15:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b18:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b1b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b1e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b21:	e9 17 fd ff ff       	jmp    80083d <vprintfmt+0x253>
+}
+  800b26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b29:	5b                   	pop    %ebx
+  800b2a:	5e                   	pop    %esi
+  800b2b:	5f                   	pop    %edi
+  800b2c:	5d                   	pop    %ebp
+  800b2d:	c3                   	ret
+
+00800b2e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	83 ec 18             	sub    $0x18,%esp
+  800b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b37:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b3a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b3d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b41:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b44:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b4b:	85 c0                	test   %eax,%eax
+  800b4d:	74 26                	je     800b75 <vsnprintf+0x47>
+  800b4f:	85 d2                	test   %edx,%edx
+  800b51:	7e 22                	jle    800b75 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b53:	ff 75 14             	push   0x14(%ebp)
+  800b56:	ff 75 10             	push   0x10(%ebp)
+  800b59:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b5c:	50                   	push   %eax
+  800b5d:	68 b0 05 80 00       	push   $0x8005b0
+  800b62:	e8 83 fa ff ff       	call   8005ea <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b6a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b70:	83 c4 10             	add    $0x10,%esp
+}
+  800b73:	c9                   	leave
+  800b74:	c3                   	ret
+		return -E_INVAL;
+  800b75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b7a:	eb f7                	jmp    800b73 <vsnprintf+0x45>
+
+00800b7c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b7c:	55                   	push   %ebp
+  800b7d:	89 e5                	mov    %esp,%ebp
+  800b7f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b82:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b85:	50                   	push   %eax
+  800b86:	ff 75 10             	push   0x10(%ebp)
+  800b89:	ff 75 0c             	push   0xc(%ebp)
+  800b8c:	ff 75 08             	push   0x8(%ebp)
+  800b8f:	e8 9a ff ff ff       	call   800b2e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b94:	c9                   	leave
+  800b95:	c3                   	ret
+
+00800b96 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b96:	55                   	push   %ebp
+  800b97:	89 e5                	mov    %esp,%ebp
+  800b99:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b9c:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b9f:	74 10                	je     800bb1 <strlen+0x1b>
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800ba6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ba9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bad:	75 f7                	jne    800ba6 <strlen+0x10>
+	return n;
+}
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800bb6:	eb f7                	jmp    800baf <strlen+0x19>
+
+00800bb8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bbe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bc1:	85 d2                	test   %edx,%edx
+  800bc3:	74 16                	je     800bdb <strnlen+0x23>
+  800bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bca:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bce:	74 09                	je     800bd9 <strnlen+0x21>
+		n++;
+  800bd0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bd3:	39 d0                	cmp    %edx,%eax
+  800bd5:	75 f3                	jne    800bca <strnlen+0x12>
+		n++;
+  800bd7:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be0:	eb f7                	jmp    800bd9 <strnlen+0x21>
+
+00800be2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	53                   	push   %ebx
+  800be6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800be9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bf5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bf8:	83 c0 01             	add    $0x1,%eax
+  800bfb:	84 d2                	test   %dl,%dl
+  800bfd:	75 f2                	jne    800bf1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bff:	89 c8                	mov    %ecx,%eax
+  800c01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+
+00800c06 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	53                   	push   %ebx
+  800c0a:	83 ec 10             	sub    $0x10,%esp
+  800c0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c10:	53                   	push   %ebx
+  800c11:	e8 80 ff ff ff       	call   800b96 <strlen>
+  800c16:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c19:	ff 75 0c             	push   0xc(%ebp)
+  800c1c:	01 d8                	add    %ebx,%eax
+  800c1e:	50                   	push   %eax
+  800c1f:	e8 be ff ff ff       	call   800be2 <strcpy>
+	return dst;
+}
+  800c24:	89 d8                	mov    %ebx,%eax
+  800c26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c29:	c9                   	leave
+  800c2a:	c3                   	ret
+
+00800c2b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	56                   	push   %esi
+  800c2f:	53                   	push   %ebx
+  800c30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c39:	85 db                	test   %ebx,%ebx
+  800c3b:	74 17                	je     800c54 <strncpy+0x29>
+  800c3d:	01 f3                	add    %esi,%ebx
+  800c3f:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800c41:	83 c0 01             	add    $0x1,%eax
+  800c44:	0f b6 0a             	movzbl (%edx),%ecx
+  800c47:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c4a:	80 f9 01             	cmp    $0x1,%cl
+  800c4d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c50:	39 c3                	cmp    %eax,%ebx
+  800c52:	75 ed                	jne    800c41 <strncpy+0x16>
+	}
+	return ret;
+}
+  800c54:	89 f0                	mov    %esi,%eax
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5d                   	pop    %ebp
+  800c59:	c3                   	ret
+
+00800c5a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c5a:	55                   	push   %ebp
+  800c5b:	89 e5                	mov    %esp,%ebp
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+  800c5f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c68:	89 f0                	mov    %esi,%eax
+  800c6a:	85 db                	test   %ebx,%ebx
+  800c6c:	74 1e                	je     800c8c <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800c6e:	83 eb 01             	sub    $0x1,%ebx
+  800c71:	74 16                	je     800c89 <strlcpy+0x2f>
+  800c73:	01 f3                	add    %esi,%ebx
+  800c75:	0f b6 0a             	movzbl (%edx),%ecx
+  800c78:	84 c9                	test   %cl,%cl
+  800c7a:	74 0d                	je     800c89 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800c7c:	83 c2 01             	add    $0x1,%edx
+  800c7f:	83 c0 01             	add    $0x1,%eax
+  800c82:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800c85:	39 d8                	cmp    %ebx,%eax
+  800c87:	75 ec                	jne    800c75 <strlcpy+0x1b>
+		*dst = '\0';
+  800c89:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c8c:	29 f0                	sub    %esi,%eax
+}
+  800c8e:	5b                   	pop    %ebx
+  800c8f:	5e                   	pop    %esi
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+
+00800c92 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c98:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c9b:	0f b6 01             	movzbl (%ecx),%eax
+  800c9e:	84 c0                	test   %al,%al
+  800ca0:	74 11                	je     800cb3 <strcmp+0x21>
+  800ca2:	38 02                	cmp    %al,(%edx)
+  800ca4:	75 0d                	jne    800cb3 <strcmp+0x21>
+		p++, q++;
+  800ca6:	83 c1 01             	add    $0x1,%ecx
+  800ca9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800cac:	0f b6 01             	movzbl (%ecx),%eax
+  800caf:	84 c0                	test   %al,%al
+  800cb1:	75 ef                	jne    800ca2 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cb3:	0f b6 c0             	movzbl %al,%eax
+  800cb6:	0f b6 12             	movzbl (%edx),%edx
+  800cb9:	29 d0                	sub    %edx,%eax
+}
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+
+00800cbd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	53                   	push   %ebx
+  800cc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cc4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cc7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800ccf:	85 d2                	test   %edx,%edx
+  800cd1:	74 2e                	je     800d01 <strncmp+0x44>
+  800cd3:	0f b6 01             	movzbl (%ecx),%eax
+  800cd6:	84 c0                	test   %al,%al
+  800cd8:	74 16                	je     800cf0 <strncmp+0x33>
+  800cda:	3a 03                	cmp    (%ebx),%al
+  800cdc:	75 12                	jne    800cf0 <strncmp+0x33>
+		n--, p++, q++;
+  800cde:	83 c1 01             	add    $0x1,%ecx
+  800ce1:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800ce4:	83 ea 01             	sub    $0x1,%edx
+  800ce7:	75 ea                	jne    800cd3 <strncmp+0x16>
+		return 0;
+  800ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cee:	eb 11                	jmp    800d01 <strncmp+0x44>
+  800cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800cf5:	85 d2                	test   %edx,%edx
+  800cf7:	74 08                	je     800d01 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cf9:	0f b6 01             	movzbl (%ecx),%eax
+  800cfc:	0f b6 13             	movzbl (%ebx),%edx
+  800cff:	29 d0                	sub    %edx,%eax
+}
+  800d01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d04:	c9                   	leave
+  800d05:	c3                   	ret
+
+00800d06 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d10:	0f b6 10             	movzbl (%eax),%edx
+  800d13:	84 d2                	test   %dl,%dl
+  800d15:	74 15                	je     800d2c <strchr+0x26>
+		if (*s == c)
+  800d17:	38 d1                	cmp    %dl,%cl
+  800d19:	74 0f                	je     800d2a <strchr+0x24>
+	for (; *s; s++)
+  800d1b:	83 c0 01             	add    $0x1,%eax
+  800d1e:	0f b6 10             	movzbl (%eax),%edx
+  800d21:	84 d2                	test   %dl,%dl
+  800d23:	75 f2                	jne    800d17 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800d25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+	return 0;
+  800d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d31:	eb f7                	jmp    800d2a <strchr+0x24>
+
+00800d33 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	53                   	push   %ebx
+  800d37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800d3d:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800d40:	38 d3                	cmp    %dl,%bl
+  800d42:	74 14                	je     800d58 <strfind+0x25>
+  800d44:	89 d1                	mov    %edx,%ecx
+  800d46:	84 db                	test   %bl,%bl
+  800d48:	74 0e                	je     800d58 <strfind+0x25>
+	for (; *s; s++)
+  800d4a:	83 c0 01             	add    $0x1,%eax
+  800d4d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d50:	38 ca                	cmp    %cl,%dl
+  800d52:	74 04                	je     800d58 <strfind+0x25>
+  800d54:	84 d2                	test   %dl,%dl
+  800d56:	75 f2                	jne    800d4a <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800d58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d5b:	c9                   	leave
+  800d5c:	c3                   	ret
+
+00800d5d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d64:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d67:	85 c9                	test   %ecx,%ecx
+  800d69:	74 20                	je     800d8b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d6b:	89 f8                	mov    %edi,%eax
+  800d6d:	09 c8                	or     %ecx,%eax
+  800d6f:	a8 03                	test   $0x3,%al
+  800d71:	75 12                	jne    800d85 <memset+0x28>
+		c &= 0xFF;
+  800d73:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d77:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d7d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d80:	fc                   	cld
+  800d81:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d83:	eb 06                	jmp    800d8b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d88:	fc                   	cld
+  800d89:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d8b:	89 f8                	mov    %edi,%eax
+  800d8d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d90:	c9                   	leave
+  800d91:	c3                   	ret
+
+00800d92 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	57                   	push   %edi
+  800d96:	56                   	push   %esi
+  800d97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d9d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800da0:	39 c6                	cmp    %eax,%esi
+  800da2:	73 32                	jae    800dd6 <memmove+0x44>
+  800da4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800da7:	39 d0                	cmp    %edx,%eax
+  800da9:	73 2b                	jae    800dd6 <memmove+0x44>
+		s += n;
+		d += n;
+  800dab:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dae:	89 d6                	mov    %edx,%esi
+  800db0:	09 fe                	or     %edi,%esi
+  800db2:	09 ce                	or     %ecx,%esi
+  800db4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800dba:	75 0e                	jne    800dca <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800dbc:	83 ef 04             	sub    $0x4,%edi
+  800dbf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800dc2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800dc5:	fd                   	std
+  800dc6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dc8:	eb 09                	jmp    800dd3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dca:	83 ef 01             	sub    $0x1,%edi
+  800dcd:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dd0:	fd                   	std
+  800dd1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dd3:	fc                   	cld
+  800dd4:	eb 1a                	jmp    800df0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dd6:	89 f2                	mov    %esi,%edx
+  800dd8:	09 c2                	or     %eax,%edx
+  800dda:	09 ca                	or     %ecx,%edx
+  800ddc:	f6 c2 03             	test   $0x3,%dl
+  800ddf:	75 0a                	jne    800deb <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800de1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800de4:	89 c7                	mov    %eax,%edi
+  800de6:	fc                   	cld
+  800de7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800de9:	eb 05                	jmp    800df0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800deb:	89 c7                	mov    %eax,%edi
+  800ded:	fc                   	cld
+  800dee:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dfa:	ff 75 10             	push   0x10(%ebp)
+  800dfd:	ff 75 0c             	push   0xc(%ebp)
+  800e00:	ff 75 08             	push   0x8(%ebp)
+  800e03:	e8 8a ff ff ff       	call   800d92 <memmove>
+}
+  800e08:	c9                   	leave
+  800e09:	c3                   	ret
+
+00800e0a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	56                   	push   %esi
+  800e0e:	53                   	push   %ebx
+  800e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e15:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e18:	85 f6                	test   %esi,%esi
+  800e1a:	74 29                	je     800e45 <memcmp+0x3b>
+  800e1c:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800e1e:	0f b6 08             	movzbl (%eax),%ecx
+  800e21:	0f b6 1a             	movzbl (%edx),%ebx
+  800e24:	38 d9                	cmp    %bl,%cl
+  800e26:	75 11                	jne    800e39 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e28:	83 c0 01             	add    $0x1,%eax
+  800e2b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e2e:	39 c6                	cmp    %eax,%esi
+  800e30:	75 ec                	jne    800e1e <memcmp+0x14>
+	}
+
+	return 0;
+  800e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e37:	eb 08                	jmp    800e41 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800e39:	0f b6 c1             	movzbl %cl,%eax
+  800e3c:	0f b6 db             	movzbl %bl,%ebx
+  800e3f:	29 d8                	sub    %ebx,%eax
+}
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5d                   	pop    %ebp
+  800e44:	c3                   	ret
+	return 0;
+  800e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4a:	eb f5                	jmp    800e41 <memcmp+0x37>
+
+00800e4c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e55:	89 c2                	mov    %eax,%edx
+  800e57:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e5a:	39 d0                	cmp    %edx,%eax
+  800e5c:	73 0d                	jae    800e6b <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e5e:	38 08                	cmp    %cl,(%eax)
+  800e60:	74 0d                	je     800e6f <memfind+0x23>
+	for (; s < ends; s++)
+  800e62:	83 c0 01             	add    $0x1,%eax
+  800e65:	39 c2                	cmp    %eax,%edx
+  800e67:	75 f5                	jne    800e5e <memfind+0x12>
+  800e69:	eb 06                	jmp    800e71 <memfind+0x25>
+  800e6b:	89 c2                	mov    %eax,%edx
+  800e6d:	eb 02                	jmp    800e71 <memfind+0x25>
+  800e6f:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800e71:	89 d0                	mov    %edx,%eax
+  800e73:	5d                   	pop    %ebp
+  800e74:	c3                   	ret
+
+00800e75 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e75:	55                   	push   %ebp
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	57                   	push   %edi
+  800e79:	56                   	push   %esi
+  800e7a:	53                   	push   %ebx
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e81:	0f b6 02             	movzbl (%edx),%eax
+  800e84:	3c 20                	cmp    $0x20,%al
+  800e86:	74 04                	je     800e8c <strtol+0x17>
+  800e88:	3c 09                	cmp    $0x9,%al
+  800e8a:	75 0e                	jne    800e9a <strtol+0x25>
+		s++;
+  800e8c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e8f:	0f b6 02             	movzbl (%edx),%eax
+  800e92:	3c 20                	cmp    $0x20,%al
+  800e94:	74 f6                	je     800e8c <strtol+0x17>
+  800e96:	3c 09                	cmp    $0x9,%al
+  800e98:	74 f2                	je     800e8c <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e9a:	3c 2b                	cmp    $0x2b,%al
+  800e9c:	74 2a                	je     800ec8 <strtol+0x53>
+	int neg = 0;
+  800e9e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ea3:	3c 2d                	cmp    $0x2d,%al
+  800ea5:	74 2b                	je     800ed2 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ea7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ead:	75 0f                	jne    800ebe <strtol+0x49>
+  800eaf:	80 3a 30             	cmpb   $0x30,(%edx)
+  800eb2:	74 28                	je     800edc <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800eb4:	85 db                	test   %ebx,%ebx
+  800eb6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ebb:	0f 44 d8             	cmove  %eax,%ebx
+  800ebe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ec3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ec6:	eb 46                	jmp    800f0e <strtol+0x99>
+		s++;
+  800ec8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ecb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ed0:	eb d5                	jmp    800ea7 <strtol+0x32>
+		s++, neg = 1;
+  800ed2:	83 c2 01             	add    $0x1,%edx
+  800ed5:	bf 01 00 00 00       	mov    $0x1,%edi
+  800eda:	eb cb                	jmp    800ea7 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800edc:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ee0:	74 0e                	je     800ef0 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800ee2:	85 db                	test   %ebx,%ebx
+  800ee4:	75 d8                	jne    800ebe <strtol+0x49>
+		s++, base = 8;
+  800ee6:	83 c2 01             	add    $0x1,%edx
+  800ee9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800eee:	eb ce                	jmp    800ebe <strtol+0x49>
+		s += 2, base = 16;
+  800ef0:	83 c2 02             	add    $0x2,%edx
+  800ef3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ef8:	eb c4                	jmp    800ebe <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800efa:	0f be c0             	movsbl %al,%eax
+  800efd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800f00:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f03:	7d 3a                	jge    800f3f <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800f05:	83 c2 01             	add    $0x1,%edx
+  800f08:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f0c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800f0e:	0f b6 02             	movzbl (%edx),%eax
+  800f11:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f14:	89 f3                	mov    %esi,%ebx
+  800f16:	80 fb 09             	cmp    $0x9,%bl
+  800f19:	76 df                	jbe    800efa <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800f1b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f1e:	89 f3                	mov    %esi,%ebx
+  800f20:	80 fb 19             	cmp    $0x19,%bl
+  800f23:	77 08                	ja     800f2d <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800f25:	0f be c0             	movsbl %al,%eax
+  800f28:	83 e8 57             	sub    $0x57,%eax
+  800f2b:	eb d3                	jmp    800f00 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f2d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f30:	89 f3                	mov    %esi,%ebx
+  800f32:	80 fb 19             	cmp    $0x19,%bl
+  800f35:	77 08                	ja     800f3f <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800f37:	0f be c0             	movsbl %al,%eax
+  800f3a:	83 e8 37             	sub    $0x37,%eax
+  800f3d:	eb c1                	jmp    800f00 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f3f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f43:	74 05                	je     800f4a <strtol+0xd5>
+		*endptr = (char *) s;
+  800f45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f48:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f4a:	89 c8                	mov    %ecx,%eax
+  800f4c:	f7 d8                	neg    %eax
+  800f4e:	85 ff                	test   %edi,%edi
+  800f50:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f53:	89 c8                	mov    %ecx,%eax
+  800f55:	5b                   	pop    %ebx
+  800f56:	5e                   	pop    %esi
+  800f57:	5f                   	pop    %edi
+  800f58:	5d                   	pop    %ebp
+  800f59:	c3                   	ret
+
+00800f5a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	56                   	push   %esi
+  800f5f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6b:	89 c3                	mov    %eax,%ebx
+  800f6d:	89 c7                	mov    %eax,%edi
+  800f6f:	89 c6                	mov    %eax,%esi
+  800f71:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f73:	5b                   	pop    %ebx
+  800f74:	5e                   	pop    %esi
+  800f75:	5f                   	pop    %edi
+  800f76:	5d                   	pop    %ebp
+  800f77:	c3                   	ret
+
+00800f78 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	57                   	push   %edi
+  800f7c:	56                   	push   %esi
+  800f7d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f88:	89 d1                	mov    %edx,%ecx
+  800f8a:	89 d3                	mov    %edx,%ebx
+  800f8c:	89 d7                	mov    %edx,%edi
+  800f8e:	89 d6                	mov    %edx,%esi
+  800f90:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+
+00800f97 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	56                   	push   %esi
+  800f9c:	53                   	push   %ebx
+  800f9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fad:	89 cb                	mov    %ecx,%ebx
+  800faf:	89 cf                	mov    %ecx,%edi
+  800fb1:	89 ce                	mov    %ecx,%esi
+  800fb3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	7f 08                	jg     800fc1 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+  800fc4:	50                   	push   %eax
+  800fc5:	6a 03                	push   $0x3
+  800fc7:	68 8b 4f 80 00       	push   $0x804f8b
+  800fcc:	6a 23                	push   $0x23
+  800fce:	68 a8 4f 80 00       	push   $0x804fa8
+  800fd3:	e8 38 f4 ff ff       	call   800410 <_panic>
+
+00800fd8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	56                   	push   %esi
+  800fdd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fe8:	89 d1                	mov    %edx,%ecx
+  800fea:	89 d3                	mov    %edx,%ebx
+  800fec:	89 d7                	mov    %edx,%edi
+  800fee:	89 d6                	mov    %edx,%esi
+  800ff0:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ff2:	5b                   	pop    %ebx
+  800ff3:	5e                   	pop    %esi
+  800ff4:	5f                   	pop    %edi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	c3                   	ret
+
+00800ff7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+  800ffa:	57                   	push   %edi
+  800ffb:	56                   	push   %esi
+  800ffc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801002:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801007:	89 d1                	mov    %edx,%ecx
+  801009:	89 d3                	mov    %edx,%ebx
+  80100b:	89 d7                	mov    %edx,%edi
+  80100d:	89 d6                	mov    %edx,%esi
+  80100f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80101f:	be 00 00 00 00       	mov    $0x0,%esi
+  801024:	8b 55 08             	mov    0x8(%ebp),%edx
+  801027:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80102f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801032:	89 f7                	mov    %esi,%edi
+  801034:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801036:	85 c0                	test   %eax,%eax
+  801038:	7f 08                	jg     801042 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80103a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801042:	83 ec 0c             	sub    $0xc,%esp
+  801045:	50                   	push   %eax
+  801046:	6a 04                	push   $0x4
+  801048:	68 8b 4f 80 00       	push   $0x804f8b
+  80104d:	6a 23                	push   $0x23
+  80104f:	68 a8 4f 80 00       	push   $0x804fa8
+  801054:	e8 b7 f3 ff ff       	call   800410 <_panic>
+
+00801059 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	56                   	push   %esi
+  80105e:	53                   	push   %ebx
+  80105f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801062:	8b 55 08             	mov    0x8(%ebp),%edx
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	b8 05 00 00 00       	mov    $0x5,%eax
+  80106d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801070:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801073:	8b 75 18             	mov    0x18(%ebp),%esi
+  801076:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801078:	85 c0                	test   %eax,%eax
+  80107a:	7f 08                	jg     801084 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80107c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107f:	5b                   	pop    %ebx
+  801080:	5e                   	pop    %esi
+  801081:	5f                   	pop    %edi
+  801082:	5d                   	pop    %ebp
+  801083:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  801087:	50                   	push   %eax
+  801088:	6a 05                	push   $0x5
+  80108a:	68 8b 4f 80 00       	push   $0x804f8b
+  80108f:	6a 23                	push   $0x23
+  801091:	68 a8 4f 80 00       	push   $0x804fa8
+  801096:	e8 75 f3 ff ff       	call   800410 <_panic>
+
+0080109b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	57                   	push   %edi
+  80109f:	56                   	push   %esi
+  8010a0:	53                   	push   %ebx
+  8010a1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010b4:	89 df                	mov    %ebx,%edi
+  8010b6:	89 de                	mov    %ebx,%esi
+  8010b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ba:	85 c0                	test   %eax,%eax
+  8010bc:	7f 08                	jg     8010c6 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c6:	83 ec 0c             	sub    $0xc,%esp
+  8010c9:	50                   	push   %eax
+  8010ca:	6a 06                	push   $0x6
+  8010cc:	68 8b 4f 80 00       	push   $0x804f8b
+  8010d1:	6a 23                	push   $0x23
+  8010d3:	68 a8 4f 80 00       	push   $0x804fa8
+  8010d8:	e8 33 f3 ff ff       	call   800410 <_panic>
+
+008010dd <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010dd:	55                   	push   %ebp
+  8010de:	89 e5                	mov    %esp,%ebp
+  8010e0:	57                   	push   %edi
+  8010e1:	56                   	push   %esi
+  8010e2:	53                   	push   %ebx
+  8010e3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010f6:	89 df                	mov    %ebx,%edi
+  8010f8:	89 de                	mov    %ebx,%esi
+  8010fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010fc:	85 c0                	test   %eax,%eax
+  8010fe:	7f 08                	jg     801108 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801103:	5b                   	pop    %ebx
+  801104:	5e                   	pop    %esi
+  801105:	5f                   	pop    %edi
+  801106:	5d                   	pop    %ebp
+  801107:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  80110b:	50                   	push   %eax
+  80110c:	6a 08                	push   $0x8
+  80110e:	68 8b 4f 80 00       	push   $0x804f8b
+  801113:	6a 23                	push   $0x23
+  801115:	68 a8 4f 80 00       	push   $0x804fa8
+  80111a:	e8 f1 f2 ff ff       	call   800410 <_panic>
+
+0080111f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80111f:	55                   	push   %ebp
+  801120:	89 e5                	mov    %esp,%ebp
+  801122:	57                   	push   %edi
+  801123:	56                   	push   %esi
+  801124:	53                   	push   %ebx
+  801125:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801128:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801130:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801133:	b8 09 00 00 00       	mov    $0x9,%eax
+  801138:	89 df                	mov    %ebx,%edi
+  80113a:	89 de                	mov    %ebx,%esi
+  80113c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80113e:	85 c0                	test   %eax,%eax
+  801140:	7f 08                	jg     80114a <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801142:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801145:	5b                   	pop    %ebx
+  801146:	5e                   	pop    %esi
+  801147:	5f                   	pop    %edi
+  801148:	5d                   	pop    %ebp
+  801149:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114a:	83 ec 0c             	sub    $0xc,%esp
+  80114d:	50                   	push   %eax
+  80114e:	6a 09                	push   $0x9
+  801150:	68 8b 4f 80 00       	push   $0x804f8b
+  801155:	6a 23                	push   $0x23
+  801157:	68 a8 4f 80 00       	push   $0x804fa8
+  80115c:	e8 af f2 ff ff       	call   800410 <_panic>
+
+00801161 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	57                   	push   %edi
+  801165:	56                   	push   %esi
+  801166:	53                   	push   %ebx
+  801167:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80116a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801172:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801175:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80117a:	89 df                	mov    %ebx,%edi
+  80117c:	89 de                	mov    %ebx,%esi
+  80117e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801180:	85 c0                	test   %eax,%eax
+  801182:	7f 08                	jg     80118c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801184:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801187:	5b                   	pop    %ebx
+  801188:	5e                   	pop    %esi
+  801189:	5f                   	pop    %edi
+  80118a:	5d                   	pop    %ebp
+  80118b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118c:	83 ec 0c             	sub    $0xc,%esp
+  80118f:	50                   	push   %eax
+  801190:	6a 0a                	push   $0xa
+  801192:	68 8b 4f 80 00       	push   $0x804f8b
+  801197:	6a 23                	push   $0x23
+  801199:	68 a8 4f 80 00       	push   $0x804fa8
+  80119e:	e8 6d f2 ff ff       	call   800410 <_panic>
+
+008011a3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	56                   	push   %esi
+  8011a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011af:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011bf:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011c1:	5b                   	pop    %ebx
+  8011c2:	5e                   	pop    %esi
+  8011c3:	5f                   	pop    %edi
+  8011c4:	5d                   	pop    %ebp
+  8011c5:	c3                   	ret
+
+008011c6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	57                   	push   %edi
+  8011ca:	56                   	push   %esi
+  8011cb:	53                   	push   %ebx
+  8011cc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011dc:	89 cb                	mov    %ecx,%ebx
+  8011de:	89 cf                	mov    %ecx,%edi
+  8011e0:	89 ce                	mov    %ecx,%esi
+  8011e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e4:	85 c0                	test   %eax,%eax
+  8011e6:	7f 08                	jg     8011f0 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011eb:	5b                   	pop    %ebx
+  8011ec:	5e                   	pop    %esi
+  8011ed:	5f                   	pop    %edi
+  8011ee:	5d                   	pop    %ebp
+  8011ef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f0:	83 ec 0c             	sub    $0xc,%esp
+  8011f3:	50                   	push   %eax
+  8011f4:	6a 0d                	push   $0xd
+  8011f6:	68 8b 4f 80 00       	push   $0x804f8b
+  8011fb:	6a 23                	push   $0x23
+  8011fd:	68 a8 4f 80 00       	push   $0x804fa8
+  801202:	e8 09 f2 ff ff       	call   800410 <_panic>
+
+00801207 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	57                   	push   %edi
+  80120b:	56                   	push   %esi
+  80120c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801210:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801213:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801218:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801221:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801223:	5b                   	pop    %ebx
+  801224:	5e                   	pop    %esi
+  801225:	5f                   	pop    %edi
+  801226:	5d                   	pop    %ebp
+  801227:	c3                   	ret
+
+00801228 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	57                   	push   %edi
+  80122c:	56                   	push   %esi
+  80122d:	53                   	push   %ebx
+  80122e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801231:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801236:	8b 55 08             	mov    0x8(%ebp),%edx
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801241:	89 df                	mov    %ebx,%edi
+  801243:	89 de                	mov    %ebx,%esi
+  801245:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801247:	85 c0                	test   %eax,%eax
+  801249:	7f 08                	jg     801253 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80124b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124e:	5b                   	pop    %ebx
+  80124f:	5e                   	pop    %esi
+  801250:	5f                   	pop    %edi
+  801251:	5d                   	pop    %ebp
+  801252:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801253:	83 ec 0c             	sub    $0xc,%esp
+  801256:	50                   	push   %eax
+  801257:	6a 0d                	push   $0xd
+  801259:	68 8b 4f 80 00       	push   $0x804f8b
+  80125e:	6a 23                	push   $0x23
+  801260:	68 a8 4f 80 00       	push   $0x804fa8
+  801265:	e8 a6 f1 ff ff       	call   800410 <_panic>
+
+0080126a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80126a:	55                   	push   %ebp
+  80126b:	89 e5                	mov    %esp,%ebp
+  80126d:	57                   	push   %edi
+  80126e:	56                   	push   %esi
+  80126f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801270:	ba 00 00 00 00       	mov    $0x0,%edx
+  801275:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80127a:	89 d1                	mov    %edx,%ecx
+  80127c:	89 d3                	mov    %edx,%ebx
+  80127e:	89 d7                	mov    %edx,%edi
+  801280:	89 d6                	mov    %edx,%esi
+  801282:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801284:	5b                   	pop    %ebx
+  801285:	5e                   	pop    %esi
+  801286:	5f                   	pop    %edi
+  801287:	5d                   	pop    %ebp
+  801288:	c3                   	ret
+
+00801289 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801289:	55                   	push   %ebp
+  80128a:	89 e5                	mov    %esp,%ebp
+  80128c:	57                   	push   %edi
+  80128d:	56                   	push   %esi
+  80128e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801294:	8b 55 08             	mov    0x8(%ebp),%edx
+  801297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80129f:	89 df                	mov    %ebx,%edi
+  8012a1:	89 de                	mov    %ebx,%esi
+  8012a3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8012a5:	5b                   	pop    %ebx
+  8012a6:	5e                   	pop    %esi
+  8012a7:	5f                   	pop    %edi
+  8012a8:	5d                   	pop    %ebp
+  8012a9:	c3                   	ret
+
+008012aa <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	57                   	push   %edi
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012bd:	89 cb                	mov    %ecx,%ebx
+  8012bf:	89 cf                	mov    %ecx,%edi
+  8012c1:	89 ce                	mov    %ecx,%esi
+  8012c3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8012c5:	5b                   	pop    %ebx
+  8012c6:	5e                   	pop    %esi
+  8012c7:	5f                   	pop    %edi
+  8012c8:	5d                   	pop    %ebp
+  8012c9:	c3                   	ret
+
+008012ca <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012db:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012e0:	89 df                	mov    %ebx,%edi
+  8012e2:	89 de                	mov    %ebx,%esi
+  8012e4:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8012e6:	5b                   	pop    %ebx
+  8012e7:	5e                   	pop    %esi
+  8012e8:	5f                   	pop    %edi
+  8012e9:	5d                   	pop    %ebp
+  8012ea:	c3                   	ret
+
+008012eb <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8012eb:	55                   	push   %ebp
+  8012ec:	89 e5                	mov    %esp,%ebp
+  8012ee:	57                   	push   %edi
+  8012ef:	56                   	push   %esi
+  8012f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fc:	b8 12 00 00 00       	mov    $0x12,%eax
+  801301:	89 df                	mov    %ebx,%edi
+  801303:	89 de                	mov    %ebx,%esi
+  801305:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801307:	5b                   	pop    %ebx
+  801308:	5e                   	pop    %esi
+  801309:	5f                   	pop    %edi
+  80130a:	5d                   	pop    %ebp
+  80130b:	c3                   	ret
+
+0080130c <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	57                   	push   %edi
+  801310:	56                   	push   %esi
+  801311:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801312:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801317:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80131f:	89 cb                	mov    %ecx,%ebx
+  801321:	89 cf                	mov    %ecx,%edi
+  801323:	89 ce                	mov    %ecx,%esi
+  801325:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801327:	5b                   	pop    %ebx
+  801328:	5e                   	pop    %esi
+  801329:	5f                   	pop    %edi
+  80132a:	5d                   	pop    %ebp
+  80132b:	c3                   	ret
+
+0080132c <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	57                   	push   %edi
+  801330:	56                   	push   %esi
+  801331:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801332:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801337:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801342:	89 df                	mov    %ebx,%edi
+  801344:	89 de                	mov    %ebx,%esi
+  801346:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5f                   	pop    %edi
+  80134b:	5d                   	pop    %ebp
+  80134c:	c3                   	ret
+
+0080134d <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80134d:	55                   	push   %ebp
+  80134e:	89 e5                	mov    %esp,%ebp
+  801350:	57                   	push   %edi
+  801351:	56                   	push   %esi
+  801352:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801353:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801358:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801360:	89 cb                	mov    %ecx,%ebx
+  801362:	89 cf                	mov    %ecx,%edi
+  801364:	89 ce                	mov    %ecx,%esi
+  801366:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801368:	5b                   	pop    %ebx
+  801369:	5e                   	pop    %esi
+  80136a:	5f                   	pop    %edi
+  80136b:	5d                   	pop    %ebp
+  80136c:	c3                   	ret
+
+0080136d <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	57                   	push   %edi
+  801371:	56                   	push   %esi
+  801372:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801373:	be 00 00 00 00       	mov    $0x0,%esi
+  801378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801383:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801386:	89 f7                	mov    %esi,%edi
+  801388:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80138a:	5b                   	pop    %ebx
+  80138b:	5e                   	pop    %esi
+  80138c:	5f                   	pop    %edi
+  80138d:	5d                   	pop    %ebp
+  80138e:	c3                   	ret
+
+0080138f <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80138f:	55                   	push   %ebp
+  801390:	89 e5                	mov    %esp,%ebp
+  801392:	57                   	push   %edi
+  801393:	56                   	push   %esi
+  801394:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801395:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013a5:	89 df                	mov    %ebx,%edi
+  8013a7:	89 de                	mov    %ebx,%esi
+  8013a9:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8013ab:	5b                   	pop    %ebx
+  8013ac:	5e                   	pop    %esi
+  8013ad:	5f                   	pop    %edi
+  8013ae:	5d                   	pop    %ebp
+  8013af:	c3                   	ret
+
+008013b0 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8013b0:	55                   	push   %ebp
+  8013b1:	89 e5                	mov    %esp,%ebp
+  8013b3:	57                   	push   %edi
+  8013b4:	56                   	push   %esi
+  8013b5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013be:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013c3:	89 cb                	mov    %ecx,%ebx
+  8013c5:	89 cf                	mov    %ecx,%edi
+  8013c7:	89 ce                	mov    %ecx,%esi
+  8013c9:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8013cb:	5b                   	pop    %ebx
+  8013cc:	5e                   	pop    %esi
+  8013cd:	5f                   	pop    %edi
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	c3                   	ret
+
+008013d0 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8013d0:	55                   	push   %ebp
+  8013d1:	89 e5                	mov    %esp,%ebp
+  8013d3:	57                   	push   %edi
+  8013d4:	56                   	push   %esi
+  8013d5:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8013d6:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8013da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013e7:	89 df                	mov    %ebx,%edi
+  8013e9:	89 de                	mov    %ebx,%esi
+  8013eb:	cd 30                	int    $0x30
+}
+  8013ed:	5b                   	pop    %ebx
+  8013ee:	5e                   	pop    %esi
+  8013ef:	5f                   	pop    %edi
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+
+008013f2 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8013f2:	55                   	push   %ebp
+  8013f3:	89 e5                	mov    %esp,%ebp
+  8013f5:	57                   	push   %edi
+  8013f6:	56                   	push   %esi
+  8013f7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801403:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801408:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140b:	89 f7                	mov    %esi,%edi
+  80140d:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80140f:	5b                   	pop    %ebx
+  801410:	5e                   	pop    %esi
+  801411:	5f                   	pop    %edi
+  801412:	5d                   	pop    %ebp
+  801413:	c3                   	ret
+
+00801414 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	57                   	push   %edi
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80141a:	be 00 00 00 00       	mov    $0x0,%esi
+  80141f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801422:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801425:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80142a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142d:	89 f7                	mov    %esi,%edi
+  80142f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801431:	5b                   	pop    %ebx
+  801432:	5e                   	pop    %esi
+  801433:	5f                   	pop    %edi
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+
+00801436 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	57                   	push   %edi
+  80143a:	56                   	push   %esi
+  80143b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80143c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801441:	8b 55 08             	mov    0x8(%ebp),%edx
+  801444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801447:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80144c:	89 df                	mov    %ebx,%edi
+  80144e:	89 de                	mov    %ebx,%esi
+  801450:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801452:	5b                   	pop    %ebx
+  801453:	5e                   	pop    %esi
+  801454:	5f                   	pop    %edi
+  801455:	5d                   	pop    %ebp
+  801456:	c3                   	ret
+
+00801457 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801457:	55                   	push   %ebp
+  801458:	89 e5                	mov    %esp,%ebp
+  80145a:	57                   	push   %edi
+  80145b:	56                   	push   %esi
+  80145c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80145d:	be 00 00 00 00       	mov    $0x0,%esi
+  801462:	8b 55 08             	mov    0x8(%ebp),%edx
+  801465:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801468:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80146d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801470:	89 f7                	mov    %esi,%edi
+  801472:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801474:	5b                   	pop    %ebx
+  801475:	5e                   	pop    %esi
+  801476:	5f                   	pop    %edi
+  801477:	5d                   	pop    %ebp
+  801478:	c3                   	ret
+
+00801479 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	74 20                	je     80149d <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80147d:	89 c1                	mov    %eax,%ecx
+  80147f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801485:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80148b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801491:	8b 52 48             	mov    0x48(%edx),%edx
+  801494:	39 c2                	cmp    %eax,%edx
+  801496:	74 06                	je     80149e <thread_alive+0x25>
+  801498:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80149d:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80149e:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8014a4:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8014aa:	85 c0                	test   %eax,%eax
+  8014ac:	0f 95 c0             	setne  %al
+  8014af:	0f b6 c0             	movzbl %al,%eax
+  8014b2:	c3                   	ret
+
+008014b3 <pgfault>:
+{
+  8014b3:	55                   	push   %ebp
+  8014b4:	89 e5                	mov    %esp,%ebp
+  8014b6:	57                   	push   %edi
+  8014b7:	56                   	push   %esi
+  8014b8:	53                   	push   %ebx
+  8014b9:	83 ec 0c             	sub    $0xc,%esp
+  8014bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8014bf:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8014c1:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8014c4:	89 f3                	mov    %esi,%ebx
+  8014c6:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8014c9:	83 3d e0 7a 80 00 00 	cmpl   $0x0,0x807ae0
+  8014d0:	74 52                	je     801524 <pgfault+0x71>
+  8014d2:	a8 02                	test   $0x2,%al
+  8014d4:	75 14                	jne    8014ea <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8014d6:	83 ec 04             	sub    $0x4,%esp
+  8014d9:	68 b6 4f 80 00       	push   $0x804fb6
+  8014de:	6a 2e                	push   $0x2e
+  8014e0:	68 d4 4f 80 00       	push   $0x804fd4
+  8014e5:	e8 26 ef ff ff       	call   800410 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8014ea:	89 d8                	mov    %ebx,%eax
+  8014ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014f1:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8014f8:	83 ec 0c             	sub    $0xc,%esp
+  8014fb:	57                   	push   %edi
+  8014fc:	e8 65 29 00 00       	call   803e66 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801501:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801508:	83 e0 03             	and    $0x3,%eax
+  80150b:	83 c4 10             	add    $0x10,%esp
+  80150e:	83 f8 03             	cmp    $0x3,%eax
+  801511:	75 1a                	jne    80152d <pgfault+0x7a>
+			mutex_unlock(m);
+  801513:	83 ec 0c             	sub    $0xc,%esp
+  801516:	57                   	push   %edi
+  801517:	e8 b8 29 00 00       	call   803ed4 <mutex_unlock>
+			return;
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	e9 9f 00 00 00       	jmp    8015c3 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801524:	a8 02                	test   $0x2,%al
+  801526:	74 ae                	je     8014d6 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801528:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80152d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801534:	f6 c4 08             	test   $0x8,%ah
+  801537:	74 9d                	je     8014d6 <pgfault+0x23>
+  801539:	89 e0                	mov    %esp,%eax
+  80153b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801540:	29 c2                	sub    %eax,%edx
+  801542:	89 d0                	mov    %edx,%eax
+  801544:	c1 e8 0f             	shr    $0xf,%eax
+  801547:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80154d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801552:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801555:	c1 e0 0c             	shl    $0xc,%eax
+  801558:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80155d:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80155f:	83 ec 04             	sub    $0x4,%esp
+  801562:	6a 07                	push   $0x7
+  801564:	53                   	push   %ebx
+  801565:	6a 00                	push   $0x0
+  801567:	e8 aa fa ff ff       	call   801016 <sys_page_alloc>
+  80156c:	83 c4 10             	add    $0x10,%esp
+  80156f:	85 c0                	test   %eax,%eax
+  801571:	78 58                	js     8015cb <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801573:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801579:	83 ec 04             	sub    $0x4,%esp
+  80157c:	68 00 10 00 00       	push   $0x1000
+  801581:	56                   	push   %esi
+  801582:	53                   	push   %ebx
+  801583:	e8 0a f8 ff ff       	call   800d92 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801588:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80158f:	56                   	push   %esi
+  801590:	6a 00                	push   $0x0
+  801592:	53                   	push   %ebx
+  801593:	6a 00                	push   $0x0
+  801595:	e8 bf fa ff ff       	call   801059 <sys_page_map>
+  80159a:	83 c4 20             	add    $0x20,%esp
+  80159d:	85 c0                	test   %eax,%eax
+  80159f:	78 3c                	js     8015dd <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	53                   	push   %ebx
+  8015a5:	6a 00                	push   $0x0
+  8015a7:	e8 ef fa ff ff       	call   80109b <sys_page_unmap>
+  8015ac:	83 c4 10             	add    $0x10,%esp
+  8015af:	85 c0                	test   %eax,%eax
+  8015b1:	78 3c                	js     8015ef <pgfault+0x13c>
+	if(m)
+  8015b3:	85 ff                	test   %edi,%edi
+  8015b5:	74 0c                	je     8015c3 <pgfault+0x110>
+		mutex_unlock(m);
+  8015b7:	83 ec 0c             	sub    $0xc,%esp
+  8015ba:	57                   	push   %edi
+  8015bb:	e8 14 29 00 00       	call   803ed4 <mutex_unlock>
+  8015c0:	83 c4 10             	add    $0x10,%esp
+}
+  8015c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c6:	5b                   	pop    %ebx
+  8015c7:	5e                   	pop    %esi
+  8015c8:	5f                   	pop    %edi
+  8015c9:	5d                   	pop    %ebp
+  8015ca:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8015cb:	50                   	push   %eax
+  8015cc:	68 df 4f 80 00       	push   $0x804fdf
+  8015d1:	6a 3d                	push   $0x3d
+  8015d3:	68 d4 4f 80 00       	push   $0x804fd4
+  8015d8:	e8 33 ee ff ff       	call   800410 <_panic>
+		panic("sys_page_map: %e", ret);
+  8015dd:	50                   	push   %eax
+  8015de:	68 f2 4f 80 00       	push   $0x804ff2
+  8015e3:	6a 40                	push   $0x40
+  8015e5:	68 d4 4f 80 00       	push   $0x804fd4
+  8015ea:	e8 21 ee ff ff       	call   800410 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8015ef:	50                   	push   %eax
+  8015f0:	68 03 50 80 00       	push   $0x805003
+  8015f5:	6a 42                	push   $0x42
+  8015f7:	68 d4 4f 80 00       	push   $0x804fd4
+  8015fc:	e8 0f ee ff ff       	call   800410 <_panic>
+
+00801601 <thread_main>:
+{
+  801601:	55                   	push   %ebp
+  801602:	89 e5                	mov    %esp,%ebp
+  801604:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801607:	ff 75 0c             	push   0xc(%ebp)
+  80160a:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80160d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801614:	e8 7e f9 ff ff       	call   800f97 <sys_env_destroy>
+}
+  801619:	83 c4 10             	add    $0x10,%esp
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+0080161e <fork>:
+{
+  80161e:	55                   	push   %ebp
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	57                   	push   %edi
+  801622:	56                   	push   %esi
+  801623:	53                   	push   %ebx
+  801624:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801627:	68 b3 14 80 00       	push   $0x8014b3
+  80162c:	e8 81 2b 00 00       	call   8041b2 <set_pgfault_handler>
+	if(sforked)
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	83 3d e0 7a 80 00 00 	cmpl   $0x0,0x807ae0
+  80163b:	75 33                	jne    801670 <fork+0x52>
+	__asm __volatile("int %2"
+  80163d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801642:	cd 30                	int    $0x30
+  801644:	89 c7                	mov    %eax,%edi
+  801646:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	0f 88 b4 00 00 00    	js     801704 <fork+0xe6>
+	if(envid == 0) {
+  801650:	0f 84 c3 00 00 00    	je     801719 <fork+0xfb>
+	pgbatch_init(&pb);
+  801656:	83 ec 0c             	sub    $0xc,%esp
+  801659:	68 60 73 80 00       	push   $0x807360
+  80165e:	e8 4f 26 00 00       	call   803cb2 <pgbatch_init>
+  801663:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801666:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166b:	e9 9c 01 00 00       	jmp    80180c <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801670:	83 ec 0c             	sub    $0xc,%esp
+  801673:	68 00 77 80 00       	push   $0x807700
+  801678:	e8 e9 27 00 00       	call   803e66 <mutex_lock>
+  80167d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801680:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801685:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  80168a:	eb 08                	jmp    801694 <fork+0x76>
+  80168c:	83 c3 01             	add    $0x1,%ebx
+  80168f:	83 fb 20             	cmp    $0x20,%ebx
+  801692:	74 5b                	je     8016ef <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801694:	8b 34 9d 80 76 80 00 	mov    0x807680(,%ebx,4),%esi
+  80169b:	89 f0                	mov    %esi,%eax
+  80169d:	e8 d7 fd ff ff       	call   801479 <thread_alive>
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	74 e6                	je     80168c <fork+0x6e>
+  8016a6:	89 e0                	mov    %esp,%eax
+  8016a8:	89 fa                	mov    %edi,%edx
+  8016aa:	29 c2                	sub    %eax,%edx
+  8016ac:	89 d0                	mov    %edx,%eax
+  8016ae:	c1 e8 0f             	shr    $0xf,%eax
+  8016b1:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8016b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016bc:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8016bf:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  8016c6:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8016c9:	83 ec 08             	sub    $0x8,%esp
+  8016cc:	50                   	push   %eax
+  8016cd:	56                   	push   %esi
+  8016ce:	e8 8e fa ff ff       	call   801161 <sys_env_set_pgfault_upcall>
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	79 b2                	jns    80168c <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8016da:	50                   	push   %eax
+  8016db:	68 90 50 80 00       	push   $0x805090
+  8016e0:	68 00 01 00 00       	push   $0x100
+  8016e5:	68 d4 4f 80 00       	push   $0x804fd4
+  8016ea:	e8 21 ed ff ff       	call   800410 <_panic>
+	mutex_unlock(&sfork_lock);
+  8016ef:	83 ec 0c             	sub    $0xc,%esp
+  8016f2:	68 00 77 80 00       	push   $0x807700
+  8016f7:	e8 d8 27 00 00       	call   803ed4 <mutex_unlock>
+}
+  8016fc:	83 c4 10             	add    $0x10,%esp
+  8016ff:	e9 39 ff ff ff       	jmp    80163d <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801704:	50                   	push   %eax
+  801705:	68 16 50 80 00       	push   $0x805016
+  80170a:	68 91 00 00 00       	push   $0x91
+  80170f:	68 d4 4f 80 00       	push   $0x804fd4
+  801714:	e8 f7 ec ff ff       	call   800410 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801719:	e8 ba f8 ff ff       	call   800fd8 <sys_getenvid>
+  80171e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801723:	89 e1                	mov    %esp,%ecx
+  801725:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80172a:	29 ca                	sub    %ecx,%edx
+  80172c:	89 d1                	mov    %edx,%ecx
+  80172e:	c1 e9 0f             	shr    $0xf,%ecx
+  801731:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801737:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173c:	0f 42 d1             	cmovb  %ecx,%edx
+  80173f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801745:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80174a:	89 04 95 60 7a 80 00 	mov    %eax,0x807a60(,%edx,4)
+		if(sforked)
+  801751:	a1 e0 7a 80 00       	mov    0x807ae0,%eax
+  801756:	85 c0                	test   %eax,%eax
+  801758:	75 07                	jne    801761 <fork+0x143>
+		return 0;
+  80175a:	89 c6                	mov    %eax,%esi
+  80175c:	e9 6f 02 00 00       	jmp    8019d0 <fork+0x3b2>
+  801761:	89 e2                	mov    %esp,%edx
+  801763:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801768:	29 d0                	sub    %edx,%eax
+  80176a:	89 c3                	mov    %eax,%ebx
+  80176c:	c1 eb 0f             	shr    $0xf,%ebx
+  80176f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801774:	b8 00 00 00 00       	mov    $0x0,%eax
+  801779:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80177c:	83 ec 04             	sub    $0x4,%esp
+  80177f:	68 80 00 00 00       	push   $0x80
+  801784:	6a 00                	push   $0x0
+  801786:	68 80 76 80 00       	push   $0x807680
+  80178b:	e8 cd f5 ff ff       	call   800d5d <memset>
+	thread_ids[slot] = sys_getenvid();
+  801790:	e8 43 f8 ff ff       	call   800fd8 <sys_getenvid>
+  801795:	89 04 9d 80 76 80 00 	mov    %eax,0x807680(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  80179c:	8b 04 9d 60 7a 80 00 	mov    0x807a60(,%ebx,4),%eax
+  8017a3:	a3 60 7a 80 00       	mov    %eax,0x807a60
+	mutex_init(&sfork_lock);
+  8017a8:	c7 04 24 00 77 80 00 	movl   $0x807700,(%esp)
+  8017af:	e8 a4 26 00 00       	call   803e58 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8017b4:	83 c4 0c             	add    $0xc,%esp
+  8017b7:	68 07 04 00 00       	push   $0x407
+  8017bc:	68 00 00 00 e1       	push   $0xe1000000
+  8017c1:	6a 00                	push   $0x0
+  8017c3:	e8 4e f8 ff ff       	call   801016 <sys_page_alloc>
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	0f 89 fd 01 00 00    	jns    8019d0 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8017d3:	50                   	push   %eax
+  8017d4:	68 df 4f 80 00       	push   $0x804fdf
+  8017d9:	68 12 01 00 00       	push   $0x112
+  8017de:	68 d4 4f 80 00       	push   $0x804fd4
+  8017e3:	e8 28 ec ff ff       	call   800410 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8017e8:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8017ee:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8017f4:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8017fa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801800:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801806:	0f 87 4f 01 00 00    	ja     80195b <fork+0x33d>
+		pd = PDX(addr);
+  80180c:	89 d8                	mov    %ebx,%eax
+  80180e:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801811:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801818:	f6 c2 01             	test   $0x1,%dl
+  80181b:	74 cb                	je     8017e8 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80181d:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801822:	0f 85 92 00 00 00    	jne    8018ba <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801828:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80182e:	76 10                	jbe    801840 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801830:	89 d8                	mov    %ebx,%eax
+  801832:	f7 d8                	neg    %eax
+  801834:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801839:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80183e:	74 ba                	je     8017fa <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801840:	89 d8                	mov    %ebx,%eax
+  801842:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801845:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80184c:	f6 c2 01             	test   $0x1,%dl
+  80184f:	74 a9                	je     8017fa <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801851:	89 c1                	mov    %eax,%ecx
+  801853:	c1 e1 0c             	shl    $0xc,%ecx
+  801856:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801859:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801860:	f6 c6 04             	test   $0x4,%dh
+  801863:	0f 85 8e 00 00 00    	jne    8018f7 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801869:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801870:	f6 c6 08             	test   $0x8,%dh
+  801873:	75 0f                	jne    801884 <fork+0x266>
+  801875:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80187c:	a8 02                	test   $0x2,%al
+  80187e:	0f 84 bb 00 00 00    	je     80193f <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801884:	83 ec 08             	sub    $0x8,%esp
+  801887:	68 05 08 00 00       	push   $0x805
+  80188c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80188f:	50                   	push   %eax
+  801890:	56                   	push   %esi
+  801891:	50                   	push   %eax
+  801892:	6a 00                	push   $0x0
+  801894:	68 60 73 80 00       	push   $0x807360
+  801899:	e8 d2 24 00 00       	call   803d70 <pgbatch_map>
+  80189e:	83 c4 20             	add    $0x20,%esp
+  8018a1:	85 c0                	test   %eax,%eax
+  8018a3:	79 76                	jns    80191b <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8018a5:	50                   	push   %eax
+  8018a6:	68 3a 50 80 00       	push   $0x80503a
+  8018ab:	68 bc 00 00 00       	push   $0xbc
+  8018b0:	68 d4 4f 80 00       	push   $0x804fd4
+  8018b5:	e8 56 eb ff ff       	call   800410 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8018ba:	83 ec 0c             	sub    $0xc,%esp
+  8018bd:	68 00 08 00 00       	push   $0x800
+  8018c2:	56                   	push   %esi
+  8018c3:	53                   	push   %ebx
+  8018c4:	6a 00                	push   $0x0
+  8018c6:	68 60 73 80 00       	push   $0x807360
+  8018cb:	e8 4b 25 00 00       	call   803e1b <pgbatch_sharept>
+  8018d0:	83 c4 20             	add    $0x20,%esp
+  8018d3:	85 c0                	test   %eax,%eax
+  8018d5:	78 0b                	js     8018e2 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8018d7:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8018dd:	e9 18 ff ff ff       	jmp    8017fa <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8018e2:	50                   	push   %eax
+  8018e3:	68 26 50 80 00       	push   $0x805026
+  8018e8:	68 b2 00 00 00       	push   $0xb2
+  8018ed:	68 d4 4f 80 00       	push   $0x804fd4
+  8018f2:	e8 19 eb ff ff       	call   800410 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8018f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+  801901:	25 07 0e 00 00       	and    $0xe07,%eax
+  801906:	50                   	push   %eax
+  801907:	51                   	push   %ecx
+  801908:	56                   	push   %esi
+  801909:	51                   	push   %ecx
+  80190a:	6a 00                	push   $0x0
+  80190c:	68 60 73 80 00       	push   $0x807360
+  801911:	e8 5a 24 00 00       	call   803d70 <pgbatch_map>
+  801916:	83 c4 20             	add    $0x20,%esp
+  801919:	eb 17                	jmp    801932 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  80191b:	68 05 08 00 00       	push   $0x805
+  801920:	ff 75 e4             	push   -0x1c(%ebp)
+  801923:	6a 00                	push   $0x0
+  801925:	68 60 73 80 00       	push   $0x807360
+  80192a:	e8 b5 24 00 00       	call   803de4 <pgbatch_protect>
+  80192f:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801932:	85 c0                	test   %eax,%eax
+  801934:	0f 89 c0 fe ff ff    	jns    8017fa <fork+0x1dc>
+  80193a:	e9 66 ff ff ff       	jmp    8018a5 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  80193f:	83 ec 08             	sub    $0x8,%esp
+  801942:	6a 05                	push   $0x5
+  801944:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801947:	50                   	push   %eax
+  801948:	56                   	push   %esi
+  801949:	50                   	push   %eax
+  80194a:	6a 00                	push   $0x0
+  80194c:	68 60 73 80 00       	push   $0x807360
+  801951:	e8 1a 24 00 00       	call   803d70 <pgbatch_map>
+  801956:	83 c4 20             	add    $0x20,%esp
+  801959:	eb d7                	jmp    801932 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  80195b:	6a 07                	push   $0x7
+  80195d:	68 00 f0 bf ee       	push   $0xeebff000
+  801962:	57                   	push   %edi
+  801963:	68 60 73 80 00       	push   $0x807360
+  801968:	e8 cc 23 00 00       	call   803d39 <pgbatch_alloc>
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	85 c0                	test   %eax,%eax
+  801972:	78 66                	js     8019da <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801974:	83 ec 0c             	sub    $0xc,%esp
+  801977:	68 60 73 80 00       	push   $0x807360
+  80197c:	e8 3f 23 00 00       	call   803cc0 <pgbatch_flush>
+  801981:	83 c4 10             	add    $0x10,%esp
+  801984:	85 c0                	test   %eax,%eax
+  801986:	78 52                	js     8019da <fork+0x3bc>
+  801988:	89 e2                	mov    %esp,%edx
+  80198a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80198f:	29 d0                	sub    %edx,%eax
+  801991:	89 c2                	mov    %eax,%edx
+  801993:	c1 ea 0f             	shr    $0xf,%edx
+  801996:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80199b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a0:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8019a3:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  8019aa:	8b 40 78             	mov    0x78(%eax),%eax
+  8019ad:	83 ec 08             	sub    $0x8,%esp
+  8019b0:	50                   	push   %eax
+  8019b1:	57                   	push   %edi
+  8019b2:	e8 aa f7 ff ff       	call   801161 <sys_env_set_pgfault_upcall>
+  8019b7:	83 c4 10             	add    $0x10,%esp
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	78 31                	js     8019ef <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  8019be:	83 ec 08             	sub    $0x8,%esp
+  8019c1:	6a 02                	push   $0x2
+  8019c3:	57                   	push   %edi
+  8019c4:	e8 14 f7 ff ff       	call   8010dd <sys_env_set_status>
+  8019c9:	83 c4 10             	add    $0x10,%esp
+  8019cc:	85 c0                	test   %eax,%eax
+  8019ce:	78 34                	js     801a04 <fork+0x3e6>
+}
+  8019d0:	89 f0                	mov    %esi,%eax
+  8019d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d5:	5b                   	pop    %ebx
+  8019d6:	5e                   	pop    %esi
+  8019d7:	5f                   	pop    %edi
+  8019d8:	5d                   	pop    %ebp
+  8019d9:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  8019da:	50                   	push   %eax
+  8019db:	68 46 50 80 00       	push   $0x805046
+  8019e0:	68 c0 00 00 00       	push   $0xc0
+  8019e5:	68 d4 4f 80 00       	push   $0x804fd4
+  8019ea:	e8 21 ea ff ff       	call   800410 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  8019ef:	50                   	push   %eax
+  8019f0:	68 5b 50 80 00       	push   $0x80505b
+  8019f5:	68 c2 00 00 00       	push   $0xc2
+  8019fa:	68 d4 4f 80 00       	push   $0x804fd4
+  8019ff:	e8 0c ea ff ff       	call   800410 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801a04:	50                   	push   %eax
+  801a05:	68 76 50 80 00       	push   $0x805076
+  801a0a:	68 c4 00 00 00       	push   $0xc4
+  801a0f:	68 d4 4f 80 00       	push   $0x804fd4
+  801a14:	e8 f7 e9 ff ff       	call   800410 <_panic>
+
+00801a19 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	57                   	push   %edi
+  801a1d:	56                   	push   %esi
+  801a1e:	53                   	push   %ebx
+  801a1f:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801a22:	68 00 77 80 00       	push   $0x807700
+  801a27:	e8 3a 24 00 00       	call   803e66 <mutex_lock>
+  801a2c:	89 e2                	mov    %esp,%edx
+  801a2e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a33:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801a35:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801a38:	89 c3                	mov    %eax,%ebx
+  801a3a:	c1 eb 0f             	shr    $0xf,%ebx
+  801a3d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a47:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801a4a:	e8 89 f5 ff ff       	call   800fd8 <sys_getenvid>
+  801a4f:	89 04 9d 80 76 80 00 	mov    %eax,0x807680(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801a56:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801a5b:	8b 04 9d 80 76 80 00 	mov    0x807680(,%ebx,4),%eax
+  801a62:	e8 12 fa ff ff       	call   801479 <thread_alive>
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	74 24                	je     801a8f <sfork+0x76>
+  801a6b:	83 c3 01             	add    $0x1,%ebx
+  801a6e:	83 fb 20             	cmp    $0x20,%ebx
+  801a71:	75 e8                	jne    801a5b <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801a73:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801a78:	83 ec 0c             	sub    $0xc,%esp
+  801a7b:	68 00 77 80 00       	push   $0x807700
+  801a80:	e8 4f 24 00 00       	call   803ed4 <mutex_unlock>
+	return r;
+}
+  801a85:	89 f0                	mov    %esi,%eax
+  801a87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a8a:	5b                   	pop    %ebx
+  801a8b:	5e                   	pop    %esi
+  801a8c:	5f                   	pop    %edi
+  801a8d:	5d                   	pop    %ebp
+  801a8e:	c3                   	ret
+	if (i == NTHREADS) {
+  801a8f:	83 fb 20             	cmp    $0x20,%ebx
+  801a92:	0f 84 53 01 00 00    	je     801beb <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801a98:	89 d8                	mov    %ebx,%eax
+  801a9a:	c1 e0 0f             	shl    $0xf,%eax
+  801a9d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801aa0:	83 ec 0c             	sub    $0xc,%esp
+  801aa3:	68 40 70 80 00       	push   $0x807040
+  801aa8:	e8 05 22 00 00       	call   803cb2 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801aad:	83 c4 10             	add    $0x10,%esp
+  801ab0:	83 3d e0 7a 80 00 00 	cmpl   $0x0,0x807ae0
+  801ab7:	75 1f                	jne    801ad8 <sfork+0xbf>
+  801ab9:	68 07 04 00 00       	push   $0x407
+  801abe:	68 00 00 00 e1       	push   $0xe1000000
+  801ac3:	6a 00                	push   $0x0
+  801ac5:	68 40 70 80 00       	push   $0x807040
+  801aca:	e8 6a 22 00 00       	call   803d39 <pgbatch_alloc>
+  801acf:	89 c6                	mov    %eax,%esi
+  801ad1:	83 c4 10             	add    $0x10,%esp
+  801ad4:	85 c0                	test   %eax,%eax
+  801ad6:	78 a0                	js     801a78 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801ad8:	6a 07                	push   $0x7
+  801ada:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801adf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ae2:	29 c8                	sub    %ecx,%eax
+  801ae4:	50                   	push   %eax
+  801ae5:	6a 00                	push   $0x0
+  801ae7:	68 40 70 80 00       	push   $0x807040
+  801aec:	e8 48 22 00 00       	call   803d39 <pgbatch_alloc>
+  801af1:	89 c6                	mov    %eax,%esi
+  801af3:	83 c4 10             	add    $0x10,%esp
+  801af6:	85 c0                	test   %eax,%eax
+  801af8:	0f 88 7a ff ff ff    	js     801a78 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801afe:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801b03:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b06:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801b08:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801b0d:	29 c8                	sub    %ecx,%eax
+  801b0f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b12:	39 c7                	cmp    %eax,%edi
+  801b14:	73 29                	jae    801b3f <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801b16:	6a 07                	push   $0x7
+  801b18:	57                   	push   %edi
+  801b19:	6a 00                	push   $0x0
+  801b1b:	68 40 70 80 00       	push   $0x807040
+  801b20:	e8 14 22 00 00       	call   803d39 <pgbatch_alloc>
+  801b25:	89 c6                	mov    %eax,%esi
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	0f 88 46 ff ff ff    	js     801a78 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801b32:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801b38:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b3b:	39 c7                	cmp    %eax,%edi
+  801b3d:	72 d7                	jb     801b16 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	68 40 70 80 00       	push   $0x807040
+  801b47:	e8 74 21 00 00       	call   803cc0 <pgbatch_flush>
+  801b4c:	89 c6                	mov    %eax,%esi
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	0f 88 1f ff ff ff    	js     801a78 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801b59:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801b5e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b61:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801b63:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b6c:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801b6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b72:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b75:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801b78:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801b7d:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b7f:	52                   	push   %edx
+  801b80:	50                   	push   %eax
+  801b81:	68 01 16 80 00       	push   $0x801601
+  801b86:	e8 cc f8 ff ff       	call   801457 <sys_exofork_shared>
+  801b8b:	89 c6                	mov    %eax,%esi
+  801b8d:	83 c4 10             	add    $0x10,%esp
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	0f 88 e0 fe ff ff    	js     801a78 <sfork+0x5f>
+	thread_ids[i] = id;
+  801b98:	89 04 9d 80 76 80 00 	mov    %eax,0x807680(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801b9f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ba4:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801baa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801baf:	89 04 9d 60 7a 80 00 	mov    %eax,0x807a60(,%ebx,4)
+	sforked = 1;
+  801bb6:	c7 05 e0 7a 80 00 01 	movl   $0x1,0x807ae0
+  801bbd:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801bc0:	83 ec 08             	sub    $0x8,%esp
+  801bc3:	6a 02                	push   $0x2
+  801bc5:	56                   	push   %esi
+  801bc6:	e8 12 f5 ff ff       	call   8010dd <sys_env_set_status>
+  801bcb:	89 c3                	mov    %eax,%ebx
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	0f 89 a0 fe ff ff    	jns    801a78 <sfork+0x5f>
+		sys_env_destroy(id);
+  801bd8:	83 ec 0c             	sub    $0xc,%esp
+  801bdb:	56                   	push   %esi
+  801bdc:	e8 b6 f3 ff ff       	call   800f97 <sys_env_destroy>
+		goto out;
+  801be1:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801be4:	89 de                	mov    %ebx,%esi
+		goto out;
+  801be6:	e9 8d fe ff ff       	jmp    801a78 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801beb:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801bf0:	e9 83 fe ff ff       	jmp    801a78 <sfork+0x5f>
+
+00801bf5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801bf5:	55                   	push   %ebp
+  801bf6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bf8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bfb:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c00:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801c03:	5d                   	pop    %ebp
+  801c04:	c3                   	ret
+
+00801c05 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c10:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c15:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801c1a:	5d                   	pop    %ebp
+  801c1b:	c3                   	ret
+
+00801c1c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c1c:	55                   	push   %ebp
+  801c1d:	89 e5                	mov    %esp,%ebp
+  801c1f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c24:	89 c2                	mov    %eax,%edx
+  801c26:	c1 ea 16             	shr    $0x16,%edx
+  801c29:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c30:	f6 c2 01             	test   $0x1,%dl
+  801c33:	74 29                	je     801c5e <fd_alloc+0x42>
+  801c35:	89 c2                	mov    %eax,%edx
+  801c37:	c1 ea 0c             	shr    $0xc,%edx
+  801c3a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c41:	f6 c2 01             	test   $0x1,%dl
+  801c44:	74 18                	je     801c5e <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801c46:	05 00 10 00 00       	add    $0x1000,%eax
+  801c4b:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801c50:	75 d2                	jne    801c24 <fd_alloc+0x8>
+  801c52:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c57:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c5c:	eb 05                	jmp    801c63 <fd_alloc+0x47>
+			return 0;
+  801c5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801c63:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c66:	89 02                	mov    %eax,(%edx)
+}
+  801c68:	89 c8                	mov    %ecx,%eax
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+
+00801c6c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c72:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801c77:	77 30                	ja     801ca9 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c79:	c1 e0 0c             	shl    $0xc,%eax
+  801c7c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801c81:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c87:	f6 c2 01             	test   $0x1,%dl
+  801c8a:	74 24                	je     801cb0 <fd_lookup+0x44>
+  801c8c:	89 c2                	mov    %eax,%edx
+  801c8e:	c1 ea 0c             	shr    $0xc,%edx
+  801c91:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c98:	f6 c2 01             	test   $0x1,%dl
+  801c9b:	74 1a                	je     801cb7 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ca0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ca7:	5d                   	pop    %ebp
+  801ca8:	c3                   	ret
+		return -E_INVAL;
+  801ca9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cae:	eb f7                	jmp    801ca7 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801cb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cb5:	eb f0                	jmp    801ca7 <fd_lookup+0x3b>
+  801cb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cbc:	eb e9                	jmp    801ca7 <fd_lookup+0x3b>
+
+00801cbe <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	53                   	push   %ebx
+  801cc2:	83 ec 04             	sub    $0x4,%esp
+  801cc5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccd:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801cd2:	39 13                	cmp    %edx,(%ebx)
+  801cd4:	74 54                	je     801d2a <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801cd6:	83 c0 01             	add    $0x1,%eax
+  801cd9:	8b 1c 85 2c 51 80 00 	mov    0x80512c(,%eax,4),%ebx
+  801ce0:	85 db                	test   %ebx,%ebx
+  801ce2:	75 ee                	jne    801cd2 <dev_lookup+0x14>
+  801ce4:	89 e1                	mov    %esp,%ecx
+  801ce6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ceb:	29 c8                	sub    %ecx,%eax
+  801ced:	89 c1                	mov    %eax,%ecx
+  801cef:	c1 e9 0f             	shr    $0xf,%ecx
+  801cf2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfc:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cff:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  801d06:	8b 40 48             	mov    0x48(%eax),%eax
+  801d09:	83 ec 04             	sub    $0x4,%esp
+  801d0c:	52                   	push   %edx
+  801d0d:	50                   	push   %eax
+  801d0e:	68 b0 50 80 00       	push   $0x8050b0
+  801d13:	e8 d3 e7 ff ff       	call   8004eb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801d20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d23:	89 1a                	mov    %ebx,(%edx)
+}
+  801d25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d28:	c9                   	leave
+  801d29:	c3                   	ret
+			return 0;
+  801d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2f:	eb ef                	jmp    801d20 <dev_lookup+0x62>
+
+00801d31 <fd_close>:
+{
+  801d31:	55                   	push   %ebp
+  801d32:	89 e5                	mov    %esp,%ebp
+  801d34:	57                   	push   %edi
+  801d35:	56                   	push   %esi
+  801d36:	53                   	push   %ebx
+  801d37:	83 ec 24             	sub    $0x24,%esp
+  801d3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d3d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d40:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d43:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d44:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d4a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d4d:	50                   	push   %eax
+  801d4e:	e8 19 ff ff ff       	call   801c6c <fd_lookup>
+  801d53:	89 c3                	mov    %eax,%ebx
+  801d55:	83 c4 10             	add    $0x10,%esp
+  801d58:	85 c0                	test   %eax,%eax
+  801d5a:	78 05                	js     801d61 <fd_close+0x30>
+	    || fd != fd2)
+  801d5c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d5f:	74 0f                	je     801d70 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801d61:	85 ff                	test   %edi,%edi
+  801d63:	0f 44 df             	cmove  %edi,%ebx
+}
+  801d66:	89 d8                	mov    %ebx,%eax
+  801d68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d6b:	5b                   	pop    %ebx
+  801d6c:	5e                   	pop    %esi
+  801d6d:	5f                   	pop    %edi
+  801d6e:	5d                   	pop    %ebp
+  801d6f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d70:	83 ec 08             	sub    $0x8,%esp
+  801d73:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d76:	50                   	push   %eax
+  801d77:	ff 36                	push   (%esi)
+  801d79:	e8 40 ff ff ff       	call   801cbe <dev_lookup>
+  801d7e:	89 c3                	mov    %eax,%ebx
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 1a                	js     801da1 <fd_close+0x70>
+		if (dev->dev_close)
+  801d87:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d8a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	74 0b                	je     801da1 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801d96:	83 ec 0c             	sub    $0xc,%esp
+  801d99:	56                   	push   %esi
+  801d9a:	ff d0                	call   *%eax
+  801d9c:	89 c3                	mov    %eax,%ebx
+  801d9e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801da1:	83 ec 08             	sub    $0x8,%esp
+  801da4:	56                   	push   %esi
+  801da5:	6a 00                	push   $0x0
+  801da7:	e8 ef f2 ff ff       	call   80109b <sys_page_unmap>
+	return r;
+  801dac:	83 c4 10             	add    $0x10,%esp
+  801daf:	eb b5                	jmp    801d66 <fd_close+0x35>
+
+00801db1 <close>:
+
+int
+close(int fdnum)
+{
+  801db1:	55                   	push   %ebp
+  801db2:	89 e5                	mov    %esp,%ebp
+  801db4:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801db7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dba:	50                   	push   %eax
+  801dbb:	ff 75 08             	push   0x8(%ebp)
+  801dbe:	e8 a9 fe ff ff       	call   801c6c <fd_lookup>
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	79 02                	jns    801dcc <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801dca:	c9                   	leave
+  801dcb:	c3                   	ret
+		return fd_close(fd, 1);
+  801dcc:	83 ec 08             	sub    $0x8,%esp
+  801dcf:	6a 01                	push   $0x1
+  801dd1:	ff 75 f4             	push   -0xc(%ebp)
+  801dd4:	e8 58 ff ff ff       	call   801d31 <fd_close>
+  801dd9:	83 c4 10             	add    $0x10,%esp
+  801ddc:	eb ec                	jmp    801dca <close+0x19>
+
+00801dde <close_all>:
+
+void
+close_all(void)
+{
+  801dde:	55                   	push   %ebp
+  801ddf:	89 e5                	mov    %esp,%ebp
+  801de1:	53                   	push   %ebx
+  801de2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801de5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801dea:	83 ec 0c             	sub    $0xc,%esp
+  801ded:	53                   	push   %ebx
+  801dee:	e8 be ff ff ff       	call   801db1 <close>
+	for (i = 0; i < MAXFD; i++)
+  801df3:	83 c3 01             	add    $0x1,%ebx
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801dff:	75 e9                	jne    801dea <close_all+0xc>
+}
+  801e01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e04:	c9                   	leave
+  801e05:	c3                   	ret
+
+00801e06 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801e06:	55                   	push   %ebp
+  801e07:	89 e5                	mov    %esp,%ebp
+  801e09:	57                   	push   %edi
+  801e0a:	56                   	push   %esi
+  801e0b:	53                   	push   %ebx
+  801e0c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801e0f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e12:	50                   	push   %eax
+  801e13:	ff 75 08             	push   0x8(%ebp)
+  801e16:	e8 51 fe ff ff       	call   801c6c <fd_lookup>
+  801e1b:	89 c3                	mov    %eax,%ebx
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	78 7f                	js     801ea3 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e24:	83 ec 0c             	sub    $0xc,%esp
+  801e27:	ff 75 0c             	push   0xc(%ebp)
+  801e2a:	e8 82 ff ff ff       	call   801db1 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e2f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e32:	c1 e6 0c             	shl    $0xc,%esi
+  801e35:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e3b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e3e:	89 3c 24             	mov    %edi,(%esp)
+  801e41:	e8 bf fd ff ff       	call   801c05 <fd2data>
+  801e46:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e48:	89 34 24             	mov    %esi,(%esp)
+  801e4b:	e8 b5 fd ff ff       	call   801c05 <fd2data>
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801e56:	89 d8                	mov    %ebx,%eax
+  801e58:	c1 e8 16             	shr    $0x16,%eax
+  801e5b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e62:	a8 01                	test   $0x1,%al
+  801e64:	74 11                	je     801e77 <dup+0x71>
+  801e66:	89 d8                	mov    %ebx,%eax
+  801e68:	c1 e8 0c             	shr    $0xc,%eax
+  801e6b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e72:	f6 c2 01             	test   $0x1,%dl
+  801e75:	75 36                	jne    801ead <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e77:	89 f8                	mov    %edi,%eax
+  801e79:	c1 e8 0c             	shr    $0xc,%eax
+  801e7c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e83:	83 ec 0c             	sub    $0xc,%esp
+  801e86:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e8b:	50                   	push   %eax
+  801e8c:	56                   	push   %esi
+  801e8d:	6a 00                	push   $0x0
+  801e8f:	57                   	push   %edi
+  801e90:	6a 00                	push   $0x0
+  801e92:	e8 c2 f1 ff ff       	call   801059 <sys_page_map>
+  801e97:	89 c3                	mov    %eax,%ebx
+  801e99:	83 c4 20             	add    $0x20,%esp
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	78 33                	js     801ed3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ea0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801ea3:	89 d8                	mov    %ebx,%eax
+  801ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea8:	5b                   	pop    %ebx
+  801ea9:	5e                   	pop    %esi
+  801eaa:	5f                   	pop    %edi
+  801eab:	5d                   	pop    %ebp
+  801eac:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ead:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801eb4:	83 ec 0c             	sub    $0xc,%esp
+  801eb7:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ebc:	50                   	push   %eax
+  801ebd:	ff 75 d4             	push   -0x2c(%ebp)
+  801ec0:	6a 00                	push   $0x0
+  801ec2:	53                   	push   %ebx
+  801ec3:	6a 00                	push   $0x0
+  801ec5:	e8 8f f1 ff ff       	call   801059 <sys_page_map>
+  801eca:	89 c3                	mov    %eax,%ebx
+  801ecc:	83 c4 20             	add    $0x20,%esp
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	79 a4                	jns    801e77 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ed3:	83 ec 08             	sub    $0x8,%esp
+  801ed6:	56                   	push   %esi
+  801ed7:	6a 00                	push   $0x0
+  801ed9:	e8 bd f1 ff ff       	call   80109b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ede:	83 c4 08             	add    $0x8,%esp
+  801ee1:	ff 75 d4             	push   -0x2c(%ebp)
+  801ee4:	6a 00                	push   $0x0
+  801ee6:	e8 b0 f1 ff ff       	call   80109b <sys_page_unmap>
+	return r;
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	eb b3                	jmp    801ea3 <dup+0x9d>
+
+00801ef0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	56                   	push   %esi
+  801ef4:	53                   	push   %ebx
+  801ef5:	83 ec 18             	sub    $0x18,%esp
+  801ef8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801efb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801efe:	50                   	push   %eax
+  801eff:	53                   	push   %ebx
+  801f00:	e8 67 fd ff ff       	call   801c6c <fd_lookup>
+  801f05:	83 c4 10             	add    $0x10,%esp
+  801f08:	85 c0                	test   %eax,%eax
+  801f0a:	78 3c                	js     801f48 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f0c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f0f:	83 ec 08             	sub    $0x8,%esp
+  801f12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f15:	50                   	push   %eax
+  801f16:	ff 36                	push   (%esi)
+  801f18:	e8 a1 fd ff ff       	call   801cbe <dev_lookup>
+  801f1d:	83 c4 10             	add    $0x10,%esp
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	78 24                	js     801f48 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f24:	8b 46 08             	mov    0x8(%esi),%eax
+  801f27:	83 e0 03             	and    $0x3,%eax
+  801f2a:	83 f8 01             	cmp    $0x1,%eax
+  801f2d:	74 20                	je     801f4f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f32:	8b 40 08             	mov    0x8(%eax),%eax
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	74 54                	je     801f8d <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f39:	83 ec 04             	sub    $0x4,%esp
+  801f3c:	ff 75 10             	push   0x10(%ebp)
+  801f3f:	ff 75 0c             	push   0xc(%ebp)
+  801f42:	56                   	push   %esi
+  801f43:	ff d0                	call   *%eax
+  801f45:	83 c4 10             	add    $0x10,%esp
+}
+  801f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4b:	5b                   	pop    %ebx
+  801f4c:	5e                   	pop    %esi
+  801f4d:	5d                   	pop    %ebp
+  801f4e:	c3                   	ret
+  801f4f:	89 e2                	mov    %esp,%edx
+  801f51:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f56:	29 d0                	sub    %edx,%eax
+  801f58:	89 c2                	mov    %eax,%edx
+  801f5a:	c1 ea 0f             	shr    $0xf,%edx
+  801f5d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f67:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f6a:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  801f71:	8b 40 48             	mov    0x48(%eax),%eax
+  801f74:	83 ec 04             	sub    $0x4,%esp
+  801f77:	53                   	push   %ebx
+  801f78:	50                   	push   %eax
+  801f79:	68 f1 50 80 00       	push   $0x8050f1
+  801f7e:	e8 68 e5 ff ff       	call   8004eb <cprintf>
+		return -E_INVAL;
+  801f83:	83 c4 10             	add    $0x10,%esp
+  801f86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f8b:	eb bb                	jmp    801f48 <read+0x58>
+		return -E_NOT_SUPP;
+  801f8d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f92:	eb b4                	jmp    801f48 <read+0x58>
+
+00801f94 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	57                   	push   %edi
+  801f98:	56                   	push   %esi
+  801f99:	53                   	push   %ebx
+  801f9a:	83 ec 0c             	sub    $0xc,%esp
+  801f9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fa0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801fa3:	85 f6                	test   %esi,%esi
+  801fa5:	74 30                	je     801fd7 <readn+0x43>
+  801fa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fac:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801fb1:	83 ec 04             	sub    $0x4,%esp
+  801fb4:	89 f2                	mov    %esi,%edx
+  801fb6:	29 c2                	sub    %eax,%edx
+  801fb8:	52                   	push   %edx
+  801fb9:	01 f8                	add    %edi,%eax
+  801fbb:	50                   	push   %eax
+  801fbc:	ff 75 08             	push   0x8(%ebp)
+  801fbf:	e8 2c ff ff ff       	call   801ef0 <read>
+		if (m < 0)
+  801fc4:	83 c4 10             	add    $0x10,%esp
+  801fc7:	85 c0                	test   %eax,%eax
+  801fc9:	78 15                	js     801fe0 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801fcb:	74 11                	je     801fde <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801fcd:	01 c3                	add    %eax,%ebx
+  801fcf:	89 d8                	mov    %ebx,%eax
+  801fd1:	39 f3                	cmp    %esi,%ebx
+  801fd3:	72 dc                	jb     801fb1 <readn+0x1d>
+  801fd5:	eb 09                	jmp    801fe0 <readn+0x4c>
+  801fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdc:	eb 02                	jmp    801fe0 <readn+0x4c>
+  801fde:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe3:	5b                   	pop    %ebx
+  801fe4:	5e                   	pop    %esi
+  801fe5:	5f                   	pop    %edi
+  801fe6:	5d                   	pop    %ebp
+  801fe7:	c3                   	ret
+
+00801fe8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	56                   	push   %esi
+  801fec:	53                   	push   %ebx
+  801fed:	83 ec 18             	sub    $0x18,%esp
+  801ff0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ff3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ff6:	50                   	push   %eax
+  801ff7:	53                   	push   %ebx
+  801ff8:	e8 6f fc ff ff       	call   801c6c <fd_lookup>
+  801ffd:	83 c4 10             	add    $0x10,%esp
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 37                	js     80203b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802004:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802007:	83 ec 08             	sub    $0x8,%esp
+  80200a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200d:	50                   	push   %eax
+  80200e:	ff 36                	push   (%esi)
+  802010:	e8 a9 fc ff ff       	call   801cbe <dev_lookup>
+  802015:	83 c4 10             	add    $0x10,%esp
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	78 1f                	js     80203b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80201c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802020:	74 20                	je     802042 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802022:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802025:	8b 40 0c             	mov    0xc(%eax),%eax
+  802028:	85 c0                	test   %eax,%eax
+  80202a:	74 54                	je     802080 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80202c:	83 ec 04             	sub    $0x4,%esp
+  80202f:	ff 75 10             	push   0x10(%ebp)
+  802032:	ff 75 0c             	push   0xc(%ebp)
+  802035:	56                   	push   %esi
+  802036:	ff d0                	call   *%eax
+  802038:	83 c4 10             	add    $0x10,%esp
+}
+  80203b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203e:	5b                   	pop    %ebx
+  80203f:	5e                   	pop    %esi
+  802040:	5d                   	pop    %ebp
+  802041:	c3                   	ret
+  802042:	89 e2                	mov    %esp,%edx
+  802044:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802049:	29 d0                	sub    %edx,%eax
+  80204b:	89 c2                	mov    %eax,%edx
+  80204d:	c1 ea 0f             	shr    $0xf,%edx
+  802050:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80205d:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  802064:	8b 40 48             	mov    0x48(%eax),%eax
+  802067:	83 ec 04             	sub    $0x4,%esp
+  80206a:	53                   	push   %ebx
+  80206b:	50                   	push   %eax
+  80206c:	68 0d 51 80 00       	push   $0x80510d
+  802071:	e8 75 e4 ff ff       	call   8004eb <cprintf>
+		return -E_INVAL;
+  802076:	83 c4 10             	add    $0x10,%esp
+  802079:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80207e:	eb bb                	jmp    80203b <write+0x53>
+		return -E_NOT_SUPP;
+  802080:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802085:	eb b4                	jmp    80203b <write+0x53>
+
+00802087 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80208d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802090:	50                   	push   %eax
+  802091:	ff 75 08             	push   0x8(%ebp)
+  802094:	e8 d3 fb ff ff       	call   801c6c <fd_lookup>
+  802099:	83 c4 10             	add    $0x10,%esp
+  80209c:	85 c0                	test   %eax,%eax
+  80209e:	78 0e                	js     8020ae <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8020a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8020a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ae:	c9                   	leave
+  8020af:	c3                   	ret
+
+008020b0 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8020b0:	55                   	push   %ebp
+  8020b1:	89 e5                	mov    %esp,%ebp
+  8020b3:	53                   	push   %ebx
+  8020b4:	83 ec 1c             	sub    $0x1c,%esp
+  8020b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020bd:	50                   	push   %eax
+  8020be:	ff 75 08             	push   0x8(%ebp)
+  8020c1:	e8 a6 fb ff ff       	call   801c6c <fd_lookup>
+  8020c6:	83 c4 10             	add    $0x10,%esp
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	78 33                	js     802100 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8020cd:	83 fb 03             	cmp    $0x3,%ebx
+  8020d0:	74 28                	je     8020fa <fcntl+0x4a>
+  8020d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020d7:	83 fb 04             	cmp    $0x4,%ebx
+  8020da:	75 24                	jne    802100 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8020dc:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8020df:	8b 41 08             	mov    0x8(%ecx),%eax
+  8020e2:	80 e4 ef             	and    $0xef,%ah
+  8020e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020e8:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8020ee:	09 d0                	or     %edx,%eax
+  8020f0:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f8:	eb 06                	jmp    802100 <fcntl+0x50>
+		return fd->fd_omode;
+  8020fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020fd:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802100:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802103:	c9                   	leave
+  802104:	c3                   	ret
+
+00802105 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	56                   	push   %esi
+  802109:	53                   	push   %ebx
+  80210a:	83 ec 18             	sub    $0x18,%esp
+  80210d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802110:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802113:	50                   	push   %eax
+  802114:	53                   	push   %ebx
+  802115:	e8 52 fb ff ff       	call   801c6c <fd_lookup>
+  80211a:	83 c4 10             	add    $0x10,%esp
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	78 34                	js     802155 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802121:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802124:	83 ec 08             	sub    $0x8,%esp
+  802127:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212a:	50                   	push   %eax
+  80212b:	ff 36                	push   (%esi)
+  80212d:	e8 8c fb ff ff       	call   801cbe <dev_lookup>
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 1c                	js     802155 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802139:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80213d:	74 1d                	je     80215c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80213f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802142:	8b 40 18             	mov    0x18(%eax),%eax
+  802145:	85 c0                	test   %eax,%eax
+  802147:	74 51                	je     80219a <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802149:	83 ec 08             	sub    $0x8,%esp
+  80214c:	ff 75 0c             	push   0xc(%ebp)
+  80214f:	56                   	push   %esi
+  802150:	ff d0                	call   *%eax
+  802152:	83 c4 10             	add    $0x10,%esp
+}
+  802155:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802158:	5b                   	pop    %ebx
+  802159:	5e                   	pop    %esi
+  80215a:	5d                   	pop    %ebp
+  80215b:	c3                   	ret
+  80215c:	89 e2                	mov    %esp,%edx
+  80215e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802163:	29 d0                	sub    %edx,%eax
+  802165:	89 c2                	mov    %eax,%edx
+  802167:	c1 ea 0f             	shr    $0xf,%edx
+  80216a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80216f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802174:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  802177:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  80217e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802181:	83 ec 04             	sub    $0x4,%esp
+  802184:	53                   	push   %ebx
+  802185:	50                   	push   %eax
+  802186:	68 d0 50 80 00       	push   $0x8050d0
+  80218b:	e8 5b e3 ff ff       	call   8004eb <cprintf>
+		return -E_INVAL;
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802198:	eb bb                	jmp    802155 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80219a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80219f:	eb b4                	jmp    802155 <ftruncate+0x50>
+
+008021a1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	56                   	push   %esi
+  8021a5:	53                   	push   %ebx
+  8021a6:	83 ec 18             	sub    $0x18,%esp
+  8021a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021af:	50                   	push   %eax
+  8021b0:	ff 75 08             	push   0x8(%ebp)
+  8021b3:	e8 b4 fa ff ff       	call   801c6c <fd_lookup>
+  8021b8:	83 c4 10             	add    $0x10,%esp
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	78 53                	js     802212 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021bf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021c2:	83 ec 08             	sub    $0x8,%esp
+  8021c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c8:	50                   	push   %eax
+  8021c9:	ff 36                	push   (%esi)
+  8021cb:	e8 ee fa ff ff       	call   801cbe <dev_lookup>
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 3b                	js     802212 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8021d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021da:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8021de:	74 39                	je     802219 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8021e0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8021e3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021ea:	00 00 00 
+	stat->st_isdir = 0;
+  8021ed:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021f4:	00 00 00 
+	stat->st_version = 0;
+  8021f7:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8021fe:	00 00 00 
+	stat->st_dev = dev;
+  802201:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802207:	83 ec 08             	sub    $0x8,%esp
+  80220a:	53                   	push   %ebx
+  80220b:	56                   	push   %esi
+  80220c:	ff 50 14             	call   *0x14(%eax)
+  80220f:	83 c4 10             	add    $0x10,%esp
+}
+  802212:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802215:	5b                   	pop    %ebx
+  802216:	5e                   	pop    %esi
+  802217:	5d                   	pop    %ebp
+  802218:	c3                   	ret
+		return -E_NOT_SUPP;
+  802219:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80221e:	eb f2                	jmp    802212 <fstat+0x71>
+
+00802220 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802220:	55                   	push   %ebp
+  802221:	89 e5                	mov    %esp,%ebp
+  802223:	56                   	push   %esi
+  802224:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802225:	83 ec 08             	sub    $0x8,%esp
+  802228:	6a 00                	push   $0x0
+  80222a:	ff 75 08             	push   0x8(%ebp)
+  80222d:	e8 b7 01 00 00       	call   8023e9 <open>
+  802232:	89 c3                	mov    %eax,%ebx
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	85 c0                	test   %eax,%eax
+  802239:	78 1b                	js     802256 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80223b:	83 ec 08             	sub    $0x8,%esp
+  80223e:	ff 75 0c             	push   0xc(%ebp)
+  802241:	50                   	push   %eax
+  802242:	e8 5a ff ff ff       	call   8021a1 <fstat>
+  802247:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802249:	89 1c 24             	mov    %ebx,(%esp)
+  80224c:	e8 60 fb ff ff       	call   801db1 <close>
+	return r;
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	89 f3                	mov    %esi,%ebx
+}
+  802256:	89 d8                	mov    %ebx,%eax
+  802258:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80225b:	5b                   	pop    %ebx
+  80225c:	5e                   	pop    %esi
+  80225d:	5d                   	pop    %ebp
+  80225e:	c3                   	ret
+
+0080225f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80225f:	55                   	push   %ebp
+  802260:	89 e5                	mov    %esp,%ebp
+  802262:	56                   	push   %esi
+  802263:	53                   	push   %ebx
+  802264:	89 c6                	mov    %eax,%esi
+  802266:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802268:	83 3d 04 77 80 00 00 	cmpl   $0x0,0x807704
+  80226f:	74 27                	je     802298 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802271:	6a 07                	push   $0x7
+  802273:	68 00 80 80 00       	push   $0x808000
+  802278:	56                   	push   %esi
+  802279:	ff 35 04 77 80 00    	push   0x807704
+  80227f:	e8 22 22 00 00       	call   8044a6 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802284:	83 c4 0c             	add    $0xc,%esp
+  802287:	6a 00                	push   $0x0
+  802289:	53                   	push   %ebx
+  80228a:	6a 00                	push   $0x0
+  80228c:	e8 85 1f 00 00       	call   804216 <ipc_recv>
+}
+  802291:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802294:	5b                   	pop    %ebx
+  802295:	5e                   	pop    %esi
+  802296:	5d                   	pop    %ebp
+  802297:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802298:	83 ec 0c             	sub    $0xc,%esp
+  80229b:	6a 02                	push   $0x2
+  80229d:	e8 6d 22 00 00       	call   80450f <ipc_find_env>
+  8022a2:	a3 04 77 80 00       	mov    %eax,0x807704
+  8022a7:	83 c4 10             	add    $0x10,%esp
+  8022aa:	eb c5                	jmp    802271 <fsipc+0x12>
+
+008022ac <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8022ac:	55                   	push   %ebp
+  8022ad:	89 e5                	mov    %esp,%ebp
+  8022af:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022b8:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8022bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022c0:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8022c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ca:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022cf:	e8 8b ff ff ff       	call   80225f <fsipc>
+}
+  8022d4:	c9                   	leave
+  8022d5:	c3                   	ret
+
+008022d6 <devfile_flush>:
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022e2:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8022e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022f1:	e8 69 ff ff ff       	call   80225f <fsipc>
+}
+  8022f6:	c9                   	leave
+  8022f7:	c3                   	ret
+
+008022f8 <devfile_stat>:
+{
+  8022f8:	55                   	push   %ebp
+  8022f9:	89 e5                	mov    %esp,%ebp
+  8022fb:	53                   	push   %ebx
+  8022fc:	83 ec 04             	sub    $0x4,%esp
+  8022ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802302:	8b 45 08             	mov    0x8(%ebp),%eax
+  802305:	8b 40 0c             	mov    0xc(%eax),%eax
+  802308:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80230d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802312:	b8 05 00 00 00       	mov    $0x5,%eax
+  802317:	e8 43 ff ff ff       	call   80225f <fsipc>
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	78 37                	js     802357 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802320:	83 ec 08             	sub    $0x8,%esp
+  802323:	68 00 80 80 00       	push   $0x808000
+  802328:	53                   	push   %ebx
+  802329:	e8 b4 e8 ff ff       	call   800be2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80232e:	a1 80 80 80 00       	mov    0x808080,%eax
+  802333:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802339:	a1 84 80 80 00       	mov    0x808084,%eax
+  80233e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802344:	a1 88 80 80 00       	mov    0x808088,%eax
+  802349:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80234f:	83 c4 10             	add    $0x10,%esp
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802357:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80235a:	c9                   	leave
+  80235b:	c3                   	ret
+
+0080235c <devfile_write>:
+{
+  80235c:	55                   	push   %ebp
+  80235d:	89 e5                	mov    %esp,%ebp
+  80235f:	83 ec 0c             	sub    $0xc,%esp
+  802362:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802365:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80236a:	39 d0                	cmp    %edx,%eax
+  80236c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80236f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802372:	8b 52 0c             	mov    0xc(%edx),%edx
+  802375:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = count;
+  80237b:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802380:	50                   	push   %eax
+  802381:	ff 75 0c             	push   0xc(%ebp)
+  802384:	68 08 80 80 00       	push   $0x808008
+  802389:	e8 04 ea ff ff       	call   800d92 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80238e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802393:	b8 04 00 00 00       	mov    $0x4,%eax
+  802398:	e8 c2 fe ff ff       	call   80225f <fsipc>
+}
+  80239d:	c9                   	leave
+  80239e:	c3                   	ret
+
+0080239f <devfile_read>:
+{
+  80239f:	55                   	push   %ebp
+  8023a0:	89 e5                	mov    %esp,%ebp
+  8023a2:	53                   	push   %ebx
+  8023a3:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023ac:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8023b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023b4:	a3 04 80 80 00       	mov    %eax,0x808004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8023b9:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8023be:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023c3:	e8 97 fe ff ff       	call   80225f <fsipc>
+  8023c8:	89 c3                	mov    %eax,%ebx
+  8023ca:	85 c0                	test   %eax,%eax
+  8023cc:	78 14                	js     8023e2 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8023ce:	83 ec 04             	sub    $0x4,%esp
+  8023d1:	50                   	push   %eax
+  8023d2:	68 00 80 80 00       	push   $0x808000
+  8023d7:	ff 75 0c             	push   0xc(%ebp)
+  8023da:	e8 b3 e9 ff ff       	call   800d92 <memmove>
+	return r;
+  8023df:	83 c4 10             	add    $0x10,%esp
+}
+  8023e2:	89 d8                	mov    %ebx,%eax
+  8023e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+008023e9 <open>:
+{
+  8023e9:	55                   	push   %ebp
+  8023ea:	89 e5                	mov    %esp,%ebp
+  8023ec:	53                   	push   %ebx
+  8023ed:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8023f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023f3:	50                   	push   %eax
+  8023f4:	e8 23 f8 ff ff       	call   801c1c <fd_alloc>
+  8023f9:	89 c3                	mov    %eax,%ebx
+  8023fb:	83 c4 10             	add    $0x10,%esp
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	78 2a                	js     80242c <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802402:	83 ec 0c             	sub    $0xc,%esp
+  802405:	ff 75 08             	push   0x8(%ebp)
+  802408:	e8 89 e7 ff ff       	call   800b96 <strlen>
+  80240d:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802410:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802415:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80241a:	7e 17                	jle    802433 <open+0x4a>
+	fd_close(fd, 1);
+  80241c:	83 ec 08             	sub    $0x8,%esp
+  80241f:	6a 01                	push   $0x1
+  802421:	ff 75 f4             	push   -0xc(%ebp)
+  802424:	e8 08 f9 ff ff       	call   801d31 <fd_close>
+	return r;
+  802429:	83 c4 10             	add    $0x10,%esp
+}
+  80242c:	89 d8                	mov    %ebx,%eax
+  80242e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802431:	c9                   	leave
+  802432:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802433:	83 ec 08             	sub    $0x8,%esp
+  802436:	ff 75 08             	push   0x8(%ebp)
+  802439:	68 00 80 80 00       	push   $0x808000
+  80243e:	e8 9f e7 ff ff       	call   800be2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802443:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802446:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  80244b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80244e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802453:	e8 07 fe ff ff       	call   80225f <fsipc>
+  802458:	89 c3                	mov    %eax,%ebx
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	78 bb                	js     80241c <open+0x33>
+	return fd2num(fd); 	
+  802461:	83 ec 0c             	sub    $0xc,%esp
+  802464:	ff 75 f4             	push   -0xc(%ebp)
+  802467:	e8 89 f7 ff ff       	call   801bf5 <fd2num>
+  80246c:	89 c3                	mov    %eax,%ebx
+  80246e:	83 c4 10             	add    $0x10,%esp
+  802471:	eb b9                	jmp    80242c <open+0x43>
+
+00802473 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802473:	55                   	push   %ebp
+  802474:	89 e5                	mov    %esp,%ebp
+  802476:	53                   	push   %ebx
+  802477:	83 ec 1c             	sub    $0x1c,%esp
+  80247a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80247d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802480:	50                   	push   %eax
+  802481:	ff 75 08             	push   0x8(%ebp)
+  802484:	e8 e3 f7 ff ff       	call   801c6c <fd_lookup>
+  802489:	83 c4 10             	add    $0x10,%esp
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 5a                	js     8024ea <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802490:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802493:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  802499:	39 10                	cmp    %edx,(%eax)
+  80249b:	75 66                	jne    802503 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  80249d:	83 3d 04 77 80 00 00 	cmpl   $0x0,0x807704
+  8024a4:	74 49                	je     8024ef <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8024a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024ac:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8024b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b4:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_npages = maxpages;
+  8024b9:	89 1d 08 80 80 00    	mov    %ebx,0x808008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8024bf:	6a 07                	push   $0x7
+  8024c1:	68 00 80 80 00       	push   $0x808000
+  8024c6:	6a 09                	push   $0x9
+  8024c8:	ff 35 04 77 80 00    	push   0x807704
+  8024ce:	e8 d3 1f 00 00       	call   8044a6 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8024d3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8024da:	6a 00                	push   $0x0
+  8024dc:	53                   	push   %ebx
+  8024dd:	ff 75 10             	push   0x10(%ebp)
+  8024e0:	6a 00                	push   $0x0
+  8024e2:	e8 fc 1d 00 00       	call   8042e3 <ipc_recv_pages>
+  8024e7:	83 c4 20             	add    $0x20,%esp
+}
+  8024ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ed:	c9                   	leave
+  8024ee:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024ef:	83 ec 0c             	sub    $0xc,%esp
+  8024f2:	6a 02                	push   $0x2
+  8024f4:	e8 16 20 00 00       	call   80450f <ipc_find_env>
+  8024f9:	a3 04 77 80 00       	mov    %eax,0x807704
+  8024fe:	83 c4 10             	add    $0x10,%esp
+  802501:	eb a3                	jmp    8024a6 <fmap+0x33>
+		return -E_INVAL;
+  802503:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802508:	eb e0                	jmp    8024ea <fmap+0x77>
+
+0080250a <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80250a:	55                   	push   %ebp
+  80250b:	89 e5                	mov    %esp,%ebp
+  80250d:	53                   	push   %ebx
+  80250e:	83 ec 10             	sub    $0x10,%esp
+  802511:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802514:	53                   	push   %ebx
+  802515:	e8 7c e6 ff ff       	call   800b96 <strlen>
+  80251a:	83 c4 10             	add    $0x10,%esp
+  80251d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802522:	7f 25                	jg     802549 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802524:	83 ec 08             	sub    $0x8,%esp
+  802527:	53                   	push   %ebx
+  802528:	68 00 80 80 00       	push   $0x808000
+  80252d:	e8 b0 e6 ff ff       	call   800be2 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802532:	ba 00 00 00 00       	mov    $0x0,%edx
+  802537:	b8 07 00 00 00       	mov    $0x7,%eax
+  80253c:	e8 1e fd ff ff       	call   80225f <fsipc>
+  802541:	83 c4 10             	add    $0x10,%esp
+}
+  802544:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802547:	c9                   	leave
+  802548:	c3                   	ret
+		return -E_BAD_PATH;
+  802549:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80254e:	eb f4                	jmp    802544 <remove+0x3a>
+
+00802550 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802560:	e8 fa fc ff ff       	call   80225f <fsipc>
+}
+  802565:	c9                   	leave
+  802566:	c3                   	ret
+
+00802567 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80256d:	68 40 51 80 00       	push   $0x805140
+  802572:	ff 75 0c             	push   0xc(%ebp)
+  802575:	e8 68 e6 ff ff       	call   800be2 <strcpy>
+	return 0;
+}
+  80257a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257f:	c9                   	leave
+  802580:	c3                   	ret
+
+00802581 <devsock_close>:
+{
+  802581:	55                   	push   %ebp
+  802582:	89 e5                	mov    %esp,%ebp
+  802584:	53                   	push   %ebx
+  802585:	83 ec 10             	sub    $0x10,%esp
+  802588:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80258b:	53                   	push   %ebx
+  80258c:	e8 bd 1f 00 00       	call   80454e <pageref>
+  802591:	89 c2                	mov    %eax,%edx
+  802593:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802596:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80259b:	83 fa 01             	cmp    $0x1,%edx
+  80259e:	74 05                	je     8025a5 <devsock_close+0x24>
+}
+  8025a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a3:	c9                   	leave
+  8025a4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8025a5:	83 ec 0c             	sub    $0xc,%esp
+  8025a8:	ff 73 0c             	push   0xc(%ebx)
+  8025ab:	e8 b0 05 00 00       	call   802b60 <nsipc_close>
+  8025b0:	83 c4 10             	add    $0x10,%esp
+  8025b3:	eb eb                	jmp    8025a0 <devsock_close+0x1f>
+
+008025b5 <devsock_write>:
+{
+  8025b5:	55                   	push   %ebp
+  8025b6:	89 e5                	mov    %esp,%ebp
+  8025b8:	53                   	push   %ebx
+  8025b9:	83 ec 14             	sub    $0x14,%esp
+  8025bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025c2:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8025c5:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8025c8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8025cb:	8b 41 08             	mov    0x8(%ecx),%eax
+  8025ce:	c1 f8 09             	sar    $0x9,%eax
+  8025d1:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8025d4:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8025da:	77 13                	ja     8025ef <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8025dc:	50                   	push   %eax
+  8025dd:	52                   	push   %edx
+  8025de:	53                   	push   %ebx
+  8025df:	ff 71 0c             	push   0xc(%ecx)
+  8025e2:	e8 5c 06 00 00       	call   802c43 <nsipc_send>
+  8025e7:	83 c4 10             	add    $0x10,%esp
+}
+  8025ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ed:	c9                   	leave
+  8025ee:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8025ef:	50                   	push   %eax
+  8025f0:	6a 01                	push   $0x1
+  8025f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025f5:	50                   	push   %eax
+  8025f6:	ff 71 0c             	push   0xc(%ecx)
+  8025f9:	e8 a6 06 00 00       	call   802ca4 <nsipc_sendmsg>
+  8025fe:	83 c4 10             	add    $0x10,%esp
+  802601:	eb e7                	jmp    8025ea <devsock_write+0x35>
+
+00802603 <devsock_read>:
+{
+  802603:	55                   	push   %ebp
+  802604:	89 e5                	mov    %esp,%ebp
+  802606:	53                   	push   %ebx
+  802607:	83 ec 14             	sub    $0x14,%esp
+  80260a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80260d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802610:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802613:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802616:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802619:	8b 41 08             	mov    0x8(%ecx),%eax
+  80261c:	c1 f8 09             	sar    $0x9,%eax
+  80261f:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802622:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802628:	77 13                	ja     80263d <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80262a:	50                   	push   %eax
+  80262b:	52                   	push   %edx
+  80262c:	53                   	push   %ebx
+  80262d:	ff 71 0c             	push   0xc(%ecx)
+  802630:	e8 9c 05 00 00       	call   802bd1 <nsipc_recv>
+  802635:	83 c4 10             	add    $0x10,%esp
+}
+  802638:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80263d:	50                   	push   %eax
+  80263e:	6a 01                	push   $0x1
+  802640:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802643:	50                   	push   %eax
+  802644:	ff 71 0c             	push   0xc(%ecx)
+  802647:	e8 02 0a 00 00       	call   80304e <nsipc_recvmsg>
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	eb e7                	jmp    802638 <devsock_read+0x35>
+
+00802651 <fd2sockid>:
+{
+  802651:	55                   	push   %ebp
+  802652:	89 e5                	mov    %esp,%ebp
+  802654:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802657:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80265a:	52                   	push   %edx
+  80265b:	50                   	push   %eax
+  80265c:	e8 0b f6 ff ff       	call   801c6c <fd_lookup>
+  802661:	83 c4 10             	add    $0x10,%esp
+  802664:	85 c0                	test   %eax,%eax
+  802666:	78 10                	js     802678 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802668:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80266b:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  802671:	39 08                	cmp    %ecx,(%eax)
+  802673:	75 05                	jne    80267a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802675:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802678:	c9                   	leave
+  802679:	c3                   	ret
+		return -E_NOT_SUPP;
+  80267a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80267f:	eb f7                	jmp    802678 <fd2sockid+0x27>
+
+00802681 <sock_flags>:
+{
+  802681:	55                   	push   %ebp
+  802682:	89 e5                	mov    %esp,%ebp
+  802684:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802687:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80268a:	52                   	push   %edx
+  80268b:	50                   	push   %eax
+  80268c:	e8 db f5 ff ff       	call   801c6c <fd_lookup>
+  802691:	83 c4 10             	add    $0x10,%esp
+  802694:	85 c0                	test   %eax,%eax
+  802696:	78 0e                	js     8026a6 <sock_flags+0x25>
+  802698:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80269b:	8b 40 08             	mov    0x8(%eax),%eax
+  80269e:	c1 e8 09             	shr    $0x9,%eax
+  8026a1:	83 e0 08             	and    $0x8,%eax
+}
+  8026a4:	c9                   	leave
+  8026a5:	c3                   	ret
+		return 0;
+  8026a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ab:	eb f7                	jmp    8026a4 <sock_flags+0x23>
+
+008026ad <alloc_sockfd>:
+{
+  8026ad:	55                   	push   %ebp
+  8026ae:	89 e5                	mov    %esp,%ebp
+  8026b0:	56                   	push   %esi
+  8026b1:	53                   	push   %ebx
+  8026b2:	83 ec 1c             	sub    $0x1c,%esp
+  8026b5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ba:	50                   	push   %eax
+  8026bb:	e8 5c f5 ff ff       	call   801c1c <fd_alloc>
+  8026c0:	89 c3                	mov    %eax,%ebx
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	85 c0                	test   %eax,%eax
+  8026c7:	78 43                	js     80270c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026c9:	83 ec 04             	sub    $0x4,%esp
+  8026cc:	68 07 04 00 00       	push   $0x407
+  8026d1:	ff 75 f4             	push   -0xc(%ebp)
+  8026d4:	6a 00                	push   $0x0
+  8026d6:	e8 3b e9 ff ff       	call   801016 <sys_page_alloc>
+  8026db:	89 c3                	mov    %eax,%ebx
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	78 28                	js     80270c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8026e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026e7:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  8026ed:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8026ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026f2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8026f9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8026fc:	83 ec 0c             	sub    $0xc,%esp
+  8026ff:	50                   	push   %eax
+  802700:	e8 f0 f4 ff ff       	call   801bf5 <fd2num>
+  802705:	89 c3                	mov    %eax,%ebx
+  802707:	83 c4 10             	add    $0x10,%esp
+  80270a:	eb 0c                	jmp    802718 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80270c:	83 ec 0c             	sub    $0xc,%esp
+  80270f:	56                   	push   %esi
+  802710:	e8 4b 04 00 00       	call   802b60 <nsipc_close>
+		return r;
+  802715:	83 c4 10             	add    $0x10,%esp
+}
+  802718:	89 d8                	mov    %ebx,%eax
+  80271a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80271d:	5b                   	pop    %ebx
+  80271e:	5e                   	pop    %esi
+  80271f:	5d                   	pop    %ebp
+  802720:	c3                   	ret
+
+00802721 <accept>:
+{
+  802721:	55                   	push   %ebp
+  802722:	89 e5                	mov    %esp,%ebp
+  802724:	56                   	push   %esi
+  802725:	53                   	push   %ebx
+  802726:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802729:	89 f0                	mov    %esi,%eax
+  80272b:	e8 21 ff ff ff       	call   802651 <fd2sockid>
+  802730:	89 c3                	mov    %eax,%ebx
+  802732:	85 c0                	test   %eax,%eax
+  802734:	78 24                	js     80275a <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802736:	89 f0                	mov    %esi,%eax
+  802738:	e8 44 ff ff ff       	call   802681 <sock_flags>
+  80273d:	50                   	push   %eax
+  80273e:	ff 75 10             	push   0x10(%ebp)
+  802741:	ff 75 0c             	push   0xc(%ebp)
+  802744:	53                   	push   %ebx
+  802745:	e8 6b 03 00 00       	call   802ab5 <nsipc_accept>
+  80274a:	89 c3                	mov    %eax,%ebx
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	85 c0                	test   %eax,%eax
+  802751:	78 07                	js     80275a <accept+0x39>
+	return alloc_sockfd(r);
+  802753:	e8 55 ff ff ff       	call   8026ad <alloc_sockfd>
+  802758:	89 c3                	mov    %eax,%ebx
+}
+  80275a:	89 d8                	mov    %ebx,%eax
+  80275c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80275f:	5b                   	pop    %ebx
+  802760:	5e                   	pop    %esi
+  802761:	5d                   	pop    %ebp
+  802762:	c3                   	ret
+
+00802763 <bind>:
+{
+  802763:	55                   	push   %ebp
+  802764:	89 e5                	mov    %esp,%ebp
+  802766:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802769:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276c:	e8 e0 fe ff ff       	call   802651 <fd2sockid>
+  802771:	85 c0                	test   %eax,%eax
+  802773:	78 12                	js     802787 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802775:	83 ec 04             	sub    $0x4,%esp
+  802778:	ff 75 10             	push   0x10(%ebp)
+  80277b:	ff 75 0c             	push   0xc(%ebp)
+  80277e:	50                   	push   %eax
+  80277f:	e8 85 03 00 00       	call   802b09 <nsipc_bind>
+  802784:	83 c4 10             	add    $0x10,%esp
+}
+  802787:	c9                   	leave
+  802788:	c3                   	ret
+
+00802789 <shutdown>:
+{
+  802789:	55                   	push   %ebp
+  80278a:	89 e5                	mov    %esp,%ebp
+  80278c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80278f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802792:	e8 ba fe ff ff       	call   802651 <fd2sockid>
+  802797:	85 c0                	test   %eax,%eax
+  802799:	78 0f                	js     8027aa <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80279b:	83 ec 08             	sub    $0x8,%esp
+  80279e:	ff 75 0c             	push   0xc(%ebp)
+  8027a1:	50                   	push   %eax
+  8027a2:	e8 97 03 00 00       	call   802b3e <nsipc_shutdown>
+  8027a7:	83 c4 10             	add    $0x10,%esp
+}
+  8027aa:	c9                   	leave
+  8027ab:	c3                   	ret
+
+008027ac <connect>:
+{
+  8027ac:	55                   	push   %ebp
+  8027ad:	89 e5                	mov    %esp,%ebp
+  8027af:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b5:	e8 97 fe ff ff       	call   802651 <fd2sockid>
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	78 12                	js     8027d0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027be:	83 ec 04             	sub    $0x4,%esp
+  8027c1:	ff 75 10             	push   0x10(%ebp)
+  8027c4:	ff 75 0c             	push   0xc(%ebp)
+  8027c7:	50                   	push   %eax
+  8027c8:	e8 ad 03 00 00       	call   802b7a <nsipc_connect>
+  8027cd:	83 c4 10             	add    $0x10,%esp
+}
+  8027d0:	c9                   	leave
+  8027d1:	c3                   	ret
+
+008027d2 <listen>:
+{
+  8027d2:	55                   	push   %ebp
+  8027d3:	89 e5                	mov    %esp,%ebp
+  8027d5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027db:	e8 71 fe ff ff       	call   802651 <fd2sockid>
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	78 0f                	js     8027f3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027e4:	83 ec 08             	sub    $0x8,%esp
+  8027e7:	ff 75 0c             	push   0xc(%ebp)
+  8027ea:	50                   	push   %eax
+  8027eb:	e8 bf 03 00 00       	call   802baf <nsipc_listen>
+  8027f0:	83 c4 10             	add    $0x10,%esp
+}
+  8027f3:	c9                   	leave
+  8027f4:	c3                   	ret
+
+008027f5 <sendmsg>:
+{
+  8027f5:	55                   	push   %ebp
+  8027f6:	89 e5                	mov    %esp,%ebp
+  8027f8:	57                   	push   %edi
+  8027f9:	56                   	push   %esi
+  8027fa:	53                   	push   %ebx
+  8027fb:	83 ec 0c             	sub    $0xc,%esp
+  8027fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  802801:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802804:	89 f0                	mov    %esi,%eax
+  802806:	e8 46 fe ff ff       	call   802651 <fd2sockid>
+  80280b:	89 c3                	mov    %eax,%ebx
+  80280d:	85 c0                	test   %eax,%eax
+  80280f:	78 1c                	js     80282d <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802811:	89 f0                	mov    %esi,%eax
+  802813:	e8 69 fe ff ff       	call   802681 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802818:	0b 45 10             	or     0x10(%ebp),%eax
+  80281b:	50                   	push   %eax
+  80281c:	ff 77 0c             	push   0xc(%edi)
+  80281f:	ff 77 08             	push   0x8(%edi)
+  802822:	53                   	push   %ebx
+  802823:	e8 7c 04 00 00       	call   802ca4 <nsipc_sendmsg>
+  802828:	89 c3                	mov    %eax,%ebx
+  80282a:	83 c4 10             	add    $0x10,%esp
+}
+  80282d:	89 d8                	mov    %ebx,%eax
+  80282f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802832:	5b                   	pop    %ebx
+  802833:	5e                   	pop    %esi
+  802834:	5f                   	pop    %edi
+  802835:	5d                   	pop    %ebp
+  802836:	c3                   	ret
+
+00802837 <recvmsg>:
+{
+  802837:	55                   	push   %ebp
+  802838:	89 e5                	mov    %esp,%ebp
+  80283a:	57                   	push   %edi
+  80283b:	56                   	push   %esi
+  80283c:	53                   	push   %ebx
+  80283d:	83 ec 0c             	sub    $0xc,%esp
+  802840:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802843:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802846:	89 f8                	mov    %edi,%eax
+  802848:	e8 04 fe ff ff       	call   802651 <fd2sockid>
+  80284d:	89 c3                	mov    %eax,%ebx
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	78 2a                	js     80287d <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802853:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80285a:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802861:	89 f8                	mov    %edi,%eax
+  802863:	e8 19 fe ff ff       	call   802681 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802868:	0b 45 10             	or     0x10(%ebp),%eax
+  80286b:	50                   	push   %eax
+  80286c:	ff 76 0c             	push   0xc(%esi)
+  80286f:	ff 76 08             	push   0x8(%esi)
+  802872:	53                   	push   %ebx
+  802873:	e8 d6 07 00 00       	call   80304e <nsipc_recvmsg>
+  802878:	89 c3                	mov    %eax,%ebx
+  80287a:	83 c4 10             	add    $0x10,%esp
+}
+  80287d:	89 d8                	mov    %ebx,%eax
+  80287f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802882:	5b                   	pop    %ebx
+  802883:	5e                   	pop    %esi
+  802884:	5f                   	pop    %edi
+  802885:	5d                   	pop    %ebp
+  802886:	c3                   	ret
+
+00802887 <sendfile>:
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	56                   	push   %esi
+  80288b:	53                   	push   %ebx
+  80288c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80288f:	89 f0                	mov    %esi,%eax
+  802891:	e8 bb fd ff ff       	call   802651 <fd2sockid>
+  802896:	89 c3                	mov    %eax,%ebx
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	78 1f                	js     8028bb <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80289c:	89 f0                	mov    %esi,%eax
+  80289e:	e8 de fd ff ff       	call   802681 <sock_flags>
+  8028a3:	83 ec 0c             	sub    $0xc,%esp
+  8028a6:	50                   	push   %eax
+  8028a7:	ff 75 14             	push   0x14(%ebp)
+  8028aa:	ff 75 10             	push   0x10(%ebp)
+  8028ad:	ff 75 0c             	push   0xc(%ebp)
+  8028b0:	53                   	push   %ebx
+  8028b1:	e8 64 06 00 00       	call   802f1a <nsipc_sendfile>
+  8028b6:	89 c3                	mov    %eax,%ebx
+  8028b8:	83 c4 20             	add    $0x20,%esp
+}
+  8028bb:	89 d8                	mov    %ebx,%eax
+  8028bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c0:	5b                   	pop    %ebx
+  8028c1:	5e                   	pop    %esi
+  8028c2:	5d                   	pop    %ebp
+  8028c3:	c3                   	ret
+
+008028c4 <evctl>:
+{
+  8028c4:	55                   	push   %ebp
+  8028c5:	89 e5                	mov    %esp,%ebp
+  8028c7:	53                   	push   %ebx
+  8028c8:	83 ec 04             	sub    $0x4,%esp
+  8028cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8028ce:	89 d8                	mov    %ebx,%eax
+  8028d0:	e8 7c fd ff ff       	call   802651 <fd2sockid>
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	78 10                	js     8028e9 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8028d9:	83 ec 04             	sub    $0x4,%esp
+  8028dc:	53                   	push   %ebx
+  8028dd:	ff 75 0c             	push   0xc(%ebp)
+  8028e0:	50                   	push   %eax
+  8028e1:	e8 d2 0b 00 00       	call   8034b8 <nsipc_evctl>
+  8028e6:	83 c4 10             	add    $0x10,%esp
+}
+  8028e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ec:	c9                   	leave
+  8028ed:	c3                   	ret
+
+008028ee <evwait>:
+{
+  8028ee:	55                   	push   %ebp
+  8028ef:	89 e5                	mov    %esp,%ebp
+  8028f1:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8028f4:	ff 75 10             	push   0x10(%ebp)
+  8028f7:	ff 75 0c             	push   0xc(%ebp)
+  8028fa:	ff 75 08             	push   0x8(%ebp)
+  8028fd:	e8 e0 0b 00 00       	call   8034e2 <nsipc_evwait>
+}
+  802902:	c9                   	leave
+  802903:	c3                   	ret
+
+00802904 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802904:	55                   	push   %ebp
+  802905:	89 e5                	mov    %esp,%ebp
+  802907:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80290a:	ff 75 10             	push   0x10(%ebp)
+  80290d:	ff 75 0c             	push   0xc(%ebp)
+  802910:	ff 75 08             	push   0x8(%ebp)
+  802913:	e8 31 0c 00 00       	call   803549 <nsipc_socket>
+  802918:	83 c4 10             	add    $0x10,%esp
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	78 05                	js     802924 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80291f:	e8 89 fd ff ff       	call   8026ad <alloc_sockfd>
+}
+  802924:	c9                   	leave
+  802925:	c3                   	ret
+
+00802926 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802926:	55                   	push   %ebp
+  802927:	89 e5                	mov    %esp,%ebp
+  802929:	53                   	push   %ebx
+  80292a:	83 ec 04             	sub    $0x4,%esp
+  80292d:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80292f:	83 3d 24 7a 80 00 00 	cmpl   $0x0,0x807a24
+  802936:	74 26                	je     80295e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802938:	6a 07                	push   $0x7
+  80293a:	68 00 90 80 00       	push   $0x809000
+  80293f:	53                   	push   %ebx
+  802940:	ff 35 24 7a 80 00    	push   0x807a24
+  802946:	e8 5b 1b 00 00       	call   8044a6 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80294b:	83 c4 0c             	add    $0xc,%esp
+  80294e:	6a 00                	push   $0x0
+  802950:	6a 00                	push   $0x0
+  802952:	6a 00                	push   $0x0
+  802954:	e8 bd 18 00 00       	call   804216 <ipc_recv>
+}
+  802959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80295c:	c9                   	leave
+  80295d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80295e:	83 ec 0c             	sub    $0xc,%esp
+  802961:	6a 03                	push   $0x3
+  802963:	e8 a7 1b 00 00       	call   80450f <ipc_find_env>
+  802968:	a3 24 7a 80 00       	mov    %eax,0x807a24
+  80296d:	83 c4 10             	add    $0x10,%esp
+  802970:	eb c6                	jmp    802938 <nsipc+0x12>
+
+00802972 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802972:	55                   	push   %ebp
+  802973:	89 e5                	mov    %esp,%ebp
+  802975:	56                   	push   %esi
+  802976:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802977:	8b 35 30 7a 80 00    	mov    0x807a30,%esi
+		return 0;
+  80297d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802982:	85 f6                	test   %esi,%esi
+  802984:	75 33                	jne    8029b9 <nsbulk_map+0x47>
+  802986:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80298b:	83 ec 04             	sub    $0x4,%esp
+  80298e:	6a 07                	push   $0x7
+  802990:	53                   	push   %ebx
+  802991:	6a 00                	push   $0x0
+  802993:	e8 7e e6 ff ff       	call   801016 <sys_page_alloc>
+  802998:	83 c4 10             	add    $0x10,%esp
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	78 1a                	js     8029b9 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80299f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8029a5:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8029ab:	75 de                	jne    80298b <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8029ad:	c7 05 30 7a 80 00 01 	movl   $0x1,0x807a30
+  8029b4:	00 00 00 
+	return 0;
+  8029b7:	89 f0                	mov    %esi,%eax
+}
+  8029b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029bc:	5b                   	pop    %ebx
+  8029bd:	5e                   	pop    %esi
+  8029be:	5d                   	pop    %ebp
+  8029bf:	c3                   	ret
+
+008029c0 <nsbulk_own>:
+{
+  8029c0:	55                   	push   %ebp
+  8029c1:	89 e5                	mov    %esp,%ebp
+  8029c3:	57                   	push   %edi
+  8029c4:	56                   	push   %esi
+  8029c5:	53                   	push   %ebx
+  8029c6:	83 ec 0c             	sub    $0xc,%esp
+  8029c9:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8029cb:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8029ce:	85 d2                	test   %edx,%edx
+  8029d0:	7f 0e                	jg     8029e0 <nsbulk_own+0x20>
+	return 0;
+  8029d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d7:	eb 47                	jmp    802a20 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8029d9:	83 c3 01             	add    $0x1,%ebx
+  8029dc:	39 fb                	cmp    %edi,%ebx
+  8029de:	7d 3b                	jge    802a1b <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8029e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029e5:	89 d9                	mov    %ebx,%ecx
+  8029e7:	d3 e6                	shl    %cl,%esi
+  8029e9:	89 f0                	mov    %esi,%eax
+  8029eb:	23 05 2c 7a 80 00    	and    0x807a2c,%eax
+  8029f1:	74 e6                	je     8029d9 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8029f3:	83 ec 04             	sub    $0x4,%esp
+  8029f6:	6a 07                	push   $0x7
+  8029f8:	89 d8                	mov    %ebx,%eax
+  8029fa:	c1 e0 0c             	shl    $0xc,%eax
+  8029fd:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802a02:	50                   	push   %eax
+  802a03:	6a 00                	push   $0x0
+  802a05:	e8 0c e6 ff ff       	call   801016 <sys_page_alloc>
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	85 c0                	test   %eax,%eax
+  802a0f:	78 0f                	js     802a20 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802a11:	f7 d6                	not    %esi
+  802a13:	21 35 2c 7a 80 00    	and    %esi,0x807a2c
+  802a19:	eb be                	jmp    8029d9 <nsbulk_own+0x19>
+	return 0;
+  802a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a23:	5b                   	pop    %ebx
+  802a24:	5e                   	pop    %esi
+  802a25:	5f                   	pop    %edi
+  802a26:	5d                   	pop    %ebp
+  802a27:	c3                   	ret
+
+00802a28 <nsipc_bulk>:
+{
+  802a28:	55                   	push   %ebp
+  802a29:	89 e5                	mov    %esp,%ebp
+  802a2b:	57                   	push   %edi
+  802a2c:	56                   	push   %esi
+  802a2d:	53                   	push   %ebx
+  802a2e:	83 ec 1c             	sub    $0x1c,%esp
+  802a31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a34:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802a36:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802a3c:	c1 fb 0c             	sar    $0xc,%ebx
+  802a3f:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802a42:	83 3d 24 7a 80 00 00 	cmpl   $0x0,0x807a24
+  802a49:	74 56                	je     802aa1 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a4b:	85 ff                	test   %edi,%edi
+  802a4d:	7e 24                	jle    802a73 <nsipc_bulk+0x4b>
+  802a4f:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802a55:	74 1c                	je     802a73 <nsipc_bulk+0x4b>
+  802a57:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802a5d:	c1 e3 0c             	shl    $0xc,%ebx
+  802a60:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802a65:	0f b6 10             	movzbl (%eax),%edx
+  802a68:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a6a:	05 00 10 00 00       	add    $0x1000,%eax
+  802a6f:	39 d8                	cmp    %ebx,%eax
+  802a71:	75 f2                	jne    802a65 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802a73:	83 ec 0c             	sub    $0xc,%esp
+  802a76:	56                   	push   %esi
+  802a77:	57                   	push   %edi
+  802a78:	68 00 00 00 e0       	push   $0xe0000000
+  802a7d:	ff 75 e4             	push   -0x1c(%ebp)
+  802a80:	ff 35 24 7a 80 00    	push   0x807a24
+  802a86:	e8 4f 1a 00 00       	call   8044da <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802a8b:	83 c4 1c             	add    $0x1c,%esp
+  802a8e:	6a 00                	push   $0x0
+  802a90:	6a 00                	push   $0x0
+  802a92:	6a 00                	push   $0x0
+  802a94:	e8 7d 17 00 00       	call   804216 <ipc_recv>
+}
+  802a99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a9c:	5b                   	pop    %ebx
+  802a9d:	5e                   	pop    %esi
+  802a9e:	5f                   	pop    %edi
+  802a9f:	5d                   	pop    %ebp
+  802aa0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802aa1:	83 ec 0c             	sub    $0xc,%esp
+  802aa4:	6a 03                	push   $0x3
+  802aa6:	e8 64 1a 00 00       	call   80450f <ipc_find_env>
+  802aab:	a3 24 7a 80 00       	mov    %eax,0x807a24
+  802ab0:	83 c4 10             	add    $0x10,%esp
+  802ab3:	eb 96                	jmp    802a4b <nsipc_bulk+0x23>
+
+00802ab5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	53                   	push   %ebx
+  802ab9:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abf:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_flags = flags;
+  802ac4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ac7:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802acc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ad1:	e8 50 fe ff ff       	call   802926 <nsipc>
+  802ad6:	89 c3                	mov    %eax,%ebx
+  802ad8:	85 c0                	test   %eax,%eax
+  802ada:	79 07                	jns    802ae3 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802adc:	89 d8                	mov    %ebx,%eax
+  802ade:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ae1:	c9                   	leave
+  802ae2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802ae3:	83 ec 04             	sub    $0x4,%esp
+  802ae6:	ff 35 10 90 80 00    	push   0x809010
+  802aec:	68 00 90 80 00       	push   $0x809000
+  802af1:	ff 75 0c             	push   0xc(%ebp)
+  802af4:	e8 99 e2 ff ff       	call   800d92 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802af9:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  802aff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b02:	89 10                	mov    %edx,(%eax)
+  802b04:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b07:	eb d3                	jmp    802adc <nsipc_accept+0x27>
+
+00802b09 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	53                   	push   %ebx
+  802b0d:	83 ec 08             	sub    $0x8,%esp
+  802b10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b16:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b1b:	53                   	push   %ebx
+  802b1c:	ff 75 0c             	push   0xc(%ebp)
+  802b1f:	68 04 90 80 00       	push   $0x809004
+  802b24:	e8 69 e2 ff ff       	call   800d92 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b29:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802b2f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b34:	e8 ed fd ff ff       	call   802926 <nsipc>
+}
+  802b39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+
+00802b3e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b3e:	55                   	push   %ebp
+  802b3f:	89 e5                	mov    %esp,%ebp
+  802b41:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b47:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802b4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b4f:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b54:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b59:	e8 c8 fd ff ff       	call   802926 <nsipc>
+}
+  802b5e:	c9                   	leave
+  802b5f:	c3                   	ret
+
+00802b60 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b69:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802b6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b73:	e8 ae fd ff ff       	call   802926 <nsipc>
+}
+  802b78:	c9                   	leave
+  802b79:	c3                   	ret
+
+00802b7a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b7a:	55                   	push   %ebp
+  802b7b:	89 e5                	mov    %esp,%ebp
+  802b7d:	53                   	push   %ebx
+  802b7e:	83 ec 08             	sub    $0x8,%esp
+  802b81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b87:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b8c:	53                   	push   %ebx
+  802b8d:	ff 75 0c             	push   0xc(%ebp)
+  802b90:	68 04 90 80 00       	push   $0x809004
+  802b95:	e8 f8 e1 ff ff       	call   800d92 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b9a:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802ba0:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ba5:	e8 7c fd ff ff       	call   802926 <nsipc>
+}
+  802baa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bad:	c9                   	leave
+  802bae:	c3                   	ret
+
+00802baf <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802baf:	55                   	push   %ebp
+  802bb0:	89 e5                	mov    %esp,%ebp
+  802bb2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802bbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bc0:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802bc5:	b8 06 00 00 00       	mov    $0x6,%eax
+  802bca:	e8 57 fd ff ff       	call   802926 <nsipc>
+}
+  802bcf:	c9                   	leave
+  802bd0:	c3                   	ret
+
+00802bd1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802bd1:	55                   	push   %ebp
+  802bd2:	89 e5                	mov    %esp,%ebp
+  802bd4:	56                   	push   %esi
+  802bd5:	53                   	push   %ebx
+  802bd6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdc:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802be1:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802be7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bea:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802bef:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bf4:	e8 2d fd ff ff       	call   802926 <nsipc>
+  802bf9:	89 c3                	mov    %eax,%ebx
+  802bfb:	85 c0                	test   %eax,%eax
+  802bfd:	78 22                	js     802c21 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802bff:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c04:	39 c6                	cmp    %eax,%esi
+  802c06:	0f 4e c6             	cmovle %esi,%eax
+  802c09:	39 c3                	cmp    %eax,%ebx
+  802c0b:	7f 1d                	jg     802c2a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c0d:	83 ec 04             	sub    $0x4,%esp
+  802c10:	53                   	push   %ebx
+  802c11:	68 00 90 80 00       	push   $0x809000
+  802c16:	ff 75 0c             	push   0xc(%ebp)
+  802c19:	e8 74 e1 ff ff       	call   800d92 <memmove>
+  802c1e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c21:	89 d8                	mov    %ebx,%eax
+  802c23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c26:	5b                   	pop    %ebx
+  802c27:	5e                   	pop    %esi
+  802c28:	5d                   	pop    %ebp
+  802c29:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c2a:	68 4c 51 80 00       	push   $0x80514c
+  802c2f:	68 61 51 80 00       	push   $0x805161
+  802c34:	68 b2 00 00 00       	push   $0xb2
+  802c39:	68 76 51 80 00       	push   $0x805176
+  802c3e:	e8 cd d7 ff ff       	call   800410 <_panic>
+
+00802c43 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	53                   	push   %ebx
+  802c47:	83 ec 04             	sub    $0x4,%esp
+  802c4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c50:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802c55:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c5b:	7f 2e                	jg     802c8b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c5d:	83 ec 04             	sub    $0x4,%esp
+  802c60:	53                   	push   %ebx
+  802c61:	ff 75 0c             	push   0xc(%ebp)
+  802c64:	68 0c 90 80 00       	push   $0x80900c
+  802c69:	e8 24 e1 ff ff       	call   800d92 <memmove>
+	nsipcbuf.send.req_size = size;
+  802c6e:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802c74:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c77:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802c7c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c81:	e8 a0 fc ff ff       	call   802926 <nsipc>
+}
+  802c86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c89:	c9                   	leave
+  802c8a:	c3                   	ret
+	assert(size < 1600);
+  802c8b:	68 82 51 80 00       	push   $0x805182
+  802c90:	68 61 51 80 00       	push   $0x805161
+  802c95:	68 bd 00 00 00       	push   $0xbd
+  802c9a:	68 76 51 80 00       	push   $0x805176
+  802c9f:	e8 6c d7 ff ff       	call   800410 <_panic>
+
+00802ca4 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802ca4:	55                   	push   %ebp
+  802ca5:	89 e5                	mov    %esp,%ebp
+  802ca7:	57                   	push   %edi
+  802ca8:	56                   	push   %esi
+  802ca9:	53                   	push   %ebx
+  802caa:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802cad:	e8 c0 fc ff ff       	call   802972 <nsbulk_map>
+  802cb2:	85 c0                	test   %eax,%eax
+  802cb4:	78 55                	js     802d0b <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802cb6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802cbd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802cc4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802ccb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802cce:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802cd1:	0f 8d 24 02 00 00    	jge    802efb <nsipc_sendmsg+0x257>
+  802cd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cda:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802cdd:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802ce0:	89 d8                	mov    %ebx,%eax
+  802ce2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ce7:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802ce9:	83 ec 0c             	sub    $0xc,%esp
+  802cec:	68 20 77 80 00       	push   $0x807720
+  802cf1:	e8 bc 0f 00 00       	call   803cb2 <pgbatch_init>
+  802cf6:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802cf9:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802cfb:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802cfe:	e9 82 00 00 00       	jmp    802d85 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802d03:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802d06:	85 db                	test   %ebx,%ebx
+  802d08:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d0e:	5b                   	pop    %ebx
+  802d0f:	5e                   	pop    %esi
+  802d10:	5f                   	pop    %edi
+  802d11:	5d                   	pop    %ebp
+  802d12:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802d13:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802d18:	29 c8                	sub    %ecx,%eax
+  802d1a:	39 d0                	cmp    %edx,%eax
+  802d1c:	0f 46 d0             	cmovbe %eax,%edx
+  802d1f:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802d21:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d27:	85 ff                	test   %edi,%edi
+  802d29:	0f 49 c7             	cmovns %edi,%eax
+  802d2c:	c1 f8 0c             	sar    $0xc,%eax
+  802d2f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d34:	e8 87 fc ff ff       	call   8029c0 <nsbulk_own>
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	0f 88 17 01 00 00    	js     802e58 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802d41:	83 ec 04             	sub    $0x4,%esp
+  802d44:	56                   	push   %esi
+  802d45:	ff 75 e0             	push   -0x20(%ebp)
+  802d48:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d4b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802d50:	50                   	push   %eax
+  802d51:	e8 3c e0 ff ff       	call   800d92 <memmove>
+  802d56:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802d59:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802d5c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d5f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802d62:	0f 84 fd 00 00 00    	je     802e65 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802d68:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d6b:	01 f7                	add    %esi,%edi
+  802d6d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d70:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802d73:	0f 8d 01 01 00 00    	jge    802e7a <nsipc_sendmsg+0x1d6>
+  802d79:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802d7f:	0f 8f f0 00 00 00    	jg     802e75 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802d85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d88:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802d8b:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802d8e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d91:	89 c2                	mov    %eax,%edx
+  802d93:	03 13                	add    (%ebx),%edx
+  802d95:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802d98:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d9b:	29 c6                	sub    %eax,%esi
+  802d9d:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802da2:	29 f9                	sub    %edi,%ecx
+  802da4:	39 ce                	cmp    %ecx,%esi
+  802da6:	89 ca                	mov    %ecx,%edx
+  802da8:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802dab:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802dae:	89 f9                	mov    %edi,%ecx
+  802db0:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802db6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802db9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802dbe:	09 c8                	or     %ecx,%eax
+  802dc0:	0f 85 4d ff ff ff    	jne    802d13 <nsipc_sendmsg+0x6f>
+  802dc6:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802dcc:	0f 86 41 ff ff ff    	jbe    802d13 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802dd2:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802dd8:	85 ff                	test   %edi,%edi
+  802dda:	0f 49 c7             	cmovns %edi,%eax
+  802ddd:	c1 f8 0c             	sar    $0xc,%eax
+  802de0:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802de2:	89 d1                	mov    %edx,%ecx
+  802de4:	c1 e9 0c             	shr    $0xc,%ecx
+  802de7:	01 c8                	add    %ecx,%eax
+  802de9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802dec:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802def:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802df1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802df4:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802df9:	29 c8                	sub    %ecx,%eax
+  802dfb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802dfe:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802e01:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e03:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e08:	89 f9                	mov    %edi,%ecx
+  802e0a:	d3 e0                	shl    %cl,%eax
+  802e0c:	09 05 2c 7a 80 00    	or     %eax,0x807a2c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e12:	83 ec 08             	sub    $0x8,%esp
+  802e15:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802e17:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e1a:	50                   	push   %eax
+  802e1b:	6a 00                	push   $0x0
+  802e1d:	56                   	push   %esi
+  802e1e:	6a 00                	push   $0x0
+  802e20:	68 20 77 80 00       	push   $0x807720
+  802e25:	e8 46 0f 00 00       	call   803d70 <pgbatch_map>
+  802e2a:	83 c4 20             	add    $0x20,%esp
+  802e2d:	85 c0                	test   %eax,%eax
+  802e2f:	0f 88 ce fe ff ff    	js     802d03 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802e35:	83 c7 01             	add    $0x1,%edi
+  802e38:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e3e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e41:	39 c7                	cmp    %eax,%edi
+  802e43:	75 be                	jne    802e03 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802e45:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802e48:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802e4b:	89 d6                	mov    %edx,%esi
+  802e4d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802e53:	e9 01 ff ff ff       	jmp    802d59 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802e58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e5b:	85 db                	test   %ebx,%ebx
+  802e5d:	0f 45 c3             	cmovne %ebx,%eax
+  802e60:	e9 a6 fe ff ff       	jmp    802d0b <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802e65:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802e69:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e70:	e9 f3 fe ff ff       	jmp    802d68 <nsipc_sendmsg+0xc4>
+  802e75:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802e78:	eb 03                	jmp    802e7d <nsipc_sendmsg+0x1d9>
+  802e7a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802e7d:	83 ec 0c             	sub    $0xc,%esp
+  802e80:	68 20 77 80 00       	push   $0x807720
+  802e85:	e8 36 0e 00 00       	call   803cc0 <pgbatch_flush>
+  802e8a:	83 c4 10             	add    $0x10,%esp
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	78 50                	js     802ee1 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802e91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e94:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802e99:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802e9f:	89 fb                	mov    %edi,%ebx
+  802ea1:	29 f3                	sub    %esi,%ebx
+  802ea3:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802ea9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eac:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802eb1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802eb6:	89 fa                	mov    %edi,%edx
+  802eb8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802ebd:	e8 66 fb ff ff       	call   802a28 <nsipc_bulk>
+  802ec2:	85 c0                	test   %eax,%eax
+  802ec4:	78 28                	js     802eee <nsipc_sendmsg+0x24a>
+		sent += r;
+  802ec6:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802ec9:	39 c3                	cmp    %eax,%ebx
+  802ecb:	75 0c                	jne    802ed9 <nsipc_sendmsg+0x235>
+  802ecd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ed0:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802ed3:	0f 8f f2 fd ff ff    	jg     802ccb <nsipc_sendmsg+0x27>
+		sent += r;
+  802ed9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802edc:	e9 2a fe ff ff       	jmp    802d0b <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802ee1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ee4:	85 db                	test   %ebx,%ebx
+  802ee6:	0f 45 c3             	cmovne %ebx,%eax
+  802ee9:	e9 1d fe ff ff       	jmp    802d0b <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802eee:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ef1:	85 db                	test   %ebx,%ebx
+  802ef3:	0f 45 c3             	cmovne %ebx,%eax
+  802ef6:	e9 10 fe ff ff       	jmp    802d0b <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802efb:	83 ec 0c             	sub    $0xc,%esp
+  802efe:	68 20 77 80 00       	push   $0x807720
+  802f03:	e8 aa 0d 00 00       	call   803cb2 <pgbatch_init>
+  802f08:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802f0b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f15:	e9 63 ff ff ff       	jmp    802e7d <nsipc_sendmsg+0x1d9>
+
+00802f1a <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802f1a:	55                   	push   %ebp
+  802f1b:	89 e5                	mov    %esp,%ebp
+  802f1d:	57                   	push   %edi
+  802f1e:	56                   	push   %esi
+  802f1f:	53                   	push   %ebx
+  802f20:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802f23:	83 3d 28 7a 80 00 00 	cmpl   $0x0,0x807a28
+  802f2a:	0f 84 c8 00 00 00    	je     802ff8 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802f30:	83 3d 24 7a 80 00 00 	cmpl   $0x0,0x807a24
+  802f37:	0f 84 e4 00 00 00    	je     803021 <nsipc_sendfile+0x107>
+{
+  802f3d:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802f42:	89 fb                	mov    %edi,%ebx
+  802f44:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802f47:	0f 83 f0 00 00 00    	jae    80303d <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802f4d:	89 fa                	mov    %edi,%edx
+  802f4f:	03 55 10             	add    0x10(%ebp),%edx
+  802f52:	89 d0                	mov    %edx,%eax
+  802f54:	c1 f8 1f             	sar    $0x1f,%eax
+  802f57:	c1 e8 14             	shr    $0x14,%eax
+  802f5a:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802f5d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802f63:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802f65:	6a 10                	push   $0x10
+  802f67:	68 00 20 01 e0       	push   $0xe0012000
+  802f6c:	52                   	push   %edx
+  802f6d:	ff 75 0c             	push   0xc(%ebp)
+  802f70:	e8 fe f4 ff ff       	call   802473 <fmap>
+  802f75:	83 c4 10             	add    $0x10,%esp
+  802f78:	85 c0                	test   %eax,%eax
+  802f7a:	0f 8e b8 00 00 00    	jle    803038 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802f80:	39 c6                	cmp    %eax,%esi
+  802f82:	0f 8d b5 00 00 00    	jge    80303d <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802f88:	29 f0                	sub    %esi,%eax
+  802f8a:	8b 55 14             	mov    0x14(%ebp),%edx
+  802f8d:	29 da                	sub    %ebx,%edx
+  802f8f:	39 d0                	cmp    %edx,%eax
+  802f91:	89 d3                	mov    %edx,%ebx
+  802f93:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802f96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f99:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802f9e:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802fa4:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802faa:	8b 45 18             	mov    0x18(%ebp),%eax
+  802fad:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802fb2:	83 ec 0c             	sub    $0xc,%esp
+  802fb5:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802fb7:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802fbe:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802fc1:	83 c0 01             	add    $0x1,%eax
+  802fc4:	50                   	push   %eax
+  802fc5:	68 00 10 01 e0       	push   $0xe0011000
+  802fca:	6a 11                	push   $0x11
+  802fcc:	ff 35 24 7a 80 00    	push   0x807a24
+  802fd2:	e8 03 15 00 00       	call   8044da <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802fd7:	83 c4 1c             	add    $0x1c,%esp
+  802fda:	6a 00                	push   $0x0
+  802fdc:	6a 00                	push   $0x0
+  802fde:	6a 00                	push   $0x0
+  802fe0:	e8 31 12 00 00       	call   804216 <ipc_recv>
+  802fe5:	83 c4 10             	add    $0x10,%esp
+  802fe8:	85 c0                	test   %eax,%eax
+  802fea:	78 5b                	js     803047 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802fec:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802fee:	39 c3                	cmp    %eax,%ebx
+  802ff0:	0f 8e 4c ff ff ff    	jle    802f42 <nsipc_sendfile+0x28>
+  802ff6:	eb 45                	jmp    80303d <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802ff8:	83 ec 04             	sub    $0x4,%esp
+  802ffb:	6a 07                	push   $0x7
+  802ffd:	68 00 10 01 e0       	push   $0xe0011000
+  803002:	6a 00                	push   $0x0
+  803004:	e8 0d e0 ff ff       	call   801016 <sys_page_alloc>
+  803009:	89 c7                	mov    %eax,%edi
+  80300b:	83 c4 10             	add    $0x10,%esp
+  80300e:	85 c0                	test   %eax,%eax
+  803010:	78 2b                	js     80303d <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803012:	c7 05 28 7a 80 00 01 	movl   $0x1,0x807a28
+  803019:	00 00 00 
+  80301c:	e9 0f ff ff ff       	jmp    802f30 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803021:	83 ec 0c             	sub    $0xc,%esp
+  803024:	6a 03                	push   $0x3
+  803026:	e8 e4 14 00 00       	call   80450f <ipc_find_env>
+  80302b:	a3 24 7a 80 00       	mov    %eax,0x807a24
+  803030:	83 c4 10             	add    $0x10,%esp
+  803033:	e9 05 ff ff ff       	jmp    802f3d <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803038:	85 ff                	test   %edi,%edi
+  80303a:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80303d:	89 f8                	mov    %edi,%eax
+  80303f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803042:	5b                   	pop    %ebx
+  803043:	5e                   	pop    %esi
+  803044:	5f                   	pop    %edi
+  803045:	5d                   	pop    %ebp
+  803046:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803047:	85 ff                	test   %edi,%edi
+  803049:	0f 44 f8             	cmove  %eax,%edi
+  80304c:	eb ef                	jmp    80303d <nsipc_sendfile+0x123>
+
+0080304e <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80304e:	55                   	push   %ebp
+  80304f:	89 e5                	mov    %esp,%ebp
+  803051:	57                   	push   %edi
+  803052:	56                   	push   %esi
+  803053:	53                   	push   %ebx
+  803054:	83 ec 1c             	sub    $0x1c,%esp
+  803057:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80305a:	e8 13 f9 ff ff       	call   802972 <nsbulk_map>
+  80305f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803062:	85 c0                	test   %eax,%eax
+  803064:	0f 88 ba 00 00 00    	js     803124 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80306a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80306e:	0f 8e bb 00 00 00    	jle    80312f <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803074:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803079:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80307e:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803083:	89 f8                	mov    %edi,%eax
+  803085:	29 f0                	sub    %esi,%eax
+  803087:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80308b:	39 c8                	cmp    %ecx,%eax
+  80308d:	0f 47 c1             	cmova  %ecx,%eax
+  803090:	01 f0                	add    %esi,%eax
+  803092:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803094:	83 c2 01             	add    $0x1,%edx
+  803097:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80309a:	7e 07                	jle    8030a3 <nsipc_recvmsg+0x55>
+  80309c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8030a1:	7e e0                	jle    803083 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8030a3:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8030a9:	c1 fa 0c             	sar    $0xc,%edx
+  8030ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b1:	e8 0a f9 ff ff       	call   8029c0 <nsbulk_own>
+  8030b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	78 67                	js     803124 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8030bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c0:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8030c5:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8030cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030ce:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8030d3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030d8:	89 f2                	mov    %esi,%edx
+  8030da:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8030df:	e8 44 f9 ff ff       	call   802a28 <nsipc_bulk>
+  8030e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030e7:	85 c0                	test   %eax,%eax
+  8030e9:	78 39                	js     803124 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8030eb:	39 f0                	cmp    %esi,%eax
+  8030ed:	7f 4a                	jg     803139 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8030ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f4:	85 c0                	test   %eax,%eax
+  8030f6:	7e 2c                	jle    803124 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8030f8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8030fb:	29 fe                	sub    %edi,%esi
+  8030fd:	8b 43 04             	mov    0x4(%ebx),%eax
+  803100:	39 c6                	cmp    %eax,%esi
+  803102:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803105:	83 ec 04             	sub    $0x4,%esp
+  803108:	56                   	push   %esi
+  803109:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80310f:	50                   	push   %eax
+  803110:	ff 33                	push   (%ebx)
+  803112:	e8 7b dc ff ff       	call   800d92 <memmove>
+		n += m;
+  803117:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803119:	83 c3 08             	add    $0x8,%ebx
+  80311c:	83 c4 10             	add    $0x10,%esp
+  80311f:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803122:	7f d4                	jg     8030f8 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803124:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80312a:	5b                   	pop    %ebx
+  80312b:	5e                   	pop    %esi
+  80312c:	5f                   	pop    %edi
+  80312d:	5d                   	pop    %ebp
+  80312e:	c3                   	ret
+	int r, i, n, len = 0;
+  80312f:	be 00 00 00 00       	mov    $0x0,%esi
+  803134:	e9 6a ff ff ff       	jmp    8030a3 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803139:	68 58 51 80 00       	push   $0x805158
+  80313e:	68 61 51 80 00       	push   $0x805161
+  803143:	68 3b 01 00 00       	push   $0x13b
+  803148:	68 76 51 80 00       	push   $0x805176
+  80314d:	e8 be d2 ff ff       	call   800410 <_panic>
+
+00803152 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803152:	55                   	push   %ebp
+  803153:	89 e5                	mov    %esp,%ebp
+  803155:	57                   	push   %edi
+  803156:	56                   	push   %esi
+  803157:	53                   	push   %ebx
+  803158:	83 ec 0c             	sub    $0xc,%esp
+  80315b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80315e:	8b 75 10             	mov    0x10(%ebp),%esi
+  803161:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803164:	8b 45 08             	mov    0x8(%ebp),%eax
+  803167:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.select.req_readset = *readset;
+  80316c:	8b 07                	mov    (%edi),%eax
+  80316e:	a3 04 90 80 00       	mov    %eax,0x809004
+  803173:	8b 47 04             	mov    0x4(%edi),%eax
+  803176:	a3 08 90 80 00       	mov    %eax,0x809008
+  80317b:	8b 47 08             	mov    0x8(%edi),%eax
+  80317e:	a3 0c 90 80 00       	mov    %eax,0x80900c
+  803183:	8b 47 0c             	mov    0xc(%edi),%eax
+  803186:	a3 10 90 80 00       	mov    %eax,0x809010
+  80318b:	8b 47 10             	mov    0x10(%edi),%eax
+  80318e:	a3 14 90 80 00       	mov    %eax,0x809014
+  803193:	8b 47 14             	mov    0x14(%edi),%eax
+  803196:	a3 18 90 80 00       	mov    %eax,0x809018
+  80319b:	8b 47 18             	mov    0x18(%edi),%eax
+  80319e:	a3 1c 90 80 00       	mov    %eax,0x80901c
+  8031a3:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8031a6:	a3 20 90 80 00       	mov    %eax,0x809020
+  8031ab:	8b 47 20             	mov    0x20(%edi),%eax
+  8031ae:	a3 24 90 80 00       	mov    %eax,0x809024
+  8031b3:	8b 47 24             	mov    0x24(%edi),%eax
+  8031b6:	a3 28 90 80 00       	mov    %eax,0x809028
+  8031bb:	8b 47 28             	mov    0x28(%edi),%eax
+  8031be:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  8031c3:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8031c6:	a3 30 90 80 00       	mov    %eax,0x809030
+  8031cb:	8b 47 30             	mov    0x30(%edi),%eax
+  8031ce:	a3 34 90 80 00       	mov    %eax,0x809034
+  8031d3:	8b 47 34             	mov    0x34(%edi),%eax
+  8031d6:	a3 38 90 80 00       	mov    %eax,0x809038
+  8031db:	8b 47 38             	mov    0x38(%edi),%eax
+  8031de:	a3 3c 90 80 00       	mov    %eax,0x80903c
+  8031e3:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8031e6:	a3 40 90 80 00       	mov    %eax,0x809040
+	nsipcbuf.select.req_writeset = *writeset;
+  8031eb:	8b 06                	mov    (%esi),%eax
+  8031ed:	a3 44 90 80 00       	mov    %eax,0x809044
+  8031f2:	8b 46 04             	mov    0x4(%esi),%eax
+  8031f5:	a3 48 90 80 00       	mov    %eax,0x809048
+  8031fa:	8b 46 08             	mov    0x8(%esi),%eax
+  8031fd:	a3 4c 90 80 00       	mov    %eax,0x80904c
+  803202:	8b 46 0c             	mov    0xc(%esi),%eax
+  803205:	a3 50 90 80 00       	mov    %eax,0x809050
+  80320a:	8b 46 10             	mov    0x10(%esi),%eax
+  80320d:	a3 54 90 80 00       	mov    %eax,0x809054
+  803212:	8b 46 14             	mov    0x14(%esi),%eax
+  803215:	a3 58 90 80 00       	mov    %eax,0x809058
+  80321a:	8b 46 18             	mov    0x18(%esi),%eax
+  80321d:	a3 5c 90 80 00       	mov    %eax,0x80905c
+  803222:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803225:	a3 60 90 80 00       	mov    %eax,0x809060
+  80322a:	8b 46 20             	mov    0x20(%esi),%eax
+  80322d:	a3 64 90 80 00       	mov    %eax,0x809064
+  803232:	8b 46 24             	mov    0x24(%esi),%eax
+  803235:	a3 68 90 80 00       	mov    %eax,0x809068
+  80323a:	8b 46 28             	mov    0x28(%esi),%eax
+  80323d:	a3 6c 90 80 00       	mov    %eax,0x80906c
+  803242:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803245:	a3 70 90 80 00       	mov    %eax,0x809070
+  80324a:	8b 46 30             	mov    0x30(%esi),%eax
+  80324d:	a3 74 90 80 00       	mov    %eax,0x809074
+  803252:	8b 46 34             	mov    0x34(%esi),%eax
+  803255:	a3 78 90 80 00       	mov    %eax,0x809078
+  80325a:	8b 46 38             	mov    0x38(%esi),%eax
+  80325d:	a3 7c 90 80 00       	mov    %eax,0x80907c
+  803262:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803265:	a3 80 90 80 00       	mov    %eax,0x809080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80326a:	8b 03                	mov    (%ebx),%eax
+  80326c:	a3 84 90 80 00       	mov    %eax,0x809084
+  803271:	8b 43 04             	mov    0x4(%ebx),%eax
+  803274:	a3 88 90 80 00       	mov    %eax,0x809088
+  803279:	8b 43 08             	mov    0x8(%ebx),%eax
+  80327c:	a3 8c 90 80 00       	mov    %eax,0x80908c
+  803281:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803284:	a3 90 90 80 00       	mov    %eax,0x809090
+  803289:	8b 43 10             	mov    0x10(%ebx),%eax
+  80328c:	a3 94 90 80 00       	mov    %eax,0x809094
+  803291:	8b 43 14             	mov    0x14(%ebx),%eax
+  803294:	a3 98 90 80 00       	mov    %eax,0x809098
+  803299:	8b 43 18             	mov    0x18(%ebx),%eax
+  80329c:	a3 9c 90 80 00       	mov    %eax,0x80909c
+  8032a1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8032a4:	a3 a0 90 80 00       	mov    %eax,0x8090a0
+  8032a9:	8b 43 20             	mov    0x20(%ebx),%eax
+  8032ac:	a3 a4 90 80 00       	mov    %eax,0x8090a4
+  8032b1:	8b 43 24             	mov    0x24(%ebx),%eax
+  8032b4:	a3 a8 90 80 00       	mov    %eax,0x8090a8
+  8032b9:	8b 43 28             	mov    0x28(%ebx),%eax
+  8032bc:	a3 ac 90 80 00       	mov    %eax,0x8090ac
+  8032c1:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8032c4:	a3 b0 90 80 00       	mov    %eax,0x8090b0
+  8032c9:	8b 43 30             	mov    0x30(%ebx),%eax
+  8032cc:	a3 b4 90 80 00       	mov    %eax,0x8090b4
+  8032d1:	8b 43 34             	mov    0x34(%ebx),%eax
+  8032d4:	a3 b8 90 80 00       	mov    %eax,0x8090b8
+  8032d9:	8b 43 38             	mov    0x38(%ebx),%eax
+  8032dc:	a3 bc 90 80 00       	mov    %eax,0x8090bc
+  8032e1:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8032e4:	a3 c0 90 80 00       	mov    %eax,0x8090c0
+	nsipcbuf.select.req_timeout = msec;
+  8032e9:	8b 45 18             	mov    0x18(%ebp),%eax
+  8032ec:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8032f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8032f6:	e8 2b f6 ff ff       	call   802926 <nsipc>
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	0f 88 ad 01 00 00    	js     8034b0 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803303:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  803309:	89 17                	mov    %edx,(%edi)
+  80330b:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  803311:	89 57 04             	mov    %edx,0x4(%edi)
+  803314:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  80331a:	89 57 08             	mov    %edx,0x8(%edi)
+  80331d:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  803323:	89 57 0c             	mov    %edx,0xc(%edi)
+  803326:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  80332c:	89 57 10             	mov    %edx,0x10(%edi)
+  80332f:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  803335:	89 57 14             	mov    %edx,0x14(%edi)
+  803338:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  80333e:	89 57 18             	mov    %edx,0x18(%edi)
+  803341:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  803347:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80334a:	8b 15 24 90 80 00    	mov    0x809024,%edx
+  803350:	89 57 20             	mov    %edx,0x20(%edi)
+  803353:	8b 15 28 90 80 00    	mov    0x809028,%edx
+  803359:	89 57 24             	mov    %edx,0x24(%edi)
+  80335c:	8b 15 2c 90 80 00    	mov    0x80902c,%edx
+  803362:	89 57 28             	mov    %edx,0x28(%edi)
+  803365:	8b 15 30 90 80 00    	mov    0x809030,%edx
+  80336b:	89 57 2c             	mov    %edx,0x2c(%edi)
+  80336e:	8b 15 34 90 80 00    	mov    0x809034,%edx
+  803374:	89 57 30             	mov    %edx,0x30(%edi)
+  803377:	8b 15 38 90 80 00    	mov    0x809038,%edx
+  80337d:	89 57 34             	mov    %edx,0x34(%edi)
+  803380:	8b 15 3c 90 80 00    	mov    0x80903c,%edx
+  803386:	89 57 38             	mov    %edx,0x38(%edi)
+  803389:	8b 15 40 90 80 00    	mov    0x809040,%edx
+  80338f:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803392:	8b 15 44 90 80 00    	mov    0x809044,%edx
+  803398:	89 16                	mov    %edx,(%esi)
+  80339a:	8b 15 48 90 80 00    	mov    0x809048,%edx
+  8033a0:	89 56 04             	mov    %edx,0x4(%esi)
+  8033a3:	8b 15 4c 90 80 00    	mov    0x80904c,%edx
+  8033a9:	89 56 08             	mov    %edx,0x8(%esi)
+  8033ac:	8b 15 50 90 80 00    	mov    0x809050,%edx
+  8033b2:	89 56 0c             	mov    %edx,0xc(%esi)
+  8033b5:	8b 15 54 90 80 00    	mov    0x809054,%edx
+  8033bb:	89 56 10             	mov    %edx,0x10(%esi)
+  8033be:	8b 15 58 90 80 00    	mov    0x809058,%edx
+  8033c4:	89 56 14             	mov    %edx,0x14(%esi)
+  8033c7:	8b 15 5c 90 80 00    	mov    0x80905c,%edx
+  8033cd:	89 56 18             	mov    %edx,0x18(%esi)
+  8033d0:	8b 15 60 90 80 00    	mov    0x809060,%edx
+  8033d6:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8033d9:	8b 15 64 90 80 00    	mov    0x809064,%edx
+  8033df:	89 56 20             	mov    %edx,0x20(%esi)
+  8033e2:	8b 15 68 90 80 00    	mov    0x809068,%edx
+  8033e8:	89 56 24             	mov    %edx,0x24(%esi)
+  8033eb:	8b 15 6c 90 80 00    	mov    0x80906c,%edx
+  8033f1:	89 56 28             	mov    %edx,0x28(%esi)
+  8033f4:	8b 15 70 90 80 00    	mov    0x809070,%edx
+  8033fa:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8033fd:	8b 15 74 90 80 00    	mov    0x809074,%edx
+  803403:	89 56 30             	mov    %edx,0x30(%esi)
+  803406:	8b 15 78 90 80 00    	mov    0x809078,%edx
+  80340c:	89 56 34             	mov    %edx,0x34(%esi)
+  80340f:	8b 15 7c 90 80 00    	mov    0x80907c,%edx
+  803415:	89 56 38             	mov    %edx,0x38(%esi)
+  803418:	8b 15 80 90 80 00    	mov    0x809080,%edx
+  80341e:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803421:	8b 15 84 90 80 00    	mov    0x809084,%edx
+  803427:	89 13                	mov    %edx,(%ebx)
+  803429:	8b 15 88 90 80 00    	mov    0x809088,%edx
+  80342f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803432:	8b 15 8c 90 80 00    	mov    0x80908c,%edx
+  803438:	89 53 08             	mov    %edx,0x8(%ebx)
+  80343b:	8b 15 90 90 80 00    	mov    0x809090,%edx
+  803441:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803444:	8b 15 94 90 80 00    	mov    0x809094,%edx
+  80344a:	89 53 10             	mov    %edx,0x10(%ebx)
+  80344d:	8b 15 98 90 80 00    	mov    0x809098,%edx
+  803453:	89 53 14             	mov    %edx,0x14(%ebx)
+  803456:	8b 15 9c 90 80 00    	mov    0x80909c,%edx
+  80345c:	89 53 18             	mov    %edx,0x18(%ebx)
+  80345f:	8b 15 a0 90 80 00    	mov    0x8090a0,%edx
+  803465:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803468:	8b 15 a4 90 80 00    	mov    0x8090a4,%edx
+  80346e:	89 53 20             	mov    %edx,0x20(%ebx)
+  803471:	8b 15 a8 90 80 00    	mov    0x8090a8,%edx
+  803477:	89 53 24             	mov    %edx,0x24(%ebx)
+  80347a:	8b 15 ac 90 80 00    	mov    0x8090ac,%edx
+  803480:	89 53 28             	mov    %edx,0x28(%ebx)
+  803483:	8b 15 b0 90 80 00    	mov    0x8090b0,%edx
+  803489:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  80348c:	8b 15 b4 90 80 00    	mov    0x8090b4,%edx
+  803492:	89 53 30             	mov    %edx,0x30(%ebx)
+  803495:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  80349b:	89 53 34             	mov    %edx,0x34(%ebx)
+  80349e:	8b 15 bc 90 80 00    	mov    0x8090bc,%edx
+  8034a4:	89 53 38             	mov    %edx,0x38(%ebx)
+  8034a7:	8b 15 c0 90 80 00    	mov    0x8090c0,%edx
+  8034ad:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8034b0:	83 c4 0c             	add    $0xc,%esp
+  8034b3:	5b                   	pop    %ebx
+  8034b4:	5e                   	pop    %esi
+  8034b5:	5f                   	pop    %edi
+  8034b6:	5d                   	pop    %ebp
+  8034b7:	c3                   	ret
+
+008034b8 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8034b8:	55                   	push   %ebp
+  8034b9:	89 e5                	mov    %esp,%ebp
+  8034bb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8034be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c1:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.evctl.req_events = events;
+  8034c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034c9:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.evctl.req_data = data;
+  8034ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034d1:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_EVCTL);
+  8034d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8034db:	e8 46 f4 ff ff       	call   802926 <nsipc>
+}
+  8034e0:	c9                   	leave
+  8034e1:	c3                   	ret
+
+008034e2 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8034e2:	55                   	push   %ebp
+  8034e3:	89 e5                	mov    %esp,%ebp
+  8034e5:	56                   	push   %esi
+  8034e6:	53                   	push   %ebx
+  8034e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  8034ea:	89 35 00 90 80 00    	mov    %esi,0x809000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8034f0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034f3:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  8034f8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8034fd:	e8 24 f4 ff ff       	call   802926 <nsipc>
+  803502:	89 c3                	mov    %eax,%ebx
+  803504:	85 c0                	test   %eax,%eax
+  803506:	7e 1f                	jle    803527 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803508:	39 c6                	cmp    %eax,%esi
+  80350a:	7c 24                	jl     803530 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  80350c:	83 ec 04             	sub    $0x4,%esp
+  80350f:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803516:	50                   	push   %eax
+  803517:	68 00 90 80 00       	push   $0x809000
+  80351c:	ff 75 08             	push   0x8(%ebp)
+  80351f:	e8 6e d8 ff ff       	call   800d92 <memmove>
+  803524:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803527:	89 d8                	mov    %ebx,%eax
+  803529:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80352c:	5b                   	pop    %ebx
+  80352d:	5e                   	pop    %esi
+  80352e:	5d                   	pop    %ebp
+  80352f:	c3                   	ret
+		assert(r <= max);
+  803530:	68 8e 51 80 00       	push   $0x80518e
+  803535:	68 61 51 80 00       	push   $0x805161
+  80353a:	68 6a 01 00 00       	push   $0x16a
+  80353f:	68 76 51 80 00       	push   $0x805176
+  803544:	e8 c7 ce ff ff       	call   800410 <_panic>
+
+00803549 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803549:	55                   	push   %ebp
+  80354a:	89 e5                	mov    %esp,%ebp
+  80354c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80354f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803552:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803557:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80355a:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80355f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803562:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803567:	b8 09 00 00 00       	mov    $0x9,%eax
+  80356c:	e8 b5 f3 ff ff       	call   802926 <nsipc>
+}
+  803571:	c9                   	leave
+  803572:	c3                   	ret
+
+00803573 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803573:	55                   	push   %ebp
+  803574:	89 e5                	mov    %esp,%ebp
+  803576:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803579:	8b 45 08             	mov    0x8(%ebp),%eax
+  80357c:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_OFFLOAD);
+  803581:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803586:	e8 9b f3 ff ff       	call   802926 <nsipc>
+}
+  80358b:	c9                   	leave
+  80358c:	c3                   	ret
+
+0080358d <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  80358d:	55                   	push   %ebp
+  80358e:	89 e5                	mov    %esp,%ebp
+  803590:	53                   	push   %ebx
+  803591:	83 ec 04             	sub    $0x4,%esp
+  803594:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803597:	b8 12 00 00 00       	mov    $0x12,%eax
+  80359c:	e8 85 f3 ff ff       	call   802926 <nsipc>
+  8035a1:	85 c0                	test   %eax,%eax
+  8035a3:	78 50                	js     8035f5 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8035a5:	8b 15 00 90 80 00    	mov    0x809000,%edx
+  8035ab:	89 13                	mov    %edx,(%ebx)
+  8035ad:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  8035b3:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035b6:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  8035bc:	89 53 08             	mov    %edx,0x8(%ebx)
+  8035bf:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  8035c5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8035c8:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  8035ce:	89 53 10             	mov    %edx,0x10(%ebx)
+  8035d1:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  8035d7:	89 53 14             	mov    %edx,0x14(%ebx)
+  8035da:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  8035e0:	89 53 18             	mov    %edx,0x18(%ebx)
+  8035e3:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  8035e9:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8035ec:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  8035f2:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8035f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035f8:	c9                   	leave
+  8035f9:	c3                   	ret
+
+008035fa <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8035fa:	55                   	push   %ebp
+  8035fb:	89 e5                	mov    %esp,%ebp
+  8035fd:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803600:	6a 03                	push   $0x3
+  803602:	e8 08 0f 00 00       	call   80450f <ipc_find_env>
+  803607:	a3 24 7a 80 00       	mov    %eax,0x807a24
+	nsipcbuf.shard.req_shard = shard;
+  80360c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80360f:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803614:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803619:	e8 08 f3 ff ff       	call   802926 <nsipc>
+  80361e:	83 c4 10             	add    $0x10,%esp
+  803621:	85 c0                	test   %eax,%eax
+  803623:	78 0a                	js     80362f <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803625:	a3 24 7a 80 00       	mov    %eax,0x807a24
+	return 0;
+  80362a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80362f:	c9                   	leave
+  803630:	c3                   	ret
+
+00803631 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803631:	55                   	push   %ebp
+  803632:	89 e5                	mov    %esp,%ebp
+  803634:	57                   	push   %edi
+  803635:	56                   	push   %esi
+  803636:	53                   	push   %ebx
+  803637:	83 ec 1c             	sub    $0x1c,%esp
+  80363a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80363d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803640:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803645:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80364a:	89 e0                	mov    %esp,%eax
+  80364c:	89 f2                	mov    %esi,%edx
+  80364e:	29 c2                	sub    %eax,%edx
+  803650:	89 d0                	mov    %edx,%eax
+  803652:	c1 e8 0f             	shr    $0xf,%eax
+  803655:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80365b:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80365e:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  803665:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803668:	83 ec 0c             	sub    $0xc,%esp
+  80366b:	ff 75 e0             	push   -0x20(%ebp)
+  80366e:	e8 db 0e 00 00       	call   80454e <pageref>
+  803673:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803676:	83 c4 04             	add    $0x4,%esp
+  803679:	ff 75 dc             	push   -0x24(%ebp)
+  80367c:	e8 cd 0e 00 00       	call   80454e <pageref>
+  803681:	89 e2                	mov    %esp,%edx
+  803683:	89 f1                	mov    %esi,%ecx
+  803685:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803687:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80368a:	89 ca                	mov    %ecx,%edx
+  80368c:	c1 ea 0f             	shr    $0xf,%edx
+  80368f:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803695:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803698:	8b 14 95 60 7a 80 00 	mov    0x807a60(,%edx,4),%edx
+  80369f:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8036a2:	39 d7                	cmp    %edx,%edi
+  8036a4:	74 40                	je     8036e6 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8036a6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036a9:	75 9f                	jne    80364a <_pipeisclosed+0x19>
+  8036ab:	89 e2                	mov    %esp,%edx
+  8036ad:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036b2:	29 d0                	sub    %edx,%eax
+  8036b4:	89 c2                	mov    %eax,%edx
+  8036b6:	c1 ea 0f             	shr    $0xf,%edx
+  8036b9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c3:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8036c6:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  8036cd:	8b 40 58             	mov    0x58(%eax),%eax
+  8036d0:	6a 01                	push   $0x1
+  8036d2:	50                   	push   %eax
+  8036d3:	57                   	push   %edi
+  8036d4:	68 97 51 80 00       	push   $0x805197
+  8036d9:	e8 0d ce ff ff       	call   8004eb <cprintf>
+  8036de:	83 c4 10             	add    $0x10,%esp
+  8036e1:	e9 5f ff ff ff       	jmp    803645 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8036e6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036e9:	0f 94 c0             	sete   %al
+  8036ec:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8036ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f2:	5b                   	pop    %ebx
+  8036f3:	5e                   	pop    %esi
+  8036f4:	5f                   	pop    %edi
+  8036f5:	5d                   	pop    %ebp
+  8036f6:	c3                   	ret
+
+008036f7 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8036f7:	55                   	push   %ebp
+  8036f8:	89 e5                	mov    %esp,%ebp
+  8036fa:	53                   	push   %ebx
+  8036fb:	83 ec 0c             	sub    $0xc,%esp
+  8036fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803701:	53                   	push   %ebx
+  803702:	6a 00                	push   $0x0
+  803704:	e8 92 d9 ff ff       	call   80109b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803709:	89 1c 24             	mov    %ebx,(%esp)
+  80370c:	e8 f4 e4 ff ff       	call   801c05 <fd2data>
+  803711:	83 c4 08             	add    $0x8,%esp
+  803714:	50                   	push   %eax
+  803715:	6a 00                	push   $0x0
+  803717:	e8 7f d9 ff ff       	call   80109b <sys_page_unmap>
+}
+  80371c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80371f:	c9                   	leave
+  803720:	c3                   	ret
+
+00803721 <devpipe_read>:
+{
+  803721:	55                   	push   %ebp
+  803722:	89 e5                	mov    %esp,%ebp
+  803724:	57                   	push   %edi
+  803725:	56                   	push   %esi
+  803726:	53                   	push   %ebx
+  803727:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80372a:	ff 75 08             	push   0x8(%ebp)
+  80372d:	e8 d3 e4 ff ff       	call   801c05 <fd2data>
+  803732:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803734:	8b 70 04             	mov    0x4(%eax),%esi
+  803737:	8b 00                	mov    (%eax),%eax
+  803739:	83 c4 10             	add    $0x10,%esp
+  80373c:	39 f0                	cmp    %esi,%eax
+  80373e:	75 36                	jne    803776 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803740:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803743:	89 da                	mov    %ebx,%edx
+  803745:	8b 45 08             	mov    0x8(%ebp),%eax
+  803748:	e8 e4 fe ff ff       	call   803631 <_pipeisclosed>
+  80374d:	85 c0                	test   %eax,%eax
+  80374f:	0f 85 d4 00 00 00    	jne    803829 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803755:	b8 01 00 00 00       	mov    $0x1,%eax
+  80375a:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80375e:	83 ec 04             	sub    $0x4,%esp
+  803761:	6a ff                	push   $0xffffffff
+  803763:	56                   	push   %esi
+  803764:	57                   	push   %edi
+  803765:	e8 aa dc ff ff       	call   801414 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80376a:	8b 73 04             	mov    0x4(%ebx),%esi
+  80376d:	8b 03                	mov    (%ebx),%eax
+  80376f:	83 c4 10             	add    $0x10,%esp
+  803772:	39 c6                	cmp    %eax,%esi
+  803774:	74 cd                	je     803743 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803776:	8b 73 04             	mov    0x4(%ebx),%esi
+  803779:	8b 03                	mov    (%ebx),%eax
+  80377b:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803781:	29 c6                	sub    %eax,%esi
+  803783:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803788:	f7 e6                	mul    %esi
+  80378a:	c1 ea 0c             	shr    $0xc,%edx
+  80378d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803793:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803795:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803798:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80379c:	8b 0b                	mov    (%ebx),%ecx
+  80379e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037a3:	f7 e1                	mul    %ecx
+  8037a5:	c1 ea 0b             	shr    $0xb,%edx
+  8037a8:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8037ae:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8037b0:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8037b5:	29 cf                	sub    %ecx,%edi
+  8037b7:	39 f7                	cmp    %esi,%edi
+  8037b9:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8037bc:	83 ec 04             	sub    $0x4,%esp
+  8037bf:	57                   	push   %edi
+  8037c0:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8037c4:	50                   	push   %eax
+  8037c5:	ff 75 0c             	push   0xc(%ebp)
+  8037c8:	e8 c5 d5 ff ff       	call   800d92 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8037cd:	83 c4 0c             	add    $0xc,%esp
+  8037d0:	89 f0                	mov    %esi,%eax
+  8037d2:	29 f8                	sub    %edi,%eax
+  8037d4:	50                   	push   %eax
+  8037d5:	8d 43 10             	lea    0x10(%ebx),%eax
+  8037d8:	50                   	push   %eax
+  8037d9:	89 f8                	mov    %edi,%eax
+  8037db:	03 45 0c             	add    0xc(%ebp),%eax
+  8037de:	50                   	push   %eax
+  8037df:	e8 ae d5 ff ff       	call   800d92 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8037e4:	8b 0b                	mov    (%ebx),%ecx
+  8037e6:	01 f1                	add    %esi,%ecx
+  8037e8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037ed:	f7 e1                	mul    %ecx
+  8037ef:	c1 ea 0c             	shr    $0xc,%edx
+  8037f2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8037f8:	29 c1                	sub    %eax,%ecx
+  8037fa:	89 0b                	mov    %ecx,(%ebx)
+  8037fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803801:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803805:	83 c4 10             	add    $0x10,%esp
+  803808:	85 c0                	test   %eax,%eax
+  80380a:	75 0a                	jne    803816 <devpipe_read+0xf5>
+	return n;
+  80380c:	89 f0                	mov    %esi,%eax
+}
+  80380e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803811:	5b                   	pop    %ebx
+  803812:	5e                   	pop    %esi
+  803813:	5f                   	pop    %edi
+  803814:	5d                   	pop    %ebp
+  803815:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803816:	83 ec 08             	sub    $0x8,%esp
+  803819:	68 00 04 00 00       	push   $0x400
+  80381e:	53                   	push   %ebx
+  80381f:	e8 12 dc ff ff       	call   801436 <sys_futex_wake>
+  803824:	83 c4 10             	add    $0x10,%esp
+  803827:	eb e3                	jmp    80380c <devpipe_read+0xeb>
+			return 0;
+  803829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80382e:	eb de                	jmp    80380e <devpipe_read+0xed>
+
+00803830 <devpipe_write>:
+{
+  803830:	55                   	push   %ebp
+  803831:	89 e5                	mov    %esp,%ebp
+  803833:	57                   	push   %edi
+  803834:	56                   	push   %esi
+  803835:	53                   	push   %ebx
+  803836:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803839:	ff 75 08             	push   0x8(%ebp)
+  80383c:	e8 c4 e3 ff ff       	call   801c05 <fd2data>
+  803841:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80384d:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803852:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803856:	0f 84 43 01 00 00    	je     80399f <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80385c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80385f:	8b 06                	mov    (%esi),%eax
+  803861:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803867:	29 c1                	sub    %eax,%ecx
+  803869:	89 c8                	mov    %ecx,%eax
+  80386b:	f7 e7                	mul    %edi
+  80386d:	c1 ea 0c             	shr    $0xc,%edx
+  803870:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803876:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803878:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80387e:	75 52                	jne    8038d2 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803880:	89 f2                	mov    %esi,%edx
+  803882:	8b 45 08             	mov    0x8(%ebp),%eax
+  803885:	e8 a7 fd ff ff       	call   803631 <_pipeisclosed>
+  80388a:	85 c0                	test   %eax,%eax
+  80388c:	0f 85 28 01 00 00    	jne    8039ba <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803892:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803894:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803897:	8b 06                	mov    (%esi),%eax
+  803899:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80389f:	29 c1                	sub    %eax,%ecx
+  8038a1:	89 c8                	mov    %ecx,%eax
+  8038a3:	f7 e7                	mul    %edi
+  8038a5:	c1 ea 0c             	shr    $0xc,%edx
+  8038a8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038ae:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8038b0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8038b6:	75 a4                	jne    80385c <devpipe_write+0x2c>
+  8038b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038bd:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8038c1:	83 ec 04             	sub    $0x4,%esp
+  8038c4:	6a ff                	push   $0xffffffff
+  8038c6:	53                   	push   %ebx
+  8038c7:	56                   	push   %esi
+  8038c8:	e8 47 db ff ff       	call   801414 <sys_futex_wait>
+}
+  8038cd:	83 c4 10             	add    $0x10,%esp
+  8038d0:	eb 8a                	jmp    80385c <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038d2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038d5:	8b 06                	mov    (%esi),%eax
+  8038d7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038dd:	29 c1                	sub    %eax,%ecx
+  8038df:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038e4:	f7 e1                	mul    %ecx
+  8038e6:	c1 ea 0c             	shr    $0xc,%edx
+  8038e9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038ef:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8038f1:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8038f6:	89 d8                	mov    %ebx,%eax
+  8038f8:	29 c8                	sub    %ecx,%eax
+  8038fa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8038fd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803900:	29 ca                	sub    %ecx,%edx
+  803902:	39 d0                	cmp    %edx,%eax
+  803904:	0f 46 d0             	cmovbe %eax,%edx
+  803907:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80390a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80390d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803912:	f7 e1                	mul    %ecx
+  803914:	c1 ea 0b             	shr    $0xb,%edx
+  803917:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80391d:	89 ca                	mov    %ecx,%edx
+  80391f:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803921:	29 d3                	sub    %edx,%ebx
+  803923:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803926:	39 c3                	cmp    %eax,%ebx
+  803928:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80392b:	83 ec 04             	sub    $0x4,%esp
+  80392e:	53                   	push   %ebx
+  80392f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803932:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803935:	51                   	push   %ecx
+  803936:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80393a:	50                   	push   %eax
+  80393b:	e8 52 d4 ff ff       	call   800d92 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803940:	83 c4 0c             	add    $0xc,%esp
+  803943:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803946:	29 d8                	sub    %ebx,%eax
+  803948:	50                   	push   %eax
+  803949:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80394c:	01 cb                	add    %ecx,%ebx
+  80394e:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803951:	53                   	push   %ebx
+  803952:	8d 46 10             	lea    0x10(%esi),%eax
+  803955:	50                   	push   %eax
+  803956:	e8 37 d4 ff ff       	call   800d92 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80395b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80395e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803961:	01 c1                	add    %eax,%ecx
+  803963:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803968:	f7 e1                	mul    %ecx
+  80396a:	c1 ea 0c             	shr    $0xc,%edx
+  80396d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803973:	89 ca                	mov    %ecx,%edx
+  803975:	29 c2                	sub    %eax,%edx
+  803977:	89 56 04             	mov    %edx,0x4(%esi)
+  80397a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397f:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803983:	83 c4 10             	add    $0x10,%esp
+  803986:	85 c0                	test   %eax,%eax
+  803988:	75 1a                	jne    8039a4 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80398a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80398d:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803990:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803993:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803996:	0f 82 c0 fe ff ff    	jb     80385c <devpipe_write+0x2c>
+  80399c:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80399f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8039a2:	eb 1b                	jmp    8039bf <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8039a4:	83 ec 08             	sub    $0x8,%esp
+  8039a7:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8039ac:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8039af:	50                   	push   %eax
+  8039b0:	e8 81 da ff ff       	call   801436 <sys_futex_wake>
+  8039b5:	83 c4 10             	add    $0x10,%esp
+  8039b8:	eb d0                	jmp    80398a <devpipe_write+0x15a>
+				return 0;
+  8039ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c2:	5b                   	pop    %ebx
+  8039c3:	5e                   	pop    %esi
+  8039c4:	5f                   	pop    %edi
+  8039c5:	5d                   	pop    %ebp
+  8039c6:	c3                   	ret
+
+008039c7 <devpipe_stat>:
+{
+  8039c7:	55                   	push   %ebp
+  8039c8:	89 e5                	mov    %esp,%ebp
+  8039ca:	56                   	push   %esi
+  8039cb:	53                   	push   %ebx
+  8039cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8039cf:	83 ec 0c             	sub    $0xc,%esp
+  8039d2:	ff 75 08             	push   0x8(%ebp)
+  8039d5:	e8 2b e2 ff ff       	call   801c05 <fd2data>
+  8039da:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8039dc:	83 c4 08             	add    $0x8,%esp
+  8039df:	68 aa 51 80 00       	push   $0x8051aa
+  8039e4:	53                   	push   %ebx
+  8039e5:	e8 f8 d1 ff ff       	call   800be2 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039ea:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039ed:	8b 06                	mov    (%esi),%eax
+  8039ef:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039f5:	29 c1                	sub    %eax,%ecx
+  8039f7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8039fc:	89 c8                	mov    %ecx,%eax
+  8039fe:	f7 e2                	mul    %edx
+  803a00:	c1 ea 0c             	shr    $0xc,%edx
+  803a03:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a09:	29 d1                	sub    %edx,%ecx
+  803a0b:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803a11:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803a18:	00 00 00 
+	stat->st_dev = &devpipe;
+  803a1b:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  803a22:	60 80 00 
+}
+  803a25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a2d:	5b                   	pop    %ebx
+  803a2e:	5e                   	pop    %esi
+  803a2f:	5d                   	pop    %ebp
+  803a30:	c3                   	ret
+
+00803a31 <devpipe_poll>:
+{
+  803a31:	55                   	push   %ebp
+  803a32:	89 e5                	mov    %esp,%ebp
+  803a34:	57                   	push   %edi
+  803a35:	56                   	push   %esi
+  803a36:	53                   	push   %ebx
+  803a37:	83 ec 18             	sub    $0x18,%esp
+  803a3a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803a40:	57                   	push   %edi
+  803a41:	e8 bf e1 ff ff       	call   801c05 <fd2data>
+  803a46:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803a48:	83 c4 10             	add    $0x10,%esp
+  803a4b:	89 f3                	mov    %esi,%ebx
+  803a4d:	83 e3 01             	and    $0x1,%ebx
+  803a50:	75 27                	jne    803a79 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803a52:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803a58:	75 48                	jne    803aa2 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803a5a:	89 ca                	mov    %ecx,%edx
+  803a5c:	89 f8                	mov    %edi,%eax
+  803a5e:	e8 ce fb ff ff       	call   803631 <_pipeisclosed>
+  803a63:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803a65:	89 d8                	mov    %ebx,%eax
+  803a67:	83 c8 10             	or     $0x10,%eax
+  803a6a:	85 d2                	test   %edx,%edx
+  803a6c:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803a6f:	89 d8                	mov    %ebx,%eax
+  803a71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a74:	5b                   	pop    %ebx
+  803a75:	5e                   	pop    %esi
+  803a76:	5f                   	pop    %edi
+  803a77:	5d                   	pop    %ebp
+  803a78:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a79:	8b 58 04             	mov    0x4(%eax),%ebx
+  803a7c:	8b 00                	mov    (%eax),%eax
+  803a7e:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803a84:	29 c3                	sub    %eax,%ebx
+  803a86:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a8b:	89 d8                	mov    %ebx,%eax
+  803a8d:	f7 e2                	mul    %edx
+  803a8f:	c1 ea 0c             	shr    $0xc,%edx
+  803a92:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803a98:	39 d3                	cmp    %edx,%ebx
+  803a9a:	0f 95 c3             	setne  %bl
+  803a9d:	0f b6 db             	movzbl %bl,%ebx
+  803aa0:	eb b0                	jmp    803a52 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803aa2:	8b 71 04             	mov    0x4(%ecx),%esi
+  803aa5:	8b 01                	mov    (%ecx),%eax
+  803aa7:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803aad:	29 c6                	sub    %eax,%esi
+  803aaf:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803ab4:	89 f0                	mov    %esi,%eax
+  803ab6:	f7 e2                	mul    %edx
+  803ab8:	c1 ea 0c             	shr    $0xc,%edx
+  803abb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803ac1:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803ac3:	89 d8                	mov    %ebx,%eax
+  803ac5:	83 c8 04             	or     $0x4,%eax
+  803ac8:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803ace:	0f 42 d8             	cmovb  %eax,%ebx
+  803ad1:	eb 87                	jmp    803a5a <devpipe_poll+0x29>
+
+00803ad3 <pipe>:
+{
+  803ad3:	55                   	push   %ebp
+  803ad4:	89 e5                	mov    %esp,%ebp
+  803ad6:	56                   	push   %esi
+  803ad7:	53                   	push   %ebx
+  803ad8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803adb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ade:	50                   	push   %eax
+  803adf:	e8 38 e1 ff ff       	call   801c1c <fd_alloc>
+  803ae4:	89 c3                	mov    %eax,%ebx
+  803ae6:	83 c4 10             	add    $0x10,%esp
+  803ae9:	85 c0                	test   %eax,%eax
+  803aeb:	0f 88 23 01 00 00    	js     803c14 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803af1:	83 ec 04             	sub    $0x4,%esp
+  803af4:	68 07 04 00 00       	push   $0x407
+  803af9:	ff 75 f4             	push   -0xc(%ebp)
+  803afc:	6a 00                	push   $0x0
+  803afe:	e8 13 d5 ff ff       	call   801016 <sys_page_alloc>
+  803b03:	89 c3                	mov    %eax,%ebx
+  803b05:	83 c4 10             	add    $0x10,%esp
+  803b08:	85 c0                	test   %eax,%eax
+  803b0a:	0f 88 04 01 00 00    	js     803c14 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803b10:	83 ec 0c             	sub    $0xc,%esp
+  803b13:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b16:	50                   	push   %eax
+  803b17:	e8 00 e1 ff ff       	call   801c1c <fd_alloc>
+  803b1c:	89 c3                	mov    %eax,%ebx
+  803b1e:	83 c4 10             	add    $0x10,%esp
+  803b21:	85 c0                	test   %eax,%eax
+  803b23:	0f 88 db 00 00 00    	js     803c04 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b29:	83 ec 04             	sub    $0x4,%esp
+  803b2c:	68 07 04 00 00       	push   $0x407
+  803b31:	ff 75 f0             	push   -0x10(%ebp)
+  803b34:	6a 00                	push   $0x0
+  803b36:	e8 db d4 ff ff       	call   801016 <sys_page_alloc>
+  803b3b:	89 c3                	mov    %eax,%ebx
+  803b3d:	83 c4 10             	add    $0x10,%esp
+  803b40:	85 c0                	test   %eax,%eax
+  803b42:	0f 88 bc 00 00 00    	js     803c04 <pipe+0x131>
+	va = fd2data(fd0);
+  803b48:	83 ec 0c             	sub    $0xc,%esp
+  803b4b:	ff 75 f4             	push   -0xc(%ebp)
+  803b4e:	e8 b2 e0 ff ff       	call   801c05 <fd2data>
+  803b53:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b55:	83 c4 0c             	add    $0xc,%esp
+  803b58:	68 07 04 00 00       	push   $0x407
+  803b5d:	50                   	push   %eax
+  803b5e:	6a 00                	push   $0x0
+  803b60:	e8 b1 d4 ff ff       	call   801016 <sys_page_alloc>
+  803b65:	89 c3                	mov    %eax,%ebx
+  803b67:	83 c4 10             	add    $0x10,%esp
+  803b6a:	85 c0                	test   %eax,%eax
+  803b6c:	0f 88 82 00 00 00    	js     803bf4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b72:	83 ec 0c             	sub    $0xc,%esp
+  803b75:	ff 75 f0             	push   -0x10(%ebp)
+  803b78:	e8 88 e0 ff ff       	call   801c05 <fd2data>
+  803b7d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b84:	50                   	push   %eax
+  803b85:	6a 00                	push   $0x0
+  803b87:	56                   	push   %esi
+  803b88:	6a 00                	push   $0x0
+  803b8a:	e8 ca d4 ff ff       	call   801059 <sys_page_map>
+  803b8f:	89 c3                	mov    %eax,%ebx
+  803b91:	83 c4 20             	add    $0x20,%esp
+  803b94:	85 c0                	test   %eax,%eax
+  803b96:	78 4e                	js     803be6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b98:	a1 60 60 80 00       	mov    0x806060,%eax
+  803b9d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803ba0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803ba2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803ba5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803bac:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803baf:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803bb1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803bb4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803bbb:	83 ec 0c             	sub    $0xc,%esp
+  803bbe:	ff 75 f4             	push   -0xc(%ebp)
+  803bc1:	e8 2f e0 ff ff       	call   801bf5 <fd2num>
+  803bc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bc9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803bcb:	83 c4 04             	add    $0x4,%esp
+  803bce:	ff 75 f0             	push   -0x10(%ebp)
+  803bd1:	e8 1f e0 ff ff       	call   801bf5 <fd2num>
+  803bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bd9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803bdc:	83 c4 10             	add    $0x10,%esp
+  803bdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803be4:	eb 2e                	jmp    803c14 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803be6:	83 ec 08             	sub    $0x8,%esp
+  803be9:	56                   	push   %esi
+  803bea:	6a 00                	push   $0x0
+  803bec:	e8 aa d4 ff ff       	call   80109b <sys_page_unmap>
+  803bf1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803bf4:	83 ec 08             	sub    $0x8,%esp
+  803bf7:	ff 75 f0             	push   -0x10(%ebp)
+  803bfa:	6a 00                	push   $0x0
+  803bfc:	e8 9a d4 ff ff       	call   80109b <sys_page_unmap>
+  803c01:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803c04:	83 ec 08             	sub    $0x8,%esp
+  803c07:	ff 75 f4             	push   -0xc(%ebp)
+  803c0a:	6a 00                	push   $0x0
+  803c0c:	e8 8a d4 ff ff       	call   80109b <sys_page_unmap>
+  803c11:	83 c4 10             	add    $0x10,%esp
+}
+  803c14:	89 d8                	mov    %ebx,%eax
+  803c16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c19:	5b                   	pop    %ebx
+  803c1a:	5e                   	pop    %esi
+  803c1b:	5d                   	pop    %ebp
+  803c1c:	c3                   	ret
+
+00803c1d <pipeisclosed>:
+{
+  803c1d:	55                   	push   %ebp
+  803c1e:	89 e5                	mov    %esp,%ebp
+  803c20:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c26:	50                   	push   %eax
+  803c27:	ff 75 08             	push   0x8(%ebp)
+  803c2a:	e8 3d e0 ff ff       	call   801c6c <fd_lookup>
+  803c2f:	83 c4 10             	add    $0x10,%esp
+  803c32:	85 c0                	test   %eax,%eax
+  803c34:	78 18                	js     803c4e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c36:	83 ec 0c             	sub    $0xc,%esp
+  803c39:	ff 75 f4             	push   -0xc(%ebp)
+  803c3c:	e8 c4 df ff ff       	call   801c05 <fd2data>
+  803c41:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c46:	e8 e6 f9 ff ff       	call   803631 <_pipeisclosed>
+  803c4b:	83 c4 10             	add    $0x10,%esp
+}
+  803c4e:	c9                   	leave
+  803c4f:	c3                   	ret
+
+00803c50 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803c50:	55                   	push   %ebp
+  803c51:	89 e5                	mov    %esp,%ebp
+  803c53:	56                   	push   %esi
+  803c54:	53                   	push   %ebx
+  803c55:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803c58:	85 f6                	test   %esi,%esi
+  803c5a:	74 40                	je     803c9c <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803c5c:	89 f3                	mov    %esi,%ebx
+  803c5e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c64:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803c6a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c6f:	8b 40 48             	mov    0x48(%eax),%eax
+  803c72:	39 c6                	cmp    %eax,%esi
+  803c74:	75 1f                	jne    803c95 <wait+0x45>
+  803c76:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803c7c:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803c82:	8b 43 54             	mov    0x54(%ebx),%eax
+  803c85:	85 c0                	test   %eax,%eax
+  803c87:	74 0c                	je     803c95 <wait+0x45>
+		sys_yield();
+  803c89:	e8 69 d3 ff ff       	call   800ff7 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c8e:	8b 43 48             	mov    0x48(%ebx),%eax
+  803c91:	39 f0                	cmp    %esi,%eax
+  803c93:	74 ed                	je     803c82 <wait+0x32>
+}
+  803c95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c98:	5b                   	pop    %ebx
+  803c99:	5e                   	pop    %esi
+  803c9a:	5d                   	pop    %ebp
+  803c9b:	c3                   	ret
+	assert(envid != 0);
+  803c9c:	68 b6 51 80 00       	push   $0x8051b6
+  803ca1:	68 61 51 80 00       	push   $0x805161
+  803ca6:	6a 09                	push   $0x9
+  803ca8:	68 c1 51 80 00       	push   $0x8051c1
+  803cad:	e8 5e c7 ff ff       	call   800410 <_panic>
+
+00803cb2 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803cb2:	55                   	push   %ebp
+  803cb3:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cb8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803cbe:	5d                   	pop    %ebp
+  803cbf:	c3                   	ret
+
+00803cc0 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803cc0:	55                   	push   %ebp
+  803cc1:	89 e5                	mov    %esp,%ebp
+  803cc3:	53                   	push   %ebx
+  803cc4:	83 ec 04             	sub    $0x4,%esp
+  803cc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803cca:	8b 03                	mov    (%ebx),%eax
+  803ccc:	85 c0                	test   %eax,%eax
+  803cce:	75 05                	jne    803cd5 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803cd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cd3:	c9                   	leave
+  803cd4:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803cd5:	83 ec 08             	sub    $0x8,%esp
+  803cd8:	50                   	push   %eax
+  803cd9:	8d 43 04             	lea    0x4(%ebx),%eax
+  803cdc:	50                   	push   %eax
+  803cdd:	e8 09 d6 ff ff       	call   8012eb <sys_page_batch>
+	pb->pb_n = 0;
+  803ce2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803ce8:	83 c4 10             	add    $0x10,%esp
+  803ceb:	eb e3                	jmp    803cd0 <pgbatch_flush+0x10>
+
+00803ced <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803ced:	55                   	push   %ebp
+  803cee:	89 e5                	mov    %esp,%ebp
+  803cf0:	56                   	push   %esi
+  803cf1:	53                   	push   %ebx
+  803cf2:	89 c3                	mov    %eax,%ebx
+  803cf4:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803cf6:	83 38 20             	cmpl   $0x20,(%eax)
+  803cf9:	74 2c                	je     803d27 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803cfb:	8b 03                	mov    (%ebx),%eax
+  803cfd:	8d 50 01             	lea    0x1(%eax),%edx
+  803d00:	89 13                	mov    %edx,(%ebx)
+  803d02:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803d05:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803d09:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803d0b:	83 ec 04             	sub    $0x4,%esp
+  803d0e:	6a 18                	push   $0x18
+  803d10:	6a 00                	push   $0x0
+  803d12:	50                   	push   %eax
+  803d13:	e8 45 d0 ff ff       	call   800d5d <memset>
+	return 0;
+  803d18:	83 c4 10             	add    $0x10,%esp
+  803d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d23:	5b                   	pop    %ebx
+  803d24:	5e                   	pop    %esi
+  803d25:	5d                   	pop    %ebp
+  803d26:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d27:	83 ec 0c             	sub    $0xc,%esp
+  803d2a:	50                   	push   %eax
+  803d2b:	e8 90 ff ff ff       	call   803cc0 <pgbatch_flush>
+  803d30:	83 c4 10             	add    $0x10,%esp
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	79 c4                	jns    803cfb <pgbatch_slot+0xe>
+  803d37:	eb e7                	jmp    803d20 <pgbatch_slot+0x33>
+
+00803d39 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803d39:	55                   	push   %ebp
+  803d3a:	89 e5                	mov    %esp,%ebp
+  803d3c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d3f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d42:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d45:	e8 a3 ff ff ff       	call   803ced <pgbatch_slot>
+  803d4a:	85 c0                	test   %eax,%eax
+  803d4c:	78 20                	js     803d6e <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803d4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d51:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803d57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d5a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803d5d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d60:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d63:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d66:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d6e:	c9                   	leave
+  803d6f:	c3                   	ret
+
+00803d70 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803d70:	55                   	push   %ebp
+  803d71:	89 e5                	mov    %esp,%ebp
+  803d73:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d76:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d7c:	e8 6c ff ff ff       	call   803ced <pgbatch_slot>
+  803d81:	85 c0                	test   %eax,%eax
+  803d83:	78 2c                	js     803db1 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803d85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d88:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803d8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d91:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803d94:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d97:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803d9a:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d9d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803da0:	8b 55 18             	mov    0x18(%ebp),%edx
+  803da3:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803da6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803da9:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803dac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803db1:	c9                   	leave
+  803db2:	c3                   	ret
+
+00803db3 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803db3:	55                   	push   %ebp
+  803db4:	89 e5                	mov    %esp,%ebp
+  803db6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803db9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dbf:	e8 29 ff ff ff       	call   803ced <pgbatch_slot>
+  803dc4:	85 c0                	test   %eax,%eax
+  803dc6:	78 1a                	js     803de2 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803dc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dcb:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803dd1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dd4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803dd7:	8b 55 10             	mov    0x10(%ebp),%edx
+  803dda:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803de2:	c9                   	leave
+  803de3:	c3                   	ret
+
+00803de4 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803de4:	55                   	push   %ebp
+  803de5:	89 e5                	mov    %esp,%ebp
+  803de7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803dea:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ded:	8b 45 08             	mov    0x8(%ebp),%eax
+  803df0:	e8 f8 fe ff ff       	call   803ced <pgbatch_slot>
+  803df5:	85 c0                	test   %eax,%eax
+  803df7:	78 20                	js     803e19 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803df9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dfc:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803e02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e05:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e08:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e0b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e0e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e11:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e19:	c9                   	leave
+  803e1a:	c3                   	ret
+
+00803e1b <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803e1b:	55                   	push   %ebp
+  803e1c:	89 e5                	mov    %esp,%ebp
+  803e1e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e21:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e24:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e27:	e8 c1 fe ff ff       	call   803ced <pgbatch_slot>
+  803e2c:	85 c0                	test   %eax,%eax
+  803e2e:	78 26                	js     803e56 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803e30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e33:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803e39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e3c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803e3f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e42:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e45:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e48:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803e4b:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e4e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e56:	c9                   	leave
+  803e57:	c3                   	ret
+
+00803e58 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803e58:	55                   	push   %ebp
+  803e59:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e5e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e64:	5d                   	pop    %ebp
+  803e65:	c3                   	ret
+
+00803e66 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803e66:	55                   	push   %ebp
+  803e67:	89 e5                	mov    %esp,%ebp
+  803e69:	56                   	push   %esi
+  803e6a:	53                   	push   %ebx
+  803e6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e73:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e78:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803e7c:	85 c0                	test   %eax,%eax
+  803e7e:	74 2f                	je     803eaf <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803e80:	83 f8 02             	cmp    $0x2,%eax
+  803e83:	74 0c                	je     803e91 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803e85:	b8 02 00 00 00       	mov    $0x2,%eax
+  803e8a:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803e8d:	85 c0                	test   %eax,%eax
+  803e8f:	74 1e                	je     803eaf <mutex_lock+0x49>
+  803e91:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803e96:	83 ec 04             	sub    $0x4,%esp
+  803e99:	6a ff                	push   $0xffffffff
+  803e9b:	6a 02                	push   $0x2
+  803e9d:	53                   	push   %ebx
+  803e9e:	e8 71 d5 ff ff       	call   801414 <sys_futex_wait>
+  803ea3:	89 f0                	mov    %esi,%eax
+  803ea5:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803ea8:	83 c4 10             	add    $0x10,%esp
+  803eab:	85 c0                	test   %eax,%eax
+  803ead:	75 e7                	jne    803e96 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803eaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803eb2:	5b                   	pop    %ebx
+  803eb3:	5e                   	pop    %esi
+  803eb4:	5d                   	pop    %ebp
+  803eb5:	c3                   	ret
+
+00803eb6 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803eb6:	55                   	push   %ebp
+  803eb7:	89 e5                	mov    %esp,%ebp
+  803eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ec6:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803eca:	85 c0                	test   %eax,%eax
+  803ecc:	0f 94 c0             	sete   %al
+  803ecf:	0f b6 c0             	movzbl %al,%eax
+}
+  803ed2:	5d                   	pop    %ebp
+  803ed3:	c3                   	ret
+
+00803ed4 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803ed4:	55                   	push   %ebp
+  803ed5:	89 e5                	mov    %esp,%ebp
+  803ed7:	83 ec 08             	sub    $0x8,%esp
+  803eda:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee2:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803ee5:	83 f8 02             	cmp    $0x2,%eax
+  803ee8:	74 02                	je     803eec <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803eea:	c9                   	leave
+  803eeb:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803eec:	83 ec 08             	sub    $0x8,%esp
+  803eef:	6a 01                	push   $0x1
+  803ef1:	52                   	push   %edx
+  803ef2:	e8 3f d5 ff ff       	call   801436 <sys_futex_wake>
+  803ef7:	83 c4 10             	add    $0x10,%esp
+}
+  803efa:	eb ee                	jmp    803eea <mutex_unlock+0x16>
+
+00803efc <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803efc:	55                   	push   %ebp
+  803efd:	89 e5                	mov    %esp,%ebp
+  803eff:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803f02:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803f08:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803f0f:	5d                   	pop    %ebp
+  803f10:	c3                   	ret
+
+00803f11 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803f11:	55                   	push   %ebp
+  803f12:	89 e5                	mov    %esp,%ebp
+  803f14:	57                   	push   %edi
+  803f15:	56                   	push   %esi
+  803f16:	53                   	push   %ebx
+  803f17:	83 ec 18             	sub    $0x18,%esp
+  803f1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f1d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803f20:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803f22:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f27:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803f2c:	57                   	push   %edi
+  803f2d:	e8 a2 ff ff ff       	call   803ed4 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803f32:	83 c4 0c             	add    $0xc,%esp
+  803f35:	ff 75 10             	push   0x10(%ebp)
+  803f38:	56                   	push   %esi
+  803f39:	53                   	push   %ebx
+  803f3a:	e8 d5 d4 ff ff       	call   801414 <sys_futex_wait>
+  803f3f:	89 c6                	mov    %eax,%esi
+  803f41:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803f46:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803f4b:	89 3c 24             	mov    %edi,(%esp)
+  803f4e:	e8 13 ff ff ff       	call   803e66 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803f53:	83 c4 10             	add    $0x10,%esp
+  803f56:	83 fe ef             	cmp    $0xffffffef,%esi
+  803f59:	74 05                	je     803f60 <cond_timedwait+0x4f>
+  803f5b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803f60:	89 f0                	mov    %esi,%eax
+  803f62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f65:	5b                   	pop    %ebx
+  803f66:	5e                   	pop    %esi
+  803f67:	5f                   	pop    %edi
+  803f68:	5d                   	pop    %ebp
+  803f69:	c3                   	ret
+
+00803f6a <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803f6a:	55                   	push   %ebp
+  803f6b:	89 e5                	mov    %esp,%ebp
+  803f6d:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803f70:	6a ff                	push   $0xffffffff
+  803f72:	ff 75 0c             	push   0xc(%ebp)
+  803f75:	ff 75 08             	push   0x8(%ebp)
+  803f78:	e8 94 ff ff ff       	call   803f11 <cond_timedwait>
+}
+  803f7d:	83 c4 10             	add    $0x10,%esp
+  803f80:	c9                   	leave
+  803f81:	c3                   	ret
+
+00803f82 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803f82:	55                   	push   %ebp
+  803f83:	89 e5                	mov    %esp,%ebp
+  803f85:	83 ec 08             	sub    $0x8,%esp
+  803f88:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f8b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f90:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803f94:	8b 50 04             	mov    0x4(%eax),%edx
+  803f97:	85 d2                	test   %edx,%edx
+  803f99:	75 02                	jne    803f9d <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803f9b:	c9                   	leave
+  803f9c:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803f9d:	83 ec 08             	sub    $0x8,%esp
+  803fa0:	6a 01                	push   $0x1
+  803fa2:	50                   	push   %eax
+  803fa3:	e8 8e d4 ff ff       	call   801436 <sys_futex_wake>
+  803fa8:	83 c4 10             	add    $0x10,%esp
+}
+  803fab:	eb ee                	jmp    803f9b <cond_signal+0x19>
+
+00803fad <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803fad:	55                   	push   %ebp
+  803fae:	89 e5                	mov    %esp,%ebp
+  803fb0:	83 ec 08             	sub    $0x8,%esp
+  803fb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fb6:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fbb:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803fbf:	8b 50 04             	mov    0x4(%eax),%edx
+  803fc2:	85 d2                	test   %edx,%edx
+  803fc4:	75 02                	jne    803fc8 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803fc6:	c9                   	leave
+  803fc7:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803fc8:	83 ec 08             	sub    $0x8,%esp
+  803fcb:	68 00 04 00 00       	push   $0x400
+  803fd0:	50                   	push   %eax
+  803fd1:	e8 60 d4 ff ff       	call   801436 <sys_futex_wake>
+  803fd6:	83 c4 10             	add    $0x10,%esp
+}
+  803fd9:	eb eb                	jmp    803fc6 <cond_broadcast+0x19>
+
+00803fdb <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe0:	c3                   	ret
+
+00803fe1 <devcons_poll>:
+{
+  803fe1:	55                   	push   %ebp
+  803fe2:	89 e5                	mov    %esp,%ebp
+  803fe4:	53                   	push   %ebx
+  803fe5:	83 ec 04             	sub    $0x4,%esp
+  803fe8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803feb:	89 da                	mov    %ebx,%edx
+  803fed:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803ff0:	83 3d 34 7a 80 00 00 	cmpl   $0x0,0x807a34
+  803ff7:	74 0c                	je     804005 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803ff9:	89 d8                	mov    %ebx,%eax
+  803ffb:	83 e0 01             	and    $0x1,%eax
+  803ffe:	09 d0                	or     %edx,%eax
+}
+  804000:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804003:	c9                   	leave
+  804004:	c3                   	ret
+		cons_peek = sys_cgetc();
+  804005:	e8 6e cf ff ff       	call   800f78 <sys_cgetc>
+  80400a:	a3 34 7a 80 00       	mov    %eax,0x807a34
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80400f:	89 da                	mov    %ebx,%edx
+  804011:	83 e2 04             	and    $0x4,%edx
+  804014:	85 c0                	test   %eax,%eax
+  804016:	74 e6                	je     803ffe <devcons_poll+0x1d>
+  804018:	eb df                	jmp    803ff9 <devcons_poll+0x18>
+
+0080401a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80401a:	55                   	push   %ebp
+  80401b:	89 e5                	mov    %esp,%ebp
+  80401d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804020:	68 cc 51 80 00       	push   $0x8051cc
+  804025:	ff 75 0c             	push   0xc(%ebp)
+  804028:	e8 b5 cb ff ff       	call   800be2 <strcpy>
+	return 0;
+}
+  80402d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804032:	c9                   	leave
+  804033:	c3                   	ret
+
+00804034 <devcons_write>:
+{
+  804034:	55                   	push   %ebp
+  804035:	89 e5                	mov    %esp,%ebp
+  804037:	57                   	push   %edi
+  804038:	56                   	push   %esi
+  804039:	53                   	push   %ebx
+  80403a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804040:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804043:	85 ff                	test   %edi,%edi
+  804045:	74 51                	je     804098 <devcons_write+0x64>
+  804047:	be 00 00 00 00       	mov    $0x0,%esi
+  80404c:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804051:	89 fb                	mov    %edi,%ebx
+  804053:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  804055:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80405a:	39 d3                	cmp    %edx,%ebx
+  80405c:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80405f:	83 ec 04             	sub    $0x4,%esp
+  804062:	53                   	push   %ebx
+  804063:	03 45 0c             	add    0xc(%ebp),%eax
+  804066:	50                   	push   %eax
+  804067:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80406d:	50                   	push   %eax
+  80406e:	e8 1f cd ff ff       	call   800d92 <memmove>
+		sys_cputs(buf, m);
+  804073:	83 c4 08             	add    $0x8,%esp
+  804076:	53                   	push   %ebx
+  804077:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80407d:	50                   	push   %eax
+  80407e:	e8 d7 ce ff ff       	call   800f5a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804083:	01 de                	add    %ebx,%esi
+  804085:	89 f0                	mov    %esi,%eax
+  804087:	83 c4 10             	add    $0x10,%esp
+  80408a:	39 fe                	cmp    %edi,%esi
+  80408c:	72 c3                	jb     804051 <devcons_write+0x1d>
+}
+  80408e:	89 f0                	mov    %esi,%eax
+  804090:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804093:	5b                   	pop    %ebx
+  804094:	5e                   	pop    %esi
+  804095:	5f                   	pop    %edi
+  804096:	5d                   	pop    %ebp
+  804097:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  804098:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80409d:	eb ef                	jmp    80408e <devcons_write+0x5a>
+
+0080409f <devcons_read>:
+{
+  80409f:	55                   	push   %ebp
+  8040a0:	89 e5                	mov    %esp,%ebp
+  8040a2:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8040a5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8040aa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8040ae:	74 36                	je     8040e6 <devcons_read+0x47>
+	c = cons_peek;
+  8040b0:	a1 34 7a 80 00       	mov    0x807a34,%eax
+	cons_peek = 0;
+  8040b5:	c7 05 34 7a 80 00 00 	movl   $0x0,0x807a34
+  8040bc:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8040bf:	85 c0                	test   %eax,%eax
+  8040c1:	75 10                	jne    8040d3 <devcons_read+0x34>
+  8040c3:	e8 b0 ce ff ff       	call   800f78 <sys_cgetc>
+  8040c8:	85 c0                	test   %eax,%eax
+  8040ca:	75 07                	jne    8040d3 <devcons_read+0x34>
+		sys_yield();
+  8040cc:	e8 26 cf ff ff       	call   800ff7 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8040d1:	eb f0                	jmp    8040c3 <devcons_read+0x24>
+	if (c < 0)
+  8040d3:	85 c0                	test   %eax,%eax
+  8040d5:	78 0f                	js     8040e6 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8040d7:	83 f8 04             	cmp    $0x4,%eax
+  8040da:	74 0c                	je     8040e8 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8040dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8040df:	88 02                	mov    %al,(%edx)
+	return 1;
+  8040e1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8040e6:	c9                   	leave
+  8040e7:	c3                   	ret
+		return 0;
+  8040e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ed:	eb f7                	jmp    8040e6 <devcons_read+0x47>
+
+008040ef <cputchar>:
+{
+  8040ef:	55                   	push   %ebp
+  8040f0:	89 e5                	mov    %esp,%ebp
+  8040f2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8040f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040f8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8040fb:	6a 01                	push   $0x1
+  8040fd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804100:	50                   	push   %eax
+  804101:	e8 54 ce ff ff       	call   800f5a <sys_cputs>
+}
+  804106:	83 c4 10             	add    $0x10,%esp
+  804109:	c9                   	leave
+  80410a:	c3                   	ret
+
+0080410b <getchar>:
+{
+  80410b:	55                   	push   %ebp
+  80410c:	89 e5                	mov    %esp,%ebp
+  80410e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804111:	6a 01                	push   $0x1
+  804113:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804116:	50                   	push   %eax
+  804117:	6a 00                	push   $0x0
+  804119:	e8 d2 dd ff ff       	call   801ef0 <read>
+	if (r < 0)
+  80411e:	83 c4 10             	add    $0x10,%esp
+  804121:	85 c0                	test   %eax,%eax
+  804123:	78 06                	js     80412b <getchar+0x20>
+	if (r < 1)
+  804125:	74 06                	je     80412d <getchar+0x22>
+	return c;
+  804127:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80412b:	c9                   	leave
+  80412c:	c3                   	ret
+		return -E_EOF;
+  80412d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804132:	eb f7                	jmp    80412b <getchar+0x20>
+
+00804134 <iscons>:
+{
+  804134:	55                   	push   %ebp
+  804135:	89 e5                	mov    %esp,%ebp
+  804137:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80413a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80413d:	50                   	push   %eax
+  80413e:	ff 75 08             	push   0x8(%ebp)
+  804141:	e8 26 db ff ff       	call   801c6c <fd_lookup>
+  804146:	83 c4 10             	add    $0x10,%esp
+  804149:	85 c0                	test   %eax,%eax
+  80414b:	78 11                	js     80415e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80414d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804150:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  804156:	39 10                	cmp    %edx,(%eax)
+  804158:	0f 94 c0             	sete   %al
+  80415b:	0f b6 c0             	movzbl %al,%eax
+}
+  80415e:	c9                   	leave
+  80415f:	c3                   	ret
+
+00804160 <opencons>:
+{
+  804160:	55                   	push   %ebp
+  804161:	89 e5                	mov    %esp,%ebp
+  804163:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804166:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804169:	50                   	push   %eax
+  80416a:	e8 ad da ff ff       	call   801c1c <fd_alloc>
+  80416f:	83 c4 10             	add    $0x10,%esp
+  804172:	85 c0                	test   %eax,%eax
+  804174:	78 3a                	js     8041b0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804176:	83 ec 04             	sub    $0x4,%esp
+  804179:	68 07 04 00 00       	push   $0x407
+  80417e:	ff 75 f4             	push   -0xc(%ebp)
+  804181:	6a 00                	push   $0x0
+  804183:	e8 8e ce ff ff       	call   801016 <sys_page_alloc>
+  804188:	83 c4 10             	add    $0x10,%esp
+  80418b:	85 c0                	test   %eax,%eax
+  80418d:	78 21                	js     8041b0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80418f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804192:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  804198:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80419a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80419d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8041a4:	83 ec 0c             	sub    $0xc,%esp
+  8041a7:	50                   	push   %eax
+  8041a8:	e8 48 da ff ff       	call   801bf5 <fd2num>
+  8041ad:	83 c4 10             	add    $0x10,%esp
+}
+  8041b0:	c9                   	leave
+  8041b1:	c3                   	ret
+
+008041b2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8041b2:	55                   	push   %ebp
+  8041b3:	89 e5                	mov    %esp,%ebp
+  8041b5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8041b8:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8041bf:	74 0a                	je     8041cb <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8041c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041c4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8041c9:	c9                   	leave
+  8041ca:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8041cb:	83 ec 04             	sub    $0x4,%esp
+  8041ce:	6a 07                	push   $0x7
+  8041d0:	68 00 f0 bf ee       	push   $0xeebff000
+  8041d5:	6a 00                	push   $0x0
+  8041d7:	e8 3a ce ff ff       	call   801016 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8041dc:	83 c4 08             	add    $0x8,%esp
+  8041df:	68 f0 41 80 00       	push   $0x8041f0
+  8041e4:	6a 00                	push   $0x0
+  8041e6:	e8 76 cf ff ff       	call   801161 <sys_env_set_pgfault_upcall>
+  8041eb:	83 c4 10             	add    $0x10,%esp
+  8041ee:	eb d1                	jmp    8041c1 <set_pgfault_handler+0xf>
+
+008041f0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8041f0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8041f1:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8041f6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8041f8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  8041fb:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  8041ff:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804202:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804206:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804208:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80420c:	83 c4 08             	add    $0x8,%esp
+	popal;
+  80420f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804210:	83 c4 04             	add    $0x4,%esp
+	popf
+  804213:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804214:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804215:	c3                   	ret
+
+00804216 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804216:	55                   	push   %ebp
+  804217:	89 e5                	mov    %esp,%ebp
+  804219:	56                   	push   %esi
+  80421a:	53                   	push   %ebx
+  80421b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80421e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804221:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804224:	85 c0                	test   %eax,%eax
+  804226:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80422b:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80422e:	83 ec 0c             	sub    $0xc,%esp
+  804231:	50                   	push   %eax
+  804232:	e8 8f cf ff ff       	call   8011c6 <sys_ipc_recv>
+  804237:	83 c4 10             	add    $0x10,%esp
+  80423a:	85 c0                	test   %eax,%eax
+  80423c:	0f 88 8b 00 00 00    	js     8042cd <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804242:	85 f6                	test   %esi,%esi
+  804244:	74 2a                	je     804270 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804246:	89 e2                	mov    %esp,%edx
+  804248:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80424d:	29 d0                	sub    %edx,%eax
+  80424f:	89 c2                	mov    %eax,%edx
+  804251:	c1 ea 0f             	shr    $0xf,%edx
+  804254:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80425e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804261:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  804268:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80426e:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804270:	85 db                	test   %ebx,%ebx
+  804272:	74 2a                	je     80429e <ipc_recv+0x88>
+  804274:	89 e2                	mov    %esp,%edx
+  804276:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80427b:	29 d0                	sub    %edx,%eax
+  80427d:	89 c2                	mov    %eax,%edx
+  80427f:	c1 ea 0f             	shr    $0xf,%edx
+  804282:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428c:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80428f:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  804296:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80429c:	89 03                	mov    %eax,(%ebx)
+  80429e:	89 e2                	mov    %esp,%edx
+  8042a0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8042a5:	29 d0                	sub    %edx,%eax
+  8042a7:	89 c2                	mov    %eax,%edx
+  8042a9:	c1 ea 0f             	shr    $0xf,%edx
+  8042ac:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8042b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b6:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8042b9:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  8042c0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8042c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042c9:	5b                   	pop    %ebx
+  8042ca:	5e                   	pop    %esi
+  8042cb:	5d                   	pop    %ebp
+  8042cc:	c3                   	ret
+		if(from_env_store != NULL)
+  8042cd:	85 f6                	test   %esi,%esi
+  8042cf:	74 06                	je     8042d7 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8042d1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8042d7:	85 db                	test   %ebx,%ebx
+  8042d9:	74 eb                	je     8042c6 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8042db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8042e1:	eb e3                	jmp    8042c6 <ipc_recv+0xb0>
+
+008042e3 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8042e3:	55                   	push   %ebp
+  8042e4:	89 e5                	mov    %esp,%ebp
+  8042e6:	57                   	push   %edi
+  8042e7:	56                   	push   %esi
+  8042e8:	53                   	push   %ebx
+  8042e9:	83 ec 14             	sub    $0x14,%esp
+  8042ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042f2:	8b 75 14             	mov    0x14(%ebp),%esi
+  8042f5:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8042f8:	85 c0                	test   %eax,%eax
+  8042fa:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8042ff:	0f 44 c2             	cmove  %edx,%eax
+  804302:	ff 75 10             	push   0x10(%ebp)
+  804305:	50                   	push   %eax
+  804306:	e8 1d cf ff ff       	call   801228 <sys_ipc_recv_pages>
+  80430b:	83 c4 10             	add    $0x10,%esp
+  80430e:	85 c0                	test   %eax,%eax
+  804310:	0f 88 ba 00 00 00    	js     8043d0 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804316:	85 ff                	test   %edi,%edi
+  804318:	74 2a                	je     804344 <ipc_recv_pages+0x61>
+  80431a:	89 e2                	mov    %esp,%edx
+  80431c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804321:	29 d0                	sub    %edx,%eax
+  804323:	89 c2                	mov    %eax,%edx
+  804325:	c1 ea 0f             	shr    $0xf,%edx
+  804328:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80432d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804332:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804335:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  80433c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804342:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804344:	85 f6                	test   %esi,%esi
+  804346:	74 2a                	je     804372 <ipc_recv_pages+0x8f>
+  804348:	89 e2                	mov    %esp,%edx
+  80434a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80434f:	29 d0                	sub    %edx,%eax
+  804351:	89 c2                	mov    %eax,%edx
+  804353:	c1 ea 0f             	shr    $0xf,%edx
+  804356:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80435b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804360:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804363:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  80436a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804370:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804372:	85 db                	test   %ebx,%ebx
+  804374:	74 2a                	je     8043a0 <ipc_recv_pages+0xbd>
+  804376:	89 e2                	mov    %esp,%edx
+  804378:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80437d:	29 d0                	sub    %edx,%eax
+  80437f:	89 c2                	mov    %eax,%edx
+  804381:	c1 ea 0f             	shr    $0xf,%edx
+  804384:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80438e:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804391:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  804398:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80439e:	89 03                	mov    %eax,(%ebx)
+  8043a0:	89 e2                	mov    %esp,%edx
+  8043a2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043a7:	29 d0                	sub    %edx,%eax
+  8043a9:	89 c2                	mov    %eax,%edx
+  8043ab:	c1 ea 0f             	shr    $0xf,%edx
+  8043ae:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b8:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8043bb:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  8043c2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8043c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043cb:	5b                   	pop    %ebx
+  8043cc:	5e                   	pop    %esi
+  8043cd:	5f                   	pop    %edi
+  8043ce:	5d                   	pop    %ebp
+  8043cf:	c3                   	ret
+		if (from_env_store)
+  8043d0:	85 ff                	test   %edi,%edi
+  8043d2:	74 06                	je     8043da <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8043d4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8043da:	85 f6                	test   %esi,%esi
+  8043dc:	74 06                	je     8043e4 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8043de:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8043e4:	85 db                	test   %ebx,%ebx
+  8043e6:	74 e0                	je     8043c8 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8043e8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8043ee:	eb d8                	jmp    8043c8 <ipc_recv_pages+0xe5>
+
+008043f0 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8043f0:	55                   	push   %ebp
+  8043f1:	89 e5                	mov    %esp,%ebp
+  8043f3:	57                   	push   %edi
+  8043f4:	56                   	push   %esi
+  8043f5:	53                   	push   %ebx
+  8043f6:	83 ec 1c             	sub    $0x1c,%esp
+  8043f9:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8043fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043ff:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804405:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804409:	75 2b                	jne    804436 <ipc_try_send_pages+0x46>
+  80440b:	89 e2                	mov    %esp,%edx
+  80440d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804412:	29 d0                	sub    %edx,%eax
+  804414:	89 c2                	mov    %eax,%edx
+  804416:	c1 ea 0f             	shr    $0xf,%edx
+  804419:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80441e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804423:	0f 42 c2             	cmovb  %edx,%eax
+  804426:	8b 04 85 60 7a 80 00 	mov    0x807a60(,%eax,4),%eax
+  80442d:	8b 70 48             	mov    0x48(%eax),%esi
+  804430:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804436:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80443c:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804441:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804444:	85 ff                	test   %edi,%edi
+  804446:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80444b:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80444e:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804454:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80445a:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804460:	83 ec 0c             	sub    $0xc,%esp
+  804463:	ff 75 14             	push   0x14(%ebp)
+  804466:	ff 75 18             	push   0x18(%ebp)
+  804469:	57                   	push   %edi
+  80446a:	ff 75 0c             	push   0xc(%ebp)
+  80446d:	ff 75 08             	push   0x8(%ebp)
+  804470:	e8 92 cd ff ff       	call   801207 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804475:	83 c4 20             	add    $0x20,%esp
+  804478:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80447b:	75 21                	jne    80449e <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80447d:	83 ec 04             	sub    $0x4,%esp
+  804480:	6a ff                	push   $0xffffffff
+  804482:	53                   	push   %ebx
+  804483:	ff 75 e4             	push   -0x1c(%ebp)
+  804486:	e8 89 cf ff ff       	call   801414 <sys_futex_wait>
+  80448b:	83 c4 10             	add    $0x10,%esp
+  80448e:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804491:	74 c7                	je     80445a <ipc_try_send_pages+0x6a>
+  804493:	85 c0                	test   %eax,%eax
+  804495:	79 c3                	jns    80445a <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804497:	e8 5b cb ff ff       	call   800ff7 <sys_yield>
+  80449c:	eb bc                	jmp    80445a <ipc_try_send_pages+0x6a>
+	}
+}
+  80449e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044a1:	5b                   	pop    %ebx
+  8044a2:	5e                   	pop    %esi
+  8044a3:	5f                   	pop    %edi
+  8044a4:	5d                   	pop    %ebp
+  8044a5:	c3                   	ret
+
+008044a6 <ipc_send>:
+{
+  8044a6:	55                   	push   %ebp
+  8044a7:	89 e5                	mov    %esp,%ebp
+  8044a9:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8044ac:	ff 75 14             	push   0x14(%ebp)
+  8044af:	6a 01                	push   $0x1
+  8044b1:	ff 75 10             	push   0x10(%ebp)
+  8044b4:	ff 75 0c             	push   0xc(%ebp)
+  8044b7:	ff 75 08             	push   0x8(%ebp)
+  8044ba:	e8 31 ff ff ff       	call   8043f0 <ipc_try_send_pages>
+  8044bf:	83 c4 20             	add    $0x20,%esp
+  8044c2:	85 c0                	test   %eax,%eax
+  8044c4:	78 02                	js     8044c8 <ipc_send+0x22>
+}
+  8044c6:	c9                   	leave
+  8044c7:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8044c8:	50                   	push   %eax
+  8044c9:	68 d8 51 80 00       	push   $0x8051d8
+  8044ce:	6a 3f                	push   $0x3f
+  8044d0:	68 ed 51 80 00       	push   $0x8051ed
+  8044d5:	e8 36 bf ff ff       	call   800410 <_panic>
+
+008044da <ipc_send_pages>:
+{
+  8044da:	55                   	push   %ebp
+  8044db:	89 e5                	mov    %esp,%ebp
+  8044dd:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8044e0:	ff 75 18             	push   0x18(%ebp)
+  8044e3:	ff 75 14             	push   0x14(%ebp)
+  8044e6:	ff 75 10             	push   0x10(%ebp)
+  8044e9:	ff 75 0c             	push   0xc(%ebp)
+  8044ec:	ff 75 08             	push   0x8(%ebp)
+  8044ef:	e8 fc fe ff ff       	call   8043f0 <ipc_try_send_pages>
+  8044f4:	83 c4 20             	add    $0x20,%esp
+  8044f7:	85 c0                	test   %eax,%eax
+  8044f9:	78 02                	js     8044fd <ipc_send_pages+0x23>
+}
+  8044fb:	c9                   	leave
+  8044fc:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8044fd:	50                   	push   %eax
+  8044fe:	68 f7 51 80 00       	push   $0x8051f7
+  804503:	6a 64                	push   $0x64
+  804505:	68 ed 51 80 00       	push   $0x8051ed
+  80450a:	e8 01 bf ff ff       	call   800410 <_panic>
+
+0080450f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80450f:	55                   	push   %ebp
+  804510:	89 e5                	mov    %esp,%ebp
+  804512:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804515:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80451a:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804520:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804526:	8b 52 50             	mov    0x50(%edx),%edx
+  804529:	39 ca                	cmp    %ecx,%edx
+  80452b:	74 11                	je     80453e <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80452d:	83 c0 01             	add    $0x1,%eax
+  804530:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804535:	75 e3                	jne    80451a <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80453c:	eb 0e                	jmp    80454c <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80453e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804544:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804549:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80454c:	5d                   	pop    %ebp
+  80454d:	c3                   	ret
+
+0080454e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80454e:	55                   	push   %ebp
+  80454f:	89 e5                	mov    %esp,%ebp
+  804551:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804554:	89 c2                	mov    %eax,%edx
+  804556:	c1 ea 16             	shr    $0x16,%edx
+  804559:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804560:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804565:	f6 c1 01             	test   $0x1,%cl
+  804568:	74 1e                	je     804588 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80456a:	c1 e8 0c             	shr    $0xc,%eax
+  80456d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804574:	a8 01                	test   $0x1,%al
+  804576:	74 10                	je     804588 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804578:	c1 e8 0c             	shr    $0xc,%eax
+  80457b:	c1 e0 04             	shl    $0x4,%eax
+  80457e:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804585:	0f b7 d2             	movzwl %dx,%edx
+}
+  804588:	89 d0                	mov    %edx,%eax
+  80458a:	5d                   	pop    %ebp
+  80458b:	c3                   	ret
+
+0080458c <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  80458c:	55                   	push   %ebp
+  80458d:	89 e5                	mov    %esp,%ebp
+  80458f:	57                   	push   %edi
+  804590:	56                   	push   %esi
+  804591:	53                   	push   %ebx
+  804592:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  804595:	8b 45 08             	mov    0x8(%ebp),%eax
+  804598:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  80459b:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  80459e:	bf 38 7a 80 00       	mov    $0x807a38,%edi
+  8045a3:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  8045a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8045ab:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8045ae:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  8045b1:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  8045b6:	f6 e2                	mul    %dl
+  8045b8:	66 c1 e8 0b          	shr    $0xb,%ax
+  8045bc:	89 c7                	mov    %eax,%edi
+  8045be:	88 45 e0             	mov    %al,-0x20(%ebp)
+  8045c1:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  8045c4:	01 db                	add    %ebx,%ebx
+  8045c6:	89 d0                	mov    %edx,%eax
+  8045c8:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  8045ca:	89 d6                	mov    %edx,%esi
+  8045cc:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  8045ce:	89 cb                	mov    %ecx,%ebx
+  8045d0:	83 c1 01             	add    $0x1,%ecx
+  8045d3:	0f b6 fb             	movzbl %bl,%edi
+  8045d6:	83 c0 30             	add    $0x30,%eax
+  8045d9:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  8045dd:	89 f0                	mov    %esi,%eax
+  8045df:	3c 09                	cmp    $0x9,%al
+  8045e1:	77 ce                	ja     8045b1 <inet_ntoa+0x25>
+  8045e3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8045e6:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8045e9:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  8045eb:	84 c9                	test   %cl,%cl
+  8045ed:	74 4d                	je     80463c <inet_ntoa+0xb0>
+  8045ef:	0f b6 db             	movzbl %bl,%ebx
+  8045f2:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  8045f5:	01 d8                	add    %ebx,%eax
+  8045f7:	89 f9                	mov    %edi,%ecx
+  8045f9:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  8045fc:	83 c1 01             	add    $0x1,%ecx
+  8045ff:	0f b6 10             	movzbl (%eax),%edx
+  804602:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  804605:	89 c2                	mov    %eax,%edx
+  804607:	83 e8 01             	sub    $0x1,%eax
+  80460a:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  80460d:	39 da                	cmp    %ebx,%edx
+  80460f:	75 eb                	jne    8045fc <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  804611:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804614:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  804618:	8d 78 01             	lea    0x1(%eax),%edi
+  80461b:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  80461e:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  804621:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  804624:	39 ce                	cmp    %ecx,%esi
+  804626:	0f 85 77 ff ff ff    	jne    8045a3 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  80462c:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  80462f:	b8 38 7a 80 00       	mov    $0x807a38,%eax
+  804634:	83 c4 1c             	add    $0x1c,%esp
+  804637:	5b                   	pop    %ebx
+  804638:	5e                   	pop    %esi
+  804639:	5f                   	pop    %edi
+  80463a:	5d                   	pop    %ebp
+  80463b:	c3                   	ret
+    while(i--)
+  80463c:	89 f8                	mov    %edi,%eax
+  80463e:	eb d8                	jmp    804618 <inet_ntoa+0x8c>
+
+00804640 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  804640:	55                   	push   %ebp
+  804641:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  804643:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  804647:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  80464b:	5d                   	pop    %ebp
+  80464c:	c3                   	ret
+
+0080464d <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80464d:	55                   	push   %ebp
+  80464e:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  804650:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  804654:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  804658:	5d                   	pop    %ebp
+  804659:	c3                   	ret
+
+0080465a <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  80465a:	55                   	push   %ebp
+  80465b:	89 e5                	mov    %esp,%ebp
+  80465d:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  804660:	89 d0                	mov    %edx,%eax
+  804662:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  804665:	89 d1                	mov    %edx,%ecx
+  804667:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  80466a:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  80466c:	89 d1                	mov    %edx,%ecx
+  80466e:	c1 e1 08             	shl    $0x8,%ecx
+  804671:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  804677:	09 c8                	or     %ecx,%eax
+  804679:	c1 ea 08             	shr    $0x8,%edx
+  80467c:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  804682:	09 d0                	or     %edx,%eax
+}
+  804684:	5d                   	pop    %ebp
+  804685:	c3                   	ret
+
+00804686 <inet_aton>:
+{
+  804686:	55                   	push   %ebp
+  804687:	89 e5                	mov    %esp,%ebp
+  804689:	57                   	push   %edi
+  80468a:	56                   	push   %esi
+  80468b:	53                   	push   %ebx
+  80468c:	83 ec 2c             	sub    $0x2c,%esp
+  80468f:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  804692:	0f b6 0a             	movzbl (%edx),%ecx
+  804695:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  804698:	83 e9 30             	sub    $0x30,%ecx
+  80469b:	80 f9 09             	cmp    $0x9,%cl
+  80469e:	0f 87 b6 01 00 00    	ja     80485a <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  8046a4:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8046a7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8046aa:	e9 aa 00 00 00       	jmp    804759 <inet_aton+0xd3>
+      c = *++cp;
+  8046af:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8046b3:	89 c1                	mov    %eax,%ecx
+  8046b5:	83 e1 df             	and    $0xffffffdf,%ecx
+  8046b8:	80 f9 58             	cmp    $0x58,%cl
+  8046bb:	74 10                	je     8046cd <inet_aton+0x47>
+      c = *++cp;
+  8046bd:	83 c2 01             	add    $0x1,%edx
+  8046c0:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8046c3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8046c8:	e9 9a 00 00 00       	jmp    804767 <inet_aton+0xe1>
+        c = *++cp;
+  8046cd:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8046d1:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  8046d4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8046d9:	e9 89 00 00 00       	jmp    804767 <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  8046de:	0f af d7             	imul   %edi,%edx
+  8046e1:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  8046e5:	0f be 01             	movsbl (%ecx),%eax
+  8046e8:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  8046eb:	88 45 d7             	mov    %al,-0x29(%ebp)
+  8046ee:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  8046f1:	80 fb 09             	cmp    $0x9,%bl
+  8046f4:	76 e8                	jbe    8046de <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  8046f6:	83 ff 10             	cmp    $0x10,%edi
+  8046f9:	75 2e                	jne    804729 <inet_aton+0xa3>
+  8046fb:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  8046ff:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  804702:	83 e3 df             	and    $0xffffffdf,%ebx
+  804705:	83 eb 41             	sub    $0x41,%ebx
+  804708:	80 fb 05             	cmp    $0x5,%bl
+  80470b:	77 1c                	ja     804729 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80470d:	c1 e2 04             	shl    $0x4,%edx
+  804710:	83 c0 0a             	add    $0xa,%eax
+  804713:	89 f3                	mov    %esi,%ebx
+  804715:	80 fb 1a             	cmp    $0x1a,%bl
+  804718:	19 db                	sbb    %ebx,%ebx
+  80471a:	83 e3 20             	and    $0x20,%ebx
+  80471d:	83 c3 41             	add    $0x41,%ebx
+  804720:	29 d8                	sub    %ebx,%eax
+  804722:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  804724:	0f be 01             	movsbl (%ecx),%eax
+  804727:	eb bf                	jmp    8046e8 <inet_aton+0x62>
+    if (c == '.') {
+  804729:	83 f8 2e             	cmp    $0x2e,%eax
+  80472c:	75 46                	jne    804774 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  80472e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804731:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  804734:	39 f0                	cmp    %esi,%eax
+  804736:	0f 84 25 01 00 00    	je     804861 <inet_aton+0x1db>
+      *pp++ = val;
+  80473c:	83 c0 04             	add    $0x4,%eax
+  80473f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  804742:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  804745:	89 ca                	mov    %ecx,%edx
+  804747:	0f b6 09             	movzbl (%ecx),%ecx
+  80474a:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  80474d:	83 e9 30             	sub    $0x30,%ecx
+  804750:	80 f9 09             	cmp    $0x9,%cl
+  804753:	0f 87 17 01 00 00    	ja     804870 <inet_aton+0x1ea>
+    base = 10;
+  804759:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80475e:	83 f8 30             	cmp    $0x30,%eax
+  804761:	0f 84 48 ff ff ff    	je     8046af <inet_aton+0x29>
+  804767:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  80476a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80476f:	e9 77 ff ff ff       	jmp    8046eb <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804774:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  804778:	89 d6                	mov    %edx,%esi
+  80477a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80477d:	85 c0                	test   %eax,%eax
+  80477f:	74 2e                	je     8047af <inet_aton+0x129>
+    return (0);
+  804781:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804786:	89 fa                	mov    %edi,%edx
+  804788:	80 fa 1f             	cmp    $0x1f,%dl
+  80478b:	0f 86 d5 00 00 00    	jbe    804866 <inet_aton+0x1e0>
+  804791:	84 c0                	test   %al,%al
+  804793:	0f 88 cd 00 00 00    	js     804866 <inet_aton+0x1e0>
+  804799:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  80479c:	83 f9 04             	cmp    $0x4,%ecx
+  80479f:	76 0e                	jbe    8047af <inet_aton+0x129>
+    return (0);
+  8047a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8047a6:	83 f8 20             	cmp    $0x20,%eax
+  8047a9:	0f 85 b7 00 00 00    	jne    804866 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  8047af:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8047b2:	89 d8                	mov    %ebx,%eax
+  8047b4:	29 c8                	sub    %ecx,%eax
+  8047b6:	c1 f8 02             	sar    $0x2,%eax
+  8047b9:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8047bc:	83 f8 02             	cmp    $0x2,%eax
+  8047bf:	74 7a                	je     80483b <inet_aton+0x1b5>
+  8047c1:	83 f9 03             	cmp    $0x3,%ecx
+  8047c4:	7f 49                	jg     80480f <inet_aton+0x189>
+  8047c6:	85 c9                	test   %ecx,%ecx
+  8047c8:	0f 84 98 00 00 00    	je     804866 <inet_aton+0x1e0>
+  8047ce:	83 f9 02             	cmp    $0x2,%ecx
+  8047d1:	75 19                	jne    8047ec <inet_aton+0x166>
+      return (0);
+  8047d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  8047d8:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  8047de:	0f 87 82 00 00 00    	ja     804866 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  8047e4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8047e7:	c1 e0 18             	shl    $0x18,%eax
+  8047ea:	09 c6                	or     %eax,%esi
+  return (1);
+  8047ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  8047f1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8047f5:	74 6f                	je     804866 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  8047f7:	83 ec 0c             	sub    $0xc,%esp
+  8047fa:	56                   	push   %esi
+  8047fb:	e8 5a fe ff ff       	call   80465a <htonl>
+  804800:	83 c4 10             	add    $0x10,%esp
+  804803:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804806:	89 06                	mov    %eax,(%esi)
+  return (1);
+  804808:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80480d:	eb 57                	jmp    804866 <inet_aton+0x1e0>
+  switch (n) {
+  80480f:	83 f9 04             	cmp    $0x4,%ecx
+  804812:	75 d8                	jne    8047ec <inet_aton+0x166>
+      return (0);
+  804814:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  804819:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80481f:	77 45                	ja     804866 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  804821:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  804824:	c1 e0 18             	shl    $0x18,%eax
+  804827:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80482a:	c1 e1 10             	shl    $0x10,%ecx
+  80482d:	09 c8                	or     %ecx,%eax
+  80482f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804832:	c1 e1 08             	shl    $0x8,%ecx
+  804835:	09 c8                	or     %ecx,%eax
+  804837:	09 c6                	or     %eax,%esi
+    break;
+  804839:	eb b1                	jmp    8047ec <inet_aton+0x166>
+      return (0);
+  80483b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  804840:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  804846:	77 1e                	ja     804866 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  804848:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80484b:	c1 e0 18             	shl    $0x18,%eax
+  80484e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  804851:	c1 e1 10             	shl    $0x10,%ecx
+  804854:	09 c8                	or     %ecx,%eax
+  804856:	09 c6                	or     %eax,%esi
+    break;
+  804858:	eb 92                	jmp    8047ec <inet_aton+0x166>
+      return (0);
+  80485a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80485f:	eb 05                	jmp    804866 <inet_aton+0x1e0>
+        return (0);
+  804861:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  804866:	89 c8                	mov    %ecx,%eax
+  804868:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80486b:	5b                   	pop    %ebx
+  80486c:	5e                   	pop    %esi
+  80486d:	5f                   	pop    %edi
+  80486e:	5d                   	pop    %ebp
+  80486f:	c3                   	ret
+      return (0);
+  804870:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804875:	eb ef                	jmp    804866 <inet_aton+0x1e0>
+
+00804877 <inet_addr>:
+{
+  804877:	55                   	push   %ebp
+  804878:	89 e5                	mov    %esp,%ebp
+  80487a:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  80487d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804880:	50                   	push   %eax
+  804881:	ff 75 08             	push   0x8(%ebp)
+  804884:	e8 fd fd ff ff       	call   804686 <inet_aton>
+  804889:	89 c2                	mov    %eax,%edx
+  80488b:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  80488e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  804893:	85 d2                	test   %edx,%edx
+  804895:	75 02                	jne    804899 <inet_addr+0x22>
+}
+  804897:	c9                   	leave
+  804898:	c3                   	ret
+    return (val.s_addr);
+  804899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80489c:	eb f9                	jmp    804897 <inet_addr+0x20>
+
+0080489e <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  80489e:	55                   	push   %ebp
+  80489f:	89 e5                	mov    %esp,%ebp
+  8048a1:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8048a4:	ff 75 08             	push   0x8(%ebp)
+  8048a7:	e8 ae fd ff ff       	call   80465a <htonl>
+  8048ac:	83 c4 10             	add    $0x10,%esp
+}
+  8048af:	c9                   	leave
+  8048b0:	c3                   	ret
+
+008048b1 <__udivdi3>:
+  8048b1:	57                   	push   %edi
+  8048b2:	56                   	push   %esi
+  8048b3:	53                   	push   %ebx
+  8048b4:	83 ec 20             	sub    $0x20,%esp
+  8048b7:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8048bb:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8048bf:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8048c3:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8048c7:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8048cb:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8048cf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8048d3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8048d7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8048dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048e6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8048ed:	00 
+  8048ee:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8048f5:	00 
+  8048f6:	eb 08                	jmp    804900 <__udivdi3+0x4f>
+  8048f8:	83 e9 01             	sub    $0x1,%ecx
+  8048fb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8048fe:	74 68                	je     804968 <__udivdi3+0xb7>
+  804900:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804904:	01 c0                	add    %eax,%eax
+  804906:	89 c6                	mov    %eax,%esi
+  804908:	89 d7                	mov    %edx,%edi
+  80490a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80490e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804912:	0f ad d0             	shrd   %cl,%edx,%eax
+  804915:	d3 ea                	shr    %cl,%edx
+  804917:	f6 c1 20             	test   $0x20,%cl
+  80491a:	74 04                	je     804920 <__udivdi3+0x6f>
+  80491c:	89 d0                	mov    %edx,%eax
+  80491e:	31 d2                	xor    %edx,%edx
+  804920:	83 e0 01             	and    $0x1,%eax
+  804923:	89 04 24             	mov    %eax,(%esp)
+  804926:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80492d:	00 
+  80492e:	8b 04 24             	mov    (%esp),%eax
+  804931:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804935:	09 f0                	or     %esi,%eax
+  804937:	09 fa                	or     %edi,%edx
+  804939:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80493d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804941:	39 f0                	cmp    %esi,%eax
+  804943:	89 d3                	mov    %edx,%ebx
+  804945:	19 fb                	sbb    %edi,%ebx
+  804947:	72 af                	jb     8048f8 <__udivdi3+0x47>
+  804949:	29 f0                	sub    %esi,%eax
+  80494b:	19 fa                	sbb    %edi,%edx
+  80494d:	89 cf                	mov    %ecx,%edi
+  80494f:	c1 ef 05             	shr    $0x5,%edi
+  804952:	83 e7 01             	and    $0x1,%edi
+  804955:	89 fe                	mov    %edi,%esi
+  804957:	83 f6 01             	xor    $0x1,%esi
+  80495a:	d3 e6                	shl    %cl,%esi
+  80495c:	d3 e7                	shl    %cl,%edi
+  80495e:	09 74 24 18          	or     %esi,0x18(%esp)
+  804962:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804966:	eb 90                	jmp    8048f8 <__udivdi3+0x47>
+  804968:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80496c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804970:	83 c4 20             	add    $0x20,%esp
+  804973:	5b                   	pop    %ebx
+  804974:	5e                   	pop    %esi
+  804975:	5f                   	pop    %edi
+  804976:	c3                   	ret
+
+00804977 <__umoddi3>:
+  804977:	57                   	push   %edi
+  804978:	56                   	push   %esi
+  804979:	53                   	push   %ebx
+  80497a:	83 ec 08             	sub    $0x8,%esp
+  80497d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804981:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804985:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804989:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80498d:	57                   	push   %edi
+  80498e:	56                   	push   %esi
+  80498f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804993:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804997:	52                   	push   %edx
+  804998:	50                   	push   %eax
+  804999:	e8 13 ff ff ff       	call   8048b1 <__udivdi3>
+  80499e:	89 c3                	mov    %eax,%ebx
+  8049a0:	0f af d6             	imul   %esi,%edx
+  8049a3:	89 f9                	mov    %edi,%ecx
+  8049a5:	0f af cb             	imul   %ebx,%ecx
+  8049a8:	01 d1                	add    %edx,%ecx
+  8049aa:	89 d8                	mov    %ebx,%eax
+  8049ac:	f7 e6                	mul    %esi
+  8049ae:	89 c6                	mov    %eax,%esi
+  8049b0:	89 d7                	mov    %edx,%edi
+  8049b2:	01 cf                	add    %ecx,%edi
+  8049b4:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8049b8:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8049bc:	29 f0                	sub    %esi,%eax
+  8049be:	19 fa                	sbb    %edi,%edx
+  8049c0:	83 c4 18             	add    $0x18,%esp
+  8049c3:	5b                   	pop    %ebx
+  8049c4:	5e                   	pop    %esi
+  8049c5:	5f                   	pop    %edi
+  8049c6:	c3                   	ret
+
+008049c7 <__divdi3>:
+  8049c7:	53                   	push   %ebx
+  8049c8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8049cc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8049d0:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8049d4:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8049d8:	85 d2                	test   %edx,%edx
+  8049da:	78 12                	js     8049ee <__divdi3+0x27>
+  8049dc:	85 db                	test   %ebx,%ebx
+  8049de:	78 2e                	js     804a0e <__divdi3+0x47>
+  8049e0:	53                   	push   %ebx
+  8049e1:	51                   	push   %ecx
+  8049e2:	52                   	push   %edx
+  8049e3:	50                   	push   %eax
+  8049e4:	e8 c8 fe ff ff       	call   8048b1 <__udivdi3>
+  8049e9:	83 c4 10             	add    $0x10,%esp
+  8049ec:	eb 1e                	jmp    804a0c <__divdi3+0x45>
+  8049ee:	f7 d8                	neg    %eax
+  8049f0:	83 d2 00             	adc    $0x0,%edx
+  8049f3:	f7 da                	neg    %edx
+  8049f5:	85 db                	test   %ebx,%ebx
+  8049f7:	78 2a                	js     804a23 <__divdi3+0x5c>
+  8049f9:	53                   	push   %ebx
+  8049fa:	51                   	push   %ecx
+  8049fb:	52                   	push   %edx
+  8049fc:	50                   	push   %eax
+  8049fd:	e8 af fe ff ff       	call   8048b1 <__udivdi3>
+  804a02:	83 c4 10             	add    $0x10,%esp
+  804a05:	f7 d8                	neg    %eax
+  804a07:	83 d2 00             	adc    $0x0,%edx
+  804a0a:	f7 da                	neg    %edx
+  804a0c:	5b                   	pop    %ebx
+  804a0d:	c3                   	ret
+  804a0e:	f7 d9                	neg    %ecx
+  804a10:	83 d3 00             	adc    $0x0,%ebx
+  804a13:	f7 db                	neg    %ebx
+  804a15:	53                   	push   %ebx
+  804a16:	51                   	push   %ecx
+  804a17:	52                   	push   %edx
+  804a18:	50                   	push   %eax
+  804a19:	e8 93 fe ff ff       	call   8048b1 <__udivdi3>
+  804a1e:	83 c4 10             	add    $0x10,%esp
+  804a21:	eb e2                	jmp    804a05 <__divdi3+0x3e>
+  804a23:	f7 d9                	neg    %ecx
+  804a25:	83 d3 00             	adc    $0x0,%ebx
+  804a28:	f7 db                	neg    %ebx
+  804a2a:	53                   	push   %ebx
+  804a2b:	51                   	push   %ecx
+  804a2c:	52                   	push   %edx
+  804a2d:	50                   	push   %eax
+  804a2e:	e8 7e fe ff ff       	call   8048b1 <__udivdi3>
+  804a33:	83 c4 10             	add    $0x10,%esp
+  804a36:	eb d4                	jmp    804a0c <__divdi3+0x45>
+
+00804a38 <__moddi3>:
+  804a38:	57                   	push   %edi
+  804a39:	56                   	push   %esi
+  804a3a:	53                   	push   %ebx
+  804a3b:	83 ec 08             	sub    $0x8,%esp
+  804a3e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804a42:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804a46:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804a4a:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804a4e:	57                   	push   %edi
+  804a4f:	56                   	push   %esi
+  804a50:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804a54:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804a58:	52                   	push   %edx
+  804a59:	50                   	push   %eax
+  804a5a:	e8 68 ff ff ff       	call   8049c7 <__divdi3>
+  804a5f:	89 c3                	mov    %eax,%ebx
+  804a61:	0f af d6             	imul   %esi,%edx
+  804a64:	89 f9                	mov    %edi,%ecx
+  804a66:	0f af cb             	imul   %ebx,%ecx
+  804a69:	01 d1                	add    %edx,%ecx
+  804a6b:	89 d8                	mov    %ebx,%eax
+  804a6d:	f7 e6                	mul    %esi
+  804a6f:	89 c6                	mov    %eax,%esi
+  804a71:	89 d7                	mov    %edx,%edi
+  804a73:	01 cf                	add    %ecx,%edi
+  804a75:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804a79:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804a7d:	29 f0                	sub    %esi,%eax
+  804a7f:	19 fa                	sbb    %edi,%edx
+  804a81:	83 c4 18             	add    $0x18,%esp
+  804a84:	5b                   	pop    %ebx
+  804a85:	5e                   	pop    %esi
+  804a86:	5f                   	pop    %edi
+  804a87:	c3                   	ret
@@ -0,0 +1,8802 @@
+
+obj/user/nsutil.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 17 05 00 00       	call   800548 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <sample>:
+	return 0;
+}
+
+static void
+sample(void)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+	int i;
+
+	for (i = 0; i < NENV; i++) {
+  800039:	b8 00 00 00 00       	mov    $0x0,%eax
+		cycles0[i] = envs[i].env_cycles;
+  80003e:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  800044:	8b 8a 60 00 c0 ee    	mov    -0x113fffa0(%edx),%ecx
+  80004a:	8b 9a 64 00 c0 ee    	mov    -0x113fff9c(%edx),%ebx
+  800050:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800056:	89 0c c5 00 70 80 00 	mov    %ecx,0x807000(,%eax,8)
+  80005d:	89 1c c5 04 70 80 00 	mov    %ebx,0x807004(,%eax,8)
+		runs0[i] = envs[i].env_runs;
+  800064:	8b 52 58             	mov    0x58(%edx),%edx
+  800067:	89 14 85 00 60 80 00 	mov    %edx,0x806000(,%eax,4)
+	for (i = 0; i < NENV; i++) {
+  80006e:	83 c0 01             	add    $0x1,%eax
+  800071:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800076:	75 c6                	jne    80003e <sample+0x9>
+	}
+}
+  800078:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007b:	c9                   	leave
+  80007c:	c3                   	ret
+
+0080007d <die>:
+{
+  80007d:	55                   	push   %ebp
+  80007e:	89 e5                	mov    %esp,%ebp
+  800080:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800083:	50                   	push   %eax
+  800084:	68 c0 42 80 00       	push   $0x8042c0
+  800089:	e8 f6 05 00 00       	call   800684 <cprintf>
+	exit();
+  80008e:	e8 42 05 00 00       	call   8005d5 <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	c9                   	leave
+  800097:	c3                   	ret
+
+00800098 <report>:
+// Print the share of one CPU each network server env has used since
+// sample(), 't' cycles and 'ms' milliseconds ago, and how many times
+// per second it was run.
+static void
+report(const char *what, uint64_t t, unsigned ms)
+{
+  800098:	55                   	push   %ebp
+  800099:	89 e5                	mov    %esp,%ebp
+  80009b:	57                   	push   %edi
+  80009c:	56                   	push   %esi
+  80009d:	53                   	push   %ebx
+  80009e:	83 ec 68             	sub    $0x68,%esp
+  8000a1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  8000a4:	89 55 c0             	mov    %edx,-0x40(%ebp)
+  8000a7:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  8000aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	envid_t ns = ipc_find_env(ENV_TYPE_NS);
+  8000ad:	6a 03                	push   $0x3
+  8000af:	e8 57 18 00 00       	call   80190b <ipc_find_env>
+  8000b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	uint64_t c, total = 0;
+	uint32_t runs, total_runs = 0;
+	int i, nenv = 0;
+
+	ms = ms ? ms : 1;
+  8000b7:	85 db                	test   %ebx,%ebx
+  8000b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000be:	0f 45 c3             	cmovne %ebx,%eax
+  8000c1:	89 45 b8             	mov    %eax,-0x48(%ebp)
+	for (i = 0; i < NENV; i++) {
+  8000c4:	bf 00 00 c0 ee       	mov    $0xeec00000,%edi
+  8000c9:	83 c4 10             	add    $0x10,%esp
+	int i, nenv = 0;
+  8000cc:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	for (i = 0; i < NENV; i++) {
+  8000d3:	be 00 00 00 00       	mov    $0x0,%esi
+	uint32_t runs, total_runs = 0;
+  8000d8:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+	uint64_t c, total = 0;
+  8000df:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%ebp)
+  8000e6:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+		total += c;
+		total_runs += runs;
+		nenv++;
+		cprintf("nsutil: %s: env %08x %u.%u%%, %u wakeups/s\n", what,
+			envs[i].env_id, (uint32_t) (c * 100 / t),
+			(uint32_t) (c * 1000 / t % 10), runs * 1000 / ms);
+  8000ed:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8000f0:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8000f3:	e9 37 02 00 00       	jmp    80032f <report+0x297>
+  8000f8:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8000fb:	e9 17 02 00 00       	jmp    800317 <report+0x27f>
+  800100:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  800103:	e9 0f 02 00 00       	jmp    800317 <report+0x27f>
+	}
+	cprintf("nsutil: %s: %d network server envs used %u.%u%% of a CPU, "
+  800108:	83 ec 08             	sub    $0x8,%esp
+		"%u wakeups/s\n", what, nenv, (uint32_t) (total * 100 / t),
+		(uint32_t) (total * 1000 / t % 10), total_runs * 1000 / ms);
+  80010b:	69 45 ac e8 03 00 00 	imul   $0x3e8,-0x54(%ebp),%eax
+	cprintf("nsutil: %s: %d network server envs used %u.%u%% of a CPU, "
+  800112:	ba 00 00 00 00       	mov    $0x0,%edx
+  800117:	f7 75 b8             	divl   -0x48(%ebp)
+  80011a:	50                   	push   %eax
+		(uint32_t) (total * 1000 / t % 10), total_runs * 1000 / ms);
+  80011b:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  80011e:	69 cf e8 03 00 00    	imul   $0x3e8,%edi,%ecx
+  800124:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+  800129:	f7 65 b0             	mull   -0x50(%ebp)
+  80012c:	01 ca                	add    %ecx,%edx
+  80012e:	83 ec 04             	sub    $0x4,%esp
+  800131:	ff 75 c4             	push   -0x3c(%ebp)
+  800134:	ff 75 c0             	push   -0x40(%ebp)
+  800137:	52                   	push   %edx
+  800138:	50                   	push   %eax
+  800139:	e8 8d 3f 00 00       	call   8040cb <__udivdi3>
+  80013e:	83 c4 14             	add    $0x14,%esp
+  800141:	89 c6                	mov    %eax,%esi
+  800143:	89 d7                	mov    %edx,%edi
+  800145:	89 c1                	mov    %eax,%ecx
+  800147:	01 d1                	add    %edx,%ecx
+  800149:	83 d1 00             	adc    $0x0,%ecx
+  80014c:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  800151:	89 c8                	mov    %ecx,%eax
+  800153:	f7 e3                	mul    %ebx
+  800155:	89 d0                	mov    %edx,%eax
+  800157:	c1 e8 02             	shr    $0x2,%eax
+  80015a:	83 e2 fc             	and    $0xfffffffc,%edx
+  80015d:	01 d0                	add    %edx,%eax
+  80015f:	29 c1                	sub    %eax,%ecx
+  800161:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800164:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80016b:	89 f0                	mov    %esi,%eax
+  80016d:	89 fa                	mov    %edi,%edx
+  80016f:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  800172:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  800175:	69 ca cd cc cc cc    	imul   $0xcccccccd,%edx,%ecx
+  80017b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80017e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800181:	69 55 e0 cc cc cc cc 	imul   $0xcccccccc,-0x20(%ebp),%edx
+  800188:	01 d1                	add    %edx,%ecx
+  80018a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80018d:	f7 e3                	mul    %ebx
+  80018f:	01 ca                	add    %ecx,%edx
+  800191:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  800195:	d1 ea                	shr    %edx
+  800197:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  80019c:	f7 e3                	mul    %ebx
+  80019e:	29 c6                	sub    %eax,%esi
+	cprintf("nsutil: %s: %d network server envs used %u.%u%% of a CPU, "
+  8001a0:	56                   	push   %esi
+		"%u wakeups/s\n", what, nenv, (uint32_t) (total * 100 / t),
+  8001a1:	8b 75 b0             	mov    -0x50(%ebp),%esi
+  8001a4:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  8001a7:	6b cf 64             	imul   $0x64,%edi,%ecx
+  8001aa:	b8 64 00 00 00       	mov    $0x64,%eax
+  8001af:	f7 e6                	mul    %esi
+  8001b1:	01 ca                	add    %ecx,%edx
+  8001b3:	ff 75 c4             	push   -0x3c(%ebp)
+  8001b6:	ff 75 c0             	push   -0x40(%ebp)
+  8001b9:	52                   	push   %edx
+  8001ba:	50                   	push   %eax
+  8001bb:	e8 0b 3f 00 00       	call   8040cb <__udivdi3>
+  8001c0:	83 c4 10             	add    $0x10,%esp
+	cprintf("nsutil: %s: %d network server envs used %u.%u%% of a CPU, "
+  8001c3:	50                   	push   %eax
+  8001c4:	ff 75 a8             	push   -0x58(%ebp)
+  8001c7:	ff 75 a4             	push   -0x5c(%ebp)
+  8001ca:	68 2c 43 80 00       	push   $0x80432c
+  8001cf:	e8 b0 04 00 00       	call   800684 <cprintf>
+}
+  8001d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d7:	5b                   	pop    %ebx
+  8001d8:	5e                   	pop    %esi
+  8001d9:	5f                   	pop    %edi
+  8001da:	5d                   	pop    %ebp
+  8001db:	c3                   	ret
+		if (!is_ns(&envs[i], ns) || envs[i].env_cycles < cycles0[i])
+  8001dc:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8001df:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8001e5:	8b 88 60 00 c0 ee    	mov    -0x113fffa0(%eax),%ecx
+  8001eb:	8b 98 64 00 c0 ee    	mov    -0x113fff9c(%eax),%ebx
+  8001f1:	8b 14 f5 04 70 80 00 	mov    0x807004(,%esi,8),%edx
+  8001f8:	8b 04 f5 00 70 80 00 	mov    0x807000(,%esi,8),%eax
+  8001ff:	39 c1                	cmp    %eax,%ecx
+  800201:	89 df                	mov    %ebx,%edi
+  800203:	19 d7                	sbb    %edx,%edi
+  800205:	0f 82 0c 01 00 00    	jb     800317 <report+0x27f>
+		c = envs[i].env_cycles - cycles0[i];
+  80020b:	69 7d e0 bc 00 00 00 	imul   $0xbc,-0x20(%ebp),%edi
+  800212:	8b 8f 60 00 c0 ee    	mov    -0x113fffa0(%edi),%ecx
+  800218:	8b 9f 64 00 c0 ee    	mov    -0x113fff9c(%edi),%ebx
+  80021e:	29 c1                	sub    %eax,%ecx
+  800220:	19 d3                	sbb    %edx,%ebx
+		runs = envs[i].env_runs - runs0[i];
+  800222:	8b 87 58 00 c0 ee    	mov    -0x113fffa8(%edi),%eax
+		c = envs[i].env_cycles - cycles0[i];
+  800228:	81 c7 00 00 c0 ee    	add    $0xeec00000,%edi
+		runs = envs[i].env_runs - runs0[i];
+  80022e:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  800231:	2b 04 b5 00 60 80 00 	sub    0x806000(,%esi,4),%eax
+		total += c;
+  800238:	01 4d b0             	add    %ecx,-0x50(%ebp)
+  80023b:	11 5d b4             	adc    %ebx,-0x4c(%ebp)
+		total_runs += runs;
+  80023e:	01 45 ac             	add    %eax,-0x54(%ebp)
+		nenv++;
+  800241:	83 45 a8 01          	addl   $0x1,-0x58(%ebp)
+			envs[i].env_id, (uint32_t) (c * 100 / t),
+  800245:	8b 7f 48             	mov    0x48(%edi),%edi
+  800248:	89 7d bc             	mov    %edi,-0x44(%ebp)
+		cprintf("nsutil: %s: env %08x %u.%u%%, %u wakeups/s\n", what,
+  80024b:	83 ec 08             	sub    $0x8,%esp
+			(uint32_t) (c * 1000 / t % 10), runs * 1000 / ms);
+  80024e:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+		cprintf("nsutil: %s: env %08x %u.%u%%, %u wakeups/s\n", what,
+  800254:	ba 00 00 00 00       	mov    $0x0,%edx
+  800259:	f7 75 b8             	divl   -0x48(%ebp)
+  80025c:	50                   	push   %eax
+			(uint32_t) (c * 1000 / t % 10), runs * 1000 / ms);
+  80025d:	89 ce                	mov    %ecx,%esi
+  80025f:	89 df                	mov    %ebx,%edi
+  800261:	69 cb e8 03 00 00    	imul   $0x3e8,%ebx,%ecx
+  800267:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+  80026c:	f7 e6                	mul    %esi
+  80026e:	01 ca                	add    %ecx,%edx
+  800270:	83 ec 04             	sub    $0x4,%esp
+  800273:	ff 75 c4             	push   -0x3c(%ebp)
+  800276:	ff 75 c0             	push   -0x40(%ebp)
+  800279:	52                   	push   %edx
+  80027a:	50                   	push   %eax
+  80027b:	e8 4b 3e 00 00       	call   8040cb <__udivdi3>
+  800280:	83 c4 14             	add    $0x14,%esp
+  800283:	89 c1                	mov    %eax,%ecx
+  800285:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800288:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80028b:	01 d1                	add    %edx,%ecx
+  80028d:	83 d1 00             	adc    $0x0,%ecx
+  800290:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  800295:	f7 e1                	mul    %ecx
+  800297:	89 d3                	mov    %edx,%ebx
+  800299:	c1 eb 02             	shr    $0x2,%ebx
+  80029c:	83 e2 fc             	and    $0xfffffffc,%edx
+  80029f:	01 da                	add    %ebx,%edx
+  8002a1:	29 d1                	sub    %edx,%ecx
+  8002a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8002ab:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  8002ae:	29 c8                	sub    %ecx,%eax
+  8002b0:	19 da                	sbb    %ebx,%edx
+  8002b2:	69 ca cd cc cc cc    	imul   $0xcccccccd,%edx,%ecx
+  8002b8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8002bb:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8002be:	69 55 c8 cc cc cc cc 	imul   $0xcccccccc,-0x38(%ebp),%edx
+  8002c5:	8d 1c 11             	lea    (%ecx,%edx,1),%ebx
+  8002c8:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+  8002cd:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8002d0:	f7 e1                	mul    %ecx
+  8002d2:	01 da                	add    %ebx,%edx
+  8002d4:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  8002d8:	d1 ea                	shr    %edx
+  8002da:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  8002df:	f7 e3                	mul    %ebx
+  8002e1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8002e4:	29 c1                	sub    %eax,%ecx
+		cprintf("nsutil: %s: env %08x %u.%u%%, %u wakeups/s\n", what,
+  8002e6:	51                   	push   %ecx
+			envs[i].env_id, (uint32_t) (c * 100 / t),
+  8002e7:	6b cf 64             	imul   $0x64,%edi,%ecx
+  8002ea:	b8 64 00 00 00       	mov    $0x64,%eax
+  8002ef:	f7 e6                	mul    %esi
+  8002f1:	01 ca                	add    %ecx,%edx
+  8002f3:	ff 75 c4             	push   -0x3c(%ebp)
+  8002f6:	ff 75 c0             	push   -0x40(%ebp)
+  8002f9:	52                   	push   %edx
+  8002fa:	50                   	push   %eax
+  8002fb:	e8 cb 3d 00 00       	call   8040cb <__udivdi3>
+  800300:	83 c4 10             	add    $0x10,%esp
+		cprintf("nsutil: %s: env %08x %u.%u%%, %u wakeups/s\n", what,
+  800303:	50                   	push   %eax
+  800304:	ff 75 bc             	push   -0x44(%ebp)
+  800307:	ff 75 a4             	push   -0x5c(%ebp)
+  80030a:	68 00 43 80 00       	push   $0x804300
+  80030f:	e8 70 03 00 00       	call   800684 <cprintf>
+  800314:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < NENV; i++) {
+  800317:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  80031b:	81 45 dc bc 00 00 00 	addl   $0xbc,-0x24(%ebp)
+  800322:	81 7d e0 00 04 00 00 	cmpl   $0x400,-0x20(%ebp)
+  800329:	0f 84 d9 fd ff ff    	je     800108 <report+0x70>
+		if (!is_ns(&envs[i], ns) || envs[i].env_cycles < cycles0[i])
+  80032f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800332:	ba 04 00 00 00       	mov    $0x4,%edx
+  800337:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80033a:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	for (depth = 0; depth < 4 && e->env_status != ENV_FREE; depth++) {
+  80033d:	8b 58 54             	mov    0x54(%eax),%ebx
+  800340:	85 db                	test   %ebx,%ebx
+  800342:	0f 84 b0 fd ff ff    	je     8000f8 <report+0x60>
+		if (e->env_id == ns)
+  800348:	8b 58 48             	mov    0x48(%eax),%ebx
+  80034b:	39 d9                	cmp    %ebx,%ecx
+  80034d:	0f 84 89 fe ff ff    	je     8001dc <report+0x144>
+		if (!e->env_parent_id)
+  800353:	8b 58 4c             	mov    0x4c(%eax),%ebx
+  800356:	85 db                	test   %ebx,%ebx
+  800358:	0f 84 a2 fd ff ff    	je     800100 <report+0x68>
+		e = &envs[ENVX(e->env_parent_id)];
+  80035e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800361:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800366:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80036c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+	for (depth = 0; depth < 4 && e->env_status != ENV_FREE; depth++) {
+  800371:	83 ea 01             	sub    $0x1,%edx
+  800374:	75 c7                	jne    80033d <report+0x2a5>
+  800376:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  800379:	eb 9c                	jmp    800317 <report+0x27f>
+
+0080037b <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	57                   	push   %edi
+  80037f:	56                   	push   %esi
+  800380:	53                   	push   %ebx
+  800381:	83 ec 40             	sub    $0x40,%esp
+	unsigned start, ms;
+	uint64_t t0;
+	uint32_t bytes = 0;
+	int s, c, n;
+
+	binaryname = "nsutil";
+  800384:	c7 05 00 50 80 00 c4 	movl   $0x8042c4,0x805000
+  80038b:	42 80 00 
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  80038e:	6a 06                	push   $0x6
+  800390:	6a 01                	push   $0x1
+  800392:	6a 02                	push   $0x2
+  800394:	e8 c0 22 00 00       	call   802659 <socket>
+  800399:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 c0                	test   %eax,%eax
+  8003a1:	78 70                	js     800413 <umain+0x98>
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+  8003a3:	83 ec 04             	sub    $0x4,%esp
+  8003a6:	6a 10                	push   $0x10
+  8003a8:	6a 00                	push   $0x0
+  8003aa:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8003ad:	53                   	push   %ebx
+  8003ae:	e8 43 0b 00 00       	call   800ef6 <memset>
+	addr.sin_family = AF_INET;
+  8003b3:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  8003b7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8003be:	e8 b1 3a 00 00       	call   803e74 <htonl>
+  8003c3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	addr.sin_port = htons(PORT);
+  8003c6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8003cd:	e8 88 3a 00 00       	call   803e5a <htons>
+  8003d2:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  8003d6:	83 c4 0c             	add    $0xc,%esp
+  8003d9:	6a 10                	push   $0x10
+  8003db:	53                   	push   %ebx
+  8003dc:	ff 75 c4             	push   -0x3c(%ebp)
+  8003df:	e8 d4 20 00 00       	call   8024b8 <bind>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+  8003e7:	85 c0                	test   %eax,%eax
+  8003e9:	78 34                	js     80041f <umain+0xa4>
+		die("Failed to bind the server socket");
+	if (listen(s, 1) < 0)
+  8003eb:	83 ec 08             	sub    $0x8,%esp
+  8003ee:	6a 01                	push   $0x1
+  8003f0:	ff 75 c4             	push   -0x3c(%ebp)
+  8003f3:	e8 2f 21 00 00       	call   802527 <listen>
+  8003f8:	83 c4 10             	add    $0x10,%esp
+  8003fb:	85 c0                	test   %eax,%eax
+  8003fd:	78 2c                	js     80042b <umain+0xb0>
+		die("Failed to listen on server socket");
+
+	// Idle: nothing is sent to us while we sleep.
+	sample();
+  8003ff:	e8 31 fc ff ff       	call   800035 <sample>
+
+static __inline uint64_t
+read_tsc(void)
+{
+        uint64_t tsc;
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  800404:	0f 31                	rdtsc
+  800406:	89 c6                	mov    %eax,%esi
+  800408:	89 d7                	mov    %edx,%edi
+	t0 = read_tsc();
+	start = sys_time_msec();
+  80040a:	e8 f4 0f 00 00       	call   801403 <sys_time_msec>
+  80040f:	89 c3                	mov    %eax,%ebx
+	while (sys_time_msec() - start < IDLE_MSEC)
+  800411:	eb 29                	jmp    80043c <umain+0xc1>
+		die("Failed to create socket");
+  800413:	b8 cb 42 80 00       	mov    $0x8042cb,%eax
+  800418:	e8 60 fc ff ff       	call   80007d <die>
+  80041d:	eb 84                	jmp    8003a3 <umain+0x28>
+		die("Failed to bind the server socket");
+  80041f:	b8 74 43 80 00       	mov    $0x804374,%eax
+  800424:	e8 54 fc ff ff       	call   80007d <die>
+  800429:	eb c0                	jmp    8003eb <umain+0x70>
+		die("Failed to listen on server socket");
+  80042b:	b8 98 43 80 00       	mov    $0x804398,%eax
+  800430:	e8 48 fc ff ff       	call   80007d <die>
+  800435:	eb c8                	jmp    8003ff <umain+0x84>
+		sys_yield();
+  800437:	e8 54 0d 00 00       	call   801190 <sys_yield>
+	while (sys_time_msec() - start < IDLE_MSEC)
+  80043c:	e8 c2 0f 00 00       	call   801403 <sys_time_msec>
+  800441:	29 d8                	sub    %ebx,%eax
+  800443:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+  800448:	76 ed                	jbe    800437 <umain+0xbc>
+	report("idle", read_tsc() - t0, sys_time_msec() - start);
+  80044a:	e8 b4 0f 00 00       	call   801403 <sys_time_msec>
+  80044f:	89 c1                	mov    %eax,%ecx
+  800451:	0f 31                	rdtsc
+  800453:	29 f0                	sub    %esi,%eax
+  800455:	19 fa                	sbb    %edi,%edx
+  800457:	83 ec 0c             	sub    $0xc,%esp
+  80045a:	29 d9                	sub    %ebx,%ecx
+  80045c:	51                   	push   %ecx
+  80045d:	89 d1                	mov    %edx,%ecx
+  80045f:	89 c2                	mov    %eax,%edx
+  800461:	b8 e3 42 80 00       	mov    $0x8042e3,%eax
+  800466:	e8 2d fc ff ff       	call   800098 <report>
+
+	cprintf("nsutil: listening\n");
+  80046b:	c7 04 24 e8 42 80 00 	movl   $0x8042e8,(%esp)
+  800472:	e8 0d 02 00 00       	call   800684 <cprintf>
+	len = sizeof(addr);
+  800477:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+	if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+  80047e:	83 c4 0c             	add    $0xc,%esp
+  800481:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  800484:	50                   	push   %eax
+  800485:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800488:	50                   	push   %eax
+  800489:	ff 75 c4             	push   -0x3c(%ebp)
+  80048c:	e8 e5 1f 00 00       	call   802476 <accept>
+  800491:	89 c6                	mov    %eax,%esi
+  800493:	83 c4 10             	add    $0x10,%esp
+  800496:	85 c0                	test   %eax,%eax
+  800498:	78 1b                	js     8004b5 <umain+0x13a>
+		die("Failed to accept client connection");
+	sample();
+  80049a:	e8 96 fb ff ff       	call   800035 <sample>
+  80049f:	0f 31                	rdtsc
+  8004a1:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  8004a4:	89 55 bc             	mov    %edx,-0x44(%ebp)
+	t0 = read_tsc();
+	start = sys_time_msec();
+  8004a7:	e8 57 0f 00 00       	call   801403 <sys_time_msec>
+  8004ac:	89 c7                	mov    %eax,%edi
+	uint32_t bytes = 0;
+  8004ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+	while ((n = read(c, buf, sizeof(buf))) > 0)
+  8004b3:	eb 0e                	jmp    8004c3 <umain+0x148>
+		die("Failed to accept client connection");
+  8004b5:	b8 bc 43 80 00       	mov    $0x8043bc,%eax
+  8004ba:	e8 be fb ff ff       	call   80007d <die>
+  8004bf:	eb d9                	jmp    80049a <umain+0x11f>
+		bytes += n;
+  8004c1:	01 c3                	add    %eax,%ebx
+	while ((n = read(c, buf, sizeof(buf))) > 0)
+  8004c3:	83 ec 04             	sub    $0x4,%esp
+  8004c6:	68 00 08 00 00       	push   $0x800
+  8004cb:	68 00 90 80 00       	push   $0x809000
+  8004d0:	56                   	push   %esi
+  8004d1:	e8 6f 17 00 00       	call   801c45 <read>
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	85 c0                	test   %eax,%eax
+  8004db:	7f e4                	jg     8004c1 <umain+0x146>
+	ms = sys_time_msec() - start;
+  8004dd:	e8 21 0f 00 00       	call   801403 <sys_time_msec>
+  8004e2:	29 f8                	sub    %edi,%eax
+  8004e4:	89 c7                	mov    %eax,%edi
+  8004e6:	0f 31                	rdtsc
+	report("load", read_tsc() - t0, ms);
+  8004e8:	2b 45 b8             	sub    -0x48(%ebp),%eax
+  8004eb:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+  8004ee:	83 ec 0c             	sub    $0xc,%esp
+  8004f1:	57                   	push   %edi
+  8004f2:	89 d1                	mov    %edx,%ecx
+  8004f4:	89 c2                	mov    %eax,%edx
+  8004f6:	b8 fb 42 80 00       	mov    $0x8042fb,%eax
+  8004fb:	e8 98 fb ff ff       	call   800098 <report>
+	cprintf("nsutil: load: %u bytes in %u ms, %u KB/s\n", bytes, ms,
+		bytes / (ms ? ms : 1) * 1000 / 1024);
+  800500:	85 ff                	test   %edi,%edi
+  800502:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800507:	0f 45 cf             	cmovne %edi,%ecx
+  80050a:	89 d8                	mov    %ebx,%eax
+  80050c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800511:	f7 f1                	div    %ecx
+  800513:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+	cprintf("nsutil: load: %u bytes in %u ms, %u KB/s\n", bytes, ms,
+  800519:	c1 e8 0a             	shr    $0xa,%eax
+  80051c:	50                   	push   %eax
+  80051d:	57                   	push   %edi
+  80051e:	53                   	push   %ebx
+  80051f:	68 e0 43 80 00       	push   $0x8043e0
+  800524:	e8 5b 01 00 00       	call   800684 <cprintf>
+	close(c);
+  800529:	83 c4 14             	add    $0x14,%esp
+  80052c:	56                   	push   %esi
+  80052d:	e8 d4 15 00 00       	call   801b06 <close>
+	close(s);
+  800532:	83 c4 04             	add    $0x4,%esp
+  800535:	ff 75 c4             	push   -0x3c(%ebp)
+  800538:	e8 c9 15 00 00       	call   801b06 <close>
+}
+  80053d:	83 c4 10             	add    $0x10,%esp
+  800540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800543:	5b                   	pop    %ebx
+  800544:	5e                   	pop    %esi
+  800545:	5f                   	pop    %edi
+  800546:	5d                   	pop    %ebp
+  800547:	c3                   	ret
+
+00800548 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800548:	55                   	push   %ebp
+  800549:	89 e5                	mov    %esp,%ebp
+  80054b:	56                   	push   %esi
+  80054c:	53                   	push   %ebx
+  80054d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800550:	8b 75 0c             	mov    0xc(%ebp),%esi
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800553:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800555:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80055a:	29 d0                	sub    %edx,%eax
+  80055c:	89 c2                	mov    %eax,%edx
+  80055e:	c1 ea 0f             	shr    $0xf,%edx
+  800561:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056b:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80056e:	c7 04 85 60 9b 80 00 	movl   $0x0,0x809b60(,%eax,4)
+  800575:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800579:	e8 f3 0b 00 00       	call   801171 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80057e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800583:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800589:	89 e1                	mov    %esp,%ecx
+  80058b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800590:	29 ca                	sub    %ecx,%edx
+  800592:	89 d1                	mov    %edx,%ecx
+  800594:	c1 e9 0f             	shr    $0xf,%ecx
+  800597:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80059d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a2:	0f 42 d1             	cmovb  %ecx,%edx
+  8005a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005aa:	89 04 95 60 9b 80 00 	mov    %eax,0x809b60(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8005b1:	85 db                	test   %ebx,%ebx
+  8005b3:	7e 07                	jle    8005bc <libmain+0x74>
+		binaryname = argv[0];
+  8005b5:	8b 06                	mov    (%esi),%eax
+  8005b7:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8005bc:	83 ec 08             	sub    $0x8,%esp
+  8005bf:	56                   	push   %esi
+  8005c0:	53                   	push   %ebx
+  8005c1:	e8 b5 fd ff ff       	call   80037b <umain>
+
+	// exit gracefully
+	exit();
+  8005c6:	e8 0a 00 00 00       	call   8005d5 <exit>
+}
+  8005cb:	83 c4 10             	add    $0x10,%esp
+  8005ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005d1:	5b                   	pop    %ebx
+  8005d2:	5e                   	pop    %esi
+  8005d3:	5d                   	pop    %ebp
+  8005d4:	c3                   	ret
+
+008005d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005d5:	55                   	push   %ebp
+  8005d6:	89 e5                	mov    %esp,%ebp
+  8005d8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8005db:	e8 53 15 00 00       	call   801b33 <close_all>
+	sys_env_destroy(0);
+  8005e0:	83 ec 0c             	sub    $0xc,%esp
+  8005e3:	6a 00                	push   $0x0
+  8005e5:	e8 46 0b 00 00       	call   801130 <sys_env_destroy>
+}
+  8005ea:	83 c4 10             	add    $0x10,%esp
+  8005ed:	c9                   	leave
+  8005ee:	c3                   	ret
+
+008005ef <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8005ef:	55                   	push   %ebp
+  8005f0:	89 e5                	mov    %esp,%ebp
+  8005f2:	53                   	push   %ebx
+  8005f3:	83 ec 04             	sub    $0x4,%esp
+  8005f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8005f9:	8b 13                	mov    (%ebx),%edx
+  8005fb:	8d 42 01             	lea    0x1(%edx),%eax
+  8005fe:	89 03                	mov    %eax,(%ebx)
+  800600:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800603:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800607:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80060c:	74 09                	je     800617 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80060e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800612:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800615:	c9                   	leave
+  800616:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800617:	83 ec 08             	sub    $0x8,%esp
+  80061a:	68 ff 00 00 00       	push   $0xff
+  80061f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800622:	50                   	push   %eax
+  800623:	e8 cb 0a 00 00       	call   8010f3 <sys_cputs>
+		b->idx = 0;
+  800628:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80062e:	83 c4 10             	add    $0x10,%esp
+  800631:	eb db                	jmp    80060e <putch+0x1f>
+
+00800633 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800633:	55                   	push   %ebp
+  800634:	89 e5                	mov    %esp,%ebp
+  800636:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80063c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800643:	00 00 00 
+	b.cnt = 0;
+  800646:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80064d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800650:	ff 75 0c             	push   0xc(%ebp)
+  800653:	ff 75 08             	push   0x8(%ebp)
+  800656:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80065c:	50                   	push   %eax
+  80065d:	68 ef 05 80 00       	push   $0x8005ef
+  800662:	e8 1c 01 00 00       	call   800783 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800667:	83 c4 08             	add    $0x8,%esp
+  80066a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800670:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800676:	50                   	push   %eax
+  800677:	e8 77 0a 00 00       	call   8010f3 <sys_cputs>
+
+	return b.cnt;
+}
+  80067c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800682:	c9                   	leave
+  800683:	c3                   	ret
+
+00800684 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800684:	55                   	push   %ebp
+  800685:	89 e5                	mov    %esp,%ebp
+  800687:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80068a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80068d:	50                   	push   %eax
+  80068e:	ff 75 08             	push   0x8(%ebp)
+  800691:	e8 9d ff ff ff       	call   800633 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800696:	c9                   	leave
+  800697:	c3                   	ret
+
+00800698 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800698:	55                   	push   %ebp
+  800699:	89 e5                	mov    %esp,%ebp
+  80069b:	57                   	push   %edi
+  80069c:	56                   	push   %esi
+  80069d:	53                   	push   %ebx
+  80069e:	83 ec 1c             	sub    $0x1c,%esp
+  8006a1:	89 c3                	mov    %eax,%ebx
+  8006a3:	89 d6                	mov    %edx,%esi
+  8006a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ab:	89 d1                	mov    %edx,%ecx
+  8006ad:	89 c2                	mov    %eax,%edx
+  8006af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b5:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8006b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006bb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8006c2:	39 c2                	cmp    %eax,%edx
+  8006c4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8006c7:	73 4b                	jae    800714 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8006cf:	85 ff                	test   %edi,%edi
+  8006d1:	7e 11                	jle    8006e4 <printnum+0x4c>
+			putch(padc, putdat);
+  8006d3:	83 ec 08             	sub    $0x8,%esp
+  8006d6:	56                   	push   %esi
+  8006d7:	ff 75 18             	push   0x18(%ebp)
+  8006da:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8006dc:	83 c4 10             	add    $0x10,%esp
+  8006df:	83 ef 01             	sub    $0x1,%edi
+  8006e2:	75 ef                	jne    8006d3 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	56                   	push   %esi
+  8006e8:	83 ec 04             	sub    $0x4,%esp
+  8006eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8006ee:	ff 75 e0             	push   -0x20(%ebp)
+  8006f1:	ff 75 dc             	push   -0x24(%ebp)
+  8006f4:	ff 75 d8             	push   -0x28(%ebp)
+  8006f7:	e8 95 3a 00 00       	call   804191 <__umoddi3>
+  8006fc:	83 c4 14             	add    $0x14,%esp
+  8006ff:	0f be 80 14 44 80 00 	movsbl 0x804414(%eax),%eax
+  800706:	50                   	push   %eax
+  800707:	ff d3                	call   *%ebx
+}
+  800709:	83 c4 10             	add    $0x10,%esp
+  80070c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070f:	5b                   	pop    %ebx
+  800710:	5e                   	pop    %esi
+  800711:	5f                   	pop    %edi
+  800712:	5d                   	pop    %ebp
+  800713:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800714:	83 ec 0c             	sub    $0xc,%esp
+  800717:	ff 75 18             	push   0x18(%ebp)
+  80071a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80071d:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800720:	52                   	push   %edx
+  800721:	50                   	push   %eax
+  800722:	83 ec 08             	sub    $0x8,%esp
+  800725:	ff 75 e4             	push   -0x1c(%ebp)
+  800728:	ff 75 e0             	push   -0x20(%ebp)
+  80072b:	ff 75 dc             	push   -0x24(%ebp)
+  80072e:	ff 75 d8             	push   -0x28(%ebp)
+  800731:	e8 95 39 00 00       	call   8040cb <__udivdi3>
+  800736:	83 c4 18             	add    $0x18,%esp
+  800739:	52                   	push   %edx
+  80073a:	50                   	push   %eax
+  80073b:	89 f2                	mov    %esi,%edx
+  80073d:	89 d8                	mov    %ebx,%eax
+  80073f:	e8 54 ff ff ff       	call   800698 <printnum>
+  800744:	83 c4 20             	add    $0x20,%esp
+  800747:	eb 9b                	jmp    8006e4 <printnum+0x4c>
+
+00800749 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800749:	55                   	push   %ebp
+  80074a:	89 e5                	mov    %esp,%ebp
+  80074c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80074f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	3b 50 04             	cmp    0x4(%eax),%edx
+  800758:	73 0a                	jae    800764 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80075a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80075d:	89 08                	mov    %ecx,(%eax)
+  80075f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800762:	88 02                	mov    %al,(%edx)
+}
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+
+00800766 <printfmt>:
+{
+  800766:	55                   	push   %ebp
+  800767:	89 e5                	mov    %esp,%ebp
+  800769:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80076c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80076f:	50                   	push   %eax
+  800770:	ff 75 10             	push   0x10(%ebp)
+  800773:	ff 75 0c             	push   0xc(%ebp)
+  800776:	ff 75 08             	push   0x8(%ebp)
+  800779:	e8 05 00 00 00       	call   800783 <vprintfmt>
+}
+  80077e:	83 c4 10             	add    $0x10,%esp
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+
+00800783 <vprintfmt>:
+{
+  800783:	55                   	push   %ebp
+  800784:	89 e5                	mov    %esp,%ebp
+  800786:	57                   	push   %edi
+  800787:	56                   	push   %esi
+  800788:	53                   	push   %ebx
+  800789:	83 ec 2c             	sub    $0x2c,%esp
+  80078c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80078f:	89 df                	mov    %ebx,%edi
+  800791:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800794:	8b 45 10             	mov    0x10(%ebp),%eax
+  800797:	8d 70 01             	lea    0x1(%eax),%esi
+  80079a:	0f b6 00             	movzbl (%eax),%eax
+  80079d:	83 f8 25             	cmp    $0x25,%eax
+  8007a0:	74 1e                	je     8007c0 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8007a2:	85 c0                	test   %eax,%eax
+  8007a4:	0f 84 15 05 00 00    	je     800cbf <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8007aa:	83 ec 08             	sub    $0x8,%esp
+  8007ad:	53                   	push   %ebx
+  8007ae:	50                   	push   %eax
+  8007af:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007b1:	83 c6 01             	add    $0x1,%esi
+  8007b4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	83 f8 25             	cmp    $0x25,%eax
+  8007be:	75 e2                	jne    8007a2 <vprintfmt+0x1f>
+		padc = ' ';
+  8007c0:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8007c4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8007cb:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8007d2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8007d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007e1:	8d 56 01             	lea    0x1(%esi),%edx
+  8007e4:	0f b6 0e             	movzbl (%esi),%ecx
+  8007e7:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8007ea:	3c 55                	cmp    $0x55,%al
+  8007ec:	0f 87 3b 04 00 00    	ja     800c2d <vprintfmt+0x4aa>
+  8007f2:	0f b6 c0             	movzbl %al,%eax
+  8007f5:	ff 24 85 80 45 80 00 	jmp    *0x804580(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007fc:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007ff:	eb 93                	jmp    800794 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800801:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800803:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800807:	eb d8                	jmp    8007e1 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800809:	89 d6                	mov    %edx,%esi
+  80080b:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80080f:	eb d0                	jmp    8007e1 <vprintfmt+0x5e>
+  800811:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800814:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800817:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80081a:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80081e:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800821:	83 f9 09             	cmp    $0x9,%ecx
+  800824:	77 6f                	ja     800895 <vprintfmt+0x112>
+  800826:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800829:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80082c:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80082f:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800833:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800836:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800839:	83 fe 09             	cmp    $0x9,%esi
+  80083c:	76 eb                	jbe    800829 <vprintfmt+0xa6>
+  80083e:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800841:	89 d6                	mov    %edx,%esi
+  800843:	eb 13                	jmp    800858 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800845:	8b 45 14             	mov    0x14(%ebp),%eax
+  800848:	8b 00                	mov    (%eax),%eax
+  80084a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80084d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800850:	8d 40 04             	lea    0x4(%eax),%eax
+  800853:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800856:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800858:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80085c:	79 83                	jns    8007e1 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80085e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800861:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800864:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80086b:	e9 71 ff ff ff       	jmp    8007e1 <vprintfmt+0x5e>
+			if (width < 0)
+  800870:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800873:	85 c9                	test   %ecx,%ecx
+  800875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087a:	0f 49 c1             	cmovns %ecx,%eax
+  80087d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800880:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800882:	e9 5a ff ff ff       	jmp    8007e1 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800887:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800889:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800890:	e9 4c ff ff ff       	jmp    8007e1 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800895:	89 d6                	mov    %edx,%esi
+  800897:	eb bf                	jmp    800858 <vprintfmt+0xd5>
+			lflag++;
+  800899:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80089d:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80089f:	e9 3d ff ff ff       	jmp    8007e1 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8008a4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008aa:	8d 70 04             	lea    0x4(%eax),%esi
+  8008ad:	83 ec 08             	sub    $0x8,%esp
+  8008b0:	53                   	push   %ebx
+  8008b1:	ff 30                	push   (%eax)
+  8008b3:	ff d7                	call   *%edi
+			break;
+  8008b5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8008b8:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8008bb:	e9 d4 fe ff ff       	jmp    800794 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8008c0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c6:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8008c9:	8b 10                	mov    (%eax),%edx
+  8008cb:	89 d0                	mov    %edx,%eax
+  8008cd:	f7 d8                	neg    %eax
+  8008cf:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008d2:	83 f8 12             	cmp    $0x12,%eax
+  8008d5:	7f 23                	jg     8008fa <vprintfmt+0x177>
+  8008d7:	8b 14 85 e0 46 80 00 	mov    0x8046e0(,%eax,4),%edx
+  8008de:	85 d2                	test   %edx,%edx
+  8008e0:	74 18                	je     8008fa <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8008e2:	52                   	push   %edx
+  8008e3:	68 73 48 80 00       	push   $0x804873
+  8008e8:	53                   	push   %ebx
+  8008e9:	57                   	push   %edi
+  8008ea:	e8 77 fe ff ff       	call   800766 <printfmt>
+  8008ef:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008f2:	89 75 14             	mov    %esi,0x14(%ebp)
+  8008f5:	e9 9a fe ff ff       	jmp    800794 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8008fa:	50                   	push   %eax
+  8008fb:	68 2c 44 80 00       	push   $0x80442c
+  800900:	53                   	push   %ebx
+  800901:	57                   	push   %edi
+  800902:	e8 5f fe ff ff       	call   800766 <printfmt>
+  800907:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80090a:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80090d:	e9 82 fe ff ff       	jmp    800794 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800912:	89 55 10             	mov    %edx,0x10(%ebp)
+  800915:	8b 45 14             	mov    0x14(%ebp),%eax
+  800918:	83 c0 04             	add    $0x4,%eax
+  80091b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80091e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800921:	8b 00                	mov    (%eax),%eax
+  800923:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800926:	85 c0                	test   %eax,%eax
+  800928:	0f 84 61 03 00 00    	je     800c8f <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80092e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800932:	7e 06                	jle    80093a <vprintfmt+0x1b7>
+  800934:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800938:	75 29                	jne    800963 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80093a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80093d:	8d 70 01             	lea    0x1(%eax),%esi
+  800940:	0f b6 00             	movzbl (%eax),%eax
+  800943:	0f be d0             	movsbl %al,%edx
+  800946:	85 d2                	test   %edx,%edx
+  800948:	0f 84 bb 00 00 00    	je     800a09 <vprintfmt+0x286>
+  80094e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800951:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800954:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800957:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80095a:	eb 7a                	jmp    8009d6 <vprintfmt+0x253>
+				p = "(null)";
+  80095c:	c7 45 d0 25 44 80 00 	movl   $0x804425,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800963:	83 ec 08             	sub    $0x8,%esp
+  800966:	ff 75 d4             	push   -0x2c(%ebp)
+  800969:	ff 75 d0             	push   -0x30(%ebp)
+  80096c:	e8 e0 03 00 00       	call   800d51 <strnlen>
+  800971:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800974:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800977:	83 c4 10             	add    $0x10,%esp
+  80097a:	85 d2                	test   %edx,%edx
+  80097c:	0f 8e d6 02 00 00    	jle    800c58 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800982:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800986:	83 ec 08             	sub    $0x8,%esp
+  800989:	53                   	push   %ebx
+  80098a:	56                   	push   %esi
+  80098b:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80098d:	83 c4 10             	add    $0x10,%esp
+  800990:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800994:	75 f0                	jne    800986 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800996:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800999:	8d 70 01             	lea    0x1(%eax),%esi
+  80099c:	0f b6 00             	movzbl (%eax),%eax
+  80099f:	0f be d0             	movsbl %al,%edx
+  8009a2:	85 d2                	test   %edx,%edx
+  8009a4:	0f 84 da 02 00 00    	je     800c84 <vprintfmt+0x501>
+  8009aa:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009ad:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009b0:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009b3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009b6:	eb 1e                	jmp    8009d6 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8009b8:	83 ec 08             	sub    $0x8,%esp
+  8009bb:	ff 75 0c             	push   0xc(%ebp)
+  8009be:	52                   	push   %edx
+  8009bf:	ff 55 08             	call   *0x8(%ebp)
+  8009c2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009c5:	83 eb 01             	sub    $0x1,%ebx
+  8009c8:	83 c6 01             	add    $0x1,%esi
+  8009cb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8009cf:	0f be d0             	movsbl %al,%edx
+  8009d2:	85 d2                	test   %edx,%edx
+  8009d4:	74 2a                	je     800a00 <vprintfmt+0x27d>
+  8009d6:	85 ff                	test   %edi,%edi
+  8009d8:	78 05                	js     8009df <vprintfmt+0x25c>
+  8009da:	83 ef 01             	sub    $0x1,%edi
+  8009dd:	78 59                	js     800a38 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009df:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009e3:	74 d3                	je     8009b8 <vprintfmt+0x235>
+  8009e5:	0f be c0             	movsbl %al,%eax
+  8009e8:	83 e8 20             	sub    $0x20,%eax
+  8009eb:	83 f8 5e             	cmp    $0x5e,%eax
+  8009ee:	76 c8                	jbe    8009b8 <vprintfmt+0x235>
+					putch('?', putdat);
+  8009f0:	83 ec 08             	sub    $0x8,%esp
+  8009f3:	ff 75 0c             	push   0xc(%ebp)
+  8009f6:	6a 3f                	push   $0x3f
+  8009f8:	ff 55 08             	call   *0x8(%ebp)
+  8009fb:	83 c4 10             	add    $0x10,%esp
+  8009fe:	eb c5                	jmp    8009c5 <vprintfmt+0x242>
+  800a00:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800a03:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800a09:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800a0c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a10:	7e 1b                	jle    800a2d <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800a12:	83 ec 08             	sub    $0x8,%esp
+  800a15:	53                   	push   %ebx
+  800a16:	6a 20                	push   $0x20
+  800a18:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800a1a:	83 c4 10             	add    $0x10,%esp
+  800a1d:	83 ee 01             	sub    $0x1,%esi
+  800a20:	75 f0                	jne    800a12 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a22:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a25:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a28:	e9 67 fd ff ff       	jmp    800794 <vprintfmt+0x11>
+  800a2d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a30:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a33:	e9 5c fd ff ff       	jmp    800794 <vprintfmt+0x11>
+  800a38:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800a3b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a3e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a41:	eb c6                	jmp    800a09 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800a43:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a46:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a49:	83 f9 01             	cmp    $0x1,%ecx
+  800a4c:	7f 1f                	jg     800a6d <vprintfmt+0x2ea>
+	else if (lflag)
+  800a4e:	85 c9                	test   %ecx,%ecx
+  800a50:	74 67                	je     800ab9 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800a52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a55:	8b 30                	mov    (%eax),%esi
+  800a57:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a5a:	89 f0                	mov    %esi,%eax
+  800a5c:	c1 f8 1f             	sar    $0x1f,%eax
+  800a5f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a62:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a65:	8d 40 04             	lea    0x4(%eax),%eax
+  800a68:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a6b:	eb 17                	jmp    800a84 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800a6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a70:	8b 50 04             	mov    0x4(%eax),%edx
+  800a73:	8b 00                	mov    (%eax),%eax
+  800a75:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a78:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a7b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7e:	8d 40 08             	lea    0x8(%eax),%eax
+  800a81:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a84:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a87:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800a8a:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800a8f:	85 c9                	test   %ecx,%ecx
+  800a91:	0f 89 12 01 00 00    	jns    800ba9 <vprintfmt+0x426>
+				putch('-', putdat);
+  800a97:	83 ec 08             	sub    $0x8,%esp
+  800a9a:	53                   	push   %ebx
+  800a9b:	6a 2d                	push   $0x2d
+  800a9d:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a9f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800aa2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800aa5:	f7 da                	neg    %edx
+  800aa7:	83 d1 00             	adc    $0x0,%ecx
+  800aaa:	f7 d9                	neg    %ecx
+  800aac:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800aaf:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ab4:	e9 f0 00 00 00       	jmp    800ba9 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800ab9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abc:	8b 30                	mov    (%eax),%esi
+  800abe:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800ac1:	89 f0                	mov    %esi,%eax
+  800ac3:	c1 f8 1f             	sar    $0x1f,%eax
+  800ac6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800ac9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800acc:	8d 40 04             	lea    0x4(%eax),%eax
+  800acf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad2:	eb b0                	jmp    800a84 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800ad4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ad7:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ada:	83 f9 01             	cmp    $0x1,%ecx
+  800add:	7f 1e                	jg     800afd <vprintfmt+0x37a>
+	else if (lflag)
+  800adf:	85 c9                	test   %ecx,%ecx
+  800ae1:	74 32                	je     800b15 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800ae3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae6:	8b 10                	mov    (%eax),%edx
+  800ae8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aed:	8d 40 04             	lea    0x4(%eax),%eax
+  800af0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800af3:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800af8:	e9 ac 00 00 00       	jmp    800ba9 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800afd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b00:	8b 10                	mov    (%eax),%edx
+  800b02:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b05:	8d 40 08             	lea    0x8(%eax),%eax
+  800b08:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b0b:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800b10:	e9 94 00 00 00       	jmp    800ba9 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b18:	8b 10                	mov    (%eax),%edx
+  800b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1f:	8d 40 04             	lea    0x4(%eax),%eax
+  800b22:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b25:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800b2a:	eb 7d                	jmp    800ba9 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800b2c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b2f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b32:	83 f9 01             	cmp    $0x1,%ecx
+  800b35:	7f 1b                	jg     800b52 <vprintfmt+0x3cf>
+	else if (lflag)
+  800b37:	85 c9                	test   %ecx,%ecx
+  800b39:	74 2c                	je     800b67 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800b3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3e:	8b 10                	mov    (%eax),%edx
+  800b40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b45:	8d 40 04             	lea    0x4(%eax),%eax
+  800b48:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b4b:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800b50:	eb 57                	jmp    800ba9 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b55:	8b 10                	mov    (%eax),%edx
+  800b57:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b5a:	8d 40 08             	lea    0x8(%eax),%eax
+  800b5d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b60:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800b65:	eb 42                	jmp    800ba9 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6a:	8b 10                	mov    (%eax),%edx
+  800b6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b71:	8d 40 04             	lea    0x4(%eax),%eax
+  800b74:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b77:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800b7c:	eb 2b                	jmp    800ba9 <vprintfmt+0x426>
+			putch('0', putdat);
+  800b7e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b81:	83 ec 08             	sub    $0x8,%esp
+  800b84:	53                   	push   %ebx
+  800b85:	6a 30                	push   $0x30
+  800b87:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800b89:	83 c4 08             	add    $0x8,%esp
+  800b8c:	53                   	push   %ebx
+  800b8d:	6a 78                	push   $0x78
+  800b8f:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b91:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b94:	8b 10                	mov    (%eax),%edx
+  800b96:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b9b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b9e:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ba4:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800ba9:	83 ec 0c             	sub    $0xc,%esp
+  800bac:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800bb0:	50                   	push   %eax
+  800bb1:	ff 75 e4             	push   -0x1c(%ebp)
+  800bb4:	56                   	push   %esi
+  800bb5:	51                   	push   %ecx
+  800bb6:	52                   	push   %edx
+  800bb7:	89 da                	mov    %ebx,%edx
+  800bb9:	89 f8                	mov    %edi,%eax
+  800bbb:	e8 d8 fa ff ff       	call   800698 <printnum>
+			break;
+  800bc0:	83 c4 20             	add    $0x20,%esp
+  800bc3:	e9 cc fb ff ff       	jmp    800794 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800bc8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800bcb:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bce:	83 f9 01             	cmp    $0x1,%ecx
+  800bd1:	7f 1b                	jg     800bee <vprintfmt+0x46b>
+	else if (lflag)
+  800bd3:	85 c9                	test   %ecx,%ecx
+  800bd5:	74 2c                	je     800c03 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800bd7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bda:	8b 10                	mov    (%eax),%edx
+  800bdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be1:	8d 40 04             	lea    0x4(%eax),%eax
+  800be4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800be7:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800bec:	eb bb                	jmp    800ba9 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800bee:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf1:	8b 10                	mov    (%eax),%edx
+  800bf3:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bf6:	8d 40 08             	lea    0x8(%eax),%eax
+  800bf9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bfc:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800c01:	eb a6                	jmp    800ba9 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800c03:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c06:	8b 10                	mov    (%eax),%edx
+  800c08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0d:	8d 40 04             	lea    0x4(%eax),%eax
+  800c10:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c13:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800c18:	eb 8f                	jmp    800ba9 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800c1a:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c1d:	83 ec 08             	sub    $0x8,%esp
+  800c20:	53                   	push   %ebx
+  800c21:	6a 25                	push   $0x25
+  800c23:	ff d7                	call   *%edi
+			break;
+  800c25:	83 c4 10             	add    $0x10,%esp
+  800c28:	e9 67 fb ff ff       	jmp    800794 <vprintfmt+0x11>
+			putch('%', putdat);
+  800c2d:	83 ec 08             	sub    $0x8,%esp
+  800c30:	53                   	push   %ebx
+  800c31:	6a 25                	push   $0x25
+  800c33:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c35:	83 c4 10             	add    $0x10,%esp
+  800c38:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800c3c:	0f 84 ba fb ff ff    	je     8007fc <vprintfmt+0x79>
+  800c42:	89 75 10             	mov    %esi,0x10(%ebp)
+  800c45:	89 f0                	mov    %esi,%eax
+  800c47:	83 e8 01             	sub    $0x1,%eax
+  800c4a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c4e:	75 f7                	jne    800c47 <vprintfmt+0x4c4>
+  800c50:	89 45 10             	mov    %eax,0x10(%ebp)
+  800c53:	e9 3c fb ff ff       	jmp    800794 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c58:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800c5b:	8d 70 01             	lea    0x1(%eax),%esi
+  800c5e:	0f b6 00             	movzbl (%eax),%eax
+  800c61:	0f be d0             	movsbl %al,%edx
+  800c64:	85 d2                	test   %edx,%edx
+  800c66:	74 11                	je     800c79 <vprintfmt+0x4f6>
+  800c68:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c6b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c6e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c71:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c74:	e9 5d fd ff ff       	jmp    8009d6 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c79:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c7c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c7f:	e9 10 fb ff ff       	jmp    800794 <vprintfmt+0x11>
+  800c84:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c87:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c8a:	e9 05 fb ff ff       	jmp    800794 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800c8f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c93:	7e 0a                	jle    800c9f <vprintfmt+0x51c>
+  800c95:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800c99:	0f 85 bd fc ff ff    	jne    80095c <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c9f:	ba 28 00 00 00       	mov    $0x28,%edx
+  800ca4:	b8 28 00 00 00       	mov    $0x28,%eax
+  800ca9:	be 26 44 80 00       	mov    $0x804426,%esi
+  800cae:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800cb1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800cb4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800cb7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cba:	e9 17 fd ff ff       	jmp    8009d6 <vprintfmt+0x253>
+}
+  800cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc2:	5b                   	pop    %ebx
+  800cc3:	5e                   	pop    %esi
+  800cc4:	5f                   	pop    %edi
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	c3                   	ret
+
+00800cc7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800cc7:	55                   	push   %ebp
+  800cc8:	89 e5                	mov    %esp,%ebp
+  800cca:	83 ec 18             	sub    $0x18,%esp
+  800ccd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800cd3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800cd6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800cda:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800cdd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800ce4:	85 c0                	test   %eax,%eax
+  800ce6:	74 26                	je     800d0e <vsnprintf+0x47>
+  800ce8:	85 d2                	test   %edx,%edx
+  800cea:	7e 22                	jle    800d0e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800cec:	ff 75 14             	push   0x14(%ebp)
+  800cef:	ff 75 10             	push   0x10(%ebp)
+  800cf2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800cf5:	50                   	push   %eax
+  800cf6:	68 49 07 80 00       	push   $0x800749
+  800cfb:	e8 83 fa ff ff       	call   800783 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d00:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d03:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d09:	83 c4 10             	add    $0x10,%esp
+}
+  800d0c:	c9                   	leave
+  800d0d:	c3                   	ret
+		return -E_INVAL;
+  800d0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d13:	eb f7                	jmp    800d0c <vsnprintf+0x45>
+
+00800d15 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d1b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d1e:	50                   	push   %eax
+  800d1f:	ff 75 10             	push   0x10(%ebp)
+  800d22:	ff 75 0c             	push   0xc(%ebp)
+  800d25:	ff 75 08             	push   0x8(%ebp)
+  800d28:	e8 9a ff ff ff       	call   800cc7 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d2d:	c9                   	leave
+  800d2e:	c3                   	ret
+
+00800d2f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d35:	80 3a 00             	cmpb   $0x0,(%edx)
+  800d38:	74 10                	je     800d4a <strlen+0x1b>
+  800d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800d3f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d42:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d46:	75 f7                	jne    800d3f <strlen+0x10>
+	return n;
+}
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800d4f:	eb f7                	jmp    800d48 <strlen+0x19>
+
+00800d51 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d57:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d5a:	85 d2                	test   %edx,%edx
+  800d5c:	74 16                	je     800d74 <strnlen+0x23>
+  800d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d63:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d67:	74 09                	je     800d72 <strnlen+0x21>
+		n++;
+  800d69:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d6c:	39 d0                	cmp    %edx,%eax
+  800d6e:	75 f3                	jne    800d63 <strnlen+0x12>
+		n++;
+  800d70:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d79:	eb f7                	jmp    800d72 <strnlen+0x21>
+
+00800d7b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	53                   	push   %ebx
+  800d7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d82:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d8e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d91:	83 c0 01             	add    $0x1,%eax
+  800d94:	84 d2                	test   %dl,%dl
+  800d96:	75 f2                	jne    800d8a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d98:	89 c8                	mov    %ecx,%eax
+  800d9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d9d:	c9                   	leave
+  800d9e:	c3                   	ret
+
+00800d9f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	53                   	push   %ebx
+  800da3:	83 ec 10             	sub    $0x10,%esp
+  800da6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800da9:	53                   	push   %ebx
+  800daa:	e8 80 ff ff ff       	call   800d2f <strlen>
+  800daf:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800db2:	ff 75 0c             	push   0xc(%ebp)
+  800db5:	01 d8                	add    %ebx,%eax
+  800db7:	50                   	push   %eax
+  800db8:	e8 be ff ff ff       	call   800d7b <strcpy>
+	return dst;
+}
+  800dbd:	89 d8                	mov    %ebx,%eax
+  800dbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dc2:	c9                   	leave
+  800dc3:	c3                   	ret
+
+00800dc4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	56                   	push   %esi
+  800dc8:	53                   	push   %ebx
+  800dc9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dcc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dcf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800dd2:	85 db                	test   %ebx,%ebx
+  800dd4:	74 17                	je     800ded <strncpy+0x29>
+  800dd6:	01 f3                	add    %esi,%ebx
+  800dd8:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800dda:	83 c0 01             	add    $0x1,%eax
+  800ddd:	0f b6 0a             	movzbl (%edx),%ecx
+  800de0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800de3:	80 f9 01             	cmp    $0x1,%cl
+  800de6:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800de9:	39 c3                	cmp    %eax,%ebx
+  800deb:	75 ed                	jne    800dda <strncpy+0x16>
+	}
+	return ret;
+}
+  800ded:	89 f0                	mov    %esi,%eax
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+
+00800df3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800df3:	55                   	push   %ebp
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dfb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e01:	89 f0                	mov    %esi,%eax
+  800e03:	85 db                	test   %ebx,%ebx
+  800e05:	74 1e                	je     800e25 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800e07:	83 eb 01             	sub    $0x1,%ebx
+  800e0a:	74 16                	je     800e22 <strlcpy+0x2f>
+  800e0c:	01 f3                	add    %esi,%ebx
+  800e0e:	0f b6 0a             	movzbl (%edx),%ecx
+  800e11:	84 c9                	test   %cl,%cl
+  800e13:	74 0d                	je     800e22 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800e15:	83 c2 01             	add    $0x1,%edx
+  800e18:	83 c0 01             	add    $0x1,%eax
+  800e1b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800e1e:	39 d8                	cmp    %ebx,%eax
+  800e20:	75 ec                	jne    800e0e <strlcpy+0x1b>
+		*dst = '\0';
+  800e22:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e25:	29 f0                	sub    %esi,%eax
+}
+  800e27:	5b                   	pop    %ebx
+  800e28:	5e                   	pop    %esi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+
+00800e2b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e31:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e34:	0f b6 01             	movzbl (%ecx),%eax
+  800e37:	84 c0                	test   %al,%al
+  800e39:	74 11                	je     800e4c <strcmp+0x21>
+  800e3b:	38 02                	cmp    %al,(%edx)
+  800e3d:	75 0d                	jne    800e4c <strcmp+0x21>
+		p++, q++;
+  800e3f:	83 c1 01             	add    $0x1,%ecx
+  800e42:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e45:	0f b6 01             	movzbl (%ecx),%eax
+  800e48:	84 c0                	test   %al,%al
+  800e4a:	75 ef                	jne    800e3b <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e4c:	0f b6 c0             	movzbl %al,%eax
+  800e4f:	0f b6 12             	movzbl (%edx),%edx
+  800e52:	29 d0                	sub    %edx,%eax
+}
+  800e54:	5d                   	pop    %ebp
+  800e55:	c3                   	ret
+
+00800e56 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	53                   	push   %ebx
+  800e5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e60:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800e63:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800e68:	85 d2                	test   %edx,%edx
+  800e6a:	74 2e                	je     800e9a <strncmp+0x44>
+  800e6c:	0f b6 01             	movzbl (%ecx),%eax
+  800e6f:	84 c0                	test   %al,%al
+  800e71:	74 16                	je     800e89 <strncmp+0x33>
+  800e73:	3a 03                	cmp    (%ebx),%al
+  800e75:	75 12                	jne    800e89 <strncmp+0x33>
+		n--, p++, q++;
+  800e77:	83 c1 01             	add    $0x1,%ecx
+  800e7a:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800e7d:	83 ea 01             	sub    $0x1,%edx
+  800e80:	75 ea                	jne    800e6c <strncmp+0x16>
+		return 0;
+  800e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e87:	eb 11                	jmp    800e9a <strncmp+0x44>
+  800e89:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800e8e:	85 d2                	test   %edx,%edx
+  800e90:	74 08                	je     800e9a <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e92:	0f b6 01             	movzbl (%ecx),%eax
+  800e95:	0f b6 13             	movzbl (%ebx),%edx
+  800e98:	29 d0                	sub    %edx,%eax
+}
+  800e9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e9d:	c9                   	leave
+  800e9e:	c3                   	ret
+
+00800e9f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ea9:	0f b6 10             	movzbl (%eax),%edx
+  800eac:	84 d2                	test   %dl,%dl
+  800eae:	74 15                	je     800ec5 <strchr+0x26>
+		if (*s == c)
+  800eb0:	38 d1                	cmp    %dl,%cl
+  800eb2:	74 0f                	je     800ec3 <strchr+0x24>
+	for (; *s; s++)
+  800eb4:	83 c0 01             	add    $0x1,%eax
+  800eb7:	0f b6 10             	movzbl (%eax),%edx
+  800eba:	84 d2                	test   %dl,%dl
+  800ebc:	75 f2                	jne    800eb0 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+	return 0;
+  800ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eca:	eb f7                	jmp    800ec3 <strchr+0x24>
+
+00800ecc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	53                   	push   %ebx
+  800ed0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800ed6:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800ed9:	38 d3                	cmp    %dl,%bl
+  800edb:	74 14                	je     800ef1 <strfind+0x25>
+  800edd:	89 d1                	mov    %edx,%ecx
+  800edf:	84 db                	test   %bl,%bl
+  800ee1:	74 0e                	je     800ef1 <strfind+0x25>
+	for (; *s; s++)
+  800ee3:	83 c0 01             	add    $0x1,%eax
+  800ee6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ee9:	38 ca                	cmp    %cl,%dl
+  800eeb:	74 04                	je     800ef1 <strfind+0x25>
+  800eed:	84 d2                	test   %dl,%dl
+  800eef:	75 f2                	jne    800ee3 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800ef1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ef4:	c9                   	leave
+  800ef5:	c3                   	ret
+
+00800ef6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	57                   	push   %edi
+  800efa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800efd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f00:	85 c9                	test   %ecx,%ecx
+  800f02:	74 20                	je     800f24 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f04:	89 f8                	mov    %edi,%eax
+  800f06:	09 c8                	or     %ecx,%eax
+  800f08:	a8 03                	test   $0x3,%al
+  800f0a:	75 12                	jne    800f1e <memset+0x28>
+		c &= 0xFF;
+  800f0c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f10:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f16:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f19:	fc                   	cld
+  800f1a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f1c:	eb 06                	jmp    800f24 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f21:	fc                   	cld
+  800f22:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f24:	89 f8                	mov    %edi,%eax
+  800f26:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f29:	c9                   	leave
+  800f2a:	c3                   	ret
+
+00800f2b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f36:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f39:	39 c6                	cmp    %eax,%esi
+  800f3b:	73 32                	jae    800f6f <memmove+0x44>
+  800f3d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f40:	39 d0                	cmp    %edx,%eax
+  800f42:	73 2b                	jae    800f6f <memmove+0x44>
+		s += n;
+		d += n;
+  800f44:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f47:	89 d6                	mov    %edx,%esi
+  800f49:	09 fe                	or     %edi,%esi
+  800f4b:	09 ce                	or     %ecx,%esi
+  800f4d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f53:	75 0e                	jne    800f63 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f55:	83 ef 04             	sub    $0x4,%edi
+  800f58:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f5b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f5e:	fd                   	std
+  800f5f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f61:	eb 09                	jmp    800f6c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f63:	83 ef 01             	sub    $0x1,%edi
+  800f66:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f69:	fd                   	std
+  800f6a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f6c:	fc                   	cld
+  800f6d:	eb 1a                	jmp    800f89 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f6f:	89 f2                	mov    %esi,%edx
+  800f71:	09 c2                	or     %eax,%edx
+  800f73:	09 ca                	or     %ecx,%edx
+  800f75:	f6 c2 03             	test   $0x3,%dl
+  800f78:	75 0a                	jne    800f84 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f7a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f7d:	89 c7                	mov    %eax,%edi
+  800f7f:	fc                   	cld
+  800f80:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f82:	eb 05                	jmp    800f89 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f84:	89 c7                	mov    %eax,%edi
+  800f86:	fc                   	cld
+  800f87:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+
+00800f8d <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f93:	ff 75 10             	push   0x10(%ebp)
+  800f96:	ff 75 0c             	push   0xc(%ebp)
+  800f99:	ff 75 08             	push   0x8(%ebp)
+  800f9c:	e8 8a ff ff ff       	call   800f2b <memmove>
+}
+  800fa1:	c9                   	leave
+  800fa2:	c3                   	ret
+
+00800fa3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800fa3:	55                   	push   %ebp
+  800fa4:	89 e5                	mov    %esp,%ebp
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+  800fa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fae:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800fb1:	85 f6                	test   %esi,%esi
+  800fb3:	74 29                	je     800fde <memcmp+0x3b>
+  800fb5:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800fb7:	0f b6 08             	movzbl (%eax),%ecx
+  800fba:	0f b6 1a             	movzbl (%edx),%ebx
+  800fbd:	38 d9                	cmp    %bl,%cl
+  800fbf:	75 11                	jne    800fd2 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800fc1:	83 c0 01             	add    $0x1,%eax
+  800fc4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800fc7:	39 c6                	cmp    %eax,%esi
+  800fc9:	75 ec                	jne    800fb7 <memcmp+0x14>
+	}
+
+	return 0;
+  800fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd0:	eb 08                	jmp    800fda <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800fd2:	0f b6 c1             	movzbl %cl,%eax
+  800fd5:	0f b6 db             	movzbl %bl,%ebx
+  800fd8:	29 d8                	sub    %ebx,%eax
+}
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5e                   	pop    %esi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+	return 0;
+  800fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe3:	eb f5                	jmp    800fda <memcmp+0x37>
+
+00800fe5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800fee:	89 c2                	mov    %eax,%edx
+  800ff0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ff3:	39 d0                	cmp    %edx,%eax
+  800ff5:	73 0d                	jae    801004 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ff7:	38 08                	cmp    %cl,(%eax)
+  800ff9:	74 0d                	je     801008 <memfind+0x23>
+	for (; s < ends; s++)
+  800ffb:	83 c0 01             	add    $0x1,%eax
+  800ffe:	39 c2                	cmp    %eax,%edx
+  801000:	75 f5                	jne    800ff7 <memfind+0x12>
+  801002:	eb 06                	jmp    80100a <memfind+0x25>
+  801004:	89 c2                	mov    %eax,%edx
+  801006:	eb 02                	jmp    80100a <memfind+0x25>
+  801008:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  80100a:	89 d0                	mov    %edx,%eax
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+
+0080100e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	57                   	push   %edi
+  801012:	56                   	push   %esi
+  801013:	53                   	push   %ebx
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80101a:	0f b6 02             	movzbl (%edx),%eax
+  80101d:	3c 20                	cmp    $0x20,%al
+  80101f:	74 04                	je     801025 <strtol+0x17>
+  801021:	3c 09                	cmp    $0x9,%al
+  801023:	75 0e                	jne    801033 <strtol+0x25>
+		s++;
+  801025:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801028:	0f b6 02             	movzbl (%edx),%eax
+  80102b:	3c 20                	cmp    $0x20,%al
+  80102d:	74 f6                	je     801025 <strtol+0x17>
+  80102f:	3c 09                	cmp    $0x9,%al
+  801031:	74 f2                	je     801025 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  801033:	3c 2b                	cmp    $0x2b,%al
+  801035:	74 2a                	je     801061 <strtol+0x53>
+	int neg = 0;
+  801037:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80103c:	3c 2d                	cmp    $0x2d,%al
+  80103e:	74 2b                	je     80106b <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801040:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801046:	75 0f                	jne    801057 <strtol+0x49>
+  801048:	80 3a 30             	cmpb   $0x30,(%edx)
+  80104b:	74 28                	je     801075 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80104d:	85 db                	test   %ebx,%ebx
+  80104f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801054:	0f 44 d8             	cmove  %eax,%ebx
+  801057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80105c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80105f:	eb 46                	jmp    8010a7 <strtol+0x99>
+		s++;
+  801061:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801064:	bf 00 00 00 00       	mov    $0x0,%edi
+  801069:	eb d5                	jmp    801040 <strtol+0x32>
+		s++, neg = 1;
+  80106b:	83 c2 01             	add    $0x1,%edx
+  80106e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801073:	eb cb                	jmp    801040 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801075:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801079:	74 0e                	je     801089 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  80107b:	85 db                	test   %ebx,%ebx
+  80107d:	75 d8                	jne    801057 <strtol+0x49>
+		s++, base = 8;
+  80107f:	83 c2 01             	add    $0x1,%edx
+  801082:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801087:	eb ce                	jmp    801057 <strtol+0x49>
+		s += 2, base = 16;
+  801089:	83 c2 02             	add    $0x2,%edx
+  80108c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801091:	eb c4                	jmp    801057 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801093:	0f be c0             	movsbl %al,%eax
+  801096:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801099:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80109c:	7d 3a                	jge    8010d8 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  80109e:	83 c2 01             	add    $0x1,%edx
+  8010a1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8010a5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8010a7:	0f b6 02             	movzbl (%edx),%eax
+  8010aa:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8010ad:	89 f3                	mov    %esi,%ebx
+  8010af:	80 fb 09             	cmp    $0x9,%bl
+  8010b2:	76 df                	jbe    801093 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8010b4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8010b7:	89 f3                	mov    %esi,%ebx
+  8010b9:	80 fb 19             	cmp    $0x19,%bl
+  8010bc:	77 08                	ja     8010c6 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8010be:	0f be c0             	movsbl %al,%eax
+  8010c1:	83 e8 57             	sub    $0x57,%eax
+  8010c4:	eb d3                	jmp    801099 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8010c6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8010c9:	89 f3                	mov    %esi,%ebx
+  8010cb:	80 fb 19             	cmp    $0x19,%bl
+  8010ce:	77 08                	ja     8010d8 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8010d0:	0f be c0             	movsbl %al,%eax
+  8010d3:	83 e8 37             	sub    $0x37,%eax
+  8010d6:	eb c1                	jmp    801099 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8010d8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8010dc:	74 05                	je     8010e3 <strtol+0xd5>
+		*endptr = (char *) s;
+  8010de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010e1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8010e3:	89 c8                	mov    %ecx,%eax
+  8010e5:	f7 d8                	neg    %eax
+  8010e7:	85 ff                	test   %edi,%edi
+  8010e9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8010ec:	89 c8                	mov    %ecx,%eax
+  8010ee:	5b                   	pop    %ebx
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+
+008010f3 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	89 c3                	mov    %eax,%ebx
+  801106:	89 c7                	mov    %eax,%edi
+  801108:	89 c6                	mov    %eax,%esi
+  80110a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	56                   	push   %esi
+  801116:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801117:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801121:	89 d1                	mov    %edx,%ecx
+  801123:	89 d3                	mov    %edx,%ebx
+  801125:	89 d7                	mov    %edx,%edi
+  801127:	89 d6                	mov    %edx,%esi
+  801129:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80112b:	5b                   	pop    %ebx
+  80112c:	5e                   	pop    %esi
+  80112d:	5f                   	pop    %edi
+  80112e:	5d                   	pop    %ebp
+  80112f:	c3                   	ret
+
+00801130 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	57                   	push   %edi
+  801134:	56                   	push   %esi
+  801135:	53                   	push   %ebx
+  801136:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801139:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801141:	b8 03 00 00 00       	mov    $0x3,%eax
+  801146:	89 cb                	mov    %ecx,%ebx
+  801148:	89 cf                	mov    %ecx,%edi
+  80114a:	89 ce                	mov    %ecx,%esi
+  80114c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114e:	85 c0                	test   %eax,%eax
+  801150:	7f 08                	jg     80115a <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801152:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801155:	5b                   	pop    %ebx
+  801156:	5e                   	pop    %esi
+  801157:	5f                   	pop    %edi
+  801158:	5d                   	pop    %ebp
+  801159:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115a:	83 ec 0c             	sub    $0xc,%esp
+  80115d:	50                   	push   %eax
+  80115e:	6a 03                	push   $0x3
+  801160:	68 4b 47 80 00       	push   $0x80474b
+  801165:	6a 23                	push   $0x23
+  801167:	68 68 47 80 00       	push   $0x804768
+  80116c:	e8 b1 2b 00 00       	call   803d22 <_panic>
+
+00801171 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	57                   	push   %edi
+  801175:	56                   	push   %esi
+  801176:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801181:	89 d1                	mov    %edx,%ecx
+  801183:	89 d3                	mov    %edx,%ebx
+  801185:	89 d7                	mov    %edx,%edi
+  801187:	89 d6                	mov    %edx,%esi
+  801189:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80118b:	5b                   	pop    %ebx
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+
+00801190 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801190:	55                   	push   %ebp
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	57                   	push   %edi
+  801194:	56                   	push   %esi
+  801195:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801196:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011a0:	89 d1                	mov    %edx,%ecx
+  8011a2:	89 d3                	mov    %edx,%ebx
+  8011a4:	89 d7                	mov    %edx,%edi
+  8011a6:	89 d6                	mov    %edx,%esi
+  8011a8:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8011aa:	5b                   	pop    %ebx
+  8011ab:	5e                   	pop    %esi
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+
+008011af <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8011af:	55                   	push   %ebp
+  8011b0:	89 e5                	mov    %esp,%ebp
+  8011b2:	57                   	push   %edi
+  8011b3:	56                   	push   %esi
+  8011b4:	53                   	push   %ebx
+  8011b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cb:	89 f7                	mov    %esi,%edi
+  8011cd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011cf:	85 c0                	test   %eax,%eax
+  8011d1:	7f 08                	jg     8011db <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8011d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d6:	5b                   	pop    %ebx
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5f                   	pop    %edi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011db:	83 ec 0c             	sub    $0xc,%esp
+  8011de:	50                   	push   %eax
+  8011df:	6a 04                	push   $0x4
+  8011e1:	68 4b 47 80 00       	push   $0x80474b
+  8011e6:	6a 23                	push   $0x23
+  8011e8:	68 68 47 80 00       	push   $0x804768
+  8011ed:	e8 30 2b 00 00       	call   803d22 <_panic>
+
+008011f2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	57                   	push   %edi
+  8011f6:	56                   	push   %esi
+  8011f7:	53                   	push   %ebx
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801201:	b8 05 00 00 00       	mov    $0x5,%eax
+  801206:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801209:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80120c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80120f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801211:	85 c0                	test   %eax,%eax
+  801213:	7f 08                	jg     80121d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801218:	5b                   	pop    %ebx
+  801219:	5e                   	pop    %esi
+  80121a:	5f                   	pop    %edi
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80121d:	83 ec 0c             	sub    $0xc,%esp
+  801220:	50                   	push   %eax
+  801221:	6a 05                	push   $0x5
+  801223:	68 4b 47 80 00       	push   $0x80474b
+  801228:	6a 23                	push   $0x23
+  80122a:	68 68 47 80 00       	push   $0x804768
+  80122f:	e8 ee 2a 00 00       	call   803d22 <_panic>
+
+00801234 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	57                   	push   %edi
+  801238:	56                   	push   %esi
+  801239:	53                   	push   %ebx
+  80123a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80123d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801242:	8b 55 08             	mov    0x8(%ebp),%edx
+  801245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801248:	b8 06 00 00 00       	mov    $0x6,%eax
+  80124d:	89 df                	mov    %ebx,%edi
+  80124f:	89 de                	mov    %ebx,%esi
+  801251:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801253:	85 c0                	test   %eax,%eax
+  801255:	7f 08                	jg     80125f <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125a:	5b                   	pop    %ebx
+  80125b:	5e                   	pop    %esi
+  80125c:	5f                   	pop    %edi
+  80125d:	5d                   	pop    %ebp
+  80125e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125f:	83 ec 0c             	sub    $0xc,%esp
+  801262:	50                   	push   %eax
+  801263:	6a 06                	push   $0x6
+  801265:	68 4b 47 80 00       	push   $0x80474b
+  80126a:	6a 23                	push   $0x23
+  80126c:	68 68 47 80 00       	push   $0x804768
+  801271:	e8 ac 2a 00 00       	call   803d22 <_panic>
+
+00801276 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801276:	55                   	push   %ebp
+  801277:	89 e5                	mov    %esp,%ebp
+  801279:	57                   	push   %edi
+  80127a:	56                   	push   %esi
+  80127b:	53                   	push   %ebx
+  80127c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80127f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801284:	8b 55 08             	mov    0x8(%ebp),%edx
+  801287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80128f:	89 df                	mov    %ebx,%edi
+  801291:	89 de                	mov    %ebx,%esi
+  801293:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801295:	85 c0                	test   %eax,%eax
+  801297:	7f 08                	jg     8012a1 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129c:	5b                   	pop    %ebx
+  80129d:	5e                   	pop    %esi
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	50                   	push   %eax
+  8012a5:	6a 08                	push   $0x8
+  8012a7:	68 4b 47 80 00       	push   $0x80474b
+  8012ac:	6a 23                	push   $0x23
+  8012ae:	68 68 47 80 00       	push   $0x804768
+  8012b3:	e8 6a 2a 00 00       	call   803d22 <_panic>
+
+008012b8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	57                   	push   %edi
+  8012bc:	56                   	push   %esi
+  8012bd:	53                   	push   %ebx
+  8012be:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012d1:	89 df                	mov    %ebx,%edi
+  8012d3:	89 de                	mov    %ebx,%esi
+  8012d5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012d7:	85 c0                	test   %eax,%eax
+  8012d9:	7f 08                	jg     8012e3 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8012db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012de:	5b                   	pop    %ebx
+  8012df:	5e                   	pop    %esi
+  8012e0:	5f                   	pop    %edi
+  8012e1:	5d                   	pop    %ebp
+  8012e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012e3:	83 ec 0c             	sub    $0xc,%esp
+  8012e6:	50                   	push   %eax
+  8012e7:	6a 09                	push   $0x9
+  8012e9:	68 4b 47 80 00       	push   $0x80474b
+  8012ee:	6a 23                	push   $0x23
+  8012f0:	68 68 47 80 00       	push   $0x804768
+  8012f5:	e8 28 2a 00 00       	call   803d22 <_panic>
+
+008012fa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	57                   	push   %edi
+  8012fe:	56                   	push   %esi
+  8012ff:	53                   	push   %ebx
+  801300:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801308:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801313:	89 df                	mov    %ebx,%edi
+  801315:	89 de                	mov    %ebx,%esi
+  801317:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	7f 08                	jg     801325 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80131d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801320:	5b                   	pop    %ebx
+  801321:	5e                   	pop    %esi
+  801322:	5f                   	pop    %edi
+  801323:	5d                   	pop    %ebp
+  801324:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	50                   	push   %eax
+  801329:	6a 0a                	push   $0xa
+  80132b:	68 4b 47 80 00       	push   $0x80474b
+  801330:	6a 23                	push   $0x23
+  801332:	68 68 47 80 00       	push   $0x804768
+  801337:	e8 e6 29 00 00       	call   803d22 <_panic>
+
+0080133c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801348:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80134d:	be 00 00 00 00       	mov    $0x0,%esi
+  801352:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801355:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801358:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80135a:	5b                   	pop    %ebx
+  80135b:	5e                   	pop    %esi
+  80135c:	5f                   	pop    %edi
+  80135d:	5d                   	pop    %ebp
+  80135e:	c3                   	ret
+
+0080135f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	57                   	push   %edi
+  801363:	56                   	push   %esi
+  801364:	53                   	push   %ebx
+  801365:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801368:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80136d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801370:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801375:	89 cb                	mov    %ecx,%ebx
+  801377:	89 cf                	mov    %ecx,%edi
+  801379:	89 ce                	mov    %ecx,%esi
+  80137b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80137d:	85 c0                	test   %eax,%eax
+  80137f:	7f 08                	jg     801389 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801384:	5b                   	pop    %ebx
+  801385:	5e                   	pop    %esi
+  801386:	5f                   	pop    %edi
+  801387:	5d                   	pop    %ebp
+  801388:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801389:	83 ec 0c             	sub    $0xc,%esp
+  80138c:	50                   	push   %eax
+  80138d:	6a 0d                	push   $0xd
+  80138f:	68 4b 47 80 00       	push   $0x80474b
+  801394:	6a 23                	push   $0x23
+  801396:	68 68 47 80 00       	push   $0x804768
+  80139b:	e8 82 29 00 00       	call   803d22 <_panic>
+
+008013a0 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	57                   	push   %edi
+  8013a4:	56                   	push   %esi
+  8013a5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013b7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013ba:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5f                   	pop    %edi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+
+008013c1 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	57                   	push   %edi
+  8013c5:	56                   	push   %esi
+  8013c6:	53                   	push   %ebx
+  8013c7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013da:	89 df                	mov    %ebx,%edi
+  8013dc:	89 de                	mov    %ebx,%esi
+  8013de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e0:	85 c0                	test   %eax,%eax
+  8013e2:	7f 08                	jg     8013ec <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8013e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ec:	83 ec 0c             	sub    $0xc,%esp
+  8013ef:	50                   	push   %eax
+  8013f0:	6a 0d                	push   $0xd
+  8013f2:	68 4b 47 80 00       	push   $0x80474b
+  8013f7:	6a 23                	push   $0x23
+  8013f9:	68 68 47 80 00       	push   $0x804768
+  8013fe:	e8 1f 29 00 00       	call   803d22 <_panic>
+
+00801403 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801403:	55                   	push   %ebp
+  801404:	89 e5                	mov    %esp,%ebp
+  801406:	57                   	push   %edi
+  801407:	56                   	push   %esi
+  801408:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801413:	89 d1                	mov    %edx,%ecx
+  801415:	89 d3                	mov    %edx,%ebx
+  801417:	89 d7                	mov    %edx,%edi
+  801419:	89 d6                	mov    %edx,%esi
+  80141b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5f                   	pop    %edi
+  801420:	5d                   	pop    %ebp
+  801421:	c3                   	ret
+
+00801422 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	57                   	push   %edi
+  801426:	56                   	push   %esi
+  801427:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801433:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801438:	89 df                	mov    %ebx,%edi
+  80143a:	89 de                	mov    %ebx,%esi
+  80143c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+
+00801443 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801443:	55                   	push   %ebp
+  801444:	89 e5                	mov    %esp,%ebp
+  801446:	57                   	push   %edi
+  801447:	56                   	push   %esi
+  801448:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801449:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80144e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801451:	b8 10 00 00 00       	mov    $0x10,%eax
+  801456:	89 cb                	mov    %ecx,%ebx
+  801458:	89 cf                	mov    %ecx,%edi
+  80145a:	89 ce                	mov    %ecx,%esi
+  80145c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80145e:	5b                   	pop    %ebx
+  80145f:	5e                   	pop    %esi
+  801460:	5f                   	pop    %edi
+  801461:	5d                   	pop    %ebp
+  801462:	c3                   	ret
+
+00801463 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	57                   	push   %edi
+  801467:	56                   	push   %esi
+  801468:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801469:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801471:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801474:	b8 11 00 00 00       	mov    $0x11,%eax
+  801479:	89 df                	mov    %ebx,%edi
+  80147b:	89 de                	mov    %ebx,%esi
+  80147d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80147f:	5b                   	pop    %ebx
+  801480:	5e                   	pop    %esi
+  801481:	5f                   	pop    %edi
+  801482:	5d                   	pop    %ebp
+  801483:	c3                   	ret
+
+00801484 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801484:	55                   	push   %ebp
+  801485:	89 e5                	mov    %esp,%ebp
+  801487:	57                   	push   %edi
+  801488:	56                   	push   %esi
+  801489:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80148a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801492:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801495:	b8 12 00 00 00       	mov    $0x12,%eax
+  80149a:	89 df                	mov    %ebx,%edi
+  80149c:	89 de                	mov    %ebx,%esi
+  80149e:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014a0:	5b                   	pop    %ebx
+  8014a1:	5e                   	pop    %esi
+  8014a2:	5f                   	pop    %edi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+
+008014a5 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014b8:	89 cb                	mov    %ecx,%ebx
+  8014ba:	89 cf                	mov    %ecx,%edi
+  8014bc:	89 ce                	mov    %ecx,%esi
+  8014be:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8014c0:	5b                   	pop    %ebx
+  8014c1:	5e                   	pop    %esi
+  8014c2:	5f                   	pop    %edi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+
+008014c5 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	57                   	push   %edi
+  8014c9:	56                   	push   %esi
+  8014ca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8014db:	89 df                	mov    %ebx,%edi
+  8014dd:	89 de                	mov    %ebx,%esi
+  8014df:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8014e1:	5b                   	pop    %ebx
+  8014e2:	5e                   	pop    %esi
+  8014e3:	5f                   	pop    %edi
+  8014e4:	5d                   	pop    %ebp
+  8014e5:	c3                   	ret
+
+008014e6 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	57                   	push   %edi
+  8014ea:	56                   	push   %esi
+  8014eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8014f9:	89 cb                	mov    %ecx,%ebx
+  8014fb:	89 cf                	mov    %ecx,%edi
+  8014fd:	89 ce                	mov    %ecx,%esi
+  8014ff:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801501:	5b                   	pop    %ebx
+  801502:	5e                   	pop    %esi
+  801503:	5f                   	pop    %edi
+  801504:	5d                   	pop    %ebp
+  801505:	c3                   	ret
+
+00801506 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	57                   	push   %edi
+  80150a:	56                   	push   %esi
+  80150b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80150c:	be 00 00 00 00       	mov    $0x0,%esi
+  801511:	8b 55 08             	mov    0x8(%ebp),%edx
+  801514:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801517:	b8 16 00 00 00       	mov    $0x16,%eax
+  80151c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151f:	89 f7                	mov    %esi,%edi
+  801521:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801523:	5b                   	pop    %ebx
+  801524:	5e                   	pop    %esi
+  801525:	5f                   	pop    %edi
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+
+00801528 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	57                   	push   %edi
+  80152c:	56                   	push   %esi
+  80152d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80152e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801533:	8b 55 08             	mov    0x8(%ebp),%edx
+  801536:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801539:	b8 17 00 00 00       	mov    $0x17,%eax
+  80153e:	89 df                	mov    %ebx,%edi
+  801540:	89 de                	mov    %ebx,%esi
+  801542:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801544:	5b                   	pop    %ebx
+  801545:	5e                   	pop    %esi
+  801546:	5f                   	pop    %edi
+  801547:	5d                   	pop    %ebp
+  801548:	c3                   	ret
+
+00801549 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801549:	55                   	push   %ebp
+  80154a:	89 e5                	mov    %esp,%ebp
+  80154c:	57                   	push   %edi
+  80154d:	56                   	push   %esi
+  80154e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80154f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801554:	8b 55 08             	mov    0x8(%ebp),%edx
+  801557:	b8 18 00 00 00       	mov    $0x18,%eax
+  80155c:	89 cb                	mov    %ecx,%ebx
+  80155e:	89 cf                	mov    %ecx,%edi
+  801560:	89 ce                	mov    %ecx,%esi
+  801562:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+
+00801569 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	57                   	push   %edi
+  80156d:	56                   	push   %esi
+  80156e:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80156f:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801578:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801580:	89 df                	mov    %ebx,%edi
+  801582:	89 de                	mov    %ebx,%esi
+  801584:	cd 30                	int    $0x30
+}
+  801586:	5b                   	pop    %ebx
+  801587:	5e                   	pop    %esi
+  801588:	5f                   	pop    %edi
+  801589:	5d                   	pop    %ebp
+  80158a:	c3                   	ret
+
+0080158b <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	57                   	push   %edi
+  80158f:	56                   	push   %esi
+  801590:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801591:	be 00 00 00 00       	mov    $0x0,%esi
+  801596:	8b 55 08             	mov    0x8(%ebp),%edx
+  801599:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a4:	89 f7                	mov    %esi,%edi
+  8015a6:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8015a8:	5b                   	pop    %ebx
+  8015a9:	5e                   	pop    %esi
+  8015aa:	5f                   	pop    %edi
+  8015ab:	5d                   	pop    %ebp
+  8015ac:	c3                   	ret
+
+008015ad <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8015ad:	55                   	push   %ebp
+  8015ae:	89 e5                	mov    %esp,%ebp
+  8015b0:	57                   	push   %edi
+  8015b1:	56                   	push   %esi
+  8015b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c6:	89 f7                	mov    %esi,%edi
+  8015c8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8015ca:	5b                   	pop    %ebx
+  8015cb:	5e                   	pop    %esi
+  8015cc:	5f                   	pop    %edi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+
+008015cf <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	57                   	push   %edi
+  8015d3:	56                   	push   %esi
+  8015d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015e5:	89 df                	mov    %ebx,%edi
+  8015e7:	89 de                	mov    %ebx,%esi
+  8015e9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8015eb:	5b                   	pop    %ebx
+  8015ec:	5e                   	pop    %esi
+  8015ed:	5f                   	pop    %edi
+  8015ee:	5d                   	pop    %ebp
+  8015ef:	c3                   	ret
+
+008015f0 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	57                   	push   %edi
+  8015f4:	56                   	push   %esi
+  8015f5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801601:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801606:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801609:	89 f7                	mov    %esi,%edi
+  80160b:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5f                   	pop    %edi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+
+00801612 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+  801617:	8b 75 08             	mov    0x8(%ebp),%esi
+  80161a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80161d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801620:	85 c0                	test   %eax,%eax
+  801622:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801627:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+  80162d:	50                   	push   %eax
+  80162e:	e8 2c fd ff ff       	call   80135f <sys_ipc_recv>
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	85 c0                	test   %eax,%eax
+  801638:	0f 88 8b 00 00 00    	js     8016c9 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80163e:	85 f6                	test   %esi,%esi
+  801640:	74 2a                	je     80166c <ipc_recv+0x5a>
+  801642:	89 e2                	mov    %esp,%edx
+  801644:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801649:	29 d0                	sub    %edx,%eax
+  80164b:	89 c2                	mov    %eax,%edx
+  80164d:	c1 ea 0f             	shr    $0xf,%edx
+  801650:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80165d:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801664:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80166a:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80166c:	85 db                	test   %ebx,%ebx
+  80166e:	74 2a                	je     80169a <ipc_recv+0x88>
+  801670:	89 e2                	mov    %esp,%edx
+  801672:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801677:	29 d0                	sub    %edx,%eax
+  801679:	89 c2                	mov    %eax,%edx
+  80167b:	c1 ea 0f             	shr    $0xf,%edx
+  80167e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801683:	b8 00 00 00 00       	mov    $0x0,%eax
+  801688:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80168b:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801692:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801698:	89 03                	mov    %eax,(%ebx)
+  80169a:	89 e2                	mov    %esp,%edx
+  80169c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016a1:	29 d0                	sub    %edx,%eax
+  8016a3:	89 c2                	mov    %eax,%edx
+  8016a5:	c1 ea 0f             	shr    $0xf,%edx
+  8016a8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8016b5:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  8016bc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8016c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c5:	5b                   	pop    %ebx
+  8016c6:	5e                   	pop    %esi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+		if(from_env_store != NULL)
+  8016c9:	85 f6                	test   %esi,%esi
+  8016cb:	74 06                	je     8016d3 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8016cd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8016d3:	85 db                	test   %ebx,%ebx
+  8016d5:	74 eb                	je     8016c2 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8016d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8016dd:	eb e3                	jmp    8016c2 <ipc_recv+0xb0>
+
+008016df <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8016df:	55                   	push   %ebp
+  8016e0:	89 e5                	mov    %esp,%ebp
+  8016e2:	57                   	push   %edi
+  8016e3:	56                   	push   %esi
+  8016e4:	53                   	push   %ebx
+  8016e5:	83 ec 14             	sub    $0x14,%esp
+  8016e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016ee:	8b 75 14             	mov    0x14(%ebp),%esi
+  8016f1:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8016f4:	85 c0                	test   %eax,%eax
+  8016f6:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8016fb:	0f 44 c2             	cmove  %edx,%eax
+  8016fe:	ff 75 10             	push   0x10(%ebp)
+  801701:	50                   	push   %eax
+  801702:	e8 ba fc ff ff       	call   8013c1 <sys_ipc_recv_pages>
+  801707:	83 c4 10             	add    $0x10,%esp
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	0f 88 ba 00 00 00    	js     8017cc <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801712:	85 ff                	test   %edi,%edi
+  801714:	74 2a                	je     801740 <ipc_recv_pages+0x61>
+  801716:	89 e2                	mov    %esp,%edx
+  801718:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80171d:	29 d0                	sub    %edx,%eax
+  80171f:	89 c2                	mov    %eax,%edx
+  801721:	c1 ea 0f             	shr    $0xf,%edx
+  801724:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801731:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801738:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80173e:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801740:	85 f6                	test   %esi,%esi
+  801742:	74 2a                	je     80176e <ipc_recv_pages+0x8f>
+  801744:	89 e2                	mov    %esp,%edx
+  801746:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80174b:	29 d0                	sub    %edx,%eax
+  80174d:	89 c2                	mov    %eax,%edx
+  80174f:	c1 ea 0f             	shr    $0xf,%edx
+  801752:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175c:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80175f:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801766:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80176c:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80176e:	85 db                	test   %ebx,%ebx
+  801770:	74 2a                	je     80179c <ipc_recv_pages+0xbd>
+  801772:	89 e2                	mov    %esp,%edx
+  801774:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801779:	29 d0                	sub    %edx,%eax
+  80177b:	89 c2                	mov    %eax,%edx
+  80177d:	c1 ea 0f             	shr    $0xf,%edx
+  801780:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178a:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80178d:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801794:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80179a:	89 03                	mov    %eax,(%ebx)
+  80179c:	89 e2                	mov    %esp,%edx
+  80179e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017a3:	29 d0                	sub    %edx,%eax
+  8017a5:	89 c2                	mov    %eax,%edx
+  8017a7:	c1 ea 0f             	shr    $0xf,%edx
+  8017aa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8017b7:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  8017be:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8017c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c7:	5b                   	pop    %ebx
+  8017c8:	5e                   	pop    %esi
+  8017c9:	5f                   	pop    %edi
+  8017ca:	5d                   	pop    %ebp
+  8017cb:	c3                   	ret
+		if (from_env_store)
+  8017cc:	85 ff                	test   %edi,%edi
+  8017ce:	74 06                	je     8017d6 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8017d0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8017d6:	85 f6                	test   %esi,%esi
+  8017d8:	74 06                	je     8017e0 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8017da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8017e0:	85 db                	test   %ebx,%ebx
+  8017e2:	74 e0                	je     8017c4 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8017e4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017ea:	eb d8                	jmp    8017c4 <ipc_recv_pages+0xe5>
+
+008017ec <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8017ec:	55                   	push   %ebp
+  8017ed:	89 e5                	mov    %esp,%ebp
+  8017ef:	57                   	push   %edi
+  8017f0:	56                   	push   %esi
+  8017f1:	53                   	push   %ebx
+  8017f2:	83 ec 1c             	sub    $0x1c,%esp
+  8017f5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8017f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017fb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801801:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801805:	75 2b                	jne    801832 <ipc_try_send_pages+0x46>
+  801807:	89 e2                	mov    %esp,%edx
+  801809:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80180e:	29 d0                	sub    %edx,%eax
+  801810:	89 c2                	mov    %eax,%edx
+  801812:	c1 ea 0f             	shr    $0xf,%edx
+  801815:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80181a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181f:	0f 42 c2             	cmovb  %edx,%eax
+  801822:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801829:	8b 70 48             	mov    0x48(%eax),%esi
+  80182c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801832:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801838:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80183d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801840:	85 ff                	test   %edi,%edi
+  801842:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801847:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80184a:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801850:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801856:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80185c:	83 ec 0c             	sub    $0xc,%esp
+  80185f:	ff 75 14             	push   0x14(%ebp)
+  801862:	ff 75 18             	push   0x18(%ebp)
+  801865:	57                   	push   %edi
+  801866:	ff 75 0c             	push   0xc(%ebp)
+  801869:	ff 75 08             	push   0x8(%ebp)
+  80186c:	e8 2f fb ff ff       	call   8013a0 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801871:	83 c4 20             	add    $0x20,%esp
+  801874:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801877:	75 21                	jne    80189a <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801879:	83 ec 04             	sub    $0x4,%esp
+  80187c:	6a ff                	push   $0xffffffff
+  80187e:	53                   	push   %ebx
+  80187f:	ff 75 e4             	push   -0x1c(%ebp)
+  801882:	e8 26 fd ff ff       	call   8015ad <sys_futex_wait>
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80188d:	74 c7                	je     801856 <ipc_try_send_pages+0x6a>
+  80188f:	85 c0                	test   %eax,%eax
+  801891:	79 c3                	jns    801856 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801893:	e8 f8 f8 ff ff       	call   801190 <sys_yield>
+  801898:	eb bc                	jmp    801856 <ipc_try_send_pages+0x6a>
+	}
+}
+  80189a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189d:	5b                   	pop    %ebx
+  80189e:	5e                   	pop    %esi
+  80189f:	5f                   	pop    %edi
+  8018a0:	5d                   	pop    %ebp
+  8018a1:	c3                   	ret
+
+008018a2 <ipc_send>:
+{
+  8018a2:	55                   	push   %ebp
+  8018a3:	89 e5                	mov    %esp,%ebp
+  8018a5:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8018a8:	ff 75 14             	push   0x14(%ebp)
+  8018ab:	6a 01                	push   $0x1
+  8018ad:	ff 75 10             	push   0x10(%ebp)
+  8018b0:	ff 75 0c             	push   0xc(%ebp)
+  8018b3:	ff 75 08             	push   0x8(%ebp)
+  8018b6:	e8 31 ff ff ff       	call   8017ec <ipc_try_send_pages>
+  8018bb:	83 c4 20             	add    $0x20,%esp
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	78 02                	js     8018c4 <ipc_send+0x22>
+}
+  8018c2:	c9                   	leave
+  8018c3:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8018c4:	50                   	push   %eax
+  8018c5:	68 76 47 80 00       	push   $0x804776
+  8018ca:	6a 3f                	push   $0x3f
+  8018cc:	68 8b 47 80 00       	push   $0x80478b
+  8018d1:	e8 4c 24 00 00       	call   803d22 <_panic>
+
+008018d6 <ipc_send_pages>:
+{
+  8018d6:	55                   	push   %ebp
+  8018d7:	89 e5                	mov    %esp,%ebp
+  8018d9:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8018dc:	ff 75 18             	push   0x18(%ebp)
+  8018df:	ff 75 14             	push   0x14(%ebp)
+  8018e2:	ff 75 10             	push   0x10(%ebp)
+  8018e5:	ff 75 0c             	push   0xc(%ebp)
+  8018e8:	ff 75 08             	push   0x8(%ebp)
+  8018eb:	e8 fc fe ff ff       	call   8017ec <ipc_try_send_pages>
+  8018f0:	83 c4 20             	add    $0x20,%esp
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	78 02                	js     8018f9 <ipc_send_pages+0x23>
+}
+  8018f7:	c9                   	leave
+  8018f8:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8018f9:	50                   	push   %eax
+  8018fa:	68 95 47 80 00       	push   $0x804795
+  8018ff:	6a 64                	push   $0x64
+  801901:	68 8b 47 80 00       	push   $0x80478b
+  801906:	e8 17 24 00 00       	call   803d22 <_panic>
+
+0080190b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80190b:	55                   	push   %ebp
+  80190c:	89 e5                	mov    %esp,%ebp
+  80190e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801911:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801916:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80191c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801922:	8b 52 50             	mov    0x50(%edx),%edx
+  801925:	39 ca                	cmp    %ecx,%edx
+  801927:	74 11                	je     80193a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801929:	83 c0 01             	add    $0x1,%eax
+  80192c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801931:	75 e3                	jne    801916 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801933:	b8 00 00 00 00       	mov    $0x0,%eax
+  801938:	eb 0e                	jmp    801948 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80193a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801940:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801945:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+
+0080194a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80194d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801950:	05 00 00 00 30       	add    $0x30000000,%eax
+  801955:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801958:	5d                   	pop    %ebp
+  801959:	c3                   	ret
+
+0080195a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80195d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801960:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801965:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80196a:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80196f:	5d                   	pop    %ebp
+  801970:	c3                   	ret
+
+00801971 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801971:	55                   	push   %ebp
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801979:	89 c2                	mov    %eax,%edx
+  80197b:	c1 ea 16             	shr    $0x16,%edx
+  80197e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801985:	f6 c2 01             	test   $0x1,%dl
+  801988:	74 29                	je     8019b3 <fd_alloc+0x42>
+  80198a:	89 c2                	mov    %eax,%edx
+  80198c:	c1 ea 0c             	shr    $0xc,%edx
+  80198f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801996:	f6 c2 01             	test   $0x1,%dl
+  801999:	74 18                	je     8019b3 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80199b:	05 00 10 00 00       	add    $0x1000,%eax
+  8019a0:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8019a5:	75 d2                	jne    801979 <fd_alloc+0x8>
+  8019a7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019ac:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8019b1:	eb 05                	jmp    8019b8 <fd_alloc+0x47>
+			return 0;
+  8019b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8019b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bb:	89 02                	mov    %eax,(%edx)
+}
+  8019bd:	89 c8                	mov    %ecx,%eax
+  8019bf:	5d                   	pop    %ebp
+  8019c0:	c3                   	ret
+
+008019c1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019c7:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8019cc:	77 30                	ja     8019fe <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019ce:	c1 e0 0c             	shl    $0xc,%eax
+  8019d1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8019d6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019dc:	f6 c2 01             	test   $0x1,%dl
+  8019df:	74 24                	je     801a05 <fd_lookup+0x44>
+  8019e1:	89 c2                	mov    %eax,%edx
+  8019e3:	c1 ea 0c             	shr    $0xc,%edx
+  8019e6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019ed:	f6 c2 01             	test   $0x1,%dl
+  8019f0:	74 1a                	je     801a0c <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019fc:	5d                   	pop    %ebp
+  8019fd:	c3                   	ret
+		return -E_INVAL;
+  8019fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a03:	eb f7                	jmp    8019fc <fd_lookup+0x3b>
+		return -E_INVAL;
+  801a05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a0a:	eb f0                	jmp    8019fc <fd_lookup+0x3b>
+  801a0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a11:	eb e9                	jmp    8019fc <fd_lookup+0x3b>
+
+00801a13 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a13:	55                   	push   %ebp
+  801a14:	89 e5                	mov    %esp,%ebp
+  801a16:	53                   	push   %ebx
+  801a17:	83 ec 04             	sub    $0x4,%esp
+  801a1a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a22:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801a27:	39 13                	cmp    %edx,(%ebx)
+  801a29:	74 54                	je     801a7f <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801a2b:	83 c0 01             	add    $0x1,%eax
+  801a2e:	8b 1c 85 2c 48 80 00 	mov    0x80482c(,%eax,4),%ebx
+  801a35:	85 db                	test   %ebx,%ebx
+  801a37:	75 ee                	jne    801a27 <dev_lookup+0x14>
+  801a39:	89 e1                	mov    %esp,%ecx
+  801a3b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a40:	29 c8                	sub    %ecx,%eax
+  801a42:	89 c1                	mov    %eax,%ecx
+  801a44:	c1 e9 0f             	shr    $0xf,%ecx
+  801a47:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a51:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a54:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801a5b:	8b 40 48             	mov    0x48(%eax),%eax
+  801a5e:	83 ec 04             	sub    $0x4,%esp
+  801a61:	52                   	push   %edx
+  801a62:	50                   	push   %eax
+  801a63:	68 b0 47 80 00       	push   $0x8047b0
+  801a68:	e8 17 ec ff ff       	call   800684 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a6d:	83 c4 10             	add    $0x10,%esp
+  801a70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a75:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a78:	89 1a                	mov    %ebx,(%edx)
+}
+  801a7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a7d:	c9                   	leave
+  801a7e:	c3                   	ret
+			return 0;
+  801a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a84:	eb ef                	jmp    801a75 <dev_lookup+0x62>
+
+00801a86 <fd_close>:
+{
+  801a86:	55                   	push   %ebp
+  801a87:	89 e5                	mov    %esp,%ebp
+  801a89:	57                   	push   %edi
+  801a8a:	56                   	push   %esi
+  801a8b:	53                   	push   %ebx
+  801a8c:	83 ec 24             	sub    $0x24,%esp
+  801a8f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a92:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a95:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a98:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a99:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a9f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801aa2:	50                   	push   %eax
+  801aa3:	e8 19 ff ff ff       	call   8019c1 <fd_lookup>
+  801aa8:	89 c3                	mov    %eax,%ebx
+  801aaa:	83 c4 10             	add    $0x10,%esp
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	78 05                	js     801ab6 <fd_close+0x30>
+	    || fd != fd2)
+  801ab1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ab4:	74 0f                	je     801ac5 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801ab6:	85 ff                	test   %edi,%edi
+  801ab8:	0f 44 df             	cmove  %edi,%ebx
+}
+  801abb:	89 d8                	mov    %ebx,%eax
+  801abd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac0:	5b                   	pop    %ebx
+  801ac1:	5e                   	pop    %esi
+  801ac2:	5f                   	pop    %edi
+  801ac3:	5d                   	pop    %ebp
+  801ac4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ac5:	83 ec 08             	sub    $0x8,%esp
+  801ac8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801acb:	50                   	push   %eax
+  801acc:	ff 36                	push   (%esi)
+  801ace:	e8 40 ff ff ff       	call   801a13 <dev_lookup>
+  801ad3:	89 c3                	mov    %eax,%ebx
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	78 1a                	js     801af6 <fd_close+0x70>
+		if (dev->dev_close)
+  801adc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801adf:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ae2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ae7:	85 c0                	test   %eax,%eax
+  801ae9:	74 0b                	je     801af6 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801aeb:	83 ec 0c             	sub    $0xc,%esp
+  801aee:	56                   	push   %esi
+  801aef:	ff d0                	call   *%eax
+  801af1:	89 c3                	mov    %eax,%ebx
+  801af3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801af6:	83 ec 08             	sub    $0x8,%esp
+  801af9:	56                   	push   %esi
+  801afa:	6a 00                	push   $0x0
+  801afc:	e8 33 f7 ff ff       	call   801234 <sys_page_unmap>
+	return r;
+  801b01:	83 c4 10             	add    $0x10,%esp
+  801b04:	eb b5                	jmp    801abb <fd_close+0x35>
+
+00801b06 <close>:
+
+int
+close(int fdnum)
+{
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b0f:	50                   	push   %eax
+  801b10:	ff 75 08             	push   0x8(%ebp)
+  801b13:	e8 a9 fe ff ff       	call   8019c1 <fd_lookup>
+  801b18:	83 c4 10             	add    $0x10,%esp
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	79 02                	jns    801b21 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b1f:	c9                   	leave
+  801b20:	c3                   	ret
+		return fd_close(fd, 1);
+  801b21:	83 ec 08             	sub    $0x8,%esp
+  801b24:	6a 01                	push   $0x1
+  801b26:	ff 75 f4             	push   -0xc(%ebp)
+  801b29:	e8 58 ff ff ff       	call   801a86 <fd_close>
+  801b2e:	83 c4 10             	add    $0x10,%esp
+  801b31:	eb ec                	jmp    801b1f <close+0x19>
+
+00801b33 <close_all>:
+
+void
+close_all(void)
+{
+  801b33:	55                   	push   %ebp
+  801b34:	89 e5                	mov    %esp,%ebp
+  801b36:	53                   	push   %ebx
+  801b37:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	53                   	push   %ebx
+  801b43:	e8 be ff ff ff       	call   801b06 <close>
+	for (i = 0; i < MAXFD; i++)
+  801b48:	83 c3 01             	add    $0x1,%ebx
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801b54:	75 e9                	jne    801b3f <close_all+0xc>
+}
+  801b56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b59:	c9                   	leave
+  801b5a:	c3                   	ret
+
+00801b5b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b5b:	55                   	push   %ebp
+  801b5c:	89 e5                	mov    %esp,%ebp
+  801b5e:	57                   	push   %edi
+  801b5f:	56                   	push   %esi
+  801b60:	53                   	push   %ebx
+  801b61:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b64:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b67:	50                   	push   %eax
+  801b68:	ff 75 08             	push   0x8(%ebp)
+  801b6b:	e8 51 fe ff ff       	call   8019c1 <fd_lookup>
+  801b70:	89 c3                	mov    %eax,%ebx
+  801b72:	83 c4 10             	add    $0x10,%esp
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 7f                	js     801bf8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b79:	83 ec 0c             	sub    $0xc,%esp
+  801b7c:	ff 75 0c             	push   0xc(%ebp)
+  801b7f:	e8 82 ff ff ff       	call   801b06 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b84:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b87:	c1 e6 0c             	shl    $0xc,%esi
+  801b8a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b90:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b93:	89 3c 24             	mov    %edi,(%esp)
+  801b96:	e8 bf fd ff ff       	call   80195a <fd2data>
+  801b9b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b9d:	89 34 24             	mov    %esi,(%esp)
+  801ba0:	e8 b5 fd ff ff       	call   80195a <fd2data>
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801bab:	89 d8                	mov    %ebx,%eax
+  801bad:	c1 e8 16             	shr    $0x16,%eax
+  801bb0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bb7:	a8 01                	test   $0x1,%al
+  801bb9:	74 11                	je     801bcc <dup+0x71>
+  801bbb:	89 d8                	mov    %ebx,%eax
+  801bbd:	c1 e8 0c             	shr    $0xc,%eax
+  801bc0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801bc7:	f6 c2 01             	test   $0x1,%dl
+  801bca:	75 36                	jne    801c02 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bcc:	89 f8                	mov    %edi,%eax
+  801bce:	c1 e8 0c             	shr    $0xc,%eax
+  801bd1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bd8:	83 ec 0c             	sub    $0xc,%esp
+  801bdb:	25 07 0e 00 00       	and    $0xe07,%eax
+  801be0:	50                   	push   %eax
+  801be1:	56                   	push   %esi
+  801be2:	6a 00                	push   $0x0
+  801be4:	57                   	push   %edi
+  801be5:	6a 00                	push   $0x0
+  801be7:	e8 06 f6 ff ff       	call   8011f2 <sys_page_map>
+  801bec:	89 c3                	mov    %eax,%ebx
+  801bee:	83 c4 20             	add    $0x20,%esp
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	78 33                	js     801c28 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bf5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bf8:	89 d8                	mov    %ebx,%eax
+  801bfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bfd:	5b                   	pop    %ebx
+  801bfe:	5e                   	pop    %esi
+  801bff:	5f                   	pop    %edi
+  801c00:	5d                   	pop    %ebp
+  801c01:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c02:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c09:	83 ec 0c             	sub    $0xc,%esp
+  801c0c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c11:	50                   	push   %eax
+  801c12:	ff 75 d4             	push   -0x2c(%ebp)
+  801c15:	6a 00                	push   $0x0
+  801c17:	53                   	push   %ebx
+  801c18:	6a 00                	push   $0x0
+  801c1a:	e8 d3 f5 ff ff       	call   8011f2 <sys_page_map>
+  801c1f:	89 c3                	mov    %eax,%ebx
+  801c21:	83 c4 20             	add    $0x20,%esp
+  801c24:	85 c0                	test   %eax,%eax
+  801c26:	79 a4                	jns    801bcc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c28:	83 ec 08             	sub    $0x8,%esp
+  801c2b:	56                   	push   %esi
+  801c2c:	6a 00                	push   $0x0
+  801c2e:	e8 01 f6 ff ff       	call   801234 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c33:	83 c4 08             	add    $0x8,%esp
+  801c36:	ff 75 d4             	push   -0x2c(%ebp)
+  801c39:	6a 00                	push   $0x0
+  801c3b:	e8 f4 f5 ff ff       	call   801234 <sys_page_unmap>
+	return r;
+  801c40:	83 c4 10             	add    $0x10,%esp
+  801c43:	eb b3                	jmp    801bf8 <dup+0x9d>
+
+00801c45 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	56                   	push   %esi
+  801c49:	53                   	push   %ebx
+  801c4a:	83 ec 18             	sub    $0x18,%esp
+  801c4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c50:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c53:	50                   	push   %eax
+  801c54:	53                   	push   %ebx
+  801c55:	e8 67 fd ff ff       	call   8019c1 <fd_lookup>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	78 3c                	js     801c9d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c61:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c64:	83 ec 08             	sub    $0x8,%esp
+  801c67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6a:	50                   	push   %eax
+  801c6b:	ff 36                	push   (%esi)
+  801c6d:	e8 a1 fd ff ff       	call   801a13 <dev_lookup>
+  801c72:	83 c4 10             	add    $0x10,%esp
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	78 24                	js     801c9d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c79:	8b 46 08             	mov    0x8(%esi),%eax
+  801c7c:	83 e0 03             	and    $0x3,%eax
+  801c7f:	83 f8 01             	cmp    $0x1,%eax
+  801c82:	74 20                	je     801ca4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c87:	8b 40 08             	mov    0x8(%eax),%eax
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	74 54                	je     801ce2 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c8e:	83 ec 04             	sub    $0x4,%esp
+  801c91:	ff 75 10             	push   0x10(%ebp)
+  801c94:	ff 75 0c             	push   0xc(%ebp)
+  801c97:	56                   	push   %esi
+  801c98:	ff d0                	call   *%eax
+  801c9a:	83 c4 10             	add    $0x10,%esp
+}
+  801c9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca0:	5b                   	pop    %ebx
+  801ca1:	5e                   	pop    %esi
+  801ca2:	5d                   	pop    %ebp
+  801ca3:	c3                   	ret
+  801ca4:	89 e2                	mov    %esp,%edx
+  801ca6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801cab:	29 d0                	sub    %edx,%eax
+  801cad:	89 c2                	mov    %eax,%edx
+  801caf:	c1 ea 0f             	shr    $0xf,%edx
+  801cb2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbc:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cbf:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801cc6:	8b 40 48             	mov    0x48(%eax),%eax
+  801cc9:	83 ec 04             	sub    $0x4,%esp
+  801ccc:	53                   	push   %ebx
+  801ccd:	50                   	push   %eax
+  801cce:	68 f1 47 80 00       	push   $0x8047f1
+  801cd3:	e8 ac e9 ff ff       	call   800684 <cprintf>
+		return -E_INVAL;
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce0:	eb bb                	jmp    801c9d <read+0x58>
+		return -E_NOT_SUPP;
+  801ce2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce7:	eb b4                	jmp    801c9d <read+0x58>
+
+00801ce9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ce9:	55                   	push   %ebp
+  801cea:	89 e5                	mov    %esp,%ebp
+  801cec:	57                   	push   %edi
+  801ced:	56                   	push   %esi
+  801cee:	53                   	push   %ebx
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+  801cf2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801cf5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801cf8:	85 f6                	test   %esi,%esi
+  801cfa:	74 30                	je     801d2c <readn+0x43>
+  801cfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d01:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d06:	83 ec 04             	sub    $0x4,%esp
+  801d09:	89 f2                	mov    %esi,%edx
+  801d0b:	29 c2                	sub    %eax,%edx
+  801d0d:	52                   	push   %edx
+  801d0e:	01 f8                	add    %edi,%eax
+  801d10:	50                   	push   %eax
+  801d11:	ff 75 08             	push   0x8(%ebp)
+  801d14:	e8 2c ff ff ff       	call   801c45 <read>
+		if (m < 0)
+  801d19:	83 c4 10             	add    $0x10,%esp
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	78 15                	js     801d35 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801d20:	74 11                	je     801d33 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801d22:	01 c3                	add    %eax,%ebx
+  801d24:	89 d8                	mov    %ebx,%eax
+  801d26:	39 f3                	cmp    %esi,%ebx
+  801d28:	72 dc                	jb     801d06 <readn+0x1d>
+  801d2a:	eb 09                	jmp    801d35 <readn+0x4c>
+  801d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d31:	eb 02                	jmp    801d35 <readn+0x4c>
+  801d33:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d38:	5b                   	pop    %ebx
+  801d39:	5e                   	pop    %esi
+  801d3a:	5f                   	pop    %edi
+  801d3b:	5d                   	pop    %ebp
+  801d3c:	c3                   	ret
+
+00801d3d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	56                   	push   %esi
+  801d41:	53                   	push   %ebx
+  801d42:	83 ec 18             	sub    $0x18,%esp
+  801d45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d48:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	53                   	push   %ebx
+  801d4d:	e8 6f fc ff ff       	call   8019c1 <fd_lookup>
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	78 37                	js     801d90 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d59:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d5c:	83 ec 08             	sub    $0x8,%esp
+  801d5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d62:	50                   	push   %eax
+  801d63:	ff 36                	push   (%esi)
+  801d65:	e8 a9 fc ff ff       	call   801a13 <dev_lookup>
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 1f                	js     801d90 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d71:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d75:	74 20                	je     801d97 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	74 54                	je     801dd5 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d81:	83 ec 04             	sub    $0x4,%esp
+  801d84:	ff 75 10             	push   0x10(%ebp)
+  801d87:	ff 75 0c             	push   0xc(%ebp)
+  801d8a:	56                   	push   %esi
+  801d8b:	ff d0                	call   *%eax
+  801d8d:	83 c4 10             	add    $0x10,%esp
+}
+  801d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d93:	5b                   	pop    %ebx
+  801d94:	5e                   	pop    %esi
+  801d95:	5d                   	pop    %ebp
+  801d96:	c3                   	ret
+  801d97:	89 e2                	mov    %esp,%edx
+  801d99:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d9e:	29 d0                	sub    %edx,%eax
+  801da0:	89 c2                	mov    %eax,%edx
+  801da2:	c1 ea 0f             	shr    $0xf,%edx
+  801da5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801daf:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801db2:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801db9:	8b 40 48             	mov    0x48(%eax),%eax
+  801dbc:	83 ec 04             	sub    $0x4,%esp
+  801dbf:	53                   	push   %ebx
+  801dc0:	50                   	push   %eax
+  801dc1:	68 0d 48 80 00       	push   $0x80480d
+  801dc6:	e8 b9 e8 ff ff       	call   800684 <cprintf>
+		return -E_INVAL;
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd3:	eb bb                	jmp    801d90 <write+0x53>
+		return -E_NOT_SUPP;
+  801dd5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dda:	eb b4                	jmp    801d90 <write+0x53>
+
+00801ddc <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ddc:	55                   	push   %ebp
+  801ddd:	89 e5                	mov    %esp,%ebp
+  801ddf:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801de2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de5:	50                   	push   %eax
+  801de6:	ff 75 08             	push   0x8(%ebp)
+  801de9:	e8 d3 fb ff ff       	call   8019c1 <fd_lookup>
+  801dee:	83 c4 10             	add    $0x10,%esp
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 0e                	js     801e03 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801df5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801df8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dfb:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+
+00801e05 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801e05:	55                   	push   %ebp
+  801e06:	89 e5                	mov    %esp,%ebp
+  801e08:	53                   	push   %ebx
+  801e09:	83 ec 1c             	sub    $0x1c,%esp
+  801e0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e12:	50                   	push   %eax
+  801e13:	ff 75 08             	push   0x8(%ebp)
+  801e16:	e8 a6 fb ff ff       	call   8019c1 <fd_lookup>
+  801e1b:	83 c4 10             	add    $0x10,%esp
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	78 33                	js     801e55 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801e22:	83 fb 03             	cmp    $0x3,%ebx
+  801e25:	74 28                	je     801e4f <fcntl+0x4a>
+  801e27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e2c:	83 fb 04             	cmp    $0x4,%ebx
+  801e2f:	75 24                	jne    801e55 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801e31:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801e34:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e37:	80 e4 ef             	and    $0xef,%ah
+  801e3a:	8b 55 10             	mov    0x10(%ebp),%edx
+  801e3d:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801e43:	09 d0                	or     %edx,%eax
+  801e45:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	eb 06                	jmp    801e55 <fcntl+0x50>
+		return fd->fd_omode;
+  801e4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e52:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801e55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+
+00801e5a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e5a:	55                   	push   %ebp
+  801e5b:	89 e5                	mov    %esp,%ebp
+  801e5d:	56                   	push   %esi
+  801e5e:	53                   	push   %ebx
+  801e5f:	83 ec 18             	sub    $0x18,%esp
+  801e62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e65:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e68:	50                   	push   %eax
+  801e69:	53                   	push   %ebx
+  801e6a:	e8 52 fb ff ff       	call   8019c1 <fd_lookup>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	85 c0                	test   %eax,%eax
+  801e74:	78 34                	js     801eaa <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e76:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e79:	83 ec 08             	sub    $0x8,%esp
+  801e7c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e7f:	50                   	push   %eax
+  801e80:	ff 36                	push   (%esi)
+  801e82:	e8 8c fb ff ff       	call   801a13 <dev_lookup>
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 1c                	js     801eaa <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e8e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e92:	74 1d                	je     801eb1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e97:	8b 40 18             	mov    0x18(%eax),%eax
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	74 51                	je     801eef <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e9e:	83 ec 08             	sub    $0x8,%esp
+  801ea1:	ff 75 0c             	push   0xc(%ebp)
+  801ea4:	56                   	push   %esi
+  801ea5:	ff d0                	call   *%eax
+  801ea7:	83 c4 10             	add    $0x10,%esp
+}
+  801eaa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ead:	5b                   	pop    %ebx
+  801eae:	5e                   	pop    %esi
+  801eaf:	5d                   	pop    %ebp
+  801eb0:	c3                   	ret
+  801eb1:	89 e2                	mov    %esp,%edx
+  801eb3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801eb8:	29 d0                	sub    %edx,%eax
+  801eba:	89 c2                	mov    %eax,%edx
+  801ebc:	c1 ea 0f             	shr    $0xf,%edx
+  801ebf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec9:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801ecc:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  801ed3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ed6:	83 ec 04             	sub    $0x4,%esp
+  801ed9:	53                   	push   %ebx
+  801eda:	50                   	push   %eax
+  801edb:	68 d0 47 80 00       	push   $0x8047d0
+  801ee0:	e8 9f e7 ff ff       	call   800684 <cprintf>
+		return -E_INVAL;
+  801ee5:	83 c4 10             	add    $0x10,%esp
+  801ee8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eed:	eb bb                	jmp    801eaa <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801eef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef4:	eb b4                	jmp    801eaa <ftruncate+0x50>
+
+00801ef6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ef6:	55                   	push   %ebp
+  801ef7:	89 e5                	mov    %esp,%ebp
+  801ef9:	56                   	push   %esi
+  801efa:	53                   	push   %ebx
+  801efb:	83 ec 18             	sub    $0x18,%esp
+  801efe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f01:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f04:	50                   	push   %eax
+  801f05:	ff 75 08             	push   0x8(%ebp)
+  801f08:	e8 b4 fa ff ff       	call   8019c1 <fd_lookup>
+  801f0d:	83 c4 10             	add    $0x10,%esp
+  801f10:	85 c0                	test   %eax,%eax
+  801f12:	78 53                	js     801f67 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f14:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f17:	83 ec 08             	sub    $0x8,%esp
+  801f1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1d:	50                   	push   %eax
+  801f1e:	ff 36                	push   (%esi)
+  801f20:	e8 ee fa ff ff       	call   801a13 <dev_lookup>
+  801f25:	83 c4 10             	add    $0x10,%esp
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	78 3b                	js     801f67 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801f2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f2f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f33:	74 39                	je     801f6e <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f35:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f38:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f3f:	00 00 00 
+	stat->st_isdir = 0;
+  801f42:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f49:	00 00 00 
+	stat->st_version = 0;
+  801f4c:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801f53:	00 00 00 
+	stat->st_dev = dev;
+  801f56:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f5c:	83 ec 08             	sub    $0x8,%esp
+  801f5f:	53                   	push   %ebx
+  801f60:	56                   	push   %esi
+  801f61:	ff 50 14             	call   *0x14(%eax)
+  801f64:	83 c4 10             	add    $0x10,%esp
+}
+  801f67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f6a:	5b                   	pop    %ebx
+  801f6b:	5e                   	pop    %esi
+  801f6c:	5d                   	pop    %ebp
+  801f6d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f6e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f73:	eb f2                	jmp    801f67 <fstat+0x71>
+
+00801f75 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	56                   	push   %esi
+  801f79:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f7a:	83 ec 08             	sub    $0x8,%esp
+  801f7d:	6a 00                	push   $0x0
+  801f7f:	ff 75 08             	push   0x8(%ebp)
+  801f82:	e8 b7 01 00 00       	call   80213e <open>
+  801f87:	89 c3                	mov    %eax,%ebx
+  801f89:	83 c4 10             	add    $0x10,%esp
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	78 1b                	js     801fab <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f90:	83 ec 08             	sub    $0x8,%esp
+  801f93:	ff 75 0c             	push   0xc(%ebp)
+  801f96:	50                   	push   %eax
+  801f97:	e8 5a ff ff ff       	call   801ef6 <fstat>
+  801f9c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f9e:	89 1c 24             	mov    %ebx,(%esp)
+  801fa1:	e8 60 fb ff ff       	call   801b06 <close>
+	return r;
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	89 f3                	mov    %esi,%ebx
+}
+  801fab:	89 d8                	mov    %ebx,%eax
+  801fad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb0:	5b                   	pop    %ebx
+  801fb1:	5e                   	pop    %esi
+  801fb2:	5d                   	pop    %ebp
+  801fb3:	c3                   	ret
+
+00801fb4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801fb4:	55                   	push   %ebp
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	56                   	push   %esi
+  801fb8:	53                   	push   %ebx
+  801fb9:	89 c6                	mov    %eax,%esi
+  801fbb:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801fbd:	83 3d 00 98 80 00 00 	cmpl   $0x0,0x809800
+  801fc4:	74 27                	je     801fed <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fc6:	6a 07                	push   $0x7
+  801fc8:	68 00 a0 80 00       	push   $0x80a000
+  801fcd:	56                   	push   %esi
+  801fce:	ff 35 00 98 80 00    	push   0x809800
+  801fd4:	e8 c9 f8 ff ff       	call   8018a2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801fd9:	83 c4 0c             	add    $0xc,%esp
+  801fdc:	6a 00                	push   $0x0
+  801fde:	53                   	push   %ebx
+  801fdf:	6a 00                	push   $0x0
+  801fe1:	e8 2c f6 ff ff       	call   801612 <ipc_recv>
+}
+  801fe6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe9:	5b                   	pop    %ebx
+  801fea:	5e                   	pop    %esi
+  801feb:	5d                   	pop    %ebp
+  801fec:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fed:	83 ec 0c             	sub    $0xc,%esp
+  801ff0:	6a 02                	push   $0x2
+  801ff2:	e8 14 f9 ff ff       	call   80190b <ipc_find_env>
+  801ff7:	a3 00 98 80 00       	mov    %eax,0x809800
+  801ffc:	83 c4 10             	add    $0x10,%esp
+  801fff:	eb c5                	jmp    801fc6 <fsipc+0x12>
+
+00802001 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802001:	55                   	push   %ebp
+  802002:	89 e5                	mov    %esp,%ebp
+  802004:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802007:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80200d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.set_size.req_size = newsize;
+  802012:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802015:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80201a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802024:	e8 8b ff ff ff       	call   801fb4 <fsipc>
+}
+  802029:	c9                   	leave
+  80202a:	c3                   	ret
+
+0080202b <devfile_flush>:
+{
+  80202b:	55                   	push   %ebp
+  80202c:	89 e5                	mov    %esp,%ebp
+  80202e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802031:	8b 45 08             	mov    0x8(%ebp),%eax
+  802034:	8b 40 0c             	mov    0xc(%eax),%eax
+  802037:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80203c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802041:	b8 06 00 00 00       	mov    $0x6,%eax
+  802046:	e8 69 ff ff ff       	call   801fb4 <fsipc>
+}
+  80204b:	c9                   	leave
+  80204c:	c3                   	ret
+
+0080204d <devfile_stat>:
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	53                   	push   %ebx
+  802051:	83 ec 04             	sub    $0x4,%esp
+  802054:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802057:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80205d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802062:	ba 00 00 00 00       	mov    $0x0,%edx
+  802067:	b8 05 00 00 00       	mov    $0x5,%eax
+  80206c:	e8 43 ff ff ff       	call   801fb4 <fsipc>
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 37                	js     8020ac <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802075:	83 ec 08             	sub    $0x8,%esp
+  802078:	68 00 a0 80 00       	push   $0x80a000
+  80207d:	53                   	push   %ebx
+  80207e:	e8 f8 ec ff ff       	call   800d7b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802083:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  802088:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80208e:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  802093:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802099:	a1 88 a0 80 00       	mov    0x80a088,%eax
+  80209e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020af:	c9                   	leave
+  8020b0:	c3                   	ret
+
+008020b1 <devfile_write>:
+{
+  8020b1:	55                   	push   %ebp
+  8020b2:	89 e5                	mov    %esp,%ebp
+  8020b4:	83 ec 0c             	sub    $0xc,%esp
+  8020b7:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8020ba:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8020bf:	39 d0                	cmp    %edx,%eax
+  8020c1:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020c7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020ca:	89 15 00 a0 80 00    	mov    %edx,0x80a000
+	fsipcbuf.write.req_n = count;
+  8020d0:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8020d5:	50                   	push   %eax
+  8020d6:	ff 75 0c             	push   0xc(%ebp)
+  8020d9:	68 08 a0 80 00       	push   $0x80a008
+  8020de:	e8 48 ee ff ff       	call   800f2b <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8020e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020ed:	e8 c2 fe ff ff       	call   801fb4 <fsipc>
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+008020f4 <devfile_read>:
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	53                   	push   %ebx
+  8020f8:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  802101:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.read.req_n = n;
+  802106:	8b 45 10             	mov    0x10(%ebp),%eax
+  802109:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80210e:	ba 00 a0 80 00       	mov    $0x80a000,%edx
+  802113:	b8 03 00 00 00       	mov    $0x3,%eax
+  802118:	e8 97 fe ff ff       	call   801fb4 <fsipc>
+  80211d:	89 c3                	mov    %eax,%ebx
+  80211f:	85 c0                	test   %eax,%eax
+  802121:	78 14                	js     802137 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802123:	83 ec 04             	sub    $0x4,%esp
+  802126:	50                   	push   %eax
+  802127:	68 00 a0 80 00       	push   $0x80a000
+  80212c:	ff 75 0c             	push   0xc(%ebp)
+  80212f:	e8 f7 ed ff ff       	call   800f2b <memmove>
+	return r;
+  802134:	83 c4 10             	add    $0x10,%esp
+}
+  802137:	89 d8                	mov    %ebx,%eax
+  802139:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213c:	c9                   	leave
+  80213d:	c3                   	ret
+
+0080213e <open>:
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	53                   	push   %ebx
+  802142:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802145:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802148:	50                   	push   %eax
+  802149:	e8 23 f8 ff ff       	call   801971 <fd_alloc>
+  80214e:	89 c3                	mov    %eax,%ebx
+  802150:	83 c4 10             	add    $0x10,%esp
+  802153:	85 c0                	test   %eax,%eax
+  802155:	78 2a                	js     802181 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802157:	83 ec 0c             	sub    $0xc,%esp
+  80215a:	ff 75 08             	push   0x8(%ebp)
+  80215d:	e8 cd eb ff ff       	call   800d2f <strlen>
+  802162:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802165:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80216a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80216f:	7e 17                	jle    802188 <open+0x4a>
+	fd_close(fd, 1);
+  802171:	83 ec 08             	sub    $0x8,%esp
+  802174:	6a 01                	push   $0x1
+  802176:	ff 75 f4             	push   -0xc(%ebp)
+  802179:	e8 08 f9 ff ff       	call   801a86 <fd_close>
+	return r;
+  80217e:	83 c4 10             	add    $0x10,%esp
+}
+  802181:	89 d8                	mov    %ebx,%eax
+  802183:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802186:	c9                   	leave
+  802187:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802188:	83 ec 08             	sub    $0x8,%esp
+  80218b:	ff 75 08             	push   0x8(%ebp)
+  80218e:	68 00 a0 80 00       	push   $0x80a000
+  802193:	e8 e3 eb ff ff       	call   800d7b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802198:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80219b:	a3 00 a4 80 00       	mov    %eax,0x80a400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8021a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021a8:	e8 07 fe ff ff       	call   801fb4 <fsipc>
+  8021ad:	89 c3                	mov    %eax,%ebx
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	85 c0                	test   %eax,%eax
+  8021b4:	78 bb                	js     802171 <open+0x33>
+	return fd2num(fd); 	
+  8021b6:	83 ec 0c             	sub    $0xc,%esp
+  8021b9:	ff 75 f4             	push   -0xc(%ebp)
+  8021bc:	e8 89 f7 ff ff       	call   80194a <fd2num>
+  8021c1:	89 c3                	mov    %eax,%ebx
+  8021c3:	83 c4 10             	add    $0x10,%esp
+  8021c6:	eb b9                	jmp    802181 <open+0x43>
+
+008021c8 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8021c8:	55                   	push   %ebp
+  8021c9:	89 e5                	mov    %esp,%ebp
+  8021cb:	53                   	push   %ebx
+  8021cc:	83 ec 1c             	sub    $0x1c,%esp
+  8021cf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d5:	50                   	push   %eax
+  8021d6:	ff 75 08             	push   0x8(%ebp)
+  8021d9:	e8 e3 f7 ff ff       	call   8019c1 <fd_lookup>
+  8021de:	83 c4 10             	add    $0x10,%esp
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	78 5a                	js     80223f <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8021e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e8:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8021ee:	39 10                	cmp    %edx,(%eax)
+  8021f0:	75 66                	jne    802258 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8021f2:	83 3d 00 98 80 00 00 	cmpl   $0x0,0x809800
+  8021f9:	74 49                	je     802244 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  802201:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.map.req_offset = offset;
+  802206:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802209:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	fsipcbuf.map.req_npages = maxpages;
+  80220e:	89 1d 08 a0 80 00    	mov    %ebx,0x80a008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802214:	6a 07                	push   $0x7
+  802216:	68 00 a0 80 00       	push   $0x80a000
+  80221b:	6a 09                	push   $0x9
+  80221d:	ff 35 00 98 80 00    	push   0x809800
+  802223:	e8 7a f6 ff ff       	call   8018a2 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802228:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80222f:	6a 00                	push   $0x0
+  802231:	53                   	push   %ebx
+  802232:	ff 75 10             	push   0x10(%ebp)
+  802235:	6a 00                	push   $0x0
+  802237:	e8 a3 f4 ff ff       	call   8016df <ipc_recv_pages>
+  80223c:	83 c4 20             	add    $0x20,%esp
+}
+  80223f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802242:	c9                   	leave
+  802243:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802244:	83 ec 0c             	sub    $0xc,%esp
+  802247:	6a 02                	push   $0x2
+  802249:	e8 bd f6 ff ff       	call   80190b <ipc_find_env>
+  80224e:	a3 00 98 80 00       	mov    %eax,0x809800
+  802253:	83 c4 10             	add    $0x10,%esp
+  802256:	eb a3                	jmp    8021fb <fmap+0x33>
+		return -E_INVAL;
+  802258:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80225d:	eb e0                	jmp    80223f <fmap+0x77>
+
+0080225f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80225f:	55                   	push   %ebp
+  802260:	89 e5                	mov    %esp,%ebp
+  802262:	53                   	push   %ebx
+  802263:	83 ec 10             	sub    $0x10,%esp
+  802266:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802269:	53                   	push   %ebx
+  80226a:	e8 c0 ea ff ff       	call   800d2f <strlen>
+  80226f:	83 c4 10             	add    $0x10,%esp
+  802272:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802277:	7f 25                	jg     80229e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802279:	83 ec 08             	sub    $0x8,%esp
+  80227c:	53                   	push   %ebx
+  80227d:	68 00 a0 80 00       	push   $0x80a000
+  802282:	e8 f4 ea ff ff       	call   800d7b <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802291:	e8 1e fd ff ff       	call   801fb4 <fsipc>
+  802296:	83 c4 10             	add    $0x10,%esp
+}
+  802299:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+		return -E_BAD_PATH;
+  80229e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022a3:	eb f4                	jmp    802299 <remove+0x3a>
+
+008022a5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8022ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8022b5:	e8 fa fc ff ff       	call   801fb4 <fsipc>
+}
+  8022ba:	c9                   	leave
+  8022bb:	c3                   	ret
+
+008022bc <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022bc:	55                   	push   %ebp
+  8022bd:	89 e5                	mov    %esp,%ebp
+  8022bf:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8022c2:	68 40 48 80 00       	push   $0x804840
+  8022c7:	ff 75 0c             	push   0xc(%ebp)
+  8022ca:	e8 ac ea ff ff       	call   800d7b <strcpy>
+	return 0;
+}
+  8022cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d4:	c9                   	leave
+  8022d5:	c3                   	ret
+
+008022d6 <devsock_close>:
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	53                   	push   %ebx
+  8022da:	83 ec 10             	sub    $0x10,%esp
+  8022dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8022e0:	53                   	push   %ebx
+  8022e1:	e8 82 1a 00 00       	call   803d68 <pageref>
+  8022e6:	89 c2                	mov    %eax,%edx
+  8022e8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8022eb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8022f0:	83 fa 01             	cmp    $0x1,%edx
+  8022f3:	74 05                	je     8022fa <devsock_close+0x24>
+}
+  8022f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022f8:	c9                   	leave
+  8022f9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8022fa:	83 ec 0c             	sub    $0xc,%esp
+  8022fd:	ff 73 0c             	push   0xc(%ebx)
+  802300:	e8 b0 05 00 00       	call   8028b5 <nsipc_close>
+  802305:	83 c4 10             	add    $0x10,%esp
+  802308:	eb eb                	jmp    8022f5 <devsock_close+0x1f>
+
+0080230a <devsock_write>:
+{
+  80230a:	55                   	push   %ebp
+  80230b:	89 e5                	mov    %esp,%ebp
+  80230d:	53                   	push   %ebx
+  80230e:	83 ec 14             	sub    $0x14,%esp
+  802311:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802314:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802317:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80231a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80231d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802320:	8b 41 08             	mov    0x8(%ecx),%eax
+  802323:	c1 f8 09             	sar    $0x9,%eax
+  802326:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802329:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80232f:	77 13                	ja     802344 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802331:	50                   	push   %eax
+  802332:	52                   	push   %edx
+  802333:	53                   	push   %ebx
+  802334:	ff 71 0c             	push   0xc(%ecx)
+  802337:	e8 5c 06 00 00       	call   802998 <nsipc_send>
+  80233c:	83 c4 10             	add    $0x10,%esp
+}
+  80233f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802342:	c9                   	leave
+  802343:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802344:	50                   	push   %eax
+  802345:	6a 01                	push   $0x1
+  802347:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80234a:	50                   	push   %eax
+  80234b:	ff 71 0c             	push   0xc(%ecx)
+  80234e:	e8 a6 06 00 00       	call   8029f9 <nsipc_sendmsg>
+  802353:	83 c4 10             	add    $0x10,%esp
+  802356:	eb e7                	jmp    80233f <devsock_write+0x35>
+
+00802358 <devsock_read>:
+{
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	53                   	push   %ebx
+  80235c:	83 ec 14             	sub    $0x14,%esp
+  80235f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802362:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802365:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802368:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80236b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80236e:	8b 41 08             	mov    0x8(%ecx),%eax
+  802371:	c1 f8 09             	sar    $0x9,%eax
+  802374:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802377:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80237d:	77 13                	ja     802392 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80237f:	50                   	push   %eax
+  802380:	52                   	push   %edx
+  802381:	53                   	push   %ebx
+  802382:	ff 71 0c             	push   0xc(%ecx)
+  802385:	e8 9c 05 00 00       	call   802926 <nsipc_recv>
+  80238a:	83 c4 10             	add    $0x10,%esp
+}
+  80238d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802390:	c9                   	leave
+  802391:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802392:	50                   	push   %eax
+  802393:	6a 01                	push   $0x1
+  802395:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802398:	50                   	push   %eax
+  802399:	ff 71 0c             	push   0xc(%ecx)
+  80239c:	e8 02 0a 00 00       	call   802da3 <nsipc_recvmsg>
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	eb e7                	jmp    80238d <devsock_read+0x35>
+
+008023a6 <fd2sockid>:
+{
+  8023a6:	55                   	push   %ebp
+  8023a7:	89 e5                	mov    %esp,%ebp
+  8023a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8023ac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023af:	52                   	push   %edx
+  8023b0:	50                   	push   %eax
+  8023b1:	e8 0b f6 ff ff       	call   8019c1 <fd_lookup>
+  8023b6:	83 c4 10             	add    $0x10,%esp
+  8023b9:	85 c0                	test   %eax,%eax
+  8023bb:	78 10                	js     8023cd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8023bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c0:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8023c6:	39 08                	cmp    %ecx,(%eax)
+  8023c8:	75 05                	jne    8023cf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8023ca:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8023cd:	c9                   	leave
+  8023ce:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023cf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023d4:	eb f7                	jmp    8023cd <fd2sockid+0x27>
+
+008023d6 <sock_flags>:
+{
+  8023d6:	55                   	push   %ebp
+  8023d7:	89 e5                	mov    %esp,%ebp
+  8023d9:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8023dc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023df:	52                   	push   %edx
+  8023e0:	50                   	push   %eax
+  8023e1:	e8 db f5 ff ff       	call   8019c1 <fd_lookup>
+  8023e6:	83 c4 10             	add    $0x10,%esp
+  8023e9:	85 c0                	test   %eax,%eax
+  8023eb:	78 0e                	js     8023fb <sock_flags+0x25>
+  8023ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f0:	8b 40 08             	mov    0x8(%eax),%eax
+  8023f3:	c1 e8 09             	shr    $0x9,%eax
+  8023f6:	83 e0 08             	and    $0x8,%eax
+}
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+		return 0;
+  8023fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802400:	eb f7                	jmp    8023f9 <sock_flags+0x23>
+
+00802402 <alloc_sockfd>:
+{
+  802402:	55                   	push   %ebp
+  802403:	89 e5                	mov    %esp,%ebp
+  802405:	56                   	push   %esi
+  802406:	53                   	push   %ebx
+  802407:	83 ec 1c             	sub    $0x1c,%esp
+  80240a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80240c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80240f:	50                   	push   %eax
+  802410:	e8 5c f5 ff ff       	call   801971 <fd_alloc>
+  802415:	89 c3                	mov    %eax,%ebx
+  802417:	83 c4 10             	add    $0x10,%esp
+  80241a:	85 c0                	test   %eax,%eax
+  80241c:	78 43                	js     802461 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80241e:	83 ec 04             	sub    $0x4,%esp
+  802421:	68 07 04 00 00       	push   $0x407
+  802426:	ff 75 f4             	push   -0xc(%ebp)
+  802429:	6a 00                	push   $0x0
+  80242b:	e8 7f ed ff ff       	call   8011af <sys_page_alloc>
+  802430:	89 c3                	mov    %eax,%ebx
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	85 c0                	test   %eax,%eax
+  802437:	78 28                	js     802461 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80243c:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802442:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802444:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802447:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80244e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802451:	83 ec 0c             	sub    $0xc,%esp
+  802454:	50                   	push   %eax
+  802455:	e8 f0 f4 ff ff       	call   80194a <fd2num>
+  80245a:	89 c3                	mov    %eax,%ebx
+  80245c:	83 c4 10             	add    $0x10,%esp
+  80245f:	eb 0c                	jmp    80246d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802461:	83 ec 0c             	sub    $0xc,%esp
+  802464:	56                   	push   %esi
+  802465:	e8 4b 04 00 00       	call   8028b5 <nsipc_close>
+		return r;
+  80246a:	83 c4 10             	add    $0x10,%esp
+}
+  80246d:	89 d8                	mov    %ebx,%eax
+  80246f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802472:	5b                   	pop    %ebx
+  802473:	5e                   	pop    %esi
+  802474:	5d                   	pop    %ebp
+  802475:	c3                   	ret
+
+00802476 <accept>:
+{
+  802476:	55                   	push   %ebp
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	56                   	push   %esi
+  80247a:	53                   	push   %ebx
+  80247b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80247e:	89 f0                	mov    %esi,%eax
+  802480:	e8 21 ff ff ff       	call   8023a6 <fd2sockid>
+  802485:	89 c3                	mov    %eax,%ebx
+  802487:	85 c0                	test   %eax,%eax
+  802489:	78 24                	js     8024af <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80248b:	89 f0                	mov    %esi,%eax
+  80248d:	e8 44 ff ff ff       	call   8023d6 <sock_flags>
+  802492:	50                   	push   %eax
+  802493:	ff 75 10             	push   0x10(%ebp)
+  802496:	ff 75 0c             	push   0xc(%ebp)
+  802499:	53                   	push   %ebx
+  80249a:	e8 6b 03 00 00       	call   80280a <nsipc_accept>
+  80249f:	89 c3                	mov    %eax,%ebx
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	78 07                	js     8024af <accept+0x39>
+	return alloc_sockfd(r);
+  8024a8:	e8 55 ff ff ff       	call   802402 <alloc_sockfd>
+  8024ad:	89 c3                	mov    %eax,%ebx
+}
+  8024af:	89 d8                	mov    %ebx,%eax
+  8024b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024b4:	5b                   	pop    %ebx
+  8024b5:	5e                   	pop    %esi
+  8024b6:	5d                   	pop    %ebp
+  8024b7:	c3                   	ret
+
+008024b8 <bind>:
+{
+  8024b8:	55                   	push   %ebp
+  8024b9:	89 e5                	mov    %esp,%ebp
+  8024bb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c1:	e8 e0 fe ff ff       	call   8023a6 <fd2sockid>
+  8024c6:	85 c0                	test   %eax,%eax
+  8024c8:	78 12                	js     8024dc <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8024ca:	83 ec 04             	sub    $0x4,%esp
+  8024cd:	ff 75 10             	push   0x10(%ebp)
+  8024d0:	ff 75 0c             	push   0xc(%ebp)
+  8024d3:	50                   	push   %eax
+  8024d4:	e8 85 03 00 00       	call   80285e <nsipc_bind>
+  8024d9:	83 c4 10             	add    $0x10,%esp
+}
+  8024dc:	c9                   	leave
+  8024dd:	c3                   	ret
+
+008024de <shutdown>:
+{
+  8024de:	55                   	push   %ebp
+  8024df:	89 e5                	mov    %esp,%ebp
+  8024e1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e7:	e8 ba fe ff ff       	call   8023a6 <fd2sockid>
+  8024ec:	85 c0                	test   %eax,%eax
+  8024ee:	78 0f                	js     8024ff <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8024f0:	83 ec 08             	sub    $0x8,%esp
+  8024f3:	ff 75 0c             	push   0xc(%ebp)
+  8024f6:	50                   	push   %eax
+  8024f7:	e8 97 03 00 00       	call   802893 <nsipc_shutdown>
+  8024fc:	83 c4 10             	add    $0x10,%esp
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+00802501 <connect>:
+{
+  802501:	55                   	push   %ebp
+  802502:	89 e5                	mov    %esp,%ebp
+  802504:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802507:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250a:	e8 97 fe ff ff       	call   8023a6 <fd2sockid>
+  80250f:	85 c0                	test   %eax,%eax
+  802511:	78 12                	js     802525 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802513:	83 ec 04             	sub    $0x4,%esp
+  802516:	ff 75 10             	push   0x10(%ebp)
+  802519:	ff 75 0c             	push   0xc(%ebp)
+  80251c:	50                   	push   %eax
+  80251d:	e8 ad 03 00 00       	call   8028cf <nsipc_connect>
+  802522:	83 c4 10             	add    $0x10,%esp
+}
+  802525:	c9                   	leave
+  802526:	c3                   	ret
+
+00802527 <listen>:
+{
+  802527:	55                   	push   %ebp
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80252d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802530:	e8 71 fe ff ff       	call   8023a6 <fd2sockid>
+  802535:	85 c0                	test   %eax,%eax
+  802537:	78 0f                	js     802548 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802539:	83 ec 08             	sub    $0x8,%esp
+  80253c:	ff 75 0c             	push   0xc(%ebp)
+  80253f:	50                   	push   %eax
+  802540:	e8 bf 03 00 00       	call   802904 <nsipc_listen>
+  802545:	83 c4 10             	add    $0x10,%esp
+}
+  802548:	c9                   	leave
+  802549:	c3                   	ret
+
+0080254a <sendmsg>:
+{
+  80254a:	55                   	push   %ebp
+  80254b:	89 e5                	mov    %esp,%ebp
+  80254d:	57                   	push   %edi
+  80254e:	56                   	push   %esi
+  80254f:	53                   	push   %ebx
+  802550:	83 ec 0c             	sub    $0xc,%esp
+  802553:	8b 75 08             	mov    0x8(%ebp),%esi
+  802556:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802559:	89 f0                	mov    %esi,%eax
+  80255b:	e8 46 fe ff ff       	call   8023a6 <fd2sockid>
+  802560:	89 c3                	mov    %eax,%ebx
+  802562:	85 c0                	test   %eax,%eax
+  802564:	78 1c                	js     802582 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802566:	89 f0                	mov    %esi,%eax
+  802568:	e8 69 fe ff ff       	call   8023d6 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80256d:	0b 45 10             	or     0x10(%ebp),%eax
+  802570:	50                   	push   %eax
+  802571:	ff 77 0c             	push   0xc(%edi)
+  802574:	ff 77 08             	push   0x8(%edi)
+  802577:	53                   	push   %ebx
+  802578:	e8 7c 04 00 00       	call   8029f9 <nsipc_sendmsg>
+  80257d:	89 c3                	mov    %eax,%ebx
+  80257f:	83 c4 10             	add    $0x10,%esp
+}
+  802582:	89 d8                	mov    %ebx,%eax
+  802584:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802587:	5b                   	pop    %ebx
+  802588:	5e                   	pop    %esi
+  802589:	5f                   	pop    %edi
+  80258a:	5d                   	pop    %ebp
+  80258b:	c3                   	ret
+
+0080258c <recvmsg>:
+{
+  80258c:	55                   	push   %ebp
+  80258d:	89 e5                	mov    %esp,%ebp
+  80258f:	57                   	push   %edi
+  802590:	56                   	push   %esi
+  802591:	53                   	push   %ebx
+  802592:	83 ec 0c             	sub    $0xc,%esp
+  802595:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802598:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80259b:	89 f8                	mov    %edi,%eax
+  80259d:	e8 04 fe ff ff       	call   8023a6 <fd2sockid>
+  8025a2:	89 c3                	mov    %eax,%ebx
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	78 2a                	js     8025d2 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8025a8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8025af:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8025b6:	89 f8                	mov    %edi,%eax
+  8025b8:	e8 19 fe ff ff       	call   8023d6 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8025bd:	0b 45 10             	or     0x10(%ebp),%eax
+  8025c0:	50                   	push   %eax
+  8025c1:	ff 76 0c             	push   0xc(%esi)
+  8025c4:	ff 76 08             	push   0x8(%esi)
+  8025c7:	53                   	push   %ebx
+  8025c8:	e8 d6 07 00 00       	call   802da3 <nsipc_recvmsg>
+  8025cd:	89 c3                	mov    %eax,%ebx
+  8025cf:	83 c4 10             	add    $0x10,%esp
+}
+  8025d2:	89 d8                	mov    %ebx,%eax
+  8025d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d7:	5b                   	pop    %ebx
+  8025d8:	5e                   	pop    %esi
+  8025d9:	5f                   	pop    %edi
+  8025da:	5d                   	pop    %ebp
+  8025db:	c3                   	ret
+
+008025dc <sendfile>:
+{
+  8025dc:	55                   	push   %ebp
+  8025dd:	89 e5                	mov    %esp,%ebp
+  8025df:	56                   	push   %esi
+  8025e0:	53                   	push   %ebx
+  8025e1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8025e4:	89 f0                	mov    %esi,%eax
+  8025e6:	e8 bb fd ff ff       	call   8023a6 <fd2sockid>
+  8025eb:	89 c3                	mov    %eax,%ebx
+  8025ed:	85 c0                	test   %eax,%eax
+  8025ef:	78 1f                	js     802610 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8025f1:	89 f0                	mov    %esi,%eax
+  8025f3:	e8 de fd ff ff       	call   8023d6 <sock_flags>
+  8025f8:	83 ec 0c             	sub    $0xc,%esp
+  8025fb:	50                   	push   %eax
+  8025fc:	ff 75 14             	push   0x14(%ebp)
+  8025ff:	ff 75 10             	push   0x10(%ebp)
+  802602:	ff 75 0c             	push   0xc(%ebp)
+  802605:	53                   	push   %ebx
+  802606:	e8 64 06 00 00       	call   802c6f <nsipc_sendfile>
+  80260b:	89 c3                	mov    %eax,%ebx
+  80260d:	83 c4 20             	add    $0x20,%esp
+}
+  802610:	89 d8                	mov    %ebx,%eax
+  802612:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802615:	5b                   	pop    %ebx
+  802616:	5e                   	pop    %esi
+  802617:	5d                   	pop    %ebp
+  802618:	c3                   	ret
+
+00802619 <evctl>:
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+  80261c:	53                   	push   %ebx
+  80261d:	83 ec 04             	sub    $0x4,%esp
+  802620:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802623:	89 d8                	mov    %ebx,%eax
+  802625:	e8 7c fd ff ff       	call   8023a6 <fd2sockid>
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	78 10                	js     80263e <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80262e:	83 ec 04             	sub    $0x4,%esp
+  802631:	53                   	push   %ebx
+  802632:	ff 75 0c             	push   0xc(%ebp)
+  802635:	50                   	push   %eax
+  802636:	e8 d2 0b 00 00       	call   80320d <nsipc_evctl>
+  80263b:	83 c4 10             	add    $0x10,%esp
+}
+  80263e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802641:	c9                   	leave
+  802642:	c3                   	ret
+
+00802643 <evwait>:
+{
+  802643:	55                   	push   %ebp
+  802644:	89 e5                	mov    %esp,%ebp
+  802646:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802649:	ff 75 10             	push   0x10(%ebp)
+  80264c:	ff 75 0c             	push   0xc(%ebp)
+  80264f:	ff 75 08             	push   0x8(%ebp)
+  802652:	e8 e0 0b 00 00       	call   803237 <nsipc_evwait>
+}
+  802657:	c9                   	leave
+  802658:	c3                   	ret
+
+00802659 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802659:	55                   	push   %ebp
+  80265a:	89 e5                	mov    %esp,%ebp
+  80265c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80265f:	ff 75 10             	push   0x10(%ebp)
+  802662:	ff 75 0c             	push   0xc(%ebp)
+  802665:	ff 75 08             	push   0x8(%ebp)
+  802668:	e8 31 0c 00 00       	call   80329e <nsipc_socket>
+  80266d:	83 c4 10             	add    $0x10,%esp
+  802670:	85 c0                	test   %eax,%eax
+  802672:	78 05                	js     802679 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802674:	e8 89 fd ff ff       	call   802402 <alloc_sockfd>
+}
+  802679:	c9                   	leave
+  80267a:	c3                   	ret
+
+0080267b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	53                   	push   %ebx
+  80267f:	83 ec 04             	sub    $0x4,%esp
+  802682:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802684:	83 3d 24 9b 80 00 00 	cmpl   $0x0,0x809b24
+  80268b:	74 26                	je     8026b3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80268d:	6a 07                	push   $0x7
+  80268f:	68 00 b0 80 00       	push   $0x80b000
+  802694:	53                   	push   %ebx
+  802695:	ff 35 24 9b 80 00    	push   0x809b24
+  80269b:	e8 02 f2 ff ff       	call   8018a2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8026a0:	83 c4 0c             	add    $0xc,%esp
+  8026a3:	6a 00                	push   $0x0
+  8026a5:	6a 00                	push   $0x0
+  8026a7:	6a 00                	push   $0x0
+  8026a9:	e8 64 ef ff ff       	call   801612 <ipc_recv>
+}
+  8026ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8026b3:	83 ec 0c             	sub    $0xc,%esp
+  8026b6:	6a 03                	push   $0x3
+  8026b8:	e8 4e f2 ff ff       	call   80190b <ipc_find_env>
+  8026bd:	a3 24 9b 80 00       	mov    %eax,0x809b24
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	eb c6                	jmp    80268d <nsipc+0x12>
+
+008026c7 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8026c7:	55                   	push   %ebp
+  8026c8:	89 e5                	mov    %esp,%ebp
+  8026ca:	56                   	push   %esi
+  8026cb:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8026cc:	8b 35 30 9b 80 00    	mov    0x809b30,%esi
+		return 0;
+  8026d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8026d7:	85 f6                	test   %esi,%esi
+  8026d9:	75 33                	jne    80270e <nsbulk_map+0x47>
+  8026db:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8026e0:	83 ec 04             	sub    $0x4,%esp
+  8026e3:	6a 07                	push   $0x7
+  8026e5:	53                   	push   %ebx
+  8026e6:	6a 00                	push   $0x0
+  8026e8:	e8 c2 ea ff ff       	call   8011af <sys_page_alloc>
+  8026ed:	83 c4 10             	add    $0x10,%esp
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	78 1a                	js     80270e <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8026f4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026fa:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802700:	75 de                	jne    8026e0 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802702:	c7 05 30 9b 80 00 01 	movl   $0x1,0x809b30
+  802709:	00 00 00 
+	return 0;
+  80270c:	89 f0                	mov    %esi,%eax
+}
+  80270e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802711:	5b                   	pop    %ebx
+  802712:	5e                   	pop    %esi
+  802713:	5d                   	pop    %ebp
+  802714:	c3                   	ret
+
+00802715 <nsbulk_own>:
+{
+  802715:	55                   	push   %ebp
+  802716:	89 e5                	mov    %esp,%ebp
+  802718:	57                   	push   %edi
+  802719:	56                   	push   %esi
+  80271a:	53                   	push   %ebx
+  80271b:	83 ec 0c             	sub    $0xc,%esp
+  80271e:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802720:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802723:	85 d2                	test   %edx,%edx
+  802725:	7f 0e                	jg     802735 <nsbulk_own+0x20>
+	return 0;
+  802727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272c:	eb 47                	jmp    802775 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80272e:	83 c3 01             	add    $0x1,%ebx
+  802731:	39 fb                	cmp    %edi,%ebx
+  802733:	7d 3b                	jge    802770 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802735:	be 01 00 00 00       	mov    $0x1,%esi
+  80273a:	89 d9                	mov    %ebx,%ecx
+  80273c:	d3 e6                	shl    %cl,%esi
+  80273e:	89 f0                	mov    %esi,%eax
+  802740:	23 05 2c 9b 80 00    	and    0x809b2c,%eax
+  802746:	74 e6                	je     80272e <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802748:	83 ec 04             	sub    $0x4,%esp
+  80274b:	6a 07                	push   $0x7
+  80274d:	89 d8                	mov    %ebx,%eax
+  80274f:	c1 e0 0c             	shl    $0xc,%eax
+  802752:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802757:	50                   	push   %eax
+  802758:	6a 00                	push   $0x0
+  80275a:	e8 50 ea ff ff       	call   8011af <sys_page_alloc>
+  80275f:	83 c4 10             	add    $0x10,%esp
+  802762:	85 c0                	test   %eax,%eax
+  802764:	78 0f                	js     802775 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802766:	f7 d6                	not    %esi
+  802768:	21 35 2c 9b 80 00    	and    %esi,0x809b2c
+  80276e:	eb be                	jmp    80272e <nsbulk_own+0x19>
+	return 0;
+  802770:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802778:	5b                   	pop    %ebx
+  802779:	5e                   	pop    %esi
+  80277a:	5f                   	pop    %edi
+  80277b:	5d                   	pop    %ebp
+  80277c:	c3                   	ret
+
+0080277d <nsipc_bulk>:
+{
+  80277d:	55                   	push   %ebp
+  80277e:	89 e5                	mov    %esp,%ebp
+  802780:	57                   	push   %edi
+  802781:	56                   	push   %esi
+  802782:	53                   	push   %ebx
+  802783:	83 ec 1c             	sub    $0x1c,%esp
+  802786:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802789:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80278b:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802791:	c1 fb 0c             	sar    $0xc,%ebx
+  802794:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802797:	83 3d 24 9b 80 00 00 	cmpl   $0x0,0x809b24
+  80279e:	74 56                	je     8027f6 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8027a0:	85 ff                	test   %edi,%edi
+  8027a2:	7e 24                	jle    8027c8 <nsipc_bulk+0x4b>
+  8027a4:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8027aa:	74 1c                	je     8027c8 <nsipc_bulk+0x4b>
+  8027ac:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8027b2:	c1 e3 0c             	shl    $0xc,%ebx
+  8027b5:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8027ba:	0f b6 10             	movzbl (%eax),%edx
+  8027bd:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8027bf:	05 00 10 00 00       	add    $0x1000,%eax
+  8027c4:	39 d8                	cmp    %ebx,%eax
+  8027c6:	75 f2                	jne    8027ba <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8027c8:	83 ec 0c             	sub    $0xc,%esp
+  8027cb:	56                   	push   %esi
+  8027cc:	57                   	push   %edi
+  8027cd:	68 00 00 00 e0       	push   $0xe0000000
+  8027d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8027d5:	ff 35 24 9b 80 00    	push   0x809b24
+  8027db:	e8 f6 f0 ff ff       	call   8018d6 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8027e0:	83 c4 1c             	add    $0x1c,%esp
+  8027e3:	6a 00                	push   $0x0
+  8027e5:	6a 00                	push   $0x0
+  8027e7:	6a 00                	push   $0x0
+  8027e9:	e8 24 ee ff ff       	call   801612 <ipc_recv>
+}
+  8027ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f1:	5b                   	pop    %ebx
+  8027f2:	5e                   	pop    %esi
+  8027f3:	5f                   	pop    %edi
+  8027f4:	5d                   	pop    %ebp
+  8027f5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8027f6:	83 ec 0c             	sub    $0xc,%esp
+  8027f9:	6a 03                	push   $0x3
+  8027fb:	e8 0b f1 ff ff       	call   80190b <ipc_find_env>
+  802800:	a3 24 9b 80 00       	mov    %eax,0x809b24
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	eb 96                	jmp    8027a0 <nsipc_bulk+0x23>
+
+0080280a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  80280a:	55                   	push   %ebp
+  80280b:	89 e5                	mov    %esp,%ebp
+  80280d:	53                   	push   %ebx
+  80280e:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802811:	8b 45 08             	mov    0x8(%ebp),%eax
+  802814:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_flags = flags;
+  802819:	8b 45 14             	mov    0x14(%ebp),%eax
+  80281c:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802821:	b8 01 00 00 00       	mov    $0x1,%eax
+  802826:	e8 50 fe ff ff       	call   80267b <nsipc>
+  80282b:	89 c3                	mov    %eax,%ebx
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	79 07                	jns    802838 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802831:	89 d8                	mov    %ebx,%eax
+  802833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802836:	c9                   	leave
+  802837:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802838:	83 ec 04             	sub    $0x4,%esp
+  80283b:	ff 35 10 b0 80 00    	push   0x80b010
+  802841:	68 00 b0 80 00       	push   $0x80b000
+  802846:	ff 75 0c             	push   0xc(%ebp)
+  802849:	e8 dd e6 ff ff       	call   800f2b <memmove>
+		*addrlen = ret->ret_addrlen;
+  80284e:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  802854:	8b 45 10             	mov    0x10(%ebp),%eax
+  802857:	89 10                	mov    %edx,(%eax)
+  802859:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80285c:	eb d3                	jmp    802831 <nsipc_accept+0x27>
+
+0080285e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80285e:	55                   	push   %ebp
+  80285f:	89 e5                	mov    %esp,%ebp
+  802861:	53                   	push   %ebx
+  802862:	83 ec 08             	sub    $0x8,%esp
+  802865:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802868:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802870:	53                   	push   %ebx
+  802871:	ff 75 0c             	push   0xc(%ebp)
+  802874:	68 04 b0 80 00       	push   $0x80b004
+  802879:	e8 ad e6 ff ff       	call   800f2b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80287e:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  802884:	b8 02 00 00 00       	mov    $0x2,%eax
+  802889:	e8 ed fd ff ff       	call   80267b <nsipc>
+}
+  80288e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802891:	c9                   	leave
+  802892:	c3                   	ret
+
+00802893 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289c:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  8028a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028a4:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  8028a9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028ae:	e8 c8 fd ff ff       	call   80267b <nsipc>
+}
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+008028b5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8028bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028be:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  8028c3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028c8:	e8 ae fd ff ff       	call   80267b <nsipc>
+}
+  8028cd:	c9                   	leave
+  8028ce:	c3                   	ret
+
+008028cf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	53                   	push   %ebx
+  8028d3:	83 ec 08             	sub    $0x8,%esp
+  8028d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8028d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028dc:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8028e1:	53                   	push   %ebx
+  8028e2:	ff 75 0c             	push   0xc(%ebp)
+  8028e5:	68 04 b0 80 00       	push   $0x80b004
+  8028ea:	e8 3c e6 ff ff       	call   800f2b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8028ef:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  8028f5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8028fa:	e8 7c fd ff ff       	call   80267b <nsipc>
+}
+  8028ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802902:	c9                   	leave
+  802903:	c3                   	ret
+
+00802904 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802904:	55                   	push   %ebp
+  802905:	89 e5                	mov    %esp,%ebp
+  802907:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80290a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290d:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  802912:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802915:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  80291a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80291f:	e8 57 fd ff ff       	call   80267b <nsipc>
+}
+  802924:	c9                   	leave
+  802925:	c3                   	ret
+
+00802926 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802926:	55                   	push   %ebp
+  802927:	89 e5                	mov    %esp,%ebp
+  802929:	56                   	push   %esi
+  80292a:	53                   	push   %ebx
+  80292b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80292e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802931:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  802936:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  80293c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80293f:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802944:	b8 07 00 00 00       	mov    $0x7,%eax
+  802949:	e8 2d fd ff ff       	call   80267b <nsipc>
+  80294e:	89 c3                	mov    %eax,%ebx
+  802950:	85 c0                	test   %eax,%eax
+  802952:	78 22                	js     802976 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802954:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802959:	39 c6                	cmp    %eax,%esi
+  80295b:	0f 4e c6             	cmovle %esi,%eax
+  80295e:	39 c3                	cmp    %eax,%ebx
+  802960:	7f 1d                	jg     80297f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802962:	83 ec 04             	sub    $0x4,%esp
+  802965:	53                   	push   %ebx
+  802966:	68 00 b0 80 00       	push   $0x80b000
+  80296b:	ff 75 0c             	push   0xc(%ebp)
+  80296e:	e8 b8 e5 ff ff       	call   800f2b <memmove>
+  802973:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802976:	89 d8                	mov    %ebx,%eax
+  802978:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80297b:	5b                   	pop    %ebx
+  80297c:	5e                   	pop    %esi
+  80297d:	5d                   	pop    %ebp
+  80297e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80297f:	68 4c 48 80 00       	push   $0x80484c
+  802984:	68 61 48 80 00       	push   $0x804861
+  802989:	68 b2 00 00 00       	push   $0xb2
+  80298e:	68 76 48 80 00       	push   $0x804876
+  802993:	e8 8a 13 00 00       	call   803d22 <_panic>
+
+00802998 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802998:	55                   	push   %ebp
+  802999:	89 e5                	mov    %esp,%ebp
+  80299b:	53                   	push   %ebx
+  80299c:	83 ec 04             	sub    $0x4,%esp
+  80299f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8029a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a5:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  8029aa:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8029b0:	7f 2e                	jg     8029e0 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8029b2:	83 ec 04             	sub    $0x4,%esp
+  8029b5:	53                   	push   %ebx
+  8029b6:	ff 75 0c             	push   0xc(%ebp)
+  8029b9:	68 0c b0 80 00       	push   $0x80b00c
+  8029be:	e8 68 e5 ff ff       	call   800f2b <memmove>
+	nsipcbuf.send.req_size = size;
+  8029c3:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  8029c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029cc:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  8029d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029d6:	e8 a0 fc ff ff       	call   80267b <nsipc>
+}
+  8029db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029de:	c9                   	leave
+  8029df:	c3                   	ret
+	assert(size < 1600);
+  8029e0:	68 82 48 80 00       	push   $0x804882
+  8029e5:	68 61 48 80 00       	push   $0x804861
+  8029ea:	68 bd 00 00 00       	push   $0xbd
+  8029ef:	68 76 48 80 00       	push   $0x804876
+  8029f4:	e8 29 13 00 00       	call   803d22 <_panic>
+
+008029f9 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8029f9:	55                   	push   %ebp
+  8029fa:	89 e5                	mov    %esp,%ebp
+  8029fc:	57                   	push   %edi
+  8029fd:	56                   	push   %esi
+  8029fe:	53                   	push   %ebx
+  8029ff:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802a02:	e8 c0 fc ff ff       	call   8026c7 <nsbulk_map>
+  802a07:	85 c0                	test   %eax,%eax
+  802a09:	78 55                	js     802a60 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802a0b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802a12:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802a19:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802a20:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a23:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a26:	0f 8d 24 02 00 00    	jge    802c50 <nsipc_sendmsg+0x257>
+  802a2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a2f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802a32:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802a35:	89 d8                	mov    %ebx,%eax
+  802a37:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a3c:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802a3e:	83 ec 0c             	sub    $0xc,%esp
+  802a41:	68 20 98 80 00       	push   $0x809820
+  802a46:	e8 5a 0f 00 00       	call   8039a5 <pgbatch_init>
+  802a4b:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802a4e:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802a50:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802a53:	e9 82 00 00 00       	jmp    802ada <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802a58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802a5b:	85 db                	test   %ebx,%ebx
+  802a5d:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a63:	5b                   	pop    %ebx
+  802a64:	5e                   	pop    %esi
+  802a65:	5f                   	pop    %edi
+  802a66:	5d                   	pop    %ebp
+  802a67:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802a68:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a6d:	29 c8                	sub    %ecx,%eax
+  802a6f:	39 d0                	cmp    %edx,%eax
+  802a71:	0f 46 d0             	cmovbe %eax,%edx
+  802a74:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802a76:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802a7c:	85 ff                	test   %edi,%edi
+  802a7e:	0f 49 c7             	cmovns %edi,%eax
+  802a81:	c1 f8 0c             	sar    $0xc,%eax
+  802a84:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a89:	e8 87 fc ff ff       	call   802715 <nsbulk_own>
+  802a8e:	85 c0                	test   %eax,%eax
+  802a90:	0f 88 17 01 00 00    	js     802bad <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802a96:	83 ec 04             	sub    $0x4,%esp
+  802a99:	56                   	push   %esi
+  802a9a:	ff 75 e0             	push   -0x20(%ebp)
+  802a9d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802aa0:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802aa5:	50                   	push   %eax
+  802aa6:	e8 80 e4 ff ff       	call   800f2b <memmove>
+  802aab:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802aae:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802ab1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ab4:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ab7:	0f 84 fd 00 00 00    	je     802bba <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802abd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802ac0:	01 f7                	add    %esi,%edi
+  802ac2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ac5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ac8:	0f 8d 01 01 00 00    	jge    802bcf <nsipc_sendmsg+0x1d6>
+  802ace:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802ad4:	0f 8f f0 00 00 00    	jg     802bca <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802ada:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802add:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802ae0:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802ae3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ae6:	89 c2                	mov    %eax,%edx
+  802ae8:	03 13                	add    (%ebx),%edx
+  802aea:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802aed:	8b 73 04             	mov    0x4(%ebx),%esi
+  802af0:	29 c6                	sub    %eax,%esi
+  802af2:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802af7:	29 f9                	sub    %edi,%ecx
+  802af9:	39 ce                	cmp    %ecx,%esi
+  802afb:	89 ca                	mov    %ecx,%edx
+  802afd:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802b00:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802b03:	89 f9                	mov    %edi,%ecx
+  802b05:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802b0b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b0e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b13:	09 c8                	or     %ecx,%eax
+  802b15:	0f 85 4d ff ff ff    	jne    802a68 <nsipc_sendmsg+0x6f>
+  802b1b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802b21:	0f 86 41 ff ff ff    	jbe    802a68 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802b27:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802b2d:	85 ff                	test   %edi,%edi
+  802b2f:	0f 49 c7             	cmovns %edi,%eax
+  802b32:	c1 f8 0c             	sar    $0xc,%eax
+  802b35:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802b37:	89 d1                	mov    %edx,%ecx
+  802b39:	c1 e9 0c             	shr    $0xc,%ecx
+  802b3c:	01 c8                	add    %ecx,%eax
+  802b3e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802b41:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b44:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802b46:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802b49:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b4e:	29 c8                	sub    %ecx,%eax
+  802b50:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b53:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802b56:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802b58:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b5d:	89 f9                	mov    %edi,%ecx
+  802b5f:	d3 e0                	shl    %cl,%eax
+  802b61:	09 05 2c 9b 80 00    	or     %eax,0x809b2c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802b67:	83 ec 08             	sub    $0x8,%esp
+  802b6a:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802b6c:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802b6f:	50                   	push   %eax
+  802b70:	6a 00                	push   $0x0
+  802b72:	56                   	push   %esi
+  802b73:	6a 00                	push   $0x0
+  802b75:	68 20 98 80 00       	push   $0x809820
+  802b7a:	e8 e4 0e 00 00       	call   803a63 <pgbatch_map>
+  802b7f:	83 c4 20             	add    $0x20,%esp
+  802b82:	85 c0                	test   %eax,%eax
+  802b84:	0f 88 ce fe ff ff    	js     802a58 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802b8a:	83 c7 01             	add    $0x1,%edi
+  802b8d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b93:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b96:	39 c7                	cmp    %eax,%edi
+  802b98:	75 be                	jne    802b58 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802b9a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b9d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802ba0:	89 d6                	mov    %edx,%esi
+  802ba2:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802ba8:	e9 01 ff ff ff       	jmp    802aae <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802bad:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802bb0:	85 db                	test   %ebx,%ebx
+  802bb2:	0f 45 c3             	cmovne %ebx,%eax
+  802bb5:	e9 a6 fe ff ff       	jmp    802a60 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802bba:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802bbe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802bc5:	e9 f3 fe ff ff       	jmp    802abd <nsipc_sendmsg+0xc4>
+  802bca:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802bcd:	eb 03                	jmp    802bd2 <nsipc_sendmsg+0x1d9>
+  802bcf:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802bd2:	83 ec 0c             	sub    $0xc,%esp
+  802bd5:	68 20 98 80 00       	push   $0x809820
+  802bda:	e8 d4 0d 00 00       	call   8039b3 <pgbatch_flush>
+  802bdf:	83 c4 10             	add    $0x10,%esp
+  802be2:	85 c0                	test   %eax,%eax
+  802be4:	78 50                	js     802c36 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802be6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be9:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802bee:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802bf4:	89 fb                	mov    %edi,%ebx
+  802bf6:	29 f3                	sub    %esi,%ebx
+  802bf8:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802bfe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c01:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802c06:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802c0b:	89 fa                	mov    %edi,%edx
+  802c0d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802c12:	e8 66 fb ff ff       	call   80277d <nsipc_bulk>
+  802c17:	85 c0                	test   %eax,%eax
+  802c19:	78 28                	js     802c43 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802c1b:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802c1e:	39 c3                	cmp    %eax,%ebx
+  802c20:	75 0c                	jne    802c2e <nsipc_sendmsg+0x235>
+  802c22:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c25:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802c28:	0f 8f f2 fd ff ff    	jg     802a20 <nsipc_sendmsg+0x27>
+		sent += r;
+  802c2e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802c31:	e9 2a fe ff ff       	jmp    802a60 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802c36:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802c39:	85 db                	test   %ebx,%ebx
+  802c3b:	0f 45 c3             	cmovne %ebx,%eax
+  802c3e:	e9 1d fe ff ff       	jmp    802a60 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802c43:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802c46:	85 db                	test   %ebx,%ebx
+  802c48:	0f 45 c3             	cmovne %ebx,%eax
+  802c4b:	e9 10 fe ff ff       	jmp    802a60 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802c50:	83 ec 0c             	sub    $0xc,%esp
+  802c53:	68 20 98 80 00       	push   $0x809820
+  802c58:	e8 48 0d 00 00       	call   8039a5 <pgbatch_init>
+  802c5d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c60:	be 00 00 00 00       	mov    $0x0,%esi
+  802c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6a:	e9 63 ff ff ff       	jmp    802bd2 <nsipc_sendmsg+0x1d9>
+
+00802c6f <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802c6f:	55                   	push   %ebp
+  802c70:	89 e5                	mov    %esp,%ebp
+  802c72:	57                   	push   %edi
+  802c73:	56                   	push   %esi
+  802c74:	53                   	push   %ebx
+  802c75:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802c78:	83 3d 28 9b 80 00 00 	cmpl   $0x0,0x809b28
+  802c7f:	0f 84 c8 00 00 00    	je     802d4d <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802c85:	83 3d 24 9b 80 00 00 	cmpl   $0x0,0x809b24
+  802c8c:	0f 84 e4 00 00 00    	je     802d76 <nsipc_sendfile+0x107>
+{
+  802c92:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802c97:	89 fb                	mov    %edi,%ebx
+  802c99:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802c9c:	0f 83 f0 00 00 00    	jae    802d92 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802ca2:	89 fa                	mov    %edi,%edx
+  802ca4:	03 55 10             	add    0x10(%ebp),%edx
+  802ca7:	89 d0                	mov    %edx,%eax
+  802ca9:	c1 f8 1f             	sar    $0x1f,%eax
+  802cac:	c1 e8 14             	shr    $0x14,%eax
+  802caf:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802cb2:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802cb8:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802cba:	6a 10                	push   $0x10
+  802cbc:	68 00 20 01 e0       	push   $0xe0012000
+  802cc1:	52                   	push   %edx
+  802cc2:	ff 75 0c             	push   0xc(%ebp)
+  802cc5:	e8 fe f4 ff ff       	call   8021c8 <fmap>
+  802cca:	83 c4 10             	add    $0x10,%esp
+  802ccd:	85 c0                	test   %eax,%eax
+  802ccf:	0f 8e b8 00 00 00    	jle    802d8d <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802cd5:	39 c6                	cmp    %eax,%esi
+  802cd7:	0f 8d b5 00 00 00    	jge    802d92 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802cdd:	29 f0                	sub    %esi,%eax
+  802cdf:	8b 55 14             	mov    0x14(%ebp),%edx
+  802ce2:	29 da                	sub    %ebx,%edx
+  802ce4:	39 d0                	cmp    %edx,%eax
+  802ce6:	89 d3                	mov    %edx,%ebx
+  802ce8:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cee:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802cf3:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802cf9:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802cff:	8b 45 18             	mov    0x18(%ebp),%eax
+  802d02:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802d07:	83 ec 0c             	sub    $0xc,%esp
+  802d0a:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802d0c:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802d13:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802d16:	83 c0 01             	add    $0x1,%eax
+  802d19:	50                   	push   %eax
+  802d1a:	68 00 10 01 e0       	push   $0xe0011000
+  802d1f:	6a 11                	push   $0x11
+  802d21:	ff 35 24 9b 80 00    	push   0x809b24
+  802d27:	e8 aa eb ff ff       	call   8018d6 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802d2c:	83 c4 1c             	add    $0x1c,%esp
+  802d2f:	6a 00                	push   $0x0
+  802d31:	6a 00                	push   $0x0
+  802d33:	6a 00                	push   $0x0
+  802d35:	e8 d8 e8 ff ff       	call   801612 <ipc_recv>
+  802d3a:	83 c4 10             	add    $0x10,%esp
+  802d3d:	85 c0                	test   %eax,%eax
+  802d3f:	78 5b                	js     802d9c <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802d41:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802d43:	39 c3                	cmp    %eax,%ebx
+  802d45:	0f 8e 4c ff ff ff    	jle    802c97 <nsipc_sendfile+0x28>
+  802d4b:	eb 45                	jmp    802d92 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802d4d:	83 ec 04             	sub    $0x4,%esp
+  802d50:	6a 07                	push   $0x7
+  802d52:	68 00 10 01 e0       	push   $0xe0011000
+  802d57:	6a 00                	push   $0x0
+  802d59:	e8 51 e4 ff ff       	call   8011af <sys_page_alloc>
+  802d5e:	89 c7                	mov    %eax,%edi
+  802d60:	83 c4 10             	add    $0x10,%esp
+  802d63:	85 c0                	test   %eax,%eax
+  802d65:	78 2b                	js     802d92 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802d67:	c7 05 28 9b 80 00 01 	movl   $0x1,0x809b28
+  802d6e:	00 00 00 
+  802d71:	e9 0f ff ff ff       	jmp    802c85 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d76:	83 ec 0c             	sub    $0xc,%esp
+  802d79:	6a 03                	push   $0x3
+  802d7b:	e8 8b eb ff ff       	call   80190b <ipc_find_env>
+  802d80:	a3 24 9b 80 00       	mov    %eax,0x809b24
+  802d85:	83 c4 10             	add    $0x10,%esp
+  802d88:	e9 05 ff ff ff       	jmp    802c92 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802d8d:	85 ff                	test   %edi,%edi
+  802d8f:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802d92:	89 f8                	mov    %edi,%eax
+  802d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d97:	5b                   	pop    %ebx
+  802d98:	5e                   	pop    %esi
+  802d99:	5f                   	pop    %edi
+  802d9a:	5d                   	pop    %ebp
+  802d9b:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802d9c:	85 ff                	test   %edi,%edi
+  802d9e:	0f 44 f8             	cmove  %eax,%edi
+  802da1:	eb ef                	jmp    802d92 <nsipc_sendfile+0x123>
+
+00802da3 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802da3:	55                   	push   %ebp
+  802da4:	89 e5                	mov    %esp,%ebp
+  802da6:	57                   	push   %edi
+  802da7:	56                   	push   %esi
+  802da8:	53                   	push   %ebx
+  802da9:	83 ec 1c             	sub    $0x1c,%esp
+  802dac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802daf:	e8 13 f9 ff ff       	call   8026c7 <nsbulk_map>
+  802db4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802db7:	85 c0                	test   %eax,%eax
+  802db9:	0f 88 ba 00 00 00    	js     802e79 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802dbf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dc3:	0f 8e bb 00 00 00    	jle    802e84 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802dc9:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802dce:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802dd3:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802dd8:	89 f8                	mov    %edi,%eax
+  802dda:	29 f0                	sub    %esi,%eax
+  802ddc:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802de0:	39 c8                	cmp    %ecx,%eax
+  802de2:	0f 47 c1             	cmova  %ecx,%eax
+  802de5:	01 f0                	add    %esi,%eax
+  802de7:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802de9:	83 c2 01             	add    $0x1,%edx
+  802dec:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802def:	7e 07                	jle    802df8 <nsipc_recvmsg+0x55>
+  802df1:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802df6:	7e e0                	jle    802dd8 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802df8:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802dfe:	c1 fa 0c             	sar    $0xc,%edx
+  802e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e06:	e8 0a f9 ff ff       	call   802715 <nsbulk_own>
+  802e0b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e0e:	85 c0                	test   %eax,%eax
+  802e10:	78 67                	js     802e79 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802e12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e15:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802e1a:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802e20:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e23:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802e28:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802e2d:	89 f2                	mov    %esi,%edx
+  802e2f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802e34:	e8 44 f9 ff ff       	call   80277d <nsipc_bulk>
+  802e39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e3c:	85 c0                	test   %eax,%eax
+  802e3e:	78 39                	js     802e79 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802e40:	39 f0                	cmp    %esi,%eax
+  802e42:	7f 4a                	jg     802e8e <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802e44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e49:	85 c0                	test   %eax,%eax
+  802e4b:	7e 2c                	jle    802e79 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802e4d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e50:	29 fe                	sub    %edi,%esi
+  802e52:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e55:	39 c6                	cmp    %eax,%esi
+  802e57:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802e5a:	83 ec 04             	sub    $0x4,%esp
+  802e5d:	56                   	push   %esi
+  802e5e:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802e64:	50                   	push   %eax
+  802e65:	ff 33                	push   (%ebx)
+  802e67:	e8 bf e0 ff ff       	call   800f2b <memmove>
+		n += m;
+  802e6c:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802e6e:	83 c3 08             	add    $0x8,%ebx
+  802e71:	83 c4 10             	add    $0x10,%esp
+  802e74:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802e77:	7f d4                	jg     802e4d <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802e79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e7f:	5b                   	pop    %ebx
+  802e80:	5e                   	pop    %esi
+  802e81:	5f                   	pop    %edi
+  802e82:	5d                   	pop    %ebp
+  802e83:	c3                   	ret
+	int r, i, n, len = 0;
+  802e84:	be 00 00 00 00       	mov    $0x0,%esi
+  802e89:	e9 6a ff ff ff       	jmp    802df8 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802e8e:	68 58 48 80 00       	push   $0x804858
+  802e93:	68 61 48 80 00       	push   $0x804861
+  802e98:	68 3b 01 00 00       	push   $0x13b
+  802e9d:	68 76 48 80 00       	push   $0x804876
+  802ea2:	e8 7b 0e 00 00       	call   803d22 <_panic>
+
+00802ea7 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802ea7:	55                   	push   %ebp
+  802ea8:	89 e5                	mov    %esp,%ebp
+  802eaa:	57                   	push   %edi
+  802eab:	56                   	push   %esi
+  802eac:	53                   	push   %ebx
+  802ead:	83 ec 0c             	sub    $0xc,%esp
+  802eb0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802eb3:	8b 75 10             	mov    0x10(%ebp),%esi
+  802eb6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebc:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.select.req_readset = *readset;
+  802ec1:	8b 07                	mov    (%edi),%eax
+  802ec3:	a3 04 b0 80 00       	mov    %eax,0x80b004
+  802ec8:	8b 47 04             	mov    0x4(%edi),%eax
+  802ecb:	a3 08 b0 80 00       	mov    %eax,0x80b008
+  802ed0:	8b 47 08             	mov    0x8(%edi),%eax
+  802ed3:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+  802ed8:	8b 47 0c             	mov    0xc(%edi),%eax
+  802edb:	a3 10 b0 80 00       	mov    %eax,0x80b010
+  802ee0:	8b 47 10             	mov    0x10(%edi),%eax
+  802ee3:	a3 14 b0 80 00       	mov    %eax,0x80b014
+  802ee8:	8b 47 14             	mov    0x14(%edi),%eax
+  802eeb:	a3 18 b0 80 00       	mov    %eax,0x80b018
+  802ef0:	8b 47 18             	mov    0x18(%edi),%eax
+  802ef3:	a3 1c b0 80 00       	mov    %eax,0x80b01c
+  802ef8:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802efb:	a3 20 b0 80 00       	mov    %eax,0x80b020
+  802f00:	8b 47 20             	mov    0x20(%edi),%eax
+  802f03:	a3 24 b0 80 00       	mov    %eax,0x80b024
+  802f08:	8b 47 24             	mov    0x24(%edi),%eax
+  802f0b:	a3 28 b0 80 00       	mov    %eax,0x80b028
+  802f10:	8b 47 28             	mov    0x28(%edi),%eax
+  802f13:	a3 2c b0 80 00       	mov    %eax,0x80b02c
+  802f18:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802f1b:	a3 30 b0 80 00       	mov    %eax,0x80b030
+  802f20:	8b 47 30             	mov    0x30(%edi),%eax
+  802f23:	a3 34 b0 80 00       	mov    %eax,0x80b034
+  802f28:	8b 47 34             	mov    0x34(%edi),%eax
+  802f2b:	a3 38 b0 80 00       	mov    %eax,0x80b038
+  802f30:	8b 47 38             	mov    0x38(%edi),%eax
+  802f33:	a3 3c b0 80 00       	mov    %eax,0x80b03c
+  802f38:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802f3b:	a3 40 b0 80 00       	mov    %eax,0x80b040
+	nsipcbuf.select.req_writeset = *writeset;
+  802f40:	8b 06                	mov    (%esi),%eax
+  802f42:	a3 44 b0 80 00       	mov    %eax,0x80b044
+  802f47:	8b 46 04             	mov    0x4(%esi),%eax
+  802f4a:	a3 48 b0 80 00       	mov    %eax,0x80b048
+  802f4f:	8b 46 08             	mov    0x8(%esi),%eax
+  802f52:	a3 4c b0 80 00       	mov    %eax,0x80b04c
+  802f57:	8b 46 0c             	mov    0xc(%esi),%eax
+  802f5a:	a3 50 b0 80 00       	mov    %eax,0x80b050
+  802f5f:	8b 46 10             	mov    0x10(%esi),%eax
+  802f62:	a3 54 b0 80 00       	mov    %eax,0x80b054
+  802f67:	8b 46 14             	mov    0x14(%esi),%eax
+  802f6a:	a3 58 b0 80 00       	mov    %eax,0x80b058
+  802f6f:	8b 46 18             	mov    0x18(%esi),%eax
+  802f72:	a3 5c b0 80 00       	mov    %eax,0x80b05c
+  802f77:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802f7a:	a3 60 b0 80 00       	mov    %eax,0x80b060
+  802f7f:	8b 46 20             	mov    0x20(%esi),%eax
+  802f82:	a3 64 b0 80 00       	mov    %eax,0x80b064
+  802f87:	8b 46 24             	mov    0x24(%esi),%eax
+  802f8a:	a3 68 b0 80 00       	mov    %eax,0x80b068
+  802f8f:	8b 46 28             	mov    0x28(%esi),%eax
+  802f92:	a3 6c b0 80 00       	mov    %eax,0x80b06c
+  802f97:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802f9a:	a3 70 b0 80 00       	mov    %eax,0x80b070
+  802f9f:	8b 46 30             	mov    0x30(%esi),%eax
+  802fa2:	a3 74 b0 80 00       	mov    %eax,0x80b074
+  802fa7:	8b 46 34             	mov    0x34(%esi),%eax
+  802faa:	a3 78 b0 80 00       	mov    %eax,0x80b078
+  802faf:	8b 46 38             	mov    0x38(%esi),%eax
+  802fb2:	a3 7c b0 80 00       	mov    %eax,0x80b07c
+  802fb7:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802fba:	a3 80 b0 80 00       	mov    %eax,0x80b080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802fbf:	8b 03                	mov    (%ebx),%eax
+  802fc1:	a3 84 b0 80 00       	mov    %eax,0x80b084
+  802fc6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fc9:	a3 88 b0 80 00       	mov    %eax,0x80b088
+  802fce:	8b 43 08             	mov    0x8(%ebx),%eax
+  802fd1:	a3 8c b0 80 00       	mov    %eax,0x80b08c
+  802fd6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802fd9:	a3 90 b0 80 00       	mov    %eax,0x80b090
+  802fde:	8b 43 10             	mov    0x10(%ebx),%eax
+  802fe1:	a3 94 b0 80 00       	mov    %eax,0x80b094
+  802fe6:	8b 43 14             	mov    0x14(%ebx),%eax
+  802fe9:	a3 98 b0 80 00       	mov    %eax,0x80b098
+  802fee:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ff1:	a3 9c b0 80 00       	mov    %eax,0x80b09c
+  802ff6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802ff9:	a3 a0 b0 80 00       	mov    %eax,0x80b0a0
+  802ffe:	8b 43 20             	mov    0x20(%ebx),%eax
+  803001:	a3 a4 b0 80 00       	mov    %eax,0x80b0a4
+  803006:	8b 43 24             	mov    0x24(%ebx),%eax
+  803009:	a3 a8 b0 80 00       	mov    %eax,0x80b0a8
+  80300e:	8b 43 28             	mov    0x28(%ebx),%eax
+  803011:	a3 ac b0 80 00       	mov    %eax,0x80b0ac
+  803016:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803019:	a3 b0 b0 80 00       	mov    %eax,0x80b0b0
+  80301e:	8b 43 30             	mov    0x30(%ebx),%eax
+  803021:	a3 b4 b0 80 00       	mov    %eax,0x80b0b4
+  803026:	8b 43 34             	mov    0x34(%ebx),%eax
+  803029:	a3 b8 b0 80 00       	mov    %eax,0x80b0b8
+  80302e:	8b 43 38             	mov    0x38(%ebx),%eax
+  803031:	a3 bc b0 80 00       	mov    %eax,0x80b0bc
+  803036:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803039:	a3 c0 b0 80 00       	mov    %eax,0x80b0c0
+	nsipcbuf.select.req_timeout = msec;
+  80303e:	8b 45 18             	mov    0x18(%ebp),%eax
+  803041:	a3 c4 b0 80 00       	mov    %eax,0x80b0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803046:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80304b:	e8 2b f6 ff ff       	call   80267b <nsipc>
+  803050:	85 c0                	test   %eax,%eax
+  803052:	0f 88 ad 01 00 00    	js     803205 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803058:	8b 15 04 b0 80 00    	mov    0x80b004,%edx
+  80305e:	89 17                	mov    %edx,(%edi)
+  803060:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  803066:	89 57 04             	mov    %edx,0x4(%edi)
+  803069:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  80306f:	89 57 08             	mov    %edx,0x8(%edi)
+  803072:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  803078:	89 57 0c             	mov    %edx,0xc(%edi)
+  80307b:	8b 15 14 b0 80 00    	mov    0x80b014,%edx
+  803081:	89 57 10             	mov    %edx,0x10(%edi)
+  803084:	8b 15 18 b0 80 00    	mov    0x80b018,%edx
+  80308a:	89 57 14             	mov    %edx,0x14(%edi)
+  80308d:	8b 15 1c b0 80 00    	mov    0x80b01c,%edx
+  803093:	89 57 18             	mov    %edx,0x18(%edi)
+  803096:	8b 15 20 b0 80 00    	mov    0x80b020,%edx
+  80309c:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80309f:	8b 15 24 b0 80 00    	mov    0x80b024,%edx
+  8030a5:	89 57 20             	mov    %edx,0x20(%edi)
+  8030a8:	8b 15 28 b0 80 00    	mov    0x80b028,%edx
+  8030ae:	89 57 24             	mov    %edx,0x24(%edi)
+  8030b1:	8b 15 2c b0 80 00    	mov    0x80b02c,%edx
+  8030b7:	89 57 28             	mov    %edx,0x28(%edi)
+  8030ba:	8b 15 30 b0 80 00    	mov    0x80b030,%edx
+  8030c0:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8030c3:	8b 15 34 b0 80 00    	mov    0x80b034,%edx
+  8030c9:	89 57 30             	mov    %edx,0x30(%edi)
+  8030cc:	8b 15 38 b0 80 00    	mov    0x80b038,%edx
+  8030d2:	89 57 34             	mov    %edx,0x34(%edi)
+  8030d5:	8b 15 3c b0 80 00    	mov    0x80b03c,%edx
+  8030db:	89 57 38             	mov    %edx,0x38(%edi)
+  8030de:	8b 15 40 b0 80 00    	mov    0x80b040,%edx
+  8030e4:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8030e7:	8b 15 44 b0 80 00    	mov    0x80b044,%edx
+  8030ed:	89 16                	mov    %edx,(%esi)
+  8030ef:	8b 15 48 b0 80 00    	mov    0x80b048,%edx
+  8030f5:	89 56 04             	mov    %edx,0x4(%esi)
+  8030f8:	8b 15 4c b0 80 00    	mov    0x80b04c,%edx
+  8030fe:	89 56 08             	mov    %edx,0x8(%esi)
+  803101:	8b 15 50 b0 80 00    	mov    0x80b050,%edx
+  803107:	89 56 0c             	mov    %edx,0xc(%esi)
+  80310a:	8b 15 54 b0 80 00    	mov    0x80b054,%edx
+  803110:	89 56 10             	mov    %edx,0x10(%esi)
+  803113:	8b 15 58 b0 80 00    	mov    0x80b058,%edx
+  803119:	89 56 14             	mov    %edx,0x14(%esi)
+  80311c:	8b 15 5c b0 80 00    	mov    0x80b05c,%edx
+  803122:	89 56 18             	mov    %edx,0x18(%esi)
+  803125:	8b 15 60 b0 80 00    	mov    0x80b060,%edx
+  80312b:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80312e:	8b 15 64 b0 80 00    	mov    0x80b064,%edx
+  803134:	89 56 20             	mov    %edx,0x20(%esi)
+  803137:	8b 15 68 b0 80 00    	mov    0x80b068,%edx
+  80313d:	89 56 24             	mov    %edx,0x24(%esi)
+  803140:	8b 15 6c b0 80 00    	mov    0x80b06c,%edx
+  803146:	89 56 28             	mov    %edx,0x28(%esi)
+  803149:	8b 15 70 b0 80 00    	mov    0x80b070,%edx
+  80314f:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803152:	8b 15 74 b0 80 00    	mov    0x80b074,%edx
+  803158:	89 56 30             	mov    %edx,0x30(%esi)
+  80315b:	8b 15 78 b0 80 00    	mov    0x80b078,%edx
+  803161:	89 56 34             	mov    %edx,0x34(%esi)
+  803164:	8b 15 7c b0 80 00    	mov    0x80b07c,%edx
+  80316a:	89 56 38             	mov    %edx,0x38(%esi)
+  80316d:	8b 15 80 b0 80 00    	mov    0x80b080,%edx
+  803173:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803176:	8b 15 84 b0 80 00    	mov    0x80b084,%edx
+  80317c:	89 13                	mov    %edx,(%ebx)
+  80317e:	8b 15 88 b0 80 00    	mov    0x80b088,%edx
+  803184:	89 53 04             	mov    %edx,0x4(%ebx)
+  803187:	8b 15 8c b0 80 00    	mov    0x80b08c,%edx
+  80318d:	89 53 08             	mov    %edx,0x8(%ebx)
+  803190:	8b 15 90 b0 80 00    	mov    0x80b090,%edx
+  803196:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803199:	8b 15 94 b0 80 00    	mov    0x80b094,%edx
+  80319f:	89 53 10             	mov    %edx,0x10(%ebx)
+  8031a2:	8b 15 98 b0 80 00    	mov    0x80b098,%edx
+  8031a8:	89 53 14             	mov    %edx,0x14(%ebx)
+  8031ab:	8b 15 9c b0 80 00    	mov    0x80b09c,%edx
+  8031b1:	89 53 18             	mov    %edx,0x18(%ebx)
+  8031b4:	8b 15 a0 b0 80 00    	mov    0x80b0a0,%edx
+  8031ba:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8031bd:	8b 15 a4 b0 80 00    	mov    0x80b0a4,%edx
+  8031c3:	89 53 20             	mov    %edx,0x20(%ebx)
+  8031c6:	8b 15 a8 b0 80 00    	mov    0x80b0a8,%edx
+  8031cc:	89 53 24             	mov    %edx,0x24(%ebx)
+  8031cf:	8b 15 ac b0 80 00    	mov    0x80b0ac,%edx
+  8031d5:	89 53 28             	mov    %edx,0x28(%ebx)
+  8031d8:	8b 15 b0 b0 80 00    	mov    0x80b0b0,%edx
+  8031de:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8031e1:	8b 15 b4 b0 80 00    	mov    0x80b0b4,%edx
+  8031e7:	89 53 30             	mov    %edx,0x30(%ebx)
+  8031ea:	8b 15 b8 b0 80 00    	mov    0x80b0b8,%edx
+  8031f0:	89 53 34             	mov    %edx,0x34(%ebx)
+  8031f3:	8b 15 bc b0 80 00    	mov    0x80b0bc,%edx
+  8031f9:	89 53 38             	mov    %edx,0x38(%ebx)
+  8031fc:	8b 15 c0 b0 80 00    	mov    0x80b0c0,%edx
+  803202:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803205:	83 c4 0c             	add    $0xc,%esp
+  803208:	5b                   	pop    %ebx
+  803209:	5e                   	pop    %esi
+  80320a:	5f                   	pop    %edi
+  80320b:	5d                   	pop    %ebp
+  80320c:	c3                   	ret
+
+0080320d <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80320d:	55                   	push   %ebp
+  80320e:	89 e5                	mov    %esp,%ebp
+  803210:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803213:	8b 45 08             	mov    0x8(%ebp),%eax
+  803216:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.evctl.req_events = events;
+  80321b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80321e:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.evctl.req_data = data;
+  803223:	8b 45 10             	mov    0x10(%ebp),%eax
+  803226:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_EVCTL);
+  80322b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803230:	e8 46 f4 ff ff       	call   80267b <nsipc>
+}
+  803235:	c9                   	leave
+  803236:	c3                   	ret
+
+00803237 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803237:	55                   	push   %ebp
+  803238:	89 e5                	mov    %esp,%ebp
+  80323a:	56                   	push   %esi
+  80323b:	53                   	push   %ebx
+  80323c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  80323f:	89 35 00 b0 80 00    	mov    %esi,0x80b000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803245:	8b 45 10             	mov    0x10(%ebp),%eax
+  803248:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80324d:	b8 10 00 00 00       	mov    $0x10,%eax
+  803252:	e8 24 f4 ff ff       	call   80267b <nsipc>
+  803257:	89 c3                	mov    %eax,%ebx
+  803259:	85 c0                	test   %eax,%eax
+  80325b:	7e 1f                	jle    80327c <nsipc_evwait+0x45>
+		assert(r <= max);
+  80325d:	39 c6                	cmp    %eax,%esi
+  80325f:	7c 24                	jl     803285 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803261:	83 ec 04             	sub    $0x4,%esp
+  803264:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80326b:	50                   	push   %eax
+  80326c:	68 00 b0 80 00       	push   $0x80b000
+  803271:	ff 75 08             	push   0x8(%ebp)
+  803274:	e8 b2 dc ff ff       	call   800f2b <memmove>
+  803279:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80327c:	89 d8                	mov    %ebx,%eax
+  80327e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803281:	5b                   	pop    %ebx
+  803282:	5e                   	pop    %esi
+  803283:	5d                   	pop    %ebp
+  803284:	c3                   	ret
+		assert(r <= max);
+  803285:	68 8e 48 80 00       	push   $0x80488e
+  80328a:	68 61 48 80 00       	push   $0x804861
+  80328f:	68 6a 01 00 00       	push   $0x16a
+  803294:	68 76 48 80 00       	push   $0x804876
+  803299:	e8 84 0a 00 00       	call   803d22 <_panic>
+
+0080329e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80329e:	55                   	push   %ebp
+  80329f:	89 e5                	mov    %esp,%ebp
+  8032a1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8032a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a7:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  8032ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032af:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  8032b4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032b7:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  8032bc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8032c1:	e8 b5 f3 ff ff       	call   80267b <nsipc>
+}
+  8032c6:	c9                   	leave
+  8032c7:	c3                   	ret
+
+008032c8 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8032c8:	55                   	push   %ebp
+  8032c9:	89 e5                	mov    %esp,%ebp
+  8032cb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8032ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d1:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_OFFLOAD);
+  8032d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8032db:	e8 9b f3 ff ff       	call   80267b <nsipc>
+}
+  8032e0:	c9                   	leave
+  8032e1:	c3                   	ret
+
+008032e2 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8032e2:	55                   	push   %ebp
+  8032e3:	89 e5                	mov    %esp,%ebp
+  8032e5:	53                   	push   %ebx
+  8032e6:	83 ec 04             	sub    $0x4,%esp
+  8032e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8032ec:	b8 12 00 00 00       	mov    $0x12,%eax
+  8032f1:	e8 85 f3 ff ff       	call   80267b <nsipc>
+  8032f6:	85 c0                	test   %eax,%eax
+  8032f8:	78 50                	js     80334a <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8032fa:	8b 15 00 b0 80 00    	mov    0x80b000,%edx
+  803300:	89 13                	mov    %edx,(%ebx)
+  803302:	8b 15 04 b0 80 00    	mov    0x80b004,%edx
+  803308:	89 53 04             	mov    %edx,0x4(%ebx)
+  80330b:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  803311:	89 53 08             	mov    %edx,0x8(%ebx)
+  803314:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  80331a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80331d:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  803323:	89 53 10             	mov    %edx,0x10(%ebx)
+  803326:	8b 15 14 b0 80 00    	mov    0x80b014,%edx
+  80332c:	89 53 14             	mov    %edx,0x14(%ebx)
+  80332f:	8b 15 18 b0 80 00    	mov    0x80b018,%edx
+  803335:	89 53 18             	mov    %edx,0x18(%ebx)
+  803338:	8b 15 1c b0 80 00    	mov    0x80b01c,%edx
+  80333e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803341:	8b 15 20 b0 80 00    	mov    0x80b020,%edx
+  803347:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80334a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80334d:	c9                   	leave
+  80334e:	c3                   	ret
+
+0080334f <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80334f:	55                   	push   %ebp
+  803350:	89 e5                	mov    %esp,%ebp
+  803352:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803355:	6a 03                	push   $0x3
+  803357:	e8 af e5 ff ff       	call   80190b <ipc_find_env>
+  80335c:	a3 24 9b 80 00       	mov    %eax,0x809b24
+	nsipcbuf.shard.req_shard = shard;
+  803361:	8b 45 08             	mov    0x8(%ebp),%eax
+  803364:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803369:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80336e:	e8 08 f3 ff ff       	call   80267b <nsipc>
+  803373:	83 c4 10             	add    $0x10,%esp
+  803376:	85 c0                	test   %eax,%eax
+  803378:	78 0a                	js     803384 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80337a:	a3 24 9b 80 00       	mov    %eax,0x809b24
+	return 0;
+  80337f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803384:	c9                   	leave
+  803385:	c3                   	ret
+
+00803386 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803386:	55                   	push   %ebp
+  803387:	89 e5                	mov    %esp,%ebp
+  803389:	57                   	push   %edi
+  80338a:	56                   	push   %esi
+  80338b:	53                   	push   %ebx
+  80338c:	83 ec 1c             	sub    $0x1c,%esp
+  80338f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803392:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803395:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80339a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80339f:	89 e0                	mov    %esp,%eax
+  8033a1:	89 f2                	mov    %esi,%edx
+  8033a3:	29 c2                	sub    %eax,%edx
+  8033a5:	89 d0                	mov    %edx,%eax
+  8033a7:	c1 e8 0f             	shr    $0xf,%eax
+  8033aa:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8033b0:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8033b3:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  8033ba:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8033bd:	83 ec 0c             	sub    $0xc,%esp
+  8033c0:	ff 75 e0             	push   -0x20(%ebp)
+  8033c3:	e8 a0 09 00 00       	call   803d68 <pageref>
+  8033c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033cb:	83 c4 04             	add    $0x4,%esp
+  8033ce:	ff 75 dc             	push   -0x24(%ebp)
+  8033d1:	e8 92 09 00 00       	call   803d68 <pageref>
+  8033d6:	89 e2                	mov    %esp,%edx
+  8033d8:	89 f1                	mov    %esi,%ecx
+  8033da:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8033dc:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8033df:	89 ca                	mov    %ecx,%edx
+  8033e1:	c1 ea 0f             	shr    $0xf,%edx
+  8033e4:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8033ea:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8033ed:	8b 14 95 60 9b 80 00 	mov    0x809b60(,%edx,4),%edx
+  8033f4:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8033f7:	39 d7                	cmp    %edx,%edi
+  8033f9:	74 40                	je     80343b <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8033fb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8033fe:	75 9f                	jne    80339f <_pipeisclosed+0x19>
+  803400:	89 e2                	mov    %esp,%edx
+  803402:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803407:	29 d0                	sub    %edx,%eax
+  803409:	89 c2                	mov    %eax,%edx
+  80340b:	c1 ea 0f             	shr    $0xf,%edx
+  80340e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+  803418:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80341b:	8b 04 85 60 9b 80 00 	mov    0x809b60(,%eax,4),%eax
+  803422:	8b 40 58             	mov    0x58(%eax),%eax
+  803425:	6a 01                	push   $0x1
+  803427:	50                   	push   %eax
+  803428:	57                   	push   %edi
+  803429:	68 97 48 80 00       	push   $0x804897
+  80342e:	e8 51 d2 ff ff       	call   800684 <cprintf>
+  803433:	83 c4 10             	add    $0x10,%esp
+  803436:	e9 5f ff ff ff       	jmp    80339a <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80343b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80343e:	0f 94 c0             	sete   %al
+  803441:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803444:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803447:	5b                   	pop    %ebx
+  803448:	5e                   	pop    %esi
+  803449:	5f                   	pop    %edi
+  80344a:	5d                   	pop    %ebp
+  80344b:	c3                   	ret
+
+0080344c <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80344c:	55                   	push   %ebp
+  80344d:	89 e5                	mov    %esp,%ebp
+  80344f:	53                   	push   %ebx
+  803450:	83 ec 0c             	sub    $0xc,%esp
+  803453:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803456:	53                   	push   %ebx
+  803457:	6a 00                	push   $0x0
+  803459:	e8 d6 dd ff ff       	call   801234 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80345e:	89 1c 24             	mov    %ebx,(%esp)
+  803461:	e8 f4 e4 ff ff       	call   80195a <fd2data>
+  803466:	83 c4 08             	add    $0x8,%esp
+  803469:	50                   	push   %eax
+  80346a:	6a 00                	push   $0x0
+  80346c:	e8 c3 dd ff ff       	call   801234 <sys_page_unmap>
+}
+  803471:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803474:	c9                   	leave
+  803475:	c3                   	ret
+
+00803476 <devpipe_read>:
+{
+  803476:	55                   	push   %ebp
+  803477:	89 e5                	mov    %esp,%ebp
+  803479:	57                   	push   %edi
+  80347a:	56                   	push   %esi
+  80347b:	53                   	push   %ebx
+  80347c:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80347f:	ff 75 08             	push   0x8(%ebp)
+  803482:	e8 d3 e4 ff ff       	call   80195a <fd2data>
+  803487:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803489:	8b 70 04             	mov    0x4(%eax),%esi
+  80348c:	8b 00                	mov    (%eax),%eax
+  80348e:	83 c4 10             	add    $0x10,%esp
+  803491:	39 f0                	cmp    %esi,%eax
+  803493:	75 36                	jne    8034cb <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803495:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803498:	89 da                	mov    %ebx,%edx
+  80349a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80349d:	e8 e4 fe ff ff       	call   803386 <_pipeisclosed>
+  8034a2:	85 c0                	test   %eax,%eax
+  8034a4:	0f 85 d4 00 00 00    	jne    80357e <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8034aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034af:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8034b3:	83 ec 04             	sub    $0x4,%esp
+  8034b6:	6a ff                	push   $0xffffffff
+  8034b8:	56                   	push   %esi
+  8034b9:	57                   	push   %edi
+  8034ba:	e8 ee e0 ff ff       	call   8015ad <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8034bf:	8b 73 04             	mov    0x4(%ebx),%esi
+  8034c2:	8b 03                	mov    (%ebx),%eax
+  8034c4:	83 c4 10             	add    $0x10,%esp
+  8034c7:	39 c6                	cmp    %eax,%esi
+  8034c9:	74 cd                	je     803498 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8034cb:	8b 73 04             	mov    0x4(%ebx),%esi
+  8034ce:	8b 03                	mov    (%ebx),%eax
+  8034d0:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8034d6:	29 c6                	sub    %eax,%esi
+  8034d8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034dd:	f7 e6                	mul    %esi
+  8034df:	c1 ea 0c             	shr    $0xc,%edx
+  8034e2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8034e8:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8034ea:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8034ed:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8034f1:	8b 0b                	mov    (%ebx),%ecx
+  8034f3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034f8:	f7 e1                	mul    %ecx
+  8034fa:	c1 ea 0b             	shr    $0xb,%edx
+  8034fd:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803503:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803505:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80350a:	29 cf                	sub    %ecx,%edi
+  80350c:	39 f7                	cmp    %esi,%edi
+  80350e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803511:	83 ec 04             	sub    $0x4,%esp
+  803514:	57                   	push   %edi
+  803515:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803519:	50                   	push   %eax
+  80351a:	ff 75 0c             	push   0xc(%ebp)
+  80351d:	e8 09 da ff ff       	call   800f2b <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803522:	83 c4 0c             	add    $0xc,%esp
+  803525:	89 f0                	mov    %esi,%eax
+  803527:	29 f8                	sub    %edi,%eax
+  803529:	50                   	push   %eax
+  80352a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80352d:	50                   	push   %eax
+  80352e:	89 f8                	mov    %edi,%eax
+  803530:	03 45 0c             	add    0xc(%ebp),%eax
+  803533:	50                   	push   %eax
+  803534:	e8 f2 d9 ff ff       	call   800f2b <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803539:	8b 0b                	mov    (%ebx),%ecx
+  80353b:	01 f1                	add    %esi,%ecx
+  80353d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803542:	f7 e1                	mul    %ecx
+  803544:	c1 ea 0c             	shr    $0xc,%edx
+  803547:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80354d:	29 c1                	sub    %eax,%ecx
+  80354f:	89 0b                	mov    %ecx,(%ebx)
+  803551:	b8 00 00 00 00       	mov    $0x0,%eax
+  803556:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80355a:	83 c4 10             	add    $0x10,%esp
+  80355d:	85 c0                	test   %eax,%eax
+  80355f:	75 0a                	jne    80356b <devpipe_read+0xf5>
+	return n;
+  803561:	89 f0                	mov    %esi,%eax
+}
+  803563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803566:	5b                   	pop    %ebx
+  803567:	5e                   	pop    %esi
+  803568:	5f                   	pop    %edi
+  803569:	5d                   	pop    %ebp
+  80356a:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80356b:	83 ec 08             	sub    $0x8,%esp
+  80356e:	68 00 04 00 00       	push   $0x400
+  803573:	53                   	push   %ebx
+  803574:	e8 56 e0 ff ff       	call   8015cf <sys_futex_wake>
+  803579:	83 c4 10             	add    $0x10,%esp
+  80357c:	eb e3                	jmp    803561 <devpipe_read+0xeb>
+			return 0;
+  80357e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803583:	eb de                	jmp    803563 <devpipe_read+0xed>
+
+00803585 <devpipe_write>:
+{
+  803585:	55                   	push   %ebp
+  803586:	89 e5                	mov    %esp,%ebp
+  803588:	57                   	push   %edi
+  803589:	56                   	push   %esi
+  80358a:	53                   	push   %ebx
+  80358b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80358e:	ff 75 08             	push   0x8(%ebp)
+  803591:	e8 c4 e3 ff ff       	call   80195a <fd2data>
+  803596:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803598:	83 c4 10             	add    $0x10,%esp
+  80359b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035a2:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8035a7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035ab:	0f 84 43 01 00 00    	je     8036f4 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035b1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8035b4:	8b 06                	mov    (%esi),%eax
+  8035b6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8035bc:	29 c1                	sub    %eax,%ecx
+  8035be:	89 c8                	mov    %ecx,%eax
+  8035c0:	f7 e7                	mul    %edi
+  8035c2:	c1 ea 0c             	shr    $0xc,%edx
+  8035c5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8035cb:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8035cd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8035d3:	75 52                	jne    803627 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8035d5:	89 f2                	mov    %esi,%edx
+  8035d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035da:	e8 a7 fd ff ff       	call   803386 <_pipeisclosed>
+  8035df:	85 c0                	test   %eax,%eax
+  8035e1:	0f 85 28 01 00 00    	jne    80370f <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8035e7:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035e9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8035ec:	8b 06                	mov    (%esi),%eax
+  8035ee:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8035f4:	29 c1                	sub    %eax,%ecx
+  8035f6:	89 c8                	mov    %ecx,%eax
+  8035f8:	f7 e7                	mul    %edi
+  8035fa:	c1 ea 0c             	shr    $0xc,%edx
+  8035fd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803603:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803605:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80360b:	75 a4                	jne    8035b1 <devpipe_write+0x2c>
+  80360d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803612:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803616:	83 ec 04             	sub    $0x4,%esp
+  803619:	6a ff                	push   $0xffffffff
+  80361b:	53                   	push   %ebx
+  80361c:	56                   	push   %esi
+  80361d:	e8 8b df ff ff       	call   8015ad <sys_futex_wait>
+}
+  803622:	83 c4 10             	add    $0x10,%esp
+  803625:	eb 8a                	jmp    8035b1 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803627:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80362a:	8b 06                	mov    (%esi),%eax
+  80362c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803632:	29 c1                	sub    %eax,%ecx
+  803634:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803639:	f7 e1                	mul    %ecx
+  80363b:	c1 ea 0c             	shr    $0xc,%edx
+  80363e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803644:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803646:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80364b:	89 d8                	mov    %ebx,%eax
+  80364d:	29 c8                	sub    %ecx,%eax
+  80364f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803652:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803655:	29 ca                	sub    %ecx,%edx
+  803657:	39 d0                	cmp    %edx,%eax
+  803659:	0f 46 d0             	cmovbe %eax,%edx
+  80365c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80365f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803662:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803667:	f7 e1                	mul    %ecx
+  803669:	c1 ea 0b             	shr    $0xb,%edx
+  80366c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803672:	89 ca                	mov    %ecx,%edx
+  803674:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803676:	29 d3                	sub    %edx,%ebx
+  803678:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80367b:	39 c3                	cmp    %eax,%ebx
+  80367d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803680:	83 ec 04             	sub    $0x4,%esp
+  803683:	53                   	push   %ebx
+  803684:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803687:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80368a:	51                   	push   %ecx
+  80368b:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80368f:	50                   	push   %eax
+  803690:	e8 96 d8 ff ff       	call   800f2b <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803695:	83 c4 0c             	add    $0xc,%esp
+  803698:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80369b:	29 d8                	sub    %ebx,%eax
+  80369d:	50                   	push   %eax
+  80369e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8036a1:	01 cb                	add    %ecx,%ebx
+  8036a3:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8036a6:	53                   	push   %ebx
+  8036a7:	8d 46 10             	lea    0x10(%esi),%eax
+  8036aa:	50                   	push   %eax
+  8036ab:	e8 7b d8 ff ff       	call   800f2b <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8036b0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8036b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8036b6:	01 c1                	add    %eax,%ecx
+  8036b8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036bd:	f7 e1                	mul    %ecx
+  8036bf:	c1 ea 0c             	shr    $0xc,%edx
+  8036c2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8036c8:	89 ca                	mov    %ecx,%edx
+  8036ca:	29 c2                	sub    %eax,%edx
+  8036cc:	89 56 04             	mov    %edx,0x4(%esi)
+  8036cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d4:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8036d8:	83 c4 10             	add    $0x10,%esp
+  8036db:	85 c0                	test   %eax,%eax
+  8036dd:	75 1a                	jne    8036f9 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8036df:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8036e2:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8036e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036e8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8036eb:	0f 82 c0 fe ff ff    	jb     8035b1 <devpipe_write+0x2c>
+  8036f1:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8036f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036f7:	eb 1b                	jmp    803714 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8036f9:	83 ec 08             	sub    $0x8,%esp
+  8036fc:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803701:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803704:	50                   	push   %eax
+  803705:	e8 c5 de ff ff       	call   8015cf <sys_futex_wake>
+  80370a:	83 c4 10             	add    $0x10,%esp
+  80370d:	eb d0                	jmp    8036df <devpipe_write+0x15a>
+				return 0;
+  80370f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803714:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803717:	5b                   	pop    %ebx
+  803718:	5e                   	pop    %esi
+  803719:	5f                   	pop    %edi
+  80371a:	5d                   	pop    %ebp
+  80371b:	c3                   	ret
+
+0080371c <devpipe_stat>:
+{
+  80371c:	55                   	push   %ebp
+  80371d:	89 e5                	mov    %esp,%ebp
+  80371f:	56                   	push   %esi
+  803720:	53                   	push   %ebx
+  803721:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803724:	83 ec 0c             	sub    $0xc,%esp
+  803727:	ff 75 08             	push   0x8(%ebp)
+  80372a:	e8 2b e2 ff ff       	call   80195a <fd2data>
+  80372f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803731:	83 c4 08             	add    $0x8,%esp
+  803734:	68 aa 48 80 00       	push   $0x8048aa
+  803739:	53                   	push   %ebx
+  80373a:	e8 3c d6 ff ff       	call   800d7b <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80373f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803742:	8b 06                	mov    (%esi),%eax
+  803744:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80374a:	29 c1                	sub    %eax,%ecx
+  80374c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803751:	89 c8                	mov    %ecx,%eax
+  803753:	f7 e2                	mul    %edx
+  803755:	c1 ea 0c             	shr    $0xc,%edx
+  803758:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80375e:	29 d1                	sub    %edx,%ecx
+  803760:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803766:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80376d:	00 00 00 
+	stat->st_dev = &devpipe;
+  803770:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803777:	50 80 00 
+}
+  80377a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803782:	5b                   	pop    %ebx
+  803783:	5e                   	pop    %esi
+  803784:	5d                   	pop    %ebp
+  803785:	c3                   	ret
+
+00803786 <devpipe_poll>:
+{
+  803786:	55                   	push   %ebp
+  803787:	89 e5                	mov    %esp,%ebp
+  803789:	57                   	push   %edi
+  80378a:	56                   	push   %esi
+  80378b:	53                   	push   %ebx
+  80378c:	83 ec 18             	sub    $0x18,%esp
+  80378f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803792:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803795:	57                   	push   %edi
+  803796:	e8 bf e1 ff ff       	call   80195a <fd2data>
+  80379b:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80379d:	83 c4 10             	add    $0x10,%esp
+  8037a0:	89 f3                	mov    %esi,%ebx
+  8037a2:	83 e3 01             	and    $0x1,%ebx
+  8037a5:	75 27                	jne    8037ce <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8037a7:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8037ad:	75 48                	jne    8037f7 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8037af:	89 ca                	mov    %ecx,%edx
+  8037b1:	89 f8                	mov    %edi,%eax
+  8037b3:	e8 ce fb ff ff       	call   803386 <_pipeisclosed>
+  8037b8:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8037ba:	89 d8                	mov    %ebx,%eax
+  8037bc:	83 c8 10             	or     $0x10,%eax
+  8037bf:	85 d2                	test   %edx,%edx
+  8037c1:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8037c4:	89 d8                	mov    %ebx,%eax
+  8037c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c9:	5b                   	pop    %ebx
+  8037ca:	5e                   	pop    %esi
+  8037cb:	5f                   	pop    %edi
+  8037cc:	5d                   	pop    %ebp
+  8037cd:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037ce:	8b 58 04             	mov    0x4(%eax),%ebx
+  8037d1:	8b 00                	mov    (%eax),%eax
+  8037d3:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8037d9:	29 c3                	sub    %eax,%ebx
+  8037db:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8037e0:	89 d8                	mov    %ebx,%eax
+  8037e2:	f7 e2                	mul    %edx
+  8037e4:	c1 ea 0c             	shr    $0xc,%edx
+  8037e7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8037ed:	39 d3                	cmp    %edx,%ebx
+  8037ef:	0f 95 c3             	setne  %bl
+  8037f2:	0f b6 db             	movzbl %bl,%ebx
+  8037f5:	eb b0                	jmp    8037a7 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037f7:	8b 71 04             	mov    0x4(%ecx),%esi
+  8037fa:	8b 01                	mov    (%ecx),%eax
+  8037fc:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803802:	29 c6                	sub    %eax,%esi
+  803804:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803809:	89 f0                	mov    %esi,%eax
+  80380b:	f7 e2                	mul    %edx
+  80380d:	c1 ea 0c             	shr    $0xc,%edx
+  803810:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803816:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803818:	89 d8                	mov    %ebx,%eax
+  80381a:	83 c8 04             	or     $0x4,%eax
+  80381d:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803823:	0f 42 d8             	cmovb  %eax,%ebx
+  803826:	eb 87                	jmp    8037af <devpipe_poll+0x29>
+
+00803828 <pipe>:
+{
+  803828:	55                   	push   %ebp
+  803829:	89 e5                	mov    %esp,%ebp
+  80382b:	56                   	push   %esi
+  80382c:	53                   	push   %ebx
+  80382d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803830:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803833:	50                   	push   %eax
+  803834:	e8 38 e1 ff ff       	call   801971 <fd_alloc>
+  803839:	89 c3                	mov    %eax,%ebx
+  80383b:	83 c4 10             	add    $0x10,%esp
+  80383e:	85 c0                	test   %eax,%eax
+  803840:	0f 88 23 01 00 00    	js     803969 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803846:	83 ec 04             	sub    $0x4,%esp
+  803849:	68 07 04 00 00       	push   $0x407
+  80384e:	ff 75 f4             	push   -0xc(%ebp)
+  803851:	6a 00                	push   $0x0
+  803853:	e8 57 d9 ff ff       	call   8011af <sys_page_alloc>
+  803858:	89 c3                	mov    %eax,%ebx
+  80385a:	83 c4 10             	add    $0x10,%esp
+  80385d:	85 c0                	test   %eax,%eax
+  80385f:	0f 88 04 01 00 00    	js     803969 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803865:	83 ec 0c             	sub    $0xc,%esp
+  803868:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80386b:	50                   	push   %eax
+  80386c:	e8 00 e1 ff ff       	call   801971 <fd_alloc>
+  803871:	89 c3                	mov    %eax,%ebx
+  803873:	83 c4 10             	add    $0x10,%esp
+  803876:	85 c0                	test   %eax,%eax
+  803878:	0f 88 db 00 00 00    	js     803959 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80387e:	83 ec 04             	sub    $0x4,%esp
+  803881:	68 07 04 00 00       	push   $0x407
+  803886:	ff 75 f0             	push   -0x10(%ebp)
+  803889:	6a 00                	push   $0x0
+  80388b:	e8 1f d9 ff ff       	call   8011af <sys_page_alloc>
+  803890:	89 c3                	mov    %eax,%ebx
+  803892:	83 c4 10             	add    $0x10,%esp
+  803895:	85 c0                	test   %eax,%eax
+  803897:	0f 88 bc 00 00 00    	js     803959 <pipe+0x131>
+	va = fd2data(fd0);
+  80389d:	83 ec 0c             	sub    $0xc,%esp
+  8038a0:	ff 75 f4             	push   -0xc(%ebp)
+  8038a3:	e8 b2 e0 ff ff       	call   80195a <fd2data>
+  8038a8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038aa:	83 c4 0c             	add    $0xc,%esp
+  8038ad:	68 07 04 00 00       	push   $0x407
+  8038b2:	50                   	push   %eax
+  8038b3:	6a 00                	push   $0x0
+  8038b5:	e8 f5 d8 ff ff       	call   8011af <sys_page_alloc>
+  8038ba:	89 c3                	mov    %eax,%ebx
+  8038bc:	83 c4 10             	add    $0x10,%esp
+  8038bf:	85 c0                	test   %eax,%eax
+  8038c1:	0f 88 82 00 00 00    	js     803949 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038c7:	83 ec 0c             	sub    $0xc,%esp
+  8038ca:	ff 75 f0             	push   -0x10(%ebp)
+  8038cd:	e8 88 e0 ff ff       	call   80195a <fd2data>
+  8038d2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8038d9:	50                   	push   %eax
+  8038da:	6a 00                	push   $0x0
+  8038dc:	56                   	push   %esi
+  8038dd:	6a 00                	push   $0x0
+  8038df:	e8 0e d9 ff ff       	call   8011f2 <sys_page_map>
+  8038e4:	89 c3                	mov    %eax,%ebx
+  8038e6:	83 c4 20             	add    $0x20,%esp
+  8038e9:	85 c0                	test   %eax,%eax
+  8038eb:	78 4e                	js     80393b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8038ed:	a1 60 50 80 00       	mov    0x805060,%eax
+  8038f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038f5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8038f7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038fa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803901:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803904:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803906:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803909:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803910:	83 ec 0c             	sub    $0xc,%esp
+  803913:	ff 75 f4             	push   -0xc(%ebp)
+  803916:	e8 2f e0 ff ff       	call   80194a <fd2num>
+  80391b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80391e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803920:	83 c4 04             	add    $0x4,%esp
+  803923:	ff 75 f0             	push   -0x10(%ebp)
+  803926:	e8 1f e0 ff ff       	call   80194a <fd2num>
+  80392b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80392e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803931:	83 c4 10             	add    $0x10,%esp
+  803934:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803939:	eb 2e                	jmp    803969 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80393b:	83 ec 08             	sub    $0x8,%esp
+  80393e:	56                   	push   %esi
+  80393f:	6a 00                	push   $0x0
+  803941:	e8 ee d8 ff ff       	call   801234 <sys_page_unmap>
+  803946:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803949:	83 ec 08             	sub    $0x8,%esp
+  80394c:	ff 75 f0             	push   -0x10(%ebp)
+  80394f:	6a 00                	push   $0x0
+  803951:	e8 de d8 ff ff       	call   801234 <sys_page_unmap>
+  803956:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803959:	83 ec 08             	sub    $0x8,%esp
+  80395c:	ff 75 f4             	push   -0xc(%ebp)
+  80395f:	6a 00                	push   $0x0
+  803961:	e8 ce d8 ff ff       	call   801234 <sys_page_unmap>
+  803966:	83 c4 10             	add    $0x10,%esp
+}
+  803969:	89 d8                	mov    %ebx,%eax
+  80396b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80396e:	5b                   	pop    %ebx
+  80396f:	5e                   	pop    %esi
+  803970:	5d                   	pop    %ebp
+  803971:	c3                   	ret
+
+00803972 <pipeisclosed>:
+{
+  803972:	55                   	push   %ebp
+  803973:	89 e5                	mov    %esp,%ebp
+  803975:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803978:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80397b:	50                   	push   %eax
+  80397c:	ff 75 08             	push   0x8(%ebp)
+  80397f:	e8 3d e0 ff ff       	call   8019c1 <fd_lookup>
+  803984:	83 c4 10             	add    $0x10,%esp
+  803987:	85 c0                	test   %eax,%eax
+  803989:	78 18                	js     8039a3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80398b:	83 ec 0c             	sub    $0xc,%esp
+  80398e:	ff 75 f4             	push   -0xc(%ebp)
+  803991:	e8 c4 df ff ff       	call   80195a <fd2data>
+  803996:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803998:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80399b:	e8 e6 f9 ff ff       	call   803386 <_pipeisclosed>
+  8039a0:	83 c4 10             	add    $0x10,%esp
+}
+  8039a3:	c9                   	leave
+  8039a4:	c3                   	ret
+
+008039a5 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8039a5:	55                   	push   %ebp
+  8039a6:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8039a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8039b1:	5d                   	pop    %ebp
+  8039b2:	c3                   	ret
+
+008039b3 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8039b3:	55                   	push   %ebp
+  8039b4:	89 e5                	mov    %esp,%ebp
+  8039b6:	53                   	push   %ebx
+  8039b7:	83 ec 04             	sub    $0x4,%esp
+  8039ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8039bd:	8b 03                	mov    (%ebx),%eax
+  8039bf:	85 c0                	test   %eax,%eax
+  8039c1:	75 05                	jne    8039c8 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8039c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c6:	c9                   	leave
+  8039c7:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8039c8:	83 ec 08             	sub    $0x8,%esp
+  8039cb:	50                   	push   %eax
+  8039cc:	8d 43 04             	lea    0x4(%ebx),%eax
+  8039cf:	50                   	push   %eax
+  8039d0:	e8 af da ff ff       	call   801484 <sys_page_batch>
+	pb->pb_n = 0;
+  8039d5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8039db:	83 c4 10             	add    $0x10,%esp
+  8039de:	eb e3                	jmp    8039c3 <pgbatch_flush+0x10>
+
+008039e0 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8039e0:	55                   	push   %ebp
+  8039e1:	89 e5                	mov    %esp,%ebp
+  8039e3:	56                   	push   %esi
+  8039e4:	53                   	push   %ebx
+  8039e5:	89 c3                	mov    %eax,%ebx
+  8039e7:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8039e9:	83 38 20             	cmpl   $0x20,(%eax)
+  8039ec:	74 2c                	je     803a1a <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8039ee:	8b 03                	mov    (%ebx),%eax
+  8039f0:	8d 50 01             	lea    0x1(%eax),%edx
+  8039f3:	89 13                	mov    %edx,(%ebx)
+  8039f5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8039f8:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8039fc:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8039fe:	83 ec 04             	sub    $0x4,%esp
+  803a01:	6a 18                	push   $0x18
+  803a03:	6a 00                	push   $0x0
+  803a05:	50                   	push   %eax
+  803a06:	e8 eb d4 ff ff       	call   800ef6 <memset>
+	return 0;
+  803a0b:	83 c4 10             	add    $0x10,%esp
+  803a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a16:	5b                   	pop    %ebx
+  803a17:	5e                   	pop    %esi
+  803a18:	5d                   	pop    %ebp
+  803a19:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803a1a:	83 ec 0c             	sub    $0xc,%esp
+  803a1d:	50                   	push   %eax
+  803a1e:	e8 90 ff ff ff       	call   8039b3 <pgbatch_flush>
+  803a23:	83 c4 10             	add    $0x10,%esp
+  803a26:	85 c0                	test   %eax,%eax
+  803a28:	79 c4                	jns    8039ee <pgbatch_slot+0xe>
+  803a2a:	eb e7                	jmp    803a13 <pgbatch_slot+0x33>
+
+00803a2c <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803a2c:	55                   	push   %ebp
+  803a2d:	89 e5                	mov    %esp,%ebp
+  803a2f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a32:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a35:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a38:	e8 a3 ff ff ff       	call   8039e0 <pgbatch_slot>
+  803a3d:	85 c0                	test   %eax,%eax
+  803a3f:	78 20                	js     803a61 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803a41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a44:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803a4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a4d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803a50:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a53:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803a56:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a59:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a61:	c9                   	leave
+  803a62:	c3                   	ret
+
+00803a63 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803a63:	55                   	push   %ebp
+  803a64:	89 e5                	mov    %esp,%ebp
+  803a66:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a69:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a6f:	e8 6c ff ff ff       	call   8039e0 <pgbatch_slot>
+  803a74:	85 c0                	test   %eax,%eax
+  803a76:	78 2c                	js     803aa4 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803a78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a7b:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803a81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a84:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803a87:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a8a:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803a8d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a90:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803a93:	8b 55 18             	mov    0x18(%ebp),%edx
+  803a96:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803a99:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803a9c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa4:	c9                   	leave
+  803aa5:	c3                   	ret
+
+00803aa6 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803aa6:	55                   	push   %ebp
+  803aa7:	89 e5                	mov    %esp,%ebp
+  803aa9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803aac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ab2:	e8 29 ff ff ff       	call   8039e0 <pgbatch_slot>
+  803ab7:	85 c0                	test   %eax,%eax
+  803ab9:	78 1a                	js     803ad5 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803abb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803abe:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803ac4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ac7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803aca:	8b 55 10             	mov    0x10(%ebp),%edx
+  803acd:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad5:	c9                   	leave
+  803ad6:	c3                   	ret
+
+00803ad7 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803ad7:	55                   	push   %ebp
+  803ad8:	89 e5                	mov    %esp,%ebp
+  803ada:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803add:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ae3:	e8 f8 fe ff ff       	call   8039e0 <pgbatch_slot>
+  803ae8:	85 c0                	test   %eax,%eax
+  803aea:	78 20                	js     803b0c <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803aec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803aef:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803af5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803af8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803afb:	8b 55 10             	mov    0x10(%ebp),%edx
+  803afe:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803b01:	8b 55 14             	mov    0x14(%ebp),%edx
+  803b04:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803b07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b0c:	c9                   	leave
+  803b0d:	c3                   	ret
+
+00803b0e <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803b0e:	55                   	push   %ebp
+  803b0f:	89 e5                	mov    %esp,%ebp
+  803b11:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803b14:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b1a:	e8 c1 fe ff ff       	call   8039e0 <pgbatch_slot>
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	78 26                	js     803b49 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803b23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b26:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803b2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b2f:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803b32:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b35:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803b38:	8b 55 14             	mov    0x14(%ebp),%edx
+  803b3b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803b3e:	8b 55 18             	mov    0x18(%ebp),%edx
+  803b41:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803b44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b49:	c9                   	leave
+  803b4a:	c3                   	ret
+
+00803b4b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b50:	c3                   	ret
+
+00803b51 <devcons_poll>:
+{
+  803b51:	55                   	push   %ebp
+  803b52:	89 e5                	mov    %esp,%ebp
+  803b54:	53                   	push   %ebx
+  803b55:	83 ec 04             	sub    $0x4,%esp
+  803b58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803b5b:	89 da                	mov    %ebx,%edx
+  803b5d:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803b60:	83 3d 34 9b 80 00 00 	cmpl   $0x0,0x809b34
+  803b67:	74 0c                	je     803b75 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803b69:	89 d8                	mov    %ebx,%eax
+  803b6b:	83 e0 01             	and    $0x1,%eax
+  803b6e:	09 d0                	or     %edx,%eax
+}
+  803b70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b73:	c9                   	leave
+  803b74:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803b75:	e8 97 d5 ff ff       	call   801111 <sys_cgetc>
+  803b7a:	a3 34 9b 80 00       	mov    %eax,0x809b34
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803b7f:	89 da                	mov    %ebx,%edx
+  803b81:	83 e2 04             	and    $0x4,%edx
+  803b84:	85 c0                	test   %eax,%eax
+  803b86:	74 e6                	je     803b6e <devcons_poll+0x1d>
+  803b88:	eb df                	jmp    803b69 <devcons_poll+0x18>
+
+00803b8a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b8a:	55                   	push   %ebp
+  803b8b:	89 e5                	mov    %esp,%ebp
+  803b8d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803b90:	68 b6 48 80 00       	push   $0x8048b6
+  803b95:	ff 75 0c             	push   0xc(%ebp)
+  803b98:	e8 de d1 ff ff       	call   800d7b <strcpy>
+	return 0;
+}
+  803b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba2:	c9                   	leave
+  803ba3:	c3                   	ret
+
+00803ba4 <devcons_write>:
+{
+  803ba4:	55                   	push   %ebp
+  803ba5:	89 e5                	mov    %esp,%ebp
+  803ba7:	57                   	push   %edi
+  803ba8:	56                   	push   %esi
+  803ba9:	53                   	push   %ebx
+  803baa:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803bb0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803bb3:	85 ff                	test   %edi,%edi
+  803bb5:	74 51                	je     803c08 <devcons_write+0x64>
+  803bb7:	be 00 00 00 00       	mov    $0x0,%esi
+  803bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803bc1:	89 fb                	mov    %edi,%ebx
+  803bc3:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803bc5:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803bca:	39 d3                	cmp    %edx,%ebx
+  803bcc:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803bcf:	83 ec 04             	sub    $0x4,%esp
+  803bd2:	53                   	push   %ebx
+  803bd3:	03 45 0c             	add    0xc(%ebp),%eax
+  803bd6:	50                   	push   %eax
+  803bd7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803bdd:	50                   	push   %eax
+  803bde:	e8 48 d3 ff ff       	call   800f2b <memmove>
+		sys_cputs(buf, m);
+  803be3:	83 c4 08             	add    $0x8,%esp
+  803be6:	53                   	push   %ebx
+  803be7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803bed:	50                   	push   %eax
+  803bee:	e8 00 d5 ff ff       	call   8010f3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803bf3:	01 de                	add    %ebx,%esi
+  803bf5:	89 f0                	mov    %esi,%eax
+  803bf7:	83 c4 10             	add    $0x10,%esp
+  803bfa:	39 fe                	cmp    %edi,%esi
+  803bfc:	72 c3                	jb     803bc1 <devcons_write+0x1d>
+}
+  803bfe:	89 f0                	mov    %esi,%eax
+  803c00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c03:	5b                   	pop    %ebx
+  803c04:	5e                   	pop    %esi
+  803c05:	5f                   	pop    %edi
+  803c06:	5d                   	pop    %ebp
+  803c07:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803c08:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803c0d:	eb ef                	jmp    803bfe <devcons_write+0x5a>
+
+00803c0f <devcons_read>:
+{
+  803c0f:	55                   	push   %ebp
+  803c10:	89 e5                	mov    %esp,%ebp
+  803c12:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803c15:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803c1a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c1e:	74 36                	je     803c56 <devcons_read+0x47>
+	c = cons_peek;
+  803c20:	a1 34 9b 80 00       	mov    0x809b34,%eax
+	cons_peek = 0;
+  803c25:	c7 05 34 9b 80 00 00 	movl   $0x0,0x809b34
+  803c2c:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803c2f:	85 c0                	test   %eax,%eax
+  803c31:	75 10                	jne    803c43 <devcons_read+0x34>
+  803c33:	e8 d9 d4 ff ff       	call   801111 <sys_cgetc>
+  803c38:	85 c0                	test   %eax,%eax
+  803c3a:	75 07                	jne    803c43 <devcons_read+0x34>
+		sys_yield();
+  803c3c:	e8 4f d5 ff ff       	call   801190 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803c41:	eb f0                	jmp    803c33 <devcons_read+0x24>
+	if (c < 0)
+  803c43:	85 c0                	test   %eax,%eax
+  803c45:	78 0f                	js     803c56 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803c47:	83 f8 04             	cmp    $0x4,%eax
+  803c4a:	74 0c                	je     803c58 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803c4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c4f:	88 02                	mov    %al,(%edx)
+	return 1;
+  803c51:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803c56:	c9                   	leave
+  803c57:	c3                   	ret
+		return 0;
+  803c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5d:	eb f7                	jmp    803c56 <devcons_read+0x47>
+
+00803c5f <cputchar>:
+{
+  803c5f:	55                   	push   %ebp
+  803c60:	89 e5                	mov    %esp,%ebp
+  803c62:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803c65:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c68:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803c6b:	6a 01                	push   $0x1
+  803c6d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c70:	50                   	push   %eax
+  803c71:	e8 7d d4 ff ff       	call   8010f3 <sys_cputs>
+}
+  803c76:	83 c4 10             	add    $0x10,%esp
+  803c79:	c9                   	leave
+  803c7a:	c3                   	ret
+
+00803c7b <getchar>:
+{
+  803c7b:	55                   	push   %ebp
+  803c7c:	89 e5                	mov    %esp,%ebp
+  803c7e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803c81:	6a 01                	push   $0x1
+  803c83:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c86:	50                   	push   %eax
+  803c87:	6a 00                	push   $0x0
+  803c89:	e8 b7 df ff ff       	call   801c45 <read>
+	if (r < 0)
+  803c8e:	83 c4 10             	add    $0x10,%esp
+  803c91:	85 c0                	test   %eax,%eax
+  803c93:	78 06                	js     803c9b <getchar+0x20>
+	if (r < 1)
+  803c95:	74 06                	je     803c9d <getchar+0x22>
+	return c;
+  803c97:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803c9b:	c9                   	leave
+  803c9c:	c3                   	ret
+		return -E_EOF;
+  803c9d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803ca2:	eb f7                	jmp    803c9b <getchar+0x20>
+
+00803ca4 <iscons>:
+{
+  803ca4:	55                   	push   %ebp
+  803ca5:	89 e5                	mov    %esp,%ebp
+  803ca7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803caa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cad:	50                   	push   %eax
+  803cae:	ff 75 08             	push   0x8(%ebp)
+  803cb1:	e8 0b dd ff ff       	call   8019c1 <fd_lookup>
+  803cb6:	83 c4 10             	add    $0x10,%esp
+  803cb9:	85 c0                	test   %eax,%eax
+  803cbb:	78 11                	js     803cce <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803cbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cc0:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803cc6:	39 10                	cmp    %edx,(%eax)
+  803cc8:	0f 94 c0             	sete   %al
+  803ccb:	0f b6 c0             	movzbl %al,%eax
+}
+  803cce:	c9                   	leave
+  803ccf:	c3                   	ret
+
+00803cd0 <opencons>:
+{
+  803cd0:	55                   	push   %ebp
+  803cd1:	89 e5                	mov    %esp,%ebp
+  803cd3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803cd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cd9:	50                   	push   %eax
+  803cda:	e8 92 dc ff ff       	call   801971 <fd_alloc>
+  803cdf:	83 c4 10             	add    $0x10,%esp
+  803ce2:	85 c0                	test   %eax,%eax
+  803ce4:	78 3a                	js     803d20 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803ce6:	83 ec 04             	sub    $0x4,%esp
+  803ce9:	68 07 04 00 00       	push   $0x407
+  803cee:	ff 75 f4             	push   -0xc(%ebp)
+  803cf1:	6a 00                	push   $0x0
+  803cf3:	e8 b7 d4 ff ff       	call   8011af <sys_page_alloc>
+  803cf8:	83 c4 10             	add    $0x10,%esp
+  803cfb:	85 c0                	test   %eax,%eax
+  803cfd:	78 21                	js     803d20 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803cff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d02:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803d08:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803d0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d0d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803d14:	83 ec 0c             	sub    $0xc,%esp
+  803d17:	50                   	push   %eax
+  803d18:	e8 2d dc ff ff       	call   80194a <fd2num>
+  803d1d:	83 c4 10             	add    $0x10,%esp
+}
+  803d20:	c9                   	leave
+  803d21:	c3                   	ret
+
+00803d22 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803d22:	55                   	push   %ebp
+  803d23:	89 e5                	mov    %esp,%ebp
+  803d25:	56                   	push   %esi
+  803d26:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803d27:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803d2a:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803d30:	e8 3c d4 ff ff       	call   801171 <sys_getenvid>
+  803d35:	83 ec 0c             	sub    $0xc,%esp
+  803d38:	ff 75 0c             	push   0xc(%ebp)
+  803d3b:	ff 75 08             	push   0x8(%ebp)
+  803d3e:	56                   	push   %esi
+  803d3f:	50                   	push   %eax
+  803d40:	68 c4 48 80 00       	push   $0x8048c4
+  803d45:	e8 3a c9 ff ff       	call   800684 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803d4a:	83 c4 18             	add    $0x18,%esp
+  803d4d:	53                   	push   %ebx
+  803d4e:	ff 75 10             	push   0x10(%ebp)
+  803d51:	e8 dd c8 ff ff       	call   800633 <vcprintf>
+	cprintf("\n");
+  803d56:	c7 04 24 a8 48 80 00 	movl   $0x8048a8,(%esp)
+  803d5d:	e8 22 c9 ff ff       	call   800684 <cprintf>
+  803d62:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803d65:	cc                   	int3
+	while (1)
+  803d66:	eb fd                	jmp    803d65 <_panic+0x43>
+
+00803d68 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803d68:	55                   	push   %ebp
+  803d69:	89 e5                	mov    %esp,%ebp
+  803d6b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803d6e:	89 c2                	mov    %eax,%edx
+  803d70:	c1 ea 16             	shr    $0x16,%edx
+  803d73:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803d7f:	f6 c1 01             	test   $0x1,%cl
+  803d82:	74 1e                	je     803da2 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803d84:	c1 e8 0c             	shr    $0xc,%eax
+  803d87:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803d8e:	a8 01                	test   $0x1,%al
+  803d90:	74 10                	je     803da2 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803d92:	c1 e8 0c             	shr    $0xc,%eax
+  803d95:	c1 e0 04             	shl    $0x4,%eax
+  803d98:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803d9f:	0f b7 d2             	movzwl %dx,%edx
+}
+  803da2:	89 d0                	mov    %edx,%eax
+  803da4:	5d                   	pop    %ebp
+  803da5:	c3                   	ret
+
+00803da6 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  803da6:	55                   	push   %ebp
+  803da7:	89 e5                	mov    %esp,%ebp
+  803da9:	57                   	push   %edi
+  803daa:	56                   	push   %esi
+  803dab:	53                   	push   %ebx
+  803dac:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  803daf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803db2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  803db5:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  803db8:	bf 38 9b 80 00       	mov    $0x809b38,%edi
+  803dbd:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  803dc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803dc5:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803dc8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  803dcb:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803dd0:	f6 e2                	mul    %dl
+  803dd2:	66 c1 e8 0b          	shr    $0xb,%ax
+  803dd6:	89 c7                	mov    %eax,%edi
+  803dd8:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803ddb:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803dde:	01 db                	add    %ebx,%ebx
+  803de0:	89 d0                	mov    %edx,%eax
+  803de2:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  803de4:	89 d6                	mov    %edx,%esi
+  803de6:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  803de8:	89 cb                	mov    %ecx,%ebx
+  803dea:	83 c1 01             	add    $0x1,%ecx
+  803ded:	0f b6 fb             	movzbl %bl,%edi
+  803df0:	83 c0 30             	add    $0x30,%eax
+  803df3:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  803df7:	89 f0                	mov    %esi,%eax
+  803df9:	3c 09                	cmp    $0x9,%al
+  803dfb:	77 ce                	ja     803dcb <inet_ntoa+0x25>
+  803dfd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803e00:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803e03:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  803e05:	84 c9                	test   %cl,%cl
+  803e07:	74 4d                	je     803e56 <inet_ntoa+0xb0>
+  803e09:	0f b6 db             	movzbl %bl,%ebx
+  803e0c:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803e0f:	01 d8                	add    %ebx,%eax
+  803e11:	89 f9                	mov    %edi,%ecx
+  803e13:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  803e16:	83 c1 01             	add    $0x1,%ecx
+  803e19:	0f b6 10             	movzbl (%eax),%edx
+  803e1c:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  803e1f:	89 c2                	mov    %eax,%edx
+  803e21:	83 e8 01             	sub    $0x1,%eax
+  803e24:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803e27:	39 da                	cmp    %ebx,%edx
+  803e29:	75 eb                	jne    803e16 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  803e2b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803e2e:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  803e32:	8d 78 01             	lea    0x1(%eax),%edi
+  803e35:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  803e38:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  803e3b:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803e3e:	39 ce                	cmp    %ecx,%esi
+  803e40:	0f 85 77 ff ff ff    	jne    803dbd <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  803e46:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  803e49:	b8 38 9b 80 00       	mov    $0x809b38,%eax
+  803e4e:	83 c4 1c             	add    $0x1c,%esp
+  803e51:	5b                   	pop    %ebx
+  803e52:	5e                   	pop    %esi
+  803e53:	5f                   	pop    %edi
+  803e54:	5d                   	pop    %ebp
+  803e55:	c3                   	ret
+    while(i--)
+  803e56:	89 f8                	mov    %edi,%eax
+  803e58:	eb d8                	jmp    803e32 <inet_ntoa+0x8c>
+
+00803e5a <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  803e5a:	55                   	push   %ebp
+  803e5b:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803e5d:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803e61:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  803e65:	5d                   	pop    %ebp
+  803e66:	c3                   	ret
+
+00803e67 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  803e67:	55                   	push   %ebp
+  803e68:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803e6a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803e6e:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  803e72:	5d                   	pop    %ebp
+  803e73:	c3                   	ret
+
+00803e74 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  803e74:	55                   	push   %ebp
+  803e75:	89 e5                	mov    %esp,%ebp
+  803e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  803e7a:	89 d0                	mov    %edx,%eax
+  803e7c:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  803e7f:	89 d1                	mov    %edx,%ecx
+  803e81:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803e84:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  803e86:	89 d1                	mov    %edx,%ecx
+  803e88:	c1 e1 08             	shl    $0x8,%ecx
+  803e8b:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803e91:	09 c8                	or     %ecx,%eax
+  803e93:	c1 ea 08             	shr    $0x8,%edx
+  803e96:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803e9c:	09 d0                	or     %edx,%eax
+}
+  803e9e:	5d                   	pop    %ebp
+  803e9f:	c3                   	ret
+
+00803ea0 <inet_aton>:
+{
+  803ea0:	55                   	push   %ebp
+  803ea1:	89 e5                	mov    %esp,%ebp
+  803ea3:	57                   	push   %edi
+  803ea4:	56                   	push   %esi
+  803ea5:	53                   	push   %ebx
+  803ea6:	83 ec 2c             	sub    $0x2c,%esp
+  803ea9:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  803eac:	0f b6 0a             	movzbl (%edx),%ecx
+  803eaf:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803eb2:	83 e9 30             	sub    $0x30,%ecx
+  803eb5:	80 f9 09             	cmp    $0x9,%cl
+  803eb8:	0f 87 b6 01 00 00    	ja     804074 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  803ebe:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  803ec1:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803ec4:	e9 aa 00 00 00       	jmp    803f73 <inet_aton+0xd3>
+      c = *++cp;
+  803ec9:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  803ecd:	89 c1                	mov    %eax,%ecx
+  803ecf:	83 e1 df             	and    $0xffffffdf,%ecx
+  803ed2:	80 f9 58             	cmp    $0x58,%cl
+  803ed5:	74 10                	je     803ee7 <inet_aton+0x47>
+      c = *++cp;
+  803ed7:	83 c2 01             	add    $0x1,%edx
+  803eda:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  803edd:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ee2:	e9 9a 00 00 00       	jmp    803f81 <inet_aton+0xe1>
+        c = *++cp;
+  803ee7:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803eeb:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  803eee:	bf 10 00 00 00       	mov    $0x10,%edi
+  803ef3:	e9 89 00 00 00       	jmp    803f81 <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  803ef8:	0f af d7             	imul   %edi,%edx
+  803efb:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  803eff:	0f be 01             	movsbl (%ecx),%eax
+  803f02:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  803f05:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803f08:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803f0b:	80 fb 09             	cmp    $0x9,%bl
+  803f0e:	76 e8                	jbe    803ef8 <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  803f10:	83 ff 10             	cmp    $0x10,%edi
+  803f13:	75 2e                	jne    803f43 <inet_aton+0xa3>
+  803f15:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803f19:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803f1c:	83 e3 df             	and    $0xffffffdf,%ebx
+  803f1f:	83 eb 41             	sub    $0x41,%ebx
+  803f22:	80 fb 05             	cmp    $0x5,%bl
+  803f25:	77 1c                	ja     803f43 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  803f27:	c1 e2 04             	shl    $0x4,%edx
+  803f2a:	83 c0 0a             	add    $0xa,%eax
+  803f2d:	89 f3                	mov    %esi,%ebx
+  803f2f:	80 fb 1a             	cmp    $0x1a,%bl
+  803f32:	19 db                	sbb    %ebx,%ebx
+  803f34:	83 e3 20             	and    $0x20,%ebx
+  803f37:	83 c3 41             	add    $0x41,%ebx
+  803f3a:	29 d8                	sub    %ebx,%eax
+  803f3c:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  803f3e:	0f be 01             	movsbl (%ecx),%eax
+  803f41:	eb bf                	jmp    803f02 <inet_aton+0x62>
+    if (c == '.') {
+  803f43:	83 f8 2e             	cmp    $0x2e,%eax
+  803f46:	75 46                	jne    803f8e <inet_aton+0xee>
+      if (pp >= parts + 3)
+  803f48:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803f4b:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803f4e:	39 f0                	cmp    %esi,%eax
+  803f50:	0f 84 25 01 00 00    	je     80407b <inet_aton+0x1db>
+      *pp++ = val;
+  803f56:	83 c0 04             	add    $0x4,%eax
+  803f59:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803f5c:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  803f5f:	89 ca                	mov    %ecx,%edx
+  803f61:	0f b6 09             	movzbl (%ecx),%ecx
+  803f64:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803f67:	83 e9 30             	sub    $0x30,%ecx
+  803f6a:	80 f9 09             	cmp    $0x9,%cl
+  803f6d:	0f 87 17 01 00 00    	ja     80408a <inet_aton+0x1ea>
+    base = 10;
+  803f73:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  803f78:	83 f8 30             	cmp    $0x30,%eax
+  803f7b:	0f 84 48 ff ff ff    	je     803ec9 <inet_aton+0x29>
+  803f81:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  803f84:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f89:	e9 77 ff ff ff       	jmp    803f05 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803f8e:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803f92:	89 d6                	mov    %edx,%esi
+  803f94:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803f97:	85 c0                	test   %eax,%eax
+  803f99:	74 2e                	je     803fc9 <inet_aton+0x129>
+    return (0);
+  803f9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803fa0:	89 fa                	mov    %edi,%edx
+  803fa2:	80 fa 1f             	cmp    $0x1f,%dl
+  803fa5:	0f 86 d5 00 00 00    	jbe    804080 <inet_aton+0x1e0>
+  803fab:	84 c0                	test   %al,%al
+  803fad:	0f 88 cd 00 00 00    	js     804080 <inet_aton+0x1e0>
+  803fb3:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803fb6:	83 f9 04             	cmp    $0x4,%ecx
+  803fb9:	76 0e                	jbe    803fc9 <inet_aton+0x129>
+    return (0);
+  803fbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803fc0:	83 f8 20             	cmp    $0x20,%eax
+  803fc3:	0f 85 b7 00 00 00    	jne    804080 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  803fc9:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803fcc:	89 d8                	mov    %ebx,%eax
+  803fce:	29 c8                	sub    %ecx,%eax
+  803fd0:	c1 f8 02             	sar    $0x2,%eax
+  803fd3:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  803fd6:	83 f8 02             	cmp    $0x2,%eax
+  803fd9:	74 7a                	je     804055 <inet_aton+0x1b5>
+  803fdb:	83 f9 03             	cmp    $0x3,%ecx
+  803fde:	7f 49                	jg     804029 <inet_aton+0x189>
+  803fe0:	85 c9                	test   %ecx,%ecx
+  803fe2:	0f 84 98 00 00 00    	je     804080 <inet_aton+0x1e0>
+  803fe8:	83 f9 02             	cmp    $0x2,%ecx
+  803feb:	75 19                	jne    804006 <inet_aton+0x166>
+      return (0);
+  803fed:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  803ff2:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803ff8:	0f 87 82 00 00 00    	ja     804080 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  803ffe:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  804001:	c1 e0 18             	shl    $0x18,%eax
+  804004:	09 c6                	or     %eax,%esi
+  return (1);
+  804006:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80400b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80400f:	74 6f                	je     804080 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  804011:	83 ec 0c             	sub    $0xc,%esp
+  804014:	56                   	push   %esi
+  804015:	e8 5a fe ff ff       	call   803e74 <htonl>
+  80401a:	83 c4 10             	add    $0x10,%esp
+  80401d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804020:	89 06                	mov    %eax,(%esi)
+  return (1);
+  804022:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804027:	eb 57                	jmp    804080 <inet_aton+0x1e0>
+  switch (n) {
+  804029:	83 f9 04             	cmp    $0x4,%ecx
+  80402c:	75 d8                	jne    804006 <inet_aton+0x166>
+      return (0);
+  80402e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  804033:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  804039:	77 45                	ja     804080 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80403b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80403e:	c1 e0 18             	shl    $0x18,%eax
+  804041:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  804044:	c1 e1 10             	shl    $0x10,%ecx
+  804047:	09 c8                	or     %ecx,%eax
+  804049:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80404c:	c1 e1 08             	shl    $0x8,%ecx
+  80404f:	09 c8                	or     %ecx,%eax
+  804051:	09 c6                	or     %eax,%esi
+    break;
+  804053:	eb b1                	jmp    804006 <inet_aton+0x166>
+      return (0);
+  804055:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  80405a:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  804060:	77 1e                	ja     804080 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  804062:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  804065:	c1 e0 18             	shl    $0x18,%eax
+  804068:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80406b:	c1 e1 10             	shl    $0x10,%ecx
+  80406e:	09 c8                	or     %ecx,%eax
+  804070:	09 c6                	or     %eax,%esi
+    break;
+  804072:	eb 92                	jmp    804006 <inet_aton+0x166>
+      return (0);
+  804074:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804079:	eb 05                	jmp    804080 <inet_aton+0x1e0>
+        return (0);
+  80407b:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  804080:	89 c8                	mov    %ecx,%eax
+  804082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804085:	5b                   	pop    %ebx
+  804086:	5e                   	pop    %esi
+  804087:	5f                   	pop    %edi
+  804088:	5d                   	pop    %ebp
+  804089:	c3                   	ret
+      return (0);
+  80408a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80408f:	eb ef                	jmp    804080 <inet_aton+0x1e0>
+
+00804091 <inet_addr>:
+{
+  804091:	55                   	push   %ebp
+  804092:	89 e5                	mov    %esp,%ebp
+  804094:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  804097:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80409a:	50                   	push   %eax
+  80409b:	ff 75 08             	push   0x8(%ebp)
+  80409e:	e8 fd fd ff ff       	call   803ea0 <inet_aton>
+  8040a3:	89 c2                	mov    %eax,%edx
+  8040a5:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8040a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8040ad:	85 d2                	test   %edx,%edx
+  8040af:	75 02                	jne    8040b3 <inet_addr+0x22>
+}
+  8040b1:	c9                   	leave
+  8040b2:	c3                   	ret
+    return (val.s_addr);
+  8040b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8040b6:	eb f9                	jmp    8040b1 <inet_addr+0x20>
+
+008040b8 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8040b8:	55                   	push   %ebp
+  8040b9:	89 e5                	mov    %esp,%ebp
+  8040bb:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8040be:	ff 75 08             	push   0x8(%ebp)
+  8040c1:	e8 ae fd ff ff       	call   803e74 <htonl>
+  8040c6:	83 c4 10             	add    $0x10,%esp
+}
+  8040c9:	c9                   	leave
+  8040ca:	c3                   	ret
+
+008040cb <__udivdi3>:
+  8040cb:	57                   	push   %edi
+  8040cc:	56                   	push   %esi
+  8040cd:	53                   	push   %ebx
+  8040ce:	83 ec 20             	sub    $0x20,%esp
+  8040d1:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8040d5:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8040d9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8040dd:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8040e1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8040e5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8040e9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8040ed:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8040f1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8040f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804100:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804107:	00 
+  804108:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80410f:	00 
+  804110:	eb 08                	jmp    80411a <__udivdi3+0x4f>
+  804112:	83 e9 01             	sub    $0x1,%ecx
+  804115:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804118:	74 68                	je     804182 <__udivdi3+0xb7>
+  80411a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80411e:	01 c0                	add    %eax,%eax
+  804120:	89 c6                	mov    %eax,%esi
+  804122:	89 d7                	mov    %edx,%edi
+  804124:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804128:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80412c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80412f:	d3 ea                	shr    %cl,%edx
+  804131:	f6 c1 20             	test   $0x20,%cl
+  804134:	74 04                	je     80413a <__udivdi3+0x6f>
+  804136:	89 d0                	mov    %edx,%eax
+  804138:	31 d2                	xor    %edx,%edx
+  80413a:	83 e0 01             	and    $0x1,%eax
+  80413d:	89 04 24             	mov    %eax,(%esp)
+  804140:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804147:	00 
+  804148:	8b 04 24             	mov    (%esp),%eax
+  80414b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80414f:	09 f0                	or     %esi,%eax
+  804151:	09 fa                	or     %edi,%edx
+  804153:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804157:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80415b:	39 f0                	cmp    %esi,%eax
+  80415d:	89 d3                	mov    %edx,%ebx
+  80415f:	19 fb                	sbb    %edi,%ebx
+  804161:	72 af                	jb     804112 <__udivdi3+0x47>
+  804163:	29 f0                	sub    %esi,%eax
+  804165:	19 fa                	sbb    %edi,%edx
+  804167:	89 cf                	mov    %ecx,%edi
+  804169:	c1 ef 05             	shr    $0x5,%edi
+  80416c:	83 e7 01             	and    $0x1,%edi
+  80416f:	89 fe                	mov    %edi,%esi
+  804171:	83 f6 01             	xor    $0x1,%esi
+  804174:	d3 e6                	shl    %cl,%esi
+  804176:	d3 e7                	shl    %cl,%edi
+  804178:	09 74 24 18          	or     %esi,0x18(%esp)
+  80417c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804180:	eb 90                	jmp    804112 <__udivdi3+0x47>
+  804182:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804186:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80418a:	83 c4 20             	add    $0x20,%esp
+  80418d:	5b                   	pop    %ebx
+  80418e:	5e                   	pop    %esi
+  80418f:	5f                   	pop    %edi
+  804190:	c3                   	ret
+
+00804191 <__umoddi3>:
+  804191:	57                   	push   %edi
+  804192:	56                   	push   %esi
+  804193:	53                   	push   %ebx
+  804194:	83 ec 08             	sub    $0x8,%esp
+  804197:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80419b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80419f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8041a3:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8041a7:	57                   	push   %edi
+  8041a8:	56                   	push   %esi
+  8041a9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8041ad:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8041b1:	52                   	push   %edx
+  8041b2:	50                   	push   %eax
+  8041b3:	e8 13 ff ff ff       	call   8040cb <__udivdi3>
+  8041b8:	89 c3                	mov    %eax,%ebx
+  8041ba:	0f af d6             	imul   %esi,%edx
+  8041bd:	89 f9                	mov    %edi,%ecx
+  8041bf:	0f af cb             	imul   %ebx,%ecx
+  8041c2:	01 d1                	add    %edx,%ecx
+  8041c4:	89 d8                	mov    %ebx,%eax
+  8041c6:	f7 e6                	mul    %esi
+  8041c8:	89 c6                	mov    %eax,%esi
+  8041ca:	89 d7                	mov    %edx,%edi
+  8041cc:	01 cf                	add    %ecx,%edi
+  8041ce:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8041d2:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8041d6:	29 f0                	sub    %esi,%eax
+  8041d8:	19 fa                	sbb    %edi,%edx
+  8041da:	83 c4 18             	add    $0x18,%esp
+  8041dd:	5b                   	pop    %ebx
+  8041de:	5e                   	pop    %esi
+  8041df:	5f                   	pop    %edi
+  8041e0:	c3                   	ret
+
+008041e1 <__divdi3>:
+  8041e1:	53                   	push   %ebx
+  8041e2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8041e6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8041ea:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8041ee:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8041f2:	85 d2                	test   %edx,%edx
+  8041f4:	78 12                	js     804208 <__divdi3+0x27>
+  8041f6:	85 db                	test   %ebx,%ebx
+  8041f8:	78 2e                	js     804228 <__divdi3+0x47>
+  8041fa:	53                   	push   %ebx
+  8041fb:	51                   	push   %ecx
+  8041fc:	52                   	push   %edx
+  8041fd:	50                   	push   %eax
+  8041fe:	e8 c8 fe ff ff       	call   8040cb <__udivdi3>
+  804203:	83 c4 10             	add    $0x10,%esp
+  804206:	eb 1e                	jmp    804226 <__divdi3+0x45>
+  804208:	f7 d8                	neg    %eax
+  80420a:	83 d2 00             	adc    $0x0,%edx
+  80420d:	f7 da                	neg    %edx
+  80420f:	85 db                	test   %ebx,%ebx
+  804211:	78 2a                	js     80423d <__divdi3+0x5c>
+  804213:	53                   	push   %ebx
+  804214:	51                   	push   %ecx
+  804215:	52                   	push   %edx
+  804216:	50                   	push   %eax
+  804217:	e8 af fe ff ff       	call   8040cb <__udivdi3>
+  80421c:	83 c4 10             	add    $0x10,%esp
+  80421f:	f7 d8                	neg    %eax
+  804221:	83 d2 00             	adc    $0x0,%edx
+  804224:	f7 da                	neg    %edx
+  804226:	5b                   	pop    %ebx
+  804227:	c3                   	ret
+  804228:	f7 d9                	neg    %ecx
+  80422a:	83 d3 00             	adc    $0x0,%ebx
+  80422d:	f7 db                	neg    %ebx
+  80422f:	53                   	push   %ebx
+  804230:	51                   	push   %ecx
+  804231:	52                   	push   %edx
+  804232:	50                   	push   %eax
+  804233:	e8 93 fe ff ff       	call   8040cb <__udivdi3>
+  804238:	83 c4 10             	add    $0x10,%esp
+  80423b:	eb e2                	jmp    80421f <__divdi3+0x3e>
+  80423d:	f7 d9                	neg    %ecx
+  80423f:	83 d3 00             	adc    $0x0,%ebx
+  804242:	f7 db                	neg    %ebx
+  804244:	53                   	push   %ebx
+  804245:	51                   	push   %ecx
+  804246:	52                   	push   %edx
+  804247:	50                   	push   %eax
+  804248:	e8 7e fe ff ff       	call   8040cb <__udivdi3>
+  80424d:	83 c4 10             	add    $0x10,%esp
+  804250:	eb d4                	jmp    804226 <__divdi3+0x45>
+
+00804252 <__moddi3>:
+  804252:	57                   	push   %edi
+  804253:	56                   	push   %esi
+  804254:	53                   	push   %ebx
+  804255:	83 ec 08             	sub    $0x8,%esp
+  804258:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80425c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804260:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804264:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804268:	57                   	push   %edi
+  804269:	56                   	push   %esi
+  80426a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80426e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804272:	52                   	push   %edx
+  804273:	50                   	push   %eax
+  804274:	e8 68 ff ff ff       	call   8041e1 <__divdi3>
+  804279:	89 c3                	mov    %eax,%ebx
+  80427b:	0f af d6             	imul   %esi,%edx
+  80427e:	89 f9                	mov    %edi,%ecx
+  804280:	0f af cb             	imul   %ebx,%ecx
+  804283:	01 d1                	add    %edx,%ecx
+  804285:	89 d8                	mov    %ebx,%eax
+  804287:	f7 e6                	mul    %esi
+  804289:	89 c6                	mov    %eax,%esi
+  80428b:	89 d7                	mov    %edx,%edi
+  80428d:	01 cf                	add    %ecx,%edi
+  80428f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804293:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804297:	29 f0                	sub    %esi,%eax
+  804299:	19 fa                	sbb    %edi,%edx
+  80429b:	83 c4 18             	add    $0x18,%esp
+  80429e:	5b                   	pop    %ebx
+  80429f:	5e                   	pop    %esi
+  8042a0:	5f                   	pop    %edi
+  8042a1:	c3                   	ret
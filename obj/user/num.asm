@@ -0,0 +1,8190 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 52 01 00 00       	call   800183 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	83 ec 10             	sub    $0x10,%esp
+  80003d:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+	char c;
+
+	while ((n = read(f, &c, 1)) > 0) {
+  800040:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800043:	eb 1b                	jmp    800060 <num+0x2b>
+		if (bol) {
+			printf("%5d ", ++line);
+			bol = 0;
+		}
+		if ((r = write(1, &c, 1)) != 1)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 01                	push   $0x1
+  80004a:	53                   	push   %ebx
+  80004b:	6a 01                	push   $0x1
+  80004d:	e8 34 16 00 00       	call   801686 <write>
+  800052:	83 c4 10             	add    $0x10,%esp
+  800055:	83 f8 01             	cmp    $0x1,%eax
+  800058:	75 4c                	jne    8000a6 <num+0x71>
+			panic("write error copying %s: %e", s, r);
+		if (c == '\n')
+  80005a:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005e:	74 5e                	je     8000be <num+0x89>
+	while ((n = read(f, &c, 1)) > 0) {
+  800060:	83 ec 04             	sub    $0x4,%esp
+  800063:	6a 01                	push   $0x1
+  800065:	53                   	push   %ebx
+  800066:	56                   	push   %esi
+  800067:	e8 22 15 00 00       	call   80158e <read>
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	7e 57                	jle    8000ca <num+0x95>
+		if (bol) {
+  800073:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80007a:	74 c9                	je     800045 <num+0x10>
+			printf("%5d ", ++line);
+  80007c:	a1 00 60 80 00       	mov    0x806000,%eax
+  800081:	83 c0 01             	add    $0x1,%eax
+  800084:	a3 00 60 80 00       	mov    %eax,0x806000
+  800089:	83 ec 08             	sub    $0x8,%esp
+  80008c:	50                   	push   %eax
+  80008d:	68 e0 3c 80 00       	push   $0x803ce0
+  800092:	e8 6c 1c 00 00       	call   801d03 <printf>
+			bol = 0;
+  800097:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80009e:	00 00 00 
+  8000a1:	83 c4 10             	add    $0x10,%esp
+  8000a4:	eb 9f                	jmp    800045 <num+0x10>
+			panic("write error copying %s: %e", s, r);
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	50                   	push   %eax
+  8000aa:	ff 75 0c             	push   0xc(%ebp)
+  8000ad:	68 e5 3c 80 00       	push   $0x803ce5
+  8000b2:	6a 13                	push   $0x13
+  8000b4:	68 00 3d 80 00       	push   $0x803d00
+  8000b9:	e8 6c 01 00 00       	call   80022a <_panic>
+			bol = 1;
+  8000be:	c7 05 00 50 80 00 01 	movl   $0x1,0x805000
+  8000c5:	00 00 00 
+  8000c8:	eb 96                	jmp    800060 <num+0x2b>
+	}
+	if (n < 0)
+  8000ca:	78 07                	js     8000d3 <num+0x9e>
+		panic("error reading %s: %e", s, n);
+}
+  8000cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cf:	5b                   	pop    %ebx
+  8000d0:	5e                   	pop    %esi
+  8000d1:	5d                   	pop    %ebp
+  8000d2:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  8000d3:	83 ec 0c             	sub    $0xc,%esp
+  8000d6:	50                   	push   %eax
+  8000d7:	ff 75 0c             	push   0xc(%ebp)
+  8000da:	68 0b 3d 80 00       	push   $0x803d0b
+  8000df:	6a 18                	push   $0x18
+  8000e1:	68 00 3d 80 00       	push   $0x803d00
+  8000e6:	e8 3f 01 00 00       	call   80022a <_panic>
+
+008000eb <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 0c             	sub    $0xc,%esp
+	int f, i;
+
+	binaryname = "num";
+  8000f4:	c7 05 04 50 80 00 20 	movl   $0x803d20,0x805004
+  8000fb:	3d 80 00 
+	if (argc == 1)
+  8000fe:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800102:	74 54                	je     800158 <umain+0x6d>
+		num(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  800104:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800107:	8d 70 04             	lea    0x4(%eax),%esi
+  80010a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010f:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800113:	7e 36                	jle    80014b <umain+0x60>
+			f = open(argv[i], O_RDONLY);
+  800115:	83 ec 08             	sub    $0x8,%esp
+  800118:	6a 00                	push   $0x0
+  80011a:	ff 36                	push   (%esi)
+  80011c:	e8 66 19 00 00       	call   801a87 <open>
+  800121:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	85 c0                	test   %eax,%eax
+  800128:	78 42                	js     80016c <umain+0x81>
+				panic("can't open %s: %e", argv[i], f);
+			else {
+				num(f, argv[i]);
+  80012a:	83 ec 08             	sub    $0x8,%esp
+  80012d:	ff 36                	push   (%esi)
+  80012f:	50                   	push   %eax
+  800130:	e8 00 ff ff ff       	call   800035 <num>
+				close(f);
+  800135:	89 1c 24             	mov    %ebx,(%esp)
+  800138:	e8 12 13 00 00       	call   80144f <close>
+		for (i = 1; i < argc; i++) {
+  80013d:	83 c7 01             	add    $0x1,%edi
+  800140:	83 c6 04             	add    $0x4,%esi
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	39 7d 08             	cmp    %edi,0x8(%ebp)
+  800149:	75 ca                	jne    800115 <umain+0x2a>
+			}
+		}
+	exit();
+  80014b:	e8 c0 00 00 00       	call   800210 <exit>
+}
+  800150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800153:	5b                   	pop    %ebx
+  800154:	5e                   	pop    %esi
+  800155:	5f                   	pop    %edi
+  800156:	5d                   	pop    %ebp
+  800157:	c3                   	ret
+		num(0, "<stdin>");
+  800158:	83 ec 08             	sub    $0x8,%esp
+  80015b:	68 24 3d 80 00       	push   $0x803d24
+  800160:	6a 00                	push   $0x0
+  800162:	e8 ce fe ff ff       	call   800035 <num>
+  800167:	83 c4 10             	add    $0x10,%esp
+  80016a:	eb df                	jmp    80014b <umain+0x60>
+				panic("can't open %s: %e", argv[i], f);
+  80016c:	83 ec 0c             	sub    $0xc,%esp
+  80016f:	50                   	push   %eax
+  800170:	ff 36                	push   (%esi)
+  800172:	68 2c 3d 80 00       	push   $0x803d2c
+  800177:	6a 27                	push   $0x27
+  800179:	68 00 3d 80 00       	push   $0x803d00
+  80017e:	e8 a7 00 00 00       	call   80022a <_panic>
+
+00800183 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800183:	55                   	push   %ebp
+  800184:	89 e5                	mov    %esp,%ebp
+  800186:	56                   	push   %esi
+  800187:	53                   	push   %ebx
+  800188:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80018b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80018e:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800190:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800195:	29 d0                	sub    %edx,%eax
+  800197:	89 c2                	mov    %eax,%edx
+  800199:	c1 ea 0f             	shr    $0xf,%edx
+  80019c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8001a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a6:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8001a9:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  8001b0:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8001b4:	e8 39 0c 00 00       	call   800df2 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8001b9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001be:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8001c4:	89 e1                	mov    %esp,%ecx
+  8001c6:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8001cb:	29 ca                	sub    %ecx,%edx
+  8001cd:	89 d1                	mov    %edx,%ecx
+  8001cf:	c1 e9 0f             	shr    $0xf,%ecx
+  8001d2:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8001d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001dd:	0f 42 d1             	cmovb  %ecx,%edx
+  8001e0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001e5:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ec:	85 db                	test   %ebx,%ebx
+  8001ee:	7e 07                	jle    8001f7 <libmain+0x74>
+		binaryname = argv[0];
+  8001f0:	8b 06                	mov    (%esi),%eax
+  8001f2:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  8001f7:	83 ec 08             	sub    $0x8,%esp
+  8001fa:	56                   	push   %esi
+  8001fb:	53                   	push   %ebx
+  8001fc:	e8 ea fe ff ff       	call   8000eb <umain>
+
+	// exit gracefully
+	exit();
+  800201:	e8 0a 00 00 00       	call   800210 <exit>
+}
+  800206:	83 c4 10             	add    $0x10,%esp
+  800209:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020c:	5b                   	pop    %ebx
+  80020d:	5e                   	pop    %esi
+  80020e:	5d                   	pop    %ebp
+  80020f:	c3                   	ret
+
+00800210 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800210:	55                   	push   %ebp
+  800211:	89 e5                	mov    %esp,%ebp
+  800213:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800216:	e8 61 12 00 00       	call   80147c <close_all>
+	sys_env_destroy(0);
+  80021b:	83 ec 0c             	sub    $0xc,%esp
+  80021e:	6a 00                	push   $0x0
+  800220:	e8 8c 0b 00 00       	call   800db1 <sys_env_destroy>
+}
+  800225:	83 c4 10             	add    $0x10,%esp
+  800228:	c9                   	leave
+  800229:	c3                   	ret
+
+0080022a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80022a:	55                   	push   %ebp
+  80022b:	89 e5                	mov    %esp,%ebp
+  80022d:	56                   	push   %esi
+  80022e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80022f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800232:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  800238:	e8 b5 0b 00 00       	call   800df2 <sys_getenvid>
+  80023d:	83 ec 0c             	sub    $0xc,%esp
+  800240:	ff 75 0c             	push   0xc(%ebp)
+  800243:	ff 75 08             	push   0x8(%ebp)
+  800246:	56                   	push   %esi
+  800247:	50                   	push   %eax
+  800248:	68 48 3d 80 00       	push   $0x803d48
+  80024d:	e8 b3 00 00 00       	call   800305 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800252:	83 c4 18             	add    $0x18,%esp
+  800255:	53                   	push   %ebx
+  800256:	ff 75 10             	push   0x10(%ebp)
+  800259:	e8 56 00 00 00       	call   8002b4 <vcprintf>
+	cprintf("\n");
+  80025e:	c7 04 24 d0 41 80 00 	movl   $0x8041d0,(%esp)
+  800265:	e8 9b 00 00 00       	call   800305 <cprintf>
+  80026a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80026d:	cc                   	int3
+	while (1)
+  80026e:	eb fd                	jmp    80026d <_panic+0x43>
+
+00800270 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800270:	55                   	push   %ebp
+  800271:	89 e5                	mov    %esp,%ebp
+  800273:	53                   	push   %ebx
+  800274:	83 ec 04             	sub    $0x4,%esp
+  800277:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027a:	8b 13                	mov    (%ebx),%edx
+  80027c:	8d 42 01             	lea    0x1(%edx),%eax
+  80027f:	89 03                	mov    %eax,(%ebx)
+  800281:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800284:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800288:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80028d:	74 09                	je     800298 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80028f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800293:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800296:	c9                   	leave
+  800297:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800298:	83 ec 08             	sub    $0x8,%esp
+  80029b:	68 ff 00 00 00       	push   $0xff
+  8002a0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a3:	50                   	push   %eax
+  8002a4:	e8 cb 0a 00 00       	call   800d74 <sys_cputs>
+		b->idx = 0;
+  8002a9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002af:	83 c4 10             	add    $0x10,%esp
+  8002b2:	eb db                	jmp    80028f <putch+0x1f>
+
+008002b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002bd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c4:	00 00 00 
+	b.cnt = 0;
+  8002c7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002ce:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d1:	ff 75 0c             	push   0xc(%ebp)
+  8002d4:	ff 75 08             	push   0x8(%ebp)
+  8002d7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002dd:	50                   	push   %eax
+  8002de:	68 70 02 80 00       	push   $0x800270
+  8002e3:	e8 1c 01 00 00       	call   800404 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002e8:	83 c4 08             	add    $0x8,%esp
+  8002eb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002f7:	50                   	push   %eax
+  8002f8:	e8 77 0a 00 00       	call   800d74 <sys_cputs>
+
+	return b.cnt;
+}
+  8002fd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+
+00800305 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80030e:	50                   	push   %eax
+  80030f:	ff 75 08             	push   0x8(%ebp)
+  800312:	e8 9d ff ff ff       	call   8002b4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800317:	c9                   	leave
+  800318:	c3                   	ret
+
+00800319 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	57                   	push   %edi
+  80031d:	56                   	push   %esi
+  80031e:	53                   	push   %ebx
+  80031f:	83 ec 1c             	sub    $0x1c,%esp
+  800322:	89 c3                	mov    %eax,%ebx
+  800324:	89 d6                	mov    %edx,%esi
+  800326:	8b 45 08             	mov    0x8(%ebp),%eax
+  800329:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032c:	89 d1                	mov    %edx,%ecx
+  80032e:	89 c2                	mov    %eax,%edx
+  800330:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800333:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800336:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800339:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80033c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800343:	39 c2                	cmp    %eax,%edx
+  800345:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800348:	73 4b                	jae    800395 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80034a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800350:	85 ff                	test   %edi,%edi
+  800352:	7e 11                	jle    800365 <printnum+0x4c>
+			putch(padc, putdat);
+  800354:	83 ec 08             	sub    $0x8,%esp
+  800357:	56                   	push   %esi
+  800358:	ff 75 18             	push   0x18(%ebp)
+  80035b:	ff d3                	call   *%ebx
+		while (--width > 0)
+  80035d:	83 c4 10             	add    $0x10,%esp
+  800360:	83 ef 01             	sub    $0x1,%edi
+  800363:	75 ef                	jne    800354 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800365:	83 ec 08             	sub    $0x8,%esp
+  800368:	56                   	push   %esi
+  800369:	83 ec 04             	sub    $0x4,%esp
+  80036c:	ff 75 e4             	push   -0x1c(%ebp)
+  80036f:	ff 75 e0             	push   -0x20(%ebp)
+  800372:	ff 75 dc             	push   -0x24(%ebp)
+  800375:	ff 75 d8             	push   -0x28(%ebp)
+  800378:	e8 3e 38 00 00       	call   803bbb <__umoddi3>
+  80037d:	83 c4 14             	add    $0x14,%esp
+  800380:	0f be 80 6b 3d 80 00 	movsbl 0x803d6b(%eax),%eax
+  800387:	50                   	push   %eax
+  800388:	ff d3                	call   *%ebx
+}
+  80038a:	83 c4 10             	add    $0x10,%esp
+  80038d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800390:	5b                   	pop    %ebx
+  800391:	5e                   	pop    %esi
+  800392:	5f                   	pop    %edi
+  800393:	5d                   	pop    %ebp
+  800394:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800395:	83 ec 0c             	sub    $0xc,%esp
+  800398:	ff 75 18             	push   0x18(%ebp)
+  80039b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80039e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003a1:	52                   	push   %edx
+  8003a2:	50                   	push   %eax
+  8003a3:	83 ec 08             	sub    $0x8,%esp
+  8003a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a9:	ff 75 e0             	push   -0x20(%ebp)
+  8003ac:	ff 75 dc             	push   -0x24(%ebp)
+  8003af:	ff 75 d8             	push   -0x28(%ebp)
+  8003b2:	e8 3e 37 00 00       	call   803af5 <__udivdi3>
+  8003b7:	83 c4 18             	add    $0x18,%esp
+  8003ba:	52                   	push   %edx
+  8003bb:	50                   	push   %eax
+  8003bc:	89 f2                	mov    %esi,%edx
+  8003be:	89 d8                	mov    %ebx,%eax
+  8003c0:	e8 54 ff ff ff       	call   800319 <printnum>
+  8003c5:	83 c4 20             	add    $0x20,%esp
+  8003c8:	eb 9b                	jmp    800365 <printnum+0x4c>
+
+008003ca <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003ca:	55                   	push   %ebp
+  8003cb:	89 e5                	mov    %esp,%ebp
+  8003cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003d0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d4:	8b 10                	mov    (%eax),%edx
+  8003d6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d9:	73 0a                	jae    8003e5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003db:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003de:	89 08                	mov    %ecx,(%eax)
+  8003e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e3:	88 02                	mov    %al,(%edx)
+}
+  8003e5:	5d                   	pop    %ebp
+  8003e6:	c3                   	ret
+
+008003e7 <printfmt>:
+{
+  8003e7:	55                   	push   %ebp
+  8003e8:	89 e5                	mov    %esp,%ebp
+  8003ea:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003ed:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003f0:	50                   	push   %eax
+  8003f1:	ff 75 10             	push   0x10(%ebp)
+  8003f4:	ff 75 0c             	push   0xc(%ebp)
+  8003f7:	ff 75 08             	push   0x8(%ebp)
+  8003fa:	e8 05 00 00 00       	call   800404 <vprintfmt>
+}
+  8003ff:	83 c4 10             	add    $0x10,%esp
+  800402:	c9                   	leave
+  800403:	c3                   	ret
+
+00800404 <vprintfmt>:
+{
+  800404:	55                   	push   %ebp
+  800405:	89 e5                	mov    %esp,%ebp
+  800407:	57                   	push   %edi
+  800408:	56                   	push   %esi
+  800409:	53                   	push   %ebx
+  80040a:	83 ec 2c             	sub    $0x2c,%esp
+  80040d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800410:	89 df                	mov    %ebx,%edi
+  800412:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800415:	8b 45 10             	mov    0x10(%ebp),%eax
+  800418:	8d 70 01             	lea    0x1(%eax),%esi
+  80041b:	0f b6 00             	movzbl (%eax),%eax
+  80041e:	83 f8 25             	cmp    $0x25,%eax
+  800421:	74 1e                	je     800441 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800423:	85 c0                	test   %eax,%eax
+  800425:	0f 84 15 05 00 00    	je     800940 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80042b:	83 ec 08             	sub    $0x8,%esp
+  80042e:	53                   	push   %ebx
+  80042f:	50                   	push   %eax
+  800430:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800432:	83 c6 01             	add    $0x1,%esi
+  800435:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800439:	83 c4 10             	add    $0x10,%esp
+  80043c:	83 f8 25             	cmp    $0x25,%eax
+  80043f:	75 e2                	jne    800423 <vprintfmt+0x1f>
+		padc = ' ';
+  800441:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800445:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80044c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800453:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80045a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80045f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800462:	8d 56 01             	lea    0x1(%esi),%edx
+  800465:	0f b6 0e             	movzbl (%esi),%ecx
+  800468:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80046b:	3c 55                	cmp    $0x55,%al
+  80046d:	0f 87 3b 04 00 00    	ja     8008ae <vprintfmt+0x4aa>
+  800473:	0f b6 c0             	movzbl %al,%eax
+  800476:	ff 24 85 e0 3e 80 00 	jmp    *0x803ee0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80047d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800480:	eb 93                	jmp    800415 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800482:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800484:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800488:	eb d8                	jmp    800462 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80048a:	89 d6                	mov    %edx,%esi
+  80048c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800490:	eb d0                	jmp    800462 <vprintfmt+0x5e>
+  800492:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800495:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800498:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80049b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80049f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004a2:	83 f9 09             	cmp    $0x9,%ecx
+  8004a5:	77 6f                	ja     800516 <vprintfmt+0x112>
+  8004a7:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8004aa:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8004ad:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004b0:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8004b4:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8004b7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004ba:	83 fe 09             	cmp    $0x9,%esi
+  8004bd:	76 eb                	jbe    8004aa <vprintfmt+0xa6>
+  8004bf:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8004c2:	89 d6                	mov    %edx,%esi
+  8004c4:	eb 13                	jmp    8004d9 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8004c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c9:	8b 00                	mov    (%eax),%eax
+  8004cb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d7:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8004d9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004dd:	79 83                	jns    800462 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8004df:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004ec:	e9 71 ff ff ff       	jmp    800462 <vprintfmt+0x5e>
+			if (width < 0)
+  8004f1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004f4:	85 c9                	test   %ecx,%ecx
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	0f 49 c1             	cmovns %ecx,%eax
+  8004fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800501:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800503:	e9 5a ff ff ff       	jmp    800462 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800508:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80050a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800511:	e9 4c ff ff ff       	jmp    800462 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800516:	89 d6                	mov    %edx,%esi
+  800518:	eb bf                	jmp    8004d9 <vprintfmt+0xd5>
+			lflag++;
+  80051a:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80051e:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800520:	e9 3d ff ff ff       	jmp    800462 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800525:	89 55 10             	mov    %edx,0x10(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 70 04             	lea    0x4(%eax),%esi
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	53                   	push   %ebx
+  800532:	ff 30                	push   (%eax)
+  800534:	ff d7                	call   *%edi
+			break;
+  800536:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800539:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80053c:	e9 d4 fe ff ff       	jmp    800415 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800541:	89 55 10             	mov    %edx,0x10(%ebp)
+  800544:	8b 45 14             	mov    0x14(%ebp),%eax
+  800547:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80054a:	8b 10                	mov    (%eax),%edx
+  80054c:	89 d0                	mov    %edx,%eax
+  80054e:	f7 d8                	neg    %eax
+  800550:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800553:	83 f8 12             	cmp    $0x12,%eax
+  800556:	7f 23                	jg     80057b <vprintfmt+0x177>
+  800558:	8b 14 85 40 40 80 00 	mov    0x804040(,%eax,4),%edx
+  80055f:	85 d2                	test   %edx,%edx
+  800561:	74 18                	je     80057b <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800563:	52                   	push   %edx
+  800564:	68 9b 41 80 00       	push   $0x80419b
+  800569:	53                   	push   %ebx
+  80056a:	57                   	push   %edi
+  80056b:	e8 77 fe ff ff       	call   8003e7 <printfmt>
+  800570:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800573:	89 75 14             	mov    %esi,0x14(%ebp)
+  800576:	e9 9a fe ff ff       	jmp    800415 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80057b:	50                   	push   %eax
+  80057c:	68 83 3d 80 00       	push   $0x803d83
+  800581:	53                   	push   %ebx
+  800582:	57                   	push   %edi
+  800583:	e8 5f fe ff ff       	call   8003e7 <printfmt>
+  800588:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80058b:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80058e:	e9 82 fe ff ff       	jmp    800415 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800593:	89 55 10             	mov    %edx,0x10(%ebp)
+  800596:	8b 45 14             	mov    0x14(%ebp),%eax
+  800599:	83 c0 04             	add    $0x4,%eax
+  80059c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8b 00                	mov    (%eax),%eax
+  8005a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005a7:	85 c0                	test   %eax,%eax
+  8005a9:	0f 84 61 03 00 00    	je     800910 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8005af:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005b3:	7e 06                	jle    8005bb <vprintfmt+0x1b7>
+  8005b5:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005b9:	75 29                	jne    8005e4 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005bb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005be:	8d 70 01             	lea    0x1(%eax),%esi
+  8005c1:	0f b6 00             	movzbl (%eax),%eax
+  8005c4:	0f be d0             	movsbl %al,%edx
+  8005c7:	85 d2                	test   %edx,%edx
+  8005c9:	0f 84 bb 00 00 00    	je     80068a <vprintfmt+0x286>
+  8005cf:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005d2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005d5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005d8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005db:	eb 7a                	jmp    800657 <vprintfmt+0x253>
+				p = "(null)";
+  8005dd:	c7 45 d0 7c 3d 80 00 	movl   $0x803d7c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	ff 75 d4             	push   -0x2c(%ebp)
+  8005ea:	ff 75 d0             	push   -0x30(%ebp)
+  8005ed:	e8 e0 03 00 00       	call   8009d2 <strnlen>
+  8005f2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005f5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005f8:	83 c4 10             	add    $0x10,%esp
+  8005fb:	85 d2                	test   %edx,%edx
+  8005fd:	0f 8e d6 02 00 00    	jle    8008d9 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800603:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800607:	83 ec 08             	sub    $0x8,%esp
+  80060a:	53                   	push   %ebx
+  80060b:	56                   	push   %esi
+  80060c:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80060e:	83 c4 10             	add    $0x10,%esp
+  800611:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800615:	75 f0                	jne    800607 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800617:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80061a:	8d 70 01             	lea    0x1(%eax),%esi
+  80061d:	0f b6 00             	movzbl (%eax),%eax
+  800620:	0f be d0             	movsbl %al,%edx
+  800623:	85 d2                	test   %edx,%edx
+  800625:	0f 84 da 02 00 00    	je     800905 <vprintfmt+0x501>
+  80062b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80062e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800631:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800634:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800637:	eb 1e                	jmp    800657 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800639:	83 ec 08             	sub    $0x8,%esp
+  80063c:	ff 75 0c             	push   0xc(%ebp)
+  80063f:	52                   	push   %edx
+  800640:	ff 55 08             	call   *0x8(%ebp)
+  800643:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800646:	83 eb 01             	sub    $0x1,%ebx
+  800649:	83 c6 01             	add    $0x1,%esi
+  80064c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800650:	0f be d0             	movsbl %al,%edx
+  800653:	85 d2                	test   %edx,%edx
+  800655:	74 2a                	je     800681 <vprintfmt+0x27d>
+  800657:	85 ff                	test   %edi,%edi
+  800659:	78 05                	js     800660 <vprintfmt+0x25c>
+  80065b:	83 ef 01             	sub    $0x1,%edi
+  80065e:	78 59                	js     8006b9 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800660:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800664:	74 d3                	je     800639 <vprintfmt+0x235>
+  800666:	0f be c0             	movsbl %al,%eax
+  800669:	83 e8 20             	sub    $0x20,%eax
+  80066c:	83 f8 5e             	cmp    $0x5e,%eax
+  80066f:	76 c8                	jbe    800639 <vprintfmt+0x235>
+					putch('?', putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	ff 75 0c             	push   0xc(%ebp)
+  800677:	6a 3f                	push   $0x3f
+  800679:	ff 55 08             	call   *0x8(%ebp)
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	eb c5                	jmp    800646 <vprintfmt+0x242>
+  800681:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800684:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800687:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80068a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80068d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800691:	7e 1b                	jle    8006ae <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	53                   	push   %ebx
+  800697:	6a 20                	push   $0x20
+  800699:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80069b:	83 c4 10             	add    $0x10,%esp
+  80069e:	83 ee 01             	sub    $0x1,%esi
+  8006a1:	75 f0                	jne    800693 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006a3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a9:	e9 67 fd ff ff       	jmp    800415 <vprintfmt+0x11>
+  8006ae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006b1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b4:	e9 5c fd ff ff       	jmp    800415 <vprintfmt+0x11>
+  8006b9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006c2:	eb c6                	jmp    80068a <vprintfmt+0x286>
+	if (lflag >= 2)
+  8006c4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006c7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ca:	83 f9 01             	cmp    $0x1,%ecx
+  8006cd:	7f 1f                	jg     8006ee <vprintfmt+0x2ea>
+	else if (lflag)
+  8006cf:	85 c9                	test   %ecx,%ecx
+  8006d1:	74 67                	je     80073a <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8006d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d6:	8b 30                	mov    (%eax),%esi
+  8006d8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006db:	89 f0                	mov    %esi,%eax
+  8006dd:	c1 f8 1f             	sar    $0x1f,%eax
+  8006e0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ec:	eb 17                	jmp    800705 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8b 50 04             	mov    0x4(%eax),%edx
+  8006f4:	8b 00                	mov    (%eax),%eax
+  8006f6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8d 40 08             	lea    0x8(%eax),%eax
+  800702:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800705:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800708:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80070b:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800710:	85 c9                	test   %ecx,%ecx
+  800712:	0f 89 12 01 00 00    	jns    80082a <vprintfmt+0x426>
+				putch('-', putdat);
+  800718:	83 ec 08             	sub    $0x8,%esp
+  80071b:	53                   	push   %ebx
+  80071c:	6a 2d                	push   $0x2d
+  80071e:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800720:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800723:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800726:	f7 da                	neg    %edx
+  800728:	83 d1 00             	adc    $0x0,%ecx
+  80072b:	f7 d9                	neg    %ecx
+  80072d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800730:	be 0a 00 00 00       	mov    $0xa,%esi
+  800735:	e9 f0 00 00 00       	jmp    80082a <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80073a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073d:	8b 30                	mov    (%eax),%esi
+  80073f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800742:	89 f0                	mov    %esi,%eax
+  800744:	c1 f8 1f             	sar    $0x1f,%eax
+  800747:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8d 40 04             	lea    0x4(%eax),%eax
+  800750:	89 45 14             	mov    %eax,0x14(%ebp)
+  800753:	eb b0                	jmp    800705 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800755:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800758:	89 55 10             	mov    %edx,0x10(%ebp)
+  80075b:	83 f9 01             	cmp    $0x1,%ecx
+  80075e:	7f 1e                	jg     80077e <vprintfmt+0x37a>
+	else if (lflag)
+  800760:	85 c9                	test   %ecx,%ecx
+  800762:	74 32                	je     800796 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 10                	mov    (%eax),%edx
+  800769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800774:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800779:	e9 ac 00 00 00       	jmp    80082a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80077e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800781:	8b 10                	mov    (%eax),%edx
+  800783:	8b 48 04             	mov    0x4(%eax),%ecx
+  800786:	8d 40 08             	lea    0x8(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80078c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800791:	e9 94 00 00 00       	jmp    80082a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a6:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8007ab:	eb 7d                	jmp    80082a <vprintfmt+0x426>
+	if (lflag >= 2)
+  8007ad:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007b0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007b3:	83 f9 01             	cmp    $0x1,%ecx
+  8007b6:	7f 1b                	jg     8007d3 <vprintfmt+0x3cf>
+	else if (lflag)
+  8007b8:	85 c9                	test   %ecx,%ecx
+  8007ba:	74 2c                	je     8007e8 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bf:	8b 10                	mov    (%eax),%edx
+  8007c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007cc:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8007d1:	eb 57                	jmp    80082a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d6:	8b 10                	mov    (%eax),%edx
+  8007d8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007db:	8d 40 08             	lea    0x8(%eax),%eax
+  8007de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007e1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8007e6:	eb 42                	jmp    80082a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007eb:	8b 10                	mov    (%eax),%edx
+  8007ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f8:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8007fd:	eb 2b                	jmp    80082a <vprintfmt+0x426>
+			putch('0', putdat);
+  8007ff:	89 55 10             	mov    %edx,0x10(%ebp)
+  800802:	83 ec 08             	sub    $0x8,%esp
+  800805:	53                   	push   %ebx
+  800806:	6a 30                	push   $0x30
+  800808:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80080a:	83 c4 08             	add    $0x8,%esp
+  80080d:	53                   	push   %ebx
+  80080e:	6a 78                	push   $0x78
+  800810:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800812:	8b 45 14             	mov    0x14(%ebp),%eax
+  800815:	8b 10                	mov    (%eax),%edx
+  800817:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80081c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80081f:	8d 40 04             	lea    0x4(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800825:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80082a:	83 ec 0c             	sub    $0xc,%esp
+  80082d:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800831:	50                   	push   %eax
+  800832:	ff 75 e4             	push   -0x1c(%ebp)
+  800835:	56                   	push   %esi
+  800836:	51                   	push   %ecx
+  800837:	52                   	push   %edx
+  800838:	89 da                	mov    %ebx,%edx
+  80083a:	89 f8                	mov    %edi,%eax
+  80083c:	e8 d8 fa ff ff       	call   800319 <printnum>
+			break;
+  800841:	83 c4 20             	add    $0x20,%esp
+  800844:	e9 cc fb ff ff       	jmp    800415 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800849:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80084c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80084f:	83 f9 01             	cmp    $0x1,%ecx
+  800852:	7f 1b                	jg     80086f <vprintfmt+0x46b>
+	else if (lflag)
+  800854:	85 c9                	test   %ecx,%ecx
+  800856:	74 2c                	je     800884 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800858:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085b:	8b 10                	mov    (%eax),%edx
+  80085d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800862:	8d 40 04             	lea    0x4(%eax),%eax
+  800865:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800868:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80086d:	eb bb                	jmp    80082a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80086f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800872:	8b 10                	mov    (%eax),%edx
+  800874:	8b 48 04             	mov    0x4(%eax),%ecx
+  800877:	8d 40 08             	lea    0x8(%eax),%eax
+  80087a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800882:	eb a6                	jmp    80082a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800884:	8b 45 14             	mov    0x14(%ebp),%eax
+  800887:	8b 10                	mov    (%eax),%edx
+  800889:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088e:	8d 40 04             	lea    0x4(%eax),%eax
+  800891:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800894:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800899:	eb 8f                	jmp    80082a <vprintfmt+0x426>
+			putch(ch, putdat);
+  80089b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80089e:	83 ec 08             	sub    $0x8,%esp
+  8008a1:	53                   	push   %ebx
+  8008a2:	6a 25                	push   $0x25
+  8008a4:	ff d7                	call   *%edi
+			break;
+  8008a6:	83 c4 10             	add    $0x10,%esp
+  8008a9:	e9 67 fb ff ff       	jmp    800415 <vprintfmt+0x11>
+			putch('%', putdat);
+  8008ae:	83 ec 08             	sub    $0x8,%esp
+  8008b1:	53                   	push   %ebx
+  8008b2:	6a 25                	push   $0x25
+  8008b4:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008b6:	83 c4 10             	add    $0x10,%esp
+  8008b9:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008bd:	0f 84 ba fb ff ff    	je     80047d <vprintfmt+0x79>
+  8008c3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008c6:	89 f0                	mov    %esi,%eax
+  8008c8:	83 e8 01             	sub    $0x1,%eax
+  8008cb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008cf:	75 f7                	jne    8008c8 <vprintfmt+0x4c4>
+  8008d1:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008d4:	e9 3c fb ff ff       	jmp    800415 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008dc:	8d 70 01             	lea    0x1(%eax),%esi
+  8008df:	0f b6 00             	movzbl (%eax),%eax
+  8008e2:	0f be d0             	movsbl %al,%edx
+  8008e5:	85 d2                	test   %edx,%edx
+  8008e7:	74 11                	je     8008fa <vprintfmt+0x4f6>
+  8008e9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008ec:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008ef:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008f2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008f5:	e9 5d fd ff ff       	jmp    800657 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008fa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800900:	e9 10 fb ff ff       	jmp    800415 <vprintfmt+0x11>
+  800905:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800908:	89 45 14             	mov    %eax,0x14(%ebp)
+  80090b:	e9 05 fb ff ff       	jmp    800415 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800910:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800914:	7e 0a                	jle    800920 <vprintfmt+0x51c>
+  800916:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80091a:	0f 85 bd fc ff ff    	jne    8005dd <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800920:	ba 28 00 00 00       	mov    $0x28,%edx
+  800925:	b8 28 00 00 00       	mov    $0x28,%eax
+  80092a:	be 7d 3d 80 00       	mov    $0x803d7d,%esi
+  80092f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800932:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800935:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800938:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80093b:	e9 17 fd ff ff       	jmp    800657 <vprintfmt+0x253>
+}
+  800940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800943:	5b                   	pop    %ebx
+  800944:	5e                   	pop    %esi
+  800945:	5f                   	pop    %edi
+  800946:	5d                   	pop    %ebp
+  800947:	c3                   	ret
+
+00800948 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	83 ec 18             	sub    $0x18,%esp
+  80094e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800951:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800954:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800957:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80095b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80095e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800965:	85 c0                	test   %eax,%eax
+  800967:	74 26                	je     80098f <vsnprintf+0x47>
+  800969:	85 d2                	test   %edx,%edx
+  80096b:	7e 22                	jle    80098f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80096d:	ff 75 14             	push   0x14(%ebp)
+  800970:	ff 75 10             	push   0x10(%ebp)
+  800973:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800976:	50                   	push   %eax
+  800977:	68 ca 03 80 00       	push   $0x8003ca
+  80097c:	e8 83 fa ff ff       	call   800404 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800981:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800984:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800987:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80098a:	83 c4 10             	add    $0x10,%esp
+}
+  80098d:	c9                   	leave
+  80098e:	c3                   	ret
+		return -E_INVAL;
+  80098f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800994:	eb f7                	jmp    80098d <vsnprintf+0x45>
+
+00800996 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80099c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80099f:	50                   	push   %eax
+  8009a0:	ff 75 10             	push   0x10(%ebp)
+  8009a3:	ff 75 0c             	push   0xc(%ebp)
+  8009a6:	ff 75 08             	push   0x8(%ebp)
+  8009a9:	e8 9a ff ff ff       	call   800948 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009ae:	c9                   	leave
+  8009af:	c3                   	ret
+
+008009b0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009b6:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009b9:	74 10                	je     8009cb <strlen+0x1b>
+  8009bb:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8009c0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009c7:	75 f7                	jne    8009c0 <strlen+0x10>
+	return n;
+}
+  8009c9:	5d                   	pop    %ebp
+  8009ca:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8009cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8009d0:	eb f7                	jmp    8009c9 <strlen+0x19>
+
+008009d2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009db:	85 d2                	test   %edx,%edx
+  8009dd:	74 16                	je     8009f5 <strnlen+0x23>
+  8009df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009e8:	74 09                	je     8009f3 <strnlen+0x21>
+		n++;
+  8009ea:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ed:	39 d0                	cmp    %edx,%eax
+  8009ef:	75 f3                	jne    8009e4 <strnlen+0x12>
+		n++;
+  8009f1:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fa:	eb f7                	jmp    8009f3 <strnlen+0x21>
+
+008009fc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009fc:	55                   	push   %ebp
+  8009fd:	89 e5                	mov    %esp,%ebp
+  8009ff:	53                   	push   %ebx
+  800a00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a0f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a12:	83 c0 01             	add    $0x1,%eax
+  800a15:	84 d2                	test   %dl,%dl
+  800a17:	75 f2                	jne    800a0b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a19:	89 c8                	mov    %ecx,%eax
+  800a1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a1e:	c9                   	leave
+  800a1f:	c3                   	ret
+
+00800a20 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a20:	55                   	push   %ebp
+  800a21:	89 e5                	mov    %esp,%ebp
+  800a23:	53                   	push   %ebx
+  800a24:	83 ec 10             	sub    $0x10,%esp
+  800a27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a2a:	53                   	push   %ebx
+  800a2b:	e8 80 ff ff ff       	call   8009b0 <strlen>
+  800a30:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a33:	ff 75 0c             	push   0xc(%ebp)
+  800a36:	01 d8                	add    %ebx,%eax
+  800a38:	50                   	push   %eax
+  800a39:	e8 be ff ff ff       	call   8009fc <strcpy>
+	return dst;
+}
+  800a3e:	89 d8                	mov    %ebx,%eax
+  800a40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a43:	c9                   	leave
+  800a44:	c3                   	ret
+
+00800a45 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	56                   	push   %esi
+  800a49:	53                   	push   %ebx
+  800a4a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a53:	85 db                	test   %ebx,%ebx
+  800a55:	74 17                	je     800a6e <strncpy+0x29>
+  800a57:	01 f3                	add    %esi,%ebx
+  800a59:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a5b:	83 c0 01             	add    $0x1,%eax
+  800a5e:	0f b6 0a             	movzbl (%edx),%ecx
+  800a61:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a64:	80 f9 01             	cmp    $0x1,%cl
+  800a67:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a6a:	39 c3                	cmp    %eax,%ebx
+  800a6c:	75 ed                	jne    800a5b <strncpy+0x16>
+	}
+	return ret;
+}
+  800a6e:	89 f0                	mov    %esi,%eax
+  800a70:	5b                   	pop    %ebx
+  800a71:	5e                   	pop    %esi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	56                   	push   %esi
+  800a78:	53                   	push   %ebx
+  800a79:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a82:	89 f0                	mov    %esi,%eax
+  800a84:	85 db                	test   %ebx,%ebx
+  800a86:	74 1e                	je     800aa6 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a88:	83 eb 01             	sub    $0x1,%ebx
+  800a8b:	74 16                	je     800aa3 <strlcpy+0x2f>
+  800a8d:	01 f3                	add    %esi,%ebx
+  800a8f:	0f b6 0a             	movzbl (%edx),%ecx
+  800a92:	84 c9                	test   %cl,%cl
+  800a94:	74 0d                	je     800aa3 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800a96:	83 c2 01             	add    $0x1,%edx
+  800a99:	83 c0 01             	add    $0x1,%eax
+  800a9c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800a9f:	39 d8                	cmp    %ebx,%eax
+  800aa1:	75 ec                	jne    800a8f <strlcpy+0x1b>
+		*dst = '\0';
+  800aa3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800aa6:	29 f0                	sub    %esi,%eax
+}
+  800aa8:	5b                   	pop    %ebx
+  800aa9:	5e                   	pop    %esi
+  800aaa:	5d                   	pop    %ebp
+  800aab:	c3                   	ret
+
+00800aac <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aac:	55                   	push   %ebp
+  800aad:	89 e5                	mov    %esp,%ebp
+  800aaf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ab5:	0f b6 01             	movzbl (%ecx),%eax
+  800ab8:	84 c0                	test   %al,%al
+  800aba:	74 11                	je     800acd <strcmp+0x21>
+  800abc:	38 02                	cmp    %al,(%edx)
+  800abe:	75 0d                	jne    800acd <strcmp+0x21>
+		p++, q++;
+  800ac0:	83 c1 01             	add    $0x1,%ecx
+  800ac3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ac6:	0f b6 01             	movzbl (%ecx),%eax
+  800ac9:	84 c0                	test   %al,%al
+  800acb:	75 ef                	jne    800abc <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800acd:	0f b6 c0             	movzbl %al,%eax
+  800ad0:	0f b6 12             	movzbl (%edx),%edx
+  800ad3:	29 d0                	sub    %edx,%eax
+}
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	53                   	push   %ebx
+  800adb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ade:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ae1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800ae9:	85 d2                	test   %edx,%edx
+  800aeb:	74 2e                	je     800b1b <strncmp+0x44>
+  800aed:	0f b6 01             	movzbl (%ecx),%eax
+  800af0:	84 c0                	test   %al,%al
+  800af2:	74 16                	je     800b0a <strncmp+0x33>
+  800af4:	3a 03                	cmp    (%ebx),%al
+  800af6:	75 12                	jne    800b0a <strncmp+0x33>
+		n--, p++, q++;
+  800af8:	83 c1 01             	add    $0x1,%ecx
+  800afb:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800afe:	83 ea 01             	sub    $0x1,%edx
+  800b01:	75 ea                	jne    800aed <strncmp+0x16>
+		return 0;
+  800b03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b08:	eb 11                	jmp    800b1b <strncmp+0x44>
+  800b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b0f:	85 d2                	test   %edx,%edx
+  800b11:	74 08                	je     800b1b <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b13:	0f b6 01             	movzbl (%ecx),%eax
+  800b16:	0f b6 13             	movzbl (%ebx),%edx
+  800b19:	29 d0                	sub    %edx,%eax
+}
+  800b1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1e:	c9                   	leave
+  800b1f:	c3                   	ret
+
+00800b20 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b26:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b2a:	0f b6 10             	movzbl (%eax),%edx
+  800b2d:	84 d2                	test   %dl,%dl
+  800b2f:	74 15                	je     800b46 <strchr+0x26>
+		if (*s == c)
+  800b31:	38 d1                	cmp    %dl,%cl
+  800b33:	74 0f                	je     800b44 <strchr+0x24>
+	for (; *s; s++)
+  800b35:	83 c0 01             	add    $0x1,%eax
+  800b38:	0f b6 10             	movzbl (%eax),%edx
+  800b3b:	84 d2                	test   %dl,%dl
+  800b3d:	75 f2                	jne    800b31 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+	return 0;
+  800b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4b:	eb f7                	jmp    800b44 <strchr+0x24>
+
+00800b4d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	53                   	push   %ebx
+  800b51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b54:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b57:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b5a:	38 d3                	cmp    %dl,%bl
+  800b5c:	74 14                	je     800b72 <strfind+0x25>
+  800b5e:	89 d1                	mov    %edx,%ecx
+  800b60:	84 db                	test   %bl,%bl
+  800b62:	74 0e                	je     800b72 <strfind+0x25>
+	for (; *s; s++)
+  800b64:	83 c0 01             	add    $0x1,%eax
+  800b67:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b6a:	38 ca                	cmp    %cl,%dl
+  800b6c:	74 04                	je     800b72 <strfind+0x25>
+  800b6e:	84 d2                	test   %dl,%dl
+  800b70:	75 f2                	jne    800b64 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b75:	c9                   	leave
+  800b76:	c3                   	ret
+
+00800b77 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	57                   	push   %edi
+  800b7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b7e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b81:	85 c9                	test   %ecx,%ecx
+  800b83:	74 20                	je     800ba5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b85:	89 f8                	mov    %edi,%eax
+  800b87:	09 c8                	or     %ecx,%eax
+  800b89:	a8 03                	test   $0x3,%al
+  800b8b:	75 12                	jne    800b9f <memset+0x28>
+		c &= 0xFF;
+  800b8d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b91:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b97:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b9a:	fc                   	cld
+  800b9b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b9d:	eb 06                	jmp    800ba5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba2:	fc                   	cld
+  800ba3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ba5:	89 f8                	mov    %edi,%eax
+  800ba7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+
+00800bac <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	57                   	push   %edi
+  800bb0:	56                   	push   %esi
+  800bb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bb7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bba:	39 c6                	cmp    %eax,%esi
+  800bbc:	73 32                	jae    800bf0 <memmove+0x44>
+  800bbe:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bc1:	39 d0                	cmp    %edx,%eax
+  800bc3:	73 2b                	jae    800bf0 <memmove+0x44>
+		s += n;
+		d += n;
+  800bc5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc8:	89 d6                	mov    %edx,%esi
+  800bca:	09 fe                	or     %edi,%esi
+  800bcc:	09 ce                	or     %ecx,%esi
+  800bce:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bd4:	75 0e                	jne    800be4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bd6:	83 ef 04             	sub    $0x4,%edi
+  800bd9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bdc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bdf:	fd                   	std
+  800be0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800be2:	eb 09                	jmp    800bed <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800be4:	83 ef 01             	sub    $0x1,%edi
+  800be7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bea:	fd                   	std
+  800beb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bed:	fc                   	cld
+  800bee:	eb 1a                	jmp    800c0a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bf0:	89 f2                	mov    %esi,%edx
+  800bf2:	09 c2                	or     %eax,%edx
+  800bf4:	09 ca                	or     %ecx,%edx
+  800bf6:	f6 c2 03             	test   $0x3,%dl
+  800bf9:	75 0a                	jne    800c05 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bfb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bfe:	89 c7                	mov    %eax,%edi
+  800c00:	fc                   	cld
+  800c01:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c03:	eb 05                	jmp    800c0a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c05:	89 c7                	mov    %eax,%edi
+  800c07:	fc                   	cld
+  800c08:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c0a:	5e                   	pop    %esi
+  800c0b:	5f                   	pop    %edi
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	c3                   	ret
+
+00800c0e <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c0e:	55                   	push   %ebp
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c14:	ff 75 10             	push   0x10(%ebp)
+  800c17:	ff 75 0c             	push   0xc(%ebp)
+  800c1a:	ff 75 08             	push   0x8(%ebp)
+  800c1d:	e8 8a ff ff ff       	call   800bac <memmove>
+}
+  800c22:	c9                   	leave
+  800c23:	c3                   	ret
+
+00800c24 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	56                   	push   %esi
+  800c28:	53                   	push   %ebx
+  800c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c2f:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c32:	85 f6                	test   %esi,%esi
+  800c34:	74 29                	je     800c5f <memcmp+0x3b>
+  800c36:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800c38:	0f b6 08             	movzbl (%eax),%ecx
+  800c3b:	0f b6 1a             	movzbl (%edx),%ebx
+  800c3e:	38 d9                	cmp    %bl,%cl
+  800c40:	75 11                	jne    800c53 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c42:	83 c0 01             	add    $0x1,%eax
+  800c45:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c48:	39 c6                	cmp    %eax,%esi
+  800c4a:	75 ec                	jne    800c38 <memcmp+0x14>
+	}
+
+	return 0;
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c51:	eb 08                	jmp    800c5b <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c53:	0f b6 c1             	movzbl %cl,%eax
+  800c56:	0f b6 db             	movzbl %bl,%ebx
+  800c59:	29 d8                	sub    %ebx,%eax
+}
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+	return 0;
+  800c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c64:	eb f5                	jmp    800c5b <memcmp+0x37>
+
+00800c66 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c6f:	89 c2                	mov    %eax,%edx
+  800c71:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c74:	39 d0                	cmp    %edx,%eax
+  800c76:	73 0d                	jae    800c85 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c78:	38 08                	cmp    %cl,(%eax)
+  800c7a:	74 0d                	je     800c89 <memfind+0x23>
+	for (; s < ends; s++)
+  800c7c:	83 c0 01             	add    $0x1,%eax
+  800c7f:	39 c2                	cmp    %eax,%edx
+  800c81:	75 f5                	jne    800c78 <memfind+0x12>
+  800c83:	eb 06                	jmp    800c8b <memfind+0x25>
+  800c85:	89 c2                	mov    %eax,%edx
+  800c87:	eb 02                	jmp    800c8b <memfind+0x25>
+  800c89:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c8b:	89 d0                	mov    %edx,%eax
+  800c8d:	5d                   	pop    %ebp
+  800c8e:	c3                   	ret
+
+00800c8f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c8f:	55                   	push   %ebp
+  800c90:	89 e5                	mov    %esp,%ebp
+  800c92:	57                   	push   %edi
+  800c93:	56                   	push   %esi
+  800c94:	53                   	push   %ebx
+  800c95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c9b:	0f b6 02             	movzbl (%edx),%eax
+  800c9e:	3c 20                	cmp    $0x20,%al
+  800ca0:	74 04                	je     800ca6 <strtol+0x17>
+  800ca2:	3c 09                	cmp    $0x9,%al
+  800ca4:	75 0e                	jne    800cb4 <strtol+0x25>
+		s++;
+  800ca6:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ca9:	0f b6 02             	movzbl (%edx),%eax
+  800cac:	3c 20                	cmp    $0x20,%al
+  800cae:	74 f6                	je     800ca6 <strtol+0x17>
+  800cb0:	3c 09                	cmp    $0x9,%al
+  800cb2:	74 f2                	je     800ca6 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cb4:	3c 2b                	cmp    $0x2b,%al
+  800cb6:	74 2a                	je     800ce2 <strtol+0x53>
+	int neg = 0;
+  800cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cbd:	3c 2d                	cmp    $0x2d,%al
+  800cbf:	74 2b                	je     800cec <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cc1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cc7:	75 0f                	jne    800cd8 <strtol+0x49>
+  800cc9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ccc:	74 28                	je     800cf6 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cce:	85 db                	test   %ebx,%ebx
+  800cd0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cd5:	0f 44 d8             	cmove  %eax,%ebx
+  800cd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ce0:	eb 46                	jmp    800d28 <strtol+0x99>
+		s++;
+  800ce2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cea:	eb d5                	jmp    800cc1 <strtol+0x32>
+		s++, neg = 1;
+  800cec:	83 c2 01             	add    $0x1,%edx
+  800cef:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cf4:	eb cb                	jmp    800cc1 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cf6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cfa:	74 0e                	je     800d0a <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800cfc:	85 db                	test   %ebx,%ebx
+  800cfe:	75 d8                	jne    800cd8 <strtol+0x49>
+		s++, base = 8;
+  800d00:	83 c2 01             	add    $0x1,%edx
+  800d03:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d08:	eb ce                	jmp    800cd8 <strtol+0x49>
+		s += 2, base = 16;
+  800d0a:	83 c2 02             	add    $0x2,%edx
+  800d0d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d12:	eb c4                	jmp    800cd8 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d14:	0f be c0             	movsbl %al,%eax
+  800d17:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d1a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d1d:	7d 3a                	jge    800d59 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d1f:	83 c2 01             	add    $0x1,%edx
+  800d22:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d26:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d28:	0f b6 02             	movzbl (%edx),%eax
+  800d2b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d2e:	89 f3                	mov    %esi,%ebx
+  800d30:	80 fb 09             	cmp    $0x9,%bl
+  800d33:	76 df                	jbe    800d14 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800d35:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d38:	89 f3                	mov    %esi,%ebx
+  800d3a:	80 fb 19             	cmp    $0x19,%bl
+  800d3d:	77 08                	ja     800d47 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800d3f:	0f be c0             	movsbl %al,%eax
+  800d42:	83 e8 57             	sub    $0x57,%eax
+  800d45:	eb d3                	jmp    800d1a <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d47:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d4a:	89 f3                	mov    %esi,%ebx
+  800d4c:	80 fb 19             	cmp    $0x19,%bl
+  800d4f:	77 08                	ja     800d59 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d51:	0f be c0             	movsbl %al,%eax
+  800d54:	83 e8 37             	sub    $0x37,%eax
+  800d57:	eb c1                	jmp    800d1a <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d59:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d5d:	74 05                	je     800d64 <strtol+0xd5>
+		*endptr = (char *) s;
+  800d5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d62:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d64:	89 c8                	mov    %ecx,%eax
+  800d66:	f7 d8                	neg    %eax
+  800d68:	85 ff                	test   %edi,%edi
+  800d6a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d6d:	89 c8                	mov    %ecx,%eax
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5f                   	pop    %edi
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+
+00800d74 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d74:	55                   	push   %ebp
+  800d75:	89 e5                	mov    %esp,%ebp
+  800d77:	57                   	push   %edi
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d85:	89 c3                	mov    %eax,%ebx
+  800d87:	89 c7                	mov    %eax,%edi
+  800d89:	89 c6                	mov    %eax,%esi
+  800d8b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5f                   	pop    %edi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+
+00800d92 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	57                   	push   %edi
+  800d96:	56                   	push   %esi
+  800d97:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da2:	89 d1                	mov    %edx,%ecx
+  800da4:	89 d3                	mov    %edx,%ebx
+  800da6:	89 d7                	mov    %edx,%edi
+  800da8:	89 d6                	mov    %edx,%esi
+  800daa:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+
+00800db1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+  800db7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dc7:	89 cb                	mov    %ecx,%ebx
+  800dc9:	89 cf                	mov    %ecx,%edi
+  800dcb:	89 ce                	mov    %ecx,%esi
+  800dcd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcf:	85 c0                	test   %eax,%eax
+  800dd1:	7f 08                	jg     800ddb <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd6:	5b                   	pop    %ebx
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	50                   	push   %eax
+  800ddf:	6a 03                	push   $0x3
+  800de1:	68 ab 40 80 00       	push   $0x8040ab
+  800de6:	6a 23                	push   $0x23
+  800de8:	68 c8 40 80 00       	push   $0x8040c8
+  800ded:	e8 38 f4 ff ff       	call   80022a <_panic>
+
+00800df2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800df8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e02:	89 d1                	mov    %edx,%ecx
+  800e04:	89 d3                	mov    %edx,%ebx
+  800e06:	89 d7                	mov    %edx,%edi
+  800e08:	89 d6                	mov    %edx,%esi
+  800e0a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+
+00800e11 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e21:	89 d1                	mov    %edx,%ecx
+  800e23:	89 d3                	mov    %edx,%ebx
+  800e25:	89 d7                	mov    %edx,%edi
+  800e27:	89 d6                	mov    %edx,%esi
+  800e29:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5e                   	pop    %esi
+  800e2d:	5f                   	pop    %edi
+  800e2e:	5d                   	pop    %ebp
+  800e2f:	c3                   	ret
+
+00800e30 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e39:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e44:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4c:	89 f7                	mov    %esi,%edi
+  800e4e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	7f 08                	jg     800e5c <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e57:	5b                   	pop    %ebx
+  800e58:	5e                   	pop    %esi
+  800e59:	5f                   	pop    %edi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	50                   	push   %eax
+  800e60:	6a 04                	push   $0x4
+  800e62:	68 ab 40 80 00       	push   $0x8040ab
+  800e67:	6a 23                	push   $0x23
+  800e69:	68 c8 40 80 00       	push   $0x8040c8
+  800e6e:	e8 b7 f3 ff ff       	call   80022a <_panic>
+
+00800e73 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e90:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e92:	85 c0                	test   %eax,%eax
+  800e94:	7f 08                	jg     800e9e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e99:	5b                   	pop    %ebx
+  800e9a:	5e                   	pop    %esi
+  800e9b:	5f                   	pop    %edi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9e:	83 ec 0c             	sub    $0xc,%esp
+  800ea1:	50                   	push   %eax
+  800ea2:	6a 05                	push   $0x5
+  800ea4:	68 ab 40 80 00       	push   $0x8040ab
+  800ea9:	6a 23                	push   $0x23
+  800eab:	68 c8 40 80 00       	push   $0x8040c8
+  800eb0:	e8 75 f3 ff ff       	call   80022a <_panic>
+
+00800eb5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	57                   	push   %edi
+  800eb9:	56                   	push   %esi
+  800eba:	53                   	push   %ebx
+  800ebb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ebe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ece:	89 df                	mov    %ebx,%edi
+  800ed0:	89 de                	mov    %ebx,%esi
+  800ed2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed4:	85 c0                	test   %eax,%eax
+  800ed6:	7f 08                	jg     800ee0 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ed8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edb:	5b                   	pop    %ebx
+  800edc:	5e                   	pop    %esi
+  800edd:	5f                   	pop    %edi
+  800ede:	5d                   	pop    %ebp
+  800edf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+  800ee3:	50                   	push   %eax
+  800ee4:	6a 06                	push   $0x6
+  800ee6:	68 ab 40 80 00       	push   $0x8040ab
+  800eeb:	6a 23                	push   $0x23
+  800eed:	68 c8 40 80 00       	push   $0x8040c8
+  800ef2:	e8 33 f3 ff ff       	call   80022a <_panic>
+
+00800ef7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	57                   	push   %edi
+  800efb:	56                   	push   %esi
+  800efc:	53                   	push   %ebx
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f10:	89 df                	mov    %ebx,%edi
+  800f12:	89 de                	mov    %ebx,%esi
+  800f14:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f16:	85 c0                	test   %eax,%eax
+  800f18:	7f 08                	jg     800f22 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1d:	5b                   	pop    %ebx
+  800f1e:	5e                   	pop    %esi
+  800f1f:	5f                   	pop    %edi
+  800f20:	5d                   	pop    %ebp
+  800f21:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f22:	83 ec 0c             	sub    $0xc,%esp
+  800f25:	50                   	push   %eax
+  800f26:	6a 08                	push   $0x8
+  800f28:	68 ab 40 80 00       	push   $0x8040ab
+  800f2d:	6a 23                	push   $0x23
+  800f2f:	68 c8 40 80 00       	push   $0x8040c8
+  800f34:	e8 f1 f2 ff ff       	call   80022a <_panic>
+
+00800f39 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f52:	89 df                	mov    %ebx,%edi
+  800f54:	89 de                	mov    %ebx,%esi
+  800f56:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f58:	85 c0                	test   %eax,%eax
+  800f5a:	7f 08                	jg     800f64 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	50                   	push   %eax
+  800f68:	6a 09                	push   $0x9
+  800f6a:	68 ab 40 80 00       	push   $0x8040ab
+  800f6f:	6a 23                	push   $0x23
+  800f71:	68 c8 40 80 00       	push   $0x8040c8
+  800f76:	e8 af f2 ff ff       	call   80022a <_panic>
+
+00800f7b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	57                   	push   %edi
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f94:	89 df                	mov    %ebx,%edi
+  800f96:	89 de                	mov    %ebx,%esi
+  800f98:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9a:	85 c0                	test   %eax,%eax
+  800f9c:	7f 08                	jg     800fa6 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa1:	5b                   	pop    %ebx
+  800fa2:	5e                   	pop    %esi
+  800fa3:	5f                   	pop    %edi
+  800fa4:	5d                   	pop    %ebp
+  800fa5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa6:	83 ec 0c             	sub    $0xc,%esp
+  800fa9:	50                   	push   %eax
+  800faa:	6a 0a                	push   $0xa
+  800fac:	68 ab 40 80 00       	push   $0x8040ab
+  800fb1:	6a 23                	push   $0x23
+  800fb3:	68 c8 40 80 00       	push   $0x8040c8
+  800fb8:	e8 6d f2 ff ff       	call   80022a <_panic>
+
+00800fbd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fce:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fdb:	5b                   	pop    %ebx
+  800fdc:	5e                   	pop    %esi
+  800fdd:	5f                   	pop    %edi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+
+00800fe0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	57                   	push   %edi
+  800fe4:	56                   	push   %esi
+  800fe5:	53                   	push   %ebx
+  800fe6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ff6:	89 cb                	mov    %ecx,%ebx
+  800ff8:	89 cf                	mov    %ecx,%edi
+  800ffa:	89 ce                	mov    %ecx,%esi
+  800ffc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ffe:	85 c0                	test   %eax,%eax
+  801000:	7f 08                	jg     80100a <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801005:	5b                   	pop    %ebx
+  801006:	5e                   	pop    %esi
+  801007:	5f                   	pop    %edi
+  801008:	5d                   	pop    %ebp
+  801009:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100a:	83 ec 0c             	sub    $0xc,%esp
+  80100d:	50                   	push   %eax
+  80100e:	6a 0d                	push   $0xd
+  801010:	68 ab 40 80 00       	push   $0x8040ab
+  801015:	6a 23                	push   $0x23
+  801017:	68 c8 40 80 00       	push   $0x8040c8
+  80101c:	e8 09 f2 ff ff       	call   80022a <_panic>
+
+00801021 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801021:	55                   	push   %ebp
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	57                   	push   %edi
+  801025:	56                   	push   %esi
+  801026:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801032:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801035:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801038:	8b 75 18             	mov    0x18(%ebp),%esi
+  80103b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+
+00801042 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+  801048:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80104b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80105b:	89 df                	mov    %ebx,%edi
+  80105d:	89 de                	mov    %ebx,%esi
+  80105f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801061:	85 c0                	test   %eax,%eax
+  801063:	7f 08                	jg     80106d <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801065:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106d:	83 ec 0c             	sub    $0xc,%esp
+  801070:	50                   	push   %eax
+  801071:	6a 0d                	push   $0xd
+  801073:	68 ab 40 80 00       	push   $0x8040ab
+  801078:	6a 23                	push   $0x23
+  80107a:	68 c8 40 80 00       	push   $0x8040c8
+  80107f:	e8 a6 f1 ff ff       	call   80022a <_panic>
+
+00801084 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	57                   	push   %edi
+  801088:	56                   	push   %esi
+  801089:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80108a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801094:	89 d1                	mov    %edx,%ecx
+  801096:	89 d3                	mov    %edx,%ebx
+  801098:	89 d7                	mov    %edx,%edi
+  80109a:	89 d6                	mov    %edx,%esi
+  80109c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+
+008010a3 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	56                   	push   %esi
+  8010a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010b9:	89 df                	mov    %ebx,%edi
+  8010bb:	89 de                	mov    %ebx,%esi
+  8010bd:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8010bf:	5b                   	pop    %ebx
+  8010c0:	5e                   	pop    %esi
+  8010c1:	5f                   	pop    %edi
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	c3                   	ret
+
+008010c4 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8010c4:	55                   	push   %ebp
+  8010c5:	89 e5                	mov    %esp,%ebp
+  8010c7:	57                   	push   %edi
+  8010c8:	56                   	push   %esi
+  8010c9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010d7:	89 cb                	mov    %ecx,%ebx
+  8010d9:	89 cf                	mov    %ecx,%edi
+  8010db:	89 ce                	mov    %ecx,%esi
+  8010dd:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8010df:	5b                   	pop    %ebx
+  8010e0:	5e                   	pop    %esi
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+
+008010e4 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010fa:	89 df                	mov    %ebx,%edi
+  8010fc:	89 de                	mov    %ebx,%esi
+  8010fe:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801100:	5b                   	pop    %ebx
+  801101:	5e                   	pop    %esi
+  801102:	5f                   	pop    %edi
+  801103:	5d                   	pop    %ebp
+  801104:	c3                   	ret
+
+00801105 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 12 00 00 00       	mov    $0x12,%eax
+  80111b:	89 df                	mov    %ebx,%edi
+  80111d:	89 de                	mov    %ebx,%esi
+  80111f:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801121:	5b                   	pop    %ebx
+  801122:	5e                   	pop    %esi
+  801123:	5f                   	pop    %edi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+
+00801126 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	b8 13 00 00 00       	mov    $0x13,%eax
+  801139:	89 cb                	mov    %ecx,%ebx
+  80113b:	89 cf                	mov    %ecx,%edi
+  80113d:	89 ce                	mov    %ecx,%esi
+  80113f:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	57                   	push   %edi
+  80114a:	56                   	push   %esi
+  80114b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801151:	8b 55 08             	mov    0x8(%ebp),%edx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 14 00 00 00       	mov    $0x14,%eax
+  80115c:	89 df                	mov    %ebx,%edi
+  80115e:	89 de                	mov    %ebx,%esi
+  801160:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+
+00801167 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	b8 15 00 00 00       	mov    $0x15,%eax
+  80117a:	89 cb                	mov    %ecx,%ebx
+  80117c:	89 cf                	mov    %ecx,%edi
+  80117e:	89 ce                	mov    %ecx,%esi
+  801180:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801182:	5b                   	pop    %ebx
+  801183:	5e                   	pop    %esi
+  801184:	5f                   	pop    %edi
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+
+00801187 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118d:	be 00 00 00 00       	mov    $0x0,%esi
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+  801195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801198:	b8 16 00 00 00       	mov    $0x16,%eax
+  80119d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a0:	89 f7                	mov    %esi,%edi
+  8011a2:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+
+008011a9 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	57                   	push   %edi
+  8011ad:	56                   	push   %esi
+  8011ae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ba:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011bf:	89 df                	mov    %ebx,%edi
+  8011c1:	89 de                	mov    %ebx,%esi
+  8011c3:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8011c5:	5b                   	pop    %ebx
+  8011c6:	5e                   	pop    %esi
+  8011c7:	5f                   	pop    %edi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	c3                   	ret
+
+008011ca <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d8:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011dd:	89 cb                	mov    %ecx,%ebx
+  8011df:	89 cf                	mov    %ecx,%edi
+  8011e1:	89 ce                	mov    %ecx,%esi
+  8011e3:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8011e5:	5b                   	pop    %ebx
+  8011e6:	5e                   	pop    %esi
+  8011e7:	5f                   	pop    %edi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	c3                   	ret
+
+008011ea <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8011ea:	55                   	push   %ebp
+  8011eb:	89 e5                	mov    %esp,%ebp
+  8011ed:	57                   	push   %edi
+  8011ee:	56                   	push   %esi
+  8011ef:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8011f0:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8011f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fc:	b8 19 00 00 00       	mov    $0x19,%eax
+  801201:	89 df                	mov    %ebx,%edi
+  801203:	89 de                	mov    %ebx,%esi
+  801205:	cd 30                	int    $0x30
+}
+  801207:	5b                   	pop    %ebx
+  801208:	5e                   	pop    %esi
+  801209:	5f                   	pop    %edi
+  80120a:	5d                   	pop    %ebp
+  80120b:	c3                   	ret
+
+0080120c <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801212:	be 00 00 00 00       	mov    $0x0,%esi
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801225:	89 f7                	mov    %esi,%edi
+  801227:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801229:	5b                   	pop    %ebx
+  80122a:	5e                   	pop    %esi
+  80122b:	5f                   	pop    %edi
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+
+0080122e <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	57                   	push   %edi
+  801232:	56                   	push   %esi
+  801233:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801234:	be 00 00 00 00       	mov    $0x0,%esi
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801244:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801247:	89 f7                	mov    %esi,%edi
+  801249:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80124b:	5b                   	pop    %ebx
+  80124c:	5e                   	pop    %esi
+  80124d:	5f                   	pop    %edi
+  80124e:	5d                   	pop    %ebp
+  80124f:	c3                   	ret
+
+00801250 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+  801253:	57                   	push   %edi
+  801254:	56                   	push   %esi
+  801255:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801256:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801261:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801266:	89 df                	mov    %ebx,%edi
+  801268:	89 de                	mov    %ebx,%esi
+  80126a:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80126c:	5b                   	pop    %ebx
+  80126d:	5e                   	pop    %esi
+  80126e:	5f                   	pop    %edi
+  80126f:	5d                   	pop    %ebp
+  801270:	c3                   	ret
+
+00801271 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801271:	55                   	push   %ebp
+  801272:	89 e5                	mov    %esp,%ebp
+  801274:	57                   	push   %edi
+  801275:	56                   	push   %esi
+  801276:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801277:	be 00 00 00 00       	mov    $0x0,%esi
+  80127c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801282:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801287:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80128a:	89 f7                	mov    %esi,%edi
+  80128c:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80128e:	5b                   	pop    %ebx
+  80128f:	5e                   	pop    %esi
+  801290:	5f                   	pop    %edi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+
+00801293 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801296:	8b 45 08             	mov    0x8(%ebp),%eax
+  801299:	05 00 00 00 30       	add    $0x30000000,%eax
+  80129e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+
+008012a3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012a3:	55                   	push   %ebp
+  8012a4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012a9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012ae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012b3:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+
+008012ba <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012c2:	89 c2                	mov    %eax,%edx
+  8012c4:	c1 ea 16             	shr    $0x16,%edx
+  8012c7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012ce:	f6 c2 01             	test   $0x1,%dl
+  8012d1:	74 29                	je     8012fc <fd_alloc+0x42>
+  8012d3:	89 c2                	mov    %eax,%edx
+  8012d5:	c1 ea 0c             	shr    $0xc,%edx
+  8012d8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012df:	f6 c2 01             	test   $0x1,%dl
+  8012e2:	74 18                	je     8012fc <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  8012e4:	05 00 10 00 00       	add    $0x1000,%eax
+  8012e9:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8012ee:	75 d2                	jne    8012c2 <fd_alloc+0x8>
+  8012f0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012f5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012fa:	eb 05                	jmp    801301 <fd_alloc+0x47>
+			return 0;
+  8012fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801301:	8b 55 08             	mov    0x8(%ebp),%edx
+  801304:	89 02                	mov    %eax,(%edx)
+}
+  801306:	89 c8                	mov    %ecx,%eax
+  801308:	5d                   	pop    %ebp
+  801309:	c3                   	ret
+
+0080130a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80130a:	55                   	push   %ebp
+  80130b:	89 e5                	mov    %esp,%ebp
+  80130d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801310:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801315:	77 30                	ja     801347 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801317:	c1 e0 0c             	shl    $0xc,%eax
+  80131a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80131f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801325:	f6 c2 01             	test   $0x1,%dl
+  801328:	74 24                	je     80134e <fd_lookup+0x44>
+  80132a:	89 c2                	mov    %eax,%edx
+  80132c:	c1 ea 0c             	shr    $0xc,%edx
+  80132f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801336:	f6 c2 01             	test   $0x1,%dl
+  801339:	74 1a                	je     801355 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80133b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80133e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801340:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801345:	5d                   	pop    %ebp
+  801346:	c3                   	ret
+		return -E_INVAL;
+  801347:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134c:	eb f7                	jmp    801345 <fd_lookup+0x3b>
+		return -E_INVAL;
+  80134e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801353:	eb f0                	jmp    801345 <fd_lookup+0x3b>
+  801355:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80135a:	eb e9                	jmp    801345 <fd_lookup+0x3b>
+
+0080135c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	53                   	push   %ebx
+  801360:	83 ec 04             	sub    $0x4,%esp
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136b:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801370:	39 13                	cmp    %edx,(%ebx)
+  801372:	74 54                	je     8013c8 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801374:	83 c0 01             	add    $0x1,%eax
+  801377:	8b 1c 85 54 41 80 00 	mov    0x804154(,%eax,4),%ebx
+  80137e:	85 db                	test   %ebx,%ebx
+  801380:	75 ee                	jne    801370 <dev_lookup+0x14>
+  801382:	89 e1                	mov    %esp,%ecx
+  801384:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801389:	29 c8                	sub    %ecx,%eax
+  80138b:	89 c1                	mov    %eax,%ecx
+  80138d:	c1 e9 0f             	shr    $0xf,%ecx
+  801390:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139a:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80139d:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8013a4:	8b 40 48             	mov    0x48(%eax),%eax
+  8013a7:	83 ec 04             	sub    $0x4,%esp
+  8013aa:	52                   	push   %edx
+  8013ab:	50                   	push   %eax
+  8013ac:	68 d8 40 80 00       	push   $0x8040d8
+  8013b1:	e8 4f ef ff ff       	call   800305 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013b6:	83 c4 10             	add    $0x10,%esp
+  8013b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013c1:	89 1a                	mov    %ebx,(%edx)
+}
+  8013c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c6:	c9                   	leave
+  8013c7:	c3                   	ret
+			return 0;
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cd:	eb ef                	jmp    8013be <dev_lookup+0x62>
+
+008013cf <fd_close>:
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	57                   	push   %edi
+  8013d3:	56                   	push   %esi
+  8013d4:	53                   	push   %ebx
+  8013d5:	83 ec 24             	sub    $0x24,%esp
+  8013d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013de:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013e1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013e2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013e8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013eb:	50                   	push   %eax
+  8013ec:	e8 19 ff ff ff       	call   80130a <fd_lookup>
+  8013f1:	89 c3                	mov    %eax,%ebx
+  8013f3:	83 c4 10             	add    $0x10,%esp
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	78 05                	js     8013ff <fd_close+0x30>
+	    || fd != fd2)
+  8013fa:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013fd:	74 0f                	je     80140e <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8013ff:	85 ff                	test   %edi,%edi
+  801401:	0f 44 df             	cmove  %edi,%ebx
+}
+  801404:	89 d8                	mov    %ebx,%eax
+  801406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801409:	5b                   	pop    %ebx
+  80140a:	5e                   	pop    %esi
+  80140b:	5f                   	pop    %edi
+  80140c:	5d                   	pop    %ebp
+  80140d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80140e:	83 ec 08             	sub    $0x8,%esp
+  801411:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801414:	50                   	push   %eax
+  801415:	ff 36                	push   (%esi)
+  801417:	e8 40 ff ff ff       	call   80135c <dev_lookup>
+  80141c:	89 c3                	mov    %eax,%ebx
+  80141e:	83 c4 10             	add    $0x10,%esp
+  801421:	85 c0                	test   %eax,%eax
+  801423:	78 1a                	js     80143f <fd_close+0x70>
+		if (dev->dev_close)
+  801425:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801428:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80142b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801430:	85 c0                	test   %eax,%eax
+  801432:	74 0b                	je     80143f <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801434:	83 ec 0c             	sub    $0xc,%esp
+  801437:	56                   	push   %esi
+  801438:	ff d0                	call   *%eax
+  80143a:	89 c3                	mov    %eax,%ebx
+  80143c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80143f:	83 ec 08             	sub    $0x8,%esp
+  801442:	56                   	push   %esi
+  801443:	6a 00                	push   $0x0
+  801445:	e8 6b fa ff ff       	call   800eb5 <sys_page_unmap>
+	return r;
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	eb b5                	jmp    801404 <fd_close+0x35>
+
+0080144f <close>:
+
+int
+close(int fdnum)
+{
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801455:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801458:	50                   	push   %eax
+  801459:	ff 75 08             	push   0x8(%ebp)
+  80145c:	e8 a9 fe ff ff       	call   80130a <fd_lookup>
+  801461:	83 c4 10             	add    $0x10,%esp
+  801464:	85 c0                	test   %eax,%eax
+  801466:	79 02                	jns    80146a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+		return fd_close(fd, 1);
+  80146a:	83 ec 08             	sub    $0x8,%esp
+  80146d:	6a 01                	push   $0x1
+  80146f:	ff 75 f4             	push   -0xc(%ebp)
+  801472:	e8 58 ff ff ff       	call   8013cf <fd_close>
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	eb ec                	jmp    801468 <close+0x19>
+
+0080147c <close_all>:
+
+void
+close_all(void)
+{
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	53                   	push   %ebx
+  801480:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801483:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801488:	83 ec 0c             	sub    $0xc,%esp
+  80148b:	53                   	push   %ebx
+  80148c:	e8 be ff ff ff       	call   80144f <close>
+	for (i = 0; i < MAXFD; i++)
+  801491:	83 c3 01             	add    $0x1,%ebx
+  801494:	83 c4 10             	add    $0x10,%esp
+  801497:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80149d:	75 e9                	jne    801488 <close_all+0xc>
+}
+  80149f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014a2:	c9                   	leave
+  8014a3:	c3                   	ret
+
+008014a4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014a4:	55                   	push   %ebp
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	57                   	push   %edi
+  8014a8:	56                   	push   %esi
+  8014a9:	53                   	push   %ebx
+  8014aa:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014b0:	50                   	push   %eax
+  8014b1:	ff 75 08             	push   0x8(%ebp)
+  8014b4:	e8 51 fe ff ff       	call   80130a <fd_lookup>
+  8014b9:	89 c3                	mov    %eax,%ebx
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	78 7f                	js     801541 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014c2:	83 ec 0c             	sub    $0xc,%esp
+  8014c5:	ff 75 0c             	push   0xc(%ebp)
+  8014c8:	e8 82 ff ff ff       	call   80144f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014d0:	c1 e6 0c             	shl    $0xc,%esi
+  8014d3:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014dc:	89 3c 24             	mov    %edi,(%esp)
+  8014df:	e8 bf fd ff ff       	call   8012a3 <fd2data>
+  8014e4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014e6:	89 34 24             	mov    %esi,(%esp)
+  8014e9:	e8 b5 fd ff ff       	call   8012a3 <fd2data>
+  8014ee:	83 c4 10             	add    $0x10,%esp
+  8014f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8014f4:	89 d8                	mov    %ebx,%eax
+  8014f6:	c1 e8 16             	shr    $0x16,%eax
+  8014f9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801500:	a8 01                	test   $0x1,%al
+  801502:	74 11                	je     801515 <dup+0x71>
+  801504:	89 d8                	mov    %ebx,%eax
+  801506:	c1 e8 0c             	shr    $0xc,%eax
+  801509:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801510:	f6 c2 01             	test   $0x1,%dl
+  801513:	75 36                	jne    80154b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801515:	89 f8                	mov    %edi,%eax
+  801517:	c1 e8 0c             	shr    $0xc,%eax
+  80151a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801521:	83 ec 0c             	sub    $0xc,%esp
+  801524:	25 07 0e 00 00       	and    $0xe07,%eax
+  801529:	50                   	push   %eax
+  80152a:	56                   	push   %esi
+  80152b:	6a 00                	push   $0x0
+  80152d:	57                   	push   %edi
+  80152e:	6a 00                	push   $0x0
+  801530:	e8 3e f9 ff ff       	call   800e73 <sys_page_map>
+  801535:	89 c3                	mov    %eax,%ebx
+  801537:	83 c4 20             	add    $0x20,%esp
+  80153a:	85 c0                	test   %eax,%eax
+  80153c:	78 33                	js     801571 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80153e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801541:	89 d8                	mov    %ebx,%eax
+  801543:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801546:	5b                   	pop    %ebx
+  801547:	5e                   	pop    %esi
+  801548:	5f                   	pop    %edi
+  801549:	5d                   	pop    %ebp
+  80154a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80154b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801552:	83 ec 0c             	sub    $0xc,%esp
+  801555:	25 07 0e 00 00       	and    $0xe07,%eax
+  80155a:	50                   	push   %eax
+  80155b:	ff 75 d4             	push   -0x2c(%ebp)
+  80155e:	6a 00                	push   $0x0
+  801560:	53                   	push   %ebx
+  801561:	6a 00                	push   $0x0
+  801563:	e8 0b f9 ff ff       	call   800e73 <sys_page_map>
+  801568:	89 c3                	mov    %eax,%ebx
+  80156a:	83 c4 20             	add    $0x20,%esp
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	79 a4                	jns    801515 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801571:	83 ec 08             	sub    $0x8,%esp
+  801574:	56                   	push   %esi
+  801575:	6a 00                	push   $0x0
+  801577:	e8 39 f9 ff ff       	call   800eb5 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80157c:	83 c4 08             	add    $0x8,%esp
+  80157f:	ff 75 d4             	push   -0x2c(%ebp)
+  801582:	6a 00                	push   $0x0
+  801584:	e8 2c f9 ff ff       	call   800eb5 <sys_page_unmap>
+	return r;
+  801589:	83 c4 10             	add    $0x10,%esp
+  80158c:	eb b3                	jmp    801541 <dup+0x9d>
+
+0080158e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	56                   	push   %esi
+  801592:	53                   	push   %ebx
+  801593:	83 ec 18             	sub    $0x18,%esp
+  801596:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801599:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80159c:	50                   	push   %eax
+  80159d:	53                   	push   %ebx
+  80159e:	e8 67 fd ff ff       	call   80130a <fd_lookup>
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 3c                	js     8015e6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015aa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ad:	83 ec 08             	sub    $0x8,%esp
+  8015b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b3:	50                   	push   %eax
+  8015b4:	ff 36                	push   (%esi)
+  8015b6:	e8 a1 fd ff ff       	call   80135c <dev_lookup>
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	78 24                	js     8015e6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015c2:	8b 46 08             	mov    0x8(%esi),%eax
+  8015c5:	83 e0 03             	and    $0x3,%eax
+  8015c8:	83 f8 01             	cmp    $0x1,%eax
+  8015cb:	74 20                	je     8015ed <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015d0:	8b 40 08             	mov    0x8(%eax),%eax
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	74 54                	je     80162b <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015d7:	83 ec 04             	sub    $0x4,%esp
+  8015da:	ff 75 10             	push   0x10(%ebp)
+  8015dd:	ff 75 0c             	push   0xc(%ebp)
+  8015e0:	56                   	push   %esi
+  8015e1:	ff d0                	call   *%eax
+  8015e3:	83 c4 10             	add    $0x10,%esp
+}
+  8015e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e9:	5b                   	pop    %ebx
+  8015ea:	5e                   	pop    %esi
+  8015eb:	5d                   	pop    %ebp
+  8015ec:	c3                   	ret
+  8015ed:	89 e2                	mov    %esp,%edx
+  8015ef:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015f4:	29 d0                	sub    %edx,%eax
+  8015f6:	89 c2                	mov    %eax,%edx
+  8015f8:	c1 ea 0f             	shr    $0xf,%edx
+  8015fb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801600:	b8 00 00 00 00       	mov    $0x0,%eax
+  801605:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801608:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80160f:	8b 40 48             	mov    0x48(%eax),%eax
+  801612:	83 ec 04             	sub    $0x4,%esp
+  801615:	53                   	push   %ebx
+  801616:	50                   	push   %eax
+  801617:	68 19 41 80 00       	push   $0x804119
+  80161c:	e8 e4 ec ff ff       	call   800305 <cprintf>
+		return -E_INVAL;
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801629:	eb bb                	jmp    8015e6 <read+0x58>
+		return -E_NOT_SUPP;
+  80162b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801630:	eb b4                	jmp    8015e6 <read+0x58>
+
+00801632 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801632:	55                   	push   %ebp
+  801633:	89 e5                	mov    %esp,%ebp
+  801635:	57                   	push   %edi
+  801636:	56                   	push   %esi
+  801637:	53                   	push   %ebx
+  801638:	83 ec 0c             	sub    $0xc,%esp
+  80163b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80163e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801641:	85 f6                	test   %esi,%esi
+  801643:	74 30                	je     801675 <readn+0x43>
+  801645:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164a:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80164f:	83 ec 04             	sub    $0x4,%esp
+  801652:	89 f2                	mov    %esi,%edx
+  801654:	29 c2                	sub    %eax,%edx
+  801656:	52                   	push   %edx
+  801657:	01 f8                	add    %edi,%eax
+  801659:	50                   	push   %eax
+  80165a:	ff 75 08             	push   0x8(%ebp)
+  80165d:	e8 2c ff ff ff       	call   80158e <read>
+		if (m < 0)
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 15                	js     80167e <readn+0x4c>
+			return m;
+		if (m == 0)
+  801669:	74 11                	je     80167c <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80166b:	01 c3                	add    %eax,%ebx
+  80166d:	89 d8                	mov    %ebx,%eax
+  80166f:	39 f3                	cmp    %esi,%ebx
+  801671:	72 dc                	jb     80164f <readn+0x1d>
+  801673:	eb 09                	jmp    80167e <readn+0x4c>
+  801675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167a:	eb 02                	jmp    80167e <readn+0x4c>
+  80167c:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80167e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801681:	5b                   	pop    %ebx
+  801682:	5e                   	pop    %esi
+  801683:	5f                   	pop    %edi
+  801684:	5d                   	pop    %ebp
+  801685:	c3                   	ret
+
+00801686 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801686:	55                   	push   %ebp
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	56                   	push   %esi
+  80168a:	53                   	push   %ebx
+  80168b:	83 ec 18             	sub    $0x18,%esp
+  80168e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801691:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801694:	50                   	push   %eax
+  801695:	53                   	push   %ebx
+  801696:	e8 6f fc ff ff       	call   80130a <fd_lookup>
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	78 37                	js     8016d9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016a2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016a5:	83 ec 08             	sub    $0x8,%esp
+  8016a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ab:	50                   	push   %eax
+  8016ac:	ff 36                	push   (%esi)
+  8016ae:	e8 a9 fc ff ff       	call   80135c <dev_lookup>
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	78 1f                	js     8016d9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016ba:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016be:	74 20                	je     8016e0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016c6:	85 c0                	test   %eax,%eax
+  8016c8:	74 54                	je     80171e <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016ca:	83 ec 04             	sub    $0x4,%esp
+  8016cd:	ff 75 10             	push   0x10(%ebp)
+  8016d0:	ff 75 0c             	push   0xc(%ebp)
+  8016d3:	56                   	push   %esi
+  8016d4:	ff d0                	call   *%eax
+  8016d6:	83 c4 10             	add    $0x10,%esp
+}
+  8016d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016dc:	5b                   	pop    %ebx
+  8016dd:	5e                   	pop    %esi
+  8016de:	5d                   	pop    %ebp
+  8016df:	c3                   	ret
+  8016e0:	89 e2                	mov    %esp,%edx
+  8016e2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016e7:	29 d0                	sub    %edx,%eax
+  8016e9:	89 c2                	mov    %eax,%edx
+  8016eb:	c1 ea 0f             	shr    $0xf,%edx
+  8016ee:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f8:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016fb:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801702:	8b 40 48             	mov    0x48(%eax),%eax
+  801705:	83 ec 04             	sub    $0x4,%esp
+  801708:	53                   	push   %ebx
+  801709:	50                   	push   %eax
+  80170a:	68 35 41 80 00       	push   $0x804135
+  80170f:	e8 f1 eb ff ff       	call   800305 <cprintf>
+		return -E_INVAL;
+  801714:	83 c4 10             	add    $0x10,%esp
+  801717:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80171c:	eb bb                	jmp    8016d9 <write+0x53>
+		return -E_NOT_SUPP;
+  80171e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801723:	eb b4                	jmp    8016d9 <write+0x53>
+
+00801725 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801725:	55                   	push   %ebp
+  801726:	89 e5                	mov    %esp,%ebp
+  801728:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80172b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80172e:	50                   	push   %eax
+  80172f:	ff 75 08             	push   0x8(%ebp)
+  801732:	e8 d3 fb ff ff       	call   80130a <fd_lookup>
+  801737:	83 c4 10             	add    $0x10,%esp
+  80173a:	85 c0                	test   %eax,%eax
+  80173c:	78 0e                	js     80174c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80173e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801741:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801744:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801747:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80174c:	c9                   	leave
+  80174d:	c3                   	ret
+
+0080174e <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	53                   	push   %ebx
+  801752:	83 ec 1c             	sub    $0x1c,%esp
+  801755:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801758:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80175b:	50                   	push   %eax
+  80175c:	ff 75 08             	push   0x8(%ebp)
+  80175f:	e8 a6 fb ff ff       	call   80130a <fd_lookup>
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 33                	js     80179e <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80176b:	83 fb 03             	cmp    $0x3,%ebx
+  80176e:	74 28                	je     801798 <fcntl+0x4a>
+  801770:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801775:	83 fb 04             	cmp    $0x4,%ebx
+  801778:	75 24                	jne    80179e <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80177a:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80177d:	8b 41 08             	mov    0x8(%ecx),%eax
+  801780:	80 e4 ef             	and    $0xef,%ah
+  801783:	8b 55 10             	mov    0x10(%ebp),%edx
+  801786:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80178c:	09 d0                	or     %edx,%eax
+  80178e:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	eb 06                	jmp    80179e <fcntl+0x50>
+		return fd->fd_omode;
+  801798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80179b:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80179e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a1:	c9                   	leave
+  8017a2:	c3                   	ret
+
+008017a3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	56                   	push   %esi
+  8017a7:	53                   	push   %ebx
+  8017a8:	83 ec 18             	sub    $0x18,%esp
+  8017ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017b1:	50                   	push   %eax
+  8017b2:	53                   	push   %ebx
+  8017b3:	e8 52 fb ff ff       	call   80130a <fd_lookup>
+  8017b8:	83 c4 10             	add    $0x10,%esp
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	78 34                	js     8017f3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017bf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017c2:	83 ec 08             	sub    $0x8,%esp
+  8017c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c8:	50                   	push   %eax
+  8017c9:	ff 36                	push   (%esi)
+  8017cb:	e8 8c fb ff ff       	call   80135c <dev_lookup>
+  8017d0:	83 c4 10             	add    $0x10,%esp
+  8017d3:	85 c0                	test   %eax,%eax
+  8017d5:	78 1c                	js     8017f3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017d7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017db:	74 1d                	je     8017fa <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e0:	8b 40 18             	mov    0x18(%eax),%eax
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	74 51                	je     801838 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017e7:	83 ec 08             	sub    $0x8,%esp
+  8017ea:	ff 75 0c             	push   0xc(%ebp)
+  8017ed:	56                   	push   %esi
+  8017ee:	ff d0                	call   *%eax
+  8017f0:	83 c4 10             	add    $0x10,%esp
+}
+  8017f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017f6:	5b                   	pop    %ebx
+  8017f7:	5e                   	pop    %esi
+  8017f8:	5d                   	pop    %ebp
+  8017f9:	c3                   	ret
+  8017fa:	89 e2                	mov    %esp,%edx
+  8017fc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801801:	29 d0                	sub    %edx,%eax
+  801803:	89 c2                	mov    %eax,%edx
+  801805:	c1 ea 0f             	shr    $0xf,%edx
+  801808:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80180d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801812:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801815:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80181c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80181f:	83 ec 04             	sub    $0x4,%esp
+  801822:	53                   	push   %ebx
+  801823:	50                   	push   %eax
+  801824:	68 f8 40 80 00       	push   $0x8040f8
+  801829:	e8 d7 ea ff ff       	call   800305 <cprintf>
+		return -E_INVAL;
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801836:	eb bb                	jmp    8017f3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801838:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80183d:	eb b4                	jmp    8017f3 <ftruncate+0x50>
+
+0080183f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80183f:	55                   	push   %ebp
+  801840:	89 e5                	mov    %esp,%ebp
+  801842:	56                   	push   %esi
+  801843:	53                   	push   %ebx
+  801844:	83 ec 18             	sub    $0x18,%esp
+  801847:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80184a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80184d:	50                   	push   %eax
+  80184e:	ff 75 08             	push   0x8(%ebp)
+  801851:	e8 b4 fa ff ff       	call   80130a <fd_lookup>
+  801856:	83 c4 10             	add    $0x10,%esp
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	78 53                	js     8018b0 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80185d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801860:	83 ec 08             	sub    $0x8,%esp
+  801863:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801866:	50                   	push   %eax
+  801867:	ff 36                	push   (%esi)
+  801869:	e8 ee fa ff ff       	call   80135c <dev_lookup>
+  80186e:	83 c4 10             	add    $0x10,%esp
+  801871:	85 c0                	test   %eax,%eax
+  801873:	78 3b                	js     8018b0 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801878:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80187c:	74 39                	je     8018b7 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80187e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801881:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801888:	00 00 00 
+	stat->st_isdir = 0;
+  80188b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801892:	00 00 00 
+	stat->st_version = 0;
+  801895:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80189c:	00 00 00 
+	stat->st_dev = dev;
+  80189f:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018a5:	83 ec 08             	sub    $0x8,%esp
+  8018a8:	53                   	push   %ebx
+  8018a9:	56                   	push   %esi
+  8018aa:	ff 50 14             	call   *0x14(%eax)
+  8018ad:	83 c4 10             	add    $0x10,%esp
+}
+  8018b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b3:	5b                   	pop    %ebx
+  8018b4:	5e                   	pop    %esi
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018bc:	eb f2                	jmp    8018b0 <fstat+0x71>
+
+008018be <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	56                   	push   %esi
+  8018c2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018c3:	83 ec 08             	sub    $0x8,%esp
+  8018c6:	6a 00                	push   $0x0
+  8018c8:	ff 75 08             	push   0x8(%ebp)
+  8018cb:	e8 b7 01 00 00       	call   801a87 <open>
+  8018d0:	89 c3                	mov    %eax,%ebx
+  8018d2:	83 c4 10             	add    $0x10,%esp
+  8018d5:	85 c0                	test   %eax,%eax
+  8018d7:	78 1b                	js     8018f4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018d9:	83 ec 08             	sub    $0x8,%esp
+  8018dc:	ff 75 0c             	push   0xc(%ebp)
+  8018df:	50                   	push   %eax
+  8018e0:	e8 5a ff ff ff       	call   80183f <fstat>
+  8018e5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018e7:	89 1c 24             	mov    %ebx,(%esp)
+  8018ea:	e8 60 fb ff ff       	call   80144f <close>
+	return r;
+  8018ef:	83 c4 10             	add    $0x10,%esp
+  8018f2:	89 f3                	mov    %esi,%ebx
+}
+  8018f4:	89 d8                	mov    %ebx,%eax
+  8018f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f9:	5b                   	pop    %ebx
+  8018fa:	5e                   	pop    %esi
+  8018fb:	5d                   	pop    %ebp
+  8018fc:	c3                   	ret
+
+008018fd <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8018fd:	55                   	push   %ebp
+  8018fe:	89 e5                	mov    %esp,%ebp
+  801900:	56                   	push   %esi
+  801901:	53                   	push   %ebx
+  801902:	89 c6                	mov    %eax,%esi
+  801904:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801906:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  80190d:	74 27                	je     801936 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80190f:	6a 07                	push   $0x7
+  801911:	68 00 70 80 00       	push   $0x807000
+  801916:	56                   	push   %esi
+  801917:	ff 35 04 60 80 00    	push   0x806004
+  80191d:	e8 ed 20 00 00       	call   803a0f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801922:	83 c4 0c             	add    $0xc,%esp
+  801925:	6a 00                	push   $0x0
+  801927:	53                   	push   %ebx
+  801928:	6a 00                	push   $0x0
+  80192a:	e8 50 1e 00 00       	call   80377f <ipc_recv>
+}
+  80192f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801932:	5b                   	pop    %ebx
+  801933:	5e                   	pop    %esi
+  801934:	5d                   	pop    %ebp
+  801935:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	6a 02                	push   $0x2
+  80193b:	e8 38 21 00 00       	call   803a78 <ipc_find_env>
+  801940:	a3 04 60 80 00       	mov    %eax,0x806004
+  801945:	83 c4 10             	add    $0x10,%esp
+  801948:	eb c5                	jmp    80190f <fsipc+0x12>
+
+0080194a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801950:	8b 45 08             	mov    0x8(%ebp),%eax
+  801953:	8b 40 0c             	mov    0xc(%eax),%eax
+  801956:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80195b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80195e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801963:	ba 00 00 00 00       	mov    $0x0,%edx
+  801968:	b8 02 00 00 00       	mov    $0x2,%eax
+  80196d:	e8 8b ff ff ff       	call   8018fd <fsipc>
+}
+  801972:	c9                   	leave
+  801973:	c3                   	ret
+
+00801974 <devfile_flush>:
+{
+  801974:	55                   	push   %ebp
+  801975:	89 e5                	mov    %esp,%ebp
+  801977:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80197a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801980:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801985:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80198f:	e8 69 ff ff ff       	call   8018fd <fsipc>
+}
+  801994:	c9                   	leave
+  801995:	c3                   	ret
+
+00801996 <devfile_stat>:
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	53                   	push   %ebx
+  80199a:	83 ec 04             	sub    $0x4,%esp
+  80199d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019a6:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019b5:	e8 43 ff ff ff       	call   8018fd <fsipc>
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	78 37                	js     8019f5 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019be:	83 ec 08             	sub    $0x8,%esp
+  8019c1:	68 00 70 80 00       	push   $0x807000
+  8019c6:	53                   	push   %ebx
+  8019c7:	e8 30 f0 ff ff       	call   8009fc <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019cc:	a1 80 70 80 00       	mov    0x807080,%eax
+  8019d1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019d7:	a1 84 70 80 00       	mov    0x807084,%eax
+  8019dc:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8019e2:	a1 88 70 80 00       	mov    0x807088,%eax
+  8019e7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f8:	c9                   	leave
+  8019f9:	c3                   	ret
+
+008019fa <devfile_write>:
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	83 ec 0c             	sub    $0xc,%esp
+  801a00:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801a03:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a08:	39 d0                	cmp    %edx,%eax
+  801a0a:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a10:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a13:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801a19:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801a1e:	50                   	push   %eax
+  801a1f:	ff 75 0c             	push   0xc(%ebp)
+  801a22:	68 08 70 80 00       	push   $0x807008
+  801a27:	e8 80 f1 ff ff       	call   800bac <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801a2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a31:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a36:	e8 c2 fe ff ff       	call   8018fd <fsipc>
+}
+  801a3b:	c9                   	leave
+  801a3c:	c3                   	ret
+
+00801a3d <devfile_read>:
+{
+  801a3d:	55                   	push   %ebp
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	53                   	push   %ebx
+  801a41:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a47:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a4a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801a4f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a52:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801a57:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a5c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a61:	e8 97 fe ff ff       	call   8018fd <fsipc>
+  801a66:	89 c3                	mov    %eax,%ebx
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	78 14                	js     801a80 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801a6c:	83 ec 04             	sub    $0x4,%esp
+  801a6f:	50                   	push   %eax
+  801a70:	68 00 70 80 00       	push   $0x807000
+  801a75:	ff 75 0c             	push   0xc(%ebp)
+  801a78:	e8 2f f1 ff ff       	call   800bac <memmove>
+	return r;
+  801a7d:	83 c4 10             	add    $0x10,%esp
+}
+  801a80:	89 d8                	mov    %ebx,%eax
+  801a82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a85:	c9                   	leave
+  801a86:	c3                   	ret
+
+00801a87 <open>:
+{
+  801a87:	55                   	push   %ebp
+  801a88:	89 e5                	mov    %esp,%ebp
+  801a8a:	53                   	push   %ebx
+  801a8b:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	e8 23 f8 ff ff       	call   8012ba <fd_alloc>
+  801a97:	89 c3                	mov    %eax,%ebx
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 2a                	js     801aca <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801aa0:	83 ec 0c             	sub    $0xc,%esp
+  801aa3:	ff 75 08             	push   0x8(%ebp)
+  801aa6:	e8 05 ef ff ff       	call   8009b0 <strlen>
+  801aab:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801aae:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801ab3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ab8:	7e 17                	jle    801ad1 <open+0x4a>
+	fd_close(fd, 1);
+  801aba:	83 ec 08             	sub    $0x8,%esp
+  801abd:	6a 01                	push   $0x1
+  801abf:	ff 75 f4             	push   -0xc(%ebp)
+  801ac2:	e8 08 f9 ff ff       	call   8013cf <fd_close>
+	return r;
+  801ac7:	83 c4 10             	add    $0x10,%esp
+}
+  801aca:	89 d8                	mov    %ebx,%eax
+  801acc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801acf:	c9                   	leave
+  801ad0:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801ad1:	83 ec 08             	sub    $0x8,%esp
+  801ad4:	ff 75 08             	push   0x8(%ebp)
+  801ad7:	68 00 70 80 00       	push   $0x807000
+  801adc:	e8 1b ef ff ff       	call   8009fc <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ae1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ae4:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801ae9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801aec:	b8 01 00 00 00       	mov    $0x1,%eax
+  801af1:	e8 07 fe ff ff       	call   8018fd <fsipc>
+  801af6:	89 c3                	mov    %eax,%ebx
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 bb                	js     801aba <open+0x33>
+	return fd2num(fd); 	
+  801aff:	83 ec 0c             	sub    $0xc,%esp
+  801b02:	ff 75 f4             	push   -0xc(%ebp)
+  801b05:	e8 89 f7 ff ff       	call   801293 <fd2num>
+  801b0a:	89 c3                	mov    %eax,%ebx
+  801b0c:	83 c4 10             	add    $0x10,%esp
+  801b0f:	eb b9                	jmp    801aca <open+0x43>
+
+00801b11 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801b11:	55                   	push   %ebp
+  801b12:	89 e5                	mov    %esp,%ebp
+  801b14:	53                   	push   %ebx
+  801b15:	83 ec 1c             	sub    $0x1c,%esp
+  801b18:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b1e:	50                   	push   %eax
+  801b1f:	ff 75 08             	push   0x8(%ebp)
+  801b22:	e8 e3 f7 ff ff       	call   80130a <fd_lookup>
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	78 5a                	js     801b88 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b31:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801b37:	39 10                	cmp    %edx,(%eax)
+  801b39:	75 66                	jne    801ba1 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801b3b:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  801b42:	74 49                	je     801b8d <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b47:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b4a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801b4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b52:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801b57:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b5d:	6a 07                	push   $0x7
+  801b5f:	68 00 70 80 00       	push   $0x807000
+  801b64:	6a 09                	push   $0x9
+  801b66:	ff 35 04 60 80 00    	push   0x806004
+  801b6c:	e8 9e 1e 00 00       	call   803a0f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801b71:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b78:	6a 00                	push   $0x0
+  801b7a:	53                   	push   %ebx
+  801b7b:	ff 75 10             	push   0x10(%ebp)
+  801b7e:	6a 00                	push   $0x0
+  801b80:	e8 c7 1c 00 00       	call   80384c <ipc_recv_pages>
+  801b85:	83 c4 20             	add    $0x20,%esp
+}
+  801b88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b8b:	c9                   	leave
+  801b8c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b8d:	83 ec 0c             	sub    $0xc,%esp
+  801b90:	6a 02                	push   $0x2
+  801b92:	e8 e1 1e 00 00       	call   803a78 <ipc_find_env>
+  801b97:	a3 04 60 80 00       	mov    %eax,0x806004
+  801b9c:	83 c4 10             	add    $0x10,%esp
+  801b9f:	eb a3                	jmp    801b44 <fmap+0x33>
+		return -E_INVAL;
+  801ba1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba6:	eb e0                	jmp    801b88 <fmap+0x77>
+
+00801ba8 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ba8:	55                   	push   %ebp
+  801ba9:	89 e5                	mov    %esp,%ebp
+  801bab:	53                   	push   %ebx
+  801bac:	83 ec 10             	sub    $0x10,%esp
+  801baf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801bb2:	53                   	push   %ebx
+  801bb3:	e8 f8 ed ff ff       	call   8009b0 <strlen>
+  801bb8:	83 c4 10             	add    $0x10,%esp
+  801bbb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bc0:	7f 25                	jg     801be7 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801bc2:	83 ec 08             	sub    $0x8,%esp
+  801bc5:	53                   	push   %ebx
+  801bc6:	68 00 70 80 00       	push   $0x807000
+  801bcb:	e8 2c ee ff ff       	call   8009fc <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd5:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bda:	e8 1e fd ff ff       	call   8018fd <fsipc>
+  801bdf:	83 c4 10             	add    $0x10,%esp
+}
+  801be2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be5:	c9                   	leave
+  801be6:	c3                   	ret
+		return -E_BAD_PATH;
+  801be7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bec:	eb f4                	jmp    801be2 <remove+0x3a>
+
+00801bee <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801bee:	55                   	push   %ebp
+  801bef:	89 e5                	mov    %esp,%ebp
+  801bf1:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801bf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf9:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bfe:	e8 fa fc ff ff       	call   8018fd <fsipc>
+}
+  801c03:	c9                   	leave
+  801c04:	c3                   	ret
+
+00801c05 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801c05:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801c09:	7f 01                	jg     801c0c <writebuf+0x7>
+  801c0b:	c3                   	ret
+{
+  801c0c:	55                   	push   %ebp
+  801c0d:	89 e5                	mov    %esp,%ebp
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 08             	sub    $0x8,%esp
+  801c13:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801c15:	ff 70 04             	push   0x4(%eax)
+  801c18:	8d 40 10             	lea    0x10(%eax),%eax
+  801c1b:	50                   	push   %eax
+  801c1c:	ff 33                	push   (%ebx)
+  801c1e:	e8 63 fa ff ff       	call   801686 <write>
+		if (result > 0)
+  801c23:	83 c4 10             	add    $0x10,%esp
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	7e 03                	jle    801c2d <writebuf+0x28>
+			b->result += result;
+  801c2a:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801c2d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801c30:	74 0d                	je     801c3f <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c39:	0f 4f c2             	cmovg  %edx,%eax
+  801c3c:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801c3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+00801c44 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	53                   	push   %ebx
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801c4e:	8b 53 04             	mov    0x4(%ebx),%edx
+  801c51:	8d 42 01             	lea    0x1(%edx),%eax
+  801c54:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c5a:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801c5e:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801c63:	74 05                	je     801c6a <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801c65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c68:	c9                   	leave
+  801c69:	c3                   	ret
+		writebuf(b);
+  801c6a:	89 d8                	mov    %ebx,%eax
+  801c6c:	e8 94 ff ff ff       	call   801c05 <writebuf>
+		b->idx = 0;
+  801c71:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801c78:	eb eb                	jmp    801c65 <putch+0x21>
+
+00801c7a <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c86:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801c8c:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801c93:	00 00 00 
+	b.result = 0;
+  801c96:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801c9d:	00 00 00 
+	b.error = 1;
+  801ca0:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801ca7:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801caa:	ff 75 10             	push   0x10(%ebp)
+  801cad:	ff 75 0c             	push   0xc(%ebp)
+  801cb0:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801cb6:	50                   	push   %eax
+  801cb7:	68 44 1c 80 00       	push   $0x801c44
+  801cbc:	e8 43 e7 ff ff       	call   800404 <vprintfmt>
+	if (b.idx > 0)
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801ccb:	7f 12                	jg     801cdf <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801ccd:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	75 06                	jne    801cdd <vfprintf+0x63>
+  801cd7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801cdd:	c9                   	leave
+  801cde:	c3                   	ret
+		writebuf(&b);
+  801cdf:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801ce5:	e8 1b ff ff ff       	call   801c05 <writebuf>
+  801cea:	eb e1                	jmp    801ccd <vfprintf+0x53>
+
+00801cec <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801cec:	55                   	push   %ebp
+  801ced:	89 e5                	mov    %esp,%ebp
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801cf2:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801cf5:	50                   	push   %eax
+  801cf6:	ff 75 0c             	push   0xc(%ebp)
+  801cf9:	ff 75 08             	push   0x8(%ebp)
+  801cfc:	e8 79 ff ff ff       	call   801c7a <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801d01:	c9                   	leave
+  801d02:	c3                   	ret
+
+00801d03 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801d09:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801d0c:	50                   	push   %eax
+  801d0d:	ff 75 08             	push   0x8(%ebp)
+  801d10:	6a 01                	push   $0x1
+  801d12:	e8 63 ff ff ff       	call   801c7a <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801d17:	c9                   	leave
+  801d18:	c3                   	ret
+
+00801d19 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d19:	55                   	push   %ebp
+  801d1a:	89 e5                	mov    %esp,%ebp
+  801d1c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801d1f:	68 68 41 80 00       	push   $0x804168
+  801d24:	ff 75 0c             	push   0xc(%ebp)
+  801d27:	e8 d0 ec ff ff       	call   8009fc <strcpy>
+	return 0;
+}
+  801d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d31:	c9                   	leave
+  801d32:	c3                   	ret
+
+00801d33 <devsock_close>:
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	53                   	push   %ebx
+  801d37:	83 ec 10             	sub    $0x10,%esp
+  801d3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801d3d:	53                   	push   %ebx
+  801d3e:	e8 74 1d 00 00       	call   803ab7 <pageref>
+  801d43:	89 c2                	mov    %eax,%edx
+  801d45:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d48:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d4d:	83 fa 01             	cmp    $0x1,%edx
+  801d50:	74 05                	je     801d57 <devsock_close+0x24>
+}
+  801d52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d55:	c9                   	leave
+  801d56:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d57:	83 ec 0c             	sub    $0xc,%esp
+  801d5a:	ff 73 0c             	push   0xc(%ebx)
+  801d5d:	e8 b0 05 00 00       	call   802312 <nsipc_close>
+  801d62:	83 c4 10             	add    $0x10,%esp
+  801d65:	eb eb                	jmp    801d52 <devsock_close+0x1f>
+
+00801d67 <devsock_write>:
+{
+  801d67:	55                   	push   %ebp
+  801d68:	89 e5                	mov    %esp,%ebp
+  801d6a:	53                   	push   %ebx
+  801d6b:	83 ec 14             	sub    $0x14,%esp
+  801d6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d71:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d74:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801d77:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801d7a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801d7d:	8b 41 08             	mov    0x8(%ecx),%eax
+  801d80:	c1 f8 09             	sar    $0x9,%eax
+  801d83:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801d86:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801d8c:	77 13                	ja     801da1 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801d8e:	50                   	push   %eax
+  801d8f:	52                   	push   %edx
+  801d90:	53                   	push   %ebx
+  801d91:	ff 71 0c             	push   0xc(%ecx)
+  801d94:	e8 5c 06 00 00       	call   8023f5 <nsipc_send>
+  801d99:	83 c4 10             	add    $0x10,%esp
+}
+  801d9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d9f:	c9                   	leave
+  801da0:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801da1:	50                   	push   %eax
+  801da2:	6a 01                	push   $0x1
+  801da4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801da7:	50                   	push   %eax
+  801da8:	ff 71 0c             	push   0xc(%ecx)
+  801dab:	e8 a6 06 00 00       	call   802456 <nsipc_sendmsg>
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	eb e7                	jmp    801d9c <devsock_write+0x35>
+
+00801db5 <devsock_read>:
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	53                   	push   %ebx
+  801db9:	83 ec 14             	sub    $0x14,%esp
+  801dbc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801dc2:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801dc5:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801dc8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801dcb:	8b 41 08             	mov    0x8(%ecx),%eax
+  801dce:	c1 f8 09             	sar    $0x9,%eax
+  801dd1:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801dd4:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801dda:	77 13                	ja     801def <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801ddc:	50                   	push   %eax
+  801ddd:	52                   	push   %edx
+  801dde:	53                   	push   %ebx
+  801ddf:	ff 71 0c             	push   0xc(%ecx)
+  801de2:	e8 9c 05 00 00       	call   802383 <nsipc_recv>
+  801de7:	83 c4 10             	add    $0x10,%esp
+}
+  801dea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ded:	c9                   	leave
+  801dee:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801def:	50                   	push   %eax
+  801df0:	6a 01                	push   $0x1
+  801df2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801df5:	50                   	push   %eax
+  801df6:	ff 71 0c             	push   0xc(%ecx)
+  801df9:	e8 02 0a 00 00       	call   802800 <nsipc_recvmsg>
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	eb e7                	jmp    801dea <devsock_read+0x35>
+
+00801e03 <fd2sockid>:
+{
+  801e03:	55                   	push   %ebp
+  801e04:	89 e5                	mov    %esp,%ebp
+  801e06:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e09:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e0c:	52                   	push   %edx
+  801e0d:	50                   	push   %eax
+  801e0e:	e8 f7 f4 ff ff       	call   80130a <fd_lookup>
+  801e13:	83 c4 10             	add    $0x10,%esp
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	78 10                	js     801e2a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801e1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e1d:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801e23:	39 08                	cmp    %ecx,(%eax)
+  801e25:	75 05                	jne    801e2c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801e27:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801e2a:	c9                   	leave
+  801e2b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e31:	eb f7                	jmp    801e2a <fd2sockid+0x27>
+
+00801e33 <sock_flags>:
+{
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801e39:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e3c:	52                   	push   %edx
+  801e3d:	50                   	push   %eax
+  801e3e:	e8 c7 f4 ff ff       	call   80130a <fd_lookup>
+  801e43:	83 c4 10             	add    $0x10,%esp
+  801e46:	85 c0                	test   %eax,%eax
+  801e48:	78 0e                	js     801e58 <sock_flags+0x25>
+  801e4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e4d:	8b 40 08             	mov    0x8(%eax),%eax
+  801e50:	c1 e8 09             	shr    $0x9,%eax
+  801e53:	83 e0 08             	and    $0x8,%eax
+}
+  801e56:	c9                   	leave
+  801e57:	c3                   	ret
+		return 0;
+  801e58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5d:	eb f7                	jmp    801e56 <sock_flags+0x23>
+
+00801e5f <alloc_sockfd>:
+{
+  801e5f:	55                   	push   %ebp
+  801e60:	89 e5                	mov    %esp,%ebp
+  801e62:	56                   	push   %esi
+  801e63:	53                   	push   %ebx
+  801e64:	83 ec 1c             	sub    $0x1c,%esp
+  801e67:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801e69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e6c:	50                   	push   %eax
+  801e6d:	e8 48 f4 ff ff       	call   8012ba <fd_alloc>
+  801e72:	89 c3                	mov    %eax,%ebx
+  801e74:	83 c4 10             	add    $0x10,%esp
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	78 43                	js     801ebe <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801e7b:	83 ec 04             	sub    $0x4,%esp
+  801e7e:	68 07 04 00 00       	push   $0x407
+  801e83:	ff 75 f4             	push   -0xc(%ebp)
+  801e86:	6a 00                	push   $0x0
+  801e88:	e8 a3 ef ff ff       	call   800e30 <sys_page_alloc>
+  801e8d:	89 c3                	mov    %eax,%ebx
+  801e8f:	83 c4 10             	add    $0x10,%esp
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	78 28                	js     801ebe <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801e96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e99:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801e9f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ea1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801eab:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801eae:	83 ec 0c             	sub    $0xc,%esp
+  801eb1:	50                   	push   %eax
+  801eb2:	e8 dc f3 ff ff       	call   801293 <fd2num>
+  801eb7:	89 c3                	mov    %eax,%ebx
+  801eb9:	83 c4 10             	add    $0x10,%esp
+  801ebc:	eb 0c                	jmp    801eca <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+  801ec1:	56                   	push   %esi
+  801ec2:	e8 4b 04 00 00       	call   802312 <nsipc_close>
+		return r;
+  801ec7:	83 c4 10             	add    $0x10,%esp
+}
+  801eca:	89 d8                	mov    %ebx,%eax
+  801ecc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ecf:	5b                   	pop    %ebx
+  801ed0:	5e                   	pop    %esi
+  801ed1:	5d                   	pop    %ebp
+  801ed2:	c3                   	ret
+
+00801ed3 <accept>:
+{
+  801ed3:	55                   	push   %ebp
+  801ed4:	89 e5                	mov    %esp,%ebp
+  801ed6:	56                   	push   %esi
+  801ed7:	53                   	push   %ebx
+  801ed8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801edb:	89 f0                	mov    %esi,%eax
+  801edd:	e8 21 ff ff ff       	call   801e03 <fd2sockid>
+  801ee2:	89 c3                	mov    %eax,%ebx
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 24                	js     801f0c <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801ee8:	89 f0                	mov    %esi,%eax
+  801eea:	e8 44 ff ff ff       	call   801e33 <sock_flags>
+  801eef:	50                   	push   %eax
+  801ef0:	ff 75 10             	push   0x10(%ebp)
+  801ef3:	ff 75 0c             	push   0xc(%ebp)
+  801ef6:	53                   	push   %ebx
+  801ef7:	e8 6b 03 00 00       	call   802267 <nsipc_accept>
+  801efc:	89 c3                	mov    %eax,%ebx
+  801efe:	83 c4 10             	add    $0x10,%esp
+  801f01:	85 c0                	test   %eax,%eax
+  801f03:	78 07                	js     801f0c <accept+0x39>
+	return alloc_sockfd(r);
+  801f05:	e8 55 ff ff ff       	call   801e5f <alloc_sockfd>
+  801f0a:	89 c3                	mov    %eax,%ebx
+}
+  801f0c:	89 d8                	mov    %ebx,%eax
+  801f0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f11:	5b                   	pop    %ebx
+  801f12:	5e                   	pop    %esi
+  801f13:	5d                   	pop    %ebp
+  801f14:	c3                   	ret
+
+00801f15 <bind>:
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1e:	e8 e0 fe ff ff       	call   801e03 <fd2sockid>
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	78 12                	js     801f39 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f27:	83 ec 04             	sub    $0x4,%esp
+  801f2a:	ff 75 10             	push   0x10(%ebp)
+  801f2d:	ff 75 0c             	push   0xc(%ebp)
+  801f30:	50                   	push   %eax
+  801f31:	e8 85 03 00 00       	call   8022bb <nsipc_bind>
+  801f36:	83 c4 10             	add    $0x10,%esp
+}
+  801f39:	c9                   	leave
+  801f3a:	c3                   	ret
+
+00801f3b <shutdown>:
+{
+  801f3b:	55                   	push   %ebp
+  801f3c:	89 e5                	mov    %esp,%ebp
+  801f3e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f44:	e8 ba fe ff ff       	call   801e03 <fd2sockid>
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	78 0f                	js     801f5c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f4d:	83 ec 08             	sub    $0x8,%esp
+  801f50:	ff 75 0c             	push   0xc(%ebp)
+  801f53:	50                   	push   %eax
+  801f54:	e8 97 03 00 00       	call   8022f0 <nsipc_shutdown>
+  801f59:	83 c4 10             	add    $0x10,%esp
+}
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+00801f5e <connect>:
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f67:	e8 97 fe ff ff       	call   801e03 <fd2sockid>
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	78 12                	js     801f82 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801f70:	83 ec 04             	sub    $0x4,%esp
+  801f73:	ff 75 10             	push   0x10(%ebp)
+  801f76:	ff 75 0c             	push   0xc(%ebp)
+  801f79:	50                   	push   %eax
+  801f7a:	e8 ad 03 00 00       	call   80232c <nsipc_connect>
+  801f7f:	83 c4 10             	add    $0x10,%esp
+}
+  801f82:	c9                   	leave
+  801f83:	c3                   	ret
+
+00801f84 <listen>:
+{
+  801f84:	55                   	push   %ebp
+  801f85:	89 e5                	mov    %esp,%ebp
+  801f87:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8d:	e8 71 fe ff ff       	call   801e03 <fd2sockid>
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	78 0f                	js     801fa5 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801f96:	83 ec 08             	sub    $0x8,%esp
+  801f99:	ff 75 0c             	push   0xc(%ebp)
+  801f9c:	50                   	push   %eax
+  801f9d:	e8 bf 03 00 00       	call   802361 <nsipc_listen>
+  801fa2:	83 c4 10             	add    $0x10,%esp
+}
+  801fa5:	c9                   	leave
+  801fa6:	c3                   	ret
+
+00801fa7 <sendmsg>:
+{
+  801fa7:	55                   	push   %ebp
+  801fa8:	89 e5                	mov    %esp,%ebp
+  801faa:	57                   	push   %edi
+  801fab:	56                   	push   %esi
+  801fac:	53                   	push   %ebx
+  801fad:	83 ec 0c             	sub    $0xc,%esp
+  801fb0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801fb6:	89 f0                	mov    %esi,%eax
+  801fb8:	e8 46 fe ff ff       	call   801e03 <fd2sockid>
+  801fbd:	89 c3                	mov    %eax,%ebx
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	78 1c                	js     801fdf <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801fc3:	89 f0                	mov    %esi,%eax
+  801fc5:	e8 69 fe ff ff       	call   801e33 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801fca:	0b 45 10             	or     0x10(%ebp),%eax
+  801fcd:	50                   	push   %eax
+  801fce:	ff 77 0c             	push   0xc(%edi)
+  801fd1:	ff 77 08             	push   0x8(%edi)
+  801fd4:	53                   	push   %ebx
+  801fd5:	e8 7c 04 00 00       	call   802456 <nsipc_sendmsg>
+  801fda:	89 c3                	mov    %eax,%ebx
+  801fdc:	83 c4 10             	add    $0x10,%esp
+}
+  801fdf:	89 d8                	mov    %ebx,%eax
+  801fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe4:	5b                   	pop    %ebx
+  801fe5:	5e                   	pop    %esi
+  801fe6:	5f                   	pop    %edi
+  801fe7:	5d                   	pop    %ebp
+  801fe8:	c3                   	ret
+
+00801fe9 <recvmsg>:
+{
+  801fe9:	55                   	push   %ebp
+  801fea:	89 e5                	mov    %esp,%ebp
+  801fec:	57                   	push   %edi
+  801fed:	56                   	push   %esi
+  801fee:	53                   	push   %ebx
+  801fef:	83 ec 0c             	sub    $0xc,%esp
+  801ff2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ff5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801ff8:	89 f8                	mov    %edi,%eax
+  801ffa:	e8 04 fe ff ff       	call   801e03 <fd2sockid>
+  801fff:	89 c3                	mov    %eax,%ebx
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 2a                	js     80202f <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802005:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80200c:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802013:	89 f8                	mov    %edi,%eax
+  802015:	e8 19 fe ff ff       	call   801e33 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80201a:	0b 45 10             	or     0x10(%ebp),%eax
+  80201d:	50                   	push   %eax
+  80201e:	ff 76 0c             	push   0xc(%esi)
+  802021:	ff 76 08             	push   0x8(%esi)
+  802024:	53                   	push   %ebx
+  802025:	e8 d6 07 00 00       	call   802800 <nsipc_recvmsg>
+  80202a:	89 c3                	mov    %eax,%ebx
+  80202c:	83 c4 10             	add    $0x10,%esp
+}
+  80202f:	89 d8                	mov    %ebx,%eax
+  802031:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802034:	5b                   	pop    %ebx
+  802035:	5e                   	pop    %esi
+  802036:	5f                   	pop    %edi
+  802037:	5d                   	pop    %ebp
+  802038:	c3                   	ret
+
+00802039 <sendfile>:
+{
+  802039:	55                   	push   %ebp
+  80203a:	89 e5                	mov    %esp,%ebp
+  80203c:	56                   	push   %esi
+  80203d:	53                   	push   %ebx
+  80203e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802041:	89 f0                	mov    %esi,%eax
+  802043:	e8 bb fd ff ff       	call   801e03 <fd2sockid>
+  802048:	89 c3                	mov    %eax,%ebx
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	78 1f                	js     80206d <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80204e:	89 f0                	mov    %esi,%eax
+  802050:	e8 de fd ff ff       	call   801e33 <sock_flags>
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	50                   	push   %eax
+  802059:	ff 75 14             	push   0x14(%ebp)
+  80205c:	ff 75 10             	push   0x10(%ebp)
+  80205f:	ff 75 0c             	push   0xc(%ebp)
+  802062:	53                   	push   %ebx
+  802063:	e8 64 06 00 00       	call   8026cc <nsipc_sendfile>
+  802068:	89 c3                	mov    %eax,%ebx
+  80206a:	83 c4 20             	add    $0x20,%esp
+}
+  80206d:	89 d8                	mov    %ebx,%eax
+  80206f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802072:	5b                   	pop    %ebx
+  802073:	5e                   	pop    %esi
+  802074:	5d                   	pop    %ebp
+  802075:	c3                   	ret
+
+00802076 <evctl>:
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 04             	sub    $0x4,%esp
+  80207d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802080:	89 d8                	mov    %ebx,%eax
+  802082:	e8 7c fd ff ff       	call   801e03 <fd2sockid>
+  802087:	85 c0                	test   %eax,%eax
+  802089:	78 10                	js     80209b <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80208b:	83 ec 04             	sub    $0x4,%esp
+  80208e:	53                   	push   %ebx
+  80208f:	ff 75 0c             	push   0xc(%ebp)
+  802092:	50                   	push   %eax
+  802093:	e8 d2 0b 00 00       	call   802c6a <nsipc_evctl>
+  802098:	83 c4 10             	add    $0x10,%esp
+}
+  80209b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209e:	c9                   	leave
+  80209f:	c3                   	ret
+
+008020a0 <evwait>:
+{
+  8020a0:	55                   	push   %ebp
+  8020a1:	89 e5                	mov    %esp,%ebp
+  8020a3:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8020a6:	ff 75 10             	push   0x10(%ebp)
+  8020a9:	ff 75 0c             	push   0xc(%ebp)
+  8020ac:	ff 75 08             	push   0x8(%ebp)
+  8020af:	e8 e0 0b 00 00       	call   802c94 <nsipc_evwait>
+}
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+
+008020b6 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8020bc:	ff 75 10             	push   0x10(%ebp)
+  8020bf:	ff 75 0c             	push   0xc(%ebp)
+  8020c2:	ff 75 08             	push   0x8(%ebp)
+  8020c5:	e8 31 0c 00 00       	call   802cfb <nsipc_socket>
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	78 05                	js     8020d6 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8020d1:	e8 89 fd ff ff       	call   801e5f <alloc_sockfd>
+}
+  8020d6:	c9                   	leave
+  8020d7:	c3                   	ret
+
+008020d8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	53                   	push   %ebx
+  8020dc:	83 ec 04             	sub    $0x4,%esp
+  8020df:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8020e1:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8020e8:	74 26                	je     802110 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8020ea:	6a 07                	push   $0x7
+  8020ec:	68 00 80 80 00       	push   $0x808000
+  8020f1:	53                   	push   %ebx
+  8020f2:	ff 35 24 63 80 00    	push   0x806324
+  8020f8:	e8 12 19 00 00       	call   803a0f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8020fd:	83 c4 0c             	add    $0xc,%esp
+  802100:	6a 00                	push   $0x0
+  802102:	6a 00                	push   $0x0
+  802104:	6a 00                	push   $0x0
+  802106:	e8 74 16 00 00       	call   80377f <ipc_recv>
+}
+  80210b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210e:	c9                   	leave
+  80210f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802110:	83 ec 0c             	sub    $0xc,%esp
+  802113:	6a 03                	push   $0x3
+  802115:	e8 5e 19 00 00       	call   803a78 <ipc_find_env>
+  80211a:	a3 24 63 80 00       	mov    %eax,0x806324
+  80211f:	83 c4 10             	add    $0x10,%esp
+  802122:	eb c6                	jmp    8020ea <nsipc+0x12>
+
+00802124 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802124:	55                   	push   %ebp
+  802125:	89 e5                	mov    %esp,%ebp
+  802127:	56                   	push   %esi
+  802128:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802129:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  80212f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802134:	85 f6                	test   %esi,%esi
+  802136:	75 33                	jne    80216b <nsbulk_map+0x47>
+  802138:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80213d:	83 ec 04             	sub    $0x4,%esp
+  802140:	6a 07                	push   $0x7
+  802142:	53                   	push   %ebx
+  802143:	6a 00                	push   $0x0
+  802145:	e8 e6 ec ff ff       	call   800e30 <sys_page_alloc>
+  80214a:	83 c4 10             	add    $0x10,%esp
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	78 1a                	js     80216b <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802151:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802157:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80215d:	75 de                	jne    80213d <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  80215f:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  802166:	00 00 00 
+	return 0;
+  802169:	89 f0                	mov    %esi,%eax
+}
+  80216b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80216e:	5b                   	pop    %ebx
+  80216f:	5e                   	pop    %esi
+  802170:	5d                   	pop    %ebp
+  802171:	c3                   	ret
+
+00802172 <nsbulk_own>:
+{
+  802172:	55                   	push   %ebp
+  802173:	89 e5                	mov    %esp,%ebp
+  802175:	57                   	push   %edi
+  802176:	56                   	push   %esi
+  802177:	53                   	push   %ebx
+  802178:	83 ec 0c             	sub    $0xc,%esp
+  80217b:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80217d:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802180:	85 d2                	test   %edx,%edx
+  802182:	7f 0e                	jg     802192 <nsbulk_own+0x20>
+	return 0;
+  802184:	b8 00 00 00 00       	mov    $0x0,%eax
+  802189:	eb 47                	jmp    8021d2 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80218b:	83 c3 01             	add    $0x1,%ebx
+  80218e:	39 fb                	cmp    %edi,%ebx
+  802190:	7d 3b                	jge    8021cd <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802192:	be 01 00 00 00       	mov    $0x1,%esi
+  802197:	89 d9                	mov    %ebx,%ecx
+  802199:	d3 e6                	shl    %cl,%esi
+  80219b:	89 f0                	mov    %esi,%eax
+  80219d:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  8021a3:	74 e6                	je     80218b <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8021a5:	83 ec 04             	sub    $0x4,%esp
+  8021a8:	6a 07                	push   $0x7
+  8021aa:	89 d8                	mov    %ebx,%eax
+  8021ac:	c1 e0 0c             	shl    $0xc,%eax
+  8021af:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8021b4:	50                   	push   %eax
+  8021b5:	6a 00                	push   $0x0
+  8021b7:	e8 74 ec ff ff       	call   800e30 <sys_page_alloc>
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	78 0f                	js     8021d2 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8021c3:	f7 d6                	not    %esi
+  8021c5:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  8021cb:	eb be                	jmp    80218b <nsbulk_own+0x19>
+	return 0;
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d5:	5b                   	pop    %ebx
+  8021d6:	5e                   	pop    %esi
+  8021d7:	5f                   	pop    %edi
+  8021d8:	5d                   	pop    %ebp
+  8021d9:	c3                   	ret
+
+008021da <nsipc_bulk>:
+{
+  8021da:	55                   	push   %ebp
+  8021db:	89 e5                	mov    %esp,%ebp
+  8021dd:	57                   	push   %edi
+  8021de:	56                   	push   %esi
+  8021df:	53                   	push   %ebx
+  8021e0:	83 ec 1c             	sub    $0x1c,%esp
+  8021e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021e6:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8021e8:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8021ee:	c1 fb 0c             	sar    $0xc,%ebx
+  8021f1:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8021f4:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8021fb:	74 56                	je     802253 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8021fd:	85 ff                	test   %edi,%edi
+  8021ff:	7e 24                	jle    802225 <nsipc_bulk+0x4b>
+  802201:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802207:	74 1c                	je     802225 <nsipc_bulk+0x4b>
+  802209:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80220f:	c1 e3 0c             	shl    $0xc,%ebx
+  802212:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802217:	0f b6 10             	movzbl (%eax),%edx
+  80221a:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80221c:	05 00 10 00 00       	add    $0x1000,%eax
+  802221:	39 d8                	cmp    %ebx,%eax
+  802223:	75 f2                	jne    802217 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802225:	83 ec 0c             	sub    $0xc,%esp
+  802228:	56                   	push   %esi
+  802229:	57                   	push   %edi
+  80222a:	68 00 00 00 e0       	push   $0xe0000000
+  80222f:	ff 75 e4             	push   -0x1c(%ebp)
+  802232:	ff 35 24 63 80 00    	push   0x806324
+  802238:	e8 06 18 00 00       	call   803a43 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80223d:	83 c4 1c             	add    $0x1c,%esp
+  802240:	6a 00                	push   $0x0
+  802242:	6a 00                	push   $0x0
+  802244:	6a 00                	push   $0x0
+  802246:	e8 34 15 00 00       	call   80377f <ipc_recv>
+}
+  80224b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80224e:	5b                   	pop    %ebx
+  80224f:	5e                   	pop    %esi
+  802250:	5f                   	pop    %edi
+  802251:	5d                   	pop    %ebp
+  802252:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802253:	83 ec 0c             	sub    $0xc,%esp
+  802256:	6a 03                	push   $0x3
+  802258:	e8 1b 18 00 00       	call   803a78 <ipc_find_env>
+  80225d:	a3 24 63 80 00       	mov    %eax,0x806324
+  802262:	83 c4 10             	add    $0x10,%esp
+  802265:	eb 96                	jmp    8021fd <nsipc_bulk+0x23>
+
+00802267 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802267:	55                   	push   %ebp
+  802268:	89 e5                	mov    %esp,%ebp
+  80226a:	53                   	push   %ebx
+  80226b:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80226e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802271:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802276:	8b 45 14             	mov    0x14(%ebp),%eax
+  802279:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80227e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802283:	e8 50 fe ff ff       	call   8020d8 <nsipc>
+  802288:	89 c3                	mov    %eax,%ebx
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	79 07                	jns    802295 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80228e:	89 d8                	mov    %ebx,%eax
+  802290:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802293:	c9                   	leave
+  802294:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802295:	83 ec 04             	sub    $0x4,%esp
+  802298:	ff 35 10 80 80 00    	push   0x808010
+  80229e:	68 00 80 80 00       	push   $0x808000
+  8022a3:	ff 75 0c             	push   0xc(%ebp)
+  8022a6:	e8 01 e9 ff ff       	call   800bac <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022ab:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8022b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022b4:	89 10                	mov    %edx,(%eax)
+  8022b6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022b9:	eb d3                	jmp    80228e <nsipc_accept+0x27>
+
+008022bb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	53                   	push   %ebx
+  8022bf:	83 ec 08             	sub    $0x8,%esp
+  8022c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c8:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022cd:	53                   	push   %ebx
+  8022ce:	ff 75 0c             	push   0xc(%ebp)
+  8022d1:	68 04 80 80 00       	push   $0x808004
+  8022d6:	e8 d1 e8 ff ff       	call   800bac <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022db:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8022e1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022e6:	e8 ed fd ff ff       	call   8020d8 <nsipc>
+}
+  8022eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ee:	c9                   	leave
+  8022ef:	c3                   	ret
+
+008022f0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022f0:	55                   	push   %ebp
+  8022f1:	89 e5                	mov    %esp,%ebp
+  8022f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8022fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802301:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802306:	b8 03 00 00 00       	mov    $0x3,%eax
+  80230b:	e8 c8 fd ff ff       	call   8020d8 <nsipc>
+}
+  802310:	c9                   	leave
+  802311:	c3                   	ret
+
+00802312 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802312:	55                   	push   %ebp
+  802313:	89 e5                	mov    %esp,%ebp
+  802315:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802318:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802320:	b8 04 00 00 00       	mov    $0x4,%eax
+  802325:	e8 ae fd ff ff       	call   8020d8 <nsipc>
+}
+  80232a:	c9                   	leave
+  80232b:	c3                   	ret
+
+0080232c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80232c:	55                   	push   %ebp
+  80232d:	89 e5                	mov    %esp,%ebp
+  80232f:	53                   	push   %ebx
+  802330:	83 ec 08             	sub    $0x8,%esp
+  802333:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802336:	8b 45 08             	mov    0x8(%ebp),%eax
+  802339:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80233e:	53                   	push   %ebx
+  80233f:	ff 75 0c             	push   0xc(%ebp)
+  802342:	68 04 80 80 00       	push   $0x808004
+  802347:	e8 60 e8 ff ff       	call   800bac <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80234c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802352:	b8 05 00 00 00       	mov    $0x5,%eax
+  802357:	e8 7c fd ff ff       	call   8020d8 <nsipc>
+}
+  80235c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80235f:	c9                   	leave
+  802360:	c3                   	ret
+
+00802361 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802361:	55                   	push   %ebp
+  802362:	89 e5                	mov    %esp,%ebp
+  802364:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802367:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80236f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802372:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802377:	b8 06 00 00 00       	mov    $0x6,%eax
+  80237c:	e8 57 fd ff ff       	call   8020d8 <nsipc>
+}
+  802381:	c9                   	leave
+  802382:	c3                   	ret
+
+00802383 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802383:	55                   	push   %ebp
+  802384:	89 e5                	mov    %esp,%ebp
+  802386:	56                   	push   %esi
+  802387:	53                   	push   %ebx
+  802388:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80238b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802393:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802399:	8b 45 14             	mov    0x14(%ebp),%eax
+  80239c:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023a1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023a6:	e8 2d fd ff ff       	call   8020d8 <nsipc>
+  8023ab:	89 c3                	mov    %eax,%ebx
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	78 22                	js     8023d3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023b1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023b6:	39 c6                	cmp    %eax,%esi
+  8023b8:	0f 4e c6             	cmovle %esi,%eax
+  8023bb:	39 c3                	cmp    %eax,%ebx
+  8023bd:	7f 1d                	jg     8023dc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023bf:	83 ec 04             	sub    $0x4,%esp
+  8023c2:	53                   	push   %ebx
+  8023c3:	68 00 80 80 00       	push   $0x808000
+  8023c8:	ff 75 0c             	push   0xc(%ebp)
+  8023cb:	e8 dc e7 ff ff       	call   800bac <memmove>
+  8023d0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023d3:	89 d8                	mov    %ebx,%eax
+  8023d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d8:	5b                   	pop    %ebx
+  8023d9:	5e                   	pop    %esi
+  8023da:	5d                   	pop    %ebp
+  8023db:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023dc:	68 74 41 80 00       	push   $0x804174
+  8023e1:	68 89 41 80 00       	push   $0x804189
+  8023e6:	68 b2 00 00 00       	push   $0xb2
+  8023eb:	68 9e 41 80 00       	push   $0x80419e
+  8023f0:	e8 35 de ff ff       	call   80022a <_panic>
+
+008023f5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023f5:	55                   	push   %ebp
+  8023f6:	89 e5                	mov    %esp,%ebp
+  8023f8:	53                   	push   %ebx
+  8023f9:	83 ec 04             	sub    $0x4,%esp
+  8023fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802402:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802407:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80240d:	7f 2e                	jg     80243d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80240f:	83 ec 04             	sub    $0x4,%esp
+  802412:	53                   	push   %ebx
+  802413:	ff 75 0c             	push   0xc(%ebp)
+  802416:	68 0c 80 80 00       	push   $0x80800c
+  80241b:	e8 8c e7 ff ff       	call   800bac <memmove>
+	nsipcbuf.send.req_size = size;
+  802420:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802426:	8b 45 14             	mov    0x14(%ebp),%eax
+  802429:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80242e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802433:	e8 a0 fc ff ff       	call   8020d8 <nsipc>
+}
+  802438:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80243b:	c9                   	leave
+  80243c:	c3                   	ret
+	assert(size < 1600);
+  80243d:	68 aa 41 80 00       	push   $0x8041aa
+  802442:	68 89 41 80 00       	push   $0x804189
+  802447:	68 bd 00 00 00       	push   $0xbd
+  80244c:	68 9e 41 80 00       	push   $0x80419e
+  802451:	e8 d4 dd ff ff       	call   80022a <_panic>
+
+00802456 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802456:	55                   	push   %ebp
+  802457:	89 e5                	mov    %esp,%ebp
+  802459:	57                   	push   %edi
+  80245a:	56                   	push   %esi
+  80245b:	53                   	push   %ebx
+  80245c:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  80245f:	e8 c0 fc ff ff       	call   802124 <nsbulk_map>
+  802464:	85 c0                	test   %eax,%eax
+  802466:	78 55                	js     8024bd <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802468:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  80246f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802476:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80247d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802480:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802483:	0f 8d 24 02 00 00    	jge    8026ad <nsipc_sendmsg+0x257>
+  802489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80248c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80248f:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802492:	89 d8                	mov    %ebx,%eax
+  802494:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802499:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80249b:	83 ec 0c             	sub    $0xc,%esp
+  80249e:	68 20 60 80 00       	push   $0x806020
+  8024a3:	e8 5a 0f 00 00       	call   803402 <pgbatch_init>
+  8024a8:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024ab:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8024ad:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8024b0:	e9 82 00 00 00       	jmp    802537 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8024b5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024b8:	85 db                	test   %ebx,%ebx
+  8024ba:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8024bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c0:	5b                   	pop    %ebx
+  8024c1:	5e                   	pop    %esi
+  8024c2:	5f                   	pop    %edi
+  8024c3:	5d                   	pop    %ebp
+  8024c4:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8024c5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024ca:	29 c8                	sub    %ecx,%eax
+  8024cc:	39 d0                	cmp    %edx,%eax
+  8024ce:	0f 46 d0             	cmovbe %eax,%edx
+  8024d1:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8024d3:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8024d9:	85 ff                	test   %edi,%edi
+  8024db:	0f 49 c7             	cmovns %edi,%eax
+  8024de:	c1 f8 0c             	sar    $0xc,%eax
+  8024e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8024e6:	e8 87 fc ff ff       	call   802172 <nsbulk_own>
+  8024eb:	85 c0                	test   %eax,%eax
+  8024ed:	0f 88 17 01 00 00    	js     80260a <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8024f3:	83 ec 04             	sub    $0x4,%esp
+  8024f6:	56                   	push   %esi
+  8024f7:	ff 75 e0             	push   -0x20(%ebp)
+  8024fa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8024fd:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802502:	50                   	push   %eax
+  802503:	e8 a4 e6 ff ff       	call   800bac <memmove>
+  802508:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80250b:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80250e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802511:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802514:	0f 84 fd 00 00 00    	je     802617 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80251a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80251d:	01 f7                	add    %esi,%edi
+  80251f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802522:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802525:	0f 8d 01 01 00 00    	jge    80262c <nsipc_sendmsg+0x1d6>
+  80252b:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802531:	0f 8f f0 00 00 00    	jg     802627 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802537:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80253a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80253d:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802540:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802543:	89 c2                	mov    %eax,%edx
+  802545:	03 13                	add    (%ebx),%edx
+  802547:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80254a:	8b 73 04             	mov    0x4(%ebx),%esi
+  80254d:	29 c6                	sub    %eax,%esi
+  80254f:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802554:	29 f9                	sub    %edi,%ecx
+  802556:	39 ce                	cmp    %ecx,%esi
+  802558:	89 ca                	mov    %ecx,%edx
+  80255a:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  80255d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802560:	89 f9                	mov    %edi,%ecx
+  802562:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802568:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80256b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802570:	09 c8                	or     %ecx,%eax
+  802572:	0f 85 4d ff ff ff    	jne    8024c5 <nsipc_sendmsg+0x6f>
+  802578:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80257e:	0f 86 41 ff ff ff    	jbe    8024c5 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802584:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80258a:	85 ff                	test   %edi,%edi
+  80258c:	0f 49 c7             	cmovns %edi,%eax
+  80258f:	c1 f8 0c             	sar    $0xc,%eax
+  802592:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802594:	89 d1                	mov    %edx,%ecx
+  802596:	c1 e9 0c             	shr    $0xc,%ecx
+  802599:	01 c8                	add    %ecx,%eax
+  80259b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80259e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025a1:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8025a3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025a6:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8025ab:	29 c8                	sub    %ecx,%eax
+  8025ad:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8025b0:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8025b3:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025ba:	89 f9                	mov    %edi,%ecx
+  8025bc:	d3 e0                	shl    %cl,%eax
+  8025be:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8025c4:	83 ec 08             	sub    $0x8,%esp
+  8025c7:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8025c9:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8025cc:	50                   	push   %eax
+  8025cd:	6a 00                	push   $0x0
+  8025cf:	56                   	push   %esi
+  8025d0:	6a 00                	push   $0x0
+  8025d2:	68 20 60 80 00       	push   $0x806020
+  8025d7:	e8 e4 0e 00 00       	call   8034c0 <pgbatch_map>
+  8025dc:	83 c4 20             	add    $0x20,%esp
+  8025df:	85 c0                	test   %eax,%eax
+  8025e1:	0f 88 ce fe ff ff    	js     8024b5 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8025e7:	83 c7 01             	add    $0x1,%edi
+  8025ea:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025f0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8025f3:	39 c7                	cmp    %eax,%edi
+  8025f5:	75 be                	jne    8025b5 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8025f7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8025fa:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8025fd:	89 d6                	mov    %edx,%esi
+  8025ff:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802605:	e9 01 ff ff ff       	jmp    80250b <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80260a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80260d:	85 db                	test   %ebx,%ebx
+  80260f:	0f 45 c3             	cmovne %ebx,%eax
+  802612:	e9 a6 fe ff ff       	jmp    8024bd <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802617:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80261b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802622:	e9 f3 fe ff ff       	jmp    80251a <nsipc_sendmsg+0xc4>
+  802627:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80262a:	eb 03                	jmp    80262f <nsipc_sendmsg+0x1d9>
+  80262c:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80262f:	83 ec 0c             	sub    $0xc,%esp
+  802632:	68 20 60 80 00       	push   $0x806020
+  802637:	e8 d4 0d 00 00       	call   803410 <pgbatch_flush>
+  80263c:	83 c4 10             	add    $0x10,%esp
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	78 50                	js     802693 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802643:	8b 45 08             	mov    0x8(%ebp),%eax
+  802646:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80264b:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802651:	89 fb                	mov    %edi,%ebx
+  802653:	29 f3                	sub    %esi,%ebx
+  802655:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80265b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80265e:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802663:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802668:	89 fa                	mov    %edi,%edx
+  80266a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80266f:	e8 66 fb ff ff       	call   8021da <nsipc_bulk>
+  802674:	85 c0                	test   %eax,%eax
+  802676:	78 28                	js     8026a0 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802678:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80267b:	39 c3                	cmp    %eax,%ebx
+  80267d:	75 0c                	jne    80268b <nsipc_sendmsg+0x235>
+  80267f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802682:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802685:	0f 8f f2 fd ff ff    	jg     80247d <nsipc_sendmsg+0x27>
+		sent += r;
+  80268b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80268e:	e9 2a fe ff ff       	jmp    8024bd <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802693:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802696:	85 db                	test   %ebx,%ebx
+  802698:	0f 45 c3             	cmovne %ebx,%eax
+  80269b:	e9 1d fe ff ff       	jmp    8024bd <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8026a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026a3:	85 db                	test   %ebx,%ebx
+  8026a5:	0f 45 c3             	cmovne %ebx,%eax
+  8026a8:	e9 10 fe ff ff       	jmp    8024bd <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8026ad:	83 ec 0c             	sub    $0xc,%esp
+  8026b0:	68 20 60 80 00       	push   $0x806020
+  8026b5:	e8 48 0d 00 00       	call   803402 <pgbatch_init>
+  8026ba:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8026bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c7:	e9 63 ff ff ff       	jmp    80262f <nsipc_sendmsg+0x1d9>
+
+008026cc <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8026cc:	55                   	push   %ebp
+  8026cd:	89 e5                	mov    %esp,%ebp
+  8026cf:	57                   	push   %edi
+  8026d0:	56                   	push   %esi
+  8026d1:	53                   	push   %ebx
+  8026d2:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8026d5:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  8026dc:	0f 84 c8 00 00 00    	je     8027aa <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8026e2:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  8026e9:	0f 84 e4 00 00 00    	je     8027d3 <nsipc_sendfile+0x107>
+{
+  8026ef:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8026f4:	89 fb                	mov    %edi,%ebx
+  8026f6:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8026f9:	0f 83 f0 00 00 00    	jae    8027ef <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8026ff:	89 fa                	mov    %edi,%edx
+  802701:	03 55 10             	add    0x10(%ebp),%edx
+  802704:	89 d0                	mov    %edx,%eax
+  802706:	c1 f8 1f             	sar    $0x1f,%eax
+  802709:	c1 e8 14             	shr    $0x14,%eax
+  80270c:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80270f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802715:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802717:	6a 10                	push   $0x10
+  802719:	68 00 20 01 e0       	push   $0xe0012000
+  80271e:	52                   	push   %edx
+  80271f:	ff 75 0c             	push   0xc(%ebp)
+  802722:	e8 ea f3 ff ff       	call   801b11 <fmap>
+  802727:	83 c4 10             	add    $0x10,%esp
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	0f 8e b8 00 00 00    	jle    8027ea <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802732:	39 c6                	cmp    %eax,%esi
+  802734:	0f 8d b5 00 00 00    	jge    8027ef <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80273a:	29 f0                	sub    %esi,%eax
+  80273c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80273f:	29 da                	sub    %ebx,%edx
+  802741:	39 d0                	cmp    %edx,%eax
+  802743:	89 d3                	mov    %edx,%ebx
+  802745:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802748:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274b:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802750:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802756:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  80275c:	8b 45 18             	mov    0x18(%ebp),%eax
+  80275f:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802764:	83 ec 0c             	sub    $0xc,%esp
+  802767:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802769:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802770:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802773:	83 c0 01             	add    $0x1,%eax
+  802776:	50                   	push   %eax
+  802777:	68 00 10 01 e0       	push   $0xe0011000
+  80277c:	6a 11                	push   $0x11
+  80277e:	ff 35 24 63 80 00    	push   0x806324
+  802784:	e8 ba 12 00 00       	call   803a43 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802789:	83 c4 1c             	add    $0x1c,%esp
+  80278c:	6a 00                	push   $0x0
+  80278e:	6a 00                	push   $0x0
+  802790:	6a 00                	push   $0x0
+  802792:	e8 e8 0f 00 00       	call   80377f <ipc_recv>
+  802797:	83 c4 10             	add    $0x10,%esp
+  80279a:	85 c0                	test   %eax,%eax
+  80279c:	78 5b                	js     8027f9 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  80279e:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8027a0:	39 c3                	cmp    %eax,%ebx
+  8027a2:	0f 8e 4c ff ff ff    	jle    8026f4 <nsipc_sendfile+0x28>
+  8027a8:	eb 45                	jmp    8027ef <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8027aa:	83 ec 04             	sub    $0x4,%esp
+  8027ad:	6a 07                	push   $0x7
+  8027af:	68 00 10 01 e0       	push   $0xe0011000
+  8027b4:	6a 00                	push   $0x0
+  8027b6:	e8 75 e6 ff ff       	call   800e30 <sys_page_alloc>
+  8027bb:	89 c7                	mov    %eax,%edi
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	78 2b                	js     8027ef <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8027c4:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  8027cb:	00 00 00 
+  8027ce:	e9 0f ff ff ff       	jmp    8026e2 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8027d3:	83 ec 0c             	sub    $0xc,%esp
+  8027d6:	6a 03                	push   $0x3
+  8027d8:	e8 9b 12 00 00       	call   803a78 <ipc_find_env>
+  8027dd:	a3 24 63 80 00       	mov    %eax,0x806324
+  8027e2:	83 c4 10             	add    $0x10,%esp
+  8027e5:	e9 05 ff ff ff       	jmp    8026ef <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8027ea:	85 ff                	test   %edi,%edi
+  8027ec:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8027ef:	89 f8                	mov    %edi,%eax
+  8027f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f4:	5b                   	pop    %ebx
+  8027f5:	5e                   	pop    %esi
+  8027f6:	5f                   	pop    %edi
+  8027f7:	5d                   	pop    %ebp
+  8027f8:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8027f9:	85 ff                	test   %edi,%edi
+  8027fb:	0f 44 f8             	cmove  %eax,%edi
+  8027fe:	eb ef                	jmp    8027ef <nsipc_sendfile+0x123>
+
+00802800 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802800:	55                   	push   %ebp
+  802801:	89 e5                	mov    %esp,%ebp
+  802803:	57                   	push   %edi
+  802804:	56                   	push   %esi
+  802805:	53                   	push   %ebx
+  802806:	83 ec 1c             	sub    $0x1c,%esp
+  802809:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80280c:	e8 13 f9 ff ff       	call   802124 <nsbulk_map>
+  802811:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802814:	85 c0                	test   %eax,%eax
+  802816:	0f 88 ba 00 00 00    	js     8028d6 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80281c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802820:	0f 8e bb 00 00 00    	jle    8028e1 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802826:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80282b:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802830:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802835:	89 f8                	mov    %edi,%eax
+  802837:	29 f0                	sub    %esi,%eax
+  802839:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80283d:	39 c8                	cmp    %ecx,%eax
+  80283f:	0f 47 c1             	cmova  %ecx,%eax
+  802842:	01 f0                	add    %esi,%eax
+  802844:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802846:	83 c2 01             	add    $0x1,%edx
+  802849:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80284c:	7e 07                	jle    802855 <nsipc_recvmsg+0x55>
+  80284e:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802853:	7e e0                	jle    802835 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802855:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80285b:	c1 fa 0c             	sar    $0xc,%edx
+  80285e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802863:	e8 0a f9 ff ff       	call   802172 <nsbulk_own>
+  802868:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80286b:	85 c0                	test   %eax,%eax
+  80286d:	78 67                	js     8028d6 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80286f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802872:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802877:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80287d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802880:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802885:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80288a:	89 f2                	mov    %esi,%edx
+  80288c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802891:	e8 44 f9 ff ff       	call   8021da <nsipc_bulk>
+  802896:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802899:	85 c0                	test   %eax,%eax
+  80289b:	78 39                	js     8028d6 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  80289d:	39 f0                	cmp    %esi,%eax
+  80289f:	7f 4a                	jg     8028eb <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8028a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028a6:	85 c0                	test   %eax,%eax
+  8028a8:	7e 2c                	jle    8028d6 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8028aa:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8028ad:	29 fe                	sub    %edi,%esi
+  8028af:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028b2:	39 c6                	cmp    %eax,%esi
+  8028b4:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8028b7:	83 ec 04             	sub    $0x4,%esp
+  8028ba:	56                   	push   %esi
+  8028bb:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8028c1:	50                   	push   %eax
+  8028c2:	ff 33                	push   (%ebx)
+  8028c4:	e8 e3 e2 ff ff       	call   800bac <memmove>
+		n += m;
+  8028c9:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8028cb:	83 c3 08             	add    $0x8,%ebx
+  8028ce:	83 c4 10             	add    $0x10,%esp
+  8028d1:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8028d4:	7f d4                	jg     8028aa <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8028d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028dc:	5b                   	pop    %ebx
+  8028dd:	5e                   	pop    %esi
+  8028de:	5f                   	pop    %edi
+  8028df:	5d                   	pop    %ebp
+  8028e0:	c3                   	ret
+	int r, i, n, len = 0;
+  8028e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e6:	e9 6a ff ff ff       	jmp    802855 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8028eb:	68 80 41 80 00       	push   $0x804180
+  8028f0:	68 89 41 80 00       	push   $0x804189
+  8028f5:	68 3b 01 00 00       	push   $0x13b
+  8028fa:	68 9e 41 80 00       	push   $0x80419e
+  8028ff:	e8 26 d9 ff ff       	call   80022a <_panic>
+
+00802904 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802904:	55                   	push   %ebp
+  802905:	89 e5                	mov    %esp,%ebp
+  802907:	57                   	push   %edi
+  802908:	56                   	push   %esi
+  802909:	53                   	push   %ebx
+  80290a:	83 ec 0c             	sub    $0xc,%esp
+  80290d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802910:	8b 75 10             	mov    0x10(%ebp),%esi
+  802913:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802916:	8b 45 08             	mov    0x8(%ebp),%eax
+  802919:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80291e:	8b 07                	mov    (%edi),%eax
+  802920:	a3 04 80 80 00       	mov    %eax,0x808004
+  802925:	8b 47 04             	mov    0x4(%edi),%eax
+  802928:	a3 08 80 80 00       	mov    %eax,0x808008
+  80292d:	8b 47 08             	mov    0x8(%edi),%eax
+  802930:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802935:	8b 47 0c             	mov    0xc(%edi),%eax
+  802938:	a3 10 80 80 00       	mov    %eax,0x808010
+  80293d:	8b 47 10             	mov    0x10(%edi),%eax
+  802940:	a3 14 80 80 00       	mov    %eax,0x808014
+  802945:	8b 47 14             	mov    0x14(%edi),%eax
+  802948:	a3 18 80 80 00       	mov    %eax,0x808018
+  80294d:	8b 47 18             	mov    0x18(%edi),%eax
+  802950:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802955:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802958:	a3 20 80 80 00       	mov    %eax,0x808020
+  80295d:	8b 47 20             	mov    0x20(%edi),%eax
+  802960:	a3 24 80 80 00       	mov    %eax,0x808024
+  802965:	8b 47 24             	mov    0x24(%edi),%eax
+  802968:	a3 28 80 80 00       	mov    %eax,0x808028
+  80296d:	8b 47 28             	mov    0x28(%edi),%eax
+  802970:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802975:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802978:	a3 30 80 80 00       	mov    %eax,0x808030
+  80297d:	8b 47 30             	mov    0x30(%edi),%eax
+  802980:	a3 34 80 80 00       	mov    %eax,0x808034
+  802985:	8b 47 34             	mov    0x34(%edi),%eax
+  802988:	a3 38 80 80 00       	mov    %eax,0x808038
+  80298d:	8b 47 38             	mov    0x38(%edi),%eax
+  802990:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802995:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802998:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  80299d:	8b 06                	mov    (%esi),%eax
+  80299f:	a3 44 80 80 00       	mov    %eax,0x808044
+  8029a4:	8b 46 04             	mov    0x4(%esi),%eax
+  8029a7:	a3 48 80 80 00       	mov    %eax,0x808048
+  8029ac:	8b 46 08             	mov    0x8(%esi),%eax
+  8029af:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8029b4:	8b 46 0c             	mov    0xc(%esi),%eax
+  8029b7:	a3 50 80 80 00       	mov    %eax,0x808050
+  8029bc:	8b 46 10             	mov    0x10(%esi),%eax
+  8029bf:	a3 54 80 80 00       	mov    %eax,0x808054
+  8029c4:	8b 46 14             	mov    0x14(%esi),%eax
+  8029c7:	a3 58 80 80 00       	mov    %eax,0x808058
+  8029cc:	8b 46 18             	mov    0x18(%esi),%eax
+  8029cf:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8029d4:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8029d7:	a3 60 80 80 00       	mov    %eax,0x808060
+  8029dc:	8b 46 20             	mov    0x20(%esi),%eax
+  8029df:	a3 64 80 80 00       	mov    %eax,0x808064
+  8029e4:	8b 46 24             	mov    0x24(%esi),%eax
+  8029e7:	a3 68 80 80 00       	mov    %eax,0x808068
+  8029ec:	8b 46 28             	mov    0x28(%esi),%eax
+  8029ef:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8029f4:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8029f7:	a3 70 80 80 00       	mov    %eax,0x808070
+  8029fc:	8b 46 30             	mov    0x30(%esi),%eax
+  8029ff:	a3 74 80 80 00       	mov    %eax,0x808074
+  802a04:	8b 46 34             	mov    0x34(%esi),%eax
+  802a07:	a3 78 80 80 00       	mov    %eax,0x808078
+  802a0c:	8b 46 38             	mov    0x38(%esi),%eax
+  802a0f:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802a14:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802a17:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802a1c:	8b 03                	mov    (%ebx),%eax
+  802a1e:	a3 84 80 80 00       	mov    %eax,0x808084
+  802a23:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a26:	a3 88 80 80 00       	mov    %eax,0x808088
+  802a2b:	8b 43 08             	mov    0x8(%ebx),%eax
+  802a2e:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802a33:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802a36:	a3 90 80 80 00       	mov    %eax,0x808090
+  802a3b:	8b 43 10             	mov    0x10(%ebx),%eax
+  802a3e:	a3 94 80 80 00       	mov    %eax,0x808094
+  802a43:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a46:	a3 98 80 80 00       	mov    %eax,0x808098
+  802a4b:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a4e:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802a53:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802a56:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802a5b:	8b 43 20             	mov    0x20(%ebx),%eax
+  802a5e:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802a63:	8b 43 24             	mov    0x24(%ebx),%eax
+  802a66:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802a6b:	8b 43 28             	mov    0x28(%ebx),%eax
+  802a6e:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802a73:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802a76:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802a7b:	8b 43 30             	mov    0x30(%ebx),%eax
+  802a7e:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802a83:	8b 43 34             	mov    0x34(%ebx),%eax
+  802a86:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802a8b:	8b 43 38             	mov    0x38(%ebx),%eax
+  802a8e:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802a93:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802a96:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802a9b:	8b 45 18             	mov    0x18(%ebp),%eax
+  802a9e:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802aa3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802aa8:	e8 2b f6 ff ff       	call   8020d8 <nsipc>
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	0f 88 ad 01 00 00    	js     802c62 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802ab5:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802abb:	89 17                	mov    %edx,(%edi)
+  802abd:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802ac3:	89 57 04             	mov    %edx,0x4(%edi)
+  802ac6:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802acc:	89 57 08             	mov    %edx,0x8(%edi)
+  802acf:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802ad5:	89 57 0c             	mov    %edx,0xc(%edi)
+  802ad8:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802ade:	89 57 10             	mov    %edx,0x10(%edi)
+  802ae1:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802ae7:	89 57 14             	mov    %edx,0x14(%edi)
+  802aea:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802af0:	89 57 18             	mov    %edx,0x18(%edi)
+  802af3:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802af9:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802afc:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802b02:	89 57 20             	mov    %edx,0x20(%edi)
+  802b05:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802b0b:	89 57 24             	mov    %edx,0x24(%edi)
+  802b0e:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802b14:	89 57 28             	mov    %edx,0x28(%edi)
+  802b17:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802b1d:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802b20:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802b26:	89 57 30             	mov    %edx,0x30(%edi)
+  802b29:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802b2f:	89 57 34             	mov    %edx,0x34(%edi)
+  802b32:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802b38:	89 57 38             	mov    %edx,0x38(%edi)
+  802b3b:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802b41:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802b44:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802b4a:	89 16                	mov    %edx,(%esi)
+  802b4c:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802b52:	89 56 04             	mov    %edx,0x4(%esi)
+  802b55:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802b5b:	89 56 08             	mov    %edx,0x8(%esi)
+  802b5e:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802b64:	89 56 0c             	mov    %edx,0xc(%esi)
+  802b67:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802b6d:	89 56 10             	mov    %edx,0x10(%esi)
+  802b70:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802b76:	89 56 14             	mov    %edx,0x14(%esi)
+  802b79:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802b7f:	89 56 18             	mov    %edx,0x18(%esi)
+  802b82:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802b88:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802b8b:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802b91:	89 56 20             	mov    %edx,0x20(%esi)
+  802b94:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802b9a:	89 56 24             	mov    %edx,0x24(%esi)
+  802b9d:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802ba3:	89 56 28             	mov    %edx,0x28(%esi)
+  802ba6:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802bac:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802baf:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802bb5:	89 56 30             	mov    %edx,0x30(%esi)
+  802bb8:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802bbe:	89 56 34             	mov    %edx,0x34(%esi)
+  802bc1:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802bc7:	89 56 38             	mov    %edx,0x38(%esi)
+  802bca:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802bd0:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802bd3:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802bd9:	89 13                	mov    %edx,(%ebx)
+  802bdb:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802be1:	89 53 04             	mov    %edx,0x4(%ebx)
+  802be4:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802bea:	89 53 08             	mov    %edx,0x8(%ebx)
+  802bed:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802bf3:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802bf6:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802bfc:	89 53 10             	mov    %edx,0x10(%ebx)
+  802bff:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802c05:	89 53 14             	mov    %edx,0x14(%ebx)
+  802c08:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802c0e:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c11:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802c17:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802c1a:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802c20:	89 53 20             	mov    %edx,0x20(%ebx)
+  802c23:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802c29:	89 53 24             	mov    %edx,0x24(%ebx)
+  802c2c:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802c32:	89 53 28             	mov    %edx,0x28(%ebx)
+  802c35:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802c3b:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802c3e:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802c44:	89 53 30             	mov    %edx,0x30(%ebx)
+  802c47:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802c4d:	89 53 34             	mov    %edx,0x34(%ebx)
+  802c50:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802c56:	89 53 38             	mov    %edx,0x38(%ebx)
+  802c59:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802c5f:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802c62:	83 c4 0c             	add    $0xc,%esp
+  802c65:	5b                   	pop    %ebx
+  802c66:	5e                   	pop    %esi
+  802c67:	5f                   	pop    %edi
+  802c68:	5d                   	pop    %ebp
+  802c69:	c3                   	ret
+
+00802c6a <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802c6a:	55                   	push   %ebp
+  802c6b:	89 e5                	mov    %esp,%ebp
+  802c6d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802c70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c73:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802c78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c7b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802c80:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c83:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802c88:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802c8d:	e8 46 f4 ff ff       	call   8020d8 <nsipc>
+}
+  802c92:	c9                   	leave
+  802c93:	c3                   	ret
+
+00802c94 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802c94:	55                   	push   %ebp
+  802c95:	89 e5                	mov    %esp,%ebp
+  802c97:	56                   	push   %esi
+  802c98:	53                   	push   %ebx
+  802c99:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802c9c:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802ca2:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ca5:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802caa:	b8 10 00 00 00       	mov    $0x10,%eax
+  802caf:	e8 24 f4 ff ff       	call   8020d8 <nsipc>
+  802cb4:	89 c3                	mov    %eax,%ebx
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	7e 1f                	jle    802cd9 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802cba:	39 c6                	cmp    %eax,%esi
+  802cbc:	7c 24                	jl     802ce2 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802cbe:	83 ec 04             	sub    $0x4,%esp
+  802cc1:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802cc8:	50                   	push   %eax
+  802cc9:	68 00 80 80 00       	push   $0x808000
+  802cce:	ff 75 08             	push   0x8(%ebp)
+  802cd1:	e8 d6 de ff ff       	call   800bac <memmove>
+  802cd6:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802cd9:	89 d8                	mov    %ebx,%eax
+  802cdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cde:	5b                   	pop    %ebx
+  802cdf:	5e                   	pop    %esi
+  802ce0:	5d                   	pop    %ebp
+  802ce1:	c3                   	ret
+		assert(r <= max);
+  802ce2:	68 b6 41 80 00       	push   $0x8041b6
+  802ce7:	68 89 41 80 00       	push   $0x804189
+  802cec:	68 6a 01 00 00       	push   $0x16a
+  802cf1:	68 9e 41 80 00       	push   $0x80419e
+  802cf6:	e8 2f d5 ff ff       	call   80022a <_panic>
+
+00802cfb <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802cfb:	55                   	push   %ebp
+  802cfc:	89 e5                	mov    %esp,%ebp
+  802cfe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d04:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802d09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d0c:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d11:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d14:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802d19:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d1e:	e8 b5 f3 ff ff       	call   8020d8 <nsipc>
+}
+  802d23:	c9                   	leave
+  802d24:	c3                   	ret
+
+00802d25 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802d25:	55                   	push   %ebp
+  802d26:	89 e5                	mov    %esp,%ebp
+  802d28:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2e:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802d33:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802d38:	e8 9b f3 ff ff       	call   8020d8 <nsipc>
+}
+  802d3d:	c9                   	leave
+  802d3e:	c3                   	ret
+
+00802d3f <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	53                   	push   %ebx
+  802d43:	83 ec 04             	sub    $0x4,%esp
+  802d46:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802d49:	b8 12 00 00 00       	mov    $0x12,%eax
+  802d4e:	e8 85 f3 ff ff       	call   8020d8 <nsipc>
+  802d53:	85 c0                	test   %eax,%eax
+  802d55:	78 50                	js     802da7 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802d57:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802d5d:	89 13                	mov    %edx,(%ebx)
+  802d5f:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802d65:	89 53 04             	mov    %edx,0x4(%ebx)
+  802d68:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802d6e:	89 53 08             	mov    %edx,0x8(%ebx)
+  802d71:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802d77:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802d7a:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802d80:	89 53 10             	mov    %edx,0x10(%ebx)
+  802d83:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802d89:	89 53 14             	mov    %edx,0x14(%ebx)
+  802d8c:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802d92:	89 53 18             	mov    %edx,0x18(%ebx)
+  802d95:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802d9b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802d9e:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802da4:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802da7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802daa:	c9                   	leave
+  802dab:	c3                   	ret
+
+00802dac <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802dac:	55                   	push   %ebp
+  802dad:	89 e5                	mov    %esp,%ebp
+  802daf:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802db2:	6a 03                	push   $0x3
+  802db4:	e8 bf 0c 00 00       	call   803a78 <ipc_find_env>
+  802db9:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc1:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802dc6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802dcb:	e8 08 f3 ff ff       	call   8020d8 <nsipc>
+  802dd0:	83 c4 10             	add    $0x10,%esp
+  802dd3:	85 c0                	test   %eax,%eax
+  802dd5:	78 0a                	js     802de1 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802dd7:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802de1:	c9                   	leave
+  802de2:	c3                   	ret
+
+00802de3 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802de3:	55                   	push   %ebp
+  802de4:	89 e5                	mov    %esp,%ebp
+  802de6:	57                   	push   %edi
+  802de7:	56                   	push   %esi
+  802de8:	53                   	push   %ebx
+  802de9:	83 ec 1c             	sub    $0x1c,%esp
+  802dec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802def:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802df2:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802df7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dfc:	89 e0                	mov    %esp,%eax
+  802dfe:	89 f2                	mov    %esi,%edx
+  802e00:	29 c2                	sub    %eax,%edx
+  802e02:	89 d0                	mov    %edx,%eax
+  802e04:	c1 e8 0f             	shr    $0xf,%eax
+  802e07:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802e0d:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802e10:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802e17:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802e1a:	83 ec 0c             	sub    $0xc,%esp
+  802e1d:	ff 75 e0             	push   -0x20(%ebp)
+  802e20:	e8 92 0c 00 00       	call   803ab7 <pageref>
+  802e25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e28:	83 c4 04             	add    $0x4,%esp
+  802e2b:	ff 75 dc             	push   -0x24(%ebp)
+  802e2e:	e8 84 0c 00 00       	call   803ab7 <pageref>
+  802e33:	89 e2                	mov    %esp,%edx
+  802e35:	89 f1                	mov    %esi,%ecx
+  802e37:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802e39:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802e3c:	89 ca                	mov    %ecx,%edx
+  802e3e:	c1 ea 0f             	shr    $0xf,%edx
+  802e41:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802e47:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802e4a:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802e51:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802e54:	39 d7                	cmp    %edx,%edi
+  802e56:	74 40                	je     802e98 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802e58:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e5b:	75 9f                	jne    802dfc <_pipeisclosed+0x19>
+  802e5d:	89 e2                	mov    %esp,%edx
+  802e5f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802e64:	29 d0                	sub    %edx,%eax
+  802e66:	89 c2                	mov    %eax,%edx
+  802e68:	c1 ea 0f             	shr    $0xf,%edx
+  802e6b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e75:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e78:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802e7f:	8b 40 58             	mov    0x58(%eax),%eax
+  802e82:	6a 01                	push   $0x1
+  802e84:	50                   	push   %eax
+  802e85:	57                   	push   %edi
+  802e86:	68 bf 41 80 00       	push   $0x8041bf
+  802e8b:	e8 75 d4 ff ff       	call   800305 <cprintf>
+  802e90:	83 c4 10             	add    $0x10,%esp
+  802e93:	e9 5f ff ff ff       	jmp    802df7 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802e98:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e9b:	0f 94 c0             	sete   %al
+  802e9e:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802ea1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea4:	5b                   	pop    %ebx
+  802ea5:	5e                   	pop    %esi
+  802ea6:	5f                   	pop    %edi
+  802ea7:	5d                   	pop    %ebp
+  802ea8:	c3                   	ret
+
+00802ea9 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ea9:	55                   	push   %ebp
+  802eaa:	89 e5                	mov    %esp,%ebp
+  802eac:	53                   	push   %ebx
+  802ead:	83 ec 0c             	sub    $0xc,%esp
+  802eb0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802eb3:	53                   	push   %ebx
+  802eb4:	6a 00                	push   $0x0
+  802eb6:	e8 fa df ff ff       	call   800eb5 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802ebb:	89 1c 24             	mov    %ebx,(%esp)
+  802ebe:	e8 e0 e3 ff ff       	call   8012a3 <fd2data>
+  802ec3:	83 c4 08             	add    $0x8,%esp
+  802ec6:	50                   	push   %eax
+  802ec7:	6a 00                	push   $0x0
+  802ec9:	e8 e7 df ff ff       	call   800eb5 <sys_page_unmap>
+}
+  802ece:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ed1:	c9                   	leave
+  802ed2:	c3                   	ret
+
+00802ed3 <devpipe_read>:
+{
+  802ed3:	55                   	push   %ebp
+  802ed4:	89 e5                	mov    %esp,%ebp
+  802ed6:	57                   	push   %edi
+  802ed7:	56                   	push   %esi
+  802ed8:	53                   	push   %ebx
+  802ed9:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802edc:	ff 75 08             	push   0x8(%ebp)
+  802edf:	e8 bf e3 ff ff       	call   8012a3 <fd2data>
+  802ee4:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802ee6:	8b 70 04             	mov    0x4(%eax),%esi
+  802ee9:	8b 00                	mov    (%eax),%eax
+  802eeb:	83 c4 10             	add    $0x10,%esp
+  802eee:	39 f0                	cmp    %esi,%eax
+  802ef0:	75 36                	jne    802f28 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802ef2:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802ef5:	89 da                	mov    %ebx,%edx
+  802ef7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efa:	e8 e4 fe ff ff       	call   802de3 <_pipeisclosed>
+  802eff:	85 c0                	test   %eax,%eax
+  802f01:	0f 85 d4 00 00 00    	jne    802fdb <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802f07:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f0c:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802f10:	83 ec 04             	sub    $0x4,%esp
+  802f13:	6a ff                	push   $0xffffffff
+  802f15:	56                   	push   %esi
+  802f16:	57                   	push   %edi
+  802f17:	e8 12 e3 ff ff       	call   80122e <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f1c:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f1f:	8b 03                	mov    (%ebx),%eax
+  802f21:	83 c4 10             	add    $0x10,%esp
+  802f24:	39 c6                	cmp    %eax,%esi
+  802f26:	74 cd                	je     802ef5 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f28:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f2b:	8b 03                	mov    (%ebx),%eax
+  802f2d:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802f33:	29 c6                	sub    %eax,%esi
+  802f35:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f3a:	f7 e6                	mul    %esi
+  802f3c:	c1 ea 0c             	shr    $0xc,%edx
+  802f3f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f45:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802f47:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f4a:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802f4e:	8b 0b                	mov    (%ebx),%ecx
+  802f50:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f55:	f7 e1                	mul    %ecx
+  802f57:	c1 ea 0b             	shr    $0xb,%edx
+  802f5a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f60:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802f62:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802f67:	29 cf                	sub    %ecx,%edi
+  802f69:	39 f7                	cmp    %esi,%edi
+  802f6b:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802f6e:	83 ec 04             	sub    $0x4,%esp
+  802f71:	57                   	push   %edi
+  802f72:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802f76:	50                   	push   %eax
+  802f77:	ff 75 0c             	push   0xc(%ebp)
+  802f7a:	e8 2d dc ff ff       	call   800bac <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802f7f:	83 c4 0c             	add    $0xc,%esp
+  802f82:	89 f0                	mov    %esi,%eax
+  802f84:	29 f8                	sub    %edi,%eax
+  802f86:	50                   	push   %eax
+  802f87:	8d 43 10             	lea    0x10(%ebx),%eax
+  802f8a:	50                   	push   %eax
+  802f8b:	89 f8                	mov    %edi,%eax
+  802f8d:	03 45 0c             	add    0xc(%ebp),%eax
+  802f90:	50                   	push   %eax
+  802f91:	e8 16 dc ff ff       	call   800bac <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802f96:	8b 0b                	mov    (%ebx),%ecx
+  802f98:	01 f1                	add    %esi,%ecx
+  802f9a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f9f:	f7 e1                	mul    %ecx
+  802fa1:	c1 ea 0c             	shr    $0xc,%edx
+  802fa4:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802faa:	29 c1                	sub    %eax,%ecx
+  802fac:	89 0b                	mov    %ecx,(%ebx)
+  802fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb3:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802fb7:	83 c4 10             	add    $0x10,%esp
+  802fba:	85 c0                	test   %eax,%eax
+  802fbc:	75 0a                	jne    802fc8 <devpipe_read+0xf5>
+	return n;
+  802fbe:	89 f0                	mov    %esi,%eax
+}
+  802fc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fc3:	5b                   	pop    %ebx
+  802fc4:	5e                   	pop    %esi
+  802fc5:	5f                   	pop    %edi
+  802fc6:	5d                   	pop    %ebp
+  802fc7:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802fc8:	83 ec 08             	sub    $0x8,%esp
+  802fcb:	68 00 04 00 00       	push   $0x400
+  802fd0:	53                   	push   %ebx
+  802fd1:	e8 7a e2 ff ff       	call   801250 <sys_futex_wake>
+  802fd6:	83 c4 10             	add    $0x10,%esp
+  802fd9:	eb e3                	jmp    802fbe <devpipe_read+0xeb>
+			return 0;
+  802fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe0:	eb de                	jmp    802fc0 <devpipe_read+0xed>
+
+00802fe2 <devpipe_write>:
+{
+  802fe2:	55                   	push   %ebp
+  802fe3:	89 e5                	mov    %esp,%ebp
+  802fe5:	57                   	push   %edi
+  802fe6:	56                   	push   %esi
+  802fe7:	53                   	push   %ebx
+  802fe8:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802feb:	ff 75 08             	push   0x8(%ebp)
+  802fee:	e8 b0 e2 ff ff       	call   8012a3 <fd2data>
+  802ff3:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802ff5:	83 c4 10             	add    $0x10,%esp
+  802ff8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fff:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803004:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803008:	0f 84 43 01 00 00    	je     803151 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80300e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803011:	8b 06                	mov    (%esi),%eax
+  803013:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803019:	29 c1                	sub    %eax,%ecx
+  80301b:	89 c8                	mov    %ecx,%eax
+  80301d:	f7 e7                	mul    %edi
+  80301f:	c1 ea 0c             	shr    $0xc,%edx
+  803022:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803028:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80302a:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803030:	75 52                	jne    803084 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803032:	89 f2                	mov    %esi,%edx
+  803034:	8b 45 08             	mov    0x8(%ebp),%eax
+  803037:	e8 a7 fd ff ff       	call   802de3 <_pipeisclosed>
+  80303c:	85 c0                	test   %eax,%eax
+  80303e:	0f 85 28 01 00 00    	jne    80316c <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803044:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803046:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803049:	8b 06                	mov    (%esi),%eax
+  80304b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803051:	29 c1                	sub    %eax,%ecx
+  803053:	89 c8                	mov    %ecx,%eax
+  803055:	f7 e7                	mul    %edi
+  803057:	c1 ea 0c             	shr    $0xc,%edx
+  80305a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803060:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803062:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803068:	75 a4                	jne    80300e <devpipe_write+0x2c>
+  80306a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80306f:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803073:	83 ec 04             	sub    $0x4,%esp
+  803076:	6a ff                	push   $0xffffffff
+  803078:	53                   	push   %ebx
+  803079:	56                   	push   %esi
+  80307a:	e8 af e1 ff ff       	call   80122e <sys_futex_wait>
+}
+  80307f:	83 c4 10             	add    $0x10,%esp
+  803082:	eb 8a                	jmp    80300e <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803084:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803087:	8b 06                	mov    (%esi),%eax
+  803089:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80308f:	29 c1                	sub    %eax,%ecx
+  803091:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803096:	f7 e1                	mul    %ecx
+  803098:	c1 ea 0c             	shr    $0xc,%edx
+  80309b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030a1:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8030a3:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8030a8:	89 d8                	mov    %ebx,%eax
+  8030aa:	29 c8                	sub    %ecx,%eax
+  8030ac:	8b 55 10             	mov    0x10(%ebp),%edx
+  8030af:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030b2:	29 ca                	sub    %ecx,%edx
+  8030b4:	39 d0                	cmp    %edx,%eax
+  8030b6:	0f 46 d0             	cmovbe %eax,%edx
+  8030b9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8030bc:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030bf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030c4:	f7 e1                	mul    %ecx
+  8030c6:	c1 ea 0b             	shr    $0xb,%edx
+  8030c9:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8030cf:	89 ca                	mov    %ecx,%edx
+  8030d1:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8030d3:	29 d3                	sub    %edx,%ebx
+  8030d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030d8:	39 c3                	cmp    %eax,%ebx
+  8030da:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8030dd:	83 ec 04             	sub    $0x4,%esp
+  8030e0:	53                   	push   %ebx
+  8030e1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030e4:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8030e7:	51                   	push   %ecx
+  8030e8:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8030ec:	50                   	push   %eax
+  8030ed:	e8 ba da ff ff       	call   800bac <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8030f2:	83 c4 0c             	add    $0xc,%esp
+  8030f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030f8:	29 d8                	sub    %ebx,%eax
+  8030fa:	50                   	push   %eax
+  8030fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030fe:	01 cb                	add    %ecx,%ebx
+  803100:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803103:	53                   	push   %ebx
+  803104:	8d 46 10             	lea    0x10(%esi),%eax
+  803107:	50                   	push   %eax
+  803108:	e8 9f da ff ff       	call   800bac <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80310d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803110:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803113:	01 c1                	add    %eax,%ecx
+  803115:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80311a:	f7 e1                	mul    %ecx
+  80311c:	c1 ea 0c             	shr    $0xc,%edx
+  80311f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803125:	89 ca                	mov    %ecx,%edx
+  803127:	29 c2                	sub    %eax,%edx
+  803129:	89 56 04             	mov    %edx,0x4(%esi)
+  80312c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803131:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803135:	83 c4 10             	add    $0x10,%esp
+  803138:	85 c0                	test   %eax,%eax
+  80313a:	75 1a                	jne    803156 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80313c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80313f:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803142:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803145:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803148:	0f 82 c0 fe ff ff    	jb     80300e <devpipe_write+0x2c>
+  80314e:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803151:	8b 45 10             	mov    0x10(%ebp),%eax
+  803154:	eb 1b                	jmp    803171 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803156:	83 ec 08             	sub    $0x8,%esp
+  803159:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  80315e:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803161:	50                   	push   %eax
+  803162:	e8 e9 e0 ff ff       	call   801250 <sys_futex_wake>
+  803167:	83 c4 10             	add    $0x10,%esp
+  80316a:	eb d0                	jmp    80313c <devpipe_write+0x15a>
+				return 0;
+  80316c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803171:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803174:	5b                   	pop    %ebx
+  803175:	5e                   	pop    %esi
+  803176:	5f                   	pop    %edi
+  803177:	5d                   	pop    %ebp
+  803178:	c3                   	ret
+
+00803179 <devpipe_stat>:
+{
+  803179:	55                   	push   %ebp
+  80317a:	89 e5                	mov    %esp,%ebp
+  80317c:	56                   	push   %esi
+  80317d:	53                   	push   %ebx
+  80317e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803181:	83 ec 0c             	sub    $0xc,%esp
+  803184:	ff 75 08             	push   0x8(%ebp)
+  803187:	e8 17 e1 ff ff       	call   8012a3 <fd2data>
+  80318c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80318e:	83 c4 08             	add    $0x8,%esp
+  803191:	68 d2 41 80 00       	push   $0x8041d2
+  803196:	53                   	push   %ebx
+  803197:	e8 60 d8 ff ff       	call   8009fc <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80319c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80319f:	8b 06                	mov    (%esi),%eax
+  8031a1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8031a7:	29 c1                	sub    %eax,%ecx
+  8031a9:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031ae:	89 c8                	mov    %ecx,%eax
+  8031b0:	f7 e2                	mul    %edx
+  8031b2:	c1 ea 0c             	shr    $0xc,%edx
+  8031b5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031bb:	29 d1                	sub    %edx,%ecx
+  8031bd:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8031c3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8031ca:	00 00 00 
+	stat->st_dev = &devpipe;
+  8031cd:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8031d4:	50 80 00 
+}
+  8031d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031df:	5b                   	pop    %ebx
+  8031e0:	5e                   	pop    %esi
+  8031e1:	5d                   	pop    %ebp
+  8031e2:	c3                   	ret
+
+008031e3 <devpipe_poll>:
+{
+  8031e3:	55                   	push   %ebp
+  8031e4:	89 e5                	mov    %esp,%ebp
+  8031e6:	57                   	push   %edi
+  8031e7:	56                   	push   %esi
+  8031e8:	53                   	push   %ebx
+  8031e9:	83 ec 18             	sub    $0x18,%esp
+  8031ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8031ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031f2:	57                   	push   %edi
+  8031f3:	e8 ab e0 ff ff       	call   8012a3 <fd2data>
+  8031f8:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8031fa:	83 c4 10             	add    $0x10,%esp
+  8031fd:	89 f3                	mov    %esi,%ebx
+  8031ff:	83 e3 01             	and    $0x1,%ebx
+  803202:	75 27                	jne    80322b <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803204:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80320a:	75 48                	jne    803254 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80320c:	89 ca                	mov    %ecx,%edx
+  80320e:	89 f8                	mov    %edi,%eax
+  803210:	e8 ce fb ff ff       	call   802de3 <_pipeisclosed>
+  803215:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803217:	89 d8                	mov    %ebx,%eax
+  803219:	83 c8 10             	or     $0x10,%eax
+  80321c:	85 d2                	test   %edx,%edx
+  80321e:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803221:	89 d8                	mov    %ebx,%eax
+  803223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803226:	5b                   	pop    %ebx
+  803227:	5e                   	pop    %esi
+  803228:	5f                   	pop    %edi
+  803229:	5d                   	pop    %ebp
+  80322a:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80322b:	8b 58 04             	mov    0x4(%eax),%ebx
+  80322e:	8b 00                	mov    (%eax),%eax
+  803230:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803236:	29 c3                	sub    %eax,%ebx
+  803238:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80323d:	89 d8                	mov    %ebx,%eax
+  80323f:	f7 e2                	mul    %edx
+  803241:	c1 ea 0c             	shr    $0xc,%edx
+  803244:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80324a:	39 d3                	cmp    %edx,%ebx
+  80324c:	0f 95 c3             	setne  %bl
+  80324f:	0f b6 db             	movzbl %bl,%ebx
+  803252:	eb b0                	jmp    803204 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803254:	8b 71 04             	mov    0x4(%ecx),%esi
+  803257:	8b 01                	mov    (%ecx),%eax
+  803259:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80325f:	29 c6                	sub    %eax,%esi
+  803261:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803266:	89 f0                	mov    %esi,%eax
+  803268:	f7 e2                	mul    %edx
+  80326a:	c1 ea 0c             	shr    $0xc,%edx
+  80326d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803273:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803275:	89 d8                	mov    %ebx,%eax
+  803277:	83 c8 04             	or     $0x4,%eax
+  80327a:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803280:	0f 42 d8             	cmovb  %eax,%ebx
+  803283:	eb 87                	jmp    80320c <devpipe_poll+0x29>
+
+00803285 <pipe>:
+{
+  803285:	55                   	push   %ebp
+  803286:	89 e5                	mov    %esp,%ebp
+  803288:	56                   	push   %esi
+  803289:	53                   	push   %ebx
+  80328a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80328d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803290:	50                   	push   %eax
+  803291:	e8 24 e0 ff ff       	call   8012ba <fd_alloc>
+  803296:	89 c3                	mov    %eax,%ebx
+  803298:	83 c4 10             	add    $0x10,%esp
+  80329b:	85 c0                	test   %eax,%eax
+  80329d:	0f 88 23 01 00 00    	js     8033c6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032a3:	83 ec 04             	sub    $0x4,%esp
+  8032a6:	68 07 04 00 00       	push   $0x407
+  8032ab:	ff 75 f4             	push   -0xc(%ebp)
+  8032ae:	6a 00                	push   $0x0
+  8032b0:	e8 7b db ff ff       	call   800e30 <sys_page_alloc>
+  8032b5:	89 c3                	mov    %eax,%ebx
+  8032b7:	83 c4 10             	add    $0x10,%esp
+  8032ba:	85 c0                	test   %eax,%eax
+  8032bc:	0f 88 04 01 00 00    	js     8033c6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032c2:	83 ec 0c             	sub    $0xc,%esp
+  8032c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032c8:	50                   	push   %eax
+  8032c9:	e8 ec df ff ff       	call   8012ba <fd_alloc>
+  8032ce:	89 c3                	mov    %eax,%ebx
+  8032d0:	83 c4 10             	add    $0x10,%esp
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	0f 88 db 00 00 00    	js     8033b6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032db:	83 ec 04             	sub    $0x4,%esp
+  8032de:	68 07 04 00 00       	push   $0x407
+  8032e3:	ff 75 f0             	push   -0x10(%ebp)
+  8032e6:	6a 00                	push   $0x0
+  8032e8:	e8 43 db ff ff       	call   800e30 <sys_page_alloc>
+  8032ed:	89 c3                	mov    %eax,%ebx
+  8032ef:	83 c4 10             	add    $0x10,%esp
+  8032f2:	85 c0                	test   %eax,%eax
+  8032f4:	0f 88 bc 00 00 00    	js     8033b6 <pipe+0x131>
+	va = fd2data(fd0);
+  8032fa:	83 ec 0c             	sub    $0xc,%esp
+  8032fd:	ff 75 f4             	push   -0xc(%ebp)
+  803300:	e8 9e df ff ff       	call   8012a3 <fd2data>
+  803305:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803307:	83 c4 0c             	add    $0xc,%esp
+  80330a:	68 07 04 00 00       	push   $0x407
+  80330f:	50                   	push   %eax
+  803310:	6a 00                	push   $0x0
+  803312:	e8 19 db ff ff       	call   800e30 <sys_page_alloc>
+  803317:	89 c3                	mov    %eax,%ebx
+  803319:	83 c4 10             	add    $0x10,%esp
+  80331c:	85 c0                	test   %eax,%eax
+  80331e:	0f 88 82 00 00 00    	js     8033a6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803324:	83 ec 0c             	sub    $0xc,%esp
+  803327:	ff 75 f0             	push   -0x10(%ebp)
+  80332a:	e8 74 df ff ff       	call   8012a3 <fd2data>
+  80332f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803336:	50                   	push   %eax
+  803337:	6a 00                	push   $0x0
+  803339:	56                   	push   %esi
+  80333a:	6a 00                	push   $0x0
+  80333c:	e8 32 db ff ff       	call   800e73 <sys_page_map>
+  803341:	89 c3                	mov    %eax,%ebx
+  803343:	83 c4 20             	add    $0x20,%esp
+  803346:	85 c0                	test   %eax,%eax
+  803348:	78 4e                	js     803398 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80334a:	a1 60 50 80 00       	mov    0x805060,%eax
+  80334f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803352:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803354:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803357:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80335e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803361:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803363:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803366:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80336d:	83 ec 0c             	sub    $0xc,%esp
+  803370:	ff 75 f4             	push   -0xc(%ebp)
+  803373:	e8 1b df ff ff       	call   801293 <fd2num>
+  803378:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80337b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80337d:	83 c4 04             	add    $0x4,%esp
+  803380:	ff 75 f0             	push   -0x10(%ebp)
+  803383:	e8 0b df ff ff       	call   801293 <fd2num>
+  803388:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80338b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80338e:	83 c4 10             	add    $0x10,%esp
+  803391:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803396:	eb 2e                	jmp    8033c6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803398:	83 ec 08             	sub    $0x8,%esp
+  80339b:	56                   	push   %esi
+  80339c:	6a 00                	push   $0x0
+  80339e:	e8 12 db ff ff       	call   800eb5 <sys_page_unmap>
+  8033a3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8033a6:	83 ec 08             	sub    $0x8,%esp
+  8033a9:	ff 75 f0             	push   -0x10(%ebp)
+  8033ac:	6a 00                	push   $0x0
+  8033ae:	e8 02 db ff ff       	call   800eb5 <sys_page_unmap>
+  8033b3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033b6:	83 ec 08             	sub    $0x8,%esp
+  8033b9:	ff 75 f4             	push   -0xc(%ebp)
+  8033bc:	6a 00                	push   $0x0
+  8033be:	e8 f2 da ff ff       	call   800eb5 <sys_page_unmap>
+  8033c3:	83 c4 10             	add    $0x10,%esp
+}
+  8033c6:	89 d8                	mov    %ebx,%eax
+  8033c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033cb:	5b                   	pop    %ebx
+  8033cc:	5e                   	pop    %esi
+  8033cd:	5d                   	pop    %ebp
+  8033ce:	c3                   	ret
+
+008033cf <pipeisclosed>:
+{
+  8033cf:	55                   	push   %ebp
+  8033d0:	89 e5                	mov    %esp,%ebp
+  8033d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033d8:	50                   	push   %eax
+  8033d9:	ff 75 08             	push   0x8(%ebp)
+  8033dc:	e8 29 df ff ff       	call   80130a <fd_lookup>
+  8033e1:	83 c4 10             	add    $0x10,%esp
+  8033e4:	85 c0                	test   %eax,%eax
+  8033e6:	78 18                	js     803400 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033e8:	83 ec 0c             	sub    $0xc,%esp
+  8033eb:	ff 75 f4             	push   -0xc(%ebp)
+  8033ee:	e8 b0 de ff ff       	call   8012a3 <fd2data>
+  8033f3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033f8:	e8 e6 f9 ff ff       	call   802de3 <_pipeisclosed>
+  8033fd:	83 c4 10             	add    $0x10,%esp
+}
+  803400:	c9                   	leave
+  803401:	c3                   	ret
+
+00803402 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803402:	55                   	push   %ebp
+  803403:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803405:	8b 45 08             	mov    0x8(%ebp),%eax
+  803408:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80340e:	5d                   	pop    %ebp
+  80340f:	c3                   	ret
+
+00803410 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803410:	55                   	push   %ebp
+  803411:	89 e5                	mov    %esp,%ebp
+  803413:	53                   	push   %ebx
+  803414:	83 ec 04             	sub    $0x4,%esp
+  803417:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80341a:	8b 03                	mov    (%ebx),%eax
+  80341c:	85 c0                	test   %eax,%eax
+  80341e:	75 05                	jne    803425 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803420:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803423:	c9                   	leave
+  803424:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803425:	83 ec 08             	sub    $0x8,%esp
+  803428:	50                   	push   %eax
+  803429:	8d 43 04             	lea    0x4(%ebx),%eax
+  80342c:	50                   	push   %eax
+  80342d:	e8 d3 dc ff ff       	call   801105 <sys_page_batch>
+	pb->pb_n = 0;
+  803432:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803438:	83 c4 10             	add    $0x10,%esp
+  80343b:	eb e3                	jmp    803420 <pgbatch_flush+0x10>
+
+0080343d <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80343d:	55                   	push   %ebp
+  80343e:	89 e5                	mov    %esp,%ebp
+  803440:	56                   	push   %esi
+  803441:	53                   	push   %ebx
+  803442:	89 c3                	mov    %eax,%ebx
+  803444:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803446:	83 38 20             	cmpl   $0x20,(%eax)
+  803449:	74 2c                	je     803477 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  80344b:	8b 03                	mov    (%ebx),%eax
+  80344d:	8d 50 01             	lea    0x1(%eax),%edx
+  803450:	89 13                	mov    %edx,(%ebx)
+  803452:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803455:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803459:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  80345b:	83 ec 04             	sub    $0x4,%esp
+  80345e:	6a 18                	push   $0x18
+  803460:	6a 00                	push   $0x0
+  803462:	50                   	push   %eax
+  803463:	e8 0f d7 ff ff       	call   800b77 <memset>
+	return 0;
+  803468:	83 c4 10             	add    $0x10,%esp
+  80346b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803470:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803473:	5b                   	pop    %ebx
+  803474:	5e                   	pop    %esi
+  803475:	5d                   	pop    %ebp
+  803476:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803477:	83 ec 0c             	sub    $0xc,%esp
+  80347a:	50                   	push   %eax
+  80347b:	e8 90 ff ff ff       	call   803410 <pgbatch_flush>
+  803480:	83 c4 10             	add    $0x10,%esp
+  803483:	85 c0                	test   %eax,%eax
+  803485:	79 c4                	jns    80344b <pgbatch_slot+0xe>
+  803487:	eb e7                	jmp    803470 <pgbatch_slot+0x33>
+
+00803489 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803489:	55                   	push   %ebp
+  80348a:	89 e5                	mov    %esp,%ebp
+  80348c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80348f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803492:	8b 45 08             	mov    0x8(%ebp),%eax
+  803495:	e8 a3 ff ff ff       	call   80343d <pgbatch_slot>
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	78 20                	js     8034be <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  80349e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034a1:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8034a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034aa:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034ad:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034b0:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034b3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034b6:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034be:	c9                   	leave
+  8034bf:	c3                   	ret
+
+008034c0 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8034c0:	55                   	push   %ebp
+  8034c1:	89 e5                	mov    %esp,%ebp
+  8034c3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034c6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034cc:	e8 6c ff ff ff       	call   80343d <pgbatch_slot>
+  8034d1:	85 c0                	test   %eax,%eax
+  8034d3:	78 2c                	js     803501 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8034d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034d8:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8034de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034e1:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8034e4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034e7:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8034ea:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034ed:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8034f0:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034f3:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034f6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8034f9:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803501:	c9                   	leave
+  803502:	c3                   	ret
+
+00803503 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803503:	55                   	push   %ebp
+  803504:	89 e5                	mov    %esp,%ebp
+  803506:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803509:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80350c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80350f:	e8 29 ff ff ff       	call   80343d <pgbatch_slot>
+  803514:	85 c0                	test   %eax,%eax
+  803516:	78 1a                	js     803532 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803518:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80351b:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803521:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803524:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803527:	8b 55 10             	mov    0x10(%ebp),%edx
+  80352a:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80352d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803532:	c9                   	leave
+  803533:	c3                   	ret
+
+00803534 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803534:	55                   	push   %ebp
+  803535:	89 e5                	mov    %esp,%ebp
+  803537:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80353a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80353d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803540:	e8 f8 fe ff ff       	call   80343d <pgbatch_slot>
+  803545:	85 c0                	test   %eax,%eax
+  803547:	78 20                	js     803569 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803549:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80354c:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803552:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803555:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803558:	8b 55 10             	mov    0x10(%ebp),%edx
+  80355b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80355e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803561:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803564:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803569:	c9                   	leave
+  80356a:	c3                   	ret
+
+0080356b <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  80356b:	55                   	push   %ebp
+  80356c:	89 e5                	mov    %esp,%ebp
+  80356e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803571:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803574:	8b 45 08             	mov    0x8(%ebp),%eax
+  803577:	e8 c1 fe ff ff       	call   80343d <pgbatch_slot>
+  80357c:	85 c0                	test   %eax,%eax
+  80357e:	78 26                	js     8035a6 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803580:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803583:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803589:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80358c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  80358f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803592:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803595:	8b 55 14             	mov    0x14(%ebp),%edx
+  803598:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80359b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80359e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035a6:	c9                   	leave
+  8035a7:	c3                   	ret
+
+008035a8 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8035a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ad:	c3                   	ret
+
+008035ae <devcons_poll>:
+{
+  8035ae:	55                   	push   %ebp
+  8035af:	89 e5                	mov    %esp,%ebp
+  8035b1:	53                   	push   %ebx
+  8035b2:	83 ec 04             	sub    $0x4,%esp
+  8035b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8035b8:	89 da                	mov    %ebx,%edx
+  8035ba:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8035bd:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  8035c4:	74 0c                	je     8035d2 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8035c6:	89 d8                	mov    %ebx,%eax
+  8035c8:	83 e0 01             	and    $0x1,%eax
+  8035cb:	09 d0                	or     %edx,%eax
+}
+  8035cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035d0:	c9                   	leave
+  8035d1:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8035d2:	e8 bb d7 ff ff       	call   800d92 <sys_cgetc>
+  8035d7:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8035dc:	89 da                	mov    %ebx,%edx
+  8035de:	83 e2 04             	and    $0x4,%edx
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	74 e6                	je     8035cb <devcons_poll+0x1d>
+  8035e5:	eb df                	jmp    8035c6 <devcons_poll+0x18>
+
+008035e7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8035e7:	55                   	push   %ebp
+  8035e8:	89 e5                	mov    %esp,%ebp
+  8035ea:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8035ed:	68 de 41 80 00       	push   $0x8041de
+  8035f2:	ff 75 0c             	push   0xc(%ebp)
+  8035f5:	e8 02 d4 ff ff       	call   8009fc <strcpy>
+	return 0;
+}
+  8035fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ff:	c9                   	leave
+  803600:	c3                   	ret
+
+00803601 <devcons_write>:
+{
+  803601:	55                   	push   %ebp
+  803602:	89 e5                	mov    %esp,%ebp
+  803604:	57                   	push   %edi
+  803605:	56                   	push   %esi
+  803606:	53                   	push   %ebx
+  803607:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80360d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803610:	85 ff                	test   %edi,%edi
+  803612:	74 51                	je     803665 <devcons_write+0x64>
+  803614:	be 00 00 00 00       	mov    $0x0,%esi
+  803619:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80361e:	89 fb                	mov    %edi,%ebx
+  803620:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803622:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803627:	39 d3                	cmp    %edx,%ebx
+  803629:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80362c:	83 ec 04             	sub    $0x4,%esp
+  80362f:	53                   	push   %ebx
+  803630:	03 45 0c             	add    0xc(%ebp),%eax
+  803633:	50                   	push   %eax
+  803634:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80363a:	50                   	push   %eax
+  80363b:	e8 6c d5 ff ff       	call   800bac <memmove>
+		sys_cputs(buf, m);
+  803640:	83 c4 08             	add    $0x8,%esp
+  803643:	53                   	push   %ebx
+  803644:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80364a:	50                   	push   %eax
+  80364b:	e8 24 d7 ff ff       	call   800d74 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803650:	01 de                	add    %ebx,%esi
+  803652:	89 f0                	mov    %esi,%eax
+  803654:	83 c4 10             	add    $0x10,%esp
+  803657:	39 fe                	cmp    %edi,%esi
+  803659:	72 c3                	jb     80361e <devcons_write+0x1d>
+}
+  80365b:	89 f0                	mov    %esi,%eax
+  80365d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803660:	5b                   	pop    %ebx
+  803661:	5e                   	pop    %esi
+  803662:	5f                   	pop    %edi
+  803663:	5d                   	pop    %ebp
+  803664:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803665:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80366a:	eb ef                	jmp    80365b <devcons_write+0x5a>
+
+0080366c <devcons_read>:
+{
+  80366c:	55                   	push   %ebp
+  80366d:	89 e5                	mov    %esp,%ebp
+  80366f:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803672:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803677:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80367b:	74 36                	je     8036b3 <devcons_read+0x47>
+	c = cons_peek;
+  80367d:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  803682:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  803689:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80368c:	85 c0                	test   %eax,%eax
+  80368e:	75 10                	jne    8036a0 <devcons_read+0x34>
+  803690:	e8 fd d6 ff ff       	call   800d92 <sys_cgetc>
+  803695:	85 c0                	test   %eax,%eax
+  803697:	75 07                	jne    8036a0 <devcons_read+0x34>
+		sys_yield();
+  803699:	e8 73 d7 ff ff       	call   800e11 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80369e:	eb f0                	jmp    803690 <devcons_read+0x24>
+	if (c < 0)
+  8036a0:	85 c0                	test   %eax,%eax
+  8036a2:	78 0f                	js     8036b3 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8036a4:	83 f8 04             	cmp    $0x4,%eax
+  8036a7:	74 0c                	je     8036b5 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8036a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036ac:	88 02                	mov    %al,(%edx)
+	return 1;
+  8036ae:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8036b3:	c9                   	leave
+  8036b4:	c3                   	ret
+		return 0;
+  8036b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ba:	eb f7                	jmp    8036b3 <devcons_read+0x47>
+
+008036bc <cputchar>:
+{
+  8036bc:	55                   	push   %ebp
+  8036bd:	89 e5                	mov    %esp,%ebp
+  8036bf:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8036c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036c5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8036c8:	6a 01                	push   $0x1
+  8036ca:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036cd:	50                   	push   %eax
+  8036ce:	e8 a1 d6 ff ff       	call   800d74 <sys_cputs>
+}
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	c9                   	leave
+  8036d7:	c3                   	ret
+
+008036d8 <getchar>:
+{
+  8036d8:	55                   	push   %ebp
+  8036d9:	89 e5                	mov    %esp,%ebp
+  8036db:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8036de:	6a 01                	push   $0x1
+  8036e0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036e3:	50                   	push   %eax
+  8036e4:	6a 00                	push   $0x0
+  8036e6:	e8 a3 de ff ff       	call   80158e <read>
+	if (r < 0)
+  8036eb:	83 c4 10             	add    $0x10,%esp
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	78 06                	js     8036f8 <getchar+0x20>
+	if (r < 1)
+  8036f2:	74 06                	je     8036fa <getchar+0x22>
+	return c;
+  8036f4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8036f8:	c9                   	leave
+  8036f9:	c3                   	ret
+		return -E_EOF;
+  8036fa:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8036ff:	eb f7                	jmp    8036f8 <getchar+0x20>
+
+00803701 <iscons>:
+{
+  803701:	55                   	push   %ebp
+  803702:	89 e5                	mov    %esp,%ebp
+  803704:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803707:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80370a:	50                   	push   %eax
+  80370b:	ff 75 08             	push   0x8(%ebp)
+  80370e:	e8 f7 db ff ff       	call   80130a <fd_lookup>
+  803713:	83 c4 10             	add    $0x10,%esp
+  803716:	85 c0                	test   %eax,%eax
+  803718:	78 11                	js     80372b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80371a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80371d:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803723:	39 10                	cmp    %edx,(%eax)
+  803725:	0f 94 c0             	sete   %al
+  803728:	0f b6 c0             	movzbl %al,%eax
+}
+  80372b:	c9                   	leave
+  80372c:	c3                   	ret
+
+0080372d <opencons>:
+{
+  80372d:	55                   	push   %ebp
+  80372e:	89 e5                	mov    %esp,%ebp
+  803730:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803733:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803736:	50                   	push   %eax
+  803737:	e8 7e db ff ff       	call   8012ba <fd_alloc>
+  80373c:	83 c4 10             	add    $0x10,%esp
+  80373f:	85 c0                	test   %eax,%eax
+  803741:	78 3a                	js     80377d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803743:	83 ec 04             	sub    $0x4,%esp
+  803746:	68 07 04 00 00       	push   $0x407
+  80374b:	ff 75 f4             	push   -0xc(%ebp)
+  80374e:	6a 00                	push   $0x0
+  803750:	e8 db d6 ff ff       	call   800e30 <sys_page_alloc>
+  803755:	83 c4 10             	add    $0x10,%esp
+  803758:	85 c0                	test   %eax,%eax
+  80375a:	78 21                	js     80377d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80375c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80375f:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803765:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803767:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80376a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803771:	83 ec 0c             	sub    $0xc,%esp
+  803774:	50                   	push   %eax
+  803775:	e8 19 db ff ff       	call   801293 <fd2num>
+  80377a:	83 c4 10             	add    $0x10,%esp
+}
+  80377d:	c9                   	leave
+  80377e:	c3                   	ret
+
+0080377f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80377f:	55                   	push   %ebp
+  803780:	89 e5                	mov    %esp,%ebp
+  803782:	56                   	push   %esi
+  803783:	53                   	push   %ebx
+  803784:	8b 75 08             	mov    0x8(%ebp),%esi
+  803787:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80378a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80378d:	85 c0                	test   %eax,%eax
+  80378f:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803794:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803797:	83 ec 0c             	sub    $0xc,%esp
+  80379a:	50                   	push   %eax
+  80379b:	e8 40 d8 ff ff       	call   800fe0 <sys_ipc_recv>
+  8037a0:	83 c4 10             	add    $0x10,%esp
+  8037a3:	85 c0                	test   %eax,%eax
+  8037a5:	0f 88 8b 00 00 00    	js     803836 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8037ab:	85 f6                	test   %esi,%esi
+  8037ad:	74 2a                	je     8037d9 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8037af:	89 e2                	mov    %esp,%edx
+  8037b1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037b6:	29 d0                	sub    %edx,%eax
+  8037b8:	89 c2                	mov    %eax,%edx
+  8037ba:	c1 ea 0f             	shr    $0xf,%edx
+  8037bd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c7:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8037ca:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037d1:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8037d7:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8037d9:	85 db                	test   %ebx,%ebx
+  8037db:	74 2a                	je     803807 <ipc_recv+0x88>
+  8037dd:	89 e2                	mov    %esp,%edx
+  8037df:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037e4:	29 d0                	sub    %edx,%eax
+  8037e6:	89 c2                	mov    %eax,%edx
+  8037e8:	c1 ea 0f             	shr    $0xf,%edx
+  8037eb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f5:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8037f8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037ff:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803805:	89 03                	mov    %eax,(%ebx)
+  803807:	89 e2                	mov    %esp,%edx
+  803809:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80380e:	29 d0                	sub    %edx,%eax
+  803810:	89 c2                	mov    %eax,%edx
+  803812:	c1 ea 0f             	shr    $0xf,%edx
+  803815:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80381a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80381f:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803822:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803829:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80382f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803832:	5b                   	pop    %ebx
+  803833:	5e                   	pop    %esi
+  803834:	5d                   	pop    %ebp
+  803835:	c3                   	ret
+		if(from_env_store != NULL)
+  803836:	85 f6                	test   %esi,%esi
+  803838:	74 06                	je     803840 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80383a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803840:	85 db                	test   %ebx,%ebx
+  803842:	74 eb                	je     80382f <ipc_recv+0xb0>
+			*perm_store = 0;
+  803844:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80384a:	eb e3                	jmp    80382f <ipc_recv+0xb0>
+
+0080384c <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80384c:	55                   	push   %ebp
+  80384d:	89 e5                	mov    %esp,%ebp
+  80384f:	57                   	push   %edi
+  803850:	56                   	push   %esi
+  803851:	53                   	push   %ebx
+  803852:	83 ec 14             	sub    $0x14,%esp
+  803855:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803858:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80385b:	8b 75 14             	mov    0x14(%ebp),%esi
+  80385e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803861:	85 c0                	test   %eax,%eax
+  803863:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803868:	0f 44 c2             	cmove  %edx,%eax
+  80386b:	ff 75 10             	push   0x10(%ebp)
+  80386e:	50                   	push   %eax
+  80386f:	e8 ce d7 ff ff       	call   801042 <sys_ipc_recv_pages>
+  803874:	83 c4 10             	add    $0x10,%esp
+  803877:	85 c0                	test   %eax,%eax
+  803879:	0f 88 ba 00 00 00    	js     803939 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80387f:	85 ff                	test   %edi,%edi
+  803881:	74 2a                	je     8038ad <ipc_recv_pages+0x61>
+  803883:	89 e2                	mov    %esp,%edx
+  803885:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80388a:	29 d0                	sub    %edx,%eax
+  80388c:	89 c2                	mov    %eax,%edx
+  80388e:	c1 ea 0f             	shr    $0xf,%edx
+  803891:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80389e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8038a5:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8038ab:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8038ad:	85 f6                	test   %esi,%esi
+  8038af:	74 2a                	je     8038db <ipc_recv_pages+0x8f>
+  8038b1:	89 e2                	mov    %esp,%edx
+  8038b3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038b8:	29 d0                	sub    %edx,%eax
+  8038ba:	89 c2                	mov    %eax,%edx
+  8038bc:	c1 ea 0f             	shr    $0xf,%edx
+  8038bf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c9:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8038cc:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8038d3:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8038d9:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8038db:	85 db                	test   %ebx,%ebx
+  8038dd:	74 2a                	je     803909 <ipc_recv_pages+0xbd>
+  8038df:	89 e2                	mov    %esp,%edx
+  8038e1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038e6:	29 d0                	sub    %edx,%eax
+  8038e8:	89 c2                	mov    %eax,%edx
+  8038ea:	c1 ea 0f             	shr    $0xf,%edx
+  8038ed:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f7:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8038fa:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803901:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803907:	89 03                	mov    %eax,(%ebx)
+  803909:	89 e2                	mov    %esp,%edx
+  80390b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803910:	29 d0                	sub    %edx,%eax
+  803912:	89 c2                	mov    %eax,%edx
+  803914:	c1 ea 0f             	shr    $0xf,%edx
+  803917:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80391c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803921:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803924:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80392b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803931:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803934:	5b                   	pop    %ebx
+  803935:	5e                   	pop    %esi
+  803936:	5f                   	pop    %edi
+  803937:	5d                   	pop    %ebp
+  803938:	c3                   	ret
+		if (from_env_store)
+  803939:	85 ff                	test   %edi,%edi
+  80393b:	74 06                	je     803943 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80393d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803943:	85 f6                	test   %esi,%esi
+  803945:	74 06                	je     80394d <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803947:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80394d:	85 db                	test   %ebx,%ebx
+  80394f:	74 e0                	je     803931 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803951:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803957:	eb d8                	jmp    803931 <ipc_recv_pages+0xe5>
+
+00803959 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  803959:	55                   	push   %ebp
+  80395a:	89 e5                	mov    %esp,%ebp
+  80395c:	57                   	push   %edi
+  80395d:	56                   	push   %esi
+  80395e:	53                   	push   %ebx
+  80395f:	83 ec 1c             	sub    $0x1c,%esp
+  803962:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803965:	8b 75 08             	mov    0x8(%ebp),%esi
+  803968:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80396e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803972:	75 2b                	jne    80399f <ipc_try_send_pages+0x46>
+  803974:	89 e2                	mov    %esp,%edx
+  803976:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80397b:	29 d0                	sub    %edx,%eax
+  80397d:	89 c2                	mov    %eax,%edx
+  80397f:	c1 ea 0f             	shr    $0xf,%edx
+  803982:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398c:	0f 42 c2             	cmovb  %edx,%eax
+  80398f:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803996:	8b 70 48             	mov    0x48(%eax),%esi
+  803999:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80399f:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8039a5:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8039aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8039ad:	85 ff                	test   %edi,%edi
+  8039af:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8039b4:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8039b7:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8039bd:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8039c3:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8039c9:	83 ec 0c             	sub    $0xc,%esp
+  8039cc:	ff 75 14             	push   0x14(%ebp)
+  8039cf:	ff 75 18             	push   0x18(%ebp)
+  8039d2:	57                   	push   %edi
+  8039d3:	ff 75 0c             	push   0xc(%ebp)
+  8039d6:	ff 75 08             	push   0x8(%ebp)
+  8039d9:	e8 43 d6 ff ff       	call   801021 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8039de:	83 c4 20             	add    $0x20,%esp
+  8039e1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8039e4:	75 21                	jne    803a07 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8039e6:	83 ec 04             	sub    $0x4,%esp
+  8039e9:	6a ff                	push   $0xffffffff
+  8039eb:	53                   	push   %ebx
+  8039ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8039ef:	e8 3a d8 ff ff       	call   80122e <sys_futex_wait>
+  8039f4:	83 c4 10             	add    $0x10,%esp
+  8039f7:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8039fa:	74 c7                	je     8039c3 <ipc_try_send_pages+0x6a>
+  8039fc:	85 c0                	test   %eax,%eax
+  8039fe:	79 c3                	jns    8039c3 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803a00:	e8 0c d4 ff ff       	call   800e11 <sys_yield>
+  803a05:	eb bc                	jmp    8039c3 <ipc_try_send_pages+0x6a>
+	}
+}
+  803a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a0a:	5b                   	pop    %ebx
+  803a0b:	5e                   	pop    %esi
+  803a0c:	5f                   	pop    %edi
+  803a0d:	5d                   	pop    %ebp
+  803a0e:	c3                   	ret
+
+00803a0f <ipc_send>:
+{
+  803a0f:	55                   	push   %ebp
+  803a10:	89 e5                	mov    %esp,%ebp
+  803a12:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803a15:	ff 75 14             	push   0x14(%ebp)
+  803a18:	6a 01                	push   $0x1
+  803a1a:	ff 75 10             	push   0x10(%ebp)
+  803a1d:	ff 75 0c             	push   0xc(%ebp)
+  803a20:	ff 75 08             	push   0x8(%ebp)
+  803a23:	e8 31 ff ff ff       	call   803959 <ipc_try_send_pages>
+  803a28:	83 c4 20             	add    $0x20,%esp
+  803a2b:	85 c0                	test   %eax,%eax
+  803a2d:	78 02                	js     803a31 <ipc_send+0x22>
+}
+  803a2f:	c9                   	leave
+  803a30:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803a31:	50                   	push   %eax
+  803a32:	68 ea 41 80 00       	push   $0x8041ea
+  803a37:	6a 3f                	push   $0x3f
+  803a39:	68 ff 41 80 00       	push   $0x8041ff
+  803a3e:	e8 e7 c7 ff ff       	call   80022a <_panic>
+
+00803a43 <ipc_send_pages>:
+{
+  803a43:	55                   	push   %ebp
+  803a44:	89 e5                	mov    %esp,%ebp
+  803a46:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803a49:	ff 75 18             	push   0x18(%ebp)
+  803a4c:	ff 75 14             	push   0x14(%ebp)
+  803a4f:	ff 75 10             	push   0x10(%ebp)
+  803a52:	ff 75 0c             	push   0xc(%ebp)
+  803a55:	ff 75 08             	push   0x8(%ebp)
+  803a58:	e8 fc fe ff ff       	call   803959 <ipc_try_send_pages>
+  803a5d:	83 c4 20             	add    $0x20,%esp
+  803a60:	85 c0                	test   %eax,%eax
+  803a62:	78 02                	js     803a66 <ipc_send_pages+0x23>
+}
+  803a64:	c9                   	leave
+  803a65:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803a66:	50                   	push   %eax
+  803a67:	68 09 42 80 00       	push   $0x804209
+  803a6c:	6a 64                	push   $0x64
+  803a6e:	68 ff 41 80 00       	push   $0x8041ff
+  803a73:	e8 b2 c7 ff ff       	call   80022a <_panic>
+
+00803a78 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803a78:	55                   	push   %ebp
+  803a79:	89 e5                	mov    %esp,%ebp
+  803a7b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803a83:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803a89:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a8f:	8b 52 50             	mov    0x50(%edx),%edx
+  803a92:	39 ca                	cmp    %ecx,%edx
+  803a94:	74 11                	je     803aa7 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803a96:	83 c0 01             	add    $0x1,%eax
+  803a99:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803a9e:	75 e3                	jne    803a83 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa5:	eb 0e                	jmp    803ab5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803aa7:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803aad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ab2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803ab5:	5d                   	pop    %ebp
+  803ab6:	c3                   	ret
+
+00803ab7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803ab7:	55                   	push   %ebp
+  803ab8:	89 e5                	mov    %esp,%ebp
+  803aba:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803abd:	89 c2                	mov    %eax,%edx
+  803abf:	c1 ea 16             	shr    $0x16,%edx
+  803ac2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803ace:	f6 c1 01             	test   $0x1,%cl
+  803ad1:	74 1e                	je     803af1 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803ad3:	c1 e8 0c             	shr    $0xc,%eax
+  803ad6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803add:	a8 01                	test   $0x1,%al
+  803adf:	74 10                	je     803af1 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803ae1:	c1 e8 0c             	shr    $0xc,%eax
+  803ae4:	c1 e0 04             	shl    $0x4,%eax
+  803ae7:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803aee:	0f b7 d2             	movzwl %dx,%edx
+}
+  803af1:	89 d0                	mov    %edx,%eax
+  803af3:	5d                   	pop    %ebp
+  803af4:	c3                   	ret
+
+00803af5 <__udivdi3>:
+  803af5:	57                   	push   %edi
+  803af6:	56                   	push   %esi
+  803af7:	53                   	push   %ebx
+  803af8:	83 ec 20             	sub    $0x20,%esp
+  803afb:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803aff:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803b03:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b07:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b0b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b0f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b13:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803b17:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803b1b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b25:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b2a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803b31:	00 
+  803b32:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803b39:	00 
+  803b3a:	eb 08                	jmp    803b44 <__udivdi3+0x4f>
+  803b3c:	83 e9 01             	sub    $0x1,%ecx
+  803b3f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803b42:	74 68                	je     803bac <__udivdi3+0xb7>
+  803b44:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803b48:	01 c0                	add    %eax,%eax
+  803b4a:	89 c6                	mov    %eax,%esi
+  803b4c:	89 d7                	mov    %edx,%edi
+  803b4e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b52:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b56:	0f ad d0             	shrd   %cl,%edx,%eax
+  803b59:	d3 ea                	shr    %cl,%edx
+  803b5b:	f6 c1 20             	test   $0x20,%cl
+  803b5e:	74 04                	je     803b64 <__udivdi3+0x6f>
+  803b60:	89 d0                	mov    %edx,%eax
+  803b62:	31 d2                	xor    %edx,%edx
+  803b64:	83 e0 01             	and    $0x1,%eax
+  803b67:	89 04 24             	mov    %eax,(%esp)
+  803b6a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803b71:	00 
+  803b72:	8b 04 24             	mov    (%esp),%eax
+  803b75:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803b79:	09 f0                	or     %esi,%eax
+  803b7b:	09 fa                	or     %edi,%edx
+  803b7d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803b81:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803b85:	39 f0                	cmp    %esi,%eax
+  803b87:	89 d3                	mov    %edx,%ebx
+  803b89:	19 fb                	sbb    %edi,%ebx
+  803b8b:	72 af                	jb     803b3c <__udivdi3+0x47>
+  803b8d:	29 f0                	sub    %esi,%eax
+  803b8f:	19 fa                	sbb    %edi,%edx
+  803b91:	89 cf                	mov    %ecx,%edi
+  803b93:	c1 ef 05             	shr    $0x5,%edi
+  803b96:	83 e7 01             	and    $0x1,%edi
+  803b99:	89 fe                	mov    %edi,%esi
+  803b9b:	83 f6 01             	xor    $0x1,%esi
+  803b9e:	d3 e6                	shl    %cl,%esi
+  803ba0:	d3 e7                	shl    %cl,%edi
+  803ba2:	09 74 24 18          	or     %esi,0x18(%esp)
+  803ba6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803baa:	eb 90                	jmp    803b3c <__udivdi3+0x47>
+  803bac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803bb0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803bb4:	83 c4 20             	add    $0x20,%esp
+  803bb7:	5b                   	pop    %ebx
+  803bb8:	5e                   	pop    %esi
+  803bb9:	5f                   	pop    %edi
+  803bba:	c3                   	ret
+
+00803bbb <__umoddi3>:
+  803bbb:	57                   	push   %edi
+  803bbc:	56                   	push   %esi
+  803bbd:	53                   	push   %ebx
+  803bbe:	83 ec 08             	sub    $0x8,%esp
+  803bc1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803bc5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803bc9:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803bcd:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803bd1:	57                   	push   %edi
+  803bd2:	56                   	push   %esi
+  803bd3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803bd7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803bdb:	52                   	push   %edx
+  803bdc:	50                   	push   %eax
+  803bdd:	e8 13 ff ff ff       	call   803af5 <__udivdi3>
+  803be2:	89 c3                	mov    %eax,%ebx
+  803be4:	0f af d6             	imul   %esi,%edx
+  803be7:	89 f9                	mov    %edi,%ecx
+  803be9:	0f af cb             	imul   %ebx,%ecx
+  803bec:	01 d1                	add    %edx,%ecx
+  803bee:	89 d8                	mov    %ebx,%eax
+  803bf0:	f7 e6                	mul    %esi
+  803bf2:	89 c6                	mov    %eax,%esi
+  803bf4:	89 d7                	mov    %edx,%edi
+  803bf6:	01 cf                	add    %ecx,%edi
+  803bf8:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803bfc:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803c00:	29 f0                	sub    %esi,%eax
+  803c02:	19 fa                	sbb    %edi,%edx
+  803c04:	83 c4 18             	add    $0x18,%esp
+  803c07:	5b                   	pop    %ebx
+  803c08:	5e                   	pop    %esi
+  803c09:	5f                   	pop    %edi
+  803c0a:	c3                   	ret
+
+00803c0b <__divdi3>:
+  803c0b:	53                   	push   %ebx
+  803c0c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803c10:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803c14:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803c18:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803c1c:	85 d2                	test   %edx,%edx
+  803c1e:	78 12                	js     803c32 <__divdi3+0x27>
+  803c20:	85 db                	test   %ebx,%ebx
+  803c22:	78 2e                	js     803c52 <__divdi3+0x47>
+  803c24:	53                   	push   %ebx
+  803c25:	51                   	push   %ecx
+  803c26:	52                   	push   %edx
+  803c27:	50                   	push   %eax
+  803c28:	e8 c8 fe ff ff       	call   803af5 <__udivdi3>
+  803c2d:	83 c4 10             	add    $0x10,%esp
+  803c30:	eb 1e                	jmp    803c50 <__divdi3+0x45>
+  803c32:	f7 d8                	neg    %eax
+  803c34:	83 d2 00             	adc    $0x0,%edx
+  803c37:	f7 da                	neg    %edx
+  803c39:	85 db                	test   %ebx,%ebx
+  803c3b:	78 2a                	js     803c67 <__divdi3+0x5c>
+  803c3d:	53                   	push   %ebx
+  803c3e:	51                   	push   %ecx
+  803c3f:	52                   	push   %edx
+  803c40:	50                   	push   %eax
+  803c41:	e8 af fe ff ff       	call   803af5 <__udivdi3>
+  803c46:	83 c4 10             	add    $0x10,%esp
+  803c49:	f7 d8                	neg    %eax
+  803c4b:	83 d2 00             	adc    $0x0,%edx
+  803c4e:	f7 da                	neg    %edx
+  803c50:	5b                   	pop    %ebx
+  803c51:	c3                   	ret
+  803c52:	f7 d9                	neg    %ecx
+  803c54:	83 d3 00             	adc    $0x0,%ebx
+  803c57:	f7 db                	neg    %ebx
+  803c59:	53                   	push   %ebx
+  803c5a:	51                   	push   %ecx
+  803c5b:	52                   	push   %edx
+  803c5c:	50                   	push   %eax
+  803c5d:	e8 93 fe ff ff       	call   803af5 <__udivdi3>
+  803c62:	83 c4 10             	add    $0x10,%esp
+  803c65:	eb e2                	jmp    803c49 <__divdi3+0x3e>
+  803c67:	f7 d9                	neg    %ecx
+  803c69:	83 d3 00             	adc    $0x0,%ebx
+  803c6c:	f7 db                	neg    %ebx
+  803c6e:	53                   	push   %ebx
+  803c6f:	51                   	push   %ecx
+  803c70:	52                   	push   %edx
+  803c71:	50                   	push   %eax
+  803c72:	e8 7e fe ff ff       	call   803af5 <__udivdi3>
+  803c77:	83 c4 10             	add    $0x10,%esp
+  803c7a:	eb d4                	jmp    803c50 <__divdi3+0x45>
+
+00803c7c <__moddi3>:
+  803c7c:	57                   	push   %edi
+  803c7d:	56                   	push   %esi
+  803c7e:	53                   	push   %ebx
+  803c7f:	83 ec 08             	sub    $0x8,%esp
+  803c82:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c86:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c8a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803c8e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803c92:	57                   	push   %edi
+  803c93:	56                   	push   %esi
+  803c94:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c98:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c9c:	52                   	push   %edx
+  803c9d:	50                   	push   %eax
+  803c9e:	e8 68 ff ff ff       	call   803c0b <__divdi3>
+  803ca3:	89 c3                	mov    %eax,%ebx
+  803ca5:	0f af d6             	imul   %esi,%edx
+  803ca8:	89 f9                	mov    %edi,%ecx
+  803caa:	0f af cb             	imul   %ebx,%ecx
+  803cad:	01 d1                	add    %edx,%ecx
+  803caf:	89 d8                	mov    %ebx,%eax
+  803cb1:	f7 e6                	mul    %esi
+  803cb3:	89 c6                	mov    %eax,%esi
+  803cb5:	89 d7                	mov    %edx,%edi
+  803cb7:	01 cf                	add    %ecx,%edi
+  803cb9:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803cbd:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803cc1:	29 f0                	sub    %esi,%eax
+  803cc3:	19 fa                	sbb    %edi,%edx
+  803cc5:	83 c4 18             	add    $0x18,%esp
+  803cc8:	5b                   	pop    %ebx
+  803cc9:	5e                   	pop    %esi
+  803cca:	5f                   	pop    %edi
+  803ccb:	c3                   	ret
@@ -0,0 +1,9031 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 91 00 00 00       	call   8000c2 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003e:	e8 ee 12 00 00       	call   801331 <fork>
+  800043:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800046:	85 c0                	test   %eax,%eax
+  800048:	75 4f                	jne    800099 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  80004a:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004d:	83 ec 04             	sub    $0x4,%esp
+  800050:	6a 00                	push   $0x0
+  800052:	6a 00                	push   $0x0
+  800054:	56                   	push   %esi
+  800055:	e8 ae 18 00 00       	call   801908 <ipc_recv>
+  80005a:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005f:	e8 87 0c 00 00       	call   800ceb <sys_getenvid>
+  800064:	57                   	push   %edi
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 76 44 80 00       	push   $0x804476
+  80006c:	e8 8d 01 00 00       	call   8001fe <cprintf>
+		if (i == 10)
+  800071:	83 c4 20             	add    $0x20,%esp
+  800074:	83 fb 0a             	cmp    $0xa,%ebx
+  800077:	74 18                	je     800091 <umain+0x5c>
+			return;
+		i++;
+  800079:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007c:	6a 00                	push   $0x0
+  80007e:	6a 00                	push   $0x0
+  800080:	53                   	push   %ebx
+  800081:	ff 75 e4             	push   -0x1c(%ebp)
+  800084:	e8 0f 1b 00 00       	call   801b98 <ipc_send>
+		if (i == 10)
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	83 fb 0a             	cmp    $0xa,%ebx
+  80008f:	75 bc                	jne    80004d <umain+0x18>
+			return;
+	}
+
+}
+  800091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800094:	5b                   	pop    %ebx
+  800095:	5e                   	pop    %esi
+  800096:	5f                   	pop    %edi
+  800097:	5d                   	pop    %ebp
+  800098:	c3                   	ret
+  800099:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80009b:	e8 4b 0c 00 00       	call   800ceb <sys_getenvid>
+  8000a0:	83 ec 04             	sub    $0x4,%esp
+  8000a3:	53                   	push   %ebx
+  8000a4:	50                   	push   %eax
+  8000a5:	68 60 44 80 00       	push   $0x804460
+  8000aa:	e8 4f 01 00 00       	call   8001fe <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	6a 00                	push   $0x0
+  8000b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b8:	e8 db 1a 00 00       	call   801b98 <ipc_send>
+  8000bd:	83 c4 20             	add    $0x20,%esp
+  8000c0:	eb 88                	jmp    80004a <umain+0x15>
+
+008000c2 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c2:	55                   	push   %ebp
+  8000c3:	89 e5                	mov    %esp,%ebp
+  8000c5:	56                   	push   %esi
+  8000c6:	53                   	push   %ebx
+  8000c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000cd:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000cf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000d4:	29 d0                	sub    %edx,%eax
+  8000d6:	89 c2                	mov    %eax,%edx
+  8000d8:	c1 ea 0f             	shr    $0xf,%edx
+  8000db:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e5:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8000e8:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  8000ef:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8000f3:	e8 f3 0b 00 00       	call   800ceb <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8000f8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000fd:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800103:	89 e1                	mov    %esp,%ecx
+  800105:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80010a:	29 ca                	sub    %ecx,%edx
+  80010c:	89 d1                	mov    %edx,%ecx
+  80010e:	c1 e9 0f             	shr    $0xf,%ecx
+  800111:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800117:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011c:	0f 42 d1             	cmovb  %ecx,%edx
+  80011f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800124:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80012b:	85 db                	test   %ebx,%ebx
+  80012d:	7e 07                	jle    800136 <libmain+0x74>
+		binaryname = argv[0];
+  80012f:	8b 06                	mov    (%esi),%eax
+  800131:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800136:	83 ec 08             	sub    $0x8,%esp
+  800139:	56                   	push   %esi
+  80013a:	53                   	push   %ebx
+  80013b:	e8 f5 fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800140:	e8 0a 00 00 00       	call   80014f <exit>
+}
+  800145:	83 c4 10             	add    $0x10,%esp
+  800148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80014b:	5b                   	pop    %ebx
+  80014c:	5e                   	pop    %esi
+  80014d:	5d                   	pop    %ebp
+  80014e:	c3                   	ret
+
+0080014f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80014f:	55                   	push   %ebp
+  800150:	89 e5                	mov    %esp,%ebp
+  800152:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800155:	e8 cf 1c 00 00       	call   801e29 <close_all>
+	sys_env_destroy(0);
+  80015a:	83 ec 0c             	sub    $0xc,%esp
+  80015d:	6a 00                	push   $0x0
+  80015f:	e8 46 0b 00 00       	call   800caa <sys_env_destroy>
+}
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	c9                   	leave
+  800168:	c3                   	ret
+
+00800169 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800169:	55                   	push   %ebp
+  80016a:	89 e5                	mov    %esp,%ebp
+  80016c:	53                   	push   %ebx
+  80016d:	83 ec 04             	sub    $0x4,%esp
+  800170:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800173:	8b 13                	mov    (%ebx),%edx
+  800175:	8d 42 01             	lea    0x1(%edx),%eax
+  800178:	89 03                	mov    %eax,(%ebx)
+  80017a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80017d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800181:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800186:	74 09                	je     800191 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800188:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80018c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800191:	83 ec 08             	sub    $0x8,%esp
+  800194:	68 ff 00 00 00       	push   $0xff
+  800199:	8d 43 08             	lea    0x8(%ebx),%eax
+  80019c:	50                   	push   %eax
+  80019d:	e8 cb 0a 00 00       	call   800c6d <sys_cputs>
+		b->idx = 0;
+  8001a2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a8:	83 c4 10             	add    $0x10,%esp
+  8001ab:	eb db                	jmp    800188 <putch+0x1f>
+
+008001ad <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001b6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001bd:	00 00 00 
+	b.cnt = 0;
+  8001c0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001ca:	ff 75 0c             	push   0xc(%ebp)
+  8001cd:	ff 75 08             	push   0x8(%ebp)
+  8001d0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d6:	50                   	push   %eax
+  8001d7:	68 69 01 80 00       	push   $0x800169
+  8001dc:	e8 1c 01 00 00       	call   8002fd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001e1:	83 c4 08             	add    $0x8,%esp
+  8001e4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001ea:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001f0:	50                   	push   %eax
+  8001f1:	e8 77 0a 00 00       	call   800c6d <sys_cputs>
+
+	return b.cnt;
+}
+  8001f6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001fc:	c9                   	leave
+  8001fd:	c3                   	ret
+
+008001fe <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001fe:	55                   	push   %ebp
+  8001ff:	89 e5                	mov    %esp,%ebp
+  800201:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800204:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800207:	50                   	push   %eax
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 9d ff ff ff       	call   8001ad <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800210:	c9                   	leave
+  800211:	c3                   	ret
+
+00800212 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800212:	55                   	push   %ebp
+  800213:	89 e5                	mov    %esp,%ebp
+  800215:	57                   	push   %edi
+  800216:	56                   	push   %esi
+  800217:	53                   	push   %ebx
+  800218:	83 ec 1c             	sub    $0x1c,%esp
+  80021b:	89 c3                	mov    %eax,%ebx
+  80021d:	89 d6                	mov    %edx,%esi
+  80021f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800222:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800225:	89 d1                	mov    %edx,%ecx
+  800227:	89 c2                	mov    %eax,%edx
+  800229:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80022c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80022f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800232:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800235:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80023c:	39 c2                	cmp    %eax,%edx
+  80023e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800241:	73 4b                	jae    80028e <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800243:	8b 45 14             	mov    0x14(%ebp),%eax
+  800246:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800249:	85 ff                	test   %edi,%edi
+  80024b:	7e 11                	jle    80025e <printnum+0x4c>
+			putch(padc, putdat);
+  80024d:	83 ec 08             	sub    $0x8,%esp
+  800250:	56                   	push   %esi
+  800251:	ff 75 18             	push   0x18(%ebp)
+  800254:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800256:	83 c4 10             	add    $0x10,%esp
+  800259:	83 ef 01             	sub    $0x1,%edi
+  80025c:	75 ef                	jne    80024d <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80025e:	83 ec 08             	sub    $0x8,%esp
+  800261:	56                   	push   %esi
+  800262:	83 ec 04             	sub    $0x4,%esp
+  800265:	ff 75 e4             	push   -0x1c(%ebp)
+  800268:	ff 75 e0             	push   -0x20(%ebp)
+  80026b:	ff 75 dc             	push   -0x24(%ebp)
+  80026e:	ff 75 d8             	push   -0x28(%ebp)
+  800271:	e8 d3 40 00 00       	call   804349 <__umoddi3>
+  800276:	83 c4 14             	add    $0x14,%esp
+  800279:	0f be 80 93 44 80 00 	movsbl 0x804493(%eax),%eax
+  800280:	50                   	push   %eax
+  800281:	ff d3                	call   *%ebx
+}
+  800283:	83 c4 10             	add    $0x10,%esp
+  800286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800289:	5b                   	pop    %ebx
+  80028a:	5e                   	pop    %esi
+  80028b:	5f                   	pop    %edi
+  80028c:	5d                   	pop    %ebp
+  80028d:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80028e:	83 ec 0c             	sub    $0xc,%esp
+  800291:	ff 75 18             	push   0x18(%ebp)
+  800294:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800297:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80029a:	52                   	push   %edx
+  80029b:	50                   	push   %eax
+  80029c:	83 ec 08             	sub    $0x8,%esp
+  80029f:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a2:	ff 75 e0             	push   -0x20(%ebp)
+  8002a5:	ff 75 dc             	push   -0x24(%ebp)
+  8002a8:	ff 75 d8             	push   -0x28(%ebp)
+  8002ab:	e8 d3 3f 00 00       	call   804283 <__udivdi3>
+  8002b0:	83 c4 18             	add    $0x18,%esp
+  8002b3:	52                   	push   %edx
+  8002b4:	50                   	push   %eax
+  8002b5:	89 f2                	mov    %esi,%edx
+  8002b7:	89 d8                	mov    %ebx,%eax
+  8002b9:	e8 54 ff ff ff       	call   800212 <printnum>
+  8002be:	83 c4 20             	add    $0x20,%esp
+  8002c1:	eb 9b                	jmp    80025e <printnum+0x4c>
+
+008002c3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c3:	55                   	push   %ebp
+  8002c4:	89 e5                	mov    %esp,%ebp
+  8002c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002c9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002cd:	8b 10                	mov    (%eax),%edx
+  8002cf:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d2:	73 0a                	jae    8002de <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d7:	89 08                	mov    %ecx,(%eax)
+  8002d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dc:	88 02                	mov    %al,(%edx)
+}
+  8002de:	5d                   	pop    %ebp
+  8002df:	c3                   	ret
+
+008002e0 <printfmt>:
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002e9:	50                   	push   %eax
+  8002ea:	ff 75 10             	push   0x10(%ebp)
+  8002ed:	ff 75 0c             	push   0xc(%ebp)
+  8002f0:	ff 75 08             	push   0x8(%ebp)
+  8002f3:	e8 05 00 00 00       	call   8002fd <vprintfmt>
+}
+  8002f8:	83 c4 10             	add    $0x10,%esp
+  8002fb:	c9                   	leave
+  8002fc:	c3                   	ret
+
+008002fd <vprintfmt>:
+{
+  8002fd:	55                   	push   %ebp
+  8002fe:	89 e5                	mov    %esp,%ebp
+  800300:	57                   	push   %edi
+  800301:	56                   	push   %esi
+  800302:	53                   	push   %ebx
+  800303:	83 ec 2c             	sub    $0x2c,%esp
+  800306:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800309:	89 df                	mov    %ebx,%edi
+  80030b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80030e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800311:	8d 70 01             	lea    0x1(%eax),%esi
+  800314:	0f b6 00             	movzbl (%eax),%eax
+  800317:	83 f8 25             	cmp    $0x25,%eax
+  80031a:	74 1e                	je     80033a <vprintfmt+0x3d>
+			if (ch == '\0')
+  80031c:	85 c0                	test   %eax,%eax
+  80031e:	0f 84 15 05 00 00    	je     800839 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800324:	83 ec 08             	sub    $0x8,%esp
+  800327:	53                   	push   %ebx
+  800328:	50                   	push   %eax
+  800329:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80032b:	83 c6 01             	add    $0x1,%esi
+  80032e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800332:	83 c4 10             	add    $0x10,%esp
+  800335:	83 f8 25             	cmp    $0x25,%eax
+  800338:	75 e2                	jne    80031c <vprintfmt+0x1f>
+		padc = ' ';
+  80033a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80033e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800345:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80034c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800353:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800358:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80035b:	8d 56 01             	lea    0x1(%esi),%edx
+  80035e:	0f b6 0e             	movzbl (%esi),%ecx
+  800361:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800364:	3c 55                	cmp    $0x55,%al
+  800366:	0f 87 3b 04 00 00    	ja     8007a7 <vprintfmt+0x4aa>
+  80036c:	0f b6 c0             	movzbl %al,%eax
+  80036f:	ff 24 85 00 46 80 00 	jmp    *0x804600(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800376:	89 75 10             	mov    %esi,0x10(%ebp)
+  800379:	eb 93                	jmp    80030e <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037b:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80037d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800381:	eb d8                	jmp    80035b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800383:	89 d6                	mov    %edx,%esi
+  800385:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800389:	eb d0                	jmp    80035b <vprintfmt+0x5e>
+  80038b:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80038e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800391:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800394:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800398:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80039b:	83 f9 09             	cmp    $0x9,%ecx
+  80039e:	77 6f                	ja     80040f <vprintfmt+0x112>
+  8003a0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8003a3:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8003a6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003a9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003ad:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8003b0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003b3:	83 fe 09             	cmp    $0x9,%esi
+  8003b6:	76 eb                	jbe    8003a3 <vprintfmt+0xa6>
+  8003b8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8003bb:	89 d6                	mov    %edx,%esi
+  8003bd:	eb 13                	jmp    8003d2 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8003bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c2:	8b 00                	mov    (%eax),%eax
+  8003c4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8003cd:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d0:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8003d2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003d6:	79 83                	jns    80035b <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8003d8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003de:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003e5:	e9 71 ff ff ff       	jmp    80035b <vprintfmt+0x5e>
+			if (width < 0)
+  8003ea:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ed:	85 c9                	test   %ecx,%ecx
+  8003ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f4:	0f 49 c1             	cmovns %ecx,%eax
+  8003f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fa:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003fc:	e9 5a ff ff ff       	jmp    80035b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800401:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800403:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80040a:	e9 4c ff ff ff       	jmp    80035b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040f:	89 d6                	mov    %edx,%esi
+  800411:	eb bf                	jmp    8003d2 <vprintfmt+0xd5>
+			lflag++;
+  800413:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800417:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800419:	e9 3d ff ff ff       	jmp    80035b <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80041e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8d 70 04             	lea    0x4(%eax),%esi
+  800427:	83 ec 08             	sub    $0x8,%esp
+  80042a:	53                   	push   %ebx
+  80042b:	ff 30                	push   (%eax)
+  80042d:	ff d7                	call   *%edi
+			break;
+  80042f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800432:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800435:	e9 d4 fe ff ff       	jmp    80030e <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80043a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80043d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800440:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800443:	8b 10                	mov    (%eax),%edx
+  800445:	89 d0                	mov    %edx,%eax
+  800447:	f7 d8                	neg    %eax
+  800449:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80044c:	83 f8 12             	cmp    $0x12,%eax
+  80044f:	7f 23                	jg     800474 <vprintfmt+0x177>
+  800451:	8b 14 85 60 47 80 00 	mov    0x804760(,%eax,4),%edx
+  800458:	85 d2                	test   %edx,%edx
+  80045a:	74 18                	je     800474 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80045c:	52                   	push   %edx
+  80045d:	68 ef 49 80 00       	push   $0x8049ef
+  800462:	53                   	push   %ebx
+  800463:	57                   	push   %edi
+  800464:	e8 77 fe ff ff       	call   8002e0 <printfmt>
+  800469:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80046f:	e9 9a fe ff ff       	jmp    80030e <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800474:	50                   	push   %eax
+  800475:	68 ab 44 80 00       	push   $0x8044ab
+  80047a:	53                   	push   %ebx
+  80047b:	57                   	push   %edi
+  80047c:	e8 5f fe ff ff       	call   8002e0 <printfmt>
+  800481:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800484:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800487:	e9 82 fe ff ff       	jmp    80030e <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80048c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80048f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800492:	83 c0 04             	add    $0x4,%eax
+  800495:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800498:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049b:	8b 00                	mov    (%eax),%eax
+  80049d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004a0:	85 c0                	test   %eax,%eax
+  8004a2:	0f 84 61 03 00 00    	je     800809 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8004a8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004ac:	7e 06                	jle    8004b4 <vprintfmt+0x1b7>
+  8004ae:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004b2:	75 29                	jne    8004dd <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004b4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004b7:	8d 70 01             	lea    0x1(%eax),%esi
+  8004ba:	0f b6 00             	movzbl (%eax),%eax
+  8004bd:	0f be d0             	movsbl %al,%edx
+  8004c0:	85 d2                	test   %edx,%edx
+  8004c2:	0f 84 bb 00 00 00    	je     800583 <vprintfmt+0x286>
+  8004c8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004cb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004ce:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004d1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004d4:	eb 7a                	jmp    800550 <vprintfmt+0x253>
+				p = "(null)";
+  8004d6:	c7 45 d0 a4 44 80 00 	movl   $0x8044a4,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004dd:	83 ec 08             	sub    $0x8,%esp
+  8004e0:	ff 75 d4             	push   -0x2c(%ebp)
+  8004e3:	ff 75 d0             	push   -0x30(%ebp)
+  8004e6:	e8 e0 03 00 00       	call   8008cb <strnlen>
+  8004eb:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004ee:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004f1:	83 c4 10             	add    $0x10,%esp
+  8004f4:	85 d2                	test   %edx,%edx
+  8004f6:	0f 8e d6 02 00 00    	jle    8007d2 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8004fc:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800500:	83 ec 08             	sub    $0x8,%esp
+  800503:	53                   	push   %ebx
+  800504:	56                   	push   %esi
+  800505:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800507:	83 c4 10             	add    $0x10,%esp
+  80050a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80050e:	75 f0                	jne    800500 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800510:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800513:	8d 70 01             	lea    0x1(%eax),%esi
+  800516:	0f b6 00             	movzbl (%eax),%eax
+  800519:	0f be d0             	movsbl %al,%edx
+  80051c:	85 d2                	test   %edx,%edx
+  80051e:	0f 84 da 02 00 00    	je     8007fe <vprintfmt+0x501>
+  800524:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800527:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80052a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80052d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800530:	eb 1e                	jmp    800550 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	ff 75 0c             	push   0xc(%ebp)
+  800538:	52                   	push   %edx
+  800539:	ff 55 08             	call   *0x8(%ebp)
+  80053c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80053f:	83 eb 01             	sub    $0x1,%ebx
+  800542:	83 c6 01             	add    $0x1,%esi
+  800545:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800549:	0f be d0             	movsbl %al,%edx
+  80054c:	85 d2                	test   %edx,%edx
+  80054e:	74 2a                	je     80057a <vprintfmt+0x27d>
+  800550:	85 ff                	test   %edi,%edi
+  800552:	78 05                	js     800559 <vprintfmt+0x25c>
+  800554:	83 ef 01             	sub    $0x1,%edi
+  800557:	78 59                	js     8005b2 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800559:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80055d:	74 d3                	je     800532 <vprintfmt+0x235>
+  80055f:	0f be c0             	movsbl %al,%eax
+  800562:	83 e8 20             	sub    $0x20,%eax
+  800565:	83 f8 5e             	cmp    $0x5e,%eax
+  800568:	76 c8                	jbe    800532 <vprintfmt+0x235>
+					putch('?', putdat);
+  80056a:	83 ec 08             	sub    $0x8,%esp
+  80056d:	ff 75 0c             	push   0xc(%ebp)
+  800570:	6a 3f                	push   $0x3f
+  800572:	ff 55 08             	call   *0x8(%ebp)
+  800575:	83 c4 10             	add    $0x10,%esp
+  800578:	eb c5                	jmp    80053f <vprintfmt+0x242>
+  80057a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80057d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800580:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800583:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800586:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80058a:	7e 1b                	jle    8005a7 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	53                   	push   %ebx
+  800590:	6a 20                	push   $0x20
+  800592:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800594:	83 c4 10             	add    $0x10,%esp
+  800597:	83 ee 01             	sub    $0x1,%esi
+  80059a:	75 f0                	jne    80058c <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80059c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a2:	e9 67 fd ff ff       	jmp    80030e <vprintfmt+0x11>
+  8005a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ad:	e9 5c fd ff ff       	jmp    80030e <vprintfmt+0x11>
+  8005b2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005bb:	eb c6                	jmp    800583 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8005bd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005c0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005c3:	83 f9 01             	cmp    $0x1,%ecx
+  8005c6:	7f 1f                	jg     8005e7 <vprintfmt+0x2ea>
+	else if (lflag)
+  8005c8:	85 c9                	test   %ecx,%ecx
+  8005ca:	74 67                	je     800633 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8005cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cf:	8b 30                	mov    (%eax),%esi
+  8005d1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005d4:	89 f0                	mov    %esi,%eax
+  8005d6:	c1 f8 1f             	sar    $0x1f,%eax
+  8005d9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005df:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e5:	eb 17                	jmp    8005fe <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ed:	8b 00                	mov    (%eax),%eax
+  8005ef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005fe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800601:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800604:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800609:	85 c9                	test   %ecx,%ecx
+  80060b:	0f 89 12 01 00 00    	jns    800723 <vprintfmt+0x426>
+				putch('-', putdat);
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	53                   	push   %ebx
+  800615:	6a 2d                	push   $0x2d
+  800617:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800619:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80061c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80061f:	f7 da                	neg    %edx
+  800621:	83 d1 00             	adc    $0x0,%ecx
+  800624:	f7 d9                	neg    %ecx
+  800626:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800629:	be 0a 00 00 00       	mov    $0xa,%esi
+  80062e:	e9 f0 00 00 00       	jmp    800723 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800633:	8b 45 14             	mov    0x14(%ebp),%eax
+  800636:	8b 30                	mov    (%eax),%esi
+  800638:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80063b:	89 f0                	mov    %esi,%eax
+  80063d:	c1 f8 1f             	sar    $0x1f,%eax
+  800640:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8d 40 04             	lea    0x4(%eax),%eax
+  800649:	89 45 14             	mov    %eax,0x14(%ebp)
+  80064c:	eb b0                	jmp    8005fe <vprintfmt+0x301>
+	if (lflag >= 2)
+  80064e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800651:	89 55 10             	mov    %edx,0x10(%ebp)
+  800654:	83 f9 01             	cmp    $0x1,%ecx
+  800657:	7f 1e                	jg     800677 <vprintfmt+0x37a>
+	else if (lflag)
+  800659:	85 c9                	test   %ecx,%ecx
+  80065b:	74 32                	je     80068f <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	8b 10                	mov    (%eax),%edx
+  800662:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800667:	8d 40 04             	lea    0x4(%eax),%eax
+  80066a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066d:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800672:	e9 ac 00 00 00       	jmp    800723 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 10                	mov    (%eax),%edx
+  80067c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067f:	8d 40 08             	lea    0x8(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800685:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80068a:	e9 94 00 00 00       	jmp    800723 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80068f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800692:	8b 10                	mov    (%eax),%edx
+  800694:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800699:	8d 40 04             	lea    0x4(%eax),%eax
+  80069c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8006a4:	eb 7d                	jmp    800723 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8006a6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ac:	83 f9 01             	cmp    $0x1,%ecx
+  8006af:	7f 1b                	jg     8006cc <vprintfmt+0x3cf>
+	else if (lflag)
+  8006b1:	85 c9                	test   %ecx,%ecx
+  8006b3:	74 2c                	je     8006e1 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8b 10                	mov    (%eax),%edx
+  8006ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c5:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8006ca:	eb 57                	jmp    800723 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 10                	mov    (%eax),%edx
+  8006d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006da:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8006df:	eb 42                	jmp    800723 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 10                	mov    (%eax),%edx
+  8006e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8006f6:	eb 2b                	jmp    800723 <vprintfmt+0x426>
+			putch('0', putdat);
+  8006f8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006fb:	83 ec 08             	sub    $0x8,%esp
+  8006fe:	53                   	push   %ebx
+  8006ff:	6a 30                	push   $0x30
+  800701:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800703:	83 c4 08             	add    $0x8,%esp
+  800706:	53                   	push   %ebx
+  800707:	6a 78                	push   $0x78
+  800709:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 10                	mov    (%eax),%edx
+  800710:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800715:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800718:	8d 40 04             	lea    0x4(%eax),%eax
+  80071b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071e:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800723:	83 ec 0c             	sub    $0xc,%esp
+  800726:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80072a:	50                   	push   %eax
+  80072b:	ff 75 e4             	push   -0x1c(%ebp)
+  80072e:	56                   	push   %esi
+  80072f:	51                   	push   %ecx
+  800730:	52                   	push   %edx
+  800731:	89 da                	mov    %ebx,%edx
+  800733:	89 f8                	mov    %edi,%eax
+  800735:	e8 d8 fa ff ff       	call   800212 <printnum>
+			break;
+  80073a:	83 c4 20             	add    $0x20,%esp
+  80073d:	e9 cc fb ff ff       	jmp    80030e <vprintfmt+0x11>
+	if (lflag >= 2)
+  800742:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800745:	89 55 10             	mov    %edx,0x10(%ebp)
+  800748:	83 f9 01             	cmp    $0x1,%ecx
+  80074b:	7f 1b                	jg     800768 <vprintfmt+0x46b>
+	else if (lflag)
+  80074d:	85 c9                	test   %ecx,%ecx
+  80074f:	74 2c                	je     80077d <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8b 10                	mov    (%eax),%edx
+  800756:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800761:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800766:	eb bb                	jmp    800723 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 10                	mov    (%eax),%edx
+  80076d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800770:	8d 40 08             	lea    0x8(%eax),%eax
+  800773:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800776:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80077b:	eb a6                	jmp    800723 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8b 10                	mov    (%eax),%edx
+  800782:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800787:	8d 40 04             	lea    0x4(%eax),%eax
+  80078a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800792:	eb 8f                	jmp    800723 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800794:	89 55 10             	mov    %edx,0x10(%ebp)
+  800797:	83 ec 08             	sub    $0x8,%esp
+  80079a:	53                   	push   %ebx
+  80079b:	6a 25                	push   $0x25
+  80079d:	ff d7                	call   *%edi
+			break;
+  80079f:	83 c4 10             	add    $0x10,%esp
+  8007a2:	e9 67 fb ff ff       	jmp    80030e <vprintfmt+0x11>
+			putch('%', putdat);
+  8007a7:	83 ec 08             	sub    $0x8,%esp
+  8007aa:	53                   	push   %ebx
+  8007ab:	6a 25                	push   $0x25
+  8007ad:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007af:	83 c4 10             	add    $0x10,%esp
+  8007b2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007b6:	0f 84 ba fb ff ff    	je     800376 <vprintfmt+0x79>
+  8007bc:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007bf:	89 f0                	mov    %esi,%eax
+  8007c1:	83 e8 01             	sub    $0x1,%eax
+  8007c4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007c8:	75 f7                	jne    8007c1 <vprintfmt+0x4c4>
+  8007ca:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007cd:	e9 3c fb ff ff       	jmp    80030e <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007d5:	8d 70 01             	lea    0x1(%eax),%esi
+  8007d8:	0f b6 00             	movzbl (%eax),%eax
+  8007db:	0f be d0             	movsbl %al,%edx
+  8007de:	85 d2                	test   %edx,%edx
+  8007e0:	74 11                	je     8007f3 <vprintfmt+0x4f6>
+  8007e2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007e5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007e8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007ee:	e9 5d fd ff ff       	jmp    800550 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007f3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f9:	e9 10 fb ff ff       	jmp    80030e <vprintfmt+0x11>
+  8007fe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800801:	89 45 14             	mov    %eax,0x14(%ebp)
+  800804:	e9 05 fb ff ff       	jmp    80030e <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800809:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80080d:	7e 0a                	jle    800819 <vprintfmt+0x51c>
+  80080f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800813:	0f 85 bd fc ff ff    	jne    8004d6 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800819:	ba 28 00 00 00       	mov    $0x28,%edx
+  80081e:	b8 28 00 00 00       	mov    $0x28,%eax
+  800823:	be a5 44 80 00       	mov    $0x8044a5,%esi
+  800828:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80082b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80082e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800831:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800834:	e9 17 fd ff ff       	jmp    800550 <vprintfmt+0x253>
+}
+  800839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80083c:	5b                   	pop    %ebx
+  80083d:	5e                   	pop    %esi
+  80083e:	5f                   	pop    %edi
+  80083f:	5d                   	pop    %ebp
+  800840:	c3                   	ret
+
+00800841 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	83 ec 18             	sub    $0x18,%esp
+  800847:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80084d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800850:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800854:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800857:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80085e:	85 c0                	test   %eax,%eax
+  800860:	74 26                	je     800888 <vsnprintf+0x47>
+  800862:	85 d2                	test   %edx,%edx
+  800864:	7e 22                	jle    800888 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800866:	ff 75 14             	push   0x14(%ebp)
+  800869:	ff 75 10             	push   0x10(%ebp)
+  80086c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80086f:	50                   	push   %eax
+  800870:	68 c3 02 80 00       	push   $0x8002c3
+  800875:	e8 83 fa ff ff       	call   8002fd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80087a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80087d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800880:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800883:	83 c4 10             	add    $0x10,%esp
+}
+  800886:	c9                   	leave
+  800887:	c3                   	ret
+		return -E_INVAL;
+  800888:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80088d:	eb f7                	jmp    800886 <vsnprintf+0x45>
+
+0080088f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800895:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800898:	50                   	push   %eax
+  800899:	ff 75 10             	push   0x10(%ebp)
+  80089c:	ff 75 0c             	push   0xc(%ebp)
+  80089f:	ff 75 08             	push   0x8(%ebp)
+  8008a2:	e8 9a ff ff ff       	call   800841 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+
+008008a9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008af:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008b2:	74 10                	je     8008c4 <strlen+0x1b>
+  8008b4:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8008b9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008bc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008c0:	75 f7                	jne    8008b9 <strlen+0x10>
+	return n;
+}
+  8008c2:	5d                   	pop    %ebp
+  8008c3:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8008c4:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8008c9:	eb f7                	jmp    8008c2 <strlen+0x19>
+
+008008cb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d4:	85 d2                	test   %edx,%edx
+  8008d6:	74 16                	je     8008ee <strnlen+0x23>
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008e1:	74 09                	je     8008ec <strnlen+0x21>
+		n++;
+  8008e3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e6:	39 d0                	cmp    %edx,%eax
+  8008e8:	75 f3                	jne    8008dd <strnlen+0x12>
+		n++;
+  8008ea:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8008ec:	5d                   	pop    %ebp
+  8008ed:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f3:	eb f7                	jmp    8008ec <strnlen+0x21>
+
+008008f5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f5:	55                   	push   %ebp
+  8008f6:	89 e5                	mov    %esp,%ebp
+  8008f8:	53                   	push   %ebx
+  8008f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800908:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090b:	83 c0 01             	add    $0x1,%eax
+  80090e:	84 d2                	test   %dl,%dl
+  800910:	75 f2                	jne    800904 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800912:	89 c8                	mov    %ecx,%eax
+  800914:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800917:	c9                   	leave
+  800918:	c3                   	ret
+
+00800919 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	53                   	push   %ebx
+  80091d:	83 ec 10             	sub    $0x10,%esp
+  800920:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800923:	53                   	push   %ebx
+  800924:	e8 80 ff ff ff       	call   8008a9 <strlen>
+  800929:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092c:	ff 75 0c             	push   0xc(%ebp)
+  80092f:	01 d8                	add    %ebx,%eax
+  800931:	50                   	push   %eax
+  800932:	e8 be ff ff ff       	call   8008f5 <strcpy>
+	return dst;
+}
+  800937:	89 d8                	mov    %ebx,%eax
+  800939:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093c:	c9                   	leave
+  80093d:	c3                   	ret
+
+0080093e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80093e:	55                   	push   %ebp
+  80093f:	89 e5                	mov    %esp,%ebp
+  800941:	56                   	push   %esi
+  800942:	53                   	push   %ebx
+  800943:	8b 75 08             	mov    0x8(%ebp),%esi
+  800946:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800949:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094c:	85 db                	test   %ebx,%ebx
+  80094e:	74 17                	je     800967 <strncpy+0x29>
+  800950:	01 f3                	add    %esi,%ebx
+  800952:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800954:	83 c0 01             	add    $0x1,%eax
+  800957:	0f b6 0a             	movzbl (%edx),%ecx
+  80095a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095d:	80 f9 01             	cmp    $0x1,%cl
+  800960:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800963:	39 c3                	cmp    %eax,%ebx
+  800965:	75 ed                	jne    800954 <strncpy+0x16>
+	}
+	return ret;
+}
+  800967:	89 f0                	mov    %esi,%eax
+  800969:	5b                   	pop    %ebx
+  80096a:	5e                   	pop    %esi
+  80096b:	5d                   	pop    %ebp
+  80096c:	c3                   	ret
+
+0080096d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	56                   	push   %esi
+  800971:	53                   	push   %ebx
+  800972:	8b 75 08             	mov    0x8(%ebp),%esi
+  800975:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800978:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097b:	89 f0                	mov    %esi,%eax
+  80097d:	85 db                	test   %ebx,%ebx
+  80097f:	74 1e                	je     80099f <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800981:	83 eb 01             	sub    $0x1,%ebx
+  800984:	74 16                	je     80099c <strlcpy+0x2f>
+  800986:	01 f3                	add    %esi,%ebx
+  800988:	0f b6 0a             	movzbl (%edx),%ecx
+  80098b:	84 c9                	test   %cl,%cl
+  80098d:	74 0d                	je     80099c <strlcpy+0x2f>
+			*dst++ = *src++;
+  80098f:	83 c2 01             	add    $0x1,%edx
+  800992:	83 c0 01             	add    $0x1,%eax
+  800995:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800998:	39 d8                	cmp    %ebx,%eax
+  80099a:	75 ec                	jne    800988 <strlcpy+0x1b>
+		*dst = '\0';
+  80099c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80099f:	29 f0                	sub    %esi,%eax
+}
+  8009a1:	5b                   	pop    %ebx
+  8009a2:	5e                   	pop    %esi
+  8009a3:	5d                   	pop    %ebp
+  8009a4:	c3                   	ret
+
+008009a5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ae:	0f b6 01             	movzbl (%ecx),%eax
+  8009b1:	84 c0                	test   %al,%al
+  8009b3:	74 11                	je     8009c6 <strcmp+0x21>
+  8009b5:	38 02                	cmp    %al,(%edx)
+  8009b7:	75 0d                	jne    8009c6 <strcmp+0x21>
+		p++, q++;
+  8009b9:	83 c1 01             	add    $0x1,%ecx
+  8009bc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009bf:	0f b6 01             	movzbl (%ecx),%eax
+  8009c2:	84 c0                	test   %al,%al
+  8009c4:	75 ef                	jne    8009b5 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c6:	0f b6 c0             	movzbl %al,%eax
+  8009c9:	0f b6 12             	movzbl (%edx),%edx
+  8009cc:	29 d0                	sub    %edx,%eax
+}
+  8009ce:	5d                   	pop    %ebp
+  8009cf:	c3                   	ret
+
+008009d0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009d0:	55                   	push   %ebp
+  8009d1:	89 e5                	mov    %esp,%ebp
+  8009d3:	53                   	push   %ebx
+  8009d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009da:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8009dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8009e2:	85 d2                	test   %edx,%edx
+  8009e4:	74 2e                	je     800a14 <strncmp+0x44>
+  8009e6:	0f b6 01             	movzbl (%ecx),%eax
+  8009e9:	84 c0                	test   %al,%al
+  8009eb:	74 16                	je     800a03 <strncmp+0x33>
+  8009ed:	3a 03                	cmp    (%ebx),%al
+  8009ef:	75 12                	jne    800a03 <strncmp+0x33>
+		n--, p++, q++;
+  8009f1:	83 c1 01             	add    $0x1,%ecx
+  8009f4:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8009f7:	83 ea 01             	sub    $0x1,%edx
+  8009fa:	75 ea                	jne    8009e6 <strncmp+0x16>
+		return 0;
+  8009fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a01:	eb 11                	jmp    800a14 <strncmp+0x44>
+  800a03:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a08:	85 d2                	test   %edx,%edx
+  800a0a:	74 08                	je     800a14 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a0c:	0f b6 01             	movzbl (%ecx),%eax
+  800a0f:	0f b6 13             	movzbl (%ebx),%edx
+  800a12:	29 d0                	sub    %edx,%eax
+}
+  800a14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a17:	c9                   	leave
+  800a18:	c3                   	ret
+
+00800a19 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a23:	0f b6 10             	movzbl (%eax),%edx
+  800a26:	84 d2                	test   %dl,%dl
+  800a28:	74 15                	je     800a3f <strchr+0x26>
+		if (*s == c)
+  800a2a:	38 d1                	cmp    %dl,%cl
+  800a2c:	74 0f                	je     800a3d <strchr+0x24>
+	for (; *s; s++)
+  800a2e:	83 c0 01             	add    $0x1,%eax
+  800a31:	0f b6 10             	movzbl (%eax),%edx
+  800a34:	84 d2                	test   %dl,%dl
+  800a36:	75 f2                	jne    800a2a <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3d:	5d                   	pop    %ebp
+  800a3e:	c3                   	ret
+	return 0;
+  800a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a44:	eb f7                	jmp    800a3d <strchr+0x24>
+
+00800a46 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	53                   	push   %ebx
+  800a4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a50:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a53:	38 d3                	cmp    %dl,%bl
+  800a55:	74 14                	je     800a6b <strfind+0x25>
+  800a57:	89 d1                	mov    %edx,%ecx
+  800a59:	84 db                	test   %bl,%bl
+  800a5b:	74 0e                	je     800a6b <strfind+0x25>
+	for (; *s; s++)
+  800a5d:	83 c0 01             	add    $0x1,%eax
+  800a60:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a63:	38 ca                	cmp    %cl,%dl
+  800a65:	74 04                	je     800a6b <strfind+0x25>
+  800a67:	84 d2                	test   %dl,%dl
+  800a69:	75 f2                	jne    800a5d <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800a6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+
+00800a70 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	57                   	push   %edi
+  800a74:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a77:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a7a:	85 c9                	test   %ecx,%ecx
+  800a7c:	74 20                	je     800a9e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a7e:	89 f8                	mov    %edi,%eax
+  800a80:	09 c8                	or     %ecx,%eax
+  800a82:	a8 03                	test   $0x3,%al
+  800a84:	75 12                	jne    800a98 <memset+0x28>
+		c &= 0xFF;
+  800a86:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a8a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a90:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a93:	fc                   	cld
+  800a94:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a96:	eb 06                	jmp    800a9e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a98:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a9b:	fc                   	cld
+  800a9c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a9e:	89 f8                	mov    %edi,%eax
+  800aa0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aa3:	c9                   	leave
+  800aa4:	c3                   	ret
+
+00800aa5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aa5:	55                   	push   %ebp
+  800aa6:	89 e5                	mov    %esp,%ebp
+  800aa8:	57                   	push   %edi
+  800aa9:	56                   	push   %esi
+  800aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ab0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ab3:	39 c6                	cmp    %eax,%esi
+  800ab5:	73 32                	jae    800ae9 <memmove+0x44>
+  800ab7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aba:	39 d0                	cmp    %edx,%eax
+  800abc:	73 2b                	jae    800ae9 <memmove+0x44>
+		s += n;
+		d += n;
+  800abe:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac1:	89 d6                	mov    %edx,%esi
+  800ac3:	09 fe                	or     %edi,%esi
+  800ac5:	09 ce                	or     %ecx,%esi
+  800ac7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800acd:	75 0e                	jne    800add <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800acf:	83 ef 04             	sub    $0x4,%edi
+  800ad2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ad5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ad8:	fd                   	std
+  800ad9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800adb:	eb 09                	jmp    800ae6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800add:	83 ef 01             	sub    $0x1,%edi
+  800ae0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ae3:	fd                   	std
+  800ae4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ae6:	fc                   	cld
+  800ae7:	eb 1a                	jmp    800b03 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ae9:	89 f2                	mov    %esi,%edx
+  800aeb:	09 c2                	or     %eax,%edx
+  800aed:	09 ca                	or     %ecx,%edx
+  800aef:	f6 c2 03             	test   $0x3,%dl
+  800af2:	75 0a                	jne    800afe <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800af4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800af7:	89 c7                	mov    %eax,%edi
+  800af9:	fc                   	cld
+  800afa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800afc:	eb 05                	jmp    800b03 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800afe:	89 c7                	mov    %eax,%edi
+  800b00:	fc                   	cld
+  800b01:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b03:	5e                   	pop    %esi
+  800b04:	5f                   	pop    %edi
+  800b05:	5d                   	pop    %ebp
+  800b06:	c3                   	ret
+
+00800b07 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b0d:	ff 75 10             	push   0x10(%ebp)
+  800b10:	ff 75 0c             	push   0xc(%ebp)
+  800b13:	ff 75 08             	push   0x8(%ebp)
+  800b16:	e8 8a ff ff ff       	call   800aa5 <memmove>
+}
+  800b1b:	c9                   	leave
+  800b1c:	c3                   	ret
+
+00800b1d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	56                   	push   %esi
+  800b21:	53                   	push   %ebx
+  800b22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b28:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b2b:	85 f6                	test   %esi,%esi
+  800b2d:	74 29                	je     800b58 <memcmp+0x3b>
+  800b2f:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b31:	0f b6 08             	movzbl (%eax),%ecx
+  800b34:	0f b6 1a             	movzbl (%edx),%ebx
+  800b37:	38 d9                	cmp    %bl,%cl
+  800b39:	75 11                	jne    800b4c <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b41:	39 c6                	cmp    %eax,%esi
+  800b43:	75 ec                	jne    800b31 <memcmp+0x14>
+	}
+
+	return 0;
+  800b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4a:	eb 08                	jmp    800b54 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b4c:	0f b6 c1             	movzbl %cl,%eax
+  800b4f:	0f b6 db             	movzbl %bl,%ebx
+  800b52:	29 d8                	sub    %ebx,%eax
+}
+  800b54:	5b                   	pop    %ebx
+  800b55:	5e                   	pop    %esi
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+	return 0;
+  800b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5d:	eb f5                	jmp    800b54 <memcmp+0x37>
+
+00800b5f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b5f:	55                   	push   %ebp
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b68:	89 c2                	mov    %eax,%edx
+  800b6a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b6d:	39 d0                	cmp    %edx,%eax
+  800b6f:	73 0d                	jae    800b7e <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b71:	38 08                	cmp    %cl,(%eax)
+  800b73:	74 0d                	je     800b82 <memfind+0x23>
+	for (; s < ends; s++)
+  800b75:	83 c0 01             	add    $0x1,%eax
+  800b78:	39 c2                	cmp    %eax,%edx
+  800b7a:	75 f5                	jne    800b71 <memfind+0x12>
+  800b7c:	eb 06                	jmp    800b84 <memfind+0x25>
+  800b7e:	89 c2                	mov    %eax,%edx
+  800b80:	eb 02                	jmp    800b84 <memfind+0x25>
+  800b82:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800b84:	89 d0                	mov    %edx,%eax
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+  800b8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b94:	0f b6 02             	movzbl (%edx),%eax
+  800b97:	3c 20                	cmp    $0x20,%al
+  800b99:	74 04                	je     800b9f <strtol+0x17>
+  800b9b:	3c 09                	cmp    $0x9,%al
+  800b9d:	75 0e                	jne    800bad <strtol+0x25>
+		s++;
+  800b9f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ba2:	0f b6 02             	movzbl (%edx),%eax
+  800ba5:	3c 20                	cmp    $0x20,%al
+  800ba7:	74 f6                	je     800b9f <strtol+0x17>
+  800ba9:	3c 09                	cmp    $0x9,%al
+  800bab:	74 f2                	je     800b9f <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bad:	3c 2b                	cmp    $0x2b,%al
+  800baf:	74 2a                	je     800bdb <strtol+0x53>
+	int neg = 0;
+  800bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bb6:	3c 2d                	cmp    $0x2d,%al
+  800bb8:	74 2b                	je     800be5 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bba:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bc0:	75 0f                	jne    800bd1 <strtol+0x49>
+  800bc2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bc5:	74 28                	je     800bef <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bc7:	85 db                	test   %ebx,%ebx
+  800bc9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bce:	0f 44 d8             	cmove  %eax,%ebx
+  800bd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bd9:	eb 46                	jmp    800c21 <strtol+0x99>
+		s++;
+  800bdb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bde:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be3:	eb d5                	jmp    800bba <strtol+0x32>
+		s++, neg = 1;
+  800be5:	83 c2 01             	add    $0x1,%edx
+  800be8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bed:	eb cb                	jmp    800bba <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bef:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bf3:	74 0e                	je     800c03 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800bf5:	85 db                	test   %ebx,%ebx
+  800bf7:	75 d8                	jne    800bd1 <strtol+0x49>
+		s++, base = 8;
+  800bf9:	83 c2 01             	add    $0x1,%edx
+  800bfc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c01:	eb ce                	jmp    800bd1 <strtol+0x49>
+		s += 2, base = 16;
+  800c03:	83 c2 02             	add    $0x2,%edx
+  800c06:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c0b:	eb c4                	jmp    800bd1 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c0d:	0f be c0             	movsbl %al,%eax
+  800c10:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c13:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c16:	7d 3a                	jge    800c52 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c18:	83 c2 01             	add    $0x1,%edx
+  800c1b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c1f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c21:	0f b6 02             	movzbl (%edx),%eax
+  800c24:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c27:	89 f3                	mov    %esi,%ebx
+  800c29:	80 fb 09             	cmp    $0x9,%bl
+  800c2c:	76 df                	jbe    800c0d <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c2e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c31:	89 f3                	mov    %esi,%ebx
+  800c33:	80 fb 19             	cmp    $0x19,%bl
+  800c36:	77 08                	ja     800c40 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c38:	0f be c0             	movsbl %al,%eax
+  800c3b:	83 e8 57             	sub    $0x57,%eax
+  800c3e:	eb d3                	jmp    800c13 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c40:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c43:	89 f3                	mov    %esi,%ebx
+  800c45:	80 fb 19             	cmp    $0x19,%bl
+  800c48:	77 08                	ja     800c52 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c4a:	0f be c0             	movsbl %al,%eax
+  800c4d:	83 e8 37             	sub    $0x37,%eax
+  800c50:	eb c1                	jmp    800c13 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c52:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c56:	74 05                	je     800c5d <strtol+0xd5>
+		*endptr = (char *) s;
+  800c58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c5b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c5d:	89 c8                	mov    %ecx,%eax
+  800c5f:	f7 d8                	neg    %eax
+  800c61:	85 ff                	test   %edi,%edi
+  800c63:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c66:	89 c8                	mov    %ecx,%eax
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5f                   	pop    %edi
+  800c6b:	5d                   	pop    %ebp
+  800c6c:	c3                   	ret
+
+00800c6d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	57                   	push   %edi
+  800c71:	56                   	push   %esi
+  800c72:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7e:	89 c3                	mov    %eax,%ebx
+  800c80:	89 c7                	mov    %eax,%edi
+  800c82:	89 c6                	mov    %eax,%esi
+  800c84:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c86:	5b                   	pop    %ebx
+  800c87:	5e                   	pop    %esi
+  800c88:	5f                   	pop    %edi
+  800c89:	5d                   	pop    %ebp
+  800c8a:	c3                   	ret
+
+00800c8b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	57                   	push   %edi
+  800c8f:	56                   	push   %esi
+  800c90:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c96:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c9b:	89 d1                	mov    %edx,%ecx
+  800c9d:	89 d3                	mov    %edx,%ebx
+  800c9f:	89 d7                	mov    %edx,%edi
+  800ca1:	89 d6                	mov    %edx,%esi
+  800ca3:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ca5:	5b                   	pop    %ebx
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5f                   	pop    %edi
+  800ca8:	5d                   	pop    %ebp
+  800ca9:	c3                   	ret
+
+00800caa <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	57                   	push   %edi
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+  800cb0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cc0:	89 cb                	mov    %ecx,%ebx
+  800cc2:	89 cf                	mov    %ecx,%edi
+  800cc4:	89 ce                	mov    %ecx,%esi
+  800cc6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc8:	85 c0                	test   %eax,%eax
+  800cca:	7f 08                	jg     800cd4 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ccc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccf:	5b                   	pop    %ebx
+  800cd0:	5e                   	pop    %esi
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd4:	83 ec 0c             	sub    $0xc,%esp
+  800cd7:	50                   	push   %eax
+  800cd8:	6a 03                	push   $0x3
+  800cda:	68 cb 47 80 00       	push   $0x8047cb
+  800cdf:	6a 23                	push   $0x23
+  800ce1:	68 e8 47 80 00       	push   $0x8047e8
+  800ce6:	e8 b0 34 00 00       	call   80419b <_panic>
+
+00800ceb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ceb:	55                   	push   %ebp
+  800cec:	89 e5                	mov    %esp,%ebp
+  800cee:	57                   	push   %edi
+  800cef:	56                   	push   %esi
+  800cf0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cfb:	89 d1                	mov    %edx,%ecx
+  800cfd:	89 d3                	mov    %edx,%ebx
+  800cff:	89 d7                	mov    %edx,%edi
+  800d01:	89 d6                	mov    %edx,%esi
+  800d03:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d05:	5b                   	pop    %ebx
+  800d06:	5e                   	pop    %esi
+  800d07:	5f                   	pop    %edi
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+
+00800d0a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	57                   	push   %edi
+  800d0e:	56                   	push   %esi
+  800d0f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d15:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d1a:	89 d1                	mov    %edx,%ecx
+  800d1c:	89 d3                	mov    %edx,%ebx
+  800d1e:	89 d7                	mov    %edx,%edi
+  800d20:	89 d6                	mov    %edx,%esi
+  800d22:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d24:	5b                   	pop    %ebx
+  800d25:	5e                   	pop    %esi
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+
+00800d29 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+  800d2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d32:	be 00 00 00 00       	mov    $0x0,%esi
+  800d37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d45:	89 f7                	mov    %esi,%edi
+  800d47:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d49:	85 c0                	test   %eax,%eax
+  800d4b:	7f 08                	jg     800d55 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d50:	5b                   	pop    %ebx
+  800d51:	5e                   	pop    %esi
+  800d52:	5f                   	pop    %edi
+  800d53:	5d                   	pop    %ebp
+  800d54:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d55:	83 ec 0c             	sub    $0xc,%esp
+  800d58:	50                   	push   %eax
+  800d59:	6a 04                	push   $0x4
+  800d5b:	68 cb 47 80 00       	push   $0x8047cb
+  800d60:	6a 23                	push   $0x23
+  800d62:	68 e8 47 80 00       	push   $0x8047e8
+  800d67:	e8 2f 34 00 00       	call   80419b <_panic>
+
+00800d6c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	57                   	push   %edi
+  800d70:	56                   	push   %esi
+  800d71:	53                   	push   %ebx
+  800d72:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d83:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d86:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d89:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d8b:	85 c0                	test   %eax,%eax
+  800d8d:	7f 08                	jg     800d97 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d92:	5b                   	pop    %ebx
+  800d93:	5e                   	pop    %esi
+  800d94:	5f                   	pop    %edi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d97:	83 ec 0c             	sub    $0xc,%esp
+  800d9a:	50                   	push   %eax
+  800d9b:	6a 05                	push   $0x5
+  800d9d:	68 cb 47 80 00       	push   $0x8047cb
+  800da2:	6a 23                	push   $0x23
+  800da4:	68 e8 47 80 00       	push   $0x8047e8
+  800da9:	e8 ed 33 00 00       	call   80419b <_panic>
+
+00800dae <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+  800db4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc2:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dc7:	89 df                	mov    %ebx,%edi
+  800dc9:	89 de                	mov    %ebx,%esi
+  800dcb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcd:	85 c0                	test   %eax,%eax
+  800dcf:	7f 08                	jg     800dd9 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd4:	5b                   	pop    %ebx
+  800dd5:	5e                   	pop    %esi
+  800dd6:	5f                   	pop    %edi
+  800dd7:	5d                   	pop    %ebp
+  800dd8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd9:	83 ec 0c             	sub    $0xc,%esp
+  800ddc:	50                   	push   %eax
+  800ddd:	6a 06                	push   $0x6
+  800ddf:	68 cb 47 80 00       	push   $0x8047cb
+  800de4:	6a 23                	push   $0x23
+  800de6:	68 e8 47 80 00       	push   $0x8047e8
+  800deb:	e8 ab 33 00 00       	call   80419b <_panic>
+
+00800df0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	57                   	push   %edi
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  800df6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e04:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e09:	89 df                	mov    %ebx,%edi
+  800e0b:	89 de                	mov    %ebx,%esi
+  800e0d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0f:	85 c0                	test   %eax,%eax
+  800e11:	7f 08                	jg     800e1b <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e16:	5b                   	pop    %ebx
+  800e17:	5e                   	pop    %esi
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1b:	83 ec 0c             	sub    $0xc,%esp
+  800e1e:	50                   	push   %eax
+  800e1f:	6a 08                	push   $0x8
+  800e21:	68 cb 47 80 00       	push   $0x8047cb
+  800e26:	6a 23                	push   $0x23
+  800e28:	68 e8 47 80 00       	push   $0x8047e8
+  800e2d:	e8 69 33 00 00       	call   80419b <_panic>
+
+00800e32 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e4b:	89 df                	mov    %ebx,%edi
+  800e4d:	89 de                	mov    %ebx,%esi
+  800e4f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 09                	push   $0x9
+  800e63:	68 cb 47 80 00       	push   $0x8047cb
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 e8 47 80 00       	push   $0x8047e8
+  800e6f:	e8 27 33 00 00       	call   80419b <_panic>
+
+00800e74 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e88:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e8d:	89 df                	mov    %ebx,%edi
+  800e8f:	89 de                	mov    %ebx,%esi
+  800e91:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 08                	jg     800e9f <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	50                   	push   %eax
+  800ea3:	6a 0a                	push   $0xa
+  800ea5:	68 cb 47 80 00       	push   $0x8047cb
+  800eaa:	6a 23                	push   $0x23
+  800eac:	68 e8 47 80 00       	push   $0x8047e8
+  800eb1:	e8 e5 32 00 00       	call   80419b <_panic>
+
+00800eb6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ebc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ecc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ed4:	5b                   	pop    %ebx
+  800ed5:	5e                   	pop    %esi
+  800ed6:	5f                   	pop    %edi
+  800ed7:	5d                   	pop    %ebp
+  800ed8:	c3                   	ret
+
+00800ed9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ed9:	55                   	push   %ebp
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	57                   	push   %edi
+  800edd:	56                   	push   %esi
+  800ede:	53                   	push   %ebx
+  800edf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ee2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eef:	89 cb                	mov    %ecx,%ebx
+  800ef1:	89 cf                	mov    %ecx,%edi
+  800ef3:	89 ce                	mov    %ecx,%esi
+  800ef5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef7:	85 c0                	test   %eax,%eax
+  800ef9:	7f 08                	jg     800f03 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efe:	5b                   	pop    %ebx
+  800eff:	5e                   	pop    %esi
+  800f00:	5f                   	pop    %edi
+  800f01:	5d                   	pop    %ebp
+  800f02:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f03:	83 ec 0c             	sub    $0xc,%esp
+  800f06:	50                   	push   %eax
+  800f07:	6a 0d                	push   $0xd
+  800f09:	68 cb 47 80 00       	push   $0x8047cb
+  800f0e:	6a 23                	push   $0x23
+  800f10:	68 e8 47 80 00       	push   $0x8047e8
+  800f15:	e8 81 32 00 00       	call   80419b <_panic>
+
+00800f1a <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	56                   	push   %esi
+  800f1f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f31:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f34:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  800f41:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f54:	89 df                	mov    %ebx,%edi
+  800f56:	89 de                	mov    %ebx,%esi
+  800f58:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5a:	85 c0                	test   %eax,%eax
+  800f5c:	7f 08                	jg     800f66 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f61:	5b                   	pop    %ebx
+  800f62:	5e                   	pop    %esi
+  800f63:	5f                   	pop    %edi
+  800f64:	5d                   	pop    %ebp
+  800f65:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f66:	83 ec 0c             	sub    $0xc,%esp
+  800f69:	50                   	push   %eax
+  800f6a:	6a 0d                	push   $0xd
+  800f6c:	68 cb 47 80 00       	push   $0x8047cb
+  800f71:	6a 23                	push   $0x23
+  800f73:	68 e8 47 80 00       	push   $0x8047e8
+  800f78:	e8 1e 32 00 00       	call   80419b <_panic>
+
+00800f7d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f7d:	55                   	push   %ebp
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	57                   	push   %edi
+  800f81:	56                   	push   %esi
+  800f82:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f88:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f8d:	89 d1                	mov    %edx,%ecx
+  800f8f:	89 d3                	mov    %edx,%ebx
+  800f91:	89 d7                	mov    %edx,%edi
+  800f93:	89 d6                	mov    %edx,%esi
+  800f95:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f97:	5b                   	pop    %ebx
+  800f98:	5e                   	pop    %esi
+  800f99:	5f                   	pop    %edi
+  800f9a:	5d                   	pop    %ebp
+  800f9b:	c3                   	ret
+
+00800f9c <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800f9c:	55                   	push   %ebp
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	57                   	push   %edi
+  800fa0:	56                   	push   %esi
+  800fa1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fad:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fb2:	89 df                	mov    %ebx,%edi
+  800fb4:	89 de                	mov    %ebx,%esi
+  800fb6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800fb8:	5b                   	pop    %ebx
+  800fb9:	5e                   	pop    %esi
+  800fba:	5f                   	pop    %edi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+
+00800fbd <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcb:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fd0:	89 cb                	mov    %ecx,%ebx
+  800fd2:	89 cf                	mov    %ecx,%edi
+  800fd4:	89 ce                	mov    %ecx,%esi
+  800fd6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+
+00800fdd <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fee:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ff3:	89 df                	mov    %ebx,%edi
+  800ff5:	89 de                	mov    %ebx,%esi
+  800ff7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+
+00800ffe <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800ffe:	55                   	push   %ebp
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	57                   	push   %edi
+  801002:	56                   	push   %esi
+  801003:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801004:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801009:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801014:	89 df                	mov    %ebx,%edi
+  801016:	89 de                	mov    %ebx,%esi
+  801018:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+
+0080101f <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801025:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801032:	89 cb                	mov    %ecx,%ebx
+  801034:	89 cf                	mov    %ecx,%edi
+  801036:	89 ce                	mov    %ecx,%esi
+  801038:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80103a:	5b                   	pop    %ebx
+  80103b:	5e                   	pop    %esi
+  80103c:	5f                   	pop    %edi
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+
+0080103f <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	57                   	push   %edi
+  801043:	56                   	push   %esi
+  801044:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801045:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801050:	b8 14 00 00 00       	mov    $0x14,%eax
+  801055:	89 df                	mov    %ebx,%edi
+  801057:	89 de                	mov    %ebx,%esi
+  801059:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801066:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801073:	89 cb                	mov    %ecx,%ebx
+  801075:	89 cf                	mov    %ecx,%edi
+  801077:	89 ce                	mov    %ecx,%esi
+  801079:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80107b:	5b                   	pop    %ebx
+  80107c:	5e                   	pop    %esi
+  80107d:	5f                   	pop    %edi
+  80107e:	5d                   	pop    %ebp
+  80107f:	c3                   	ret
+
+00801080 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801080:	55                   	push   %ebp
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	57                   	push   %edi
+  801084:	56                   	push   %esi
+  801085:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801086:	be 00 00 00 00       	mov    $0x0,%esi
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 16 00 00 00       	mov    $0x16,%eax
+  801096:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801099:	89 f7                	mov    %esi,%edi
+  80109b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+
+008010a2 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	57                   	push   %edi
+  8010a6:	56                   	push   %esi
+  8010a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b3:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010b8:	89 df                	mov    %ebx,%edi
+  8010ba:	89 de                	mov    %ebx,%esi
+  8010bc:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8010be:	5b                   	pop    %ebx
+  8010bf:	5e                   	pop    %esi
+  8010c0:	5f                   	pop    %edi
+  8010c1:	5d                   	pop    %ebp
+  8010c2:	c3                   	ret
+
+008010c3 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8010c3:	55                   	push   %ebp
+  8010c4:	89 e5                	mov    %esp,%ebp
+  8010c6:	57                   	push   %edi
+  8010c7:	56                   	push   %esi
+  8010c8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d6:	89 cb                	mov    %ecx,%ebx
+  8010d8:	89 cf                	mov    %ecx,%edi
+  8010da:	89 ce                	mov    %ecx,%esi
+  8010dc:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8010de:	5b                   	pop    %ebx
+  8010df:	5e                   	pop    %esi
+  8010e0:	5f                   	pop    %edi
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+
+008010e3 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8010e9:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8010ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010fa:	89 df                	mov    %ebx,%edi
+  8010fc:	89 de                	mov    %ebx,%esi
+  8010fe:	cd 30                	int    $0x30
+}
+  801100:	5b                   	pop    %ebx
+  801101:	5e                   	pop    %esi
+  801102:	5f                   	pop    %edi
+  801103:	5d                   	pop    %ebp
+  801104:	c3                   	ret
+
+00801105 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80111b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111e:	89 f7                	mov    %esi,%edi
+  801120:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801122:	5b                   	pop    %ebx
+  801123:	5e                   	pop    %esi
+  801124:	5f                   	pop    %edi
+  801125:	5d                   	pop    %ebp
+  801126:	c3                   	ret
+
+00801127 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	57                   	push   %edi
+  80112b:	56                   	push   %esi
+  80112c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112d:	be 00 00 00 00       	mov    $0x0,%esi
+  801132:	8b 55 08             	mov    0x8(%ebp),%edx
+  801135:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801138:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80113d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801140:	89 f7                	mov    %esi,%edi
+  801142:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801144:	5b                   	pop    %ebx
+  801145:	5e                   	pop    %esi
+  801146:	5f                   	pop    %edi
+  801147:	5d                   	pop    %ebp
+  801148:	c3                   	ret
+
+00801149 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80115f:	89 df                	mov    %ebx,%edi
+  801161:	89 de                	mov    %ebx,%esi
+  801163:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801165:	5b                   	pop    %ebx
+  801166:	5e                   	pop    %esi
+  801167:	5f                   	pop    %edi
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+
+0080116a <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	57                   	push   %edi
+  80116e:	56                   	push   %esi
+  80116f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801170:	be 00 00 00 00       	mov    $0x0,%esi
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801180:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801183:	89 f7                	mov    %esi,%edi
+  801185:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801187:	5b                   	pop    %ebx
+  801188:	5e                   	pop    %esi
+  801189:	5f                   	pop    %edi
+  80118a:	5d                   	pop    %ebp
+  80118b:	c3                   	ret
+
+0080118c <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80118c:	85 c0                	test   %eax,%eax
+  80118e:	74 20                	je     8011b0 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  801190:	89 c1                	mov    %eax,%ecx
+  801192:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801198:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80119e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8011a4:	8b 52 48             	mov    0x48(%edx),%edx
+  8011a7:	39 c2                	cmp    %eax,%edx
+  8011a9:	74 06                	je     8011b1 <thread_alive+0x25>
+  8011ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b0:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8011b1:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8011b7:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8011bd:	85 c0                	test   %eax,%eax
+  8011bf:	0f 95 c0             	setne  %al
+  8011c2:	0f b6 c0             	movzbl %al,%eax
+  8011c5:	c3                   	ret
+
+008011c6 <pgfault>:
+{
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	57                   	push   %edi
+  8011ca:	56                   	push   %esi
+  8011cb:	53                   	push   %ebx
+  8011cc:	83 ec 0c             	sub    $0xc,%esp
+  8011cf:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8011d2:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8011d4:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8011d7:	89 f3                	mov    %esi,%ebx
+  8011d9:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8011dc:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8011e3:	74 52                	je     801237 <pgfault+0x71>
+  8011e5:	a8 02                	test   $0x2,%al
+  8011e7:	75 14                	jne    8011fd <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8011e9:	83 ec 04             	sub    $0x4,%esp
+  8011ec:	68 f6 47 80 00       	push   $0x8047f6
+  8011f1:	6a 2e                	push   $0x2e
+  8011f3:	68 14 48 80 00       	push   $0x804814
+  8011f8:	e8 9e 2f 00 00       	call   80419b <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8011fd:	89 d8                	mov    %ebx,%eax
+  8011ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801204:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	57                   	push   %edi
+  80120f:	e8 3b 2c 00 00       	call   803e4f <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801214:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80121b:	83 e0 03             	and    $0x3,%eax
+  80121e:	83 c4 10             	add    $0x10,%esp
+  801221:	83 f8 03             	cmp    $0x3,%eax
+  801224:	75 1a                	jne    801240 <pgfault+0x7a>
+			mutex_unlock(m);
+  801226:	83 ec 0c             	sub    $0xc,%esp
+  801229:	57                   	push   %edi
+  80122a:	e8 8e 2c 00 00       	call   803ebd <mutex_unlock>
+			return;
+  80122f:	83 c4 10             	add    $0x10,%esp
+  801232:	e9 9f 00 00 00       	jmp    8012d6 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801237:	a8 02                	test   $0x2,%al
+  801239:	74 ae                	je     8011e9 <pgfault+0x23>
+	struct mutex *m = NULL;
+  80123b:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801240:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801247:	f6 c4 08             	test   $0x8,%ah
+  80124a:	74 9d                	je     8011e9 <pgfault+0x23>
+  80124c:	89 e0                	mov    %esp,%eax
+  80124e:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801253:	29 c2                	sub    %eax,%edx
+  801255:	89 d0                	mov    %edx,%eax
+  801257:	c1 e8 0f             	shr    $0xf,%eax
+  80125a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801260:	ba 00 00 00 00       	mov    $0x0,%edx
+  801265:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801268:	c1 e0 0c             	shl    $0xc,%eax
+  80126b:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801270:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801272:	83 ec 04             	sub    $0x4,%esp
+  801275:	6a 07                	push   $0x7
+  801277:	53                   	push   %ebx
+  801278:	6a 00                	push   $0x0
+  80127a:	e8 aa fa ff ff       	call   800d29 <sys_page_alloc>
+  80127f:	83 c4 10             	add    $0x10,%esp
+  801282:	85 c0                	test   %eax,%eax
+  801284:	78 58                	js     8012de <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801286:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80128c:	83 ec 04             	sub    $0x4,%esp
+  80128f:	68 00 10 00 00       	push   $0x1000
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+  801296:	e8 0a f8 ff ff       	call   800aa5 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  80129b:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012a2:	56                   	push   %esi
+  8012a3:	6a 00                	push   $0x0
+  8012a5:	53                   	push   %ebx
+  8012a6:	6a 00                	push   $0x0
+  8012a8:	e8 bf fa ff ff       	call   800d6c <sys_page_map>
+  8012ad:	83 c4 20             	add    $0x20,%esp
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	78 3c                	js     8012f0 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8012b4:	83 ec 08             	sub    $0x8,%esp
+  8012b7:	53                   	push   %ebx
+  8012b8:	6a 00                	push   $0x0
+  8012ba:	e8 ef fa ff ff       	call   800dae <sys_page_unmap>
+  8012bf:	83 c4 10             	add    $0x10,%esp
+  8012c2:	85 c0                	test   %eax,%eax
+  8012c4:	78 3c                	js     801302 <pgfault+0x13c>
+	if(m)
+  8012c6:	85 ff                	test   %edi,%edi
+  8012c8:	74 0c                	je     8012d6 <pgfault+0x110>
+		mutex_unlock(m);
+  8012ca:	83 ec 0c             	sub    $0xc,%esp
+  8012cd:	57                   	push   %edi
+  8012ce:	e8 ea 2b 00 00       	call   803ebd <mutex_unlock>
+  8012d3:	83 c4 10             	add    $0x10,%esp
+}
+  8012d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d9:	5b                   	pop    %ebx
+  8012da:	5e                   	pop    %esi
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8012de:	50                   	push   %eax
+  8012df:	68 1f 48 80 00       	push   $0x80481f
+  8012e4:	6a 3d                	push   $0x3d
+  8012e6:	68 14 48 80 00       	push   $0x804814
+  8012eb:	e8 ab 2e 00 00       	call   80419b <_panic>
+		panic("sys_page_map: %e", ret);
+  8012f0:	50                   	push   %eax
+  8012f1:	68 32 48 80 00       	push   $0x804832
+  8012f6:	6a 40                	push   $0x40
+  8012f8:	68 14 48 80 00       	push   $0x804814
+  8012fd:	e8 99 2e 00 00       	call   80419b <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801302:	50                   	push   %eax
+  801303:	68 43 48 80 00       	push   $0x804843
+  801308:	6a 42                	push   $0x42
+  80130a:	68 14 48 80 00       	push   $0x804814
+  80130f:	e8 87 2e 00 00       	call   80419b <_panic>
+
+00801314 <thread_main>:
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  80131a:	ff 75 0c             	push   0xc(%ebp)
+  80131d:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801320:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801327:	e8 7e f9 ff ff       	call   800caa <sys_env_destroy>
+}
+  80132c:	83 c4 10             	add    $0x10,%esp
+  80132f:	c9                   	leave
+  801330:	c3                   	ret
+
+00801331 <fork>:
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+  801337:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  80133a:	68 c6 11 80 00       	push   $0x8011c6
+  80133f:	e8 9d 2e 00 00       	call   8041e1 <set_pgfault_handler>
+	if(sforked)
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80134e:	75 33                	jne    801383 <fork+0x52>
+	__asm __volatile("int %2"
+  801350:	b8 07 00 00 00       	mov    $0x7,%eax
+  801355:	cd 30                	int    $0x30
+  801357:	89 c7                	mov    %eax,%edi
+  801359:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  80135b:	85 c0                	test   %eax,%eax
+  80135d:	0f 88 b4 00 00 00    	js     801417 <fork+0xe6>
+	if(envid == 0) {
+  801363:	0f 84 c3 00 00 00    	je     80142c <fork+0xfb>
+	pgbatch_init(&pb);
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	68 20 63 80 00       	push   $0x806320
+  801371:	e8 25 29 00 00       	call   803c9b <pgbatch_init>
+  801376:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801379:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137e:	e9 9c 01 00 00       	jmp    80151f <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  801386:	68 c0 66 80 00       	push   $0x8066c0
+  80138b:	e8 bf 2a 00 00       	call   803e4f <mutex_lock>
+  801390:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801393:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801398:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  80139d:	eb 08                	jmp    8013a7 <fork+0x76>
+  80139f:	83 c3 01             	add    $0x1,%ebx
+  8013a2:	83 fb 20             	cmp    $0x20,%ebx
+  8013a5:	74 5b                	je     801402 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8013a7:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  8013ae:	89 f0                	mov    %esi,%eax
+  8013b0:	e8 d7 fd ff ff       	call   80118c <thread_alive>
+  8013b5:	85 c0                	test   %eax,%eax
+  8013b7:	74 e6                	je     80139f <fork+0x6e>
+  8013b9:	89 e0                	mov    %esp,%eax
+  8013bb:	89 fa                	mov    %edi,%edx
+  8013bd:	29 c2                	sub    %eax,%edx
+  8013bf:	89 d0                	mov    %edx,%eax
+  8013c1:	c1 e8 0f             	shr    $0xf,%eax
+  8013c4:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8013ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013cf:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8013d2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8013d9:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8013dc:	83 ec 08             	sub    $0x8,%esp
+  8013df:	50                   	push   %eax
+  8013e0:	56                   	push   %esi
+  8013e1:	e8 8e fa ff ff       	call   800e74 <sys_env_set_pgfault_upcall>
+  8013e6:	83 c4 10             	add    $0x10,%esp
+  8013e9:	85 c0                	test   %eax,%eax
+  8013eb:	79 b2                	jns    80139f <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8013ed:	50                   	push   %eax
+  8013ee:	68 d0 48 80 00       	push   $0x8048d0
+  8013f3:	68 00 01 00 00       	push   $0x100
+  8013f8:	68 14 48 80 00       	push   $0x804814
+  8013fd:	e8 99 2d 00 00       	call   80419b <_panic>
+	mutex_unlock(&sfork_lock);
+  801402:	83 ec 0c             	sub    $0xc,%esp
+  801405:	68 c0 66 80 00       	push   $0x8066c0
+  80140a:	e8 ae 2a 00 00       	call   803ebd <mutex_unlock>
+}
+  80140f:	83 c4 10             	add    $0x10,%esp
+  801412:	e9 39 ff ff ff       	jmp    801350 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801417:	50                   	push   %eax
+  801418:	68 56 48 80 00       	push   $0x804856
+  80141d:	68 91 00 00 00       	push   $0x91
+  801422:	68 14 48 80 00       	push   $0x804814
+  801427:	e8 6f 2d 00 00       	call   80419b <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80142c:	e8 ba f8 ff ff       	call   800ceb <sys_getenvid>
+  801431:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801436:	89 e1                	mov    %esp,%ecx
+  801438:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80143d:	29 ca                	sub    %ecx,%edx
+  80143f:	89 d1                	mov    %edx,%ecx
+  801441:	c1 e9 0f             	shr    $0xf,%ecx
+  801444:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80144a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144f:	0f 42 d1             	cmovb  %ecx,%edx
+  801452:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801458:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80145d:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  801464:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  801469:	85 c0                	test   %eax,%eax
+  80146b:	75 07                	jne    801474 <fork+0x143>
+		return 0;
+  80146d:	89 c6                	mov    %eax,%esi
+  80146f:	e9 6f 02 00 00       	jmp    8016e3 <fork+0x3b2>
+  801474:	89 e2                	mov    %esp,%edx
+  801476:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80147b:	29 d0                	sub    %edx,%eax
+  80147d:	89 c3                	mov    %eax,%ebx
+  80147f:	c1 eb 0f             	shr    $0xf,%ebx
+  801482:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80148f:	83 ec 04             	sub    $0x4,%esp
+  801492:	68 80 00 00 00       	push   $0x80
+  801497:	6a 00                	push   $0x0
+  801499:	68 40 66 80 00       	push   $0x806640
+  80149e:	e8 cd f5 ff ff       	call   800a70 <memset>
+	thread_ids[slot] = sys_getenvid();
+  8014a3:	e8 43 f8 ff ff       	call   800ceb <sys_getenvid>
+  8014a8:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8014af:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  8014b6:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  8014bb:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  8014c2:	e8 7a 29 00 00       	call   803e41 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8014c7:	83 c4 0c             	add    $0xc,%esp
+  8014ca:	68 07 04 00 00       	push   $0x407
+  8014cf:	68 00 00 00 e1       	push   $0xe1000000
+  8014d4:	6a 00                	push   $0x0
+  8014d6:	e8 4e f8 ff ff       	call   800d29 <sys_page_alloc>
+  8014db:	83 c4 10             	add    $0x10,%esp
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	0f 89 fd 01 00 00    	jns    8016e3 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8014e6:	50                   	push   %eax
+  8014e7:	68 1f 48 80 00       	push   $0x80481f
+  8014ec:	68 12 01 00 00       	push   $0x112
+  8014f1:	68 14 48 80 00       	push   $0x804814
+  8014f6:	e8 a0 2c 00 00       	call   80419b <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8014fb:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801501:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801507:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80150d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801513:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801519:	0f 87 4f 01 00 00    	ja     80166e <fork+0x33d>
+		pd = PDX(addr);
+  80151f:	89 d8                	mov    %ebx,%eax
+  801521:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801524:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80152b:	f6 c2 01             	test   $0x1,%dl
+  80152e:	74 cb                	je     8014fb <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801530:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801535:	0f 85 92 00 00 00    	jne    8015cd <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  80153b:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801541:	76 10                	jbe    801553 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801543:	89 d8                	mov    %ebx,%eax
+  801545:	f7 d8                	neg    %eax
+  801547:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80154c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801551:	74 ba                	je     80150d <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801553:	89 d8                	mov    %ebx,%eax
+  801555:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801558:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80155f:	f6 c2 01             	test   $0x1,%dl
+  801562:	74 a9                	je     80150d <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801564:	89 c1                	mov    %eax,%ecx
+  801566:	c1 e1 0c             	shl    $0xc,%ecx
+  801569:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  80156c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801573:	f6 c6 04             	test   $0x4,%dh
+  801576:	0f 85 8e 00 00 00    	jne    80160a <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  80157c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801583:	f6 c6 08             	test   $0x8,%dh
+  801586:	75 0f                	jne    801597 <fork+0x266>
+  801588:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80158f:	a8 02                	test   $0x2,%al
+  801591:	0f 84 bb 00 00 00    	je     801652 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801597:	83 ec 08             	sub    $0x8,%esp
+  80159a:	68 05 08 00 00       	push   $0x805
+  80159f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8015a2:	50                   	push   %eax
+  8015a3:	56                   	push   %esi
+  8015a4:	50                   	push   %eax
+  8015a5:	6a 00                	push   $0x0
+  8015a7:	68 20 63 80 00       	push   $0x806320
+  8015ac:	e8 a8 27 00 00       	call   803d59 <pgbatch_map>
+  8015b1:	83 c4 20             	add    $0x20,%esp
+  8015b4:	85 c0                	test   %eax,%eax
+  8015b6:	79 76                	jns    80162e <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8015b8:	50                   	push   %eax
+  8015b9:	68 7a 48 80 00       	push   $0x80487a
+  8015be:	68 bc 00 00 00       	push   $0xbc
+  8015c3:	68 14 48 80 00       	push   $0x804814
+  8015c8:	e8 ce 2b 00 00       	call   80419b <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	68 00 08 00 00       	push   $0x800
+  8015d5:	56                   	push   %esi
+  8015d6:	53                   	push   %ebx
+  8015d7:	6a 00                	push   $0x0
+  8015d9:	68 20 63 80 00       	push   $0x806320
+  8015de:	e8 21 28 00 00       	call   803e04 <pgbatch_sharept>
+  8015e3:	83 c4 20             	add    $0x20,%esp
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	78 0b                	js     8015f5 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8015ea:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8015f0:	e9 18 ff ff ff       	jmp    80150d <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8015f5:	50                   	push   %eax
+  8015f6:	68 66 48 80 00       	push   $0x804866
+  8015fb:	68 b2 00 00 00       	push   $0xb2
+  801600:	68 14 48 80 00       	push   $0x804814
+  801605:	e8 91 2b 00 00       	call   80419b <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  80160a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801611:	83 ec 08             	sub    $0x8,%esp
+  801614:	25 07 0e 00 00       	and    $0xe07,%eax
+  801619:	50                   	push   %eax
+  80161a:	51                   	push   %ecx
+  80161b:	56                   	push   %esi
+  80161c:	51                   	push   %ecx
+  80161d:	6a 00                	push   $0x0
+  80161f:	68 20 63 80 00       	push   $0x806320
+  801624:	e8 30 27 00 00       	call   803d59 <pgbatch_map>
+  801629:	83 c4 20             	add    $0x20,%esp
+  80162c:	eb 17                	jmp    801645 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  80162e:	68 05 08 00 00       	push   $0x805
+  801633:	ff 75 e4             	push   -0x1c(%ebp)
+  801636:	6a 00                	push   $0x0
+  801638:	68 20 63 80 00       	push   $0x806320
+  80163d:	e8 8b 27 00 00       	call   803dcd <pgbatch_protect>
+  801642:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801645:	85 c0                	test   %eax,%eax
+  801647:	0f 89 c0 fe ff ff    	jns    80150d <fork+0x1dc>
+  80164d:	e9 66 ff ff ff       	jmp    8015b8 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801652:	83 ec 08             	sub    $0x8,%esp
+  801655:	6a 05                	push   $0x5
+  801657:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80165a:	50                   	push   %eax
+  80165b:	56                   	push   %esi
+  80165c:	50                   	push   %eax
+  80165d:	6a 00                	push   $0x0
+  80165f:	68 20 63 80 00       	push   $0x806320
+  801664:	e8 f0 26 00 00       	call   803d59 <pgbatch_map>
+  801669:	83 c4 20             	add    $0x20,%esp
+  80166c:	eb d7                	jmp    801645 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  80166e:	6a 07                	push   $0x7
+  801670:	68 00 f0 bf ee       	push   $0xeebff000
+  801675:	57                   	push   %edi
+  801676:	68 20 63 80 00       	push   $0x806320
+  80167b:	e8 a2 26 00 00       	call   803d22 <pgbatch_alloc>
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	85 c0                	test   %eax,%eax
+  801685:	78 66                	js     8016ed <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801687:	83 ec 0c             	sub    $0xc,%esp
+  80168a:	68 20 63 80 00       	push   $0x806320
+  80168f:	e8 15 26 00 00       	call   803ca9 <pgbatch_flush>
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	85 c0                	test   %eax,%eax
+  801699:	78 52                	js     8016ed <fork+0x3bc>
+  80169b:	89 e2                	mov    %esp,%edx
+  80169d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016a2:	29 d0                	sub    %edx,%eax
+  8016a4:	89 c2                	mov    %eax,%edx
+  8016a6:	c1 ea 0f             	shr    $0xf,%edx
+  8016a9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b3:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8016b6:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8016bd:	8b 40 78             	mov    0x78(%eax),%eax
+  8016c0:	83 ec 08             	sub    $0x8,%esp
+  8016c3:	50                   	push   %eax
+  8016c4:	57                   	push   %edi
+  8016c5:	e8 aa f7 ff ff       	call   800e74 <sys_env_set_pgfault_upcall>
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	78 31                	js     801702 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  8016d1:	83 ec 08             	sub    $0x8,%esp
+  8016d4:	6a 02                	push   $0x2
+  8016d6:	57                   	push   %edi
+  8016d7:	e8 14 f7 ff ff       	call   800df0 <sys_env_set_status>
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 34                	js     801717 <fork+0x3e6>
+}
+  8016e3:	89 f0                	mov    %esi,%eax
+  8016e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  8016ed:	50                   	push   %eax
+  8016ee:	68 86 48 80 00       	push   $0x804886
+  8016f3:	68 c0 00 00 00       	push   $0xc0
+  8016f8:	68 14 48 80 00       	push   $0x804814
+  8016fd:	e8 99 2a 00 00       	call   80419b <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801702:	50                   	push   %eax
+  801703:	68 9b 48 80 00       	push   $0x80489b
+  801708:	68 c2 00 00 00       	push   $0xc2
+  80170d:	68 14 48 80 00       	push   $0x804814
+  801712:	e8 84 2a 00 00       	call   80419b <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801717:	50                   	push   %eax
+  801718:	68 b6 48 80 00       	push   $0x8048b6
+  80171d:	68 c4 00 00 00       	push   $0xc4
+  801722:	68 14 48 80 00       	push   $0x804814
+  801727:	e8 6f 2a 00 00       	call   80419b <_panic>
+
+0080172c <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	57                   	push   %edi
+  801730:	56                   	push   %esi
+  801731:	53                   	push   %ebx
+  801732:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801735:	68 c0 66 80 00       	push   $0x8066c0
+  80173a:	e8 10 27 00 00       	call   803e4f <mutex_lock>
+  80173f:	89 e2                	mov    %esp,%edx
+  801741:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801746:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801748:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80174b:	89 c3                	mov    %eax,%ebx
+  80174d:	c1 eb 0f             	shr    $0xf,%ebx
+  801750:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175a:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  80175d:	e8 89 f5 ff ff       	call   800ceb <sys_getenvid>
+  801762:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801769:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80176e:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801775:	e8 12 fa ff ff       	call   80118c <thread_alive>
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	74 24                	je     8017a2 <sfork+0x76>
+  80177e:	83 c3 01             	add    $0x1,%ebx
+  801781:	83 fb 20             	cmp    $0x20,%ebx
+  801784:	75 e8                	jne    80176e <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801786:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  80178b:	83 ec 0c             	sub    $0xc,%esp
+  80178e:	68 c0 66 80 00       	push   $0x8066c0
+  801793:	e8 25 27 00 00       	call   803ebd <mutex_unlock>
+	return r;
+}
+  801798:	89 f0                	mov    %esi,%eax
+  80179a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80179d:	5b                   	pop    %ebx
+  80179e:	5e                   	pop    %esi
+  80179f:	5f                   	pop    %edi
+  8017a0:	5d                   	pop    %ebp
+  8017a1:	c3                   	ret
+	if (i == NTHREADS) {
+  8017a2:	83 fb 20             	cmp    $0x20,%ebx
+  8017a5:	0f 84 53 01 00 00    	je     8018fe <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  8017ab:	89 d8                	mov    %ebx,%eax
+  8017ad:	c1 e0 0f             	shl    $0xf,%eax
+  8017b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  8017b3:	83 ec 0c             	sub    $0xc,%esp
+  8017b6:	68 00 60 80 00       	push   $0x806000
+  8017bb:	e8 db 24 00 00       	call   803c9b <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8017ca:	75 1f                	jne    8017eb <sfork+0xbf>
+  8017cc:	68 07 04 00 00       	push   $0x407
+  8017d1:	68 00 00 00 e1       	push   $0xe1000000
+  8017d6:	6a 00                	push   $0x0
+  8017d8:	68 00 60 80 00       	push   $0x806000
+  8017dd:	e8 40 25 00 00       	call   803d22 <pgbatch_alloc>
+  8017e2:	89 c6                	mov    %eax,%esi
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	78 a0                	js     80178b <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  8017eb:	6a 07                	push   $0x7
+  8017ed:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  8017f2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017f5:	29 c8                	sub    %ecx,%eax
+  8017f7:	50                   	push   %eax
+  8017f8:	6a 00                	push   $0x0
+  8017fa:	68 00 60 80 00       	push   $0x806000
+  8017ff:	e8 1e 25 00 00       	call   803d22 <pgbatch_alloc>
+  801804:	89 c6                	mov    %eax,%esi
+  801806:	83 c4 10             	add    $0x10,%esp
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	0f 88 7a ff ff ff    	js     80178b <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801811:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801816:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801819:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  80181b:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801820:	29 c8                	sub    %ecx,%eax
+  801822:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801825:	39 c7                	cmp    %eax,%edi
+  801827:	73 29                	jae    801852 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801829:	6a 07                	push   $0x7
+  80182b:	57                   	push   %edi
+  80182c:	6a 00                	push   $0x0
+  80182e:	68 00 60 80 00       	push   $0x806000
+  801833:	e8 ea 24 00 00       	call   803d22 <pgbatch_alloc>
+  801838:	89 c6                	mov    %eax,%esi
+  80183a:	83 c4 10             	add    $0x10,%esp
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	0f 88 46 ff ff ff    	js     80178b <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801845:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80184b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80184e:	39 c7                	cmp    %eax,%edi
+  801850:	72 d7                	jb     801829 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801852:	83 ec 0c             	sub    $0xc,%esp
+  801855:	68 00 60 80 00       	push   $0x806000
+  80185a:	e8 4a 24 00 00       	call   803ca9 <pgbatch_flush>
+  80185f:	89 c6                	mov    %eax,%esi
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	0f 88 1f ff ff ff    	js     80178b <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  80186c:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801871:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801874:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801876:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  80187c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187f:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801882:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801885:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801888:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  80188b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801890:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801892:	52                   	push   %edx
+  801893:	50                   	push   %eax
+  801894:	68 14 13 80 00       	push   $0x801314
+  801899:	e8 cc f8 ff ff       	call   80116a <sys_exofork_shared>
+  80189e:	89 c6                	mov    %eax,%esi
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	85 c0                	test   %eax,%eax
+  8018a5:	0f 88 e0 fe ff ff    	js     80178b <sfork+0x5f>
+	thread_ids[i] = id;
+  8018ab:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  8018b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018b7:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8018bd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018c2:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  8018c9:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  8018d0:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8018d3:	83 ec 08             	sub    $0x8,%esp
+  8018d6:	6a 02                	push   $0x2
+  8018d8:	56                   	push   %esi
+  8018d9:	e8 12 f5 ff ff       	call   800df0 <sys_env_set_status>
+  8018de:	89 c3                	mov    %eax,%ebx
+  8018e0:	83 c4 10             	add    $0x10,%esp
+  8018e3:	85 c0                	test   %eax,%eax
+  8018e5:	0f 89 a0 fe ff ff    	jns    80178b <sfork+0x5f>
+		sys_env_destroy(id);
+  8018eb:	83 ec 0c             	sub    $0xc,%esp
+  8018ee:	56                   	push   %esi
+  8018ef:	e8 b6 f3 ff ff       	call   800caa <sys_env_destroy>
+		goto out;
+  8018f4:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8018f7:	89 de                	mov    %ebx,%esi
+		goto out;
+  8018f9:	e9 8d fe ff ff       	jmp    80178b <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  8018fe:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801903:	e9 83 fe ff ff       	jmp    80178b <sfork+0x5f>
+
+00801908 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801908:	55                   	push   %ebp
+  801909:	89 e5                	mov    %esp,%ebp
+  80190b:	56                   	push   %esi
+  80190c:	53                   	push   %ebx
+  80190d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801910:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801913:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801916:	85 c0                	test   %eax,%eax
+  801918:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80191d:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801920:	83 ec 0c             	sub    $0xc,%esp
+  801923:	50                   	push   %eax
+  801924:	e8 b0 f5 ff ff       	call   800ed9 <sys_ipc_recv>
+  801929:	83 c4 10             	add    $0x10,%esp
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	0f 88 8b 00 00 00    	js     8019bf <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801934:	85 f6                	test   %esi,%esi
+  801936:	74 2a                	je     801962 <ipc_recv+0x5a>
+  801938:	89 e2                	mov    %esp,%edx
+  80193a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80193f:	29 d0                	sub    %edx,%eax
+  801941:	89 c2                	mov    %eax,%edx
+  801943:	c1 ea 0f             	shr    $0xf,%edx
+  801946:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80194b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801950:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801953:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80195a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801960:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  801962:	85 db                	test   %ebx,%ebx
+  801964:	74 2a                	je     801990 <ipc_recv+0x88>
+  801966:	89 e2                	mov    %esp,%edx
+  801968:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80196d:	29 d0                	sub    %edx,%eax
+  80196f:	89 c2                	mov    %eax,%edx
+  801971:	c1 ea 0f             	shr    $0xf,%edx
+  801974:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801981:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801988:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80198e:	89 03                	mov    %eax,(%ebx)
+  801990:	89 e2                	mov    %esp,%edx
+  801992:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801997:	29 d0                	sub    %edx,%eax
+  801999:	89 c2                	mov    %eax,%edx
+  80199b:	c1 ea 0f             	shr    $0xf,%edx
+  80199e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a8:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8019ab:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8019b2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8019b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019bb:	5b                   	pop    %ebx
+  8019bc:	5e                   	pop    %esi
+  8019bd:	5d                   	pop    %ebp
+  8019be:	c3                   	ret
+		if(from_env_store != NULL)
+  8019bf:	85 f6                	test   %esi,%esi
+  8019c1:	74 06                	je     8019c9 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8019c3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8019c9:	85 db                	test   %ebx,%ebx
+  8019cb:	74 eb                	je     8019b8 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8019cd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8019d3:	eb e3                	jmp    8019b8 <ipc_recv+0xb0>
+
+008019d5 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8019d5:	55                   	push   %ebp
+  8019d6:	89 e5                	mov    %esp,%ebp
+  8019d8:	57                   	push   %edi
+  8019d9:	56                   	push   %esi
+  8019da:	53                   	push   %ebx
+  8019db:	83 ec 14             	sub    $0x14,%esp
+  8019de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e4:	8b 75 14             	mov    0x14(%ebp),%esi
+  8019e7:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8019f1:	0f 44 c2             	cmove  %edx,%eax
+  8019f4:	ff 75 10             	push   0x10(%ebp)
+  8019f7:	50                   	push   %eax
+  8019f8:	e8 3e f5 ff ff       	call   800f3b <sys_ipc_recv_pages>
+  8019fd:	83 c4 10             	add    $0x10,%esp
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	0f 88 ba 00 00 00    	js     801ac2 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801a08:	85 ff                	test   %edi,%edi
+  801a0a:	74 2a                	je     801a36 <ipc_recv_pages+0x61>
+  801a0c:	89 e2                	mov    %esp,%edx
+  801a0e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a13:	29 d0                	sub    %edx,%eax
+  801a15:	89 c2                	mov    %eax,%edx
+  801a17:	c1 ea 0f             	shr    $0xf,%edx
+  801a1a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a24:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801a27:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a2e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801a34:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801a36:	85 f6                	test   %esi,%esi
+  801a38:	74 2a                	je     801a64 <ipc_recv_pages+0x8f>
+  801a3a:	89 e2                	mov    %esp,%edx
+  801a3c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a41:	29 d0                	sub    %edx,%eax
+  801a43:	89 c2                	mov    %eax,%edx
+  801a45:	c1 ea 0f             	shr    $0xf,%edx
+  801a48:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a52:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801a55:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a5c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801a62:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801a64:	85 db                	test   %ebx,%ebx
+  801a66:	74 2a                	je     801a92 <ipc_recv_pages+0xbd>
+  801a68:	89 e2                	mov    %esp,%edx
+  801a6a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a6f:	29 d0                	sub    %edx,%eax
+  801a71:	89 c2                	mov    %eax,%edx
+  801a73:	c1 ea 0f             	shr    $0xf,%edx
+  801a76:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a80:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801a83:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a8a:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801a90:	89 03                	mov    %eax,(%ebx)
+  801a92:	89 e2                	mov    %esp,%edx
+  801a94:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a99:	29 d0                	sub    %edx,%eax
+  801a9b:	89 c2                	mov    %eax,%edx
+  801a9d:	c1 ea 0f             	shr    $0xf,%edx
+  801aa0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaa:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801aad:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ab4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801aba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801abd:	5b                   	pop    %ebx
+  801abe:	5e                   	pop    %esi
+  801abf:	5f                   	pop    %edi
+  801ac0:	5d                   	pop    %ebp
+  801ac1:	c3                   	ret
+		if (from_env_store)
+  801ac2:	85 ff                	test   %edi,%edi
+  801ac4:	74 06                	je     801acc <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801ac6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801acc:	85 f6                	test   %esi,%esi
+  801ace:	74 06                	je     801ad6 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801ad0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801ad6:	85 db                	test   %ebx,%ebx
+  801ad8:	74 e0                	je     801aba <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801ada:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801ae0:	eb d8                	jmp    801aba <ipc_recv_pages+0xe5>
+
+00801ae2 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801ae2:	55                   	push   %ebp
+  801ae3:	89 e5                	mov    %esp,%ebp
+  801ae5:	57                   	push   %edi
+  801ae6:	56                   	push   %esi
+  801ae7:	53                   	push   %ebx
+  801ae8:	83 ec 1c             	sub    $0x1c,%esp
+  801aeb:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801aee:	8b 75 08             	mov    0x8(%ebp),%esi
+  801af1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801af7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801afb:	75 2b                	jne    801b28 <ipc_try_send_pages+0x46>
+  801afd:	89 e2                	mov    %esp,%edx
+  801aff:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b04:	29 d0                	sub    %edx,%eax
+  801b06:	89 c2                	mov    %eax,%edx
+  801b08:	c1 ea 0f             	shr    $0xf,%edx
+  801b0b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b15:	0f 42 c2             	cmovb  %edx,%eax
+  801b18:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b1f:	8b 70 48             	mov    0x48(%eax),%esi
+  801b22:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801b28:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801b2e:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801b33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b36:	85 ff                	test   %edi,%edi
+  801b38:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801b3d:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  801b40:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801b46:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801b4c:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  801b52:	83 ec 0c             	sub    $0xc,%esp
+  801b55:	ff 75 14             	push   0x14(%ebp)
+  801b58:	ff 75 18             	push   0x18(%ebp)
+  801b5b:	57                   	push   %edi
+  801b5c:	ff 75 0c             	push   0xc(%ebp)
+  801b5f:	ff 75 08             	push   0x8(%ebp)
+  801b62:	e8 b3 f3 ff ff       	call   800f1a <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801b67:	83 c4 20             	add    $0x20,%esp
+  801b6a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b6d:	75 21                	jne    801b90 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801b6f:	83 ec 04             	sub    $0x4,%esp
+  801b72:	6a ff                	push   $0xffffffff
+  801b74:	53                   	push   %ebx
+  801b75:	ff 75 e4             	push   -0x1c(%ebp)
+  801b78:	e8 aa f5 ff ff       	call   801127 <sys_futex_wait>
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801b83:	74 c7                	je     801b4c <ipc_try_send_pages+0x6a>
+  801b85:	85 c0                	test   %eax,%eax
+  801b87:	79 c3                	jns    801b4c <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801b89:	e8 7c f1 ff ff       	call   800d0a <sys_yield>
+  801b8e:	eb bc                	jmp    801b4c <ipc_try_send_pages+0x6a>
+	}
+}
+  801b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b93:	5b                   	pop    %ebx
+  801b94:	5e                   	pop    %esi
+  801b95:	5f                   	pop    %edi
+  801b96:	5d                   	pop    %ebp
+  801b97:	c3                   	ret
+
+00801b98 <ipc_send>:
+{
+  801b98:	55                   	push   %ebp
+  801b99:	89 e5                	mov    %esp,%ebp
+  801b9b:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801b9e:	ff 75 14             	push   0x14(%ebp)
+  801ba1:	6a 01                	push   $0x1
+  801ba3:	ff 75 10             	push   0x10(%ebp)
+  801ba6:	ff 75 0c             	push   0xc(%ebp)
+  801ba9:	ff 75 08             	push   0x8(%ebp)
+  801bac:	e8 31 ff ff ff       	call   801ae2 <ipc_try_send_pages>
+  801bb1:	83 c4 20             	add    $0x20,%esp
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	78 02                	js     801bba <ipc_send+0x22>
+}
+  801bb8:	c9                   	leave
+  801bb9:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801bba:	50                   	push   %eax
+  801bbb:	68 ef 48 80 00       	push   $0x8048ef
+  801bc0:	6a 3f                	push   $0x3f
+  801bc2:	68 04 49 80 00       	push   $0x804904
+  801bc7:	e8 cf 25 00 00       	call   80419b <_panic>
+
+00801bcc <ipc_send_pages>:
+{
+  801bcc:	55                   	push   %ebp
+  801bcd:	89 e5                	mov    %esp,%ebp
+  801bcf:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801bd2:	ff 75 18             	push   0x18(%ebp)
+  801bd5:	ff 75 14             	push   0x14(%ebp)
+  801bd8:	ff 75 10             	push   0x10(%ebp)
+  801bdb:	ff 75 0c             	push   0xc(%ebp)
+  801bde:	ff 75 08             	push   0x8(%ebp)
+  801be1:	e8 fc fe ff ff       	call   801ae2 <ipc_try_send_pages>
+  801be6:	83 c4 20             	add    $0x20,%esp
+  801be9:	85 c0                	test   %eax,%eax
+  801beb:	78 02                	js     801bef <ipc_send_pages+0x23>
+}
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801bef:	50                   	push   %eax
+  801bf0:	68 0e 49 80 00       	push   $0x80490e
+  801bf5:	6a 64                	push   $0x64
+  801bf7:	68 04 49 80 00       	push   $0x804904
+  801bfc:	e8 9a 25 00 00       	call   80419b <_panic>
+
+00801c01 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801c01:	55                   	push   %ebp
+  801c02:	89 e5                	mov    %esp,%ebp
+  801c04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801c07:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801c0c:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801c12:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c18:	8b 52 50             	mov    0x50(%edx),%edx
+  801c1b:	39 ca                	cmp    %ecx,%edx
+  801c1d:	74 11                	je     801c30 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801c1f:	83 c0 01             	add    $0x1,%eax
+  801c22:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c27:	75 e3                	jne    801c0c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2e:	eb 0e                	jmp    801c3e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801c30:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801c36:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c3b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801c3e:	5d                   	pop    %ebp
+  801c3f:	c3                   	ret
+
+00801c40 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c46:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c4b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801c4e:	5d                   	pop    %ebp
+  801c4f:	c3                   	ret
+
+00801c50 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801c50:	55                   	push   %ebp
+  801c51:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c56:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c5b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c60:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801c65:	5d                   	pop    %ebp
+  801c66:	c3                   	ret
+
+00801c67 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c6f:	89 c2                	mov    %eax,%edx
+  801c71:	c1 ea 16             	shr    $0x16,%edx
+  801c74:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c7b:	f6 c2 01             	test   $0x1,%dl
+  801c7e:	74 29                	je     801ca9 <fd_alloc+0x42>
+  801c80:	89 c2                	mov    %eax,%edx
+  801c82:	c1 ea 0c             	shr    $0xc,%edx
+  801c85:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c8c:	f6 c2 01             	test   $0x1,%dl
+  801c8f:	74 18                	je     801ca9 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801c91:	05 00 10 00 00       	add    $0x1000,%eax
+  801c96:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801c9b:	75 d2                	jne    801c6f <fd_alloc+0x8>
+  801c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801ca2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801ca7:	eb 05                	jmp    801cae <fd_alloc+0x47>
+			return 0;
+  801ca9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801cae:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cb1:	89 02                	mov    %eax,(%edx)
+}
+  801cb3:	89 c8                	mov    %ecx,%eax
+  801cb5:	5d                   	pop    %ebp
+  801cb6:	c3                   	ret
+
+00801cb7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+  801cba:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801cbd:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801cc2:	77 30                	ja     801cf4 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801cc4:	c1 e0 0c             	shl    $0xc,%eax
+  801cc7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801ccc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801cd2:	f6 c2 01             	test   $0x1,%dl
+  801cd5:	74 24                	je     801cfb <fd_lookup+0x44>
+  801cd7:	89 c2                	mov    %eax,%edx
+  801cd9:	c1 ea 0c             	shr    $0xc,%edx
+  801cdc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ce3:	f6 c2 01             	test   $0x1,%dl
+  801ce6:	74 1a                	je     801d02 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801ce8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ceb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ced:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cf2:	5d                   	pop    %ebp
+  801cf3:	c3                   	ret
+		return -E_INVAL;
+  801cf4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf9:	eb f7                	jmp    801cf2 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801cfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d00:	eb f0                	jmp    801cf2 <fd_lookup+0x3b>
+  801d02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d07:	eb e9                	jmp    801cf2 <fd_lookup+0x3b>
+
+00801d09 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801d09:	55                   	push   %ebp
+  801d0a:	89 e5                	mov    %esp,%ebp
+  801d0c:	53                   	push   %ebx
+  801d0d:	83 ec 04             	sub    $0x4,%esp
+  801d10:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d18:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801d1d:	39 13                	cmp    %edx,(%ebx)
+  801d1f:	74 54                	je     801d75 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801d21:	83 c0 01             	add    $0x1,%eax
+  801d24:	8b 1c 85 a8 49 80 00 	mov    0x8049a8(,%eax,4),%ebx
+  801d2b:	85 db                	test   %ebx,%ebx
+  801d2d:	75 ee                	jne    801d1d <dev_lookup+0x14>
+  801d2f:	89 e1                	mov    %esp,%ecx
+  801d31:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d36:	29 c8                	sub    %ecx,%eax
+  801d38:	89 c1                	mov    %eax,%ecx
+  801d3a:	c1 e9 0f             	shr    $0xf,%ecx
+  801d3d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d47:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d4a:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801d51:	8b 40 48             	mov    0x48(%eax),%eax
+  801d54:	83 ec 04             	sub    $0x4,%esp
+  801d57:	52                   	push   %edx
+  801d58:	50                   	push   %eax
+  801d59:	68 2c 49 80 00       	push   $0x80492c
+  801d5e:	e8 9b e4 ff ff       	call   8001fe <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801d63:	83 c4 10             	add    $0x10,%esp
+  801d66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801d6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d6e:	89 1a                	mov    %ebx,(%edx)
+}
+  801d70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d73:	c9                   	leave
+  801d74:	c3                   	ret
+			return 0;
+  801d75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7a:	eb ef                	jmp    801d6b <dev_lookup+0x62>
+
+00801d7c <fd_close>:
+{
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	57                   	push   %edi
+  801d80:	56                   	push   %esi
+  801d81:	53                   	push   %ebx
+  801d82:	83 ec 24             	sub    $0x24,%esp
+  801d85:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d88:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d8b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d8e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d8f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d95:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d98:	50                   	push   %eax
+  801d99:	e8 19 ff ff ff       	call   801cb7 <fd_lookup>
+  801d9e:	89 c3                	mov    %eax,%ebx
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 05                	js     801dac <fd_close+0x30>
+	    || fd != fd2)
+  801da7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801daa:	74 0f                	je     801dbb <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801dac:	85 ff                	test   %edi,%edi
+  801dae:	0f 44 df             	cmove  %edi,%ebx
+}
+  801db1:	89 d8                	mov    %ebx,%eax
+  801db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801db6:	5b                   	pop    %ebx
+  801db7:	5e                   	pop    %esi
+  801db8:	5f                   	pop    %edi
+  801db9:	5d                   	pop    %ebp
+  801dba:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801dbb:	83 ec 08             	sub    $0x8,%esp
+  801dbe:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801dc1:	50                   	push   %eax
+  801dc2:	ff 36                	push   (%esi)
+  801dc4:	e8 40 ff ff ff       	call   801d09 <dev_lookup>
+  801dc9:	89 c3                	mov    %eax,%ebx
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	78 1a                	js     801dec <fd_close+0x70>
+		if (dev->dev_close)
+  801dd2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801dd5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801dd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	74 0b                	je     801dec <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801de1:	83 ec 0c             	sub    $0xc,%esp
+  801de4:	56                   	push   %esi
+  801de5:	ff d0                	call   *%eax
+  801de7:	89 c3                	mov    %eax,%ebx
+  801de9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801dec:	83 ec 08             	sub    $0x8,%esp
+  801def:	56                   	push   %esi
+  801df0:	6a 00                	push   $0x0
+  801df2:	e8 b7 ef ff ff       	call   800dae <sys_page_unmap>
+	return r;
+  801df7:	83 c4 10             	add    $0x10,%esp
+  801dfa:	eb b5                	jmp    801db1 <fd_close+0x35>
+
+00801dfc <close>:
+
+int
+close(int fdnum)
+{
+  801dfc:	55                   	push   %ebp
+  801dfd:	89 e5                	mov    %esp,%ebp
+  801dff:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e05:	50                   	push   %eax
+  801e06:	ff 75 08             	push   0x8(%ebp)
+  801e09:	e8 a9 fe ff ff       	call   801cb7 <fd_lookup>
+  801e0e:	83 c4 10             	add    $0x10,%esp
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	79 02                	jns    801e17 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801e15:	c9                   	leave
+  801e16:	c3                   	ret
+		return fd_close(fd, 1);
+  801e17:	83 ec 08             	sub    $0x8,%esp
+  801e1a:	6a 01                	push   $0x1
+  801e1c:	ff 75 f4             	push   -0xc(%ebp)
+  801e1f:	e8 58 ff ff ff       	call   801d7c <fd_close>
+  801e24:	83 c4 10             	add    $0x10,%esp
+  801e27:	eb ec                	jmp    801e15 <close+0x19>
+
+00801e29 <close_all>:
+
+void
+close_all(void)
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	53                   	push   %ebx
+  801e2d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801e35:	83 ec 0c             	sub    $0xc,%esp
+  801e38:	53                   	push   %ebx
+  801e39:	e8 be ff ff ff       	call   801dfc <close>
+	for (i = 0; i < MAXFD; i++)
+  801e3e:	83 c3 01             	add    $0x1,%ebx
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801e4a:	75 e9                	jne    801e35 <close_all+0xc>
+}
+  801e4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	57                   	push   %edi
+  801e55:	56                   	push   %esi
+  801e56:	53                   	push   %ebx
+  801e57:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801e5a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e5d:	50                   	push   %eax
+  801e5e:	ff 75 08             	push   0x8(%ebp)
+  801e61:	e8 51 fe ff ff       	call   801cb7 <fd_lookup>
+  801e66:	89 c3                	mov    %eax,%ebx
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 7f                	js     801eee <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e6f:	83 ec 0c             	sub    $0xc,%esp
+  801e72:	ff 75 0c             	push   0xc(%ebp)
+  801e75:	e8 82 ff ff ff       	call   801dfc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e7a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e7d:	c1 e6 0c             	shl    $0xc,%esi
+  801e80:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e86:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e89:	89 3c 24             	mov    %edi,(%esp)
+  801e8c:	e8 bf fd ff ff       	call   801c50 <fd2data>
+  801e91:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e93:	89 34 24             	mov    %esi,(%esp)
+  801e96:	e8 b5 fd ff ff       	call   801c50 <fd2data>
+  801e9b:	83 c4 10             	add    $0x10,%esp
+  801e9e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801ea1:	89 d8                	mov    %ebx,%eax
+  801ea3:	c1 e8 16             	shr    $0x16,%eax
+  801ea6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ead:	a8 01                	test   $0x1,%al
+  801eaf:	74 11                	je     801ec2 <dup+0x71>
+  801eb1:	89 d8                	mov    %ebx,%eax
+  801eb3:	c1 e8 0c             	shr    $0xc,%eax
+  801eb6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ebd:	f6 c2 01             	test   $0x1,%dl
+  801ec0:	75 36                	jne    801ef8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ec2:	89 f8                	mov    %edi,%eax
+  801ec4:	c1 e8 0c             	shr    $0xc,%eax
+  801ec7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ece:	83 ec 0c             	sub    $0xc,%esp
+  801ed1:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ed6:	50                   	push   %eax
+  801ed7:	56                   	push   %esi
+  801ed8:	6a 00                	push   $0x0
+  801eda:	57                   	push   %edi
+  801edb:	6a 00                	push   $0x0
+  801edd:	e8 8a ee ff ff       	call   800d6c <sys_page_map>
+  801ee2:	89 c3                	mov    %eax,%ebx
+  801ee4:	83 c4 20             	add    $0x20,%esp
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	78 33                	js     801f1e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801eeb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801eee:	89 d8                	mov    %ebx,%eax
+  801ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef3:	5b                   	pop    %ebx
+  801ef4:	5e                   	pop    %esi
+  801ef5:	5f                   	pop    %edi
+  801ef6:	5d                   	pop    %ebp
+  801ef7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ef8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801eff:	83 ec 0c             	sub    $0xc,%esp
+  801f02:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f07:	50                   	push   %eax
+  801f08:	ff 75 d4             	push   -0x2c(%ebp)
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	53                   	push   %ebx
+  801f0e:	6a 00                	push   $0x0
+  801f10:	e8 57 ee ff ff       	call   800d6c <sys_page_map>
+  801f15:	89 c3                	mov    %eax,%ebx
+  801f17:	83 c4 20             	add    $0x20,%esp
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	79 a4                	jns    801ec2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801f1e:	83 ec 08             	sub    $0x8,%esp
+  801f21:	56                   	push   %esi
+  801f22:	6a 00                	push   $0x0
+  801f24:	e8 85 ee ff ff       	call   800dae <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801f29:	83 c4 08             	add    $0x8,%esp
+  801f2c:	ff 75 d4             	push   -0x2c(%ebp)
+  801f2f:	6a 00                	push   $0x0
+  801f31:	e8 78 ee ff ff       	call   800dae <sys_page_unmap>
+	return r;
+  801f36:	83 c4 10             	add    $0x10,%esp
+  801f39:	eb b3                	jmp    801eee <dup+0x9d>
+
+00801f3b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801f3b:	55                   	push   %ebp
+  801f3c:	89 e5                	mov    %esp,%ebp
+  801f3e:	56                   	push   %esi
+  801f3f:	53                   	push   %ebx
+  801f40:	83 ec 18             	sub    $0x18,%esp
+  801f43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f46:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f49:	50                   	push   %eax
+  801f4a:	53                   	push   %ebx
+  801f4b:	e8 67 fd ff ff       	call   801cb7 <fd_lookup>
+  801f50:	83 c4 10             	add    $0x10,%esp
+  801f53:	85 c0                	test   %eax,%eax
+  801f55:	78 3c                	js     801f93 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f57:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f5a:	83 ec 08             	sub    $0x8,%esp
+  801f5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f60:	50                   	push   %eax
+  801f61:	ff 36                	push   (%esi)
+  801f63:	e8 a1 fd ff ff       	call   801d09 <dev_lookup>
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 24                	js     801f93 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f6f:	8b 46 08             	mov    0x8(%esi),%eax
+  801f72:	83 e0 03             	and    $0x3,%eax
+  801f75:	83 f8 01             	cmp    $0x1,%eax
+  801f78:	74 20                	je     801f9a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f7d:	8b 40 08             	mov    0x8(%eax),%eax
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	74 54                	je     801fd8 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f84:	83 ec 04             	sub    $0x4,%esp
+  801f87:	ff 75 10             	push   0x10(%ebp)
+  801f8a:	ff 75 0c             	push   0xc(%ebp)
+  801f8d:	56                   	push   %esi
+  801f8e:	ff d0                	call   *%eax
+  801f90:	83 c4 10             	add    $0x10,%esp
+}
+  801f93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f96:	5b                   	pop    %ebx
+  801f97:	5e                   	pop    %esi
+  801f98:	5d                   	pop    %ebp
+  801f99:	c3                   	ret
+  801f9a:	89 e2                	mov    %esp,%edx
+  801f9c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801fa1:	29 d0                	sub    %edx,%eax
+  801fa3:	89 c2                	mov    %eax,%edx
+  801fa5:	c1 ea 0f             	shr    $0xf,%edx
+  801fa8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb2:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fb5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801fbc:	8b 40 48             	mov    0x48(%eax),%eax
+  801fbf:	83 ec 04             	sub    $0x4,%esp
+  801fc2:	53                   	push   %ebx
+  801fc3:	50                   	push   %eax
+  801fc4:	68 6d 49 80 00       	push   $0x80496d
+  801fc9:	e8 30 e2 ff ff       	call   8001fe <cprintf>
+		return -E_INVAL;
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd6:	eb bb                	jmp    801f93 <read+0x58>
+		return -E_NOT_SUPP;
+  801fd8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fdd:	eb b4                	jmp    801f93 <read+0x58>
+
+00801fdf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801fdf:	55                   	push   %ebp
+  801fe0:	89 e5                	mov    %esp,%ebp
+  801fe2:	57                   	push   %edi
+  801fe3:	56                   	push   %esi
+  801fe4:	53                   	push   %ebx
+  801fe5:	83 ec 0c             	sub    $0xc,%esp
+  801fe8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801feb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801fee:	85 f6                	test   %esi,%esi
+  801ff0:	74 30                	je     802022 <readn+0x43>
+  801ff2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ffc:	83 ec 04             	sub    $0x4,%esp
+  801fff:	89 f2                	mov    %esi,%edx
+  802001:	29 c2                	sub    %eax,%edx
+  802003:	52                   	push   %edx
+  802004:	01 f8                	add    %edi,%eax
+  802006:	50                   	push   %eax
+  802007:	ff 75 08             	push   0x8(%ebp)
+  80200a:	e8 2c ff ff ff       	call   801f3b <read>
+		if (m < 0)
+  80200f:	83 c4 10             	add    $0x10,%esp
+  802012:	85 c0                	test   %eax,%eax
+  802014:	78 15                	js     80202b <readn+0x4c>
+			return m;
+		if (m == 0)
+  802016:	74 11                	je     802029 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802018:	01 c3                	add    %eax,%ebx
+  80201a:	89 d8                	mov    %ebx,%eax
+  80201c:	39 f3                	cmp    %esi,%ebx
+  80201e:	72 dc                	jb     801ffc <readn+0x1d>
+  802020:	eb 09                	jmp    80202b <readn+0x4c>
+  802022:	b8 00 00 00 00       	mov    $0x0,%eax
+  802027:	eb 02                	jmp    80202b <readn+0x4c>
+  802029:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80202b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80202e:	5b                   	pop    %ebx
+  80202f:	5e                   	pop    %esi
+  802030:	5f                   	pop    %edi
+  802031:	5d                   	pop    %ebp
+  802032:	c3                   	ret
+
+00802033 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	56                   	push   %esi
+  802037:	53                   	push   %ebx
+  802038:	83 ec 18             	sub    $0x18,%esp
+  80203b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80203e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802041:	50                   	push   %eax
+  802042:	53                   	push   %ebx
+  802043:	e8 6f fc ff ff       	call   801cb7 <fd_lookup>
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	78 37                	js     802086 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80204f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802052:	83 ec 08             	sub    $0x8,%esp
+  802055:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802058:	50                   	push   %eax
+  802059:	ff 36                	push   (%esi)
+  80205b:	e8 a9 fc ff ff       	call   801d09 <dev_lookup>
+  802060:	83 c4 10             	add    $0x10,%esp
+  802063:	85 c0                	test   %eax,%eax
+  802065:	78 1f                	js     802086 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802067:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80206b:	74 20                	je     80208d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80206d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802070:	8b 40 0c             	mov    0xc(%eax),%eax
+  802073:	85 c0                	test   %eax,%eax
+  802075:	74 54                	je     8020cb <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802077:	83 ec 04             	sub    $0x4,%esp
+  80207a:	ff 75 10             	push   0x10(%ebp)
+  80207d:	ff 75 0c             	push   0xc(%ebp)
+  802080:	56                   	push   %esi
+  802081:	ff d0                	call   *%eax
+  802083:	83 c4 10             	add    $0x10,%esp
+}
+  802086:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802089:	5b                   	pop    %ebx
+  80208a:	5e                   	pop    %esi
+  80208b:	5d                   	pop    %ebp
+  80208c:	c3                   	ret
+  80208d:	89 e2                	mov    %esp,%edx
+  80208f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802094:	29 d0                	sub    %edx,%eax
+  802096:	89 c2                	mov    %eax,%edx
+  802098:	c1 ea 0f             	shr    $0xf,%edx
+  80209b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a5:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a8:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8020af:	8b 40 48             	mov    0x48(%eax),%eax
+  8020b2:	83 ec 04             	sub    $0x4,%esp
+  8020b5:	53                   	push   %ebx
+  8020b6:	50                   	push   %eax
+  8020b7:	68 89 49 80 00       	push   $0x804989
+  8020bc:	e8 3d e1 ff ff       	call   8001fe <cprintf>
+		return -E_INVAL;
+  8020c1:	83 c4 10             	add    $0x10,%esp
+  8020c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020c9:	eb bb                	jmp    802086 <write+0x53>
+		return -E_NOT_SUPP;
+  8020cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020d0:	eb b4                	jmp    802086 <write+0x53>
+
+008020d2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8020d2:	55                   	push   %ebp
+  8020d3:	89 e5                	mov    %esp,%ebp
+  8020d5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020db:	50                   	push   %eax
+  8020dc:	ff 75 08             	push   0x8(%ebp)
+  8020df:	e8 d3 fb ff ff       	call   801cb7 <fd_lookup>
+  8020e4:	83 c4 10             	add    $0x10,%esp
+  8020e7:	85 c0                	test   %eax,%eax
+  8020e9:	78 0e                	js     8020f9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8020eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8020f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f9:	c9                   	leave
+  8020fa:	c3                   	ret
+
+008020fb <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8020fb:	55                   	push   %ebp
+  8020fc:	89 e5                	mov    %esp,%ebp
+  8020fe:	53                   	push   %ebx
+  8020ff:	83 ec 1c             	sub    $0x1c,%esp
+  802102:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802105:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802108:	50                   	push   %eax
+  802109:	ff 75 08             	push   0x8(%ebp)
+  80210c:	e8 a6 fb ff ff       	call   801cb7 <fd_lookup>
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	85 c0                	test   %eax,%eax
+  802116:	78 33                	js     80214b <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802118:	83 fb 03             	cmp    $0x3,%ebx
+  80211b:	74 28                	je     802145 <fcntl+0x4a>
+  80211d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802122:	83 fb 04             	cmp    $0x4,%ebx
+  802125:	75 24                	jne    80214b <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802127:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80212a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80212d:	80 e4 ef             	and    $0xef,%ah
+  802130:	8b 55 10             	mov    0x10(%ebp),%edx
+  802133:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802139:	09 d0                	or     %edx,%eax
+  80213b:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80213e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802143:	eb 06                	jmp    80214b <fcntl+0x50>
+		return fd->fd_omode;
+  802145:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802148:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80214b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214e:	c9                   	leave
+  80214f:	c3                   	ret
+
+00802150 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802150:	55                   	push   %ebp
+  802151:	89 e5                	mov    %esp,%ebp
+  802153:	56                   	push   %esi
+  802154:	53                   	push   %ebx
+  802155:	83 ec 18             	sub    $0x18,%esp
+  802158:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80215b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80215e:	50                   	push   %eax
+  80215f:	53                   	push   %ebx
+  802160:	e8 52 fb ff ff       	call   801cb7 <fd_lookup>
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	78 34                	js     8021a0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80216c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80216f:	83 ec 08             	sub    $0x8,%esp
+  802172:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802175:	50                   	push   %eax
+  802176:	ff 36                	push   (%esi)
+  802178:	e8 8c fb ff ff       	call   801d09 <dev_lookup>
+  80217d:	83 c4 10             	add    $0x10,%esp
+  802180:	85 c0                	test   %eax,%eax
+  802182:	78 1c                	js     8021a0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802184:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802188:	74 1d                	je     8021a7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80218a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218d:	8b 40 18             	mov    0x18(%eax),%eax
+  802190:	85 c0                	test   %eax,%eax
+  802192:	74 51                	je     8021e5 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802194:	83 ec 08             	sub    $0x8,%esp
+  802197:	ff 75 0c             	push   0xc(%ebp)
+  80219a:	56                   	push   %esi
+  80219b:	ff d0                	call   *%eax
+  80219d:	83 c4 10             	add    $0x10,%esp
+}
+  8021a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a3:	5b                   	pop    %ebx
+  8021a4:	5e                   	pop    %esi
+  8021a5:	5d                   	pop    %ebp
+  8021a6:	c3                   	ret
+  8021a7:	89 e2                	mov    %esp,%edx
+  8021a9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8021ae:	29 d0                	sub    %edx,%eax
+  8021b0:	89 c2                	mov    %eax,%edx
+  8021b2:	c1 ea 0f             	shr    $0xf,%edx
+  8021b5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8021ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021bf:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8021c2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8021c9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021cc:	83 ec 04             	sub    $0x4,%esp
+  8021cf:	53                   	push   %ebx
+  8021d0:	50                   	push   %eax
+  8021d1:	68 4c 49 80 00       	push   $0x80494c
+  8021d6:	e8 23 e0 ff ff       	call   8001fe <cprintf>
+		return -E_INVAL;
+  8021db:	83 c4 10             	add    $0x10,%esp
+  8021de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021e3:	eb bb                	jmp    8021a0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8021e5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021ea:	eb b4                	jmp    8021a0 <ftruncate+0x50>
+
+008021ec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8021ec:	55                   	push   %ebp
+  8021ed:	89 e5                	mov    %esp,%ebp
+  8021ef:	56                   	push   %esi
+  8021f0:	53                   	push   %ebx
+  8021f1:	83 ec 18             	sub    $0x18,%esp
+  8021f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021fa:	50                   	push   %eax
+  8021fb:	ff 75 08             	push   0x8(%ebp)
+  8021fe:	e8 b4 fa ff ff       	call   801cb7 <fd_lookup>
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	85 c0                	test   %eax,%eax
+  802208:	78 53                	js     80225d <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80220a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80220d:	83 ec 08             	sub    $0x8,%esp
+  802210:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802213:	50                   	push   %eax
+  802214:	ff 36                	push   (%esi)
+  802216:	e8 ee fa ff ff       	call   801d09 <dev_lookup>
+  80221b:	83 c4 10             	add    $0x10,%esp
+  80221e:	85 c0                	test   %eax,%eax
+  802220:	78 3b                	js     80225d <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802222:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802225:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802229:	74 39                	je     802264 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80222b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80222e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802235:	00 00 00 
+	stat->st_isdir = 0;
+  802238:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80223f:	00 00 00 
+	stat->st_version = 0;
+  802242:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802249:	00 00 00 
+	stat->st_dev = dev;
+  80224c:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802252:	83 ec 08             	sub    $0x8,%esp
+  802255:	53                   	push   %ebx
+  802256:	56                   	push   %esi
+  802257:	ff 50 14             	call   *0x14(%eax)
+  80225a:	83 c4 10             	add    $0x10,%esp
+}
+  80225d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802260:	5b                   	pop    %ebx
+  802261:	5e                   	pop    %esi
+  802262:	5d                   	pop    %ebp
+  802263:	c3                   	ret
+		return -E_NOT_SUPP;
+  802264:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802269:	eb f2                	jmp    80225d <fstat+0x71>
+
+0080226b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	56                   	push   %esi
+  80226f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802270:	83 ec 08             	sub    $0x8,%esp
+  802273:	6a 00                	push   $0x0
+  802275:	ff 75 08             	push   0x8(%ebp)
+  802278:	e8 b7 01 00 00       	call   802434 <open>
+  80227d:	89 c3                	mov    %eax,%ebx
+  80227f:	83 c4 10             	add    $0x10,%esp
+  802282:	85 c0                	test   %eax,%eax
+  802284:	78 1b                	js     8022a1 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802286:	83 ec 08             	sub    $0x8,%esp
+  802289:	ff 75 0c             	push   0xc(%ebp)
+  80228c:	50                   	push   %eax
+  80228d:	e8 5a ff ff ff       	call   8021ec <fstat>
+  802292:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802294:	89 1c 24             	mov    %ebx,(%esp)
+  802297:	e8 60 fb ff ff       	call   801dfc <close>
+	return r;
+  80229c:	83 c4 10             	add    $0x10,%esp
+  80229f:	89 f3                	mov    %esi,%ebx
+}
+  8022a1:	89 d8                	mov    %ebx,%eax
+  8022a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022a6:	5b                   	pop    %ebx
+  8022a7:	5e                   	pop    %esi
+  8022a8:	5d                   	pop    %ebp
+  8022a9:	c3                   	ret
+
+008022aa <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8022aa:	55                   	push   %ebp
+  8022ab:	89 e5                	mov    %esp,%ebp
+  8022ad:	56                   	push   %esi
+  8022ae:	53                   	push   %ebx
+  8022af:	89 c6                	mov    %eax,%esi
+  8022b1:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8022b3:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8022ba:	74 27                	je     8022e3 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8022bc:	6a 07                	push   $0x7
+  8022be:	68 00 70 80 00       	push   $0x807000
+  8022c3:	56                   	push   %esi
+  8022c4:	ff 35 c4 66 80 00    	push   0x8066c4
+  8022ca:	e8 c9 f8 ff ff       	call   801b98 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8022cf:	83 c4 0c             	add    $0xc,%esp
+  8022d2:	6a 00                	push   $0x0
+  8022d4:	53                   	push   %ebx
+  8022d5:	6a 00                	push   $0x0
+  8022d7:	e8 2c f6 ff ff       	call   801908 <ipc_recv>
+}
+  8022dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022df:	5b                   	pop    %ebx
+  8022e0:	5e                   	pop    %esi
+  8022e1:	5d                   	pop    %ebp
+  8022e2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022e3:	83 ec 0c             	sub    $0xc,%esp
+  8022e6:	6a 02                	push   $0x2
+  8022e8:	e8 14 f9 ff ff       	call   801c01 <ipc_find_env>
+  8022ed:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  8022f2:	83 c4 10             	add    $0x10,%esp
+  8022f5:	eb c5                	jmp    8022bc <fsipc+0x12>
+
+008022f7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8022f7:	55                   	push   %ebp
+  8022f8:	89 e5                	mov    %esp,%ebp
+  8022fa:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802300:	8b 40 0c             	mov    0xc(%eax),%eax
+  802303:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802308:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80230b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802310:	ba 00 00 00 00       	mov    $0x0,%edx
+  802315:	b8 02 00 00 00       	mov    $0x2,%eax
+  80231a:	e8 8b ff ff ff       	call   8022aa <fsipc>
+}
+  80231f:	c9                   	leave
+  802320:	c3                   	ret
+
+00802321 <devfile_flush>:
+{
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802327:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80232d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802332:	ba 00 00 00 00       	mov    $0x0,%edx
+  802337:	b8 06 00 00 00       	mov    $0x6,%eax
+  80233c:	e8 69 ff ff ff       	call   8022aa <fsipc>
+}
+  802341:	c9                   	leave
+  802342:	c3                   	ret
+
+00802343 <devfile_stat>:
+{
+  802343:	55                   	push   %ebp
+  802344:	89 e5                	mov    %esp,%ebp
+  802346:	53                   	push   %ebx
+  802347:	83 ec 04             	sub    $0x4,%esp
+  80234a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80234d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802350:	8b 40 0c             	mov    0xc(%eax),%eax
+  802353:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802358:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802362:	e8 43 ff ff ff       	call   8022aa <fsipc>
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 37                	js     8023a2 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80236b:	83 ec 08             	sub    $0x8,%esp
+  80236e:	68 00 70 80 00       	push   $0x807000
+  802373:	53                   	push   %ebx
+  802374:	e8 7c e5 ff ff       	call   8008f5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802379:	a1 80 70 80 00       	mov    0x807080,%eax
+  80237e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802384:	a1 84 70 80 00       	mov    0x807084,%eax
+  802389:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80238f:	a1 88 70 80 00       	mov    0x807088,%eax
+  802394:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80239a:	83 c4 10             	add    $0x10,%esp
+  80239d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a5:	c9                   	leave
+  8023a6:	c3                   	ret
+
+008023a7 <devfile_write>:
+{
+  8023a7:	55                   	push   %ebp
+  8023a8:	89 e5                	mov    %esp,%ebp
+  8023aa:	83 ec 0c             	sub    $0xc,%esp
+  8023ad:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8023b0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8023b5:	39 d0                	cmp    %edx,%eax
+  8023b7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023bd:	8b 52 0c             	mov    0xc(%edx),%edx
+  8023c0:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8023c6:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8023cb:	50                   	push   %eax
+  8023cc:	ff 75 0c             	push   0xc(%ebp)
+  8023cf:	68 08 70 80 00       	push   $0x807008
+  8023d4:	e8 cc e6 ff ff       	call   800aa5 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8023d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023de:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023e3:	e8 c2 fe ff ff       	call   8022aa <fsipc>
+}
+  8023e8:	c9                   	leave
+  8023e9:	c3                   	ret
+
+008023ea <devfile_read>:
+{
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	53                   	push   %ebx
+  8023ee:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023f7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8023fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023ff:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802404:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802409:	b8 03 00 00 00       	mov    $0x3,%eax
+  80240e:	e8 97 fe ff ff       	call   8022aa <fsipc>
+  802413:	89 c3                	mov    %eax,%ebx
+  802415:	85 c0                	test   %eax,%eax
+  802417:	78 14                	js     80242d <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802419:	83 ec 04             	sub    $0x4,%esp
+  80241c:	50                   	push   %eax
+  80241d:	68 00 70 80 00       	push   $0x807000
+  802422:	ff 75 0c             	push   0xc(%ebp)
+  802425:	e8 7b e6 ff ff       	call   800aa5 <memmove>
+	return r;
+  80242a:	83 c4 10             	add    $0x10,%esp
+}
+  80242d:	89 d8                	mov    %ebx,%eax
+  80242f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802432:	c9                   	leave
+  802433:	c3                   	ret
+
+00802434 <open>:
+{
+  802434:	55                   	push   %ebp
+  802435:	89 e5                	mov    %esp,%ebp
+  802437:	53                   	push   %ebx
+  802438:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80243b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80243e:	50                   	push   %eax
+  80243f:	e8 23 f8 ff ff       	call   801c67 <fd_alloc>
+  802444:	89 c3                	mov    %eax,%ebx
+  802446:	83 c4 10             	add    $0x10,%esp
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	78 2a                	js     802477 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+  802450:	ff 75 08             	push   0x8(%ebp)
+  802453:	e8 51 e4 ff ff       	call   8008a9 <strlen>
+  802458:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80245b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802460:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802465:	7e 17                	jle    80247e <open+0x4a>
+	fd_close(fd, 1);
+  802467:	83 ec 08             	sub    $0x8,%esp
+  80246a:	6a 01                	push   $0x1
+  80246c:	ff 75 f4             	push   -0xc(%ebp)
+  80246f:	e8 08 f9 ff ff       	call   801d7c <fd_close>
+	return r;
+  802474:	83 c4 10             	add    $0x10,%esp
+}
+  802477:	89 d8                	mov    %ebx,%eax
+  802479:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80247c:	c9                   	leave
+  80247d:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80247e:	83 ec 08             	sub    $0x8,%esp
+  802481:	ff 75 08             	push   0x8(%ebp)
+  802484:	68 00 70 80 00       	push   $0x807000
+  802489:	e8 67 e4 ff ff       	call   8008f5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80248e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802491:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802496:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802499:	b8 01 00 00 00       	mov    $0x1,%eax
+  80249e:	e8 07 fe ff ff       	call   8022aa <fsipc>
+  8024a3:	89 c3                	mov    %eax,%ebx
+  8024a5:	83 c4 10             	add    $0x10,%esp
+  8024a8:	85 c0                	test   %eax,%eax
+  8024aa:	78 bb                	js     802467 <open+0x33>
+	return fd2num(fd); 	
+  8024ac:	83 ec 0c             	sub    $0xc,%esp
+  8024af:	ff 75 f4             	push   -0xc(%ebp)
+  8024b2:	e8 89 f7 ff ff       	call   801c40 <fd2num>
+  8024b7:	89 c3                	mov    %eax,%ebx
+  8024b9:	83 c4 10             	add    $0x10,%esp
+  8024bc:	eb b9                	jmp    802477 <open+0x43>
+
+008024be <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	53                   	push   %ebx
+  8024c2:	83 ec 1c             	sub    $0x1c,%esp
+  8024c5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024cb:	50                   	push   %eax
+  8024cc:	ff 75 08             	push   0x8(%ebp)
+  8024cf:	e8 e3 f7 ff ff       	call   801cb7 <fd_lookup>
+  8024d4:	83 c4 10             	add    $0x10,%esp
+  8024d7:	85 c0                	test   %eax,%eax
+  8024d9:	78 5a                	js     802535 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8024db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024de:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8024e4:	39 10                	cmp    %edx,(%eax)
+  8024e6:	75 66                	jne    80254e <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8024e8:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8024ef:	74 49                	je     80253a <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8024f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024f7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  8024fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ff:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802504:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80250a:	6a 07                	push   $0x7
+  80250c:	68 00 70 80 00       	push   $0x807000
+  802511:	6a 09                	push   $0x9
+  802513:	ff 35 c4 66 80 00    	push   0x8066c4
+  802519:	e8 7a f6 ff ff       	call   801b98 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80251e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802525:	6a 00                	push   $0x0
+  802527:	53                   	push   %ebx
+  802528:	ff 75 10             	push   0x10(%ebp)
+  80252b:	6a 00                	push   $0x0
+  80252d:	e8 a3 f4 ff ff       	call   8019d5 <ipc_recv_pages>
+  802532:	83 c4 20             	add    $0x20,%esp
+}
+  802535:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802538:	c9                   	leave
+  802539:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80253a:	83 ec 0c             	sub    $0xc,%esp
+  80253d:	6a 02                	push   $0x2
+  80253f:	e8 bd f6 ff ff       	call   801c01 <ipc_find_env>
+  802544:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802549:	83 c4 10             	add    $0x10,%esp
+  80254c:	eb a3                	jmp    8024f1 <fmap+0x33>
+		return -E_INVAL;
+  80254e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802553:	eb e0                	jmp    802535 <fmap+0x77>
+
+00802555 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802555:	55                   	push   %ebp
+  802556:	89 e5                	mov    %esp,%ebp
+  802558:	53                   	push   %ebx
+  802559:	83 ec 10             	sub    $0x10,%esp
+  80255c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80255f:	53                   	push   %ebx
+  802560:	e8 44 e3 ff ff       	call   8008a9 <strlen>
+  802565:	83 c4 10             	add    $0x10,%esp
+  802568:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80256d:	7f 25                	jg     802594 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80256f:	83 ec 08             	sub    $0x8,%esp
+  802572:	53                   	push   %ebx
+  802573:	68 00 70 80 00       	push   $0x807000
+  802578:	e8 78 e3 ff ff       	call   8008f5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80257d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802582:	b8 07 00 00 00       	mov    $0x7,%eax
+  802587:	e8 1e fd ff ff       	call   8022aa <fsipc>
+  80258c:	83 c4 10             	add    $0x10,%esp
+}
+  80258f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802592:	c9                   	leave
+  802593:	c3                   	ret
+		return -E_BAD_PATH;
+  802594:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802599:	eb f4                	jmp    80258f <remove+0x3a>
+
+0080259b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80259b:	55                   	push   %ebp
+  80259c:	89 e5                	mov    %esp,%ebp
+  80259e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8025a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025ab:	e8 fa fc ff ff       	call   8022aa <fsipc>
+}
+  8025b0:	c9                   	leave
+  8025b1:	c3                   	ret
+
+008025b2 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025b2:	55                   	push   %ebp
+  8025b3:	89 e5                	mov    %esp,%ebp
+  8025b5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8025b8:	68 bc 49 80 00       	push   $0x8049bc
+  8025bd:	ff 75 0c             	push   0xc(%ebp)
+  8025c0:	e8 30 e3 ff ff       	call   8008f5 <strcpy>
+	return 0;
+}
+  8025c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ca:	c9                   	leave
+  8025cb:	c3                   	ret
+
+008025cc <devsock_close>:
+{
+  8025cc:	55                   	push   %ebp
+  8025cd:	89 e5                	mov    %esp,%ebp
+  8025cf:	53                   	push   %ebx
+  8025d0:	83 ec 10             	sub    $0x10,%esp
+  8025d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8025d6:	53                   	push   %ebx
+  8025d7:	e8 69 1c 00 00       	call   804245 <pageref>
+  8025dc:	89 c2                	mov    %eax,%edx
+  8025de:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8025e1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8025e6:	83 fa 01             	cmp    $0x1,%edx
+  8025e9:	74 05                	je     8025f0 <devsock_close+0x24>
+}
+  8025eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ee:	c9                   	leave
+  8025ef:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8025f0:	83 ec 0c             	sub    $0xc,%esp
+  8025f3:	ff 73 0c             	push   0xc(%ebx)
+  8025f6:	e8 b0 05 00 00       	call   802bab <nsipc_close>
+  8025fb:	83 c4 10             	add    $0x10,%esp
+  8025fe:	eb eb                	jmp    8025eb <devsock_close+0x1f>
+
+00802600 <devsock_write>:
+{
+  802600:	55                   	push   %ebp
+  802601:	89 e5                	mov    %esp,%ebp
+  802603:	53                   	push   %ebx
+  802604:	83 ec 14             	sub    $0x14,%esp
+  802607:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80260a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80260d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802610:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802613:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802616:	8b 41 08             	mov    0x8(%ecx),%eax
+  802619:	c1 f8 09             	sar    $0x9,%eax
+  80261c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80261f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802625:	77 13                	ja     80263a <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802627:	50                   	push   %eax
+  802628:	52                   	push   %edx
+  802629:	53                   	push   %ebx
+  80262a:	ff 71 0c             	push   0xc(%ecx)
+  80262d:	e8 5c 06 00 00       	call   802c8e <nsipc_send>
+  802632:	83 c4 10             	add    $0x10,%esp
+}
+  802635:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802638:	c9                   	leave
+  802639:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80263a:	50                   	push   %eax
+  80263b:	6a 01                	push   $0x1
+  80263d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802640:	50                   	push   %eax
+  802641:	ff 71 0c             	push   0xc(%ecx)
+  802644:	e8 a6 06 00 00       	call   802cef <nsipc_sendmsg>
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	eb e7                	jmp    802635 <devsock_write+0x35>
+
+0080264e <devsock_read>:
+{
+  80264e:	55                   	push   %ebp
+  80264f:	89 e5                	mov    %esp,%ebp
+  802651:	53                   	push   %ebx
+  802652:	83 ec 14             	sub    $0x14,%esp
+  802655:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802658:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80265b:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80265e:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802661:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802664:	8b 41 08             	mov    0x8(%ecx),%eax
+  802667:	c1 f8 09             	sar    $0x9,%eax
+  80266a:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80266d:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802673:	77 13                	ja     802688 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802675:	50                   	push   %eax
+  802676:	52                   	push   %edx
+  802677:	53                   	push   %ebx
+  802678:	ff 71 0c             	push   0xc(%ecx)
+  80267b:	e8 9c 05 00 00       	call   802c1c <nsipc_recv>
+  802680:	83 c4 10             	add    $0x10,%esp
+}
+  802683:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802686:	c9                   	leave
+  802687:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802688:	50                   	push   %eax
+  802689:	6a 01                	push   $0x1
+  80268b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80268e:	50                   	push   %eax
+  80268f:	ff 71 0c             	push   0xc(%ecx)
+  802692:	e8 02 0a 00 00       	call   803099 <nsipc_recvmsg>
+  802697:	83 c4 10             	add    $0x10,%esp
+  80269a:	eb e7                	jmp    802683 <devsock_read+0x35>
+
+0080269c <fd2sockid>:
+{
+  80269c:	55                   	push   %ebp
+  80269d:	89 e5                	mov    %esp,%ebp
+  80269f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026a2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026a5:	52                   	push   %edx
+  8026a6:	50                   	push   %eax
+  8026a7:	e8 0b f6 ff ff       	call   801cb7 <fd_lookup>
+  8026ac:	83 c4 10             	add    $0x10,%esp
+  8026af:	85 c0                	test   %eax,%eax
+  8026b1:	78 10                	js     8026c3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026b6:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8026bc:	39 08                	cmp    %ecx,(%eax)
+  8026be:	75 05                	jne    8026c5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8026c0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026c3:	c9                   	leave
+  8026c4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026c5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026ca:	eb f7                	jmp    8026c3 <fd2sockid+0x27>
+
+008026cc <sock_flags>:
+{
+  8026cc:	55                   	push   %ebp
+  8026cd:	89 e5                	mov    %esp,%ebp
+  8026cf:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8026d2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026d5:	52                   	push   %edx
+  8026d6:	50                   	push   %eax
+  8026d7:	e8 db f5 ff ff       	call   801cb7 <fd_lookup>
+  8026dc:	83 c4 10             	add    $0x10,%esp
+  8026df:	85 c0                	test   %eax,%eax
+  8026e1:	78 0e                	js     8026f1 <sock_flags+0x25>
+  8026e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026e6:	8b 40 08             	mov    0x8(%eax),%eax
+  8026e9:	c1 e8 09             	shr    $0x9,%eax
+  8026ec:	83 e0 08             	and    $0x8,%eax
+}
+  8026ef:	c9                   	leave
+  8026f0:	c3                   	ret
+		return 0;
+  8026f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f6:	eb f7                	jmp    8026ef <sock_flags+0x23>
+
+008026f8 <alloc_sockfd>:
+{
+  8026f8:	55                   	push   %ebp
+  8026f9:	89 e5                	mov    %esp,%ebp
+  8026fb:	56                   	push   %esi
+  8026fc:	53                   	push   %ebx
+  8026fd:	83 ec 1c             	sub    $0x1c,%esp
+  802700:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802702:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802705:	50                   	push   %eax
+  802706:	e8 5c f5 ff ff       	call   801c67 <fd_alloc>
+  80270b:	89 c3                	mov    %eax,%ebx
+  80270d:	83 c4 10             	add    $0x10,%esp
+  802710:	85 c0                	test   %eax,%eax
+  802712:	78 43                	js     802757 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802714:	83 ec 04             	sub    $0x4,%esp
+  802717:	68 07 04 00 00       	push   $0x407
+  80271c:	ff 75 f4             	push   -0xc(%ebp)
+  80271f:	6a 00                	push   $0x0
+  802721:	e8 03 e6 ff ff       	call   800d29 <sys_page_alloc>
+  802726:	89 c3                	mov    %eax,%ebx
+  802728:	83 c4 10             	add    $0x10,%esp
+  80272b:	85 c0                	test   %eax,%eax
+  80272d:	78 28                	js     802757 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80272f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802732:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802738:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80273a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80273d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802744:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802747:	83 ec 0c             	sub    $0xc,%esp
+  80274a:	50                   	push   %eax
+  80274b:	e8 f0 f4 ff ff       	call   801c40 <fd2num>
+  802750:	89 c3                	mov    %eax,%ebx
+  802752:	83 c4 10             	add    $0x10,%esp
+  802755:	eb 0c                	jmp    802763 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802757:	83 ec 0c             	sub    $0xc,%esp
+  80275a:	56                   	push   %esi
+  80275b:	e8 4b 04 00 00       	call   802bab <nsipc_close>
+		return r;
+  802760:	83 c4 10             	add    $0x10,%esp
+}
+  802763:	89 d8                	mov    %ebx,%eax
+  802765:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802768:	5b                   	pop    %ebx
+  802769:	5e                   	pop    %esi
+  80276a:	5d                   	pop    %ebp
+  80276b:	c3                   	ret
+
+0080276c <accept>:
+{
+  80276c:	55                   	push   %ebp
+  80276d:	89 e5                	mov    %esp,%ebp
+  80276f:	56                   	push   %esi
+  802770:	53                   	push   %ebx
+  802771:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802774:	89 f0                	mov    %esi,%eax
+  802776:	e8 21 ff ff ff       	call   80269c <fd2sockid>
+  80277b:	89 c3                	mov    %eax,%ebx
+  80277d:	85 c0                	test   %eax,%eax
+  80277f:	78 24                	js     8027a5 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802781:	89 f0                	mov    %esi,%eax
+  802783:	e8 44 ff ff ff       	call   8026cc <sock_flags>
+  802788:	50                   	push   %eax
+  802789:	ff 75 10             	push   0x10(%ebp)
+  80278c:	ff 75 0c             	push   0xc(%ebp)
+  80278f:	53                   	push   %ebx
+  802790:	e8 6b 03 00 00       	call   802b00 <nsipc_accept>
+  802795:	89 c3                	mov    %eax,%ebx
+  802797:	83 c4 10             	add    $0x10,%esp
+  80279a:	85 c0                	test   %eax,%eax
+  80279c:	78 07                	js     8027a5 <accept+0x39>
+	return alloc_sockfd(r);
+  80279e:	e8 55 ff ff ff       	call   8026f8 <alloc_sockfd>
+  8027a3:	89 c3                	mov    %eax,%ebx
+}
+  8027a5:	89 d8                	mov    %ebx,%eax
+  8027a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027aa:	5b                   	pop    %ebx
+  8027ab:	5e                   	pop    %esi
+  8027ac:	5d                   	pop    %ebp
+  8027ad:	c3                   	ret
+
+008027ae <bind>:
+{
+  8027ae:	55                   	push   %ebp
+  8027af:	89 e5                	mov    %esp,%ebp
+  8027b1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b7:	e8 e0 fe ff ff       	call   80269c <fd2sockid>
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	78 12                	js     8027d2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8027c0:	83 ec 04             	sub    $0x4,%esp
+  8027c3:	ff 75 10             	push   0x10(%ebp)
+  8027c6:	ff 75 0c             	push   0xc(%ebp)
+  8027c9:	50                   	push   %eax
+  8027ca:	e8 85 03 00 00       	call   802b54 <nsipc_bind>
+  8027cf:	83 c4 10             	add    $0x10,%esp
+}
+  8027d2:	c9                   	leave
+  8027d3:	c3                   	ret
+
+008027d4 <shutdown>:
+{
+  8027d4:	55                   	push   %ebp
+  8027d5:	89 e5                	mov    %esp,%ebp
+  8027d7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027dd:	e8 ba fe ff ff       	call   80269c <fd2sockid>
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	78 0f                	js     8027f5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027e6:	83 ec 08             	sub    $0x8,%esp
+  8027e9:	ff 75 0c             	push   0xc(%ebp)
+  8027ec:	50                   	push   %eax
+  8027ed:	e8 97 03 00 00       	call   802b89 <nsipc_shutdown>
+  8027f2:	83 c4 10             	add    $0x10,%esp
+}
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+
+008027f7 <connect>:
+{
+  8027f7:	55                   	push   %ebp
+  8027f8:	89 e5                	mov    %esp,%ebp
+  8027fa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802800:	e8 97 fe ff ff       	call   80269c <fd2sockid>
+  802805:	85 c0                	test   %eax,%eax
+  802807:	78 12                	js     80281b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802809:	83 ec 04             	sub    $0x4,%esp
+  80280c:	ff 75 10             	push   0x10(%ebp)
+  80280f:	ff 75 0c             	push   0xc(%ebp)
+  802812:	50                   	push   %eax
+  802813:	e8 ad 03 00 00       	call   802bc5 <nsipc_connect>
+  802818:	83 c4 10             	add    $0x10,%esp
+}
+  80281b:	c9                   	leave
+  80281c:	c3                   	ret
+
+0080281d <listen>:
+{
+  80281d:	55                   	push   %ebp
+  80281e:	89 e5                	mov    %esp,%ebp
+  802820:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802823:	8b 45 08             	mov    0x8(%ebp),%eax
+  802826:	e8 71 fe ff ff       	call   80269c <fd2sockid>
+  80282b:	85 c0                	test   %eax,%eax
+  80282d:	78 0f                	js     80283e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80282f:	83 ec 08             	sub    $0x8,%esp
+  802832:	ff 75 0c             	push   0xc(%ebp)
+  802835:	50                   	push   %eax
+  802836:	e8 bf 03 00 00       	call   802bfa <nsipc_listen>
+  80283b:	83 c4 10             	add    $0x10,%esp
+}
+  80283e:	c9                   	leave
+  80283f:	c3                   	ret
+
+00802840 <sendmsg>:
+{
+  802840:	55                   	push   %ebp
+  802841:	89 e5                	mov    %esp,%ebp
+  802843:	57                   	push   %edi
+  802844:	56                   	push   %esi
+  802845:	53                   	push   %ebx
+  802846:	83 ec 0c             	sub    $0xc,%esp
+  802849:	8b 75 08             	mov    0x8(%ebp),%esi
+  80284c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80284f:	89 f0                	mov    %esi,%eax
+  802851:	e8 46 fe ff ff       	call   80269c <fd2sockid>
+  802856:	89 c3                	mov    %eax,%ebx
+  802858:	85 c0                	test   %eax,%eax
+  80285a:	78 1c                	js     802878 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80285c:	89 f0                	mov    %esi,%eax
+  80285e:	e8 69 fe ff ff       	call   8026cc <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802863:	0b 45 10             	or     0x10(%ebp),%eax
+  802866:	50                   	push   %eax
+  802867:	ff 77 0c             	push   0xc(%edi)
+  80286a:	ff 77 08             	push   0x8(%edi)
+  80286d:	53                   	push   %ebx
+  80286e:	e8 7c 04 00 00       	call   802cef <nsipc_sendmsg>
+  802873:	89 c3                	mov    %eax,%ebx
+  802875:	83 c4 10             	add    $0x10,%esp
+}
+  802878:	89 d8                	mov    %ebx,%eax
+  80287a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80287d:	5b                   	pop    %ebx
+  80287e:	5e                   	pop    %esi
+  80287f:	5f                   	pop    %edi
+  802880:	5d                   	pop    %ebp
+  802881:	c3                   	ret
+
+00802882 <recvmsg>:
+{
+  802882:	55                   	push   %ebp
+  802883:	89 e5                	mov    %esp,%ebp
+  802885:	57                   	push   %edi
+  802886:	56                   	push   %esi
+  802887:	53                   	push   %ebx
+  802888:	83 ec 0c             	sub    $0xc,%esp
+  80288b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80288e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802891:	89 f8                	mov    %edi,%eax
+  802893:	e8 04 fe ff ff       	call   80269c <fd2sockid>
+  802898:	89 c3                	mov    %eax,%ebx
+  80289a:	85 c0                	test   %eax,%eax
+  80289c:	78 2a                	js     8028c8 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80289e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8028a5:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8028ac:	89 f8                	mov    %edi,%eax
+  8028ae:	e8 19 fe ff ff       	call   8026cc <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8028b3:	0b 45 10             	or     0x10(%ebp),%eax
+  8028b6:	50                   	push   %eax
+  8028b7:	ff 76 0c             	push   0xc(%esi)
+  8028ba:	ff 76 08             	push   0x8(%esi)
+  8028bd:	53                   	push   %ebx
+  8028be:	e8 d6 07 00 00       	call   803099 <nsipc_recvmsg>
+  8028c3:	89 c3                	mov    %eax,%ebx
+  8028c5:	83 c4 10             	add    $0x10,%esp
+}
+  8028c8:	89 d8                	mov    %ebx,%eax
+  8028ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028cd:	5b                   	pop    %ebx
+  8028ce:	5e                   	pop    %esi
+  8028cf:	5f                   	pop    %edi
+  8028d0:	5d                   	pop    %ebp
+  8028d1:	c3                   	ret
+
+008028d2 <sendfile>:
+{
+  8028d2:	55                   	push   %ebp
+  8028d3:	89 e5                	mov    %esp,%ebp
+  8028d5:	56                   	push   %esi
+  8028d6:	53                   	push   %ebx
+  8028d7:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8028da:	89 f0                	mov    %esi,%eax
+  8028dc:	e8 bb fd ff ff       	call   80269c <fd2sockid>
+  8028e1:	89 c3                	mov    %eax,%ebx
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	78 1f                	js     802906 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8028e7:	89 f0                	mov    %esi,%eax
+  8028e9:	e8 de fd ff ff       	call   8026cc <sock_flags>
+  8028ee:	83 ec 0c             	sub    $0xc,%esp
+  8028f1:	50                   	push   %eax
+  8028f2:	ff 75 14             	push   0x14(%ebp)
+  8028f5:	ff 75 10             	push   0x10(%ebp)
+  8028f8:	ff 75 0c             	push   0xc(%ebp)
+  8028fb:	53                   	push   %ebx
+  8028fc:	e8 64 06 00 00       	call   802f65 <nsipc_sendfile>
+  802901:	89 c3                	mov    %eax,%ebx
+  802903:	83 c4 20             	add    $0x20,%esp
+}
+  802906:	89 d8                	mov    %ebx,%eax
+  802908:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80290b:	5b                   	pop    %ebx
+  80290c:	5e                   	pop    %esi
+  80290d:	5d                   	pop    %ebp
+  80290e:	c3                   	ret
+
+0080290f <evctl>:
+{
+  80290f:	55                   	push   %ebp
+  802910:	89 e5                	mov    %esp,%ebp
+  802912:	53                   	push   %ebx
+  802913:	83 ec 04             	sub    $0x4,%esp
+  802916:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802919:	89 d8                	mov    %ebx,%eax
+  80291b:	e8 7c fd ff ff       	call   80269c <fd2sockid>
+  802920:	85 c0                	test   %eax,%eax
+  802922:	78 10                	js     802934 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802924:	83 ec 04             	sub    $0x4,%esp
+  802927:	53                   	push   %ebx
+  802928:	ff 75 0c             	push   0xc(%ebp)
+  80292b:	50                   	push   %eax
+  80292c:	e8 d2 0b 00 00       	call   803503 <nsipc_evctl>
+  802931:	83 c4 10             	add    $0x10,%esp
+}
+  802934:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802937:	c9                   	leave
+  802938:	c3                   	ret
+
+00802939 <evwait>:
+{
+  802939:	55                   	push   %ebp
+  80293a:	89 e5                	mov    %esp,%ebp
+  80293c:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80293f:	ff 75 10             	push   0x10(%ebp)
+  802942:	ff 75 0c             	push   0xc(%ebp)
+  802945:	ff 75 08             	push   0x8(%ebp)
+  802948:	e8 e0 0b 00 00       	call   80352d <nsipc_evwait>
+}
+  80294d:	c9                   	leave
+  80294e:	c3                   	ret
+
+0080294f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802955:	ff 75 10             	push   0x10(%ebp)
+  802958:	ff 75 0c             	push   0xc(%ebp)
+  80295b:	ff 75 08             	push   0x8(%ebp)
+  80295e:	e8 31 0c 00 00       	call   803594 <nsipc_socket>
+  802963:	83 c4 10             	add    $0x10,%esp
+  802966:	85 c0                	test   %eax,%eax
+  802968:	78 05                	js     80296f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80296a:	e8 89 fd ff ff       	call   8026f8 <alloc_sockfd>
+}
+  80296f:	c9                   	leave
+  802970:	c3                   	ret
+
+00802971 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802971:	55                   	push   %ebp
+  802972:	89 e5                	mov    %esp,%ebp
+  802974:	53                   	push   %ebx
+  802975:	83 ec 04             	sub    $0x4,%esp
+  802978:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80297a:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802981:	74 26                	je     8029a9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802983:	6a 07                	push   $0x7
+  802985:	68 00 80 80 00       	push   $0x808000
+  80298a:	53                   	push   %ebx
+  80298b:	ff 35 e4 69 80 00    	push   0x8069e4
+  802991:	e8 02 f2 ff ff       	call   801b98 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802996:	83 c4 0c             	add    $0xc,%esp
+  802999:	6a 00                	push   $0x0
+  80299b:	6a 00                	push   $0x0
+  80299d:	6a 00                	push   $0x0
+  80299f:	e8 64 ef ff ff       	call   801908 <ipc_recv>
+}
+  8029a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029a7:	c9                   	leave
+  8029a8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029a9:	83 ec 0c             	sub    $0xc,%esp
+  8029ac:	6a 03                	push   $0x3
+  8029ae:	e8 4e f2 ff ff       	call   801c01 <ipc_find_env>
+  8029b3:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  8029bb:	eb c6                	jmp    802983 <nsipc+0x12>
+
+008029bd <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8029bd:	55                   	push   %ebp
+  8029be:	89 e5                	mov    %esp,%ebp
+  8029c0:	56                   	push   %esi
+  8029c1:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8029c2:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  8029c8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8029cd:	85 f6                	test   %esi,%esi
+  8029cf:	75 33                	jne    802a04 <nsbulk_map+0x47>
+  8029d1:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8029d6:	83 ec 04             	sub    $0x4,%esp
+  8029d9:	6a 07                	push   $0x7
+  8029db:	53                   	push   %ebx
+  8029dc:	6a 00                	push   $0x0
+  8029de:	e8 46 e3 ff ff       	call   800d29 <sys_page_alloc>
+  8029e3:	83 c4 10             	add    $0x10,%esp
+  8029e6:	85 c0                	test   %eax,%eax
+  8029e8:	78 1a                	js     802a04 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8029ea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8029f0:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8029f6:	75 de                	jne    8029d6 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8029f8:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  8029ff:	00 00 00 
+	return 0;
+  802a02:	89 f0                	mov    %esi,%eax
+}
+  802a04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a07:	5b                   	pop    %ebx
+  802a08:	5e                   	pop    %esi
+  802a09:	5d                   	pop    %ebp
+  802a0a:	c3                   	ret
+
+00802a0b <nsbulk_own>:
+{
+  802a0b:	55                   	push   %ebp
+  802a0c:	89 e5                	mov    %esp,%ebp
+  802a0e:	57                   	push   %edi
+  802a0f:	56                   	push   %esi
+  802a10:	53                   	push   %ebx
+  802a11:	83 ec 0c             	sub    $0xc,%esp
+  802a14:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802a16:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802a19:	85 d2                	test   %edx,%edx
+  802a1b:	7f 0e                	jg     802a2b <nsbulk_own+0x20>
+	return 0;
+  802a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a22:	eb 47                	jmp    802a6b <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802a24:	83 c3 01             	add    $0x1,%ebx
+  802a27:	39 fb                	cmp    %edi,%ebx
+  802a29:	7d 3b                	jge    802a66 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802a2b:	be 01 00 00 00       	mov    $0x1,%esi
+  802a30:	89 d9                	mov    %ebx,%ecx
+  802a32:	d3 e6                	shl    %cl,%esi
+  802a34:	89 f0                	mov    %esi,%eax
+  802a36:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802a3c:	74 e6                	je     802a24 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802a3e:	83 ec 04             	sub    $0x4,%esp
+  802a41:	6a 07                	push   $0x7
+  802a43:	89 d8                	mov    %ebx,%eax
+  802a45:	c1 e0 0c             	shl    $0xc,%eax
+  802a48:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802a4d:	50                   	push   %eax
+  802a4e:	6a 00                	push   $0x0
+  802a50:	e8 d4 e2 ff ff       	call   800d29 <sys_page_alloc>
+  802a55:	83 c4 10             	add    $0x10,%esp
+  802a58:	85 c0                	test   %eax,%eax
+  802a5a:	78 0f                	js     802a6b <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802a5c:	f7 d6                	not    %esi
+  802a5e:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802a64:	eb be                	jmp    802a24 <nsbulk_own+0x19>
+	return 0;
+  802a66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a6e:	5b                   	pop    %ebx
+  802a6f:	5e                   	pop    %esi
+  802a70:	5f                   	pop    %edi
+  802a71:	5d                   	pop    %ebp
+  802a72:	c3                   	ret
+
+00802a73 <nsipc_bulk>:
+{
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	57                   	push   %edi
+  802a77:	56                   	push   %esi
+  802a78:	53                   	push   %ebx
+  802a79:	83 ec 1c             	sub    $0x1c,%esp
+  802a7c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a7f:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802a81:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802a87:	c1 fb 0c             	sar    $0xc,%ebx
+  802a8a:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802a8d:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802a94:	74 56                	je     802aec <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a96:	85 ff                	test   %edi,%edi
+  802a98:	7e 24                	jle    802abe <nsipc_bulk+0x4b>
+  802a9a:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802aa0:	74 1c                	je     802abe <nsipc_bulk+0x4b>
+  802aa2:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802aa8:	c1 e3 0c             	shl    $0xc,%ebx
+  802aab:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802ab0:	0f b6 10             	movzbl (%eax),%edx
+  802ab3:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802ab5:	05 00 10 00 00       	add    $0x1000,%eax
+  802aba:	39 d8                	cmp    %ebx,%eax
+  802abc:	75 f2                	jne    802ab0 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802abe:	83 ec 0c             	sub    $0xc,%esp
+  802ac1:	56                   	push   %esi
+  802ac2:	57                   	push   %edi
+  802ac3:	68 00 00 00 e0       	push   $0xe0000000
+  802ac8:	ff 75 e4             	push   -0x1c(%ebp)
+  802acb:	ff 35 e4 69 80 00    	push   0x8069e4
+  802ad1:	e8 f6 f0 ff ff       	call   801bcc <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802ad6:	83 c4 1c             	add    $0x1c,%esp
+  802ad9:	6a 00                	push   $0x0
+  802adb:	6a 00                	push   $0x0
+  802add:	6a 00                	push   $0x0
+  802adf:	e8 24 ee ff ff       	call   801908 <ipc_recv>
+}
+  802ae4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae7:	5b                   	pop    %ebx
+  802ae8:	5e                   	pop    %esi
+  802ae9:	5f                   	pop    %edi
+  802aea:	5d                   	pop    %ebp
+  802aeb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802aec:	83 ec 0c             	sub    $0xc,%esp
+  802aef:	6a 03                	push   $0x3
+  802af1:	e8 0b f1 ff ff       	call   801c01 <ipc_find_env>
+  802af6:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802afb:	83 c4 10             	add    $0x10,%esp
+  802afe:	eb 96                	jmp    802a96 <nsipc_bulk+0x23>
+
+00802b00 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802b00:	55                   	push   %ebp
+  802b01:	89 e5                	mov    %esp,%ebp
+  802b03:	53                   	push   %ebx
+  802b04:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b07:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802b0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b12:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b17:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b1c:	e8 50 fe ff ff       	call   802971 <nsipc>
+  802b21:	89 c3                	mov    %eax,%ebx
+  802b23:	85 c0                	test   %eax,%eax
+  802b25:	79 07                	jns    802b2e <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b27:	89 d8                	mov    %ebx,%eax
+  802b29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b2e:	83 ec 04             	sub    $0x4,%esp
+  802b31:	ff 35 10 80 80 00    	push   0x808010
+  802b37:	68 00 80 80 00       	push   $0x808000
+  802b3c:	ff 75 0c             	push   0xc(%ebp)
+  802b3f:	e8 61 df ff ff       	call   800aa5 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b44:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b4a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b4d:	89 10                	mov    %edx,(%eax)
+  802b4f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b52:	eb d3                	jmp    802b27 <nsipc_accept+0x27>
+
+00802b54 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b54:	55                   	push   %ebp
+  802b55:	89 e5                	mov    %esp,%ebp
+  802b57:	53                   	push   %ebx
+  802b58:	83 ec 08             	sub    $0x8,%esp
+  802b5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b61:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b66:	53                   	push   %ebx
+  802b67:	ff 75 0c             	push   0xc(%ebp)
+  802b6a:	68 04 80 80 00       	push   $0x808004
+  802b6f:	e8 31 df ff ff       	call   800aa5 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b74:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802b7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b7f:	e8 ed fd ff ff       	call   802971 <nsipc>
+}
+  802b84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b87:	c9                   	leave
+  802b88:	c3                   	ret
+
+00802b89 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b89:	55                   	push   %ebp
+  802b8a:	89 e5                	mov    %esp,%ebp
+  802b8c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b92:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802b97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b9a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b9f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ba4:	e8 c8 fd ff ff       	call   802971 <nsipc>
+}
+  802ba9:	c9                   	leave
+  802baa:	c3                   	ret
+
+00802bab <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802bab:	55                   	push   %ebp
+  802bac:	89 e5                	mov    %esp,%ebp
+  802bae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802bb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb4:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802bb9:	b8 04 00 00 00       	mov    $0x4,%eax
+  802bbe:	e8 ae fd ff ff       	call   802971 <nsipc>
+}
+  802bc3:	c9                   	leave
+  802bc4:	c3                   	ret
+
+00802bc5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802bc5:	55                   	push   %ebp
+  802bc6:	89 e5                	mov    %esp,%ebp
+  802bc8:	53                   	push   %ebx
+  802bc9:	83 ec 08             	sub    $0x8,%esp
+  802bcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802bd7:	53                   	push   %ebx
+  802bd8:	ff 75 0c             	push   0xc(%ebp)
+  802bdb:	68 04 80 80 00       	push   $0x808004
+  802be0:	e8 c0 de ff ff       	call   800aa5 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802be5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802beb:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bf0:	e8 7c fd ff ff       	call   802971 <nsipc>
+}
+  802bf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf8:	c9                   	leave
+  802bf9:	c3                   	ret
+
+00802bfa <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802bfa:	55                   	push   %ebp
+  802bfb:	89 e5                	mov    %esp,%ebp
+  802bfd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802c00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c03:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802c08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c0b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802c10:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c15:	e8 57 fd ff ff       	call   802971 <nsipc>
+}
+  802c1a:	c9                   	leave
+  802c1b:	c3                   	ret
+
+00802c1c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	56                   	push   %esi
+  802c20:	53                   	push   %ebx
+  802c21:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c27:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802c2c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802c32:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c35:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c3a:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c3f:	e8 2d fd ff ff       	call   802971 <nsipc>
+  802c44:	89 c3                	mov    %eax,%ebx
+  802c46:	85 c0                	test   %eax,%eax
+  802c48:	78 22                	js     802c6c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c4a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c4f:	39 c6                	cmp    %eax,%esi
+  802c51:	0f 4e c6             	cmovle %esi,%eax
+  802c54:	39 c3                	cmp    %eax,%ebx
+  802c56:	7f 1d                	jg     802c75 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c58:	83 ec 04             	sub    $0x4,%esp
+  802c5b:	53                   	push   %ebx
+  802c5c:	68 00 80 80 00       	push   $0x808000
+  802c61:	ff 75 0c             	push   0xc(%ebp)
+  802c64:	e8 3c de ff ff       	call   800aa5 <memmove>
+  802c69:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c6c:	89 d8                	mov    %ebx,%eax
+  802c6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c71:	5b                   	pop    %ebx
+  802c72:	5e                   	pop    %esi
+  802c73:	5d                   	pop    %ebp
+  802c74:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c75:	68 c8 49 80 00       	push   $0x8049c8
+  802c7a:	68 dd 49 80 00       	push   $0x8049dd
+  802c7f:	68 b2 00 00 00       	push   $0xb2
+  802c84:	68 f2 49 80 00       	push   $0x8049f2
+  802c89:	e8 0d 15 00 00       	call   80419b <_panic>
+
+00802c8e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c8e:	55                   	push   %ebp
+  802c8f:	89 e5                	mov    %esp,%ebp
+  802c91:	53                   	push   %ebx
+  802c92:	83 ec 04             	sub    $0x4,%esp
+  802c95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9b:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ca0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ca6:	7f 2e                	jg     802cd6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ca8:	83 ec 04             	sub    $0x4,%esp
+  802cab:	53                   	push   %ebx
+  802cac:	ff 75 0c             	push   0xc(%ebp)
+  802caf:	68 0c 80 80 00       	push   $0x80800c
+  802cb4:	e8 ec dd ff ff       	call   800aa5 <memmove>
+	nsipcbuf.send.req_size = size;
+  802cb9:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802cbf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cc2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802cc7:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ccc:	e8 a0 fc ff ff       	call   802971 <nsipc>
+}
+  802cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+	assert(size < 1600);
+  802cd6:	68 fe 49 80 00       	push   $0x8049fe
+  802cdb:	68 dd 49 80 00       	push   $0x8049dd
+  802ce0:	68 bd 00 00 00       	push   $0xbd
+  802ce5:	68 f2 49 80 00       	push   $0x8049f2
+  802cea:	e8 ac 14 00 00       	call   80419b <_panic>
+
+00802cef <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	57                   	push   %edi
+  802cf3:	56                   	push   %esi
+  802cf4:	53                   	push   %ebx
+  802cf5:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802cf8:	e8 c0 fc ff ff       	call   8029bd <nsbulk_map>
+  802cfd:	85 c0                	test   %eax,%eax
+  802cff:	78 55                	js     802d56 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802d01:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802d08:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802d0f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802d16:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d19:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802d1c:	0f 8d 24 02 00 00    	jge    802f46 <nsipc_sendmsg+0x257>
+  802d22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d25:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d28:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802d2b:	89 d8                	mov    %ebx,%eax
+  802d2d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d32:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802d34:	83 ec 0c             	sub    $0xc,%esp
+  802d37:	68 e0 66 80 00       	push   $0x8066e0
+  802d3c:	e8 5a 0f 00 00       	call   803c9b <pgbatch_init>
+  802d41:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802d44:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802d46:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802d49:	e9 82 00 00 00       	jmp    802dd0 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802d4e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802d51:	85 db                	test   %ebx,%ebx
+  802d53:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802d56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d59:	5b                   	pop    %ebx
+  802d5a:	5e                   	pop    %esi
+  802d5b:	5f                   	pop    %edi
+  802d5c:	5d                   	pop    %ebp
+  802d5d:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802d5e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802d63:	29 c8                	sub    %ecx,%eax
+  802d65:	39 d0                	cmp    %edx,%eax
+  802d67:	0f 46 d0             	cmovbe %eax,%edx
+  802d6a:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802d6c:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d72:	85 ff                	test   %edi,%edi
+  802d74:	0f 49 c7             	cmovns %edi,%eax
+  802d77:	c1 f8 0c             	sar    $0xc,%eax
+  802d7a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d7f:	e8 87 fc ff ff       	call   802a0b <nsbulk_own>
+  802d84:	85 c0                	test   %eax,%eax
+  802d86:	0f 88 17 01 00 00    	js     802ea3 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802d8c:	83 ec 04             	sub    $0x4,%esp
+  802d8f:	56                   	push   %esi
+  802d90:	ff 75 e0             	push   -0x20(%ebp)
+  802d93:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d96:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802d9b:	50                   	push   %eax
+  802d9c:	e8 04 dd ff ff       	call   800aa5 <memmove>
+  802da1:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802da4:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802da7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802daa:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802dad:	0f 84 fd 00 00 00    	je     802eb0 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802db3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802db6:	01 f7                	add    %esi,%edi
+  802db8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802dbb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802dbe:	0f 8d 01 01 00 00    	jge    802ec5 <nsipc_sendmsg+0x1d6>
+  802dc4:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802dca:	0f 8f f0 00 00 00    	jg     802ec0 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802dd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dd3:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802dd6:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802dd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ddc:	89 c2                	mov    %eax,%edx
+  802dde:	03 13                	add    (%ebx),%edx
+  802de0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802de3:	8b 73 04             	mov    0x4(%ebx),%esi
+  802de6:	29 c6                	sub    %eax,%esi
+  802de8:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802ded:	29 f9                	sub    %edi,%ecx
+  802def:	39 ce                	cmp    %ecx,%esi
+  802df1:	89 ca                	mov    %ecx,%edx
+  802df3:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802df6:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802df9:	89 f9                	mov    %edi,%ecx
+  802dfb:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802e01:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e04:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e09:	09 c8                	or     %ecx,%eax
+  802e0b:	0f 85 4d ff ff ff    	jne    802d5e <nsipc_sendmsg+0x6f>
+  802e11:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802e17:	0f 86 41 ff ff ff    	jbe    802d5e <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e1d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e23:	85 ff                	test   %edi,%edi
+  802e25:	0f 49 c7             	cmovns %edi,%eax
+  802e28:	c1 f8 0c             	sar    $0xc,%eax
+  802e2b:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802e2d:	89 d1                	mov    %edx,%ecx
+  802e2f:	c1 e9 0c             	shr    $0xc,%ecx
+  802e32:	01 c8                	add    %ecx,%eax
+  802e34:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e37:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802e3a:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802e3c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802e3f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e44:	29 c8                	sub    %ecx,%eax
+  802e46:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802e49:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802e4c:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e53:	89 f9                	mov    %edi,%ecx
+  802e55:	d3 e0                	shl    %cl,%eax
+  802e57:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e5d:	83 ec 08             	sub    $0x8,%esp
+  802e60:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802e62:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e65:	50                   	push   %eax
+  802e66:	6a 00                	push   $0x0
+  802e68:	56                   	push   %esi
+  802e69:	6a 00                	push   $0x0
+  802e6b:	68 e0 66 80 00       	push   $0x8066e0
+  802e70:	e8 e4 0e 00 00       	call   803d59 <pgbatch_map>
+  802e75:	83 c4 20             	add    $0x20,%esp
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	0f 88 ce fe ff ff    	js     802d4e <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802e80:	83 c7 01             	add    $0x1,%edi
+  802e83:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e89:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e8c:	39 c7                	cmp    %eax,%edi
+  802e8e:	75 be                	jne    802e4e <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802e90:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802e93:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802e96:	89 d6                	mov    %edx,%esi
+  802e98:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802e9e:	e9 01 ff ff ff       	jmp    802da4 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802ea3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ea6:	85 db                	test   %ebx,%ebx
+  802ea8:	0f 45 c3             	cmovne %ebx,%eax
+  802eab:	e9 a6 fe ff ff       	jmp    802d56 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802eb0:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802eb4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802ebb:	e9 f3 fe ff ff       	jmp    802db3 <nsipc_sendmsg+0xc4>
+  802ec0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802ec3:	eb 03                	jmp    802ec8 <nsipc_sendmsg+0x1d9>
+  802ec5:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802ec8:	83 ec 0c             	sub    $0xc,%esp
+  802ecb:	68 e0 66 80 00       	push   $0x8066e0
+  802ed0:	e8 d4 0d 00 00       	call   803ca9 <pgbatch_flush>
+  802ed5:	83 c4 10             	add    $0x10,%esp
+  802ed8:	85 c0                	test   %eax,%eax
+  802eda:	78 50                	js     802f2c <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802edc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802edf:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802ee4:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802eea:	89 fb                	mov    %edi,%ebx
+  802eec:	29 f3                	sub    %esi,%ebx
+  802eee:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802ef4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ef7:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802efc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802f01:	89 fa                	mov    %edi,%edx
+  802f03:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802f08:	e8 66 fb ff ff       	call   802a73 <nsipc_bulk>
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	78 28                	js     802f39 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802f11:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802f14:	39 c3                	cmp    %eax,%ebx
+  802f16:	75 0c                	jne    802f24 <nsipc_sendmsg+0x235>
+  802f18:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802f1b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802f1e:	0f 8f f2 fd ff ff    	jg     802d16 <nsipc_sendmsg+0x27>
+		sent += r;
+  802f24:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802f27:	e9 2a fe ff ff       	jmp    802d56 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802f2c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f2f:	85 db                	test   %ebx,%ebx
+  802f31:	0f 45 c3             	cmovne %ebx,%eax
+  802f34:	e9 1d fe ff ff       	jmp    802d56 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802f39:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f3c:	85 db                	test   %ebx,%ebx
+  802f3e:	0f 45 c3             	cmovne %ebx,%eax
+  802f41:	e9 10 fe ff ff       	jmp    802d56 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802f46:	83 ec 0c             	sub    $0xc,%esp
+  802f49:	68 e0 66 80 00       	push   $0x8066e0
+  802f4e:	e8 48 0d 00 00       	call   803c9b <pgbatch_init>
+  802f53:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802f56:	be 00 00 00 00       	mov    $0x0,%esi
+  802f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f60:	e9 63 ff ff ff       	jmp    802ec8 <nsipc_sendmsg+0x1d9>
+
+00802f65 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802f65:	55                   	push   %ebp
+  802f66:	89 e5                	mov    %esp,%ebp
+  802f68:	57                   	push   %edi
+  802f69:	56                   	push   %esi
+  802f6a:	53                   	push   %ebx
+  802f6b:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802f6e:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802f75:	0f 84 c8 00 00 00    	je     803043 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802f7b:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802f82:	0f 84 e4 00 00 00    	je     80306c <nsipc_sendfile+0x107>
+{
+  802f88:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802f8d:	89 fb                	mov    %edi,%ebx
+  802f8f:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802f92:	0f 83 f0 00 00 00    	jae    803088 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802f98:	89 fa                	mov    %edi,%edx
+  802f9a:	03 55 10             	add    0x10(%ebp),%edx
+  802f9d:	89 d0                	mov    %edx,%eax
+  802f9f:	c1 f8 1f             	sar    $0x1f,%eax
+  802fa2:	c1 e8 14             	shr    $0x14,%eax
+  802fa5:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802fa8:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802fae:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802fb0:	6a 10                	push   $0x10
+  802fb2:	68 00 20 01 e0       	push   $0xe0012000
+  802fb7:	52                   	push   %edx
+  802fb8:	ff 75 0c             	push   0xc(%ebp)
+  802fbb:	e8 fe f4 ff ff       	call   8024be <fmap>
+  802fc0:	83 c4 10             	add    $0x10,%esp
+  802fc3:	85 c0                	test   %eax,%eax
+  802fc5:	0f 8e b8 00 00 00    	jle    803083 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802fcb:	39 c6                	cmp    %eax,%esi
+  802fcd:	0f 8d b5 00 00 00    	jge    803088 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802fd3:	29 f0                	sub    %esi,%eax
+  802fd5:	8b 55 14             	mov    0x14(%ebp),%edx
+  802fd8:	29 da                	sub    %ebx,%edx
+  802fda:	39 d0                	cmp    %edx,%eax
+  802fdc:	89 d3                	mov    %edx,%ebx
+  802fde:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802fe1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe4:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802fe9:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802fef:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802ff5:	8b 45 18             	mov    0x18(%ebp),%eax
+  802ff8:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802ffd:	83 ec 0c             	sub    $0xc,%esp
+  803000:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  803002:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803009:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80300c:	83 c0 01             	add    $0x1,%eax
+  80300f:	50                   	push   %eax
+  803010:	68 00 10 01 e0       	push   $0xe0011000
+  803015:	6a 11                	push   $0x11
+  803017:	ff 35 e4 69 80 00    	push   0x8069e4
+  80301d:	e8 aa eb ff ff       	call   801bcc <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803022:	83 c4 1c             	add    $0x1c,%esp
+  803025:	6a 00                	push   $0x0
+  803027:	6a 00                	push   $0x0
+  803029:	6a 00                	push   $0x0
+  80302b:	e8 d8 e8 ff ff       	call   801908 <ipc_recv>
+  803030:	83 c4 10             	add    $0x10,%esp
+  803033:	85 c0                	test   %eax,%eax
+  803035:	78 5b                	js     803092 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803037:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803039:	39 c3                	cmp    %eax,%ebx
+  80303b:	0f 8e 4c ff ff ff    	jle    802f8d <nsipc_sendfile+0x28>
+  803041:	eb 45                	jmp    803088 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803043:	83 ec 04             	sub    $0x4,%esp
+  803046:	6a 07                	push   $0x7
+  803048:	68 00 10 01 e0       	push   $0xe0011000
+  80304d:	6a 00                	push   $0x0
+  80304f:	e8 d5 dc ff ff       	call   800d29 <sys_page_alloc>
+  803054:	89 c7                	mov    %eax,%edi
+  803056:	83 c4 10             	add    $0x10,%esp
+  803059:	85 c0                	test   %eax,%eax
+  80305b:	78 2b                	js     803088 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80305d:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  803064:	00 00 00 
+  803067:	e9 0f ff ff ff       	jmp    802f7b <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80306c:	83 ec 0c             	sub    $0xc,%esp
+  80306f:	6a 03                	push   $0x3
+  803071:	e8 8b eb ff ff       	call   801c01 <ipc_find_env>
+  803076:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80307b:	83 c4 10             	add    $0x10,%esp
+  80307e:	e9 05 ff ff ff       	jmp    802f88 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803083:	85 ff                	test   %edi,%edi
+  803085:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803088:	89 f8                	mov    %edi,%eax
+  80308a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80308d:	5b                   	pop    %ebx
+  80308e:	5e                   	pop    %esi
+  80308f:	5f                   	pop    %edi
+  803090:	5d                   	pop    %ebp
+  803091:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803092:	85 ff                	test   %edi,%edi
+  803094:	0f 44 f8             	cmove  %eax,%edi
+  803097:	eb ef                	jmp    803088 <nsipc_sendfile+0x123>
+
+00803099 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803099:	55                   	push   %ebp
+  80309a:	89 e5                	mov    %esp,%ebp
+  80309c:	57                   	push   %edi
+  80309d:	56                   	push   %esi
+  80309e:	53                   	push   %ebx
+  80309f:	83 ec 1c             	sub    $0x1c,%esp
+  8030a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8030a5:	e8 13 f9 ff ff       	call   8029bd <nsbulk_map>
+  8030aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030ad:	85 c0                	test   %eax,%eax
+  8030af:	0f 88 ba 00 00 00    	js     80316f <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8030b5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030b9:	0f 8e bb 00 00 00    	jle    80317a <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8030bf:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8030c4:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8030c9:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8030ce:	89 f8                	mov    %edi,%eax
+  8030d0:	29 f0                	sub    %esi,%eax
+  8030d2:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8030d6:	39 c8                	cmp    %ecx,%eax
+  8030d8:	0f 47 c1             	cmova  %ecx,%eax
+  8030db:	01 f0                	add    %esi,%eax
+  8030dd:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8030df:	83 c2 01             	add    $0x1,%edx
+  8030e2:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8030e5:	7e 07                	jle    8030ee <nsipc_recvmsg+0x55>
+  8030e7:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8030ec:	7e e0                	jle    8030ce <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8030ee:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8030f4:	c1 fa 0c             	sar    $0xc,%edx
+  8030f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030fc:	e8 0a f9 ff ff       	call   802a0b <nsbulk_own>
+  803101:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803104:	85 c0                	test   %eax,%eax
+  803106:	78 67                	js     80316f <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803108:	8b 45 08             	mov    0x8(%ebp),%eax
+  80310b:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803110:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803116:	8b 45 14             	mov    0x14(%ebp),%eax
+  803119:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80311e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803123:	89 f2                	mov    %esi,%edx
+  803125:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80312a:	e8 44 f9 ff ff       	call   802a73 <nsipc_bulk>
+  80312f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803132:	85 c0                	test   %eax,%eax
+  803134:	78 39                	js     80316f <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803136:	39 f0                	cmp    %esi,%eax
+  803138:	7f 4a                	jg     803184 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80313a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80313f:	85 c0                	test   %eax,%eax
+  803141:	7e 2c                	jle    80316f <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803143:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803146:	29 fe                	sub    %edi,%esi
+  803148:	8b 43 04             	mov    0x4(%ebx),%eax
+  80314b:	39 c6                	cmp    %eax,%esi
+  80314d:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803150:	83 ec 04             	sub    $0x4,%esp
+  803153:	56                   	push   %esi
+  803154:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80315a:	50                   	push   %eax
+  80315b:	ff 33                	push   (%ebx)
+  80315d:	e8 43 d9 ff ff       	call   800aa5 <memmove>
+		n += m;
+  803162:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803164:	83 c3 08             	add    $0x8,%ebx
+  803167:	83 c4 10             	add    $0x10,%esp
+  80316a:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80316d:	7f d4                	jg     803143 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80316f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803175:	5b                   	pop    %ebx
+  803176:	5e                   	pop    %esi
+  803177:	5f                   	pop    %edi
+  803178:	5d                   	pop    %ebp
+  803179:	c3                   	ret
+	int r, i, n, len = 0;
+  80317a:	be 00 00 00 00       	mov    $0x0,%esi
+  80317f:	e9 6a ff ff ff       	jmp    8030ee <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803184:	68 d4 49 80 00       	push   $0x8049d4
+  803189:	68 dd 49 80 00       	push   $0x8049dd
+  80318e:	68 3b 01 00 00       	push   $0x13b
+  803193:	68 f2 49 80 00       	push   $0x8049f2
+  803198:	e8 fe 0f 00 00       	call   80419b <_panic>
+
+0080319d <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80319d:	55                   	push   %ebp
+  80319e:	89 e5                	mov    %esp,%ebp
+  8031a0:	57                   	push   %edi
+  8031a1:	56                   	push   %esi
+  8031a2:	53                   	push   %ebx
+  8031a3:	83 ec 0c             	sub    $0xc,%esp
+  8031a6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8031a9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8031ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8031af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8031b7:	8b 07                	mov    (%edi),%eax
+  8031b9:	a3 04 80 80 00       	mov    %eax,0x808004
+  8031be:	8b 47 04             	mov    0x4(%edi),%eax
+  8031c1:	a3 08 80 80 00       	mov    %eax,0x808008
+  8031c6:	8b 47 08             	mov    0x8(%edi),%eax
+  8031c9:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8031ce:	8b 47 0c             	mov    0xc(%edi),%eax
+  8031d1:	a3 10 80 80 00       	mov    %eax,0x808010
+  8031d6:	8b 47 10             	mov    0x10(%edi),%eax
+  8031d9:	a3 14 80 80 00       	mov    %eax,0x808014
+  8031de:	8b 47 14             	mov    0x14(%edi),%eax
+  8031e1:	a3 18 80 80 00       	mov    %eax,0x808018
+  8031e6:	8b 47 18             	mov    0x18(%edi),%eax
+  8031e9:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8031ee:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8031f1:	a3 20 80 80 00       	mov    %eax,0x808020
+  8031f6:	8b 47 20             	mov    0x20(%edi),%eax
+  8031f9:	a3 24 80 80 00       	mov    %eax,0x808024
+  8031fe:	8b 47 24             	mov    0x24(%edi),%eax
+  803201:	a3 28 80 80 00       	mov    %eax,0x808028
+  803206:	8b 47 28             	mov    0x28(%edi),%eax
+  803209:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80320e:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803211:	a3 30 80 80 00       	mov    %eax,0x808030
+  803216:	8b 47 30             	mov    0x30(%edi),%eax
+  803219:	a3 34 80 80 00       	mov    %eax,0x808034
+  80321e:	8b 47 34             	mov    0x34(%edi),%eax
+  803221:	a3 38 80 80 00       	mov    %eax,0x808038
+  803226:	8b 47 38             	mov    0x38(%edi),%eax
+  803229:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  80322e:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803231:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803236:	8b 06                	mov    (%esi),%eax
+  803238:	a3 44 80 80 00       	mov    %eax,0x808044
+  80323d:	8b 46 04             	mov    0x4(%esi),%eax
+  803240:	a3 48 80 80 00       	mov    %eax,0x808048
+  803245:	8b 46 08             	mov    0x8(%esi),%eax
+  803248:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  80324d:	8b 46 0c             	mov    0xc(%esi),%eax
+  803250:	a3 50 80 80 00       	mov    %eax,0x808050
+  803255:	8b 46 10             	mov    0x10(%esi),%eax
+  803258:	a3 54 80 80 00       	mov    %eax,0x808054
+  80325d:	8b 46 14             	mov    0x14(%esi),%eax
+  803260:	a3 58 80 80 00       	mov    %eax,0x808058
+  803265:	8b 46 18             	mov    0x18(%esi),%eax
+  803268:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  80326d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803270:	a3 60 80 80 00       	mov    %eax,0x808060
+  803275:	8b 46 20             	mov    0x20(%esi),%eax
+  803278:	a3 64 80 80 00       	mov    %eax,0x808064
+  80327d:	8b 46 24             	mov    0x24(%esi),%eax
+  803280:	a3 68 80 80 00       	mov    %eax,0x808068
+  803285:	8b 46 28             	mov    0x28(%esi),%eax
+  803288:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  80328d:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803290:	a3 70 80 80 00       	mov    %eax,0x808070
+  803295:	8b 46 30             	mov    0x30(%esi),%eax
+  803298:	a3 74 80 80 00       	mov    %eax,0x808074
+  80329d:	8b 46 34             	mov    0x34(%esi),%eax
+  8032a0:	a3 78 80 80 00       	mov    %eax,0x808078
+  8032a5:	8b 46 38             	mov    0x38(%esi),%eax
+  8032a8:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8032ad:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8032b0:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8032b5:	8b 03                	mov    (%ebx),%eax
+  8032b7:	a3 84 80 80 00       	mov    %eax,0x808084
+  8032bc:	8b 43 04             	mov    0x4(%ebx),%eax
+  8032bf:	a3 88 80 80 00       	mov    %eax,0x808088
+  8032c4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8032c7:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8032cc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8032cf:	a3 90 80 80 00       	mov    %eax,0x808090
+  8032d4:	8b 43 10             	mov    0x10(%ebx),%eax
+  8032d7:	a3 94 80 80 00       	mov    %eax,0x808094
+  8032dc:	8b 43 14             	mov    0x14(%ebx),%eax
+  8032df:	a3 98 80 80 00       	mov    %eax,0x808098
+  8032e4:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032e7:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8032ec:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8032ef:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8032f4:	8b 43 20             	mov    0x20(%ebx),%eax
+  8032f7:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8032fc:	8b 43 24             	mov    0x24(%ebx),%eax
+  8032ff:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  803304:	8b 43 28             	mov    0x28(%ebx),%eax
+  803307:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  80330c:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  80330f:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  803314:	8b 43 30             	mov    0x30(%ebx),%eax
+  803317:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  80331c:	8b 43 34             	mov    0x34(%ebx),%eax
+  80331f:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  803324:	8b 43 38             	mov    0x38(%ebx),%eax
+  803327:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  80332c:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80332f:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  803334:	8b 45 18             	mov    0x18(%ebp),%eax
+  803337:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80333c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803341:	e8 2b f6 ff ff       	call   802971 <nsipc>
+  803346:	85 c0                	test   %eax,%eax
+  803348:	0f 88 ad 01 00 00    	js     8034fb <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80334e:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803354:	89 17                	mov    %edx,(%edi)
+  803356:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80335c:	89 57 04             	mov    %edx,0x4(%edi)
+  80335f:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803365:	89 57 08             	mov    %edx,0x8(%edi)
+  803368:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80336e:	89 57 0c             	mov    %edx,0xc(%edi)
+  803371:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803377:	89 57 10             	mov    %edx,0x10(%edi)
+  80337a:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803380:	89 57 14             	mov    %edx,0x14(%edi)
+  803383:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803389:	89 57 18             	mov    %edx,0x18(%edi)
+  80338c:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803392:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803395:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  80339b:	89 57 20             	mov    %edx,0x20(%edi)
+  80339e:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8033a4:	89 57 24             	mov    %edx,0x24(%edi)
+  8033a7:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8033ad:	89 57 28             	mov    %edx,0x28(%edi)
+  8033b0:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8033b6:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8033b9:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8033bf:	89 57 30             	mov    %edx,0x30(%edi)
+  8033c2:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8033c8:	89 57 34             	mov    %edx,0x34(%edi)
+  8033cb:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8033d1:	89 57 38             	mov    %edx,0x38(%edi)
+  8033d4:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8033da:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8033dd:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8033e3:	89 16                	mov    %edx,(%esi)
+  8033e5:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8033eb:	89 56 04             	mov    %edx,0x4(%esi)
+  8033ee:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8033f4:	89 56 08             	mov    %edx,0x8(%esi)
+  8033f7:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8033fd:	89 56 0c             	mov    %edx,0xc(%esi)
+  803400:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  803406:	89 56 10             	mov    %edx,0x10(%esi)
+  803409:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  80340f:	89 56 14             	mov    %edx,0x14(%esi)
+  803412:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803418:	89 56 18             	mov    %edx,0x18(%esi)
+  80341b:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  803421:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803424:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  80342a:	89 56 20             	mov    %edx,0x20(%esi)
+  80342d:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  803433:	89 56 24             	mov    %edx,0x24(%esi)
+  803436:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  80343c:	89 56 28             	mov    %edx,0x28(%esi)
+  80343f:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803445:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803448:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  80344e:	89 56 30             	mov    %edx,0x30(%esi)
+  803451:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803457:	89 56 34             	mov    %edx,0x34(%esi)
+  80345a:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  803460:	89 56 38             	mov    %edx,0x38(%esi)
+  803463:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803469:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80346c:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  803472:	89 13                	mov    %edx,(%ebx)
+  803474:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  80347a:	89 53 04             	mov    %edx,0x4(%ebx)
+  80347d:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  803483:	89 53 08             	mov    %edx,0x8(%ebx)
+  803486:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  80348c:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80348f:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  803495:	89 53 10             	mov    %edx,0x10(%ebx)
+  803498:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  80349e:	89 53 14             	mov    %edx,0x14(%ebx)
+  8034a1:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8034a7:	89 53 18             	mov    %edx,0x18(%ebx)
+  8034aa:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8034b0:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8034b3:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8034b9:	89 53 20             	mov    %edx,0x20(%ebx)
+  8034bc:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8034c2:	89 53 24             	mov    %edx,0x24(%ebx)
+  8034c5:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8034cb:	89 53 28             	mov    %edx,0x28(%ebx)
+  8034ce:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8034d4:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8034d7:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8034dd:	89 53 30             	mov    %edx,0x30(%ebx)
+  8034e0:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  8034e6:	89 53 34             	mov    %edx,0x34(%ebx)
+  8034e9:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  8034ef:	89 53 38             	mov    %edx,0x38(%ebx)
+  8034f2:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  8034f8:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8034fb:	83 c4 0c             	add    $0xc,%esp
+  8034fe:	5b                   	pop    %ebx
+  8034ff:	5e                   	pop    %esi
+  803500:	5f                   	pop    %edi
+  803501:	5d                   	pop    %ebp
+  803502:	c3                   	ret
+
+00803503 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803503:	55                   	push   %ebp
+  803504:	89 e5                	mov    %esp,%ebp
+  803506:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803509:	8b 45 08             	mov    0x8(%ebp),%eax
+  80350c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803511:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803514:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803519:	8b 45 10             	mov    0x10(%ebp),%eax
+  80351c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  803521:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803526:	e8 46 f4 ff ff       	call   802971 <nsipc>
+}
+  80352b:	c9                   	leave
+  80352c:	c3                   	ret
+
+0080352d <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80352d:	55                   	push   %ebp
+  80352e:	89 e5                	mov    %esp,%ebp
+  803530:	56                   	push   %esi
+  803531:	53                   	push   %ebx
+  803532:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803535:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80353b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80353e:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803543:	b8 10 00 00 00       	mov    $0x10,%eax
+  803548:	e8 24 f4 ff ff       	call   802971 <nsipc>
+  80354d:	89 c3                	mov    %eax,%ebx
+  80354f:	85 c0                	test   %eax,%eax
+  803551:	7e 1f                	jle    803572 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803553:	39 c6                	cmp    %eax,%esi
+  803555:	7c 24                	jl     80357b <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803557:	83 ec 04             	sub    $0x4,%esp
+  80355a:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803561:	50                   	push   %eax
+  803562:	68 00 80 80 00       	push   $0x808000
+  803567:	ff 75 08             	push   0x8(%ebp)
+  80356a:	e8 36 d5 ff ff       	call   800aa5 <memmove>
+  80356f:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803572:	89 d8                	mov    %ebx,%eax
+  803574:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803577:	5b                   	pop    %ebx
+  803578:	5e                   	pop    %esi
+  803579:	5d                   	pop    %ebp
+  80357a:	c3                   	ret
+		assert(r <= max);
+  80357b:	68 0a 4a 80 00       	push   $0x804a0a
+  803580:	68 dd 49 80 00       	push   $0x8049dd
+  803585:	68 6a 01 00 00       	push   $0x16a
+  80358a:	68 f2 49 80 00       	push   $0x8049f2
+  80358f:	e8 07 0c 00 00       	call   80419b <_panic>
+
+00803594 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803594:	55                   	push   %ebp
+  803595:	89 e5                	mov    %esp,%ebp
+  803597:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80359a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80359d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8035a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035a5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8035aa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035ad:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8035b2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8035b7:	e8 b5 f3 ff ff       	call   802971 <nsipc>
+}
+  8035bc:	c9                   	leave
+  8035bd:	c3                   	ret
+
+008035be <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8035be:	55                   	push   %ebp
+  8035bf:	89 e5                	mov    %esp,%ebp
+  8035c1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8035c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c7:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8035cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8035d1:	e8 9b f3 ff ff       	call   802971 <nsipc>
+}
+  8035d6:	c9                   	leave
+  8035d7:	c3                   	ret
+
+008035d8 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8035d8:	55                   	push   %ebp
+  8035d9:	89 e5                	mov    %esp,%ebp
+  8035db:	53                   	push   %ebx
+  8035dc:	83 ec 04             	sub    $0x4,%esp
+  8035df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8035e2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8035e7:	e8 85 f3 ff ff       	call   802971 <nsipc>
+  8035ec:	85 c0                	test   %eax,%eax
+  8035ee:	78 50                	js     803640 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8035f0:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8035f6:	89 13                	mov    %edx,(%ebx)
+  8035f8:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8035fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  803601:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803607:	89 53 08             	mov    %edx,0x8(%ebx)
+  80360a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803610:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803613:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803619:	89 53 10             	mov    %edx,0x10(%ebx)
+  80361c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803622:	89 53 14             	mov    %edx,0x14(%ebx)
+  803625:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80362b:	89 53 18             	mov    %edx,0x18(%ebx)
+  80362e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803634:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803637:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80363d:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803640:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803643:	c9                   	leave
+  803644:	c3                   	ret
+
+00803645 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803645:	55                   	push   %ebp
+  803646:	89 e5                	mov    %esp,%ebp
+  803648:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80364b:	6a 03                	push   $0x3
+  80364d:	e8 af e5 ff ff       	call   801c01 <ipc_find_env>
+  803652:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803657:	8b 45 08             	mov    0x8(%ebp),%eax
+  80365a:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80365f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803664:	e8 08 f3 ff ff       	call   802971 <nsipc>
+  803669:	83 c4 10             	add    $0x10,%esp
+  80366c:	85 c0                	test   %eax,%eax
+  80366e:	78 0a                	js     80367a <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803670:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803675:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80367a:	c9                   	leave
+  80367b:	c3                   	ret
+
+0080367c <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80367c:	55                   	push   %ebp
+  80367d:	89 e5                	mov    %esp,%ebp
+  80367f:	57                   	push   %edi
+  803680:	56                   	push   %esi
+  803681:	53                   	push   %ebx
+  803682:	83 ec 1c             	sub    $0x1c,%esp
+  803685:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803688:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80368b:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803690:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803695:	89 e0                	mov    %esp,%eax
+  803697:	89 f2                	mov    %esi,%edx
+  803699:	29 c2                	sub    %eax,%edx
+  80369b:	89 d0                	mov    %edx,%eax
+  80369d:	c1 e8 0f             	shr    $0xf,%eax
+  8036a0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8036a6:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8036a9:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8036b0:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8036b3:	83 ec 0c             	sub    $0xc,%esp
+  8036b6:	ff 75 e0             	push   -0x20(%ebp)
+  8036b9:	e8 87 0b 00 00       	call   804245 <pageref>
+  8036be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8036c1:	83 c4 04             	add    $0x4,%esp
+  8036c4:	ff 75 dc             	push   -0x24(%ebp)
+  8036c7:	e8 79 0b 00 00       	call   804245 <pageref>
+  8036cc:	89 e2                	mov    %esp,%edx
+  8036ce:	89 f1                	mov    %esi,%ecx
+  8036d0:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8036d2:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8036d5:	89 ca                	mov    %ecx,%edx
+  8036d7:	c1 ea 0f             	shr    $0xf,%edx
+  8036da:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8036e0:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8036e3:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  8036ea:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8036ed:	39 d7                	cmp    %edx,%edi
+  8036ef:	74 40                	je     803731 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8036f1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036f4:	75 9f                	jne    803695 <_pipeisclosed+0x19>
+  8036f6:	89 e2                	mov    %esp,%edx
+  8036f8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036fd:	29 d0                	sub    %edx,%eax
+  8036ff:	89 c2                	mov    %eax,%edx
+  803701:	c1 ea 0f             	shr    $0xf,%edx
+  803704:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370e:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803711:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803718:	8b 40 58             	mov    0x58(%eax),%eax
+  80371b:	6a 01                	push   $0x1
+  80371d:	50                   	push   %eax
+  80371e:	57                   	push   %edi
+  80371f:	68 13 4a 80 00       	push   $0x804a13
+  803724:	e8 d5 ca ff ff       	call   8001fe <cprintf>
+  803729:	83 c4 10             	add    $0x10,%esp
+  80372c:	e9 5f ff ff ff       	jmp    803690 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803731:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803734:	0f 94 c0             	sete   %al
+  803737:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80373a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80373d:	5b                   	pop    %ebx
+  80373e:	5e                   	pop    %esi
+  80373f:	5f                   	pop    %edi
+  803740:	5d                   	pop    %ebp
+  803741:	c3                   	ret
+
+00803742 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803742:	55                   	push   %ebp
+  803743:	89 e5                	mov    %esp,%ebp
+  803745:	53                   	push   %ebx
+  803746:	83 ec 0c             	sub    $0xc,%esp
+  803749:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80374c:	53                   	push   %ebx
+  80374d:	6a 00                	push   $0x0
+  80374f:	e8 5a d6 ff ff       	call   800dae <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803754:	89 1c 24             	mov    %ebx,(%esp)
+  803757:	e8 f4 e4 ff ff       	call   801c50 <fd2data>
+  80375c:	83 c4 08             	add    $0x8,%esp
+  80375f:	50                   	push   %eax
+  803760:	6a 00                	push   $0x0
+  803762:	e8 47 d6 ff ff       	call   800dae <sys_page_unmap>
+}
+  803767:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80376a:	c9                   	leave
+  80376b:	c3                   	ret
+
+0080376c <devpipe_read>:
+{
+  80376c:	55                   	push   %ebp
+  80376d:	89 e5                	mov    %esp,%ebp
+  80376f:	57                   	push   %edi
+  803770:	56                   	push   %esi
+  803771:	53                   	push   %ebx
+  803772:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803775:	ff 75 08             	push   0x8(%ebp)
+  803778:	e8 d3 e4 ff ff       	call   801c50 <fd2data>
+  80377d:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80377f:	8b 70 04             	mov    0x4(%eax),%esi
+  803782:	8b 00                	mov    (%eax),%eax
+  803784:	83 c4 10             	add    $0x10,%esp
+  803787:	39 f0                	cmp    %esi,%eax
+  803789:	75 36                	jne    8037c1 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80378b:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80378e:	89 da                	mov    %ebx,%edx
+  803790:	8b 45 08             	mov    0x8(%ebp),%eax
+  803793:	e8 e4 fe ff ff       	call   80367c <_pipeisclosed>
+  803798:	85 c0                	test   %eax,%eax
+  80379a:	0f 85 d4 00 00 00    	jne    803874 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8037a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037a5:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8037a9:	83 ec 04             	sub    $0x4,%esp
+  8037ac:	6a ff                	push   $0xffffffff
+  8037ae:	56                   	push   %esi
+  8037af:	57                   	push   %edi
+  8037b0:	e8 72 d9 ff ff       	call   801127 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8037b5:	8b 73 04             	mov    0x4(%ebx),%esi
+  8037b8:	8b 03                	mov    (%ebx),%eax
+  8037ba:	83 c4 10             	add    $0x10,%esp
+  8037bd:	39 c6                	cmp    %eax,%esi
+  8037bf:	74 cd                	je     80378e <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037c1:	8b 73 04             	mov    0x4(%ebx),%esi
+  8037c4:	8b 03                	mov    (%ebx),%eax
+  8037c6:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8037cc:	29 c6                	sub    %eax,%esi
+  8037ce:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037d3:	f7 e6                	mul    %esi
+  8037d5:	c1 ea 0c             	shr    $0xc,%edx
+  8037d8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037de:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8037e0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037e3:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8037e7:	8b 0b                	mov    (%ebx),%ecx
+  8037e9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037ee:	f7 e1                	mul    %ecx
+  8037f0:	c1 ea 0b             	shr    $0xb,%edx
+  8037f3:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8037f9:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8037fb:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803800:	29 cf                	sub    %ecx,%edi
+  803802:	39 f7                	cmp    %esi,%edi
+  803804:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803807:	83 ec 04             	sub    $0x4,%esp
+  80380a:	57                   	push   %edi
+  80380b:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  80380f:	50                   	push   %eax
+  803810:	ff 75 0c             	push   0xc(%ebp)
+  803813:	e8 8d d2 ff ff       	call   800aa5 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803818:	83 c4 0c             	add    $0xc,%esp
+  80381b:	89 f0                	mov    %esi,%eax
+  80381d:	29 f8                	sub    %edi,%eax
+  80381f:	50                   	push   %eax
+  803820:	8d 43 10             	lea    0x10(%ebx),%eax
+  803823:	50                   	push   %eax
+  803824:	89 f8                	mov    %edi,%eax
+  803826:	03 45 0c             	add    0xc(%ebp),%eax
+  803829:	50                   	push   %eax
+  80382a:	e8 76 d2 ff ff       	call   800aa5 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80382f:	8b 0b                	mov    (%ebx),%ecx
+  803831:	01 f1                	add    %esi,%ecx
+  803833:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803838:	f7 e1                	mul    %ecx
+  80383a:	c1 ea 0c             	shr    $0xc,%edx
+  80383d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803843:	29 c1                	sub    %eax,%ecx
+  803845:	89 0b                	mov    %ecx,(%ebx)
+  803847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384c:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803850:	83 c4 10             	add    $0x10,%esp
+  803853:	85 c0                	test   %eax,%eax
+  803855:	75 0a                	jne    803861 <devpipe_read+0xf5>
+	return n;
+  803857:	89 f0                	mov    %esi,%eax
+}
+  803859:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80385c:	5b                   	pop    %ebx
+  80385d:	5e                   	pop    %esi
+  80385e:	5f                   	pop    %edi
+  80385f:	5d                   	pop    %ebp
+  803860:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803861:	83 ec 08             	sub    $0x8,%esp
+  803864:	68 00 04 00 00       	push   $0x400
+  803869:	53                   	push   %ebx
+  80386a:	e8 da d8 ff ff       	call   801149 <sys_futex_wake>
+  80386f:	83 c4 10             	add    $0x10,%esp
+  803872:	eb e3                	jmp    803857 <devpipe_read+0xeb>
+			return 0;
+  803874:	b8 00 00 00 00       	mov    $0x0,%eax
+  803879:	eb de                	jmp    803859 <devpipe_read+0xed>
+
+0080387b <devpipe_write>:
+{
+  80387b:	55                   	push   %ebp
+  80387c:	89 e5                	mov    %esp,%ebp
+  80387e:	57                   	push   %edi
+  80387f:	56                   	push   %esi
+  803880:	53                   	push   %ebx
+  803881:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803884:	ff 75 08             	push   0x8(%ebp)
+  803887:	e8 c4 e3 ff ff       	call   801c50 <fd2data>
+  80388c:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80388e:	83 c4 10             	add    $0x10,%esp
+  803891:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803898:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80389d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8038a1:	0f 84 43 01 00 00    	je     8039ea <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038a7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038aa:	8b 06                	mov    (%esi),%eax
+  8038ac:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038b2:	29 c1                	sub    %eax,%ecx
+  8038b4:	89 c8                	mov    %ecx,%eax
+  8038b6:	f7 e7                	mul    %edi
+  8038b8:	c1 ea 0c             	shr    $0xc,%edx
+  8038bb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038c1:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8038c3:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8038c9:	75 52                	jne    80391d <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8038cb:	89 f2                	mov    %esi,%edx
+  8038cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038d0:	e8 a7 fd ff ff       	call   80367c <_pipeisclosed>
+  8038d5:	85 c0                	test   %eax,%eax
+  8038d7:	0f 85 28 01 00 00    	jne    803a05 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8038dd:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038df:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038e2:	8b 06                	mov    (%esi),%eax
+  8038e4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038ea:	29 c1                	sub    %eax,%ecx
+  8038ec:	89 c8                	mov    %ecx,%eax
+  8038ee:	f7 e7                	mul    %edi
+  8038f0:	c1 ea 0c             	shr    $0xc,%edx
+  8038f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038f9:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8038fb:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803901:	75 a4                	jne    8038a7 <devpipe_write+0x2c>
+  803903:	b8 01 00 00 00       	mov    $0x1,%eax
+  803908:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80390c:	83 ec 04             	sub    $0x4,%esp
+  80390f:	6a ff                	push   $0xffffffff
+  803911:	53                   	push   %ebx
+  803912:	56                   	push   %esi
+  803913:	e8 0f d8 ff ff       	call   801127 <sys_futex_wait>
+}
+  803918:	83 c4 10             	add    $0x10,%esp
+  80391b:	eb 8a                	jmp    8038a7 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80391d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803920:	8b 06                	mov    (%esi),%eax
+  803922:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803928:	29 c1                	sub    %eax,%ecx
+  80392a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80392f:	f7 e1                	mul    %ecx
+  803931:	c1 ea 0c             	shr    $0xc,%edx
+  803934:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80393a:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80393c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803941:	89 d8                	mov    %ebx,%eax
+  803943:	29 c8                	sub    %ecx,%eax
+  803945:	8b 55 10             	mov    0x10(%ebp),%edx
+  803948:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80394b:	29 ca                	sub    %ecx,%edx
+  80394d:	39 d0                	cmp    %edx,%eax
+  80394f:	0f 46 d0             	cmovbe %eax,%edx
+  803952:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803955:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803958:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80395d:	f7 e1                	mul    %ecx
+  80395f:	c1 ea 0b             	shr    $0xb,%edx
+  803962:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803968:	89 ca                	mov    %ecx,%edx
+  80396a:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80396c:	29 d3                	sub    %edx,%ebx
+  80396e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803971:	39 c3                	cmp    %eax,%ebx
+  803973:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803976:	83 ec 04             	sub    $0x4,%esp
+  803979:	53                   	push   %ebx
+  80397a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80397d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803980:	51                   	push   %ecx
+  803981:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803985:	50                   	push   %eax
+  803986:	e8 1a d1 ff ff       	call   800aa5 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80398b:	83 c4 0c             	add    $0xc,%esp
+  80398e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803991:	29 d8                	sub    %ebx,%eax
+  803993:	50                   	push   %eax
+  803994:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803997:	01 cb                	add    %ecx,%ebx
+  803999:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80399c:	53                   	push   %ebx
+  80399d:	8d 46 10             	lea    0x10(%esi),%eax
+  8039a0:	50                   	push   %eax
+  8039a1:	e8 ff d0 ff ff       	call   800aa5 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8039a6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8039ac:	01 c1                	add    %eax,%ecx
+  8039ae:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039b3:	f7 e1                	mul    %ecx
+  8039b5:	c1 ea 0c             	shr    $0xc,%edx
+  8039b8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8039be:	89 ca                	mov    %ecx,%edx
+  8039c0:	29 c2                	sub    %eax,%edx
+  8039c2:	89 56 04             	mov    %edx,0x4(%esi)
+  8039c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ca:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8039ce:	83 c4 10             	add    $0x10,%esp
+  8039d1:	85 c0                	test   %eax,%eax
+  8039d3:	75 1a                	jne    8039ef <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8039d5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8039d8:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8039db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039de:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8039e1:	0f 82 c0 fe ff ff    	jb     8038a7 <devpipe_write+0x2c>
+  8039e7:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8039ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8039ed:	eb 1b                	jmp    803a0a <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8039ef:	83 ec 08             	sub    $0x8,%esp
+  8039f2:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8039f7:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8039fa:	50                   	push   %eax
+  8039fb:	e8 49 d7 ff ff       	call   801149 <sys_futex_wake>
+  803a00:	83 c4 10             	add    $0x10,%esp
+  803a03:	eb d0                	jmp    8039d5 <devpipe_write+0x15a>
+				return 0;
+  803a05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a0d:	5b                   	pop    %ebx
+  803a0e:	5e                   	pop    %esi
+  803a0f:	5f                   	pop    %edi
+  803a10:	5d                   	pop    %ebp
+  803a11:	c3                   	ret
+
+00803a12 <devpipe_stat>:
+{
+  803a12:	55                   	push   %ebp
+  803a13:	89 e5                	mov    %esp,%ebp
+  803a15:	56                   	push   %esi
+  803a16:	53                   	push   %ebx
+  803a17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803a1a:	83 ec 0c             	sub    $0xc,%esp
+  803a1d:	ff 75 08             	push   0x8(%ebp)
+  803a20:	e8 2b e2 ff ff       	call   801c50 <fd2data>
+  803a25:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803a27:	83 c4 08             	add    $0x8,%esp
+  803a2a:	68 26 4a 80 00       	push   $0x804a26
+  803a2f:	53                   	push   %ebx
+  803a30:	e8 c0 ce ff ff       	call   8008f5 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a35:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a38:	8b 06                	mov    (%esi),%eax
+  803a3a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a40:	29 c1                	sub    %eax,%ecx
+  803a42:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a47:	89 c8                	mov    %ecx,%eax
+  803a49:	f7 e2                	mul    %edx
+  803a4b:	c1 ea 0c             	shr    $0xc,%edx
+  803a4e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a54:	29 d1                	sub    %edx,%ecx
+  803a56:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803a5c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803a63:	00 00 00 
+	stat->st_dev = &devpipe;
+  803a66:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803a6d:	50 80 00 
+}
+  803a70:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a78:	5b                   	pop    %ebx
+  803a79:	5e                   	pop    %esi
+  803a7a:	5d                   	pop    %ebp
+  803a7b:	c3                   	ret
+
+00803a7c <devpipe_poll>:
+{
+  803a7c:	55                   	push   %ebp
+  803a7d:	89 e5                	mov    %esp,%ebp
+  803a7f:	57                   	push   %edi
+  803a80:	56                   	push   %esi
+  803a81:	53                   	push   %ebx
+  803a82:	83 ec 18             	sub    $0x18,%esp
+  803a85:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a88:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803a8b:	57                   	push   %edi
+  803a8c:	e8 bf e1 ff ff       	call   801c50 <fd2data>
+  803a91:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803a93:	83 c4 10             	add    $0x10,%esp
+  803a96:	89 f3                	mov    %esi,%ebx
+  803a98:	83 e3 01             	and    $0x1,%ebx
+  803a9b:	75 27                	jne    803ac4 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803a9d:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803aa3:	75 48                	jne    803aed <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803aa5:	89 ca                	mov    %ecx,%edx
+  803aa7:	89 f8                	mov    %edi,%eax
+  803aa9:	e8 ce fb ff ff       	call   80367c <_pipeisclosed>
+  803aae:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803ab0:	89 d8                	mov    %ebx,%eax
+  803ab2:	83 c8 10             	or     $0x10,%eax
+  803ab5:	85 d2                	test   %edx,%edx
+  803ab7:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803aba:	89 d8                	mov    %ebx,%eax
+  803abc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803abf:	5b                   	pop    %ebx
+  803ac0:	5e                   	pop    %esi
+  803ac1:	5f                   	pop    %edi
+  803ac2:	5d                   	pop    %ebp
+  803ac3:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ac4:	8b 58 04             	mov    0x4(%eax),%ebx
+  803ac7:	8b 00                	mov    (%eax),%eax
+  803ac9:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803acf:	29 c3                	sub    %eax,%ebx
+  803ad1:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803ad6:	89 d8                	mov    %ebx,%eax
+  803ad8:	f7 e2                	mul    %edx
+  803ada:	c1 ea 0c             	shr    $0xc,%edx
+  803add:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803ae3:	39 d3                	cmp    %edx,%ebx
+  803ae5:	0f 95 c3             	setne  %bl
+  803ae8:	0f b6 db             	movzbl %bl,%ebx
+  803aeb:	eb b0                	jmp    803a9d <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803aed:	8b 71 04             	mov    0x4(%ecx),%esi
+  803af0:	8b 01                	mov    (%ecx),%eax
+  803af2:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803af8:	29 c6                	sub    %eax,%esi
+  803afa:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803aff:	89 f0                	mov    %esi,%eax
+  803b01:	f7 e2                	mul    %edx
+  803b03:	c1 ea 0c             	shr    $0xc,%edx
+  803b06:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b0c:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803b0e:	89 d8                	mov    %ebx,%eax
+  803b10:	83 c8 04             	or     $0x4,%eax
+  803b13:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803b19:	0f 42 d8             	cmovb  %eax,%ebx
+  803b1c:	eb 87                	jmp    803aa5 <devpipe_poll+0x29>
+
+00803b1e <pipe>:
+{
+  803b1e:	55                   	push   %ebp
+  803b1f:	89 e5                	mov    %esp,%ebp
+  803b21:	56                   	push   %esi
+  803b22:	53                   	push   %ebx
+  803b23:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803b26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b29:	50                   	push   %eax
+  803b2a:	e8 38 e1 ff ff       	call   801c67 <fd_alloc>
+  803b2f:	89 c3                	mov    %eax,%ebx
+  803b31:	83 c4 10             	add    $0x10,%esp
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	0f 88 23 01 00 00    	js     803c5f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b3c:	83 ec 04             	sub    $0x4,%esp
+  803b3f:	68 07 04 00 00       	push   $0x407
+  803b44:	ff 75 f4             	push   -0xc(%ebp)
+  803b47:	6a 00                	push   $0x0
+  803b49:	e8 db d1 ff ff       	call   800d29 <sys_page_alloc>
+  803b4e:	89 c3                	mov    %eax,%ebx
+  803b50:	83 c4 10             	add    $0x10,%esp
+  803b53:	85 c0                	test   %eax,%eax
+  803b55:	0f 88 04 01 00 00    	js     803c5f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803b5b:	83 ec 0c             	sub    $0xc,%esp
+  803b5e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b61:	50                   	push   %eax
+  803b62:	e8 00 e1 ff ff       	call   801c67 <fd_alloc>
+  803b67:	89 c3                	mov    %eax,%ebx
+  803b69:	83 c4 10             	add    $0x10,%esp
+  803b6c:	85 c0                	test   %eax,%eax
+  803b6e:	0f 88 db 00 00 00    	js     803c4f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b74:	83 ec 04             	sub    $0x4,%esp
+  803b77:	68 07 04 00 00       	push   $0x407
+  803b7c:	ff 75 f0             	push   -0x10(%ebp)
+  803b7f:	6a 00                	push   $0x0
+  803b81:	e8 a3 d1 ff ff       	call   800d29 <sys_page_alloc>
+  803b86:	89 c3                	mov    %eax,%ebx
+  803b88:	83 c4 10             	add    $0x10,%esp
+  803b8b:	85 c0                	test   %eax,%eax
+  803b8d:	0f 88 bc 00 00 00    	js     803c4f <pipe+0x131>
+	va = fd2data(fd0);
+  803b93:	83 ec 0c             	sub    $0xc,%esp
+  803b96:	ff 75 f4             	push   -0xc(%ebp)
+  803b99:	e8 b2 e0 ff ff       	call   801c50 <fd2data>
+  803b9e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ba0:	83 c4 0c             	add    $0xc,%esp
+  803ba3:	68 07 04 00 00       	push   $0x407
+  803ba8:	50                   	push   %eax
+  803ba9:	6a 00                	push   $0x0
+  803bab:	e8 79 d1 ff ff       	call   800d29 <sys_page_alloc>
+  803bb0:	89 c3                	mov    %eax,%ebx
+  803bb2:	83 c4 10             	add    $0x10,%esp
+  803bb5:	85 c0                	test   %eax,%eax
+  803bb7:	0f 88 82 00 00 00    	js     803c3f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bbd:	83 ec 0c             	sub    $0xc,%esp
+  803bc0:	ff 75 f0             	push   -0x10(%ebp)
+  803bc3:	e8 88 e0 ff ff       	call   801c50 <fd2data>
+  803bc8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803bcf:	50                   	push   %eax
+  803bd0:	6a 00                	push   $0x0
+  803bd2:	56                   	push   %esi
+  803bd3:	6a 00                	push   $0x0
+  803bd5:	e8 92 d1 ff ff       	call   800d6c <sys_page_map>
+  803bda:	89 c3                	mov    %eax,%ebx
+  803bdc:	83 c4 20             	add    $0x20,%esp
+  803bdf:	85 c0                	test   %eax,%eax
+  803be1:	78 4e                	js     803c31 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803be3:	a1 60 50 80 00       	mov    0x805060,%eax
+  803be8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803beb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803bed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803bf0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803bf7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803bfa:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803bfc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803bff:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803c06:	83 ec 0c             	sub    $0xc,%esp
+  803c09:	ff 75 f4             	push   -0xc(%ebp)
+  803c0c:	e8 2f e0 ff ff       	call   801c40 <fd2num>
+  803c11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c14:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803c16:	83 c4 04             	add    $0x4,%esp
+  803c19:	ff 75 f0             	push   -0x10(%ebp)
+  803c1c:	e8 1f e0 ff ff       	call   801c40 <fd2num>
+  803c21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c24:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803c27:	83 c4 10             	add    $0x10,%esp
+  803c2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c2f:	eb 2e                	jmp    803c5f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803c31:	83 ec 08             	sub    $0x8,%esp
+  803c34:	56                   	push   %esi
+  803c35:	6a 00                	push   $0x0
+  803c37:	e8 72 d1 ff ff       	call   800dae <sys_page_unmap>
+  803c3c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803c3f:	83 ec 08             	sub    $0x8,%esp
+  803c42:	ff 75 f0             	push   -0x10(%ebp)
+  803c45:	6a 00                	push   $0x0
+  803c47:	e8 62 d1 ff ff       	call   800dae <sys_page_unmap>
+  803c4c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803c4f:	83 ec 08             	sub    $0x8,%esp
+  803c52:	ff 75 f4             	push   -0xc(%ebp)
+  803c55:	6a 00                	push   $0x0
+  803c57:	e8 52 d1 ff ff       	call   800dae <sys_page_unmap>
+  803c5c:	83 c4 10             	add    $0x10,%esp
+}
+  803c5f:	89 d8                	mov    %ebx,%eax
+  803c61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c64:	5b                   	pop    %ebx
+  803c65:	5e                   	pop    %esi
+  803c66:	5d                   	pop    %ebp
+  803c67:	c3                   	ret
+
+00803c68 <pipeisclosed>:
+{
+  803c68:	55                   	push   %ebp
+  803c69:	89 e5                	mov    %esp,%ebp
+  803c6b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c6e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c71:	50                   	push   %eax
+  803c72:	ff 75 08             	push   0x8(%ebp)
+  803c75:	e8 3d e0 ff ff       	call   801cb7 <fd_lookup>
+  803c7a:	83 c4 10             	add    $0x10,%esp
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	78 18                	js     803c99 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c81:	83 ec 0c             	sub    $0xc,%esp
+  803c84:	ff 75 f4             	push   -0xc(%ebp)
+  803c87:	e8 c4 df ff ff       	call   801c50 <fd2data>
+  803c8c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c91:	e8 e6 f9 ff ff       	call   80367c <_pipeisclosed>
+  803c96:	83 c4 10             	add    $0x10,%esp
+}
+  803c99:	c9                   	leave
+  803c9a:	c3                   	ret
+
+00803c9b <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803c9b:	55                   	push   %ebp
+  803c9c:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ca1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ca7:	5d                   	pop    %ebp
+  803ca8:	c3                   	ret
+
+00803ca9 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803ca9:	55                   	push   %ebp
+  803caa:	89 e5                	mov    %esp,%ebp
+  803cac:	53                   	push   %ebx
+  803cad:	83 ec 04             	sub    $0x4,%esp
+  803cb0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803cb3:	8b 03                	mov    (%ebx),%eax
+  803cb5:	85 c0                	test   %eax,%eax
+  803cb7:	75 05                	jne    803cbe <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803cb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cbc:	c9                   	leave
+  803cbd:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803cbe:	83 ec 08             	sub    $0x8,%esp
+  803cc1:	50                   	push   %eax
+  803cc2:	8d 43 04             	lea    0x4(%ebx),%eax
+  803cc5:	50                   	push   %eax
+  803cc6:	e8 33 d3 ff ff       	call   800ffe <sys_page_batch>
+	pb->pb_n = 0;
+  803ccb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803cd1:	83 c4 10             	add    $0x10,%esp
+  803cd4:	eb e3                	jmp    803cb9 <pgbatch_flush+0x10>
+
+00803cd6 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803cd6:	55                   	push   %ebp
+  803cd7:	89 e5                	mov    %esp,%ebp
+  803cd9:	56                   	push   %esi
+  803cda:	53                   	push   %ebx
+  803cdb:	89 c3                	mov    %eax,%ebx
+  803cdd:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803cdf:	83 38 20             	cmpl   $0x20,(%eax)
+  803ce2:	74 2c                	je     803d10 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803ce4:	8b 03                	mov    (%ebx),%eax
+  803ce6:	8d 50 01             	lea    0x1(%eax),%edx
+  803ce9:	89 13                	mov    %edx,(%ebx)
+  803ceb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803cee:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803cf2:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803cf4:	83 ec 04             	sub    $0x4,%esp
+  803cf7:	6a 18                	push   $0x18
+  803cf9:	6a 00                	push   $0x0
+  803cfb:	50                   	push   %eax
+  803cfc:	e8 6f cd ff ff       	call   800a70 <memset>
+	return 0;
+  803d01:	83 c4 10             	add    $0x10,%esp
+  803d04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d0c:	5b                   	pop    %ebx
+  803d0d:	5e                   	pop    %esi
+  803d0e:	5d                   	pop    %ebp
+  803d0f:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d10:	83 ec 0c             	sub    $0xc,%esp
+  803d13:	50                   	push   %eax
+  803d14:	e8 90 ff ff ff       	call   803ca9 <pgbatch_flush>
+  803d19:	83 c4 10             	add    $0x10,%esp
+  803d1c:	85 c0                	test   %eax,%eax
+  803d1e:	79 c4                	jns    803ce4 <pgbatch_slot+0xe>
+  803d20:	eb e7                	jmp    803d09 <pgbatch_slot+0x33>
+
+00803d22 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803d22:	55                   	push   %ebp
+  803d23:	89 e5                	mov    %esp,%ebp
+  803d25:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d28:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d2e:	e8 a3 ff ff ff       	call   803cd6 <pgbatch_slot>
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	78 20                	js     803d57 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803d37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d3a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803d40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d43:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803d46:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d49:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d4c:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d4f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d57:	c9                   	leave
+  803d58:	c3                   	ret
+
+00803d59 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803d59:	55                   	push   %ebp
+  803d5a:	89 e5                	mov    %esp,%ebp
+  803d5c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d5f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d62:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d65:	e8 6c ff ff ff       	call   803cd6 <pgbatch_slot>
+  803d6a:	85 c0                	test   %eax,%eax
+  803d6c:	78 2c                	js     803d9a <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803d6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d71:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803d77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d7a:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803d7d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d80:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803d83:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d86:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803d89:	8b 55 18             	mov    0x18(%ebp),%edx
+  803d8c:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d8f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803d92:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d9a:	c9                   	leave
+  803d9b:	c3                   	ret
+
+00803d9c <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803d9c:	55                   	push   %ebp
+  803d9d:	89 e5                	mov    %esp,%ebp
+  803d9f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803da2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803da5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803da8:	e8 29 ff ff ff       	call   803cd6 <pgbatch_slot>
+  803dad:	85 c0                	test   %eax,%eax
+  803daf:	78 1a                	js     803dcb <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803db1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803db4:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803dba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dbd:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803dc0:	8b 55 10             	mov    0x10(%ebp),%edx
+  803dc3:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dcb:	c9                   	leave
+  803dcc:	c3                   	ret
+
+00803dcd <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803dcd:	55                   	push   %ebp
+  803dce:	89 e5                	mov    %esp,%ebp
+  803dd0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803dd3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dd9:	e8 f8 fe ff ff       	call   803cd6 <pgbatch_slot>
+  803dde:	85 c0                	test   %eax,%eax
+  803de0:	78 20                	js     803e02 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803de2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803de5:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803deb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dee:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803df1:	8b 55 10             	mov    0x10(%ebp),%edx
+  803df4:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803df7:	8b 55 14             	mov    0x14(%ebp),%edx
+  803dfa:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e02:	c9                   	leave
+  803e03:	c3                   	ret
+
+00803e04 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803e04:	55                   	push   %ebp
+  803e05:	89 e5                	mov    %esp,%ebp
+  803e07:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e0a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e10:	e8 c1 fe ff ff       	call   803cd6 <pgbatch_slot>
+  803e15:	85 c0                	test   %eax,%eax
+  803e17:	78 26                	js     803e3f <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803e19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e1c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803e22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e25:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803e28:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e2b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e2e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e31:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803e34:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e37:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e3f:	c9                   	leave
+  803e40:	c3                   	ret
+
+00803e41 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803e41:	55                   	push   %ebp
+  803e42:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803e44:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e47:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e4d:	5d                   	pop    %ebp
+  803e4e:	c3                   	ret
+
+00803e4f <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803e4f:	55                   	push   %ebp
+  803e50:	89 e5                	mov    %esp,%ebp
+  803e52:	56                   	push   %esi
+  803e53:	53                   	push   %ebx
+  803e54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803e57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e61:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803e65:	85 c0                	test   %eax,%eax
+  803e67:	74 2f                	je     803e98 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803e69:	83 f8 02             	cmp    $0x2,%eax
+  803e6c:	74 0c                	je     803e7a <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803e6e:	b8 02 00 00 00       	mov    $0x2,%eax
+  803e73:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803e76:	85 c0                	test   %eax,%eax
+  803e78:	74 1e                	je     803e98 <mutex_lock+0x49>
+  803e7a:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803e7f:	83 ec 04             	sub    $0x4,%esp
+  803e82:	6a ff                	push   $0xffffffff
+  803e84:	6a 02                	push   $0x2
+  803e86:	53                   	push   %ebx
+  803e87:	e8 9b d2 ff ff       	call   801127 <sys_futex_wait>
+  803e8c:	89 f0                	mov    %esi,%eax
+  803e8e:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803e91:	83 c4 10             	add    $0x10,%esp
+  803e94:	85 c0                	test   %eax,%eax
+  803e96:	75 e7                	jne    803e7f <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803e98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e9b:	5b                   	pop    %ebx
+  803e9c:	5e                   	pop    %esi
+  803e9d:	5d                   	pop    %ebp
+  803e9e:	c3                   	ret
+
+00803e9f <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803e9f:	55                   	push   %ebp
+  803ea0:	89 e5                	mov    %esp,%ebp
+  803ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eaa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803eaf:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803eb3:	85 c0                	test   %eax,%eax
+  803eb5:	0f 94 c0             	sete   %al
+  803eb8:	0f b6 c0             	movzbl %al,%eax
+}
+  803ebb:	5d                   	pop    %ebp
+  803ebc:	c3                   	ret
+
+00803ebd <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803ebd:	55                   	push   %ebp
+  803ebe:	89 e5                	mov    %esp,%ebp
+  803ec0:	83 ec 08             	sub    $0x8,%esp
+  803ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecb:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803ece:	83 f8 02             	cmp    $0x2,%eax
+  803ed1:	74 02                	je     803ed5 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803ed3:	c9                   	leave
+  803ed4:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803ed5:	83 ec 08             	sub    $0x8,%esp
+  803ed8:	6a 01                	push   $0x1
+  803eda:	52                   	push   %edx
+  803edb:	e8 69 d2 ff ff       	call   801149 <sys_futex_wake>
+  803ee0:	83 c4 10             	add    $0x10,%esp
+}
+  803ee3:	eb ee                	jmp    803ed3 <mutex_unlock+0x16>
+
+00803ee5 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803ee5:	55                   	push   %ebp
+  803ee6:	89 e5                	mov    %esp,%ebp
+  803ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803eeb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803ef1:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803ef8:	5d                   	pop    %ebp
+  803ef9:	c3                   	ret
+
+00803efa <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803efa:	55                   	push   %ebp
+  803efb:	89 e5                	mov    %esp,%ebp
+  803efd:	57                   	push   %edi
+  803efe:	56                   	push   %esi
+  803eff:	53                   	push   %ebx
+  803f00:	83 ec 18             	sub    $0x18,%esp
+  803f03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f06:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803f09:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803f0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f10:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803f15:	57                   	push   %edi
+  803f16:	e8 a2 ff ff ff       	call   803ebd <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803f1b:	83 c4 0c             	add    $0xc,%esp
+  803f1e:	ff 75 10             	push   0x10(%ebp)
+  803f21:	56                   	push   %esi
+  803f22:	53                   	push   %ebx
+  803f23:	e8 ff d1 ff ff       	call   801127 <sys_futex_wait>
+  803f28:	89 c6                	mov    %eax,%esi
+  803f2a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803f2f:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803f34:	89 3c 24             	mov    %edi,(%esp)
+  803f37:	e8 13 ff ff ff       	call   803e4f <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803f3c:	83 c4 10             	add    $0x10,%esp
+  803f3f:	83 fe ef             	cmp    $0xffffffef,%esi
+  803f42:	74 05                	je     803f49 <cond_timedwait+0x4f>
+  803f44:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803f49:	89 f0                	mov    %esi,%eax
+  803f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f4e:	5b                   	pop    %ebx
+  803f4f:	5e                   	pop    %esi
+  803f50:	5f                   	pop    %edi
+  803f51:	5d                   	pop    %ebp
+  803f52:	c3                   	ret
+
+00803f53 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803f53:	55                   	push   %ebp
+  803f54:	89 e5                	mov    %esp,%ebp
+  803f56:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803f59:	6a ff                	push   $0xffffffff
+  803f5b:	ff 75 0c             	push   0xc(%ebp)
+  803f5e:	ff 75 08             	push   0x8(%ebp)
+  803f61:	e8 94 ff ff ff       	call   803efa <cond_timedwait>
+}
+  803f66:	83 c4 10             	add    $0x10,%esp
+  803f69:	c9                   	leave
+  803f6a:	c3                   	ret
+
+00803f6b <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803f6b:	55                   	push   %ebp
+  803f6c:	89 e5                	mov    %esp,%ebp
+  803f6e:	83 ec 08             	sub    $0x8,%esp
+  803f71:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f74:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f79:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803f7d:	8b 50 04             	mov    0x4(%eax),%edx
+  803f80:	85 d2                	test   %edx,%edx
+  803f82:	75 02                	jne    803f86 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803f84:	c9                   	leave
+  803f85:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803f86:	83 ec 08             	sub    $0x8,%esp
+  803f89:	6a 01                	push   $0x1
+  803f8b:	50                   	push   %eax
+  803f8c:	e8 b8 d1 ff ff       	call   801149 <sys_futex_wake>
+  803f91:	83 c4 10             	add    $0x10,%esp
+}
+  803f94:	eb ee                	jmp    803f84 <cond_signal+0x19>
+
+00803f96 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803f96:	55                   	push   %ebp
+  803f97:	89 e5                	mov    %esp,%ebp
+  803f99:	83 ec 08             	sub    $0x8,%esp
+  803f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f9f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fa4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803fa8:	8b 50 04             	mov    0x4(%eax),%edx
+  803fab:	85 d2                	test   %edx,%edx
+  803fad:	75 02                	jne    803fb1 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803faf:	c9                   	leave
+  803fb0:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803fb1:	83 ec 08             	sub    $0x8,%esp
+  803fb4:	68 00 04 00 00       	push   $0x400
+  803fb9:	50                   	push   %eax
+  803fba:	e8 8a d1 ff ff       	call   801149 <sys_futex_wake>
+  803fbf:	83 c4 10             	add    $0x10,%esp
+}
+  803fc2:	eb eb                	jmp    803faf <cond_broadcast+0x19>
+
+00803fc4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc9:	c3                   	ret
+
+00803fca <devcons_poll>:
+{
+  803fca:	55                   	push   %ebp
+  803fcb:	89 e5                	mov    %esp,%ebp
+  803fcd:	53                   	push   %ebx
+  803fce:	83 ec 04             	sub    $0x4,%esp
+  803fd1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803fd4:	89 da                	mov    %ebx,%edx
+  803fd6:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803fd9:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  803fe0:	74 0c                	je     803fee <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803fe2:	89 d8                	mov    %ebx,%eax
+  803fe4:	83 e0 01             	and    $0x1,%eax
+  803fe7:	09 d0                	or     %edx,%eax
+}
+  803fe9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fec:	c9                   	leave
+  803fed:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803fee:	e8 98 cc ff ff       	call   800c8b <sys_cgetc>
+  803ff3:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803ff8:	89 da                	mov    %ebx,%edx
+  803ffa:	83 e2 04             	and    $0x4,%edx
+  803ffd:	85 c0                	test   %eax,%eax
+  803fff:	74 e6                	je     803fe7 <devcons_poll+0x1d>
+  804001:	eb df                	jmp    803fe2 <devcons_poll+0x18>
+
+00804003 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804003:	55                   	push   %ebp
+  804004:	89 e5                	mov    %esp,%ebp
+  804006:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804009:	68 32 4a 80 00       	push   $0x804a32
+  80400e:	ff 75 0c             	push   0xc(%ebp)
+  804011:	e8 df c8 ff ff       	call   8008f5 <strcpy>
+	return 0;
+}
+  804016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80401b:	c9                   	leave
+  80401c:	c3                   	ret
+
+0080401d <devcons_write>:
+{
+  80401d:	55                   	push   %ebp
+  80401e:	89 e5                	mov    %esp,%ebp
+  804020:	57                   	push   %edi
+  804021:	56                   	push   %esi
+  804022:	53                   	push   %ebx
+  804023:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804029:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80402c:	85 ff                	test   %edi,%edi
+  80402e:	74 51                	je     804081 <devcons_write+0x64>
+  804030:	be 00 00 00 00       	mov    $0x0,%esi
+  804035:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80403a:	89 fb                	mov    %edi,%ebx
+  80403c:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80403e:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804043:	39 d3                	cmp    %edx,%ebx
+  804045:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804048:	83 ec 04             	sub    $0x4,%esp
+  80404b:	53                   	push   %ebx
+  80404c:	03 45 0c             	add    0xc(%ebp),%eax
+  80404f:	50                   	push   %eax
+  804050:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804056:	50                   	push   %eax
+  804057:	e8 49 ca ff ff       	call   800aa5 <memmove>
+		sys_cputs(buf, m);
+  80405c:	83 c4 08             	add    $0x8,%esp
+  80405f:	53                   	push   %ebx
+  804060:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804066:	50                   	push   %eax
+  804067:	e8 01 cc ff ff       	call   800c6d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80406c:	01 de                	add    %ebx,%esi
+  80406e:	89 f0                	mov    %esi,%eax
+  804070:	83 c4 10             	add    $0x10,%esp
+  804073:	39 fe                	cmp    %edi,%esi
+  804075:	72 c3                	jb     80403a <devcons_write+0x1d>
+}
+  804077:	89 f0                	mov    %esi,%eax
+  804079:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80407c:	5b                   	pop    %ebx
+  80407d:	5e                   	pop    %esi
+  80407e:	5f                   	pop    %edi
+  80407f:	5d                   	pop    %ebp
+  804080:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  804081:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804086:	eb ef                	jmp    804077 <devcons_write+0x5a>
+
+00804088 <devcons_read>:
+{
+  804088:	55                   	push   %ebp
+  804089:	89 e5                	mov    %esp,%ebp
+  80408b:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80408e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  804093:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804097:	74 36                	je     8040cf <devcons_read+0x47>
+	c = cons_peek;
+  804099:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  80409e:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  8040a5:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8040a8:	85 c0                	test   %eax,%eax
+  8040aa:	75 10                	jne    8040bc <devcons_read+0x34>
+  8040ac:	e8 da cb ff ff       	call   800c8b <sys_cgetc>
+  8040b1:	85 c0                	test   %eax,%eax
+  8040b3:	75 07                	jne    8040bc <devcons_read+0x34>
+		sys_yield();
+  8040b5:	e8 50 cc ff ff       	call   800d0a <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8040ba:	eb f0                	jmp    8040ac <devcons_read+0x24>
+	if (c < 0)
+  8040bc:	85 c0                	test   %eax,%eax
+  8040be:	78 0f                	js     8040cf <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8040c0:	83 f8 04             	cmp    $0x4,%eax
+  8040c3:	74 0c                	je     8040d1 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8040c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8040c8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8040ca:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8040cf:	c9                   	leave
+  8040d0:	c3                   	ret
+		return 0;
+  8040d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d6:	eb f7                	jmp    8040cf <devcons_read+0x47>
+
+008040d8 <cputchar>:
+{
+  8040d8:	55                   	push   %ebp
+  8040d9:	89 e5                	mov    %esp,%ebp
+  8040db:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8040de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040e1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8040e4:	6a 01                	push   $0x1
+  8040e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8040e9:	50                   	push   %eax
+  8040ea:	e8 7e cb ff ff       	call   800c6d <sys_cputs>
+}
+  8040ef:	83 c4 10             	add    $0x10,%esp
+  8040f2:	c9                   	leave
+  8040f3:	c3                   	ret
+
+008040f4 <getchar>:
+{
+  8040f4:	55                   	push   %ebp
+  8040f5:	89 e5                	mov    %esp,%ebp
+  8040f7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8040fa:	6a 01                	push   $0x1
+  8040fc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8040ff:	50                   	push   %eax
+  804100:	6a 00                	push   $0x0
+  804102:	e8 34 de ff ff       	call   801f3b <read>
+	if (r < 0)
+  804107:	83 c4 10             	add    $0x10,%esp
+  80410a:	85 c0                	test   %eax,%eax
+  80410c:	78 06                	js     804114 <getchar+0x20>
+	if (r < 1)
+  80410e:	74 06                	je     804116 <getchar+0x22>
+	return c;
+  804110:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804114:	c9                   	leave
+  804115:	c3                   	ret
+		return -E_EOF;
+  804116:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80411b:	eb f7                	jmp    804114 <getchar+0x20>
+
+0080411d <iscons>:
+{
+  80411d:	55                   	push   %ebp
+  80411e:	89 e5                	mov    %esp,%ebp
+  804120:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804123:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804126:	50                   	push   %eax
+  804127:	ff 75 08             	push   0x8(%ebp)
+  80412a:	e8 88 db ff ff       	call   801cb7 <fd_lookup>
+  80412f:	83 c4 10             	add    $0x10,%esp
+  804132:	85 c0                	test   %eax,%eax
+  804134:	78 11                	js     804147 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804136:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804139:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80413f:	39 10                	cmp    %edx,(%eax)
+  804141:	0f 94 c0             	sete   %al
+  804144:	0f b6 c0             	movzbl %al,%eax
+}
+  804147:	c9                   	leave
+  804148:	c3                   	ret
+
+00804149 <opencons>:
+{
+  804149:	55                   	push   %ebp
+  80414a:	89 e5                	mov    %esp,%ebp
+  80414c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80414f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804152:	50                   	push   %eax
+  804153:	e8 0f db ff ff       	call   801c67 <fd_alloc>
+  804158:	83 c4 10             	add    $0x10,%esp
+  80415b:	85 c0                	test   %eax,%eax
+  80415d:	78 3a                	js     804199 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80415f:	83 ec 04             	sub    $0x4,%esp
+  804162:	68 07 04 00 00       	push   $0x407
+  804167:	ff 75 f4             	push   -0xc(%ebp)
+  80416a:	6a 00                	push   $0x0
+  80416c:	e8 b8 cb ff ff       	call   800d29 <sys_page_alloc>
+  804171:	83 c4 10             	add    $0x10,%esp
+  804174:	85 c0                	test   %eax,%eax
+  804176:	78 21                	js     804199 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804178:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80417b:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  804181:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804183:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804186:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80418d:	83 ec 0c             	sub    $0xc,%esp
+  804190:	50                   	push   %eax
+  804191:	e8 aa da ff ff       	call   801c40 <fd2num>
+  804196:	83 c4 10             	add    $0x10,%esp
+}
+  804199:	c9                   	leave
+  80419a:	c3                   	ret
+
+0080419b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80419b:	55                   	push   %ebp
+  80419c:	89 e5                	mov    %esp,%ebp
+  80419e:	56                   	push   %esi
+  80419f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8041a0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8041a3:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8041a9:	e8 3d cb ff ff       	call   800ceb <sys_getenvid>
+  8041ae:	83 ec 0c             	sub    $0xc,%esp
+  8041b1:	ff 75 0c             	push   0xc(%ebp)
+  8041b4:	ff 75 08             	push   0x8(%ebp)
+  8041b7:	56                   	push   %esi
+  8041b8:	50                   	push   %eax
+  8041b9:	68 40 4a 80 00       	push   $0x804a40
+  8041be:	e8 3b c0 ff ff       	call   8001fe <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8041c3:	83 c4 18             	add    $0x18,%esp
+  8041c6:	53                   	push   %ebx
+  8041c7:	ff 75 10             	push   0x10(%ebp)
+  8041ca:	e8 de bf ff ff       	call   8001ad <vcprintf>
+	cprintf("\n");
+  8041cf:	c7 04 24 24 4a 80 00 	movl   $0x804a24,(%esp)
+  8041d6:	e8 23 c0 ff ff       	call   8001fe <cprintf>
+  8041db:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8041de:	cc                   	int3
+	while (1)
+  8041df:	eb fd                	jmp    8041de <_panic+0x43>
+
+008041e1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8041e1:	55                   	push   %ebp
+  8041e2:	89 e5                	mov    %esp,%ebp
+  8041e4:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8041e7:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8041ee:	74 0a                	je     8041fa <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8041f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041f3:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8041f8:	c9                   	leave
+  8041f9:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8041fa:	83 ec 04             	sub    $0x4,%esp
+  8041fd:	6a 07                	push   $0x7
+  8041ff:	68 00 f0 bf ee       	push   $0xeebff000
+  804204:	6a 00                	push   $0x0
+  804206:	e8 1e cb ff ff       	call   800d29 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80420b:	83 c4 08             	add    $0x8,%esp
+  80420e:	68 1f 42 80 00       	push   $0x80421f
+  804213:	6a 00                	push   $0x0
+  804215:	e8 5a cc ff ff       	call   800e74 <sys_env_set_pgfault_upcall>
+  80421a:	83 c4 10             	add    $0x10,%esp
+  80421d:	eb d1                	jmp    8041f0 <set_pgfault_handler+0xf>
+
+0080421f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80421f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804220:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804225:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804227:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  80422a:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  80422e:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804231:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804235:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804237:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80423b:	83 c4 08             	add    $0x8,%esp
+	popal;
+  80423e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80423f:	83 c4 04             	add    $0x4,%esp
+	popf
+  804242:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804243:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804244:	c3                   	ret
+
+00804245 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804245:	55                   	push   %ebp
+  804246:	89 e5                	mov    %esp,%ebp
+  804248:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80424b:	89 c2                	mov    %eax,%edx
+  80424d:	c1 ea 16             	shr    $0x16,%edx
+  804250:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804257:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80425c:	f6 c1 01             	test   $0x1,%cl
+  80425f:	74 1e                	je     80427f <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804261:	c1 e8 0c             	shr    $0xc,%eax
+  804264:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80426b:	a8 01                	test   $0x1,%al
+  80426d:	74 10                	je     80427f <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80426f:	c1 e8 0c             	shr    $0xc,%eax
+  804272:	c1 e0 04             	shl    $0x4,%eax
+  804275:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80427c:	0f b7 d2             	movzwl %dx,%edx
+}
+  80427f:	89 d0                	mov    %edx,%eax
+  804281:	5d                   	pop    %ebp
+  804282:	c3                   	ret
+
+00804283 <__udivdi3>:
+  804283:	57                   	push   %edi
+  804284:	56                   	push   %esi
+  804285:	53                   	push   %ebx
+  804286:	83 ec 20             	sub    $0x20,%esp
+  804289:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80428d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804291:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804295:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804299:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80429d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8042a1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8042a5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8042a9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8042ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8042bf:	00 
+  8042c0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8042c7:	00 
+  8042c8:	eb 08                	jmp    8042d2 <__udivdi3+0x4f>
+  8042ca:	83 e9 01             	sub    $0x1,%ecx
+  8042cd:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8042d0:	74 68                	je     80433a <__udivdi3+0xb7>
+  8042d2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8042d6:	01 c0                	add    %eax,%eax
+  8042d8:	89 c6                	mov    %eax,%esi
+  8042da:	89 d7                	mov    %edx,%edi
+  8042dc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8042e0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8042e4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8042e7:	d3 ea                	shr    %cl,%edx
+  8042e9:	f6 c1 20             	test   $0x20,%cl
+  8042ec:	74 04                	je     8042f2 <__udivdi3+0x6f>
+  8042ee:	89 d0                	mov    %edx,%eax
+  8042f0:	31 d2                	xor    %edx,%edx
+  8042f2:	83 e0 01             	and    $0x1,%eax
+  8042f5:	89 04 24             	mov    %eax,(%esp)
+  8042f8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8042ff:	00 
+  804300:	8b 04 24             	mov    (%esp),%eax
+  804303:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804307:	09 f0                	or     %esi,%eax
+  804309:	09 fa                	or     %edi,%edx
+  80430b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80430f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804313:	39 f0                	cmp    %esi,%eax
+  804315:	89 d3                	mov    %edx,%ebx
+  804317:	19 fb                	sbb    %edi,%ebx
+  804319:	72 af                	jb     8042ca <__udivdi3+0x47>
+  80431b:	29 f0                	sub    %esi,%eax
+  80431d:	19 fa                	sbb    %edi,%edx
+  80431f:	89 cf                	mov    %ecx,%edi
+  804321:	c1 ef 05             	shr    $0x5,%edi
+  804324:	83 e7 01             	and    $0x1,%edi
+  804327:	89 fe                	mov    %edi,%esi
+  804329:	83 f6 01             	xor    $0x1,%esi
+  80432c:	d3 e6                	shl    %cl,%esi
+  80432e:	d3 e7                	shl    %cl,%edi
+  804330:	09 74 24 18          	or     %esi,0x18(%esp)
+  804334:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804338:	eb 90                	jmp    8042ca <__udivdi3+0x47>
+  80433a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80433e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804342:	83 c4 20             	add    $0x20,%esp
+  804345:	5b                   	pop    %ebx
+  804346:	5e                   	pop    %esi
+  804347:	5f                   	pop    %edi
+  804348:	c3                   	ret
+
+00804349 <__umoddi3>:
+  804349:	57                   	push   %edi
+  80434a:	56                   	push   %esi
+  80434b:	53                   	push   %ebx
+  80434c:	83 ec 08             	sub    $0x8,%esp
+  80434f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804353:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804357:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80435b:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80435f:	57                   	push   %edi
+  804360:	56                   	push   %esi
+  804361:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804365:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804369:	52                   	push   %edx
+  80436a:	50                   	push   %eax
+  80436b:	e8 13 ff ff ff       	call   804283 <__udivdi3>
+  804370:	89 c3                	mov    %eax,%ebx
+  804372:	0f af d6             	imul   %esi,%edx
+  804375:	89 f9                	mov    %edi,%ecx
+  804377:	0f af cb             	imul   %ebx,%ecx
+  80437a:	01 d1                	add    %edx,%ecx
+  80437c:	89 d8                	mov    %ebx,%eax
+  80437e:	f7 e6                	mul    %esi
+  804380:	89 c6                	mov    %eax,%esi
+  804382:	89 d7                	mov    %edx,%edi
+  804384:	01 cf                	add    %ecx,%edi
+  804386:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80438a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80438e:	29 f0                	sub    %esi,%eax
+  804390:	19 fa                	sbb    %edi,%edx
+  804392:	83 c4 18             	add    $0x18,%esp
+  804395:	5b                   	pop    %ebx
+  804396:	5e                   	pop    %esi
+  804397:	5f                   	pop    %edi
+  804398:	c3                   	ret
+
+00804399 <__divdi3>:
+  804399:	53                   	push   %ebx
+  80439a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80439e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8043a2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8043a6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8043aa:	85 d2                	test   %edx,%edx
+  8043ac:	78 12                	js     8043c0 <__divdi3+0x27>
+  8043ae:	85 db                	test   %ebx,%ebx
+  8043b0:	78 2e                	js     8043e0 <__divdi3+0x47>
+  8043b2:	53                   	push   %ebx
+  8043b3:	51                   	push   %ecx
+  8043b4:	52                   	push   %edx
+  8043b5:	50                   	push   %eax
+  8043b6:	e8 c8 fe ff ff       	call   804283 <__udivdi3>
+  8043bb:	83 c4 10             	add    $0x10,%esp
+  8043be:	eb 1e                	jmp    8043de <__divdi3+0x45>
+  8043c0:	f7 d8                	neg    %eax
+  8043c2:	83 d2 00             	adc    $0x0,%edx
+  8043c5:	f7 da                	neg    %edx
+  8043c7:	85 db                	test   %ebx,%ebx
+  8043c9:	78 2a                	js     8043f5 <__divdi3+0x5c>
+  8043cb:	53                   	push   %ebx
+  8043cc:	51                   	push   %ecx
+  8043cd:	52                   	push   %edx
+  8043ce:	50                   	push   %eax
+  8043cf:	e8 af fe ff ff       	call   804283 <__udivdi3>
+  8043d4:	83 c4 10             	add    $0x10,%esp
+  8043d7:	f7 d8                	neg    %eax
+  8043d9:	83 d2 00             	adc    $0x0,%edx
+  8043dc:	f7 da                	neg    %edx
+  8043de:	5b                   	pop    %ebx
+  8043df:	c3                   	ret
+  8043e0:	f7 d9                	neg    %ecx
+  8043e2:	83 d3 00             	adc    $0x0,%ebx
+  8043e5:	f7 db                	neg    %ebx
+  8043e7:	53                   	push   %ebx
+  8043e8:	51                   	push   %ecx
+  8043e9:	52                   	push   %edx
+  8043ea:	50                   	push   %eax
+  8043eb:	e8 93 fe ff ff       	call   804283 <__udivdi3>
+  8043f0:	83 c4 10             	add    $0x10,%esp
+  8043f3:	eb e2                	jmp    8043d7 <__divdi3+0x3e>
+  8043f5:	f7 d9                	neg    %ecx
+  8043f7:	83 d3 00             	adc    $0x0,%ebx
+  8043fa:	f7 db                	neg    %ebx
+  8043fc:	53                   	push   %ebx
+  8043fd:	51                   	push   %ecx
+  8043fe:	52                   	push   %edx
+  8043ff:	50                   	push   %eax
+  804400:	e8 7e fe ff ff       	call   804283 <__udivdi3>
+  804405:	83 c4 10             	add    $0x10,%esp
+  804408:	eb d4                	jmp    8043de <__divdi3+0x45>
+
+0080440a <__moddi3>:
+  80440a:	57                   	push   %edi
+  80440b:	56                   	push   %esi
+  80440c:	53                   	push   %ebx
+  80440d:	83 ec 08             	sub    $0x8,%esp
+  804410:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804414:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804418:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80441c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804420:	57                   	push   %edi
+  804421:	56                   	push   %esi
+  804422:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804426:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80442a:	52                   	push   %edx
+  80442b:	50                   	push   %eax
+  80442c:	e8 68 ff ff ff       	call   804399 <__divdi3>
+  804431:	89 c3                	mov    %eax,%ebx
+  804433:	0f af d6             	imul   %esi,%edx
+  804436:	89 f9                	mov    %edi,%ecx
+  804438:	0f af cb             	imul   %ebx,%ecx
+  80443b:	01 d1                	add    %edx,%ecx
+  80443d:	89 d8                	mov    %ebx,%eax
+  80443f:	f7 e6                	mul    %esi
+  804441:	89 c6                	mov    %eax,%esi
+  804443:	89 d7                	mov    %edx,%edi
+  804445:	01 cf                	add    %ecx,%edi
+  804447:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80444b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80444f:	29 f0                	sub    %esi,%eax
+  804451:	19 fa                	sbb    %edi,%edx
+  804453:	83 c4 18             	add    $0x18,%esp
+  804456:	5b                   	pop    %ebx
+  804457:	5e                   	pop    %esi
+  804458:	5f                   	pop    %edi
+  804459:	c3                   	ret
@@ -0,0 +1,9154 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 65 01 00 00       	call   800196 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <pingpong>:
+
+uint32_t val;
+
+static void
+pingpong(void *arg)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t who;
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 00                	push   $0x0
+  800043:	6a 00                	push   $0x0
+  800045:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 d4 19 00 00       	call   801a22 <ipc_recv>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80004e:	89 e0                	mov    %esp,%eax
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800050:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800055:	29 c2                	sub    %eax,%edx
+
+	return slot < NTHREADS ? slot : 0;
+  800057:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80005a:	89 d0                	mov    %edx,%eax
+  80005c:	c1 e8 0f             	shr    $0xf,%eax
+  80005f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800065:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80006a:	0f 43 c1             	cmovae %ecx,%eax
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80006d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  800074:	8b 40 48             	mov    0x48(%eax),%eax
+  800077:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80007a:	89 e0                	mov    %esp,%eax
+  80007c:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800081:	29 c2                	sub    %eax,%edx
+  800083:	89 d0                	mov    %edx,%eax
+  800085:	c1 e8 0f             	shr    $0xf,%eax
+  800088:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80008e:	0f 43 c1             	cmovae %ecx,%eax
+  800091:	8b 3c 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%edi
+  800098:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80009b:	8b 1d f8 69 80 00    	mov    0x8069f8,%ebx
+  8000a1:	e8 5f 0d 00 00       	call   800e05 <sys_getenvid>
+  8000a6:	83 ec 08             	sub    $0x8,%esp
+  8000a9:	ff 75 d4             	push   -0x2c(%ebp)
+  8000ac:	57                   	push   %edi
+  8000ad:	56                   	push   %esi
+  8000ae:	53                   	push   %ebx
+  8000af:	50                   	push   %eax
+  8000b0:	68 a0 45 80 00       	push   $0x8045a0
+  8000b5:	e8 5e 02 00 00       	call   800318 <cprintf>
+		if (val == 10)
+  8000ba:	a1 f8 69 80 00       	mov    0x8069f8,%eax
+  8000bf:	83 c4 20             	add    $0x20,%esp
+  8000c2:	83 f8 0a             	cmp    $0xa,%eax
+  8000c5:	74 26                	je     8000ed <pingpong+0xb8>
+			return;
+		++val;
+  8000c7:	83 c0 01             	add    $0x1,%eax
+  8000ca:	a3 f8 69 80 00       	mov    %eax,0x8069f8
+		ipc_send(who, 0, 0, 0);
+  8000cf:	6a 00                	push   $0x0
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	6a 00                	push   $0x0
+  8000d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8000d8:	e8 d5 1b 00 00       	call   801cb2 <ipc_send>
+		if (val == 10)
+  8000dd:	83 c4 10             	add    $0x10,%esp
+  8000e0:	83 3d f8 69 80 00 0a 	cmpl   $0xa,0x8069f8
+  8000e7:	0f 85 51 ff ff ff    	jne    80003e <pingpong+0x9>
+			return;
+	}
+}
+  8000ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f0:	5b                   	pop    %ebx
+  8000f1:	5e                   	pop    %esi
+  8000f2:	5f                   	pop    %edi
+  8000f3:	5d                   	pop    %ebp
+  8000f4:	c3                   	ret
+
+008000f5 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000f5:	55                   	push   %ebp
+  8000f6:	89 e5                	mov    %esp,%ebp
+  8000f8:	56                   	push   %esi
+  8000f9:	53                   	push   %ebx
+	envid_t who;
+
+	if ((who = sfork(pingpong, 0)) < 0)
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	6a 00                	push   $0x0
+  8000ff:	68 35 00 80 00       	push   $0x800035
+  800104:	e8 3d 17 00 00       	call   801846 <sfork>
+  800109:	89 c3                	mov    %eax,%ebx
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	78 72                	js     800184 <umain+0x8f>
+  800112:	89 e2                	mov    %esp,%edx
+  800114:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800119:	29 d0                	sub    %edx,%eax
+  80011b:	89 c2                	mov    %eax,%edx
+  80011d:	c1 ea 0f             	shr    $0xf,%edx
+  800120:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012a:	0f 42 c2             	cmovb  %edx,%eax
+		panic("sfork: %e", who);
+	cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  80012d:	8b 34 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%esi
+  800134:	e8 cc 0c 00 00       	call   800e05 <sys_getenvid>
+  800139:	83 ec 04             	sub    $0x4,%esp
+  80013c:	56                   	push   %esi
+  80013d:	50                   	push   %eax
+  80013e:	68 e1 45 80 00       	push   $0x8045e1
+  800143:	e8 d0 01 00 00       	call   800318 <cprintf>
+	// get the ball rolling
+	cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800148:	e8 b8 0c 00 00       	call   800e05 <sys_getenvid>
+  80014d:	83 c4 0c             	add    $0xc,%esp
+  800150:	53                   	push   %ebx
+  800151:	50                   	push   %eax
+  800152:	68 fb 45 80 00       	push   $0x8045fb
+  800157:	e8 bc 01 00 00       	call   800318 <cprintf>
+	ipc_send(who, 0, 0, 0);
+  80015c:	6a 00                	push   $0x0
+  80015e:	6a 00                	push   $0x0
+  800160:	6a 00                	push   $0x0
+  800162:	53                   	push   %ebx
+  800163:	e8 4a 1b 00 00       	call   801cb2 <ipc_send>
+	pingpong(0);
+  800168:	83 c4 14             	add    $0x14,%esp
+  80016b:	6a 00                	push   $0x0
+  80016d:	e8 c3 fe ff ff       	call   800035 <pingpong>
+	wait(who);
+  800172:	89 1c 24             	mov    %ebx,(%esp)
+  800175:	e8 3b 3c 00 00       	call   803db5 <wait>
+}
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800180:	5b                   	pop    %ebx
+  800181:	5e                   	pop    %esi
+  800182:	5d                   	pop    %ebp
+  800183:	c3                   	ret
+		panic("sfork: %e", who);
+  800184:	50                   	push   %eax
+  800185:	68 c6 45 80 00       	push   $0x8045c6
+  80018a:	6a 1f                	push   $0x1f
+  80018c:	68 d0 45 80 00       	push   $0x8045d0
+  800191:	e8 a7 00 00 00       	call   80023d <_panic>
+
+00800196 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	56                   	push   %esi
+  80019a:	53                   	push   %ebx
+  80019b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001a1:	89 e2                	mov    %esp,%edx
+  8001a3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8001a8:	29 d0                	sub    %edx,%eax
+  8001aa:	89 c2                	mov    %eax,%edx
+  8001ac:	c1 ea 0f             	shr    $0xf,%edx
+  8001af:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8001b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b9:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8001bc:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  8001c3:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8001c7:	e8 39 0c 00 00       	call   800e05 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8001cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8001d7:	89 e1                	mov    %esp,%ecx
+  8001d9:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8001de:	29 ca                	sub    %ecx,%edx
+  8001e0:	89 d1                	mov    %edx,%ecx
+  8001e2:	c1 e9 0f             	shr    $0xf,%ecx
+  8001e5:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8001eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f0:	0f 42 d1             	cmovb  %ecx,%edx
+  8001f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f8:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ff:	85 db                	test   %ebx,%ebx
+  800201:	7e 07                	jle    80020a <libmain+0x74>
+		binaryname = argv[0];
+  800203:	8b 06                	mov    (%esi),%eax
+  800205:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80020a:	83 ec 08             	sub    $0x8,%esp
+  80020d:	56                   	push   %esi
+  80020e:	53                   	push   %ebx
+  80020f:	e8 e1 fe ff ff       	call   8000f5 <umain>
+
+	// exit gracefully
+	exit();
+  800214:	e8 0a 00 00 00       	call   800223 <exit>
+}
+  800219:	83 c4 10             	add    $0x10,%esp
+  80021c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80021f:	5b                   	pop    %ebx
+  800220:	5e                   	pop    %esi
+  800221:	5d                   	pop    %ebp
+  800222:	c3                   	ret
+
+00800223 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800223:	55                   	push   %ebp
+  800224:	89 e5                	mov    %esp,%ebp
+  800226:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800229:	e8 15 1d 00 00       	call   801f43 <close_all>
+	sys_env_destroy(0);
+  80022e:	83 ec 0c             	sub    $0xc,%esp
+  800231:	6a 00                	push   $0x0
+  800233:	e8 8c 0b 00 00       	call   800dc4 <sys_env_destroy>
+}
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800242:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800245:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80024b:	e8 b5 0b 00 00       	call   800e05 <sys_getenvid>
+  800250:	83 ec 0c             	sub    $0xc,%esp
+  800253:	ff 75 0c             	push   0xc(%ebp)
+  800256:	ff 75 08             	push   0x8(%ebp)
+  800259:	56                   	push   %esi
+  80025a:	50                   	push   %eax
+  80025b:	68 1c 46 80 00       	push   $0x80461c
+  800260:	e8 b3 00 00 00       	call   800318 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800265:	83 c4 18             	add    $0x18,%esp
+  800268:	53                   	push   %ebx
+  800269:	ff 75 10             	push   0x10(%ebp)
+  80026c:	e8 56 00 00 00       	call   8002c7 <vcprintf>
+	cprintf("\n");
+  800271:	c7 04 24 c4 4b 80 00 	movl   $0x804bc4,(%esp)
+  800278:	e8 9b 00 00 00       	call   800318 <cprintf>
+  80027d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800280:	cc                   	int3
+	while (1)
+  800281:	eb fd                	jmp    800280 <_panic+0x43>
+
+00800283 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800283:	55                   	push   %ebp
+  800284:	89 e5                	mov    %esp,%ebp
+  800286:	53                   	push   %ebx
+  800287:	83 ec 04             	sub    $0x4,%esp
+  80028a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80028d:	8b 13                	mov    (%ebx),%edx
+  80028f:	8d 42 01             	lea    0x1(%edx),%eax
+  800292:	89 03                	mov    %eax,(%ebx)
+  800294:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800297:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80029b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002a0:	74 09                	je     8002ab <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a9:	c9                   	leave
+  8002aa:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ab:	83 ec 08             	sub    $0x8,%esp
+  8002ae:	68 ff 00 00 00       	push   $0xff
+  8002b3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	e8 cb 0a 00 00       	call   800d87 <sys_cputs>
+		b->idx = 0;
+  8002bc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c2:	83 c4 10             	add    $0x10,%esp
+  8002c5:	eb db                	jmp    8002a2 <putch+0x1f>
+
+008002c7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c7:	55                   	push   %ebp
+  8002c8:	89 e5                	mov    %esp,%ebp
+  8002ca:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002d0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d7:	00 00 00 
+	b.cnt = 0;
+  8002da:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002e4:	ff 75 0c             	push   0xc(%ebp)
+  8002e7:	ff 75 08             	push   0x8(%ebp)
+  8002ea:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002f0:	50                   	push   %eax
+  8002f1:	68 83 02 80 00       	push   $0x800283
+  8002f6:	e8 1c 01 00 00       	call   800417 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002fb:	83 c4 08             	add    $0x8,%esp
+  8002fe:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800304:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80030a:	50                   	push   %eax
+  80030b:	e8 77 0a 00 00       	call   800d87 <sys_cputs>
+
+	return b.cnt;
+}
+  800310:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800316:	c9                   	leave
+  800317:	c3                   	ret
+
+00800318 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800318:	55                   	push   %ebp
+  800319:	89 e5                	mov    %esp,%ebp
+  80031b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80031e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800321:	50                   	push   %eax
+  800322:	ff 75 08             	push   0x8(%ebp)
+  800325:	e8 9d ff ff ff       	call   8002c7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+
+0080032c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	57                   	push   %edi
+  800330:	56                   	push   %esi
+  800331:	53                   	push   %ebx
+  800332:	83 ec 1c             	sub    $0x1c,%esp
+  800335:	89 c3                	mov    %eax,%ebx
+  800337:	89 d6                	mov    %edx,%esi
+  800339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80033f:	89 d1                	mov    %edx,%ecx
+  800341:	89 c2                	mov    %eax,%edx
+  800343:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800346:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800349:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80034c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800356:	39 c2                	cmp    %eax,%edx
+  800358:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80035b:	73 4b                	jae    8003a8 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80035d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800360:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800363:	85 ff                	test   %edi,%edi
+  800365:	7e 11                	jle    800378 <printnum+0x4c>
+			putch(padc, putdat);
+  800367:	83 ec 08             	sub    $0x8,%esp
+  80036a:	56                   	push   %esi
+  80036b:	ff 75 18             	push   0x18(%ebp)
+  80036e:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800370:	83 c4 10             	add    $0x10,%esp
+  800373:	83 ef 01             	sub    $0x1,%edi
+  800376:	75 ef                	jne    800367 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800378:	83 ec 08             	sub    $0x8,%esp
+  80037b:	56                   	push   %esi
+  80037c:	83 ec 04             	sub    $0x4,%esp
+  80037f:	ff 75 e4             	push   -0x1c(%ebp)
+  800382:	ff 75 e0             	push   -0x20(%ebp)
+  800385:	ff 75 dc             	push   -0x24(%ebp)
+  800388:	ff 75 d8             	push   -0x28(%ebp)
+  80038b:	e8 ef 40 00 00       	call   80447f <__umoddi3>
+  800390:	83 c4 14             	add    $0x14,%esp
+  800393:	0f be 80 3f 46 80 00 	movsbl 0x80463f(%eax),%eax
+  80039a:	50                   	push   %eax
+  80039b:	ff d3                	call   *%ebx
+}
+  80039d:	83 c4 10             	add    $0x10,%esp
+  8003a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a3:	5b                   	pop    %ebx
+  8003a4:	5e                   	pop    %esi
+  8003a5:	5f                   	pop    %edi
+  8003a6:	5d                   	pop    %ebp
+  8003a7:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003a8:	83 ec 0c             	sub    $0xc,%esp
+  8003ab:	ff 75 18             	push   0x18(%ebp)
+  8003ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003b4:	52                   	push   %edx
+  8003b5:	50                   	push   %eax
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8003bc:	ff 75 e0             	push   -0x20(%ebp)
+  8003bf:	ff 75 dc             	push   -0x24(%ebp)
+  8003c2:	ff 75 d8             	push   -0x28(%ebp)
+  8003c5:	e8 ef 3f 00 00       	call   8043b9 <__udivdi3>
+  8003ca:	83 c4 18             	add    $0x18,%esp
+  8003cd:	52                   	push   %edx
+  8003ce:	50                   	push   %eax
+  8003cf:	89 f2                	mov    %esi,%edx
+  8003d1:	89 d8                	mov    %ebx,%eax
+  8003d3:	e8 54 ff ff ff       	call   80032c <printnum>
+  8003d8:	83 c4 20             	add    $0x20,%esp
+  8003db:	eb 9b                	jmp    800378 <printnum+0x4c>
+
+008003dd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003dd:	55                   	push   %ebp
+  8003de:	89 e5                	mov    %esp,%ebp
+  8003e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003e3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003e7:	8b 10                	mov    (%eax),%edx
+  8003e9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003ec:	73 0a                	jae    8003f8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003ee:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003f1:	89 08                	mov    %ecx,(%eax)
+  8003f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f6:	88 02                	mov    %al,(%edx)
+}
+  8003f8:	5d                   	pop    %ebp
+  8003f9:	c3                   	ret
+
+008003fa <printfmt>:
+{
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800400:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800403:	50                   	push   %eax
+  800404:	ff 75 10             	push   0x10(%ebp)
+  800407:	ff 75 0c             	push   0xc(%ebp)
+  80040a:	ff 75 08             	push   0x8(%ebp)
+  80040d:	e8 05 00 00 00       	call   800417 <vprintfmt>
+}
+  800412:	83 c4 10             	add    $0x10,%esp
+  800415:	c9                   	leave
+  800416:	c3                   	ret
+
+00800417 <vprintfmt>:
+{
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	57                   	push   %edi
+  80041b:	56                   	push   %esi
+  80041c:	53                   	push   %ebx
+  80041d:	83 ec 2c             	sub    $0x2c,%esp
+  800420:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800423:	89 df                	mov    %ebx,%edi
+  800425:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800428:	8b 45 10             	mov    0x10(%ebp),%eax
+  80042b:	8d 70 01             	lea    0x1(%eax),%esi
+  80042e:	0f b6 00             	movzbl (%eax),%eax
+  800431:	83 f8 25             	cmp    $0x25,%eax
+  800434:	74 1e                	je     800454 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800436:	85 c0                	test   %eax,%eax
+  800438:	0f 84 15 05 00 00    	je     800953 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	53                   	push   %ebx
+  800442:	50                   	push   %eax
+  800443:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800445:	83 c6 01             	add    $0x1,%esi
+  800448:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044c:	83 c4 10             	add    $0x10,%esp
+  80044f:	83 f8 25             	cmp    $0x25,%eax
+  800452:	75 e2                	jne    800436 <vprintfmt+0x1f>
+		padc = ' ';
+  800454:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800458:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80045f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800466:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80046d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800472:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800475:	8d 56 01             	lea    0x1(%esi),%edx
+  800478:	0f b6 0e             	movzbl (%esi),%ecx
+  80047b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80047e:	3c 55                	cmp    $0x55,%al
+  800480:	0f 87 3b 04 00 00    	ja     8008c1 <vprintfmt+0x4aa>
+  800486:	0f b6 c0             	movzbl %al,%eax
+  800489:	ff 24 85 a0 47 80 00 	jmp    *0x8047a0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800490:	89 75 10             	mov    %esi,0x10(%ebp)
+  800493:	eb 93                	jmp    800428 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800495:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800497:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80049b:	eb d8                	jmp    800475 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049d:	89 d6                	mov    %edx,%esi
+  80049f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004a3:	eb d0                	jmp    800475 <vprintfmt+0x5e>
+  8004a5:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8004a8:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8004ae:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8004b2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004b5:	83 f9 09             	cmp    $0x9,%ecx
+  8004b8:	77 6f                	ja     800529 <vprintfmt+0x112>
+  8004ba:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8004bd:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8004c0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004c3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8004c7:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8004ca:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004cd:	83 fe 09             	cmp    $0x9,%esi
+  8004d0:	76 eb                	jbe    8004bd <vprintfmt+0xa6>
+  8004d2:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8004d5:	89 d6                	mov    %edx,%esi
+  8004d7:	eb 13                	jmp    8004ec <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8004d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dc:	8b 00                	mov    (%eax),%eax
+  8004de:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ea:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8004ec:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004f0:	79 83                	jns    800475 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8004f2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004f8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004ff:	e9 71 ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+			if (width < 0)
+  800504:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800507:	85 c9                	test   %ecx,%ecx
+  800509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050e:	0f 49 c1             	cmovns %ecx,%eax
+  800511:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800514:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800516:	e9 5a ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80051b:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80051d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800524:	e9 4c ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800529:	89 d6                	mov    %edx,%esi
+  80052b:	eb bf                	jmp    8004ec <vprintfmt+0xd5>
+			lflag++;
+  80052d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800531:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800533:	e9 3d ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800538:	89 55 10             	mov    %edx,0x10(%ebp)
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	8d 70 04             	lea    0x4(%eax),%esi
+  800541:	83 ec 08             	sub    $0x8,%esp
+  800544:	53                   	push   %ebx
+  800545:	ff 30                	push   (%eax)
+  800547:	ff d7                	call   *%edi
+			break;
+  800549:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80054c:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80054f:	e9 d4 fe ff ff       	jmp    800428 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800554:	89 55 10             	mov    %edx,0x10(%ebp)
+  800557:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055a:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80055d:	8b 10                	mov    (%eax),%edx
+  80055f:	89 d0                	mov    %edx,%eax
+  800561:	f7 d8                	neg    %eax
+  800563:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800566:	83 f8 12             	cmp    $0x12,%eax
+  800569:	7f 23                	jg     80058e <vprintfmt+0x177>
+  80056b:	8b 14 85 00 49 80 00 	mov    0x804900(,%eax,4),%edx
+  800572:	85 d2                	test   %edx,%edx
+  800574:	74 18                	je     80058e <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800576:	52                   	push   %edx
+  800577:	68 8f 4b 80 00       	push   $0x804b8f
+  80057c:	53                   	push   %ebx
+  80057d:	57                   	push   %edi
+  80057e:	e8 77 fe ff ff       	call   8003fa <printfmt>
+  800583:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800586:	89 75 14             	mov    %esi,0x14(%ebp)
+  800589:	e9 9a fe ff ff       	jmp    800428 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80058e:	50                   	push   %eax
+  80058f:	68 57 46 80 00       	push   $0x804657
+  800594:	53                   	push   %ebx
+  800595:	57                   	push   %edi
+  800596:	e8 5f fe ff ff       	call   8003fa <printfmt>
+  80059b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80059e:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005a1:	e9 82 fe ff ff       	jmp    800428 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	83 c0 04             	add    $0x4,%eax
+  8005af:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 00                	mov    (%eax),%eax
+  8005b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ba:	85 c0                	test   %eax,%eax
+  8005bc:	0f 84 61 03 00 00    	je     800923 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8005c2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005c6:	7e 06                	jle    8005ce <vprintfmt+0x1b7>
+  8005c8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005cc:	75 29                	jne    8005f7 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005d1:	8d 70 01             	lea    0x1(%eax),%esi
+  8005d4:	0f b6 00             	movzbl (%eax),%eax
+  8005d7:	0f be d0             	movsbl %al,%edx
+  8005da:	85 d2                	test   %edx,%edx
+  8005dc:	0f 84 bb 00 00 00    	je     80069d <vprintfmt+0x286>
+  8005e2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005e5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005e8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005ee:	eb 7a                	jmp    80066a <vprintfmt+0x253>
+				p = "(null)";
+  8005f0:	c7 45 d0 50 46 80 00 	movl   $0x804650,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f7:	83 ec 08             	sub    $0x8,%esp
+  8005fa:	ff 75 d4             	push   -0x2c(%ebp)
+  8005fd:	ff 75 d0             	push   -0x30(%ebp)
+  800600:	e8 e0 03 00 00       	call   8009e5 <strnlen>
+  800605:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800608:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80060b:	83 c4 10             	add    $0x10,%esp
+  80060e:	85 d2                	test   %edx,%edx
+  800610:	0f 8e d6 02 00 00    	jle    8008ec <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800616:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	56                   	push   %esi
+  80061f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800621:	83 c4 10             	add    $0x10,%esp
+  800624:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800628:	75 f0                	jne    80061a <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80062a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80062d:	8d 70 01             	lea    0x1(%eax),%esi
+  800630:	0f b6 00             	movzbl (%eax),%eax
+  800633:	0f be d0             	movsbl %al,%edx
+  800636:	85 d2                	test   %edx,%edx
+  800638:	0f 84 da 02 00 00    	je     800918 <vprintfmt+0x501>
+  80063e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800641:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800644:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800647:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80064a:	eb 1e                	jmp    80066a <vprintfmt+0x253>
+					putch(ch, putdat);
+  80064c:	83 ec 08             	sub    $0x8,%esp
+  80064f:	ff 75 0c             	push   0xc(%ebp)
+  800652:	52                   	push   %edx
+  800653:	ff 55 08             	call   *0x8(%ebp)
+  800656:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800659:	83 eb 01             	sub    $0x1,%ebx
+  80065c:	83 c6 01             	add    $0x1,%esi
+  80065f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800663:	0f be d0             	movsbl %al,%edx
+  800666:	85 d2                	test   %edx,%edx
+  800668:	74 2a                	je     800694 <vprintfmt+0x27d>
+  80066a:	85 ff                	test   %edi,%edi
+  80066c:	78 05                	js     800673 <vprintfmt+0x25c>
+  80066e:	83 ef 01             	sub    $0x1,%edi
+  800671:	78 59                	js     8006cc <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800673:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800677:	74 d3                	je     80064c <vprintfmt+0x235>
+  800679:	0f be c0             	movsbl %al,%eax
+  80067c:	83 e8 20             	sub    $0x20,%eax
+  80067f:	83 f8 5e             	cmp    $0x5e,%eax
+  800682:	76 c8                	jbe    80064c <vprintfmt+0x235>
+					putch('?', putdat);
+  800684:	83 ec 08             	sub    $0x8,%esp
+  800687:	ff 75 0c             	push   0xc(%ebp)
+  80068a:	6a 3f                	push   $0x3f
+  80068c:	ff 55 08             	call   *0x8(%ebp)
+  80068f:	83 c4 10             	add    $0x10,%esp
+  800692:	eb c5                	jmp    800659 <vprintfmt+0x242>
+  800694:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800697:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80069a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80069d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006a0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006a4:	7e 1b                	jle    8006c1 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 20                	push   $0x20
+  8006ac:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006ae:	83 c4 10             	add    $0x10,%esp
+  8006b1:	83 ee 01             	sub    $0x1,%esi
+  8006b4:	75 f0                	jne    8006a6 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006b6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bc:	e9 67 fd ff ff       	jmp    800428 <vprintfmt+0x11>
+  8006c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c7:	e9 5c fd ff ff       	jmp    800428 <vprintfmt+0x11>
+  8006cc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006d5:	eb c6                	jmp    80069d <vprintfmt+0x286>
+	if (lflag >= 2)
+  8006d7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006da:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006dd:	83 f9 01             	cmp    $0x1,%ecx
+  8006e0:	7f 1f                	jg     800701 <vprintfmt+0x2ea>
+	else if (lflag)
+  8006e2:	85 c9                	test   %ecx,%ecx
+  8006e4:	74 67                	je     80074d <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8b 30                	mov    (%eax),%esi
+  8006eb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006ee:	89 f0                	mov    %esi,%eax
+  8006f0:	c1 f8 1f             	sar    $0x1f,%eax
+  8006f3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ff:	eb 17                	jmp    800718 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 50 04             	mov    0x4(%eax),%edx
+  800707:	8b 00                	mov    (%eax),%eax
+  800709:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8d 40 08             	lea    0x8(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800718:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80071b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80071e:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800723:	85 c9                	test   %ecx,%ecx
+  800725:	0f 89 12 01 00 00    	jns    80083d <vprintfmt+0x426>
+				putch('-', putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	6a 2d                	push   $0x2d
+  800731:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800733:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800736:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800739:	f7 da                	neg    %edx
+  80073b:	83 d1 00             	adc    $0x0,%ecx
+  80073e:	f7 d9                	neg    %ecx
+  800740:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800743:	be 0a 00 00 00       	mov    $0xa,%esi
+  800748:	e9 f0 00 00 00       	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 30                	mov    (%eax),%esi
+  800752:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800755:	89 f0                	mov    %esi,%eax
+  800757:	c1 f8 1f             	sar    $0x1f,%eax
+  80075a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80075d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800760:	8d 40 04             	lea    0x4(%eax),%eax
+  800763:	89 45 14             	mov    %eax,0x14(%ebp)
+  800766:	eb b0                	jmp    800718 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800768:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80076b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80076e:	83 f9 01             	cmp    $0x1,%ecx
+  800771:	7f 1e                	jg     800791 <vprintfmt+0x37a>
+	else if (lflag)
+  800773:	85 c9                	test   %ecx,%ecx
+  800775:	74 32                	je     8007a9 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8b 10                	mov    (%eax),%edx
+  80077c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800781:	8d 40 04             	lea    0x4(%eax),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800787:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80078c:	e9 ac 00 00 00       	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	8b 48 04             	mov    0x4(%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8007a4:	e9 94 00 00 00       	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8b 10                	mov    (%eax),%edx
+  8007ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b9:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8007be:	eb 7d                	jmp    80083d <vprintfmt+0x426>
+	if (lflag >= 2)
+  8007c0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007c3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007c6:	83 f9 01             	cmp    $0x1,%ecx
+  8007c9:	7f 1b                	jg     8007e6 <vprintfmt+0x3cf>
+	else if (lflag)
+  8007cb:	85 c9                	test   %ecx,%ecx
+  8007cd:	74 2c                	je     8007fb <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d2:	8b 10                	mov    (%eax),%edx
+  8007d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007df:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8007e4:	eb 57                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ee:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f4:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8007f9:	eb 42                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8b 10                	mov    (%eax),%edx
+  800800:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800805:	8d 40 04             	lea    0x4(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80080b:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800810:	eb 2b                	jmp    80083d <vprintfmt+0x426>
+			putch('0', putdat);
+  800812:	89 55 10             	mov    %edx,0x10(%ebp)
+  800815:	83 ec 08             	sub    $0x8,%esp
+  800818:	53                   	push   %ebx
+  800819:	6a 30                	push   $0x30
+  80081b:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80081d:	83 c4 08             	add    $0x8,%esp
+  800820:	53                   	push   %ebx
+  800821:	6a 78                	push   $0x78
+  800823:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800825:	8b 45 14             	mov    0x14(%ebp),%eax
+  800828:	8b 10                	mov    (%eax),%edx
+  80082a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80082f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800832:	8d 40 04             	lea    0x4(%eax),%eax
+  800835:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800838:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80083d:	83 ec 0c             	sub    $0xc,%esp
+  800840:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800844:	50                   	push   %eax
+  800845:	ff 75 e4             	push   -0x1c(%ebp)
+  800848:	56                   	push   %esi
+  800849:	51                   	push   %ecx
+  80084a:	52                   	push   %edx
+  80084b:	89 da                	mov    %ebx,%edx
+  80084d:	89 f8                	mov    %edi,%eax
+  80084f:	e8 d8 fa ff ff       	call   80032c <printnum>
+			break;
+  800854:	83 c4 20             	add    $0x20,%esp
+  800857:	e9 cc fb ff ff       	jmp    800428 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80085c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80085f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800862:	83 f9 01             	cmp    $0x1,%ecx
+  800865:	7f 1b                	jg     800882 <vprintfmt+0x46b>
+	else if (lflag)
+  800867:	85 c9                	test   %ecx,%ecx
+  800869:	74 2c                	je     800897 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80086b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086e:	8b 10                	mov    (%eax),%edx
+  800870:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800875:	8d 40 04             	lea    0x4(%eax),%eax
+  800878:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800880:	eb bb                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800882:	8b 45 14             	mov    0x14(%ebp),%eax
+  800885:	8b 10                	mov    (%eax),%edx
+  800887:	8b 48 04             	mov    0x4(%eax),%ecx
+  80088a:	8d 40 08             	lea    0x8(%eax),%eax
+  80088d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800890:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800895:	eb a6                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 10                	mov    (%eax),%edx
+  80089c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a7:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8008ac:	eb 8f                	jmp    80083d <vprintfmt+0x426>
+			putch(ch, putdat);
+  8008ae:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b1:	83 ec 08             	sub    $0x8,%esp
+  8008b4:	53                   	push   %ebx
+  8008b5:	6a 25                	push   $0x25
+  8008b7:	ff d7                	call   *%edi
+			break;
+  8008b9:	83 c4 10             	add    $0x10,%esp
+  8008bc:	e9 67 fb ff ff       	jmp    800428 <vprintfmt+0x11>
+			putch('%', putdat);
+  8008c1:	83 ec 08             	sub    $0x8,%esp
+  8008c4:	53                   	push   %ebx
+  8008c5:	6a 25                	push   $0x25
+  8008c7:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008c9:	83 c4 10             	add    $0x10,%esp
+  8008cc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008d0:	0f 84 ba fb ff ff    	je     800490 <vprintfmt+0x79>
+  8008d6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008d9:	89 f0                	mov    %esi,%eax
+  8008db:	83 e8 01             	sub    $0x1,%eax
+  8008de:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008e2:	75 f7                	jne    8008db <vprintfmt+0x4c4>
+  8008e4:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008e7:	e9 3c fb ff ff       	jmp    800428 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ec:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008ef:	8d 70 01             	lea    0x1(%eax),%esi
+  8008f2:	0f b6 00             	movzbl (%eax),%eax
+  8008f5:	0f be d0             	movsbl %al,%edx
+  8008f8:	85 d2                	test   %edx,%edx
+  8008fa:	74 11                	je     80090d <vprintfmt+0x4f6>
+  8008fc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008ff:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800902:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800905:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800908:	e9 5d fd ff ff       	jmp    80066a <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80090d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800910:	89 45 14             	mov    %eax,0x14(%ebp)
+  800913:	e9 10 fb ff ff       	jmp    800428 <vprintfmt+0x11>
+  800918:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80091b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80091e:	e9 05 fb ff ff       	jmp    800428 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800923:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800927:	7e 0a                	jle    800933 <vprintfmt+0x51c>
+  800929:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80092d:	0f 85 bd fc ff ff    	jne    8005f0 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800933:	ba 28 00 00 00       	mov    $0x28,%edx
+  800938:	b8 28 00 00 00       	mov    $0x28,%eax
+  80093d:	be 51 46 80 00       	mov    $0x804651,%esi
+  800942:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800945:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800948:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80094b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80094e:	e9 17 fd ff ff       	jmp    80066a <vprintfmt+0x253>
+}
+  800953:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800956:	5b                   	pop    %ebx
+  800957:	5e                   	pop    %esi
+  800958:	5f                   	pop    %edi
+  800959:	5d                   	pop    %ebp
+  80095a:	c3                   	ret
+
+0080095b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	83 ec 18             	sub    $0x18,%esp
+  800961:	8b 45 08             	mov    0x8(%ebp),%eax
+  800964:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800967:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80096a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80096e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800971:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800978:	85 c0                	test   %eax,%eax
+  80097a:	74 26                	je     8009a2 <vsnprintf+0x47>
+  80097c:	85 d2                	test   %edx,%edx
+  80097e:	7e 22                	jle    8009a2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800980:	ff 75 14             	push   0x14(%ebp)
+  800983:	ff 75 10             	push   0x10(%ebp)
+  800986:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800989:	50                   	push   %eax
+  80098a:	68 dd 03 80 00       	push   $0x8003dd
+  80098f:	e8 83 fa ff ff       	call   800417 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800994:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800997:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80099a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80099d:	83 c4 10             	add    $0x10,%esp
+}
+  8009a0:	c9                   	leave
+  8009a1:	c3                   	ret
+		return -E_INVAL;
+  8009a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a7:	eb f7                	jmp    8009a0 <vsnprintf+0x45>
+
+008009a9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009af:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009b2:	50                   	push   %eax
+  8009b3:	ff 75 10             	push   0x10(%ebp)
+  8009b6:	ff 75 0c             	push   0xc(%ebp)
+  8009b9:	ff 75 08             	push   0x8(%ebp)
+  8009bc:	e8 9a ff ff ff       	call   80095b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+
+008009c3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009c9:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009cc:	74 10                	je     8009de <strlen+0x1b>
+  8009ce:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8009d3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009d6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009da:	75 f7                	jne    8009d3 <strlen+0x10>
+	return n;
+}
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8009de:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8009e3:	eb f7                	jmp    8009dc <strlen+0x19>
+
+008009e5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ee:	85 d2                	test   %edx,%edx
+  8009f0:	74 16                	je     800a08 <strnlen+0x23>
+  8009f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009fb:	74 09                	je     800a06 <strnlen+0x21>
+		n++;
+  8009fd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a00:	39 d0                	cmp    %edx,%eax
+  800a02:	75 f3                	jne    8009f7 <strnlen+0x12>
+		n++;
+  800a04:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a06:	5d                   	pop    %ebp
+  800a07:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0d:	eb f7                	jmp    800a06 <strnlen+0x21>
+
+00800a0f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	53                   	push   %ebx
+  800a13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a16:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a22:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a25:	83 c0 01             	add    $0x1,%eax
+  800a28:	84 d2                	test   %dl,%dl
+  800a2a:	75 f2                	jne    800a1e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a2c:	89 c8                	mov    %ecx,%eax
+  800a2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a31:	c9                   	leave
+  800a32:	c3                   	ret
+
+00800a33 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	53                   	push   %ebx
+  800a37:	83 ec 10             	sub    $0x10,%esp
+  800a3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a3d:	53                   	push   %ebx
+  800a3e:	e8 80 ff ff ff       	call   8009c3 <strlen>
+  800a43:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a46:	ff 75 0c             	push   0xc(%ebp)
+  800a49:	01 d8                	add    %ebx,%eax
+  800a4b:	50                   	push   %eax
+  800a4c:	e8 be ff ff ff       	call   800a0f <strcpy>
+	return dst;
+}
+  800a51:	89 d8                	mov    %ebx,%eax
+  800a53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+00800a58 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	56                   	push   %esi
+  800a5c:	53                   	push   %ebx
+  800a5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a66:	85 db                	test   %ebx,%ebx
+  800a68:	74 17                	je     800a81 <strncpy+0x29>
+  800a6a:	01 f3                	add    %esi,%ebx
+  800a6c:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  800a71:	0f b6 0a             	movzbl (%edx),%ecx
+  800a74:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a77:	80 f9 01             	cmp    $0x1,%cl
+  800a7a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a7d:	39 c3                	cmp    %eax,%ebx
+  800a7f:	75 ed                	jne    800a6e <strncpy+0x16>
+	}
+	return ret;
+}
+  800a81:	89 f0                	mov    %esi,%eax
+  800a83:	5b                   	pop    %ebx
+  800a84:	5e                   	pop    %esi
+  800a85:	5d                   	pop    %ebp
+  800a86:	c3                   	ret
+
+00800a87 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a87:	55                   	push   %ebp
+  800a88:	89 e5                	mov    %esp,%ebp
+  800a8a:	56                   	push   %esi
+  800a8b:	53                   	push   %ebx
+  800a8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a95:	89 f0                	mov    %esi,%eax
+  800a97:	85 db                	test   %ebx,%ebx
+  800a99:	74 1e                	je     800ab9 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a9b:	83 eb 01             	sub    $0x1,%ebx
+  800a9e:	74 16                	je     800ab6 <strlcpy+0x2f>
+  800aa0:	01 f3                	add    %esi,%ebx
+  800aa2:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa5:	84 c9                	test   %cl,%cl
+  800aa7:	74 0d                	je     800ab6 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800aa9:	83 c2 01             	add    $0x1,%edx
+  800aac:	83 c0 01             	add    $0x1,%eax
+  800aaf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ab2:	39 d8                	cmp    %ebx,%eax
+  800ab4:	75 ec                	jne    800aa2 <strlcpy+0x1b>
+		*dst = '\0';
+  800ab6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ab9:	29 f0                	sub    %esi,%eax
+}
+  800abb:	5b                   	pop    %ebx
+  800abc:	5e                   	pop    %esi
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+
+00800abf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ac8:	0f b6 01             	movzbl (%ecx),%eax
+  800acb:	84 c0                	test   %al,%al
+  800acd:	74 11                	je     800ae0 <strcmp+0x21>
+  800acf:	38 02                	cmp    %al,(%edx)
+  800ad1:	75 0d                	jne    800ae0 <strcmp+0x21>
+		p++, q++;
+  800ad3:	83 c1 01             	add    $0x1,%ecx
+  800ad6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ad9:	0f b6 01             	movzbl (%ecx),%eax
+  800adc:	84 c0                	test   %al,%al
+  800ade:	75 ef                	jne    800acf <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae0:	0f b6 c0             	movzbl %al,%eax
+  800ae3:	0f b6 12             	movzbl (%edx),%edx
+  800ae6:	29 d0                	sub    %edx,%eax
+}
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	53                   	push   %ebx
+  800aee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800af4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800afc:	85 d2                	test   %edx,%edx
+  800afe:	74 2e                	je     800b2e <strncmp+0x44>
+  800b00:	0f b6 01             	movzbl (%ecx),%eax
+  800b03:	84 c0                	test   %al,%al
+  800b05:	74 16                	je     800b1d <strncmp+0x33>
+  800b07:	3a 03                	cmp    (%ebx),%al
+  800b09:	75 12                	jne    800b1d <strncmp+0x33>
+		n--, p++, q++;
+  800b0b:	83 c1 01             	add    $0x1,%ecx
+  800b0e:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b11:	83 ea 01             	sub    $0x1,%edx
+  800b14:	75 ea                	jne    800b00 <strncmp+0x16>
+		return 0;
+  800b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1b:	eb 11                	jmp    800b2e <strncmp+0x44>
+  800b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b22:	85 d2                	test   %edx,%edx
+  800b24:	74 08                	je     800b2e <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b26:	0f b6 01             	movzbl (%ecx),%eax
+  800b29:	0f b6 13             	movzbl (%ebx),%edx
+  800b2c:	29 d0                	sub    %edx,%eax
+}
+  800b2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b31:	c9                   	leave
+  800b32:	c3                   	ret
+
+00800b33 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b39:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b3d:	0f b6 10             	movzbl (%eax),%edx
+  800b40:	84 d2                	test   %dl,%dl
+  800b42:	74 15                	je     800b59 <strchr+0x26>
+		if (*s == c)
+  800b44:	38 d1                	cmp    %dl,%cl
+  800b46:	74 0f                	je     800b57 <strchr+0x24>
+	for (; *s; s++)
+  800b48:	83 c0 01             	add    $0x1,%eax
+  800b4b:	0f b6 10             	movzbl (%eax),%edx
+  800b4e:	84 d2                	test   %dl,%dl
+  800b50:	75 f2                	jne    800b44 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800b52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+	return 0;
+  800b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5e:	eb f7                	jmp    800b57 <strchr+0x24>
+
+00800b60 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	53                   	push   %ebx
+  800b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b67:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b6a:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b6d:	38 d3                	cmp    %dl,%bl
+  800b6f:	74 14                	je     800b85 <strfind+0x25>
+  800b71:	89 d1                	mov    %edx,%ecx
+  800b73:	84 db                	test   %bl,%bl
+  800b75:	74 0e                	je     800b85 <strfind+0x25>
+	for (; *s; s++)
+  800b77:	83 c0 01             	add    $0x1,%eax
+  800b7a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b7d:	38 ca                	cmp    %cl,%dl
+  800b7f:	74 04                	je     800b85 <strfind+0x25>
+  800b81:	84 d2                	test   %dl,%dl
+  800b83:	75 f2                	jne    800b77 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b88:	c9                   	leave
+  800b89:	c3                   	ret
+
+00800b8a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b8a:	55                   	push   %ebp
+  800b8b:	89 e5                	mov    %esp,%ebp
+  800b8d:	57                   	push   %edi
+  800b8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b94:	85 c9                	test   %ecx,%ecx
+  800b96:	74 20                	je     800bb8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b98:	89 f8                	mov    %edi,%eax
+  800b9a:	09 c8                	or     %ecx,%eax
+  800b9c:	a8 03                	test   $0x3,%al
+  800b9e:	75 12                	jne    800bb2 <memset+0x28>
+		c &= 0xFF;
+  800ba0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ba4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800baa:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bad:	fc                   	cld
+  800bae:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bb0:	eb 06                	jmp    800bb8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb5:	fc                   	cld
+  800bb6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bb8:	89 f8                	mov    %edi,%eax
+  800bba:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bbd:	c9                   	leave
+  800bbe:	c3                   	ret
+
+00800bbf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	57                   	push   %edi
+  800bc3:	56                   	push   %esi
+  800bc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bcd:	39 c6                	cmp    %eax,%esi
+  800bcf:	73 32                	jae    800c03 <memmove+0x44>
+  800bd1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bd4:	39 d0                	cmp    %edx,%eax
+  800bd6:	73 2b                	jae    800c03 <memmove+0x44>
+		s += n;
+		d += n;
+  800bd8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bdb:	89 d6                	mov    %edx,%esi
+  800bdd:	09 fe                	or     %edi,%esi
+  800bdf:	09 ce                	or     %ecx,%esi
+  800be1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800be7:	75 0e                	jne    800bf7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800be9:	83 ef 04             	sub    $0x4,%edi
+  800bec:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bef:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bf2:	fd                   	std
+  800bf3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bf5:	eb 09                	jmp    800c00 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bf7:	83 ef 01             	sub    $0x1,%edi
+  800bfa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bfd:	fd                   	std
+  800bfe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c00:	fc                   	cld
+  800c01:	eb 1a                	jmp    800c1d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c03:	89 f2                	mov    %esi,%edx
+  800c05:	09 c2                	or     %eax,%edx
+  800c07:	09 ca                	or     %ecx,%edx
+  800c09:	f6 c2 03             	test   $0x3,%dl
+  800c0c:	75 0a                	jne    800c18 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c0e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c11:	89 c7                	mov    %eax,%edi
+  800c13:	fc                   	cld
+  800c14:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c16:	eb 05                	jmp    800c1d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c18:	89 c7                	mov    %eax,%edi
+  800c1a:	fc                   	cld
+  800c1b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5f                   	pop    %edi
+  800c1f:	5d                   	pop    %ebp
+  800c20:	c3                   	ret
+
+00800c21 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c21:	55                   	push   %ebp
+  800c22:	89 e5                	mov    %esp,%ebp
+  800c24:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c27:	ff 75 10             	push   0x10(%ebp)
+  800c2a:	ff 75 0c             	push   0xc(%ebp)
+  800c2d:	ff 75 08             	push   0x8(%ebp)
+  800c30:	e8 8a ff ff ff       	call   800bbf <memmove>
+}
+  800c35:	c9                   	leave
+  800c36:	c3                   	ret
+
+00800c37 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c37:	55                   	push   %ebp
+  800c38:	89 e5                	mov    %esp,%ebp
+  800c3a:	56                   	push   %esi
+  800c3b:	53                   	push   %ebx
+  800c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c42:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c45:	85 f6                	test   %esi,%esi
+  800c47:	74 29                	je     800c72 <memcmp+0x3b>
+  800c49:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800c4b:	0f b6 08             	movzbl (%eax),%ecx
+  800c4e:	0f b6 1a             	movzbl (%edx),%ebx
+  800c51:	38 d9                	cmp    %bl,%cl
+  800c53:	75 11                	jne    800c66 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c55:	83 c0 01             	add    $0x1,%eax
+  800c58:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c5b:	39 c6                	cmp    %eax,%esi
+  800c5d:	75 ec                	jne    800c4b <memcmp+0x14>
+	}
+
+	return 0;
+  800c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c64:	eb 08                	jmp    800c6e <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c66:	0f b6 c1             	movzbl %cl,%eax
+  800c69:	0f b6 db             	movzbl %bl,%ebx
+  800c6c:	29 d8                	sub    %ebx,%eax
+}
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+	return 0;
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	eb f5                	jmp    800c6e <memcmp+0x37>
+
+00800c79 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c87:	39 d0                	cmp    %edx,%eax
+  800c89:	73 0d                	jae    800c98 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c8b:	38 08                	cmp    %cl,(%eax)
+  800c8d:	74 0d                	je     800c9c <memfind+0x23>
+	for (; s < ends; s++)
+  800c8f:	83 c0 01             	add    $0x1,%eax
+  800c92:	39 c2                	cmp    %eax,%edx
+  800c94:	75 f5                	jne    800c8b <memfind+0x12>
+  800c96:	eb 06                	jmp    800c9e <memfind+0x25>
+  800c98:	89 c2                	mov    %eax,%edx
+  800c9a:	eb 02                	jmp    800c9e <memfind+0x25>
+  800c9c:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c9e:	89 d0                	mov    %edx,%eax
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+
+00800ca2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ca2:	55                   	push   %ebp
+  800ca3:	89 e5                	mov    %esp,%ebp
+  800ca5:	57                   	push   %edi
+  800ca6:	56                   	push   %esi
+  800ca7:	53                   	push   %ebx
+  800ca8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cae:	0f b6 02             	movzbl (%edx),%eax
+  800cb1:	3c 20                	cmp    $0x20,%al
+  800cb3:	74 04                	je     800cb9 <strtol+0x17>
+  800cb5:	3c 09                	cmp    $0x9,%al
+  800cb7:	75 0e                	jne    800cc7 <strtol+0x25>
+		s++;
+  800cb9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cbc:	0f b6 02             	movzbl (%edx),%eax
+  800cbf:	3c 20                	cmp    $0x20,%al
+  800cc1:	74 f6                	je     800cb9 <strtol+0x17>
+  800cc3:	3c 09                	cmp    $0x9,%al
+  800cc5:	74 f2                	je     800cb9 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cc7:	3c 2b                	cmp    $0x2b,%al
+  800cc9:	74 2a                	je     800cf5 <strtol+0x53>
+	int neg = 0;
+  800ccb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cd0:	3c 2d                	cmp    $0x2d,%al
+  800cd2:	74 2b                	je     800cff <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cd4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cda:	75 0f                	jne    800ceb <strtol+0x49>
+  800cdc:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cdf:	74 28                	je     800d09 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ce1:	85 db                	test   %ebx,%ebx
+  800ce3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce8:	0f 44 d8             	cmove  %eax,%ebx
+  800ceb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cf3:	eb 46                	jmp    800d3b <strtol+0x99>
+		s++;
+  800cf5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cfd:	eb d5                	jmp    800cd4 <strtol+0x32>
+		s++, neg = 1;
+  800cff:	83 c2 01             	add    $0x1,%edx
+  800d02:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d07:	eb cb                	jmp    800cd4 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d09:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d0d:	74 0e                	je     800d1d <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d0f:	85 db                	test   %ebx,%ebx
+  800d11:	75 d8                	jne    800ceb <strtol+0x49>
+		s++, base = 8;
+  800d13:	83 c2 01             	add    $0x1,%edx
+  800d16:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d1b:	eb ce                	jmp    800ceb <strtol+0x49>
+		s += 2, base = 16;
+  800d1d:	83 c2 02             	add    $0x2,%edx
+  800d20:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d25:	eb c4                	jmp    800ceb <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d27:	0f be c0             	movsbl %al,%eax
+  800d2a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d2d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d30:	7d 3a                	jge    800d6c <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d32:	83 c2 01             	add    $0x1,%edx
+  800d35:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d39:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d3b:	0f b6 02             	movzbl (%edx),%eax
+  800d3e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d41:	89 f3                	mov    %esi,%ebx
+  800d43:	80 fb 09             	cmp    $0x9,%bl
+  800d46:	76 df                	jbe    800d27 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800d48:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d4b:	89 f3                	mov    %esi,%ebx
+  800d4d:	80 fb 19             	cmp    $0x19,%bl
+  800d50:	77 08                	ja     800d5a <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800d52:	0f be c0             	movsbl %al,%eax
+  800d55:	83 e8 57             	sub    $0x57,%eax
+  800d58:	eb d3                	jmp    800d2d <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d5a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d5d:	89 f3                	mov    %esi,%ebx
+  800d5f:	80 fb 19             	cmp    $0x19,%bl
+  800d62:	77 08                	ja     800d6c <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d64:	0f be c0             	movsbl %al,%eax
+  800d67:	83 e8 37             	sub    $0x37,%eax
+  800d6a:	eb c1                	jmp    800d2d <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d6c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d70:	74 05                	je     800d77 <strtol+0xd5>
+		*endptr = (char *) s;
+  800d72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d75:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d77:	89 c8                	mov    %ecx,%eax
+  800d79:	f7 d8                	neg    %eax
+  800d7b:	85 ff                	test   %edi,%edi
+  800d7d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d80:	89 c8                	mov    %ecx,%eax
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d98:	89 c3                	mov    %eax,%ebx
+  800d9a:	89 c7                	mov    %eax,%edi
+  800d9c:	89 c6                	mov    %eax,%esi
+  800d9e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+
+00800da5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	57                   	push   %edi
+  800da9:	56                   	push   %esi
+  800daa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db5:	89 d1                	mov    %edx,%ecx
+  800db7:	89 d3                	mov    %edx,%ebx
+  800db9:	89 d7                	mov    %edx,%edi
+  800dbb:	89 d6                	mov    %edx,%esi
+  800dbd:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  800dca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dda:	89 cb                	mov    %ecx,%ebx
+  800ddc:	89 cf                	mov    %ecx,%edi
+  800dde:	89 ce                	mov    %ecx,%esi
+  800de0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	7f 08                	jg     800dee <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  800df1:	50                   	push   %eax
+  800df2:	6a 03                	push   $0x3
+  800df4:	68 6b 49 80 00       	push   $0x80496b
+  800df9:	6a 23                	push   $0x23
+  800dfb:	68 88 49 80 00       	push   $0x804988
+  800e00:	e8 38 f4 ff ff       	call   80023d <_panic>
+
+00800e05 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e10:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e15:	89 d1                	mov    %edx,%ecx
+  800e17:	89 d3                	mov    %edx,%ebx
+  800e19:	89 d7                	mov    %edx,%edi
+  800e1b:	89 d6                	mov    %edx,%esi
+  800e1d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e1f:	5b                   	pop    %ebx
+  800e20:	5e                   	pop    %esi
+  800e21:	5f                   	pop    %edi
+  800e22:	5d                   	pop    %ebp
+  800e23:	c3                   	ret
+
+00800e24 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	57                   	push   %edi
+  800e28:	56                   	push   %esi
+  800e29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e34:	89 d1                	mov    %edx,%ecx
+  800e36:	89 d3                	mov    %edx,%ebx
+  800e38:	89 d7                	mov    %edx,%edi
+  800e3a:	89 d6                	mov    %edx,%esi
+  800e3c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5f                   	pop    %edi
+  800e41:	5d                   	pop    %ebp
+  800e42:	c3                   	ret
+
+00800e43 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	57                   	push   %edi
+  800e47:	56                   	push   %esi
+  800e48:	53                   	push   %ebx
+  800e49:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e57:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5f:	89 f7                	mov    %esi,%edi
+  800e61:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e63:	85 c0                	test   %eax,%eax
+  800e65:	7f 08                	jg     800e6f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6a:	5b                   	pop    %ebx
+  800e6b:	5e                   	pop    %esi
+  800e6c:	5f                   	pop    %edi
+  800e6d:	5d                   	pop    %ebp
+  800e6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6f:	83 ec 0c             	sub    $0xc,%esp
+  800e72:	50                   	push   %eax
+  800e73:	6a 04                	push   $0x4
+  800e75:	68 6b 49 80 00       	push   $0x80496b
+  800e7a:	6a 23                	push   $0x23
+  800e7c:	68 88 49 80 00       	push   $0x804988
+  800e81:	e8 b7 f3 ff ff       	call   80023d <_panic>
+
+00800e86 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	57                   	push   %edi
+  800e8a:	56                   	push   %esi
+  800e8b:	53                   	push   %ebx
+  800e8c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ea3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	7f 08                	jg     800eb1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ea9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eac:	5b                   	pop    %ebx
+  800ead:	5e                   	pop    %esi
+  800eae:	5f                   	pop    %edi
+  800eaf:	5d                   	pop    %ebp
+  800eb0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb1:	83 ec 0c             	sub    $0xc,%esp
+  800eb4:	50                   	push   %eax
+  800eb5:	6a 05                	push   $0x5
+  800eb7:	68 6b 49 80 00       	push   $0x80496b
+  800ebc:	6a 23                	push   $0x23
+  800ebe:	68 88 49 80 00       	push   $0x804988
+  800ec3:	e8 75 f3 ff ff       	call   80023d <_panic>
+
+00800ec8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edc:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ee1:	89 df                	mov    %ebx,%edi
+  800ee3:	89 de                	mov    %ebx,%esi
+  800ee5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee7:	85 c0                	test   %eax,%eax
+  800ee9:	7f 08                	jg     800ef3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef3:	83 ec 0c             	sub    $0xc,%esp
+  800ef6:	50                   	push   %eax
+  800ef7:	6a 06                	push   $0x6
+  800ef9:	68 6b 49 80 00       	push   $0x80496b
+  800efe:	6a 23                	push   $0x23
+  800f00:	68 88 49 80 00       	push   $0x804988
+  800f05:	e8 33 f3 ff ff       	call   80023d <_panic>
+
+00800f0a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	57                   	push   %edi
+  800f0e:	56                   	push   %esi
+  800f0f:	53                   	push   %ebx
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f23:	89 df                	mov    %ebx,%edi
+  800f25:	89 de                	mov    %ebx,%esi
+  800f27:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	7f 08                	jg     800f35 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f35:	83 ec 0c             	sub    $0xc,%esp
+  800f38:	50                   	push   %eax
+  800f39:	6a 08                	push   $0x8
+  800f3b:	68 6b 49 80 00       	push   $0x80496b
+  800f40:	6a 23                	push   $0x23
+  800f42:	68 88 49 80 00       	push   $0x804988
+  800f47:	e8 f1 f2 ff ff       	call   80023d <_panic>
+
+00800f4c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f60:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f65:	89 df                	mov    %ebx,%edi
+  800f67:	89 de                	mov    %ebx,%esi
+  800f69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6b:	85 c0                	test   %eax,%eax
+  800f6d:	7f 08                	jg     800f77 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f72:	5b                   	pop    %ebx
+  800f73:	5e                   	pop    %esi
+  800f74:	5f                   	pop    %edi
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+  800f7a:	50                   	push   %eax
+  800f7b:	6a 09                	push   $0x9
+  800f7d:	68 6b 49 80 00       	push   $0x80496b
+  800f82:	6a 23                	push   $0x23
+  800f84:	68 88 49 80 00       	push   $0x804988
+  800f89:	e8 af f2 ff ff       	call   80023d <_panic>
+
+00800f8e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f8e:	55                   	push   %ebp
+  800f8f:	89 e5                	mov    %esp,%ebp
+  800f91:	57                   	push   %edi
+  800f92:	56                   	push   %esi
+  800f93:	53                   	push   %ebx
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa7:	89 df                	mov    %ebx,%edi
+  800fa9:	89 de                	mov    %ebx,%esi
+  800fab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 08                	jg     800fb9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	50                   	push   %eax
+  800fbd:	6a 0a                	push   $0xa
+  800fbf:	68 6b 49 80 00       	push   $0x80496b
+  800fc4:	6a 23                	push   $0x23
+  800fc6:	68 88 49 80 00       	push   $0x804988
+  800fcb:	e8 6d f2 ff ff       	call   80023d <_panic>
+
+00800fd0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fec:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+
+00800ff3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801009:	89 cb                	mov    %ecx,%ebx
+  80100b:	89 cf                	mov    %ecx,%edi
+  80100d:	89 ce                	mov    %ecx,%esi
+  80100f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801011:	85 c0                	test   %eax,%eax
+  801013:	7f 08                	jg     80101d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101d:	83 ec 0c             	sub    $0xc,%esp
+  801020:	50                   	push   %eax
+  801021:	6a 0d                	push   $0xd
+  801023:	68 6b 49 80 00       	push   $0x80496b
+  801028:	6a 23                	push   $0x23
+  80102a:	68 88 49 80 00       	push   $0x804988
+  80102f:	e8 09 f2 ff ff       	call   80023d <_panic>
+
+00801034 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801040:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801048:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80104e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80105e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80106e:	89 df                	mov    %ebx,%edi
+  801070:	89 de                	mov    %ebx,%esi
+  801072:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801074:	85 c0                	test   %eax,%eax
+  801076:	7f 08                	jg     801080 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107b:	5b                   	pop    %ebx
+  80107c:	5e                   	pop    %esi
+  80107d:	5f                   	pop    %edi
+  80107e:	5d                   	pop    %ebp
+  80107f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801080:	83 ec 0c             	sub    $0xc,%esp
+  801083:	50                   	push   %eax
+  801084:	6a 0d                	push   $0xd
+  801086:	68 6b 49 80 00       	push   $0x80496b
+  80108b:	6a 23                	push   $0x23
+  80108d:	68 88 49 80 00       	push   $0x804988
+  801092:	e8 a6 f1 ff ff       	call   80023d <_panic>
+
+00801097 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010a7:	89 d1                	mov    %edx,%ecx
+  8010a9:	89 d3                	mov    %edx,%ebx
+  8010ab:	89 d7                	mov    %edx,%edi
+  8010ad:	89 d6                	mov    %edx,%esi
+  8010af:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010b1:	5b                   	pop    %ebx
+  8010b2:	5e                   	pop    %esi
+  8010b3:	5f                   	pop    %edi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+
+008010b6 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	56                   	push   %esi
+  8010bb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010cc:	89 df                	mov    %ebx,%edi
+  8010ce:	89 de                	mov    %ebx,%esi
+  8010d0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+
+008010d7 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010ea:	89 cb                	mov    %ecx,%ebx
+  8010ec:	89 cf                	mov    %ecx,%edi
+  8010ee:	89 ce                	mov    %ecx,%esi
+  8010f0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8010f2:	5b                   	pop    %ebx
+  8010f3:	5e                   	pop    %esi
+  8010f4:	5f                   	pop    %edi
+  8010f5:	5d                   	pop    %ebp
+  8010f6:	c3                   	ret
+
+008010f7 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801102:	8b 55 08             	mov    0x8(%ebp),%edx
+  801105:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801108:	b8 11 00 00 00       	mov    $0x11,%eax
+  80110d:	89 df                	mov    %ebx,%edi
+  80110f:	89 de                	mov    %ebx,%esi
+  801111:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801113:	5b                   	pop    %ebx
+  801114:	5e                   	pop    %esi
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+
+00801118 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801123:	8b 55 08             	mov    0x8(%ebp),%edx
+  801126:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801129:	b8 12 00 00 00       	mov    $0x12,%eax
+  80112e:	89 df                	mov    %ebx,%edi
+  801130:	89 de                	mov    %ebx,%esi
+  801132:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+
+00801139 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80113f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801144:	8b 55 08             	mov    0x8(%ebp),%edx
+  801147:	b8 13 00 00 00       	mov    $0x13,%eax
+  80114c:	89 cb                	mov    %ecx,%ebx
+  80114e:	89 cf                	mov    %ecx,%edi
+  801150:	89 ce                	mov    %ecx,%esi
+  801152:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5f                   	pop    %edi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+
+00801159 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801164:	8b 55 08             	mov    0x8(%ebp),%edx
+  801167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80116f:	89 df                	mov    %ebx,%edi
+  801171:	89 de                	mov    %ebx,%esi
+  801173:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801180:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	b8 15 00 00 00       	mov    $0x15,%eax
+  80118d:	89 cb                	mov    %ecx,%ebx
+  80118f:	89 cf                	mov    %ecx,%edi
+  801191:	89 ce                	mov    %ecx,%esi
+  801193:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b3:	89 f7                	mov    %esi,%edi
+  8011b5:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011d2:	89 df                	mov    %ebx,%edi
+  8011d4:	89 de                	mov    %ebx,%esi
+  8011d6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+
+008011dd <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	57                   	push   %edi
+  8011e1:	56                   	push   %esi
+  8011e2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011eb:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011f0:	89 cb                	mov    %ecx,%ebx
+  8011f2:	89 cf                	mov    %ecx,%edi
+  8011f4:	89 ce                	mov    %ecx,%esi
+  8011f6:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5f                   	pop    %edi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+
+008011fd <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	57                   	push   %edi
+  801201:	56                   	push   %esi
+  801202:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801203:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801214:	89 df                	mov    %ebx,%edi
+  801216:	89 de                	mov    %ebx,%esi
+  801218:	cd 30                	int    $0x30
+}
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+
+0080121f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80121f:	55                   	push   %ebp
+  801220:	89 e5                	mov    %esp,%ebp
+  801222:	57                   	push   %edi
+  801223:	56                   	push   %esi
+  801224:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801225:	be 00 00 00 00       	mov    $0x0,%esi
+  80122a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801230:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801235:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801238:	89 f7                	mov    %esi,%edi
+  80123a:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+
+00801241 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801247:	be 00 00 00 00       	mov    $0x0,%esi
+  80124c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801252:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801257:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125a:	89 f7                	mov    %esi,%edi
+  80125c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+
+00801263 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801269:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801274:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801279:	89 df                	mov    %ebx,%edi
+  80127b:	89 de                	mov    %ebx,%esi
+  80127d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128a:	be 00 00 00 00       	mov    $0x0,%esi
+  80128f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801292:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801295:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80129a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129d:	89 f7                	mov    %esi,%edi
+  80129f:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8012a1:	5b                   	pop    %ebx
+  8012a2:	5e                   	pop    %esi
+  8012a3:	5f                   	pop    %edi
+  8012a4:	5d                   	pop    %ebp
+  8012a5:	c3                   	ret
+
+008012a6 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	74 20                	je     8012ca <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8012aa:	89 c1                	mov    %eax,%ecx
+  8012ac:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012b2:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8012b8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8012be:	8b 52 48             	mov    0x48(%edx),%edx
+  8012c1:	39 c2                	cmp    %eax,%edx
+  8012c3:	74 06                	je     8012cb <thread_alive+0x25>
+  8012c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012ca:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012cb:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8012d1:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8012d7:	85 c0                	test   %eax,%eax
+  8012d9:	0f 95 c0             	setne  %al
+  8012dc:	0f b6 c0             	movzbl %al,%eax
+  8012df:	c3                   	ret
+
+008012e0 <pgfault>:
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	57                   	push   %edi
+  8012e4:	56                   	push   %esi
+  8012e5:	53                   	push   %ebx
+  8012e6:	83 ec 0c             	sub    $0xc,%esp
+  8012e9:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8012ec:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8012ee:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8012f1:	89 f3                	mov    %esi,%ebx
+  8012f3:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8012f6:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8012fd:	74 52                	je     801351 <pgfault+0x71>
+  8012ff:	a8 02                	test   $0x2,%al
+  801301:	75 14                	jne    801317 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801303:	83 ec 04             	sub    $0x4,%esp
+  801306:	68 96 49 80 00       	push   $0x804996
+  80130b:	6a 2e                	push   $0x2e
+  80130d:	68 b4 49 80 00       	push   $0x8049b4
+  801312:	e8 26 ef ff ff       	call   80023d <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801317:	89 d8                	mov    %ebx,%eax
+  801319:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80131e:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	57                   	push   %edi
+  801329:	e8 9d 2c 00 00       	call   803fcb <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80132e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801335:	83 e0 03             	and    $0x3,%eax
+  801338:	83 c4 10             	add    $0x10,%esp
+  80133b:	83 f8 03             	cmp    $0x3,%eax
+  80133e:	75 1a                	jne    80135a <pgfault+0x7a>
+			mutex_unlock(m);
+  801340:	83 ec 0c             	sub    $0xc,%esp
+  801343:	57                   	push   %edi
+  801344:	e8 f0 2c 00 00       	call   804039 <mutex_unlock>
+			return;
+  801349:	83 c4 10             	add    $0x10,%esp
+  80134c:	e9 9f 00 00 00       	jmp    8013f0 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801351:	a8 02                	test   $0x2,%al
+  801353:	74 ae                	je     801303 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801355:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80135a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801361:	f6 c4 08             	test   $0x8,%ah
+  801364:	74 9d                	je     801303 <pgfault+0x23>
+  801366:	89 e0                	mov    %esp,%eax
+  801368:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80136d:	29 c2                	sub    %eax,%edx
+  80136f:	89 d0                	mov    %edx,%eax
+  801371:	c1 e8 0f             	shr    $0xf,%eax
+  801374:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80137a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137f:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801382:	c1 e0 0c             	shl    $0xc,%eax
+  801385:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80138a:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80138c:	83 ec 04             	sub    $0x4,%esp
+  80138f:	6a 07                	push   $0x7
+  801391:	53                   	push   %ebx
+  801392:	6a 00                	push   $0x0
+  801394:	e8 aa fa ff ff       	call   800e43 <sys_page_alloc>
+  801399:	83 c4 10             	add    $0x10,%esp
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	78 58                	js     8013f8 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8013a0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8013a6:	83 ec 04             	sub    $0x4,%esp
+  8013a9:	68 00 10 00 00       	push   $0x1000
+  8013ae:	56                   	push   %esi
+  8013af:	53                   	push   %ebx
+  8013b0:	e8 0a f8 ff ff       	call   800bbf <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8013b5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8013bc:	56                   	push   %esi
+  8013bd:	6a 00                	push   $0x0
+  8013bf:	53                   	push   %ebx
+  8013c0:	6a 00                	push   $0x0
+  8013c2:	e8 bf fa ff ff       	call   800e86 <sys_page_map>
+  8013c7:	83 c4 20             	add    $0x20,%esp
+  8013ca:	85 c0                	test   %eax,%eax
+  8013cc:	78 3c                	js     80140a <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8013ce:	83 ec 08             	sub    $0x8,%esp
+  8013d1:	53                   	push   %ebx
+  8013d2:	6a 00                	push   $0x0
+  8013d4:	e8 ef fa ff ff       	call   800ec8 <sys_page_unmap>
+  8013d9:	83 c4 10             	add    $0x10,%esp
+  8013dc:	85 c0                	test   %eax,%eax
+  8013de:	78 3c                	js     80141c <pgfault+0x13c>
+	if(m)
+  8013e0:	85 ff                	test   %edi,%edi
+  8013e2:	74 0c                	je     8013f0 <pgfault+0x110>
+		mutex_unlock(m);
+  8013e4:	83 ec 0c             	sub    $0xc,%esp
+  8013e7:	57                   	push   %edi
+  8013e8:	e8 4c 2c 00 00       	call   804039 <mutex_unlock>
+  8013ed:	83 c4 10             	add    $0x10,%esp
+}
+  8013f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f3:	5b                   	pop    %ebx
+  8013f4:	5e                   	pop    %esi
+  8013f5:	5f                   	pop    %edi
+  8013f6:	5d                   	pop    %ebp
+  8013f7:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8013f8:	50                   	push   %eax
+  8013f9:	68 bf 49 80 00       	push   $0x8049bf
+  8013fe:	6a 3d                	push   $0x3d
+  801400:	68 b4 49 80 00       	push   $0x8049b4
+  801405:	e8 33 ee ff ff       	call   80023d <_panic>
+		panic("sys_page_map: %e", ret);
+  80140a:	50                   	push   %eax
+  80140b:	68 d2 49 80 00       	push   $0x8049d2
+  801410:	6a 40                	push   $0x40
+  801412:	68 b4 49 80 00       	push   $0x8049b4
+  801417:	e8 21 ee ff ff       	call   80023d <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80141c:	50                   	push   %eax
+  80141d:	68 e3 49 80 00       	push   $0x8049e3
+  801422:	6a 42                	push   $0x42
+  801424:	68 b4 49 80 00       	push   $0x8049b4
+  801429:	e8 0f ee ff ff       	call   80023d <_panic>
+
+0080142e <thread_main>:
+{
+  80142e:	55                   	push   %ebp
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801434:	ff 75 0c             	push   0xc(%ebp)
+  801437:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80143a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801441:	e8 7e f9 ff ff       	call   800dc4 <sys_env_destroy>
+}
+  801446:	83 c4 10             	add    $0x10,%esp
+  801449:	c9                   	leave
+  80144a:	c3                   	ret
+
+0080144b <fork>:
+{
+  80144b:	55                   	push   %ebp
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	57                   	push   %edi
+  80144f:	56                   	push   %esi
+  801450:	53                   	push   %ebx
+  801451:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801454:	68 e0 12 80 00       	push   $0x8012e0
+  801459:	e8 b9 2e 00 00       	call   804317 <set_pgfault_handler>
+	if(sforked)
+  80145e:	83 c4 10             	add    $0x10,%esp
+  801461:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801468:	75 33                	jne    80149d <fork+0x52>
+	__asm __volatile("int %2"
+  80146a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80146f:	cd 30                	int    $0x30
+  801471:	89 c7                	mov    %eax,%edi
+  801473:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801475:	85 c0                	test   %eax,%eax
+  801477:	0f 88 b4 00 00 00    	js     801531 <fork+0xe6>
+	if(envid == 0) {
+  80147d:	0f 84 c3 00 00 00    	je     801546 <fork+0xfb>
+	pgbatch_init(&pb);
+  801483:	83 ec 0c             	sub    $0xc,%esp
+  801486:	68 20 63 80 00       	push   $0x806320
+  80148b:	e8 87 29 00 00       	call   803e17 <pgbatch_init>
+  801490:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801493:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801498:	e9 9c 01 00 00       	jmp    801639 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80149d:	83 ec 0c             	sub    $0xc,%esp
+  8014a0:	68 c0 66 80 00       	push   $0x8066c0
+  8014a5:	e8 21 2b 00 00       	call   803fcb <mutex_lock>
+  8014aa:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8014ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8014b2:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8014b7:	eb 08                	jmp    8014c1 <fork+0x76>
+  8014b9:	83 c3 01             	add    $0x1,%ebx
+  8014bc:	83 fb 20             	cmp    $0x20,%ebx
+  8014bf:	74 5b                	je     80151c <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8014c1:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  8014c8:	89 f0                	mov    %esi,%eax
+  8014ca:	e8 d7 fd ff ff       	call   8012a6 <thread_alive>
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	74 e6                	je     8014b9 <fork+0x6e>
+  8014d3:	89 e0                	mov    %esp,%eax
+  8014d5:	89 fa                	mov    %edi,%edx
+  8014d7:	29 c2                	sub    %eax,%edx
+  8014d9:	89 d0                	mov    %edx,%eax
+  8014db:	c1 e8 0f             	shr    $0xf,%eax
+  8014de:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8014e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e9:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8014ec:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8014f3:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8014f6:	83 ec 08             	sub    $0x8,%esp
+  8014f9:	50                   	push   %eax
+  8014fa:	56                   	push   %esi
+  8014fb:	e8 8e fa ff ff       	call   800f8e <sys_env_set_pgfault_upcall>
+  801500:	83 c4 10             	add    $0x10,%esp
+  801503:	85 c0                	test   %eax,%eax
+  801505:	79 b2                	jns    8014b9 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801507:	50                   	push   %eax
+  801508:	68 70 4a 80 00       	push   $0x804a70
+  80150d:	68 00 01 00 00       	push   $0x100
+  801512:	68 b4 49 80 00       	push   $0x8049b4
+  801517:	e8 21 ed ff ff       	call   80023d <_panic>
+	mutex_unlock(&sfork_lock);
+  80151c:	83 ec 0c             	sub    $0xc,%esp
+  80151f:	68 c0 66 80 00       	push   $0x8066c0
+  801524:	e8 10 2b 00 00       	call   804039 <mutex_unlock>
+}
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	e9 39 ff ff ff       	jmp    80146a <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801531:	50                   	push   %eax
+  801532:	68 f6 49 80 00       	push   $0x8049f6
+  801537:	68 91 00 00 00       	push   $0x91
+  80153c:	68 b4 49 80 00       	push   $0x8049b4
+  801541:	e8 f7 ec ff ff       	call   80023d <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801546:	e8 ba f8 ff ff       	call   800e05 <sys_getenvid>
+  80154b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801550:	89 e1                	mov    %esp,%ecx
+  801552:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801557:	29 ca                	sub    %ecx,%edx
+  801559:	89 d1                	mov    %edx,%ecx
+  80155b:	c1 e9 0f             	shr    $0xf,%ecx
+  80155e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801564:	ba 00 00 00 00       	mov    $0x0,%edx
+  801569:	0f 42 d1             	cmovb  %ecx,%edx
+  80156c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801572:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801577:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  80157e:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  801583:	85 c0                	test   %eax,%eax
+  801585:	75 07                	jne    80158e <fork+0x143>
+		return 0;
+  801587:	89 c6                	mov    %eax,%esi
+  801589:	e9 6f 02 00 00       	jmp    8017fd <fork+0x3b2>
+  80158e:	89 e2                	mov    %esp,%edx
+  801590:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801595:	29 d0                	sub    %edx,%eax
+  801597:	89 c3                	mov    %eax,%ebx
+  801599:	c1 eb 0f             	shr    $0xf,%ebx
+  80159c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a6:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8015a9:	83 ec 04             	sub    $0x4,%esp
+  8015ac:	68 80 00 00 00       	push   $0x80
+  8015b1:	6a 00                	push   $0x0
+  8015b3:	68 40 66 80 00       	push   $0x806640
+  8015b8:	e8 cd f5 ff ff       	call   800b8a <memset>
+	thread_ids[slot] = sys_getenvid();
+  8015bd:	e8 43 f8 ff ff       	call   800e05 <sys_getenvid>
+  8015c2:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8015c9:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  8015d0:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  8015d5:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  8015dc:	e8 dc 29 00 00       	call   803fbd <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8015e1:	83 c4 0c             	add    $0xc,%esp
+  8015e4:	68 07 04 00 00       	push   $0x407
+  8015e9:	68 00 00 00 e1       	push   $0xe1000000
+  8015ee:	6a 00                	push   $0x0
+  8015f0:	e8 4e f8 ff ff       	call   800e43 <sys_page_alloc>
+  8015f5:	83 c4 10             	add    $0x10,%esp
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	0f 89 fd 01 00 00    	jns    8017fd <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801600:	50                   	push   %eax
+  801601:	68 bf 49 80 00       	push   $0x8049bf
+  801606:	68 12 01 00 00       	push   $0x112
+  80160b:	68 b4 49 80 00       	push   $0x8049b4
+  801610:	e8 28 ec ff ff       	call   80023d <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801615:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80161b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801621:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801627:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80162d:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801633:	0f 87 4f 01 00 00    	ja     801788 <fork+0x33d>
+		pd = PDX(addr);
+  801639:	89 d8                	mov    %ebx,%eax
+  80163b:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80163e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801645:	f6 c2 01             	test   $0x1,%dl
+  801648:	74 cb                	je     801615 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80164a:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80164f:	0f 85 92 00 00 00    	jne    8016e7 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801655:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80165b:	76 10                	jbe    80166d <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80165d:	89 d8                	mov    %ebx,%eax
+  80165f:	f7 d8                	neg    %eax
+  801661:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801666:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80166b:	74 ba                	je     801627 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80166d:	89 d8                	mov    %ebx,%eax
+  80166f:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801672:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801679:	f6 c2 01             	test   $0x1,%dl
+  80167c:	74 a9                	je     801627 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  80167e:	89 c1                	mov    %eax,%ecx
+  801680:	c1 e1 0c             	shl    $0xc,%ecx
+  801683:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801686:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80168d:	f6 c6 04             	test   $0x4,%dh
+  801690:	0f 85 8e 00 00 00    	jne    801724 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801696:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80169d:	f6 c6 08             	test   $0x8,%dh
+  8016a0:	75 0f                	jne    8016b1 <fork+0x266>
+  8016a2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016a9:	a8 02                	test   $0x2,%al
+  8016ab:	0f 84 bb 00 00 00    	je     80176c <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8016b1:	83 ec 08             	sub    $0x8,%esp
+  8016b4:	68 05 08 00 00       	push   $0x805
+  8016b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016bc:	50                   	push   %eax
+  8016bd:	56                   	push   %esi
+  8016be:	50                   	push   %eax
+  8016bf:	6a 00                	push   $0x0
+  8016c1:	68 20 63 80 00       	push   $0x806320
+  8016c6:	e8 0a 28 00 00       	call   803ed5 <pgbatch_map>
+  8016cb:	83 c4 20             	add    $0x20,%esp
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	79 76                	jns    801748 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8016d2:	50                   	push   %eax
+  8016d3:	68 1a 4a 80 00       	push   $0x804a1a
+  8016d8:	68 bc 00 00 00       	push   $0xbc
+  8016dd:	68 b4 49 80 00       	push   $0x8049b4
+  8016e2:	e8 56 eb ff ff       	call   80023d <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8016e7:	83 ec 0c             	sub    $0xc,%esp
+  8016ea:	68 00 08 00 00       	push   $0x800
+  8016ef:	56                   	push   %esi
+  8016f0:	53                   	push   %ebx
+  8016f1:	6a 00                	push   $0x0
+  8016f3:	68 20 63 80 00       	push   $0x806320
+  8016f8:	e8 83 28 00 00       	call   803f80 <pgbatch_sharept>
+  8016fd:	83 c4 20             	add    $0x20,%esp
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 0b                	js     80170f <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801704:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  80170a:	e9 18 ff ff ff       	jmp    801627 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  80170f:	50                   	push   %eax
+  801710:	68 06 4a 80 00       	push   $0x804a06
+  801715:	68 b2 00 00 00       	push   $0xb2
+  80171a:	68 b4 49 80 00       	push   $0x8049b4
+  80171f:	e8 19 eb ff ff       	call   80023d <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801724:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80172b:	83 ec 08             	sub    $0x8,%esp
+  80172e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801733:	50                   	push   %eax
+  801734:	51                   	push   %ecx
+  801735:	56                   	push   %esi
+  801736:	51                   	push   %ecx
+  801737:	6a 00                	push   $0x0
+  801739:	68 20 63 80 00       	push   $0x806320
+  80173e:	e8 92 27 00 00       	call   803ed5 <pgbatch_map>
+  801743:	83 c4 20             	add    $0x20,%esp
+  801746:	eb 17                	jmp    80175f <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801748:	68 05 08 00 00       	push   $0x805
+  80174d:	ff 75 e4             	push   -0x1c(%ebp)
+  801750:	6a 00                	push   $0x0
+  801752:	68 20 63 80 00       	push   $0x806320
+  801757:	e8 ed 27 00 00       	call   803f49 <pgbatch_protect>
+  80175c:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	0f 89 c0 fe ff ff    	jns    801627 <fork+0x1dc>
+  801767:	e9 66 ff ff ff       	jmp    8016d2 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  80176c:	83 ec 08             	sub    $0x8,%esp
+  80176f:	6a 05                	push   $0x5
+  801771:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801774:	50                   	push   %eax
+  801775:	56                   	push   %esi
+  801776:	50                   	push   %eax
+  801777:	6a 00                	push   $0x0
+  801779:	68 20 63 80 00       	push   $0x806320
+  80177e:	e8 52 27 00 00       	call   803ed5 <pgbatch_map>
+  801783:	83 c4 20             	add    $0x20,%esp
+  801786:	eb d7                	jmp    80175f <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801788:	6a 07                	push   $0x7
+  80178a:	68 00 f0 bf ee       	push   $0xeebff000
+  80178f:	57                   	push   %edi
+  801790:	68 20 63 80 00       	push   $0x806320
+  801795:	e8 04 27 00 00       	call   803e9e <pgbatch_alloc>
+  80179a:	83 c4 10             	add    $0x10,%esp
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 66                	js     801807 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8017a1:	83 ec 0c             	sub    $0xc,%esp
+  8017a4:	68 20 63 80 00       	push   $0x806320
+  8017a9:	e8 77 26 00 00       	call   803e25 <pgbatch_flush>
+  8017ae:	83 c4 10             	add    $0x10,%esp
+  8017b1:	85 c0                	test   %eax,%eax
+  8017b3:	78 52                	js     801807 <fork+0x3bc>
+  8017b5:	89 e2                	mov    %esp,%edx
+  8017b7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017bc:	29 d0                	sub    %edx,%eax
+  8017be:	89 c2                	mov    %eax,%edx
+  8017c0:	c1 ea 0f             	shr    $0xf,%edx
+  8017c3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cd:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8017d0:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8017d7:	8b 40 78             	mov    0x78(%eax),%eax
+  8017da:	83 ec 08             	sub    $0x8,%esp
+  8017dd:	50                   	push   %eax
+  8017de:	57                   	push   %edi
+  8017df:	e8 aa f7 ff ff       	call   800f8e <sys_env_set_pgfault_upcall>
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	78 31                	js     80181c <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  8017eb:	83 ec 08             	sub    $0x8,%esp
+  8017ee:	6a 02                	push   $0x2
+  8017f0:	57                   	push   %edi
+  8017f1:	e8 14 f7 ff ff       	call   800f0a <sys_env_set_status>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	78 34                	js     801831 <fork+0x3e6>
+}
+  8017fd:	89 f0                	mov    %esi,%eax
+  8017ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801802:	5b                   	pop    %ebx
+  801803:	5e                   	pop    %esi
+  801804:	5f                   	pop    %edi
+  801805:	5d                   	pop    %ebp
+  801806:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801807:	50                   	push   %eax
+  801808:	68 26 4a 80 00       	push   $0x804a26
+  80180d:	68 c0 00 00 00       	push   $0xc0
+  801812:	68 b4 49 80 00       	push   $0x8049b4
+  801817:	e8 21 ea ff ff       	call   80023d <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  80181c:	50                   	push   %eax
+  80181d:	68 3b 4a 80 00       	push   $0x804a3b
+  801822:	68 c2 00 00 00       	push   $0xc2
+  801827:	68 b4 49 80 00       	push   $0x8049b4
+  80182c:	e8 0c ea ff ff       	call   80023d <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801831:	50                   	push   %eax
+  801832:	68 56 4a 80 00       	push   $0x804a56
+  801837:	68 c4 00 00 00       	push   $0xc4
+  80183c:	68 b4 49 80 00       	push   $0x8049b4
+  801841:	e8 f7 e9 ff ff       	call   80023d <_panic>
+
+00801846 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801846:	55                   	push   %ebp
+  801847:	89 e5                	mov    %esp,%ebp
+  801849:	57                   	push   %edi
+  80184a:	56                   	push   %esi
+  80184b:	53                   	push   %ebx
+  80184c:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80184f:	68 c0 66 80 00       	push   $0x8066c0
+  801854:	e8 72 27 00 00       	call   803fcb <mutex_lock>
+  801859:	89 e2                	mov    %esp,%edx
+  80185b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801860:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  801862:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801865:	89 c3                	mov    %eax,%ebx
+  801867:	c1 eb 0f             	shr    $0xf,%ebx
+  80186a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80186f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801874:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801877:	e8 89 f5 ff ff       	call   800e05 <sys_getenvid>
+  80187c:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801883:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801888:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  80188f:	e8 12 fa ff ff       	call   8012a6 <thread_alive>
+  801894:	85 c0                	test   %eax,%eax
+  801896:	74 24                	je     8018bc <sfork+0x76>
+  801898:	83 c3 01             	add    $0x1,%ebx
+  80189b:	83 fb 20             	cmp    $0x20,%ebx
+  80189e:	75 e8                	jne    801888 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  8018a0:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  8018a5:	83 ec 0c             	sub    $0xc,%esp
+  8018a8:	68 c0 66 80 00       	push   $0x8066c0
+  8018ad:	e8 87 27 00 00       	call   804039 <mutex_unlock>
+	return r;
+}
+  8018b2:	89 f0                	mov    %esi,%eax
+  8018b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b7:	5b                   	pop    %ebx
+  8018b8:	5e                   	pop    %esi
+  8018b9:	5f                   	pop    %edi
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+	if (i == NTHREADS) {
+  8018bc:	83 fb 20             	cmp    $0x20,%ebx
+  8018bf:	0f 84 53 01 00 00    	je     801a18 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  8018c5:	89 d8                	mov    %ebx,%eax
+  8018c7:	c1 e0 0f             	shl    $0xf,%eax
+  8018ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  8018cd:	83 ec 0c             	sub    $0xc,%esp
+  8018d0:	68 00 60 80 00       	push   $0x806000
+  8018d5:	e8 3d 25 00 00       	call   803e17 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8018e4:	75 1f                	jne    801905 <sfork+0xbf>
+  8018e6:	68 07 04 00 00       	push   $0x407
+  8018eb:	68 00 00 00 e1       	push   $0xe1000000
+  8018f0:	6a 00                	push   $0x0
+  8018f2:	68 00 60 80 00       	push   $0x806000
+  8018f7:	e8 a2 25 00 00       	call   803e9e <pgbatch_alloc>
+  8018fc:	89 c6                	mov    %eax,%esi
+  8018fe:	83 c4 10             	add    $0x10,%esp
+  801901:	85 c0                	test   %eax,%eax
+  801903:	78 a0                	js     8018a5 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801905:	6a 07                	push   $0x7
+  801907:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  80190c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80190f:	29 c8                	sub    %ecx,%eax
+  801911:	50                   	push   %eax
+  801912:	6a 00                	push   $0x0
+  801914:	68 00 60 80 00       	push   $0x806000
+  801919:	e8 80 25 00 00       	call   803e9e <pgbatch_alloc>
+  80191e:	89 c6                	mov    %eax,%esi
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	0f 88 7a ff ff ff    	js     8018a5 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  80192b:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801930:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801933:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801935:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80193a:	29 c8                	sub    %ecx,%eax
+  80193c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80193f:	39 c7                	cmp    %eax,%edi
+  801941:	73 29                	jae    80196c <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801943:	6a 07                	push   $0x7
+  801945:	57                   	push   %edi
+  801946:	6a 00                	push   $0x0
+  801948:	68 00 60 80 00       	push   $0x806000
+  80194d:	e8 4c 25 00 00       	call   803e9e <pgbatch_alloc>
+  801952:	89 c6                	mov    %eax,%esi
+  801954:	83 c4 10             	add    $0x10,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	0f 88 46 ff ff ff    	js     8018a5 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  80195f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801965:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801968:	39 c7                	cmp    %eax,%edi
+  80196a:	72 d7                	jb     801943 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  80196c:	83 ec 0c             	sub    $0xc,%esp
+  80196f:	68 00 60 80 00       	push   $0x806000
+  801974:	e8 ac 24 00 00       	call   803e25 <pgbatch_flush>
+  801979:	89 c6                	mov    %eax,%esi
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	0f 88 1f ff ff ff    	js     8018a5 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801986:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  80198b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80198e:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801990:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801996:	8b 55 08             	mov    0x8(%ebp),%edx
+  801999:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  80199c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80199f:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  8019a5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019aa:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019ac:	52                   	push   %edx
+  8019ad:	50                   	push   %eax
+  8019ae:	68 2e 14 80 00       	push   $0x80142e
+  8019b3:	e8 cc f8 ff ff       	call   801284 <sys_exofork_shared>
+  8019b8:	89 c6                	mov    %eax,%esi
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	0f 88 e0 fe ff ff    	js     8018a5 <sfork+0x5f>
+	thread_ids[i] = id;
+  8019c5:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  8019cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019d1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8019d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019dc:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  8019e3:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  8019ea:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8019ed:	83 ec 08             	sub    $0x8,%esp
+  8019f0:	6a 02                	push   $0x2
+  8019f2:	56                   	push   %esi
+  8019f3:	e8 12 f5 ff ff       	call   800f0a <sys_env_set_status>
+  8019f8:	89 c3                	mov    %eax,%ebx
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	0f 89 a0 fe ff ff    	jns    8018a5 <sfork+0x5f>
+		sys_env_destroy(id);
+  801a05:	83 ec 0c             	sub    $0xc,%esp
+  801a08:	56                   	push   %esi
+  801a09:	e8 b6 f3 ff ff       	call   800dc4 <sys_env_destroy>
+		goto out;
+  801a0e:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a11:	89 de                	mov    %ebx,%esi
+		goto out;
+  801a13:	e9 8d fe ff ff       	jmp    8018a5 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801a18:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801a1d:	e9 83 fe ff ff       	jmp    8018a5 <sfork+0x5f>
+
+00801a22 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801a22:	55                   	push   %ebp
+  801a23:	89 e5                	mov    %esp,%ebp
+  801a25:	56                   	push   %esi
+  801a26:	53                   	push   %ebx
+  801a27:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801a37:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801a3a:	83 ec 0c             	sub    $0xc,%esp
+  801a3d:	50                   	push   %eax
+  801a3e:	e8 b0 f5 ff ff       	call   800ff3 <sys_ipc_recv>
+  801a43:	83 c4 10             	add    $0x10,%esp
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	0f 88 8b 00 00 00    	js     801ad9 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801a4e:	85 f6                	test   %esi,%esi
+  801a50:	74 2a                	je     801a7c <ipc_recv+0x5a>
+  801a52:	89 e2                	mov    %esp,%edx
+  801a54:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a59:	29 d0                	sub    %edx,%eax
+  801a5b:	89 c2                	mov    %eax,%edx
+  801a5d:	c1 ea 0f             	shr    $0xf,%edx
+  801a60:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801a6d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a74:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801a7a:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  801a7c:	85 db                	test   %ebx,%ebx
+  801a7e:	74 2a                	je     801aaa <ipc_recv+0x88>
+  801a80:	89 e2                	mov    %esp,%edx
+  801a82:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a87:	29 d0                	sub    %edx,%eax
+  801a89:	89 c2                	mov    %eax,%edx
+  801a8b:	c1 ea 0f             	shr    $0xf,%edx
+  801a8e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a98:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801a9b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801aa2:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801aa8:	89 03                	mov    %eax,(%ebx)
+  801aaa:	89 e2                	mov    %esp,%edx
+  801aac:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ab1:	29 d0                	sub    %edx,%eax
+  801ab3:	89 c2                	mov    %eax,%edx
+  801ab5:	c1 ea 0f             	shr    $0xf,%edx
+  801ab8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801ac5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801acc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801ad2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad5:	5b                   	pop    %ebx
+  801ad6:	5e                   	pop    %esi
+  801ad7:	5d                   	pop    %ebp
+  801ad8:	c3                   	ret
+		if(from_env_store != NULL)
+  801ad9:	85 f6                	test   %esi,%esi
+  801adb:	74 06                	je     801ae3 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801add:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801ae3:	85 db                	test   %ebx,%ebx
+  801ae5:	74 eb                	je     801ad2 <ipc_recv+0xb0>
+			*perm_store = 0;
+  801ae7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801aed:	eb e3                	jmp    801ad2 <ipc_recv+0xb0>
+
+00801aef <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801aef:	55                   	push   %ebp
+  801af0:	89 e5                	mov    %esp,%ebp
+  801af2:	57                   	push   %edi
+  801af3:	56                   	push   %esi
+  801af4:	53                   	push   %ebx
+  801af5:	83 ec 14             	sub    $0x14,%esp
+  801af8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801afb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801afe:	8b 75 14             	mov    0x14(%ebp),%esi
+  801b01:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801b0b:	0f 44 c2             	cmove  %edx,%eax
+  801b0e:	ff 75 10             	push   0x10(%ebp)
+  801b11:	50                   	push   %eax
+  801b12:	e8 3e f5 ff ff       	call   801055 <sys_ipc_recv_pages>
+  801b17:	83 c4 10             	add    $0x10,%esp
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	0f 88 ba 00 00 00    	js     801bdc <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801b22:	85 ff                	test   %edi,%edi
+  801b24:	74 2a                	je     801b50 <ipc_recv_pages+0x61>
+  801b26:	89 e2                	mov    %esp,%edx
+  801b28:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b2d:	29 d0                	sub    %edx,%eax
+  801b2f:	89 c2                	mov    %eax,%edx
+  801b31:	c1 ea 0f             	shr    $0xf,%edx
+  801b34:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801b41:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b48:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801b4e:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801b50:	85 f6                	test   %esi,%esi
+  801b52:	74 2a                	je     801b7e <ipc_recv_pages+0x8f>
+  801b54:	89 e2                	mov    %esp,%edx
+  801b56:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b5b:	29 d0                	sub    %edx,%eax
+  801b5d:	89 c2                	mov    %eax,%edx
+  801b5f:	c1 ea 0f             	shr    $0xf,%edx
+  801b62:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6c:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801b6f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b76:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801b7c:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801b7e:	85 db                	test   %ebx,%ebx
+  801b80:	74 2a                	je     801bac <ipc_recv_pages+0xbd>
+  801b82:	89 e2                	mov    %esp,%edx
+  801b84:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b89:	29 d0                	sub    %edx,%eax
+  801b8b:	89 c2                	mov    %eax,%edx
+  801b8d:	c1 ea 0f             	shr    $0xf,%edx
+  801b90:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9a:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801b9d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ba4:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801baa:	89 03                	mov    %eax,(%ebx)
+  801bac:	89 e2                	mov    %esp,%edx
+  801bae:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bb3:	29 d0                	sub    %edx,%eax
+  801bb5:	89 c2                	mov    %eax,%edx
+  801bb7:	c1 ea 0f             	shr    $0xf,%edx
+  801bba:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801bc7:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801bce:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd7:	5b                   	pop    %ebx
+  801bd8:	5e                   	pop    %esi
+  801bd9:	5f                   	pop    %edi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+		if (from_env_store)
+  801bdc:	85 ff                	test   %edi,%edi
+  801bde:	74 06                	je     801be6 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801be0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801be6:	85 f6                	test   %esi,%esi
+  801be8:	74 06                	je     801bf0 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801bea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801bf0:	85 db                	test   %ebx,%ebx
+  801bf2:	74 e0                	je     801bd4 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801bf4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801bfa:	eb d8                	jmp    801bd4 <ipc_recv_pages+0xe5>
+
+00801bfc <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	57                   	push   %edi
+  801c00:	56                   	push   %esi
+  801c01:	53                   	push   %ebx
+  801c02:	83 ec 1c             	sub    $0x1c,%esp
+  801c05:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801c08:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c0b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801c11:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801c15:	75 2b                	jne    801c42 <ipc_try_send_pages+0x46>
+  801c17:	89 e2                	mov    %esp,%edx
+  801c19:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c1e:	29 d0                	sub    %edx,%eax
+  801c20:	89 c2                	mov    %eax,%edx
+  801c22:	c1 ea 0f             	shr    $0xf,%edx
+  801c25:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2f:	0f 42 c2             	cmovb  %edx,%eax
+  801c32:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801c39:	8b 70 48             	mov    0x48(%eax),%esi
+  801c3c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801c42:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801c48:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801c4d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c50:	85 ff                	test   %edi,%edi
+  801c52:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801c57:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  801c5a:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801c60:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801c66:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  801c6c:	83 ec 0c             	sub    $0xc,%esp
+  801c6f:	ff 75 14             	push   0x14(%ebp)
+  801c72:	ff 75 18             	push   0x18(%ebp)
+  801c75:	57                   	push   %edi
+  801c76:	ff 75 0c             	push   0xc(%ebp)
+  801c79:	ff 75 08             	push   0x8(%ebp)
+  801c7c:	e8 b3 f3 ff ff       	call   801034 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801c81:	83 c4 20             	add    $0x20,%esp
+  801c84:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c87:	75 21                	jne    801caa <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801c89:	83 ec 04             	sub    $0x4,%esp
+  801c8c:	6a ff                	push   $0xffffffff
+  801c8e:	53                   	push   %ebx
+  801c8f:	ff 75 e4             	push   -0x1c(%ebp)
+  801c92:	e8 aa f5 ff ff       	call   801241 <sys_futex_wait>
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801c9d:	74 c7                	je     801c66 <ipc_try_send_pages+0x6a>
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	79 c3                	jns    801c66 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801ca3:	e8 7c f1 ff ff       	call   800e24 <sys_yield>
+  801ca8:	eb bc                	jmp    801c66 <ipc_try_send_pages+0x6a>
+	}
+}
+  801caa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cad:	5b                   	pop    %ebx
+  801cae:	5e                   	pop    %esi
+  801caf:	5f                   	pop    %edi
+  801cb0:	5d                   	pop    %ebp
+  801cb1:	c3                   	ret
+
+00801cb2 <ipc_send>:
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801cb8:	ff 75 14             	push   0x14(%ebp)
+  801cbb:	6a 01                	push   $0x1
+  801cbd:	ff 75 10             	push   0x10(%ebp)
+  801cc0:	ff 75 0c             	push   0xc(%ebp)
+  801cc3:	ff 75 08             	push   0x8(%ebp)
+  801cc6:	e8 31 ff ff ff       	call   801bfc <ipc_try_send_pages>
+  801ccb:	83 c4 20             	add    $0x20,%esp
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	78 02                	js     801cd4 <ipc_send+0x22>
+}
+  801cd2:	c9                   	leave
+  801cd3:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801cd4:	50                   	push   %eax
+  801cd5:	68 8f 4a 80 00       	push   $0x804a8f
+  801cda:	6a 3f                	push   $0x3f
+  801cdc:	68 a4 4a 80 00       	push   $0x804aa4
+  801ce1:	e8 57 e5 ff ff       	call   80023d <_panic>
+
+00801ce6 <ipc_send_pages>:
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801cec:	ff 75 18             	push   0x18(%ebp)
+  801cef:	ff 75 14             	push   0x14(%ebp)
+  801cf2:	ff 75 10             	push   0x10(%ebp)
+  801cf5:	ff 75 0c             	push   0xc(%ebp)
+  801cf8:	ff 75 08             	push   0x8(%ebp)
+  801cfb:	e8 fc fe ff ff       	call   801bfc <ipc_try_send_pages>
+  801d00:	83 c4 20             	add    $0x20,%esp
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	78 02                	js     801d09 <ipc_send_pages+0x23>
+}
+  801d07:	c9                   	leave
+  801d08:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801d09:	50                   	push   %eax
+  801d0a:	68 ae 4a 80 00       	push   $0x804aae
+  801d0f:	6a 64                	push   $0x64
+  801d11:	68 a4 4a 80 00       	push   $0x804aa4
+  801d16:	e8 22 e5 ff ff       	call   80023d <_panic>
+
+00801d1b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801d21:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801d26:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801d2c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d32:	8b 52 50             	mov    0x50(%edx),%edx
+  801d35:	39 ca                	cmp    %ecx,%edx
+  801d37:	74 11                	je     801d4a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801d39:	83 c0 01             	add    $0x1,%eax
+  801d3c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801d41:	75 e3                	jne    801d26 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d48:	eb 0e                	jmp    801d58 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801d4a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801d50:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d55:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801d58:	5d                   	pop    %ebp
+  801d59:	c3                   	ret
+
+00801d5a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d5a:	55                   	push   %ebp
+  801d5b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d60:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d65:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d68:	5d                   	pop    %ebp
+  801d69:	c3                   	ret
+
+00801d6a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d70:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801d75:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d7a:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801d7f:	5d                   	pop    %ebp
+  801d80:	c3                   	ret
+
+00801d81 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801d81:	55                   	push   %ebp
+  801d82:	89 e5                	mov    %esp,%ebp
+  801d84:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801d89:	89 c2                	mov    %eax,%edx
+  801d8b:	c1 ea 16             	shr    $0x16,%edx
+  801d8e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d95:	f6 c2 01             	test   $0x1,%dl
+  801d98:	74 29                	je     801dc3 <fd_alloc+0x42>
+  801d9a:	89 c2                	mov    %eax,%edx
+  801d9c:	c1 ea 0c             	shr    $0xc,%edx
+  801d9f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801da6:	f6 c2 01             	test   $0x1,%dl
+  801da9:	74 18                	je     801dc3 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801dab:	05 00 10 00 00       	add    $0x1000,%eax
+  801db0:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801db5:	75 d2                	jne    801d89 <fd_alloc+0x8>
+  801db7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801dbc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801dc1:	eb 05                	jmp    801dc8 <fd_alloc+0x47>
+			return 0;
+  801dc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dcb:	89 02                	mov    %eax,(%edx)
+}
+  801dcd:	89 c8                	mov    %ecx,%eax
+  801dcf:	5d                   	pop    %ebp
+  801dd0:	c3                   	ret
+
+00801dd1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801dd1:	55                   	push   %ebp
+  801dd2:	89 e5                	mov    %esp,%ebp
+  801dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801dd7:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801ddc:	77 30                	ja     801e0e <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801dde:	c1 e0 0c             	shl    $0xc,%eax
+  801de1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801de6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801dec:	f6 c2 01             	test   $0x1,%dl
+  801def:	74 24                	je     801e15 <fd_lookup+0x44>
+  801df1:	89 c2                	mov    %eax,%edx
+  801df3:	c1 ea 0c             	shr    $0xc,%edx
+  801df6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dfd:	f6 c2 01             	test   $0x1,%dl
+  801e00:	74 1a                	je     801e1c <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e05:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0c:	5d                   	pop    %ebp
+  801e0d:	c3                   	ret
+		return -E_INVAL;
+  801e0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e13:	eb f7                	jmp    801e0c <fd_lookup+0x3b>
+		return -E_INVAL;
+  801e15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e1a:	eb f0                	jmp    801e0c <fd_lookup+0x3b>
+  801e1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e21:	eb e9                	jmp    801e0c <fd_lookup+0x3b>
+
+00801e23 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	53                   	push   %ebx
+  801e27:	83 ec 04             	sub    $0x4,%esp
+  801e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e32:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801e37:	39 13                	cmp    %edx,(%ebx)
+  801e39:	74 54                	je     801e8f <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801e3b:	83 c0 01             	add    $0x1,%eax
+  801e3e:	8b 1c 85 48 4b 80 00 	mov    0x804b48(,%eax,4),%ebx
+  801e45:	85 db                	test   %ebx,%ebx
+  801e47:	75 ee                	jne    801e37 <dev_lookup+0x14>
+  801e49:	89 e1                	mov    %esp,%ecx
+  801e4b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e50:	29 c8                	sub    %ecx,%eax
+  801e52:	89 c1                	mov    %eax,%ecx
+  801e54:	c1 e9 0f             	shr    $0xf,%ecx
+  801e57:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e61:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e64:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801e6b:	8b 40 48             	mov    0x48(%eax),%eax
+  801e6e:	83 ec 04             	sub    $0x4,%esp
+  801e71:	52                   	push   %edx
+  801e72:	50                   	push   %eax
+  801e73:	68 cc 4a 80 00       	push   $0x804acc
+  801e78:	e8 9b e4 ff ff       	call   800318 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801e7d:	83 c4 10             	add    $0x10,%esp
+  801e80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e88:	89 1a                	mov    %ebx,(%edx)
+}
+  801e8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e8d:	c9                   	leave
+  801e8e:	c3                   	ret
+			return 0;
+  801e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e94:	eb ef                	jmp    801e85 <dev_lookup+0x62>
+
+00801e96 <fd_close>:
+{
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	57                   	push   %edi
+  801e9a:	56                   	push   %esi
+  801e9b:	53                   	push   %ebx
+  801e9c:	83 ec 24             	sub    $0x24,%esp
+  801e9f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ea2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ea5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ea8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ea9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801eaf:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801eb2:	50                   	push   %eax
+  801eb3:	e8 19 ff ff ff       	call   801dd1 <fd_lookup>
+  801eb8:	89 c3                	mov    %eax,%ebx
+  801eba:	83 c4 10             	add    $0x10,%esp
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 05                	js     801ec6 <fd_close+0x30>
+	    || fd != fd2)
+  801ec1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ec4:	74 0f                	je     801ed5 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801ec6:	85 ff                	test   %edi,%edi
+  801ec8:	0f 44 df             	cmove  %edi,%ebx
+}
+  801ecb:	89 d8                	mov    %ebx,%eax
+  801ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed0:	5b                   	pop    %ebx
+  801ed1:	5e                   	pop    %esi
+  801ed2:	5f                   	pop    %edi
+  801ed3:	5d                   	pop    %ebp
+  801ed4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ed5:	83 ec 08             	sub    $0x8,%esp
+  801ed8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801edb:	50                   	push   %eax
+  801edc:	ff 36                	push   (%esi)
+  801ede:	e8 40 ff ff ff       	call   801e23 <dev_lookup>
+  801ee3:	89 c3                	mov    %eax,%ebx
+  801ee5:	83 c4 10             	add    $0x10,%esp
+  801ee8:	85 c0                	test   %eax,%eax
+  801eea:	78 1a                	js     801f06 <fd_close+0x70>
+		if (dev->dev_close)
+  801eec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801eef:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ef2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	74 0b                	je     801f06 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801efb:	83 ec 0c             	sub    $0xc,%esp
+  801efe:	56                   	push   %esi
+  801eff:	ff d0                	call   *%eax
+  801f01:	89 c3                	mov    %eax,%ebx
+  801f03:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f06:	83 ec 08             	sub    $0x8,%esp
+  801f09:	56                   	push   %esi
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	e8 b7 ef ff ff       	call   800ec8 <sys_page_unmap>
+	return r;
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	eb b5                	jmp    801ecb <fd_close+0x35>
+
+00801f16 <close>:
+
+int
+close(int fdnum)
+{
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+  801f19:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1f:	50                   	push   %eax
+  801f20:	ff 75 08             	push   0x8(%ebp)
+  801f23:	e8 a9 fe ff ff       	call   801dd1 <fd_lookup>
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	79 02                	jns    801f31 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f2f:	c9                   	leave
+  801f30:	c3                   	ret
+		return fd_close(fd, 1);
+  801f31:	83 ec 08             	sub    $0x8,%esp
+  801f34:	6a 01                	push   $0x1
+  801f36:	ff 75 f4             	push   -0xc(%ebp)
+  801f39:	e8 58 ff ff ff       	call   801e96 <fd_close>
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	eb ec                	jmp    801f2f <close+0x19>
+
+00801f43 <close_all>:
+
+void
+close_all(void)
+{
+  801f43:	55                   	push   %ebp
+  801f44:	89 e5                	mov    %esp,%ebp
+  801f46:	53                   	push   %ebx
+  801f47:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f4f:	83 ec 0c             	sub    $0xc,%esp
+  801f52:	53                   	push   %ebx
+  801f53:	e8 be ff ff ff       	call   801f16 <close>
+	for (i = 0; i < MAXFD; i++)
+  801f58:	83 c3 01             	add    $0x1,%ebx
+  801f5b:	83 c4 10             	add    $0x10,%esp
+  801f5e:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801f64:	75 e9                	jne    801f4f <close_all+0xc>
+}
+  801f66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f69:	c9                   	leave
+  801f6a:	c3                   	ret
+
+00801f6b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f6b:	55                   	push   %ebp
+  801f6c:	89 e5                	mov    %esp,%ebp
+  801f6e:	57                   	push   %edi
+  801f6f:	56                   	push   %esi
+  801f70:	53                   	push   %ebx
+  801f71:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801f74:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f77:	50                   	push   %eax
+  801f78:	ff 75 08             	push   0x8(%ebp)
+  801f7b:	e8 51 fe ff ff       	call   801dd1 <fd_lookup>
+  801f80:	89 c3                	mov    %eax,%ebx
+  801f82:	83 c4 10             	add    $0x10,%esp
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	78 7f                	js     802008 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f89:	83 ec 0c             	sub    $0xc,%esp
+  801f8c:	ff 75 0c             	push   0xc(%ebp)
+  801f8f:	e8 82 ff ff ff       	call   801f16 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801f94:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f97:	c1 e6 0c             	shl    $0xc,%esi
+  801f9a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801fa0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801fa3:	89 3c 24             	mov    %edi,(%esp)
+  801fa6:	e8 bf fd ff ff       	call   801d6a <fd2data>
+  801fab:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801fad:	89 34 24             	mov    %esi,(%esp)
+  801fb0:	e8 b5 fd ff ff       	call   801d6a <fd2data>
+  801fb5:	83 c4 10             	add    $0x10,%esp
+  801fb8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801fbb:	89 d8                	mov    %ebx,%eax
+  801fbd:	c1 e8 16             	shr    $0x16,%eax
+  801fc0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fc7:	a8 01                	test   $0x1,%al
+  801fc9:	74 11                	je     801fdc <dup+0x71>
+  801fcb:	89 d8                	mov    %ebx,%eax
+  801fcd:	c1 e8 0c             	shr    $0xc,%eax
+  801fd0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801fd7:	f6 c2 01             	test   $0x1,%dl
+  801fda:	75 36                	jne    802012 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801fdc:	89 f8                	mov    %edi,%eax
+  801fde:	c1 e8 0c             	shr    $0xc,%eax
+  801fe1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fe8:	83 ec 0c             	sub    $0xc,%esp
+  801feb:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ff0:	50                   	push   %eax
+  801ff1:	56                   	push   %esi
+  801ff2:	6a 00                	push   $0x0
+  801ff4:	57                   	push   %edi
+  801ff5:	6a 00                	push   $0x0
+  801ff7:	e8 8a ee ff ff       	call   800e86 <sys_page_map>
+  801ffc:	89 c3                	mov    %eax,%ebx
+  801ffe:	83 c4 20             	add    $0x20,%esp
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 33                	js     802038 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802005:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802008:	89 d8                	mov    %ebx,%eax
+  80200a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80200d:	5b                   	pop    %ebx
+  80200e:	5e                   	pop    %esi
+  80200f:	5f                   	pop    %edi
+  802010:	5d                   	pop    %ebp
+  802011:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802012:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802019:	83 ec 0c             	sub    $0xc,%esp
+  80201c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802021:	50                   	push   %eax
+  802022:	ff 75 d4             	push   -0x2c(%ebp)
+  802025:	6a 00                	push   $0x0
+  802027:	53                   	push   %ebx
+  802028:	6a 00                	push   $0x0
+  80202a:	e8 57 ee ff ff       	call   800e86 <sys_page_map>
+  80202f:	89 c3                	mov    %eax,%ebx
+  802031:	83 c4 20             	add    $0x20,%esp
+  802034:	85 c0                	test   %eax,%eax
+  802036:	79 a4                	jns    801fdc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802038:	83 ec 08             	sub    $0x8,%esp
+  80203b:	56                   	push   %esi
+  80203c:	6a 00                	push   $0x0
+  80203e:	e8 85 ee ff ff       	call   800ec8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802043:	83 c4 08             	add    $0x8,%esp
+  802046:	ff 75 d4             	push   -0x2c(%ebp)
+  802049:	6a 00                	push   $0x0
+  80204b:	e8 78 ee ff ff       	call   800ec8 <sys_page_unmap>
+	return r;
+  802050:	83 c4 10             	add    $0x10,%esp
+  802053:	eb b3                	jmp    802008 <dup+0x9d>
+
+00802055 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	56                   	push   %esi
+  802059:	53                   	push   %ebx
+  80205a:	83 ec 18             	sub    $0x18,%esp
+  80205d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802060:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802063:	50                   	push   %eax
+  802064:	53                   	push   %ebx
+  802065:	e8 67 fd ff ff       	call   801dd1 <fd_lookup>
+  80206a:	83 c4 10             	add    $0x10,%esp
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	78 3c                	js     8020ad <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802071:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802074:	83 ec 08             	sub    $0x8,%esp
+  802077:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80207a:	50                   	push   %eax
+  80207b:	ff 36                	push   (%esi)
+  80207d:	e8 a1 fd ff ff       	call   801e23 <dev_lookup>
+  802082:	83 c4 10             	add    $0x10,%esp
+  802085:	85 c0                	test   %eax,%eax
+  802087:	78 24                	js     8020ad <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802089:	8b 46 08             	mov    0x8(%esi),%eax
+  80208c:	83 e0 03             	and    $0x3,%eax
+  80208f:	83 f8 01             	cmp    $0x1,%eax
+  802092:	74 20                	je     8020b4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802094:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802097:	8b 40 08             	mov    0x8(%eax),%eax
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	74 54                	je     8020f2 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80209e:	83 ec 04             	sub    $0x4,%esp
+  8020a1:	ff 75 10             	push   0x10(%ebp)
+  8020a4:	ff 75 0c             	push   0xc(%ebp)
+  8020a7:	56                   	push   %esi
+  8020a8:	ff d0                	call   *%eax
+  8020aa:	83 c4 10             	add    $0x10,%esp
+}
+  8020ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b0:	5b                   	pop    %ebx
+  8020b1:	5e                   	pop    %esi
+  8020b2:	5d                   	pop    %ebp
+  8020b3:	c3                   	ret
+  8020b4:	89 e2                	mov    %esp,%edx
+  8020b6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020bb:	29 d0                	sub    %edx,%eax
+  8020bd:	89 c2                	mov    %eax,%edx
+  8020bf:	c1 ea 0f             	shr    $0xf,%edx
+  8020c2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cc:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020cf:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8020d6:	8b 40 48             	mov    0x48(%eax),%eax
+  8020d9:	83 ec 04             	sub    $0x4,%esp
+  8020dc:	53                   	push   %ebx
+  8020dd:	50                   	push   %eax
+  8020de:	68 0d 4b 80 00       	push   $0x804b0d
+  8020e3:	e8 30 e2 ff ff       	call   800318 <cprintf>
+		return -E_INVAL;
+  8020e8:	83 c4 10             	add    $0x10,%esp
+  8020eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020f0:	eb bb                	jmp    8020ad <read+0x58>
+		return -E_NOT_SUPP;
+  8020f2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020f7:	eb b4                	jmp    8020ad <read+0x58>
+
+008020f9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	57                   	push   %edi
+  8020fd:	56                   	push   %esi
+  8020fe:	53                   	push   %ebx
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802105:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802108:	85 f6                	test   %esi,%esi
+  80210a:	74 30                	je     80213c <readn+0x43>
+  80210c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802111:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802116:	83 ec 04             	sub    $0x4,%esp
+  802119:	89 f2                	mov    %esi,%edx
+  80211b:	29 c2                	sub    %eax,%edx
+  80211d:	52                   	push   %edx
+  80211e:	01 f8                	add    %edi,%eax
+  802120:	50                   	push   %eax
+  802121:	ff 75 08             	push   0x8(%ebp)
+  802124:	e8 2c ff ff ff       	call   802055 <read>
+		if (m < 0)
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	78 15                	js     802145 <readn+0x4c>
+			return m;
+		if (m == 0)
+  802130:	74 11                	je     802143 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802132:	01 c3                	add    %eax,%ebx
+  802134:	89 d8                	mov    %ebx,%eax
+  802136:	39 f3                	cmp    %esi,%ebx
+  802138:	72 dc                	jb     802116 <readn+0x1d>
+  80213a:	eb 09                	jmp    802145 <readn+0x4c>
+  80213c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802141:	eb 02                	jmp    802145 <readn+0x4c>
+  802143:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  802145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802148:	5b                   	pop    %ebx
+  802149:	5e                   	pop    %esi
+  80214a:	5f                   	pop    %edi
+  80214b:	5d                   	pop    %ebp
+  80214c:	c3                   	ret
+
+0080214d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80214d:	55                   	push   %ebp
+  80214e:	89 e5                	mov    %esp,%ebp
+  802150:	56                   	push   %esi
+  802151:	53                   	push   %ebx
+  802152:	83 ec 18             	sub    $0x18,%esp
+  802155:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802158:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80215b:	50                   	push   %eax
+  80215c:	53                   	push   %ebx
+  80215d:	e8 6f fc ff ff       	call   801dd1 <fd_lookup>
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	85 c0                	test   %eax,%eax
+  802167:	78 37                	js     8021a0 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802169:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80216c:	83 ec 08             	sub    $0x8,%esp
+  80216f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802172:	50                   	push   %eax
+  802173:	ff 36                	push   (%esi)
+  802175:	e8 a9 fc ff ff       	call   801e23 <dev_lookup>
+  80217a:	83 c4 10             	add    $0x10,%esp
+  80217d:	85 c0                	test   %eax,%eax
+  80217f:	78 1f                	js     8021a0 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802181:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802185:	74 20                	je     8021a7 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802187:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80218d:	85 c0                	test   %eax,%eax
+  80218f:	74 54                	je     8021e5 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802191:	83 ec 04             	sub    $0x4,%esp
+  802194:	ff 75 10             	push   0x10(%ebp)
+  802197:	ff 75 0c             	push   0xc(%ebp)
+  80219a:	56                   	push   %esi
+  80219b:	ff d0                	call   *%eax
+  80219d:	83 c4 10             	add    $0x10,%esp
+}
+  8021a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a3:	5b                   	pop    %ebx
+  8021a4:	5e                   	pop    %esi
+  8021a5:	5d                   	pop    %ebp
+  8021a6:	c3                   	ret
+  8021a7:	89 e2                	mov    %esp,%edx
+  8021a9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8021ae:	29 d0                	sub    %edx,%eax
+  8021b0:	89 c2                	mov    %eax,%edx
+  8021b2:	c1 ea 0f             	shr    $0xf,%edx
+  8021b5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8021ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021bf:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021c2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8021c9:	8b 40 48             	mov    0x48(%eax),%eax
+  8021cc:	83 ec 04             	sub    $0x4,%esp
+  8021cf:	53                   	push   %ebx
+  8021d0:	50                   	push   %eax
+  8021d1:	68 29 4b 80 00       	push   $0x804b29
+  8021d6:	e8 3d e1 ff ff       	call   800318 <cprintf>
+		return -E_INVAL;
+  8021db:	83 c4 10             	add    $0x10,%esp
+  8021de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021e3:	eb bb                	jmp    8021a0 <write+0x53>
+		return -E_NOT_SUPP;
+  8021e5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021ea:	eb b4                	jmp    8021a0 <write+0x53>
+
+008021ec <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8021ec:	55                   	push   %ebp
+  8021ed:	89 e5                	mov    %esp,%ebp
+  8021ef:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	ff 75 08             	push   0x8(%ebp)
+  8021f9:	e8 d3 fb ff ff       	call   801dd1 <fd_lookup>
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 0e                	js     802213 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802205:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802208:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80220b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80220e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802213:	c9                   	leave
+  802214:	c3                   	ret
+
+00802215 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802215:	55                   	push   %ebp
+  802216:	89 e5                	mov    %esp,%ebp
+  802218:	53                   	push   %ebx
+  802219:	83 ec 1c             	sub    $0x1c,%esp
+  80221c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80221f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802222:	50                   	push   %eax
+  802223:	ff 75 08             	push   0x8(%ebp)
+  802226:	e8 a6 fb ff ff       	call   801dd1 <fd_lookup>
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	85 c0                	test   %eax,%eax
+  802230:	78 33                	js     802265 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802232:	83 fb 03             	cmp    $0x3,%ebx
+  802235:	74 28                	je     80225f <fcntl+0x4a>
+  802237:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80223c:	83 fb 04             	cmp    $0x4,%ebx
+  80223f:	75 24                	jne    802265 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802241:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802244:	8b 41 08             	mov    0x8(%ecx),%eax
+  802247:	80 e4 ef             	and    $0xef,%ah
+  80224a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80224d:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802253:	09 d0                	or     %edx,%eax
+  802255:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225d:	eb 06                	jmp    802265 <fcntl+0x50>
+		return fd->fd_omode;
+  80225f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802262:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802268:	c9                   	leave
+  802269:	c3                   	ret
+
+0080226a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80226a:	55                   	push   %ebp
+  80226b:	89 e5                	mov    %esp,%ebp
+  80226d:	56                   	push   %esi
+  80226e:	53                   	push   %ebx
+  80226f:	83 ec 18             	sub    $0x18,%esp
+  802272:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802275:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802278:	50                   	push   %eax
+  802279:	53                   	push   %ebx
+  80227a:	e8 52 fb ff ff       	call   801dd1 <fd_lookup>
+  80227f:	83 c4 10             	add    $0x10,%esp
+  802282:	85 c0                	test   %eax,%eax
+  802284:	78 34                	js     8022ba <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802286:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802289:	83 ec 08             	sub    $0x8,%esp
+  80228c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228f:	50                   	push   %eax
+  802290:	ff 36                	push   (%esi)
+  802292:	e8 8c fb ff ff       	call   801e23 <dev_lookup>
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 1c                	js     8022ba <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80229e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8022a2:	74 1d                	je     8022c1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8022a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a7:	8b 40 18             	mov    0x18(%eax),%eax
+  8022aa:	85 c0                	test   %eax,%eax
+  8022ac:	74 51                	je     8022ff <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8022ae:	83 ec 08             	sub    $0x8,%esp
+  8022b1:	ff 75 0c             	push   0xc(%ebp)
+  8022b4:	56                   	push   %esi
+  8022b5:	ff d0                	call   *%eax
+  8022b7:	83 c4 10             	add    $0x10,%esp
+}
+  8022ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bd:	5b                   	pop    %ebx
+  8022be:	5e                   	pop    %esi
+  8022bf:	5d                   	pop    %ebp
+  8022c0:	c3                   	ret
+  8022c1:	89 e2                	mov    %esp,%edx
+  8022c3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8022c8:	29 d0                	sub    %edx,%eax
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	c1 ea 0f             	shr    $0xf,%edx
+  8022cf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8022d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d9:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8022dc:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8022e3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022e6:	83 ec 04             	sub    $0x4,%esp
+  8022e9:	53                   	push   %ebx
+  8022ea:	50                   	push   %eax
+  8022eb:	68 ec 4a 80 00       	push   $0x804aec
+  8022f0:	e8 23 e0 ff ff       	call   800318 <cprintf>
+		return -E_INVAL;
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fd:	eb bb                	jmp    8022ba <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8022ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802304:	eb b4                	jmp    8022ba <ftruncate+0x50>
+
+00802306 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	56                   	push   %esi
+  80230a:	53                   	push   %ebx
+  80230b:	83 ec 18             	sub    $0x18,%esp
+  80230e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802311:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802314:	50                   	push   %eax
+  802315:	ff 75 08             	push   0x8(%ebp)
+  802318:	e8 b4 fa ff ff       	call   801dd1 <fd_lookup>
+  80231d:	83 c4 10             	add    $0x10,%esp
+  802320:	85 c0                	test   %eax,%eax
+  802322:	78 53                	js     802377 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802324:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802327:	83 ec 08             	sub    $0x8,%esp
+  80232a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80232d:	50                   	push   %eax
+  80232e:	ff 36                	push   (%esi)
+  802330:	e8 ee fa ff ff       	call   801e23 <dev_lookup>
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	78 3b                	js     802377 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80233c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80233f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802343:	74 39                	je     80237e <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802345:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802348:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80234f:	00 00 00 
+	stat->st_isdir = 0;
+  802352:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802359:	00 00 00 
+	stat->st_version = 0;
+  80235c:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802363:	00 00 00 
+	stat->st_dev = dev;
+  802366:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80236c:	83 ec 08             	sub    $0x8,%esp
+  80236f:	53                   	push   %ebx
+  802370:	56                   	push   %esi
+  802371:	ff 50 14             	call   *0x14(%eax)
+  802374:	83 c4 10             	add    $0x10,%esp
+}
+  802377:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80237a:	5b                   	pop    %ebx
+  80237b:	5e                   	pop    %esi
+  80237c:	5d                   	pop    %ebp
+  80237d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80237e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802383:	eb f2                	jmp    802377 <fstat+0x71>
+
+00802385 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	56                   	push   %esi
+  802389:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80238a:	83 ec 08             	sub    $0x8,%esp
+  80238d:	6a 00                	push   $0x0
+  80238f:	ff 75 08             	push   0x8(%ebp)
+  802392:	e8 b7 01 00 00       	call   80254e <open>
+  802397:	89 c3                	mov    %eax,%ebx
+  802399:	83 c4 10             	add    $0x10,%esp
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	78 1b                	js     8023bb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8023a0:	83 ec 08             	sub    $0x8,%esp
+  8023a3:	ff 75 0c             	push   0xc(%ebp)
+  8023a6:	50                   	push   %eax
+  8023a7:	e8 5a ff ff ff       	call   802306 <fstat>
+  8023ac:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8023ae:	89 1c 24             	mov    %ebx,(%esp)
+  8023b1:	e8 60 fb ff ff       	call   801f16 <close>
+	return r;
+  8023b6:	83 c4 10             	add    $0x10,%esp
+  8023b9:	89 f3                	mov    %esi,%ebx
+}
+  8023bb:	89 d8                	mov    %ebx,%eax
+  8023bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c0:	5b                   	pop    %ebx
+  8023c1:	5e                   	pop    %esi
+  8023c2:	5d                   	pop    %ebp
+  8023c3:	c3                   	ret
+
+008023c4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	56                   	push   %esi
+  8023c8:	53                   	push   %ebx
+  8023c9:	89 c6                	mov    %eax,%esi
+  8023cb:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8023cd:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8023d4:	74 27                	je     8023fd <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8023d6:	6a 07                	push   $0x7
+  8023d8:	68 00 70 80 00       	push   $0x807000
+  8023dd:	56                   	push   %esi
+  8023de:	ff 35 c4 66 80 00    	push   0x8066c4
+  8023e4:	e8 c9 f8 ff ff       	call   801cb2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8023e9:	83 c4 0c             	add    $0xc,%esp
+  8023ec:	6a 00                	push   $0x0
+  8023ee:	53                   	push   %ebx
+  8023ef:	6a 00                	push   $0x0
+  8023f1:	e8 2c f6 ff ff       	call   801a22 <ipc_recv>
+}
+  8023f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023f9:	5b                   	pop    %ebx
+  8023fa:	5e                   	pop    %esi
+  8023fb:	5d                   	pop    %ebp
+  8023fc:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023fd:	83 ec 0c             	sub    $0xc,%esp
+  802400:	6a 02                	push   $0x2
+  802402:	e8 14 f9 ff ff       	call   801d1b <ipc_find_env>
+  802407:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  80240c:	83 c4 10             	add    $0x10,%esp
+  80240f:	eb c5                	jmp    8023d6 <fsipc+0x12>
+
+00802411 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802411:	55                   	push   %ebp
+  802412:	89 e5                	mov    %esp,%ebp
+  802414:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802417:	8b 45 08             	mov    0x8(%ebp),%eax
+  80241a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80241d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802422:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802425:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80242a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802434:	e8 8b ff ff ff       	call   8023c4 <fsipc>
+}
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+0080243b <devfile_flush>:
+{
+  80243b:	55                   	push   %ebp
+  80243c:	89 e5                	mov    %esp,%ebp
+  80243e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802441:	8b 45 08             	mov    0x8(%ebp),%eax
+  802444:	8b 40 0c             	mov    0xc(%eax),%eax
+  802447:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80244c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802451:	b8 06 00 00 00       	mov    $0x6,%eax
+  802456:	e8 69 ff ff ff       	call   8023c4 <fsipc>
+}
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+
+0080245d <devfile_stat>:
+{
+  80245d:	55                   	push   %ebp
+  80245e:	89 e5                	mov    %esp,%ebp
+  802460:	53                   	push   %ebx
+  802461:	83 ec 04             	sub    $0x4,%esp
+  802464:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802467:	8b 45 08             	mov    0x8(%ebp),%eax
+  80246a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80246d:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802472:	ba 00 00 00 00       	mov    $0x0,%edx
+  802477:	b8 05 00 00 00       	mov    $0x5,%eax
+  80247c:	e8 43 ff ff ff       	call   8023c4 <fsipc>
+  802481:	85 c0                	test   %eax,%eax
+  802483:	78 37                	js     8024bc <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802485:	83 ec 08             	sub    $0x8,%esp
+  802488:	68 00 70 80 00       	push   $0x807000
+  80248d:	53                   	push   %ebx
+  80248e:	e8 7c e5 ff ff       	call   800a0f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802493:	a1 80 70 80 00       	mov    0x807080,%eax
+  802498:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80249e:	a1 84 70 80 00       	mov    0x807084,%eax
+  8024a3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8024a9:	a1 88 70 80 00       	mov    0x807088,%eax
+  8024ae:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8024b4:	83 c4 10             	add    $0x10,%esp
+  8024b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024bf:	c9                   	leave
+  8024c0:	c3                   	ret
+
+008024c1 <devfile_write>:
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	83 ec 0c             	sub    $0xc,%esp
+  8024c7:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8024ca:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8024cf:	39 d0                	cmp    %edx,%eax
+  8024d1:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024d7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8024da:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8024e0:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8024e5:	50                   	push   %eax
+  8024e6:	ff 75 0c             	push   0xc(%ebp)
+  8024e9:	68 08 70 80 00       	push   $0x807008
+  8024ee:	e8 cc e6 ff ff       	call   800bbf <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8024f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024fd:	e8 c2 fe ff ff       	call   8023c4 <fsipc>
+}
+  802502:	c9                   	leave
+  802503:	c3                   	ret
+
+00802504 <devfile_read>:
+{
+  802504:	55                   	push   %ebp
+  802505:	89 e5                	mov    %esp,%ebp
+  802507:	53                   	push   %ebx
+  802508:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80250b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802511:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802516:	8b 45 10             	mov    0x10(%ebp),%eax
+  802519:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80251e:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802523:	b8 03 00 00 00       	mov    $0x3,%eax
+  802528:	e8 97 fe ff ff       	call   8023c4 <fsipc>
+  80252d:	89 c3                	mov    %eax,%ebx
+  80252f:	85 c0                	test   %eax,%eax
+  802531:	78 14                	js     802547 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802533:	83 ec 04             	sub    $0x4,%esp
+  802536:	50                   	push   %eax
+  802537:	68 00 70 80 00       	push   $0x807000
+  80253c:	ff 75 0c             	push   0xc(%ebp)
+  80253f:	e8 7b e6 ff ff       	call   800bbf <memmove>
+	return r;
+  802544:	83 c4 10             	add    $0x10,%esp
+}
+  802547:	89 d8                	mov    %ebx,%eax
+  802549:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80254c:	c9                   	leave
+  80254d:	c3                   	ret
+
+0080254e <open>:
+{
+  80254e:	55                   	push   %ebp
+  80254f:	89 e5                	mov    %esp,%ebp
+  802551:	53                   	push   %ebx
+  802552:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802555:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802558:	50                   	push   %eax
+  802559:	e8 23 f8 ff ff       	call   801d81 <fd_alloc>
+  80255e:	89 c3                	mov    %eax,%ebx
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	85 c0                	test   %eax,%eax
+  802565:	78 2a                	js     802591 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802567:	83 ec 0c             	sub    $0xc,%esp
+  80256a:	ff 75 08             	push   0x8(%ebp)
+  80256d:	e8 51 e4 ff ff       	call   8009c3 <strlen>
+  802572:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802575:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80257a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80257f:	7e 17                	jle    802598 <open+0x4a>
+	fd_close(fd, 1);
+  802581:	83 ec 08             	sub    $0x8,%esp
+  802584:	6a 01                	push   $0x1
+  802586:	ff 75 f4             	push   -0xc(%ebp)
+  802589:	e8 08 f9 ff ff       	call   801e96 <fd_close>
+	return r;
+  80258e:	83 c4 10             	add    $0x10,%esp
+}
+  802591:	89 d8                	mov    %ebx,%eax
+  802593:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802596:	c9                   	leave
+  802597:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802598:	83 ec 08             	sub    $0x8,%esp
+  80259b:	ff 75 08             	push   0x8(%ebp)
+  80259e:	68 00 70 80 00       	push   $0x807000
+  8025a3:	e8 67 e4 ff ff       	call   800a0f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8025a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ab:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8025b0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b8:	e8 07 fe ff ff       	call   8023c4 <fsipc>
+  8025bd:	89 c3                	mov    %eax,%ebx
+  8025bf:	83 c4 10             	add    $0x10,%esp
+  8025c2:	85 c0                	test   %eax,%eax
+  8025c4:	78 bb                	js     802581 <open+0x33>
+	return fd2num(fd); 	
+  8025c6:	83 ec 0c             	sub    $0xc,%esp
+  8025c9:	ff 75 f4             	push   -0xc(%ebp)
+  8025cc:	e8 89 f7 ff ff       	call   801d5a <fd2num>
+  8025d1:	89 c3                	mov    %eax,%ebx
+  8025d3:	83 c4 10             	add    $0x10,%esp
+  8025d6:	eb b9                	jmp    802591 <open+0x43>
+
+008025d8 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8025d8:	55                   	push   %ebp
+  8025d9:	89 e5                	mov    %esp,%ebp
+  8025db:	53                   	push   %ebx
+  8025dc:	83 ec 1c             	sub    $0x1c,%esp
+  8025df:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025e5:	50                   	push   %eax
+  8025e6:	ff 75 08             	push   0x8(%ebp)
+  8025e9:	e8 e3 f7 ff ff       	call   801dd1 <fd_lookup>
+  8025ee:	83 c4 10             	add    $0x10,%esp
+  8025f1:	85 c0                	test   %eax,%eax
+  8025f3:	78 5a                	js     80264f <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8025f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025f8:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8025fe:	39 10                	cmp    %edx,(%eax)
+  802600:	75 66                	jne    802668 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802602:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802609:	74 49                	je     802654 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80260b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80260e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802611:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802616:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802619:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  80261e:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802624:	6a 07                	push   $0x7
+  802626:	68 00 70 80 00       	push   $0x807000
+  80262b:	6a 09                	push   $0x9
+  80262d:	ff 35 c4 66 80 00    	push   0x8066c4
+  802633:	e8 7a f6 ff ff       	call   801cb2 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802638:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80263f:	6a 00                	push   $0x0
+  802641:	53                   	push   %ebx
+  802642:	ff 75 10             	push   0x10(%ebp)
+  802645:	6a 00                	push   $0x0
+  802647:	e8 a3 f4 ff ff       	call   801aef <ipc_recv_pages>
+  80264c:	83 c4 20             	add    $0x20,%esp
+}
+  80264f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802652:	c9                   	leave
+  802653:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802654:	83 ec 0c             	sub    $0xc,%esp
+  802657:	6a 02                	push   $0x2
+  802659:	e8 bd f6 ff ff       	call   801d1b <ipc_find_env>
+  80265e:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802663:	83 c4 10             	add    $0x10,%esp
+  802666:	eb a3                	jmp    80260b <fmap+0x33>
+		return -E_INVAL;
+  802668:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80266d:	eb e0                	jmp    80264f <fmap+0x77>
+
+0080266f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80266f:	55                   	push   %ebp
+  802670:	89 e5                	mov    %esp,%ebp
+  802672:	53                   	push   %ebx
+  802673:	83 ec 10             	sub    $0x10,%esp
+  802676:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802679:	53                   	push   %ebx
+  80267a:	e8 44 e3 ff ff       	call   8009c3 <strlen>
+  80267f:	83 c4 10             	add    $0x10,%esp
+  802682:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802687:	7f 25                	jg     8026ae <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802689:	83 ec 08             	sub    $0x8,%esp
+  80268c:	53                   	push   %ebx
+  80268d:	68 00 70 80 00       	push   $0x807000
+  802692:	e8 78 e3 ff ff       	call   800a0f <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802697:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269c:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026a1:	e8 1e fd ff ff       	call   8023c4 <fsipc>
+  8026a6:	83 c4 10             	add    $0x10,%esp
+}
+  8026a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ac:	c9                   	leave
+  8026ad:	c3                   	ret
+		return -E_BAD_PATH;
+  8026ae:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026b3:	eb f4                	jmp    8026a9 <remove+0x3a>
+
+008026b5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8026b5:	55                   	push   %ebp
+  8026b6:	89 e5                	mov    %esp,%ebp
+  8026b8:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8026bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026c5:	e8 fa fc ff ff       	call   8023c4 <fsipc>
+}
+  8026ca:	c9                   	leave
+  8026cb:	c3                   	ret
+
+008026cc <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026cc:	55                   	push   %ebp
+  8026cd:	89 e5                	mov    %esp,%ebp
+  8026cf:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026d2:	68 5c 4b 80 00       	push   $0x804b5c
+  8026d7:	ff 75 0c             	push   0xc(%ebp)
+  8026da:	e8 30 e3 ff ff       	call   800a0f <strcpy>
+	return 0;
+}
+  8026df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e4:	c9                   	leave
+  8026e5:	c3                   	ret
+
+008026e6 <devsock_close>:
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	53                   	push   %ebx
+  8026ea:	83 ec 10             	sub    $0x10,%esp
+  8026ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026f0:	53                   	push   %ebx
+  8026f1:	e8 85 1c 00 00       	call   80437b <pageref>
+  8026f6:	89 c2                	mov    %eax,%edx
+  8026f8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026fb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802700:	83 fa 01             	cmp    $0x1,%edx
+  802703:	74 05                	je     80270a <devsock_close+0x24>
+}
+  802705:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80270a:	83 ec 0c             	sub    $0xc,%esp
+  80270d:	ff 73 0c             	push   0xc(%ebx)
+  802710:	e8 b0 05 00 00       	call   802cc5 <nsipc_close>
+  802715:	83 c4 10             	add    $0x10,%esp
+  802718:	eb eb                	jmp    802705 <devsock_close+0x1f>
+
+0080271a <devsock_write>:
+{
+  80271a:	55                   	push   %ebp
+  80271b:	89 e5                	mov    %esp,%ebp
+  80271d:	53                   	push   %ebx
+  80271e:	83 ec 14             	sub    $0x14,%esp
+  802721:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802724:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802727:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80272a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80272d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802730:	8b 41 08             	mov    0x8(%ecx),%eax
+  802733:	c1 f8 09             	sar    $0x9,%eax
+  802736:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802739:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80273f:	77 13                	ja     802754 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802741:	50                   	push   %eax
+  802742:	52                   	push   %edx
+  802743:	53                   	push   %ebx
+  802744:	ff 71 0c             	push   0xc(%ecx)
+  802747:	e8 5c 06 00 00       	call   802da8 <nsipc_send>
+  80274c:	83 c4 10             	add    $0x10,%esp
+}
+  80274f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802752:	c9                   	leave
+  802753:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802754:	50                   	push   %eax
+  802755:	6a 01                	push   $0x1
+  802757:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80275a:	50                   	push   %eax
+  80275b:	ff 71 0c             	push   0xc(%ecx)
+  80275e:	e8 a6 06 00 00       	call   802e09 <nsipc_sendmsg>
+  802763:	83 c4 10             	add    $0x10,%esp
+  802766:	eb e7                	jmp    80274f <devsock_write+0x35>
+
+00802768 <devsock_read>:
+{
+  802768:	55                   	push   %ebp
+  802769:	89 e5                	mov    %esp,%ebp
+  80276b:	53                   	push   %ebx
+  80276c:	83 ec 14             	sub    $0x14,%esp
+  80276f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802772:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802775:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802778:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80277b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80277e:	8b 41 08             	mov    0x8(%ecx),%eax
+  802781:	c1 f8 09             	sar    $0x9,%eax
+  802784:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802787:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80278d:	77 13                	ja     8027a2 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80278f:	50                   	push   %eax
+  802790:	52                   	push   %edx
+  802791:	53                   	push   %ebx
+  802792:	ff 71 0c             	push   0xc(%ecx)
+  802795:	e8 9c 05 00 00       	call   802d36 <nsipc_recv>
+  80279a:	83 c4 10             	add    $0x10,%esp
+}
+  80279d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027a0:	c9                   	leave
+  8027a1:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8027a2:	50                   	push   %eax
+  8027a3:	6a 01                	push   $0x1
+  8027a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027a8:	50                   	push   %eax
+  8027a9:	ff 71 0c             	push   0xc(%ecx)
+  8027ac:	e8 02 0a 00 00       	call   8031b3 <nsipc_recvmsg>
+  8027b1:	83 c4 10             	add    $0x10,%esp
+  8027b4:	eb e7                	jmp    80279d <devsock_read+0x35>
+
+008027b6 <fd2sockid>:
+{
+  8027b6:	55                   	push   %ebp
+  8027b7:	89 e5                	mov    %esp,%ebp
+  8027b9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027bc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027bf:	52                   	push   %edx
+  8027c0:	50                   	push   %eax
+  8027c1:	e8 0b f6 ff ff       	call   801dd1 <fd_lookup>
+  8027c6:	83 c4 10             	add    $0x10,%esp
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	78 10                	js     8027dd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d0:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8027d6:	39 08                	cmp    %ecx,(%eax)
+  8027d8:	75 05                	jne    8027df <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027da:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027dd:	c9                   	leave
+  8027de:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027e4:	eb f7                	jmp    8027dd <fd2sockid+0x27>
+
+008027e6 <sock_flags>:
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8027ec:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027ef:	52                   	push   %edx
+  8027f0:	50                   	push   %eax
+  8027f1:	e8 db f5 ff ff       	call   801dd1 <fd_lookup>
+  8027f6:	83 c4 10             	add    $0x10,%esp
+  8027f9:	85 c0                	test   %eax,%eax
+  8027fb:	78 0e                	js     80280b <sock_flags+0x25>
+  8027fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802800:	8b 40 08             	mov    0x8(%eax),%eax
+  802803:	c1 e8 09             	shr    $0x9,%eax
+  802806:	83 e0 08             	and    $0x8,%eax
+}
+  802809:	c9                   	leave
+  80280a:	c3                   	ret
+		return 0;
+  80280b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802810:	eb f7                	jmp    802809 <sock_flags+0x23>
+
+00802812 <alloc_sockfd>:
+{
+  802812:	55                   	push   %ebp
+  802813:	89 e5                	mov    %esp,%ebp
+  802815:	56                   	push   %esi
+  802816:	53                   	push   %ebx
+  802817:	83 ec 1c             	sub    $0x1c,%esp
+  80281a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80281c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80281f:	50                   	push   %eax
+  802820:	e8 5c f5 ff ff       	call   801d81 <fd_alloc>
+  802825:	89 c3                	mov    %eax,%ebx
+  802827:	83 c4 10             	add    $0x10,%esp
+  80282a:	85 c0                	test   %eax,%eax
+  80282c:	78 43                	js     802871 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80282e:	83 ec 04             	sub    $0x4,%esp
+  802831:	68 07 04 00 00       	push   $0x407
+  802836:	ff 75 f4             	push   -0xc(%ebp)
+  802839:	6a 00                	push   $0x0
+  80283b:	e8 03 e6 ff ff       	call   800e43 <sys_page_alloc>
+  802840:	89 c3                	mov    %eax,%ebx
+  802842:	83 c4 10             	add    $0x10,%esp
+  802845:	85 c0                	test   %eax,%eax
+  802847:	78 28                	js     802871 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802849:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80284c:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802852:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802854:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802857:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80285e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802861:	83 ec 0c             	sub    $0xc,%esp
+  802864:	50                   	push   %eax
+  802865:	e8 f0 f4 ff ff       	call   801d5a <fd2num>
+  80286a:	89 c3                	mov    %eax,%ebx
+  80286c:	83 c4 10             	add    $0x10,%esp
+  80286f:	eb 0c                	jmp    80287d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802871:	83 ec 0c             	sub    $0xc,%esp
+  802874:	56                   	push   %esi
+  802875:	e8 4b 04 00 00       	call   802cc5 <nsipc_close>
+		return r;
+  80287a:	83 c4 10             	add    $0x10,%esp
+}
+  80287d:	89 d8                	mov    %ebx,%eax
+  80287f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802882:	5b                   	pop    %ebx
+  802883:	5e                   	pop    %esi
+  802884:	5d                   	pop    %ebp
+  802885:	c3                   	ret
+
+00802886 <accept>:
+{
+  802886:	55                   	push   %ebp
+  802887:	89 e5                	mov    %esp,%ebp
+  802889:	56                   	push   %esi
+  80288a:	53                   	push   %ebx
+  80288b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80288e:	89 f0                	mov    %esi,%eax
+  802890:	e8 21 ff ff ff       	call   8027b6 <fd2sockid>
+  802895:	89 c3                	mov    %eax,%ebx
+  802897:	85 c0                	test   %eax,%eax
+  802899:	78 24                	js     8028bf <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80289b:	89 f0                	mov    %esi,%eax
+  80289d:	e8 44 ff ff ff       	call   8027e6 <sock_flags>
+  8028a2:	50                   	push   %eax
+  8028a3:	ff 75 10             	push   0x10(%ebp)
+  8028a6:	ff 75 0c             	push   0xc(%ebp)
+  8028a9:	53                   	push   %ebx
+  8028aa:	e8 6b 03 00 00       	call   802c1a <nsipc_accept>
+  8028af:	89 c3                	mov    %eax,%ebx
+  8028b1:	83 c4 10             	add    $0x10,%esp
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	78 07                	js     8028bf <accept+0x39>
+	return alloc_sockfd(r);
+  8028b8:	e8 55 ff ff ff       	call   802812 <alloc_sockfd>
+  8028bd:	89 c3                	mov    %eax,%ebx
+}
+  8028bf:	89 d8                	mov    %ebx,%eax
+  8028c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c4:	5b                   	pop    %ebx
+  8028c5:	5e                   	pop    %esi
+  8028c6:	5d                   	pop    %ebp
+  8028c7:	c3                   	ret
+
+008028c8 <bind>:
+{
+  8028c8:	55                   	push   %ebp
+  8028c9:	89 e5                	mov    %esp,%ebp
+  8028cb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d1:	e8 e0 fe ff ff       	call   8027b6 <fd2sockid>
+  8028d6:	85 c0                	test   %eax,%eax
+  8028d8:	78 12                	js     8028ec <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028da:	83 ec 04             	sub    $0x4,%esp
+  8028dd:	ff 75 10             	push   0x10(%ebp)
+  8028e0:	ff 75 0c             	push   0xc(%ebp)
+  8028e3:	50                   	push   %eax
+  8028e4:	e8 85 03 00 00       	call   802c6e <nsipc_bind>
+  8028e9:	83 c4 10             	add    $0x10,%esp
+}
+  8028ec:	c9                   	leave
+  8028ed:	c3                   	ret
+
+008028ee <shutdown>:
+{
+  8028ee:	55                   	push   %ebp
+  8028ef:	89 e5                	mov    %esp,%ebp
+  8028f1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f7:	e8 ba fe ff ff       	call   8027b6 <fd2sockid>
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	78 0f                	js     80290f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802900:	83 ec 08             	sub    $0x8,%esp
+  802903:	ff 75 0c             	push   0xc(%ebp)
+  802906:	50                   	push   %eax
+  802907:	e8 97 03 00 00       	call   802ca3 <nsipc_shutdown>
+  80290c:	83 c4 10             	add    $0x10,%esp
+}
+  80290f:	c9                   	leave
+  802910:	c3                   	ret
+
+00802911 <connect>:
+{
+  802911:	55                   	push   %ebp
+  802912:	89 e5                	mov    %esp,%ebp
+  802914:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802917:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291a:	e8 97 fe ff ff       	call   8027b6 <fd2sockid>
+  80291f:	85 c0                	test   %eax,%eax
+  802921:	78 12                	js     802935 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802923:	83 ec 04             	sub    $0x4,%esp
+  802926:	ff 75 10             	push   0x10(%ebp)
+  802929:	ff 75 0c             	push   0xc(%ebp)
+  80292c:	50                   	push   %eax
+  80292d:	e8 ad 03 00 00       	call   802cdf <nsipc_connect>
+  802932:	83 c4 10             	add    $0x10,%esp
+}
+  802935:	c9                   	leave
+  802936:	c3                   	ret
+
+00802937 <listen>:
+{
+  802937:	55                   	push   %ebp
+  802938:	89 e5                	mov    %esp,%ebp
+  80293a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80293d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802940:	e8 71 fe ff ff       	call   8027b6 <fd2sockid>
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 0f                	js     802958 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802949:	83 ec 08             	sub    $0x8,%esp
+  80294c:	ff 75 0c             	push   0xc(%ebp)
+  80294f:	50                   	push   %eax
+  802950:	e8 bf 03 00 00       	call   802d14 <nsipc_listen>
+  802955:	83 c4 10             	add    $0x10,%esp
+}
+  802958:	c9                   	leave
+  802959:	c3                   	ret
+
+0080295a <sendmsg>:
+{
+  80295a:	55                   	push   %ebp
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	57                   	push   %edi
+  80295e:	56                   	push   %esi
+  80295f:	53                   	push   %ebx
+  802960:	83 ec 0c             	sub    $0xc,%esp
+  802963:	8b 75 08             	mov    0x8(%ebp),%esi
+  802966:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802969:	89 f0                	mov    %esi,%eax
+  80296b:	e8 46 fe ff ff       	call   8027b6 <fd2sockid>
+  802970:	89 c3                	mov    %eax,%ebx
+  802972:	85 c0                	test   %eax,%eax
+  802974:	78 1c                	js     802992 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802976:	89 f0                	mov    %esi,%eax
+  802978:	e8 69 fe ff ff       	call   8027e6 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80297d:	0b 45 10             	or     0x10(%ebp),%eax
+  802980:	50                   	push   %eax
+  802981:	ff 77 0c             	push   0xc(%edi)
+  802984:	ff 77 08             	push   0x8(%edi)
+  802987:	53                   	push   %ebx
+  802988:	e8 7c 04 00 00       	call   802e09 <nsipc_sendmsg>
+  80298d:	89 c3                	mov    %eax,%ebx
+  80298f:	83 c4 10             	add    $0x10,%esp
+}
+  802992:	89 d8                	mov    %ebx,%eax
+  802994:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802997:	5b                   	pop    %ebx
+  802998:	5e                   	pop    %esi
+  802999:	5f                   	pop    %edi
+  80299a:	5d                   	pop    %ebp
+  80299b:	c3                   	ret
+
+0080299c <recvmsg>:
+{
+  80299c:	55                   	push   %ebp
+  80299d:	89 e5                	mov    %esp,%ebp
+  80299f:	57                   	push   %edi
+  8029a0:	56                   	push   %esi
+  8029a1:	53                   	push   %ebx
+  8029a2:	83 ec 0c             	sub    $0xc,%esp
+  8029a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8029ab:	89 f8                	mov    %edi,%eax
+  8029ad:	e8 04 fe ff ff       	call   8027b6 <fd2sockid>
+  8029b2:	89 c3                	mov    %eax,%ebx
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	78 2a                	js     8029e2 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8029b8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8029bf:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8029c6:	89 f8                	mov    %edi,%eax
+  8029c8:	e8 19 fe ff ff       	call   8027e6 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8029cd:	0b 45 10             	or     0x10(%ebp),%eax
+  8029d0:	50                   	push   %eax
+  8029d1:	ff 76 0c             	push   0xc(%esi)
+  8029d4:	ff 76 08             	push   0x8(%esi)
+  8029d7:	53                   	push   %ebx
+  8029d8:	e8 d6 07 00 00       	call   8031b3 <nsipc_recvmsg>
+  8029dd:	89 c3                	mov    %eax,%ebx
+  8029df:	83 c4 10             	add    $0x10,%esp
+}
+  8029e2:	89 d8                	mov    %ebx,%eax
+  8029e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e7:	5b                   	pop    %ebx
+  8029e8:	5e                   	pop    %esi
+  8029e9:	5f                   	pop    %edi
+  8029ea:	5d                   	pop    %ebp
+  8029eb:	c3                   	ret
+
+008029ec <sendfile>:
+{
+  8029ec:	55                   	push   %ebp
+  8029ed:	89 e5                	mov    %esp,%ebp
+  8029ef:	56                   	push   %esi
+  8029f0:	53                   	push   %ebx
+  8029f1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8029f4:	89 f0                	mov    %esi,%eax
+  8029f6:	e8 bb fd ff ff       	call   8027b6 <fd2sockid>
+  8029fb:	89 c3                	mov    %eax,%ebx
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 1f                	js     802a20 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802a01:	89 f0                	mov    %esi,%eax
+  802a03:	e8 de fd ff ff       	call   8027e6 <sock_flags>
+  802a08:	83 ec 0c             	sub    $0xc,%esp
+  802a0b:	50                   	push   %eax
+  802a0c:	ff 75 14             	push   0x14(%ebp)
+  802a0f:	ff 75 10             	push   0x10(%ebp)
+  802a12:	ff 75 0c             	push   0xc(%ebp)
+  802a15:	53                   	push   %ebx
+  802a16:	e8 64 06 00 00       	call   80307f <nsipc_sendfile>
+  802a1b:	89 c3                	mov    %eax,%ebx
+  802a1d:	83 c4 20             	add    $0x20,%esp
+}
+  802a20:	89 d8                	mov    %ebx,%eax
+  802a22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a25:	5b                   	pop    %ebx
+  802a26:	5e                   	pop    %esi
+  802a27:	5d                   	pop    %ebp
+  802a28:	c3                   	ret
+
+00802a29 <evctl>:
+{
+  802a29:	55                   	push   %ebp
+  802a2a:	89 e5                	mov    %esp,%ebp
+  802a2c:	53                   	push   %ebx
+  802a2d:	83 ec 04             	sub    $0x4,%esp
+  802a30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802a33:	89 d8                	mov    %ebx,%eax
+  802a35:	e8 7c fd ff ff       	call   8027b6 <fd2sockid>
+  802a3a:	85 c0                	test   %eax,%eax
+  802a3c:	78 10                	js     802a4e <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802a3e:	83 ec 04             	sub    $0x4,%esp
+  802a41:	53                   	push   %ebx
+  802a42:	ff 75 0c             	push   0xc(%ebp)
+  802a45:	50                   	push   %eax
+  802a46:	e8 d2 0b 00 00       	call   80361d <nsipc_evctl>
+  802a4b:	83 c4 10             	add    $0x10,%esp
+}
+  802a4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a51:	c9                   	leave
+  802a52:	c3                   	ret
+
+00802a53 <evwait>:
+{
+  802a53:	55                   	push   %ebp
+  802a54:	89 e5                	mov    %esp,%ebp
+  802a56:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802a59:	ff 75 10             	push   0x10(%ebp)
+  802a5c:	ff 75 0c             	push   0xc(%ebp)
+  802a5f:	ff 75 08             	push   0x8(%ebp)
+  802a62:	e8 e0 0b 00 00       	call   803647 <nsipc_evwait>
+}
+  802a67:	c9                   	leave
+  802a68:	c3                   	ret
+
+00802a69 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a69:	55                   	push   %ebp
+  802a6a:	89 e5                	mov    %esp,%ebp
+  802a6c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a6f:	ff 75 10             	push   0x10(%ebp)
+  802a72:	ff 75 0c             	push   0xc(%ebp)
+  802a75:	ff 75 08             	push   0x8(%ebp)
+  802a78:	e8 31 0c 00 00       	call   8036ae <nsipc_socket>
+  802a7d:	83 c4 10             	add    $0x10,%esp
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	78 05                	js     802a89 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a84:	e8 89 fd ff ff       	call   802812 <alloc_sockfd>
+}
+  802a89:	c9                   	leave
+  802a8a:	c3                   	ret
+
+00802a8b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a8b:	55                   	push   %ebp
+  802a8c:	89 e5                	mov    %esp,%ebp
+  802a8e:	53                   	push   %ebx
+  802a8f:	83 ec 04             	sub    $0x4,%esp
+  802a92:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802a94:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802a9b:	74 26                	je     802ac3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a9d:	6a 07                	push   $0x7
+  802a9f:	68 00 80 80 00       	push   $0x808000
+  802aa4:	53                   	push   %ebx
+  802aa5:	ff 35 e4 69 80 00    	push   0x8069e4
+  802aab:	e8 02 f2 ff ff       	call   801cb2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802ab0:	83 c4 0c             	add    $0xc,%esp
+  802ab3:	6a 00                	push   $0x0
+  802ab5:	6a 00                	push   $0x0
+  802ab7:	6a 00                	push   $0x0
+  802ab9:	e8 64 ef ff ff       	call   801a22 <ipc_recv>
+}
+  802abe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac1:	c9                   	leave
+  802ac2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ac3:	83 ec 0c             	sub    $0xc,%esp
+  802ac6:	6a 03                	push   $0x3
+  802ac8:	e8 4e f2 ff ff       	call   801d1b <ipc_find_env>
+  802acd:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802ad2:	83 c4 10             	add    $0x10,%esp
+  802ad5:	eb c6                	jmp    802a9d <nsipc+0x12>
+
+00802ad7 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802ad7:	55                   	push   %ebp
+  802ad8:	89 e5                	mov    %esp,%ebp
+  802ada:	56                   	push   %esi
+  802adb:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802adc:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  802ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802ae7:	85 f6                	test   %esi,%esi
+  802ae9:	75 33                	jne    802b1e <nsbulk_map+0x47>
+  802aeb:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802af0:	83 ec 04             	sub    $0x4,%esp
+  802af3:	6a 07                	push   $0x7
+  802af5:	53                   	push   %ebx
+  802af6:	6a 00                	push   $0x0
+  802af8:	e8 46 e3 ff ff       	call   800e43 <sys_page_alloc>
+  802afd:	83 c4 10             	add    $0x10,%esp
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	78 1a                	js     802b1e <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802b04:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802b0a:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802b10:	75 de                	jne    802af0 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802b12:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802b19:	00 00 00 
+	return 0;
+  802b1c:	89 f0                	mov    %esi,%eax
+}
+  802b1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b21:	5b                   	pop    %ebx
+  802b22:	5e                   	pop    %esi
+  802b23:	5d                   	pop    %ebp
+  802b24:	c3                   	ret
+
+00802b25 <nsbulk_own>:
+{
+  802b25:	55                   	push   %ebp
+  802b26:	89 e5                	mov    %esp,%ebp
+  802b28:	57                   	push   %edi
+  802b29:	56                   	push   %esi
+  802b2a:	53                   	push   %ebx
+  802b2b:	83 ec 0c             	sub    $0xc,%esp
+  802b2e:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802b30:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802b33:	85 d2                	test   %edx,%edx
+  802b35:	7f 0e                	jg     802b45 <nsbulk_own+0x20>
+	return 0;
+  802b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3c:	eb 47                	jmp    802b85 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802b3e:	83 c3 01             	add    $0x1,%ebx
+  802b41:	39 fb                	cmp    %edi,%ebx
+  802b43:	7d 3b                	jge    802b80 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802b45:	be 01 00 00 00       	mov    $0x1,%esi
+  802b4a:	89 d9                	mov    %ebx,%ecx
+  802b4c:	d3 e6                	shl    %cl,%esi
+  802b4e:	89 f0                	mov    %esi,%eax
+  802b50:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802b56:	74 e6                	je     802b3e <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802b58:	83 ec 04             	sub    $0x4,%esp
+  802b5b:	6a 07                	push   $0x7
+  802b5d:	89 d8                	mov    %ebx,%eax
+  802b5f:	c1 e0 0c             	shl    $0xc,%eax
+  802b62:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b67:	50                   	push   %eax
+  802b68:	6a 00                	push   $0x0
+  802b6a:	e8 d4 e2 ff ff       	call   800e43 <sys_page_alloc>
+  802b6f:	83 c4 10             	add    $0x10,%esp
+  802b72:	85 c0                	test   %eax,%eax
+  802b74:	78 0f                	js     802b85 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802b76:	f7 d6                	not    %esi
+  802b78:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802b7e:	eb be                	jmp    802b3e <nsbulk_own+0x19>
+	return 0;
+  802b80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b88:	5b                   	pop    %ebx
+  802b89:	5e                   	pop    %esi
+  802b8a:	5f                   	pop    %edi
+  802b8b:	5d                   	pop    %ebp
+  802b8c:	c3                   	ret
+
+00802b8d <nsipc_bulk>:
+{
+  802b8d:	55                   	push   %ebp
+  802b8e:	89 e5                	mov    %esp,%ebp
+  802b90:	57                   	push   %edi
+  802b91:	56                   	push   %esi
+  802b92:	53                   	push   %ebx
+  802b93:	83 ec 1c             	sub    $0x1c,%esp
+  802b96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b99:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802b9b:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802ba1:	c1 fb 0c             	sar    $0xc,%ebx
+  802ba4:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802ba7:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802bae:	74 56                	je     802c06 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802bb0:	85 ff                	test   %edi,%edi
+  802bb2:	7e 24                	jle    802bd8 <nsipc_bulk+0x4b>
+  802bb4:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802bba:	74 1c                	je     802bd8 <nsipc_bulk+0x4b>
+  802bbc:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802bc2:	c1 e3 0c             	shl    $0xc,%ebx
+  802bc5:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802bca:	0f b6 10             	movzbl (%eax),%edx
+  802bcd:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802bcf:	05 00 10 00 00       	add    $0x1000,%eax
+  802bd4:	39 d8                	cmp    %ebx,%eax
+  802bd6:	75 f2                	jne    802bca <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802bd8:	83 ec 0c             	sub    $0xc,%esp
+  802bdb:	56                   	push   %esi
+  802bdc:	57                   	push   %edi
+  802bdd:	68 00 00 00 e0       	push   $0xe0000000
+  802be2:	ff 75 e4             	push   -0x1c(%ebp)
+  802be5:	ff 35 e4 69 80 00    	push   0x8069e4
+  802beb:	e8 f6 f0 ff ff       	call   801ce6 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802bf0:	83 c4 1c             	add    $0x1c,%esp
+  802bf3:	6a 00                	push   $0x0
+  802bf5:	6a 00                	push   $0x0
+  802bf7:	6a 00                	push   $0x0
+  802bf9:	e8 24 ee ff ff       	call   801a22 <ipc_recv>
+}
+  802bfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c01:	5b                   	pop    %ebx
+  802c02:	5e                   	pop    %esi
+  802c03:	5f                   	pop    %edi
+  802c04:	5d                   	pop    %ebp
+  802c05:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c06:	83 ec 0c             	sub    $0xc,%esp
+  802c09:	6a 03                	push   $0x3
+  802c0b:	e8 0b f1 ff ff       	call   801d1b <ipc_find_env>
+  802c10:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802c15:	83 c4 10             	add    $0x10,%esp
+  802c18:	eb 96                	jmp    802bb0 <nsipc_bulk+0x23>
+
+00802c1a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802c1a:	55                   	push   %ebp
+  802c1b:	89 e5                	mov    %esp,%ebp
+  802c1d:	53                   	push   %ebx
+  802c1e:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c24:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802c29:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c2c:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c31:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c36:	e8 50 fe ff ff       	call   802a8b <nsipc>
+  802c3b:	89 c3                	mov    %eax,%ebx
+  802c3d:	85 c0                	test   %eax,%eax
+  802c3f:	79 07                	jns    802c48 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c41:	89 d8                	mov    %ebx,%eax
+  802c43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c48:	83 ec 04             	sub    $0x4,%esp
+  802c4b:	ff 35 10 80 80 00    	push   0x808010
+  802c51:	68 00 80 80 00       	push   $0x808000
+  802c56:	ff 75 0c             	push   0xc(%ebp)
+  802c59:	e8 61 df ff ff       	call   800bbf <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c5e:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802c64:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c67:	89 10                	mov    %edx,(%eax)
+  802c69:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c6c:	eb d3                	jmp    802c41 <nsipc_accept+0x27>
+
+00802c6e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c6e:	55                   	push   %ebp
+  802c6f:	89 e5                	mov    %esp,%ebp
+  802c71:	53                   	push   %ebx
+  802c72:	83 ec 08             	sub    $0x8,%esp
+  802c75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c78:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7b:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c80:	53                   	push   %ebx
+  802c81:	ff 75 0c             	push   0xc(%ebp)
+  802c84:	68 04 80 80 00       	push   $0x808004
+  802c89:	e8 31 df ff ff       	call   800bbf <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c8e:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802c94:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c99:	e8 ed fd ff ff       	call   802a8b <nsipc>
+}
+  802c9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ca1:	c9                   	leave
+  802ca2:	c3                   	ret
+
+00802ca3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ca3:	55                   	push   %ebp
+  802ca4:	89 e5                	mov    %esp,%ebp
+  802ca6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cac:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802cb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb4:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802cb9:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cbe:	e8 c8 fd ff ff       	call   802a8b <nsipc>
+}
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+
+00802cc5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802cc5:	55                   	push   %ebp
+  802cc6:	89 e5                	mov    %esp,%ebp
+  802cc8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cce:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802cd3:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cd8:	e8 ae fd ff ff       	call   802a8b <nsipc>
+}
+  802cdd:	c9                   	leave
+  802cde:	c3                   	ret
+
+00802cdf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802cdf:	55                   	push   %ebp
+  802ce0:	89 e5                	mov    %esp,%ebp
+  802ce2:	53                   	push   %ebx
+  802ce3:	83 ec 08             	sub    $0x8,%esp
+  802ce6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cec:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802cf1:	53                   	push   %ebx
+  802cf2:	ff 75 0c             	push   0xc(%ebp)
+  802cf5:	68 04 80 80 00       	push   $0x808004
+  802cfa:	e8 c0 de ff ff       	call   800bbf <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802cff:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802d05:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d0a:	e8 7c fd ff ff       	call   802a8b <nsipc>
+}
+  802d0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d12:	c9                   	leave
+  802d13:	c3                   	ret
+
+00802d14 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d14:	55                   	push   %ebp
+  802d15:	89 e5                	mov    %esp,%ebp
+  802d17:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d25:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802d2a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d2f:	e8 57 fd ff ff       	call   802a8b <nsipc>
+}
+  802d34:	c9                   	leave
+  802d35:	c3                   	ret
+
+00802d36 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d36:	55                   	push   %ebp
+  802d37:	89 e5                	mov    %esp,%ebp
+  802d39:	56                   	push   %esi
+  802d3a:	53                   	push   %ebx
+  802d3b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d41:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802d46:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802d4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d4f:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d54:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d59:	e8 2d fd ff ff       	call   802a8b <nsipc>
+  802d5e:	89 c3                	mov    %eax,%ebx
+  802d60:	85 c0                	test   %eax,%eax
+  802d62:	78 22                	js     802d86 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d64:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d69:	39 c6                	cmp    %eax,%esi
+  802d6b:	0f 4e c6             	cmovle %esi,%eax
+  802d6e:	39 c3                	cmp    %eax,%ebx
+  802d70:	7f 1d                	jg     802d8f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d72:	83 ec 04             	sub    $0x4,%esp
+  802d75:	53                   	push   %ebx
+  802d76:	68 00 80 80 00       	push   $0x808000
+  802d7b:	ff 75 0c             	push   0xc(%ebp)
+  802d7e:	e8 3c de ff ff       	call   800bbf <memmove>
+  802d83:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d86:	89 d8                	mov    %ebx,%eax
+  802d88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d8b:	5b                   	pop    %ebx
+  802d8c:	5e                   	pop    %esi
+  802d8d:	5d                   	pop    %ebp
+  802d8e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d8f:	68 68 4b 80 00       	push   $0x804b68
+  802d94:	68 7d 4b 80 00       	push   $0x804b7d
+  802d99:	68 b2 00 00 00       	push   $0xb2
+  802d9e:	68 92 4b 80 00       	push   $0x804b92
+  802da3:	e8 95 d4 ff ff       	call   80023d <_panic>
+
+00802da8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802da8:	55                   	push   %ebp
+  802da9:	89 e5                	mov    %esp,%ebp
+  802dab:	53                   	push   %ebx
+  802dac:	83 ec 04             	sub    $0x4,%esp
+  802daf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802db2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db5:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802dba:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802dc0:	7f 2e                	jg     802df0 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802dc2:	83 ec 04             	sub    $0x4,%esp
+  802dc5:	53                   	push   %ebx
+  802dc6:	ff 75 0c             	push   0xc(%ebp)
+  802dc9:	68 0c 80 80 00       	push   $0x80800c
+  802dce:	e8 ec dd ff ff       	call   800bbf <memmove>
+	nsipcbuf.send.req_size = size;
+  802dd3:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802dd9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ddc:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802de1:	b8 08 00 00 00       	mov    $0x8,%eax
+  802de6:	e8 a0 fc ff ff       	call   802a8b <nsipc>
+}
+  802deb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dee:	c9                   	leave
+  802def:	c3                   	ret
+	assert(size < 1600);
+  802df0:	68 9e 4b 80 00       	push   $0x804b9e
+  802df5:	68 7d 4b 80 00       	push   $0x804b7d
+  802dfa:	68 bd 00 00 00       	push   $0xbd
+  802dff:	68 92 4b 80 00       	push   $0x804b92
+  802e04:	e8 34 d4 ff ff       	call   80023d <_panic>
+
+00802e09 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	57                   	push   %edi
+  802e0d:	56                   	push   %esi
+  802e0e:	53                   	push   %ebx
+  802e0f:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802e12:	e8 c0 fc ff ff       	call   802ad7 <nsbulk_map>
+  802e17:	85 c0                	test   %eax,%eax
+  802e19:	78 55                	js     802e70 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802e1b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802e22:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802e29:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e30:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e33:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e36:	0f 8d 24 02 00 00    	jge    803060 <nsipc_sendmsg+0x257>
+  802e3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e3f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e42:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802e45:	89 d8                	mov    %ebx,%eax
+  802e47:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e4c:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802e4e:	83 ec 0c             	sub    $0xc,%esp
+  802e51:	68 e0 66 80 00       	push   $0x8066e0
+  802e56:	e8 bc 0f 00 00       	call   803e17 <pgbatch_init>
+  802e5b:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e5e:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802e60:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802e63:	e9 82 00 00 00       	jmp    802eea <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802e68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e6b:	85 db                	test   %ebx,%ebx
+  802e6d:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e73:	5b                   	pop    %ebx
+  802e74:	5e                   	pop    %esi
+  802e75:	5f                   	pop    %edi
+  802e76:	5d                   	pop    %ebp
+  802e77:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802e78:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802e7d:	29 c8                	sub    %ecx,%eax
+  802e7f:	39 d0                	cmp    %edx,%eax
+  802e81:	0f 46 d0             	cmovbe %eax,%edx
+  802e84:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802e86:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e8c:	85 ff                	test   %edi,%edi
+  802e8e:	0f 49 c7             	cmovns %edi,%eax
+  802e91:	c1 f8 0c             	sar    $0xc,%eax
+  802e94:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e99:	e8 87 fc ff ff       	call   802b25 <nsbulk_own>
+  802e9e:	85 c0                	test   %eax,%eax
+  802ea0:	0f 88 17 01 00 00    	js     802fbd <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802ea6:	83 ec 04             	sub    $0x4,%esp
+  802ea9:	56                   	push   %esi
+  802eaa:	ff 75 e0             	push   -0x20(%ebp)
+  802ead:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802eb0:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802eb5:	50                   	push   %eax
+  802eb6:	e8 04 dd ff ff       	call   800bbf <memmove>
+  802ebb:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802ebe:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802ec1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ec4:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ec7:	0f 84 fd 00 00 00    	je     802fca <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802ecd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802ed0:	01 f7                	add    %esi,%edi
+  802ed2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ed5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ed8:	0f 8d 01 01 00 00    	jge    802fdf <nsipc_sendmsg+0x1d6>
+  802ede:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802ee4:	0f 8f f0 00 00 00    	jg     802fda <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802eea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802eed:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802ef0:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802ef3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef6:	89 c2                	mov    %eax,%edx
+  802ef8:	03 13                	add    (%ebx),%edx
+  802efa:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802efd:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f00:	29 c6                	sub    %eax,%esi
+  802f02:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802f07:	29 f9                	sub    %edi,%ecx
+  802f09:	39 ce                	cmp    %ecx,%esi
+  802f0b:	89 ca                	mov    %ecx,%edx
+  802f0d:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802f10:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802f13:	89 f9                	mov    %edi,%ecx
+  802f15:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802f1b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f1e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f23:	09 c8                	or     %ecx,%eax
+  802f25:	0f 85 4d ff ff ff    	jne    802e78 <nsipc_sendmsg+0x6f>
+  802f2b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802f31:	0f 86 41 ff ff ff    	jbe    802e78 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f37:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802f3d:	85 ff                	test   %edi,%edi
+  802f3f:	0f 49 c7             	cmovns %edi,%eax
+  802f42:	c1 f8 0c             	sar    $0xc,%eax
+  802f45:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f47:	89 d1                	mov    %edx,%ecx
+  802f49:	c1 e9 0c             	shr    $0xc,%ecx
+  802f4c:	01 c8                	add    %ecx,%eax
+  802f4e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f51:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f54:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802f56:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f59:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f5e:	29 c8                	sub    %ecx,%eax
+  802f60:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f63:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802f66:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f68:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f6d:	89 f9                	mov    %edi,%ecx
+  802f6f:	d3 e0                	shl    %cl,%eax
+  802f71:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f77:	83 ec 08             	sub    $0x8,%esp
+  802f7a:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802f7c:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f7f:	50                   	push   %eax
+  802f80:	6a 00                	push   $0x0
+  802f82:	56                   	push   %esi
+  802f83:	6a 00                	push   $0x0
+  802f85:	68 e0 66 80 00       	push   $0x8066e0
+  802f8a:	e8 46 0f 00 00       	call   803ed5 <pgbatch_map>
+  802f8f:	83 c4 20             	add    $0x20,%esp
+  802f92:	85 c0                	test   %eax,%eax
+  802f94:	0f 88 ce fe ff ff    	js     802e68 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f9a:	83 c7 01             	add    $0x1,%edi
+  802f9d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802fa3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802fa6:	39 c7                	cmp    %eax,%edi
+  802fa8:	75 be                	jne    802f68 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802faa:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802fad:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802fb0:	89 d6                	mov    %edx,%esi
+  802fb2:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802fb8:	e9 01 ff ff ff       	jmp    802ebe <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802fbd:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802fc0:	85 db                	test   %ebx,%ebx
+  802fc2:	0f 45 c3             	cmovne %ebx,%eax
+  802fc5:	e9 a6 fe ff ff       	jmp    802e70 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802fca:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802fce:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802fd5:	e9 f3 fe ff ff       	jmp    802ecd <nsipc_sendmsg+0xc4>
+  802fda:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802fdd:	eb 03                	jmp    802fe2 <nsipc_sendmsg+0x1d9>
+  802fdf:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802fe2:	83 ec 0c             	sub    $0xc,%esp
+  802fe5:	68 e0 66 80 00       	push   $0x8066e0
+  802fea:	e8 36 0e 00 00       	call   803e25 <pgbatch_flush>
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	85 c0                	test   %eax,%eax
+  802ff4:	78 50                	js     803046 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff9:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802ffe:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  803004:	89 fb                	mov    %edi,%ebx
+  803006:	29 f3                	sub    %esi,%ebx
+  803008:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80300e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803011:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  803016:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80301b:	89 fa                	mov    %edi,%edx
+  80301d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803022:	e8 66 fb ff ff       	call   802b8d <nsipc_bulk>
+  803027:	85 c0                	test   %eax,%eax
+  803029:	78 28                	js     803053 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80302b:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80302e:	39 c3                	cmp    %eax,%ebx
+  803030:	75 0c                	jne    80303e <nsipc_sendmsg+0x235>
+  803032:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803035:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803038:	0f 8f f2 fd ff ff    	jg     802e30 <nsipc_sendmsg+0x27>
+		sent += r;
+  80303e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803041:	e9 2a fe ff ff       	jmp    802e70 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803046:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803049:	85 db                	test   %ebx,%ebx
+  80304b:	0f 45 c3             	cmovne %ebx,%eax
+  80304e:	e9 1d fe ff ff       	jmp    802e70 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803053:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803056:	85 db                	test   %ebx,%ebx
+  803058:	0f 45 c3             	cmovne %ebx,%eax
+  80305b:	e9 10 fe ff ff       	jmp    802e70 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803060:	83 ec 0c             	sub    $0xc,%esp
+  803063:	68 e0 66 80 00       	push   $0x8066e0
+  803068:	e8 aa 0d 00 00       	call   803e17 <pgbatch_init>
+  80306d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803070:	be 00 00 00 00       	mov    $0x0,%esi
+  803075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307a:	e9 63 ff ff ff       	jmp    802fe2 <nsipc_sendmsg+0x1d9>
+
+0080307f <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80307f:	55                   	push   %ebp
+  803080:	89 e5                	mov    %esp,%ebp
+  803082:	57                   	push   %edi
+  803083:	56                   	push   %esi
+  803084:	53                   	push   %ebx
+  803085:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  803088:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  80308f:	0f 84 c8 00 00 00    	je     80315d <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803095:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80309c:	0f 84 e4 00 00 00    	je     803186 <nsipc_sendfile+0x107>
+{
+  8030a2:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8030a7:	89 fb                	mov    %edi,%ebx
+  8030a9:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8030ac:	0f 83 f0 00 00 00    	jae    8031a2 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8030b2:	89 fa                	mov    %edi,%edx
+  8030b4:	03 55 10             	add    0x10(%ebp),%edx
+  8030b7:	89 d0                	mov    %edx,%eax
+  8030b9:	c1 f8 1f             	sar    $0x1f,%eax
+  8030bc:	c1 e8 14             	shr    $0x14,%eax
+  8030bf:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8030c2:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8030c8:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8030ca:	6a 10                	push   $0x10
+  8030cc:	68 00 20 01 e0       	push   $0xe0012000
+  8030d1:	52                   	push   %edx
+  8030d2:	ff 75 0c             	push   0xc(%ebp)
+  8030d5:	e8 fe f4 ff ff       	call   8025d8 <fmap>
+  8030da:	83 c4 10             	add    $0x10,%esp
+  8030dd:	85 c0                	test   %eax,%eax
+  8030df:	0f 8e b8 00 00 00    	jle    80319d <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8030e5:	39 c6                	cmp    %eax,%esi
+  8030e7:	0f 8d b5 00 00 00    	jge    8031a2 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8030ed:	29 f0                	sub    %esi,%eax
+  8030ef:	8b 55 14             	mov    0x14(%ebp),%edx
+  8030f2:	29 da                	sub    %ebx,%edx
+  8030f4:	39 d0                	cmp    %edx,%eax
+  8030f6:	89 d3                	mov    %edx,%ebx
+  8030f8:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8030fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030fe:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803103:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  803109:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  80310f:	8b 45 18             	mov    0x18(%ebp),%eax
+  803112:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803117:	83 ec 0c             	sub    $0xc,%esp
+  80311a:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80311c:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803123:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803126:	83 c0 01             	add    $0x1,%eax
+  803129:	50                   	push   %eax
+  80312a:	68 00 10 01 e0       	push   $0xe0011000
+  80312f:	6a 11                	push   $0x11
+  803131:	ff 35 e4 69 80 00    	push   0x8069e4
+  803137:	e8 aa eb ff ff       	call   801ce6 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80313c:	83 c4 1c             	add    $0x1c,%esp
+  80313f:	6a 00                	push   $0x0
+  803141:	6a 00                	push   $0x0
+  803143:	6a 00                	push   $0x0
+  803145:	e8 d8 e8 ff ff       	call   801a22 <ipc_recv>
+  80314a:	83 c4 10             	add    $0x10,%esp
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	78 5b                	js     8031ac <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803151:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803153:	39 c3                	cmp    %eax,%ebx
+  803155:	0f 8e 4c ff ff ff    	jle    8030a7 <nsipc_sendfile+0x28>
+  80315b:	eb 45                	jmp    8031a2 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80315d:	83 ec 04             	sub    $0x4,%esp
+  803160:	6a 07                	push   $0x7
+  803162:	68 00 10 01 e0       	push   $0xe0011000
+  803167:	6a 00                	push   $0x0
+  803169:	e8 d5 dc ff ff       	call   800e43 <sys_page_alloc>
+  80316e:	89 c7                	mov    %eax,%edi
+  803170:	83 c4 10             	add    $0x10,%esp
+  803173:	85 c0                	test   %eax,%eax
+  803175:	78 2b                	js     8031a2 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803177:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  80317e:	00 00 00 
+  803181:	e9 0f ff ff ff       	jmp    803095 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803186:	83 ec 0c             	sub    $0xc,%esp
+  803189:	6a 03                	push   $0x3
+  80318b:	e8 8b eb ff ff       	call   801d1b <ipc_find_env>
+  803190:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  803195:	83 c4 10             	add    $0x10,%esp
+  803198:	e9 05 ff ff ff       	jmp    8030a2 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80319d:	85 ff                	test   %edi,%edi
+  80319f:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8031a2:	89 f8                	mov    %edi,%eax
+  8031a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a7:	5b                   	pop    %ebx
+  8031a8:	5e                   	pop    %esi
+  8031a9:	5f                   	pop    %edi
+  8031aa:	5d                   	pop    %ebp
+  8031ab:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8031ac:	85 ff                	test   %edi,%edi
+  8031ae:	0f 44 f8             	cmove  %eax,%edi
+  8031b1:	eb ef                	jmp    8031a2 <nsipc_sendfile+0x123>
+
+008031b3 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8031b3:	55                   	push   %ebp
+  8031b4:	89 e5                	mov    %esp,%ebp
+  8031b6:	57                   	push   %edi
+  8031b7:	56                   	push   %esi
+  8031b8:	53                   	push   %ebx
+  8031b9:	83 ec 1c             	sub    $0x1c,%esp
+  8031bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8031bf:	e8 13 f9 ff ff       	call   802ad7 <nsbulk_map>
+  8031c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	0f 88 ba 00 00 00    	js     803289 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031cf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8031d3:	0f 8e bb 00 00 00    	jle    803294 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8031d9:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031de:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8031e3:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8031e8:	89 f8                	mov    %edi,%eax
+  8031ea:	29 f0                	sub    %esi,%eax
+  8031ec:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8031f0:	39 c8                	cmp    %ecx,%eax
+  8031f2:	0f 47 c1             	cmova  %ecx,%eax
+  8031f5:	01 f0                	add    %esi,%eax
+  8031f7:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031f9:	83 c2 01             	add    $0x1,%edx
+  8031fc:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8031ff:	7e 07                	jle    803208 <nsipc_recvmsg+0x55>
+  803201:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803206:	7e e0                	jle    8031e8 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803208:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80320e:	c1 fa 0c             	sar    $0xc,%edx
+  803211:	b8 00 00 00 00       	mov    $0x0,%eax
+  803216:	e8 0a f9 ff ff       	call   802b25 <nsbulk_own>
+  80321b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80321e:	85 c0                	test   %eax,%eax
+  803220:	78 67                	js     803289 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803222:	8b 45 08             	mov    0x8(%ebp),%eax
+  803225:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80322a:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803230:	8b 45 14             	mov    0x14(%ebp),%eax
+  803233:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803238:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80323d:	89 f2                	mov    %esi,%edx
+  80323f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803244:	e8 44 f9 ff ff       	call   802b8d <nsipc_bulk>
+  803249:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	78 39                	js     803289 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803250:	39 f0                	cmp    %esi,%eax
+  803252:	7f 4a                	jg     80329e <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803254:	bf 00 00 00 00       	mov    $0x0,%edi
+  803259:	85 c0                	test   %eax,%eax
+  80325b:	7e 2c                	jle    803289 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80325d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803260:	29 fe                	sub    %edi,%esi
+  803262:	8b 43 04             	mov    0x4(%ebx),%eax
+  803265:	39 c6                	cmp    %eax,%esi
+  803267:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80326a:	83 ec 04             	sub    $0x4,%esp
+  80326d:	56                   	push   %esi
+  80326e:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803274:	50                   	push   %eax
+  803275:	ff 33                	push   (%ebx)
+  803277:	e8 43 d9 ff ff       	call   800bbf <memmove>
+		n += m;
+  80327c:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80327e:	83 c3 08             	add    $0x8,%ebx
+  803281:	83 c4 10             	add    $0x10,%esp
+  803284:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803287:	7f d4                	jg     80325d <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803289:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80328c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80328f:	5b                   	pop    %ebx
+  803290:	5e                   	pop    %esi
+  803291:	5f                   	pop    %edi
+  803292:	5d                   	pop    %ebp
+  803293:	c3                   	ret
+	int r, i, n, len = 0;
+  803294:	be 00 00 00 00       	mov    $0x0,%esi
+  803299:	e9 6a ff ff ff       	jmp    803208 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80329e:	68 74 4b 80 00       	push   $0x804b74
+  8032a3:	68 7d 4b 80 00       	push   $0x804b7d
+  8032a8:	68 3b 01 00 00       	push   $0x13b
+  8032ad:	68 92 4b 80 00       	push   $0x804b92
+  8032b2:	e8 86 cf ff ff       	call   80023d <_panic>
+
+008032b7 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8032b7:	55                   	push   %ebp
+  8032b8:	89 e5                	mov    %esp,%ebp
+  8032ba:	57                   	push   %edi
+  8032bb:	56                   	push   %esi
+  8032bc:	53                   	push   %ebx
+  8032bd:	83 ec 0c             	sub    $0xc,%esp
+  8032c0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8032c3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8032c6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8032c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032cc:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8032d1:	8b 07                	mov    (%edi),%eax
+  8032d3:	a3 04 80 80 00       	mov    %eax,0x808004
+  8032d8:	8b 47 04             	mov    0x4(%edi),%eax
+  8032db:	a3 08 80 80 00       	mov    %eax,0x808008
+  8032e0:	8b 47 08             	mov    0x8(%edi),%eax
+  8032e3:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8032e8:	8b 47 0c             	mov    0xc(%edi),%eax
+  8032eb:	a3 10 80 80 00       	mov    %eax,0x808010
+  8032f0:	8b 47 10             	mov    0x10(%edi),%eax
+  8032f3:	a3 14 80 80 00       	mov    %eax,0x808014
+  8032f8:	8b 47 14             	mov    0x14(%edi),%eax
+  8032fb:	a3 18 80 80 00       	mov    %eax,0x808018
+  803300:	8b 47 18             	mov    0x18(%edi),%eax
+  803303:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803308:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80330b:	a3 20 80 80 00       	mov    %eax,0x808020
+  803310:	8b 47 20             	mov    0x20(%edi),%eax
+  803313:	a3 24 80 80 00       	mov    %eax,0x808024
+  803318:	8b 47 24             	mov    0x24(%edi),%eax
+  80331b:	a3 28 80 80 00       	mov    %eax,0x808028
+  803320:	8b 47 28             	mov    0x28(%edi),%eax
+  803323:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  803328:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80332b:	a3 30 80 80 00       	mov    %eax,0x808030
+  803330:	8b 47 30             	mov    0x30(%edi),%eax
+  803333:	a3 34 80 80 00       	mov    %eax,0x808034
+  803338:	8b 47 34             	mov    0x34(%edi),%eax
+  80333b:	a3 38 80 80 00       	mov    %eax,0x808038
+  803340:	8b 47 38             	mov    0x38(%edi),%eax
+  803343:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  803348:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80334b:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803350:	8b 06                	mov    (%esi),%eax
+  803352:	a3 44 80 80 00       	mov    %eax,0x808044
+  803357:	8b 46 04             	mov    0x4(%esi),%eax
+  80335a:	a3 48 80 80 00       	mov    %eax,0x808048
+  80335f:	8b 46 08             	mov    0x8(%esi),%eax
+  803362:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  803367:	8b 46 0c             	mov    0xc(%esi),%eax
+  80336a:	a3 50 80 80 00       	mov    %eax,0x808050
+  80336f:	8b 46 10             	mov    0x10(%esi),%eax
+  803372:	a3 54 80 80 00       	mov    %eax,0x808054
+  803377:	8b 46 14             	mov    0x14(%esi),%eax
+  80337a:	a3 58 80 80 00       	mov    %eax,0x808058
+  80337f:	8b 46 18             	mov    0x18(%esi),%eax
+  803382:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803387:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80338a:	a3 60 80 80 00       	mov    %eax,0x808060
+  80338f:	8b 46 20             	mov    0x20(%esi),%eax
+  803392:	a3 64 80 80 00       	mov    %eax,0x808064
+  803397:	8b 46 24             	mov    0x24(%esi),%eax
+  80339a:	a3 68 80 80 00       	mov    %eax,0x808068
+  80339f:	8b 46 28             	mov    0x28(%esi),%eax
+  8033a2:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8033a7:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8033aa:	a3 70 80 80 00       	mov    %eax,0x808070
+  8033af:	8b 46 30             	mov    0x30(%esi),%eax
+  8033b2:	a3 74 80 80 00       	mov    %eax,0x808074
+  8033b7:	8b 46 34             	mov    0x34(%esi),%eax
+  8033ba:	a3 78 80 80 00       	mov    %eax,0x808078
+  8033bf:	8b 46 38             	mov    0x38(%esi),%eax
+  8033c2:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8033c7:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8033ca:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8033cf:	8b 03                	mov    (%ebx),%eax
+  8033d1:	a3 84 80 80 00       	mov    %eax,0x808084
+  8033d6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033d9:	a3 88 80 80 00       	mov    %eax,0x808088
+  8033de:	8b 43 08             	mov    0x8(%ebx),%eax
+  8033e1:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8033e6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8033e9:	a3 90 80 80 00       	mov    %eax,0x808090
+  8033ee:	8b 43 10             	mov    0x10(%ebx),%eax
+  8033f1:	a3 94 80 80 00       	mov    %eax,0x808094
+  8033f6:	8b 43 14             	mov    0x14(%ebx),%eax
+  8033f9:	a3 98 80 80 00       	mov    %eax,0x808098
+  8033fe:	8b 43 18             	mov    0x18(%ebx),%eax
+  803401:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803406:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803409:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  80340e:	8b 43 20             	mov    0x20(%ebx),%eax
+  803411:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803416:	8b 43 24             	mov    0x24(%ebx),%eax
+  803419:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80341e:	8b 43 28             	mov    0x28(%ebx),%eax
+  803421:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803426:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803429:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  80342e:	8b 43 30             	mov    0x30(%ebx),%eax
+  803431:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803436:	8b 43 34             	mov    0x34(%ebx),%eax
+  803439:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80343e:	8b 43 38             	mov    0x38(%ebx),%eax
+  803441:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803446:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803449:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80344e:	8b 45 18             	mov    0x18(%ebp),%eax
+  803451:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803456:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80345b:	e8 2b f6 ff ff       	call   802a8b <nsipc>
+  803460:	85 c0                	test   %eax,%eax
+  803462:	0f 88 ad 01 00 00    	js     803615 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803468:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80346e:	89 17                	mov    %edx,(%edi)
+  803470:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803476:	89 57 04             	mov    %edx,0x4(%edi)
+  803479:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80347f:	89 57 08             	mov    %edx,0x8(%edi)
+  803482:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803488:	89 57 0c             	mov    %edx,0xc(%edi)
+  80348b:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803491:	89 57 10             	mov    %edx,0x10(%edi)
+  803494:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80349a:	89 57 14             	mov    %edx,0x14(%edi)
+  80349d:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8034a3:	89 57 18             	mov    %edx,0x18(%edi)
+  8034a6:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8034ac:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8034af:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8034b5:	89 57 20             	mov    %edx,0x20(%edi)
+  8034b8:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8034be:	89 57 24             	mov    %edx,0x24(%edi)
+  8034c1:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8034c7:	89 57 28             	mov    %edx,0x28(%edi)
+  8034ca:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8034d0:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8034d3:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8034d9:	89 57 30             	mov    %edx,0x30(%edi)
+  8034dc:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8034e2:	89 57 34             	mov    %edx,0x34(%edi)
+  8034e5:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8034eb:	89 57 38             	mov    %edx,0x38(%edi)
+  8034ee:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8034f4:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8034f7:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8034fd:	89 16                	mov    %edx,(%esi)
+  8034ff:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803505:	89 56 04             	mov    %edx,0x4(%esi)
+  803508:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  80350e:	89 56 08             	mov    %edx,0x8(%esi)
+  803511:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803517:	89 56 0c             	mov    %edx,0xc(%esi)
+  80351a:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  803520:	89 56 10             	mov    %edx,0x10(%esi)
+  803523:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803529:	89 56 14             	mov    %edx,0x14(%esi)
+  80352c:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803532:	89 56 18             	mov    %edx,0x18(%esi)
+  803535:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  80353b:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80353e:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803544:	89 56 20             	mov    %edx,0x20(%esi)
+  803547:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80354d:	89 56 24             	mov    %edx,0x24(%esi)
+  803550:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803556:	89 56 28             	mov    %edx,0x28(%esi)
+  803559:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  80355f:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803562:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  803568:	89 56 30             	mov    %edx,0x30(%esi)
+  80356b:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803571:	89 56 34             	mov    %edx,0x34(%esi)
+  803574:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80357a:	89 56 38             	mov    %edx,0x38(%esi)
+  80357d:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803583:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803586:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80358c:	89 13                	mov    %edx,(%ebx)
+  80358e:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803594:	89 53 04             	mov    %edx,0x4(%ebx)
+  803597:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80359d:	89 53 08             	mov    %edx,0x8(%ebx)
+  8035a0:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8035a6:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8035a9:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8035af:	89 53 10             	mov    %edx,0x10(%ebx)
+  8035b2:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8035b8:	89 53 14             	mov    %edx,0x14(%ebx)
+  8035bb:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8035c1:	89 53 18             	mov    %edx,0x18(%ebx)
+  8035c4:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8035ca:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8035cd:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8035d3:	89 53 20             	mov    %edx,0x20(%ebx)
+  8035d6:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8035dc:	89 53 24             	mov    %edx,0x24(%ebx)
+  8035df:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8035e5:	89 53 28             	mov    %edx,0x28(%ebx)
+  8035e8:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8035ee:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8035f1:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8035f7:	89 53 30             	mov    %edx,0x30(%ebx)
+  8035fa:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  803600:	89 53 34             	mov    %edx,0x34(%ebx)
+  803603:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803609:	89 53 38             	mov    %edx,0x38(%ebx)
+  80360c:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803612:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803615:	83 c4 0c             	add    $0xc,%esp
+  803618:	5b                   	pop    %ebx
+  803619:	5e                   	pop    %esi
+  80361a:	5f                   	pop    %edi
+  80361b:	5d                   	pop    %ebp
+  80361c:	c3                   	ret
+
+0080361d <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80361d:	55                   	push   %ebp
+  80361e:	89 e5                	mov    %esp,%ebp
+  803620:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803623:	8b 45 08             	mov    0x8(%ebp),%eax
+  803626:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  80362b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80362e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803633:	8b 45 10             	mov    0x10(%ebp),%eax
+  803636:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  80363b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803640:	e8 46 f4 ff ff       	call   802a8b <nsipc>
+}
+  803645:	c9                   	leave
+  803646:	c3                   	ret
+
+00803647 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803647:	55                   	push   %ebp
+  803648:	89 e5                	mov    %esp,%ebp
+  80364a:	56                   	push   %esi
+  80364b:	53                   	push   %ebx
+  80364c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  80364f:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803655:	8b 45 10             	mov    0x10(%ebp),%eax
+  803658:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80365d:	b8 10 00 00 00       	mov    $0x10,%eax
+  803662:	e8 24 f4 ff ff       	call   802a8b <nsipc>
+  803667:	89 c3                	mov    %eax,%ebx
+  803669:	85 c0                	test   %eax,%eax
+  80366b:	7e 1f                	jle    80368c <nsipc_evwait+0x45>
+		assert(r <= max);
+  80366d:	39 c6                	cmp    %eax,%esi
+  80366f:	7c 24                	jl     803695 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803671:	83 ec 04             	sub    $0x4,%esp
+  803674:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80367b:	50                   	push   %eax
+  80367c:	68 00 80 80 00       	push   $0x808000
+  803681:	ff 75 08             	push   0x8(%ebp)
+  803684:	e8 36 d5 ff ff       	call   800bbf <memmove>
+  803689:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80368c:	89 d8                	mov    %ebx,%eax
+  80368e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803691:	5b                   	pop    %ebx
+  803692:	5e                   	pop    %esi
+  803693:	5d                   	pop    %ebp
+  803694:	c3                   	ret
+		assert(r <= max);
+  803695:	68 aa 4b 80 00       	push   $0x804baa
+  80369a:	68 7d 4b 80 00       	push   $0x804b7d
+  80369f:	68 6a 01 00 00       	push   $0x16a
+  8036a4:	68 92 4b 80 00       	push   $0x804b92
+  8036a9:	e8 8f cb ff ff       	call   80023d <_panic>
+
+008036ae <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8036ae:	55                   	push   %ebp
+  8036af:	89 e5                	mov    %esp,%ebp
+  8036b1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8036b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036b7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8036bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036bf:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8036c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036c7:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8036cc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8036d1:	e8 b5 f3 ff ff       	call   802a8b <nsipc>
+}
+  8036d6:	c9                   	leave
+  8036d7:	c3                   	ret
+
+008036d8 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8036d8:	55                   	push   %ebp
+  8036d9:	89 e5                	mov    %esp,%ebp
+  8036db:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8036de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036e1:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8036e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8036eb:	e8 9b f3 ff ff       	call   802a8b <nsipc>
+}
+  8036f0:	c9                   	leave
+  8036f1:	c3                   	ret
+
+008036f2 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8036f2:	55                   	push   %ebp
+  8036f3:	89 e5                	mov    %esp,%ebp
+  8036f5:	53                   	push   %ebx
+  8036f6:	83 ec 04             	sub    $0x4,%esp
+  8036f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8036fc:	b8 12 00 00 00       	mov    $0x12,%eax
+  803701:	e8 85 f3 ff ff       	call   802a8b <nsipc>
+  803706:	85 c0                	test   %eax,%eax
+  803708:	78 50                	js     80375a <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  80370a:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  803710:	89 13                	mov    %edx,(%ebx)
+  803712:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803718:	89 53 04             	mov    %edx,0x4(%ebx)
+  80371b:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803721:	89 53 08             	mov    %edx,0x8(%ebx)
+  803724:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80372a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80372d:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803733:	89 53 10             	mov    %edx,0x10(%ebx)
+  803736:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80373c:	89 53 14             	mov    %edx,0x14(%ebx)
+  80373f:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803745:	89 53 18             	mov    %edx,0x18(%ebx)
+  803748:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80374e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803751:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803757:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80375a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80375d:	c9                   	leave
+  80375e:	c3                   	ret
+
+0080375f <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80375f:	55                   	push   %ebp
+  803760:	89 e5                	mov    %esp,%ebp
+  803762:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803765:	6a 03                	push   $0x3
+  803767:	e8 af e5 ff ff       	call   801d1b <ipc_find_env>
+  80376c:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803771:	8b 45 08             	mov    0x8(%ebp),%eax
+  803774:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803779:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80377e:	e8 08 f3 ff ff       	call   802a8b <nsipc>
+  803783:	83 c4 10             	add    $0x10,%esp
+  803786:	85 c0                	test   %eax,%eax
+  803788:	78 0a                	js     803794 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80378a:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  80378f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803794:	c9                   	leave
+  803795:	c3                   	ret
+
+00803796 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803796:	55                   	push   %ebp
+  803797:	89 e5                	mov    %esp,%ebp
+  803799:	57                   	push   %edi
+  80379a:	56                   	push   %esi
+  80379b:	53                   	push   %ebx
+  80379c:	83 ec 1c             	sub    $0x1c,%esp
+  80379f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8037a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8037a5:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8037aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037af:	89 e0                	mov    %esp,%eax
+  8037b1:	89 f2                	mov    %esi,%edx
+  8037b3:	29 c2                	sub    %eax,%edx
+  8037b5:	89 d0                	mov    %edx,%eax
+  8037b7:	c1 e8 0f             	shr    $0xf,%eax
+  8037ba:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8037c0:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8037c3:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8037ca:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8037cd:	83 ec 0c             	sub    $0xc,%esp
+  8037d0:	ff 75 e0             	push   -0x20(%ebp)
+  8037d3:	e8 a3 0b 00 00       	call   80437b <pageref>
+  8037d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037db:	83 c4 04             	add    $0x4,%esp
+  8037de:	ff 75 dc             	push   -0x24(%ebp)
+  8037e1:	e8 95 0b 00 00       	call   80437b <pageref>
+  8037e6:	89 e2                	mov    %esp,%edx
+  8037e8:	89 f1                	mov    %esi,%ecx
+  8037ea:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8037ec:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8037ef:	89 ca                	mov    %ecx,%edx
+  8037f1:	c1 ea 0f             	shr    $0xf,%edx
+  8037f4:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8037fa:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8037fd:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  803804:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803807:	39 d7                	cmp    %edx,%edi
+  803809:	74 40                	je     80384b <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  80380b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80380e:	75 9f                	jne    8037af <_pipeisclosed+0x19>
+  803810:	89 e2                	mov    %esp,%edx
+  803812:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803817:	29 d0                	sub    %edx,%eax
+  803819:	89 c2                	mov    %eax,%edx
+  80381b:	c1 ea 0f             	shr    $0xf,%edx
+  80381e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803823:	b8 00 00 00 00       	mov    $0x0,%eax
+  803828:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80382b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803832:	8b 40 58             	mov    0x58(%eax),%eax
+  803835:	6a 01                	push   $0x1
+  803837:	50                   	push   %eax
+  803838:	57                   	push   %edi
+  803839:	68 b3 4b 80 00       	push   $0x804bb3
+  80383e:	e8 d5 ca ff ff       	call   800318 <cprintf>
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	e9 5f ff ff ff       	jmp    8037aa <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80384b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80384e:	0f 94 c0             	sete   %al
+  803851:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803857:	5b                   	pop    %ebx
+  803858:	5e                   	pop    %esi
+  803859:	5f                   	pop    %edi
+  80385a:	5d                   	pop    %ebp
+  80385b:	c3                   	ret
+
+0080385c <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80385c:	55                   	push   %ebp
+  80385d:	89 e5                	mov    %esp,%ebp
+  80385f:	53                   	push   %ebx
+  803860:	83 ec 0c             	sub    $0xc,%esp
+  803863:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803866:	53                   	push   %ebx
+  803867:	6a 00                	push   $0x0
+  803869:	e8 5a d6 ff ff       	call   800ec8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80386e:	89 1c 24             	mov    %ebx,(%esp)
+  803871:	e8 f4 e4 ff ff       	call   801d6a <fd2data>
+  803876:	83 c4 08             	add    $0x8,%esp
+  803879:	50                   	push   %eax
+  80387a:	6a 00                	push   $0x0
+  80387c:	e8 47 d6 ff ff       	call   800ec8 <sys_page_unmap>
+}
+  803881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803884:	c9                   	leave
+  803885:	c3                   	ret
+
+00803886 <devpipe_read>:
+{
+  803886:	55                   	push   %ebp
+  803887:	89 e5                	mov    %esp,%ebp
+  803889:	57                   	push   %edi
+  80388a:	56                   	push   %esi
+  80388b:	53                   	push   %ebx
+  80388c:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80388f:	ff 75 08             	push   0x8(%ebp)
+  803892:	e8 d3 e4 ff ff       	call   801d6a <fd2data>
+  803897:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803899:	8b 70 04             	mov    0x4(%eax),%esi
+  80389c:	8b 00                	mov    (%eax),%eax
+  80389e:	83 c4 10             	add    $0x10,%esp
+  8038a1:	39 f0                	cmp    %esi,%eax
+  8038a3:	75 36                	jne    8038db <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8038a5:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8038a8:	89 da                	mov    %ebx,%edx
+  8038aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038ad:	e8 e4 fe ff ff       	call   803796 <_pipeisclosed>
+  8038b2:	85 c0                	test   %eax,%eax
+  8038b4:	0f 85 d4 00 00 00    	jne    80398e <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8038ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038bf:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8038c3:	83 ec 04             	sub    $0x4,%esp
+  8038c6:	6a ff                	push   $0xffffffff
+  8038c8:	56                   	push   %esi
+  8038c9:	57                   	push   %edi
+  8038ca:	e8 72 d9 ff ff       	call   801241 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8038cf:	8b 73 04             	mov    0x4(%ebx),%esi
+  8038d2:	8b 03                	mov    (%ebx),%eax
+  8038d4:	83 c4 10             	add    $0x10,%esp
+  8038d7:	39 c6                	cmp    %eax,%esi
+  8038d9:	74 cd                	je     8038a8 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038db:	8b 73 04             	mov    0x4(%ebx),%esi
+  8038de:	8b 03                	mov    (%ebx),%eax
+  8038e0:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8038e6:	29 c6                	sub    %eax,%esi
+  8038e8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038ed:	f7 e6                	mul    %esi
+  8038ef:	c1 ea 0c             	shr    $0xc,%edx
+  8038f2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038f8:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8038fa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8038fd:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803901:	8b 0b                	mov    (%ebx),%ecx
+  803903:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803908:	f7 e1                	mul    %ecx
+  80390a:	c1 ea 0b             	shr    $0xb,%edx
+  80390d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803913:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803915:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80391a:	29 cf                	sub    %ecx,%edi
+  80391c:	39 f7                	cmp    %esi,%edi
+  80391e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803921:	83 ec 04             	sub    $0x4,%esp
+  803924:	57                   	push   %edi
+  803925:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803929:	50                   	push   %eax
+  80392a:	ff 75 0c             	push   0xc(%ebp)
+  80392d:	e8 8d d2 ff ff       	call   800bbf <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803932:	83 c4 0c             	add    $0xc,%esp
+  803935:	89 f0                	mov    %esi,%eax
+  803937:	29 f8                	sub    %edi,%eax
+  803939:	50                   	push   %eax
+  80393a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80393d:	50                   	push   %eax
+  80393e:	89 f8                	mov    %edi,%eax
+  803940:	03 45 0c             	add    0xc(%ebp),%eax
+  803943:	50                   	push   %eax
+  803944:	e8 76 d2 ff ff       	call   800bbf <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803949:	8b 0b                	mov    (%ebx),%ecx
+  80394b:	01 f1                	add    %esi,%ecx
+  80394d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803952:	f7 e1                	mul    %ecx
+  803954:	c1 ea 0c             	shr    $0xc,%edx
+  803957:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80395d:	29 c1                	sub    %eax,%ecx
+  80395f:	89 0b                	mov    %ecx,(%ebx)
+  803961:	b8 00 00 00 00       	mov    $0x0,%eax
+  803966:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80396a:	83 c4 10             	add    $0x10,%esp
+  80396d:	85 c0                	test   %eax,%eax
+  80396f:	75 0a                	jne    80397b <devpipe_read+0xf5>
+	return n;
+  803971:	89 f0                	mov    %esi,%eax
+}
+  803973:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803976:	5b                   	pop    %ebx
+  803977:	5e                   	pop    %esi
+  803978:	5f                   	pop    %edi
+  803979:	5d                   	pop    %ebp
+  80397a:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80397b:	83 ec 08             	sub    $0x8,%esp
+  80397e:	68 00 04 00 00       	push   $0x400
+  803983:	53                   	push   %ebx
+  803984:	e8 da d8 ff ff       	call   801263 <sys_futex_wake>
+  803989:	83 c4 10             	add    $0x10,%esp
+  80398c:	eb e3                	jmp    803971 <devpipe_read+0xeb>
+			return 0;
+  80398e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803993:	eb de                	jmp    803973 <devpipe_read+0xed>
+
+00803995 <devpipe_write>:
+{
+  803995:	55                   	push   %ebp
+  803996:	89 e5                	mov    %esp,%ebp
+  803998:	57                   	push   %edi
+  803999:	56                   	push   %esi
+  80399a:	53                   	push   %ebx
+  80399b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80399e:	ff 75 08             	push   0x8(%ebp)
+  8039a1:	e8 c4 e3 ff ff       	call   801d6a <fd2data>
+  8039a6:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8039a8:	83 c4 10             	add    $0x10,%esp
+  8039ab:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039b2:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8039b7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039bb:	0f 84 43 01 00 00    	je     803b04 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039c1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039c4:	8b 06                	mov    (%esi),%eax
+  8039c6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039cc:	29 c1                	sub    %eax,%ecx
+  8039ce:	89 c8                	mov    %ecx,%eax
+  8039d0:	f7 e7                	mul    %edi
+  8039d2:	c1 ea 0c             	shr    $0xc,%edx
+  8039d5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039db:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8039dd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8039e3:	75 52                	jne    803a37 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8039e5:	89 f2                	mov    %esi,%edx
+  8039e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ea:	e8 a7 fd ff ff       	call   803796 <_pipeisclosed>
+  8039ef:	85 c0                	test   %eax,%eax
+  8039f1:	0f 85 28 01 00 00    	jne    803b1f <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8039f7:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039f9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039fc:	8b 06                	mov    (%esi),%eax
+  8039fe:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a04:	29 c1                	sub    %eax,%ecx
+  803a06:	89 c8                	mov    %ecx,%eax
+  803a08:	f7 e7                	mul    %edi
+  803a0a:	c1 ea 0c             	shr    $0xc,%edx
+  803a0d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a13:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803a15:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803a1b:	75 a4                	jne    8039c1 <devpipe_write+0x2c>
+  803a1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a22:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803a26:	83 ec 04             	sub    $0x4,%esp
+  803a29:	6a ff                	push   $0xffffffff
+  803a2b:	53                   	push   %ebx
+  803a2c:	56                   	push   %esi
+  803a2d:	e8 0f d8 ff ff       	call   801241 <sys_futex_wait>
+}
+  803a32:	83 c4 10             	add    $0x10,%esp
+  803a35:	eb 8a                	jmp    8039c1 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a37:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a3a:	8b 06                	mov    (%esi),%eax
+  803a3c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a42:	29 c1                	sub    %eax,%ecx
+  803a44:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a49:	f7 e1                	mul    %ecx
+  803a4b:	c1 ea 0c             	shr    $0xc,%edx
+  803a4e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a54:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803a56:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803a5b:	89 d8                	mov    %ebx,%eax
+  803a5d:	29 c8                	sub    %ecx,%eax
+  803a5f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a62:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a65:	29 ca                	sub    %ecx,%edx
+  803a67:	39 d0                	cmp    %edx,%eax
+  803a69:	0f 46 d0             	cmovbe %eax,%edx
+  803a6c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803a6f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a72:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a77:	f7 e1                	mul    %ecx
+  803a79:	c1 ea 0b             	shr    $0xb,%edx
+  803a7c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803a82:	89 ca                	mov    %ecx,%edx
+  803a84:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803a86:	29 d3                	sub    %edx,%ebx
+  803a88:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a8b:	39 c3                	cmp    %eax,%ebx
+  803a8d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803a90:	83 ec 04             	sub    $0x4,%esp
+  803a93:	53                   	push   %ebx
+  803a94:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a97:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803a9a:	51                   	push   %ecx
+  803a9b:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803a9f:	50                   	push   %eax
+  803aa0:	e8 1a d1 ff ff       	call   800bbf <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803aa5:	83 c4 0c             	add    $0xc,%esp
+  803aa8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803aab:	29 d8                	sub    %ebx,%eax
+  803aad:	50                   	push   %eax
+  803aae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803ab1:	01 cb                	add    %ecx,%ebx
+  803ab3:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803ab6:	53                   	push   %ebx
+  803ab7:	8d 46 10             	lea    0x10(%esi),%eax
+  803aba:	50                   	push   %eax
+  803abb:	e8 ff d0 ff ff       	call   800bbf <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803ac0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803ac3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803ac6:	01 c1                	add    %eax,%ecx
+  803ac8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803acd:	f7 e1                	mul    %ecx
+  803acf:	c1 ea 0c             	shr    $0xc,%edx
+  803ad2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803ad8:	89 ca                	mov    %ecx,%edx
+  803ada:	29 c2                	sub    %eax,%edx
+  803adc:	89 56 04             	mov    %edx,0x4(%esi)
+  803adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae4:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803ae8:	83 c4 10             	add    $0x10,%esp
+  803aeb:	85 c0                	test   %eax,%eax
+  803aed:	75 1a                	jne    803b09 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803aef:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803af2:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803af5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803af8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803afb:	0f 82 c0 fe ff ff    	jb     8039c1 <devpipe_write+0x2c>
+  803b01:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803b04:	8b 45 10             	mov    0x10(%ebp),%eax
+  803b07:	eb 1b                	jmp    803b24 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803b09:	83 ec 08             	sub    $0x8,%esp
+  803b0c:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803b11:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803b14:	50                   	push   %eax
+  803b15:	e8 49 d7 ff ff       	call   801263 <sys_futex_wake>
+  803b1a:	83 c4 10             	add    $0x10,%esp
+  803b1d:	eb d0                	jmp    803aef <devpipe_write+0x15a>
+				return 0;
+  803b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b27:	5b                   	pop    %ebx
+  803b28:	5e                   	pop    %esi
+  803b29:	5f                   	pop    %edi
+  803b2a:	5d                   	pop    %ebp
+  803b2b:	c3                   	ret
+
+00803b2c <devpipe_stat>:
+{
+  803b2c:	55                   	push   %ebp
+  803b2d:	89 e5                	mov    %esp,%ebp
+  803b2f:	56                   	push   %esi
+  803b30:	53                   	push   %ebx
+  803b31:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b34:	83 ec 0c             	sub    $0xc,%esp
+  803b37:	ff 75 08             	push   0x8(%ebp)
+  803b3a:	e8 2b e2 ff ff       	call   801d6a <fd2data>
+  803b3f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803b41:	83 c4 08             	add    $0x8,%esp
+  803b44:	68 c6 4b 80 00       	push   $0x804bc6
+  803b49:	53                   	push   %ebx
+  803b4a:	e8 c0 ce ff ff       	call   800a0f <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b4f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b52:	8b 06                	mov    (%esi),%eax
+  803b54:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b5a:	29 c1                	sub    %eax,%ecx
+  803b5c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b61:	89 c8                	mov    %ecx,%eax
+  803b63:	f7 e2                	mul    %edx
+  803b65:	c1 ea 0c             	shr    $0xc,%edx
+  803b68:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b6e:	29 d1                	sub    %edx,%ecx
+  803b70:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803b76:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803b7d:	00 00 00 
+	stat->st_dev = &devpipe;
+  803b80:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803b87:	50 80 00 
+}
+  803b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b92:	5b                   	pop    %ebx
+  803b93:	5e                   	pop    %esi
+  803b94:	5d                   	pop    %ebp
+  803b95:	c3                   	ret
+
+00803b96 <devpipe_poll>:
+{
+  803b96:	55                   	push   %ebp
+  803b97:	89 e5                	mov    %esp,%ebp
+  803b99:	57                   	push   %edi
+  803b9a:	56                   	push   %esi
+  803b9b:	53                   	push   %ebx
+  803b9c:	83 ec 18             	sub    $0x18,%esp
+  803b9f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803ba2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803ba5:	57                   	push   %edi
+  803ba6:	e8 bf e1 ff ff       	call   801d6a <fd2data>
+  803bab:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803bad:	83 c4 10             	add    $0x10,%esp
+  803bb0:	89 f3                	mov    %esi,%ebx
+  803bb2:	83 e3 01             	and    $0x1,%ebx
+  803bb5:	75 27                	jne    803bde <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803bb7:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803bbd:	75 48                	jne    803c07 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803bbf:	89 ca                	mov    %ecx,%edx
+  803bc1:	89 f8                	mov    %edi,%eax
+  803bc3:	e8 ce fb ff ff       	call   803796 <_pipeisclosed>
+  803bc8:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803bca:	89 d8                	mov    %ebx,%eax
+  803bcc:	83 c8 10             	or     $0x10,%eax
+  803bcf:	85 d2                	test   %edx,%edx
+  803bd1:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803bd4:	89 d8                	mov    %ebx,%eax
+  803bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bd9:	5b                   	pop    %ebx
+  803bda:	5e                   	pop    %esi
+  803bdb:	5f                   	pop    %edi
+  803bdc:	5d                   	pop    %ebp
+  803bdd:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803bde:	8b 58 04             	mov    0x4(%eax),%ebx
+  803be1:	8b 00                	mov    (%eax),%eax
+  803be3:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803be9:	29 c3                	sub    %eax,%ebx
+  803beb:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803bf0:	89 d8                	mov    %ebx,%eax
+  803bf2:	f7 e2                	mul    %edx
+  803bf4:	c1 ea 0c             	shr    $0xc,%edx
+  803bf7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803bfd:	39 d3                	cmp    %edx,%ebx
+  803bff:	0f 95 c3             	setne  %bl
+  803c02:	0f b6 db             	movzbl %bl,%ebx
+  803c05:	eb b0                	jmp    803bb7 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803c07:	8b 71 04             	mov    0x4(%ecx),%esi
+  803c0a:	8b 01                	mov    (%ecx),%eax
+  803c0c:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803c12:	29 c6                	sub    %eax,%esi
+  803c14:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803c19:	89 f0                	mov    %esi,%eax
+  803c1b:	f7 e2                	mul    %edx
+  803c1d:	c1 ea 0c             	shr    $0xc,%edx
+  803c20:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803c26:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803c28:	89 d8                	mov    %ebx,%eax
+  803c2a:	83 c8 04             	or     $0x4,%eax
+  803c2d:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803c33:	0f 42 d8             	cmovb  %eax,%ebx
+  803c36:	eb 87                	jmp    803bbf <devpipe_poll+0x29>
+
+00803c38 <pipe>:
+{
+  803c38:	55                   	push   %ebp
+  803c39:	89 e5                	mov    %esp,%ebp
+  803c3b:	56                   	push   %esi
+  803c3c:	53                   	push   %ebx
+  803c3d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803c40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c43:	50                   	push   %eax
+  803c44:	e8 38 e1 ff ff       	call   801d81 <fd_alloc>
+  803c49:	89 c3                	mov    %eax,%ebx
+  803c4b:	83 c4 10             	add    $0x10,%esp
+  803c4e:	85 c0                	test   %eax,%eax
+  803c50:	0f 88 23 01 00 00    	js     803d79 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c56:	83 ec 04             	sub    $0x4,%esp
+  803c59:	68 07 04 00 00       	push   $0x407
+  803c5e:	ff 75 f4             	push   -0xc(%ebp)
+  803c61:	6a 00                	push   $0x0
+  803c63:	e8 db d1 ff ff       	call   800e43 <sys_page_alloc>
+  803c68:	89 c3                	mov    %eax,%ebx
+  803c6a:	83 c4 10             	add    $0x10,%esp
+  803c6d:	85 c0                	test   %eax,%eax
+  803c6f:	0f 88 04 01 00 00    	js     803d79 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803c75:	83 ec 0c             	sub    $0xc,%esp
+  803c78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803c7b:	50                   	push   %eax
+  803c7c:	e8 00 e1 ff ff       	call   801d81 <fd_alloc>
+  803c81:	89 c3                	mov    %eax,%ebx
+  803c83:	83 c4 10             	add    $0x10,%esp
+  803c86:	85 c0                	test   %eax,%eax
+  803c88:	0f 88 db 00 00 00    	js     803d69 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c8e:	83 ec 04             	sub    $0x4,%esp
+  803c91:	68 07 04 00 00       	push   $0x407
+  803c96:	ff 75 f0             	push   -0x10(%ebp)
+  803c99:	6a 00                	push   $0x0
+  803c9b:	e8 a3 d1 ff ff       	call   800e43 <sys_page_alloc>
+  803ca0:	89 c3                	mov    %eax,%ebx
+  803ca2:	83 c4 10             	add    $0x10,%esp
+  803ca5:	85 c0                	test   %eax,%eax
+  803ca7:	0f 88 bc 00 00 00    	js     803d69 <pipe+0x131>
+	va = fd2data(fd0);
+  803cad:	83 ec 0c             	sub    $0xc,%esp
+  803cb0:	ff 75 f4             	push   -0xc(%ebp)
+  803cb3:	e8 b2 e0 ff ff       	call   801d6a <fd2data>
+  803cb8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803cba:	83 c4 0c             	add    $0xc,%esp
+  803cbd:	68 07 04 00 00       	push   $0x407
+  803cc2:	50                   	push   %eax
+  803cc3:	6a 00                	push   $0x0
+  803cc5:	e8 79 d1 ff ff       	call   800e43 <sys_page_alloc>
+  803cca:	89 c3                	mov    %eax,%ebx
+  803ccc:	83 c4 10             	add    $0x10,%esp
+  803ccf:	85 c0                	test   %eax,%eax
+  803cd1:	0f 88 82 00 00 00    	js     803d59 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803cd7:	83 ec 0c             	sub    $0xc,%esp
+  803cda:	ff 75 f0             	push   -0x10(%ebp)
+  803cdd:	e8 88 e0 ff ff       	call   801d6a <fd2data>
+  803ce2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803ce9:	50                   	push   %eax
+  803cea:	6a 00                	push   $0x0
+  803cec:	56                   	push   %esi
+  803ced:	6a 00                	push   $0x0
+  803cef:	e8 92 d1 ff ff       	call   800e86 <sys_page_map>
+  803cf4:	89 c3                	mov    %eax,%ebx
+  803cf6:	83 c4 20             	add    $0x20,%esp
+  803cf9:	85 c0                	test   %eax,%eax
+  803cfb:	78 4e                	js     803d4b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803cfd:	a1 60 50 80 00       	mov    0x805060,%eax
+  803d02:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803d05:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803d07:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803d0a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803d11:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803d14:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803d16:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803d19:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803d20:	83 ec 0c             	sub    $0xc,%esp
+  803d23:	ff 75 f4             	push   -0xc(%ebp)
+  803d26:	e8 2f e0 ff ff       	call   801d5a <fd2num>
+  803d2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d2e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803d30:	83 c4 04             	add    $0x4,%esp
+  803d33:	ff 75 f0             	push   -0x10(%ebp)
+  803d36:	e8 1f e0 ff ff       	call   801d5a <fd2num>
+  803d3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d3e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803d41:	83 c4 10             	add    $0x10,%esp
+  803d44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d49:	eb 2e                	jmp    803d79 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803d4b:	83 ec 08             	sub    $0x8,%esp
+  803d4e:	56                   	push   %esi
+  803d4f:	6a 00                	push   $0x0
+  803d51:	e8 72 d1 ff ff       	call   800ec8 <sys_page_unmap>
+  803d56:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803d59:	83 ec 08             	sub    $0x8,%esp
+  803d5c:	ff 75 f0             	push   -0x10(%ebp)
+  803d5f:	6a 00                	push   $0x0
+  803d61:	e8 62 d1 ff ff       	call   800ec8 <sys_page_unmap>
+  803d66:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803d69:	83 ec 08             	sub    $0x8,%esp
+  803d6c:	ff 75 f4             	push   -0xc(%ebp)
+  803d6f:	6a 00                	push   $0x0
+  803d71:	e8 52 d1 ff ff       	call   800ec8 <sys_page_unmap>
+  803d76:	83 c4 10             	add    $0x10,%esp
+}
+  803d79:	89 d8                	mov    %ebx,%eax
+  803d7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d7e:	5b                   	pop    %ebx
+  803d7f:	5e                   	pop    %esi
+  803d80:	5d                   	pop    %ebp
+  803d81:	c3                   	ret
+
+00803d82 <pipeisclosed>:
+{
+  803d82:	55                   	push   %ebp
+  803d83:	89 e5                	mov    %esp,%ebp
+  803d85:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d8b:	50                   	push   %eax
+  803d8c:	ff 75 08             	push   0x8(%ebp)
+  803d8f:	e8 3d e0 ff ff       	call   801dd1 <fd_lookup>
+  803d94:	83 c4 10             	add    $0x10,%esp
+  803d97:	85 c0                	test   %eax,%eax
+  803d99:	78 18                	js     803db3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803d9b:	83 ec 0c             	sub    $0xc,%esp
+  803d9e:	ff 75 f4             	push   -0xc(%ebp)
+  803da1:	e8 c4 df ff ff       	call   801d6a <fd2data>
+  803da6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803da8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dab:	e8 e6 f9 ff ff       	call   803796 <_pipeisclosed>
+  803db0:	83 c4 10             	add    $0x10,%esp
+}
+  803db3:	c9                   	leave
+  803db4:	c3                   	ret
+
+00803db5 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803db5:	55                   	push   %ebp
+  803db6:	89 e5                	mov    %esp,%ebp
+  803db8:	56                   	push   %esi
+  803db9:	53                   	push   %ebx
+  803dba:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803dbd:	85 f6                	test   %esi,%esi
+  803dbf:	74 40                	je     803e01 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803dc1:	89 f3                	mov    %esi,%ebx
+  803dc3:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803dc9:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803dcf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803dd4:	8b 40 48             	mov    0x48(%eax),%eax
+  803dd7:	39 c6                	cmp    %eax,%esi
+  803dd9:	75 1f                	jne    803dfa <wait+0x45>
+  803ddb:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803de1:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803de7:	8b 43 54             	mov    0x54(%ebx),%eax
+  803dea:	85 c0                	test   %eax,%eax
+  803dec:	74 0c                	je     803dfa <wait+0x45>
+		sys_yield();
+  803dee:	e8 31 d0 ff ff       	call   800e24 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803df3:	8b 43 48             	mov    0x48(%ebx),%eax
+  803df6:	39 f0                	cmp    %esi,%eax
+  803df8:	74 ed                	je     803de7 <wait+0x32>
+}
+  803dfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dfd:	5b                   	pop    %ebx
+  803dfe:	5e                   	pop    %esi
+  803dff:	5d                   	pop    %ebp
+  803e00:	c3                   	ret
+	assert(envid != 0);
+  803e01:	68 d2 4b 80 00       	push   $0x804bd2
+  803e06:	68 7d 4b 80 00       	push   $0x804b7d
+  803e0b:	6a 09                	push   $0x9
+  803e0d:	68 dd 4b 80 00       	push   $0x804bdd
+  803e12:	e8 26 c4 ff ff       	call   80023d <_panic>
+
+00803e17 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803e17:	55                   	push   %ebp
+  803e18:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e1d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e23:	5d                   	pop    %ebp
+  803e24:	c3                   	ret
+
+00803e25 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803e25:	55                   	push   %ebp
+  803e26:	89 e5                	mov    %esp,%ebp
+  803e28:	53                   	push   %ebx
+  803e29:	83 ec 04             	sub    $0x4,%esp
+  803e2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803e2f:	8b 03                	mov    (%ebx),%eax
+  803e31:	85 c0                	test   %eax,%eax
+  803e33:	75 05                	jne    803e3a <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e38:	c9                   	leave
+  803e39:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803e3a:	83 ec 08             	sub    $0x8,%esp
+  803e3d:	50                   	push   %eax
+  803e3e:	8d 43 04             	lea    0x4(%ebx),%eax
+  803e41:	50                   	push   %eax
+  803e42:	e8 d1 d2 ff ff       	call   801118 <sys_page_batch>
+	pb->pb_n = 0;
+  803e47:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803e4d:	83 c4 10             	add    $0x10,%esp
+  803e50:	eb e3                	jmp    803e35 <pgbatch_flush+0x10>
+
+00803e52 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803e52:	55                   	push   %ebp
+  803e53:	89 e5                	mov    %esp,%ebp
+  803e55:	56                   	push   %esi
+  803e56:	53                   	push   %ebx
+  803e57:	89 c3                	mov    %eax,%ebx
+  803e59:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803e5b:	83 38 20             	cmpl   $0x20,(%eax)
+  803e5e:	74 2c                	je     803e8c <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803e60:	8b 03                	mov    (%ebx),%eax
+  803e62:	8d 50 01             	lea    0x1(%eax),%edx
+  803e65:	89 13                	mov    %edx,(%ebx)
+  803e67:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803e6a:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803e6e:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803e70:	83 ec 04             	sub    $0x4,%esp
+  803e73:	6a 18                	push   $0x18
+  803e75:	6a 00                	push   $0x0
+  803e77:	50                   	push   %eax
+  803e78:	e8 0d cd ff ff       	call   800b8a <memset>
+	return 0;
+  803e7d:	83 c4 10             	add    $0x10,%esp
+  803e80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e88:	5b                   	pop    %ebx
+  803e89:	5e                   	pop    %esi
+  803e8a:	5d                   	pop    %ebp
+  803e8b:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803e8c:	83 ec 0c             	sub    $0xc,%esp
+  803e8f:	50                   	push   %eax
+  803e90:	e8 90 ff ff ff       	call   803e25 <pgbatch_flush>
+  803e95:	83 c4 10             	add    $0x10,%esp
+  803e98:	85 c0                	test   %eax,%eax
+  803e9a:	79 c4                	jns    803e60 <pgbatch_slot+0xe>
+  803e9c:	eb e7                	jmp    803e85 <pgbatch_slot+0x33>
+
+00803e9e <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803e9e:	55                   	push   %ebp
+  803e9f:	89 e5                	mov    %esp,%ebp
+  803ea1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ea4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eaa:	e8 a3 ff ff ff       	call   803e52 <pgbatch_slot>
+  803eaf:	85 c0                	test   %eax,%eax
+  803eb1:	78 20                	js     803ed3 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803eb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803eb6:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803ebc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ebf:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803ec2:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ec5:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ec8:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ecb:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803ece:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed3:	c9                   	leave
+  803ed4:	c3                   	ret
+
+00803ed5 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803ed5:	55                   	push   %ebp
+  803ed6:	89 e5                	mov    %esp,%ebp
+  803ed8:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803edb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ee1:	e8 6c ff ff ff       	call   803e52 <pgbatch_slot>
+  803ee6:	85 c0                	test   %eax,%eax
+  803ee8:	78 2c                	js     803f16 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803eea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803eed:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803ef3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ef6:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803ef9:	8b 55 10             	mov    0x10(%ebp),%edx
+  803efc:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803eff:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f02:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803f05:	8b 55 18             	mov    0x18(%ebp),%edx
+  803f08:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803f0b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803f0e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f16:	c9                   	leave
+  803f17:	c3                   	ret
+
+00803f18 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803f18:	55                   	push   %ebp
+  803f19:	89 e5                	mov    %esp,%ebp
+  803f1b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f1e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f21:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f24:	e8 29 ff ff ff       	call   803e52 <pgbatch_slot>
+  803f29:	85 c0                	test   %eax,%eax
+  803f2b:	78 1a                	js     803f47 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803f2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f30:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803f36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f39:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f3c:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f3f:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803f42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f47:	c9                   	leave
+  803f48:	c3                   	ret
+
+00803f49 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803f49:	55                   	push   %ebp
+  803f4a:	89 e5                	mov    %esp,%ebp
+  803f4c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f4f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f52:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f55:	e8 f8 fe ff ff       	call   803e52 <pgbatch_slot>
+  803f5a:	85 c0                	test   %eax,%eax
+  803f5c:	78 20                	js     803f7e <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803f5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f61:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803f67:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f6a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f70:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803f73:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f76:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f7e:	c9                   	leave
+  803f7f:	c3                   	ret
+
+00803f80 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803f80:	55                   	push   %ebp
+  803f81:	89 e5                	mov    %esp,%ebp
+  803f83:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f86:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f89:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f8c:	e8 c1 fe ff ff       	call   803e52 <pgbatch_slot>
+  803f91:	85 c0                	test   %eax,%eax
+  803f93:	78 26                	js     803fbb <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803f95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f98:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803f9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fa1:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803fa4:	8b 55 10             	mov    0x10(%ebp),%edx
+  803fa7:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803faa:	8b 55 14             	mov    0x14(%ebp),%edx
+  803fad:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803fb0:	8b 55 18             	mov    0x18(%ebp),%edx
+  803fb3:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fbb:	c9                   	leave
+  803fbc:	c3                   	ret
+
+00803fbd <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803fbd:	55                   	push   %ebp
+  803fbe:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803fc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fc3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803fc9:	5d                   	pop    %ebp
+  803fca:	c3                   	ret
+
+00803fcb <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803fcb:	55                   	push   %ebp
+  803fcc:	89 e5                	mov    %esp,%ebp
+  803fce:	56                   	push   %esi
+  803fcf:	53                   	push   %ebx
+  803fd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd8:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fdd:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803fe1:	85 c0                	test   %eax,%eax
+  803fe3:	74 2f                	je     804014 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803fe5:	83 f8 02             	cmp    $0x2,%eax
+  803fe8:	74 0c                	je     803ff6 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803fea:	b8 02 00 00 00       	mov    $0x2,%eax
+  803fef:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803ff2:	85 c0                	test   %eax,%eax
+  803ff4:	74 1e                	je     804014 <mutex_lock+0x49>
+  803ff6:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803ffb:	83 ec 04             	sub    $0x4,%esp
+  803ffe:	6a ff                	push   $0xffffffff
+  804000:	6a 02                	push   $0x2
+  804002:	53                   	push   %ebx
+  804003:	e8 39 d2 ff ff       	call   801241 <sys_futex_wait>
+  804008:	89 f0                	mov    %esi,%eax
+  80400a:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  80400d:	83 c4 10             	add    $0x10,%esp
+  804010:	85 c0                	test   %eax,%eax
+  804012:	75 e7                	jne    803ffb <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804014:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804017:	5b                   	pop    %ebx
+  804018:	5e                   	pop    %esi
+  804019:	5d                   	pop    %ebp
+  80401a:	c3                   	ret
+
+0080401b <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  80401b:	55                   	push   %ebp
+  80401c:	89 e5                	mov    %esp,%ebp
+  80401e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804021:	b8 00 00 00 00       	mov    $0x0,%eax
+  804026:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80402b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  80402f:	85 c0                	test   %eax,%eax
+  804031:	0f 94 c0             	sete   %al
+  804034:	0f b6 c0             	movzbl %al,%eax
+}
+  804037:	5d                   	pop    %ebp
+  804038:	c3                   	ret
+
+00804039 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804039:	55                   	push   %ebp
+  80403a:	89 e5                	mov    %esp,%ebp
+  80403c:	83 ec 08             	sub    $0x8,%esp
+  80403f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  804042:	b8 00 00 00 00       	mov    $0x0,%eax
+  804047:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80404a:	83 f8 02             	cmp    $0x2,%eax
+  80404d:	74 02                	je     804051 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80404f:	c9                   	leave
+  804050:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804051:	83 ec 08             	sub    $0x8,%esp
+  804054:	6a 01                	push   $0x1
+  804056:	52                   	push   %edx
+  804057:	e8 07 d2 ff ff       	call   801263 <sys_futex_wake>
+  80405c:	83 c4 10             	add    $0x10,%esp
+}
+  80405f:	eb ee                	jmp    80404f <mutex_unlock+0x16>
+
+00804061 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  804061:	55                   	push   %ebp
+  804062:	89 e5                	mov    %esp,%ebp
+  804064:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  804067:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  80406d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804074:	5d                   	pop    %ebp
+  804075:	c3                   	ret
+
+00804076 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  804076:	55                   	push   %ebp
+  804077:	89 e5                	mov    %esp,%ebp
+  804079:	57                   	push   %edi
+  80407a:	56                   	push   %esi
+  80407b:	53                   	push   %ebx
+  80407c:	83 ec 18             	sub    $0x18,%esp
+  80407f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804082:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  804085:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  804087:	b8 01 00 00 00       	mov    $0x1,%eax
+  80408c:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804091:	57                   	push   %edi
+  804092:	e8 a2 ff ff ff       	call   804039 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804097:	83 c4 0c             	add    $0xc,%esp
+  80409a:	ff 75 10             	push   0x10(%ebp)
+  80409d:	56                   	push   %esi
+  80409e:	53                   	push   %ebx
+  80409f:	e8 9d d1 ff ff       	call   801241 <sys_futex_wait>
+  8040a4:	89 c6                	mov    %eax,%esi
+  8040a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8040ab:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  8040b0:	89 3c 24             	mov    %edi,(%esp)
+  8040b3:	e8 13 ff ff ff       	call   803fcb <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  8040b8:	83 c4 10             	add    $0x10,%esp
+  8040bb:	83 fe ef             	cmp    $0xffffffef,%esi
+  8040be:	74 05                	je     8040c5 <cond_timedwait+0x4f>
+  8040c0:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8040c5:	89 f0                	mov    %esi,%eax
+  8040c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040ca:	5b                   	pop    %ebx
+  8040cb:	5e                   	pop    %esi
+  8040cc:	5f                   	pop    %edi
+  8040cd:	5d                   	pop    %ebp
+  8040ce:	c3                   	ret
+
+008040cf <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8040cf:	55                   	push   %ebp
+  8040d0:	89 e5                	mov    %esp,%ebp
+  8040d2:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  8040d5:	6a ff                	push   $0xffffffff
+  8040d7:	ff 75 0c             	push   0xc(%ebp)
+  8040da:	ff 75 08             	push   0x8(%ebp)
+  8040dd:	e8 94 ff ff ff       	call   804076 <cond_timedwait>
+}
+  8040e2:	83 c4 10             	add    $0x10,%esp
+  8040e5:	c9                   	leave
+  8040e6:	c3                   	ret
+
+008040e7 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8040e7:	55                   	push   %ebp
+  8040e8:	89 e5                	mov    %esp,%ebp
+  8040ea:	83 ec 08             	sub    $0x8,%esp
+  8040ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040f0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040f5:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8040f9:	8b 50 04             	mov    0x4(%eax),%edx
+  8040fc:	85 d2                	test   %edx,%edx
+  8040fe:	75 02                	jne    804102 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  804100:	c9                   	leave
+  804101:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804102:	83 ec 08             	sub    $0x8,%esp
+  804105:	6a 01                	push   $0x1
+  804107:	50                   	push   %eax
+  804108:	e8 56 d1 ff ff       	call   801263 <sys_futex_wake>
+  80410d:	83 c4 10             	add    $0x10,%esp
+}
+  804110:	eb ee                	jmp    804100 <cond_signal+0x19>
+
+00804112 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804112:	55                   	push   %ebp
+  804113:	89 e5                	mov    %esp,%ebp
+  804115:	83 ec 08             	sub    $0x8,%esp
+  804118:	8b 45 08             	mov    0x8(%ebp),%eax
+  80411b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804120:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804124:	8b 50 04             	mov    0x4(%eax),%edx
+  804127:	85 d2                	test   %edx,%edx
+  804129:	75 02                	jne    80412d <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  80412b:	c9                   	leave
+  80412c:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  80412d:	83 ec 08             	sub    $0x8,%esp
+  804130:	68 00 04 00 00       	push   $0x400
+  804135:	50                   	push   %eax
+  804136:	e8 28 d1 ff ff       	call   801263 <sys_futex_wake>
+  80413b:	83 c4 10             	add    $0x10,%esp
+}
+  80413e:	eb eb                	jmp    80412b <cond_broadcast+0x19>
+
+00804140 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804140:	b8 00 00 00 00       	mov    $0x0,%eax
+  804145:	c3                   	ret
+
+00804146 <devcons_poll>:
+{
+  804146:	55                   	push   %ebp
+  804147:	89 e5                	mov    %esp,%ebp
+  804149:	53                   	push   %ebx
+  80414a:	83 ec 04             	sub    $0x4,%esp
+  80414d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804150:	89 da                	mov    %ebx,%edx
+  804152:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804155:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  80415c:	74 0c                	je     80416a <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80415e:	89 d8                	mov    %ebx,%eax
+  804160:	83 e0 01             	and    $0x1,%eax
+  804163:	09 d0                	or     %edx,%eax
+}
+  804165:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804168:	c9                   	leave
+  804169:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80416a:	e8 36 cc ff ff       	call   800da5 <sys_cgetc>
+  80416f:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804174:	89 da                	mov    %ebx,%edx
+  804176:	83 e2 04             	and    $0x4,%edx
+  804179:	85 c0                	test   %eax,%eax
+  80417b:	74 e6                	je     804163 <devcons_poll+0x1d>
+  80417d:	eb df                	jmp    80415e <devcons_poll+0x18>
+
+0080417f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80417f:	55                   	push   %ebp
+  804180:	89 e5                	mov    %esp,%ebp
+  804182:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804185:	68 e8 4b 80 00       	push   $0x804be8
+  80418a:	ff 75 0c             	push   0xc(%ebp)
+  80418d:	e8 7d c8 ff ff       	call   800a0f <strcpy>
+	return 0;
+}
+  804192:	b8 00 00 00 00       	mov    $0x0,%eax
+  804197:	c9                   	leave
+  804198:	c3                   	ret
+
+00804199 <devcons_write>:
+{
+  804199:	55                   	push   %ebp
+  80419a:	89 e5                	mov    %esp,%ebp
+  80419c:	57                   	push   %edi
+  80419d:	56                   	push   %esi
+  80419e:	53                   	push   %ebx
+  80419f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8041a5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8041a8:	85 ff                	test   %edi,%edi
+  8041aa:	74 51                	je     8041fd <devcons_write+0x64>
+  8041ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8041b1:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8041b6:	89 fb                	mov    %edi,%ebx
+  8041b8:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8041ba:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8041bf:	39 d3                	cmp    %edx,%ebx
+  8041c1:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8041c4:	83 ec 04             	sub    $0x4,%esp
+  8041c7:	53                   	push   %ebx
+  8041c8:	03 45 0c             	add    0xc(%ebp),%eax
+  8041cb:	50                   	push   %eax
+  8041cc:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8041d2:	50                   	push   %eax
+  8041d3:	e8 e7 c9 ff ff       	call   800bbf <memmove>
+		sys_cputs(buf, m);
+  8041d8:	83 c4 08             	add    $0x8,%esp
+  8041db:	53                   	push   %ebx
+  8041dc:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8041e2:	50                   	push   %eax
+  8041e3:	e8 9f cb ff ff       	call   800d87 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8041e8:	01 de                	add    %ebx,%esi
+  8041ea:	89 f0                	mov    %esi,%eax
+  8041ec:	83 c4 10             	add    $0x10,%esp
+  8041ef:	39 fe                	cmp    %edi,%esi
+  8041f1:	72 c3                	jb     8041b6 <devcons_write+0x1d>
+}
+  8041f3:	89 f0                	mov    %esi,%eax
+  8041f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041f8:	5b                   	pop    %ebx
+  8041f9:	5e                   	pop    %esi
+  8041fa:	5f                   	pop    %edi
+  8041fb:	5d                   	pop    %ebp
+  8041fc:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8041fd:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804202:	eb ef                	jmp    8041f3 <devcons_write+0x5a>
+
+00804204 <devcons_read>:
+{
+  804204:	55                   	push   %ebp
+  804205:	89 e5                	mov    %esp,%ebp
+  804207:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80420a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80420f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804213:	74 36                	je     80424b <devcons_read+0x47>
+	c = cons_peek;
+  804215:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  80421a:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  804221:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804224:	85 c0                	test   %eax,%eax
+  804226:	75 10                	jne    804238 <devcons_read+0x34>
+  804228:	e8 78 cb ff ff       	call   800da5 <sys_cgetc>
+  80422d:	85 c0                	test   %eax,%eax
+  80422f:	75 07                	jne    804238 <devcons_read+0x34>
+		sys_yield();
+  804231:	e8 ee cb ff ff       	call   800e24 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804236:	eb f0                	jmp    804228 <devcons_read+0x24>
+	if (c < 0)
+  804238:	85 c0                	test   %eax,%eax
+  80423a:	78 0f                	js     80424b <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80423c:	83 f8 04             	cmp    $0x4,%eax
+  80423f:	74 0c                	je     80424d <devcons_read+0x49>
+	*(char*)vbuf = c;
+  804241:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804244:	88 02                	mov    %al,(%edx)
+	return 1;
+  804246:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80424b:	c9                   	leave
+  80424c:	c3                   	ret
+		return 0;
+  80424d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804252:	eb f7                	jmp    80424b <devcons_read+0x47>
+
+00804254 <cputchar>:
+{
+  804254:	55                   	push   %ebp
+  804255:	89 e5                	mov    %esp,%ebp
+  804257:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80425a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80425d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804260:	6a 01                	push   $0x1
+  804262:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804265:	50                   	push   %eax
+  804266:	e8 1c cb ff ff       	call   800d87 <sys_cputs>
+}
+  80426b:	83 c4 10             	add    $0x10,%esp
+  80426e:	c9                   	leave
+  80426f:	c3                   	ret
+
+00804270 <getchar>:
+{
+  804270:	55                   	push   %ebp
+  804271:	89 e5                	mov    %esp,%ebp
+  804273:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804276:	6a 01                	push   $0x1
+  804278:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80427b:	50                   	push   %eax
+  80427c:	6a 00                	push   $0x0
+  80427e:	e8 d2 dd ff ff       	call   802055 <read>
+	if (r < 0)
+  804283:	83 c4 10             	add    $0x10,%esp
+  804286:	85 c0                	test   %eax,%eax
+  804288:	78 06                	js     804290 <getchar+0x20>
+	if (r < 1)
+  80428a:	74 06                	je     804292 <getchar+0x22>
+	return c;
+  80428c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804290:	c9                   	leave
+  804291:	c3                   	ret
+		return -E_EOF;
+  804292:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804297:	eb f7                	jmp    804290 <getchar+0x20>
+
+00804299 <iscons>:
+{
+  804299:	55                   	push   %ebp
+  80429a:	89 e5                	mov    %esp,%ebp
+  80429c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80429f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042a2:	50                   	push   %eax
+  8042a3:	ff 75 08             	push   0x8(%ebp)
+  8042a6:	e8 26 db ff ff       	call   801dd1 <fd_lookup>
+  8042ab:	83 c4 10             	add    $0x10,%esp
+  8042ae:	85 c0                	test   %eax,%eax
+  8042b0:	78 11                	js     8042c3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8042b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042b5:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8042bb:	39 10                	cmp    %edx,(%eax)
+  8042bd:	0f 94 c0             	sete   %al
+  8042c0:	0f b6 c0             	movzbl %al,%eax
+}
+  8042c3:	c9                   	leave
+  8042c4:	c3                   	ret
+
+008042c5 <opencons>:
+{
+  8042c5:	55                   	push   %ebp
+  8042c6:	89 e5                	mov    %esp,%ebp
+  8042c8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8042cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042ce:	50                   	push   %eax
+  8042cf:	e8 ad da ff ff       	call   801d81 <fd_alloc>
+  8042d4:	83 c4 10             	add    $0x10,%esp
+  8042d7:	85 c0                	test   %eax,%eax
+  8042d9:	78 3a                	js     804315 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8042db:	83 ec 04             	sub    $0x4,%esp
+  8042de:	68 07 04 00 00       	push   $0x407
+  8042e3:	ff 75 f4             	push   -0xc(%ebp)
+  8042e6:	6a 00                	push   $0x0
+  8042e8:	e8 56 cb ff ff       	call   800e43 <sys_page_alloc>
+  8042ed:	83 c4 10             	add    $0x10,%esp
+  8042f0:	85 c0                	test   %eax,%eax
+  8042f2:	78 21                	js     804315 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8042f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042f7:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8042fd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8042ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804302:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804309:	83 ec 0c             	sub    $0xc,%esp
+  80430c:	50                   	push   %eax
+  80430d:	e8 48 da ff ff       	call   801d5a <fd2num>
+  804312:	83 c4 10             	add    $0x10,%esp
+}
+  804315:	c9                   	leave
+  804316:	c3                   	ret
+
+00804317 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804317:	55                   	push   %ebp
+  804318:	89 e5                	mov    %esp,%ebp
+  80431a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80431d:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804324:	74 0a                	je     804330 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804326:	8b 45 08             	mov    0x8(%ebp),%eax
+  804329:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80432e:	c9                   	leave
+  80432f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804330:	83 ec 04             	sub    $0x4,%esp
+  804333:	6a 07                	push   $0x7
+  804335:	68 00 f0 bf ee       	push   $0xeebff000
+  80433a:	6a 00                	push   $0x0
+  80433c:	e8 02 cb ff ff       	call   800e43 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804341:	83 c4 08             	add    $0x8,%esp
+  804344:	68 55 43 80 00       	push   $0x804355
+  804349:	6a 00                	push   $0x0
+  80434b:	e8 3e cc ff ff       	call   800f8e <sys_env_set_pgfault_upcall>
+  804350:	83 c4 10             	add    $0x10,%esp
+  804353:	eb d1                	jmp    804326 <set_pgfault_handler+0xf>
+
+00804355 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804355:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804356:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80435b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80435d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804360:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804364:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804367:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  80436b:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  80436d:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804371:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804374:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804375:	83 c4 04             	add    $0x4,%esp
+	popf
+  804378:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804379:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80437a:	c3                   	ret
+
+0080437b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80437b:	55                   	push   %ebp
+  80437c:	89 e5                	mov    %esp,%ebp
+  80437e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804381:	89 c2                	mov    %eax,%edx
+  804383:	c1 ea 16             	shr    $0x16,%edx
+  804386:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80438d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804392:	f6 c1 01             	test   $0x1,%cl
+  804395:	74 1e                	je     8043b5 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804397:	c1 e8 0c             	shr    $0xc,%eax
+  80439a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043a1:	a8 01                	test   $0x1,%al
+  8043a3:	74 10                	je     8043b5 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043a5:	c1 e8 0c             	shr    $0xc,%eax
+  8043a8:	c1 e0 04             	shl    $0x4,%eax
+  8043ab:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8043b2:	0f b7 d2             	movzwl %dx,%edx
+}
+  8043b5:	89 d0                	mov    %edx,%eax
+  8043b7:	5d                   	pop    %ebp
+  8043b8:	c3                   	ret
+
+008043b9 <__udivdi3>:
+  8043b9:	57                   	push   %edi
+  8043ba:	56                   	push   %esi
+  8043bb:	53                   	push   %ebx
+  8043bc:	83 ec 20             	sub    $0x20,%esp
+  8043bf:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8043c3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8043c7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8043cb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8043cf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8043d3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8043d7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8043db:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8043df:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8043e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043ee:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8043f5:	00 
+  8043f6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8043fd:	00 
+  8043fe:	eb 08                	jmp    804408 <__udivdi3+0x4f>
+  804400:	83 e9 01             	sub    $0x1,%ecx
+  804403:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804406:	74 68                	je     804470 <__udivdi3+0xb7>
+  804408:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80440c:	01 c0                	add    %eax,%eax
+  80440e:	89 c6                	mov    %eax,%esi
+  804410:	89 d7                	mov    %edx,%edi
+  804412:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804416:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80441a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80441d:	d3 ea                	shr    %cl,%edx
+  80441f:	f6 c1 20             	test   $0x20,%cl
+  804422:	74 04                	je     804428 <__udivdi3+0x6f>
+  804424:	89 d0                	mov    %edx,%eax
+  804426:	31 d2                	xor    %edx,%edx
+  804428:	83 e0 01             	and    $0x1,%eax
+  80442b:	89 04 24             	mov    %eax,(%esp)
+  80442e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804435:	00 
+  804436:	8b 04 24             	mov    (%esp),%eax
+  804439:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80443d:	09 f0                	or     %esi,%eax
+  80443f:	09 fa                	or     %edi,%edx
+  804441:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804445:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804449:	39 f0                	cmp    %esi,%eax
+  80444b:	89 d3                	mov    %edx,%ebx
+  80444d:	19 fb                	sbb    %edi,%ebx
+  80444f:	72 af                	jb     804400 <__udivdi3+0x47>
+  804451:	29 f0                	sub    %esi,%eax
+  804453:	19 fa                	sbb    %edi,%edx
+  804455:	89 cf                	mov    %ecx,%edi
+  804457:	c1 ef 05             	shr    $0x5,%edi
+  80445a:	83 e7 01             	and    $0x1,%edi
+  80445d:	89 fe                	mov    %edi,%esi
+  80445f:	83 f6 01             	xor    $0x1,%esi
+  804462:	d3 e6                	shl    %cl,%esi
+  804464:	d3 e7                	shl    %cl,%edi
+  804466:	09 74 24 18          	or     %esi,0x18(%esp)
+  80446a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80446e:	eb 90                	jmp    804400 <__udivdi3+0x47>
+  804470:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804474:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804478:	83 c4 20             	add    $0x20,%esp
+  80447b:	5b                   	pop    %ebx
+  80447c:	5e                   	pop    %esi
+  80447d:	5f                   	pop    %edi
+  80447e:	c3                   	ret
+
+0080447f <__umoddi3>:
+  80447f:	57                   	push   %edi
+  804480:	56                   	push   %esi
+  804481:	53                   	push   %ebx
+  804482:	83 ec 08             	sub    $0x8,%esp
+  804485:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804489:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80448d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804491:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804495:	57                   	push   %edi
+  804496:	56                   	push   %esi
+  804497:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80449b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80449f:	52                   	push   %edx
+  8044a0:	50                   	push   %eax
+  8044a1:	e8 13 ff ff ff       	call   8043b9 <__udivdi3>
+  8044a6:	89 c3                	mov    %eax,%ebx
+  8044a8:	0f af d6             	imul   %esi,%edx
+  8044ab:	89 f9                	mov    %edi,%ecx
+  8044ad:	0f af cb             	imul   %ebx,%ecx
+  8044b0:	01 d1                	add    %edx,%ecx
+  8044b2:	89 d8                	mov    %ebx,%eax
+  8044b4:	f7 e6                	mul    %esi
+  8044b6:	89 c6                	mov    %eax,%esi
+  8044b8:	89 d7                	mov    %edx,%edi
+  8044ba:	01 cf                	add    %ecx,%edi
+  8044bc:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044c0:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044c4:	29 f0                	sub    %esi,%eax
+  8044c6:	19 fa                	sbb    %edi,%edx
+  8044c8:	83 c4 18             	add    $0x18,%esp
+  8044cb:	5b                   	pop    %ebx
+  8044cc:	5e                   	pop    %esi
+  8044cd:	5f                   	pop    %edi
+  8044ce:	c3                   	ret
+
+008044cf <__divdi3>:
+  8044cf:	53                   	push   %ebx
+  8044d0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8044d4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8044d8:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8044dc:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8044e0:	85 d2                	test   %edx,%edx
+  8044e2:	78 12                	js     8044f6 <__divdi3+0x27>
+  8044e4:	85 db                	test   %ebx,%ebx
+  8044e6:	78 2e                	js     804516 <__divdi3+0x47>
+  8044e8:	53                   	push   %ebx
+  8044e9:	51                   	push   %ecx
+  8044ea:	52                   	push   %edx
+  8044eb:	50                   	push   %eax
+  8044ec:	e8 c8 fe ff ff       	call   8043b9 <__udivdi3>
+  8044f1:	83 c4 10             	add    $0x10,%esp
+  8044f4:	eb 1e                	jmp    804514 <__divdi3+0x45>
+  8044f6:	f7 d8                	neg    %eax
+  8044f8:	83 d2 00             	adc    $0x0,%edx
+  8044fb:	f7 da                	neg    %edx
+  8044fd:	85 db                	test   %ebx,%ebx
+  8044ff:	78 2a                	js     80452b <__divdi3+0x5c>
+  804501:	53                   	push   %ebx
+  804502:	51                   	push   %ecx
+  804503:	52                   	push   %edx
+  804504:	50                   	push   %eax
+  804505:	e8 af fe ff ff       	call   8043b9 <__udivdi3>
+  80450a:	83 c4 10             	add    $0x10,%esp
+  80450d:	f7 d8                	neg    %eax
+  80450f:	83 d2 00             	adc    $0x0,%edx
+  804512:	f7 da                	neg    %edx
+  804514:	5b                   	pop    %ebx
+  804515:	c3                   	ret
+  804516:	f7 d9                	neg    %ecx
+  804518:	83 d3 00             	adc    $0x0,%ebx
+  80451b:	f7 db                	neg    %ebx
+  80451d:	53                   	push   %ebx
+  80451e:	51                   	push   %ecx
+  80451f:	52                   	push   %edx
+  804520:	50                   	push   %eax
+  804521:	e8 93 fe ff ff       	call   8043b9 <__udivdi3>
+  804526:	83 c4 10             	add    $0x10,%esp
+  804529:	eb e2                	jmp    80450d <__divdi3+0x3e>
+  80452b:	f7 d9                	neg    %ecx
+  80452d:	83 d3 00             	adc    $0x0,%ebx
+  804530:	f7 db                	neg    %ebx
+  804532:	53                   	push   %ebx
+  804533:	51                   	push   %ecx
+  804534:	52                   	push   %edx
+  804535:	50                   	push   %eax
+  804536:	e8 7e fe ff ff       	call   8043b9 <__udivdi3>
+  80453b:	83 c4 10             	add    $0x10,%esp
+  80453e:	eb d4                	jmp    804514 <__divdi3+0x45>
+
+00804540 <__moddi3>:
+  804540:	57                   	push   %edi
+  804541:	56                   	push   %esi
+  804542:	53                   	push   %ebx
+  804543:	83 ec 08             	sub    $0x8,%esp
+  804546:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80454a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80454e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804552:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804556:	57                   	push   %edi
+  804557:	56                   	push   %esi
+  804558:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80455c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804560:	52                   	push   %edx
+  804561:	50                   	push   %eax
+  804562:	e8 68 ff ff ff       	call   8044cf <__divdi3>
+  804567:	89 c3                	mov    %eax,%ebx
+  804569:	0f af d6             	imul   %esi,%edx
+  80456c:	89 f9                	mov    %edi,%ecx
+  80456e:	0f af cb             	imul   %ebx,%ecx
+  804571:	01 d1                	add    %edx,%ecx
+  804573:	89 d8                	mov    %ebx,%eax
+  804575:	f7 e6                	mul    %esi
+  804577:	89 c6                	mov    %eax,%esi
+  804579:	89 d7                	mov    %edx,%edi
+  80457b:	01 cf                	add    %ecx,%edi
+  80457d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804581:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804585:	29 f0                	sub    %esi,%eax
+  804587:	19 fa                	sbb    %edi,%edx
+  804589:	83 c4 18             	add    $0x18,%esp
+  80458c:	5b                   	pop    %ebx
+  80458d:	5e                   	pop    %esi
+  80458e:	5f                   	pop    %edi
+  80458f:	c3                   	ret
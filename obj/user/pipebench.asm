@@ -0,0 +1,10119 @@
+
+obj/user/pipebench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fb 02 00 00       	call   80032c <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <bench>:
+
+// Send 'total' bytes through a pipe, 'chunk' bytes per write, and
+// report the rate the reader got them at.
+static void
+bench(size_t chunk, size_t total)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 48             	sub    $0x48,%esp
+  80003e:	89 c6                	mov    %eax,%esi
+  800040:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	int p[2], r;
+	size_t n;
+	envid_t who;
+	uint32_t t0, s0, ms, reads = 0;
+
+	if ((r = pipe(p)) < 0)
+  800043:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800046:	50                   	push   %eax
+  800047:	e8 4a 43 00 00       	call   804396 <pipe>
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	85 c0                	test   %eax,%eax
+  800051:	0f 88 9d 00 00 00    	js     8000f4 <bench+0xbf>
+		panic("pipe: %e", r);
+	if ((who = fork()) < 0)
+  800057:	e8 85 15 00 00       	call   8015e1 <fork>
+  80005c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	0f 88 9f 00 00 00    	js     800106 <bench+0xd1>
+		panic("fork: %e", who);
+	if (who == 0) {
+  800067:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+  80006b:	75 3d                	jne    8000aa <bench+0x75>
+		close(p[0]);
+  80006d:	83 ec 0c             	sub    $0xc,%esp
+  800070:	ff 75 e0             	push   -0x20(%ebp)
+  800073:	e8 fc 1c 00 00       	call   801d74 <close>
+		for (n = 0; n < total; n += chunk)
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80007e:	85 ff                	test   %edi,%edi
+  800080:	74 23                	je     8000a5 <bench+0x70>
+  800082:	bb 00 00 00 00       	mov    $0x0,%ebx
+			if ((r = write(p[1], buf, chunk)) != chunk)
+  800087:	83 ec 04             	sub    $0x4,%esp
+  80008a:	56                   	push   %esi
+  80008b:	68 00 70 80 00       	push   $0x807000
+  800090:	ff 75 e4             	push   -0x1c(%ebp)
+  800093:	e8 13 1f 00 00       	call   801fab <write>
+  800098:	83 c4 10             	add    $0x10,%esp
+  80009b:	39 f0                	cmp    %esi,%eax
+  80009d:	75 79                	jne    800118 <bench+0xe3>
+		for (n = 0; n < total; n += chunk)
+  80009f:	01 f3                	add    %esi,%ebx
+  8000a1:	39 fb                	cmp    %edi,%ebx
+  8000a3:	72 e2                	jb     800087 <bench+0x52>
+				panic("write: %d %e", r, r >= 0 ? 0 : r);
+		exit();
+  8000a5:	e8 0f 03 00 00       	call   8003b9 <exit>
+	}
+	close(p[1]);
+  8000aa:	83 ec 0c             	sub    $0xc,%esp
+  8000ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b0:	e8 bf 1c 00 00       	call   801d74 <close>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000b5:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000b7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000bc:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  8000be:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000c1:	89 c2                	mov    %eax,%edx
+  8000c3:	c1 ea 0f             	shr    $0xf,%edx
+  8000c6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d0:	0f 42 c2             	cmovb  %edx,%eax
+
+	s0 = thisenv->env_syscalls;
+  8000d3:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  8000da:	8b 40 5c             	mov    0x5c(%eax),%eax
+  8000dd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	t0 = sys_time_msec();
+  8000e0:	e8 48 11 00 00       	call   80122d <sys_time_msec>
+  8000e5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	uint32_t t0, s0, ms, reads = 0;
+  8000e8:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (n = 0; (r = read(p[0], buf, sizeof(buf))) > 0; n += r)
+  8000ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8000f2:	eb 49                	jmp    80013d <bench+0x108>
+		panic("pipe: %e", r);
+  8000f4:	50                   	push   %eax
+  8000f5:	68 9e 50 80 00       	push   $0x80509e
+  8000fa:	6a 16                	push   $0x16
+  8000fc:	68 40 50 80 00       	push   $0x805040
+  800101:	e8 cd 02 00 00       	call   8003d3 <_panic>
+		panic("fork: %e", who);
+  800106:	50                   	push   %eax
+  800107:	68 1d 55 80 00       	push   $0x80551d
+  80010c:	6a 18                	push   $0x18
+  80010e:	68 40 50 80 00       	push   $0x805040
+  800113:	e8 bb 02 00 00       	call   8003d3 <_panic>
+				panic("write: %d %e", r, r >= 0 ? 0 : r);
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	85 c0                	test   %eax,%eax
+  80011d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800122:	0f 4e d0             	cmovle %eax,%edx
+  800125:	52                   	push   %edx
+  800126:	50                   	push   %eax
+  800127:	68 51 50 80 00       	push   $0x805051
+  80012c:	6a 1d                	push   $0x1d
+  80012e:	68 40 50 80 00       	push   $0x805040
+  800133:	e8 9b 02 00 00       	call   8003d3 <_panic>
+		reads++;
+  800138:	83 c7 01             	add    $0x1,%edi
+	for (n = 0; (r = read(p[0], buf, sizeof(buf))) > 0; n += r)
+  80013b:	01 c3                	add    %eax,%ebx
+  80013d:	83 ec 04             	sub    $0x4,%esp
+  800140:	68 00 40 00 00       	push   $0x4000
+  800145:	68 00 70 80 00       	push   $0x807000
+  80014a:	ff 75 e0             	push   -0x20(%ebp)
+  80014d:	e8 61 1d 00 00       	call   801eb3 <read>
+  800152:	83 c4 10             	add    $0x10,%esp
+  800155:	85 c0                	test   %eax,%eax
+  800157:	7f df                	jg     800138 <bench+0x103>
+	if (r < 0)
+  800159:	0f 88 e3 00 00 00    	js     800242 <bench+0x20d>
+		panic("read: %e", r);
+	ms = MAX(sys_time_msec() - t0, 1);
+  80015f:	e8 c9 10 00 00       	call   80122d <sys_time_msec>
+  800164:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800167:	29 c8                	sub    %ecx,%eax
+  800169:	89 c1                	mov    %eax,%ecx
+  80016b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800170:	0f 45 c1             	cmovne %ecx,%eax
+  800173:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	close(p[0]);
+  800176:	83 ec 0c             	sub    $0xc,%esp
+  800179:	ff 75 e0             	push   -0x20(%ebp)
+  80017c:	e8 f3 1b 00 00       	call   801d74 <close>
+	wait(who);
+  800181:	83 c4 04             	add    $0x4,%esp
+  800184:	ff 75 c8             	push   -0x38(%ebp)
+  800187:	e8 87 43 00 00       	call   804513 <wait>
+	if (n != total)
+  80018c:	83 c4 10             	add    $0x10,%esp
+  80018f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800192:	39 c3                	cmp    %eax,%ebx
+  800194:	0f 85 ba 00 00 00    	jne    800254 <bench+0x21f>
+  80019a:	89 e2                	mov    %esp,%edx
+  80019c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8001a1:	29 d0                	sub    %edx,%eax
+  8001a3:	89 c2                	mov    %eax,%edx
+  8001a5:	c1 ea 0f             	shr    $0xf,%edx
+  8001a8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8001ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b2:	0f 42 c2             	cmovb  %edx,%eax
+
+	cprintf("pipebench: %5d-byte writes: %u KB/s, %u bytes per read, "
+		"%u reader syscalls per MB\n",
+		chunk, (uint32_t) ((uint64_t) total * 1000 / 1024 / ms),
+		n / MAX(reads, 1),
+		(uint32_t) ((uint64_t) (thisenv->env_syscalls - s0)
+  8001b5:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  8001bc:	8b 40 5c             	mov    0x5c(%eax),%eax
+			    * 1048576 / total));
+  8001bf:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8001c2:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8001c5:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+	cprintf("pipebench: %5d-byte writes: %u KB/s, %u bytes per read, "
+  8001cc:	83 ec 10             	sub    $0x10,%esp
+		(uint32_t) ((uint64_t) (thisenv->env_syscalls - s0)
+  8001cf:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  8001d2:	29 d0                	sub    %edx,%eax
+  8001d4:	ba 00 00 00 00       	mov    $0x0,%edx
+			    * 1048576 / total));
+  8001d9:	0f a4 c2 14          	shld   $0x14,%eax,%edx
+  8001dd:	c1 e0 14             	shl    $0x14,%eax
+  8001e0:	ff 75 cc             	push   -0x34(%ebp)
+  8001e3:	ff 75 c8             	push   -0x38(%ebp)
+  8001e6:	52                   	push   %edx
+  8001e7:	50                   	push   %eax
+  8001e8:	e8 62 4c 00 00       	call   804e4f <__udivdi3>
+  8001ed:	83 c4 14             	add    $0x14,%esp
+	cprintf("pipebench: %5d-byte writes: %u KB/s, %u bytes per read, "
+  8001f0:	50                   	push   %eax
+		n / MAX(reads, 1),
+  8001f1:	85 ff                	test   %edi,%edi
+  8001f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001f8:	0f 44 f8             	cmove  %eax,%edi
+	cprintf("pipebench: %5d-byte writes: %u KB/s, %u bytes per read, "
+  8001fb:	89 d8                	mov    %ebx,%eax
+  8001fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800202:	f7 f7                	div    %edi
+  800204:	50                   	push   %eax
+		chunk, (uint32_t) ((uint64_t) total * 1000 / 1024 / ms),
+  800205:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+  80020a:	f7 65 d4             	mull   -0x2c(%ebp)
+  80020d:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  800211:	c1 ea 0a             	shr    $0xa,%edx
+  800214:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800217:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021c:	83 ec 0c             	sub    $0xc,%esp
+  80021f:	53                   	push   %ebx
+  800220:	51                   	push   %ecx
+  800221:	52                   	push   %edx
+  800222:	50                   	push   %eax
+  800223:	e8 27 4c 00 00       	call   804e4f <__udivdi3>
+  800228:	83 c4 1c             	add    $0x1c,%esp
+	cprintf("pipebench: %5d-byte writes: %u KB/s, %u bytes per read, "
+  80022b:	50                   	push   %eax
+  80022c:	56                   	push   %esi
+  80022d:	68 a8 50 80 00       	push   $0x8050a8
+  800232:	e8 77 02 00 00       	call   8004ae <cprintf>
+}
+  800237:	83 c4 20             	add    $0x20,%esp
+  80023a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023d:	5b                   	pop    %ebx
+  80023e:	5e                   	pop    %esi
+  80023f:	5f                   	pop    %edi
+  800240:	5d                   	pop    %ebp
+  800241:	c3                   	ret
+		panic("read: %e", r);
+  800242:	50                   	push   %eax
+  800243:	68 5e 50 80 00       	push   $0x80505e
+  800248:	6a 27                	push   $0x27
+  80024a:	68 40 50 80 00       	push   $0x805040
+  80024f:	e8 7f 01 00 00       	call   8003d3 <_panic>
+		panic("read %d bytes, not %d", n, total);
+  800254:	83 ec 0c             	sub    $0xc,%esp
+  800257:	50                   	push   %eax
+  800258:	53                   	push   %ebx
+  800259:	68 67 50 80 00       	push   $0x805067
+  80025e:	6a 2c                	push   $0x2c
+  800260:	68 40 50 80 00       	push   $0x805040
+  800265:	e8 69 01 00 00       	call   8003d3 <_panic>
+
+0080026a <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	56                   	push   %esi
+  80026e:	53                   	push   %ebx
+  80026f:	83 ec 10             	sub    $0x10,%esp
+	char nprimes[16];
+	uint32_t t0;
+	int r;
+
+	binaryname = "pipebench";
+  800272:	c7 05 00 60 80 00 7d 	movl   $0x80507d,0x806000
+  800279:	50 80 00 
+	bench(4, 1 << 20);
+  80027c:	ba 00 00 10 00       	mov    $0x100000,%edx
+  800281:	b8 04 00 00 00       	mov    $0x4,%eax
+  800286:	e8 aa fd ff ff       	call   800035 <bench>
+	bench(64, 4 << 20);
+  80028b:	ba 00 00 40 00       	mov    $0x400000,%edx
+  800290:	b8 40 00 00 00       	mov    $0x40,%eax
+  800295:	e8 9b fd ff ff       	call   800035 <bench>
+	bench(1024, 16 << 20);
+  80029a:	ba 00 00 00 01       	mov    $0x1000000,%edx
+  80029f:	b8 00 04 00 00       	mov    $0x400,%eax
+  8002a4:	e8 8c fd ff ff       	call   800035 <bench>
+	bench(16384, 16 << 20);
+  8002a9:	ba 00 00 00 01       	mov    $0x1000000,%edx
+  8002ae:	b8 00 40 00 00       	mov    $0x4000,%eax
+  8002b3:	e8 7d fd ff ff       	call   800035 <bench>
+
+	snprintf(nprimes, sizeof(nprimes), "%d", NPRIMES);
+  8002b8:	68 c8 00 00 00       	push   $0xc8
+  8002bd:	68 69 51 80 00       	push   $0x805169
+  8002c2:	6a 10                	push   $0x10
+  8002c4:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  8002c7:	56                   	push   %esi
+  8002c8:	e8 72 08 00 00       	call   800b3f <snprintf>
+	t0 = sys_time_msec();
+  8002cd:	e8 5b 0f 00 00       	call   80122d <sys_time_msec>
+  8002d2:	89 c3                	mov    %eax,%ebx
+	if ((r = spawnl("primespipe", "primespipe", nprimes, 0)) < 0)
+  8002d4:	6a 00                	push   $0x0
+  8002d6:	56                   	push   %esi
+  8002d7:	68 87 50 80 00       	push   $0x805087
+  8002dc:	68 87 50 80 00       	push   $0x805087
+  8002e1:	e8 cc 2a 00 00       	call   802db2 <spawnl>
+  8002e6:	83 c4 20             	add    $0x20,%esp
+  8002e9:	85 c0                	test   %eax,%eax
+  8002eb:	78 2d                	js     80031a <umain+0xb0>
+		panic("spawn primespipe: %e", r);
+	wait(r);
+  8002ed:	83 ec 0c             	sub    $0xc,%esp
+  8002f0:	50                   	push   %eax
+  8002f1:	e8 1d 42 00 00       	call   804513 <wait>
+	cprintf("pipebench: primespipe %d: %u ms\n",
+		NPRIMES, sys_time_msec() - t0);
+  8002f6:	e8 32 0f 00 00       	call   80122d <sys_time_msec>
+	cprintf("pipebench: primespipe %d: %u ms\n",
+  8002fb:	83 c4 0c             	add    $0xc,%esp
+  8002fe:	29 d8                	sub    %ebx,%eax
+  800300:	50                   	push   %eax
+  800301:	68 c8 00 00 00       	push   $0xc8
+  800306:	68 fc 50 80 00       	push   $0x8050fc
+  80030b:	e8 9e 01 00 00       	call   8004ae <cprintf>
+}
+  800310:	83 c4 10             	add    $0x10,%esp
+  800313:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800316:	5b                   	pop    %ebx
+  800317:	5e                   	pop    %esi
+  800318:	5d                   	pop    %ebp
+  800319:	c3                   	ret
+		panic("spawn primespipe: %e", r);
+  80031a:	50                   	push   %eax
+  80031b:	68 92 50 80 00       	push   $0x805092
+  800320:	6a 46                	push   $0x46
+  800322:	68 40 50 80 00       	push   $0x805040
+  800327:	e8 a7 00 00 00       	call   8003d3 <_panic>
+
+0080032c <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	56                   	push   %esi
+  800330:	53                   	push   %ebx
+  800331:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800334:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800337:	89 e2                	mov    %esp,%edx
+  800339:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80033e:	29 d0                	sub    %edx,%eax
+  800340:	89 c2                	mov    %eax,%edx
+  800342:	c1 ea 0f             	shr    $0xf,%edx
+  800345:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80034a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034f:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800352:	c7 04 85 40 c0 80 00 	movl   $0x0,0x80c040(,%eax,4)
+  800359:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80035d:	e8 39 0c 00 00       	call   800f9b <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800362:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800367:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80036d:	89 e1                	mov    %esp,%ecx
+  80036f:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800374:	29 ca                	sub    %ecx,%edx
+  800376:	89 d1                	mov    %edx,%ecx
+  800378:	c1 e9 0f             	shr    $0xf,%ecx
+  80037b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800381:	ba 00 00 00 00       	mov    $0x0,%edx
+  800386:	0f 42 d1             	cmovb  %ecx,%edx
+  800389:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80038e:	89 04 95 40 c0 80 00 	mov    %eax,0x80c040(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800395:	85 db                	test   %ebx,%ebx
+  800397:	7e 07                	jle    8003a0 <libmain+0x74>
+		binaryname = argv[0];
+  800399:	8b 06                	mov    (%esi),%eax
+  80039b:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8003a0:	83 ec 08             	sub    $0x8,%esp
+  8003a3:	56                   	push   %esi
+  8003a4:	53                   	push   %ebx
+  8003a5:	e8 c0 fe ff ff       	call   80026a <umain>
+
+	// exit gracefully
+	exit();
+  8003aa:	e8 0a 00 00 00       	call   8003b9 <exit>
+}
+  8003af:	83 c4 10             	add    $0x10,%esp
+  8003b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003b5:	5b                   	pop    %ebx
+  8003b6:	5e                   	pop    %esi
+  8003b7:	5d                   	pop    %ebp
+  8003b8:	c3                   	ret
+
+008003b9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003b9:	55                   	push   %ebp
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003bf:	e8 dd 19 00 00       	call   801da1 <close_all>
+	sys_env_destroy(0);
+  8003c4:	83 ec 0c             	sub    $0xc,%esp
+  8003c7:	6a 00                	push   $0x0
+  8003c9:	e8 8c 0b 00 00       	call   800f5a <sys_env_destroy>
+}
+  8003ce:	83 c4 10             	add    $0x10,%esp
+  8003d1:	c9                   	leave
+  8003d2:	c3                   	ret
+
+008003d3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003d3:	55                   	push   %ebp
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	56                   	push   %esi
+  8003d7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003d8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003db:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8003e1:	e8 b5 0b 00 00       	call   800f9b <sys_getenvid>
+  8003e6:	83 ec 0c             	sub    $0xc,%esp
+  8003e9:	ff 75 0c             	push   0xc(%ebp)
+  8003ec:	ff 75 08             	push   0x8(%ebp)
+  8003ef:	56                   	push   %esi
+  8003f0:	50                   	push   %eax
+  8003f1:	68 28 51 80 00       	push   $0x805128
+  8003f6:	e8 b3 00 00 00       	call   8004ae <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003fb:	83 c4 18             	add    $0x18,%esp
+  8003fe:	53                   	push   %ebx
+  8003ff:	ff 75 10             	push   0x10(%ebp)
+  800402:	e8 56 00 00 00       	call   80045d <vcprintf>
+	cprintf("\n");
+  800407:	c7 04 24 42 57 80 00 	movl   $0x805742,(%esp)
+  80040e:	e8 9b 00 00 00       	call   8004ae <cprintf>
+  800413:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800416:	cc                   	int3
+	while (1)
+  800417:	eb fd                	jmp    800416 <_panic+0x43>
+
+00800419 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800419:	55                   	push   %ebp
+  80041a:	89 e5                	mov    %esp,%ebp
+  80041c:	53                   	push   %ebx
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800423:	8b 13                	mov    (%ebx),%edx
+  800425:	8d 42 01             	lea    0x1(%edx),%eax
+  800428:	89 03                	mov    %eax,(%ebx)
+  80042a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80042d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800431:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800436:	74 09                	je     800441 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800438:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80043c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80043f:	c9                   	leave
+  800440:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800441:	83 ec 08             	sub    $0x8,%esp
+  800444:	68 ff 00 00 00       	push   $0xff
+  800449:	8d 43 08             	lea    0x8(%ebx),%eax
+  80044c:	50                   	push   %eax
+  80044d:	e8 cb 0a 00 00       	call   800f1d <sys_cputs>
+		b->idx = 0;
+  800452:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800458:	83 c4 10             	add    $0x10,%esp
+  80045b:	eb db                	jmp    800438 <putch+0x1f>
+
+0080045d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80045d:	55                   	push   %ebp
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800466:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80046d:	00 00 00 
+	b.cnt = 0;
+  800470:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800477:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80047a:	ff 75 0c             	push   0xc(%ebp)
+  80047d:	ff 75 08             	push   0x8(%ebp)
+  800480:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800486:	50                   	push   %eax
+  800487:	68 19 04 80 00       	push   $0x800419
+  80048c:	e8 1c 01 00 00       	call   8005ad <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800491:	83 c4 08             	add    $0x8,%esp
+  800494:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80049a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004a0:	50                   	push   %eax
+  8004a1:	e8 77 0a 00 00       	call   800f1d <sys_cputs>
+
+	return b.cnt;
+}
+  8004a6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004ac:	c9                   	leave
+  8004ad:	c3                   	ret
+
+008004ae <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ae:	55                   	push   %ebp
+  8004af:	89 e5                	mov    %esp,%ebp
+  8004b1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004b4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004b7:	50                   	push   %eax
+  8004b8:	ff 75 08             	push   0x8(%ebp)
+  8004bb:	e8 9d ff ff ff       	call   80045d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004c0:	c9                   	leave
+  8004c1:	c3                   	ret
+
+008004c2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	57                   	push   %edi
+  8004c6:	56                   	push   %esi
+  8004c7:	53                   	push   %ebx
+  8004c8:	83 ec 1c             	sub    $0x1c,%esp
+  8004cb:	89 c3                	mov    %eax,%ebx
+  8004cd:	89 d6                	mov    %edx,%esi
+  8004cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004d5:	89 d1                	mov    %edx,%ecx
+  8004d7:	89 c2                	mov    %eax,%edx
+  8004d9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004dc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004df:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004ec:	39 c2                	cmp    %eax,%edx
+  8004ee:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004f1:	73 4b                	jae    80053e <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8004f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f6:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8004f9:	85 ff                	test   %edi,%edi
+  8004fb:	7e 11                	jle    80050e <printnum+0x4c>
+			putch(padc, putdat);
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	56                   	push   %esi
+  800501:	ff 75 18             	push   0x18(%ebp)
+  800504:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800506:	83 c4 10             	add    $0x10,%esp
+  800509:	83 ef 01             	sub    $0x1,%edi
+  80050c:	75 ef                	jne    8004fd <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	56                   	push   %esi
+  800512:	83 ec 04             	sub    $0x4,%esp
+  800515:	ff 75 e4             	push   -0x1c(%ebp)
+  800518:	ff 75 e0             	push   -0x20(%ebp)
+  80051b:	ff 75 dc             	push   -0x24(%ebp)
+  80051e:	ff 75 d8             	push   -0x28(%ebp)
+  800521:	e8 ef 49 00 00       	call   804f15 <__umoddi3>
+  800526:	83 c4 14             	add    $0x14,%esp
+  800529:	0f be 80 4b 51 80 00 	movsbl 0x80514b(%eax),%eax
+  800530:	50                   	push   %eax
+  800531:	ff d3                	call   *%ebx
+}
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800539:	5b                   	pop    %ebx
+  80053a:	5e                   	pop    %esi
+  80053b:	5f                   	pop    %edi
+  80053c:	5d                   	pop    %ebp
+  80053d:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80053e:	83 ec 0c             	sub    $0xc,%esp
+  800541:	ff 75 18             	push   0x18(%ebp)
+  800544:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800547:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80054a:	52                   	push   %edx
+  80054b:	50                   	push   %eax
+  80054c:	83 ec 08             	sub    $0x8,%esp
+  80054f:	ff 75 e4             	push   -0x1c(%ebp)
+  800552:	ff 75 e0             	push   -0x20(%ebp)
+  800555:	ff 75 dc             	push   -0x24(%ebp)
+  800558:	ff 75 d8             	push   -0x28(%ebp)
+  80055b:	e8 ef 48 00 00       	call   804e4f <__udivdi3>
+  800560:	83 c4 18             	add    $0x18,%esp
+  800563:	52                   	push   %edx
+  800564:	50                   	push   %eax
+  800565:	89 f2                	mov    %esi,%edx
+  800567:	89 d8                	mov    %ebx,%eax
+  800569:	e8 54 ff ff ff       	call   8004c2 <printnum>
+  80056e:	83 c4 20             	add    $0x20,%esp
+  800571:	eb 9b                	jmp    80050e <printnum+0x4c>
+
+00800573 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800573:	55                   	push   %ebp
+  800574:	89 e5                	mov    %esp,%ebp
+  800576:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800579:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80057d:	8b 10                	mov    (%eax),%edx
+  80057f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800582:	73 0a                	jae    80058e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800584:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800587:	89 08                	mov    %ecx,(%eax)
+  800589:	8b 45 08             	mov    0x8(%ebp),%eax
+  80058c:	88 02                	mov    %al,(%edx)
+}
+  80058e:	5d                   	pop    %ebp
+  80058f:	c3                   	ret
+
+00800590 <printfmt>:
+{
+  800590:	55                   	push   %ebp
+  800591:	89 e5                	mov    %esp,%ebp
+  800593:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800596:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800599:	50                   	push   %eax
+  80059a:	ff 75 10             	push   0x10(%ebp)
+  80059d:	ff 75 0c             	push   0xc(%ebp)
+  8005a0:	ff 75 08             	push   0x8(%ebp)
+  8005a3:	e8 05 00 00 00       	call   8005ad <vprintfmt>
+}
+  8005a8:	83 c4 10             	add    $0x10,%esp
+  8005ab:	c9                   	leave
+  8005ac:	c3                   	ret
+
+008005ad <vprintfmt>:
+{
+  8005ad:	55                   	push   %ebp
+  8005ae:	89 e5                	mov    %esp,%ebp
+  8005b0:	57                   	push   %edi
+  8005b1:	56                   	push   %esi
+  8005b2:	53                   	push   %ebx
+  8005b3:	83 ec 2c             	sub    $0x2c,%esp
+  8005b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005b9:	89 df                	mov    %ebx,%edi
+  8005bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005be:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005c1:	8d 70 01             	lea    0x1(%eax),%esi
+  8005c4:	0f b6 00             	movzbl (%eax),%eax
+  8005c7:	83 f8 25             	cmp    $0x25,%eax
+  8005ca:	74 1e                	je     8005ea <vprintfmt+0x3d>
+			if (ch == '\0')
+  8005cc:	85 c0                	test   %eax,%eax
+  8005ce:	0f 84 15 05 00 00    	je     800ae9 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8005d4:	83 ec 08             	sub    $0x8,%esp
+  8005d7:	53                   	push   %ebx
+  8005d8:	50                   	push   %eax
+  8005d9:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005db:	83 c6 01             	add    $0x1,%esi
+  8005de:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005e2:	83 c4 10             	add    $0x10,%esp
+  8005e5:	83 f8 25             	cmp    $0x25,%eax
+  8005e8:	75 e2                	jne    8005cc <vprintfmt+0x1f>
+		padc = ' ';
+  8005ea:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8005ee:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005f5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8005fc:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800603:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800608:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80060b:	8d 56 01             	lea    0x1(%esi),%edx
+  80060e:	0f b6 0e             	movzbl (%esi),%ecx
+  800611:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800614:	3c 55                	cmp    $0x55,%al
+  800616:	0f 87 3b 04 00 00    	ja     800a57 <vprintfmt+0x4aa>
+  80061c:	0f b6 c0             	movzbl %al,%eax
+  80061f:	ff 24 85 c0 52 80 00 	jmp    *0x8052c0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800626:	89 75 10             	mov    %esi,0x10(%ebp)
+  800629:	eb 93                	jmp    8005be <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80062b:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80062d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800631:	eb d8                	jmp    80060b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800633:	89 d6                	mov    %edx,%esi
+  800635:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800639:	eb d0                	jmp    80060b <vprintfmt+0x5e>
+  80063b:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80063e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800641:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800644:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800648:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80064b:	83 f9 09             	cmp    $0x9,%ecx
+  80064e:	77 6f                	ja     8006bf <vprintfmt+0x112>
+  800650:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800653:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800656:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800659:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80065d:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800660:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800663:	83 fe 09             	cmp    $0x9,%esi
+  800666:	76 eb                	jbe    800653 <vprintfmt+0xa6>
+  800668:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80066b:	89 d6                	mov    %edx,%esi
+  80066d:	eb 13                	jmp    800682 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 00                	mov    (%eax),%eax
+  800674:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8d 40 04             	lea    0x4(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800680:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800682:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800686:	79 83                	jns    80060b <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800688:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80068b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800695:	e9 71 ff ff ff       	jmp    80060b <vprintfmt+0x5e>
+			if (width < 0)
+  80069a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80069d:	85 c9                	test   %ecx,%ecx
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	0f 49 c1             	cmovns %ecx,%eax
+  8006a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006aa:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006ac:	e9 5a ff ff ff       	jmp    80060b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006b1:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8006b3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006ba:	e9 4c ff ff ff       	jmp    80060b <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006bf:	89 d6                	mov    %edx,%esi
+  8006c1:	eb bf                	jmp    800682 <vprintfmt+0xd5>
+			lflag++;
+  8006c3:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c7:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006c9:	e9 3d ff ff ff       	jmp    80060b <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8006ce:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8d 70 04             	lea    0x4(%eax),%esi
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	ff 30                	push   (%eax)
+  8006dd:	ff d7                	call   *%edi
+			break;
+  8006df:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006e2:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8006e5:	e9 d4 fe ff ff       	jmp    8005be <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8006ea:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	89 d0                	mov    %edx,%eax
+  8006f7:	f7 d8                	neg    %eax
+  8006f9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006fc:	83 f8 12             	cmp    $0x12,%eax
+  8006ff:	7f 23                	jg     800724 <vprintfmt+0x177>
+  800701:	8b 14 85 20 54 80 00 	mov    0x805420(,%eax,4),%edx
+  800708:	85 d2                	test   %edx,%edx
+  80070a:	74 18                	je     800724 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80070c:	52                   	push   %edx
+  80070d:	68 6c 56 80 00       	push   $0x80566c
+  800712:	53                   	push   %ebx
+  800713:	57                   	push   %edi
+  800714:	e8 77 fe ff ff       	call   800590 <printfmt>
+  800719:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80071c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80071f:	e9 9a fe ff ff       	jmp    8005be <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800724:	50                   	push   %eax
+  800725:	68 63 51 80 00       	push   $0x805163
+  80072a:	53                   	push   %ebx
+  80072b:	57                   	push   %edi
+  80072c:	e8 5f fe ff ff       	call   800590 <printfmt>
+  800731:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800734:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800737:	e9 82 fe ff ff       	jmp    8005be <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80073c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	83 c0 04             	add    $0x4,%eax
+  800745:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800748:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074b:	8b 00                	mov    (%eax),%eax
+  80074d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800750:	85 c0                	test   %eax,%eax
+  800752:	0f 84 61 03 00 00    	je     800ab9 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800758:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80075c:	7e 06                	jle    800764 <vprintfmt+0x1b7>
+  80075e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800762:	75 29                	jne    80078d <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800764:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800767:	8d 70 01             	lea    0x1(%eax),%esi
+  80076a:	0f b6 00             	movzbl (%eax),%eax
+  80076d:	0f be d0             	movsbl %al,%edx
+  800770:	85 d2                	test   %edx,%edx
+  800772:	0f 84 bb 00 00 00    	je     800833 <vprintfmt+0x286>
+  800778:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80077b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80077e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800781:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800784:	eb 7a                	jmp    800800 <vprintfmt+0x253>
+				p = "(null)";
+  800786:	c7 45 d0 5c 51 80 00 	movl   $0x80515c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078d:	83 ec 08             	sub    $0x8,%esp
+  800790:	ff 75 d4             	push   -0x2c(%ebp)
+  800793:	ff 75 d0             	push   -0x30(%ebp)
+  800796:	e8 e0 03 00 00       	call   800b7b <strnlen>
+  80079b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80079e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8007a1:	83 c4 10             	add    $0x10,%esp
+  8007a4:	85 d2                	test   %edx,%edx
+  8007a6:	0f 8e d6 02 00 00    	jle    800a82 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8007ac:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8007b0:	83 ec 08             	sub    $0x8,%esp
+  8007b3:	53                   	push   %ebx
+  8007b4:	56                   	push   %esi
+  8007b5:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007b7:	83 c4 10             	add    $0x10,%esp
+  8007ba:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8007be:	75 f0                	jne    8007b0 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007c3:	8d 70 01             	lea    0x1(%eax),%esi
+  8007c6:	0f b6 00             	movzbl (%eax),%eax
+  8007c9:	0f be d0             	movsbl %al,%edx
+  8007cc:	85 d2                	test   %edx,%edx
+  8007ce:	0f 84 da 02 00 00    	je     800aae <vprintfmt+0x501>
+  8007d4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007d7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007da:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007dd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007e0:	eb 1e                	jmp    800800 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8007e2:	83 ec 08             	sub    $0x8,%esp
+  8007e5:	ff 75 0c             	push   0xc(%ebp)
+  8007e8:	52                   	push   %edx
+  8007e9:	ff 55 08             	call   *0x8(%ebp)
+  8007ec:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007ef:	83 eb 01             	sub    $0x1,%ebx
+  8007f2:	83 c6 01             	add    $0x1,%esi
+  8007f5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007f9:	0f be d0             	movsbl %al,%edx
+  8007fc:	85 d2                	test   %edx,%edx
+  8007fe:	74 2a                	je     80082a <vprintfmt+0x27d>
+  800800:	85 ff                	test   %edi,%edi
+  800802:	78 05                	js     800809 <vprintfmt+0x25c>
+  800804:	83 ef 01             	sub    $0x1,%edi
+  800807:	78 59                	js     800862 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800809:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80080d:	74 d3                	je     8007e2 <vprintfmt+0x235>
+  80080f:	0f be c0             	movsbl %al,%eax
+  800812:	83 e8 20             	sub    $0x20,%eax
+  800815:	83 f8 5e             	cmp    $0x5e,%eax
+  800818:	76 c8                	jbe    8007e2 <vprintfmt+0x235>
+					putch('?', putdat);
+  80081a:	83 ec 08             	sub    $0x8,%esp
+  80081d:	ff 75 0c             	push   0xc(%ebp)
+  800820:	6a 3f                	push   $0x3f
+  800822:	ff 55 08             	call   *0x8(%ebp)
+  800825:	83 c4 10             	add    $0x10,%esp
+  800828:	eb c5                	jmp    8007ef <vprintfmt+0x242>
+  80082a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80082d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800830:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800833:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800836:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80083a:	7e 1b                	jle    800857 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80083c:	83 ec 08             	sub    $0x8,%esp
+  80083f:	53                   	push   %ebx
+  800840:	6a 20                	push   $0x20
+  800842:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800844:	83 c4 10             	add    $0x10,%esp
+  800847:	83 ee 01             	sub    $0x1,%esi
+  80084a:	75 f0                	jne    80083c <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80084c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800852:	e9 67 fd ff ff       	jmp    8005be <vprintfmt+0x11>
+  800857:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80085a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80085d:	e9 5c fd ff ff       	jmp    8005be <vprintfmt+0x11>
+  800862:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800865:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800868:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80086b:	eb c6                	jmp    800833 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80086d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800870:	89 55 10             	mov    %edx,0x10(%ebp)
+  800873:	83 f9 01             	cmp    $0x1,%ecx
+  800876:	7f 1f                	jg     800897 <vprintfmt+0x2ea>
+	else if (lflag)
+  800878:	85 c9                	test   %ecx,%ecx
+  80087a:	74 67                	je     8008e3 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80087c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087f:	8b 30                	mov    (%eax),%esi
+  800881:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800884:	89 f0                	mov    %esi,%eax
+  800886:	c1 f8 1f             	sar    $0x1f,%eax
+  800889:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80088c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088f:	8d 40 04             	lea    0x4(%eax),%eax
+  800892:	89 45 14             	mov    %eax,0x14(%ebp)
+  800895:	eb 17                	jmp    8008ae <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 50 04             	mov    0x4(%eax),%edx
+  80089d:	8b 00                	mov    (%eax),%eax
+  80089f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008ae:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008b1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008b4:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8008b9:	85 c9                	test   %ecx,%ecx
+  8008bb:	0f 89 12 01 00 00    	jns    8009d3 <vprintfmt+0x426>
+				putch('-', putdat);
+  8008c1:	83 ec 08             	sub    $0x8,%esp
+  8008c4:	53                   	push   %ebx
+  8008c5:	6a 2d                	push   $0x2d
+  8008c7:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8008c9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008cc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008cf:	f7 da                	neg    %edx
+  8008d1:	83 d1 00             	adc    $0x0,%ecx
+  8008d4:	f7 d9                	neg    %ecx
+  8008d6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008d9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008de:	e9 f0 00 00 00       	jmp    8009d3 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8008e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e6:	8b 30                	mov    (%eax),%esi
+  8008e8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008eb:	89 f0                	mov    %esi,%eax
+  8008ed:	c1 f8 1f             	sar    $0x1f,%eax
+  8008f0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008fc:	eb b0                	jmp    8008ae <vprintfmt+0x301>
+	if (lflag >= 2)
+  8008fe:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800901:	89 55 10             	mov    %edx,0x10(%ebp)
+  800904:	83 f9 01             	cmp    $0x1,%ecx
+  800907:	7f 1e                	jg     800927 <vprintfmt+0x37a>
+	else if (lflag)
+  800909:	85 c9                	test   %ecx,%ecx
+  80090b:	74 32                	je     80093f <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8b 10                	mov    (%eax),%edx
+  800912:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800917:	8d 40 04             	lea    0x4(%eax),%eax
+  80091a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80091d:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800922:	e9 ac 00 00 00       	jmp    8009d3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800927:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092a:	8b 10                	mov    (%eax),%edx
+  80092c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80092f:	8d 40 08             	lea    0x8(%eax),%eax
+  800932:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800935:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80093a:	e9 94 00 00 00       	jmp    8009d3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80093f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800942:	8b 10                	mov    (%eax),%edx
+  800944:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800949:	8d 40 04             	lea    0x4(%eax),%eax
+  80094c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80094f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800954:	eb 7d                	jmp    8009d3 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800956:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800959:	89 55 10             	mov    %edx,0x10(%ebp)
+  80095c:	83 f9 01             	cmp    $0x1,%ecx
+  80095f:	7f 1b                	jg     80097c <vprintfmt+0x3cf>
+	else if (lflag)
+  800961:	85 c9                	test   %ecx,%ecx
+  800963:	74 2c                	je     800991 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800965:	8b 45 14             	mov    0x14(%ebp),%eax
+  800968:	8b 10                	mov    (%eax),%edx
+  80096a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096f:	8d 40 04             	lea    0x4(%eax),%eax
+  800972:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800975:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80097a:	eb 57                	jmp    8009d3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80097c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097f:	8b 10                	mov    (%eax),%edx
+  800981:	8b 48 04             	mov    0x4(%eax),%ecx
+  800984:	8d 40 08             	lea    0x8(%eax),%eax
+  800987:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80098a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80098f:	eb 42                	jmp    8009d3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800991:	8b 45 14             	mov    0x14(%ebp),%eax
+  800994:	8b 10                	mov    (%eax),%edx
+  800996:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099b:	8d 40 04             	lea    0x4(%eax),%eax
+  80099e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009a1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8009a6:	eb 2b                	jmp    8009d3 <vprintfmt+0x426>
+			putch('0', putdat);
+  8009a8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009ab:	83 ec 08             	sub    $0x8,%esp
+  8009ae:	53                   	push   %ebx
+  8009af:	6a 30                	push   $0x30
+  8009b1:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8009b3:	83 c4 08             	add    $0x8,%esp
+  8009b6:	53                   	push   %ebx
+  8009b7:	6a 78                	push   $0x78
+  8009b9:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8009bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009be:	8b 10                	mov    (%eax),%edx
+  8009c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009c5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ce:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8009d3:	83 ec 0c             	sub    $0xc,%esp
+  8009d6:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8009da:	50                   	push   %eax
+  8009db:	ff 75 e4             	push   -0x1c(%ebp)
+  8009de:	56                   	push   %esi
+  8009df:	51                   	push   %ecx
+  8009e0:	52                   	push   %edx
+  8009e1:	89 da                	mov    %ebx,%edx
+  8009e3:	89 f8                	mov    %edi,%eax
+  8009e5:	e8 d8 fa ff ff       	call   8004c2 <printnum>
+			break;
+  8009ea:	83 c4 20             	add    $0x20,%esp
+  8009ed:	e9 cc fb ff ff       	jmp    8005be <vprintfmt+0x11>
+	if (lflag >= 2)
+  8009f2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009f5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009f8:	83 f9 01             	cmp    $0x1,%ecx
+  8009fb:	7f 1b                	jg     800a18 <vprintfmt+0x46b>
+	else if (lflag)
+  8009fd:	85 c9                	test   %ecx,%ecx
+  8009ff:	74 2c                	je     800a2d <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800a01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a04:	8b 10                	mov    (%eax),%edx
+  800a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a0b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a0e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a11:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800a16:	eb bb                	jmp    8009d3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1b:	8b 10                	mov    (%eax),%edx
+  800a1d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a20:	8d 40 08             	lea    0x8(%eax),%eax
+  800a23:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a26:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800a2b:	eb a6                	jmp    8009d3 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a30:	8b 10                	mov    (%eax),%edx
+  800a32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a37:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a3d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800a42:	eb 8f                	jmp    8009d3 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800a44:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a47:	83 ec 08             	sub    $0x8,%esp
+  800a4a:	53                   	push   %ebx
+  800a4b:	6a 25                	push   $0x25
+  800a4d:	ff d7                	call   *%edi
+			break;
+  800a4f:	83 c4 10             	add    $0x10,%esp
+  800a52:	e9 67 fb ff ff       	jmp    8005be <vprintfmt+0x11>
+			putch('%', putdat);
+  800a57:	83 ec 08             	sub    $0x8,%esp
+  800a5a:	53                   	push   %ebx
+  800a5b:	6a 25                	push   $0x25
+  800a5d:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a5f:	83 c4 10             	add    $0x10,%esp
+  800a62:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a66:	0f 84 ba fb ff ff    	je     800626 <vprintfmt+0x79>
+  800a6c:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a6f:	89 f0                	mov    %esi,%eax
+  800a71:	83 e8 01             	sub    $0x1,%eax
+  800a74:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a78:	75 f7                	jne    800a71 <vprintfmt+0x4c4>
+  800a7a:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a7d:	e9 3c fb ff ff       	jmp    8005be <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a82:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a85:	8d 70 01             	lea    0x1(%eax),%esi
+  800a88:	0f b6 00             	movzbl (%eax),%eax
+  800a8b:	0f be d0             	movsbl %al,%edx
+  800a8e:	85 d2                	test   %edx,%edx
+  800a90:	74 11                	je     800aa3 <vprintfmt+0x4f6>
+  800a92:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a95:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a98:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a9b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a9e:	e9 5d fd ff ff       	jmp    800800 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800aa3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800aa6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa9:	e9 10 fb ff ff       	jmp    8005be <vprintfmt+0x11>
+  800aae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ab1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ab4:	e9 05 fb ff ff       	jmp    8005be <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800ab9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800abd:	7e 0a                	jle    800ac9 <vprintfmt+0x51c>
+  800abf:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800ac3:	0f 85 bd fc ff ff    	jne    800786 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ac9:	ba 28 00 00 00       	mov    $0x28,%edx
+  800ace:	b8 28 00 00 00       	mov    $0x28,%eax
+  800ad3:	be 5d 51 80 00       	mov    $0x80515d,%esi
+  800ad8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800adb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ade:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ae1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ae4:	e9 17 fd ff ff       	jmp    800800 <vprintfmt+0x253>
+}
+  800ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	83 ec 18             	sub    $0x18,%esp
+  800af7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800afd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b00:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b04:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b07:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b0e:	85 c0                	test   %eax,%eax
+  800b10:	74 26                	je     800b38 <vsnprintf+0x47>
+  800b12:	85 d2                	test   %edx,%edx
+  800b14:	7e 22                	jle    800b38 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b16:	ff 75 14             	push   0x14(%ebp)
+  800b19:	ff 75 10             	push   0x10(%ebp)
+  800b1c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b1f:	50                   	push   %eax
+  800b20:	68 73 05 80 00       	push   $0x800573
+  800b25:	e8 83 fa ff ff       	call   8005ad <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b2a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b2d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b33:	83 c4 10             	add    $0x10,%esp
+}
+  800b36:	c9                   	leave
+  800b37:	c3                   	ret
+		return -E_INVAL;
+  800b38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b3d:	eb f7                	jmp    800b36 <vsnprintf+0x45>
+
+00800b3f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b45:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b48:	50                   	push   %eax
+  800b49:	ff 75 10             	push   0x10(%ebp)
+  800b4c:	ff 75 0c             	push   0xc(%ebp)
+  800b4f:	ff 75 08             	push   0x8(%ebp)
+  800b52:	e8 9a ff ff ff       	call   800af1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b57:	c9                   	leave
+  800b58:	c3                   	ret
+
+00800b59 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b5f:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b62:	74 10                	je     800b74 <strlen+0x1b>
+  800b64:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b69:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b6c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b70:	75 f7                	jne    800b69 <strlen+0x10>
+	return n;
+}
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b74:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b79:	eb f7                	jmp    800b72 <strlen+0x19>
+
+00800b7b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b7b:	55                   	push   %ebp
+  800b7c:	89 e5                	mov    %esp,%ebp
+  800b7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b81:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b84:	85 d2                	test   %edx,%edx
+  800b86:	74 16                	je     800b9e <strnlen+0x23>
+  800b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b91:	74 09                	je     800b9c <strnlen+0x21>
+		n++;
+  800b93:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b96:	39 d0                	cmp    %edx,%eax
+  800b98:	75 f3                	jne    800b8d <strnlen+0x12>
+		n++;
+  800b9a:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b9c:	5d                   	pop    %ebp
+  800b9d:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba3:	eb f7                	jmp    800b9c <strnlen+0x21>
+
+00800ba5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ba5:	55                   	push   %ebp
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	53                   	push   %ebx
+  800ba9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bb8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bbb:	83 c0 01             	add    $0x1,%eax
+  800bbe:	84 d2                	test   %dl,%dl
+  800bc0:	75 f2                	jne    800bb4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bc2:	89 c8                	mov    %ecx,%eax
+  800bc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc7:	c9                   	leave
+  800bc8:	c3                   	ret
+
+00800bc9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bc9:	55                   	push   %ebp
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	53                   	push   %ebx
+  800bcd:	83 ec 10             	sub    $0x10,%esp
+  800bd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bd3:	53                   	push   %ebx
+  800bd4:	e8 80 ff ff ff       	call   800b59 <strlen>
+  800bd9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bdc:	ff 75 0c             	push   0xc(%ebp)
+  800bdf:	01 d8                	add    %ebx,%eax
+  800be1:	50                   	push   %eax
+  800be2:	e8 be ff ff ff       	call   800ba5 <strcpy>
+	return dst;
+}
+  800be7:	89 d8                	mov    %ebx,%eax
+  800be9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bec:	c9                   	leave
+  800bed:	c3                   	ret
+
+00800bee <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+  800bf3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bf9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bfc:	85 db                	test   %ebx,%ebx
+  800bfe:	74 17                	je     800c17 <strncpy+0x29>
+  800c00:	01 f3                	add    %esi,%ebx
+  800c02:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800c04:	83 c0 01             	add    $0x1,%eax
+  800c07:	0f b6 0a             	movzbl (%edx),%ecx
+  800c0a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c0d:	80 f9 01             	cmp    $0x1,%cl
+  800c10:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c13:	39 c3                	cmp    %eax,%ebx
+  800c15:	75 ed                	jne    800c04 <strncpy+0x16>
+	}
+	return ret;
+}
+  800c17:	89 f0                	mov    %esi,%eax
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+
+00800c1d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	56                   	push   %esi
+  800c21:	53                   	push   %ebx
+  800c22:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c2b:	89 f0                	mov    %esi,%eax
+  800c2d:	85 db                	test   %ebx,%ebx
+  800c2f:	74 1e                	je     800c4f <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800c31:	83 eb 01             	sub    $0x1,%ebx
+  800c34:	74 16                	je     800c4c <strlcpy+0x2f>
+  800c36:	01 f3                	add    %esi,%ebx
+  800c38:	0f b6 0a             	movzbl (%edx),%ecx
+  800c3b:	84 c9                	test   %cl,%cl
+  800c3d:	74 0d                	je     800c4c <strlcpy+0x2f>
+			*dst++ = *src++;
+  800c3f:	83 c2 01             	add    $0x1,%edx
+  800c42:	83 c0 01             	add    $0x1,%eax
+  800c45:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800c48:	39 d8                	cmp    %ebx,%eax
+  800c4a:	75 ec                	jne    800c38 <strlcpy+0x1b>
+		*dst = '\0';
+  800c4c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c4f:	29 f0                	sub    %esi,%eax
+}
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+
+00800c55 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c5b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c5e:	0f b6 01             	movzbl (%ecx),%eax
+  800c61:	84 c0                	test   %al,%al
+  800c63:	74 11                	je     800c76 <strcmp+0x21>
+  800c65:	38 02                	cmp    %al,(%edx)
+  800c67:	75 0d                	jne    800c76 <strcmp+0x21>
+		p++, q++;
+  800c69:	83 c1 01             	add    $0x1,%ecx
+  800c6c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c6f:	0f b6 01             	movzbl (%ecx),%eax
+  800c72:	84 c0                	test   %al,%al
+  800c74:	75 ef                	jne    800c65 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c76:	0f b6 c0             	movzbl %al,%eax
+  800c79:	0f b6 12             	movzbl (%edx),%edx
+  800c7c:	29 d0                	sub    %edx,%eax
+}
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	53                   	push   %ebx
+  800c84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c8a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c92:	85 d2                	test   %edx,%edx
+  800c94:	74 2e                	je     800cc4 <strncmp+0x44>
+  800c96:	0f b6 01             	movzbl (%ecx),%eax
+  800c99:	84 c0                	test   %al,%al
+  800c9b:	74 16                	je     800cb3 <strncmp+0x33>
+  800c9d:	3a 03                	cmp    (%ebx),%al
+  800c9f:	75 12                	jne    800cb3 <strncmp+0x33>
+		n--, p++, q++;
+  800ca1:	83 c1 01             	add    $0x1,%ecx
+  800ca4:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800ca7:	83 ea 01             	sub    $0x1,%edx
+  800caa:	75 ea                	jne    800c96 <strncmp+0x16>
+		return 0;
+  800cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb1:	eb 11                	jmp    800cc4 <strncmp+0x44>
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800cb8:	85 d2                	test   %edx,%edx
+  800cba:	74 08                	je     800cc4 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cbc:	0f b6 01             	movzbl (%ecx),%eax
+  800cbf:	0f b6 13             	movzbl (%ebx),%edx
+  800cc2:	29 d0                	sub    %edx,%eax
+}
+  800cc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cc7:	c9                   	leave
+  800cc8:	c3                   	ret
+
+00800cc9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ccf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cd3:	0f b6 10             	movzbl (%eax),%edx
+  800cd6:	84 d2                	test   %dl,%dl
+  800cd8:	74 15                	je     800cef <strchr+0x26>
+		if (*s == c)
+  800cda:	38 d1                	cmp    %dl,%cl
+  800cdc:	74 0f                	je     800ced <strchr+0x24>
+	for (; *s; s++)
+  800cde:	83 c0 01             	add    $0x1,%eax
+  800ce1:	0f b6 10             	movzbl (%eax),%edx
+  800ce4:	84 d2                	test   %dl,%dl
+  800ce6:	75 f2                	jne    800cda <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+	return 0;
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf4:	eb f7                	jmp    800ced <strchr+0x24>
+
+00800cf6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	53                   	push   %ebx
+  800cfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cfd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800d00:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800d03:	38 d3                	cmp    %dl,%bl
+  800d05:	74 14                	je     800d1b <strfind+0x25>
+  800d07:	89 d1                	mov    %edx,%ecx
+  800d09:	84 db                	test   %bl,%bl
+  800d0b:	74 0e                	je     800d1b <strfind+0x25>
+	for (; *s; s++)
+  800d0d:	83 c0 01             	add    $0x1,%eax
+  800d10:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d13:	38 ca                	cmp    %cl,%dl
+  800d15:	74 04                	je     800d1b <strfind+0x25>
+  800d17:	84 d2                	test   %dl,%dl
+  800d19:	75 f2                	jne    800d0d <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800d1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d1e:	c9                   	leave
+  800d1f:	c3                   	ret
+
+00800d20 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	57                   	push   %edi
+  800d24:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d27:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d2a:	85 c9                	test   %ecx,%ecx
+  800d2c:	74 20                	je     800d4e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d2e:	89 f8                	mov    %edi,%eax
+  800d30:	09 c8                	or     %ecx,%eax
+  800d32:	a8 03                	test   $0x3,%al
+  800d34:	75 12                	jne    800d48 <memset+0x28>
+		c &= 0xFF;
+  800d36:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d3a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d40:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d43:	fc                   	cld
+  800d44:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d46:	eb 06                	jmp    800d4e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d4b:	fc                   	cld
+  800d4c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d4e:	89 f8                	mov    %edi,%eax
+  800d50:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d53:	c9                   	leave
+  800d54:	c3                   	ret
+
+00800d55 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	57                   	push   %edi
+  800d59:	56                   	push   %esi
+  800d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d60:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d63:	39 c6                	cmp    %eax,%esi
+  800d65:	73 32                	jae    800d99 <memmove+0x44>
+  800d67:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d6a:	39 d0                	cmp    %edx,%eax
+  800d6c:	73 2b                	jae    800d99 <memmove+0x44>
+		s += n;
+		d += n;
+  800d6e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d71:	89 d6                	mov    %edx,%esi
+  800d73:	09 fe                	or     %edi,%esi
+  800d75:	09 ce                	or     %ecx,%esi
+  800d77:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d7d:	75 0e                	jne    800d8d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d7f:	83 ef 04             	sub    $0x4,%edi
+  800d82:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d85:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d88:	fd                   	std
+  800d89:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d8b:	eb 09                	jmp    800d96 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d8d:	83 ef 01             	sub    $0x1,%edi
+  800d90:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d93:	fd                   	std
+  800d94:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d96:	fc                   	cld
+  800d97:	eb 1a                	jmp    800db3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d99:	89 f2                	mov    %esi,%edx
+  800d9b:	09 c2                	or     %eax,%edx
+  800d9d:	09 ca                	or     %ecx,%edx
+  800d9f:	f6 c2 03             	test   $0x3,%dl
+  800da2:	75 0a                	jne    800dae <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800da4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800da7:	89 c7                	mov    %eax,%edi
+  800da9:	fc                   	cld
+  800daa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dac:	eb 05                	jmp    800db3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800dae:	89 c7                	mov    %eax,%edi
+  800db0:	fc                   	cld
+  800db1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+
+00800db7 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dbd:	ff 75 10             	push   0x10(%ebp)
+  800dc0:	ff 75 0c             	push   0xc(%ebp)
+  800dc3:	ff 75 08             	push   0x8(%ebp)
+  800dc6:	e8 8a ff ff ff       	call   800d55 <memmove>
+}
+  800dcb:	c9                   	leave
+  800dcc:	c3                   	ret
+
+00800dcd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	56                   	push   %esi
+  800dd1:	53                   	push   %ebx
+  800dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dd8:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ddb:	85 f6                	test   %esi,%esi
+  800ddd:	74 29                	je     800e08 <memcmp+0x3b>
+  800ddf:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800de1:	0f b6 08             	movzbl (%eax),%ecx
+  800de4:	0f b6 1a             	movzbl (%edx),%ebx
+  800de7:	38 d9                	cmp    %bl,%cl
+  800de9:	75 11                	jne    800dfc <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800deb:	83 c0 01             	add    $0x1,%eax
+  800dee:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800df1:	39 c6                	cmp    %eax,%esi
+  800df3:	75 ec                	jne    800de1 <memcmp+0x14>
+	}
+
+	return 0;
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfa:	eb 08                	jmp    800e04 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800dfc:	0f b6 c1             	movzbl %cl,%eax
+  800dff:	0f b6 db             	movzbl %bl,%ebx
+  800e02:	29 d8                	sub    %ebx,%eax
+}
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5d                   	pop    %ebp
+  800e07:	c3                   	ret
+	return 0;
+  800e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0d:	eb f5                	jmp    800e04 <memcmp+0x37>
+
+00800e0f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e18:	89 c2                	mov    %eax,%edx
+  800e1a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e1d:	39 d0                	cmp    %edx,%eax
+  800e1f:	73 0d                	jae    800e2e <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e21:	38 08                	cmp    %cl,(%eax)
+  800e23:	74 0d                	je     800e32 <memfind+0x23>
+	for (; s < ends; s++)
+  800e25:	83 c0 01             	add    $0x1,%eax
+  800e28:	39 c2                	cmp    %eax,%edx
+  800e2a:	75 f5                	jne    800e21 <memfind+0x12>
+  800e2c:	eb 06                	jmp    800e34 <memfind+0x25>
+  800e2e:	89 c2                	mov    %eax,%edx
+  800e30:	eb 02                	jmp    800e34 <memfind+0x25>
+  800e32:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800e34:	89 d0                	mov    %edx,%eax
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+
+00800e38 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	57                   	push   %edi
+  800e3c:	56                   	push   %esi
+  800e3d:	53                   	push   %ebx
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e44:	0f b6 02             	movzbl (%edx),%eax
+  800e47:	3c 20                	cmp    $0x20,%al
+  800e49:	74 04                	je     800e4f <strtol+0x17>
+  800e4b:	3c 09                	cmp    $0x9,%al
+  800e4d:	75 0e                	jne    800e5d <strtol+0x25>
+		s++;
+  800e4f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e52:	0f b6 02             	movzbl (%edx),%eax
+  800e55:	3c 20                	cmp    $0x20,%al
+  800e57:	74 f6                	je     800e4f <strtol+0x17>
+  800e59:	3c 09                	cmp    $0x9,%al
+  800e5b:	74 f2                	je     800e4f <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e5d:	3c 2b                	cmp    $0x2b,%al
+  800e5f:	74 2a                	je     800e8b <strtol+0x53>
+	int neg = 0;
+  800e61:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e66:	3c 2d                	cmp    $0x2d,%al
+  800e68:	74 2b                	je     800e95 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e6a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e70:	75 0f                	jne    800e81 <strtol+0x49>
+  800e72:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e75:	74 28                	je     800e9f <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e77:	85 db                	test   %ebx,%ebx
+  800e79:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e7e:	0f 44 d8             	cmove  %eax,%ebx
+  800e81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e86:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e89:	eb 46                	jmp    800ed1 <strtol+0x99>
+		s++;
+  800e8b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e93:	eb d5                	jmp    800e6a <strtol+0x32>
+		s++, neg = 1;
+  800e95:	83 c2 01             	add    $0x1,%edx
+  800e98:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e9d:	eb cb                	jmp    800e6a <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e9f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ea3:	74 0e                	je     800eb3 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800ea5:	85 db                	test   %ebx,%ebx
+  800ea7:	75 d8                	jne    800e81 <strtol+0x49>
+		s++, base = 8;
+  800ea9:	83 c2 01             	add    $0x1,%edx
+  800eac:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800eb1:	eb ce                	jmp    800e81 <strtol+0x49>
+		s += 2, base = 16;
+  800eb3:	83 c2 02             	add    $0x2,%edx
+  800eb6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ebb:	eb c4                	jmp    800e81 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ebd:	0f be c0             	movsbl %al,%eax
+  800ec0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ec3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ec6:	7d 3a                	jge    800f02 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800ec8:	83 c2 01             	add    $0x1,%edx
+  800ecb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ecf:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ed1:	0f b6 02             	movzbl (%edx),%eax
+  800ed4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ed7:	89 f3                	mov    %esi,%ebx
+  800ed9:	80 fb 09             	cmp    $0x9,%bl
+  800edc:	76 df                	jbe    800ebd <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800ede:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ee1:	89 f3                	mov    %esi,%ebx
+  800ee3:	80 fb 19             	cmp    $0x19,%bl
+  800ee6:	77 08                	ja     800ef0 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800ee8:	0f be c0             	movsbl %al,%eax
+  800eeb:	83 e8 57             	sub    $0x57,%eax
+  800eee:	eb d3                	jmp    800ec3 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ef0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ef3:	89 f3                	mov    %esi,%ebx
+  800ef5:	80 fb 19             	cmp    $0x19,%bl
+  800ef8:	77 08                	ja     800f02 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800efa:	0f be c0             	movsbl %al,%eax
+  800efd:	83 e8 37             	sub    $0x37,%eax
+  800f00:	eb c1                	jmp    800ec3 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f02:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f06:	74 05                	je     800f0d <strtol+0xd5>
+		*endptr = (char *) s;
+  800f08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f0b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f0d:	89 c8                	mov    %ecx,%eax
+  800f0f:	f7 d8                	neg    %eax
+  800f11:	85 ff                	test   %edi,%edi
+  800f13:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f16:	89 c8                	mov    %ecx,%eax
+  800f18:	5b                   	pop    %ebx
+  800f19:	5e                   	pop    %esi
+  800f1a:	5f                   	pop    %edi
+  800f1b:	5d                   	pop    %ebp
+  800f1c:	c3                   	ret
+
+00800f1d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	57                   	push   %edi
+  800f21:	56                   	push   %esi
+  800f22:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	89 c3                	mov    %eax,%ebx
+  800f30:	89 c7                	mov    %eax,%edi
+  800f32:	89 c6                	mov    %eax,%esi
+  800f34:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f46:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f4b:	89 d1                	mov    %edx,%ecx
+  800f4d:	89 d3                	mov    %edx,%ebx
+  800f4f:	89 d7                	mov    %edx,%edi
+  800f51:	89 d6                	mov    %edx,%esi
+  800f53:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f55:	5b                   	pop    %ebx
+  800f56:	5e                   	pop    %esi
+  800f57:	5f                   	pop    %edi
+  800f58:	5d                   	pop    %ebp
+  800f59:	c3                   	ret
+
+00800f5a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	56                   	push   %esi
+  800f5f:	53                   	push   %ebx
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f70:	89 cb                	mov    %ecx,%ebx
+  800f72:	89 cf                	mov    %ecx,%edi
+  800f74:	89 ce                	mov    %ecx,%esi
+  800f76:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f78:	85 c0                	test   %eax,%eax
+  800f7a:	7f 08                	jg     800f84 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7f:	5b                   	pop    %ebx
+  800f80:	5e                   	pop    %esi
+  800f81:	5f                   	pop    %edi
+  800f82:	5d                   	pop    %ebp
+  800f83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f84:	83 ec 0c             	sub    $0xc,%esp
+  800f87:	50                   	push   %eax
+  800f88:	6a 03                	push   $0x3
+  800f8a:	68 8b 54 80 00       	push   $0x80548b
+  800f8f:	6a 23                	push   $0x23
+  800f91:	68 a8 54 80 00       	push   $0x8054a8
+  800f96:	e8 38 f4 ff ff       	call   8003d3 <_panic>
+
+00800f9b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fab:	89 d1                	mov    %edx,%ecx
+  800fad:	89 d3                	mov    %edx,%ebx
+  800faf:	89 d7                	mov    %edx,%edi
+  800fb1:	89 d6                	mov    %edx,%esi
+  800fb3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+
+00800fba <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fca:	89 d1                	mov    %edx,%ecx
+  800fcc:	89 d3                	mov    %edx,%ebx
+  800fce:	89 d7                	mov    %edx,%edi
+  800fd0:	89 d6                	mov    %edx,%esi
+  800fd2:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fd4:	5b                   	pop    %ebx
+  800fd5:	5e                   	pop    %esi
+  800fd6:	5f                   	pop    %edi
+  800fd7:	5d                   	pop    %ebp
+  800fd8:	c3                   	ret
+
+00800fd9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	57                   	push   %edi
+  800fdd:	56                   	push   %esi
+  800fde:	53                   	push   %ebx
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fed:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ff2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff5:	89 f7                	mov    %esi,%edi
+  800ff7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	7f 08                	jg     801005 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801005:	83 ec 0c             	sub    $0xc,%esp
+  801008:	50                   	push   %eax
+  801009:	6a 04                	push   $0x4
+  80100b:	68 8b 54 80 00       	push   $0x80548b
+  801010:	6a 23                	push   $0x23
+  801012:	68 a8 54 80 00       	push   $0x8054a8
+  801017:	e8 b7 f3 ff ff       	call   8003d3 <_panic>
+
+0080101c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801030:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801033:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801036:	8b 75 18             	mov    0x18(%ebp),%esi
+  801039:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 08                	jg     801047 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 05                	push   $0x5
+  80104d:	68 8b 54 80 00       	push   $0x80548b
+  801052:	6a 23                	push   $0x23
+  801054:	68 a8 54 80 00       	push   $0x8054a8
+  801059:	e8 75 f3 ff ff       	call   8003d3 <_panic>
+
+0080105e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801067:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801072:	b8 06 00 00 00       	mov    $0x6,%eax
+  801077:	89 df                	mov    %ebx,%edi
+  801079:	89 de                	mov    %ebx,%esi
+  80107b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	7f 08                	jg     801089 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801081:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801084:	5b                   	pop    %ebx
+  801085:	5e                   	pop    %esi
+  801086:	5f                   	pop    %edi
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801089:	83 ec 0c             	sub    $0xc,%esp
+  80108c:	50                   	push   %eax
+  80108d:	6a 06                	push   $0x6
+  80108f:	68 8b 54 80 00       	push   $0x80548b
+  801094:	6a 23                	push   $0x23
+  801096:	68 a8 54 80 00       	push   $0x8054a8
+  80109b:	e8 33 f3 ff ff       	call   8003d3 <_panic>
+
+008010a0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010b9:	89 df                	mov    %ebx,%edi
+  8010bb:	89 de                	mov    %ebx,%esi
+  8010bd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010bf:	85 c0                	test   %eax,%eax
+  8010c1:	7f 08                	jg     8010cb <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c6:	5b                   	pop    %ebx
+  8010c7:	5e                   	pop    %esi
+  8010c8:	5f                   	pop    %edi
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 08                	push   $0x8
+  8010d1:	68 8b 54 80 00       	push   $0x80548b
+  8010d6:	6a 23                	push   $0x23
+  8010d8:	68 a8 54 80 00       	push   $0x8054a8
+  8010dd:	e8 f1 f2 ff ff       	call   8003d3 <_panic>
+
+008010e2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  8010e8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010fb:	89 df                	mov    %ebx,%edi
+  8010fd:	89 de                	mov    %ebx,%esi
+  8010ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801101:	85 c0                	test   %eax,%eax
+  801103:	7f 08                	jg     80110d <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+  801110:	50                   	push   %eax
+  801111:	6a 09                	push   $0x9
+  801113:	68 8b 54 80 00       	push   $0x80548b
+  801118:	6a 23                	push   $0x23
+  80111a:	68 a8 54 80 00       	push   $0x8054a8
+  80111f:	e8 af f2 ff ff       	call   8003d3 <_panic>
+
+00801124 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+  80112a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801132:	8b 55 08             	mov    0x8(%ebp),%edx
+  801135:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801138:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80113d:	89 df                	mov    %ebx,%edi
+  80113f:	89 de                	mov    %ebx,%esi
+  801141:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801143:	85 c0                	test   %eax,%eax
+  801145:	7f 08                	jg     80114f <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114a:	5b                   	pop    %ebx
+  80114b:	5e                   	pop    %esi
+  80114c:	5f                   	pop    %edi
+  80114d:	5d                   	pop    %ebp
+  80114e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+  801152:	50                   	push   %eax
+  801153:	6a 0a                	push   $0xa
+  801155:	68 8b 54 80 00       	push   $0x80548b
+  80115a:	6a 23                	push   $0x23
+  80115c:	68 a8 54 80 00       	push   $0x8054a8
+  801161:	e8 6d f2 ff ff       	call   8003d3 <_panic>
+
+00801166 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	57                   	push   %edi
+  80116a:	56                   	push   %esi
+  80116b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801172:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801177:	be 00 00 00 00       	mov    $0x0,%esi
+  80117c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801182:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801192:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801197:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80119f:	89 cb                	mov    %ecx,%ebx
+  8011a1:	89 cf                	mov    %ecx,%edi
+  8011a3:	89 ce                	mov    %ecx,%esi
+  8011a5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	7f 08                	jg     8011b3 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+  8011b6:	50                   	push   %eax
+  8011b7:	6a 0d                	push   $0xd
+  8011b9:	68 8b 54 80 00       	push   $0x80548b
+  8011be:	6a 23                	push   $0x23
+  8011c0:	68 a8 54 80 00       	push   $0x8054a8
+  8011c5:	e8 09 f2 ff ff       	call   8003d3 <_panic>
+
+008011ca <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011e4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+
+008011eb <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8011eb:	55                   	push   %ebp
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	57                   	push   %edi
+  8011ef:	56                   	push   %esi
+  8011f0:	53                   	push   %ebx
+  8011f1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801204:	89 df                	mov    %ebx,%edi
+  801206:	89 de                	mov    %ebx,%esi
+  801208:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80120a:	85 c0                	test   %eax,%eax
+  80120c:	7f 08                	jg     801216 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80120e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801211:	5b                   	pop    %ebx
+  801212:	5e                   	pop    %esi
+  801213:	5f                   	pop    %edi
+  801214:	5d                   	pop    %ebp
+  801215:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801216:	83 ec 0c             	sub    $0xc,%esp
+  801219:	50                   	push   %eax
+  80121a:	6a 0d                	push   $0xd
+  80121c:	68 8b 54 80 00       	push   $0x80548b
+  801221:	6a 23                	push   $0x23
+  801223:	68 a8 54 80 00       	push   $0x8054a8
+  801228:	e8 a6 f1 ff ff       	call   8003d3 <_panic>
+
+0080122d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80122d:	55                   	push   %ebp
+  80122e:	89 e5                	mov    %esp,%ebp
+  801230:	57                   	push   %edi
+  801231:	56                   	push   %esi
+  801232:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801233:	ba 00 00 00 00       	mov    $0x0,%edx
+  801238:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80123d:	89 d1                	mov    %edx,%ecx
+  80123f:	89 d3                	mov    %edx,%ebx
+  801241:	89 d7                	mov    %edx,%edi
+  801243:	89 d6                	mov    %edx,%esi
+  801245:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+
+0080124c <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801252:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801262:	89 df                	mov    %ebx,%edi
+  801264:	89 de                	mov    %ebx,%esi
+  801266:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801268:	5b                   	pop    %ebx
+  801269:	5e                   	pop    %esi
+  80126a:	5f                   	pop    %edi
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+
+0080126d <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801273:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801280:	89 cb                	mov    %ecx,%ebx
+  801282:	89 cf                	mov    %ecx,%edi
+  801284:	89 ce                	mov    %ecx,%esi
+  801286:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+
+0080128d <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	57                   	push   %edi
+  801291:	56                   	push   %esi
+  801292:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129e:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012a3:	89 df                	mov    %ebx,%edi
+  8012a5:	89 de                	mov    %ebx,%esi
+  8012a7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+
+008012ae <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012c4:	89 df                	mov    %ebx,%edi
+  8012c6:	89 de                	mov    %ebx,%esi
+  8012c8:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8012ca:	5b                   	pop    %ebx
+  8012cb:	5e                   	pop    %esi
+  8012cc:	5f                   	pop    %edi
+  8012cd:	5d                   	pop    %ebp
+  8012ce:	c3                   	ret
+
+008012cf <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	57                   	push   %edi
+  8012d3:	56                   	push   %esi
+  8012d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012e2:	89 cb                	mov    %ecx,%ebx
+  8012e4:	89 cf                	mov    %ecx,%edi
+  8012e6:	89 ce                	mov    %ecx,%esi
+  8012e8:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801300:	b8 14 00 00 00       	mov    $0x14,%eax
+  801305:	89 df                	mov    %ebx,%edi
+  801307:	89 de                	mov    %ebx,%esi
+  801309:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80130b:	5b                   	pop    %ebx
+  80130c:	5e                   	pop    %esi
+  80130d:	5f                   	pop    %edi
+  80130e:	5d                   	pop    %ebp
+  80130f:	c3                   	ret
+
+00801310 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	57                   	push   %edi
+  801314:	56                   	push   %esi
+  801315:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801316:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80131b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801323:	89 cb                	mov    %ecx,%ebx
+  801325:	89 cf                	mov    %ecx,%edi
+  801327:	89 ce                	mov    %ecx,%esi
+  801329:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+
+00801330 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	56                   	push   %esi
+  801335:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801336:	be 00 00 00 00       	mov    $0x0,%esi
+  80133b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801341:	b8 16 00 00 00       	mov    $0x16,%eax
+  801346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801349:	89 f7                	mov    %esi,%edi
+  80134b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5f                   	pop    %edi
+  801350:	5d                   	pop    %ebp
+  801351:	c3                   	ret
+
+00801352 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	57                   	push   %edi
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801358:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801363:	b8 17 00 00 00       	mov    $0x17,%eax
+  801368:	89 df                	mov    %ebx,%edi
+  80136a:	89 de                	mov    %ebx,%esi
+  80136c:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5f                   	pop    %edi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+
+00801373 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	57                   	push   %edi
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801379:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801381:	b8 18 00 00 00       	mov    $0x18,%eax
+  801386:	89 cb                	mov    %ecx,%ebx
+  801388:	89 cf                	mov    %ecx,%edi
+  80138a:	89 ce                	mov    %ecx,%esi
+  80138c:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80138e:	5b                   	pop    %ebx
+  80138f:	5e                   	pop    %esi
+  801390:	5f                   	pop    %edi
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+
+00801393 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	57                   	push   %edi
+  801397:	56                   	push   %esi
+  801398:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801399:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80139d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013aa:	89 df                	mov    %ebx,%edi
+  8013ac:	89 de                	mov    %ebx,%esi
+  8013ae:	cd 30                	int    $0x30
+}
+  8013b0:	5b                   	pop    %ebx
+  8013b1:	5e                   	pop    %esi
+  8013b2:	5f                   	pop    %edi
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+
+008013b5 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	57                   	push   %edi
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ce:	89 f7                	mov    %esi,%edi
+  8013d0:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+
+008013d7 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	57                   	push   %edi
+  8013db:	56                   	push   %esi
+  8013dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f0:	89 f7                	mov    %esi,%edi
+  8013f2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8013f4:	5b                   	pop    %ebx
+  8013f5:	5e                   	pop    %esi
+  8013f6:	5f                   	pop    %edi
+  8013f7:	5d                   	pop    %ebp
+  8013f8:	c3                   	ret
+
+008013f9 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	57                   	push   %edi
+  8013fd:	56                   	push   %esi
+  8013fe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801404:	8b 55 08             	mov    0x8(%ebp),%edx
+  801407:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80140f:	89 df                	mov    %ebx,%edi
+  801411:	89 de                	mov    %ebx,%esi
+  801413:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+
+0080141a <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	57                   	push   %edi
+  80141e:	56                   	push   %esi
+  80141f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801420:	be 00 00 00 00       	mov    $0x0,%esi
+  801425:	8b 55 08             	mov    0x8(%ebp),%edx
+  801428:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801430:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801433:	89 f7                	mov    %esi,%edi
+  801435:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5f                   	pop    %edi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+
+0080143c <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	74 20                	je     801460 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  801440:	89 c1                	mov    %eax,%ecx
+  801442:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801448:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80144e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801454:	8b 52 48             	mov    0x48(%edx),%edx
+  801457:	39 c2                	cmp    %eax,%edx
+  801459:	74 06                	je     801461 <thread_alive+0x25>
+  80145b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801460:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801461:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801467:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  80146d:	85 c0                	test   %eax,%eax
+  80146f:	0f 95 c0             	setne  %al
+  801472:	0f b6 c0             	movzbl %al,%eax
+  801475:	c3                   	ret
+
+00801476 <pgfault>:
+{
+  801476:	55                   	push   %ebp
+  801477:	89 e5                	mov    %esp,%ebp
+  801479:	57                   	push   %edi
+  80147a:	56                   	push   %esi
+  80147b:	53                   	push   %ebx
+  80147c:	83 ec 0c             	sub    $0xc,%esp
+  80147f:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801482:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801484:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801487:	89 f3                	mov    %esi,%ebx
+  801489:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  80148c:	83 3d c0 c0 80 00 00 	cmpl   $0x0,0x80c0c0
+  801493:	74 52                	je     8014e7 <pgfault+0x71>
+  801495:	a8 02                	test   $0x2,%al
+  801497:	75 14                	jne    8014ad <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801499:	83 ec 04             	sub    $0x4,%esp
+  80149c:	68 b6 54 80 00       	push   $0x8054b6
+  8014a1:	6a 2e                	push   $0x2e
+  8014a3:	68 d4 54 80 00       	push   $0x8054d4
+  8014a8:	e8 26 ef ff ff       	call   8003d3 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8014ad:	89 d8                	mov    %ebx,%eax
+  8014af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014b4:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8014bb:	83 ec 0c             	sub    $0xc,%esp
+  8014be:	57                   	push   %edi
+  8014bf:	e8 65 32 00 00       	call   804729 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  8014c4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8014cb:	83 e0 03             	and    $0x3,%eax
+  8014ce:	83 c4 10             	add    $0x10,%esp
+  8014d1:	83 f8 03             	cmp    $0x3,%eax
+  8014d4:	75 1a                	jne    8014f0 <pgfault+0x7a>
+			mutex_unlock(m);
+  8014d6:	83 ec 0c             	sub    $0xc,%esp
+  8014d9:	57                   	push   %edi
+  8014da:	e8 b8 32 00 00       	call   804797 <mutex_unlock>
+			return;
+  8014df:	83 c4 10             	add    $0x10,%esp
+  8014e2:	e9 9f 00 00 00       	jmp    801586 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8014e7:	a8 02                	test   $0x2,%al
+  8014e9:	74 ae                	je     801499 <pgfault+0x23>
+	struct mutex *m = NULL;
+  8014eb:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8014f0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8014f7:	f6 c4 08             	test   $0x8,%ah
+  8014fa:	74 9d                	je     801499 <pgfault+0x23>
+  8014fc:	89 e0                	mov    %esp,%eax
+  8014fe:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801503:	29 c2                	sub    %eax,%edx
+  801505:	89 d0                	mov    %edx,%eax
+  801507:	c1 e8 0f             	shr    $0xf,%eax
+  80150a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801510:	ba 00 00 00 00       	mov    $0x0,%edx
+  801515:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801518:	c1 e0 0c             	shl    $0xc,%eax
+  80151b:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801520:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801522:	83 ec 04             	sub    $0x4,%esp
+  801525:	6a 07                	push   $0x7
+  801527:	53                   	push   %ebx
+  801528:	6a 00                	push   $0x0
+  80152a:	e8 aa fa ff ff       	call   800fd9 <sys_page_alloc>
+  80152f:	83 c4 10             	add    $0x10,%esp
+  801532:	85 c0                	test   %eax,%eax
+  801534:	78 58                	js     80158e <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801536:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80153c:	83 ec 04             	sub    $0x4,%esp
+  80153f:	68 00 10 00 00       	push   $0x1000
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+  801546:	e8 0a f8 ff ff       	call   800d55 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  80154b:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801552:	56                   	push   %esi
+  801553:	6a 00                	push   $0x0
+  801555:	53                   	push   %ebx
+  801556:	6a 00                	push   $0x0
+  801558:	e8 bf fa ff ff       	call   80101c <sys_page_map>
+  80155d:	83 c4 20             	add    $0x20,%esp
+  801560:	85 c0                	test   %eax,%eax
+  801562:	78 3c                	js     8015a0 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801564:	83 ec 08             	sub    $0x8,%esp
+  801567:	53                   	push   %ebx
+  801568:	6a 00                	push   $0x0
+  80156a:	e8 ef fa ff ff       	call   80105e <sys_page_unmap>
+  80156f:	83 c4 10             	add    $0x10,%esp
+  801572:	85 c0                	test   %eax,%eax
+  801574:	78 3c                	js     8015b2 <pgfault+0x13c>
+	if(m)
+  801576:	85 ff                	test   %edi,%edi
+  801578:	74 0c                	je     801586 <pgfault+0x110>
+		mutex_unlock(m);
+  80157a:	83 ec 0c             	sub    $0xc,%esp
+  80157d:	57                   	push   %edi
+  80157e:	e8 14 32 00 00       	call   804797 <mutex_unlock>
+  801583:	83 c4 10             	add    $0x10,%esp
+}
+  801586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801589:	5b                   	pop    %ebx
+  80158a:	5e                   	pop    %esi
+  80158b:	5f                   	pop    %edi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  80158e:	50                   	push   %eax
+  80158f:	68 df 54 80 00       	push   $0x8054df
+  801594:	6a 3d                	push   $0x3d
+  801596:	68 d4 54 80 00       	push   $0x8054d4
+  80159b:	e8 33 ee ff ff       	call   8003d3 <_panic>
+		panic("sys_page_map: %e", ret);
+  8015a0:	50                   	push   %eax
+  8015a1:	68 f2 54 80 00       	push   $0x8054f2
+  8015a6:	6a 40                	push   $0x40
+  8015a8:	68 d4 54 80 00       	push   $0x8054d4
+  8015ad:	e8 21 ee ff ff       	call   8003d3 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8015b2:	50                   	push   %eax
+  8015b3:	68 03 55 80 00       	push   $0x805503
+  8015b8:	6a 42                	push   $0x42
+  8015ba:	68 d4 54 80 00       	push   $0x8054d4
+  8015bf:	e8 0f ee ff ff       	call   8003d3 <_panic>
+
+008015c4 <thread_main>:
+{
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  8015ca:	ff 75 0c             	push   0xc(%ebp)
+  8015cd:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8015d0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8015d7:	e8 7e f9 ff ff       	call   800f5a <sys_env_destroy>
+}
+  8015dc:	83 c4 10             	add    $0x10,%esp
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+
+008015e1 <fork>:
+{
+  8015e1:	55                   	push   %ebp
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	57                   	push   %edi
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+  8015e7:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  8015ea:	68 76 14 80 00       	push   $0x801476
+  8015ef:	e8 81 34 00 00       	call   804a75 <set_pgfault_handler>
+	if(sforked)
+  8015f4:	83 c4 10             	add    $0x10,%esp
+  8015f7:	83 3d c0 c0 80 00 00 	cmpl   $0x0,0x80c0c0
+  8015fe:	75 33                	jne    801633 <fork+0x52>
+	__asm __volatile("int %2"
+  801600:	b8 07 00 00 00       	mov    $0x7,%eax
+  801605:	cd 30                	int    $0x30
+  801607:	89 c7                	mov    %eax,%edi
+  801609:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  80160b:	85 c0                	test   %eax,%eax
+  80160d:	0f 88 b4 00 00 00    	js     8016c7 <fork+0xe6>
+	if(envid == 0) {
+  801613:	0f 84 c3 00 00 00    	je     8016dc <fork+0xfb>
+	pgbatch_init(&pb);
+  801619:	83 ec 0c             	sub    $0xc,%esp
+  80161c:	68 20 b3 80 00       	push   $0x80b320
+  801621:	e8 4f 2f 00 00       	call   804575 <pgbatch_init>
+  801626:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801629:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162e:	e9 9c 01 00 00       	jmp    8017cf <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801633:	83 ec 0c             	sub    $0xc,%esp
+  801636:	68 c0 b6 80 00       	push   $0x80b6c0
+  80163b:	e8 e9 30 00 00       	call   804729 <mutex_lock>
+  801640:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801643:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801648:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  80164d:	eb 08                	jmp    801657 <fork+0x76>
+  80164f:	83 c3 01             	add    $0x1,%ebx
+  801652:	83 fb 20             	cmp    $0x20,%ebx
+  801655:	74 5b                	je     8016b2 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801657:	8b 34 9d 40 b6 80 00 	mov    0x80b640(,%ebx,4),%esi
+  80165e:	89 f0                	mov    %esi,%eax
+  801660:	e8 d7 fd ff ff       	call   80143c <thread_alive>
+  801665:	85 c0                	test   %eax,%eax
+  801667:	74 e6                	je     80164f <fork+0x6e>
+  801669:	89 e0                	mov    %esp,%eax
+  80166b:	89 fa                	mov    %edi,%edx
+  80166d:	29 c2                	sub    %eax,%edx
+  80166f:	89 d0                	mov    %edx,%eax
+  801671:	c1 e8 0f             	shr    $0xf,%eax
+  801674:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80167a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80167f:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  801682:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  801689:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  80168c:	83 ec 08             	sub    $0x8,%esp
+  80168f:	50                   	push   %eax
+  801690:	56                   	push   %esi
+  801691:	e8 8e fa ff ff       	call   801124 <sys_env_set_pgfault_upcall>
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	79 b2                	jns    80164f <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  80169d:	50                   	push   %eax
+  80169e:	68 90 55 80 00       	push   $0x805590
+  8016a3:	68 00 01 00 00       	push   $0x100
+  8016a8:	68 d4 54 80 00       	push   $0x8054d4
+  8016ad:	e8 21 ed ff ff       	call   8003d3 <_panic>
+	mutex_unlock(&sfork_lock);
+  8016b2:	83 ec 0c             	sub    $0xc,%esp
+  8016b5:	68 c0 b6 80 00       	push   $0x80b6c0
+  8016ba:	e8 d8 30 00 00       	call   804797 <mutex_unlock>
+}
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	e9 39 ff ff ff       	jmp    801600 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  8016c7:	50                   	push   %eax
+  8016c8:	68 16 55 80 00       	push   $0x805516
+  8016cd:	68 91 00 00 00       	push   $0x91
+  8016d2:	68 d4 54 80 00       	push   $0x8054d4
+  8016d7:	e8 f7 ec ff ff       	call   8003d3 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8016dc:	e8 ba f8 ff ff       	call   800f9b <sys_getenvid>
+  8016e1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016e6:	89 e1                	mov    %esp,%ecx
+  8016e8:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8016ed:	29 ca                	sub    %ecx,%edx
+  8016ef:	89 d1                	mov    %edx,%ecx
+  8016f1:	c1 e9 0f             	shr    $0xf,%ecx
+  8016f4:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8016fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ff:	0f 42 d1             	cmovb  %ecx,%edx
+  801702:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801708:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80170d:	89 04 95 40 c0 80 00 	mov    %eax,0x80c040(,%edx,4)
+		if(sforked)
+  801714:	a1 c0 c0 80 00       	mov    0x80c0c0,%eax
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	75 07                	jne    801724 <fork+0x143>
+		return 0;
+  80171d:	89 c6                	mov    %eax,%esi
+  80171f:	e9 6f 02 00 00       	jmp    801993 <fork+0x3b2>
+  801724:	89 e2                	mov    %esp,%edx
+  801726:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80172b:	29 d0                	sub    %edx,%eax
+  80172d:	89 c3                	mov    %eax,%ebx
+  80172f:	c1 eb 0f             	shr    $0xf,%ebx
+  801732:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173c:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80173f:	83 ec 04             	sub    $0x4,%esp
+  801742:	68 80 00 00 00       	push   $0x80
+  801747:	6a 00                	push   $0x0
+  801749:	68 40 b6 80 00       	push   $0x80b640
+  80174e:	e8 cd f5 ff ff       	call   800d20 <memset>
+	thread_ids[slot] = sys_getenvid();
+  801753:	e8 43 f8 ff ff       	call   800f9b <sys_getenvid>
+  801758:	89 04 9d 40 b6 80 00 	mov    %eax,0x80b640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  80175f:	8b 04 9d 40 c0 80 00 	mov    0x80c040(,%ebx,4),%eax
+  801766:	a3 40 c0 80 00       	mov    %eax,0x80c040
+	mutex_init(&sfork_lock);
+  80176b:	c7 04 24 c0 b6 80 00 	movl   $0x80b6c0,(%esp)
+  801772:	e8 a4 2f 00 00       	call   80471b <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801777:	83 c4 0c             	add    $0xc,%esp
+  80177a:	68 07 04 00 00       	push   $0x407
+  80177f:	68 00 00 00 e1       	push   $0xe1000000
+  801784:	6a 00                	push   $0x0
+  801786:	e8 4e f8 ff ff       	call   800fd9 <sys_page_alloc>
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	85 c0                	test   %eax,%eax
+  801790:	0f 89 fd 01 00 00    	jns    801993 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801796:	50                   	push   %eax
+  801797:	68 df 54 80 00       	push   $0x8054df
+  80179c:	68 12 01 00 00       	push   $0x112
+  8017a1:	68 d4 54 80 00       	push   $0x8054d4
+  8017a6:	e8 28 ec ff ff       	call   8003d3 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8017ab:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8017b1:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8017b7:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8017bd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8017c3:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8017c9:	0f 87 4f 01 00 00    	ja     80191e <fork+0x33d>
+		pd = PDX(addr);
+  8017cf:	89 d8                	mov    %ebx,%eax
+  8017d1:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8017d4:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8017db:	f6 c2 01             	test   $0x1,%dl
+  8017de:	74 cb                	je     8017ab <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8017e0:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8017e5:	0f 85 92 00 00 00    	jne    80187d <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8017eb:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8017f1:	76 10                	jbe    801803 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8017f3:	89 d8                	mov    %ebx,%eax
+  8017f5:	f7 d8                	neg    %eax
+  8017f7:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8017fc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801801:	74 ba                	je     8017bd <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801803:	89 d8                	mov    %ebx,%eax
+  801805:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801808:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80180f:	f6 c2 01             	test   $0x1,%dl
+  801812:	74 a9                	je     8017bd <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801814:	89 c1                	mov    %eax,%ecx
+  801816:	c1 e1 0c             	shl    $0xc,%ecx
+  801819:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  80181c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801823:	f6 c6 04             	test   $0x4,%dh
+  801826:	0f 85 8e 00 00 00    	jne    8018ba <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  80182c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801833:	f6 c6 08             	test   $0x8,%dh
+  801836:	75 0f                	jne    801847 <fork+0x266>
+  801838:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80183f:	a8 02                	test   $0x2,%al
+  801841:	0f 84 bb 00 00 00    	je     801902 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801847:	83 ec 08             	sub    $0x8,%esp
+  80184a:	68 05 08 00 00       	push   $0x805
+  80184f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801852:	50                   	push   %eax
+  801853:	56                   	push   %esi
+  801854:	50                   	push   %eax
+  801855:	6a 00                	push   $0x0
+  801857:	68 20 b3 80 00       	push   $0x80b320
+  80185c:	e8 d2 2d 00 00       	call   804633 <pgbatch_map>
+  801861:	83 c4 20             	add    $0x20,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	79 76                	jns    8018de <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801868:	50                   	push   %eax
+  801869:	68 3a 55 80 00       	push   $0x80553a
+  80186e:	68 bc 00 00 00       	push   $0xbc
+  801873:	68 d4 54 80 00       	push   $0x8054d4
+  801878:	e8 56 eb ff ff       	call   8003d3 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  80187d:	83 ec 0c             	sub    $0xc,%esp
+  801880:	68 00 08 00 00       	push   $0x800
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+  801887:	6a 00                	push   $0x0
+  801889:	68 20 b3 80 00       	push   $0x80b320
+  80188e:	e8 4b 2e 00 00       	call   8046de <pgbatch_sharept>
+  801893:	83 c4 20             	add    $0x20,%esp
+  801896:	85 c0                	test   %eax,%eax
+  801898:	78 0b                	js     8018a5 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  80189a:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8018a0:	e9 18 ff ff ff       	jmp    8017bd <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8018a5:	50                   	push   %eax
+  8018a6:	68 26 55 80 00       	push   $0x805526
+  8018ab:	68 b2 00 00 00       	push   $0xb2
+  8018b0:	68 d4 54 80 00       	push   $0x8054d4
+  8018b5:	e8 19 eb ff ff       	call   8003d3 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8018ba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018c1:	83 ec 08             	sub    $0x8,%esp
+  8018c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018c9:	50                   	push   %eax
+  8018ca:	51                   	push   %ecx
+  8018cb:	56                   	push   %esi
+  8018cc:	51                   	push   %ecx
+  8018cd:	6a 00                	push   $0x0
+  8018cf:	68 20 b3 80 00       	push   $0x80b320
+  8018d4:	e8 5a 2d 00 00       	call   804633 <pgbatch_map>
+  8018d9:	83 c4 20             	add    $0x20,%esp
+  8018dc:	eb 17                	jmp    8018f5 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8018de:	68 05 08 00 00       	push   $0x805
+  8018e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8018e6:	6a 00                	push   $0x0
+  8018e8:	68 20 b3 80 00       	push   $0x80b320
+  8018ed:	e8 b5 2d 00 00       	call   8046a7 <pgbatch_protect>
+  8018f2:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8018f5:	85 c0                	test   %eax,%eax
+  8018f7:	0f 89 c0 fe ff ff    	jns    8017bd <fork+0x1dc>
+  8018fd:	e9 66 ff ff ff       	jmp    801868 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801902:	83 ec 08             	sub    $0x8,%esp
+  801905:	6a 05                	push   $0x5
+  801907:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80190a:	50                   	push   %eax
+  80190b:	56                   	push   %esi
+  80190c:	50                   	push   %eax
+  80190d:	6a 00                	push   $0x0
+  80190f:	68 20 b3 80 00       	push   $0x80b320
+  801914:	e8 1a 2d 00 00       	call   804633 <pgbatch_map>
+  801919:	83 c4 20             	add    $0x20,%esp
+  80191c:	eb d7                	jmp    8018f5 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  80191e:	6a 07                	push   $0x7
+  801920:	68 00 f0 bf ee       	push   $0xeebff000
+  801925:	57                   	push   %edi
+  801926:	68 20 b3 80 00       	push   $0x80b320
+  80192b:	e8 cc 2c 00 00       	call   8045fc <pgbatch_alloc>
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	85 c0                	test   %eax,%eax
+  801935:	78 66                	js     80199d <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801937:	83 ec 0c             	sub    $0xc,%esp
+  80193a:	68 20 b3 80 00       	push   $0x80b320
+  80193f:	e8 3f 2c 00 00       	call   804583 <pgbatch_flush>
+  801944:	83 c4 10             	add    $0x10,%esp
+  801947:	85 c0                	test   %eax,%eax
+  801949:	78 52                	js     80199d <fork+0x3bc>
+  80194b:	89 e2                	mov    %esp,%edx
+  80194d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801952:	29 d0                	sub    %edx,%eax
+  801954:	89 c2                	mov    %eax,%edx
+  801956:	c1 ea 0f             	shr    $0xf,%edx
+  801959:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801963:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801966:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  80196d:	8b 40 78             	mov    0x78(%eax),%eax
+  801970:	83 ec 08             	sub    $0x8,%esp
+  801973:	50                   	push   %eax
+  801974:	57                   	push   %edi
+  801975:	e8 aa f7 ff ff       	call   801124 <sys_env_set_pgfault_upcall>
+  80197a:	83 c4 10             	add    $0x10,%esp
+  80197d:	85 c0                	test   %eax,%eax
+  80197f:	78 31                	js     8019b2 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801981:	83 ec 08             	sub    $0x8,%esp
+  801984:	6a 02                	push   $0x2
+  801986:	57                   	push   %edi
+  801987:	e8 14 f7 ff ff       	call   8010a0 <sys_env_set_status>
+  80198c:	83 c4 10             	add    $0x10,%esp
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	78 34                	js     8019c7 <fork+0x3e6>
+}
+  801993:	89 f0                	mov    %esi,%eax
+  801995:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801998:	5b                   	pop    %ebx
+  801999:	5e                   	pop    %esi
+  80199a:	5f                   	pop    %edi
+  80199b:	5d                   	pop    %ebp
+  80199c:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  80199d:	50                   	push   %eax
+  80199e:	68 46 55 80 00       	push   $0x805546
+  8019a3:	68 c0 00 00 00       	push   $0xc0
+  8019a8:	68 d4 54 80 00       	push   $0x8054d4
+  8019ad:	e8 21 ea ff ff       	call   8003d3 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  8019b2:	50                   	push   %eax
+  8019b3:	68 5b 55 80 00       	push   $0x80555b
+  8019b8:	68 c2 00 00 00       	push   $0xc2
+  8019bd:	68 d4 54 80 00       	push   $0x8054d4
+  8019c2:	e8 0c ea ff ff       	call   8003d3 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  8019c7:	50                   	push   %eax
+  8019c8:	68 76 55 80 00       	push   $0x805576
+  8019cd:	68 c4 00 00 00       	push   $0xc4
+  8019d2:	68 d4 54 80 00       	push   $0x8054d4
+  8019d7:	e8 f7 e9 ff ff       	call   8003d3 <_panic>
+
+008019dc <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	57                   	push   %edi
+  8019e0:	56                   	push   %esi
+  8019e1:	53                   	push   %ebx
+  8019e2:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8019e5:	68 c0 b6 80 00       	push   $0x80b6c0
+  8019ea:	e8 3a 2d 00 00       	call   804729 <mutex_lock>
+  8019ef:	89 e2                	mov    %esp,%edx
+  8019f1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8019f6:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  8019f8:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8019fb:	89 c3                	mov    %eax,%ebx
+  8019fd:	c1 eb 0f             	shr    $0xf,%ebx
+  801a00:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0a:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801a0d:	e8 89 f5 ff ff       	call   800f9b <sys_getenvid>
+  801a12:	89 04 9d 40 b6 80 00 	mov    %eax,0x80b640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801a19:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801a1e:	8b 04 9d 40 b6 80 00 	mov    0x80b640(,%ebx,4),%eax
+  801a25:	e8 12 fa ff ff       	call   80143c <thread_alive>
+  801a2a:	85 c0                	test   %eax,%eax
+  801a2c:	74 24                	je     801a52 <sfork+0x76>
+  801a2e:	83 c3 01             	add    $0x1,%ebx
+  801a31:	83 fb 20             	cmp    $0x20,%ebx
+  801a34:	75 e8                	jne    801a1e <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801a36:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801a3b:	83 ec 0c             	sub    $0xc,%esp
+  801a3e:	68 c0 b6 80 00       	push   $0x80b6c0
+  801a43:	e8 4f 2d 00 00       	call   804797 <mutex_unlock>
+	return r;
+}
+  801a48:	89 f0                	mov    %esi,%eax
+  801a4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4d:	5b                   	pop    %ebx
+  801a4e:	5e                   	pop    %esi
+  801a4f:	5f                   	pop    %edi
+  801a50:	5d                   	pop    %ebp
+  801a51:	c3                   	ret
+	if (i == NTHREADS) {
+  801a52:	83 fb 20             	cmp    $0x20,%ebx
+  801a55:	0f 84 53 01 00 00    	je     801bae <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801a5b:	89 d8                	mov    %ebx,%eax
+  801a5d:	c1 e0 0f             	shl    $0xf,%eax
+  801a60:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801a63:	83 ec 0c             	sub    $0xc,%esp
+  801a66:	68 00 b0 80 00       	push   $0x80b000
+  801a6b:	e8 05 2b 00 00       	call   804575 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	83 3d c0 c0 80 00 00 	cmpl   $0x0,0x80c0c0
+  801a7a:	75 1f                	jne    801a9b <sfork+0xbf>
+  801a7c:	68 07 04 00 00       	push   $0x407
+  801a81:	68 00 00 00 e1       	push   $0xe1000000
+  801a86:	6a 00                	push   $0x0
+  801a88:	68 00 b0 80 00       	push   $0x80b000
+  801a8d:	e8 6a 2b 00 00       	call   8045fc <pgbatch_alloc>
+  801a92:	89 c6                	mov    %eax,%esi
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	85 c0                	test   %eax,%eax
+  801a99:	78 a0                	js     801a3b <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801a9b:	6a 07                	push   $0x7
+  801a9d:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801aa2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801aa5:	29 c8                	sub    %ecx,%eax
+  801aa7:	50                   	push   %eax
+  801aa8:	6a 00                	push   $0x0
+  801aaa:	68 00 b0 80 00       	push   $0x80b000
+  801aaf:	e8 48 2b 00 00       	call   8045fc <pgbatch_alloc>
+  801ab4:	89 c6                	mov    %eax,%esi
+  801ab6:	83 c4 10             	add    $0x10,%esp
+  801ab9:	85 c0                	test   %eax,%eax
+  801abb:	0f 88 7a ff ff ff    	js     801a3b <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801ac1:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801ac6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ac9:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801acb:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801ad0:	29 c8                	sub    %ecx,%eax
+  801ad2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ad5:	39 c7                	cmp    %eax,%edi
+  801ad7:	73 29                	jae    801b02 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801ad9:	6a 07                	push   $0x7
+  801adb:	57                   	push   %edi
+  801adc:	6a 00                	push   $0x0
+  801ade:	68 00 b0 80 00       	push   $0x80b000
+  801ae3:	e8 14 2b 00 00       	call   8045fc <pgbatch_alloc>
+  801ae8:	89 c6                	mov    %eax,%esi
+  801aea:	83 c4 10             	add    $0x10,%esp
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	0f 88 46 ff ff ff    	js     801a3b <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801af5:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801afb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801afe:	39 c7                	cmp    %eax,%edi
+  801b00:	72 d7                	jb     801ad9 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801b02:	83 ec 0c             	sub    $0xc,%esp
+  801b05:	68 00 b0 80 00       	push   $0x80b000
+  801b0a:	e8 74 2a 00 00       	call   804583 <pgbatch_flush>
+  801b0f:	89 c6                	mov    %eax,%esi
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	0f 88 1f ff ff ff    	js     801a3b <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801b1c:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801b21:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b24:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801b26:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801b2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b2f:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801b32:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b35:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b38:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801b3b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801b40:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b42:	52                   	push   %edx
+  801b43:	50                   	push   %eax
+  801b44:	68 c4 15 80 00       	push   $0x8015c4
+  801b49:	e8 cc f8 ff ff       	call   80141a <sys_exofork_shared>
+  801b4e:	89 c6                	mov    %eax,%esi
+  801b50:	83 c4 10             	add    $0x10,%esp
+  801b53:	85 c0                	test   %eax,%eax
+  801b55:	0f 88 e0 fe ff ff    	js     801a3b <sfork+0x5f>
+	thread_ids[i] = id;
+  801b5b:	89 04 9d 40 b6 80 00 	mov    %eax,0x80b640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801b62:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b67:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801b6d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b72:	89 04 9d 40 c0 80 00 	mov    %eax,0x80c040(,%ebx,4)
+	sforked = 1;
+  801b79:	c7 05 c0 c0 80 00 01 	movl   $0x1,0x80c0c0
+  801b80:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b83:	83 ec 08             	sub    $0x8,%esp
+  801b86:	6a 02                	push   $0x2
+  801b88:	56                   	push   %esi
+  801b89:	e8 12 f5 ff ff       	call   8010a0 <sys_env_set_status>
+  801b8e:	89 c3                	mov    %eax,%ebx
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	0f 89 a0 fe ff ff    	jns    801a3b <sfork+0x5f>
+		sys_env_destroy(id);
+  801b9b:	83 ec 0c             	sub    $0xc,%esp
+  801b9e:	56                   	push   %esi
+  801b9f:	e8 b6 f3 ff ff       	call   800f5a <sys_env_destroy>
+		goto out;
+  801ba4:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801ba7:	89 de                	mov    %ebx,%esi
+		goto out;
+  801ba9:	e9 8d fe ff ff       	jmp    801a3b <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801bae:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801bb3:	e9 83 fe ff ff       	jmp    801a3b <sfork+0x5f>
+
+00801bb8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801bb8:	55                   	push   %ebp
+  801bb9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbe:	05 00 00 00 30       	add    $0x30000000,%eax
+  801bc3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801bc6:	5d                   	pop    %ebp
+  801bc7:	c3                   	ret
+
+00801bc8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801bc8:	55                   	push   %ebp
+  801bc9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bce:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801bd3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bd8:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801bdd:	5d                   	pop    %ebp
+  801bde:	c3                   	ret
+
+00801bdf <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801bdf:	55                   	push   %ebp
+  801be0:	89 e5                	mov    %esp,%ebp
+  801be2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801be7:	89 c2                	mov    %eax,%edx
+  801be9:	c1 ea 16             	shr    $0x16,%edx
+  801bec:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bf3:	f6 c2 01             	test   $0x1,%dl
+  801bf6:	74 29                	je     801c21 <fd_alloc+0x42>
+  801bf8:	89 c2                	mov    %eax,%edx
+  801bfa:	c1 ea 0c             	shr    $0xc,%edx
+  801bfd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c04:	f6 c2 01             	test   $0x1,%dl
+  801c07:	74 18                	je     801c21 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801c09:	05 00 10 00 00       	add    $0x1000,%eax
+  801c0e:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801c13:	75 d2                	jne    801be7 <fd_alloc+0x8>
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c1a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c1f:	eb 05                	jmp    801c26 <fd_alloc+0x47>
+			return 0;
+  801c21:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801c26:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c29:	89 02                	mov    %eax,(%edx)
+}
+  801c2b:	89 c8                	mov    %ecx,%eax
+  801c2d:	5d                   	pop    %ebp
+  801c2e:	c3                   	ret
+
+00801c2f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c2f:	55                   	push   %ebp
+  801c30:	89 e5                	mov    %esp,%ebp
+  801c32:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c35:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801c3a:	77 30                	ja     801c6c <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c3c:	c1 e0 0c             	shl    $0xc,%eax
+  801c3f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801c44:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c4a:	f6 c2 01             	test   $0x1,%dl
+  801c4d:	74 24                	je     801c73 <fd_lookup+0x44>
+  801c4f:	89 c2                	mov    %eax,%edx
+  801c51:	c1 ea 0c             	shr    $0xc,%edx
+  801c54:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c5b:	f6 c2 01             	test   $0x1,%dl
+  801c5e:	74 1a                	je     801c7a <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c63:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+		return -E_INVAL;
+  801c6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c71:	eb f7                	jmp    801c6a <fd_lookup+0x3b>
+		return -E_INVAL;
+  801c73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c78:	eb f0                	jmp    801c6a <fd_lookup+0x3b>
+  801c7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c7f:	eb e9                	jmp    801c6a <fd_lookup+0x3b>
+
+00801c81 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	53                   	push   %ebx
+  801c85:	83 ec 04             	sub    $0x4,%esp
+  801c88:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c90:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801c95:	39 13                	cmp    %edx,(%ebx)
+  801c97:	74 54                	je     801ced <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801c99:	83 c0 01             	add    $0x1,%eax
+  801c9c:	8b 1c 85 2c 56 80 00 	mov    0x80562c(,%eax,4),%ebx
+  801ca3:	85 db                	test   %ebx,%ebx
+  801ca5:	75 ee                	jne    801c95 <dev_lookup+0x14>
+  801ca7:	89 e1                	mov    %esp,%ecx
+  801ca9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801cae:	29 c8                	sub    %ecx,%eax
+  801cb0:	89 c1                	mov    %eax,%ecx
+  801cb2:	c1 e9 0f             	shr    $0xf,%ecx
+  801cb5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbf:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cc2:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  801cc9:	8b 40 48             	mov    0x48(%eax),%eax
+  801ccc:	83 ec 04             	sub    $0x4,%esp
+  801ccf:	52                   	push   %edx
+  801cd0:	50                   	push   %eax
+  801cd1:	68 b0 55 80 00       	push   $0x8055b0
+  801cd6:	e8 d3 e7 ff ff       	call   8004ae <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801cdb:	83 c4 10             	add    $0x10,%esp
+  801cde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801ce3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ce6:	89 1a                	mov    %ebx,(%edx)
+}
+  801ce8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ceb:	c9                   	leave
+  801cec:	c3                   	ret
+			return 0;
+  801ced:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf2:	eb ef                	jmp    801ce3 <dev_lookup+0x62>
+
+00801cf4 <fd_close>:
+{
+  801cf4:	55                   	push   %ebp
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	57                   	push   %edi
+  801cf8:	56                   	push   %esi
+  801cf9:	53                   	push   %ebx
+  801cfa:	83 ec 24             	sub    $0x24,%esp
+  801cfd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d00:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d03:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d06:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d07:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d0d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d10:	50                   	push   %eax
+  801d11:	e8 19 ff ff ff       	call   801c2f <fd_lookup>
+  801d16:	89 c3                	mov    %eax,%ebx
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 05                	js     801d24 <fd_close+0x30>
+	    || fd != fd2)
+  801d1f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d22:	74 0f                	je     801d33 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801d24:	85 ff                	test   %edi,%edi
+  801d26:	0f 44 df             	cmove  %edi,%ebx
+}
+  801d29:	89 d8                	mov    %ebx,%eax
+  801d2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2e:	5b                   	pop    %ebx
+  801d2f:	5e                   	pop    %esi
+  801d30:	5f                   	pop    %edi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d33:	83 ec 08             	sub    $0x8,%esp
+  801d36:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d39:	50                   	push   %eax
+  801d3a:	ff 36                	push   (%esi)
+  801d3c:	e8 40 ff ff ff       	call   801c81 <dev_lookup>
+  801d41:	89 c3                	mov    %eax,%ebx
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	85 c0                	test   %eax,%eax
+  801d48:	78 1a                	js     801d64 <fd_close+0x70>
+		if (dev->dev_close)
+  801d4a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d4d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d50:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	74 0b                	je     801d64 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801d59:	83 ec 0c             	sub    $0xc,%esp
+  801d5c:	56                   	push   %esi
+  801d5d:	ff d0                	call   *%eax
+  801d5f:	89 c3                	mov    %eax,%ebx
+  801d61:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d64:	83 ec 08             	sub    $0x8,%esp
+  801d67:	56                   	push   %esi
+  801d68:	6a 00                	push   $0x0
+  801d6a:	e8 ef f2 ff ff       	call   80105e <sys_page_unmap>
+	return r;
+  801d6f:	83 c4 10             	add    $0x10,%esp
+  801d72:	eb b5                	jmp    801d29 <fd_close+0x35>
+
+00801d74 <close>:
+
+int
+close(int fdnum)
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d7d:	50                   	push   %eax
+  801d7e:	ff 75 08             	push   0x8(%ebp)
+  801d81:	e8 a9 fe ff ff       	call   801c2f <fd_lookup>
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	85 c0                	test   %eax,%eax
+  801d8b:	79 02                	jns    801d8f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d8d:	c9                   	leave
+  801d8e:	c3                   	ret
+		return fd_close(fd, 1);
+  801d8f:	83 ec 08             	sub    $0x8,%esp
+  801d92:	6a 01                	push   $0x1
+  801d94:	ff 75 f4             	push   -0xc(%ebp)
+  801d97:	e8 58 ff ff ff       	call   801cf4 <fd_close>
+  801d9c:	83 c4 10             	add    $0x10,%esp
+  801d9f:	eb ec                	jmp    801d8d <close+0x19>
+
+00801da1 <close_all>:
+
+void
+close_all(void)
+{
+  801da1:	55                   	push   %ebp
+  801da2:	89 e5                	mov    %esp,%ebp
+  801da4:	53                   	push   %ebx
+  801da5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801da8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801dad:	83 ec 0c             	sub    $0xc,%esp
+  801db0:	53                   	push   %ebx
+  801db1:	e8 be ff ff ff       	call   801d74 <close>
+	for (i = 0; i < MAXFD; i++)
+  801db6:	83 c3 01             	add    $0x1,%ebx
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801dc2:	75 e9                	jne    801dad <close_all+0xc>
+}
+  801dc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc7:	c9                   	leave
+  801dc8:	c3                   	ret
+
+00801dc9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	57                   	push   %edi
+  801dcd:	56                   	push   %esi
+  801dce:	53                   	push   %ebx
+  801dcf:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801dd2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dd5:	50                   	push   %eax
+  801dd6:	ff 75 08             	push   0x8(%ebp)
+  801dd9:	e8 51 fe ff ff       	call   801c2f <fd_lookup>
+  801dde:	89 c3                	mov    %eax,%ebx
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 7f                	js     801e66 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801de7:	83 ec 0c             	sub    $0xc,%esp
+  801dea:	ff 75 0c             	push   0xc(%ebp)
+  801ded:	e8 82 ff ff ff       	call   801d74 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801df2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801df5:	c1 e6 0c             	shl    $0xc,%esi
+  801df8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801dfe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e01:	89 3c 24             	mov    %edi,(%esp)
+  801e04:	e8 bf fd ff ff       	call   801bc8 <fd2data>
+  801e09:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e0b:	89 34 24             	mov    %esi,(%esp)
+  801e0e:	e8 b5 fd ff ff       	call   801bc8 <fd2data>
+  801e13:	83 c4 10             	add    $0x10,%esp
+  801e16:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801e19:	89 d8                	mov    %ebx,%eax
+  801e1b:	c1 e8 16             	shr    $0x16,%eax
+  801e1e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e25:	a8 01                	test   $0x1,%al
+  801e27:	74 11                	je     801e3a <dup+0x71>
+  801e29:	89 d8                	mov    %ebx,%eax
+  801e2b:	c1 e8 0c             	shr    $0xc,%eax
+  801e2e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e35:	f6 c2 01             	test   $0x1,%dl
+  801e38:	75 36                	jne    801e70 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e3a:	89 f8                	mov    %edi,%eax
+  801e3c:	c1 e8 0c             	shr    $0xc,%eax
+  801e3f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e46:	83 ec 0c             	sub    $0xc,%esp
+  801e49:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e4e:	50                   	push   %eax
+  801e4f:	56                   	push   %esi
+  801e50:	6a 00                	push   $0x0
+  801e52:	57                   	push   %edi
+  801e53:	6a 00                	push   $0x0
+  801e55:	e8 c2 f1 ff ff       	call   80101c <sys_page_map>
+  801e5a:	89 c3                	mov    %eax,%ebx
+  801e5c:	83 c4 20             	add    $0x20,%esp
+  801e5f:	85 c0                	test   %eax,%eax
+  801e61:	78 33                	js     801e96 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e63:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e66:	89 d8                	mov    %ebx,%eax
+  801e68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e6b:	5b                   	pop    %ebx
+  801e6c:	5e                   	pop    %esi
+  801e6d:	5f                   	pop    %edi
+  801e6e:	5d                   	pop    %ebp
+  801e6f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e70:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e77:	83 ec 0c             	sub    $0xc,%esp
+  801e7a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e7f:	50                   	push   %eax
+  801e80:	ff 75 d4             	push   -0x2c(%ebp)
+  801e83:	6a 00                	push   $0x0
+  801e85:	53                   	push   %ebx
+  801e86:	6a 00                	push   $0x0
+  801e88:	e8 8f f1 ff ff       	call   80101c <sys_page_map>
+  801e8d:	89 c3                	mov    %eax,%ebx
+  801e8f:	83 c4 20             	add    $0x20,%esp
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	79 a4                	jns    801e3a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e96:	83 ec 08             	sub    $0x8,%esp
+  801e99:	56                   	push   %esi
+  801e9a:	6a 00                	push   $0x0
+  801e9c:	e8 bd f1 ff ff       	call   80105e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ea1:	83 c4 08             	add    $0x8,%esp
+  801ea4:	ff 75 d4             	push   -0x2c(%ebp)
+  801ea7:	6a 00                	push   $0x0
+  801ea9:	e8 b0 f1 ff ff       	call   80105e <sys_page_unmap>
+	return r;
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	eb b3                	jmp    801e66 <dup+0x9d>
+
+00801eb3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801eb3:	55                   	push   %ebp
+  801eb4:	89 e5                	mov    %esp,%ebp
+  801eb6:	56                   	push   %esi
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 18             	sub    $0x18,%esp
+  801ebb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ebe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ec1:	50                   	push   %eax
+  801ec2:	53                   	push   %ebx
+  801ec3:	e8 67 fd ff ff       	call   801c2f <fd_lookup>
+  801ec8:	83 c4 10             	add    $0x10,%esp
+  801ecb:	85 c0                	test   %eax,%eax
+  801ecd:	78 3c                	js     801f0b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ecf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ed2:	83 ec 08             	sub    $0x8,%esp
+  801ed5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed8:	50                   	push   %eax
+  801ed9:	ff 36                	push   (%esi)
+  801edb:	e8 a1 fd ff ff       	call   801c81 <dev_lookup>
+  801ee0:	83 c4 10             	add    $0x10,%esp
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	78 24                	js     801f0b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ee7:	8b 46 08             	mov    0x8(%esi),%eax
+  801eea:	83 e0 03             	and    $0x3,%eax
+  801eed:	83 f8 01             	cmp    $0x1,%eax
+  801ef0:	74 20                	je     801f12 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ef2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef5:	8b 40 08             	mov    0x8(%eax),%eax
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	74 54                	je     801f50 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801efc:	83 ec 04             	sub    $0x4,%esp
+  801eff:	ff 75 10             	push   0x10(%ebp)
+  801f02:	ff 75 0c             	push   0xc(%ebp)
+  801f05:	56                   	push   %esi
+  801f06:	ff d0                	call   *%eax
+  801f08:	83 c4 10             	add    $0x10,%esp
+}
+  801f0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f0e:	5b                   	pop    %ebx
+  801f0f:	5e                   	pop    %esi
+  801f10:	5d                   	pop    %ebp
+  801f11:	c3                   	ret
+  801f12:	89 e2                	mov    %esp,%edx
+  801f14:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f19:	29 d0                	sub    %edx,%eax
+  801f1b:	89 c2                	mov    %eax,%edx
+  801f1d:	c1 ea 0f             	shr    $0xf,%edx
+  801f20:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f2d:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  801f34:	8b 40 48             	mov    0x48(%eax),%eax
+  801f37:	83 ec 04             	sub    $0x4,%esp
+  801f3a:	53                   	push   %ebx
+  801f3b:	50                   	push   %eax
+  801f3c:	68 f1 55 80 00       	push   $0x8055f1
+  801f41:	e8 68 e5 ff ff       	call   8004ae <cprintf>
+		return -E_INVAL;
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f4e:	eb bb                	jmp    801f0b <read+0x58>
+		return -E_NOT_SUPP;
+  801f50:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f55:	eb b4                	jmp    801f0b <read+0x58>
+
+00801f57 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f57:	55                   	push   %ebp
+  801f58:	89 e5                	mov    %esp,%ebp
+  801f5a:	57                   	push   %edi
+  801f5b:	56                   	push   %esi
+  801f5c:	53                   	push   %ebx
+  801f5d:	83 ec 0c             	sub    $0xc,%esp
+  801f60:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f63:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f66:	85 f6                	test   %esi,%esi
+  801f68:	74 30                	je     801f9a <readn+0x43>
+  801f6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f74:	83 ec 04             	sub    $0x4,%esp
+  801f77:	89 f2                	mov    %esi,%edx
+  801f79:	29 c2                	sub    %eax,%edx
+  801f7b:	52                   	push   %edx
+  801f7c:	01 f8                	add    %edi,%eax
+  801f7e:	50                   	push   %eax
+  801f7f:	ff 75 08             	push   0x8(%ebp)
+  801f82:	e8 2c ff ff ff       	call   801eb3 <read>
+		if (m < 0)
+  801f87:	83 c4 10             	add    $0x10,%esp
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 15                	js     801fa3 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801f8e:	74 11                	je     801fa1 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801f90:	01 c3                	add    %eax,%ebx
+  801f92:	89 d8                	mov    %ebx,%eax
+  801f94:	39 f3                	cmp    %esi,%ebx
+  801f96:	72 dc                	jb     801f74 <readn+0x1d>
+  801f98:	eb 09                	jmp    801fa3 <readn+0x4c>
+  801f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9f:	eb 02                	jmp    801fa3 <readn+0x4c>
+  801fa1:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801fa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa6:	5b                   	pop    %ebx
+  801fa7:	5e                   	pop    %esi
+  801fa8:	5f                   	pop    %edi
+  801fa9:	5d                   	pop    %ebp
+  801faa:	c3                   	ret
+
+00801fab <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	83 ec 18             	sub    $0x18,%esp
+  801fb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fb6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fb9:	50                   	push   %eax
+  801fba:	53                   	push   %ebx
+  801fbb:	e8 6f fc ff ff       	call   801c2f <fd_lookup>
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	78 37                	js     801ffe <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fc7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fca:	83 ec 08             	sub    $0x8,%esp
+  801fcd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd0:	50                   	push   %eax
+  801fd1:	ff 36                	push   (%esi)
+  801fd3:	e8 a9 fc ff ff       	call   801c81 <dev_lookup>
+  801fd8:	83 c4 10             	add    $0x10,%esp
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	78 1f                	js     801ffe <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fdf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fe3:	74 20                	je     802005 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801fe5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fe8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	74 54                	je     802043 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801fef:	83 ec 04             	sub    $0x4,%esp
+  801ff2:	ff 75 10             	push   0x10(%ebp)
+  801ff5:	ff 75 0c             	push   0xc(%ebp)
+  801ff8:	56                   	push   %esi
+  801ff9:	ff d0                	call   *%eax
+  801ffb:	83 c4 10             	add    $0x10,%esp
+}
+  801ffe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802001:	5b                   	pop    %ebx
+  802002:	5e                   	pop    %esi
+  802003:	5d                   	pop    %ebp
+  802004:	c3                   	ret
+  802005:	89 e2                	mov    %esp,%edx
+  802007:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80200c:	29 d0                	sub    %edx,%eax
+  80200e:	89 c2                	mov    %eax,%edx
+  802010:	c1 ea 0f             	shr    $0xf,%edx
+  802013:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201d:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802020:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  802027:	8b 40 48             	mov    0x48(%eax),%eax
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	53                   	push   %ebx
+  80202e:	50                   	push   %eax
+  80202f:	68 0d 56 80 00       	push   $0x80560d
+  802034:	e8 75 e4 ff ff       	call   8004ae <cprintf>
+		return -E_INVAL;
+  802039:	83 c4 10             	add    $0x10,%esp
+  80203c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802041:	eb bb                	jmp    801ffe <write+0x53>
+		return -E_NOT_SUPP;
+  802043:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802048:	eb b4                	jmp    801ffe <write+0x53>
+
+0080204a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80204a:	55                   	push   %ebp
+  80204b:	89 e5                	mov    %esp,%ebp
+  80204d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802050:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802053:	50                   	push   %eax
+  802054:	ff 75 08             	push   0x8(%ebp)
+  802057:	e8 d3 fb ff ff       	call   801c2f <fd_lookup>
+  80205c:	83 c4 10             	add    $0x10,%esp
+  80205f:	85 c0                	test   %eax,%eax
+  802061:	78 0e                	js     802071 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802063:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802066:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802069:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80206c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+00802073 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	53                   	push   %ebx
+  802077:	83 ec 1c             	sub    $0x1c,%esp
+  80207a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80207d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802080:	50                   	push   %eax
+  802081:	ff 75 08             	push   0x8(%ebp)
+  802084:	e8 a6 fb ff ff       	call   801c2f <fd_lookup>
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 33                	js     8020c3 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802090:	83 fb 03             	cmp    $0x3,%ebx
+  802093:	74 28                	je     8020bd <fcntl+0x4a>
+  802095:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80209a:	83 fb 04             	cmp    $0x4,%ebx
+  80209d:	75 24                	jne    8020c3 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80209f:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8020a2:	8b 41 08             	mov    0x8(%ecx),%eax
+  8020a5:	80 e4 ef             	and    $0xef,%ah
+  8020a8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020ab:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8020b1:	09 d0                	or     %edx,%eax
+  8020b3:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8020b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bb:	eb 06                	jmp    8020c3 <fcntl+0x50>
+		return fd->fd_omode;
+  8020bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c0:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8020c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c6:	c9                   	leave
+  8020c7:	c3                   	ret
+
+008020c8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	56                   	push   %esi
+  8020cc:	53                   	push   %ebx
+  8020cd:	83 ec 18             	sub    $0x18,%esp
+  8020d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020d6:	50                   	push   %eax
+  8020d7:	53                   	push   %ebx
+  8020d8:	e8 52 fb ff ff       	call   801c2f <fd_lookup>
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	78 34                	js     802118 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020e4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020e7:	83 ec 08             	sub    $0x8,%esp
+  8020ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ed:	50                   	push   %eax
+  8020ee:	ff 36                	push   (%esi)
+  8020f0:	e8 8c fb ff ff       	call   801c81 <dev_lookup>
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	78 1c                	js     802118 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020fc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802100:	74 1d                	je     80211f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802102:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802105:	8b 40 18             	mov    0x18(%eax),%eax
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	74 51                	je     80215d <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80210c:	83 ec 08             	sub    $0x8,%esp
+  80210f:	ff 75 0c             	push   0xc(%ebp)
+  802112:	56                   	push   %esi
+  802113:	ff d0                	call   *%eax
+  802115:	83 c4 10             	add    $0x10,%esp
+}
+  802118:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211b:	5b                   	pop    %ebx
+  80211c:	5e                   	pop    %esi
+  80211d:	5d                   	pop    %ebp
+  80211e:	c3                   	ret
+  80211f:	89 e2                	mov    %esp,%edx
+  802121:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802126:	29 d0                	sub    %edx,%eax
+  802128:	89 c2                	mov    %eax,%edx
+  80212a:	c1 ea 0f             	shr    $0xf,%edx
+  80212d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802132:	b8 00 00 00 00       	mov    $0x0,%eax
+  802137:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80213a:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  802141:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802144:	83 ec 04             	sub    $0x4,%esp
+  802147:	53                   	push   %ebx
+  802148:	50                   	push   %eax
+  802149:	68 d0 55 80 00       	push   $0x8055d0
+  80214e:	e8 5b e3 ff ff       	call   8004ae <cprintf>
+		return -E_INVAL;
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80215b:	eb bb                	jmp    802118 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80215d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802162:	eb b4                	jmp    802118 <ftruncate+0x50>
+
+00802164 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	56                   	push   %esi
+  802168:	53                   	push   %ebx
+  802169:	83 ec 18             	sub    $0x18,%esp
+  80216c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80216f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802172:	50                   	push   %eax
+  802173:	ff 75 08             	push   0x8(%ebp)
+  802176:	e8 b4 fa ff ff       	call   801c2f <fd_lookup>
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	78 53                	js     8021d5 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802182:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802185:	83 ec 08             	sub    $0x8,%esp
+  802188:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80218b:	50                   	push   %eax
+  80218c:	ff 36                	push   (%esi)
+  80218e:	e8 ee fa ff ff       	call   801c81 <dev_lookup>
+  802193:	83 c4 10             	add    $0x10,%esp
+  802196:	85 c0                	test   %eax,%eax
+  802198:	78 3b                	js     8021d5 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80219a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80219d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8021a1:	74 39                	je     8021dc <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8021a3:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8021a6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021ad:	00 00 00 
+	stat->st_isdir = 0;
+  8021b0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021b7:	00 00 00 
+	stat->st_version = 0;
+  8021ba:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8021c1:	00 00 00 
+	stat->st_dev = dev;
+  8021c4:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8021ca:	83 ec 08             	sub    $0x8,%esp
+  8021cd:	53                   	push   %ebx
+  8021ce:	56                   	push   %esi
+  8021cf:	ff 50 14             	call   *0x14(%eax)
+  8021d2:	83 c4 10             	add    $0x10,%esp
+}
+  8021d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d8:	5b                   	pop    %ebx
+  8021d9:	5e                   	pop    %esi
+  8021da:	5d                   	pop    %ebp
+  8021db:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021dc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021e1:	eb f2                	jmp    8021d5 <fstat+0x71>
+
+008021e3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8021e3:	55                   	push   %ebp
+  8021e4:	89 e5                	mov    %esp,%ebp
+  8021e6:	56                   	push   %esi
+  8021e7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8021e8:	83 ec 08             	sub    $0x8,%esp
+  8021eb:	6a 00                	push   $0x0
+  8021ed:	ff 75 08             	push   0x8(%ebp)
+  8021f0:	e8 b7 01 00 00       	call   8023ac <open>
+  8021f5:	89 c3                	mov    %eax,%ebx
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	78 1b                	js     802219 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8021fe:	83 ec 08             	sub    $0x8,%esp
+  802201:	ff 75 0c             	push   0xc(%ebp)
+  802204:	50                   	push   %eax
+  802205:	e8 5a ff ff ff       	call   802164 <fstat>
+  80220a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80220c:	89 1c 24             	mov    %ebx,(%esp)
+  80220f:	e8 60 fb ff ff       	call   801d74 <close>
+	return r;
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	89 f3                	mov    %esi,%ebx
+}
+  802219:	89 d8                	mov    %ebx,%eax
+  80221b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80221e:	5b                   	pop    %ebx
+  80221f:	5e                   	pop    %esi
+  802220:	5d                   	pop    %ebp
+  802221:	c3                   	ret
+
+00802222 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	56                   	push   %esi
+  802226:	53                   	push   %ebx
+  802227:	89 c6                	mov    %eax,%esi
+  802229:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80222b:	83 3d c4 b6 80 00 00 	cmpl   $0x0,0x80b6c4
+  802232:	74 27                	je     80225b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802234:	6a 07                	push   $0x7
+  802236:	68 00 d0 80 00       	push   $0x80d000
+  80223b:	56                   	push   %esi
+  80223c:	ff 35 c4 b6 80 00    	push   0x80b6c4
+  802242:	e8 22 2b 00 00       	call   804d69 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802247:	83 c4 0c             	add    $0xc,%esp
+  80224a:	6a 00                	push   $0x0
+  80224c:	53                   	push   %ebx
+  80224d:	6a 00                	push   $0x0
+  80224f:	e8 85 28 00 00       	call   804ad9 <ipc_recv>
+}
+  802254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802257:	5b                   	pop    %ebx
+  802258:	5e                   	pop    %esi
+  802259:	5d                   	pop    %ebp
+  80225a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80225b:	83 ec 0c             	sub    $0xc,%esp
+  80225e:	6a 02                	push   $0x2
+  802260:	e8 6d 2b 00 00       	call   804dd2 <ipc_find_env>
+  802265:	a3 c4 b6 80 00       	mov    %eax,0x80b6c4
+  80226a:	83 c4 10             	add    $0x10,%esp
+  80226d:	eb c5                	jmp    802234 <fsipc+0x12>
+
+0080226f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802275:	8b 45 08             	mov    0x8(%ebp),%eax
+  802278:	8b 40 0c             	mov    0xc(%eax),%eax
+  80227b:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.set_size.req_size = newsize;
+  802280:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802283:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802288:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802292:	e8 8b ff ff ff       	call   802222 <fsipc>
+}
+  802297:	c9                   	leave
+  802298:	c3                   	ret
+
+00802299 <devfile_flush>:
+{
+  802299:	55                   	push   %ebp
+  80229a:	89 e5                	mov    %esp,%ebp
+  80229c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80229f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022a5:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8022aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022af:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022b4:	e8 69 ff ff ff       	call   802222 <fsipc>
+}
+  8022b9:	c9                   	leave
+  8022ba:	c3                   	ret
+
+008022bb <devfile_stat>:
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	53                   	push   %ebx
+  8022bf:	83 ec 04             	sub    $0x4,%esp
+  8022c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022cb:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8022d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022da:	e8 43 ff ff ff       	call   802222 <fsipc>
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	78 37                	js     80231a <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022e3:	83 ec 08             	sub    $0x8,%esp
+  8022e6:	68 00 d0 80 00       	push   $0x80d000
+  8022eb:	53                   	push   %ebx
+  8022ec:	e8 b4 e8 ff ff       	call   800ba5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8022f1:	a1 80 d0 80 00       	mov    0x80d080,%eax
+  8022f6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022fc:	a1 84 d0 80 00       	mov    0x80d084,%eax
+  802301:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802307:	a1 88 d0 80 00       	mov    0x80d088,%eax
+  80230c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802312:	83 c4 10             	add    $0x10,%esp
+  802315:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80231a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80231d:	c9                   	leave
+  80231e:	c3                   	ret
+
+0080231f <devfile_write>:
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	83 ec 0c             	sub    $0xc,%esp
+  802325:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802328:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80232d:	39 d0                	cmp    %edx,%eax
+  80232f:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802332:	8b 55 08             	mov    0x8(%ebp),%edx
+  802335:	8b 52 0c             	mov    0xc(%edx),%edx
+  802338:	89 15 00 d0 80 00    	mov    %edx,0x80d000
+	fsipcbuf.write.req_n = count;
+  80233e:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802343:	50                   	push   %eax
+  802344:	ff 75 0c             	push   0xc(%ebp)
+  802347:	68 08 d0 80 00       	push   $0x80d008
+  80234c:	e8 04 ea ff ff       	call   800d55 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802351:	ba 00 00 00 00       	mov    $0x0,%edx
+  802356:	b8 04 00 00 00       	mov    $0x4,%eax
+  80235b:	e8 c2 fe ff ff       	call   802222 <fsipc>
+}
+  802360:	c9                   	leave
+  802361:	c3                   	ret
+
+00802362 <devfile_read>:
+{
+  802362:	55                   	push   %ebp
+  802363:	89 e5                	mov    %esp,%ebp
+  802365:	53                   	push   %ebx
+  802366:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80236f:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.read.req_n = n;
+  802374:	8b 45 10             	mov    0x10(%ebp),%eax
+  802377:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80237c:	ba 00 d0 80 00       	mov    $0x80d000,%edx
+  802381:	b8 03 00 00 00       	mov    $0x3,%eax
+  802386:	e8 97 fe ff ff       	call   802222 <fsipc>
+  80238b:	89 c3                	mov    %eax,%ebx
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	78 14                	js     8023a5 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802391:	83 ec 04             	sub    $0x4,%esp
+  802394:	50                   	push   %eax
+  802395:	68 00 d0 80 00       	push   $0x80d000
+  80239a:	ff 75 0c             	push   0xc(%ebp)
+  80239d:	e8 b3 e9 ff ff       	call   800d55 <memmove>
+	return r;
+  8023a2:	83 c4 10             	add    $0x10,%esp
+}
+  8023a5:	89 d8                	mov    %ebx,%eax
+  8023a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023aa:	c9                   	leave
+  8023ab:	c3                   	ret
+
+008023ac <open>:
+{
+  8023ac:	55                   	push   %ebp
+  8023ad:	89 e5                	mov    %esp,%ebp
+  8023af:	53                   	push   %ebx
+  8023b0:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8023b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023b6:	50                   	push   %eax
+  8023b7:	e8 23 f8 ff ff       	call   801bdf <fd_alloc>
+  8023bc:	89 c3                	mov    %eax,%ebx
+  8023be:	83 c4 10             	add    $0x10,%esp
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	78 2a                	js     8023ef <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8023c5:	83 ec 0c             	sub    $0xc,%esp
+  8023c8:	ff 75 08             	push   0x8(%ebp)
+  8023cb:	e8 89 e7 ff ff       	call   800b59 <strlen>
+  8023d0:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8023d3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8023d8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8023dd:	7e 17                	jle    8023f6 <open+0x4a>
+	fd_close(fd, 1);
+  8023df:	83 ec 08             	sub    $0x8,%esp
+  8023e2:	6a 01                	push   $0x1
+  8023e4:	ff 75 f4             	push   -0xc(%ebp)
+  8023e7:	e8 08 f9 ff ff       	call   801cf4 <fd_close>
+	return r;
+  8023ec:	83 c4 10             	add    $0x10,%esp
+}
+  8023ef:	89 d8                	mov    %ebx,%eax
+  8023f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f4:	c9                   	leave
+  8023f5:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8023f6:	83 ec 08             	sub    $0x8,%esp
+  8023f9:	ff 75 08             	push   0x8(%ebp)
+  8023fc:	68 00 d0 80 00       	push   $0x80d000
+  802401:	e8 9f e7 ff ff       	call   800ba5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802406:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802409:	a3 00 d4 80 00       	mov    %eax,0x80d400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  80240e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802411:	b8 01 00 00 00       	mov    $0x1,%eax
+  802416:	e8 07 fe ff ff       	call   802222 <fsipc>
+  80241b:	89 c3                	mov    %eax,%ebx
+  80241d:	83 c4 10             	add    $0x10,%esp
+  802420:	85 c0                	test   %eax,%eax
+  802422:	78 bb                	js     8023df <open+0x33>
+	return fd2num(fd); 	
+  802424:	83 ec 0c             	sub    $0xc,%esp
+  802427:	ff 75 f4             	push   -0xc(%ebp)
+  80242a:	e8 89 f7 ff ff       	call   801bb8 <fd2num>
+  80242f:	89 c3                	mov    %eax,%ebx
+  802431:	83 c4 10             	add    $0x10,%esp
+  802434:	eb b9                	jmp    8023ef <open+0x43>
+
+00802436 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802436:	55                   	push   %ebp
+  802437:	89 e5                	mov    %esp,%ebp
+  802439:	53                   	push   %ebx
+  80243a:	83 ec 1c             	sub    $0x1c,%esp
+  80243d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802440:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802443:	50                   	push   %eax
+  802444:	ff 75 08             	push   0x8(%ebp)
+  802447:	e8 e3 f7 ff ff       	call   801c2f <fd_lookup>
+  80244c:	83 c4 10             	add    $0x10,%esp
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 5a                	js     8024ad <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802453:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802456:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  80245c:	39 10                	cmp    %edx,(%eax)
+  80245e:	75 66                	jne    8024c6 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802460:	83 3d c4 b6 80 00 00 	cmpl   $0x0,0x80b6c4
+  802467:	74 49                	je     8024b2 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802469:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80246c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80246f:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.map.req_offset = offset;
+  802474:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802477:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	fsipcbuf.map.req_npages = maxpages;
+  80247c:	89 1d 08 d0 80 00    	mov    %ebx,0x80d008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802482:	6a 07                	push   $0x7
+  802484:	68 00 d0 80 00       	push   $0x80d000
+  802489:	6a 09                	push   $0x9
+  80248b:	ff 35 c4 b6 80 00    	push   0x80b6c4
+  802491:	e8 d3 28 00 00       	call   804d69 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802496:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80249d:	6a 00                	push   $0x0
+  80249f:	53                   	push   %ebx
+  8024a0:	ff 75 10             	push   0x10(%ebp)
+  8024a3:	6a 00                	push   $0x0
+  8024a5:	e8 fc 26 00 00       	call   804ba6 <ipc_recv_pages>
+  8024aa:	83 c4 20             	add    $0x20,%esp
+}
+  8024ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b0:	c9                   	leave
+  8024b1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024b2:	83 ec 0c             	sub    $0xc,%esp
+  8024b5:	6a 02                	push   $0x2
+  8024b7:	e8 16 29 00 00       	call   804dd2 <ipc_find_env>
+  8024bc:	a3 c4 b6 80 00       	mov    %eax,0x80b6c4
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	eb a3                	jmp    802469 <fmap+0x33>
+		return -E_INVAL;
+  8024c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024cb:	eb e0                	jmp    8024ad <fmap+0x77>
+
+008024cd <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	53                   	push   %ebx
+  8024d1:	83 ec 10             	sub    $0x10,%esp
+  8024d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8024d7:	53                   	push   %ebx
+  8024d8:	e8 7c e6 ff ff       	call   800b59 <strlen>
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024e5:	7f 25                	jg     80250c <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024e7:	83 ec 08             	sub    $0x8,%esp
+  8024ea:	53                   	push   %ebx
+  8024eb:	68 00 d0 80 00       	push   $0x80d000
+  8024f0:	e8 b0 e6 ff ff       	call   800ba5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024ff:	e8 1e fd ff ff       	call   802222 <fsipc>
+  802504:	83 c4 10             	add    $0x10,%esp
+}
+  802507:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+		return -E_BAD_PATH;
+  80250c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802511:	eb f4                	jmp    802507 <remove+0x3a>
+
+00802513 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802513:	55                   	push   %ebp
+  802514:	89 e5                	mov    %esp,%ebp
+  802516:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802519:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802523:	e8 fa fc ff ff       	call   802222 <fsipc>
+}
+  802528:	c9                   	leave
+  802529:	c3                   	ret
+
+0080252a <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80252a:	55                   	push   %ebp
+  80252b:	89 e5                	mov    %esp,%ebp
+  80252d:	57                   	push   %edi
+  80252e:	56                   	push   %esi
+  80252f:	53                   	push   %ebx
+  802530:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802536:	6a 00                	push   $0x0
+  802538:	ff 75 08             	push   0x8(%ebp)
+  80253b:	e8 6c fe ff ff       	call   8023ac <open>
+  802540:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802546:	83 c4 10             	add    $0x10,%esp
+  802549:	85 c0                	test   %eax,%eax
+  80254b:	0f 88 ab 04 00 00    	js     8029fc <spawn+0x4d2>
+  802551:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802553:	83 ec 04             	sub    $0x4,%esp
+  802556:	68 00 02 00 00       	push   $0x200
+  80255b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802561:	50                   	push   %eax
+  802562:	51                   	push   %ecx
+  802563:	e8 ef f9 ff ff       	call   801f57 <readn>
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802570:	0f 85 e6 01 00 00    	jne    80275c <spawn+0x232>
+	    || elf->e_magic != ELF_MAGIC) {
+  802576:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80257d:	45 4c 46 
+  802580:	0f 85 d6 01 00 00    	jne    80275c <spawn+0x232>
+	__asm __volatile("int %2"
+  802586:	b8 07 00 00 00       	mov    $0x7,%eax
+  80258b:	cd 30                	int    $0x30
+  80258d:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802593:	85 c0                	test   %eax,%eax
+  802595:	0f 88 55 04 00 00    	js     8029f0 <spawn+0x4c6>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  80259b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8025a0:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+  8025a6:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8025ac:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8025b2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8025b7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8025b9:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8025bf:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8025c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025c8:	8b 00                	mov    (%eax),%eax
+  8025ca:	85 c0                	test   %eax,%eax
+  8025cc:	0f 84 a5 07 00 00    	je     802d77 <spawn+0x84d>
+  8025d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8025d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+		string_size += strlen(argv[argc]) + 1;
+  8025df:	83 ec 0c             	sub    $0xc,%esp
+  8025e2:	50                   	push   %eax
+  8025e3:	e8 71 e5 ff ff       	call   800b59 <strlen>
+  8025e8:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8025ec:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  8025f2:	83 c3 01             	add    $0x1,%ebx
+  8025f5:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  8025fc:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	85 c0                	test   %eax,%eax
+  802604:	75 d9                	jne    8025df <spawn+0xb5>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802606:	89 95 84 fd ff ff    	mov    %edx,-0x27c(%ebp)
+  80260c:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  802612:	be 00 10 40 00       	mov    $0x401000,%esi
+  802617:	29 fe                	sub    %edi,%esi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802619:	89 f2                	mov    %esi,%edx
+  80261b:	83 e2 fc             	and    $0xfffffffc,%edx
+  80261e:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802624:	8d 04 85 08 00 00 00 	lea    0x8(,%eax,4),%eax
+  80262b:	29 c2                	sub    %eax,%edx
+  80262d:	89 d7                	mov    %edx,%edi
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80262f:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802632:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802637:	0f 86 ee 06 00 00    	jbe    802d2b <spawn+0x801>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80263d:	83 ec 04             	sub    $0x4,%esp
+  802640:	6a 07                	push   $0x7
+  802642:	68 00 00 40 00       	push   $0x400000
+  802647:	6a 00                	push   $0x0
+  802649:	e8 8b e9 ff ff       	call   800fd9 <sys_page_alloc>
+  80264e:	83 c4 10             	add    $0x10,%esp
+  802651:	85 c0                	test   %eax,%eax
+  802653:	0f 88 d7 06 00 00    	js     802d30 <spawn+0x806>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802659:	85 db                	test   %ebx,%ebx
+  80265b:	7e 58                	jle    8026b5 <spawn+0x18b>
+  80265d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802662:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  802668:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		argv_store[i] = UTEMP2USTACK(string_store);
+  80266b:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802671:	8d 86 00 d0 7f ee    	lea    -0x11803000(%esi),%eax
+  802677:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  80267d:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+		strcpy(string_store, argv[i]);
+  802680:	83 ec 08             	sub    $0x8,%esp
+  802683:	ff 34 9f             	push   (%edi,%ebx,4)
+  802686:	56                   	push   %esi
+  802687:	e8 19 e5 ff ff       	call   800ba5 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80268c:	83 c4 04             	add    $0x4,%esp
+  80268f:	ff 34 9f             	push   (%edi,%ebx,4)
+  802692:	e8 c2 e4 ff ff       	call   800b59 <strlen>
+  802697:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+  80269b:	83 c3 01             	add    $0x1,%ebx
+  80269e:	83 c4 10             	add    $0x10,%esp
+  8026a1:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  8026a7:	39 8d 94 fd ff ff    	cmp    %ecx,-0x26c(%ebp)
+  8026ad:	75 bc                	jne    80266b <spawn+0x141>
+  8026af:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+	}
+	argv_store[argc] = 0;
+  8026b5:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8026bb:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8026c2:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  8026c8:	0f 85 c6 00 00 00    	jne    802794 <spawn+0x26a>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8026ce:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8026d4:	89 47 fc             	mov    %eax,-0x4(%edi)
+	argv_store[-2] = argc;
+  8026d7:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  8026dd:	89 47 f8             	mov    %eax,-0x8(%edi)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8026e0:	8d 87 f8 cf 7f ee    	lea    -0x11803008(%edi),%eax
+  8026e6:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8026ec:	83 ec 0c             	sub    $0xc,%esp
+  8026ef:	6a 07                	push   $0x7
+  8026f1:	68 00 d0 bf ee       	push   $0xeebfd000
+  8026f6:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8026fc:	68 00 00 40 00       	push   $0x400000
+  802701:	6a 00                	push   $0x0
+  802703:	e8 14 e9 ff ff       	call   80101c <sys_page_map>
+  802708:	89 c3                	mov    %eax,%ebx
+  80270a:	83 c4 20             	add    $0x20,%esp
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	0f 88 45 06 00 00    	js     802d5a <spawn+0x830>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802715:	83 ec 08             	sub    $0x8,%esp
+  802718:	68 00 00 40 00       	push   $0x400000
+  80271d:	6a 00                	push   $0x0
+  80271f:	e8 3a e9 ff ff       	call   80105e <sys_page_unmap>
+  802724:	89 c3                	mov    %eax,%ebx
+  802726:	83 c4 10             	add    $0x10,%esp
+  802729:	85 c0                	test   %eax,%eax
+  80272b:	0f 88 29 06 00 00    	js     802d5a <spawn+0x830>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802731:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802737:	8d 84 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%eax
+  80273e:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802744:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  80274b:	00 
+  80274c:	0f 84 a4 00 00 00    	je     8027f6 <spawn+0x2cc>
+  802752:	bf 00 00 00 00       	mov    $0x0,%edi
+  802757:	e9 19 03 00 00       	jmp    802a75 <spawn+0x54b>
+		close(fd);
+  80275c:	83 ec 0c             	sub    $0xc,%esp
+  80275f:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802765:	e8 0a f6 ff ff       	call   801d74 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80276a:	83 c4 0c             	add    $0xc,%esp
+  80276d:	68 7f 45 4c 46       	push   $0x464c457f
+  802772:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802778:	68 40 56 80 00       	push   $0x805640
+  80277d:	e8 2c dd ff ff       	call   8004ae <cprintf>
+		return -E_NOT_EXEC;
+  802782:	83 c4 10             	add    $0x10,%esp
+  802785:	c7 85 78 fd ff ff f2 	movl   $0xfffffff2,-0x288(%ebp)
+  80278c:	ff ff ff 
+  80278f:	e9 68 02 00 00       	jmp    8029fc <spawn+0x4d2>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802794:	68 a8 56 80 00       	push   $0x8056a8
+  802799:	68 5a 56 80 00       	push   $0x80565a
+  80279e:	68 f1 00 00 00       	push   $0xf1
+  8027a3:	68 6f 56 80 00       	push   $0x80566f
+  8027a8:	e8 26 dc ff ff       	call   8003d3 <_panic>
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
+  8027ad:	50                   	push   %eax
+  8027ae:	68 d0 56 80 00       	push   $0x8056d0
+  8027b3:	68 2d 01 00 00       	push   $0x12d
+  8027b8:	68 6f 56 80 00       	push   $0x80566f
+  8027bd:	e8 11 dc ff ff       	call   8003d3 <_panic>
+  8027c2:	89 c6                	mov    %eax,%esi
+  8027c4:	eb 02                	jmp    8027c8 <spawn+0x29e>
+  8027c6:	89 c6                	mov    %eax,%esi
+	sys_env_destroy(child);
+  8027c8:	83 ec 0c             	sub    $0xc,%esp
+  8027cb:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8027d1:	e8 84 e7 ff ff       	call   800f5a <sys_env_destroy>
+	close(fd);
+  8027d6:	83 c4 04             	add    $0x4,%esp
+  8027d9:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  8027df:	e8 90 f5 ff ff       	call   801d74 <close>
+	return r;
+  8027e4:	83 c4 10             	add    $0x10,%esp
+  8027e7:	89 b5 78 fd ff ff    	mov    %esi,-0x288(%ebp)
+  8027ed:	e9 0a 02 00 00       	jmp    8029fc <spawn+0x4d2>
+  8027f2:	89 c6                	mov    %eax,%esi
+  8027f4:	eb d2                	jmp    8027c8 <spawn+0x29e>
+	close(fd);
+  8027f6:	83 ec 0c             	sub    $0xc,%esp
+  8027f9:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  8027ff:	e8 70 f5 ff ff       	call   801d74 <close>
+	// LAB 7: Your code here.
+	static struct PageBatch pb;
+	uintptr_t addr;
+	uint32_t pn, pd;
+	int r;
+	pgbatch_init(&pb);
+  802804:	c7 04 24 e0 b6 80 00 	movl   $0x80b6e0,(%esp)
+  80280b:	e8 65 1d 00 00       	call   804575 <pgbatch_init>
+  802810:	83 c4 10             	add    $0x10,%esp
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802813:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802818:	8b b5 90 fd ff ff    	mov    -0x270(%ebp),%esi
+  80281e:	eb 24                	jmp    802844 <spawn+0x31a>
+		pd = PDX(addr);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  802820:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802826:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  80282c:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802832:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802838:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  80283e:	0f 87 18 01 00 00    	ja     80295c <spawn+0x432>
+		pd = PDX(addr);
+  802844:	89 d8                	mov    %ebx,%eax
+  802846:	c1 e8 16             	shr    $0x16,%eax
+		if (!(vpd[pd] & PTE_P)) {
+  802849:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802850:	a8 01                	test   $0x1,%al
+  802852:	74 cc                	je     802820 <spawn+0x2f6>
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  802854:	89 d9                	mov    %ebx,%ecx
+  802856:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+  80285c:	74 4c                	je     8028aa <spawn+0x380>
+				continue;
+			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+  80285e:	89 d8                	mov    %ebx,%eax
+  802860:	c1 e8 0c             	shr    $0xc,%eax
+		if(vpt[pn] & PTE_SHARE) {
+  802863:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80286a:	f6 c6 04             	test   $0x4,%dh
+  80286d:	74 c3                	je     802832 <spawn+0x308>
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+  80286f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802876:	83 ec 08             	sub    $0x8,%esp
+  802879:	25 07 0e 00 00       	and    $0xe07,%eax
+  80287e:	50                   	push   %eax
+  80287f:	53                   	push   %ebx
+  802880:	56                   	push   %esi
+  802881:	53                   	push   %ebx
+  802882:	6a 00                	push   $0x0
+  802884:	68 e0 b6 80 00       	push   $0x80b6e0
+  802889:	e8 a5 1d 00 00       	call   804633 <pgbatch_map>
+  80288e:	83 c4 20             	add    $0x20,%esp
+  802891:	85 c0                	test   %eax,%eax
+  802893:	79 9d                	jns    802832 <spawn+0x308>
+				panic("sys_page_batch: %e", r);
+  802895:	50                   	push   %eax
+  802896:	68 7b 56 80 00       	push   $0x80567b
+  80289b:	68 6b 01 00 00       	push   $0x16b
+  8028a0:	68 6f 56 80 00       	push   $0x80566f
+  8028a5:	e8 29 db ff ff       	call   8003d3 <_panic>
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  8028aa:	89 d8                	mov    %ebx,%eax
+  8028ac:	c1 e8 0c             	shr    $0xc,%eax
+  8028af:	8d b8 00 04 00 00    	lea    0x400(%eax),%edi
+  8028b5:	eb 0a                	jmp    8028c1 <spawn+0x397>
+			n++;
+  8028b7:	83 c1 01             	add    $0x1,%ecx
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  8028ba:	83 c0 01             	add    $0x1,%eax
+  8028bd:	39 f8                	cmp    %edi,%eax
+  8028bf:	73 1a                	jae    8028db <spawn+0x3b1>
+		if (vpt[pn] & PTE_P) {
+  8028c1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8028c8:	f6 c2 01             	test   $0x1,%dl
+  8028cb:	74 ed                	je     8028ba <spawn+0x390>
+			if (!(vpt[pn] & PTE_SHARE))
+  8028cd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8028d4:	f6 c6 04             	test   $0x4,%dh
+  8028d7:	75 de                	jne    8028b7 <spawn+0x38d>
+  8028d9:	eb 83                	jmp    80285e <spawn+0x334>
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  8028db:	85 c9                	test   %ecx,%ecx
+  8028dd:	0f 84 7b ff ff ff    	je     80285e <spawn+0x334>
+			if ((r = pgbatch_flush(&pb)) < 0)
+  8028e3:	83 ec 0c             	sub    $0xc,%esp
+  8028e6:	68 e0 b6 80 00       	push   $0x80b6e0
+  8028eb:	e8 93 1c 00 00       	call   804583 <pgbatch_flush>
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	78 45                	js     80293c <spawn+0x412>
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+  8028f7:	83 ec 0c             	sub    $0xc,%esp
+  8028fa:	6a 00                	push   $0x0
+  8028fc:	56                   	push   %esi
+  8028fd:	53                   	push   %ebx
+  8028fe:	6a 00                	push   $0x0
+  802900:	68 e0 b6 80 00       	push   $0x80b6e0
+  802905:	e8 d4 1d 00 00       	call   8046de <pgbatch_sharept>
+			if ((r = pgbatch_flush(&pb)) == 0) {
+  80290a:	83 c4 14             	add    $0x14,%esp
+  80290d:	68 e0 b6 80 00       	push   $0x80b6e0
+  802912:	e8 6c 1c 00 00       	call   804583 <pgbatch_flush>
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	74 33                	je     802951 <spawn+0x427>
+			if (r != -E_INVAL)
+  80291e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  802921:	0f 84 37 ff ff ff    	je     80285e <spawn+0x334>
+				panic("sys_page_batch: %e", r);
+  802927:	50                   	push   %eax
+  802928:	68 7b 56 80 00       	push   $0x80567b
+  80292d:	68 66 01 00 00       	push   $0x166
+  802932:	68 6f 56 80 00       	push   $0x80566f
+  802937:	e8 97 da ff ff       	call   8003d3 <_panic>
+				panic("sys_page_batch: %e", r);
+  80293c:	50                   	push   %eax
+  80293d:	68 7b 56 80 00       	push   $0x80567b
+  802942:	68 5f 01 00 00       	push   $0x15f
+  802947:	68 6f 56 80 00       	push   $0x80566f
+  80294c:	e8 82 da ff ff       	call   8003d3 <_panic>
+				addr += PTSIZE - PGSIZE;
+  802951:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+				continue;
+  802957:	e9 d6 fe ff ff       	jmp    802832 <spawn+0x308>
+		}
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  80295c:	83 ec 0c             	sub    $0xc,%esp
+  80295f:	68 e0 b6 80 00       	push   $0x80b6e0
+  802964:	e8 1a 1c 00 00       	call   804583 <pgbatch_flush>
+  802969:	83 c4 10             	add    $0x10,%esp
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	78 41                	js     8029b1 <spawn+0x487>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802970:	83 ec 08             	sub    $0x8,%esp
+  802973:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802979:	50                   	push   %eax
+  80297a:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802980:	e8 5d e7 ff ff       	call   8010e2 <sys_env_set_trapframe>
+  802985:	83 c4 10             	add    $0x10,%esp
+  802988:	85 c0                	test   %eax,%eax
+  80298a:	78 3a                	js     8029c6 <spawn+0x49c>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80298c:	83 ec 08             	sub    $0x8,%esp
+  80298f:	6a 02                	push   $0x2
+  802991:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802997:	e8 04 e7 ff ff       	call   8010a0 <sys_env_set_status>
+  80299c:	83 c4 10             	add    $0x10,%esp
+  80299f:	85 c0                	test   %eax,%eax
+  8029a1:	78 38                	js     8029db <spawn+0x4b1>
+	return child;
+  8029a3:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  8029a9:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  8029af:	eb 4b                	jmp    8029fc <spawn+0x4d2>
+		panic("sys_page_batch: %e", r);
+  8029b1:	50                   	push   %eax
+  8029b2:	68 7b 56 80 00       	push   $0x80567b
+  8029b7:	68 6f 01 00 00       	push   $0x16f
+  8029bc:	68 6f 56 80 00       	push   $0x80566f
+  8029c1:	e8 0d da ff ff       	call   8003d3 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  8029c6:	50                   	push   %eax
+  8029c7:	68 8e 56 80 00       	push   $0x80568e
+  8029cc:	68 85 00 00 00       	push   $0x85
+  8029d1:	68 6f 56 80 00       	push   $0x80566f
+  8029d6:	e8 f8 d9 ff ff       	call   8003d3 <_panic>
+		panic("sys_env_set_status: %e", r);
+  8029db:	50                   	push   %eax
+  8029dc:	68 76 55 80 00       	push   $0x805576
+  8029e1:	68 88 00 00 00       	push   $0x88
+  8029e6:	68 6f 56 80 00       	push   $0x80566f
+  8029eb:	e8 e3 d9 ff ff       	call   8003d3 <_panic>
+		return r;
+  8029f0:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  8029f6:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+}
+  8029fc:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802a02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a05:	5b                   	pop    %ebx
+  802a06:	5e                   	pop    %esi
+  802a07:	5f                   	pop    %edi
+  802a08:	5d                   	pop    %ebp
+  802a09:	c3                   	ret
+	for (j = 0; j < n; j++)
+  802a0a:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  802a10:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802a16:	85 db                	test   %ebx,%ebx
+  802a18:	0f 8e 06 03 00 00    	jle    802d24 <spawn+0x7fa>
+  802a1e:	81 c6 00 04 00 00    	add    $0x400,%esi
+  802a24:	c1 e6 0c             	shl    $0xc,%esi
+  802a27:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  802a2c:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802a32:	89 c7                	mov    %eax,%edi
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+  802a34:	83 ec 08             	sub    $0x8,%esp
+  802a37:	53                   	push   %ebx
+  802a38:	6a 00                	push   $0x0
+  802a3a:	e8 1f e6 ff ff       	call   80105e <sys_page_unmap>
+	for (j = 0; j < n; j++)
+  802a3f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a45:	83 c4 10             	add    $0x10,%esp
+  802a48:	39 f3                	cmp    %esi,%ebx
+  802a4a:	75 e8                	jne    802a34 <spawn+0x50a>
+  802a4c:	89 f8                	mov    %edi,%eax
+  802a4e:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802a54:	85 c0                	test   %eax,%eax
+  802a56:	0f 88 66 fd ff ff    	js     8027c2 <spawn+0x298>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802a5c:	83 c7 01             	add    $0x1,%edi
+  802a5f:	83 85 7c fd ff ff 20 	addl   $0x20,-0x284(%ebp)
+  802a66:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802a6d:	39 f8                	cmp    %edi,%eax
+  802a6f:	0f 8e 81 fd ff ff    	jle    8027f6 <spawn+0x2cc>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802a75:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802a7b:	83 39 01             	cmpl   $0x1,(%ecx)
+  802a7e:	75 dc                	jne    802a5c <spawn+0x532>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802a80:	8b 41 18             	mov    0x18(%ecx),%eax
+  802a83:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+  802a89:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802a8c:	83 f8 01             	cmp    $0x1,%eax
+  802a8f:	19 c0                	sbb    %eax,%eax
+  802a91:	83 e0 fe             	and    $0xfffffffe,%eax
+  802a94:	83 c0 07             	add    $0x7,%eax
+  802a97:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802a9d:	8b 51 04             	mov    0x4(%ecx),%edx
+  802aa0:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802aa6:	8b 59 10             	mov    0x10(%ecx),%ebx
+  802aa9:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802aaf:	8b 41 14             	mov    0x14(%ecx),%eax
+  802ab2:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+  802ab8:	8b 71 08             	mov    0x8(%ecx),%esi
+  802abb:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+	if ((i = PGOFF(va))) {
+  802ac1:	89 f0                	mov    %esi,%eax
+  802ac3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ac8:	74 1e                	je     802ae8 <spawn+0x5be>
+		va -= i;
+  802aca:	29 c6                	sub    %eax,%esi
+  802acc:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		memsz += i;
+  802ad2:	01 85 68 fd ff ff    	add    %eax,-0x298(%ebp)
+		filesz += i;
+  802ad8:	01 c3                	add    %eax,%ebx
+  802ada:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+		fileoffset -= i;
+  802ae0:	29 c2                	sub    %eax,%edx
+  802ae2:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+	pgbatch_init(&pb);
+  802ae8:	83 ec 0c             	sub    $0xc,%esp
+  802aeb:	68 00 ba 80 00       	push   $0x80ba00
+  802af0:	e8 80 1a 00 00       	call   804575 <pgbatch_init>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802af5:	83 c4 10             	add    $0x10,%esp
+  802af8:	83 bd 88 fd ff ff 00 	cmpl   $0x0,-0x278(%ebp)
+  802aff:	0f 84 a6 01 00 00    	je     802cab <spawn+0x781>
+  802b05:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802b0c:	00 00 00 
+  802b0f:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802b16:	00 00 00 
+  802b19:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802b1f:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  802b25:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802b2b:	29 c7                	sub    %eax,%edi
+  802b2d:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  802b33:	c1 ee 0c             	shr    $0xc,%esi
+  802b36:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b3b:	39 c6                	cmp    %eax,%esi
+  802b3d:	0f 47 f0             	cmova  %eax,%esi
+  802b40:	89 b5 94 fd ff ff    	mov    %esi,-0x26c(%ebp)
+		for (j = 0; j < n; j++)
+  802b46:	85 f6                	test   %esi,%esi
+  802b48:	0f 8e ed 01 00 00    	jle    802d3b <spawn+0x811>
+  802b4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b53:	89 bd 70 fd ff ff    	mov    %edi,-0x290(%ebp)
+  802b59:	89 f7                	mov    %esi,%edi
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  802b5b:	6a 07                	push   $0x7
+  802b5d:	89 d8                	mov    %ebx,%eax
+  802b5f:	c1 e0 0c             	shl    $0xc,%eax
+  802b62:	05 00 00 40 00       	add    $0x400000,%eax
+  802b67:	50                   	push   %eax
+  802b68:	6a 00                	push   $0x0
+  802b6a:	68 00 ba 80 00       	push   $0x80ba00
+  802b6f:	e8 88 1a 00 00       	call   8045fc <pgbatch_alloc>
+  802b74:	83 c4 10             	add    $0x10,%esp
+  802b77:	85 c0                	test   %eax,%eax
+  802b79:	0f 88 47 fc ff ff    	js     8027c6 <spawn+0x29c>
+		for (j = 0; j < n; j++)
+  802b7f:	83 c3 01             	add    $0x1,%ebx
+  802b82:	39 df                	cmp    %ebx,%edi
+  802b84:	75 d5                	jne    802b5b <spawn+0x631>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802b86:	8b bd 70 fd ff ff    	mov    -0x290(%ebp),%edi
+  802b8c:	83 ec 0c             	sub    $0xc,%esp
+  802b8f:	68 00 ba 80 00       	push   $0x80ba00
+  802b94:	e8 ea 19 00 00       	call   804583 <pgbatch_flush>
+  802b99:	83 c4 10             	add    $0x10,%esp
+  802b9c:	85 c0                	test   %eax,%eax
+  802b9e:	0f 88 66 fe ff ff    	js     802a0a <spawn+0x4e0>
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802ba4:	83 ec 08             	sub    $0x8,%esp
+  802ba7:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802bad:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802bb3:	01 c8                	add    %ecx,%eax
+  802bb5:	50                   	push   %eax
+  802bb6:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802bbc:	e8 89 f4 ff ff       	call   80204a <seek>
+  802bc1:	83 c4 10             	add    $0x10,%esp
+  802bc4:	85 c0                	test   %eax,%eax
+  802bc6:	0f 88 3e fe ff ff    	js     802a0a <spawn+0x4e0>
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802bcc:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802bd2:	c1 e3 0c             	shl    $0xc,%ebx
+  802bd5:	83 ec 04             	sub    $0x4,%esp
+  802bd8:	39 fb                	cmp    %edi,%ebx
+  802bda:	0f 46 fb             	cmovbe %ebx,%edi
+  802bdd:	57                   	push   %edi
+  802bde:	68 00 00 40 00       	push   $0x400000
+  802be3:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802be9:	e8 69 f3 ff ff       	call   801f57 <readn>
+  802bee:	83 c4 10             	add    $0x10,%esp
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	0f 88 11 fe ff ff    	js     802a0a <spawn+0x4e0>
+		for (j = 0; j < n; j++) {
+  802bf9:	83 bd 94 fd ff ff 00 	cmpl   $0x0,-0x26c(%ebp)
+  802c00:	7e 6b                	jle    802c6d <spawn+0x743>
+  802c02:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802c08:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802c0e:	01 c7                	add    %eax,%edi
+  802c10:	be 00 00 00 00       	mov    $0x0,%esi
+  802c15:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+  802c1b:	89 f3                	mov    %esi,%ebx
+  802c1d:	c1 e3 0c             	shl    $0xc,%ebx
+  802c20:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802c26:	83 ec 08             	sub    $0x8,%esp
+  802c29:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802c2f:	57                   	push   %edi
+  802c30:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c36:	53                   	push   %ebx
+  802c37:	6a 00                	push   $0x0
+  802c39:	68 00 ba 80 00       	push   $0x80ba00
+  802c3e:	e8 f0 19 00 00       	call   804633 <pgbatch_map>
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+  802c43:	83 c4 1c             	add    $0x1c,%esp
+  802c46:	53                   	push   %ebx
+  802c47:	6a 00                	push   $0x0
+  802c49:	68 00 ba 80 00       	push   $0x80ba00
+  802c4e:	e8 23 1a 00 00       	call   804676 <pgbatch_unmap>
+		for (j = 0; j < n; j++) {
+  802c53:	83 c6 01             	add    $0x1,%esi
+  802c56:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802c5c:	83 c4 10             	add    $0x10,%esp
+  802c5f:	39 b5 94 fd ff ff    	cmp    %esi,-0x26c(%ebp)
+  802c65:	75 b4                	jne    802c1b <spawn+0x6f1>
+  802c67:	8b 9d 80 fd ff ff    	mov    -0x280(%ebp),%ebx
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802c6d:	83 ec 0c             	sub    $0xc,%esp
+  802c70:	68 00 ba 80 00       	push   $0x80ba00
+  802c75:	e8 09 19 00 00       	call   804583 <pgbatch_flush>
+  802c7a:	83 c4 10             	add    $0x10,%esp
+  802c7d:	85 c0                	test   %eax,%eax
+  802c7f:	0f 88 28 fb ff ff    	js     8027ad <spawn+0x283>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802c85:	01 9d 84 fd ff ff    	add    %ebx,-0x27c(%ebp)
+  802c8b:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802c91:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802c97:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  802c9d:	39 f0                	cmp    %esi,%eax
+  802c9f:	0f 82 7a fe ff ff    	jb     802b1f <spawn+0x5f5>
+  802ca5:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802cab:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802cb1:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802cb6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802cbb:	89 c3                	mov    %eax,%ebx
+  802cbd:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802cc3:	39 f0                	cmp    %esi,%eax
+  802cc5:	73 48                	jae    802d0f <spawn+0x7e5>
+  802cc7:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802ccd:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802cd3:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+  802cd9:	56                   	push   %esi
+  802cda:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802ce0:	01 d8                	add    %ebx,%eax
+  802ce2:	50                   	push   %eax
+  802ce3:	57                   	push   %edi
+  802ce4:	68 00 ba 80 00       	push   $0x80ba00
+  802ce9:	e8 0e 19 00 00       	call   8045fc <pgbatch_alloc>
+  802cee:	83 c4 10             	add    $0x10,%esp
+  802cf1:	85 c0                	test   %eax,%eax
+  802cf3:	0f 88 f9 fa ff ff    	js     8027f2 <spawn+0x2c8>
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802cf9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802cff:	8b 85 68 fd ff ff    	mov    -0x298(%ebp),%eax
+  802d05:	39 c3                	cmp    %eax,%ebx
+  802d07:	72 d0                	jb     802cd9 <spawn+0x7af>
+  802d09:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+	return pgbatch_flush(&pb);
+  802d0f:	83 ec 0c             	sub    $0xc,%esp
+  802d12:	68 00 ba 80 00       	push   $0x80ba00
+  802d17:	e8 67 18 00 00       	call   804583 <pgbatch_flush>
+  802d1c:	83 c4 10             	add    $0x10,%esp
+  802d1f:	e9 30 fd ff ff       	jmp    802a54 <spawn+0x52a>
+  802d24:	89 c6                	mov    %eax,%esi
+  802d26:	e9 9d fa ff ff       	jmp    8027c8 <spawn+0x29e>
+		return -E_NO_MEM;
+  802d2b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802d30:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802d36:	e9 c1 fc ff ff       	jmp    8029fc <spawn+0x4d2>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802d3b:	83 ec 0c             	sub    $0xc,%esp
+  802d3e:	68 00 ba 80 00       	push   $0x80ba00
+  802d43:	e8 3b 18 00 00       	call   804583 <pgbatch_flush>
+  802d48:	83 c4 10             	add    $0x10,%esp
+  802d4b:	85 c0                	test   %eax,%eax
+  802d4d:	0f 89 51 fe ff ff    	jns    802ba4 <spawn+0x67a>
+  802d53:	89 c6                	mov    %eax,%esi
+  802d55:	e9 6e fa ff ff       	jmp    8027c8 <spawn+0x29e>
+	sys_page_unmap(0, UTEMP);
+  802d5a:	83 ec 08             	sub    $0x8,%esp
+  802d5d:	68 00 00 40 00       	push   $0x400000
+  802d62:	6a 00                	push   $0x0
+  802d64:	e8 f5 e2 ff ff       	call   80105e <sys_page_unmap>
+  802d69:	83 c4 10             	add    $0x10,%esp
+  802d6c:	89 9d 78 fd ff ff    	mov    %ebx,-0x288(%ebp)
+  802d72:	e9 85 fc ff ff       	jmp    8029fc <spawn+0x4d2>
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802d77:	83 ec 04             	sub    $0x4,%esp
+  802d7a:	6a 07                	push   $0x7
+  802d7c:	68 00 00 40 00       	push   $0x400000
+  802d81:	6a 00                	push   $0x0
+  802d83:	e8 51 e2 ff ff       	call   800fd9 <sys_page_alloc>
+  802d88:	83 c4 10             	add    $0x10,%esp
+  802d8b:	85 c0                	test   %eax,%eax
+  802d8d:	78 a1                	js     802d30 <spawn+0x806>
+	for (argc = 0; argv[argc] != 0; argc++)
+  802d8f:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802d96:	00 00 00 
+  802d99:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802da0:	00 00 00 
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802da3:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802da8:	be 00 10 40 00       	mov    $0x401000,%esi
+  802dad:	e9 03 f9 ff ff       	jmp    8026b5 <spawn+0x18b>
+
+00802db2 <spawnl>:
+{
+  802db2:	55                   	push   %ebp
+  802db3:	89 e5                	mov    %esp,%ebp
+  802db5:	56                   	push   %esi
+  802db6:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802db7:	8d 45 10             	lea    0x10(%ebp),%eax
+	int argc=0;
+  802dba:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802dbf:	eb 05                	jmp    802dc6 <spawnl+0x14>
+		argc++;
+  802dc1:	83 c1 01             	add    $0x1,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802dc4:	89 d0                	mov    %edx,%eax
+  802dc6:	8d 50 04             	lea    0x4(%eax),%edx
+  802dc9:	83 38 00             	cmpl   $0x0,(%eax)
+  802dcc:	75 f3                	jne    802dc1 <spawnl+0xf>
+	const char *argv[argc+2];
+  802dce:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802dd5:	83 e0 f0             	and    $0xfffffff0,%eax
+  802dd8:	29 c4                	sub    %eax,%esp
+  802dda:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802dde:	89 d8                	mov    %ebx,%eax
+  802de0:	c1 e8 02             	shr    $0x2,%eax
+  802de3:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802de6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802de9:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+	argv[argc+1] = NULL;
+  802df0:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802df7:	00 
+	va_start(vl, arg0);
+  802df8:	8d 55 10             	lea    0x10(%ebp),%edx
+	for(i=0;i<argc;i++)
+  802dfb:	89 ce                	mov    %ecx,%esi
+  802dfd:	85 c9                	test   %ecx,%ecx
+  802dff:	74 16                	je     802e17 <spawnl+0x65>
+  802e01:	b8 00 00 00 00       	mov    $0x0,%eax
+		argv[i+1] = va_arg(vl, const char *);
+  802e06:	83 c0 01             	add    $0x1,%eax
+  802e09:	89 d1                	mov    %edx,%ecx
+  802e0b:	83 c2 04             	add    $0x4,%edx
+  802e0e:	8b 09                	mov    (%ecx),%ecx
+  802e10:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	for(i=0;i<argc;i++)
+  802e13:	39 f0                	cmp    %esi,%eax
+  802e15:	75 ef                	jne    802e06 <spawnl+0x54>
+	return spawn(prog, argv);
+  802e17:	83 ec 08             	sub    $0x8,%esp
+  802e1a:	53                   	push   %ebx
+  802e1b:	ff 75 08             	push   0x8(%ebp)
+  802e1e:	e8 07 f7 ff ff       	call   80252a <spawn>
+}
+  802e23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e26:	5b                   	pop    %ebx
+  802e27:	5e                   	pop    %esi
+  802e28:	5d                   	pop    %ebp
+  802e29:	c3                   	ret
+
+00802e2a <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e2a:	55                   	push   %ebp
+  802e2b:	89 e5                	mov    %esp,%ebp
+  802e2d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e30:	68 ef 56 80 00       	push   $0x8056ef
+  802e35:	ff 75 0c             	push   0xc(%ebp)
+  802e38:	e8 68 dd ff ff       	call   800ba5 <strcpy>
+	return 0;
+}
+  802e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e42:	c9                   	leave
+  802e43:	c3                   	ret
+
+00802e44 <devsock_close>:
+{
+  802e44:	55                   	push   %ebp
+  802e45:	89 e5                	mov    %esp,%ebp
+  802e47:	53                   	push   %ebx
+  802e48:	83 ec 10             	sub    $0x10,%esp
+  802e4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e4e:	53                   	push   %ebx
+  802e4f:	e8 bd 1f 00 00       	call   804e11 <pageref>
+  802e54:	89 c2                	mov    %eax,%edx
+  802e56:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802e59:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802e5e:	83 fa 01             	cmp    $0x1,%edx
+  802e61:	74 05                	je     802e68 <devsock_close+0x24>
+}
+  802e63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e66:	c9                   	leave
+  802e67:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802e68:	83 ec 0c             	sub    $0xc,%esp
+  802e6b:	ff 73 0c             	push   0xc(%ebx)
+  802e6e:	e8 b0 05 00 00       	call   803423 <nsipc_close>
+  802e73:	83 c4 10             	add    $0x10,%esp
+  802e76:	eb eb                	jmp    802e63 <devsock_close+0x1f>
+
+00802e78 <devsock_write>:
+{
+  802e78:	55                   	push   %ebp
+  802e79:	89 e5                	mov    %esp,%ebp
+  802e7b:	53                   	push   %ebx
+  802e7c:	83 ec 14             	sub    $0x14,%esp
+  802e7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e82:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e85:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802e88:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802e8b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802e8e:	8b 41 08             	mov    0x8(%ecx),%eax
+  802e91:	c1 f8 09             	sar    $0x9,%eax
+  802e94:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802e97:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802e9d:	77 13                	ja     802eb2 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802e9f:	50                   	push   %eax
+  802ea0:	52                   	push   %edx
+  802ea1:	53                   	push   %ebx
+  802ea2:	ff 71 0c             	push   0xc(%ecx)
+  802ea5:	e8 5c 06 00 00       	call   803506 <nsipc_send>
+  802eaa:	83 c4 10             	add    $0x10,%esp
+}
+  802ead:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb0:	c9                   	leave
+  802eb1:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802eb2:	50                   	push   %eax
+  802eb3:	6a 01                	push   $0x1
+  802eb5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802eb8:	50                   	push   %eax
+  802eb9:	ff 71 0c             	push   0xc(%ecx)
+  802ebc:	e8 a6 06 00 00       	call   803567 <nsipc_sendmsg>
+  802ec1:	83 c4 10             	add    $0x10,%esp
+  802ec4:	eb e7                	jmp    802ead <devsock_write+0x35>
+
+00802ec6 <devsock_read>:
+{
+  802ec6:	55                   	push   %ebp
+  802ec7:	89 e5                	mov    %esp,%ebp
+  802ec9:	53                   	push   %ebx
+  802eca:	83 ec 14             	sub    $0x14,%esp
+  802ecd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ed0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ed3:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802ed6:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802ed9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802edc:	8b 41 08             	mov    0x8(%ecx),%eax
+  802edf:	c1 f8 09             	sar    $0x9,%eax
+  802ee2:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802ee5:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802eeb:	77 13                	ja     802f00 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802eed:	50                   	push   %eax
+  802eee:	52                   	push   %edx
+  802eef:	53                   	push   %ebx
+  802ef0:	ff 71 0c             	push   0xc(%ecx)
+  802ef3:	e8 9c 05 00 00       	call   803494 <nsipc_recv>
+  802ef8:	83 c4 10             	add    $0x10,%esp
+}
+  802efb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802efe:	c9                   	leave
+  802eff:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802f00:	50                   	push   %eax
+  802f01:	6a 01                	push   $0x1
+  802f03:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f06:	50                   	push   %eax
+  802f07:	ff 71 0c             	push   0xc(%ecx)
+  802f0a:	e8 02 0a 00 00       	call   803911 <nsipc_recvmsg>
+  802f0f:	83 c4 10             	add    $0x10,%esp
+  802f12:	eb e7                	jmp    802efb <devsock_read+0x35>
+
+00802f14 <fd2sockid>:
+{
+  802f14:	55                   	push   %ebp
+  802f15:	89 e5                	mov    %esp,%ebp
+  802f17:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802f1a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f1d:	52                   	push   %edx
+  802f1e:	50                   	push   %eax
+  802f1f:	e8 0b ed ff ff       	call   801c2f <fd_lookup>
+  802f24:	83 c4 10             	add    $0x10,%esp
+  802f27:	85 c0                	test   %eax,%eax
+  802f29:	78 10                	js     802f3b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802f2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f2e:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  802f34:	39 08                	cmp    %ecx,(%eax)
+  802f36:	75 05                	jne    802f3d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802f38:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802f3b:	c9                   	leave
+  802f3c:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f3d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f42:	eb f7                	jmp    802f3b <fd2sockid+0x27>
+
+00802f44 <sock_flags>:
+{
+  802f44:	55                   	push   %ebp
+  802f45:	89 e5                	mov    %esp,%ebp
+  802f47:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802f4a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f4d:	52                   	push   %edx
+  802f4e:	50                   	push   %eax
+  802f4f:	e8 db ec ff ff       	call   801c2f <fd_lookup>
+  802f54:	83 c4 10             	add    $0x10,%esp
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	78 0e                	js     802f69 <sock_flags+0x25>
+  802f5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f5e:	8b 40 08             	mov    0x8(%eax),%eax
+  802f61:	c1 e8 09             	shr    $0x9,%eax
+  802f64:	83 e0 08             	and    $0x8,%eax
+}
+  802f67:	c9                   	leave
+  802f68:	c3                   	ret
+		return 0;
+  802f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6e:	eb f7                	jmp    802f67 <sock_flags+0x23>
+
+00802f70 <alloc_sockfd>:
+{
+  802f70:	55                   	push   %ebp
+  802f71:	89 e5                	mov    %esp,%ebp
+  802f73:	56                   	push   %esi
+  802f74:	53                   	push   %ebx
+  802f75:	83 ec 1c             	sub    $0x1c,%esp
+  802f78:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802f7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f7d:	50                   	push   %eax
+  802f7e:	e8 5c ec ff ff       	call   801bdf <fd_alloc>
+  802f83:	89 c3                	mov    %eax,%ebx
+  802f85:	83 c4 10             	add    $0x10,%esp
+  802f88:	85 c0                	test   %eax,%eax
+  802f8a:	78 43                	js     802fcf <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f8c:	83 ec 04             	sub    $0x4,%esp
+  802f8f:	68 07 04 00 00       	push   $0x407
+  802f94:	ff 75 f4             	push   -0xc(%ebp)
+  802f97:	6a 00                	push   $0x0
+  802f99:	e8 3b e0 ff ff       	call   800fd9 <sys_page_alloc>
+  802f9e:	89 c3                	mov    %eax,%ebx
+  802fa0:	83 c4 10             	add    $0x10,%esp
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	78 28                	js     802fcf <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802fa7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802faa:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  802fb0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802fb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fb5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802fbc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802fbf:	83 ec 0c             	sub    $0xc,%esp
+  802fc2:	50                   	push   %eax
+  802fc3:	e8 f0 eb ff ff       	call   801bb8 <fd2num>
+  802fc8:	89 c3                	mov    %eax,%ebx
+  802fca:	83 c4 10             	add    $0x10,%esp
+  802fcd:	eb 0c                	jmp    802fdb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802fcf:	83 ec 0c             	sub    $0xc,%esp
+  802fd2:	56                   	push   %esi
+  802fd3:	e8 4b 04 00 00       	call   803423 <nsipc_close>
+		return r;
+  802fd8:	83 c4 10             	add    $0x10,%esp
+}
+  802fdb:	89 d8                	mov    %ebx,%eax
+  802fdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fe0:	5b                   	pop    %ebx
+  802fe1:	5e                   	pop    %esi
+  802fe2:	5d                   	pop    %ebp
+  802fe3:	c3                   	ret
+
+00802fe4 <accept>:
+{
+  802fe4:	55                   	push   %ebp
+  802fe5:	89 e5                	mov    %esp,%ebp
+  802fe7:	56                   	push   %esi
+  802fe8:	53                   	push   %ebx
+  802fe9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802fec:	89 f0                	mov    %esi,%eax
+  802fee:	e8 21 ff ff ff       	call   802f14 <fd2sockid>
+  802ff3:	89 c3                	mov    %eax,%ebx
+  802ff5:	85 c0                	test   %eax,%eax
+  802ff7:	78 24                	js     80301d <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802ff9:	89 f0                	mov    %esi,%eax
+  802ffb:	e8 44 ff ff ff       	call   802f44 <sock_flags>
+  803000:	50                   	push   %eax
+  803001:	ff 75 10             	push   0x10(%ebp)
+  803004:	ff 75 0c             	push   0xc(%ebp)
+  803007:	53                   	push   %ebx
+  803008:	e8 6b 03 00 00       	call   803378 <nsipc_accept>
+  80300d:	89 c3                	mov    %eax,%ebx
+  80300f:	83 c4 10             	add    $0x10,%esp
+  803012:	85 c0                	test   %eax,%eax
+  803014:	78 07                	js     80301d <accept+0x39>
+	return alloc_sockfd(r);
+  803016:	e8 55 ff ff ff       	call   802f70 <alloc_sockfd>
+  80301b:	89 c3                	mov    %eax,%ebx
+}
+  80301d:	89 d8                	mov    %ebx,%eax
+  80301f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803022:	5b                   	pop    %ebx
+  803023:	5e                   	pop    %esi
+  803024:	5d                   	pop    %ebp
+  803025:	c3                   	ret
+
+00803026 <bind>:
+{
+  803026:	55                   	push   %ebp
+  803027:	89 e5                	mov    %esp,%ebp
+  803029:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80302c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80302f:	e8 e0 fe ff ff       	call   802f14 <fd2sockid>
+  803034:	85 c0                	test   %eax,%eax
+  803036:	78 12                	js     80304a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803038:	83 ec 04             	sub    $0x4,%esp
+  80303b:	ff 75 10             	push   0x10(%ebp)
+  80303e:	ff 75 0c             	push   0xc(%ebp)
+  803041:	50                   	push   %eax
+  803042:	e8 85 03 00 00       	call   8033cc <nsipc_bind>
+  803047:	83 c4 10             	add    $0x10,%esp
+}
+  80304a:	c9                   	leave
+  80304b:	c3                   	ret
+
+0080304c <shutdown>:
+{
+  80304c:	55                   	push   %ebp
+  80304d:	89 e5                	mov    %esp,%ebp
+  80304f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803052:	8b 45 08             	mov    0x8(%ebp),%eax
+  803055:	e8 ba fe ff ff       	call   802f14 <fd2sockid>
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	78 0f                	js     80306d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80305e:	83 ec 08             	sub    $0x8,%esp
+  803061:	ff 75 0c             	push   0xc(%ebp)
+  803064:	50                   	push   %eax
+  803065:	e8 97 03 00 00       	call   803401 <nsipc_shutdown>
+  80306a:	83 c4 10             	add    $0x10,%esp
+}
+  80306d:	c9                   	leave
+  80306e:	c3                   	ret
+
+0080306f <connect>:
+{
+  80306f:	55                   	push   %ebp
+  803070:	89 e5                	mov    %esp,%ebp
+  803072:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803075:	8b 45 08             	mov    0x8(%ebp),%eax
+  803078:	e8 97 fe ff ff       	call   802f14 <fd2sockid>
+  80307d:	85 c0                	test   %eax,%eax
+  80307f:	78 12                	js     803093 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803081:	83 ec 04             	sub    $0x4,%esp
+  803084:	ff 75 10             	push   0x10(%ebp)
+  803087:	ff 75 0c             	push   0xc(%ebp)
+  80308a:	50                   	push   %eax
+  80308b:	e8 ad 03 00 00       	call   80343d <nsipc_connect>
+  803090:	83 c4 10             	add    $0x10,%esp
+}
+  803093:	c9                   	leave
+  803094:	c3                   	ret
+
+00803095 <listen>:
+{
+  803095:	55                   	push   %ebp
+  803096:	89 e5                	mov    %esp,%ebp
+  803098:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80309b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80309e:	e8 71 fe ff ff       	call   802f14 <fd2sockid>
+  8030a3:	85 c0                	test   %eax,%eax
+  8030a5:	78 0f                	js     8030b6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8030a7:	83 ec 08             	sub    $0x8,%esp
+  8030aa:	ff 75 0c             	push   0xc(%ebp)
+  8030ad:	50                   	push   %eax
+  8030ae:	e8 bf 03 00 00       	call   803472 <nsipc_listen>
+  8030b3:	83 c4 10             	add    $0x10,%esp
+}
+  8030b6:	c9                   	leave
+  8030b7:	c3                   	ret
+
+008030b8 <sendmsg>:
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	57                   	push   %edi
+  8030bc:	56                   	push   %esi
+  8030bd:	53                   	push   %ebx
+  8030be:	83 ec 0c             	sub    $0xc,%esp
+  8030c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030c4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8030c7:	89 f0                	mov    %esi,%eax
+  8030c9:	e8 46 fe ff ff       	call   802f14 <fd2sockid>
+  8030ce:	89 c3                	mov    %eax,%ebx
+  8030d0:	85 c0                	test   %eax,%eax
+  8030d2:	78 1c                	js     8030f0 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8030d4:	89 f0                	mov    %esi,%eax
+  8030d6:	e8 69 fe ff ff       	call   802f44 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8030db:	0b 45 10             	or     0x10(%ebp),%eax
+  8030de:	50                   	push   %eax
+  8030df:	ff 77 0c             	push   0xc(%edi)
+  8030e2:	ff 77 08             	push   0x8(%edi)
+  8030e5:	53                   	push   %ebx
+  8030e6:	e8 7c 04 00 00       	call   803567 <nsipc_sendmsg>
+  8030eb:	89 c3                	mov    %eax,%ebx
+  8030ed:	83 c4 10             	add    $0x10,%esp
+}
+  8030f0:	89 d8                	mov    %ebx,%eax
+  8030f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f5:	5b                   	pop    %ebx
+  8030f6:	5e                   	pop    %esi
+  8030f7:	5f                   	pop    %edi
+  8030f8:	5d                   	pop    %ebp
+  8030f9:	c3                   	ret
+
+008030fa <recvmsg>:
+{
+  8030fa:	55                   	push   %ebp
+  8030fb:	89 e5                	mov    %esp,%ebp
+  8030fd:	57                   	push   %edi
+  8030fe:	56                   	push   %esi
+  8030ff:	53                   	push   %ebx
+  803100:	83 ec 0c             	sub    $0xc,%esp
+  803103:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803106:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803109:	89 f8                	mov    %edi,%eax
+  80310b:	e8 04 fe ff ff       	call   802f14 <fd2sockid>
+  803110:	89 c3                	mov    %eax,%ebx
+  803112:	85 c0                	test   %eax,%eax
+  803114:	78 2a                	js     803140 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  803116:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80311d:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  803124:	89 f8                	mov    %edi,%eax
+  803126:	e8 19 fe ff ff       	call   802f44 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80312b:	0b 45 10             	or     0x10(%ebp),%eax
+  80312e:	50                   	push   %eax
+  80312f:	ff 76 0c             	push   0xc(%esi)
+  803132:	ff 76 08             	push   0x8(%esi)
+  803135:	53                   	push   %ebx
+  803136:	e8 d6 07 00 00       	call   803911 <nsipc_recvmsg>
+  80313b:	89 c3                	mov    %eax,%ebx
+  80313d:	83 c4 10             	add    $0x10,%esp
+}
+  803140:	89 d8                	mov    %ebx,%eax
+  803142:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803145:	5b                   	pop    %ebx
+  803146:	5e                   	pop    %esi
+  803147:	5f                   	pop    %edi
+  803148:	5d                   	pop    %ebp
+  803149:	c3                   	ret
+
+0080314a <sendfile>:
+{
+  80314a:	55                   	push   %ebp
+  80314b:	89 e5                	mov    %esp,%ebp
+  80314d:	56                   	push   %esi
+  80314e:	53                   	push   %ebx
+  80314f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803152:	89 f0                	mov    %esi,%eax
+  803154:	e8 bb fd ff ff       	call   802f14 <fd2sockid>
+  803159:	89 c3                	mov    %eax,%ebx
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	78 1f                	js     80317e <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80315f:	89 f0                	mov    %esi,%eax
+  803161:	e8 de fd ff ff       	call   802f44 <sock_flags>
+  803166:	83 ec 0c             	sub    $0xc,%esp
+  803169:	50                   	push   %eax
+  80316a:	ff 75 14             	push   0x14(%ebp)
+  80316d:	ff 75 10             	push   0x10(%ebp)
+  803170:	ff 75 0c             	push   0xc(%ebp)
+  803173:	53                   	push   %ebx
+  803174:	e8 64 06 00 00       	call   8037dd <nsipc_sendfile>
+  803179:	89 c3                	mov    %eax,%ebx
+  80317b:	83 c4 20             	add    $0x20,%esp
+}
+  80317e:	89 d8                	mov    %ebx,%eax
+  803180:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803183:	5b                   	pop    %ebx
+  803184:	5e                   	pop    %esi
+  803185:	5d                   	pop    %ebp
+  803186:	c3                   	ret
+
+00803187 <evctl>:
+{
+  803187:	55                   	push   %ebp
+  803188:	89 e5                	mov    %esp,%ebp
+  80318a:	53                   	push   %ebx
+  80318b:	83 ec 04             	sub    $0x4,%esp
+  80318e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  803191:	89 d8                	mov    %ebx,%eax
+  803193:	e8 7c fd ff ff       	call   802f14 <fd2sockid>
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	78 10                	js     8031ac <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80319c:	83 ec 04             	sub    $0x4,%esp
+  80319f:	53                   	push   %ebx
+  8031a0:	ff 75 0c             	push   0xc(%ebp)
+  8031a3:	50                   	push   %eax
+  8031a4:	e8 d2 0b 00 00       	call   803d7b <nsipc_evctl>
+  8031a9:	83 c4 10             	add    $0x10,%esp
+}
+  8031ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031af:	c9                   	leave
+  8031b0:	c3                   	ret
+
+008031b1 <evwait>:
+{
+  8031b1:	55                   	push   %ebp
+  8031b2:	89 e5                	mov    %esp,%ebp
+  8031b4:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8031b7:	ff 75 10             	push   0x10(%ebp)
+  8031ba:	ff 75 0c             	push   0xc(%ebp)
+  8031bd:	ff 75 08             	push   0x8(%ebp)
+  8031c0:	e8 e0 0b 00 00       	call   803da5 <nsipc_evwait>
+}
+  8031c5:	c9                   	leave
+  8031c6:	c3                   	ret
+
+008031c7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8031c7:	55                   	push   %ebp
+  8031c8:	89 e5                	mov    %esp,%ebp
+  8031ca:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8031cd:	ff 75 10             	push   0x10(%ebp)
+  8031d0:	ff 75 0c             	push   0xc(%ebp)
+  8031d3:	ff 75 08             	push   0x8(%ebp)
+  8031d6:	e8 31 0c 00 00       	call   803e0c <nsipc_socket>
+  8031db:	83 c4 10             	add    $0x10,%esp
+  8031de:	85 c0                	test   %eax,%eax
+  8031e0:	78 05                	js     8031e7 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8031e2:	e8 89 fd ff ff       	call   802f70 <alloc_sockfd>
+}
+  8031e7:	c9                   	leave
+  8031e8:	c3                   	ret
+
+008031e9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8031e9:	55                   	push   %ebp
+  8031ea:	89 e5                	mov    %esp,%ebp
+  8031ec:	53                   	push   %ebx
+  8031ed:	83 ec 04             	sub    $0x4,%esp
+  8031f0:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8031f2:	83 3d 24 c0 80 00 00 	cmpl   $0x0,0x80c024
+  8031f9:	74 26                	je     803221 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8031fb:	6a 07                	push   $0x7
+  8031fd:	68 00 e0 80 00       	push   $0x80e000
+  803202:	53                   	push   %ebx
+  803203:	ff 35 24 c0 80 00    	push   0x80c024
+  803209:	e8 5b 1b 00 00       	call   804d69 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80320e:	83 c4 0c             	add    $0xc,%esp
+  803211:	6a 00                	push   $0x0
+  803213:	6a 00                	push   $0x0
+  803215:	6a 00                	push   $0x0
+  803217:	e8 bd 18 00 00       	call   804ad9 <ipc_recv>
+}
+  80321c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321f:	c9                   	leave
+  803220:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803221:	83 ec 0c             	sub    $0xc,%esp
+  803224:	6a 03                	push   $0x3
+  803226:	e8 a7 1b 00 00       	call   804dd2 <ipc_find_env>
+  80322b:	a3 24 c0 80 00       	mov    %eax,0x80c024
+  803230:	83 c4 10             	add    $0x10,%esp
+  803233:	eb c6                	jmp    8031fb <nsipc+0x12>
+
+00803235 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	56                   	push   %esi
+  803239:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80323a:	8b 35 30 c0 80 00    	mov    0x80c030,%esi
+		return 0;
+  803240:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  803245:	85 f6                	test   %esi,%esi
+  803247:	75 33                	jne    80327c <nsbulk_map+0x47>
+  803249:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80324e:	83 ec 04             	sub    $0x4,%esp
+  803251:	6a 07                	push   $0x7
+  803253:	53                   	push   %ebx
+  803254:	6a 00                	push   $0x0
+  803256:	e8 7e dd ff ff       	call   800fd9 <sys_page_alloc>
+  80325b:	83 c4 10             	add    $0x10,%esp
+  80325e:	85 c0                	test   %eax,%eax
+  803260:	78 1a                	js     80327c <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  803262:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803268:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80326e:	75 de                	jne    80324e <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  803270:	c7 05 30 c0 80 00 01 	movl   $0x1,0x80c030
+  803277:	00 00 00 
+	return 0;
+  80327a:	89 f0                	mov    %esi,%eax
+}
+  80327c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80327f:	5b                   	pop    %ebx
+  803280:	5e                   	pop    %esi
+  803281:	5d                   	pop    %ebp
+  803282:	c3                   	ret
+
+00803283 <nsbulk_own>:
+{
+  803283:	55                   	push   %ebp
+  803284:	89 e5                	mov    %esp,%ebp
+  803286:	57                   	push   %edi
+  803287:	56                   	push   %esi
+  803288:	53                   	push   %ebx
+  803289:	83 ec 0c             	sub    $0xc,%esp
+  80328c:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80328e:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  803291:	85 d2                	test   %edx,%edx
+  803293:	7f 0e                	jg     8032a3 <nsbulk_own+0x20>
+	return 0;
+  803295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80329a:	eb 47                	jmp    8032e3 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80329c:	83 c3 01             	add    $0x1,%ebx
+  80329f:	39 fb                	cmp    %edi,%ebx
+  8032a1:	7d 3b                	jge    8032de <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8032a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8032a8:	89 d9                	mov    %ebx,%ecx
+  8032aa:	d3 e6                	shl    %cl,%esi
+  8032ac:	89 f0                	mov    %esi,%eax
+  8032ae:	23 05 2c c0 80 00    	and    0x80c02c,%eax
+  8032b4:	74 e6                	je     80329c <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8032b6:	83 ec 04             	sub    $0x4,%esp
+  8032b9:	6a 07                	push   $0x7
+  8032bb:	89 d8                	mov    %ebx,%eax
+  8032bd:	c1 e0 0c             	shl    $0xc,%eax
+  8032c0:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8032c5:	50                   	push   %eax
+  8032c6:	6a 00                	push   $0x0
+  8032c8:	e8 0c dd ff ff       	call   800fd9 <sys_page_alloc>
+  8032cd:	83 c4 10             	add    $0x10,%esp
+  8032d0:	85 c0                	test   %eax,%eax
+  8032d2:	78 0f                	js     8032e3 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8032d4:	f7 d6                	not    %esi
+  8032d6:	21 35 2c c0 80 00    	and    %esi,0x80c02c
+  8032dc:	eb be                	jmp    80329c <nsbulk_own+0x19>
+	return 0;
+  8032de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032e6:	5b                   	pop    %ebx
+  8032e7:	5e                   	pop    %esi
+  8032e8:	5f                   	pop    %edi
+  8032e9:	5d                   	pop    %ebp
+  8032ea:	c3                   	ret
+
+008032eb <nsipc_bulk>:
+{
+  8032eb:	55                   	push   %ebp
+  8032ec:	89 e5                	mov    %esp,%ebp
+  8032ee:	57                   	push   %edi
+  8032ef:	56                   	push   %esi
+  8032f0:	53                   	push   %ebx
+  8032f1:	83 ec 1c             	sub    $0x1c,%esp
+  8032f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032f7:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8032f9:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8032ff:	c1 fb 0c             	sar    $0xc,%ebx
+  803302:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  803305:	83 3d 24 c0 80 00 00 	cmpl   $0x0,0x80c024
+  80330c:	74 56                	je     803364 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80330e:	85 ff                	test   %edi,%edi
+  803310:	7e 24                	jle    803336 <nsipc_bulk+0x4b>
+  803312:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  803318:	74 1c                	je     803336 <nsipc_bulk+0x4b>
+  80331a:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  803320:	c1 e3 0c             	shl    $0xc,%ebx
+  803323:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  803328:	0f b6 10             	movzbl (%eax),%edx
+  80332b:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80332d:	05 00 10 00 00       	add    $0x1000,%eax
+  803332:	39 d8                	cmp    %ebx,%eax
+  803334:	75 f2                	jne    803328 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  803336:	83 ec 0c             	sub    $0xc,%esp
+  803339:	56                   	push   %esi
+  80333a:	57                   	push   %edi
+  80333b:	68 00 00 00 e0       	push   $0xe0000000
+  803340:	ff 75 e4             	push   -0x1c(%ebp)
+  803343:	ff 35 24 c0 80 00    	push   0x80c024
+  803349:	e8 4f 1a 00 00       	call   804d9d <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80334e:	83 c4 1c             	add    $0x1c,%esp
+  803351:	6a 00                	push   $0x0
+  803353:	6a 00                	push   $0x0
+  803355:	6a 00                	push   $0x0
+  803357:	e8 7d 17 00 00       	call   804ad9 <ipc_recv>
+}
+  80335c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80335f:	5b                   	pop    %ebx
+  803360:	5e                   	pop    %esi
+  803361:	5f                   	pop    %edi
+  803362:	5d                   	pop    %ebp
+  803363:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803364:	83 ec 0c             	sub    $0xc,%esp
+  803367:	6a 03                	push   $0x3
+  803369:	e8 64 1a 00 00       	call   804dd2 <ipc_find_env>
+  80336e:	a3 24 c0 80 00       	mov    %eax,0x80c024
+  803373:	83 c4 10             	add    $0x10,%esp
+  803376:	eb 96                	jmp    80330e <nsipc_bulk+0x23>
+
+00803378 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  803378:	55                   	push   %ebp
+  803379:	89 e5                	mov    %esp,%ebp
+  80337b:	53                   	push   %ebx
+  80337c:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80337f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803382:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.accept.req_flags = flags;
+  803387:	8b 45 14             	mov    0x14(%ebp),%eax
+  80338a:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80338f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803394:	e8 50 fe ff ff       	call   8031e9 <nsipc>
+  803399:	89 c3                	mov    %eax,%ebx
+  80339b:	85 c0                	test   %eax,%eax
+  80339d:	79 07                	jns    8033a6 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80339f:	89 d8                	mov    %ebx,%eax
+  8033a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033a4:	c9                   	leave
+  8033a5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8033a6:	83 ec 04             	sub    $0x4,%esp
+  8033a9:	ff 35 10 e0 80 00    	push   0x80e010
+  8033af:	68 00 e0 80 00       	push   $0x80e000
+  8033b4:	ff 75 0c             	push   0xc(%ebp)
+  8033b7:	e8 99 d9 ff ff       	call   800d55 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8033bc:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  8033c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033c5:	89 10                	mov    %edx,(%eax)
+  8033c7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8033ca:	eb d3                	jmp    80339f <nsipc_accept+0x27>
+
+008033cc <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8033cc:	55                   	push   %ebp
+  8033cd:	89 e5                	mov    %esp,%ebp
+  8033cf:	53                   	push   %ebx
+  8033d0:	83 ec 08             	sub    $0x8,%esp
+  8033d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8033d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d9:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8033de:	53                   	push   %ebx
+  8033df:	ff 75 0c             	push   0xc(%ebp)
+  8033e2:	68 04 e0 80 00       	push   $0x80e004
+  8033e7:	e8 69 d9 ff ff       	call   800d55 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8033ec:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_BIND);
+  8033f2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8033f7:	e8 ed fd ff ff       	call   8031e9 <nsipc>
+}
+  8033fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033ff:	c9                   	leave
+  803400:	c3                   	ret
+
+00803401 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803401:	55                   	push   %ebp
+  803402:	89 e5                	mov    %esp,%ebp
+  803404:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803407:	8b 45 08             	mov    0x8(%ebp),%eax
+  80340a:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.shutdown.req_how = how;
+  80340f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803412:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_SHUTDOWN);
+  803417:	b8 03 00 00 00       	mov    $0x3,%eax
+  80341c:	e8 c8 fd ff ff       	call   8031e9 <nsipc>
+}
+  803421:	c9                   	leave
+  803422:	c3                   	ret
+
+00803423 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803423:	55                   	push   %ebp
+  803424:	89 e5                	mov    %esp,%ebp
+  803426:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80342c:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_CLOSE);
+  803431:	b8 04 00 00 00       	mov    $0x4,%eax
+  803436:	e8 ae fd ff ff       	call   8031e9 <nsipc>
+}
+  80343b:	c9                   	leave
+  80343c:	c3                   	ret
+
+0080343d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80343d:	55                   	push   %ebp
+  80343e:	89 e5                	mov    %esp,%ebp
+  803440:	53                   	push   %ebx
+  803441:	83 ec 08             	sub    $0x8,%esp
+  803444:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803447:	8b 45 08             	mov    0x8(%ebp),%eax
+  80344a:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80344f:	53                   	push   %ebx
+  803450:	ff 75 0c             	push   0xc(%ebp)
+  803453:	68 04 e0 80 00       	push   $0x80e004
+  803458:	e8 f8 d8 ff ff       	call   800d55 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80345d:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_CONNECT);
+  803463:	b8 05 00 00 00       	mov    $0x5,%eax
+  803468:	e8 7c fd ff ff       	call   8031e9 <nsipc>
+}
+  80346d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803470:	c9                   	leave
+  803471:	c3                   	ret
+
+00803472 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803472:	55                   	push   %ebp
+  803473:	89 e5                	mov    %esp,%ebp
+  803475:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803478:	8b 45 08             	mov    0x8(%ebp),%eax
+  80347b:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.listen.req_backlog = backlog;
+  803480:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803483:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_LISTEN);
+  803488:	b8 06 00 00 00       	mov    $0x6,%eax
+  80348d:	e8 57 fd ff ff       	call   8031e9 <nsipc>
+}
+  803492:	c9                   	leave
+  803493:	c3                   	ret
+
+00803494 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803494:	55                   	push   %ebp
+  803495:	89 e5                	mov    %esp,%ebp
+  803497:	56                   	push   %esi
+  803498:	53                   	push   %ebx
+  803499:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80349c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80349f:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.recv.req_len = len;
+  8034a4:	89 35 04 e0 80 00    	mov    %esi,0x80e004
+	nsipcbuf.recv.req_flags = flags;
+  8034aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034ad:	a3 08 e0 80 00       	mov    %eax,0x80e008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8034b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8034b7:	e8 2d fd ff ff       	call   8031e9 <nsipc>
+  8034bc:	89 c3                	mov    %eax,%ebx
+  8034be:	85 c0                	test   %eax,%eax
+  8034c0:	78 22                	js     8034e4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8034c2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8034c7:	39 c6                	cmp    %eax,%esi
+  8034c9:	0f 4e c6             	cmovle %esi,%eax
+  8034cc:	39 c3                	cmp    %eax,%ebx
+  8034ce:	7f 1d                	jg     8034ed <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8034d0:	83 ec 04             	sub    $0x4,%esp
+  8034d3:	53                   	push   %ebx
+  8034d4:	68 00 e0 80 00       	push   $0x80e000
+  8034d9:	ff 75 0c             	push   0xc(%ebp)
+  8034dc:	e8 74 d8 ff ff       	call   800d55 <memmove>
+  8034e1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8034e4:	89 d8                	mov    %ebx,%eax
+  8034e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034e9:	5b                   	pop    %ebx
+  8034ea:	5e                   	pop    %esi
+  8034eb:	5d                   	pop    %ebp
+  8034ec:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8034ed:	68 fb 56 80 00       	push   $0x8056fb
+  8034f2:	68 5a 56 80 00       	push   $0x80565a
+  8034f7:	68 b2 00 00 00       	push   $0xb2
+  8034fc:	68 10 57 80 00       	push   $0x805710
+  803501:	e8 cd ce ff ff       	call   8003d3 <_panic>
+
+00803506 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	53                   	push   %ebx
+  80350a:	83 ec 04             	sub    $0x4,%esp
+  80350d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803510:	8b 45 08             	mov    0x8(%ebp),%eax
+  803513:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	assert(size < 1600);
+  803518:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80351e:	7f 2e                	jg     80354e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803520:	83 ec 04             	sub    $0x4,%esp
+  803523:	53                   	push   %ebx
+  803524:	ff 75 0c             	push   0xc(%ebp)
+  803527:	68 0c e0 80 00       	push   $0x80e00c
+  80352c:	e8 24 d8 ff ff       	call   800d55 <memmove>
+	nsipcbuf.send.req_size = size;
+  803531:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+	nsipcbuf.send.req_flags = flags;
+  803537:	8b 45 14             	mov    0x14(%ebp),%eax
+  80353a:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SEND);
+  80353f:	b8 08 00 00 00       	mov    $0x8,%eax
+  803544:	e8 a0 fc ff ff       	call   8031e9 <nsipc>
+}
+  803549:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80354c:	c9                   	leave
+  80354d:	c3                   	ret
+	assert(size < 1600);
+  80354e:	68 1c 57 80 00       	push   $0x80571c
+  803553:	68 5a 56 80 00       	push   $0x80565a
+  803558:	68 bd 00 00 00       	push   $0xbd
+  80355d:	68 10 57 80 00       	push   $0x805710
+  803562:	e8 6c ce ff ff       	call   8003d3 <_panic>
+
+00803567 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803567:	55                   	push   %ebp
+  803568:	89 e5                	mov    %esp,%ebp
+  80356a:	57                   	push   %edi
+  80356b:	56                   	push   %esi
+  80356c:	53                   	push   %ebx
+  80356d:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  803570:	e8 c0 fc ff ff       	call   803235 <nsbulk_map>
+  803575:	85 c0                	test   %eax,%eax
+  803577:	78 55                	js     8035ce <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  803579:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  803580:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  803587:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80358e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803591:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803594:	0f 8d 24 02 00 00    	jge    8037be <nsipc_sendmsg+0x257>
+  80359a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80359d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8035a0:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8035a3:	89 d8                	mov    %ebx,%eax
+  8035a5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8035aa:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8035ac:	83 ec 0c             	sub    $0xc,%esp
+  8035af:	68 20 bd 80 00       	push   $0x80bd20
+  8035b4:	e8 bc 0f 00 00       	call   804575 <pgbatch_init>
+  8035b9:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8035bc:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8035be:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8035c1:	e9 82 00 00 00       	jmp    803648 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8035c6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8035c9:	85 db                	test   %ebx,%ebx
+  8035cb:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8035ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035d1:	5b                   	pop    %ebx
+  8035d2:	5e                   	pop    %esi
+  8035d3:	5f                   	pop    %edi
+  8035d4:	5d                   	pop    %ebp
+  8035d5:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8035d6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8035db:	29 c8                	sub    %ecx,%eax
+  8035dd:	39 d0                	cmp    %edx,%eax
+  8035df:	0f 46 d0             	cmovbe %eax,%edx
+  8035e2:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8035e4:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8035ea:	85 ff                	test   %edi,%edi
+  8035ec:	0f 49 c7             	cmovns %edi,%eax
+  8035ef:	c1 f8 0c             	sar    $0xc,%eax
+  8035f2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035f7:	e8 87 fc ff ff       	call   803283 <nsbulk_own>
+  8035fc:	85 c0                	test   %eax,%eax
+  8035fe:	0f 88 17 01 00 00    	js     80371b <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  803604:	83 ec 04             	sub    $0x4,%esp
+  803607:	56                   	push   %esi
+  803608:	ff 75 e0             	push   -0x20(%ebp)
+  80360b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80360e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803613:	50                   	push   %eax
+  803614:	e8 3c d7 ff ff       	call   800d55 <memmove>
+  803619:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80361c:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80361f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803622:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803625:	0f 84 fd 00 00 00    	je     803728 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80362b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80362e:	01 f7                	add    %esi,%edi
+  803630:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803633:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803636:	0f 8d 01 01 00 00    	jge    80373d <nsipc_sendmsg+0x1d6>
+  80363c:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  803642:	0f 8f f0 00 00 00    	jg     803738 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  803648:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80364b:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80364e:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  803651:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803654:	89 c2                	mov    %eax,%edx
+  803656:	03 13                	add    (%ebx),%edx
+  803658:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80365b:	8b 73 04             	mov    0x4(%ebx),%esi
+  80365e:	29 c6                	sub    %eax,%esi
+  803660:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  803665:	29 f9                	sub    %edi,%ecx
+  803667:	39 ce                	cmp    %ecx,%esi
+  803669:	89 ca                	mov    %ecx,%edx
+  80366b:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  80366e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803671:	89 f9                	mov    %edi,%ecx
+  803673:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  803679:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80367c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803681:	09 c8                	or     %ecx,%eax
+  803683:	0f 85 4d ff ff ff    	jne    8035d6 <nsipc_sendmsg+0x6f>
+  803689:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80368f:	0f 86 41 ff ff ff    	jbe    8035d6 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803695:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80369b:	85 ff                	test   %edi,%edi
+  80369d:	0f 49 c7             	cmovns %edi,%eax
+  8036a0:	c1 f8 0c             	sar    $0xc,%eax
+  8036a3:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8036a5:	89 d1                	mov    %edx,%ecx
+  8036a7:	c1 e9 0c             	shr    $0xc,%ecx
+  8036aa:	01 c8                	add    %ecx,%eax
+  8036ac:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8036af:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8036b2:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8036b4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8036b7:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8036bc:	29 c8                	sub    %ecx,%eax
+  8036be:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8036c1:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8036c4:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8036c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036cb:	89 f9                	mov    %edi,%ecx
+  8036cd:	d3 e0                	shl    %cl,%eax
+  8036cf:	09 05 2c c0 80 00    	or     %eax,0x80c02c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8036d5:	83 ec 08             	sub    $0x8,%esp
+  8036d8:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8036da:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8036dd:	50                   	push   %eax
+  8036de:	6a 00                	push   $0x0
+  8036e0:	56                   	push   %esi
+  8036e1:	6a 00                	push   $0x0
+  8036e3:	68 20 bd 80 00       	push   $0x80bd20
+  8036e8:	e8 46 0f 00 00       	call   804633 <pgbatch_map>
+  8036ed:	83 c4 20             	add    $0x20,%esp
+  8036f0:	85 c0                	test   %eax,%eax
+  8036f2:	0f 88 ce fe ff ff    	js     8035c6 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8036f8:	83 c7 01             	add    $0x1,%edi
+  8036fb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803701:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803704:	39 c7                	cmp    %eax,%edi
+  803706:	75 be                	jne    8036c6 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  803708:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80370b:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80370e:	89 d6                	mov    %edx,%esi
+  803710:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803716:	e9 01 ff ff ff       	jmp    80361c <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80371b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80371e:	85 db                	test   %ebx,%ebx
+  803720:	0f 45 c3             	cmovne %ebx,%eax
+  803723:	e9 a6 fe ff ff       	jmp    8035ce <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  803728:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80372c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803733:	e9 f3 fe ff ff       	jmp    80362b <nsipc_sendmsg+0xc4>
+  803738:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80373b:	eb 03                	jmp    803740 <nsipc_sendmsg+0x1d9>
+  80373d:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  803740:	83 ec 0c             	sub    $0xc,%esp
+  803743:	68 20 bd 80 00       	push   $0x80bd20
+  803748:	e8 36 0e 00 00       	call   804583 <pgbatch_flush>
+  80374d:	83 c4 10             	add    $0x10,%esp
+  803750:	85 c0                	test   %eax,%eax
+  803752:	78 50                	js     8037a4 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  803754:	8b 45 08             	mov    0x8(%ebp),%eax
+  803757:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80375c:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  803762:	89 fb                	mov    %edi,%ebx
+  803764:	29 f3                	sub    %esi,%ebx
+  803766:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80376c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80376f:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  803774:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803779:	89 fa                	mov    %edi,%edx
+  80377b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803780:	e8 66 fb ff ff       	call   8032eb <nsipc_bulk>
+  803785:	85 c0                	test   %eax,%eax
+  803787:	78 28                	js     8037b1 <nsipc_sendmsg+0x24a>
+		sent += r;
+  803789:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80378c:	39 c3                	cmp    %eax,%ebx
+  80378e:	75 0c                	jne    80379c <nsipc_sendmsg+0x235>
+  803790:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803793:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803796:	0f 8f f2 fd ff ff    	jg     80358e <nsipc_sendmsg+0x27>
+		sent += r;
+  80379c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80379f:	e9 2a fe ff ff       	jmp    8035ce <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8037a4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8037a7:	85 db                	test   %ebx,%ebx
+  8037a9:	0f 45 c3             	cmovne %ebx,%eax
+  8037ac:	e9 1d fe ff ff       	jmp    8035ce <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8037b1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8037b4:	85 db                	test   %ebx,%ebx
+  8037b6:	0f 45 c3             	cmovne %ebx,%eax
+  8037b9:	e9 10 fe ff ff       	jmp    8035ce <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8037be:	83 ec 0c             	sub    $0xc,%esp
+  8037c1:	68 20 bd 80 00       	push   $0x80bd20
+  8037c6:	e8 aa 0d 00 00       	call   804575 <pgbatch_init>
+  8037cb:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8037ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8037d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d8:	e9 63 ff ff ff       	jmp    803740 <nsipc_sendmsg+0x1d9>
+
+008037dd <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8037dd:	55                   	push   %ebp
+  8037de:	89 e5                	mov    %esp,%ebp
+  8037e0:	57                   	push   %edi
+  8037e1:	56                   	push   %esi
+  8037e2:	53                   	push   %ebx
+  8037e3:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8037e6:	83 3d 28 c0 80 00 00 	cmpl   $0x0,0x80c028
+  8037ed:	0f 84 c8 00 00 00    	je     8038bb <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8037f3:	83 3d 24 c0 80 00 00 	cmpl   $0x0,0x80c024
+  8037fa:	0f 84 e4 00 00 00    	je     8038e4 <nsipc_sendfile+0x107>
+{
+  803800:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  803805:	89 fb                	mov    %edi,%ebx
+  803807:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80380a:	0f 83 f0 00 00 00    	jae    803900 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803810:	89 fa                	mov    %edi,%edx
+  803812:	03 55 10             	add    0x10(%ebp),%edx
+  803815:	89 d0                	mov    %edx,%eax
+  803817:	c1 f8 1f             	sar    $0x1f,%eax
+  80381a:	c1 e8 14             	shr    $0x14,%eax
+  80381d:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803820:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803826:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803828:	6a 10                	push   $0x10
+  80382a:	68 00 20 01 e0       	push   $0xe0012000
+  80382f:	52                   	push   %edx
+  803830:	ff 75 0c             	push   0xc(%ebp)
+  803833:	e8 fe eb ff ff       	call   802436 <fmap>
+  803838:	83 c4 10             	add    $0x10,%esp
+  80383b:	85 c0                	test   %eax,%eax
+  80383d:	0f 8e b8 00 00 00    	jle    8038fb <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  803843:	39 c6                	cmp    %eax,%esi
+  803845:	0f 8d b5 00 00 00    	jge    803900 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80384b:	29 f0                	sub    %esi,%eax
+  80384d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803850:	29 da                	sub    %ebx,%edx
+  803852:	39 d0                	cmp    %edx,%eax
+  803854:	89 d3                	mov    %edx,%ebx
+  803856:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  803859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80385c:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803861:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  803867:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  80386d:	8b 45 18             	mov    0x18(%ebp),%eax
+  803870:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803875:	83 ec 0c             	sub    $0xc,%esp
+  803878:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80387a:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803881:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803884:	83 c0 01             	add    $0x1,%eax
+  803887:	50                   	push   %eax
+  803888:	68 00 10 01 e0       	push   $0xe0011000
+  80388d:	6a 11                	push   $0x11
+  80388f:	ff 35 24 c0 80 00    	push   0x80c024
+  803895:	e8 03 15 00 00       	call   804d9d <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80389a:	83 c4 1c             	add    $0x1c,%esp
+  80389d:	6a 00                	push   $0x0
+  80389f:	6a 00                	push   $0x0
+  8038a1:	6a 00                	push   $0x0
+  8038a3:	e8 31 12 00 00       	call   804ad9 <ipc_recv>
+  8038a8:	83 c4 10             	add    $0x10,%esp
+  8038ab:	85 c0                	test   %eax,%eax
+  8038ad:	78 5b                	js     80390a <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8038af:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8038b1:	39 c3                	cmp    %eax,%ebx
+  8038b3:	0f 8e 4c ff ff ff    	jle    803805 <nsipc_sendfile+0x28>
+  8038b9:	eb 45                	jmp    803900 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8038bb:	83 ec 04             	sub    $0x4,%esp
+  8038be:	6a 07                	push   $0x7
+  8038c0:	68 00 10 01 e0       	push   $0xe0011000
+  8038c5:	6a 00                	push   $0x0
+  8038c7:	e8 0d d7 ff ff       	call   800fd9 <sys_page_alloc>
+  8038cc:	89 c7                	mov    %eax,%edi
+  8038ce:	83 c4 10             	add    $0x10,%esp
+  8038d1:	85 c0                	test   %eax,%eax
+  8038d3:	78 2b                	js     803900 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8038d5:	c7 05 28 c0 80 00 01 	movl   $0x1,0x80c028
+  8038dc:	00 00 00 
+  8038df:	e9 0f ff ff ff       	jmp    8037f3 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8038e4:	83 ec 0c             	sub    $0xc,%esp
+  8038e7:	6a 03                	push   $0x3
+  8038e9:	e8 e4 14 00 00       	call   804dd2 <ipc_find_env>
+  8038ee:	a3 24 c0 80 00       	mov    %eax,0x80c024
+  8038f3:	83 c4 10             	add    $0x10,%esp
+  8038f6:	e9 05 ff ff ff       	jmp    803800 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8038fb:	85 ff                	test   %edi,%edi
+  8038fd:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803900:	89 f8                	mov    %edi,%eax
+  803902:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803905:	5b                   	pop    %ebx
+  803906:	5e                   	pop    %esi
+  803907:	5f                   	pop    %edi
+  803908:	5d                   	pop    %ebp
+  803909:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80390a:	85 ff                	test   %edi,%edi
+  80390c:	0f 44 f8             	cmove  %eax,%edi
+  80390f:	eb ef                	jmp    803900 <nsipc_sendfile+0x123>
+
+00803911 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803911:	55                   	push   %ebp
+  803912:	89 e5                	mov    %esp,%ebp
+  803914:	57                   	push   %edi
+  803915:	56                   	push   %esi
+  803916:	53                   	push   %ebx
+  803917:	83 ec 1c             	sub    $0x1c,%esp
+  80391a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80391d:	e8 13 f9 ff ff       	call   803235 <nsbulk_map>
+  803922:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803925:	85 c0                	test   %eax,%eax
+  803927:	0f 88 ba 00 00 00    	js     8039e7 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80392d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803931:	0f 8e bb 00 00 00    	jle    8039f2 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803937:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80393c:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  803941:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803946:	89 f8                	mov    %edi,%eax
+  803948:	29 f0                	sub    %esi,%eax
+  80394a:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80394e:	39 c8                	cmp    %ecx,%eax
+  803950:	0f 47 c1             	cmova  %ecx,%eax
+  803953:	01 f0                	add    %esi,%eax
+  803955:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803957:	83 c2 01             	add    $0x1,%edx
+  80395a:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80395d:	7e 07                	jle    803966 <nsipc_recvmsg+0x55>
+  80395f:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803964:	7e e0                	jle    803946 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803966:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80396c:	c1 fa 0c             	sar    $0xc,%edx
+  80396f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803974:	e8 0a f9 ff ff       	call   803283 <nsbulk_own>
+  803979:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80397c:	85 c0                	test   %eax,%eax
+  80397e:	78 67                	js     8039e7 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803980:	8b 45 08             	mov    0x8(%ebp),%eax
+  803983:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803988:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80398e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803991:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803996:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80399b:	89 f2                	mov    %esi,%edx
+  80399d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8039a2:	e8 44 f9 ff ff       	call   8032eb <nsipc_bulk>
+  8039a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8039aa:	85 c0                	test   %eax,%eax
+  8039ac:	78 39                	js     8039e7 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8039ae:	39 f0                	cmp    %esi,%eax
+  8039b0:	7f 4a                	jg     8039fc <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8039b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039b7:	85 c0                	test   %eax,%eax
+  8039b9:	7e 2c                	jle    8039e7 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8039bb:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8039be:	29 fe                	sub    %edi,%esi
+  8039c0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8039c3:	39 c6                	cmp    %eax,%esi
+  8039c5:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8039c8:	83 ec 04             	sub    $0x4,%esp
+  8039cb:	56                   	push   %esi
+  8039cc:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8039d2:	50                   	push   %eax
+  8039d3:	ff 33                	push   (%ebx)
+  8039d5:	e8 7b d3 ff ff       	call   800d55 <memmove>
+		n += m;
+  8039da:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8039dc:	83 c3 08             	add    $0x8,%ebx
+  8039df:	83 c4 10             	add    $0x10,%esp
+  8039e2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8039e5:	7f d4                	jg     8039bb <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8039e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039ed:	5b                   	pop    %ebx
+  8039ee:	5e                   	pop    %esi
+  8039ef:	5f                   	pop    %edi
+  8039f0:	5d                   	pop    %ebp
+  8039f1:	c3                   	ret
+	int r, i, n, len = 0;
+  8039f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8039f7:	e9 6a ff ff ff       	jmp    803966 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8039fc:	68 07 57 80 00       	push   $0x805707
+  803a01:	68 5a 56 80 00       	push   $0x80565a
+  803a06:	68 3b 01 00 00       	push   $0x13b
+  803a0b:	68 10 57 80 00       	push   $0x805710
+  803a10:	e8 be c9 ff ff       	call   8003d3 <_panic>
+
+00803a15 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803a15:	55                   	push   %ebp
+  803a16:	89 e5                	mov    %esp,%ebp
+  803a18:	57                   	push   %edi
+  803a19:	56                   	push   %esi
+  803a1a:	53                   	push   %ebx
+  803a1b:	83 ec 0c             	sub    $0xc,%esp
+  803a1e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803a21:	8b 75 10             	mov    0x10(%ebp),%esi
+  803a24:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a2a:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.select.req_readset = *readset;
+  803a2f:	8b 07                	mov    (%edi),%eax
+  803a31:	a3 04 e0 80 00       	mov    %eax,0x80e004
+  803a36:	8b 47 04             	mov    0x4(%edi),%eax
+  803a39:	a3 08 e0 80 00       	mov    %eax,0x80e008
+  803a3e:	8b 47 08             	mov    0x8(%edi),%eax
+  803a41:	a3 0c e0 80 00       	mov    %eax,0x80e00c
+  803a46:	8b 47 0c             	mov    0xc(%edi),%eax
+  803a49:	a3 10 e0 80 00       	mov    %eax,0x80e010
+  803a4e:	8b 47 10             	mov    0x10(%edi),%eax
+  803a51:	a3 14 e0 80 00       	mov    %eax,0x80e014
+  803a56:	8b 47 14             	mov    0x14(%edi),%eax
+  803a59:	a3 18 e0 80 00       	mov    %eax,0x80e018
+  803a5e:	8b 47 18             	mov    0x18(%edi),%eax
+  803a61:	a3 1c e0 80 00       	mov    %eax,0x80e01c
+  803a66:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803a69:	a3 20 e0 80 00       	mov    %eax,0x80e020
+  803a6e:	8b 47 20             	mov    0x20(%edi),%eax
+  803a71:	a3 24 e0 80 00       	mov    %eax,0x80e024
+  803a76:	8b 47 24             	mov    0x24(%edi),%eax
+  803a79:	a3 28 e0 80 00       	mov    %eax,0x80e028
+  803a7e:	8b 47 28             	mov    0x28(%edi),%eax
+  803a81:	a3 2c e0 80 00       	mov    %eax,0x80e02c
+  803a86:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803a89:	a3 30 e0 80 00       	mov    %eax,0x80e030
+  803a8e:	8b 47 30             	mov    0x30(%edi),%eax
+  803a91:	a3 34 e0 80 00       	mov    %eax,0x80e034
+  803a96:	8b 47 34             	mov    0x34(%edi),%eax
+  803a99:	a3 38 e0 80 00       	mov    %eax,0x80e038
+  803a9e:	8b 47 38             	mov    0x38(%edi),%eax
+  803aa1:	a3 3c e0 80 00       	mov    %eax,0x80e03c
+  803aa6:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803aa9:	a3 40 e0 80 00       	mov    %eax,0x80e040
+	nsipcbuf.select.req_writeset = *writeset;
+  803aae:	8b 06                	mov    (%esi),%eax
+  803ab0:	a3 44 e0 80 00       	mov    %eax,0x80e044
+  803ab5:	8b 46 04             	mov    0x4(%esi),%eax
+  803ab8:	a3 48 e0 80 00       	mov    %eax,0x80e048
+  803abd:	8b 46 08             	mov    0x8(%esi),%eax
+  803ac0:	a3 4c e0 80 00       	mov    %eax,0x80e04c
+  803ac5:	8b 46 0c             	mov    0xc(%esi),%eax
+  803ac8:	a3 50 e0 80 00       	mov    %eax,0x80e050
+  803acd:	8b 46 10             	mov    0x10(%esi),%eax
+  803ad0:	a3 54 e0 80 00       	mov    %eax,0x80e054
+  803ad5:	8b 46 14             	mov    0x14(%esi),%eax
+  803ad8:	a3 58 e0 80 00       	mov    %eax,0x80e058
+  803add:	8b 46 18             	mov    0x18(%esi),%eax
+  803ae0:	a3 5c e0 80 00       	mov    %eax,0x80e05c
+  803ae5:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803ae8:	a3 60 e0 80 00       	mov    %eax,0x80e060
+  803aed:	8b 46 20             	mov    0x20(%esi),%eax
+  803af0:	a3 64 e0 80 00       	mov    %eax,0x80e064
+  803af5:	8b 46 24             	mov    0x24(%esi),%eax
+  803af8:	a3 68 e0 80 00       	mov    %eax,0x80e068
+  803afd:	8b 46 28             	mov    0x28(%esi),%eax
+  803b00:	a3 6c e0 80 00       	mov    %eax,0x80e06c
+  803b05:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803b08:	a3 70 e0 80 00       	mov    %eax,0x80e070
+  803b0d:	8b 46 30             	mov    0x30(%esi),%eax
+  803b10:	a3 74 e0 80 00       	mov    %eax,0x80e074
+  803b15:	8b 46 34             	mov    0x34(%esi),%eax
+  803b18:	a3 78 e0 80 00       	mov    %eax,0x80e078
+  803b1d:	8b 46 38             	mov    0x38(%esi),%eax
+  803b20:	a3 7c e0 80 00       	mov    %eax,0x80e07c
+  803b25:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803b28:	a3 80 e0 80 00       	mov    %eax,0x80e080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803b2d:	8b 03                	mov    (%ebx),%eax
+  803b2f:	a3 84 e0 80 00       	mov    %eax,0x80e084
+  803b34:	8b 43 04             	mov    0x4(%ebx),%eax
+  803b37:	a3 88 e0 80 00       	mov    %eax,0x80e088
+  803b3c:	8b 43 08             	mov    0x8(%ebx),%eax
+  803b3f:	a3 8c e0 80 00       	mov    %eax,0x80e08c
+  803b44:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803b47:	a3 90 e0 80 00       	mov    %eax,0x80e090
+  803b4c:	8b 43 10             	mov    0x10(%ebx),%eax
+  803b4f:	a3 94 e0 80 00       	mov    %eax,0x80e094
+  803b54:	8b 43 14             	mov    0x14(%ebx),%eax
+  803b57:	a3 98 e0 80 00       	mov    %eax,0x80e098
+  803b5c:	8b 43 18             	mov    0x18(%ebx),%eax
+  803b5f:	a3 9c e0 80 00       	mov    %eax,0x80e09c
+  803b64:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803b67:	a3 a0 e0 80 00       	mov    %eax,0x80e0a0
+  803b6c:	8b 43 20             	mov    0x20(%ebx),%eax
+  803b6f:	a3 a4 e0 80 00       	mov    %eax,0x80e0a4
+  803b74:	8b 43 24             	mov    0x24(%ebx),%eax
+  803b77:	a3 a8 e0 80 00       	mov    %eax,0x80e0a8
+  803b7c:	8b 43 28             	mov    0x28(%ebx),%eax
+  803b7f:	a3 ac e0 80 00       	mov    %eax,0x80e0ac
+  803b84:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803b87:	a3 b0 e0 80 00       	mov    %eax,0x80e0b0
+  803b8c:	8b 43 30             	mov    0x30(%ebx),%eax
+  803b8f:	a3 b4 e0 80 00       	mov    %eax,0x80e0b4
+  803b94:	8b 43 34             	mov    0x34(%ebx),%eax
+  803b97:	a3 b8 e0 80 00       	mov    %eax,0x80e0b8
+  803b9c:	8b 43 38             	mov    0x38(%ebx),%eax
+  803b9f:	a3 bc e0 80 00       	mov    %eax,0x80e0bc
+  803ba4:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803ba7:	a3 c0 e0 80 00       	mov    %eax,0x80e0c0
+	nsipcbuf.select.req_timeout = msec;
+  803bac:	8b 45 18             	mov    0x18(%ebp),%eax
+  803baf:	a3 c4 e0 80 00       	mov    %eax,0x80e0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803bb4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803bb9:	e8 2b f6 ff ff       	call   8031e9 <nsipc>
+  803bbe:	85 c0                	test   %eax,%eax
+  803bc0:	0f 88 ad 01 00 00    	js     803d73 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803bc6:	8b 15 04 e0 80 00    	mov    0x80e004,%edx
+  803bcc:	89 17                	mov    %edx,(%edi)
+  803bce:	8b 15 08 e0 80 00    	mov    0x80e008,%edx
+  803bd4:	89 57 04             	mov    %edx,0x4(%edi)
+  803bd7:	8b 15 0c e0 80 00    	mov    0x80e00c,%edx
+  803bdd:	89 57 08             	mov    %edx,0x8(%edi)
+  803be0:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  803be6:	89 57 0c             	mov    %edx,0xc(%edi)
+  803be9:	8b 15 14 e0 80 00    	mov    0x80e014,%edx
+  803bef:	89 57 10             	mov    %edx,0x10(%edi)
+  803bf2:	8b 15 18 e0 80 00    	mov    0x80e018,%edx
+  803bf8:	89 57 14             	mov    %edx,0x14(%edi)
+  803bfb:	8b 15 1c e0 80 00    	mov    0x80e01c,%edx
+  803c01:	89 57 18             	mov    %edx,0x18(%edi)
+  803c04:	8b 15 20 e0 80 00    	mov    0x80e020,%edx
+  803c0a:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803c0d:	8b 15 24 e0 80 00    	mov    0x80e024,%edx
+  803c13:	89 57 20             	mov    %edx,0x20(%edi)
+  803c16:	8b 15 28 e0 80 00    	mov    0x80e028,%edx
+  803c1c:	89 57 24             	mov    %edx,0x24(%edi)
+  803c1f:	8b 15 2c e0 80 00    	mov    0x80e02c,%edx
+  803c25:	89 57 28             	mov    %edx,0x28(%edi)
+  803c28:	8b 15 30 e0 80 00    	mov    0x80e030,%edx
+  803c2e:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803c31:	8b 15 34 e0 80 00    	mov    0x80e034,%edx
+  803c37:	89 57 30             	mov    %edx,0x30(%edi)
+  803c3a:	8b 15 38 e0 80 00    	mov    0x80e038,%edx
+  803c40:	89 57 34             	mov    %edx,0x34(%edi)
+  803c43:	8b 15 3c e0 80 00    	mov    0x80e03c,%edx
+  803c49:	89 57 38             	mov    %edx,0x38(%edi)
+  803c4c:	8b 15 40 e0 80 00    	mov    0x80e040,%edx
+  803c52:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803c55:	8b 15 44 e0 80 00    	mov    0x80e044,%edx
+  803c5b:	89 16                	mov    %edx,(%esi)
+  803c5d:	8b 15 48 e0 80 00    	mov    0x80e048,%edx
+  803c63:	89 56 04             	mov    %edx,0x4(%esi)
+  803c66:	8b 15 4c e0 80 00    	mov    0x80e04c,%edx
+  803c6c:	89 56 08             	mov    %edx,0x8(%esi)
+  803c6f:	8b 15 50 e0 80 00    	mov    0x80e050,%edx
+  803c75:	89 56 0c             	mov    %edx,0xc(%esi)
+  803c78:	8b 15 54 e0 80 00    	mov    0x80e054,%edx
+  803c7e:	89 56 10             	mov    %edx,0x10(%esi)
+  803c81:	8b 15 58 e0 80 00    	mov    0x80e058,%edx
+  803c87:	89 56 14             	mov    %edx,0x14(%esi)
+  803c8a:	8b 15 5c e0 80 00    	mov    0x80e05c,%edx
+  803c90:	89 56 18             	mov    %edx,0x18(%esi)
+  803c93:	8b 15 60 e0 80 00    	mov    0x80e060,%edx
+  803c99:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803c9c:	8b 15 64 e0 80 00    	mov    0x80e064,%edx
+  803ca2:	89 56 20             	mov    %edx,0x20(%esi)
+  803ca5:	8b 15 68 e0 80 00    	mov    0x80e068,%edx
+  803cab:	89 56 24             	mov    %edx,0x24(%esi)
+  803cae:	8b 15 6c e0 80 00    	mov    0x80e06c,%edx
+  803cb4:	89 56 28             	mov    %edx,0x28(%esi)
+  803cb7:	8b 15 70 e0 80 00    	mov    0x80e070,%edx
+  803cbd:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803cc0:	8b 15 74 e0 80 00    	mov    0x80e074,%edx
+  803cc6:	89 56 30             	mov    %edx,0x30(%esi)
+  803cc9:	8b 15 78 e0 80 00    	mov    0x80e078,%edx
+  803ccf:	89 56 34             	mov    %edx,0x34(%esi)
+  803cd2:	8b 15 7c e0 80 00    	mov    0x80e07c,%edx
+  803cd8:	89 56 38             	mov    %edx,0x38(%esi)
+  803cdb:	8b 15 80 e0 80 00    	mov    0x80e080,%edx
+  803ce1:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803ce4:	8b 15 84 e0 80 00    	mov    0x80e084,%edx
+  803cea:	89 13                	mov    %edx,(%ebx)
+  803cec:	8b 15 88 e0 80 00    	mov    0x80e088,%edx
+  803cf2:	89 53 04             	mov    %edx,0x4(%ebx)
+  803cf5:	8b 15 8c e0 80 00    	mov    0x80e08c,%edx
+  803cfb:	89 53 08             	mov    %edx,0x8(%ebx)
+  803cfe:	8b 15 90 e0 80 00    	mov    0x80e090,%edx
+  803d04:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803d07:	8b 15 94 e0 80 00    	mov    0x80e094,%edx
+  803d0d:	89 53 10             	mov    %edx,0x10(%ebx)
+  803d10:	8b 15 98 e0 80 00    	mov    0x80e098,%edx
+  803d16:	89 53 14             	mov    %edx,0x14(%ebx)
+  803d19:	8b 15 9c e0 80 00    	mov    0x80e09c,%edx
+  803d1f:	89 53 18             	mov    %edx,0x18(%ebx)
+  803d22:	8b 15 a0 e0 80 00    	mov    0x80e0a0,%edx
+  803d28:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803d2b:	8b 15 a4 e0 80 00    	mov    0x80e0a4,%edx
+  803d31:	89 53 20             	mov    %edx,0x20(%ebx)
+  803d34:	8b 15 a8 e0 80 00    	mov    0x80e0a8,%edx
+  803d3a:	89 53 24             	mov    %edx,0x24(%ebx)
+  803d3d:	8b 15 ac e0 80 00    	mov    0x80e0ac,%edx
+  803d43:	89 53 28             	mov    %edx,0x28(%ebx)
+  803d46:	8b 15 b0 e0 80 00    	mov    0x80e0b0,%edx
+  803d4c:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803d4f:	8b 15 b4 e0 80 00    	mov    0x80e0b4,%edx
+  803d55:	89 53 30             	mov    %edx,0x30(%ebx)
+  803d58:	8b 15 b8 e0 80 00    	mov    0x80e0b8,%edx
+  803d5e:	89 53 34             	mov    %edx,0x34(%ebx)
+  803d61:	8b 15 bc e0 80 00    	mov    0x80e0bc,%edx
+  803d67:	89 53 38             	mov    %edx,0x38(%ebx)
+  803d6a:	8b 15 c0 e0 80 00    	mov    0x80e0c0,%edx
+  803d70:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803d73:	83 c4 0c             	add    $0xc,%esp
+  803d76:	5b                   	pop    %ebx
+  803d77:	5e                   	pop    %esi
+  803d78:	5f                   	pop    %edi
+  803d79:	5d                   	pop    %ebp
+  803d7a:	c3                   	ret
+
+00803d7b <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803d7b:	55                   	push   %ebp
+  803d7c:	89 e5                	mov    %esp,%ebp
+  803d7e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d84:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.evctl.req_events = events;
+  803d89:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d8c:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.evctl.req_data = data;
+  803d91:	8b 45 10             	mov    0x10(%ebp),%eax
+  803d94:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_EVCTL);
+  803d99:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803d9e:	e8 46 f4 ff ff       	call   8031e9 <nsipc>
+}
+  803da3:	c9                   	leave
+  803da4:	c3                   	ret
+
+00803da5 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803da5:	55                   	push   %ebp
+  803da6:	89 e5                	mov    %esp,%ebp
+  803da8:	56                   	push   %esi
+  803da9:	53                   	push   %ebx
+  803daa:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803dad:	89 35 00 e0 80 00    	mov    %esi,0x80e000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803db3:	8b 45 10             	mov    0x10(%ebp),%eax
+  803db6:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803dbb:	b8 10 00 00 00       	mov    $0x10,%eax
+  803dc0:	e8 24 f4 ff ff       	call   8031e9 <nsipc>
+  803dc5:	89 c3                	mov    %eax,%ebx
+  803dc7:	85 c0                	test   %eax,%eax
+  803dc9:	7e 1f                	jle    803dea <nsipc_evwait+0x45>
+		assert(r <= max);
+  803dcb:	39 c6                	cmp    %eax,%esi
+  803dcd:	7c 24                	jl     803df3 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803dcf:	83 ec 04             	sub    $0x4,%esp
+  803dd2:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803dd9:	50                   	push   %eax
+  803dda:	68 00 e0 80 00       	push   $0x80e000
+  803ddf:	ff 75 08             	push   0x8(%ebp)
+  803de2:	e8 6e cf ff ff       	call   800d55 <memmove>
+  803de7:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803dea:	89 d8                	mov    %ebx,%eax
+  803dec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803def:	5b                   	pop    %ebx
+  803df0:	5e                   	pop    %esi
+  803df1:	5d                   	pop    %ebp
+  803df2:	c3                   	ret
+		assert(r <= max);
+  803df3:	68 28 57 80 00       	push   $0x805728
+  803df8:	68 5a 56 80 00       	push   $0x80565a
+  803dfd:	68 6a 01 00 00       	push   $0x16a
+  803e02:	68 10 57 80 00       	push   $0x805710
+  803e07:	e8 c7 c5 ff ff       	call   8003d3 <_panic>
+
+00803e0c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803e0c:	55                   	push   %ebp
+  803e0d:	89 e5                	mov    %esp,%ebp
+  803e0f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803e12:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e15:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.socket.req_type = type;
+  803e1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803e1d:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.socket.req_protocol = protocol;
+  803e22:	8b 45 10             	mov    0x10(%ebp),%eax
+  803e25:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SOCKET);
+  803e2a:	b8 09 00 00 00       	mov    $0x9,%eax
+  803e2f:	e8 b5 f3 ff ff       	call   8031e9 <nsipc>
+}
+  803e34:	c9                   	leave
+  803e35:	c3                   	ret
+
+00803e36 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803e36:	55                   	push   %ebp
+  803e37:	89 e5                	mov    %esp,%ebp
+  803e39:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e3f:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_OFFLOAD);
+  803e44:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803e49:	e8 9b f3 ff ff       	call   8031e9 <nsipc>
+}
+  803e4e:	c9                   	leave
+  803e4f:	c3                   	ret
+
+00803e50 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803e50:	55                   	push   %ebp
+  803e51:	89 e5                	mov    %esp,%ebp
+  803e53:	53                   	push   %ebx
+  803e54:	83 ec 04             	sub    $0x4,%esp
+  803e57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803e5a:	b8 12 00 00 00       	mov    $0x12,%eax
+  803e5f:	e8 85 f3 ff ff       	call   8031e9 <nsipc>
+  803e64:	85 c0                	test   %eax,%eax
+  803e66:	78 50                	js     803eb8 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803e68:	8b 15 00 e0 80 00    	mov    0x80e000,%edx
+  803e6e:	89 13                	mov    %edx,(%ebx)
+  803e70:	8b 15 04 e0 80 00    	mov    0x80e004,%edx
+  803e76:	89 53 04             	mov    %edx,0x4(%ebx)
+  803e79:	8b 15 08 e0 80 00    	mov    0x80e008,%edx
+  803e7f:	89 53 08             	mov    %edx,0x8(%ebx)
+  803e82:	8b 15 0c e0 80 00    	mov    0x80e00c,%edx
+  803e88:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803e8b:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  803e91:	89 53 10             	mov    %edx,0x10(%ebx)
+  803e94:	8b 15 14 e0 80 00    	mov    0x80e014,%edx
+  803e9a:	89 53 14             	mov    %edx,0x14(%ebx)
+  803e9d:	8b 15 18 e0 80 00    	mov    0x80e018,%edx
+  803ea3:	89 53 18             	mov    %edx,0x18(%ebx)
+  803ea6:	8b 15 1c e0 80 00    	mov    0x80e01c,%edx
+  803eac:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803eaf:	8b 15 20 e0 80 00    	mov    0x80e020,%edx
+  803eb5:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803eb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ebb:	c9                   	leave
+  803ebc:	c3                   	ret
+
+00803ebd <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803ebd:	55                   	push   %ebp
+  803ebe:	89 e5                	mov    %esp,%ebp
+  803ec0:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803ec3:	6a 03                	push   $0x3
+  803ec5:	e8 08 0f 00 00       	call   804dd2 <ipc_find_env>
+  803eca:	a3 24 c0 80 00       	mov    %eax,0x80c024
+	nsipcbuf.shard.req_shard = shard;
+  803ecf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ed2:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803ed7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803edc:	e8 08 f3 ff ff       	call   8031e9 <nsipc>
+  803ee1:	83 c4 10             	add    $0x10,%esp
+  803ee4:	85 c0                	test   %eax,%eax
+  803ee6:	78 0a                	js     803ef2 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803ee8:	a3 24 c0 80 00       	mov    %eax,0x80c024
+	return 0;
+  803eed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ef2:	c9                   	leave
+  803ef3:	c3                   	ret
+
+00803ef4 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803ef4:	55                   	push   %ebp
+  803ef5:	89 e5                	mov    %esp,%ebp
+  803ef7:	57                   	push   %edi
+  803ef8:	56                   	push   %esi
+  803ef9:	53                   	push   %ebx
+  803efa:	83 ec 1c             	sub    $0x1c,%esp
+  803efd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803f00:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803f03:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f0d:	89 e0                	mov    %esp,%eax
+  803f0f:	89 f2                	mov    %esi,%edx
+  803f11:	29 c2                	sub    %eax,%edx
+  803f13:	89 d0                	mov    %edx,%eax
+  803f15:	c1 e8 0f             	shr    $0xf,%eax
+  803f18:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803f1e:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803f21:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  803f28:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803f2b:	83 ec 0c             	sub    $0xc,%esp
+  803f2e:	ff 75 e0             	push   -0x20(%ebp)
+  803f31:	e8 db 0e 00 00       	call   804e11 <pageref>
+  803f36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803f39:	83 c4 04             	add    $0x4,%esp
+  803f3c:	ff 75 dc             	push   -0x24(%ebp)
+  803f3f:	e8 cd 0e 00 00       	call   804e11 <pageref>
+  803f44:	89 e2                	mov    %esp,%edx
+  803f46:	89 f1                	mov    %esi,%ecx
+  803f48:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803f4a:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803f4d:	89 ca                	mov    %ecx,%edx
+  803f4f:	c1 ea 0f             	shr    $0xf,%edx
+  803f52:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803f58:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803f5b:	8b 14 95 40 c0 80 00 	mov    0x80c040(,%edx,4),%edx
+  803f62:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803f65:	39 d7                	cmp    %edx,%edi
+  803f67:	74 40                	je     803fa9 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803f69:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803f6c:	75 9f                	jne    803f0d <_pipeisclosed+0x19>
+  803f6e:	89 e2                	mov    %esp,%edx
+  803f70:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f75:	29 d0                	sub    %edx,%eax
+  803f77:	89 c2                	mov    %eax,%edx
+  803f79:	c1 ea 0f             	shr    $0xf,%edx
+  803f7c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f86:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803f89:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  803f90:	8b 40 58             	mov    0x58(%eax),%eax
+  803f93:	6a 01                	push   $0x1
+  803f95:	50                   	push   %eax
+  803f96:	57                   	push   %edi
+  803f97:	68 31 57 80 00       	push   $0x805731
+  803f9c:	e8 0d c5 ff ff       	call   8004ae <cprintf>
+  803fa1:	83 c4 10             	add    $0x10,%esp
+  803fa4:	e9 5f ff ff ff       	jmp    803f08 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803fa9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803fac:	0f 94 c0             	sete   %al
+  803faf:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803fb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fb5:	5b                   	pop    %ebx
+  803fb6:	5e                   	pop    %esi
+  803fb7:	5f                   	pop    %edi
+  803fb8:	5d                   	pop    %ebp
+  803fb9:	c3                   	ret
+
+00803fba <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803fba:	55                   	push   %ebp
+  803fbb:	89 e5                	mov    %esp,%ebp
+  803fbd:	53                   	push   %ebx
+  803fbe:	83 ec 0c             	sub    $0xc,%esp
+  803fc1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803fc4:	53                   	push   %ebx
+  803fc5:	6a 00                	push   $0x0
+  803fc7:	e8 92 d0 ff ff       	call   80105e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803fcc:	89 1c 24             	mov    %ebx,(%esp)
+  803fcf:	e8 f4 db ff ff       	call   801bc8 <fd2data>
+  803fd4:	83 c4 08             	add    $0x8,%esp
+  803fd7:	50                   	push   %eax
+  803fd8:	6a 00                	push   $0x0
+  803fda:	e8 7f d0 ff ff       	call   80105e <sys_page_unmap>
+}
+  803fdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fe2:	c9                   	leave
+  803fe3:	c3                   	ret
+
+00803fe4 <devpipe_read>:
+{
+  803fe4:	55                   	push   %ebp
+  803fe5:	89 e5                	mov    %esp,%ebp
+  803fe7:	57                   	push   %edi
+  803fe8:	56                   	push   %esi
+  803fe9:	53                   	push   %ebx
+  803fea:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803fed:	ff 75 08             	push   0x8(%ebp)
+  803ff0:	e8 d3 db ff ff       	call   801bc8 <fd2data>
+  803ff5:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803ff7:	8b 70 04             	mov    0x4(%eax),%esi
+  803ffa:	8b 00                	mov    (%eax),%eax
+  803ffc:	83 c4 10             	add    $0x10,%esp
+  803fff:	39 f0                	cmp    %esi,%eax
+  804001:	75 36                	jne    804039 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  804003:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  804006:	89 da                	mov    %ebx,%edx
+  804008:	8b 45 08             	mov    0x8(%ebp),%eax
+  80400b:	e8 e4 fe ff ff       	call   803ef4 <_pipeisclosed>
+  804010:	85 c0                	test   %eax,%eax
+  804012:	0f 85 d4 00 00 00    	jne    8040ec <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  804018:	b8 01 00 00 00       	mov    $0x1,%eax
+  80401d:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  804021:	83 ec 04             	sub    $0x4,%esp
+  804024:	6a ff                	push   $0xffffffff
+  804026:	56                   	push   %esi
+  804027:	57                   	push   %edi
+  804028:	e8 aa d3 ff ff       	call   8013d7 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80402d:	8b 73 04             	mov    0x4(%ebx),%esi
+  804030:	8b 03                	mov    (%ebx),%eax
+  804032:	83 c4 10             	add    $0x10,%esp
+  804035:	39 c6                	cmp    %eax,%esi
+  804037:	74 cd                	je     804006 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804039:	8b 73 04             	mov    0x4(%ebx),%esi
+  80403c:	8b 03                	mov    (%ebx),%eax
+  80403e:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804044:	29 c6                	sub    %eax,%esi
+  804046:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80404b:	f7 e6                	mul    %esi
+  80404d:	c1 ea 0c             	shr    $0xc,%edx
+  804050:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804056:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  804058:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80405b:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80405f:	8b 0b                	mov    (%ebx),%ecx
+  804061:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804066:	f7 e1                	mul    %ecx
+  804068:	c1 ea 0b             	shr    $0xb,%edx
+  80406b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  804071:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  804073:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  804078:	29 cf                	sub    %ecx,%edi
+  80407a:	39 f7                	cmp    %esi,%edi
+  80407c:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80407f:	83 ec 04             	sub    $0x4,%esp
+  804082:	57                   	push   %edi
+  804083:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  804087:	50                   	push   %eax
+  804088:	ff 75 0c             	push   0xc(%ebp)
+  80408b:	e8 c5 cc ff ff       	call   800d55 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  804090:	83 c4 0c             	add    $0xc,%esp
+  804093:	89 f0                	mov    %esi,%eax
+  804095:	29 f8                	sub    %edi,%eax
+  804097:	50                   	push   %eax
+  804098:	8d 43 10             	lea    0x10(%ebx),%eax
+  80409b:	50                   	push   %eax
+  80409c:	89 f8                	mov    %edi,%eax
+  80409e:	03 45 0c             	add    0xc(%ebp),%eax
+  8040a1:	50                   	push   %eax
+  8040a2:	e8 ae cc ff ff       	call   800d55 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8040a7:	8b 0b                	mov    (%ebx),%ecx
+  8040a9:	01 f1                	add    %esi,%ecx
+  8040ab:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8040b0:	f7 e1                	mul    %ecx
+  8040b2:	c1 ea 0c             	shr    $0xc,%edx
+  8040b5:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8040bb:	29 c1                	sub    %eax,%ecx
+  8040bd:	89 0b                	mov    %ecx,(%ebx)
+  8040bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c4:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8040c8:	83 c4 10             	add    $0x10,%esp
+  8040cb:	85 c0                	test   %eax,%eax
+  8040cd:	75 0a                	jne    8040d9 <devpipe_read+0xf5>
+	return n;
+  8040cf:	89 f0                	mov    %esi,%eax
+}
+  8040d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040d4:	5b                   	pop    %ebx
+  8040d5:	5e                   	pop    %esi
+  8040d6:	5f                   	pop    %edi
+  8040d7:	5d                   	pop    %ebp
+  8040d8:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8040d9:	83 ec 08             	sub    $0x8,%esp
+  8040dc:	68 00 04 00 00       	push   $0x400
+  8040e1:	53                   	push   %ebx
+  8040e2:	e8 12 d3 ff ff       	call   8013f9 <sys_futex_wake>
+  8040e7:	83 c4 10             	add    $0x10,%esp
+  8040ea:	eb e3                	jmp    8040cf <devpipe_read+0xeb>
+			return 0;
+  8040ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f1:	eb de                	jmp    8040d1 <devpipe_read+0xed>
+
+008040f3 <devpipe_write>:
+{
+  8040f3:	55                   	push   %ebp
+  8040f4:	89 e5                	mov    %esp,%ebp
+  8040f6:	57                   	push   %edi
+  8040f7:	56                   	push   %esi
+  8040f8:	53                   	push   %ebx
+  8040f9:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8040fc:	ff 75 08             	push   0x8(%ebp)
+  8040ff:	e8 c4 da ff ff       	call   801bc8 <fd2data>
+  804104:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  804106:	83 c4 10             	add    $0x10,%esp
+  804109:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804110:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  804115:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804119:	0f 84 43 01 00 00    	je     804262 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80411f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804122:	8b 06                	mov    (%esi),%eax
+  804124:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80412a:	29 c1                	sub    %eax,%ecx
+  80412c:	89 c8                	mov    %ecx,%eax
+  80412e:	f7 e7                	mul    %edi
+  804130:	c1 ea 0c             	shr    $0xc,%edx
+  804133:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804139:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80413b:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804141:	75 52                	jne    804195 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  804143:	89 f2                	mov    %esi,%edx
+  804145:	8b 45 08             	mov    0x8(%ebp),%eax
+  804148:	e8 a7 fd ff ff       	call   803ef4 <_pipeisclosed>
+  80414d:	85 c0                	test   %eax,%eax
+  80414f:	0f 85 28 01 00 00    	jne    80427d <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  804155:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804157:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80415a:	8b 06                	mov    (%esi),%eax
+  80415c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804162:	29 c1                	sub    %eax,%ecx
+  804164:	89 c8                	mov    %ecx,%eax
+  804166:	f7 e7                	mul    %edi
+  804168:	c1 ea 0c             	shr    $0xc,%edx
+  80416b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804171:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  804173:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804179:	75 a4                	jne    80411f <devpipe_write+0x2c>
+  80417b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804180:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  804184:	83 ec 04             	sub    $0x4,%esp
+  804187:	6a ff                	push   $0xffffffff
+  804189:	53                   	push   %ebx
+  80418a:	56                   	push   %esi
+  80418b:	e8 47 d2 ff ff       	call   8013d7 <sys_futex_wait>
+}
+  804190:	83 c4 10             	add    $0x10,%esp
+  804193:	eb 8a                	jmp    80411f <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804195:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804198:	8b 06                	mov    (%esi),%eax
+  80419a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8041a0:	29 c1                	sub    %eax,%ecx
+  8041a2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8041a7:	f7 e1                	mul    %ecx
+  8041a9:	c1 ea 0c             	shr    $0xc,%edx
+  8041ac:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8041b2:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8041b4:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8041b9:	89 d8                	mov    %ebx,%eax
+  8041bb:	29 c8                	sub    %ecx,%eax
+  8041bd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8041c0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8041c3:	29 ca                	sub    %ecx,%edx
+  8041c5:	39 d0                	cmp    %edx,%eax
+  8041c7:	0f 46 d0             	cmovbe %eax,%edx
+  8041ca:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8041cd:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8041d0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8041d5:	f7 e1                	mul    %ecx
+  8041d7:	c1 ea 0b             	shr    $0xb,%edx
+  8041da:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8041e0:	89 ca                	mov    %ecx,%edx
+  8041e2:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8041e4:	29 d3                	sub    %edx,%ebx
+  8041e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041e9:	39 c3                	cmp    %eax,%ebx
+  8041eb:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8041ee:	83 ec 04             	sub    $0x4,%esp
+  8041f1:	53                   	push   %ebx
+  8041f2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8041f5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8041f8:	51                   	push   %ecx
+  8041f9:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8041fd:	50                   	push   %eax
+  8041fe:	e8 52 cb ff ff       	call   800d55 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  804203:	83 c4 0c             	add    $0xc,%esp
+  804206:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804209:	29 d8                	sub    %ebx,%eax
+  80420b:	50                   	push   %eax
+  80420c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80420f:	01 cb                	add    %ecx,%ebx
+  804211:	03 5d 0c             	add    0xc(%ebp),%ebx
+  804214:	53                   	push   %ebx
+  804215:	8d 46 10             	lea    0x10(%esi),%eax
+  804218:	50                   	push   %eax
+  804219:	e8 37 cb ff ff       	call   800d55 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80421e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804221:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804224:	01 c1                	add    %eax,%ecx
+  804226:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80422b:	f7 e1                	mul    %ecx
+  80422d:	c1 ea 0c             	shr    $0xc,%edx
+  804230:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  804236:	89 ca                	mov    %ecx,%edx
+  804238:	29 c2                	sub    %eax,%edx
+  80423a:	89 56 04             	mov    %edx,0x4(%esi)
+  80423d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804242:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  804246:	83 c4 10             	add    $0x10,%esp
+  804249:	85 c0                	test   %eax,%eax
+  80424b:	75 1a                	jne    804267 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80424d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804250:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  804253:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804256:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804259:	0f 82 c0 fe ff ff    	jb     80411f <devpipe_write+0x2c>
+  80425f:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  804262:	8b 45 10             	mov    0x10(%ebp),%eax
+  804265:	eb 1b                	jmp    804282 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  804267:	83 ec 08             	sub    $0x8,%esp
+  80426a:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  80426f:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  804272:	50                   	push   %eax
+  804273:	e8 81 d1 ff ff       	call   8013f9 <sys_futex_wake>
+  804278:	83 c4 10             	add    $0x10,%esp
+  80427b:	eb d0                	jmp    80424d <devpipe_write+0x15a>
+				return 0;
+  80427d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804285:	5b                   	pop    %ebx
+  804286:	5e                   	pop    %esi
+  804287:	5f                   	pop    %edi
+  804288:	5d                   	pop    %ebp
+  804289:	c3                   	ret
+
+0080428a <devpipe_stat>:
+{
+  80428a:	55                   	push   %ebp
+  80428b:	89 e5                	mov    %esp,%ebp
+  80428d:	56                   	push   %esi
+  80428e:	53                   	push   %ebx
+  80428f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804292:	83 ec 0c             	sub    $0xc,%esp
+  804295:	ff 75 08             	push   0x8(%ebp)
+  804298:	e8 2b d9 ff ff       	call   801bc8 <fd2data>
+  80429d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80429f:	83 c4 08             	add    $0x8,%esp
+  8042a2:	68 44 57 80 00       	push   $0x805744
+  8042a7:	53                   	push   %ebx
+  8042a8:	e8 f8 c8 ff ff       	call   800ba5 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8042ad:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8042b0:	8b 06                	mov    (%esi),%eax
+  8042b2:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8042b8:	29 c1                	sub    %eax,%ecx
+  8042ba:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8042bf:	89 c8                	mov    %ecx,%eax
+  8042c1:	f7 e2                	mul    %edx
+  8042c3:	c1 ea 0c             	shr    $0xc,%edx
+  8042c6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8042cc:	29 d1                	sub    %edx,%ecx
+  8042ce:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8042d4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8042db:	00 00 00 
+	stat->st_dev = &devpipe;
+  8042de:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  8042e5:	60 80 00 
+}
+  8042e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042f0:	5b                   	pop    %ebx
+  8042f1:	5e                   	pop    %esi
+  8042f2:	5d                   	pop    %ebp
+  8042f3:	c3                   	ret
+
+008042f4 <devpipe_poll>:
+{
+  8042f4:	55                   	push   %ebp
+  8042f5:	89 e5                	mov    %esp,%ebp
+  8042f7:	57                   	push   %edi
+  8042f8:	56                   	push   %esi
+  8042f9:	53                   	push   %ebx
+  8042fa:	83 ec 18             	sub    $0x18,%esp
+  8042fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804300:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804303:	57                   	push   %edi
+  804304:	e8 bf d8 ff ff       	call   801bc8 <fd2data>
+  804309:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80430b:	83 c4 10             	add    $0x10,%esp
+  80430e:	89 f3                	mov    %esi,%ebx
+  804310:	83 e3 01             	and    $0x1,%ebx
+  804313:	75 27                	jne    80433c <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  804315:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80431b:	75 48                	jne    804365 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80431d:	89 ca                	mov    %ecx,%edx
+  80431f:	89 f8                	mov    %edi,%eax
+  804321:	e8 ce fb ff ff       	call   803ef4 <_pipeisclosed>
+  804326:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  804328:	89 d8                	mov    %ebx,%eax
+  80432a:	83 c8 10             	or     $0x10,%eax
+  80432d:	85 d2                	test   %edx,%edx
+  80432f:	0f 45 d8             	cmovne %eax,%ebx
+}
+  804332:	89 d8                	mov    %ebx,%eax
+  804334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804337:	5b                   	pop    %ebx
+  804338:	5e                   	pop    %esi
+  804339:	5f                   	pop    %edi
+  80433a:	5d                   	pop    %ebp
+  80433b:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80433c:	8b 58 04             	mov    0x4(%eax),%ebx
+  80433f:	8b 00                	mov    (%eax),%eax
+  804341:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  804347:	29 c3                	sub    %eax,%ebx
+  804349:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80434e:	89 d8                	mov    %ebx,%eax
+  804350:	f7 e2                	mul    %edx
+  804352:	c1 ea 0c             	shr    $0xc,%edx
+  804355:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80435b:	39 d3                	cmp    %edx,%ebx
+  80435d:	0f 95 c3             	setne  %bl
+  804360:	0f b6 db             	movzbl %bl,%ebx
+  804363:	eb b0                	jmp    804315 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804365:	8b 71 04             	mov    0x4(%ecx),%esi
+  804368:	8b 01                	mov    (%ecx),%eax
+  80436a:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804370:	29 c6                	sub    %eax,%esi
+  804372:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804377:	89 f0                	mov    %esi,%eax
+  804379:	f7 e2                	mul    %edx
+  80437b:	c1 ea 0c             	shr    $0xc,%edx
+  80437e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804384:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  804386:	89 d8                	mov    %ebx,%eax
+  804388:	83 c8 04             	or     $0x4,%eax
+  80438b:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  804391:	0f 42 d8             	cmovb  %eax,%ebx
+  804394:	eb 87                	jmp    80431d <devpipe_poll+0x29>
+
+00804396 <pipe>:
+{
+  804396:	55                   	push   %ebp
+  804397:	89 e5                	mov    %esp,%ebp
+  804399:	56                   	push   %esi
+  80439a:	53                   	push   %ebx
+  80439b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80439e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043a1:	50                   	push   %eax
+  8043a2:	e8 38 d8 ff ff       	call   801bdf <fd_alloc>
+  8043a7:	89 c3                	mov    %eax,%ebx
+  8043a9:	83 c4 10             	add    $0x10,%esp
+  8043ac:	85 c0                	test   %eax,%eax
+  8043ae:	0f 88 23 01 00 00    	js     8044d7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8043b4:	83 ec 04             	sub    $0x4,%esp
+  8043b7:	68 07 04 00 00       	push   $0x407
+  8043bc:	ff 75 f4             	push   -0xc(%ebp)
+  8043bf:	6a 00                	push   $0x0
+  8043c1:	e8 13 cc ff ff       	call   800fd9 <sys_page_alloc>
+  8043c6:	89 c3                	mov    %eax,%ebx
+  8043c8:	83 c4 10             	add    $0x10,%esp
+  8043cb:	85 c0                	test   %eax,%eax
+  8043cd:	0f 88 04 01 00 00    	js     8044d7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8043d3:	83 ec 0c             	sub    $0xc,%esp
+  8043d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8043d9:	50                   	push   %eax
+  8043da:	e8 00 d8 ff ff       	call   801bdf <fd_alloc>
+  8043df:	89 c3                	mov    %eax,%ebx
+  8043e1:	83 c4 10             	add    $0x10,%esp
+  8043e4:	85 c0                	test   %eax,%eax
+  8043e6:	0f 88 db 00 00 00    	js     8044c7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8043ec:	83 ec 04             	sub    $0x4,%esp
+  8043ef:	68 07 04 00 00       	push   $0x407
+  8043f4:	ff 75 f0             	push   -0x10(%ebp)
+  8043f7:	6a 00                	push   $0x0
+  8043f9:	e8 db cb ff ff       	call   800fd9 <sys_page_alloc>
+  8043fe:	89 c3                	mov    %eax,%ebx
+  804400:	83 c4 10             	add    $0x10,%esp
+  804403:	85 c0                	test   %eax,%eax
+  804405:	0f 88 bc 00 00 00    	js     8044c7 <pipe+0x131>
+	va = fd2data(fd0);
+  80440b:	83 ec 0c             	sub    $0xc,%esp
+  80440e:	ff 75 f4             	push   -0xc(%ebp)
+  804411:	e8 b2 d7 ff ff       	call   801bc8 <fd2data>
+  804416:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804418:	83 c4 0c             	add    $0xc,%esp
+  80441b:	68 07 04 00 00       	push   $0x407
+  804420:	50                   	push   %eax
+  804421:	6a 00                	push   $0x0
+  804423:	e8 b1 cb ff ff       	call   800fd9 <sys_page_alloc>
+  804428:	89 c3                	mov    %eax,%ebx
+  80442a:	83 c4 10             	add    $0x10,%esp
+  80442d:	85 c0                	test   %eax,%eax
+  80442f:	0f 88 82 00 00 00    	js     8044b7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804435:	83 ec 0c             	sub    $0xc,%esp
+  804438:	ff 75 f0             	push   -0x10(%ebp)
+  80443b:	e8 88 d7 ff ff       	call   801bc8 <fd2data>
+  804440:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  804447:	50                   	push   %eax
+  804448:	6a 00                	push   $0x0
+  80444a:	56                   	push   %esi
+  80444b:	6a 00                	push   $0x0
+  80444d:	e8 ca cb ff ff       	call   80101c <sys_page_map>
+  804452:	89 c3                	mov    %eax,%ebx
+  804454:	83 c4 20             	add    $0x20,%esp
+  804457:	85 c0                	test   %eax,%eax
+  804459:	78 4e                	js     8044a9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80445b:	a1 60 60 80 00       	mov    0x806060,%eax
+  804460:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804463:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804465:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804468:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80446f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804472:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804474:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804477:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80447e:	83 ec 0c             	sub    $0xc,%esp
+  804481:	ff 75 f4             	push   -0xc(%ebp)
+  804484:	e8 2f d7 ff ff       	call   801bb8 <fd2num>
+  804489:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80448c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80448e:	83 c4 04             	add    $0x4,%esp
+  804491:	ff 75 f0             	push   -0x10(%ebp)
+  804494:	e8 1f d7 ff ff       	call   801bb8 <fd2num>
+  804499:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80449c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80449f:	83 c4 10             	add    $0x10,%esp
+  8044a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044a7:	eb 2e                	jmp    8044d7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8044a9:	83 ec 08             	sub    $0x8,%esp
+  8044ac:	56                   	push   %esi
+  8044ad:	6a 00                	push   $0x0
+  8044af:	e8 aa cb ff ff       	call   80105e <sys_page_unmap>
+  8044b4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8044b7:	83 ec 08             	sub    $0x8,%esp
+  8044ba:	ff 75 f0             	push   -0x10(%ebp)
+  8044bd:	6a 00                	push   $0x0
+  8044bf:	e8 9a cb ff ff       	call   80105e <sys_page_unmap>
+  8044c4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8044c7:	83 ec 08             	sub    $0x8,%esp
+  8044ca:	ff 75 f4             	push   -0xc(%ebp)
+  8044cd:	6a 00                	push   $0x0
+  8044cf:	e8 8a cb ff ff       	call   80105e <sys_page_unmap>
+  8044d4:	83 c4 10             	add    $0x10,%esp
+}
+  8044d7:	89 d8                	mov    %ebx,%eax
+  8044d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044dc:	5b                   	pop    %ebx
+  8044dd:	5e                   	pop    %esi
+  8044de:	5d                   	pop    %ebp
+  8044df:	c3                   	ret
+
+008044e0 <pipeisclosed>:
+{
+  8044e0:	55                   	push   %ebp
+  8044e1:	89 e5                	mov    %esp,%ebp
+  8044e3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8044e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8044e9:	50                   	push   %eax
+  8044ea:	ff 75 08             	push   0x8(%ebp)
+  8044ed:	e8 3d d7 ff ff       	call   801c2f <fd_lookup>
+  8044f2:	83 c4 10             	add    $0x10,%esp
+  8044f5:	85 c0                	test   %eax,%eax
+  8044f7:	78 18                	js     804511 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8044f9:	83 ec 0c             	sub    $0xc,%esp
+  8044fc:	ff 75 f4             	push   -0xc(%ebp)
+  8044ff:	e8 c4 d6 ff ff       	call   801bc8 <fd2data>
+  804504:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  804506:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804509:	e8 e6 f9 ff ff       	call   803ef4 <_pipeisclosed>
+  80450e:	83 c4 10             	add    $0x10,%esp
+}
+  804511:	c9                   	leave
+  804512:	c3                   	ret
+
+00804513 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  804513:	55                   	push   %ebp
+  804514:	89 e5                	mov    %esp,%ebp
+  804516:	56                   	push   %esi
+  804517:	53                   	push   %ebx
+  804518:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80451b:	85 f6                	test   %esi,%esi
+  80451d:	74 40                	je     80455f <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  80451f:	89 f3                	mov    %esi,%ebx
+  804521:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804527:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  80452d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804532:	8b 40 48             	mov    0x48(%eax),%eax
+  804535:	39 c6                	cmp    %eax,%esi
+  804537:	75 1f                	jne    804558 <wait+0x45>
+  804539:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  80453f:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  804545:	8b 43 54             	mov    0x54(%ebx),%eax
+  804548:	85 c0                	test   %eax,%eax
+  80454a:	74 0c                	je     804558 <wait+0x45>
+		sys_yield();
+  80454c:	e8 69 ca ff ff       	call   800fba <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804551:	8b 43 48             	mov    0x48(%ebx),%eax
+  804554:	39 f0                	cmp    %esi,%eax
+  804556:	74 ed                	je     804545 <wait+0x32>
+}
+  804558:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80455b:	5b                   	pop    %ebx
+  80455c:	5e                   	pop    %esi
+  80455d:	5d                   	pop    %ebp
+  80455e:	c3                   	ret
+	assert(envid != 0);
+  80455f:	68 4b 57 80 00       	push   $0x80574b
+  804564:	68 5a 56 80 00       	push   $0x80565a
+  804569:	6a 09                	push   $0x9
+  80456b:	68 56 57 80 00       	push   $0x805756
+  804570:	e8 5e be ff ff       	call   8003d3 <_panic>
+
+00804575 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  804575:	55                   	push   %ebp
+  804576:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  804578:	8b 45 08             	mov    0x8(%ebp),%eax
+  80457b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804581:	5d                   	pop    %ebp
+  804582:	c3                   	ret
+
+00804583 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  804583:	55                   	push   %ebp
+  804584:	89 e5                	mov    %esp,%ebp
+  804586:	53                   	push   %ebx
+  804587:	83 ec 04             	sub    $0x4,%esp
+  80458a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80458d:	8b 03                	mov    (%ebx),%eax
+  80458f:	85 c0                	test   %eax,%eax
+  804591:	75 05                	jne    804598 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  804593:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804596:	c9                   	leave
+  804597:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  804598:	83 ec 08             	sub    $0x8,%esp
+  80459b:	50                   	push   %eax
+  80459c:	8d 43 04             	lea    0x4(%ebx),%eax
+  80459f:	50                   	push   %eax
+  8045a0:	e8 09 cd ff ff       	call   8012ae <sys_page_batch>
+	pb->pb_n = 0;
+  8045a5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8045ab:	83 c4 10             	add    $0x10,%esp
+  8045ae:	eb e3                	jmp    804593 <pgbatch_flush+0x10>
+
+008045b0 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8045b0:	55                   	push   %ebp
+  8045b1:	89 e5                	mov    %esp,%ebp
+  8045b3:	56                   	push   %esi
+  8045b4:	53                   	push   %ebx
+  8045b5:	89 c3                	mov    %eax,%ebx
+  8045b7:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8045b9:	83 38 20             	cmpl   $0x20,(%eax)
+  8045bc:	74 2c                	je     8045ea <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8045be:	8b 03                	mov    (%ebx),%eax
+  8045c0:	8d 50 01             	lea    0x1(%eax),%edx
+  8045c3:	89 13                	mov    %edx,(%ebx)
+  8045c5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8045c8:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8045cc:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8045ce:	83 ec 04             	sub    $0x4,%esp
+  8045d1:	6a 18                	push   $0x18
+  8045d3:	6a 00                	push   $0x0
+  8045d5:	50                   	push   %eax
+  8045d6:	e8 45 c7 ff ff       	call   800d20 <memset>
+	return 0;
+  8045db:	83 c4 10             	add    $0x10,%esp
+  8045de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8045e6:	5b                   	pop    %ebx
+  8045e7:	5e                   	pop    %esi
+  8045e8:	5d                   	pop    %ebp
+  8045e9:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8045ea:	83 ec 0c             	sub    $0xc,%esp
+  8045ed:	50                   	push   %eax
+  8045ee:	e8 90 ff ff ff       	call   804583 <pgbatch_flush>
+  8045f3:	83 c4 10             	add    $0x10,%esp
+  8045f6:	85 c0                	test   %eax,%eax
+  8045f8:	79 c4                	jns    8045be <pgbatch_slot+0xe>
+  8045fa:	eb e7                	jmp    8045e3 <pgbatch_slot+0x33>
+
+008045fc <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8045fc:	55                   	push   %ebp
+  8045fd:	89 e5                	mov    %esp,%ebp
+  8045ff:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804602:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804605:	8b 45 08             	mov    0x8(%ebp),%eax
+  804608:	e8 a3 ff ff ff       	call   8045b0 <pgbatch_slot>
+  80460d:	85 c0                	test   %eax,%eax
+  80460f:	78 20                	js     804631 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  804611:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804614:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80461a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80461d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804620:	8b 55 10             	mov    0x10(%ebp),%edx
+  804623:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804626:	8b 55 14             	mov    0x14(%ebp),%edx
+  804629:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80462c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804631:	c9                   	leave
+  804632:	c3                   	ret
+
+00804633 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  804633:	55                   	push   %ebp
+  804634:	89 e5                	mov    %esp,%ebp
+  804636:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804639:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80463c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80463f:	e8 6c ff ff ff       	call   8045b0 <pgbatch_slot>
+  804644:	85 c0                	test   %eax,%eax
+  804646:	78 2c                	js     804674 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  804648:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80464b:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  804651:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804654:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  804657:	8b 55 10             	mov    0x10(%ebp),%edx
+  80465a:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80465d:	8b 55 14             	mov    0x14(%ebp),%edx
+  804660:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  804663:	8b 55 18             	mov    0x18(%ebp),%edx
+  804666:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804669:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80466c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80466f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804674:	c9                   	leave
+  804675:	c3                   	ret
+
+00804676 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  804676:	55                   	push   %ebp
+  804677:	89 e5                	mov    %esp,%ebp
+  804679:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80467c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80467f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804682:	e8 29 ff ff ff       	call   8045b0 <pgbatch_slot>
+  804687:	85 c0                	test   %eax,%eax
+  804689:	78 1a                	js     8046a5 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80468b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80468e:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  804694:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804697:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80469a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80469d:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8046a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046a5:	c9                   	leave
+  8046a6:	c3                   	ret
+
+008046a7 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8046a7:	55                   	push   %ebp
+  8046a8:	89 e5                	mov    %esp,%ebp
+  8046aa:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8046ad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8046b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046b3:	e8 f8 fe ff ff       	call   8045b0 <pgbatch_slot>
+  8046b8:	85 c0                	test   %eax,%eax
+  8046ba:	78 20                	js     8046dc <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8046bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8046bf:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8046c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8046c8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8046cb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8046ce:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8046d1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8046d4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8046d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046dc:	c9                   	leave
+  8046dd:	c3                   	ret
+
+008046de <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8046de:	55                   	push   %ebp
+  8046df:	89 e5                	mov    %esp,%ebp
+  8046e1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8046e4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8046e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046ea:	e8 c1 fe ff ff       	call   8045b0 <pgbatch_slot>
+  8046ef:	85 c0                	test   %eax,%eax
+  8046f1:	78 26                	js     804719 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8046f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8046f6:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8046fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8046ff:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  804702:	8b 55 10             	mov    0x10(%ebp),%edx
+  804705:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  804708:	8b 55 14             	mov    0x14(%ebp),%edx
+  80470b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80470e:	8b 55 18             	mov    0x18(%ebp),%edx
+  804711:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804714:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804719:	c9                   	leave
+  80471a:	c3                   	ret
+
+0080471b <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  80471b:	55                   	push   %ebp
+  80471c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80471e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804721:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804727:	5d                   	pop    %ebp
+  804728:	c3                   	ret
+
+00804729 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  804729:	55                   	push   %ebp
+  80472a:	89 e5                	mov    %esp,%ebp
+  80472c:	56                   	push   %esi
+  80472d:	53                   	push   %ebx
+  80472e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804731:	b8 00 00 00 00       	mov    $0x0,%eax
+  804736:	ba 01 00 00 00       	mov    $0x1,%edx
+  80473b:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80473f:	85 c0                	test   %eax,%eax
+  804741:	74 2f                	je     804772 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  804743:	83 f8 02             	cmp    $0x2,%eax
+  804746:	74 0c                	je     804754 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  804748:	b8 02 00 00 00       	mov    $0x2,%eax
+  80474d:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  804750:	85 c0                	test   %eax,%eax
+  804752:	74 1e                	je     804772 <mutex_lock+0x49>
+  804754:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  804759:	83 ec 04             	sub    $0x4,%esp
+  80475c:	6a ff                	push   $0xffffffff
+  80475e:	6a 02                	push   $0x2
+  804760:	53                   	push   %ebx
+  804761:	e8 71 cc ff ff       	call   8013d7 <sys_futex_wait>
+  804766:	89 f0                	mov    %esi,%eax
+  804768:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  80476b:	83 c4 10             	add    $0x10,%esp
+  80476e:	85 c0                	test   %eax,%eax
+  804770:	75 e7                	jne    804759 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804772:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804775:	5b                   	pop    %ebx
+  804776:	5e                   	pop    %esi
+  804777:	5d                   	pop    %ebp
+  804778:	c3                   	ret
+
+00804779 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  804779:	55                   	push   %ebp
+  80477a:	89 e5                	mov    %esp,%ebp
+  80477c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  80477f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804784:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804789:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  80478d:	85 c0                	test   %eax,%eax
+  80478f:	0f 94 c0             	sete   %al
+  804792:	0f b6 c0             	movzbl %al,%eax
+}
+  804795:	5d                   	pop    %ebp
+  804796:	c3                   	ret
+
+00804797 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804797:	55                   	push   %ebp
+  804798:	89 e5                	mov    %esp,%ebp
+  80479a:	83 ec 08             	sub    $0x8,%esp
+  80479d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  8047a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a5:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8047a8:	83 f8 02             	cmp    $0x2,%eax
+  8047ab:	74 02                	je     8047af <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8047ad:	c9                   	leave
+  8047ae:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8047af:	83 ec 08             	sub    $0x8,%esp
+  8047b2:	6a 01                	push   $0x1
+  8047b4:	52                   	push   %edx
+  8047b5:	e8 3f cc ff ff       	call   8013f9 <sys_futex_wake>
+  8047ba:	83 c4 10             	add    $0x10,%esp
+}
+  8047bd:	eb ee                	jmp    8047ad <mutex_unlock+0x16>
+
+008047bf <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  8047bf:	55                   	push   %ebp
+  8047c0:	89 e5                	mov    %esp,%ebp
+  8047c2:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  8047c5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  8047cb:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8047d2:	5d                   	pop    %ebp
+  8047d3:	c3                   	ret
+
+008047d4 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8047d4:	55                   	push   %ebp
+  8047d5:	89 e5                	mov    %esp,%ebp
+  8047d7:	57                   	push   %edi
+  8047d8:	56                   	push   %esi
+  8047d9:	53                   	push   %ebx
+  8047da:	83 ec 18             	sub    $0x18,%esp
+  8047dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8047e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  8047e3:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  8047e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8047ea:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  8047ef:	57                   	push   %edi
+  8047f0:	e8 a2 ff ff ff       	call   804797 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8047f5:	83 c4 0c             	add    $0xc,%esp
+  8047f8:	ff 75 10             	push   0x10(%ebp)
+  8047fb:	56                   	push   %esi
+  8047fc:	53                   	push   %ebx
+  8047fd:	e8 d5 cb ff ff       	call   8013d7 <sys_futex_wait>
+  804802:	89 c6                	mov    %eax,%esi
+  804804:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804809:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  80480e:	89 3c 24             	mov    %edi,(%esp)
+  804811:	e8 13 ff ff ff       	call   804729 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804816:	83 c4 10             	add    $0x10,%esp
+  804819:	83 fe ef             	cmp    $0xffffffef,%esi
+  80481c:	74 05                	je     804823 <cond_timedwait+0x4f>
+  80481e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804823:	89 f0                	mov    %esi,%eax
+  804825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804828:	5b                   	pop    %ebx
+  804829:	5e                   	pop    %esi
+  80482a:	5f                   	pop    %edi
+  80482b:	5d                   	pop    %ebp
+  80482c:	c3                   	ret
+
+0080482d <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80482d:	55                   	push   %ebp
+  80482e:	89 e5                	mov    %esp,%ebp
+  804830:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804833:	6a ff                	push   $0xffffffff
+  804835:	ff 75 0c             	push   0xc(%ebp)
+  804838:	ff 75 08             	push   0x8(%ebp)
+  80483b:	e8 94 ff ff ff       	call   8047d4 <cond_timedwait>
+}
+  804840:	83 c4 10             	add    $0x10,%esp
+  804843:	c9                   	leave
+  804844:	c3                   	ret
+
+00804845 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804845:	55                   	push   %ebp
+  804846:	89 e5                	mov    %esp,%ebp
+  804848:	83 ec 08             	sub    $0x8,%esp
+  80484b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80484e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804853:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804857:	8b 50 04             	mov    0x4(%eax),%edx
+  80485a:	85 d2                	test   %edx,%edx
+  80485c:	75 02                	jne    804860 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  80485e:	c9                   	leave
+  80485f:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804860:	83 ec 08             	sub    $0x8,%esp
+  804863:	6a 01                	push   $0x1
+  804865:	50                   	push   %eax
+  804866:	e8 8e cb ff ff       	call   8013f9 <sys_futex_wake>
+  80486b:	83 c4 10             	add    $0x10,%esp
+}
+  80486e:	eb ee                	jmp    80485e <cond_signal+0x19>
+
+00804870 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804870:	55                   	push   %ebp
+  804871:	89 e5                	mov    %esp,%ebp
+  804873:	83 ec 08             	sub    $0x8,%esp
+  804876:	8b 45 08             	mov    0x8(%ebp),%eax
+  804879:	ba 01 00 00 00       	mov    $0x1,%edx
+  80487e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804882:	8b 50 04             	mov    0x4(%eax),%edx
+  804885:	85 d2                	test   %edx,%edx
+  804887:	75 02                	jne    80488b <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  804889:	c9                   	leave
+  80488a:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  80488b:	83 ec 08             	sub    $0x8,%esp
+  80488e:	68 00 04 00 00       	push   $0x400
+  804893:	50                   	push   %eax
+  804894:	e8 60 cb ff ff       	call   8013f9 <sys_futex_wake>
+  804899:	83 c4 10             	add    $0x10,%esp
+}
+  80489c:	eb eb                	jmp    804889 <cond_broadcast+0x19>
+
+0080489e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80489e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048a3:	c3                   	ret
+
+008048a4 <devcons_poll>:
+{
+  8048a4:	55                   	push   %ebp
+  8048a5:	89 e5                	mov    %esp,%ebp
+  8048a7:	53                   	push   %ebx
+  8048a8:	83 ec 04             	sub    $0x4,%esp
+  8048ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8048ae:	89 da                	mov    %ebx,%edx
+  8048b0:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8048b3:	83 3d 34 c0 80 00 00 	cmpl   $0x0,0x80c034
+  8048ba:	74 0c                	je     8048c8 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8048bc:	89 d8                	mov    %ebx,%eax
+  8048be:	83 e0 01             	and    $0x1,%eax
+  8048c1:	09 d0                	or     %edx,%eax
+}
+  8048c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8048c6:	c9                   	leave
+  8048c7:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8048c8:	e8 6e c6 ff ff       	call   800f3b <sys_cgetc>
+  8048cd:	a3 34 c0 80 00       	mov    %eax,0x80c034
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8048d2:	89 da                	mov    %ebx,%edx
+  8048d4:	83 e2 04             	and    $0x4,%edx
+  8048d7:	85 c0                	test   %eax,%eax
+  8048d9:	74 e6                	je     8048c1 <devcons_poll+0x1d>
+  8048db:	eb df                	jmp    8048bc <devcons_poll+0x18>
+
+008048dd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8048dd:	55                   	push   %ebp
+  8048de:	89 e5                	mov    %esp,%ebp
+  8048e0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8048e3:	68 61 57 80 00       	push   $0x805761
+  8048e8:	ff 75 0c             	push   0xc(%ebp)
+  8048eb:	e8 b5 c2 ff ff       	call   800ba5 <strcpy>
+	return 0;
+}
+  8048f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f5:	c9                   	leave
+  8048f6:	c3                   	ret
+
+008048f7 <devcons_write>:
+{
+  8048f7:	55                   	push   %ebp
+  8048f8:	89 e5                	mov    %esp,%ebp
+  8048fa:	57                   	push   %edi
+  8048fb:	56                   	push   %esi
+  8048fc:	53                   	push   %ebx
+  8048fd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804903:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804906:	85 ff                	test   %edi,%edi
+  804908:	74 51                	je     80495b <devcons_write+0x64>
+  80490a:	be 00 00 00 00       	mov    $0x0,%esi
+  80490f:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804914:	89 fb                	mov    %edi,%ebx
+  804916:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  804918:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80491d:	39 d3                	cmp    %edx,%ebx
+  80491f:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804922:	83 ec 04             	sub    $0x4,%esp
+  804925:	53                   	push   %ebx
+  804926:	03 45 0c             	add    0xc(%ebp),%eax
+  804929:	50                   	push   %eax
+  80492a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804930:	50                   	push   %eax
+  804931:	e8 1f c4 ff ff       	call   800d55 <memmove>
+		sys_cputs(buf, m);
+  804936:	83 c4 08             	add    $0x8,%esp
+  804939:	53                   	push   %ebx
+  80493a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804940:	50                   	push   %eax
+  804941:	e8 d7 c5 ff ff       	call   800f1d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804946:	01 de                	add    %ebx,%esi
+  804948:	89 f0                	mov    %esi,%eax
+  80494a:	83 c4 10             	add    $0x10,%esp
+  80494d:	39 fe                	cmp    %edi,%esi
+  80494f:	72 c3                	jb     804914 <devcons_write+0x1d>
+}
+  804951:	89 f0                	mov    %esi,%eax
+  804953:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804956:	5b                   	pop    %ebx
+  804957:	5e                   	pop    %esi
+  804958:	5f                   	pop    %edi
+  804959:	5d                   	pop    %ebp
+  80495a:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80495b:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804960:	eb ef                	jmp    804951 <devcons_write+0x5a>
+
+00804962 <devcons_read>:
+{
+  804962:	55                   	push   %ebp
+  804963:	89 e5                	mov    %esp,%ebp
+  804965:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  804968:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80496d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804971:	74 36                	je     8049a9 <devcons_read+0x47>
+	c = cons_peek;
+  804973:	a1 34 c0 80 00       	mov    0x80c034,%eax
+	cons_peek = 0;
+  804978:	c7 05 34 c0 80 00 00 	movl   $0x0,0x80c034
+  80497f:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804982:	85 c0                	test   %eax,%eax
+  804984:	75 10                	jne    804996 <devcons_read+0x34>
+  804986:	e8 b0 c5 ff ff       	call   800f3b <sys_cgetc>
+  80498b:	85 c0                	test   %eax,%eax
+  80498d:	75 07                	jne    804996 <devcons_read+0x34>
+		sys_yield();
+  80498f:	e8 26 c6 ff ff       	call   800fba <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804994:	eb f0                	jmp    804986 <devcons_read+0x24>
+	if (c < 0)
+  804996:	85 c0                	test   %eax,%eax
+  804998:	78 0f                	js     8049a9 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80499a:	83 f8 04             	cmp    $0x4,%eax
+  80499d:	74 0c                	je     8049ab <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80499f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8049a2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8049a4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8049a9:	c9                   	leave
+  8049aa:	c3                   	ret
+		return 0;
+  8049ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b0:	eb f7                	jmp    8049a9 <devcons_read+0x47>
+
+008049b2 <cputchar>:
+{
+  8049b2:	55                   	push   %ebp
+  8049b3:	89 e5                	mov    %esp,%ebp
+  8049b5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8049b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8049bb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8049be:	6a 01                	push   $0x1
+  8049c0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8049c3:	50                   	push   %eax
+  8049c4:	e8 54 c5 ff ff       	call   800f1d <sys_cputs>
+}
+  8049c9:	83 c4 10             	add    $0x10,%esp
+  8049cc:	c9                   	leave
+  8049cd:	c3                   	ret
+
+008049ce <getchar>:
+{
+  8049ce:	55                   	push   %ebp
+  8049cf:	89 e5                	mov    %esp,%ebp
+  8049d1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8049d4:	6a 01                	push   $0x1
+  8049d6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8049d9:	50                   	push   %eax
+  8049da:	6a 00                	push   $0x0
+  8049dc:	e8 d2 d4 ff ff       	call   801eb3 <read>
+	if (r < 0)
+  8049e1:	83 c4 10             	add    $0x10,%esp
+  8049e4:	85 c0                	test   %eax,%eax
+  8049e6:	78 06                	js     8049ee <getchar+0x20>
+	if (r < 1)
+  8049e8:	74 06                	je     8049f0 <getchar+0x22>
+	return c;
+  8049ea:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8049ee:	c9                   	leave
+  8049ef:	c3                   	ret
+		return -E_EOF;
+  8049f0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8049f5:	eb f7                	jmp    8049ee <getchar+0x20>
+
+008049f7 <iscons>:
+{
+  8049f7:	55                   	push   %ebp
+  8049f8:	89 e5                	mov    %esp,%ebp
+  8049fa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8049fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804a00:	50                   	push   %eax
+  804a01:	ff 75 08             	push   0x8(%ebp)
+  804a04:	e8 26 d2 ff ff       	call   801c2f <fd_lookup>
+  804a09:	83 c4 10             	add    $0x10,%esp
+  804a0c:	85 c0                	test   %eax,%eax
+  804a0e:	78 11                	js     804a21 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804a10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804a13:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  804a19:	39 10                	cmp    %edx,(%eax)
+  804a1b:	0f 94 c0             	sete   %al
+  804a1e:	0f b6 c0             	movzbl %al,%eax
+}
+  804a21:	c9                   	leave
+  804a22:	c3                   	ret
+
+00804a23 <opencons>:
+{
+  804a23:	55                   	push   %ebp
+  804a24:	89 e5                	mov    %esp,%ebp
+  804a26:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804a29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804a2c:	50                   	push   %eax
+  804a2d:	e8 ad d1 ff ff       	call   801bdf <fd_alloc>
+  804a32:	83 c4 10             	add    $0x10,%esp
+  804a35:	85 c0                	test   %eax,%eax
+  804a37:	78 3a                	js     804a73 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804a39:	83 ec 04             	sub    $0x4,%esp
+  804a3c:	68 07 04 00 00       	push   $0x407
+  804a41:	ff 75 f4             	push   -0xc(%ebp)
+  804a44:	6a 00                	push   $0x0
+  804a46:	e8 8e c5 ff ff       	call   800fd9 <sys_page_alloc>
+  804a4b:	83 c4 10             	add    $0x10,%esp
+  804a4e:	85 c0                	test   %eax,%eax
+  804a50:	78 21                	js     804a73 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804a52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804a55:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  804a5b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804a5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804a60:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804a67:	83 ec 0c             	sub    $0xc,%esp
+  804a6a:	50                   	push   %eax
+  804a6b:	e8 48 d1 ff ff       	call   801bb8 <fd2num>
+  804a70:	83 c4 10             	add    $0x10,%esp
+}
+  804a73:	c9                   	leave
+  804a74:	c3                   	ret
+
+00804a75 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804a75:	55                   	push   %ebp
+  804a76:	89 e5                	mov    %esp,%ebp
+  804a78:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804a7b:	83 3d 00 f0 80 00 00 	cmpl   $0x0,0x80f000
+  804a82:	74 0a                	je     804a8e <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804a84:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a87:	a3 00 f0 80 00       	mov    %eax,0x80f000
+}
+  804a8c:	c9                   	leave
+  804a8d:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804a8e:	83 ec 04             	sub    $0x4,%esp
+  804a91:	6a 07                	push   $0x7
+  804a93:	68 00 f0 bf ee       	push   $0xeebff000
+  804a98:	6a 00                	push   $0x0
+  804a9a:	e8 3a c5 ff ff       	call   800fd9 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804a9f:	83 c4 08             	add    $0x8,%esp
+  804aa2:	68 b3 4a 80 00       	push   $0x804ab3
+  804aa7:	6a 00                	push   $0x0
+  804aa9:	e8 76 c6 ff ff       	call   801124 <sys_env_set_pgfault_upcall>
+  804aae:	83 c4 10             	add    $0x10,%esp
+  804ab1:	eb d1                	jmp    804a84 <set_pgfault_handler+0xf>
+
+00804ab3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804ab3:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804ab4:	a1 00 f0 80 00       	mov    0x80f000,%eax
+	call *%eax
+  804ab9:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804abb:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804abe:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804ac2:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804ac5:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804ac9:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804acb:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804acf:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804ad2:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804ad3:	83 c4 04             	add    $0x4,%esp
+	popf
+  804ad6:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804ad7:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804ad8:	c3                   	ret
+
+00804ad9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804ad9:	55                   	push   %ebp
+  804ada:	89 e5                	mov    %esp,%ebp
+  804adc:	56                   	push   %esi
+  804add:	53                   	push   %ebx
+  804ade:	8b 75 08             	mov    0x8(%ebp),%esi
+  804ae1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804ae4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804ae7:	85 c0                	test   %eax,%eax
+  804ae9:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804aee:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804af1:	83 ec 0c             	sub    $0xc,%esp
+  804af4:	50                   	push   %eax
+  804af5:	e8 8f c6 ff ff       	call   801189 <sys_ipc_recv>
+  804afa:	83 c4 10             	add    $0x10,%esp
+  804afd:	85 c0                	test   %eax,%eax
+  804aff:	0f 88 8b 00 00 00    	js     804b90 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804b05:	85 f6                	test   %esi,%esi
+  804b07:	74 2a                	je     804b33 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804b09:	89 e2                	mov    %esp,%edx
+  804b0b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b10:	29 d0                	sub    %edx,%eax
+  804b12:	89 c2                	mov    %eax,%edx
+  804b14:	c1 ea 0f             	shr    $0xf,%edx
+  804b17:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b21:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804b24:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804b2b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804b31:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804b33:	85 db                	test   %ebx,%ebx
+  804b35:	74 2a                	je     804b61 <ipc_recv+0x88>
+  804b37:	89 e2                	mov    %esp,%edx
+  804b39:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b3e:	29 d0                	sub    %edx,%eax
+  804b40:	89 c2                	mov    %eax,%edx
+  804b42:	c1 ea 0f             	shr    $0xf,%edx
+  804b45:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b4f:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804b52:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804b59:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b5f:	89 03                	mov    %eax,(%ebx)
+  804b61:	89 e2                	mov    %esp,%edx
+  804b63:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b68:	29 d0                	sub    %edx,%eax
+  804b6a:	89 c2                	mov    %eax,%edx
+  804b6c:	c1 ea 0f             	shr    $0xf,%edx
+  804b6f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b79:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804b7c:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804b83:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804b89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804b8c:	5b                   	pop    %ebx
+  804b8d:	5e                   	pop    %esi
+  804b8e:	5d                   	pop    %ebp
+  804b8f:	c3                   	ret
+		if(from_env_store != NULL)
+  804b90:	85 f6                	test   %esi,%esi
+  804b92:	74 06                	je     804b9a <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804b94:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804b9a:	85 db                	test   %ebx,%ebx
+  804b9c:	74 eb                	je     804b89 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804b9e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804ba4:	eb e3                	jmp    804b89 <ipc_recv+0xb0>
+
+00804ba6 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804ba6:	55                   	push   %ebp
+  804ba7:	89 e5                	mov    %esp,%ebp
+  804ba9:	57                   	push   %edi
+  804baa:	56                   	push   %esi
+  804bab:	53                   	push   %ebx
+  804bac:	83 ec 14             	sub    $0x14,%esp
+  804baf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804bb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804bb5:	8b 75 14             	mov    0x14(%ebp),%esi
+  804bb8:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804bbb:	85 c0                	test   %eax,%eax
+  804bbd:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804bc2:	0f 44 c2             	cmove  %edx,%eax
+  804bc5:	ff 75 10             	push   0x10(%ebp)
+  804bc8:	50                   	push   %eax
+  804bc9:	e8 1d c6 ff ff       	call   8011eb <sys_ipc_recv_pages>
+  804bce:	83 c4 10             	add    $0x10,%esp
+  804bd1:	85 c0                	test   %eax,%eax
+  804bd3:	0f 88 ba 00 00 00    	js     804c93 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804bd9:	85 ff                	test   %edi,%edi
+  804bdb:	74 2a                	je     804c07 <ipc_recv_pages+0x61>
+  804bdd:	89 e2                	mov    %esp,%edx
+  804bdf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804be4:	29 d0                	sub    %edx,%eax
+  804be6:	89 c2                	mov    %eax,%edx
+  804be8:	c1 ea 0f             	shr    $0xf,%edx
+  804beb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bf5:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804bf8:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804bff:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804c05:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804c07:	85 f6                	test   %esi,%esi
+  804c09:	74 2a                	je     804c35 <ipc_recv_pages+0x8f>
+  804c0b:	89 e2                	mov    %esp,%edx
+  804c0d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804c12:	29 d0                	sub    %edx,%eax
+  804c14:	89 c2                	mov    %eax,%edx
+  804c16:	c1 ea 0f             	shr    $0xf,%edx
+  804c19:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c23:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804c26:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804c2d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804c33:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804c35:	85 db                	test   %ebx,%ebx
+  804c37:	74 2a                	je     804c63 <ipc_recv_pages+0xbd>
+  804c39:	89 e2                	mov    %esp,%edx
+  804c3b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804c40:	29 d0                	sub    %edx,%eax
+  804c42:	89 c2                	mov    %eax,%edx
+  804c44:	c1 ea 0f             	shr    $0xf,%edx
+  804c47:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c51:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804c54:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804c5b:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804c61:	89 03                	mov    %eax,(%ebx)
+  804c63:	89 e2                	mov    %esp,%edx
+  804c65:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804c6a:	29 d0                	sub    %edx,%eax
+  804c6c:	89 c2                	mov    %eax,%edx
+  804c6e:	c1 ea 0f             	shr    $0xf,%edx
+  804c71:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7b:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804c7e:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804c85:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804c8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c8e:	5b                   	pop    %ebx
+  804c8f:	5e                   	pop    %esi
+  804c90:	5f                   	pop    %edi
+  804c91:	5d                   	pop    %ebp
+  804c92:	c3                   	ret
+		if (from_env_store)
+  804c93:	85 ff                	test   %edi,%edi
+  804c95:	74 06                	je     804c9d <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804c97:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804c9d:	85 f6                	test   %esi,%esi
+  804c9f:	74 06                	je     804ca7 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804ca1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804ca7:	85 db                	test   %ebx,%ebx
+  804ca9:	74 e0                	je     804c8b <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804cab:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804cb1:	eb d8                	jmp    804c8b <ipc_recv_pages+0xe5>
+
+00804cb3 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804cb3:	55                   	push   %ebp
+  804cb4:	89 e5                	mov    %esp,%ebp
+  804cb6:	57                   	push   %edi
+  804cb7:	56                   	push   %esi
+  804cb8:	53                   	push   %ebx
+  804cb9:	83 ec 1c             	sub    $0x1c,%esp
+  804cbc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804cbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  804cc2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804cc8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804ccc:	75 2b                	jne    804cf9 <ipc_try_send_pages+0x46>
+  804cce:	89 e2                	mov    %esp,%edx
+  804cd0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804cd5:	29 d0                	sub    %edx,%eax
+  804cd7:	89 c2                	mov    %eax,%edx
+  804cd9:	c1 ea 0f             	shr    $0xf,%edx
+  804cdc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ce6:	0f 42 c2             	cmovb  %edx,%eax
+  804ce9:	8b 04 85 40 c0 80 00 	mov    0x80c040(,%eax,4),%eax
+  804cf0:	8b 70 48             	mov    0x48(%eax),%esi
+  804cf3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804cf9:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804cff:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804d04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804d07:	85 ff                	test   %edi,%edi
+  804d09:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804d0e:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804d11:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804d17:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804d1d:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804d23:	83 ec 0c             	sub    $0xc,%esp
+  804d26:	ff 75 14             	push   0x14(%ebp)
+  804d29:	ff 75 18             	push   0x18(%ebp)
+  804d2c:	57                   	push   %edi
+  804d2d:	ff 75 0c             	push   0xc(%ebp)
+  804d30:	ff 75 08             	push   0x8(%ebp)
+  804d33:	e8 92 c4 ff ff       	call   8011ca <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804d38:	83 c4 20             	add    $0x20,%esp
+  804d3b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804d3e:	75 21                	jne    804d61 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804d40:	83 ec 04             	sub    $0x4,%esp
+  804d43:	6a ff                	push   $0xffffffff
+  804d45:	53                   	push   %ebx
+  804d46:	ff 75 e4             	push   -0x1c(%ebp)
+  804d49:	e8 89 c6 ff ff       	call   8013d7 <sys_futex_wait>
+  804d4e:	83 c4 10             	add    $0x10,%esp
+  804d51:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804d54:	74 c7                	je     804d1d <ipc_try_send_pages+0x6a>
+  804d56:	85 c0                	test   %eax,%eax
+  804d58:	79 c3                	jns    804d1d <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804d5a:	e8 5b c2 ff ff       	call   800fba <sys_yield>
+  804d5f:	eb bc                	jmp    804d1d <ipc_try_send_pages+0x6a>
+	}
+}
+  804d61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d64:	5b                   	pop    %ebx
+  804d65:	5e                   	pop    %esi
+  804d66:	5f                   	pop    %edi
+  804d67:	5d                   	pop    %ebp
+  804d68:	c3                   	ret
+
+00804d69 <ipc_send>:
+{
+  804d69:	55                   	push   %ebp
+  804d6a:	89 e5                	mov    %esp,%ebp
+  804d6c:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804d6f:	ff 75 14             	push   0x14(%ebp)
+  804d72:	6a 01                	push   $0x1
+  804d74:	ff 75 10             	push   0x10(%ebp)
+  804d77:	ff 75 0c             	push   0xc(%ebp)
+  804d7a:	ff 75 08             	push   0x8(%ebp)
+  804d7d:	e8 31 ff ff ff       	call   804cb3 <ipc_try_send_pages>
+  804d82:	83 c4 20             	add    $0x20,%esp
+  804d85:	85 c0                	test   %eax,%eax
+  804d87:	78 02                	js     804d8b <ipc_send+0x22>
+}
+  804d89:	c9                   	leave
+  804d8a:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804d8b:	50                   	push   %eax
+  804d8c:	68 6d 57 80 00       	push   $0x80576d
+  804d91:	6a 3f                	push   $0x3f
+  804d93:	68 82 57 80 00       	push   $0x805782
+  804d98:	e8 36 b6 ff ff       	call   8003d3 <_panic>
+
+00804d9d <ipc_send_pages>:
+{
+  804d9d:	55                   	push   %ebp
+  804d9e:	89 e5                	mov    %esp,%ebp
+  804da0:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  804da3:	ff 75 18             	push   0x18(%ebp)
+  804da6:	ff 75 14             	push   0x14(%ebp)
+  804da9:	ff 75 10             	push   0x10(%ebp)
+  804dac:	ff 75 0c             	push   0xc(%ebp)
+  804daf:	ff 75 08             	push   0x8(%ebp)
+  804db2:	e8 fc fe ff ff       	call   804cb3 <ipc_try_send_pages>
+  804db7:	83 c4 20             	add    $0x20,%esp
+  804dba:	85 c0                	test   %eax,%eax
+  804dbc:	78 02                	js     804dc0 <ipc_send_pages+0x23>
+}
+  804dbe:	c9                   	leave
+  804dbf:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804dc0:	50                   	push   %eax
+  804dc1:	68 8c 57 80 00       	push   $0x80578c
+  804dc6:	6a 64                	push   $0x64
+  804dc8:	68 82 57 80 00       	push   $0x805782
+  804dcd:	e8 01 b6 ff ff       	call   8003d3 <_panic>
+
+00804dd2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804dd2:	55                   	push   %ebp
+  804dd3:	89 e5                	mov    %esp,%ebp
+  804dd5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804ddd:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804de3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804de9:	8b 52 50             	mov    0x50(%edx),%edx
+  804dec:	39 ca                	cmp    %ecx,%edx
+  804dee:	74 11                	je     804e01 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804df0:	83 c0 01             	add    $0x1,%eax
+  804df3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804df8:	75 e3                	jne    804ddd <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dff:	eb 0e                	jmp    804e0f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804e01:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804e07:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804e0c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804e0f:	5d                   	pop    %ebp
+  804e10:	c3                   	ret
+
+00804e11 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804e11:	55                   	push   %ebp
+  804e12:	89 e5                	mov    %esp,%ebp
+  804e14:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804e17:	89 c2                	mov    %eax,%edx
+  804e19:	c1 ea 16             	shr    $0x16,%edx
+  804e1c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804e23:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804e28:	f6 c1 01             	test   $0x1,%cl
+  804e2b:	74 1e                	je     804e4b <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804e2d:	c1 e8 0c             	shr    $0xc,%eax
+  804e30:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804e37:	a8 01                	test   $0x1,%al
+  804e39:	74 10                	je     804e4b <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804e3b:	c1 e8 0c             	shr    $0xc,%eax
+  804e3e:	c1 e0 04             	shl    $0x4,%eax
+  804e41:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804e48:	0f b7 d2             	movzwl %dx,%edx
+}
+  804e4b:	89 d0                	mov    %edx,%eax
+  804e4d:	5d                   	pop    %ebp
+  804e4e:	c3                   	ret
+
+00804e4f <__udivdi3>:
+  804e4f:	57                   	push   %edi
+  804e50:	56                   	push   %esi
+  804e51:	53                   	push   %ebx
+  804e52:	83 ec 20             	sub    $0x20,%esp
+  804e55:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804e59:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804e5d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804e61:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804e65:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804e69:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804e6d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804e71:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804e75:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e84:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804e8b:	00 
+  804e8c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804e93:	00 
+  804e94:	eb 08                	jmp    804e9e <__udivdi3+0x4f>
+  804e96:	83 e9 01             	sub    $0x1,%ecx
+  804e99:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804e9c:	74 68                	je     804f06 <__udivdi3+0xb7>
+  804e9e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804ea2:	01 c0                	add    %eax,%eax
+  804ea4:	89 c6                	mov    %eax,%esi
+  804ea6:	89 d7                	mov    %edx,%edi
+  804ea8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804eac:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804eb0:	0f ad d0             	shrd   %cl,%edx,%eax
+  804eb3:	d3 ea                	shr    %cl,%edx
+  804eb5:	f6 c1 20             	test   $0x20,%cl
+  804eb8:	74 04                	je     804ebe <__udivdi3+0x6f>
+  804eba:	89 d0                	mov    %edx,%eax
+  804ebc:	31 d2                	xor    %edx,%edx
+  804ebe:	83 e0 01             	and    $0x1,%eax
+  804ec1:	89 04 24             	mov    %eax,(%esp)
+  804ec4:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804ecb:	00 
+  804ecc:	8b 04 24             	mov    (%esp),%eax
+  804ecf:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804ed3:	09 f0                	or     %esi,%eax
+  804ed5:	09 fa                	or     %edi,%edx
+  804ed7:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804edb:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804edf:	39 f0                	cmp    %esi,%eax
+  804ee1:	89 d3                	mov    %edx,%ebx
+  804ee3:	19 fb                	sbb    %edi,%ebx
+  804ee5:	72 af                	jb     804e96 <__udivdi3+0x47>
+  804ee7:	29 f0                	sub    %esi,%eax
+  804ee9:	19 fa                	sbb    %edi,%edx
+  804eeb:	89 cf                	mov    %ecx,%edi
+  804eed:	c1 ef 05             	shr    $0x5,%edi
+  804ef0:	83 e7 01             	and    $0x1,%edi
+  804ef3:	89 fe                	mov    %edi,%esi
+  804ef5:	83 f6 01             	xor    $0x1,%esi
+  804ef8:	d3 e6                	shl    %cl,%esi
+  804efa:	d3 e7                	shl    %cl,%edi
+  804efc:	09 74 24 18          	or     %esi,0x18(%esp)
+  804f00:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804f04:	eb 90                	jmp    804e96 <__udivdi3+0x47>
+  804f06:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804f0a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804f0e:	83 c4 20             	add    $0x20,%esp
+  804f11:	5b                   	pop    %ebx
+  804f12:	5e                   	pop    %esi
+  804f13:	5f                   	pop    %edi
+  804f14:	c3                   	ret
+
+00804f15 <__umoddi3>:
+  804f15:	57                   	push   %edi
+  804f16:	56                   	push   %esi
+  804f17:	53                   	push   %ebx
+  804f18:	83 ec 08             	sub    $0x8,%esp
+  804f1b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804f1f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804f23:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804f27:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804f2b:	57                   	push   %edi
+  804f2c:	56                   	push   %esi
+  804f2d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804f31:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804f35:	52                   	push   %edx
+  804f36:	50                   	push   %eax
+  804f37:	e8 13 ff ff ff       	call   804e4f <__udivdi3>
+  804f3c:	89 c3                	mov    %eax,%ebx
+  804f3e:	0f af d6             	imul   %esi,%edx
+  804f41:	89 f9                	mov    %edi,%ecx
+  804f43:	0f af cb             	imul   %ebx,%ecx
+  804f46:	01 d1                	add    %edx,%ecx
+  804f48:	89 d8                	mov    %ebx,%eax
+  804f4a:	f7 e6                	mul    %esi
+  804f4c:	89 c6                	mov    %eax,%esi
+  804f4e:	89 d7                	mov    %edx,%edi
+  804f50:	01 cf                	add    %ecx,%edi
+  804f52:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804f56:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804f5a:	29 f0                	sub    %esi,%eax
+  804f5c:	19 fa                	sbb    %edi,%edx
+  804f5e:	83 c4 18             	add    $0x18,%esp
+  804f61:	5b                   	pop    %ebx
+  804f62:	5e                   	pop    %esi
+  804f63:	5f                   	pop    %edi
+  804f64:	c3                   	ret
+
+00804f65 <__divdi3>:
+  804f65:	53                   	push   %ebx
+  804f66:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804f6a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804f6e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804f72:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804f76:	85 d2                	test   %edx,%edx
+  804f78:	78 12                	js     804f8c <__divdi3+0x27>
+  804f7a:	85 db                	test   %ebx,%ebx
+  804f7c:	78 2e                	js     804fac <__divdi3+0x47>
+  804f7e:	53                   	push   %ebx
+  804f7f:	51                   	push   %ecx
+  804f80:	52                   	push   %edx
+  804f81:	50                   	push   %eax
+  804f82:	e8 c8 fe ff ff       	call   804e4f <__udivdi3>
+  804f87:	83 c4 10             	add    $0x10,%esp
+  804f8a:	eb 1e                	jmp    804faa <__divdi3+0x45>
+  804f8c:	f7 d8                	neg    %eax
+  804f8e:	83 d2 00             	adc    $0x0,%edx
+  804f91:	f7 da                	neg    %edx
+  804f93:	85 db                	test   %ebx,%ebx
+  804f95:	78 2a                	js     804fc1 <__divdi3+0x5c>
+  804f97:	53                   	push   %ebx
+  804f98:	51                   	push   %ecx
+  804f99:	52                   	push   %edx
+  804f9a:	50                   	push   %eax
+  804f9b:	e8 af fe ff ff       	call   804e4f <__udivdi3>
+  804fa0:	83 c4 10             	add    $0x10,%esp
+  804fa3:	f7 d8                	neg    %eax
+  804fa5:	83 d2 00             	adc    $0x0,%edx
+  804fa8:	f7 da                	neg    %edx
+  804faa:	5b                   	pop    %ebx
+  804fab:	c3                   	ret
+  804fac:	f7 d9                	neg    %ecx
+  804fae:	83 d3 00             	adc    $0x0,%ebx
+  804fb1:	f7 db                	neg    %ebx
+  804fb3:	53                   	push   %ebx
+  804fb4:	51                   	push   %ecx
+  804fb5:	52                   	push   %edx
+  804fb6:	50                   	push   %eax
+  804fb7:	e8 93 fe ff ff       	call   804e4f <__udivdi3>
+  804fbc:	83 c4 10             	add    $0x10,%esp
+  804fbf:	eb e2                	jmp    804fa3 <__divdi3+0x3e>
+  804fc1:	f7 d9                	neg    %ecx
+  804fc3:	83 d3 00             	adc    $0x0,%ebx
+  804fc6:	f7 db                	neg    %ebx
+  804fc8:	53                   	push   %ebx
+  804fc9:	51                   	push   %ecx
+  804fca:	52                   	push   %edx
+  804fcb:	50                   	push   %eax
+  804fcc:	e8 7e fe ff ff       	call   804e4f <__udivdi3>
+  804fd1:	83 c4 10             	add    $0x10,%esp
+  804fd4:	eb d4                	jmp    804faa <__divdi3+0x45>
+
+00804fd6 <__moddi3>:
+  804fd6:	57                   	push   %edi
+  804fd7:	56                   	push   %esi
+  804fd8:	53                   	push   %ebx
+  804fd9:	83 ec 08             	sub    $0x8,%esp
+  804fdc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804fe0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804fe4:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804fe8:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804fec:	57                   	push   %edi
+  804fed:	56                   	push   %esi
+  804fee:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804ff2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804ff6:	52                   	push   %edx
+  804ff7:	50                   	push   %eax
+  804ff8:	e8 68 ff ff ff       	call   804f65 <__divdi3>
+  804ffd:	89 c3                	mov    %eax,%ebx
+  804fff:	0f af d6             	imul   %esi,%edx
+  805002:	89 f9                	mov    %edi,%ecx
+  805004:	0f af cb             	imul   %ebx,%ecx
+  805007:	01 d1                	add    %edx,%ecx
+  805009:	89 d8                	mov    %ebx,%eax
+  80500b:	f7 e6                	mul    %esi
+  80500d:	89 c6                	mov    %eax,%esi
+  80500f:	89 d7                	mov    %edx,%edi
+  805011:	01 cf                	add    %ecx,%edi
+  805013:	8b 44 24 10          	mov    0x10(%esp),%eax
+  805017:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80501b:	29 f0                	sub    %esi,%eax
+  80501d:	19 fa                	sbb    %edi,%edx
+  80501f:	83 c4 18             	add    $0x18,%esp
+  805022:	5b                   	pop    %ebx
+  805023:	5e                   	pop    %esi
+  805024:	5f                   	pop    %edi
+  805025:	c3                   	ret
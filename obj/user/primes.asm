@@ -0,0 +1,9081 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e3 00 00 00       	call   800114 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003e:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800041:	83 ec 04             	sub    $0x4,%esp
+  800044:	6a 00                	push   $0x0
+  800046:	6a 00                	push   $0x0
+  800048:	57                   	push   %edi
+  800049:	e8 52 19 00 00       	call   8019a0 <ipc_recv>
+  80004e:	89 c3                	mov    %eax,%ebx
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800050:	89 e0                	mov    %esp,%eax
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800052:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800057:	29 c2                	sub    %eax,%edx
+
+	return slot < NTHREADS ? slot : 0;
+  800059:	83 c4 0c             	add    $0xc,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80005c:	89 d0                	mov    %edx,%eax
+  80005e:	c1 e8 0f             	shr    $0xf,%eax
+  800061:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800067:	ba 00 00 00 00       	mov    $0x0,%edx
+  80006c:	0f 43 c2             	cmovae %edx,%eax
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80006f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  800076:	8b 40 68             	mov    0x68(%eax),%eax
+  800079:	53                   	push   %ebx
+  80007a:	50                   	push   %eax
+  80007b:	68 c0 44 80 00       	push   $0x8044c0
+  800080:	e8 11 02 00 00       	call   800296 <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  800085:	e8 3f 13 00 00       	call   8013c9 <fork>
+  80008a:	89 c6                	mov    %eax,%esi
+  80008c:	83 c4 10             	add    $0x10,%esp
+  80008f:	85 c0                	test   %eax,%eax
+  800091:	78 2e                	js     8000c1 <primeproc+0x8c>
+		panic("fork: %e", id);
+	if (id == 0)
+  800093:	74 ac                	je     800041 <primeproc+0xc>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  800095:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800098:	83 ec 04             	sub    $0x4,%esp
+  80009b:	6a 00                	push   $0x0
+  80009d:	6a 00                	push   $0x0
+  80009f:	57                   	push   %edi
+  8000a0:	e8 fb 18 00 00       	call   8019a0 <ipc_recv>
+  8000a5:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  8000a7:	99                   	cltd
+  8000a8:	f7 fb                	idiv   %ebx
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  8000ad:	85 d2                	test   %edx,%edx
+  8000af:	74 e7                	je     800098 <primeproc+0x63>
+			ipc_send(id, i, 0, 0);
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	6a 00                	push   $0x0
+  8000b5:	51                   	push   %ecx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 74 1b 00 00       	call   801c30 <ipc_send>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	eb d7                	jmp    800098 <primeproc+0x63>
+		panic("fork: %e", id);
+  8000c1:	50                   	push   %eax
+  8000c2:	68 dd 48 80 00       	push   $0x8048dd
+  8000c7:	6a 1a                	push   $0x1a
+  8000c9:	68 cc 44 80 00       	push   $0x8044cc
+  8000ce:	e8 e8 00 00 00       	call   8001bb <_panic>
+
+008000d3 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	56                   	push   %esi
+  8000d7:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000d8:	e8 ec 12 00 00       	call   8013c9 <fork>
+  8000dd:	89 c6                	mov    %eax,%esi
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 1a                	js     8000fd <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000e3:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000e8:	74 25                	je     80010f <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000ea:	6a 00                	push   $0x0
+  8000ec:	6a 00                	push   $0x0
+  8000ee:	53                   	push   %ebx
+  8000ef:	56                   	push   %esi
+  8000f0:	e8 3b 1b 00 00       	call   801c30 <ipc_send>
+	for (i = 2; ; i++)
+  8000f5:	83 c3 01             	add    $0x1,%ebx
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	eb ed                	jmp    8000ea <umain+0x17>
+		panic("fork: %e", id);
+  8000fd:	50                   	push   %eax
+  8000fe:	68 dd 48 80 00       	push   $0x8048dd
+  800103:	6a 2d                	push   $0x2d
+  800105:	68 cc 44 80 00       	push   $0x8044cc
+  80010a:	e8 ac 00 00 00       	call   8001bb <_panic>
+		primeproc();
+  80010f:	e8 21 ff ff ff       	call   800035 <primeproc>
+
+00800114 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800114:	55                   	push   %ebp
+  800115:	89 e5                	mov    %esp,%ebp
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80011c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80011f:	89 e2                	mov    %esp,%edx
+  800121:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800126:	29 d0                	sub    %edx,%eax
+  800128:	89 c2                	mov    %eax,%edx
+  80012a:	c1 ea 0f             	shr    $0xf,%edx
+  80012d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80013a:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  800141:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800145:	e8 39 0c 00 00       	call   800d83 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80014a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80014f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800155:	89 e1                	mov    %esp,%ecx
+  800157:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80015c:	29 ca                	sub    %ecx,%edx
+  80015e:	89 d1                	mov    %edx,%ecx
+  800160:	c1 e9 0f             	shr    $0xf,%ecx
+  800163:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800169:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016e:	0f 42 d1             	cmovb  %ecx,%edx
+  800171:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800176:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80017d:	85 db                	test   %ebx,%ebx
+  80017f:	7e 07                	jle    800188 <libmain+0x74>
+		binaryname = argv[0];
+  800181:	8b 06                	mov    (%esi),%eax
+  800183:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800188:	83 ec 08             	sub    $0x8,%esp
+  80018b:	56                   	push   %esi
+  80018c:	53                   	push   %ebx
+  80018d:	e8 41 ff ff ff       	call   8000d3 <umain>
+
+	// exit gracefully
+	exit();
+  800192:	e8 0a 00 00 00       	call   8001a1 <exit>
+}
+  800197:	83 c4 10             	add    $0x10,%esp
+  80019a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80019d:	5b                   	pop    %ebx
+  80019e:	5e                   	pop    %esi
+  80019f:	5d                   	pop    %ebp
+  8001a0:	c3                   	ret
+
+008001a1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a1:	55                   	push   %ebp
+  8001a2:	89 e5                	mov    %esp,%ebp
+  8001a4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001a7:	e8 15 1d 00 00       	call   801ec1 <close_all>
+	sys_env_destroy(0);
+  8001ac:	83 ec 0c             	sub    $0xc,%esp
+  8001af:	6a 00                	push   $0x0
+  8001b1:	e8 8c 0b 00 00       	call   800d42 <sys_env_destroy>
+}
+  8001b6:	83 c4 10             	add    $0x10,%esp
+  8001b9:	c9                   	leave
+  8001ba:	c3                   	ret
+
+008001bb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001bb:	55                   	push   %ebp
+  8001bc:	89 e5                	mov    %esp,%ebp
+  8001be:	56                   	push   %esi
+  8001bf:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001c0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001c3:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001c9:	e8 b5 0b 00 00       	call   800d83 <sys_getenvid>
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	ff 75 0c             	push   0xc(%ebp)
+  8001d4:	ff 75 08             	push   0x8(%ebp)
+  8001d7:	56                   	push   %esi
+  8001d8:	50                   	push   %eax
+  8001d9:	68 e4 44 80 00       	push   $0x8044e4
+  8001de:	e8 b3 00 00 00       	call   800296 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001e3:	83 c4 18             	add    $0x18,%esp
+  8001e6:	53                   	push   %ebx
+  8001e7:	ff 75 10             	push   0x10(%ebp)
+  8001ea:	e8 56 00 00 00       	call   800245 <vcprintf>
+	cprintf("\n");
+  8001ef:	c7 04 24 a4 4a 80 00 	movl   $0x804aa4,(%esp)
+  8001f6:	e8 9b 00 00 00       	call   800296 <cprintf>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001fe:	cc                   	int3
+	while (1)
+  8001ff:	eb fd                	jmp    8001fe <_panic+0x43>
+
+00800201 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	53                   	push   %ebx
+  800205:	83 ec 04             	sub    $0x4,%esp
+  800208:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80020b:	8b 13                	mov    (%ebx),%edx
+  80020d:	8d 42 01             	lea    0x1(%edx),%eax
+  800210:	89 03                	mov    %eax,(%ebx)
+  800212:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800215:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800219:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80021e:	74 09                	je     800229 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800220:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800224:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800227:	c9                   	leave
+  800228:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800229:	83 ec 08             	sub    $0x8,%esp
+  80022c:	68 ff 00 00 00       	push   $0xff
+  800231:	8d 43 08             	lea    0x8(%ebx),%eax
+  800234:	50                   	push   %eax
+  800235:	e8 cb 0a 00 00       	call   800d05 <sys_cputs>
+		b->idx = 0;
+  80023a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800240:	83 c4 10             	add    $0x10,%esp
+  800243:	eb db                	jmp    800220 <putch+0x1f>
+
+00800245 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800245:	55                   	push   %ebp
+  800246:	89 e5                	mov    %esp,%ebp
+  800248:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80024e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800255:	00 00 00 
+	b.cnt = 0;
+  800258:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80025f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800262:	ff 75 0c             	push   0xc(%ebp)
+  800265:	ff 75 08             	push   0x8(%ebp)
+  800268:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80026e:	50                   	push   %eax
+  80026f:	68 01 02 80 00       	push   $0x800201
+  800274:	e8 1c 01 00 00       	call   800395 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800282:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800288:	50                   	push   %eax
+  800289:	e8 77 0a 00 00       	call   800d05 <sys_cputs>
+
+	return b.cnt;
+}
+  80028e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800294:	c9                   	leave
+  800295:	c3                   	ret
+
+00800296 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800296:	55                   	push   %ebp
+  800297:	89 e5                	mov    %esp,%ebp
+  800299:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80029c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80029f:	50                   	push   %eax
+  8002a0:	ff 75 08             	push   0x8(%ebp)
+  8002a3:	e8 9d ff ff ff       	call   800245 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002a8:	c9                   	leave
+  8002a9:	c3                   	ret
+
+008002aa <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002aa:	55                   	push   %ebp
+  8002ab:	89 e5                	mov    %esp,%ebp
+  8002ad:	57                   	push   %edi
+  8002ae:	56                   	push   %esi
+  8002af:	53                   	push   %ebx
+  8002b0:	83 ec 1c             	sub    $0x1c,%esp
+  8002b3:	89 c3                	mov    %eax,%ebx
+  8002b5:	89 d6                	mov    %edx,%esi
+  8002b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	89 d1                	mov    %edx,%ecx
+  8002bf:	89 c2                	mov    %eax,%edx
+  8002c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002c7:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002cd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002d4:	39 c2                	cmp    %eax,%edx
+  8002d6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002d9:	73 4b                	jae    800326 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8002db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002de:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8002e1:	85 ff                	test   %edi,%edi
+  8002e3:	7e 11                	jle    8002f6 <printnum+0x4c>
+			putch(padc, putdat);
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	56                   	push   %esi
+  8002e9:	ff 75 18             	push   0x18(%ebp)
+  8002ec:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8002ee:	83 c4 10             	add    $0x10,%esp
+  8002f1:	83 ef 01             	sub    $0x1,%edi
+  8002f4:	75 ef                	jne    8002e5 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002f6:	83 ec 08             	sub    $0x8,%esp
+  8002f9:	56                   	push   %esi
+  8002fa:	83 ec 04             	sub    $0x4,%esp
+  8002fd:	ff 75 e4             	push   -0x1c(%ebp)
+  800300:	ff 75 e0             	push   -0x20(%ebp)
+  800303:	ff 75 dc             	push   -0x24(%ebp)
+  800306:	ff 75 d8             	push   -0x28(%ebp)
+  800309:	e8 8d 40 00 00       	call   80439b <__umoddi3>
+  80030e:	83 c4 14             	add    $0x14,%esp
+  800311:	0f be 80 07 45 80 00 	movsbl 0x804507(%eax),%eax
+  800318:	50                   	push   %eax
+  800319:	ff d3                	call   *%ebx
+}
+  80031b:	83 c4 10             	add    $0x10,%esp
+  80031e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800321:	5b                   	pop    %ebx
+  800322:	5e                   	pop    %esi
+  800323:	5f                   	pop    %edi
+  800324:	5d                   	pop    %ebp
+  800325:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	ff 75 18             	push   0x18(%ebp)
+  80032c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80032f:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800332:	52                   	push   %edx
+  800333:	50                   	push   %eax
+  800334:	83 ec 08             	sub    $0x8,%esp
+  800337:	ff 75 e4             	push   -0x1c(%ebp)
+  80033a:	ff 75 e0             	push   -0x20(%ebp)
+  80033d:	ff 75 dc             	push   -0x24(%ebp)
+  800340:	ff 75 d8             	push   -0x28(%ebp)
+  800343:	e8 8d 3f 00 00       	call   8042d5 <__udivdi3>
+  800348:	83 c4 18             	add    $0x18,%esp
+  80034b:	52                   	push   %edx
+  80034c:	50                   	push   %eax
+  80034d:	89 f2                	mov    %esi,%edx
+  80034f:	89 d8                	mov    %ebx,%eax
+  800351:	e8 54 ff ff ff       	call   8002aa <printnum>
+  800356:	83 c4 20             	add    $0x20,%esp
+  800359:	eb 9b                	jmp    8002f6 <printnum+0x4c>
+
+0080035b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80035b:	55                   	push   %ebp
+  80035c:	89 e5                	mov    %esp,%ebp
+  80035e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800361:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800365:	8b 10                	mov    (%eax),%edx
+  800367:	3b 50 04             	cmp    0x4(%eax),%edx
+  80036a:	73 0a                	jae    800376 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80036c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80036f:	89 08                	mov    %ecx,(%eax)
+  800371:	8b 45 08             	mov    0x8(%ebp),%eax
+  800374:	88 02                	mov    %al,(%edx)
+}
+  800376:	5d                   	pop    %ebp
+  800377:	c3                   	ret
+
+00800378 <printfmt>:
+{
+  800378:	55                   	push   %ebp
+  800379:	89 e5                	mov    %esp,%ebp
+  80037b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80037e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800381:	50                   	push   %eax
+  800382:	ff 75 10             	push   0x10(%ebp)
+  800385:	ff 75 0c             	push   0xc(%ebp)
+  800388:	ff 75 08             	push   0x8(%ebp)
+  80038b:	e8 05 00 00 00       	call   800395 <vprintfmt>
+}
+  800390:	83 c4 10             	add    $0x10,%esp
+  800393:	c9                   	leave
+  800394:	c3                   	ret
+
+00800395 <vprintfmt>:
+{
+  800395:	55                   	push   %ebp
+  800396:	89 e5                	mov    %esp,%ebp
+  800398:	57                   	push   %edi
+  800399:	56                   	push   %esi
+  80039a:	53                   	push   %ebx
+  80039b:	83 ec 2c             	sub    $0x2c,%esp
+  80039e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003a1:	89 df                	mov    %ebx,%edi
+  8003a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a9:	8d 70 01             	lea    0x1(%eax),%esi
+  8003ac:	0f b6 00             	movzbl (%eax),%eax
+  8003af:	83 f8 25             	cmp    $0x25,%eax
+  8003b2:	74 1e                	je     8003d2 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8003b4:	85 c0                	test   %eax,%eax
+  8003b6:	0f 84 15 05 00 00    	je     8008d1 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8003bc:	83 ec 08             	sub    $0x8,%esp
+  8003bf:	53                   	push   %ebx
+  8003c0:	50                   	push   %eax
+  8003c1:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003c3:	83 c6 01             	add    $0x1,%esi
+  8003c6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003ca:	83 c4 10             	add    $0x10,%esp
+  8003cd:	83 f8 25             	cmp    $0x25,%eax
+  8003d0:	75 e2                	jne    8003b4 <vprintfmt+0x1f>
+		padc = ' ';
+  8003d2:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8003d6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003dd:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8003e4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8003eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003f0:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	8d 56 01             	lea    0x1(%esi),%edx
+  8003f6:	0f b6 0e             	movzbl (%esi),%ecx
+  8003f9:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003fc:	3c 55                	cmp    $0x55,%al
+  8003fe:	0f 87 3b 04 00 00    	ja     80083f <vprintfmt+0x4aa>
+  800404:	0f b6 c0             	movzbl %al,%eax
+  800407:	ff 24 85 80 46 80 00 	jmp    *0x804680(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80040e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800411:	eb 93                	jmp    8003a6 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800413:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800415:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800419:	eb d8                	jmp    8003f3 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80041b:	89 d6                	mov    %edx,%esi
+  80041d:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800421:	eb d0                	jmp    8003f3 <vprintfmt+0x5e>
+  800423:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800426:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800429:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80042c:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800430:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800433:	83 f9 09             	cmp    $0x9,%ecx
+  800436:	77 6f                	ja     8004a7 <vprintfmt+0x112>
+  800438:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80043b:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80043e:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800441:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800445:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800448:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80044b:	83 fe 09             	cmp    $0x9,%esi
+  80044e:	76 eb                	jbe    80043b <vprintfmt+0xa6>
+  800450:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800453:	89 d6                	mov    %edx,%esi
+  800455:	eb 13                	jmp    80046a <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800457:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045a:	8b 00                	mov    (%eax),%eax
+  80045c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80045f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800462:	8d 40 04             	lea    0x4(%eax),%eax
+  800465:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800468:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80046a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80046e:	79 83                	jns    8003f3 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800470:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800473:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800476:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80047d:	e9 71 ff ff ff       	jmp    8003f3 <vprintfmt+0x5e>
+			if (width < 0)
+  800482:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800485:	85 c9                	test   %ecx,%ecx
+  800487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048c:	0f 49 c1             	cmovns %ecx,%eax
+  80048f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800492:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800494:	e9 5a ff ff ff       	jmp    8003f3 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800499:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80049b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004a2:	e9 4c ff ff ff       	jmp    8003f3 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a7:	89 d6                	mov    %edx,%esi
+  8004a9:	eb bf                	jmp    80046a <vprintfmt+0xd5>
+			lflag++;
+  8004ab:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004af:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004b1:	e9 3d ff ff ff       	jmp    8003f3 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8004b6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bc:	8d 70 04             	lea    0x4(%eax),%esi
+  8004bf:	83 ec 08             	sub    $0x8,%esp
+  8004c2:	53                   	push   %ebx
+  8004c3:	ff 30                	push   (%eax)
+  8004c5:	ff d7                	call   *%edi
+			break;
+  8004c7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ca:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8004cd:	e9 d4 fe ff ff       	jmp    8003a6 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8004d2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8004db:	8b 10                	mov    (%eax),%edx
+  8004dd:	89 d0                	mov    %edx,%eax
+  8004df:	f7 d8                	neg    %eax
+  8004e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004e4:	83 f8 12             	cmp    $0x12,%eax
+  8004e7:	7f 23                	jg     80050c <vprintfmt+0x177>
+  8004e9:	8b 14 85 e0 47 80 00 	mov    0x8047e0(,%eax,4),%edx
+  8004f0:	85 d2                	test   %edx,%edx
+  8004f2:	74 18                	je     80050c <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8004f4:	52                   	push   %edx
+  8004f5:	68 6f 4a 80 00       	push   $0x804a6f
+  8004fa:	53                   	push   %ebx
+  8004fb:	57                   	push   %edi
+  8004fc:	e8 77 fe ff ff       	call   800378 <printfmt>
+  800501:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800504:	89 75 14             	mov    %esi,0x14(%ebp)
+  800507:	e9 9a fe ff ff       	jmp    8003a6 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80050c:	50                   	push   %eax
+  80050d:	68 1f 45 80 00       	push   $0x80451f
+  800512:	53                   	push   %ebx
+  800513:	57                   	push   %edi
+  800514:	e8 5f fe ff ff       	call   800378 <printfmt>
+  800519:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051c:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80051f:	e9 82 fe ff ff       	jmp    8003a6 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800524:	89 55 10             	mov    %edx,0x10(%ebp)
+  800527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052a:	83 c0 04             	add    $0x4,%eax
+  80052d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8b 00                	mov    (%eax),%eax
+  800535:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800538:	85 c0                	test   %eax,%eax
+  80053a:	0f 84 61 03 00 00    	je     8008a1 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800540:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800544:	7e 06                	jle    80054c <vprintfmt+0x1b7>
+  800546:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80054a:	75 29                	jne    800575 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80054c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80054f:	8d 70 01             	lea    0x1(%eax),%esi
+  800552:	0f b6 00             	movzbl (%eax),%eax
+  800555:	0f be d0             	movsbl %al,%edx
+  800558:	85 d2                	test   %edx,%edx
+  80055a:	0f 84 bb 00 00 00    	je     80061b <vprintfmt+0x286>
+  800560:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800563:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800566:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800569:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80056c:	eb 7a                	jmp    8005e8 <vprintfmt+0x253>
+				p = "(null)";
+  80056e:	c7 45 d0 18 45 80 00 	movl   $0x804518,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800575:	83 ec 08             	sub    $0x8,%esp
+  800578:	ff 75 d4             	push   -0x2c(%ebp)
+  80057b:	ff 75 d0             	push   -0x30(%ebp)
+  80057e:	e8 e0 03 00 00       	call   800963 <strnlen>
+  800583:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800586:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800589:	83 c4 10             	add    $0x10,%esp
+  80058c:	85 d2                	test   %edx,%edx
+  80058e:	0f 8e d6 02 00 00    	jle    80086a <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800594:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800598:	83 ec 08             	sub    $0x8,%esp
+  80059b:	53                   	push   %ebx
+  80059c:	56                   	push   %esi
+  80059d:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059f:	83 c4 10             	add    $0x10,%esp
+  8005a2:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8005a6:	75 f0                	jne    800598 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005a8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ab:	8d 70 01             	lea    0x1(%eax),%esi
+  8005ae:	0f b6 00             	movzbl (%eax),%eax
+  8005b1:	0f be d0             	movsbl %al,%edx
+  8005b4:	85 d2                	test   %edx,%edx
+  8005b6:	0f 84 da 02 00 00    	je     800896 <vprintfmt+0x501>
+  8005bc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005bf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005c2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005c5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005c8:	eb 1e                	jmp    8005e8 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8005ca:	83 ec 08             	sub    $0x8,%esp
+  8005cd:	ff 75 0c             	push   0xc(%ebp)
+  8005d0:	52                   	push   %edx
+  8005d1:	ff 55 08             	call   *0x8(%ebp)
+  8005d4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005d7:	83 eb 01             	sub    $0x1,%ebx
+  8005da:	83 c6 01             	add    $0x1,%esi
+  8005dd:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005e1:	0f be d0             	movsbl %al,%edx
+  8005e4:	85 d2                	test   %edx,%edx
+  8005e6:	74 2a                	je     800612 <vprintfmt+0x27d>
+  8005e8:	85 ff                	test   %edi,%edi
+  8005ea:	78 05                	js     8005f1 <vprintfmt+0x25c>
+  8005ec:	83 ef 01             	sub    $0x1,%edi
+  8005ef:	78 59                	js     80064a <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005f1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005f5:	74 d3                	je     8005ca <vprintfmt+0x235>
+  8005f7:	0f be c0             	movsbl %al,%eax
+  8005fa:	83 e8 20             	sub    $0x20,%eax
+  8005fd:	83 f8 5e             	cmp    $0x5e,%eax
+  800600:	76 c8                	jbe    8005ca <vprintfmt+0x235>
+					putch('?', putdat);
+  800602:	83 ec 08             	sub    $0x8,%esp
+  800605:	ff 75 0c             	push   0xc(%ebp)
+  800608:	6a 3f                	push   $0x3f
+  80060a:	ff 55 08             	call   *0x8(%ebp)
+  80060d:	83 c4 10             	add    $0x10,%esp
+  800610:	eb c5                	jmp    8005d7 <vprintfmt+0x242>
+  800612:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800615:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800618:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80061b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80061e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800622:	7e 1b                	jle    80063f <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	53                   	push   %ebx
+  800628:	6a 20                	push   $0x20
+  80062a:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80062c:	83 c4 10             	add    $0x10,%esp
+  80062f:	83 ee 01             	sub    $0x1,%esi
+  800632:	75 f0                	jne    800624 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800634:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063a:	e9 67 fd ff ff       	jmp    8003a6 <vprintfmt+0x11>
+  80063f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800642:	89 45 14             	mov    %eax,0x14(%ebp)
+  800645:	e9 5c fd ff ff       	jmp    8003a6 <vprintfmt+0x11>
+  80064a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80064d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800650:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800653:	eb c6                	jmp    80061b <vprintfmt+0x286>
+	if (lflag >= 2)
+  800655:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800658:	89 55 10             	mov    %edx,0x10(%ebp)
+  80065b:	83 f9 01             	cmp    $0x1,%ecx
+  80065e:	7f 1f                	jg     80067f <vprintfmt+0x2ea>
+	else if (lflag)
+  800660:	85 c9                	test   %ecx,%ecx
+  800662:	74 67                	je     8006cb <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 30                	mov    (%eax),%esi
+  800669:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80066c:	89 f0                	mov    %esi,%eax
+  80066e:	c1 f8 1f             	sar    $0x1f,%eax
+  800671:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8d 40 04             	lea    0x4(%eax),%eax
+  80067a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067d:	eb 17                	jmp    800696 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8b 50 04             	mov    0x4(%eax),%edx
+  800685:	8b 00                	mov    (%eax),%eax
+  800687:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80068a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8d 40 08             	lea    0x8(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800696:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800699:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80069c:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8006a1:	85 c9                	test   %ecx,%ecx
+  8006a3:	0f 89 12 01 00 00    	jns    8007bb <vprintfmt+0x426>
+				putch('-', putdat);
+  8006a9:	83 ec 08             	sub    $0x8,%esp
+  8006ac:	53                   	push   %ebx
+  8006ad:	6a 2d                	push   $0x2d
+  8006af:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006b1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006b7:	f7 da                	neg    %edx
+  8006b9:	83 d1 00             	adc    $0x0,%ecx
+  8006bc:	f7 d9                	neg    %ecx
+  8006be:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006c1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006c6:	e9 f0 00 00 00       	jmp    8007bb <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8006cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ce:	8b 30                	mov    (%eax),%esi
+  8006d0:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006d3:	89 f0                	mov    %esi,%eax
+  8006d5:	c1 f8 1f             	sar    $0x1f,%eax
+  8006d8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e4:	eb b0                	jmp    800696 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8006e6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006e9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ec:	83 f9 01             	cmp    $0x1,%ecx
+  8006ef:	7f 1e                	jg     80070f <vprintfmt+0x37a>
+	else if (lflag)
+  8006f1:	85 c9                	test   %ecx,%ecx
+  8006f3:	74 32                	je     800727 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8006f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f8:	8b 10                	mov    (%eax),%edx
+  8006fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800702:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800705:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80070a:	e9 ac 00 00 00       	jmp    8007bb <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 10                	mov    (%eax),%edx
+  800714:	8b 48 04             	mov    0x4(%eax),%ecx
+  800717:	8d 40 08             	lea    0x8(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80071d:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800722:	e9 94 00 00 00       	jmp    8007bb <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8b 10                	mov    (%eax),%edx
+  80072c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800731:	8d 40 04             	lea    0x4(%eax),%eax
+  800734:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800737:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80073c:	eb 7d                	jmp    8007bb <vprintfmt+0x426>
+	if (lflag >= 2)
+  80073e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800741:	89 55 10             	mov    %edx,0x10(%ebp)
+  800744:	83 f9 01             	cmp    $0x1,%ecx
+  800747:	7f 1b                	jg     800764 <vprintfmt+0x3cf>
+	else if (lflag)
+  800749:	85 c9                	test   %ecx,%ecx
+  80074b:	74 2c                	je     800779 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 10                	mov    (%eax),%edx
+  800752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800757:	8d 40 04             	lea    0x4(%eax),%eax
+  80075a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80075d:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800762:	eb 57                	jmp    8007bb <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 10                	mov    (%eax),%edx
+  800769:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076c:	8d 40 08             	lea    0x8(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800772:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800777:	eb 42                	jmp    8007bb <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800783:	8d 40 04             	lea    0x4(%eax),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800789:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80078e:	eb 2b                	jmp    8007bb <vprintfmt+0x426>
+			putch('0', putdat);
+  800790:	89 55 10             	mov    %edx,0x10(%ebp)
+  800793:	83 ec 08             	sub    $0x8,%esp
+  800796:	53                   	push   %ebx
+  800797:	6a 30                	push   $0x30
+  800799:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80079b:	83 c4 08             	add    $0x8,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	6a 78                	push   $0x78
+  8007a1:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007ad:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b6:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8007bb:	83 ec 0c             	sub    $0xc,%esp
+  8007be:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007c2:	50                   	push   %eax
+  8007c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8007c6:	56                   	push   %esi
+  8007c7:	51                   	push   %ecx
+  8007c8:	52                   	push   %edx
+  8007c9:	89 da                	mov    %ebx,%edx
+  8007cb:	89 f8                	mov    %edi,%eax
+  8007cd:	e8 d8 fa ff ff       	call   8002aa <printnum>
+			break;
+  8007d2:	83 c4 20             	add    $0x20,%esp
+  8007d5:	e9 cc fb ff ff       	jmp    8003a6 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8007da:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007dd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e0:	83 f9 01             	cmp    $0x1,%ecx
+  8007e3:	7f 1b                	jg     800800 <vprintfmt+0x46b>
+	else if (lflag)
+  8007e5:	85 c9                	test   %ecx,%ecx
+  8007e7:	74 2c                	je     800815 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8007e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ec:	8b 10                	mov    (%eax),%edx
+  8007ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f9:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8007fe:	eb bb                	jmp    8007bb <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 10                	mov    (%eax),%edx
+  800805:	8b 48 04             	mov    0x4(%eax),%ecx
+  800808:	8d 40 08             	lea    0x8(%eax),%eax
+  80080b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080e:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800813:	eb a6                	jmp    8007bb <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800815:	8b 45 14             	mov    0x14(%ebp),%eax
+  800818:	8b 10                	mov    (%eax),%edx
+  80081a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081f:	8d 40 04             	lea    0x4(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800825:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80082a:	eb 8f                	jmp    8007bb <vprintfmt+0x426>
+			putch(ch, putdat);
+  80082c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80082f:	83 ec 08             	sub    $0x8,%esp
+  800832:	53                   	push   %ebx
+  800833:	6a 25                	push   $0x25
+  800835:	ff d7                	call   *%edi
+			break;
+  800837:	83 c4 10             	add    $0x10,%esp
+  80083a:	e9 67 fb ff ff       	jmp    8003a6 <vprintfmt+0x11>
+			putch('%', putdat);
+  80083f:	83 ec 08             	sub    $0x8,%esp
+  800842:	53                   	push   %ebx
+  800843:	6a 25                	push   $0x25
+  800845:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800847:	83 c4 10             	add    $0x10,%esp
+  80084a:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80084e:	0f 84 ba fb ff ff    	je     80040e <vprintfmt+0x79>
+  800854:	89 75 10             	mov    %esi,0x10(%ebp)
+  800857:	89 f0                	mov    %esi,%eax
+  800859:	83 e8 01             	sub    $0x1,%eax
+  80085c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800860:	75 f7                	jne    800859 <vprintfmt+0x4c4>
+  800862:	89 45 10             	mov    %eax,0x10(%ebp)
+  800865:	e9 3c fb ff ff       	jmp    8003a6 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80086a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80086d:	8d 70 01             	lea    0x1(%eax),%esi
+  800870:	0f b6 00             	movzbl (%eax),%eax
+  800873:	0f be d0             	movsbl %al,%edx
+  800876:	85 d2                	test   %edx,%edx
+  800878:	74 11                	je     80088b <vprintfmt+0x4f6>
+  80087a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80087d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800880:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800883:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800886:	e9 5d fd ff ff       	jmp    8005e8 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80088b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80088e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800891:	e9 10 fb ff ff       	jmp    8003a6 <vprintfmt+0x11>
+  800896:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800899:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089c:	e9 05 fb ff ff       	jmp    8003a6 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8008a1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008a5:	7e 0a                	jle    8008b1 <vprintfmt+0x51c>
+  8008a7:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008ab:	0f 85 bd fc ff ff    	jne    80056e <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008b1:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008b6:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008bb:	be 19 45 80 00       	mov    $0x804519,%esi
+  8008c0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008c3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008c6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008c9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008cc:	e9 17 fd ff ff       	jmp    8005e8 <vprintfmt+0x253>
+}
+  8008d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d4:	5b                   	pop    %ebx
+  8008d5:	5e                   	pop    %esi
+  8008d6:	5f                   	pop    %edi
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+
+008008d9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	83 ec 18             	sub    $0x18,%esp
+  8008df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008e8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008ec:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008ef:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008f6:	85 c0                	test   %eax,%eax
+  8008f8:	74 26                	je     800920 <vsnprintf+0x47>
+  8008fa:	85 d2                	test   %edx,%edx
+  8008fc:	7e 22                	jle    800920 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008fe:	ff 75 14             	push   0x14(%ebp)
+  800901:	ff 75 10             	push   0x10(%ebp)
+  800904:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800907:	50                   	push   %eax
+  800908:	68 5b 03 80 00       	push   $0x80035b
+  80090d:	e8 83 fa ff ff       	call   800395 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800912:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800915:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800918:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80091b:	83 c4 10             	add    $0x10,%esp
+}
+  80091e:	c9                   	leave
+  80091f:	c3                   	ret
+		return -E_INVAL;
+  800920:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800925:	eb f7                	jmp    80091e <vsnprintf+0x45>
+
+00800927 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80092d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800930:	50                   	push   %eax
+  800931:	ff 75 10             	push   0x10(%ebp)
+  800934:	ff 75 0c             	push   0xc(%ebp)
+  800937:	ff 75 08             	push   0x8(%ebp)
+  80093a:	e8 9a ff ff ff       	call   8008d9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80093f:	c9                   	leave
+  800940:	c3                   	ret
+
+00800941 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800947:	80 3a 00             	cmpb   $0x0,(%edx)
+  80094a:	74 10                	je     80095c <strlen+0x1b>
+  80094c:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800951:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800954:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800958:	75 f7                	jne    800951 <strlen+0x10>
+	return n;
+}
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80095c:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800961:	eb f7                	jmp    80095a <strlen+0x19>
+
+00800963 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800969:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80096c:	85 d2                	test   %edx,%edx
+  80096e:	74 16                	je     800986 <strnlen+0x23>
+  800970:	b8 00 00 00 00       	mov    $0x0,%eax
+  800975:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800979:	74 09                	je     800984 <strnlen+0x21>
+		n++;
+  80097b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80097e:	39 d0                	cmp    %edx,%eax
+  800980:	75 f3                	jne    800975 <strnlen+0x12>
+		n++;
+  800982:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800984:	5d                   	pop    %ebp
+  800985:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098b:	eb f7                	jmp    800984 <strnlen+0x21>
+
+0080098d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80098d:	55                   	push   %ebp
+  80098e:	89 e5                	mov    %esp,%ebp
+  800990:	53                   	push   %ebx
+  800991:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800994:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009a0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009a3:	83 c0 01             	add    $0x1,%eax
+  8009a6:	84 d2                	test   %dl,%dl
+  8009a8:	75 f2                	jne    80099c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009aa:	89 c8                	mov    %ecx,%eax
+  8009ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009af:	c9                   	leave
+  8009b0:	c3                   	ret
+
+008009b1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	53                   	push   %ebx
+  8009b5:	83 ec 10             	sub    $0x10,%esp
+  8009b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009bb:	53                   	push   %ebx
+  8009bc:	e8 80 ff ff ff       	call   800941 <strlen>
+  8009c1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009c4:	ff 75 0c             	push   0xc(%ebp)
+  8009c7:	01 d8                	add    %ebx,%eax
+  8009c9:	50                   	push   %eax
+  8009ca:	e8 be ff ff ff       	call   80098d <strcpy>
+	return dst;
+}
+  8009cf:	89 d8                	mov    %ebx,%eax
+  8009d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+
+008009d6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	56                   	push   %esi
+  8009da:	53                   	push   %ebx
+  8009db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009e4:	85 db                	test   %ebx,%ebx
+  8009e6:	74 17                	je     8009ff <strncpy+0x29>
+  8009e8:	01 f3                	add    %esi,%ebx
+  8009ea:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8009ec:	83 c0 01             	add    $0x1,%eax
+  8009ef:	0f b6 0a             	movzbl (%edx),%ecx
+  8009f2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009f5:	80 f9 01             	cmp    $0x1,%cl
+  8009f8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009fb:	39 c3                	cmp    %eax,%ebx
+  8009fd:	75 ed                	jne    8009ec <strncpy+0x16>
+	}
+	return ret;
+}
+  8009ff:	89 f0                	mov    %esi,%eax
+  800a01:	5b                   	pop    %ebx
+  800a02:	5e                   	pop    %esi
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	56                   	push   %esi
+  800a09:	53                   	push   %ebx
+  800a0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a13:	89 f0                	mov    %esi,%eax
+  800a15:	85 db                	test   %ebx,%ebx
+  800a17:	74 1e                	je     800a37 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a19:	83 eb 01             	sub    $0x1,%ebx
+  800a1c:	74 16                	je     800a34 <strlcpy+0x2f>
+  800a1e:	01 f3                	add    %esi,%ebx
+  800a20:	0f b6 0a             	movzbl (%edx),%ecx
+  800a23:	84 c9                	test   %cl,%cl
+  800a25:	74 0d                	je     800a34 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800a27:	83 c2 01             	add    $0x1,%edx
+  800a2a:	83 c0 01             	add    $0x1,%eax
+  800a2d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800a30:	39 d8                	cmp    %ebx,%eax
+  800a32:	75 ec                	jne    800a20 <strlcpy+0x1b>
+		*dst = '\0';
+  800a34:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a37:	29 f0                	sub    %esi,%eax
+}
+  800a39:	5b                   	pop    %ebx
+  800a3a:	5e                   	pop    %esi
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a43:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a46:	0f b6 01             	movzbl (%ecx),%eax
+  800a49:	84 c0                	test   %al,%al
+  800a4b:	74 11                	je     800a5e <strcmp+0x21>
+  800a4d:	38 02                	cmp    %al,(%edx)
+  800a4f:	75 0d                	jne    800a5e <strcmp+0x21>
+		p++, q++;
+  800a51:	83 c1 01             	add    $0x1,%ecx
+  800a54:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a57:	0f b6 01             	movzbl (%ecx),%eax
+  800a5a:	84 c0                	test   %al,%al
+  800a5c:	75 ef                	jne    800a4d <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a5e:	0f b6 c0             	movzbl %al,%eax
+  800a61:	0f b6 12             	movzbl (%edx),%edx
+  800a64:	29 d0                	sub    %edx,%eax
+}
+  800a66:	5d                   	pop    %ebp
+  800a67:	c3                   	ret
+
+00800a68 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a68:	55                   	push   %ebp
+  800a69:	89 e5                	mov    %esp,%ebp
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a72:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a75:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a7a:	85 d2                	test   %edx,%edx
+  800a7c:	74 2e                	je     800aac <strncmp+0x44>
+  800a7e:	0f b6 01             	movzbl (%ecx),%eax
+  800a81:	84 c0                	test   %al,%al
+  800a83:	74 16                	je     800a9b <strncmp+0x33>
+  800a85:	3a 03                	cmp    (%ebx),%al
+  800a87:	75 12                	jne    800a9b <strncmp+0x33>
+		n--, p++, q++;
+  800a89:	83 c1 01             	add    $0x1,%ecx
+  800a8c:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a8f:	83 ea 01             	sub    $0x1,%edx
+  800a92:	75 ea                	jne    800a7e <strncmp+0x16>
+		return 0;
+  800a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a99:	eb 11                	jmp    800aac <strncmp+0x44>
+  800a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800aa0:	85 d2                	test   %edx,%edx
+  800aa2:	74 08                	je     800aac <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aa4:	0f b6 01             	movzbl (%ecx),%eax
+  800aa7:	0f b6 13             	movzbl (%ebx),%edx
+  800aaa:	29 d0                	sub    %edx,%eax
+}
+  800aac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+00800ab1 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800abb:	0f b6 10             	movzbl (%eax),%edx
+  800abe:	84 d2                	test   %dl,%dl
+  800ac0:	74 15                	je     800ad7 <strchr+0x26>
+		if (*s == c)
+  800ac2:	38 d1                	cmp    %dl,%cl
+  800ac4:	74 0f                	je     800ad5 <strchr+0x24>
+	for (; *s; s++)
+  800ac6:	83 c0 01             	add    $0x1,%eax
+  800ac9:	0f b6 10             	movzbl (%eax),%edx
+  800acc:	84 d2                	test   %dl,%dl
+  800ace:	75 f2                	jne    800ac2 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+	return 0;
+  800ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adc:	eb f7                	jmp    800ad5 <strchr+0x24>
+
+00800ade <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	53                   	push   %ebx
+  800ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800ae8:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800aeb:	38 d3                	cmp    %dl,%bl
+  800aed:	74 14                	je     800b03 <strfind+0x25>
+  800aef:	89 d1                	mov    %edx,%ecx
+  800af1:	84 db                	test   %bl,%bl
+  800af3:	74 0e                	je     800b03 <strfind+0x25>
+	for (; *s; s++)
+  800af5:	83 c0 01             	add    $0x1,%eax
+  800af8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800afb:	38 ca                	cmp    %cl,%dl
+  800afd:	74 04                	je     800b03 <strfind+0x25>
+  800aff:	84 d2                	test   %dl,%dl
+  800b01:	75 f2                	jne    800af5 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b06:	c9                   	leave
+  800b07:	c3                   	ret
+
+00800b08 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b08:	55                   	push   %ebp
+  800b09:	89 e5                	mov    %esp,%ebp
+  800b0b:	57                   	push   %edi
+  800b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b0f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b12:	85 c9                	test   %ecx,%ecx
+  800b14:	74 20                	je     800b36 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b16:	89 f8                	mov    %edi,%eax
+  800b18:	09 c8                	or     %ecx,%eax
+  800b1a:	a8 03                	test   $0x3,%al
+  800b1c:	75 12                	jne    800b30 <memset+0x28>
+		c &= 0xFF;
+  800b1e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b22:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b28:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b2b:	fc                   	cld
+  800b2c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b2e:	eb 06                	jmp    800b36 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b30:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b33:	fc                   	cld
+  800b34:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b36:	89 f8                	mov    %edi,%eax
+  800b38:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b3b:	c9                   	leave
+  800b3c:	c3                   	ret
+
+00800b3d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	57                   	push   %edi
+  800b41:	56                   	push   %esi
+  800b42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b45:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b48:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b4b:	39 c6                	cmp    %eax,%esi
+  800b4d:	73 32                	jae    800b81 <memmove+0x44>
+  800b4f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b52:	39 d0                	cmp    %edx,%eax
+  800b54:	73 2b                	jae    800b81 <memmove+0x44>
+		s += n;
+		d += n;
+  800b56:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b59:	89 d6                	mov    %edx,%esi
+  800b5b:	09 fe                	or     %edi,%esi
+  800b5d:	09 ce                	or     %ecx,%esi
+  800b5f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b65:	75 0e                	jne    800b75 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b67:	83 ef 04             	sub    $0x4,%edi
+  800b6a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b6d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b70:	fd                   	std
+  800b71:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b73:	eb 09                	jmp    800b7e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b75:	83 ef 01             	sub    $0x1,%edi
+  800b78:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b7b:	fd                   	std
+  800b7c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b7e:	fc                   	cld
+  800b7f:	eb 1a                	jmp    800b9b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b81:	89 f2                	mov    %esi,%edx
+  800b83:	09 c2                	or     %eax,%edx
+  800b85:	09 ca                	or     %ecx,%edx
+  800b87:	f6 c2 03             	test   $0x3,%dl
+  800b8a:	75 0a                	jne    800b96 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b8c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b8f:	89 c7                	mov    %eax,%edi
+  800b91:	fc                   	cld
+  800b92:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b94:	eb 05                	jmp    800b9b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b96:	89 c7                	mov    %eax,%edi
+  800b98:	fc                   	cld
+  800b99:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b9b:	5e                   	pop    %esi
+  800b9c:	5f                   	pop    %edi
+  800b9d:	5d                   	pop    %ebp
+  800b9e:	c3                   	ret
+
+00800b9f <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ba5:	ff 75 10             	push   0x10(%ebp)
+  800ba8:	ff 75 0c             	push   0xc(%ebp)
+  800bab:	ff 75 08             	push   0x8(%ebp)
+  800bae:	e8 8a ff ff ff       	call   800b3d <memmove>
+}
+  800bb3:	c9                   	leave
+  800bb4:	c3                   	ret
+
+00800bb5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bb5:	55                   	push   %ebp
+  800bb6:	89 e5                	mov    %esp,%ebp
+  800bb8:	56                   	push   %esi
+  800bb9:	53                   	push   %ebx
+  800bba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bc0:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bc3:	85 f6                	test   %esi,%esi
+  800bc5:	74 29                	je     800bf0 <memcmp+0x3b>
+  800bc7:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800bc9:	0f b6 08             	movzbl (%eax),%ecx
+  800bcc:	0f b6 1a             	movzbl (%edx),%ebx
+  800bcf:	38 d9                	cmp    %bl,%cl
+  800bd1:	75 11                	jne    800be4 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bd3:	83 c0 01             	add    $0x1,%eax
+  800bd6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bd9:	39 c6                	cmp    %eax,%esi
+  800bdb:	75 ec                	jne    800bc9 <memcmp+0x14>
+	}
+
+	return 0;
+  800bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be2:	eb 08                	jmp    800bec <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800be4:	0f b6 c1             	movzbl %cl,%eax
+  800be7:	0f b6 db             	movzbl %bl,%ebx
+  800bea:	29 d8                	sub    %ebx,%eax
+}
+  800bec:	5b                   	pop    %ebx
+  800bed:	5e                   	pop    %esi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+	return 0;
+  800bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf5:	eb f5                	jmp    800bec <memcmp+0x37>
+
+00800bf7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c00:	89 c2                	mov    %eax,%edx
+  800c02:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c05:	39 d0                	cmp    %edx,%eax
+  800c07:	73 0d                	jae    800c16 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c09:	38 08                	cmp    %cl,(%eax)
+  800c0b:	74 0d                	je     800c1a <memfind+0x23>
+	for (; s < ends; s++)
+  800c0d:	83 c0 01             	add    $0x1,%eax
+  800c10:	39 c2                	cmp    %eax,%edx
+  800c12:	75 f5                	jne    800c09 <memfind+0x12>
+  800c14:	eb 06                	jmp    800c1c <memfind+0x25>
+  800c16:	89 c2                	mov    %eax,%edx
+  800c18:	eb 02                	jmp    800c1c <memfind+0x25>
+  800c1a:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c1c:	89 d0                	mov    %edx,%eax
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  800c26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c2c:	0f b6 02             	movzbl (%edx),%eax
+  800c2f:	3c 20                	cmp    $0x20,%al
+  800c31:	74 04                	je     800c37 <strtol+0x17>
+  800c33:	3c 09                	cmp    $0x9,%al
+  800c35:	75 0e                	jne    800c45 <strtol+0x25>
+		s++;
+  800c37:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c3a:	0f b6 02             	movzbl (%edx),%eax
+  800c3d:	3c 20                	cmp    $0x20,%al
+  800c3f:	74 f6                	je     800c37 <strtol+0x17>
+  800c41:	3c 09                	cmp    $0x9,%al
+  800c43:	74 f2                	je     800c37 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c45:	3c 2b                	cmp    $0x2b,%al
+  800c47:	74 2a                	je     800c73 <strtol+0x53>
+	int neg = 0;
+  800c49:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c4e:	3c 2d                	cmp    $0x2d,%al
+  800c50:	74 2b                	je     800c7d <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c52:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c58:	75 0f                	jne    800c69 <strtol+0x49>
+  800c5a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c5d:	74 28                	je     800c87 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c5f:	85 db                	test   %ebx,%ebx
+  800c61:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c66:	0f 44 d8             	cmove  %eax,%ebx
+  800c69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c71:	eb 46                	jmp    800cb9 <strtol+0x99>
+		s++;
+  800c73:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c7b:	eb d5                	jmp    800c52 <strtol+0x32>
+		s++, neg = 1;
+  800c7d:	83 c2 01             	add    $0x1,%edx
+  800c80:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c85:	eb cb                	jmp    800c52 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c87:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c8b:	74 0e                	je     800c9b <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c8d:	85 db                	test   %ebx,%ebx
+  800c8f:	75 d8                	jne    800c69 <strtol+0x49>
+		s++, base = 8;
+  800c91:	83 c2 01             	add    $0x1,%edx
+  800c94:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c99:	eb ce                	jmp    800c69 <strtol+0x49>
+		s += 2, base = 16;
+  800c9b:	83 c2 02             	add    $0x2,%edx
+  800c9e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ca3:	eb c4                	jmp    800c69 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ca5:	0f be c0             	movsbl %al,%eax
+  800ca8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cab:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cae:	7d 3a                	jge    800cea <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800cb0:	83 c2 01             	add    $0x1,%edx
+  800cb3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cb7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cb9:	0f b6 02             	movzbl (%edx),%eax
+  800cbc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cbf:	89 f3                	mov    %esi,%ebx
+  800cc1:	80 fb 09             	cmp    $0x9,%bl
+  800cc4:	76 df                	jbe    800ca5 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800cc6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cc9:	89 f3                	mov    %esi,%ebx
+  800ccb:	80 fb 19             	cmp    $0x19,%bl
+  800cce:	77 08                	ja     800cd8 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800cd0:	0f be c0             	movsbl %al,%eax
+  800cd3:	83 e8 57             	sub    $0x57,%eax
+  800cd6:	eb d3                	jmp    800cab <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cd8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cdb:	89 f3                	mov    %esi,%ebx
+  800cdd:	80 fb 19             	cmp    $0x19,%bl
+  800ce0:	77 08                	ja     800cea <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800ce2:	0f be c0             	movsbl %al,%eax
+  800ce5:	83 e8 37             	sub    $0x37,%eax
+  800ce8:	eb c1                	jmp    800cab <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cea:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cee:	74 05                	je     800cf5 <strtol+0xd5>
+		*endptr = (char *) s;
+  800cf0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cf3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800cf5:	89 c8                	mov    %ecx,%eax
+  800cf7:	f7 d8                	neg    %eax
+  800cf9:	85 ff                	test   %edi,%edi
+  800cfb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cfe:	89 c8                	mov    %ecx,%eax
+  800d00:	5b                   	pop    %ebx
+  800d01:	5e                   	pop    %esi
+  800d02:	5f                   	pop    %edi
+  800d03:	5d                   	pop    %ebp
+  800d04:	c3                   	ret
+
+00800d05 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	57                   	push   %edi
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d16:	89 c3                	mov    %eax,%ebx
+  800d18:	89 c7                	mov    %eax,%edi
+  800d1a:	89 c6                	mov    %eax,%esi
+  800d1c:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+
+00800d23 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d33:	89 d1                	mov    %edx,%ecx
+  800d35:	89 d3                	mov    %edx,%ebx
+  800d37:	89 d7                	mov    %edx,%edi
+  800d39:	89 d6                	mov    %edx,%esi
+  800d3b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5f                   	pop    %edi
+  800d40:	5d                   	pop    %ebp
+  800d41:	c3                   	ret
+
+00800d42 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	57                   	push   %edi
+  800d46:	56                   	push   %esi
+  800d47:	53                   	push   %ebx
+  800d48:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d53:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d58:	89 cb                	mov    %ecx,%ebx
+  800d5a:	89 cf                	mov    %ecx,%edi
+  800d5c:	89 ce                	mov    %ecx,%esi
+  800d5e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d60:	85 c0                	test   %eax,%eax
+  800d62:	7f 08                	jg     800d6c <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d67:	5b                   	pop    %ebx
+  800d68:	5e                   	pop    %esi
+  800d69:	5f                   	pop    %edi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6c:	83 ec 0c             	sub    $0xc,%esp
+  800d6f:	50                   	push   %eax
+  800d70:	6a 03                	push   $0x3
+  800d72:	68 4b 48 80 00       	push   $0x80484b
+  800d77:	6a 23                	push   $0x23
+  800d79:	68 68 48 80 00       	push   $0x804868
+  800d7e:	e8 38 f4 ff ff       	call   8001bb <_panic>
+
+00800d83 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d83:	55                   	push   %ebp
+  800d84:	89 e5                	mov    %esp,%ebp
+  800d86:	57                   	push   %edi
+  800d87:	56                   	push   %esi
+  800d88:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d93:	89 d1                	mov    %edx,%ecx
+  800d95:	89 d3                	mov    %edx,%ebx
+  800d97:	89 d7                	mov    %edx,%edi
+  800d99:	89 d6                	mov    %edx,%esi
+  800d9b:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+
+00800da2 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	57                   	push   %edi
+  800da6:	56                   	push   %esi
+  800da7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dad:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800db2:	89 d1                	mov    %edx,%ecx
+  800db4:	89 d3                	mov    %edx,%ebx
+  800db6:	89 d7                	mov    %edx,%edi
+  800db8:	89 d6                	mov    %edx,%esi
+  800dba:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dbc:	5b                   	pop    %ebx
+  800dbd:	5e                   	pop    %esi
+  800dbe:	5f                   	pop    %edi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+
+00800dc1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	57                   	push   %edi
+  800dc5:	56                   	push   %esi
+  800dc6:	53                   	push   %ebx
+  800dc7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dca:	be 00 00 00 00       	mov    $0x0,%esi
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddd:	89 f7                	mov    %esi,%edi
+  800ddf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de1:	85 c0                	test   %eax,%eax
+  800de3:	7f 08                	jg     800ded <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de8:	5b                   	pop    %ebx
+  800de9:	5e                   	pop    %esi
+  800dea:	5f                   	pop    %edi
+  800deb:	5d                   	pop    %ebp
+  800dec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ded:	83 ec 0c             	sub    $0xc,%esp
+  800df0:	50                   	push   %eax
+  800df1:	6a 04                	push   $0x4
+  800df3:	68 4b 48 80 00       	push   $0x80484b
+  800df8:	6a 23                	push   $0x23
+  800dfa:	68 68 48 80 00       	push   $0x804868
+  800dff:	e8 b7 f3 ff ff       	call   8001bb <_panic>
+
+00800e04 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	57                   	push   %edi
+  800e08:	56                   	push   %esi
+  800e09:	53                   	push   %ebx
+  800e0a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e13:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e1e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e21:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e23:	85 c0                	test   %eax,%eax
+  800e25:	7f 08                	jg     800e2f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5e                   	pop    %esi
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+  800e32:	50                   	push   %eax
+  800e33:	6a 05                	push   $0x5
+  800e35:	68 4b 48 80 00       	push   $0x80484b
+  800e3a:	6a 23                	push   $0x23
+  800e3c:	68 68 48 80 00       	push   $0x804868
+  800e41:	e8 75 f3 ff ff       	call   8001bb <_panic>
+
+00800e46 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e5f:	89 df                	mov    %ebx,%edi
+  800e61:	89 de                	mov    %ebx,%esi
+  800e63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	7f 08                	jg     800e71 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6c:	5b                   	pop    %ebx
+  800e6d:	5e                   	pop    %esi
+  800e6e:	5f                   	pop    %edi
+  800e6f:	5d                   	pop    %ebp
+  800e70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e71:	83 ec 0c             	sub    $0xc,%esp
+  800e74:	50                   	push   %eax
+  800e75:	6a 06                	push   $0x6
+  800e77:	68 4b 48 80 00       	push   $0x80484b
+  800e7c:	6a 23                	push   $0x23
+  800e7e:	68 68 48 80 00       	push   $0x804868
+  800e83:	e8 33 f3 ff ff       	call   8001bb <_panic>
+
+00800e88 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	57                   	push   %edi
+  800e8c:	56                   	push   %esi
+  800e8d:	53                   	push   %ebx
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ea1:	89 df                	mov    %ebx,%edi
+  800ea3:	89 de                	mov    %ebx,%esi
+  800ea5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea7:	85 c0                	test   %eax,%eax
+  800ea9:	7f 08                	jg     800eb3 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eae:	5b                   	pop    %ebx
+  800eaf:	5e                   	pop    %esi
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+  800eb6:	50                   	push   %eax
+  800eb7:	6a 08                	push   $0x8
+  800eb9:	68 4b 48 80 00       	push   $0x80484b
+  800ebe:	6a 23                	push   $0x23
+  800ec0:	68 68 48 80 00       	push   $0x804868
+  800ec5:	e8 f1 f2 ff ff       	call   8001bb <_panic>
+
+00800eca <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ede:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ee3:	89 df                	mov    %ebx,%edi
+  800ee5:	89 de                	mov    %ebx,%esi
+  800ee7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee9:	85 c0                	test   %eax,%eax
+  800eeb:	7f 08                	jg     800ef5 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800eed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef0:	5b                   	pop    %ebx
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5f                   	pop    %edi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef5:	83 ec 0c             	sub    $0xc,%esp
+  800ef8:	50                   	push   %eax
+  800ef9:	6a 09                	push   $0x9
+  800efb:	68 4b 48 80 00       	push   $0x80484b
+  800f00:	6a 23                	push   $0x23
+  800f02:	68 68 48 80 00       	push   $0x804868
+  800f07:	e8 af f2 ff ff       	call   8001bb <_panic>
+
+00800f0c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f20:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f25:	89 df                	mov    %ebx,%edi
+  800f27:	89 de                	mov    %ebx,%esi
+  800f29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7f 08                	jg     800f37 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 0a                	push   $0xa
+  800f3d:	68 4b 48 80 00       	push   $0x80484b
+  800f42:	6a 23                	push   $0x23
+  800f44:	68 68 48 80 00       	push   $0x804868
+  800f49:	e8 6d f2 ff ff       	call   8001bb <_panic>
+
+00800f4e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f5f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f67:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+
+00800f71 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f82:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f87:	89 cb                	mov    %ecx,%ebx
+  800f89:	89 cf                	mov    %ecx,%edi
+  800f8b:	89 ce                	mov    %ecx,%esi
+  800f8d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	7f 08                	jg     800f9b <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	50                   	push   %eax
+  800f9f:	6a 0d                	push   $0xd
+  800fa1:	68 4b 48 80 00       	push   $0x80484b
+  800fa6:	6a 23                	push   $0x23
+  800fa8:	68 68 48 80 00       	push   $0x804868
+  800fad:	e8 09 f2 ff ff       	call   8001bb <_panic>
+
+00800fb2 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fcc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+
+00800fd3 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+  800fd9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fec:	89 df                	mov    %ebx,%edi
+  800fee:	89 de                	mov    %ebx,%esi
+  800ff0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	7f 08                	jg     800ffe <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+  801001:	50                   	push   %eax
+  801002:	6a 0d                	push   $0xd
+  801004:	68 4b 48 80 00       	push   $0x80484b
+  801009:	6a 23                	push   $0x23
+  80100b:	68 68 48 80 00       	push   $0x804868
+  801010:	e8 a6 f1 ff ff       	call   8001bb <_panic>
+
+00801015 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801020:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801025:	89 d1                	mov    %edx,%ecx
+  801027:	89 d3                	mov    %edx,%ebx
+  801029:	89 d7                	mov    %edx,%edi
+  80102b:	89 d6                	mov    %edx,%esi
+  80102d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80102f:	5b                   	pop    %ebx
+  801030:	5e                   	pop    %esi
+  801031:	5f                   	pop    %edi
+  801032:	5d                   	pop    %ebp
+  801033:	c3                   	ret
+
+00801034 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	89 de                	mov    %ebx,%esi
+  80104e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	b8 10 00 00 00       	mov    $0x10,%eax
+  801068:	89 cb                	mov    %ecx,%ebx
+  80106a:	89 cf                	mov    %ecx,%edi
+  80106c:	89 ce                	mov    %ecx,%esi
+  80106e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801070:	5b                   	pop    %ebx
+  801071:	5e                   	pop    %esi
+  801072:	5f                   	pop    %edi
+  801073:	5d                   	pop    %ebp
+  801074:	c3                   	ret
+
+00801075 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	57                   	push   %edi
+  801079:	56                   	push   %esi
+  80107a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801086:	b8 11 00 00 00       	mov    $0x11,%eax
+  80108b:	89 df                	mov    %ebx,%edi
+  80108d:	89 de                	mov    %ebx,%esi
+  80108f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801091:	5b                   	pop    %ebx
+  801092:	5e                   	pop    %esi
+  801093:	5f                   	pop    %edi
+  801094:	5d                   	pop    %ebp
+  801095:	c3                   	ret
+
+00801096 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	57                   	push   %edi
+  80109a:	56                   	push   %esi
+  80109b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010ac:	89 df                	mov    %ebx,%edi
+  8010ae:	89 de                	mov    %ebx,%esi
+  8010b0:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8010b2:	5b                   	pop    %ebx
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5f                   	pop    %edi
+  8010b5:	5d                   	pop    %ebp
+  8010b6:	c3                   	ret
+
+008010b7 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	57                   	push   %edi
+  8010bb:	56                   	push   %esi
+  8010bc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ca:	89 cb                	mov    %ecx,%ebx
+  8010cc:	89 cf                	mov    %ecx,%edi
+  8010ce:	89 ce                	mov    %ecx,%esi
+  8010d0:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+
+008010d7 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010ed:	89 df                	mov    %ebx,%edi
+  8010ef:	89 de                	mov    %ebx,%esi
+  8010f1:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	b8 15 00 00 00       	mov    $0x15,%eax
+  80110b:	89 cb                	mov    %ecx,%ebx
+  80110d:	89 cf                	mov    %ecx,%edi
+  80110f:	89 ce                	mov    %ecx,%esi
+  801111:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801113:	5b                   	pop    %ebx
+  801114:	5e                   	pop    %esi
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+
+00801118 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111e:	be 00 00 00 00       	mov    $0x0,%esi
+  801123:	8b 55 08             	mov    0x8(%ebp),%edx
+  801126:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801129:	b8 16 00 00 00       	mov    $0x16,%eax
+  80112e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801131:	89 f7                	mov    %esi,%edi
+  801133:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801135:	5b                   	pop    %ebx
+  801136:	5e                   	pop    %esi
+  801137:	5f                   	pop    %edi
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+
+0080113a <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	57                   	push   %edi
+  80113e:	56                   	push   %esi
+  80113f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801140:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801145:	8b 55 08             	mov    0x8(%ebp),%edx
+  801148:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801150:	89 df                	mov    %ebx,%edi
+  801152:	89 de                	mov    %ebx,%esi
+  801154:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801156:	5b                   	pop    %ebx
+  801157:	5e                   	pop    %esi
+  801158:	5f                   	pop    %edi
+  801159:	5d                   	pop    %ebp
+  80115a:	c3                   	ret
+
+0080115b <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	57                   	push   %edi
+  80115f:	56                   	push   %esi
+  801160:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801161:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801166:	8b 55 08             	mov    0x8(%ebp),%edx
+  801169:	b8 18 00 00 00       	mov    $0x18,%eax
+  80116e:	89 cb                	mov    %ecx,%ebx
+  801170:	89 cf                	mov    %ecx,%edi
+  801172:	89 ce                	mov    %ecx,%esi
+  801174:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+
+0080117b <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80117b:	55                   	push   %ebp
+  80117c:	89 e5                	mov    %esp,%ebp
+  80117e:	57                   	push   %edi
+  80117f:	56                   	push   %esi
+  801180:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801181:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801185:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801192:	89 df                	mov    %ebx,%edi
+  801194:	89 de                	mov    %ebx,%esi
+  801196:	cd 30                	int    $0x30
+}
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+
+0080119d <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	57                   	push   %edi
+  8011a1:	56                   	push   %esi
+  8011a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ae:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b6:	89 f7                	mov    %esi,%edi
+  8011b8:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8011ba:	5b                   	pop    %ebx
+  8011bb:	5e                   	pop    %esi
+  8011bc:	5f                   	pop    %edi
+  8011bd:	5d                   	pop    %ebp
+  8011be:	c3                   	ret
+
+008011bf <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	57                   	push   %edi
+  8011c3:	56                   	push   %esi
+  8011c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d8:	89 f7                	mov    %esi,%edi
+  8011da:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8011dc:	5b                   	pop    %ebx
+  8011dd:	5e                   	pop    %esi
+  8011de:	5f                   	pop    %edi
+  8011df:	5d                   	pop    %ebp
+  8011e0:	c3                   	ret
+
+008011e1 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	57                   	push   %edi
+  8011e5:	56                   	push   %esi
+  8011e6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8011f7:	89 df                	mov    %ebx,%edi
+  8011f9:	89 de                	mov    %ebx,%esi
+  8011fb:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5f                   	pop    %edi
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+
+00801202 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	56                   	push   %esi
+  801207:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801208:	be 00 00 00 00       	mov    $0x0,%esi
+  80120d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801210:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801213:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801218:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121b:	89 f7                	mov    %esi,%edi
+  80121d:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80121f:	5b                   	pop    %ebx
+  801220:	5e                   	pop    %esi
+  801221:	5f                   	pop    %edi
+  801222:	5d                   	pop    %ebp
+  801223:	c3                   	ret
+
+00801224 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801224:	85 c0                	test   %eax,%eax
+  801226:	74 20                	je     801248 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  801228:	89 c1                	mov    %eax,%ecx
+  80122a:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801230:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  801236:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80123c:	8b 52 48             	mov    0x48(%edx),%edx
+  80123f:	39 c2                	cmp    %eax,%edx
+  801241:	74 06                	je     801249 <thread_alive+0x25>
+  801243:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801248:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801249:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  80124f:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801255:	85 c0                	test   %eax,%eax
+  801257:	0f 95 c0             	setne  %al
+  80125a:	0f b6 c0             	movzbl %al,%eax
+  80125d:	c3                   	ret
+
+0080125e <pgfault>:
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	57                   	push   %edi
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+  801264:	83 ec 0c             	sub    $0xc,%esp
+  801267:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80126a:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  80126c:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  80126f:	89 f3                	mov    %esi,%ebx
+  801271:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801274:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80127b:	74 52                	je     8012cf <pgfault+0x71>
+  80127d:	a8 02                	test   $0x2,%al
+  80127f:	75 14                	jne    801295 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801281:	83 ec 04             	sub    $0x4,%esp
+  801284:	68 76 48 80 00       	push   $0x804876
+  801289:	6a 2e                	push   $0x2e
+  80128b:	68 94 48 80 00       	push   $0x804894
+  801290:	e8 26 ef ff ff       	call   8001bb <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801295:	89 d8                	mov    %ebx,%eax
+  801297:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80129c:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8012a3:	83 ec 0c             	sub    $0xc,%esp
+  8012a6:	57                   	push   %edi
+  8012a7:	e8 3b 2c 00 00       	call   803ee7 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  8012ac:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8012b3:	83 e0 03             	and    $0x3,%eax
+  8012b6:	83 c4 10             	add    $0x10,%esp
+  8012b9:	83 f8 03             	cmp    $0x3,%eax
+  8012bc:	75 1a                	jne    8012d8 <pgfault+0x7a>
+			mutex_unlock(m);
+  8012be:	83 ec 0c             	sub    $0xc,%esp
+  8012c1:	57                   	push   %edi
+  8012c2:	e8 8e 2c 00 00       	call   803f55 <mutex_unlock>
+			return;
+  8012c7:	83 c4 10             	add    $0x10,%esp
+  8012ca:	e9 9f 00 00 00       	jmp    80136e <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8012cf:	a8 02                	test   $0x2,%al
+  8012d1:	74 ae                	je     801281 <pgfault+0x23>
+	struct mutex *m = NULL;
+  8012d3:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8012d8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8012df:	f6 c4 08             	test   $0x8,%ah
+  8012e2:	74 9d                	je     801281 <pgfault+0x23>
+  8012e4:	89 e0                	mov    %esp,%eax
+  8012e6:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8012eb:	29 c2                	sub    %eax,%edx
+  8012ed:	89 d0                	mov    %edx,%eax
+  8012ef:	c1 e8 0f             	shr    $0xf,%eax
+  8012f2:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8012f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fd:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801300:	c1 e0 0c             	shl    $0xc,%eax
+  801303:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801308:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80130a:	83 ec 04             	sub    $0x4,%esp
+  80130d:	6a 07                	push   $0x7
+  80130f:	53                   	push   %ebx
+  801310:	6a 00                	push   $0x0
+  801312:	e8 aa fa ff ff       	call   800dc1 <sys_page_alloc>
+  801317:	83 c4 10             	add    $0x10,%esp
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	78 58                	js     801376 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  80131e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801324:	83 ec 04             	sub    $0x4,%esp
+  801327:	68 00 10 00 00       	push   $0x1000
+  80132c:	56                   	push   %esi
+  80132d:	53                   	push   %ebx
+  80132e:	e8 0a f8 ff ff       	call   800b3d <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801333:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80133a:	56                   	push   %esi
+  80133b:	6a 00                	push   $0x0
+  80133d:	53                   	push   %ebx
+  80133e:	6a 00                	push   $0x0
+  801340:	e8 bf fa ff ff       	call   800e04 <sys_page_map>
+  801345:	83 c4 20             	add    $0x20,%esp
+  801348:	85 c0                	test   %eax,%eax
+  80134a:	78 3c                	js     801388 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  80134c:	83 ec 08             	sub    $0x8,%esp
+  80134f:	53                   	push   %ebx
+  801350:	6a 00                	push   $0x0
+  801352:	e8 ef fa ff ff       	call   800e46 <sys_page_unmap>
+  801357:	83 c4 10             	add    $0x10,%esp
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	78 3c                	js     80139a <pgfault+0x13c>
+	if(m)
+  80135e:	85 ff                	test   %edi,%edi
+  801360:	74 0c                	je     80136e <pgfault+0x110>
+		mutex_unlock(m);
+  801362:	83 ec 0c             	sub    $0xc,%esp
+  801365:	57                   	push   %edi
+  801366:	e8 ea 2b 00 00       	call   803f55 <mutex_unlock>
+  80136b:	83 c4 10             	add    $0x10,%esp
+}
+  80136e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801371:	5b                   	pop    %ebx
+  801372:	5e                   	pop    %esi
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801376:	50                   	push   %eax
+  801377:	68 9f 48 80 00       	push   $0x80489f
+  80137c:	6a 3d                	push   $0x3d
+  80137e:	68 94 48 80 00       	push   $0x804894
+  801383:	e8 33 ee ff ff       	call   8001bb <_panic>
+		panic("sys_page_map: %e", ret);
+  801388:	50                   	push   %eax
+  801389:	68 b2 48 80 00       	push   $0x8048b2
+  80138e:	6a 40                	push   $0x40
+  801390:	68 94 48 80 00       	push   $0x804894
+  801395:	e8 21 ee ff ff       	call   8001bb <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80139a:	50                   	push   %eax
+  80139b:	68 c3 48 80 00       	push   $0x8048c3
+  8013a0:	6a 42                	push   $0x42
+  8013a2:	68 94 48 80 00       	push   $0x804894
+  8013a7:	e8 0f ee ff ff       	call   8001bb <_panic>
+
+008013ac <thread_main>:
+{
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  8013b2:	ff 75 0c             	push   0xc(%ebp)
+  8013b5:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8013b8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8013bf:	e8 7e f9 ff ff       	call   800d42 <sys_env_destroy>
+}
+  8013c4:	83 c4 10             	add    $0x10,%esp
+  8013c7:	c9                   	leave
+  8013c8:	c3                   	ret
+
+008013c9 <fork>:
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+  8013cf:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  8013d2:	68 5e 12 80 00       	push   $0x80125e
+  8013d7:	e8 57 2e 00 00       	call   804233 <set_pgfault_handler>
+	if(sforked)
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8013e6:	75 33                	jne    80141b <fork+0x52>
+	__asm __volatile("int %2"
+  8013e8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013ed:	cd 30                	int    $0x30
+  8013ef:	89 c7                	mov    %eax,%edi
+  8013f1:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8013f3:	85 c0                	test   %eax,%eax
+  8013f5:	0f 88 b4 00 00 00    	js     8014af <fork+0xe6>
+	if(envid == 0) {
+  8013fb:	0f 84 c3 00 00 00    	je     8014c4 <fork+0xfb>
+	pgbatch_init(&pb);
+  801401:	83 ec 0c             	sub    $0xc,%esp
+  801404:	68 20 63 80 00       	push   $0x806320
+  801409:	e8 25 29 00 00       	call   803d33 <pgbatch_init>
+  80140e:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801411:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801416:	e9 9c 01 00 00       	jmp    8015b7 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80141b:	83 ec 0c             	sub    $0xc,%esp
+  80141e:	68 c0 66 80 00       	push   $0x8066c0
+  801423:	e8 bf 2a 00 00       	call   803ee7 <mutex_lock>
+  801428:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80142b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801430:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801435:	eb 08                	jmp    80143f <fork+0x76>
+  801437:	83 c3 01             	add    $0x1,%ebx
+  80143a:	83 fb 20             	cmp    $0x20,%ebx
+  80143d:	74 5b                	je     80149a <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  80143f:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  801446:	89 f0                	mov    %esi,%eax
+  801448:	e8 d7 fd ff ff       	call   801224 <thread_alive>
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	74 e6                	je     801437 <fork+0x6e>
+  801451:	89 e0                	mov    %esp,%eax
+  801453:	89 fa                	mov    %edi,%edx
+  801455:	29 c2                	sub    %eax,%edx
+  801457:	89 d0                	mov    %edx,%eax
+  801459:	c1 e8 0f             	shr    $0xf,%eax
+  80145c:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801462:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801467:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80146a:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801471:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801474:	83 ec 08             	sub    $0x8,%esp
+  801477:	50                   	push   %eax
+  801478:	56                   	push   %esi
+  801479:	e8 8e fa ff ff       	call   800f0c <sys_env_set_pgfault_upcall>
+  80147e:	83 c4 10             	add    $0x10,%esp
+  801481:	85 c0                	test   %eax,%eax
+  801483:	79 b2                	jns    801437 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801485:	50                   	push   %eax
+  801486:	68 50 49 80 00       	push   $0x804950
+  80148b:	68 00 01 00 00       	push   $0x100
+  801490:	68 94 48 80 00       	push   $0x804894
+  801495:	e8 21 ed ff ff       	call   8001bb <_panic>
+	mutex_unlock(&sfork_lock);
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+  80149d:	68 c0 66 80 00       	push   $0x8066c0
+  8014a2:	e8 ae 2a 00 00       	call   803f55 <mutex_unlock>
+}
+  8014a7:	83 c4 10             	add    $0x10,%esp
+  8014aa:	e9 39 ff ff ff       	jmp    8013e8 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  8014af:	50                   	push   %eax
+  8014b0:	68 d6 48 80 00       	push   $0x8048d6
+  8014b5:	68 91 00 00 00       	push   $0x91
+  8014ba:	68 94 48 80 00       	push   $0x804894
+  8014bf:	e8 f7 ec ff ff       	call   8001bb <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8014c4:	e8 ba f8 ff ff       	call   800d83 <sys_getenvid>
+  8014c9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014ce:	89 e1                	mov    %esp,%ecx
+  8014d0:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8014d5:	29 ca                	sub    %ecx,%edx
+  8014d7:	89 d1                	mov    %edx,%ecx
+  8014d9:	c1 e9 0f             	shr    $0xf,%ecx
+  8014dc:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8014e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e7:	0f 42 d1             	cmovb  %ecx,%edx
+  8014ea:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8014f0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014f5:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  8014fc:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  801501:	85 c0                	test   %eax,%eax
+  801503:	75 07                	jne    80150c <fork+0x143>
+		return 0;
+  801505:	89 c6                	mov    %eax,%esi
+  801507:	e9 6f 02 00 00       	jmp    80177b <fork+0x3b2>
+  80150c:	89 e2                	mov    %esp,%edx
+  80150e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801513:	29 d0                	sub    %edx,%eax
+  801515:	89 c3                	mov    %eax,%ebx
+  801517:	c1 eb 0f             	shr    $0xf,%ebx
+  80151a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80151f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801524:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  801527:	83 ec 04             	sub    $0x4,%esp
+  80152a:	68 80 00 00 00       	push   $0x80
+  80152f:	6a 00                	push   $0x0
+  801531:	68 40 66 80 00       	push   $0x806640
+  801536:	e8 cd f5 ff ff       	call   800b08 <memset>
+	thread_ids[slot] = sys_getenvid();
+  80153b:	e8 43 f8 ff ff       	call   800d83 <sys_getenvid>
+  801540:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  801547:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  80154e:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  801553:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  80155a:	e8 7a 29 00 00       	call   803ed9 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80155f:	83 c4 0c             	add    $0xc,%esp
+  801562:	68 07 04 00 00       	push   $0x407
+  801567:	68 00 00 00 e1       	push   $0xe1000000
+  80156c:	6a 00                	push   $0x0
+  80156e:	e8 4e f8 ff ff       	call   800dc1 <sys_page_alloc>
+  801573:	83 c4 10             	add    $0x10,%esp
+  801576:	85 c0                	test   %eax,%eax
+  801578:	0f 89 fd 01 00 00    	jns    80177b <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  80157e:	50                   	push   %eax
+  80157f:	68 9f 48 80 00       	push   $0x80489f
+  801584:	68 12 01 00 00       	push   $0x112
+  801589:	68 94 48 80 00       	push   $0x804894
+  80158e:	e8 28 ec ff ff       	call   8001bb <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801593:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801599:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  80159f:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8015a5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015ab:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8015b1:	0f 87 4f 01 00 00    	ja     801706 <fork+0x33d>
+		pd = PDX(addr);
+  8015b7:	89 d8                	mov    %ebx,%eax
+  8015b9:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8015bc:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015c3:	f6 c2 01             	test   $0x1,%dl
+  8015c6:	74 cb                	je     801593 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8015c8:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8015cd:	0f 85 92 00 00 00    	jne    801665 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8015d3:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8015d9:	76 10                	jbe    8015eb <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8015db:	89 d8                	mov    %ebx,%eax
+  8015dd:	f7 d8                	neg    %eax
+  8015df:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8015e4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8015e9:	74 ba                	je     8015a5 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8015eb:	89 d8                	mov    %ebx,%eax
+  8015ed:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8015f0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015f7:	f6 c2 01             	test   $0x1,%dl
+  8015fa:	74 a9                	je     8015a5 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8015fc:	89 c1                	mov    %eax,%ecx
+  8015fe:	c1 e1 0c             	shl    $0xc,%ecx
+  801601:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801604:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80160b:	f6 c6 04             	test   $0x4,%dh
+  80160e:	0f 85 8e 00 00 00    	jne    8016a2 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801614:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80161b:	f6 c6 08             	test   $0x8,%dh
+  80161e:	75 0f                	jne    80162f <fork+0x266>
+  801620:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801627:	a8 02                	test   $0x2,%al
+  801629:	0f 84 bb 00 00 00    	je     8016ea <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  80162f:	83 ec 08             	sub    $0x8,%esp
+  801632:	68 05 08 00 00       	push   $0x805
+  801637:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80163a:	50                   	push   %eax
+  80163b:	56                   	push   %esi
+  80163c:	50                   	push   %eax
+  80163d:	6a 00                	push   $0x0
+  80163f:	68 20 63 80 00       	push   $0x806320
+  801644:	e8 a8 27 00 00       	call   803df1 <pgbatch_map>
+  801649:	83 c4 20             	add    $0x20,%esp
+  80164c:	85 c0                	test   %eax,%eax
+  80164e:	79 76                	jns    8016c6 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801650:	50                   	push   %eax
+  801651:	68 fa 48 80 00       	push   $0x8048fa
+  801656:	68 bc 00 00 00       	push   $0xbc
+  80165b:	68 94 48 80 00       	push   $0x804894
+  801660:	e8 56 eb ff ff       	call   8001bb <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801665:	83 ec 0c             	sub    $0xc,%esp
+  801668:	68 00 08 00 00       	push   $0x800
+  80166d:	56                   	push   %esi
+  80166e:	53                   	push   %ebx
+  80166f:	6a 00                	push   $0x0
+  801671:	68 20 63 80 00       	push   $0x806320
+  801676:	e8 21 28 00 00       	call   803e9c <pgbatch_sharept>
+  80167b:	83 c4 20             	add    $0x20,%esp
+  80167e:	85 c0                	test   %eax,%eax
+  801680:	78 0b                	js     80168d <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801682:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801688:	e9 18 ff ff ff       	jmp    8015a5 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  80168d:	50                   	push   %eax
+  80168e:	68 e6 48 80 00       	push   $0x8048e6
+  801693:	68 b2 00 00 00       	push   $0xb2
+  801698:	68 94 48 80 00       	push   $0x804894
+  80169d:	e8 19 eb ff ff       	call   8001bb <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8016a2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016a9:	83 ec 08             	sub    $0x8,%esp
+  8016ac:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016b1:	50                   	push   %eax
+  8016b2:	51                   	push   %ecx
+  8016b3:	56                   	push   %esi
+  8016b4:	51                   	push   %ecx
+  8016b5:	6a 00                	push   $0x0
+  8016b7:	68 20 63 80 00       	push   $0x806320
+  8016bc:	e8 30 27 00 00       	call   803df1 <pgbatch_map>
+  8016c1:	83 c4 20             	add    $0x20,%esp
+  8016c4:	eb 17                	jmp    8016dd <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8016c6:	68 05 08 00 00       	push   $0x805
+  8016cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8016ce:	6a 00                	push   $0x0
+  8016d0:	68 20 63 80 00       	push   $0x806320
+  8016d5:	e8 8b 27 00 00       	call   803e65 <pgbatch_protect>
+  8016da:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	0f 89 c0 fe ff ff    	jns    8015a5 <fork+0x1dc>
+  8016e5:	e9 66 ff ff ff       	jmp    801650 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8016ea:	83 ec 08             	sub    $0x8,%esp
+  8016ed:	6a 05                	push   $0x5
+  8016ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016f2:	50                   	push   %eax
+  8016f3:	56                   	push   %esi
+  8016f4:	50                   	push   %eax
+  8016f5:	6a 00                	push   $0x0
+  8016f7:	68 20 63 80 00       	push   $0x806320
+  8016fc:	e8 f0 26 00 00       	call   803df1 <pgbatch_map>
+  801701:	83 c4 20             	add    $0x20,%esp
+  801704:	eb d7                	jmp    8016dd <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801706:	6a 07                	push   $0x7
+  801708:	68 00 f0 bf ee       	push   $0xeebff000
+  80170d:	57                   	push   %edi
+  80170e:	68 20 63 80 00       	push   $0x806320
+  801713:	e8 a2 26 00 00       	call   803dba <pgbatch_alloc>
+  801718:	83 c4 10             	add    $0x10,%esp
+  80171b:	85 c0                	test   %eax,%eax
+  80171d:	78 66                	js     801785 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  80171f:	83 ec 0c             	sub    $0xc,%esp
+  801722:	68 20 63 80 00       	push   $0x806320
+  801727:	e8 15 26 00 00       	call   803d41 <pgbatch_flush>
+  80172c:	83 c4 10             	add    $0x10,%esp
+  80172f:	85 c0                	test   %eax,%eax
+  801731:	78 52                	js     801785 <fork+0x3bc>
+  801733:	89 e2                	mov    %esp,%edx
+  801735:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80173a:	29 d0                	sub    %edx,%eax
+  80173c:	89 c2                	mov    %eax,%edx
+  80173e:	c1 ea 0f             	shr    $0xf,%edx
+  801741:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174b:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  80174e:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801755:	8b 40 78             	mov    0x78(%eax),%eax
+  801758:	83 ec 08             	sub    $0x8,%esp
+  80175b:	50                   	push   %eax
+  80175c:	57                   	push   %edi
+  80175d:	e8 aa f7 ff ff       	call   800f0c <sys_env_set_pgfault_upcall>
+  801762:	83 c4 10             	add    $0x10,%esp
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 31                	js     80179a <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	6a 02                	push   $0x2
+  80176e:	57                   	push   %edi
+  80176f:	e8 14 f7 ff ff       	call   800e88 <sys_env_set_status>
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	85 c0                	test   %eax,%eax
+  801779:	78 34                	js     8017af <fork+0x3e6>
+}
+  80177b:	89 f0                	mov    %esi,%eax
+  80177d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801780:	5b                   	pop    %ebx
+  801781:	5e                   	pop    %esi
+  801782:	5f                   	pop    %edi
+  801783:	5d                   	pop    %ebp
+  801784:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801785:	50                   	push   %eax
+  801786:	68 06 49 80 00       	push   $0x804906
+  80178b:	68 c0 00 00 00       	push   $0xc0
+  801790:	68 94 48 80 00       	push   $0x804894
+  801795:	e8 21 ea ff ff       	call   8001bb <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  80179a:	50                   	push   %eax
+  80179b:	68 1b 49 80 00       	push   $0x80491b
+  8017a0:	68 c2 00 00 00       	push   $0xc2
+  8017a5:	68 94 48 80 00       	push   $0x804894
+  8017aa:	e8 0c ea ff ff       	call   8001bb <_panic>
+		panic("sys_env_set_status: %e", ret);
+  8017af:	50                   	push   %eax
+  8017b0:	68 36 49 80 00       	push   $0x804936
+  8017b5:	68 c4 00 00 00       	push   $0xc4
+  8017ba:	68 94 48 80 00       	push   $0x804894
+  8017bf:	e8 f7 e9 ff ff       	call   8001bb <_panic>
+
+008017c4 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  8017c4:	55                   	push   %ebp
+  8017c5:	89 e5                	mov    %esp,%ebp
+  8017c7:	57                   	push   %edi
+  8017c8:	56                   	push   %esi
+  8017c9:	53                   	push   %ebx
+  8017ca:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8017cd:	68 c0 66 80 00       	push   $0x8066c0
+  8017d2:	e8 10 27 00 00       	call   803ee7 <mutex_lock>
+  8017d7:	89 e2                	mov    %esp,%edx
+  8017d9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017de:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  8017e0:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8017e3:	89 c3                	mov    %eax,%ebx
+  8017e5:	c1 eb 0f             	shr    $0xf,%ebx
+  8017e8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f2:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  8017f5:	e8 89 f5 ff ff       	call   800d83 <sys_getenvid>
+  8017fa:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801801:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801806:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  80180d:	e8 12 fa ff ff       	call   801224 <thread_alive>
+  801812:	85 c0                	test   %eax,%eax
+  801814:	74 24                	je     80183a <sfork+0x76>
+  801816:	83 c3 01             	add    $0x1,%ebx
+  801819:	83 fb 20             	cmp    $0x20,%ebx
+  80181c:	75 e8                	jne    801806 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  80181e:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801823:	83 ec 0c             	sub    $0xc,%esp
+  801826:	68 c0 66 80 00       	push   $0x8066c0
+  80182b:	e8 25 27 00 00       	call   803f55 <mutex_unlock>
+	return r;
+}
+  801830:	89 f0                	mov    %esi,%eax
+  801832:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801835:	5b                   	pop    %ebx
+  801836:	5e                   	pop    %esi
+  801837:	5f                   	pop    %edi
+  801838:	5d                   	pop    %ebp
+  801839:	c3                   	ret
+	if (i == NTHREADS) {
+  80183a:	83 fb 20             	cmp    $0x20,%ebx
+  80183d:	0f 84 53 01 00 00    	je     801996 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801843:	89 d8                	mov    %ebx,%eax
+  801845:	c1 e0 0f             	shl    $0xf,%eax
+  801848:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  80184b:	83 ec 0c             	sub    $0xc,%esp
+  80184e:	68 00 60 80 00       	push   $0x806000
+  801853:	e8 db 24 00 00       	call   803d33 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801858:	83 c4 10             	add    $0x10,%esp
+  80185b:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801862:	75 1f                	jne    801883 <sfork+0xbf>
+  801864:	68 07 04 00 00       	push   $0x407
+  801869:	68 00 00 00 e1       	push   $0xe1000000
+  80186e:	6a 00                	push   $0x0
+  801870:	68 00 60 80 00       	push   $0x806000
+  801875:	e8 40 25 00 00       	call   803dba <pgbatch_alloc>
+  80187a:	89 c6                	mov    %eax,%esi
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	78 a0                	js     801823 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801883:	6a 07                	push   $0x7
+  801885:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  80188a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80188d:	29 c8                	sub    %ecx,%eax
+  80188f:	50                   	push   %eax
+  801890:	6a 00                	push   $0x0
+  801892:	68 00 60 80 00       	push   $0x806000
+  801897:	e8 1e 25 00 00       	call   803dba <pgbatch_alloc>
+  80189c:	89 c6                	mov    %eax,%esi
+  80189e:	83 c4 10             	add    $0x10,%esp
+  8018a1:	85 c0                	test   %eax,%eax
+  8018a3:	0f 88 7a ff ff ff    	js     801823 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  8018a9:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  8018ae:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018b1:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  8018b3:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8018b8:	29 c8                	sub    %ecx,%eax
+  8018ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8018bd:	39 c7                	cmp    %eax,%edi
+  8018bf:	73 29                	jae    8018ea <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  8018c1:	6a 07                	push   $0x7
+  8018c3:	57                   	push   %edi
+  8018c4:	6a 00                	push   $0x0
+  8018c6:	68 00 60 80 00       	push   $0x806000
+  8018cb:	e8 ea 24 00 00       	call   803dba <pgbatch_alloc>
+  8018d0:	89 c6                	mov    %eax,%esi
+  8018d2:	83 c4 10             	add    $0x10,%esp
+  8018d5:	85 c0                	test   %eax,%eax
+  8018d7:	0f 88 46 ff ff ff    	js     801823 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  8018dd:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8018e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018e6:	39 c7                	cmp    %eax,%edi
+  8018e8:	72 d7                	jb     8018c1 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	68 00 60 80 00       	push   $0x806000
+  8018f2:	e8 4a 24 00 00       	call   803d41 <pgbatch_flush>
+  8018f7:	89 c6                	mov    %eax,%esi
+  8018f9:	83 c4 10             	add    $0x10,%esp
+  8018fc:	85 c0                	test   %eax,%eax
+  8018fe:	0f 88 1f ff ff ff    	js     801823 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801904:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801909:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80190c:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  80190e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801914:	8b 55 08             	mov    0x8(%ebp),%edx
+  801917:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  80191a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80191d:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801920:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801923:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801928:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  80192a:	52                   	push   %edx
+  80192b:	50                   	push   %eax
+  80192c:	68 ac 13 80 00       	push   $0x8013ac
+  801931:	e8 cc f8 ff ff       	call   801202 <sys_exofork_shared>
+  801936:	89 c6                	mov    %eax,%esi
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	0f 88 e0 fe ff ff    	js     801823 <sfork+0x5f>
+	thread_ids[i] = id;
+  801943:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  80194a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80194f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801955:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80195a:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801961:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801968:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  80196b:	83 ec 08             	sub    $0x8,%esp
+  80196e:	6a 02                	push   $0x2
+  801970:	56                   	push   %esi
+  801971:	e8 12 f5 ff ff       	call   800e88 <sys_env_set_status>
+  801976:	89 c3                	mov    %eax,%ebx
+  801978:	83 c4 10             	add    $0x10,%esp
+  80197b:	85 c0                	test   %eax,%eax
+  80197d:	0f 89 a0 fe ff ff    	jns    801823 <sfork+0x5f>
+		sys_env_destroy(id);
+  801983:	83 ec 0c             	sub    $0xc,%esp
+  801986:	56                   	push   %esi
+  801987:	e8 b6 f3 ff ff       	call   800d42 <sys_env_destroy>
+		goto out;
+  80198c:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  80198f:	89 de                	mov    %ebx,%esi
+		goto out;
+  801991:	e9 8d fe ff ff       	jmp    801823 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801996:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  80199b:	e9 83 fe ff ff       	jmp    801823 <sfork+0x5f>
+
+008019a0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	56                   	push   %esi
+  8019a4:	53                   	push   %ebx
+  8019a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8019b5:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8019b8:	83 ec 0c             	sub    $0xc,%esp
+  8019bb:	50                   	push   %eax
+  8019bc:	e8 b0 f5 ff ff       	call   800f71 <sys_ipc_recv>
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	0f 88 8b 00 00 00    	js     801a57 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8019cc:	85 f6                	test   %esi,%esi
+  8019ce:	74 2a                	je     8019fa <ipc_recv+0x5a>
+  8019d0:	89 e2                	mov    %esp,%edx
+  8019d2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8019d7:	29 d0                	sub    %edx,%eax
+  8019d9:	89 c2                	mov    %eax,%edx
+  8019db:	c1 ea 0f             	shr    $0xf,%edx
+  8019de:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e8:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8019eb:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8019f2:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8019f8:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8019fa:	85 db                	test   %ebx,%ebx
+  8019fc:	74 2a                	je     801a28 <ipc_recv+0x88>
+  8019fe:	89 e2                	mov    %esp,%edx
+  801a00:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a05:	29 d0                	sub    %edx,%eax
+  801a07:	89 c2                	mov    %eax,%edx
+  801a09:	c1 ea 0f             	shr    $0xf,%edx
+  801a0c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a16:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801a19:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a20:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801a26:	89 03                	mov    %eax,(%ebx)
+  801a28:	89 e2                	mov    %esp,%edx
+  801a2a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a2f:	29 d0                	sub    %edx,%eax
+  801a31:	89 c2                	mov    %eax,%edx
+  801a33:	c1 ea 0f             	shr    $0xf,%edx
+  801a36:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a40:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801a43:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a4a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801a50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a53:	5b                   	pop    %ebx
+  801a54:	5e                   	pop    %esi
+  801a55:	5d                   	pop    %ebp
+  801a56:	c3                   	ret
+		if(from_env_store != NULL)
+  801a57:	85 f6                	test   %esi,%esi
+  801a59:	74 06                	je     801a61 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801a5b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801a61:	85 db                	test   %ebx,%ebx
+  801a63:	74 eb                	je     801a50 <ipc_recv+0xb0>
+			*perm_store = 0;
+  801a65:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801a6b:	eb e3                	jmp    801a50 <ipc_recv+0xb0>
+
+00801a6d <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801a6d:	55                   	push   %ebp
+  801a6e:	89 e5                	mov    %esp,%ebp
+  801a70:	57                   	push   %edi
+  801a71:	56                   	push   %esi
+  801a72:	53                   	push   %ebx
+  801a73:	83 ec 14             	sub    $0x14,%esp
+  801a76:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a7c:	8b 75 14             	mov    0x14(%ebp),%esi
+  801a7f:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801a82:	85 c0                	test   %eax,%eax
+  801a84:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801a89:	0f 44 c2             	cmove  %edx,%eax
+  801a8c:	ff 75 10             	push   0x10(%ebp)
+  801a8f:	50                   	push   %eax
+  801a90:	e8 3e f5 ff ff       	call   800fd3 <sys_ipc_recv_pages>
+  801a95:	83 c4 10             	add    $0x10,%esp
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	0f 88 ba 00 00 00    	js     801b5a <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801aa0:	85 ff                	test   %edi,%edi
+  801aa2:	74 2a                	je     801ace <ipc_recv_pages+0x61>
+  801aa4:	89 e2                	mov    %esp,%edx
+  801aa6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801aab:	29 d0                	sub    %edx,%eax
+  801aad:	89 c2                	mov    %eax,%edx
+  801aaf:	c1 ea 0f             	shr    $0xf,%edx
+  801ab2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abc:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801abf:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ac6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801acc:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801ace:	85 f6                	test   %esi,%esi
+  801ad0:	74 2a                	je     801afc <ipc_recv_pages+0x8f>
+  801ad2:	89 e2                	mov    %esp,%edx
+  801ad4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ad9:	29 d0                	sub    %edx,%eax
+  801adb:	89 c2                	mov    %eax,%edx
+  801add:	c1 ea 0f             	shr    $0xf,%edx
+  801ae0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aea:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801aed:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801af4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801afa:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801afc:	85 db                	test   %ebx,%ebx
+  801afe:	74 2a                	je     801b2a <ipc_recv_pages+0xbd>
+  801b00:	89 e2                	mov    %esp,%edx
+  801b02:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b07:	29 d0                	sub    %edx,%eax
+  801b09:	89 c2                	mov    %eax,%edx
+  801b0b:	c1 ea 0f             	shr    $0xf,%edx
+  801b0e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b18:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801b1b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b22:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801b28:	89 03                	mov    %eax,(%ebx)
+  801b2a:	89 e2                	mov    %esp,%edx
+  801b2c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b31:	29 d0                	sub    %edx,%eax
+  801b33:	89 c2                	mov    %eax,%edx
+  801b35:	c1 ea 0f             	shr    $0xf,%edx
+  801b38:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b42:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801b45:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b4c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801b52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5f                   	pop    %edi
+  801b58:	5d                   	pop    %ebp
+  801b59:	c3                   	ret
+		if (from_env_store)
+  801b5a:	85 ff                	test   %edi,%edi
+  801b5c:	74 06                	je     801b64 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801b5e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801b64:	85 f6                	test   %esi,%esi
+  801b66:	74 06                	je     801b6e <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801b68:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801b6e:	85 db                	test   %ebx,%ebx
+  801b70:	74 e0                	je     801b52 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801b72:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801b78:	eb d8                	jmp    801b52 <ipc_recv_pages+0xe5>
+
+00801b7a <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	57                   	push   %edi
+  801b7e:	56                   	push   %esi
+  801b7f:	53                   	push   %ebx
+  801b80:	83 ec 1c             	sub    $0x1c,%esp
+  801b83:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801b86:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b89:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801b8f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801b93:	75 2b                	jne    801bc0 <ipc_try_send_pages+0x46>
+  801b95:	89 e2                	mov    %esp,%edx
+  801b97:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b9c:	29 d0                	sub    %edx,%eax
+  801b9e:	89 c2                	mov    %eax,%edx
+  801ba0:	c1 ea 0f             	shr    $0xf,%edx
+  801ba3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bad:	0f 42 c2             	cmovb  %edx,%eax
+  801bb0:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801bb7:	8b 70 48             	mov    0x48(%eax),%esi
+  801bba:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801bc0:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801bc6:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801bcb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bce:	85 ff                	test   %edi,%edi
+  801bd0:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801bd5:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  801bd8:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801bde:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801be4:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  801bea:	83 ec 0c             	sub    $0xc,%esp
+  801bed:	ff 75 14             	push   0x14(%ebp)
+  801bf0:	ff 75 18             	push   0x18(%ebp)
+  801bf3:	57                   	push   %edi
+  801bf4:	ff 75 0c             	push   0xc(%ebp)
+  801bf7:	ff 75 08             	push   0x8(%ebp)
+  801bfa:	e8 b3 f3 ff ff       	call   800fb2 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801bff:	83 c4 20             	add    $0x20,%esp
+  801c02:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c05:	75 21                	jne    801c28 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801c07:	83 ec 04             	sub    $0x4,%esp
+  801c0a:	6a ff                	push   $0xffffffff
+  801c0c:	53                   	push   %ebx
+  801c0d:	ff 75 e4             	push   -0x1c(%ebp)
+  801c10:	e8 aa f5 ff ff       	call   8011bf <sys_futex_wait>
+  801c15:	83 c4 10             	add    $0x10,%esp
+  801c18:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801c1b:	74 c7                	je     801be4 <ipc_try_send_pages+0x6a>
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	79 c3                	jns    801be4 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801c21:	e8 7c f1 ff ff       	call   800da2 <sys_yield>
+  801c26:	eb bc                	jmp    801be4 <ipc_try_send_pages+0x6a>
+	}
+}
+  801c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c2b:	5b                   	pop    %ebx
+  801c2c:	5e                   	pop    %esi
+  801c2d:	5f                   	pop    %edi
+  801c2e:	5d                   	pop    %ebp
+  801c2f:	c3                   	ret
+
+00801c30 <ipc_send>:
+{
+  801c30:	55                   	push   %ebp
+  801c31:	89 e5                	mov    %esp,%ebp
+  801c33:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801c36:	ff 75 14             	push   0x14(%ebp)
+  801c39:	6a 01                	push   $0x1
+  801c3b:	ff 75 10             	push   0x10(%ebp)
+  801c3e:	ff 75 0c             	push   0xc(%ebp)
+  801c41:	ff 75 08             	push   0x8(%ebp)
+  801c44:	e8 31 ff ff ff       	call   801b7a <ipc_try_send_pages>
+  801c49:	83 c4 20             	add    $0x20,%esp
+  801c4c:	85 c0                	test   %eax,%eax
+  801c4e:	78 02                	js     801c52 <ipc_send+0x22>
+}
+  801c50:	c9                   	leave
+  801c51:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801c52:	50                   	push   %eax
+  801c53:	68 6f 49 80 00       	push   $0x80496f
+  801c58:	6a 3f                	push   $0x3f
+  801c5a:	68 84 49 80 00       	push   $0x804984
+  801c5f:	e8 57 e5 ff ff       	call   8001bb <_panic>
+
+00801c64 <ipc_send_pages>:
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801c6a:	ff 75 18             	push   0x18(%ebp)
+  801c6d:	ff 75 14             	push   0x14(%ebp)
+  801c70:	ff 75 10             	push   0x10(%ebp)
+  801c73:	ff 75 0c             	push   0xc(%ebp)
+  801c76:	ff 75 08             	push   0x8(%ebp)
+  801c79:	e8 fc fe ff ff       	call   801b7a <ipc_try_send_pages>
+  801c7e:	83 c4 20             	add    $0x20,%esp
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 02                	js     801c87 <ipc_send_pages+0x23>
+}
+  801c85:	c9                   	leave
+  801c86:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801c87:	50                   	push   %eax
+  801c88:	68 8e 49 80 00       	push   $0x80498e
+  801c8d:	6a 64                	push   $0x64
+  801c8f:	68 84 49 80 00       	push   $0x804984
+  801c94:	e8 22 e5 ff ff       	call   8001bb <_panic>
+
+00801c99 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801c99:	55                   	push   %ebp
+  801c9a:	89 e5                	mov    %esp,%ebp
+  801c9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801ca4:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801caa:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801cb0:	8b 52 50             	mov    0x50(%edx),%edx
+  801cb3:	39 ca                	cmp    %ecx,%edx
+  801cb5:	74 11                	je     801cc8 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801cb7:	83 c0 01             	add    $0x1,%eax
+  801cba:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801cbf:	75 e3                	jne    801ca4 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc6:	eb 0e                	jmp    801cd6 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801cc8:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801cce:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801cd3:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801cd6:	5d                   	pop    %ebp
+  801cd7:	c3                   	ret
+
+00801cd8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cde:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ce3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801ce6:	5d                   	pop    %ebp
+  801ce7:	c3                   	ret
+
+00801ce8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ce8:	55                   	push   %ebp
+  801ce9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cee:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801cf3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801cf8:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801cfd:	5d                   	pop    %ebp
+  801cfe:	c3                   	ret
+
+00801cff <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801cff:	55                   	push   %ebp
+  801d00:	89 e5                	mov    %esp,%ebp
+  801d02:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801d07:	89 c2                	mov    %eax,%edx
+  801d09:	c1 ea 16             	shr    $0x16,%edx
+  801d0c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d13:	f6 c2 01             	test   $0x1,%dl
+  801d16:	74 29                	je     801d41 <fd_alloc+0x42>
+  801d18:	89 c2                	mov    %eax,%edx
+  801d1a:	c1 ea 0c             	shr    $0xc,%edx
+  801d1d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d24:	f6 c2 01             	test   $0x1,%dl
+  801d27:	74 18                	je     801d41 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801d29:	05 00 10 00 00       	add    $0x1000,%eax
+  801d2e:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801d33:	75 d2                	jne    801d07 <fd_alloc+0x8>
+  801d35:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801d3a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d3f:	eb 05                	jmp    801d46 <fd_alloc+0x47>
+			return 0;
+  801d41:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801d46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d49:	89 02                	mov    %eax,(%edx)
+}
+  801d4b:	89 c8                	mov    %ecx,%eax
+  801d4d:	5d                   	pop    %ebp
+  801d4e:	c3                   	ret
+
+00801d4f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801d4f:	55                   	push   %ebp
+  801d50:	89 e5                	mov    %esp,%ebp
+  801d52:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801d55:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801d5a:	77 30                	ja     801d8c <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801d5c:	c1 e0 0c             	shl    $0xc,%eax
+  801d5f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801d64:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801d6a:	f6 c2 01             	test   $0x1,%dl
+  801d6d:	74 24                	je     801d93 <fd_lookup+0x44>
+  801d6f:	89 c2                	mov    %eax,%edx
+  801d71:	c1 ea 0c             	shr    $0xc,%edx
+  801d74:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d7b:	f6 c2 01             	test   $0x1,%dl
+  801d7e:	74 1a                	je     801d9a <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801d80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d83:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801d85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d8a:	5d                   	pop    %ebp
+  801d8b:	c3                   	ret
+		return -E_INVAL;
+  801d8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d91:	eb f7                	jmp    801d8a <fd_lookup+0x3b>
+		return -E_INVAL;
+  801d93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d98:	eb f0                	jmp    801d8a <fd_lookup+0x3b>
+  801d9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d9f:	eb e9                	jmp    801d8a <fd_lookup+0x3b>
+
+00801da1 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801da1:	55                   	push   %ebp
+  801da2:	89 e5                	mov    %esp,%ebp
+  801da4:	53                   	push   %ebx
+  801da5:	83 ec 04             	sub    $0x4,%esp
+  801da8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db0:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801db5:	39 13                	cmp    %edx,(%ebx)
+  801db7:	74 54                	je     801e0d <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801db9:	83 c0 01             	add    $0x1,%eax
+  801dbc:	8b 1c 85 28 4a 80 00 	mov    0x804a28(,%eax,4),%ebx
+  801dc3:	85 db                	test   %ebx,%ebx
+  801dc5:	75 ee                	jne    801db5 <dev_lookup+0x14>
+  801dc7:	89 e1                	mov    %esp,%ecx
+  801dc9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801dce:	29 c8                	sub    %ecx,%eax
+  801dd0:	89 c1                	mov    %eax,%ecx
+  801dd2:	c1 e9 0f             	shr    $0xf,%ecx
+  801dd5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddf:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801de2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801de9:	8b 40 48             	mov    0x48(%eax),%eax
+  801dec:	83 ec 04             	sub    $0x4,%esp
+  801def:	52                   	push   %edx
+  801df0:	50                   	push   %eax
+  801df1:	68 ac 49 80 00       	push   $0x8049ac
+  801df6:	e8 9b e4 ff ff       	call   800296 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e03:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e06:	89 1a                	mov    %ebx,(%edx)
+}
+  801e08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0b:	c9                   	leave
+  801e0c:	c3                   	ret
+			return 0;
+  801e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e12:	eb ef                	jmp    801e03 <dev_lookup+0x62>
+
+00801e14 <fd_close>:
+{
+  801e14:	55                   	push   %ebp
+  801e15:	89 e5                	mov    %esp,%ebp
+  801e17:	57                   	push   %edi
+  801e18:	56                   	push   %esi
+  801e19:	53                   	push   %ebx
+  801e1a:	83 ec 24             	sub    $0x24,%esp
+  801e1d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e20:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e23:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e26:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e27:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e2d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e30:	50                   	push   %eax
+  801e31:	e8 19 ff ff ff       	call   801d4f <fd_lookup>
+  801e36:	89 c3                	mov    %eax,%ebx
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 05                	js     801e44 <fd_close+0x30>
+	    || fd != fd2)
+  801e3f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e42:	74 0f                	je     801e53 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801e44:	85 ff                	test   %edi,%edi
+  801e46:	0f 44 df             	cmove  %edi,%ebx
+}
+  801e49:	89 d8                	mov    %ebx,%eax
+  801e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e4e:	5b                   	pop    %ebx
+  801e4f:	5e                   	pop    %esi
+  801e50:	5f                   	pop    %edi
+  801e51:	5d                   	pop    %ebp
+  801e52:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e53:	83 ec 08             	sub    $0x8,%esp
+  801e56:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e59:	50                   	push   %eax
+  801e5a:	ff 36                	push   (%esi)
+  801e5c:	e8 40 ff ff ff       	call   801da1 <dev_lookup>
+  801e61:	89 c3                	mov    %eax,%ebx
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 1a                	js     801e84 <fd_close+0x70>
+		if (dev->dev_close)
+  801e6a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e6d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	74 0b                	je     801e84 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801e79:	83 ec 0c             	sub    $0xc,%esp
+  801e7c:	56                   	push   %esi
+  801e7d:	ff d0                	call   *%eax
+  801e7f:	89 c3                	mov    %eax,%ebx
+  801e81:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	56                   	push   %esi
+  801e88:	6a 00                	push   $0x0
+  801e8a:	e8 b7 ef ff ff       	call   800e46 <sys_page_unmap>
+	return r;
+  801e8f:	83 c4 10             	add    $0x10,%esp
+  801e92:	eb b5                	jmp    801e49 <fd_close+0x35>
+
+00801e94 <close>:
+
+int
+close(int fdnum)
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e9d:	50                   	push   %eax
+  801e9e:	ff 75 08             	push   0x8(%ebp)
+  801ea1:	e8 a9 fe ff ff       	call   801d4f <fd_lookup>
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	79 02                	jns    801eaf <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ead:	c9                   	leave
+  801eae:	c3                   	ret
+		return fd_close(fd, 1);
+  801eaf:	83 ec 08             	sub    $0x8,%esp
+  801eb2:	6a 01                	push   $0x1
+  801eb4:	ff 75 f4             	push   -0xc(%ebp)
+  801eb7:	e8 58 ff ff ff       	call   801e14 <fd_close>
+  801ebc:	83 c4 10             	add    $0x10,%esp
+  801ebf:	eb ec                	jmp    801ead <close+0x19>
+
+00801ec1 <close_all>:
+
+void
+close_all(void)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	53                   	push   %ebx
+  801ec5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801ec8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ecd:	83 ec 0c             	sub    $0xc,%esp
+  801ed0:	53                   	push   %ebx
+  801ed1:	e8 be ff ff ff       	call   801e94 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ed6:	83 c3 01             	add    $0x1,%ebx
+  801ed9:	83 c4 10             	add    $0x10,%esp
+  801edc:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801ee2:	75 e9                	jne    801ecd <close_all+0xc>
+}
+  801ee4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+
+00801ee9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	57                   	push   %edi
+  801eed:	56                   	push   %esi
+  801eee:	53                   	push   %ebx
+  801eef:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ef2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ef5:	50                   	push   %eax
+  801ef6:	ff 75 08             	push   0x8(%ebp)
+  801ef9:	e8 51 fe ff ff       	call   801d4f <fd_lookup>
+  801efe:	89 c3                	mov    %eax,%ebx
+  801f00:	83 c4 10             	add    $0x10,%esp
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	78 7f                	js     801f86 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f07:	83 ec 0c             	sub    $0xc,%esp
+  801f0a:	ff 75 0c             	push   0xc(%ebp)
+  801f0d:	e8 82 ff ff ff       	call   801e94 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801f12:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f15:	c1 e6 0c             	shl    $0xc,%esi
+  801f18:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801f1e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f21:	89 3c 24             	mov    %edi,(%esp)
+  801f24:	e8 bf fd ff ff       	call   801ce8 <fd2data>
+  801f29:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801f2b:	89 34 24             	mov    %esi,(%esp)
+  801f2e:	e8 b5 fd ff ff       	call   801ce8 <fd2data>
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801f39:	89 d8                	mov    %ebx,%eax
+  801f3b:	c1 e8 16             	shr    $0x16,%eax
+  801f3e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f45:	a8 01                	test   $0x1,%al
+  801f47:	74 11                	je     801f5a <dup+0x71>
+  801f49:	89 d8                	mov    %ebx,%eax
+  801f4b:	c1 e8 0c             	shr    $0xc,%eax
+  801f4e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f55:	f6 c2 01             	test   $0x1,%dl
+  801f58:	75 36                	jne    801f90 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801f5a:	89 f8                	mov    %edi,%eax
+  801f5c:	c1 e8 0c             	shr    $0xc,%eax
+  801f5f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f66:	83 ec 0c             	sub    $0xc,%esp
+  801f69:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f6e:	50                   	push   %eax
+  801f6f:	56                   	push   %esi
+  801f70:	6a 00                	push   $0x0
+  801f72:	57                   	push   %edi
+  801f73:	6a 00                	push   $0x0
+  801f75:	e8 8a ee ff ff       	call   800e04 <sys_page_map>
+  801f7a:	89 c3                	mov    %eax,%ebx
+  801f7c:	83 c4 20             	add    $0x20,%esp
+  801f7f:	85 c0                	test   %eax,%eax
+  801f81:	78 33                	js     801fb6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801f83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801f86:	89 d8                	mov    %ebx,%eax
+  801f88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8b:	5b                   	pop    %ebx
+  801f8c:	5e                   	pop    %esi
+  801f8d:	5f                   	pop    %edi
+  801f8e:	5d                   	pop    %ebp
+  801f8f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801f90:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f97:	83 ec 0c             	sub    $0xc,%esp
+  801f9a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f9f:	50                   	push   %eax
+  801fa0:	ff 75 d4             	push   -0x2c(%ebp)
+  801fa3:	6a 00                	push   $0x0
+  801fa5:	53                   	push   %ebx
+  801fa6:	6a 00                	push   $0x0
+  801fa8:	e8 57 ee ff ff       	call   800e04 <sys_page_map>
+  801fad:	89 c3                	mov    %eax,%ebx
+  801faf:	83 c4 20             	add    $0x20,%esp
+  801fb2:	85 c0                	test   %eax,%eax
+  801fb4:	79 a4                	jns    801f5a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801fb6:	83 ec 08             	sub    $0x8,%esp
+  801fb9:	56                   	push   %esi
+  801fba:	6a 00                	push   $0x0
+  801fbc:	e8 85 ee ff ff       	call   800e46 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801fc1:	83 c4 08             	add    $0x8,%esp
+  801fc4:	ff 75 d4             	push   -0x2c(%ebp)
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	e8 78 ee ff ff       	call   800e46 <sys_page_unmap>
+	return r;
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	eb b3                	jmp    801f86 <dup+0x9d>
+
+00801fd3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801fd3:	55                   	push   %ebp
+  801fd4:	89 e5                	mov    %esp,%ebp
+  801fd6:	56                   	push   %esi
+  801fd7:	53                   	push   %ebx
+  801fd8:	83 ec 18             	sub    $0x18,%esp
+  801fdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fde:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fe1:	50                   	push   %eax
+  801fe2:	53                   	push   %ebx
+  801fe3:	e8 67 fd ff ff       	call   801d4f <fd_lookup>
+  801fe8:	83 c4 10             	add    $0x10,%esp
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	78 3c                	js     80202b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ff2:	83 ec 08             	sub    $0x8,%esp
+  801ff5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff8:	50                   	push   %eax
+  801ff9:	ff 36                	push   (%esi)
+  801ffb:	e8 a1 fd ff ff       	call   801da1 <dev_lookup>
+  802000:	83 c4 10             	add    $0x10,%esp
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 24                	js     80202b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802007:	8b 46 08             	mov    0x8(%esi),%eax
+  80200a:	83 e0 03             	and    $0x3,%eax
+  80200d:	83 f8 01             	cmp    $0x1,%eax
+  802010:	74 20                	je     802032 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802012:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802015:	8b 40 08             	mov    0x8(%eax),%eax
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	74 54                	je     802070 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80201c:	83 ec 04             	sub    $0x4,%esp
+  80201f:	ff 75 10             	push   0x10(%ebp)
+  802022:	ff 75 0c             	push   0xc(%ebp)
+  802025:	56                   	push   %esi
+  802026:	ff d0                	call   *%eax
+  802028:	83 c4 10             	add    $0x10,%esp
+}
+  80202b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202e:	5b                   	pop    %ebx
+  80202f:	5e                   	pop    %esi
+  802030:	5d                   	pop    %ebp
+  802031:	c3                   	ret
+  802032:	89 e2                	mov    %esp,%edx
+  802034:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802039:	29 d0                	sub    %edx,%eax
+  80203b:	89 c2                	mov    %eax,%edx
+  80203d:	c1 ea 0f             	shr    $0xf,%edx
+  802040:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802045:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80204d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802054:	8b 40 48             	mov    0x48(%eax),%eax
+  802057:	83 ec 04             	sub    $0x4,%esp
+  80205a:	53                   	push   %ebx
+  80205b:	50                   	push   %eax
+  80205c:	68 ed 49 80 00       	push   $0x8049ed
+  802061:	e8 30 e2 ff ff       	call   800296 <cprintf>
+		return -E_INVAL;
+  802066:	83 c4 10             	add    $0x10,%esp
+  802069:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80206e:	eb bb                	jmp    80202b <read+0x58>
+		return -E_NOT_SUPP;
+  802070:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802075:	eb b4                	jmp    80202b <read+0x58>
+
+00802077 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	57                   	push   %edi
+  80207b:	56                   	push   %esi
+  80207c:	53                   	push   %ebx
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802083:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802086:	85 f6                	test   %esi,%esi
+  802088:	74 30                	je     8020ba <readn+0x43>
+  80208a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80208f:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802094:	83 ec 04             	sub    $0x4,%esp
+  802097:	89 f2                	mov    %esi,%edx
+  802099:	29 c2                	sub    %eax,%edx
+  80209b:	52                   	push   %edx
+  80209c:	01 f8                	add    %edi,%eax
+  80209e:	50                   	push   %eax
+  80209f:	ff 75 08             	push   0x8(%ebp)
+  8020a2:	e8 2c ff ff ff       	call   801fd3 <read>
+		if (m < 0)
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	78 15                	js     8020c3 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8020ae:	74 11                	je     8020c1 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8020b0:	01 c3                	add    %eax,%ebx
+  8020b2:	89 d8                	mov    %ebx,%eax
+  8020b4:	39 f3                	cmp    %esi,%ebx
+  8020b6:	72 dc                	jb     802094 <readn+0x1d>
+  8020b8:	eb 09                	jmp    8020c3 <readn+0x4c>
+  8020ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bf:	eb 02                	jmp    8020c3 <readn+0x4c>
+  8020c1:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8020c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c6:	5b                   	pop    %ebx
+  8020c7:	5e                   	pop    %esi
+  8020c8:	5f                   	pop    %edi
+  8020c9:	5d                   	pop    %ebp
+  8020ca:	c3                   	ret
+
+008020cb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8020cb:	55                   	push   %ebp
+  8020cc:	89 e5                	mov    %esp,%ebp
+  8020ce:	56                   	push   %esi
+  8020cf:	53                   	push   %ebx
+  8020d0:	83 ec 18             	sub    $0x18,%esp
+  8020d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020d9:	50                   	push   %eax
+  8020da:	53                   	push   %ebx
+  8020db:	e8 6f fc ff ff       	call   801d4f <fd_lookup>
+  8020e0:	83 c4 10             	add    $0x10,%esp
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	78 37                	js     80211e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020e7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020ea:	83 ec 08             	sub    $0x8,%esp
+  8020ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f0:	50                   	push   %eax
+  8020f1:	ff 36                	push   (%esi)
+  8020f3:	e8 a9 fc ff ff       	call   801da1 <dev_lookup>
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	78 1f                	js     80211e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020ff:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802103:	74 20                	je     802125 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802105:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802108:	8b 40 0c             	mov    0xc(%eax),%eax
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	74 54                	je     802163 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80210f:	83 ec 04             	sub    $0x4,%esp
+  802112:	ff 75 10             	push   0x10(%ebp)
+  802115:	ff 75 0c             	push   0xc(%ebp)
+  802118:	56                   	push   %esi
+  802119:	ff d0                	call   *%eax
+  80211b:	83 c4 10             	add    $0x10,%esp
+}
+  80211e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802121:	5b                   	pop    %ebx
+  802122:	5e                   	pop    %esi
+  802123:	5d                   	pop    %ebp
+  802124:	c3                   	ret
+  802125:	89 e2                	mov    %esp,%edx
+  802127:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80212c:	29 d0                	sub    %edx,%eax
+  80212e:	89 c2                	mov    %eax,%edx
+  802130:	c1 ea 0f             	shr    $0xf,%edx
+  802133:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213d:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802140:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802147:	8b 40 48             	mov    0x48(%eax),%eax
+  80214a:	83 ec 04             	sub    $0x4,%esp
+  80214d:	53                   	push   %ebx
+  80214e:	50                   	push   %eax
+  80214f:	68 09 4a 80 00       	push   $0x804a09
+  802154:	e8 3d e1 ff ff       	call   800296 <cprintf>
+		return -E_INVAL;
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802161:	eb bb                	jmp    80211e <write+0x53>
+		return -E_NOT_SUPP;
+  802163:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802168:	eb b4                	jmp    80211e <write+0x53>
+
+0080216a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802170:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802173:	50                   	push   %eax
+  802174:	ff 75 08             	push   0x8(%ebp)
+  802177:	e8 d3 fb ff ff       	call   801d4f <fd_lookup>
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	78 0e                	js     802191 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802183:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802189:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+
+00802193 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	53                   	push   %ebx
+  802197:	83 ec 1c             	sub    $0x1c,%esp
+  80219a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80219d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a0:	50                   	push   %eax
+  8021a1:	ff 75 08             	push   0x8(%ebp)
+  8021a4:	e8 a6 fb ff ff       	call   801d4f <fd_lookup>
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	78 33                	js     8021e3 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8021b0:	83 fb 03             	cmp    $0x3,%ebx
+  8021b3:	74 28                	je     8021dd <fcntl+0x4a>
+  8021b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ba:	83 fb 04             	cmp    $0x4,%ebx
+  8021bd:	75 24                	jne    8021e3 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8021bf:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8021c2:	8b 41 08             	mov    0x8(%ecx),%eax
+  8021c5:	80 e4 ef             	and    $0xef,%ah
+  8021c8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021cb:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8021d1:	09 d0                	or     %edx,%eax
+  8021d3:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8021d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021db:	eb 06                	jmp    8021e3 <fcntl+0x50>
+		return fd->fd_omode;
+  8021dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e0:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8021e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+
+008021e8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+  8021eb:	56                   	push   %esi
+  8021ec:	53                   	push   %ebx
+  8021ed:	83 ec 18             	sub    $0x18,%esp
+  8021f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021f6:	50                   	push   %eax
+  8021f7:	53                   	push   %ebx
+  8021f8:	e8 52 fb ff ff       	call   801d4f <fd_lookup>
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	85 c0                	test   %eax,%eax
+  802202:	78 34                	js     802238 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802204:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802207:	83 ec 08             	sub    $0x8,%esp
+  80220a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80220d:	50                   	push   %eax
+  80220e:	ff 36                	push   (%esi)
+  802210:	e8 8c fb ff ff       	call   801da1 <dev_lookup>
+  802215:	83 c4 10             	add    $0x10,%esp
+  802218:	85 c0                	test   %eax,%eax
+  80221a:	78 1c                	js     802238 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80221c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802220:	74 1d                	je     80223f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802222:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802225:	8b 40 18             	mov    0x18(%eax),%eax
+  802228:	85 c0                	test   %eax,%eax
+  80222a:	74 51                	je     80227d <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80222c:	83 ec 08             	sub    $0x8,%esp
+  80222f:	ff 75 0c             	push   0xc(%ebp)
+  802232:	56                   	push   %esi
+  802233:	ff d0                	call   *%eax
+  802235:	83 c4 10             	add    $0x10,%esp
+}
+  802238:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80223b:	5b                   	pop    %ebx
+  80223c:	5e                   	pop    %esi
+  80223d:	5d                   	pop    %ebp
+  80223e:	c3                   	ret
+  80223f:	89 e2                	mov    %esp,%edx
+  802241:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802246:	29 d0                	sub    %edx,%eax
+  802248:	89 c2                	mov    %eax,%edx
+  80224a:	c1 ea 0f             	shr    $0xf,%edx
+  80224d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802252:	b8 00 00 00 00       	mov    $0x0,%eax
+  802257:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80225a:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802261:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802264:	83 ec 04             	sub    $0x4,%esp
+  802267:	53                   	push   %ebx
+  802268:	50                   	push   %eax
+  802269:	68 cc 49 80 00       	push   $0x8049cc
+  80226e:	e8 23 e0 ff ff       	call   800296 <cprintf>
+		return -E_INVAL;
+  802273:	83 c4 10             	add    $0x10,%esp
+  802276:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80227b:	eb bb                	jmp    802238 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80227d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802282:	eb b4                	jmp    802238 <ftruncate+0x50>
+
+00802284 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802284:	55                   	push   %ebp
+  802285:	89 e5                	mov    %esp,%ebp
+  802287:	56                   	push   %esi
+  802288:	53                   	push   %ebx
+  802289:	83 ec 18             	sub    $0x18,%esp
+  80228c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80228f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802292:	50                   	push   %eax
+  802293:	ff 75 08             	push   0x8(%ebp)
+  802296:	e8 b4 fa ff ff       	call   801d4f <fd_lookup>
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	78 53                	js     8022f5 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022a2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022a5:	83 ec 08             	sub    $0x8,%esp
+  8022a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ab:	50                   	push   %eax
+  8022ac:	ff 36                	push   (%esi)
+  8022ae:	e8 ee fa ff ff       	call   801da1 <dev_lookup>
+  8022b3:	83 c4 10             	add    $0x10,%esp
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	78 3b                	js     8022f5 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8022ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022bd:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8022c1:	74 39                	je     8022fc <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8022c3:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8022c6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8022cd:	00 00 00 
+	stat->st_isdir = 0;
+  8022d0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022d7:	00 00 00 
+	stat->st_version = 0;
+  8022da:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8022e1:	00 00 00 
+	stat->st_dev = dev;
+  8022e4:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8022ea:	83 ec 08             	sub    $0x8,%esp
+  8022ed:	53                   	push   %ebx
+  8022ee:	56                   	push   %esi
+  8022ef:	ff 50 14             	call   *0x14(%eax)
+  8022f2:	83 c4 10             	add    $0x10,%esp
+}
+  8022f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f8:	5b                   	pop    %ebx
+  8022f9:	5e                   	pop    %esi
+  8022fa:	5d                   	pop    %ebp
+  8022fb:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022fc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802301:	eb f2                	jmp    8022f5 <fstat+0x71>
+
+00802303 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	56                   	push   %esi
+  802307:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802308:	83 ec 08             	sub    $0x8,%esp
+  80230b:	6a 00                	push   $0x0
+  80230d:	ff 75 08             	push   0x8(%ebp)
+  802310:	e8 b7 01 00 00       	call   8024cc <open>
+  802315:	89 c3                	mov    %eax,%ebx
+  802317:	83 c4 10             	add    $0x10,%esp
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	78 1b                	js     802339 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80231e:	83 ec 08             	sub    $0x8,%esp
+  802321:	ff 75 0c             	push   0xc(%ebp)
+  802324:	50                   	push   %eax
+  802325:	e8 5a ff ff ff       	call   802284 <fstat>
+  80232a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80232c:	89 1c 24             	mov    %ebx,(%esp)
+  80232f:	e8 60 fb ff ff       	call   801e94 <close>
+	return r;
+  802334:	83 c4 10             	add    $0x10,%esp
+  802337:	89 f3                	mov    %esi,%ebx
+}
+  802339:	89 d8                	mov    %ebx,%eax
+  80233b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80233e:	5b                   	pop    %ebx
+  80233f:	5e                   	pop    %esi
+  802340:	5d                   	pop    %ebp
+  802341:	c3                   	ret
+
+00802342 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802342:	55                   	push   %ebp
+  802343:	89 e5                	mov    %esp,%ebp
+  802345:	56                   	push   %esi
+  802346:	53                   	push   %ebx
+  802347:	89 c6                	mov    %eax,%esi
+  802349:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80234b:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802352:	74 27                	je     80237b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802354:	6a 07                	push   $0x7
+  802356:	68 00 70 80 00       	push   $0x807000
+  80235b:	56                   	push   %esi
+  80235c:	ff 35 c4 66 80 00    	push   0x8066c4
+  802362:	e8 c9 f8 ff ff       	call   801c30 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802367:	83 c4 0c             	add    $0xc,%esp
+  80236a:	6a 00                	push   $0x0
+  80236c:	53                   	push   %ebx
+  80236d:	6a 00                	push   $0x0
+  80236f:	e8 2c f6 ff ff       	call   8019a0 <ipc_recv>
+}
+  802374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802377:	5b                   	pop    %ebx
+  802378:	5e                   	pop    %esi
+  802379:	5d                   	pop    %ebp
+  80237a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80237b:	83 ec 0c             	sub    $0xc,%esp
+  80237e:	6a 02                	push   $0x2
+  802380:	e8 14 f9 ff ff       	call   801c99 <ipc_find_env>
+  802385:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	eb c5                	jmp    802354 <fsipc+0x12>
+
+0080238f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802395:	8b 45 08             	mov    0x8(%ebp),%eax
+  802398:	8b 40 0c             	mov    0xc(%eax),%eax
+  80239b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8023a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a3:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8023a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ad:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023b2:	e8 8b ff ff ff       	call   802342 <fsipc>
+}
+  8023b7:	c9                   	leave
+  8023b8:	c3                   	ret
+
+008023b9 <devfile_flush>:
+{
+  8023b9:	55                   	push   %ebp
+  8023ba:	89 e5                	mov    %esp,%ebp
+  8023bc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c5:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8023ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023cf:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023d4:	e8 69 ff ff ff       	call   802342 <fsipc>
+}
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+
+008023db <devfile_stat>:
+{
+  8023db:	55                   	push   %ebp
+  8023dc:	89 e5                	mov    %esp,%ebp
+  8023de:	53                   	push   %ebx
+  8023df:	83 ec 04             	sub    $0x4,%esp
+  8023e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023eb:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8023f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023fa:	e8 43 ff ff ff       	call   802342 <fsipc>
+  8023ff:	85 c0                	test   %eax,%eax
+  802401:	78 37                	js     80243a <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802403:	83 ec 08             	sub    $0x8,%esp
+  802406:	68 00 70 80 00       	push   $0x807000
+  80240b:	53                   	push   %ebx
+  80240c:	e8 7c e5 ff ff       	call   80098d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802411:	a1 80 70 80 00       	mov    0x807080,%eax
+  802416:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80241c:	a1 84 70 80 00       	mov    0x807084,%eax
+  802421:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802427:	a1 88 70 80 00       	mov    0x807088,%eax
+  80242c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80243a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80243d:	c9                   	leave
+  80243e:	c3                   	ret
+
+0080243f <devfile_write>:
+{
+  80243f:	55                   	push   %ebp
+  802440:	89 e5                	mov    %esp,%ebp
+  802442:	83 ec 0c             	sub    $0xc,%esp
+  802445:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802448:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80244d:	39 d0                	cmp    %edx,%eax
+  80244f:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802452:	8b 55 08             	mov    0x8(%ebp),%edx
+  802455:	8b 52 0c             	mov    0xc(%edx),%edx
+  802458:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80245e:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802463:	50                   	push   %eax
+  802464:	ff 75 0c             	push   0xc(%ebp)
+  802467:	68 08 70 80 00       	push   $0x807008
+  80246c:	e8 cc e6 ff ff       	call   800b3d <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802471:	ba 00 00 00 00       	mov    $0x0,%edx
+  802476:	b8 04 00 00 00       	mov    $0x4,%eax
+  80247b:	e8 c2 fe ff ff       	call   802342 <fsipc>
+}
+  802480:	c9                   	leave
+  802481:	c3                   	ret
+
+00802482 <devfile_read>:
+{
+  802482:	55                   	push   %ebp
+  802483:	89 e5                	mov    %esp,%ebp
+  802485:	53                   	push   %ebx
+  802486:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802489:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80248f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802494:	8b 45 10             	mov    0x10(%ebp),%eax
+  802497:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80249c:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8024a1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024a6:	e8 97 fe ff ff       	call   802342 <fsipc>
+  8024ab:	89 c3                	mov    %eax,%ebx
+  8024ad:	85 c0                	test   %eax,%eax
+  8024af:	78 14                	js     8024c5 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8024b1:	83 ec 04             	sub    $0x4,%esp
+  8024b4:	50                   	push   %eax
+  8024b5:	68 00 70 80 00       	push   $0x807000
+  8024ba:	ff 75 0c             	push   0xc(%ebp)
+  8024bd:	e8 7b e6 ff ff       	call   800b3d <memmove>
+	return r;
+  8024c2:	83 c4 10             	add    $0x10,%esp
+}
+  8024c5:	89 d8                	mov    %ebx,%eax
+  8024c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ca:	c9                   	leave
+  8024cb:	c3                   	ret
+
+008024cc <open>:
+{
+  8024cc:	55                   	push   %ebp
+  8024cd:	89 e5                	mov    %esp,%ebp
+  8024cf:	53                   	push   %ebx
+  8024d0:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8024d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d6:	50                   	push   %eax
+  8024d7:	e8 23 f8 ff ff       	call   801cff <fd_alloc>
+  8024dc:	89 c3                	mov    %eax,%ebx
+  8024de:	83 c4 10             	add    $0x10,%esp
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	78 2a                	js     80250f <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8024e5:	83 ec 0c             	sub    $0xc,%esp
+  8024e8:	ff 75 08             	push   0x8(%ebp)
+  8024eb:	e8 51 e4 ff ff       	call   800941 <strlen>
+  8024f0:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8024f3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8024f8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8024fd:	7e 17                	jle    802516 <open+0x4a>
+	fd_close(fd, 1);
+  8024ff:	83 ec 08             	sub    $0x8,%esp
+  802502:	6a 01                	push   $0x1
+  802504:	ff 75 f4             	push   -0xc(%ebp)
+  802507:	e8 08 f9 ff ff       	call   801e14 <fd_close>
+	return r;
+  80250c:	83 c4 10             	add    $0x10,%esp
+}
+  80250f:	89 d8                	mov    %ebx,%eax
+  802511:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802514:	c9                   	leave
+  802515:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802516:	83 ec 08             	sub    $0x8,%esp
+  802519:	ff 75 08             	push   0x8(%ebp)
+  80251c:	68 00 70 80 00       	push   $0x807000
+  802521:	e8 67 e4 ff ff       	call   80098d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802526:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802529:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  80252e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802531:	b8 01 00 00 00       	mov    $0x1,%eax
+  802536:	e8 07 fe ff ff       	call   802342 <fsipc>
+  80253b:	89 c3                	mov    %eax,%ebx
+  80253d:	83 c4 10             	add    $0x10,%esp
+  802540:	85 c0                	test   %eax,%eax
+  802542:	78 bb                	js     8024ff <open+0x33>
+	return fd2num(fd); 	
+  802544:	83 ec 0c             	sub    $0xc,%esp
+  802547:	ff 75 f4             	push   -0xc(%ebp)
+  80254a:	e8 89 f7 ff ff       	call   801cd8 <fd2num>
+  80254f:	89 c3                	mov    %eax,%ebx
+  802551:	83 c4 10             	add    $0x10,%esp
+  802554:	eb b9                	jmp    80250f <open+0x43>
+
+00802556 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802556:	55                   	push   %ebp
+  802557:	89 e5                	mov    %esp,%ebp
+  802559:	53                   	push   %ebx
+  80255a:	83 ec 1c             	sub    $0x1c,%esp
+  80255d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802560:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802563:	50                   	push   %eax
+  802564:	ff 75 08             	push   0x8(%ebp)
+  802567:	e8 e3 f7 ff ff       	call   801d4f <fd_lookup>
+  80256c:	83 c4 10             	add    $0x10,%esp
+  80256f:	85 c0                	test   %eax,%eax
+  802571:	78 5a                	js     8025cd <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802573:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802576:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80257c:	39 10                	cmp    %edx,(%eax)
+  80257e:	75 66                	jne    8025e6 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802580:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802587:	74 49                	je     8025d2 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802589:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80258c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80258f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802594:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802597:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  80259c:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8025a2:	6a 07                	push   $0x7
+  8025a4:	68 00 70 80 00       	push   $0x807000
+  8025a9:	6a 09                	push   $0x9
+  8025ab:	ff 35 c4 66 80 00    	push   0x8066c4
+  8025b1:	e8 7a f6 ff ff       	call   801c30 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8025b6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8025bd:	6a 00                	push   $0x0
+  8025bf:	53                   	push   %ebx
+  8025c0:	ff 75 10             	push   0x10(%ebp)
+  8025c3:	6a 00                	push   $0x0
+  8025c5:	e8 a3 f4 ff ff       	call   801a6d <ipc_recv_pages>
+  8025ca:	83 c4 20             	add    $0x20,%esp
+}
+  8025cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025d0:	c9                   	leave
+  8025d1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025d2:	83 ec 0c             	sub    $0xc,%esp
+  8025d5:	6a 02                	push   $0x2
+  8025d7:	e8 bd f6 ff ff       	call   801c99 <ipc_find_env>
+  8025dc:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  8025e1:	83 c4 10             	add    $0x10,%esp
+  8025e4:	eb a3                	jmp    802589 <fmap+0x33>
+		return -E_INVAL;
+  8025e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025eb:	eb e0                	jmp    8025cd <fmap+0x77>
+
+008025ed <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8025ed:	55                   	push   %ebp
+  8025ee:	89 e5                	mov    %esp,%ebp
+  8025f0:	53                   	push   %ebx
+  8025f1:	83 ec 10             	sub    $0x10,%esp
+  8025f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8025f7:	53                   	push   %ebx
+  8025f8:	e8 44 e3 ff ff       	call   800941 <strlen>
+  8025fd:	83 c4 10             	add    $0x10,%esp
+  802600:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802605:	7f 25                	jg     80262c <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802607:	83 ec 08             	sub    $0x8,%esp
+  80260a:	53                   	push   %ebx
+  80260b:	68 00 70 80 00       	push   $0x807000
+  802610:	e8 78 e3 ff ff       	call   80098d <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80261f:	e8 1e fd ff ff       	call   802342 <fsipc>
+  802624:	83 c4 10             	add    $0x10,%esp
+}
+  802627:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80262a:	c9                   	leave
+  80262b:	c3                   	ret
+		return -E_BAD_PATH;
+  80262c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802631:	eb f4                	jmp    802627 <remove+0x3a>
+
+00802633 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802633:	55                   	push   %ebp
+  802634:	89 e5                	mov    %esp,%ebp
+  802636:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802639:	ba 00 00 00 00       	mov    $0x0,%edx
+  80263e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802643:	e8 fa fc ff ff       	call   802342 <fsipc>
+}
+  802648:	c9                   	leave
+  802649:	c3                   	ret
+
+0080264a <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80264a:	55                   	push   %ebp
+  80264b:	89 e5                	mov    %esp,%ebp
+  80264d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802650:	68 3c 4a 80 00       	push   $0x804a3c
+  802655:	ff 75 0c             	push   0xc(%ebp)
+  802658:	e8 30 e3 ff ff       	call   80098d <strcpy>
+	return 0;
+}
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+
+00802664 <devsock_close>:
+{
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	53                   	push   %ebx
+  802668:	83 ec 10             	sub    $0x10,%esp
+  80266b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80266e:	53                   	push   %ebx
+  80266f:	e8 23 1c 00 00       	call   804297 <pageref>
+  802674:	89 c2                	mov    %eax,%edx
+  802676:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802679:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80267e:	83 fa 01             	cmp    $0x1,%edx
+  802681:	74 05                	je     802688 <devsock_close+0x24>
+}
+  802683:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802686:	c9                   	leave
+  802687:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802688:	83 ec 0c             	sub    $0xc,%esp
+  80268b:	ff 73 0c             	push   0xc(%ebx)
+  80268e:	e8 b0 05 00 00       	call   802c43 <nsipc_close>
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	eb eb                	jmp    802683 <devsock_close+0x1f>
+
+00802698 <devsock_write>:
+{
+  802698:	55                   	push   %ebp
+  802699:	89 e5                	mov    %esp,%ebp
+  80269b:	53                   	push   %ebx
+  80269c:	83 ec 14             	sub    $0x14,%esp
+  80269f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026a5:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8026a8:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8026ab:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8026ae:	8b 41 08             	mov    0x8(%ecx),%eax
+  8026b1:	c1 f8 09             	sar    $0x9,%eax
+  8026b4:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8026b7:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8026bd:	77 13                	ja     8026d2 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8026bf:	50                   	push   %eax
+  8026c0:	52                   	push   %edx
+  8026c1:	53                   	push   %ebx
+  8026c2:	ff 71 0c             	push   0xc(%ecx)
+  8026c5:	e8 5c 06 00 00       	call   802d26 <nsipc_send>
+  8026ca:	83 c4 10             	add    $0x10,%esp
+}
+  8026cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8026d2:	50                   	push   %eax
+  8026d3:	6a 01                	push   $0x1
+  8026d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026d8:	50                   	push   %eax
+  8026d9:	ff 71 0c             	push   0xc(%ecx)
+  8026dc:	e8 a6 06 00 00       	call   802d87 <nsipc_sendmsg>
+  8026e1:	83 c4 10             	add    $0x10,%esp
+  8026e4:	eb e7                	jmp    8026cd <devsock_write+0x35>
+
+008026e6 <devsock_read>:
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	53                   	push   %ebx
+  8026ea:	83 ec 14             	sub    $0x14,%esp
+  8026ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026f3:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8026f6:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8026f9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8026fc:	8b 41 08             	mov    0x8(%ecx),%eax
+  8026ff:	c1 f8 09             	sar    $0x9,%eax
+  802702:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802705:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80270b:	77 13                	ja     802720 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  80270d:	50                   	push   %eax
+  80270e:	52                   	push   %edx
+  80270f:	53                   	push   %ebx
+  802710:	ff 71 0c             	push   0xc(%ecx)
+  802713:	e8 9c 05 00 00       	call   802cb4 <nsipc_recv>
+  802718:	83 c4 10             	add    $0x10,%esp
+}
+  80271b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80271e:	c9                   	leave
+  80271f:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802720:	50                   	push   %eax
+  802721:	6a 01                	push   $0x1
+  802723:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802726:	50                   	push   %eax
+  802727:	ff 71 0c             	push   0xc(%ecx)
+  80272a:	e8 02 0a 00 00       	call   803131 <nsipc_recvmsg>
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	eb e7                	jmp    80271b <devsock_read+0x35>
+
+00802734 <fd2sockid>:
+{
+  802734:	55                   	push   %ebp
+  802735:	89 e5                	mov    %esp,%ebp
+  802737:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80273a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80273d:	52                   	push   %edx
+  80273e:	50                   	push   %eax
+  80273f:	e8 0b f6 ff ff       	call   801d4f <fd_lookup>
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	85 c0                	test   %eax,%eax
+  802749:	78 10                	js     80275b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80274b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80274e:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802754:	39 08                	cmp    %ecx,(%eax)
+  802756:	75 05                	jne    80275d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802758:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80275b:	c9                   	leave
+  80275c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80275d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802762:	eb f7                	jmp    80275b <fd2sockid+0x27>
+
+00802764 <sock_flags>:
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  80276a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80276d:	52                   	push   %edx
+  80276e:	50                   	push   %eax
+  80276f:	e8 db f5 ff ff       	call   801d4f <fd_lookup>
+  802774:	83 c4 10             	add    $0x10,%esp
+  802777:	85 c0                	test   %eax,%eax
+  802779:	78 0e                	js     802789 <sock_flags+0x25>
+  80277b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80277e:	8b 40 08             	mov    0x8(%eax),%eax
+  802781:	c1 e8 09             	shr    $0x9,%eax
+  802784:	83 e0 08             	and    $0x8,%eax
+}
+  802787:	c9                   	leave
+  802788:	c3                   	ret
+		return 0;
+  802789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278e:	eb f7                	jmp    802787 <sock_flags+0x23>
+
+00802790 <alloc_sockfd>:
+{
+  802790:	55                   	push   %ebp
+  802791:	89 e5                	mov    %esp,%ebp
+  802793:	56                   	push   %esi
+  802794:	53                   	push   %ebx
+  802795:	83 ec 1c             	sub    $0x1c,%esp
+  802798:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80279a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80279d:	50                   	push   %eax
+  80279e:	e8 5c f5 ff ff       	call   801cff <fd_alloc>
+  8027a3:	89 c3                	mov    %eax,%ebx
+  8027a5:	83 c4 10             	add    $0x10,%esp
+  8027a8:	85 c0                	test   %eax,%eax
+  8027aa:	78 43                	js     8027ef <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027ac:	83 ec 04             	sub    $0x4,%esp
+  8027af:	68 07 04 00 00       	push   $0x407
+  8027b4:	ff 75 f4             	push   -0xc(%ebp)
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	e8 03 e6 ff ff       	call   800dc1 <sys_page_alloc>
+  8027be:	89 c3                	mov    %eax,%ebx
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	78 28                	js     8027ef <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8027c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027ca:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8027d0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8027d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8027dc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8027df:	83 ec 0c             	sub    $0xc,%esp
+  8027e2:	50                   	push   %eax
+  8027e3:	e8 f0 f4 ff ff       	call   801cd8 <fd2num>
+  8027e8:	89 c3                	mov    %eax,%ebx
+  8027ea:	83 c4 10             	add    $0x10,%esp
+  8027ed:	eb 0c                	jmp    8027fb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8027ef:	83 ec 0c             	sub    $0xc,%esp
+  8027f2:	56                   	push   %esi
+  8027f3:	e8 4b 04 00 00       	call   802c43 <nsipc_close>
+		return r;
+  8027f8:	83 c4 10             	add    $0x10,%esp
+}
+  8027fb:	89 d8                	mov    %ebx,%eax
+  8027fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802800:	5b                   	pop    %ebx
+  802801:	5e                   	pop    %esi
+  802802:	5d                   	pop    %ebp
+  802803:	c3                   	ret
+
+00802804 <accept>:
+{
+  802804:	55                   	push   %ebp
+  802805:	89 e5                	mov    %esp,%ebp
+  802807:	56                   	push   %esi
+  802808:	53                   	push   %ebx
+  802809:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80280c:	89 f0                	mov    %esi,%eax
+  80280e:	e8 21 ff ff ff       	call   802734 <fd2sockid>
+  802813:	89 c3                	mov    %eax,%ebx
+  802815:	85 c0                	test   %eax,%eax
+  802817:	78 24                	js     80283d <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802819:	89 f0                	mov    %esi,%eax
+  80281b:	e8 44 ff ff ff       	call   802764 <sock_flags>
+  802820:	50                   	push   %eax
+  802821:	ff 75 10             	push   0x10(%ebp)
+  802824:	ff 75 0c             	push   0xc(%ebp)
+  802827:	53                   	push   %ebx
+  802828:	e8 6b 03 00 00       	call   802b98 <nsipc_accept>
+  80282d:	89 c3                	mov    %eax,%ebx
+  80282f:	83 c4 10             	add    $0x10,%esp
+  802832:	85 c0                	test   %eax,%eax
+  802834:	78 07                	js     80283d <accept+0x39>
+	return alloc_sockfd(r);
+  802836:	e8 55 ff ff ff       	call   802790 <alloc_sockfd>
+  80283b:	89 c3                	mov    %eax,%ebx
+}
+  80283d:	89 d8                	mov    %ebx,%eax
+  80283f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802842:	5b                   	pop    %ebx
+  802843:	5e                   	pop    %esi
+  802844:	5d                   	pop    %ebp
+  802845:	c3                   	ret
+
+00802846 <bind>:
+{
+  802846:	55                   	push   %ebp
+  802847:	89 e5                	mov    %esp,%ebp
+  802849:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80284c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284f:	e8 e0 fe ff ff       	call   802734 <fd2sockid>
+  802854:	85 c0                	test   %eax,%eax
+  802856:	78 12                	js     80286a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802858:	83 ec 04             	sub    $0x4,%esp
+  80285b:	ff 75 10             	push   0x10(%ebp)
+  80285e:	ff 75 0c             	push   0xc(%ebp)
+  802861:	50                   	push   %eax
+  802862:	e8 85 03 00 00       	call   802bec <nsipc_bind>
+  802867:	83 c4 10             	add    $0x10,%esp
+}
+  80286a:	c9                   	leave
+  80286b:	c3                   	ret
+
+0080286c <shutdown>:
+{
+  80286c:	55                   	push   %ebp
+  80286d:	89 e5                	mov    %esp,%ebp
+  80286f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802872:	8b 45 08             	mov    0x8(%ebp),%eax
+  802875:	e8 ba fe ff ff       	call   802734 <fd2sockid>
+  80287a:	85 c0                	test   %eax,%eax
+  80287c:	78 0f                	js     80288d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80287e:	83 ec 08             	sub    $0x8,%esp
+  802881:	ff 75 0c             	push   0xc(%ebp)
+  802884:	50                   	push   %eax
+  802885:	e8 97 03 00 00       	call   802c21 <nsipc_shutdown>
+  80288a:	83 c4 10             	add    $0x10,%esp
+}
+  80288d:	c9                   	leave
+  80288e:	c3                   	ret
+
+0080288f <connect>:
+{
+  80288f:	55                   	push   %ebp
+  802890:	89 e5                	mov    %esp,%ebp
+  802892:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802895:	8b 45 08             	mov    0x8(%ebp),%eax
+  802898:	e8 97 fe ff ff       	call   802734 <fd2sockid>
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 12                	js     8028b3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028a1:	83 ec 04             	sub    $0x4,%esp
+  8028a4:	ff 75 10             	push   0x10(%ebp)
+  8028a7:	ff 75 0c             	push   0xc(%ebp)
+  8028aa:	50                   	push   %eax
+  8028ab:	e8 ad 03 00 00       	call   802c5d <nsipc_connect>
+  8028b0:	83 c4 10             	add    $0x10,%esp
+}
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+008028b5 <listen>:
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028be:	e8 71 fe ff ff       	call   802734 <fd2sockid>
+  8028c3:	85 c0                	test   %eax,%eax
+  8028c5:	78 0f                	js     8028d6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8028c7:	83 ec 08             	sub    $0x8,%esp
+  8028ca:	ff 75 0c             	push   0xc(%ebp)
+  8028cd:	50                   	push   %eax
+  8028ce:	e8 bf 03 00 00       	call   802c92 <nsipc_listen>
+  8028d3:	83 c4 10             	add    $0x10,%esp
+}
+  8028d6:	c9                   	leave
+  8028d7:	c3                   	ret
+
+008028d8 <sendmsg>:
+{
+  8028d8:	55                   	push   %ebp
+  8028d9:	89 e5                	mov    %esp,%ebp
+  8028db:	57                   	push   %edi
+  8028dc:	56                   	push   %esi
+  8028dd:	53                   	push   %ebx
+  8028de:	83 ec 0c             	sub    $0xc,%esp
+  8028e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8028e7:	89 f0                	mov    %esi,%eax
+  8028e9:	e8 46 fe ff ff       	call   802734 <fd2sockid>
+  8028ee:	89 c3                	mov    %eax,%ebx
+  8028f0:	85 c0                	test   %eax,%eax
+  8028f2:	78 1c                	js     802910 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8028f4:	89 f0                	mov    %esi,%eax
+  8028f6:	e8 69 fe ff ff       	call   802764 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8028fb:	0b 45 10             	or     0x10(%ebp),%eax
+  8028fe:	50                   	push   %eax
+  8028ff:	ff 77 0c             	push   0xc(%edi)
+  802902:	ff 77 08             	push   0x8(%edi)
+  802905:	53                   	push   %ebx
+  802906:	e8 7c 04 00 00       	call   802d87 <nsipc_sendmsg>
+  80290b:	89 c3                	mov    %eax,%ebx
+  80290d:	83 c4 10             	add    $0x10,%esp
+}
+  802910:	89 d8                	mov    %ebx,%eax
+  802912:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802915:	5b                   	pop    %ebx
+  802916:	5e                   	pop    %esi
+  802917:	5f                   	pop    %edi
+  802918:	5d                   	pop    %ebp
+  802919:	c3                   	ret
+
+0080291a <recvmsg>:
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	57                   	push   %edi
+  80291e:	56                   	push   %esi
+  80291f:	53                   	push   %ebx
+  802920:	83 ec 0c             	sub    $0xc,%esp
+  802923:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802926:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802929:	89 f8                	mov    %edi,%eax
+  80292b:	e8 04 fe ff ff       	call   802734 <fd2sockid>
+  802930:	89 c3                	mov    %eax,%ebx
+  802932:	85 c0                	test   %eax,%eax
+  802934:	78 2a                	js     802960 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802936:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80293d:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802944:	89 f8                	mov    %edi,%eax
+  802946:	e8 19 fe ff ff       	call   802764 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80294b:	0b 45 10             	or     0x10(%ebp),%eax
+  80294e:	50                   	push   %eax
+  80294f:	ff 76 0c             	push   0xc(%esi)
+  802952:	ff 76 08             	push   0x8(%esi)
+  802955:	53                   	push   %ebx
+  802956:	e8 d6 07 00 00       	call   803131 <nsipc_recvmsg>
+  80295b:	89 c3                	mov    %eax,%ebx
+  80295d:	83 c4 10             	add    $0x10,%esp
+}
+  802960:	89 d8                	mov    %ebx,%eax
+  802962:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802965:	5b                   	pop    %ebx
+  802966:	5e                   	pop    %esi
+  802967:	5f                   	pop    %edi
+  802968:	5d                   	pop    %ebp
+  802969:	c3                   	ret
+
+0080296a <sendfile>:
+{
+  80296a:	55                   	push   %ebp
+  80296b:	89 e5                	mov    %esp,%ebp
+  80296d:	56                   	push   %esi
+  80296e:	53                   	push   %ebx
+  80296f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802972:	89 f0                	mov    %esi,%eax
+  802974:	e8 bb fd ff ff       	call   802734 <fd2sockid>
+  802979:	89 c3                	mov    %eax,%ebx
+  80297b:	85 c0                	test   %eax,%eax
+  80297d:	78 1f                	js     80299e <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80297f:	89 f0                	mov    %esi,%eax
+  802981:	e8 de fd ff ff       	call   802764 <sock_flags>
+  802986:	83 ec 0c             	sub    $0xc,%esp
+  802989:	50                   	push   %eax
+  80298a:	ff 75 14             	push   0x14(%ebp)
+  80298d:	ff 75 10             	push   0x10(%ebp)
+  802990:	ff 75 0c             	push   0xc(%ebp)
+  802993:	53                   	push   %ebx
+  802994:	e8 64 06 00 00       	call   802ffd <nsipc_sendfile>
+  802999:	89 c3                	mov    %eax,%ebx
+  80299b:	83 c4 20             	add    $0x20,%esp
+}
+  80299e:	89 d8                	mov    %ebx,%eax
+  8029a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029a3:	5b                   	pop    %ebx
+  8029a4:	5e                   	pop    %esi
+  8029a5:	5d                   	pop    %ebp
+  8029a6:	c3                   	ret
+
+008029a7 <evctl>:
+{
+  8029a7:	55                   	push   %ebp
+  8029a8:	89 e5                	mov    %esp,%ebp
+  8029aa:	53                   	push   %ebx
+  8029ab:	83 ec 04             	sub    $0x4,%esp
+  8029ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8029b1:	89 d8                	mov    %ebx,%eax
+  8029b3:	e8 7c fd ff ff       	call   802734 <fd2sockid>
+  8029b8:	85 c0                	test   %eax,%eax
+  8029ba:	78 10                	js     8029cc <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8029bc:	83 ec 04             	sub    $0x4,%esp
+  8029bf:	53                   	push   %ebx
+  8029c0:	ff 75 0c             	push   0xc(%ebp)
+  8029c3:	50                   	push   %eax
+  8029c4:	e8 d2 0b 00 00       	call   80359b <nsipc_evctl>
+  8029c9:	83 c4 10             	add    $0x10,%esp
+}
+  8029cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029cf:	c9                   	leave
+  8029d0:	c3                   	ret
+
+008029d1 <evwait>:
+{
+  8029d1:	55                   	push   %ebp
+  8029d2:	89 e5                	mov    %esp,%ebp
+  8029d4:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8029d7:	ff 75 10             	push   0x10(%ebp)
+  8029da:	ff 75 0c             	push   0xc(%ebp)
+  8029dd:	ff 75 08             	push   0x8(%ebp)
+  8029e0:	e8 e0 0b 00 00       	call   8035c5 <nsipc_evwait>
+}
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+
+008029e7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029e7:	55                   	push   %ebp
+  8029e8:	89 e5                	mov    %esp,%ebp
+  8029ea:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029ed:	ff 75 10             	push   0x10(%ebp)
+  8029f0:	ff 75 0c             	push   0xc(%ebp)
+  8029f3:	ff 75 08             	push   0x8(%ebp)
+  8029f6:	e8 31 0c 00 00       	call   80362c <nsipc_socket>
+  8029fb:	83 c4 10             	add    $0x10,%esp
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	78 05                	js     802a07 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a02:	e8 89 fd ff ff       	call   802790 <alloc_sockfd>
+}
+  802a07:	c9                   	leave
+  802a08:	c3                   	ret
+
+00802a09 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a09:	55                   	push   %ebp
+  802a0a:	89 e5                	mov    %esp,%ebp
+  802a0c:	53                   	push   %ebx
+  802a0d:	83 ec 04             	sub    $0x4,%esp
+  802a10:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802a12:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802a19:	74 26                	je     802a41 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a1b:	6a 07                	push   $0x7
+  802a1d:	68 00 80 80 00       	push   $0x808000
+  802a22:	53                   	push   %ebx
+  802a23:	ff 35 e4 69 80 00    	push   0x8069e4
+  802a29:	e8 02 f2 ff ff       	call   801c30 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a2e:	83 c4 0c             	add    $0xc,%esp
+  802a31:	6a 00                	push   $0x0
+  802a33:	6a 00                	push   $0x0
+  802a35:	6a 00                	push   $0x0
+  802a37:	e8 64 ef ff ff       	call   8019a0 <ipc_recv>
+}
+  802a3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a3f:	c9                   	leave
+  802a40:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a41:	83 ec 0c             	sub    $0xc,%esp
+  802a44:	6a 03                	push   $0x3
+  802a46:	e8 4e f2 ff ff       	call   801c99 <ipc_find_env>
+  802a4b:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802a50:	83 c4 10             	add    $0x10,%esp
+  802a53:	eb c6                	jmp    802a1b <nsipc+0x12>
+
+00802a55 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802a55:	55                   	push   %ebp
+  802a56:	89 e5                	mov    %esp,%ebp
+  802a58:	56                   	push   %esi
+  802a59:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802a5a:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  802a60:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802a65:	85 f6                	test   %esi,%esi
+  802a67:	75 33                	jne    802a9c <nsbulk_map+0x47>
+  802a69:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802a6e:	83 ec 04             	sub    $0x4,%esp
+  802a71:	6a 07                	push   $0x7
+  802a73:	53                   	push   %ebx
+  802a74:	6a 00                	push   $0x0
+  802a76:	e8 46 e3 ff ff       	call   800dc1 <sys_page_alloc>
+  802a7b:	83 c4 10             	add    $0x10,%esp
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	78 1a                	js     802a9c <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802a82:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a88:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802a8e:	75 de                	jne    802a6e <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802a90:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802a97:	00 00 00 
+	return 0;
+  802a9a:	89 f0                	mov    %esi,%eax
+}
+  802a9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a9f:	5b                   	pop    %ebx
+  802aa0:	5e                   	pop    %esi
+  802aa1:	5d                   	pop    %ebp
+  802aa2:	c3                   	ret
+
+00802aa3 <nsbulk_own>:
+{
+  802aa3:	55                   	push   %ebp
+  802aa4:	89 e5                	mov    %esp,%ebp
+  802aa6:	57                   	push   %edi
+  802aa7:	56                   	push   %esi
+  802aa8:	53                   	push   %ebx
+  802aa9:	83 ec 0c             	sub    $0xc,%esp
+  802aac:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802aae:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802ab1:	85 d2                	test   %edx,%edx
+  802ab3:	7f 0e                	jg     802ac3 <nsbulk_own+0x20>
+	return 0;
+  802ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aba:	eb 47                	jmp    802b03 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802abc:	83 c3 01             	add    $0x1,%ebx
+  802abf:	39 fb                	cmp    %edi,%ebx
+  802ac1:	7d 3b                	jge    802afe <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802ac3:	be 01 00 00 00       	mov    $0x1,%esi
+  802ac8:	89 d9                	mov    %ebx,%ecx
+  802aca:	d3 e6                	shl    %cl,%esi
+  802acc:	89 f0                	mov    %esi,%eax
+  802ace:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802ad4:	74 e6                	je     802abc <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802ad6:	83 ec 04             	sub    $0x4,%esp
+  802ad9:	6a 07                	push   $0x7
+  802adb:	89 d8                	mov    %ebx,%eax
+  802add:	c1 e0 0c             	shl    $0xc,%eax
+  802ae0:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802ae5:	50                   	push   %eax
+  802ae6:	6a 00                	push   $0x0
+  802ae8:	e8 d4 e2 ff ff       	call   800dc1 <sys_page_alloc>
+  802aed:	83 c4 10             	add    $0x10,%esp
+  802af0:	85 c0                	test   %eax,%eax
+  802af2:	78 0f                	js     802b03 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802af4:	f7 d6                	not    %esi
+  802af6:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802afc:	eb be                	jmp    802abc <nsbulk_own+0x19>
+	return 0;
+  802afe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b06:	5b                   	pop    %ebx
+  802b07:	5e                   	pop    %esi
+  802b08:	5f                   	pop    %edi
+  802b09:	5d                   	pop    %ebp
+  802b0a:	c3                   	ret
+
+00802b0b <nsipc_bulk>:
+{
+  802b0b:	55                   	push   %ebp
+  802b0c:	89 e5                	mov    %esp,%ebp
+  802b0e:	57                   	push   %edi
+  802b0f:	56                   	push   %esi
+  802b10:	53                   	push   %ebx
+  802b11:	83 ec 1c             	sub    $0x1c,%esp
+  802b14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b17:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802b19:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802b1f:	c1 fb 0c             	sar    $0xc,%ebx
+  802b22:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802b25:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802b2c:	74 56                	je     802b84 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802b2e:	85 ff                	test   %edi,%edi
+  802b30:	7e 24                	jle    802b56 <nsipc_bulk+0x4b>
+  802b32:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802b38:	74 1c                	je     802b56 <nsipc_bulk+0x4b>
+  802b3a:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802b40:	c1 e3 0c             	shl    $0xc,%ebx
+  802b43:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802b48:	0f b6 10             	movzbl (%eax),%edx
+  802b4b:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802b4d:	05 00 10 00 00       	add    $0x1000,%eax
+  802b52:	39 d8                	cmp    %ebx,%eax
+  802b54:	75 f2                	jne    802b48 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802b56:	83 ec 0c             	sub    $0xc,%esp
+  802b59:	56                   	push   %esi
+  802b5a:	57                   	push   %edi
+  802b5b:	68 00 00 00 e0       	push   $0xe0000000
+  802b60:	ff 75 e4             	push   -0x1c(%ebp)
+  802b63:	ff 35 e4 69 80 00    	push   0x8069e4
+  802b69:	e8 f6 f0 ff ff       	call   801c64 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802b6e:	83 c4 1c             	add    $0x1c,%esp
+  802b71:	6a 00                	push   $0x0
+  802b73:	6a 00                	push   $0x0
+  802b75:	6a 00                	push   $0x0
+  802b77:	e8 24 ee ff ff       	call   8019a0 <ipc_recv>
+}
+  802b7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7f:	5b                   	pop    %ebx
+  802b80:	5e                   	pop    %esi
+  802b81:	5f                   	pop    %edi
+  802b82:	5d                   	pop    %ebp
+  802b83:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b84:	83 ec 0c             	sub    $0xc,%esp
+  802b87:	6a 03                	push   $0x3
+  802b89:	e8 0b f1 ff ff       	call   801c99 <ipc_find_env>
+  802b8e:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802b93:	83 c4 10             	add    $0x10,%esp
+  802b96:	eb 96                	jmp    802b2e <nsipc_bulk+0x23>
+
+00802b98 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802b98:	55                   	push   %ebp
+  802b99:	89 e5                	mov    %esp,%ebp
+  802b9b:	53                   	push   %ebx
+  802b9c:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802ba7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802baa:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802baf:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bb4:	e8 50 fe ff ff       	call   802a09 <nsipc>
+  802bb9:	89 c3                	mov    %eax,%ebx
+  802bbb:	85 c0                	test   %eax,%eax
+  802bbd:	79 07                	jns    802bc6 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802bbf:	89 d8                	mov    %ebx,%eax
+  802bc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc4:	c9                   	leave
+  802bc5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802bc6:	83 ec 04             	sub    $0x4,%esp
+  802bc9:	ff 35 10 80 80 00    	push   0x808010
+  802bcf:	68 00 80 80 00       	push   $0x808000
+  802bd4:	ff 75 0c             	push   0xc(%ebp)
+  802bd7:	e8 61 df ff ff       	call   800b3d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802bdc:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802be2:	8b 45 10             	mov    0x10(%ebp),%eax
+  802be5:	89 10                	mov    %edx,(%eax)
+  802be7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802bea:	eb d3                	jmp    802bbf <nsipc_accept+0x27>
+
+00802bec <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	53                   	push   %ebx
+  802bf0:	83 ec 08             	sub    $0x8,%esp
+  802bf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf9:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802bfe:	53                   	push   %ebx
+  802bff:	ff 75 0c             	push   0xc(%ebp)
+  802c02:	68 04 80 80 00       	push   $0x808004
+  802c07:	e8 31 df ff ff       	call   800b3d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c0c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802c12:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c17:	e8 ed fd ff ff       	call   802a09 <nsipc>
+}
+  802c1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c1f:	c9                   	leave
+  802c20:	c3                   	ret
+
+00802c21 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802c2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c32:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c37:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c3c:	e8 c8 fd ff ff       	call   802a09 <nsipc>
+}
+  802c41:	c9                   	leave
+  802c42:	c3                   	ret
+
+00802c43 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802c51:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c56:	e8 ae fd ff ff       	call   802a09 <nsipc>
+}
+  802c5b:	c9                   	leave
+  802c5c:	c3                   	ret
+
+00802c5d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c5d:	55                   	push   %ebp
+  802c5e:	89 e5                	mov    %esp,%ebp
+  802c60:	53                   	push   %ebx
+  802c61:	83 ec 08             	sub    $0x8,%esp
+  802c64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6a:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c6f:	53                   	push   %ebx
+  802c70:	ff 75 0c             	push   0xc(%ebp)
+  802c73:	68 04 80 80 00       	push   $0x808004
+  802c78:	e8 c0 de ff ff       	call   800b3d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c7d:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802c83:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c88:	e8 7c fd ff ff       	call   802a09 <nsipc>
+}
+  802c8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c90:	c9                   	leave
+  802c91:	c3                   	ret
+
+00802c92 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802c92:	55                   	push   %ebp
+  802c93:	89 e5                	mov    %esp,%ebp
+  802c95:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802c98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ca0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ca3:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ca8:	b8 06 00 00 00       	mov    $0x6,%eax
+  802cad:	e8 57 fd ff ff       	call   802a09 <nsipc>
+}
+  802cb2:	c9                   	leave
+  802cb3:	c3                   	ret
+
+00802cb4 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802cb4:	55                   	push   %ebp
+  802cb5:	89 e5                	mov    %esp,%ebp
+  802cb7:	56                   	push   %esi
+  802cb8:	53                   	push   %ebx
+  802cb9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cbf:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802cc4:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802cca:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ccd:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802cd2:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cd7:	e8 2d fd ff ff       	call   802a09 <nsipc>
+  802cdc:	89 c3                	mov    %eax,%ebx
+  802cde:	85 c0                	test   %eax,%eax
+  802ce0:	78 22                	js     802d04 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ce2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ce7:	39 c6                	cmp    %eax,%esi
+  802ce9:	0f 4e c6             	cmovle %esi,%eax
+  802cec:	39 c3                	cmp    %eax,%ebx
+  802cee:	7f 1d                	jg     802d0d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802cf0:	83 ec 04             	sub    $0x4,%esp
+  802cf3:	53                   	push   %ebx
+  802cf4:	68 00 80 80 00       	push   $0x808000
+  802cf9:	ff 75 0c             	push   0xc(%ebp)
+  802cfc:	e8 3c de ff ff       	call   800b3d <memmove>
+  802d01:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d04:	89 d8                	mov    %ebx,%eax
+  802d06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d09:	5b                   	pop    %ebx
+  802d0a:	5e                   	pop    %esi
+  802d0b:	5d                   	pop    %ebp
+  802d0c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d0d:	68 48 4a 80 00       	push   $0x804a48
+  802d12:	68 5d 4a 80 00       	push   $0x804a5d
+  802d17:	68 b2 00 00 00       	push   $0xb2
+  802d1c:	68 72 4a 80 00       	push   $0x804a72
+  802d21:	e8 95 d4 ff ff       	call   8001bb <_panic>
+
+00802d26 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d26:	55                   	push   %ebp
+  802d27:	89 e5                	mov    %esp,%ebp
+  802d29:	53                   	push   %ebx
+  802d2a:	83 ec 04             	sub    $0x4,%esp
+  802d2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d33:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802d38:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d3e:	7f 2e                	jg     802d6e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d40:	83 ec 04             	sub    $0x4,%esp
+  802d43:	53                   	push   %ebx
+  802d44:	ff 75 0c             	push   0xc(%ebp)
+  802d47:	68 0c 80 80 00       	push   $0x80800c
+  802d4c:	e8 ec dd ff ff       	call   800b3d <memmove>
+	nsipcbuf.send.req_size = size;
+  802d51:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802d57:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d5a:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802d5f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d64:	e8 a0 fc ff ff       	call   802a09 <nsipc>
+}
+  802d69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d6c:	c9                   	leave
+  802d6d:	c3                   	ret
+	assert(size < 1600);
+  802d6e:	68 7e 4a 80 00       	push   $0x804a7e
+  802d73:	68 5d 4a 80 00       	push   $0x804a5d
+  802d78:	68 bd 00 00 00       	push   $0xbd
+  802d7d:	68 72 4a 80 00       	push   $0x804a72
+  802d82:	e8 34 d4 ff ff       	call   8001bb <_panic>
+
+00802d87 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	57                   	push   %edi
+  802d8b:	56                   	push   %esi
+  802d8c:	53                   	push   %ebx
+  802d8d:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802d90:	e8 c0 fc ff ff       	call   802a55 <nsbulk_map>
+  802d95:	85 c0                	test   %eax,%eax
+  802d97:	78 55                	js     802dee <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802d99:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802da0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802da7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802dae:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802db1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802db4:	0f 8d 24 02 00 00    	jge    802fde <nsipc_sendmsg+0x257>
+  802dba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dbd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dc0:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802dc3:	89 d8                	mov    %ebx,%eax
+  802dc5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802dca:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802dcc:	83 ec 0c             	sub    $0xc,%esp
+  802dcf:	68 e0 66 80 00       	push   $0x8066e0
+  802dd4:	e8 5a 0f 00 00       	call   803d33 <pgbatch_init>
+  802dd9:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802ddc:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802dde:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802de1:	e9 82 00 00 00       	jmp    802e68 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802de6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802de9:	85 db                	test   %ebx,%ebx
+  802deb:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802dee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df1:	5b                   	pop    %ebx
+  802df2:	5e                   	pop    %esi
+  802df3:	5f                   	pop    %edi
+  802df4:	5d                   	pop    %ebp
+  802df5:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802df6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802dfb:	29 c8                	sub    %ecx,%eax
+  802dfd:	39 d0                	cmp    %edx,%eax
+  802dff:	0f 46 d0             	cmovbe %eax,%edx
+  802e02:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802e04:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e0a:	85 ff                	test   %edi,%edi
+  802e0c:	0f 49 c7             	cmovns %edi,%eax
+  802e0f:	c1 f8 0c             	sar    $0xc,%eax
+  802e12:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e17:	e8 87 fc ff ff       	call   802aa3 <nsbulk_own>
+  802e1c:	85 c0                	test   %eax,%eax
+  802e1e:	0f 88 17 01 00 00    	js     802f3b <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802e24:	83 ec 04             	sub    $0x4,%esp
+  802e27:	56                   	push   %esi
+  802e28:	ff 75 e0             	push   -0x20(%ebp)
+  802e2b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802e2e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e33:	50                   	push   %eax
+  802e34:	e8 04 dd ff ff       	call   800b3d <memmove>
+  802e39:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802e3c:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802e3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e42:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802e45:	0f 84 fd 00 00 00    	je     802f48 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802e4b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802e4e:	01 f7                	add    %esi,%edi
+  802e50:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e53:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e56:	0f 8d 01 01 00 00    	jge    802f5d <nsipc_sendmsg+0x1d6>
+  802e5c:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802e62:	0f 8f f0 00 00 00    	jg     802f58 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802e68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e6b:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802e6e:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802e71:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e74:	89 c2                	mov    %eax,%edx
+  802e76:	03 13                	add    (%ebx),%edx
+  802e78:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802e7b:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e7e:	29 c6                	sub    %eax,%esi
+  802e80:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802e85:	29 f9                	sub    %edi,%ecx
+  802e87:	39 ce                	cmp    %ecx,%esi
+  802e89:	89 ca                	mov    %ecx,%edx
+  802e8b:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802e8e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802e91:	89 f9                	mov    %edi,%ecx
+  802e93:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802e99:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e9c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ea1:	09 c8                	or     %ecx,%eax
+  802ea3:	0f 85 4d ff ff ff    	jne    802df6 <nsipc_sendmsg+0x6f>
+  802ea9:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802eaf:	0f 86 41 ff ff ff    	jbe    802df6 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802eb5:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802ebb:	85 ff                	test   %edi,%edi
+  802ebd:	0f 49 c7             	cmovns %edi,%eax
+  802ec0:	c1 f8 0c             	sar    $0xc,%eax
+  802ec3:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802ec5:	89 d1                	mov    %edx,%ecx
+  802ec7:	c1 e9 0c             	shr    $0xc,%ecx
+  802eca:	01 c8                	add    %ecx,%eax
+  802ecc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ecf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802ed2:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802ed4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802ed7:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802edc:	29 c8                	sub    %ecx,%eax
+  802ede:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802ee1:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802ee4:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ee6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802eeb:	89 f9                	mov    %edi,%ecx
+  802eed:	d3 e0                	shl    %cl,%eax
+  802eef:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802ef5:	83 ec 08             	sub    $0x8,%esp
+  802ef8:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802efa:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802efd:	50                   	push   %eax
+  802efe:	6a 00                	push   $0x0
+  802f00:	56                   	push   %esi
+  802f01:	6a 00                	push   $0x0
+  802f03:	68 e0 66 80 00       	push   $0x8066e0
+  802f08:	e8 e4 0e 00 00       	call   803df1 <pgbatch_map>
+  802f0d:	83 c4 20             	add    $0x20,%esp
+  802f10:	85 c0                	test   %eax,%eax
+  802f12:	0f 88 ce fe ff ff    	js     802de6 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f18:	83 c7 01             	add    $0x1,%edi
+  802f1b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f21:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802f24:	39 c7                	cmp    %eax,%edi
+  802f26:	75 be                	jne    802ee6 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802f28:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f2b:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802f2e:	89 d6                	mov    %edx,%esi
+  802f30:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802f36:	e9 01 ff ff ff       	jmp    802e3c <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802f3b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f3e:	85 db                	test   %ebx,%ebx
+  802f40:	0f 45 c3             	cmovne %ebx,%eax
+  802f43:	e9 a6 fe ff ff       	jmp    802dee <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802f48:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802f4c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802f53:	e9 f3 fe ff ff       	jmp    802e4b <nsipc_sendmsg+0xc4>
+  802f58:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802f5b:	eb 03                	jmp    802f60 <nsipc_sendmsg+0x1d9>
+  802f5d:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802f60:	83 ec 0c             	sub    $0xc,%esp
+  802f63:	68 e0 66 80 00       	push   $0x8066e0
+  802f68:	e8 d4 0d 00 00       	call   803d41 <pgbatch_flush>
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	85 c0                	test   %eax,%eax
+  802f72:	78 50                	js     802fc4 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802f74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f77:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802f7c:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802f82:	89 fb                	mov    %edi,%ebx
+  802f84:	29 f3                	sub    %esi,%ebx
+  802f86:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802f8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f8f:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802f94:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802f99:	89 fa                	mov    %edi,%edx
+  802f9b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802fa0:	e8 66 fb ff ff       	call   802b0b <nsipc_bulk>
+  802fa5:	85 c0                	test   %eax,%eax
+  802fa7:	78 28                	js     802fd1 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802fa9:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802fac:	39 c3                	cmp    %eax,%ebx
+  802fae:	75 0c                	jne    802fbc <nsipc_sendmsg+0x235>
+  802fb0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802fb3:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802fb6:	0f 8f f2 fd ff ff    	jg     802dae <nsipc_sendmsg+0x27>
+		sent += r;
+  802fbc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802fbf:	e9 2a fe ff ff       	jmp    802dee <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802fc4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802fc7:	85 db                	test   %ebx,%ebx
+  802fc9:	0f 45 c3             	cmovne %ebx,%eax
+  802fcc:	e9 1d fe ff ff       	jmp    802dee <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802fd1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802fd4:	85 db                	test   %ebx,%ebx
+  802fd6:	0f 45 c3             	cmovne %ebx,%eax
+  802fd9:	e9 10 fe ff ff       	jmp    802dee <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802fde:	83 ec 0c             	sub    $0xc,%esp
+  802fe1:	68 e0 66 80 00       	push   $0x8066e0
+  802fe6:	e8 48 0d 00 00       	call   803d33 <pgbatch_init>
+  802feb:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802fee:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff8:	e9 63 ff ff ff       	jmp    802f60 <nsipc_sendmsg+0x1d9>
+
+00802ffd <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802ffd:	55                   	push   %ebp
+  802ffe:	89 e5                	mov    %esp,%ebp
+  803000:	57                   	push   %edi
+  803001:	56                   	push   %esi
+  803002:	53                   	push   %ebx
+  803003:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  803006:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  80300d:	0f 84 c8 00 00 00    	je     8030db <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803013:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80301a:	0f 84 e4 00 00 00    	je     803104 <nsipc_sendfile+0x107>
+{
+  803020:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  803025:	89 fb                	mov    %edi,%ebx
+  803027:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80302a:	0f 83 f0 00 00 00    	jae    803120 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803030:	89 fa                	mov    %edi,%edx
+  803032:	03 55 10             	add    0x10(%ebp),%edx
+  803035:	89 d0                	mov    %edx,%eax
+  803037:	c1 f8 1f             	sar    $0x1f,%eax
+  80303a:	c1 e8 14             	shr    $0x14,%eax
+  80303d:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803040:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803046:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803048:	6a 10                	push   $0x10
+  80304a:	68 00 20 01 e0       	push   $0xe0012000
+  80304f:	52                   	push   %edx
+  803050:	ff 75 0c             	push   0xc(%ebp)
+  803053:	e8 fe f4 ff ff       	call   802556 <fmap>
+  803058:	83 c4 10             	add    $0x10,%esp
+  80305b:	85 c0                	test   %eax,%eax
+  80305d:	0f 8e b8 00 00 00    	jle    80311b <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  803063:	39 c6                	cmp    %eax,%esi
+  803065:	0f 8d b5 00 00 00    	jge    803120 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80306b:	29 f0                	sub    %esi,%eax
+  80306d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803070:	29 da                	sub    %ebx,%edx
+  803072:	39 d0                	cmp    %edx,%eax
+  803074:	89 d3                	mov    %edx,%ebx
+  803076:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  803079:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307c:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803081:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  803087:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  80308d:	8b 45 18             	mov    0x18(%ebp),%eax
+  803090:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803095:	83 ec 0c             	sub    $0xc,%esp
+  803098:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80309a:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8030a1:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8030a4:	83 c0 01             	add    $0x1,%eax
+  8030a7:	50                   	push   %eax
+  8030a8:	68 00 10 01 e0       	push   $0xe0011000
+  8030ad:	6a 11                	push   $0x11
+  8030af:	ff 35 e4 69 80 00    	push   0x8069e4
+  8030b5:	e8 aa eb ff ff       	call   801c64 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8030ba:	83 c4 1c             	add    $0x1c,%esp
+  8030bd:	6a 00                	push   $0x0
+  8030bf:	6a 00                	push   $0x0
+  8030c1:	6a 00                	push   $0x0
+  8030c3:	e8 d8 e8 ff ff       	call   8019a0 <ipc_recv>
+  8030c8:	83 c4 10             	add    $0x10,%esp
+  8030cb:	85 c0                	test   %eax,%eax
+  8030cd:	78 5b                	js     80312a <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8030cf:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8030d1:	39 c3                	cmp    %eax,%ebx
+  8030d3:	0f 8e 4c ff ff ff    	jle    803025 <nsipc_sendfile+0x28>
+  8030d9:	eb 45                	jmp    803120 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8030db:	83 ec 04             	sub    $0x4,%esp
+  8030de:	6a 07                	push   $0x7
+  8030e0:	68 00 10 01 e0       	push   $0xe0011000
+  8030e5:	6a 00                	push   $0x0
+  8030e7:	e8 d5 dc ff ff       	call   800dc1 <sys_page_alloc>
+  8030ec:	89 c7                	mov    %eax,%edi
+  8030ee:	83 c4 10             	add    $0x10,%esp
+  8030f1:	85 c0                	test   %eax,%eax
+  8030f3:	78 2b                	js     803120 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8030f5:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  8030fc:	00 00 00 
+  8030ff:	e9 0f ff ff ff       	jmp    803013 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803104:	83 ec 0c             	sub    $0xc,%esp
+  803107:	6a 03                	push   $0x3
+  803109:	e8 8b eb ff ff       	call   801c99 <ipc_find_env>
+  80310e:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  803113:	83 c4 10             	add    $0x10,%esp
+  803116:	e9 05 ff ff ff       	jmp    803020 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80311b:	85 ff                	test   %edi,%edi
+  80311d:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803120:	89 f8                	mov    %edi,%eax
+  803122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803125:	5b                   	pop    %ebx
+  803126:	5e                   	pop    %esi
+  803127:	5f                   	pop    %edi
+  803128:	5d                   	pop    %ebp
+  803129:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80312a:	85 ff                	test   %edi,%edi
+  80312c:	0f 44 f8             	cmove  %eax,%edi
+  80312f:	eb ef                	jmp    803120 <nsipc_sendfile+0x123>
+
+00803131 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803131:	55                   	push   %ebp
+  803132:	89 e5                	mov    %esp,%ebp
+  803134:	57                   	push   %edi
+  803135:	56                   	push   %esi
+  803136:	53                   	push   %ebx
+  803137:	83 ec 1c             	sub    $0x1c,%esp
+  80313a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80313d:	e8 13 f9 ff ff       	call   802a55 <nsbulk_map>
+  803142:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803145:	85 c0                	test   %eax,%eax
+  803147:	0f 88 ba 00 00 00    	js     803207 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80314d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803151:	0f 8e bb 00 00 00    	jle    803212 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803157:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80315c:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  803161:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803166:	89 f8                	mov    %edi,%eax
+  803168:	29 f0                	sub    %esi,%eax
+  80316a:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80316e:	39 c8                	cmp    %ecx,%eax
+  803170:	0f 47 c1             	cmova  %ecx,%eax
+  803173:	01 f0                	add    %esi,%eax
+  803175:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803177:	83 c2 01             	add    $0x1,%edx
+  80317a:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80317d:	7e 07                	jle    803186 <nsipc_recvmsg+0x55>
+  80317f:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803184:	7e e0                	jle    803166 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803186:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80318c:	c1 fa 0c             	sar    $0xc,%edx
+  80318f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803194:	e8 0a f9 ff ff       	call   802aa3 <nsbulk_own>
+  803199:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80319c:	85 c0                	test   %eax,%eax
+  80319e:	78 67                	js     803207 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8031a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a3:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8031a8:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8031ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031b1:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8031b6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031bb:	89 f2                	mov    %esi,%edx
+  8031bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8031c2:	e8 44 f9 ff ff       	call   802b0b <nsipc_bulk>
+  8031c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031ca:	85 c0                	test   %eax,%eax
+  8031cc:	78 39                	js     803207 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8031ce:	39 f0                	cmp    %esi,%eax
+  8031d0:	7f 4a                	jg     80321c <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8031d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d7:	85 c0                	test   %eax,%eax
+  8031d9:	7e 2c                	jle    803207 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8031db:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8031de:	29 fe                	sub    %edi,%esi
+  8031e0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8031e3:	39 c6                	cmp    %eax,%esi
+  8031e5:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8031e8:	83 ec 04             	sub    $0x4,%esp
+  8031eb:	56                   	push   %esi
+  8031ec:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8031f2:	50                   	push   %eax
+  8031f3:	ff 33                	push   (%ebx)
+  8031f5:	e8 43 d9 ff ff       	call   800b3d <memmove>
+		n += m;
+  8031fa:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8031fc:	83 c3 08             	add    $0x8,%ebx
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803205:	7f d4                	jg     8031db <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803207:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80320a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80320d:	5b                   	pop    %ebx
+  80320e:	5e                   	pop    %esi
+  80320f:	5f                   	pop    %edi
+  803210:	5d                   	pop    %ebp
+  803211:	c3                   	ret
+	int r, i, n, len = 0;
+  803212:	be 00 00 00 00       	mov    $0x0,%esi
+  803217:	e9 6a ff ff ff       	jmp    803186 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80321c:	68 54 4a 80 00       	push   $0x804a54
+  803221:	68 5d 4a 80 00       	push   $0x804a5d
+  803226:	68 3b 01 00 00       	push   $0x13b
+  80322b:	68 72 4a 80 00       	push   $0x804a72
+  803230:	e8 86 cf ff ff       	call   8001bb <_panic>
+
+00803235 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	57                   	push   %edi
+  803239:	56                   	push   %esi
+  80323a:	53                   	push   %ebx
+  80323b:	83 ec 0c             	sub    $0xc,%esp
+  80323e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803241:	8b 75 10             	mov    0x10(%ebp),%esi
+  803244:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803247:	8b 45 08             	mov    0x8(%ebp),%eax
+  80324a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80324f:	8b 07                	mov    (%edi),%eax
+  803251:	a3 04 80 80 00       	mov    %eax,0x808004
+  803256:	8b 47 04             	mov    0x4(%edi),%eax
+  803259:	a3 08 80 80 00       	mov    %eax,0x808008
+  80325e:	8b 47 08             	mov    0x8(%edi),%eax
+  803261:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  803266:	8b 47 0c             	mov    0xc(%edi),%eax
+  803269:	a3 10 80 80 00       	mov    %eax,0x808010
+  80326e:	8b 47 10             	mov    0x10(%edi),%eax
+  803271:	a3 14 80 80 00       	mov    %eax,0x808014
+  803276:	8b 47 14             	mov    0x14(%edi),%eax
+  803279:	a3 18 80 80 00       	mov    %eax,0x808018
+  80327e:	8b 47 18             	mov    0x18(%edi),%eax
+  803281:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803286:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803289:	a3 20 80 80 00       	mov    %eax,0x808020
+  80328e:	8b 47 20             	mov    0x20(%edi),%eax
+  803291:	a3 24 80 80 00       	mov    %eax,0x808024
+  803296:	8b 47 24             	mov    0x24(%edi),%eax
+  803299:	a3 28 80 80 00       	mov    %eax,0x808028
+  80329e:	8b 47 28             	mov    0x28(%edi),%eax
+  8032a1:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8032a6:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8032a9:	a3 30 80 80 00       	mov    %eax,0x808030
+  8032ae:	8b 47 30             	mov    0x30(%edi),%eax
+  8032b1:	a3 34 80 80 00       	mov    %eax,0x808034
+  8032b6:	8b 47 34             	mov    0x34(%edi),%eax
+  8032b9:	a3 38 80 80 00       	mov    %eax,0x808038
+  8032be:	8b 47 38             	mov    0x38(%edi),%eax
+  8032c1:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8032c6:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8032c9:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8032ce:	8b 06                	mov    (%esi),%eax
+  8032d0:	a3 44 80 80 00       	mov    %eax,0x808044
+  8032d5:	8b 46 04             	mov    0x4(%esi),%eax
+  8032d8:	a3 48 80 80 00       	mov    %eax,0x808048
+  8032dd:	8b 46 08             	mov    0x8(%esi),%eax
+  8032e0:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8032e5:	8b 46 0c             	mov    0xc(%esi),%eax
+  8032e8:	a3 50 80 80 00       	mov    %eax,0x808050
+  8032ed:	8b 46 10             	mov    0x10(%esi),%eax
+  8032f0:	a3 54 80 80 00       	mov    %eax,0x808054
+  8032f5:	8b 46 14             	mov    0x14(%esi),%eax
+  8032f8:	a3 58 80 80 00       	mov    %eax,0x808058
+  8032fd:	8b 46 18             	mov    0x18(%esi),%eax
+  803300:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803305:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803308:	a3 60 80 80 00       	mov    %eax,0x808060
+  80330d:	8b 46 20             	mov    0x20(%esi),%eax
+  803310:	a3 64 80 80 00       	mov    %eax,0x808064
+  803315:	8b 46 24             	mov    0x24(%esi),%eax
+  803318:	a3 68 80 80 00       	mov    %eax,0x808068
+  80331d:	8b 46 28             	mov    0x28(%esi),%eax
+  803320:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  803325:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803328:	a3 70 80 80 00       	mov    %eax,0x808070
+  80332d:	8b 46 30             	mov    0x30(%esi),%eax
+  803330:	a3 74 80 80 00       	mov    %eax,0x808074
+  803335:	8b 46 34             	mov    0x34(%esi),%eax
+  803338:	a3 78 80 80 00       	mov    %eax,0x808078
+  80333d:	8b 46 38             	mov    0x38(%esi),%eax
+  803340:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  803345:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803348:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80334d:	8b 03                	mov    (%ebx),%eax
+  80334f:	a3 84 80 80 00       	mov    %eax,0x808084
+  803354:	8b 43 04             	mov    0x4(%ebx),%eax
+  803357:	a3 88 80 80 00       	mov    %eax,0x808088
+  80335c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80335f:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  803364:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803367:	a3 90 80 80 00       	mov    %eax,0x808090
+  80336c:	8b 43 10             	mov    0x10(%ebx),%eax
+  80336f:	a3 94 80 80 00       	mov    %eax,0x808094
+  803374:	8b 43 14             	mov    0x14(%ebx),%eax
+  803377:	a3 98 80 80 00       	mov    %eax,0x808098
+  80337c:	8b 43 18             	mov    0x18(%ebx),%eax
+  80337f:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803384:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803387:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  80338c:	8b 43 20             	mov    0x20(%ebx),%eax
+  80338f:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803394:	8b 43 24             	mov    0x24(%ebx),%eax
+  803397:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80339c:	8b 43 28             	mov    0x28(%ebx),%eax
+  80339f:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8033a4:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8033a7:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8033ac:	8b 43 30             	mov    0x30(%ebx),%eax
+  8033af:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8033b4:	8b 43 34             	mov    0x34(%ebx),%eax
+  8033b7:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8033bc:	8b 43 38             	mov    0x38(%ebx),%eax
+  8033bf:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8033c4:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8033c7:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8033cc:	8b 45 18             	mov    0x18(%ebp),%eax
+  8033cf:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8033d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8033d9:	e8 2b f6 ff ff       	call   802a09 <nsipc>
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	0f 88 ad 01 00 00    	js     803593 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8033e6:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8033ec:	89 17                	mov    %edx,(%edi)
+  8033ee:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8033f4:	89 57 04             	mov    %edx,0x4(%edi)
+  8033f7:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8033fd:	89 57 08             	mov    %edx,0x8(%edi)
+  803400:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803406:	89 57 0c             	mov    %edx,0xc(%edi)
+  803409:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80340f:	89 57 10             	mov    %edx,0x10(%edi)
+  803412:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803418:	89 57 14             	mov    %edx,0x14(%edi)
+  80341b:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803421:	89 57 18             	mov    %edx,0x18(%edi)
+  803424:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80342a:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80342d:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  803433:	89 57 20             	mov    %edx,0x20(%edi)
+  803436:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  80343c:	89 57 24             	mov    %edx,0x24(%edi)
+  80343f:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803445:	89 57 28             	mov    %edx,0x28(%edi)
+  803448:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80344e:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803451:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  803457:	89 57 30             	mov    %edx,0x30(%edi)
+  80345a:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  803460:	89 57 34             	mov    %edx,0x34(%edi)
+  803463:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  803469:	89 57 38             	mov    %edx,0x38(%edi)
+  80346c:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  803472:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803475:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  80347b:	89 16                	mov    %edx,(%esi)
+  80347d:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803483:	89 56 04             	mov    %edx,0x4(%esi)
+  803486:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  80348c:	89 56 08             	mov    %edx,0x8(%esi)
+  80348f:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803495:	89 56 0c             	mov    %edx,0xc(%esi)
+  803498:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80349e:	89 56 10             	mov    %edx,0x10(%esi)
+  8034a1:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8034a7:	89 56 14             	mov    %edx,0x14(%esi)
+  8034aa:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8034b0:	89 56 18             	mov    %edx,0x18(%esi)
+  8034b3:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8034b9:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8034bc:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8034c2:	89 56 20             	mov    %edx,0x20(%esi)
+  8034c5:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8034cb:	89 56 24             	mov    %edx,0x24(%esi)
+  8034ce:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8034d4:	89 56 28             	mov    %edx,0x28(%esi)
+  8034d7:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  8034dd:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8034e0:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8034e6:	89 56 30             	mov    %edx,0x30(%esi)
+  8034e9:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8034ef:	89 56 34             	mov    %edx,0x34(%esi)
+  8034f2:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8034f8:	89 56 38             	mov    %edx,0x38(%esi)
+  8034fb:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803501:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803504:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80350a:	89 13                	mov    %edx,(%ebx)
+  80350c:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803512:	89 53 04             	mov    %edx,0x4(%ebx)
+  803515:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80351b:	89 53 08             	mov    %edx,0x8(%ebx)
+  80351e:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803524:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803527:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  80352d:	89 53 10             	mov    %edx,0x10(%ebx)
+  803530:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803536:	89 53 14             	mov    %edx,0x14(%ebx)
+  803539:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  80353f:	89 53 18             	mov    %edx,0x18(%ebx)
+  803542:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  803548:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80354b:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  803551:	89 53 20             	mov    %edx,0x20(%ebx)
+  803554:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  80355a:	89 53 24             	mov    %edx,0x24(%ebx)
+  80355d:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  803563:	89 53 28             	mov    %edx,0x28(%ebx)
+  803566:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  80356c:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  80356f:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803575:	89 53 30             	mov    %edx,0x30(%ebx)
+  803578:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  80357e:	89 53 34             	mov    %edx,0x34(%ebx)
+  803581:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803587:	89 53 38             	mov    %edx,0x38(%ebx)
+  80358a:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803590:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803593:	83 c4 0c             	add    $0xc,%esp
+  803596:	5b                   	pop    %ebx
+  803597:	5e                   	pop    %esi
+  803598:	5f                   	pop    %edi
+  803599:	5d                   	pop    %ebp
+  80359a:	c3                   	ret
+
+0080359b <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80359b:	55                   	push   %ebp
+  80359c:	89 e5                	mov    %esp,%ebp
+  80359e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8035a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035a4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  8035a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035ac:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  8035b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035b4:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  8035b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8035be:	e8 46 f4 ff ff       	call   802a09 <nsipc>
+}
+  8035c3:	c9                   	leave
+  8035c4:	c3                   	ret
+
+008035c5 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8035c5:	55                   	push   %ebp
+  8035c6:	89 e5                	mov    %esp,%ebp
+  8035c8:	56                   	push   %esi
+  8035c9:	53                   	push   %ebx
+  8035ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  8035cd:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8035d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035d6:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  8035db:	b8 10 00 00 00       	mov    $0x10,%eax
+  8035e0:	e8 24 f4 ff ff       	call   802a09 <nsipc>
+  8035e5:	89 c3                	mov    %eax,%ebx
+  8035e7:	85 c0                	test   %eax,%eax
+  8035e9:	7e 1f                	jle    80360a <nsipc_evwait+0x45>
+		assert(r <= max);
+  8035eb:	39 c6                	cmp    %eax,%esi
+  8035ed:	7c 24                	jl     803613 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8035ef:	83 ec 04             	sub    $0x4,%esp
+  8035f2:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8035f9:	50                   	push   %eax
+  8035fa:	68 00 80 80 00       	push   $0x808000
+  8035ff:	ff 75 08             	push   0x8(%ebp)
+  803602:	e8 36 d5 ff ff       	call   800b3d <memmove>
+  803607:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80360a:	89 d8                	mov    %ebx,%eax
+  80360c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80360f:	5b                   	pop    %ebx
+  803610:	5e                   	pop    %esi
+  803611:	5d                   	pop    %ebp
+  803612:	c3                   	ret
+		assert(r <= max);
+  803613:	68 8a 4a 80 00       	push   $0x804a8a
+  803618:	68 5d 4a 80 00       	push   $0x804a5d
+  80361d:	68 6a 01 00 00       	push   $0x16a
+  803622:	68 72 4a 80 00       	push   $0x804a72
+  803627:	e8 8f cb ff ff       	call   8001bb <_panic>
+
+0080362c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80362c:	55                   	push   %ebp
+  80362d:	89 e5                	mov    %esp,%ebp
+  80362f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803632:	8b 45 08             	mov    0x8(%ebp),%eax
+  803635:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80363a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80363d:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803642:	8b 45 10             	mov    0x10(%ebp),%eax
+  803645:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80364a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80364f:	e8 b5 f3 ff ff       	call   802a09 <nsipc>
+}
+  803654:	c9                   	leave
+  803655:	c3                   	ret
+
+00803656 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803656:	55                   	push   %ebp
+  803657:	89 e5                	mov    %esp,%ebp
+  803659:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  80365c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80365f:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803664:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803669:	e8 9b f3 ff ff       	call   802a09 <nsipc>
+}
+  80366e:	c9                   	leave
+  80366f:	c3                   	ret
+
+00803670 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803670:	55                   	push   %ebp
+  803671:	89 e5                	mov    %esp,%ebp
+  803673:	53                   	push   %ebx
+  803674:	83 ec 04             	sub    $0x4,%esp
+  803677:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  80367a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80367f:	e8 85 f3 ff ff       	call   802a09 <nsipc>
+  803684:	85 c0                	test   %eax,%eax
+  803686:	78 50                	js     8036d8 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803688:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  80368e:	89 13                	mov    %edx,(%ebx)
+  803690:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803696:	89 53 04             	mov    %edx,0x4(%ebx)
+  803699:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80369f:	89 53 08             	mov    %edx,0x8(%ebx)
+  8036a2:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8036a8:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8036ab:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8036b1:	89 53 10             	mov    %edx,0x10(%ebx)
+  8036b4:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8036ba:	89 53 14             	mov    %edx,0x14(%ebx)
+  8036bd:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8036c3:	89 53 18             	mov    %edx,0x18(%ebx)
+  8036c6:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8036cc:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8036cf:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8036d5:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8036d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036db:	c9                   	leave
+  8036dc:	c3                   	ret
+
+008036dd <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8036dd:	55                   	push   %ebp
+  8036de:	89 e5                	mov    %esp,%ebp
+  8036e0:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8036e3:	6a 03                	push   $0x3
+  8036e5:	e8 af e5 ff ff       	call   801c99 <ipc_find_env>
+  8036ea:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  8036ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036f2:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8036f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8036fc:	e8 08 f3 ff ff       	call   802a09 <nsipc>
+  803701:	83 c4 10             	add    $0x10,%esp
+  803704:	85 c0                	test   %eax,%eax
+  803706:	78 0a                	js     803712 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803708:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  80370d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803712:	c9                   	leave
+  803713:	c3                   	ret
+
+00803714 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803714:	55                   	push   %ebp
+  803715:	89 e5                	mov    %esp,%ebp
+  803717:	57                   	push   %edi
+  803718:	56                   	push   %esi
+  803719:	53                   	push   %ebx
+  80371a:	83 ec 1c             	sub    $0x1c,%esp
+  80371d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803720:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803723:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803728:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80372d:	89 e0                	mov    %esp,%eax
+  80372f:	89 f2                	mov    %esi,%edx
+  803731:	29 c2                	sub    %eax,%edx
+  803733:	89 d0                	mov    %edx,%eax
+  803735:	c1 e8 0f             	shr    $0xf,%eax
+  803738:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80373e:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803741:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803748:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  80374b:	83 ec 0c             	sub    $0xc,%esp
+  80374e:	ff 75 e0             	push   -0x20(%ebp)
+  803751:	e8 41 0b 00 00       	call   804297 <pageref>
+  803756:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803759:	83 c4 04             	add    $0x4,%esp
+  80375c:	ff 75 dc             	push   -0x24(%ebp)
+  80375f:	e8 33 0b 00 00       	call   804297 <pageref>
+  803764:	89 e2                	mov    %esp,%edx
+  803766:	89 f1                	mov    %esi,%ecx
+  803768:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  80376a:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80376d:	89 ca                	mov    %ecx,%edx
+  80376f:	c1 ea 0f             	shr    $0xf,%edx
+  803772:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803778:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  80377b:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  803782:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803785:	39 d7                	cmp    %edx,%edi
+  803787:	74 40                	je     8037c9 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803789:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80378c:	75 9f                	jne    80372d <_pipeisclosed+0x19>
+  80378e:	89 e2                	mov    %esp,%edx
+  803790:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803795:	29 d0                	sub    %edx,%eax
+  803797:	89 c2                	mov    %eax,%edx
+  803799:	c1 ea 0f             	shr    $0xf,%edx
+  80379c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a6:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8037a9:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8037b0:	8b 40 58             	mov    0x58(%eax),%eax
+  8037b3:	6a 01                	push   $0x1
+  8037b5:	50                   	push   %eax
+  8037b6:	57                   	push   %edi
+  8037b7:	68 93 4a 80 00       	push   $0x804a93
+  8037bc:	e8 d5 ca ff ff       	call   800296 <cprintf>
+  8037c1:	83 c4 10             	add    $0x10,%esp
+  8037c4:	e9 5f ff ff ff       	jmp    803728 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8037c9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8037cc:	0f 94 c0             	sete   %al
+  8037cf:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8037d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037d5:	5b                   	pop    %ebx
+  8037d6:	5e                   	pop    %esi
+  8037d7:	5f                   	pop    %edi
+  8037d8:	5d                   	pop    %ebp
+  8037d9:	c3                   	ret
+
+008037da <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8037da:	55                   	push   %ebp
+  8037db:	89 e5                	mov    %esp,%ebp
+  8037dd:	53                   	push   %ebx
+  8037de:	83 ec 0c             	sub    $0xc,%esp
+  8037e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8037e4:	53                   	push   %ebx
+  8037e5:	6a 00                	push   $0x0
+  8037e7:	e8 5a d6 ff ff       	call   800e46 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8037ec:	89 1c 24             	mov    %ebx,(%esp)
+  8037ef:	e8 f4 e4 ff ff       	call   801ce8 <fd2data>
+  8037f4:	83 c4 08             	add    $0x8,%esp
+  8037f7:	50                   	push   %eax
+  8037f8:	6a 00                	push   $0x0
+  8037fa:	e8 47 d6 ff ff       	call   800e46 <sys_page_unmap>
+}
+  8037ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803802:	c9                   	leave
+  803803:	c3                   	ret
+
+00803804 <devpipe_read>:
+{
+  803804:	55                   	push   %ebp
+  803805:	89 e5                	mov    %esp,%ebp
+  803807:	57                   	push   %edi
+  803808:	56                   	push   %esi
+  803809:	53                   	push   %ebx
+  80380a:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80380d:	ff 75 08             	push   0x8(%ebp)
+  803810:	e8 d3 e4 ff ff       	call   801ce8 <fd2data>
+  803815:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803817:	8b 70 04             	mov    0x4(%eax),%esi
+  80381a:	8b 00                	mov    (%eax),%eax
+  80381c:	83 c4 10             	add    $0x10,%esp
+  80381f:	39 f0                	cmp    %esi,%eax
+  803821:	75 36                	jne    803859 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803823:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803826:	89 da                	mov    %ebx,%edx
+  803828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80382b:	e8 e4 fe ff ff       	call   803714 <_pipeisclosed>
+  803830:	85 c0                	test   %eax,%eax
+  803832:	0f 85 d4 00 00 00    	jne    80390c <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803838:	b8 01 00 00 00       	mov    $0x1,%eax
+  80383d:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803841:	83 ec 04             	sub    $0x4,%esp
+  803844:	6a ff                	push   $0xffffffff
+  803846:	56                   	push   %esi
+  803847:	57                   	push   %edi
+  803848:	e8 72 d9 ff ff       	call   8011bf <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80384d:	8b 73 04             	mov    0x4(%ebx),%esi
+  803850:	8b 03                	mov    (%ebx),%eax
+  803852:	83 c4 10             	add    $0x10,%esp
+  803855:	39 c6                	cmp    %eax,%esi
+  803857:	74 cd                	je     803826 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803859:	8b 73 04             	mov    0x4(%ebx),%esi
+  80385c:	8b 03                	mov    (%ebx),%eax
+  80385e:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803864:	29 c6                	sub    %eax,%esi
+  803866:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80386b:	f7 e6                	mul    %esi
+  80386d:	c1 ea 0c             	shr    $0xc,%edx
+  803870:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803876:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803878:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80387b:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80387f:	8b 0b                	mov    (%ebx),%ecx
+  803881:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803886:	f7 e1                	mul    %ecx
+  803888:	c1 ea 0b             	shr    $0xb,%edx
+  80388b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803891:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803893:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803898:	29 cf                	sub    %ecx,%edi
+  80389a:	39 f7                	cmp    %esi,%edi
+  80389c:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80389f:	83 ec 04             	sub    $0x4,%esp
+  8038a2:	57                   	push   %edi
+  8038a3:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8038a7:	50                   	push   %eax
+  8038a8:	ff 75 0c             	push   0xc(%ebp)
+  8038ab:	e8 8d d2 ff ff       	call   800b3d <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8038b0:	83 c4 0c             	add    $0xc,%esp
+  8038b3:	89 f0                	mov    %esi,%eax
+  8038b5:	29 f8                	sub    %edi,%eax
+  8038b7:	50                   	push   %eax
+  8038b8:	8d 43 10             	lea    0x10(%ebx),%eax
+  8038bb:	50                   	push   %eax
+  8038bc:	89 f8                	mov    %edi,%eax
+  8038be:	03 45 0c             	add    0xc(%ebp),%eax
+  8038c1:	50                   	push   %eax
+  8038c2:	e8 76 d2 ff ff       	call   800b3d <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8038c7:	8b 0b                	mov    (%ebx),%ecx
+  8038c9:	01 f1                	add    %esi,%ecx
+  8038cb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038d0:	f7 e1                	mul    %ecx
+  8038d2:	c1 ea 0c             	shr    $0xc,%edx
+  8038d5:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8038db:	29 c1                	sub    %eax,%ecx
+  8038dd:	89 0b                	mov    %ecx,(%ebx)
+  8038df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e4:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8038e8:	83 c4 10             	add    $0x10,%esp
+  8038eb:	85 c0                	test   %eax,%eax
+  8038ed:	75 0a                	jne    8038f9 <devpipe_read+0xf5>
+	return n;
+  8038ef:	89 f0                	mov    %esi,%eax
+}
+  8038f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038f4:	5b                   	pop    %ebx
+  8038f5:	5e                   	pop    %esi
+  8038f6:	5f                   	pop    %edi
+  8038f7:	5d                   	pop    %ebp
+  8038f8:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8038f9:	83 ec 08             	sub    $0x8,%esp
+  8038fc:	68 00 04 00 00       	push   $0x400
+  803901:	53                   	push   %ebx
+  803902:	e8 da d8 ff ff       	call   8011e1 <sys_futex_wake>
+  803907:	83 c4 10             	add    $0x10,%esp
+  80390a:	eb e3                	jmp    8038ef <devpipe_read+0xeb>
+			return 0;
+  80390c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803911:	eb de                	jmp    8038f1 <devpipe_read+0xed>
+
+00803913 <devpipe_write>:
+{
+  803913:	55                   	push   %ebp
+  803914:	89 e5                	mov    %esp,%ebp
+  803916:	57                   	push   %edi
+  803917:	56                   	push   %esi
+  803918:	53                   	push   %ebx
+  803919:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80391c:	ff 75 08             	push   0x8(%ebp)
+  80391f:	e8 c4 e3 ff ff       	call   801ce8 <fd2data>
+  803924:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803926:	83 c4 10             	add    $0x10,%esp
+  803929:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803930:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803935:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803939:	0f 84 43 01 00 00    	je     803a82 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80393f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803942:	8b 06                	mov    (%esi),%eax
+  803944:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80394a:	29 c1                	sub    %eax,%ecx
+  80394c:	89 c8                	mov    %ecx,%eax
+  80394e:	f7 e7                	mul    %edi
+  803950:	c1 ea 0c             	shr    $0xc,%edx
+  803953:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803959:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80395b:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803961:	75 52                	jne    8039b5 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803963:	89 f2                	mov    %esi,%edx
+  803965:	8b 45 08             	mov    0x8(%ebp),%eax
+  803968:	e8 a7 fd ff ff       	call   803714 <_pipeisclosed>
+  80396d:	85 c0                	test   %eax,%eax
+  80396f:	0f 85 28 01 00 00    	jne    803a9d <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803975:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803977:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80397a:	8b 06                	mov    (%esi),%eax
+  80397c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803982:	29 c1                	sub    %eax,%ecx
+  803984:	89 c8                	mov    %ecx,%eax
+  803986:	f7 e7                	mul    %edi
+  803988:	c1 ea 0c             	shr    $0xc,%edx
+  80398b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803991:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803993:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803999:	75 a4                	jne    80393f <devpipe_write+0x2c>
+  80399b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039a0:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8039a4:	83 ec 04             	sub    $0x4,%esp
+  8039a7:	6a ff                	push   $0xffffffff
+  8039a9:	53                   	push   %ebx
+  8039aa:	56                   	push   %esi
+  8039ab:	e8 0f d8 ff ff       	call   8011bf <sys_futex_wait>
+}
+  8039b0:	83 c4 10             	add    $0x10,%esp
+  8039b3:	eb 8a                	jmp    80393f <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039b5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039b8:	8b 06                	mov    (%esi),%eax
+  8039ba:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039c0:	29 c1                	sub    %eax,%ecx
+  8039c2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039c7:	f7 e1                	mul    %ecx
+  8039c9:	c1 ea 0c             	shr    $0xc,%edx
+  8039cc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039d2:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8039d4:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8039d9:	89 d8                	mov    %ebx,%eax
+  8039db:	29 c8                	sub    %ecx,%eax
+  8039dd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8039e0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8039e3:	29 ca                	sub    %ecx,%edx
+  8039e5:	39 d0                	cmp    %edx,%eax
+  8039e7:	0f 46 d0             	cmovbe %eax,%edx
+  8039ea:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8039ed:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039f0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039f5:	f7 e1                	mul    %ecx
+  8039f7:	c1 ea 0b             	shr    $0xb,%edx
+  8039fa:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803a00:	89 ca                	mov    %ecx,%edx
+  803a02:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803a04:	29 d3                	sub    %edx,%ebx
+  803a06:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a09:	39 c3                	cmp    %eax,%ebx
+  803a0b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803a0e:	83 ec 04             	sub    $0x4,%esp
+  803a11:	53                   	push   %ebx
+  803a12:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a15:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803a18:	51                   	push   %ecx
+  803a19:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803a1d:	50                   	push   %eax
+  803a1e:	e8 1a d1 ff ff       	call   800b3d <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803a23:	83 c4 0c             	add    $0xc,%esp
+  803a26:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a29:	29 d8                	sub    %ebx,%eax
+  803a2b:	50                   	push   %eax
+  803a2c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a2f:	01 cb                	add    %ecx,%ebx
+  803a31:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803a34:	53                   	push   %ebx
+  803a35:	8d 46 10             	lea    0x10(%esi),%eax
+  803a38:	50                   	push   %eax
+  803a39:	e8 ff d0 ff ff       	call   800b3d <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803a3e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a41:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a44:	01 c1                	add    %eax,%ecx
+  803a46:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a4b:	f7 e1                	mul    %ecx
+  803a4d:	c1 ea 0c             	shr    $0xc,%edx
+  803a50:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803a56:	89 ca                	mov    %ecx,%edx
+  803a58:	29 c2                	sub    %eax,%edx
+  803a5a:	89 56 04             	mov    %edx,0x4(%esi)
+  803a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a62:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803a66:	83 c4 10             	add    $0x10,%esp
+  803a69:	85 c0                	test   %eax,%eax
+  803a6b:	75 1a                	jne    803a87 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803a6d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803a70:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803a73:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a76:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803a79:	0f 82 c0 fe ff ff    	jb     80393f <devpipe_write+0x2c>
+  803a7f:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803a82:	8b 45 10             	mov    0x10(%ebp),%eax
+  803a85:	eb 1b                	jmp    803aa2 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803a87:	83 ec 08             	sub    $0x8,%esp
+  803a8a:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803a8f:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803a92:	50                   	push   %eax
+  803a93:	e8 49 d7 ff ff       	call   8011e1 <sys_futex_wake>
+  803a98:	83 c4 10             	add    $0x10,%esp
+  803a9b:	eb d0                	jmp    803a6d <devpipe_write+0x15a>
+				return 0;
+  803a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803aa5:	5b                   	pop    %ebx
+  803aa6:	5e                   	pop    %esi
+  803aa7:	5f                   	pop    %edi
+  803aa8:	5d                   	pop    %ebp
+  803aa9:	c3                   	ret
+
+00803aaa <devpipe_stat>:
+{
+  803aaa:	55                   	push   %ebp
+  803aab:	89 e5                	mov    %esp,%ebp
+  803aad:	56                   	push   %esi
+  803aae:	53                   	push   %ebx
+  803aaf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803ab2:	83 ec 0c             	sub    $0xc,%esp
+  803ab5:	ff 75 08             	push   0x8(%ebp)
+  803ab8:	e8 2b e2 ff ff       	call   801ce8 <fd2data>
+  803abd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803abf:	83 c4 08             	add    $0x8,%esp
+  803ac2:	68 a6 4a 80 00       	push   $0x804aa6
+  803ac7:	53                   	push   %ebx
+  803ac8:	e8 c0 ce ff ff       	call   80098d <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803acd:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803ad0:	8b 06                	mov    (%esi),%eax
+  803ad2:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803ad8:	29 c1                	sub    %eax,%ecx
+  803ada:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803adf:	89 c8                	mov    %ecx,%eax
+  803ae1:	f7 e2                	mul    %edx
+  803ae3:	c1 ea 0c             	shr    $0xc,%edx
+  803ae6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803aec:	29 d1                	sub    %edx,%ecx
+  803aee:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803af4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803afb:	00 00 00 
+	stat->st_dev = &devpipe;
+  803afe:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803b05:	50 80 00 
+}
+  803b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b10:	5b                   	pop    %ebx
+  803b11:	5e                   	pop    %esi
+  803b12:	5d                   	pop    %ebp
+  803b13:	c3                   	ret
+
+00803b14 <devpipe_poll>:
+{
+  803b14:	55                   	push   %ebp
+  803b15:	89 e5                	mov    %esp,%ebp
+  803b17:	57                   	push   %edi
+  803b18:	56                   	push   %esi
+  803b19:	53                   	push   %ebx
+  803b1a:	83 ec 18             	sub    $0x18,%esp
+  803b1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b20:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b23:	57                   	push   %edi
+  803b24:	e8 bf e1 ff ff       	call   801ce8 <fd2data>
+  803b29:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803b2b:	83 c4 10             	add    $0x10,%esp
+  803b2e:	89 f3                	mov    %esi,%ebx
+  803b30:	83 e3 01             	and    $0x1,%ebx
+  803b33:	75 27                	jne    803b5c <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803b35:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803b3b:	75 48                	jne    803b85 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803b3d:	89 ca                	mov    %ecx,%edx
+  803b3f:	89 f8                	mov    %edi,%eax
+  803b41:	e8 ce fb ff ff       	call   803714 <_pipeisclosed>
+  803b46:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803b48:	89 d8                	mov    %ebx,%eax
+  803b4a:	83 c8 10             	or     $0x10,%eax
+  803b4d:	85 d2                	test   %edx,%edx
+  803b4f:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803b52:	89 d8                	mov    %ebx,%eax
+  803b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b57:	5b                   	pop    %ebx
+  803b58:	5e                   	pop    %esi
+  803b59:	5f                   	pop    %edi
+  803b5a:	5d                   	pop    %ebp
+  803b5b:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b5c:	8b 58 04             	mov    0x4(%eax),%ebx
+  803b5f:	8b 00                	mov    (%eax),%eax
+  803b61:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803b67:	29 c3                	sub    %eax,%ebx
+  803b69:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b6e:	89 d8                	mov    %ebx,%eax
+  803b70:	f7 e2                	mul    %edx
+  803b72:	c1 ea 0c             	shr    $0xc,%edx
+  803b75:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803b7b:	39 d3                	cmp    %edx,%ebx
+  803b7d:	0f 95 c3             	setne  %bl
+  803b80:	0f b6 db             	movzbl %bl,%ebx
+  803b83:	eb b0                	jmp    803b35 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b85:	8b 71 04             	mov    0x4(%ecx),%esi
+  803b88:	8b 01                	mov    (%ecx),%eax
+  803b8a:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803b90:	29 c6                	sub    %eax,%esi
+  803b92:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b97:	89 f0                	mov    %esi,%eax
+  803b99:	f7 e2                	mul    %edx
+  803b9b:	c1 ea 0c             	shr    $0xc,%edx
+  803b9e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803ba4:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803ba6:	89 d8                	mov    %ebx,%eax
+  803ba8:	83 c8 04             	or     $0x4,%eax
+  803bab:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803bb1:	0f 42 d8             	cmovb  %eax,%ebx
+  803bb4:	eb 87                	jmp    803b3d <devpipe_poll+0x29>
+
+00803bb6 <pipe>:
+{
+  803bb6:	55                   	push   %ebp
+  803bb7:	89 e5                	mov    %esp,%ebp
+  803bb9:	56                   	push   %esi
+  803bba:	53                   	push   %ebx
+  803bbb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803bbe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bc1:	50                   	push   %eax
+  803bc2:	e8 38 e1 ff ff       	call   801cff <fd_alloc>
+  803bc7:	89 c3                	mov    %eax,%ebx
+  803bc9:	83 c4 10             	add    $0x10,%esp
+  803bcc:	85 c0                	test   %eax,%eax
+  803bce:	0f 88 23 01 00 00    	js     803cf7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bd4:	83 ec 04             	sub    $0x4,%esp
+  803bd7:	68 07 04 00 00       	push   $0x407
+  803bdc:	ff 75 f4             	push   -0xc(%ebp)
+  803bdf:	6a 00                	push   $0x0
+  803be1:	e8 db d1 ff ff       	call   800dc1 <sys_page_alloc>
+  803be6:	89 c3                	mov    %eax,%ebx
+  803be8:	83 c4 10             	add    $0x10,%esp
+  803beb:	85 c0                	test   %eax,%eax
+  803bed:	0f 88 04 01 00 00    	js     803cf7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803bf3:	83 ec 0c             	sub    $0xc,%esp
+  803bf6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803bf9:	50                   	push   %eax
+  803bfa:	e8 00 e1 ff ff       	call   801cff <fd_alloc>
+  803bff:	89 c3                	mov    %eax,%ebx
+  803c01:	83 c4 10             	add    $0x10,%esp
+  803c04:	85 c0                	test   %eax,%eax
+  803c06:	0f 88 db 00 00 00    	js     803ce7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c0c:	83 ec 04             	sub    $0x4,%esp
+  803c0f:	68 07 04 00 00       	push   $0x407
+  803c14:	ff 75 f0             	push   -0x10(%ebp)
+  803c17:	6a 00                	push   $0x0
+  803c19:	e8 a3 d1 ff ff       	call   800dc1 <sys_page_alloc>
+  803c1e:	89 c3                	mov    %eax,%ebx
+  803c20:	83 c4 10             	add    $0x10,%esp
+  803c23:	85 c0                	test   %eax,%eax
+  803c25:	0f 88 bc 00 00 00    	js     803ce7 <pipe+0x131>
+	va = fd2data(fd0);
+  803c2b:	83 ec 0c             	sub    $0xc,%esp
+  803c2e:	ff 75 f4             	push   -0xc(%ebp)
+  803c31:	e8 b2 e0 ff ff       	call   801ce8 <fd2data>
+  803c36:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c38:	83 c4 0c             	add    $0xc,%esp
+  803c3b:	68 07 04 00 00       	push   $0x407
+  803c40:	50                   	push   %eax
+  803c41:	6a 00                	push   $0x0
+  803c43:	e8 79 d1 ff ff       	call   800dc1 <sys_page_alloc>
+  803c48:	89 c3                	mov    %eax,%ebx
+  803c4a:	83 c4 10             	add    $0x10,%esp
+  803c4d:	85 c0                	test   %eax,%eax
+  803c4f:	0f 88 82 00 00 00    	js     803cd7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c55:	83 ec 0c             	sub    $0xc,%esp
+  803c58:	ff 75 f0             	push   -0x10(%ebp)
+  803c5b:	e8 88 e0 ff ff       	call   801ce8 <fd2data>
+  803c60:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803c67:	50                   	push   %eax
+  803c68:	6a 00                	push   $0x0
+  803c6a:	56                   	push   %esi
+  803c6b:	6a 00                	push   $0x0
+  803c6d:	e8 92 d1 ff ff       	call   800e04 <sys_page_map>
+  803c72:	89 c3                	mov    %eax,%ebx
+  803c74:	83 c4 20             	add    $0x20,%esp
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	78 4e                	js     803cc9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803c7b:	a1 60 50 80 00       	mov    0x805060,%eax
+  803c80:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c83:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803c85:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c88:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803c8f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803c92:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803c94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803c97:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803c9e:	83 ec 0c             	sub    $0xc,%esp
+  803ca1:	ff 75 f4             	push   -0xc(%ebp)
+  803ca4:	e8 2f e0 ff ff       	call   801cd8 <fd2num>
+  803ca9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803cac:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803cae:	83 c4 04             	add    $0x4,%esp
+  803cb1:	ff 75 f0             	push   -0x10(%ebp)
+  803cb4:	e8 1f e0 ff ff       	call   801cd8 <fd2num>
+  803cb9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803cbc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803cbf:	83 c4 10             	add    $0x10,%esp
+  803cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cc7:	eb 2e                	jmp    803cf7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803cc9:	83 ec 08             	sub    $0x8,%esp
+  803ccc:	56                   	push   %esi
+  803ccd:	6a 00                	push   $0x0
+  803ccf:	e8 72 d1 ff ff       	call   800e46 <sys_page_unmap>
+  803cd4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803cd7:	83 ec 08             	sub    $0x8,%esp
+  803cda:	ff 75 f0             	push   -0x10(%ebp)
+  803cdd:	6a 00                	push   $0x0
+  803cdf:	e8 62 d1 ff ff       	call   800e46 <sys_page_unmap>
+  803ce4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803ce7:	83 ec 08             	sub    $0x8,%esp
+  803cea:	ff 75 f4             	push   -0xc(%ebp)
+  803ced:	6a 00                	push   $0x0
+  803cef:	e8 52 d1 ff ff       	call   800e46 <sys_page_unmap>
+  803cf4:	83 c4 10             	add    $0x10,%esp
+}
+  803cf7:	89 d8                	mov    %ebx,%eax
+  803cf9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cfc:	5b                   	pop    %ebx
+  803cfd:	5e                   	pop    %esi
+  803cfe:	5d                   	pop    %ebp
+  803cff:	c3                   	ret
+
+00803d00 <pipeisclosed>:
+{
+  803d00:	55                   	push   %ebp
+  803d01:	89 e5                	mov    %esp,%ebp
+  803d03:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d09:	50                   	push   %eax
+  803d0a:	ff 75 08             	push   0x8(%ebp)
+  803d0d:	e8 3d e0 ff ff       	call   801d4f <fd_lookup>
+  803d12:	83 c4 10             	add    $0x10,%esp
+  803d15:	85 c0                	test   %eax,%eax
+  803d17:	78 18                	js     803d31 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803d19:	83 ec 0c             	sub    $0xc,%esp
+  803d1c:	ff 75 f4             	push   -0xc(%ebp)
+  803d1f:	e8 c4 df ff ff       	call   801ce8 <fd2data>
+  803d24:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803d26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d29:	e8 e6 f9 ff ff       	call   803714 <_pipeisclosed>
+  803d2e:	83 c4 10             	add    $0x10,%esp
+}
+  803d31:	c9                   	leave
+  803d32:	c3                   	ret
+
+00803d33 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803d33:	55                   	push   %ebp
+  803d34:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803d36:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d39:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d3f:	5d                   	pop    %ebp
+  803d40:	c3                   	ret
+
+00803d41 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803d41:	55                   	push   %ebp
+  803d42:	89 e5                	mov    %esp,%ebp
+  803d44:	53                   	push   %ebx
+  803d45:	83 ec 04             	sub    $0x4,%esp
+  803d48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803d4b:	8b 03                	mov    (%ebx),%eax
+  803d4d:	85 c0                	test   %eax,%eax
+  803d4f:	75 05                	jne    803d56 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803d51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d54:	c9                   	leave
+  803d55:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803d56:	83 ec 08             	sub    $0x8,%esp
+  803d59:	50                   	push   %eax
+  803d5a:	8d 43 04             	lea    0x4(%ebx),%eax
+  803d5d:	50                   	push   %eax
+  803d5e:	e8 33 d3 ff ff       	call   801096 <sys_page_batch>
+	pb->pb_n = 0;
+  803d63:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803d69:	83 c4 10             	add    $0x10,%esp
+  803d6c:	eb e3                	jmp    803d51 <pgbatch_flush+0x10>
+
+00803d6e <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803d6e:	55                   	push   %ebp
+  803d6f:	89 e5                	mov    %esp,%ebp
+  803d71:	56                   	push   %esi
+  803d72:	53                   	push   %ebx
+  803d73:	89 c3                	mov    %eax,%ebx
+  803d75:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d77:	83 38 20             	cmpl   $0x20,(%eax)
+  803d7a:	74 2c                	je     803da8 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803d7c:	8b 03                	mov    (%ebx),%eax
+  803d7e:	8d 50 01             	lea    0x1(%eax),%edx
+  803d81:	89 13                	mov    %edx,(%ebx)
+  803d83:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803d86:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803d8a:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803d8c:	83 ec 04             	sub    $0x4,%esp
+  803d8f:	6a 18                	push   $0x18
+  803d91:	6a 00                	push   $0x0
+  803d93:	50                   	push   %eax
+  803d94:	e8 6f cd ff ff       	call   800b08 <memset>
+	return 0;
+  803d99:	83 c4 10             	add    $0x10,%esp
+  803d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803da1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803da4:	5b                   	pop    %ebx
+  803da5:	5e                   	pop    %esi
+  803da6:	5d                   	pop    %ebp
+  803da7:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803da8:	83 ec 0c             	sub    $0xc,%esp
+  803dab:	50                   	push   %eax
+  803dac:	e8 90 ff ff ff       	call   803d41 <pgbatch_flush>
+  803db1:	83 c4 10             	add    $0x10,%esp
+  803db4:	85 c0                	test   %eax,%eax
+  803db6:	79 c4                	jns    803d7c <pgbatch_slot+0xe>
+  803db8:	eb e7                	jmp    803da1 <pgbatch_slot+0x33>
+
+00803dba <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803dba:	55                   	push   %ebp
+  803dbb:	89 e5                	mov    %esp,%ebp
+  803dbd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803dc0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dc6:	e8 a3 ff ff ff       	call   803d6e <pgbatch_slot>
+  803dcb:	85 c0                	test   %eax,%eax
+  803dcd:	78 20                	js     803def <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803dcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dd2:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803dd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ddb:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803dde:	8b 55 10             	mov    0x10(%ebp),%edx
+  803de1:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803de4:	8b 55 14             	mov    0x14(%ebp),%edx
+  803de7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803dea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803def:	c9                   	leave
+  803df0:	c3                   	ret
+
+00803df1 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803df1:	55                   	push   %ebp
+  803df2:	89 e5                	mov    %esp,%ebp
+  803df4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803df7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dfd:	e8 6c ff ff ff       	call   803d6e <pgbatch_slot>
+  803e02:	85 c0                	test   %eax,%eax
+  803e04:	78 2c                	js     803e32 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803e06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e09:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803e0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e12:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803e15:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e18:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e1b:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e1e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803e21:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e24:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e27:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803e2a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e32:	c9                   	leave
+  803e33:	c3                   	ret
+
+00803e34 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803e34:	55                   	push   %ebp
+  803e35:	89 e5                	mov    %esp,%ebp
+  803e37:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e3a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e40:	e8 29 ff ff ff       	call   803d6e <pgbatch_slot>
+  803e45:	85 c0                	test   %eax,%eax
+  803e47:	78 1a                	js     803e63 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e4c:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803e52:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e55:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e58:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e5b:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e63:	c9                   	leave
+  803e64:	c3                   	ret
+
+00803e65 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803e65:	55                   	push   %ebp
+  803e66:	89 e5                	mov    %esp,%ebp
+  803e68:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e6b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e71:	e8 f8 fe ff ff       	call   803d6e <pgbatch_slot>
+  803e76:	85 c0                	test   %eax,%eax
+  803e78:	78 20                	js     803e9a <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803e7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e7d:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803e83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e86:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e89:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e8c:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e8f:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e92:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9a:	c9                   	leave
+  803e9b:	c3                   	ret
+
+00803e9c <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803e9c:	55                   	push   %ebp
+  803e9d:	89 e5                	mov    %esp,%ebp
+  803e9f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ea2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ea8:	e8 c1 fe ff ff       	call   803d6e <pgbatch_slot>
+  803ead:	85 c0                	test   %eax,%eax
+  803eaf:	78 26                	js     803ed7 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803eb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803eb4:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803eba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ebd:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803ec0:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ec3:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803ec6:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ec9:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803ecc:	8b 55 18             	mov    0x18(%ebp),%edx
+  803ecf:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed7:	c9                   	leave
+  803ed8:	c3                   	ret
+
+00803ed9 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803ed9:	55                   	push   %ebp
+  803eda:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803edc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803edf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ee5:	5d                   	pop    %ebp
+  803ee6:	c3                   	ret
+
+00803ee7 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803ee7:	55                   	push   %ebp
+  803ee8:	89 e5                	mov    %esp,%ebp
+  803eea:	56                   	push   %esi
+  803eeb:	53                   	push   %ebx
+  803eec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef4:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ef9:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803efd:	85 c0                	test   %eax,%eax
+  803eff:	74 2f                	je     803f30 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803f01:	83 f8 02             	cmp    $0x2,%eax
+  803f04:	74 0c                	je     803f12 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803f06:	b8 02 00 00 00       	mov    $0x2,%eax
+  803f0b:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803f0e:	85 c0                	test   %eax,%eax
+  803f10:	74 1e                	je     803f30 <mutex_lock+0x49>
+  803f12:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803f17:	83 ec 04             	sub    $0x4,%esp
+  803f1a:	6a ff                	push   $0xffffffff
+  803f1c:	6a 02                	push   $0x2
+  803f1e:	53                   	push   %ebx
+  803f1f:	e8 9b d2 ff ff       	call   8011bf <sys_futex_wait>
+  803f24:	89 f0                	mov    %esi,%eax
+  803f26:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803f29:	83 c4 10             	add    $0x10,%esp
+  803f2c:	85 c0                	test   %eax,%eax
+  803f2e:	75 e7                	jne    803f17 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803f30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f33:	5b                   	pop    %ebx
+  803f34:	5e                   	pop    %esi
+  803f35:	5d                   	pop    %ebp
+  803f36:	c3                   	ret
+
+00803f37 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803f37:	55                   	push   %ebp
+  803f38:	89 e5                	mov    %esp,%ebp
+  803f3a:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f42:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803f47:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803f4b:	85 c0                	test   %eax,%eax
+  803f4d:	0f 94 c0             	sete   %al
+  803f50:	0f b6 c0             	movzbl %al,%eax
+}
+  803f53:	5d                   	pop    %ebp
+  803f54:	c3                   	ret
+
+00803f55 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803f55:	55                   	push   %ebp
+  803f56:	89 e5                	mov    %esp,%ebp
+  803f58:	83 ec 08             	sub    $0x8,%esp
+  803f5b:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f63:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803f66:	83 f8 02             	cmp    $0x2,%eax
+  803f69:	74 02                	je     803f6d <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803f6b:	c9                   	leave
+  803f6c:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803f6d:	83 ec 08             	sub    $0x8,%esp
+  803f70:	6a 01                	push   $0x1
+  803f72:	52                   	push   %edx
+  803f73:	e8 69 d2 ff ff       	call   8011e1 <sys_futex_wake>
+  803f78:	83 c4 10             	add    $0x10,%esp
+}
+  803f7b:	eb ee                	jmp    803f6b <mutex_unlock+0x16>
+
+00803f7d <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803f7d:	55                   	push   %ebp
+  803f7e:	89 e5                	mov    %esp,%ebp
+  803f80:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803f83:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803f89:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803f90:	5d                   	pop    %ebp
+  803f91:	c3                   	ret
+
+00803f92 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803f92:	55                   	push   %ebp
+  803f93:	89 e5                	mov    %esp,%ebp
+  803f95:	57                   	push   %edi
+  803f96:	56                   	push   %esi
+  803f97:	53                   	push   %ebx
+  803f98:	83 ec 18             	sub    $0x18,%esp
+  803f9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f9e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803fa1:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803fa3:	b8 01 00 00 00       	mov    $0x1,%eax
+  803fa8:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803fad:	57                   	push   %edi
+  803fae:	e8 a2 ff ff ff       	call   803f55 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803fb3:	83 c4 0c             	add    $0xc,%esp
+  803fb6:	ff 75 10             	push   0x10(%ebp)
+  803fb9:	56                   	push   %esi
+  803fba:	53                   	push   %ebx
+  803fbb:	e8 ff d1 ff ff       	call   8011bf <sys_futex_wait>
+  803fc0:	89 c6                	mov    %eax,%esi
+  803fc2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803fc7:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803fcc:	89 3c 24             	mov    %edi,(%esp)
+  803fcf:	e8 13 ff ff ff       	call   803ee7 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803fd4:	83 c4 10             	add    $0x10,%esp
+  803fd7:	83 fe ef             	cmp    $0xffffffef,%esi
+  803fda:	74 05                	je     803fe1 <cond_timedwait+0x4f>
+  803fdc:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803fe1:	89 f0                	mov    %esi,%eax
+  803fe3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fe6:	5b                   	pop    %ebx
+  803fe7:	5e                   	pop    %esi
+  803fe8:	5f                   	pop    %edi
+  803fe9:	5d                   	pop    %ebp
+  803fea:	c3                   	ret
+
+00803feb <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803feb:	55                   	push   %ebp
+  803fec:	89 e5                	mov    %esp,%ebp
+  803fee:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803ff1:	6a ff                	push   $0xffffffff
+  803ff3:	ff 75 0c             	push   0xc(%ebp)
+  803ff6:	ff 75 08             	push   0x8(%ebp)
+  803ff9:	e8 94 ff ff ff       	call   803f92 <cond_timedwait>
+}
+  803ffe:	83 c4 10             	add    $0x10,%esp
+  804001:	c9                   	leave
+  804002:	c3                   	ret
+
+00804003 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804003:	55                   	push   %ebp
+  804004:	89 e5                	mov    %esp,%ebp
+  804006:	83 ec 08             	sub    $0x8,%esp
+  804009:	8b 45 08             	mov    0x8(%ebp),%eax
+  80400c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804011:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804015:	8b 50 04             	mov    0x4(%eax),%edx
+  804018:	85 d2                	test   %edx,%edx
+  80401a:	75 02                	jne    80401e <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  80401c:	c9                   	leave
+  80401d:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  80401e:	83 ec 08             	sub    $0x8,%esp
+  804021:	6a 01                	push   $0x1
+  804023:	50                   	push   %eax
+  804024:	e8 b8 d1 ff ff       	call   8011e1 <sys_futex_wake>
+  804029:	83 c4 10             	add    $0x10,%esp
+}
+  80402c:	eb ee                	jmp    80401c <cond_signal+0x19>
+
+0080402e <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80402e:	55                   	push   %ebp
+  80402f:	89 e5                	mov    %esp,%ebp
+  804031:	83 ec 08             	sub    $0x8,%esp
+  804034:	8b 45 08             	mov    0x8(%ebp),%eax
+  804037:	ba 01 00 00 00       	mov    $0x1,%edx
+  80403c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804040:	8b 50 04             	mov    0x4(%eax),%edx
+  804043:	85 d2                	test   %edx,%edx
+  804045:	75 02                	jne    804049 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  804047:	c9                   	leave
+  804048:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  804049:	83 ec 08             	sub    $0x8,%esp
+  80404c:	68 00 04 00 00       	push   $0x400
+  804051:	50                   	push   %eax
+  804052:	e8 8a d1 ff ff       	call   8011e1 <sys_futex_wake>
+  804057:	83 c4 10             	add    $0x10,%esp
+}
+  80405a:	eb eb                	jmp    804047 <cond_broadcast+0x19>
+
+0080405c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80405c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804061:	c3                   	ret
+
+00804062 <devcons_poll>:
+{
+  804062:	55                   	push   %ebp
+  804063:	89 e5                	mov    %esp,%ebp
+  804065:	53                   	push   %ebx
+  804066:	83 ec 04             	sub    $0x4,%esp
+  804069:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80406c:	89 da                	mov    %ebx,%edx
+  80406e:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804071:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  804078:	74 0c                	je     804086 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80407a:	89 d8                	mov    %ebx,%eax
+  80407c:	83 e0 01             	and    $0x1,%eax
+  80407f:	09 d0                	or     %edx,%eax
+}
+  804081:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804084:	c9                   	leave
+  804085:	c3                   	ret
+		cons_peek = sys_cgetc();
+  804086:	e8 98 cc ff ff       	call   800d23 <sys_cgetc>
+  80408b:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804090:	89 da                	mov    %ebx,%edx
+  804092:	83 e2 04             	and    $0x4,%edx
+  804095:	85 c0                	test   %eax,%eax
+  804097:	74 e6                	je     80407f <devcons_poll+0x1d>
+  804099:	eb df                	jmp    80407a <devcons_poll+0x18>
+
+0080409b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80409b:	55                   	push   %ebp
+  80409c:	89 e5                	mov    %esp,%ebp
+  80409e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8040a1:	68 b2 4a 80 00       	push   $0x804ab2
+  8040a6:	ff 75 0c             	push   0xc(%ebp)
+  8040a9:	e8 df c8 ff ff       	call   80098d <strcpy>
+	return 0;
+}
+  8040ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b3:	c9                   	leave
+  8040b4:	c3                   	ret
+
+008040b5 <devcons_write>:
+{
+  8040b5:	55                   	push   %ebp
+  8040b6:	89 e5                	mov    %esp,%ebp
+  8040b8:	57                   	push   %edi
+  8040b9:	56                   	push   %esi
+  8040ba:	53                   	push   %ebx
+  8040bb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8040c1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8040c4:	85 ff                	test   %edi,%edi
+  8040c6:	74 51                	je     804119 <devcons_write+0x64>
+  8040c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8040cd:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8040d2:	89 fb                	mov    %edi,%ebx
+  8040d4:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8040d6:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8040db:	39 d3                	cmp    %edx,%ebx
+  8040dd:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8040e0:	83 ec 04             	sub    $0x4,%esp
+  8040e3:	53                   	push   %ebx
+  8040e4:	03 45 0c             	add    0xc(%ebp),%eax
+  8040e7:	50                   	push   %eax
+  8040e8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8040ee:	50                   	push   %eax
+  8040ef:	e8 49 ca ff ff       	call   800b3d <memmove>
+		sys_cputs(buf, m);
+  8040f4:	83 c4 08             	add    $0x8,%esp
+  8040f7:	53                   	push   %ebx
+  8040f8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8040fe:	50                   	push   %eax
+  8040ff:	e8 01 cc ff ff       	call   800d05 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804104:	01 de                	add    %ebx,%esi
+  804106:	89 f0                	mov    %esi,%eax
+  804108:	83 c4 10             	add    $0x10,%esp
+  80410b:	39 fe                	cmp    %edi,%esi
+  80410d:	72 c3                	jb     8040d2 <devcons_write+0x1d>
+}
+  80410f:	89 f0                	mov    %esi,%eax
+  804111:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804114:	5b                   	pop    %ebx
+  804115:	5e                   	pop    %esi
+  804116:	5f                   	pop    %edi
+  804117:	5d                   	pop    %ebp
+  804118:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  804119:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80411e:	eb ef                	jmp    80410f <devcons_write+0x5a>
+
+00804120 <devcons_read>:
+{
+  804120:	55                   	push   %ebp
+  804121:	89 e5                	mov    %esp,%ebp
+  804123:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  804126:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80412b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80412f:	74 36                	je     804167 <devcons_read+0x47>
+	c = cons_peek;
+  804131:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  804136:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  80413d:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804140:	85 c0                	test   %eax,%eax
+  804142:	75 10                	jne    804154 <devcons_read+0x34>
+  804144:	e8 da cb ff ff       	call   800d23 <sys_cgetc>
+  804149:	85 c0                	test   %eax,%eax
+  80414b:	75 07                	jne    804154 <devcons_read+0x34>
+		sys_yield();
+  80414d:	e8 50 cc ff ff       	call   800da2 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804152:	eb f0                	jmp    804144 <devcons_read+0x24>
+	if (c < 0)
+  804154:	85 c0                	test   %eax,%eax
+  804156:	78 0f                	js     804167 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  804158:	83 f8 04             	cmp    $0x4,%eax
+  80415b:	74 0c                	je     804169 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80415d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804160:	88 02                	mov    %al,(%edx)
+	return 1;
+  804162:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804167:	c9                   	leave
+  804168:	c3                   	ret
+		return 0;
+  804169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416e:	eb f7                	jmp    804167 <devcons_read+0x47>
+
+00804170 <cputchar>:
+{
+  804170:	55                   	push   %ebp
+  804171:	89 e5                	mov    %esp,%ebp
+  804173:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804176:	8b 45 08             	mov    0x8(%ebp),%eax
+  804179:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80417c:	6a 01                	push   $0x1
+  80417e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804181:	50                   	push   %eax
+  804182:	e8 7e cb ff ff       	call   800d05 <sys_cputs>
+}
+  804187:	83 c4 10             	add    $0x10,%esp
+  80418a:	c9                   	leave
+  80418b:	c3                   	ret
+
+0080418c <getchar>:
+{
+  80418c:	55                   	push   %ebp
+  80418d:	89 e5                	mov    %esp,%ebp
+  80418f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804192:	6a 01                	push   $0x1
+  804194:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804197:	50                   	push   %eax
+  804198:	6a 00                	push   $0x0
+  80419a:	e8 34 de ff ff       	call   801fd3 <read>
+	if (r < 0)
+  80419f:	83 c4 10             	add    $0x10,%esp
+  8041a2:	85 c0                	test   %eax,%eax
+  8041a4:	78 06                	js     8041ac <getchar+0x20>
+	if (r < 1)
+  8041a6:	74 06                	je     8041ae <getchar+0x22>
+	return c;
+  8041a8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8041ac:	c9                   	leave
+  8041ad:	c3                   	ret
+		return -E_EOF;
+  8041ae:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8041b3:	eb f7                	jmp    8041ac <getchar+0x20>
+
+008041b5 <iscons>:
+{
+  8041b5:	55                   	push   %ebp
+  8041b6:	89 e5                	mov    %esp,%ebp
+  8041b8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8041be:	50                   	push   %eax
+  8041bf:	ff 75 08             	push   0x8(%ebp)
+  8041c2:	e8 88 db ff ff       	call   801d4f <fd_lookup>
+  8041c7:	83 c4 10             	add    $0x10,%esp
+  8041ca:	85 c0                	test   %eax,%eax
+  8041cc:	78 11                	js     8041df <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8041ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041d1:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8041d7:	39 10                	cmp    %edx,(%eax)
+  8041d9:	0f 94 c0             	sete   %al
+  8041dc:	0f b6 c0             	movzbl %al,%eax
+}
+  8041df:	c9                   	leave
+  8041e0:	c3                   	ret
+
+008041e1 <opencons>:
+{
+  8041e1:	55                   	push   %ebp
+  8041e2:	89 e5                	mov    %esp,%ebp
+  8041e4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8041e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8041ea:	50                   	push   %eax
+  8041eb:	e8 0f db ff ff       	call   801cff <fd_alloc>
+  8041f0:	83 c4 10             	add    $0x10,%esp
+  8041f3:	85 c0                	test   %eax,%eax
+  8041f5:	78 3a                	js     804231 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8041f7:	83 ec 04             	sub    $0x4,%esp
+  8041fa:	68 07 04 00 00       	push   $0x407
+  8041ff:	ff 75 f4             	push   -0xc(%ebp)
+  804202:	6a 00                	push   $0x0
+  804204:	e8 b8 cb ff ff       	call   800dc1 <sys_page_alloc>
+  804209:	83 c4 10             	add    $0x10,%esp
+  80420c:	85 c0                	test   %eax,%eax
+  80420e:	78 21                	js     804231 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804210:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804213:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  804219:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80421b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80421e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804225:	83 ec 0c             	sub    $0xc,%esp
+  804228:	50                   	push   %eax
+  804229:	e8 aa da ff ff       	call   801cd8 <fd2num>
+  80422e:	83 c4 10             	add    $0x10,%esp
+}
+  804231:	c9                   	leave
+  804232:	c3                   	ret
+
+00804233 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804233:	55                   	push   %ebp
+  804234:	89 e5                	mov    %esp,%ebp
+  804236:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804239:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804240:	74 0a                	je     80424c <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804242:	8b 45 08             	mov    0x8(%ebp),%eax
+  804245:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80424a:	c9                   	leave
+  80424b:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  80424c:	83 ec 04             	sub    $0x4,%esp
+  80424f:	6a 07                	push   $0x7
+  804251:	68 00 f0 bf ee       	push   $0xeebff000
+  804256:	6a 00                	push   $0x0
+  804258:	e8 64 cb ff ff       	call   800dc1 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80425d:	83 c4 08             	add    $0x8,%esp
+  804260:	68 71 42 80 00       	push   $0x804271
+  804265:	6a 00                	push   $0x0
+  804267:	e8 a0 cc ff ff       	call   800f0c <sys_env_set_pgfault_upcall>
+  80426c:	83 c4 10             	add    $0x10,%esp
+  80426f:	eb d1                	jmp    804242 <set_pgfault_handler+0xf>
+
+00804271 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804271:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804272:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804277:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804279:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  80427c:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804280:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804283:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804287:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804289:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80428d:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804290:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804291:	83 c4 04             	add    $0x4,%esp
+	popf
+  804294:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804295:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804296:	c3                   	ret
+
+00804297 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804297:	55                   	push   %ebp
+  804298:	89 e5                	mov    %esp,%ebp
+  80429a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80429d:	89 c2                	mov    %eax,%edx
+  80429f:	c1 ea 16             	shr    $0x16,%edx
+  8042a2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8042a9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8042ae:	f6 c1 01             	test   $0x1,%cl
+  8042b1:	74 1e                	je     8042d1 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8042b3:	c1 e8 0c             	shr    $0xc,%eax
+  8042b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8042bd:	a8 01                	test   $0x1,%al
+  8042bf:	74 10                	je     8042d1 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8042c1:	c1 e8 0c             	shr    $0xc,%eax
+  8042c4:	c1 e0 04             	shl    $0x4,%eax
+  8042c7:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8042ce:	0f b7 d2             	movzwl %dx,%edx
+}
+  8042d1:	89 d0                	mov    %edx,%eax
+  8042d3:	5d                   	pop    %ebp
+  8042d4:	c3                   	ret
+
+008042d5 <__udivdi3>:
+  8042d5:	57                   	push   %edi
+  8042d6:	56                   	push   %esi
+  8042d7:	53                   	push   %ebx
+  8042d8:	83 ec 20             	sub    $0x20,%esp
+  8042db:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8042df:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8042e3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8042e7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8042eb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8042ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8042f3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8042f7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8042fb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804300:	b8 00 00 00 00       	mov    $0x0,%eax
+  804305:	ba 00 00 00 00       	mov    $0x0,%edx
+  80430a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804311:	00 
+  804312:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804319:	00 
+  80431a:	eb 08                	jmp    804324 <__udivdi3+0x4f>
+  80431c:	83 e9 01             	sub    $0x1,%ecx
+  80431f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804322:	74 68                	je     80438c <__udivdi3+0xb7>
+  804324:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804328:	01 c0                	add    %eax,%eax
+  80432a:	89 c6                	mov    %eax,%esi
+  80432c:	89 d7                	mov    %edx,%edi
+  80432e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804332:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804336:	0f ad d0             	shrd   %cl,%edx,%eax
+  804339:	d3 ea                	shr    %cl,%edx
+  80433b:	f6 c1 20             	test   $0x20,%cl
+  80433e:	74 04                	je     804344 <__udivdi3+0x6f>
+  804340:	89 d0                	mov    %edx,%eax
+  804342:	31 d2                	xor    %edx,%edx
+  804344:	83 e0 01             	and    $0x1,%eax
+  804347:	89 04 24             	mov    %eax,(%esp)
+  80434a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804351:	00 
+  804352:	8b 04 24             	mov    (%esp),%eax
+  804355:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804359:	09 f0                	or     %esi,%eax
+  80435b:	09 fa                	or     %edi,%edx
+  80435d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804361:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804365:	39 f0                	cmp    %esi,%eax
+  804367:	89 d3                	mov    %edx,%ebx
+  804369:	19 fb                	sbb    %edi,%ebx
+  80436b:	72 af                	jb     80431c <__udivdi3+0x47>
+  80436d:	29 f0                	sub    %esi,%eax
+  80436f:	19 fa                	sbb    %edi,%edx
+  804371:	89 cf                	mov    %ecx,%edi
+  804373:	c1 ef 05             	shr    $0x5,%edi
+  804376:	83 e7 01             	and    $0x1,%edi
+  804379:	89 fe                	mov    %edi,%esi
+  80437b:	83 f6 01             	xor    $0x1,%esi
+  80437e:	d3 e6                	shl    %cl,%esi
+  804380:	d3 e7                	shl    %cl,%edi
+  804382:	09 74 24 18          	or     %esi,0x18(%esp)
+  804386:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80438a:	eb 90                	jmp    80431c <__udivdi3+0x47>
+  80438c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804390:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804394:	83 c4 20             	add    $0x20,%esp
+  804397:	5b                   	pop    %ebx
+  804398:	5e                   	pop    %esi
+  804399:	5f                   	pop    %edi
+  80439a:	c3                   	ret
+
+0080439b <__umoddi3>:
+  80439b:	57                   	push   %edi
+  80439c:	56                   	push   %esi
+  80439d:	53                   	push   %ebx
+  80439e:	83 ec 08             	sub    $0x8,%esp
+  8043a1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8043a5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8043a9:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8043ad:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8043b1:	57                   	push   %edi
+  8043b2:	56                   	push   %esi
+  8043b3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8043b7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8043bb:	52                   	push   %edx
+  8043bc:	50                   	push   %eax
+  8043bd:	e8 13 ff ff ff       	call   8042d5 <__udivdi3>
+  8043c2:	89 c3                	mov    %eax,%ebx
+  8043c4:	0f af d6             	imul   %esi,%edx
+  8043c7:	89 f9                	mov    %edi,%ecx
+  8043c9:	0f af cb             	imul   %ebx,%ecx
+  8043cc:	01 d1                	add    %edx,%ecx
+  8043ce:	89 d8                	mov    %ebx,%eax
+  8043d0:	f7 e6                	mul    %esi
+  8043d2:	89 c6                	mov    %eax,%esi
+  8043d4:	89 d7                	mov    %edx,%edi
+  8043d6:	01 cf                	add    %ecx,%edi
+  8043d8:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8043dc:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8043e0:	29 f0                	sub    %esi,%eax
+  8043e2:	19 fa                	sbb    %edi,%edx
+  8043e4:	83 c4 18             	add    $0x18,%esp
+  8043e7:	5b                   	pop    %ebx
+  8043e8:	5e                   	pop    %esi
+  8043e9:	5f                   	pop    %edi
+  8043ea:	c3                   	ret
+
+008043eb <__divdi3>:
+  8043eb:	53                   	push   %ebx
+  8043ec:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8043f0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8043f4:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8043f8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8043fc:	85 d2                	test   %edx,%edx
+  8043fe:	78 12                	js     804412 <__divdi3+0x27>
+  804400:	85 db                	test   %ebx,%ebx
+  804402:	78 2e                	js     804432 <__divdi3+0x47>
+  804404:	53                   	push   %ebx
+  804405:	51                   	push   %ecx
+  804406:	52                   	push   %edx
+  804407:	50                   	push   %eax
+  804408:	e8 c8 fe ff ff       	call   8042d5 <__udivdi3>
+  80440d:	83 c4 10             	add    $0x10,%esp
+  804410:	eb 1e                	jmp    804430 <__divdi3+0x45>
+  804412:	f7 d8                	neg    %eax
+  804414:	83 d2 00             	adc    $0x0,%edx
+  804417:	f7 da                	neg    %edx
+  804419:	85 db                	test   %ebx,%ebx
+  80441b:	78 2a                	js     804447 <__divdi3+0x5c>
+  80441d:	53                   	push   %ebx
+  80441e:	51                   	push   %ecx
+  80441f:	52                   	push   %edx
+  804420:	50                   	push   %eax
+  804421:	e8 af fe ff ff       	call   8042d5 <__udivdi3>
+  804426:	83 c4 10             	add    $0x10,%esp
+  804429:	f7 d8                	neg    %eax
+  80442b:	83 d2 00             	adc    $0x0,%edx
+  80442e:	f7 da                	neg    %edx
+  804430:	5b                   	pop    %ebx
+  804431:	c3                   	ret
+  804432:	f7 d9                	neg    %ecx
+  804434:	83 d3 00             	adc    $0x0,%ebx
+  804437:	f7 db                	neg    %ebx
+  804439:	53                   	push   %ebx
+  80443a:	51                   	push   %ecx
+  80443b:	52                   	push   %edx
+  80443c:	50                   	push   %eax
+  80443d:	e8 93 fe ff ff       	call   8042d5 <__udivdi3>
+  804442:	83 c4 10             	add    $0x10,%esp
+  804445:	eb e2                	jmp    804429 <__divdi3+0x3e>
+  804447:	f7 d9                	neg    %ecx
+  804449:	83 d3 00             	adc    $0x0,%ebx
+  80444c:	f7 db                	neg    %ebx
+  80444e:	53                   	push   %ebx
+  80444f:	51                   	push   %ecx
+  804450:	52                   	push   %edx
+  804451:	50                   	push   %eax
+  804452:	e8 7e fe ff ff       	call   8042d5 <__udivdi3>
+  804457:	83 c4 10             	add    $0x10,%esp
+  80445a:	eb d4                	jmp    804430 <__divdi3+0x45>
+
+0080445c <__moddi3>:
+  80445c:	57                   	push   %edi
+  80445d:	56                   	push   %esi
+  80445e:	53                   	push   %ebx
+  80445f:	83 ec 08             	sub    $0x8,%esp
+  804462:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804466:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80446a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80446e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804472:	57                   	push   %edi
+  804473:	56                   	push   %esi
+  804474:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804478:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80447c:	52                   	push   %edx
+  80447d:	50                   	push   %eax
+  80447e:	e8 68 ff ff ff       	call   8043eb <__divdi3>
+  804483:	89 c3                	mov    %eax,%ebx
+  804485:	0f af d6             	imul   %esi,%edx
+  804488:	89 f9                	mov    %edi,%ecx
+  80448a:	0f af cb             	imul   %ebx,%ecx
+  80448d:	01 d1                	add    %edx,%ecx
+  80448f:	89 d8                	mov    %ebx,%eax
+  804491:	f7 e6                	mul    %esi
+  804493:	89 c6                	mov    %eax,%esi
+  804495:	89 d7                	mov    %edx,%edi
+  804497:	01 cf                	add    %ecx,%edi
+  804499:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80449d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044a1:	29 f0                	sub    %esi,%eax
+  8044a3:	19 fa                	sbb    %edi,%edx
+  8044a5:	83 c4 18             	add    $0x18,%esp
+  8044a8:	5b                   	pop    %ebx
+  8044a9:	5e                   	pop    %esi
+  8044aa:	5f                   	pop    %edi
+  8044ab:	c3                   	ret
@@ -0,0 +1,9474 @@
+
+obj/user/primesmp.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 86 04 00 00       	call   8004b7 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <worker>:
+	return n;
+}
+
+static void
+worker(void *arg)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 2c             	sub    $0x2c,%esp
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80003e:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800040:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800045:	29 d0                	sub    %edx,%eax
+  800047:	89 c2                	mov    %eax,%edx
+  800049:	c1 ea 0f             	shr    $0xf,%edx
+  80004c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800051:	b8 00 00 00 00       	mov    $0x0,%eax
+  800056:	0f 42 c2             	cmovb  %edx,%eax
+	uint32_t b, n = 0;
+
+	if (thisenv->env_id != sys_getenvid())
+  800059:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  800060:	8b 58 48             	mov    0x48(%eax),%ebx
+  800063:	e8 be 10 00 00       	call   801126 <sys_getenvid>
+  800068:	39 c3                	cmp    %eax,%ebx
+  80006a:	74 0d                	je     800079 <worker+0x44>
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  80006c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800071:	f0 0f c1 05 00 68 80 	lock xadd %eax,0x806800
+  800078:	00 
+  800079:	ba 01 00 00 00       	mov    $0x1,%edx
+  80007e:	f0 0f c1 15 08 68 80 	lock xadd %edx,0x806808
+  800085:	00 
+  800086:	89 d0                	mov    %edx,%eax
+		xadd(&bad_thisenv, 1);
+	while ((b = xadd(&next_block, 1)) < NBLOCK)
+  800088:	83 fa 3f             	cmp    $0x3f,%edx
+  80008b:	0f 87 2d 01 00 00    	ja     8001be <worker+0x189>
+  800091:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  800098:	e9 d0 00 00 00       	jmp    80016d <worker+0x138>
+			i += ROUNDUP(lo - i, p);
+  80009d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8000a0:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+  8000a3:	89 f8                	mov    %edi,%eax
+  8000a5:	29 c8                	sub    %ecx,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	f7 f6                	div    %esi
+  8000ae:	89 f9                	mov    %edi,%ecx
+  8000b0:	29 d1                	sub    %edx,%ecx
+		for (; i < hi; i += p)
+  8000b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b5:	39 c1                	cmp    %eax,%ecx
+  8000b7:	73 21                	jae    8000da <worker+0xa5>
+  8000b9:	89 c8                	mov    %ecx,%eax
+  8000bb:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8000be:	29 d0                	sub    %edx,%eax
+			w[(i - lo) / 32] |= 1 << (i % 32);
+  8000c0:	89 c2                	mov    %eax,%edx
+  8000c2:	c1 ea 05             	shr    $0x5,%edx
+  8000c5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000ca:	d3 e7                	shl    %cl,%edi
+  8000cc:	09 3c 93             	or     %edi,(%ebx,%edx,4)
+		for (; i < hi; i += p)
+  8000cf:	01 f1                	add    %esi,%ecx
+  8000d1:	01 f0                	add    %esi,%eax
+  8000d3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8000d6:	39 d1                	cmp    %edx,%ecx
+  8000d8:	72 e6                	jb     8000c0 <worker+0x8b>
+	for (j = 0; j < nbase; j++) {
+  8000da:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  8000de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8000e1:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8000e4:	39 f0                	cmp    %esi,%eax
+  8000e6:	74 1a                	je     800102 <worker+0xcd>
+		p = base[j];
+  8000e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8000eb:	8b 34 85 20 68 80 00 	mov    0x806820(,%eax,4),%esi
+		i = (p * p) / 2;
+  8000f2:	89 f1                	mov    %esi,%ecx
+  8000f4:	0f af ce             	imul   %esi,%ecx
+  8000f7:	d1 e9                	shr    %ecx
+		if (i < lo)
+  8000f9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8000fc:	39 c1                	cmp    %eax,%ecx
+  8000fe:	73 b2                	jae    8000b2 <worker+0x7d>
+  800100:	eb 9b                	jmp    80009d <worker+0x68>
+	for (i = 0; i < BLOCK / 32; i++)
+  800102:	89 da                	mov    %ebx,%edx
+  800104:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	uint32_t i, j, p, n = 0;
+  80010a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		n += 32 - popcount(w[i]);
+  80010f:	be 20 00 00 00       	mov    $0x20,%esi
+  800114:	8b 02                	mov    (%edx),%eax
+	x = x - ((x >> 1) & 0x55555555);
+  800116:	89 c7                	mov    %eax,%edi
+  800118:	d1 ef                	shr    %edi
+  80011a:	81 e7 55 55 55 55    	and    $0x55555555,%edi
+  800120:	29 f8                	sub    %edi,%eax
+	x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+  800122:	89 c7                	mov    %eax,%edi
+  800124:	81 e7 33 33 33 33    	and    $0x33333333,%edi
+  80012a:	c1 e8 02             	shr    $0x2,%eax
+  80012d:	25 33 33 33 33       	and    $0x33333333,%eax
+  800132:	01 c7                	add    %eax,%edi
+	x = (x + (x >> 4)) & 0x0F0F0F0F;
+  800134:	89 f8                	mov    %edi,%eax
+  800136:	c1 e8 04             	shr    $0x4,%eax
+  800139:	01 f8                	add    %edi,%eax
+  80013b:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+	return (x * 0x01010101) >> 24;
+  800140:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800146:	c1 e8 18             	shr    $0x18,%eax
+		n += 32 - popcount(w[i]);
+  800149:	89 f7                	mov    %esi,%edi
+  80014b:	29 c7                	sub    %eax,%edi
+  80014d:	01 f9                	add    %edi,%ecx
+	for (i = 0; i < BLOCK / 32; i++)
+  80014f:	83 c2 04             	add    $0x4,%edx
+  800152:	39 da                	cmp    %ebx,%edx
+  800154:	75 be                	jne    800114 <worker+0xdf>
+		n += sieve_block(b);
+  800156:	01 4d d0             	add    %ecx,-0x30(%ebp)
+  800159:	ba 01 00 00 00       	mov    $0x1,%edx
+  80015e:	f0 0f c1 15 08 68 80 	lock xadd %edx,0x806808
+  800165:	00 
+  800166:	89 d0                	mov    %edx,%eax
+	while ((b = xadd(&next_block, 1)) < NBLOCK)
+  800168:	83 fa 3f             	cmp    $0x3f,%edx
+  80016b:	77 58                	ja     8001c5 <worker+0x190>
+	uint32_t *w = &sieve[b * BLOCK / 32];
+  80016d:	c1 e0 0f             	shl    $0xf,%eax
+  800170:	89 c6                	mov    %eax,%esi
+  800172:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800175:	89 c3                	mov    %eax,%ebx
+  800177:	c1 eb 03             	shr    $0x3,%ebx
+  80017a:	81 c3 00 80 80 00    	add    $0x808000,%ebx
+	uint32_t lo = b * BLOCK, hi = lo + BLOCK;	// Bit indexes
+  800180:	8d 80 00 80 00 00    	lea    0x8000(%eax),%eax
+  800186:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	memset(w, 0, BLOCK / 8);
+  800189:	83 ec 04             	sub    $0x4,%esp
+  80018c:	68 00 10 00 00       	push   $0x1000
+  800191:	6a 00                	push   $0x0
+  800193:	53                   	push   %ebx
+  800194:	e8 12 0d 00 00       	call   800eab <memset>
+	for (j = 0; j < nbase; j++) {
+  800199:	a1 0c 68 80 00       	mov    0x80680c,%eax
+  80019e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	0f 84 56 ff ff ff    	je     800102 <worker+0xcd>
+  8001ac:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  8001b3:	8d 46 ff             	lea    -0x1(%esi),%eax
+  8001b6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8001b9:	e9 2a ff ff ff       	jmp    8000e8 <worker+0xb3>
+	while ((b = xadd(&next_block, 1)) < NBLOCK)
+  8001be:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8001c5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8001c8:	f0 0f c1 05 04 68 80 	lock xadd %eax,0x806804
+  8001cf:	00 
+	xadd(&nprimes, n);
+}
+  8001d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d3:	5b                   	pop    %ebx
+  8001d4:	5e                   	pop    %esi
+  8001d5:	5f                   	pop    %edi
+  8001d6:	5d                   	pop    %ebp
+  8001d7:	c3                   	ret
+
+008001d8 <run>:
+
+// Sieve with 'nthread' threads, counting this one.
+static uint64_t
+run(int nthread)
+{
+  8001d8:	55                   	push   %ebp
+  8001d9:	89 e5                	mov    %esp,%ebp
+  8001db:	57                   	push   %edi
+  8001dc:	56                   	push   %esi
+  8001dd:	53                   	push   %ebx
+  8001de:	83 ec 2c             	sub    $0x2c,%esp
+  8001e1:	89 c3                	mov    %eax,%ebx
+	envid_t kids[4];
+	uint64_t t0;
+	int i;
+
+	next_block = nprimes = 0;
+  8001e3:	c7 05 04 68 80 00 00 	movl   $0x0,0x806804
+  8001ea:	00 00 00 
+  8001ed:	c7 05 08 68 80 00 00 	movl   $0x0,0x806808
+  8001f4:	00 00 00 
+        __asm __volatile("rdtsc" : "=A" (tsc));
+  8001f7:	0f 31                	rdtsc
+  8001f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8001fc:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	t0 = read_tsc();
+	for (i = 1; i < nthread; i++)
+  8001ff:	83 fb 01             	cmp    $0x1,%ebx
+  800202:	0f 8e ae 00 00 00    	jle    8002b6 <run+0xde>
+  800208:	be 01 00 00 00       	mov    $0x1,%esi
+  80020d:	eb 02                	jmp    800211 <run+0x39>
+  80020f:	89 c6                	mov    %eax,%esi
+		if ((kids[i] = sfork(worker, 0)) < 0)
+  800211:	83 ec 08             	sub    $0x8,%esp
+  800214:	6a 00                	push   $0x0
+  800216:	68 35 00 80 00       	push   $0x800035
+  80021b:	e8 47 19 00 00       	call   801b67 <sfork>
+  800220:	89 44 b5 d8          	mov    %eax,-0x28(%ebp,%esi,4)
+  800224:	83 c4 10             	add    $0x10,%esp
+  800227:	85 c0                	test   %eax,%eax
+  800229:	78 79                	js     8002a4 <run+0xcc>
+	for (i = 1; i < nthread; i++)
+  80022b:	8d 46 01             	lea    0x1(%esi),%eax
+  80022e:	39 c3                	cmp    %eax,%ebx
+  800230:	75 dd                	jne    80020f <run+0x37>
+			panic("sfork: %e", kids[i]);
+	worker(0);
+  800232:	83 ec 0c             	sub    $0xc,%esp
+  800235:	6a 00                	push   $0x0
+  800237:	e8 f9 fd ff ff       	call   800035 <worker>
+  80023c:	83 c4 10             	add    $0x10,%esp
+	for (i = 1; i < nthread; i++)
+  80023f:	bf 01 00 00 00       	mov    $0x1,%edi
+		wait(kids[i]);
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 74 bd d8          	push   -0x28(%ebp,%edi,4)
+  80024b:	e8 4e 3b 00 00       	call   803d9e <wait>
+	for (i = 1; i < nthread; i++)
+  800250:	89 f8                	mov    %edi,%eax
+  800252:	83 c7 01             	add    $0x1,%edi
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	39 c6                	cmp    %eax,%esi
+  80025a:	75 e8                	jne    800244 <run+0x6c>
+  80025c:	0f 31                	rdtsc
+	t0 = read_tsc() - t0;
+  80025e:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  800261:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+  800264:	89 c6                	mov    %eax,%esi
+  800266:	89 d7                	mov    %edx,%edi
+	// 1 counts as a prime in bit 0, and 2 is missing: they cancel.
+	cprintf("primesmp: %d threads: %d primes below %d in %u Mcycles\n",
+  800268:	a1 04 68 80 00       	mov    0x806804,%eax
+  80026d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800270:	83 ec 10             	sub    $0x10,%esp
+		nthread, nprimes, N, (uint32_t) (t0 / 1000000));
+  800273:	6a 00                	push   $0x0
+  800275:	68 40 42 0f 00       	push   $0xf4240
+  80027a:	52                   	push   %edx
+  80027b:	56                   	push   %esi
+  80027c:	e8 59 44 00 00       	call   8046da <__udivdi3>
+  800281:	83 c4 14             	add    $0x14,%esp
+	cprintf("primesmp: %d threads: %d primes below %d in %u Mcycles\n",
+  800284:	50                   	push   %eax
+  800285:	68 00 00 40 00       	push   $0x400000
+  80028a:	ff 75 d0             	push   -0x30(%ebp)
+  80028d:	53                   	push   %ebx
+  80028e:	68 f4 48 80 00       	push   $0x8048f4
+  800293:	e8 a1 03 00 00       	call   800639 <cprintf>
+	return t0;
+}
+  800298:	89 f0                	mov    %esi,%eax
+  80029a:	89 fa                	mov    %edi,%edx
+  80029c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80029f:	5b                   	pop    %ebx
+  8002a0:	5e                   	pop    %esi
+  8002a1:	5f                   	pop    %edi
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+			panic("sfork: %e", kids[i]);
+  8002a4:	50                   	push   %eax
+  8002a5:	68 c0 48 80 00       	push   $0x8048c0
+  8002aa:	6a 61                	push   $0x61
+  8002ac:	68 ca 48 80 00       	push   $0x8048ca
+  8002b1:	e8 a8 02 00 00       	call   80055e <_panic>
+	worker(0);
+  8002b6:	83 ec 0c             	sub    $0xc,%esp
+  8002b9:	6a 00                	push   $0x0
+  8002bb:	e8 75 fd ff ff       	call   800035 <worker>
+  8002c0:	83 c4 10             	add    $0x10,%esp
+  8002c3:	eb 97                	jmp    80025c <run+0x84>
+
+008002c5 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 3c             	sub    $0x3c,%esp
+	uint64_t t1, t;
+	uint32_t count;
+	int n;
+
+	binaryname = "primesmp";
+  8002ce:	c7 05 00 50 80 00 da 	movl   $0x8048da,0x805000
+  8002d5:	48 80 00 
+	for (p = 3; p < SQRTN; p += 2) {
+  8002d8:	a1 0c 68 80 00       	mov    0x80680c,%eax
+	binaryname = "primesmp";
+  8002dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (p = 3; p < SQRTN; p += 2) {
+  8002e2:	ba 03 00 00 00       	mov    $0x3,%edx
+		for (m = p * p; m < SQRTN; m += 2 * p)
+  8002e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8002ec:	eb 1f                	jmp    80030d <umain+0x48>
+			composite[m] = 1;
+  8002ee:	c6 80 00 60 80 00 01 	movb   $0x1,0x806000(%eax)
+		for (m = p * p; m < SQRTN; m += 2 * p)
+  8002f5:	01 c8                	add    %ecx,%eax
+  8002f7:	3d ff 07 00 00       	cmp    $0x7ff,%eax
+  8002fc:	76 f0                	jbe    8002ee <umain+0x29>
+		base[nbase++] = p;
+  8002fe:	89 d8                	mov    %ebx,%eax
+  800300:	89 f1                	mov    %esi,%ecx
+	for (p = 3; p < SQRTN; p += 2) {
+  800302:	83 c2 02             	add    $0x2,%edx
+  800305:	81 fa 01 08 00 00    	cmp    $0x801,%edx
+  80030b:	74 2a                	je     800337 <umain+0x72>
+		if (composite[p])
+  80030d:	80 ba 00 60 80 00 00 	cmpb   $0x0,0x806000(%edx)
+  800314:	75 ec                	jne    800302 <umain+0x3d>
+		base[nbase++] = p;
+  800316:	8d 58 01             	lea    0x1(%eax),%ebx
+  800319:	89 14 85 20 68 80 00 	mov    %edx,0x806820(,%eax,4)
+		for (m = p * p; m < SQRTN; m += 2 * p)
+  800320:	89 d0                	mov    %edx,%eax
+  800322:	0f af c2             	imul   %edx,%eax
+  800325:	3d ff 07 00 00       	cmp    $0x7ff,%eax
+  80032a:	77 05                	ja     800331 <umain+0x6c>
+  80032c:	8d 0c 12             	lea    (%edx,%edx,1),%ecx
+  80032f:	eb bd                	jmp    8002ee <umain+0x29>
+		base[nbase++] = p;
+  800331:	89 d8                	mov    %ebx,%eax
+		for (m = p * p; m < SQRTN; m += 2 * p)
+  800333:	89 f1                	mov    %esi,%ecx
+  800335:	eb cb                	jmp    800302 <umain+0x3d>
+  800337:	84 c9                	test   %cl,%cl
+  800339:	74 05                	je     800340 <umain+0x7b>
+  80033b:	a3 0c 68 80 00       	mov    %eax,0x80680c
+	find_base();
+	t1 = run(1);
+  800340:	b8 01 00 00 00       	mov    $0x1,%eax
+  800345:	e8 8e fe ff ff       	call   8001d8 <run>
+  80034a:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  80034d:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	count = nprimes;
+  800350:	8b 3d 04 68 80 00    	mov    0x806804,%edi
+  800356:	89 7d cc             	mov    %edi,-0x34(%ebp)
+		if (nprimes != count)
+			panic("%d threads counted %d primes, not %d",
+			      n, nprimes, count);
+		cprintf("primesmp: %d threads: speedup %u.%02u\n", n,
+			(uint32_t) (t1 / t),
+			(uint32_t) (t1 * 100 / t % 100));
+  800359:	89 c6                	mov    %eax,%esi
+  80035b:	6b ca 64             	imul   $0x64,%edx,%ecx
+  80035e:	bb 64 00 00 00       	mov    $0x64,%ebx
+  800363:	89 d8                	mov    %ebx,%eax
+  800365:	f7 e6                	mul    %esi
+  800367:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80036d:	01 4d d4             	add    %ecx,-0x2c(%ebp)
+	for (n = 2; n <= 4; n *= 2) {
+  800370:	bf 02 00 00 00       	mov    $0x2,%edi
+		t = run(n);
+  800375:	89 f8                	mov    %edi,%eax
+  800377:	e8 5c fe ff ff       	call   8001d8 <run>
+  80037c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80037f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		if (nprimes != count)
+  800382:	a1 04 68 80 00       	mov    0x806804,%eax
+  800387:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80038a:	39 f0                	cmp    %esi,%eax
+  80038c:	0f 85 ef 00 00 00    	jne    800481 <umain+0x1bc>
+			(uint32_t) (t1 * 100 / t % 100));
+  800392:	ff 75 e4             	push   -0x1c(%ebp)
+  800395:	ff 75 e0             	push   -0x20(%ebp)
+  800398:	ff 75 d4             	push   -0x2c(%ebp)
+  80039b:	ff 75 d0             	push   -0x30(%ebp)
+  80039e:	e8 37 43 00 00       	call   8046da <__udivdi3>
+  8003a3:	83 c4 10             	add    $0x10,%esp
+  8003a6:	89 c1                	mov    %eax,%ecx
+  8003a8:	89 d3                	mov    %edx,%ebx
+  8003aa:	89 c6                	mov    %eax,%esi
+  8003ac:	81 e6 ff ff 0f 00    	and    $0xfffff,%esi
+  8003b2:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+  8003b6:	c1 ea 14             	shr    $0x14,%edx
+  8003b9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+  8003be:	01 c6                	add    %eax,%esi
+  8003c0:	89 d8                	mov    %ebx,%eax
+  8003c2:	c1 e8 08             	shr    $0x8,%eax
+  8003c5:	25 ff ff 0f 00       	and    $0xfffff,%eax
+  8003ca:	01 c6                	add    %eax,%esi
+  8003cc:	89 d8                	mov    %ebx,%eax
+  8003ce:	c1 e8 1c             	shr    $0x1c,%eax
+  8003d1:	01 c6                	add    %eax,%esi
+  8003d3:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  8003d8:	f7 e6                	mul    %esi
+  8003da:	c1 ea 03             	shr    $0x3,%edx
+  8003dd:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8003e0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003e3:	29 c6                	sub    %eax,%esi
+  8003e5:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8003e8:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  8003ef:	89 c8                	mov    %ecx,%eax
+  8003f1:	89 da                	mov    %ebx,%edx
+  8003f3:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  8003f6:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+  8003f9:	69 f2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%esi
+  8003ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800402:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800405:	69 55 d8 f5 28 5c 8f 	imul   $0x8f5c28f5,-0x28(%ebp),%edx
+  80040c:	01 d6                	add    %edx,%esi
+  80040e:	b8 29 5c 8f c2       	mov    $0xc28f5c29,%eax
+  800413:	f7 65 d8             	mull   -0x28(%ebp)
+  800416:	01 f2                	add    %esi,%edx
+  800418:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+  80041c:	c1 ea 02             	shr    $0x2,%edx
+  80041f:	6b f2 64             	imul   $0x64,%edx,%esi
+  800422:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800425:	be 64 00 00 00       	mov    $0x64,%esi
+  80042a:	f7 e6                	mul    %esi
+  80042c:	29 c1                	sub    %eax,%ecx
+		cprintf("primesmp: %d threads: speedup %u.%02u\n", n,
+  80042e:	51                   	push   %ecx
+			(uint32_t) (t1 / t),
+  80042f:	83 ec 0c             	sub    $0xc,%esp
+  800432:	ff 75 e4             	push   -0x1c(%ebp)
+  800435:	ff 75 e0             	push   -0x20(%ebp)
+  800438:	ff 75 c4             	push   -0x3c(%ebp)
+  80043b:	ff 75 c0             	push   -0x40(%ebp)
+  80043e:	e8 97 42 00 00       	call   8046da <__udivdi3>
+  800443:	83 c4 1c             	add    $0x1c,%esp
+		cprintf("primesmp: %d threads: speedup %u.%02u\n", n,
+  800446:	50                   	push   %eax
+  800447:	57                   	push   %edi
+  800448:	68 54 49 80 00       	push   $0x804954
+  80044d:	e8 e7 01 00 00       	call   800639 <cprintf>
+	for (n = 2; n <= 4; n *= 2) {
+  800452:	01 ff                	add    %edi,%edi
+  800454:	83 c4 10             	add    $0x10,%esp
+  800457:	83 ff 04             	cmp    $0x4,%edi
+  80045a:	0f 8e 15 ff ff ff    	jle    800375 <umain+0xb0>
+	}
+	if (bad_thisenv)
+  800460:	a1 00 68 80 00       	mov    0x806800,%eax
+  800465:	85 c0                	test   %eax,%eax
+  800467:	75 34                	jne    80049d <umain+0x1d8>
+		panic("%d threads had the wrong thisenv", bad_thisenv);
+	cprintf("primesmp: OK\n");
+  800469:	83 ec 0c             	sub    $0xc,%esp
+  80046c:	68 e3 48 80 00       	push   $0x8048e3
+  800471:	e8 c3 01 00 00       	call   800639 <cprintf>
+}
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80047c:	5b                   	pop    %ebx
+  80047d:	5e                   	pop    %esi
+  80047e:	5f                   	pop    %edi
+  80047f:	5d                   	pop    %ebp
+  800480:	c3                   	ret
+			panic("%d threads counted %d primes, not %d",
+  800481:	a1 04 68 80 00       	mov    0x806804,%eax
+  800486:	83 ec 08             	sub    $0x8,%esp
+  800489:	56                   	push   %esi
+  80048a:	50                   	push   %eax
+  80048b:	57                   	push   %edi
+  80048c:	68 2c 49 80 00       	push   $0x80492c
+  800491:	6a 7a                	push   $0x7a
+  800493:	68 ca 48 80 00       	push   $0x8048ca
+  800498:	e8 c1 00 00 00       	call   80055e <_panic>
+		panic("%d threads had the wrong thisenv", bad_thisenv);
+  80049d:	a1 00 68 80 00       	mov    0x806800,%eax
+  8004a2:	50                   	push   %eax
+  8004a3:	68 7c 49 80 00       	push   $0x80497c
+  8004a8:	68 81 00 00 00       	push   $0x81
+  8004ad:	68 ca 48 80 00       	push   $0x8048ca
+  8004b2:	e8 a7 00 00 00       	call   80055e <_panic>
+
+008004b7 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004b7:	55                   	push   %ebp
+  8004b8:	89 e5                	mov    %esp,%ebp
+  8004ba:	56                   	push   %esi
+  8004bb:	53                   	push   %ebx
+  8004bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8004c2:	89 e2                	mov    %esp,%edx
+  8004c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8004c9:	29 d0                	sub    %edx,%eax
+  8004cb:	89 c2                	mov    %eax,%edx
+  8004cd:	c1 ea 0f             	shr    $0xf,%edx
+  8004d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8004d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004da:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8004dd:	c7 04 85 00 8a 84 00 	movl   $0x0,0x848a00(,%eax,4)
+  8004e4:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8004e8:	e8 39 0c 00 00       	call   801126 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8004ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004f2:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8004f8:	89 e1                	mov    %esp,%ecx
+  8004fa:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8004ff:	29 ca                	sub    %ecx,%edx
+  800501:	89 d1                	mov    %edx,%ecx
+  800503:	c1 e9 0f             	shr    $0xf,%ecx
+  800506:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80050c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800511:	0f 42 d1             	cmovb  %ecx,%edx
+  800514:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800519:	89 04 95 00 8a 84 00 	mov    %eax,0x848a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800520:	85 db                	test   %ebx,%ebx
+  800522:	7e 07                	jle    80052b <libmain+0x74>
+		binaryname = argv[0];
+  800524:	8b 06                	mov    (%esi),%eax
+  800526:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	56                   	push   %esi
+  80052f:	53                   	push   %ebx
+  800530:	e8 90 fd ff ff       	call   8002c5 <umain>
+
+	// exit gracefully
+	exit();
+  800535:	e8 0a 00 00 00       	call   800544 <exit>
+}
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800540:	5b                   	pop    %ebx
+  800541:	5e                   	pop    %esi
+  800542:	5d                   	pop    %ebp
+  800543:	c3                   	ret
+
+00800544 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800544:	55                   	push   %ebp
+  800545:	89 e5                	mov    %esp,%ebp
+  800547:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80054a:	e8 dd 19 00 00       	call   801f2c <close_all>
+	sys_env_destroy(0);
+  80054f:	83 ec 0c             	sub    $0xc,%esp
+  800552:	6a 00                	push   $0x0
+  800554:	e8 8c 0b 00 00       	call   8010e5 <sys_env_destroy>
+}
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	c9                   	leave
+  80055d:	c3                   	ret
+
+0080055e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80055e:	55                   	push   %ebp
+  80055f:	89 e5                	mov    %esp,%ebp
+  800561:	56                   	push   %esi
+  800562:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800563:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800566:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80056c:	e8 b5 0b 00 00       	call   801126 <sys_getenvid>
+  800571:	83 ec 0c             	sub    $0xc,%esp
+  800574:	ff 75 0c             	push   0xc(%ebp)
+  800577:	ff 75 08             	push   0x8(%ebp)
+  80057a:	56                   	push   %esi
+  80057b:	50                   	push   %eax
+  80057c:	68 a8 49 80 00       	push   $0x8049a8
+  800581:	e8 b3 00 00 00       	call   800639 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800586:	83 c4 18             	add    $0x18,%esp
+  800589:	53                   	push   %ebx
+  80058a:	ff 75 10             	push   0x10(%ebp)
+  80058d:	e8 56 00 00 00       	call   8005e8 <vcprintf>
+	cprintf("\n");
+  800592:	c7 04 24 ef 48 80 00 	movl   $0x8048ef,(%esp)
+  800599:	e8 9b 00 00 00       	call   800639 <cprintf>
+  80059e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005a1:	cc                   	int3
+	while (1)
+  8005a2:	eb fd                	jmp    8005a1 <_panic+0x43>
+
+008005a4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8005a4:	55                   	push   %ebp
+  8005a5:	89 e5                	mov    %esp,%ebp
+  8005a7:	53                   	push   %ebx
+  8005a8:	83 ec 04             	sub    $0x4,%esp
+  8005ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8005ae:	8b 13                	mov    (%ebx),%edx
+  8005b0:	8d 42 01             	lea    0x1(%edx),%eax
+  8005b3:	89 03                	mov    %eax,(%ebx)
+  8005b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005b8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8005bc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005c1:	74 09                	je     8005cc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8005c3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8005c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005ca:	c9                   	leave
+  8005cb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	68 ff 00 00 00       	push   $0xff
+  8005d4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005d7:	50                   	push   %eax
+  8005d8:	e8 cb 0a 00 00       	call   8010a8 <sys_cputs>
+		b->idx = 0;
+  8005dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005e3:	83 c4 10             	add    $0x10,%esp
+  8005e6:	eb db                	jmp    8005c3 <putch+0x1f>
+
+008005e8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005e8:	55                   	push   %ebp
+  8005e9:	89 e5                	mov    %esp,%ebp
+  8005eb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005f1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005f8:	00 00 00 
+	b.cnt = 0;
+  8005fb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800602:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800605:	ff 75 0c             	push   0xc(%ebp)
+  800608:	ff 75 08             	push   0x8(%ebp)
+  80060b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800611:	50                   	push   %eax
+  800612:	68 a4 05 80 00       	push   $0x8005a4
+  800617:	e8 1c 01 00 00       	call   800738 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80061c:	83 c4 08             	add    $0x8,%esp
+  80061f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800625:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80062b:	50                   	push   %eax
+  80062c:	e8 77 0a 00 00       	call   8010a8 <sys_cputs>
+
+	return b.cnt;
+}
+  800631:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800637:	c9                   	leave
+  800638:	c3                   	ret
+
+00800639 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800639:	55                   	push   %ebp
+  80063a:	89 e5                	mov    %esp,%ebp
+  80063c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80063f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800642:	50                   	push   %eax
+  800643:	ff 75 08             	push   0x8(%ebp)
+  800646:	e8 9d ff ff ff       	call   8005e8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80064b:	c9                   	leave
+  80064c:	c3                   	ret
+
+0080064d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80064d:	55                   	push   %ebp
+  80064e:	89 e5                	mov    %esp,%ebp
+  800650:	57                   	push   %edi
+  800651:	56                   	push   %esi
+  800652:	53                   	push   %ebx
+  800653:	83 ec 1c             	sub    $0x1c,%esp
+  800656:	89 c3                	mov    %eax,%ebx
+  800658:	89 d6                	mov    %edx,%esi
+  80065a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80065d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800660:	89 d1                	mov    %edx,%ecx
+  800662:	89 c2                	mov    %eax,%edx
+  800664:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800667:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80066a:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80066d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800670:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800677:	39 c2                	cmp    %eax,%edx
+  800679:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80067c:	73 4b                	jae    8006c9 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800684:	85 ff                	test   %edi,%edi
+  800686:	7e 11                	jle    800699 <printnum+0x4c>
+			putch(padc, putdat);
+  800688:	83 ec 08             	sub    $0x8,%esp
+  80068b:	56                   	push   %esi
+  80068c:	ff 75 18             	push   0x18(%ebp)
+  80068f:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800691:	83 c4 10             	add    $0x10,%esp
+  800694:	83 ef 01             	sub    $0x1,%edi
+  800697:	75 ef                	jne    800688 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800699:	83 ec 08             	sub    $0x8,%esp
+  80069c:	56                   	push   %esi
+  80069d:	83 ec 04             	sub    $0x4,%esp
+  8006a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8006a3:	ff 75 e0             	push   -0x20(%ebp)
+  8006a6:	ff 75 dc             	push   -0x24(%ebp)
+  8006a9:	ff 75 d8             	push   -0x28(%ebp)
+  8006ac:	e8 ef 40 00 00       	call   8047a0 <__umoddi3>
+  8006b1:	83 c4 14             	add    $0x14,%esp
+  8006b4:	0f be 80 cb 49 80 00 	movsbl 0x8049cb(%eax),%eax
+  8006bb:	50                   	push   %eax
+  8006bc:	ff d3                	call   *%ebx
+}
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c4:	5b                   	pop    %ebx
+  8006c5:	5e                   	pop    %esi
+  8006c6:	5f                   	pop    %edi
+  8006c7:	5d                   	pop    %ebp
+  8006c8:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006c9:	83 ec 0c             	sub    $0xc,%esp
+  8006cc:	ff 75 18             	push   0x18(%ebp)
+  8006cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006d2:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8006d5:	52                   	push   %edx
+  8006d6:	50                   	push   %eax
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	ff 75 e4             	push   -0x1c(%ebp)
+  8006dd:	ff 75 e0             	push   -0x20(%ebp)
+  8006e0:	ff 75 dc             	push   -0x24(%ebp)
+  8006e3:	ff 75 d8             	push   -0x28(%ebp)
+  8006e6:	e8 ef 3f 00 00       	call   8046da <__udivdi3>
+  8006eb:	83 c4 18             	add    $0x18,%esp
+  8006ee:	52                   	push   %edx
+  8006ef:	50                   	push   %eax
+  8006f0:	89 f2                	mov    %esi,%edx
+  8006f2:	89 d8                	mov    %ebx,%eax
+  8006f4:	e8 54 ff ff ff       	call   80064d <printnum>
+  8006f9:	83 c4 20             	add    $0x20,%esp
+  8006fc:	eb 9b                	jmp    800699 <printnum+0x4c>
+
+008006fe <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006fe:	55                   	push   %ebp
+  8006ff:	89 e5                	mov    %esp,%ebp
+  800701:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800704:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80070d:	73 0a                	jae    800719 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80070f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800712:	89 08                	mov    %ecx,(%eax)
+  800714:	8b 45 08             	mov    0x8(%ebp),%eax
+  800717:	88 02                	mov    %al,(%edx)
+}
+  800719:	5d                   	pop    %ebp
+  80071a:	c3                   	ret
+
+0080071b <printfmt>:
+{
+  80071b:	55                   	push   %ebp
+  80071c:	89 e5                	mov    %esp,%ebp
+  80071e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800721:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800724:	50                   	push   %eax
+  800725:	ff 75 10             	push   0x10(%ebp)
+  800728:	ff 75 0c             	push   0xc(%ebp)
+  80072b:	ff 75 08             	push   0x8(%ebp)
+  80072e:	e8 05 00 00 00       	call   800738 <vprintfmt>
+}
+  800733:	83 c4 10             	add    $0x10,%esp
+  800736:	c9                   	leave
+  800737:	c3                   	ret
+
+00800738 <vprintfmt>:
+{
+  800738:	55                   	push   %ebp
+  800739:	89 e5                	mov    %esp,%ebp
+  80073b:	57                   	push   %edi
+  80073c:	56                   	push   %esi
+  80073d:	53                   	push   %ebx
+  80073e:	83 ec 2c             	sub    $0x2c,%esp
+  800741:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800744:	89 df                	mov    %ebx,%edi
+  800746:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800749:	8b 45 10             	mov    0x10(%ebp),%eax
+  80074c:	8d 70 01             	lea    0x1(%eax),%esi
+  80074f:	0f b6 00             	movzbl (%eax),%eax
+  800752:	83 f8 25             	cmp    $0x25,%eax
+  800755:	74 1e                	je     800775 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800757:	85 c0                	test   %eax,%eax
+  800759:	0f 84 15 05 00 00    	je     800c74 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	53                   	push   %ebx
+  800763:	50                   	push   %eax
+  800764:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800766:	83 c6 01             	add    $0x1,%esi
+  800769:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80076d:	83 c4 10             	add    $0x10,%esp
+  800770:	83 f8 25             	cmp    $0x25,%eax
+  800773:	75 e2                	jne    800757 <vprintfmt+0x1f>
+		padc = ' ';
+  800775:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800779:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800780:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800787:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80078e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800793:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800796:	8d 56 01             	lea    0x1(%esi),%edx
+  800799:	0f b6 0e             	movzbl (%esi),%ecx
+  80079c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80079f:	3c 55                	cmp    $0x55,%al
+  8007a1:	0f 87 3b 04 00 00    	ja     800be2 <vprintfmt+0x4aa>
+  8007a7:	0f b6 c0             	movzbl %al,%eax
+  8007aa:	ff 24 85 40 4b 80 00 	jmp    *0x804b40(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007b1:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007b4:	eb 93                	jmp    800749 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007b6:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8007b8:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8007bc:	eb d8                	jmp    800796 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007be:	89 d6                	mov    %edx,%esi
+  8007c0:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8007c4:	eb d0                	jmp    800796 <vprintfmt+0x5e>
+  8007c6:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8007c9:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8007cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8007cf:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8007d3:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8007d6:	83 f9 09             	cmp    $0x9,%ecx
+  8007d9:	77 6f                	ja     80084a <vprintfmt+0x112>
+  8007db:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8007de:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8007e1:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8007e4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8007e8:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8007eb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8007ee:	83 fe 09             	cmp    $0x9,%esi
+  8007f1:	76 eb                	jbe    8007de <vprintfmt+0xa6>
+  8007f3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8007f6:	89 d6                	mov    %edx,%esi
+  8007f8:	eb 13                	jmp    80080d <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8007fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fd:	8b 00                	mov    (%eax),%eax
+  8007ff:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800802:	8b 45 14             	mov    0x14(%ebp),%eax
+  800805:	8d 40 04             	lea    0x4(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80080b:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80080d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800811:	79 83                	jns    800796 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800813:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800816:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800819:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800820:	e9 71 ff ff ff       	jmp    800796 <vprintfmt+0x5e>
+			if (width < 0)
+  800825:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800828:	85 c9                	test   %ecx,%ecx
+  80082a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082f:	0f 49 c1             	cmovns %ecx,%eax
+  800832:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800835:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800837:	e9 5a ff ff ff       	jmp    800796 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80083c:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80083e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800845:	e9 4c ff ff ff       	jmp    800796 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80084a:	89 d6                	mov    %edx,%esi
+  80084c:	eb bf                	jmp    80080d <vprintfmt+0xd5>
+			lflag++;
+  80084e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800852:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800854:	e9 3d ff ff ff       	jmp    800796 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800859:	89 55 10             	mov    %edx,0x10(%ebp)
+  80085c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085f:	8d 70 04             	lea    0x4(%eax),%esi
+  800862:	83 ec 08             	sub    $0x8,%esp
+  800865:	53                   	push   %ebx
+  800866:	ff 30                	push   (%eax)
+  800868:	ff d7                	call   *%edi
+			break;
+  80086a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80086d:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800870:	e9 d4 fe ff ff       	jmp    800749 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800875:	89 55 10             	mov    %edx,0x10(%ebp)
+  800878:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087b:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80087e:	8b 10                	mov    (%eax),%edx
+  800880:	89 d0                	mov    %edx,%eax
+  800882:	f7 d8                	neg    %eax
+  800884:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800887:	83 f8 12             	cmp    $0x12,%eax
+  80088a:	7f 23                	jg     8008af <vprintfmt+0x177>
+  80088c:	8b 14 85 a0 4c 80 00 	mov    0x804ca0(,%eax,4),%edx
+  800893:	85 d2                	test   %edx,%edx
+  800895:	74 18                	je     8008af <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800897:	52                   	push   %edx
+  800898:	68 f3 4e 80 00       	push   $0x804ef3
+  80089d:	53                   	push   %ebx
+  80089e:	57                   	push   %edi
+  80089f:	e8 77 fe ff ff       	call   80071b <printfmt>
+  8008a4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008a7:	89 75 14             	mov    %esi,0x14(%ebp)
+  8008aa:	e9 9a fe ff ff       	jmp    800749 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8008af:	50                   	push   %eax
+  8008b0:	68 e3 49 80 00       	push   $0x8049e3
+  8008b5:	53                   	push   %ebx
+  8008b6:	57                   	push   %edi
+  8008b7:	e8 5f fe ff ff       	call   80071b <printfmt>
+  8008bc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008bf:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8008c2:	e9 82 fe ff ff       	jmp    800749 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008c7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cd:	83 c0 04             	add    $0x4,%eax
+  8008d0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d6:	8b 00                	mov    (%eax),%eax
+  8008d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008db:	85 c0                	test   %eax,%eax
+  8008dd:	0f 84 61 03 00 00    	je     800c44 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8008e3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008e7:	7e 06                	jle    8008ef <vprintfmt+0x1b7>
+  8008e9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008ed:	75 29                	jne    800918 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ef:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008f2:	8d 70 01             	lea    0x1(%eax),%esi
+  8008f5:	0f b6 00             	movzbl (%eax),%eax
+  8008f8:	0f be d0             	movsbl %al,%edx
+  8008fb:	85 d2                	test   %edx,%edx
+  8008fd:	0f 84 bb 00 00 00    	je     8009be <vprintfmt+0x286>
+  800903:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800906:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800909:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80090c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80090f:	eb 7a                	jmp    80098b <vprintfmt+0x253>
+				p = "(null)";
+  800911:	c7 45 d0 dc 49 80 00 	movl   $0x8049dc,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800918:	83 ec 08             	sub    $0x8,%esp
+  80091b:	ff 75 d4             	push   -0x2c(%ebp)
+  80091e:	ff 75 d0             	push   -0x30(%ebp)
+  800921:	e8 e0 03 00 00       	call   800d06 <strnlen>
+  800926:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800929:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80092c:	83 c4 10             	add    $0x10,%esp
+  80092f:	85 d2                	test   %edx,%edx
+  800931:	0f 8e d6 02 00 00    	jle    800c0d <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800937:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80093b:	83 ec 08             	sub    $0x8,%esp
+  80093e:	53                   	push   %ebx
+  80093f:	56                   	push   %esi
+  800940:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800942:	83 c4 10             	add    $0x10,%esp
+  800945:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800949:	75 f0                	jne    80093b <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80094b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80094e:	8d 70 01             	lea    0x1(%eax),%esi
+  800951:	0f b6 00             	movzbl (%eax),%eax
+  800954:	0f be d0             	movsbl %al,%edx
+  800957:	85 d2                	test   %edx,%edx
+  800959:	0f 84 da 02 00 00    	je     800c39 <vprintfmt+0x501>
+  80095f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800962:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800965:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800968:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80096b:	eb 1e                	jmp    80098b <vprintfmt+0x253>
+					putch(ch, putdat);
+  80096d:	83 ec 08             	sub    $0x8,%esp
+  800970:	ff 75 0c             	push   0xc(%ebp)
+  800973:	52                   	push   %edx
+  800974:	ff 55 08             	call   *0x8(%ebp)
+  800977:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80097a:	83 eb 01             	sub    $0x1,%ebx
+  80097d:	83 c6 01             	add    $0x1,%esi
+  800980:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800984:	0f be d0             	movsbl %al,%edx
+  800987:	85 d2                	test   %edx,%edx
+  800989:	74 2a                	je     8009b5 <vprintfmt+0x27d>
+  80098b:	85 ff                	test   %edi,%edi
+  80098d:	78 05                	js     800994 <vprintfmt+0x25c>
+  80098f:	83 ef 01             	sub    $0x1,%edi
+  800992:	78 59                	js     8009ed <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800994:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800998:	74 d3                	je     80096d <vprintfmt+0x235>
+  80099a:	0f be c0             	movsbl %al,%eax
+  80099d:	83 e8 20             	sub    $0x20,%eax
+  8009a0:	83 f8 5e             	cmp    $0x5e,%eax
+  8009a3:	76 c8                	jbe    80096d <vprintfmt+0x235>
+					putch('?', putdat);
+  8009a5:	83 ec 08             	sub    $0x8,%esp
+  8009a8:	ff 75 0c             	push   0xc(%ebp)
+  8009ab:	6a 3f                	push   $0x3f
+  8009ad:	ff 55 08             	call   *0x8(%ebp)
+  8009b0:	83 c4 10             	add    $0x10,%esp
+  8009b3:	eb c5                	jmp    80097a <vprintfmt+0x242>
+  8009b5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8009be:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8009c1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009c5:	7e 1b                	jle    8009e2 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8009c7:	83 ec 08             	sub    $0x8,%esp
+  8009ca:	53                   	push   %ebx
+  8009cb:	6a 20                	push   $0x20
+  8009cd:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8009cf:	83 c4 10             	add    $0x10,%esp
+  8009d2:	83 ee 01             	sub    $0x1,%esi
+  8009d5:	75 f0                	jne    8009c7 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009d7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009dd:	e9 67 fd ff ff       	jmp    800749 <vprintfmt+0x11>
+  8009e2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009e8:	e9 5c fd ff ff       	jmp    800749 <vprintfmt+0x11>
+  8009ed:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009f6:	eb c6                	jmp    8009be <vprintfmt+0x286>
+	if (lflag >= 2)
+  8009f8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009fb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009fe:	83 f9 01             	cmp    $0x1,%ecx
+  800a01:	7f 1f                	jg     800a22 <vprintfmt+0x2ea>
+	else if (lflag)
+  800a03:	85 c9                	test   %ecx,%ecx
+  800a05:	74 67                	je     800a6e <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800a07:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0a:	8b 30                	mov    (%eax),%esi
+  800a0c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a0f:	89 f0                	mov    %esi,%eax
+  800a11:	c1 f8 1f             	sar    $0x1f,%eax
+  800a14:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a17:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a1d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a20:	eb 17                	jmp    800a39 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800a22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a25:	8b 50 04             	mov    0x4(%eax),%edx
+  800a28:	8b 00                	mov    (%eax),%eax
+  800a2a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a2d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a33:	8d 40 08             	lea    0x8(%eax),%eax
+  800a36:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a39:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a3c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800a3f:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800a44:	85 c9                	test   %ecx,%ecx
+  800a46:	0f 89 12 01 00 00    	jns    800b5e <vprintfmt+0x426>
+				putch('-', putdat);
+  800a4c:	83 ec 08             	sub    $0x8,%esp
+  800a4f:	53                   	push   %ebx
+  800a50:	6a 2d                	push   $0x2d
+  800a52:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a54:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a57:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a5a:	f7 da                	neg    %edx
+  800a5c:	83 d1 00             	adc    $0x0,%ecx
+  800a5f:	f7 d9                	neg    %ecx
+  800a61:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a64:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a69:	e9 f0 00 00 00       	jmp    800b5e <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800a6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a71:	8b 30                	mov    (%eax),%esi
+  800a73:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a76:	89 f0                	mov    %esi,%eax
+  800a78:	c1 f8 1f             	sar    $0x1f,%eax
+  800a7b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a81:	8d 40 04             	lea    0x4(%eax),%eax
+  800a84:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a87:	eb b0                	jmp    800a39 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800a89:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a8c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a8f:	83 f9 01             	cmp    $0x1,%ecx
+  800a92:	7f 1e                	jg     800ab2 <vprintfmt+0x37a>
+	else if (lflag)
+  800a94:	85 c9                	test   %ecx,%ecx
+  800a96:	74 32                	je     800aca <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800a98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9b:	8b 10                	mov    (%eax),%edx
+  800a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa2:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800aa8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800aad:	e9 ac 00 00 00       	jmp    800b5e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800ab2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab5:	8b 10                	mov    (%eax),%edx
+  800ab7:	8b 48 04             	mov    0x4(%eax),%ecx
+  800aba:	8d 40 08             	lea    0x8(%eax),%eax
+  800abd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ac0:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800ac5:	e9 94 00 00 00       	jmp    800b5e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800aca:	8b 45 14             	mov    0x14(%ebp),%eax
+  800acd:	8b 10                	mov    (%eax),%edx
+  800acf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad4:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ada:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800adf:	eb 7d                	jmp    800b5e <vprintfmt+0x426>
+	if (lflag >= 2)
+  800ae1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ae4:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ae7:	83 f9 01             	cmp    $0x1,%ecx
+  800aea:	7f 1b                	jg     800b07 <vprintfmt+0x3cf>
+	else if (lflag)
+  800aec:	85 c9                	test   %ecx,%ecx
+  800aee:	74 2c                	je     800b1c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800af0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af3:	8b 10                	mov    (%eax),%edx
+  800af5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afa:	8d 40 04             	lea    0x4(%eax),%eax
+  800afd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b00:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800b05:	eb 57                	jmp    800b5e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b07:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0a:	8b 10                	mov    (%eax),%edx
+  800b0c:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b0f:	8d 40 08             	lea    0x8(%eax),%eax
+  800b12:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b15:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800b1a:	eb 42                	jmp    800b5e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1f:	8b 10                	mov    (%eax),%edx
+  800b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b26:	8d 40 04             	lea    0x4(%eax),%eax
+  800b29:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b2c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800b31:	eb 2b                	jmp    800b5e <vprintfmt+0x426>
+			putch('0', putdat);
+  800b33:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b36:	83 ec 08             	sub    $0x8,%esp
+  800b39:	53                   	push   %ebx
+  800b3a:	6a 30                	push   $0x30
+  800b3c:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800b3e:	83 c4 08             	add    $0x8,%esp
+  800b41:	53                   	push   %ebx
+  800b42:	6a 78                	push   $0x78
+  800b44:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b49:	8b 10                	mov    (%eax),%edx
+  800b4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b50:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b53:	8d 40 04             	lea    0x4(%eax),%eax
+  800b56:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b59:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800b5e:	83 ec 0c             	sub    $0xc,%esp
+  800b61:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800b65:	50                   	push   %eax
+  800b66:	ff 75 e4             	push   -0x1c(%ebp)
+  800b69:	56                   	push   %esi
+  800b6a:	51                   	push   %ecx
+  800b6b:	52                   	push   %edx
+  800b6c:	89 da                	mov    %ebx,%edx
+  800b6e:	89 f8                	mov    %edi,%eax
+  800b70:	e8 d8 fa ff ff       	call   80064d <printnum>
+			break;
+  800b75:	83 c4 20             	add    $0x20,%esp
+  800b78:	e9 cc fb ff ff       	jmp    800749 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800b7d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b80:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b83:	83 f9 01             	cmp    $0x1,%ecx
+  800b86:	7f 1b                	jg     800ba3 <vprintfmt+0x46b>
+	else if (lflag)
+  800b88:	85 c9                	test   %ecx,%ecx
+  800b8a:	74 2c                	je     800bb8 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800b8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8f:	8b 10                	mov    (%eax),%edx
+  800b91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b96:	8d 40 04             	lea    0x4(%eax),%eax
+  800b99:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b9c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800ba1:	eb bb                	jmp    800b5e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800ba3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba6:	8b 10                	mov    (%eax),%edx
+  800ba8:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bab:	8d 40 08             	lea    0x8(%eax),%eax
+  800bae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bb1:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800bb6:	eb a6                	jmp    800b5e <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800bb8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bbb:	8b 10                	mov    (%eax),%edx
+  800bbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc2:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bc8:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800bcd:	eb 8f                	jmp    800b5e <vprintfmt+0x426>
+			putch(ch, putdat);
+  800bcf:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bd2:	83 ec 08             	sub    $0x8,%esp
+  800bd5:	53                   	push   %ebx
+  800bd6:	6a 25                	push   $0x25
+  800bd8:	ff d7                	call   *%edi
+			break;
+  800bda:	83 c4 10             	add    $0x10,%esp
+  800bdd:	e9 67 fb ff ff       	jmp    800749 <vprintfmt+0x11>
+			putch('%', putdat);
+  800be2:	83 ec 08             	sub    $0x8,%esp
+  800be5:	53                   	push   %ebx
+  800be6:	6a 25                	push   $0x25
+  800be8:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bea:	83 c4 10             	add    $0x10,%esp
+  800bed:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800bf1:	0f 84 ba fb ff ff    	je     8007b1 <vprintfmt+0x79>
+  800bf7:	89 75 10             	mov    %esi,0x10(%ebp)
+  800bfa:	89 f0                	mov    %esi,%eax
+  800bfc:	83 e8 01             	sub    $0x1,%eax
+  800bff:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c03:	75 f7                	jne    800bfc <vprintfmt+0x4c4>
+  800c05:	89 45 10             	mov    %eax,0x10(%ebp)
+  800c08:	e9 3c fb ff ff       	jmp    800749 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c0d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800c10:	8d 70 01             	lea    0x1(%eax),%esi
+  800c13:	0f b6 00             	movzbl (%eax),%eax
+  800c16:	0f be d0             	movsbl %al,%edx
+  800c19:	85 d2                	test   %edx,%edx
+  800c1b:	74 11                	je     800c2e <vprintfmt+0x4f6>
+  800c1d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c20:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c23:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c26:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c29:	e9 5d fd ff ff       	jmp    80098b <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c2e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c31:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c34:	e9 10 fb ff ff       	jmp    800749 <vprintfmt+0x11>
+  800c39:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c3c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c3f:	e9 05 fb ff ff       	jmp    800749 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800c44:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c48:	7e 0a                	jle    800c54 <vprintfmt+0x51c>
+  800c4a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800c4e:	0f 85 bd fc ff ff    	jne    800911 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c54:	ba 28 00 00 00       	mov    $0x28,%edx
+  800c59:	b8 28 00 00 00       	mov    $0x28,%eax
+  800c5e:	be dd 49 80 00       	mov    $0x8049dd,%esi
+  800c63:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c66:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c69:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c6c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c6f:	e9 17 fd ff ff       	jmp    80098b <vprintfmt+0x253>
+}
+  800c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c77:	5b                   	pop    %ebx
+  800c78:	5e                   	pop    %esi
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	83 ec 18             	sub    $0x18,%esp
+  800c82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c85:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c88:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c8b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c8f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c92:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c99:	85 c0                	test   %eax,%eax
+  800c9b:	74 26                	je     800cc3 <vsnprintf+0x47>
+  800c9d:	85 d2                	test   %edx,%edx
+  800c9f:	7e 22                	jle    800cc3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ca1:	ff 75 14             	push   0x14(%ebp)
+  800ca4:	ff 75 10             	push   0x10(%ebp)
+  800ca7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800caa:	50                   	push   %eax
+  800cab:	68 fe 06 80 00       	push   $0x8006fe
+  800cb0:	e8 83 fa ff ff       	call   800738 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800cb5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800cb8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800cbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cbe:	83 c4 10             	add    $0x10,%esp
+}
+  800cc1:	c9                   	leave
+  800cc2:	c3                   	ret
+		return -E_INVAL;
+  800cc3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc8:	eb f7                	jmp    800cc1 <vsnprintf+0x45>
+
+00800cca <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cd0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cd3:	50                   	push   %eax
+  800cd4:	ff 75 10             	push   0x10(%ebp)
+  800cd7:	ff 75 0c             	push   0xc(%ebp)
+  800cda:	ff 75 08             	push   0x8(%ebp)
+  800cdd:	e8 9a ff ff ff       	call   800c7c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ce2:	c9                   	leave
+  800ce3:	c3                   	ret
+
+00800ce4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800cea:	80 3a 00             	cmpb   $0x0,(%edx)
+  800ced:	74 10                	je     800cff <strlen+0x1b>
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800cf4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800cf7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cfb:	75 f7                	jne    800cf4 <strlen+0x10>
+	return n;
+}
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800cff:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800d04:	eb f7                	jmp    800cfd <strlen+0x19>
+
+00800d06 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d0f:	85 d2                	test   %edx,%edx
+  800d11:	74 16                	je     800d29 <strnlen+0x23>
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d1c:	74 09                	je     800d27 <strnlen+0x21>
+		n++;
+  800d1e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d21:	39 d0                	cmp    %edx,%eax
+  800d23:	75 f3                	jne    800d18 <strnlen+0x12>
+		n++;
+  800d25:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2e:	eb f7                	jmp    800d27 <strnlen+0x21>
+
+00800d30 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d30:	55                   	push   %ebp
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	53                   	push   %ebx
+  800d34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d43:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d46:	83 c0 01             	add    $0x1,%eax
+  800d49:	84 d2                	test   %dl,%dl
+  800d4b:	75 f2                	jne    800d3f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d4d:	89 c8                	mov    %ecx,%eax
+  800d4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d52:	c9                   	leave
+  800d53:	c3                   	ret
+
+00800d54 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	53                   	push   %ebx
+  800d58:	83 ec 10             	sub    $0x10,%esp
+  800d5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d5e:	53                   	push   %ebx
+  800d5f:	e8 80 ff ff ff       	call   800ce4 <strlen>
+  800d64:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d67:	ff 75 0c             	push   0xc(%ebp)
+  800d6a:	01 d8                	add    %ebx,%eax
+  800d6c:	50                   	push   %eax
+  800d6d:	e8 be ff ff ff       	call   800d30 <strcpy>
+	return dst;
+}
+  800d72:	89 d8                	mov    %ebx,%eax
+  800d74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d77:	c9                   	leave
+  800d78:	c3                   	ret
+
+00800d79 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d87:	85 db                	test   %ebx,%ebx
+  800d89:	74 17                	je     800da2 <strncpy+0x29>
+  800d8b:	01 f3                	add    %esi,%ebx
+  800d8d:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800d8f:	83 c0 01             	add    $0x1,%eax
+  800d92:	0f b6 0a             	movzbl (%edx),%ecx
+  800d95:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d98:	80 f9 01             	cmp    $0x1,%cl
+  800d9b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d9e:	39 c3                	cmp    %eax,%ebx
+  800da0:	75 ed                	jne    800d8f <strncpy+0x16>
+	}
+	return ret;
+}
+  800da2:	89 f0                	mov    %esi,%eax
+  800da4:	5b                   	pop    %ebx
+  800da5:	5e                   	pop    %esi
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+
+00800da8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+  800dad:	8b 75 08             	mov    0x8(%ebp),%esi
+  800db0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800db3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800db6:	89 f0                	mov    %esi,%eax
+  800db8:	85 db                	test   %ebx,%ebx
+  800dba:	74 1e                	je     800dda <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800dbc:	83 eb 01             	sub    $0x1,%ebx
+  800dbf:	74 16                	je     800dd7 <strlcpy+0x2f>
+  800dc1:	01 f3                	add    %esi,%ebx
+  800dc3:	0f b6 0a             	movzbl (%edx),%ecx
+  800dc6:	84 c9                	test   %cl,%cl
+  800dc8:	74 0d                	je     800dd7 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800dca:	83 c2 01             	add    $0x1,%edx
+  800dcd:	83 c0 01             	add    $0x1,%eax
+  800dd0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800dd3:	39 d8                	cmp    %ebx,%eax
+  800dd5:	75 ec                	jne    800dc3 <strlcpy+0x1b>
+		*dst = '\0';
+  800dd7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800dda:	29 f0                	sub    %esi,%eax
+}
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+
+00800de0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800de6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800de9:	0f b6 01             	movzbl (%ecx),%eax
+  800dec:	84 c0                	test   %al,%al
+  800dee:	74 11                	je     800e01 <strcmp+0x21>
+  800df0:	38 02                	cmp    %al,(%edx)
+  800df2:	75 0d                	jne    800e01 <strcmp+0x21>
+		p++, q++;
+  800df4:	83 c1 01             	add    $0x1,%ecx
+  800df7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800dfa:	0f b6 01             	movzbl (%ecx),%eax
+  800dfd:	84 c0                	test   %al,%al
+  800dff:	75 ef                	jne    800df0 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e01:	0f b6 c0             	movzbl %al,%eax
+  800e04:	0f b6 12             	movzbl (%edx),%edx
+  800e07:	29 d0                	sub    %edx,%eax
+}
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+
+00800e0b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	53                   	push   %ebx
+  800e0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e15:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800e18:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800e1d:	85 d2                	test   %edx,%edx
+  800e1f:	74 2e                	je     800e4f <strncmp+0x44>
+  800e21:	0f b6 01             	movzbl (%ecx),%eax
+  800e24:	84 c0                	test   %al,%al
+  800e26:	74 16                	je     800e3e <strncmp+0x33>
+  800e28:	3a 03                	cmp    (%ebx),%al
+  800e2a:	75 12                	jne    800e3e <strncmp+0x33>
+		n--, p++, q++;
+  800e2c:	83 c1 01             	add    $0x1,%ecx
+  800e2f:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800e32:	83 ea 01             	sub    $0x1,%edx
+  800e35:	75 ea                	jne    800e21 <strncmp+0x16>
+		return 0;
+  800e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3c:	eb 11                	jmp    800e4f <strncmp+0x44>
+  800e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800e43:	85 d2                	test   %edx,%edx
+  800e45:	74 08                	je     800e4f <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e47:	0f b6 01             	movzbl (%ecx),%eax
+  800e4a:	0f b6 13             	movzbl (%ebx),%edx
+  800e4d:	29 d0                	sub    %edx,%eax
+}
+  800e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e52:	c9                   	leave
+  800e53:	c3                   	ret
+
+00800e54 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e5a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e5e:	0f b6 10             	movzbl (%eax),%edx
+  800e61:	84 d2                	test   %dl,%dl
+  800e63:	74 15                	je     800e7a <strchr+0x26>
+		if (*s == c)
+  800e65:	38 d1                	cmp    %dl,%cl
+  800e67:	74 0f                	je     800e78 <strchr+0x24>
+	for (; *s; s++)
+  800e69:	83 c0 01             	add    $0x1,%eax
+  800e6c:	0f b6 10             	movzbl (%eax),%edx
+  800e6f:	84 d2                	test   %dl,%dl
+  800e71:	75 f2                	jne    800e65 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800e73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e78:	5d                   	pop    %ebp
+  800e79:	c3                   	ret
+	return 0;
+  800e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7f:	eb f7                	jmp    800e78 <strchr+0x24>
+
+00800e81 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	53                   	push   %ebx
+  800e85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e88:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800e8b:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800e8e:	38 d3                	cmp    %dl,%bl
+  800e90:	74 14                	je     800ea6 <strfind+0x25>
+  800e92:	89 d1                	mov    %edx,%ecx
+  800e94:	84 db                	test   %bl,%bl
+  800e96:	74 0e                	je     800ea6 <strfind+0x25>
+	for (; *s; s++)
+  800e98:	83 c0 01             	add    $0x1,%eax
+  800e9b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e9e:	38 ca                	cmp    %cl,%dl
+  800ea0:	74 04                	je     800ea6 <strfind+0x25>
+  800ea2:	84 d2                	test   %dl,%dl
+  800ea4:	75 f2                	jne    800e98 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800ea6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ea9:	c9                   	leave
+  800eaa:	c3                   	ret
+
+00800eab <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800eb2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800eb5:	85 c9                	test   %ecx,%ecx
+  800eb7:	74 20                	je     800ed9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800eb9:	89 f8                	mov    %edi,%eax
+  800ebb:	09 c8                	or     %ecx,%eax
+  800ebd:	a8 03                	test   $0x3,%al
+  800ebf:	75 12                	jne    800ed3 <memset+0x28>
+		c &= 0xFF;
+  800ec1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ec5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ecb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ece:	fc                   	cld
+  800ecf:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ed1:	eb 06                	jmp    800ed9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ed3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ed6:	fc                   	cld
+  800ed7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ed9:	89 f8                	mov    %edi,%eax
+  800edb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ede:	c9                   	leave
+  800edf:	c3                   	ret
+
+00800ee0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ee0:	55                   	push   %ebp
+  800ee1:	89 e5                	mov    %esp,%ebp
+  800ee3:	57                   	push   %edi
+  800ee4:	56                   	push   %esi
+  800ee5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800eeb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800eee:	39 c6                	cmp    %eax,%esi
+  800ef0:	73 32                	jae    800f24 <memmove+0x44>
+  800ef2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ef5:	39 d0                	cmp    %edx,%eax
+  800ef7:	73 2b                	jae    800f24 <memmove+0x44>
+		s += n;
+		d += n;
+  800ef9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800efc:	89 d6                	mov    %edx,%esi
+  800efe:	09 fe                	or     %edi,%esi
+  800f00:	09 ce                	or     %ecx,%esi
+  800f02:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f08:	75 0e                	jne    800f18 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f0a:	83 ef 04             	sub    $0x4,%edi
+  800f0d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f10:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f13:	fd                   	std
+  800f14:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f16:	eb 09                	jmp    800f21 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f18:	83 ef 01             	sub    $0x1,%edi
+  800f1b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f1e:	fd                   	std
+  800f1f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f21:	fc                   	cld
+  800f22:	eb 1a                	jmp    800f3e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f24:	89 f2                	mov    %esi,%edx
+  800f26:	09 c2                	or     %eax,%edx
+  800f28:	09 ca                	or     %ecx,%edx
+  800f2a:	f6 c2 03             	test   $0x3,%dl
+  800f2d:	75 0a                	jne    800f39 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f2f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f32:	89 c7                	mov    %eax,%edi
+  800f34:	fc                   	cld
+  800f35:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f37:	eb 05                	jmp    800f3e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f39:	89 c7                	mov    %eax,%edi
+  800f3b:	fc                   	cld
+  800f3c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f3e:	5e                   	pop    %esi
+  800f3f:	5f                   	pop    %edi
+  800f40:	5d                   	pop    %ebp
+  800f41:	c3                   	ret
+
+00800f42 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f48:	ff 75 10             	push   0x10(%ebp)
+  800f4b:	ff 75 0c             	push   0xc(%ebp)
+  800f4e:	ff 75 08             	push   0x8(%ebp)
+  800f51:	e8 8a ff ff ff       	call   800ee0 <memmove>
+}
+  800f56:	c9                   	leave
+  800f57:	c3                   	ret
+
+00800f58 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	56                   	push   %esi
+  800f5c:	53                   	push   %ebx
+  800f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f63:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f66:	85 f6                	test   %esi,%esi
+  800f68:	74 29                	je     800f93 <memcmp+0x3b>
+  800f6a:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800f6c:	0f b6 08             	movzbl (%eax),%ecx
+  800f6f:	0f b6 1a             	movzbl (%edx),%ebx
+  800f72:	38 d9                	cmp    %bl,%cl
+  800f74:	75 11                	jne    800f87 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f76:	83 c0 01             	add    $0x1,%eax
+  800f79:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f7c:	39 c6                	cmp    %eax,%esi
+  800f7e:	75 ec                	jne    800f6c <memcmp+0x14>
+	}
+
+	return 0;
+  800f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f85:	eb 08                	jmp    800f8f <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800f87:	0f b6 c1             	movzbl %cl,%eax
+  800f8a:	0f b6 db             	movzbl %bl,%ebx
+  800f8d:	29 d8                	sub    %ebx,%eax
+}
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+	return 0;
+  800f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f98:	eb f5                	jmp    800f8f <memcmp+0x37>
+
+00800f9a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f9a:	55                   	push   %ebp
+  800f9b:	89 e5                	mov    %esp,%ebp
+  800f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800fa3:	89 c2                	mov    %eax,%edx
+  800fa5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800fa8:	39 d0                	cmp    %edx,%eax
+  800faa:	73 0d                	jae    800fb9 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800fac:	38 08                	cmp    %cl,(%eax)
+  800fae:	74 0d                	je     800fbd <memfind+0x23>
+	for (; s < ends; s++)
+  800fb0:	83 c0 01             	add    $0x1,%eax
+  800fb3:	39 c2                	cmp    %eax,%edx
+  800fb5:	75 f5                	jne    800fac <memfind+0x12>
+  800fb7:	eb 06                	jmp    800fbf <memfind+0x25>
+  800fb9:	89 c2                	mov    %eax,%edx
+  800fbb:	eb 02                	jmp    800fbf <memfind+0x25>
+  800fbd:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800fbf:	89 d0                	mov    %edx,%eax
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+
+00800fc3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+  800fc6:	57                   	push   %edi
+  800fc7:	56                   	push   %esi
+  800fc8:	53                   	push   %ebx
+  800fc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800fcf:	0f b6 02             	movzbl (%edx),%eax
+  800fd2:	3c 20                	cmp    $0x20,%al
+  800fd4:	74 04                	je     800fda <strtol+0x17>
+  800fd6:	3c 09                	cmp    $0x9,%al
+  800fd8:	75 0e                	jne    800fe8 <strtol+0x25>
+		s++;
+  800fda:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fdd:	0f b6 02             	movzbl (%edx),%eax
+  800fe0:	3c 20                	cmp    $0x20,%al
+  800fe2:	74 f6                	je     800fda <strtol+0x17>
+  800fe4:	3c 09                	cmp    $0x9,%al
+  800fe6:	74 f2                	je     800fda <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fe8:	3c 2b                	cmp    $0x2b,%al
+  800fea:	74 2a                	je     801016 <strtol+0x53>
+	int neg = 0;
+  800fec:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ff1:	3c 2d                	cmp    $0x2d,%al
+  800ff3:	74 2b                	je     801020 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ff5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ffb:	75 0f                	jne    80100c <strtol+0x49>
+  800ffd:	80 3a 30             	cmpb   $0x30,(%edx)
+  801000:	74 28                	je     80102a <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801002:	85 db                	test   %ebx,%ebx
+  801004:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801009:	0f 44 d8             	cmove  %eax,%ebx
+  80100c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801011:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801014:	eb 46                	jmp    80105c <strtol+0x99>
+		s++;
+  801016:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801019:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101e:	eb d5                	jmp    800ff5 <strtol+0x32>
+		s++, neg = 1;
+  801020:	83 c2 01             	add    $0x1,%edx
+  801023:	bf 01 00 00 00       	mov    $0x1,%edi
+  801028:	eb cb                	jmp    800ff5 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80102a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80102e:	74 0e                	je     80103e <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  801030:	85 db                	test   %ebx,%ebx
+  801032:	75 d8                	jne    80100c <strtol+0x49>
+		s++, base = 8;
+  801034:	83 c2 01             	add    $0x1,%edx
+  801037:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80103c:	eb ce                	jmp    80100c <strtol+0x49>
+		s += 2, base = 16;
+  80103e:	83 c2 02             	add    $0x2,%edx
+  801041:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801046:	eb c4                	jmp    80100c <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801048:	0f be c0             	movsbl %al,%eax
+  80104b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80104e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801051:	7d 3a                	jge    80108d <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  801053:	83 c2 01             	add    $0x1,%edx
+  801056:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80105a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80105c:	0f b6 02             	movzbl (%edx),%eax
+  80105f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801062:	89 f3                	mov    %esi,%ebx
+  801064:	80 fb 09             	cmp    $0x9,%bl
+  801067:	76 df                	jbe    801048 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  801069:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80106c:	89 f3                	mov    %esi,%ebx
+  80106e:	80 fb 19             	cmp    $0x19,%bl
+  801071:	77 08                	ja     80107b <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  801073:	0f be c0             	movsbl %al,%eax
+  801076:	83 e8 57             	sub    $0x57,%eax
+  801079:	eb d3                	jmp    80104e <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80107b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80107e:	89 f3                	mov    %esi,%ebx
+  801080:	80 fb 19             	cmp    $0x19,%bl
+  801083:	77 08                	ja     80108d <strtol+0xca>
+			dig = *s - 'A' + 10;
+  801085:	0f be c0             	movsbl %al,%eax
+  801088:	83 e8 37             	sub    $0x37,%eax
+  80108b:	eb c1                	jmp    80104e <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80108d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801091:	74 05                	je     801098 <strtol+0xd5>
+		*endptr = (char *) s;
+  801093:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801096:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801098:	89 c8                	mov    %ecx,%eax
+  80109a:	f7 d8                	neg    %eax
+  80109c:	85 ff                	test   %edi,%edi
+  80109e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8010a1:	89 c8                	mov    %ecx,%eax
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5e                   	pop    %esi
+  8010a5:	5f                   	pop    %edi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	c3                   	ret
+
+008010a8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8010a8:	55                   	push   %ebp
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	57                   	push   %edi
+  8010ac:	56                   	push   %esi
+  8010ad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b9:	89 c3                	mov    %eax,%ebx
+  8010bb:	89 c7                	mov    %eax,%edi
+  8010bd:	89 c6                	mov    %eax,%esi
+  8010bf:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010d6:	89 d1                	mov    %edx,%ecx
+  8010d8:	89 d3                	mov    %edx,%ebx
+  8010da:	89 d7                	mov    %edx,%edi
+  8010dc:	89 d6                	mov    %edx,%esi
+  8010de:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+
+008010e5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	56                   	push   %esi
+  8010ea:	53                   	push   %ebx
+  8010eb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010fb:	89 cb                	mov    %ecx,%ebx
+  8010fd:	89 cf                	mov    %ecx,%edi
+  8010ff:	89 ce                	mov    %ecx,%esi
+  801101:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801103:	85 c0                	test   %eax,%eax
+  801105:	7f 08                	jg     80110f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110a:	5b                   	pop    %ebx
+  80110b:	5e                   	pop    %esi
+  80110c:	5f                   	pop    %edi
+  80110d:	5d                   	pop    %ebp
+  80110e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+  801112:	50                   	push   %eax
+  801113:	6a 03                	push   $0x3
+  801115:	68 0b 4d 80 00       	push   $0x804d0b
+  80111a:	6a 23                	push   $0x23
+  80111c:	68 28 4d 80 00       	push   $0x804d28
+  801121:	e8 38 f4 ff ff       	call   80055e <_panic>
+
+00801126 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801131:	b8 02 00 00 00       	mov    $0x2,%eax
+  801136:	89 d1                	mov    %edx,%ecx
+  801138:	89 d3                	mov    %edx,%ebx
+  80113a:	89 d7                	mov    %edx,%edi
+  80113c:	89 d6                	mov    %edx,%esi
+  80113e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+
+00801145 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801150:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801155:	89 d1                	mov    %edx,%ecx
+  801157:	89 d3                	mov    %edx,%ebx
+  801159:	89 d7                	mov    %edx,%edi
+  80115b:	89 d6                	mov    %edx,%esi
+  80115d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+
+00801164 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80116d:	be 00 00 00 00       	mov    $0x0,%esi
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 04 00 00 00       	mov    $0x4,%eax
+  80117d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801180:	89 f7                	mov    %esi,%edi
+  801182:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801184:	85 c0                	test   %eax,%eax
+  801186:	7f 08                	jg     801190 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118b:	5b                   	pop    %ebx
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801190:	83 ec 0c             	sub    $0xc,%esp
+  801193:	50                   	push   %eax
+  801194:	6a 04                	push   $0x4
+  801196:	68 0b 4d 80 00       	push   $0x804d0b
+  80119b:	6a 23                	push   $0x23
+  80119d:	68 28 4d 80 00       	push   $0x804d28
+  8011a2:	e8 b7 f3 ff ff       	call   80055e <_panic>
+
+008011a7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	57                   	push   %edi
+  8011ab:	56                   	push   %esi
+  8011ac:	53                   	push   %ebx
+  8011ad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011be:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011c4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c6:	85 c0                	test   %eax,%eax
+  8011c8:	7f 08                	jg     8011d2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8011ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cd:	5b                   	pop    %ebx
+  8011ce:	5e                   	pop    %esi
+  8011cf:	5f                   	pop    %edi
+  8011d0:	5d                   	pop    %ebp
+  8011d1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d2:	83 ec 0c             	sub    $0xc,%esp
+  8011d5:	50                   	push   %eax
+  8011d6:	6a 05                	push   $0x5
+  8011d8:	68 0b 4d 80 00       	push   $0x804d0b
+  8011dd:	6a 23                	push   $0x23
+  8011df:	68 28 4d 80 00       	push   $0x804d28
+  8011e4:	e8 75 f3 ff ff       	call   80055e <_panic>
+
+008011e9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801202:	89 df                	mov    %ebx,%edi
+  801204:	89 de                	mov    %ebx,%esi
+  801206:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801208:	85 c0                	test   %eax,%eax
+  80120a:	7f 08                	jg     801214 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80120c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120f:	5b                   	pop    %ebx
+  801210:	5e                   	pop    %esi
+  801211:	5f                   	pop    %edi
+  801212:	5d                   	pop    %ebp
+  801213:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801214:	83 ec 0c             	sub    $0xc,%esp
+  801217:	50                   	push   %eax
+  801218:	6a 06                	push   $0x6
+  80121a:	68 0b 4d 80 00       	push   $0x804d0b
+  80121f:	6a 23                	push   $0x23
+  801221:	68 28 4d 80 00       	push   $0x804d28
+  801226:	e8 33 f3 ff ff       	call   80055e <_panic>
+
+0080122b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	57                   	push   %edi
+  80122f:	56                   	push   %esi
+  801230:	53                   	push   %ebx
+  801231:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801244:	89 df                	mov    %ebx,%edi
+  801246:	89 de                	mov    %ebx,%esi
+  801248:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80124a:	85 c0                	test   %eax,%eax
+  80124c:	7f 08                	jg     801256 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80124e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801251:	5b                   	pop    %ebx
+  801252:	5e                   	pop    %esi
+  801253:	5f                   	pop    %edi
+  801254:	5d                   	pop    %ebp
+  801255:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801256:	83 ec 0c             	sub    $0xc,%esp
+  801259:	50                   	push   %eax
+  80125a:	6a 08                	push   $0x8
+  80125c:	68 0b 4d 80 00       	push   $0x804d0b
+  801261:	6a 23                	push   $0x23
+  801263:	68 28 4d 80 00       	push   $0x804d28
+  801268:	e8 f1 f2 ff ff       	call   80055e <_panic>
+
+0080126d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+  801273:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801276:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801281:	b8 09 00 00 00       	mov    $0x9,%eax
+  801286:	89 df                	mov    %ebx,%edi
+  801288:	89 de                	mov    %ebx,%esi
+  80128a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80128c:	85 c0                	test   %eax,%eax
+  80128e:	7f 08                	jg     801298 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801293:	5b                   	pop    %ebx
+  801294:	5e                   	pop    %esi
+  801295:	5f                   	pop    %edi
+  801296:	5d                   	pop    %ebp
+  801297:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801298:	83 ec 0c             	sub    $0xc,%esp
+  80129b:	50                   	push   %eax
+  80129c:	6a 09                	push   $0x9
+  80129e:	68 0b 4d 80 00       	push   $0x804d0b
+  8012a3:	6a 23                	push   $0x23
+  8012a5:	68 28 4d 80 00       	push   $0x804d28
+  8012aa:	e8 af f2 ff ff       	call   80055e <_panic>
+
+008012af <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	57                   	push   %edi
+  8012b3:	56                   	push   %esi
+  8012b4:	53                   	push   %ebx
+  8012b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012c8:	89 df                	mov    %ebx,%edi
+  8012ca:	89 de                	mov    %ebx,%esi
+  8012cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ce:	85 c0                	test   %eax,%eax
+  8012d0:	7f 08                	jg     8012da <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d5:	5b                   	pop    %ebx
+  8012d6:	5e                   	pop    %esi
+  8012d7:	5f                   	pop    %edi
+  8012d8:	5d                   	pop    %ebp
+  8012d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012da:	83 ec 0c             	sub    $0xc,%esp
+  8012dd:	50                   	push   %eax
+  8012de:	6a 0a                	push   $0xa
+  8012e0:	68 0b 4d 80 00       	push   $0x804d0b
+  8012e5:	6a 23                	push   $0x23
+  8012e7:	68 28 4d 80 00       	push   $0x804d28
+  8012ec:	e8 6d f2 ff ff       	call   80055e <_panic>
+
+008012f1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012f1:	55                   	push   %ebp
+  8012f2:	89 e5                	mov    %esp,%ebp
+  8012f4:	57                   	push   %edi
+  8012f5:	56                   	push   %esi
+  8012f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801302:	be 00 00 00 00       	mov    $0x0,%esi
+  801307:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80130f:	5b                   	pop    %ebx
+  801310:	5e                   	pop    %esi
+  801311:	5f                   	pop    %edi
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+
+00801314 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	57                   	push   %edi
+  801318:	56                   	push   %esi
+  801319:	53                   	push   %ebx
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80131d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+  801325:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80132a:	89 cb                	mov    %ecx,%ebx
+  80132c:	89 cf                	mov    %ecx,%edi
+  80132e:	89 ce                	mov    %ecx,%esi
+  801330:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801332:	85 c0                	test   %eax,%eax
+  801334:	7f 08                	jg     80133e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801336:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801339:	5b                   	pop    %ebx
+  80133a:	5e                   	pop    %esi
+  80133b:	5f                   	pop    %edi
+  80133c:	5d                   	pop    %ebp
+  80133d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80133e:	83 ec 0c             	sub    $0xc,%esp
+  801341:	50                   	push   %eax
+  801342:	6a 0d                	push   $0xd
+  801344:	68 0b 4d 80 00       	push   $0x804d0b
+  801349:	6a 23                	push   $0x23
+  80134b:	68 28 4d 80 00       	push   $0x804d28
+  801350:	e8 09 f2 ff ff       	call   80055e <_panic>
+
+00801355 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801355:	55                   	push   %ebp
+  801356:	89 e5                	mov    %esp,%ebp
+  801358:	57                   	push   %edi
+  801359:	56                   	push   %esi
+  80135a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80135b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801361:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801366:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801369:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80136c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80136f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801371:	5b                   	pop    %ebx
+  801372:	5e                   	pop    %esi
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+
+00801376 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	57                   	push   %edi
+  80137a:	56                   	push   %esi
+  80137b:	53                   	push   %ebx
+  80137c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80137f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801384:	8b 55 08             	mov    0x8(%ebp),%edx
+  801387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80138f:	89 df                	mov    %ebx,%edi
+  801391:	89 de                	mov    %ebx,%esi
+  801393:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801395:	85 c0                	test   %eax,%eax
+  801397:	7f 08                	jg     8013a1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801399:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139c:	5b                   	pop    %ebx
+  80139d:	5e                   	pop    %esi
+  80139e:	5f                   	pop    %edi
+  80139f:	5d                   	pop    %ebp
+  8013a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013a1:	83 ec 0c             	sub    $0xc,%esp
+  8013a4:	50                   	push   %eax
+  8013a5:	6a 0d                	push   $0xd
+  8013a7:	68 0b 4d 80 00       	push   $0x804d0b
+  8013ac:	6a 23                	push   $0x23
+  8013ae:	68 28 4d 80 00       	push   $0x804d28
+  8013b3:	e8 a6 f1 ff ff       	call   80055e <_panic>
+
+008013b8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8013b8:	55                   	push   %ebp
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	57                   	push   %edi
+  8013bc:	56                   	push   %esi
+  8013bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013c8:	89 d1                	mov    %edx,%ecx
+  8013ca:	89 d3                	mov    %edx,%ebx
+  8013cc:	89 d7                	mov    %edx,%edi
+  8013ce:	89 d6                	mov    %edx,%esi
+  8013d0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+
+008013d7 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	57                   	push   %edi
+  8013db:	56                   	push   %esi
+  8013dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013ed:	89 df                	mov    %ebx,%edi
+  8013ef:	89 de                	mov    %ebx,%esi
+  8013f1:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8013f3:	5b                   	pop    %ebx
+  8013f4:	5e                   	pop    %esi
+  8013f5:	5f                   	pop    %edi
+  8013f6:	5d                   	pop    %ebp
+  8013f7:	c3                   	ret
+
+008013f8 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	57                   	push   %edi
+  8013fc:	56                   	push   %esi
+  8013fd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801403:	8b 55 08             	mov    0x8(%ebp),%edx
+  801406:	b8 10 00 00 00       	mov    $0x10,%eax
+  80140b:	89 cb                	mov    %ecx,%ebx
+  80140d:	89 cf                	mov    %ecx,%edi
+  80140f:	89 ce                	mov    %ecx,%esi
+  801411:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801413:	5b                   	pop    %ebx
+  801414:	5e                   	pop    %esi
+  801415:	5f                   	pop    %edi
+  801416:	5d                   	pop    %ebp
+  801417:	c3                   	ret
+
+00801418 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	57                   	push   %edi
+  80141c:	56                   	push   %esi
+  80141d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80141e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801423:	8b 55 08             	mov    0x8(%ebp),%edx
+  801426:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801429:	b8 11 00 00 00       	mov    $0x11,%eax
+  80142e:	89 df                	mov    %ebx,%edi
+  801430:	89 de                	mov    %ebx,%esi
+  801432:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5f                   	pop    %edi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+
+00801439 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	57                   	push   %edi
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80143f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801444:	8b 55 08             	mov    0x8(%ebp),%edx
+  801447:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80144f:	89 df                	mov    %ebx,%edi
+  801451:	89 de                	mov    %ebx,%esi
+  801453:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801455:	5b                   	pop    %ebx
+  801456:	5e                   	pop    %esi
+  801457:	5f                   	pop    %edi
+  801458:	5d                   	pop    %ebp
+  801459:	c3                   	ret
+
+0080145a <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	57                   	push   %edi
+  80145e:	56                   	push   %esi
+  80145f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801465:	8b 55 08             	mov    0x8(%ebp),%edx
+  801468:	b8 13 00 00 00       	mov    $0x13,%eax
+  80146d:	89 cb                	mov    %ecx,%ebx
+  80146f:	89 cf                	mov    %ecx,%edi
+  801471:	89 ce                	mov    %ecx,%esi
+  801473:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801475:	5b                   	pop    %ebx
+  801476:	5e                   	pop    %esi
+  801477:	5f                   	pop    %edi
+  801478:	5d                   	pop    %ebp
+  801479:	c3                   	ret
+
+0080147a <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	56                   	push   %esi
+  80147f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801480:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801485:	8b 55 08             	mov    0x8(%ebp),%edx
+  801488:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801490:	89 df                	mov    %ebx,%edi
+  801492:	89 de                	mov    %ebx,%esi
+  801494:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801496:	5b                   	pop    %ebx
+  801497:	5e                   	pop    %esi
+  801498:	5f                   	pop    %edi
+  801499:	5d                   	pop    %ebp
+  80149a:	c3                   	ret
+
+0080149b <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	57                   	push   %edi
+  80149f:	56                   	push   %esi
+  8014a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8014ae:	89 cb                	mov    %ecx,%ebx
+  8014b0:	89 cf                	mov    %ecx,%edi
+  8014b2:	89 ce                	mov    %ecx,%esi
+  8014b4:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8014b6:	5b                   	pop    %ebx
+  8014b7:	5e                   	pop    %esi
+  8014b8:	5f                   	pop    %edi
+  8014b9:	5d                   	pop    %ebp
+  8014ba:	c3                   	ret
+
+008014bb <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8014bb:	55                   	push   %ebp
+  8014bc:	89 e5                	mov    %esp,%ebp
+  8014be:	57                   	push   %edi
+  8014bf:	56                   	push   %esi
+  8014c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cc:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d4:	89 f7                	mov    %esi,%edi
+  8014d6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5f                   	pop    %edi
+  8014db:	5d                   	pop    %ebp
+  8014dc:	c3                   	ret
+
+008014dd <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	57                   	push   %edi
+  8014e1:	56                   	push   %esi
+  8014e2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ee:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014f3:	89 df                	mov    %ebx,%edi
+  8014f5:	89 de                	mov    %ebx,%esi
+  8014f7:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8014f9:	5b                   	pop    %ebx
+  8014fa:	5e                   	pop    %esi
+  8014fb:	5f                   	pop    %edi
+  8014fc:	5d                   	pop    %ebp
+  8014fd:	c3                   	ret
+
+008014fe <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	57                   	push   %edi
+  801502:	56                   	push   %esi
+  801503:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801504:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801509:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801511:	89 cb                	mov    %ecx,%ebx
+  801513:	89 cf                	mov    %ecx,%edi
+  801515:	89 ce                	mov    %ecx,%esi
+  801517:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801519:	5b                   	pop    %ebx
+  80151a:	5e                   	pop    %esi
+  80151b:	5f                   	pop    %edi
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+
+0080151e <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	57                   	push   %edi
+  801522:	56                   	push   %esi
+  801523:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801524:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801528:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801530:	b8 19 00 00 00       	mov    $0x19,%eax
+  801535:	89 df                	mov    %ebx,%edi
+  801537:	89 de                	mov    %ebx,%esi
+  801539:	cd 30                	int    $0x30
+}
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5f                   	pop    %edi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+
+00801540 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801546:	be 00 00 00 00       	mov    $0x0,%esi
+  80154b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801551:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801556:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801559:	89 f7                	mov    %esi,%edi
+  80155b:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80155d:	5b                   	pop    %ebx
+  80155e:	5e                   	pop    %esi
+  80155f:	5f                   	pop    %edi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+
+00801562 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	57                   	push   %edi
+  801566:	56                   	push   %esi
+  801567:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801568:	be 00 00 00 00       	mov    $0x0,%esi
+  80156d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801570:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801573:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801578:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157b:	89 f7                	mov    %esi,%edi
+  80157d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80157f:	5b                   	pop    %ebx
+  801580:	5e                   	pop    %esi
+  801581:	5f                   	pop    %edi
+  801582:	5d                   	pop    %ebp
+  801583:	c3                   	ret
+
+00801584 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	57                   	push   %edi
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80158a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801595:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80159a:	89 df                	mov    %ebx,%edi
+  80159c:	89 de                	mov    %ebx,%esi
+  80159e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8015a0:	5b                   	pop    %ebx
+  8015a1:	5e                   	pop    %esi
+  8015a2:	5f                   	pop    %edi
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+
+008015a5 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015be:	89 f7                	mov    %esi,%edi
+  8015c0:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5f                   	pop    %edi
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+
+008015c7 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	74 20                	je     8015eb <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8015cb:	89 c1                	mov    %eax,%ecx
+  8015cd:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015d3:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8015d9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8015df:	8b 52 48             	mov    0x48(%edx),%edx
+  8015e2:	39 c2                	cmp    %eax,%edx
+  8015e4:	74 06                	je     8015ec <thread_alive+0x25>
+  8015e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015eb:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015ec:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8015f2:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	0f 95 c0             	setne  %al
+  8015fd:	0f b6 c0             	movzbl %al,%eax
+  801600:	c3                   	ret
+
+00801601 <pgfault>:
+{
+  801601:	55                   	push   %ebp
+  801602:	89 e5                	mov    %esp,%ebp
+  801604:	57                   	push   %edi
+  801605:	56                   	push   %esi
+  801606:	53                   	push   %ebx
+  801607:	83 ec 0c             	sub    $0xc,%esp
+  80160a:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80160d:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  80160f:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801612:	89 f3                	mov    %esi,%ebx
+  801614:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801617:	83 3d 80 8a 84 00 00 	cmpl   $0x0,0x848a80
+  80161e:	74 52                	je     801672 <pgfault+0x71>
+  801620:	a8 02                	test   $0x2,%al
+  801622:	75 14                	jne    801638 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801624:	83 ec 04             	sub    $0x4,%esp
+  801627:	68 36 4d 80 00       	push   $0x804d36
+  80162c:	6a 2e                	push   $0x2e
+  80162e:	68 54 4d 80 00       	push   $0x804d54
+  801633:	e8 26 ef ff ff       	call   80055e <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801638:	89 d8                	mov    %ebx,%eax
+  80163a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80163f:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801646:	83 ec 0c             	sub    $0xc,%esp
+  801649:	57                   	push   %edi
+  80164a:	e8 65 29 00 00       	call   803fb4 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80164f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801656:	83 e0 03             	and    $0x3,%eax
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	83 f8 03             	cmp    $0x3,%eax
+  80165f:	75 1a                	jne    80167b <pgfault+0x7a>
+			mutex_unlock(m);
+  801661:	83 ec 0c             	sub    $0xc,%esp
+  801664:	57                   	push   %edi
+  801665:	e8 b8 29 00 00       	call   804022 <mutex_unlock>
+			return;
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	e9 9f 00 00 00       	jmp    801711 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801672:	a8 02                	test   $0x2,%al
+  801674:	74 ae                	je     801624 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801676:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80167b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801682:	f6 c4 08             	test   $0x8,%ah
+  801685:	74 9d                	je     801624 <pgfault+0x23>
+  801687:	89 e0                	mov    %esp,%eax
+  801689:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80168e:	29 c2                	sub    %eax,%edx
+  801690:	89 d0                	mov    %edx,%eax
+  801692:	c1 e8 0f             	shr    $0xf,%eax
+  801695:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80169b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a0:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8016a3:	c1 e0 0c             	shl    $0xc,%eax
+  8016a6:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8016ab:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8016ad:	83 ec 04             	sub    $0x4,%esp
+  8016b0:	6a 07                	push   $0x7
+  8016b2:	53                   	push   %ebx
+  8016b3:	6a 00                	push   $0x0
+  8016b5:	e8 aa fa ff ff       	call   801164 <sys_page_alloc>
+  8016ba:	83 c4 10             	add    $0x10,%esp
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	78 58                	js     801719 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8016c1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8016c7:	83 ec 04             	sub    $0x4,%esp
+  8016ca:	68 00 10 00 00       	push   $0x1000
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+  8016d1:	e8 0a f8 ff ff       	call   800ee0 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8016d6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016dd:	56                   	push   %esi
+  8016de:	6a 00                	push   $0x0
+  8016e0:	53                   	push   %ebx
+  8016e1:	6a 00                	push   $0x0
+  8016e3:	e8 bf fa ff ff       	call   8011a7 <sys_page_map>
+  8016e8:	83 c4 20             	add    $0x20,%esp
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	78 3c                	js     80172b <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8016ef:	83 ec 08             	sub    $0x8,%esp
+  8016f2:	53                   	push   %ebx
+  8016f3:	6a 00                	push   $0x0
+  8016f5:	e8 ef fa ff ff       	call   8011e9 <sys_page_unmap>
+  8016fa:	83 c4 10             	add    $0x10,%esp
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	78 3c                	js     80173d <pgfault+0x13c>
+	if(m)
+  801701:	85 ff                	test   %edi,%edi
+  801703:	74 0c                	je     801711 <pgfault+0x110>
+		mutex_unlock(m);
+  801705:	83 ec 0c             	sub    $0xc,%esp
+  801708:	57                   	push   %edi
+  801709:	e8 14 29 00 00       	call   804022 <mutex_unlock>
+  80170e:	83 c4 10             	add    $0x10,%esp
+}
+  801711:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801714:	5b                   	pop    %ebx
+  801715:	5e                   	pop    %esi
+  801716:	5f                   	pop    %edi
+  801717:	5d                   	pop    %ebp
+  801718:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801719:	50                   	push   %eax
+  80171a:	68 5f 4d 80 00       	push   $0x804d5f
+  80171f:	6a 3d                	push   $0x3d
+  801721:	68 54 4d 80 00       	push   $0x804d54
+  801726:	e8 33 ee ff ff       	call   80055e <_panic>
+		panic("sys_page_map: %e", ret);
+  80172b:	50                   	push   %eax
+  80172c:	68 72 4d 80 00       	push   $0x804d72
+  801731:	6a 40                	push   $0x40
+  801733:	68 54 4d 80 00       	push   $0x804d54
+  801738:	e8 21 ee ff ff       	call   80055e <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80173d:	50                   	push   %eax
+  80173e:	68 83 4d 80 00       	push   $0x804d83
+  801743:	6a 42                	push   $0x42
+  801745:	68 54 4d 80 00       	push   $0x804d54
+  80174a:	e8 0f ee ff ff       	call   80055e <_panic>
+
+0080174f <thread_main>:
+{
+  80174f:	55                   	push   %ebp
+  801750:	89 e5                	mov    %esp,%ebp
+  801752:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801755:	ff 75 0c             	push   0xc(%ebp)
+  801758:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80175b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801762:	e8 7e f9 ff ff       	call   8010e5 <sys_env_destroy>
+}
+  801767:	83 c4 10             	add    $0x10,%esp
+  80176a:	c9                   	leave
+  80176b:	c3                   	ret
+
+0080176c <fork>:
+{
+  80176c:	55                   	push   %ebp
+  80176d:	89 e5                	mov    %esp,%ebp
+  80176f:	57                   	push   %edi
+  801770:	56                   	push   %esi
+  801771:	53                   	push   %ebx
+  801772:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801775:	68 01 16 80 00       	push   $0x801601
+  80177a:	e8 81 2b 00 00       	call   804300 <set_pgfault_handler>
+	if(sforked)
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	83 3d 80 8a 84 00 00 	cmpl   $0x0,0x848a80
+  801789:	75 33                	jne    8017be <fork+0x52>
+	__asm __volatile("int %2"
+  80178b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801790:	cd 30                	int    $0x30
+  801792:	89 c7                	mov    %eax,%edi
+  801794:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801796:	85 c0                	test   %eax,%eax
+  801798:	0f 88 b4 00 00 00    	js     801852 <fork+0xe6>
+	if(envid == 0) {
+  80179e:	0f 84 c3 00 00 00    	je     801867 <fork+0xfb>
+	pgbatch_init(&pb);
+  8017a4:	83 ec 0c             	sub    $0xc,%esp
+  8017a7:	68 20 83 84 00       	push   $0x848320
+  8017ac:	e8 4f 26 00 00       	call   803e00 <pgbatch_init>
+  8017b1:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8017b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b9:	e9 9c 01 00 00       	jmp    80195a <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8017be:	83 ec 0c             	sub    $0xc,%esp
+  8017c1:	68 c0 86 84 00       	push   $0x8486c0
+  8017c6:	e8 e9 27 00 00       	call   803fb4 <mutex_lock>
+  8017cb:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8017ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8017d3:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8017d8:	eb 08                	jmp    8017e2 <fork+0x76>
+  8017da:	83 c3 01             	add    $0x1,%ebx
+  8017dd:	83 fb 20             	cmp    $0x20,%ebx
+  8017e0:	74 5b                	je     80183d <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8017e2:	8b 34 9d 40 86 84 00 	mov    0x848640(,%ebx,4),%esi
+  8017e9:	89 f0                	mov    %esi,%eax
+  8017eb:	e8 d7 fd ff ff       	call   8015c7 <thread_alive>
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	74 e6                	je     8017da <fork+0x6e>
+  8017f4:	89 e0                	mov    %esp,%eax
+  8017f6:	89 fa                	mov    %edi,%edx
+  8017f8:	29 c2                	sub    %eax,%edx
+  8017fa:	89 d0                	mov    %edx,%eax
+  8017fc:	c1 e8 0f             	shr    $0xf,%eax
+  8017ff:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801805:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80180a:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80180d:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  801814:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801817:	83 ec 08             	sub    $0x8,%esp
+  80181a:	50                   	push   %eax
+  80181b:	56                   	push   %esi
+  80181c:	e8 8e fa ff ff       	call   8012af <sys_env_set_pgfault_upcall>
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	85 c0                	test   %eax,%eax
+  801826:	79 b2                	jns    8017da <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801828:	50                   	push   %eax
+  801829:	68 10 4e 80 00       	push   $0x804e10
+  80182e:	68 00 01 00 00       	push   $0x100
+  801833:	68 54 4d 80 00       	push   $0x804d54
+  801838:	e8 21 ed ff ff       	call   80055e <_panic>
+	mutex_unlock(&sfork_lock);
+  80183d:	83 ec 0c             	sub    $0xc,%esp
+  801840:	68 c0 86 84 00       	push   $0x8486c0
+  801845:	e8 d8 27 00 00       	call   804022 <mutex_unlock>
+}
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	e9 39 ff ff ff       	jmp    80178b <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801852:	50                   	push   %eax
+  801853:	68 96 4d 80 00       	push   $0x804d96
+  801858:	68 91 00 00 00       	push   $0x91
+  80185d:	68 54 4d 80 00       	push   $0x804d54
+  801862:	e8 f7 ec ff ff       	call   80055e <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801867:	e8 ba f8 ff ff       	call   801126 <sys_getenvid>
+  80186c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801871:	89 e1                	mov    %esp,%ecx
+  801873:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801878:	29 ca                	sub    %ecx,%edx
+  80187a:	89 d1                	mov    %edx,%ecx
+  80187c:	c1 e9 0f             	shr    $0xf,%ecx
+  80187f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801885:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188a:	0f 42 d1             	cmovb  %ecx,%edx
+  80188d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801893:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801898:	89 04 95 00 8a 84 00 	mov    %eax,0x848a00(,%edx,4)
+		if(sforked)
+  80189f:	a1 80 8a 84 00       	mov    0x848a80,%eax
+  8018a4:	85 c0                	test   %eax,%eax
+  8018a6:	75 07                	jne    8018af <fork+0x143>
+		return 0;
+  8018a8:	89 c6                	mov    %eax,%esi
+  8018aa:	e9 6f 02 00 00       	jmp    801b1e <fork+0x3b2>
+  8018af:	89 e2                	mov    %esp,%edx
+  8018b1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8018b6:	29 d0                	sub    %edx,%eax
+  8018b8:	89 c3                	mov    %eax,%ebx
+  8018ba:	c1 eb 0f             	shr    $0xf,%ebx
+  8018bd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c7:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8018ca:	83 ec 04             	sub    $0x4,%esp
+  8018cd:	68 80 00 00 00       	push   $0x80
+  8018d2:	6a 00                	push   $0x0
+  8018d4:	68 40 86 84 00       	push   $0x848640
+  8018d9:	e8 cd f5 ff ff       	call   800eab <memset>
+	thread_ids[slot] = sys_getenvid();
+  8018de:	e8 43 f8 ff ff       	call   801126 <sys_getenvid>
+  8018e3:	89 04 9d 40 86 84 00 	mov    %eax,0x848640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8018ea:	8b 04 9d 00 8a 84 00 	mov    0x848a00(,%ebx,4),%eax
+  8018f1:	a3 00 8a 84 00       	mov    %eax,0x848a00
+	mutex_init(&sfork_lock);
+  8018f6:	c7 04 24 c0 86 84 00 	movl   $0x8486c0,(%esp)
+  8018fd:	e8 a4 26 00 00       	call   803fa6 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801902:	83 c4 0c             	add    $0xc,%esp
+  801905:	68 07 04 00 00       	push   $0x407
+  80190a:	68 00 00 00 e1       	push   $0xe1000000
+  80190f:	6a 00                	push   $0x0
+  801911:	e8 4e f8 ff ff       	call   801164 <sys_page_alloc>
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	0f 89 fd 01 00 00    	jns    801b1e <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801921:	50                   	push   %eax
+  801922:	68 5f 4d 80 00       	push   $0x804d5f
+  801927:	68 12 01 00 00       	push   $0x112
+  80192c:	68 54 4d 80 00       	push   $0x804d54
+  801931:	e8 28 ec ff ff       	call   80055e <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801936:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80193c:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801942:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801948:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80194e:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801954:	0f 87 4f 01 00 00    	ja     801aa9 <fork+0x33d>
+		pd = PDX(addr);
+  80195a:	89 d8                	mov    %ebx,%eax
+  80195c:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80195f:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801966:	f6 c2 01             	test   $0x1,%dl
+  801969:	74 cb                	je     801936 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80196b:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801970:	0f 85 92 00 00 00    	jne    801a08 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801976:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80197c:	76 10                	jbe    80198e <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80197e:	89 d8                	mov    %ebx,%eax
+  801980:	f7 d8                	neg    %eax
+  801982:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801987:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80198c:	74 ba                	je     801948 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80198e:	89 d8                	mov    %ebx,%eax
+  801990:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801993:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80199a:	f6 c2 01             	test   $0x1,%dl
+  80199d:	74 a9                	je     801948 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  80199f:	89 c1                	mov    %eax,%ecx
+  8019a1:	c1 e1 0c             	shl    $0xc,%ecx
+  8019a4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8019a7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019ae:	f6 c6 04             	test   $0x4,%dh
+  8019b1:	0f 85 8e 00 00 00    	jne    801a45 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8019b7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019be:	f6 c6 08             	test   $0x8,%dh
+  8019c1:	75 0f                	jne    8019d2 <fork+0x266>
+  8019c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019ca:	a8 02                	test   $0x2,%al
+  8019cc:	0f 84 bb 00 00 00    	je     801a8d <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8019d2:	83 ec 08             	sub    $0x8,%esp
+  8019d5:	68 05 08 00 00       	push   $0x805
+  8019da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019dd:	50                   	push   %eax
+  8019de:	56                   	push   %esi
+  8019df:	50                   	push   %eax
+  8019e0:	6a 00                	push   $0x0
+  8019e2:	68 20 83 84 00       	push   $0x848320
+  8019e7:	e8 d2 24 00 00       	call   803ebe <pgbatch_map>
+  8019ec:	83 c4 20             	add    $0x20,%esp
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	79 76                	jns    801a69 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8019f3:	50                   	push   %eax
+  8019f4:	68 ba 4d 80 00       	push   $0x804dba
+  8019f9:	68 bc 00 00 00       	push   $0xbc
+  8019fe:	68 54 4d 80 00       	push   $0x804d54
+  801a03:	e8 56 eb ff ff       	call   80055e <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801a08:	83 ec 0c             	sub    $0xc,%esp
+  801a0b:	68 00 08 00 00       	push   $0x800
+  801a10:	56                   	push   %esi
+  801a11:	53                   	push   %ebx
+  801a12:	6a 00                	push   $0x0
+  801a14:	68 20 83 84 00       	push   $0x848320
+  801a19:	e8 4b 25 00 00       	call   803f69 <pgbatch_sharept>
+  801a1e:	83 c4 20             	add    $0x20,%esp
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	78 0b                	js     801a30 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801a25:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801a2b:	e9 18 ff ff ff       	jmp    801948 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801a30:	50                   	push   %eax
+  801a31:	68 a6 4d 80 00       	push   $0x804da6
+  801a36:	68 b2 00 00 00       	push   $0xb2
+  801a3b:	68 54 4d 80 00       	push   $0x804d54
+  801a40:	e8 19 eb ff ff       	call   80055e <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801a45:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+  801a4f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a54:	50                   	push   %eax
+  801a55:	51                   	push   %ecx
+  801a56:	56                   	push   %esi
+  801a57:	51                   	push   %ecx
+  801a58:	6a 00                	push   $0x0
+  801a5a:	68 20 83 84 00       	push   $0x848320
+  801a5f:	e8 5a 24 00 00       	call   803ebe <pgbatch_map>
+  801a64:	83 c4 20             	add    $0x20,%esp
+  801a67:	eb 17                	jmp    801a80 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801a69:	68 05 08 00 00       	push   $0x805
+  801a6e:	ff 75 e4             	push   -0x1c(%ebp)
+  801a71:	6a 00                	push   $0x0
+  801a73:	68 20 83 84 00       	push   $0x848320
+  801a78:	e8 b5 24 00 00       	call   803f32 <pgbatch_protect>
+  801a7d:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	0f 89 c0 fe ff ff    	jns    801948 <fork+0x1dc>
+  801a88:	e9 66 ff ff ff       	jmp    8019f3 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801a8d:	83 ec 08             	sub    $0x8,%esp
+  801a90:	6a 05                	push   $0x5
+  801a92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a95:	50                   	push   %eax
+  801a96:	56                   	push   %esi
+  801a97:	50                   	push   %eax
+  801a98:	6a 00                	push   $0x0
+  801a9a:	68 20 83 84 00       	push   $0x848320
+  801a9f:	e8 1a 24 00 00       	call   803ebe <pgbatch_map>
+  801aa4:	83 c4 20             	add    $0x20,%esp
+  801aa7:	eb d7                	jmp    801a80 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801aa9:	6a 07                	push   $0x7
+  801aab:	68 00 f0 bf ee       	push   $0xeebff000
+  801ab0:	57                   	push   %edi
+  801ab1:	68 20 83 84 00       	push   $0x848320
+  801ab6:	e8 cc 23 00 00       	call   803e87 <pgbatch_alloc>
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	78 66                	js     801b28 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801ac2:	83 ec 0c             	sub    $0xc,%esp
+  801ac5:	68 20 83 84 00       	push   $0x848320
+  801aca:	e8 3f 23 00 00       	call   803e0e <pgbatch_flush>
+  801acf:	83 c4 10             	add    $0x10,%esp
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	78 52                	js     801b28 <fork+0x3bc>
+  801ad6:	89 e2                	mov    %esp,%edx
+  801ad8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801add:	29 d0                	sub    %edx,%eax
+  801adf:	89 c2                	mov    %eax,%edx
+  801ae1:	c1 ea 0f             	shr    $0xf,%edx
+  801ae4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aee:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801af1:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  801af8:	8b 40 78             	mov    0x78(%eax),%eax
+  801afb:	83 ec 08             	sub    $0x8,%esp
+  801afe:	50                   	push   %eax
+  801aff:	57                   	push   %edi
+  801b00:	e8 aa f7 ff ff       	call   8012af <sys_env_set_pgfault_upcall>
+  801b05:	83 c4 10             	add    $0x10,%esp
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 31                	js     801b3d <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801b0c:	83 ec 08             	sub    $0x8,%esp
+  801b0f:	6a 02                	push   $0x2
+  801b11:	57                   	push   %edi
+  801b12:	e8 14 f7 ff ff       	call   80122b <sys_env_set_status>
+  801b17:	83 c4 10             	add    $0x10,%esp
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	78 34                	js     801b52 <fork+0x3e6>
+}
+  801b1e:	89 f0                	mov    %esi,%eax
+  801b20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b23:	5b                   	pop    %ebx
+  801b24:	5e                   	pop    %esi
+  801b25:	5f                   	pop    %edi
+  801b26:	5d                   	pop    %ebp
+  801b27:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801b28:	50                   	push   %eax
+  801b29:	68 c6 4d 80 00       	push   $0x804dc6
+  801b2e:	68 c0 00 00 00       	push   $0xc0
+  801b33:	68 54 4d 80 00       	push   $0x804d54
+  801b38:	e8 21 ea ff ff       	call   80055e <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801b3d:	50                   	push   %eax
+  801b3e:	68 db 4d 80 00       	push   $0x804ddb
+  801b43:	68 c2 00 00 00       	push   $0xc2
+  801b48:	68 54 4d 80 00       	push   $0x804d54
+  801b4d:	e8 0c ea ff ff       	call   80055e <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801b52:	50                   	push   %eax
+  801b53:	68 f6 4d 80 00       	push   $0x804df6
+  801b58:	68 c4 00 00 00       	push   $0xc4
+  801b5d:	68 54 4d 80 00       	push   $0x804d54
+  801b62:	e8 f7 e9 ff ff       	call   80055e <_panic>
+
+00801b67 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801b67:	55                   	push   %ebp
+  801b68:	89 e5                	mov    %esp,%ebp
+  801b6a:	57                   	push   %edi
+  801b6b:	56                   	push   %esi
+  801b6c:	53                   	push   %ebx
+  801b6d:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801b70:	68 c0 86 84 00       	push   $0x8486c0
+  801b75:	e8 3a 24 00 00       	call   803fb4 <mutex_lock>
+  801b7a:	89 e2                	mov    %esp,%edx
+  801b7c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b81:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801b83:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801b86:	89 c3                	mov    %eax,%ebx
+  801b88:	c1 eb 0f             	shr    $0xf,%ebx
+  801b8b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b95:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801b98:	e8 89 f5 ff ff       	call   801126 <sys_getenvid>
+  801b9d:	89 04 9d 40 86 84 00 	mov    %eax,0x848640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801ba4:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801ba9:	8b 04 9d 40 86 84 00 	mov    0x848640(,%ebx,4),%eax
+  801bb0:	e8 12 fa ff ff       	call   8015c7 <thread_alive>
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	74 24                	je     801bdd <sfork+0x76>
+  801bb9:	83 c3 01             	add    $0x1,%ebx
+  801bbc:	83 fb 20             	cmp    $0x20,%ebx
+  801bbf:	75 e8                	jne    801ba9 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801bc1:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801bc6:	83 ec 0c             	sub    $0xc,%esp
+  801bc9:	68 c0 86 84 00       	push   $0x8486c0
+  801bce:	e8 4f 24 00 00       	call   804022 <mutex_unlock>
+	return r;
+}
+  801bd3:	89 f0                	mov    %esi,%eax
+  801bd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd8:	5b                   	pop    %ebx
+  801bd9:	5e                   	pop    %esi
+  801bda:	5f                   	pop    %edi
+  801bdb:	5d                   	pop    %ebp
+  801bdc:	c3                   	ret
+	if (i == NTHREADS) {
+  801bdd:	83 fb 20             	cmp    $0x20,%ebx
+  801be0:	0f 84 53 01 00 00    	je     801d39 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801be6:	89 d8                	mov    %ebx,%eax
+  801be8:	c1 e0 0f             	shl    $0xf,%eax
+  801beb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801bee:	83 ec 0c             	sub    $0xc,%esp
+  801bf1:	68 00 80 84 00       	push   $0x848000
+  801bf6:	e8 05 22 00 00       	call   803e00 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	83 3d 80 8a 84 00 00 	cmpl   $0x0,0x848a80
+  801c05:	75 1f                	jne    801c26 <sfork+0xbf>
+  801c07:	68 07 04 00 00       	push   $0x407
+  801c0c:	68 00 00 00 e1       	push   $0xe1000000
+  801c11:	6a 00                	push   $0x0
+  801c13:	68 00 80 84 00       	push   $0x848000
+  801c18:	e8 6a 22 00 00       	call   803e87 <pgbatch_alloc>
+  801c1d:	89 c6                	mov    %eax,%esi
+  801c1f:	83 c4 10             	add    $0x10,%esp
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 a0                	js     801bc6 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801c26:	6a 07                	push   $0x7
+  801c28:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801c2d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c30:	29 c8                	sub    %ecx,%eax
+  801c32:	50                   	push   %eax
+  801c33:	6a 00                	push   $0x0
+  801c35:	68 00 80 84 00       	push   $0x848000
+  801c3a:	e8 48 22 00 00       	call   803e87 <pgbatch_alloc>
+  801c3f:	89 c6                	mov    %eax,%esi
+  801c41:	83 c4 10             	add    $0x10,%esp
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	0f 88 7a ff ff ff    	js     801bc6 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801c4c:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801c51:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c54:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c56:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801c5b:	29 c8                	sub    %ecx,%eax
+  801c5d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c60:	39 c7                	cmp    %eax,%edi
+  801c62:	73 29                	jae    801c8d <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801c64:	6a 07                	push   $0x7
+  801c66:	57                   	push   %edi
+  801c67:	6a 00                	push   $0x0
+  801c69:	68 00 80 84 00       	push   $0x848000
+  801c6e:	e8 14 22 00 00       	call   803e87 <pgbatch_alloc>
+  801c73:	89 c6                	mov    %eax,%esi
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	0f 88 46 ff ff ff    	js     801bc6 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c80:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801c86:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c89:	39 c7                	cmp    %eax,%edi
+  801c8b:	72 d7                	jb     801c64 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801c8d:	83 ec 0c             	sub    $0xc,%esp
+  801c90:	68 00 80 84 00       	push   $0x848000
+  801c95:	e8 74 21 00 00       	call   803e0e <pgbatch_flush>
+  801c9a:	89 c6                	mov    %eax,%esi
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	0f 88 1f ff ff ff    	js     801bc6 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801ca7:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801cac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801caf:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801cb1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801cb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cba:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801cbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cc0:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801cc3:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801cc6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801ccb:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801ccd:	52                   	push   %edx
+  801cce:	50                   	push   %eax
+  801ccf:	68 4f 17 80 00       	push   $0x80174f
+  801cd4:	e8 cc f8 ff ff       	call   8015a5 <sys_exofork_shared>
+  801cd9:	89 c6                	mov    %eax,%esi
+  801cdb:	83 c4 10             	add    $0x10,%esp
+  801cde:	85 c0                	test   %eax,%eax
+  801ce0:	0f 88 e0 fe ff ff    	js     801bc6 <sfork+0x5f>
+	thread_ids[i] = id;
+  801ce6:	89 04 9d 40 86 84 00 	mov    %eax,0x848640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801ced:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cf2:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801cf8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801cfd:	89 04 9d 00 8a 84 00 	mov    %eax,0x848a00(,%ebx,4)
+	sforked = 1;
+  801d04:	c7 05 80 8a 84 00 01 	movl   $0x1,0x848a80
+  801d0b:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801d0e:	83 ec 08             	sub    $0x8,%esp
+  801d11:	6a 02                	push   $0x2
+  801d13:	56                   	push   %esi
+  801d14:	e8 12 f5 ff ff       	call   80122b <sys_env_set_status>
+  801d19:	89 c3                	mov    %eax,%ebx
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	0f 89 a0 fe ff ff    	jns    801bc6 <sfork+0x5f>
+		sys_env_destroy(id);
+  801d26:	83 ec 0c             	sub    $0xc,%esp
+  801d29:	56                   	push   %esi
+  801d2a:	e8 b6 f3 ff ff       	call   8010e5 <sys_env_destroy>
+		goto out;
+  801d2f:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801d32:	89 de                	mov    %ebx,%esi
+		goto out;
+  801d34:	e9 8d fe ff ff       	jmp    801bc6 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801d39:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801d3e:	e9 83 fe ff ff       	jmp    801bc6 <sfork+0x5f>
+
+00801d43 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d43:	55                   	push   %ebp
+  801d44:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d49:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d4e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d51:	5d                   	pop    %ebp
+  801d52:	c3                   	ret
+
+00801d53 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d53:	55                   	push   %ebp
+  801d54:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d59:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801d5e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d63:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801d68:	5d                   	pop    %ebp
+  801d69:	c3                   	ret
+
+00801d6a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+  801d6d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801d72:	89 c2                	mov    %eax,%edx
+  801d74:	c1 ea 16             	shr    $0x16,%edx
+  801d77:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d7e:	f6 c2 01             	test   $0x1,%dl
+  801d81:	74 29                	je     801dac <fd_alloc+0x42>
+  801d83:	89 c2                	mov    %eax,%edx
+  801d85:	c1 ea 0c             	shr    $0xc,%edx
+  801d88:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d8f:	f6 c2 01             	test   $0x1,%dl
+  801d92:	74 18                	je     801dac <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801d94:	05 00 10 00 00       	add    $0x1000,%eax
+  801d99:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801d9e:	75 d2                	jne    801d72 <fd_alloc+0x8>
+  801da0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801da5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801daa:	eb 05                	jmp    801db1 <fd_alloc+0x47>
+			return 0;
+  801dac:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db4:	89 02                	mov    %eax,(%edx)
+}
+  801db6:	89 c8                	mov    %ecx,%eax
+  801db8:	5d                   	pop    %ebp
+  801db9:	c3                   	ret
+
+00801dba <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801dba:	55                   	push   %ebp
+  801dbb:	89 e5                	mov    %esp,%ebp
+  801dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801dc0:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801dc5:	77 30                	ja     801df7 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801dc7:	c1 e0 0c             	shl    $0xc,%eax
+  801dca:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801dcf:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801dd5:	f6 c2 01             	test   $0x1,%dl
+  801dd8:	74 24                	je     801dfe <fd_lookup+0x44>
+  801dda:	89 c2                	mov    %eax,%edx
+  801ddc:	c1 ea 0c             	shr    $0xc,%edx
+  801ddf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801de6:	f6 c2 01             	test   $0x1,%dl
+  801de9:	74 1a                	je     801e05 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801deb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dee:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801df0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df5:	5d                   	pop    %ebp
+  801df6:	c3                   	ret
+		return -E_INVAL;
+  801df7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfc:	eb f7                	jmp    801df5 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801dfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e03:	eb f0                	jmp    801df5 <fd_lookup+0x3b>
+  801e05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e0a:	eb e9                	jmp    801df5 <fd_lookup+0x3b>
+
+00801e0c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	53                   	push   %ebx
+  801e10:	83 ec 04             	sub    $0x4,%esp
+  801e13:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1b:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801e20:	39 13                	cmp    %edx,(%ebx)
+  801e22:	74 54                	je     801e78 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801e24:	83 c0 01             	add    $0x1,%eax
+  801e27:	8b 1c 85 ac 4e 80 00 	mov    0x804eac(,%eax,4),%ebx
+  801e2e:	85 db                	test   %ebx,%ebx
+  801e30:	75 ee                	jne    801e20 <dev_lookup+0x14>
+  801e32:	89 e1                	mov    %esp,%ecx
+  801e34:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e39:	29 c8                	sub    %ecx,%eax
+  801e3b:	89 c1                	mov    %eax,%ecx
+  801e3d:	c1 e9 0f             	shr    $0xf,%ecx
+  801e40:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4a:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e4d:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  801e54:	8b 40 48             	mov    0x48(%eax),%eax
+  801e57:	83 ec 04             	sub    $0x4,%esp
+  801e5a:	52                   	push   %edx
+  801e5b:	50                   	push   %eax
+  801e5c:	68 30 4e 80 00       	push   $0x804e30
+  801e61:	e8 d3 e7 ff ff       	call   800639 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e71:	89 1a                	mov    %ebx,(%edx)
+}
+  801e73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+			return 0;
+  801e78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7d:	eb ef                	jmp    801e6e <dev_lookup+0x62>
+
+00801e7f <fd_close>:
+{
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	57                   	push   %edi
+  801e83:	56                   	push   %esi
+  801e84:	53                   	push   %ebx
+  801e85:	83 ec 24             	sub    $0x24,%esp
+  801e88:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e8b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e8e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e91:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e92:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e98:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e9b:	50                   	push   %eax
+  801e9c:	e8 19 ff ff ff       	call   801dba <fd_lookup>
+  801ea1:	89 c3                	mov    %eax,%ebx
+  801ea3:	83 c4 10             	add    $0x10,%esp
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 05                	js     801eaf <fd_close+0x30>
+	    || fd != fd2)
+  801eaa:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ead:	74 0f                	je     801ebe <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801eaf:	85 ff                	test   %edi,%edi
+  801eb1:	0f 44 df             	cmove  %edi,%ebx
+}
+  801eb4:	89 d8                	mov    %ebx,%eax
+  801eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb9:	5b                   	pop    %ebx
+  801eba:	5e                   	pop    %esi
+  801ebb:	5f                   	pop    %edi
+  801ebc:	5d                   	pop    %ebp
+  801ebd:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ebe:	83 ec 08             	sub    $0x8,%esp
+  801ec1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ec4:	50                   	push   %eax
+  801ec5:	ff 36                	push   (%esi)
+  801ec7:	e8 40 ff ff ff       	call   801e0c <dev_lookup>
+  801ecc:	89 c3                	mov    %eax,%ebx
+  801ece:	83 c4 10             	add    $0x10,%esp
+  801ed1:	85 c0                	test   %eax,%eax
+  801ed3:	78 1a                	js     801eef <fd_close+0x70>
+		if (dev->dev_close)
+  801ed5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ed8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	74 0b                	je     801eef <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801ee4:	83 ec 0c             	sub    $0xc,%esp
+  801ee7:	56                   	push   %esi
+  801ee8:	ff d0                	call   *%eax
+  801eea:	89 c3                	mov    %eax,%ebx
+  801eec:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801eef:	83 ec 08             	sub    $0x8,%esp
+  801ef2:	56                   	push   %esi
+  801ef3:	6a 00                	push   $0x0
+  801ef5:	e8 ef f2 ff ff       	call   8011e9 <sys_page_unmap>
+	return r;
+  801efa:	83 c4 10             	add    $0x10,%esp
+  801efd:	eb b5                	jmp    801eb4 <fd_close+0x35>
+
+00801eff <close>:
+
+int
+close(int fdnum)
+{
+  801eff:	55                   	push   %ebp
+  801f00:	89 e5                	mov    %esp,%ebp
+  801f02:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f08:	50                   	push   %eax
+  801f09:	ff 75 08             	push   0x8(%ebp)
+  801f0c:	e8 a9 fe ff ff       	call   801dba <fd_lookup>
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	79 02                	jns    801f1a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f18:	c9                   	leave
+  801f19:	c3                   	ret
+		return fd_close(fd, 1);
+  801f1a:	83 ec 08             	sub    $0x8,%esp
+  801f1d:	6a 01                	push   $0x1
+  801f1f:	ff 75 f4             	push   -0xc(%ebp)
+  801f22:	e8 58 ff ff ff       	call   801e7f <fd_close>
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	eb ec                	jmp    801f18 <close+0x19>
+
+00801f2c <close_all>:
+
+void
+close_all(void)
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	53                   	push   %ebx
+  801f30:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f38:	83 ec 0c             	sub    $0xc,%esp
+  801f3b:	53                   	push   %ebx
+  801f3c:	e8 be ff ff ff       	call   801eff <close>
+	for (i = 0; i < MAXFD; i++)
+  801f41:	83 c3 01             	add    $0x1,%ebx
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801f4d:	75 e9                	jne    801f38 <close_all+0xc>
+}
+  801f4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f52:	c9                   	leave
+  801f53:	c3                   	ret
+
+00801f54 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	57                   	push   %edi
+  801f58:	56                   	push   %esi
+  801f59:	53                   	push   %ebx
+  801f5a:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801f5d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f60:	50                   	push   %eax
+  801f61:	ff 75 08             	push   0x8(%ebp)
+  801f64:	e8 51 fe ff ff       	call   801dba <fd_lookup>
+  801f69:	89 c3                	mov    %eax,%ebx
+  801f6b:	83 c4 10             	add    $0x10,%esp
+  801f6e:	85 c0                	test   %eax,%eax
+  801f70:	78 7f                	js     801ff1 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f72:	83 ec 0c             	sub    $0xc,%esp
+  801f75:	ff 75 0c             	push   0xc(%ebp)
+  801f78:	e8 82 ff ff ff       	call   801eff <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801f7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f80:	c1 e6 0c             	shl    $0xc,%esi
+  801f83:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801f89:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f8c:	89 3c 24             	mov    %edi,(%esp)
+  801f8f:	e8 bf fd ff ff       	call   801d53 <fd2data>
+  801f94:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801f96:	89 34 24             	mov    %esi,(%esp)
+  801f99:	e8 b5 fd ff ff       	call   801d53 <fd2data>
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801fa4:	89 d8                	mov    %ebx,%eax
+  801fa6:	c1 e8 16             	shr    $0x16,%eax
+  801fa9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fb0:	a8 01                	test   $0x1,%al
+  801fb2:	74 11                	je     801fc5 <dup+0x71>
+  801fb4:	89 d8                	mov    %ebx,%eax
+  801fb6:	c1 e8 0c             	shr    $0xc,%eax
+  801fb9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801fc0:	f6 c2 01             	test   $0x1,%dl
+  801fc3:	75 36                	jne    801ffb <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801fc5:	89 f8                	mov    %edi,%eax
+  801fc7:	c1 e8 0c             	shr    $0xc,%eax
+  801fca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+  801fd4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fd9:	50                   	push   %eax
+  801fda:	56                   	push   %esi
+  801fdb:	6a 00                	push   $0x0
+  801fdd:	57                   	push   %edi
+  801fde:	6a 00                	push   $0x0
+  801fe0:	e8 c2 f1 ff ff       	call   8011a7 <sys_page_map>
+  801fe5:	89 c3                	mov    %eax,%ebx
+  801fe7:	83 c4 20             	add    $0x20,%esp
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 33                	js     802021 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801fee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801ff1:	89 d8                	mov    %ebx,%eax
+  801ff3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff6:	5b                   	pop    %ebx
+  801ff7:	5e                   	pop    %esi
+  801ff8:	5f                   	pop    %edi
+  801ff9:	5d                   	pop    %ebp
+  801ffa:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ffb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802002:	83 ec 0c             	sub    $0xc,%esp
+  802005:	25 07 0e 00 00       	and    $0xe07,%eax
+  80200a:	50                   	push   %eax
+  80200b:	ff 75 d4             	push   -0x2c(%ebp)
+  80200e:	6a 00                	push   $0x0
+  802010:	53                   	push   %ebx
+  802011:	6a 00                	push   $0x0
+  802013:	e8 8f f1 ff ff       	call   8011a7 <sys_page_map>
+  802018:	89 c3                	mov    %eax,%ebx
+  80201a:	83 c4 20             	add    $0x20,%esp
+  80201d:	85 c0                	test   %eax,%eax
+  80201f:	79 a4                	jns    801fc5 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802021:	83 ec 08             	sub    $0x8,%esp
+  802024:	56                   	push   %esi
+  802025:	6a 00                	push   $0x0
+  802027:	e8 bd f1 ff ff       	call   8011e9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80202c:	83 c4 08             	add    $0x8,%esp
+  80202f:	ff 75 d4             	push   -0x2c(%ebp)
+  802032:	6a 00                	push   $0x0
+  802034:	e8 b0 f1 ff ff       	call   8011e9 <sys_page_unmap>
+	return r;
+  802039:	83 c4 10             	add    $0x10,%esp
+  80203c:	eb b3                	jmp    801ff1 <dup+0x9d>
+
+0080203e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	56                   	push   %esi
+  802042:	53                   	push   %ebx
+  802043:	83 ec 18             	sub    $0x18,%esp
+  802046:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802049:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80204c:	50                   	push   %eax
+  80204d:	53                   	push   %ebx
+  80204e:	e8 67 fd ff ff       	call   801dba <fd_lookup>
+  802053:	83 c4 10             	add    $0x10,%esp
+  802056:	85 c0                	test   %eax,%eax
+  802058:	78 3c                	js     802096 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80205a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80205d:	83 ec 08             	sub    $0x8,%esp
+  802060:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802063:	50                   	push   %eax
+  802064:	ff 36                	push   (%esi)
+  802066:	e8 a1 fd ff ff       	call   801e0c <dev_lookup>
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	85 c0                	test   %eax,%eax
+  802070:	78 24                	js     802096 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802072:	8b 46 08             	mov    0x8(%esi),%eax
+  802075:	83 e0 03             	and    $0x3,%eax
+  802078:	83 f8 01             	cmp    $0x1,%eax
+  80207b:	74 20                	je     80209d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80207d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802080:	8b 40 08             	mov    0x8(%eax),%eax
+  802083:	85 c0                	test   %eax,%eax
+  802085:	74 54                	je     8020db <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802087:	83 ec 04             	sub    $0x4,%esp
+  80208a:	ff 75 10             	push   0x10(%ebp)
+  80208d:	ff 75 0c             	push   0xc(%ebp)
+  802090:	56                   	push   %esi
+  802091:	ff d0                	call   *%eax
+  802093:	83 c4 10             	add    $0x10,%esp
+}
+  802096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802099:	5b                   	pop    %ebx
+  80209a:	5e                   	pop    %esi
+  80209b:	5d                   	pop    %ebp
+  80209c:	c3                   	ret
+  80209d:	89 e2                	mov    %esp,%edx
+  80209f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020a4:	29 d0                	sub    %edx,%eax
+  8020a6:	89 c2                	mov    %eax,%edx
+  8020a8:	c1 ea 0f             	shr    $0xf,%edx
+  8020ab:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b5:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020b8:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8020bf:	8b 40 48             	mov    0x48(%eax),%eax
+  8020c2:	83 ec 04             	sub    $0x4,%esp
+  8020c5:	53                   	push   %ebx
+  8020c6:	50                   	push   %eax
+  8020c7:	68 71 4e 80 00       	push   $0x804e71
+  8020cc:	e8 68 e5 ff ff       	call   800639 <cprintf>
+		return -E_INVAL;
+  8020d1:	83 c4 10             	add    $0x10,%esp
+  8020d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020d9:	eb bb                	jmp    802096 <read+0x58>
+		return -E_NOT_SUPP;
+  8020db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020e0:	eb b4                	jmp    802096 <read+0x58>
+
+008020e2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8020e2:	55                   	push   %ebp
+  8020e3:	89 e5                	mov    %esp,%ebp
+  8020e5:	57                   	push   %edi
+  8020e6:	56                   	push   %esi
+  8020e7:	53                   	push   %ebx
+  8020e8:	83 ec 0c             	sub    $0xc,%esp
+  8020eb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020ee:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8020f1:	85 f6                	test   %esi,%esi
+  8020f3:	74 30                	je     802125 <readn+0x43>
+  8020f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020fa:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8020ff:	83 ec 04             	sub    $0x4,%esp
+  802102:	89 f2                	mov    %esi,%edx
+  802104:	29 c2                	sub    %eax,%edx
+  802106:	52                   	push   %edx
+  802107:	01 f8                	add    %edi,%eax
+  802109:	50                   	push   %eax
+  80210a:	ff 75 08             	push   0x8(%ebp)
+  80210d:	e8 2c ff ff ff       	call   80203e <read>
+		if (m < 0)
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 15                	js     80212e <readn+0x4c>
+			return m;
+		if (m == 0)
+  802119:	74 11                	je     80212c <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80211b:	01 c3                	add    %eax,%ebx
+  80211d:	89 d8                	mov    %ebx,%eax
+  80211f:	39 f3                	cmp    %esi,%ebx
+  802121:	72 dc                	jb     8020ff <readn+0x1d>
+  802123:	eb 09                	jmp    80212e <readn+0x4c>
+  802125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212a:	eb 02                	jmp    80212e <readn+0x4c>
+  80212c:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  80212e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802131:	5b                   	pop    %ebx
+  802132:	5e                   	pop    %esi
+  802133:	5f                   	pop    %edi
+  802134:	5d                   	pop    %ebp
+  802135:	c3                   	ret
+
+00802136 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802136:	55                   	push   %ebp
+  802137:	89 e5                	mov    %esp,%ebp
+  802139:	56                   	push   %esi
+  80213a:	53                   	push   %ebx
+  80213b:	83 ec 18             	sub    $0x18,%esp
+  80213e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802141:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802144:	50                   	push   %eax
+  802145:	53                   	push   %ebx
+  802146:	e8 6f fc ff ff       	call   801dba <fd_lookup>
+  80214b:	83 c4 10             	add    $0x10,%esp
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 37                	js     802189 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802152:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802155:	83 ec 08             	sub    $0x8,%esp
+  802158:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215b:	50                   	push   %eax
+  80215c:	ff 36                	push   (%esi)
+  80215e:	e8 a9 fc ff ff       	call   801e0c <dev_lookup>
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	85 c0                	test   %eax,%eax
+  802168:	78 1f                	js     802189 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80216a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80216e:	74 20                	je     802190 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802170:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802173:	8b 40 0c             	mov    0xc(%eax),%eax
+  802176:	85 c0                	test   %eax,%eax
+  802178:	74 54                	je     8021ce <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80217a:	83 ec 04             	sub    $0x4,%esp
+  80217d:	ff 75 10             	push   0x10(%ebp)
+  802180:	ff 75 0c             	push   0xc(%ebp)
+  802183:	56                   	push   %esi
+  802184:	ff d0                	call   *%eax
+  802186:	83 c4 10             	add    $0x10,%esp
+}
+  802189:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218c:	5b                   	pop    %ebx
+  80218d:	5e                   	pop    %esi
+  80218e:	5d                   	pop    %ebp
+  80218f:	c3                   	ret
+  802190:	89 e2                	mov    %esp,%edx
+  802192:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802197:	29 d0                	sub    %edx,%eax
+  802199:	89 c2                	mov    %eax,%edx
+  80219b:	c1 ea 0f             	shr    $0xf,%edx
+  80219e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8021a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a8:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021ab:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8021b2:	8b 40 48             	mov    0x48(%eax),%eax
+  8021b5:	83 ec 04             	sub    $0x4,%esp
+  8021b8:	53                   	push   %ebx
+  8021b9:	50                   	push   %eax
+  8021ba:	68 8d 4e 80 00       	push   $0x804e8d
+  8021bf:	e8 75 e4 ff ff       	call   800639 <cprintf>
+		return -E_INVAL;
+  8021c4:	83 c4 10             	add    $0x10,%esp
+  8021c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021cc:	eb bb                	jmp    802189 <write+0x53>
+		return -E_NOT_SUPP;
+  8021ce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021d3:	eb b4                	jmp    802189 <write+0x53>
+
+008021d5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8021d5:	55                   	push   %ebp
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021de:	50                   	push   %eax
+  8021df:	ff 75 08             	push   0x8(%ebp)
+  8021e2:	e8 d3 fb ff ff       	call   801dba <fd_lookup>
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 0e                	js     8021fc <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8021ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8021f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021fc:	c9                   	leave
+  8021fd:	c3                   	ret
+
+008021fe <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	53                   	push   %ebx
+  802202:	83 ec 1c             	sub    $0x1c,%esp
+  802205:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802208:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80220b:	50                   	push   %eax
+  80220c:	ff 75 08             	push   0x8(%ebp)
+  80220f:	e8 a6 fb ff ff       	call   801dba <fd_lookup>
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	85 c0                	test   %eax,%eax
+  802219:	78 33                	js     80224e <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80221b:	83 fb 03             	cmp    $0x3,%ebx
+  80221e:	74 28                	je     802248 <fcntl+0x4a>
+  802220:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802225:	83 fb 04             	cmp    $0x4,%ebx
+  802228:	75 24                	jne    80224e <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80222a:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  80222d:	8b 41 08             	mov    0x8(%ecx),%eax
+  802230:	80 e4 ef             	and    $0xef,%ah
+  802233:	8b 55 10             	mov    0x10(%ebp),%edx
+  802236:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80223c:	09 d0                	or     %edx,%eax
+  80223e:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802241:	b8 00 00 00 00       	mov    $0x0,%eax
+  802246:	eb 06                	jmp    80224e <fcntl+0x50>
+		return fd->fd_omode;
+  802248:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224b:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80224e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+
+00802253 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	56                   	push   %esi
+  802257:	53                   	push   %ebx
+  802258:	83 ec 18             	sub    $0x18,%esp
+  80225b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80225e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802261:	50                   	push   %eax
+  802262:	53                   	push   %ebx
+  802263:	e8 52 fb ff ff       	call   801dba <fd_lookup>
+  802268:	83 c4 10             	add    $0x10,%esp
+  80226b:	85 c0                	test   %eax,%eax
+  80226d:	78 34                	js     8022a3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80226f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802272:	83 ec 08             	sub    $0x8,%esp
+  802275:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802278:	50                   	push   %eax
+  802279:	ff 36                	push   (%esi)
+  80227b:	e8 8c fb ff ff       	call   801e0c <dev_lookup>
+  802280:	83 c4 10             	add    $0x10,%esp
+  802283:	85 c0                	test   %eax,%eax
+  802285:	78 1c                	js     8022a3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802287:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80228b:	74 1d                	je     8022aa <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80228d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802290:	8b 40 18             	mov    0x18(%eax),%eax
+  802293:	85 c0                	test   %eax,%eax
+  802295:	74 51                	je     8022e8 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802297:	83 ec 08             	sub    $0x8,%esp
+  80229a:	ff 75 0c             	push   0xc(%ebp)
+  80229d:	56                   	push   %esi
+  80229e:	ff d0                	call   *%eax
+  8022a0:	83 c4 10             	add    $0x10,%esp
+}
+  8022a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022a6:	5b                   	pop    %ebx
+  8022a7:	5e                   	pop    %esi
+  8022a8:	5d                   	pop    %ebp
+  8022a9:	c3                   	ret
+  8022aa:	89 e2                	mov    %esp,%edx
+  8022ac:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8022b1:	29 d0                	sub    %edx,%eax
+  8022b3:	89 c2                	mov    %eax,%edx
+  8022b5:	c1 ea 0f             	shr    $0xf,%edx
+  8022b8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8022bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c2:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8022c5:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8022cc:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022cf:	83 ec 04             	sub    $0x4,%esp
+  8022d2:	53                   	push   %ebx
+  8022d3:	50                   	push   %eax
+  8022d4:	68 50 4e 80 00       	push   $0x804e50
+  8022d9:	e8 5b e3 ff ff       	call   800639 <cprintf>
+		return -E_INVAL;
+  8022de:	83 c4 10             	add    $0x10,%esp
+  8022e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022e6:	eb bb                	jmp    8022a3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8022e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022ed:	eb b4                	jmp    8022a3 <ftruncate+0x50>
+
+008022ef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+  8022f4:	83 ec 18             	sub    $0x18,%esp
+  8022f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022fd:	50                   	push   %eax
+  8022fe:	ff 75 08             	push   0x8(%ebp)
+  802301:	e8 b4 fa ff ff       	call   801dba <fd_lookup>
+  802306:	83 c4 10             	add    $0x10,%esp
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	78 53                	js     802360 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80230d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802310:	83 ec 08             	sub    $0x8,%esp
+  802313:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802316:	50                   	push   %eax
+  802317:	ff 36                	push   (%esi)
+  802319:	e8 ee fa ff ff       	call   801e0c <dev_lookup>
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	85 c0                	test   %eax,%eax
+  802323:	78 3b                	js     802360 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802328:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80232c:	74 39                	je     802367 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80232e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802331:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802338:	00 00 00 
+	stat->st_isdir = 0;
+  80233b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802342:	00 00 00 
+	stat->st_version = 0;
+  802345:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80234c:	00 00 00 
+	stat->st_dev = dev;
+  80234f:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802355:	83 ec 08             	sub    $0x8,%esp
+  802358:	53                   	push   %ebx
+  802359:	56                   	push   %esi
+  80235a:	ff 50 14             	call   *0x14(%eax)
+  80235d:	83 c4 10             	add    $0x10,%esp
+}
+  802360:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802363:	5b                   	pop    %ebx
+  802364:	5e                   	pop    %esi
+  802365:	5d                   	pop    %ebp
+  802366:	c3                   	ret
+		return -E_NOT_SUPP;
+  802367:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80236c:	eb f2                	jmp    802360 <fstat+0x71>
+
+0080236e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80236e:	55                   	push   %ebp
+  80236f:	89 e5                	mov    %esp,%ebp
+  802371:	56                   	push   %esi
+  802372:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802373:	83 ec 08             	sub    $0x8,%esp
+  802376:	6a 00                	push   $0x0
+  802378:	ff 75 08             	push   0x8(%ebp)
+  80237b:	e8 b7 01 00 00       	call   802537 <open>
+  802380:	89 c3                	mov    %eax,%ebx
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 1b                	js     8023a4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802389:	83 ec 08             	sub    $0x8,%esp
+  80238c:	ff 75 0c             	push   0xc(%ebp)
+  80238f:	50                   	push   %eax
+  802390:	e8 5a ff ff ff       	call   8022ef <fstat>
+  802395:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802397:	89 1c 24             	mov    %ebx,(%esp)
+  80239a:	e8 60 fb ff ff       	call   801eff <close>
+	return r;
+  80239f:	83 c4 10             	add    $0x10,%esp
+  8023a2:	89 f3                	mov    %esi,%ebx
+}
+  8023a4:	89 d8                	mov    %ebx,%eax
+  8023a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023a9:	5b                   	pop    %ebx
+  8023aa:	5e                   	pop    %esi
+  8023ab:	5d                   	pop    %ebp
+  8023ac:	c3                   	ret
+
+008023ad <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	56                   	push   %esi
+  8023b1:	53                   	push   %ebx
+  8023b2:	89 c6                	mov    %eax,%esi
+  8023b4:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8023b6:	83 3d c4 86 84 00 00 	cmpl   $0x0,0x8486c4
+  8023bd:	74 27                	je     8023e6 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8023bf:	6a 07                	push   $0x7
+  8023c1:	68 00 90 84 00       	push   $0x849000
+  8023c6:	56                   	push   %esi
+  8023c7:	ff 35 c4 86 84 00    	push   0x8486c4
+  8023cd:	e8 22 22 00 00       	call   8045f4 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8023d2:	83 c4 0c             	add    $0xc,%esp
+  8023d5:	6a 00                	push   $0x0
+  8023d7:	53                   	push   %ebx
+  8023d8:	6a 00                	push   $0x0
+  8023da:	e8 85 1f 00 00       	call   804364 <ipc_recv>
+}
+  8023df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e2:	5b                   	pop    %ebx
+  8023e3:	5e                   	pop    %esi
+  8023e4:	5d                   	pop    %ebp
+  8023e5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023e6:	83 ec 0c             	sub    $0xc,%esp
+  8023e9:	6a 02                	push   $0x2
+  8023eb:	e8 6d 22 00 00       	call   80465d <ipc_find_env>
+  8023f0:	a3 c4 86 84 00       	mov    %eax,0x8486c4
+  8023f5:	83 c4 10             	add    $0x10,%esp
+  8023f8:	eb c5                	jmp    8023bf <fsipc+0x12>
+
+008023fa <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8023fa:	55                   	push   %ebp
+  8023fb:	89 e5                	mov    %esp,%ebp
+  8023fd:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802400:	8b 45 08             	mov    0x8(%ebp),%eax
+  802403:	8b 40 0c             	mov    0xc(%eax),%eax
+  802406:	a3 00 90 84 00       	mov    %eax,0x849000
+	fsipcbuf.set_size.req_size = newsize;
+  80240b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80240e:	a3 04 90 84 00       	mov    %eax,0x849004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802413:	ba 00 00 00 00       	mov    $0x0,%edx
+  802418:	b8 02 00 00 00       	mov    $0x2,%eax
+  80241d:	e8 8b ff ff ff       	call   8023ad <fsipc>
+}
+  802422:	c9                   	leave
+  802423:	c3                   	ret
+
+00802424 <devfile_flush>:
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80242a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802430:	a3 00 90 84 00       	mov    %eax,0x849000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80243f:	e8 69 ff ff ff       	call   8023ad <fsipc>
+}
+  802444:	c9                   	leave
+  802445:	c3                   	ret
+
+00802446 <devfile_stat>:
+{
+  802446:	55                   	push   %ebp
+  802447:	89 e5                	mov    %esp,%ebp
+  802449:	53                   	push   %ebx
+  80244a:	83 ec 04             	sub    $0x4,%esp
+  80244d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802450:	8b 45 08             	mov    0x8(%ebp),%eax
+  802453:	8b 40 0c             	mov    0xc(%eax),%eax
+  802456:	a3 00 90 84 00       	mov    %eax,0x849000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80245b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802460:	b8 05 00 00 00       	mov    $0x5,%eax
+  802465:	e8 43 ff ff ff       	call   8023ad <fsipc>
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	78 37                	js     8024a5 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80246e:	83 ec 08             	sub    $0x8,%esp
+  802471:	68 00 90 84 00       	push   $0x849000
+  802476:	53                   	push   %ebx
+  802477:	e8 b4 e8 ff ff       	call   800d30 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80247c:	a1 80 90 84 00       	mov    0x849080,%eax
+  802481:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802487:	a1 84 90 84 00       	mov    0x849084,%eax
+  80248c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802492:	a1 88 90 84 00       	mov    0x849088,%eax
+  802497:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024a8:	c9                   	leave
+  8024a9:	c3                   	ret
+
+008024aa <devfile_write>:
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	83 ec 0c             	sub    $0xc,%esp
+  8024b0:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8024b3:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8024b8:	39 d0                	cmp    %edx,%eax
+  8024ba:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c0:	8b 52 0c             	mov    0xc(%edx),%edx
+  8024c3:	89 15 00 90 84 00    	mov    %edx,0x849000
+	fsipcbuf.write.req_n = count;
+  8024c9:	a3 04 90 84 00       	mov    %eax,0x849004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8024ce:	50                   	push   %eax
+  8024cf:	ff 75 0c             	push   0xc(%ebp)
+  8024d2:	68 08 90 84 00       	push   $0x849008
+  8024d7:	e8 04 ea ff ff       	call   800ee0 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8024dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024e6:	e8 c2 fe ff ff       	call   8023ad <fsipc>
+}
+  8024eb:	c9                   	leave
+  8024ec:	c3                   	ret
+
+008024ed <devfile_read>:
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	53                   	push   %ebx
+  8024f1:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024fa:	a3 00 90 84 00       	mov    %eax,0x849000
+	fsipcbuf.read.req_n = n;
+  8024ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802502:	a3 04 90 84 00       	mov    %eax,0x849004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802507:	ba 00 90 84 00       	mov    $0x849000,%edx
+  80250c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802511:	e8 97 fe ff ff       	call   8023ad <fsipc>
+  802516:	89 c3                	mov    %eax,%ebx
+  802518:	85 c0                	test   %eax,%eax
+  80251a:	78 14                	js     802530 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  80251c:	83 ec 04             	sub    $0x4,%esp
+  80251f:	50                   	push   %eax
+  802520:	68 00 90 84 00       	push   $0x849000
+  802525:	ff 75 0c             	push   0xc(%ebp)
+  802528:	e8 b3 e9 ff ff       	call   800ee0 <memmove>
+	return r;
+  80252d:	83 c4 10             	add    $0x10,%esp
+}
+  802530:	89 d8                	mov    %ebx,%eax
+  802532:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802535:	c9                   	leave
+  802536:	c3                   	ret
+
+00802537 <open>:
+{
+  802537:	55                   	push   %ebp
+  802538:	89 e5                	mov    %esp,%ebp
+  80253a:	53                   	push   %ebx
+  80253b:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80253e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802541:	50                   	push   %eax
+  802542:	e8 23 f8 ff ff       	call   801d6a <fd_alloc>
+  802547:	89 c3                	mov    %eax,%ebx
+  802549:	83 c4 10             	add    $0x10,%esp
+  80254c:	85 c0                	test   %eax,%eax
+  80254e:	78 2a                	js     80257a <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802550:	83 ec 0c             	sub    $0xc,%esp
+  802553:	ff 75 08             	push   0x8(%ebp)
+  802556:	e8 89 e7 ff ff       	call   800ce4 <strlen>
+  80255b:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80255e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802563:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802568:	7e 17                	jle    802581 <open+0x4a>
+	fd_close(fd, 1);
+  80256a:	83 ec 08             	sub    $0x8,%esp
+  80256d:	6a 01                	push   $0x1
+  80256f:	ff 75 f4             	push   -0xc(%ebp)
+  802572:	e8 08 f9 ff ff       	call   801e7f <fd_close>
+	return r;
+  802577:	83 c4 10             	add    $0x10,%esp
+}
+  80257a:	89 d8                	mov    %ebx,%eax
+  80257c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80257f:	c9                   	leave
+  802580:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802581:	83 ec 08             	sub    $0x8,%esp
+  802584:	ff 75 08             	push   0x8(%ebp)
+  802587:	68 00 90 84 00       	push   $0x849000
+  80258c:	e8 9f e7 ff ff       	call   800d30 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802591:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802594:	a3 00 94 84 00       	mov    %eax,0x849400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802599:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80259c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025a1:	e8 07 fe ff ff       	call   8023ad <fsipc>
+  8025a6:	89 c3                	mov    %eax,%ebx
+  8025a8:	83 c4 10             	add    $0x10,%esp
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	78 bb                	js     80256a <open+0x33>
+	return fd2num(fd); 	
+  8025af:	83 ec 0c             	sub    $0xc,%esp
+  8025b2:	ff 75 f4             	push   -0xc(%ebp)
+  8025b5:	e8 89 f7 ff ff       	call   801d43 <fd2num>
+  8025ba:	89 c3                	mov    %eax,%ebx
+  8025bc:	83 c4 10             	add    $0x10,%esp
+  8025bf:	eb b9                	jmp    80257a <open+0x43>
+
+008025c1 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8025c1:	55                   	push   %ebp
+  8025c2:	89 e5                	mov    %esp,%ebp
+  8025c4:	53                   	push   %ebx
+  8025c5:	83 ec 1c             	sub    $0x1c,%esp
+  8025c8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ce:	50                   	push   %eax
+  8025cf:	ff 75 08             	push   0x8(%ebp)
+  8025d2:	e8 e3 f7 ff ff       	call   801dba <fd_lookup>
+  8025d7:	83 c4 10             	add    $0x10,%esp
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	78 5a                	js     802638 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8025de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e1:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8025e7:	39 10                	cmp    %edx,(%eax)
+  8025e9:	75 66                	jne    802651 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8025eb:	83 3d c4 86 84 00 00 	cmpl   $0x0,0x8486c4
+  8025f2:	74 49                	je     80263d <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8025f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025fa:	a3 00 90 84 00       	mov    %eax,0x849000
+	fsipcbuf.map.req_offset = offset;
+  8025ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802602:	a3 04 90 84 00       	mov    %eax,0x849004
+	fsipcbuf.map.req_npages = maxpages;
+  802607:	89 1d 08 90 84 00    	mov    %ebx,0x849008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80260d:	6a 07                	push   $0x7
+  80260f:	68 00 90 84 00       	push   $0x849000
+  802614:	6a 09                	push   $0x9
+  802616:	ff 35 c4 86 84 00    	push   0x8486c4
+  80261c:	e8 d3 1f 00 00       	call   8045f4 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802621:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802628:	6a 00                	push   $0x0
+  80262a:	53                   	push   %ebx
+  80262b:	ff 75 10             	push   0x10(%ebp)
+  80262e:	6a 00                	push   $0x0
+  802630:	e8 fc 1d 00 00       	call   804431 <ipc_recv_pages>
+  802635:	83 c4 20             	add    $0x20,%esp
+}
+  802638:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80263d:	83 ec 0c             	sub    $0xc,%esp
+  802640:	6a 02                	push   $0x2
+  802642:	e8 16 20 00 00       	call   80465d <ipc_find_env>
+  802647:	a3 c4 86 84 00       	mov    %eax,0x8486c4
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	eb a3                	jmp    8025f4 <fmap+0x33>
+		return -E_INVAL;
+  802651:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802656:	eb e0                	jmp    802638 <fmap+0x77>
+
+00802658 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802658:	55                   	push   %ebp
+  802659:	89 e5                	mov    %esp,%ebp
+  80265b:	53                   	push   %ebx
+  80265c:	83 ec 10             	sub    $0x10,%esp
+  80265f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802662:	53                   	push   %ebx
+  802663:	e8 7c e6 ff ff       	call   800ce4 <strlen>
+  802668:	83 c4 10             	add    $0x10,%esp
+  80266b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802670:	7f 25                	jg     802697 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	53                   	push   %ebx
+  802676:	68 00 90 84 00       	push   $0x849000
+  80267b:	e8 b0 e6 ff ff       	call   800d30 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802680:	ba 00 00 00 00       	mov    $0x0,%edx
+  802685:	b8 07 00 00 00       	mov    $0x7,%eax
+  80268a:	e8 1e fd ff ff       	call   8023ad <fsipc>
+  80268f:	83 c4 10             	add    $0x10,%esp
+}
+  802692:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802695:	c9                   	leave
+  802696:	c3                   	ret
+		return -E_BAD_PATH;
+  802697:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80269c:	eb f4                	jmp    802692 <remove+0x3a>
+
+0080269e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80269e:	55                   	push   %ebp
+  80269f:	89 e5                	mov    %esp,%ebp
+  8026a1:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8026a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026ae:	e8 fa fc ff ff       	call   8023ad <fsipc>
+}
+  8026b3:	c9                   	leave
+  8026b4:	c3                   	ret
+
+008026b5 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026b5:	55                   	push   %ebp
+  8026b6:	89 e5                	mov    %esp,%ebp
+  8026b8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026bb:	68 c0 4e 80 00       	push   $0x804ec0
+  8026c0:	ff 75 0c             	push   0xc(%ebp)
+  8026c3:	e8 68 e6 ff ff       	call   800d30 <strcpy>
+	return 0;
+}
+  8026c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+
+008026cf <devsock_close>:
+{
+  8026cf:	55                   	push   %ebp
+  8026d0:	89 e5                	mov    %esp,%ebp
+  8026d2:	53                   	push   %ebx
+  8026d3:	83 ec 10             	sub    $0x10,%esp
+  8026d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026d9:	53                   	push   %ebx
+  8026da:	e8 bd 1f 00 00       	call   80469c <pageref>
+  8026df:	89 c2                	mov    %eax,%edx
+  8026e1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026e4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8026e9:	83 fa 01             	cmp    $0x1,%edx
+  8026ec:	74 05                	je     8026f3 <devsock_close+0x24>
+}
+  8026ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026f1:	c9                   	leave
+  8026f2:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8026f3:	83 ec 0c             	sub    $0xc,%esp
+  8026f6:	ff 73 0c             	push   0xc(%ebx)
+  8026f9:	e8 b0 05 00 00       	call   802cae <nsipc_close>
+  8026fe:	83 c4 10             	add    $0x10,%esp
+  802701:	eb eb                	jmp    8026ee <devsock_close+0x1f>
+
+00802703 <devsock_write>:
+{
+  802703:	55                   	push   %ebp
+  802704:	89 e5                	mov    %esp,%ebp
+  802706:	53                   	push   %ebx
+  802707:	83 ec 14             	sub    $0x14,%esp
+  80270a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80270d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802710:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802713:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802716:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802719:	8b 41 08             	mov    0x8(%ecx),%eax
+  80271c:	c1 f8 09             	sar    $0x9,%eax
+  80271f:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802722:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802728:	77 13                	ja     80273d <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  80272a:	50                   	push   %eax
+  80272b:	52                   	push   %edx
+  80272c:	53                   	push   %ebx
+  80272d:	ff 71 0c             	push   0xc(%ecx)
+  802730:	e8 5c 06 00 00       	call   802d91 <nsipc_send>
+  802735:	83 c4 10             	add    $0x10,%esp
+}
+  802738:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80273b:	c9                   	leave
+  80273c:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80273d:	50                   	push   %eax
+  80273e:	6a 01                	push   $0x1
+  802740:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802743:	50                   	push   %eax
+  802744:	ff 71 0c             	push   0xc(%ecx)
+  802747:	e8 a6 06 00 00       	call   802df2 <nsipc_sendmsg>
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	eb e7                	jmp    802738 <devsock_write+0x35>
+
+00802751 <devsock_read>:
+{
+  802751:	55                   	push   %ebp
+  802752:	89 e5                	mov    %esp,%ebp
+  802754:	53                   	push   %ebx
+  802755:	83 ec 14             	sub    $0x14,%esp
+  802758:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80275b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80275e:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802761:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802764:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802767:	8b 41 08             	mov    0x8(%ecx),%eax
+  80276a:	c1 f8 09             	sar    $0x9,%eax
+  80276d:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802770:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802776:	77 13                	ja     80278b <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802778:	50                   	push   %eax
+  802779:	52                   	push   %edx
+  80277a:	53                   	push   %ebx
+  80277b:	ff 71 0c             	push   0xc(%ecx)
+  80277e:	e8 9c 05 00 00       	call   802d1f <nsipc_recv>
+  802783:	83 c4 10             	add    $0x10,%esp
+}
+  802786:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80278b:	50                   	push   %eax
+  80278c:	6a 01                	push   $0x1
+  80278e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802791:	50                   	push   %eax
+  802792:	ff 71 0c             	push   0xc(%ecx)
+  802795:	e8 02 0a 00 00       	call   80319c <nsipc_recvmsg>
+  80279a:	83 c4 10             	add    $0x10,%esp
+  80279d:	eb e7                	jmp    802786 <devsock_read+0x35>
+
+0080279f <fd2sockid>:
+{
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027a5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027a8:	52                   	push   %edx
+  8027a9:	50                   	push   %eax
+  8027aa:	e8 0b f6 ff ff       	call   801dba <fd_lookup>
+  8027af:	83 c4 10             	add    $0x10,%esp
+  8027b2:	85 c0                	test   %eax,%eax
+  8027b4:	78 10                	js     8027c6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b9:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8027bf:	39 08                	cmp    %ecx,(%eax)
+  8027c1:	75 05                	jne    8027c8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027c3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027c6:	c9                   	leave
+  8027c7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027cd:	eb f7                	jmp    8027c6 <fd2sockid+0x27>
+
+008027cf <sock_flags>:
+{
+  8027cf:	55                   	push   %ebp
+  8027d0:	89 e5                	mov    %esp,%ebp
+  8027d2:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8027d5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027d8:	52                   	push   %edx
+  8027d9:	50                   	push   %eax
+  8027da:	e8 db f5 ff ff       	call   801dba <fd_lookup>
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	78 0e                	js     8027f4 <sock_flags+0x25>
+  8027e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027e9:	8b 40 08             	mov    0x8(%eax),%eax
+  8027ec:	c1 e8 09             	shr    $0x9,%eax
+  8027ef:	83 e0 08             	and    $0x8,%eax
+}
+  8027f2:	c9                   	leave
+  8027f3:	c3                   	ret
+		return 0;
+  8027f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f9:	eb f7                	jmp    8027f2 <sock_flags+0x23>
+
+008027fb <alloc_sockfd>:
+{
+  8027fb:	55                   	push   %ebp
+  8027fc:	89 e5                	mov    %esp,%ebp
+  8027fe:	56                   	push   %esi
+  8027ff:	53                   	push   %ebx
+  802800:	83 ec 1c             	sub    $0x1c,%esp
+  802803:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802805:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802808:	50                   	push   %eax
+  802809:	e8 5c f5 ff ff       	call   801d6a <fd_alloc>
+  80280e:	89 c3                	mov    %eax,%ebx
+  802810:	83 c4 10             	add    $0x10,%esp
+  802813:	85 c0                	test   %eax,%eax
+  802815:	78 43                	js     80285a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802817:	83 ec 04             	sub    $0x4,%esp
+  80281a:	68 07 04 00 00       	push   $0x407
+  80281f:	ff 75 f4             	push   -0xc(%ebp)
+  802822:	6a 00                	push   $0x0
+  802824:	e8 3b e9 ff ff       	call   801164 <sys_page_alloc>
+  802829:	89 c3                	mov    %eax,%ebx
+  80282b:	83 c4 10             	add    $0x10,%esp
+  80282e:	85 c0                	test   %eax,%eax
+  802830:	78 28                	js     80285a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802832:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802835:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  80283b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80283d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802840:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802847:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80284a:	83 ec 0c             	sub    $0xc,%esp
+  80284d:	50                   	push   %eax
+  80284e:	e8 f0 f4 ff ff       	call   801d43 <fd2num>
+  802853:	89 c3                	mov    %eax,%ebx
+  802855:	83 c4 10             	add    $0x10,%esp
+  802858:	eb 0c                	jmp    802866 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80285a:	83 ec 0c             	sub    $0xc,%esp
+  80285d:	56                   	push   %esi
+  80285e:	e8 4b 04 00 00       	call   802cae <nsipc_close>
+		return r;
+  802863:	83 c4 10             	add    $0x10,%esp
+}
+  802866:	89 d8                	mov    %ebx,%eax
+  802868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80286b:	5b                   	pop    %ebx
+  80286c:	5e                   	pop    %esi
+  80286d:	5d                   	pop    %ebp
+  80286e:	c3                   	ret
+
+0080286f <accept>:
+{
+  80286f:	55                   	push   %ebp
+  802870:	89 e5                	mov    %esp,%ebp
+  802872:	56                   	push   %esi
+  802873:	53                   	push   %ebx
+  802874:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802877:	89 f0                	mov    %esi,%eax
+  802879:	e8 21 ff ff ff       	call   80279f <fd2sockid>
+  80287e:	89 c3                	mov    %eax,%ebx
+  802880:	85 c0                	test   %eax,%eax
+  802882:	78 24                	js     8028a8 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802884:	89 f0                	mov    %esi,%eax
+  802886:	e8 44 ff ff ff       	call   8027cf <sock_flags>
+  80288b:	50                   	push   %eax
+  80288c:	ff 75 10             	push   0x10(%ebp)
+  80288f:	ff 75 0c             	push   0xc(%ebp)
+  802892:	53                   	push   %ebx
+  802893:	e8 6b 03 00 00       	call   802c03 <nsipc_accept>
+  802898:	89 c3                	mov    %eax,%ebx
+  80289a:	83 c4 10             	add    $0x10,%esp
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 07                	js     8028a8 <accept+0x39>
+	return alloc_sockfd(r);
+  8028a1:	e8 55 ff ff ff       	call   8027fb <alloc_sockfd>
+  8028a6:	89 c3                	mov    %eax,%ebx
+}
+  8028a8:	89 d8                	mov    %ebx,%eax
+  8028aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ad:	5b                   	pop    %ebx
+  8028ae:	5e                   	pop    %esi
+  8028af:	5d                   	pop    %ebp
+  8028b0:	c3                   	ret
+
+008028b1 <bind>:
+{
+  8028b1:	55                   	push   %ebp
+  8028b2:	89 e5                	mov    %esp,%ebp
+  8028b4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ba:	e8 e0 fe ff ff       	call   80279f <fd2sockid>
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	78 12                	js     8028d5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028c3:	83 ec 04             	sub    $0x4,%esp
+  8028c6:	ff 75 10             	push   0x10(%ebp)
+  8028c9:	ff 75 0c             	push   0xc(%ebp)
+  8028cc:	50                   	push   %eax
+  8028cd:	e8 85 03 00 00       	call   802c57 <nsipc_bind>
+  8028d2:	83 c4 10             	add    $0x10,%esp
+}
+  8028d5:	c9                   	leave
+  8028d6:	c3                   	ret
+
+008028d7 <shutdown>:
+{
+  8028d7:	55                   	push   %ebp
+  8028d8:	89 e5                	mov    %esp,%ebp
+  8028da:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e0:	e8 ba fe ff ff       	call   80279f <fd2sockid>
+  8028e5:	85 c0                	test   %eax,%eax
+  8028e7:	78 0f                	js     8028f8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028e9:	83 ec 08             	sub    $0x8,%esp
+  8028ec:	ff 75 0c             	push   0xc(%ebp)
+  8028ef:	50                   	push   %eax
+  8028f0:	e8 97 03 00 00       	call   802c8c <nsipc_shutdown>
+  8028f5:	83 c4 10             	add    $0x10,%esp
+}
+  8028f8:	c9                   	leave
+  8028f9:	c3                   	ret
+
+008028fa <connect>:
+{
+  8028fa:	55                   	push   %ebp
+  8028fb:	89 e5                	mov    %esp,%ebp
+  8028fd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802900:	8b 45 08             	mov    0x8(%ebp),%eax
+  802903:	e8 97 fe ff ff       	call   80279f <fd2sockid>
+  802908:	85 c0                	test   %eax,%eax
+  80290a:	78 12                	js     80291e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80290c:	83 ec 04             	sub    $0x4,%esp
+  80290f:	ff 75 10             	push   0x10(%ebp)
+  802912:	ff 75 0c             	push   0xc(%ebp)
+  802915:	50                   	push   %eax
+  802916:	e8 ad 03 00 00       	call   802cc8 <nsipc_connect>
+  80291b:	83 c4 10             	add    $0x10,%esp
+}
+  80291e:	c9                   	leave
+  80291f:	c3                   	ret
+
+00802920 <listen>:
+{
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802926:	8b 45 08             	mov    0x8(%ebp),%eax
+  802929:	e8 71 fe ff ff       	call   80279f <fd2sockid>
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	78 0f                	js     802941 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802932:	83 ec 08             	sub    $0x8,%esp
+  802935:	ff 75 0c             	push   0xc(%ebp)
+  802938:	50                   	push   %eax
+  802939:	e8 bf 03 00 00       	call   802cfd <nsipc_listen>
+  80293e:	83 c4 10             	add    $0x10,%esp
+}
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+00802943 <sendmsg>:
+{
+  802943:	55                   	push   %ebp
+  802944:	89 e5                	mov    %esp,%ebp
+  802946:	57                   	push   %edi
+  802947:	56                   	push   %esi
+  802948:	53                   	push   %ebx
+  802949:	83 ec 0c             	sub    $0xc,%esp
+  80294c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80294f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802952:	89 f0                	mov    %esi,%eax
+  802954:	e8 46 fe ff ff       	call   80279f <fd2sockid>
+  802959:	89 c3                	mov    %eax,%ebx
+  80295b:	85 c0                	test   %eax,%eax
+  80295d:	78 1c                	js     80297b <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80295f:	89 f0                	mov    %esi,%eax
+  802961:	e8 69 fe ff ff       	call   8027cf <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802966:	0b 45 10             	or     0x10(%ebp),%eax
+  802969:	50                   	push   %eax
+  80296a:	ff 77 0c             	push   0xc(%edi)
+  80296d:	ff 77 08             	push   0x8(%edi)
+  802970:	53                   	push   %ebx
+  802971:	e8 7c 04 00 00       	call   802df2 <nsipc_sendmsg>
+  802976:	89 c3                	mov    %eax,%ebx
+  802978:	83 c4 10             	add    $0x10,%esp
+}
+  80297b:	89 d8                	mov    %ebx,%eax
+  80297d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802980:	5b                   	pop    %ebx
+  802981:	5e                   	pop    %esi
+  802982:	5f                   	pop    %edi
+  802983:	5d                   	pop    %ebp
+  802984:	c3                   	ret
+
+00802985 <recvmsg>:
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	57                   	push   %edi
+  802989:	56                   	push   %esi
+  80298a:	53                   	push   %ebx
+  80298b:	83 ec 0c             	sub    $0xc,%esp
+  80298e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802991:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802994:	89 f8                	mov    %edi,%eax
+  802996:	e8 04 fe ff ff       	call   80279f <fd2sockid>
+  80299b:	89 c3                	mov    %eax,%ebx
+  80299d:	85 c0                	test   %eax,%eax
+  80299f:	78 2a                	js     8029cb <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8029a1:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8029a8:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8029af:	89 f8                	mov    %edi,%eax
+  8029b1:	e8 19 fe ff ff       	call   8027cf <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8029b6:	0b 45 10             	or     0x10(%ebp),%eax
+  8029b9:	50                   	push   %eax
+  8029ba:	ff 76 0c             	push   0xc(%esi)
+  8029bd:	ff 76 08             	push   0x8(%esi)
+  8029c0:	53                   	push   %ebx
+  8029c1:	e8 d6 07 00 00       	call   80319c <nsipc_recvmsg>
+  8029c6:	89 c3                	mov    %eax,%ebx
+  8029c8:	83 c4 10             	add    $0x10,%esp
+}
+  8029cb:	89 d8                	mov    %ebx,%eax
+  8029cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029d0:	5b                   	pop    %ebx
+  8029d1:	5e                   	pop    %esi
+  8029d2:	5f                   	pop    %edi
+  8029d3:	5d                   	pop    %ebp
+  8029d4:	c3                   	ret
+
+008029d5 <sendfile>:
+{
+  8029d5:	55                   	push   %ebp
+  8029d6:	89 e5                	mov    %esp,%ebp
+  8029d8:	56                   	push   %esi
+  8029d9:	53                   	push   %ebx
+  8029da:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8029dd:	89 f0                	mov    %esi,%eax
+  8029df:	e8 bb fd ff ff       	call   80279f <fd2sockid>
+  8029e4:	89 c3                	mov    %eax,%ebx
+  8029e6:	85 c0                	test   %eax,%eax
+  8029e8:	78 1f                	js     802a09 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8029ea:	89 f0                	mov    %esi,%eax
+  8029ec:	e8 de fd ff ff       	call   8027cf <sock_flags>
+  8029f1:	83 ec 0c             	sub    $0xc,%esp
+  8029f4:	50                   	push   %eax
+  8029f5:	ff 75 14             	push   0x14(%ebp)
+  8029f8:	ff 75 10             	push   0x10(%ebp)
+  8029fb:	ff 75 0c             	push   0xc(%ebp)
+  8029fe:	53                   	push   %ebx
+  8029ff:	e8 64 06 00 00       	call   803068 <nsipc_sendfile>
+  802a04:	89 c3                	mov    %eax,%ebx
+  802a06:	83 c4 20             	add    $0x20,%esp
+}
+  802a09:	89 d8                	mov    %ebx,%eax
+  802a0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a0e:	5b                   	pop    %ebx
+  802a0f:	5e                   	pop    %esi
+  802a10:	5d                   	pop    %ebp
+  802a11:	c3                   	ret
+
+00802a12 <evctl>:
+{
+  802a12:	55                   	push   %ebp
+  802a13:	89 e5                	mov    %esp,%ebp
+  802a15:	53                   	push   %ebx
+  802a16:	83 ec 04             	sub    $0x4,%esp
+  802a19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802a1c:	89 d8                	mov    %ebx,%eax
+  802a1e:	e8 7c fd ff ff       	call   80279f <fd2sockid>
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 10                	js     802a37 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802a27:	83 ec 04             	sub    $0x4,%esp
+  802a2a:	53                   	push   %ebx
+  802a2b:	ff 75 0c             	push   0xc(%ebp)
+  802a2e:	50                   	push   %eax
+  802a2f:	e8 d2 0b 00 00       	call   803606 <nsipc_evctl>
+  802a34:	83 c4 10             	add    $0x10,%esp
+}
+  802a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+00802a3c <evwait>:
+{
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802a42:	ff 75 10             	push   0x10(%ebp)
+  802a45:	ff 75 0c             	push   0xc(%ebp)
+  802a48:	ff 75 08             	push   0x8(%ebp)
+  802a4b:	e8 e0 0b 00 00       	call   803630 <nsipc_evwait>
+}
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+
+00802a52 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a52:	55                   	push   %ebp
+  802a53:	89 e5                	mov    %esp,%ebp
+  802a55:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a58:	ff 75 10             	push   0x10(%ebp)
+  802a5b:	ff 75 0c             	push   0xc(%ebp)
+  802a5e:	ff 75 08             	push   0x8(%ebp)
+  802a61:	e8 31 0c 00 00       	call   803697 <nsipc_socket>
+  802a66:	83 c4 10             	add    $0x10,%esp
+  802a69:	85 c0                	test   %eax,%eax
+  802a6b:	78 05                	js     802a72 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a6d:	e8 89 fd ff ff       	call   8027fb <alloc_sockfd>
+}
+  802a72:	c9                   	leave
+  802a73:	c3                   	ret
+
+00802a74 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a74:	55                   	push   %ebp
+  802a75:	89 e5                	mov    %esp,%ebp
+  802a77:	53                   	push   %ebx
+  802a78:	83 ec 04             	sub    $0x4,%esp
+  802a7b:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802a7d:	83 3d e4 89 84 00 00 	cmpl   $0x0,0x8489e4
+  802a84:	74 26                	je     802aac <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a86:	6a 07                	push   $0x7
+  802a88:	68 00 a0 84 00       	push   $0x84a000
+  802a8d:	53                   	push   %ebx
+  802a8e:	ff 35 e4 89 84 00    	push   0x8489e4
+  802a94:	e8 5b 1b 00 00       	call   8045f4 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a99:	83 c4 0c             	add    $0xc,%esp
+  802a9c:	6a 00                	push   $0x0
+  802a9e:	6a 00                	push   $0x0
+  802aa0:	6a 00                	push   $0x0
+  802aa2:	e8 bd 18 00 00       	call   804364 <ipc_recv>
+}
+  802aa7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aaa:	c9                   	leave
+  802aab:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802aac:	83 ec 0c             	sub    $0xc,%esp
+  802aaf:	6a 03                	push   $0x3
+  802ab1:	e8 a7 1b 00 00       	call   80465d <ipc_find_env>
+  802ab6:	a3 e4 89 84 00       	mov    %eax,0x8489e4
+  802abb:	83 c4 10             	add    $0x10,%esp
+  802abe:	eb c6                	jmp    802a86 <nsipc+0x12>
+
+00802ac0 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802ac0:	55                   	push   %ebp
+  802ac1:	89 e5                	mov    %esp,%ebp
+  802ac3:	56                   	push   %esi
+  802ac4:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802ac5:	8b 35 f0 89 84 00    	mov    0x8489f0,%esi
+		return 0;
+  802acb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802ad0:	85 f6                	test   %esi,%esi
+  802ad2:	75 33                	jne    802b07 <nsbulk_map+0x47>
+  802ad4:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802ad9:	83 ec 04             	sub    $0x4,%esp
+  802adc:	6a 07                	push   $0x7
+  802ade:	53                   	push   %ebx
+  802adf:	6a 00                	push   $0x0
+  802ae1:	e8 7e e6 ff ff       	call   801164 <sys_page_alloc>
+  802ae6:	83 c4 10             	add    $0x10,%esp
+  802ae9:	85 c0                	test   %eax,%eax
+  802aeb:	78 1a                	js     802b07 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802aed:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802af3:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802af9:	75 de                	jne    802ad9 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802afb:	c7 05 f0 89 84 00 01 	movl   $0x1,0x8489f0
+  802b02:	00 00 00 
+	return 0;
+  802b05:	89 f0                	mov    %esi,%eax
+}
+  802b07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b0a:	5b                   	pop    %ebx
+  802b0b:	5e                   	pop    %esi
+  802b0c:	5d                   	pop    %ebp
+  802b0d:	c3                   	ret
+
+00802b0e <nsbulk_own>:
+{
+  802b0e:	55                   	push   %ebp
+  802b0f:	89 e5                	mov    %esp,%ebp
+  802b11:	57                   	push   %edi
+  802b12:	56                   	push   %esi
+  802b13:	53                   	push   %ebx
+  802b14:	83 ec 0c             	sub    $0xc,%esp
+  802b17:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802b19:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802b1c:	85 d2                	test   %edx,%edx
+  802b1e:	7f 0e                	jg     802b2e <nsbulk_own+0x20>
+	return 0;
+  802b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b25:	eb 47                	jmp    802b6e <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802b27:	83 c3 01             	add    $0x1,%ebx
+  802b2a:	39 fb                	cmp    %edi,%ebx
+  802b2c:	7d 3b                	jge    802b69 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802b2e:	be 01 00 00 00       	mov    $0x1,%esi
+  802b33:	89 d9                	mov    %ebx,%ecx
+  802b35:	d3 e6                	shl    %cl,%esi
+  802b37:	89 f0                	mov    %esi,%eax
+  802b39:	23 05 ec 89 84 00    	and    0x8489ec,%eax
+  802b3f:	74 e6                	je     802b27 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802b41:	83 ec 04             	sub    $0x4,%esp
+  802b44:	6a 07                	push   $0x7
+  802b46:	89 d8                	mov    %ebx,%eax
+  802b48:	c1 e0 0c             	shl    $0xc,%eax
+  802b4b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b50:	50                   	push   %eax
+  802b51:	6a 00                	push   $0x0
+  802b53:	e8 0c e6 ff ff       	call   801164 <sys_page_alloc>
+  802b58:	83 c4 10             	add    $0x10,%esp
+  802b5b:	85 c0                	test   %eax,%eax
+  802b5d:	78 0f                	js     802b6e <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802b5f:	f7 d6                	not    %esi
+  802b61:	21 35 ec 89 84 00    	and    %esi,0x8489ec
+  802b67:	eb be                	jmp    802b27 <nsbulk_own+0x19>
+	return 0;
+  802b69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b71:	5b                   	pop    %ebx
+  802b72:	5e                   	pop    %esi
+  802b73:	5f                   	pop    %edi
+  802b74:	5d                   	pop    %ebp
+  802b75:	c3                   	ret
+
+00802b76 <nsipc_bulk>:
+{
+  802b76:	55                   	push   %ebp
+  802b77:	89 e5                	mov    %esp,%ebp
+  802b79:	57                   	push   %edi
+  802b7a:	56                   	push   %esi
+  802b7b:	53                   	push   %ebx
+  802b7c:	83 ec 1c             	sub    $0x1c,%esp
+  802b7f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b82:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802b84:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802b8a:	c1 fb 0c             	sar    $0xc,%ebx
+  802b8d:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802b90:	83 3d e4 89 84 00 00 	cmpl   $0x0,0x8489e4
+  802b97:	74 56                	je     802bef <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802b99:	85 ff                	test   %edi,%edi
+  802b9b:	7e 24                	jle    802bc1 <nsipc_bulk+0x4b>
+  802b9d:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802ba3:	74 1c                	je     802bc1 <nsipc_bulk+0x4b>
+  802ba5:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802bab:	c1 e3 0c             	shl    $0xc,%ebx
+  802bae:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802bb3:	0f b6 10             	movzbl (%eax),%edx
+  802bb6:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802bb8:	05 00 10 00 00       	add    $0x1000,%eax
+  802bbd:	39 d8                	cmp    %ebx,%eax
+  802bbf:	75 f2                	jne    802bb3 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802bc1:	83 ec 0c             	sub    $0xc,%esp
+  802bc4:	56                   	push   %esi
+  802bc5:	57                   	push   %edi
+  802bc6:	68 00 00 00 e0       	push   $0xe0000000
+  802bcb:	ff 75 e4             	push   -0x1c(%ebp)
+  802bce:	ff 35 e4 89 84 00    	push   0x8489e4
+  802bd4:	e8 4f 1a 00 00       	call   804628 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802bd9:	83 c4 1c             	add    $0x1c,%esp
+  802bdc:	6a 00                	push   $0x0
+  802bde:	6a 00                	push   $0x0
+  802be0:	6a 00                	push   $0x0
+  802be2:	e8 7d 17 00 00       	call   804364 <ipc_recv>
+}
+  802be7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bea:	5b                   	pop    %ebx
+  802beb:	5e                   	pop    %esi
+  802bec:	5f                   	pop    %edi
+  802bed:	5d                   	pop    %ebp
+  802bee:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bef:	83 ec 0c             	sub    $0xc,%esp
+  802bf2:	6a 03                	push   $0x3
+  802bf4:	e8 64 1a 00 00       	call   80465d <ipc_find_env>
+  802bf9:	a3 e4 89 84 00       	mov    %eax,0x8489e4
+  802bfe:	83 c4 10             	add    $0x10,%esp
+  802c01:	eb 96                	jmp    802b99 <nsipc_bulk+0x23>
+
+00802c03 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	53                   	push   %ebx
+  802c07:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0d:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.accept.req_flags = flags;
+  802c12:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c15:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c1f:	e8 50 fe ff ff       	call   802a74 <nsipc>
+  802c24:	89 c3                	mov    %eax,%ebx
+  802c26:	85 c0                	test   %eax,%eax
+  802c28:	79 07                	jns    802c31 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c2a:	89 d8                	mov    %ebx,%eax
+  802c2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2f:	c9                   	leave
+  802c30:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c31:	83 ec 04             	sub    $0x4,%esp
+  802c34:	ff 35 10 a0 84 00    	push   0x84a010
+  802c3a:	68 00 a0 84 00       	push   $0x84a000
+  802c3f:	ff 75 0c             	push   0xc(%ebp)
+  802c42:	e8 99 e2 ff ff       	call   800ee0 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c47:	8b 15 10 a0 84 00    	mov    0x84a010,%edx
+  802c4d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c50:	89 10                	mov    %edx,(%eax)
+  802c52:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c55:	eb d3                	jmp    802c2a <nsipc_accept+0x27>
+
+00802c57 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	53                   	push   %ebx
+  802c5b:	83 ec 08             	sub    $0x8,%esp
+  802c5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c64:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c69:	53                   	push   %ebx
+  802c6a:	ff 75 0c             	push   0xc(%ebp)
+  802c6d:	68 04 a0 84 00       	push   $0x84a004
+  802c72:	e8 69 e2 ff ff       	call   800ee0 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c77:	89 1d 14 a0 84 00    	mov    %ebx,0x84a014
+	return nsipc(NSREQ_BIND);
+  802c7d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c82:	e8 ed fd ff ff       	call   802a74 <nsipc>
+}
+  802c87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c8a:	c9                   	leave
+  802c8b:	c3                   	ret
+
+00802c8c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c8c:	55                   	push   %ebp
+  802c8d:	89 e5                	mov    %esp,%ebp
+  802c8f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c95:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.shutdown.req_how = how;
+  802c9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c9d:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ca2:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ca7:	e8 c8 fd ff ff       	call   802a74 <nsipc>
+}
+  802cac:	c9                   	leave
+  802cad:	c3                   	ret
+
+00802cae <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802cb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb7:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	return nsipc(NSREQ_CLOSE);
+  802cbc:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cc1:	e8 ae fd ff ff       	call   802a74 <nsipc>
+}
+  802cc6:	c9                   	leave
+  802cc7:	c3                   	ret
+
+00802cc8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802cc8:	55                   	push   %ebp
+  802cc9:	89 e5                	mov    %esp,%ebp
+  802ccb:	53                   	push   %ebx
+  802ccc:	83 ec 08             	sub    $0x8,%esp
+  802ccf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd5:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802cda:	53                   	push   %ebx
+  802cdb:	ff 75 0c             	push   0xc(%ebp)
+  802cde:	68 04 a0 84 00       	push   $0x84a004
+  802ce3:	e8 f8 e1 ff ff       	call   800ee0 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ce8:	89 1d 14 a0 84 00    	mov    %ebx,0x84a014
+	return nsipc(NSREQ_CONNECT);
+  802cee:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cf3:	e8 7c fd ff ff       	call   802a74 <nsipc>
+}
+  802cf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cfb:	c9                   	leave
+  802cfc:	c3                   	ret
+
+00802cfd <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802cfd:	55                   	push   %ebp
+  802cfe:	89 e5                	mov    %esp,%ebp
+  802d00:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d06:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d0e:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	return nsipc(NSREQ_LISTEN);
+  802d13:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d18:	e8 57 fd ff ff       	call   802a74 <nsipc>
+}
+  802d1d:	c9                   	leave
+  802d1e:	c3                   	ret
+
+00802d1f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d1f:	55                   	push   %ebp
+  802d20:	89 e5                	mov    %esp,%ebp
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2a:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.recv.req_len = len;
+  802d2f:	89 35 04 a0 84 00    	mov    %esi,0x84a004
+	nsipcbuf.recv.req_flags = flags;
+  802d35:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d38:	a3 08 a0 84 00       	mov    %eax,0x84a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d3d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d42:	e8 2d fd ff ff       	call   802a74 <nsipc>
+  802d47:	89 c3                	mov    %eax,%ebx
+  802d49:	85 c0                	test   %eax,%eax
+  802d4b:	78 22                	js     802d6f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d4d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d52:	39 c6                	cmp    %eax,%esi
+  802d54:	0f 4e c6             	cmovle %esi,%eax
+  802d57:	39 c3                	cmp    %eax,%ebx
+  802d59:	7f 1d                	jg     802d78 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d5b:	83 ec 04             	sub    $0x4,%esp
+  802d5e:	53                   	push   %ebx
+  802d5f:	68 00 a0 84 00       	push   $0x84a000
+  802d64:	ff 75 0c             	push   0xc(%ebp)
+  802d67:	e8 74 e1 ff ff       	call   800ee0 <memmove>
+  802d6c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d6f:	89 d8                	mov    %ebx,%eax
+  802d71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d74:	5b                   	pop    %ebx
+  802d75:	5e                   	pop    %esi
+  802d76:	5d                   	pop    %ebp
+  802d77:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d78:	68 cc 4e 80 00       	push   $0x804ecc
+  802d7d:	68 e1 4e 80 00       	push   $0x804ee1
+  802d82:	68 b2 00 00 00       	push   $0xb2
+  802d87:	68 f6 4e 80 00       	push   $0x804ef6
+  802d8c:	e8 cd d7 ff ff       	call   80055e <_panic>
+
+00802d91 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d91:	55                   	push   %ebp
+  802d92:	89 e5                	mov    %esp,%ebp
+  802d94:	53                   	push   %ebx
+  802d95:	83 ec 04             	sub    $0x4,%esp
+  802d98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9e:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	assert(size < 1600);
+  802da3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802da9:	7f 2e                	jg     802dd9 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802dab:	83 ec 04             	sub    $0x4,%esp
+  802dae:	53                   	push   %ebx
+  802daf:	ff 75 0c             	push   0xc(%ebp)
+  802db2:	68 0c a0 84 00       	push   $0x84a00c
+  802db7:	e8 24 e1 ff ff       	call   800ee0 <memmove>
+	nsipcbuf.send.req_size = size;
+  802dbc:	89 1d 04 a0 84 00    	mov    %ebx,0x84a004
+	nsipcbuf.send.req_flags = flags;
+  802dc2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dc5:	a3 08 a0 84 00       	mov    %eax,0x84a008
+	return nsipc(NSREQ_SEND);
+  802dca:	b8 08 00 00 00       	mov    $0x8,%eax
+  802dcf:	e8 a0 fc ff ff       	call   802a74 <nsipc>
+}
+  802dd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dd7:	c9                   	leave
+  802dd8:	c3                   	ret
+	assert(size < 1600);
+  802dd9:	68 02 4f 80 00       	push   $0x804f02
+  802dde:	68 e1 4e 80 00       	push   $0x804ee1
+  802de3:	68 bd 00 00 00       	push   $0xbd
+  802de8:	68 f6 4e 80 00       	push   $0x804ef6
+  802ded:	e8 6c d7 ff ff       	call   80055e <_panic>
+
+00802df2 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802df2:	55                   	push   %ebp
+  802df3:	89 e5                	mov    %esp,%ebp
+  802df5:	57                   	push   %edi
+  802df6:	56                   	push   %esi
+  802df7:	53                   	push   %ebx
+  802df8:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802dfb:	e8 c0 fc ff ff       	call   802ac0 <nsbulk_map>
+  802e00:	85 c0                	test   %eax,%eax
+  802e02:	78 55                	js     802e59 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802e04:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802e0b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802e12:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e19:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e1c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e1f:	0f 8d 24 02 00 00    	jge    803049 <nsipc_sendmsg+0x257>
+  802e25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e28:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e2b:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802e2e:	89 d8                	mov    %ebx,%eax
+  802e30:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e35:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802e37:	83 ec 0c             	sub    $0xc,%esp
+  802e3a:	68 e0 86 84 00       	push   $0x8486e0
+  802e3f:	e8 bc 0f 00 00       	call   803e00 <pgbatch_init>
+  802e44:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e47:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802e49:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802e4c:	e9 82 00 00 00       	jmp    802ed3 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802e51:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e54:	85 db                	test   %ebx,%ebx
+  802e56:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802e59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e5c:	5b                   	pop    %ebx
+  802e5d:	5e                   	pop    %esi
+  802e5e:	5f                   	pop    %edi
+  802e5f:	5d                   	pop    %ebp
+  802e60:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802e61:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802e66:	29 c8                	sub    %ecx,%eax
+  802e68:	39 d0                	cmp    %edx,%eax
+  802e6a:	0f 46 d0             	cmovbe %eax,%edx
+  802e6d:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802e6f:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e75:	85 ff                	test   %edi,%edi
+  802e77:	0f 49 c7             	cmovns %edi,%eax
+  802e7a:	c1 f8 0c             	sar    $0xc,%eax
+  802e7d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e82:	e8 87 fc ff ff       	call   802b0e <nsbulk_own>
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	0f 88 17 01 00 00    	js     802fa6 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802e8f:	83 ec 04             	sub    $0x4,%esp
+  802e92:	56                   	push   %esi
+  802e93:	ff 75 e0             	push   -0x20(%ebp)
+  802e96:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802e99:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e9e:	50                   	push   %eax
+  802e9f:	e8 3c e0 ff ff       	call   800ee0 <memmove>
+  802ea4:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802ea7:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802eaa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ead:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802eb0:	0f 84 fd 00 00 00    	je     802fb3 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802eb6:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802eb9:	01 f7                	add    %esi,%edi
+  802ebb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ebe:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ec1:	0f 8d 01 01 00 00    	jge    802fc8 <nsipc_sendmsg+0x1d6>
+  802ec7:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802ecd:	0f 8f f0 00 00 00    	jg     802fc3 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802ed3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ed6:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802ed9:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802edc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802edf:	89 c2                	mov    %eax,%edx
+  802ee1:	03 13                	add    (%ebx),%edx
+  802ee3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802ee6:	8b 73 04             	mov    0x4(%ebx),%esi
+  802ee9:	29 c6                	sub    %eax,%esi
+  802eeb:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802ef0:	29 f9                	sub    %edi,%ecx
+  802ef2:	39 ce                	cmp    %ecx,%esi
+  802ef4:	89 ca                	mov    %ecx,%edx
+  802ef6:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802ef9:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802efc:	89 f9                	mov    %edi,%ecx
+  802efe:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802f04:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f07:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f0c:	09 c8                	or     %ecx,%eax
+  802f0e:	0f 85 4d ff ff ff    	jne    802e61 <nsipc_sendmsg+0x6f>
+  802f14:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802f1a:	0f 86 41 ff ff ff    	jbe    802e61 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f20:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802f26:	85 ff                	test   %edi,%edi
+  802f28:	0f 49 c7             	cmovns %edi,%eax
+  802f2b:	c1 f8 0c             	sar    $0xc,%eax
+  802f2e:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f30:	89 d1                	mov    %edx,%ecx
+  802f32:	c1 e9 0c             	shr    $0xc,%ecx
+  802f35:	01 c8                	add    %ecx,%eax
+  802f37:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f3a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f3d:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802f3f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f42:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f47:	29 c8                	sub    %ecx,%eax
+  802f49:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f4c:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802f4f:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f51:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f56:	89 f9                	mov    %edi,%ecx
+  802f58:	d3 e0                	shl    %cl,%eax
+  802f5a:	09 05 ec 89 84 00    	or     %eax,0x8489ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f60:	83 ec 08             	sub    $0x8,%esp
+  802f63:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802f65:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f68:	50                   	push   %eax
+  802f69:	6a 00                	push   $0x0
+  802f6b:	56                   	push   %esi
+  802f6c:	6a 00                	push   $0x0
+  802f6e:	68 e0 86 84 00       	push   $0x8486e0
+  802f73:	e8 46 0f 00 00       	call   803ebe <pgbatch_map>
+  802f78:	83 c4 20             	add    $0x20,%esp
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	0f 88 ce fe ff ff    	js     802e51 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f83:	83 c7 01             	add    $0x1,%edi
+  802f86:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f8c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802f8f:	39 c7                	cmp    %eax,%edi
+  802f91:	75 be                	jne    802f51 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802f93:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f96:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802f99:	89 d6                	mov    %edx,%esi
+  802f9b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802fa1:	e9 01 ff ff ff       	jmp    802ea7 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802fa6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802fa9:	85 db                	test   %ebx,%ebx
+  802fab:	0f 45 c3             	cmovne %ebx,%eax
+  802fae:	e9 a6 fe ff ff       	jmp    802e59 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802fb3:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802fb7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802fbe:	e9 f3 fe ff ff       	jmp    802eb6 <nsipc_sendmsg+0xc4>
+  802fc3:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802fc6:	eb 03                	jmp    802fcb <nsipc_sendmsg+0x1d9>
+  802fc8:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802fcb:	83 ec 0c             	sub    $0xc,%esp
+  802fce:	68 e0 86 84 00       	push   $0x8486e0
+  802fd3:	e8 36 0e 00 00       	call   803e0e <pgbatch_flush>
+  802fd8:	83 c4 10             	add    $0x10,%esp
+  802fdb:	85 c0                	test   %eax,%eax
+  802fdd:	78 50                	js     80302f <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe2:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802fe7:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802fed:	89 fb                	mov    %edi,%ebx
+  802fef:	29 f3                	sub    %esi,%ebx
+  802ff1:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802ff7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ffa:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802fff:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803004:	89 fa                	mov    %edi,%edx
+  803006:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80300b:	e8 66 fb ff ff       	call   802b76 <nsipc_bulk>
+  803010:	85 c0                	test   %eax,%eax
+  803012:	78 28                	js     80303c <nsipc_sendmsg+0x24a>
+		sent += r;
+  803014:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  803017:	39 c3                	cmp    %eax,%ebx
+  803019:	75 0c                	jne    803027 <nsipc_sendmsg+0x235>
+  80301b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80301e:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803021:	0f 8f f2 fd ff ff    	jg     802e19 <nsipc_sendmsg+0x27>
+		sent += r;
+  803027:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80302a:	e9 2a fe ff ff       	jmp    802e59 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80302f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803032:	85 db                	test   %ebx,%ebx
+  803034:	0f 45 c3             	cmovne %ebx,%eax
+  803037:	e9 1d fe ff ff       	jmp    802e59 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80303c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80303f:	85 db                	test   %ebx,%ebx
+  803041:	0f 45 c3             	cmovne %ebx,%eax
+  803044:	e9 10 fe ff ff       	jmp    802e59 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803049:	83 ec 0c             	sub    $0xc,%esp
+  80304c:	68 e0 86 84 00       	push   $0x8486e0
+  803051:	e8 aa 0d 00 00       	call   803e00 <pgbatch_init>
+  803056:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803059:	be 00 00 00 00       	mov    $0x0,%esi
+  80305e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803063:	e9 63 ff ff ff       	jmp    802fcb <nsipc_sendmsg+0x1d9>
+
+00803068 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803068:	55                   	push   %ebp
+  803069:	89 e5                	mov    %esp,%ebp
+  80306b:	57                   	push   %edi
+  80306c:	56                   	push   %esi
+  80306d:	53                   	push   %ebx
+  80306e:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  803071:	83 3d e8 89 84 00 00 	cmpl   $0x0,0x8489e8
+  803078:	0f 84 c8 00 00 00    	je     803146 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80307e:	83 3d e4 89 84 00 00 	cmpl   $0x0,0x8489e4
+  803085:	0f 84 e4 00 00 00    	je     80316f <nsipc_sendfile+0x107>
+{
+  80308b:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  803090:	89 fb                	mov    %edi,%ebx
+  803092:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  803095:	0f 83 f0 00 00 00    	jae    80318b <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80309b:	89 fa                	mov    %edi,%edx
+  80309d:	03 55 10             	add    0x10(%ebp),%edx
+  8030a0:	89 d0                	mov    %edx,%eax
+  8030a2:	c1 f8 1f             	sar    $0x1f,%eax
+  8030a5:	c1 e8 14             	shr    $0x14,%eax
+  8030a8:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8030ab:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8030b1:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8030b3:	6a 10                	push   $0x10
+  8030b5:	68 00 20 01 e0       	push   $0xe0012000
+  8030ba:	52                   	push   %edx
+  8030bb:	ff 75 0c             	push   0xc(%ebp)
+  8030be:	e8 fe f4 ff ff       	call   8025c1 <fmap>
+  8030c3:	83 c4 10             	add    $0x10,%esp
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	0f 8e b8 00 00 00    	jle    803186 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8030ce:	39 c6                	cmp    %eax,%esi
+  8030d0:	0f 8d b5 00 00 00    	jge    80318b <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8030d6:	29 f0                	sub    %esi,%eax
+  8030d8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8030db:	29 da                	sub    %ebx,%edx
+  8030dd:	39 d0                	cmp    %edx,%eax
+  8030df:	89 d3                	mov    %edx,%ebx
+  8030e1:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8030e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e7:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8030ec:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8030f2:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8030f8:	8b 45 18             	mov    0x18(%ebp),%eax
+  8030fb:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803100:	83 ec 0c             	sub    $0xc,%esp
+  803103:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  803105:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  80310c:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80310f:	83 c0 01             	add    $0x1,%eax
+  803112:	50                   	push   %eax
+  803113:	68 00 10 01 e0       	push   $0xe0011000
+  803118:	6a 11                	push   $0x11
+  80311a:	ff 35 e4 89 84 00    	push   0x8489e4
+  803120:	e8 03 15 00 00       	call   804628 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803125:	83 c4 1c             	add    $0x1c,%esp
+  803128:	6a 00                	push   $0x0
+  80312a:	6a 00                	push   $0x0
+  80312c:	6a 00                	push   $0x0
+  80312e:	e8 31 12 00 00       	call   804364 <ipc_recv>
+  803133:	83 c4 10             	add    $0x10,%esp
+  803136:	85 c0                	test   %eax,%eax
+  803138:	78 5b                	js     803195 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  80313a:	01 c7                	add    %eax,%edi
+		if (r < n)
+  80313c:	39 c3                	cmp    %eax,%ebx
+  80313e:	0f 8e 4c ff ff ff    	jle    803090 <nsipc_sendfile+0x28>
+  803144:	eb 45                	jmp    80318b <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803146:	83 ec 04             	sub    $0x4,%esp
+  803149:	6a 07                	push   $0x7
+  80314b:	68 00 10 01 e0       	push   $0xe0011000
+  803150:	6a 00                	push   $0x0
+  803152:	e8 0d e0 ff ff       	call   801164 <sys_page_alloc>
+  803157:	89 c7                	mov    %eax,%edi
+  803159:	83 c4 10             	add    $0x10,%esp
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	78 2b                	js     80318b <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803160:	c7 05 e8 89 84 00 01 	movl   $0x1,0x8489e8
+  803167:	00 00 00 
+  80316a:	e9 0f ff ff ff       	jmp    80307e <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80316f:	83 ec 0c             	sub    $0xc,%esp
+  803172:	6a 03                	push   $0x3
+  803174:	e8 e4 14 00 00       	call   80465d <ipc_find_env>
+  803179:	a3 e4 89 84 00       	mov    %eax,0x8489e4
+  80317e:	83 c4 10             	add    $0x10,%esp
+  803181:	e9 05 ff ff ff       	jmp    80308b <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803186:	85 ff                	test   %edi,%edi
+  803188:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80318b:	89 f8                	mov    %edi,%eax
+  80318d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803190:	5b                   	pop    %ebx
+  803191:	5e                   	pop    %esi
+  803192:	5f                   	pop    %edi
+  803193:	5d                   	pop    %ebp
+  803194:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803195:	85 ff                	test   %edi,%edi
+  803197:	0f 44 f8             	cmove  %eax,%edi
+  80319a:	eb ef                	jmp    80318b <nsipc_sendfile+0x123>
+
+0080319c <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80319c:	55                   	push   %ebp
+  80319d:	89 e5                	mov    %esp,%ebp
+  80319f:	57                   	push   %edi
+  8031a0:	56                   	push   %esi
+  8031a1:	53                   	push   %ebx
+  8031a2:	83 ec 1c             	sub    $0x1c,%esp
+  8031a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8031a8:	e8 13 f9 ff ff       	call   802ac0 <nsbulk_map>
+  8031ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031b0:	85 c0                	test   %eax,%eax
+  8031b2:	0f 88 ba 00 00 00    	js     803272 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031b8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8031bc:	0f 8e bb 00 00 00    	jle    80327d <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8031c2:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031c7:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8031cc:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8031d1:	89 f8                	mov    %edi,%eax
+  8031d3:	29 f0                	sub    %esi,%eax
+  8031d5:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8031d9:	39 c8                	cmp    %ecx,%eax
+  8031db:	0f 47 c1             	cmova  %ecx,%eax
+  8031de:	01 f0                	add    %esi,%eax
+  8031e0:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031e2:	83 c2 01             	add    $0x1,%edx
+  8031e5:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8031e8:	7e 07                	jle    8031f1 <nsipc_recvmsg+0x55>
+  8031ea:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8031ef:	7e e0                	jle    8031d1 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8031f1:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8031f7:	c1 fa 0c             	sar    $0xc,%edx
+  8031fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ff:	e8 0a f9 ff ff       	call   802b0e <nsbulk_own>
+  803204:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803207:	85 c0                	test   %eax,%eax
+  803209:	78 67                	js     803272 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80320b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80320e:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803213:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803219:	8b 45 14             	mov    0x14(%ebp),%eax
+  80321c:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803221:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803226:	89 f2                	mov    %esi,%edx
+  803228:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80322d:	e8 44 f9 ff ff       	call   802b76 <nsipc_bulk>
+  803232:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803235:	85 c0                	test   %eax,%eax
+  803237:	78 39                	js     803272 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803239:	39 f0                	cmp    %esi,%eax
+  80323b:	7f 4a                	jg     803287 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80323d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803242:	85 c0                	test   %eax,%eax
+  803244:	7e 2c                	jle    803272 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803246:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803249:	29 fe                	sub    %edi,%esi
+  80324b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80324e:	39 c6                	cmp    %eax,%esi
+  803250:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803253:	83 ec 04             	sub    $0x4,%esp
+  803256:	56                   	push   %esi
+  803257:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80325d:	50                   	push   %eax
+  80325e:	ff 33                	push   (%ebx)
+  803260:	e8 7b dc ff ff       	call   800ee0 <memmove>
+		n += m;
+  803265:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803267:	83 c3 08             	add    $0x8,%ebx
+  80326a:	83 c4 10             	add    $0x10,%esp
+  80326d:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803270:	7f d4                	jg     803246 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803272:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803278:	5b                   	pop    %ebx
+  803279:	5e                   	pop    %esi
+  80327a:	5f                   	pop    %edi
+  80327b:	5d                   	pop    %ebp
+  80327c:	c3                   	ret
+	int r, i, n, len = 0;
+  80327d:	be 00 00 00 00       	mov    $0x0,%esi
+  803282:	e9 6a ff ff ff       	jmp    8031f1 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803287:	68 d8 4e 80 00       	push   $0x804ed8
+  80328c:	68 e1 4e 80 00       	push   $0x804ee1
+  803291:	68 3b 01 00 00       	push   $0x13b
+  803296:	68 f6 4e 80 00       	push   $0x804ef6
+  80329b:	e8 be d2 ff ff       	call   80055e <_panic>
+
+008032a0 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8032a0:	55                   	push   %ebp
+  8032a1:	89 e5                	mov    %esp,%ebp
+  8032a3:	57                   	push   %edi
+  8032a4:	56                   	push   %esi
+  8032a5:	53                   	push   %ebx
+  8032a6:	83 ec 0c             	sub    $0xc,%esp
+  8032a9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8032ac:	8b 75 10             	mov    0x10(%ebp),%esi
+  8032af:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8032b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b5:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.select.req_readset = *readset;
+  8032ba:	8b 07                	mov    (%edi),%eax
+  8032bc:	a3 04 a0 84 00       	mov    %eax,0x84a004
+  8032c1:	8b 47 04             	mov    0x4(%edi),%eax
+  8032c4:	a3 08 a0 84 00       	mov    %eax,0x84a008
+  8032c9:	8b 47 08             	mov    0x8(%edi),%eax
+  8032cc:	a3 0c a0 84 00       	mov    %eax,0x84a00c
+  8032d1:	8b 47 0c             	mov    0xc(%edi),%eax
+  8032d4:	a3 10 a0 84 00       	mov    %eax,0x84a010
+  8032d9:	8b 47 10             	mov    0x10(%edi),%eax
+  8032dc:	a3 14 a0 84 00       	mov    %eax,0x84a014
+  8032e1:	8b 47 14             	mov    0x14(%edi),%eax
+  8032e4:	a3 18 a0 84 00       	mov    %eax,0x84a018
+  8032e9:	8b 47 18             	mov    0x18(%edi),%eax
+  8032ec:	a3 1c a0 84 00       	mov    %eax,0x84a01c
+  8032f1:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8032f4:	a3 20 a0 84 00       	mov    %eax,0x84a020
+  8032f9:	8b 47 20             	mov    0x20(%edi),%eax
+  8032fc:	a3 24 a0 84 00       	mov    %eax,0x84a024
+  803301:	8b 47 24             	mov    0x24(%edi),%eax
+  803304:	a3 28 a0 84 00       	mov    %eax,0x84a028
+  803309:	8b 47 28             	mov    0x28(%edi),%eax
+  80330c:	a3 2c a0 84 00       	mov    %eax,0x84a02c
+  803311:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803314:	a3 30 a0 84 00       	mov    %eax,0x84a030
+  803319:	8b 47 30             	mov    0x30(%edi),%eax
+  80331c:	a3 34 a0 84 00       	mov    %eax,0x84a034
+  803321:	8b 47 34             	mov    0x34(%edi),%eax
+  803324:	a3 38 a0 84 00       	mov    %eax,0x84a038
+  803329:	8b 47 38             	mov    0x38(%edi),%eax
+  80332c:	a3 3c a0 84 00       	mov    %eax,0x84a03c
+  803331:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803334:	a3 40 a0 84 00       	mov    %eax,0x84a040
+	nsipcbuf.select.req_writeset = *writeset;
+  803339:	8b 06                	mov    (%esi),%eax
+  80333b:	a3 44 a0 84 00       	mov    %eax,0x84a044
+  803340:	8b 46 04             	mov    0x4(%esi),%eax
+  803343:	a3 48 a0 84 00       	mov    %eax,0x84a048
+  803348:	8b 46 08             	mov    0x8(%esi),%eax
+  80334b:	a3 4c a0 84 00       	mov    %eax,0x84a04c
+  803350:	8b 46 0c             	mov    0xc(%esi),%eax
+  803353:	a3 50 a0 84 00       	mov    %eax,0x84a050
+  803358:	8b 46 10             	mov    0x10(%esi),%eax
+  80335b:	a3 54 a0 84 00       	mov    %eax,0x84a054
+  803360:	8b 46 14             	mov    0x14(%esi),%eax
+  803363:	a3 58 a0 84 00       	mov    %eax,0x84a058
+  803368:	8b 46 18             	mov    0x18(%esi),%eax
+  80336b:	a3 5c a0 84 00       	mov    %eax,0x84a05c
+  803370:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803373:	a3 60 a0 84 00       	mov    %eax,0x84a060
+  803378:	8b 46 20             	mov    0x20(%esi),%eax
+  80337b:	a3 64 a0 84 00       	mov    %eax,0x84a064
+  803380:	8b 46 24             	mov    0x24(%esi),%eax
+  803383:	a3 68 a0 84 00       	mov    %eax,0x84a068
+  803388:	8b 46 28             	mov    0x28(%esi),%eax
+  80338b:	a3 6c a0 84 00       	mov    %eax,0x84a06c
+  803390:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803393:	a3 70 a0 84 00       	mov    %eax,0x84a070
+  803398:	8b 46 30             	mov    0x30(%esi),%eax
+  80339b:	a3 74 a0 84 00       	mov    %eax,0x84a074
+  8033a0:	8b 46 34             	mov    0x34(%esi),%eax
+  8033a3:	a3 78 a0 84 00       	mov    %eax,0x84a078
+  8033a8:	8b 46 38             	mov    0x38(%esi),%eax
+  8033ab:	a3 7c a0 84 00       	mov    %eax,0x84a07c
+  8033b0:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8033b3:	a3 80 a0 84 00       	mov    %eax,0x84a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8033b8:	8b 03                	mov    (%ebx),%eax
+  8033ba:	a3 84 a0 84 00       	mov    %eax,0x84a084
+  8033bf:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033c2:	a3 88 a0 84 00       	mov    %eax,0x84a088
+  8033c7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8033ca:	a3 8c a0 84 00       	mov    %eax,0x84a08c
+  8033cf:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8033d2:	a3 90 a0 84 00       	mov    %eax,0x84a090
+  8033d7:	8b 43 10             	mov    0x10(%ebx),%eax
+  8033da:	a3 94 a0 84 00       	mov    %eax,0x84a094
+  8033df:	8b 43 14             	mov    0x14(%ebx),%eax
+  8033e2:	a3 98 a0 84 00       	mov    %eax,0x84a098
+  8033e7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033ea:	a3 9c a0 84 00       	mov    %eax,0x84a09c
+  8033ef:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8033f2:	a3 a0 a0 84 00       	mov    %eax,0x84a0a0
+  8033f7:	8b 43 20             	mov    0x20(%ebx),%eax
+  8033fa:	a3 a4 a0 84 00       	mov    %eax,0x84a0a4
+  8033ff:	8b 43 24             	mov    0x24(%ebx),%eax
+  803402:	a3 a8 a0 84 00       	mov    %eax,0x84a0a8
+  803407:	8b 43 28             	mov    0x28(%ebx),%eax
+  80340a:	a3 ac a0 84 00       	mov    %eax,0x84a0ac
+  80340f:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803412:	a3 b0 a0 84 00       	mov    %eax,0x84a0b0
+  803417:	8b 43 30             	mov    0x30(%ebx),%eax
+  80341a:	a3 b4 a0 84 00       	mov    %eax,0x84a0b4
+  80341f:	8b 43 34             	mov    0x34(%ebx),%eax
+  803422:	a3 b8 a0 84 00       	mov    %eax,0x84a0b8
+  803427:	8b 43 38             	mov    0x38(%ebx),%eax
+  80342a:	a3 bc a0 84 00       	mov    %eax,0x84a0bc
+  80342f:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803432:	a3 c0 a0 84 00       	mov    %eax,0x84a0c0
+	nsipcbuf.select.req_timeout = msec;
+  803437:	8b 45 18             	mov    0x18(%ebp),%eax
+  80343a:	a3 c4 a0 84 00       	mov    %eax,0x84a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80343f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803444:	e8 2b f6 ff ff       	call   802a74 <nsipc>
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	0f 88 ad 01 00 00    	js     8035fe <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803451:	8b 15 04 a0 84 00    	mov    0x84a004,%edx
+  803457:	89 17                	mov    %edx,(%edi)
+  803459:	8b 15 08 a0 84 00    	mov    0x84a008,%edx
+  80345f:	89 57 04             	mov    %edx,0x4(%edi)
+  803462:	8b 15 0c a0 84 00    	mov    0x84a00c,%edx
+  803468:	89 57 08             	mov    %edx,0x8(%edi)
+  80346b:	8b 15 10 a0 84 00    	mov    0x84a010,%edx
+  803471:	89 57 0c             	mov    %edx,0xc(%edi)
+  803474:	8b 15 14 a0 84 00    	mov    0x84a014,%edx
+  80347a:	89 57 10             	mov    %edx,0x10(%edi)
+  80347d:	8b 15 18 a0 84 00    	mov    0x84a018,%edx
+  803483:	89 57 14             	mov    %edx,0x14(%edi)
+  803486:	8b 15 1c a0 84 00    	mov    0x84a01c,%edx
+  80348c:	89 57 18             	mov    %edx,0x18(%edi)
+  80348f:	8b 15 20 a0 84 00    	mov    0x84a020,%edx
+  803495:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803498:	8b 15 24 a0 84 00    	mov    0x84a024,%edx
+  80349e:	89 57 20             	mov    %edx,0x20(%edi)
+  8034a1:	8b 15 28 a0 84 00    	mov    0x84a028,%edx
+  8034a7:	89 57 24             	mov    %edx,0x24(%edi)
+  8034aa:	8b 15 2c a0 84 00    	mov    0x84a02c,%edx
+  8034b0:	89 57 28             	mov    %edx,0x28(%edi)
+  8034b3:	8b 15 30 a0 84 00    	mov    0x84a030,%edx
+  8034b9:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8034bc:	8b 15 34 a0 84 00    	mov    0x84a034,%edx
+  8034c2:	89 57 30             	mov    %edx,0x30(%edi)
+  8034c5:	8b 15 38 a0 84 00    	mov    0x84a038,%edx
+  8034cb:	89 57 34             	mov    %edx,0x34(%edi)
+  8034ce:	8b 15 3c a0 84 00    	mov    0x84a03c,%edx
+  8034d4:	89 57 38             	mov    %edx,0x38(%edi)
+  8034d7:	8b 15 40 a0 84 00    	mov    0x84a040,%edx
+  8034dd:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8034e0:	8b 15 44 a0 84 00    	mov    0x84a044,%edx
+  8034e6:	89 16                	mov    %edx,(%esi)
+  8034e8:	8b 15 48 a0 84 00    	mov    0x84a048,%edx
+  8034ee:	89 56 04             	mov    %edx,0x4(%esi)
+  8034f1:	8b 15 4c a0 84 00    	mov    0x84a04c,%edx
+  8034f7:	89 56 08             	mov    %edx,0x8(%esi)
+  8034fa:	8b 15 50 a0 84 00    	mov    0x84a050,%edx
+  803500:	89 56 0c             	mov    %edx,0xc(%esi)
+  803503:	8b 15 54 a0 84 00    	mov    0x84a054,%edx
+  803509:	89 56 10             	mov    %edx,0x10(%esi)
+  80350c:	8b 15 58 a0 84 00    	mov    0x84a058,%edx
+  803512:	89 56 14             	mov    %edx,0x14(%esi)
+  803515:	8b 15 5c a0 84 00    	mov    0x84a05c,%edx
+  80351b:	89 56 18             	mov    %edx,0x18(%esi)
+  80351e:	8b 15 60 a0 84 00    	mov    0x84a060,%edx
+  803524:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803527:	8b 15 64 a0 84 00    	mov    0x84a064,%edx
+  80352d:	89 56 20             	mov    %edx,0x20(%esi)
+  803530:	8b 15 68 a0 84 00    	mov    0x84a068,%edx
+  803536:	89 56 24             	mov    %edx,0x24(%esi)
+  803539:	8b 15 6c a0 84 00    	mov    0x84a06c,%edx
+  80353f:	89 56 28             	mov    %edx,0x28(%esi)
+  803542:	8b 15 70 a0 84 00    	mov    0x84a070,%edx
+  803548:	89 56 2c             	mov    %edx,0x2c(%esi)
+  80354b:	8b 15 74 a0 84 00    	mov    0x84a074,%edx
+  803551:	89 56 30             	mov    %edx,0x30(%esi)
+  803554:	8b 15 78 a0 84 00    	mov    0x84a078,%edx
+  80355a:	89 56 34             	mov    %edx,0x34(%esi)
+  80355d:	8b 15 7c a0 84 00    	mov    0x84a07c,%edx
+  803563:	89 56 38             	mov    %edx,0x38(%esi)
+  803566:	8b 15 80 a0 84 00    	mov    0x84a080,%edx
+  80356c:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80356f:	8b 15 84 a0 84 00    	mov    0x84a084,%edx
+  803575:	89 13                	mov    %edx,(%ebx)
+  803577:	8b 15 88 a0 84 00    	mov    0x84a088,%edx
+  80357d:	89 53 04             	mov    %edx,0x4(%ebx)
+  803580:	8b 15 8c a0 84 00    	mov    0x84a08c,%edx
+  803586:	89 53 08             	mov    %edx,0x8(%ebx)
+  803589:	8b 15 90 a0 84 00    	mov    0x84a090,%edx
+  80358f:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803592:	8b 15 94 a0 84 00    	mov    0x84a094,%edx
+  803598:	89 53 10             	mov    %edx,0x10(%ebx)
+  80359b:	8b 15 98 a0 84 00    	mov    0x84a098,%edx
+  8035a1:	89 53 14             	mov    %edx,0x14(%ebx)
+  8035a4:	8b 15 9c a0 84 00    	mov    0x84a09c,%edx
+  8035aa:	89 53 18             	mov    %edx,0x18(%ebx)
+  8035ad:	8b 15 a0 a0 84 00    	mov    0x84a0a0,%edx
+  8035b3:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8035b6:	8b 15 a4 a0 84 00    	mov    0x84a0a4,%edx
+  8035bc:	89 53 20             	mov    %edx,0x20(%ebx)
+  8035bf:	8b 15 a8 a0 84 00    	mov    0x84a0a8,%edx
+  8035c5:	89 53 24             	mov    %edx,0x24(%ebx)
+  8035c8:	8b 15 ac a0 84 00    	mov    0x84a0ac,%edx
+  8035ce:	89 53 28             	mov    %edx,0x28(%ebx)
+  8035d1:	8b 15 b0 a0 84 00    	mov    0x84a0b0,%edx
+  8035d7:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8035da:	8b 15 b4 a0 84 00    	mov    0x84a0b4,%edx
+  8035e0:	89 53 30             	mov    %edx,0x30(%ebx)
+  8035e3:	8b 15 b8 a0 84 00    	mov    0x84a0b8,%edx
+  8035e9:	89 53 34             	mov    %edx,0x34(%ebx)
+  8035ec:	8b 15 bc a0 84 00    	mov    0x84a0bc,%edx
+  8035f2:	89 53 38             	mov    %edx,0x38(%ebx)
+  8035f5:	8b 15 c0 a0 84 00    	mov    0x84a0c0,%edx
+  8035fb:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8035fe:	83 c4 0c             	add    $0xc,%esp
+  803601:	5b                   	pop    %ebx
+  803602:	5e                   	pop    %esi
+  803603:	5f                   	pop    %edi
+  803604:	5d                   	pop    %ebp
+  803605:	c3                   	ret
+
+00803606 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803606:	55                   	push   %ebp
+  803607:	89 e5                	mov    %esp,%ebp
+  803609:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80360c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80360f:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.evctl.req_events = events;
+  803614:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803617:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	nsipcbuf.evctl.req_data = data;
+  80361c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80361f:	a3 08 a0 84 00       	mov    %eax,0x84a008
+	return nsipc(NSREQ_EVCTL);
+  803624:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803629:	e8 46 f4 ff ff       	call   802a74 <nsipc>
+}
+  80362e:	c9                   	leave
+  80362f:	c3                   	ret
+
+00803630 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803630:	55                   	push   %ebp
+  803631:	89 e5                	mov    %esp,%ebp
+  803633:	56                   	push   %esi
+  803634:	53                   	push   %ebx
+  803635:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803638:	89 35 00 a0 84 00    	mov    %esi,0x84a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80363e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803641:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803646:	b8 10 00 00 00       	mov    $0x10,%eax
+  80364b:	e8 24 f4 ff ff       	call   802a74 <nsipc>
+  803650:	89 c3                	mov    %eax,%ebx
+  803652:	85 c0                	test   %eax,%eax
+  803654:	7e 1f                	jle    803675 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803656:	39 c6                	cmp    %eax,%esi
+  803658:	7c 24                	jl     80367e <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  80365a:	83 ec 04             	sub    $0x4,%esp
+  80365d:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803664:	50                   	push   %eax
+  803665:	68 00 a0 84 00       	push   $0x84a000
+  80366a:	ff 75 08             	push   0x8(%ebp)
+  80366d:	e8 6e d8 ff ff       	call   800ee0 <memmove>
+  803672:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803675:	89 d8                	mov    %ebx,%eax
+  803677:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80367a:	5b                   	pop    %ebx
+  80367b:	5e                   	pop    %esi
+  80367c:	5d                   	pop    %ebp
+  80367d:	c3                   	ret
+		assert(r <= max);
+  80367e:	68 0e 4f 80 00       	push   $0x804f0e
+  803683:	68 e1 4e 80 00       	push   $0x804ee1
+  803688:	68 6a 01 00 00       	push   $0x16a
+  80368d:	68 f6 4e 80 00       	push   $0x804ef6
+  803692:	e8 c7 ce ff ff       	call   80055e <_panic>
+
+00803697 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803697:	55                   	push   %ebp
+  803698:	89 e5                	mov    %esp,%ebp
+  80369a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80369d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036a0:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	nsipcbuf.socket.req_type = type;
+  8036a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036a8:	a3 04 a0 84 00       	mov    %eax,0x84a004
+	nsipcbuf.socket.req_protocol = protocol;
+  8036ad:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036b0:	a3 08 a0 84 00       	mov    %eax,0x84a008
+	return nsipc(NSREQ_SOCKET);
+  8036b5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8036ba:	e8 b5 f3 ff ff       	call   802a74 <nsipc>
+}
+  8036bf:	c9                   	leave
+  8036c0:	c3                   	ret
+
+008036c1 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8036c1:	55                   	push   %ebp
+  8036c2:	89 e5                	mov    %esp,%ebp
+  8036c4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8036c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ca:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	return nsipc(NSREQ_OFFLOAD);
+  8036cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8036d4:	e8 9b f3 ff ff       	call   802a74 <nsipc>
+}
+  8036d9:	c9                   	leave
+  8036da:	c3                   	ret
+
+008036db <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8036db:	55                   	push   %ebp
+  8036dc:	89 e5                	mov    %esp,%ebp
+  8036de:	53                   	push   %ebx
+  8036df:	83 ec 04             	sub    $0x4,%esp
+  8036e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8036e5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8036ea:	e8 85 f3 ff ff       	call   802a74 <nsipc>
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	78 50                	js     803743 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8036f3:	8b 15 00 a0 84 00    	mov    0x84a000,%edx
+  8036f9:	89 13                	mov    %edx,(%ebx)
+  8036fb:	8b 15 04 a0 84 00    	mov    0x84a004,%edx
+  803701:	89 53 04             	mov    %edx,0x4(%ebx)
+  803704:	8b 15 08 a0 84 00    	mov    0x84a008,%edx
+  80370a:	89 53 08             	mov    %edx,0x8(%ebx)
+  80370d:	8b 15 0c a0 84 00    	mov    0x84a00c,%edx
+  803713:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803716:	8b 15 10 a0 84 00    	mov    0x84a010,%edx
+  80371c:	89 53 10             	mov    %edx,0x10(%ebx)
+  80371f:	8b 15 14 a0 84 00    	mov    0x84a014,%edx
+  803725:	89 53 14             	mov    %edx,0x14(%ebx)
+  803728:	8b 15 18 a0 84 00    	mov    0x84a018,%edx
+  80372e:	89 53 18             	mov    %edx,0x18(%ebx)
+  803731:	8b 15 1c a0 84 00    	mov    0x84a01c,%edx
+  803737:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80373a:	8b 15 20 a0 84 00    	mov    0x84a020,%edx
+  803740:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803743:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803746:	c9                   	leave
+  803747:	c3                   	ret
+
+00803748 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803748:	55                   	push   %ebp
+  803749:	89 e5                	mov    %esp,%ebp
+  80374b:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80374e:	6a 03                	push   $0x3
+  803750:	e8 08 0f 00 00       	call   80465d <ipc_find_env>
+  803755:	a3 e4 89 84 00       	mov    %eax,0x8489e4
+	nsipcbuf.shard.req_shard = shard;
+  80375a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80375d:	a3 00 a0 84 00       	mov    %eax,0x84a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803762:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803767:	e8 08 f3 ff ff       	call   802a74 <nsipc>
+  80376c:	83 c4 10             	add    $0x10,%esp
+  80376f:	85 c0                	test   %eax,%eax
+  803771:	78 0a                	js     80377d <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803773:	a3 e4 89 84 00       	mov    %eax,0x8489e4
+	return 0;
+  803778:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80377d:	c9                   	leave
+  80377e:	c3                   	ret
+
+0080377f <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80377f:	55                   	push   %ebp
+  803780:	89 e5                	mov    %esp,%ebp
+  803782:	57                   	push   %edi
+  803783:	56                   	push   %esi
+  803784:	53                   	push   %ebx
+  803785:	83 ec 1c             	sub    $0x1c,%esp
+  803788:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80378b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80378e:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803793:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803798:	89 e0                	mov    %esp,%eax
+  80379a:	89 f2                	mov    %esi,%edx
+  80379c:	29 c2                	sub    %eax,%edx
+  80379e:	89 d0                	mov    %edx,%eax
+  8037a0:	c1 e8 0f             	shr    $0xf,%eax
+  8037a3:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8037a9:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8037ac:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8037b3:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8037b6:	83 ec 0c             	sub    $0xc,%esp
+  8037b9:	ff 75 e0             	push   -0x20(%ebp)
+  8037bc:	e8 db 0e 00 00       	call   80469c <pageref>
+  8037c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037c4:	83 c4 04             	add    $0x4,%esp
+  8037c7:	ff 75 dc             	push   -0x24(%ebp)
+  8037ca:	e8 cd 0e 00 00       	call   80469c <pageref>
+  8037cf:	89 e2                	mov    %esp,%edx
+  8037d1:	89 f1                	mov    %esi,%ecx
+  8037d3:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8037d5:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8037d8:	89 ca                	mov    %ecx,%edx
+  8037da:	c1 ea 0f             	shr    $0xf,%edx
+  8037dd:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8037e3:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8037e6:	8b 14 95 00 8a 84 00 	mov    0x848a00(,%edx,4),%edx
+  8037ed:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8037f0:	39 d7                	cmp    %edx,%edi
+  8037f2:	74 40                	je     803834 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8037f4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8037f7:	75 9f                	jne    803798 <_pipeisclosed+0x19>
+  8037f9:	89 e2                	mov    %esp,%edx
+  8037fb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803800:	29 d0                	sub    %edx,%eax
+  803802:	89 c2                	mov    %eax,%edx
+  803804:	c1 ea 0f             	shr    $0xf,%edx
+  803807:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80380c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803811:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803814:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  80381b:	8b 40 58             	mov    0x58(%eax),%eax
+  80381e:	6a 01                	push   $0x1
+  803820:	50                   	push   %eax
+  803821:	57                   	push   %edi
+  803822:	68 17 4f 80 00       	push   $0x804f17
+  803827:	e8 0d ce ff ff       	call   800639 <cprintf>
+  80382c:	83 c4 10             	add    $0x10,%esp
+  80382f:	e9 5f ff ff ff       	jmp    803793 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803834:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803837:	0f 94 c0             	sete   %al
+  80383a:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80383d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803840:	5b                   	pop    %ebx
+  803841:	5e                   	pop    %esi
+  803842:	5f                   	pop    %edi
+  803843:	5d                   	pop    %ebp
+  803844:	c3                   	ret
+
+00803845 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803845:	55                   	push   %ebp
+  803846:	89 e5                	mov    %esp,%ebp
+  803848:	53                   	push   %ebx
+  803849:	83 ec 0c             	sub    $0xc,%esp
+  80384c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80384f:	53                   	push   %ebx
+  803850:	6a 00                	push   $0x0
+  803852:	e8 92 d9 ff ff       	call   8011e9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803857:	89 1c 24             	mov    %ebx,(%esp)
+  80385a:	e8 f4 e4 ff ff       	call   801d53 <fd2data>
+  80385f:	83 c4 08             	add    $0x8,%esp
+  803862:	50                   	push   %eax
+  803863:	6a 00                	push   $0x0
+  803865:	e8 7f d9 ff ff       	call   8011e9 <sys_page_unmap>
+}
+  80386a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80386d:	c9                   	leave
+  80386e:	c3                   	ret
+
+0080386f <devpipe_read>:
+{
+  80386f:	55                   	push   %ebp
+  803870:	89 e5                	mov    %esp,%ebp
+  803872:	57                   	push   %edi
+  803873:	56                   	push   %esi
+  803874:	53                   	push   %ebx
+  803875:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803878:	ff 75 08             	push   0x8(%ebp)
+  80387b:	e8 d3 e4 ff ff       	call   801d53 <fd2data>
+  803880:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803882:	8b 70 04             	mov    0x4(%eax),%esi
+  803885:	8b 00                	mov    (%eax),%eax
+  803887:	83 c4 10             	add    $0x10,%esp
+  80388a:	39 f0                	cmp    %esi,%eax
+  80388c:	75 36                	jne    8038c4 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80388e:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803891:	89 da                	mov    %ebx,%edx
+  803893:	8b 45 08             	mov    0x8(%ebp),%eax
+  803896:	e8 e4 fe ff ff       	call   80377f <_pipeisclosed>
+  80389b:	85 c0                	test   %eax,%eax
+  80389d:	0f 85 d4 00 00 00    	jne    803977 <devpipe_read+0x108>
+	asm volatile("lock; xchgl %0, %1" :
+  8038a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038a8:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8038ac:	83 ec 04             	sub    $0x4,%esp
+  8038af:	6a ff                	push   $0xffffffff
+  8038b1:	56                   	push   %esi
+  8038b2:	57                   	push   %edi
+  8038b3:	e8 aa dc ff ff       	call   801562 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8038b8:	8b 73 04             	mov    0x4(%ebx),%esi
+  8038bb:	8b 03                	mov    (%ebx),%eax
+  8038bd:	83 c4 10             	add    $0x10,%esp
+  8038c0:	39 c6                	cmp    %eax,%esi
+  8038c2:	74 cd                	je     803891 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038c4:	8b 73 04             	mov    0x4(%ebx),%esi
+  8038c7:	8b 03                	mov    (%ebx),%eax
+  8038c9:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8038cf:	29 c6                	sub    %eax,%esi
+  8038d1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038d6:	f7 e6                	mul    %esi
+  8038d8:	c1 ea 0c             	shr    $0xc,%edx
+  8038db:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038e1:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8038e3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8038e6:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8038ea:	8b 0b                	mov    (%ebx),%ecx
+  8038ec:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038f1:	f7 e1                	mul    %ecx
+  8038f3:	c1 ea 0b             	shr    $0xb,%edx
+  8038f6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8038fc:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8038fe:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803903:	29 cf                	sub    %ecx,%edi
+  803905:	39 f7                	cmp    %esi,%edi
+  803907:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80390a:	83 ec 04             	sub    $0x4,%esp
+  80390d:	57                   	push   %edi
+  80390e:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803912:	50                   	push   %eax
+  803913:	ff 75 0c             	push   0xc(%ebp)
+  803916:	e8 c5 d5 ff ff       	call   800ee0 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  80391b:	83 c4 0c             	add    $0xc,%esp
+  80391e:	89 f0                	mov    %esi,%eax
+  803920:	29 f8                	sub    %edi,%eax
+  803922:	50                   	push   %eax
+  803923:	8d 43 10             	lea    0x10(%ebx),%eax
+  803926:	50                   	push   %eax
+  803927:	89 f8                	mov    %edi,%eax
+  803929:	03 45 0c             	add    0xc(%ebp),%eax
+  80392c:	50                   	push   %eax
+  80392d:	e8 ae d5 ff ff       	call   800ee0 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803932:	8b 0b                	mov    (%ebx),%ecx
+  803934:	01 f1                	add    %esi,%ecx
+  803936:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80393b:	f7 e1                	mul    %ecx
+  80393d:	c1 ea 0c             	shr    $0xc,%edx
+  803940:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803946:	29 c1                	sub    %eax,%ecx
+  803948:	89 0b                	mov    %ecx,(%ebx)
+  80394a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394f:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803953:	83 c4 10             	add    $0x10,%esp
+  803956:	85 c0                	test   %eax,%eax
+  803958:	75 0a                	jne    803964 <devpipe_read+0xf5>
+	return n;
+  80395a:	89 f0                	mov    %esi,%eax
+}
+  80395c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80395f:	5b                   	pop    %ebx
+  803960:	5e                   	pop    %esi
+  803961:	5f                   	pop    %edi
+  803962:	5d                   	pop    %ebp
+  803963:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803964:	83 ec 08             	sub    $0x8,%esp
+  803967:	68 00 04 00 00       	push   $0x400
+  80396c:	53                   	push   %ebx
+  80396d:	e8 12 dc ff ff       	call   801584 <sys_futex_wake>
+  803972:	83 c4 10             	add    $0x10,%esp
+  803975:	eb e3                	jmp    80395a <devpipe_read+0xeb>
+			return 0;
+  803977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397c:	eb de                	jmp    80395c <devpipe_read+0xed>
+
+0080397e <devpipe_write>:
+{
+  80397e:	55                   	push   %ebp
+  80397f:	89 e5                	mov    %esp,%ebp
+  803981:	57                   	push   %edi
+  803982:	56                   	push   %esi
+  803983:	53                   	push   %ebx
+  803984:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803987:	ff 75 08             	push   0x8(%ebp)
+  80398a:	e8 c4 e3 ff ff       	call   801d53 <fd2data>
+  80398f:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803991:	83 c4 10             	add    $0x10,%esp
+  803994:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80399b:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8039a0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039a4:	0f 84 43 01 00 00    	je     803aed <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039aa:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039ad:	8b 06                	mov    (%esi),%eax
+  8039af:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039b5:	29 c1                	sub    %eax,%ecx
+  8039b7:	89 c8                	mov    %ecx,%eax
+  8039b9:	f7 e7                	mul    %edi
+  8039bb:	c1 ea 0c             	shr    $0xc,%edx
+  8039be:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039c4:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8039c6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8039cc:	75 52                	jne    803a20 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8039ce:	89 f2                	mov    %esi,%edx
+  8039d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039d3:	e8 a7 fd ff ff       	call   80377f <_pipeisclosed>
+  8039d8:	85 c0                	test   %eax,%eax
+  8039da:	0f 85 28 01 00 00    	jne    803b08 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8039e0:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039e2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039e5:	8b 06                	mov    (%esi),%eax
+  8039e7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039ed:	29 c1                	sub    %eax,%ecx
+  8039ef:	89 c8                	mov    %ecx,%eax
+  8039f1:	f7 e7                	mul    %edi
+  8039f3:	c1 ea 0c             	shr    $0xc,%edx
+  8039f6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039fc:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8039fe:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803a04:	75 a4                	jne    8039aa <devpipe_write+0x2c>
+  803a06:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a0b:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803a0f:	83 ec 04             	sub    $0x4,%esp
+  803a12:	6a ff                	push   $0xffffffff
+  803a14:	53                   	push   %ebx
+  803a15:	56                   	push   %esi
+  803a16:	e8 47 db ff ff       	call   801562 <sys_futex_wait>
+}
+  803a1b:	83 c4 10             	add    $0x10,%esp
+  803a1e:	eb 8a                	jmp    8039aa <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a20:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a23:	8b 06                	mov    (%esi),%eax
+  803a25:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a2b:	29 c1                	sub    %eax,%ecx
+  803a2d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a32:	f7 e1                	mul    %ecx
+  803a34:	c1 ea 0c             	shr    $0xc,%edx
+  803a37:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a3d:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803a3f:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803a44:	89 d8                	mov    %ebx,%eax
+  803a46:	29 c8                	sub    %ecx,%eax
+  803a48:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a4b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a4e:	29 ca                	sub    %ecx,%edx
+  803a50:	39 d0                	cmp    %edx,%eax
+  803a52:	0f 46 d0             	cmovbe %eax,%edx
+  803a55:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803a58:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a5b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a60:	f7 e1                	mul    %ecx
+  803a62:	c1 ea 0b             	shr    $0xb,%edx
+  803a65:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803a6b:	89 ca                	mov    %ecx,%edx
+  803a6d:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803a6f:	29 d3                	sub    %edx,%ebx
+  803a71:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a74:	39 c3                	cmp    %eax,%ebx
+  803a76:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803a79:	83 ec 04             	sub    $0x4,%esp
+  803a7c:	53                   	push   %ebx
+  803a7d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a80:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803a83:	51                   	push   %ecx
+  803a84:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803a88:	50                   	push   %eax
+  803a89:	e8 52 d4 ff ff       	call   800ee0 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803a8e:	83 c4 0c             	add    $0xc,%esp
+  803a91:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a94:	29 d8                	sub    %ebx,%eax
+  803a96:	50                   	push   %eax
+  803a97:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a9a:	01 cb                	add    %ecx,%ebx
+  803a9c:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803a9f:	53                   	push   %ebx
+  803aa0:	8d 46 10             	lea    0x10(%esi),%eax
+  803aa3:	50                   	push   %eax
+  803aa4:	e8 37 d4 ff ff       	call   800ee0 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803aa9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803aac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803aaf:	01 c1                	add    %eax,%ecx
+  803ab1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803ab6:	f7 e1                	mul    %ecx
+  803ab8:	c1 ea 0c             	shr    $0xc,%edx
+  803abb:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803ac1:	89 ca                	mov    %ecx,%edx
+  803ac3:	29 c2                	sub    %eax,%edx
+  803ac5:	89 56 04             	mov    %edx,0x4(%esi)
+  803ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803acd:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803ad1:	83 c4 10             	add    $0x10,%esp
+  803ad4:	85 c0                	test   %eax,%eax
+  803ad6:	75 1a                	jne    803af2 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803ad8:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803adb:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803ade:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ae1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803ae4:	0f 82 c0 fe ff ff    	jb     8039aa <devpipe_write+0x2c>
+  803aea:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803aed:	8b 45 10             	mov    0x10(%ebp),%eax
+  803af0:	eb 1b                	jmp    803b0d <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803af2:	83 ec 08             	sub    $0x8,%esp
+  803af5:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803afa:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803afd:	50                   	push   %eax
+  803afe:	e8 81 da ff ff       	call   801584 <sys_futex_wake>
+  803b03:	83 c4 10             	add    $0x10,%esp
+  803b06:	eb d0                	jmp    803ad8 <devpipe_write+0x15a>
+				return 0;
+  803b08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b10:	5b                   	pop    %ebx
+  803b11:	5e                   	pop    %esi
+  803b12:	5f                   	pop    %edi
+  803b13:	5d                   	pop    %ebp
+  803b14:	c3                   	ret
+
+00803b15 <devpipe_stat>:
+{
+  803b15:	55                   	push   %ebp
+  803b16:	89 e5                	mov    %esp,%ebp
+  803b18:	56                   	push   %esi
+  803b19:	53                   	push   %ebx
+  803b1a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b1d:	83 ec 0c             	sub    $0xc,%esp
+  803b20:	ff 75 08             	push   0x8(%ebp)
+  803b23:	e8 2b e2 ff ff       	call   801d53 <fd2data>
+  803b28:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803b2a:	83 c4 08             	add    $0x8,%esp
+  803b2d:	68 2a 4f 80 00       	push   $0x804f2a
+  803b32:	53                   	push   %ebx
+  803b33:	e8 f8 d1 ff ff       	call   800d30 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b38:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b3b:	8b 06                	mov    (%esi),%eax
+  803b3d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b43:	29 c1                	sub    %eax,%ecx
+  803b45:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b4a:	89 c8                	mov    %ecx,%eax
+  803b4c:	f7 e2                	mul    %edx
+  803b4e:	c1 ea 0c             	shr    $0xc,%edx
+  803b51:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b57:	29 d1                	sub    %edx,%ecx
+  803b59:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803b5f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803b66:	00 00 00 
+	stat->st_dev = &devpipe;
+  803b69:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803b70:	50 80 00 
+}
+  803b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b7b:	5b                   	pop    %ebx
+  803b7c:	5e                   	pop    %esi
+  803b7d:	5d                   	pop    %ebp
+  803b7e:	c3                   	ret
+
+00803b7f <devpipe_poll>:
+{
+  803b7f:	55                   	push   %ebp
+  803b80:	89 e5                	mov    %esp,%ebp
+  803b82:	57                   	push   %edi
+  803b83:	56                   	push   %esi
+  803b84:	53                   	push   %ebx
+  803b85:	83 ec 18             	sub    $0x18,%esp
+  803b88:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b8e:	57                   	push   %edi
+  803b8f:	e8 bf e1 ff ff       	call   801d53 <fd2data>
+  803b94:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803b96:	83 c4 10             	add    $0x10,%esp
+  803b99:	89 f3                	mov    %esi,%ebx
+  803b9b:	83 e3 01             	and    $0x1,%ebx
+  803b9e:	75 27                	jne    803bc7 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803ba0:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803ba6:	75 48                	jne    803bf0 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803ba8:	89 ca                	mov    %ecx,%edx
+  803baa:	89 f8                	mov    %edi,%eax
+  803bac:	e8 ce fb ff ff       	call   80377f <_pipeisclosed>
+  803bb1:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803bb3:	89 d8                	mov    %ebx,%eax
+  803bb5:	83 c8 10             	or     $0x10,%eax
+  803bb8:	85 d2                	test   %edx,%edx
+  803bba:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803bbd:	89 d8                	mov    %ebx,%eax
+  803bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bc2:	5b                   	pop    %ebx
+  803bc3:	5e                   	pop    %esi
+  803bc4:	5f                   	pop    %edi
+  803bc5:	5d                   	pop    %ebp
+  803bc6:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803bc7:	8b 58 04             	mov    0x4(%eax),%ebx
+  803bca:	8b 00                	mov    (%eax),%eax
+  803bcc:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803bd2:	29 c3                	sub    %eax,%ebx
+  803bd4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803bd9:	89 d8                	mov    %ebx,%eax
+  803bdb:	f7 e2                	mul    %edx
+  803bdd:	c1 ea 0c             	shr    $0xc,%edx
+  803be0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803be6:	39 d3                	cmp    %edx,%ebx
+  803be8:	0f 95 c3             	setne  %bl
+  803beb:	0f b6 db             	movzbl %bl,%ebx
+  803bee:	eb b0                	jmp    803ba0 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803bf0:	8b 71 04             	mov    0x4(%ecx),%esi
+  803bf3:	8b 01                	mov    (%ecx),%eax
+  803bf5:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803bfb:	29 c6                	sub    %eax,%esi
+  803bfd:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803c02:	89 f0                	mov    %esi,%eax
+  803c04:	f7 e2                	mul    %edx
+  803c06:	c1 ea 0c             	shr    $0xc,%edx
+  803c09:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803c0f:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803c11:	89 d8                	mov    %ebx,%eax
+  803c13:	83 c8 04             	or     $0x4,%eax
+  803c16:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803c1c:	0f 42 d8             	cmovb  %eax,%ebx
+  803c1f:	eb 87                	jmp    803ba8 <devpipe_poll+0x29>
+
+00803c21 <pipe>:
+{
+  803c21:	55                   	push   %ebp
+  803c22:	89 e5                	mov    %esp,%ebp
+  803c24:	56                   	push   %esi
+  803c25:	53                   	push   %ebx
+  803c26:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803c29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c2c:	50                   	push   %eax
+  803c2d:	e8 38 e1 ff ff       	call   801d6a <fd_alloc>
+  803c32:	89 c3                	mov    %eax,%ebx
+  803c34:	83 c4 10             	add    $0x10,%esp
+  803c37:	85 c0                	test   %eax,%eax
+  803c39:	0f 88 23 01 00 00    	js     803d62 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c3f:	83 ec 04             	sub    $0x4,%esp
+  803c42:	68 07 04 00 00       	push   $0x407
+  803c47:	ff 75 f4             	push   -0xc(%ebp)
+  803c4a:	6a 00                	push   $0x0
+  803c4c:	e8 13 d5 ff ff       	call   801164 <sys_page_alloc>
+  803c51:	89 c3                	mov    %eax,%ebx
+  803c53:	83 c4 10             	add    $0x10,%esp
+  803c56:	85 c0                	test   %eax,%eax
+  803c58:	0f 88 04 01 00 00    	js     803d62 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803c5e:	83 ec 0c             	sub    $0xc,%esp
+  803c61:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803c64:	50                   	push   %eax
+  803c65:	e8 00 e1 ff ff       	call   801d6a <fd_alloc>
+  803c6a:	89 c3                	mov    %eax,%ebx
+  803c6c:	83 c4 10             	add    $0x10,%esp
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	0f 88 db 00 00 00    	js     803d52 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c77:	83 ec 04             	sub    $0x4,%esp
+  803c7a:	68 07 04 00 00       	push   $0x407
+  803c7f:	ff 75 f0             	push   -0x10(%ebp)
+  803c82:	6a 00                	push   $0x0
+  803c84:	e8 db d4 ff ff       	call   801164 <sys_page_alloc>
+  803c89:	89 c3                	mov    %eax,%ebx
+  803c8b:	83 c4 10             	add    $0x10,%esp
+  803c8e:	85 c0                	test   %eax,%eax
+  803c90:	0f 88 bc 00 00 00    	js     803d52 <pipe+0x131>
+	va = fd2data(fd0);
+  803c96:	83 ec 0c             	sub    $0xc,%esp
+  803c99:	ff 75 f4             	push   -0xc(%ebp)
+  803c9c:	e8 b2 e0 ff ff       	call   801d53 <fd2data>
+  803ca1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ca3:	83 c4 0c             	add    $0xc,%esp
+  803ca6:	68 07 04 00 00       	push   $0x407
+  803cab:	50                   	push   %eax
+  803cac:	6a 00                	push   $0x0
+  803cae:	e8 b1 d4 ff ff       	call   801164 <sys_page_alloc>
+  803cb3:	89 c3                	mov    %eax,%ebx
+  803cb5:	83 c4 10             	add    $0x10,%esp
+  803cb8:	85 c0                	test   %eax,%eax
+  803cba:	0f 88 82 00 00 00    	js     803d42 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803cc0:	83 ec 0c             	sub    $0xc,%esp
+  803cc3:	ff 75 f0             	push   -0x10(%ebp)
+  803cc6:	e8 88 e0 ff ff       	call   801d53 <fd2data>
+  803ccb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803cd2:	50                   	push   %eax
+  803cd3:	6a 00                	push   $0x0
+  803cd5:	56                   	push   %esi
+  803cd6:	6a 00                	push   $0x0
+  803cd8:	e8 ca d4 ff ff       	call   8011a7 <sys_page_map>
+  803cdd:	89 c3                	mov    %eax,%ebx
+  803cdf:	83 c4 20             	add    $0x20,%esp
+  803ce2:	85 c0                	test   %eax,%eax
+  803ce4:	78 4e                	js     803d34 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803ce6:	a1 60 50 80 00       	mov    0x805060,%eax
+  803ceb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803cee:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803cf0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803cf3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803cfa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803cfd:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803cff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803d02:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803d09:	83 ec 0c             	sub    $0xc,%esp
+  803d0c:	ff 75 f4             	push   -0xc(%ebp)
+  803d0f:	e8 2f e0 ff ff       	call   801d43 <fd2num>
+  803d14:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d17:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803d19:	83 c4 04             	add    $0x4,%esp
+  803d1c:	ff 75 f0             	push   -0x10(%ebp)
+  803d1f:	e8 1f e0 ff ff       	call   801d43 <fd2num>
+  803d24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d27:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803d2a:	83 c4 10             	add    $0x10,%esp
+  803d2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d32:	eb 2e                	jmp    803d62 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803d34:	83 ec 08             	sub    $0x8,%esp
+  803d37:	56                   	push   %esi
+  803d38:	6a 00                	push   $0x0
+  803d3a:	e8 aa d4 ff ff       	call   8011e9 <sys_page_unmap>
+  803d3f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803d42:	83 ec 08             	sub    $0x8,%esp
+  803d45:	ff 75 f0             	push   -0x10(%ebp)
+  803d48:	6a 00                	push   $0x0
+  803d4a:	e8 9a d4 ff ff       	call   8011e9 <sys_page_unmap>
+  803d4f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803d52:	83 ec 08             	sub    $0x8,%esp
+  803d55:	ff 75 f4             	push   -0xc(%ebp)
+  803d58:	6a 00                	push   $0x0
+  803d5a:	e8 8a d4 ff ff       	call   8011e9 <sys_page_unmap>
+  803d5f:	83 c4 10             	add    $0x10,%esp
+}
+  803d62:	89 d8                	mov    %ebx,%eax
+  803d64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d67:	5b                   	pop    %ebx
+  803d68:	5e                   	pop    %esi
+  803d69:	5d                   	pop    %ebp
+  803d6a:	c3                   	ret
+
+00803d6b <pipeisclosed>:
+{
+  803d6b:	55                   	push   %ebp
+  803d6c:	89 e5                	mov    %esp,%ebp
+  803d6e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d74:	50                   	push   %eax
+  803d75:	ff 75 08             	push   0x8(%ebp)
+  803d78:	e8 3d e0 ff ff       	call   801dba <fd_lookup>
+  803d7d:	83 c4 10             	add    $0x10,%esp
+  803d80:	85 c0                	test   %eax,%eax
+  803d82:	78 18                	js     803d9c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803d84:	83 ec 0c             	sub    $0xc,%esp
+  803d87:	ff 75 f4             	push   -0xc(%ebp)
+  803d8a:	e8 c4 df ff ff       	call   801d53 <fd2data>
+  803d8f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803d91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d94:	e8 e6 f9 ff ff       	call   80377f <_pipeisclosed>
+  803d99:	83 c4 10             	add    $0x10,%esp
+}
+  803d9c:	c9                   	leave
+  803d9d:	c3                   	ret
+
+00803d9e <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803d9e:	55                   	push   %ebp
+  803d9f:	89 e5                	mov    %esp,%ebp
+  803da1:	56                   	push   %esi
+  803da2:	53                   	push   %ebx
+  803da3:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803da6:	85 f6                	test   %esi,%esi
+  803da8:	74 40                	je     803dea <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803daa:	89 f3                	mov    %esi,%ebx
+  803dac:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803db2:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803db8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803dbd:	8b 40 48             	mov    0x48(%eax),%eax
+  803dc0:	39 c6                	cmp    %eax,%esi
+  803dc2:	75 1f                	jne    803de3 <wait+0x45>
+  803dc4:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803dca:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803dd0:	8b 43 54             	mov    0x54(%ebx),%eax
+  803dd3:	85 c0                	test   %eax,%eax
+  803dd5:	74 0c                	je     803de3 <wait+0x45>
+		sys_yield();
+  803dd7:	e8 69 d3 ff ff       	call   801145 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803ddc:	8b 43 48             	mov    0x48(%ebx),%eax
+  803ddf:	39 f0                	cmp    %esi,%eax
+  803de1:	74 ed                	je     803dd0 <wait+0x32>
+}
+  803de3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803de6:	5b                   	pop    %ebx
+  803de7:	5e                   	pop    %esi
+  803de8:	5d                   	pop    %ebp
+  803de9:	c3                   	ret
+	assert(envid != 0);
+  803dea:	68 36 4f 80 00       	push   $0x804f36
+  803def:	68 e1 4e 80 00       	push   $0x804ee1
+  803df4:	6a 09                	push   $0x9
+  803df6:	68 41 4f 80 00       	push   $0x804f41
+  803dfb:	e8 5e c7 ff ff       	call   80055e <_panic>
+
+00803e00 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803e00:	55                   	push   %ebp
+  803e01:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e06:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e0c:	5d                   	pop    %ebp
+  803e0d:	c3                   	ret
+
+00803e0e <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803e0e:	55                   	push   %ebp
+  803e0f:	89 e5                	mov    %esp,%ebp
+  803e11:	53                   	push   %ebx
+  803e12:	83 ec 04             	sub    $0x4,%esp
+  803e15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803e18:	8b 03                	mov    (%ebx),%eax
+  803e1a:	85 c0                	test   %eax,%eax
+  803e1c:	75 05                	jne    803e23 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803e1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e21:	c9                   	leave
+  803e22:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803e23:	83 ec 08             	sub    $0x8,%esp
+  803e26:	50                   	push   %eax
+  803e27:	8d 43 04             	lea    0x4(%ebx),%eax
+  803e2a:	50                   	push   %eax
+  803e2b:	e8 09 d6 ff ff       	call   801439 <sys_page_batch>
+	pb->pb_n = 0;
+  803e30:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803e36:	83 c4 10             	add    $0x10,%esp
+  803e39:	eb e3                	jmp    803e1e <pgbatch_flush+0x10>
+
+00803e3b <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803e3b:	55                   	push   %ebp
+  803e3c:	89 e5                	mov    %esp,%ebp
+  803e3e:	56                   	push   %esi
+  803e3f:	53                   	push   %ebx
+  803e40:	89 c3                	mov    %eax,%ebx
+  803e42:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803e44:	83 38 20             	cmpl   $0x20,(%eax)
+  803e47:	74 2c                	je     803e75 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803e49:	8b 03                	mov    (%ebx),%eax
+  803e4b:	8d 50 01             	lea    0x1(%eax),%edx
+  803e4e:	89 13                	mov    %edx,(%ebx)
+  803e50:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803e53:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803e57:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803e59:	83 ec 04             	sub    $0x4,%esp
+  803e5c:	6a 18                	push   $0x18
+  803e5e:	6a 00                	push   $0x0
+  803e60:	50                   	push   %eax
+  803e61:	e8 45 d0 ff ff       	call   800eab <memset>
+	return 0;
+  803e66:	83 c4 10             	add    $0x10,%esp
+  803e69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e71:	5b                   	pop    %ebx
+  803e72:	5e                   	pop    %esi
+  803e73:	5d                   	pop    %ebp
+  803e74:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803e75:	83 ec 0c             	sub    $0xc,%esp
+  803e78:	50                   	push   %eax
+  803e79:	e8 90 ff ff ff       	call   803e0e <pgbatch_flush>
+  803e7e:	83 c4 10             	add    $0x10,%esp
+  803e81:	85 c0                	test   %eax,%eax
+  803e83:	79 c4                	jns    803e49 <pgbatch_slot+0xe>
+  803e85:	eb e7                	jmp    803e6e <pgbatch_slot+0x33>
+
+00803e87 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803e87:	55                   	push   %ebp
+  803e88:	89 e5                	mov    %esp,%ebp
+  803e8a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e8d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e90:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e93:	e8 a3 ff ff ff       	call   803e3b <pgbatch_slot>
+  803e98:	85 c0                	test   %eax,%eax
+  803e9a:	78 20                	js     803ebc <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803e9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e9f:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803ea5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ea8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803eab:	8b 55 10             	mov    0x10(%ebp),%edx
+  803eae:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803eb1:	8b 55 14             	mov    0x14(%ebp),%edx
+  803eb4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ebc:	c9                   	leave
+  803ebd:	c3                   	ret
+
+00803ebe <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803ebe:	55                   	push   %ebp
+  803ebf:	89 e5                	mov    %esp,%ebp
+  803ec1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ec4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ec7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eca:	e8 6c ff ff ff       	call   803e3b <pgbatch_slot>
+  803ecf:	85 c0                	test   %eax,%eax
+  803ed1:	78 2c                	js     803eff <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803ed3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ed6:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803edc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803edf:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803ee2:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ee5:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803ee8:	8b 55 14             	mov    0x14(%ebp),%edx
+  803eeb:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803eee:	8b 55 18             	mov    0x18(%ebp),%edx
+  803ef1:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ef4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803ef7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803efa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eff:	c9                   	leave
+  803f00:	c3                   	ret
+
+00803f01 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803f01:	55                   	push   %ebp
+  803f02:	89 e5                	mov    %esp,%ebp
+  803f04:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f07:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f0d:	e8 29 ff ff ff       	call   803e3b <pgbatch_slot>
+  803f12:	85 c0                	test   %eax,%eax
+  803f14:	78 1a                	js     803f30 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803f16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f19:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803f1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f22:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f25:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f28:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f30:	c9                   	leave
+  803f31:	c3                   	ret
+
+00803f32 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803f32:	55                   	push   %ebp
+  803f33:	89 e5                	mov    %esp,%ebp
+  803f35:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f38:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f3e:	e8 f8 fe ff ff       	call   803e3b <pgbatch_slot>
+  803f43:	85 c0                	test   %eax,%eax
+  803f45:	78 20                	js     803f67 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803f47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f4a:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803f50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f53:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f56:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f59:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803f5c:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f5f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f67:	c9                   	leave
+  803f68:	c3                   	ret
+
+00803f69 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803f69:	55                   	push   %ebp
+  803f6a:	89 e5                	mov    %esp,%ebp
+  803f6c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f6f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f72:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f75:	e8 c1 fe ff ff       	call   803e3b <pgbatch_slot>
+  803f7a:	85 c0                	test   %eax,%eax
+  803f7c:	78 26                	js     803fa4 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803f7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f81:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803f87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f8a:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803f8d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f90:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803f93:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f96:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803f99:	8b 55 18             	mov    0x18(%ebp),%edx
+  803f9c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fa4:	c9                   	leave
+  803fa5:	c3                   	ret
+
+00803fa6 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803fa6:	55                   	push   %ebp
+  803fa7:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803fa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fac:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803fb2:	5d                   	pop    %ebp
+  803fb3:	c3                   	ret
+
+00803fb4 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803fb4:	55                   	push   %ebp
+  803fb5:	89 e5                	mov    %esp,%ebp
+  803fb7:	56                   	push   %esi
+  803fb8:	53                   	push   %ebx
+  803fb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc1:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fc6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803fca:	85 c0                	test   %eax,%eax
+  803fcc:	74 2f                	je     803ffd <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803fce:	83 f8 02             	cmp    $0x2,%eax
+  803fd1:	74 0c                	je     803fdf <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803fd3:	b8 02 00 00 00       	mov    $0x2,%eax
+  803fd8:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803fdb:	85 c0                	test   %eax,%eax
+  803fdd:	74 1e                	je     803ffd <mutex_lock+0x49>
+  803fdf:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803fe4:	83 ec 04             	sub    $0x4,%esp
+  803fe7:	6a ff                	push   $0xffffffff
+  803fe9:	6a 02                	push   $0x2
+  803feb:	53                   	push   %ebx
+  803fec:	e8 71 d5 ff ff       	call   801562 <sys_futex_wait>
+  803ff1:	89 f0                	mov    %esi,%eax
+  803ff3:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803ff6:	83 c4 10             	add    $0x10,%esp
+  803ff9:	85 c0                	test   %eax,%eax
+  803ffb:	75 e7                	jne    803fe4 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804000:	5b                   	pop    %ebx
+  804001:	5e                   	pop    %esi
+  804002:	5d                   	pop    %ebp
+  804003:	c3                   	ret
+
+00804004 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  804004:	55                   	push   %ebp
+  804005:	89 e5                	mov    %esp,%ebp
+  804007:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  80400a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804014:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  804018:	85 c0                	test   %eax,%eax
+  80401a:	0f 94 c0             	sete   %al
+  80401d:	0f b6 c0             	movzbl %al,%eax
+}
+  804020:	5d                   	pop    %ebp
+  804021:	c3                   	ret
+
+00804022 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804022:	55                   	push   %ebp
+  804023:	89 e5                	mov    %esp,%ebp
+  804025:	83 ec 08             	sub    $0x8,%esp
+  804028:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  80402b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804030:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  804033:	83 f8 02             	cmp    $0x2,%eax
+  804036:	74 02                	je     80403a <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804038:	c9                   	leave
+  804039:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80403a:	83 ec 08             	sub    $0x8,%esp
+  80403d:	6a 01                	push   $0x1
+  80403f:	52                   	push   %edx
+  804040:	e8 3f d5 ff ff       	call   801584 <sys_futex_wake>
+  804045:	83 c4 10             	add    $0x10,%esp
+}
+  804048:	eb ee                	jmp    804038 <mutex_unlock+0x16>
+
+0080404a <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  80404a:	55                   	push   %ebp
+  80404b:	89 e5                	mov    %esp,%ebp
+  80404d:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  804050:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  804056:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  80405d:	5d                   	pop    %ebp
+  80405e:	c3                   	ret
+
+0080405f <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80405f:	55                   	push   %ebp
+  804060:	89 e5                	mov    %esp,%ebp
+  804062:	57                   	push   %edi
+  804063:	56                   	push   %esi
+  804064:	53                   	push   %ebx
+  804065:	83 ec 18             	sub    $0x18,%esp
+  804068:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80406b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  80406e:	8b 33                	mov    (%ebx),%esi
+	asm volatile("lock; xaddl %0, %1" :
+  804070:	b8 01 00 00 00       	mov    $0x1,%eax
+  804075:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  80407a:	57                   	push   %edi
+  80407b:	e8 a2 ff ff ff       	call   804022 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804080:	83 c4 0c             	add    $0xc,%esp
+  804083:	ff 75 10             	push   0x10(%ebp)
+  804086:	56                   	push   %esi
+  804087:	53                   	push   %ebx
+  804088:	e8 d5 d4 ff ff       	call   801562 <sys_futex_wait>
+  80408d:	89 c6                	mov    %eax,%esi
+  80408f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804094:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804099:	89 3c 24             	mov    %edi,(%esp)
+  80409c:	e8 13 ff ff ff       	call   803fb4 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  8040a1:	83 c4 10             	add    $0x10,%esp
+  8040a4:	83 fe ef             	cmp    $0xffffffef,%esi
+  8040a7:	74 05                	je     8040ae <cond_timedwait+0x4f>
+  8040a9:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8040ae:	89 f0                	mov    %esi,%eax
+  8040b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040b3:	5b                   	pop    %ebx
+  8040b4:	5e                   	pop    %esi
+  8040b5:	5f                   	pop    %edi
+  8040b6:	5d                   	pop    %ebp
+  8040b7:	c3                   	ret
+
+008040b8 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8040b8:	55                   	push   %ebp
+  8040b9:	89 e5                	mov    %esp,%ebp
+  8040bb:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  8040be:	6a ff                	push   $0xffffffff
+  8040c0:	ff 75 0c             	push   0xc(%ebp)
+  8040c3:	ff 75 08             	push   0x8(%ebp)
+  8040c6:	e8 94 ff ff ff       	call   80405f <cond_timedwait>
+}
+  8040cb:	83 c4 10             	add    $0x10,%esp
+  8040ce:	c9                   	leave
+  8040cf:	c3                   	ret
+
+008040d0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8040d0:	55                   	push   %ebp
+  8040d1:	89 e5                	mov    %esp,%ebp
+  8040d3:	83 ec 08             	sub    $0x8,%esp
+  8040d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040d9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040de:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8040e2:	8b 50 04             	mov    0x4(%eax),%edx
+  8040e5:	85 d2                	test   %edx,%edx
+  8040e7:	75 02                	jne    8040eb <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  8040e9:	c9                   	leave
+  8040ea:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  8040eb:	83 ec 08             	sub    $0x8,%esp
+  8040ee:	6a 01                	push   $0x1
+  8040f0:	50                   	push   %eax
+  8040f1:	e8 8e d4 ff ff       	call   801584 <sys_futex_wake>
+  8040f6:	83 c4 10             	add    $0x10,%esp
+}
+  8040f9:	eb ee                	jmp    8040e9 <cond_signal+0x19>
+
+008040fb <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8040fb:	55                   	push   %ebp
+  8040fc:	89 e5                	mov    %esp,%ebp
+  8040fe:	83 ec 08             	sub    $0x8,%esp
+  804101:	8b 45 08             	mov    0x8(%ebp),%eax
+  804104:	ba 01 00 00 00       	mov    $0x1,%edx
+  804109:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  80410d:	8b 50 04             	mov    0x4(%eax),%edx
+  804110:	85 d2                	test   %edx,%edx
+  804112:	75 02                	jne    804116 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  804114:	c9                   	leave
+  804115:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  804116:	83 ec 08             	sub    $0x8,%esp
+  804119:	68 00 04 00 00       	push   $0x400
+  80411e:	50                   	push   %eax
+  80411f:	e8 60 d4 ff ff       	call   801584 <sys_futex_wake>
+  804124:	83 c4 10             	add    $0x10,%esp
+}
+  804127:	eb eb                	jmp    804114 <cond_broadcast+0x19>
+
+00804129 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80412e:	c3                   	ret
+
+0080412f <devcons_poll>:
+{
+  80412f:	55                   	push   %ebp
+  804130:	89 e5                	mov    %esp,%ebp
+  804132:	53                   	push   %ebx
+  804133:	83 ec 04             	sub    $0x4,%esp
+  804136:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804139:	89 da                	mov    %ebx,%edx
+  80413b:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80413e:	83 3d f4 89 84 00 00 	cmpl   $0x0,0x8489f4
+  804145:	74 0c                	je     804153 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804147:	89 d8                	mov    %ebx,%eax
+  804149:	83 e0 01             	and    $0x1,%eax
+  80414c:	09 d0                	or     %edx,%eax
+}
+  80414e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804151:	c9                   	leave
+  804152:	c3                   	ret
+		cons_peek = sys_cgetc();
+  804153:	e8 6e cf ff ff       	call   8010c6 <sys_cgetc>
+  804158:	a3 f4 89 84 00       	mov    %eax,0x8489f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80415d:	89 da                	mov    %ebx,%edx
+  80415f:	83 e2 04             	and    $0x4,%edx
+  804162:	85 c0                	test   %eax,%eax
+  804164:	74 e6                	je     80414c <devcons_poll+0x1d>
+  804166:	eb df                	jmp    804147 <devcons_poll+0x18>
+
+00804168 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804168:	55                   	push   %ebp
+  804169:	89 e5                	mov    %esp,%ebp
+  80416b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80416e:	68 4c 4f 80 00       	push   $0x804f4c
+  804173:	ff 75 0c             	push   0xc(%ebp)
+  804176:	e8 b5 cb ff ff       	call   800d30 <strcpy>
+	return 0;
+}
+  80417b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804180:	c9                   	leave
+  804181:	c3                   	ret
+
+00804182 <devcons_write>:
+{
+  804182:	55                   	push   %ebp
+  804183:	89 e5                	mov    %esp,%ebp
+  804185:	57                   	push   %edi
+  804186:	56                   	push   %esi
+  804187:	53                   	push   %ebx
+  804188:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80418e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804191:	85 ff                	test   %edi,%edi
+  804193:	74 51                	je     8041e6 <devcons_write+0x64>
+  804195:	be 00 00 00 00       	mov    $0x0,%esi
+  80419a:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80419f:	89 fb                	mov    %edi,%ebx
+  8041a1:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8041a3:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8041a8:	39 d3                	cmp    %edx,%ebx
+  8041aa:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8041ad:	83 ec 04             	sub    $0x4,%esp
+  8041b0:	53                   	push   %ebx
+  8041b1:	03 45 0c             	add    0xc(%ebp),%eax
+  8041b4:	50                   	push   %eax
+  8041b5:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8041bb:	50                   	push   %eax
+  8041bc:	e8 1f cd ff ff       	call   800ee0 <memmove>
+		sys_cputs(buf, m);
+  8041c1:	83 c4 08             	add    $0x8,%esp
+  8041c4:	53                   	push   %ebx
+  8041c5:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8041cb:	50                   	push   %eax
+  8041cc:	e8 d7 ce ff ff       	call   8010a8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8041d1:	01 de                	add    %ebx,%esi
+  8041d3:	89 f0                	mov    %esi,%eax
+  8041d5:	83 c4 10             	add    $0x10,%esp
+  8041d8:	39 fe                	cmp    %edi,%esi
+  8041da:	72 c3                	jb     80419f <devcons_write+0x1d>
+}
+  8041dc:	89 f0                	mov    %esi,%eax
+  8041de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041e1:	5b                   	pop    %ebx
+  8041e2:	5e                   	pop    %esi
+  8041e3:	5f                   	pop    %edi
+  8041e4:	5d                   	pop    %ebp
+  8041e5:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8041e6:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8041eb:	eb ef                	jmp    8041dc <devcons_write+0x5a>
+
+008041ed <devcons_read>:
+{
+  8041ed:	55                   	push   %ebp
+  8041ee:	89 e5                	mov    %esp,%ebp
+  8041f0:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8041f3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8041f8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8041fc:	74 36                	je     804234 <devcons_read+0x47>
+	c = cons_peek;
+  8041fe:	a1 f4 89 84 00       	mov    0x8489f4,%eax
+	cons_peek = 0;
+  804203:	c7 05 f4 89 84 00 00 	movl   $0x0,0x8489f4
+  80420a:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80420d:	85 c0                	test   %eax,%eax
+  80420f:	75 10                	jne    804221 <devcons_read+0x34>
+  804211:	e8 b0 ce ff ff       	call   8010c6 <sys_cgetc>
+  804216:	85 c0                	test   %eax,%eax
+  804218:	75 07                	jne    804221 <devcons_read+0x34>
+		sys_yield();
+  80421a:	e8 26 cf ff ff       	call   801145 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80421f:	eb f0                	jmp    804211 <devcons_read+0x24>
+	if (c < 0)
+  804221:	85 c0                	test   %eax,%eax
+  804223:	78 0f                	js     804234 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  804225:	83 f8 04             	cmp    $0x4,%eax
+  804228:	74 0c                	je     804236 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80422a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80422d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80422f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804234:	c9                   	leave
+  804235:	c3                   	ret
+		return 0;
+  804236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423b:	eb f7                	jmp    804234 <devcons_read+0x47>
+
+0080423d <cputchar>:
+{
+  80423d:	55                   	push   %ebp
+  80423e:	89 e5                	mov    %esp,%ebp
+  804240:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804243:	8b 45 08             	mov    0x8(%ebp),%eax
+  804246:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804249:	6a 01                	push   $0x1
+  80424b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80424e:	50                   	push   %eax
+  80424f:	e8 54 ce ff ff       	call   8010a8 <sys_cputs>
+}
+  804254:	83 c4 10             	add    $0x10,%esp
+  804257:	c9                   	leave
+  804258:	c3                   	ret
+
+00804259 <getchar>:
+{
+  804259:	55                   	push   %ebp
+  80425a:	89 e5                	mov    %esp,%ebp
+  80425c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80425f:	6a 01                	push   $0x1
+  804261:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804264:	50                   	push   %eax
+  804265:	6a 00                	push   $0x0
+  804267:	e8 d2 dd ff ff       	call   80203e <read>
+	if (r < 0)
+  80426c:	83 c4 10             	add    $0x10,%esp
+  80426f:	85 c0                	test   %eax,%eax
+  804271:	78 06                	js     804279 <getchar+0x20>
+	if (r < 1)
+  804273:	74 06                	je     80427b <getchar+0x22>
+	return c;
+  804275:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804279:	c9                   	leave
+  80427a:	c3                   	ret
+		return -E_EOF;
+  80427b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804280:	eb f7                	jmp    804279 <getchar+0x20>
+
+00804282 <iscons>:
+{
+  804282:	55                   	push   %ebp
+  804283:	89 e5                	mov    %esp,%ebp
+  804285:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804288:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80428b:	50                   	push   %eax
+  80428c:	ff 75 08             	push   0x8(%ebp)
+  80428f:	e8 26 db ff ff       	call   801dba <fd_lookup>
+  804294:	83 c4 10             	add    $0x10,%esp
+  804297:	85 c0                	test   %eax,%eax
+  804299:	78 11                	js     8042ac <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80429b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80429e:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8042a4:	39 10                	cmp    %edx,(%eax)
+  8042a6:	0f 94 c0             	sete   %al
+  8042a9:	0f b6 c0             	movzbl %al,%eax
+}
+  8042ac:	c9                   	leave
+  8042ad:	c3                   	ret
+
+008042ae <opencons>:
+{
+  8042ae:	55                   	push   %ebp
+  8042af:	89 e5                	mov    %esp,%ebp
+  8042b1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8042b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042b7:	50                   	push   %eax
+  8042b8:	e8 ad da ff ff       	call   801d6a <fd_alloc>
+  8042bd:	83 c4 10             	add    $0x10,%esp
+  8042c0:	85 c0                	test   %eax,%eax
+  8042c2:	78 3a                	js     8042fe <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8042c4:	83 ec 04             	sub    $0x4,%esp
+  8042c7:	68 07 04 00 00       	push   $0x407
+  8042cc:	ff 75 f4             	push   -0xc(%ebp)
+  8042cf:	6a 00                	push   $0x0
+  8042d1:	e8 8e ce ff ff       	call   801164 <sys_page_alloc>
+  8042d6:	83 c4 10             	add    $0x10,%esp
+  8042d9:	85 c0                	test   %eax,%eax
+  8042db:	78 21                	js     8042fe <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8042dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042e0:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8042e6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8042e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042eb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8042f2:	83 ec 0c             	sub    $0xc,%esp
+  8042f5:	50                   	push   %eax
+  8042f6:	e8 48 da ff ff       	call   801d43 <fd2num>
+  8042fb:	83 c4 10             	add    $0x10,%esp
+}
+  8042fe:	c9                   	leave
+  8042ff:	c3                   	ret
+
+00804300 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804300:	55                   	push   %ebp
+  804301:	89 e5                	mov    %esp,%ebp
+  804303:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804306:	83 3d 00 b0 84 00 00 	cmpl   $0x0,0x84b000
+  80430d:	74 0a                	je     804319 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80430f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804312:	a3 00 b0 84 00       	mov    %eax,0x84b000
+}
+  804317:	c9                   	leave
+  804318:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804319:	83 ec 04             	sub    $0x4,%esp
+  80431c:	6a 07                	push   $0x7
+  80431e:	68 00 f0 bf ee       	push   $0xeebff000
+  804323:	6a 00                	push   $0x0
+  804325:	e8 3a ce ff ff       	call   801164 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80432a:	83 c4 08             	add    $0x8,%esp
+  80432d:	68 3e 43 80 00       	push   $0x80433e
+  804332:	6a 00                	push   $0x0
+  804334:	e8 76 cf ff ff       	call   8012af <sys_env_set_pgfault_upcall>
+  804339:	83 c4 10             	add    $0x10,%esp
+  80433c:	eb d1                	jmp    80430f <set_pgfault_handler+0xf>
+
+0080433e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80433e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80433f:	a1 00 b0 84 00       	mov    0x84b000,%eax
+	call *%eax
+  804344:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804346:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804349:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  80434d:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804350:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804354:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804356:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80435a:	83 c4 08             	add    $0x8,%esp
+	popal;
+  80435d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80435e:	83 c4 04             	add    $0x4,%esp
+	popf
+  804361:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804362:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804363:	c3                   	ret
+
+00804364 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804364:	55                   	push   %ebp
+  804365:	89 e5                	mov    %esp,%ebp
+  804367:	56                   	push   %esi
+  804368:	53                   	push   %ebx
+  804369:	8b 75 08             	mov    0x8(%ebp),%esi
+  80436c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80436f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804372:	85 c0                	test   %eax,%eax
+  804374:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804379:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80437c:	83 ec 0c             	sub    $0xc,%esp
+  80437f:	50                   	push   %eax
+  804380:	e8 8f cf ff ff       	call   801314 <sys_ipc_recv>
+  804385:	83 c4 10             	add    $0x10,%esp
+  804388:	85 c0                	test   %eax,%eax
+  80438a:	0f 88 8b 00 00 00    	js     80441b <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804390:	85 f6                	test   %esi,%esi
+  804392:	74 2a                	je     8043be <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804394:	89 e2                	mov    %esp,%edx
+  804396:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80439b:	29 d0                	sub    %edx,%eax
+  80439d:	89 c2                	mov    %eax,%edx
+  80439f:	c1 ea 0f             	shr    $0xf,%edx
+  8043a2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ac:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8043af:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8043b6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8043bc:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8043be:	85 db                	test   %ebx,%ebx
+  8043c0:	74 2a                	je     8043ec <ipc_recv+0x88>
+  8043c2:	89 e2                	mov    %esp,%edx
+  8043c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043c9:	29 d0                	sub    %edx,%eax
+  8043cb:	89 c2                	mov    %eax,%edx
+  8043cd:	c1 ea 0f             	shr    $0xf,%edx
+  8043d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043da:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8043dd:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8043e4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8043ea:	89 03                	mov    %eax,(%ebx)
+  8043ec:	89 e2                	mov    %esp,%edx
+  8043ee:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043f3:	29 d0                	sub    %edx,%eax
+  8043f5:	89 c2                	mov    %eax,%edx
+  8043f7:	c1 ea 0f             	shr    $0xf,%edx
+  8043fa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804404:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804407:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  80440e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804417:	5b                   	pop    %ebx
+  804418:	5e                   	pop    %esi
+  804419:	5d                   	pop    %ebp
+  80441a:	c3                   	ret
+		if(from_env_store != NULL)
+  80441b:	85 f6                	test   %esi,%esi
+  80441d:	74 06                	je     804425 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80441f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804425:	85 db                	test   %ebx,%ebx
+  804427:	74 eb                	je     804414 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804429:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80442f:	eb e3                	jmp    804414 <ipc_recv+0xb0>
+
+00804431 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804431:	55                   	push   %ebp
+  804432:	89 e5                	mov    %esp,%ebp
+  804434:	57                   	push   %edi
+  804435:	56                   	push   %esi
+  804436:	53                   	push   %ebx
+  804437:	83 ec 14             	sub    $0x14,%esp
+  80443a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80443d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804440:	8b 75 14             	mov    0x14(%ebp),%esi
+  804443:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804446:	85 c0                	test   %eax,%eax
+  804448:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80444d:	0f 44 c2             	cmove  %edx,%eax
+  804450:	ff 75 10             	push   0x10(%ebp)
+  804453:	50                   	push   %eax
+  804454:	e8 1d cf ff ff       	call   801376 <sys_ipc_recv_pages>
+  804459:	83 c4 10             	add    $0x10,%esp
+  80445c:	85 c0                	test   %eax,%eax
+  80445e:	0f 88 ba 00 00 00    	js     80451e <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804464:	85 ff                	test   %edi,%edi
+  804466:	74 2a                	je     804492 <ipc_recv_pages+0x61>
+  804468:	89 e2                	mov    %esp,%edx
+  80446a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80446f:	29 d0                	sub    %edx,%eax
+  804471:	89 c2                	mov    %eax,%edx
+  804473:	c1 ea 0f             	shr    $0xf,%edx
+  804476:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80447b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804480:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804483:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  80448a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804490:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804492:	85 f6                	test   %esi,%esi
+  804494:	74 2a                	je     8044c0 <ipc_recv_pages+0x8f>
+  804496:	89 e2                	mov    %esp,%edx
+  804498:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80449d:	29 d0                	sub    %edx,%eax
+  80449f:	89 c2                	mov    %eax,%edx
+  8044a1:	c1 ea 0f             	shr    $0xf,%edx
+  8044a4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8044a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ae:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8044b1:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8044b8:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8044be:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8044c0:	85 db                	test   %ebx,%ebx
+  8044c2:	74 2a                	je     8044ee <ipc_recv_pages+0xbd>
+  8044c4:	89 e2                	mov    %esp,%edx
+  8044c6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8044cb:	29 d0                	sub    %edx,%eax
+  8044cd:	89 c2                	mov    %eax,%edx
+  8044cf:	c1 ea 0f             	shr    $0xf,%edx
+  8044d2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8044d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044dc:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8044df:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  8044e6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8044ec:	89 03                	mov    %eax,(%ebx)
+  8044ee:	89 e2                	mov    %esp,%edx
+  8044f0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8044f5:	29 d0                	sub    %edx,%eax
+  8044f7:	89 c2                	mov    %eax,%edx
+  8044f9:	c1 ea 0f             	shr    $0xf,%edx
+  8044fc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804501:	b8 00 00 00 00       	mov    $0x0,%eax
+  804506:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804509:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  804510:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804519:	5b                   	pop    %ebx
+  80451a:	5e                   	pop    %esi
+  80451b:	5f                   	pop    %edi
+  80451c:	5d                   	pop    %ebp
+  80451d:	c3                   	ret
+		if (from_env_store)
+  80451e:	85 ff                	test   %edi,%edi
+  804520:	74 06                	je     804528 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804522:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804528:	85 f6                	test   %esi,%esi
+  80452a:	74 06                	je     804532 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80452c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804532:	85 db                	test   %ebx,%ebx
+  804534:	74 e0                	je     804516 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804536:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80453c:	eb d8                	jmp    804516 <ipc_recv_pages+0xe5>
+
+0080453e <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80453e:	55                   	push   %ebp
+  80453f:	89 e5                	mov    %esp,%ebp
+  804541:	57                   	push   %edi
+  804542:	56                   	push   %esi
+  804543:	53                   	push   %ebx
+  804544:	83 ec 1c             	sub    $0x1c,%esp
+  804547:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80454a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80454d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804553:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804557:	75 2b                	jne    804584 <ipc_try_send_pages+0x46>
+  804559:	89 e2                	mov    %esp,%edx
+  80455b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804560:	29 d0                	sub    %edx,%eax
+  804562:	89 c2                	mov    %eax,%edx
+  804564:	c1 ea 0f             	shr    $0xf,%edx
+  804567:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80456c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804571:	0f 42 c2             	cmovb  %edx,%eax
+  804574:	8b 04 85 00 8a 84 00 	mov    0x848a00(,%eax,4),%eax
+  80457b:	8b 70 48             	mov    0x48(%eax),%esi
+  80457e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804584:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80458a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80458f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804592:	85 ff                	test   %edi,%edi
+  804594:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804599:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80459c:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8045a2:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8045a8:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8045ae:	83 ec 0c             	sub    $0xc,%esp
+  8045b1:	ff 75 14             	push   0x14(%ebp)
+  8045b4:	ff 75 18             	push   0x18(%ebp)
+  8045b7:	57                   	push   %edi
+  8045b8:	ff 75 0c             	push   0xc(%ebp)
+  8045bb:	ff 75 08             	push   0x8(%ebp)
+  8045be:	e8 92 cd ff ff       	call   801355 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8045c3:	83 c4 20             	add    $0x20,%esp
+  8045c6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8045c9:	75 21                	jne    8045ec <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8045cb:	83 ec 04             	sub    $0x4,%esp
+  8045ce:	6a ff                	push   $0xffffffff
+  8045d0:	53                   	push   %ebx
+  8045d1:	ff 75 e4             	push   -0x1c(%ebp)
+  8045d4:	e8 89 cf ff ff       	call   801562 <sys_futex_wait>
+  8045d9:	83 c4 10             	add    $0x10,%esp
+  8045dc:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8045df:	74 c7                	je     8045a8 <ipc_try_send_pages+0x6a>
+  8045e1:	85 c0                	test   %eax,%eax
+  8045e3:	79 c3                	jns    8045a8 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8045e5:	e8 5b cb ff ff       	call   801145 <sys_yield>
+  8045ea:	eb bc                	jmp    8045a8 <ipc_try_send_pages+0x6a>
+	}
+}
+  8045ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045ef:	5b                   	pop    %ebx
+  8045f0:	5e                   	pop    %esi
+  8045f1:	5f                   	pop    %edi
+  8045f2:	5d                   	pop    %ebp
+  8045f3:	c3                   	ret
+
+008045f4 <ipc_send>:
+{
+  8045f4:	55                   	push   %ebp
+  8045f5:	89 e5                	mov    %esp,%ebp
+  8045f7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8045fa:	ff 75 14             	push   0x14(%ebp)
+  8045fd:	6a 01                	push   $0x1
+  8045ff:	ff 75 10             	push   0x10(%ebp)
+  804602:	ff 75 0c             	push   0xc(%ebp)
+  804605:	ff 75 08             	push   0x8(%ebp)
+  804608:	e8 31 ff ff ff       	call   80453e <ipc_try_send_pages>
+  80460d:	83 c4 20             	add    $0x20,%esp
+  804610:	85 c0                	test   %eax,%eax
+  804612:	78 02                	js     804616 <ipc_send+0x22>
+}
+  804614:	c9                   	leave
+  804615:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804616:	50                   	push   %eax
+  804617:	68 58 4f 80 00       	push   $0x804f58
+  80461c:	6a 3f                	push   $0x3f
+  80461e:	68 6d 4f 80 00       	push   $0x804f6d
+  804623:	e8 36 bf ff ff       	call   80055e <_panic>
+
+00804628 <ipc_send_pages>:
+{
+  804628:	55                   	push   %ebp
+  804629:	89 e5                	mov    %esp,%ebp
+  80462b:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80462e:	ff 75 18             	push   0x18(%ebp)
+  804631:	ff 75 14             	push   0x14(%ebp)
+  804634:	ff 75 10             	push   0x10(%ebp)
+  804637:	ff 75 0c             	push   0xc(%ebp)
+  80463a:	ff 75 08             	push   0x8(%ebp)
+  80463d:	e8 fc fe ff ff       	call   80453e <ipc_try_send_pages>
+  804642:	83 c4 20             	add    $0x20,%esp
+  804645:	85 c0                	test   %eax,%eax
+  804647:	78 02                	js     80464b <ipc_send_pages+0x23>
+}
+  804649:	c9                   	leave
+  80464a:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80464b:	50                   	push   %eax
+  80464c:	68 77 4f 80 00       	push   $0x804f77
+  804651:	6a 64                	push   $0x64
+  804653:	68 6d 4f 80 00       	push   $0x804f6d
+  804658:	e8 01 bf ff ff       	call   80055e <_panic>
+
+0080465d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80465d:	55                   	push   %ebp
+  80465e:	89 e5                	mov    %esp,%ebp
+  804660:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804663:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804668:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80466e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804674:	8b 52 50             	mov    0x50(%edx),%edx
+  804677:	39 ca                	cmp    %ecx,%edx
+  804679:	74 11                	je     80468c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80467b:	83 c0 01             	add    $0x1,%eax
+  80467e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804683:	75 e3                	jne    804668 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468a:	eb 0e                	jmp    80469a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80468c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804692:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804697:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80469a:	5d                   	pop    %ebp
+  80469b:	c3                   	ret
+
+0080469c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80469c:	55                   	push   %ebp
+  80469d:	89 e5                	mov    %esp,%ebp
+  80469f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8046a2:	89 c2                	mov    %eax,%edx
+  8046a4:	c1 ea 16             	shr    $0x16,%edx
+  8046a7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8046ae:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8046b3:	f6 c1 01             	test   $0x1,%cl
+  8046b6:	74 1e                	je     8046d6 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8046b8:	c1 e8 0c             	shr    $0xc,%eax
+  8046bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8046c2:	a8 01                	test   $0x1,%al
+  8046c4:	74 10                	je     8046d6 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8046c6:	c1 e8 0c             	shr    $0xc,%eax
+  8046c9:	c1 e0 04             	shl    $0x4,%eax
+  8046cc:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8046d3:	0f b7 d2             	movzwl %dx,%edx
+}
+  8046d6:	89 d0                	mov    %edx,%eax
+  8046d8:	5d                   	pop    %ebp
+  8046d9:	c3                   	ret
+
+008046da <__udivdi3>:
+  8046da:	57                   	push   %edi
+  8046db:	56                   	push   %esi
+  8046dc:	53                   	push   %ebx
+  8046dd:	83 ec 20             	sub    $0x20,%esp
+  8046e0:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8046e4:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8046e8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8046ec:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8046f0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046f4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046f8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8046fc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804700:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80470f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804716:	00 
+  804717:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80471e:	00 
+  80471f:	eb 08                	jmp    804729 <__udivdi3+0x4f>
+  804721:	83 e9 01             	sub    $0x1,%ecx
+  804724:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804727:	74 68                	je     804791 <__udivdi3+0xb7>
+  804729:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80472d:	01 c0                	add    %eax,%eax
+  80472f:	89 c6                	mov    %eax,%esi
+  804731:	89 d7                	mov    %edx,%edi
+  804733:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804737:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80473b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80473e:	d3 ea                	shr    %cl,%edx
+  804740:	f6 c1 20             	test   $0x20,%cl
+  804743:	74 04                	je     804749 <__udivdi3+0x6f>
+  804745:	89 d0                	mov    %edx,%eax
+  804747:	31 d2                	xor    %edx,%edx
+  804749:	83 e0 01             	and    $0x1,%eax
+  80474c:	89 04 24             	mov    %eax,(%esp)
+  80474f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804756:	00 
+  804757:	8b 04 24             	mov    (%esp),%eax
+  80475a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80475e:	09 f0                	or     %esi,%eax
+  804760:	09 fa                	or     %edi,%edx
+  804762:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804766:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80476a:	39 f0                	cmp    %esi,%eax
+  80476c:	89 d3                	mov    %edx,%ebx
+  80476e:	19 fb                	sbb    %edi,%ebx
+  804770:	72 af                	jb     804721 <__udivdi3+0x47>
+  804772:	29 f0                	sub    %esi,%eax
+  804774:	19 fa                	sbb    %edi,%edx
+  804776:	89 cf                	mov    %ecx,%edi
+  804778:	c1 ef 05             	shr    $0x5,%edi
+  80477b:	83 e7 01             	and    $0x1,%edi
+  80477e:	89 fe                	mov    %edi,%esi
+  804780:	83 f6 01             	xor    $0x1,%esi
+  804783:	d3 e6                	shl    %cl,%esi
+  804785:	d3 e7                	shl    %cl,%edi
+  804787:	09 74 24 18          	or     %esi,0x18(%esp)
+  80478b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80478f:	eb 90                	jmp    804721 <__udivdi3+0x47>
+  804791:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804795:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804799:	83 c4 20             	add    $0x20,%esp
+  80479c:	5b                   	pop    %ebx
+  80479d:	5e                   	pop    %esi
+  80479e:	5f                   	pop    %edi
+  80479f:	c3                   	ret
+
+008047a0 <__umoddi3>:
+  8047a0:	57                   	push   %edi
+  8047a1:	56                   	push   %esi
+  8047a2:	53                   	push   %ebx
+  8047a3:	83 ec 08             	sub    $0x8,%esp
+  8047a6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8047aa:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8047ae:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8047b2:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8047b6:	57                   	push   %edi
+  8047b7:	56                   	push   %esi
+  8047b8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8047bc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8047c0:	52                   	push   %edx
+  8047c1:	50                   	push   %eax
+  8047c2:	e8 13 ff ff ff       	call   8046da <__udivdi3>
+  8047c7:	89 c3                	mov    %eax,%ebx
+  8047c9:	0f af d6             	imul   %esi,%edx
+  8047cc:	89 f9                	mov    %edi,%ecx
+  8047ce:	0f af cb             	imul   %ebx,%ecx
+  8047d1:	01 d1                	add    %edx,%ecx
+  8047d3:	89 d8                	mov    %ebx,%eax
+  8047d5:	f7 e6                	mul    %esi
+  8047d7:	89 c6                	mov    %eax,%esi
+  8047d9:	89 d7                	mov    %edx,%edi
+  8047db:	01 cf                	add    %ecx,%edi
+  8047dd:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8047e1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8047e5:	29 f0                	sub    %esi,%eax
+  8047e7:	19 fa                	sbb    %edi,%edx
+  8047e9:	83 c4 18             	add    $0x18,%esp
+  8047ec:	5b                   	pop    %ebx
+  8047ed:	5e                   	pop    %esi
+  8047ee:	5f                   	pop    %edi
+  8047ef:	c3                   	ret
+
+008047f0 <__divdi3>:
+  8047f0:	53                   	push   %ebx
+  8047f1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8047f5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8047f9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8047fd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804801:	85 d2                	test   %edx,%edx
+  804803:	78 12                	js     804817 <__divdi3+0x27>
+  804805:	85 db                	test   %ebx,%ebx
+  804807:	78 2e                	js     804837 <__divdi3+0x47>
+  804809:	53                   	push   %ebx
+  80480a:	51                   	push   %ecx
+  80480b:	52                   	push   %edx
+  80480c:	50                   	push   %eax
+  80480d:	e8 c8 fe ff ff       	call   8046da <__udivdi3>
+  804812:	83 c4 10             	add    $0x10,%esp
+  804815:	eb 1e                	jmp    804835 <__divdi3+0x45>
+  804817:	f7 d8                	neg    %eax
+  804819:	83 d2 00             	adc    $0x0,%edx
+  80481c:	f7 da                	neg    %edx
+  80481e:	85 db                	test   %ebx,%ebx
+  804820:	78 2a                	js     80484c <__divdi3+0x5c>
+  804822:	53                   	push   %ebx
+  804823:	51                   	push   %ecx
+  804824:	52                   	push   %edx
+  804825:	50                   	push   %eax
+  804826:	e8 af fe ff ff       	call   8046da <__udivdi3>
+  80482b:	83 c4 10             	add    $0x10,%esp
+  80482e:	f7 d8                	neg    %eax
+  804830:	83 d2 00             	adc    $0x0,%edx
+  804833:	f7 da                	neg    %edx
+  804835:	5b                   	pop    %ebx
+  804836:	c3                   	ret
+  804837:	f7 d9                	neg    %ecx
+  804839:	83 d3 00             	adc    $0x0,%ebx
+  80483c:	f7 db                	neg    %ebx
+  80483e:	53                   	push   %ebx
+  80483f:	51                   	push   %ecx
+  804840:	52                   	push   %edx
+  804841:	50                   	push   %eax
+  804842:	e8 93 fe ff ff       	call   8046da <__udivdi3>
+  804847:	83 c4 10             	add    $0x10,%esp
+  80484a:	eb e2                	jmp    80482e <__divdi3+0x3e>
+  80484c:	f7 d9                	neg    %ecx
+  80484e:	83 d3 00             	adc    $0x0,%ebx
+  804851:	f7 db                	neg    %ebx
+  804853:	53                   	push   %ebx
+  804854:	51                   	push   %ecx
+  804855:	52                   	push   %edx
+  804856:	50                   	push   %eax
+  804857:	e8 7e fe ff ff       	call   8046da <__udivdi3>
+  80485c:	83 c4 10             	add    $0x10,%esp
+  80485f:	eb d4                	jmp    804835 <__divdi3+0x45>
+
+00804861 <__moddi3>:
+  804861:	57                   	push   %edi
+  804862:	56                   	push   %esi
+  804863:	53                   	push   %ebx
+  804864:	83 ec 08             	sub    $0x8,%esp
+  804867:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80486b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80486f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804873:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804877:	57                   	push   %edi
+  804878:	56                   	push   %esi
+  804879:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80487d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804881:	52                   	push   %edx
+  804882:	50                   	push   %eax
+  804883:	e8 68 ff ff ff       	call   8047f0 <__divdi3>
+  804888:	89 c3                	mov    %eax,%ebx
+  80488a:	0f af d6             	imul   %esi,%edx
+  80488d:	89 f9                	mov    %edi,%ecx
+  80488f:	0f af cb             	imul   %ebx,%ecx
+  804892:	01 d1                	add    %edx,%ecx
+  804894:	89 d8                	mov    %ebx,%eax
+  804896:	f7 e6                	mul    %esi
+  804898:	89 c6                	mov    %eax,%esi
+  80489a:	89 d7                	mov    %edx,%edi
+  80489c:	01 cf                	add    %ecx,%edi
+  80489e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8048a2:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8048a6:	29 f0                	sub    %esi,%eax
+  8048a8:	19 fa                	sbb    %edi,%edx
+  8048aa:	83 c4 18             	add    $0x18,%esp
+  8048ad:	5b                   	pop    %ebx
+  8048ae:	5e                   	pop    %esi
+  8048af:	5f                   	pop    %edi
+  8048b0:	c3                   	ret
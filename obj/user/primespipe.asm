@@ -0,0 +1,9252 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9e 02 00 00       	call   8002cf <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <primeproc>:
+static int nprimes;		// Primes still to find, or 0 for no limit
+static unsigned start;
+
+unsigned
+primeproc(int fd)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 1c             	sub    $0x1c,%esp
+  80003e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  800041:	8d 75 e0             	lea    -0x20(%ebp),%esi
+			p, sys_time_msec() - start);
+		exit();
+	}
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800044:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  800047:	eb 77                	jmp    8000c0 <primeproc+0x8b>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  800049:	83 ec 0c             	sub    $0xc,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800053:	0f 4e d0             	cmovle %eax,%edx
+  800056:	52                   	push   %edx
+  800057:	50                   	push   %eax
+  800058:	68 80 46 80 00       	push   $0x804680
+  80005d:	6a 1c                	push   $0x1c
+  80005f:	68 d7 46 80 00       	push   $0x8046d7
+  800064:	e8 0d 03 00 00       	call   800376 <_panic>
+		cprintf("%d\n", p);
+  800069:	83 ec 08             	sub    $0x8,%esp
+  80006c:	ff 75 e0             	push   -0x20(%ebp)
+  80006f:	68 e9 46 80 00       	push   $0x8046e9
+  800074:	e8 d8 03 00 00       	call   800451 <cprintf>
+  800079:	83 c4 10             	add    $0x10,%esp
+	if ((i=pipe(pfd)) < 0)
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	57                   	push   %edi
+  800080:	e8 b4 39 00 00       	call   803a39 <pipe>
+  800085:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	0f 88 81 00 00 00    	js     800114 <primeproc+0xdf>
+		panic("pipe: %e", i);
+	if ((id = fork()) < 0)
+  800093:	e8 ec 14 00 00       	call   801584 <fork>
+  800098:	85 c0                	test   %eax,%eax
+  80009a:	0f 88 86 00 00 00    	js     800126 <primeproc+0xf1>
+		panic("fork: %e", id);
+	if (id == 0) {
+  8000a0:	0f 85 92 00 00 00    	jne    800138 <primeproc+0x103>
+		close(fd);
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	53                   	push   %ebx
+  8000aa:	e8 68 1c 00 00       	call   801d17 <close>
+		close(pfd[1]);
+  8000af:	83 c4 04             	add    $0x4,%esp
+  8000b2:	ff 75 dc             	push   -0x24(%ebp)
+  8000b5:	e8 5d 1c 00 00       	call   801d17 <close>
+		fd = pfd[0];
+  8000ba:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		goto top;
+  8000bd:	83 c4 10             	add    $0x10,%esp
+	if ((r = readn(fd, &p, 4)) != 4)
+  8000c0:	83 ec 04             	sub    $0x4,%esp
+  8000c3:	6a 04                	push   $0x4
+  8000c5:	56                   	push   %esi
+  8000c6:	53                   	push   %ebx
+  8000c7:	e8 2e 1e 00 00       	call   801efa <readn>
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	83 f8 04             	cmp    $0x4,%eax
+  8000d2:	0f 85 71 ff ff ff    	jne    800049 <primeproc+0x14>
+	if (nprimes == 0)
+  8000d8:	a1 04 60 80 00       	mov    0x806004,%eax
+  8000dd:	85 c0                	test   %eax,%eax
+  8000df:	74 88                	je     800069 <primeproc+0x34>
+	else if (--nprimes == 0) {
+  8000e1:	83 e8 01             	sub    $0x1,%eax
+  8000e4:	a3 04 60 80 00       	mov    %eax,0x806004
+  8000e9:	75 91                	jne    80007c <primeproc+0x47>
+			p, sys_time_msec() - start);
+  8000eb:	e8 e0 10 00 00       	call   8011d0 <sys_time_msec>
+		cprintf("primespipe: last prime %d after %u ms\n",
+  8000f0:	83 ec 04             	sub    $0x4,%esp
+  8000f3:	2b 05 00 60 80 00    	sub    0x806000,%eax
+  8000f9:	50                   	push   %eax
+  8000fa:	ff 75 e0             	push   -0x20(%ebp)
+  8000fd:	68 b0 46 80 00       	push   $0x8046b0
+  800102:	e8 4a 03 00 00       	call   800451 <cprintf>
+		exit();
+  800107:	e8 50 02 00 00       	call   80035c <exit>
+  80010c:	83 c4 10             	add    $0x10,%esp
+  80010f:	e9 68 ff ff ff       	jmp    80007c <primeproc+0x47>
+		panic("pipe: %e", i);
+  800114:	50                   	push   %eax
+  800115:	68 ed 46 80 00       	push   $0x8046ed
+  80011a:	6a 28                	push   $0x28
+  80011c:	68 d7 46 80 00       	push   $0x8046d7
+  800121:	e8 50 02 00 00       	call   800376 <_panic>
+		panic("fork: %e", id);
+  800126:	50                   	push   %eax
+  800127:	68 3d 4b 80 00       	push   $0x804b3d
+  80012c:	6a 2a                	push   $0x2a
+  80012e:	68 d7 46 80 00       	push   $0x8046d7
+  800133:	e8 3e 02 00 00       	call   800376 <_panic>
+	}
+
+	close(pfd[0]);
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	ff 75 d8             	push   -0x28(%ebp)
+  80013e:	e8 d4 1b 00 00       	call   801d17 <close>
+	wfd = pfd[1];
+  800143:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  800146:	83 c4 10             	add    $0x10,%esp
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  800149:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80014c:	83 ec 04             	sub    $0x4,%esp
+  80014f:	6a 04                	push   $0x4
+  800151:	56                   	push   %esi
+  800152:	53                   	push   %ebx
+  800153:	e8 a2 1d 00 00       	call   801efa <readn>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	83 f8 04             	cmp    $0x4,%eax
+  80015e:	75 49                	jne    8001a9 <primeproc+0x174>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+		if (i%p) {
+  800160:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800163:	99                   	cltd
+  800164:	f7 7d e0             	idivl  -0x20(%ebp)
+  800167:	85 d2                	test   %edx,%edx
+  800169:	74 e1                	je     80014c <primeproc+0x117>
+			if ((r=write(wfd, &i, 4)) == 0)
+  80016b:	83 ec 04             	sub    $0x4,%esp
+  80016e:	6a 04                	push   $0x4
+  800170:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800173:	50                   	push   %eax
+  800174:	57                   	push   %edi
+  800175:	e8 d4 1d 00 00       	call   801f4e <write>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	85 c0                	test   %eax,%eax
+  80017f:	74 4c                	je     8001cd <primeproc+0x198>
+				exit();	// right neighbor is gone
+			else if (r != 4)
+  800181:	83 f8 04             	cmp    $0x4,%eax
+  800184:	74 c6                	je     80014c <primeproc+0x117>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800190:	0f 4e d0             	cmovle %eax,%edx
+  800193:	52                   	push   %edx
+  800194:	50                   	push   %eax
+  800195:	ff 75 e0             	push   -0x20(%ebp)
+  800198:	68 12 47 80 00       	push   $0x804712
+  80019d:	6a 3d                	push   $0x3d
+  80019f:	68 d7 46 80 00       	push   $0x8046d7
+  8001a4:	e8 cd 01 00 00       	call   800376 <_panic>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  8001a9:	83 ec 04             	sub    $0x4,%esp
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b3:	0f 4e d0             	cmovle %eax,%edx
+  8001b6:	52                   	push   %edx
+  8001b7:	50                   	push   %eax
+  8001b8:	53                   	push   %ebx
+  8001b9:	ff 75 e0             	push   -0x20(%ebp)
+  8001bc:	68 f6 46 80 00       	push   $0x8046f6
+  8001c1:	6a 38                	push   $0x38
+  8001c3:	68 d7 46 80 00       	push   $0x8046d7
+  8001c8:	e8 a9 01 00 00       	call   800376 <_panic>
+				exit();	// right neighbor is gone
+  8001cd:	e8 8a 01 00 00       	call   80035c <exit>
+  8001d2:	e9 75 ff ff ff       	jmp    80014c <primeproc+0x117>
+
+008001d7 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	53                   	push   %ebx
+  8001db:	83 ec 14             	sub    $0x14,%esp
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  8001de:	c7 05 00 50 80 00 2c 	movl   $0x80472c,0x805000
+  8001e5:	47 80 00 
+	if (argc > 1)
+  8001e8:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8001ec:	7f 41                	jg     80022f <umain+0x58>
+		nprimes = strtol(argv[1], 0, 0);
+	start = sys_time_msec();
+  8001ee:	e8 dd 0f 00 00       	call   8011d0 <sys_time_msec>
+  8001f3:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	if ((i=pipe(p)) < 0)
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  8001fb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8001fe:	50                   	push   %eax
+  8001ff:	e8 35 38 00 00       	call   803a39 <pipe>
+  800204:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 3d                	js     80024b <umain+0x74>
+		panic("pipe: %e", i);
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80020e:	e8 71 13 00 00       	call   801584 <fork>
+  800213:	85 c0                	test   %eax,%eax
+  800215:	78 46                	js     80025d <umain+0x86>
+		panic("fork: %e", id);
+
+	if (id == 0) {
+  800217:	75 56                	jne    80026f <umain+0x98>
+		close(p[1]);
+  800219:	83 ec 0c             	sub    $0xc,%esp
+  80021c:	ff 75 f0             	push   -0x10(%ebp)
+  80021f:	e8 f3 1a 00 00       	call   801d17 <close>
+		primeproc(p[0]);
+  800224:	83 c4 04             	add    $0x4,%esp
+  800227:	ff 75 ec             	push   -0x14(%ebp)
+  80022a:	e8 06 fe ff ff       	call   800035 <primeproc>
+		nprimes = strtol(argv[1], 0, 0);
+  80022f:	83 ec 04             	sub    $0x4,%esp
+  800232:	6a 00                	push   $0x0
+  800234:	6a 00                	push   $0x0
+  800236:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800239:	ff 70 04             	push   0x4(%eax)
+  80023c:	e8 9a 0b 00 00       	call   800ddb <strtol>
+  800241:	a3 04 60 80 00       	mov    %eax,0x806004
+  800246:	83 c4 10             	add    $0x10,%esp
+  800249:	eb a3                	jmp    8001ee <umain+0x17>
+		panic("pipe: %e", i);
+  80024b:	50                   	push   %eax
+  80024c:	68 ed 46 80 00       	push   $0x8046ed
+  800251:	6a 4d                	push   $0x4d
+  800253:	68 d7 46 80 00       	push   $0x8046d7
+  800258:	e8 19 01 00 00       	call   800376 <_panic>
+		panic("fork: %e", id);
+  80025d:	50                   	push   %eax
+  80025e:	68 3d 4b 80 00       	push   $0x804b3d
+  800263:	6a 51                	push   $0x51
+  800265:	68 d7 46 80 00       	push   $0x8046d7
+  80026a:	e8 07 01 00 00       	call   800376 <_panic>
+	}
+
+	close(p[0]);
+  80026f:	83 ec 0c             	sub    $0xc,%esp
+  800272:	ff 75 ec             	push   -0x14(%ebp)
+  800275:	e8 9d 1a 00 00       	call   801d17 <close>
+  80027a:	83 c4 10             	add    $0x10,%esp
+  80027d:	b8 02 00 00 00       	mov    $0x2,%eax
+
+	// feed all the integers through
+	for (i=2;; i++)
+		if ((r=write(p[1], &i, 4)) == 0)
+  800282:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  800285:	eb 0b                	jmp    800292 <umain+0xbb>
+			exit();
+  800287:	e8 d0 00 00 00       	call   80035c <exit>
+	for (i=2;; i++)
+  80028c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80028f:	83 c0 01             	add    $0x1,%eax
+  800292:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((r=write(p[1], &i, 4)) == 0)
+  800295:	83 ec 04             	sub    $0x4,%esp
+  800298:	6a 04                	push   $0x4
+  80029a:	53                   	push   %ebx
+  80029b:	ff 75 f0             	push   -0x10(%ebp)
+  80029e:	e8 ab 1c 00 00       	call   801f4e <write>
+  8002a3:	83 c4 10             	add    $0x10,%esp
+  8002a6:	85 c0                	test   %eax,%eax
+  8002a8:	74 dd                	je     800287 <umain+0xb0>
+		else if (r != 4)
+  8002aa:	83 f8 04             	cmp    $0x4,%eax
+  8002ad:	74 dd                	je     80028c <umain+0xb5>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	85 c0                	test   %eax,%eax
+  8002b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b9:	0f 4e d0             	cmovle %eax,%edx
+  8002bc:	52                   	push   %edx
+  8002bd:	50                   	push   %eax
+  8002be:	68 37 47 80 00       	push   $0x804737
+  8002c3:	6a 5f                	push   $0x5f
+  8002c5:	68 d7 46 80 00       	push   $0x8046d7
+  8002ca:	e8 a7 00 00 00       	call   800376 <_panic>
+
+008002cf <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	56                   	push   %esi
+  8002d3:	53                   	push   %ebx
+  8002d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d7:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8002da:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8002dc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8002e1:	29 d0                	sub    %edx,%eax
+  8002e3:	89 c2                	mov    %eax,%edx
+  8002e5:	c1 ea 0f             	shr    $0xf,%edx
+  8002e8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8002ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f2:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8002f5:	c7 04 85 20 6a 80 00 	movl   $0x0,0x806a20(,%eax,4)
+  8002fc:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800300:	e8 39 0c 00 00       	call   800f3e <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800305:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80030a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800310:	89 e1                	mov    %esp,%ecx
+  800312:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800317:	29 ca                	sub    %ecx,%edx
+  800319:	89 d1                	mov    %edx,%ecx
+  80031b:	c1 e9 0f             	shr    $0xf,%ecx
+  80031e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800324:	ba 00 00 00 00       	mov    $0x0,%edx
+  800329:	0f 42 d1             	cmovb  %ecx,%edx
+  80032c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800331:	89 04 95 20 6a 80 00 	mov    %eax,0x806a20(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800338:	85 db                	test   %ebx,%ebx
+  80033a:	7e 07                	jle    800343 <libmain+0x74>
+		binaryname = argv[0];
+  80033c:	8b 06                	mov    (%esi),%eax
+  80033e:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800343:	83 ec 08             	sub    $0x8,%esp
+  800346:	56                   	push   %esi
+  800347:	53                   	push   %ebx
+  800348:	e8 8a fe ff ff       	call   8001d7 <umain>
+
+	// exit gracefully
+	exit();
+  80034d:	e8 0a 00 00 00       	call   80035c <exit>
+}
+  800352:	83 c4 10             	add    $0x10,%esp
+  800355:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800358:	5b                   	pop    %ebx
+  800359:	5e                   	pop    %esi
+  80035a:	5d                   	pop    %ebp
+  80035b:	c3                   	ret
+
+0080035c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80035c:	55                   	push   %ebp
+  80035d:	89 e5                	mov    %esp,%ebp
+  80035f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800362:	e8 dd 19 00 00       	call   801d44 <close_all>
+	sys_env_destroy(0);
+  800367:	83 ec 0c             	sub    $0xc,%esp
+  80036a:	6a 00                	push   $0x0
+  80036c:	e8 8c 0b 00 00       	call   800efd <sys_env_destroy>
+}
+  800371:	83 c4 10             	add    $0x10,%esp
+  800374:	c9                   	leave
+  800375:	c3                   	ret
+
+00800376 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	56                   	push   %esi
+  80037a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80037b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80037e:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800384:	e8 b5 0b 00 00       	call   800f3e <sys_getenvid>
+  800389:	83 ec 0c             	sub    $0xc,%esp
+  80038c:	ff 75 0c             	push   0xc(%ebp)
+  80038f:	ff 75 08             	push   0x8(%ebp)
+  800392:	56                   	push   %esi
+  800393:	50                   	push   %eax
+  800394:	68 5c 47 80 00       	push   $0x80475c
+  800399:	e8 b3 00 00 00       	call   800451 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80039e:	83 c4 18             	add    $0x18,%esp
+  8003a1:	53                   	push   %ebx
+  8003a2:	ff 75 10             	push   0x10(%ebp)
+  8003a5:	e8 56 00 00 00       	call   800400 <vcprintf>
+	cprintf("\n");
+  8003aa:	c7 04 24 eb 46 80 00 	movl   $0x8046eb,(%esp)
+  8003b1:	e8 9b 00 00 00       	call   800451 <cprintf>
+  8003b6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003b9:	cc                   	int3
+	while (1)
+  8003ba:	eb fd                	jmp    8003b9 <_panic+0x43>
+
+008003bc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003bc:	55                   	push   %ebp
+  8003bd:	89 e5                	mov    %esp,%ebp
+  8003bf:	53                   	push   %ebx
+  8003c0:	83 ec 04             	sub    $0x4,%esp
+  8003c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003c6:	8b 13                	mov    (%ebx),%edx
+  8003c8:	8d 42 01             	lea    0x1(%edx),%eax
+  8003cb:	89 03                	mov    %eax,(%ebx)
+  8003cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003d0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003d4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003d9:	74 09                	je     8003e4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003db:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003e2:	c9                   	leave
+  8003e3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	68 ff 00 00 00       	push   $0xff
+  8003ec:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ef:	50                   	push   %eax
+  8003f0:	e8 cb 0a 00 00       	call   800ec0 <sys_cputs>
+		b->idx = 0;
+  8003f5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003fb:	83 c4 10             	add    $0x10,%esp
+  8003fe:	eb db                	jmp    8003db <putch+0x1f>
+
+00800400 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800409:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800410:	00 00 00 
+	b.cnt = 0;
+  800413:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80041a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80041d:	ff 75 0c             	push   0xc(%ebp)
+  800420:	ff 75 08             	push   0x8(%ebp)
+  800423:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800429:	50                   	push   %eax
+  80042a:	68 bc 03 80 00       	push   $0x8003bc
+  80042f:	e8 1c 01 00 00       	call   800550 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800434:	83 c4 08             	add    $0x8,%esp
+  800437:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80043d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800443:	50                   	push   %eax
+  800444:	e8 77 0a 00 00       	call   800ec0 <sys_cputs>
+
+	return b.cnt;
+}
+  800449:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80044f:	c9                   	leave
+  800450:	c3                   	ret
+
+00800451 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800451:	55                   	push   %ebp
+  800452:	89 e5                	mov    %esp,%ebp
+  800454:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800457:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80045a:	50                   	push   %eax
+  80045b:	ff 75 08             	push   0x8(%ebp)
+  80045e:	e8 9d ff ff ff       	call   800400 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800463:	c9                   	leave
+  800464:	c3                   	ret
+
+00800465 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800465:	55                   	push   %ebp
+  800466:	89 e5                	mov    %esp,%ebp
+  800468:	57                   	push   %edi
+  800469:	56                   	push   %esi
+  80046a:	53                   	push   %ebx
+  80046b:	83 ec 1c             	sub    $0x1c,%esp
+  80046e:	89 c3                	mov    %eax,%ebx
+  800470:	89 d6                	mov    %edx,%esi
+  800472:	8b 45 08             	mov    0x8(%ebp),%eax
+  800475:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800478:	89 d1                	mov    %edx,%ecx
+  80047a:	89 c2                	mov    %eax,%edx
+  80047c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80047f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800482:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800485:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800488:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80048f:	39 c2                	cmp    %eax,%edx
+  800491:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800494:	73 4b                	jae    8004e1 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800496:	8b 45 14             	mov    0x14(%ebp),%eax
+  800499:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80049c:	85 ff                	test   %edi,%edi
+  80049e:	7e 11                	jle    8004b1 <printnum+0x4c>
+			putch(padc, putdat);
+  8004a0:	83 ec 08             	sub    $0x8,%esp
+  8004a3:	56                   	push   %esi
+  8004a4:	ff 75 18             	push   0x18(%ebp)
+  8004a7:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8004a9:	83 c4 10             	add    $0x10,%esp
+  8004ac:	83 ef 01             	sub    $0x1,%edi
+  8004af:	75 ef                	jne    8004a0 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004b1:	83 ec 08             	sub    $0x8,%esp
+  8004b4:	56                   	push   %esi
+  8004b5:	83 ec 04             	sub    $0x4,%esp
+  8004b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004bb:	ff 75 e0             	push   -0x20(%ebp)
+  8004be:	ff 75 dc             	push   -0x24(%ebp)
+  8004c1:	ff 75 d8             	push   -0x28(%ebp)
+  8004c4:	e8 8d 40 00 00       	call   804556 <__umoddi3>
+  8004c9:	83 c4 14             	add    $0x14,%esp
+  8004cc:	0f be 80 7f 47 80 00 	movsbl 0x80477f(%eax),%eax
+  8004d3:	50                   	push   %eax
+  8004d4:	ff d3                	call   *%ebx
+}
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004dc:	5b                   	pop    %ebx
+  8004dd:	5e                   	pop    %esi
+  8004de:	5f                   	pop    %edi
+  8004df:	5d                   	pop    %ebp
+  8004e0:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004e1:	83 ec 0c             	sub    $0xc,%esp
+  8004e4:	ff 75 18             	push   0x18(%ebp)
+  8004e7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004ea:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004ed:	52                   	push   %edx
+  8004ee:	50                   	push   %eax
+  8004ef:	83 ec 08             	sub    $0x8,%esp
+  8004f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8004f5:	ff 75 e0             	push   -0x20(%ebp)
+  8004f8:	ff 75 dc             	push   -0x24(%ebp)
+  8004fb:	ff 75 d8             	push   -0x28(%ebp)
+  8004fe:	e8 8d 3f 00 00       	call   804490 <__udivdi3>
+  800503:	83 c4 18             	add    $0x18,%esp
+  800506:	52                   	push   %edx
+  800507:	50                   	push   %eax
+  800508:	89 f2                	mov    %esi,%edx
+  80050a:	89 d8                	mov    %ebx,%eax
+  80050c:	e8 54 ff ff ff       	call   800465 <printnum>
+  800511:	83 c4 20             	add    $0x20,%esp
+  800514:	eb 9b                	jmp    8004b1 <printnum+0x4c>
+
+00800516 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800516:	55                   	push   %ebp
+  800517:	89 e5                	mov    %esp,%ebp
+  800519:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80051c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800520:	8b 10                	mov    (%eax),%edx
+  800522:	3b 50 04             	cmp    0x4(%eax),%edx
+  800525:	73 0a                	jae    800531 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800527:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80052a:	89 08                	mov    %ecx,(%eax)
+  80052c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80052f:	88 02                	mov    %al,(%edx)
+}
+  800531:	5d                   	pop    %ebp
+  800532:	c3                   	ret
+
+00800533 <printfmt>:
+{
+  800533:	55                   	push   %ebp
+  800534:	89 e5                	mov    %esp,%ebp
+  800536:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800539:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80053c:	50                   	push   %eax
+  80053d:	ff 75 10             	push   0x10(%ebp)
+  800540:	ff 75 0c             	push   0xc(%ebp)
+  800543:	ff 75 08             	push   0x8(%ebp)
+  800546:	e8 05 00 00 00       	call   800550 <vprintfmt>
+}
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	c9                   	leave
+  80054f:	c3                   	ret
+
+00800550 <vprintfmt>:
+{
+  800550:	55                   	push   %ebp
+  800551:	89 e5                	mov    %esp,%ebp
+  800553:	57                   	push   %edi
+  800554:	56                   	push   %esi
+  800555:	53                   	push   %ebx
+  800556:	83 ec 2c             	sub    $0x2c,%esp
+  800559:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80055c:	89 df                	mov    %ebx,%edi
+  80055e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800561:	8b 45 10             	mov    0x10(%ebp),%eax
+  800564:	8d 70 01             	lea    0x1(%eax),%esi
+  800567:	0f b6 00             	movzbl (%eax),%eax
+  80056a:	83 f8 25             	cmp    $0x25,%eax
+  80056d:	74 1e                	je     80058d <vprintfmt+0x3d>
+			if (ch == '\0')
+  80056f:	85 c0                	test   %eax,%eax
+  800571:	0f 84 15 05 00 00    	je     800a8c <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	53                   	push   %ebx
+  80057b:	50                   	push   %eax
+  80057c:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80057e:	83 c6 01             	add    $0x1,%esi
+  800581:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800585:	83 c4 10             	add    $0x10,%esp
+  800588:	83 f8 25             	cmp    $0x25,%eax
+  80058b:	75 e2                	jne    80056f <vprintfmt+0x1f>
+		padc = ' ';
+  80058d:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800591:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800598:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80059f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8005a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ab:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ae:	8d 56 01             	lea    0x1(%esi),%edx
+  8005b1:	0f b6 0e             	movzbl (%esi),%ecx
+  8005b4:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005b7:	3c 55                	cmp    $0x55,%al
+  8005b9:	0f 87 3b 04 00 00    	ja     8009fa <vprintfmt+0x4aa>
+  8005bf:	0f b6 c0             	movzbl %al,%eax
+  8005c2:	ff 24 85 e0 48 80 00 	jmp    *0x8048e0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8005c9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005cc:	eb 93                	jmp    800561 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ce:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8005d0:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005d4:	eb d8                	jmp    8005ae <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005d6:	89 d6                	mov    %edx,%esi
+  8005d8:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005dc:	eb d0                	jmp    8005ae <vprintfmt+0x5e>
+  8005de:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8005e1:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005e4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8005e7:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8005eb:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005ee:	83 f9 09             	cmp    $0x9,%ecx
+  8005f1:	77 6f                	ja     800662 <vprintfmt+0x112>
+  8005f3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8005f6:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8005f9:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8005fc:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800600:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800603:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800606:	83 fe 09             	cmp    $0x9,%esi
+  800609:	76 eb                	jbe    8005f6 <vprintfmt+0xa6>
+  80060b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80060e:	89 d6                	mov    %edx,%esi
+  800610:	eb 13                	jmp    800625 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800612:	8b 45 14             	mov    0x14(%ebp),%eax
+  800615:	8b 00                	mov    (%eax),%eax
+  800617:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80061a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061d:	8d 40 04             	lea    0x4(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800623:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800625:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800629:	79 83                	jns    8005ae <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80062b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80062e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800631:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800638:	e9 71 ff ff ff       	jmp    8005ae <vprintfmt+0x5e>
+			if (width < 0)
+  80063d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800640:	85 c9                	test   %ecx,%ecx
+  800642:	b8 00 00 00 00       	mov    $0x0,%eax
+  800647:	0f 49 c1             	cmovns %ecx,%eax
+  80064a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80064d:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80064f:	e9 5a ff ff ff       	jmp    8005ae <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800654:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800656:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80065d:	e9 4c ff ff ff       	jmp    8005ae <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800662:	89 d6                	mov    %edx,%esi
+  800664:	eb bf                	jmp    800625 <vprintfmt+0xd5>
+			lflag++;
+  800666:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80066a:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80066c:	e9 3d ff ff ff       	jmp    8005ae <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800671:	89 55 10             	mov    %edx,0x10(%ebp)
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8d 70 04             	lea    0x4(%eax),%esi
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	53                   	push   %ebx
+  80067e:	ff 30                	push   (%eax)
+  800680:	ff d7                	call   *%edi
+			break;
+  800682:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800685:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800688:	e9 d4 fe ff ff       	jmp    800561 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80068d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	89 d0                	mov    %edx,%eax
+  80069a:	f7 d8                	neg    %eax
+  80069c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80069f:	83 f8 12             	cmp    $0x12,%eax
+  8006a2:	7f 23                	jg     8006c7 <vprintfmt+0x177>
+  8006a4:	8b 14 85 40 4a 80 00 	mov    0x804a40(,%eax,4),%edx
+  8006ab:	85 d2                	test   %edx,%edx
+  8006ad:	74 18                	je     8006c7 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8006af:	52                   	push   %edx
+  8006b0:	68 93 4c 80 00       	push   $0x804c93
+  8006b5:	53                   	push   %ebx
+  8006b6:	57                   	push   %edi
+  8006b7:	e8 77 fe ff ff       	call   800533 <printfmt>
+  8006bc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006bf:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006c2:	e9 9a fe ff ff       	jmp    800561 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8006c7:	50                   	push   %eax
+  8006c8:	68 97 47 80 00       	push   $0x804797
+  8006cd:	53                   	push   %ebx
+  8006ce:	57                   	push   %edi
+  8006cf:	e8 5f fe ff ff       	call   800533 <printfmt>
+  8006d4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006d7:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006da:	e9 82 fe ff ff       	jmp    800561 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006df:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	83 c0 04             	add    $0x4,%eax
+  8006e8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8b 00                	mov    (%eax),%eax
+  8006f0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006f3:	85 c0                	test   %eax,%eax
+  8006f5:	0f 84 61 03 00 00    	je     800a5c <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8006fb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006ff:	7e 06                	jle    800707 <vprintfmt+0x1b7>
+  800701:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800705:	75 29                	jne    800730 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800707:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80070a:	8d 70 01             	lea    0x1(%eax),%esi
+  80070d:	0f b6 00             	movzbl (%eax),%eax
+  800710:	0f be d0             	movsbl %al,%edx
+  800713:	85 d2                	test   %edx,%edx
+  800715:	0f 84 bb 00 00 00    	je     8007d6 <vprintfmt+0x286>
+  80071b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80071e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800721:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800724:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800727:	eb 7a                	jmp    8007a3 <vprintfmt+0x253>
+				p = "(null)";
+  800729:	c7 45 d0 90 47 80 00 	movl   $0x804790,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800730:	83 ec 08             	sub    $0x8,%esp
+  800733:	ff 75 d4             	push   -0x2c(%ebp)
+  800736:	ff 75 d0             	push   -0x30(%ebp)
+  800739:	e8 e0 03 00 00       	call   800b1e <strnlen>
+  80073e:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800741:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800744:	83 c4 10             	add    $0x10,%esp
+  800747:	85 d2                	test   %edx,%edx
+  800749:	0f 8e d6 02 00 00    	jle    800a25 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80074f:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800753:	83 ec 08             	sub    $0x8,%esp
+  800756:	53                   	push   %ebx
+  800757:	56                   	push   %esi
+  800758:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800761:	75 f0                	jne    800753 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800763:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800766:	8d 70 01             	lea    0x1(%eax),%esi
+  800769:	0f b6 00             	movzbl (%eax),%eax
+  80076c:	0f be d0             	movsbl %al,%edx
+  80076f:	85 d2                	test   %edx,%edx
+  800771:	0f 84 da 02 00 00    	je     800a51 <vprintfmt+0x501>
+  800777:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80077a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80077d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800780:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800783:	eb 1e                	jmp    8007a3 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800785:	83 ec 08             	sub    $0x8,%esp
+  800788:	ff 75 0c             	push   0xc(%ebp)
+  80078b:	52                   	push   %edx
+  80078c:	ff 55 08             	call   *0x8(%ebp)
+  80078f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800792:	83 eb 01             	sub    $0x1,%ebx
+  800795:	83 c6 01             	add    $0x1,%esi
+  800798:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80079c:	0f be d0             	movsbl %al,%edx
+  80079f:	85 d2                	test   %edx,%edx
+  8007a1:	74 2a                	je     8007cd <vprintfmt+0x27d>
+  8007a3:	85 ff                	test   %edi,%edi
+  8007a5:	78 05                	js     8007ac <vprintfmt+0x25c>
+  8007a7:	83 ef 01             	sub    $0x1,%edi
+  8007aa:	78 59                	js     800805 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007b0:	74 d3                	je     800785 <vprintfmt+0x235>
+  8007b2:	0f be c0             	movsbl %al,%eax
+  8007b5:	83 e8 20             	sub    $0x20,%eax
+  8007b8:	83 f8 5e             	cmp    $0x5e,%eax
+  8007bb:	76 c8                	jbe    800785 <vprintfmt+0x235>
+					putch('?', putdat);
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	ff 75 0c             	push   0xc(%ebp)
+  8007c3:	6a 3f                	push   $0x3f
+  8007c5:	ff 55 08             	call   *0x8(%ebp)
+  8007c8:	83 c4 10             	add    $0x10,%esp
+  8007cb:	eb c5                	jmp    800792 <vprintfmt+0x242>
+  8007cd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007d0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8007d6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007d9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007dd:	7e 1b                	jle    8007fa <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	53                   	push   %ebx
+  8007e3:	6a 20                	push   $0x20
+  8007e5:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007e7:	83 c4 10             	add    $0x10,%esp
+  8007ea:	83 ee 01             	sub    $0x1,%esi
+  8007ed:	75 f0                	jne    8007df <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007ef:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f5:	e9 67 fd ff ff       	jmp    800561 <vprintfmt+0x11>
+  8007fa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800800:	e9 5c fd ff ff       	jmp    800561 <vprintfmt+0x11>
+  800805:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800808:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80080b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80080e:	eb c6                	jmp    8007d6 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800810:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800813:	89 55 10             	mov    %edx,0x10(%ebp)
+  800816:	83 f9 01             	cmp    $0x1,%ecx
+  800819:	7f 1f                	jg     80083a <vprintfmt+0x2ea>
+	else if (lflag)
+  80081b:	85 c9                	test   %ecx,%ecx
+  80081d:	74 67                	je     800886 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80081f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800822:	8b 30                	mov    (%eax),%esi
+  800824:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800827:	89 f0                	mov    %esi,%eax
+  800829:	c1 f8 1f             	sar    $0x1f,%eax
+  80082c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80082f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800832:	8d 40 04             	lea    0x4(%eax),%eax
+  800835:	89 45 14             	mov    %eax,0x14(%ebp)
+  800838:	eb 17                	jmp    800851 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  80083a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083d:	8b 50 04             	mov    0x4(%eax),%edx
+  800840:	8b 00                	mov    (%eax),%eax
+  800842:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800845:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800848:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084b:	8d 40 08             	lea    0x8(%eax),%eax
+  80084e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800851:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800854:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800857:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80085c:	85 c9                	test   %ecx,%ecx
+  80085e:	0f 89 12 01 00 00    	jns    800976 <vprintfmt+0x426>
+				putch('-', putdat);
+  800864:	83 ec 08             	sub    $0x8,%esp
+  800867:	53                   	push   %ebx
+  800868:	6a 2d                	push   $0x2d
+  80086a:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80086c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800872:	f7 da                	neg    %edx
+  800874:	83 d1 00             	adc    $0x0,%ecx
+  800877:	f7 d9                	neg    %ecx
+  800879:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80087c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800881:	e9 f0 00 00 00       	jmp    800976 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800886:	8b 45 14             	mov    0x14(%ebp),%eax
+  800889:	8b 30                	mov    (%eax),%esi
+  80088b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80088e:	89 f0                	mov    %esi,%eax
+  800890:	c1 f8 1f             	sar    $0x1f,%eax
+  800893:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800896:	8b 45 14             	mov    0x14(%ebp),%eax
+  800899:	8d 40 04             	lea    0x4(%eax),%eax
+  80089c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089f:	eb b0                	jmp    800851 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8008a1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008a4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008a7:	83 f9 01             	cmp    $0x1,%ecx
+  8008aa:	7f 1e                	jg     8008ca <vprintfmt+0x37a>
+	else if (lflag)
+  8008ac:	85 c9                	test   %ecx,%ecx
+  8008ae:	74 32                	je     8008e2 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8008b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b3:	8b 10                	mov    (%eax),%edx
+  8008b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008c0:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8008c5:	e9 ac 00 00 00       	jmp    800976 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cd:	8b 10                	mov    (%eax),%edx
+  8008cf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008d2:	8d 40 08             	lea    0x8(%eax),%eax
+  8008d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008d8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8008dd:	e9 94 00 00 00       	jmp    800976 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e5:	8b 10                	mov    (%eax),%edx
+  8008e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008f2:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8008f7:	eb 7d                	jmp    800976 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8008f9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008fc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008ff:	83 f9 01             	cmp    $0x1,%ecx
+  800902:	7f 1b                	jg     80091f <vprintfmt+0x3cf>
+	else if (lflag)
+  800904:	85 c9                	test   %ecx,%ecx
+  800906:	74 2c                	je     800934 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800908:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090b:	8b 10                	mov    (%eax),%edx
+  80090d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800912:	8d 40 04             	lea    0x4(%eax),%eax
+  800915:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800918:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80091d:	eb 57                	jmp    800976 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80091f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800922:	8b 10                	mov    (%eax),%edx
+  800924:	8b 48 04             	mov    0x4(%eax),%ecx
+  800927:	8d 40 08             	lea    0x8(%eax),%eax
+  80092a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80092d:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800932:	eb 42                	jmp    800976 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800934:	8b 45 14             	mov    0x14(%ebp),%eax
+  800937:	8b 10                	mov    (%eax),%edx
+  800939:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80093e:	8d 40 04             	lea    0x4(%eax),%eax
+  800941:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800944:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800949:	eb 2b                	jmp    800976 <vprintfmt+0x426>
+			putch('0', putdat);
+  80094b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80094e:	83 ec 08             	sub    $0x8,%esp
+  800951:	53                   	push   %ebx
+  800952:	6a 30                	push   $0x30
+  800954:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800956:	83 c4 08             	add    $0x8,%esp
+  800959:	53                   	push   %ebx
+  80095a:	6a 78                	push   $0x78
+  80095c:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80095e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800961:	8b 10                	mov    (%eax),%edx
+  800963:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800968:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80096b:	8d 40 04             	lea    0x4(%eax),%eax
+  80096e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800971:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800976:	83 ec 0c             	sub    $0xc,%esp
+  800979:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80097d:	50                   	push   %eax
+  80097e:	ff 75 e4             	push   -0x1c(%ebp)
+  800981:	56                   	push   %esi
+  800982:	51                   	push   %ecx
+  800983:	52                   	push   %edx
+  800984:	89 da                	mov    %ebx,%edx
+  800986:	89 f8                	mov    %edi,%eax
+  800988:	e8 d8 fa ff ff       	call   800465 <printnum>
+			break;
+  80098d:	83 c4 20             	add    $0x20,%esp
+  800990:	e9 cc fb ff ff       	jmp    800561 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800995:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800998:	89 55 10             	mov    %edx,0x10(%ebp)
+  80099b:	83 f9 01             	cmp    $0x1,%ecx
+  80099e:	7f 1b                	jg     8009bb <vprintfmt+0x46b>
+	else if (lflag)
+  8009a0:	85 c9                	test   %ecx,%ecx
+  8009a2:	74 2c                	je     8009d0 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8009a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a7:	8b 10                	mov    (%eax),%edx
+  8009a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b4:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009b9:	eb bb                	jmp    800976 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009be:	8b 10                	mov    (%eax),%edx
+  8009c0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8009c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009c9:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8009ce:	eb a6                	jmp    800976 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d3:	8b 10                	mov    (%eax),%edx
+  8009d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009da:	8d 40 04             	lea    0x4(%eax),%eax
+  8009dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8009e5:	eb 8f                	jmp    800976 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8009e7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009ea:	83 ec 08             	sub    $0x8,%esp
+  8009ed:	53                   	push   %ebx
+  8009ee:	6a 25                	push   $0x25
+  8009f0:	ff d7                	call   *%edi
+			break;
+  8009f2:	83 c4 10             	add    $0x10,%esp
+  8009f5:	e9 67 fb ff ff       	jmp    800561 <vprintfmt+0x11>
+			putch('%', putdat);
+  8009fa:	83 ec 08             	sub    $0x8,%esp
+  8009fd:	53                   	push   %ebx
+  8009fe:	6a 25                	push   $0x25
+  800a00:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a02:	83 c4 10             	add    $0x10,%esp
+  800a05:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a09:	0f 84 ba fb ff ff    	je     8005c9 <vprintfmt+0x79>
+  800a0f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a12:	89 f0                	mov    %esi,%eax
+  800a14:	83 e8 01             	sub    $0x1,%eax
+  800a17:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a1b:	75 f7                	jne    800a14 <vprintfmt+0x4c4>
+  800a1d:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a20:	e9 3c fb ff ff       	jmp    800561 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a25:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a28:	8d 70 01             	lea    0x1(%eax),%esi
+  800a2b:	0f b6 00             	movzbl (%eax),%eax
+  800a2e:	0f be d0             	movsbl %al,%edx
+  800a31:	85 d2                	test   %edx,%edx
+  800a33:	74 11                	je     800a46 <vprintfmt+0x4f6>
+  800a35:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a38:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a3b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a3e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a41:	e9 5d fd ff ff       	jmp    8007a3 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a46:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a49:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a4c:	e9 10 fb ff ff       	jmp    800561 <vprintfmt+0x11>
+  800a51:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a54:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a57:	e9 05 fb ff ff       	jmp    800561 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a5c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a60:	7e 0a                	jle    800a6c <vprintfmt+0x51c>
+  800a62:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a66:	0f 85 bd fc ff ff    	jne    800729 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a6c:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a71:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a76:	be 91 47 80 00       	mov    $0x804791,%esi
+  800a7b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a7e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a81:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a84:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a87:	e9 17 fd ff ff       	jmp    8007a3 <vprintfmt+0x253>
+}
+  800a8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a8f:	5b                   	pop    %ebx
+  800a90:	5e                   	pop    %esi
+  800a91:	5f                   	pop    %edi
+  800a92:	5d                   	pop    %ebp
+  800a93:	c3                   	ret
+
+00800a94 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	83 ec 18             	sub    $0x18,%esp
+  800a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800aa0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800aa3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800aa7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800aaa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800ab1:	85 c0                	test   %eax,%eax
+  800ab3:	74 26                	je     800adb <vsnprintf+0x47>
+  800ab5:	85 d2                	test   %edx,%edx
+  800ab7:	7e 22                	jle    800adb <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ab9:	ff 75 14             	push   0x14(%ebp)
+  800abc:	ff 75 10             	push   0x10(%ebp)
+  800abf:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ac2:	50                   	push   %eax
+  800ac3:	68 16 05 80 00       	push   $0x800516
+  800ac8:	e8 83 fa ff ff       	call   800550 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800acd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ad0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ad6:	83 c4 10             	add    $0x10,%esp
+}
+  800ad9:	c9                   	leave
+  800ada:	c3                   	ret
+		return -E_INVAL;
+  800adb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae0:	eb f7                	jmp    800ad9 <vsnprintf+0x45>
+
+00800ae2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ae8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800aeb:	50                   	push   %eax
+  800aec:	ff 75 10             	push   0x10(%ebp)
+  800aef:	ff 75 0c             	push   0xc(%ebp)
+  800af2:	ff 75 08             	push   0x8(%ebp)
+  800af5:	e8 9a ff ff ff       	call   800a94 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800afa:	c9                   	leave
+  800afb:	c3                   	ret
+
+00800afc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b02:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b05:	74 10                	je     800b17 <strlen+0x1b>
+  800b07:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b0c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b0f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b13:	75 f7                	jne    800b0c <strlen+0x10>
+	return n;
+}
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b17:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b1c:	eb f7                	jmp    800b15 <strlen+0x19>
+
+00800b1e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b24:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b27:	85 d2                	test   %edx,%edx
+  800b29:	74 16                	je     800b41 <strnlen+0x23>
+  800b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b30:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b34:	74 09                	je     800b3f <strnlen+0x21>
+		n++;
+  800b36:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b39:	39 d0                	cmp    %edx,%eax
+  800b3b:	75 f3                	jne    800b30 <strnlen+0x12>
+		n++;
+  800b3d:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b3f:	5d                   	pop    %ebp
+  800b40:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b46:	eb f7                	jmp    800b3f <strnlen+0x21>
+
+00800b48 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b48:	55                   	push   %ebp
+  800b49:	89 e5                	mov    %esp,%ebp
+  800b4b:	53                   	push   %ebx
+  800b4c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b4f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b57:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b5b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b5e:	83 c0 01             	add    $0x1,%eax
+  800b61:	84 d2                	test   %dl,%dl
+  800b63:	75 f2                	jne    800b57 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b65:	89 c8                	mov    %ecx,%eax
+  800b67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b6a:	c9                   	leave
+  800b6b:	c3                   	ret
+
+00800b6c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b6c:	55                   	push   %ebp
+  800b6d:	89 e5                	mov    %esp,%ebp
+  800b6f:	53                   	push   %ebx
+  800b70:	83 ec 10             	sub    $0x10,%esp
+  800b73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b76:	53                   	push   %ebx
+  800b77:	e8 80 ff ff ff       	call   800afc <strlen>
+  800b7c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b7f:	ff 75 0c             	push   0xc(%ebp)
+  800b82:	01 d8                	add    %ebx,%eax
+  800b84:	50                   	push   %eax
+  800b85:	e8 be ff ff ff       	call   800b48 <strcpy>
+	return dst;
+}
+  800b8a:	89 d8                	mov    %ebx,%eax
+  800b8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b8f:	c9                   	leave
+  800b90:	c3                   	ret
+
+00800b91 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	56                   	push   %esi
+  800b95:	53                   	push   %ebx
+  800b96:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b9f:	85 db                	test   %ebx,%ebx
+  800ba1:	74 17                	je     800bba <strncpy+0x29>
+  800ba3:	01 f3                	add    %esi,%ebx
+  800ba5:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800ba7:	83 c0 01             	add    $0x1,%eax
+  800baa:	0f b6 0a             	movzbl (%edx),%ecx
+  800bad:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bb0:	80 f9 01             	cmp    $0x1,%cl
+  800bb3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bb6:	39 c3                	cmp    %eax,%ebx
+  800bb8:	75 ed                	jne    800ba7 <strncpy+0x16>
+	}
+	return ret;
+}
+  800bba:	89 f0                	mov    %esi,%eax
+  800bbc:	5b                   	pop    %ebx
+  800bbd:	5e                   	pop    %esi
+  800bbe:	5d                   	pop    %ebp
+  800bbf:	c3                   	ret
+
+00800bc0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	56                   	push   %esi
+  800bc4:	53                   	push   %ebx
+  800bc5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bce:	89 f0                	mov    %esi,%eax
+  800bd0:	85 db                	test   %ebx,%ebx
+  800bd2:	74 1e                	je     800bf2 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800bd4:	83 eb 01             	sub    $0x1,%ebx
+  800bd7:	74 16                	je     800bef <strlcpy+0x2f>
+  800bd9:	01 f3                	add    %esi,%ebx
+  800bdb:	0f b6 0a             	movzbl (%edx),%ecx
+  800bde:	84 c9                	test   %cl,%cl
+  800be0:	74 0d                	je     800bef <strlcpy+0x2f>
+			*dst++ = *src++;
+  800be2:	83 c2 01             	add    $0x1,%edx
+  800be5:	83 c0 01             	add    $0x1,%eax
+  800be8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800beb:	39 d8                	cmp    %ebx,%eax
+  800bed:	75 ec                	jne    800bdb <strlcpy+0x1b>
+		*dst = '\0';
+  800bef:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bf2:	29 f0                	sub    %esi,%eax
+}
+  800bf4:	5b                   	pop    %ebx
+  800bf5:	5e                   	pop    %esi
+  800bf6:	5d                   	pop    %ebp
+  800bf7:	c3                   	ret
+
+00800bf8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bfe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c01:	0f b6 01             	movzbl (%ecx),%eax
+  800c04:	84 c0                	test   %al,%al
+  800c06:	74 11                	je     800c19 <strcmp+0x21>
+  800c08:	38 02                	cmp    %al,(%edx)
+  800c0a:	75 0d                	jne    800c19 <strcmp+0x21>
+		p++, q++;
+  800c0c:	83 c1 01             	add    $0x1,%ecx
+  800c0f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c12:	0f b6 01             	movzbl (%ecx),%eax
+  800c15:	84 c0                	test   %al,%al
+  800c17:	75 ef                	jne    800c08 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c19:	0f b6 c0             	movzbl %al,%eax
+  800c1c:	0f b6 12             	movzbl (%edx),%edx
+  800c1f:	29 d0                	sub    %edx,%eax
+}
+  800c21:	5d                   	pop    %ebp
+  800c22:	c3                   	ret
+
+00800c23 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c23:	55                   	push   %ebp
+  800c24:	89 e5                	mov    %esp,%ebp
+  800c26:	53                   	push   %ebx
+  800c27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c2d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c35:	85 d2                	test   %edx,%edx
+  800c37:	74 2e                	je     800c67 <strncmp+0x44>
+  800c39:	0f b6 01             	movzbl (%ecx),%eax
+  800c3c:	84 c0                	test   %al,%al
+  800c3e:	74 16                	je     800c56 <strncmp+0x33>
+  800c40:	3a 03                	cmp    (%ebx),%al
+  800c42:	75 12                	jne    800c56 <strncmp+0x33>
+		n--, p++, q++;
+  800c44:	83 c1 01             	add    $0x1,%ecx
+  800c47:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800c4a:	83 ea 01             	sub    $0x1,%edx
+  800c4d:	75 ea                	jne    800c39 <strncmp+0x16>
+		return 0;
+  800c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c54:	eb 11                	jmp    800c67 <strncmp+0x44>
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800c5b:	85 d2                	test   %edx,%edx
+  800c5d:	74 08                	je     800c67 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c5f:	0f b6 01             	movzbl (%ecx),%eax
+  800c62:	0f b6 13             	movzbl (%ebx),%edx
+  800c65:	29 d0                	sub    %edx,%eax
+}
+  800c67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c6a:	c9                   	leave
+  800c6b:	c3                   	ret
+
+00800c6c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c72:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c76:	0f b6 10             	movzbl (%eax),%edx
+  800c79:	84 d2                	test   %dl,%dl
+  800c7b:	74 15                	je     800c92 <strchr+0x26>
+		if (*s == c)
+  800c7d:	38 d1                	cmp    %dl,%cl
+  800c7f:	74 0f                	je     800c90 <strchr+0x24>
+	for (; *s; s++)
+  800c81:	83 c0 01             	add    $0x1,%eax
+  800c84:	0f b6 10             	movzbl (%eax),%edx
+  800c87:	84 d2                	test   %dl,%dl
+  800c89:	75 f2                	jne    800c7d <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+	return 0;
+  800c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c97:	eb f7                	jmp    800c90 <strchr+0x24>
+
+00800c99 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	53                   	push   %ebx
+  800c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800ca3:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800ca6:	38 d3                	cmp    %dl,%bl
+  800ca8:	74 14                	je     800cbe <strfind+0x25>
+  800caa:	89 d1                	mov    %edx,%ecx
+  800cac:	84 db                	test   %bl,%bl
+  800cae:	74 0e                	je     800cbe <strfind+0x25>
+	for (; *s; s++)
+  800cb0:	83 c0 01             	add    $0x1,%eax
+  800cb3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cb6:	38 ca                	cmp    %cl,%dl
+  800cb8:	74 04                	je     800cbe <strfind+0x25>
+  800cba:	84 d2                	test   %dl,%dl
+  800cbc:	75 f2                	jne    800cb0 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800cbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cc1:	c9                   	leave
+  800cc2:	c3                   	ret
+
+00800cc3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cc3:	55                   	push   %ebp
+  800cc4:	89 e5                	mov    %esp,%ebp
+  800cc6:	57                   	push   %edi
+  800cc7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ccd:	85 c9                	test   %ecx,%ecx
+  800ccf:	74 20                	je     800cf1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cd1:	89 f8                	mov    %edi,%eax
+  800cd3:	09 c8                	or     %ecx,%eax
+  800cd5:	a8 03                	test   $0x3,%al
+  800cd7:	75 12                	jne    800ceb <memset+0x28>
+		c &= 0xFF;
+  800cd9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cdd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ce3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ce6:	fc                   	cld
+  800ce7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ce9:	eb 06                	jmp    800cf1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ceb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cee:	fc                   	cld
+  800cef:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cf1:	89 f8                	mov    %edi,%eax
+  800cf3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cf6:	c9                   	leave
+  800cf7:	c3                   	ret
+
+00800cf8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d00:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d03:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d06:	39 c6                	cmp    %eax,%esi
+  800d08:	73 32                	jae    800d3c <memmove+0x44>
+  800d0a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d0d:	39 d0                	cmp    %edx,%eax
+  800d0f:	73 2b                	jae    800d3c <memmove+0x44>
+		s += n;
+		d += n;
+  800d11:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d14:	89 d6                	mov    %edx,%esi
+  800d16:	09 fe                	or     %edi,%esi
+  800d18:	09 ce                	or     %ecx,%esi
+  800d1a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d20:	75 0e                	jne    800d30 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d22:	83 ef 04             	sub    $0x4,%edi
+  800d25:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d28:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d2b:	fd                   	std
+  800d2c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d2e:	eb 09                	jmp    800d39 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d30:	83 ef 01             	sub    $0x1,%edi
+  800d33:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d36:	fd                   	std
+  800d37:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d39:	fc                   	cld
+  800d3a:	eb 1a                	jmp    800d56 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d3c:	89 f2                	mov    %esi,%edx
+  800d3e:	09 c2                	or     %eax,%edx
+  800d40:	09 ca                	or     %ecx,%edx
+  800d42:	f6 c2 03             	test   $0x3,%dl
+  800d45:	75 0a                	jne    800d51 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d47:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d4a:	89 c7                	mov    %eax,%edi
+  800d4c:	fc                   	cld
+  800d4d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d4f:	eb 05                	jmp    800d56 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d51:	89 c7                	mov    %eax,%edi
+  800d53:	fc                   	cld
+  800d54:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+
+00800d5a <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d60:	ff 75 10             	push   0x10(%ebp)
+  800d63:	ff 75 0c             	push   0xc(%ebp)
+  800d66:	ff 75 08             	push   0x8(%ebp)
+  800d69:	e8 8a ff ff ff       	call   800cf8 <memmove>
+}
+  800d6e:	c9                   	leave
+  800d6f:	c3                   	ret
+
+00800d70 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  800d75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d78:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d7b:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d7e:	85 f6                	test   %esi,%esi
+  800d80:	74 29                	je     800dab <memcmp+0x3b>
+  800d82:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800d84:	0f b6 08             	movzbl (%eax),%ecx
+  800d87:	0f b6 1a             	movzbl (%edx),%ebx
+  800d8a:	38 d9                	cmp    %bl,%cl
+  800d8c:	75 11                	jne    800d9f <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d8e:	83 c0 01             	add    $0x1,%eax
+  800d91:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d94:	39 c6                	cmp    %eax,%esi
+  800d96:	75 ec                	jne    800d84 <memcmp+0x14>
+	}
+
+	return 0;
+  800d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9d:	eb 08                	jmp    800da7 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800d9f:	0f b6 c1             	movzbl %cl,%eax
+  800da2:	0f b6 db             	movzbl %bl,%ebx
+  800da5:	29 d8                	sub    %ebx,%eax
+}
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+	return 0;
+  800dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db0:	eb f5                	jmp    800da7 <memcmp+0x37>
+
+00800db2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dbb:	89 c2                	mov    %eax,%edx
+  800dbd:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dc0:	39 d0                	cmp    %edx,%eax
+  800dc2:	73 0d                	jae    800dd1 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dc4:	38 08                	cmp    %cl,(%eax)
+  800dc6:	74 0d                	je     800dd5 <memfind+0x23>
+	for (; s < ends; s++)
+  800dc8:	83 c0 01             	add    $0x1,%eax
+  800dcb:	39 c2                	cmp    %eax,%edx
+  800dcd:	75 f5                	jne    800dc4 <memfind+0x12>
+  800dcf:	eb 06                	jmp    800dd7 <memfind+0x25>
+  800dd1:	89 c2                	mov    %eax,%edx
+  800dd3:	eb 02                	jmp    800dd7 <memfind+0x25>
+  800dd5:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800dd7:	89 d0                	mov    %edx,%eax
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+
+00800ddb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	57                   	push   %edi
+  800ddf:	56                   	push   %esi
+  800de0:	53                   	push   %ebx
+  800de1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800de7:	0f b6 02             	movzbl (%edx),%eax
+  800dea:	3c 20                	cmp    $0x20,%al
+  800dec:	74 04                	je     800df2 <strtol+0x17>
+  800dee:	3c 09                	cmp    $0x9,%al
+  800df0:	75 0e                	jne    800e00 <strtol+0x25>
+		s++;
+  800df2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800df5:	0f b6 02             	movzbl (%edx),%eax
+  800df8:	3c 20                	cmp    $0x20,%al
+  800dfa:	74 f6                	je     800df2 <strtol+0x17>
+  800dfc:	3c 09                	cmp    $0x9,%al
+  800dfe:	74 f2                	je     800df2 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e00:	3c 2b                	cmp    $0x2b,%al
+  800e02:	74 2a                	je     800e2e <strtol+0x53>
+	int neg = 0;
+  800e04:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e09:	3c 2d                	cmp    $0x2d,%al
+  800e0b:	74 2b                	je     800e38 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e0d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e13:	75 0f                	jne    800e24 <strtol+0x49>
+  800e15:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e18:	74 28                	je     800e42 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e1a:	85 db                	test   %ebx,%ebx
+  800e1c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e21:	0f 44 d8             	cmove  %eax,%ebx
+  800e24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e29:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e2c:	eb 46                	jmp    800e74 <strtol+0x99>
+		s++;
+  800e2e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e31:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e36:	eb d5                	jmp    800e0d <strtol+0x32>
+		s++, neg = 1;
+  800e38:	83 c2 01             	add    $0x1,%edx
+  800e3b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e40:	eb cb                	jmp    800e0d <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e42:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e46:	74 0e                	je     800e56 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800e48:	85 db                	test   %ebx,%ebx
+  800e4a:	75 d8                	jne    800e24 <strtol+0x49>
+		s++, base = 8;
+  800e4c:	83 c2 01             	add    $0x1,%edx
+  800e4f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e54:	eb ce                	jmp    800e24 <strtol+0x49>
+		s += 2, base = 16;
+  800e56:	83 c2 02             	add    $0x2,%edx
+  800e59:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e5e:	eb c4                	jmp    800e24 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e60:	0f be c0             	movsbl %al,%eax
+  800e63:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e66:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e69:	7d 3a                	jge    800ea5 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800e6b:	83 c2 01             	add    $0x1,%edx
+  800e6e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e72:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e74:	0f b6 02             	movzbl (%edx),%eax
+  800e77:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e7a:	89 f3                	mov    %esi,%ebx
+  800e7c:	80 fb 09             	cmp    $0x9,%bl
+  800e7f:	76 df                	jbe    800e60 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800e81:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e84:	89 f3                	mov    %esi,%ebx
+  800e86:	80 fb 19             	cmp    $0x19,%bl
+  800e89:	77 08                	ja     800e93 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800e8b:	0f be c0             	movsbl %al,%eax
+  800e8e:	83 e8 57             	sub    $0x57,%eax
+  800e91:	eb d3                	jmp    800e66 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e93:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e96:	89 f3                	mov    %esi,%ebx
+  800e98:	80 fb 19             	cmp    $0x19,%bl
+  800e9b:	77 08                	ja     800ea5 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800e9d:	0f be c0             	movsbl %al,%eax
+  800ea0:	83 e8 37             	sub    $0x37,%eax
+  800ea3:	eb c1                	jmp    800e66 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ea5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ea9:	74 05                	je     800eb0 <strtol+0xd5>
+		*endptr = (char *) s;
+  800eab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eae:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800eb0:	89 c8                	mov    %ecx,%eax
+  800eb2:	f7 d8                	neg    %eax
+  800eb4:	85 ff                	test   %edi,%edi
+  800eb6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800eb9:	89 c8                	mov    %ecx,%eax
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+
+00800ec0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed1:	89 c3                	mov    %eax,%ebx
+  800ed3:	89 c7                	mov    %eax,%edi
+  800ed5:	89 c6                	mov    %eax,%esi
+  800ed7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+
+00800ede <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	56                   	push   %esi
+  800ee3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eee:	89 d1                	mov    %edx,%ecx
+  800ef0:	89 d3                	mov    %edx,%ebx
+  800ef2:	89 d7                	mov    %edx,%edi
+  800ef4:	89 d6                	mov    %edx,%esi
+  800ef6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+
+00800efd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800efd:	55                   	push   %ebp
+  800efe:	89 e5                	mov    %esp,%ebp
+  800f00:	57                   	push   %edi
+  800f01:	56                   	push   %esi
+  800f02:	53                   	push   %ebx
+  800f03:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f13:	89 cb                	mov    %ecx,%ebx
+  800f15:	89 cf                	mov    %ecx,%edi
+  800f17:	89 ce                	mov    %ecx,%esi
+  800f19:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1b:	85 c0                	test   %eax,%eax
+  800f1d:	7f 08                	jg     800f27 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f22:	5b                   	pop    %ebx
+  800f23:	5e                   	pop    %esi
+  800f24:	5f                   	pop    %edi
+  800f25:	5d                   	pop    %ebp
+  800f26:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+  800f2a:	50                   	push   %eax
+  800f2b:	6a 03                	push   $0x3
+  800f2d:	68 ab 4a 80 00       	push   $0x804aab
+  800f32:	6a 23                	push   $0x23
+  800f34:	68 c8 4a 80 00       	push   $0x804ac8
+  800f39:	e8 38 f4 ff ff       	call   800376 <_panic>
+
+00800f3e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f49:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f4e:	89 d1                	mov    %edx,%ecx
+  800f50:	89 d3                	mov    %edx,%ebx
+  800f52:	89 d7                	mov    %edx,%edi
+  800f54:	89 d6                	mov    %edx,%esi
+  800f56:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f58:	5b                   	pop    %ebx
+  800f59:	5e                   	pop    %esi
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+
+00800f5d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	57                   	push   %edi
+  800f61:	56                   	push   %esi
+  800f62:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f68:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f6d:	89 d1                	mov    %edx,%ecx
+  800f6f:	89 d3                	mov    %edx,%ebx
+  800f71:	89 d7                	mov    %edx,%edi
+  800f73:	89 d6                	mov    %edx,%esi
+  800f75:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f77:	5b                   	pop    %ebx
+  800f78:	5e                   	pop    %esi
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+
+00800f7c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f85:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f98:	89 f7                	mov    %esi,%edi
+  800f9a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	7f 08                	jg     800fa8 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa8:	83 ec 0c             	sub    $0xc,%esp
+  800fab:	50                   	push   %eax
+  800fac:	6a 04                	push   $0x4
+  800fae:	68 ab 4a 80 00       	push   $0x804aab
+  800fb3:	6a 23                	push   $0x23
+  800fb5:	68 c8 4a 80 00       	push   $0x804ac8
+  800fba:	e8 b7 f3 ff ff       	call   800376 <_panic>
+
+00800fbf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+  800fc5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fce:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fdc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	7f 08                	jg     800fea <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fe2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe5:	5b                   	pop    %ebx
+  800fe6:	5e                   	pop    %esi
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+  800fed:	50                   	push   %eax
+  800fee:	6a 05                	push   $0x5
+  800ff0:	68 ab 4a 80 00       	push   $0x804aab
+  800ff5:	6a 23                	push   $0x23
+  800ff7:	68 c8 4a 80 00       	push   $0x804ac8
+  800ffc:	e8 75 f3 ff ff       	call   800376 <_panic>
+
+00801001 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	56                   	push   %esi
+  801006:	53                   	push   %ebx
+  801007:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80100a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801012:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801015:	b8 06 00 00 00       	mov    $0x6,%eax
+  80101a:	89 df                	mov    %ebx,%edi
+  80101c:	89 de                	mov    %ebx,%esi
+  80101e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801020:	85 c0                	test   %eax,%eax
+  801022:	7f 08                	jg     80102c <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801027:	5b                   	pop    %ebx
+  801028:	5e                   	pop    %esi
+  801029:	5f                   	pop    %edi
+  80102a:	5d                   	pop    %ebp
+  80102b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102c:	83 ec 0c             	sub    $0xc,%esp
+  80102f:	50                   	push   %eax
+  801030:	6a 06                	push   $0x6
+  801032:	68 ab 4a 80 00       	push   $0x804aab
+  801037:	6a 23                	push   $0x23
+  801039:	68 c8 4a 80 00       	push   $0x804ac8
+  80103e:	e8 33 f3 ff ff       	call   800376 <_panic>
+
+00801043 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+  801049:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80104c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801051:	8b 55 08             	mov    0x8(%ebp),%edx
+  801054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801057:	b8 08 00 00 00       	mov    $0x8,%eax
+  80105c:	89 df                	mov    %ebx,%edi
+  80105e:	89 de                	mov    %ebx,%esi
+  801060:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801062:	85 c0                	test   %eax,%eax
+  801064:	7f 08                	jg     80106e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5f                   	pop    %edi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106e:	83 ec 0c             	sub    $0xc,%esp
+  801071:	50                   	push   %eax
+  801072:	6a 08                	push   $0x8
+  801074:	68 ab 4a 80 00       	push   $0x804aab
+  801079:	6a 23                	push   $0x23
+  80107b:	68 c8 4a 80 00       	push   $0x804ac8
+  801080:	e8 f1 f2 ff ff       	call   800376 <_panic>
+
+00801085 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	57                   	push   %edi
+  801089:	56                   	push   %esi
+  80108a:	53                   	push   %ebx
+  80108b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80108e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	b8 09 00 00 00       	mov    $0x9,%eax
+  80109e:	89 df                	mov    %ebx,%edi
+  8010a0:	89 de                	mov    %ebx,%esi
+  8010a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a4:	85 c0                	test   %eax,%eax
+  8010a6:	7f 08                	jg     8010b0 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5e                   	pop    %esi
+  8010ad:	5f                   	pop    %edi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b0:	83 ec 0c             	sub    $0xc,%esp
+  8010b3:	50                   	push   %eax
+  8010b4:	6a 09                	push   $0x9
+  8010b6:	68 ab 4a 80 00       	push   $0x804aab
+  8010bb:	6a 23                	push   $0x23
+  8010bd:	68 c8 4a 80 00       	push   $0x804ac8
+  8010c2:	e8 af f2 ff ff       	call   800376 <_panic>
+
+008010c7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+  8010cd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e0:	89 df                	mov    %ebx,%edi
+  8010e2:	89 de                	mov    %ebx,%esi
+  8010e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	7f 08                	jg     8010f2 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ed:	5b                   	pop    %ebx
+  8010ee:	5e                   	pop    %esi
+  8010ef:	5f                   	pop    %edi
+  8010f0:	5d                   	pop    %ebp
+  8010f1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f2:	83 ec 0c             	sub    $0xc,%esp
+  8010f5:	50                   	push   %eax
+  8010f6:	6a 0a                	push   $0xa
+  8010f8:	68 ab 4a 80 00       	push   $0x804aab
+  8010fd:	6a 23                	push   $0x23
+  8010ff:	68 c8 4a 80 00       	push   $0x804ac8
+  801104:	e8 6d f2 ff ff       	call   800376 <_panic>
+
+00801109 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801112:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801115:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80111a:	be 00 00 00 00       	mov    $0x0,%esi
+  80111f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801122:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801125:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801127:	5b                   	pop    %ebx
+  801128:	5e                   	pop    %esi
+  801129:	5f                   	pop    %edi
+  80112a:	5d                   	pop    %ebp
+  80112b:	c3                   	ret
+
+0080112c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	57                   	push   %edi
+  801130:	56                   	push   %esi
+  801131:	53                   	push   %ebx
+  801132:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801135:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801142:	89 cb                	mov    %ecx,%ebx
+  801144:	89 cf                	mov    %ecx,%edi
+  801146:	89 ce                	mov    %ecx,%esi
+  801148:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114a:	85 c0                	test   %eax,%eax
+  80114c:	7f 08                	jg     801156 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80114e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801151:	5b                   	pop    %ebx
+  801152:	5e                   	pop    %esi
+  801153:	5f                   	pop    %edi
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801156:	83 ec 0c             	sub    $0xc,%esp
+  801159:	50                   	push   %eax
+  80115a:	6a 0d                	push   $0xd
+  80115c:	68 ab 4a 80 00       	push   $0x804aab
+  801161:	6a 23                	push   $0x23
+  801163:	68 c8 4a 80 00       	push   $0x804ac8
+  801168:	e8 09 f2 ff ff       	call   800376 <_panic>
+
+0080116d <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	57                   	push   %edi
+  801171:	56                   	push   %esi
+  801172:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80117e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801181:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801184:	8b 75 18             	mov    0x18(%ebp),%esi
+  801187:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801189:	5b                   	pop    %ebx
+  80118a:	5e                   	pop    %esi
+  80118b:	5f                   	pop    %edi
+  80118c:	5d                   	pop    %ebp
+  80118d:	c3                   	ret
+
+0080118e <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+  801194:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011a7:	89 df                	mov    %ebx,%edi
+  8011a9:	89 de                	mov    %ebx,%esi
+  8011ab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ad:	85 c0                	test   %eax,%eax
+  8011af:	7f 08                	jg     8011b9 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8011b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b9:	83 ec 0c             	sub    $0xc,%esp
+  8011bc:	50                   	push   %eax
+  8011bd:	6a 0d                	push   $0xd
+  8011bf:	68 ab 4a 80 00       	push   $0x804aab
+  8011c4:	6a 23                	push   $0x23
+  8011c6:	68 c8 4a 80 00       	push   $0x804ac8
+  8011cb:	e8 a6 f1 ff ff       	call   800376 <_panic>
+
+008011d0 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011e0:	89 d1                	mov    %edx,%ecx
+  8011e2:	89 d3                	mov    %edx,%ebx
+  8011e4:	89 d7                	mov    %edx,%edi
+  8011e6:	89 d6                	mov    %edx,%esi
+  8011e8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011ea:	5b                   	pop    %ebx
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5f                   	pop    %edi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+
+008011ef <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801200:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801205:	89 df                	mov    %ebx,%edi
+  801207:	89 de                	mov    %ebx,%esi
+  801209:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80120b:	5b                   	pop    %ebx
+  80120c:	5e                   	pop    %esi
+  80120d:	5f                   	pop    %edi
+  80120e:	5d                   	pop    %ebp
+  80120f:	c3                   	ret
+
+00801210 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801210:	55                   	push   %ebp
+  801211:	89 e5                	mov    %esp,%ebp
+  801213:	57                   	push   %edi
+  801214:	56                   	push   %esi
+  801215:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801216:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801223:	89 cb                	mov    %ecx,%ebx
+  801225:	89 cf                	mov    %ecx,%edi
+  801227:	89 ce                	mov    %ecx,%esi
+  801229:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80122b:	5b                   	pop    %ebx
+  80122c:	5e                   	pop    %esi
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+
+00801230 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	57                   	push   %edi
+  801234:	56                   	push   %esi
+  801235:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801236:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801241:	b8 11 00 00 00       	mov    $0x11,%eax
+  801246:	89 df                	mov    %ebx,%edi
+  801248:	89 de                	mov    %ebx,%esi
+  80124a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80124c:	5b                   	pop    %ebx
+  80124d:	5e                   	pop    %esi
+  80124e:	5f                   	pop    %edi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+
+00801251 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	57                   	push   %edi
+  801255:	56                   	push   %esi
+  801256:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801257:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801262:	b8 12 00 00 00       	mov    $0x12,%eax
+  801267:	89 df                	mov    %ebx,%edi
+  801269:	89 de                	mov    %ebx,%esi
+  80126b:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80126d:	5b                   	pop    %ebx
+  80126e:	5e                   	pop    %esi
+  80126f:	5f                   	pop    %edi
+  801270:	5d                   	pop    %ebp
+  801271:	c3                   	ret
+
+00801272 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801272:	55                   	push   %ebp
+  801273:	89 e5                	mov    %esp,%ebp
+  801275:	57                   	push   %edi
+  801276:	56                   	push   %esi
+  801277:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801278:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	b8 13 00 00 00       	mov    $0x13,%eax
+  801285:	89 cb                	mov    %ecx,%ebx
+  801287:	89 cf                	mov    %ecx,%edi
+  801289:	89 ce                	mov    %ecx,%esi
+  80128b:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80128d:	5b                   	pop    %ebx
+  80128e:	5e                   	pop    %esi
+  80128f:	5f                   	pop    %edi
+  801290:	5d                   	pop    %ebp
+  801291:	c3                   	ret
+
+00801292 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801292:	55                   	push   %ebp
+  801293:	89 e5                	mov    %esp,%ebp
+  801295:	57                   	push   %edi
+  801296:	56                   	push   %esi
+  801297:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801298:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012a8:	89 df                	mov    %ebx,%edi
+  8012aa:	89 de                	mov    %ebx,%esi
+  8012ac:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8012ae:	5b                   	pop    %ebx
+  8012af:	5e                   	pop    %esi
+  8012b0:	5f                   	pop    %edi
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	c3                   	ret
+
+008012b3 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	57                   	push   %edi
+  8012b7:	56                   	push   %esi
+  8012b8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012c6:	89 cb                	mov    %ecx,%ebx
+  8012c8:	89 cf                	mov    %ecx,%edi
+  8012ca:	89 ce                	mov    %ecx,%esi
+  8012cc:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8012ce:	5b                   	pop    %ebx
+  8012cf:	5e                   	pop    %esi
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+
+008012d3 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	57                   	push   %edi
+  8012d7:	56                   	push   %esi
+  8012d8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ec:	89 f7                	mov    %esi,%edi
+  8012ee:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+
+008012f5 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	b8 17 00 00 00       	mov    $0x17,%eax
+  80130b:	89 df                	mov    %ebx,%edi
+  80130d:	89 de                	mov    %ebx,%esi
+  80130f:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801311:	5b                   	pop    %ebx
+  801312:	5e                   	pop    %esi
+  801313:	5f                   	pop    %edi
+  801314:	5d                   	pop    %ebp
+  801315:	c3                   	ret
+
+00801316 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	57                   	push   %edi
+  80131a:	56                   	push   %esi
+  80131b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80131c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801321:	8b 55 08             	mov    0x8(%ebp),%edx
+  801324:	b8 18 00 00 00       	mov    $0x18,%eax
+  801329:	89 cb                	mov    %ecx,%ebx
+  80132b:	89 cf                	mov    %ecx,%edi
+  80132d:	89 ce                	mov    %ecx,%esi
+  80132f:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801331:	5b                   	pop    %ebx
+  801332:	5e                   	pop    %esi
+  801333:	5f                   	pop    %edi
+  801334:	5d                   	pop    %ebp
+  801335:	c3                   	ret
+
+00801336 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80133c:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801340:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801348:	b8 19 00 00 00       	mov    $0x19,%eax
+  80134d:	89 df                	mov    %ebx,%edi
+  80134f:	89 de                	mov    %ebx,%esi
+  801351:	cd 30                	int    $0x30
+}
+  801353:	5b                   	pop    %ebx
+  801354:	5e                   	pop    %esi
+  801355:	5f                   	pop    %edi
+  801356:	5d                   	pop    %ebp
+  801357:	c3                   	ret
+
+00801358 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	57                   	push   %edi
+  80135c:	56                   	push   %esi
+  80135d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80135e:	be 00 00 00 00       	mov    $0x0,%esi
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+  801366:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801369:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80136e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801371:	89 f7                	mov    %esi,%edi
+  801373:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801375:	5b                   	pop    %ebx
+  801376:	5e                   	pop    %esi
+  801377:	5f                   	pop    %edi
+  801378:	5d                   	pop    %ebp
+  801379:	c3                   	ret
+
+0080137a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	57                   	push   %edi
+  80137e:	56                   	push   %esi
+  80137f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801380:	be 00 00 00 00       	mov    $0x0,%esi
+  801385:	8b 55 08             	mov    0x8(%ebp),%edx
+  801388:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801390:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801393:	89 f7                	mov    %esi,%edi
+  801395:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801397:	5b                   	pop    %ebx
+  801398:	5e                   	pop    %esi
+  801399:	5f                   	pop    %edi
+  80139a:	5d                   	pop    %ebp
+  80139b:	c3                   	ret
+
+0080139c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	57                   	push   %edi
+  8013a0:	56                   	push   %esi
+  8013a1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ad:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013b2:	89 df                	mov    %ebx,%edi
+  8013b4:	89 de                	mov    %ebx,%esi
+  8013b6:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5f                   	pop    %edi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+
+008013bd <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8013bd:	55                   	push   %ebp
+  8013be:	89 e5                	mov    %esp,%ebp
+  8013c0:	57                   	push   %edi
+  8013c1:	56                   	push   %esi
+  8013c2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ce:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d6:	89 f7                	mov    %esi,%edi
+  8013d8:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8013da:	5b                   	pop    %ebx
+  8013db:	5e                   	pop    %esi
+  8013dc:	5f                   	pop    %edi
+  8013dd:	5d                   	pop    %ebp
+  8013de:	c3                   	ret
+
+008013df <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	74 20                	je     801403 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8013e3:	89 c1                	mov    %eax,%ecx
+  8013e5:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8013eb:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8013f1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8013f7:	8b 52 48             	mov    0x48(%edx),%edx
+  8013fa:	39 c2                	cmp    %eax,%edx
+  8013fc:	74 06                	je     801404 <thread_alive+0x25>
+  8013fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801403:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801404:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  80140a:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801410:	85 c0                	test   %eax,%eax
+  801412:	0f 95 c0             	setne  %al
+  801415:	0f b6 c0             	movzbl %al,%eax
+  801418:	c3                   	ret
+
+00801419 <pgfault>:
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	57                   	push   %edi
+  80141d:	56                   	push   %esi
+  80141e:	53                   	push   %ebx
+  80141f:	83 ec 0c             	sub    $0xc,%esp
+  801422:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801425:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801427:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  80142a:	89 f3                	mov    %esi,%ebx
+  80142c:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  80142f:	83 3d a0 6a 80 00 00 	cmpl   $0x0,0x806aa0
+  801436:	74 52                	je     80148a <pgfault+0x71>
+  801438:	a8 02                	test   $0x2,%al
+  80143a:	75 14                	jne    801450 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  80143c:	83 ec 04             	sub    $0x4,%esp
+  80143f:	68 d6 4a 80 00       	push   $0x804ad6
+  801444:	6a 2e                	push   $0x2e
+  801446:	68 f4 4a 80 00       	push   $0x804af4
+  80144b:	e8 26 ef ff ff       	call   800376 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801450:	89 d8                	mov    %ebx,%eax
+  801452:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801457:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  80145e:	83 ec 0c             	sub    $0xc,%esp
+  801461:	57                   	push   %edi
+  801462:	e8 03 29 00 00       	call   803d6a <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801467:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80146e:	83 e0 03             	and    $0x3,%eax
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	83 f8 03             	cmp    $0x3,%eax
+  801477:	75 1a                	jne    801493 <pgfault+0x7a>
+			mutex_unlock(m);
+  801479:	83 ec 0c             	sub    $0xc,%esp
+  80147c:	57                   	push   %edi
+  80147d:	e8 56 29 00 00       	call   803dd8 <mutex_unlock>
+			return;
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	e9 9f 00 00 00       	jmp    801529 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80148a:	a8 02                	test   $0x2,%al
+  80148c:	74 ae                	je     80143c <pgfault+0x23>
+	struct mutex *m = NULL;
+  80148e:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801493:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80149a:	f6 c4 08             	test   $0x8,%ah
+  80149d:	74 9d                	je     80143c <pgfault+0x23>
+  80149f:	89 e0                	mov    %esp,%eax
+  8014a1:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8014a6:	29 c2                	sub    %eax,%edx
+  8014a8:	89 d0                	mov    %edx,%eax
+  8014aa:	c1 e8 0f             	shr    $0xf,%eax
+  8014ad:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8014b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b8:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8014bb:	c1 e0 0c             	shl    $0xc,%eax
+  8014be:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8014c3:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8014c5:	83 ec 04             	sub    $0x4,%esp
+  8014c8:	6a 07                	push   $0x7
+  8014ca:	53                   	push   %ebx
+  8014cb:	6a 00                	push   $0x0
+  8014cd:	e8 aa fa ff ff       	call   800f7c <sys_page_alloc>
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	78 58                	js     801531 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8014d9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8014df:	83 ec 04             	sub    $0x4,%esp
+  8014e2:	68 00 10 00 00       	push   $0x1000
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	e8 0a f8 ff ff       	call   800cf8 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8014ee:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8014f5:	56                   	push   %esi
+  8014f6:	6a 00                	push   $0x0
+  8014f8:	53                   	push   %ebx
+  8014f9:	6a 00                	push   $0x0
+  8014fb:	e8 bf fa ff ff       	call   800fbf <sys_page_map>
+  801500:	83 c4 20             	add    $0x20,%esp
+  801503:	85 c0                	test   %eax,%eax
+  801505:	78 3c                	js     801543 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801507:	83 ec 08             	sub    $0x8,%esp
+  80150a:	53                   	push   %ebx
+  80150b:	6a 00                	push   $0x0
+  80150d:	e8 ef fa ff ff       	call   801001 <sys_page_unmap>
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 3c                	js     801555 <pgfault+0x13c>
+	if(m)
+  801519:	85 ff                	test   %edi,%edi
+  80151b:	74 0c                	je     801529 <pgfault+0x110>
+		mutex_unlock(m);
+  80151d:	83 ec 0c             	sub    $0xc,%esp
+  801520:	57                   	push   %edi
+  801521:	e8 b2 28 00 00       	call   803dd8 <mutex_unlock>
+  801526:	83 c4 10             	add    $0x10,%esp
+}
+  801529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801531:	50                   	push   %eax
+  801532:	68 ff 4a 80 00       	push   $0x804aff
+  801537:	6a 3d                	push   $0x3d
+  801539:	68 f4 4a 80 00       	push   $0x804af4
+  80153e:	e8 33 ee ff ff       	call   800376 <_panic>
+		panic("sys_page_map: %e", ret);
+  801543:	50                   	push   %eax
+  801544:	68 12 4b 80 00       	push   $0x804b12
+  801549:	6a 40                	push   $0x40
+  80154b:	68 f4 4a 80 00       	push   $0x804af4
+  801550:	e8 21 ee ff ff       	call   800376 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801555:	50                   	push   %eax
+  801556:	68 23 4b 80 00       	push   $0x804b23
+  80155b:	6a 42                	push   $0x42
+  80155d:	68 f4 4a 80 00       	push   $0x804af4
+  801562:	e8 0f ee ff ff       	call   800376 <_panic>
+
+00801567 <thread_main>:
+{
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  80156d:	ff 75 0c             	push   0xc(%ebp)
+  801570:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801573:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80157a:	e8 7e f9 ff ff       	call   800efd <sys_env_destroy>
+}
+  80157f:	83 c4 10             	add    $0x10,%esp
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+
+00801584 <fork>:
+{
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	57                   	push   %edi
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+  80158a:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  80158d:	68 19 14 80 00       	push   $0x801419
+  801592:	e8 1f 2b 00 00       	call   8040b6 <set_pgfault_handler>
+	if(sforked)
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	83 3d a0 6a 80 00 00 	cmpl   $0x0,0x806aa0
+  8015a1:	75 33                	jne    8015d6 <fork+0x52>
+	__asm __volatile("int %2"
+  8015a3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015a8:	cd 30                	int    $0x30
+  8015aa:	89 c7                	mov    %eax,%edi
+  8015ac:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8015ae:	85 c0                	test   %eax,%eax
+  8015b0:	0f 88 b4 00 00 00    	js     80166a <fork+0xe6>
+	if(envid == 0) {
+  8015b6:	0f 84 c3 00 00 00    	je     80167f <fork+0xfb>
+	pgbatch_init(&pb);
+  8015bc:	83 ec 0c             	sub    $0xc,%esp
+  8015bf:	68 40 63 80 00       	push   $0x806340
+  8015c4:	e8 ed 25 00 00       	call   803bb6 <pgbatch_init>
+  8015c9:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8015cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d1:	e9 9c 01 00 00       	jmp    801772 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8015d6:	83 ec 0c             	sub    $0xc,%esp
+  8015d9:	68 e0 66 80 00       	push   $0x8066e0
+  8015de:	e8 87 27 00 00       	call   803d6a <mutex_lock>
+  8015e3:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8015eb:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8015f0:	eb 08                	jmp    8015fa <fork+0x76>
+  8015f2:	83 c3 01             	add    $0x1,%ebx
+  8015f5:	83 fb 20             	cmp    $0x20,%ebx
+  8015f8:	74 5b                	je     801655 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8015fa:	8b 34 9d 60 66 80 00 	mov    0x806660(,%ebx,4),%esi
+  801601:	89 f0                	mov    %esi,%eax
+  801603:	e8 d7 fd ff ff       	call   8013df <thread_alive>
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	74 e6                	je     8015f2 <fork+0x6e>
+  80160c:	89 e0                	mov    %esp,%eax
+  80160e:	89 fa                	mov    %edi,%edx
+  801610:	29 c2                	sub    %eax,%edx
+  801612:	89 d0                	mov    %edx,%eax
+  801614:	c1 e8 0f             	shr    $0xf,%eax
+  801617:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80161d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801622:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  801625:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80162c:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  80162f:	83 ec 08             	sub    $0x8,%esp
+  801632:	50                   	push   %eax
+  801633:	56                   	push   %esi
+  801634:	e8 8e fa ff ff       	call   8010c7 <sys_env_set_pgfault_upcall>
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	79 b2                	jns    8015f2 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801640:	50                   	push   %eax
+  801641:	68 b0 4b 80 00       	push   $0x804bb0
+  801646:	68 00 01 00 00       	push   $0x100
+  80164b:	68 f4 4a 80 00       	push   $0x804af4
+  801650:	e8 21 ed ff ff       	call   800376 <_panic>
+	mutex_unlock(&sfork_lock);
+  801655:	83 ec 0c             	sub    $0xc,%esp
+  801658:	68 e0 66 80 00       	push   $0x8066e0
+  80165d:	e8 76 27 00 00       	call   803dd8 <mutex_unlock>
+}
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	e9 39 ff ff ff       	jmp    8015a3 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  80166a:	50                   	push   %eax
+  80166b:	68 36 4b 80 00       	push   $0x804b36
+  801670:	68 91 00 00 00       	push   $0x91
+  801675:	68 f4 4a 80 00       	push   $0x804af4
+  80167a:	e8 f7 ec ff ff       	call   800376 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80167f:	e8 ba f8 ff ff       	call   800f3e <sys_getenvid>
+  801684:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801689:	89 e1                	mov    %esp,%ecx
+  80168b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801690:	29 ca                	sub    %ecx,%edx
+  801692:	89 d1                	mov    %edx,%ecx
+  801694:	c1 e9 0f             	shr    $0xf,%ecx
+  801697:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80169d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a2:	0f 42 d1             	cmovb  %ecx,%edx
+  8016a5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8016ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016b0:	89 04 95 20 6a 80 00 	mov    %eax,0x806a20(,%edx,4)
+		if(sforked)
+  8016b7:	a1 a0 6a 80 00       	mov    0x806aa0,%eax
+  8016bc:	85 c0                	test   %eax,%eax
+  8016be:	75 07                	jne    8016c7 <fork+0x143>
+		return 0;
+  8016c0:	89 c6                	mov    %eax,%esi
+  8016c2:	e9 6f 02 00 00       	jmp    801936 <fork+0x3b2>
+  8016c7:	89 e2                	mov    %esp,%edx
+  8016c9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8016ce:	29 d0                	sub    %edx,%eax
+  8016d0:	89 c3                	mov    %eax,%ebx
+  8016d2:	c1 eb 0f             	shr    $0xf,%ebx
+  8016d5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016df:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8016e2:	83 ec 04             	sub    $0x4,%esp
+  8016e5:	68 80 00 00 00       	push   $0x80
+  8016ea:	6a 00                	push   $0x0
+  8016ec:	68 60 66 80 00       	push   $0x806660
+  8016f1:	e8 cd f5 ff ff       	call   800cc3 <memset>
+	thread_ids[slot] = sys_getenvid();
+  8016f6:	e8 43 f8 ff ff       	call   800f3e <sys_getenvid>
+  8016fb:	89 04 9d 60 66 80 00 	mov    %eax,0x806660(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  801702:	8b 04 9d 20 6a 80 00 	mov    0x806a20(,%ebx,4),%eax
+  801709:	a3 20 6a 80 00       	mov    %eax,0x806a20
+	mutex_init(&sfork_lock);
+  80170e:	c7 04 24 e0 66 80 00 	movl   $0x8066e0,(%esp)
+  801715:	e8 42 26 00 00       	call   803d5c <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80171a:	83 c4 0c             	add    $0xc,%esp
+  80171d:	68 07 04 00 00       	push   $0x407
+  801722:	68 00 00 00 e1       	push   $0xe1000000
+  801727:	6a 00                	push   $0x0
+  801729:	e8 4e f8 ff ff       	call   800f7c <sys_page_alloc>
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	85 c0                	test   %eax,%eax
+  801733:	0f 89 fd 01 00 00    	jns    801936 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801739:	50                   	push   %eax
+  80173a:	68 ff 4a 80 00       	push   $0x804aff
+  80173f:	68 12 01 00 00       	push   $0x112
+  801744:	68 f4 4a 80 00       	push   $0x804af4
+  801749:	e8 28 ec ff ff       	call   800376 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  80174e:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801754:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  80175a:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801760:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801766:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  80176c:	0f 87 4f 01 00 00    	ja     8018c1 <fork+0x33d>
+		pd = PDX(addr);
+  801772:	89 d8                	mov    %ebx,%eax
+  801774:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801777:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80177e:	f6 c2 01             	test   $0x1,%dl
+  801781:	74 cb                	je     80174e <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801783:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801788:	0f 85 92 00 00 00    	jne    801820 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  80178e:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801794:	76 10                	jbe    8017a6 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801796:	89 d8                	mov    %ebx,%eax
+  801798:	f7 d8                	neg    %eax
+  80179a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80179f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017a4:	74 ba                	je     801760 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8017a6:	89 d8                	mov    %ebx,%eax
+  8017a8:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8017ab:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017b2:	f6 c2 01             	test   $0x1,%dl
+  8017b5:	74 a9                	je     801760 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8017b7:	89 c1                	mov    %eax,%ecx
+  8017b9:	c1 e1 0c             	shl    $0xc,%ecx
+  8017bc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8017bf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017c6:	f6 c6 04             	test   $0x4,%dh
+  8017c9:	0f 85 8e 00 00 00    	jne    80185d <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8017cf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017d6:	f6 c6 08             	test   $0x8,%dh
+  8017d9:	75 0f                	jne    8017ea <fork+0x266>
+  8017db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017e2:	a8 02                	test   $0x2,%al
+  8017e4:	0f 84 bb 00 00 00    	je     8018a5 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8017ea:	83 ec 08             	sub    $0x8,%esp
+  8017ed:	68 05 08 00 00       	push   $0x805
+  8017f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017f5:	50                   	push   %eax
+  8017f6:	56                   	push   %esi
+  8017f7:	50                   	push   %eax
+  8017f8:	6a 00                	push   $0x0
+  8017fa:	68 40 63 80 00       	push   $0x806340
+  8017ff:	e8 70 24 00 00       	call   803c74 <pgbatch_map>
+  801804:	83 c4 20             	add    $0x20,%esp
+  801807:	85 c0                	test   %eax,%eax
+  801809:	79 76                	jns    801881 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  80180b:	50                   	push   %eax
+  80180c:	68 5a 4b 80 00       	push   $0x804b5a
+  801811:	68 bc 00 00 00       	push   $0xbc
+  801816:	68 f4 4a 80 00       	push   $0x804af4
+  80181b:	e8 56 eb ff ff       	call   800376 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801820:	83 ec 0c             	sub    $0xc,%esp
+  801823:	68 00 08 00 00       	push   $0x800
+  801828:	56                   	push   %esi
+  801829:	53                   	push   %ebx
+  80182a:	6a 00                	push   $0x0
+  80182c:	68 40 63 80 00       	push   $0x806340
+  801831:	e8 e9 24 00 00       	call   803d1f <pgbatch_sharept>
+  801836:	83 c4 20             	add    $0x20,%esp
+  801839:	85 c0                	test   %eax,%eax
+  80183b:	78 0b                	js     801848 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  80183d:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801843:	e9 18 ff ff ff       	jmp    801760 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801848:	50                   	push   %eax
+  801849:	68 46 4b 80 00       	push   $0x804b46
+  80184e:	68 b2 00 00 00       	push   $0xb2
+  801853:	68 f4 4a 80 00       	push   $0x804af4
+  801858:	e8 19 eb ff ff       	call   800376 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  80185d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801864:	83 ec 08             	sub    $0x8,%esp
+  801867:	25 07 0e 00 00       	and    $0xe07,%eax
+  80186c:	50                   	push   %eax
+  80186d:	51                   	push   %ecx
+  80186e:	56                   	push   %esi
+  80186f:	51                   	push   %ecx
+  801870:	6a 00                	push   $0x0
+  801872:	68 40 63 80 00       	push   $0x806340
+  801877:	e8 f8 23 00 00       	call   803c74 <pgbatch_map>
+  80187c:	83 c4 20             	add    $0x20,%esp
+  80187f:	eb 17                	jmp    801898 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801881:	68 05 08 00 00       	push   $0x805
+  801886:	ff 75 e4             	push   -0x1c(%ebp)
+  801889:	6a 00                	push   $0x0
+  80188b:	68 40 63 80 00       	push   $0x806340
+  801890:	e8 53 24 00 00       	call   803ce8 <pgbatch_protect>
+  801895:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	0f 89 c0 fe ff ff    	jns    801760 <fork+0x1dc>
+  8018a0:	e9 66 ff ff ff       	jmp    80180b <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8018a5:	83 ec 08             	sub    $0x8,%esp
+  8018a8:	6a 05                	push   $0x5
+  8018aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018ad:	50                   	push   %eax
+  8018ae:	56                   	push   %esi
+  8018af:	50                   	push   %eax
+  8018b0:	6a 00                	push   $0x0
+  8018b2:	68 40 63 80 00       	push   $0x806340
+  8018b7:	e8 b8 23 00 00       	call   803c74 <pgbatch_map>
+  8018bc:	83 c4 20             	add    $0x20,%esp
+  8018bf:	eb d7                	jmp    801898 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  8018c1:	6a 07                	push   $0x7
+  8018c3:	68 00 f0 bf ee       	push   $0xeebff000
+  8018c8:	57                   	push   %edi
+  8018c9:	68 40 63 80 00       	push   $0x806340
+  8018ce:	e8 6a 23 00 00       	call   803c3d <pgbatch_alloc>
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 66                	js     801940 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8018da:	83 ec 0c             	sub    $0xc,%esp
+  8018dd:	68 40 63 80 00       	push   $0x806340
+  8018e2:	e8 dd 22 00 00       	call   803bc4 <pgbatch_flush>
+  8018e7:	83 c4 10             	add    $0x10,%esp
+  8018ea:	85 c0                	test   %eax,%eax
+  8018ec:	78 52                	js     801940 <fork+0x3bc>
+  8018ee:	89 e2                	mov    %esp,%edx
+  8018f0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8018f5:	29 d0                	sub    %edx,%eax
+  8018f7:	89 c2                	mov    %eax,%edx
+  8018f9:	c1 ea 0f             	shr    $0xf,%edx
+  8018fc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+  801906:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801909:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801910:	8b 40 78             	mov    0x78(%eax),%eax
+  801913:	83 ec 08             	sub    $0x8,%esp
+  801916:	50                   	push   %eax
+  801917:	57                   	push   %edi
+  801918:	e8 aa f7 ff ff       	call   8010c7 <sys_env_set_pgfault_upcall>
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	78 31                	js     801955 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801924:	83 ec 08             	sub    $0x8,%esp
+  801927:	6a 02                	push   $0x2
+  801929:	57                   	push   %edi
+  80192a:	e8 14 f7 ff ff       	call   801043 <sys_env_set_status>
+  80192f:	83 c4 10             	add    $0x10,%esp
+  801932:	85 c0                	test   %eax,%eax
+  801934:	78 34                	js     80196a <fork+0x3e6>
+}
+  801936:	89 f0                	mov    %esi,%eax
+  801938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193b:	5b                   	pop    %ebx
+  80193c:	5e                   	pop    %esi
+  80193d:	5f                   	pop    %edi
+  80193e:	5d                   	pop    %ebp
+  80193f:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801940:	50                   	push   %eax
+  801941:	68 66 4b 80 00       	push   $0x804b66
+  801946:	68 c0 00 00 00       	push   $0xc0
+  80194b:	68 f4 4a 80 00       	push   $0x804af4
+  801950:	e8 21 ea ff ff       	call   800376 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801955:	50                   	push   %eax
+  801956:	68 7b 4b 80 00       	push   $0x804b7b
+  80195b:	68 c2 00 00 00       	push   $0xc2
+  801960:	68 f4 4a 80 00       	push   $0x804af4
+  801965:	e8 0c ea ff ff       	call   800376 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  80196a:	50                   	push   %eax
+  80196b:	68 96 4b 80 00       	push   $0x804b96
+  801970:	68 c4 00 00 00       	push   $0xc4
+  801975:	68 f4 4a 80 00       	push   $0x804af4
+  80197a:	e8 f7 e9 ff ff       	call   800376 <_panic>
+
+0080197f <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  80197f:	55                   	push   %ebp
+  801980:	89 e5                	mov    %esp,%ebp
+  801982:	57                   	push   %edi
+  801983:	56                   	push   %esi
+  801984:	53                   	push   %ebx
+  801985:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801988:	68 e0 66 80 00       	push   $0x8066e0
+  80198d:	e8 d8 23 00 00       	call   803d6a <mutex_lock>
+  801992:	89 e2                	mov    %esp,%edx
+  801994:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801999:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  80199b:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80199e:	89 c3                	mov    %eax,%ebx
+  8019a0:	c1 eb 0f             	shr    $0xf,%ebx
+  8019a3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ad:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  8019b0:	e8 89 f5 ff ff       	call   800f3e <sys_getenvid>
+  8019b5:	89 04 9d 60 66 80 00 	mov    %eax,0x806660(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  8019bc:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8019c1:	8b 04 9d 60 66 80 00 	mov    0x806660(,%ebx,4),%eax
+  8019c8:	e8 12 fa ff ff       	call   8013df <thread_alive>
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	74 24                	je     8019f5 <sfork+0x76>
+  8019d1:	83 c3 01             	add    $0x1,%ebx
+  8019d4:	83 fb 20             	cmp    $0x20,%ebx
+  8019d7:	75 e8                	jne    8019c1 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  8019d9:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  8019de:	83 ec 0c             	sub    $0xc,%esp
+  8019e1:	68 e0 66 80 00       	push   $0x8066e0
+  8019e6:	e8 ed 23 00 00       	call   803dd8 <mutex_unlock>
+	return r;
+}
+  8019eb:	89 f0                	mov    %esi,%eax
+  8019ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f0:	5b                   	pop    %ebx
+  8019f1:	5e                   	pop    %esi
+  8019f2:	5f                   	pop    %edi
+  8019f3:	5d                   	pop    %ebp
+  8019f4:	c3                   	ret
+	if (i == NTHREADS) {
+  8019f5:	83 fb 20             	cmp    $0x20,%ebx
+  8019f8:	0f 84 53 01 00 00    	je     801b51 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  8019fe:	89 d8                	mov    %ebx,%eax
+  801a00:	c1 e0 0f             	shl    $0xf,%eax
+  801a03:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801a06:	83 ec 0c             	sub    $0xc,%esp
+  801a09:	68 20 60 80 00       	push   $0x806020
+  801a0e:	e8 a3 21 00 00       	call   803bb6 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801a13:	83 c4 10             	add    $0x10,%esp
+  801a16:	83 3d a0 6a 80 00 00 	cmpl   $0x0,0x806aa0
+  801a1d:	75 1f                	jne    801a3e <sfork+0xbf>
+  801a1f:	68 07 04 00 00       	push   $0x407
+  801a24:	68 00 00 00 e1       	push   $0xe1000000
+  801a29:	6a 00                	push   $0x0
+  801a2b:	68 20 60 80 00       	push   $0x806020
+  801a30:	e8 08 22 00 00       	call   803c3d <pgbatch_alloc>
+  801a35:	89 c6                	mov    %eax,%esi
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	85 c0                	test   %eax,%eax
+  801a3c:	78 a0                	js     8019de <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801a3e:	6a 07                	push   $0x7
+  801a40:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801a45:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a48:	29 c8                	sub    %ecx,%eax
+  801a4a:	50                   	push   %eax
+  801a4b:	6a 00                	push   $0x0
+  801a4d:	68 20 60 80 00       	push   $0x806020
+  801a52:	e8 e6 21 00 00       	call   803c3d <pgbatch_alloc>
+  801a57:	89 c6                	mov    %eax,%esi
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	0f 88 7a ff ff ff    	js     8019de <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801a64:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801a69:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a6c:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801a6e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801a73:	29 c8                	sub    %ecx,%eax
+  801a75:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a78:	39 c7                	cmp    %eax,%edi
+  801a7a:	73 29                	jae    801aa5 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801a7c:	6a 07                	push   $0x7
+  801a7e:	57                   	push   %edi
+  801a7f:	6a 00                	push   $0x0
+  801a81:	68 20 60 80 00       	push   $0x806020
+  801a86:	e8 b2 21 00 00       	call   803c3d <pgbatch_alloc>
+  801a8b:	89 c6                	mov    %eax,%esi
+  801a8d:	83 c4 10             	add    $0x10,%esp
+  801a90:	85 c0                	test   %eax,%eax
+  801a92:	0f 88 46 ff ff ff    	js     8019de <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801a98:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801a9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801aa1:	39 c7                	cmp    %eax,%edi
+  801aa3:	72 d7                	jb     801a7c <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801aa5:	83 ec 0c             	sub    $0xc,%esp
+  801aa8:	68 20 60 80 00       	push   $0x806020
+  801aad:	e8 12 21 00 00       	call   803bc4 <pgbatch_flush>
+  801ab2:	89 c6                	mov    %eax,%esi
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	85 c0                	test   %eax,%eax
+  801ab9:	0f 88 1f ff ff ff    	js     8019de <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801abf:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801ac4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ac7:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801ac9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801acf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad2:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801ad5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ad8:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801adb:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801ade:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801ae3:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801ae5:	52                   	push   %edx
+  801ae6:	50                   	push   %eax
+  801ae7:	68 67 15 80 00       	push   $0x801567
+  801aec:	e8 cc f8 ff ff       	call   8013bd <sys_exofork_shared>
+  801af1:	89 c6                	mov    %eax,%esi
+  801af3:	83 c4 10             	add    $0x10,%esp
+  801af6:	85 c0                	test   %eax,%eax
+  801af8:	0f 88 e0 fe ff ff    	js     8019de <sfork+0x5f>
+	thread_ids[i] = id;
+  801afe:	89 04 9d 60 66 80 00 	mov    %eax,0x806660(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801b05:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b0a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801b10:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b15:	89 04 9d 20 6a 80 00 	mov    %eax,0x806a20(,%ebx,4)
+	sforked = 1;
+  801b1c:	c7 05 a0 6a 80 00 01 	movl   $0x1,0x806aa0
+  801b23:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b26:	83 ec 08             	sub    $0x8,%esp
+  801b29:	6a 02                	push   $0x2
+  801b2b:	56                   	push   %esi
+  801b2c:	e8 12 f5 ff ff       	call   801043 <sys_env_set_status>
+  801b31:	89 c3                	mov    %eax,%ebx
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	0f 89 a0 fe ff ff    	jns    8019de <sfork+0x5f>
+		sys_env_destroy(id);
+  801b3e:	83 ec 0c             	sub    $0xc,%esp
+  801b41:	56                   	push   %esi
+  801b42:	e8 b6 f3 ff ff       	call   800efd <sys_env_destroy>
+		goto out;
+  801b47:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b4a:	89 de                	mov    %ebx,%esi
+		goto out;
+  801b4c:	e9 8d fe ff ff       	jmp    8019de <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801b51:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801b56:	e9 83 fe ff ff       	jmp    8019de <sfork+0x5f>
+
+00801b5b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b5b:	55                   	push   %ebp
+  801b5c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b61:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b66:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801b69:	5d                   	pop    %ebp
+  801b6a:	c3                   	ret
+
+00801b6b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801b6b:	55                   	push   %ebp
+  801b6c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b71:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b76:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b7b:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801b80:	5d                   	pop    %ebp
+  801b81:	c3                   	ret
+
+00801b82 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b82:	55                   	push   %ebp
+  801b83:	89 e5                	mov    %esp,%ebp
+  801b85:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801b8a:	89 c2                	mov    %eax,%edx
+  801b8c:	c1 ea 16             	shr    $0x16,%edx
+  801b8f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b96:	f6 c2 01             	test   $0x1,%dl
+  801b99:	74 29                	je     801bc4 <fd_alloc+0x42>
+  801b9b:	89 c2                	mov    %eax,%edx
+  801b9d:	c1 ea 0c             	shr    $0xc,%edx
+  801ba0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ba7:	f6 c2 01             	test   $0x1,%dl
+  801baa:	74 18                	je     801bc4 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801bac:	05 00 10 00 00       	add    $0x1000,%eax
+  801bb1:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801bb6:	75 d2                	jne    801b8a <fd_alloc+0x8>
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801bbd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801bc2:	eb 05                	jmp    801bc9 <fd_alloc+0x47>
+			return 0;
+  801bc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801bc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bcc:	89 02                	mov    %eax,(%edx)
+}
+  801bce:	89 c8                	mov    %ecx,%eax
+  801bd0:	5d                   	pop    %ebp
+  801bd1:	c3                   	ret
+
+00801bd2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801bd2:	55                   	push   %ebp
+  801bd3:	89 e5                	mov    %esp,%ebp
+  801bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801bd8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801bdd:	77 30                	ja     801c0f <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801bdf:	c1 e0 0c             	shl    $0xc,%eax
+  801be2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801be7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801bed:	f6 c2 01             	test   $0x1,%dl
+  801bf0:	74 24                	je     801c16 <fd_lookup+0x44>
+  801bf2:	89 c2                	mov    %eax,%edx
+  801bf4:	c1 ea 0c             	shr    $0xc,%edx
+  801bf7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801bfe:	f6 c2 01             	test   $0x1,%dl
+  801c01:	74 1a                	je     801c1d <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c03:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c06:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c0d:	5d                   	pop    %ebp
+  801c0e:	c3                   	ret
+		return -E_INVAL;
+  801c0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c14:	eb f7                	jmp    801c0d <fd_lookup+0x3b>
+		return -E_INVAL;
+  801c16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c1b:	eb f0                	jmp    801c0d <fd_lookup+0x3b>
+  801c1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c22:	eb e9                	jmp    801c0d <fd_lookup+0x3b>
+
+00801c24 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c24:	55                   	push   %ebp
+  801c25:	89 e5                	mov    %esp,%ebp
+  801c27:	53                   	push   %ebx
+  801c28:	83 ec 04             	sub    $0x4,%esp
+  801c2b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c33:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801c38:	39 13                	cmp    %edx,(%ebx)
+  801c3a:	74 54                	je     801c90 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801c3c:	83 c0 01             	add    $0x1,%eax
+  801c3f:	8b 1c 85 4c 4c 80 00 	mov    0x804c4c(,%eax,4),%ebx
+  801c46:	85 db                	test   %ebx,%ebx
+  801c48:	75 ee                	jne    801c38 <dev_lookup+0x14>
+  801c4a:	89 e1                	mov    %esp,%ecx
+  801c4c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c51:	29 c8                	sub    %ecx,%eax
+  801c53:	89 c1                	mov    %eax,%ecx
+  801c55:	c1 e9 0f             	shr    $0xf,%ecx
+  801c58:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c62:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c65:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801c6c:	8b 40 48             	mov    0x48(%eax),%eax
+  801c6f:	83 ec 04             	sub    $0x4,%esp
+  801c72:	52                   	push   %edx
+  801c73:	50                   	push   %eax
+  801c74:	68 d0 4b 80 00       	push   $0x804bd0
+  801c79:	e8 d3 e7 ff ff       	call   800451 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c89:	89 1a                	mov    %ebx,(%edx)
+}
+  801c8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8e:	c9                   	leave
+  801c8f:	c3                   	ret
+			return 0;
+  801c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c95:	eb ef                	jmp    801c86 <dev_lookup+0x62>
+
+00801c97 <fd_close>:
+{
+  801c97:	55                   	push   %ebp
+  801c98:	89 e5                	mov    %esp,%ebp
+  801c9a:	57                   	push   %edi
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	83 ec 24             	sub    $0x24,%esp
+  801ca0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ca3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ca6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ca9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801caa:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801cb0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801cb3:	50                   	push   %eax
+  801cb4:	e8 19 ff ff ff       	call   801bd2 <fd_lookup>
+  801cb9:	89 c3                	mov    %eax,%ebx
+  801cbb:	83 c4 10             	add    $0x10,%esp
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	78 05                	js     801cc7 <fd_close+0x30>
+	    || fd != fd2)
+  801cc2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801cc5:	74 0f                	je     801cd6 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801cc7:	85 ff                	test   %edi,%edi
+  801cc9:	0f 44 df             	cmove  %edi,%ebx
+}
+  801ccc:	89 d8                	mov    %ebx,%eax
+  801cce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd1:	5b                   	pop    %ebx
+  801cd2:	5e                   	pop    %esi
+  801cd3:	5f                   	pop    %edi
+  801cd4:	5d                   	pop    %ebp
+  801cd5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cd6:	83 ec 08             	sub    $0x8,%esp
+  801cd9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801cdc:	50                   	push   %eax
+  801cdd:	ff 36                	push   (%esi)
+  801cdf:	e8 40 ff ff ff       	call   801c24 <dev_lookup>
+  801ce4:	89 c3                	mov    %eax,%ebx
+  801ce6:	83 c4 10             	add    $0x10,%esp
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	78 1a                	js     801d07 <fd_close+0x70>
+		if (dev->dev_close)
+  801ced:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cf0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	74 0b                	je     801d07 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801cfc:	83 ec 0c             	sub    $0xc,%esp
+  801cff:	56                   	push   %esi
+  801d00:	ff d0                	call   *%eax
+  801d02:	89 c3                	mov    %eax,%ebx
+  801d04:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d07:	83 ec 08             	sub    $0x8,%esp
+  801d0a:	56                   	push   %esi
+  801d0b:	6a 00                	push   $0x0
+  801d0d:	e8 ef f2 ff ff       	call   801001 <sys_page_unmap>
+	return r;
+  801d12:	83 c4 10             	add    $0x10,%esp
+  801d15:	eb b5                	jmp    801ccc <fd_close+0x35>
+
+00801d17 <close>:
+
+int
+close(int fdnum)
+{
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d20:	50                   	push   %eax
+  801d21:	ff 75 08             	push   0x8(%ebp)
+  801d24:	e8 a9 fe ff ff       	call   801bd2 <fd_lookup>
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	79 02                	jns    801d32 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d30:	c9                   	leave
+  801d31:	c3                   	ret
+		return fd_close(fd, 1);
+  801d32:	83 ec 08             	sub    $0x8,%esp
+  801d35:	6a 01                	push   $0x1
+  801d37:	ff 75 f4             	push   -0xc(%ebp)
+  801d3a:	e8 58 ff ff ff       	call   801c97 <fd_close>
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	eb ec                	jmp    801d30 <close+0x19>
+
+00801d44 <close_all>:
+
+void
+close_all(void)
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	53                   	push   %ebx
+  801d48:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d50:	83 ec 0c             	sub    $0xc,%esp
+  801d53:	53                   	push   %ebx
+  801d54:	e8 be ff ff ff       	call   801d17 <close>
+	for (i = 0; i < MAXFD; i++)
+  801d59:	83 c3 01             	add    $0x1,%ebx
+  801d5c:	83 c4 10             	add    $0x10,%esp
+  801d5f:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801d65:	75 e9                	jne    801d50 <close_all+0xc>
+}
+  801d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d6a:	c9                   	leave
+  801d6b:	c3                   	ret
+
+00801d6c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801d6c:	55                   	push   %ebp
+  801d6d:	89 e5                	mov    %esp,%ebp
+  801d6f:	57                   	push   %edi
+  801d70:	56                   	push   %esi
+  801d71:	53                   	push   %ebx
+  801d72:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d75:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d78:	50                   	push   %eax
+  801d79:	ff 75 08             	push   0x8(%ebp)
+  801d7c:	e8 51 fe ff ff       	call   801bd2 <fd_lookup>
+  801d81:	89 c3                	mov    %eax,%ebx
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 7f                	js     801e09 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801d8a:	83 ec 0c             	sub    $0xc,%esp
+  801d8d:	ff 75 0c             	push   0xc(%ebp)
+  801d90:	e8 82 ff ff ff       	call   801d17 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801d95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d98:	c1 e6 0c             	shl    $0xc,%esi
+  801d9b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801da1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801da4:	89 3c 24             	mov    %edi,(%esp)
+  801da7:	e8 bf fd ff ff       	call   801b6b <fd2data>
+  801dac:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801dae:	89 34 24             	mov    %esi,(%esp)
+  801db1:	e8 b5 fd ff ff       	call   801b6b <fd2data>
+  801db6:	83 c4 10             	add    $0x10,%esp
+  801db9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801dbc:	89 d8                	mov    %ebx,%eax
+  801dbe:	c1 e8 16             	shr    $0x16,%eax
+  801dc1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801dc8:	a8 01                	test   $0x1,%al
+  801dca:	74 11                	je     801ddd <dup+0x71>
+  801dcc:	89 d8                	mov    %ebx,%eax
+  801dce:	c1 e8 0c             	shr    $0xc,%eax
+  801dd1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801dd8:	f6 c2 01             	test   $0x1,%dl
+  801ddb:	75 36                	jne    801e13 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ddd:	89 f8                	mov    %edi,%eax
+  801ddf:	c1 e8 0c             	shr    $0xc,%eax
+  801de2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801de9:	83 ec 0c             	sub    $0xc,%esp
+  801dec:	25 07 0e 00 00       	and    $0xe07,%eax
+  801df1:	50                   	push   %eax
+  801df2:	56                   	push   %esi
+  801df3:	6a 00                	push   $0x0
+  801df5:	57                   	push   %edi
+  801df6:	6a 00                	push   $0x0
+  801df8:	e8 c2 f1 ff ff       	call   800fbf <sys_page_map>
+  801dfd:	89 c3                	mov    %eax,%ebx
+  801dff:	83 c4 20             	add    $0x20,%esp
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	78 33                	js     801e39 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e09:	89 d8                	mov    %ebx,%eax
+  801e0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e0e:	5b                   	pop    %ebx
+  801e0f:	5e                   	pop    %esi
+  801e10:	5f                   	pop    %edi
+  801e11:	5d                   	pop    %ebp
+  801e12:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e13:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e1a:	83 ec 0c             	sub    $0xc,%esp
+  801e1d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e22:	50                   	push   %eax
+  801e23:	ff 75 d4             	push   -0x2c(%ebp)
+  801e26:	6a 00                	push   $0x0
+  801e28:	53                   	push   %ebx
+  801e29:	6a 00                	push   $0x0
+  801e2b:	e8 8f f1 ff ff       	call   800fbf <sys_page_map>
+  801e30:	89 c3                	mov    %eax,%ebx
+  801e32:	83 c4 20             	add    $0x20,%esp
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	79 a4                	jns    801ddd <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e39:	83 ec 08             	sub    $0x8,%esp
+  801e3c:	56                   	push   %esi
+  801e3d:	6a 00                	push   $0x0
+  801e3f:	e8 bd f1 ff ff       	call   801001 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e44:	83 c4 08             	add    $0x8,%esp
+  801e47:	ff 75 d4             	push   -0x2c(%ebp)
+  801e4a:	6a 00                	push   $0x0
+  801e4c:	e8 b0 f1 ff ff       	call   801001 <sys_page_unmap>
+	return r;
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	eb b3                	jmp    801e09 <dup+0x9d>
+
+00801e56 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	56                   	push   %esi
+  801e5a:	53                   	push   %ebx
+  801e5b:	83 ec 18             	sub    $0x18,%esp
+  801e5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e61:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e64:	50                   	push   %eax
+  801e65:	53                   	push   %ebx
+  801e66:	e8 67 fd ff ff       	call   801bd2 <fd_lookup>
+  801e6b:	83 c4 10             	add    $0x10,%esp
+  801e6e:	85 c0                	test   %eax,%eax
+  801e70:	78 3c                	js     801eae <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e72:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e75:	83 ec 08             	sub    $0x8,%esp
+  801e78:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e7b:	50                   	push   %eax
+  801e7c:	ff 36                	push   (%esi)
+  801e7e:	e8 a1 fd ff ff       	call   801c24 <dev_lookup>
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 24                	js     801eae <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e8a:	8b 46 08             	mov    0x8(%esi),%eax
+  801e8d:	83 e0 03             	and    $0x3,%eax
+  801e90:	83 f8 01             	cmp    $0x1,%eax
+  801e93:	74 20                	je     801eb5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801e95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e98:	8b 40 08             	mov    0x8(%eax),%eax
+  801e9b:	85 c0                	test   %eax,%eax
+  801e9d:	74 54                	je     801ef3 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e9f:	83 ec 04             	sub    $0x4,%esp
+  801ea2:	ff 75 10             	push   0x10(%ebp)
+  801ea5:	ff 75 0c             	push   0xc(%ebp)
+  801ea8:	56                   	push   %esi
+  801ea9:	ff d0                	call   *%eax
+  801eab:	83 c4 10             	add    $0x10,%esp
+}
+  801eae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb1:	5b                   	pop    %ebx
+  801eb2:	5e                   	pop    %esi
+  801eb3:	5d                   	pop    %ebp
+  801eb4:	c3                   	ret
+  801eb5:	89 e2                	mov    %esp,%edx
+  801eb7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ebc:	29 d0                	sub    %edx,%eax
+  801ebe:	89 c2                	mov    %eax,%edx
+  801ec0:	c1 ea 0f             	shr    $0xf,%edx
+  801ec3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ecd:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ed0:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801ed7:	8b 40 48             	mov    0x48(%eax),%eax
+  801eda:	83 ec 04             	sub    $0x4,%esp
+  801edd:	53                   	push   %ebx
+  801ede:	50                   	push   %eax
+  801edf:	68 11 4c 80 00       	push   $0x804c11
+  801ee4:	e8 68 e5 ff ff       	call   800451 <cprintf>
+		return -E_INVAL;
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef1:	eb bb                	jmp    801eae <read+0x58>
+		return -E_NOT_SUPP;
+  801ef3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef8:	eb b4                	jmp    801eae <read+0x58>
+
+00801efa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801efa:	55                   	push   %ebp
+  801efb:	89 e5                	mov    %esp,%ebp
+  801efd:	57                   	push   %edi
+  801efe:	56                   	push   %esi
+  801eff:	53                   	push   %ebx
+  801f00:	83 ec 0c             	sub    $0xc,%esp
+  801f03:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f06:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f09:	85 f6                	test   %esi,%esi
+  801f0b:	74 30                	je     801f3d <readn+0x43>
+  801f0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f12:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f17:	83 ec 04             	sub    $0x4,%esp
+  801f1a:	89 f2                	mov    %esi,%edx
+  801f1c:	29 c2                	sub    %eax,%edx
+  801f1e:	52                   	push   %edx
+  801f1f:	01 f8                	add    %edi,%eax
+  801f21:	50                   	push   %eax
+  801f22:	ff 75 08             	push   0x8(%ebp)
+  801f25:	e8 2c ff ff ff       	call   801e56 <read>
+		if (m < 0)
+  801f2a:	83 c4 10             	add    $0x10,%esp
+  801f2d:	85 c0                	test   %eax,%eax
+  801f2f:	78 15                	js     801f46 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801f31:	74 11                	je     801f44 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801f33:	01 c3                	add    %eax,%ebx
+  801f35:	89 d8                	mov    %ebx,%eax
+  801f37:	39 f3                	cmp    %esi,%ebx
+  801f39:	72 dc                	jb     801f17 <readn+0x1d>
+  801f3b:	eb 09                	jmp    801f46 <readn+0x4c>
+  801f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f42:	eb 02                	jmp    801f46 <readn+0x4c>
+  801f44:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801f46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f49:	5b                   	pop    %ebx
+  801f4a:	5e                   	pop    %esi
+  801f4b:	5f                   	pop    %edi
+  801f4c:	5d                   	pop    %ebp
+  801f4d:	c3                   	ret
+
+00801f4e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f4e:	55                   	push   %ebp
+  801f4f:	89 e5                	mov    %esp,%ebp
+  801f51:	56                   	push   %esi
+  801f52:	53                   	push   %ebx
+  801f53:	83 ec 18             	sub    $0x18,%esp
+  801f56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f5c:	50                   	push   %eax
+  801f5d:	53                   	push   %ebx
+  801f5e:	e8 6f fc ff ff       	call   801bd2 <fd_lookup>
+  801f63:	83 c4 10             	add    $0x10,%esp
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	78 37                	js     801fa1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f6a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f6d:	83 ec 08             	sub    $0x8,%esp
+  801f70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f73:	50                   	push   %eax
+  801f74:	ff 36                	push   (%esi)
+  801f76:	e8 a9 fc ff ff       	call   801c24 <dev_lookup>
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	85 c0                	test   %eax,%eax
+  801f80:	78 1f                	js     801fa1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f82:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f86:	74 20                	je     801fa8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801f88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f8b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	74 54                	je     801fe6 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801f92:	83 ec 04             	sub    $0x4,%esp
+  801f95:	ff 75 10             	push   0x10(%ebp)
+  801f98:	ff 75 0c             	push   0xc(%ebp)
+  801f9b:	56                   	push   %esi
+  801f9c:	ff d0                	call   *%eax
+  801f9e:	83 c4 10             	add    $0x10,%esp
+}
+  801fa1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa4:	5b                   	pop    %ebx
+  801fa5:	5e                   	pop    %esi
+  801fa6:	5d                   	pop    %ebp
+  801fa7:	c3                   	ret
+  801fa8:	89 e2                	mov    %esp,%edx
+  801faa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801faf:	29 d0                	sub    %edx,%eax
+  801fb1:	89 c2                	mov    %eax,%edx
+  801fb3:	c1 ea 0f             	shr    $0xf,%edx
+  801fb6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc0:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fc3:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  801fca:	8b 40 48             	mov    0x48(%eax),%eax
+  801fcd:	83 ec 04             	sub    $0x4,%esp
+  801fd0:	53                   	push   %ebx
+  801fd1:	50                   	push   %eax
+  801fd2:	68 2d 4c 80 00       	push   $0x804c2d
+  801fd7:	e8 75 e4 ff ff       	call   800451 <cprintf>
+		return -E_INVAL;
+  801fdc:	83 c4 10             	add    $0x10,%esp
+  801fdf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe4:	eb bb                	jmp    801fa1 <write+0x53>
+		return -E_NOT_SUPP;
+  801fe6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801feb:	eb b4                	jmp    801fa1 <write+0x53>
+
+00801fed <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801fed:	55                   	push   %ebp
+  801fee:	89 e5                	mov    %esp,%ebp
+  801ff0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ff3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff6:	50                   	push   %eax
+  801ff7:	ff 75 08             	push   0x8(%ebp)
+  801ffa:	e8 d3 fb ff ff       	call   801bd2 <fd_lookup>
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	85 c0                	test   %eax,%eax
+  802004:	78 0e                	js     802014 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802006:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802009:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80200c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80200f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802014:	c9                   	leave
+  802015:	c3                   	ret
+
+00802016 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802016:	55                   	push   %ebp
+  802017:	89 e5                	mov    %esp,%ebp
+  802019:	53                   	push   %ebx
+  80201a:	83 ec 1c             	sub    $0x1c,%esp
+  80201d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802020:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802023:	50                   	push   %eax
+  802024:	ff 75 08             	push   0x8(%ebp)
+  802027:	e8 a6 fb ff ff       	call   801bd2 <fd_lookup>
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 33                	js     802066 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802033:	83 fb 03             	cmp    $0x3,%ebx
+  802036:	74 28                	je     802060 <fcntl+0x4a>
+  802038:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80203d:	83 fb 04             	cmp    $0x4,%ebx
+  802040:	75 24                	jne    802066 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802042:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802045:	8b 41 08             	mov    0x8(%ecx),%eax
+  802048:	80 e4 ef             	and    $0xef,%ah
+  80204b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80204e:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802054:	09 d0                	or     %edx,%eax
+  802056:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802059:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205e:	eb 06                	jmp    802066 <fcntl+0x50>
+		return fd->fd_omode;
+  802060:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802063:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802066:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802069:	c9                   	leave
+  80206a:	c3                   	ret
+
+0080206b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80206b:	55                   	push   %ebp
+  80206c:	89 e5                	mov    %esp,%ebp
+  80206e:	56                   	push   %esi
+  80206f:	53                   	push   %ebx
+  802070:	83 ec 18             	sub    $0x18,%esp
+  802073:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802076:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802079:	50                   	push   %eax
+  80207a:	53                   	push   %ebx
+  80207b:	e8 52 fb ff ff       	call   801bd2 <fd_lookup>
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	85 c0                	test   %eax,%eax
+  802085:	78 34                	js     8020bb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802087:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80208a:	83 ec 08             	sub    $0x8,%esp
+  80208d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802090:	50                   	push   %eax
+  802091:	ff 36                	push   (%esi)
+  802093:	e8 8c fb ff ff       	call   801c24 <dev_lookup>
+  802098:	83 c4 10             	add    $0x10,%esp
+  80209b:	85 c0                	test   %eax,%eax
+  80209d:	78 1c                	js     8020bb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80209f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8020a3:	74 1d                	je     8020c2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8020a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a8:	8b 40 18             	mov    0x18(%eax),%eax
+  8020ab:	85 c0                	test   %eax,%eax
+  8020ad:	74 51                	je     802100 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8020af:	83 ec 08             	sub    $0x8,%esp
+  8020b2:	ff 75 0c             	push   0xc(%ebp)
+  8020b5:	56                   	push   %esi
+  8020b6:	ff d0                	call   *%eax
+  8020b8:	83 c4 10             	add    $0x10,%esp
+}
+  8020bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020be:	5b                   	pop    %ebx
+  8020bf:	5e                   	pop    %esi
+  8020c0:	5d                   	pop    %ebp
+  8020c1:	c3                   	ret
+  8020c2:	89 e2                	mov    %esp,%edx
+  8020c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020c9:	29 d0                	sub    %edx,%eax
+  8020cb:	89 c2                	mov    %eax,%edx
+  8020cd:	c1 ea 0f             	shr    $0xf,%edx
+  8020d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020da:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8020dd:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  8020e4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020e7:	83 ec 04             	sub    $0x4,%esp
+  8020ea:	53                   	push   %ebx
+  8020eb:	50                   	push   %eax
+  8020ec:	68 f0 4b 80 00       	push   $0x804bf0
+  8020f1:	e8 5b e3 ff ff       	call   800451 <cprintf>
+		return -E_INVAL;
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020fe:	eb bb                	jmp    8020bb <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802100:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802105:	eb b4                	jmp    8020bb <ftruncate+0x50>
+
+00802107 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	56                   	push   %esi
+  80210b:	53                   	push   %ebx
+  80210c:	83 ec 18             	sub    $0x18,%esp
+  80210f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802112:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802115:	50                   	push   %eax
+  802116:	ff 75 08             	push   0x8(%ebp)
+  802119:	e8 b4 fa ff ff       	call   801bd2 <fd_lookup>
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	85 c0                	test   %eax,%eax
+  802123:	78 53                	js     802178 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802125:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802128:	83 ec 08             	sub    $0x8,%esp
+  80212b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212e:	50                   	push   %eax
+  80212f:	ff 36                	push   (%esi)
+  802131:	e8 ee fa ff ff       	call   801c24 <dev_lookup>
+  802136:	83 c4 10             	add    $0x10,%esp
+  802139:	85 c0                	test   %eax,%eax
+  80213b:	78 3b                	js     802178 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80213d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802140:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802144:	74 39                	je     80217f <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802146:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802149:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802150:	00 00 00 
+	stat->st_isdir = 0;
+  802153:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80215a:	00 00 00 
+	stat->st_version = 0;
+  80215d:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802164:	00 00 00 
+	stat->st_dev = dev;
+  802167:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80216d:	83 ec 08             	sub    $0x8,%esp
+  802170:	53                   	push   %ebx
+  802171:	56                   	push   %esi
+  802172:	ff 50 14             	call   *0x14(%eax)
+  802175:	83 c4 10             	add    $0x10,%esp
+}
+  802178:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217b:	5b                   	pop    %ebx
+  80217c:	5e                   	pop    %esi
+  80217d:	5d                   	pop    %ebp
+  80217e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80217f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802184:	eb f2                	jmp    802178 <fstat+0x71>
+
+00802186 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802186:	55                   	push   %ebp
+  802187:	89 e5                	mov    %esp,%ebp
+  802189:	56                   	push   %esi
+  80218a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80218b:	83 ec 08             	sub    $0x8,%esp
+  80218e:	6a 00                	push   $0x0
+  802190:	ff 75 08             	push   0x8(%ebp)
+  802193:	e8 b7 01 00 00       	call   80234f <open>
+  802198:	89 c3                	mov    %eax,%ebx
+  80219a:	83 c4 10             	add    $0x10,%esp
+  80219d:	85 c0                	test   %eax,%eax
+  80219f:	78 1b                	js     8021bc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8021a1:	83 ec 08             	sub    $0x8,%esp
+  8021a4:	ff 75 0c             	push   0xc(%ebp)
+  8021a7:	50                   	push   %eax
+  8021a8:	e8 5a ff ff ff       	call   802107 <fstat>
+  8021ad:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8021af:	89 1c 24             	mov    %ebx,(%esp)
+  8021b2:	e8 60 fb ff ff       	call   801d17 <close>
+	return r;
+  8021b7:	83 c4 10             	add    $0x10,%esp
+  8021ba:	89 f3                	mov    %esi,%ebx
+}
+  8021bc:	89 d8                	mov    %ebx,%eax
+  8021be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c1:	5b                   	pop    %ebx
+  8021c2:	5e                   	pop    %esi
+  8021c3:	5d                   	pop    %ebp
+  8021c4:	c3                   	ret
+
+008021c5 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8021c5:	55                   	push   %ebp
+  8021c6:	89 e5                	mov    %esp,%ebp
+  8021c8:	56                   	push   %esi
+  8021c9:	53                   	push   %ebx
+  8021ca:	89 c6                	mov    %eax,%esi
+  8021cc:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8021ce:	83 3d e4 66 80 00 00 	cmpl   $0x0,0x8066e4
+  8021d5:	74 27                	je     8021fe <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8021d7:	6a 07                	push   $0x7
+  8021d9:	68 00 70 80 00       	push   $0x807000
+  8021de:	56                   	push   %esi
+  8021df:	ff 35 e4 66 80 00    	push   0x8066e4
+  8021e5:	e8 c0 21 00 00       	call   8043aa <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8021ea:	83 c4 0c             	add    $0xc,%esp
+  8021ed:	6a 00                	push   $0x0
+  8021ef:	53                   	push   %ebx
+  8021f0:	6a 00                	push   $0x0
+  8021f2:	e8 23 1f 00 00       	call   80411a <ipc_recv>
+}
+  8021f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021fa:	5b                   	pop    %ebx
+  8021fb:	5e                   	pop    %esi
+  8021fc:	5d                   	pop    %ebp
+  8021fd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021fe:	83 ec 0c             	sub    $0xc,%esp
+  802201:	6a 02                	push   $0x2
+  802203:	e8 0b 22 00 00       	call   804413 <ipc_find_env>
+  802208:	a3 e4 66 80 00       	mov    %eax,0x8066e4
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	eb c5                	jmp    8021d7 <fsipc+0x12>
+
+00802212 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802218:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80221e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802223:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802226:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80222b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802230:	b8 02 00 00 00       	mov    $0x2,%eax
+  802235:	e8 8b ff ff ff       	call   8021c5 <fsipc>
+}
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+0080223c <devfile_flush>:
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802242:	8b 45 08             	mov    0x8(%ebp),%eax
+  802245:	8b 40 0c             	mov    0xc(%eax),%eax
+  802248:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80224d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802252:	b8 06 00 00 00       	mov    $0x6,%eax
+  802257:	e8 69 ff ff ff       	call   8021c5 <fsipc>
+}
+  80225c:	c9                   	leave
+  80225d:	c3                   	ret
+
+0080225e <devfile_stat>:
+{
+  80225e:	55                   	push   %ebp
+  80225f:	89 e5                	mov    %esp,%ebp
+  802261:	53                   	push   %ebx
+  802262:	83 ec 04             	sub    $0x4,%esp
+  802265:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802268:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80226e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802273:	ba 00 00 00 00       	mov    $0x0,%edx
+  802278:	b8 05 00 00 00       	mov    $0x5,%eax
+  80227d:	e8 43 ff ff ff       	call   8021c5 <fsipc>
+  802282:	85 c0                	test   %eax,%eax
+  802284:	78 37                	js     8022bd <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802286:	83 ec 08             	sub    $0x8,%esp
+  802289:	68 00 70 80 00       	push   $0x807000
+  80228e:	53                   	push   %ebx
+  80228f:	e8 b4 e8 ff ff       	call   800b48 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802294:	a1 80 70 80 00       	mov    0x807080,%eax
+  802299:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80229f:	a1 84 70 80 00       	mov    0x807084,%eax
+  8022a4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8022aa:	a1 88 70 80 00       	mov    0x807088,%eax
+  8022af:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c0:	c9                   	leave
+  8022c1:	c3                   	ret
+
+008022c2 <devfile_write>:
+{
+  8022c2:	55                   	push   %ebp
+  8022c3:	89 e5                	mov    %esp,%ebp
+  8022c5:	83 ec 0c             	sub    $0xc,%esp
+  8022c8:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8022cb:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8022d0:	39 d0                	cmp    %edx,%eax
+  8022d2:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022d8:	8b 52 0c             	mov    0xc(%edx),%edx
+  8022db:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8022e1:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8022e6:	50                   	push   %eax
+  8022e7:	ff 75 0c             	push   0xc(%ebp)
+  8022ea:	68 08 70 80 00       	push   $0x807008
+  8022ef:	e8 04 ea ff ff       	call   800cf8 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8022f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022fe:	e8 c2 fe ff ff       	call   8021c5 <fsipc>
+}
+  802303:	c9                   	leave
+  802304:	c3                   	ret
+
+00802305 <devfile_read>:
+{
+  802305:	55                   	push   %ebp
+  802306:	89 e5                	mov    %esp,%ebp
+  802308:	53                   	push   %ebx
+  802309:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80230c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802312:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802317:	8b 45 10             	mov    0x10(%ebp),%eax
+  80231a:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80231f:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802324:	b8 03 00 00 00       	mov    $0x3,%eax
+  802329:	e8 97 fe ff ff       	call   8021c5 <fsipc>
+  80232e:	89 c3                	mov    %eax,%ebx
+  802330:	85 c0                	test   %eax,%eax
+  802332:	78 14                	js     802348 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802334:	83 ec 04             	sub    $0x4,%esp
+  802337:	50                   	push   %eax
+  802338:	68 00 70 80 00       	push   $0x807000
+  80233d:	ff 75 0c             	push   0xc(%ebp)
+  802340:	e8 b3 e9 ff ff       	call   800cf8 <memmove>
+	return r;
+  802345:	83 c4 10             	add    $0x10,%esp
+}
+  802348:	89 d8                	mov    %ebx,%eax
+  80234a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80234d:	c9                   	leave
+  80234e:	c3                   	ret
+
+0080234f <open>:
+{
+  80234f:	55                   	push   %ebp
+  802350:	89 e5                	mov    %esp,%ebp
+  802352:	53                   	push   %ebx
+  802353:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802356:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802359:	50                   	push   %eax
+  80235a:	e8 23 f8 ff ff       	call   801b82 <fd_alloc>
+  80235f:	89 c3                	mov    %eax,%ebx
+  802361:	83 c4 10             	add    $0x10,%esp
+  802364:	85 c0                	test   %eax,%eax
+  802366:	78 2a                	js     802392 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802368:	83 ec 0c             	sub    $0xc,%esp
+  80236b:	ff 75 08             	push   0x8(%ebp)
+  80236e:	e8 89 e7 ff ff       	call   800afc <strlen>
+  802373:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802376:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80237b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802380:	7e 17                	jle    802399 <open+0x4a>
+	fd_close(fd, 1);
+  802382:	83 ec 08             	sub    $0x8,%esp
+  802385:	6a 01                	push   $0x1
+  802387:	ff 75 f4             	push   -0xc(%ebp)
+  80238a:	e8 08 f9 ff ff       	call   801c97 <fd_close>
+	return r;
+  80238f:	83 c4 10             	add    $0x10,%esp
+}
+  802392:	89 d8                	mov    %ebx,%eax
+  802394:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802397:	c9                   	leave
+  802398:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802399:	83 ec 08             	sub    $0x8,%esp
+  80239c:	ff 75 08             	push   0x8(%ebp)
+  80239f:	68 00 70 80 00       	push   $0x807000
+  8023a4:	e8 9f e7 ff ff       	call   800b48 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8023a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023ac:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8023b1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023b9:	e8 07 fe ff ff       	call   8021c5 <fsipc>
+  8023be:	89 c3                	mov    %eax,%ebx
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	85 c0                	test   %eax,%eax
+  8023c5:	78 bb                	js     802382 <open+0x33>
+	return fd2num(fd); 	
+  8023c7:	83 ec 0c             	sub    $0xc,%esp
+  8023ca:	ff 75 f4             	push   -0xc(%ebp)
+  8023cd:	e8 89 f7 ff ff       	call   801b5b <fd2num>
+  8023d2:	89 c3                	mov    %eax,%ebx
+  8023d4:	83 c4 10             	add    $0x10,%esp
+  8023d7:	eb b9                	jmp    802392 <open+0x43>
+
+008023d9 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8023d9:	55                   	push   %ebp
+  8023da:	89 e5                	mov    %esp,%ebp
+  8023dc:	53                   	push   %ebx
+  8023dd:	83 ec 1c             	sub    $0x1c,%esp
+  8023e0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023e6:	50                   	push   %eax
+  8023e7:	ff 75 08             	push   0x8(%ebp)
+  8023ea:	e8 e3 f7 ff ff       	call   801bd2 <fd_lookup>
+  8023ef:	83 c4 10             	add    $0x10,%esp
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	78 5a                	js     802450 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8023f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f9:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8023ff:	39 10                	cmp    %edx,(%eax)
+  802401:	75 66                	jne    802469 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802403:	83 3d e4 66 80 00 00 	cmpl   $0x0,0x8066e4
+  80240a:	74 49                	je     802455 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80240c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80240f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802412:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802417:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80241a:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  80241f:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802425:	6a 07                	push   $0x7
+  802427:	68 00 70 80 00       	push   $0x807000
+  80242c:	6a 09                	push   $0x9
+  80242e:	ff 35 e4 66 80 00    	push   0x8066e4
+  802434:	e8 71 1f 00 00       	call   8043aa <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802439:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802440:	6a 00                	push   $0x0
+  802442:	53                   	push   %ebx
+  802443:	ff 75 10             	push   0x10(%ebp)
+  802446:	6a 00                	push   $0x0
+  802448:	e8 9a 1d 00 00       	call   8041e7 <ipc_recv_pages>
+  80244d:	83 c4 20             	add    $0x20,%esp
+}
+  802450:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802455:	83 ec 0c             	sub    $0xc,%esp
+  802458:	6a 02                	push   $0x2
+  80245a:	e8 b4 1f 00 00       	call   804413 <ipc_find_env>
+  80245f:	a3 e4 66 80 00       	mov    %eax,0x8066e4
+  802464:	83 c4 10             	add    $0x10,%esp
+  802467:	eb a3                	jmp    80240c <fmap+0x33>
+		return -E_INVAL;
+  802469:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80246e:	eb e0                	jmp    802450 <fmap+0x77>
+
+00802470 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802470:	55                   	push   %ebp
+  802471:	89 e5                	mov    %esp,%ebp
+  802473:	53                   	push   %ebx
+  802474:	83 ec 10             	sub    $0x10,%esp
+  802477:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80247a:	53                   	push   %ebx
+  80247b:	e8 7c e6 ff ff       	call   800afc <strlen>
+  802480:	83 c4 10             	add    $0x10,%esp
+  802483:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802488:	7f 25                	jg     8024af <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80248a:	83 ec 08             	sub    $0x8,%esp
+  80248d:	53                   	push   %ebx
+  80248e:	68 00 70 80 00       	push   $0x807000
+  802493:	e8 b0 e6 ff ff       	call   800b48 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802498:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249d:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024a2:	e8 1e fd ff ff       	call   8021c5 <fsipc>
+  8024a7:	83 c4 10             	add    $0x10,%esp
+}
+  8024aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+		return -E_BAD_PATH;
+  8024af:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024b4:	eb f4                	jmp    8024aa <remove+0x3a>
+
+008024b6 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024b6:	55                   	push   %ebp
+  8024b7:	89 e5                	mov    %esp,%ebp
+  8024b9:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8024bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024c6:	e8 fa fc ff ff       	call   8021c5 <fsipc>
+}
+  8024cb:	c9                   	leave
+  8024cc:	c3                   	ret
+
+008024cd <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8024d3:	68 60 4c 80 00       	push   $0x804c60
+  8024d8:	ff 75 0c             	push   0xc(%ebp)
+  8024db:	e8 68 e6 ff ff       	call   800b48 <strcpy>
+	return 0;
+}
+  8024e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+
+008024e7 <devsock_close>:
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	53                   	push   %ebx
+  8024eb:	83 ec 10             	sub    $0x10,%esp
+  8024ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8024f1:	53                   	push   %ebx
+  8024f2:	e8 5b 1f 00 00       	call   804452 <pageref>
+  8024f7:	89 c2                	mov    %eax,%edx
+  8024f9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8024fc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802501:	83 fa 01             	cmp    $0x1,%edx
+  802504:	74 05                	je     80250b <devsock_close+0x24>
+}
+  802506:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80250b:	83 ec 0c             	sub    $0xc,%esp
+  80250e:	ff 73 0c             	push   0xc(%ebx)
+  802511:	e8 b0 05 00 00       	call   802ac6 <nsipc_close>
+  802516:	83 c4 10             	add    $0x10,%esp
+  802519:	eb eb                	jmp    802506 <devsock_close+0x1f>
+
+0080251b <devsock_write>:
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	53                   	push   %ebx
+  80251f:	83 ec 14             	sub    $0x14,%esp
+  802522:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802525:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802528:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80252b:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80252e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802531:	8b 41 08             	mov    0x8(%ecx),%eax
+  802534:	c1 f8 09             	sar    $0x9,%eax
+  802537:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80253a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802540:	77 13                	ja     802555 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802542:	50                   	push   %eax
+  802543:	52                   	push   %edx
+  802544:	53                   	push   %ebx
+  802545:	ff 71 0c             	push   0xc(%ecx)
+  802548:	e8 5c 06 00 00       	call   802ba9 <nsipc_send>
+  80254d:	83 c4 10             	add    $0x10,%esp
+}
+  802550:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802553:	c9                   	leave
+  802554:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802555:	50                   	push   %eax
+  802556:	6a 01                	push   $0x1
+  802558:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80255b:	50                   	push   %eax
+  80255c:	ff 71 0c             	push   0xc(%ecx)
+  80255f:	e8 a6 06 00 00       	call   802c0a <nsipc_sendmsg>
+  802564:	83 c4 10             	add    $0x10,%esp
+  802567:	eb e7                	jmp    802550 <devsock_write+0x35>
+
+00802569 <devsock_read>:
+{
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	53                   	push   %ebx
+  80256d:	83 ec 14             	sub    $0x14,%esp
+  802570:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802573:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802576:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802579:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80257c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80257f:	8b 41 08             	mov    0x8(%ecx),%eax
+  802582:	c1 f8 09             	sar    $0x9,%eax
+  802585:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802588:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80258e:	77 13                	ja     8025a3 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802590:	50                   	push   %eax
+  802591:	52                   	push   %edx
+  802592:	53                   	push   %ebx
+  802593:	ff 71 0c             	push   0xc(%ecx)
+  802596:	e8 9c 05 00 00       	call   802b37 <nsipc_recv>
+  80259b:	83 c4 10             	add    $0x10,%esp
+}
+  80259e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a1:	c9                   	leave
+  8025a2:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8025a3:	50                   	push   %eax
+  8025a4:	6a 01                	push   $0x1
+  8025a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025a9:	50                   	push   %eax
+  8025aa:	ff 71 0c             	push   0xc(%ecx)
+  8025ad:	e8 02 0a 00 00       	call   802fb4 <nsipc_recvmsg>
+  8025b2:	83 c4 10             	add    $0x10,%esp
+  8025b5:	eb e7                	jmp    80259e <devsock_read+0x35>
+
+008025b7 <fd2sockid>:
+{
+  8025b7:	55                   	push   %ebp
+  8025b8:	89 e5                	mov    %esp,%ebp
+  8025ba:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8025bd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025c0:	52                   	push   %edx
+  8025c1:	50                   	push   %eax
+  8025c2:	e8 0b f6 ff ff       	call   801bd2 <fd_lookup>
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	85 c0                	test   %eax,%eax
+  8025cc:	78 10                	js     8025de <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8025ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025d1:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8025d7:	39 08                	cmp    %ecx,(%eax)
+  8025d9:	75 05                	jne    8025e0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8025db:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8025de:	c9                   	leave
+  8025df:	c3                   	ret
+		return -E_NOT_SUPP;
+  8025e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025e5:	eb f7                	jmp    8025de <fd2sockid+0x27>
+
+008025e7 <sock_flags>:
+{
+  8025e7:	55                   	push   %ebp
+  8025e8:	89 e5                	mov    %esp,%ebp
+  8025ea:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8025ed:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025f0:	52                   	push   %edx
+  8025f1:	50                   	push   %eax
+  8025f2:	e8 db f5 ff ff       	call   801bd2 <fd_lookup>
+  8025f7:	83 c4 10             	add    $0x10,%esp
+  8025fa:	85 c0                	test   %eax,%eax
+  8025fc:	78 0e                	js     80260c <sock_flags+0x25>
+  8025fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802601:	8b 40 08             	mov    0x8(%eax),%eax
+  802604:	c1 e8 09             	shr    $0x9,%eax
+  802607:	83 e0 08             	and    $0x8,%eax
+}
+  80260a:	c9                   	leave
+  80260b:	c3                   	ret
+		return 0;
+  80260c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802611:	eb f7                	jmp    80260a <sock_flags+0x23>
+
+00802613 <alloc_sockfd>:
+{
+  802613:	55                   	push   %ebp
+  802614:	89 e5                	mov    %esp,%ebp
+  802616:	56                   	push   %esi
+  802617:	53                   	push   %ebx
+  802618:	83 ec 1c             	sub    $0x1c,%esp
+  80261b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80261d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802620:	50                   	push   %eax
+  802621:	e8 5c f5 ff ff       	call   801b82 <fd_alloc>
+  802626:	89 c3                	mov    %eax,%ebx
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	78 43                	js     802672 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80262f:	83 ec 04             	sub    $0x4,%esp
+  802632:	68 07 04 00 00       	push   $0x407
+  802637:	ff 75 f4             	push   -0xc(%ebp)
+  80263a:	6a 00                	push   $0x0
+  80263c:	e8 3b e9 ff ff       	call   800f7c <sys_page_alloc>
+  802641:	89 c3                	mov    %eax,%ebx
+  802643:	83 c4 10             	add    $0x10,%esp
+  802646:	85 c0                	test   %eax,%eax
+  802648:	78 28                	js     802672 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80264a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80264d:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802653:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802655:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802658:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80265f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802662:	83 ec 0c             	sub    $0xc,%esp
+  802665:	50                   	push   %eax
+  802666:	e8 f0 f4 ff ff       	call   801b5b <fd2num>
+  80266b:	89 c3                	mov    %eax,%ebx
+  80266d:	83 c4 10             	add    $0x10,%esp
+  802670:	eb 0c                	jmp    80267e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802672:	83 ec 0c             	sub    $0xc,%esp
+  802675:	56                   	push   %esi
+  802676:	e8 4b 04 00 00       	call   802ac6 <nsipc_close>
+		return r;
+  80267b:	83 c4 10             	add    $0x10,%esp
+}
+  80267e:	89 d8                	mov    %ebx,%eax
+  802680:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5d                   	pop    %ebp
+  802686:	c3                   	ret
+
+00802687 <accept>:
+{
+  802687:	55                   	push   %ebp
+  802688:	89 e5                	mov    %esp,%ebp
+  80268a:	56                   	push   %esi
+  80268b:	53                   	push   %ebx
+  80268c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80268f:	89 f0                	mov    %esi,%eax
+  802691:	e8 21 ff ff ff       	call   8025b7 <fd2sockid>
+  802696:	89 c3                	mov    %eax,%ebx
+  802698:	85 c0                	test   %eax,%eax
+  80269a:	78 24                	js     8026c0 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80269c:	89 f0                	mov    %esi,%eax
+  80269e:	e8 44 ff ff ff       	call   8025e7 <sock_flags>
+  8026a3:	50                   	push   %eax
+  8026a4:	ff 75 10             	push   0x10(%ebp)
+  8026a7:	ff 75 0c             	push   0xc(%ebp)
+  8026aa:	53                   	push   %ebx
+  8026ab:	e8 6b 03 00 00       	call   802a1b <nsipc_accept>
+  8026b0:	89 c3                	mov    %eax,%ebx
+  8026b2:	83 c4 10             	add    $0x10,%esp
+  8026b5:	85 c0                	test   %eax,%eax
+  8026b7:	78 07                	js     8026c0 <accept+0x39>
+	return alloc_sockfd(r);
+  8026b9:	e8 55 ff ff ff       	call   802613 <alloc_sockfd>
+  8026be:	89 c3                	mov    %eax,%ebx
+}
+  8026c0:	89 d8                	mov    %ebx,%eax
+  8026c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c5:	5b                   	pop    %ebx
+  8026c6:	5e                   	pop    %esi
+  8026c7:	5d                   	pop    %ebp
+  8026c8:	c3                   	ret
+
+008026c9 <bind>:
+{
+  8026c9:	55                   	push   %ebp
+  8026ca:	89 e5                	mov    %esp,%ebp
+  8026cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8026cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d2:	e8 e0 fe ff ff       	call   8025b7 <fd2sockid>
+  8026d7:	85 c0                	test   %eax,%eax
+  8026d9:	78 12                	js     8026ed <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8026db:	83 ec 04             	sub    $0x4,%esp
+  8026de:	ff 75 10             	push   0x10(%ebp)
+  8026e1:	ff 75 0c             	push   0xc(%ebp)
+  8026e4:	50                   	push   %eax
+  8026e5:	e8 85 03 00 00       	call   802a6f <nsipc_bind>
+  8026ea:	83 c4 10             	add    $0x10,%esp
+}
+  8026ed:	c9                   	leave
+  8026ee:	c3                   	ret
+
+008026ef <shutdown>:
+{
+  8026ef:	55                   	push   %ebp
+  8026f0:	89 e5                	mov    %esp,%ebp
+  8026f2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8026f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f8:	e8 ba fe ff ff       	call   8025b7 <fd2sockid>
+  8026fd:	85 c0                	test   %eax,%eax
+  8026ff:	78 0f                	js     802710 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802701:	83 ec 08             	sub    $0x8,%esp
+  802704:	ff 75 0c             	push   0xc(%ebp)
+  802707:	50                   	push   %eax
+  802708:	e8 97 03 00 00       	call   802aa4 <nsipc_shutdown>
+  80270d:	83 c4 10             	add    $0x10,%esp
+}
+  802710:	c9                   	leave
+  802711:	c3                   	ret
+
+00802712 <connect>:
+{
+  802712:	55                   	push   %ebp
+  802713:	89 e5                	mov    %esp,%ebp
+  802715:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802718:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271b:	e8 97 fe ff ff       	call   8025b7 <fd2sockid>
+  802720:	85 c0                	test   %eax,%eax
+  802722:	78 12                	js     802736 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802724:	83 ec 04             	sub    $0x4,%esp
+  802727:	ff 75 10             	push   0x10(%ebp)
+  80272a:	ff 75 0c             	push   0xc(%ebp)
+  80272d:	50                   	push   %eax
+  80272e:	e8 ad 03 00 00       	call   802ae0 <nsipc_connect>
+  802733:	83 c4 10             	add    $0x10,%esp
+}
+  802736:	c9                   	leave
+  802737:	c3                   	ret
+
+00802738 <listen>:
+{
+  802738:	55                   	push   %ebp
+  802739:	89 e5                	mov    %esp,%ebp
+  80273b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80273e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802741:	e8 71 fe ff ff       	call   8025b7 <fd2sockid>
+  802746:	85 c0                	test   %eax,%eax
+  802748:	78 0f                	js     802759 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80274a:	83 ec 08             	sub    $0x8,%esp
+  80274d:	ff 75 0c             	push   0xc(%ebp)
+  802750:	50                   	push   %eax
+  802751:	e8 bf 03 00 00       	call   802b15 <nsipc_listen>
+  802756:	83 c4 10             	add    $0x10,%esp
+}
+  802759:	c9                   	leave
+  80275a:	c3                   	ret
+
+0080275b <sendmsg>:
+{
+  80275b:	55                   	push   %ebp
+  80275c:	89 e5                	mov    %esp,%ebp
+  80275e:	57                   	push   %edi
+  80275f:	56                   	push   %esi
+  802760:	53                   	push   %ebx
+  802761:	83 ec 0c             	sub    $0xc,%esp
+  802764:	8b 75 08             	mov    0x8(%ebp),%esi
+  802767:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80276a:	89 f0                	mov    %esi,%eax
+  80276c:	e8 46 fe ff ff       	call   8025b7 <fd2sockid>
+  802771:	89 c3                	mov    %eax,%ebx
+  802773:	85 c0                	test   %eax,%eax
+  802775:	78 1c                	js     802793 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802777:	89 f0                	mov    %esi,%eax
+  802779:	e8 69 fe ff ff       	call   8025e7 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80277e:	0b 45 10             	or     0x10(%ebp),%eax
+  802781:	50                   	push   %eax
+  802782:	ff 77 0c             	push   0xc(%edi)
+  802785:	ff 77 08             	push   0x8(%edi)
+  802788:	53                   	push   %ebx
+  802789:	e8 7c 04 00 00       	call   802c0a <nsipc_sendmsg>
+  80278e:	89 c3                	mov    %eax,%ebx
+  802790:	83 c4 10             	add    $0x10,%esp
+}
+  802793:	89 d8                	mov    %ebx,%eax
+  802795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802798:	5b                   	pop    %ebx
+  802799:	5e                   	pop    %esi
+  80279a:	5f                   	pop    %edi
+  80279b:	5d                   	pop    %ebp
+  80279c:	c3                   	ret
+
+0080279d <recvmsg>:
+{
+  80279d:	55                   	push   %ebp
+  80279e:	89 e5                	mov    %esp,%ebp
+  8027a0:	57                   	push   %edi
+  8027a1:	56                   	push   %esi
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 0c             	sub    $0xc,%esp
+  8027a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8027ac:	89 f8                	mov    %edi,%eax
+  8027ae:	e8 04 fe ff ff       	call   8025b7 <fd2sockid>
+  8027b3:	89 c3                	mov    %eax,%ebx
+  8027b5:	85 c0                	test   %eax,%eax
+  8027b7:	78 2a                	js     8027e3 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8027b9:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8027c0:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8027c7:	89 f8                	mov    %edi,%eax
+  8027c9:	e8 19 fe ff ff       	call   8025e7 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8027ce:	0b 45 10             	or     0x10(%ebp),%eax
+  8027d1:	50                   	push   %eax
+  8027d2:	ff 76 0c             	push   0xc(%esi)
+  8027d5:	ff 76 08             	push   0x8(%esi)
+  8027d8:	53                   	push   %ebx
+  8027d9:	e8 d6 07 00 00       	call   802fb4 <nsipc_recvmsg>
+  8027de:	89 c3                	mov    %eax,%ebx
+  8027e0:	83 c4 10             	add    $0x10,%esp
+}
+  8027e3:	89 d8                	mov    %ebx,%eax
+  8027e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e8:	5b                   	pop    %ebx
+  8027e9:	5e                   	pop    %esi
+  8027ea:	5f                   	pop    %edi
+  8027eb:	5d                   	pop    %ebp
+  8027ec:	c3                   	ret
+
+008027ed <sendfile>:
+{
+  8027ed:	55                   	push   %ebp
+  8027ee:	89 e5                	mov    %esp,%ebp
+  8027f0:	56                   	push   %esi
+  8027f1:	53                   	push   %ebx
+  8027f2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8027f5:	89 f0                	mov    %esi,%eax
+  8027f7:	e8 bb fd ff ff       	call   8025b7 <fd2sockid>
+  8027fc:	89 c3                	mov    %eax,%ebx
+  8027fe:	85 c0                	test   %eax,%eax
+  802800:	78 1f                	js     802821 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802802:	89 f0                	mov    %esi,%eax
+  802804:	e8 de fd ff ff       	call   8025e7 <sock_flags>
+  802809:	83 ec 0c             	sub    $0xc,%esp
+  80280c:	50                   	push   %eax
+  80280d:	ff 75 14             	push   0x14(%ebp)
+  802810:	ff 75 10             	push   0x10(%ebp)
+  802813:	ff 75 0c             	push   0xc(%ebp)
+  802816:	53                   	push   %ebx
+  802817:	e8 64 06 00 00       	call   802e80 <nsipc_sendfile>
+  80281c:	89 c3                	mov    %eax,%ebx
+  80281e:	83 c4 20             	add    $0x20,%esp
+}
+  802821:	89 d8                	mov    %ebx,%eax
+  802823:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802826:	5b                   	pop    %ebx
+  802827:	5e                   	pop    %esi
+  802828:	5d                   	pop    %ebp
+  802829:	c3                   	ret
+
+0080282a <evctl>:
+{
+  80282a:	55                   	push   %ebp
+  80282b:	89 e5                	mov    %esp,%ebp
+  80282d:	53                   	push   %ebx
+  80282e:	83 ec 04             	sub    $0x4,%esp
+  802831:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802834:	89 d8                	mov    %ebx,%eax
+  802836:	e8 7c fd ff ff       	call   8025b7 <fd2sockid>
+  80283b:	85 c0                	test   %eax,%eax
+  80283d:	78 10                	js     80284f <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80283f:	83 ec 04             	sub    $0x4,%esp
+  802842:	53                   	push   %ebx
+  802843:	ff 75 0c             	push   0xc(%ebp)
+  802846:	50                   	push   %eax
+  802847:	e8 d2 0b 00 00       	call   80341e <nsipc_evctl>
+  80284c:	83 c4 10             	add    $0x10,%esp
+}
+  80284f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802852:	c9                   	leave
+  802853:	c3                   	ret
+
+00802854 <evwait>:
+{
+  802854:	55                   	push   %ebp
+  802855:	89 e5                	mov    %esp,%ebp
+  802857:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80285a:	ff 75 10             	push   0x10(%ebp)
+  80285d:	ff 75 0c             	push   0xc(%ebp)
+  802860:	ff 75 08             	push   0x8(%ebp)
+  802863:	e8 e0 0b 00 00       	call   803448 <nsipc_evwait>
+}
+  802868:	c9                   	leave
+  802869:	c3                   	ret
+
+0080286a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80286a:	55                   	push   %ebp
+  80286b:	89 e5                	mov    %esp,%ebp
+  80286d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802870:	ff 75 10             	push   0x10(%ebp)
+  802873:	ff 75 0c             	push   0xc(%ebp)
+  802876:	ff 75 08             	push   0x8(%ebp)
+  802879:	e8 31 0c 00 00       	call   8034af <nsipc_socket>
+  80287e:	83 c4 10             	add    $0x10,%esp
+  802881:	85 c0                	test   %eax,%eax
+  802883:	78 05                	js     80288a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802885:	e8 89 fd ff ff       	call   802613 <alloc_sockfd>
+}
+  80288a:	c9                   	leave
+  80288b:	c3                   	ret
+
+0080288c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80288c:	55                   	push   %ebp
+  80288d:	89 e5                	mov    %esp,%ebp
+  80288f:	53                   	push   %ebx
+  802890:	83 ec 04             	sub    $0x4,%esp
+  802893:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802895:	83 3d 04 6a 80 00 00 	cmpl   $0x0,0x806a04
+  80289c:	74 26                	je     8028c4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80289e:	6a 07                	push   $0x7
+  8028a0:	68 00 80 80 00       	push   $0x808000
+  8028a5:	53                   	push   %ebx
+  8028a6:	ff 35 04 6a 80 00    	push   0x806a04
+  8028ac:	e8 f9 1a 00 00       	call   8043aa <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8028b1:	83 c4 0c             	add    $0xc,%esp
+  8028b4:	6a 00                	push   $0x0
+  8028b6:	6a 00                	push   $0x0
+  8028b8:	6a 00                	push   $0x0
+  8028ba:	e8 5b 18 00 00       	call   80411a <ipc_recv>
+}
+  8028bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028c2:	c9                   	leave
+  8028c3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028c4:	83 ec 0c             	sub    $0xc,%esp
+  8028c7:	6a 03                	push   $0x3
+  8028c9:	e8 45 1b 00 00       	call   804413 <ipc_find_env>
+  8028ce:	a3 04 6a 80 00       	mov    %eax,0x806a04
+  8028d3:	83 c4 10             	add    $0x10,%esp
+  8028d6:	eb c6                	jmp    80289e <nsipc+0x12>
+
+008028d8 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8028d8:	55                   	push   %ebp
+  8028d9:	89 e5                	mov    %esp,%ebp
+  8028db:	56                   	push   %esi
+  8028dc:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8028dd:	8b 35 10 6a 80 00    	mov    0x806a10,%esi
+		return 0;
+  8028e3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8028e8:	85 f6                	test   %esi,%esi
+  8028ea:	75 33                	jne    80291f <nsbulk_map+0x47>
+  8028ec:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8028f1:	83 ec 04             	sub    $0x4,%esp
+  8028f4:	6a 07                	push   $0x7
+  8028f6:	53                   	push   %ebx
+  8028f7:	6a 00                	push   $0x0
+  8028f9:	e8 7e e6 ff ff       	call   800f7c <sys_page_alloc>
+  8028fe:	83 c4 10             	add    $0x10,%esp
+  802901:	85 c0                	test   %eax,%eax
+  802903:	78 1a                	js     80291f <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802905:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80290b:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802911:	75 de                	jne    8028f1 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802913:	c7 05 10 6a 80 00 01 	movl   $0x1,0x806a10
+  80291a:	00 00 00 
+	return 0;
+  80291d:	89 f0                	mov    %esi,%eax
+}
+  80291f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802922:	5b                   	pop    %ebx
+  802923:	5e                   	pop    %esi
+  802924:	5d                   	pop    %ebp
+  802925:	c3                   	ret
+
+00802926 <nsbulk_own>:
+{
+  802926:	55                   	push   %ebp
+  802927:	89 e5                	mov    %esp,%ebp
+  802929:	57                   	push   %edi
+  80292a:	56                   	push   %esi
+  80292b:	53                   	push   %ebx
+  80292c:	83 ec 0c             	sub    $0xc,%esp
+  80292f:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802931:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802934:	85 d2                	test   %edx,%edx
+  802936:	7f 0e                	jg     802946 <nsbulk_own+0x20>
+	return 0;
+  802938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293d:	eb 47                	jmp    802986 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80293f:	83 c3 01             	add    $0x1,%ebx
+  802942:	39 fb                	cmp    %edi,%ebx
+  802944:	7d 3b                	jge    802981 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802946:	be 01 00 00 00       	mov    $0x1,%esi
+  80294b:	89 d9                	mov    %ebx,%ecx
+  80294d:	d3 e6                	shl    %cl,%esi
+  80294f:	89 f0                	mov    %esi,%eax
+  802951:	23 05 0c 6a 80 00    	and    0x806a0c,%eax
+  802957:	74 e6                	je     80293f <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802959:	83 ec 04             	sub    $0x4,%esp
+  80295c:	6a 07                	push   $0x7
+  80295e:	89 d8                	mov    %ebx,%eax
+  802960:	c1 e0 0c             	shl    $0xc,%eax
+  802963:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802968:	50                   	push   %eax
+  802969:	6a 00                	push   $0x0
+  80296b:	e8 0c e6 ff ff       	call   800f7c <sys_page_alloc>
+  802970:	83 c4 10             	add    $0x10,%esp
+  802973:	85 c0                	test   %eax,%eax
+  802975:	78 0f                	js     802986 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802977:	f7 d6                	not    %esi
+  802979:	21 35 0c 6a 80 00    	and    %esi,0x806a0c
+  80297f:	eb be                	jmp    80293f <nsbulk_own+0x19>
+	return 0;
+  802981:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802989:	5b                   	pop    %ebx
+  80298a:	5e                   	pop    %esi
+  80298b:	5f                   	pop    %edi
+  80298c:	5d                   	pop    %ebp
+  80298d:	c3                   	ret
+
+0080298e <nsipc_bulk>:
+{
+  80298e:	55                   	push   %ebp
+  80298f:	89 e5                	mov    %esp,%ebp
+  802991:	57                   	push   %edi
+  802992:	56                   	push   %esi
+  802993:	53                   	push   %ebx
+  802994:	83 ec 1c             	sub    $0x1c,%esp
+  802997:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80299a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80299c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8029a2:	c1 fb 0c             	sar    $0xc,%ebx
+  8029a5:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8029a8:	83 3d 04 6a 80 00 00 	cmpl   $0x0,0x806a04
+  8029af:	74 56                	je     802a07 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8029b1:	85 ff                	test   %edi,%edi
+  8029b3:	7e 24                	jle    8029d9 <nsipc_bulk+0x4b>
+  8029b5:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8029bb:	74 1c                	je     8029d9 <nsipc_bulk+0x4b>
+  8029bd:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8029c3:	c1 e3 0c             	shl    $0xc,%ebx
+  8029c6:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8029cb:	0f b6 10             	movzbl (%eax),%edx
+  8029ce:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8029d0:	05 00 10 00 00       	add    $0x1000,%eax
+  8029d5:	39 d8                	cmp    %ebx,%eax
+  8029d7:	75 f2                	jne    8029cb <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8029d9:	83 ec 0c             	sub    $0xc,%esp
+  8029dc:	56                   	push   %esi
+  8029dd:	57                   	push   %edi
+  8029de:	68 00 00 00 e0       	push   $0xe0000000
+  8029e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8029e6:	ff 35 04 6a 80 00    	push   0x806a04
+  8029ec:	e8 ed 19 00 00       	call   8043de <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8029f1:	83 c4 1c             	add    $0x1c,%esp
+  8029f4:	6a 00                	push   $0x0
+  8029f6:	6a 00                	push   $0x0
+  8029f8:	6a 00                	push   $0x0
+  8029fa:	e8 1b 17 00 00       	call   80411a <ipc_recv>
+}
+  8029ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a02:	5b                   	pop    %ebx
+  802a03:	5e                   	pop    %esi
+  802a04:	5f                   	pop    %edi
+  802a05:	5d                   	pop    %ebp
+  802a06:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a07:	83 ec 0c             	sub    $0xc,%esp
+  802a0a:	6a 03                	push   $0x3
+  802a0c:	e8 02 1a 00 00       	call   804413 <ipc_find_env>
+  802a11:	a3 04 6a 80 00       	mov    %eax,0x806a04
+  802a16:	83 c4 10             	add    $0x10,%esp
+  802a19:	eb 96                	jmp    8029b1 <nsipc_bulk+0x23>
+
+00802a1b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802a1b:	55                   	push   %ebp
+  802a1c:	89 e5                	mov    %esp,%ebp
+  802a1e:	53                   	push   %ebx
+  802a1f:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a25:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802a2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a2d:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a32:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a37:	e8 50 fe ff ff       	call   80288c <nsipc>
+  802a3c:	89 c3                	mov    %eax,%ebx
+  802a3e:	85 c0                	test   %eax,%eax
+  802a40:	79 07                	jns    802a49 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a42:	89 d8                	mov    %ebx,%eax
+  802a44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a47:	c9                   	leave
+  802a48:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a49:	83 ec 04             	sub    $0x4,%esp
+  802a4c:	ff 35 10 80 80 00    	push   0x808010
+  802a52:	68 00 80 80 00       	push   $0x808000
+  802a57:	ff 75 0c             	push   0xc(%ebp)
+  802a5a:	e8 99 e2 ff ff       	call   800cf8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a5f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a65:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a68:	89 10                	mov    %edx,(%eax)
+  802a6a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a6d:	eb d3                	jmp    802a42 <nsipc_accept+0x27>
+
+00802a6f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a6f:	55                   	push   %ebp
+  802a70:	89 e5                	mov    %esp,%ebp
+  802a72:	53                   	push   %ebx
+  802a73:	83 ec 08             	sub    $0x8,%esp
+  802a76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a81:	53                   	push   %ebx
+  802a82:	ff 75 0c             	push   0xc(%ebp)
+  802a85:	68 04 80 80 00       	push   $0x808004
+  802a8a:	e8 69 e2 ff ff       	call   800cf8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a8f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a95:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a9a:	e8 ed fd ff ff       	call   80288c <nsipc>
+}
+  802a9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa2:	c9                   	leave
+  802aa3:	c3                   	ret
+
+00802aa4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aad:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802ab2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ab5:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802aba:	b8 03 00 00 00       	mov    $0x3,%eax
+  802abf:	e8 c8 fd ff ff       	call   80288c <nsipc>
+}
+  802ac4:	c9                   	leave
+  802ac5:	c3                   	ret
+
+00802ac6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ac6:	55                   	push   %ebp
+  802ac7:	89 e5                	mov    %esp,%ebp
+  802ac9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acf:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802ad4:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ad9:	e8 ae fd ff ff       	call   80288c <nsipc>
+}
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+00802ae0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	53                   	push   %ebx
+  802ae4:	83 ec 08             	sub    $0x8,%esp
+  802ae7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aed:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802af2:	53                   	push   %ebx
+  802af3:	ff 75 0c             	push   0xc(%ebp)
+  802af6:	68 04 80 80 00       	push   $0x808004
+  802afb:	e8 f8 e1 ff ff       	call   800cf8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b00:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802b06:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b0b:	e8 7c fd ff ff       	call   80288c <nsipc>
+}
+  802b10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b13:	c9                   	leave
+  802b14:	c3                   	ret
+
+00802b15 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b15:	55                   	push   %ebp
+  802b16:	89 e5                	mov    %esp,%ebp
+  802b18:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b26:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802b2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b30:	e8 57 fd ff ff       	call   80288c <nsipc>
+}
+  802b35:	c9                   	leave
+  802b36:	c3                   	ret
+
+00802b37 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b37:	55                   	push   %ebp
+  802b38:	89 e5                	mov    %esp,%ebp
+  802b3a:	56                   	push   %esi
+  802b3b:	53                   	push   %ebx
+  802b3c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b42:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802b47:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802b4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b50:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b55:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b5a:	e8 2d fd ff ff       	call   80288c <nsipc>
+  802b5f:	89 c3                	mov    %eax,%ebx
+  802b61:	85 c0                	test   %eax,%eax
+  802b63:	78 22                	js     802b87 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b65:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b6a:	39 c6                	cmp    %eax,%esi
+  802b6c:	0f 4e c6             	cmovle %esi,%eax
+  802b6f:	39 c3                	cmp    %eax,%ebx
+  802b71:	7f 1d                	jg     802b90 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b73:	83 ec 04             	sub    $0x4,%esp
+  802b76:	53                   	push   %ebx
+  802b77:	68 00 80 80 00       	push   $0x808000
+  802b7c:	ff 75 0c             	push   0xc(%ebp)
+  802b7f:	e8 74 e1 ff ff       	call   800cf8 <memmove>
+  802b84:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b87:	89 d8                	mov    %ebx,%eax
+  802b89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b8c:	5b                   	pop    %ebx
+  802b8d:	5e                   	pop    %esi
+  802b8e:	5d                   	pop    %ebp
+  802b8f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b90:	68 6c 4c 80 00       	push   $0x804c6c
+  802b95:	68 81 4c 80 00       	push   $0x804c81
+  802b9a:	68 b2 00 00 00       	push   $0xb2
+  802b9f:	68 96 4c 80 00       	push   $0x804c96
+  802ba4:	e8 cd d7 ff ff       	call   800376 <_panic>
+
+00802ba9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ba9:	55                   	push   %ebp
+  802baa:	89 e5                	mov    %esp,%ebp
+  802bac:	53                   	push   %ebx
+  802bad:	83 ec 04             	sub    $0x4,%esp
+  802bb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb6:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802bbb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bc1:	7f 2e                	jg     802bf1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802bc3:	83 ec 04             	sub    $0x4,%esp
+  802bc6:	53                   	push   %ebx
+  802bc7:	ff 75 0c             	push   0xc(%ebp)
+  802bca:	68 0c 80 80 00       	push   $0x80800c
+  802bcf:	e8 24 e1 ff ff       	call   800cf8 <memmove>
+	nsipcbuf.send.req_size = size;
+  802bd4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802bda:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bdd:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802be2:	b8 08 00 00 00       	mov    $0x8,%eax
+  802be7:	e8 a0 fc ff ff       	call   80288c <nsipc>
+}
+  802bec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bef:	c9                   	leave
+  802bf0:	c3                   	ret
+	assert(size < 1600);
+  802bf1:	68 a2 4c 80 00       	push   $0x804ca2
+  802bf6:	68 81 4c 80 00       	push   $0x804c81
+  802bfb:	68 bd 00 00 00       	push   $0xbd
+  802c00:	68 96 4c 80 00       	push   $0x804c96
+  802c05:	e8 6c d7 ff ff       	call   800376 <_panic>
+
+00802c0a <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802c0a:	55                   	push   %ebp
+  802c0b:	89 e5                	mov    %esp,%ebp
+  802c0d:	57                   	push   %edi
+  802c0e:	56                   	push   %esi
+  802c0f:	53                   	push   %ebx
+  802c10:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802c13:	e8 c0 fc ff ff       	call   8028d8 <nsbulk_map>
+  802c18:	85 c0                	test   %eax,%eax
+  802c1a:	78 55                	js     802c71 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802c1c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802c23:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802c2a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c31:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c34:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c37:	0f 8d 24 02 00 00    	jge    802e61 <nsipc_sendmsg+0x257>
+  802c3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c40:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c43:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802c46:	89 d8                	mov    %ebx,%eax
+  802c48:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c4d:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802c4f:	83 ec 0c             	sub    $0xc,%esp
+  802c52:	68 00 67 80 00       	push   $0x806700
+  802c57:	e8 5a 0f 00 00       	call   803bb6 <pgbatch_init>
+  802c5c:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c5f:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802c61:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802c64:	e9 82 00 00 00       	jmp    802ceb <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802c69:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802c6c:	85 db                	test   %ebx,%ebx
+  802c6e:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802c71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c74:	5b                   	pop    %ebx
+  802c75:	5e                   	pop    %esi
+  802c76:	5f                   	pop    %edi
+  802c77:	5d                   	pop    %ebp
+  802c78:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802c79:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802c7e:	29 c8                	sub    %ecx,%eax
+  802c80:	39 d0                	cmp    %edx,%eax
+  802c82:	0f 46 d0             	cmovbe %eax,%edx
+  802c85:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802c87:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802c8d:	85 ff                	test   %edi,%edi
+  802c8f:	0f 49 c7             	cmovns %edi,%eax
+  802c92:	c1 f8 0c             	sar    $0xc,%eax
+  802c95:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c9a:	e8 87 fc ff ff       	call   802926 <nsbulk_own>
+  802c9f:	85 c0                	test   %eax,%eax
+  802ca1:	0f 88 17 01 00 00    	js     802dbe <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802ca7:	83 ec 04             	sub    $0x4,%esp
+  802caa:	56                   	push   %esi
+  802cab:	ff 75 e0             	push   -0x20(%ebp)
+  802cae:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802cb1:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802cb6:	50                   	push   %eax
+  802cb7:	e8 3c e0 ff ff       	call   800cf8 <memmove>
+  802cbc:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802cbf:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802cc2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cc5:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802cc8:	0f 84 fd 00 00 00    	je     802dcb <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802cce:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802cd1:	01 f7                	add    %esi,%edi
+  802cd3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802cd6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802cd9:	0f 8d 01 01 00 00    	jge    802de0 <nsipc_sendmsg+0x1d6>
+  802cdf:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802ce5:	0f 8f f0 00 00 00    	jg     802ddb <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802ceb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cee:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802cf1:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802cf4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cf7:	89 c2                	mov    %eax,%edx
+  802cf9:	03 13                	add    (%ebx),%edx
+  802cfb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802cfe:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d01:	29 c6                	sub    %eax,%esi
+  802d03:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802d08:	29 f9                	sub    %edi,%ecx
+  802d0a:	39 ce                	cmp    %ecx,%esi
+  802d0c:	89 ca                	mov    %ecx,%edx
+  802d0e:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802d11:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802d14:	89 f9                	mov    %edi,%ecx
+  802d16:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802d1c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d1f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d24:	09 c8                	or     %ecx,%eax
+  802d26:	0f 85 4d ff ff ff    	jne    802c79 <nsipc_sendmsg+0x6f>
+  802d2c:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802d32:	0f 86 41 ff ff ff    	jbe    802c79 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d38:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d3e:	85 ff                	test   %edi,%edi
+  802d40:	0f 49 c7             	cmovns %edi,%eax
+  802d43:	c1 f8 0c             	sar    $0xc,%eax
+  802d46:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802d48:	89 d1                	mov    %edx,%ecx
+  802d4a:	c1 e9 0c             	shr    $0xc,%ecx
+  802d4d:	01 c8                	add    %ecx,%eax
+  802d4f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d52:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802d55:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802d57:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d5a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802d5f:	29 c8                	sub    %ecx,%eax
+  802d61:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802d64:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802d67:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d69:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d6e:	89 f9                	mov    %edi,%ecx
+  802d70:	d3 e0                	shl    %cl,%eax
+  802d72:	09 05 0c 6a 80 00    	or     %eax,0x806a0c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802d78:	83 ec 08             	sub    $0x8,%esp
+  802d7b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802d7d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802d80:	50                   	push   %eax
+  802d81:	6a 00                	push   $0x0
+  802d83:	56                   	push   %esi
+  802d84:	6a 00                	push   $0x0
+  802d86:	68 00 67 80 00       	push   $0x806700
+  802d8b:	e8 e4 0e 00 00       	call   803c74 <pgbatch_map>
+  802d90:	83 c4 20             	add    $0x20,%esp
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	0f 88 ce fe ff ff    	js     802c69 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802d9b:	83 c7 01             	add    $0x1,%edi
+  802d9e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802da4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802da7:	39 c7                	cmp    %eax,%edi
+  802da9:	75 be                	jne    802d69 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802dab:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802dae:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802db1:	89 d6                	mov    %edx,%esi
+  802db3:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802db9:	e9 01 ff ff ff       	jmp    802cbf <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802dbe:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802dc1:	85 db                	test   %ebx,%ebx
+  802dc3:	0f 45 c3             	cmovne %ebx,%eax
+  802dc6:	e9 a6 fe ff ff       	jmp    802c71 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802dcb:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802dcf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802dd6:	e9 f3 fe ff ff       	jmp    802cce <nsipc_sendmsg+0xc4>
+  802ddb:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802dde:	eb 03                	jmp    802de3 <nsipc_sendmsg+0x1d9>
+  802de0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802de3:	83 ec 0c             	sub    $0xc,%esp
+  802de6:	68 00 67 80 00       	push   $0x806700
+  802deb:	e8 d4 0d 00 00       	call   803bc4 <pgbatch_flush>
+  802df0:	83 c4 10             	add    $0x10,%esp
+  802df3:	85 c0                	test   %eax,%eax
+  802df5:	78 50                	js     802e47 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802df7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dfa:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802dff:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802e05:	89 fb                	mov    %edi,%ebx
+  802e07:	29 f3                	sub    %esi,%ebx
+  802e09:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802e0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e12:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802e17:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802e1c:	89 fa                	mov    %edi,%edx
+  802e1e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802e23:	e8 66 fb ff ff       	call   80298e <nsipc_bulk>
+  802e28:	85 c0                	test   %eax,%eax
+  802e2a:	78 28                	js     802e54 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802e2c:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802e2f:	39 c3                	cmp    %eax,%ebx
+  802e31:	75 0c                	jne    802e3f <nsipc_sendmsg+0x235>
+  802e33:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e36:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802e39:	0f 8f f2 fd ff ff    	jg     802c31 <nsipc_sendmsg+0x27>
+		sent += r;
+  802e3f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802e42:	e9 2a fe ff ff       	jmp    802c71 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802e47:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e4a:	85 db                	test   %ebx,%ebx
+  802e4c:	0f 45 c3             	cmovne %ebx,%eax
+  802e4f:	e9 1d fe ff ff       	jmp    802c71 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802e54:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e57:	85 db                	test   %ebx,%ebx
+  802e59:	0f 45 c3             	cmovne %ebx,%eax
+  802e5c:	e9 10 fe ff ff       	jmp    802c71 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802e61:	83 ec 0c             	sub    $0xc,%esp
+  802e64:	68 00 67 80 00       	push   $0x806700
+  802e69:	e8 48 0d 00 00       	call   803bb6 <pgbatch_init>
+  802e6e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e71:	be 00 00 00 00       	mov    $0x0,%esi
+  802e76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7b:	e9 63 ff ff ff       	jmp    802de3 <nsipc_sendmsg+0x1d9>
+
+00802e80 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802e80:	55                   	push   %ebp
+  802e81:	89 e5                	mov    %esp,%ebp
+  802e83:	57                   	push   %edi
+  802e84:	56                   	push   %esi
+  802e85:	53                   	push   %ebx
+  802e86:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802e89:	83 3d 08 6a 80 00 00 	cmpl   $0x0,0x806a08
+  802e90:	0f 84 c8 00 00 00    	je     802f5e <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802e96:	83 3d 04 6a 80 00 00 	cmpl   $0x0,0x806a04
+  802e9d:	0f 84 e4 00 00 00    	je     802f87 <nsipc_sendfile+0x107>
+{
+  802ea3:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802ea8:	89 fb                	mov    %edi,%ebx
+  802eaa:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802ead:	0f 83 f0 00 00 00    	jae    802fa3 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802eb3:	89 fa                	mov    %edi,%edx
+  802eb5:	03 55 10             	add    0x10(%ebp),%edx
+  802eb8:	89 d0                	mov    %edx,%eax
+  802eba:	c1 f8 1f             	sar    $0x1f,%eax
+  802ebd:	c1 e8 14             	shr    $0x14,%eax
+  802ec0:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802ec3:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802ec9:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802ecb:	6a 10                	push   $0x10
+  802ecd:	68 00 20 01 e0       	push   $0xe0012000
+  802ed2:	52                   	push   %edx
+  802ed3:	ff 75 0c             	push   0xc(%ebp)
+  802ed6:	e8 fe f4 ff ff       	call   8023d9 <fmap>
+  802edb:	83 c4 10             	add    $0x10,%esp
+  802ede:	85 c0                	test   %eax,%eax
+  802ee0:	0f 8e b8 00 00 00    	jle    802f9e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802ee6:	39 c6                	cmp    %eax,%esi
+  802ee8:	0f 8d b5 00 00 00    	jge    802fa3 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802eee:	29 f0                	sub    %esi,%eax
+  802ef0:	8b 55 14             	mov    0x14(%ebp),%edx
+  802ef3:	29 da                	sub    %ebx,%edx
+  802ef5:	39 d0                	cmp    %edx,%eax
+  802ef7:	89 d3                	mov    %edx,%ebx
+  802ef9:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802efc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eff:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802f04:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802f0a:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802f10:	8b 45 18             	mov    0x18(%ebp),%eax
+  802f13:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802f18:	83 ec 0c             	sub    $0xc,%esp
+  802f1b:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802f1d:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802f24:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802f27:	83 c0 01             	add    $0x1,%eax
+  802f2a:	50                   	push   %eax
+  802f2b:	68 00 10 01 e0       	push   $0xe0011000
+  802f30:	6a 11                	push   $0x11
+  802f32:	ff 35 04 6a 80 00    	push   0x806a04
+  802f38:	e8 a1 14 00 00       	call   8043de <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802f3d:	83 c4 1c             	add    $0x1c,%esp
+  802f40:	6a 00                	push   $0x0
+  802f42:	6a 00                	push   $0x0
+  802f44:	6a 00                	push   $0x0
+  802f46:	e8 cf 11 00 00       	call   80411a <ipc_recv>
+  802f4b:	83 c4 10             	add    $0x10,%esp
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	78 5b                	js     802fad <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802f52:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802f54:	39 c3                	cmp    %eax,%ebx
+  802f56:	0f 8e 4c ff ff ff    	jle    802ea8 <nsipc_sendfile+0x28>
+  802f5c:	eb 45                	jmp    802fa3 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802f5e:	83 ec 04             	sub    $0x4,%esp
+  802f61:	6a 07                	push   $0x7
+  802f63:	68 00 10 01 e0       	push   $0xe0011000
+  802f68:	6a 00                	push   $0x0
+  802f6a:	e8 0d e0 ff ff       	call   800f7c <sys_page_alloc>
+  802f6f:	89 c7                	mov    %eax,%edi
+  802f71:	83 c4 10             	add    $0x10,%esp
+  802f74:	85 c0                	test   %eax,%eax
+  802f76:	78 2b                	js     802fa3 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802f78:	c7 05 08 6a 80 00 01 	movl   $0x1,0x806a08
+  802f7f:	00 00 00 
+  802f82:	e9 0f ff ff ff       	jmp    802e96 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f87:	83 ec 0c             	sub    $0xc,%esp
+  802f8a:	6a 03                	push   $0x3
+  802f8c:	e8 82 14 00 00       	call   804413 <ipc_find_env>
+  802f91:	a3 04 6a 80 00       	mov    %eax,0x806a04
+  802f96:	83 c4 10             	add    $0x10,%esp
+  802f99:	e9 05 ff ff ff       	jmp    802ea3 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802f9e:	85 ff                	test   %edi,%edi
+  802fa0:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802fa3:	89 f8                	mov    %edi,%eax
+  802fa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fa8:	5b                   	pop    %ebx
+  802fa9:	5e                   	pop    %esi
+  802faa:	5f                   	pop    %edi
+  802fab:	5d                   	pop    %ebp
+  802fac:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802fad:	85 ff                	test   %edi,%edi
+  802faf:	0f 44 f8             	cmove  %eax,%edi
+  802fb2:	eb ef                	jmp    802fa3 <nsipc_sendfile+0x123>
+
+00802fb4 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802fb4:	55                   	push   %ebp
+  802fb5:	89 e5                	mov    %esp,%ebp
+  802fb7:	57                   	push   %edi
+  802fb8:	56                   	push   %esi
+  802fb9:	53                   	push   %ebx
+  802fba:	83 ec 1c             	sub    $0x1c,%esp
+  802fbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802fc0:	e8 13 f9 ff ff       	call   8028d8 <nsbulk_map>
+  802fc5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	0f 88 ba 00 00 00    	js     80308a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802fd0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fd4:	0f 8e bb 00 00 00    	jle    803095 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802fda:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802fe4:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802fe9:	89 f8                	mov    %edi,%eax
+  802feb:	29 f0                	sub    %esi,%eax
+  802fed:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802ff1:	39 c8                	cmp    %ecx,%eax
+  802ff3:	0f 47 c1             	cmova  %ecx,%eax
+  802ff6:	01 f0                	add    %esi,%eax
+  802ff8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802ffa:	83 c2 01             	add    $0x1,%edx
+  802ffd:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803000:	7e 07                	jle    803009 <nsipc_recvmsg+0x55>
+  803002:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803007:	7e e0                	jle    802fe9 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803009:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80300f:	c1 fa 0c             	sar    $0xc,%edx
+  803012:	b8 00 00 00 00       	mov    $0x0,%eax
+  803017:	e8 0a f9 ff ff       	call   802926 <nsbulk_own>
+  80301c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80301f:	85 c0                	test   %eax,%eax
+  803021:	78 67                	js     80308a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803023:	8b 45 08             	mov    0x8(%ebp),%eax
+  803026:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80302b:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803031:	8b 45 14             	mov    0x14(%ebp),%eax
+  803034:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803039:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80303e:	89 f2                	mov    %esi,%edx
+  803040:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803045:	e8 44 f9 ff ff       	call   80298e <nsipc_bulk>
+  80304a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80304d:	85 c0                	test   %eax,%eax
+  80304f:	78 39                	js     80308a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803051:	39 f0                	cmp    %esi,%eax
+  803053:	7f 4a                	jg     80309f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	7e 2c                	jle    80308a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80305e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803061:	29 fe                	sub    %edi,%esi
+  803063:	8b 43 04             	mov    0x4(%ebx),%eax
+  803066:	39 c6                	cmp    %eax,%esi
+  803068:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80306b:	83 ec 04             	sub    $0x4,%esp
+  80306e:	56                   	push   %esi
+  80306f:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803075:	50                   	push   %eax
+  803076:	ff 33                	push   (%ebx)
+  803078:	e8 7b dc ff ff       	call   800cf8 <memmove>
+		n += m;
+  80307d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80307f:	83 c3 08             	add    $0x8,%ebx
+  803082:	83 c4 10             	add    $0x10,%esp
+  803085:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803088:	7f d4                	jg     80305e <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80308a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80308d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803090:	5b                   	pop    %ebx
+  803091:	5e                   	pop    %esi
+  803092:	5f                   	pop    %edi
+  803093:	5d                   	pop    %ebp
+  803094:	c3                   	ret
+	int r, i, n, len = 0;
+  803095:	be 00 00 00 00       	mov    $0x0,%esi
+  80309a:	e9 6a ff ff ff       	jmp    803009 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80309f:	68 78 4c 80 00       	push   $0x804c78
+  8030a4:	68 81 4c 80 00       	push   $0x804c81
+  8030a9:	68 3b 01 00 00       	push   $0x13b
+  8030ae:	68 96 4c 80 00       	push   $0x804c96
+  8030b3:	e8 be d2 ff ff       	call   800376 <_panic>
+
+008030b8 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	57                   	push   %edi
+  8030bc:	56                   	push   %esi
+  8030bd:	53                   	push   %ebx
+  8030be:	83 ec 0c             	sub    $0xc,%esp
+  8030c1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8030c4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8030c7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8030ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030cd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8030d2:	8b 07                	mov    (%edi),%eax
+  8030d4:	a3 04 80 80 00       	mov    %eax,0x808004
+  8030d9:	8b 47 04             	mov    0x4(%edi),%eax
+  8030dc:	a3 08 80 80 00       	mov    %eax,0x808008
+  8030e1:	8b 47 08             	mov    0x8(%edi),%eax
+  8030e4:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8030e9:	8b 47 0c             	mov    0xc(%edi),%eax
+  8030ec:	a3 10 80 80 00       	mov    %eax,0x808010
+  8030f1:	8b 47 10             	mov    0x10(%edi),%eax
+  8030f4:	a3 14 80 80 00       	mov    %eax,0x808014
+  8030f9:	8b 47 14             	mov    0x14(%edi),%eax
+  8030fc:	a3 18 80 80 00       	mov    %eax,0x808018
+  803101:	8b 47 18             	mov    0x18(%edi),%eax
+  803104:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803109:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80310c:	a3 20 80 80 00       	mov    %eax,0x808020
+  803111:	8b 47 20             	mov    0x20(%edi),%eax
+  803114:	a3 24 80 80 00       	mov    %eax,0x808024
+  803119:	8b 47 24             	mov    0x24(%edi),%eax
+  80311c:	a3 28 80 80 00       	mov    %eax,0x808028
+  803121:	8b 47 28             	mov    0x28(%edi),%eax
+  803124:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  803129:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80312c:	a3 30 80 80 00       	mov    %eax,0x808030
+  803131:	8b 47 30             	mov    0x30(%edi),%eax
+  803134:	a3 34 80 80 00       	mov    %eax,0x808034
+  803139:	8b 47 34             	mov    0x34(%edi),%eax
+  80313c:	a3 38 80 80 00       	mov    %eax,0x808038
+  803141:	8b 47 38             	mov    0x38(%edi),%eax
+  803144:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  803149:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80314c:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803151:	8b 06                	mov    (%esi),%eax
+  803153:	a3 44 80 80 00       	mov    %eax,0x808044
+  803158:	8b 46 04             	mov    0x4(%esi),%eax
+  80315b:	a3 48 80 80 00       	mov    %eax,0x808048
+  803160:	8b 46 08             	mov    0x8(%esi),%eax
+  803163:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  803168:	8b 46 0c             	mov    0xc(%esi),%eax
+  80316b:	a3 50 80 80 00       	mov    %eax,0x808050
+  803170:	8b 46 10             	mov    0x10(%esi),%eax
+  803173:	a3 54 80 80 00       	mov    %eax,0x808054
+  803178:	8b 46 14             	mov    0x14(%esi),%eax
+  80317b:	a3 58 80 80 00       	mov    %eax,0x808058
+  803180:	8b 46 18             	mov    0x18(%esi),%eax
+  803183:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803188:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80318b:	a3 60 80 80 00       	mov    %eax,0x808060
+  803190:	8b 46 20             	mov    0x20(%esi),%eax
+  803193:	a3 64 80 80 00       	mov    %eax,0x808064
+  803198:	8b 46 24             	mov    0x24(%esi),%eax
+  80319b:	a3 68 80 80 00       	mov    %eax,0x808068
+  8031a0:	8b 46 28             	mov    0x28(%esi),%eax
+  8031a3:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8031a8:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8031ab:	a3 70 80 80 00       	mov    %eax,0x808070
+  8031b0:	8b 46 30             	mov    0x30(%esi),%eax
+  8031b3:	a3 74 80 80 00       	mov    %eax,0x808074
+  8031b8:	8b 46 34             	mov    0x34(%esi),%eax
+  8031bb:	a3 78 80 80 00       	mov    %eax,0x808078
+  8031c0:	8b 46 38             	mov    0x38(%esi),%eax
+  8031c3:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8031c8:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8031cb:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8031d0:	8b 03                	mov    (%ebx),%eax
+  8031d2:	a3 84 80 80 00       	mov    %eax,0x808084
+  8031d7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8031da:	a3 88 80 80 00       	mov    %eax,0x808088
+  8031df:	8b 43 08             	mov    0x8(%ebx),%eax
+  8031e2:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8031e7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8031ea:	a3 90 80 80 00       	mov    %eax,0x808090
+  8031ef:	8b 43 10             	mov    0x10(%ebx),%eax
+  8031f2:	a3 94 80 80 00       	mov    %eax,0x808094
+  8031f7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8031fa:	a3 98 80 80 00       	mov    %eax,0x808098
+  8031ff:	8b 43 18             	mov    0x18(%ebx),%eax
+  803202:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803207:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80320a:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  80320f:	8b 43 20             	mov    0x20(%ebx),%eax
+  803212:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803217:	8b 43 24             	mov    0x24(%ebx),%eax
+  80321a:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80321f:	8b 43 28             	mov    0x28(%ebx),%eax
+  803222:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803227:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  80322a:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  80322f:	8b 43 30             	mov    0x30(%ebx),%eax
+  803232:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803237:	8b 43 34             	mov    0x34(%ebx),%eax
+  80323a:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80323f:	8b 43 38             	mov    0x38(%ebx),%eax
+  803242:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803247:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80324a:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80324f:	8b 45 18             	mov    0x18(%ebp),%eax
+  803252:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803257:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80325c:	e8 2b f6 ff ff       	call   80288c <nsipc>
+  803261:	85 c0                	test   %eax,%eax
+  803263:	0f 88 ad 01 00 00    	js     803416 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803269:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80326f:	89 17                	mov    %edx,(%edi)
+  803271:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803277:	89 57 04             	mov    %edx,0x4(%edi)
+  80327a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803280:	89 57 08             	mov    %edx,0x8(%edi)
+  803283:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803289:	89 57 0c             	mov    %edx,0xc(%edi)
+  80328c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803292:	89 57 10             	mov    %edx,0x10(%edi)
+  803295:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80329b:	89 57 14             	mov    %edx,0x14(%edi)
+  80329e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8032a4:	89 57 18             	mov    %edx,0x18(%edi)
+  8032a7:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8032ad:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8032b0:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8032b6:	89 57 20             	mov    %edx,0x20(%edi)
+  8032b9:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8032bf:	89 57 24             	mov    %edx,0x24(%edi)
+  8032c2:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8032c8:	89 57 28             	mov    %edx,0x28(%edi)
+  8032cb:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8032d1:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8032d4:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8032da:	89 57 30             	mov    %edx,0x30(%edi)
+  8032dd:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8032e3:	89 57 34             	mov    %edx,0x34(%edi)
+  8032e6:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8032ec:	89 57 38             	mov    %edx,0x38(%edi)
+  8032ef:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8032f5:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8032f8:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8032fe:	89 16                	mov    %edx,(%esi)
+  803300:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803306:	89 56 04             	mov    %edx,0x4(%esi)
+  803309:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  80330f:	89 56 08             	mov    %edx,0x8(%esi)
+  803312:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803318:	89 56 0c             	mov    %edx,0xc(%esi)
+  80331b:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  803321:	89 56 10             	mov    %edx,0x10(%esi)
+  803324:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  80332a:	89 56 14             	mov    %edx,0x14(%esi)
+  80332d:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803333:	89 56 18             	mov    %edx,0x18(%esi)
+  803336:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  80333c:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80333f:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803345:	89 56 20             	mov    %edx,0x20(%esi)
+  803348:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80334e:	89 56 24             	mov    %edx,0x24(%esi)
+  803351:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803357:	89 56 28             	mov    %edx,0x28(%esi)
+  80335a:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803360:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803363:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  803369:	89 56 30             	mov    %edx,0x30(%esi)
+  80336c:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803372:	89 56 34             	mov    %edx,0x34(%esi)
+  803375:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80337b:	89 56 38             	mov    %edx,0x38(%esi)
+  80337e:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803384:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803387:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80338d:	89 13                	mov    %edx,(%ebx)
+  80338f:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803395:	89 53 04             	mov    %edx,0x4(%ebx)
+  803398:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80339e:	89 53 08             	mov    %edx,0x8(%ebx)
+  8033a1:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8033a7:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8033aa:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8033b0:	89 53 10             	mov    %edx,0x10(%ebx)
+  8033b3:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8033b9:	89 53 14             	mov    %edx,0x14(%ebx)
+  8033bc:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8033c2:	89 53 18             	mov    %edx,0x18(%ebx)
+  8033c5:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8033cb:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8033ce:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8033d4:	89 53 20             	mov    %edx,0x20(%ebx)
+  8033d7:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8033dd:	89 53 24             	mov    %edx,0x24(%ebx)
+  8033e0:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8033e6:	89 53 28             	mov    %edx,0x28(%ebx)
+  8033e9:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8033ef:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8033f2:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8033f8:	89 53 30             	mov    %edx,0x30(%ebx)
+  8033fb:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  803401:	89 53 34             	mov    %edx,0x34(%ebx)
+  803404:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  80340a:	89 53 38             	mov    %edx,0x38(%ebx)
+  80340d:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803413:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803416:	83 c4 0c             	add    $0xc,%esp
+  803419:	5b                   	pop    %ebx
+  80341a:	5e                   	pop    %esi
+  80341b:	5f                   	pop    %edi
+  80341c:	5d                   	pop    %ebp
+  80341d:	c3                   	ret
+
+0080341e <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80341e:	55                   	push   %ebp
+  80341f:	89 e5                	mov    %esp,%ebp
+  803421:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803424:	8b 45 08             	mov    0x8(%ebp),%eax
+  803427:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  80342c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80342f:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803434:	8b 45 10             	mov    0x10(%ebp),%eax
+  803437:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  80343c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803441:	e8 46 f4 ff ff       	call   80288c <nsipc>
+}
+  803446:	c9                   	leave
+  803447:	c3                   	ret
+
+00803448 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803448:	55                   	push   %ebp
+  803449:	89 e5                	mov    %esp,%ebp
+  80344b:	56                   	push   %esi
+  80344c:	53                   	push   %ebx
+  80344d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803450:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803456:	8b 45 10             	mov    0x10(%ebp),%eax
+  803459:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80345e:	b8 10 00 00 00       	mov    $0x10,%eax
+  803463:	e8 24 f4 ff ff       	call   80288c <nsipc>
+  803468:	89 c3                	mov    %eax,%ebx
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	7e 1f                	jle    80348d <nsipc_evwait+0x45>
+		assert(r <= max);
+  80346e:	39 c6                	cmp    %eax,%esi
+  803470:	7c 24                	jl     803496 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803472:	83 ec 04             	sub    $0x4,%esp
+  803475:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80347c:	50                   	push   %eax
+  80347d:	68 00 80 80 00       	push   $0x808000
+  803482:	ff 75 08             	push   0x8(%ebp)
+  803485:	e8 6e d8 ff ff       	call   800cf8 <memmove>
+  80348a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80348d:	89 d8                	mov    %ebx,%eax
+  80348f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803492:	5b                   	pop    %ebx
+  803493:	5e                   	pop    %esi
+  803494:	5d                   	pop    %ebp
+  803495:	c3                   	ret
+		assert(r <= max);
+  803496:	68 ae 4c 80 00       	push   $0x804cae
+  80349b:	68 81 4c 80 00       	push   $0x804c81
+  8034a0:	68 6a 01 00 00       	push   $0x16a
+  8034a5:	68 96 4c 80 00       	push   $0x804c96
+  8034aa:	e8 c7 ce ff ff       	call   800376 <_panic>
+
+008034af <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8034af:	55                   	push   %ebp
+  8034b0:	89 e5                	mov    %esp,%ebp
+  8034b2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8034b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8034bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034c0:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8034c5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034c8:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8034cd:	b8 09 00 00 00       	mov    $0x9,%eax
+  8034d2:	e8 b5 f3 ff ff       	call   80288c <nsipc>
+}
+  8034d7:	c9                   	leave
+  8034d8:	c3                   	ret
+
+008034d9 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8034d9:	55                   	push   %ebp
+  8034da:	89 e5                	mov    %esp,%ebp
+  8034dc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8034df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e2:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8034e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8034ec:	e8 9b f3 ff ff       	call   80288c <nsipc>
+}
+  8034f1:	c9                   	leave
+  8034f2:	c3                   	ret
+
+008034f3 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8034f3:	55                   	push   %ebp
+  8034f4:	89 e5                	mov    %esp,%ebp
+  8034f6:	53                   	push   %ebx
+  8034f7:	83 ec 04             	sub    $0x4,%esp
+  8034fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8034fd:	b8 12 00 00 00       	mov    $0x12,%eax
+  803502:	e8 85 f3 ff ff       	call   80288c <nsipc>
+  803507:	85 c0                	test   %eax,%eax
+  803509:	78 50                	js     80355b <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  80350b:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  803511:	89 13                	mov    %edx,(%ebx)
+  803513:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803519:	89 53 04             	mov    %edx,0x4(%ebx)
+  80351c:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803522:	89 53 08             	mov    %edx,0x8(%ebx)
+  803525:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80352b:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80352e:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803534:	89 53 10             	mov    %edx,0x10(%ebx)
+  803537:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80353d:	89 53 14             	mov    %edx,0x14(%ebx)
+  803540:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803546:	89 53 18             	mov    %edx,0x18(%ebx)
+  803549:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80354f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803552:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803558:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80355b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80355e:	c9                   	leave
+  80355f:	c3                   	ret
+
+00803560 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803560:	55                   	push   %ebp
+  803561:	89 e5                	mov    %esp,%ebp
+  803563:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803566:	6a 03                	push   $0x3
+  803568:	e8 a6 0e 00 00       	call   804413 <ipc_find_env>
+  80356d:	a3 04 6a 80 00       	mov    %eax,0x806a04
+	nsipcbuf.shard.req_shard = shard;
+  803572:	8b 45 08             	mov    0x8(%ebp),%eax
+  803575:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80357a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80357f:	e8 08 f3 ff ff       	call   80288c <nsipc>
+  803584:	83 c4 10             	add    $0x10,%esp
+  803587:	85 c0                	test   %eax,%eax
+  803589:	78 0a                	js     803595 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80358b:	a3 04 6a 80 00       	mov    %eax,0x806a04
+	return 0;
+  803590:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803595:	c9                   	leave
+  803596:	c3                   	ret
+
+00803597 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803597:	55                   	push   %ebp
+  803598:	89 e5                	mov    %esp,%ebp
+  80359a:	57                   	push   %edi
+  80359b:	56                   	push   %esi
+  80359c:	53                   	push   %ebx
+  80359d:	83 ec 1c             	sub    $0x1c,%esp
+  8035a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8035a3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8035a6:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8035ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035b0:	89 e0                	mov    %esp,%eax
+  8035b2:	89 f2                	mov    %esi,%edx
+  8035b4:	29 c2                	sub    %eax,%edx
+  8035b6:	89 d0                	mov    %edx,%eax
+  8035b8:	c1 e8 0f             	shr    $0xf,%eax
+  8035bb:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8035c1:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8035c4:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  8035cb:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8035ce:	83 ec 0c             	sub    $0xc,%esp
+  8035d1:	ff 75 e0             	push   -0x20(%ebp)
+  8035d4:	e8 79 0e 00 00       	call   804452 <pageref>
+  8035d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8035dc:	83 c4 04             	add    $0x4,%esp
+  8035df:	ff 75 dc             	push   -0x24(%ebp)
+  8035e2:	e8 6b 0e 00 00       	call   804452 <pageref>
+  8035e7:	89 e2                	mov    %esp,%edx
+  8035e9:	89 f1                	mov    %esi,%ecx
+  8035eb:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8035ed:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8035f0:	89 ca                	mov    %ecx,%edx
+  8035f2:	c1 ea 0f             	shr    $0xf,%edx
+  8035f5:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8035fb:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8035fe:	8b 14 95 20 6a 80 00 	mov    0x806a20(,%edx,4),%edx
+  803605:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803608:	39 d7                	cmp    %edx,%edi
+  80360a:	74 40                	je     80364c <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  80360c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80360f:	75 9f                	jne    8035b0 <_pipeisclosed+0x19>
+  803611:	89 e2                	mov    %esp,%edx
+  803613:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803618:	29 d0                	sub    %edx,%eax
+  80361a:	89 c2                	mov    %eax,%edx
+  80361c:	c1 ea 0f             	shr    $0xf,%edx
+  80361f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803624:	b8 00 00 00 00       	mov    $0x0,%eax
+  803629:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80362c:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  803633:	8b 40 58             	mov    0x58(%eax),%eax
+  803636:	6a 01                	push   $0x1
+  803638:	50                   	push   %eax
+  803639:	57                   	push   %edi
+  80363a:	68 b7 4c 80 00       	push   $0x804cb7
+  80363f:	e8 0d ce ff ff       	call   800451 <cprintf>
+  803644:	83 c4 10             	add    $0x10,%esp
+  803647:	e9 5f ff ff ff       	jmp    8035ab <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80364c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80364f:	0f 94 c0             	sete   %al
+  803652:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803655:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803658:	5b                   	pop    %ebx
+  803659:	5e                   	pop    %esi
+  80365a:	5f                   	pop    %edi
+  80365b:	5d                   	pop    %ebp
+  80365c:	c3                   	ret
+
+0080365d <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80365d:	55                   	push   %ebp
+  80365e:	89 e5                	mov    %esp,%ebp
+  803660:	53                   	push   %ebx
+  803661:	83 ec 0c             	sub    $0xc,%esp
+  803664:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803667:	53                   	push   %ebx
+  803668:	6a 00                	push   $0x0
+  80366a:	e8 92 d9 ff ff       	call   801001 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80366f:	89 1c 24             	mov    %ebx,(%esp)
+  803672:	e8 f4 e4 ff ff       	call   801b6b <fd2data>
+  803677:	83 c4 08             	add    $0x8,%esp
+  80367a:	50                   	push   %eax
+  80367b:	6a 00                	push   $0x0
+  80367d:	e8 7f d9 ff ff       	call   801001 <sys_page_unmap>
+}
+  803682:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803685:	c9                   	leave
+  803686:	c3                   	ret
+
+00803687 <devpipe_read>:
+{
+  803687:	55                   	push   %ebp
+  803688:	89 e5                	mov    %esp,%ebp
+  80368a:	57                   	push   %edi
+  80368b:	56                   	push   %esi
+  80368c:	53                   	push   %ebx
+  80368d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803690:	ff 75 08             	push   0x8(%ebp)
+  803693:	e8 d3 e4 ff ff       	call   801b6b <fd2data>
+  803698:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80369a:	8b 70 04             	mov    0x4(%eax),%esi
+  80369d:	8b 00                	mov    (%eax),%eax
+  80369f:	83 c4 10             	add    $0x10,%esp
+  8036a2:	39 f0                	cmp    %esi,%eax
+  8036a4:	75 36                	jne    8036dc <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8036a6:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8036a9:	89 da                	mov    %ebx,%edx
+  8036ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ae:	e8 e4 fe ff ff       	call   803597 <_pipeisclosed>
+  8036b3:	85 c0                	test   %eax,%eax
+  8036b5:	0f 85 d4 00 00 00    	jne    80378f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8036bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036c0:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8036c4:	83 ec 04             	sub    $0x4,%esp
+  8036c7:	6a ff                	push   $0xffffffff
+  8036c9:	56                   	push   %esi
+  8036ca:	57                   	push   %edi
+  8036cb:	e8 aa dc ff ff       	call   80137a <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8036d0:	8b 73 04             	mov    0x4(%ebx),%esi
+  8036d3:	8b 03                	mov    (%ebx),%eax
+  8036d5:	83 c4 10             	add    $0x10,%esp
+  8036d8:	39 c6                	cmp    %eax,%esi
+  8036da:	74 cd                	je     8036a9 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036dc:	8b 73 04             	mov    0x4(%ebx),%esi
+  8036df:	8b 03                	mov    (%ebx),%eax
+  8036e1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8036e7:	29 c6                	sub    %eax,%esi
+  8036e9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036ee:	f7 e6                	mul    %esi
+  8036f0:	c1 ea 0c             	shr    $0xc,%edx
+  8036f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8036f9:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8036fb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8036fe:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803702:	8b 0b                	mov    (%ebx),%ecx
+  803704:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803709:	f7 e1                	mul    %ecx
+  80370b:	c1 ea 0b             	shr    $0xb,%edx
+  80370e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803714:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803716:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80371b:	29 cf                	sub    %ecx,%edi
+  80371d:	39 f7                	cmp    %esi,%edi
+  80371f:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803722:	83 ec 04             	sub    $0x4,%esp
+  803725:	57                   	push   %edi
+  803726:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  80372a:	50                   	push   %eax
+  80372b:	ff 75 0c             	push   0xc(%ebp)
+  80372e:	e8 c5 d5 ff ff       	call   800cf8 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803733:	83 c4 0c             	add    $0xc,%esp
+  803736:	89 f0                	mov    %esi,%eax
+  803738:	29 f8                	sub    %edi,%eax
+  80373a:	50                   	push   %eax
+  80373b:	8d 43 10             	lea    0x10(%ebx),%eax
+  80373e:	50                   	push   %eax
+  80373f:	89 f8                	mov    %edi,%eax
+  803741:	03 45 0c             	add    0xc(%ebp),%eax
+  803744:	50                   	push   %eax
+  803745:	e8 ae d5 ff ff       	call   800cf8 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  80374a:	8b 0b                	mov    (%ebx),%ecx
+  80374c:	01 f1                	add    %esi,%ecx
+  80374e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803753:	f7 e1                	mul    %ecx
+  803755:	c1 ea 0c             	shr    $0xc,%edx
+  803758:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80375e:	29 c1                	sub    %eax,%ecx
+  803760:	89 0b                	mov    %ecx,(%ebx)
+  803762:	b8 00 00 00 00       	mov    $0x0,%eax
+  803767:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80376b:	83 c4 10             	add    $0x10,%esp
+  80376e:	85 c0                	test   %eax,%eax
+  803770:	75 0a                	jne    80377c <devpipe_read+0xf5>
+	return n;
+  803772:	89 f0                	mov    %esi,%eax
+}
+  803774:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803777:	5b                   	pop    %ebx
+  803778:	5e                   	pop    %esi
+  803779:	5f                   	pop    %edi
+  80377a:	5d                   	pop    %ebp
+  80377b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80377c:	83 ec 08             	sub    $0x8,%esp
+  80377f:	68 00 04 00 00       	push   $0x400
+  803784:	53                   	push   %ebx
+  803785:	e8 12 dc ff ff       	call   80139c <sys_futex_wake>
+  80378a:	83 c4 10             	add    $0x10,%esp
+  80378d:	eb e3                	jmp    803772 <devpipe_read+0xeb>
+			return 0;
+  80378f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803794:	eb de                	jmp    803774 <devpipe_read+0xed>
+
+00803796 <devpipe_write>:
+{
+  803796:	55                   	push   %ebp
+  803797:	89 e5                	mov    %esp,%ebp
+  803799:	57                   	push   %edi
+  80379a:	56                   	push   %esi
+  80379b:	53                   	push   %ebx
+  80379c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80379f:	ff 75 08             	push   0x8(%ebp)
+  8037a2:	e8 c4 e3 ff ff       	call   801b6b <fd2data>
+  8037a7:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8037a9:	83 c4 10             	add    $0x10,%esp
+  8037ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037b3:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8037b8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8037bc:	0f 84 43 01 00 00    	je     803905 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037c2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037c5:	8b 06                	mov    (%esi),%eax
+  8037c7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8037cd:	29 c1                	sub    %eax,%ecx
+  8037cf:	89 c8                	mov    %ecx,%eax
+  8037d1:	f7 e7                	mul    %edi
+  8037d3:	c1 ea 0c             	shr    $0xc,%edx
+  8037d6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037dc:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8037de:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8037e4:	75 52                	jne    803838 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8037e6:	89 f2                	mov    %esi,%edx
+  8037e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037eb:	e8 a7 fd ff ff       	call   803597 <_pipeisclosed>
+  8037f0:	85 c0                	test   %eax,%eax
+  8037f2:	0f 85 28 01 00 00    	jne    803920 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8037f8:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037fa:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037fd:	8b 06                	mov    (%esi),%eax
+  8037ff:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803805:	29 c1                	sub    %eax,%ecx
+  803807:	89 c8                	mov    %ecx,%eax
+  803809:	f7 e7                	mul    %edi
+  80380b:	c1 ea 0c             	shr    $0xc,%edx
+  80380e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803814:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803816:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80381c:	75 a4                	jne    8037c2 <devpipe_write+0x2c>
+  80381e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803823:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803827:	83 ec 04             	sub    $0x4,%esp
+  80382a:	6a ff                	push   $0xffffffff
+  80382c:	53                   	push   %ebx
+  80382d:	56                   	push   %esi
+  80382e:	e8 47 db ff ff       	call   80137a <sys_futex_wait>
+}
+  803833:	83 c4 10             	add    $0x10,%esp
+  803836:	eb 8a                	jmp    8037c2 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803838:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80383b:	8b 06                	mov    (%esi),%eax
+  80383d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803843:	29 c1                	sub    %eax,%ecx
+  803845:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80384a:	f7 e1                	mul    %ecx
+  80384c:	c1 ea 0c             	shr    $0xc,%edx
+  80384f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803855:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803857:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80385c:	89 d8                	mov    %ebx,%eax
+  80385e:	29 c8                	sub    %ecx,%eax
+  803860:	8b 55 10             	mov    0x10(%ebp),%edx
+  803863:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803866:	29 ca                	sub    %ecx,%edx
+  803868:	39 d0                	cmp    %edx,%eax
+  80386a:	0f 46 d0             	cmovbe %eax,%edx
+  80386d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803870:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803873:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803878:	f7 e1                	mul    %ecx
+  80387a:	c1 ea 0b             	shr    $0xb,%edx
+  80387d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803883:	89 ca                	mov    %ecx,%edx
+  803885:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803887:	29 d3                	sub    %edx,%ebx
+  803889:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80388c:	39 c3                	cmp    %eax,%ebx
+  80388e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803891:	83 ec 04             	sub    $0x4,%esp
+  803894:	53                   	push   %ebx
+  803895:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803898:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80389b:	51                   	push   %ecx
+  80389c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8038a0:	50                   	push   %eax
+  8038a1:	e8 52 d4 ff ff       	call   800cf8 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8038a6:	83 c4 0c             	add    $0xc,%esp
+  8038a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8038ac:	29 d8                	sub    %ebx,%eax
+  8038ae:	50                   	push   %eax
+  8038af:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8038b2:	01 cb                	add    %ecx,%ebx
+  8038b4:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8038b7:	53                   	push   %ebx
+  8038b8:	8d 46 10             	lea    0x10(%esi),%eax
+  8038bb:	50                   	push   %eax
+  8038bc:	e8 37 d4 ff ff       	call   800cf8 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8038c1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8038c7:	01 c1                	add    %eax,%ecx
+  8038c9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038ce:	f7 e1                	mul    %ecx
+  8038d0:	c1 ea 0c             	shr    $0xc,%edx
+  8038d3:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8038d9:	89 ca                	mov    %ecx,%edx
+  8038db:	29 c2                	sub    %eax,%edx
+  8038dd:	89 56 04             	mov    %edx,0x4(%esi)
+  8038e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e5:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8038e9:	83 c4 10             	add    $0x10,%esp
+  8038ec:	85 c0                	test   %eax,%eax
+  8038ee:	75 1a                	jne    80390a <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8038f0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8038f3:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8038f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038f9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8038fc:	0f 82 c0 fe ff ff    	jb     8037c2 <devpipe_write+0x2c>
+  803902:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803905:	8b 45 10             	mov    0x10(%ebp),%eax
+  803908:	eb 1b                	jmp    803925 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  80390a:	83 ec 08             	sub    $0x8,%esp
+  80390d:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803912:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803915:	50                   	push   %eax
+  803916:	e8 81 da ff ff       	call   80139c <sys_futex_wake>
+  80391b:	83 c4 10             	add    $0x10,%esp
+  80391e:	eb d0                	jmp    8038f0 <devpipe_write+0x15a>
+				return 0;
+  803920:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803925:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803928:	5b                   	pop    %ebx
+  803929:	5e                   	pop    %esi
+  80392a:	5f                   	pop    %edi
+  80392b:	5d                   	pop    %ebp
+  80392c:	c3                   	ret
+
+0080392d <devpipe_stat>:
+{
+  80392d:	55                   	push   %ebp
+  80392e:	89 e5                	mov    %esp,%ebp
+  803930:	56                   	push   %esi
+  803931:	53                   	push   %ebx
+  803932:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803935:	83 ec 0c             	sub    $0xc,%esp
+  803938:	ff 75 08             	push   0x8(%ebp)
+  80393b:	e8 2b e2 ff ff       	call   801b6b <fd2data>
+  803940:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803942:	83 c4 08             	add    $0x8,%esp
+  803945:	68 ca 4c 80 00       	push   $0x804cca
+  80394a:	53                   	push   %ebx
+  80394b:	e8 f8 d1 ff ff       	call   800b48 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803950:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803953:	8b 06                	mov    (%esi),%eax
+  803955:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80395b:	29 c1                	sub    %eax,%ecx
+  80395d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803962:	89 c8                	mov    %ecx,%eax
+  803964:	f7 e2                	mul    %edx
+  803966:	c1 ea 0c             	shr    $0xc,%edx
+  803969:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80396f:	29 d1                	sub    %edx,%ecx
+  803971:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803977:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80397e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803981:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803988:	50 80 00 
+}
+  80398b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803990:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803993:	5b                   	pop    %ebx
+  803994:	5e                   	pop    %esi
+  803995:	5d                   	pop    %ebp
+  803996:	c3                   	ret
+
+00803997 <devpipe_poll>:
+{
+  803997:	55                   	push   %ebp
+  803998:	89 e5                	mov    %esp,%ebp
+  80399a:	57                   	push   %edi
+  80399b:	56                   	push   %esi
+  80399c:	53                   	push   %ebx
+  80399d:	83 ec 18             	sub    $0x18,%esp
+  8039a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8039a6:	57                   	push   %edi
+  8039a7:	e8 bf e1 ff ff       	call   801b6b <fd2data>
+  8039ac:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8039ae:	83 c4 10             	add    $0x10,%esp
+  8039b1:	89 f3                	mov    %esi,%ebx
+  8039b3:	83 e3 01             	and    $0x1,%ebx
+  8039b6:	75 27                	jne    8039df <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8039b8:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8039be:	75 48                	jne    803a08 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8039c0:	89 ca                	mov    %ecx,%edx
+  8039c2:	89 f8                	mov    %edi,%eax
+  8039c4:	e8 ce fb ff ff       	call   803597 <_pipeisclosed>
+  8039c9:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8039cb:	89 d8                	mov    %ebx,%eax
+  8039cd:	83 c8 10             	or     $0x10,%eax
+  8039d0:	85 d2                	test   %edx,%edx
+  8039d2:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8039d5:	89 d8                	mov    %ebx,%eax
+  8039d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039da:	5b                   	pop    %ebx
+  8039db:	5e                   	pop    %esi
+  8039dc:	5f                   	pop    %edi
+  8039dd:	5d                   	pop    %ebp
+  8039de:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039df:	8b 58 04             	mov    0x4(%eax),%ebx
+  8039e2:	8b 00                	mov    (%eax),%eax
+  8039e4:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8039ea:	29 c3                	sub    %eax,%ebx
+  8039ec:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8039f1:	89 d8                	mov    %ebx,%eax
+  8039f3:	f7 e2                	mul    %edx
+  8039f5:	c1 ea 0c             	shr    $0xc,%edx
+  8039f8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8039fe:	39 d3                	cmp    %edx,%ebx
+  803a00:	0f 95 c3             	setne  %bl
+  803a03:	0f b6 db             	movzbl %bl,%ebx
+  803a06:	eb b0                	jmp    8039b8 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a08:	8b 71 04             	mov    0x4(%ecx),%esi
+  803a0b:	8b 01                	mov    (%ecx),%eax
+  803a0d:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803a13:	29 c6                	sub    %eax,%esi
+  803a15:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a1a:	89 f0                	mov    %esi,%eax
+  803a1c:	f7 e2                	mul    %edx
+  803a1e:	c1 ea 0c             	shr    $0xc,%edx
+  803a21:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a27:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803a29:	89 d8                	mov    %ebx,%eax
+  803a2b:	83 c8 04             	or     $0x4,%eax
+  803a2e:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803a34:	0f 42 d8             	cmovb  %eax,%ebx
+  803a37:	eb 87                	jmp    8039c0 <devpipe_poll+0x29>
+
+00803a39 <pipe>:
+{
+  803a39:	55                   	push   %ebp
+  803a3a:	89 e5                	mov    %esp,%ebp
+  803a3c:	56                   	push   %esi
+  803a3d:	53                   	push   %ebx
+  803a3e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803a41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a44:	50                   	push   %eax
+  803a45:	e8 38 e1 ff ff       	call   801b82 <fd_alloc>
+  803a4a:	89 c3                	mov    %eax,%ebx
+  803a4c:	83 c4 10             	add    $0x10,%esp
+  803a4f:	85 c0                	test   %eax,%eax
+  803a51:	0f 88 23 01 00 00    	js     803b7a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a57:	83 ec 04             	sub    $0x4,%esp
+  803a5a:	68 07 04 00 00       	push   $0x407
+  803a5f:	ff 75 f4             	push   -0xc(%ebp)
+  803a62:	6a 00                	push   $0x0
+  803a64:	e8 13 d5 ff ff       	call   800f7c <sys_page_alloc>
+  803a69:	89 c3                	mov    %eax,%ebx
+  803a6b:	83 c4 10             	add    $0x10,%esp
+  803a6e:	85 c0                	test   %eax,%eax
+  803a70:	0f 88 04 01 00 00    	js     803b7a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803a76:	83 ec 0c             	sub    $0xc,%esp
+  803a79:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a7c:	50                   	push   %eax
+  803a7d:	e8 00 e1 ff ff       	call   801b82 <fd_alloc>
+  803a82:	89 c3                	mov    %eax,%ebx
+  803a84:	83 c4 10             	add    $0x10,%esp
+  803a87:	85 c0                	test   %eax,%eax
+  803a89:	0f 88 db 00 00 00    	js     803b6a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a8f:	83 ec 04             	sub    $0x4,%esp
+  803a92:	68 07 04 00 00       	push   $0x407
+  803a97:	ff 75 f0             	push   -0x10(%ebp)
+  803a9a:	6a 00                	push   $0x0
+  803a9c:	e8 db d4 ff ff       	call   800f7c <sys_page_alloc>
+  803aa1:	89 c3                	mov    %eax,%ebx
+  803aa3:	83 c4 10             	add    $0x10,%esp
+  803aa6:	85 c0                	test   %eax,%eax
+  803aa8:	0f 88 bc 00 00 00    	js     803b6a <pipe+0x131>
+	va = fd2data(fd0);
+  803aae:	83 ec 0c             	sub    $0xc,%esp
+  803ab1:	ff 75 f4             	push   -0xc(%ebp)
+  803ab4:	e8 b2 e0 ff ff       	call   801b6b <fd2data>
+  803ab9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803abb:	83 c4 0c             	add    $0xc,%esp
+  803abe:	68 07 04 00 00       	push   $0x407
+  803ac3:	50                   	push   %eax
+  803ac4:	6a 00                	push   $0x0
+  803ac6:	e8 b1 d4 ff ff       	call   800f7c <sys_page_alloc>
+  803acb:	89 c3                	mov    %eax,%ebx
+  803acd:	83 c4 10             	add    $0x10,%esp
+  803ad0:	85 c0                	test   %eax,%eax
+  803ad2:	0f 88 82 00 00 00    	js     803b5a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ad8:	83 ec 0c             	sub    $0xc,%esp
+  803adb:	ff 75 f0             	push   -0x10(%ebp)
+  803ade:	e8 88 e0 ff ff       	call   801b6b <fd2data>
+  803ae3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803aea:	50                   	push   %eax
+  803aeb:	6a 00                	push   $0x0
+  803aed:	56                   	push   %esi
+  803aee:	6a 00                	push   $0x0
+  803af0:	e8 ca d4 ff ff       	call   800fbf <sys_page_map>
+  803af5:	89 c3                	mov    %eax,%ebx
+  803af7:	83 c4 20             	add    $0x20,%esp
+  803afa:	85 c0                	test   %eax,%eax
+  803afc:	78 4e                	js     803b4c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803afe:	a1 60 50 80 00       	mov    0x805060,%eax
+  803b03:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b06:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b08:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b0b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b12:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b15:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b17:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b1a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b21:	83 ec 0c             	sub    $0xc,%esp
+  803b24:	ff 75 f4             	push   -0xc(%ebp)
+  803b27:	e8 2f e0 ff ff       	call   801b5b <fd2num>
+  803b2c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b2f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803b31:	83 c4 04             	add    $0x4,%esp
+  803b34:	ff 75 f0             	push   -0x10(%ebp)
+  803b37:	e8 1f e0 ff ff       	call   801b5b <fd2num>
+  803b3c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b3f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803b42:	83 c4 10             	add    $0x10,%esp
+  803b45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b4a:	eb 2e                	jmp    803b7a <pipe+0x141>
+	sys_page_unmap(0, va);
+  803b4c:	83 ec 08             	sub    $0x8,%esp
+  803b4f:	56                   	push   %esi
+  803b50:	6a 00                	push   $0x0
+  803b52:	e8 aa d4 ff ff       	call   801001 <sys_page_unmap>
+  803b57:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803b5a:	83 ec 08             	sub    $0x8,%esp
+  803b5d:	ff 75 f0             	push   -0x10(%ebp)
+  803b60:	6a 00                	push   $0x0
+  803b62:	e8 9a d4 ff ff       	call   801001 <sys_page_unmap>
+  803b67:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803b6a:	83 ec 08             	sub    $0x8,%esp
+  803b6d:	ff 75 f4             	push   -0xc(%ebp)
+  803b70:	6a 00                	push   $0x0
+  803b72:	e8 8a d4 ff ff       	call   801001 <sys_page_unmap>
+  803b77:	83 c4 10             	add    $0x10,%esp
+}
+  803b7a:	89 d8                	mov    %ebx,%eax
+  803b7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b7f:	5b                   	pop    %ebx
+  803b80:	5e                   	pop    %esi
+  803b81:	5d                   	pop    %ebp
+  803b82:	c3                   	ret
+
+00803b83 <pipeisclosed>:
+{
+  803b83:	55                   	push   %ebp
+  803b84:	89 e5                	mov    %esp,%ebp
+  803b86:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b8c:	50                   	push   %eax
+  803b8d:	ff 75 08             	push   0x8(%ebp)
+  803b90:	e8 3d e0 ff ff       	call   801bd2 <fd_lookup>
+  803b95:	83 c4 10             	add    $0x10,%esp
+  803b98:	85 c0                	test   %eax,%eax
+  803b9a:	78 18                	js     803bb4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803b9c:	83 ec 0c             	sub    $0xc,%esp
+  803b9f:	ff 75 f4             	push   -0xc(%ebp)
+  803ba2:	e8 c4 df ff ff       	call   801b6b <fd2data>
+  803ba7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803ba9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bac:	e8 e6 f9 ff ff       	call   803597 <_pipeisclosed>
+  803bb1:	83 c4 10             	add    $0x10,%esp
+}
+  803bb4:	c9                   	leave
+  803bb5:	c3                   	ret
+
+00803bb6 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803bb6:	55                   	push   %ebp
+  803bb7:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bbc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803bc2:	5d                   	pop    %ebp
+  803bc3:	c3                   	ret
+
+00803bc4 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803bc4:	55                   	push   %ebp
+  803bc5:	89 e5                	mov    %esp,%ebp
+  803bc7:	53                   	push   %ebx
+  803bc8:	83 ec 04             	sub    $0x4,%esp
+  803bcb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803bce:	8b 03                	mov    (%ebx),%eax
+  803bd0:	85 c0                	test   %eax,%eax
+  803bd2:	75 05                	jne    803bd9 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803bd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bd7:	c9                   	leave
+  803bd8:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803bd9:	83 ec 08             	sub    $0x8,%esp
+  803bdc:	50                   	push   %eax
+  803bdd:	8d 43 04             	lea    0x4(%ebx),%eax
+  803be0:	50                   	push   %eax
+  803be1:	e8 6b d6 ff ff       	call   801251 <sys_page_batch>
+	pb->pb_n = 0;
+  803be6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803bec:	83 c4 10             	add    $0x10,%esp
+  803bef:	eb e3                	jmp    803bd4 <pgbatch_flush+0x10>
+
+00803bf1 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803bf1:	55                   	push   %ebp
+  803bf2:	89 e5                	mov    %esp,%ebp
+  803bf4:	56                   	push   %esi
+  803bf5:	53                   	push   %ebx
+  803bf6:	89 c3                	mov    %eax,%ebx
+  803bf8:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803bfa:	83 38 20             	cmpl   $0x20,(%eax)
+  803bfd:	74 2c                	je     803c2b <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803bff:	8b 03                	mov    (%ebx),%eax
+  803c01:	8d 50 01             	lea    0x1(%eax),%edx
+  803c04:	89 13                	mov    %edx,(%ebx)
+  803c06:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803c09:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803c0d:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803c0f:	83 ec 04             	sub    $0x4,%esp
+  803c12:	6a 18                	push   $0x18
+  803c14:	6a 00                	push   $0x0
+  803c16:	50                   	push   %eax
+  803c17:	e8 a7 d0 ff ff       	call   800cc3 <memset>
+	return 0;
+  803c1c:	83 c4 10             	add    $0x10,%esp
+  803c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c27:	5b                   	pop    %ebx
+  803c28:	5e                   	pop    %esi
+  803c29:	5d                   	pop    %ebp
+  803c2a:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803c2b:	83 ec 0c             	sub    $0xc,%esp
+  803c2e:	50                   	push   %eax
+  803c2f:	e8 90 ff ff ff       	call   803bc4 <pgbatch_flush>
+  803c34:	83 c4 10             	add    $0x10,%esp
+  803c37:	85 c0                	test   %eax,%eax
+  803c39:	79 c4                	jns    803bff <pgbatch_slot+0xe>
+  803c3b:	eb e7                	jmp    803c24 <pgbatch_slot+0x33>
+
+00803c3d <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803c3d:	55                   	push   %ebp
+  803c3e:	89 e5                	mov    %esp,%ebp
+  803c40:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c43:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c46:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c49:	e8 a3 ff ff ff       	call   803bf1 <pgbatch_slot>
+  803c4e:	85 c0                	test   %eax,%eax
+  803c50:	78 20                	js     803c72 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803c52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c55:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803c5b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c5e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803c61:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c64:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803c67:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c6a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c72:	c9                   	leave
+  803c73:	c3                   	ret
+
+00803c74 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803c74:	55                   	push   %ebp
+  803c75:	89 e5                	mov    %esp,%ebp
+  803c77:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c7a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c80:	e8 6c ff ff ff       	call   803bf1 <pgbatch_slot>
+  803c85:	85 c0                	test   %eax,%eax
+  803c87:	78 2c                	js     803cb5 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803c89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c8c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803c92:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c95:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803c98:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c9b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803c9e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ca1:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803ca4:	8b 55 18             	mov    0x18(%ebp),%edx
+  803ca7:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803caa:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803cad:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cb5:	c9                   	leave
+  803cb6:	c3                   	ret
+
+00803cb7 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803cb7:	55                   	push   %ebp
+  803cb8:	89 e5                	mov    %esp,%ebp
+  803cba:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803cbd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc3:	e8 29 ff ff ff       	call   803bf1 <pgbatch_slot>
+  803cc8:	85 c0                	test   %eax,%eax
+  803cca:	78 1a                	js     803ce6 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803ccc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ccf:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803cd5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cd8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803cdb:	8b 55 10             	mov    0x10(%ebp),%edx
+  803cde:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ce6:	c9                   	leave
+  803ce7:	c3                   	ret
+
+00803ce8 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803ce8:	55                   	push   %ebp
+  803ce9:	89 e5                	mov    %esp,%ebp
+  803ceb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803cee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803cf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cf4:	e8 f8 fe ff ff       	call   803bf1 <pgbatch_slot>
+  803cf9:	85 c0                	test   %eax,%eax
+  803cfb:	78 20                	js     803d1d <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803cfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d00:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803d06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d09:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803d0c:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d0f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d12:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d15:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d1d:	c9                   	leave
+  803d1e:	c3                   	ret
+
+00803d1f <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803d1f:	55                   	push   %ebp
+  803d20:	89 e5                	mov    %esp,%ebp
+  803d22:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d25:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d28:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d2b:	e8 c1 fe ff ff       	call   803bf1 <pgbatch_slot>
+  803d30:	85 c0                	test   %eax,%eax
+  803d32:	78 26                	js     803d5a <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803d34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d37:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803d3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d40:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803d43:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d46:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803d49:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d4c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803d4f:	8b 55 18             	mov    0x18(%ebp),%edx
+  803d52:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d5a:	c9                   	leave
+  803d5b:	c3                   	ret
+
+00803d5c <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803d5c:	55                   	push   %ebp
+  803d5d:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803d5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d62:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d68:	5d                   	pop    %ebp
+  803d69:	c3                   	ret
+
+00803d6a <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803d6a:	55                   	push   %ebp
+  803d6b:	89 e5                	mov    %esp,%ebp
+  803d6d:	56                   	push   %esi
+  803d6e:	53                   	push   %ebx
+  803d6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d77:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d7c:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803d80:	85 c0                	test   %eax,%eax
+  803d82:	74 2f                	je     803db3 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803d84:	83 f8 02             	cmp    $0x2,%eax
+  803d87:	74 0c                	je     803d95 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803d89:	b8 02 00 00 00       	mov    $0x2,%eax
+  803d8e:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803d91:	85 c0                	test   %eax,%eax
+  803d93:	74 1e                	je     803db3 <mutex_lock+0x49>
+  803d95:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803d9a:	83 ec 04             	sub    $0x4,%esp
+  803d9d:	6a ff                	push   $0xffffffff
+  803d9f:	6a 02                	push   $0x2
+  803da1:	53                   	push   %ebx
+  803da2:	e8 d3 d5 ff ff       	call   80137a <sys_futex_wait>
+  803da7:	89 f0                	mov    %esi,%eax
+  803da9:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803dac:	83 c4 10             	add    $0x10,%esp
+  803daf:	85 c0                	test   %eax,%eax
+  803db1:	75 e7                	jne    803d9a <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803db3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803db6:	5b                   	pop    %ebx
+  803db7:	5e                   	pop    %esi
+  803db8:	5d                   	pop    %ebp
+  803db9:	c3                   	ret
+
+00803dba <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803dba:	55                   	push   %ebp
+  803dbb:	89 e5                	mov    %esp,%ebp
+  803dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803dca:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803dce:	85 c0                	test   %eax,%eax
+  803dd0:	0f 94 c0             	sete   %al
+  803dd3:	0f b6 c0             	movzbl %al,%eax
+}
+  803dd6:	5d                   	pop    %ebp
+  803dd7:	c3                   	ret
+
+00803dd8 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803dd8:	55                   	push   %ebp
+  803dd9:	89 e5                	mov    %esp,%ebp
+  803ddb:	83 ec 08             	sub    $0x8,%esp
+  803dde:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de6:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803de9:	83 f8 02             	cmp    $0x2,%eax
+  803dec:	74 02                	je     803df0 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803dee:	c9                   	leave
+  803def:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803df0:	83 ec 08             	sub    $0x8,%esp
+  803df3:	6a 01                	push   $0x1
+  803df5:	52                   	push   %edx
+  803df6:	e8 a1 d5 ff ff       	call   80139c <sys_futex_wake>
+  803dfb:	83 c4 10             	add    $0x10,%esp
+}
+  803dfe:	eb ee                	jmp    803dee <mutex_unlock+0x16>
+
+00803e00 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803e00:	55                   	push   %ebp
+  803e01:	89 e5                	mov    %esp,%ebp
+  803e03:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803e06:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803e0c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803e13:	5d                   	pop    %ebp
+  803e14:	c3                   	ret
+
+00803e15 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803e15:	55                   	push   %ebp
+  803e16:	89 e5                	mov    %esp,%ebp
+  803e18:	57                   	push   %edi
+  803e19:	56                   	push   %esi
+  803e1a:	53                   	push   %ebx
+  803e1b:	83 ec 18             	sub    $0x18,%esp
+  803e1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803e21:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803e24:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803e26:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e2b:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803e30:	57                   	push   %edi
+  803e31:	e8 a2 ff ff ff       	call   803dd8 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803e36:	83 c4 0c             	add    $0xc,%esp
+  803e39:	ff 75 10             	push   0x10(%ebp)
+  803e3c:	56                   	push   %esi
+  803e3d:	53                   	push   %ebx
+  803e3e:	e8 37 d5 ff ff       	call   80137a <sys_futex_wait>
+  803e43:	89 c6                	mov    %eax,%esi
+  803e45:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803e4a:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803e4f:	89 3c 24             	mov    %edi,(%esp)
+  803e52:	e8 13 ff ff ff       	call   803d6a <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803e57:	83 c4 10             	add    $0x10,%esp
+  803e5a:	83 fe ef             	cmp    $0xffffffef,%esi
+  803e5d:	74 05                	je     803e64 <cond_timedwait+0x4f>
+  803e5f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803e64:	89 f0                	mov    %esi,%eax
+  803e66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e69:	5b                   	pop    %ebx
+  803e6a:	5e                   	pop    %esi
+  803e6b:	5f                   	pop    %edi
+  803e6c:	5d                   	pop    %ebp
+  803e6d:	c3                   	ret
+
+00803e6e <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803e6e:	55                   	push   %ebp
+  803e6f:	89 e5                	mov    %esp,%ebp
+  803e71:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803e74:	6a ff                	push   $0xffffffff
+  803e76:	ff 75 0c             	push   0xc(%ebp)
+  803e79:	ff 75 08             	push   0x8(%ebp)
+  803e7c:	e8 94 ff ff ff       	call   803e15 <cond_timedwait>
+}
+  803e81:	83 c4 10             	add    $0x10,%esp
+  803e84:	c9                   	leave
+  803e85:	c3                   	ret
+
+00803e86 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803e86:	55                   	push   %ebp
+  803e87:	89 e5                	mov    %esp,%ebp
+  803e89:	83 ec 08             	sub    $0x8,%esp
+  803e8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e8f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e94:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803e98:	8b 50 04             	mov    0x4(%eax),%edx
+  803e9b:	85 d2                	test   %edx,%edx
+  803e9d:	75 02                	jne    803ea1 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803e9f:	c9                   	leave
+  803ea0:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803ea1:	83 ec 08             	sub    $0x8,%esp
+  803ea4:	6a 01                	push   $0x1
+  803ea6:	50                   	push   %eax
+  803ea7:	e8 f0 d4 ff ff       	call   80139c <sys_futex_wake>
+  803eac:	83 c4 10             	add    $0x10,%esp
+}
+  803eaf:	eb ee                	jmp    803e9f <cond_signal+0x19>
+
+00803eb1 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803eb1:	55                   	push   %ebp
+  803eb2:	89 e5                	mov    %esp,%ebp
+  803eb4:	83 ec 08             	sub    $0x8,%esp
+  803eb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eba:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ebf:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803ec3:	8b 50 04             	mov    0x4(%eax),%edx
+  803ec6:	85 d2                	test   %edx,%edx
+  803ec8:	75 02                	jne    803ecc <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803eca:	c9                   	leave
+  803ecb:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803ecc:	83 ec 08             	sub    $0x8,%esp
+  803ecf:	68 00 04 00 00       	push   $0x400
+  803ed4:	50                   	push   %eax
+  803ed5:	e8 c2 d4 ff ff       	call   80139c <sys_futex_wake>
+  803eda:	83 c4 10             	add    $0x10,%esp
+}
+  803edd:	eb eb                	jmp    803eca <cond_broadcast+0x19>
+
+00803edf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee4:	c3                   	ret
+
+00803ee5 <devcons_poll>:
+{
+  803ee5:	55                   	push   %ebp
+  803ee6:	89 e5                	mov    %esp,%ebp
+  803ee8:	53                   	push   %ebx
+  803ee9:	83 ec 04             	sub    $0x4,%esp
+  803eec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803eef:	89 da                	mov    %ebx,%edx
+  803ef1:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803ef4:	83 3d 14 6a 80 00 00 	cmpl   $0x0,0x806a14
+  803efb:	74 0c                	je     803f09 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803efd:	89 d8                	mov    %ebx,%eax
+  803eff:	83 e0 01             	and    $0x1,%eax
+  803f02:	09 d0                	or     %edx,%eax
+}
+  803f04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f07:	c9                   	leave
+  803f08:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803f09:	e8 d0 cf ff ff       	call   800ede <sys_cgetc>
+  803f0e:	a3 14 6a 80 00       	mov    %eax,0x806a14
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803f13:	89 da                	mov    %ebx,%edx
+  803f15:	83 e2 04             	and    $0x4,%edx
+  803f18:	85 c0                	test   %eax,%eax
+  803f1a:	74 e6                	je     803f02 <devcons_poll+0x1d>
+  803f1c:	eb df                	jmp    803efd <devcons_poll+0x18>
+
+00803f1e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803f1e:	55                   	push   %ebp
+  803f1f:	89 e5                	mov    %esp,%ebp
+  803f21:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803f24:	68 d1 4c 80 00       	push   $0x804cd1
+  803f29:	ff 75 0c             	push   0xc(%ebp)
+  803f2c:	e8 17 cc ff ff       	call   800b48 <strcpy>
+	return 0;
+}
+  803f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f36:	c9                   	leave
+  803f37:	c3                   	ret
+
+00803f38 <devcons_write>:
+{
+  803f38:	55                   	push   %ebp
+  803f39:	89 e5                	mov    %esp,%ebp
+  803f3b:	57                   	push   %edi
+  803f3c:	56                   	push   %esi
+  803f3d:	53                   	push   %ebx
+  803f3e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803f44:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803f47:	85 ff                	test   %edi,%edi
+  803f49:	74 51                	je     803f9c <devcons_write+0x64>
+  803f4b:	be 00 00 00 00       	mov    $0x0,%esi
+  803f50:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803f55:	89 fb                	mov    %edi,%ebx
+  803f57:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803f59:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803f5e:	39 d3                	cmp    %edx,%ebx
+  803f60:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803f63:	83 ec 04             	sub    $0x4,%esp
+  803f66:	53                   	push   %ebx
+  803f67:	03 45 0c             	add    0xc(%ebp),%eax
+  803f6a:	50                   	push   %eax
+  803f6b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803f71:	50                   	push   %eax
+  803f72:	e8 81 cd ff ff       	call   800cf8 <memmove>
+		sys_cputs(buf, m);
+  803f77:	83 c4 08             	add    $0x8,%esp
+  803f7a:	53                   	push   %ebx
+  803f7b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803f81:	50                   	push   %eax
+  803f82:	e8 39 cf ff ff       	call   800ec0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803f87:	01 de                	add    %ebx,%esi
+  803f89:	89 f0                	mov    %esi,%eax
+  803f8b:	83 c4 10             	add    $0x10,%esp
+  803f8e:	39 fe                	cmp    %edi,%esi
+  803f90:	72 c3                	jb     803f55 <devcons_write+0x1d>
+}
+  803f92:	89 f0                	mov    %esi,%eax
+  803f94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f97:	5b                   	pop    %ebx
+  803f98:	5e                   	pop    %esi
+  803f99:	5f                   	pop    %edi
+  803f9a:	5d                   	pop    %ebp
+  803f9b:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803f9c:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803fa1:	eb ef                	jmp    803f92 <devcons_write+0x5a>
+
+00803fa3 <devcons_read>:
+{
+  803fa3:	55                   	push   %ebp
+  803fa4:	89 e5                	mov    %esp,%ebp
+  803fa6:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803fae:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803fb2:	74 36                	je     803fea <devcons_read+0x47>
+	c = cons_peek;
+  803fb4:	a1 14 6a 80 00       	mov    0x806a14,%eax
+	cons_peek = 0;
+  803fb9:	c7 05 14 6a 80 00 00 	movl   $0x0,0x806a14
+  803fc0:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803fc3:	85 c0                	test   %eax,%eax
+  803fc5:	75 10                	jne    803fd7 <devcons_read+0x34>
+  803fc7:	e8 12 cf ff ff       	call   800ede <sys_cgetc>
+  803fcc:	85 c0                	test   %eax,%eax
+  803fce:	75 07                	jne    803fd7 <devcons_read+0x34>
+		sys_yield();
+  803fd0:	e8 88 cf ff ff       	call   800f5d <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803fd5:	eb f0                	jmp    803fc7 <devcons_read+0x24>
+	if (c < 0)
+  803fd7:	85 c0                	test   %eax,%eax
+  803fd9:	78 0f                	js     803fea <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803fdb:	83 f8 04             	cmp    $0x4,%eax
+  803fde:	74 0c                	je     803fec <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803fe0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fe3:	88 02                	mov    %al,(%edx)
+	return 1;
+  803fe5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803fea:	c9                   	leave
+  803feb:	c3                   	ret
+		return 0;
+  803fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff1:	eb f7                	jmp    803fea <devcons_read+0x47>
+
+00803ff3 <cputchar>:
+{
+  803ff3:	55                   	push   %ebp
+  803ff4:	89 e5                	mov    %esp,%ebp
+  803ff6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803ff9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ffc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803fff:	6a 01                	push   $0x1
+  804001:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804004:	50                   	push   %eax
+  804005:	e8 b6 ce ff ff       	call   800ec0 <sys_cputs>
+}
+  80400a:	83 c4 10             	add    $0x10,%esp
+  80400d:	c9                   	leave
+  80400e:	c3                   	ret
+
+0080400f <getchar>:
+{
+  80400f:	55                   	push   %ebp
+  804010:	89 e5                	mov    %esp,%ebp
+  804012:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804015:	6a 01                	push   $0x1
+  804017:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80401a:	50                   	push   %eax
+  80401b:	6a 00                	push   $0x0
+  80401d:	e8 34 de ff ff       	call   801e56 <read>
+	if (r < 0)
+  804022:	83 c4 10             	add    $0x10,%esp
+  804025:	85 c0                	test   %eax,%eax
+  804027:	78 06                	js     80402f <getchar+0x20>
+	if (r < 1)
+  804029:	74 06                	je     804031 <getchar+0x22>
+	return c;
+  80402b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80402f:	c9                   	leave
+  804030:	c3                   	ret
+		return -E_EOF;
+  804031:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804036:	eb f7                	jmp    80402f <getchar+0x20>
+
+00804038 <iscons>:
+{
+  804038:	55                   	push   %ebp
+  804039:	89 e5                	mov    %esp,%ebp
+  80403b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80403e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804041:	50                   	push   %eax
+  804042:	ff 75 08             	push   0x8(%ebp)
+  804045:	e8 88 db ff ff       	call   801bd2 <fd_lookup>
+  80404a:	83 c4 10             	add    $0x10,%esp
+  80404d:	85 c0                	test   %eax,%eax
+  80404f:	78 11                	js     804062 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804051:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804054:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80405a:	39 10                	cmp    %edx,(%eax)
+  80405c:	0f 94 c0             	sete   %al
+  80405f:	0f b6 c0             	movzbl %al,%eax
+}
+  804062:	c9                   	leave
+  804063:	c3                   	ret
+
+00804064 <opencons>:
+{
+  804064:	55                   	push   %ebp
+  804065:	89 e5                	mov    %esp,%ebp
+  804067:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80406a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80406d:	50                   	push   %eax
+  80406e:	e8 0f db ff ff       	call   801b82 <fd_alloc>
+  804073:	83 c4 10             	add    $0x10,%esp
+  804076:	85 c0                	test   %eax,%eax
+  804078:	78 3a                	js     8040b4 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80407a:	83 ec 04             	sub    $0x4,%esp
+  80407d:	68 07 04 00 00       	push   $0x407
+  804082:	ff 75 f4             	push   -0xc(%ebp)
+  804085:	6a 00                	push   $0x0
+  804087:	e8 f0 ce ff ff       	call   800f7c <sys_page_alloc>
+  80408c:	83 c4 10             	add    $0x10,%esp
+  80408f:	85 c0                	test   %eax,%eax
+  804091:	78 21                	js     8040b4 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804093:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804096:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80409c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80409e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8040a1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8040a8:	83 ec 0c             	sub    $0xc,%esp
+  8040ab:	50                   	push   %eax
+  8040ac:	e8 aa da ff ff       	call   801b5b <fd2num>
+  8040b1:	83 c4 10             	add    $0x10,%esp
+}
+  8040b4:	c9                   	leave
+  8040b5:	c3                   	ret
+
+008040b6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8040b6:	55                   	push   %ebp
+  8040b7:	89 e5                	mov    %esp,%ebp
+  8040b9:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8040bc:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8040c3:	74 0a                	je     8040cf <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8040c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040c8:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8040cd:	c9                   	leave
+  8040ce:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8040cf:	83 ec 04             	sub    $0x4,%esp
+  8040d2:	6a 07                	push   $0x7
+  8040d4:	68 00 f0 bf ee       	push   $0xeebff000
+  8040d9:	6a 00                	push   $0x0
+  8040db:	e8 9c ce ff ff       	call   800f7c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8040e0:	83 c4 08             	add    $0x8,%esp
+  8040e3:	68 f4 40 80 00       	push   $0x8040f4
+  8040e8:	6a 00                	push   $0x0
+  8040ea:	e8 d8 cf ff ff       	call   8010c7 <sys_env_set_pgfault_upcall>
+  8040ef:	83 c4 10             	add    $0x10,%esp
+  8040f2:	eb d1                	jmp    8040c5 <set_pgfault_handler+0xf>
+
+008040f4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8040f4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8040f5:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8040fa:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8040fc:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  8040ff:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804103:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804106:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  80410a:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  80410c:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804110:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804113:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804114:	83 c4 04             	add    $0x4,%esp
+	popf
+  804117:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804118:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804119:	c3                   	ret
+
+0080411a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80411a:	55                   	push   %ebp
+  80411b:	89 e5                	mov    %esp,%ebp
+  80411d:	56                   	push   %esi
+  80411e:	53                   	push   %ebx
+  80411f:	8b 75 08             	mov    0x8(%ebp),%esi
+  804122:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804125:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804128:	85 c0                	test   %eax,%eax
+  80412a:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80412f:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804132:	83 ec 0c             	sub    $0xc,%esp
+  804135:	50                   	push   %eax
+  804136:	e8 f1 cf ff ff       	call   80112c <sys_ipc_recv>
+  80413b:	83 c4 10             	add    $0x10,%esp
+  80413e:	85 c0                	test   %eax,%eax
+  804140:	0f 88 8b 00 00 00    	js     8041d1 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804146:	85 f6                	test   %esi,%esi
+  804148:	74 2a                	je     804174 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80414a:	89 e2                	mov    %esp,%edx
+  80414c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804151:	29 d0                	sub    %edx,%eax
+  804153:	89 c2                	mov    %eax,%edx
+  804155:	c1 ea 0f             	shr    $0xf,%edx
+  804158:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80415d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804162:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804165:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80416c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804172:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804174:	85 db                	test   %ebx,%ebx
+  804176:	74 2a                	je     8041a2 <ipc_recv+0x88>
+  804178:	89 e2                	mov    %esp,%edx
+  80417a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80417f:	29 d0                	sub    %edx,%eax
+  804181:	89 c2                	mov    %eax,%edx
+  804183:	c1 ea 0f             	shr    $0xf,%edx
+  804186:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80418b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804190:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804193:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80419a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8041a0:	89 03                	mov    %eax,(%ebx)
+  8041a2:	89 e2                	mov    %esp,%edx
+  8041a4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8041a9:	29 d0                	sub    %edx,%eax
+  8041ab:	89 c2                	mov    %eax,%edx
+  8041ad:	c1 ea 0f             	shr    $0xf,%edx
+  8041b0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8041b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ba:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8041bd:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  8041c4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8041ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8041cd:	5b                   	pop    %ebx
+  8041ce:	5e                   	pop    %esi
+  8041cf:	5d                   	pop    %ebp
+  8041d0:	c3                   	ret
+		if(from_env_store != NULL)
+  8041d1:	85 f6                	test   %esi,%esi
+  8041d3:	74 06                	je     8041db <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8041d5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8041db:	85 db                	test   %ebx,%ebx
+  8041dd:	74 eb                	je     8041ca <ipc_recv+0xb0>
+			*perm_store = 0;
+  8041df:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8041e5:	eb e3                	jmp    8041ca <ipc_recv+0xb0>
+
+008041e7 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8041e7:	55                   	push   %ebp
+  8041e8:	89 e5                	mov    %esp,%ebp
+  8041ea:	57                   	push   %edi
+  8041eb:	56                   	push   %esi
+  8041ec:	53                   	push   %ebx
+  8041ed:	83 ec 14             	sub    $0x14,%esp
+  8041f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8041f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041f6:	8b 75 14             	mov    0x14(%ebp),%esi
+  8041f9:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8041fc:	85 c0                	test   %eax,%eax
+  8041fe:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804203:	0f 44 c2             	cmove  %edx,%eax
+  804206:	ff 75 10             	push   0x10(%ebp)
+  804209:	50                   	push   %eax
+  80420a:	e8 7f cf ff ff       	call   80118e <sys_ipc_recv_pages>
+  80420f:	83 c4 10             	add    $0x10,%esp
+  804212:	85 c0                	test   %eax,%eax
+  804214:	0f 88 ba 00 00 00    	js     8042d4 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  80421a:	85 ff                	test   %edi,%edi
+  80421c:	74 2a                	je     804248 <ipc_recv_pages+0x61>
+  80421e:	89 e2                	mov    %esp,%edx
+  804220:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804225:	29 d0                	sub    %edx,%eax
+  804227:	89 c2                	mov    %eax,%edx
+  804229:	c1 ea 0f             	shr    $0xf,%edx
+  80422c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804231:	b8 00 00 00 00       	mov    $0x0,%eax
+  804236:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804239:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  804240:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804246:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804248:	85 f6                	test   %esi,%esi
+  80424a:	74 2a                	je     804276 <ipc_recv_pages+0x8f>
+  80424c:	89 e2                	mov    %esp,%edx
+  80424e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804253:	29 d0                	sub    %edx,%eax
+  804255:	89 c2                	mov    %eax,%edx
+  804257:	c1 ea 0f             	shr    $0xf,%edx
+  80425a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80425f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804264:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804267:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80426e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804274:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804276:	85 db                	test   %ebx,%ebx
+  804278:	74 2a                	je     8042a4 <ipc_recv_pages+0xbd>
+  80427a:	89 e2                	mov    %esp,%edx
+  80427c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804281:	29 d0                	sub    %edx,%eax
+  804283:	89 c2                	mov    %eax,%edx
+  804285:	c1 ea 0f             	shr    $0xf,%edx
+  804288:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80428d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804292:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804295:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  80429c:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8042a2:	89 03                	mov    %eax,(%ebx)
+  8042a4:	89 e2                	mov    %esp,%edx
+  8042a6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8042ab:	29 d0                	sub    %edx,%eax
+  8042ad:	89 c2                	mov    %eax,%edx
+  8042af:	c1 ea 0f             	shr    $0xf,%edx
+  8042b2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8042b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042bc:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8042bf:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  8042c6:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8042cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042cf:	5b                   	pop    %ebx
+  8042d0:	5e                   	pop    %esi
+  8042d1:	5f                   	pop    %edi
+  8042d2:	5d                   	pop    %ebp
+  8042d3:	c3                   	ret
+		if (from_env_store)
+  8042d4:	85 ff                	test   %edi,%edi
+  8042d6:	74 06                	je     8042de <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8042d8:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8042de:	85 f6                	test   %esi,%esi
+  8042e0:	74 06                	je     8042e8 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8042e2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8042e8:	85 db                	test   %ebx,%ebx
+  8042ea:	74 e0                	je     8042cc <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8042ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8042f2:	eb d8                	jmp    8042cc <ipc_recv_pages+0xe5>
+
+008042f4 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8042f4:	55                   	push   %ebp
+  8042f5:	89 e5                	mov    %esp,%ebp
+  8042f7:	57                   	push   %edi
+  8042f8:	56                   	push   %esi
+  8042f9:	53                   	push   %ebx
+  8042fa:	83 ec 1c             	sub    $0x1c,%esp
+  8042fd:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804300:	8b 75 08             	mov    0x8(%ebp),%esi
+  804303:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804309:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80430d:	75 2b                	jne    80433a <ipc_try_send_pages+0x46>
+  80430f:	89 e2                	mov    %esp,%edx
+  804311:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804316:	29 d0                	sub    %edx,%eax
+  804318:	89 c2                	mov    %eax,%edx
+  80431a:	c1 ea 0f             	shr    $0xf,%edx
+  80431d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804322:	b8 00 00 00 00       	mov    $0x0,%eax
+  804327:	0f 42 c2             	cmovb  %edx,%eax
+  80432a:	8b 04 85 20 6a 80 00 	mov    0x806a20(,%eax,4),%eax
+  804331:	8b 70 48             	mov    0x48(%eax),%esi
+  804334:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80433a:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804340:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804345:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804348:	85 ff                	test   %edi,%edi
+  80434a:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80434f:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804352:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804358:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80435e:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804364:	83 ec 0c             	sub    $0xc,%esp
+  804367:	ff 75 14             	push   0x14(%ebp)
+  80436a:	ff 75 18             	push   0x18(%ebp)
+  80436d:	57                   	push   %edi
+  80436e:	ff 75 0c             	push   0xc(%ebp)
+  804371:	ff 75 08             	push   0x8(%ebp)
+  804374:	e8 f4 cd ff ff       	call   80116d <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804379:	83 c4 20             	add    $0x20,%esp
+  80437c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80437f:	75 21                	jne    8043a2 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804381:	83 ec 04             	sub    $0x4,%esp
+  804384:	6a ff                	push   $0xffffffff
+  804386:	53                   	push   %ebx
+  804387:	ff 75 e4             	push   -0x1c(%ebp)
+  80438a:	e8 eb cf ff ff       	call   80137a <sys_futex_wait>
+  80438f:	83 c4 10             	add    $0x10,%esp
+  804392:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804395:	74 c7                	je     80435e <ipc_try_send_pages+0x6a>
+  804397:	85 c0                	test   %eax,%eax
+  804399:	79 c3                	jns    80435e <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80439b:	e8 bd cb ff ff       	call   800f5d <sys_yield>
+  8043a0:	eb bc                	jmp    80435e <ipc_try_send_pages+0x6a>
+	}
+}
+  8043a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043a5:	5b                   	pop    %ebx
+  8043a6:	5e                   	pop    %esi
+  8043a7:	5f                   	pop    %edi
+  8043a8:	5d                   	pop    %ebp
+  8043a9:	c3                   	ret
+
+008043aa <ipc_send>:
+{
+  8043aa:	55                   	push   %ebp
+  8043ab:	89 e5                	mov    %esp,%ebp
+  8043ad:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8043b0:	ff 75 14             	push   0x14(%ebp)
+  8043b3:	6a 01                	push   $0x1
+  8043b5:	ff 75 10             	push   0x10(%ebp)
+  8043b8:	ff 75 0c             	push   0xc(%ebp)
+  8043bb:	ff 75 08             	push   0x8(%ebp)
+  8043be:	e8 31 ff ff ff       	call   8042f4 <ipc_try_send_pages>
+  8043c3:	83 c4 20             	add    $0x20,%esp
+  8043c6:	85 c0                	test   %eax,%eax
+  8043c8:	78 02                	js     8043cc <ipc_send+0x22>
+}
+  8043ca:	c9                   	leave
+  8043cb:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8043cc:	50                   	push   %eax
+  8043cd:	68 dd 4c 80 00       	push   $0x804cdd
+  8043d2:	6a 3f                	push   $0x3f
+  8043d4:	68 f2 4c 80 00       	push   $0x804cf2
+  8043d9:	e8 98 bf ff ff       	call   800376 <_panic>
+
+008043de <ipc_send_pages>:
+{
+  8043de:	55                   	push   %ebp
+  8043df:	89 e5                	mov    %esp,%ebp
+  8043e1:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8043e4:	ff 75 18             	push   0x18(%ebp)
+  8043e7:	ff 75 14             	push   0x14(%ebp)
+  8043ea:	ff 75 10             	push   0x10(%ebp)
+  8043ed:	ff 75 0c             	push   0xc(%ebp)
+  8043f0:	ff 75 08             	push   0x8(%ebp)
+  8043f3:	e8 fc fe ff ff       	call   8042f4 <ipc_try_send_pages>
+  8043f8:	83 c4 20             	add    $0x20,%esp
+  8043fb:	85 c0                	test   %eax,%eax
+  8043fd:	78 02                	js     804401 <ipc_send_pages+0x23>
+}
+  8043ff:	c9                   	leave
+  804400:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804401:	50                   	push   %eax
+  804402:	68 fc 4c 80 00       	push   $0x804cfc
+  804407:	6a 64                	push   $0x64
+  804409:	68 f2 4c 80 00       	push   $0x804cf2
+  80440e:	e8 63 bf ff ff       	call   800376 <_panic>
+
+00804413 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804413:	55                   	push   %ebp
+  804414:	89 e5                	mov    %esp,%ebp
+  804416:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804419:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80441e:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804424:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80442a:	8b 52 50             	mov    0x50(%edx),%edx
+  80442d:	39 ca                	cmp    %ecx,%edx
+  80442f:	74 11                	je     804442 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804431:	83 c0 01             	add    $0x1,%eax
+  804434:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804439:	75 e3                	jne    80441e <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80443b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804440:	eb 0e                	jmp    804450 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804442:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804448:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80444d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804450:	5d                   	pop    %ebp
+  804451:	c3                   	ret
+
+00804452 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804452:	55                   	push   %ebp
+  804453:	89 e5                	mov    %esp,%ebp
+  804455:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804458:	89 c2                	mov    %eax,%edx
+  80445a:	c1 ea 16             	shr    $0x16,%edx
+  80445d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804464:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804469:	f6 c1 01             	test   $0x1,%cl
+  80446c:	74 1e                	je     80448c <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80446e:	c1 e8 0c             	shr    $0xc,%eax
+  804471:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804478:	a8 01                	test   $0x1,%al
+  80447a:	74 10                	je     80448c <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80447c:	c1 e8 0c             	shr    $0xc,%eax
+  80447f:	c1 e0 04             	shl    $0x4,%eax
+  804482:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804489:	0f b7 d2             	movzwl %dx,%edx
+}
+  80448c:	89 d0                	mov    %edx,%eax
+  80448e:	5d                   	pop    %ebp
+  80448f:	c3                   	ret
+
+00804490 <__udivdi3>:
+  804490:	57                   	push   %edi
+  804491:	56                   	push   %esi
+  804492:	53                   	push   %ebx
+  804493:	83 ec 20             	sub    $0x20,%esp
+  804496:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80449a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80449e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044a2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044a6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8044aa:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8044ae:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044b2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044b6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044c5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044cc:	00 
+  8044cd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044d4:	00 
+  8044d5:	eb 08                	jmp    8044df <__udivdi3+0x4f>
+  8044d7:	83 e9 01             	sub    $0x1,%ecx
+  8044da:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044dd:	74 68                	je     804547 <__udivdi3+0xb7>
+  8044df:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044e3:	01 c0                	add    %eax,%eax
+  8044e5:	89 c6                	mov    %eax,%esi
+  8044e7:	89 d7                	mov    %edx,%edi
+  8044e9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8044ed:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8044f1:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044f4:	d3 ea                	shr    %cl,%edx
+  8044f6:	f6 c1 20             	test   $0x20,%cl
+  8044f9:	74 04                	je     8044ff <__udivdi3+0x6f>
+  8044fb:	89 d0                	mov    %edx,%eax
+  8044fd:	31 d2                	xor    %edx,%edx
+  8044ff:	83 e0 01             	and    $0x1,%eax
+  804502:	89 04 24             	mov    %eax,(%esp)
+  804505:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80450c:	00 
+  80450d:	8b 04 24             	mov    (%esp),%eax
+  804510:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804514:	09 f0                	or     %esi,%eax
+  804516:	09 fa                	or     %edi,%edx
+  804518:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80451c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804520:	39 f0                	cmp    %esi,%eax
+  804522:	89 d3                	mov    %edx,%ebx
+  804524:	19 fb                	sbb    %edi,%ebx
+  804526:	72 af                	jb     8044d7 <__udivdi3+0x47>
+  804528:	29 f0                	sub    %esi,%eax
+  80452a:	19 fa                	sbb    %edi,%edx
+  80452c:	89 cf                	mov    %ecx,%edi
+  80452e:	c1 ef 05             	shr    $0x5,%edi
+  804531:	83 e7 01             	and    $0x1,%edi
+  804534:	89 fe                	mov    %edi,%esi
+  804536:	83 f6 01             	xor    $0x1,%esi
+  804539:	d3 e6                	shl    %cl,%esi
+  80453b:	d3 e7                	shl    %cl,%edi
+  80453d:	09 74 24 18          	or     %esi,0x18(%esp)
+  804541:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804545:	eb 90                	jmp    8044d7 <__udivdi3+0x47>
+  804547:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80454b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80454f:	83 c4 20             	add    $0x20,%esp
+  804552:	5b                   	pop    %ebx
+  804553:	5e                   	pop    %esi
+  804554:	5f                   	pop    %edi
+  804555:	c3                   	ret
+
+00804556 <__umoddi3>:
+  804556:	57                   	push   %edi
+  804557:	56                   	push   %esi
+  804558:	53                   	push   %ebx
+  804559:	83 ec 08             	sub    $0x8,%esp
+  80455c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804560:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804564:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804568:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80456c:	57                   	push   %edi
+  80456d:	56                   	push   %esi
+  80456e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804572:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804576:	52                   	push   %edx
+  804577:	50                   	push   %eax
+  804578:	e8 13 ff ff ff       	call   804490 <__udivdi3>
+  80457d:	89 c3                	mov    %eax,%ebx
+  80457f:	0f af d6             	imul   %esi,%edx
+  804582:	89 f9                	mov    %edi,%ecx
+  804584:	0f af cb             	imul   %ebx,%ecx
+  804587:	01 d1                	add    %edx,%ecx
+  804589:	89 d8                	mov    %ebx,%eax
+  80458b:	f7 e6                	mul    %esi
+  80458d:	89 c6                	mov    %eax,%esi
+  80458f:	89 d7                	mov    %edx,%edi
+  804591:	01 cf                	add    %ecx,%edi
+  804593:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804597:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80459b:	29 f0                	sub    %esi,%eax
+  80459d:	19 fa                	sbb    %edi,%edx
+  80459f:	83 c4 18             	add    $0x18,%esp
+  8045a2:	5b                   	pop    %ebx
+  8045a3:	5e                   	pop    %esi
+  8045a4:	5f                   	pop    %edi
+  8045a5:	c3                   	ret
+
+008045a6 <__divdi3>:
+  8045a6:	53                   	push   %ebx
+  8045a7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8045ab:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8045af:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8045b3:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8045b7:	85 d2                	test   %edx,%edx
+  8045b9:	78 12                	js     8045cd <__divdi3+0x27>
+  8045bb:	85 db                	test   %ebx,%ebx
+  8045bd:	78 2e                	js     8045ed <__divdi3+0x47>
+  8045bf:	53                   	push   %ebx
+  8045c0:	51                   	push   %ecx
+  8045c1:	52                   	push   %edx
+  8045c2:	50                   	push   %eax
+  8045c3:	e8 c8 fe ff ff       	call   804490 <__udivdi3>
+  8045c8:	83 c4 10             	add    $0x10,%esp
+  8045cb:	eb 1e                	jmp    8045eb <__divdi3+0x45>
+  8045cd:	f7 d8                	neg    %eax
+  8045cf:	83 d2 00             	adc    $0x0,%edx
+  8045d2:	f7 da                	neg    %edx
+  8045d4:	85 db                	test   %ebx,%ebx
+  8045d6:	78 2a                	js     804602 <__divdi3+0x5c>
+  8045d8:	53                   	push   %ebx
+  8045d9:	51                   	push   %ecx
+  8045da:	52                   	push   %edx
+  8045db:	50                   	push   %eax
+  8045dc:	e8 af fe ff ff       	call   804490 <__udivdi3>
+  8045e1:	83 c4 10             	add    $0x10,%esp
+  8045e4:	f7 d8                	neg    %eax
+  8045e6:	83 d2 00             	adc    $0x0,%edx
+  8045e9:	f7 da                	neg    %edx
+  8045eb:	5b                   	pop    %ebx
+  8045ec:	c3                   	ret
+  8045ed:	f7 d9                	neg    %ecx
+  8045ef:	83 d3 00             	adc    $0x0,%ebx
+  8045f2:	f7 db                	neg    %ebx
+  8045f4:	53                   	push   %ebx
+  8045f5:	51                   	push   %ecx
+  8045f6:	52                   	push   %edx
+  8045f7:	50                   	push   %eax
+  8045f8:	e8 93 fe ff ff       	call   804490 <__udivdi3>
+  8045fd:	83 c4 10             	add    $0x10,%esp
+  804600:	eb e2                	jmp    8045e4 <__divdi3+0x3e>
+  804602:	f7 d9                	neg    %ecx
+  804604:	83 d3 00             	adc    $0x0,%ebx
+  804607:	f7 db                	neg    %ebx
+  804609:	53                   	push   %ebx
+  80460a:	51                   	push   %ecx
+  80460b:	52                   	push   %edx
+  80460c:	50                   	push   %eax
+  80460d:	e8 7e fe ff ff       	call   804490 <__udivdi3>
+  804612:	83 c4 10             	add    $0x10,%esp
+  804615:	eb d4                	jmp    8045eb <__divdi3+0x45>
+
+00804617 <__moddi3>:
+  804617:	57                   	push   %edi
+  804618:	56                   	push   %esi
+  804619:	53                   	push   %ebx
+  80461a:	83 ec 08             	sub    $0x8,%esp
+  80461d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804621:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804625:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804629:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80462d:	57                   	push   %edi
+  80462e:	56                   	push   %esi
+  80462f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804633:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804637:	52                   	push   %edx
+  804638:	50                   	push   %eax
+  804639:	e8 68 ff ff ff       	call   8045a6 <__divdi3>
+  80463e:	89 c3                	mov    %eax,%ebx
+  804640:	0f af d6             	imul   %esi,%edx
+  804643:	89 f9                	mov    %edi,%ecx
+  804645:	0f af cb             	imul   %ebx,%ecx
+  804648:	01 d1                	add    %edx,%ecx
+  80464a:	89 d8                	mov    %ebx,%eax
+  80464c:	f7 e6                	mul    %esi
+  80464e:	89 c6                	mov    %eax,%esi
+  804650:	89 d7                	mov    %edx,%edi
+  804652:	01 cf                	add    %ecx,%edi
+  804654:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804658:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80465c:	29 f0                	sub    %esi,%eax
+  80465e:	19 fa                	sbb    %edi,%edx
+  804660:	83 c4 18             	add    $0x18,%esp
+  804663:	5b                   	pop    %ebx
+  804664:	5e                   	pop    %esi
+  804665:	5f                   	pop    %edi
+  804666:	c3                   	ret
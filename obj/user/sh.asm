@@ -0,0 +1,11263 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 0b 00 00       	call   800b3e <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 0c             	sub    $0xc,%esp
+  80003e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800041:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int t;
+
+	if (s == 0) {
+  800044:	85 db                	test   %ebx,%ebx
+  800046:	74 1a                	je     800062 <_gettoken+0x2d>
+		if (debug > 1)
+			cprintf("GETTOKEN NULL\n");
+		return 0;
+	}
+
+	if (debug > 1)
+  800048:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80004f:	7f 31                	jg     800082 <_gettoken+0x4d>
+		cprintf("GETTOKEN: %s\n", s);
+
+	*p1 = 0;
+  800051:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*p2 = 0;
+  800057:	8b 45 10             	mov    0x10(%ebp),%eax
+  80005a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	while (strchr(WHITESPACE, *s))
+  800060:	eb 3a                	jmp    80009c <_gettoken+0x67>
+		return 0;
+  800062:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  800067:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80006e:	7e 59                	jle    8000c9 <_gettoken+0x94>
+			cprintf("GETTOKEN NULL\n");
+  800070:	83 ec 0c             	sub    $0xc,%esp
+  800073:	68 c0 59 80 00       	push   $0x8059c0
+  800078:	e8 43 0c 00 00       	call   800cc0 <cprintf>
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	eb 47                	jmp    8000c9 <_gettoken+0x94>
+		cprintf("GETTOKEN: %s\n", s);
+  800082:	83 ec 08             	sub    $0x8,%esp
+  800085:	53                   	push   %ebx
+  800086:	68 cf 59 80 00       	push   $0x8059cf
+  80008b:	e8 30 0c 00 00       	call   800cc0 <cprintf>
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	eb bc                	jmp    800051 <_gettoken+0x1c>
+		*s++ = 0;
+  800095:	83 c3 01             	add    $0x1,%ebx
+  800098:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+	while (strchr(WHITESPACE, *s))
+  80009c:	83 ec 08             	sub    $0x8,%esp
+  80009f:	0f be 03             	movsbl (%ebx),%eax
+  8000a2:	50                   	push   %eax
+  8000a3:	68 dd 59 80 00       	push   $0x8059dd
+  8000a8:	e8 1e 15 00 00       	call   8015cb <strchr>
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	85 c0                	test   %eax,%eax
+  8000b2:	75 e1                	jne    800095 <_gettoken+0x60>
+	if (*s == 0) {
+  8000b4:	0f b6 03             	movzbl (%ebx),%eax
+  8000b7:	84 c0                	test   %al,%al
+  8000b9:	75 2a                	jne    8000e5 <_gettoken+0xb0>
+		if (debug > 1)
+			cprintf("EOL\n");
+		return 0;
+  8000bb:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  8000c0:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  8000c7:	7f 0a                	jg     8000d3 <_gettoken+0x9e>
+		**p2 = 0;
+		cprintf("WORD: %s\n", *p1);
+		**p2 = t;
+	}
+	return 'w';
+}
+  8000c9:	89 f0                	mov    %esi,%eax
+  8000cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ce:	5b                   	pop    %ebx
+  8000cf:	5e                   	pop    %esi
+  8000d0:	5f                   	pop    %edi
+  8000d1:	5d                   	pop    %ebp
+  8000d2:	c3                   	ret
+			cprintf("EOL\n");
+  8000d3:	83 ec 0c             	sub    $0xc,%esp
+  8000d6:	68 e2 59 80 00       	push   $0x8059e2
+  8000db:	e8 e0 0b 00 00       	call   800cc0 <cprintf>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	eb e4                	jmp    8000c9 <_gettoken+0x94>
+	if (strchr(SYMBOLS, *s)) {
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	0f be c0             	movsbl %al,%eax
+  8000eb:	50                   	push   %eax
+  8000ec:	68 f3 59 80 00       	push   $0x8059f3
+  8000f1:	e8 d5 14 00 00       	call   8015cb <strchr>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	74 2c                	je     800129 <_gettoken+0xf4>
+		t = *s;
+  8000fd:	0f be 33             	movsbl (%ebx),%esi
+		*p1 = s;
+  800100:	89 1f                	mov    %ebx,(%edi)
+		*s++ = 0;
+  800102:	c6 03 00             	movb   $0x0,(%ebx)
+  800105:	83 c3 01             	add    $0x1,%ebx
+  800108:	8b 45 10             	mov    0x10(%ebp),%eax
+  80010b:	89 18                	mov    %ebx,(%eax)
+		if (debug > 1)
+  80010d:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  800114:	7e b3                	jle    8000c9 <_gettoken+0x94>
+			cprintf("TOK %c\n", t);
+  800116:	83 ec 08             	sub    $0x8,%esp
+  800119:	56                   	push   %esi
+  80011a:	68 e7 59 80 00       	push   $0x8059e7
+  80011f:	e8 9c 0b 00 00       	call   800cc0 <cprintf>
+  800124:	83 c4 10             	add    $0x10,%esp
+  800127:	eb a0                	jmp    8000c9 <_gettoken+0x94>
+	*p1 = s;
+  800129:	89 1f                	mov    %ebx,(%edi)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012b:	0f b6 03             	movzbl (%ebx),%eax
+  80012e:	84 c0                	test   %al,%al
+  800130:	74 22                	je     800154 <_gettoken+0x11f>
+  800132:	83 ec 08             	sub    $0x8,%esp
+  800135:	0f be c0             	movsbl %al,%eax
+  800138:	50                   	push   %eax
+  800139:	68 ef 59 80 00       	push   $0x8059ef
+  80013e:	e8 88 14 00 00       	call   8015cb <strchr>
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	85 c0                	test   %eax,%eax
+  800148:	75 0a                	jne    800154 <_gettoken+0x11f>
+		s++;
+  80014a:	83 c3 01             	add    $0x1,%ebx
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80014d:	0f b6 03             	movzbl (%ebx),%eax
+  800150:	84 c0                	test   %al,%al
+  800152:	75 de                	jne    800132 <_gettoken+0xfd>
+	*p2 = s;
+  800154:	8b 45 10             	mov    0x10(%ebp),%eax
+  800157:	89 18                	mov    %ebx,(%eax)
+	return 'w';
+  800159:	be 77 00 00 00       	mov    $0x77,%esi
+	if (debug > 1) {
+  80015e:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  800165:	0f 8e 5e ff ff ff    	jle    8000c9 <_gettoken+0x94>
+		t = **p2;
+  80016b:	0f b6 33             	movzbl (%ebx),%esi
+		**p2 = 0;
+  80016e:	c6 03 00             	movb   $0x0,(%ebx)
+		cprintf("WORD: %s\n", *p1);
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 37                	push   (%edi)
+  800176:	68 fb 59 80 00       	push   $0x8059fb
+  80017b:	e8 40 0b 00 00       	call   800cc0 <cprintf>
+		**p2 = t;
+  800180:	8b 45 10             	mov    0x10(%ebp),%eax
+  800183:	8b 00                	mov    (%eax),%eax
+  800185:	89 f2                	mov    %esi,%edx
+  800187:	88 10                	mov    %dl,(%eax)
+  800189:	83 c4 10             	add    $0x10,%esp
+	return 'w';
+  80018c:	be 77 00 00 00       	mov    $0x77,%esi
+  800191:	e9 33 ff ff ff       	jmp    8000c9 <_gettoken+0x94>
+
+00800196 <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	83 ec 08             	sub    $0x8,%esp
+  80019c:	8b 45 08             	mov    0x8(%ebp),%eax
+	static int c, nc;
+	static char* np1, *np2;
+
+	if (s) {
+  80019f:	85 c0                	test   %eax,%eax
+  8001a1:	74 22                	je     8001c5 <gettoken+0x2f>
+		nc = _gettoken(s, &np1, &np2);
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	68 08 80 80 00       	push   $0x808008
+  8001ab:	68 0c 80 80 00       	push   $0x80800c
+  8001b0:	50                   	push   %eax
+  8001b1:	e8 7f fe ff ff       	call   800035 <_gettoken>
+  8001b6:	a3 04 80 80 00       	mov    %eax,0x808004
+		return 0;
+  8001bb:	83 c4 10             	add    $0x10,%esp
+  8001be:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	c = nc;
+	*p1 = np1;
+	nc = _gettoken(np2, &np1, &np2);
+	return c;
+}
+  8001c3:	c9                   	leave
+  8001c4:	c3                   	ret
+	c = nc;
+  8001c5:	a1 04 80 80 00       	mov    0x808004,%eax
+  8001ca:	a3 00 80 80 00       	mov    %eax,0x808000
+	*p1 = np1;
+  8001cf:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8001d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d8:	89 10                	mov    %edx,(%eax)
+	nc = _gettoken(np2, &np1, &np2);
+  8001da:	83 ec 04             	sub    $0x4,%esp
+  8001dd:	68 08 80 80 00       	push   $0x808008
+  8001e2:	68 0c 80 80 00       	push   $0x80800c
+  8001e7:	ff 35 08 80 80 00    	push   0x808008
+  8001ed:	e8 43 fe ff ff       	call   800035 <_gettoken>
+  8001f2:	a3 04 80 80 00       	mov    %eax,0x808004
+	return c;
+  8001f7:	a1 00 80 80 00       	mov    0x808000,%eax
+  8001fc:	83 c4 10             	add    $0x10,%esp
+  8001ff:	eb c2                	jmp    8001c3 <gettoken+0x2d>
+
+00800201 <runcmd>:
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	57                   	push   %edi
+  800205:	56                   	push   %esi
+  800206:	53                   	push   %ebx
+  800207:	81 ec 74 04 00 00    	sub    $0x474,%esp
+	gettoken(s, 0);
+  80020d:	6a 00                	push   $0x0
+  80020f:	ff 75 08             	push   0x8(%ebp)
+  800212:	e8 7f ff ff ff       	call   800196 <gettoken>
+  800217:	83 c4 10             	add    $0x10,%esp
+		switch ((c = gettoken(0, &t))) {
+  80021a:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	argc = 0;
+  80021d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch ((c = gettoken(0, &t))) {
+  800222:	83 ec 08             	sub    $0x8,%esp
+  800225:	56                   	push   %esi
+  800226:	6a 00                	push   $0x0
+  800228:	e8 69 ff ff ff       	call   800196 <gettoken>
+  80022d:	89 c7                	mov    %eax,%edi
+  80022f:	83 c4 10             	add    $0x10,%esp
+  800232:	83 f8 3e             	cmp    $0x3e,%eax
+  800235:	0f 84 3f 01 00 00    	je     80037a <runcmd+0x179>
+  80023b:	7f 53                	jg     800290 <runcmd+0x8f>
+  80023d:	85 c0                	test   %eax,%eax
+  80023f:	0f 84 36 02 00 00    	je     80047b <runcmd+0x27a>
+  800245:	83 f8 3c             	cmp    $0x3c,%eax
+  800248:	0f 85 81 03 00 00    	jne    8005cf <runcmd+0x3ce>
+			if (gettoken(0, &t) != 'w') {
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800254:	50                   	push   %eax
+  800255:	6a 00                	push   $0x0
+  800257:	e8 3a ff ff ff       	call   800196 <gettoken>
+  80025c:	83 c4 10             	add    $0x10,%esp
+  80025f:	83 f8 77             	cmp    $0x77,%eax
+  800262:	0f 85 c1 00 00 00    	jne    800329 <runcmd+0x128>
+			if ((fd = open(t, O_RDONLY)) < 0) {
+  800268:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80026b:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800271:	83 ec 08             	sub    $0x8,%esp
+  800274:	6a 00                	push   $0x0
+  800276:	50                   	push   %eax
+  800277:	e8 81 2b 00 00       	call   802dfd <open>
+  80027c:	89 c7                	mov    %eax,%edi
+  80027e:	83 c4 10             	add    $0x10,%esp
+  800281:	85 c0                	test   %eax,%eax
+  800283:	0f 88 ba 00 00 00    	js     800343 <runcmd+0x142>
+			if (fd != 0) {
+  800289:	74 97                	je     800222 <runcmd+0x21>
+  80028b:	e9 cf 00 00 00       	jmp    80035f <runcmd+0x15e>
+		switch ((c = gettoken(0, &t))) {
+  800290:	83 f8 77             	cmp    $0x77,%eax
+  800293:	74 69                	je     8002fe <runcmd+0xfd>
+  800295:	83 f8 7c             	cmp    $0x7c,%eax
+  800298:	0f 85 31 03 00 00    	jne    8005cf <runcmd+0x3ce>
+			if ((r = pipe(p)) < 0) {
+  80029e:	83 ec 0c             	sub    $0xc,%esp
+  8002a1:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	e8 4e 4c 00 00       	call   804efb <pipe>
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	85 c0                	test   %eax,%eax
+  8002b2:	0f 88 51 01 00 00    	js     800409 <runcmd+0x208>
+			if (debug)
+  8002b8:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8002bf:	0f 85 5f 01 00 00    	jne    800424 <runcmd+0x223>
+			if ((r = fork()) < 0) {
+  8002c5:	e8 19 1c 00 00       	call   801ee3 <fork>
+  8002ca:	89 c7                	mov    %eax,%edi
+  8002cc:	85 c0                	test   %eax,%eax
+  8002ce:	0f 88 71 01 00 00    	js     800445 <runcmd+0x244>
+			if (r == 0) {
+  8002d4:	0f 85 81 01 00 00    	jne    80045b <runcmd+0x25a>
+				if (p[0] != 0) {
+  8002da:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002e0:	85 c0                	test   %eax,%eax
+  8002e2:	0f 85 a5 02 00 00    	jne    80058d <runcmd+0x38c>
+				close(p[1]);
+  8002e8:	83 ec 0c             	sub    $0xc,%esp
+  8002eb:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002f1:	e8 cf 24 00 00       	call   8027c5 <close>
+				goto again;
+  8002f6:	83 c4 10             	add    $0x10,%esp
+  8002f9:	e9 1f ff ff ff       	jmp    80021d <runcmd+0x1c>
+			if (argc == MAXARGS) {
+  8002fe:	83 fb 10             	cmp    $0x10,%ebx
+  800301:	74 0f                	je     800312 <runcmd+0x111>
+			argv[argc++] = t;
+  800303:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800306:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  80030a:	8d 5b 01             	lea    0x1(%ebx),%ebx
+			break;
+  80030d:	e9 10 ff ff ff       	jmp    800222 <runcmd+0x21>
+				cprintf("too many arguments\n");
+  800312:	83 ec 0c             	sub    $0xc,%esp
+  800315:	68 05 5a 80 00       	push   $0x805a05
+  80031a:	e8 a1 09 00 00       	call   800cc0 <cprintf>
+				exit();
+  80031f:	e8 a7 08 00 00       	call   800bcb <exit>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	eb da                	jmp    800303 <runcmd+0x102>
+				cprintf("syntax error: < not followed by word\n");
+  800329:	83 ec 0c             	sub    $0xc,%esp
+  80032c:	68 7c 5b 80 00       	push   $0x805b7c
+  800331:	e8 8a 09 00 00       	call   800cc0 <cprintf>
+				exit();
+  800336:	e8 90 08 00 00       	call   800bcb <exit>
+  80033b:	83 c4 10             	add    $0x10,%esp
+  80033e:	e9 25 ff ff ff       	jmp    800268 <runcmd+0x67>
+				cprintf("open %s for read: %e", t, fd);
+  800343:	83 ec 04             	sub    $0x4,%esp
+  800346:	50                   	push   %eax
+  800347:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  80034d:	68 19 5a 80 00       	push   $0x805a19
+  800352:	e8 69 09 00 00       	call   800cc0 <cprintf>
+				exit();
+  800357:	e8 6f 08 00 00       	call   800bcb <exit>
+  80035c:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 0);
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	6a 00                	push   $0x0
+  800364:	57                   	push   %edi
+  800365:	e8 b0 24 00 00       	call   80281a <dup>
+				close(fd);
+  80036a:	89 3c 24             	mov    %edi,(%esp)
+  80036d:	e8 53 24 00 00       	call   8027c5 <close>
+  800372:	83 c4 10             	add    $0x10,%esp
+  800375:	e9 a8 fe ff ff       	jmp    800222 <runcmd+0x21>
+			if (gettoken(0, &t) != 'w') {
+  80037a:	83 ec 08             	sub    $0x8,%esp
+  80037d:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800380:	50                   	push   %eax
+  800381:	6a 00                	push   $0x0
+  800383:	e8 0e fe ff ff       	call   800196 <gettoken>
+  800388:	83 c4 10             	add    $0x10,%esp
+  80038b:	83 f8 77             	cmp    $0x77,%eax
+  80038e:	75 2b                	jne    8003bb <runcmd+0x1ba>
+			if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  800390:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800393:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800399:	83 ec 08             	sub    $0x8,%esp
+  80039c:	68 01 03 00 00       	push   $0x301
+  8003a1:	50                   	push   %eax
+  8003a2:	e8 56 2a 00 00       	call   802dfd <open>
+  8003a7:	89 c7                	mov    %eax,%edi
+  8003a9:	83 c4 10             	add    $0x10,%esp
+  8003ac:	85 c0                	test   %eax,%eax
+  8003ae:	78 22                	js     8003d2 <runcmd+0x1d1>
+			if (fd != 1) {
+  8003b0:	83 f8 01             	cmp    $0x1,%eax
+  8003b3:	0f 84 69 fe ff ff    	je     800222 <runcmd+0x21>
+  8003b9:	eb 33                	jmp    8003ee <runcmd+0x1ed>
+				cprintf("syntax error: > not followed by word\n");
+  8003bb:	83 ec 0c             	sub    $0xc,%esp
+  8003be:	68 a4 5b 80 00       	push   $0x805ba4
+  8003c3:	e8 f8 08 00 00       	call   800cc0 <cprintf>
+				exit();
+  8003c8:	e8 fe 07 00 00       	call   800bcb <exit>
+  8003cd:	83 c4 10             	add    $0x10,%esp
+  8003d0:	eb be                	jmp    800390 <runcmd+0x18f>
+				cprintf("open %s for write: %e", t, fd);
+  8003d2:	83 ec 04             	sub    $0x4,%esp
+  8003d5:	50                   	push   %eax
+  8003d6:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003dc:	68 2e 5a 80 00       	push   $0x805a2e
+  8003e1:	e8 da 08 00 00       	call   800cc0 <cprintf>
+				exit();
+  8003e6:	e8 e0 07 00 00       	call   800bcb <exit>
+  8003eb:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 1);
+  8003ee:	83 ec 08             	sub    $0x8,%esp
+  8003f1:	6a 01                	push   $0x1
+  8003f3:	57                   	push   %edi
+  8003f4:	e8 21 24 00 00       	call   80281a <dup>
+				close(fd);
+  8003f9:	89 3c 24             	mov    %edi,(%esp)
+  8003fc:	e8 c4 23 00 00       	call   8027c5 <close>
+  800401:	83 c4 10             	add    $0x10,%esp
+  800404:	e9 19 fe ff ff       	jmp    800222 <runcmd+0x21>
+				cprintf("pipe: %e", r);
+  800409:	83 ec 08             	sub    $0x8,%esp
+  80040c:	50                   	push   %eax
+  80040d:	68 44 5a 80 00       	push   $0x805a44
+  800412:	e8 a9 08 00 00       	call   800cc0 <cprintf>
+				exit();
+  800417:	e8 af 07 00 00       	call   800bcb <exit>
+  80041c:	83 c4 10             	add    $0x10,%esp
+  80041f:	e9 94 fe ff ff       	jmp    8002b8 <runcmd+0xb7>
+				cprintf("PIPE: %d %d\n", p[0], p[1]);
+  800424:	83 ec 04             	sub    $0x4,%esp
+  800427:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  80042d:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800433:	68 4d 5a 80 00       	push   $0x805a4d
+  800438:	e8 83 08 00 00       	call   800cc0 <cprintf>
+  80043d:	83 c4 10             	add    $0x10,%esp
+  800440:	e9 80 fe ff ff       	jmp    8002c5 <runcmd+0xc4>
+				cprintf("fork: %e", r);
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	50                   	push   %eax
+  800449:	68 0d 60 80 00       	push   $0x80600d
+  80044e:	e8 6d 08 00 00       	call   800cc0 <cprintf>
+				exit();
+  800453:	e8 73 07 00 00       	call   800bcb <exit>
+  800458:	83 c4 10             	add    $0x10,%esp
+				if (p[1] != 1) {
+  80045b:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  800461:	83 f8 01             	cmp    $0x1,%eax
+  800464:	0f 85 44 01 00 00    	jne    8005ae <runcmd+0x3ad>
+				close(p[0]);
+  80046a:	83 ec 0c             	sub    $0xc,%esp
+  80046d:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800473:	e8 4d 23 00 00       	call   8027c5 <close>
+				goto runit;
+  800478:	83 c4 10             	add    $0x10,%esp
+	if(argc == 0) {
+  80047b:	85 db                	test   %ebx,%ebx
+  80047d:	0f 84 5e 01 00 00    	je     8005e1 <runcmd+0x3e0>
+	if (argv[0][0] != '/') {
+  800483:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  800486:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800489:	0f 85 74 01 00 00    	jne    800603 <runcmd+0x402>
+	argv[argc] = 0;
+  80048f:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  800496:	00 
+	if (debug) {
+  800497:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80049e:	74 6b                	je     80050b <runcmd+0x30a>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8004a0:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8004a2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8004a7:	29 d0                	sub    %edx,%eax
+  8004a9:	89 c2                	mov    %eax,%edx
+  8004ab:	c1 ea 0f             	shr    $0xf,%edx
+  8004ae:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8004b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b8:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] SPAWN:", thisenv->env_id);
+  8004bb:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  8004c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8004c5:	83 ec 08             	sub    $0x8,%esp
+  8004c8:	50                   	push   %eax
+  8004c9:	68 8f 5a 80 00       	push   $0x805a8f
+  8004ce:	e8 ed 07 00 00       	call   800cc0 <cprintf>
+		for (i = 0; argv[i]; i++)
+  8004d3:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	85 c0                	test   %eax,%eax
+  8004db:	74 1e                	je     8004fb <runcmd+0x2fa>
+  8004dd:	8d 5d ac             	lea    -0x54(%ebp),%ebx
+			cprintf(" %s", argv[i]);
+  8004e0:	83 ec 08             	sub    $0x8,%esp
+  8004e3:	50                   	push   %eax
+  8004e4:	68 30 5b 80 00       	push   $0x805b30
+  8004e9:	e8 d2 07 00 00       	call   800cc0 <cprintf>
+		for (i = 0; argv[i]; i++)
+  8004ee:	83 c3 04             	add    $0x4,%ebx
+  8004f1:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  8004f4:	83 c4 10             	add    $0x10,%esp
+  8004f7:	85 c0                	test   %eax,%eax
+  8004f9:	75 e5                	jne    8004e0 <runcmd+0x2df>
+		cprintf("\n");
+  8004fb:	83 ec 0c             	sub    $0xc,%esp
+  8004fe:	68 e0 59 80 00       	push   $0x8059e0
+  800503:	e8 b8 07 00 00       	call   800cc0 <cprintf>
+  800508:	83 c4 10             	add    $0x10,%esp
+	if ((r = spawn(argv[0], (const char**) argv)) < 0)
+  80050b:	83 ec 08             	sub    $0x8,%esp
+  80050e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  800511:	50                   	push   %eax
+  800512:	ff 75 a8             	push   -0x58(%ebp)
+  800515:	e8 75 2b 00 00       	call   80308f <spawn>
+  80051a:	89 c3                	mov    %eax,%ebx
+  80051c:	83 c4 10             	add    $0x10,%esp
+  80051f:	85 c0                	test   %eax,%eax
+  800521:	0f 88 04 01 00 00    	js     80062b <runcmd+0x42a>
+	close_all();
+  800527:	e8 c6 22 00 00       	call   8027f2 <close_all>
+		if (debug)
+  80052c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800533:	0f 85 ab 01 00 00    	jne    8006e4 <runcmd+0x4e3>
+		wait(r);
+  800539:	83 ec 0c             	sub    $0xc,%esp
+  80053c:	53                   	push   %ebx
+  80053d:	e8 36 4b 00 00       	call   805078 <wait>
+		if (debug)
+  800542:	83 c4 10             	add    $0x10,%esp
+  800545:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80054c:	0f 84 ce 01 00 00    	je     800720 <runcmd+0x51f>
+  800552:	89 e2                	mov    %esp,%edx
+  800554:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800559:	29 d0                	sub    %edx,%eax
+  80055b:	89 c2                	mov    %eax,%edx
+  80055d:	c1 ea 0f             	shr    $0xf,%edx
+  800560:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800565:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056a:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80056d:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  800574:	8b 40 48             	mov    0x48(%eax),%eax
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	50                   	push   %eax
+  80057b:	68 c0 5a 80 00       	push   $0x805ac0
+  800580:	e8 3b 07 00 00       	call   800cc0 <cprintf>
+  800585:	83 c4 10             	add    $0x10,%esp
+  800588:	e9 b7 00 00 00       	jmp    800644 <runcmd+0x443>
+					dup(p[0], 0);
+  80058d:	83 ec 08             	sub    $0x8,%esp
+  800590:	6a 00                	push   $0x0
+  800592:	50                   	push   %eax
+  800593:	e8 82 22 00 00       	call   80281a <dup>
+					close(p[0]);
+  800598:	83 c4 04             	add    $0x4,%esp
+  80059b:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  8005a1:	e8 1f 22 00 00       	call   8027c5 <close>
+  8005a6:	83 c4 10             	add    $0x10,%esp
+  8005a9:	e9 3a fd ff ff       	jmp    8002e8 <runcmd+0xe7>
+					dup(p[1], 1);
+  8005ae:	83 ec 08             	sub    $0x8,%esp
+  8005b1:	6a 01                	push   $0x1
+  8005b3:	50                   	push   %eax
+  8005b4:	e8 61 22 00 00       	call   80281a <dup>
+					close(p[1]);
+  8005b9:	83 c4 04             	add    $0x4,%esp
+  8005bc:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8005c2:	e8 fe 21 00 00       	call   8027c5 <close>
+  8005c7:	83 c4 10             	add    $0x10,%esp
+  8005ca:	e9 9b fe ff ff       	jmp    80046a <runcmd+0x269>
+			panic("bad return %d from gettoken", c);
+  8005cf:	57                   	push   %edi
+  8005d0:	68 5a 5a 80 00       	push   $0x805a5a
+  8005d5:	6a 6e                	push   $0x6e
+  8005d7:	68 76 5a 80 00       	push   $0x805a76
+  8005dc:	e8 04 06 00 00       	call   800be5 <_panic>
+		if (debug)
+  8005e1:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8005e8:	0f 84 ee 00 00 00    	je     8006dc <runcmd+0x4db>
+			cprintf("EMPTY COMMAND\n");
+  8005ee:	83 ec 0c             	sub    $0xc,%esp
+  8005f1:	68 80 5a 80 00       	push   $0x805a80
+  8005f6:	e8 c5 06 00 00       	call   800cc0 <cprintf>
+  8005fb:	83 c4 10             	add    $0x10,%esp
+		return;
+  8005fe:	e9 d9 00 00 00       	jmp    8006dc <runcmd+0x4db>
+		argv0buf[0] = '/';
+  800603:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+		strcpy(argv0buf + 1, argv[0]);
+  80060a:	83 ec 08             	sub    $0x8,%esp
+  80060d:	50                   	push   %eax
+  80060e:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  800614:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  80061a:	50                   	push   %eax
+  80061b:	e8 87 0e 00 00       	call   8014a7 <strcpy>
+		argv[0] = argv0buf;
+  800620:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  800623:	83 c4 10             	add    $0x10,%esp
+  800626:	e9 64 fe ff ff       	jmp    80048f <runcmd+0x28e>
+		cprintf("spawn %s: %e\n", argv[0], r);
+  80062b:	83 ec 04             	sub    $0x4,%esp
+  80062e:	50                   	push   %eax
+  80062f:	ff 75 a8             	push   -0x58(%ebp)
+  800632:	68 9d 5a 80 00       	push   $0x805a9d
+  800637:	e8 84 06 00 00       	call   800cc0 <cprintf>
+	close_all();
+  80063c:	e8 b1 21 00 00       	call   8027f2 <close_all>
+	if (r >= 0) {
+  800641:	83 c4 10             	add    $0x10,%esp
+	if (pipe_child) {
+  800644:	85 ff                	test   %edi,%edi
+  800646:	0f 84 8b 00 00 00    	je     8006d7 <runcmd+0x4d6>
+		if (debug)
+  80064c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800653:	74 37                	je     80068c <runcmd+0x48b>
+  800655:	89 e2                	mov    %esp,%edx
+  800657:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80065c:	29 d0                	sub    %edx,%eax
+  80065e:	89 c2                	mov    %eax,%edx
+  800660:	c1 ea 0f             	shr    $0xf,%edx
+  800663:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066d:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  800670:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  800677:	8b 40 48             	mov    0x48(%eax),%eax
+  80067a:	83 ec 04             	sub    $0x4,%esp
+  80067d:	57                   	push   %edi
+  80067e:	50                   	push   %eax
+  80067f:	68 d6 5a 80 00       	push   $0x805ad6
+  800684:	e8 37 06 00 00       	call   800cc0 <cprintf>
+  800689:	83 c4 10             	add    $0x10,%esp
+		wait(pipe_child);
+  80068c:	83 ec 0c             	sub    $0xc,%esp
+  80068f:	57                   	push   %edi
+  800690:	e8 e3 49 00 00       	call   805078 <wait>
+		if (debug)
+  800695:	83 c4 10             	add    $0x10,%esp
+  800698:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80069f:	74 36                	je     8006d7 <runcmd+0x4d6>
+  8006a1:	89 e2                	mov    %esp,%edx
+  8006a3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8006a8:	29 d0                	sub    %edx,%eax
+  8006aa:	89 c2                	mov    %eax,%edx
+  8006ac:	c1 ea 0f             	shr    $0xf,%edx
+  8006af:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8006b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b9:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  8006bc:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  8006c3:	8b 40 48             	mov    0x48(%eax),%eax
+  8006c6:	83 ec 08             	sub    $0x8,%esp
+  8006c9:	50                   	push   %eax
+  8006ca:	68 c0 5a 80 00       	push   $0x805ac0
+  8006cf:	e8 ec 05 00 00       	call   800cc0 <cprintf>
+  8006d4:	83 c4 10             	add    $0x10,%esp
+	exit();
+  8006d7:	e8 ef 04 00 00       	call   800bcb <exit>
+}
+  8006dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006df:	5b                   	pop    %ebx
+  8006e0:	5e                   	pop    %esi
+  8006e1:	5f                   	pop    %edi
+  8006e2:	5d                   	pop    %ebp
+  8006e3:	c3                   	ret
+  8006e4:	89 e2                	mov    %esp,%edx
+  8006e6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8006eb:	29 d0                	sub    %edx,%eax
+  8006ed:	89 c2                	mov    %eax,%edx
+  8006ef:	c1 ea 0f             	shr    $0xf,%edx
+  8006f2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8006f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fc:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  8006ff:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  800706:	8b 40 48             	mov    0x48(%eax),%eax
+  800709:	53                   	push   %ebx
+  80070a:	ff 75 a8             	push   -0x58(%ebp)
+  80070d:	50                   	push   %eax
+  80070e:	68 ab 5a 80 00       	push   $0x805aab
+  800713:	e8 a8 05 00 00       	call   800cc0 <cprintf>
+  800718:	83 c4 10             	add    $0x10,%esp
+  80071b:	e9 19 fe ff ff       	jmp    800539 <runcmd+0x338>
+	if (pipe_child) {
+  800720:	85 ff                	test   %edi,%edi
+  800722:	0f 85 64 ff ff ff    	jne    80068c <runcmd+0x48b>
+  800728:	eb ad                	jmp    8006d7 <runcmd+0x4d6>
+
+0080072a <usage>:
+
+
+void
+usage(void)
+{
+  80072a:	55                   	push   %ebp
+  80072b:	89 e5                	mov    %esp,%ebp
+  80072d:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: sh [-dix] [command-file]\n");
+  800730:	68 cc 5b 80 00       	push   $0x805bcc
+  800735:	e8 86 05 00 00       	call   800cc0 <cprintf>
+	exit();
+  80073a:	e8 8c 04 00 00       	call   800bcb <exit>
+}
+  80073f:	83 c4 10             	add    $0x10,%esp
+  800742:	c9                   	leave
+  800743:	c3                   	ret
+
+00800744 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800744:	55                   	push   %ebp
+  800745:	89 e5                	mov    %esp,%ebp
+  800747:	57                   	push   %edi
+  800748:	56                   	push   %esi
+  800749:	53                   	push   %ebx
+  80074a:	83 ec 30             	sub    $0x30,%esp
+	int r, interactive, echocmds;
+	struct Argstate args;
+
+	interactive = '?';
+	echocmds = 0;
+	cprintf("argc = %d, argv[0] = %s\n", argc, argv[0]);
+  80074d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800750:	ff 30                	push   (%eax)
+  800752:	ff 75 08             	push   0x8(%ebp)
+  800755:	68 f3 5a 80 00       	push   $0x805af3
+  80075a:	e8 61 05 00 00       	call   800cc0 <cprintf>
+	argstart(&argc, argv, &args);
+  80075f:	83 c4 0c             	add    $0xc,%esp
+  800762:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800765:	50                   	push   %eax
+  800766:	ff 75 0c             	push   0xc(%ebp)
+  800769:	8d 45 08             	lea    0x8(%ebp),%eax
+  80076c:	50                   	push   %eax
+  80076d:	e8 48 1d 00 00       	call   8024ba <argstart>
+	while ((r = argnext(&args)) >= 0)
+  800772:	83 c4 10             	add    $0x10,%esp
+	echocmds = 0;
+  800775:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	interactive = '?';
+  80077c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+	while ((r = argnext(&args)) >= 0)
+  800781:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+		switch (r) {
+		case 'd':
+			debug++;
+			break;
+		case 'i':
+			interactive = 1;
+  800784:	be 01 00 00 00       	mov    $0x1,%esi
+	while ((r = argnext(&args)) >= 0)
+  800789:	eb 10                	jmp    80079b <umain+0x57>
+			debug++;
+  80078b:	83 05 00 70 80 00 01 	addl   $0x1,0x807000
+			break;
+  800792:	eb 07                	jmp    80079b <umain+0x57>
+			interactive = 1;
+  800794:	89 f7                	mov    %esi,%edi
+  800796:	eb 03                	jmp    80079b <umain+0x57>
+		switch (r) {
+  800798:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	while ((r = argnext(&args)) >= 0)
+  80079b:	83 ec 0c             	sub    $0xc,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	e8 46 1d 00 00       	call   8024ea <argnext>
+  8007a4:	83 c4 10             	add    $0x10,%esp
+  8007a7:	85 c0                	test   %eax,%eax
+  8007a9:	78 16                	js     8007c1 <umain+0x7d>
+		switch (r) {
+  8007ab:	83 f8 69             	cmp    $0x69,%eax
+  8007ae:	74 e4                	je     800794 <umain+0x50>
+  8007b0:	83 f8 78             	cmp    $0x78,%eax
+  8007b3:	74 e3                	je     800798 <umain+0x54>
+  8007b5:	83 f8 64             	cmp    $0x64,%eax
+  8007b8:	74 d1                	je     80078b <umain+0x47>
+			break;
+		case 'x':
+			echocmds = 1;
+			break;
+		default:
+			usage();
+  8007ba:	e8 6b ff ff ff       	call   80072a <usage>
+  8007bf:	eb da                	jmp    80079b <umain+0x57>
+		}
+
+	if (argc > 2)
+  8007c1:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8007c5:	7f 30                	jg     8007f7 <umain+0xb3>
+		usage();
+	if (argc == 2) {
+  8007c7:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8007cb:	74 31                	je     8007fe <umain+0xba>
+		close(0);
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+			panic("open %s: %e", argv[1], r);
+		assert(r == 0);
+	}
+	cprintf("interactive = %c\n", interactive);
+  8007cd:	83 ec 08             	sub    $0x8,%esp
+  8007d0:	57                   	push   %edi
+  8007d1:	68 34 5b 80 00       	push   $0x805b34
+  8007d6:	e8 e5 04 00 00       	call   800cc0 <cprintf>
+	if (interactive == '?')
+  8007db:	83 c4 10             	add    $0x10,%esp
+  8007de:	83 ff 3f             	cmp    $0x3f,%edi
+  8007e1:	74 75                	je     800858 <umain+0x114>
+  8007e3:	85 ff                	test   %edi,%edi
+  8007e5:	bf 46 5b 80 00       	mov    $0x805b46,%edi
+  8007ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ef:	0f 44 f8             	cmove  %eax,%edi
+  8007f2:	e9 06 01 00 00       	jmp    8008fd <umain+0x1b9>
+		usage();
+  8007f7:	e8 2e ff ff ff       	call   80072a <usage>
+  8007fc:	eb c9                	jmp    8007c7 <umain+0x83>
+		close(0);
+  8007fe:	83 ec 0c             	sub    $0xc,%esp
+  800801:	6a 00                	push   $0x0
+  800803:	e8 bd 1f 00 00       	call   8027c5 <close>
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+  800808:	83 c4 08             	add    $0x8,%esp
+  80080b:	6a 00                	push   $0x0
+  80080d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800810:	ff 70 04             	push   0x4(%eax)
+  800813:	e8 e5 25 00 00       	call   802dfd <open>
+  800818:	83 c4 10             	add    $0x10,%esp
+  80081b:	85 c0                	test   %eax,%eax
+  80081d:	78 1b                	js     80083a <umain+0xf6>
+		assert(r == 0);
+  80081f:	74 ac                	je     8007cd <umain+0x89>
+  800821:	68 18 5b 80 00       	push   $0x805b18
+  800826:	68 1f 5b 80 00       	push   $0x805b1f
+  80082b:	68 20 01 00 00       	push   $0x120
+  800830:	68 76 5a 80 00       	push   $0x805a76
+  800835:	e8 ab 03 00 00       	call   800be5 <_panic>
+			panic("open %s: %e", argv[1], r);
+  80083a:	83 ec 0c             	sub    $0xc,%esp
+  80083d:	50                   	push   %eax
+  80083e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800841:	ff 70 04             	push   0x4(%eax)
+  800844:	68 0c 5b 80 00       	push   $0x805b0c
+  800849:	68 1f 01 00 00       	push   $0x11f
+  80084e:	68 76 5a 80 00       	push   $0x805a76
+  800853:	e8 8d 03 00 00       	call   800be5 <_panic>
+		interactive = iscons(0);
+  800858:	83 ec 0c             	sub    $0xc,%esp
+  80085b:	6a 00                	push   $0x0
+  80085d:	e8 5e 02 00 00       	call   800ac0 <iscons>
+  800862:	89 c7                	mov    %eax,%edi
+  800864:	83 c4 10             	add    $0x10,%esp
+  800867:	e9 77 ff ff ff       	jmp    8007e3 <umain+0x9f>
+	while (1) {
+		char *buf;
+
+		buf = readline(interactive ? "$ " : NULL);
+		if (buf == NULL) {
+			if (debug)
+  80086c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800873:	75 0a                	jne    80087f <umain+0x13b>
+				cprintf("EXITING\n");
+			exit();	// end of file
+  800875:	e8 51 03 00 00       	call   800bcb <exit>
+  80087a:	e9 94 00 00 00       	jmp    800913 <umain+0x1cf>
+				cprintf("EXITING\n");
+  80087f:	83 ec 0c             	sub    $0xc,%esp
+  800882:	68 49 5b 80 00       	push   $0x805b49
+  800887:	e8 34 04 00 00       	call   800cc0 <cprintf>
+  80088c:	83 c4 10             	add    $0x10,%esp
+  80088f:	eb e4                	jmp    800875 <umain+0x131>
+		}
+		if (debug)
+			cprintf("LINE: %s\n", buf);
+  800891:	83 ec 08             	sub    $0x8,%esp
+  800894:	53                   	push   %ebx
+  800895:	68 52 5b 80 00       	push   $0x805b52
+  80089a:	e8 21 04 00 00       	call   800cc0 <cprintf>
+  80089f:	83 c4 10             	add    $0x10,%esp
+  8008a2:	eb 7c                	jmp    800920 <umain+0x1dc>
+		if (buf[0] == '#')
+			continue;
+		if (echocmds)
+			printf("# %s\n", buf);
+  8008a4:	83 ec 08             	sub    $0x8,%esp
+  8008a7:	53                   	push   %ebx
+  8008a8:	68 5c 5b 80 00       	push   $0x805b5c
+  8008ad:	e8 c7 27 00 00       	call   803079 <printf>
+  8008b2:	83 c4 10             	add    $0x10,%esp
+  8008b5:	eb 78                	jmp    80092f <umain+0x1eb>
+		if (debug)
+			cprintf("BEFORE FORK\n");
+  8008b7:	83 ec 0c             	sub    $0xc,%esp
+  8008ba:	68 62 5b 80 00       	push   $0x805b62
+  8008bf:	e8 fc 03 00 00       	call   800cc0 <cprintf>
+  8008c4:	83 c4 10             	add    $0x10,%esp
+  8008c7:	eb 73                	jmp    80093c <umain+0x1f8>
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  8008c9:	50                   	push   %eax
+  8008ca:	68 0d 60 80 00       	push   $0x80600d
+  8008cf:	68 38 01 00 00       	push   $0x138
+  8008d4:	68 76 5a 80 00       	push   $0x805a76
+  8008d9:	e8 07 03 00 00       	call   800be5 <_panic>
+		if (debug)
+			cprintf("FORK: %d\n", r);
+  8008de:	83 ec 08             	sub    $0x8,%esp
+  8008e1:	50                   	push   %eax
+  8008e2:	68 6f 5b 80 00       	push   $0x805b6f
+  8008e7:	e8 d4 03 00 00       	call   800cc0 <cprintf>
+  8008ec:	83 c4 10             	add    $0x10,%esp
+  8008ef:	eb 5f                	jmp    800950 <umain+0x20c>
+		if (r == 0) {
+			runcmd(buf);
+			exit();
+		} else
+			wait(r);
+  8008f1:	83 ec 0c             	sub    $0xc,%esp
+  8008f4:	56                   	push   %esi
+  8008f5:	e8 7e 47 00 00       	call   805078 <wait>
+  8008fa:	83 c4 10             	add    $0x10,%esp
+		buf = readline(interactive ? "$ " : NULL);
+  8008fd:	83 ec 0c             	sub    $0xc,%esp
+  800900:	57                   	push   %edi
+  800901:	e8 65 0a 00 00       	call   80136b <readline>
+  800906:	89 c3                	mov    %eax,%ebx
+		if (buf == NULL) {
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	85 c0                	test   %eax,%eax
+  80090d:	0f 84 59 ff ff ff    	je     80086c <umain+0x128>
+		if (debug)
+  800913:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80091a:	0f 85 71 ff ff ff    	jne    800891 <umain+0x14d>
+		if (buf[0] == '#')
+  800920:	80 3b 23             	cmpb   $0x23,(%ebx)
+  800923:	74 d8                	je     8008fd <umain+0x1b9>
+		if (echocmds)
+  800925:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800929:	0f 85 75 ff ff ff    	jne    8008a4 <umain+0x160>
+		if (debug)
+  80092f:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800936:	0f 85 7b ff ff ff    	jne    8008b7 <umain+0x173>
+		if ((r = fork()) < 0)
+  80093c:	e8 a2 15 00 00       	call   801ee3 <fork>
+  800941:	89 c6                	mov    %eax,%esi
+  800943:	85 c0                	test   %eax,%eax
+  800945:	78 82                	js     8008c9 <umain+0x185>
+		if (debug)
+  800947:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80094e:	75 8e                	jne    8008de <umain+0x19a>
+		if (r == 0) {
+  800950:	85 f6                	test   %esi,%esi
+  800952:	75 9d                	jne    8008f1 <umain+0x1ad>
+			runcmd(buf);
+  800954:	83 ec 0c             	sub    $0xc,%esp
+  800957:	53                   	push   %ebx
+  800958:	e8 a4 f8 ff ff       	call   800201 <runcmd>
+			exit();
+  80095d:	e8 69 02 00 00       	call   800bcb <exit>
+  800962:	83 c4 10             	add    $0x10,%esp
+  800965:	eb 96                	jmp    8008fd <umain+0x1b9>
+
+00800967 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096c:	c3                   	ret
+
+0080096d <devcons_poll>:
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	53                   	push   %ebx
+  800971:	83 ec 04             	sub    $0x4,%esp
+  800974:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  800977:	89 da                	mov    %ebx,%edx
+  800979:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80097c:	83 3d 10 80 80 00 00 	cmpl   $0x0,0x808010
+  800983:	74 0c                	je     800991 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  800985:	89 d8                	mov    %ebx,%eax
+  800987:	83 e0 01             	and    $0x1,%eax
+  80098a:	09 d0                	or     %edx,%eax
+}
+  80098c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098f:	c9                   	leave
+  800990:	c3                   	ret
+		cons_peek = sys_cgetc();
+  800991:	e8 a7 0e 00 00       	call   80183d <sys_cgetc>
+  800996:	a3 10 80 80 00       	mov    %eax,0x808010
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80099b:	89 da                	mov    %ebx,%edx
+  80099d:	83 e2 04             	and    $0x4,%edx
+  8009a0:	85 c0                	test   %eax,%eax
+  8009a2:	74 e6                	je     80098a <devcons_poll+0x1d>
+  8009a4:	eb df                	jmp    800985 <devcons_poll+0x18>
+
+008009a6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8009ac:	68 ed 5b 80 00       	push   $0x805bed
+  8009b1:	ff 75 0c             	push   0xc(%ebp)
+  8009b4:	e8 ee 0a 00 00       	call   8014a7 <strcpy>
+	return 0;
+}
+  8009b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009be:	c9                   	leave
+  8009bf:	c3                   	ret
+
+008009c0 <devcons_write>:
+{
+  8009c0:	55                   	push   %ebp
+  8009c1:	89 e5                	mov    %esp,%ebp
+  8009c3:	57                   	push   %edi
+  8009c4:	56                   	push   %esi
+  8009c5:	53                   	push   %ebx
+  8009c6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8009cc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8009cf:	85 ff                	test   %edi,%edi
+  8009d1:	74 51                	je     800a24 <devcons_write+0x64>
+  8009d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8009d8:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8009dd:	89 fb                	mov    %edi,%ebx
+  8009df:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8009e1:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8009e6:	39 d3                	cmp    %edx,%ebx
+  8009e8:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8009eb:	83 ec 04             	sub    $0x4,%esp
+  8009ee:	53                   	push   %ebx
+  8009ef:	03 45 0c             	add    0xc(%ebp),%eax
+  8009f2:	50                   	push   %eax
+  8009f3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8009f9:	50                   	push   %eax
+  8009fa:	e8 58 0c 00 00       	call   801657 <memmove>
+		sys_cputs(buf, m);
+  8009ff:	83 c4 08             	add    $0x8,%esp
+  800a02:	53                   	push   %ebx
+  800a03:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800a09:	50                   	push   %eax
+  800a0a:	e8 10 0e 00 00       	call   80181f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800a0f:	01 de                	add    %ebx,%esi
+  800a11:	89 f0                	mov    %esi,%eax
+  800a13:	83 c4 10             	add    $0x10,%esp
+  800a16:	39 fe                	cmp    %edi,%esi
+  800a18:	72 c3                	jb     8009dd <devcons_write+0x1d>
+}
+  800a1a:	89 f0                	mov    %esi,%eax
+  800a1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a1f:	5b                   	pop    %ebx
+  800a20:	5e                   	pop    %esi
+  800a21:	5f                   	pop    %edi
+  800a22:	5d                   	pop    %ebp
+  800a23:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  800a24:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  800a29:	eb ef                	jmp    800a1a <devcons_write+0x5a>
+
+00800a2b <devcons_read>:
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  800a31:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a36:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800a3a:	74 36                	je     800a72 <devcons_read+0x47>
+	c = cons_peek;
+  800a3c:	a1 10 80 80 00       	mov    0x808010,%eax
+	cons_peek = 0;
+  800a41:	c7 05 10 80 80 00 00 	movl   $0x0,0x808010
+  800a48:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  800a4b:	85 c0                	test   %eax,%eax
+  800a4d:	75 10                	jne    800a5f <devcons_read+0x34>
+  800a4f:	e8 e9 0d 00 00       	call   80183d <sys_cgetc>
+  800a54:	85 c0                	test   %eax,%eax
+  800a56:	75 07                	jne    800a5f <devcons_read+0x34>
+		sys_yield();
+  800a58:	e8 5f 0e 00 00       	call   8018bc <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  800a5d:	eb f0                	jmp    800a4f <devcons_read+0x24>
+	if (c < 0)
+  800a5f:	85 c0                	test   %eax,%eax
+  800a61:	78 0f                	js     800a72 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  800a63:	83 f8 04             	cmp    $0x4,%eax
+  800a66:	74 0c                	je     800a74 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  800a68:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a6b:	88 02                	mov    %al,(%edx)
+	return 1;
+  800a6d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800a72:	c9                   	leave
+  800a73:	c3                   	ret
+		return 0;
+  800a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a79:	eb f7                	jmp    800a72 <devcons_read+0x47>
+
+00800a7b <cputchar>:
+{
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a84:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  800a87:	6a 01                	push   $0x1
+  800a89:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800a8c:	50                   	push   %eax
+  800a8d:	e8 8d 0d 00 00       	call   80181f <sys_cputs>
+}
+  800a92:	83 c4 10             	add    $0x10,%esp
+  800a95:	c9                   	leave
+  800a96:	c3                   	ret
+
+00800a97 <getchar>:
+{
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  800a9d:	6a 01                	push   $0x1
+  800a9f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800aa2:	50                   	push   %eax
+  800aa3:	6a 00                	push   $0x0
+  800aa5:	e8 5a 1e 00 00       	call   802904 <read>
+	if (r < 0)
+  800aaa:	83 c4 10             	add    $0x10,%esp
+  800aad:	85 c0                	test   %eax,%eax
+  800aaf:	78 06                	js     800ab7 <getchar+0x20>
+	if (r < 1)
+  800ab1:	74 06                	je     800ab9 <getchar+0x22>
+	return c;
+  800ab3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800ab7:	c9                   	leave
+  800ab8:	c3                   	ret
+		return -E_EOF;
+  800ab9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800abe:	eb f7                	jmp    800ab7 <getchar+0x20>
+
+00800ac0 <iscons>:
+{
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ac6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ac9:	50                   	push   %eax
+  800aca:	ff 75 08             	push   0x8(%ebp)
+  800acd:	e8 ae 1b 00 00       	call   802680 <fd_lookup>
+  800ad2:	83 c4 10             	add    $0x10,%esp
+  800ad5:	85 c0                	test   %eax,%eax
+  800ad7:	78 11                	js     800aea <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800ad9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800adc:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  800ae2:	39 10                	cmp    %edx,(%eax)
+  800ae4:	0f 94 c0             	sete   %al
+  800ae7:	0f b6 c0             	movzbl %al,%eax
+}
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+
+00800aec <opencons>:
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800af2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800af5:	50                   	push   %eax
+  800af6:	e8 35 1b 00 00       	call   802630 <fd_alloc>
+  800afb:	83 c4 10             	add    $0x10,%esp
+  800afe:	85 c0                	test   %eax,%eax
+  800b00:	78 3a                	js     800b3c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800b02:	83 ec 04             	sub    $0x4,%esp
+  800b05:	68 07 04 00 00       	push   $0x407
+  800b0a:	ff 75 f4             	push   -0xc(%ebp)
+  800b0d:	6a 00                	push   $0x0
+  800b0f:	e8 c7 0d 00 00       	call   8018db <sys_page_alloc>
+  800b14:	83 c4 10             	add    $0x10,%esp
+  800b17:	85 c0                	test   %eax,%eax
+  800b19:	78 21                	js     800b3c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800b1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1e:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  800b24:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800b26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b29:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800b30:	83 ec 0c             	sub    $0xc,%esp
+  800b33:	50                   	push   %eax
+  800b34:	e8 d0 1a 00 00       	call   802609 <fd2num>
+  800b39:	83 c4 10             	add    $0x10,%esp
+}
+  800b3c:	c9                   	leave
+  800b3d:	c3                   	ret
+
+00800b3e <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	56                   	push   %esi
+  800b42:	53                   	push   %ebx
+  800b43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b46:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b49:	89 e2                	mov    %esp,%edx
+  800b4b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b50:	29 d0                	sub    %edx,%eax
+  800b52:	89 c2                	mov    %eax,%edx
+  800b54:	c1 ea 0f             	shr    $0xf,%edx
+  800b57:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b61:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800b64:	c7 04 85 60 94 80 00 	movl   $0x0,0x809460(,%eax,4)
+  800b6b:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800b6f:	e8 29 0d 00 00       	call   80189d <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800b74:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800b79:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800b7f:	89 e1                	mov    %esp,%ecx
+  800b81:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800b86:	29 ca                	sub    %ecx,%edx
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	c1 e9 0f             	shr    $0xf,%ecx
+  800b8d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b98:	0f 42 d1             	cmovb  %ecx,%edx
+  800b9b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800ba0:	89 04 95 60 94 80 00 	mov    %eax,0x809460(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800ba7:	85 db                	test   %ebx,%ebx
+  800ba9:	7e 07                	jle    800bb2 <libmain+0x74>
+		binaryname = argv[0];
+  800bab:	8b 06                	mov    (%esi),%eax
+  800bad:	a3 40 70 80 00       	mov    %eax,0x807040
+
+	// call user main routine
+	umain(argc, argv);
+  800bb2:	83 ec 08             	sub    $0x8,%esp
+  800bb5:	56                   	push   %esi
+  800bb6:	53                   	push   %ebx
+  800bb7:	e8 88 fb ff ff       	call   800744 <umain>
+
+	// exit gracefully
+	exit();
+  800bbc:	e8 0a 00 00 00       	call   800bcb <exit>
+}
+  800bc1:	83 c4 10             	add    $0x10,%esp
+  800bc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bc7:	5b                   	pop    %ebx
+  800bc8:	5e                   	pop    %esi
+  800bc9:	5d                   	pop    %ebp
+  800bca:	c3                   	ret
+
+00800bcb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800bd1:	e8 1c 1c 00 00       	call   8027f2 <close_all>
+	sys_env_destroy(0);
+  800bd6:	83 ec 0c             	sub    $0xc,%esp
+  800bd9:	6a 00                	push   $0x0
+  800bdb:	e8 7c 0c 00 00       	call   80185c <sys_env_destroy>
+}
+  800be0:	83 c4 10             	add    $0x10,%esp
+  800be3:	c9                   	leave
+  800be4:	c3                   	ret
+
+00800be5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	56                   	push   %esi
+  800be9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800bea:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800bed:	8b 35 40 70 80 00    	mov    0x807040,%esi
+  800bf3:	e8 a5 0c 00 00       	call   80189d <sys_getenvid>
+  800bf8:	83 ec 0c             	sub    $0xc,%esp
+  800bfb:	ff 75 0c             	push   0xc(%ebp)
+  800bfe:	ff 75 08             	push   0x8(%ebp)
+  800c01:	56                   	push   %esi
+  800c02:	50                   	push   %eax
+  800c03:	68 04 5c 80 00       	push   $0x805c04
+  800c08:	e8 b3 00 00 00       	call   800cc0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800c0d:	83 c4 18             	add    $0x18,%esp
+  800c10:	53                   	push   %ebx
+  800c11:	ff 75 10             	push   0x10(%ebp)
+  800c14:	e8 56 00 00 00       	call   800c6f <vcprintf>
+	cprintf("\n");
+  800c19:	c7 04 24 e0 59 80 00 	movl   $0x8059e0,(%esp)
+  800c20:	e8 9b 00 00 00       	call   800cc0 <cprintf>
+  800c25:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800c28:	cc                   	int3
+	while (1)
+  800c29:	eb fd                	jmp    800c28 <_panic+0x43>
+
+00800c2b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	53                   	push   %ebx
+  800c2f:	83 ec 04             	sub    $0x4,%esp
+  800c32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800c35:	8b 13                	mov    (%ebx),%edx
+  800c37:	8d 42 01             	lea    0x1(%edx),%eax
+  800c3a:	89 03                	mov    %eax,(%ebx)
+  800c3c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c3f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800c43:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c48:	74 09                	je     800c53 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800c4a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800c4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c51:	c9                   	leave
+  800c52:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800c53:	83 ec 08             	sub    $0x8,%esp
+  800c56:	68 ff 00 00 00       	push   $0xff
+  800c5b:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c5e:	50                   	push   %eax
+  800c5f:	e8 bb 0b 00 00       	call   80181f <sys_cputs>
+		b->idx = 0;
+  800c64:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c6a:	83 c4 10             	add    $0x10,%esp
+  800c6d:	eb db                	jmp    800c4a <putch+0x1f>
+
+00800c6f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800c78:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c7f:	00 00 00 
+	b.cnt = 0;
+  800c82:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c89:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800c8c:	ff 75 0c             	push   0xc(%ebp)
+  800c8f:	ff 75 08             	push   0x8(%ebp)
+  800c92:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c98:	50                   	push   %eax
+  800c99:	68 2b 0c 80 00       	push   $0x800c2b
+  800c9e:	e8 1c 01 00 00       	call   800dbf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800ca3:	83 c4 08             	add    $0x8,%esp
+  800ca6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800cac:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800cb2:	50                   	push   %eax
+  800cb3:	e8 67 0b 00 00       	call   80181f <sys_cputs>
+
+	return b.cnt;
+}
+  800cb8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800cbe:	c9                   	leave
+  800cbf:	c3                   	ret
+
+00800cc0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800cc6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800cc9:	50                   	push   %eax
+  800cca:	ff 75 08             	push   0x8(%ebp)
+  800ccd:	e8 9d ff ff ff       	call   800c6f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800cd2:	c9                   	leave
+  800cd3:	c3                   	ret
+
+00800cd4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	57                   	push   %edi
+  800cd8:	56                   	push   %esi
+  800cd9:	53                   	push   %ebx
+  800cda:	83 ec 1c             	sub    $0x1c,%esp
+  800cdd:	89 c3                	mov    %eax,%ebx
+  800cdf:	89 d6                	mov    %edx,%esi
+  800ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ce7:	89 d1                	mov    %edx,%ecx
+  800ce9:	89 c2                	mov    %eax,%edx
+  800ceb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cee:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cf1:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800cf4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cf7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cfe:	39 c2                	cmp    %eax,%edx
+  800d00:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800d03:	73 4b                	jae    800d50 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800d05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d08:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800d0b:	85 ff                	test   %edi,%edi
+  800d0d:	7e 11                	jle    800d20 <printnum+0x4c>
+			putch(padc, putdat);
+  800d0f:	83 ec 08             	sub    $0x8,%esp
+  800d12:	56                   	push   %esi
+  800d13:	ff 75 18             	push   0x18(%ebp)
+  800d16:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800d18:	83 c4 10             	add    $0x10,%esp
+  800d1b:	83 ef 01             	sub    $0x1,%edi
+  800d1e:	75 ef                	jne    800d0f <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800d20:	83 ec 08             	sub    $0x8,%esp
+  800d23:	56                   	push   %esi
+  800d24:	83 ec 04             	sub    $0x4,%esp
+  800d27:	ff 75 e4             	push   -0x1c(%ebp)
+  800d2a:	ff 75 e0             	push   -0x20(%ebp)
+  800d2d:	ff 75 dc             	push   -0x24(%ebp)
+  800d30:	ff 75 d8             	push   -0x28(%ebp)
+  800d33:	e8 6b 4b 00 00       	call   8058a3 <__umoddi3>
+  800d38:	83 c4 14             	add    $0x14,%esp
+  800d3b:	0f be 80 27 5c 80 00 	movsbl 0x805c27(%eax),%eax
+  800d42:	50                   	push   %eax
+  800d43:	ff d3                	call   *%ebx
+}
+  800d45:	83 c4 10             	add    $0x10,%esp
+  800d48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800d50:	83 ec 0c             	sub    $0xc,%esp
+  800d53:	ff 75 18             	push   0x18(%ebp)
+  800d56:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d59:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800d5c:	52                   	push   %edx
+  800d5d:	50                   	push   %eax
+  800d5e:	83 ec 08             	sub    $0x8,%esp
+  800d61:	ff 75 e4             	push   -0x1c(%ebp)
+  800d64:	ff 75 e0             	push   -0x20(%ebp)
+  800d67:	ff 75 dc             	push   -0x24(%ebp)
+  800d6a:	ff 75 d8             	push   -0x28(%ebp)
+  800d6d:	e8 6b 4a 00 00       	call   8057dd <__udivdi3>
+  800d72:	83 c4 18             	add    $0x18,%esp
+  800d75:	52                   	push   %edx
+  800d76:	50                   	push   %eax
+  800d77:	89 f2                	mov    %esi,%edx
+  800d79:	89 d8                	mov    %ebx,%eax
+  800d7b:	e8 54 ff ff ff       	call   800cd4 <printnum>
+  800d80:	83 c4 20             	add    $0x20,%esp
+  800d83:	eb 9b                	jmp    800d20 <printnum+0x4c>
+
+00800d85 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800d85:	55                   	push   %ebp
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800d8b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800d8f:	8b 10                	mov    (%eax),%edx
+  800d91:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d94:	73 0a                	jae    800da0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800d96:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d99:	89 08                	mov    %ecx,(%eax)
+  800d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9e:	88 02                	mov    %al,(%edx)
+}
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+
+00800da2 <printfmt>:
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800da8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800dab:	50                   	push   %eax
+  800dac:	ff 75 10             	push   0x10(%ebp)
+  800daf:	ff 75 0c             	push   0xc(%ebp)
+  800db2:	ff 75 08             	push   0x8(%ebp)
+  800db5:	e8 05 00 00 00       	call   800dbf <vprintfmt>
+}
+  800dba:	83 c4 10             	add    $0x10,%esp
+  800dbd:	c9                   	leave
+  800dbe:	c3                   	ret
+
+00800dbf <vprintfmt>:
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+  800dc5:	83 ec 2c             	sub    $0x2c,%esp
+  800dc8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dcb:	89 df                	mov    %ebx,%edi
+  800dcd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800dd0:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dd3:	8d 70 01             	lea    0x1(%eax),%esi
+  800dd6:	0f b6 00             	movzbl (%eax),%eax
+  800dd9:	83 f8 25             	cmp    $0x25,%eax
+  800ddc:	74 1e                	je     800dfc <vprintfmt+0x3d>
+			if (ch == '\0')
+  800dde:	85 c0                	test   %eax,%eax
+  800de0:	0f 84 15 05 00 00    	je     8012fb <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800de6:	83 ec 08             	sub    $0x8,%esp
+  800de9:	53                   	push   %ebx
+  800dea:	50                   	push   %eax
+  800deb:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ded:	83 c6 01             	add    $0x1,%esi
+  800df0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800df4:	83 c4 10             	add    $0x10,%esp
+  800df7:	83 f8 25             	cmp    $0x25,%eax
+  800dfa:	75 e2                	jne    800dde <vprintfmt+0x1f>
+		padc = ' ';
+  800dfc:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800e00:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800e07:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800e0e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800e15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800e1d:	8d 56 01             	lea    0x1(%esi),%edx
+  800e20:	0f b6 0e             	movzbl (%esi),%ecx
+  800e23:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800e26:	3c 55                	cmp    $0x55,%al
+  800e28:	0f 87 3b 04 00 00    	ja     801269 <vprintfmt+0x4aa>
+  800e2e:	0f b6 c0             	movzbl %al,%eax
+  800e31:	ff 24 85 a0 5d 80 00 	jmp    *0x805da0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e38:	89 75 10             	mov    %esi,0x10(%ebp)
+  800e3b:	eb 93                	jmp    800dd0 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800e3d:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800e3f:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800e43:	eb d8                	jmp    800e1d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800e45:	89 d6                	mov    %edx,%esi
+  800e47:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800e4b:	eb d0                	jmp    800e1d <vprintfmt+0x5e>
+  800e4d:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800e50:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800e53:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800e56:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800e5a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800e5d:	83 f9 09             	cmp    $0x9,%ecx
+  800e60:	77 6f                	ja     800ed1 <vprintfmt+0x112>
+  800e62:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800e65:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800e68:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800e6b:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800e6f:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800e72:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e75:	83 fe 09             	cmp    $0x9,%esi
+  800e78:	76 eb                	jbe    800e65 <vprintfmt+0xa6>
+  800e7a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800e7d:	89 d6                	mov    %edx,%esi
+  800e7f:	eb 13                	jmp    800e94 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800e81:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e84:	8b 00                	mov    (%eax),%eax
+  800e86:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800e89:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e8c:	8d 40 04             	lea    0x4(%eax),%eax
+  800e8f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800e92:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800e94:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800e98:	79 83                	jns    800e1d <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800e9a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800e9d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ea0:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800ea7:	e9 71 ff ff ff       	jmp    800e1d <vprintfmt+0x5e>
+			if (width < 0)
+  800eac:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800eaf:	85 c9                	test   %ecx,%ecx
+  800eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb6:	0f 49 c1             	cmovns %ecx,%eax
+  800eb9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800ebc:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800ebe:	e9 5a ff ff ff       	jmp    800e1d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800ec3:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800ec5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800ecc:	e9 4c ff ff ff       	jmp    800e1d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800ed1:	89 d6                	mov    %edx,%esi
+  800ed3:	eb bf                	jmp    800e94 <vprintfmt+0xd5>
+			lflag++;
+  800ed5:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800ed9:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800edb:	e9 3d ff ff ff       	jmp    800e1d <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800ee0:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ee3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ee6:	8d 70 04             	lea    0x4(%eax),%esi
+  800ee9:	83 ec 08             	sub    $0x8,%esp
+  800eec:	53                   	push   %ebx
+  800eed:	ff 30                	push   (%eax)
+  800eef:	ff d7                	call   *%edi
+			break;
+  800ef1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800ef4:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800ef7:	e9 d4 fe ff ff       	jmp    800dd0 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800efc:	89 55 10             	mov    %edx,0x10(%ebp)
+  800eff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f02:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800f05:	8b 10                	mov    (%eax),%edx
+  800f07:	89 d0                	mov    %edx,%eax
+  800f09:	f7 d8                	neg    %eax
+  800f0b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800f0e:	83 f8 12             	cmp    $0x12,%eax
+  800f11:	7f 23                	jg     800f36 <vprintfmt+0x177>
+  800f13:	8b 14 85 00 5f 80 00 	mov    0x805f00(,%eax,4),%edx
+  800f1a:	85 d2                	test   %edx,%edx
+  800f1c:	74 18                	je     800f36 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800f1e:	52                   	push   %edx
+  800f1f:	68 31 5b 80 00       	push   $0x805b31
+  800f24:	53                   	push   %ebx
+  800f25:	57                   	push   %edi
+  800f26:	e8 77 fe ff ff       	call   800da2 <printfmt>
+  800f2b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800f2e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800f31:	e9 9a fe ff ff       	jmp    800dd0 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800f36:	50                   	push   %eax
+  800f37:	68 3f 5c 80 00       	push   $0x805c3f
+  800f3c:	53                   	push   %ebx
+  800f3d:	57                   	push   %edi
+  800f3e:	e8 5f fe ff ff       	call   800da2 <printfmt>
+  800f43:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800f46:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800f49:	e9 82 fe ff ff       	jmp    800dd0 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800f4e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800f51:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f54:	83 c0 04             	add    $0x4,%eax
+  800f57:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f5d:	8b 00                	mov    (%eax),%eax
+  800f5f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800f62:	85 c0                	test   %eax,%eax
+  800f64:	0f 84 61 03 00 00    	je     8012cb <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800f6a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800f6e:	7e 06                	jle    800f76 <vprintfmt+0x1b7>
+  800f70:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800f74:	75 29                	jne    800f9f <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f76:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800f79:	8d 70 01             	lea    0x1(%eax),%esi
+  800f7c:	0f b6 00             	movzbl (%eax),%eax
+  800f7f:	0f be d0             	movsbl %al,%edx
+  800f82:	85 d2                	test   %edx,%edx
+  800f84:	0f 84 bb 00 00 00    	je     801045 <vprintfmt+0x286>
+  800f8a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800f8d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800f90:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800f93:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800f96:	eb 7a                	jmp    801012 <vprintfmt+0x253>
+				p = "(null)";
+  800f98:	c7 45 d0 38 5c 80 00 	movl   $0x805c38,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f9f:	83 ec 08             	sub    $0x8,%esp
+  800fa2:	ff 75 d4             	push   -0x2c(%ebp)
+  800fa5:	ff 75 d0             	push   -0x30(%ebp)
+  800fa8:	e8 d0 04 00 00       	call   80147d <strnlen>
+  800fad:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800fb0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800fb3:	83 c4 10             	add    $0x10,%esp
+  800fb6:	85 d2                	test   %edx,%edx
+  800fb8:	0f 8e d6 02 00 00    	jle    801294 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800fbe:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800fc2:	83 ec 08             	sub    $0x8,%esp
+  800fc5:	53                   	push   %ebx
+  800fc6:	56                   	push   %esi
+  800fc7:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fc9:	83 c4 10             	add    $0x10,%esp
+  800fcc:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800fd0:	75 f0                	jne    800fc2 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800fd2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fd5:	8d 70 01             	lea    0x1(%eax),%esi
+  800fd8:	0f b6 00             	movzbl (%eax),%eax
+  800fdb:	0f be d0             	movsbl %al,%edx
+  800fde:	85 d2                	test   %edx,%edx
+  800fe0:	0f 84 da 02 00 00    	je     8012c0 <vprintfmt+0x501>
+  800fe6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800fe9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800fec:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800fef:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ff2:	eb 1e                	jmp    801012 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800ff4:	83 ec 08             	sub    $0x8,%esp
+  800ff7:	ff 75 0c             	push   0xc(%ebp)
+  800ffa:	52                   	push   %edx
+  800ffb:	ff 55 08             	call   *0x8(%ebp)
+  800ffe:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801001:	83 eb 01             	sub    $0x1,%ebx
+  801004:	83 c6 01             	add    $0x1,%esi
+  801007:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80100b:	0f be d0             	movsbl %al,%edx
+  80100e:	85 d2                	test   %edx,%edx
+  801010:	74 2a                	je     80103c <vprintfmt+0x27d>
+  801012:	85 ff                	test   %edi,%edi
+  801014:	78 05                	js     80101b <vprintfmt+0x25c>
+  801016:	83 ef 01             	sub    $0x1,%edi
+  801019:	78 59                	js     801074 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80101b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80101f:	74 d3                	je     800ff4 <vprintfmt+0x235>
+  801021:	0f be c0             	movsbl %al,%eax
+  801024:	83 e8 20             	sub    $0x20,%eax
+  801027:	83 f8 5e             	cmp    $0x5e,%eax
+  80102a:	76 c8                	jbe    800ff4 <vprintfmt+0x235>
+					putch('?', putdat);
+  80102c:	83 ec 08             	sub    $0x8,%esp
+  80102f:	ff 75 0c             	push   0xc(%ebp)
+  801032:	6a 3f                	push   $0x3f
+  801034:	ff 55 08             	call   *0x8(%ebp)
+  801037:	83 c4 10             	add    $0x10,%esp
+  80103a:	eb c5                	jmp    801001 <vprintfmt+0x242>
+  80103c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80103f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801042:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  801045:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801048:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80104c:	7e 1b                	jle    801069 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80104e:	83 ec 08             	sub    $0x8,%esp
+  801051:	53                   	push   %ebx
+  801052:	6a 20                	push   $0x20
+  801054:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  801056:	83 c4 10             	add    $0x10,%esp
+  801059:	83 ee 01             	sub    $0x1,%esi
+  80105c:	75 f0                	jne    80104e <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80105e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801061:	89 45 14             	mov    %eax,0x14(%ebp)
+  801064:	e9 67 fd ff ff       	jmp    800dd0 <vprintfmt+0x11>
+  801069:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80106c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80106f:	e9 5c fd ff ff       	jmp    800dd0 <vprintfmt+0x11>
+  801074:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  801077:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80107a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80107d:	eb c6                	jmp    801045 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80107f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801082:	89 55 10             	mov    %edx,0x10(%ebp)
+  801085:	83 f9 01             	cmp    $0x1,%ecx
+  801088:	7f 1f                	jg     8010a9 <vprintfmt+0x2ea>
+	else if (lflag)
+  80108a:	85 c9                	test   %ecx,%ecx
+  80108c:	74 67                	je     8010f5 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80108e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801091:	8b 30                	mov    (%eax),%esi
+  801093:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801096:	89 f0                	mov    %esi,%eax
+  801098:	c1 f8 1f             	sar    $0x1f,%eax
+  80109b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80109e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8010a4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010a7:	eb 17                	jmp    8010c0 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8010a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ac:	8b 50 04             	mov    0x4(%eax),%edx
+  8010af:	8b 00                	mov    (%eax),%eax
+  8010b1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8010b4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8010b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8010bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8010c0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8010c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8010c6:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8010cb:	85 c9                	test   %ecx,%ecx
+  8010cd:	0f 89 12 01 00 00    	jns    8011e5 <vprintfmt+0x426>
+				putch('-', putdat);
+  8010d3:	83 ec 08             	sub    $0x8,%esp
+  8010d6:	53                   	push   %ebx
+  8010d7:	6a 2d                	push   $0x2d
+  8010d9:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8010db:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8010de:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8010e1:	f7 da                	neg    %edx
+  8010e3:	83 d1 00             	adc    $0x0,%ecx
+  8010e6:	f7 d9                	neg    %ecx
+  8010e8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8010eb:	be 0a 00 00 00       	mov    $0xa,%esi
+  8010f0:	e9 f0 00 00 00       	jmp    8011e5 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8010f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010f8:	8b 30                	mov    (%eax),%esi
+  8010fa:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8010fd:	89 f0                	mov    %esi,%eax
+  8010ff:	c1 f8 1f             	sar    $0x1f,%eax
+  801102:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801105:	8b 45 14             	mov    0x14(%ebp),%eax
+  801108:	8d 40 04             	lea    0x4(%eax),%eax
+  80110b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80110e:	eb b0                	jmp    8010c0 <vprintfmt+0x301>
+	if (lflag >= 2)
+  801110:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801113:	89 55 10             	mov    %edx,0x10(%ebp)
+  801116:	83 f9 01             	cmp    $0x1,%ecx
+  801119:	7f 1e                	jg     801139 <vprintfmt+0x37a>
+	else if (lflag)
+  80111b:	85 c9                	test   %ecx,%ecx
+  80111d:	74 32                	je     801151 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80111f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801122:	8b 10                	mov    (%eax),%edx
+  801124:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801129:	8d 40 04             	lea    0x4(%eax),%eax
+  80112c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80112f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  801134:	e9 ac 00 00 00       	jmp    8011e5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  801139:	8b 45 14             	mov    0x14(%ebp),%eax
+  80113c:	8b 10                	mov    (%eax),%edx
+  80113e:	8b 48 04             	mov    0x4(%eax),%ecx
+  801141:	8d 40 08             	lea    0x8(%eax),%eax
+  801144:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801147:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80114c:	e9 94 00 00 00       	jmp    8011e5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  801151:	8b 45 14             	mov    0x14(%ebp),%eax
+  801154:	8b 10                	mov    (%eax),%edx
+  801156:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80115b:	8d 40 04             	lea    0x4(%eax),%eax
+  80115e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801161:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  801166:	eb 7d                	jmp    8011e5 <vprintfmt+0x426>
+	if (lflag >= 2)
+  801168:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80116b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80116e:	83 f9 01             	cmp    $0x1,%ecx
+  801171:	7f 1b                	jg     80118e <vprintfmt+0x3cf>
+	else if (lflag)
+  801173:	85 c9                	test   %ecx,%ecx
+  801175:	74 2c                	je     8011a3 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  801177:	8b 45 14             	mov    0x14(%ebp),%eax
+  80117a:	8b 10                	mov    (%eax),%edx
+  80117c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801181:	8d 40 04             	lea    0x4(%eax),%eax
+  801184:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801187:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80118c:	eb 57                	jmp    8011e5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80118e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801191:	8b 10                	mov    (%eax),%edx
+  801193:	8b 48 04             	mov    0x4(%eax),%ecx
+  801196:	8d 40 08             	lea    0x8(%eax),%eax
+  801199:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80119c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8011a1:	eb 42                	jmp    8011e5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8011a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011a6:	8b 10                	mov    (%eax),%edx
+  8011a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8011b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8011b3:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8011b8:	eb 2b                	jmp    8011e5 <vprintfmt+0x426>
+			putch('0', putdat);
+  8011ba:	89 55 10             	mov    %edx,0x10(%ebp)
+  8011bd:	83 ec 08             	sub    $0x8,%esp
+  8011c0:	53                   	push   %ebx
+  8011c1:	6a 30                	push   $0x30
+  8011c3:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8011c5:	83 c4 08             	add    $0x8,%esp
+  8011c8:	53                   	push   %ebx
+  8011c9:	6a 78                	push   $0x78
+  8011cb:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8011cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011d0:	8b 10                	mov    (%eax),%edx
+  8011d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8011d7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8011da:	8d 40 04             	lea    0x4(%eax),%eax
+  8011dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8011e0:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8011e5:	83 ec 0c             	sub    $0xc,%esp
+  8011e8:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8011ec:	50                   	push   %eax
+  8011ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8011f0:	56                   	push   %esi
+  8011f1:	51                   	push   %ecx
+  8011f2:	52                   	push   %edx
+  8011f3:	89 da                	mov    %ebx,%edx
+  8011f5:	89 f8                	mov    %edi,%eax
+  8011f7:	e8 d8 fa ff ff       	call   800cd4 <printnum>
+			break;
+  8011fc:	83 c4 20             	add    $0x20,%esp
+  8011ff:	e9 cc fb ff ff       	jmp    800dd0 <vprintfmt+0x11>
+	if (lflag >= 2)
+  801204:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801207:	89 55 10             	mov    %edx,0x10(%ebp)
+  80120a:	83 f9 01             	cmp    $0x1,%ecx
+  80120d:	7f 1b                	jg     80122a <vprintfmt+0x46b>
+	else if (lflag)
+  80120f:	85 c9                	test   %ecx,%ecx
+  801211:	74 2c                	je     80123f <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  801213:	8b 45 14             	mov    0x14(%ebp),%eax
+  801216:	8b 10                	mov    (%eax),%edx
+  801218:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80121d:	8d 40 04             	lea    0x4(%eax),%eax
+  801220:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801223:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  801228:	eb bb                	jmp    8011e5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80122a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80122d:	8b 10                	mov    (%eax),%edx
+  80122f:	8b 48 04             	mov    0x4(%eax),%ecx
+  801232:	8d 40 08             	lea    0x8(%eax),%eax
+  801235:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801238:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80123d:	eb a6                	jmp    8011e5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80123f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801242:	8b 10                	mov    (%eax),%edx
+  801244:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801249:	8d 40 04             	lea    0x4(%eax),%eax
+  80124c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80124f:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  801254:	eb 8f                	jmp    8011e5 <vprintfmt+0x426>
+			putch(ch, putdat);
+  801256:	89 55 10             	mov    %edx,0x10(%ebp)
+  801259:	83 ec 08             	sub    $0x8,%esp
+  80125c:	53                   	push   %ebx
+  80125d:	6a 25                	push   $0x25
+  80125f:	ff d7                	call   *%edi
+			break;
+  801261:	83 c4 10             	add    $0x10,%esp
+  801264:	e9 67 fb ff ff       	jmp    800dd0 <vprintfmt+0x11>
+			putch('%', putdat);
+  801269:	83 ec 08             	sub    $0x8,%esp
+  80126c:	53                   	push   %ebx
+  80126d:	6a 25                	push   $0x25
+  80126f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801271:	83 c4 10             	add    $0x10,%esp
+  801274:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  801278:	0f 84 ba fb ff ff    	je     800e38 <vprintfmt+0x79>
+  80127e:	89 75 10             	mov    %esi,0x10(%ebp)
+  801281:	89 f0                	mov    %esi,%eax
+  801283:	83 e8 01             	sub    $0x1,%eax
+  801286:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80128a:	75 f7                	jne    801283 <vprintfmt+0x4c4>
+  80128c:	89 45 10             	mov    %eax,0x10(%ebp)
+  80128f:	e9 3c fb ff ff       	jmp    800dd0 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801294:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801297:	8d 70 01             	lea    0x1(%eax),%esi
+  80129a:	0f b6 00             	movzbl (%eax),%eax
+  80129d:	0f be d0             	movsbl %al,%edx
+  8012a0:	85 d2                	test   %edx,%edx
+  8012a2:	74 11                	je     8012b5 <vprintfmt+0x4f6>
+  8012a4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8012a7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8012aa:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8012ad:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8012b0:	e9 5d fd ff ff       	jmp    801012 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8012b5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8012b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8012bb:	e9 10 fb ff ff       	jmp    800dd0 <vprintfmt+0x11>
+  8012c0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8012c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8012c6:	e9 05 fb ff ff       	jmp    800dd0 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8012cb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8012cf:	7e 0a                	jle    8012db <vprintfmt+0x51c>
+  8012d1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8012d5:	0f 85 bd fc ff ff    	jne    800f98 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8012db:	ba 28 00 00 00       	mov    $0x28,%edx
+  8012e0:	b8 28 00 00 00       	mov    $0x28,%eax
+  8012e5:	be 39 5c 80 00       	mov    $0x805c39,%esi
+  8012ea:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8012ed:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8012f0:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8012f3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8012f6:	e9 17 fd ff ff       	jmp    801012 <vprintfmt+0x253>
+}
+  8012fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fe:	5b                   	pop    %ebx
+  8012ff:	5e                   	pop    %esi
+  801300:	5f                   	pop    %edi
+  801301:	5d                   	pop    %ebp
+  801302:	c3                   	ret
+
+00801303 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	83 ec 18             	sub    $0x18,%esp
+  801309:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80130f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801312:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801316:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801319:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801320:	85 c0                	test   %eax,%eax
+  801322:	74 26                	je     80134a <vsnprintf+0x47>
+  801324:	85 d2                	test   %edx,%edx
+  801326:	7e 22                	jle    80134a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801328:	ff 75 14             	push   0x14(%ebp)
+  80132b:	ff 75 10             	push   0x10(%ebp)
+  80132e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801331:	50                   	push   %eax
+  801332:	68 85 0d 80 00       	push   $0x800d85
+  801337:	e8 83 fa ff ff       	call   800dbf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80133c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80133f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801342:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801345:	83 c4 10             	add    $0x10,%esp
+}
+  801348:	c9                   	leave
+  801349:	c3                   	ret
+		return -E_INVAL;
+  80134a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134f:	eb f7                	jmp    801348 <vsnprintf+0x45>
+
+00801351 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801357:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80135a:	50                   	push   %eax
+  80135b:	ff 75 10             	push   0x10(%ebp)
+  80135e:	ff 75 0c             	push   0xc(%ebp)
+  801361:	ff 75 08             	push   0x8(%ebp)
+  801364:	e8 9a ff ff ff       	call   801303 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801369:	c9                   	leave
+  80136a:	c3                   	ret
+
+0080136b <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  80136b:	55                   	push   %ebp
+  80136c:	89 e5                	mov    %esp,%ebp
+  80136e:	57                   	push   %edi
+  80136f:	56                   	push   %esi
+  801370:	53                   	push   %ebx
+  801371:	83 ec 0c             	sub    $0xc,%esp
+  801374:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  801377:	85 c0                	test   %eax,%eax
+  801379:	74 13                	je     80138e <readline+0x23>
+		fprintf(1, "%s", prompt);
+  80137b:	83 ec 04             	sub    $0x4,%esp
+  80137e:	50                   	push   %eax
+  80137f:	68 31 5b 80 00       	push   $0x805b31
+  801384:	6a 01                	push   $0x1
+  801386:	e8 d7 1c 00 00       	call   803062 <fprintf>
+  80138b:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  80138e:	83 ec 0c             	sub    $0xc,%esp
+  801391:	6a 00                	push   $0x0
+  801393:	e8 28 f7 ff ff       	call   800ac0 <iscons>
+  801398:	89 c7                	mov    %eax,%edi
+  80139a:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  80139d:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a2:	eb 4b                	jmp    8013ef <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  8013a4:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  8013a9:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  8013ac:	75 08                	jne    8013b6 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  8013ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b1:	5b                   	pop    %ebx
+  8013b2:	5e                   	pop    %esi
+  8013b3:	5f                   	pop    %edi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  8013b6:	83 ec 08             	sub    $0x8,%esp
+  8013b9:	53                   	push   %ebx
+  8013ba:	68 6b 5f 80 00       	push   $0x805f6b
+  8013bf:	e8 fc f8 ff ff       	call   800cc0 <cprintf>
+  8013c4:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  8013c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cc:	eb e0                	jmp    8013ae <readline+0x43>
+			if (echoing)
+  8013ce:	85 ff                	test   %edi,%edi
+  8013d0:	75 05                	jne    8013d7 <readline+0x6c>
+			i--;
+  8013d2:	83 ee 01             	sub    $0x1,%esi
+  8013d5:	eb 18                	jmp    8013ef <readline+0x84>
+				cputchar('\b');
+  8013d7:	83 ec 0c             	sub    $0xc,%esp
+  8013da:	6a 08                	push   $0x8
+  8013dc:	e8 9a f6 ff ff       	call   800a7b <cputchar>
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	eb ec                	jmp    8013d2 <readline+0x67>
+			buf[i++] = c;
+  8013e6:	88 9e 20 80 80 00    	mov    %bl,0x808020(%esi)
+  8013ec:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  8013ef:	e8 a3 f6 ff ff       	call   800a97 <getchar>
+  8013f4:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	78 aa                	js     8013a4 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8013fa:	83 f8 08             	cmp    $0x8,%eax
+  8013fd:	0f 94 c0             	sete   %al
+  801400:	83 fb 7f             	cmp    $0x7f,%ebx
+  801403:	0f 94 c2             	sete   %dl
+  801406:	08 d0                	or     %dl,%al
+  801408:	74 04                	je     80140e <readline+0xa3>
+  80140a:	85 f6                	test   %esi,%esi
+  80140c:	7f c0                	jg     8013ce <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  80140e:	83 fb 1f             	cmp    $0x1f,%ebx
+  801411:	7e 1a                	jle    80142d <readline+0xc2>
+  801413:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  801419:	7f 12                	jg     80142d <readline+0xc2>
+			if (echoing)
+  80141b:	85 ff                	test   %edi,%edi
+  80141d:	74 c7                	je     8013e6 <readline+0x7b>
+				cputchar(c);
+  80141f:	83 ec 0c             	sub    $0xc,%esp
+  801422:	53                   	push   %ebx
+  801423:	e8 53 f6 ff ff       	call   800a7b <cputchar>
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	eb b9                	jmp    8013e6 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  80142d:	83 fb 0a             	cmp    $0xa,%ebx
+  801430:	74 05                	je     801437 <readline+0xcc>
+  801432:	83 fb 0d             	cmp    $0xd,%ebx
+  801435:	75 b8                	jne    8013ef <readline+0x84>
+			if (echoing)
+  801437:	85 ff                	test   %edi,%edi
+  801439:	75 11                	jne    80144c <readline+0xe1>
+			buf[i] = 0;
+  80143b:	c6 86 20 80 80 00 00 	movb   $0x0,0x808020(%esi)
+			return buf;
+  801442:	b8 20 80 80 00       	mov    $0x808020,%eax
+  801447:	e9 62 ff ff ff       	jmp    8013ae <readline+0x43>
+				cputchar('\n');
+  80144c:	83 ec 0c             	sub    $0xc,%esp
+  80144f:	6a 0a                	push   $0xa
+  801451:	e8 25 f6 ff ff       	call   800a7b <cputchar>
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	eb e0                	jmp    80143b <readline+0xd0>
+
+0080145b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801461:	80 3a 00             	cmpb   $0x0,(%edx)
+  801464:	74 10                	je     801476 <strlen+0x1b>
+  801466:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80146b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80146e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801472:	75 f7                	jne    80146b <strlen+0x10>
+	return n;
+}
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  801476:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80147b:	eb f7                	jmp    801474 <strlen+0x19>
+
+0080147d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801483:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801486:	85 d2                	test   %edx,%edx
+  801488:	74 16                	je     8014a0 <strnlen+0x23>
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801493:	74 09                	je     80149e <strnlen+0x21>
+		n++;
+  801495:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801498:	39 d0                	cmp    %edx,%eax
+  80149a:	75 f3                	jne    80148f <strnlen+0x12>
+		n++;
+  80149c:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80149e:	5d                   	pop    %ebp
+  80149f:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a5:	eb f7                	jmp    80149e <strnlen+0x21>
+
+008014a7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	53                   	push   %ebx
+  8014ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8014ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8014b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8014ba:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8014bd:	83 c0 01             	add    $0x1,%eax
+  8014c0:	84 d2                	test   %dl,%dl
+  8014c2:	75 f2                	jne    8014b6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8014c4:	89 c8                	mov    %ecx,%eax
+  8014c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014c9:	c9                   	leave
+  8014ca:	c3                   	ret
+
+008014cb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8014cb:	55                   	push   %ebp
+  8014cc:	89 e5                	mov    %esp,%ebp
+  8014ce:	53                   	push   %ebx
+  8014cf:	83 ec 10             	sub    $0x10,%esp
+  8014d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8014d5:	53                   	push   %ebx
+  8014d6:	e8 80 ff ff ff       	call   80145b <strlen>
+  8014db:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8014de:	ff 75 0c             	push   0xc(%ebp)
+  8014e1:	01 d8                	add    %ebx,%eax
+  8014e3:	50                   	push   %eax
+  8014e4:	e8 be ff ff ff       	call   8014a7 <strcpy>
+	return dst;
+}
+  8014e9:	89 d8                	mov    %ebx,%eax
+  8014eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ee:	c9                   	leave
+  8014ef:	c3                   	ret
+
+008014f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8014f0:	55                   	push   %ebp
+  8014f1:	89 e5                	mov    %esp,%ebp
+  8014f3:	56                   	push   %esi
+  8014f4:	53                   	push   %ebx
+  8014f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8014fe:	85 db                	test   %ebx,%ebx
+  801500:	74 17                	je     801519 <strncpy+0x29>
+  801502:	01 f3                	add    %esi,%ebx
+  801504:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  801506:	83 c0 01             	add    $0x1,%eax
+  801509:	0f b6 0a             	movzbl (%edx),%ecx
+  80150c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80150f:	80 f9 01             	cmp    $0x1,%cl
+  801512:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801515:	39 c3                	cmp    %eax,%ebx
+  801517:	75 ed                	jne    801506 <strncpy+0x16>
+	}
+	return ret;
+}
+  801519:	89 f0                	mov    %esi,%eax
+  80151b:	5b                   	pop    %ebx
+  80151c:	5e                   	pop    %esi
+  80151d:	5d                   	pop    %ebp
+  80151e:	c3                   	ret
+
+0080151f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80151f:	55                   	push   %ebp
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	56                   	push   %esi
+  801523:	53                   	push   %ebx
+  801524:	8b 75 08             	mov    0x8(%ebp),%esi
+  801527:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80152a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80152d:	89 f0                	mov    %esi,%eax
+  80152f:	85 db                	test   %ebx,%ebx
+  801531:	74 1e                	je     801551 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  801533:	83 eb 01             	sub    $0x1,%ebx
+  801536:	74 16                	je     80154e <strlcpy+0x2f>
+  801538:	01 f3                	add    %esi,%ebx
+  80153a:	0f b6 0a             	movzbl (%edx),%ecx
+  80153d:	84 c9                	test   %cl,%cl
+  80153f:	74 0d                	je     80154e <strlcpy+0x2f>
+			*dst++ = *src++;
+  801541:	83 c2 01             	add    $0x1,%edx
+  801544:	83 c0 01             	add    $0x1,%eax
+  801547:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80154a:	39 d8                	cmp    %ebx,%eax
+  80154c:	75 ec                	jne    80153a <strlcpy+0x1b>
+		*dst = '\0';
+  80154e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801551:	29 f0                	sub    %esi,%eax
+}
+  801553:	5b                   	pop    %ebx
+  801554:	5e                   	pop    %esi
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+
+00801557 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801557:	55                   	push   %ebp
+  801558:	89 e5                	mov    %esp,%ebp
+  80155a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80155d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801560:	0f b6 01             	movzbl (%ecx),%eax
+  801563:	84 c0                	test   %al,%al
+  801565:	74 11                	je     801578 <strcmp+0x21>
+  801567:	38 02                	cmp    %al,(%edx)
+  801569:	75 0d                	jne    801578 <strcmp+0x21>
+		p++, q++;
+  80156b:	83 c1 01             	add    $0x1,%ecx
+  80156e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801571:	0f b6 01             	movzbl (%ecx),%eax
+  801574:	84 c0                	test   %al,%al
+  801576:	75 ef                	jne    801567 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801578:	0f b6 c0             	movzbl %al,%eax
+  80157b:	0f b6 12             	movzbl (%edx),%edx
+  80157e:	29 d0                	sub    %edx,%eax
+}
+  801580:	5d                   	pop    %ebp
+  801581:	c3                   	ret
+
+00801582 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	53                   	push   %ebx
+  801586:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801589:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80158c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  80158f:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  801594:	85 d2                	test   %edx,%edx
+  801596:	74 2e                	je     8015c6 <strncmp+0x44>
+  801598:	0f b6 01             	movzbl (%ecx),%eax
+  80159b:	84 c0                	test   %al,%al
+  80159d:	74 16                	je     8015b5 <strncmp+0x33>
+  80159f:	3a 03                	cmp    (%ebx),%al
+  8015a1:	75 12                	jne    8015b5 <strncmp+0x33>
+		n--, p++, q++;
+  8015a3:	83 c1 01             	add    $0x1,%ecx
+  8015a6:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8015a9:	83 ea 01             	sub    $0x1,%edx
+  8015ac:	75 ea                	jne    801598 <strncmp+0x16>
+		return 0;
+  8015ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b3:	eb 11                	jmp    8015c6 <strncmp+0x44>
+  8015b5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8015ba:	85 d2                	test   %edx,%edx
+  8015bc:	74 08                	je     8015c6 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8015be:	0f b6 01             	movzbl (%ecx),%eax
+  8015c1:	0f b6 13             	movzbl (%ebx),%edx
+  8015c4:	29 d0                	sub    %edx,%eax
+}
+  8015c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+
+008015cb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8015d5:	0f b6 10             	movzbl (%eax),%edx
+  8015d8:	84 d2                	test   %dl,%dl
+  8015da:	74 15                	je     8015f1 <strchr+0x26>
+		if (*s == c)
+  8015dc:	38 d1                	cmp    %dl,%cl
+  8015de:	74 0f                	je     8015ef <strchr+0x24>
+	for (; *s; s++)
+  8015e0:	83 c0 01             	add    $0x1,%eax
+  8015e3:	0f b6 10             	movzbl (%eax),%edx
+  8015e6:	84 d2                	test   %dl,%dl
+  8015e8:	75 f2                	jne    8015dc <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8015ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	c3                   	ret
+	return 0;
+  8015f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f6:	eb f7                	jmp    8015ef <strchr+0x24>
+
+008015f8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	53                   	push   %ebx
+  8015fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  801602:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  801605:	38 d3                	cmp    %dl,%bl
+  801607:	74 14                	je     80161d <strfind+0x25>
+  801609:	89 d1                	mov    %edx,%ecx
+  80160b:	84 db                	test   %bl,%bl
+  80160d:	74 0e                	je     80161d <strfind+0x25>
+	for (; *s; s++)
+  80160f:	83 c0 01             	add    $0x1,%eax
+  801612:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801615:	38 ca                	cmp    %cl,%dl
+  801617:	74 04                	je     80161d <strfind+0x25>
+  801619:	84 d2                	test   %dl,%dl
+  80161b:	75 f2                	jne    80160f <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  80161d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801620:	c9                   	leave
+  801621:	c3                   	ret
+
+00801622 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	57                   	push   %edi
+  801626:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801629:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80162c:	85 c9                	test   %ecx,%ecx
+  80162e:	74 20                	je     801650 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801630:	89 f8                	mov    %edi,%eax
+  801632:	09 c8                	or     %ecx,%eax
+  801634:	a8 03                	test   $0x3,%al
+  801636:	75 12                	jne    80164a <memset+0x28>
+		c &= 0xFF;
+  801638:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80163c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801642:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801645:	fc                   	cld
+  801646:	f3 ab                	rep stos %eax,%es:(%edi)
+  801648:	eb 06                	jmp    801650 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80164a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80164d:	fc                   	cld
+  80164e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801650:	89 f8                	mov    %edi,%eax
+  801652:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801655:	c9                   	leave
+  801656:	c3                   	ret
+
+00801657 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	57                   	push   %edi
+  80165b:	56                   	push   %esi
+  80165c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80165f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801662:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801665:	39 c6                	cmp    %eax,%esi
+  801667:	73 32                	jae    80169b <memmove+0x44>
+  801669:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80166c:	39 d0                	cmp    %edx,%eax
+  80166e:	73 2b                	jae    80169b <memmove+0x44>
+		s += n;
+		d += n;
+  801670:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801673:	89 d6                	mov    %edx,%esi
+  801675:	09 fe                	or     %edi,%esi
+  801677:	09 ce                	or     %ecx,%esi
+  801679:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80167f:	75 0e                	jne    80168f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801681:	83 ef 04             	sub    $0x4,%edi
+  801684:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801687:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80168a:	fd                   	std
+  80168b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80168d:	eb 09                	jmp    801698 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80168f:	83 ef 01             	sub    $0x1,%edi
+  801692:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801695:	fd                   	std
+  801696:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801698:	fc                   	cld
+  801699:	eb 1a                	jmp    8016b5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80169b:	89 f2                	mov    %esi,%edx
+  80169d:	09 c2                	or     %eax,%edx
+  80169f:	09 ca                	or     %ecx,%edx
+  8016a1:	f6 c2 03             	test   $0x3,%dl
+  8016a4:	75 0a                	jne    8016b0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8016a6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8016a9:	89 c7                	mov    %eax,%edi
+  8016ab:	fc                   	cld
+  8016ac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8016ae:	eb 05                	jmp    8016b5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8016b0:	89 c7                	mov    %eax,%edi
+  8016b2:	fc                   	cld
+  8016b3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8016b5:	5e                   	pop    %esi
+  8016b6:	5f                   	pop    %edi
+  8016b7:	5d                   	pop    %ebp
+  8016b8:	c3                   	ret
+
+008016b9 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8016bf:	ff 75 10             	push   0x10(%ebp)
+  8016c2:	ff 75 0c             	push   0xc(%ebp)
+  8016c5:	ff 75 08             	push   0x8(%ebp)
+  8016c8:	e8 8a ff ff ff       	call   801657 <memmove>
+}
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+
+008016cf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8016cf:	55                   	push   %ebp
+  8016d0:	89 e5                	mov    %esp,%ebp
+  8016d2:	56                   	push   %esi
+  8016d3:	53                   	push   %ebx
+  8016d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016da:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8016dd:	85 f6                	test   %esi,%esi
+  8016df:	74 29                	je     80170a <memcmp+0x3b>
+  8016e1:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8016e3:	0f b6 08             	movzbl (%eax),%ecx
+  8016e6:	0f b6 1a             	movzbl (%edx),%ebx
+  8016e9:	38 d9                	cmp    %bl,%cl
+  8016eb:	75 11                	jne    8016fe <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8016ed:	83 c0 01             	add    $0x1,%eax
+  8016f0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8016f3:	39 c6                	cmp    %eax,%esi
+  8016f5:	75 ec                	jne    8016e3 <memcmp+0x14>
+	}
+
+	return 0;
+  8016f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fc:	eb 08                	jmp    801706 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  8016fe:	0f b6 c1             	movzbl %cl,%eax
+  801701:	0f b6 db             	movzbl %bl,%ebx
+  801704:	29 d8                	sub    %ebx,%eax
+}
+  801706:	5b                   	pop    %ebx
+  801707:	5e                   	pop    %esi
+  801708:	5d                   	pop    %ebp
+  801709:	c3                   	ret
+	return 0;
+  80170a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170f:	eb f5                	jmp    801706 <memcmp+0x37>
+
+00801711 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	8b 45 08             	mov    0x8(%ebp),%eax
+  801717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80171a:	89 c2                	mov    %eax,%edx
+  80171c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80171f:	39 d0                	cmp    %edx,%eax
+  801721:	73 0d                	jae    801730 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801723:	38 08                	cmp    %cl,(%eax)
+  801725:	74 0d                	je     801734 <memfind+0x23>
+	for (; s < ends; s++)
+  801727:	83 c0 01             	add    $0x1,%eax
+  80172a:	39 c2                	cmp    %eax,%edx
+  80172c:	75 f5                	jne    801723 <memfind+0x12>
+  80172e:	eb 06                	jmp    801736 <memfind+0x25>
+  801730:	89 c2                	mov    %eax,%edx
+  801732:	eb 02                	jmp    801736 <memfind+0x25>
+  801734:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  801736:	89 d0                	mov    %edx,%eax
+  801738:	5d                   	pop    %ebp
+  801739:	c3                   	ret
+
+0080173a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80173a:	55                   	push   %ebp
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	57                   	push   %edi
+  80173e:	56                   	push   %esi
+  80173f:	53                   	push   %ebx
+  801740:	8b 55 08             	mov    0x8(%ebp),%edx
+  801743:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801746:	0f b6 02             	movzbl (%edx),%eax
+  801749:	3c 20                	cmp    $0x20,%al
+  80174b:	74 04                	je     801751 <strtol+0x17>
+  80174d:	3c 09                	cmp    $0x9,%al
+  80174f:	75 0e                	jne    80175f <strtol+0x25>
+		s++;
+  801751:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801754:	0f b6 02             	movzbl (%edx),%eax
+  801757:	3c 20                	cmp    $0x20,%al
+  801759:	74 f6                	je     801751 <strtol+0x17>
+  80175b:	3c 09                	cmp    $0x9,%al
+  80175d:	74 f2                	je     801751 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  80175f:	3c 2b                	cmp    $0x2b,%al
+  801761:	74 2a                	je     80178d <strtol+0x53>
+	int neg = 0;
+  801763:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801768:	3c 2d                	cmp    $0x2d,%al
+  80176a:	74 2b                	je     801797 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80176c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801772:	75 0f                	jne    801783 <strtol+0x49>
+  801774:	80 3a 30             	cmpb   $0x30,(%edx)
+  801777:	74 28                	je     8017a1 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801779:	85 db                	test   %ebx,%ebx
+  80177b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801780:	0f 44 d8             	cmove  %eax,%ebx
+  801783:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801788:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80178b:	eb 46                	jmp    8017d3 <strtol+0x99>
+		s++;
+  80178d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801790:	bf 00 00 00 00       	mov    $0x0,%edi
+  801795:	eb d5                	jmp    80176c <strtol+0x32>
+		s++, neg = 1;
+  801797:	83 c2 01             	add    $0x1,%edx
+  80179a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80179f:	eb cb                	jmp    80176c <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8017a1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8017a5:	74 0e                	je     8017b5 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8017a7:	85 db                	test   %ebx,%ebx
+  8017a9:	75 d8                	jne    801783 <strtol+0x49>
+		s++, base = 8;
+  8017ab:	83 c2 01             	add    $0x1,%edx
+  8017ae:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8017b3:	eb ce                	jmp    801783 <strtol+0x49>
+		s += 2, base = 16;
+  8017b5:	83 c2 02             	add    $0x2,%edx
+  8017b8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8017bd:	eb c4                	jmp    801783 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8017bf:	0f be c0             	movsbl %al,%eax
+  8017c2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8017c5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8017c8:	7d 3a                	jge    801804 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8017ca:	83 c2 01             	add    $0x1,%edx
+  8017cd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8017d1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8017d3:	0f b6 02             	movzbl (%edx),%eax
+  8017d6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8017d9:	89 f3                	mov    %esi,%ebx
+  8017db:	80 fb 09             	cmp    $0x9,%bl
+  8017de:	76 df                	jbe    8017bf <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8017e0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8017e3:	89 f3                	mov    %esi,%ebx
+  8017e5:	80 fb 19             	cmp    $0x19,%bl
+  8017e8:	77 08                	ja     8017f2 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8017ea:	0f be c0             	movsbl %al,%eax
+  8017ed:	83 e8 57             	sub    $0x57,%eax
+  8017f0:	eb d3                	jmp    8017c5 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8017f2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8017f5:	89 f3                	mov    %esi,%ebx
+  8017f7:	80 fb 19             	cmp    $0x19,%bl
+  8017fa:	77 08                	ja     801804 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8017fc:	0f be c0             	movsbl %al,%eax
+  8017ff:	83 e8 37             	sub    $0x37,%eax
+  801802:	eb c1                	jmp    8017c5 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801804:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801808:	74 05                	je     80180f <strtol+0xd5>
+		*endptr = (char *) s;
+  80180a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80180d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80180f:	89 c8                	mov    %ecx,%eax
+  801811:	f7 d8                	neg    %eax
+  801813:	85 ff                	test   %edi,%edi
+  801815:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801818:	89 c8                	mov    %ecx,%eax
+  80181a:	5b                   	pop    %ebx
+  80181b:	5e                   	pop    %esi
+  80181c:	5f                   	pop    %edi
+  80181d:	5d                   	pop    %ebp
+  80181e:	c3                   	ret
+
+0080181f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	57                   	push   %edi
+  801823:	56                   	push   %esi
+  801824:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801830:	89 c3                	mov    %eax,%ebx
+  801832:	89 c7                	mov    %eax,%edi
+  801834:	89 c6                	mov    %eax,%esi
+  801836:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801838:	5b                   	pop    %ebx
+  801839:	5e                   	pop    %esi
+  80183a:	5f                   	pop    %edi
+  80183b:	5d                   	pop    %ebp
+  80183c:	c3                   	ret
+
+0080183d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80183d:	55                   	push   %ebp
+  80183e:	89 e5                	mov    %esp,%ebp
+  801840:	57                   	push   %edi
+  801841:	56                   	push   %esi
+  801842:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801843:	ba 00 00 00 00       	mov    $0x0,%edx
+  801848:	b8 01 00 00 00       	mov    $0x1,%eax
+  80184d:	89 d1                	mov    %edx,%ecx
+  80184f:	89 d3                	mov    %edx,%ebx
+  801851:	89 d7                	mov    %edx,%edi
+  801853:	89 d6                	mov    %edx,%esi
+  801855:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801857:	5b                   	pop    %ebx
+  801858:	5e                   	pop    %esi
+  801859:	5f                   	pop    %edi
+  80185a:	5d                   	pop    %ebp
+  80185b:	c3                   	ret
+
+0080185c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80185c:	55                   	push   %ebp
+  80185d:	89 e5                	mov    %esp,%ebp
+  80185f:	57                   	push   %edi
+  801860:	56                   	push   %esi
+  801861:	53                   	push   %ebx
+  801862:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801865:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80186a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801872:	89 cb                	mov    %ecx,%ebx
+  801874:	89 cf                	mov    %ecx,%edi
+  801876:	89 ce                	mov    %ecx,%esi
+  801878:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	7f 08                	jg     801886 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80187e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801881:	5b                   	pop    %ebx
+  801882:	5e                   	pop    %esi
+  801883:	5f                   	pop    %edi
+  801884:	5d                   	pop    %ebp
+  801885:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801886:	83 ec 0c             	sub    $0xc,%esp
+  801889:	50                   	push   %eax
+  80188a:	6a 03                	push   $0x3
+  80188c:	68 7b 5f 80 00       	push   $0x805f7b
+  801891:	6a 23                	push   $0x23
+  801893:	68 98 5f 80 00       	push   $0x805f98
+  801898:	e8 48 f3 ff ff       	call   800be5 <_panic>
+
+0080189d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80189d:	55                   	push   %ebp
+  80189e:	89 e5                	mov    %esp,%ebp
+  8018a0:	57                   	push   %edi
+  8018a1:	56                   	push   %esi
+  8018a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8018a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018ad:	89 d1                	mov    %edx,%ecx
+  8018af:	89 d3                	mov    %edx,%ebx
+  8018b1:	89 d7                	mov    %edx,%edi
+  8018b3:	89 d6                	mov    %edx,%esi
+  8018b5:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8018b7:	5b                   	pop    %ebx
+  8018b8:	5e                   	pop    %esi
+  8018b9:	5f                   	pop    %edi
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+
+008018bc <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	57                   	push   %edi
+  8018c0:	56                   	push   %esi
+  8018c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8018c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8018cc:	89 d1                	mov    %edx,%ecx
+  8018ce:	89 d3                	mov    %edx,%ebx
+  8018d0:	89 d7                	mov    %edx,%edi
+  8018d2:	89 d6                	mov    %edx,%esi
+  8018d4:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8018d6:	5b                   	pop    %ebx
+  8018d7:	5e                   	pop    %esi
+  8018d8:	5f                   	pop    %edi
+  8018d9:	5d                   	pop    %ebp
+  8018da:	c3                   	ret
+
+008018db <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	57                   	push   %edi
+  8018df:	56                   	push   %esi
+  8018e0:	53                   	push   %ebx
+  8018e1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8018e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ef:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018f7:	89 f7                	mov    %esi,%edi
+  8018f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018fb:	85 c0                	test   %eax,%eax
+  8018fd:	7f 08                	jg     801907 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8018ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801902:	5b                   	pop    %ebx
+  801903:	5e                   	pop    %esi
+  801904:	5f                   	pop    %edi
+  801905:	5d                   	pop    %ebp
+  801906:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801907:	83 ec 0c             	sub    $0xc,%esp
+  80190a:	50                   	push   %eax
+  80190b:	6a 04                	push   $0x4
+  80190d:	68 7b 5f 80 00       	push   $0x805f7b
+  801912:	6a 23                	push   $0x23
+  801914:	68 98 5f 80 00       	push   $0x805f98
+  801919:	e8 c7 f2 ff ff       	call   800be5 <_panic>
+
+0080191e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	57                   	push   %edi
+  801922:	56                   	push   %esi
+  801923:	53                   	push   %ebx
+  801924:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801927:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80192d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801932:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801935:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801938:	8b 75 18             	mov    0x18(%ebp),%esi
+  80193b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	7f 08                	jg     801949 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801941:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801944:	5b                   	pop    %ebx
+  801945:	5e                   	pop    %esi
+  801946:	5f                   	pop    %edi
+  801947:	5d                   	pop    %ebp
+  801948:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801949:	83 ec 0c             	sub    $0xc,%esp
+  80194c:	50                   	push   %eax
+  80194d:	6a 05                	push   $0x5
+  80194f:	68 7b 5f 80 00       	push   $0x805f7b
+  801954:	6a 23                	push   $0x23
+  801956:	68 98 5f 80 00       	push   $0x805f98
+  80195b:	e8 85 f2 ff ff       	call   800be5 <_panic>
+
+00801960 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801960:	55                   	push   %ebp
+  801961:	89 e5                	mov    %esp,%ebp
+  801963:	57                   	push   %edi
+  801964:	56                   	push   %esi
+  801965:	53                   	push   %ebx
+  801966:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801969:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801971:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801974:	b8 06 00 00 00       	mov    $0x6,%eax
+  801979:	89 df                	mov    %ebx,%edi
+  80197b:	89 de                	mov    %ebx,%esi
+  80197d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80197f:	85 c0                	test   %eax,%eax
+  801981:	7f 08                	jg     80198b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801983:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801986:	5b                   	pop    %ebx
+  801987:	5e                   	pop    %esi
+  801988:	5f                   	pop    %edi
+  801989:	5d                   	pop    %ebp
+  80198a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80198b:	83 ec 0c             	sub    $0xc,%esp
+  80198e:	50                   	push   %eax
+  80198f:	6a 06                	push   $0x6
+  801991:	68 7b 5f 80 00       	push   $0x805f7b
+  801996:	6a 23                	push   $0x23
+  801998:	68 98 5f 80 00       	push   $0x805f98
+  80199d:	e8 43 f2 ff ff       	call   800be5 <_panic>
+
+008019a2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8019a2:	55                   	push   %ebp
+  8019a3:	89 e5                	mov    %esp,%ebp
+  8019a5:	57                   	push   %edi
+  8019a6:	56                   	push   %esi
+  8019a7:	53                   	push   %ebx
+  8019a8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8019ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019b6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019bb:	89 df                	mov    %ebx,%edi
+  8019bd:	89 de                	mov    %ebx,%esi
+  8019bf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019c1:	85 c0                	test   %eax,%eax
+  8019c3:	7f 08                	jg     8019cd <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8019c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c8:	5b                   	pop    %ebx
+  8019c9:	5e                   	pop    %esi
+  8019ca:	5f                   	pop    %edi
+  8019cb:	5d                   	pop    %ebp
+  8019cc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019cd:	83 ec 0c             	sub    $0xc,%esp
+  8019d0:	50                   	push   %eax
+  8019d1:	6a 08                	push   $0x8
+  8019d3:	68 7b 5f 80 00       	push   $0x805f7b
+  8019d8:	6a 23                	push   $0x23
+  8019da:	68 98 5f 80 00       	push   $0x805f98
+  8019df:	e8 01 f2 ff ff       	call   800be5 <_panic>
+
+008019e4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8019e4:	55                   	push   %ebp
+  8019e5:	89 e5                	mov    %esp,%ebp
+  8019e7:	57                   	push   %edi
+  8019e8:	56                   	push   %esi
+  8019e9:	53                   	push   %ebx
+  8019ea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8019ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019fd:	89 df                	mov    %ebx,%edi
+  8019ff:	89 de                	mov    %ebx,%esi
+  801a01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a03:	85 c0                	test   %eax,%eax
+  801a05:	7f 08                	jg     801a0f <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0a:	5b                   	pop    %ebx
+  801a0b:	5e                   	pop    %esi
+  801a0c:	5f                   	pop    %edi
+  801a0d:	5d                   	pop    %ebp
+  801a0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a0f:	83 ec 0c             	sub    $0xc,%esp
+  801a12:	50                   	push   %eax
+  801a13:	6a 09                	push   $0x9
+  801a15:	68 7b 5f 80 00       	push   $0x805f7b
+  801a1a:	6a 23                	push   $0x23
+  801a1c:	68 98 5f 80 00       	push   $0x805f98
+  801a21:	e8 bf f1 ff ff       	call   800be5 <_panic>
+
+00801a26 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801a26:	55                   	push   %ebp
+  801a27:	89 e5                	mov    %esp,%ebp
+  801a29:	57                   	push   %edi
+  801a2a:	56                   	push   %esi
+  801a2b:	53                   	push   %ebx
+  801a2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801a2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a34:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a3a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a3f:	89 df                	mov    %ebx,%edi
+  801a41:	89 de                	mov    %ebx,%esi
+  801a43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a45:	85 c0                	test   %eax,%eax
+  801a47:	7f 08                	jg     801a51 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801a49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4c:	5b                   	pop    %ebx
+  801a4d:	5e                   	pop    %esi
+  801a4e:	5f                   	pop    %edi
+  801a4f:	5d                   	pop    %ebp
+  801a50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a51:	83 ec 0c             	sub    $0xc,%esp
+  801a54:	50                   	push   %eax
+  801a55:	6a 0a                	push   $0xa
+  801a57:	68 7b 5f 80 00       	push   $0x805f7b
+  801a5c:	6a 23                	push   $0x23
+  801a5e:	68 98 5f 80 00       	push   $0x805f98
+  801a63:	e8 7d f1 ff ff       	call   800be5 <_panic>
+
+00801a68 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801a68:	55                   	push   %ebp
+  801a69:	89 e5                	mov    %esp,%ebp
+  801a6b:	57                   	push   %edi
+  801a6c:	56                   	push   %esi
+  801a6d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801a6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a74:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a79:	be 00 00 00 00       	mov    $0x0,%esi
+  801a7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a81:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a84:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801a86:	5b                   	pop    %ebx
+  801a87:	5e                   	pop    %esi
+  801a88:	5f                   	pop    %edi
+  801a89:	5d                   	pop    %ebp
+  801a8a:	c3                   	ret
+
+00801a8b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801a8b:	55                   	push   %ebp
+  801a8c:	89 e5                	mov    %esp,%ebp
+  801a8e:	57                   	push   %edi
+  801a8f:	56                   	push   %esi
+  801a90:	53                   	push   %ebx
+  801a91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801a94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a99:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801aa1:	89 cb                	mov    %ecx,%ebx
+  801aa3:	89 cf                	mov    %ecx,%edi
+  801aa5:	89 ce                	mov    %ecx,%esi
+  801aa7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	7f 08                	jg     801ab5 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801aad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab0:	5b                   	pop    %ebx
+  801ab1:	5e                   	pop    %esi
+  801ab2:	5f                   	pop    %edi
+  801ab3:	5d                   	pop    %ebp
+  801ab4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ab5:	83 ec 0c             	sub    $0xc,%esp
+  801ab8:	50                   	push   %eax
+  801ab9:	6a 0d                	push   $0xd
+  801abb:	68 7b 5f 80 00       	push   $0x805f7b
+  801ac0:	6a 23                	push   $0x23
+  801ac2:	68 98 5f 80 00       	push   $0x805f98
+  801ac7:	e8 19 f1 ff ff       	call   800be5 <_panic>
+
+00801acc <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801acc:	55                   	push   %ebp
+  801acd:	89 e5                	mov    %esp,%ebp
+  801acf:	57                   	push   %edi
+  801ad0:	56                   	push   %esi
+  801ad1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801ad2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801add:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ae0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ae3:	8b 75 18             	mov    0x18(%ebp),%esi
+  801ae6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5f                   	pop    %edi
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+
+00801aed <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	57                   	push   %edi
+  801af1:	56                   	push   %esi
+  801af2:	53                   	push   %ebx
+  801af3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801af6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801afb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b01:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b06:	89 df                	mov    %ebx,%edi
+  801b08:	89 de                	mov    %ebx,%esi
+  801b0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801b0c:	85 c0                	test   %eax,%eax
+  801b0e:	7f 08                	jg     801b18 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b13:	5b                   	pop    %ebx
+  801b14:	5e                   	pop    %esi
+  801b15:	5f                   	pop    %edi
+  801b16:	5d                   	pop    %ebp
+  801b17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	50                   	push   %eax
+  801b1c:	6a 0d                	push   $0xd
+  801b1e:	68 7b 5f 80 00       	push   $0x805f7b
+  801b23:	6a 23                	push   $0x23
+  801b25:	68 98 5f 80 00       	push   $0x805f98
+  801b2a:	e8 b6 f0 ff ff       	call   800be5 <_panic>
+
+00801b2f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801b2f:	55                   	push   %ebp
+  801b30:	89 e5                	mov    %esp,%ebp
+  801b32:	57                   	push   %edi
+  801b33:	56                   	push   %esi
+  801b34:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801b35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b3f:	89 d1                	mov    %edx,%ecx
+  801b41:	89 d3                	mov    %edx,%ebx
+  801b43:	89 d7                	mov    %edx,%edi
+  801b45:	89 d6                	mov    %edx,%esi
+  801b47:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801b49:	5b                   	pop    %ebx
+  801b4a:	5e                   	pop    %esi
+  801b4b:	5f                   	pop    %edi
+  801b4c:	5d                   	pop    %ebp
+  801b4d:	c3                   	ret
+
+00801b4e <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801b4e:	55                   	push   %ebp
+  801b4f:	89 e5                	mov    %esp,%ebp
+  801b51:	57                   	push   %edi
+  801b52:	56                   	push   %esi
+  801b53:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801b54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b59:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b5f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801b64:	89 df                	mov    %ebx,%edi
+  801b66:	89 de                	mov    %ebx,%esi
+  801b68:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801b6a:	5b                   	pop    %ebx
+  801b6b:	5e                   	pop    %esi
+  801b6c:	5f                   	pop    %edi
+  801b6d:	5d                   	pop    %ebp
+  801b6e:	c3                   	ret
+
+00801b6f <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	57                   	push   %edi
+  801b73:	56                   	push   %esi
+  801b74:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801b75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b7d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b82:	89 cb                	mov    %ecx,%ebx
+  801b84:	89 cf                	mov    %ecx,%edi
+  801b86:	89 ce                	mov    %ecx,%esi
+  801b88:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801b8a:	5b                   	pop    %ebx
+  801b8b:	5e                   	pop    %esi
+  801b8c:	5f                   	pop    %edi
+  801b8d:	5d                   	pop    %ebp
+  801b8e:	c3                   	ret
+
+00801b8f <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801b8f:	55                   	push   %ebp
+  801b90:	89 e5                	mov    %esp,%ebp
+  801b92:	57                   	push   %edi
+  801b93:	56                   	push   %esi
+  801b94:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801b95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ba0:	b8 11 00 00 00       	mov    $0x11,%eax
+  801ba5:	89 df                	mov    %ebx,%edi
+  801ba7:	89 de                	mov    %ebx,%esi
+  801ba9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801bab:	5b                   	pop    %ebx
+  801bac:	5e                   	pop    %esi
+  801bad:	5f                   	pop    %edi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+
+00801bb0 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	57                   	push   %edi
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801bb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc1:	b8 12 00 00 00       	mov    $0x12,%eax
+  801bc6:	89 df                	mov    %ebx,%edi
+  801bc8:	89 de                	mov    %ebx,%esi
+  801bca:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801bcc:	5b                   	pop    %ebx
+  801bcd:	5e                   	pop    %esi
+  801bce:	5f                   	pop    %edi
+  801bcf:	5d                   	pop    %ebp
+  801bd0:	c3                   	ret
+
+00801bd1 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	57                   	push   %edi
+  801bd5:	56                   	push   %esi
+  801bd6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801bd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bdf:	b8 13 00 00 00       	mov    $0x13,%eax
+  801be4:	89 cb                	mov    %ecx,%ebx
+  801be6:	89 cf                	mov    %ecx,%edi
+  801be8:	89 ce                	mov    %ecx,%esi
+  801bea:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801bec:	5b                   	pop    %ebx
+  801bed:	5e                   	pop    %esi
+  801bee:	5f                   	pop    %edi
+  801bef:	5d                   	pop    %ebp
+  801bf0:	c3                   	ret
+
+00801bf1 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801bf1:	55                   	push   %ebp
+  801bf2:	89 e5                	mov    %esp,%ebp
+  801bf4:	57                   	push   %edi
+  801bf5:	56                   	push   %esi
+  801bf6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801bf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c02:	b8 14 00 00 00       	mov    $0x14,%eax
+  801c07:	89 df                	mov    %ebx,%edi
+  801c09:	89 de                	mov    %ebx,%esi
+  801c0b:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801c0d:	5b                   	pop    %ebx
+  801c0e:	5e                   	pop    %esi
+  801c0f:	5f                   	pop    %edi
+  801c10:	5d                   	pop    %ebp
+  801c11:	c3                   	ret
+
+00801c12 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801c12:	55                   	push   %ebp
+  801c13:	89 e5                	mov    %esp,%ebp
+  801c15:	57                   	push   %edi
+  801c16:	56                   	push   %esi
+  801c17:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801c18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c20:	b8 15 00 00 00       	mov    $0x15,%eax
+  801c25:	89 cb                	mov    %ecx,%ebx
+  801c27:	89 cf                	mov    %ecx,%edi
+  801c29:	89 ce                	mov    %ecx,%esi
+  801c2b:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801c2d:	5b                   	pop    %ebx
+  801c2e:	5e                   	pop    %esi
+  801c2f:	5f                   	pop    %edi
+  801c30:	5d                   	pop    %ebp
+  801c31:	c3                   	ret
+
+00801c32 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801c32:	55                   	push   %ebp
+  801c33:	89 e5                	mov    %esp,%ebp
+  801c35:	57                   	push   %edi
+  801c36:	56                   	push   %esi
+  801c37:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801c38:	be 00 00 00 00       	mov    $0x0,%esi
+  801c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c43:	b8 16 00 00 00       	mov    $0x16,%eax
+  801c48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c4b:	89 f7                	mov    %esi,%edi
+  801c4d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801c4f:	5b                   	pop    %ebx
+  801c50:	5e                   	pop    %esi
+  801c51:	5f                   	pop    %edi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+
+00801c54 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	57                   	push   %edi
+  801c58:	56                   	push   %esi
+  801c59:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801c5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c65:	b8 17 00 00 00       	mov    $0x17,%eax
+  801c6a:	89 df                	mov    %ebx,%edi
+  801c6c:	89 de                	mov    %ebx,%esi
+  801c6e:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801c70:	5b                   	pop    %ebx
+  801c71:	5e                   	pop    %esi
+  801c72:	5f                   	pop    %edi
+  801c73:	5d                   	pop    %ebp
+  801c74:	c3                   	ret
+
+00801c75 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801c75:	55                   	push   %ebp
+  801c76:	89 e5                	mov    %esp,%ebp
+  801c78:	57                   	push   %edi
+  801c79:	56                   	push   %esi
+  801c7a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801c7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c83:	b8 18 00 00 00       	mov    $0x18,%eax
+  801c88:	89 cb                	mov    %ecx,%ebx
+  801c8a:	89 cf                	mov    %ecx,%edi
+  801c8c:	89 ce                	mov    %ecx,%esi
+  801c8e:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801c90:	5b                   	pop    %ebx
+  801c91:	5e                   	pop    %esi
+  801c92:	5f                   	pop    %edi
+  801c93:	5d                   	pop    %ebp
+  801c94:	c3                   	ret
+
+00801c95 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801c95:	55                   	push   %ebp
+  801c96:	89 e5                	mov    %esp,%ebp
+  801c98:	57                   	push   %edi
+  801c99:	56                   	push   %esi
+  801c9a:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801c9b:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801c9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ca7:	b8 19 00 00 00       	mov    $0x19,%eax
+  801cac:	89 df                	mov    %ebx,%edi
+  801cae:	89 de                	mov    %ebx,%esi
+  801cb0:	cd 30                	int    $0x30
+}
+  801cb2:	5b                   	pop    %ebx
+  801cb3:	5e                   	pop    %esi
+  801cb4:	5f                   	pop    %edi
+  801cb5:	5d                   	pop    %ebp
+  801cb6:	c3                   	ret
+
+00801cb7 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+  801cba:	57                   	push   %edi
+  801cbb:	56                   	push   %esi
+  801cbc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801cbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801ccd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cd0:	89 f7                	mov    %esi,%edi
+  801cd2:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801cd4:	5b                   	pop    %ebx
+  801cd5:	5e                   	pop    %esi
+  801cd6:	5f                   	pop    %edi
+  801cd7:	5d                   	pop    %ebp
+  801cd8:	c3                   	ret
+
+00801cd9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801cd9:	55                   	push   %ebp
+  801cda:	89 e5                	mov    %esp,%ebp
+  801cdc:	57                   	push   %edi
+  801cdd:	56                   	push   %esi
+  801cde:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801cdf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ce7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cea:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801cef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cf2:	89 f7                	mov    %esi,%edi
+  801cf4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5f                   	pop    %edi
+  801cf9:	5d                   	pop    %ebp
+  801cfa:	c3                   	ret
+
+00801cfb <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801cfb:	55                   	push   %ebp
+  801cfc:	89 e5                	mov    %esp,%ebp
+  801cfe:	57                   	push   %edi
+  801cff:	56                   	push   %esi
+  801d00:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801d01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d0c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801d11:	89 df                	mov    %ebx,%edi
+  801d13:	89 de                	mov    %ebx,%esi
+  801d15:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801d17:	5b                   	pop    %ebx
+  801d18:	5e                   	pop    %esi
+  801d19:	5f                   	pop    %edi
+  801d1a:	5d                   	pop    %ebp
+  801d1b:	c3                   	ret
+
+00801d1c <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	57                   	push   %edi
+  801d20:	56                   	push   %esi
+  801d21:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801d22:	be 00 00 00 00       	mov    $0x0,%esi
+  801d27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d2d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801d32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d35:	89 f7                	mov    %esi,%edi
+  801d37:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801d39:	5b                   	pop    %ebx
+  801d3a:	5e                   	pop    %esi
+  801d3b:	5f                   	pop    %edi
+  801d3c:	5d                   	pop    %ebp
+  801d3d:	c3                   	ret
+
+00801d3e <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	74 20                	je     801d62 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  801d42:	89 c1                	mov    %eax,%ecx
+  801d44:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801d4a:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  801d50:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d56:	8b 52 48             	mov    0x48(%edx),%edx
+  801d59:	39 c2                	cmp    %eax,%edx
+  801d5b:	74 06                	je     801d63 <thread_alive+0x25>
+  801d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d62:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801d63:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801d69:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	0f 95 c0             	setne  %al
+  801d74:	0f b6 c0             	movzbl %al,%eax
+  801d77:	c3                   	ret
+
+00801d78 <pgfault>:
+{
+  801d78:	55                   	push   %ebp
+  801d79:	89 e5                	mov    %esp,%ebp
+  801d7b:	57                   	push   %edi
+  801d7c:	56                   	push   %esi
+  801d7d:	53                   	push   %ebx
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801d84:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801d86:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801d89:	89 f3                	mov    %esi,%ebx
+  801d8b:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801d8e:	83 3d e0 94 80 00 00 	cmpl   $0x0,0x8094e0
+  801d95:	74 52                	je     801de9 <pgfault+0x71>
+  801d97:	a8 02                	test   $0x2,%al
+  801d99:	75 14                	jne    801daf <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801d9b:	83 ec 04             	sub    $0x4,%esp
+  801d9e:	68 a6 5f 80 00       	push   $0x805fa6
+  801da3:	6a 2e                	push   $0x2e
+  801da5:	68 c4 5f 80 00       	push   $0x805fc4
+  801daa:	e8 36 ee ff ff       	call   800be5 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801daf:	89 d8                	mov    %ebx,%eax
+  801db1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801db6:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801dbd:	83 ec 0c             	sub    $0xc,%esp
+  801dc0:	57                   	push   %edi
+  801dc1:	e8 c8 34 00 00       	call   80528e <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801dc6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801dcd:	83 e0 03             	and    $0x3,%eax
+  801dd0:	83 c4 10             	add    $0x10,%esp
+  801dd3:	83 f8 03             	cmp    $0x3,%eax
+  801dd6:	75 1a                	jne    801df2 <pgfault+0x7a>
+			mutex_unlock(m);
+  801dd8:	83 ec 0c             	sub    $0xc,%esp
+  801ddb:	57                   	push   %edi
+  801ddc:	e8 1b 35 00 00       	call   8052fc <mutex_unlock>
+			return;
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	e9 9f 00 00 00       	jmp    801e88 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801de9:	a8 02                	test   $0x2,%al
+  801deb:	74 ae                	je     801d9b <pgfault+0x23>
+	struct mutex *m = NULL;
+  801ded:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801df2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801df9:	f6 c4 08             	test   $0x8,%ah
+  801dfc:	74 9d                	je     801d9b <pgfault+0x23>
+  801dfe:	89 e0                	mov    %esp,%eax
+  801e00:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801e05:	29 c2                	sub    %eax,%edx
+  801e07:	89 d0                	mov    %edx,%eax
+  801e09:	c1 e8 0f             	shr    $0xf,%eax
+  801e0c:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801e12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e17:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801e1a:	c1 e0 0c             	shl    $0xc,%eax
+  801e1d:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801e22:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801e24:	83 ec 04             	sub    $0x4,%esp
+  801e27:	6a 07                	push   $0x7
+  801e29:	53                   	push   %ebx
+  801e2a:	6a 00                	push   $0x0
+  801e2c:	e8 aa fa ff ff       	call   8018db <sys_page_alloc>
+  801e31:	83 c4 10             	add    $0x10,%esp
+  801e34:	85 c0                	test   %eax,%eax
+  801e36:	78 58                	js     801e90 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801e38:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801e3e:	83 ec 04             	sub    $0x4,%esp
+  801e41:	68 00 10 00 00       	push   $0x1000
+  801e46:	56                   	push   %esi
+  801e47:	53                   	push   %ebx
+  801e48:	e8 0a f8 ff ff       	call   801657 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801e4d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801e54:	56                   	push   %esi
+  801e55:	6a 00                	push   $0x0
+  801e57:	53                   	push   %ebx
+  801e58:	6a 00                	push   $0x0
+  801e5a:	e8 bf fa ff ff       	call   80191e <sys_page_map>
+  801e5f:	83 c4 20             	add    $0x20,%esp
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 3c                	js     801ea2 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801e66:	83 ec 08             	sub    $0x8,%esp
+  801e69:	53                   	push   %ebx
+  801e6a:	6a 00                	push   $0x0
+  801e6c:	e8 ef fa ff ff       	call   801960 <sys_page_unmap>
+  801e71:	83 c4 10             	add    $0x10,%esp
+  801e74:	85 c0                	test   %eax,%eax
+  801e76:	78 3c                	js     801eb4 <pgfault+0x13c>
+	if(m)
+  801e78:	85 ff                	test   %edi,%edi
+  801e7a:	74 0c                	je     801e88 <pgfault+0x110>
+		mutex_unlock(m);
+  801e7c:	83 ec 0c             	sub    $0xc,%esp
+  801e7f:	57                   	push   %edi
+  801e80:	e8 77 34 00 00       	call   8052fc <mutex_unlock>
+  801e85:	83 c4 10             	add    $0x10,%esp
+}
+  801e88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8b:	5b                   	pop    %ebx
+  801e8c:	5e                   	pop    %esi
+  801e8d:	5f                   	pop    %edi
+  801e8e:	5d                   	pop    %ebp
+  801e8f:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801e90:	50                   	push   %eax
+  801e91:	68 cf 5f 80 00       	push   $0x805fcf
+  801e96:	6a 3d                	push   $0x3d
+  801e98:	68 c4 5f 80 00       	push   $0x805fc4
+  801e9d:	e8 43 ed ff ff       	call   800be5 <_panic>
+		panic("sys_page_map: %e", ret);
+  801ea2:	50                   	push   %eax
+  801ea3:	68 e2 5f 80 00       	push   $0x805fe2
+  801ea8:	6a 40                	push   $0x40
+  801eaa:	68 c4 5f 80 00       	push   $0x805fc4
+  801eaf:	e8 31 ed ff ff       	call   800be5 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801eb4:	50                   	push   %eax
+  801eb5:	68 f3 5f 80 00       	push   $0x805ff3
+  801eba:	6a 42                	push   $0x42
+  801ebc:	68 c4 5f 80 00       	push   $0x805fc4
+  801ec1:	e8 1f ed ff ff       	call   800be5 <_panic>
+
+00801ec6 <thread_main>:
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801ecc:	ff 75 0c             	push   0xc(%ebp)
+  801ecf:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801ed2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ed9:	e8 7e f9 ff ff       	call   80185c <sys_env_destroy>
+}
+  801ede:	83 c4 10             	add    $0x10,%esp
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+00801ee3 <fork>:
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	57                   	push   %edi
+  801ee7:	56                   	push   %esi
+  801ee8:	53                   	push   %ebx
+  801ee9:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801eec:	68 78 1d 80 00       	push   $0x801d78
+  801ef1:	e8 0d 35 00 00       	call   805403 <set_pgfault_handler>
+	if(sforked)
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	83 3d e0 94 80 00 00 	cmpl   $0x0,0x8094e0
+  801f00:	75 33                	jne    801f35 <fork+0x52>
+	__asm __volatile("int %2"
+  801f02:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f07:	cd 30                	int    $0x30
+  801f09:	89 c7                	mov    %eax,%edi
+  801f0b:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	0f 88 b4 00 00 00    	js     801fc9 <fork+0xe6>
+	if(envid == 0) {
+  801f15:	0f 84 c3 00 00 00    	je     801fde <fork+0xfb>
+	pgbatch_init(&pb);
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+  801f1e:	68 40 87 80 00       	push   $0x808740
+  801f23:	e8 b2 31 00 00       	call   8050da <pgbatch_init>
+  801f28:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801f2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f30:	e9 9c 01 00 00       	jmp    8020d1 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801f35:	83 ec 0c             	sub    $0xc,%esp
+  801f38:	68 e0 8a 80 00       	push   $0x808ae0
+  801f3d:	e8 4c 33 00 00       	call   80528e <mutex_lock>
+  801f42:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801f4a:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801f4f:	eb 08                	jmp    801f59 <fork+0x76>
+  801f51:	83 c3 01             	add    $0x1,%ebx
+  801f54:	83 fb 20             	cmp    $0x20,%ebx
+  801f57:	74 5b                	je     801fb4 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801f59:	8b 34 9d 60 8a 80 00 	mov    0x808a60(,%ebx,4),%esi
+  801f60:	89 f0                	mov    %esi,%eax
+  801f62:	e8 d7 fd ff ff       	call   801d3e <thread_alive>
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	74 e6                	je     801f51 <fork+0x6e>
+  801f6b:	89 e0                	mov    %esp,%eax
+  801f6d:	89 fa                	mov    %edi,%edx
+  801f6f:	29 c2                	sub    %eax,%edx
+  801f71:	89 d0                	mov    %edx,%eax
+  801f73:	c1 e8 0f             	shr    $0xf,%eax
+  801f76:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801f7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f81:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  801f84:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  801f8b:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801f8e:	83 ec 08             	sub    $0x8,%esp
+  801f91:	50                   	push   %eax
+  801f92:	56                   	push   %esi
+  801f93:	e8 8e fa ff ff       	call   801a26 <sys_env_set_pgfault_upcall>
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	79 b2                	jns    801f51 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801f9f:	50                   	push   %eax
+  801fa0:	68 80 60 80 00       	push   $0x806080
+  801fa5:	68 00 01 00 00       	push   $0x100
+  801faa:	68 c4 5f 80 00       	push   $0x805fc4
+  801faf:	e8 31 ec ff ff       	call   800be5 <_panic>
+	mutex_unlock(&sfork_lock);
+  801fb4:	83 ec 0c             	sub    $0xc,%esp
+  801fb7:	68 e0 8a 80 00       	push   $0x808ae0
+  801fbc:	e8 3b 33 00 00       	call   8052fc <mutex_unlock>
+}
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	e9 39 ff ff ff       	jmp    801f02 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801fc9:	50                   	push   %eax
+  801fca:	68 06 60 80 00       	push   $0x806006
+  801fcf:	68 91 00 00 00       	push   $0x91
+  801fd4:	68 c4 5f 80 00       	push   $0x805fc4
+  801fd9:	e8 07 ec ff ff       	call   800be5 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801fde:	e8 ba f8 ff ff       	call   80189d <sys_getenvid>
+  801fe3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801fe8:	89 e1                	mov    %esp,%ecx
+  801fea:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801fef:	29 ca                	sub    %ecx,%edx
+  801ff1:	89 d1                	mov    %edx,%ecx
+  801ff3:	c1 e9 0f             	shr    $0xf,%ecx
+  801ff6:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802001:	0f 42 d1             	cmovb  %ecx,%edx
+  802004:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80200a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80200f:	89 04 95 60 94 80 00 	mov    %eax,0x809460(,%edx,4)
+		if(sforked)
+  802016:	a1 e0 94 80 00       	mov    0x8094e0,%eax
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	75 07                	jne    802026 <fork+0x143>
+		return 0;
+  80201f:	89 c6                	mov    %eax,%esi
+  802021:	e9 6f 02 00 00       	jmp    802295 <fork+0x3b2>
+  802026:	89 e2                	mov    %esp,%edx
+  802028:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80202d:	29 d0                	sub    %edx,%eax
+  80202f:	89 c3                	mov    %eax,%ebx
+  802031:	c1 eb 0f             	shr    $0xf,%ebx
+  802034:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203e:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  802041:	83 ec 04             	sub    $0x4,%esp
+  802044:	68 80 00 00 00       	push   $0x80
+  802049:	6a 00                	push   $0x0
+  80204b:	68 60 8a 80 00       	push   $0x808a60
+  802050:	e8 cd f5 ff ff       	call   801622 <memset>
+	thread_ids[slot] = sys_getenvid();
+  802055:	e8 43 f8 ff ff       	call   80189d <sys_getenvid>
+  80205a:	89 04 9d 60 8a 80 00 	mov    %eax,0x808a60(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  802061:	8b 04 9d 60 94 80 00 	mov    0x809460(,%ebx,4),%eax
+  802068:	a3 60 94 80 00       	mov    %eax,0x809460
+	mutex_init(&sfork_lock);
+  80206d:	c7 04 24 e0 8a 80 00 	movl   $0x808ae0,(%esp)
+  802074:	e8 07 32 00 00       	call   805280 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802079:	83 c4 0c             	add    $0xc,%esp
+  80207c:	68 07 04 00 00       	push   $0x407
+  802081:	68 00 00 00 e1       	push   $0xe1000000
+  802086:	6a 00                	push   $0x0
+  802088:	e8 4e f8 ff ff       	call   8018db <sys_page_alloc>
+  80208d:	83 c4 10             	add    $0x10,%esp
+  802090:	85 c0                	test   %eax,%eax
+  802092:	0f 89 fd 01 00 00    	jns    802295 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  802098:	50                   	push   %eax
+  802099:	68 cf 5f 80 00       	push   $0x805fcf
+  80209e:	68 12 01 00 00       	push   $0x112
+  8020a3:	68 c4 5f 80 00       	push   $0x805fc4
+  8020a8:	e8 38 eb ff ff       	call   800be5 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8020ad:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8020b3:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8020b9:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8020bf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020c5:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8020cb:	0f 87 4f 01 00 00    	ja     802220 <fork+0x33d>
+		pd = PDX(addr);
+  8020d1:	89 d8                	mov    %ebx,%eax
+  8020d3:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8020d6:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8020dd:	f6 c2 01             	test   $0x1,%dl
+  8020e0:	74 cb                	je     8020ad <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8020e2:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8020e7:	0f 85 92 00 00 00    	jne    80217f <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8020ed:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8020f3:	76 10                	jbe    802105 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8020f5:	89 d8                	mov    %ebx,%eax
+  8020f7:	f7 d8                	neg    %eax
+  8020f9:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8020fe:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802103:	74 ba                	je     8020bf <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  802105:	89 d8                	mov    %ebx,%eax
+  802107:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80210a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802111:	f6 c2 01             	test   $0x1,%dl
+  802114:	74 a9                	je     8020bf <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  802116:	89 c1                	mov    %eax,%ecx
+  802118:	c1 e1 0c             	shl    $0xc,%ecx
+  80211b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  80211e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802125:	f6 c6 04             	test   $0x4,%dh
+  802128:	0f 85 8e 00 00 00    	jne    8021bc <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  80212e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802135:	f6 c6 08             	test   $0x8,%dh
+  802138:	75 0f                	jne    802149 <fork+0x266>
+  80213a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802141:	a8 02                	test   $0x2,%al
+  802143:	0f 84 bb 00 00 00    	je     802204 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  802149:	83 ec 08             	sub    $0x8,%esp
+  80214c:	68 05 08 00 00       	push   $0x805
+  802151:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802154:	50                   	push   %eax
+  802155:	56                   	push   %esi
+  802156:	50                   	push   %eax
+  802157:	6a 00                	push   $0x0
+  802159:	68 40 87 80 00       	push   $0x808740
+  80215e:	e8 35 30 00 00       	call   805198 <pgbatch_map>
+  802163:	83 c4 20             	add    $0x20,%esp
+  802166:	85 c0                	test   %eax,%eax
+  802168:	79 76                	jns    8021e0 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  80216a:	50                   	push   %eax
+  80216b:	68 2a 60 80 00       	push   $0x80602a
+  802170:	68 bc 00 00 00       	push   $0xbc
+  802175:	68 c4 5f 80 00       	push   $0x805fc4
+  80217a:	e8 66 ea ff ff       	call   800be5 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  80217f:	83 ec 0c             	sub    $0xc,%esp
+  802182:	68 00 08 00 00       	push   $0x800
+  802187:	56                   	push   %esi
+  802188:	53                   	push   %ebx
+  802189:	6a 00                	push   $0x0
+  80218b:	68 40 87 80 00       	push   $0x808740
+  802190:	e8 ae 30 00 00       	call   805243 <pgbatch_sharept>
+  802195:	83 c4 20             	add    $0x20,%esp
+  802198:	85 c0                	test   %eax,%eax
+  80219a:	78 0b                	js     8021a7 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  80219c:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8021a2:	e9 18 ff ff ff       	jmp    8020bf <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8021a7:	50                   	push   %eax
+  8021a8:	68 16 60 80 00       	push   $0x806016
+  8021ad:	68 b2 00 00 00       	push   $0xb2
+  8021b2:	68 c4 5f 80 00       	push   $0x805fc4
+  8021b7:	e8 29 ea ff ff       	call   800be5 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8021bc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021c3:	83 ec 08             	sub    $0x8,%esp
+  8021c6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021cb:	50                   	push   %eax
+  8021cc:	51                   	push   %ecx
+  8021cd:	56                   	push   %esi
+  8021ce:	51                   	push   %ecx
+  8021cf:	6a 00                	push   $0x0
+  8021d1:	68 40 87 80 00       	push   $0x808740
+  8021d6:	e8 bd 2f 00 00       	call   805198 <pgbatch_map>
+  8021db:	83 c4 20             	add    $0x20,%esp
+  8021de:	eb 17                	jmp    8021f7 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8021e0:	68 05 08 00 00       	push   $0x805
+  8021e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	68 40 87 80 00       	push   $0x808740
+  8021ef:	e8 18 30 00 00       	call   80520c <pgbatch_protect>
+  8021f4:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	0f 89 c0 fe ff ff    	jns    8020bf <fork+0x1dc>
+  8021ff:	e9 66 ff ff ff       	jmp    80216a <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  802204:	83 ec 08             	sub    $0x8,%esp
+  802207:	6a 05                	push   $0x5
+  802209:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80220c:	50                   	push   %eax
+  80220d:	56                   	push   %esi
+  80220e:	50                   	push   %eax
+  80220f:	6a 00                	push   $0x0
+  802211:	68 40 87 80 00       	push   $0x808740
+  802216:	e8 7d 2f 00 00       	call   805198 <pgbatch_map>
+  80221b:	83 c4 20             	add    $0x20,%esp
+  80221e:	eb d7                	jmp    8021f7 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  802220:	6a 07                	push   $0x7
+  802222:	68 00 f0 bf ee       	push   $0xeebff000
+  802227:	57                   	push   %edi
+  802228:	68 40 87 80 00       	push   $0x808740
+  80222d:	e8 2f 2f 00 00       	call   805161 <pgbatch_alloc>
+  802232:	83 c4 10             	add    $0x10,%esp
+  802235:	85 c0                	test   %eax,%eax
+  802237:	78 66                	js     80229f <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  802239:	83 ec 0c             	sub    $0xc,%esp
+  80223c:	68 40 87 80 00       	push   $0x808740
+  802241:	e8 a2 2e 00 00       	call   8050e8 <pgbatch_flush>
+  802246:	83 c4 10             	add    $0x10,%esp
+  802249:	85 c0                	test   %eax,%eax
+  80224b:	78 52                	js     80229f <fork+0x3bc>
+  80224d:	89 e2                	mov    %esp,%edx
+  80224f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802254:	29 d0                	sub    %edx,%eax
+  802256:	89 c2                	mov    %eax,%edx
+  802258:	c1 ea 0f             	shr    $0xf,%edx
+  80225b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802260:	b8 00 00 00 00       	mov    $0x0,%eax
+  802265:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  802268:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  80226f:	8b 40 78             	mov    0x78(%eax),%eax
+  802272:	83 ec 08             	sub    $0x8,%esp
+  802275:	50                   	push   %eax
+  802276:	57                   	push   %edi
+  802277:	e8 aa f7 ff ff       	call   801a26 <sys_env_set_pgfault_upcall>
+  80227c:	83 c4 10             	add    $0x10,%esp
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	78 31                	js     8022b4 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  802283:	83 ec 08             	sub    $0x8,%esp
+  802286:	6a 02                	push   $0x2
+  802288:	57                   	push   %edi
+  802289:	e8 14 f7 ff ff       	call   8019a2 <sys_env_set_status>
+  80228e:	83 c4 10             	add    $0x10,%esp
+  802291:	85 c0                	test   %eax,%eax
+  802293:	78 34                	js     8022c9 <fork+0x3e6>
+}
+  802295:	89 f0                	mov    %esi,%eax
+  802297:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80229a:	5b                   	pop    %ebx
+  80229b:	5e                   	pop    %esi
+  80229c:	5f                   	pop    %edi
+  80229d:	5d                   	pop    %ebp
+  80229e:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  80229f:	50                   	push   %eax
+  8022a0:	68 36 60 80 00       	push   $0x806036
+  8022a5:	68 c0 00 00 00       	push   $0xc0
+  8022aa:	68 c4 5f 80 00       	push   $0x805fc4
+  8022af:	e8 31 e9 ff ff       	call   800be5 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  8022b4:	50                   	push   %eax
+  8022b5:	68 4b 60 80 00       	push   $0x80604b
+  8022ba:	68 c2 00 00 00       	push   $0xc2
+  8022bf:	68 c4 5f 80 00       	push   $0x805fc4
+  8022c4:	e8 1c e9 ff ff       	call   800be5 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  8022c9:	50                   	push   %eax
+  8022ca:	68 66 60 80 00       	push   $0x806066
+  8022cf:	68 c4 00 00 00       	push   $0xc4
+  8022d4:	68 c4 5f 80 00       	push   $0x805fc4
+  8022d9:	e8 07 e9 ff ff       	call   800be5 <_panic>
+
+008022de <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  8022de:	55                   	push   %ebp
+  8022df:	89 e5                	mov    %esp,%ebp
+  8022e1:	57                   	push   %edi
+  8022e2:	56                   	push   %esi
+  8022e3:	53                   	push   %ebx
+  8022e4:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8022e7:	68 e0 8a 80 00       	push   $0x808ae0
+  8022ec:	e8 9d 2f 00 00       	call   80528e <mutex_lock>
+  8022f1:	89 e2                	mov    %esp,%edx
+  8022f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8022f8:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  8022fa:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8022fd:	89 c3                	mov    %eax,%ebx
+  8022ff:	c1 eb 0f             	shr    $0xf,%ebx
+  802302:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230c:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  80230f:	e8 89 f5 ff ff       	call   80189d <sys_getenvid>
+  802314:	89 04 9d 60 8a 80 00 	mov    %eax,0x808a60(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  80231b:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802320:	8b 04 9d 60 8a 80 00 	mov    0x808a60(,%ebx,4),%eax
+  802327:	e8 12 fa ff ff       	call   801d3e <thread_alive>
+  80232c:	85 c0                	test   %eax,%eax
+  80232e:	74 24                	je     802354 <sfork+0x76>
+  802330:	83 c3 01             	add    $0x1,%ebx
+  802333:	83 fb 20             	cmp    $0x20,%ebx
+  802336:	75 e8                	jne    802320 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  802338:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  80233d:	83 ec 0c             	sub    $0xc,%esp
+  802340:	68 e0 8a 80 00       	push   $0x808ae0
+  802345:	e8 b2 2f 00 00       	call   8052fc <mutex_unlock>
+	return r;
+}
+  80234a:	89 f0                	mov    %esi,%eax
+  80234c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80234f:	5b                   	pop    %ebx
+  802350:	5e                   	pop    %esi
+  802351:	5f                   	pop    %edi
+  802352:	5d                   	pop    %ebp
+  802353:	c3                   	ret
+	if (i == NTHREADS) {
+  802354:	83 fb 20             	cmp    $0x20,%ebx
+  802357:	0f 84 53 01 00 00    	je     8024b0 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  80235d:	89 d8                	mov    %ebx,%eax
+  80235f:	c1 e0 0f             	shl    $0xf,%eax
+  802362:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  802365:	83 ec 0c             	sub    $0xc,%esp
+  802368:	68 20 84 80 00       	push   $0x808420
+  80236d:	e8 68 2d 00 00       	call   8050da <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  802372:	83 c4 10             	add    $0x10,%esp
+  802375:	83 3d e0 94 80 00 00 	cmpl   $0x0,0x8094e0
+  80237c:	75 1f                	jne    80239d <sfork+0xbf>
+  80237e:	68 07 04 00 00       	push   $0x407
+  802383:	68 00 00 00 e1       	push   $0xe1000000
+  802388:	6a 00                	push   $0x0
+  80238a:	68 20 84 80 00       	push   $0x808420
+  80238f:	e8 cd 2d 00 00       	call   805161 <pgbatch_alloc>
+  802394:	89 c6                	mov    %eax,%esi
+  802396:	83 c4 10             	add    $0x10,%esp
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	78 a0                	js     80233d <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  80239d:	6a 07                	push   $0x7
+  80239f:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  8023a4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023a7:	29 c8                	sub    %ecx,%eax
+  8023a9:	50                   	push   %eax
+  8023aa:	6a 00                	push   $0x0
+  8023ac:	68 20 84 80 00       	push   $0x808420
+  8023b1:	e8 ab 2d 00 00       	call   805161 <pgbatch_alloc>
+  8023b6:	89 c6                	mov    %eax,%esi
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	85 c0                	test   %eax,%eax
+  8023bd:	0f 88 7a ff ff ff    	js     80233d <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  8023c3:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  8023c8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023cb:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  8023cd:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8023d2:	29 c8                	sub    %ecx,%eax
+  8023d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023d7:	39 c7                	cmp    %eax,%edi
+  8023d9:	73 29                	jae    802404 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  8023db:	6a 07                	push   $0x7
+  8023dd:	57                   	push   %edi
+  8023de:	6a 00                	push   $0x0
+  8023e0:	68 20 84 80 00       	push   $0x808420
+  8023e5:	e8 77 2d 00 00       	call   805161 <pgbatch_alloc>
+  8023ea:	89 c6                	mov    %eax,%esi
+  8023ec:	83 c4 10             	add    $0x10,%esp
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	0f 88 46 ff ff ff    	js     80233d <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  8023f7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8023fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802400:	39 c7                	cmp    %eax,%edi
+  802402:	72 d7                	jb     8023db <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  802404:	83 ec 0c             	sub    $0xc,%esp
+  802407:	68 20 84 80 00       	push   $0x808420
+  80240c:	e8 d7 2c 00 00       	call   8050e8 <pgbatch_flush>
+  802411:	89 c6                	mov    %eax,%esi
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	85 c0                	test   %eax,%eax
+  802418:	0f 88 1f ff ff ff    	js     80233d <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  80241e:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  802423:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802426:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  802428:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  80242e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802431:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  802434:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802437:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  80243a:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  80243d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802442:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  802444:	52                   	push   %edx
+  802445:	50                   	push   %eax
+  802446:	68 c6 1e 80 00       	push   $0x801ec6
+  80244b:	e8 cc f8 ff ff       	call   801d1c <sys_exofork_shared>
+  802450:	89 c6                	mov    %eax,%esi
+  802452:	83 c4 10             	add    $0x10,%esp
+  802455:	85 c0                	test   %eax,%eax
+  802457:	0f 88 e0 fe ff ff    	js     80233d <sfork+0x5f>
+	thread_ids[i] = id;
+  80245d:	89 04 9d 60 8a 80 00 	mov    %eax,0x808a60(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  802464:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802469:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80246f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802474:	89 04 9d 60 94 80 00 	mov    %eax,0x809460(,%ebx,4)
+	sforked = 1;
+  80247b:	c7 05 e0 94 80 00 01 	movl   $0x1,0x8094e0
+  802482:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  802485:	83 ec 08             	sub    $0x8,%esp
+  802488:	6a 02                	push   $0x2
+  80248a:	56                   	push   %esi
+  80248b:	e8 12 f5 ff ff       	call   8019a2 <sys_env_set_status>
+  802490:	89 c3                	mov    %eax,%ebx
+  802492:	83 c4 10             	add    $0x10,%esp
+  802495:	85 c0                	test   %eax,%eax
+  802497:	0f 89 a0 fe ff ff    	jns    80233d <sfork+0x5f>
+		sys_env_destroy(id);
+  80249d:	83 ec 0c             	sub    $0xc,%esp
+  8024a0:	56                   	push   %esi
+  8024a1:	e8 b6 f3 ff ff       	call   80185c <sys_env_destroy>
+		goto out;
+  8024a6:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8024a9:	89 de                	mov    %ebx,%esi
+		goto out;
+  8024ab:	e9 8d fe ff ff       	jmp    80233d <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  8024b0:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  8024b5:	e9 83 fe ff ff       	jmp    80233d <sfork+0x5f>
+
+008024ba <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  8024ba:	55                   	push   %ebp
+  8024bb:	89 e5                	mov    %esp,%ebp
+  8024bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024c3:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  8024c6:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  8024c8:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  8024cb:	83 3a 01             	cmpl   $0x1,(%edx)
+  8024ce:	7e 09                	jle    8024d9 <argstart+0x1f>
+  8024d0:	ba e1 59 80 00       	mov    $0x8059e1,%edx
+  8024d5:	85 c9                	test   %ecx,%ecx
+  8024d7:	75 05                	jne    8024de <argstart+0x24>
+  8024d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024de:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8024e1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8024e8:	5d                   	pop    %ebp
+  8024e9:	c3                   	ret
+
+008024ea <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8024ea:	55                   	push   %ebp
+  8024eb:	89 e5                	mov    %esp,%ebp
+  8024ed:	53                   	push   %ebx
+  8024ee:	83 ec 04             	sub    $0x4,%esp
+  8024f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8024f4:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8024fb:	8b 43 08             	mov    0x8(%ebx),%eax
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	74 74                	je     802576 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  802502:	80 38 00             	cmpb   $0x0,(%eax)
+  802505:	75 48                	jne    80254f <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  802507:	8b 0b                	mov    (%ebx),%ecx
+  802509:	83 39 01             	cmpl   $0x1,(%ecx)
+  80250c:	74 5a                	je     802568 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  80250e:	8b 53 04             	mov    0x4(%ebx),%edx
+  802511:	8b 42 04             	mov    0x4(%edx),%eax
+  802514:	80 38 2d             	cmpb   $0x2d,(%eax)
+  802517:	75 4f                	jne    802568 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  802519:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80251d:	74 49                	je     802568 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  80251f:	83 c0 01             	add    $0x1,%eax
+  802522:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802525:	83 ec 04             	sub    $0x4,%esp
+  802528:	8b 01                	mov    (%ecx),%eax
+  80252a:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  802531:	50                   	push   %eax
+  802532:	8d 42 08             	lea    0x8(%edx),%eax
+  802535:	50                   	push   %eax
+  802536:	83 c2 04             	add    $0x4,%edx
+  802539:	52                   	push   %edx
+  80253a:	e8 18 f1 ff ff       	call   801657 <memmove>
+		(*args->argc)--;
+  80253f:	8b 03                	mov    (%ebx),%eax
+  802541:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802544:	8b 43 08             	mov    0x8(%ebx),%eax
+  802547:	83 c4 10             	add    $0x10,%esp
+  80254a:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80254d:	74 13                	je     802562 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  80254f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802552:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  802555:	83 c0 01             	add    $0x1,%eax
+  802558:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  80255b:	89 d0                	mov    %edx,%eax
+  80255d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802560:	c9                   	leave
+  802561:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802562:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  802566:	75 e7                	jne    80254f <argnext+0x65>
+	args->curarg = 0;
+  802568:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  80256f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802574:	eb e5                	jmp    80255b <argnext+0x71>
+		return -1;
+  802576:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80257b:	eb de                	jmp    80255b <argnext+0x71>
+
+0080257d <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  80257d:	55                   	push   %ebp
+  80257e:	89 e5                	mov    %esp,%ebp
+  802580:	53                   	push   %ebx
+  802581:	83 ec 04             	sub    $0x4,%esp
+  802584:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  802587:	8b 43 08             	mov    0x8(%ebx),%eax
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	74 12                	je     8025a0 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  80258e:	80 38 00             	cmpb   $0x0,(%eax)
+  802591:	74 12                	je     8025a5 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  802593:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  802596:	c7 43 08 e1 59 80 00 	movl   $0x8059e1,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  80259d:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8025a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a3:	c9                   	leave
+  8025a4:	c3                   	ret
+	} else if (*args->argc > 1) {
+  8025a5:	8b 13                	mov    (%ebx),%edx
+  8025a7:	83 3a 01             	cmpl   $0x1,(%edx)
+  8025aa:	7f 10                	jg     8025bc <argnextvalue+0x3f>
+		args->argvalue = 0;
+  8025ac:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  8025b3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8025ba:	eb e1                	jmp    80259d <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  8025bc:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025bf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025c2:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8025c5:	83 ec 04             	sub    $0x4,%esp
+  8025c8:	8b 12                	mov    (%edx),%edx
+  8025ca:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8025d1:	52                   	push   %edx
+  8025d2:	8d 50 08             	lea    0x8(%eax),%edx
+  8025d5:	52                   	push   %edx
+  8025d6:	83 c0 04             	add    $0x4,%eax
+  8025d9:	50                   	push   %eax
+  8025da:	e8 78 f0 ff ff       	call   801657 <memmove>
+		(*args->argc)--;
+  8025df:	8b 03                	mov    (%ebx),%eax
+  8025e1:	83 28 01             	subl   $0x1,(%eax)
+  8025e4:	83 c4 10             	add    $0x10,%esp
+  8025e7:	eb b4                	jmp    80259d <argnextvalue+0x20>
+
+008025e9 <argvalue>:
+{
+  8025e9:	55                   	push   %ebp
+  8025ea:	89 e5                	mov    %esp,%ebp
+  8025ec:	83 ec 08             	sub    $0x8,%esp
+  8025ef:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8025f2:	8b 42 0c             	mov    0xc(%edx),%eax
+  8025f5:	85 c0                	test   %eax,%eax
+  8025f7:	74 02                	je     8025fb <argvalue+0x12>
+}
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8025fb:	83 ec 0c             	sub    $0xc,%esp
+  8025fe:	52                   	push   %edx
+  8025ff:	e8 79 ff ff ff       	call   80257d <argnextvalue>
+  802604:	83 c4 10             	add    $0x10,%esp
+  802607:	eb f0                	jmp    8025f9 <argvalue+0x10>
+
+00802609 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802609:	55                   	push   %ebp
+  80260a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80260c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260f:	05 00 00 00 30       	add    $0x30000000,%eax
+  802614:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802617:	5d                   	pop    %ebp
+  802618:	c3                   	ret
+
+00802619 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80261c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802624:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802629:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80262e:	5d                   	pop    %ebp
+  80262f:	c3                   	ret
+
+00802630 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802630:	55                   	push   %ebp
+  802631:	89 e5                	mov    %esp,%ebp
+  802633:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  802638:	89 c2                	mov    %eax,%edx
+  80263a:	c1 ea 16             	shr    $0x16,%edx
+  80263d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802644:	f6 c2 01             	test   $0x1,%dl
+  802647:	74 29                	je     802672 <fd_alloc+0x42>
+  802649:	89 c2                	mov    %eax,%edx
+  80264b:	c1 ea 0c             	shr    $0xc,%edx
+  80264e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802655:	f6 c2 01             	test   $0x1,%dl
+  802658:	74 18                	je     802672 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80265a:	05 00 10 00 00       	add    $0x1000,%eax
+  80265f:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  802664:	75 d2                	jne    802638 <fd_alloc+0x8>
+  802666:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80266b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802670:	eb 05                	jmp    802677 <fd_alloc+0x47>
+			return 0;
+  802672:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802677:	8b 55 08             	mov    0x8(%ebp),%edx
+  80267a:	89 02                	mov    %eax,(%edx)
+}
+  80267c:	89 c8                	mov    %ecx,%eax
+  80267e:	5d                   	pop    %ebp
+  80267f:	c3                   	ret
+
+00802680 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802680:	55                   	push   %ebp
+  802681:	89 e5                	mov    %esp,%ebp
+  802683:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802686:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80268b:	77 30                	ja     8026bd <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80268d:	c1 e0 0c             	shl    $0xc,%eax
+  802690:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  802695:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80269b:	f6 c2 01             	test   $0x1,%dl
+  80269e:	74 24                	je     8026c4 <fd_lookup+0x44>
+  8026a0:	89 c2                	mov    %eax,%edx
+  8026a2:	c1 ea 0c             	shr    $0xc,%edx
+  8026a5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8026ac:	f6 c2 01             	test   $0x1,%dl
+  8026af:	74 1a                	je     8026cb <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8026b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026b4:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8026b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026bb:	5d                   	pop    %ebp
+  8026bc:	c3                   	ret
+		return -E_INVAL;
+  8026bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026c2:	eb f7                	jmp    8026bb <fd_lookup+0x3b>
+		return -E_INVAL;
+  8026c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026c9:	eb f0                	jmp    8026bb <fd_lookup+0x3b>
+  8026cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026d0:	eb e9                	jmp    8026bb <fd_lookup+0x3b>
+
+008026d2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8026d2:	55                   	push   %ebp
+  8026d3:	89 e5                	mov    %esp,%ebp
+  8026d5:	53                   	push   %ebx
+  8026d6:	83 ec 04             	sub    $0x4,%esp
+  8026d9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8026dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e1:	bb 60 70 80 00       	mov    $0x807060,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8026e6:	39 13                	cmp    %edx,(%ebx)
+  8026e8:	74 54                	je     80273e <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8026ea:	83 c0 01             	add    $0x1,%eax
+  8026ed:	8b 1c 85 1c 61 80 00 	mov    0x80611c(,%eax,4),%ebx
+  8026f4:	85 db                	test   %ebx,%ebx
+  8026f6:	75 ee                	jne    8026e6 <dev_lookup+0x14>
+  8026f8:	89 e1                	mov    %esp,%ecx
+  8026fa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8026ff:	29 c8                	sub    %ecx,%eax
+  802701:	89 c1                	mov    %eax,%ecx
+  802703:	c1 e9 0f             	shr    $0xf,%ecx
+  802706:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80270b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802710:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802713:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  80271a:	8b 40 48             	mov    0x48(%eax),%eax
+  80271d:	83 ec 04             	sub    $0x4,%esp
+  802720:	52                   	push   %edx
+  802721:	50                   	push   %eax
+  802722:	68 a0 60 80 00       	push   $0x8060a0
+  802727:	e8 94 e5 ff ff       	call   800cc0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80272c:	83 c4 10             	add    $0x10,%esp
+  80272f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802734:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802737:	89 1a                	mov    %ebx,(%edx)
+}
+  802739:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80273c:	c9                   	leave
+  80273d:	c3                   	ret
+			return 0;
+  80273e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802743:	eb ef                	jmp    802734 <dev_lookup+0x62>
+
+00802745 <fd_close>:
+{
+  802745:	55                   	push   %ebp
+  802746:	89 e5                	mov    %esp,%ebp
+  802748:	57                   	push   %edi
+  802749:	56                   	push   %esi
+  80274a:	53                   	push   %ebx
+  80274b:	83 ec 24             	sub    $0x24,%esp
+  80274e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802751:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802754:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802757:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802758:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80275e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802761:	50                   	push   %eax
+  802762:	e8 19 ff ff ff       	call   802680 <fd_lookup>
+  802767:	89 c3                	mov    %eax,%ebx
+  802769:	83 c4 10             	add    $0x10,%esp
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	78 05                	js     802775 <fd_close+0x30>
+	    || fd != fd2)
+  802770:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802773:	74 0f                	je     802784 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  802775:	85 ff                	test   %edi,%edi
+  802777:	0f 44 df             	cmove  %edi,%ebx
+}
+  80277a:	89 d8                	mov    %ebx,%eax
+  80277c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80277f:	5b                   	pop    %ebx
+  802780:	5e                   	pop    %esi
+  802781:	5f                   	pop    %edi
+  802782:	5d                   	pop    %ebp
+  802783:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802784:	83 ec 08             	sub    $0x8,%esp
+  802787:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80278a:	50                   	push   %eax
+  80278b:	ff 36                	push   (%esi)
+  80278d:	e8 40 ff ff ff       	call   8026d2 <dev_lookup>
+  802792:	89 c3                	mov    %eax,%ebx
+  802794:	83 c4 10             	add    $0x10,%esp
+  802797:	85 c0                	test   %eax,%eax
+  802799:	78 1a                	js     8027b5 <fd_close+0x70>
+		if (dev->dev_close)
+  80279b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80279e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8027a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	74 0b                	je     8027b5 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8027aa:	83 ec 0c             	sub    $0xc,%esp
+  8027ad:	56                   	push   %esi
+  8027ae:	ff d0                	call   *%eax
+  8027b0:	89 c3                	mov    %eax,%ebx
+  8027b2:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8027b5:	83 ec 08             	sub    $0x8,%esp
+  8027b8:	56                   	push   %esi
+  8027b9:	6a 00                	push   $0x0
+  8027bb:	e8 a0 f1 ff ff       	call   801960 <sys_page_unmap>
+	return r;
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	eb b5                	jmp    80277a <fd_close+0x35>
+
+008027c5 <close>:
+
+int
+close(int fdnum)
+{
+  8027c5:	55                   	push   %ebp
+  8027c6:	89 e5                	mov    %esp,%ebp
+  8027c8:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ce:	50                   	push   %eax
+  8027cf:	ff 75 08             	push   0x8(%ebp)
+  8027d2:	e8 a9 fe ff ff       	call   802680 <fd_lookup>
+  8027d7:	83 c4 10             	add    $0x10,%esp
+  8027da:	85 c0                	test   %eax,%eax
+  8027dc:	79 02                	jns    8027e0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8027de:	c9                   	leave
+  8027df:	c3                   	ret
+		return fd_close(fd, 1);
+  8027e0:	83 ec 08             	sub    $0x8,%esp
+  8027e3:	6a 01                	push   $0x1
+  8027e5:	ff 75 f4             	push   -0xc(%ebp)
+  8027e8:	e8 58 ff ff ff       	call   802745 <fd_close>
+  8027ed:	83 c4 10             	add    $0x10,%esp
+  8027f0:	eb ec                	jmp    8027de <close+0x19>
+
+008027f2 <close_all>:
+
+void
+close_all(void)
+{
+  8027f2:	55                   	push   %ebp
+  8027f3:	89 e5                	mov    %esp,%ebp
+  8027f5:	53                   	push   %ebx
+  8027f6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8027f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8027fe:	83 ec 0c             	sub    $0xc,%esp
+  802801:	53                   	push   %ebx
+  802802:	e8 be ff ff ff       	call   8027c5 <close>
+	for (i = 0; i < MAXFD; i++)
+  802807:	83 c3 01             	add    $0x1,%ebx
+  80280a:	83 c4 10             	add    $0x10,%esp
+  80280d:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  802813:	75 e9                	jne    8027fe <close_all+0xc>
+}
+  802815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802818:	c9                   	leave
+  802819:	c3                   	ret
+
+0080281a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80281a:	55                   	push   %ebp
+  80281b:	89 e5                	mov    %esp,%ebp
+  80281d:	57                   	push   %edi
+  80281e:	56                   	push   %esi
+  80281f:	53                   	push   %ebx
+  802820:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802823:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802826:	50                   	push   %eax
+  802827:	ff 75 08             	push   0x8(%ebp)
+  80282a:	e8 51 fe ff ff       	call   802680 <fd_lookup>
+  80282f:	89 c3                	mov    %eax,%ebx
+  802831:	83 c4 10             	add    $0x10,%esp
+  802834:	85 c0                	test   %eax,%eax
+  802836:	78 7f                	js     8028b7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802838:	83 ec 0c             	sub    $0xc,%esp
+  80283b:	ff 75 0c             	push   0xc(%ebp)
+  80283e:	e8 82 ff ff ff       	call   8027c5 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802843:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802846:	c1 e6 0c             	shl    $0xc,%esi
+  802849:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80284f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802852:	89 3c 24             	mov    %edi,(%esp)
+  802855:	e8 bf fd ff ff       	call   802619 <fd2data>
+  80285a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80285c:	89 34 24             	mov    %esi,(%esp)
+  80285f:	e8 b5 fd ff ff       	call   802619 <fd2data>
+  802864:	83 c4 10             	add    $0x10,%esp
+  802867:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80286a:	89 d8                	mov    %ebx,%eax
+  80286c:	c1 e8 16             	shr    $0x16,%eax
+  80286f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802876:	a8 01                	test   $0x1,%al
+  802878:	74 11                	je     80288b <dup+0x71>
+  80287a:	89 d8                	mov    %ebx,%eax
+  80287c:	c1 e8 0c             	shr    $0xc,%eax
+  80287f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802886:	f6 c2 01             	test   $0x1,%dl
+  802889:	75 36                	jne    8028c1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80288b:	89 f8                	mov    %edi,%eax
+  80288d:	c1 e8 0c             	shr    $0xc,%eax
+  802890:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802897:	83 ec 0c             	sub    $0xc,%esp
+  80289a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80289f:	50                   	push   %eax
+  8028a0:	56                   	push   %esi
+  8028a1:	6a 00                	push   $0x0
+  8028a3:	57                   	push   %edi
+  8028a4:	6a 00                	push   $0x0
+  8028a6:	e8 73 f0 ff ff       	call   80191e <sys_page_map>
+  8028ab:	89 c3                	mov    %eax,%ebx
+  8028ad:	83 c4 20             	add    $0x20,%esp
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	78 33                	js     8028e7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8028b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8028b7:	89 d8                	mov    %ebx,%eax
+  8028b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028bc:	5b                   	pop    %ebx
+  8028bd:	5e                   	pop    %esi
+  8028be:	5f                   	pop    %edi
+  8028bf:	5d                   	pop    %ebp
+  8028c0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8028c1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8028c8:	83 ec 0c             	sub    $0xc,%esp
+  8028cb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8028d0:	50                   	push   %eax
+  8028d1:	ff 75 d4             	push   -0x2c(%ebp)
+  8028d4:	6a 00                	push   $0x0
+  8028d6:	53                   	push   %ebx
+  8028d7:	6a 00                	push   $0x0
+  8028d9:	e8 40 f0 ff ff       	call   80191e <sys_page_map>
+  8028de:	89 c3                	mov    %eax,%ebx
+  8028e0:	83 c4 20             	add    $0x20,%esp
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	79 a4                	jns    80288b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+  8028ea:	56                   	push   %esi
+  8028eb:	6a 00                	push   $0x0
+  8028ed:	e8 6e f0 ff ff       	call   801960 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8028f2:	83 c4 08             	add    $0x8,%esp
+  8028f5:	ff 75 d4             	push   -0x2c(%ebp)
+  8028f8:	6a 00                	push   $0x0
+  8028fa:	e8 61 f0 ff ff       	call   801960 <sys_page_unmap>
+	return r;
+  8028ff:	83 c4 10             	add    $0x10,%esp
+  802902:	eb b3                	jmp    8028b7 <dup+0x9d>
+
+00802904 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802904:	55                   	push   %ebp
+  802905:	89 e5                	mov    %esp,%ebp
+  802907:	56                   	push   %esi
+  802908:	53                   	push   %ebx
+  802909:	83 ec 18             	sub    $0x18,%esp
+  80290c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80290f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802912:	50                   	push   %eax
+  802913:	53                   	push   %ebx
+  802914:	e8 67 fd ff ff       	call   802680 <fd_lookup>
+  802919:	83 c4 10             	add    $0x10,%esp
+  80291c:	85 c0                	test   %eax,%eax
+  80291e:	78 3c                	js     80295c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802920:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802923:	83 ec 08             	sub    $0x8,%esp
+  802926:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802929:	50                   	push   %eax
+  80292a:	ff 36                	push   (%esi)
+  80292c:	e8 a1 fd ff ff       	call   8026d2 <dev_lookup>
+  802931:	83 c4 10             	add    $0x10,%esp
+  802934:	85 c0                	test   %eax,%eax
+  802936:	78 24                	js     80295c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802938:	8b 46 08             	mov    0x8(%esi),%eax
+  80293b:	83 e0 03             	and    $0x3,%eax
+  80293e:	83 f8 01             	cmp    $0x1,%eax
+  802941:	74 20                	je     802963 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802943:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802946:	8b 40 08             	mov    0x8(%eax),%eax
+  802949:	85 c0                	test   %eax,%eax
+  80294b:	74 54                	je     8029a1 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80294d:	83 ec 04             	sub    $0x4,%esp
+  802950:	ff 75 10             	push   0x10(%ebp)
+  802953:	ff 75 0c             	push   0xc(%ebp)
+  802956:	56                   	push   %esi
+  802957:	ff d0                	call   *%eax
+  802959:	83 c4 10             	add    $0x10,%esp
+}
+  80295c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80295f:	5b                   	pop    %ebx
+  802960:	5e                   	pop    %esi
+  802961:	5d                   	pop    %ebp
+  802962:	c3                   	ret
+  802963:	89 e2                	mov    %esp,%edx
+  802965:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80296a:	29 d0                	sub    %edx,%eax
+  80296c:	89 c2                	mov    %eax,%edx
+  80296e:	c1 ea 0f             	shr    $0xf,%edx
+  802971:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297b:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80297e:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  802985:	8b 40 48             	mov    0x48(%eax),%eax
+  802988:	83 ec 04             	sub    $0x4,%esp
+  80298b:	53                   	push   %ebx
+  80298c:	50                   	push   %eax
+  80298d:	68 e1 60 80 00       	push   $0x8060e1
+  802992:	e8 29 e3 ff ff       	call   800cc0 <cprintf>
+		return -E_INVAL;
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80299f:	eb bb                	jmp    80295c <read+0x58>
+		return -E_NOT_SUPP;
+  8029a1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029a6:	eb b4                	jmp    80295c <read+0x58>
+
+008029a8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8029a8:	55                   	push   %ebp
+  8029a9:	89 e5                	mov    %esp,%ebp
+  8029ab:	57                   	push   %edi
+  8029ac:	56                   	push   %esi
+  8029ad:	53                   	push   %ebx
+  8029ae:	83 ec 0c             	sub    $0xc,%esp
+  8029b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8029b4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8029b7:	85 f6                	test   %esi,%esi
+  8029b9:	74 30                	je     8029eb <readn+0x43>
+  8029bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c0:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8029c5:	83 ec 04             	sub    $0x4,%esp
+  8029c8:	89 f2                	mov    %esi,%edx
+  8029ca:	29 c2                	sub    %eax,%edx
+  8029cc:	52                   	push   %edx
+  8029cd:	01 f8                	add    %edi,%eax
+  8029cf:	50                   	push   %eax
+  8029d0:	ff 75 08             	push   0x8(%ebp)
+  8029d3:	e8 2c ff ff ff       	call   802904 <read>
+		if (m < 0)
+  8029d8:	83 c4 10             	add    $0x10,%esp
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	78 15                	js     8029f4 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8029df:	74 11                	je     8029f2 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8029e1:	01 c3                	add    %eax,%ebx
+  8029e3:	89 d8                	mov    %ebx,%eax
+  8029e5:	39 f3                	cmp    %esi,%ebx
+  8029e7:	72 dc                	jb     8029c5 <readn+0x1d>
+  8029e9:	eb 09                	jmp    8029f4 <readn+0x4c>
+  8029eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f0:	eb 02                	jmp    8029f4 <readn+0x4c>
+  8029f2:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8029f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f7:	5b                   	pop    %ebx
+  8029f8:	5e                   	pop    %esi
+  8029f9:	5f                   	pop    %edi
+  8029fa:	5d                   	pop    %ebp
+  8029fb:	c3                   	ret
+
+008029fc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8029fc:	55                   	push   %ebp
+  8029fd:	89 e5                	mov    %esp,%ebp
+  8029ff:	56                   	push   %esi
+  802a00:	53                   	push   %ebx
+  802a01:	83 ec 18             	sub    $0x18,%esp
+  802a04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802a07:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a0a:	50                   	push   %eax
+  802a0b:	53                   	push   %ebx
+  802a0c:	e8 6f fc ff ff       	call   802680 <fd_lookup>
+  802a11:	83 c4 10             	add    $0x10,%esp
+  802a14:	85 c0                	test   %eax,%eax
+  802a16:	78 37                	js     802a4f <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802a18:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802a1b:	83 ec 08             	sub    $0x8,%esp
+  802a1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a21:	50                   	push   %eax
+  802a22:	ff 36                	push   (%esi)
+  802a24:	e8 a9 fc ff ff       	call   8026d2 <dev_lookup>
+  802a29:	83 c4 10             	add    $0x10,%esp
+  802a2c:	85 c0                	test   %eax,%eax
+  802a2e:	78 1f                	js     802a4f <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a30:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802a34:	74 20                	je     802a56 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802a36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a39:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a3c:	85 c0                	test   %eax,%eax
+  802a3e:	74 54                	je     802a94 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802a40:	83 ec 04             	sub    $0x4,%esp
+  802a43:	ff 75 10             	push   0x10(%ebp)
+  802a46:	ff 75 0c             	push   0xc(%ebp)
+  802a49:	56                   	push   %esi
+  802a4a:	ff d0                	call   *%eax
+  802a4c:	83 c4 10             	add    $0x10,%esp
+}
+  802a4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a52:	5b                   	pop    %ebx
+  802a53:	5e                   	pop    %esi
+  802a54:	5d                   	pop    %ebp
+  802a55:	c3                   	ret
+  802a56:	89 e2                	mov    %esp,%edx
+  802a58:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802a5d:	29 d0                	sub    %edx,%eax
+  802a5f:	89 c2                	mov    %eax,%edx
+  802a61:	c1 ea 0f             	shr    $0xf,%edx
+  802a64:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6e:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802a71:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  802a78:	8b 40 48             	mov    0x48(%eax),%eax
+  802a7b:	83 ec 04             	sub    $0x4,%esp
+  802a7e:	53                   	push   %ebx
+  802a7f:	50                   	push   %eax
+  802a80:	68 fd 60 80 00       	push   $0x8060fd
+  802a85:	e8 36 e2 ff ff       	call   800cc0 <cprintf>
+		return -E_INVAL;
+  802a8a:	83 c4 10             	add    $0x10,%esp
+  802a8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a92:	eb bb                	jmp    802a4f <write+0x53>
+		return -E_NOT_SUPP;
+  802a94:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a99:	eb b4                	jmp    802a4f <write+0x53>
+
+00802a9b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802aa1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa4:	50                   	push   %eax
+  802aa5:	ff 75 08             	push   0x8(%ebp)
+  802aa8:	e8 d3 fb ff ff       	call   802680 <fd_lookup>
+  802aad:	83 c4 10             	add    $0x10,%esp
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	78 0e                	js     802ac2 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802ab4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ab7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aba:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802abd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ac2:	c9                   	leave
+  802ac3:	c3                   	ret
+
+00802ac4 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802ac4:	55                   	push   %ebp
+  802ac5:	89 e5                	mov    %esp,%ebp
+  802ac7:	53                   	push   %ebx
+  802ac8:	83 ec 1c             	sub    $0x1c,%esp
+  802acb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ace:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ad1:	50                   	push   %eax
+  802ad2:	ff 75 08             	push   0x8(%ebp)
+  802ad5:	e8 a6 fb ff ff       	call   802680 <fd_lookup>
+  802ada:	83 c4 10             	add    $0x10,%esp
+  802add:	85 c0                	test   %eax,%eax
+  802adf:	78 33                	js     802b14 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802ae1:	83 fb 03             	cmp    $0x3,%ebx
+  802ae4:	74 28                	je     802b0e <fcntl+0x4a>
+  802ae6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aeb:	83 fb 04             	cmp    $0x4,%ebx
+  802aee:	75 24                	jne    802b14 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802af0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802af3:	8b 41 08             	mov    0x8(%ecx),%eax
+  802af6:	80 e4 ef             	and    $0xef,%ah
+  802af9:	8b 55 10             	mov    0x10(%ebp),%edx
+  802afc:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802b02:	09 d0                	or     %edx,%eax
+  802b04:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0c:	eb 06                	jmp    802b14 <fcntl+0x50>
+		return fd->fd_omode;
+  802b0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b11:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802b14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b17:	c9                   	leave
+  802b18:	c3                   	ret
+
+00802b19 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802b19:	55                   	push   %ebp
+  802b1a:	89 e5                	mov    %esp,%ebp
+  802b1c:	56                   	push   %esi
+  802b1d:	53                   	push   %ebx
+  802b1e:	83 ec 18             	sub    $0x18,%esp
+  802b21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802b24:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802b27:	50                   	push   %eax
+  802b28:	53                   	push   %ebx
+  802b29:	e8 52 fb ff ff       	call   802680 <fd_lookup>
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	78 34                	js     802b69 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802b35:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802b38:	83 ec 08             	sub    $0x8,%esp
+  802b3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b3e:	50                   	push   %eax
+  802b3f:	ff 36                	push   (%esi)
+  802b41:	e8 8c fb ff ff       	call   8026d2 <dev_lookup>
+  802b46:	83 c4 10             	add    $0x10,%esp
+  802b49:	85 c0                	test   %eax,%eax
+  802b4b:	78 1c                	js     802b69 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802b4d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802b51:	74 1d                	je     802b70 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802b53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b56:	8b 40 18             	mov    0x18(%eax),%eax
+  802b59:	85 c0                	test   %eax,%eax
+  802b5b:	74 51                	je     802bae <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802b5d:	83 ec 08             	sub    $0x8,%esp
+  802b60:	ff 75 0c             	push   0xc(%ebp)
+  802b63:	56                   	push   %esi
+  802b64:	ff d0                	call   *%eax
+  802b66:	83 c4 10             	add    $0x10,%esp
+}
+  802b69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b6c:	5b                   	pop    %ebx
+  802b6d:	5e                   	pop    %esi
+  802b6e:	5d                   	pop    %ebp
+  802b6f:	c3                   	ret
+  802b70:	89 e2                	mov    %esp,%edx
+  802b72:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802b77:	29 d0                	sub    %edx,%eax
+  802b79:	89 c2                	mov    %eax,%edx
+  802b7b:	c1 ea 0f             	shr    $0xf,%edx
+  802b7e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b88:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  802b8b:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  802b92:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802b95:	83 ec 04             	sub    $0x4,%esp
+  802b98:	53                   	push   %ebx
+  802b99:	50                   	push   %eax
+  802b9a:	68 c0 60 80 00       	push   $0x8060c0
+  802b9f:	e8 1c e1 ff ff       	call   800cc0 <cprintf>
+		return -E_INVAL;
+  802ba4:	83 c4 10             	add    $0x10,%esp
+  802ba7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bac:	eb bb                	jmp    802b69 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802bae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bb3:	eb b4                	jmp    802b69 <ftruncate+0x50>
+
+00802bb5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802bb5:	55                   	push   %ebp
+  802bb6:	89 e5                	mov    %esp,%ebp
+  802bb8:	56                   	push   %esi
+  802bb9:	53                   	push   %ebx
+  802bba:	83 ec 18             	sub    $0x18,%esp
+  802bbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802bc0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802bc3:	50                   	push   %eax
+  802bc4:	ff 75 08             	push   0x8(%ebp)
+  802bc7:	e8 b4 fa ff ff       	call   802680 <fd_lookup>
+  802bcc:	83 c4 10             	add    $0x10,%esp
+  802bcf:	85 c0                	test   %eax,%eax
+  802bd1:	78 53                	js     802c26 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802bd3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802bd6:	83 ec 08             	sub    $0x8,%esp
+  802bd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bdc:	50                   	push   %eax
+  802bdd:	ff 36                	push   (%esi)
+  802bdf:	e8 ee fa ff ff       	call   8026d2 <dev_lookup>
+  802be4:	83 c4 10             	add    $0x10,%esp
+  802be7:	85 c0                	test   %eax,%eax
+  802be9:	78 3b                	js     802c26 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802beb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bee:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802bf2:	74 39                	je     802c2d <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802bf4:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802bf7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802bfe:	00 00 00 
+	stat->st_isdir = 0;
+  802c01:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c08:	00 00 00 
+	stat->st_version = 0;
+  802c0b:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802c12:	00 00 00 
+	stat->st_dev = dev;
+  802c15:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802c1b:	83 ec 08             	sub    $0x8,%esp
+  802c1e:	53                   	push   %ebx
+  802c1f:	56                   	push   %esi
+  802c20:	ff 50 14             	call   *0x14(%eax)
+  802c23:	83 c4 10             	add    $0x10,%esp
+}
+  802c26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c29:	5b                   	pop    %ebx
+  802c2a:	5e                   	pop    %esi
+  802c2b:	5d                   	pop    %ebp
+  802c2c:	c3                   	ret
+		return -E_NOT_SUPP;
+  802c2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c32:	eb f2                	jmp    802c26 <fstat+0x71>
+
+00802c34 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802c34:	55                   	push   %ebp
+  802c35:	89 e5                	mov    %esp,%ebp
+  802c37:	56                   	push   %esi
+  802c38:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802c39:	83 ec 08             	sub    $0x8,%esp
+  802c3c:	6a 00                	push   $0x0
+  802c3e:	ff 75 08             	push   0x8(%ebp)
+  802c41:	e8 b7 01 00 00       	call   802dfd <open>
+  802c46:	89 c3                	mov    %eax,%ebx
+  802c48:	83 c4 10             	add    $0x10,%esp
+  802c4b:	85 c0                	test   %eax,%eax
+  802c4d:	78 1b                	js     802c6a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802c4f:	83 ec 08             	sub    $0x8,%esp
+  802c52:	ff 75 0c             	push   0xc(%ebp)
+  802c55:	50                   	push   %eax
+  802c56:	e8 5a ff ff ff       	call   802bb5 <fstat>
+  802c5b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802c5d:	89 1c 24             	mov    %ebx,(%esp)
+  802c60:	e8 60 fb ff ff       	call   8027c5 <close>
+	return r;
+  802c65:	83 c4 10             	add    $0x10,%esp
+  802c68:	89 f3                	mov    %esi,%ebx
+}
+  802c6a:	89 d8                	mov    %ebx,%eax
+  802c6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c6f:	5b                   	pop    %ebx
+  802c70:	5e                   	pop    %esi
+  802c71:	5d                   	pop    %ebp
+  802c72:	c3                   	ret
+
+00802c73 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802c73:	55                   	push   %ebp
+  802c74:	89 e5                	mov    %esp,%ebp
+  802c76:	56                   	push   %esi
+  802c77:	53                   	push   %ebx
+  802c78:	89 c6                	mov    %eax,%esi
+  802c7a:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802c7c:	83 3d e4 8a 80 00 00 	cmpl   $0x0,0x808ae4
+  802c83:	74 27                	je     802cac <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802c85:	6a 07                	push   $0x7
+  802c87:	68 00 a0 80 00       	push   $0x80a000
+  802c8c:	56                   	push   %esi
+  802c8d:	ff 35 e4 8a 80 00    	push   0x808ae4
+  802c93:	e8 5f 2a 00 00       	call   8056f7 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802c98:	83 c4 0c             	add    $0xc,%esp
+  802c9b:	6a 00                	push   $0x0
+  802c9d:	53                   	push   %ebx
+  802c9e:	6a 00                	push   $0x0
+  802ca0:	e8 c2 27 00 00       	call   805467 <ipc_recv>
+}
+  802ca5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ca8:	5b                   	pop    %ebx
+  802ca9:	5e                   	pop    %esi
+  802caa:	5d                   	pop    %ebp
+  802cab:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802cac:	83 ec 0c             	sub    $0xc,%esp
+  802caf:	6a 02                	push   $0x2
+  802cb1:	e8 aa 2a 00 00       	call   805760 <ipc_find_env>
+  802cb6:	a3 e4 8a 80 00       	mov    %eax,0x808ae4
+  802cbb:	83 c4 10             	add    $0x10,%esp
+  802cbe:	eb c5                	jmp    802c85 <fsipc+0x12>
+
+00802cc0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802cc0:	55                   	push   %ebp
+  802cc1:	89 e5                	mov    %esp,%ebp
+  802cc3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc9:	8b 40 0c             	mov    0xc(%eax),%eax
+  802ccc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.set_size.req_size = newsize;
+  802cd1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cd4:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cde:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ce3:	e8 8b ff ff ff       	call   802c73 <fsipc>
+}
+  802ce8:	c9                   	leave
+  802ce9:	c3                   	ret
+
+00802cea <devfile_flush>:
+{
+  802cea:	55                   	push   %ebp
+  802ceb:	89 e5                	mov    %esp,%ebp
+  802ced:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802cf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf3:	8b 40 0c             	mov    0xc(%eax),%eax
+  802cf6:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802cfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d00:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d05:	e8 69 ff ff ff       	call   802c73 <fsipc>
+}
+  802d0a:	c9                   	leave
+  802d0b:	c3                   	ret
+
+00802d0c <devfile_stat>:
+{
+  802d0c:	55                   	push   %ebp
+  802d0d:	89 e5                	mov    %esp,%ebp
+  802d0f:	53                   	push   %ebx
+  802d10:	83 ec 04             	sub    $0x4,%esp
+  802d13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d19:	8b 40 0c             	mov    0xc(%eax),%eax
+  802d1c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802d21:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d26:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d2b:	e8 43 ff ff ff       	call   802c73 <fsipc>
+  802d30:	85 c0                	test   %eax,%eax
+  802d32:	78 37                	js     802d6b <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d34:	83 ec 08             	sub    $0x8,%esp
+  802d37:	68 00 a0 80 00       	push   $0x80a000
+  802d3c:	53                   	push   %ebx
+  802d3d:	e8 65 e7 ff ff       	call   8014a7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802d42:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  802d47:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d4d:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  802d52:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802d58:	a1 88 a0 80 00       	mov    0x80a088,%eax
+  802d5d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802d63:	83 c4 10             	add    $0x10,%esp
+  802d66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d6e:	c9                   	leave
+  802d6f:	c3                   	ret
+
+00802d70 <devfile_write>:
+{
+  802d70:	55                   	push   %ebp
+  802d71:	89 e5                	mov    %esp,%ebp
+  802d73:	83 ec 0c             	sub    $0xc,%esp
+  802d76:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802d79:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802d7e:	39 d0                	cmp    %edx,%eax
+  802d80:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d86:	8b 52 0c             	mov    0xc(%edx),%edx
+  802d89:	89 15 00 a0 80 00    	mov    %edx,0x80a000
+	fsipcbuf.write.req_n = count;
+  802d8f:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802d94:	50                   	push   %eax
+  802d95:	ff 75 0c             	push   0xc(%ebp)
+  802d98:	68 08 a0 80 00       	push   $0x80a008
+  802d9d:	e8 b5 e8 ff ff       	call   801657 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802da2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da7:	b8 04 00 00 00       	mov    $0x4,%eax
+  802dac:	e8 c2 fe ff ff       	call   802c73 <fsipc>
+}
+  802db1:	c9                   	leave
+  802db2:	c3                   	ret
+
+00802db3 <devfile_read>:
+{
+  802db3:	55                   	push   %ebp
+  802db4:	89 e5                	mov    %esp,%ebp
+  802db6:	53                   	push   %ebx
+  802db7:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802dba:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dbd:	8b 40 0c             	mov    0xc(%eax),%eax
+  802dc0:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.read.req_n = n;
+  802dc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dc8:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802dcd:	ba 00 a0 80 00       	mov    $0x80a000,%edx
+  802dd2:	b8 03 00 00 00       	mov    $0x3,%eax
+  802dd7:	e8 97 fe ff ff       	call   802c73 <fsipc>
+  802ddc:	89 c3                	mov    %eax,%ebx
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	78 14                	js     802df6 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802de2:	83 ec 04             	sub    $0x4,%esp
+  802de5:	50                   	push   %eax
+  802de6:	68 00 a0 80 00       	push   $0x80a000
+  802deb:	ff 75 0c             	push   0xc(%ebp)
+  802dee:	e8 64 e8 ff ff       	call   801657 <memmove>
+	return r;
+  802df3:	83 c4 10             	add    $0x10,%esp
+}
+  802df6:	89 d8                	mov    %ebx,%eax
+  802df8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dfb:	c9                   	leave
+  802dfc:	c3                   	ret
+
+00802dfd <open>:
+{
+  802dfd:	55                   	push   %ebp
+  802dfe:	89 e5                	mov    %esp,%ebp
+  802e00:	53                   	push   %ebx
+  802e01:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802e04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e07:	50                   	push   %eax
+  802e08:	e8 23 f8 ff ff       	call   802630 <fd_alloc>
+  802e0d:	89 c3                	mov    %eax,%ebx
+  802e0f:	83 c4 10             	add    $0x10,%esp
+  802e12:	85 c0                	test   %eax,%eax
+  802e14:	78 2a                	js     802e40 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802e16:	83 ec 0c             	sub    $0xc,%esp
+  802e19:	ff 75 08             	push   0x8(%ebp)
+  802e1c:	e8 3a e6 ff ff       	call   80145b <strlen>
+  802e21:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802e24:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802e29:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802e2e:	7e 17                	jle    802e47 <open+0x4a>
+	fd_close(fd, 1);
+  802e30:	83 ec 08             	sub    $0x8,%esp
+  802e33:	6a 01                	push   $0x1
+  802e35:	ff 75 f4             	push   -0xc(%ebp)
+  802e38:	e8 08 f9 ff ff       	call   802745 <fd_close>
+	return r;
+  802e3d:	83 c4 10             	add    $0x10,%esp
+}
+  802e40:	89 d8                	mov    %ebx,%eax
+  802e42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e45:	c9                   	leave
+  802e46:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802e47:	83 ec 08             	sub    $0x8,%esp
+  802e4a:	ff 75 08             	push   0x8(%ebp)
+  802e4d:	68 00 a0 80 00       	push   $0x80a000
+  802e52:	e8 50 e6 ff ff       	call   8014a7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802e57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e5a:	a3 00 a4 80 00       	mov    %eax,0x80a400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802e5f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e62:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e67:	e8 07 fe ff ff       	call   802c73 <fsipc>
+  802e6c:	89 c3                	mov    %eax,%ebx
+  802e6e:	83 c4 10             	add    $0x10,%esp
+  802e71:	85 c0                	test   %eax,%eax
+  802e73:	78 bb                	js     802e30 <open+0x33>
+	return fd2num(fd); 	
+  802e75:	83 ec 0c             	sub    $0xc,%esp
+  802e78:	ff 75 f4             	push   -0xc(%ebp)
+  802e7b:	e8 89 f7 ff ff       	call   802609 <fd2num>
+  802e80:	89 c3                	mov    %eax,%ebx
+  802e82:	83 c4 10             	add    $0x10,%esp
+  802e85:	eb b9                	jmp    802e40 <open+0x43>
+
+00802e87 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802e87:	55                   	push   %ebp
+  802e88:	89 e5                	mov    %esp,%ebp
+  802e8a:	53                   	push   %ebx
+  802e8b:	83 ec 1c             	sub    $0x1c,%esp
+  802e8e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e94:	50                   	push   %eax
+  802e95:	ff 75 08             	push   0x8(%ebp)
+  802e98:	e8 e3 f7 ff ff       	call   802680 <fd_lookup>
+  802e9d:	83 c4 10             	add    $0x10,%esp
+  802ea0:	85 c0                	test   %eax,%eax
+  802ea2:	78 5a                	js     802efe <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802ea4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ea7:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  802ead:	39 10                	cmp    %edx,(%eax)
+  802eaf:	75 66                	jne    802f17 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802eb1:	83 3d e4 8a 80 00 00 	cmpl   $0x0,0x808ae4
+  802eb8:	74 49                	je     802f03 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802eba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ebd:	8b 40 0c             	mov    0xc(%eax),%eax
+  802ec0:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.map.req_offset = offset;
+  802ec5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ec8:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	fsipcbuf.map.req_npages = maxpages;
+  802ecd:	89 1d 08 a0 80 00    	mov    %ebx,0x80a008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802ed3:	6a 07                	push   $0x7
+  802ed5:	68 00 a0 80 00       	push   $0x80a000
+  802eda:	6a 09                	push   $0x9
+  802edc:	ff 35 e4 8a 80 00    	push   0x808ae4
+  802ee2:	e8 10 28 00 00       	call   8056f7 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802ee7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802eee:	6a 00                	push   $0x0
+  802ef0:	53                   	push   %ebx
+  802ef1:	ff 75 10             	push   0x10(%ebp)
+  802ef4:	6a 00                	push   $0x0
+  802ef6:	e8 39 26 00 00       	call   805534 <ipc_recv_pages>
+  802efb:	83 c4 20             	add    $0x20,%esp
+}
+  802efe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f01:	c9                   	leave
+  802f02:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f03:	83 ec 0c             	sub    $0xc,%esp
+  802f06:	6a 02                	push   $0x2
+  802f08:	e8 53 28 00 00       	call   805760 <ipc_find_env>
+  802f0d:	a3 e4 8a 80 00       	mov    %eax,0x808ae4
+  802f12:	83 c4 10             	add    $0x10,%esp
+  802f15:	eb a3                	jmp    802eba <fmap+0x33>
+		return -E_INVAL;
+  802f17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f1c:	eb e0                	jmp    802efe <fmap+0x77>
+
+00802f1e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802f1e:	55                   	push   %ebp
+  802f1f:	89 e5                	mov    %esp,%ebp
+  802f21:	53                   	push   %ebx
+  802f22:	83 ec 10             	sub    $0x10,%esp
+  802f25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802f28:	53                   	push   %ebx
+  802f29:	e8 2d e5 ff ff       	call   80145b <strlen>
+  802f2e:	83 c4 10             	add    $0x10,%esp
+  802f31:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802f36:	7f 25                	jg     802f5d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802f38:	83 ec 08             	sub    $0x8,%esp
+  802f3b:	53                   	push   %ebx
+  802f3c:	68 00 a0 80 00       	push   $0x80a000
+  802f41:	e8 61 e5 ff ff       	call   8014a7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802f46:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f50:	e8 1e fd ff ff       	call   802c73 <fsipc>
+  802f55:	83 c4 10             	add    $0x10,%esp
+}
+  802f58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f5b:	c9                   	leave
+  802f5c:	c3                   	ret
+		return -E_BAD_PATH;
+  802f5d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802f62:	eb f4                	jmp    802f58 <remove+0x3a>
+
+00802f64 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802f64:	55                   	push   %ebp
+  802f65:	89 e5                	mov    %esp,%ebp
+  802f67:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f74:	e8 fa fc ff ff       	call   802c73 <fsipc>
+}
+  802f79:	c9                   	leave
+  802f7a:	c3                   	ret
+
+00802f7b <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802f7b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802f7f:	7f 01                	jg     802f82 <writebuf+0x7>
+  802f81:	c3                   	ret
+{
+  802f82:	55                   	push   %ebp
+  802f83:	89 e5                	mov    %esp,%ebp
+  802f85:	53                   	push   %ebx
+  802f86:	83 ec 08             	sub    $0x8,%esp
+  802f89:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802f8b:	ff 70 04             	push   0x4(%eax)
+  802f8e:	8d 40 10             	lea    0x10(%eax),%eax
+  802f91:	50                   	push   %eax
+  802f92:	ff 33                	push   (%ebx)
+  802f94:	e8 63 fa ff ff       	call   8029fc <write>
+		if (result > 0)
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	85 c0                	test   %eax,%eax
+  802f9e:	7e 03                	jle    802fa3 <writebuf+0x28>
+			b->result += result;
+  802fa0:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802fa3:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802fa6:	74 0d                	je     802fb5 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802fa8:	85 c0                	test   %eax,%eax
+  802faa:	ba 00 00 00 00       	mov    $0x0,%edx
+  802faf:	0f 4f c2             	cmovg  %edx,%eax
+  802fb2:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802fb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fb8:	c9                   	leave
+  802fb9:	c3                   	ret
+
+00802fba <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802fba:	55                   	push   %ebp
+  802fbb:	89 e5                	mov    %esp,%ebp
+  802fbd:	53                   	push   %ebx
+  802fbe:	83 ec 04             	sub    $0x4,%esp
+  802fc1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802fc4:	8b 53 04             	mov    0x4(%ebx),%edx
+  802fc7:	8d 42 01             	lea    0x1(%edx),%eax
+  802fca:	89 43 04             	mov    %eax,0x4(%ebx)
+  802fcd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fd0:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802fd4:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802fd9:	74 05                	je     802fe0 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802fdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fde:	c9                   	leave
+  802fdf:	c3                   	ret
+		writebuf(b);
+  802fe0:	89 d8                	mov    %ebx,%eax
+  802fe2:	e8 94 ff ff ff       	call   802f7b <writebuf>
+		b->idx = 0;
+  802fe7:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802fee:	eb eb                	jmp    802fdb <putch+0x21>
+
+00802ff0 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802ff0:	55                   	push   %ebp
+  802ff1:	89 e5                	mov    %esp,%ebp
+  802ff3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802ff9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ffc:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  803002:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  803009:	00 00 00 
+	b.result = 0;
+  80300c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803013:	00 00 00 
+	b.error = 1;
+  803016:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80301d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  803020:	ff 75 10             	push   0x10(%ebp)
+  803023:	ff 75 0c             	push   0xc(%ebp)
+  803026:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80302c:	50                   	push   %eax
+  80302d:	68 ba 2f 80 00       	push   $0x802fba
+  803032:	e8 88 dd ff ff       	call   800dbf <vprintfmt>
+	if (b.idx > 0)
+  803037:	83 c4 10             	add    $0x10,%esp
+  80303a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  803041:	7f 12                	jg     803055 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  803043:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  803049:	85 c0                	test   %eax,%eax
+  80304b:	75 06                	jne    803053 <vfprintf+0x63>
+  80304d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  803053:	c9                   	leave
+  803054:	c3                   	ret
+		writebuf(&b);
+  803055:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80305b:	e8 1b ff ff ff       	call   802f7b <writebuf>
+  803060:	eb e1                	jmp    803043 <vfprintf+0x53>
+
+00803062 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  803062:	55                   	push   %ebp
+  803063:	89 e5                	mov    %esp,%ebp
+  803065:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803068:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  80306b:	50                   	push   %eax
+  80306c:	ff 75 0c             	push   0xc(%ebp)
+  80306f:	ff 75 08             	push   0x8(%ebp)
+  803072:	e8 79 ff ff ff       	call   802ff0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  803077:	c9                   	leave
+  803078:	c3                   	ret
+
+00803079 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  803079:	55                   	push   %ebp
+  80307a:	89 e5                	mov    %esp,%ebp
+  80307c:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80307f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  803082:	50                   	push   %eax
+  803083:	ff 75 08             	push   0x8(%ebp)
+  803086:	6a 01                	push   $0x1
+  803088:	e8 63 ff ff ff       	call   802ff0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80308d:	c9                   	leave
+  80308e:	c3                   	ret
+
+0080308f <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80308f:	55                   	push   %ebp
+  803090:	89 e5                	mov    %esp,%ebp
+  803092:	57                   	push   %edi
+  803093:	56                   	push   %esi
+  803094:	53                   	push   %ebx
+  803095:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80309b:	6a 00                	push   $0x0
+  80309d:	ff 75 08             	push   0x8(%ebp)
+  8030a0:	e8 58 fd ff ff       	call   802dfd <open>
+  8030a5:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  8030ab:	83 c4 10             	add    $0x10,%esp
+  8030ae:	85 c0                	test   %eax,%eax
+  8030b0:	0f 88 ab 04 00 00    	js     803561 <spawn+0x4d2>
+  8030b6:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  8030b8:	83 ec 04             	sub    $0x4,%esp
+  8030bb:	68 00 02 00 00       	push   $0x200
+  8030c0:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8030c6:	50                   	push   %eax
+  8030c7:	51                   	push   %ecx
+  8030c8:	e8 db f8 ff ff       	call   8029a8 <readn>
+  8030cd:	83 c4 10             	add    $0x10,%esp
+  8030d0:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8030d5:	0f 85 e6 01 00 00    	jne    8032c1 <spawn+0x232>
+	    || elf->e_magic != ELF_MAGIC) {
+  8030db:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8030e2:	45 4c 46 
+  8030e5:	0f 85 d6 01 00 00    	jne    8032c1 <spawn+0x232>
+	__asm __volatile("int %2"
+  8030eb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030f0:	cd 30                	int    $0x30
+  8030f2:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8030f8:	85 c0                	test   %eax,%eax
+  8030fa:	0f 88 55 04 00 00    	js     803555 <spawn+0x4c6>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  803100:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803105:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+  80310b:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803111:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  803117:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80311c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  80311e:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  803124:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  80312a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80312d:	8b 00                	mov    (%eax),%eax
+  80312f:	85 c0                	test   %eax,%eax
+  803131:	0f 84 a5 07 00 00    	je     8038dc <spawn+0x84d>
+  803137:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  80313c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803141:	8b 75 0c             	mov    0xc(%ebp),%esi
+		string_size += strlen(argv[argc]) + 1;
+  803144:	83 ec 0c             	sub    $0xc,%esp
+  803147:	50                   	push   %eax
+  803148:	e8 0e e3 ff ff       	call   80145b <strlen>
+  80314d:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  803151:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  803157:	83 c3 01             	add    $0x1,%ebx
+  80315a:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  803161:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  803164:	83 c4 10             	add    $0x10,%esp
+  803167:	85 c0                	test   %eax,%eax
+  803169:	75 d9                	jne    803144 <spawn+0xb5>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80316b:	89 95 84 fd ff ff    	mov    %edx,-0x27c(%ebp)
+  803171:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  803177:	be 00 10 40 00       	mov    $0x401000,%esi
+  80317c:	29 fe                	sub    %edi,%esi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80317e:	89 f2                	mov    %esi,%edx
+  803180:	83 e2 fc             	and    $0xfffffffc,%edx
+  803183:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  803189:	8d 04 85 08 00 00 00 	lea    0x8(,%eax,4),%eax
+  803190:	29 c2                	sub    %eax,%edx
+  803192:	89 d7                	mov    %edx,%edi
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  803194:	8d 42 f8             	lea    -0x8(%edx),%eax
+  803197:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80319c:	0f 86 ee 06 00 00    	jbe    803890 <spawn+0x801>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8031a2:	83 ec 04             	sub    $0x4,%esp
+  8031a5:	6a 07                	push   $0x7
+  8031a7:	68 00 00 40 00       	push   $0x400000
+  8031ac:	6a 00                	push   $0x0
+  8031ae:	e8 28 e7 ff ff       	call   8018db <sys_page_alloc>
+  8031b3:	83 c4 10             	add    $0x10,%esp
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	0f 88 d7 06 00 00    	js     803895 <spawn+0x806>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8031be:	85 db                	test   %ebx,%ebx
+  8031c0:	7e 58                	jle    80321a <spawn+0x18b>
+  8031c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031c7:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  8031cd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8031d0:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8031d6:	8d 86 00 d0 7f ee    	lea    -0x11803000(%esi),%eax
+  8031dc:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8031e2:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+		strcpy(string_store, argv[i]);
+  8031e5:	83 ec 08             	sub    $0x8,%esp
+  8031e8:	ff 34 9f             	push   (%edi,%ebx,4)
+  8031eb:	56                   	push   %esi
+  8031ec:	e8 b6 e2 ff ff       	call   8014a7 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8031f1:	83 c4 04             	add    $0x4,%esp
+  8031f4:	ff 34 9f             	push   (%edi,%ebx,4)
+  8031f7:	e8 5f e2 ff ff       	call   80145b <strlen>
+  8031fc:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+  803200:	83 c3 01             	add    $0x1,%ebx
+  803203:	83 c4 10             	add    $0x10,%esp
+  803206:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  80320c:	39 8d 94 fd ff ff    	cmp    %ecx,-0x26c(%ebp)
+  803212:	75 bc                	jne    8031d0 <spawn+0x141>
+  803214:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+	}
+	argv_store[argc] = 0;
+  80321a:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  803220:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  803227:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  80322d:	0f 85 c6 00 00 00    	jne    8032f9 <spawn+0x26a>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  803233:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  803239:	89 47 fc             	mov    %eax,-0x4(%edi)
+	argv_store[-2] = argc;
+  80323c:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  803242:	89 47 f8             	mov    %eax,-0x8(%edi)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  803245:	8d 87 f8 cf 7f ee    	lea    -0x11803008(%edi),%eax
+  80324b:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  803251:	83 ec 0c             	sub    $0xc,%esp
+  803254:	6a 07                	push   $0x7
+  803256:	68 00 d0 bf ee       	push   $0xeebfd000
+  80325b:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803261:	68 00 00 40 00       	push   $0x400000
+  803266:	6a 00                	push   $0x0
+  803268:	e8 b1 e6 ff ff       	call   80191e <sys_page_map>
+  80326d:	89 c3                	mov    %eax,%ebx
+  80326f:	83 c4 20             	add    $0x20,%esp
+  803272:	85 c0                	test   %eax,%eax
+  803274:	0f 88 45 06 00 00    	js     8038bf <spawn+0x830>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80327a:	83 ec 08             	sub    $0x8,%esp
+  80327d:	68 00 00 40 00       	push   $0x400000
+  803282:	6a 00                	push   $0x0
+  803284:	e8 d7 e6 ff ff       	call   801960 <sys_page_unmap>
+  803289:	89 c3                	mov    %eax,%ebx
+  80328b:	83 c4 10             	add    $0x10,%esp
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	0f 88 29 06 00 00    	js     8038bf <spawn+0x830>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  803296:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80329c:	8d 84 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%eax
+  8032a3:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8032a9:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  8032b0:	00 
+  8032b1:	0f 84 a4 00 00 00    	je     80335b <spawn+0x2cc>
+  8032b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032bc:	e9 19 03 00 00       	jmp    8035da <spawn+0x54b>
+		close(fd);
+  8032c1:	83 ec 0c             	sub    $0xc,%esp
+  8032c4:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  8032ca:	e8 f6 f4 ff ff       	call   8027c5 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8032cf:	83 c4 0c             	add    $0xc,%esp
+  8032d2:	68 7f 45 4c 46       	push   $0x464c457f
+  8032d7:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8032dd:	68 30 61 80 00       	push   $0x806130
+  8032e2:	e8 d9 d9 ff ff       	call   800cc0 <cprintf>
+		return -E_NOT_EXEC;
+  8032e7:	83 c4 10             	add    $0x10,%esp
+  8032ea:	c7 85 78 fd ff ff f2 	movl   $0xfffffff2,-0x288(%ebp)
+  8032f1:	ff ff ff 
+  8032f4:	e9 68 02 00 00       	jmp    803561 <spawn+0x4d2>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8032f9:	68 84 61 80 00       	push   $0x806184
+  8032fe:	68 1f 5b 80 00       	push   $0x805b1f
+  803303:	68 f1 00 00 00       	push   $0xf1
+  803308:	68 4a 61 80 00       	push   $0x80614a
+  80330d:	e8 d3 d8 ff ff       	call   800be5 <_panic>
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
+  803312:	50                   	push   %eax
+  803313:	68 ac 61 80 00       	push   $0x8061ac
+  803318:	68 2d 01 00 00       	push   $0x12d
+  80331d:	68 4a 61 80 00       	push   $0x80614a
+  803322:	e8 be d8 ff ff       	call   800be5 <_panic>
+  803327:	89 c6                	mov    %eax,%esi
+  803329:	eb 02                	jmp    80332d <spawn+0x29e>
+  80332b:	89 c6                	mov    %eax,%esi
+	sys_env_destroy(child);
+  80332d:	83 ec 0c             	sub    $0xc,%esp
+  803330:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803336:	e8 21 e5 ff ff       	call   80185c <sys_env_destroy>
+	close(fd);
+  80333b:	83 c4 04             	add    $0x4,%esp
+  80333e:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  803344:	e8 7c f4 ff ff       	call   8027c5 <close>
+	return r;
+  803349:	83 c4 10             	add    $0x10,%esp
+  80334c:	89 b5 78 fd ff ff    	mov    %esi,-0x288(%ebp)
+  803352:	e9 0a 02 00 00       	jmp    803561 <spawn+0x4d2>
+  803357:	89 c6                	mov    %eax,%esi
+  803359:	eb d2                	jmp    80332d <spawn+0x29e>
+	close(fd);
+  80335b:	83 ec 0c             	sub    $0xc,%esp
+  80335e:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  803364:	e8 5c f4 ff ff       	call   8027c5 <close>
+	// LAB 7: Your code here.
+	static struct PageBatch pb;
+	uintptr_t addr;
+	uint32_t pn, pd;
+	int r;
+	pgbatch_init(&pb);
+  803369:	c7 04 24 00 8b 80 00 	movl   $0x808b00,(%esp)
+  803370:	e8 65 1d 00 00       	call   8050da <pgbatch_init>
+  803375:	83 c4 10             	add    $0x10,%esp
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  803378:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80337d:	8b b5 90 fd ff ff    	mov    -0x270(%ebp),%esi
+  803383:	eb 24                	jmp    8033a9 <spawn+0x31a>
+		pd = PDX(addr);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  803385:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80338b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  803391:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  803397:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80339d:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8033a3:	0f 87 18 01 00 00    	ja     8034c1 <spawn+0x432>
+		pd = PDX(addr);
+  8033a9:	89 d8                	mov    %ebx,%eax
+  8033ab:	c1 e8 16             	shr    $0x16,%eax
+		if (!(vpd[pd] & PTE_P)) {
+  8033ae:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8033b5:	a8 01                	test   $0x1,%al
+  8033b7:	74 cc                	je     803385 <spawn+0x2f6>
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  8033b9:	89 d9                	mov    %ebx,%ecx
+  8033bb:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+  8033c1:	74 4c                	je     80340f <spawn+0x380>
+				continue;
+			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+  8033c3:	89 d8                	mov    %ebx,%eax
+  8033c5:	c1 e8 0c             	shr    $0xc,%eax
+		if(vpt[pn] & PTE_SHARE) {
+  8033c8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8033cf:	f6 c6 04             	test   $0x4,%dh
+  8033d2:	74 c3                	je     803397 <spawn+0x308>
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+  8033d4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033db:	83 ec 08             	sub    $0x8,%esp
+  8033de:	25 07 0e 00 00       	and    $0xe07,%eax
+  8033e3:	50                   	push   %eax
+  8033e4:	53                   	push   %ebx
+  8033e5:	56                   	push   %esi
+  8033e6:	53                   	push   %ebx
+  8033e7:	6a 00                	push   $0x0
+  8033e9:	68 00 8b 80 00       	push   $0x808b00
+  8033ee:	e8 a5 1d 00 00       	call   805198 <pgbatch_map>
+  8033f3:	83 c4 20             	add    $0x20,%esp
+  8033f6:	85 c0                	test   %eax,%eax
+  8033f8:	79 9d                	jns    803397 <spawn+0x308>
+				panic("sys_page_batch: %e", r);
+  8033fa:	50                   	push   %eax
+  8033fb:	68 56 61 80 00       	push   $0x806156
+  803400:	68 6b 01 00 00       	push   $0x16b
+  803405:	68 4a 61 80 00       	push   $0x80614a
+  80340a:	e8 d6 d7 ff ff       	call   800be5 <_panic>
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  80340f:	89 d8                	mov    %ebx,%eax
+  803411:	c1 e8 0c             	shr    $0xc,%eax
+  803414:	8d b8 00 04 00 00    	lea    0x400(%eax),%edi
+  80341a:	eb 0a                	jmp    803426 <spawn+0x397>
+			n++;
+  80341c:	83 c1 01             	add    $0x1,%ecx
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  80341f:	83 c0 01             	add    $0x1,%eax
+  803422:	39 f8                	cmp    %edi,%eax
+  803424:	73 1a                	jae    803440 <spawn+0x3b1>
+		if (vpt[pn] & PTE_P) {
+  803426:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80342d:	f6 c2 01             	test   $0x1,%dl
+  803430:	74 ed                	je     80341f <spawn+0x390>
+			if (!(vpt[pn] & PTE_SHARE))
+  803432:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803439:	f6 c6 04             	test   $0x4,%dh
+  80343c:	75 de                	jne    80341c <spawn+0x38d>
+  80343e:	eb 83                	jmp    8033c3 <spawn+0x334>
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  803440:	85 c9                	test   %ecx,%ecx
+  803442:	0f 84 7b ff ff ff    	je     8033c3 <spawn+0x334>
+			if ((r = pgbatch_flush(&pb)) < 0)
+  803448:	83 ec 0c             	sub    $0xc,%esp
+  80344b:	68 00 8b 80 00       	push   $0x808b00
+  803450:	e8 93 1c 00 00       	call   8050e8 <pgbatch_flush>
+  803455:	83 c4 10             	add    $0x10,%esp
+  803458:	85 c0                	test   %eax,%eax
+  80345a:	78 45                	js     8034a1 <spawn+0x412>
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+  80345c:	83 ec 0c             	sub    $0xc,%esp
+  80345f:	6a 00                	push   $0x0
+  803461:	56                   	push   %esi
+  803462:	53                   	push   %ebx
+  803463:	6a 00                	push   $0x0
+  803465:	68 00 8b 80 00       	push   $0x808b00
+  80346a:	e8 d4 1d 00 00       	call   805243 <pgbatch_sharept>
+			if ((r = pgbatch_flush(&pb)) == 0) {
+  80346f:	83 c4 14             	add    $0x14,%esp
+  803472:	68 00 8b 80 00       	push   $0x808b00
+  803477:	e8 6c 1c 00 00       	call   8050e8 <pgbatch_flush>
+  80347c:	83 c4 10             	add    $0x10,%esp
+  80347f:	85 c0                	test   %eax,%eax
+  803481:	74 33                	je     8034b6 <spawn+0x427>
+			if (r != -E_INVAL)
+  803483:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  803486:	0f 84 37 ff ff ff    	je     8033c3 <spawn+0x334>
+				panic("sys_page_batch: %e", r);
+  80348c:	50                   	push   %eax
+  80348d:	68 56 61 80 00       	push   $0x806156
+  803492:	68 66 01 00 00       	push   $0x166
+  803497:	68 4a 61 80 00       	push   $0x80614a
+  80349c:	e8 44 d7 ff ff       	call   800be5 <_panic>
+				panic("sys_page_batch: %e", r);
+  8034a1:	50                   	push   %eax
+  8034a2:	68 56 61 80 00       	push   $0x806156
+  8034a7:	68 5f 01 00 00       	push   $0x15f
+  8034ac:	68 4a 61 80 00       	push   $0x80614a
+  8034b1:	e8 2f d7 ff ff       	call   800be5 <_panic>
+				addr += PTSIZE - PGSIZE;
+  8034b6:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+				continue;
+  8034bc:	e9 d6 fe ff ff       	jmp    803397 <spawn+0x308>
+		}
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  8034c1:	83 ec 0c             	sub    $0xc,%esp
+  8034c4:	68 00 8b 80 00       	push   $0x808b00
+  8034c9:	e8 1a 1c 00 00       	call   8050e8 <pgbatch_flush>
+  8034ce:	83 c4 10             	add    $0x10,%esp
+  8034d1:	85 c0                	test   %eax,%eax
+  8034d3:	78 41                	js     803516 <spawn+0x487>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8034d5:	83 ec 08             	sub    $0x8,%esp
+  8034d8:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8034de:	50                   	push   %eax
+  8034df:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8034e5:	e8 fa e4 ff ff       	call   8019e4 <sys_env_set_trapframe>
+  8034ea:	83 c4 10             	add    $0x10,%esp
+  8034ed:	85 c0                	test   %eax,%eax
+  8034ef:	78 3a                	js     80352b <spawn+0x49c>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8034f1:	83 ec 08             	sub    $0x8,%esp
+  8034f4:	6a 02                	push   $0x2
+  8034f6:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8034fc:	e8 a1 e4 ff ff       	call   8019a2 <sys_env_set_status>
+  803501:	83 c4 10             	add    $0x10,%esp
+  803504:	85 c0                	test   %eax,%eax
+  803506:	78 38                	js     803540 <spawn+0x4b1>
+	return child;
+  803508:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80350e:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  803514:	eb 4b                	jmp    803561 <spawn+0x4d2>
+		panic("sys_page_batch: %e", r);
+  803516:	50                   	push   %eax
+  803517:	68 56 61 80 00       	push   $0x806156
+  80351c:	68 6f 01 00 00       	push   $0x16f
+  803521:	68 4a 61 80 00       	push   $0x80614a
+  803526:	e8 ba d6 ff ff       	call   800be5 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  80352b:	50                   	push   %eax
+  80352c:	68 69 61 80 00       	push   $0x806169
+  803531:	68 85 00 00 00       	push   $0x85
+  803536:	68 4a 61 80 00       	push   $0x80614a
+  80353b:	e8 a5 d6 ff ff       	call   800be5 <_panic>
+		panic("sys_env_set_status: %e", r);
+  803540:	50                   	push   %eax
+  803541:	68 66 60 80 00       	push   $0x806066
+  803546:	68 88 00 00 00       	push   $0x88
+  80354b:	68 4a 61 80 00       	push   $0x80614a
+  803550:	e8 90 d6 ff ff       	call   800be5 <_panic>
+		return r;
+  803555:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80355b:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+}
+  803561:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  803567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80356a:	5b                   	pop    %ebx
+  80356b:	5e                   	pop    %esi
+  80356c:	5f                   	pop    %edi
+  80356d:	5d                   	pop    %ebp
+  80356e:	c3                   	ret
+	for (j = 0; j < n; j++)
+  80356f:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  803575:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  80357b:	85 db                	test   %ebx,%ebx
+  80357d:	0f 8e 06 03 00 00    	jle    803889 <spawn+0x7fa>
+  803583:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803589:	c1 e6 0c             	shl    $0xc,%esi
+  80358c:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  803591:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  803597:	89 c7                	mov    %eax,%edi
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+  803599:	83 ec 08             	sub    $0x8,%esp
+  80359c:	53                   	push   %ebx
+  80359d:	6a 00                	push   $0x0
+  80359f:	e8 bc e3 ff ff       	call   801960 <sys_page_unmap>
+	for (j = 0; j < n; j++)
+  8035a4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8035aa:	83 c4 10             	add    $0x10,%esp
+  8035ad:	39 f3                	cmp    %esi,%ebx
+  8035af:	75 e8                	jne    803599 <spawn+0x50a>
+  8035b1:	89 f8                	mov    %edi,%eax
+  8035b3:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	0f 88 66 fd ff ff    	js     803327 <spawn+0x298>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8035c1:	83 c7 01             	add    $0x1,%edi
+  8035c4:	83 85 7c fd ff ff 20 	addl   $0x20,-0x284(%ebp)
+  8035cb:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8035d2:	39 f8                	cmp    %edi,%eax
+  8035d4:	0f 8e 81 fd ff ff    	jle    80335b <spawn+0x2cc>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8035da:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8035e0:	83 39 01             	cmpl   $0x1,(%ecx)
+  8035e3:	75 dc                	jne    8035c1 <spawn+0x532>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8035e5:	8b 41 18             	mov    0x18(%ecx),%eax
+  8035e8:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+  8035ee:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8035f1:	83 f8 01             	cmp    $0x1,%eax
+  8035f4:	19 c0                	sbb    %eax,%eax
+  8035f6:	83 e0 fe             	and    $0xfffffffe,%eax
+  8035f9:	83 c0 07             	add    $0x7,%eax
+  8035fc:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  803602:	8b 51 04             	mov    0x4(%ecx),%edx
+  803605:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  80360b:	8b 59 10             	mov    0x10(%ecx),%ebx
+  80360e:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  803614:	8b 41 14             	mov    0x14(%ecx),%eax
+  803617:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+  80361d:	8b 71 08             	mov    0x8(%ecx),%esi
+  803620:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+	if ((i = PGOFF(va))) {
+  803626:	89 f0                	mov    %esi,%eax
+  803628:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80362d:	74 1e                	je     80364d <spawn+0x5be>
+		va -= i;
+  80362f:	29 c6                	sub    %eax,%esi
+  803631:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		memsz += i;
+  803637:	01 85 68 fd ff ff    	add    %eax,-0x298(%ebp)
+		filesz += i;
+  80363d:	01 c3                	add    %eax,%ebx
+  80363f:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+		fileoffset -= i;
+  803645:	29 c2                	sub    %eax,%edx
+  803647:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+	pgbatch_init(&pb);
+  80364d:	83 ec 0c             	sub    $0xc,%esp
+  803650:	68 20 8e 80 00       	push   $0x808e20
+  803655:	e8 80 1a 00 00       	call   8050da <pgbatch_init>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  80365a:	83 c4 10             	add    $0x10,%esp
+  80365d:	83 bd 88 fd ff ff 00 	cmpl   $0x0,-0x278(%ebp)
+  803664:	0f 84 a6 01 00 00    	je     803810 <spawn+0x781>
+  80366a:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  803671:	00 00 00 
+  803674:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  80367b:	00 00 00 
+  80367e:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  803684:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  80368a:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  803690:	29 c7                	sub    %eax,%edi
+  803692:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  803698:	c1 ee 0c             	shr    $0xc,%esi
+  80369b:	b8 10 00 00 00       	mov    $0x10,%eax
+  8036a0:	39 c6                	cmp    %eax,%esi
+  8036a2:	0f 47 f0             	cmova  %eax,%esi
+  8036a5:	89 b5 94 fd ff ff    	mov    %esi,-0x26c(%ebp)
+		for (j = 0; j < n; j++)
+  8036ab:	85 f6                	test   %esi,%esi
+  8036ad:	0f 8e ed 01 00 00    	jle    8038a0 <spawn+0x811>
+  8036b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036b8:	89 bd 70 fd ff ff    	mov    %edi,-0x290(%ebp)
+  8036be:	89 f7                	mov    %esi,%edi
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  8036c0:	6a 07                	push   $0x7
+  8036c2:	89 d8                	mov    %ebx,%eax
+  8036c4:	c1 e0 0c             	shl    $0xc,%eax
+  8036c7:	05 00 00 40 00       	add    $0x400000,%eax
+  8036cc:	50                   	push   %eax
+  8036cd:	6a 00                	push   $0x0
+  8036cf:	68 20 8e 80 00       	push   $0x808e20
+  8036d4:	e8 88 1a 00 00       	call   805161 <pgbatch_alloc>
+  8036d9:	83 c4 10             	add    $0x10,%esp
+  8036dc:	85 c0                	test   %eax,%eax
+  8036de:	0f 88 47 fc ff ff    	js     80332b <spawn+0x29c>
+		for (j = 0; j < n; j++)
+  8036e4:	83 c3 01             	add    $0x1,%ebx
+  8036e7:	39 df                	cmp    %ebx,%edi
+  8036e9:	75 d5                	jne    8036c0 <spawn+0x631>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8036eb:	8b bd 70 fd ff ff    	mov    -0x290(%ebp),%edi
+  8036f1:	83 ec 0c             	sub    $0xc,%esp
+  8036f4:	68 20 8e 80 00       	push   $0x808e20
+  8036f9:	e8 ea 19 00 00       	call   8050e8 <pgbatch_flush>
+  8036fe:	83 c4 10             	add    $0x10,%esp
+  803701:	85 c0                	test   %eax,%eax
+  803703:	0f 88 66 fe ff ff    	js     80356f <spawn+0x4e0>
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  803709:	83 ec 08             	sub    $0x8,%esp
+  80370c:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  803712:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  803718:	01 c8                	add    %ecx,%eax
+  80371a:	50                   	push   %eax
+  80371b:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  803721:	e8 75 f3 ff ff       	call   802a9b <seek>
+  803726:	83 c4 10             	add    $0x10,%esp
+  803729:	85 c0                	test   %eax,%eax
+  80372b:	0f 88 3e fe ff ff    	js     80356f <spawn+0x4e0>
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  803731:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  803737:	c1 e3 0c             	shl    $0xc,%ebx
+  80373a:	83 ec 04             	sub    $0x4,%esp
+  80373d:	39 fb                	cmp    %edi,%ebx
+  80373f:	0f 46 fb             	cmovbe %ebx,%edi
+  803742:	57                   	push   %edi
+  803743:	68 00 00 40 00       	push   $0x400000
+  803748:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  80374e:	e8 55 f2 ff ff       	call   8029a8 <readn>
+  803753:	83 c4 10             	add    $0x10,%esp
+  803756:	85 c0                	test   %eax,%eax
+  803758:	0f 88 11 fe ff ff    	js     80356f <spawn+0x4e0>
+		for (j = 0; j < n; j++) {
+  80375e:	83 bd 94 fd ff ff 00 	cmpl   $0x0,-0x26c(%ebp)
+  803765:	7e 6b                	jle    8037d2 <spawn+0x743>
+  803767:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  80376d:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  803773:	01 c7                	add    %eax,%edi
+  803775:	be 00 00 00 00       	mov    $0x0,%esi
+  80377a:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+  803780:	89 f3                	mov    %esi,%ebx
+  803782:	c1 e3 0c             	shl    $0xc,%ebx
+  803785:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80378b:	83 ec 08             	sub    $0x8,%esp
+  80378e:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803794:	57                   	push   %edi
+  803795:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80379b:	53                   	push   %ebx
+  80379c:	6a 00                	push   $0x0
+  80379e:	68 20 8e 80 00       	push   $0x808e20
+  8037a3:	e8 f0 19 00 00       	call   805198 <pgbatch_map>
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+  8037a8:	83 c4 1c             	add    $0x1c,%esp
+  8037ab:	53                   	push   %ebx
+  8037ac:	6a 00                	push   $0x0
+  8037ae:	68 20 8e 80 00       	push   $0x808e20
+  8037b3:	e8 23 1a 00 00       	call   8051db <pgbatch_unmap>
+		for (j = 0; j < n; j++) {
+  8037b8:	83 c6 01             	add    $0x1,%esi
+  8037bb:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8037c1:	83 c4 10             	add    $0x10,%esp
+  8037c4:	39 b5 94 fd ff ff    	cmp    %esi,-0x26c(%ebp)
+  8037ca:	75 b4                	jne    803780 <spawn+0x6f1>
+  8037cc:	8b 9d 80 fd ff ff    	mov    -0x280(%ebp),%ebx
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8037d2:	83 ec 0c             	sub    $0xc,%esp
+  8037d5:	68 20 8e 80 00       	push   $0x808e20
+  8037da:	e8 09 19 00 00       	call   8050e8 <pgbatch_flush>
+  8037df:	83 c4 10             	add    $0x10,%esp
+  8037e2:	85 c0                	test   %eax,%eax
+  8037e4:	0f 88 28 fb ff ff    	js     803312 <spawn+0x283>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  8037ea:	01 9d 84 fd ff ff    	add    %ebx,-0x27c(%ebp)
+  8037f0:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8037f6:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  8037fc:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  803802:	39 f0                	cmp    %esi,%eax
+  803804:	0f 82 7a fe ff ff    	jb     803684 <spawn+0x5f5>
+  80380a:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  803810:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  803816:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80381b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803820:	89 c3                	mov    %eax,%ebx
+  803822:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  803828:	39 f0                	cmp    %esi,%eax
+  80382a:	73 48                	jae    803874 <spawn+0x7e5>
+  80382c:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  803832:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  803838:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+  80383e:	56                   	push   %esi
+  80383f:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  803845:	01 d8                	add    %ebx,%eax
+  803847:	50                   	push   %eax
+  803848:	57                   	push   %edi
+  803849:	68 20 8e 80 00       	push   $0x808e20
+  80384e:	e8 0e 19 00 00       	call   805161 <pgbatch_alloc>
+  803853:	83 c4 10             	add    $0x10,%esp
+  803856:	85 c0                	test   %eax,%eax
+  803858:	0f 88 f9 fa ff ff    	js     803357 <spawn+0x2c8>
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  80385e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803864:	8b 85 68 fd ff ff    	mov    -0x298(%ebp),%eax
+  80386a:	39 c3                	cmp    %eax,%ebx
+  80386c:	72 d0                	jb     80383e <spawn+0x7af>
+  80386e:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+	return pgbatch_flush(&pb);
+  803874:	83 ec 0c             	sub    $0xc,%esp
+  803877:	68 20 8e 80 00       	push   $0x808e20
+  80387c:	e8 67 18 00 00       	call   8050e8 <pgbatch_flush>
+  803881:	83 c4 10             	add    $0x10,%esp
+  803884:	e9 30 fd ff ff       	jmp    8035b9 <spawn+0x52a>
+  803889:	89 c6                	mov    %eax,%esi
+  80388b:	e9 9d fa ff ff       	jmp    80332d <spawn+0x29e>
+		return -E_NO_MEM;
+  803890:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  803895:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  80389b:	e9 c1 fc ff ff       	jmp    803561 <spawn+0x4d2>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8038a0:	83 ec 0c             	sub    $0xc,%esp
+  8038a3:	68 20 8e 80 00       	push   $0x808e20
+  8038a8:	e8 3b 18 00 00       	call   8050e8 <pgbatch_flush>
+  8038ad:	83 c4 10             	add    $0x10,%esp
+  8038b0:	85 c0                	test   %eax,%eax
+  8038b2:	0f 89 51 fe ff ff    	jns    803709 <spawn+0x67a>
+  8038b8:	89 c6                	mov    %eax,%esi
+  8038ba:	e9 6e fa ff ff       	jmp    80332d <spawn+0x29e>
+	sys_page_unmap(0, UTEMP);
+  8038bf:	83 ec 08             	sub    $0x8,%esp
+  8038c2:	68 00 00 40 00       	push   $0x400000
+  8038c7:	6a 00                	push   $0x0
+  8038c9:	e8 92 e0 ff ff       	call   801960 <sys_page_unmap>
+  8038ce:	83 c4 10             	add    $0x10,%esp
+  8038d1:	89 9d 78 fd ff ff    	mov    %ebx,-0x288(%ebp)
+  8038d7:	e9 85 fc ff ff       	jmp    803561 <spawn+0x4d2>
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8038dc:	83 ec 04             	sub    $0x4,%esp
+  8038df:	6a 07                	push   $0x7
+  8038e1:	68 00 00 40 00       	push   $0x400000
+  8038e6:	6a 00                	push   $0x0
+  8038e8:	e8 ee df ff ff       	call   8018db <sys_page_alloc>
+  8038ed:	83 c4 10             	add    $0x10,%esp
+  8038f0:	85 c0                	test   %eax,%eax
+  8038f2:	78 a1                	js     803895 <spawn+0x806>
+	for (argc = 0; argv[argc] != 0; argc++)
+  8038f4:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  8038fb:	00 00 00 
+  8038fe:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  803905:	00 00 00 
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  803908:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80390d:	be 00 10 40 00       	mov    $0x401000,%esi
+  803912:	e9 03 f9 ff ff       	jmp    80321a <spawn+0x18b>
+
+00803917 <spawnl>:
+{
+  803917:	55                   	push   %ebp
+  803918:	89 e5                	mov    %esp,%ebp
+  80391a:	56                   	push   %esi
+  80391b:	53                   	push   %ebx
+	va_start(vl, arg0);
+  80391c:	8d 45 10             	lea    0x10(%ebp),%eax
+	int argc=0;
+  80391f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while(va_arg(vl, void *) != NULL)
+  803924:	eb 05                	jmp    80392b <spawnl+0x14>
+		argc++;
+  803926:	83 c1 01             	add    $0x1,%ecx
+	while(va_arg(vl, void *) != NULL)
+  803929:	89 d0                	mov    %edx,%eax
+  80392b:	8d 50 04             	lea    0x4(%eax),%edx
+  80392e:	83 38 00             	cmpl   $0x0,(%eax)
+  803931:	75 f3                	jne    803926 <spawnl+0xf>
+	const char *argv[argc+2];
+  803933:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  80393a:	83 e0 f0             	and    $0xfffffff0,%eax
+  80393d:	29 c4                	sub    %eax,%esp
+  80393f:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803943:	89 d8                	mov    %ebx,%eax
+  803945:	c1 e8 02             	shr    $0x2,%eax
+  803948:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80394b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80394e:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+	argv[argc+1] = NULL;
+  803955:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  80395c:	00 
+	va_start(vl, arg0);
+  80395d:	8d 55 10             	lea    0x10(%ebp),%edx
+	for(i=0;i<argc;i++)
+  803960:	89 ce                	mov    %ecx,%esi
+  803962:	85 c9                	test   %ecx,%ecx
+  803964:	74 16                	je     80397c <spawnl+0x65>
+  803966:	b8 00 00 00 00       	mov    $0x0,%eax
+		argv[i+1] = va_arg(vl, const char *);
+  80396b:	83 c0 01             	add    $0x1,%eax
+  80396e:	89 d1                	mov    %edx,%ecx
+  803970:	83 c2 04             	add    $0x4,%edx
+  803973:	8b 09                	mov    (%ecx),%ecx
+  803975:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	for(i=0;i<argc;i++)
+  803978:	39 f0                	cmp    %esi,%eax
+  80397a:	75 ef                	jne    80396b <spawnl+0x54>
+	return spawn(prog, argv);
+  80397c:	83 ec 08             	sub    $0x8,%esp
+  80397f:	53                   	push   %ebx
+  803980:	ff 75 08             	push   0x8(%ebp)
+  803983:	e8 07 f7 ff ff       	call   80308f <spawn>
+}
+  803988:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80398b:	5b                   	pop    %ebx
+  80398c:	5e                   	pop    %esi
+  80398d:	5d                   	pop    %ebp
+  80398e:	c3                   	ret
+
+0080398f <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80398f:	55                   	push   %ebp
+  803990:	89 e5                	mov    %esp,%ebp
+  803992:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803995:	68 cb 61 80 00       	push   $0x8061cb
+  80399a:	ff 75 0c             	push   0xc(%ebp)
+  80399d:	e8 05 db ff ff       	call   8014a7 <strcpy>
+	return 0;
+}
+  8039a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a7:	c9                   	leave
+  8039a8:	c3                   	ret
+
+008039a9 <devsock_close>:
+{
+  8039a9:	55                   	push   %ebp
+  8039aa:	89 e5                	mov    %esp,%ebp
+  8039ac:	53                   	push   %ebx
+  8039ad:	83 ec 10             	sub    $0x10,%esp
+  8039b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8039b3:	53                   	push   %ebx
+  8039b4:	e8 e6 1d 00 00       	call   80579f <pageref>
+  8039b9:	89 c2                	mov    %eax,%edx
+  8039bb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8039be:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8039c3:	83 fa 01             	cmp    $0x1,%edx
+  8039c6:	74 05                	je     8039cd <devsock_close+0x24>
+}
+  8039c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039cb:	c9                   	leave
+  8039cc:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8039cd:	83 ec 0c             	sub    $0xc,%esp
+  8039d0:	ff 73 0c             	push   0xc(%ebx)
+  8039d3:	e8 b0 05 00 00       	call   803f88 <nsipc_close>
+  8039d8:	83 c4 10             	add    $0x10,%esp
+  8039db:	eb eb                	jmp    8039c8 <devsock_close+0x1f>
+
+008039dd <devsock_write>:
+{
+  8039dd:	55                   	push   %ebp
+  8039de:	89 e5                	mov    %esp,%ebp
+  8039e0:	53                   	push   %ebx
+  8039e1:	83 ec 14             	sub    $0x14,%esp
+  8039e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8039ea:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8039ed:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8039f0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8039f3:	8b 41 08             	mov    0x8(%ecx),%eax
+  8039f6:	c1 f8 09             	sar    $0x9,%eax
+  8039f9:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8039fc:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803a02:	77 13                	ja     803a17 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  803a04:	50                   	push   %eax
+  803a05:	52                   	push   %edx
+  803a06:	53                   	push   %ebx
+  803a07:	ff 71 0c             	push   0xc(%ecx)
+  803a0a:	e8 5c 06 00 00       	call   80406b <nsipc_send>
+  803a0f:	83 c4 10             	add    $0x10,%esp
+}
+  803a12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a15:	c9                   	leave
+  803a16:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  803a17:	50                   	push   %eax
+  803a18:	6a 01                	push   $0x1
+  803a1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a1d:	50                   	push   %eax
+  803a1e:	ff 71 0c             	push   0xc(%ecx)
+  803a21:	e8 a6 06 00 00       	call   8040cc <nsipc_sendmsg>
+  803a26:	83 c4 10             	add    $0x10,%esp
+  803a29:	eb e7                	jmp    803a12 <devsock_write+0x35>
+
+00803a2b <devsock_read>:
+{
+  803a2b:	55                   	push   %ebp
+  803a2c:	89 e5                	mov    %esp,%ebp
+  803a2e:	53                   	push   %ebx
+  803a2f:	83 ec 14             	sub    $0x14,%esp
+  803a32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803a38:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  803a3b:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  803a3e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803a41:	8b 41 08             	mov    0x8(%ecx),%eax
+  803a44:	c1 f8 09             	sar    $0x9,%eax
+  803a47:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  803a4a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  803a50:	77 13                	ja     803a65 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  803a52:	50                   	push   %eax
+  803a53:	52                   	push   %edx
+  803a54:	53                   	push   %ebx
+  803a55:	ff 71 0c             	push   0xc(%ecx)
+  803a58:	e8 9c 05 00 00       	call   803ff9 <nsipc_recv>
+  803a5d:	83 c4 10             	add    $0x10,%esp
+}
+  803a60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a63:	c9                   	leave
+  803a64:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  803a65:	50                   	push   %eax
+  803a66:	6a 01                	push   $0x1
+  803a68:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a6b:	50                   	push   %eax
+  803a6c:	ff 71 0c             	push   0xc(%ecx)
+  803a6f:	e8 02 0a 00 00       	call   804476 <nsipc_recvmsg>
+  803a74:	83 c4 10             	add    $0x10,%esp
+  803a77:	eb e7                	jmp    803a60 <devsock_read+0x35>
+
+00803a79 <fd2sockid>:
+{
+  803a79:	55                   	push   %ebp
+  803a7a:	89 e5                	mov    %esp,%ebp
+  803a7c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803a7f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a82:	52                   	push   %edx
+  803a83:	50                   	push   %eax
+  803a84:	e8 f7 eb ff ff       	call   802680 <fd_lookup>
+  803a89:	83 c4 10             	add    $0x10,%esp
+  803a8c:	85 c0                	test   %eax,%eax
+  803a8e:	78 10                	js     803aa0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803a90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a93:	8b 0d 80 70 80 00    	mov    0x807080,%ecx
+  803a99:	39 08                	cmp    %ecx,(%eax)
+  803a9b:	75 05                	jne    803aa2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803a9d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803aa0:	c9                   	leave
+  803aa1:	c3                   	ret
+		return -E_NOT_SUPP;
+  803aa2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803aa7:	eb f7                	jmp    803aa0 <fd2sockid+0x27>
+
+00803aa9 <sock_flags>:
+{
+  803aa9:	55                   	push   %ebp
+  803aaa:	89 e5                	mov    %esp,%ebp
+  803aac:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  803aaf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ab2:	52                   	push   %edx
+  803ab3:	50                   	push   %eax
+  803ab4:	e8 c7 eb ff ff       	call   802680 <fd_lookup>
+  803ab9:	83 c4 10             	add    $0x10,%esp
+  803abc:	85 c0                	test   %eax,%eax
+  803abe:	78 0e                	js     803ace <sock_flags+0x25>
+  803ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ac3:	8b 40 08             	mov    0x8(%eax),%eax
+  803ac6:	c1 e8 09             	shr    $0x9,%eax
+  803ac9:	83 e0 08             	and    $0x8,%eax
+}
+  803acc:	c9                   	leave
+  803acd:	c3                   	ret
+		return 0;
+  803ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad3:	eb f7                	jmp    803acc <sock_flags+0x23>
+
+00803ad5 <alloc_sockfd>:
+{
+  803ad5:	55                   	push   %ebp
+  803ad6:	89 e5                	mov    %esp,%ebp
+  803ad8:	56                   	push   %esi
+  803ad9:	53                   	push   %ebx
+  803ada:	83 ec 1c             	sub    $0x1c,%esp
+  803add:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803adf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ae2:	50                   	push   %eax
+  803ae3:	e8 48 eb ff ff       	call   802630 <fd_alloc>
+  803ae8:	89 c3                	mov    %eax,%ebx
+  803aea:	83 c4 10             	add    $0x10,%esp
+  803aed:	85 c0                	test   %eax,%eax
+  803aef:	78 43                	js     803b34 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803af1:	83 ec 04             	sub    $0x4,%esp
+  803af4:	68 07 04 00 00       	push   $0x407
+  803af9:	ff 75 f4             	push   -0xc(%ebp)
+  803afc:	6a 00                	push   $0x0
+  803afe:	e8 d8 dd ff ff       	call   8018db <sys_page_alloc>
+  803b03:	89 c3                	mov    %eax,%ebx
+  803b05:	83 c4 10             	add    $0x10,%esp
+  803b08:	85 c0                	test   %eax,%eax
+  803b0a:	78 28                	js     803b34 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803b0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b0f:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  803b15:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803b17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b1a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803b21:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803b24:	83 ec 0c             	sub    $0xc,%esp
+  803b27:	50                   	push   %eax
+  803b28:	e8 dc ea ff ff       	call   802609 <fd2num>
+  803b2d:	89 c3                	mov    %eax,%ebx
+  803b2f:	83 c4 10             	add    $0x10,%esp
+  803b32:	eb 0c                	jmp    803b40 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803b34:	83 ec 0c             	sub    $0xc,%esp
+  803b37:	56                   	push   %esi
+  803b38:	e8 4b 04 00 00       	call   803f88 <nsipc_close>
+		return r;
+  803b3d:	83 c4 10             	add    $0x10,%esp
+}
+  803b40:	89 d8                	mov    %ebx,%eax
+  803b42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b45:	5b                   	pop    %ebx
+  803b46:	5e                   	pop    %esi
+  803b47:	5d                   	pop    %ebp
+  803b48:	c3                   	ret
+
+00803b49 <accept>:
+{
+  803b49:	55                   	push   %ebp
+  803b4a:	89 e5                	mov    %esp,%ebp
+  803b4c:	56                   	push   %esi
+  803b4d:	53                   	push   %ebx
+  803b4e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803b51:	89 f0                	mov    %esi,%eax
+  803b53:	e8 21 ff ff ff       	call   803a79 <fd2sockid>
+  803b58:	89 c3                	mov    %eax,%ebx
+  803b5a:	85 c0                	test   %eax,%eax
+  803b5c:	78 24                	js     803b82 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  803b5e:	89 f0                	mov    %esi,%eax
+  803b60:	e8 44 ff ff ff       	call   803aa9 <sock_flags>
+  803b65:	50                   	push   %eax
+  803b66:	ff 75 10             	push   0x10(%ebp)
+  803b69:	ff 75 0c             	push   0xc(%ebp)
+  803b6c:	53                   	push   %ebx
+  803b6d:	e8 6b 03 00 00       	call   803edd <nsipc_accept>
+  803b72:	89 c3                	mov    %eax,%ebx
+  803b74:	83 c4 10             	add    $0x10,%esp
+  803b77:	85 c0                	test   %eax,%eax
+  803b79:	78 07                	js     803b82 <accept+0x39>
+	return alloc_sockfd(r);
+  803b7b:	e8 55 ff ff ff       	call   803ad5 <alloc_sockfd>
+  803b80:	89 c3                	mov    %eax,%ebx
+}
+  803b82:	89 d8                	mov    %ebx,%eax
+  803b84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b87:	5b                   	pop    %ebx
+  803b88:	5e                   	pop    %esi
+  803b89:	5d                   	pop    %ebp
+  803b8a:	c3                   	ret
+
+00803b8b <bind>:
+{
+  803b8b:	55                   	push   %ebp
+  803b8c:	89 e5                	mov    %esp,%ebp
+  803b8e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803b91:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b94:	e8 e0 fe ff ff       	call   803a79 <fd2sockid>
+  803b99:	85 c0                	test   %eax,%eax
+  803b9b:	78 12                	js     803baf <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803b9d:	83 ec 04             	sub    $0x4,%esp
+  803ba0:	ff 75 10             	push   0x10(%ebp)
+  803ba3:	ff 75 0c             	push   0xc(%ebp)
+  803ba6:	50                   	push   %eax
+  803ba7:	e8 85 03 00 00       	call   803f31 <nsipc_bind>
+  803bac:	83 c4 10             	add    $0x10,%esp
+}
+  803baf:	c9                   	leave
+  803bb0:	c3                   	ret
+
+00803bb1 <shutdown>:
+{
+  803bb1:	55                   	push   %ebp
+  803bb2:	89 e5                	mov    %esp,%ebp
+  803bb4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bba:	e8 ba fe ff ff       	call   803a79 <fd2sockid>
+  803bbf:	85 c0                	test   %eax,%eax
+  803bc1:	78 0f                	js     803bd2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803bc3:	83 ec 08             	sub    $0x8,%esp
+  803bc6:	ff 75 0c             	push   0xc(%ebp)
+  803bc9:	50                   	push   %eax
+  803bca:	e8 97 03 00 00       	call   803f66 <nsipc_shutdown>
+  803bcf:	83 c4 10             	add    $0x10,%esp
+}
+  803bd2:	c9                   	leave
+  803bd3:	c3                   	ret
+
+00803bd4 <connect>:
+{
+  803bd4:	55                   	push   %ebp
+  803bd5:	89 e5                	mov    %esp,%ebp
+  803bd7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bdd:	e8 97 fe ff ff       	call   803a79 <fd2sockid>
+  803be2:	85 c0                	test   %eax,%eax
+  803be4:	78 12                	js     803bf8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803be6:	83 ec 04             	sub    $0x4,%esp
+  803be9:	ff 75 10             	push   0x10(%ebp)
+  803bec:	ff 75 0c             	push   0xc(%ebp)
+  803bef:	50                   	push   %eax
+  803bf0:	e8 ad 03 00 00       	call   803fa2 <nsipc_connect>
+  803bf5:	83 c4 10             	add    $0x10,%esp
+}
+  803bf8:	c9                   	leave
+  803bf9:	c3                   	ret
+
+00803bfa <listen>:
+{
+  803bfa:	55                   	push   %ebp
+  803bfb:	89 e5                	mov    %esp,%ebp
+  803bfd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803c00:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c03:	e8 71 fe ff ff       	call   803a79 <fd2sockid>
+  803c08:	85 c0                	test   %eax,%eax
+  803c0a:	78 0f                	js     803c1b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803c0c:	83 ec 08             	sub    $0x8,%esp
+  803c0f:	ff 75 0c             	push   0xc(%ebp)
+  803c12:	50                   	push   %eax
+  803c13:	e8 bf 03 00 00       	call   803fd7 <nsipc_listen>
+  803c18:	83 c4 10             	add    $0x10,%esp
+}
+  803c1b:	c9                   	leave
+  803c1c:	c3                   	ret
+
+00803c1d <sendmsg>:
+{
+  803c1d:	55                   	push   %ebp
+  803c1e:	89 e5                	mov    %esp,%ebp
+  803c20:	57                   	push   %edi
+  803c21:	56                   	push   %esi
+  803c22:	53                   	push   %ebx
+  803c23:	83 ec 0c             	sub    $0xc,%esp
+  803c26:	8b 75 08             	mov    0x8(%ebp),%esi
+  803c29:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  803c2c:	89 f0                	mov    %esi,%eax
+  803c2e:	e8 46 fe ff ff       	call   803a79 <fd2sockid>
+  803c33:	89 c3                	mov    %eax,%ebx
+  803c35:	85 c0                	test   %eax,%eax
+  803c37:	78 1c                	js     803c55 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  803c39:	89 f0                	mov    %esi,%eax
+  803c3b:	e8 69 fe ff ff       	call   803aa9 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  803c40:	0b 45 10             	or     0x10(%ebp),%eax
+  803c43:	50                   	push   %eax
+  803c44:	ff 77 0c             	push   0xc(%edi)
+  803c47:	ff 77 08             	push   0x8(%edi)
+  803c4a:	53                   	push   %ebx
+  803c4b:	e8 7c 04 00 00       	call   8040cc <nsipc_sendmsg>
+  803c50:	89 c3                	mov    %eax,%ebx
+  803c52:	83 c4 10             	add    $0x10,%esp
+}
+  803c55:	89 d8                	mov    %ebx,%eax
+  803c57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c5a:	5b                   	pop    %ebx
+  803c5b:	5e                   	pop    %esi
+  803c5c:	5f                   	pop    %edi
+  803c5d:	5d                   	pop    %ebp
+  803c5e:	c3                   	ret
+
+00803c5f <recvmsg>:
+{
+  803c5f:	55                   	push   %ebp
+  803c60:	89 e5                	mov    %esp,%ebp
+  803c62:	57                   	push   %edi
+  803c63:	56                   	push   %esi
+  803c64:	53                   	push   %ebx
+  803c65:	83 ec 0c             	sub    $0xc,%esp
+  803c68:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803c6e:	89 f8                	mov    %edi,%eax
+  803c70:	e8 04 fe ff ff       	call   803a79 <fd2sockid>
+  803c75:	89 c3                	mov    %eax,%ebx
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	78 2a                	js     803ca5 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  803c7b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  803c82:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  803c89:	89 f8                	mov    %edi,%eax
+  803c8b:	e8 19 fe ff ff       	call   803aa9 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  803c90:	0b 45 10             	or     0x10(%ebp),%eax
+  803c93:	50                   	push   %eax
+  803c94:	ff 76 0c             	push   0xc(%esi)
+  803c97:	ff 76 08             	push   0x8(%esi)
+  803c9a:	53                   	push   %ebx
+  803c9b:	e8 d6 07 00 00       	call   804476 <nsipc_recvmsg>
+  803ca0:	89 c3                	mov    %eax,%ebx
+  803ca2:	83 c4 10             	add    $0x10,%esp
+}
+  803ca5:	89 d8                	mov    %ebx,%eax
+  803ca7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803caa:	5b                   	pop    %ebx
+  803cab:	5e                   	pop    %esi
+  803cac:	5f                   	pop    %edi
+  803cad:	5d                   	pop    %ebp
+  803cae:	c3                   	ret
+
+00803caf <sendfile>:
+{
+  803caf:	55                   	push   %ebp
+  803cb0:	89 e5                	mov    %esp,%ebp
+  803cb2:	56                   	push   %esi
+  803cb3:	53                   	push   %ebx
+  803cb4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803cb7:	89 f0                	mov    %esi,%eax
+  803cb9:	e8 bb fd ff ff       	call   803a79 <fd2sockid>
+  803cbe:	89 c3                	mov    %eax,%ebx
+  803cc0:	85 c0                	test   %eax,%eax
+  803cc2:	78 1f                	js     803ce3 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  803cc4:	89 f0                	mov    %esi,%eax
+  803cc6:	e8 de fd ff ff       	call   803aa9 <sock_flags>
+  803ccb:	83 ec 0c             	sub    $0xc,%esp
+  803cce:	50                   	push   %eax
+  803ccf:	ff 75 14             	push   0x14(%ebp)
+  803cd2:	ff 75 10             	push   0x10(%ebp)
+  803cd5:	ff 75 0c             	push   0xc(%ebp)
+  803cd8:	53                   	push   %ebx
+  803cd9:	e8 64 06 00 00       	call   804342 <nsipc_sendfile>
+  803cde:	89 c3                	mov    %eax,%ebx
+  803ce0:	83 c4 20             	add    $0x20,%esp
+}
+  803ce3:	89 d8                	mov    %ebx,%eax
+  803ce5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ce8:	5b                   	pop    %ebx
+  803ce9:	5e                   	pop    %esi
+  803cea:	5d                   	pop    %ebp
+  803ceb:	c3                   	ret
+
+00803cec <evctl>:
+{
+  803cec:	55                   	push   %ebp
+  803ced:	89 e5                	mov    %esp,%ebp
+  803cef:	53                   	push   %ebx
+  803cf0:	83 ec 04             	sub    $0x4,%esp
+  803cf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  803cf6:	89 d8                	mov    %ebx,%eax
+  803cf8:	e8 7c fd ff ff       	call   803a79 <fd2sockid>
+  803cfd:	85 c0                	test   %eax,%eax
+  803cff:	78 10                	js     803d11 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  803d01:	83 ec 04             	sub    $0x4,%esp
+  803d04:	53                   	push   %ebx
+  803d05:	ff 75 0c             	push   0xc(%ebp)
+  803d08:	50                   	push   %eax
+  803d09:	e8 d2 0b 00 00       	call   8048e0 <nsipc_evctl>
+  803d0e:	83 c4 10             	add    $0x10,%esp
+}
+  803d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d14:	c9                   	leave
+  803d15:	c3                   	ret
+
+00803d16 <evwait>:
+{
+  803d16:	55                   	push   %ebp
+  803d17:	89 e5                	mov    %esp,%ebp
+  803d19:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  803d1c:	ff 75 10             	push   0x10(%ebp)
+  803d1f:	ff 75 0c             	push   0xc(%ebp)
+  803d22:	ff 75 08             	push   0x8(%ebp)
+  803d25:	e8 e0 0b 00 00       	call   80490a <nsipc_evwait>
+}
+  803d2a:	c9                   	leave
+  803d2b:	c3                   	ret
+
+00803d2c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803d2c:	55                   	push   %ebp
+  803d2d:	89 e5                	mov    %esp,%ebp
+  803d2f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803d32:	ff 75 10             	push   0x10(%ebp)
+  803d35:	ff 75 0c             	push   0xc(%ebp)
+  803d38:	ff 75 08             	push   0x8(%ebp)
+  803d3b:	e8 31 0c 00 00       	call   804971 <nsipc_socket>
+  803d40:	83 c4 10             	add    $0x10,%esp
+  803d43:	85 c0                	test   %eax,%eax
+  803d45:	78 05                	js     803d4c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803d47:	e8 89 fd ff ff       	call   803ad5 <alloc_sockfd>
+}
+  803d4c:	c9                   	leave
+  803d4d:	c3                   	ret
+
+00803d4e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803d4e:	55                   	push   %ebp
+  803d4f:	89 e5                	mov    %esp,%ebp
+  803d51:	53                   	push   %ebx
+  803d52:	83 ec 04             	sub    $0x4,%esp
+  803d55:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  803d57:	83 3d 44 94 80 00 00 	cmpl   $0x0,0x809444
+  803d5e:	74 26                	je     803d86 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803d60:	6a 07                	push   $0x7
+  803d62:	68 00 b0 80 00       	push   $0x80b000
+  803d67:	53                   	push   %ebx
+  803d68:	ff 35 44 94 80 00    	push   0x809444
+  803d6e:	e8 84 19 00 00       	call   8056f7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803d73:	83 c4 0c             	add    $0xc,%esp
+  803d76:	6a 00                	push   $0x0
+  803d78:	6a 00                	push   $0x0
+  803d7a:	6a 00                	push   $0x0
+  803d7c:	e8 e6 16 00 00       	call   805467 <ipc_recv>
+}
+  803d81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d84:	c9                   	leave
+  803d85:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803d86:	83 ec 0c             	sub    $0xc,%esp
+  803d89:	6a 03                	push   $0x3
+  803d8b:	e8 d0 19 00 00       	call   805760 <ipc_find_env>
+  803d90:	a3 44 94 80 00       	mov    %eax,0x809444
+  803d95:	83 c4 10             	add    $0x10,%esp
+  803d98:	eb c6                	jmp    803d60 <nsipc+0x12>
+
+00803d9a <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  803d9a:	55                   	push   %ebp
+  803d9b:	89 e5                	mov    %esp,%ebp
+  803d9d:	56                   	push   %esi
+  803d9e:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  803d9f:	8b 35 50 94 80 00    	mov    0x809450,%esi
+		return 0;
+  803da5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  803daa:	85 f6                	test   %esi,%esi
+  803dac:	75 33                	jne    803de1 <nsbulk_map+0x47>
+  803dae:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  803db3:	83 ec 04             	sub    $0x4,%esp
+  803db6:	6a 07                	push   $0x7
+  803db8:	53                   	push   %ebx
+  803db9:	6a 00                	push   $0x0
+  803dbb:	e8 1b db ff ff       	call   8018db <sys_page_alloc>
+  803dc0:	83 c4 10             	add    $0x10,%esp
+  803dc3:	85 c0                	test   %eax,%eax
+  803dc5:	78 1a                	js     803de1 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  803dc7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803dcd:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  803dd3:	75 de                	jne    803db3 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  803dd5:	c7 05 50 94 80 00 01 	movl   $0x1,0x809450
+  803ddc:	00 00 00 
+	return 0;
+  803ddf:	89 f0                	mov    %esi,%eax
+}
+  803de1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803de4:	5b                   	pop    %ebx
+  803de5:	5e                   	pop    %esi
+  803de6:	5d                   	pop    %ebp
+  803de7:	c3                   	ret
+
+00803de8 <nsbulk_own>:
+{
+  803de8:	55                   	push   %ebp
+  803de9:	89 e5                	mov    %esp,%ebp
+  803deb:	57                   	push   %edi
+  803dec:	56                   	push   %esi
+  803ded:	53                   	push   %ebx
+  803dee:	83 ec 0c             	sub    $0xc,%esp
+  803df1:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  803df3:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  803df6:	85 d2                	test   %edx,%edx
+  803df8:	7f 0e                	jg     803e08 <nsbulk_own+0x20>
+	return 0;
+  803dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dff:	eb 47                	jmp    803e48 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  803e01:	83 c3 01             	add    $0x1,%ebx
+  803e04:	39 fb                	cmp    %edi,%ebx
+  803e06:	7d 3b                	jge    803e43 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  803e08:	be 01 00 00 00       	mov    $0x1,%esi
+  803e0d:	89 d9                	mov    %ebx,%ecx
+  803e0f:	d3 e6                	shl    %cl,%esi
+  803e11:	89 f0                	mov    %esi,%eax
+  803e13:	23 05 4c 94 80 00    	and    0x80944c,%eax
+  803e19:	74 e6                	je     803e01 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  803e1b:	83 ec 04             	sub    $0x4,%esp
+  803e1e:	6a 07                	push   $0x7
+  803e20:	89 d8                	mov    %ebx,%eax
+  803e22:	c1 e0 0c             	shl    $0xc,%eax
+  803e25:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803e2a:	50                   	push   %eax
+  803e2b:	6a 00                	push   $0x0
+  803e2d:	e8 a9 da ff ff       	call   8018db <sys_page_alloc>
+  803e32:	83 c4 10             	add    $0x10,%esp
+  803e35:	85 c0                	test   %eax,%eax
+  803e37:	78 0f                	js     803e48 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  803e39:	f7 d6                	not    %esi
+  803e3b:	21 35 4c 94 80 00    	and    %esi,0x80944c
+  803e41:	eb be                	jmp    803e01 <nsbulk_own+0x19>
+	return 0;
+  803e43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e4b:	5b                   	pop    %ebx
+  803e4c:	5e                   	pop    %esi
+  803e4d:	5f                   	pop    %edi
+  803e4e:	5d                   	pop    %ebp
+  803e4f:	c3                   	ret
+
+00803e50 <nsipc_bulk>:
+{
+  803e50:	55                   	push   %ebp
+  803e51:	89 e5                	mov    %esp,%ebp
+  803e53:	57                   	push   %edi
+  803e54:	56                   	push   %esi
+  803e55:	53                   	push   %ebx
+  803e56:	83 ec 1c             	sub    $0x1c,%esp
+  803e59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803e5c:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  803e5e:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  803e64:	c1 fb 0c             	sar    $0xc,%ebx
+  803e67:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  803e6a:	83 3d 44 94 80 00 00 	cmpl   $0x0,0x809444
+  803e71:	74 56                	je     803ec9 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803e73:	85 ff                	test   %edi,%edi
+  803e75:	7e 24                	jle    803e9b <nsipc_bulk+0x4b>
+  803e77:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  803e7d:	74 1c                	je     803e9b <nsipc_bulk+0x4b>
+  803e7f:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  803e85:	c1 e3 0c             	shl    $0xc,%ebx
+  803e88:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  803e8d:	0f b6 10             	movzbl (%eax),%edx
+  803e90:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803e92:	05 00 10 00 00       	add    $0x1000,%eax
+  803e97:	39 d8                	cmp    %ebx,%eax
+  803e99:	75 f2                	jne    803e8d <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  803e9b:	83 ec 0c             	sub    $0xc,%esp
+  803e9e:	56                   	push   %esi
+  803e9f:	57                   	push   %edi
+  803ea0:	68 00 00 00 e0       	push   $0xe0000000
+  803ea5:	ff 75 e4             	push   -0x1c(%ebp)
+  803ea8:	ff 35 44 94 80 00    	push   0x809444
+  803eae:	e8 78 18 00 00       	call   80572b <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  803eb3:	83 c4 1c             	add    $0x1c,%esp
+  803eb6:	6a 00                	push   $0x0
+  803eb8:	6a 00                	push   $0x0
+  803eba:	6a 00                	push   $0x0
+  803ebc:	e8 a6 15 00 00       	call   805467 <ipc_recv>
+}
+  803ec1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ec4:	5b                   	pop    %ebx
+  803ec5:	5e                   	pop    %esi
+  803ec6:	5f                   	pop    %edi
+  803ec7:	5d                   	pop    %ebp
+  803ec8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803ec9:	83 ec 0c             	sub    $0xc,%esp
+  803ecc:	6a 03                	push   $0x3
+  803ece:	e8 8d 18 00 00       	call   805760 <ipc_find_env>
+  803ed3:	a3 44 94 80 00       	mov    %eax,0x809444
+  803ed8:	83 c4 10             	add    $0x10,%esp
+  803edb:	eb 96                	jmp    803e73 <nsipc_bulk+0x23>
+
+00803edd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  803edd:	55                   	push   %ebp
+  803ede:	89 e5                	mov    %esp,%ebp
+  803ee0:	53                   	push   %ebx
+  803ee1:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803ee4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ee7:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_flags = flags;
+  803eec:	8b 45 14             	mov    0x14(%ebp),%eax
+  803eef:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803ef4:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ef9:	e8 50 fe ff ff       	call   803d4e <nsipc>
+  803efe:	89 c3                	mov    %eax,%ebx
+  803f00:	85 c0                	test   %eax,%eax
+  803f02:	79 07                	jns    803f0b <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803f04:	89 d8                	mov    %ebx,%eax
+  803f06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f09:	c9                   	leave
+  803f0a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803f0b:	83 ec 04             	sub    $0x4,%esp
+  803f0e:	ff 35 10 b0 80 00    	push   0x80b010
+  803f14:	68 00 b0 80 00       	push   $0x80b000
+  803f19:	ff 75 0c             	push   0xc(%ebp)
+  803f1c:	e8 36 d7 ff ff       	call   801657 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803f21:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  803f27:	8b 45 10             	mov    0x10(%ebp),%eax
+  803f2a:	89 10                	mov    %edx,(%eax)
+  803f2c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803f2f:	eb d3                	jmp    803f04 <nsipc_accept+0x27>
+
+00803f31 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803f31:	55                   	push   %ebp
+  803f32:	89 e5                	mov    %esp,%ebp
+  803f34:	53                   	push   %ebx
+  803f35:	83 ec 08             	sub    $0x8,%esp
+  803f38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f3e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803f43:	53                   	push   %ebx
+  803f44:	ff 75 0c             	push   0xc(%ebp)
+  803f47:	68 04 b0 80 00       	push   $0x80b004
+  803f4c:	e8 06 d7 ff ff       	call   801657 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803f51:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  803f57:	b8 02 00 00 00       	mov    $0x2,%eax
+  803f5c:	e8 ed fd ff ff       	call   803d4e <nsipc>
+}
+  803f61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f64:	c9                   	leave
+  803f65:	c3                   	ret
+
+00803f66 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803f66:	55                   	push   %ebp
+  803f67:	89 e5                	mov    %esp,%ebp
+  803f69:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f6f:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  803f74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f77:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  803f7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  803f81:	e8 c8 fd ff ff       	call   803d4e <nsipc>
+}
+  803f86:	c9                   	leave
+  803f87:	c3                   	ret
+
+00803f88 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803f88:	55                   	push   %ebp
+  803f89:	89 e5                	mov    %esp,%ebp
+  803f8b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803f8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f91:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  803f96:	b8 04 00 00 00       	mov    $0x4,%eax
+  803f9b:	e8 ae fd ff ff       	call   803d4e <nsipc>
+}
+  803fa0:	c9                   	leave
+  803fa1:	c3                   	ret
+
+00803fa2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803fa2:	55                   	push   %ebp
+  803fa3:	89 e5                	mov    %esp,%ebp
+  803fa5:	53                   	push   %ebx
+  803fa6:	83 ec 08             	sub    $0x8,%esp
+  803fa9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803fac:	8b 45 08             	mov    0x8(%ebp),%eax
+  803faf:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803fb4:	53                   	push   %ebx
+  803fb5:	ff 75 0c             	push   0xc(%ebp)
+  803fb8:	68 04 b0 80 00       	push   $0x80b004
+  803fbd:	e8 95 d6 ff ff       	call   801657 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803fc2:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  803fc8:	b8 05 00 00 00       	mov    $0x5,%eax
+  803fcd:	e8 7c fd ff ff       	call   803d4e <nsipc>
+}
+  803fd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fd5:	c9                   	leave
+  803fd6:	c3                   	ret
+
+00803fd7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803fd7:	55                   	push   %ebp
+  803fd8:	89 e5                	mov    %esp,%ebp
+  803fda:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803fdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fe0:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  803fe5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803fe8:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  803fed:	b8 06 00 00 00       	mov    $0x6,%eax
+  803ff2:	e8 57 fd ff ff       	call   803d4e <nsipc>
+}
+  803ff7:	c9                   	leave
+  803ff8:	c3                   	ret
+
+00803ff9 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803ff9:	55                   	push   %ebp
+  803ffa:	89 e5                	mov    %esp,%ebp
+  803ffc:	56                   	push   %esi
+  803ffd:	53                   	push   %ebx
+  803ffe:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804001:	8b 45 08             	mov    0x8(%ebp),%eax
+  804004:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  804009:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  80400f:	8b 45 14             	mov    0x14(%ebp),%eax
+  804012:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804017:	b8 07 00 00 00       	mov    $0x7,%eax
+  80401c:	e8 2d fd ff ff       	call   803d4e <nsipc>
+  804021:	89 c3                	mov    %eax,%ebx
+  804023:	85 c0                	test   %eax,%eax
+  804025:	78 22                	js     804049 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  804027:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80402c:	39 c6                	cmp    %eax,%esi
+  80402e:	0f 4e c6             	cmovle %esi,%eax
+  804031:	39 c3                	cmp    %eax,%ebx
+  804033:	7f 1d                	jg     804052 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804035:	83 ec 04             	sub    $0x4,%esp
+  804038:	53                   	push   %ebx
+  804039:	68 00 b0 80 00       	push   $0x80b000
+  80403e:	ff 75 0c             	push   0xc(%ebp)
+  804041:	e8 11 d6 ff ff       	call   801657 <memmove>
+  804046:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  804049:	89 d8                	mov    %ebx,%eax
+  80404b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80404e:	5b                   	pop    %ebx
+  80404f:	5e                   	pop    %esi
+  804050:	5d                   	pop    %ebp
+  804051:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  804052:	68 d7 61 80 00       	push   $0x8061d7
+  804057:	68 1f 5b 80 00       	push   $0x805b1f
+  80405c:	68 b2 00 00 00       	push   $0xb2
+  804061:	68 ec 61 80 00       	push   $0x8061ec
+  804066:	e8 7a cb ff ff       	call   800be5 <_panic>
+
+0080406b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80406b:	55                   	push   %ebp
+  80406c:	89 e5                	mov    %esp,%ebp
+  80406e:	53                   	push   %ebx
+  80406f:	83 ec 04             	sub    $0x4,%esp
+  804072:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  804075:	8b 45 08             	mov    0x8(%ebp),%eax
+  804078:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  80407d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  804083:	7f 2e                	jg     8040b3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  804085:	83 ec 04             	sub    $0x4,%esp
+  804088:	53                   	push   %ebx
+  804089:	ff 75 0c             	push   0xc(%ebp)
+  80408c:	68 0c b0 80 00       	push   $0x80b00c
+  804091:	e8 c1 d5 ff ff       	call   801657 <memmove>
+	nsipcbuf.send.req_size = size;
+  804096:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  80409c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80409f:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  8040a4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8040a9:	e8 a0 fc ff ff       	call   803d4e <nsipc>
+}
+  8040ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040b1:	c9                   	leave
+  8040b2:	c3                   	ret
+	assert(size < 1600);
+  8040b3:	68 f8 61 80 00       	push   $0x8061f8
+  8040b8:	68 1f 5b 80 00       	push   $0x805b1f
+  8040bd:	68 bd 00 00 00       	push   $0xbd
+  8040c2:	68 ec 61 80 00       	push   $0x8061ec
+  8040c7:	e8 19 cb ff ff       	call   800be5 <_panic>
+
+008040cc <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8040cc:	55                   	push   %ebp
+  8040cd:	89 e5                	mov    %esp,%ebp
+  8040cf:	57                   	push   %edi
+  8040d0:	56                   	push   %esi
+  8040d1:	53                   	push   %ebx
+  8040d2:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8040d5:	e8 c0 fc ff ff       	call   803d9a <nsbulk_map>
+  8040da:	85 c0                	test   %eax,%eax
+  8040dc:	78 55                	js     804133 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8040de:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8040e5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8040ec:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8040f3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8040f6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8040f9:	0f 8d 24 02 00 00    	jge    804323 <nsipc_sendmsg+0x257>
+  8040ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804102:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804105:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  804108:	89 d8                	mov    %ebx,%eax
+  80410a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80410f:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  804111:	83 ec 0c             	sub    $0xc,%esp
+  804114:	68 40 91 80 00       	push   $0x809140
+  804119:	e8 bc 0f 00 00       	call   8050da <pgbatch_init>
+  80411e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  804121:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  804123:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  804126:	e9 82 00 00 00       	jmp    8041ad <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80412b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80412e:	85 db                	test   %ebx,%ebx
+  804130:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  804133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804136:	5b                   	pop    %ebx
+  804137:	5e                   	pop    %esi
+  804138:	5f                   	pop    %edi
+  804139:	5d                   	pop    %ebp
+  80413a:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80413b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  804140:	29 c8                	sub    %ecx,%eax
+  804142:	39 d0                	cmp    %edx,%eax
+  804144:	0f 46 d0             	cmovbe %eax,%edx
+  804147:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  804149:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80414f:	85 ff                	test   %edi,%edi
+  804151:	0f 49 c7             	cmovns %edi,%eax
+  804154:	c1 f8 0c             	sar    $0xc,%eax
+  804157:	ba 01 00 00 00       	mov    $0x1,%edx
+  80415c:	e8 87 fc ff ff       	call   803de8 <nsbulk_own>
+  804161:	85 c0                	test   %eax,%eax
+  804163:	0f 88 17 01 00 00    	js     804280 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  804169:	83 ec 04             	sub    $0x4,%esp
+  80416c:	56                   	push   %esi
+  80416d:	ff 75 e0             	push   -0x20(%ebp)
+  804170:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804173:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  804178:	50                   	push   %eax
+  804179:	e8 d9 d4 ff ff       	call   801657 <memmove>
+  80417e:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  804181:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  804184:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804187:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80418a:	0f 84 fd 00 00 00    	je     80428d <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  804190:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804193:	01 f7                	add    %esi,%edi
+  804195:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  804198:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80419b:	0f 8d 01 01 00 00    	jge    8042a2 <nsipc_sendmsg+0x1d6>
+  8041a1:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8041a7:	0f 8f f0 00 00 00    	jg     80429d <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8041ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041b0:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8041b3:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8041b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8041b9:	89 c2                	mov    %eax,%edx
+  8041bb:	03 13                	add    (%ebx),%edx
+  8041bd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8041c0:	8b 73 04             	mov    0x4(%ebx),%esi
+  8041c3:	29 c6                	sub    %eax,%esi
+  8041c5:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8041ca:	29 f9                	sub    %edi,%ecx
+  8041cc:	39 ce                	cmp    %ecx,%esi
+  8041ce:	89 ca                	mov    %ecx,%edx
+  8041d0:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8041d3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8041d6:	89 f9                	mov    %edi,%ecx
+  8041d8:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8041de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041e1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8041e6:	09 c8                	or     %ecx,%eax
+  8041e8:	0f 85 4d ff ff ff    	jne    80413b <nsipc_sendmsg+0x6f>
+  8041ee:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8041f4:	0f 86 41 ff ff ff    	jbe    80413b <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8041fa:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  804200:	85 ff                	test   %edi,%edi
+  804202:	0f 49 c7             	cmovns %edi,%eax
+  804205:	c1 f8 0c             	sar    $0xc,%eax
+  804208:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80420a:	89 d1                	mov    %edx,%ecx
+  80420c:	c1 e9 0c             	shr    $0xc,%ecx
+  80420f:	01 c8                	add    %ecx,%eax
+  804211:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  804214:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804217:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  804219:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80421c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  804221:	29 c8                	sub    %ecx,%eax
+  804223:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  804226:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  804229:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80422b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804230:	89 f9                	mov    %edi,%ecx
+  804232:	d3 e0                	shl    %cl,%eax
+  804234:	09 05 4c 94 80 00    	or     %eax,0x80944c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80423a:	83 ec 08             	sub    $0x8,%esp
+  80423d:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80423f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  804242:	50                   	push   %eax
+  804243:	6a 00                	push   $0x0
+  804245:	56                   	push   %esi
+  804246:	6a 00                	push   $0x0
+  804248:	68 40 91 80 00       	push   $0x809140
+  80424d:	e8 46 0f 00 00       	call   805198 <pgbatch_map>
+  804252:	83 c4 20             	add    $0x20,%esp
+  804255:	85 c0                	test   %eax,%eax
+  804257:	0f 88 ce fe ff ff    	js     80412b <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80425d:	83 c7 01             	add    $0x1,%edi
+  804260:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804266:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804269:	39 c7                	cmp    %eax,%edi
+  80426b:	75 be                	jne    80422b <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80426d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804270:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  804273:	89 d6                	mov    %edx,%esi
+  804275:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80427b:	e9 01 ff ff ff       	jmp    804181 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  804280:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  804283:	85 db                	test   %ebx,%ebx
+  804285:	0f 45 c3             	cmovne %ebx,%eax
+  804288:	e9 a6 fe ff ff       	jmp    804133 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80428d:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  804291:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804298:	e9 f3 fe ff ff       	jmp    804190 <nsipc_sendmsg+0xc4>
+  80429d:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8042a0:	eb 03                	jmp    8042a5 <nsipc_sendmsg+0x1d9>
+  8042a2:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8042a5:	83 ec 0c             	sub    $0xc,%esp
+  8042a8:	68 40 91 80 00       	push   $0x809140
+  8042ad:	e8 36 0e 00 00       	call   8050e8 <pgbatch_flush>
+  8042b2:	83 c4 10             	add    $0x10,%esp
+  8042b5:	85 c0                	test   %eax,%eax
+  8042b7:	78 50                	js     804309 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8042b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042bc:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8042c1:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8042c7:	89 fb                	mov    %edi,%ebx
+  8042c9:	29 f3                	sub    %esi,%ebx
+  8042cb:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8042d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8042d4:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8042d9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8042de:	89 fa                	mov    %edi,%edx
+  8042e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8042e5:	e8 66 fb ff ff       	call   803e50 <nsipc_bulk>
+  8042ea:	85 c0                	test   %eax,%eax
+  8042ec:	78 28                	js     804316 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8042ee:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8042f1:	39 c3                	cmp    %eax,%ebx
+  8042f3:	75 0c                	jne    804301 <nsipc_sendmsg+0x235>
+  8042f5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8042f8:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8042fb:	0f 8f f2 fd ff ff    	jg     8040f3 <nsipc_sendmsg+0x27>
+		sent += r;
+  804301:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804304:	e9 2a fe ff ff       	jmp    804133 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  804309:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80430c:	85 db                	test   %ebx,%ebx
+  80430e:	0f 45 c3             	cmovne %ebx,%eax
+  804311:	e9 1d fe ff ff       	jmp    804133 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  804316:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  804319:	85 db                	test   %ebx,%ebx
+  80431b:	0f 45 c3             	cmovne %ebx,%eax
+  80431e:	e9 10 fe ff ff       	jmp    804133 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  804323:	83 ec 0c             	sub    $0xc,%esp
+  804326:	68 40 91 80 00       	push   $0x809140
+  80432b:	e8 aa 0d 00 00       	call   8050da <pgbatch_init>
+  804330:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  804333:	be 00 00 00 00       	mov    $0x0,%esi
+  804338:	bf 00 00 00 00       	mov    $0x0,%edi
+  80433d:	e9 63 ff ff ff       	jmp    8042a5 <nsipc_sendmsg+0x1d9>
+
+00804342 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  804342:	55                   	push   %ebp
+  804343:	89 e5                	mov    %esp,%ebp
+  804345:	57                   	push   %edi
+  804346:	56                   	push   %esi
+  804347:	53                   	push   %ebx
+  804348:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80434b:	83 3d 48 94 80 00 00 	cmpl   $0x0,0x809448
+  804352:	0f 84 c8 00 00 00    	je     804420 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  804358:	83 3d 44 94 80 00 00 	cmpl   $0x0,0x809444
+  80435f:	0f 84 e4 00 00 00    	je     804449 <nsipc_sendfile+0x107>
+{
+  804365:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80436a:	89 fb                	mov    %edi,%ebx
+  80436c:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80436f:	0f 83 f0 00 00 00    	jae    804465 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  804375:	89 fa                	mov    %edi,%edx
+  804377:	03 55 10             	add    0x10(%ebp),%edx
+  80437a:	89 d0                	mov    %edx,%eax
+  80437c:	c1 f8 1f             	sar    $0x1f,%eax
+  80437f:	c1 e8 14             	shr    $0x14,%eax
+  804382:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  804385:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80438b:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80438d:	6a 10                	push   $0x10
+  80438f:	68 00 20 01 e0       	push   $0xe0012000
+  804394:	52                   	push   %edx
+  804395:	ff 75 0c             	push   0xc(%ebp)
+  804398:	e8 ea ea ff ff       	call   802e87 <fmap>
+  80439d:	83 c4 10             	add    $0x10,%esp
+  8043a0:	85 c0                	test   %eax,%eax
+  8043a2:	0f 8e b8 00 00 00    	jle    804460 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8043a8:	39 c6                	cmp    %eax,%esi
+  8043aa:	0f 8d b5 00 00 00    	jge    804465 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8043b0:	29 f0                	sub    %esi,%eax
+  8043b2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8043b5:	29 da                	sub    %ebx,%edx
+  8043b7:	39 d0                	cmp    %edx,%eax
+  8043b9:	89 d3                	mov    %edx,%ebx
+  8043bb:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8043be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043c1:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8043c6:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8043cc:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8043d2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8043d5:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8043da:	83 ec 0c             	sub    $0xc,%esp
+  8043dd:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8043df:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8043e6:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8043e9:	83 c0 01             	add    $0x1,%eax
+  8043ec:	50                   	push   %eax
+  8043ed:	68 00 10 01 e0       	push   $0xe0011000
+  8043f2:	6a 11                	push   $0x11
+  8043f4:	ff 35 44 94 80 00    	push   0x809444
+  8043fa:	e8 2c 13 00 00       	call   80572b <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8043ff:	83 c4 1c             	add    $0x1c,%esp
+  804402:	6a 00                	push   $0x0
+  804404:	6a 00                	push   $0x0
+  804406:	6a 00                	push   $0x0
+  804408:	e8 5a 10 00 00       	call   805467 <ipc_recv>
+  80440d:	83 c4 10             	add    $0x10,%esp
+  804410:	85 c0                	test   %eax,%eax
+  804412:	78 5b                	js     80446f <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  804414:	01 c7                	add    %eax,%edi
+		if (r < n)
+  804416:	39 c3                	cmp    %eax,%ebx
+  804418:	0f 8e 4c ff ff ff    	jle    80436a <nsipc_sendfile+0x28>
+  80441e:	eb 45                	jmp    804465 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  804420:	83 ec 04             	sub    $0x4,%esp
+  804423:	6a 07                	push   $0x7
+  804425:	68 00 10 01 e0       	push   $0xe0011000
+  80442a:	6a 00                	push   $0x0
+  80442c:	e8 aa d4 ff ff       	call   8018db <sys_page_alloc>
+  804431:	89 c7                	mov    %eax,%edi
+  804433:	83 c4 10             	add    $0x10,%esp
+  804436:	85 c0                	test   %eax,%eax
+  804438:	78 2b                	js     804465 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80443a:	c7 05 48 94 80 00 01 	movl   $0x1,0x809448
+  804441:	00 00 00 
+  804444:	e9 0f ff ff ff       	jmp    804358 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804449:	83 ec 0c             	sub    $0xc,%esp
+  80444c:	6a 03                	push   $0x3
+  80444e:	e8 0d 13 00 00       	call   805760 <ipc_find_env>
+  804453:	a3 44 94 80 00       	mov    %eax,0x809444
+  804458:	83 c4 10             	add    $0x10,%esp
+  80445b:	e9 05 ff ff ff       	jmp    804365 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  804460:	85 ff                	test   %edi,%edi
+  804462:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  804465:	89 f8                	mov    %edi,%eax
+  804467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80446a:	5b                   	pop    %ebx
+  80446b:	5e                   	pop    %esi
+  80446c:	5f                   	pop    %edi
+  80446d:	5d                   	pop    %ebp
+  80446e:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80446f:	85 ff                	test   %edi,%edi
+  804471:	0f 44 f8             	cmove  %eax,%edi
+  804474:	eb ef                	jmp    804465 <nsipc_sendfile+0x123>
+
+00804476 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  804476:	55                   	push   %ebp
+  804477:	89 e5                	mov    %esp,%ebp
+  804479:	57                   	push   %edi
+  80447a:	56                   	push   %esi
+  80447b:	53                   	push   %ebx
+  80447c:	83 ec 1c             	sub    $0x1c,%esp
+  80447f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  804482:	e8 13 f9 ff ff       	call   803d9a <nsbulk_map>
+  804487:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80448a:	85 c0                	test   %eax,%eax
+  80448c:	0f 88 ba 00 00 00    	js     80454c <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  804492:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804496:	0f 8e bb 00 00 00    	jle    804557 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80449c:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8044a1:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8044a6:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8044ab:	89 f8                	mov    %edi,%eax
+  8044ad:	29 f0                	sub    %esi,%eax
+  8044af:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8044b3:	39 c8                	cmp    %ecx,%eax
+  8044b5:	0f 47 c1             	cmova  %ecx,%eax
+  8044b8:	01 f0                	add    %esi,%eax
+  8044ba:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8044bc:	83 c2 01             	add    $0x1,%edx
+  8044bf:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8044c2:	7e 07                	jle    8044cb <nsipc_recvmsg+0x55>
+  8044c4:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8044c9:	7e e0                	jle    8044ab <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8044cb:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8044d1:	c1 fa 0c             	sar    $0xc,%edx
+  8044d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d9:	e8 0a f9 ff ff       	call   803de8 <nsbulk_own>
+  8044de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8044e1:	85 c0                	test   %eax,%eax
+  8044e3:	78 67                	js     80454c <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8044e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044e8:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8044ed:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8044f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8044f6:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8044fb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804500:	89 f2                	mov    %esi,%edx
+  804502:	b8 0d 00 00 00       	mov    $0xd,%eax
+  804507:	e8 44 f9 ff ff       	call   803e50 <nsipc_bulk>
+  80450c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80450f:	85 c0                	test   %eax,%eax
+  804511:	78 39                	js     80454c <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  804513:	39 f0                	cmp    %esi,%eax
+  804515:	7f 4a                	jg     804561 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  804517:	bf 00 00 00 00       	mov    $0x0,%edi
+  80451c:	85 c0                	test   %eax,%eax
+  80451e:	7e 2c                	jle    80454c <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  804520:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804523:	29 fe                	sub    %edi,%esi
+  804525:	8b 43 04             	mov    0x4(%ebx),%eax
+  804528:	39 c6                	cmp    %eax,%esi
+  80452a:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80452d:	83 ec 04             	sub    $0x4,%esp
+  804530:	56                   	push   %esi
+  804531:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  804537:	50                   	push   %eax
+  804538:	ff 33                	push   (%ebx)
+  80453a:	e8 18 d1 ff ff       	call   801657 <memmove>
+		n += m;
+  80453f:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  804541:	83 c3 08             	add    $0x8,%ebx
+  804544:	83 c4 10             	add    $0x10,%esp
+  804547:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80454a:	7f d4                	jg     804520 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80454c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80454f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804552:	5b                   	pop    %ebx
+  804553:	5e                   	pop    %esi
+  804554:	5f                   	pop    %edi
+  804555:	5d                   	pop    %ebp
+  804556:	c3                   	ret
+	int r, i, n, len = 0;
+  804557:	be 00 00 00 00       	mov    $0x0,%esi
+  80455c:	e9 6a ff ff ff       	jmp    8044cb <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  804561:	68 e3 61 80 00       	push   $0x8061e3
+  804566:	68 1f 5b 80 00       	push   $0x805b1f
+  80456b:	68 3b 01 00 00       	push   $0x13b
+  804570:	68 ec 61 80 00       	push   $0x8061ec
+  804575:	e8 6b c6 ff ff       	call   800be5 <_panic>
+
+0080457a <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80457a:	55                   	push   %ebp
+  80457b:	89 e5                	mov    %esp,%ebp
+  80457d:	57                   	push   %edi
+  80457e:	56                   	push   %esi
+  80457f:	53                   	push   %ebx
+  804580:	83 ec 0c             	sub    $0xc,%esp
+  804583:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804586:	8b 75 10             	mov    0x10(%ebp),%esi
+  804589:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80458c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80458f:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.select.req_readset = *readset;
+  804594:	8b 07                	mov    (%edi),%eax
+  804596:	a3 04 b0 80 00       	mov    %eax,0x80b004
+  80459b:	8b 47 04             	mov    0x4(%edi),%eax
+  80459e:	a3 08 b0 80 00       	mov    %eax,0x80b008
+  8045a3:	8b 47 08             	mov    0x8(%edi),%eax
+  8045a6:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+  8045ab:	8b 47 0c             	mov    0xc(%edi),%eax
+  8045ae:	a3 10 b0 80 00       	mov    %eax,0x80b010
+  8045b3:	8b 47 10             	mov    0x10(%edi),%eax
+  8045b6:	a3 14 b0 80 00       	mov    %eax,0x80b014
+  8045bb:	8b 47 14             	mov    0x14(%edi),%eax
+  8045be:	a3 18 b0 80 00       	mov    %eax,0x80b018
+  8045c3:	8b 47 18             	mov    0x18(%edi),%eax
+  8045c6:	a3 1c b0 80 00       	mov    %eax,0x80b01c
+  8045cb:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8045ce:	a3 20 b0 80 00       	mov    %eax,0x80b020
+  8045d3:	8b 47 20             	mov    0x20(%edi),%eax
+  8045d6:	a3 24 b0 80 00       	mov    %eax,0x80b024
+  8045db:	8b 47 24             	mov    0x24(%edi),%eax
+  8045de:	a3 28 b0 80 00       	mov    %eax,0x80b028
+  8045e3:	8b 47 28             	mov    0x28(%edi),%eax
+  8045e6:	a3 2c b0 80 00       	mov    %eax,0x80b02c
+  8045eb:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8045ee:	a3 30 b0 80 00       	mov    %eax,0x80b030
+  8045f3:	8b 47 30             	mov    0x30(%edi),%eax
+  8045f6:	a3 34 b0 80 00       	mov    %eax,0x80b034
+  8045fb:	8b 47 34             	mov    0x34(%edi),%eax
+  8045fe:	a3 38 b0 80 00       	mov    %eax,0x80b038
+  804603:	8b 47 38             	mov    0x38(%edi),%eax
+  804606:	a3 3c b0 80 00       	mov    %eax,0x80b03c
+  80460b:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80460e:	a3 40 b0 80 00       	mov    %eax,0x80b040
+	nsipcbuf.select.req_writeset = *writeset;
+  804613:	8b 06                	mov    (%esi),%eax
+  804615:	a3 44 b0 80 00       	mov    %eax,0x80b044
+  80461a:	8b 46 04             	mov    0x4(%esi),%eax
+  80461d:	a3 48 b0 80 00       	mov    %eax,0x80b048
+  804622:	8b 46 08             	mov    0x8(%esi),%eax
+  804625:	a3 4c b0 80 00       	mov    %eax,0x80b04c
+  80462a:	8b 46 0c             	mov    0xc(%esi),%eax
+  80462d:	a3 50 b0 80 00       	mov    %eax,0x80b050
+  804632:	8b 46 10             	mov    0x10(%esi),%eax
+  804635:	a3 54 b0 80 00       	mov    %eax,0x80b054
+  80463a:	8b 46 14             	mov    0x14(%esi),%eax
+  80463d:	a3 58 b0 80 00       	mov    %eax,0x80b058
+  804642:	8b 46 18             	mov    0x18(%esi),%eax
+  804645:	a3 5c b0 80 00       	mov    %eax,0x80b05c
+  80464a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80464d:	a3 60 b0 80 00       	mov    %eax,0x80b060
+  804652:	8b 46 20             	mov    0x20(%esi),%eax
+  804655:	a3 64 b0 80 00       	mov    %eax,0x80b064
+  80465a:	8b 46 24             	mov    0x24(%esi),%eax
+  80465d:	a3 68 b0 80 00       	mov    %eax,0x80b068
+  804662:	8b 46 28             	mov    0x28(%esi),%eax
+  804665:	a3 6c b0 80 00       	mov    %eax,0x80b06c
+  80466a:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80466d:	a3 70 b0 80 00       	mov    %eax,0x80b070
+  804672:	8b 46 30             	mov    0x30(%esi),%eax
+  804675:	a3 74 b0 80 00       	mov    %eax,0x80b074
+  80467a:	8b 46 34             	mov    0x34(%esi),%eax
+  80467d:	a3 78 b0 80 00       	mov    %eax,0x80b078
+  804682:	8b 46 38             	mov    0x38(%esi),%eax
+  804685:	a3 7c b0 80 00       	mov    %eax,0x80b07c
+  80468a:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80468d:	a3 80 b0 80 00       	mov    %eax,0x80b080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  804692:	8b 03                	mov    (%ebx),%eax
+  804694:	a3 84 b0 80 00       	mov    %eax,0x80b084
+  804699:	8b 43 04             	mov    0x4(%ebx),%eax
+  80469c:	a3 88 b0 80 00       	mov    %eax,0x80b088
+  8046a1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8046a4:	a3 8c b0 80 00       	mov    %eax,0x80b08c
+  8046a9:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8046ac:	a3 90 b0 80 00       	mov    %eax,0x80b090
+  8046b1:	8b 43 10             	mov    0x10(%ebx),%eax
+  8046b4:	a3 94 b0 80 00       	mov    %eax,0x80b094
+  8046b9:	8b 43 14             	mov    0x14(%ebx),%eax
+  8046bc:	a3 98 b0 80 00       	mov    %eax,0x80b098
+  8046c1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8046c4:	a3 9c b0 80 00       	mov    %eax,0x80b09c
+  8046c9:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8046cc:	a3 a0 b0 80 00       	mov    %eax,0x80b0a0
+  8046d1:	8b 43 20             	mov    0x20(%ebx),%eax
+  8046d4:	a3 a4 b0 80 00       	mov    %eax,0x80b0a4
+  8046d9:	8b 43 24             	mov    0x24(%ebx),%eax
+  8046dc:	a3 a8 b0 80 00       	mov    %eax,0x80b0a8
+  8046e1:	8b 43 28             	mov    0x28(%ebx),%eax
+  8046e4:	a3 ac b0 80 00       	mov    %eax,0x80b0ac
+  8046e9:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8046ec:	a3 b0 b0 80 00       	mov    %eax,0x80b0b0
+  8046f1:	8b 43 30             	mov    0x30(%ebx),%eax
+  8046f4:	a3 b4 b0 80 00       	mov    %eax,0x80b0b4
+  8046f9:	8b 43 34             	mov    0x34(%ebx),%eax
+  8046fc:	a3 b8 b0 80 00       	mov    %eax,0x80b0b8
+  804701:	8b 43 38             	mov    0x38(%ebx),%eax
+  804704:	a3 bc b0 80 00       	mov    %eax,0x80b0bc
+  804709:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80470c:	a3 c0 b0 80 00       	mov    %eax,0x80b0c0
+	nsipcbuf.select.req_timeout = msec;
+  804711:	8b 45 18             	mov    0x18(%ebp),%eax
+  804714:	a3 c4 b0 80 00       	mov    %eax,0x80b0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  804719:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80471e:	e8 2b f6 ff ff       	call   803d4e <nsipc>
+  804723:	85 c0                	test   %eax,%eax
+  804725:	0f 88 ad 01 00 00    	js     8048d8 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80472b:	8b 15 04 b0 80 00    	mov    0x80b004,%edx
+  804731:	89 17                	mov    %edx,(%edi)
+  804733:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  804739:	89 57 04             	mov    %edx,0x4(%edi)
+  80473c:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  804742:	89 57 08             	mov    %edx,0x8(%edi)
+  804745:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  80474b:	89 57 0c             	mov    %edx,0xc(%edi)
+  80474e:	8b 15 14 b0 80 00    	mov    0x80b014,%edx
+  804754:	89 57 10             	mov    %edx,0x10(%edi)
+  804757:	8b 15 18 b0 80 00    	mov    0x80b018,%edx
+  80475d:	89 57 14             	mov    %edx,0x14(%edi)
+  804760:	8b 15 1c b0 80 00    	mov    0x80b01c,%edx
+  804766:	89 57 18             	mov    %edx,0x18(%edi)
+  804769:	8b 15 20 b0 80 00    	mov    0x80b020,%edx
+  80476f:	89 57 1c             	mov    %edx,0x1c(%edi)
+  804772:	8b 15 24 b0 80 00    	mov    0x80b024,%edx
+  804778:	89 57 20             	mov    %edx,0x20(%edi)
+  80477b:	8b 15 28 b0 80 00    	mov    0x80b028,%edx
+  804781:	89 57 24             	mov    %edx,0x24(%edi)
+  804784:	8b 15 2c b0 80 00    	mov    0x80b02c,%edx
+  80478a:	89 57 28             	mov    %edx,0x28(%edi)
+  80478d:	8b 15 30 b0 80 00    	mov    0x80b030,%edx
+  804793:	89 57 2c             	mov    %edx,0x2c(%edi)
+  804796:	8b 15 34 b0 80 00    	mov    0x80b034,%edx
+  80479c:	89 57 30             	mov    %edx,0x30(%edi)
+  80479f:	8b 15 38 b0 80 00    	mov    0x80b038,%edx
+  8047a5:	89 57 34             	mov    %edx,0x34(%edi)
+  8047a8:	8b 15 3c b0 80 00    	mov    0x80b03c,%edx
+  8047ae:	89 57 38             	mov    %edx,0x38(%edi)
+  8047b1:	8b 15 40 b0 80 00    	mov    0x80b040,%edx
+  8047b7:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8047ba:	8b 15 44 b0 80 00    	mov    0x80b044,%edx
+  8047c0:	89 16                	mov    %edx,(%esi)
+  8047c2:	8b 15 48 b0 80 00    	mov    0x80b048,%edx
+  8047c8:	89 56 04             	mov    %edx,0x4(%esi)
+  8047cb:	8b 15 4c b0 80 00    	mov    0x80b04c,%edx
+  8047d1:	89 56 08             	mov    %edx,0x8(%esi)
+  8047d4:	8b 15 50 b0 80 00    	mov    0x80b050,%edx
+  8047da:	89 56 0c             	mov    %edx,0xc(%esi)
+  8047dd:	8b 15 54 b0 80 00    	mov    0x80b054,%edx
+  8047e3:	89 56 10             	mov    %edx,0x10(%esi)
+  8047e6:	8b 15 58 b0 80 00    	mov    0x80b058,%edx
+  8047ec:	89 56 14             	mov    %edx,0x14(%esi)
+  8047ef:	8b 15 5c b0 80 00    	mov    0x80b05c,%edx
+  8047f5:	89 56 18             	mov    %edx,0x18(%esi)
+  8047f8:	8b 15 60 b0 80 00    	mov    0x80b060,%edx
+  8047fe:	89 56 1c             	mov    %edx,0x1c(%esi)
+  804801:	8b 15 64 b0 80 00    	mov    0x80b064,%edx
+  804807:	89 56 20             	mov    %edx,0x20(%esi)
+  80480a:	8b 15 68 b0 80 00    	mov    0x80b068,%edx
+  804810:	89 56 24             	mov    %edx,0x24(%esi)
+  804813:	8b 15 6c b0 80 00    	mov    0x80b06c,%edx
+  804819:	89 56 28             	mov    %edx,0x28(%esi)
+  80481c:	8b 15 70 b0 80 00    	mov    0x80b070,%edx
+  804822:	89 56 2c             	mov    %edx,0x2c(%esi)
+  804825:	8b 15 74 b0 80 00    	mov    0x80b074,%edx
+  80482b:	89 56 30             	mov    %edx,0x30(%esi)
+  80482e:	8b 15 78 b0 80 00    	mov    0x80b078,%edx
+  804834:	89 56 34             	mov    %edx,0x34(%esi)
+  804837:	8b 15 7c b0 80 00    	mov    0x80b07c,%edx
+  80483d:	89 56 38             	mov    %edx,0x38(%esi)
+  804840:	8b 15 80 b0 80 00    	mov    0x80b080,%edx
+  804846:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  804849:	8b 15 84 b0 80 00    	mov    0x80b084,%edx
+  80484f:	89 13                	mov    %edx,(%ebx)
+  804851:	8b 15 88 b0 80 00    	mov    0x80b088,%edx
+  804857:	89 53 04             	mov    %edx,0x4(%ebx)
+  80485a:	8b 15 8c b0 80 00    	mov    0x80b08c,%edx
+  804860:	89 53 08             	mov    %edx,0x8(%ebx)
+  804863:	8b 15 90 b0 80 00    	mov    0x80b090,%edx
+  804869:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80486c:	8b 15 94 b0 80 00    	mov    0x80b094,%edx
+  804872:	89 53 10             	mov    %edx,0x10(%ebx)
+  804875:	8b 15 98 b0 80 00    	mov    0x80b098,%edx
+  80487b:	89 53 14             	mov    %edx,0x14(%ebx)
+  80487e:	8b 15 9c b0 80 00    	mov    0x80b09c,%edx
+  804884:	89 53 18             	mov    %edx,0x18(%ebx)
+  804887:	8b 15 a0 b0 80 00    	mov    0x80b0a0,%edx
+  80488d:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  804890:	8b 15 a4 b0 80 00    	mov    0x80b0a4,%edx
+  804896:	89 53 20             	mov    %edx,0x20(%ebx)
+  804899:	8b 15 a8 b0 80 00    	mov    0x80b0a8,%edx
+  80489f:	89 53 24             	mov    %edx,0x24(%ebx)
+  8048a2:	8b 15 ac b0 80 00    	mov    0x80b0ac,%edx
+  8048a8:	89 53 28             	mov    %edx,0x28(%ebx)
+  8048ab:	8b 15 b0 b0 80 00    	mov    0x80b0b0,%edx
+  8048b1:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8048b4:	8b 15 b4 b0 80 00    	mov    0x80b0b4,%edx
+  8048ba:	89 53 30             	mov    %edx,0x30(%ebx)
+  8048bd:	8b 15 b8 b0 80 00    	mov    0x80b0b8,%edx
+  8048c3:	89 53 34             	mov    %edx,0x34(%ebx)
+  8048c6:	8b 15 bc b0 80 00    	mov    0x80b0bc,%edx
+  8048cc:	89 53 38             	mov    %edx,0x38(%ebx)
+  8048cf:	8b 15 c0 b0 80 00    	mov    0x80b0c0,%edx
+  8048d5:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8048d8:	83 c4 0c             	add    $0xc,%esp
+  8048db:	5b                   	pop    %ebx
+  8048dc:	5e                   	pop    %esi
+  8048dd:	5f                   	pop    %edi
+  8048de:	5d                   	pop    %ebp
+  8048df:	c3                   	ret
+
+008048e0 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8048e0:	55                   	push   %ebp
+  8048e1:	89 e5                	mov    %esp,%ebp
+  8048e3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8048e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048e9:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.evctl.req_events = events;
+  8048ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8048f1:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.evctl.req_data = data;
+  8048f6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8048f9:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_EVCTL);
+  8048fe:	b8 0f 00 00 00       	mov    $0xf,%eax
+  804903:	e8 46 f4 ff ff       	call   803d4e <nsipc>
+}
+  804908:	c9                   	leave
+  804909:	c3                   	ret
+
+0080490a <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80490a:	55                   	push   %ebp
+  80490b:	89 e5                	mov    %esp,%ebp
+  80490d:	56                   	push   %esi
+  80490e:	53                   	push   %ebx
+  80490f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  804912:	89 35 00 b0 80 00    	mov    %esi,0x80b000
+	nsipcbuf.evwait.req_timeout = timeout;
+  804918:	8b 45 10             	mov    0x10(%ebp),%eax
+  80491b:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  804920:	b8 10 00 00 00       	mov    $0x10,%eax
+  804925:	e8 24 f4 ff ff       	call   803d4e <nsipc>
+  80492a:	89 c3                	mov    %eax,%ebx
+  80492c:	85 c0                	test   %eax,%eax
+  80492e:	7e 1f                	jle    80494f <nsipc_evwait+0x45>
+		assert(r <= max);
+  804930:	39 c6                	cmp    %eax,%esi
+  804932:	7c 24                	jl     804958 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  804934:	83 ec 04             	sub    $0x4,%esp
+  804937:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80493e:	50                   	push   %eax
+  80493f:	68 00 b0 80 00       	push   $0x80b000
+  804944:	ff 75 08             	push   0x8(%ebp)
+  804947:	e8 0b cd ff ff       	call   801657 <memmove>
+  80494c:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80494f:	89 d8                	mov    %ebx,%eax
+  804951:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804954:	5b                   	pop    %ebx
+  804955:	5e                   	pop    %esi
+  804956:	5d                   	pop    %ebp
+  804957:	c3                   	ret
+		assert(r <= max);
+  804958:	68 04 62 80 00       	push   $0x806204
+  80495d:	68 1f 5b 80 00       	push   $0x805b1f
+  804962:	68 6a 01 00 00       	push   $0x16a
+  804967:	68 ec 61 80 00       	push   $0x8061ec
+  80496c:	e8 74 c2 ff ff       	call   800be5 <_panic>
+
+00804971 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804971:	55                   	push   %ebp
+  804972:	89 e5                	mov    %esp,%ebp
+  804974:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  804977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80497a:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  80497f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804982:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  804987:	8b 45 10             	mov    0x10(%ebp),%eax
+  80498a:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  80498f:	b8 09 00 00 00       	mov    $0x9,%eax
+  804994:	e8 b5 f3 ff ff       	call   803d4e <nsipc>
+}
+  804999:	c9                   	leave
+  80499a:	c3                   	ret
+
+0080499b <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  80499b:	55                   	push   %ebp
+  80499c:	89 e5                	mov    %esp,%ebp
+  80499e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8049a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8049a4:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_OFFLOAD);
+  8049a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8049ae:	e8 9b f3 ff ff       	call   803d4e <nsipc>
+}
+  8049b3:	c9                   	leave
+  8049b4:	c3                   	ret
+
+008049b5 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8049b5:	55                   	push   %ebp
+  8049b6:	89 e5                	mov    %esp,%ebp
+  8049b8:	53                   	push   %ebx
+  8049b9:	83 ec 04             	sub    $0x4,%esp
+  8049bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8049bf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8049c4:	e8 85 f3 ff ff       	call   803d4e <nsipc>
+  8049c9:	85 c0                	test   %eax,%eax
+  8049cb:	78 50                	js     804a1d <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8049cd:	8b 15 00 b0 80 00    	mov    0x80b000,%edx
+  8049d3:	89 13                	mov    %edx,(%ebx)
+  8049d5:	8b 15 04 b0 80 00    	mov    0x80b004,%edx
+  8049db:	89 53 04             	mov    %edx,0x4(%ebx)
+  8049de:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  8049e4:	89 53 08             	mov    %edx,0x8(%ebx)
+  8049e7:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8049ed:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8049f0:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+  8049f6:	89 53 10             	mov    %edx,0x10(%ebx)
+  8049f9:	8b 15 14 b0 80 00    	mov    0x80b014,%edx
+  8049ff:	89 53 14             	mov    %edx,0x14(%ebx)
+  804a02:	8b 15 18 b0 80 00    	mov    0x80b018,%edx
+  804a08:	89 53 18             	mov    %edx,0x18(%ebx)
+  804a0b:	8b 15 1c b0 80 00    	mov    0x80b01c,%edx
+  804a11:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  804a14:	8b 15 20 b0 80 00    	mov    0x80b020,%edx
+  804a1a:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  804a1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804a20:	c9                   	leave
+  804a21:	c3                   	ret
+
+00804a22 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  804a22:	55                   	push   %ebp
+  804a23:	89 e5                	mov    %esp,%ebp
+  804a25:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  804a28:	6a 03                	push   $0x3
+  804a2a:	e8 31 0d 00 00       	call   805760 <ipc_find_env>
+  804a2f:	a3 44 94 80 00       	mov    %eax,0x809444
+	nsipcbuf.shard.req_shard = shard;
+  804a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a37:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  804a3c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  804a41:	e8 08 f3 ff ff       	call   803d4e <nsipc>
+  804a46:	83 c4 10             	add    $0x10,%esp
+  804a49:	85 c0                	test   %eax,%eax
+  804a4b:	78 0a                	js     804a57 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  804a4d:	a3 44 94 80 00       	mov    %eax,0x809444
+	return 0;
+  804a52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a57:	c9                   	leave
+  804a58:	c3                   	ret
+
+00804a59 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804a59:	55                   	push   %ebp
+  804a5a:	89 e5                	mov    %esp,%ebp
+  804a5c:	57                   	push   %edi
+  804a5d:	56                   	push   %esi
+  804a5e:	53                   	push   %ebx
+  804a5f:	83 ec 1c             	sub    $0x1c,%esp
+  804a62:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  804a65:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  804a68:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  804a6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804a72:	89 e0                	mov    %esp,%eax
+  804a74:	89 f2                	mov    %esi,%edx
+  804a76:	29 c2                	sub    %eax,%edx
+  804a78:	89 d0                	mov    %edx,%eax
+  804a7a:	c1 e8 0f             	shr    $0xf,%eax
+  804a7d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  804a83:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804a86:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  804a8d:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  804a90:	83 ec 0c             	sub    $0xc,%esp
+  804a93:	ff 75 e0             	push   -0x20(%ebp)
+  804a96:	e8 04 0d 00 00       	call   80579f <pageref>
+  804a9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804a9e:	83 c4 04             	add    $0x4,%esp
+  804aa1:	ff 75 dc             	push   -0x24(%ebp)
+  804aa4:	e8 f6 0c 00 00       	call   80579f <pageref>
+  804aa9:	89 e2                	mov    %esp,%edx
+  804aab:	89 f1                	mov    %esi,%ecx
+  804aad:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  804aaf:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  804ab2:	89 ca                	mov    %ecx,%edx
+  804ab4:	c1 ea 0f             	shr    $0xf,%edx
+  804ab7:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  804abd:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  804ac0:	8b 14 95 60 94 80 00 	mov    0x809460(,%edx,4),%edx
+  804ac7:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  804aca:	39 d7                	cmp    %edx,%edi
+  804acc:	74 40                	je     804b0e <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  804ace:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804ad1:	75 9f                	jne    804a72 <_pipeisclosed+0x19>
+  804ad3:	89 e2                	mov    %esp,%edx
+  804ad5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804ada:	29 d0                	sub    %edx,%eax
+  804adc:	89 c2                	mov    %eax,%edx
+  804ade:	c1 ea 0f             	shr    $0xf,%edx
+  804ae1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aeb:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804aee:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  804af5:	8b 40 58             	mov    0x58(%eax),%eax
+  804af8:	6a 01                	push   $0x1
+  804afa:	50                   	push   %eax
+  804afb:	57                   	push   %edi
+  804afc:	68 0d 62 80 00       	push   $0x80620d
+  804b01:	e8 ba c1 ff ff       	call   800cc0 <cprintf>
+  804b06:	83 c4 10             	add    $0x10,%esp
+  804b09:	e9 5f ff ff ff       	jmp    804a6d <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  804b0e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804b11:	0f 94 c0             	sete   %al
+  804b14:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  804b17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b1a:	5b                   	pop    %ebx
+  804b1b:	5e                   	pop    %esi
+  804b1c:	5f                   	pop    %edi
+  804b1d:	5d                   	pop    %ebp
+  804b1e:	c3                   	ret
+
+00804b1f <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  804b1f:	55                   	push   %ebp
+  804b20:	89 e5                	mov    %esp,%ebp
+  804b22:	53                   	push   %ebx
+  804b23:	83 ec 0c             	sub    $0xc,%esp
+  804b26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  804b29:	53                   	push   %ebx
+  804b2a:	6a 00                	push   $0x0
+  804b2c:	e8 2f ce ff ff       	call   801960 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  804b31:	89 1c 24             	mov    %ebx,(%esp)
+  804b34:	e8 e0 da ff ff       	call   802619 <fd2data>
+  804b39:	83 c4 08             	add    $0x8,%esp
+  804b3c:	50                   	push   %eax
+  804b3d:	6a 00                	push   $0x0
+  804b3f:	e8 1c ce ff ff       	call   801960 <sys_page_unmap>
+}
+  804b44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804b47:	c9                   	leave
+  804b48:	c3                   	ret
+
+00804b49 <devpipe_read>:
+{
+  804b49:	55                   	push   %ebp
+  804b4a:	89 e5                	mov    %esp,%ebp
+  804b4c:	57                   	push   %edi
+  804b4d:	56                   	push   %esi
+  804b4e:	53                   	push   %ebx
+  804b4f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  804b52:	ff 75 08             	push   0x8(%ebp)
+  804b55:	e8 bf da ff ff       	call   802619 <fd2data>
+  804b5a:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  804b5c:	8b 70 04             	mov    0x4(%eax),%esi
+  804b5f:	8b 00                	mov    (%eax),%eax
+  804b61:	83 c4 10             	add    $0x10,%esp
+  804b64:	39 f0                	cmp    %esi,%eax
+  804b66:	75 36                	jne    804b9e <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  804b68:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  804b6b:	89 da                	mov    %ebx,%edx
+  804b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b70:	e8 e4 fe ff ff       	call   804a59 <_pipeisclosed>
+  804b75:	85 c0                	test   %eax,%eax
+  804b77:	0f 85 d4 00 00 00    	jne    804c51 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  804b7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b82:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  804b86:	83 ec 04             	sub    $0x4,%esp
+  804b89:	6a ff                	push   $0xffffffff
+  804b8b:	56                   	push   %esi
+  804b8c:	57                   	push   %edi
+  804b8d:	e8 47 d1 ff ff       	call   801cd9 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  804b92:	8b 73 04             	mov    0x4(%ebx),%esi
+  804b95:	8b 03                	mov    (%ebx),%eax
+  804b97:	83 c4 10             	add    $0x10,%esp
+  804b9a:	39 c6                	cmp    %eax,%esi
+  804b9c:	74 cd                	je     804b6b <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804b9e:	8b 73 04             	mov    0x4(%ebx),%esi
+  804ba1:	8b 03                	mov    (%ebx),%eax
+  804ba3:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804ba9:	29 c6                	sub    %eax,%esi
+  804bab:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804bb0:	f7 e6                	mul    %esi
+  804bb2:	c1 ea 0c             	shr    $0xc,%edx
+  804bb5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804bbb:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  804bbd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804bc0:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  804bc4:	8b 0b                	mov    (%ebx),%ecx
+  804bc6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804bcb:	f7 e1                	mul    %ecx
+  804bcd:	c1 ea 0b             	shr    $0xb,%edx
+  804bd0:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  804bd6:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  804bd8:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  804bdd:	29 cf                	sub    %ecx,%edi
+  804bdf:	39 f7                	cmp    %esi,%edi
+  804be1:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  804be4:	83 ec 04             	sub    $0x4,%esp
+  804be7:	57                   	push   %edi
+  804be8:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  804bec:	50                   	push   %eax
+  804bed:	ff 75 0c             	push   0xc(%ebp)
+  804bf0:	e8 62 ca ff ff       	call   801657 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  804bf5:	83 c4 0c             	add    $0xc,%esp
+  804bf8:	89 f0                	mov    %esi,%eax
+  804bfa:	29 f8                	sub    %edi,%eax
+  804bfc:	50                   	push   %eax
+  804bfd:	8d 43 10             	lea    0x10(%ebx),%eax
+  804c00:	50                   	push   %eax
+  804c01:	89 f8                	mov    %edi,%eax
+  804c03:	03 45 0c             	add    0xc(%ebp),%eax
+  804c06:	50                   	push   %eax
+  804c07:	e8 4b ca ff ff       	call   801657 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  804c0c:	8b 0b                	mov    (%ebx),%ecx
+  804c0e:	01 f1                	add    %esi,%ecx
+  804c10:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804c15:	f7 e1                	mul    %ecx
+  804c17:	c1 ea 0c             	shr    $0xc,%edx
+  804c1a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  804c20:	29 c1                	sub    %eax,%ecx
+  804c22:	89 0b                	mov    %ecx,(%ebx)
+  804c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c29:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  804c2d:	83 c4 10             	add    $0x10,%esp
+  804c30:	85 c0                	test   %eax,%eax
+  804c32:	75 0a                	jne    804c3e <devpipe_read+0xf5>
+	return n;
+  804c34:	89 f0                	mov    %esi,%eax
+}
+  804c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c39:	5b                   	pop    %ebx
+  804c3a:	5e                   	pop    %esi
+  804c3b:	5f                   	pop    %edi
+  804c3c:	5d                   	pop    %ebp
+  804c3d:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  804c3e:	83 ec 08             	sub    $0x8,%esp
+  804c41:	68 00 04 00 00       	push   $0x400
+  804c46:	53                   	push   %ebx
+  804c47:	e8 af d0 ff ff       	call   801cfb <sys_futex_wake>
+  804c4c:	83 c4 10             	add    $0x10,%esp
+  804c4f:	eb e3                	jmp    804c34 <devpipe_read+0xeb>
+			return 0;
+  804c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c56:	eb de                	jmp    804c36 <devpipe_read+0xed>
+
+00804c58 <devpipe_write>:
+{
+  804c58:	55                   	push   %ebp
+  804c59:	89 e5                	mov    %esp,%ebp
+  804c5b:	57                   	push   %edi
+  804c5c:	56                   	push   %esi
+  804c5d:	53                   	push   %ebx
+  804c5e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  804c61:	ff 75 08             	push   0x8(%ebp)
+  804c64:	e8 b0 d9 ff ff       	call   802619 <fd2data>
+  804c69:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  804c6b:	83 c4 10             	add    $0x10,%esp
+  804c6e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804c75:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  804c7a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804c7e:	0f 84 43 01 00 00    	je     804dc7 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804c84:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804c87:	8b 06                	mov    (%esi),%eax
+  804c89:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804c8f:	29 c1                	sub    %eax,%ecx
+  804c91:	89 c8                	mov    %ecx,%eax
+  804c93:	f7 e7                	mul    %edi
+  804c95:	c1 ea 0c             	shr    $0xc,%edx
+  804c98:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804c9e:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  804ca0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804ca6:	75 52                	jne    804cfa <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  804ca8:	89 f2                	mov    %esi,%edx
+  804caa:	8b 45 08             	mov    0x8(%ebp),%eax
+  804cad:	e8 a7 fd ff ff       	call   804a59 <_pipeisclosed>
+  804cb2:	85 c0                	test   %eax,%eax
+  804cb4:	0f 85 28 01 00 00    	jne    804de2 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  804cba:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804cbc:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804cbf:	8b 06                	mov    (%esi),%eax
+  804cc1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804cc7:	29 c1                	sub    %eax,%ecx
+  804cc9:	89 c8                	mov    %ecx,%eax
+  804ccb:	f7 e7                	mul    %edi
+  804ccd:	c1 ea 0c             	shr    $0xc,%edx
+  804cd0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804cd6:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  804cd8:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804cde:	75 a4                	jne    804c84 <devpipe_write+0x2c>
+  804ce0:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ce5:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  804ce9:	83 ec 04             	sub    $0x4,%esp
+  804cec:	6a ff                	push   $0xffffffff
+  804cee:	53                   	push   %ebx
+  804cef:	56                   	push   %esi
+  804cf0:	e8 e4 cf ff ff       	call   801cd9 <sys_futex_wait>
+}
+  804cf5:	83 c4 10             	add    $0x10,%esp
+  804cf8:	eb 8a                	jmp    804c84 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804cfa:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804cfd:	8b 06                	mov    (%esi),%eax
+  804cff:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804d05:	29 c1                	sub    %eax,%ecx
+  804d07:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804d0c:	f7 e1                	mul    %ecx
+  804d0e:	c1 ea 0c             	shr    $0xc,%edx
+  804d11:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804d17:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  804d19:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  804d1e:	89 d8                	mov    %ebx,%eax
+  804d20:	29 c8                	sub    %ecx,%eax
+  804d22:	8b 55 10             	mov    0x10(%ebp),%edx
+  804d25:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804d28:	29 ca                	sub    %ecx,%edx
+  804d2a:	39 d0                	cmp    %edx,%eax
+  804d2c:	0f 46 d0             	cmovbe %eax,%edx
+  804d2f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  804d32:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804d35:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804d3a:	f7 e1                	mul    %ecx
+  804d3c:	c1 ea 0b             	shr    $0xb,%edx
+  804d3f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  804d45:	89 ca                	mov    %ecx,%edx
+  804d47:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  804d49:	29 d3                	sub    %edx,%ebx
+  804d4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804d4e:	39 c3                	cmp    %eax,%ebx
+  804d50:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  804d53:	83 ec 04             	sub    $0x4,%esp
+  804d56:	53                   	push   %ebx
+  804d57:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804d5a:	03 4d 0c             	add    0xc(%ebp),%ecx
+  804d5d:	51                   	push   %ecx
+  804d5e:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  804d62:	50                   	push   %eax
+  804d63:	e8 ef c8 ff ff       	call   801657 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  804d68:	83 c4 0c             	add    $0xc,%esp
+  804d6b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804d6e:	29 d8                	sub    %ebx,%eax
+  804d70:	50                   	push   %eax
+  804d71:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804d74:	01 cb                	add    %ecx,%ebx
+  804d76:	03 5d 0c             	add    0xc(%ebp),%ebx
+  804d79:	53                   	push   %ebx
+  804d7a:	8d 46 10             	lea    0x10(%esi),%eax
+  804d7d:	50                   	push   %eax
+  804d7e:	e8 d4 c8 ff ff       	call   801657 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  804d83:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804d86:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804d89:	01 c1                	add    %eax,%ecx
+  804d8b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804d90:	f7 e1                	mul    %ecx
+  804d92:	c1 ea 0c             	shr    $0xc,%edx
+  804d95:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  804d9b:	89 ca                	mov    %ecx,%edx
+  804d9d:	29 c2                	sub    %eax,%edx
+  804d9f:	89 56 04             	mov    %edx,0x4(%esi)
+  804da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da7:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  804dab:	83 c4 10             	add    $0x10,%esp
+  804dae:	85 c0                	test   %eax,%eax
+  804db0:	75 1a                	jne    804dcc <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  804db2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804db5:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  804db8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804dbb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804dbe:	0f 82 c0 fe ff ff    	jb     804c84 <devpipe_write+0x2c>
+  804dc4:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  804dc7:	8b 45 10             	mov    0x10(%ebp),%eax
+  804dca:	eb 1b                	jmp    804de7 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  804dcc:	83 ec 08             	sub    $0x8,%esp
+  804dcf:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  804dd4:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  804dd7:	50                   	push   %eax
+  804dd8:	e8 1e cf ff ff       	call   801cfb <sys_futex_wake>
+  804ddd:	83 c4 10             	add    $0x10,%esp
+  804de0:	eb d0                	jmp    804db2 <devpipe_write+0x15a>
+				return 0;
+  804de2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804de7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804dea:	5b                   	pop    %ebx
+  804deb:	5e                   	pop    %esi
+  804dec:	5f                   	pop    %edi
+  804ded:	5d                   	pop    %ebp
+  804dee:	c3                   	ret
+
+00804def <devpipe_stat>:
+{
+  804def:	55                   	push   %ebp
+  804df0:	89 e5                	mov    %esp,%ebp
+  804df2:	56                   	push   %esi
+  804df3:	53                   	push   %ebx
+  804df4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804df7:	83 ec 0c             	sub    $0xc,%esp
+  804dfa:	ff 75 08             	push   0x8(%ebp)
+  804dfd:	e8 17 d8 ff ff       	call   802619 <fd2data>
+  804e02:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  804e04:	83 c4 08             	add    $0x8,%esp
+  804e07:	68 20 62 80 00       	push   $0x806220
+  804e0c:	53                   	push   %ebx
+  804e0d:	e8 95 c6 ff ff       	call   8014a7 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804e12:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804e15:	8b 06                	mov    (%esi),%eax
+  804e17:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804e1d:	29 c1                	sub    %eax,%ecx
+  804e1f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804e24:	89 c8                	mov    %ecx,%eax
+  804e26:	f7 e2                	mul    %edx
+  804e28:	c1 ea 0c             	shr    $0xc,%edx
+  804e2b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804e31:	29 d1                	sub    %edx,%ecx
+  804e33:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  804e39:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804e40:	00 00 00 
+	stat->st_dev = &devpipe;
+  804e43:	c7 83 8c 00 00 00 a0 	movl   $0x8070a0,0x8c(%ebx)
+  804e4a:	70 80 00 
+}
+  804e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e55:	5b                   	pop    %ebx
+  804e56:	5e                   	pop    %esi
+  804e57:	5d                   	pop    %ebp
+  804e58:	c3                   	ret
+
+00804e59 <devpipe_poll>:
+{
+  804e59:	55                   	push   %ebp
+  804e5a:	89 e5                	mov    %esp,%ebp
+  804e5c:	57                   	push   %edi
+  804e5d:	56                   	push   %esi
+  804e5e:	53                   	push   %ebx
+  804e5f:	83 ec 18             	sub    $0x18,%esp
+  804e62:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804e65:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804e68:	57                   	push   %edi
+  804e69:	e8 ab d7 ff ff       	call   802619 <fd2data>
+  804e6e:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  804e70:	83 c4 10             	add    $0x10,%esp
+  804e73:	89 f3                	mov    %esi,%ebx
+  804e75:	83 e3 01             	and    $0x1,%ebx
+  804e78:	75 27                	jne    804ea1 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  804e7a:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  804e80:	75 48                	jne    804eca <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  804e82:	89 ca                	mov    %ecx,%edx
+  804e84:	89 f8                	mov    %edi,%eax
+  804e86:	e8 ce fb ff ff       	call   804a59 <_pipeisclosed>
+  804e8b:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  804e8d:	89 d8                	mov    %ebx,%eax
+  804e8f:	83 c8 10             	or     $0x10,%eax
+  804e92:	85 d2                	test   %edx,%edx
+  804e94:	0f 45 d8             	cmovne %eax,%ebx
+}
+  804e97:	89 d8                	mov    %ebx,%eax
+  804e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e9c:	5b                   	pop    %ebx
+  804e9d:	5e                   	pop    %esi
+  804e9e:	5f                   	pop    %edi
+  804e9f:	5d                   	pop    %ebp
+  804ea0:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804ea1:	8b 58 04             	mov    0x4(%eax),%ebx
+  804ea4:	8b 00                	mov    (%eax),%eax
+  804ea6:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  804eac:	29 c3                	sub    %eax,%ebx
+  804eae:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804eb3:	89 d8                	mov    %ebx,%eax
+  804eb5:	f7 e2                	mul    %edx
+  804eb7:	c1 ea 0c             	shr    $0xc,%edx
+  804eba:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  804ec0:	39 d3                	cmp    %edx,%ebx
+  804ec2:	0f 95 c3             	setne  %bl
+  804ec5:	0f b6 db             	movzbl %bl,%ebx
+  804ec8:	eb b0                	jmp    804e7a <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804eca:	8b 71 04             	mov    0x4(%ecx),%esi
+  804ecd:	8b 01                	mov    (%ecx),%eax
+  804ecf:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804ed5:	29 c6                	sub    %eax,%esi
+  804ed7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804edc:	89 f0                	mov    %esi,%eax
+  804ede:	f7 e2                	mul    %edx
+  804ee0:	c1 ea 0c             	shr    $0xc,%edx
+  804ee3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804ee9:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  804eeb:	89 d8                	mov    %ebx,%eax
+  804eed:	83 c8 04             	or     $0x4,%eax
+  804ef0:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  804ef6:	0f 42 d8             	cmovb  %eax,%ebx
+  804ef9:	eb 87                	jmp    804e82 <devpipe_poll+0x29>
+
+00804efb <pipe>:
+{
+  804efb:	55                   	push   %ebp
+  804efc:	89 e5                	mov    %esp,%ebp
+  804efe:	56                   	push   %esi
+  804eff:	53                   	push   %ebx
+  804f00:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804f03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804f06:	50                   	push   %eax
+  804f07:	e8 24 d7 ff ff       	call   802630 <fd_alloc>
+  804f0c:	89 c3                	mov    %eax,%ebx
+  804f0e:	83 c4 10             	add    $0x10,%esp
+  804f11:	85 c0                	test   %eax,%eax
+  804f13:	0f 88 23 01 00 00    	js     80503c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f19:	83 ec 04             	sub    $0x4,%esp
+  804f1c:	68 07 04 00 00       	push   $0x407
+  804f21:	ff 75 f4             	push   -0xc(%ebp)
+  804f24:	6a 00                	push   $0x0
+  804f26:	e8 b0 c9 ff ff       	call   8018db <sys_page_alloc>
+  804f2b:	89 c3                	mov    %eax,%ebx
+  804f2d:	83 c4 10             	add    $0x10,%esp
+  804f30:	85 c0                	test   %eax,%eax
+  804f32:	0f 88 04 01 00 00    	js     80503c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  804f38:	83 ec 0c             	sub    $0xc,%esp
+  804f3b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804f3e:	50                   	push   %eax
+  804f3f:	e8 ec d6 ff ff       	call   802630 <fd_alloc>
+  804f44:	89 c3                	mov    %eax,%ebx
+  804f46:	83 c4 10             	add    $0x10,%esp
+  804f49:	85 c0                	test   %eax,%eax
+  804f4b:	0f 88 db 00 00 00    	js     80502c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f51:	83 ec 04             	sub    $0x4,%esp
+  804f54:	68 07 04 00 00       	push   $0x407
+  804f59:	ff 75 f0             	push   -0x10(%ebp)
+  804f5c:	6a 00                	push   $0x0
+  804f5e:	e8 78 c9 ff ff       	call   8018db <sys_page_alloc>
+  804f63:	89 c3                	mov    %eax,%ebx
+  804f65:	83 c4 10             	add    $0x10,%esp
+  804f68:	85 c0                	test   %eax,%eax
+  804f6a:	0f 88 bc 00 00 00    	js     80502c <pipe+0x131>
+	va = fd2data(fd0);
+  804f70:	83 ec 0c             	sub    $0xc,%esp
+  804f73:	ff 75 f4             	push   -0xc(%ebp)
+  804f76:	e8 9e d6 ff ff       	call   802619 <fd2data>
+  804f7b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f7d:	83 c4 0c             	add    $0xc,%esp
+  804f80:	68 07 04 00 00       	push   $0x407
+  804f85:	50                   	push   %eax
+  804f86:	6a 00                	push   $0x0
+  804f88:	e8 4e c9 ff ff       	call   8018db <sys_page_alloc>
+  804f8d:	89 c3                	mov    %eax,%ebx
+  804f8f:	83 c4 10             	add    $0x10,%esp
+  804f92:	85 c0                	test   %eax,%eax
+  804f94:	0f 88 82 00 00 00    	js     80501c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f9a:	83 ec 0c             	sub    $0xc,%esp
+  804f9d:	ff 75 f0             	push   -0x10(%ebp)
+  804fa0:	e8 74 d6 ff ff       	call   802619 <fd2data>
+  804fa5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  804fac:	50                   	push   %eax
+  804fad:	6a 00                	push   $0x0
+  804faf:	56                   	push   %esi
+  804fb0:	6a 00                	push   $0x0
+  804fb2:	e8 67 c9 ff ff       	call   80191e <sys_page_map>
+  804fb7:	89 c3                	mov    %eax,%ebx
+  804fb9:	83 c4 20             	add    $0x20,%esp
+  804fbc:	85 c0                	test   %eax,%eax
+  804fbe:	78 4e                	js     80500e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  804fc0:	a1 a0 70 80 00       	mov    0x8070a0,%eax
+  804fc5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804fc8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804fca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804fcd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804fd4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804fd7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804fd9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804fdc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804fe3:	83 ec 0c             	sub    $0xc,%esp
+  804fe6:	ff 75 f4             	push   -0xc(%ebp)
+  804fe9:	e8 1b d6 ff ff       	call   802609 <fd2num>
+  804fee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804ff1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804ff3:	83 c4 04             	add    $0x4,%esp
+  804ff6:	ff 75 f0             	push   -0x10(%ebp)
+  804ff9:	e8 0b d6 ff ff       	call   802609 <fd2num>
+  804ffe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  805001:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  805004:	83 c4 10             	add    $0x10,%esp
+  805007:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80500c:	eb 2e                	jmp    80503c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80500e:	83 ec 08             	sub    $0x8,%esp
+  805011:	56                   	push   %esi
+  805012:	6a 00                	push   $0x0
+  805014:	e8 47 c9 ff ff       	call   801960 <sys_page_unmap>
+  805019:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80501c:	83 ec 08             	sub    $0x8,%esp
+  80501f:	ff 75 f0             	push   -0x10(%ebp)
+  805022:	6a 00                	push   $0x0
+  805024:	e8 37 c9 ff ff       	call   801960 <sys_page_unmap>
+  805029:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80502c:	83 ec 08             	sub    $0x8,%esp
+  80502f:	ff 75 f4             	push   -0xc(%ebp)
+  805032:	6a 00                	push   $0x0
+  805034:	e8 27 c9 ff ff       	call   801960 <sys_page_unmap>
+  805039:	83 c4 10             	add    $0x10,%esp
+}
+  80503c:	89 d8                	mov    %ebx,%eax
+  80503e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805041:	5b                   	pop    %ebx
+  805042:	5e                   	pop    %esi
+  805043:	5d                   	pop    %ebp
+  805044:	c3                   	ret
+
+00805045 <pipeisclosed>:
+{
+  805045:	55                   	push   %ebp
+  805046:	89 e5                	mov    %esp,%ebp
+  805048:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80504b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80504e:	50                   	push   %eax
+  80504f:	ff 75 08             	push   0x8(%ebp)
+  805052:	e8 29 d6 ff ff       	call   802680 <fd_lookup>
+  805057:	83 c4 10             	add    $0x10,%esp
+  80505a:	85 c0                	test   %eax,%eax
+  80505c:	78 18                	js     805076 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80505e:	83 ec 0c             	sub    $0xc,%esp
+  805061:	ff 75 f4             	push   -0xc(%ebp)
+  805064:	e8 b0 d5 ff ff       	call   802619 <fd2data>
+  805069:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80506b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80506e:	e8 e6 f9 ff ff       	call   804a59 <_pipeisclosed>
+  805073:	83 c4 10             	add    $0x10,%esp
+}
+  805076:	c9                   	leave
+  805077:	c3                   	ret
+
+00805078 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  805078:	55                   	push   %ebp
+  805079:	89 e5                	mov    %esp,%ebp
+  80507b:	56                   	push   %esi
+  80507c:	53                   	push   %ebx
+  80507d:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  805080:	85 f6                	test   %esi,%esi
+  805082:	74 40                	je     8050c4 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  805084:	89 f3                	mov    %esi,%ebx
+  805086:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80508c:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  805092:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805097:	8b 40 48             	mov    0x48(%eax),%eax
+  80509a:	39 c6                	cmp    %eax,%esi
+  80509c:	75 1f                	jne    8050bd <wait+0x45>
+  80509e:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  8050a4:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8050aa:	8b 43 54             	mov    0x54(%ebx),%eax
+  8050ad:	85 c0                	test   %eax,%eax
+  8050af:	74 0c                	je     8050bd <wait+0x45>
+		sys_yield();
+  8050b1:	e8 06 c8 ff ff       	call   8018bc <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8050b6:	8b 43 48             	mov    0x48(%ebx),%eax
+  8050b9:	39 f0                	cmp    %esi,%eax
+  8050bb:	74 ed                	je     8050aa <wait+0x32>
+}
+  8050bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8050c0:	5b                   	pop    %ebx
+  8050c1:	5e                   	pop    %esi
+  8050c2:	5d                   	pop    %ebp
+  8050c3:	c3                   	ret
+	assert(envid != 0);
+  8050c4:	68 2c 62 80 00       	push   $0x80622c
+  8050c9:	68 1f 5b 80 00       	push   $0x805b1f
+  8050ce:	6a 09                	push   $0x9
+  8050d0:	68 37 62 80 00       	push   $0x806237
+  8050d5:	e8 0b bb ff ff       	call   800be5 <_panic>
+
+008050da <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8050da:	55                   	push   %ebp
+  8050db:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8050dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8050e0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8050e6:	5d                   	pop    %ebp
+  8050e7:	c3                   	ret
+
+008050e8 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8050e8:	55                   	push   %ebp
+  8050e9:	89 e5                	mov    %esp,%ebp
+  8050eb:	53                   	push   %ebx
+  8050ec:	83 ec 04             	sub    $0x4,%esp
+  8050ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8050f2:	8b 03                	mov    (%ebx),%eax
+  8050f4:	85 c0                	test   %eax,%eax
+  8050f6:	75 05                	jne    8050fd <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8050f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8050fb:	c9                   	leave
+  8050fc:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8050fd:	83 ec 08             	sub    $0x8,%esp
+  805100:	50                   	push   %eax
+  805101:	8d 43 04             	lea    0x4(%ebx),%eax
+  805104:	50                   	push   %eax
+  805105:	e8 a6 ca ff ff       	call   801bb0 <sys_page_batch>
+	pb->pb_n = 0;
+  80510a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  805110:	83 c4 10             	add    $0x10,%esp
+  805113:	eb e3                	jmp    8050f8 <pgbatch_flush+0x10>
+
+00805115 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  805115:	55                   	push   %ebp
+  805116:	89 e5                	mov    %esp,%ebp
+  805118:	56                   	push   %esi
+  805119:	53                   	push   %ebx
+  80511a:	89 c3                	mov    %eax,%ebx
+  80511c:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80511e:	83 38 20             	cmpl   $0x20,(%eax)
+  805121:	74 2c                	je     80514f <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  805123:	8b 03                	mov    (%ebx),%eax
+  805125:	8d 50 01             	lea    0x1(%eax),%edx
+  805128:	89 13                	mov    %edx,(%ebx)
+  80512a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80512d:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  805131:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  805133:	83 ec 04             	sub    $0x4,%esp
+  805136:	6a 18                	push   $0x18
+  805138:	6a 00                	push   $0x0
+  80513a:	50                   	push   %eax
+  80513b:	e8 e2 c4 ff ff       	call   801622 <memset>
+	return 0;
+  805140:	83 c4 10             	add    $0x10,%esp
+  805143:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80514b:	5b                   	pop    %ebx
+  80514c:	5e                   	pop    %esi
+  80514d:	5d                   	pop    %ebp
+  80514e:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80514f:	83 ec 0c             	sub    $0xc,%esp
+  805152:	50                   	push   %eax
+  805153:	e8 90 ff ff ff       	call   8050e8 <pgbatch_flush>
+  805158:	83 c4 10             	add    $0x10,%esp
+  80515b:	85 c0                	test   %eax,%eax
+  80515d:	79 c4                	jns    805123 <pgbatch_slot+0xe>
+  80515f:	eb e7                	jmp    805148 <pgbatch_slot+0x33>
+
+00805161 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  805161:	55                   	push   %ebp
+  805162:	89 e5                	mov    %esp,%ebp
+  805164:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805167:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80516a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80516d:	e8 a3 ff ff ff       	call   805115 <pgbatch_slot>
+  805172:	85 c0                	test   %eax,%eax
+  805174:	78 20                	js     805196 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  805176:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805179:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80517f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805182:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  805185:	8b 55 10             	mov    0x10(%ebp),%edx
+  805188:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80518b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80518e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805191:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805196:	c9                   	leave
+  805197:	c3                   	ret
+
+00805198 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  805198:	55                   	push   %ebp
+  805199:	89 e5                	mov    %esp,%ebp
+  80519b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80519e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8051a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8051a4:	e8 6c ff ff ff       	call   805115 <pgbatch_slot>
+  8051a9:	85 c0                	test   %eax,%eax
+  8051ab:	78 2c                	js     8051d9 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8051ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8051b0:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8051b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8051b9:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8051bc:	8b 55 10             	mov    0x10(%ebp),%edx
+  8051bf:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8051c2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8051c5:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8051c8:	8b 55 18             	mov    0x18(%ebp),%edx
+  8051cb:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8051ce:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8051d1:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8051d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051d9:	c9                   	leave
+  8051da:	c3                   	ret
+
+008051db <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  8051db:	55                   	push   %ebp
+  8051dc:	89 e5                	mov    %esp,%ebp
+  8051de:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8051e1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8051e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8051e7:	e8 29 ff ff ff       	call   805115 <pgbatch_slot>
+  8051ec:	85 c0                	test   %eax,%eax
+  8051ee:	78 1a                	js     80520a <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8051f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8051f3:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8051f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8051fc:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8051ff:	8b 55 10             	mov    0x10(%ebp),%edx
+  805202:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  805205:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80520a:	c9                   	leave
+  80520b:	c3                   	ret
+
+0080520c <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80520c:	55                   	push   %ebp
+  80520d:	89 e5                	mov    %esp,%ebp
+  80520f:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805212:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  805215:	8b 45 08             	mov    0x8(%ebp),%eax
+  805218:	e8 f8 fe ff ff       	call   805115 <pgbatch_slot>
+  80521d:	85 c0                	test   %eax,%eax
+  80521f:	78 20                	js     805241 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  805221:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805224:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80522a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80522d:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  805230:	8b 55 10             	mov    0x10(%ebp),%edx
+  805233:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  805236:	8b 55 14             	mov    0x14(%ebp),%edx
+  805239:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80523c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805241:	c9                   	leave
+  805242:	c3                   	ret
+
+00805243 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  805243:	55                   	push   %ebp
+  805244:	89 e5                	mov    %esp,%ebp
+  805246:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  805249:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80524c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80524f:	e8 c1 fe ff ff       	call   805115 <pgbatch_slot>
+  805254:	85 c0                	test   %eax,%eax
+  805256:	78 26                	js     80527e <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  805258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80525b:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  805261:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805264:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  805267:	8b 55 10             	mov    0x10(%ebp),%edx
+  80526a:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80526d:	8b 55 14             	mov    0x14(%ebp),%edx
+  805270:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  805273:	8b 55 18             	mov    0x18(%ebp),%edx
+  805276:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  805279:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80527e:	c9                   	leave
+  80527f:	c3                   	ret
+
+00805280 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  805280:	55                   	push   %ebp
+  805281:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  805283:	8b 45 08             	mov    0x8(%ebp),%eax
+  805286:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80528c:	5d                   	pop    %ebp
+  80528d:	c3                   	ret
+
+0080528e <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  80528e:	55                   	push   %ebp
+  80528f:	89 e5                	mov    %esp,%ebp
+  805291:	56                   	push   %esi
+  805292:	53                   	push   %ebx
+  805293:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  805296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80529b:	ba 01 00 00 00       	mov    $0x1,%edx
+  8052a0:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8052a4:	85 c0                	test   %eax,%eax
+  8052a6:	74 2f                	je     8052d7 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  8052a8:	83 f8 02             	cmp    $0x2,%eax
+  8052ab:	74 0c                	je     8052b9 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  8052ad:	b8 02 00 00 00       	mov    $0x2,%eax
+  8052b2:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  8052b5:	85 c0                	test   %eax,%eax
+  8052b7:	74 1e                	je     8052d7 <mutex_lock+0x49>
+  8052b9:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  8052be:	83 ec 04             	sub    $0x4,%esp
+  8052c1:	6a ff                	push   $0xffffffff
+  8052c3:	6a 02                	push   $0x2
+  8052c5:	53                   	push   %ebx
+  8052c6:	e8 0e ca ff ff       	call   801cd9 <sys_futex_wait>
+  8052cb:	89 f0                	mov    %esi,%eax
+  8052cd:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  8052d0:	83 c4 10             	add    $0x10,%esp
+  8052d3:	85 c0                	test   %eax,%eax
+  8052d5:	75 e7                	jne    8052be <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8052d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8052da:	5b                   	pop    %ebx
+  8052db:	5e                   	pop    %esi
+  8052dc:	5d                   	pop    %ebp
+  8052dd:	c3                   	ret
+
+008052de <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  8052de:	55                   	push   %ebp
+  8052df:	89 e5                	mov    %esp,%ebp
+  8052e1:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  8052e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8052ee:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  8052f2:	85 c0                	test   %eax,%eax
+  8052f4:	0f 94 c0             	sete   %al
+  8052f7:	0f b6 c0             	movzbl %al,%eax
+}
+  8052fa:	5d                   	pop    %ebp
+  8052fb:	c3                   	ret
+
+008052fc <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8052fc:	55                   	push   %ebp
+  8052fd:	89 e5                	mov    %esp,%ebp
+  8052ff:	83 ec 08             	sub    $0x8,%esp
+  805302:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  805305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80530a:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80530d:	83 f8 02             	cmp    $0x2,%eax
+  805310:	74 02                	je     805314 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  805312:	c9                   	leave
+  805313:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  805314:	83 ec 08             	sub    $0x8,%esp
+  805317:	6a 01                	push   $0x1
+  805319:	52                   	push   %edx
+  80531a:	e8 dc c9 ff ff       	call   801cfb <sys_futex_wake>
+  80531f:	83 c4 10             	add    $0x10,%esp
+}
+  805322:	eb ee                	jmp    805312 <mutex_unlock+0x16>
+
+00805324 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  805324:	55                   	push   %ebp
+  805325:	89 e5                	mov    %esp,%ebp
+  805327:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  80532a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  805330:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  805337:	5d                   	pop    %ebp
+  805338:	c3                   	ret
+
+00805339 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  805339:	55                   	push   %ebp
+  80533a:	89 e5                	mov    %esp,%ebp
+  80533c:	57                   	push   %edi
+  80533d:	56                   	push   %esi
+  80533e:	53                   	push   %ebx
+  80533f:	83 ec 18             	sub    $0x18,%esp
+  805342:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  805345:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  805348:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  80534a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80534f:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  805354:	57                   	push   %edi
+  805355:	e8 a2 ff ff ff       	call   8052fc <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80535a:	83 c4 0c             	add    $0xc,%esp
+  80535d:	ff 75 10             	push   0x10(%ebp)
+  805360:	56                   	push   %esi
+  805361:	53                   	push   %ebx
+  805362:	e8 72 c9 ff ff       	call   801cd9 <sys_futex_wait>
+  805367:	89 c6                	mov    %eax,%esi
+  805369:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80536e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  805373:	89 3c 24             	mov    %edi,(%esp)
+  805376:	e8 13 ff ff ff       	call   80528e <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  80537b:	83 c4 10             	add    $0x10,%esp
+  80537e:	83 fe ef             	cmp    $0xffffffef,%esi
+  805381:	74 05                	je     805388 <cond_timedwait+0x4f>
+  805383:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  805388:	89 f0                	mov    %esi,%eax
+  80538a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80538d:	5b                   	pop    %ebx
+  80538e:	5e                   	pop    %esi
+  80538f:	5f                   	pop    %edi
+  805390:	5d                   	pop    %ebp
+  805391:	c3                   	ret
+
+00805392 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  805392:	55                   	push   %ebp
+  805393:	89 e5                	mov    %esp,%ebp
+  805395:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  805398:	6a ff                	push   $0xffffffff
+  80539a:	ff 75 0c             	push   0xc(%ebp)
+  80539d:	ff 75 08             	push   0x8(%ebp)
+  8053a0:	e8 94 ff ff ff       	call   805339 <cond_timedwait>
+}
+  8053a5:	83 c4 10             	add    $0x10,%esp
+  8053a8:	c9                   	leave
+  8053a9:	c3                   	ret
+
+008053aa <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8053aa:	55                   	push   %ebp
+  8053ab:	89 e5                	mov    %esp,%ebp
+  8053ad:	83 ec 08             	sub    $0x8,%esp
+  8053b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8053b3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8053b8:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8053bc:	8b 50 04             	mov    0x4(%eax),%edx
+  8053bf:	85 d2                	test   %edx,%edx
+  8053c1:	75 02                	jne    8053c5 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  8053c3:	c9                   	leave
+  8053c4:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  8053c5:	83 ec 08             	sub    $0x8,%esp
+  8053c8:	6a 01                	push   $0x1
+  8053ca:	50                   	push   %eax
+  8053cb:	e8 2b c9 ff ff       	call   801cfb <sys_futex_wake>
+  8053d0:	83 c4 10             	add    $0x10,%esp
+}
+  8053d3:	eb ee                	jmp    8053c3 <cond_signal+0x19>
+
+008053d5 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8053d5:	55                   	push   %ebp
+  8053d6:	89 e5                	mov    %esp,%ebp
+  8053d8:	83 ec 08             	sub    $0x8,%esp
+  8053db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8053de:	ba 01 00 00 00       	mov    $0x1,%edx
+  8053e3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8053e7:	8b 50 04             	mov    0x4(%eax),%edx
+  8053ea:	85 d2                	test   %edx,%edx
+  8053ec:	75 02                	jne    8053f0 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  8053ee:	c9                   	leave
+  8053ef:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  8053f0:	83 ec 08             	sub    $0x8,%esp
+  8053f3:	68 00 04 00 00       	push   $0x400
+  8053f8:	50                   	push   %eax
+  8053f9:	e8 fd c8 ff ff       	call   801cfb <sys_futex_wake>
+  8053fe:	83 c4 10             	add    $0x10,%esp
+}
+  805401:	eb eb                	jmp    8053ee <cond_broadcast+0x19>
+
+00805403 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  805403:	55                   	push   %ebp
+  805404:	89 e5                	mov    %esp,%ebp
+  805406:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  805409:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  805410:	74 0a                	je     80541c <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  805412:	8b 45 08             	mov    0x8(%ebp),%eax
+  805415:	a3 00 c0 80 00       	mov    %eax,0x80c000
+}
+  80541a:	c9                   	leave
+  80541b:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  80541c:	83 ec 04             	sub    $0x4,%esp
+  80541f:	6a 07                	push   $0x7
+  805421:	68 00 f0 bf ee       	push   $0xeebff000
+  805426:	6a 00                	push   $0x0
+  805428:	e8 ae c4 ff ff       	call   8018db <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80542d:	83 c4 08             	add    $0x8,%esp
+  805430:	68 41 54 80 00       	push   $0x805441
+  805435:	6a 00                	push   $0x0
+  805437:	e8 ea c5 ff ff       	call   801a26 <sys_env_set_pgfault_upcall>
+  80543c:	83 c4 10             	add    $0x10,%esp
+  80543f:	eb d1                	jmp    805412 <set_pgfault_handler+0xf>
+
+00805441 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805441:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805442:	a1 00 c0 80 00       	mov    0x80c000,%eax
+	call *%eax
+  805447:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805449:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  80544c:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  805450:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  805453:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  805457:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  805459:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80545d:	83 c4 08             	add    $0x8,%esp
+	popal;
+  805460:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  805461:	83 c4 04             	add    $0x4,%esp
+	popf
+  805464:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  805465:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  805466:	c3                   	ret
+
+00805467 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805467:	55                   	push   %ebp
+  805468:	89 e5                	mov    %esp,%ebp
+  80546a:	56                   	push   %esi
+  80546b:	53                   	push   %ebx
+  80546c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80546f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805472:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  805475:	85 c0                	test   %eax,%eax
+  805477:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80547c:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80547f:	83 ec 0c             	sub    $0xc,%esp
+  805482:	50                   	push   %eax
+  805483:	e8 03 c6 ff ff       	call   801a8b <sys_ipc_recv>
+  805488:	83 c4 10             	add    $0x10,%esp
+  80548b:	85 c0                	test   %eax,%eax
+  80548d:	0f 88 8b 00 00 00    	js     80551e <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  805493:	85 f6                	test   %esi,%esi
+  805495:	74 2a                	je     8054c1 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  805497:	89 e2                	mov    %esp,%edx
+  805499:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80549e:	29 d0                	sub    %edx,%eax
+  8054a0:	89 c2                	mov    %eax,%edx
+  8054a2:	c1 ea 0f             	shr    $0xf,%edx
+  8054a5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8054aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054af:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8054b2:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  8054b9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8054bf:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8054c1:	85 db                	test   %ebx,%ebx
+  8054c3:	74 2a                	je     8054ef <ipc_recv+0x88>
+  8054c5:	89 e2                	mov    %esp,%edx
+  8054c7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8054cc:	29 d0                	sub    %edx,%eax
+  8054ce:	89 c2                	mov    %eax,%edx
+  8054d0:	c1 ea 0f             	shr    $0xf,%edx
+  8054d3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8054d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054dd:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8054e0:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  8054e7:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8054ed:	89 03                	mov    %eax,(%ebx)
+  8054ef:	89 e2                	mov    %esp,%edx
+  8054f1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8054f6:	29 d0                	sub    %edx,%eax
+  8054f8:	89 c2                	mov    %eax,%edx
+  8054fa:	c1 ea 0f             	shr    $0xf,%edx
+  8054fd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  805502:	b8 00 00 00 00       	mov    $0x0,%eax
+  805507:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80550a:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  805511:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  805517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80551a:	5b                   	pop    %ebx
+  80551b:	5e                   	pop    %esi
+  80551c:	5d                   	pop    %ebp
+  80551d:	c3                   	ret
+		if(from_env_store != NULL)
+  80551e:	85 f6                	test   %esi,%esi
+  805520:	74 06                	je     805528 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  805522:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  805528:	85 db                	test   %ebx,%ebx
+  80552a:	74 eb                	je     805517 <ipc_recv+0xb0>
+			*perm_store = 0;
+  80552c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805532:	eb e3                	jmp    805517 <ipc_recv+0xb0>
+
+00805534 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  805534:	55                   	push   %ebp
+  805535:	89 e5                	mov    %esp,%ebp
+  805537:	57                   	push   %edi
+  805538:	56                   	push   %esi
+  805539:	53                   	push   %ebx
+  80553a:	83 ec 14             	sub    $0x14,%esp
+  80553d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805540:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805543:	8b 75 14             	mov    0x14(%ebp),%esi
+  805546:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  805549:	85 c0                	test   %eax,%eax
+  80554b:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  805550:	0f 44 c2             	cmove  %edx,%eax
+  805553:	ff 75 10             	push   0x10(%ebp)
+  805556:	50                   	push   %eax
+  805557:	e8 91 c5 ff ff       	call   801aed <sys_ipc_recv_pages>
+  80555c:	83 c4 10             	add    $0x10,%esp
+  80555f:	85 c0                	test   %eax,%eax
+  805561:	0f 88 ba 00 00 00    	js     805621 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  805567:	85 ff                	test   %edi,%edi
+  805569:	74 2a                	je     805595 <ipc_recv_pages+0x61>
+  80556b:	89 e2                	mov    %esp,%edx
+  80556d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  805572:	29 d0                	sub    %edx,%eax
+  805574:	89 c2                	mov    %eax,%edx
+  805576:	c1 ea 0f             	shr    $0xf,%edx
+  805579:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80557e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805583:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  805586:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  80558d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805593:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  805595:	85 f6                	test   %esi,%esi
+  805597:	74 2a                	je     8055c3 <ipc_recv_pages+0x8f>
+  805599:	89 e2                	mov    %esp,%edx
+  80559b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8055a0:	29 d0                	sub    %edx,%eax
+  8055a2:	89 c2                	mov    %eax,%edx
+  8055a4:	c1 ea 0f             	shr    $0xf,%edx
+  8055a7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8055ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055b1:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8055b4:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  8055bb:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8055c1:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8055c3:	85 db                	test   %ebx,%ebx
+  8055c5:	74 2a                	je     8055f1 <ipc_recv_pages+0xbd>
+  8055c7:	89 e2                	mov    %esp,%edx
+  8055c9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8055ce:	29 d0                	sub    %edx,%eax
+  8055d0:	89 c2                	mov    %eax,%edx
+  8055d2:	c1 ea 0f             	shr    $0xf,%edx
+  8055d5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8055da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055df:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8055e2:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  8055e9:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8055ef:	89 03                	mov    %eax,(%ebx)
+  8055f1:	89 e2                	mov    %esp,%edx
+  8055f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8055f8:	29 d0                	sub    %edx,%eax
+  8055fa:	89 c2                	mov    %eax,%edx
+  8055fc:	c1 ea 0f             	shr    $0xf,%edx
+  8055ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  805604:	b8 00 00 00 00       	mov    $0x0,%eax
+  805609:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80560c:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  805613:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  805619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80561c:	5b                   	pop    %ebx
+  80561d:	5e                   	pop    %esi
+  80561e:	5f                   	pop    %edi
+  80561f:	5d                   	pop    %ebp
+  805620:	c3                   	ret
+		if (from_env_store)
+  805621:	85 ff                	test   %edi,%edi
+  805623:	74 06                	je     80562b <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  805625:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  80562b:	85 f6                	test   %esi,%esi
+  80562d:	74 06                	je     805635 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80562f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  805635:	85 db                	test   %ebx,%ebx
+  805637:	74 e0                	je     805619 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  805639:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80563f:	eb d8                	jmp    805619 <ipc_recv_pages+0xe5>
+
+00805641 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  805641:	55                   	push   %ebp
+  805642:	89 e5                	mov    %esp,%ebp
+  805644:	57                   	push   %edi
+  805645:	56                   	push   %esi
+  805646:	53                   	push   %ebx
+  805647:	83 ec 1c             	sub    $0x1c,%esp
+  80564a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80564d:	8b 75 08             	mov    0x8(%ebp),%esi
+  805650:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  805656:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80565a:	75 2b                	jne    805687 <ipc_try_send_pages+0x46>
+  80565c:	89 e2                	mov    %esp,%edx
+  80565e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  805663:	29 d0                	sub    %edx,%eax
+  805665:	89 c2                	mov    %eax,%edx
+  805667:	c1 ea 0f             	shr    $0xf,%edx
+  80566a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80566f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805674:	0f 42 c2             	cmovb  %edx,%eax
+  805677:	8b 04 85 60 94 80 00 	mov    0x809460(,%eax,4),%eax
+  80567e:	8b 70 48             	mov    0x48(%eax),%esi
+  805681:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  805687:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80568d:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  805692:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805695:	85 ff                	test   %edi,%edi
+  805697:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80569c:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80569f:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8056a5:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8056ab:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8056b1:	83 ec 0c             	sub    $0xc,%esp
+  8056b4:	ff 75 14             	push   0x14(%ebp)
+  8056b7:	ff 75 18             	push   0x18(%ebp)
+  8056ba:	57                   	push   %edi
+  8056bb:	ff 75 0c             	push   0xc(%ebp)
+  8056be:	ff 75 08             	push   0x8(%ebp)
+  8056c1:	e8 06 c4 ff ff       	call   801acc <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8056c6:	83 c4 20             	add    $0x20,%esp
+  8056c9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8056cc:	75 21                	jne    8056ef <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8056ce:	83 ec 04             	sub    $0x4,%esp
+  8056d1:	6a ff                	push   $0xffffffff
+  8056d3:	53                   	push   %ebx
+  8056d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8056d7:	e8 fd c5 ff ff       	call   801cd9 <sys_futex_wait>
+  8056dc:	83 c4 10             	add    $0x10,%esp
+  8056df:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8056e2:	74 c7                	je     8056ab <ipc_try_send_pages+0x6a>
+  8056e4:	85 c0                	test   %eax,%eax
+  8056e6:	79 c3                	jns    8056ab <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8056e8:	e8 cf c1 ff ff       	call   8018bc <sys_yield>
+  8056ed:	eb bc                	jmp    8056ab <ipc_try_send_pages+0x6a>
+	}
+}
+  8056ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8056f2:	5b                   	pop    %ebx
+  8056f3:	5e                   	pop    %esi
+  8056f4:	5f                   	pop    %edi
+  8056f5:	5d                   	pop    %ebp
+  8056f6:	c3                   	ret
+
+008056f7 <ipc_send>:
+{
+  8056f7:	55                   	push   %ebp
+  8056f8:	89 e5                	mov    %esp,%ebp
+  8056fa:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8056fd:	ff 75 14             	push   0x14(%ebp)
+  805700:	6a 01                	push   $0x1
+  805702:	ff 75 10             	push   0x10(%ebp)
+  805705:	ff 75 0c             	push   0xc(%ebp)
+  805708:	ff 75 08             	push   0x8(%ebp)
+  80570b:	e8 31 ff ff ff       	call   805641 <ipc_try_send_pages>
+  805710:	83 c4 20             	add    $0x20,%esp
+  805713:	85 c0                	test   %eax,%eax
+  805715:	78 02                	js     805719 <ipc_send+0x22>
+}
+  805717:	c9                   	leave
+  805718:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  805719:	50                   	push   %eax
+  80571a:	68 42 62 80 00       	push   $0x806242
+  80571f:	6a 3f                	push   $0x3f
+  805721:	68 57 62 80 00       	push   $0x806257
+  805726:	e8 ba b4 ff ff       	call   800be5 <_panic>
+
+0080572b <ipc_send_pages>:
+{
+  80572b:	55                   	push   %ebp
+  80572c:	89 e5                	mov    %esp,%ebp
+  80572e:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  805731:	ff 75 18             	push   0x18(%ebp)
+  805734:	ff 75 14             	push   0x14(%ebp)
+  805737:	ff 75 10             	push   0x10(%ebp)
+  80573a:	ff 75 0c             	push   0xc(%ebp)
+  80573d:	ff 75 08             	push   0x8(%ebp)
+  805740:	e8 fc fe ff ff       	call   805641 <ipc_try_send_pages>
+  805745:	83 c4 20             	add    $0x20,%esp
+  805748:	85 c0                	test   %eax,%eax
+  80574a:	78 02                	js     80574e <ipc_send_pages+0x23>
+}
+  80574c:	c9                   	leave
+  80574d:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80574e:	50                   	push   %eax
+  80574f:	68 61 62 80 00       	push   $0x806261
+  805754:	6a 64                	push   $0x64
+  805756:	68 57 62 80 00       	push   $0x806257
+  80575b:	e8 85 b4 ff ff       	call   800be5 <_panic>
+
+00805760 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805760:	55                   	push   %ebp
+  805761:	89 e5                	mov    %esp,%ebp
+  805763:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805766:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80576b:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  805771:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  805777:	8b 52 50             	mov    0x50(%edx),%edx
+  80577a:	39 ca                	cmp    %ecx,%edx
+  80577c:	74 11                	je     80578f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80577e:	83 c0 01             	add    $0x1,%eax
+  805781:	3d 00 04 00 00       	cmp    $0x400,%eax
+  805786:	75 e3                	jne    80576b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80578d:	eb 0e                	jmp    80579d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80578f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  805795:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80579a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80579d:	5d                   	pop    %ebp
+  80579e:	c3                   	ret
+
+0080579f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80579f:	55                   	push   %ebp
+  8057a0:	89 e5                	mov    %esp,%ebp
+  8057a2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8057a5:	89 c2                	mov    %eax,%edx
+  8057a7:	c1 ea 16             	shr    $0x16,%edx
+  8057aa:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8057b1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8057b6:	f6 c1 01             	test   $0x1,%cl
+  8057b9:	74 1e                	je     8057d9 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8057bb:	c1 e8 0c             	shr    $0xc,%eax
+  8057be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8057c5:	a8 01                	test   $0x1,%al
+  8057c7:	74 10                	je     8057d9 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8057c9:	c1 e8 0c             	shr    $0xc,%eax
+  8057cc:	c1 e0 04             	shl    $0x4,%eax
+  8057cf:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8057d6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8057d9:	89 d0                	mov    %edx,%eax
+  8057db:	5d                   	pop    %ebp
+  8057dc:	c3                   	ret
+
+008057dd <__udivdi3>:
+  8057dd:	57                   	push   %edi
+  8057de:	56                   	push   %esi
+  8057df:	53                   	push   %ebx
+  8057e0:	83 ec 20             	sub    $0x20,%esp
+  8057e3:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8057e7:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8057eb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8057ef:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8057f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8057f7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8057fb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8057ff:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805803:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80580d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805812:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805819:	00 
+  80581a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805821:	00 
+  805822:	eb 08                	jmp    80582c <__udivdi3+0x4f>
+  805824:	83 e9 01             	sub    $0x1,%ecx
+  805827:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80582a:	74 68                	je     805894 <__udivdi3+0xb7>
+  80582c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805830:	01 c0                	add    %eax,%eax
+  805832:	89 c6                	mov    %eax,%esi
+  805834:	89 d7                	mov    %edx,%edi
+  805836:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80583a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80583e:	0f ad d0             	shrd   %cl,%edx,%eax
+  805841:	d3 ea                	shr    %cl,%edx
+  805843:	f6 c1 20             	test   $0x20,%cl
+  805846:	74 04                	je     80584c <__udivdi3+0x6f>
+  805848:	89 d0                	mov    %edx,%eax
+  80584a:	31 d2                	xor    %edx,%edx
+  80584c:	83 e0 01             	and    $0x1,%eax
+  80584f:	89 04 24             	mov    %eax,(%esp)
+  805852:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805859:	00 
+  80585a:	8b 04 24             	mov    (%esp),%eax
+  80585d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805861:	09 f0                	or     %esi,%eax
+  805863:	09 fa                	or     %edi,%edx
+  805865:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805869:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80586d:	39 f0                	cmp    %esi,%eax
+  80586f:	89 d3                	mov    %edx,%ebx
+  805871:	19 fb                	sbb    %edi,%ebx
+  805873:	72 af                	jb     805824 <__udivdi3+0x47>
+  805875:	29 f0                	sub    %esi,%eax
+  805877:	19 fa                	sbb    %edi,%edx
+  805879:	89 cf                	mov    %ecx,%edi
+  80587b:	c1 ef 05             	shr    $0x5,%edi
+  80587e:	83 e7 01             	and    $0x1,%edi
+  805881:	89 fe                	mov    %edi,%esi
+  805883:	83 f6 01             	xor    $0x1,%esi
+  805886:	d3 e6                	shl    %cl,%esi
+  805888:	d3 e7                	shl    %cl,%edi
+  80588a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80588e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805892:	eb 90                	jmp    805824 <__udivdi3+0x47>
+  805894:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805898:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80589c:	83 c4 20             	add    $0x20,%esp
+  80589f:	5b                   	pop    %ebx
+  8058a0:	5e                   	pop    %esi
+  8058a1:	5f                   	pop    %edi
+  8058a2:	c3                   	ret
+
+008058a3 <__umoddi3>:
+  8058a3:	57                   	push   %edi
+  8058a4:	56                   	push   %esi
+  8058a5:	53                   	push   %ebx
+  8058a6:	83 ec 08             	sub    $0x8,%esp
+  8058a9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8058ad:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8058b1:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8058b5:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8058b9:	57                   	push   %edi
+  8058ba:	56                   	push   %esi
+  8058bb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8058bf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8058c3:	52                   	push   %edx
+  8058c4:	50                   	push   %eax
+  8058c5:	e8 13 ff ff ff       	call   8057dd <__udivdi3>
+  8058ca:	89 c3                	mov    %eax,%ebx
+  8058cc:	0f af d6             	imul   %esi,%edx
+  8058cf:	89 f9                	mov    %edi,%ecx
+  8058d1:	0f af cb             	imul   %ebx,%ecx
+  8058d4:	01 d1                	add    %edx,%ecx
+  8058d6:	89 d8                	mov    %ebx,%eax
+  8058d8:	f7 e6                	mul    %esi
+  8058da:	89 c6                	mov    %eax,%esi
+  8058dc:	89 d7                	mov    %edx,%edi
+  8058de:	01 cf                	add    %ecx,%edi
+  8058e0:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8058e4:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8058e8:	29 f0                	sub    %esi,%eax
+  8058ea:	19 fa                	sbb    %edi,%edx
+  8058ec:	83 c4 18             	add    $0x18,%esp
+  8058ef:	5b                   	pop    %ebx
+  8058f0:	5e                   	pop    %esi
+  8058f1:	5f                   	pop    %edi
+  8058f2:	c3                   	ret
+
+008058f3 <__divdi3>:
+  8058f3:	53                   	push   %ebx
+  8058f4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8058f8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8058fc:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  805900:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  805904:	85 d2                	test   %edx,%edx
+  805906:	78 12                	js     80591a <__divdi3+0x27>
+  805908:	85 db                	test   %ebx,%ebx
+  80590a:	78 2e                	js     80593a <__divdi3+0x47>
+  80590c:	53                   	push   %ebx
+  80590d:	51                   	push   %ecx
+  80590e:	52                   	push   %edx
+  80590f:	50                   	push   %eax
+  805910:	e8 c8 fe ff ff       	call   8057dd <__udivdi3>
+  805915:	83 c4 10             	add    $0x10,%esp
+  805918:	eb 1e                	jmp    805938 <__divdi3+0x45>
+  80591a:	f7 d8                	neg    %eax
+  80591c:	83 d2 00             	adc    $0x0,%edx
+  80591f:	f7 da                	neg    %edx
+  805921:	85 db                	test   %ebx,%ebx
+  805923:	78 2a                	js     80594f <__divdi3+0x5c>
+  805925:	53                   	push   %ebx
+  805926:	51                   	push   %ecx
+  805927:	52                   	push   %edx
+  805928:	50                   	push   %eax
+  805929:	e8 af fe ff ff       	call   8057dd <__udivdi3>
+  80592e:	83 c4 10             	add    $0x10,%esp
+  805931:	f7 d8                	neg    %eax
+  805933:	83 d2 00             	adc    $0x0,%edx
+  805936:	f7 da                	neg    %edx
+  805938:	5b                   	pop    %ebx
+  805939:	c3                   	ret
+  80593a:	f7 d9                	neg    %ecx
+  80593c:	83 d3 00             	adc    $0x0,%ebx
+  80593f:	f7 db                	neg    %ebx
+  805941:	53                   	push   %ebx
+  805942:	51                   	push   %ecx
+  805943:	52                   	push   %edx
+  805944:	50                   	push   %eax
+  805945:	e8 93 fe ff ff       	call   8057dd <__udivdi3>
+  80594a:	83 c4 10             	add    $0x10,%esp
+  80594d:	eb e2                	jmp    805931 <__divdi3+0x3e>
+  80594f:	f7 d9                	neg    %ecx
+  805951:	83 d3 00             	adc    $0x0,%ebx
+  805954:	f7 db                	neg    %ebx
+  805956:	53                   	push   %ebx
+  805957:	51                   	push   %ecx
+  805958:	52                   	push   %edx
+  805959:	50                   	push   %eax
+  80595a:	e8 7e fe ff ff       	call   8057dd <__udivdi3>
+  80595f:	83 c4 10             	add    $0x10,%esp
+  805962:	eb d4                	jmp    805938 <__divdi3+0x45>
+
+00805964 <__moddi3>:
+  805964:	57                   	push   %edi
+  805965:	56                   	push   %esi
+  805966:	53                   	push   %ebx
+  805967:	83 ec 08             	sub    $0x8,%esp
+  80596a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80596e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805972:	8b 74 24 20          	mov    0x20(%esp),%esi
+  805976:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80597a:	57                   	push   %edi
+  80597b:	56                   	push   %esi
+  80597c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805980:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805984:	52                   	push   %edx
+  805985:	50                   	push   %eax
+  805986:	e8 68 ff ff ff       	call   8058f3 <__divdi3>
+  80598b:	89 c3                	mov    %eax,%ebx
+  80598d:	0f af d6             	imul   %esi,%edx
+  805990:	89 f9                	mov    %edi,%ecx
+  805992:	0f af cb             	imul   %ebx,%ecx
+  805995:	01 d1                	add    %edx,%ecx
+  805997:	89 d8                	mov    %ebx,%eax
+  805999:	f7 e6                	mul    %esi
+  80599b:	89 c6                	mov    %eax,%esi
+  80599d:	89 d7                	mov    %edx,%edi
+  80599f:	01 cf                	add    %ecx,%edi
+  8059a1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8059a5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8059a9:	29 f0                	sub    %esi,%eax
+  8059ab:	19 fa                	sbb    %edi,%edx
+  8059ad:	83 c4 18             	add    $0x18,%esp
+  8059b0:	5b                   	pop    %ebx
+  8059b1:	5e                   	pop    %esi
+  8059b2:	5f                   	pop    %edi
+  8059b3:	c3                   	ret